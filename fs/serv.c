@@ -45,8 +45,13 @@ struct OpenFile opentab[MAXOPEN] = {
   {0, 0, 1, 0}
 };
 
-// Virtual address at which to receive page mappings containing client requests.
-union Fsipc *fsreq = (union Fsipc *) 0x0ffff000;
+// Virtual address at which to receive page mappings containing client
+// requests: a window of IPC_MAXPAGES pages, for large writes, ending
+// at DISKMAP.
+union Fsipc *fsreq = (union Fsipc *) (DISKMAP - IPC_MAXPAGES * PGSIZE);
+
+// Virtual address of the pages that carry large read replies.
+char *fsreadbuf = (char *) (DISKMAP - 2 * IPC_MAXPAGES * PGSIZE);
 
 void
 serve_init(void) {
@@ -221,10 +226,48 @@ serve_read(envid_t envid, union Fsipc *ipc) {
 }
 
 
+// Read at most req->req_n bytes, and at most IPC_MAXPAGES pages, from
+// the current seek position in req->req_fileid into fresh pages at
+// fsreadbuf, and return them in *pg_store and *perm_store to be sent
+// with the reply.  Then update the seek position.  Returns the number
+// of bytes successfully read, or < 0 on error.
+int
+serve_read_pages(envid_t envid, struct Fsreq_read *req,
+                 void **pg_store, int *perm_store) {
+  struct OpenFile *o;
+  size_t n, npages;
+  int r;
+
+  if (debug)
+    cprintf("serve_read_pages %08x %08x %08x\n", envid, req->req_fileid, req->req_n);
+
+  if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+    return r;
+  if (o->o_fd->fd_offset >= o->o_file->f_size)
+    return 0;
+  n = MIN(req->req_n, IPC_MAXPAGES * PGSIZE);
+  n = MIN(n, o->o_file->f_size - o->o_fd->fd_offset);
+
+  // The client keeps the pages of the last reply, so use new ones.
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  if ((r = sys_page_alloc_range(0, fsreadbuf, npages, PTE_P | PTE_U | PTE_W)) < 0)
+    return r;
+  if ((r = file_read(o->o_file, fsreadbuf, n, o->o_fd->fd_offset)) < 0)
+    return r;
+
+  o->o_fd->fd_offset += r;
+  *pg_store = IPC_PAGES(fsreadbuf, npages);
+  *perm_store = PTE_P | PTE_U | PTE_W;
+  return r;
+}
+
 // Write req->req_n bytes from req->req_buf to req_fileid, starting at
 // the current seek position, and update the seek position
 // accordingly.  Extend the file if necessary.  Returns the number of
 // bytes written, or < 0 on error.
+//
+// A write too large for req_buf carries its data in the pages after
+// the request page instead.
 int
 serve_write(envid_t envid, struct Fsreq_write *req) {
   if (debug)
@@ -232,11 +275,17 @@ serve_write(envid_t envid, struct Fsreq_write *req) {
 
   // LAB 5: Your code here.
   struct OpenFile *o;
+  char *buf = req->req_buf;
   int r;
 
+  if (req->req_n > sizeof(req->req_buf)) {
+    if (1 + ROUNDUP(req->req_n, PGSIZE) / PGSIZE > thisenv->env_ipc_npages)
+      return -E_INVAL;
+    buf = (char *) req + PGSIZE;
+  }
   if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
     return r;
-  if ((r = file_write(o->o_file, req->req_buf, req->req_n, o->o_fd->fd_offset)) < 0)
+  if ((r = file_write(o->o_file, buf, req->req_n, o->o_fd->fd_offset)) < 0)
     return r;
 
   o->o_fd->fd_offset += r;
@@ -299,37 +348,65 @@ fshandler handlers[] = {
   [FSREQ_SYNC] =    serve_sync
 };
 
+// Requests small enough to arrive in message registers (IPC_MR)
+// rather than on an argument page.  Their handlers only read the
+// request and reply with just the IPC value.
+static bool
+small_request(uint32_t req) {
+  return req == FSREQ_FLUSH || req == FSREQ_SET_SIZE || req == FSREQ_SYNC;
+}
+
 void
 serve(void) {
-  uint32_t req, whom;
-  int perm, r;
-  void *pg;
+  uint32_t req, whom = 0, mr[IPC_NMR];
+  int perm, r = 0, reply_perm = 0;
+  union Fsipc *arg;
+  void *pg = NULL;
 
   while (1) {
+    // Reply to the last request, if any, and wait for the next one.
+    // Its argument page replaces the last one at fsreq.
     perm = 0;
-    req = ipc_recv((int32_t *) &whom, fsreq, &perm);
+    req = ipc_reply_recv(whom, r, pg, reply_perm, (int32_t *) &whom,
+                         IPC_PAGES(fsreq, IPC_MAXPAGES), &perm);
     if (debug)
       cprintf("fs req %d from %08x [page %08x: %s]\n",
               req, whom, uvpt[PGNUM(fsreq)], fsreq);
 
-    // All requests must contain an argument page
-    if (!(perm & PTE_P)) {
+    // All requests must contain an argument page, or, for small
+    // requests, message registers
+    if ((perm & IPC_MR) && small_request(req)) {
+      memmove(mr, (const void *) thisenv->env_ipc_mr, sizeof(mr));
+      arg = (union Fsipc *) mr;
+    } else if (perm & PTE_P) {
+      arg = fsreq;
+    } else {
       cprintf("Invalid request from %08x: no argument page\n",
               whom);
+      whom = 0;
       continue; // just leave it hanging...
     }
 
     pg = NULL;
+    reply_perm = 0;
     if (req == FSREQ_OPEN) {
-      r = serve_open(whom, (struct Fsreq_open *) fsreq, &pg, &perm);
+      r = serve_open(whom, (struct Fsreq_open *) arg, &pg, &reply_perm);
+    } else if (req == FSREQ_READ
+               && arg->read.req_n > sizeof(arg->readRet.ret_buf)) {
+      r = serve_read_pages(whom, &arg->read, &pg, &reply_perm);
     } else if (req < ARRAY_SIZE(handlers) && handlers[req]) {
-      r = handlers[req](whom, fsreq);
+      r = handlers[req](whom, arg);
     } else {
       cprintf("Invalid request code %d from %08x\n", req, whom);
       r = -E_INVAL;
     }
-    ipc_send(whom, r, pg, perm);
-    sys_page_unmap(0, fsreq);
+
+    // Drop any pages that came after the request page, such as the
+    // data of a large write, rather than keep the client's data
+    // mapped until a later request replaces them.
+    if (thisenv->env_ipc_npages > 1)
+      sys_page_unmap_range(0, (char *) fsreq + PGSIZE,
+                           thisenv->env_ipc_npages - 1);
   }
 }
 
@@ -38,6 +38,21 @@ enum {
 	ENV_NOT_RUNNABLE
 };
 
+// Message registers.  An IPC sent with IPC_MR in its perm carries the
+// IPC_NMR words at srcva, copied into the receiver's env_ipc_mr, in
+// place of a page, so small messages need no page mapping at all.
+#define IPC_NMR			16
+#define IPC_MR			0x1000
+
+// Multi-page IPC.  IPC_PAGES(va, n) tags a page-aligned srcva or dstva
+// with IPC_NPAGES and a page count n <= IPC_MAXPAGES in its low bits: a
+// send then carries the n pages from va up, and a receive accepts up
+// to n pages from va up.  A count of 0 means one page, as before.  An
+// address that is not page-aligned and lacks IPC_NPAGES is an error.
+#define IPC_MAXPAGES		256
+#define IPC_NPAGES		0x800
+#define IPC_PAGES(va, n)	((void *) ((uintptr_t) (va) | IPC_NPAGES | (n)))
+
 // Special environment types
 enum EnvType {
 	ENV_TYPE_USER = 0,
@@ -55,6 +70,11 @@ struct Env {
 	uint32_t env_runs;		// Number of times environment has run
 	int env_cpunum;			// The CPU that the env is running on
 
+	// Scheduling
+	struct Env *env_rq_next;	// Next env on a CPU's ready queue
+	struct Env *env_rq_prev;	// Previous env on a CPU's ready queue
+	int env_rq_cpu;			// CPU whose ready queue holds us, or -1
+
 	// Heap
 	uintptr_t env_brk; // Current env's break, initialized in load_icode
 	// Address space
@@ -66,10 +86,42 @@ struct Env {
 
 	// Lab 4 IPC
 	bool env_ipc_recving;		// Env is blocked receiving
-	void *env_ipc_dstva;		// VA at which to map received page
+	void *env_ipc_dstva;		// VA at which to map received pages
+	int env_ipc_dstnpages;		// Pages the window at env_ipc_dstva holds
 	uint32_t env_ipc_value;		// Data value sent to us
 	envid_t env_ipc_from;		// envid of the sender
-	int env_ipc_perm;		// Perm of page mapping received
+	int env_ipc_perm;		// Perm of page mapping received, or IPC_MR
+	int env_ipc_npages;		// Number of pages received
+	uint32_t env_ipc_mr[IPC_NMR];	// Message registers received
+	envid_t env_ipc_callee;		// In sys_ipc_call: env whose reply we await
+
+	// Senders blocked in sys_ipc_send or sys_ipc_call (kern/syscall.c)
+	struct Env *env_ipc_sendq;	// Envs waiting to send to us, oldest first
+	struct Env *env_ipc_sendq_tail;	// Newest env on env_ipc_sendq
+	struct Env *env_ipc_sendq_next;	// Next env on the queue we wait on
+	struct Env *env_ipc_sendto;	// Env whose queue we wait on, if any
+	uint32_t env_ipc_send_value;	// While waiting: the message to send,
+	void *env_ipc_send_srcva;	//   as for sys_ipc_try_send,
+	unsigned env_ipc_send_perm;
+	uint32_t env_ipc_send_mr[IPC_NMR];	//   its message registers,
+	bool env_ipc_send_call;		//   and whether to await a reply
+
+	// Kernel timers (kern/timer.c)
+	struct Timer *env_timer;	// Pending sleep or timer IPC, if any
+	bool env_sleeping;		// Blocked awaiting a TIMER_WAKE
+	bool env_timer_ipc_pending;	// A timer IPC fired while not receiving
+	uint32_t env_timer_ipc_value;	// Its value
+
+	// Futex wait (kern/futex.c)
+	struct PageInfo *env_futex_page;	// Page of the word we wait on, if any
+	uint32_t env_futex_off;		// The word's offset in that page
+	struct Env *env_futex_next;	// Next waiter on our hash chain
+
+	// Syscall ring (kern/ring.c)
+	struct SyscallRing *env_ring;	// Kernel address of the ring page
+	int env_ring_flags;		// RING_POLL
+	struct Env *env_ring_next;	// Next env with a RING_POLL ring
+	struct Env **env_ring_prev;	// Pointer to us on that list
 };
 
 #endif // !JOS_INC_ENV_H
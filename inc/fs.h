@@ -63,8 +63,12 @@ struct Super {
 enum {
 	FSREQ_OPEN = 1,
 	FSREQ_SET_SIZE,
-	// Read returns a Fsret_read on the request page
+	// Read returns a Fsret_read on the request page.  If req_n is
+	// larger than ret_buf, the data instead comes back in up to
+	// IPC_MAXPAGES pages sent with the reply.
 	FSREQ_READ,
+	// If req_n is larger than req_buf, the data is instead in the
+	// pages sent after the request page, up to IPC_MAXPAGES in all.
 	FSREQ_WRITE,
 	// Stat returns a Fsret_stat on the request page
 	FSREQ_STAT,
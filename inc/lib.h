@@ -17,6 +17,8 @@
 #include <inc/memlayout.h>
 #include <inc/syscall.h>
 #include <inc/trap.h>
+#include <inc/time.h>
+#include <inc/ring.h>
 #include <inc/fs.h>
 #include <inc/fd.h>
 #include <inc/args.h>
@@ -34,10 +36,20 @@ extern const char *binaryname;
 extern const volatile struct Env *thisenv;
 extern const volatile struct Env envs[NENV];
 extern const volatile struct PageInfo pages[];
+extern const volatile struct TimePage timepage;
 
 // exit.c
 void exit(void);
 
+// time.c
+uint64_t time_nsec(void);
+unsigned int time_msec(void);
+
+// ring.c
+int ring_submit(struct SyscallRing *r, uint32_t data, uint32_t num,
+		uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5);
+int ring_complete(struct SyscallRing *r, struct RingCqe *cqe);
+
 // pgfault.c
 void set_pgfault_handler(void (*handler)(struct UTrapframe *utf));
 
@@ -51,6 +63,7 @@ envid_t sys_getenvid(void);
 int sys_env_destroy(envid_t);
 void sys_yield(void);
 static envid_t sys_exofork(void);
+envid_t	sys_fork(void);
 int	sys_env_set_status(envid_t env, int status);
 int	sys_env_set_trapframe(envid_t env, struct Trapframe *tf);
 int	sys_env_set_pgfault_upcall(envid_t env, void *upcall);
@@ -58,6 +71,11 @@ int	sys_page_alloc(envid_t env, void *pg, int perm);
 int	sys_page_map(envid_t src_env, void *src_pg,
 		     envid_t dst_env, void *dst_pg, int perm);
 int	sys_page_unmap(envid_t env, void *pg);
+int	sys_page_alloc_range(envid_t env, void *pg, size_t npages, int perm);
+int	sys_page_map_range(envid_t src_env, void *src_pg, envid_t dst_env,
+			   void *dst_pg, size_t npages, int perm);
+int	sys_page_unmap_range(envid_t env, void *pg, size_t npages);
+int	sys_page_protect(envid_t env, void *pg, size_t npages, int perm);
 int	sys_ipc_try_send(envid_t to_env, uint32_t value, void *pg, int perm);
 int	sys_ipc_recv(void *rcv_pg);
 unsigned int sys_time_msec(void);
@@ -69,6 +87,14 @@ int sys_exec(envid_t child);
 #endif
 int sys_sleep(unsigned msec);
 int sys_net_get_macaddr(char *macaddr);
+int sys_ipc_timer(unsigned msec, uint32_t value);
+int sys_ring_setup(struct SyscallRing *ring, int flags);
+int sys_ring_enter(void);
+int sys_futex_wait(const volatile void *addr, uint32_t val, unsigned msec);
+int sys_futex_wake(const volatile void *addr, int n);
+int sys_ipc_call(envid_t envid, uint32_t value, void *srcva, int perm, void *dstva);
+int sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm);
+int sys_ipc_reply_recv(envid_t envid, uint32_t value, void *srcva, int perm, void *dstva);
 
 // This must be inlined.  Exercise for reader: why?
 static inline envid_t __attribute__((always_inline))
@@ -83,10 +109,13 @@ sys_exofork(void) {
 // ipc.c
 void ipc_send(envid_t to_env, uint32_t value, void *pg, int perm);
 int32_t ipc_recv(envid_t *from_env_store, void *pg, int *perm_store);
+int32_t ipc_call(envid_t to_env, uint32_t value, void *pg, int perm,
+                 void *rcv_pg, int *perm_store);
+int32_t ipc_reply_recv(envid_t to_env, uint32_t value, void *pg, int perm,
+                       envid_t *from_env_store, void *rcv_pg, int *perm_store);
 envid_t ipc_find_env(enum EnvType type);
 
 // fork.c
-#define  PTE_SHARE  0x400
 envid_t fork(void);
 envid_t sfork(void);  // Challenge!
 
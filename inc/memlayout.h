@@ -17,6 +17,7 @@
 #define GD_UT     0x18     // user text
 #define GD_UD     0x20     // user data
 #define GD_TSS0   0x28     // Task segment selector for CPU 0
+#define GD_CPU0   0x68     // Per-CPU data segment for CPU 0 (after NCPU TSSs)
 
 /*
  * Virtual memory map:                                Permissions
@@ -50,7 +51,9 @@
  *    UVPT      ---->  +------------------------------+ 0xef400000
  *                     |          RO PAGES            | R-/R-  PTSIZE
  *    UPAGES    ---->  +------------------------------+ 0xef000000
- *                     |           RO ENVS            | R-/R-  PTSIZE
+ *                     |        RO TIME PAGE          | R-/R-  PGSIZE
+ *    UTIME     ---->  + - - - - - - - - - - - - - - -+ 0xeefff000
+ *                     |           RO ENVS            | R-/R-  PTSIZE-PGSIZE
  * UTOP,UENVS ------>  +------------------------------+ 0xeec00000
  * UXSTACKTOP -/       |     User Exception Stack     | RW/RW  PGSIZE
  *                     +------------------------------+ 0xeebff000
@@ -114,6 +117,9 @@
 #define UPAGES		(UVPT - PTSIZE)
 // Read-only copies of the global env structures
 #define UENVS		(UPAGES - PTSIZE)
+// Read-only clock parameters (struct TimePage), in the last page of
+// the UENVS region
+#define UTIME		(UPAGES - PGSIZE)
 
 /*
  * Top of user VM. User can manipulate VA from UTOP-1 and down!
@@ -174,8 +180,10 @@ extern volatile pde_t uvpd[];     // VA of current page directory
  * with page2pa() in kern/pmap.h.
  */
 struct PageInfo {
-	// Next page on the free list.
+	// Next block on the free list.
 	struct PageInfo *pp_link;
+	// The pointer to us on the free list, for unlinking a buddy.
+	struct PageInfo **pp_prev;
 
 	// pp_ref is the count of pointers (usually in page table entries)
 	// to this page, for pages allocated using page_alloc.
@@ -183,6 +191,11 @@ struct PageInfo {
 	// boot_alloc do not have valid reference count fields.
 
 	uint16_t pp_ref;
+
+	// The buddy allocator keeps these in the first page of each free
+	// block: the block holds 1 << pp_order pages.
+	uint8_t pp_order;
+	bool pp_free;
 };
 
 #endif /* !__ASSEMBLER__ */
@@ -0,0 +1,48 @@
+/* See COPYRIGHT for copyright information. */
+
+#ifndef JOS_INC_RING_H
+#define JOS_INC_RING_H
+
+#include <inc/types.h>
+
+// A syscall ring: one PTE_SHARE page shared by an environment and the
+// kernel, holding a submission queue (SQ) of syscalls to run and a
+// completion queue (CQ) of their results.  The environment fills SQ
+// entries and advances sq_tail; sys_ring_enter() (or an idle CPU, for
+// rings set up with RING_POLL) runs them in order, advancing sq_head
+// and posting one CQ entry per SQ entry at cq_tail.  The environment
+// consumes CQ entries and advances cq_head.
+//
+// Indices run freely and are reduced modulo the queue size on use.
+// Only the memory and IPC syscalls in ring_op_ok() (kern/ring.c) may
+// be submitted; anything else completes with -E_INVAL.
+
+#define RING_NSQE	64	// Submission queue entries (power of 2)
+#define RING_NCQE	128	// Completion queue entries (power of 2)
+
+// Flags for sys_ring_setup()
+#define RING_POLL	0x1	// Idle CPUs may run our submissions
+
+// A submitted syscall
+struct RingSqe {
+	uint32_t sqe_num;	// SYS_* number
+	uint32_t sqe_args[5];	// Arguments, as for syscall()
+	uint32_t sqe_data;	// Copied to the completion, for the user
+};
+
+// A completed syscall
+struct RingCqe {
+	uint32_t cqe_data;	// sqe_data of the submission
+	int32_t cqe_res;	// The syscall's return value
+};
+
+struct SyscallRing {
+	volatile uint32_t sq_head;	// Next SQE the kernel runs
+	volatile uint32_t sq_tail;	// Next SQE the user fills
+	volatile uint32_t cq_head;	// Next CQE the user reads
+	volatile uint32_t cq_tail;	// Next CQE the kernel fills
+	struct RingSqe sq[RING_NSQE];
+	struct RingCqe cq[RING_NCQE];
+};
+
+#endif /* !JOS_INC_RING_H */
@@ -1,6 +1,7 @@
 #ifndef JOS_INC_SYSCALL_H
 #define JOS_INC_SYSCALL_H
 
+#include <inc/types.h>
 #include <inc/challenge.h>
 
 /* system call numbers */
@@ -29,7 +30,46 @@ enum {
 #endif
   SYS_sleep,
   SYS_net_get_macaddr,
+  SYS_ipc_timer,
+  SYS_ring_setup,
+  SYS_ring_enter,
+  SYS_ipc_call,
+  SYS_ipc_reply_recv,
+  SYS_ipc_send,
+  SYS_futex_wait,
+  SYS_futex_wake,
+  SYS_fork,
+  SYS_page_alloc_range,
+  SYS_page_map_range,
+  SYS_page_unmap_range,
+  SYS_page_protect,
   NSYSCALLS
 };
 
+// Syscalls that user code issues with sysenter instead of int $T_SYSCALL.
+// The kernel runs them straight off the sysenter stack frame (see
+// sysenter_dispatch() in kern/trap.c), so they must take no big kernel
+// lock, never block or reschedule the caller, and take at most four
+// arguments: sysenter carries the return eip and esp in %esi and %ebp.
+static inline bool
+syscall_sysenter(uint32_t num) {
+  switch (num) {
+    case SYS_cputs:
+    case SYS_cgetc:
+    case SYS_getenvid:
+    case SYS_page_alloc:
+    case SYS_page_unmap:
+    case SYS_page_alloc_range:
+    case SYS_page_unmap_range:
+    case SYS_page_protect:
+    case SYS_time_msec:
+    case SYS_ring_enter:
+    case SYS_ipc_try_send:
+    case SYS_futex_wake:
+      return 1;
+    default:
+      return 0;
+  }
+}
+
 #endif /* !JOS_INC_SYSCALL_H */
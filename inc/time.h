@@ -0,0 +1,38 @@
+/* See COPYRIGHT for copyright information. */
+
+#ifndef JOS_INC_TIME_H
+#define JOS_INC_TIME_H
+
+#include <inc/types.h>
+
+// The kernel's clock is the TSC, calibrated against the PIT at boot
+// and synchronized across CPUs as each AP starts.  The conversion
+// parameters live in a page mapped read-only at UTIME in every
+// environment, so user code can read the time without a system call.
+//
+//	nsec = (tsc - tp_tsc_base) * tp_mult >> TIME_SHIFT
+//
+// The kernel fills in the page once in time_init(), before any
+// environment runs, and never changes it afterwards.
+
+#define TIME_SHIFT	24
+
+struct TimePage {
+	uint64_t tp_tsc_base;		// TSC value at time zero
+	uint32_t tp_mult;		// Nanoseconds per TSC tick << TIME_SHIFT
+	uint32_t tp_tsc_per_msec;	// Measured TSC frequency
+};
+
+// Nanoseconds since time zero at TSC value tsc.  The 64x32-bit product
+// is split in two so that it neither overflows nor needs libgcc.
+static inline uint64_t
+timepage_nsec(const volatile struct TimePage *tp, uint64_t tsc)
+{
+	uint64_t delta = tsc - tp->tp_tsc_base;
+	uint32_t mult = tp->tp_mult;
+
+	return (((uint64_t) (uint32_t) delta * mult) >> TIME_SHIFT)
+		+ (((delta >> 32) * mult) << (32 - TIME_SHIFT));
+}
+
+#endif /* !JOS_INC_TIME_H */
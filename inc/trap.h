@@ -37,6 +37,7 @@
 #define IRQ_SERIAL       4
 #define IRQ_SPURIOUS     7
 #define IRQ_IDE         14
+#define IRQ_RESCHED     18	// IPI: new work queued for a halted CPU
 #define IRQ_ERROR       19
 
 #ifndef __ASSEMBLER__
@@ -261,6 +261,16 @@ xchg(volatile uint32_t *addr, uint32_t newval)
 	return result;
 }
 
+// Atomically add incr to *addr and return the old value.
+static inline uint32_t
+xadd(volatile uint32_t *addr, uint32_t incr)
+{
+	asm volatile("lock; xaddl %0, %1"
+		     : "+r" (incr), "+m" (*addr)
+		     : : "cc", "memory");
+	return incr;
+}
+
 #define wrmsr(msr,val1,val2) \
   __asm__ __volatile__("wrmsr" \
   : /* no outputs */ \
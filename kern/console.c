@@ -9,6 +9,7 @@
 #include <kern/console.h>
 #include <kern/trap.h>
 #include <kern/picirq.h>
+#include <kern/spinlock.h>
 
 static void cons_intr(int (*proc)(void));
 static void cons_putc(int c);
@@ -398,6 +399,20 @@ static struct {
 	uint32_t wpos;
 } cons;
 
+// cons_in_lock protects the input buffer and the keyboard shift state;
+// cons_lock is held across each cprintf() so that lines printed by
+// different CPUs do not interleave.
+static struct spinlock cons_in_lock = {
+#ifdef DEBUG_SPINLOCK
+	.name = "cons_in_lock"
+#endif
+};
+struct spinlock cons_lock = {
+#ifdef DEBUG_SPINLOCK
+	.name = "cons_lock"
+#endif
+};
+
 // called by device interrupt routines to feed input characters
 // into the circular console input buffer.
 static void
@@ -405,6 +420,7 @@ cons_intr(int (*proc)(void))
 {
 	int c;
 
+	spin_lock(&cons_in_lock);
 	while ((c = (*proc)()) != -1) {
 		if (c == 0)
 			continue;
@@ -412,6 +428,7 @@ cons_intr(int (*proc)(void))
 		if (cons.wpos == CONSBUFSIZE)
 			cons.wpos = 0;
 	}
+	spin_unlock(&cons_in_lock);
 }
 
 // return the next input character from the console, or 0 if none waiting
@@ -427,13 +444,15 @@ cons_getc(void)
 	kbd_intr();
 
 	// grab the next character from the input buffer.
+	c = 0;
+	spin_lock(&cons_in_lock);
 	if (cons.rpos != cons.wpos) {
 		c = cons.buf[cons.rpos++];
 		if (cons.rpos == CONSBUFSIZE)
 			cons.rpos = 0;
-		return c;
 	}
-	return 0;
+	spin_unlock(&cons_in_lock);
+	return c;
 }
 
 // output a character to the console
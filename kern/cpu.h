@@ -19,10 +19,17 @@ enum {
 
 // Per-CPU state
 struct CpuInfo {
+	struct CpuInfo *cpu_self;       // Points to itself; read through %gs
 	uint8_t cpu_id;                 // Local APIC ID; index into cpus[] below
 	volatile unsigned cpu_status;   // The status of the CPU
 	struct Env *cpu_env;            // The currently-running environment.
 	struct Taskstate cpu_ts;        // Used by x86 to find stack for interrupt
+
+	// Per-CPU ready queue (FIFO of ENV_RUNNABLE envs), see kern/sched.c
+	struct Env *cpu_runq_head;
+	struct Env *cpu_runq_tail;
+	int cpu_runq_len;
+	struct Env *cpu_handoff;	// Env to switch to next, see sched_handoff()
 };
 
 // Initialized in mpconfig.c
@@ -35,12 +42,26 @@ extern physaddr_t lapicaddr;        // Physical MMIO address of the local APIC
 extern unsigned char percpu_kstacks[NCPU][KSTKSIZE];
 
 int cpunum(void);
-#define thiscpu (&cpus[cpunum()])
+
+// In the kernel, %gs selects a segment based at this CPU's CpuInfo
+// (see env_init_percpu), so finding it is one load instead of a LAPIC
+// ID read over MMIO.
+static inline struct CpuInfo *
+percpu_self(void)
+{
+	struct CpuInfo *c;
+	asm volatile("movl %%gs:%c1,%0"
+		     : "=r" (c) : "i" (offsetof(struct CpuInfo, cpu_self)));
+	return c;
+}
+#define thiscpu (percpu_self())
 
 void mp_init(void);
 void lapic_init(void);
 void lapic_startap(uint8_t apicid, uint32_t addr);
 void lapic_eoi(void);
 void lapic_ipi(int vector);
+void lapic_ipi_cpu(int apicid, int vector);
+void lapic_timer_oneshot(uint32_t usec);
 
 #endif
@@ -15,13 +15,34 @@
 #include <kern/cpu.h>
 #include <kern/spinlock.h>
 #include <kern/kpti.h>
+#include <kern/timer.h>
+#include <kern/ring.h>
+#include <kern/futex.h>
 
 struct Env *envs = NULL;    // All environments
+struct kpti_stats kpti_stats;
 static struct Env *env_free_list;  // Free environment list
 // (linked by Env->env_link)
 
+// Protects env_free_list, env_status transitions made on behalf of
+// another environment, and the env_ipc_* fields.
+struct spinlock env_lock = {
+#ifdef DEBUG_SPINLOCK
+    .name = "env_lock"
+#endif
+};
+
 #define ENVGENSHIFT    12        // >= LOGNENV
 
+// The kernel half every env_pgdir starts with: the user-mapped kernel
+// text and data, the kernel stacks and envs.  Its page tables are
+// built once in env_init() and shared by every env, which never
+// changes them, so env_setup_vm() only has to copy the directory.
+static pde_t *env_pgdir_template;
+
+static void check_isolate(struct Env *e);
+static void check_isolate_pgdir(pde_t *pgdir);
+
 // Global descriptor table.
 //
 // Set up global descriptor table (GDT) with separate segments for
@@ -37,7 +58,7 @@ static struct Env *env_free_list;  // Free environment list
 // definition of gdt specifies the Descriptor Privilege Level (DPL)
 // of that descriptor: 0 for kernel and 3 for user.
 //
-struct Segdesc gdt[NCPU + 5] __user_mapped_data =
+struct Segdesc gdt[2 * NCPU + 5] __user_mapped_data =
     {
         // 0x0 - unused (always faults -- for trapping NULL far pointers)
         SEG_NULL,
@@ -56,7 +77,11 @@ struct Segdesc gdt[NCPU + 5] __user_mapped_data =
 
         // Per-CPU TSS descriptors (starting from GD_TSS0) are initialized
         // in trap_init_percpu()
-        [GD_TSS0 >> 3] = SEG_NULL
+        [GD_TSS0 >> 3] = SEG_NULL,
+
+        // Per-CPU data segments (starting from GD_CPU0) are initialized
+        // in env_init_percpu()
+        [GD_CPU0 >> 3] = SEG_NULL
     };
 
 struct Pseudodesc gdt_pd __user_mapped_data = {
@@ -119,20 +144,50 @@ env_init(void) {
     // Set up envs array
     // LAB 3: Your code here.
     for (int i = NENV - 1; i > -1; --i) {
+        envs[i].env_rq_cpu = -1;
         envs[i].env_link = env_free_list;
         env_free_list = envs + i;
     }
+
+    // Build the kernel half of env_pgdir once and verify it.
+    struct PageInfo *pp = page_alloc(ALLOC_ZERO);
+    if (!pp)
+        panic("env_init: out of memory");
+    ++pp->pp_ref;
+    env_pgdir_template = page2kva(pp);
+
+    boot_map_region(env_pgdir_template, (uintptr_t) __USER_MAP_BEGIN__, __USER_MAP_END__ - __USER_MAP_BEGIN__,
+                    PADDR(__USER_MAP_BEGIN__), PTE_P | PTE_W);
+
+    for (uintptr_t va = KSTACKTOP - (KSTKSIZE + KSTKGAP) * NCPU; va < KSTACKTOP; va += PGSIZE)
+        env_pgdir_template[PDX(va)] = kern_pgdir[PDX(va)];
+
+    env_pgdir_template[PDX(UENVS)] = kern_pgdir[PDX(UENVS)];
+    boot_map_region(env_pgdir_template, (uintptr_t) envs, NENV * sizeof(struct Env), PADDR(envs), PTE_P | PTE_W);
+
+    check_isolate_pgdir(env_pgdir_template);
+
     // Per-CPU part of the initialization
     env_init_percpu();
 }
 
 // Load GDT and segment descriptors.
+// Must run before this CPU first uses thiscpu or curenv.
 void
 env_init_percpu(void) {
+    int i = cpunum();
+
     lgdt(&gdt_pd);
-    // The kernel never uses GS or FS, so we leave those set to
-    // the user data segment.
-    asm volatile("movw %%ax,%%gs" : : "a" (GD_UD | 3));
+    // The kernel reaches its per-CPU data through GS: a segment based
+    // at cpus[i] whose first word points back at it.  Returning to
+    // user mode nulls GS (its DPL is 0), and switch_and_trap() reloads
+    // it on the way back in.
+    cpus[i].cpu_self = &cpus[i];
+    gdt[(GD_CPU0 >> 3) + i] = SEG16(STA_W, (uint32_t) &cpus[i],
+                                    sizeof(struct CpuInfo) - 1, 0);
+    asm volatile("movw %%ax,%%gs" : : "a" (GD_CPU0 + (i << 3)));
+    // The kernel never uses FS, so we leave it set to the user data
+    // segment.
     asm volatile("movw %%ax,%%fs" : : "a" (GD_UD | 3));
     // The kernel does use ES, DS, and SS.  We'll change between
     // the kernel and user data segments as needed.
@@ -160,8 +215,9 @@ static int
 env_setup_vm(struct Env *e) {
     struct PageInfo *pp = NULL;
 
-    // Allocate a page for the page directory
-    if (!(pp = page_alloc(ALLOC_ZERO)))
+    // Allocate a page for the page directory.  Both directories are
+    // copied in full from their templates, so neither needs zeroing.
+    if (!(pp = page_alloc(0)))
         return -E_NO_MEM;
 
     // Now, set e->env_pgdir and initialize the page directory.
@@ -183,29 +239,25 @@ env_setup_vm(struct Env *e) {
     // LAB 3: Your code here.
     e->env_pgdir = page2kva(pp);
     ++pp->pp_ref;
+    memmove(e->env_pgdir, env_pgdir_template, PGSIZE);
 
     // UVPT maps the env's own page table read-only.
     // Permissions: kernel R, user R
     e->env_pgdir[PDX(UVPT)] = PADDR(e->env_pgdir) | PTE_P | PTE_U;
 
-    boot_map_region(e->env_pgdir, (uintptr_t) __USER_MAP_BEGIN__, __USER_MAP_END__ - __USER_MAP_BEGIN__,
-                    PADDR(__USER_MAP_BEGIN__), PTE_P | PTE_W);
-
-    for (uintptr_t va = KSTACKTOP - (KSTKSIZE + KSTKGAP) * NCPU; va < KSTACKTOP; va += PGSIZE)
-        e->env_pgdir[PDX(va)] = kern_pgdir[PDX(va)];
-
-    e->env_pgdir[PDX(UENVS)] = kern_pgdir[PDX(UENVS)];
-    boot_map_region(e->env_pgdir, (uintptr_t) envs, NENV * sizeof(struct Env), PADDR(envs), PTE_P | PTE_W);
-
     // LAB 7: Your code here.
     // Allocate another page to hold kernel page table
-    if (!(pp = page_alloc(ALLOC_ZERO)))
+    if (!(pp = page_alloc(0)))
         return -E_NO_MEM;
 
     e->env_kern_pgdir = page2kva(pp);
     ++pp->pp_ref;
 
     memmove(e->env_kern_pgdir, kern_pgdir, PGSIZE);
+
+    // The kernel half is the template's, which env_init() verified
+    // holds no sensitive kernel page.  env_run() rechecks if the
+    // kernel-half PDEs ever differ from it.
     return 0;
 }
 
@@ -223,12 +275,22 @@ env_alloc(struct Env **newenv_store, envid_t parent_id) {
     int r;
     struct Env *e;
 
-    if (!(e = env_free_list))
+    spin_lock(&env_lock);
+    if (!(e = env_free_list)) {
+        spin_unlock(&env_lock);
         return -E_NO_FREE_ENV;
+    }
+    env_free_list = e->env_link;
+    spin_unlock(&env_lock);
 
     // Allocate and set up the page directory for this environment.
-    if ((r = env_setup_vm(e)) < 0)
+    if ((r = env_setup_vm(e)) < 0) {
+        spin_lock(&env_lock);
+        e->env_link = env_free_list;
+        env_free_list = e;
+        spin_unlock(&env_lock);
         return r;
+    }
 
     // Generate an env_id for this environment.
     generation = (e->env_id + (1 << ENVGENSHIFT)) & ~(NENV - 1);
@@ -273,10 +335,26 @@ env_alloc(struct Env **newenv_store, envid_t parent_id) {
     // Also clear the IPC receiving flag.
     e->env_ipc_recving = 0;
 
+    // No timers yet.
+    e->env_timer = NULL;
+    e->env_timer_ipc_pending = 0;
+    e->env_sleeping = 0;
+    e->env_ipc_callee = 0;
+    e->env_ipc_sendq = e->env_ipc_sendq_tail = NULL;
+    e->env_ipc_sendq_next = NULL;
+    e->env_ipc_sendto = NULL;
+    e->env_futex_page = NULL;
+    e->env_futex_next = NULL;
+    e->env_ring = NULL;
+    e->env_ring_flags = 0;
+
     // commit the allocation
-    env_free_list = e->env_link;
     *newenv_store = e;
 
+    // Prefer the allocating CPU; the caller queues the env once it
+    // is ready to run.
+    e->env_cpunum = thiscpu - cpus;
+
     // cprintf("[%08x] new env %08x\n", curenv ? curenv->env_id : 0, e->env_id);
     return 0;
 }
@@ -454,6 +532,61 @@ env_create(uint8_t *binary, enum EnvType type) {
     // LAB 5: Your code here.
     if (type == ENV_TYPE_FS)
         e->env_tf.tf_eflags |= FL_IOPL_MASK;
+
+    sched_enqueue(e);
+}
+
+// Queue sender, which is blocked sending to env, behind the other
+// senders to env.  Called with env_lock held.
+void
+env_sendq_push(struct Env *env, struct Env *sender) {
+    assert(!sender->env_ipc_sendto);
+    sender->env_ipc_sendto = env;
+    sender->env_ipc_sendq_next = NULL;
+    if (env->env_ipc_sendq)
+        env->env_ipc_sendq_tail->env_ipc_sendq_next = sender;
+    else
+        env->env_ipc_sendq = sender;
+    env->env_ipc_sendq_tail = sender;
+}
+
+// Remove and return the oldest sender blocked sending to env, or NULL.
+// Called with env_lock held.
+struct Env *
+env_sendq_pop(struct Env *env) {
+    struct Env *sender = env->env_ipc_sendq;
+
+    if (sender) {
+        env->env_ipc_sendq = sender->env_ipc_sendq_next;
+        sender->env_ipc_sendq_next = NULL;
+        sender->env_ipc_sendto = NULL;
+    }
+    return sender;
+}
+
+// Take e off the queue it waits on, and fail the sends of the envs
+// waiting on e with -E_BAD_ENV.  Called with env_lock held.
+static void
+env_sendq_release(struct Env *e) {
+    struct Env *env, *prev = NULL, *sender;
+
+    if ((env = e->env_ipc_sendto)) {
+        for (sender = env->env_ipc_sendq; sender != e;
+             sender = sender->env_ipc_sendq_next)
+            prev = sender;
+        if (prev)
+            prev->env_ipc_sendq_next = e->env_ipc_sendq_next;
+        else
+            env->env_ipc_sendq = e->env_ipc_sendq_next;
+        if (env->env_ipc_sendq_tail == e)
+            env->env_ipc_sendq_tail = prev;
+        e->env_ipc_sendto = NULL;
+    }
+    while ((sender = env_sendq_pop(e))) {
+        sender->env_tf.tf_regs.reg_eax = -E_BAD_ENV;
+        sender->env_status = ENV_RUNNABLE;
+        sched_enqueue(sender);
+    }
 }
 
 //
@@ -471,6 +604,10 @@ env_free(struct Env *e) {
     if (e == curenv)
         lcr3(PADDR(kern_pgdir));
 
+    spin_lock(&vm_lock);
+    timer_cancel(e);
+    ring_release(e);
+
     // Note the environment's demise.
     // cprintf("[%08x] free env %08x\n", curenv ? curenv->env_id : 0, e->env_id);
 
@@ -516,17 +653,8 @@ env_free(struct Env *e) {
         page_decref(pa2page(pa));
     }
 
-    for (uintptr_t va = (uintptr_t) __USER_MAP_BEGIN__; va < (uintptr_t) __USER_MAP_END__; va += PGSIZE) {
-        pa = PTE_ADDR(e->env_pgdir[PDX(va)]);
-        page_decref(pa2page(pa));
-    }
-
-    for (uintptr_t va = (uintptr_t) envs; va < (uintptr_t) (envs + NENV); va += PGSIZE) {
-        pa = PTE_ADDR(e->env_pgdir[PDX(va)]);
-        page_decref(pa2page(pa));
-    }
-
-    // free the page directory
+    // free the page directory; the kernel-half page tables belong to
+    // env_pgdir_template
     pa = PADDR(e->env_pgdir);
     e->env_pgdir = 0;
     page_decref(pa2page(pa));
@@ -536,9 +664,17 @@ env_free(struct Env *e) {
     page_decref(pa2page(pa));
 
     // return the environment to the free list
+    spin_lock(&env_lock);
+    env_sendq_release(e);
+    futex_cancel(e);
+    sched_remove(e);
     e->env_status = ENV_FREE;
+    // Wake the envs in wait() for e.
+    futex_wake_page(pa2page(PADDR(&e->env_status)), PGOFF(&e->env_status), NENV);
     e->env_link = env_free_list;
     env_free_list = e;
+    spin_unlock(&env_lock);
+    spin_unlock(&vm_lock);
 }
 
 //
@@ -548,13 +684,21 @@ env_free(struct Env *e) {
 //
 void
 env_destroy(struct Env *e) {
+    // We may get here from a syscall that runs without the big
+    // kernel lock (e.g. sys_cputs faulting in user_mem_assert).
+    lock_kernel_lazy();
+
     // If e is currently running on other CPUs, we change its state to
     // ENV_DYING. A zombie environment will be freed the next time
     // it traps to the kernel.
-    if (e->env_status == ENV_RUNNING && curenv != e) {
+    spin_lock(&env_lock);
+    if ((e->env_status == ENV_RUNNING || e->env_status == ENV_DYING)
+        && curenv != e) {
         e->env_status = ENV_DYING;
+        spin_unlock(&env_lock);
         return;
     }
+    spin_unlock(&env_lock);
 
     env_free(e);
 
@@ -583,10 +727,19 @@ check_user_map(pde_t *pgdir, void *va, uint32_t len, const char *name) {
 
 extern struct Pseudodesc idt_pd;
 
+// Returns true if the kernel-half PDEs of pgdir are exactly those of
+// env_pgdir_template, which env_init() verified, so that env_run() can
+// skip the full walk.
+static bool
+kpti_pde_same(pde_t *pgdir) {
+    return memcmp(&pgdir[PDX(ULIM)], &env_pgdir_template[PDX(ULIM)],
+                  (NPDENTRIES - PDX(ULIM)) * sizeof(pde_t)) == 0;
+}
+
+// Walk every page from ULIM to 4GB and panic if anything other than
+// the user-mapped kernel text/data, kernel stacks and envs is present.
 static void
-check_isolate(struct Env *e) {
-    pde_t *pgdir = e->env_pgdir;
-    uint32_t cnt = 0;
+check_isolate_pgdir(pde_t *pgdir) {
     for (uintptr_t va = ULIM; va; va += PGSIZE) {
         if ((uintptr_t) __USER_MAP_BEGIN__ <= va && va < (uintptr_t) __USER_MAP_END__)
             continue;
@@ -617,6 +770,13 @@ check_isolate(struct Env *e) {
         check_user_map(pgdir, (void *) KSTACKTOP - (KSTKSIZE + KSTKGAP) * i - KSTKSIZE, KSTKSIZE, name);
     }
     check_user_map(pgdir, env_pop_tf, sizeof(env_pop_tf), "env_pop_tf");
+
+    kpti_stats.full_checks++;
+}
+
+static void
+check_isolate(struct Env *e) {
+    check_isolate_pgdir(e->env_pgdir);
 }
 
 //
@@ -646,7 +806,7 @@ __attribute__((noreturn))
 __attribute__((noinline))
 static void
 kpti_run(struct Env *e) {
-    curenv->env_cpunum = cpunum();
+    curenv->env_cpunum = thiscpu->cpu_id;
     lcr3(PADDR(e->env_pgdir));
     env_pop_tf(&e->env_tf);
 }
@@ -660,8 +820,17 @@ kpti_run(struct Env *e) {
 
 void
 env_run(struct Env *e) {
-    // Verify no sensitive kernel page has PTE_P
+    // Verify no sensitive kernel page has PTE_P.  The full walk was
+    // done on the template the pgdir was built from; only redo it if
+    // the kernel-half PDEs differ from the template's.
+#ifdef DEBUG_KPTI
     check_isolate(e);
+#else
+    if (!kpti_pde_same(e->env_pgdir))
+        check_isolate(e);
+    else
+        kpti_stats.fast_checks++;
+#endif
 
     // Step 1: If this is a context switch (a new environment is running):
     //	   1. Set the current environment (if any) back to
@@ -681,14 +850,27 @@ env_run(struct Env *e) {
     //	e->env_tf to sensible values.
 
     // LAB 3: Your code here.
-    if (curenv && curenv->env_status == ENV_RUNNING)
-        curenv->env_status = ENV_RUNNABLE;
-
-    curenv = e;
-    e->env_status = ENV_RUNNING;
+    spin_lock(&env_lock);
+    if (curenv != e) {
+        if (curenv && curenv->env_status == ENV_RUNNING) {
+            curenv->env_status = ENV_RUNNABLE;
+            sched_enqueue(curenv);
+        }
+        curenv = e;
+    }
+    sched_remove(e);
+    // Whatever woke us, a TIMER_WAKE still pending must not end some
+    // later block.
+    e->env_sleeping = 0;
+    // A syscall that ran without the big kernel lock can return here
+    // after another CPU marked us ENV_DYING; trap() reaps us later.
+    if (e->env_status != ENV_DYING)
+        e->env_status = ENV_RUNNING;
+    spin_unlock(&env_lock);
     ++e->env_runs;
 
-    unlock_kernel();
+    if (spin_holding(&kernel_lock))
+        unlock_kernel();
     kpti_run(e);
 }
 
@@ -9,6 +9,7 @@
 extern struct Env *envs;		// All environments
 #define curenv (thiscpu->cpu_env)		// Current environment
 extern struct Segdesc gdt[];
+extern struct spinlock env_lock;
 
 void	env_init(void);
 void	env_init_percpu(void);
@@ -18,6 +19,8 @@ void	env_create(uint8_t *binary, enum EnvType type);
 void	env_destroy(struct Env *e);	// Does not return if e == curenv
 
 int	envid2env(envid_t envid, struct Env **env_store, bool checkperm);
+void	env_sendq_push(struct Env *env, struct Env *sender);
+struct Env *env_sendq_pop(struct Env *env);
 // The following two functions do not return
 void	env_run(struct Env *e) __attribute__((noreturn));
 void	env_pop_tf(struct Trapframe *tf) __attribute__((noreturn));
@@ -0,0 +1,168 @@
+// Futexes: let an env sleep until another env changes a word of
+// memory they share, instead of polling it with sys_yield().
+//
+// A waiter is keyed on the physical page and offset of its word, so
+// envs that map the same page (a PTE_SHARE page, or envs[] at UENVS)
+// meet on the same futex whatever address each maps it at.  Each
+// waiter holds a reference to its page, so that the page can't be
+// freed and reused under it.  Waiters sit on hash chains in the order
+// they arrived; env_lock protects the chains along with every Env's
+// env_futex_* fields.
+
+#include <inc/assert.h>
+#include <inc/error.h>
+
+#include <kern/futex.h>
+#include <kern/env.h>
+#include <kern/pmap.h>
+#include <kern/sched.h>
+#include <kern/timer.h>
+#include <kern/spinlock.h>
+
+#define FUTEX_NHASH	64
+
+static struct Env *futex_hash[FUTEX_NHASH];
+
+static struct Env **
+futex_chain(struct PageInfo *pp, uint32_t off)
+{
+	return &futex_hash[(PGNUM(page2pa(pp)) ^ (off >> 2)) % FUTEX_NHASH];
+}
+
+// Find the page and offset of the aligned word at user address va in
+// curenv.  Any page the user can read will do, including the
+// read-only ones above UTOP.  Called with vm_lock held.
+static int
+futex_key(const void *va, struct PageInfo **pp_store, uint32_t *off_store)
+{
+	struct PageInfo *pp;
+	pte_t *pte;
+
+	if ((uintptr_t) va >= ULIM || ((uintptr_t) va & 3))
+		return -E_INVAL;
+	if (!(pp = page_lookup(curenv->env_pgdir, (void *) va, &pte))
+	    || !(*pte & PTE_U))
+		return -E_INVAL;
+	*pp_store = pp;
+	*off_store = PGOFF(va);
+	return 0;
+}
+
+// Take e off its futex chain, if it is on one.  Called with vm_lock
+// and env_lock held.
+void
+futex_cancel(struct Env *e)
+{
+	struct Env **link;
+
+	if (!e->env_futex_page)
+		return;
+	link = futex_chain(e->env_futex_page, e->env_futex_off);
+	while (*link != e)
+		link = &(*link)->env_futex_next;
+	*link = e->env_futex_next;
+	e->env_futex_next = NULL;
+	page_decref(e->env_futex_page);
+	e->env_futex_page = NULL;
+}
+
+// If the word at va still holds val, block curenv until futex_wake()
+// on the same word or, if msec is nonzero, for at most msec
+// milliseconds.  A timeout replaces any timer curenv has pending, as
+// sys_sleep() does.  Called with the big kernel lock held.
+//
+// Does not return once curenv blocks; the system call then returns 0.
+// Otherwise returns < 0.  Errors are:
+//	-E_AGAIN if the word does not hold val.
+//	-E_INVAL if va is not word-aligned or not readable by curenv.
+//	-E_NO_MEM if msec is nonzero and no kernel timer is available.
+int
+futex_wait(const void *va, uint32_t val, unsigned msec)
+{
+	struct PageInfo *pp;
+	struct Env **link;
+	uint32_t off;
+	int r;
+
+	spin_lock(&vm_lock);
+	if ((r = futex_key(va, &pp, &off)) < 0)
+		goto out_vm;
+	// A waker stores to the word before it takes env_lock, so either
+	// we see its store here or it sees us on the chain.
+	spin_lock(&env_lock);
+	r = -E_AGAIN;
+	if (*(volatile uint32_t *) ((char *) page2kva(pp) + off) != val)
+		goto out;
+	if (msec && (r = timer_arm(curenv, msec, TIMER_WAKE, 0)) < 0)
+		goto out;
+
+	pp->pp_ref++;
+	curenv->env_futex_page = pp;
+	curenv->env_futex_off = off;
+	curenv->env_sleeping = msec != 0;
+	curenv->env_futex_next = NULL;
+	for (link = futex_chain(pp, off); *link; link = &(*link)->env_futex_next)
+		/* append */;
+	*link = curenv;
+
+	curenv->env_status = ENV_NOT_RUNNABLE;
+	curenv->env_tf.tf_regs.reg_eax = 0;
+	spin_unlock(&env_lock);
+	spin_unlock(&vm_lock);
+	sched_yield();
+
+out:
+	spin_unlock(&env_lock);
+out_vm:
+	spin_unlock(&vm_lock);
+	return r;
+}
+
+// Wake up to n envs waiting on the word at offset off in page pp,
+// oldest first.  Called with vm_lock and env_lock held.
+// Returns the number of envs woken.
+int
+futex_wake_page(struct PageInfo *pp, uint32_t off, int n)
+{
+	struct Env **link = futex_chain(pp, off), *e;
+	int woken = 0;
+
+	while (woken < n && (e = *link)) {
+		if (e->env_futex_page != pp || e->env_futex_off != off) {
+			link = &e->env_futex_next;
+			continue;
+		}
+		*link = e->env_futex_next;
+		e->env_futex_next = NULL;
+		e->env_futex_page = NULL;
+		page_decref(pp);
+		if (e->env_sleeping) {
+			e->env_sleeping = 0;
+			timer_cancel(e);
+		}
+		e->env_status = ENV_RUNNABLE;
+		sched_enqueue(e);
+		woken++;
+	}
+	return woken;
+}
+
+// Wake up to n envs waiting on the word at user address va in curenv.
+// Runs without the big kernel lock.
+// Returns the number of envs woken, or -E_INVAL as for futex_wait().
+int
+futex_wake(const void *va, int n)
+{
+	struct PageInfo *pp;
+	uint32_t off;
+	int r;
+
+	spin_lock(&vm_lock);
+	if ((r = futex_key(va, &pp, &off)) == 0) {
+		spin_lock(&env_lock);
+		r = futex_wake_page(pp, off, n);
+		spin_unlock(&env_lock);
+	}
+	spin_unlock(&vm_lock);
+	return r;
+}
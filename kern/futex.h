@@ -0,0 +1,17 @@
+#ifndef JOS_KERN_FUTEX_H
+#define JOS_KERN_FUTEX_H
+#ifndef JOS_KERNEL
+# error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/types.h>
+#include <inc/env.h>
+
+struct PageInfo;
+
+int futex_wait(const void *va, uint32_t val, unsigned msec);
+int futex_wake(const void *va, int n);
+int futex_wake_page(struct PageInfo *pp, uint32_t off, int n);
+void futex_cancel(struct Env *e);
+
+#endif /* !JOS_KERN_FUTEX_H */
@@ -7,6 +7,7 @@
 #include <kern/monitor.h>
 #include <kern/console.h>
 #include <kern/pmap.h>
+#include <kern/kmalloc.h>
 #include <kern/kclock.h>
 #include <kern/env.h>
 #include <kern/trap.h>
@@ -15,6 +16,7 @@
 #include <kern/cpu.h>
 #include <kern/spinlock.h>
 #include <kern/time.h>
+#include <kern/timer.h>
 #include <kern/pci.h>
 
 static void boot_aps(void);
@@ -23,6 +25,9 @@ static void boot_aps(void);
 void
 i386_init(void)
 {
+	// Set up %gs for thiscpu; cprintf takes a spinlock that uses it.
+	env_init_percpu();
+
 	// Initialize the console.
 	// Can't call cprintf until after we do this!
 	cons_init();
@@ -31,6 +36,7 @@ i386_init(void)
 
 	// Lab 2 memory management initialization functions
 	mem_init();
+	kmalloc_init();
 
 	// Lab 3 user environment initialization functions
 	env_init();
@@ -45,6 +51,7 @@ i386_init(void)
 
 	// Lab 6 hardware initialization functions
 	time_init();
+	timer_init();
 	pci_init();
 
 	// Acquire the big kernel lock before waking up APs
@@ -108,6 +115,8 @@ boot_aps(void)
 		mpentry_kstack = percpu_kstacks[c - cpus] + KSTKSIZE;
 		// Start the CPU at mpentry_start
 		lapic_startap(c->cpu_id, PADDR(code));
+		// Check the AP's TSC against ours before it uses the clock
+		time_sync_bsp();
     // Wait for the CPU to finish some basic setup in mp_main()
 		while(c->cpu_status != CPU_STARTED)
 			;
@@ -120,11 +129,12 @@ mp_main(void)
 {
 	// We are in high EIP now, safe to switch to kern_pgdir
 	lcr3(PADDR(kern_pgdir));
+	env_init_percpu();
 	cprintf("SMP: CPU %d starting\n", cpunum());
 
 	lapic_init();
-	env_init_percpu();
 	trap_init_percpu();
+	time_sync_ap();
 	xchg(&thiscpu->cpu_status, CPU_STARTED); // tell boot_aps() we're up
 
 	// Now that we have finished some basic setup, call sched_yield()
@@ -0,0 +1,262 @@
+// Kernel object allocator.
+//
+// A KmemCache hands out objects of one size carved from single-page
+// slabs, so small kernel structures no longer cost a whole page each.
+// Allocation and free normally touch only the calling CPU's KmemCpu
+// stack; the cache's lock is taken once per KMEM_CPU_BATCH objects
+// moved between that stack and the slabs.  kmalloc() layers
+// power-of-two size classes on top for callers without a cache of
+// their own.
+
+#include <inc/assert.h>
+#include <inc/stdio.h>
+#include <inc/string.h>
+
+#include <kern/kmalloc.h>
+#include <kern/pmap.h>
+
+// The header at the start of every slab page.  Free objects are linked
+// through their first word.
+struct Slab {
+	struct KmemCache *sl_cache;
+	struct Slab *sl_next;		// Link in kc_partial
+	struct Slab **sl_prev;		// Pointer to this slab in kc_partial
+	void *sl_free;			// First free object
+	int sl_inuse;			// Objects handed out
+};
+
+#define SLAB_HDRSIZE	ROUNDUP(sizeof(struct Slab), 8)
+
+struct KmemCache *kmem_caches;
+
+// kmalloc()'s size classes, KMALLOC_MIN up to KMALLOC_MAX bytes.
+static const char *kmalloc_names[] = {
+	"kmalloc-16", "kmalloc-32", "kmalloc-64", "kmalloc-128",
+	"kmalloc-256", "kmalloc-512", "kmalloc-1024",
+};
+static struct KmemCache kmalloc_caches[ARRAY_SIZE(kmalloc_names)];
+
+static void check_kmalloc(void);
+
+// Set up cache c for objects of size bytes.  Called at boot on the
+// boot CPU, before any other CPU can walk kmem_caches.
+void
+kmem_cache_init(struct KmemCache *c, const char *name, size_t size)
+{
+	assert(size > 0 && size <= PGSIZE - SLAB_HDRSIZE);
+	memset(c, 0, sizeof(*c));
+	c->kc_name = name;
+	c->kc_size = ROUNDUP(size, 8);
+	c->kc_perslab = (PGSIZE - SLAB_HDRSIZE) / c->kc_size;
+#ifdef DEBUG_SPINLOCK
+	c->kc_lock.name = (char *) name;
+#endif
+	c->kc_next = kmem_caches;
+	kmem_caches = c;
+}
+
+static void
+slab_link(struct KmemCache *c, struct Slab *s)
+{
+	if ((s->sl_next = c->kc_partial))
+		c->kc_partial->sl_prev = &s->sl_next;
+	s->sl_prev = &c->kc_partial;
+	c->kc_partial = s;
+}
+
+static void
+slab_unlink(struct Slab *s)
+{
+	if (s->sl_next)
+		s->sl_next->sl_prev = s->sl_prev;
+	*s->sl_prev = s->sl_next;
+	s->sl_next = NULL;
+	s->sl_prev = NULL;
+}
+
+// Add a fresh slab to c's partial list.  Called with kc_lock held.
+// Returns false if no page is free.
+static bool
+slab_grow(struct KmemCache *c)
+{
+	struct PageInfo *pp;
+	struct Slab *s;
+	char *obj;
+	int i;
+
+	if (!(pp = page_alloc(0)))
+		return false;
+	s = page2kva(pp);
+	s->sl_cache = c;
+	s->sl_free = NULL;
+	s->sl_inuse = 0;
+	obj = (char *) s + SLAB_HDRSIZE + (c->kc_perslab - 1) * c->kc_size;
+	for (i = 0; i < c->kc_perslab; i++, obj -= c->kc_size) {
+		*(void **) obj = s->sl_free;
+		s->sl_free = obj;
+	}
+	slab_link(c, s);
+	c->kc_nslabs++;
+	return true;
+}
+
+// Give obj back to its slab.  Called with kc_lock held.
+static void
+slab_put(struct KmemCache *c, void *obj)
+{
+	struct Slab *s = ROUNDDOWN(obj, PGSIZE);
+
+	assert(s->sl_cache == c && s->sl_inuse > 0);
+	*(void **) obj = s->sl_free;
+	s->sl_free = obj;
+	c->kc_inuse--;
+	if (s->sl_inuse-- == c->kc_perslab)
+		slab_link(c, s);
+
+	// Keep one empty slab around so that a cache hovering at a slab
+	// boundary doesn't allocate and free a page each time.
+	if (s->sl_inuse == 0 && (c->kc_partial != s || s->sl_next)) {
+		slab_unlink(s);
+		c->kc_nslabs--;
+		page_free(pa2page(PADDR(s)));
+	}
+}
+
+// Move up to KMEM_CPU_BATCH objects from c's slabs to kc.
+static void
+kmem_refill(struct KmemCache *c, struct KmemCpu *kc)
+{
+	struct Slab *s;
+
+	spin_lock(&c->kc_lock);
+	while (kc->kc_count < KMEM_CPU_BATCH) {
+		if (!c->kc_partial && !slab_grow(c))
+			break;
+		s = c->kc_partial;
+		kc->kc_objs[kc->kc_count++] = s->sl_free;
+		s->sl_free = *(void **) s->sl_free;
+		c->kc_inuse++;
+		if (++s->sl_inuse == c->kc_perslab)
+			slab_unlink(s);
+	}
+	spin_unlock(&c->kc_lock);
+}
+
+// Move KMEM_CPU_BATCH objects from kc back to c's slabs.
+static void
+kmem_drain(struct KmemCache *c, struct KmemCpu *kc)
+{
+	int i;
+
+	spin_lock(&c->kc_lock);
+	for (i = 0; i < KMEM_CPU_BATCH && kc->kc_count > 0; i++)
+		slab_put(c, kc->kc_objs[--kc->kc_count]);
+	spin_unlock(&c->kc_lock);
+}
+
+// Allocate an object from c.  Its contents are undefined.
+// Returns NULL if out of memory.
+void *
+kmem_cache_alloc(struct KmemCache *c)
+{
+	struct KmemCpu *kc = &c->kc_cpu[thiscpu - cpus];
+
+	if (!kc->kc_count)
+		kmem_refill(c, kc);
+	if (!kc->kc_count)
+		return NULL;
+	return kc->kc_objs[--kc->kc_count];
+}
+
+// Return obj, which came from kmem_cache_alloc(c), to c.
+void
+kmem_cache_free(struct KmemCache *c, void *obj)
+{
+	struct KmemCpu *kc = &c->kc_cpu[thiscpu - cpus];
+
+	if (kc->kc_count == KMEM_CPU_CACHE)
+		kmem_drain(c, kc);
+	kc->kc_objs[kc->kc_count++] = obj;
+}
+
+void
+kmalloc_init(void)
+{
+	int i;
+
+	static_assert(KMALLOC_MIN << (ARRAY_SIZE(kmalloc_caches) - 1)
+		      == KMALLOC_MAX);
+	for (i = 0; i < ARRAY_SIZE(kmalloc_caches); i++)
+		kmem_cache_init(&kmalloc_caches[i], kmalloc_names[i],
+				KMALLOC_MIN << i);
+	check_kmalloc();
+}
+
+// Allocate size bytes, aligned to 8 bytes.
+// Returns NULL if size is 0 or above KMALLOC_MAX, or if out of memory.
+void *
+kmalloc(size_t size)
+{
+	size_t class = KMALLOC_MIN;
+	int i = 0;
+
+	if (size == 0 || size > KMALLOC_MAX)
+		return NULL;
+	while (class < size) {
+		class <<= 1;
+		i++;
+	}
+	return kmem_cache_alloc(&kmalloc_caches[i]);
+}
+
+// Free obj, which came from kmalloc().  kfree(NULL) does nothing.
+void
+kfree(void *obj)
+{
+	struct Slab *s;
+
+	if (!obj)
+		return;
+	s = ROUNDDOWN(obj, PGSIZE);
+	kmem_cache_free(s->sl_cache, obj);
+}
+
+// Allocate enough objects of every size class to need several slabs,
+// check that none overlap, and free them again.
+static void
+check_kmalloc(void)
+{
+	static char *objs[64];
+	struct KmemCache *c;
+	size_t size;
+	char *p, *q;
+	int i, j;
+
+	for (size = KMALLOC_MIN; size <= KMALLOC_MAX; size <<= 1) {
+		for (i = 0; i < ARRAY_SIZE(objs); i++) {
+			assert((objs[i] = kmalloc(size)));
+			assert((uintptr_t) objs[i] % 8 == 0);
+			assert(PGNUM(objs[i]) == PGNUM(objs[i] + size - 1));
+			memset(objs[i], i, size);
+		}
+		for (i = 0; i < ARRAY_SIZE(objs); i++)
+			for (j = 0; j < size; j++)
+				assert(objs[i][j] == (char) i);
+		for (i = 0; i < ARRAY_SIZE(objs); i++)
+			kfree(objs[i]);
+	}
+	assert(kmalloc(0) == NULL);
+	assert(kmalloc(KMALLOC_MAX + 1) == NULL);
+	assert((p = kmalloc(KMALLOC_MIN + 1)) && (q = kmalloc(2 * KMALLOC_MIN)));
+	assert(p != q);
+	kfree(p);
+	kfree(q);
+	kfree(NULL);
+
+	// Everything freed is either cached on this CPU or back in its
+	// slab.
+	for (c = kmem_caches; c; c = c->kc_next)
+		assert(c->kc_inuse == c->kc_cpu[thiscpu - cpus].kc_count);
+
+	cprintf("check_kmalloc() succeeded!\n");
+}
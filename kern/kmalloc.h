@@ -0,0 +1,55 @@
+#ifndef JOS_KERN_KMALLOC_H
+#define JOS_KERN_KMALLOC_H
+#ifndef JOS_KERNEL
+# error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/types.h>
+#include <inc/memlayout.h>
+#include <kern/cpu.h>
+#include <kern/spinlock.h>
+
+// Each CPU keeps up to KMEM_CPU_CACHE free objects of every cache and
+// moves KMEM_CPU_BATCH at a time to or from the cache's slabs.
+#define KMEM_CPU_CACHE		16
+#define KMEM_CPU_BATCH		8
+
+// kmalloc() serves sizes up to KMALLOC_MAX bytes; anything bigger
+// should come from page_alloc_order().
+#define KMALLOC_MIN		16
+#define KMALLOC_MAX		1024
+
+struct Slab;
+
+// A CPU's stack of free objects, used without any lock since the
+// kernel runs with interrupts off.
+struct KmemCpu {
+	void *kc_objs[KMEM_CPU_CACHE];
+	int kc_count;
+};
+
+// A cache of equal-sized kernel objects.  Each slab is one page: a
+// struct Slab header followed by as many objects as fit.
+struct KmemCache {
+	const char *kc_name;
+	size_t kc_size;			// Object size, a multiple of 8
+	int kc_perslab;			// Objects in each slab
+	struct spinlock kc_lock;	// Protects the slabs and counts below
+	struct Slab *kc_partial;	// Slabs with at least one free object
+	uint32_t kc_nslabs;		// Slabs allocated
+	uint32_t kc_inuse;		// Objects out of the slabs
+	struct KmemCpu kc_cpu[NCPU];
+	struct KmemCache *kc_next;	// All caches, for the monitor
+};
+
+extern struct KmemCache *kmem_caches;
+
+void	kmem_cache_init(struct KmemCache *c, const char *name, size_t size);
+void *	kmem_cache_alloc(struct KmemCache *c);
+void	kmem_cache_free(struct KmemCache *c, void *obj);
+
+void	kmalloc_init(void);
+void *	kmalloc(size_t size);
+void	kfree(void *obj);
+
+#endif /* !JOS_KERN_KMALLOC_H */
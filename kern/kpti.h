@@ -10,4 +10,19 @@ extern char __USER_MAP_BEGIN__[]; // Beginning of user mapped kernel page
 extern char __USER_MAP_END__[]; // End of user mapped kernel page
 extern pde_t *cur_kern_pgdir[NCPU];
 
+// Uncomment this to run the full isolation check on every env_run
+// instead of only when an env's kernel-half PDEs change.
+//#define DEBUG_KPTI
+
+// Isolation check statistics, see env_run()
+struct kpti_stats {
+	uint32_t full_checks;   // Full ULIM..4GB walks performed
+	uint32_t fast_checks;   // Switches that only compared kernel-half PDEs
+};
+
+extern struct kpti_stats kpti_stats;
+
+// Number of PTE probes a full check makes above ULIM.
+#define KPTI_PROBES ((uint32_t) (0 - ULIM) / PGSIZE)
+
 #endif
@@ -10,6 +10,8 @@
 #include <kern/pmap.h>
 #include <kern/cpu.h>
 #include <kern/kpti.h>
+#include <kern/time.h>
+#include <kern/sched.h>
 
 // Local APIC registers, divided by 4 for use as uint32_t[] indices.
 #define ID      (0x0020/4)   // ID
@@ -46,6 +48,9 @@
 physaddr_t lapicaddr;        // Initialized in mpconfig.c
 volatile uint32_t *lapic;
 
+// Timer counts per millisecond, measured by the BSP in lapic_init().
+static uint32_t lapic_per_msec;
+
 static void
 lapicw(int index, int value)
 {
@@ -66,13 +71,22 @@ lapic_init(void)
 	// Enable local APIC; set spurious interrupt vector.
 	lapicw(SVR, ENABLE | (IRQ_OFFSET + IRQ_SPURIOUS));
 
-	// The timer repeatedly counts down at bus frequency
-	// from lapic[TICR] and then issues an interrupt.  
-	// If we cared more about precise timekeeping,
-	// TICR would be calibrated using an external time source.
+	// The timer counts down at bus frequency from lapic[TICR] and
+	// then issues an interrupt.  We run it one-shot: each CPU
+	// programs its own next deadline (see sched_arm_timer()), and
+	// an idle CPU with nothing to wait for stops it entirely.  The
+	// bus frequency is the same for every CPU, so the BSP measures
+	// it once against the PIT.
 	lapicw(TDCR, X1);
-	lapicw(TIMER, PERIODIC | (IRQ_OFFSET + IRQ_TIMER));
-	lapicw(TICR, 10000000); 
+	if (!lapic_per_msec) {
+		lapicw(TIMER, MASKED | (IRQ_OFFSET + IRQ_TIMER));
+		lapicw(TICR, 0xffffffff);
+		pit_delay(10);
+		lapic_per_msec = (0xffffffff - lapic[TCCR]) / 10;
+		lapicw(TICR, 0);
+	}
+	lapicw(TIMER, IRQ_OFFSET + IRQ_TIMER);
+	lapic_timer_oneshot(SCHED_QUANTUM_US);
 
 	// Leave LINT0 of the BSP enabled so that it can get
 	// interrupts from the 8259A chip.
@@ -174,6 +188,30 @@ lapic_startap(uint8_t apicid, uint32_t addr)
 	}
 }
 
+// Interrupt this CPU once, usec microseconds from now.
+// usec == 0 stops the timer.
+void
+lapic_timer_oneshot(uint32_t usec)
+{
+	uint64_t count = (uint64_t) usec * lapic_per_msec / 1000;
+
+	if (!lapic)
+		return;
+	if (usec && !count)
+		count = 1;
+	lapicw(TICR, MIN(count, 0xffffffffULL));
+}
+
+// Send vector to the CPU whose LAPIC ID is apicid.
+void
+lapic_ipi_cpu(int apicid, int vector)
+{
+	lapicw(ICRHI, apicid << 24);
+	lapicw(ICRLO, FIXED | vector);
+	while (lapic[ICRLO] & DELIVS)
+		;
+}
+
 void
 lapic_ipi(int vector)
 {
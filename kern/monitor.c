@@ -11,6 +11,11 @@
 #include <kern/monitor.h>
 #include <kern/kdebug.h>
 #include <kern/trap.h>
+#include <kern/kpti.h>
+#include <kern/pmap.h>
+#include <kern/kmalloc.h>
+#include <kern/cpu.h>
+#include <kern/spinlock.h>
 
 #define CMDBUF_SIZE	80	// enough for one VGA text line
 
@@ -25,6 +30,10 @@ struct Command {
 static struct Command commands[] = {
 	{ "help", "Display this list of commands", mon_help },
 	{ "kerninfo", "Display information about the kernel", mon_kerninfo },
+	{ "kpti", "Display KPTI isolation check statistics", mon_kpti },
+	{ "locks", "Display spinlock contention statistics [reset]", mon_locks },
+	{ "pages", "Display free physical memory by block size", mon_pages },
+	{ "kmem", "Display kernel object cache usage", mon_kmem },
 };
 
 /***** Implementations of basic kernel monitor commands *****/
@@ -55,6 +64,109 @@ mon_kerninfo(int argc, char **argv, struct Trapframe *tf)
 	return 0;
 }
 
+int
+mon_kpti(int argc, char **argv, struct Trapframe *tf)
+{
+	cprintf("Isolation checks: %u full, %u fast\n",
+		kpti_stats.full_checks, kpti_stats.fast_checks);
+	cprintf("PTE probes saved on the switch path: %llu\n",
+		(uint64_t) kpti_stats.fast_checks * KPTI_PROBES);
+	return 0;
+}
+
+int
+mon_locks(int argc, char **argv, struct Trapframe *tf)
+{
+#ifdef DEBUG_SPINLOCK
+	struct Eipdebuginfo info;
+	struct spinlock *lk;
+	uint32_t i, n;
+
+	if (argc > 1 && strcmp(argv[1], "reset") == 0) {
+		spin_stats_reset();
+		return 0;
+	}
+
+	n = MIN(nspinlocks, NSPINLOCK);
+	cprintf("%-14s %10s %10s %12s %12s %12s\n", "lock", "acquired",
+		"contended", "spin/acq", "hold/acq", "max hold");
+	for (i = 0; i < n; i++) {
+		lk = spinlocks[i];
+		if (!lk->acquisitions)
+			continue;
+		cprintf("%-14s %10u %10u %12llu %12llu %12llu\n", lk->name,
+			lk->acquisitions, lk->contended,
+			lk->spin_cycles / lk->acquisitions,
+			lk->hold_cycles / lk->acquisitions, lk->max_hold);
+		if (lk->max_pcs[0] && debuginfo_eip(lk->max_pcs[0], &info) >= 0)
+			cprintf("  longest hold taken at %s:%d: %.*s+%x\n",
+				info.eip_file, info.eip_line,
+				info.eip_fn_namelen, info.eip_fn_name,
+				lk->max_pcs[0] - info.eip_fn_addr);
+	}
+#else
+	cprintf("Build with DEBUG_SPINLOCK to collect lock statistics\n");
+#endif
+	return 0;
+}
+
+int
+mon_pages(int argc, char **argv, struct Trapframe *tf)
+{
+	size_t nblocks[PAGE_MAX_ORDER + 1], nfree, cached, zeroed, smaller = 0;
+	struct PageCache *pc;
+	int i, o;
+
+	// "unusable" is the share of free memory in blocks too small
+	// for an allocation of that order.  Pages in the per-CPU caches
+	// and the zeroed pool count as single pages, since they can't
+	// merge until drained.
+	nfree = page_free_blocks(nblocks);
+	cached = page_cached();
+	zeroed = page_zero_depth();
+	nblocks[0] += cached + zeroed;
+	nfree += cached + zeroed;
+	cprintf("%5s %8s %8s %9s\n", "order", "size", "blocks", "unusable");
+	for (o = 0; o <= PAGE_MAX_ORDER; o++) {
+		cprintf("%5d %7uK %8u %8u%%\n", o, (PGSIZE << o) / 1024,
+			nblocks[o], nfree ? smaller * 100 / nfree : 0);
+		smaller += nblocks[o] << o;
+	}
+	cprintf("%u pages free (%u of them in per-CPU caches, %u zeroed)\n",
+		nfree, cached, zeroed);
+
+	for (i = 0; i < ncpu; i++) {
+		pc = &page_caches[i];
+		cprintf("CPU %d cache: %u pages; %u of %u allocs hit, "
+			"%u refills, %u drains\n", i, pc->pc_count, pc->pc_hits,
+			pc->pc_allocs, pc->pc_refills, pc->pc_drains);
+		cprintf("CPU %d zeroing: %u from the pool, %u on demand, "
+			"%u while idle\n", i, pc->pc_zero_hits,
+			pc->pc_zero_misses, pc->pc_zero_idle);
+	}
+	return 0;
+}
+
+int
+mon_kmem(int argc, char **argv, struct Trapframe *tf)
+{
+	struct KmemCache *c;
+	uint32_t cached;
+	int i;
+
+	// "in use" counts objects out of the slabs, including those
+	// sitting in per-CPU caches; "cached" is that per-CPU share.
+	cprintf("%-14s %6s %6s %8s %8s\n", "cache", "size", "slabs",
+		"in use", "cached");
+	for (c = kmem_caches; c; c = c->kc_next) {
+		for (cached = 0, i = 0; i < ncpu; i++)
+			cached += c->kc_cpu[i].kc_count;
+		cprintf("%-14s %6u %6u %8u %8u\n", c->kc_name, c->kc_size,
+			c->kc_nslabs, c->kc_inuse, cached);
+	}
+	return 0;
+}
+
 int
 mon_backtrace(int argc, char **argv, struct Trapframe *tf)
 {
@@ -11,6 +11,8 @@
 #include <kern/cpu.h>
 #include <inc/queue.h>
 #include <kern/kpti.h>
+#include <kern/spinlock.h>
+#include <kern/time.h>
 
 // These variables are set by i386_detect_memory()
 size_t npages;            // Amount of physical memory (in pages)
@@ -19,7 +21,39 @@ static size_t npages_basemem;    // Amount of base memory (in pages)
 // These variables are set in mem_init()
 pde_t *kern_pgdir;        // Kernel's initial page directory
 struct PageInfo *pages;        // Physical page state array
-static struct PageInfo *page_free_list;    // Free list of physical pages
+
+// The buddy allocator's free lists: page_free_area[order] holds the free
+// blocks of 1 << order pages.  Each block is naturally aligned, and two
+// free buddies (blocks that differ only in bit 'order' of their page
+// number) always merge into one block of the next order.
+static struct PageInfo *page_free_area[PAGE_MAX_ORDER + 1];
+static size_t page_nfree;        // Free pages in page_free_area
+
+// Each CPU keeps a few free single pages in front of the free lists, so
+// that most page_alloc and page_free calls take no lock and touch no
+// shared cache lines.  A CPU uses only its own cache, with interrupts
+// off, and moves pages to and from page_free_area in batches.
+struct PageCache page_caches[NCPU];
+
+// Free pages that idle CPUs have already zeroed, for ALLOC_ZERO
+// requests (see page_zero_idle).  Linked through pp_link.
+static struct PageInfo *page_zero_list;
+static size_t page_zero_count;
+
+// Protects page_free_area, page_nfree and the zeroed pool.
+static struct spinlock page_lock = {
+#ifdef DEBUG_SPINLOCK
+    .name = "page_lock"
+#endif
+};
+
+// Serializes changes to user page tables and pp_ref counts made by
+// syscalls that run without the big kernel lock.
+struct spinlock vm_lock = {
+#ifdef DEBUG_SPINLOCK
+    .name = "vm_lock"
+#endif
+};
 
 
 // --------------------------------------------------------------
@@ -64,12 +98,19 @@ i386_detect_memory(void) {
 
 static void mem_init_mp(void);
 
+static void page_init_high(void);
+
+static void page_cache_flush(void);
+static void page_zero_drain(void);
+
 static void boot_map_region_large(pde_t *pgdir, uintptr_t va, size_t size, physaddr_t pa, int perm);
 
 static void check_page_free_list(bool only_low_memory);
 
 static void check_page_alloc(void);
 
+static void check_page_buddy(void);
+
 static void check_kern_pgdir(void);
 
 static physaddr_t check_va2pa(pde_t *pgdir, uintptr_t va);
@@ -94,7 +135,7 @@ static void check_page_installed_pgdir(void);
 //
 // If we're out of memory, boot_alloc should panic.
 // This function may ONLY be used during initialization,
-// before the page_free_list list has been set up.
+// before the page allocator has been set up.
 // Note that when this function is called, we are still using entry_pgdir,
 // which only maps the first 4MB of physical memory.
 static void *
@@ -163,6 +204,7 @@ mem_init(void) {
     // to initialize all fields of each struct PageInfo to 0.
     // Your code goes here:
     pages = (struct PageInfo *) boot_alloc(npages * sizeof(struct PageInfo));
+    memset(pages, 0, npages * sizeof(struct PageInfo));
 
 
     //////////////////////////////////////////////////////////////////////
@@ -180,6 +222,7 @@ mem_init(void) {
 
     check_page_free_list(1);
     check_page_alloc();
+    check_page_buddy();
     check_page();
 
     //////////////////////////////////////////////////////////////////////
@@ -200,7 +243,15 @@ mem_init(void) {
     // Permissions:
     //    - the new image at UENVS  -- kernel R, user R
     //    - envs itself -- kernel RW, user NONE
-    boot_map_region(kern_pgdir, UENVS, PTSIZE, PADDR(envs), PTE_U);
+    // The last page of the region is left for the time page.
+    static_assert(NENV * sizeof(struct Env) <= UTIME - UENVS);
+    boot_map_region(kern_pgdir, UENVS, UTIME - UENVS, PADDR(envs), PTE_U);
+
+    //////////////////////////////////////////////////////////////////////
+    // Map the clock parameters read-only by the user at UTIME, so that
+    // user code can read the time without a system call.
+    // Permissions: kernel R, user R
+    boot_map_region(kern_pgdir, UTIME, PGSIZE, PADDR(timepage), PTE_U);
 
     //////////////////////////////////////////////////////////////////////
     // Use the physical memory that 'bootstack' refers to as the kernel
@@ -238,6 +289,8 @@ mem_init(void) {
     // kern_pgdir wrong.
     lcr3(PADDR(kern_pgdir));
 
+    // Now all of physical memory is mapped, hand out the rest of it.
+    page_init_high();
     check_page_free_list(0);
 
     // entry.S set the really important flags in cr0 (including enabling
@@ -291,7 +344,7 @@ mem_init_mp(void) {
 // Initialize page structure and memory free list.
 // After this is done, NEVER use boot_alloc again.  ONLY use the page
 // allocator functions below to allocate and deallocate physical
-// memory via the page_free_list.
+// memory.
 //
 void
 page_init(void) {
@@ -322,39 +375,311 @@ page_init(void) {
         EXTPHYSMEM_PG = EXTPHYSMEM / PGSIZE,
         END_PG = PGNUM(PADDR(boot_alloc(0)));
 
-    page_free_list = NULL;
-
+    // Pages in use get a reference; the free ones keep pp_ref 0.
     //  1)
-    for (; i < 1; ++i) {
+    for (; i < 1; ++i)
         pages[i].pp_ref = 1;
-        pages[i].pp_link = NULL;
-    }
     //  2)
-    for (; i < npages_basemem; ++i) {
-        if (i == MPENTRY_PG) {
-            pages[i].pp_ref = 1;
-            pages[i].pp_link = NULL;
-        } else {
-            pages[i].pp_ref = 0;
-            pages[i].pp_link = page_free_list;
-            page_free_list = pages + i;
-        }
-    }
+    for (; i < npages_basemem; ++i)
+        pages[i].pp_ref = (i == MPENTRY_PG);
     //  3)
-    for (; i < EXTPHYSMEM_PG; ++i) {
+    for (; i < EXTPHYSMEM_PG; ++i)
         pages[i].pp_ref = 1;
-        pages[i].pp_link = NULL;
-    }
     //  4)
-    for (; i < END_PG; ++i) {
+    for (; i < END_PG; ++i)
         pages[i].pp_ref = 1;
-        pages[i].pp_link = NULL;
-    }
-    for (; i < npages; ++i) {
+    for (; i < npages; ++i)
         pages[i].pp_ref = 0;
-        pages[i].pp_link = page_free_list;
-        page_free_list = pages + i;
+
+    // entry_pgdir maps only the first 4MB, so free only the pages
+    // there for now (see page_init_high).  Freeing from the top down
+    // leaves the lowest blocks at the heads of the free lists.
+    for (i = MIN(npages, PGNUM(PTSIZE)); i-- > 0; )
+        if (!pages[i].pp_ref)
+            page_free_order(&pages[i], 0);
+}
+
+// Free the pages above 4MB that page_init left out, once kern_pgdir
+// maps all of physical memory.
+static void
+page_init_high(void) {
+    size_t i;
+
+    for (i = npages; i-- > PGNUM(PTSIZE); )
+        if (!pages[i].pp_ref)
+            page_free_order(&pages[i], 0);
+}
+
+// Put the block of 1 << order pages at pp on its free list.
+// Called with page_lock held.
+static void
+free_area_push(struct PageInfo *pp, int order) {
+    struct PageInfo **head = &page_free_area[order];
+
+    pp->pp_order = order;
+    pp->pp_free = 1;
+    if ((pp->pp_link = *head))
+        (*head)->pp_prev = &pp->pp_link;
+    pp->pp_prev = head;
+    *head = pp;
+    page_nfree += 1 << order;
+}
+
+// Take the free block at pp off its free list.
+// Called with page_lock held.
+static void
+free_area_remove(struct PageInfo *pp) {
+    if ((*pp->pp_prev = pp->pp_link))
+        pp->pp_link->pp_prev = pp->pp_prev;
+    pp->pp_link = NULL;
+    pp->pp_prev = NULL;
+    pp->pp_free = 0;
+    page_nfree -= 1 << pp->pp_order;
+}
+
+// Take a block of 1 << order pages off the free lists, splitting a
+// larger one if need be.  Called with page_lock held.
+static struct PageInfo *
+buddy_alloc(int order) {
+    struct PageInfo *pp;
+    int o;
+
+    for (o = order; o <= PAGE_MAX_ORDER && !page_free_area[o]; o++)
+        ;
+    if (o > PAGE_MAX_ORDER)
+        return NULL;
+    pp = page_free_area[o];
+    free_area_remove(pp);
+    // Give back the upper halves until the block is the right size.
+    while (o > order) {
+        o--;
+        free_area_push(pp + (1 << o), o);
+    }
+    pp->pp_order = order;
+    return pp;
+}
+
+// Put a block of 1 << order pages back on the free lists, merging it
+// with its buddy for as long as the buddy is free too.  Called with
+// page_lock held.
+static void
+buddy_free(struct PageInfo *pp, int order) {
+    struct PageInfo *buddy;
+    size_t pn;
+
+    for (; order < PAGE_MAX_ORDER; order++) {
+        pn = pp - pages;
+        buddy = &pages[pn ^ (1 << order)];
+        if (buddy >= pages + npages || !buddy->pp_free || buddy->pp_order != order)
+            break;
+        free_area_remove(buddy);
+        pp = &pages[pn & ~(1 << order)];
+    }
+    free_area_push(pp, order);
+}
+
+//
+// Allocates a block of 1 << order physically contiguous pages, aligned
+// to its size, splitting a larger free block if need be.  Returns the
+// PageInfo of the first page, or NULL if no block that large is free.
+// alloc_flags and reference counts are as for page_alloc; free the
+// block with page_free_order and the same order.
+//
+struct PageInfo *
+page_alloc_order(int order, int alloc_flags) {
+    struct PageInfo *pp;
+
+    if (order < 0 || order > PAGE_MAX_ORDER)
+        return NULL;
+
+    spin_lock(&page_lock);
+    pp = buddy_alloc(order);
+    spin_unlock(&page_lock);
+
+    // Pages in this CPU's cache can't merge with their buddies.  Give
+    // them back and try again before failing.
+    if (!pp && page_caches[thiscpu - cpus].pc_count) {
+        page_cache_flush();
+        spin_lock(&page_lock);
+        pp = buddy_alloc(order);
+        spin_unlock(&page_lock);
+    }
+    // Likewise the zeroed pool; idle CPUs will refill it later.
+    if (!pp && page_zero_count) {
+        spin_lock(&page_lock);
+        page_zero_drain();
+        pp = buddy_alloc(order);
+        spin_unlock(&page_lock);
+    }
+
+    if (pp && (alloc_flags & ALLOC_ZERO))
+        memset(page2kva(pp), 0, PGSIZE << order);
+    return pp;
+}
+
+//
+// Return a block from page_alloc_order to the free lists, merging it
+// with its buddy for as long as the buddy is free too.
+//
+void
+page_free_order(struct PageInfo *pp, int order) {
+    if (pp->pp_ref || pp->pp_link || pp->pp_free)
+        panic("page_free: free a nonfree physical page");
+    if ((pp - pages) & ((1 << order) - 1))
+        panic("page_free_order: page %x is not an order %d block", pp - pages, order);
+
+    spin_lock(&page_lock);
+    buddy_free(pp, order);
+    spin_unlock(&page_lock);
+}
+
+// Move up to PAGE_CACHE_BATCH pages from the free lists into pc.
+static void
+page_cache_refill(struct PageCache *pc) {
+    struct PageInfo *pp;
+    int i;
+
+    spin_lock(&page_lock);
+    for (i = 0; i < PAGE_CACHE_BATCH && (pp = buddy_alloc(0)); i++) {
+        pp->pp_link = pc->pc_list;
+        pc->pc_list = pp;
+    }
+    spin_unlock(&page_lock);
+    pc->pc_count += i;
+    if (i)
+        pc->pc_refills++;
+}
+
+// Move n of pc's pages back to the free lists.
+static void
+page_cache_drain(struct PageCache *pc, uint32_t n) {
+    struct PageInfo *pp;
+
+    spin_lock(&page_lock);
+    for (; n && (pp = pc->pc_list); n--) {
+        pc->pc_list = pp->pp_link;
+        pc->pc_count--;
+        pp->pp_link = NULL;
+        buddy_free(pp, 0);
+    }
+    spin_unlock(&page_lock);
+    pc->pc_drains++;
+}
+
+// Empty this CPU's page cache into the free lists.
+static void
+page_cache_flush(void) {
+    struct PageCache *pc = &page_caches[thiscpu - cpus];
+
+    if (pc->pc_count)
+        page_cache_drain(pc, pc->pc_count);
+}
+
+// Take a page from the zeroed pool, or return NULL if it is empty.
+static struct PageInfo *
+page_zero_take(void) {
+    struct PageInfo *pp;
+
+    // Peek without the lock; an empty pool is the common case early on.
+    if (!page_zero_count)
+        return NULL;
+    spin_lock(&page_lock);
+    if ((pp = page_zero_list)) {
+        page_zero_list = pp->pp_link;
+        page_zero_count--;
+        pp->pp_link = NULL;
+        pp->pp_order = 0;
+    }
+    spin_unlock(&page_lock);
+    return pp;
+}
+
+//
+// Zero up to PAGE_ZERO_BATCH free pages into the zeroed pool, unless it
+// is full.  sched_halt calls this before the CPU halts, without the
+// big kernel lock.  Returns the number of pages zeroed.
+//
+int
+page_zero_idle(void) {
+    struct PageInfo *list = NULL, *pp;
+    int n = 0;
+
+    spin_lock(&page_lock);
+    while (n < PAGE_ZERO_BATCH && page_zero_count + n < PAGE_ZERO_POOL
+           && (pp = buddy_alloc(0))) {
+        pp->pp_link = list;
+        list = pp;
+        n++;
     }
+    spin_unlock(&page_lock);
+    if (!n)
+        return 0;
+
+    for (pp = list; pp; pp = pp->pp_link)
+        memset(page2kva(pp), 0, PGSIZE);
+
+    spin_lock(&page_lock);
+    while ((pp = list)) {
+        list = pp->pp_link;
+        pp->pp_link = page_zero_list;
+        page_zero_list = pp;
+    }
+    page_zero_count += n;
+    spin_unlock(&page_lock);
+    page_caches[thiscpu - cpus].pc_zero_idle += n;
+    return n;
+}
+
+// Return every page in the zeroed pool to the free lists, so that they
+// can merge again.  Called with page_lock held.
+static void
+page_zero_drain(void) {
+    struct PageInfo *pp;
+
+    while ((pp = page_zero_list)) {
+        page_zero_list = pp->pp_link;
+        pp->pp_link = NULL;
+        buddy_free(pp, 0);
+    }
+    page_zero_count = 0;
+}
+
+// Number of free pages parked in the per-CPU caches.  A snapshot: the
+// caches change without any lock.
+size_t
+page_cached(void) {
+    size_t n = 0;
+    int i;
+
+    for (i = 0; i < ncpu; i++)
+        n += page_caches[i].pc_count;
+    return n;
+}
+
+// Number of pages in the zeroed pool.
+size_t
+page_zero_depth(void) {
+    return page_zero_count;
+}
+
+//
+// Store the number of free blocks of each order in nblocks, and return
+// the number of free pages on the free lists.  Pages in the per-CPU
+// caches are free too but not counted here; see page_cached.
+//
+size_t
+page_free_blocks(size_t nblocks[PAGE_MAX_ORDER + 1]) {
+    struct PageInfo *pp;
+    size_t nfree;
+    int o;
+
+    spin_lock(&page_lock);
+    for (o = 0; o <= PAGE_MAX_ORDER; o++)
+        for (nblocks[o] = 0, pp = page_free_area[o]; pp; pp = pp->pp_link)
+            nblocks[o]++;
+    nfree = page_nfree;
+    spin_unlock(&page_lock);
+    return nfree;
 }
 
 //
@@ -371,16 +696,38 @@ page_init(void) {
 // Hint: use page2kva and memset
 struct PageInfo *
 page_alloc(int alloc_flags) {
-    if (!page_free_list)
-        return NULL;
-    if (alloc_flags & ALLOC_ZERO)
-        memset(page2kva(page_free_list), 0, PGSIZE);
-    struct PageInfo *ret = page_free_list;
+    struct PageCache *pc = &page_caches[thiscpu - cpus];
+    struct PageInfo *pp;
 
-    page_free_list = page_free_list->pp_link;
-    ret->pp_link = NULL;
-    ret->pp_ref = 0;
-    return ret;
+    if (alloc_flags & ALLOC_ZERO) {
+        if ((pp = page_zero_take())) {
+            pc->pc_zero_hits++;
+            return pp;
+        }
+        pc->pc_zero_misses++;
+    }
+
+    if (PAGE_CACHE_SIZE == 0) {
+        pp = page_alloc_order(0, alloc_flags);
+        // The zeroed pool is free memory too.
+        return pp ? pp : page_zero_take();
+    }
+
+    pc->pc_allocs++;
+    if (pc->pc_list)
+        pc->pc_hits++;
+    else
+        page_cache_refill(pc);
+    if (!(pp = pc->pc_list))
+        return page_zero_take();
+    pc->pc_list = pp->pp_link;
+    pc->pc_count--;
+
+    pp->pp_link = NULL;
+    pp->pp_order = 0;
+    if (alloc_flags & ALLOC_ZERO)
+        memset(page2kva(pp), 0, PGSIZE);
+    return pp;
 }
 
 //
@@ -392,10 +739,20 @@ page_free(struct PageInfo *pp) {
     // Fill this function in
     // Hint: You may want to panic if pp->pp_ref is nonzero or
     // pp->pp_link is not NULL.
-    if (pp->pp_ref || pp->pp_link)
+    struct PageCache *pc = &page_caches[thiscpu - cpus];
+
+    if (PAGE_CACHE_SIZE == 0) {
+        page_free_order(pp, 0);
+        return;
+    }
+
+    if (pp->pp_ref || pp->pp_link || pp->pp_free)
         panic("page_free: free a nonfree physical page");
-    pp->pp_link = page_free_list;
-    page_free_list = pp;
+    if (pc->pc_count >= PAGE_CACHE_SIZE)
+        page_cache_drain(pc, PAGE_CACHE_BATCH);
+    pp->pp_link = pc->pc_list;
+    pc->pc_list = pp;
+    pc->pc_count++;
 }
 
 //
@@ -577,6 +934,64 @@ page_remove(pde_t *pgdir, void *va) {
     tlb_invalidate(pgdir, va);
 }
 
+//
+// Resolve a write fault at 'va' in env e's address space if the page
+// there is copy-on-write (PTE_COW, see sys_fork).  If e holds the only
+// references to the page -- one from env_pgdir and one from
+// env_kern_pgdir -- make it writable in place; otherwise give e a
+// private writable copy in both page directories.
+//
+// RETURNS:
+//   0 on success
+//   -E_FAULT, if va is not a copy-on-write page of e
+//   -E_NO_MEM, if there is no memory for the copy
+//
+int
+page_cow_fault(struct Env *e, void *va) {
+    struct PageInfo *pp, *np;
+    pte_t *pte, *kpte;
+    int perm, nref, r = 0;
+
+    va = ROUNDDOWN(va, PGSIZE);
+    if ((uintptr_t) va >= UTOP)
+        return -E_FAULT;
+
+    spin_lock(&vm_lock);
+    if (!(pp = page_lookup(e->env_pgdir, va, &pte))
+        || (*pte & (PTE_U | PTE_COW)) != (PTE_U | PTE_COW)) {
+        r = -E_FAULT;
+        goto out;
+    }
+    perm = (*pte & PTE_SYSCALL & ~PTE_COW) | PTE_W;
+    kpte = pgdir_walk(e->env_kern_pgdir, va, 0);
+    nref = 2;
+    if (!kpte || !(*kpte & PTE_P) || PTE_ADDR(*kpte) != page2pa(pp)) {
+        kpte = NULL;
+        nref = 1;
+    }
+
+    if (pp->pp_ref == nref) {
+        *pte = page2pa(pp) | perm;
+        if (kpte)
+            *kpte = *pte;
+        tlb_invalidate(e->env_pgdir, va);
+        goto out;
+    }
+
+    if (!(np = page_alloc(0))) {
+        r = -E_NO_MEM;
+        goto out;
+    }
+    memcpy(page2kva(np), page2kva(pp), PGSIZE);
+    // Neither insert can fail: both page tables already exist.
+    page_insert(e->env_pgdir, np, va, perm);
+    if (kpte)
+        page_insert(e->env_kern_pgdir, np, va, perm);
+out:
+    spin_unlock(&vm_lock);
+    return r;
+}
+
 //
 // Invalidate a TLB entry, but only if the page tables being
 // edited are the ones currently in use by the processor.
@@ -702,67 +1117,94 @@ user_mem_assert(struct Env *env, const void *va, size_t len, int perm) {
 // --------------------------------------------------------------
 
 //
-// Check that the pages on the page_free_list are reasonable.
+// Check that the pages on the free lists are reasonable.
 //
 static void
 check_page_free_list(bool only_low_memory) {
-    struct PageInfo *pp;
+    struct PageInfo *blk, *pp;
     unsigned pdx_limit = only_low_memory ? 1 : NPDENTRIES;
     int nfree_basemem = 0, nfree_extmem = 0;
     char *first_free_page;
+    int o;
 
-    if (!page_free_list)
-        panic("'page_free_list' is a null pointer!");
-
-    if (only_low_memory) {
-        // Move pages with lower addresses first in the free
-        // list, since entry_pgdir does not map all pages.
-        struct PageInfo *pp1, *pp2;
-        struct PageInfo **tp[2] = {&pp1, &pp2};
-        for (pp = page_free_list; pp; pp = pp->pp_link) {
-            int pagetype = PDX(page2pa(pp)) >= pdx_limit;
-            *tp[pagetype] = pp;
-            tp[pagetype] = &pp->pp_link;
-        }
-        *tp[1] = 0;
-        *tp[0] = pp2;
-        page_free_list = pp1;
-    }
+    page_cache_flush();
+    if (!page_nfree)
+        panic("no free pages!");
 
     // if there's a page that shouldn't be on the free list,
     // try to make sure it eventually causes trouble.
-    for (pp = page_free_list; pp; pp = pp->pp_link)
-        if (PDX(page2pa(pp)) < pdx_limit)
-            memset(page2kva(pp), 0x97, 128);
+    for (o = 0; o <= PAGE_MAX_ORDER; o++)
+        for (blk = page_free_area[o]; blk; blk = blk->pp_link)
+            for (pp = blk; pp < blk + (1 << o); pp++)
+                if (PDX(page2pa(pp)) < pdx_limit)
+                    memset(page2kva(pp), 0x97, 128);
 
     first_free_page = (char *) boot_alloc(0);
-    for (pp = page_free_list; pp; pp = pp->pp_link) {
-        // check that we didn't corrupt the free list itself
-        assert(pp >= pages);
-        assert(pp < pages + npages);
-        assert(((char *) pp - (char *) pages) % sizeof(*pp) == 0);
-
-        // check a few pages that shouldn't be on the free list
-        assert(page2pa(pp) != 0);
-        assert(page2pa(pp) != IOPHYSMEM);
-        assert(page2pa(pp) != EXTPHYSMEM - PGSIZE);
-        assert(page2pa(pp) != EXTPHYSMEM);
-        assert(page2pa(pp) < EXTPHYSMEM || (char *) page2kva(pp) >= first_free_page);
-        // (new test for lab 4)
-        assert(page2pa(pp) != MPENTRY_PADDR);
-
-        if (page2pa(pp) < EXTPHYSMEM)
-            ++nfree_basemem;
-        else
-            ++nfree_extmem;
-    }
+    for (o = 0; o <= PAGE_MAX_ORDER; o++)
+        for (blk = page_free_area[o]; blk; blk = blk->pp_link) {
+            // check that we didn't corrupt the free list itself
+            assert(blk >= pages);
+            assert(blk + (1 << o) <= pages + npages);
+            assert(((char *) blk - (char *) pages) % sizeof(*blk) == 0);
+            assert(blk->pp_free && blk->pp_order == o);
+            assert(*blk->pp_prev == blk);
+            assert((blk - pages) % (1 << o) == 0);
+
+            for (pp = blk; pp < blk + (1 << o); pp++) {
+                assert(!pp->pp_ref);
+
+                // check a few pages that shouldn't be on the free list
+                assert(page2pa(pp) != 0);
+                assert(page2pa(pp) != IOPHYSMEM);
+                assert(page2pa(pp) != EXTPHYSMEM - PGSIZE);
+                assert(page2pa(pp) != EXTPHYSMEM);
+                assert(page2pa(pp) < EXTPHYSMEM || (char *) page2kva(pp) >= first_free_page);
+                // (new test for lab 4)
+                assert(page2pa(pp) != MPENTRY_PADDR);
+
+                if (page2pa(pp) < EXTPHYSMEM)
+                    ++nfree_basemem;
+                else
+                    ++nfree_extmem;
+            }
+        }
 
     assert(nfree_basemem > 0);
     assert(nfree_extmem > 0);
+    assert(nfree_basemem + nfree_extmem == page_nfree);
 
     cprintf("check_page_free_list() succeeded!\n");
 }
 
+//
+// Allocate every free block, largest first, so that the checks below
+// can run out of memory; page_unsteal gives the blocks back.
+//
+static struct PageInfo *
+page_steal(void) {
+    struct PageInfo *list = NULL, *pp;
+    int o;
+
+    page_cache_flush();
+    for (o = PAGE_MAX_ORDER; o >= 0; o--)
+        while ((pp = page_alloc_order(o, 0))) {
+            pp->pp_link = list;
+            list = pp;
+        }
+    return list;
+}
+
+static void
+page_unsteal(struct PageInfo *list) {
+    struct PageInfo *pp;
+
+    while ((pp = list)) {
+        list = pp->pp_link;
+        pp->pp_link = NULL;
+        page_free_order(pp, pp->pp_order);
+    }
+}
+
 //
 // Check the physical page allocator (page_alloc(), page_free(),
 // and page_init()).
@@ -779,8 +1221,8 @@ check_page_alloc(void) {
         panic("'pages' is a null pointer!");
 
     // check number of free pages
-    for (pp = page_free_list, nfree = 0; pp; pp = pp->pp_link)
-        ++nfree;
+    page_cache_flush();
+    nfree = page_nfree;
 
     // should be able to allocate three pages
     pp0 = pp1 = pp2 = 0;
@@ -796,8 +1238,7 @@ check_page_alloc(void) {
     assert(page2pa(pp2) < npages * PGSIZE);
 
     // temporarily steal the rest of the free pages
-    fl = page_free_list;
-    page_free_list = 0;
+    fl = page_steal();
 
     // should be no free memory
     assert(!page_alloc(0));
@@ -825,7 +1266,7 @@ check_page_alloc(void) {
         assert(c[i] == 0);
 
     // give free list back
-    page_free_list = fl;
+    page_unsteal(fl);
 
     // free the pages we took
     page_free(pp0);
@@ -833,13 +1274,75 @@ check_page_alloc(void) {
     page_free(pp2);
 
     // number of free pages should be the same
-    for (pp = page_free_list; pp; pp = pp->pp_link)
-        --nfree;
-    assert(nfree == 0);
+    page_cache_flush();
+    assert(nfree == page_nfree);
 
     cprintf("check_page_alloc() succeeded!\n");
 }
 
+//
+// Check the buddy allocator: alignment, splitting, and that freed
+// blocks coalesce back into the same free lists.
+//
+static void
+check_page_buddy(void) {
+    size_t before[PAGE_MAX_ORDER + 1], after[PAGE_MAX_ORDER + 1];
+    struct PageInfo *fl, *blk, *pp;
+    size_t nfree;
+    char *c;
+    int i, o;
+
+    page_cache_flush();
+    nfree = page_free_blocks(before);
+
+    // blocks are aligned to their size
+    for (o = 0; o <= 4; o++) {
+        assert((blk = page_alloc_order(o, 0)));
+        assert((blk - pages) % (1 << o) == 0);
+        assert(page_nfree == nfree - (1 << o));
+        page_free_order(blk, o);
+    }
+    assert(!page_alloc_order(-1, 0));
+    assert(!page_alloc_order(PAGE_MAX_ORDER + 1, 0));
+
+    // with nothing else free, single pages come out of one block...
+    assert((blk = page_alloc_order(3, 0)));
+    fl = page_steal();
+    assert(!page_alloc_order(0, 0));
+    page_free_order(blk, 3);
+    for (i = 0; i < 8; i++) {
+        assert((pp = page_alloc_order(0, 0)));
+        assert(pp >= blk && pp < blk + 8);
+    }
+    assert(!page_alloc_order(0, 0));
+
+    // ...and merge back into it only once all eight are free
+    for (i = 0; i < 8; i += 2)
+        page_free_order(blk + i, 0);
+    assert(!page_alloc_order(1, 0));
+    for (i = 1; i < 8; i += 2)
+        page_free_order(blk + i, 0);
+    assert(page_free_blocks(after) == 8);
+    assert(after[3] == 1);
+    assert(!page_alloc_order(4, 0));
+
+    // test flags
+    memset(page2kva(blk), 1, 8 * PGSIZE);
+    assert(page_alloc_order(3, ALLOC_ZERO) == blk);
+    c = page2kva(blk);
+    for (i = 0; i < 8 * PGSIZE; i++)
+        assert(c[i] == 0);
+    page_free_order(blk, 3);
+
+    // everything coalesces back to where it was
+    page_unsteal(fl);
+    assert(page_free_blocks(after) == nfree);
+    for (o = 0; o <= PAGE_MAX_ORDER; o++)
+        assert(after[o] == before[o]);
+
+    cprintf("check_page_buddy() succeeded!\n");
+}
+
 //
 // Checks that the kernel part of virtual address space
 // has been set up roughly correctly (by mem_init()).
@@ -865,6 +1368,9 @@ check_kern_pgdir(void) {
     for (i = 0; i < n; i += PGSIZE)
         assert(check_va2pa(pgdir, UENVS + i) == PADDR(envs) + i);
 
+    // check time page
+    assert(check_va2pa(pgdir, UTIME) == PADDR(timepage));
+
     // check phys mem
     if (check_va2pa_large(pgdir, KERNBASE) == 0) {
         for (i = 0; i < npages * PGSIZE; i += PTSIZE)
@@ -957,8 +1463,7 @@ check_page(void) {
     assert(pp2 && pp2 != pp1 && pp2 != pp0);
 
     // temporarily steal the rest of the free pages
-    fl = page_free_list;
-    page_free_list = 0;
+    fl = page_steal();
 
     // should be no free memory
     assert(!page_alloc(0));
@@ -1078,7 +1583,7 @@ check_page(void) {
     pp0->pp_ref = 0;
 
     // give free list back
-    page_free_list = fl;
+    page_unsteal(fl);
 
     // free the pages we took
     page_free(pp0);
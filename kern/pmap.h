@@ -17,6 +17,7 @@ extern struct PageInfo *pages;
 extern size_t npages;
 
 extern pde_t *kern_pgdir;
+extern struct spinlock vm_lock;
 
 
 /* This macro takes a kernel virtual address -- an address that points above
@@ -52,14 +53,52 @@ enum {
 	ALLOC_ZERO = 1<<0,
 };
 
+// page_alloc_order hands out blocks of 1 << order physically contiguous,
+// naturally aligned pages, up to one 4MB large page.
+#define PAGE_MAX_ORDER	10
+
+// page_alloc and page_free go through a per-CPU cache of up to
+// PAGE_CACHE_SIZE free pages, refilled and drained PAGE_CACHE_BATCH
+// pages at a time.  A size of 0 sends them straight to the free lists.
+#define PAGE_CACHE_SIZE		64
+#define PAGE_CACHE_BATCH	16
+
+struct PageCache {
+	struct PageInfo *pc_list;	// Free pages, linked through pp_link
+	uint32_t pc_count;		// Pages on pc_list
+
+	// Statistics, for the monitor's "pages" command
+	uint32_t pc_allocs;		// page_alloc calls
+	uint32_t pc_hits;		// ... that found a page in the cache
+	uint32_t pc_refills;		// Batches taken from the free lists
+	uint32_t pc_drains;		// Batches given back
+	uint32_t pc_zero_hits;		// ALLOC_ZERO pages from the zeroed pool
+	uint32_t pc_zero_misses;	// ALLOC_ZERO pages zeroed on demand
+	uint32_t pc_zero_idle;		// Pages this CPU zeroed while idle
+};
+
+extern struct PageCache page_caches[];	// One per CPU
+
+// Idle CPUs keep about PAGE_ZERO_POOL free pages zeroed ahead of time
+// for page_alloc(ALLOC_ZERO), PAGE_ZERO_BATCH pages at a time.
+#define PAGE_ZERO_POOL		256
+#define PAGE_ZERO_BATCH		16
+
 void	mem_init(void);
 
 void	page_init(void);
 struct PageInfo *page_alloc(int alloc_flags);
 void	page_free(struct PageInfo *pp);
+struct PageInfo *page_alloc_order(int order, int alloc_flags);
+void	page_free_order(struct PageInfo *pp, int order);
+size_t	page_free_blocks(size_t nblocks[PAGE_MAX_ORDER + 1]);
+size_t	page_cached(void);
+int	page_zero_idle(void);
+size_t	page_zero_depth(void);
 int	page_insert(pde_t *pgdir, struct PageInfo *pp, void *va, int perm);
 void	page_remove(pde_t *pgdir, void *va);
 struct PageInfo *page_lookup(pde_t *pgdir, void *va, pte_t **pte_store);
+int	page_cow_fault(struct Env *e, void *va);
 void	page_decref(struct PageInfo *pp);
 
 void	tlb_invalidate(pde_t *pgdir, void *va);
@@ -5,6 +5,9 @@
 #include <inc/stdio.h>
 #include <inc/stdarg.h>
 
+#include <kern/console.h>
+#include <kern/spinlock.h>
+
 
 static void
 putch(int ch, int *cnt)
@@ -16,9 +19,20 @@ putch(int ch, int *cnt)
 int
 vcprintf(const char *fmt, va_list ap)
 {
+	extern const char *panicstr;
 	int cnt = 0;
-
+	bool locked;
+
+	// A fault or assert while formatting panics and lands back here
+	// on the same CPU with cons_lock held, and once the kernel has
+	// panicked another CPU may never release it.  Print unlocked in
+	// either case rather than hang before the panic message is out.
+	locked = !panicstr && !spin_holding(&cons_lock);
+	if (locked)
+		spin_lock(&cons_lock);
 	vprintfmt((void*)putch, &cnt, fmt, ap);
+	if (locked)
+		spin_unlock(&cons_lock);
 	return cnt;
 }
 
@@ -0,0 +1,187 @@
+// Syscall rings: batches of syscalls submitted through a page shared
+// with the kernel (see inc/ring.h), so that a server pays one trap for
+// a whole chain of page maps, unmaps and IPC sends.
+//
+// A ring is run either by its own env, in sys_ring_enter(), or, for
+// rings set up with RING_POLL, by an idle CPU in sched_halt().  The two
+// never overlap: the env is ENV_RUNNING for as long as it is in
+// sys_ring_enter(), and ring_poll() skips running envs while holding
+// the big kernel lock, without which no env can start running.
+
+#include <inc/assert.h>
+#include <inc/error.h>
+
+#include <kern/ring.h>
+#include <kern/env.h>
+#include <kern/pmap.h>
+#include <kern/syscall.h>
+#include <kern/spinlock.h>
+
+// Envs with a RING_POLL ring, linked through env_ring_next.
+// Changed with both kernel_lock and vm_lock held; ring_poll() walks
+// it with kernel_lock.
+static struct Env *ring_pollers;
+
+// Syscalls that may be submitted through a ring: those that run
+// without the big kernel lock and never block or reschedule.  A
+// poller runs rings outside the env's address space, so sends can't
+// take message registers from user memory.
+static bool
+ring_op_ok(const struct RingSqe *sqe)
+{
+	switch (sqe->sqe_num) {
+	case SYS_page_alloc:
+	case SYS_page_map:
+	case SYS_page_unmap:
+	case SYS_page_alloc_range:
+	case SYS_page_map_range:
+	case SYS_page_unmap_range:
+	case SYS_page_protect:
+		return 1;
+	case SYS_ipc_try_send:
+		return !(sqe->sqe_args[3] & IPC_MR);
+	default:
+		return 0;
+	}
+}
+
+// Make the page mapped at va in e's address space e's syscall ring,
+// replacing any ring it had.  The kernel holds a reference to the page
+// until the ring is replaced or e is freed.  The page must be mapped
+// PTE_SHARE, so that fork shares it rather than marking it
+// copy-on-write and leaving the kernel watching the old copy.  A null
+// va just drops the current ring.  Called with the big kernel lock held.
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_INVAL if va is not page-aligned, is above UTOP, or is not
+//		mapped writable and PTE_SHARE by the user.
+int
+ring_setup(struct Env *e, void *va, int flags)
+{
+	struct PageInfo *pp = NULL;
+	pte_t *pte;
+
+	static_assert(sizeof(struct SyscallRing) <= PGSIZE);
+
+	if (va && ((uintptr_t) va >= UTOP || PGOFF(va) || (flags & ~RING_POLL)))
+		return -E_INVAL;
+
+	spin_lock(&vm_lock);
+	if (va) {
+		pp = page_lookup(e->env_pgdir, va, &pte);
+		if (!pp || (*pte & (PTE_U | PTE_W | PTE_SHARE))
+			   != (PTE_U | PTE_W | PTE_SHARE)) {
+			spin_unlock(&vm_lock);
+			return -E_INVAL;
+		}
+		pp->pp_ref++;
+	}
+	ring_release(e);
+	if (pp) {
+		e->env_ring = page2kva(pp);
+		e->env_ring_flags = flags;
+		if (flags & RING_POLL) {
+			if ((e->env_ring_next = ring_pollers))
+				ring_pollers->env_ring_prev = &e->env_ring_next;
+			e->env_ring_prev = &ring_pollers;
+			ring_pollers = e;
+		}
+	}
+	spin_unlock(&vm_lock);
+	return 0;
+}
+
+// Drop e's ring, if any.  Called with vm_lock held.
+void
+ring_release(struct Env *e)
+{
+	if (!e->env_ring)
+		return;
+	if (e->env_ring_flags & RING_POLL) {
+		if (e->env_ring_next)
+			e->env_ring_next->env_ring_prev = e->env_ring_prev;
+		*e->env_ring_prev = e->env_ring_next;
+		e->env_ring_next = NULL;
+		e->env_ring_prev = NULL;
+	}
+	page_decref(pa2page(PADDR(e->env_ring)));
+	e->env_ring = NULL;
+	e->env_ring_flags = 0;
+}
+
+// Run the submissions waiting in e's ring, in order, for as long as
+// there is room for their completions.  e must be curenv, since the
+// syscalls act on behalf of curenv.
+//
+// Returns the number of submissions run, or -E_INVAL if e has no ring
+// or the ring's indices are corrupt.
+int
+ring_enter(struct Env *e)
+{
+	struct SyscallRing *r = e->env_ring;
+	struct RingSqe sqe;
+	struct RingCqe *cqe;
+	uint32_t head, tail;
+	int n = 0;
+
+	assert(e == curenv);
+	if (!r)
+		return -E_INVAL;
+
+	head = r->sq_head;
+	tail = r->sq_tail;
+	if (tail - head > RING_NSQE)
+		return -E_INVAL;
+	// Read the entries only after the tail that published them; x86
+	// keeps loads and stores in order, so stopping the compiler from
+	// reordering suffices here and below.
+	asm volatile("" : : : "memory");
+
+	// cq_head belongs to the user; a bogus one just reads as a full CQ.
+	while (head != tail && r->cq_tail - r->cq_head < RING_NCQE) {
+		// Copy the entry out first: the user may be rewriting it.
+		sqe = r->sq[head % RING_NSQE];
+		cqe = &r->cq[r->cq_tail % RING_NCQE];
+		cqe->cqe_data = sqe.sqe_data;
+		if (ring_op_ok(&sqe))
+			cqe->cqe_res = syscall(sqe.sqe_num,
+					       sqe.sqe_args[0], sqe.sqe_args[1],
+					       sqe.sqe_args[2], sqe.sqe_args[3],
+					       sqe.sqe_args[4]);
+		else
+			cqe->cqe_res = -E_INVAL;
+		asm volatile("" : : : "memory");
+		r->sq_head = ++head;
+		r->cq_tail++;
+		n++;
+	}
+	return n;
+}
+
+// Run pending submissions on the RING_POLL rings of envs that are not
+// running.  Called by an idle CPU with the big kernel lock held.
+// Returns the number of submissions run; they may have made envs
+// runnable.
+int
+ring_poll(void)
+{
+	struct Env *e, *saved = curenv;
+	int n = 0, r;
+
+	if (!ring_pollers)
+		return 0;
+	assert(spin_holding(&kernel_lock));
+
+	for (e = ring_pollers; e; e = e->env_ring_next) {
+		if (e->env_status != ENV_RUNNABLE && e->env_status != ENV_NOT_RUNNABLE)
+			continue;
+		if (e->env_ring->sq_head == e->env_ring->sq_tail)
+			continue;
+		// The syscalls act on behalf of curenv.
+		curenv = e;
+		if ((r = ring_enter(e)) > 0)
+			n += r;
+	}
+	curenv = saved;
+	return n;
+}
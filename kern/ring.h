@@ -0,0 +1,15 @@
+#ifndef JOS_KERN_RING_H
+#define JOS_KERN_RING_H
+#ifndef JOS_KERNEL
+# error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/ring.h>
+#include <inc/env.h>
+
+int ring_setup(struct Env *e, void *va, int flags);
+void ring_release(struct Env *e);
+int ring_enter(struct Env *e);
+int ring_poll(void);
+
+#endif /* !JOS_KERN_RING_H */
@@ -4,65 +4,247 @@
 #include <kern/env.h>
 #include <kern/pmap.h>
 #include <kern/monitor.h>
+#include <kern/timer.h>
+#include <kern/time.h>
+#include <kern/sched.h>
+#include <kern/ring.h>
 
-void sched_halt(void);
+void sched_halt(void) __attribute__((noreturn));
+
+// Protects every CPU's ready queue and the envs' env_rq_* links.
+static struct spinlock runq_lock = {
+#ifdef DEBUG_SPINLOCK
+  .name = "runq_lock"
+#endif
+};
+
+// Append e to the tail of c's ready queue.
+static void
+runq_push(struct CpuInfo *c, struct Env *e) {
+  e->env_rq_next = NULL;
+  e->env_rq_prev = c->cpu_runq_tail;
+  if (c->cpu_runq_tail)
+    c->cpu_runq_tail->env_rq_next = e;
+  else
+    c->cpu_runq_head = e;
+  c->cpu_runq_tail = e;
+  c->cpu_runq_len++;
+  e->env_rq_cpu = c - cpus;
+}
+
+// Unlink e from c's ready queue.
+static void
+runq_unlink(struct CpuInfo *c, struct Env *e) {
+  if (e->env_rq_prev)
+    e->env_rq_prev->env_rq_next = e->env_rq_next;
+  else
+    c->cpu_runq_head = e->env_rq_next;
+  if (e->env_rq_next)
+    e->env_rq_next->env_rq_prev = e->env_rq_prev;
+  else
+    c->cpu_runq_tail = e->env_rq_prev;
+  e->env_rq_next = e->env_rq_prev = NULL;
+  e->env_rq_cpu = -1;
+  c->cpu_runq_len--;
+}
+
+// Remove and return the env at the head of c's ready queue,
+// or NULL if the queue is empty.
+static struct Env *
+runq_pop(struct CpuInfo *c) {
+  struct Env *e = c->cpu_runq_head;
+
+  if (e) {
+    runq_unlink(c, e);
+    assert(e->env_status == ENV_RUNNABLE);
+  }
+  return e;
+}
+
+// Pick a halted CPU to wake up for work just queued on c: c itself if
+// it is halted, otherwise any other halted CPU, which will steal it.
+// Called with runq_lock held; sched_halt() rechecks its own queue under
+// the lock after marking itself halted, so no wakeup is lost.
+static struct CpuInfo *
+sched_idle_cpu(struct CpuInfo *c) {
+  struct CpuInfo *i;
+
+  if (c != thiscpu && c->cpu_status == CPU_HALTED)
+    return c;
+  for (i = cpus; i < cpus + ncpu; i++)
+    if (i != thiscpu && i->cpu_status == CPU_HALTED)
+      return i;
+  return NULL;
+}
+
+// Program this CPU's one-shot timer for the earlier of the next
+// kernel timer deadline and, unless the CPU is about to go idle, the
+// end of a scheduling quantum.  An idle CPU with no timers pending
+// takes no timer interrupts at all.
+void
+sched_arm_timer(bool idle) {
+  uint64_t usec = idle ? 0 : SCHED_QUANTUM_US, until;
+  unsigned deadline, now;
+
+  if (timer_next(&deadline)) {
+    now = time_msec();
+    until = (int) (deadline - now) > 0 ? (uint64_t) (deadline - now) * 1000 : 1;
+    if (!usec || until < usec)
+      usec = MIN(until, 0xffffffffULL);
+  }
+  lapic_timer_oneshot(usec);
+}
+
+// Put a runnable env on a ready queue.  Envs go back to the CPU they
+// last ran on, which keeps their cache footprint warm; idle CPUs
+// rebalance by stealing in sched_yield().
+void
+sched_enqueue(struct Env *e) {
+  int cpu = e->env_cpunum;
+
+  struct CpuInfo *kick = NULL;
+
+  if (cpu < 0 || cpu >= ncpu)
+    cpu = thiscpu - cpus;
+  spin_lock(&runq_lock);
+  if (e->env_rq_cpu < 0) {
+    runq_push(&cpus[cpu], e);
+    kick = sched_idle_cpu(&cpus[cpu]);
+  }
+  spin_unlock(&runq_lock);
+
+  // Halted CPUs take no timer interrupts, so wake one up to run (or
+  // steal) the new work.
+  if (kick)
+    lapic_ipi_cpu(kick->cpu_id, IRQ_OFFSET + IRQ_RESCHED);
+}
+
+// Like sched_enqueue(), for an env that curenv just woke with an IPC
+// it is waiting for: queue e on this CPU and have this CPU's next
+// sched_yield() switch straight to it, so that a call and its reply
+// each cost one switch and no trip through the ready queue.  The
+// syscall exit paths in kern/trap.c yield when a handoff is pending.
+void
+sched_handoff(struct Env *e) {
+  spin_lock(&runq_lock);
+  if (e->env_rq_cpu < 0)
+    runq_push(thiscpu, e);
+  spin_unlock(&runq_lock);
+  thiscpu->cpu_handoff = e;
+}
+
+// Take this CPU's pending handoff off its ready queue, if it is still
+// there and runnable.
+static struct Env *
+sched_take_handoff(void) {
+  struct Env *e = thiscpu->cpu_handoff;
+
+  if (!e)
+    return NULL;
+  thiscpu->cpu_handoff = NULL;
+  spin_lock(&runq_lock);
+  if (e->env_rq_cpu >= 0 && e->env_status == ENV_RUNNABLE)
+    runq_unlink(&cpus[e->env_rq_cpu], e);
+  else
+    e = NULL;
+  spin_unlock(&runq_lock);
+  return e;
+}
+
+// Take e off whichever ready queue it is on, if any.
+void
+sched_remove(struct Env *e) {
+  spin_lock(&runq_lock);
+  if (e->env_rq_cpu >= 0)
+    runq_unlink(&cpus[e->env_rq_cpu], e);
+  spin_unlock(&runq_lock);
+}
+
+// Steal the oldest runnable env from the CPU with the longest
+// ready queue.  Returns NULL if every queue is empty.
+static struct Env *
+sched_steal(void) {
+  struct CpuInfo *c, *victim = NULL;
+
+  for (c = cpus; c < cpus + ncpu; c++)
+    if (c != thiscpu && c->cpu_runq_len > 0 &&
+        (!victim || c->cpu_runq_len > victim->cpu_runq_len))
+      victim = c;
+  return victim ? runq_pop(victim) : NULL;
+}
+
+// Pop the next env for this CPU, stealing if our queue is empty.
+static struct Env *
+sched_pick(void) {
+  struct Env *e;
+
+  spin_lock(&runq_lock);
+  if (!(e = runq_pop(thiscpu)))
+    e = sched_steal();
+  spin_unlock(&runq_lock);
+  return e;
+}
 
 // Choose a user environment to run and run it.
 void
 sched_yield(void) {
-  struct Env *idle;
-
-	// Implement simple round-robin scheduling.
-	//
-	// Search through 'envs' for an ENV_RUNNABLE environment in
-	// circular fashion starting just after the env this CPU was
-	// last running.  Switch to the first such environment found.
-	//
-	// If no envs are runnable, but the environment previously
-	// running on this CPU is still ENV_RUNNING, it's okay to
-	// choose that environment. Make sure curenv is not null before
-	// dereferencing it.
-	//
-	// Never choose an environment that's currently running on
-	// another CPU (env_status == ENV_RUNNING). If there are
-	// no runnable environments, simply drop through to the code
-	// below to halt the cpu.
-
-  // LAB 4: Your code here.
-  idle = curenv;
-  unsigned cur = idle ? ENVX(idle->env_id) : -1, end = cur + NENV, mask = NENV - 1;
-
-  // search for a runnable env
-  while (++cur < end) {
-    int c = cur & mask;
-    if (envs[c].env_status == ENV_RUNNABLE)
-      env_run(&envs[c]);
-  }
+  struct Env *e;
+
+  // Syscalls that run without the big kernel lock can block or
+  // yield, so take it here if we don't already have it.
+  lock_kernel_lazy();
+
+  // Round-robin over this CPU's ready queue: the env at the head has
+  // waited longest, and env_run() puts a preempted curenv back at the
+  // tail.  If our queue is empty, steal work from a busier CPU.
+  //
+  // If no envs are runnable, but the environment previously
+  // running on this CPU is still ENV_RUNNING, it's okay to
+  // choose that environment.
+  //
+  // Envs running on another CPU are ENV_RUNNING and never sit on a
+  // ready queue, so they can't be chosen here.  If there is nothing
+  // to run, drop through to the code below to halt the cpu.
+  if ((e = sched_take_handoff()) || (e = sched_pick()))
+    env_run(e);
 
   // no other env found, run the current env again
-  if (idle && idle->env_status == ENV_RUNNING)
-    env_run(idle);
+  if (curenv && curenv->env_status == ENV_RUNNING)
+    env_run(curenv);
 
   // sched_halt never returns
   sched_halt();
 }
 
+// Returns true if some environment is runnable, running on another
+// CPU, dying there, or asleep on a kernel timer.  Costs O(NCPU),
+// independent of NENV.
+static bool
+sched_has_work(void) {
+  struct CpuInfo *c;
+
+  if (timer_pending())
+    return 1;
+
+  for (c = cpus; c < cpus + ncpu; c++)
+    if (c->cpu_runq_len > 0 || (c != thiscpu && c->cpu_env))
+      return 1;
+  return 0;
+}
+
 // Halt this CPU when there is nothing to do. Wait until the
 // timer interrupt wakes it up. This function never returns.
 //
 void
 sched_halt(void) {
-  int i;
+  // Before going idle, run what is waiting on polled syscall rings;
+  // it may have made envs runnable.
+  if (ring_poll() > 0)
+    sched_yield();
 
   // For debugging and testing purposes, if there are no runnable
   // environments in the system, then drop into the kernel monitor.
-  for (i = 0; i < NENV; i++) {
-    if ((envs[i].env_status == ENV_RUNNABLE ||
-         envs[i].env_status == ENV_RUNNING ||
-         envs[i].env_status == ENV_DYING))
-      break;
-  }
-  if (i == NENV) {
+  if (!sched_has_work()) {
     cprintf("No runnable environments in the system!\n");
     while (1)
       monitor(NULL);
@@ -77,9 +259,27 @@ sched_halt(void) {
   // big kernel lock
   xchg(&thiscpu->cpu_status, CPU_HALTED);
 
+  // Work queued for us before we were marked halted didn't send an
+  // IPI; pick it up now.
+  spin_lock(&runq_lock);
+  if (thiscpu->cpu_runq_len > 0) {
+    spin_unlock(&runq_lock);
+    xchg(&thiscpu->cpu_status, CPU_STARTED);
+    sched_yield();
+  }
+  spin_unlock(&runq_lock);
+
+  // Stop ticking unless a kernel timer needs us.
+  sched_arm_timer(1);
+
   // Release the big kernel lock as if we were "leaving" the kernel
   unlock_kernel();
 
+  // With nothing else to do, zero free pages ahead of ALLOC_ZERO
+  // requests, a batch at a time so that newly queued work waits little.
+  while (!thiscpu->cpu_runq_len && page_zero_idle())
+    ;
+
   // Reset stack pointer, enable interrupts and then halt.
   asm volatile (
   "movl $0, %%ebp\n"
@@ -92,5 +292,5 @@ sched_halt(void) {
   "hlt\n"
   "jmp 1b\n"
   : : "a" (thiscpu->cpu_ts.ts_esp0));
+  panic("hlt returned");  /* mostly to placate the compiler */
 }
-
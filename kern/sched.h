@@ -6,7 +6,24 @@
 # error "This is a JOS kernel header; user programs should not #include it"
 #endif
 
+#include <inc/types.h>
+
+struct Env;
+
 // This function does not return.
 void sched_yield(void) __attribute__((noreturn));
 
+// Ready queue maintenance.  Every env in ENV_RUNNABLE state must be on
+// exactly one CPU's ready queue; call sched_enqueue() after making an
+// env runnable and sched_remove() before taking a runnable env out of
+// that state.
+void sched_enqueue(struct Env *e);
+void sched_remove(struct Env *e);
+void sched_handoff(struct Env *e);
+
+// Longest a CPU runs one env before the timer preempts it.
+#define SCHED_QUANTUM_US 10000
+
+void sched_arm_timer(bool idle);
+
 #endif	// !JOS_KERN_SCHED_H
@@ -17,6 +17,9 @@ struct spinlock kernel_lock = {
 };
 
 #ifdef DEBUG_SPINLOCK
+struct spinlock *spinlocks[NSPINLOCK];
+uint32_t nspinlocks;
+
 // Record the current call stack in pcs[] by following the %ebp chain.
 static void
 get_caller_pcs(uint32_t pcs[])
@@ -35,21 +38,69 @@ get_caller_pcs(uint32_t pcs[])
 		pcs[i] = 0;
 }
 
-// Check whether this CPU is holding the lock.
-static int
-holding(struct spinlock *lock)
+// Account for an acquisition that waited spun cycles.  Called with
+// lk held.
+static void
+spin_stats_acquire(struct spinlock *lk, uint64_t spun)
 {
-	return lock->locked && lock->cpu == thiscpu;
+	uint32_t i;
+
+	if (!lk->registered) {
+		if ((i = xadd(&nspinlocks, 1)) < NSPINLOCK)
+			spinlocks[i] = lk;
+		lk->registered = 1;
+	}
+	lk->acquisitions++;
+	if (spun) {
+		lk->contended++;
+		lk->spin_cycles += spun;
+	}
+	lk->acquired_at = read_tsc();
+}
+
+// Account for the hold that is about to end.  Called with lk held.
+static void
+spin_stats_release(struct spinlock *lk)
+{
+	uint64_t held = read_tsc() - lk->acquired_at;
+
+	lk->hold_cycles += held;
+	if (held > lk->max_hold) {
+		lk->max_hold = held;
+		memmove(lk->max_pcs, lk->pcs, sizeof(lk->max_pcs));
+	}
+}
+
+// Zero the statistics of every registered lock.
+void
+spin_stats_reset(void)
+{
+	uint32_t i;
+	struct spinlock *lk;
+
+	for (i = 0; i < nspinlocks && i < NSPINLOCK; i++) {
+		lk = spinlocks[i];
+		lk->acquisitions = lk->contended = 0;
+		lk->spin_cycles = lk->hold_cycles = lk->max_hold = 0;
+		lk->max_pcs[0] = 0;
+	}
 }
 #endif
 
+// Check whether this CPU is holding the lock.
+int
+spin_holding(struct spinlock *lock)
+{
+	return lock->next != lock->owner && lock->cpu == thiscpu;
+}
+
 void
 __spin_initlock(struct spinlock *lk, char *name)
 {
-	lk->locked = 0;
+	lk->next = lk->owner = 0;
+	lk->cpu = 0;
 #ifdef DEBUG_SPINLOCK
 	lk->name = name;
-	lk->cpu = 0;
 #endif
 }
 
@@ -60,21 +111,34 @@ __spin_initlock(struct spinlock *lk, char *name)
 void
 spin_lock(struct spinlock *lk)
 {
+	uint32_t ticket;
 #ifdef DEBUG_SPINLOCK
-	if (holding(lk))
+	uint64_t spun = 0;
+
+	if (spin_holding(lk))
 		panic("CPU %d cannot acquire %s: already holding", cpunum(), lk->name);
 #endif
 
-	// The xchg is atomic.
+	// The xadd is atomic and hands out tickets in order.
 	// It also serializes, so that reads after acquire are not
-	// reordered before it. 
-	while (xchg(&lk->locked, 1) != 0)
-		asm volatile ("pause");
+	// reordered before it.
+	ticket = xadd(&lk->next, 1);
+	if (lk->owner != ticket) {
+#ifdef DEBUG_SPINLOCK
+		spun = read_tsc();
+#endif
+		while (lk->owner != ticket)
+			asm volatile ("pause");
+#ifdef DEBUG_SPINLOCK
+		spun = read_tsc() - spun;
+#endif
+	}
 
 	// Record info about lock acquisition for debugging.
-#ifdef DEBUG_SPINLOCK
 	lk->cpu = thiscpu;
+#ifdef DEBUG_SPINLOCK
 	get_caller_pcs(lk->pcs);
+	spin_stats_acquire(lk, spun);
 #endif
 }
 
@@ -83,7 +147,7 @@ void
 spin_unlock(struct spinlock *lk)
 {
 #ifdef DEBUG_SPINLOCK
-	if (!holding(lk)) {
+	if (!spin_holding(lk)) {
 		int i;
 		uint32_t pcs[10];
 		// Nab the acquiring EIP chain before it gets released
@@ -103,14 +167,15 @@ spin_unlock(struct spinlock *lk)
 		panic("spin_unlock");
 	}
 
+	spin_stats_release(lk);
 	lk->pcs[0] = 0;
-	lk->cpu = 0;
 #endif
+	lk->cpu = 0;
 
-	// The xchg instruction is atomic (i.e. uses the "lock" prefix) with
-	// respect to any other instruction which references the same memory.
-	// x86 CPUs will not reorder loads/stores across locked instructions
-	// (vol 3, 8.2.2). Because xchg() is implemented using asm volatile,
-	// gcc will not reorder C statements across the xchg.
-	xchg(&lk->locked, 0);
+	// Only the holder writes 'owner', and x86 does not reorder stores
+	// with earlier loads or stores (vol 3, 8.2.2), so a plain store
+	// releases the lock.  The compiler barrier keeps gcc from moving
+	// critical-section accesses past it.
+	asm volatile("" : : : "memory");
+	lk->owner++;
 }
@@ -3,25 +3,67 @@
 
 #include <inc/types.h>
 
-// Comment this to disable spinlock debugging
+// Comment this to disable spinlock debugging and contention statistics
 #define DEBUG_SPINLOCK
 
-// Mutual exclusion lock.
+// Lock ordering.  A CPU may only acquire a lock that comes later in
+// this list than every lock it already holds:
+//
+//   kernel_lock   big kernel lock: scheduler, traps, env teardown
+//   vm_lock       user page tables and pp_ref (kern/pmap.c)
+//   env_lock      env free list, env status and IPC state (kern/env.c)
+//   runq_lock     per-CPU ready queues (kern/sched.c)
+//   timer_lock    kernel timer heap (kern/timer.c)
+//   kc_lock       each object cache's slabs (kern/kmalloc.c)
+//   page_lock     physical page free list (kern/pmap.c)
+//   cons_in_lock  console input buffer (kern/console.c)
+//   cons_lock     console output, held across each cprintf()
+//
+// The syscalls listed in syscall_nolock() (kern/syscall.c) run
+// without kernel_lock and rely on the finer locks alone.  A path
+// that ends up needing the scheduler or env teardown takes
+// kernel_lock with lock_kernel_lazy() while holding no other lock.
+
+// Mutual exclusion lock.  A ticket lock: each acquirer takes the next
+// ticket and spins until 'owner' reaches it, so waiters are served in
+// FIFO order and only read the lock's cache line while they wait.
 struct spinlock {
-	unsigned locked;       // Is the lock held?
+	volatile uint32_t next;  // Next ticket to hand out
+	volatile uint32_t owner; // Ticket now holding the lock
+	struct CpuInfo *cpu;     // The CPU holding the lock.
 
 #ifdef DEBUG_SPINLOCK
 	// For debugging:
 	char *name;            // Name of lock.
-	struct CpuInfo *cpu;   // The CPU holding the lock.
 	uintptr_t pcs[10];     // The call stack (an array of program counters)
 	                       // that locked the lock.
+
+	// Contention statistics, in TSC cycles (see the 'locks' monitor
+	// command).
+	uint32_t acquisitions;   // Times acquired
+	uint32_t contended;      // Acquisitions that had to wait
+	uint64_t spin_cycles;    // Total time spent waiting
+	uint64_t hold_cycles;    // Total time held
+	uint64_t max_hold;       // Longest single hold
+	uintptr_t max_pcs[10];   // Where the longest hold was acquired
+	uint64_t acquired_at;    // TSC when the current holder got the lock
+	bool registered;         // In spinlocks[] yet?
 #endif
 };
 
 void __spin_initlock(struct spinlock *lk, char *name);
 void spin_lock(struct spinlock *lk);
 void spin_unlock(struct spinlock *lk);
+int spin_holding(struct spinlock *lk);
+
+#ifdef DEBUG_SPINLOCK
+// Every lock acquired at least once, for the 'locks' monitor command.
+#define NSPINLOCK 32
+extern struct spinlock *spinlocks[NSPINLOCK];
+extern uint32_t nspinlocks;
+
+void spin_stats_reset(void);
+#endif
 
 #define spin_initlock(lock)   __spin_initlock(lock, #lock)
 
@@ -45,4 +87,12 @@ unlock_kernel(void)
 	asm volatile("pause");
 }
 
+// Acquire the big kernel lock unless this CPU already holds it.
+static inline void
+lock_kernel_lazy(void)
+{
+	if (!spin_holding(&kernel_lock))
+		lock_kernel();
+}
+
 #endif
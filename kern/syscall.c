@@ -13,7 +13,11 @@
 #include <kern/console.h>
 #include <kern/sched.h>
 #include <kern/time.h>
+#include <kern/timer.h>
+#include <kern/ring.h>
+#include <kern/futex.h>
 #include <kern/e1000.h>
+#include <kern/spinlock.h>
 
 static int
 sys_page_unmap(envid_t envid, void *va);
@@ -93,6 +97,110 @@ sys_exofork(void) {
     return child->env_id;
 }
 
+// Share the user half of page directory src with dst, the way the
+// user-level fork() in lib/fork.c does one sys_page_map at a time:
+// PTE_SHARE pages keep their permissions, writable and copy-on-write
+// pages become copy-on-write in both, and read-only pages stay
+// read-only.  The page at skip is left out.  Called with vm_lock held.
+//
+// Returns true if any of src's entries lost PTE_W, or -E_NO_MEM if a
+// page table could not be allocated for dst.
+static int
+fork_pgdir(pde_t *dst, pde_t *src, uintptr_t skip) {
+    uint32_t pdeno, pteno;
+    pte_t *pt, *dpt, pte;
+    int flush = 0;
+
+    for (pdeno = 0; pdeno < PDX(UTOP); pdeno++) {
+        if (!(src[pdeno] & PTE_P))
+            continue;
+        pt = KADDR(PTE_ADDR(src[pdeno]));
+        dpt = NULL;
+        for (pteno = 0; pteno < NPTENTRIES; pteno++) {
+            if (!((pte = pt[pteno]) & PTE_P)
+                || PGADDR(pdeno, pteno, 0) == (void *) skip)
+                continue;
+            // Allocate dst's page table only once something goes in it.
+            if (!dpt) {
+                if (!(dpt = pgdir_walk(dst, PGADDR(pdeno, 0, 0), 1)))
+                    return -E_NO_MEM;
+            }
+            if (!(pte & PTE_SHARE) && (pte & (PTE_W | PTE_COW))) {
+                flush |= pte & PTE_W;
+                pte = (pte & ~PTE_W) | PTE_COW;
+                pt[pteno] = pte;
+            }
+            pa2page(PTE_ADDR(pte))->pp_ref++;
+            dpt[pteno] = pte & ~(PTE_A | PTE_D);
+        }
+    }
+    return flush != 0;
+}
+
+// Create a copy-on-write child of the current environment in one
+// call: the work of sys_exofork(), a sys_page_map() for every page,
+// a fresh user exception stack, sys_env_set_pgfault_upcall() and
+// sys_env_set_status(), which lib/fork.c used to do one trap at a time.
+// The child resumes where the parent does, with 0 in %eax.
+//
+// Returns the envid of the child, or < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if no free environment is available.
+//	-E_NO_MEM on memory exhaustion.
+static envid_t
+sys_fork(void) {
+    struct Env *child;
+    struct PageInfo *pp = NULL;
+    void *xstack = (void *) (UXSTACKTOP - PGSIZE);
+    int r, flush;
+
+    if ((r = env_alloc(&child, curenv->env_id)) < 0)
+        return r;
+    child->env_status = ENV_NOT_RUNNABLE;
+    child->env_tf = curenv->env_tf;
+    child->env_tf.tf_regs.reg_eax = 0;
+    child->env_brk = curenv->env_brk;
+    child->env_pgfault_upcall = curenv->env_pgfault_upcall;
+
+    // The exception stack is never shared; zero its copy before
+    // taking vm_lock.
+    if (child->env_pgfault_upcall && !(pp = page_alloc(ALLOC_ZERO))) {
+        r = -E_NO_MEM;
+        goto fail;
+    }
+
+    spin_lock(&vm_lock);
+    if ((r = fork_pgdir(child->env_pgdir, curenv->env_pgdir, (uintptr_t) xstack)) < 0)
+        goto fail_locked;
+    flush = r;
+    if ((r = fork_pgdir(child->env_kern_pgdir, curenv->env_kern_pgdir, (uintptr_t) xstack)) < 0)
+        goto fail_locked;
+    flush |= r;
+    // Drop the parent's stale writable TLB entries.
+    if (flush)
+        lcr3(rcr3());
+    if (pp) {
+        if ((r = page_insert(child->env_pgdir, pp, xstack, PTE_P | PTE_U | PTE_W)) < 0
+            || (r = page_insert(child->env_kern_pgdir, pp, xstack, PTE_P | PTE_U | PTE_W)) < 0)
+            goto fail_locked;
+        pp = NULL;
+    }
+    spin_unlock(&vm_lock);
+
+    spin_lock(&env_lock);
+    child->env_status = ENV_RUNNABLE;
+    sched_enqueue(child);
+    spin_unlock(&env_lock);
+    return child->env_id;
+
+fail_locked:
+    spin_unlock(&vm_lock);
+fail:
+    if (pp && !pp->pp_ref)
+        page_free(pp);
+    env_free(child);
+    return r;
+}
+
 // Set envid's env_status to status, which must be ENV_RUNNABLE
 // or ENV_NOT_RUNNABLE.
 //
@@ -114,7 +222,13 @@ sys_env_set_status(envid_t envid, int status) {
         return -E_BAD_ENV;
     if (!(status == ENV_RUNNABLE || status == ENV_NOT_RUNNABLE))
         return -E_INVAL;
+    spin_lock(&env_lock);
     e->env_status = status;
+    if (status == ENV_RUNNABLE)
+        sched_enqueue(e);
+    else
+        sched_remove(e);
+    spin_unlock(&env_lock);
     return 0;
 }
 
@@ -191,25 +305,54 @@ sys_page_alloc(envid_t envid, void *va, int perm) {
 
     struct Env *e;
     struct PageInfo *pp;
+    int r = -E_NO_MEM;
 
-    if (envid2env(envid, &e, 1))
-        return -E_BAD_ENV;
+    // Zero the page before taking vm_lock.
     if (!(pp = page_alloc(ALLOC_ZERO)))
         return -E_NO_MEM;
 
-    if (page_insert(e->env_pgdir, pp, va, perm)) {
-        page_free(pp);
-        return -E_NO_MEM;
+    spin_lock(&vm_lock);
+    if (envid2env(envid, &e, 1)) {
+        r = -E_BAD_ENV;
+        goto fail;
     }
-
-
+    if (page_insert(e->env_pgdir, pp, va, perm))
+        goto fail;
     if (page_insert(e->env_kern_pgdir, pp, va, perm)) {
-        page_free(pp);
         page_remove(e->env_pgdir, va);
-        return -E_NO_MEM;
+        goto out;
     }
+    r = 0;
+    goto out;
 
+fail:
+    page_free(pp);
+out:
+    spin_unlock(&vm_lock);
+    return r;
+}
 
+// The body of sys_page_map, called with vm_lock held.
+static int
+page_map_locked(envid_t srcenvid, void *srcva,
+                envid_t dstenvid, void *dstva, int perm) {
+    struct Env *srcenv, *dstenv;
+    struct PageInfo *pp;
+    pte_t *pte;
+
+    if (envid2env(srcenvid, &srcenv, 1) || envid2env(dstenvid, &dstenv, 1))
+        return -E_BAD_ENV;
+    if (!(pp = page_lookup(srcenv->env_pgdir, srcva, &pte)))
+        return -E_INVAL;
+    if (!(*pte & PTE_W) && (perm & PTE_W))
+        return -E_INVAL;
+    if (page_insert(dstenv->env_pgdir, pp, dstva, perm))
+        return -E_NO_MEM;
+
+    if (page_insert(dstenv->env_kern_pgdir, pp, dstva, perm)) {
+        page_remove(dstenv->env_pgdir, dstva);
+        return -E_NO_MEM;
+    }
     return 0;
 }
 
@@ -240,29 +383,17 @@ sys_page_map(envid_t srcenvid, void *srcva,
     //   check the current permissions on the page.
 
     // LAB 4: Your code here.
-    struct Env *srcenv, *dstenv;
-    struct PageInfo *pp;
-    pte_t *pte;
+    int r;
 
     if ((uintptr_t) srcva >= UTOP || PGOFF(srcva)
         || (uintptr_t) dstva >= UTOP || PGOFF(dstva)
         || (perm & (PTE_U | PTE_P)) != (PTE_U | PTE_P) || perm & ~PTE_SYSCALL)
         return -E_INVAL;
 
-    if (envid2env(srcenvid, &srcenv, 1) || envid2env(dstenvid, &dstenv, 1))
-        return -E_BAD_ENV;
-    if (!(pp = page_lookup(srcenv->env_pgdir, srcva, &pte)))
-        return -E_INVAL;
-    if (!(*pte & PTE_W) && (perm & PTE_W))
-        return -E_INVAL;
-    if (page_insert(dstenv->env_pgdir, pp, dstva, perm))
-        return -E_NO_MEM;
-
-    if (page_insert(dstenv->env_kern_pgdir, pp, dstva, perm)) {
-        page_remove(dstenv->env_pgdir, dstva);
-        return -E_NO_MEM;
-    }
-    return 0;
+    spin_lock(&vm_lock);
+    r = page_map_locked(srcenvid, srcva, dstenvid, dstva, perm);
+    spin_unlock(&vm_lock);
+    return r;
 }
 
 // Unmap the page of memory at 'va' in the address space of 'envid'.
@@ -281,18 +412,402 @@ sys_page_unmap(envid_t envid, void *va) {
 
     if ((uintptr_t) va >= UTOP || PGOFF(va))
         return -E_INVAL;
-    if (envid2env(envid, &e, 1))
+    spin_lock(&vm_lock);
+    if (envid2env(envid, &e, 1)) {
+        spin_unlock(&vm_lock);
         return -E_BAD_ENV;
+    }
     page_remove(e->env_pgdir, va);
     page_remove(e->env_kern_pgdir, va);
+    spin_unlock(&vm_lock);
     return 0;
 }
 
-#ifdef CHALLENGE_LAB4
-static envid_t wait_srcenvids[NENV];
-static envid_t wait_dstenvids[NENV];
-static int last = 0;
-#endif
+// The range versions of the page syscalls below work on npages pages
+// starting at a page-aligned va.  They walk each page table once for
+// the run of pages it covers, instead of once per page, and flush the
+// TLB at most once per call.
+
+// Returns true if [va, va + npages * PGSIZE) is page-aligned and below UTOP.
+static bool
+page_range_ok(const void *va, size_t npages) {
+    return !PGOFF(va) && (uintptr_t) va < UTOP
+           && npages <= (UTOP - (uintptr_t) va) / PGSIZE;
+}
+
+// Returns true if perm is acceptable to sys_page_alloc and friends.
+static bool
+page_perm_ok(int perm) {
+    return (perm & (PTE_U | PTE_P)) == (PTE_U | PTE_P) && !(perm & ~PTE_SYSCALL);
+}
+
+// Number of pages from va on that share its page table, at most n.
+static size_t
+page_run(uintptr_t va, size_t n) {
+    return MIN(n, NPTENTRIES - PTX(va));
+}
+
+// Point *pte at pp with perm, dropping whatever page it mapped before.
+// Returns true if the old entry was present and must be flushed.
+static int
+pte_set(pte_t *pte, struct PageInfo *pp, int perm) {
+    pte_t old = *pte;
+
+    pp->pp_ref++;
+    *pte = page2pa(pp) | perm | PTE_P;
+    if (!(old & PTE_P))
+        return 0;
+    page_decref(pa2page(PTE_ADDR(old)));
+    return 1;
+}
+
+// Reload %cr3 if e's address space is the one loaded on this CPU.
+static void
+page_range_flush(struct Env *e) {
+    if (e == curenv)
+        lcr3(rcr3());
+}
+
+// Like sys_page_alloc, for npages fresh zeroed pages starting at va.
+// Pages are zeroed one page table's worth at a time before taking
+// vm_lock.  On error the pages before the failure stay mapped.
+static int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+    struct Env *e = NULL;
+    struct PageInfo *pp, *list;
+    pte_t *pt, *kpt;
+    uintptr_t a;
+    size_t i, j, n;
+    int flush = 0, r = 0;
+
+    if (!page_range_ok(va, npages) || !page_perm_ok(perm))
+        return -E_INVAL;
+
+    for (i = 0; i < npages && r == 0; i += n) {
+        a = (uintptr_t) va + i * PGSIZE;
+        n = page_run(a, npages - i);
+
+        list = NULL;
+        for (j = 0; j < n; j++) {
+            if (!(pp = page_alloc(ALLOC_ZERO))) {
+                r = -E_NO_MEM;
+                goto free;
+            }
+            pp->pp_link = list;
+            list = pp;
+        }
+
+        spin_lock(&vm_lock);
+        if (envid2env(envid, &e, 1))
+            r = -E_BAD_ENV;
+        else if (!(pt = pgdir_walk(e->env_pgdir, (void *) a, 1))
+                 || !(kpt = pgdir_walk(e->env_kern_pgdir, (void *) a, 1)))
+            r = -E_NO_MEM;
+        else
+            for (j = 0; j < n; j++) {
+                pp = list;
+                list = pp->pp_link;
+                pp->pp_link = NULL;
+                flush |= pte_set(&pt[j], pp, perm);
+                flush |= pte_set(&kpt[j], pp, perm);
+            }
+        spin_unlock(&vm_lock);
+
+    free:
+        while ((pp = list)) {
+            list = pp->pp_link;
+            pp->pp_link = NULL;
+            page_free(pp);
+        }
+    }
+    if (flush)
+        page_range_flush(e);
+    return r;
+}
+
+// Like sys_page_map, for npages pages from srcva on.  Every source page
+// must be mapped, and writable if perm has PTE_W, before anything
+// changes.  Within one environment the two ranges must be the same or
+// not overlap.  On -E_NO_MEM the pages before the failure stay mapped.
+static int
+sys_page_map_range(envid_t srcenvid, void *srcva,
+                   envid_t dstenvid, void *dstva, size_t npages, int perm) {
+    struct Env *srcenv, *dstenv;
+    pte_t *spt, *dpt, *dkpt;
+    uintptr_t s, d;
+    size_t i, j, n;
+    int flush = 0, r = 0;
+
+    if (!page_range_ok(srcva, npages) || !page_range_ok(dstva, npages)
+        || !page_perm_ok(perm))
+        return -E_INVAL;
+
+    spin_lock(&vm_lock);
+    if (envid2env(srcenvid, &srcenv, 1) || envid2env(dstenvid, &dstenv, 1)) {
+        r = -E_BAD_ENV;
+        goto out;
+    }
+    if (srcenv == dstenv && srcva != dstva
+        && (uintptr_t) srcva < (uintptr_t) dstva + npages * PGSIZE
+        && (uintptr_t) dstva < (uintptr_t) srcva + npages * PGSIZE) {
+        r = -E_INVAL;
+        goto out;
+    }
+
+    for (i = 0; i < npages; i += n) {
+        s = (uintptr_t) srcva + i * PGSIZE;
+        n = page_run(s, npages - i);
+        if (!(spt = pgdir_walk(srcenv->env_pgdir, (void *) s, 0))) {
+            r = -E_INVAL;
+            goto out;
+        }
+        for (j = 0; j < n; j++)
+            if (!(spt[j] & PTE_P) || ((perm & PTE_W) && !(spt[j] & PTE_W))) {
+                r = -E_INVAL;
+                goto out;
+            }
+    }
+
+    for (i = 0; i < npages; i += n) {
+        s = (uintptr_t) srcva + i * PGSIZE;
+        d = (uintptr_t) dstva + i * PGSIZE;
+        n = page_run(d, page_run(s, npages - i));
+        spt = pgdir_walk(srcenv->env_pgdir, (void *) s, 0);
+        if (!(dpt = pgdir_walk(dstenv->env_pgdir, (void *) d, 1))
+            || !(dkpt = pgdir_walk(dstenv->env_kern_pgdir, (void *) d, 1))) {
+            r = -E_NO_MEM;
+            break;
+        }
+        for (j = 0; j < n; j++) {
+            struct PageInfo *pp = pa2page(PTE_ADDR(spt[j]));
+
+            flush |= pte_set(&dpt[j], pp, perm);
+            flush |= pte_set(&dkpt[j], pp, perm);
+        }
+    }
+    if (flush)
+        page_range_flush(dstenv);
+out:
+    spin_unlock(&vm_lock);
+    return r;
+}
+
+// Clear the n entries from va on in pgdir, which share a page table.
+// Returns true if any was present.
+static int
+pt_clear(pde_t *pgdir, uintptr_t va, size_t n) {
+    pte_t *pt = pgdir_walk(pgdir, (void *) va, 0);
+    int flush = 0;
+    size_t j;
+
+    for (j = 0; pt && j < n; j++)
+        if (pt[j] & PTE_P) {
+            page_decref(pa2page(PTE_ADDR(pt[j])));
+            pt[j] = 0;
+            flush = 1;
+        }
+    return flush;
+}
+
+// Like sys_page_unmap, for npages pages from va on.  Unmapped pages in
+// the range are skipped.
+static int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages) {
+    struct Env *e;
+    uintptr_t a;
+    size_t i, n;
+    int flush = 0;
+
+    if (!page_range_ok(va, npages))
+        return -E_INVAL;
+    spin_lock(&vm_lock);
+    if (envid2env(envid, &e, 1)) {
+        spin_unlock(&vm_lock);
+        return -E_BAD_ENV;
+    }
+    for (i = 0; i < npages; i += n) {
+        a = (uintptr_t) va + i * PGSIZE;
+        n = page_run(a, npages - i);
+        flush |= pt_clear(e->env_pgdir, a, n);
+        flush |= pt_clear(e->env_kern_pgdir, a, n);
+    }
+    if (flush)
+        page_range_flush(e);
+    spin_unlock(&vm_lock);
+    return 0;
+}
+
+// Change the permissions of the npages pages mapped from va on to perm,
+// in place.  perm has the same restrictions as in sys_page_map: it may
+// not make a read-only page writable.
+//
+// Return 0 on success, < 0 on error.  Errors are:
+//	-E_BAD_ENV if environment envid doesn't currently exist,
+//		or the caller doesn't have permission to change envid.
+//	-E_INVAL if the range is not page-aligned or reaches past UTOP.
+//	-E_INVAL if a page in the range is not mapped.
+//	-E_INVAL if perm is inappropriate (see sys_page_map).
+static int
+sys_page_protect(envid_t envid, void *va, size_t npages, int perm) {
+    struct Env *e;
+    pte_t *pt, *kpt;
+    uintptr_t a;
+    size_t i, j, n;
+    int r = 0;
+
+    if (!page_range_ok(va, npages) || !page_perm_ok(perm))
+        return -E_INVAL;
+    spin_lock(&vm_lock);
+    if (envid2env(envid, &e, 1)) {
+        r = -E_BAD_ENV;
+        goto out;
+    }
+
+    for (i = 0; i < npages; i += n) {
+        a = (uintptr_t) va + i * PGSIZE;
+        n = page_run(a, npages - i);
+        if (!(pt = pgdir_walk(e->env_pgdir, (void *) a, 0))) {
+            r = -E_INVAL;
+            goto out;
+        }
+        for (j = 0; j < n; j++)
+            if (!(pt[j] & PTE_P) || ((perm & PTE_W) && !(pt[j] & PTE_W))) {
+                r = -E_INVAL;
+                goto out;
+            }
+    }
+
+    for (i = 0; i < npages; i += n) {
+        a = (uintptr_t) va + i * PGSIZE;
+        n = page_run(a, npages - i);
+        pt = pgdir_walk(e->env_pgdir, (void *) a, 0);
+        kpt = pgdir_walk(e->env_kern_pgdir, (void *) a, 0);
+        for (j = 0; j < n; j++) {
+            if (kpt && PTE_ADDR(kpt[j]) == PTE_ADDR(pt[j]) && (kpt[j] & PTE_P))
+                kpt[j] = PTE_ADDR(pt[j]) | perm | PTE_P;
+            pt[j] = PTE_ADDR(pt[j]) | perm | PTE_P;
+        }
+    }
+    if (npages)
+        page_range_flush(e);
+out:
+    spin_unlock(&vm_lock);
+    return r;
+}
+
+// Copy the message registers at user address srcva into mr.
+// Returns 0, or -E_INVAL if curenv cannot read them.
+static int
+ipc_load_mr(const void *srcva, uint32_t *mr) {
+    if (user_mem_check(curenv, srcva, IPC_NMR * sizeof(uint32_t), PTE_U) < 0)
+        return -E_INVAL;
+    memcpy(mr, srcva, IPC_NMR * sizeof(uint32_t));
+    return 0;
+}
+
+// Split an IPC address below UTOP that may carry a page count (see
+// IPC_PAGES) into its page-aligned base and the count.  Returns 0, or
+// -E_INVAL if the address is misaligned without IPC_NPAGES, the count
+// is too large or the pages reach past UTOP.
+static int
+ipc_range(void *va, void **base, int *npages) {
+    int n = PGOFF(va) & ~IPC_NPAGES;
+
+    if (n && !(PGOFF(va) & IPC_NPAGES))
+        return -E_INVAL;
+    if (n == 0)
+        n = 1;
+    *base = ROUNDDOWN(va, PGSIZE);
+    if (n > IPC_MAXPAGES || (uintptr_t) *base + n * PGSIZE > UTOP)
+        return -E_INVAL;
+    *npages = n;
+    return 0;
+}
+
+// Deliver 'value', and the pages at 'srcva' if the receiver wants
+// them, from src to env, which must be blocked receiving from src.
+// Pages beyond the receiver's window are not sent.  With IPC_MR in
+// perm, deliver the message registers mr instead of pages.
+// Called with vm_lock and env_lock held.  Leaves env blocked; the
+// caller wakes it.  Returns 0 or an error as for sys_ipc_try_send.
+static int
+ipc_deliver(struct Env *src, struct Env *env, uint32_t value, void *srcva,
+            unsigned perm, const uint32_t *mr) {
+    struct PageInfo *pp;
+    pte_t *pte;
+    void *dstva;
+    int i, npages = 0;
+
+    if (perm & IPC_MR)
+        memcpy(env->env_ipc_mr, mr, sizeof(env->env_ipc_mr));
+    else if ((uintptr_t) srcva < UTOP && env->env_ipc_dstva) {
+        if (ipc_range(srcva, &srcva, &npages) < 0)
+            return -E_INVAL;
+        if ((perm & (PTE_U | PTE_P)) != (PTE_U | PTE_P) || perm & (~PTE_SYSCALL))
+            return -E_INVAL;
+        npages = MIN(npages, env->env_ipc_dstnpages);
+        // Check every page before mapping any.
+        for (i = 0; i < npages; i++) {
+            if (!(pp = page_lookup(src->env_pgdir, srcva + i * PGSIZE, &pte)))
+                return -E_INVAL;
+            if ((perm & PTE_W) && !(*pte & PTE_W))
+                return -E_INVAL;
+        }
+        for (i = 0; i < npages; i++) {
+            pp = page_lookup(src->env_pgdir, srcva + i * PGSIZE, NULL);
+            dstva = env->env_ipc_dstva + i * PGSIZE;
+            if (page_insert(env->env_pgdir, pp, dstva, perm))
+                goto no_mem;
+            if (page_insert(env->env_kern_pgdir, pp, dstva, perm)) {
+                page_remove(env->env_pgdir, dstva);
+                goto no_mem;
+            }
+        }
+    }
+
+    env->env_ipc_recving = 0;
+    env->env_ipc_from = src->env_id;
+    env->env_ipc_value = value;
+    env->env_ipc_perm = (perm & IPC_MR) ? IPC_MR : npages ? perm : 0;
+    env->env_ipc_npages = npages;
+    env->env_tf.tf_regs.reg_eax = 0;
+    return 0;
+
+no_mem:
+    while (i-- > 0) {
+        page_remove(env->env_pgdir, env->env_ipc_dstva + i * PGSIZE);
+        page_remove(env->env_kern_pgdir, env->env_ipc_dstva + i * PGSIZE);
+    }
+    return -E_NO_MEM;
+}
+
+// True if env is blocked receiving and will take an IPC from curenv:
+// an env in sys_ipc_call only takes the reply from its callee.
+static bool
+ipc_accepts(struct Env *env) {
+    return env->env_ipc_recving
+        && (!env->env_ipc_callee || env->env_ipc_callee == curenv->env_id);
+}
+
+// Block curenv behind the other senders waiting on env, until env's
+// next sys_ipc_recv delivers the message.  If 'call', curenv then
+// waits for env's reply as in sys_ipc_call.  Called with vm_lock and
+// env_lock held, which it releases.  Does not return.
+static void __attribute__((noreturn))
+ipc_send_wait(struct Env *env, uint32_t value, void *srcva, unsigned perm,
+              const uint32_t *mr, bool call) {
+    curenv->env_ipc_send_value = value;
+    curenv->env_ipc_send_srcva = srcva;
+    curenv->env_ipc_send_perm = perm;
+    if (perm & IPC_MR)
+        memcpy(curenv->env_ipc_send_mr, mr, sizeof(curenv->env_ipc_send_mr));
+    curenv->env_ipc_send_call = call;
+    curenv->env_status = ENV_NOT_RUNNABLE;
+    env_sendq_push(env, curenv);
+    spin_unlock(&env_lock);
+    spin_unlock(&vm_lock);
+    sched_yield();
+}
 
 // Try to send 'value' to the target env 'envid'.
 // If srcva < UTOP, then also send page currently mapped at 'srcva',
@@ -308,13 +823,21 @@ static int last = 0;
 //    env_ipc_recving is set to 0 to block future sends;
 //    env_ipc_from is set to the sending envid;
 //    env_ipc_value is set to the 'value' parameter;
-//    env_ipc_perm is set to 'perm' if a page was transferred, 0 otherwise.
+//    env_ipc_perm is set to 'perm' if a page was transferred, 0 otherwise;
+//    env_ipc_npages is set to the number of pages transferred.
 // The target environment is marked runnable again, returning 0
 // from the paused sys_ipc_recv system call.  (Hint: does the
 // sys_ipc_recv function ever actually return?)
 //
 // If the sender wants to send a page but the receiver isn't asking for one,
 // then no page mapping is transferred, but no error occurs.
+//
+// srcva may carry a page count (see IPC_PAGES) to send that many
+// pages at once.  Only as many as fit the target's window are sent.
+//
+// If perm has IPC_MR set, srcva instead points to IPC_NMR words of
+// message registers, which are copied into the target's env_ipc_mr,
+// and env_ipc_perm is set to IPC_MR.
 // The ipc only happens when no errors occur.
 //
 // Returns 0 on success, < 0 on error.
@@ -322,8 +845,10 @@ static int last = 0;
 //	-E_BAD_ENV if environment envid doesn't currently exist.
 //		(No need to check permissions.)
 //	-E_IPC_NOT_RECV if envid is not currently blocked in sys_ipc_recv,
-//		or another environment managed to send first.
-//	-E_INVAL if srcva < UTOP but srcva is not page-aligned.
+//		or another environment managed to send first, or envid is
+//		blocked in sys_ipc_call waiting for another env's reply.
+//	-E_INVAL if srcva < UTOP but srcva is not page-aligned, apart
+//		from a page count, or the pages reach past UTOP.
 //	-E_INVAL if srcva < UTOP and perm is inappropriate
 //		(see sys_page_alloc).
 //	-E_INVAL if srcva < UTOP but srcva is not mapped in the caller's
@@ -332,54 +857,45 @@ static int last = 0;
 //		current environment's address space.
 //	-E_NO_MEM if there's not enough memory to map srcva in envid's
 //		address space.
+//	-E_INVAL if perm has IPC_MR set but the message registers at
+//		srcva are not readable.
 static int
 sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, unsigned perm) {
     // LAB 4: Your code here.
     struct Env *env;
-    struct PageInfo *pp;
-    pte_t *pte;
+    uint32_t mr[IPC_NMR];
+    int r;
 
-    if (envid2env(envid, &env, 0))
-        return -E_BAD_ENV;
-    if (!env->env_ipc_recving) {
-#ifdef CHALLENGE_LAB4
-        wait_srcenvids[last] = curenv->env_id;
-        wait_dstenvids[last] = envid;
-        if (++last == NENV)
-          panic("ipc buffer overflow");
-        curenv->env_status = ENV_NOT_RUNNABLE;
-        sched_yield();
-#else
-        return -E_IPC_NOT_RECV;
-#endif
-    }
-    bool send_page = (uintptr_t) srcva < UTOP && env->env_ipc_dstva;
+    if ((perm & IPC_MR) && (r = ipc_load_mr(srcva, mr)) < 0)
+        return r;
 
-    if (send_page) {
-        if (PGOFF(srcva))
-            return -E_INVAL;
-        if ((perm & (PTE_U | PTE_P)) != (PTE_U | PTE_P) || perm & (~PTE_SYSCALL))
-            return -E_INVAL;
-        if (!(pp = page_lookup(curenv->env_pgdir, srcva, &pte)))
-            return -E_INVAL;
-        if ((perm & PTE_W) && !(*pte & PTE_W))
-            return -E_INVAL;
-        if (page_insert(env->env_pgdir, pp, env->env_ipc_dstva, perm))
-            return -E_NO_MEM;
-        if (page_insert(env->env_kern_pgdir, pp, env->env_ipc_dstva, perm)) {
-            page_remove(env->env_pgdir, env->env_ipc_dstva);
-            return -E_NO_MEM;
-        }
+    // vm_lock keeps env and both address spaces alive; env_lock
+    // makes the check of env_ipc_recving and the wakeup atomic.
+    spin_lock(&vm_lock);
+    if (envid2env(envid, &env, 0)) {
+        spin_unlock(&vm_lock);
+        return -E_BAD_ENV;
     }
-
-    env->env_ipc_recving = 0;
-    env->env_ipc_from = curenv->env_id;
-    env->env_ipc_value = value;
-    env->env_ipc_perm = send_page ? perm : 0;
-
-    env->env_tf.tf_regs.reg_eax = 0;
+    spin_lock(&env_lock);
+    r = -E_IPC_NOT_RECV;
+    if (!ipc_accepts(env))
+        goto out;
+    if ((r = ipc_deliver(curenv, env, value, srcva, perm, mr)))
+        goto out;
     env->env_status = ENV_RUNNABLE;
-    return 0;
+    // A reply to an env blocked in sys_ipc_call: switch straight back
+    // to it when this syscall returns.
+    if (env->env_ipc_callee) {
+        env->env_ipc_callee = 0;
+        sched_handoff(env);
+    } else
+        sched_enqueue(env);
+    r = 0;
+
+out:
+    spin_unlock(&env_lock);
+    spin_unlock(&vm_lock);
+    return r;
 }
 
 // Block until a value is ready.  Record that you want to receive
@@ -388,46 +904,191 @@ sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, unsigned perm) {
 //
 // If 'dstva' is < UTOP, then you are willing to receive a page of data.
 // 'dstva' is the virtual address at which the sent page should be mapped.
+// With a page count (see IPC_PAGES), dstva is a window that takes up
+// to that many pages.
 //
 // This function only returns on error, but the system call will eventually
 // return 0 on success.
 // Return < 0 on error.  Errors are:
-//	-E_INVAL if dstva < UTOP but dstva is not page-aligned.
+//	-E_INVAL if dstva < UTOP but dstva is not page-aligned, apart
+//		from a page count, or the window reaches past UTOP.
 static int
 sys_ipc_recv(void *dstva) {
-    int r;
+    struct Env *src;
+    void *base;
+    int r, npages;
     // LAB 4: Your code here.
+    if ((uintptr_t) dstva < UTOP && ipc_range(dstva, &base, &npages) < 0)
+        return -E_INVAL;
+
+    // Senders run without the big kernel lock, so publish our state
+    // under env_lock.  We still hold the big lock here, which keeps
+    // other CPUs from running us until we have left this CPU.
+    // vm_lock keeps a waiting sender's address space stable while we
+    // take its page.
+    spin_lock(&vm_lock);
+    spin_lock(&env_lock);
+
+    // A timer IPC that fired while we were busy is delivered at once.
+    if (curenv->env_timer_ipc_pending) {
+        curenv->env_timer_ipc_pending = 0;
+        curenv->env_ipc_from = 0;
+        curenv->env_ipc_value = curenv->env_timer_ipc_value;
+        curenv->env_ipc_perm = 0;
+        spin_unlock(&env_lock);
+        spin_unlock(&vm_lock);
+        return 0;
+    }
     if ((uintptr_t) dstva < UTOP) {
-        if (PGOFF(dstva))
-            return -E_INVAL;
-        curenv->env_ipc_dstva = dstva;
+        curenv->env_ipc_dstva = base;
+        curenv->env_ipc_dstnpages = npages;
     }
-
     curenv->env_ipc_recving = 1;
+    curenv->env_ipc_callee = 0;
+
+    // Take the message of the oldest sender blocked on us, if any.  A
+    // sender whose message can't be delivered gets the error instead;
+    // a sender in sys_ipc_call goes on to wait for our reply.
+    while ((src = env_sendq_pop(curenv))) {
+        r = ipc_deliver(src, curenv, src->env_ipc_send_value,
+                        src->env_ipc_send_srcva, src->env_ipc_send_perm,
+                        src->env_ipc_send_mr);
+        if (!r && src->env_ipc_send_call) {
+            src->env_ipc_recving = 1;
+            src->env_ipc_callee = curenv->env_id;
+        } else {
+            src->env_tf.tf_regs.reg_eax = r;
+            src->env_status = ENV_RUNNABLE;
+            sched_enqueue(src);
+        }
+        if (!r) {
+            spin_unlock(&env_lock);
+            spin_unlock(&vm_lock);
+            return 0;
+        }
+    }
+
     curenv->env_status = ENV_NOT_RUNNABLE;
+    spin_unlock(&env_lock);
+    spin_unlock(&vm_lock);
+
+    sched_yield();
+}
+
+// Send to 'envid' as sys_ipc_try_send does, but if 'envid' is not
+// receiving, block until it is rather than fail.  Senders waiting on
+// the same env are delivered in the order they blocked, one per
+// sys_ipc_recv.
+//
+// Returns 0 on success, < 0 on error.  Errors are those of
+// sys_ipc_try_send other than -E_IPC_NOT_RECV, and:
+//	-E_INVAL if envid is the caller.
+//	-E_BAD_ENV if envid exits while we wait.
+static int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, unsigned perm) {
+    struct Env *env;
+    uint32_t mr[IPC_NMR];
+    int r;
+
+    if ((r = sys_ipc_try_send(envid, value, srcva, perm)) != -E_IPC_NOT_RECV)
+        return r;
+    if ((perm & IPC_MR) && (r = ipc_load_mr(srcva, mr)) < 0)
+        return r;
 
-#ifdef CHALLENGE_LAB4
-    int i;
-    for (i = 0; i < last; ++i)
-      if (wait_dstenvids[i] == curenv->env_id) {
-        envid_t srcenvid = wait_srcenvids[i];
-        struct Env *srcenv;
-        if ((r = envid2env(srcenvid, &srcenv, 0)))
-          return r;
-        srcenv->env_tf.tf_regs.reg_eax = -E_IPC_NOT_RECV;
-        srcenv->env_status = ENV_RUNNABLE;
-        break;
-      }
-    if (i < last) {
-      for (; i < last - 1; ++i) {
-        wait_srcenvids[i] = wait_srcenvids[i + 1];
-        wait_dstenvids[i] = wait_dstenvids[i + 1];
-      }
-      last--;
+    // Envs only start receiving with the big kernel lock held, as we
+    // do, so envid is still not ready for us.
+    spin_lock(&vm_lock);
+    if (envid2env(envid, &env, 0)) {
+        spin_unlock(&vm_lock);
+        return -E_BAD_ENV;
     }
-#endif
+    spin_lock(&env_lock);
+    if (env == curenv) {
+        spin_unlock(&env_lock);
+        spin_unlock(&vm_lock);
+        return -E_INVAL;
+    }
+    ipc_send_wait(env, value, srcva, perm, mr, 0);
+}
+
+// Send to 'envid' as sys_ipc_send does, then block receiving the
+// reply from 'envid' alone, as sys_ipc_recv(dstva) does.  Rather than
+// waiting for the scheduler, this CPU switches straight to the
+// receiver, and the receiver's reply switches straight back (see
+// sched_handoff()).
+//
+// This function only returns on error; the system call returns 0 once
+// the reply arrives, with the reply in env_ipc_* as for sys_ipc_recv.
+// Errors are those of sys_ipc_send, and those of sys_ipc_recv for
+// dstva, and:
+//	-E_INVAL if envid is the caller.
+static int
+sys_ipc_call(envid_t envid, uint32_t value, void *srcva, unsigned perm,
+             void *dstva) {
+    struct Env *env;
+    uint32_t mr[IPC_NMR];
+    void *base = NULL;
+    int r, npages = 0;
 
+    if ((uintptr_t) dstva < UTOP && ipc_range(dstva, &base, &npages) < 0)
+        return -E_INVAL;
+    if ((perm & IPC_MR) && (r = ipc_load_mr(srcva, mr)) < 0)
+        return r;
+
+    spin_lock(&vm_lock);
+    if (envid2env(envid, &env, 0)) {
+        spin_unlock(&vm_lock);
+        return -E_BAD_ENV;
+    }
+    spin_lock(&env_lock);
+    r = -E_INVAL;
+    if (env == curenv)
+        goto out;
+    // Wait our turn if env isn't receiving; sys_ipc_recv delivers.
+    curenv->env_ipc_dstva = base;
+    curenv->env_ipc_dstnpages = npages;
+    if (!ipc_accepts(env))
+        ipc_send_wait(env, value, srcva, perm, mr, 1);
+    if ((r = ipc_deliver(curenv, env, value, srcva, perm, mr)))
+        goto out;
+
+    // Block for the reply.
+    curenv->env_ipc_recving = 1;
+    curenv->env_ipc_callee = env->env_id;
+    curenv->env_status = ENV_NOT_RUNNABLE;
+
+    env->env_status = ENV_RUNNABLE;
+    env->env_ipc_callee = 0;
+    sched_handoff(env);
+    spin_unlock(&env_lock);
+    spin_unlock(&vm_lock);
     sched_yield();
+
+out:
+    spin_unlock(&env_lock);
+    spin_unlock(&vm_lock);
+    return r;
+}
+
+// Reply to 'envid' as sys_ipc_try_send does, then wait for the next
+// request as sys_ipc_recv(dstva) does, all in one trap.  If envid is
+// 0, just wait.  Meant for servers whose clients use sys_ipc_call: the
+// reply switches this CPU straight back to the client.
+//
+// This function only returns on error; the system call returns 0 once
+// a request arrives.  Nothing is received if the reply fails.
+// Errors are those of sys_ipc_try_send and sys_ipc_recv.
+static int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *srcva, unsigned perm,
+                   void *dstva) {
+    void *base;
+    int r, npages;
+
+    if ((uintptr_t) dstva < UTOP && ipc_range(dstva, &base, &npages) < 0)
+        return -E_INVAL;
+    if (envid && (r = sys_ipc_try_send(envid, value, srcva, perm)) < 0)
+        return r;
+    return sys_ipc_recv(dstva);
 }
 
 #ifdef CHALLENGE_LAB5
@@ -458,7 +1119,9 @@ sys_map_kernel_page(void *kpage, void *va) {
     struct PageInfo *p = pa2page(PADDR(kpage));
     if (p == NULL)
         return E_INVAL;
+    spin_lock(&vm_lock);
     r = page_insert(curenv->env_pgdir, p, va, PTE_U | PTE_W);
+    spin_unlock(&vm_lock);
     return r;
 }
 
@@ -466,7 +1129,9 @@ static int
 sys_sbrk(uint32_t inc) {
     // LAB3: your code here.
     uintptr_t curbrk = curenv->env_brk;
+    spin_lock(&vm_lock);
     region_alloc(curenv, (void *) (curbrk - inc), inc);
+    spin_unlock(&vm_lock);
     curenv->env_brk = ROUNDDOWN(curbrk - inc, PGSIZE);
     return curenv->env_brk;
 }
@@ -498,11 +1163,87 @@ sys_net_recv(void *buf, uint32_t len) {
     return e1000_rx(buf, len);
 }
 
+// Block the current environment for at least msec milliseconds.
+// It is parked ENV_NOT_RUNNABLE on a kernel timer, which makes it
+// runnable again from the timer interrupt.
+//
+// Returns 0 after sleeping, < 0 on error.  Errors are:
+//	-E_NO_MEM if no kernel timer is available.
 int sys_sleep(unsigned msec) {
-    unsigned start = time_msec(), end = start + msec;
-    while (time_msec() < end)
-        sched_yield();
-    return 0;
+    int r;
+
+    // Arm the timer under env_lock so it can't fire before we block.
+    spin_lock(&env_lock);
+    if ((r = timer_arm(curenv, msec, TIMER_WAKE, 0)) < 0) {
+        spin_unlock(&env_lock);
+        return r;
+    }
+    curenv->env_status = ENV_NOT_RUNNABLE;
+    curenv->env_sleeping = 1;
+    curenv->env_tf.tf_regs.reg_eax = 0;
+    spin_unlock(&env_lock);
+    sched_yield();
+}
+
+// Arrange for the current environment to receive an IPC from envid 0
+// carrying 'value' after msec milliseconds.  If the environment is not
+// in sys_ipc_recv at that time, its next sys_ipc_recv returns the
+// message immediately.  Replaces any sleep or timer IPC already
+// pending for the environment.
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_MEM if no kernel timer is available.
+static int
+sys_ipc_timer(unsigned msec, uint32_t value) {
+    return timer_arm(curenv, msec, TIMER_IPC, value);
+}
+
+// Register the page at 'va' in the caller's address space as its
+// syscall ring (see inc/ring.h), or drop the current ring if va is 0.
+// If 'flags' includes RING_POLL, idle CPUs may run its submissions
+// while the caller is not running.
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_INVAL if va is not page-aligned, is above UTOP, or is not
+//		mapped writable and PTE_SHARE; or if flags is invalid.
+static int
+sys_ring_setup(void *va, int flags) {
+    return ring_setup(curenv, va, flags);
+}
+
+// Run the submissions waiting in the caller's syscall ring, in order,
+// while there is room for their completions.  Runs without the big
+// kernel lock, like the syscalls it may submit.
+//
+// Returns the number of submissions run, < 0 on error.  Errors are:
+//	-E_INVAL if the caller has no ring, or its indices are corrupt.
+static int
+sys_ring_enter(void) {
+    return ring_enter(curenv);
+}
+
+// If the word at 'addr' still holds 'val', sleep until another env
+// calls sys_futex_wake on the same word, or for at most 'msec'
+// milliseconds if 'msec' is nonzero.  The word is identified by its
+// physical page, so envs sharing a page may map it anywhere.
+//
+// Returns 0 once woken or timed out, < 0 on error.  Errors are:
+//	-E_AGAIN if the word does not hold val.
+//	-E_INVAL if addr is not word-aligned or not readable.
+//	-E_NO_MEM if msec is nonzero and no kernel timer is available.
+static int
+sys_futex_wait(const void *addr, uint32_t val, unsigned msec) {
+    return futex_wait(addr, val, msec);
+}
+
+// Wake up to 'n' envs sleeping in sys_futex_wait on the word at
+// 'addr', oldest first.  Runs without the big kernel lock.
+//
+// Returns the number of envs woken, < 0 on error.  Errors are:
+//	-E_INVAL if addr is not word-aligned or not readable.
+static int
+sys_futex_wake(const void *addr, int n) {
+    return futex_wake(addr, n);
 }
 
 static int sys_net_get_macaddr(char *macaddr) {
@@ -512,6 +1253,35 @@ static int sys_net_get_macaddr(char *macaddr) {
 }
 
 
+// Returns true if syscallno can run without the big kernel lock.
+// These syscalls only touch state guarded by the finer-grained locks
+// in kern/spinlock.h; anything that blocks or schedules still takes
+// the big lock, lazily if need be.
+bool
+syscall_nolock(uint32_t syscallno) {
+    switch (syscallno) {
+        case SYS_cputs:
+        case SYS_cgetc:
+        case SYS_getenvid:
+        case SYS_exofork:
+        case SYS_fork:
+        case SYS_page_alloc:
+        case SYS_page_map:
+        case SYS_page_unmap:
+        case SYS_page_alloc_range:
+        case SYS_page_map_range:
+        case SYS_page_unmap_range:
+        case SYS_page_protect:
+        case SYS_time_msec:
+        case SYS_ring_enter:
+        case SYS_ipc_try_send:
+        case SYS_futex_wake:
+            return 1;
+        default:
+            return 0;
+    }
+}
+
 // Dispatches to the correct kernel function, passing the arguments.
 int32_t
 syscall(uint32_t syscallno, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5) {
@@ -545,6 +1315,9 @@ syscall(uint32_t syscallno, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4,
         case SYS_exofork:
             r = sys_exofork();
             break;
+        case SYS_fork:
+            r = sys_fork();
+            break;
         case SYS_env_set_status:
             r = sys_env_set_status(a1, a2);
             break;
@@ -557,6 +1330,20 @@ syscall(uint32_t syscallno, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4,
         case SYS_page_unmap:
             r = sys_page_unmap(a1, (void *) a2);
             break;
+        case SYS_page_alloc_range:
+            r = sys_page_alloc_range(a1, (void *) a2, a3, a4);
+            break;
+        case SYS_page_map_range:
+            // Six arguments: perm rides in the low bits of dstva.
+            r = sys_page_map_range(a1, (void *) a2, a3, (void *) ROUNDDOWN(a4, PGSIZE),
+                                   a5, PGOFF(a4));
+            break;
+        case SYS_page_unmap_range:
+            r = sys_page_unmap_range(a1, (void *) a2, a3);
+            break;
+        case SYS_page_protect:
+            r = sys_page_protect(a1, (void *) a2, a3, a4);
+            break;
         case SYS_env_set_pgfault_upcall:
             r = sys_env_set_pgfault_upcall(a1, (void *) a2);
             break;
@@ -566,6 +1353,15 @@ syscall(uint32_t syscallno, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4,
         case SYS_ipc_try_send:
             r = sys_ipc_try_send(a1, a2, (void *) a3, a4);
             break;
+        case SYS_ipc_send:
+            r = sys_ipc_send(a1, a2, (void *) a3, a4);
+            break;
+        case SYS_ipc_call:
+            r = sys_ipc_call(a1, a2, (void *) a3, a4, (void *) a5);
+            break;
+        case SYS_ipc_reply_recv:
+            r = sys_ipc_reply_recv(a1, a2, (void *) a3, a4, (void *) a5);
+            break;
         case SYS_env_set_trapframe:
             r = sys_env_set_trapframe(a1, (struct Trapframe *) a2);
             break;
@@ -589,6 +1385,21 @@ syscall(uint32_t syscallno, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4,
         case SYS_net_get_macaddr:
             r = sys_net_get_macaddr((char *) a1);
             break;
+        case SYS_ipc_timer:
+            r = sys_ipc_timer(a1, a2);
+            break;
+        case SYS_ring_setup:
+            r = sys_ring_setup((void *) a1, a2);
+            break;
+        case SYS_ring_enter:
+            r = sys_ring_enter();
+            break;
+        case SYS_futex_wait:
+            r = sys_futex_wait((void *) a1, a2, a3);
+            break;
+        case SYS_futex_wake:
+            r = sys_futex_wake((void *) a1, a2);
+            break;
         default:
             r = -E_INVAL;
     }
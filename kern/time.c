@@ -1,26 +1,128 @@
-#include <kern/time.h>
+#include <inc/x86.h>
 #include <inc/assert.h>
+#include <inc/mmu.h>
+#include <kern/time.h>
+
+// The PIT's input clock, in Hz.
+#define PIT_HZ		1193182
+#define PIT_CH2		0x42	// Channel 2 data port
+#define PIT_MODE	0x43	// Mode/command register
+#define PIT_GATE	0x61	// Channel 2 gate (bit 0) and OUT2 (bit 5)
+
+// Calibrate against this many milliseconds of PIT time.
+#define CALIBRATE_MS	10
+
+// IA32_TIME_STAMP_COUNTER: writing it sets this CPU's TSC.
+#define MSR_TSC		0x10
+
+// An AP whose TSC reads this far ahead of the BSP's (in TSC ticks per
+// millisecond, so 10 us) after the handshake is resynchronized.
+#define SKEW_DIV	100
 
-static unsigned int ticks;
+// Page-sized so that no other kernel data shares the frame that is
+// mapped into every environment at UTIME.
+static union {
+	struct TimePage tp;
+	uint8_t pad[PGSIZE];
+} timepage_frame __attribute__((aligned(PGSIZE)));
 
+struct TimePage *const timepage = &timepage_frame.tp;
+
+// Handshake between time_sync_bsp() and time_sync_ap().
+enum {
+	SYNC_IDLE = 0,
+	SYNC_AP_READY,	// AP is waiting for the BSP's TSC
+	SYNC_BSP_SENT,	// sync_tsc holds the BSP's TSC
+};
+static volatile uint32_t sync_state;
+static volatile uint64_t sync_tsc;
+
+// Busy-wait for ms milliseconds (at most 54) using PIT channel 2.
+// Only meant for calibrating other clocks at boot.
+void
+pit_delay(unsigned ms)
+{
+	uint32_t count = PIT_HZ / 1000 * ms;
+
+	assert(count <= 0xffff);
+	// Enable the channel 2 gate, keep the speaker off.
+	outb(PIT_GATE, (inb(PIT_GATE) & ~0x02) | 0x01);
+	// Channel 2, low then high byte, mode 0 (interrupt on terminal
+	// count): OUT2 drops now and rises when the count runs out.
+	outb(PIT_MODE, 0xb0);
+	outb(PIT_CH2, count & 0xff);
+	outb(PIT_CH2, count >> 8);
+	while (!(inb(PIT_GATE) & 0x20))
+		/* do nothing */;
+}
+
+// Measure the TSC against the PIT and start the clock.
 void
 time_init(void)
 {
-	ticks = 0;
+	uint64_t start = read_tsc();
+	uint64_t per_msec, mult;
+
+	pit_delay(CALIBRATE_MS);
+	per_msec = (read_tsc() - start) / CALIBRATE_MS;
+	if (per_msec == 0)
+		panic("time_init: TSC does not tick");
+	mult = (1000000ULL << TIME_SHIFT) / per_msec;
+	if (per_msec > 0xffffffff || mult > 0xffffffff)
+		panic("time_init: TSC frequency %llu/ms out of range", per_msec);
+
+	timepage->tp_tsc_per_msec = per_msec;
+	timepage->tp_mult = mult;
+	timepage->tp_tsc_base = read_tsc();
 }
 
-// This should be called once per timer interrupt.  A timer interrupt
-// fires every 10 ms.
+// Called on the BSP while an AP boots: hand the AP a fresh reading of
+// the BSP's TSC for time_sync_ap() to compare against.
 void
-time_tick(void)
+time_sync_bsp(void)
+{
+	while (sync_state != SYNC_AP_READY)
+		asm volatile("pause");
+	sync_tsc = read_tsc();
+	xchg(&sync_state, SYNC_BSP_SENT);
+	while (sync_state != SYNC_IDLE)
+		asm volatile("pause");
+}
+
+// Called on each AP before it reports CPU_STARTED.  The AP reads its
+// own TSC after the BSP's reading, so a TSC that is in step reads a
+// little ahead.  If it reads behind, or too far ahead, set it to the
+// BSP's value so that the time page gives the same answer everywhere.
+void
+time_sync_ap(void)
+{
+	uint64_t tsc;
+	int64_t skew;
+
+	xchg(&sync_state, SYNC_AP_READY);
+	while (sync_state != SYNC_BSP_SENT)
+		asm volatile("pause");
+	tsc = read_tsc();
+	skew = tsc - sync_tsc;
+	if (skew < 0 || skew > timepage->tp_tsc_per_msec / SKEW_DIV) {
+		tsc = sync_tsc;
+		wrmsr(MSR_TSC, (uint32_t) tsc, (uint32_t) (tsc >> 32));
+	}
+	xchg(&sync_state, SYNC_IDLE);
+}
+
+// Nanoseconds since time_init(), computed the same way as user code
+// computes it from the page at UTIME.
+uint64_t
+time_nsec(void)
 {
-	ticks++;
-	if (ticks * 10 < ticks)
-		panic("time_tick: time overflowed");
+	return timepage_nsec(timepage, read_tsc());
 }
 
+// Milliseconds since time_init(), read from the TSC, so the
+// resolution does not depend on how often the timer interrupt fires.
 unsigned int
 time_msec(void)
 {
-	return ticks * 10;
+	return time_nsec() / 1000000;
 }
@@ -4,8 +4,16 @@
 # error "This is a JOS kernel header; user programs should not #include it"
 #endif
 
+#include <inc/time.h>
+
+// The clock parameters, mapped read-only at UTIME.
+extern struct TimePage *const timepage;
+
 void time_init(void);
-void time_tick(void);
+void time_sync_bsp(void);
+void time_sync_ap(void);
+uint64_t time_nsec(void);
 unsigned int time_msec(void);
+void pit_delay(unsigned ms);
 
 #endif /* JOS_KERN_TIME_H */
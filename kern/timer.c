@@ -0,0 +1,230 @@
+// Kernel timers for sys_sleep() and timer IPCs.
+//
+// Pending timers sit in a binary min-heap ordered by deadline, so
+// arming and cancelling cost O(log n) and the timer interrupt only
+// has to look at the root.
+
+#include <inc/assert.h>
+#include <inc/error.h>
+
+#include <kern/timer.h>
+#include <kern/time.h>
+#include <kern/env.h>
+#include <kern/pmap.h>
+#include <kern/sched.h>
+#include <kern/spinlock.h>
+#include <kern/futex.h>
+#include <kern/kmalloc.h>
+
+// One timer per env is all we ever need.
+#define NTIMER NENV
+
+static struct KmemCache timer_cache;
+
+static struct Timer *heap[NTIMER];
+static int nheap;
+
+// Protects the heap and every Env->env_timer.
+static struct spinlock timer_lock = {
+#ifdef DEBUG_SPINLOCK
+	.name = "timer_lock"
+#endif
+};
+
+// True if deadline a comes before b, allowing for time_msec() wrap.
+static bool
+timer_before(unsigned a, unsigned b)
+{
+	return (int) (a - b) < 0;
+}
+
+static void
+heap_set(int i, struct Timer *t)
+{
+	heap[i] = t;
+	t->idx = i;
+}
+
+static void
+heap_up(int i)
+{
+	struct Timer *t = heap[i];
+
+	while (i > 0 && timer_before(t->deadline, heap[(i - 1) / 2]->deadline)) {
+		heap_set(i, heap[(i - 1) / 2]);
+		i = (i - 1) / 2;
+	}
+	heap_set(i, t);
+}
+
+static void
+heap_down(int i)
+{
+	struct Timer *t = heap[i];
+	int c;
+
+	while ((c = 2 * i + 1) < nheap) {
+		if (c + 1 < nheap &&
+		    timer_before(heap[c + 1]->deadline, heap[c]->deadline))
+			c++;
+		if (!timer_before(heap[c]->deadline, t->deadline))
+			break;
+		heap_set(i, heap[c]);
+		i = c;
+	}
+	heap_set(i, t);
+}
+
+// Take t out of the heap.  The caller frees it after dropping
+// timer_lock.
+static void
+heap_remove(struct Timer *t)
+{
+	struct Timer *last;
+	int i = t->idx;
+
+	if (--nheap != i) {
+		last = heap[nheap];
+		heap_set(i, last);
+		heap_up(i);
+		heap_down(last->idx);
+	}
+	t->env->env_timer = NULL;
+}
+
+void
+timer_init(void)
+{
+	kmem_cache_init(&timer_cache, "timer", sizeof(struct Timer));
+}
+
+// Arrange for 'kind' to happen to e in msec milliseconds, replacing
+// any timer e already has.
+// Returns 0 on success, -E_NO_MEM if out of memory.
+int
+timer_arm(struct Env *e, unsigned msec, int kind, uint32_t value)
+{
+	struct Timer *t, *old;
+
+	if (!(t = kmem_cache_alloc(&timer_cache)))
+		return -E_NO_MEM;
+
+	spin_lock(&timer_lock);
+	if ((old = e->env_timer))
+		heap_remove(old);
+	t->deadline = time_msec() + msec;
+	t->kind = kind;
+	t->env = e;
+	t->envid = e->env_id;
+	t->value = value;
+	e->env_timer = t;
+	heap_set(nheap++, t);
+	heap_up(nheap - 1);
+	spin_unlock(&timer_lock);
+	if (old)
+		kmem_cache_free(&timer_cache, old);
+	return 0;
+}
+
+// Drop e's pending timer, if any.
+void
+timer_cancel(struct Env *e)
+{
+	struct Timer *t;
+
+	spin_lock(&timer_lock);
+	if ((t = e->env_timer))
+		heap_remove(t);
+	spin_unlock(&timer_lock);
+	if (t)
+		kmem_cache_free(&timer_cache, t);
+}
+
+// Returns true if any timer is pending.
+bool
+timer_pending(void)
+{
+	return nheap > 0;
+}
+
+// Store the earliest pending deadline in *deadline.
+// Returns false if no timer is pending.
+bool
+timer_next(unsigned *deadline)
+{
+	bool pending;
+
+	spin_lock(&timer_lock);
+	if ((pending = nheap > 0))
+		*deadline = heap[0]->deadline;
+	spin_unlock(&timer_lock);
+	return pending;
+}
+
+// Fire one expired timer.  Called without timer_lock, since waking
+// the env takes env_lock, and vm_lock for the reference a timed-out
+// futex waiter holds on its page.
+static void
+timer_fire(struct Env *e, envid_t envid, int kind, uint32_t value)
+{
+	spin_lock(&vm_lock);
+	spin_lock(&env_lock);
+	if (e->env_id != envid || e->env_status == ENV_FREE)
+		goto out;
+	if (kind == TIMER_WAKE) {
+		// Only end the block the timer was armed for: the env may
+		// have been woken some other way and blocked again since.
+		if (e->env_status != ENV_NOT_RUNNABLE || !e->env_sleeping)
+			goto out;
+		e->env_sleeping = 0;
+		// A timed-out sys_futex_wait.
+		futex_cancel(e);
+	} else if (e->env_ipc_recving && !e->env_ipc_callee) {
+		e->env_ipc_recving = 0;
+		e->env_ipc_from = 0;
+		e->env_ipc_value = value;
+		e->env_ipc_perm = 0;
+	} else {
+		// Hold it for the env's next sys_ipc_recv.
+		e->env_timer_ipc_pending = 1;
+		e->env_timer_ipc_value = value;
+		goto out;
+	}
+	e->env_tf.tf_regs.reg_eax = 0;
+	e->env_status = ENV_RUNNABLE;
+	sched_enqueue(e);
+out:
+	spin_unlock(&env_lock);
+	spin_unlock(&vm_lock);
+}
+
+// Fire every timer whose deadline has passed.
+// Called from the timer interrupt.
+void
+timer_run(void)
+{
+	unsigned now = time_msec();
+	struct Timer *t;
+	struct Env *e;
+	envid_t envid;
+	int kind;
+	uint32_t value;
+
+	while (nheap > 0 && !timer_before(now, heap[0]->deadline)) {
+		spin_lock(&timer_lock);
+		if (nheap == 0 || timer_before(now, heap[0]->deadline)) {
+			spin_unlock(&timer_lock);
+			break;
+		}
+		t = heap[0];
+		e = t->env;
+		envid = t->envid;
+		kind = t->kind;
+		value = t->value;
+		heap_remove(t);
+		spin_unlock(&timer_lock);
+		kmem_cache_free(&timer_cache, t);
+
+		timer_fire(e, envid, kind, value);
+	}
+}
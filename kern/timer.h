@@ -0,0 +1,33 @@
+#ifndef JOS_KERN_TIMER_H
+#define JOS_KERN_TIMER_H
+#ifndef JOS_KERNEL
+# error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/types.h>
+#include <inc/env.h>
+
+// What to do when a timer fires.
+enum {
+	TIMER_WAKE = 0,		// Make a sleeping env runnable
+	TIMER_IPC,		// Send the env an IPC from envid 0
+};
+
+// A pending timer.  Each env has at most one (Env->env_timer).
+struct Timer {
+	unsigned deadline;	// time_msec() at which to fire
+	int kind;		// TIMER_WAKE or TIMER_IPC
+	struct Env *env;	// Env to wake or send to
+	envid_t envid;		// env's id when armed, in case it is recycled
+	uint32_t value;		// TIMER_IPC: value to deliver
+	int idx;		// Position in the heap
+};
+
+void timer_init(void);
+int timer_arm(struct Env *e, unsigned msec, int kind, uint32_t value);
+void timer_cancel(struct Env *e);
+void timer_run(void);
+bool timer_pending(void);
+bool timer_next(unsigned *deadline);
+
+#endif /* !JOS_KERN_TIMER_H */
@@ -14,10 +14,16 @@
 #include <kern/cpu.h>
 #include <kern/spinlock.h>
 #include <kern/time.h>
+#include <kern/timer.h>
 #include <kern/kpti.h>
 
 static struct Taskstate ts;
 
+// sysenter configuration MSRs
+#define MSR_SYSENTER_CS		0x174
+#define MSR_SYSENTER_ESP	0x175
+#define MSR_SYSENTER_EIP	0x176
+
 /* For debugging, so print_trapframe can distinguish between printing
  * a saved trapframe and printing the current trapframe and print some
  * additional information in the latter case.
@@ -86,7 +92,8 @@ extern void t_align_handler(void);       /* 17 */
 extern void t_mchk_handler(void);        /* 18 */
 extern void t_simderr_handler(void);     /* 19 */
 extern void t_syscall_handler(void);     /* 48 */
-//void sysenter_handler(void);
+extern void sysenter_handler(void);
+extern void sysenter_flags_clean(void);
 
 /* hardware interrupts handler       */
 extern void irq_timer_handler(void);   /* 0 */
@@ -105,6 +112,7 @@ extern void irq_12_handler(void);      /* 12 */
 extern void irq_13_handler(void);      /* 13 */
 extern void irq_ide_handler(void);     /* 14 */
 extern void irq_15_handler(void);      /* 15 */
+extern void irq_resched_handler(void); /* 18 */
 
 
 void
@@ -148,6 +156,7 @@ trap_init(void) {
   SETGATE(idt[IRQ_OFFSET + 13], 0, GD_KT, irq_13_handler, 0);
   SETGATE(idt[IRQ_OFFSET + IRQ_IDE], 0, GD_KT, irq_ide_handler, 0);
   SETGATE(idt[IRQ_OFFSET + 15], 0, GD_KT, irq_15_handler, 0);
+  SETGATE(idt[IRQ_OFFSET + IRQ_RESCHED], 0, GD_KT, irq_resched_handler, 0);
 
   /* syscall */
   SETGATE(idt[T_SYSCALL], 0, GD_KT, t_syscall_handler, 3);
@@ -196,6 +205,13 @@ trap_init_percpu(void) {
 
   ltr(GD_TSS0 + (i << 3));
 
+  // sysenter enters at sysenter_handler on the same stack as ts_esp0.
+  // sysexit returns to GD_KT + 16 and GD_KT + 24, which are GD_UT and
+  // GD_UD.
+  wrmsr(MSR_SYSENTER_CS, GD_KT, 0);
+  wrmsr(MSR_SYSENTER_ESP, cpu_ts->ts_esp0, 0);
+  wrmsr(MSR_SYSENTER_EIP, (uint32_t) sysenter_handler, 0);
+
   // Load the IDT
   lidt(&idt_pd);
 }
@@ -271,11 +287,17 @@ trap_dispatch(struct Trapframe *tf) {
       // Handle clock interrupts. Don't forget to acknowledge the
       // interrupt using lapic_eoi() before calling the scheduler!
       // LAB 4: Your code here.
-      time_tick();
+      timer_run();
+      sched_arm_timer(0);
       lapic_eoi();
       sched_yield();
     }
 
+    case IRQ_OFFSET + IRQ_RESCHED:
+      // Another CPU queued work for us while we were halted.
+      lapic_eoi();
+      sched_yield();
+
     case IRQ_OFFSET + IRQ_SPURIOUS:
       // Handle spurious interrupts
       // The hardware sometimes raises these because of noise on the
@@ -315,6 +337,18 @@ trap_dispatch(struct Trapframe *tf) {
   }
 }
 
+// Free curenv if another CPU marked it ENV_DYING, and pick
+// something else to run.
+static void
+reap_curenv(void) {
+  if (curenv && curenv->env_status == ENV_DYING) {
+    lock_kernel_lazy();
+    env_free(curenv);
+    curenv = NULL;
+    sched_yield();
+  }
+}
+
 void
 trap(struct Trapframe *tf) {
   // The environment may have set DF and some versions
@@ -328,8 +362,11 @@ trap(struct Trapframe *tf) {
 
   // Re-acqurie the big kernel lock if we were halted in
   // sched_yield()
-  if (xchg(&thiscpu->cpu_status, CPU_STARTED) == CPU_HALTED)
+  if (xchg(&thiscpu->cpu_status, CPU_STARTED) == CPU_HALTED) {
     lock_kernel();
+    // sched_halt() stopped our timer; resume preemption.
+    sched_arm_timer(0);
+  }
   // Check that interrupts are disabled.  If this assertion
   // fails, DO NOT be tempted to fix it by inserting a "cli" in
   // the interrupt path.
@@ -338,17 +375,15 @@ trap(struct Trapframe *tf) {
   if ((tf->tf_cs & 3) == 3) {
     // Trapped from user mode.
     // Acquire the big kernel lock before doing any
-    // serious kernel work.
+    // serious kernel work.  Syscalls that synchronize with finer
+    // locks skip it (see kern/spinlock.h).
     // LAB 4: Your code here.
     assert(curenv);
-    lock_kernel();
+    if (tf->tf_trapno != T_SYSCALL || !syscall_nolock(tf->tf_regs.reg_eax))
+      lock_kernel();
 
     // Garbage collect if current enviroment is a zombie
-    if (curenv->env_status == ENV_DYING) {
-      env_free(curenv);
-      curenv = NULL;
-      sched_yield();
-    }
+    reap_curenv();
 
     // Copy trap frame (which is currently on the stack)
     // into 'curenv->env_tf', so that running the environment
@@ -365,15 +400,48 @@ trap(struct Trapframe *tf) {
   // Dispatch based on what type of trap occurred
   trap_dispatch(tf);
 
+  // Another CPU may have killed us while we ran without the big
+  // kernel lock.
+  reap_curenv();
+
   // If we made it to this point, then no other environment was
   // scheduled, so we should return to the current environment
-  // if doing so makes sense.
-  if (curenv && curenv->env_status == ENV_RUNNING)
+  // if doing so makes sense, and if an IPC did not hand this CPU
+  // to its receiver.
+  if (curenv && curenv->env_status == ENV_RUNNING && !thiscpu->cpu_handoff)
     env_run(curenv);
   else
     sched_yield();
 }
 
+// The sysenter fast path.  Syscalls that syscall_sysenter() accepts run
+// straight off the frame sysenter_handler built, without taking the big
+// kernel lock or copying the frame into curenv->env_tf, and return to
+// sysenter_handler for sysexit.  Anything else goes through trap(),
+// which treats the frame like one from int $T_SYSCALL and returns to
+// the user with iret.
+void
+sysenter_dispatch(struct Trapframe *tf) {
+  struct PushRegs *regs = &tf->tf_regs;
+
+  asm volatile("cld":: : "cc");
+
+  extern char *panicstr;
+  if (panicstr || !syscall_sysenter(regs->reg_eax))
+    trap(tf);
+
+  regs->reg_eax = syscall(regs->reg_eax, regs->reg_edx, regs->reg_ecx,
+                          regs->reg_ebx, regs->reg_edi, 0);
+
+  // Another CPU may have killed or stopped us meanwhile, or an IPC
+  // handed this CPU to its receiver; leave through the scheduler as
+  // trap() would.
+  if (curenv->env_status != ENV_RUNNING || thiscpu->cpu_handoff) {
+    curenv->env_tf = *tf;
+    reap_curenv();
+    sched_yield();
+  }
+}
 
 void
 page_fault_handler(struct Trapframe *tf) {
@@ -420,6 +488,10 @@ page_fault_handler(struct Trapframe *tf) {
 
   // LAB 4: Your code here.
 
+  // Resolve copy-on-write faults here rather than in the upcall.
+  if ((tf->tf_err & FEC_WR) && page_cow_fault(curenv, (void *) fault_va) == 0)
+    return;
+
   if (curenv->env_pgfault_upcall) {
     // get the utf ptr
     struct UTrapframe *utf = (struct UTrapframe *)
@@ -453,6 +525,16 @@ page_fault_handler(struct Trapframe *tf) {
 
 __user_mapped_text void
 switch_and_trap(struct Trapframe *frame) {
+  // A user who enters with TF set takes a single-step trap inside
+  // sysenter_handler before it loads clean flags, still on the user
+  // page table.  Drop TF and let the handler carry on.
+  if (frame->tf_trapno == T_DEBUG && (frame->tf_cs & 3) == 0 &&
+      frame->tf_eip > (uintptr_t) sysenter_handler &&
+      frame->tf_eip <= (uintptr_t) sysenter_flags_clean) {
+    frame->tf_eflags &= ~FL_TF;
+    return;
+  }
+
   // LAB7: Your code here
   if ((frame->tf_cs & 3) == 3) {
 
@@ -463,6 +545,23 @@ switch_and_trap(struct Trapframe *frame) {
     // Load the physical address of kernel page table
     // Switch to the kernel page table
     lcr3(PADDR(e->env_kern_pgdir));
+
+    // iret to user mode nulled GS; point it back at our CpuInfo
+    asm volatile("movw %%ax,%%gs" : : "a" (GD_CPU0 + (cpunum << 3)));
   }
   trap(frame);
 }
+
+// Like switch_and_trap(), for sysenter_handler.  Returns the physical
+// address of the user page directory to reload before sysexit.
+__user_mapped_text uint32_t
+sysenter_trap(struct Trapframe *frame) {
+  int cpunum = (KERNBASE - (uintptr_t) (frame - 1)) / (KSTKSIZE + KSTKGAP);
+  struct Env *e = cpus[cpunum].cpu_env;
+
+  lcr3(PADDR(e->env_kern_pgdir));
+  asm volatile("movw %%ax,%%gs" : : "a" (GD_CPU0 + (cpunum << 3)));
+
+  sysenter_dispatch(frame);
+  return PADDR(e->env_pgdir);
+}
@@ -174,7 +174,7 @@ close_all(void)
 int
 dup(int oldfdnum, int newfdnum)
 {
-	int r;
+	int r, i;
 	char *ova, *nva;
 	pte_t pte;
 	struct Fd *oldfd, *newfd;
@@ -187,9 +187,14 @@ dup(int oldfdnum, int newfdnum)
 	ova = fd2data(oldfd);
 	nva = fd2data(newfd);
 
-	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
-		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
-			goto err;
+	// Share every page of the old fd's data (a pipe has several).
+	if (uvpd[PDX(ova)] & PTE_P)
+		for (i = 0; i < PTSIZE; i += PGSIZE) {
+			pte = uvpt[PGNUM(ova + i)];
+			if ((pte & PTE_P)
+			    && (r = sys_page_map(0, ova + i, 0, nva + i, pte & PTE_SYSCALL)) < 0)
+				goto err;
+		}
 	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
 		goto err;
 
@@ -197,7 +202,9 @@ dup(int oldfdnum, int newfdnum)
 
 err:
 	sys_page_unmap(0, newfd);
-	sys_page_unmap(0, nva);
+	for (i = 0; i < PTSIZE; i += PGSIZE)
+		if ((uvpd[PDX(nva)] & PTE_P) && (uvpt[PGNUM(nva + i)] & PTE_P))
+			sys_page_unmap(0, nva + i);
 	return r;
 }
 
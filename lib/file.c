@@ -6,6 +6,24 @@
 
 union Fsipc fsipcbuf __attribute__((aligned(PGSIZE)));
 
+// Window of IPC_MAXPAGES pages, just below the file descriptor table,
+// through which large reads and writes move their data.  Its pages
+// stay mapped until the next large transfer replaces them.
+#define FSWINDOW  0xCFF00000
+
+static envid_t fsenv;
+
+// Send request 'type' with the pages at 'srcva' (see IPC_PAGES) to
+// the file server, and wait for a reply, receiving any reply pages
+// at 'dstva'.  Returns result from the file server.
+static int
+fsipc_pages(unsigned type, void *srcva, void *dstva) {
+  if (fsenv == 0)
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+
+  return ipc_call(fsenv, type, srcva, PTE_P | PTE_W | PTE_U, dstva, NULL);
+}
+
 // Send an inter-environment request to the file server, and wait for
 // a reply.  The request body should be in fsipcbuf, and parts of the
 // response may be written back to fsipcbuf.
@@ -14,17 +32,31 @@ union Fsipc fsipcbuf __attribute__((aligned(PGSIZE)));
 // Returns result from the file server.
 static int
 fsipc(unsigned type, void *dstva) {
-  static envid_t fsenv;
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  return fsipc_pages(type, &fsipcbuf, dstva);
+}
+
+// Like fsipc, for the small requests whose 'n'-byte body 'req' fits
+// in the IPC message registers and whose reply is just the value.
+// Nothing is mapped or unmapped on either side.
+static int
+fsipc_small(unsigned type, const void *req, size_t n) {
+  uint32_t mr[IPC_NMR];
+
   if (fsenv == 0)
     fsenv = ipc_find_env(ENV_TYPE_FS);
 
-  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  assert(n <= sizeof(mr));
+  memmove(mr, req, n);
 
   if (debug)
-    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+    cprintf("[%08x] fsipc_small %d %08x\n", thisenv->env_id, type, mr[0]);
 
-  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
-  return ipc_recv(NULL, dstva, NULL);
+  return ipc_call(fsenv, type, mr, IPC_MR, NULL, NULL);
 }
 
 static int devfile_flush(struct Fd *fd);
@@ -96,8 +128,28 @@ open(const char *path, int mode) {
 // to disk.
 static int
 devfile_flush(struct Fd *fd) {
-  fsipcbuf.flush.req_fileid = fd->fd_file.id;
-  return fsipc(FSREQ_FLUSH, NULL);
+  struct Fsreq_flush req = { .req_fileid = fd->fd_file.id };
+
+  return fsipc_small(FSREQ_FLUSH, &req, sizeof(req));
+}
+
+// Read at most 'n' bytes, and at most IPC_MAXPAGES pages, from 'fd'
+// into 'buf' with one request.  The file server sends the data back
+// as pages mapped at FSWINDOW.
+static ssize_t
+devfile_read_pages(struct Fd *fd, void *buf, size_t n) {
+  size_t npages;
+  int r;
+
+  n = MIN(n, IPC_MAXPAGES * PGSIZE);
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  fsipcbuf.read.req_n = n;
+  if ((r = fsipc(FSREQ_READ, IPC_PAGES(FSWINDOW, npages))) < 0)
+    return r;
+  assert(r <= n);
+  memmove(buf, (void *) FSWINDOW, r);
+  return r;
 }
 
 // Read at most 'n' bytes from 'fd' at the current position into 'buf'.
@@ -113,6 +165,9 @@ devfile_read(struct Fd *fd, void *buf, size_t n) {
   // system server.
   int r;
 
+  if (n > sizeof(fsipcbuf.readRet.ret_buf))
+    return devfile_read_pages(fd, buf, n);
+
   fsipcbuf.read.req_fileid = fd->fd_file.id;
   fsipcbuf.read.req_n = n;
   if ((r = fsipc(FSREQ_READ, NULL)) < 0)
@@ -124,6 +179,36 @@ devfile_read(struct Fd *fd, void *buf, size_t n) {
 }
 
 
+// Write at most 'n' bytes, and at most IPC_MAXPAGES - 1 pages, from
+// 'buf' to 'fd' with one request.  The request goes in the first page
+// at FSWINDOW and the data in the pages after it.  Pages already
+// mapped there by earlier requests are reused and any missing ones
+// are mapped with one call; the server only reads them while this
+// request is in progress.
+static ssize_t
+devfile_write_pages(struct Fd *fd, const void *buf, size_t n) {
+  struct Fsreq_write *req = (struct Fsreq_write *) FSWINDOW;
+  size_t npages, i;
+  uintptr_t va;
+  int r;
+
+  n = MIN(n, (IPC_MAXPAGES - 1) * PGSIZE);
+  npages = 1 + ROUNDUP(n, PGSIZE) / PGSIZE;
+  for (i = 0; i < npages; i++) {
+    va = FSWINDOW + i * PGSIZE;
+    if (!(uvpd[PDX(va)] & PTE_P) || !(uvpt[PGNUM(va)] & PTE_P))
+      break;
+  }
+  if (i < npages
+      && (r = sys_page_alloc_range(0, (void *) (FSWINDOW + i * PGSIZE),
+                                   npages - i, PTE_P | PTE_U | PTE_W)) < 0)
+    return r;
+  req->req_fileid = fd->fd_file.id;
+  req->req_n = n;
+  memmove((void *) (FSWINDOW + PGSIZE), buf, n);
+  return fsipc_pages(FSREQ_WRITE, IPC_PAGES(FSWINDOW, npages), NULL);
+}
+
 // Write at most 'n' bytes from 'buf' to 'fd' at the current seek position.
 //
 // Returns:
@@ -137,6 +222,9 @@ devfile_write(struct Fd *fd, const void *buf, size_t n) {
   // bytes than requested.
   // LAB 5: Your code here
 
+  if (n > sizeof(fsipcbuf.write.req_buf))
+    return devfile_write_pages(fd, buf, n);
+
   fsipcbuf.write.req_fileid = fd->fd_file.id;
   fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
   memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
@@ -160,9 +248,12 @@ devfile_stat(struct Fd *fd, struct Stat *st) {
 // Truncate or extend an open file to 'size' bytes
 static int
 devfile_trunc(struct Fd *fd, off_t newsize) {
-  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
-  fsipcbuf.set_size.req_size = newsize;
-  return fsipc(FSREQ_SET_SIZE, NULL);
+  struct Fsreq_set_size req = {
+    .req_fileid = fd->fd_file.id,
+    .req_size = newsize
+  };
+
+  return fsipc_small(FSREQ_SET_SIZE, &req, sizeof(req));
 }
 
 
@@ -172,6 +263,6 @@ sync(void) {
   // Ask the file server to update the disk
   // by writing any dirty blocks in the buffer cache.
 
-  return fsipc(FSREQ_SYNC, NULL);
+  return fsipc_small(FSREQ_SYNC, NULL, 0);
 }
 
@@ -1,7 +1,6 @@
 // User-level IPC library routines
 
 #include <inc/lib.h>
-#include <inc/challenge.h>
 
 // Receive a value via IPC and return it.
 // If 'pg' is nonnull, then any page sent by the sender will be mapped at
@@ -34,34 +33,65 @@ ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
 }
 
 // Send 'val' (and 'pg' with 'perm', if 'pg' is nonnull) to 'toenv'.
-// This function keeps trying until it succeeds.
-// It should panic() on any error other than -E_IPC_NOT_RECV.
+// If 'toenv' is not receiving, sleep in the kernel, queued behind any
+// other senders, until it is.
+// It should panic() on any error.
 //
 // Hint:
-//   Use sys_yield() to be CPU-friendly.
-//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   If 'pg' is null, pass sys_ipc_send a value that it will understand
 //   as meaning "no page".  (Zero is not the right value.)
 void
 ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
   int r;
-  void *va = pg ? pg : (void *) UTOP;
 
-#ifdef CHALLENGE_LAB4
-  if ((r = sys_ipc_try_send(to_env, val, va, perm))) {
-    if (r != -E_IPC_NOT_RECV)
-      panic("ipc_send: %e", r);
-    r = sys_ipc_try_send(to_env, val, va, perm);
-    if (r) panic("sys_ipc_try_send failed");
-  }
+  if ((r = sys_ipc_send(to_env, val, pg ? pg : (void *) UTOP, perm)))
+    panic("ipc_send: %e", r);
+}
+
+// Send 'val' (and 'pg' with 'perm', if 'pg' is nonnull) to 'to_env',
+// as ipc_send does, and wait for its reply, as ipc_recv does.  Only
+// 'to_env' can reply, and the kernel switches this CPU directly to
+// 'to_env' and back.
+// If 'rcv_pg' is nonnull, a page sent with the reply is mapped there,
+// and 'perm_store' (if nonnull) gets its permission.
+// If 'to_env' is busy, the call waits its turn as ipc_send does.
+// Returns the reply's value; panics on error.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+         void *rcv_pg, int *perm_store) {
+  int r;
+
+  if ((r = sys_ipc_call(to_env, val, pg ? pg : (void *) UTOP, perm,
+                        rcv_pg ? rcv_pg : (void *) UTOP)))
+    panic("ipc_call: %e", r);
+  if (perm_store)
+    *perm_store = thisenv->env_ipc_perm;
+  return thisenv->env_ipc_value;
+}
 
-#else
-  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
-    if (r != -E_IPC_NOT_RECV)
-      panic("ipc_send: %e", r);
-    sys_yield();
+// Reply 'val' (and 'pg' with 'perm', if 'pg' is nonnull) to 'to_env',
+// unless 'to_env' is 0, then receive the next request as ipc_recv
+// does, with one system call.  If 'to_env' was not waiting for the
+// reply in ipc_call, fall back to ipc_send and ipc_recv; if the reply
+// cannot be sent at all (say 'to_env' has exited), drop it.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, int perm,
+               envid_t *from_env_store, void *rcv_pg, int *perm_store) {
+  int r = sys_ipc_reply_recv(to_env, val, pg ? pg : (void *) UTOP, perm,
+                             rcv_pg ? rcv_pg : (void *) UTOP);
+
+  if (r < 0 && to_env) {
+    if (r == -E_IPC_NOT_RECV)
+      ipc_send(to_env, val, pg, perm);
+    return ipc_recv(from_env_store, rcv_pg, perm_store);
   }
 
-#endif
+  if (from_env_store)
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  if (perm_store)
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+
+  return r ? r : thisenv->env_ipc_value;
 }
 
 // Find the first environment of the given type.  We'll use this to
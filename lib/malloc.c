@@ -41,7 +41,7 @@ isfree(void *v, size_t n)
 void*
 malloc(size_t n)
 {
-	int i, cont;
+	size_t npages;
 	int nwrap;
 	uint32_t *ref;
 	void *v;
@@ -95,16 +95,14 @@ malloc(size_t n)
 	/*
 	 * allocate at mptr - the +4 makes sure we allocate a ref count.
 	 */
-	for (i = 0; i < n + 4; i += PGSIZE){
-		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
-		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
-			for (; i >= 0; i -= PGSIZE)
-				sys_page_unmap(0, mptr + i);
-			return 0;	/* out of physical memory */
-		}
+	npages = ROUNDUP(n + 4, PGSIZE) / PGSIZE;
+	if (sys_page_alloc_range(0, mptr, npages - 1, PTE_P|PTE_U|PTE_W|PTE_CONTINUED) < 0
+	    || sys_page_alloc(0, mptr + (npages - 1) * PGSIZE, PTE_P|PTE_U|PTE_W) < 0) {
+		sys_page_unmap_range(0, mptr, npages);
+		return 0;	/* out of physical memory */
 	}
 
-	ref = (uint32_t*) (mptr + i - 4);
+	ref = (uint32_t*) (mptr + npages * PGSIZE - 4);
 	*ref = 2;	/* reference for mptr, reference for returned block */
 	v = mptr;
 	mptr += n;
@@ -116,6 +114,7 @@ free(void *v)
 {
 	uint8_t *c;
 	uint32_t *ref;
+	size_t n;
 
 	if (v == 0)
 		return;
@@ -123,10 +122,11 @@ free(void *v)
 
 	c = ROUNDDOWN(v, PGSIZE);
 
-	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
-		sys_page_unmap(0, c);
-		c += PGSIZE;
-		assert(mbegin <= c && c < mend);
+	for (n = 0; uvpt[PGNUM(c + n * PGSIZE)] & PTE_CONTINUED; n++)
+		assert(mbegin <= c + (n + 1) * PGSIZE && c + (n + 1) * PGSIZE < mend);
+	if (n) {
+		sys_page_unmap_range(0, c, n);
+		c += n * PGSIZE;
 	}
 
 	/*
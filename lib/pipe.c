@@ -1,4 +1,5 @@
 #include <inc/lib.h>
+#include <inc/x86.h>
 
 #define debug 0
 
@@ -17,20 +18,41 @@ struct Dev devpipe =
 	.dev_stat =	devpipe_stat,
 };
 
-#define PIPEBUFSIZ 32		// small to provoke races
+// The pipe's control words fill the first page and the ring buffer
+// the pages after it, all mapped PTE_SHARE at fd2data() of each end.
+// PIPEBUFSIZ must be a power of two, so positions can wrap.
+#define PIPE_NPAGES 5
+#define PIPEBUFSIZ ((PIPE_NPAGES - 1) * PGSIZE)
 
+// Readers sleep on p_rseq and writers on p_wseq (see sys_futex_wait),
+// after setting p_rwait or p_wwait so the other side knows to bump
+// the sequence word and wake them.  devpipe_close bumps and wakes
+// both once its reference counts have dropped, so a sleeper always
+// sees a close without polling.
 struct Pipe {
-	off_t p_rpos;		// read position
-	off_t p_wpos;		// write position
+	volatile uint32_t p_rpos;	// read position
+	volatile uint32_t p_wpos;	// write position
+	volatile uint32_t p_rwait;	// a reader may be asleep on p_rseq
+	volatile uint32_t p_wwait;	// a writer may be asleep on p_wseq
+	volatile uint32_t p_rseq;	// bumped to wake readers
+	volatile uint32_t p_wseq;	// bumped to wake writers
+	uint8_t p_pad[PGSIZE - 6 * sizeof(uint32_t)];
 	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
 };
 
+// Keep the compiler from moving buffer accesses across a position
+// update; x86 already keeps the stores, and the loads, in order.
+#define pipe_barrier() asm volatile("" : : : "memory")
+
 int
 pipe(int pfd[2])
 {
-	int r;
+	int r, i;
 	struct Fd *fd0, *fd1;
-	void *va;
+	char *va;
+
+	static_assert(sizeof(struct Pipe) == PIPE_NPAGES * PGSIZE);
+	static_assert((PIPEBUFSIZ & (PIPEBUFSIZ - 1)) == 0);
 
 	// allocate the file descriptor table entries
 	if ((r = fd_alloc(&fd0)) < 0
@@ -41,12 +63,15 @@ pipe(int pfd[2])
 	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
 		goto err1;
 
-	// allocate the pipe structure as first data page in both
+	// allocate the pipe structure as the first data pages in both
 	va = fd2data(fd0);
-	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
-		goto err2;
-	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
-		goto err3;
+	for (i = 0; i < PIPE_NPAGES; i++) {
+		if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+			goto err3;
+		if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+				      PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+			goto err3;
+	}
 
 	// set up fd structures
 	fd0->fd_dev_id = devpipe.dev_id;
@@ -63,7 +88,10 @@ pipe(int pfd[2])
 	return 0;
 
     err3:
-	sys_page_unmap(0, va);
+	for (i = 0; i < PIPE_NPAGES; i++) {
+		sys_page_unmap(0, va + i * PGSIZE);
+		sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+	}
     err2:
 	sys_page_unmap(0, fd1);
     err1:
@@ -72,6 +100,9 @@ pipe(int pfd[2])
 	return r;
 }
 
+// The other end is closed once every reference to the pipe's first
+// buffer page comes from holders of fd.  devpipe_close drops that
+// page after its fd page, and before it wakes sleepers.
 static int
 _pipeisclosed(struct Fd *fd, struct Pipe *p)
 {
@@ -79,7 +110,7 @@ _pipeisclosed(struct Fd *fd, struct Pipe *p)
 
 	while (1) {
 		n = thisenv->env_runs;
-		ret = pageref(fd) == pageref(p);
+		ret = pageref(fd) == pageref(p->p_buf);
 		nn = thisenv->env_runs;
 		if (n == nn)
 			return ret;
@@ -105,7 +136,8 @@ static ssize_t
 devpipe_read(struct Fd *fd, void *vbuf, size_t n)
 {
 	uint8_t *buf;
-	size_t i;
+	uint32_t rpos, off, seq;
+	size_t m;
 	struct Pipe *p;
 
 	p = (struct Pipe*)fd2data(fd);
@@ -113,34 +145,49 @@ devpipe_read(struct Fd *fd, void *vbuf, size_t n)
 		cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
 			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
 
+	if (n == 0)
+		return 0;
+	while ((rpos = p->p_rpos) == p->p_wpos) {
+		// pipe is empty
+		// ask to be woken, then look once more: if all the
+		// writers are gone, note eof, else sleep until a writer
+		// moves wpos or closes
+		seq = p->p_rseq;
+		xchg(&p->p_rwait, 1);
+		if (p->p_wpos != rpos)
+			break;
+		if (_pipeisclosed(fd, p))
+			return 0;
+		if (debug)
+			cprintf("devpipe_read wait\n");
+		sys_futex_wait(&p->p_rseq, seq, 0);
+	}
+
+	// take whatever is there, in at most two spans around the end
+	// of the ring.  wait to advance rpos until the bytes are taken!
+	n = MIN(n, p->p_wpos - rpos);
+	pipe_barrier();
 	buf = vbuf;
-	for (i = 0; i < n; i++) {
-		while (p->p_rpos == p->p_wpos) {
-			// pipe is empty
-			// if we got any data, return it
-			if (i > 0)
-				return i;
-			// if all the writers are gone, note eof
-			if (_pipeisclosed(fd, p))
-				return 0;
-			// yield and see what happens
-			if (debug)
-				cprintf("devpipe_read yield\n");
-			sys_yield();
-		}
-		// there's a byte.  take it.
-		// wait to increment rpos until the byte is taken!
-		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
-		p->p_rpos++;
+	off = rpos % PIPEBUFSIZ;
+	m = MIN(n, PIPEBUFSIZ - off);
+	memmove(buf, p->p_buf + off, m);
+	memmove(buf + m, p->p_buf, n - m);
+	pipe_barrier();
+	p->p_rpos = rpos + n;
+
+	if (xchg(&p->p_wwait, 0)) {
+		xadd(&p->p_wseq, 1);
+		sys_futex_wake(&p->p_wseq, NENV);
 	}
-	return i;
+	return n;
 }
 
 static ssize_t
 devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
 {
 	const uint8_t *buf;
-	size_t i;
+	uint32_t wpos, off, seq;
+	size_t i, m, k;
 	struct Pipe *p;
 
 	p = (struct Pipe*) fd2data(fd);
@@ -149,23 +196,38 @@ devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
 			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
 
 	buf = vbuf;
-	for (i = 0; i < n; i++) {
-		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+	for (i = 0; i < n; i += m) {
+		while ((wpos = p->p_wpos) - p->p_rpos == PIPEBUFSIZ) {
 			// pipe is full
-			// if all the readers are gone
-			// (it's only writers like us now),
-			// note eof
+			// ask to be woken, then look once more: if all
+			// the readers are gone (it's only writers like us
+			// now), note eof, else sleep until a reader moves
+			// rpos or closes
+			seq = p->p_wseq;
+			xchg(&p->p_wwait, 1);
+			if (p->p_rpos != wpos - PIPEBUFSIZ)
+				continue;
 			if (_pipeisclosed(fd, p))
 				return 0;
-			// yield and see what happens
 			if (debug)
-				cprintf("devpipe_write yield\n");
-			sys_yield();
+				cprintf("devpipe_write wait\n");
+			sys_futex_wait(&p->p_wseq, seq, 0);
+		}
+
+		// fill as much room as there is, in at most two spans.
+		// wait to advance wpos until the bytes are stored!
+		m = MIN(n - i, PIPEBUFSIZ - (wpos - p->p_rpos));
+		off = wpos % PIPEBUFSIZ;
+		k = MIN(m, PIPEBUFSIZ - off);
+		memmove(p->p_buf + off, buf + i, k);
+		memmove(p->p_buf, buf + i + k, m - k);
+		pipe_barrier();
+		p->p_wpos = wpos + m;
+
+		if (xchg(&p->p_rwait, 0)) {
+			xadd(&p->p_rseq, 1);
+			sys_futex_wake(&p->p_rseq, NENV);
 		}
-		// there's room for a byte.  store it.
-		// wait to increment wpos until the byte is stored!
-		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
-		p->p_wpos++;
 	}
 
 	return i;
@@ -185,7 +247,21 @@ devpipe_stat(struct Fd *fd, struct Stat *stat)
 static int
 devpipe_close(struct Fd *fd)
 {
+	struct Pipe *p = (struct Pipe *) fd2data(fd);
+	char *va = (char *) p;
+	int i;
+
+	// the fd page goes before the buffer pages, and the first
+	// buffer page, whose refs _pipeisclosed counts, goes last of
+	// those.  then wake any sleepers on either side to look again,
+	// while the header page is still mapped.
 	(void) sys_page_unmap(0, fd);
-	return sys_page_unmap(0, fd2data(fd));
+	for (i = PIPE_NPAGES - 1; i > 0; i--)
+		(void) sys_page_unmap(0, va + i * PGSIZE);
+	xadd(&p->p_rseq, 1);
+	xadd(&p->p_wseq, 1);
+	sys_futex_wake(&p->p_rseq, NENV);
+	sys_futex_wake(&p->p_wseq, NENV);
+	return sys_page_unmap(0, va);
 }
 
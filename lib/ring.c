@@ -0,0 +1,47 @@
+// Submitting syscalls through a syscall ring (see inc/ring.h).
+
+#include <inc/lib.h>
+
+// Queue syscall 'num' with the given arguments on ring r.  Its
+// completion will carry 'data'.  Nothing runs until sys_ring_enter(),
+// or an idle CPU picks it up for a RING_POLL ring.
+//
+// Returns 0 on success, -E_NO_MEM if the submission queue is full.
+int
+ring_submit(struct SyscallRing *r, uint32_t data, uint32_t num,
+	    uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
+{
+	uint32_t tail = r->sq_tail;
+	struct RingSqe *sqe;
+
+	if (tail - r->sq_head >= RING_NSQE)
+		return -E_NO_MEM;
+	sqe = &r->sq[tail % RING_NSQE];
+	sqe->sqe_num = num;
+	sqe->sqe_args[0] = a1;
+	sqe->sqe_args[1] = a2;
+	sqe->sqe_args[2] = a3;
+	sqe->sqe_args[3] = a4;
+	sqe->sqe_args[4] = a5;
+	sqe->sqe_data = data;
+	// Publish the entry only once it is filled in.
+	asm volatile("" : : : "memory");
+	r->sq_tail = tail + 1;
+	return 0;
+}
+
+// Take the oldest completion from ring r into *cqe.
+// Returns 1 if there was one, 0 if the completion queue is empty.
+int
+ring_complete(struct SyscallRing *r, struct RingCqe *cqe)
+{
+	uint32_t head = r->cq_head;
+
+	if (head == r->cq_tail)
+		return 0;
+	asm volatile("" : : : "memory");
+	*cqe = r->cq[head % RING_NCQE];
+	asm volatile("" : : : "memory");
+	r->cq_head = head + 1;
+	return 1;
+}
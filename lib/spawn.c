@@ -5,6 +5,8 @@
 #define UTEMP2USTACK(addr)  ((void*) (addr) + (USTACKTOP - PGSIZE) - UTEMP)
 #define UTEMP2      (UTEMP + PGSIZE)
 #define UTEMP3      (UTEMP2 + PGSIZE)
+// The pages from UTEMP up to PFTEMP, for reading segments in.
+#define SEGWINDOW   (PTSIZE - PGSIZE)
 
 // Helper functions for spawn.
 static int init_stack(envid_t child, const char **argv, uintptr_t *init_esp);
@@ -359,8 +361,7 @@ init_stack(envid_t child, const char **argv, uintptr_t *init_esp) {
 static int
 map_segment(envid_t child, uintptr_t va, size_t memsz,
             int fd, size_t filesz, off_t fileoffset, int perm) {
-  int i, r;
-  void *blk;
+  int i, r, n;
 
   //cprintf("map_segment %x+%x\n", va, memsz);
 
@@ -371,24 +372,24 @@ map_segment(envid_t child, uintptr_t va, size_t memsz,
     fileoffset -= i;
   }
 
-  for (i = 0; i < memsz; i += PGSIZE) {
-    if (i >= filesz) {
-      // allocate a blank page
-      if ((r = sys_page_alloc(child, (void *) (va + i), perm)) < 0)
-        return r;
-    } else {
-      // from file
-      if ((r = sys_page_alloc(0, UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
-        return r;
-      if ((r = seek(fd, fileoffset + i)) < 0)
-        return r;
-      if ((r = readn(fd, UTEMP, MIN(PGSIZE, filesz - i))) < 0)
-        return r;
-      if ((r = sys_page_map(0, UTEMP, child, (void *) (va + i), perm)) < 0)
-        panic("spawn: sys_page_map data: %e", r);
-      sys_page_unmap(0, UTEMP);
-    }
+  // Read the file-backed pages a window's worth at a time at UTEMP,
+  // then hand them to the child, and allocate the rest in one go.
+  for (i = 0; i < filesz; i += n * PGSIZE) {
+    n = MIN(ROUNDUP(filesz - i, PGSIZE), SEGWINDOW) / PGSIZE;
+    if ((r = sys_page_alloc_range(0, UTEMP, n, PTE_P | PTE_U | PTE_W)) < 0)
+      return r;
+    if ((r = seek(fd, fileoffset + i)) < 0)
+      return r;
+    if ((r = readn(fd, UTEMP, MIN(n * PGSIZE, filesz - i))) < 0)
+      return r;
+    if ((r = sys_page_map_range(0, UTEMP, child, (void *) (va + i), n, perm)) < 0)
+      panic("spawn: sys_page_map_range data: %e", r);
+    sys_page_unmap_range(0, UTEMP, n);
   }
+  if (i < memsz
+      && (r = sys_page_alloc_range(child, (void *) (va + i),
+                                   (ROUNDUP(memsz, PGSIZE) - i) / PGSIZE, perm)) < 0)
+    return r;
   return 0;
 }
 
@@ -399,13 +400,26 @@ copy_shared_pages(envid_t child) {
   int r;
   unsigned perm = PTE_P | PTE_U | PTE_SHARE;
 
-  uintptr_t addr;
-  for (addr = 0; addr < UTOP; addr += PGSIZE)
-    if ((uvpd[PDX(addr)] & PTE_P) && (uvpt[PGNUM(addr)] & perm) == perm) {
-      if ((r = sys_page_map(0, (void *) addr, child, (void *) addr, uvpt[PGNUM(addr)] & PTE_SYSCALL)) < 0) {
-        panic("copy_shared_pages : sys_page_map: %e\n", r);
-      }
+  uintptr_t addr, end;
+  pte_t pte;
+
+  // Map each run of shared pages with the same permissions at once.
+  for (addr = 0; addr < UTOP; addr = end) {
+    end = addr + PGSIZE;
+    if (!(uvpd[PDX(addr)] & PTE_P)) {
+      end = ROUNDUP(end, PTSIZE);
+      continue;
     }
+    pte = uvpt[PGNUM(addr)];
+    if ((pte & perm) != perm)
+      continue;
+    while (end < UTOP && (uvpd[PDX(end)] & PTE_P)
+           && (uvpt[PGNUM(end)] & (PTE_SYSCALL | PTE_P)) == (pte & (PTE_SYSCALL | PTE_P)))
+      end += PGSIZE;
+    if ((r = sys_page_map_range(0, (void *) addr, child, (void *) addr,
+                                (end - addr) / PGSIZE, pte & PTE_SYSCALL)) < 0)
+      panic("copy_shared_pages : sys_page_map_range: %e\n", r);
+  }
   return 0;
 }
 
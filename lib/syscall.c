@@ -8,7 +8,7 @@ static inline int32_t
 syscall(int num, int check, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5) {
   int32_t ret;
 
-  /* Generic system call: pass system call number in AX,
+  // Generic system call: pass system call number in AX,
   // up to five parameters in DX, CX, BX, DI, SI.
   // Interrupt kernel with T_SYSCALL.
   //
@@ -19,44 +19,34 @@ syscall(int num, int check, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4,
   // The last clause tells the assembler that this can
   // potentially change the condition codes and arbitrary
   // memory locations.
-
-  // asm volatile(
-  // "pushl %%ecx\n\t"
-  // "pushl %%edx\n\t"
-  // "pushl %%ebx\n\t"
-  // "pushl %%esp\n\t"
-  // "pushl %%ebp\n\t"
-  // "pushl %%esi\n\t"
-  // "pushl %%edi\n\t"
-  // "pushl %%esp\n\t"
-  // "popl %%ebp\n\t"
-  // "leal after_sysenter_label%=, %%esi\n\t"
-  // "sysenter\n\t"
-  // "after_sysenter_label%=:\n\t"
-  // "popl %%edi\n\t"
-  // "popl %%esi\n\t"
-  // "popl %%ebp\n\t"
-  // "popl %%esp\n\t"
-  // "popl %%ebx\n\t"
-  // "popl %%edx\n\t"
-  // "popl %%ecx\n\t"
-  // : "=a" (ret)
-  // : "a" (num),
-  // "d" (a1),
-  // "c" (a2),
-  // "b" (a3),
-  // "D" (a4)
-  // : "cc", "memory");*/
-  asm volatile("int %1\n"
-  : "=a" (ret)
-  : "i" (T_SYSCALL),
-  "a" (num),
-  "d" (a1),
-  "c" (a2),
-  "b" (a3),
-  "D" (a4),
-  "S" (a5)
-  : "cc", "memory");
+  //
+  // Syscalls that never reschedule us use sysenter instead, which
+  // skips the full trap.  Since sysenter saves nothing, we hand the
+  // kernel our return address in SI and stack pointer in BP, and the
+  // kernel's sysexit clobbers DX and CX.
+  if (syscall_sysenter(num)) {
+    asm volatile("pushl %%ebp\n"
+    "movl %%esp, %%ebp\n"
+    "leal 1f, %%esi\n"
+    "sysenter\n"
+    "1: popl %%ebp\n"
+    : "=a" (ret), "+d" (a1), "+c" (a2)
+    : "a" (num),
+    "b" (a3),
+    "D" (a4)
+    : "esi", "cc", "memory");
+  } else {
+    asm volatile("int %1\n"
+    : "=a" (ret)
+    : "i" (T_SYSCALL),
+    "a" (num),
+    "d" (a1),
+    "c" (a2),
+    "b" (a3),
+    "D" (a4),
+    "S" (a5)
+    : "cc", "memory");
+  }
 
   if (check && ret > 0)
     panic("syscall %d returned %d (> 0)", num, ret);
@@ -104,8 +94,39 @@ sys_page_unmap(envid_t envid, void *va) {
   return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
 }
 
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  return syscall(SYS_page_alloc_range, 1, envid, (uint32_t) va, npages, perm, 0);
+}
+
+// The syscall takes five arguments, so perm travels in the low bits of
+// the page-aligned dstva.
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva,
+                   size_t npages, int perm) {
+  if (PGOFF(dstva) || PGOFF(perm) != perm)
+    return -E_INVAL;
+  return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv,
+                 (uint32_t) dstva | perm, npages);
+}
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages) {
+  return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+
+int
+sys_page_protect(envid_t envid, void *va, size_t npages, int perm) {
+  return syscall(SYS_page_protect, 1, envid, (uint32_t) va, npages, perm, 0);
+}
+
 // sys_exofork is inlined in lib.h
 
+envid_t
+sys_fork(void) {
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+
 int
 sys_env_set_status(envid_t envid, int status) {
   return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
@@ -170,4 +191,36 @@ int sys_sleep(unsigned msec) {
 
 int sys_net_get_macaddr(char *macaddr) {
   return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+}
+
+int sys_ipc_timer(unsigned msec, uint32_t value) {
+  return syscall(SYS_ipc_timer, 0, msec, value, 0, 0, 0);
+}
+
+int sys_ring_setup(struct SyscallRing *ring, int flags) {
+  return syscall(SYS_ring_setup, 0, (uint32_t) ring, flags, 0, 0, 0);
+}
+
+int sys_ring_enter(void) {
+  return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0);
+}
+
+int sys_futex_wait(const volatile void *addr, uint32_t val, unsigned msec) {
+  return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+
+int sys_futex_wake(const volatile void *addr, int n) {
+  return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+
+int sys_ipc_call(envid_t envid, uint32_t value, void *srcva, int perm, void *dstva) {
+  return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) srcva, perm, (uint32_t) dstva);
+}
+
+int sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+
+int sys_ipc_reply_recv(envid_t envid, uint32_t value, void *srcva, int perm, void *dstva) {
+  return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) srcva, perm, (uint32_t) dstva);
 }
\ No newline at end of file
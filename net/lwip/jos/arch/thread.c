@@ -33,7 +33,7 @@ thread_wakeup(volatile uint32_t *addr) {
 
 void
 thread_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec) {
-    uint32_t s = sys_time_msec();
+    uint32_t s = time_msec();
     uint32_t p = s;
 
     cur_tc->tc_wait_addr = addr;
@@ -48,7 +48,7 @@ thread_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec) {
 	    break;
 
 	thread_yield();
-	p = sys_time_msec();
+	p = time_msec();
     }
 
     cur_tc->tc_wait_addr = 0;
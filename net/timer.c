@@ -3,21 +3,29 @@
 void
 timer(envid_t ns_envid, uint32_t initial_to) {
 	int r;
-	uint32_t stop = sys_time_msec() + initial_to;
+	uint32_t to = initial_to;
 
 	binaryname = "ns_timer";
 
 	while (1) {
-		while((r = sys_time_msec()) < stop && r >= 0) {
-			sys_yield();
+		// Sleep in the kernel until the timer IPC (from envid 0)
+		// arrives, instead of polling sys_time_msec.
+		if ((r = sys_ipc_timer(to, NSREQ_TIMER)) < 0)
+			panic("sys_ipc_timer: %e", r);
+
+		while (1) {
+			uint32_t whom;
+			if ((r = ipc_recv((int32_t *) &whom, 0, 0)) < 0)
+				panic("ipc_recv: %e", r);
+			if (whom == 0)
+				break;
+			cprintf("NS TIMER: timer thread got unexpected IPC from env %x\n", whom);
 		}
-		if (r < 0)
-			panic("sys_time_msec: %e", r);
 
 		ipc_send(ns_envid, NSREQ_TIMER, 0, 0);
 
 		while (1) {
-			uint32_t to, whom;
+			uint32_t whom;
 			to = ipc_recv((int32_t *) &whom, 0, 0);
 
 			if (whom != ns_envid) {
@@ -25,7 +33,6 @@ timer(envid_t ns_envid, uint32_t initial_to) {
 				continue;
 			}
 
-			stop = sys_time_msec() + to;
 			break;
 		}
 	}
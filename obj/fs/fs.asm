@@ -0,0 +1,8325 @@
+
+obj/fs/fs:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 69 1a 00 00       	call   801a9a <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <ide_wait_ready>:
+
+static int diskno = 1;
+
+static int
+ide_wait_ready(bool check_error)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	89 c3                	mov    %eax,%ebx
+
+static inline uint8_t
+inb(int port)
+{
+	uint8_t data;
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  800039:	ba f7 01 00 00       	mov    $0x1f7,%edx
+  80003e:	ec                   	in     (%dx),%al
+	int r;
+
+	while (((r = inb(0x1F7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+  80003f:	89 c1                	mov    %eax,%ecx
+  800041:	83 e1 c0             	and    $0xffffffc0,%ecx
+  800044:	80 f9 40             	cmp    $0x40,%cl
+  800047:	75 f5                	jne    80003e <ide_wait_ready+0xb>
+		/* do nothing */;
+
+	if (check_error && (r & (IDE_DF|IDE_ERR)) != 0)
+		return -1;
+	return 0;
+  800049:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (check_error && (r & (IDE_DF|IDE_ERR)) != 0)
+  80004e:	84 db                	test   %bl,%bl
+  800050:	74 0a                	je     80005c <ide_wait_ready+0x29>
+  800052:	a8 21                	test   $0x21,%al
+  800054:	0f 95 c2             	setne  %dl
+  800057:	0f b6 d2             	movzbl %dl,%edx
+  80005a:	f7 da                	neg    %edx
+}
+  80005c:	89 d0                	mov    %edx,%eax
+  80005e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800061:	c9                   	leave
+  800062:	c3                   	ret
+
+00800063 <ide_probe_disk1>:
+
+bool
+ide_probe_disk1(void)
+{
+  800063:	55                   	push   %ebp
+  800064:	89 e5                	mov    %esp,%ebp
+  800066:	53                   	push   %ebx
+  800067:	83 ec 04             	sub    $0x4,%esp
+	int r, x;
+
+	// wait for Device 0 to be ready
+	ide_wait_ready(0);
+  80006a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80006f:	e8 bf ff ff ff       	call   800033 <ide_wait_ready>
+}
+
+static inline void
+outb(int port, uint8_t data)
+{
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  800074:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  800079:	ba f6 01 00 00       	mov    $0x1f6,%edx
+  80007e:	ee                   	out    %al,(%dx)
+
+	// switch to Device 1
+	outb(0x1F6, 0xE0 | (1<<4));
+
+	// check for Device 1 to be ready for a while
+	for (x = 0;
+  80007f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  800084:	ba f7 01 00 00       	mov    $0x1f7,%edx
+  800089:	ec                   	in     (%dx),%al
+	     x < 1000 && ((r = inb(0x1F7)) & (IDE_BSY|IDE_DF|IDE_ERR)) != 0;
+  80008a:	a8 a1                	test   $0xa1,%al
+  80008c:	74 0b                	je     800099 <ide_probe_disk1+0x36>
+	     x++)
+  80008e:	83 c1 01             	add    $0x1,%ecx
+	     x < 1000 && ((r = inb(0x1F7)) & (IDE_BSY|IDE_DF|IDE_ERR)) != 0;
+  800091:	81 f9 e8 03 00 00    	cmp    $0x3e8,%ecx
+  800097:	75 f0                	jne    800089 <ide_probe_disk1+0x26>
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  800099:	b8 e0 ff ff ff       	mov    $0xffffffe0,%eax
+  80009e:	ba f6 01 00 00       	mov    $0x1f6,%edx
+  8000a3:	ee                   	out    %al,(%dx)
+		/* do nothing */;
+
+	// switch back to Device 0
+	outb(0x1F6, 0xE0 | (0<<4));
+
+	cprintf("Device 1 presence: %d\n", (x < 1000));
+  8000a4:	81 f9 e7 03 00 00    	cmp    $0x3e7,%ecx
+  8000aa:	0f 9e c3             	setle  %bl
+  8000ad:	83 ec 08             	sub    $0x8,%esp
+  8000b0:	0f b6 c3             	movzbl %bl,%eax
+  8000b3:	50                   	push   %eax
+  8000b4:	68 e0 3f 80 00       	push   $0x803fe0
+  8000b9:	e8 1a 1b 00 00       	call   801bd8 <cprintf>
+	return (x < 1000);
+}
+  8000be:	89 d8                	mov    %ebx,%eax
+  8000c0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000c3:	c9                   	leave
+  8000c4:	c3                   	ret
+
+008000c5 <ide_set_disk>:
+
+void
+ide_set_disk(int d)
+{
+  8000c5:	55                   	push   %ebp
+  8000c6:	89 e5                	mov    %esp,%ebp
+  8000c8:	83 ec 08             	sub    $0x8,%esp
+  8000cb:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (d != 0 && d != 1)
+  8000ce:	83 f8 01             	cmp    $0x1,%eax
+  8000d1:	77 07                	ja     8000da <ide_set_disk+0x15>
+		panic("bad disk number");
+	diskno = d;
+  8000d3:	a3 00 50 80 00       	mov    %eax,0x805000
+}
+  8000d8:	c9                   	leave
+  8000d9:	c3                   	ret
+		panic("bad disk number");
+  8000da:	83 ec 04             	sub    $0x4,%esp
+  8000dd:	68 f7 3f 80 00       	push   $0x803ff7
+  8000e2:	6a 3a                	push   $0x3a
+  8000e4:	68 07 40 80 00       	push   $0x804007
+  8000e9:	e8 0f 1a 00 00       	call   801afd <_panic>
+
+008000ee <ide_read>:
+
+
+int
+ide_read(uint32_t secno, void *dst, size_t nsecs)
+{
+  8000ee:	55                   	push   %ebp
+  8000ef:	89 e5                	mov    %esp,%ebp
+  8000f1:	57                   	push   %edi
+  8000f2:	56                   	push   %esi
+  8000f3:	53                   	push   %ebx
+  8000f4:	83 ec 0c             	sub    $0xc,%esp
+  8000f7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8000fa:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8000fd:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	assert(nsecs <= 256);
+  800100:	81 fe 00 01 00 00    	cmp    $0x100,%esi
+  800106:	0f 87 87 00 00 00    	ja     800193 <ide_read+0xa5>
+
+	ide_wait_ready(0);
+  80010c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800111:	e8 1d ff ff ff       	call   800033 <ide_wait_ready>
+  800116:	ba f2 01 00 00       	mov    $0x1f2,%edx
+  80011b:	89 f0                	mov    %esi,%eax
+  80011d:	ee                   	out    %al,(%dx)
+  80011e:	ba f3 01 00 00       	mov    $0x1f3,%edx
+  800123:	89 f8                	mov    %edi,%eax
+  800125:	ee                   	out    %al,(%dx)
+
+	outb(0x1F2, nsecs);
+	outb(0x1F3, secno & 0xFF);
+	outb(0x1F4, (secno >> 8) & 0xFF);
+  800126:	89 f8                	mov    %edi,%eax
+  800128:	c1 e8 08             	shr    $0x8,%eax
+  80012b:	ba f4 01 00 00       	mov    $0x1f4,%edx
+  800130:	ee                   	out    %al,(%dx)
+	outb(0x1F5, (secno >> 16) & 0xFF);
+  800131:	89 f8                	mov    %edi,%eax
+  800133:	c1 e8 10             	shr    $0x10,%eax
+  800136:	ba f5 01 00 00       	mov    $0x1f5,%edx
+  80013b:	ee                   	out    %al,(%dx)
+	outb(0x1F6, 0xE0 | ((diskno&1)<<4) | ((secno>>24)&0x0F));
+  80013c:	0f b6 05 00 50 80 00 	movzbl 0x805000,%eax
+  800143:	c1 e0 04             	shl    $0x4,%eax
+  800146:	83 e0 10             	and    $0x10,%eax
+  800149:	c1 ef 18             	shr    $0x18,%edi
+  80014c:	83 e7 0f             	and    $0xf,%edi
+  80014f:	09 f8                	or     %edi,%eax
+  800151:	83 c8 e0             	or     $0xffffffe0,%eax
+  800154:	ba f6 01 00 00       	mov    $0x1f6,%edx
+  800159:	ee                   	out    %al,(%dx)
+  80015a:	b8 20 00 00 00       	mov    $0x20,%eax
+  80015f:	ba f7 01 00 00       	mov    $0x1f7,%edx
+  800164:	ee                   	out    %al,(%dx)
+  800165:	c1 e6 09             	shl    $0x9,%esi
+  800168:	01 de                	add    %ebx,%esi
+	outb(0x1F7, 0x20);	// CMD 0x20 means read sector
+
+	for (; nsecs > 0; nsecs--, dst += SECTSIZE) {
+  80016a:	39 f3                	cmp    %esi,%ebx
+  80016c:	74 3b                	je     8001a9 <ide_read+0xbb>
+		if ((r = ide_wait_ready(1)) < 0)
+  80016e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800173:	e8 bb fe ff ff       	call   800033 <ide_wait_ready>
+  800178:	85 c0                	test   %eax,%eax
+  80017a:	78 32                	js     8001ae <ide_read+0xc0>
+	asm volatile("cld\n\trepne\n\tinsl"
+  80017c:	89 df                	mov    %ebx,%edi
+  80017e:	b9 80 00 00 00       	mov    $0x80,%ecx
+  800183:	ba f0 01 00 00       	mov    $0x1f0,%edx
+  800188:	fc                   	cld
+  800189:	f2 6d                	repnz insl (%dx),%es:(%edi)
+	for (; nsecs > 0; nsecs--, dst += SECTSIZE) {
+  80018b:	81 c3 00 02 00 00    	add    $0x200,%ebx
+  800191:	eb d7                	jmp    80016a <ide_read+0x7c>
+	assert(nsecs <= 256);
+  800193:	68 10 40 80 00       	push   $0x804010
+  800198:	68 1d 40 80 00       	push   $0x80401d
+  80019d:	6a 44                	push   $0x44
+  80019f:	68 07 40 80 00       	push   $0x804007
+  8001a4:	e8 54 19 00 00       	call   801afd <_panic>
+			return r;
+		insl(0x1F0, dst, SECTSIZE/4);
+	}
+
+	return 0;
+  8001a9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8001ae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001b1:	5b                   	pop    %ebx
+  8001b2:	5e                   	pop    %esi
+  8001b3:	5f                   	pop    %edi
+  8001b4:	5d                   	pop    %ebp
+  8001b5:	c3                   	ret
+
+008001b6 <ide_write>:
+
+int
+ide_write(uint32_t secno, const void *src, size_t nsecs)
+{
+  8001b6:	55                   	push   %ebp
+  8001b7:	89 e5                	mov    %esp,%ebp
+  8001b9:	57                   	push   %edi
+  8001ba:	56                   	push   %esi
+  8001bb:	53                   	push   %ebx
+  8001bc:	83 ec 0c             	sub    $0xc,%esp
+  8001bf:	8b 75 08             	mov    0x8(%ebp),%esi
+  8001c2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8001c5:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int r;
+
+	assert(nsecs <= 256);
+  8001c8:	81 ff 00 01 00 00    	cmp    $0x100,%edi
+  8001ce:	0f 87 87 00 00 00    	ja     80025b <ide_write+0xa5>
+
+	ide_wait_ready(0);
+  8001d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001d9:	e8 55 fe ff ff       	call   800033 <ide_wait_ready>
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  8001de:	ba f2 01 00 00       	mov    $0x1f2,%edx
+  8001e3:	89 f8                	mov    %edi,%eax
+  8001e5:	ee                   	out    %al,(%dx)
+  8001e6:	ba f3 01 00 00       	mov    $0x1f3,%edx
+  8001eb:	89 f0                	mov    %esi,%eax
+  8001ed:	ee                   	out    %al,(%dx)
+
+	outb(0x1F2, nsecs);
+	outb(0x1F3, secno & 0xFF);
+	outb(0x1F4, (secno >> 8) & 0xFF);
+  8001ee:	89 f0                	mov    %esi,%eax
+  8001f0:	c1 e8 08             	shr    $0x8,%eax
+  8001f3:	ba f4 01 00 00       	mov    $0x1f4,%edx
+  8001f8:	ee                   	out    %al,(%dx)
+	outb(0x1F5, (secno >> 16) & 0xFF);
+  8001f9:	89 f0                	mov    %esi,%eax
+  8001fb:	c1 e8 10             	shr    $0x10,%eax
+  8001fe:	ba f5 01 00 00       	mov    $0x1f5,%edx
+  800203:	ee                   	out    %al,(%dx)
+	outb(0x1F6, 0xE0 | ((diskno&1)<<4) | ((secno>>24)&0x0F));
+  800204:	0f b6 05 00 50 80 00 	movzbl 0x805000,%eax
+  80020b:	c1 e0 04             	shl    $0x4,%eax
+  80020e:	83 e0 10             	and    $0x10,%eax
+  800211:	c1 ee 18             	shr    $0x18,%esi
+  800214:	83 e6 0f             	and    $0xf,%esi
+  800217:	09 f0                	or     %esi,%eax
+  800219:	83 c8 e0             	or     $0xffffffe0,%eax
+  80021c:	ba f6 01 00 00       	mov    $0x1f6,%edx
+  800221:	ee                   	out    %al,(%dx)
+  800222:	b8 30 00 00 00       	mov    $0x30,%eax
+  800227:	ba f7 01 00 00       	mov    $0x1f7,%edx
+  80022c:	ee                   	out    %al,(%dx)
+  80022d:	c1 e7 09             	shl    $0x9,%edi
+  800230:	01 df                	add    %ebx,%edi
+	outb(0x1F7, 0x30);	// CMD 0x30 means write sector
+
+	for (; nsecs > 0; nsecs--, src += SECTSIZE) {
+  800232:	39 fb                	cmp    %edi,%ebx
+  800234:	74 3b                	je     800271 <ide_write+0xbb>
+		if ((r = ide_wait_ready(1)) < 0)
+  800236:	b8 01 00 00 00       	mov    $0x1,%eax
+  80023b:	e8 f3 fd ff ff       	call   800033 <ide_wait_ready>
+  800240:	85 c0                	test   %eax,%eax
+  800242:	78 32                	js     800276 <ide_write+0xc0>
+}
+
+static inline void
+outsl(int port, const void *addr, int cnt)
+{
+	asm volatile("cld\n\trepne\n\toutsl"
+  800244:	89 de                	mov    %ebx,%esi
+  800246:	b9 80 00 00 00       	mov    $0x80,%ecx
+  80024b:	ba f0 01 00 00       	mov    $0x1f0,%edx
+  800250:	fc                   	cld
+  800251:	f2 6f                	repnz outsl %ds:(%esi),(%dx)
+	for (; nsecs > 0; nsecs--, src += SECTSIZE) {
+  800253:	81 c3 00 02 00 00    	add    $0x200,%ebx
+  800259:	eb d7                	jmp    800232 <ide_write+0x7c>
+	assert(nsecs <= 256);
+  80025b:	68 10 40 80 00       	push   $0x804010
+  800260:	68 1d 40 80 00       	push   $0x80401d
+  800265:	6a 5d                	push   $0x5d
+  800267:	68 07 40 80 00       	push   $0x804007
+  80026c:	e8 8c 18 00 00       	call   801afd <_panic>
+			return r;
+		outsl(0x1F0, src, SECTSIZE/4);
+	}
+
+	return 0;
+  800271:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800276:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800279:	5b                   	pop    %ebx
+  80027a:	5e                   	pop    %esi
+  80027b:	5f                   	pop    %edi
+  80027c:	5d                   	pop    %ebp
+  80027d:	c3                   	ret
+
+0080027e <bc_pgfault>:
+}
+
+// Fault any disk block that is read in to memory by
+// loading it from disk.
+static void
+bc_pgfault(struct UTrapframe *utf) {
+  80027e:	55                   	push   %ebp
+  80027f:	89 e5                	mov    %esp,%ebp
+  800281:	56                   	push   %esi
+  800282:	53                   	push   %ebx
+  800283:	8b 55 08             	mov    0x8(%ebp),%edx
+  void *addr = (void *) utf->utf_fault_va;
+  800286:	8b 1a                	mov    (%edx),%ebx
+  uint32_t blockno = ((uint32_t) addr - DISKMAP) / BLKSIZE;
+  800288:	8d 83 00 00 00 f0    	lea    -0x10000000(%ebx),%eax
+  80028e:	89 c6                	mov    %eax,%esi
+  800290:	c1 ee 0c             	shr    $0xc,%esi
+  int r;
+
+  // Check that the fault was within the block cache region
+  if (addr < (void *) DISKMAP || addr >= (void *) (DISKMAP + DISKSIZE))
+  800293:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  800298:	0f 87 95 00 00 00    	ja     800333 <bc_pgfault+0xb5>
+    panic("page fault in FS: eip %08x, va %08x, err %04x",
+          utf->utf_eip, addr, utf->utf_err);
+
+  // Sanity check the block number.
+  if (super && blockno >= super->s_nblocks)
+  80029e:	a1 0c a0 80 00       	mov    0x80a00c,%eax
+  8002a3:	85 c0                	test   %eax,%eax
+  8002a5:	74 09                	je     8002b0 <bc_pgfault+0x32>
+  8002a7:	3b 70 04             	cmp    0x4(%eax),%esi
+  8002aa:	0f 83 9e 00 00 00    	jae    80034e <bc_pgfault+0xd0>
+  // of the block from the disk into that page.
+  // Hint: first round addr to page boundary. fs/ide.c has code to read
+  // the disk.
+  //
+  // LAB 5: you code here:
+  addr = ROUNDDOWN(addr, BLKSIZE);
+  8002b0:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+
+  if ((r = sys_page_alloc(0, addr, PTE_P | PTE_U | PTE_W)) < 0)
+  8002b6:	83 ec 04             	sub    $0x4,%esp
+  8002b9:	6a 07                	push   $0x7
+  8002bb:	53                   	push   %ebx
+  8002bc:	6a 00                	push   $0x0
+  8002be:	e8 ba 22 00 00       	call   80257d <sys_page_alloc>
+  8002c3:	83 c4 10             	add    $0x10,%esp
+  8002c6:	85 c0                	test   %eax,%eax
+  8002c8:	0f 88 92 00 00 00    	js     800360 <bc_pgfault+0xe2>
+    panic("in bc_pgfault, sys_page_alloc: %e", r);
+
+  if ((r = ide_read(blockno * BLKSECTS, addr, BLKSECTS)) < 0)
+  8002ce:	83 ec 04             	sub    $0x4,%esp
+  8002d1:	6a 08                	push   $0x8
+  8002d3:	53                   	push   %ebx
+  8002d4:	8d 04 f5 00 00 00 00 	lea    0x0(,%esi,8),%eax
+  8002db:	50                   	push   %eax
+  8002dc:	e8 0d fe ff ff       	call   8000ee <ide_read>
+  8002e1:	83 c4 10             	add    $0x10,%esp
+  8002e4:	85 c0                	test   %eax,%eax
+  8002e6:	0f 88 86 00 00 00    	js     800372 <bc_pgfault+0xf4>
+    panic("in bc_pgfault, ide_read: %e", r);
+
+  // Clear the dirty bit for the disk block page since we just read the
+  // block from disk
+  if ((r = sys_page_map(0, addr, 0, addr, uvpt[PGNUM(addr)] & PTE_SYSCALL)) < 0)
+  8002ec:	89 d8                	mov    %ebx,%eax
+  8002ee:	c1 e8 0c             	shr    $0xc,%eax
+  8002f1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8002f8:	83 ec 0c             	sub    $0xc,%esp
+  8002fb:	25 07 0e 00 00       	and    $0xe07,%eax
+  800300:	50                   	push   %eax
+  800301:	53                   	push   %ebx
+  800302:	6a 00                	push   $0x0
+  800304:	53                   	push   %ebx
+  800305:	6a 00                	push   $0x0
+  800307:	e8 b4 22 00 00       	call   8025c0 <sys_page_map>
+  80030c:	83 c4 20             	add    $0x20,%esp
+  80030f:	85 c0                	test   %eax,%eax
+  800311:	78 71                	js     800384 <bc_pgfault+0x106>
+    panic("in bc_pgfault, sys_page_map: %e", r);
+
+  // Check that the block we read was allocated. (exercise for
+  // the reader: why do we do this *after* reading the block
+  // in?)
+  if (bitmap && block_is_free(blockno))
+  800313:	83 3d 08 a0 80 00 00 	cmpl   $0x0,0x80a008
+  80031a:	74 10                	je     80032c <bc_pgfault+0xae>
+  80031c:	83 ec 0c             	sub    $0xc,%esp
+  80031f:	56                   	push   %esi
+  800320:	e8 1a 05 00 00       	call   80083f <block_is_free>
+  800325:	83 c4 10             	add    $0x10,%esp
+  800328:	84 c0                	test   %al,%al
+  80032a:	75 6a                	jne    800396 <bc_pgfault+0x118>
+    panic("reading free block %08x\n", blockno);
+}
+  80032c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80032f:	5b                   	pop    %ebx
+  800330:	5e                   	pop    %esi
+  800331:	5d                   	pop    %ebp
+  800332:	c3                   	ret
+    panic("page fault in FS: eip %08x, va %08x, err %04x",
+  800333:	83 ec 08             	sub    $0x8,%esp
+  800336:	ff 72 04             	push   0x4(%edx)
+  800339:	53                   	push   %ebx
+  80033a:	ff 72 28             	push   0x28(%edx)
+  80033d:	68 34 40 80 00       	push   $0x804034
+  800342:	6a 22                	push   $0x22
+  800344:	68 5c 41 80 00       	push   $0x80415c
+  800349:	e8 af 17 00 00       	call   801afd <_panic>
+    panic("reading non-existent block %08x\n", blockno);
+  80034e:	56                   	push   %esi
+  80034f:	68 64 40 80 00       	push   $0x804064
+  800354:	6a 27                	push   $0x27
+  800356:	68 5c 41 80 00       	push   $0x80415c
+  80035b:	e8 9d 17 00 00       	call   801afd <_panic>
+    panic("in bc_pgfault, sys_page_alloc: %e", r);
+  800360:	50                   	push   %eax
+  800361:	68 88 40 80 00       	push   $0x804088
+  800366:	6a 32                	push   $0x32
+  800368:	68 5c 41 80 00       	push   $0x80415c
+  80036d:	e8 8b 17 00 00       	call   801afd <_panic>
+    panic("in bc_pgfault, ide_read: %e", r);
+  800372:	50                   	push   %eax
+  800373:	68 64 41 80 00       	push   $0x804164
+  800378:	6a 35                	push   $0x35
+  80037a:	68 5c 41 80 00       	push   $0x80415c
+  80037f:	e8 79 17 00 00       	call   801afd <_panic>
+    panic("in bc_pgfault, sys_page_map: %e", r);
+  800384:	50                   	push   %eax
+  800385:	68 ac 40 80 00       	push   $0x8040ac
+  80038a:	6a 3a                	push   $0x3a
+  80038c:	68 5c 41 80 00       	push   $0x80415c
+  800391:	e8 67 17 00 00       	call   801afd <_panic>
+    panic("reading free block %08x\n", blockno);
+  800396:	56                   	push   %esi
+  800397:	68 80 41 80 00       	push   $0x804180
+  80039c:	6a 40                	push   $0x40
+  80039e:	68 5c 41 80 00       	push   $0x80415c
+  8003a3:	e8 55 17 00 00       	call   801afd <_panic>
+
+008003a8 <diskaddr>:
+diskaddr(uint32_t blockno) {
+  8003a8:	55                   	push   %ebp
+  8003a9:	89 e5                	mov    %esp,%ebp
+  8003ab:	83 ec 08             	sub    $0x8,%esp
+  8003ae:	8b 45 08             	mov    0x8(%ebp),%eax
+  if (blockno == 0 || (super && blockno >= super->s_nblocks))
+  8003b1:	85 c0                	test   %eax,%eax
+  8003b3:	74 19                	je     8003ce <diskaddr+0x26>
+  8003b5:	8b 15 0c a0 80 00    	mov    0x80a00c,%edx
+  8003bb:	85 d2                	test   %edx,%edx
+  8003bd:	74 05                	je     8003c4 <diskaddr+0x1c>
+  8003bf:	3b 42 04             	cmp    0x4(%edx),%eax
+  8003c2:	73 0a                	jae    8003ce <diskaddr+0x26>
+  return (char *) (DISKMAP + blockno * BLKSIZE);
+  8003c4:	05 00 00 01 00       	add    $0x10000,%eax
+  8003c9:	c1 e0 0c             	shl    $0xc,%eax
+}
+  8003cc:	c9                   	leave
+  8003cd:	c3                   	ret
+    panic("bad block number %08x in diskaddr", blockno);
+  8003ce:	50                   	push   %eax
+  8003cf:	68 cc 40 80 00       	push   $0x8040cc
+  8003d4:	6a 08                	push   $0x8
+  8003d6:	68 5c 41 80 00       	push   $0x80415c
+  8003db:	e8 1d 17 00 00       	call   801afd <_panic>
+
+008003e0 <va_is_mapped>:
+va_is_mapped(void *va) {
+  8003e0:	55                   	push   %ebp
+  8003e1:	89 e5                	mov    %esp,%ebp
+  8003e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  8003e6:	89 d0                	mov    %edx,%eax
+  8003e8:	c1 e8 16             	shr    $0x16,%eax
+  8003eb:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  8003f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003f7:	f6 c1 01             	test   $0x1,%cl
+  8003fa:	74 0d                	je     800409 <va_is_mapped+0x29>
+  8003fc:	c1 ea 0c             	shr    $0xc,%edx
+  8003ff:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  800406:	83 e0 01             	and    $0x1,%eax
+  800409:	83 e0 01             	and    $0x1,%eax
+}
+  80040c:	5d                   	pop    %ebp
+  80040d:	c3                   	ret
+
+0080040e <va_is_dirty>:
+va_is_dirty(void *va) {
+  80040e:	55                   	push   %ebp
+  80040f:	89 e5                	mov    %esp,%ebp
+  return (uvpt[PGNUM(va)] & PTE_D) != 0;
+  800411:	8b 45 08             	mov    0x8(%ebp),%eax
+  800414:	c1 e8 0c             	shr    $0xc,%eax
+  800417:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80041e:	c1 e8 06             	shr    $0x6,%eax
+  800421:	83 e0 01             	and    $0x1,%eax
+}
+  800424:	5d                   	pop    %ebp
+  800425:	c3                   	ret
+
+00800426 <flush_block>:
+// nothing.
+// Hint: Use va_is_mapped, va_is_dirty, and ide_write.
+// Hint: Use the PTE_SYSCALL constant when calling sys_page_map.
+// Hint: Don't forget to round addr down.
+void
+flush_block(void *addr) {
+  800426:	55                   	push   %ebp
+  800427:	89 e5                	mov    %esp,%ebp
+  800429:	56                   	push   %esi
+  80042a:	53                   	push   %ebx
+  80042b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint32_t blockno = ((uint32_t) addr - DISKMAP) / BLKSIZE;
+  80042e:	8d 83 00 00 00 f0    	lea    -0x10000000(%ebx),%eax
+  800434:	89 c6                	mov    %eax,%esi
+  800436:	c1 ee 0c             	shr    $0xc,%esi
+
+  if (addr < (void *) DISKMAP || addr >= (void *) (DISKMAP + DISKSIZE))
+  800439:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  80043e:	77 2b                	ja     80046b <flush_block+0x45>
+    panic("flush_block of bad va %08x", addr);
+
+  // LAB 5: Your code here.
+  addr = ROUNDDOWN(addr, BLKSIZE);
+  800440:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  int r;
+
+  // Sanity check the block number.
+  if (super && blockno >= super->s_nblocks)
+  800446:	a1 0c a0 80 00       	mov    0x80a00c,%eax
+  80044b:	85 c0                	test   %eax,%eax
+  80044d:	74 05                	je     800454 <flush_block+0x2e>
+  80044f:	3b 70 04             	cmp    0x4(%eax),%esi
+  800452:	73 29                	jae    80047d <flush_block+0x57>
+    panic("flushing non-existent block %08x\n", blockno);
+
+  if (!(va_is_mapped(addr) && va_is_dirty(addr)))
+  800454:	83 ec 0c             	sub    $0xc,%esp
+  800457:	53                   	push   %ebx
+  800458:	e8 83 ff ff ff       	call   8003e0 <va_is_mapped>
+  80045d:	83 c4 10             	add    $0x10,%esp
+  800460:	84 c0                	test   %al,%al
+  800462:	75 2b                	jne    80048f <flush_block+0x69>
+  if ((r = ide_write(blockno * BLKSECTS, addr, BLKSECTS)) < 0)
+    panic("in flush_block, ide_write: %e", r);
+
+  if ((r = sys_page_map(0, addr, 0, addr, PTE_SYSCALL)) < 0)
+    panic("in flush_block, sys_page_map: %e", r);
+}
+  800464:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800467:	5b                   	pop    %ebx
+  800468:	5e                   	pop    %esi
+  800469:	5d                   	pop    %ebp
+  80046a:	c3                   	ret
+    panic("flush_block of bad va %08x", addr);
+  80046b:	53                   	push   %ebx
+  80046c:	68 99 41 80 00       	push   $0x804199
+  800471:	6a 4f                	push   $0x4f
+  800473:	68 5c 41 80 00       	push   $0x80415c
+  800478:	e8 80 16 00 00       	call   801afd <_panic>
+    panic("flushing non-existent block %08x\n", blockno);
+  80047d:	56                   	push   %esi
+  80047e:	68 f0 40 80 00       	push   $0x8040f0
+  800483:	6a 57                	push   $0x57
+  800485:	68 5c 41 80 00       	push   $0x80415c
+  80048a:	e8 6e 16 00 00       	call   801afd <_panic>
+  if (!(va_is_mapped(addr) && va_is_dirty(addr)))
+  80048f:	83 ec 0c             	sub    $0xc,%esp
+  800492:	53                   	push   %ebx
+  800493:	e8 76 ff ff ff       	call   80040e <va_is_dirty>
+  800498:	83 c4 10             	add    $0x10,%esp
+  80049b:	84 c0                	test   %al,%al
+  80049d:	74 c5                	je     800464 <flush_block+0x3e>
+  if ((r = ide_write(blockno * BLKSECTS, addr, BLKSECTS)) < 0)
+  80049f:	83 ec 04             	sub    $0x4,%esp
+  8004a2:	6a 08                	push   $0x8
+  8004a4:	53                   	push   %ebx
+  8004a5:	c1 e6 03             	shl    $0x3,%esi
+  8004a8:	56                   	push   %esi
+  8004a9:	e8 08 fd ff ff       	call   8001b6 <ide_write>
+  8004ae:	83 c4 10             	add    $0x10,%esp
+  8004b1:	85 c0                	test   %eax,%eax
+  8004b3:	78 2c                	js     8004e1 <flush_block+0xbb>
+  if ((r = sys_page_map(0, addr, 0, addr, PTE_SYSCALL)) < 0)
+  8004b5:	83 ec 0c             	sub    $0xc,%esp
+  8004b8:	68 07 0e 00 00       	push   $0xe07
+  8004bd:	53                   	push   %ebx
+  8004be:	6a 00                	push   $0x0
+  8004c0:	53                   	push   %ebx
+  8004c1:	6a 00                	push   $0x0
+  8004c3:	e8 f8 20 00 00       	call   8025c0 <sys_page_map>
+  8004c8:	83 c4 20             	add    $0x20,%esp
+  8004cb:	85 c0                	test   %eax,%eax
+  8004cd:	79 95                	jns    800464 <flush_block+0x3e>
+    panic("in flush_block, sys_page_map: %e", r);
+  8004cf:	50                   	push   %eax
+  8004d0:	68 14 41 80 00       	push   $0x804114
+  8004d5:	6a 60                	push   $0x60
+  8004d7:	68 5c 41 80 00       	push   $0x80415c
+  8004dc:	e8 1c 16 00 00       	call   801afd <_panic>
+    panic("in flush_block, ide_write: %e", r);
+  8004e1:	50                   	push   %eax
+  8004e2:	68 b4 41 80 00       	push   $0x8041b4
+  8004e7:	6a 5d                	push   $0x5d
+  8004e9:	68 5c 41 80 00       	push   $0x80415c
+  8004ee:	e8 0a 16 00 00       	call   801afd <_panic>
+
+008004f3 <bc_init>:
+
+  cprintf("block cache is good\n");
+}
+
+void
+bc_init(void) {
+  8004f3:	55                   	push   %ebp
+  8004f4:	89 e5                	mov    %esp,%ebp
+  8004f6:	53                   	push   %ebx
+  8004f7:	81 ec 20 02 00 00    	sub    $0x220,%esp
+  struct Super super;
+  set_pgfault_handler(bc_pgfault);
+  8004fd:	68 7e 02 80 00       	push   $0x80027e
+  800502:	e8 49 23 00 00       	call   802850 <set_pgfault_handler>
+  memmove(&backup, diskaddr(1), sizeof backup);
+  800507:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  80050e:	e8 95 fe ff ff       	call   8003a8 <diskaddr>
+  800513:	83 c4 0c             	add    $0xc,%esp
+  800516:	68 08 01 00 00       	push   $0x108
+  80051b:	50                   	push   %eax
+  80051c:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  800522:	50                   	push   %eax
+  800523:	e8 ef 1d 00 00       	call   802317 <memmove>
+  strcpy(diskaddr(1), "OOPS!\n");
+  800528:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  80052f:	e8 74 fe ff ff       	call   8003a8 <diskaddr>
+  800534:	83 c4 08             	add    $0x8,%esp
+  800537:	68 d2 41 80 00       	push   $0x8041d2
+  80053c:	50                   	push   %eax
+  80053d:	e8 4f 1c 00 00       	call   802191 <strcpy>
+  flush_block(diskaddr(1));
+  800542:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  800549:	e8 5a fe ff ff       	call   8003a8 <diskaddr>
+  80054e:	89 04 24             	mov    %eax,(%esp)
+  800551:	e8 d0 fe ff ff       	call   800426 <flush_block>
+  assert(va_is_mapped(diskaddr(1)));
+  800556:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  80055d:	e8 46 fe ff ff       	call   8003a8 <diskaddr>
+  800562:	89 04 24             	mov    %eax,(%esp)
+  800565:	e8 76 fe ff ff       	call   8003e0 <va_is_mapped>
+  80056a:	83 c4 10             	add    $0x10,%esp
+  80056d:	84 c0                	test   %al,%al
+  80056f:	0f 84 d1 01 00 00    	je     800746 <bc_init+0x253>
+  assert(!va_is_dirty(diskaddr(1)));
+  800575:	83 ec 0c             	sub    $0xc,%esp
+  800578:	6a 01                	push   $0x1
+  80057a:	e8 29 fe ff ff       	call   8003a8 <diskaddr>
+  80057f:	89 04 24             	mov    %eax,(%esp)
+  800582:	e8 87 fe ff ff       	call   80040e <va_is_dirty>
+  800587:	83 c4 10             	add    $0x10,%esp
+  80058a:	84 c0                	test   %al,%al
+  80058c:	0f 85 ca 01 00 00    	jne    80075c <bc_init+0x269>
+  sys_page_unmap(0, diskaddr(1));
+  800592:	83 ec 0c             	sub    $0xc,%esp
+  800595:	6a 01                	push   $0x1
+  800597:	e8 0c fe ff ff       	call   8003a8 <diskaddr>
+  80059c:	83 c4 08             	add    $0x8,%esp
+  80059f:	50                   	push   %eax
+  8005a0:	6a 00                	push   $0x0
+  8005a2:	e8 5b 20 00 00       	call   802602 <sys_page_unmap>
+  assert(!va_is_mapped(diskaddr(1)));
+  8005a7:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  8005ae:	e8 f5 fd ff ff       	call   8003a8 <diskaddr>
+  8005b3:	89 04 24             	mov    %eax,(%esp)
+  8005b6:	e8 25 fe ff ff       	call   8003e0 <va_is_mapped>
+  8005bb:	83 c4 10             	add    $0x10,%esp
+  8005be:	84 c0                	test   %al,%al
+  8005c0:	0f 85 ac 01 00 00    	jne    800772 <bc_init+0x27f>
+  assert(strcmp(diskaddr(1), "OOPS!\n") == 0);
+  8005c6:	83 ec 0c             	sub    $0xc,%esp
+  8005c9:	6a 01                	push   $0x1
+  8005cb:	e8 d8 fd ff ff       	call   8003a8 <diskaddr>
+  8005d0:	83 c4 08             	add    $0x8,%esp
+  8005d3:	68 d2 41 80 00       	push   $0x8041d2
+  8005d8:	50                   	push   %eax
+  8005d9:	e8 64 1c 00 00       	call   802242 <strcmp>
+  8005de:	83 c4 10             	add    $0x10,%esp
+  8005e1:	85 c0                	test   %eax,%eax
+  8005e3:	0f 85 9f 01 00 00    	jne    800788 <bc_init+0x295>
+  memmove(diskaddr(1), &backup, sizeof backup);
+  8005e9:	83 ec 0c             	sub    $0xc,%esp
+  8005ec:	6a 01                	push   $0x1
+  8005ee:	e8 b5 fd ff ff       	call   8003a8 <diskaddr>
+  8005f3:	83 c4 0c             	add    $0xc,%esp
+  8005f6:	68 08 01 00 00       	push   $0x108
+  8005fb:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+  800601:	53                   	push   %ebx
+  800602:	50                   	push   %eax
+  800603:	e8 0f 1d 00 00       	call   802317 <memmove>
+  flush_block(diskaddr(1));
+  800608:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  80060f:	e8 94 fd ff ff       	call   8003a8 <diskaddr>
+  800614:	89 04 24             	mov    %eax,(%esp)
+  800617:	e8 0a fe ff ff       	call   800426 <flush_block>
+  memmove(&backup, diskaddr(1), sizeof backup);
+  80061c:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  800623:	e8 80 fd ff ff       	call   8003a8 <diskaddr>
+  800628:	83 c4 0c             	add    $0xc,%esp
+  80062b:	68 08 01 00 00       	push   $0x108
+  800630:	50                   	push   %eax
+  800631:	53                   	push   %ebx
+  800632:	e8 e0 1c 00 00       	call   802317 <memmove>
+  strcpy(diskaddr(1), "OOPS!\n");
+  800637:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  80063e:	e8 65 fd ff ff       	call   8003a8 <diskaddr>
+  800643:	83 c4 08             	add    $0x8,%esp
+  800646:	68 d2 41 80 00       	push   $0x8041d2
+  80064b:	50                   	push   %eax
+  80064c:	e8 40 1b 00 00       	call   802191 <strcpy>
+  flush_block(diskaddr(1) + 20);
+  800651:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  800658:	e8 4b fd ff ff       	call   8003a8 <diskaddr>
+  80065d:	83 c0 14             	add    $0x14,%eax
+  800660:	89 04 24             	mov    %eax,(%esp)
+  800663:	e8 be fd ff ff       	call   800426 <flush_block>
+  assert(va_is_mapped(diskaddr(1)));
+  800668:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  80066f:	e8 34 fd ff ff       	call   8003a8 <diskaddr>
+  800674:	89 04 24             	mov    %eax,(%esp)
+  800677:	e8 64 fd ff ff       	call   8003e0 <va_is_mapped>
+  80067c:	83 c4 10             	add    $0x10,%esp
+  80067f:	84 c0                	test   %al,%al
+  800681:	0f 84 17 01 00 00    	je     80079e <bc_init+0x2ab>
+  sys_page_unmap(0, diskaddr(1));
+  800687:	83 ec 0c             	sub    $0xc,%esp
+  80068a:	6a 01                	push   $0x1
+  80068c:	e8 17 fd ff ff       	call   8003a8 <diskaddr>
+  800691:	83 c4 08             	add    $0x8,%esp
+  800694:	50                   	push   %eax
+  800695:	6a 00                	push   $0x0
+  800697:	e8 66 1f 00 00       	call   802602 <sys_page_unmap>
+  assert(!va_is_mapped(diskaddr(1)));
+  80069c:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  8006a3:	e8 00 fd ff ff       	call   8003a8 <diskaddr>
+  8006a8:	89 04 24             	mov    %eax,(%esp)
+  8006ab:	e8 30 fd ff ff       	call   8003e0 <va_is_mapped>
+  8006b0:	83 c4 10             	add    $0x10,%esp
+  8006b3:	84 c0                	test   %al,%al
+  8006b5:	0f 85 fc 00 00 00    	jne    8007b7 <bc_init+0x2c4>
+  assert(strcmp(diskaddr(1), "OOPS!\n") == 0);
+  8006bb:	83 ec 0c             	sub    $0xc,%esp
+  8006be:	6a 01                	push   $0x1
+  8006c0:	e8 e3 fc ff ff       	call   8003a8 <diskaddr>
+  8006c5:	83 c4 08             	add    $0x8,%esp
+  8006c8:	68 d2 41 80 00       	push   $0x8041d2
+  8006cd:	50                   	push   %eax
+  8006ce:	e8 6f 1b 00 00       	call   802242 <strcmp>
+  8006d3:	83 c4 10             	add    $0x10,%esp
+  8006d6:	85 c0                	test   %eax,%eax
+  8006d8:	0f 85 f2 00 00 00    	jne    8007d0 <bc_init+0x2dd>
+  memmove(diskaddr(1), &backup, sizeof backup);
+  8006de:	83 ec 0c             	sub    $0xc,%esp
+  8006e1:	6a 01                	push   $0x1
+  8006e3:	e8 c0 fc ff ff       	call   8003a8 <diskaddr>
+  8006e8:	83 c4 0c             	add    $0xc,%esp
+  8006eb:	68 08 01 00 00       	push   $0x108
+  8006f0:	8d 95 e8 fd ff ff    	lea    -0x218(%ebp),%edx
+  8006f6:	52                   	push   %edx
+  8006f7:	50                   	push   %eax
+  8006f8:	e8 1a 1c 00 00       	call   802317 <memmove>
+  flush_block(diskaddr(1));
+  8006fd:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  800704:	e8 9f fc ff ff       	call   8003a8 <diskaddr>
+  800709:	89 04 24             	mov    %eax,(%esp)
+  80070c:	e8 15 fd ff ff       	call   800426 <flush_block>
+  cprintf("block cache is good\n");
+  800711:	c7 04 24 0e 42 80 00 	movl   $0x80420e,(%esp)
+  800718:	e8 bb 14 00 00       	call   801bd8 <cprintf>
+  check_bc();
+
+  // cache the super block by reading it once
+  memmove(&super, diskaddr(1), sizeof super);
+  80071d:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  800724:	e8 7f fc ff ff       	call   8003a8 <diskaddr>
+  800729:	83 c4 0c             	add    $0xc,%esp
+  80072c:	68 08 01 00 00       	push   $0x108
+  800731:	50                   	push   %eax
+  800732:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800738:	50                   	push   %eax
+  800739:	e8 d9 1b 00 00       	call   802317 <memmove>
+}
+  80073e:	83 c4 10             	add    $0x10,%esp
+  800741:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800744:	c9                   	leave
+  800745:	c3                   	ret
+  assert(va_is_mapped(diskaddr(1)));
+  800746:	68 f4 41 80 00       	push   $0x8041f4
+  80074b:	68 1d 40 80 00       	push   $0x80401d
+  800750:	6a 6f                	push   $0x6f
+  800752:	68 5c 41 80 00       	push   $0x80415c
+  800757:	e8 a1 13 00 00       	call   801afd <_panic>
+  assert(!va_is_dirty(diskaddr(1)));
+  80075c:	68 d9 41 80 00       	push   $0x8041d9
+  800761:	68 1d 40 80 00       	push   $0x80401d
+  800766:	6a 70                	push   $0x70
+  800768:	68 5c 41 80 00       	push   $0x80415c
+  80076d:	e8 8b 13 00 00       	call   801afd <_panic>
+  assert(!va_is_mapped(diskaddr(1)));
+  800772:	68 f3 41 80 00       	push   $0x8041f3
+  800777:	68 1d 40 80 00       	push   $0x80401d
+  80077c:	6a 74                	push   $0x74
+  80077e:	68 5c 41 80 00       	push   $0x80415c
+  800783:	e8 75 13 00 00       	call   801afd <_panic>
+  assert(strcmp(diskaddr(1), "OOPS!\n") == 0);
+  800788:	68 38 41 80 00       	push   $0x804138
+  80078d:	68 1d 40 80 00       	push   $0x80401d
+  800792:	6a 77                	push   $0x77
+  800794:	68 5c 41 80 00       	push   $0x80415c
+  800799:	e8 5f 13 00 00       	call   801afd <_panic>
+  assert(va_is_mapped(diskaddr(1)));
+  80079e:	68 f4 41 80 00       	push   $0x8041f4
+  8007a3:	68 1d 40 80 00       	push   $0x80401d
+  8007a8:	68 88 00 00 00       	push   $0x88
+  8007ad:	68 5c 41 80 00       	push   $0x80415c
+  8007b2:	e8 46 13 00 00       	call   801afd <_panic>
+  assert(!va_is_mapped(diskaddr(1)));
+  8007b7:	68 f3 41 80 00       	push   $0x8041f3
+  8007bc:	68 1d 40 80 00       	push   $0x80401d
+  8007c1:	68 90 00 00 00       	push   $0x90
+  8007c6:	68 5c 41 80 00       	push   $0x80415c
+  8007cb:	e8 2d 13 00 00       	call   801afd <_panic>
+  assert(strcmp(diskaddr(1), "OOPS!\n") == 0);
+  8007d0:	68 38 41 80 00       	push   $0x804138
+  8007d5:	68 1d 40 80 00       	push   $0x80401d
+  8007da:	68 93 00 00 00       	push   $0x93
+  8007df:	68 5c 41 80 00       	push   $0x80415c
+  8007e4:	e8 14 13 00 00       	call   801afd <_panic>
+
+008007e9 <check_super>:
+// Super block
+// --------------------------------------------------------------
+
+// Validate the file system super-block.
+void
+check_super(void) {
+  8007e9:	55                   	push   %ebp
+  8007ea:	89 e5                	mov    %esp,%ebp
+  8007ec:	83 ec 08             	sub    $0x8,%esp
+  if (super->s_magic != FS_MAGIC)
+  8007ef:	a1 0c a0 80 00       	mov    0x80a00c,%eax
+  8007f4:	81 38 ae 30 05 4a    	cmpl   $0x4a0530ae,(%eax)
+  8007fa:	75 1b                	jne    800817 <check_super+0x2e>
+    panic("bad file system magic number");
+
+  if (super->s_nblocks > DISKSIZE / BLKSIZE)
+  8007fc:	81 78 04 00 00 0c 00 	cmpl   $0xc0000,0x4(%eax)
+  800803:	77 26                	ja     80082b <check_super+0x42>
+    panic("file system is too large");
+
+  cprintf("superblock is good\n");
+  800805:	83 ec 0c             	sub    $0xc,%esp
+  800808:	68 61 42 80 00       	push   $0x804261
+  80080d:	e8 c6 13 00 00       	call   801bd8 <cprintf>
+}
+  800812:	83 c4 10             	add    $0x10,%esp
+  800815:	c9                   	leave
+  800816:	c3                   	ret
+    panic("bad file system magic number");
+  800817:	83 ec 04             	sub    $0x4,%esp
+  80081a:	68 23 42 80 00       	push   $0x804223
+  80081f:	6a 0e                	push   $0xe
+  800821:	68 40 42 80 00       	push   $0x804240
+  800826:	e8 d2 12 00 00       	call   801afd <_panic>
+    panic("file system is too large");
+  80082b:	83 ec 04             	sub    $0x4,%esp
+  80082e:	68 48 42 80 00       	push   $0x804248
+  800833:	6a 11                	push   $0x11
+  800835:	68 40 42 80 00       	push   $0x804240
+  80083a:	e8 be 12 00 00       	call   801afd <_panic>
+
+0080083f <block_is_free>:
+// --------------------------------------------------------------
+
+// Check to see if the block bitmap indicates that block 'blockno' is free.
+// Return 1 if the block is free, 0 if not.
+bool
+block_is_free(uint32_t blockno) {
+  80083f:	55                   	push   %ebp
+  800840:	89 e5                	mov    %esp,%ebp
+  800842:	53                   	push   %ebx
+  800843:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  if (super == 0 || blockno >= super->s_nblocks)
+  800846:	a1 0c a0 80 00       	mov    0x80a00c,%eax
+  80084b:	85 c0                	test   %eax,%eax
+  80084d:	74 29                	je     800878 <block_is_free+0x39>
+    return 0;
+  80084f:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (super == 0 || blockno >= super->s_nblocks)
+  800854:	3b 48 04             	cmp    0x4(%eax),%ecx
+  800857:	73 18                	jae    800871 <block_is_free+0x32>
+  return bitmap[blockno >> 5] & 1 << (blockno & 31) ? 1 : 0;
+  800859:	89 cb                	mov    %ecx,%ebx
+  80085b:	c1 eb 05             	shr    $0x5,%ebx
+  80085e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800863:	d3 e0                	shl    %cl,%eax
+  800865:	8b 15 08 a0 80 00    	mov    0x80a008,%edx
+  80086b:	23 04 9a             	and    (%edx,%ebx,4),%eax
+  80086e:	0f 95 c2             	setne  %dl
+}
+  800871:	89 d0                	mov    %edx,%eax
+  800873:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800876:	c9                   	leave
+  800877:	c3                   	ret
+    return 0;
+  800878:	ba 00 00 00 00       	mov    $0x0,%edx
+  80087d:	eb f2                	jmp    800871 <block_is_free+0x32>
+
+0080087f <free_block>:
+
+// Mark a block free in the bitmap
+void
+free_block(uint32_t blockno) {
+  80087f:	55                   	push   %ebp
+  800880:	89 e5                	mov    %esp,%ebp
+  800882:	53                   	push   %ebx
+  800883:	83 ec 04             	sub    $0x4,%esp
+  800886:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  // Blockno zero is the null pointer of block numbers.
+  if (blockno == 0)
+  800889:	85 c9                	test   %ecx,%ecx
+  80088b:	74 1a                	je     8008a7 <free_block+0x28>
+    panic("attempt to free zero block");
+  bitmap[blockno >> 5] |= 1 << (blockno & 31);
+  80088d:	89 cb                	mov    %ecx,%ebx
+  80088f:	c1 eb 05             	shr    $0x5,%ebx
+  800892:	8b 15 08 a0 80 00    	mov    0x80a008,%edx
+  800898:	b8 01 00 00 00       	mov    $0x1,%eax
+  80089d:	d3 e0                	shl    %cl,%eax
+  80089f:	09 04 9a             	or     %eax,(%edx,%ebx,4)
+}
+  8008a2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008a5:	c9                   	leave
+  8008a6:	c3                   	ret
+    panic("attempt to free zero block");
+  8008a7:	83 ec 04             	sub    $0x4,%esp
+  8008aa:	68 75 42 80 00       	push   $0x804275
+  8008af:	6a 28                	push   $0x28
+  8008b1:	68 40 42 80 00       	push   $0x804240
+  8008b6:	e8 42 12 00 00       	call   801afd <_panic>
+
+008008bb <alloc_block>:
+// Return block number allocated on success,
+// -E_NO_DISK if we are out of blocks.
+//
+// Hint: use free_block as an example for manipulating the bitmap.
+int
+alloc_block(void) {
+  8008bb:	55                   	push   %ebp
+  8008bc:	89 e5                	mov    %esp,%ebp
+  8008be:	56                   	push   %esi
+  8008bf:	53                   	push   %ebx
+  // The bitmap consists of one or more blocks.  A single bitmap block
+  // contains the in-use bits for BLKBITSIZE blocks.  There are
+  // super->s_nblocks blocks in the disk altogether.
+
+  // LAB 5: Your code here.
+  uint32_t max_blockno = super->s_nblocks;
+  8008c0:	a1 0c a0 80 00       	mov    0x80a00c,%eax
+  8008c5:	8b 70 04             	mov    0x4(%eax),%esi
+
+  for (uint32_t blockno = 0; blockno < max_blockno; ++blockno) {
+  8008c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8008cd:	eb 03                	jmp    8008d2 <alloc_block+0x17>
+  8008cf:	83 c3 01             	add    $0x1,%ebx
+  8008d2:	39 f3                	cmp    %esi,%ebx
+  8008d4:	74 38                	je     80090e <alloc_block+0x53>
+    if (block_is_free(blockno)) {
+  8008d6:	83 ec 0c             	sub    $0xc,%esp
+  8008d9:	53                   	push   %ebx
+  8008da:	e8 60 ff ff ff       	call   80083f <block_is_free>
+  8008df:	83 c4 10             	add    $0x10,%esp
+  8008e2:	84 c0                	test   %al,%al
+  8008e4:	74 e9                	je     8008cf <alloc_block+0x14>
+      uint32_t *pblk = bitmap + (blockno >> 5);
+  8008e6:	89 da                	mov    %ebx,%edx
+  8008e8:	c1 ea 05             	shr    $0x5,%edx
+  8008eb:	a1 08 a0 80 00       	mov    0x80a008,%eax
+  8008f0:	8d 04 90             	lea    (%eax,%edx,4),%eax
+      *pblk &= ~(1 << (blockno & 31));
+  8008f3:	ba fe ff ff ff       	mov    $0xfffffffe,%edx
+  8008f8:	89 d9                	mov    %ebx,%ecx
+  8008fa:	d3 c2                	rol    %cl,%edx
+  8008fc:	21 10                	and    %edx,(%eax)
+      flush_block(pblk);
+  8008fe:	83 ec 0c             	sub    $0xc,%esp
+  800901:	50                   	push   %eax
+  800902:	e8 1f fb ff ff       	call   800426 <flush_block>
+      return blockno;
+  800907:	89 d8                	mov    %ebx,%eax
+  800909:	83 c4 10             	add    $0x10,%esp
+  80090c:	eb 05                	jmp    800913 <alloc_block+0x58>
+    }
+  }
+
+  return -E_NO_DISK;
+  80090e:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+}
+  800913:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800916:	5b                   	pop    %ebx
+  800917:	5e                   	pop    %esi
+  800918:	5d                   	pop    %ebp
+  800919:	c3                   	ret
+
+0080091a <file_block_walk>:
+//	-E_INVAL if filebno is out of range (it's >= NDIRECT + NINDIRECT).
+//
+// Analogy: This is like pgdir_walk for files.
+// Hint: Don't forget to clear any block you allocate.
+static int
+file_block_walk(struct File *f, uint32_t filebno, uint32_t **ppdiskbno, bool alloc) {
+  80091a:	55                   	push   %ebp
+  80091b:	89 e5                	mov    %esp,%ebp
+  80091d:	57                   	push   %edi
+  80091e:	56                   	push   %esi
+  80091f:	53                   	push   %ebx
+  800920:	83 ec 1c             	sub    $0x1c,%esp
+  800923:	89 c6                	mov    %eax,%esi
+  800925:	89 d3                	mov    %edx,%ebx
+  800927:	89 cf                	mov    %ecx,%edi
+  800929:	8b 45 08             	mov    0x8(%ebp),%eax
+  // LAB 5: Your code here.
+  if (filebno < NDIRECT) {
+  80092c:	83 fa 09             	cmp    $0x9,%edx
+  80092f:	77 16                	ja     800947 <file_block_walk+0x2d>
+    *ppdiskbno = f->f_direct + filebno;
+  800931:	8d 84 96 88 00 00 00 	lea    0x88(%esi,%edx,4),%eax
+  800938:	89 01                	mov    %eax,(%ecx)
+      f->f_indirect = indirect_bno;
+    }
+    *ppdiskbno = (uint32_t *) diskaddr(f->f_indirect) + filebno - NDIRECT;
+  }
+
+  return 0;
+  80093a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80093f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800942:	5b                   	pop    %ebx
+  800943:	5e                   	pop    %esi
+  800944:	5f                   	pop    %edi
+  800945:	5d                   	pop    %ebp
+  800946:	c3                   	ret
+  } else if (filebno >= NDIRECT + NINDIRECT) {
+  800947:	81 fa 09 04 00 00    	cmp    $0x409,%edx
+  80094d:	77 6a                	ja     8009b9 <file_block_walk+0x9f>
+    if (f->f_indirect == 0) {
+  80094f:	83 be b0 00 00 00 00 	cmpl   $0x0,0xb0(%esi)
+  800956:	75 43                	jne    80099b <file_block_walk+0x81>
+      if (!alloc)
+  800958:	84 c0                	test   %al,%al
+  80095a:	74 67                	je     8009c3 <file_block_walk+0xa9>
+      if ((indirect_bno = alloc_block()) < 0)
+  80095c:	e8 5a ff ff ff       	call   8008bb <alloc_block>
+  800961:	85 c0                	test   %eax,%eax
+  800963:	78 68                	js     8009cd <file_block_walk+0xb3>
+      void *addr = diskaddr(indirect_bno);
+  800965:	83 ec 0c             	sub    $0xc,%esp
+  800968:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80096b:	50                   	push   %eax
+  80096c:	e8 37 fa ff ff       	call   8003a8 <diskaddr>
+      memset(addr, 0, BLKSIZE);
+  800971:	83 c4 0c             	add    $0xc,%esp
+  800974:	68 00 10 00 00       	push   $0x1000
+  800979:	6a 00                	push   $0x0
+  80097b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80097e:	50                   	push   %eax
+  80097f:	e8 5e 19 00 00       	call   8022e2 <memset>
+      flush_block(addr);
+  800984:	83 c4 04             	add    $0x4,%esp
+  800987:	ff 75 e0             	push   -0x20(%ebp)
+  80098a:	e8 97 fa ff ff       	call   800426 <flush_block>
+      f->f_indirect = indirect_bno;
+  80098f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800992:	89 86 b0 00 00 00    	mov    %eax,0xb0(%esi)
+  800998:	83 c4 10             	add    $0x10,%esp
+    *ppdiskbno = (uint32_t *) diskaddr(f->f_indirect) + filebno - NDIRECT;
+  80099b:	83 ec 0c             	sub    $0xc,%esp
+  80099e:	ff b6 b0 00 00 00    	push   0xb0(%esi)
+  8009a4:	e8 ff f9 ff ff       	call   8003a8 <diskaddr>
+  8009a9:	8d 44 98 d8          	lea    -0x28(%eax,%ebx,4),%eax
+  8009ad:	89 07                	mov    %eax,(%edi)
+  8009af:	83 c4 10             	add    $0x10,%esp
+  return 0;
+  8009b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009b7:	eb 86                	jmp    80093f <file_block_walk+0x25>
+    return -E_INVAL;
+  8009b9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8009be:	e9 7c ff ff ff       	jmp    80093f <file_block_walk+0x25>
+        return -E_NOT_FOUND;
+  8009c3:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  8009c8:	e9 72 ff ff ff       	jmp    80093f <file_block_walk+0x25>
+        return -E_NO_DISK;
+  8009cd:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  8009d2:	e9 68 ff ff ff       	jmp    80093f <file_block_walk+0x25>
+
+008009d7 <check_bitmap>:
+check_bitmap(void) {
+  8009d7:	55                   	push   %ebp
+  8009d8:	89 e5                	mov    %esp,%ebp
+  8009da:	56                   	push   %esi
+  8009db:	53                   	push   %ebx
+  for (i = 0; i * BLKBITSIZE < super->s_nblocks; i++)
+  8009dc:	a1 0c a0 80 00       	mov    0x80a00c,%eax
+  8009e1:	8b 70 04             	mov    0x4(%eax),%esi
+  8009e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009e9:	89 d8                	mov    %ebx,%eax
+  8009eb:	c1 e0 0f             	shl    $0xf,%eax
+  8009ee:	39 f0                	cmp    %esi,%eax
+  8009f0:	73 2e                	jae    800a20 <check_bitmap+0x49>
+    assert(!block_is_free(2 + i));
+  8009f2:	83 ec 0c             	sub    $0xc,%esp
+  8009f5:	8d 43 02             	lea    0x2(%ebx),%eax
+  8009f8:	50                   	push   %eax
+  8009f9:	e8 41 fe ff ff       	call   80083f <block_is_free>
+  8009fe:	83 c4 10             	add    $0x10,%esp
+  800a01:	84 c0                	test   %al,%al
+  800a03:	75 05                	jne    800a0a <check_bitmap+0x33>
+  for (i = 0; i * BLKBITSIZE < super->s_nblocks; i++)
+  800a05:	83 c3 01             	add    $0x1,%ebx
+  800a08:	eb df                	jmp    8009e9 <check_bitmap+0x12>
+    assert(!block_is_free(2 + i));
+  800a0a:	68 90 42 80 00       	push   $0x804290
+  800a0f:	68 1d 40 80 00       	push   $0x80401d
+  800a14:	6a 53                	push   $0x53
+  800a16:	68 40 42 80 00       	push   $0x804240
+  800a1b:	e8 dd 10 00 00       	call   801afd <_panic>
+  assert(!block_is_free(0));
+  800a20:	83 ec 0c             	sub    $0xc,%esp
+  800a23:	6a 00                	push   $0x0
+  800a25:	e8 15 fe ff ff       	call   80083f <block_is_free>
+  800a2a:	83 c4 10             	add    $0x10,%esp
+  800a2d:	84 c0                	test   %al,%al
+  800a2f:	75 28                	jne    800a59 <check_bitmap+0x82>
+  assert(!block_is_free(1));
+  800a31:	83 ec 0c             	sub    $0xc,%esp
+  800a34:	6a 01                	push   $0x1
+  800a36:	e8 04 fe ff ff       	call   80083f <block_is_free>
+  800a3b:	83 c4 10             	add    $0x10,%esp
+  800a3e:	84 c0                	test   %al,%al
+  800a40:	75 2d                	jne    800a6f <check_bitmap+0x98>
+  cprintf("bitmap is good\n");
+  800a42:	83 ec 0c             	sub    $0xc,%esp
+  800a45:	68 ca 42 80 00       	push   $0x8042ca
+  800a4a:	e8 89 11 00 00       	call   801bd8 <cprintf>
+}
+  800a4f:	83 c4 10             	add    $0x10,%esp
+  800a52:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800a55:	5b                   	pop    %ebx
+  800a56:	5e                   	pop    %esi
+  800a57:	5d                   	pop    %ebp
+  800a58:	c3                   	ret
+  assert(!block_is_free(0));
+  800a59:	68 a6 42 80 00       	push   $0x8042a6
+  800a5e:	68 1d 40 80 00       	push   $0x80401d
+  800a63:	6a 56                	push   $0x56
+  800a65:	68 40 42 80 00       	push   $0x804240
+  800a6a:	e8 8e 10 00 00       	call   801afd <_panic>
+  assert(!block_is_free(1));
+  800a6f:	68 b8 42 80 00       	push   $0x8042b8
+  800a74:	68 1d 40 80 00       	push   $0x80401d
+  800a79:	6a 57                	push   $0x57
+  800a7b:	68 40 42 80 00       	push   $0x804240
+  800a80:	e8 78 10 00 00       	call   801afd <_panic>
+
+00800a85 <fs_init>:
+fs_init(void) {
+  800a85:	55                   	push   %ebp
+  800a86:	89 e5                	mov    %esp,%ebp
+  800a88:	83 ec 08             	sub    $0x8,%esp
+  ide_set_disk(ide_probe_disk1() ? 1 : 0);
+  800a8b:	e8 d3 f5 ff ff       	call   800063 <ide_probe_disk1>
+  800a90:	83 ec 0c             	sub    $0xc,%esp
+  800a93:	0f b6 c0             	movzbl %al,%eax
+  800a96:	50                   	push   %eax
+  800a97:	e8 29 f6 ff ff       	call   8000c5 <ide_set_disk>
+  bc_init();
+  800a9c:	e8 52 fa ff ff       	call   8004f3 <bc_init>
+  super = diskaddr(1);
+  800aa1:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  800aa8:	e8 fb f8 ff ff       	call   8003a8 <diskaddr>
+  800aad:	a3 0c a0 80 00       	mov    %eax,0x80a00c
+  check_super();
+  800ab2:	e8 32 fd ff ff       	call   8007e9 <check_super>
+  bitmap = diskaddr(2);
+  800ab7:	c7 04 24 02 00 00 00 	movl   $0x2,(%esp)
+  800abe:	e8 e5 f8 ff ff       	call   8003a8 <diskaddr>
+  800ac3:	a3 08 a0 80 00       	mov    %eax,0x80a008
+  check_bitmap();
+  800ac8:	e8 0a ff ff ff       	call   8009d7 <check_bitmap>
+}
+  800acd:	83 c4 10             	add    $0x10,%esp
+  800ad0:	c9                   	leave
+  800ad1:	c3                   	ret
+
+00800ad2 <file_get_block>:
+//	-E_NO_DISK if a block needed to be allocated but the disk is full.
+//	-E_INVAL if filebno is out of range.
+//
+// Hint: Use file_block_walk and alloc_block.
+int
+file_get_block(struct File *f, uint32_t filebno, char **blk) {
+  800ad2:	55                   	push   %ebp
+  800ad3:	89 e5                	mov    %esp,%ebp
+  800ad5:	53                   	push   %ebx
+  800ad6:	83 ec 20             	sub    $0x20,%esp
+  // LAB 5: Your code here.
+  int r;
+  uint32_t *pdiskbno;
+  if ((r = file_block_walk(f, filebno, &pdiskbno, 1)) < 0)
+  800ad9:	6a 01                	push   $0x1
+  800adb:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  800ade:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ae1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ae4:	e8 31 fe ff ff       	call   80091a <file_block_walk>
+  800ae9:	83 c4 10             	add    $0x10,%esp
+  800aec:	85 c0                	test   %eax,%eax
+  800aee:	78 2a                	js     800b1a <file_get_block+0x48>
+    return r;
+
+  if (*pdiskbno == 0) {
+  800af0:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+  800af3:	83 3b 00             	cmpl   $0x0,(%ebx)
+  800af6:	75 0b                	jne    800b03 <file_get_block+0x31>
+    if ((r = alloc_block()) < 0)
+  800af8:	e8 be fd ff ff       	call   8008bb <alloc_block>
+  800afd:	85 c0                	test   %eax,%eax
+  800aff:	78 19                	js     800b1a <file_get_block+0x48>
+      return r;
+    *pdiskbno = r;
+  800b01:	89 03                	mov    %eax,(%ebx)
+  }
+  *blk = diskaddr(*pdiskbno);
+  800b03:	83 ec 0c             	sub    $0xc,%esp
+  800b06:	ff 33                	push   (%ebx)
+  800b08:	e8 9b f8 ff ff       	call   8003a8 <diskaddr>
+  800b0d:	8b 55 10             	mov    0x10(%ebp),%edx
+  800b10:	89 02                	mov    %eax,(%edx)
+  return 0;
+  800b12:	83 c4 10             	add    $0x10,%esp
+  800b15:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b1a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b1d:	c9                   	leave
+  800b1e:	c3                   	ret
+
+00800b1f <walk_path>:
+// and set *pdir to the directory the file is in.
+// If we cannot find the file but find the directory
+// it should be in, set *pdir and copy the final path
+// element into lastelem.
+static int
+walk_path(const char *path, struct File **pdir, struct File **pf, char *lastelem) {
+  800b1f:	55                   	push   %ebp
+  800b20:	89 e5                	mov    %esp,%ebp
+  800b22:	57                   	push   %edi
+  800b23:	56                   	push   %esi
+  800b24:	53                   	push   %ebx
+  800b25:	81 ec bc 00 00 00    	sub    $0xbc,%esp
+  800b2b:	89 95 40 ff ff ff    	mov    %edx,-0xc0(%ebp)
+  800b31:	89 8d 3c ff ff ff    	mov    %ecx,-0xc4(%ebp)
+  while (*p == '/')
+  800b37:	eb 03                	jmp    800b3c <walk_path+0x1d>
+    p++;
+  800b39:	83 c0 01             	add    $0x1,%eax
+  while (*p == '/')
+  800b3c:	80 38 2f             	cmpb   $0x2f,(%eax)
+  800b3f:	74 f8                	je     800b39 <walk_path+0x1a>
+  int r;
+
+  // if (*path != '/')
+  //	return -E_BAD_PATH;
+  path = skip_slash(path);
+  f = &super->s_root;
+  800b41:	8b 0d 0c a0 80 00    	mov    0x80a00c,%ecx
+  800b47:	83 c1 08             	add    $0x8,%ecx
+  800b4a:	89 8d 4c ff ff ff    	mov    %ecx,-0xb4(%ebp)
+  dir = 0;
+  name[0] = 0;
+  800b50:	c6 85 68 ff ff ff 00 	movb   $0x0,-0x98(%ebp)
+
+  if (pdir)
+  800b57:	8b 8d 40 ff ff ff    	mov    -0xc0(%ebp),%ecx
+  800b5d:	85 c9                	test   %ecx,%ecx
+  800b5f:	74 06                	je     800b67 <walk_path+0x48>
+    *pdir = 0;
+  800b61:	c7 01 00 00 00 00    	movl   $0x0,(%ecx)
+  *pf = 0;
+  800b67:	8b 8d 3c ff ff ff    	mov    -0xc4(%ebp),%ecx
+  800b6d:	c7 01 00 00 00 00    	movl   $0x0,(%ecx)
+  dir = 0;
+  800b73:	ba 00 00 00 00       	mov    $0x0,%edx
+    p = path;
+    while (*path != '/' && *path != '\0')
+      path++;
+    if (path - p >= MAXNAMELEN)
+      return -E_BAD_PATH;
+    memmove(name, p, path - p);
+  800b78:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  while (*path != '\0') {
+  800b7e:	e9 03 01 00 00       	jmp    800c86 <walk_path+0x167>
+      path++;
+  800b83:	83 c3 01             	add    $0x1,%ebx
+    while (*path != '/' && *path != '\0')
+  800b86:	0f b6 13             	movzbl (%ebx),%edx
+  800b89:	80 fa 2f             	cmp    $0x2f,%dl
+  800b8c:	74 04                	je     800b92 <walk_path+0x73>
+  800b8e:	84 d2                	test   %dl,%dl
+  800b90:	75 f1                	jne    800b83 <walk_path+0x64>
+    if (path - p >= MAXNAMELEN)
+  800b92:	89 de                	mov    %ebx,%esi
+  800b94:	29 c6                	sub    %eax,%esi
+  800b96:	83 fe 7f             	cmp    $0x7f,%esi
+  800b99:	0f 8f 9f 01 00 00    	jg     800d3e <walk_path+0x21f>
+    memmove(name, p, path - p);
+  800b9f:	83 ec 04             	sub    $0x4,%esp
+  800ba2:	56                   	push   %esi
+  800ba3:	50                   	push   %eax
+  800ba4:	57                   	push   %edi
+  800ba5:	e8 6d 17 00 00       	call   802317 <memmove>
+    name[path - p] = '\0';
+  800baa:	c6 84 35 68 ff ff ff 	movb   $0x0,-0x98(%ebp,%esi,1)
+  800bb1:	00 
+  while (*p == '/')
+  800bb2:	83 c4 10             	add    $0x10,%esp
+  800bb5:	eb 03                	jmp    800bba <walk_path+0x9b>
+    p++;
+  800bb7:	83 c3 01             	add    $0x1,%ebx
+  while (*p == '/')
+  800bba:	80 3b 2f             	cmpb   $0x2f,(%ebx)
+  800bbd:	74 f8                	je     800bb7 <walk_path+0x98>
+    path = skip_slash(path);
+
+    if (dir->f_type != FTYPE_DIR)
+  800bbf:	8b 85 4c ff ff ff    	mov    -0xb4(%ebp),%eax
+  800bc5:	83 b8 84 00 00 00 01 	cmpl   $0x1,0x84(%eax)
+  800bcc:	0f 85 73 01 00 00    	jne    800d45 <walk_path+0x226>
+  assert((dir->f_size % BLKSIZE) == 0);
+  800bd2:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  800bd8:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  800bdd:	0f 85 b3 00 00 00    	jne    800c96 <walk_path+0x177>
+  nblock = dir->f_size / BLKSIZE;
+  800be3:	8d 90 ff 0f 00 00    	lea    0xfff(%eax),%edx
+  800be9:	85 c0                	test   %eax,%eax
+  800beb:	0f 48 c2             	cmovs  %edx,%eax
+  800bee:	c1 f8 0c             	sar    $0xc,%eax
+  800bf1:	89 85 48 ff ff ff    	mov    %eax,-0xb8(%ebp)
+  for (i = 0; i < nblock; i++) {
+  800bf7:	c7 85 50 ff ff ff 00 	movl   $0x0,-0xb0(%ebp)
+  800bfe:	00 00 00 
+  800c01:	89 9d 44 ff ff ff    	mov    %ebx,-0xbc(%ebp)
+  800c07:	8b 8d 50 ff ff ff    	mov    -0xb0(%ebp),%ecx
+  800c0d:	39 8d 48 ff ff ff    	cmp    %ecx,-0xb8(%ebp)
+  800c13:	0f 84 a2 00 00 00    	je     800cbb <walk_path+0x19c>
+    if ((r = file_get_block(dir, i, &blk)) < 0)
+  800c19:	83 ec 04             	sub    $0x4,%esp
+  800c1c:	8d 85 64 ff ff ff    	lea    -0x9c(%ebp),%eax
+  800c22:	50                   	push   %eax
+  800c23:	ff b5 50 ff ff ff    	push   -0xb0(%ebp)
+  800c29:	ff b5 4c ff ff ff    	push   -0xb4(%ebp)
+  800c2f:	e8 9e fe ff ff       	call   800ad2 <file_get_block>
+  800c34:	83 c4 10             	add    $0x10,%esp
+  800c37:	85 c0                	test   %eax,%eax
+  800c39:	0f 88 cc 00 00 00    	js     800d0b <walk_path+0x1ec>
+    for (j = 0; j < BLKFILES; j++)
+  800c3f:	8b 9d 64 ff ff ff    	mov    -0x9c(%ebp),%ebx
+  800c45:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+  800c4b:	39 f3                	cmp    %esi,%ebx
+  800c4d:	74 60                	je     800caf <walk_path+0x190>
+      if (strcmp(f[j].f_name, name) == 0) {
+  800c4f:	89 9d 54 ff ff ff    	mov    %ebx,-0xac(%ebp)
+  800c55:	83 ec 08             	sub    $0x8,%esp
+  800c58:	57                   	push   %edi
+  800c59:	53                   	push   %ebx
+  800c5a:	e8 e3 15 00 00       	call   802242 <strcmp>
+  800c5f:	81 c3 00 01 00 00    	add    $0x100,%ebx
+  800c65:	83 c4 10             	add    $0x10,%esp
+  800c68:	85 c0                	test   %eax,%eax
+  800c6a:	75 df                	jne    800c4b <walk_path+0x12c>
+  800c6c:	8b 9d 44 ff ff ff    	mov    -0xbc(%ebp),%ebx
+  800c72:	8b 95 4c ff ff ff    	mov    -0xb4(%ebp),%edx
+  800c78:	8b 85 54 ff ff ff    	mov    -0xac(%ebp),%eax
+  800c7e:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%ebp)
+  800c84:	89 d8                	mov    %ebx,%eax
+  while (*path != '\0') {
+  800c86:	80 38 00             	cmpb   $0x0,(%eax)
+  800c89:	0f 84 86 00 00 00    	je     800d15 <walk_path+0x1f6>
+  800c8f:	89 c3                	mov    %eax,%ebx
+  800c91:	e9 f0 fe ff ff       	jmp    800b86 <walk_path+0x67>
+  assert((dir->f_size % BLKSIZE) == 0);
+  800c96:	68 da 42 80 00       	push   $0x8042da
+  800c9b:	68 1d 40 80 00       	push   $0x80401d
+  800ca0:	68 ca 00 00 00       	push   $0xca
+  800ca5:	68 40 42 80 00       	push   $0x804240
+  800caa:	e8 4e 0e 00 00       	call   801afd <_panic>
+  for (i = 0; i < nblock; i++) {
+  800caf:	83 85 50 ff ff ff 01 	addl   $0x1,-0xb0(%ebp)
+  800cb6:	e9 4c ff ff ff       	jmp    800c07 <walk_path+0xe8>
+  return -E_NOT_FOUND;
+  800cbb:	8b 9d 44 ff ff ff    	mov    -0xbc(%ebp),%ebx
+  800cc1:	be f5 ff ff ff       	mov    $0xfffffff5,%esi
+      return -E_NOT_FOUND;
+
+    if ((r = dir_lookup(dir, name, &f)) < 0) {
+      if (r == -E_NOT_FOUND && *path == '\0') {
+  800cc6:	83 fe f5             	cmp    $0xfffffff5,%esi
+  800cc9:	75 69                	jne    800d34 <walk_path+0x215>
+  800ccb:	80 3b 00             	cmpb   $0x0,(%ebx)
+  800cce:	75 64                	jne    800d34 <walk_path+0x215>
+        if (pdir)
+  800cd0:	8b 85 40 ff ff ff    	mov    -0xc0(%ebp),%eax
+  800cd6:	85 c0                	test   %eax,%eax
+  800cd8:	74 08                	je     800ce2 <walk_path+0x1c3>
+          *pdir = dir;
+  800cda:	8b 8d 4c ff ff ff    	mov    -0xb4(%ebp),%ecx
+  800ce0:	89 08                	mov    %ecx,(%eax)
+        if (lastelem)
+  800ce2:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  800ce6:	74 15                	je     800cfd <walk_path+0x1de>
+          strcpy(lastelem, name);
+  800ce8:	83 ec 08             	sub    $0x8,%esp
+  800ceb:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  800cf1:	50                   	push   %eax
+  800cf2:	ff 75 08             	push   0x8(%ebp)
+  800cf5:	e8 97 14 00 00       	call   802191 <strcpy>
+  800cfa:	83 c4 10             	add    $0x10,%esp
+        *pf = 0;
+  800cfd:	8b 85 3c ff ff ff    	mov    -0xc4(%ebp),%eax
+  800d03:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  800d09:	eb 29                	jmp    800d34 <walk_path+0x215>
+  800d0b:	8b 9d 44 ff ff ff    	mov    -0xbc(%ebp),%ebx
+  800d11:	89 c6                	mov    %eax,%esi
+  800d13:	eb b1                	jmp    800cc6 <walk_path+0x1a7>
+      }
+      return r;
+    }
+  }
+
+  if (pdir)
+  800d15:	8b 85 40 ff ff ff    	mov    -0xc0(%ebp),%eax
+  800d1b:	85 c0                	test   %eax,%eax
+  800d1d:	74 02                	je     800d21 <walk_path+0x202>
+    *pdir = dir;
+  800d1f:	89 10                	mov    %edx,(%eax)
+  *pf = f;
+  800d21:	8b 85 3c ff ff ff    	mov    -0xc4(%ebp),%eax
+  800d27:	8b 8d 4c ff ff ff    	mov    -0xb4(%ebp),%ecx
+  800d2d:	89 08                	mov    %ecx,(%eax)
+  return 0;
+  800d2f:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  800d34:	89 f0                	mov    %esi,%eax
+  800d36:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d39:	5b                   	pop    %ebx
+  800d3a:	5e                   	pop    %esi
+  800d3b:	5f                   	pop    %edi
+  800d3c:	5d                   	pop    %ebp
+  800d3d:	c3                   	ret
+      return -E_BAD_PATH;
+  800d3e:	be f4 ff ff ff       	mov    $0xfffffff4,%esi
+  800d43:	eb ef                	jmp    800d34 <walk_path+0x215>
+      return -E_NOT_FOUND;
+  800d45:	be f5 ff ff ff       	mov    $0xfffffff5,%esi
+  800d4a:	eb e8                	jmp    800d34 <walk_path+0x215>
+
+00800d4c <file_open>:
+}
+
+// Open "path".  On success set *pf to point at the file and return 0.
+// On error return < 0.
+int
+file_open(const char *path, struct File **pf) {
+  800d4c:	55                   	push   %ebp
+  800d4d:	89 e5                	mov    %esp,%ebp
+  800d4f:	83 ec 14             	sub    $0x14,%esp
+  return walk_path(path, 0, pf, 0);
+  800d52:	6a 00                	push   $0x0
+  800d54:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d57:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d5c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d5f:	e8 bb fd ff ff       	call   800b1f <walk_path>
+}
+  800d64:	c9                   	leave
+  800d65:	c3                   	ret
+
+00800d66 <file_read>:
+
+// Read count bytes from f into buf, starting from seek position
+// offset.  This meant to mimic the standard pread function.
+// Returns the number of bytes read, < 0 on error.
+ssize_t
+file_read(struct File *f, void *buf, size_t count, off_t offset) {
+  800d66:	55                   	push   %ebp
+  800d67:	89 e5                	mov    %esp,%ebp
+  800d69:	57                   	push   %edi
+  800d6a:	56                   	push   %esi
+  800d6b:	53                   	push   %ebx
+  800d6c:	83 ec 2c             	sub    $0x2c,%esp
+  800d6f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800d72:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d75:	8b 55 14             	mov    0x14(%ebp),%edx
+  int r, bn;
+  off_t pos;
+  char *blk;
+
+  if (offset >= f->f_size)
+  800d78:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d7b:	8b 88 80 00 00 00    	mov    0x80(%eax),%ecx
+    return 0;
+  800d81:	b8 00 00 00 00       	mov    $0x0,%eax
+  if (offset >= f->f_size)
+  800d86:	39 d1                	cmp    %edx,%ecx
+  800d88:	0f 8e 81 00 00 00    	jle    800e0f <file_read+0xa9>
+
+  count = MIN(count, f->f_size - offset);
+  800d8e:	29 d1                	sub    %edx,%ecx
+  800d90:	39 d9                	cmp    %ebx,%ecx
+  800d92:	0f 47 cb             	cmova  %ebx,%ecx
+
+  for (pos = offset; pos < offset + count;) {
+  800d95:	89 d3                	mov    %edx,%ebx
+  800d97:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  800d9a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800d9d:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  800da0:	89 de                	mov    %ebx,%esi
+  800da2:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800da5:	39 c3                	cmp    %eax,%ebx
+  800da7:	73 61                	jae    800e0a <file_read+0xa4>
+    if ((r = file_get_block(f, pos / BLKSIZE, &blk)) < 0)
+  800da9:	83 ec 04             	sub    $0x4,%esp
+  800dac:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800daf:	50                   	push   %eax
+  800db0:	8d 83 ff 0f 00 00    	lea    0xfff(%ebx),%eax
+  800db6:	85 db                	test   %ebx,%ebx
+  800db8:	0f 49 c3             	cmovns %ebx,%eax
+  800dbb:	c1 f8 0c             	sar    $0xc,%eax
+  800dbe:	50                   	push   %eax
+  800dbf:	ff 75 08             	push   0x8(%ebp)
+  800dc2:	e8 0b fd ff ff       	call   800ad2 <file_get_block>
+  800dc7:	83 c4 10             	add    $0x10,%esp
+  800dca:	85 c0                	test   %eax,%eax
+  800dcc:	78 41                	js     800e0f <file_read+0xa9>
+      return r;
+    bn = MIN(BLKSIZE - pos % BLKSIZE, offset + count - pos);
+  800dce:	89 da                	mov    %ebx,%edx
+  800dd0:	c1 fa 1f             	sar    $0x1f,%edx
+  800dd3:	c1 ea 14             	shr    $0x14,%edx
+  800dd6:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+  800dd9:	25 ff 0f 00 00       	and    $0xfff,%eax
+  800dde:	29 d0                	sub    %edx,%eax
+  800de0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800de5:	29 c2                	sub    %eax,%edx
+  800de7:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  800dea:	29 f1                	sub    %esi,%ecx
+  800dec:	39 ca                	cmp    %ecx,%edx
+  800dee:	89 ce                	mov    %ecx,%esi
+  800df0:	0f 46 f2             	cmovbe %edx,%esi
+    memmove(buf, blk + pos % BLKSIZE, bn);
+  800df3:	83 ec 04             	sub    $0x4,%esp
+  800df6:	56                   	push   %esi
+  800df7:	03 45 e4             	add    -0x1c(%ebp),%eax
+  800dfa:	50                   	push   %eax
+  800dfb:	57                   	push   %edi
+  800dfc:	e8 16 15 00 00       	call   802317 <memmove>
+    pos += bn;
+  800e01:	01 f3                	add    %esi,%ebx
+    buf += bn;
+  800e03:	01 f7                	add    %esi,%edi
+  800e05:	83 c4 10             	add    $0x10,%esp
+  800e08:	eb 96                	jmp    800da0 <file_read+0x3a>
+  }
+
+  return count;
+  800e0a:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800e0d:	89 c8                	mov    %ecx,%eax
+}
+  800e0f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e12:	5b                   	pop    %ebx
+  800e13:	5e                   	pop    %esi
+  800e14:	5f                   	pop    %edi
+  800e15:	5d                   	pop    %ebp
+  800e16:	c3                   	ret
+
+00800e17 <file_set_size>:
+  }
+}
+
+// Set the size of file f, truncating or extending as necessary.
+int
+file_set_size(struct File *f, off_t newsize) {
+  800e17:	55                   	push   %ebp
+  800e18:	89 e5                	mov    %esp,%ebp
+  800e1a:	57                   	push   %edi
+  800e1b:	56                   	push   %esi
+  800e1c:	53                   	push   %ebx
+  800e1d:	83 ec 2c             	sub    $0x2c,%esp
+  800e20:	8b 75 08             	mov    0x8(%ebp),%esi
+  800e23:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if (f->f_size > newsize)
+  800e26:	8b 86 80 00 00 00    	mov    0x80(%esi),%eax
+  800e2c:	39 f8                	cmp    %edi,%eax
+  800e2e:	7f 1c                	jg     800e4c <file_set_size+0x35>
+    file_truncate_blocks(f, newsize);
+  f->f_size = newsize;
+  800e30:	89 be 80 00 00 00    	mov    %edi,0x80(%esi)
+  flush_block(f);
+  800e36:	83 ec 0c             	sub    $0xc,%esp
+  800e39:	56                   	push   %esi
+  800e3a:	e8 e7 f5 ff ff       	call   800426 <flush_block>
+  return 0;
+}
+  800e3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e44:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e47:	5b                   	pop    %ebx
+  800e48:	5e                   	pop    %esi
+  800e49:	5f                   	pop    %edi
+  800e4a:	5d                   	pop    %ebp
+  800e4b:	c3                   	ret
+  old_nblocks = (f->f_size + BLKSIZE - 1) / BLKSIZE;
+  800e4c:	8d 90 fe 1f 00 00    	lea    0x1ffe(%eax),%edx
+  800e52:	05 ff 0f 00 00       	add    $0xfff,%eax
+  800e57:	0f 48 c2             	cmovs  %edx,%eax
+  800e5a:	c1 f8 0c             	sar    $0xc,%eax
+  800e5d:	89 c1                	mov    %eax,%ecx
+  new_nblocks = (newsize + BLKSIZE - 1) / BLKSIZE;
+  800e5f:	8d 97 fe 1f 00 00    	lea    0x1ffe(%edi),%edx
+  800e65:	89 f8                	mov    %edi,%eax
+  800e67:	05 ff 0f 00 00       	add    $0xfff,%eax
+  800e6c:	0f 49 d0             	cmovns %eax,%edx
+  800e6f:	c1 fa 0c             	sar    $0xc,%edx
+  for (bno = new_nblocks; bno < old_nblocks; bno++)
+  800e72:	89 d3                	mov    %edx,%ebx
+  800e74:	89 ce                	mov    %ecx,%esi
+  800e76:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  800e79:	eb 44                	jmp    800ebf <file_set_size+0xa8>
+  if (new_nblocks <= NDIRECT && f->f_indirect) {
+  800e7b:	8b 75 08             	mov    0x8(%ebp),%esi
+  800e7e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800e81:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+  800e84:	83 fa 0a             	cmp    $0xa,%edx
+  800e87:	77 a7                	ja     800e30 <file_set_size+0x19>
+  800e89:	8b 86 b0 00 00 00    	mov    0xb0(%esi),%eax
+  800e8f:	85 c0                	test   %eax,%eax
+  800e91:	74 9d                	je     800e30 <file_set_size+0x19>
+    free_block(f->f_indirect);
+  800e93:	83 ec 0c             	sub    $0xc,%esp
+  800e96:	50                   	push   %eax
+  800e97:	e8 e3 f9 ff ff       	call   80087f <free_block>
+    f->f_indirect = 0;
+  800e9c:	c7 86 b0 00 00 00 00 	movl   $0x0,0xb0(%esi)
+  800ea3:	00 00 00 
+  800ea6:	83 c4 10             	add    $0x10,%esp
+  800ea9:	eb 85                	jmp    800e30 <file_set_size+0x19>
+      cprintf("warning: file_free_block: %e", r);
+  800eab:	83 ec 08             	sub    $0x8,%esp
+  800eae:	50                   	push   %eax
+  800eaf:	68 f7 42 80 00       	push   $0x8042f7
+  800eb4:	e8 1f 0d 00 00       	call   801bd8 <cprintf>
+  800eb9:	83 c4 10             	add    $0x10,%esp
+  for (bno = new_nblocks; bno < old_nblocks; bno++)
+  800ebc:	83 c3 01             	add    $0x1,%ebx
+  800ebf:	39 f3                	cmp    %esi,%ebx
+  800ec1:	73 b8                	jae    800e7b <file_set_size+0x64>
+  if ((r = file_block_walk(f, filebno, &ptr, 0)) < 0)
+  800ec3:	83 ec 0c             	sub    $0xc,%esp
+  800ec6:	6a 00                	push   $0x0
+  800ec8:	8d 4d e4             	lea    -0x1c(%ebp),%ecx
+  800ecb:	89 da                	mov    %ebx,%edx
+  800ecd:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ed0:	e8 45 fa ff ff       	call   80091a <file_block_walk>
+  800ed5:	83 c4 10             	add    $0x10,%esp
+  800ed8:	85 c0                	test   %eax,%eax
+  800eda:	78 cf                	js     800eab <file_set_size+0x94>
+  if (*ptr) {
+  800edc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800edf:	8b 07                	mov    (%edi),%eax
+  800ee1:	85 c0                	test   %eax,%eax
+  800ee3:	74 d7                	je     800ebc <file_set_size+0xa5>
+    free_block(*ptr);
+  800ee5:	83 ec 0c             	sub    $0xc,%esp
+  800ee8:	50                   	push   %eax
+  800ee9:	e8 91 f9 ff ff       	call   80087f <free_block>
+    *ptr = 0;
+  800eee:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  800ef4:	83 c4 10             	add    $0x10,%esp
+  800ef7:	eb c3                	jmp    800ebc <file_set_size+0xa5>
+
+00800ef9 <file_write>:
+file_write(struct File *f, const void *buf, size_t count, off_t offset) {
+  800ef9:	55                   	push   %ebp
+  800efa:	89 e5                	mov    %esp,%ebp
+  800efc:	57                   	push   %edi
+  800efd:	56                   	push   %esi
+  800efe:	53                   	push   %ebx
+  800eff:	83 ec 2c             	sub    $0x2c,%esp
+  800f02:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  if (offset + count > f->f_size)
+  800f05:	89 df                	mov    %ebx,%edi
+  800f07:	03 7d 10             	add    0x10(%ebp),%edi
+  800f0a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f0d:	39 b8 80 00 00 00    	cmp    %edi,0x80(%eax)
+  800f13:	72 70                	jb     800f85 <file_write+0x8c>
+  800f15:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  800f18:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  for (pos = offset; pos < offset + count;) {
+  800f1b:	89 de                	mov    %ebx,%esi
+  800f1d:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800f20:	39 c3                	cmp    %eax,%ebx
+  800f22:	73 78                	jae    800f9c <file_write+0xa3>
+    if ((r = file_get_block(f, pos / BLKSIZE, &blk)) < 0)
+  800f24:	83 ec 04             	sub    $0x4,%esp
+  800f27:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800f2a:	50                   	push   %eax
+  800f2b:	8d 83 ff 0f 00 00    	lea    0xfff(%ebx),%eax
+  800f31:	85 db                	test   %ebx,%ebx
+  800f33:	0f 49 c3             	cmovns %ebx,%eax
+  800f36:	c1 f8 0c             	sar    $0xc,%eax
+  800f39:	50                   	push   %eax
+  800f3a:	ff 75 08             	push   0x8(%ebp)
+  800f3d:	e8 90 fb ff ff       	call   800ad2 <file_get_block>
+  800f42:	83 c4 10             	add    $0x10,%esp
+  800f45:	85 c0                	test   %eax,%eax
+  800f47:	78 56                	js     800f9f <file_write+0xa6>
+    bn = MIN(BLKSIZE - pos % BLKSIZE, offset + count - pos);
+  800f49:	89 da                	mov    %ebx,%edx
+  800f4b:	c1 fa 1f             	sar    $0x1f,%edx
+  800f4e:	c1 ea 14             	shr    $0x14,%edx
+  800f51:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+  800f54:	25 ff 0f 00 00       	and    $0xfff,%eax
+  800f59:	29 d0                	sub    %edx,%eax
+  800f5b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  800f60:	29 c1                	sub    %eax,%ecx
+  800f62:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+  800f65:	29 f2                	sub    %esi,%edx
+  800f67:	39 d1                	cmp    %edx,%ecx
+  800f69:	89 d6                	mov    %edx,%esi
+  800f6b:	0f 46 f1             	cmovbe %ecx,%esi
+    memmove(blk + pos % BLKSIZE, buf, bn);
+  800f6e:	83 ec 04             	sub    $0x4,%esp
+  800f71:	56                   	push   %esi
+  800f72:	57                   	push   %edi
+  800f73:	03 45 e4             	add    -0x1c(%ebp),%eax
+  800f76:	50                   	push   %eax
+  800f77:	e8 9b 13 00 00       	call   802317 <memmove>
+    pos += bn;
+  800f7c:	01 f3                	add    %esi,%ebx
+    buf += bn;
+  800f7e:	01 f7                	add    %esi,%edi
+  800f80:	83 c4 10             	add    $0x10,%esp
+  800f83:	eb 96                	jmp    800f1b <file_write+0x22>
+    if ((r = file_set_size(f, offset + count)) < 0)
+  800f85:	83 ec 08             	sub    $0x8,%esp
+  800f88:	57                   	push   %edi
+  800f89:	50                   	push   %eax
+  800f8a:	e8 88 fe ff ff       	call   800e17 <file_set_size>
+  800f8f:	83 c4 10             	add    $0x10,%esp
+  800f92:	85 c0                	test   %eax,%eax
+  800f94:	0f 89 7b ff ff ff    	jns    800f15 <file_write+0x1c>
+  800f9a:	eb 03                	jmp    800f9f <file_write+0xa6>
+  return count;
+  800f9c:	8b 45 10             	mov    0x10(%ebp),%eax
+}
+  800f9f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fa2:	5b                   	pop    %ebx
+  800fa3:	5e                   	pop    %esi
+  800fa4:	5f                   	pop    %edi
+  800fa5:	5d                   	pop    %ebp
+  800fa6:	c3                   	ret
+
+00800fa7 <file_flush>:
+// Flush the contents and metadata of file f out to disk.
+// Loop over all the blocks in file.
+// Translate the file block number into a disk block number
+// and then check whether that disk block is dirty.  If so, write it out.
+void
+file_flush(struct File *f) {
+  800fa7:	55                   	push   %ebp
+  800fa8:	89 e5                	mov    %esp,%ebp
+  800faa:	56                   	push   %esi
+  800fab:	53                   	push   %ebx
+  800fac:	83 ec 10             	sub    $0x10,%esp
+  800faf:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i;
+  uint32_t *pdiskbno;
+
+  for (i = 0; i < (f->f_size + BLKSIZE - 1) / BLKSIZE; i++) {
+  800fb2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fb7:	eb 03                	jmp    800fbc <file_flush+0x15>
+  800fb9:	83 c3 01             	add    $0x1,%ebx
+  800fbc:	8b 96 80 00 00 00    	mov    0x80(%esi),%edx
+  800fc2:	8d 82 fe 1f 00 00    	lea    0x1ffe(%edx),%eax
+  800fc8:	81 c2 ff 0f 00 00    	add    $0xfff,%edx
+  800fce:	0f 49 c2             	cmovns %edx,%eax
+  800fd1:	c1 f8 0c             	sar    $0xc,%eax
+  800fd4:	39 d8                	cmp    %ebx,%eax
+  800fd6:	7e 3b                	jle    801013 <file_flush+0x6c>
+    if (file_block_walk(f, i, &pdiskbno, 0) < 0 ||
+  800fd8:	83 ec 0c             	sub    $0xc,%esp
+  800fdb:	6a 00                	push   $0x0
+  800fdd:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  800fe0:	89 da                	mov    %ebx,%edx
+  800fe2:	89 f0                	mov    %esi,%eax
+  800fe4:	e8 31 f9 ff ff       	call   80091a <file_block_walk>
+  800fe9:	83 c4 10             	add    $0x10,%esp
+  800fec:	85 c0                	test   %eax,%eax
+  800fee:	78 c9                	js     800fb9 <file_flush+0x12>
+        pdiskbno == NULL || *pdiskbno == 0)
+  800ff0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    if (file_block_walk(f, i, &pdiskbno, 0) < 0 ||
+  800ff3:	85 c0                	test   %eax,%eax
+  800ff5:	74 c2                	je     800fb9 <file_flush+0x12>
+        pdiskbno == NULL || *pdiskbno == 0)
+  800ff7:	8b 00                	mov    (%eax),%eax
+  800ff9:	85 c0                	test   %eax,%eax
+  800ffb:	74 bc                	je     800fb9 <file_flush+0x12>
+      continue;
+    flush_block(diskaddr(*pdiskbno));
+  800ffd:	83 ec 0c             	sub    $0xc,%esp
+  801000:	50                   	push   %eax
+  801001:	e8 a2 f3 ff ff       	call   8003a8 <diskaddr>
+  801006:	89 04 24             	mov    %eax,(%esp)
+  801009:	e8 18 f4 ff ff       	call   800426 <flush_block>
+  80100e:	83 c4 10             	add    $0x10,%esp
+  801011:	eb a6                	jmp    800fb9 <file_flush+0x12>
+  }
+  flush_block(f);
+  801013:	83 ec 0c             	sub    $0xc,%esp
+  801016:	56                   	push   %esi
+  801017:	e8 0a f4 ff ff       	call   800426 <flush_block>
+  if (f->f_indirect)
+  80101c:	8b 86 b0 00 00 00    	mov    0xb0(%esi),%eax
+  801022:	83 c4 10             	add    $0x10,%esp
+  801025:	85 c0                	test   %eax,%eax
+  801027:	75 07                	jne    801030 <file_flush+0x89>
+    flush_block(diskaddr(f->f_indirect));
+}
+  801029:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80102c:	5b                   	pop    %ebx
+  80102d:	5e                   	pop    %esi
+  80102e:	5d                   	pop    %ebp
+  80102f:	c3                   	ret
+    flush_block(diskaddr(f->f_indirect));
+  801030:	83 ec 0c             	sub    $0xc,%esp
+  801033:	50                   	push   %eax
+  801034:	e8 6f f3 ff ff       	call   8003a8 <diskaddr>
+  801039:	89 04 24             	mov    %eax,(%esp)
+  80103c:	e8 e5 f3 ff ff       	call   800426 <flush_block>
+  801041:	83 c4 10             	add    $0x10,%esp
+}
+  801044:	eb e3                	jmp    801029 <file_flush+0x82>
+
+00801046 <file_create>:
+file_create(const char *path, struct File **pf) {
+  801046:	55                   	push   %ebp
+  801047:	89 e5                	mov    %esp,%ebp
+  801049:	57                   	push   %edi
+  80104a:	56                   	push   %esi
+  80104b:	53                   	push   %ebx
+  80104c:	81 ec b8 00 00 00    	sub    $0xb8,%esp
+  if ((r = walk_path(path, &dir, &f, name)) == 0)
+  801052:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  801058:	50                   	push   %eax
+  801059:	8d 8d 60 ff ff ff    	lea    -0xa0(%ebp),%ecx
+  80105f:	8d 95 64 ff ff ff    	lea    -0x9c(%ebp),%edx
+  801065:	8b 45 08             	mov    0x8(%ebp),%eax
+  801068:	e8 b2 fa ff ff       	call   800b1f <walk_path>
+  80106d:	83 c4 10             	add    $0x10,%esp
+  801070:	85 c0                	test   %eax,%eax
+  801072:	0f 84 cd 00 00 00    	je     801145 <file_create+0xff>
+  801078:	89 c3                	mov    %eax,%ebx
+  if (r != -E_NOT_FOUND || dir == 0)
+  80107a:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80107d:	0f 85 f1 00 00 00    	jne    801174 <file_create+0x12e>
+  801083:	8b bd 64 ff ff ff    	mov    -0x9c(%ebp),%edi
+  801089:	85 ff                	test   %edi,%edi
+  80108b:	0f 84 e3 00 00 00    	je     801174 <file_create+0x12e>
+  assert((dir->f_size % BLKSIZE) == 0);
+  801091:	8b 87 80 00 00 00    	mov    0x80(%edi),%eax
+  801097:	89 c3                	mov    %eax,%ebx
+  801099:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  80109f:	75 58                	jne    8010f9 <file_create+0xb3>
+  nblock = dir->f_size / BLKSIZE;
+  8010a1:	8d 90 ff 0f 00 00    	lea    0xfff(%eax),%edx
+  8010a7:	85 c0                	test   %eax,%eax
+  8010a9:	0f 48 c2             	cmovs  %edx,%eax
+  8010ac:	c1 f8 0c             	sar    $0xc,%eax
+  8010af:	89 85 54 ff ff ff    	mov    %eax,-0xac(%ebp)
+  for (i = 0; i < nblock; i++) {
+  8010b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8010ba:	39 b5 54 ff ff ff    	cmp    %esi,-0xac(%ebp)
+  8010c0:	74 55                	je     801117 <file_create+0xd1>
+    if ((r = file_get_block(dir, i, &blk)) < 0)
+  8010c2:	83 ec 04             	sub    $0x4,%esp
+  8010c5:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  8010cb:	50                   	push   %eax
+  8010cc:	56                   	push   %esi
+  8010cd:	57                   	push   %edi
+  8010ce:	e8 ff f9 ff ff       	call   800ad2 <file_get_block>
+  8010d3:	83 c4 10             	add    $0x10,%esp
+  8010d6:	85 c0                	test   %eax,%eax
+  8010d8:	78 67                	js     801141 <file_create+0xfb>
+    for (j = 0; j < BLKFILES; j++)
+  8010da:	8b 85 5c ff ff ff    	mov    -0xa4(%ebp),%eax
+  8010e0:	8d 88 00 10 00 00    	lea    0x1000(%eax),%ecx
+  8010e6:	39 c8                	cmp    %ecx,%eax
+  8010e8:	74 28                	je     801112 <file_create+0xcc>
+      if (f[j].f_name[0] == '\0') {
+  8010ea:	8d 90 00 01 00 00    	lea    0x100(%eax),%edx
+  8010f0:	80 38 00             	cmpb   $0x0,(%eax)
+  8010f3:	74 57                	je     80114c <file_create+0x106>
+  8010f5:	89 d0                	mov    %edx,%eax
+  8010f7:	eb ed                	jmp    8010e6 <file_create+0xa0>
+  assert((dir->f_size % BLKSIZE) == 0);
+  8010f9:	68 da 42 80 00       	push   $0x8042da
+  8010fe:	68 1d 40 80 00       	push   $0x80401d
+  801103:	68 e2 00 00 00       	push   $0xe2
+  801108:	68 40 42 80 00       	push   $0x804240
+  80110d:	e8 eb 09 00 00       	call   801afd <_panic>
+  for (i = 0; i < nblock; i++) {
+  801112:	83 c6 01             	add    $0x1,%esi
+  801115:	eb a3                	jmp    8010ba <file_create+0x74>
+  dir->f_size += BLKSIZE;
+  801117:	81 87 80 00 00 00 00 	addl   $0x1000,0x80(%edi)
+  80111e:	10 00 00 
+  if ((r = file_get_block(dir, i, &blk)) < 0)
+  801121:	83 ec 04             	sub    $0x4,%esp
+  801124:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  80112a:	50                   	push   %eax
+  80112b:	56                   	push   %esi
+  80112c:	57                   	push   %edi
+  80112d:	e8 a0 f9 ff ff       	call   800ad2 <file_get_block>
+  801132:	83 c4 10             	add    $0x10,%esp
+  801135:	85 c0                	test   %eax,%eax
+  801137:	78 45                	js     80117e <file_create+0x138>
+  f = (struct File *) blk;
+  801139:	8b b5 5c ff ff ff    	mov    -0xa4(%ebp),%esi
+  return 0;
+  80113f:	eb 0d                	jmp    80114e <file_create+0x108>
+    if ((r = file_get_block(dir, i, &blk)) < 0)
+  801141:	89 c3                	mov    %eax,%ebx
+  801143:	eb 2f                	jmp    801174 <file_create+0x12e>
+    return -E_FILE_EXISTS;
+  801145:	bb f3 ff ff ff       	mov    $0xfffffff3,%ebx
+  80114a:	eb 28                	jmp    801174 <file_create+0x12e>
+      if (f[j].f_name[0] == '\0') {
+  80114c:	89 c6                	mov    %eax,%esi
+  *file = &f[0];
+  80114e:	89 b5 60 ff ff ff    	mov    %esi,-0xa0(%ebp)
+  strcpy(f->f_name, name);
+  801154:	83 ec 08             	sub    $0x8,%esp
+  801157:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  80115d:	50                   	push   %eax
+  80115e:	56                   	push   %esi
+  80115f:	e8 2d 10 00 00       	call   802191 <strcpy>
+  *pf = f;
+  801164:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801167:	89 30                	mov    %esi,(%eax)
+  file_flush(dir);
+  801169:	89 3c 24             	mov    %edi,(%esp)
+  80116c:	e8 36 fe ff ff       	call   800fa7 <file_flush>
+  return 0;
+  801171:	83 c4 10             	add    $0x10,%esp
+}
+  801174:	89 d8                	mov    %ebx,%eax
+  801176:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801179:	5b                   	pop    %ebx
+  80117a:	5e                   	pop    %esi
+  80117b:	5f                   	pop    %edi
+  80117c:	5d                   	pop    %ebp
+  80117d:	c3                   	ret
+    return r;
+  80117e:	89 c3                	mov    %eax,%ebx
+  801180:	eb f2                	jmp    801174 <file_create+0x12e>
+
+00801182 <fs_sync>:
+
+
+// Sync the entire file system.  A big hammer.
+void
+fs_sync(void) {
+  801182:	55                   	push   %ebp
+  801183:	89 e5                	mov    %esp,%ebp
+  801185:	53                   	push   %ebx
+  801186:	83 ec 04             	sub    $0x4,%esp
+  int i;
+  for (i = 1; i < super->s_nblocks; i++)
+  801189:	bb 01 00 00 00       	mov    $0x1,%ebx
+  80118e:	eb 17                	jmp    8011a7 <fs_sync+0x25>
+    flush_block(diskaddr(i));
+  801190:	83 ec 0c             	sub    $0xc,%esp
+  801193:	53                   	push   %ebx
+  801194:	e8 0f f2 ff ff       	call   8003a8 <diskaddr>
+  801199:	89 04 24             	mov    %eax,(%esp)
+  80119c:	e8 85 f2 ff ff       	call   800426 <flush_block>
+  for (i = 1; i < super->s_nblocks; i++)
+  8011a1:	83 c3 01             	add    $0x1,%ebx
+  8011a4:	83 c4 10             	add    $0x10,%esp
+  8011a7:	a1 0c a0 80 00       	mov    0x80a00c,%eax
+  8011ac:	3b 58 04             	cmp    0x4(%eax),%ebx
+  8011af:	72 df                	jb     801190 <fs_sync+0xe>
+}
+  8011b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8011b4:	c9                   	leave
+  8011b5:	c3                   	ret
+
+008011b6 <serve_sync>:
+  return 0;
+}
+
+
+int
+serve_sync(envid_t envid, union Fsipc *req) {
+  8011b6:	55                   	push   %ebp
+  8011b7:	89 e5                	mov    %esp,%ebp
+  8011b9:	83 ec 08             	sub    $0x8,%esp
+  fs_sync();
+  8011bc:	e8 c1 ff ff ff       	call   801182 <fs_sync>
+  return 0;
+}
+  8011c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011c6:	c9                   	leave
+  8011c7:	c3                   	ret
+
+008011c8 <serve_init>:
+  for (i = 0; i < MAXOPEN; i++) {
+  8011c8:	ba 60 50 80 00       	mov    $0x805060,%edx
+  uintptr_t va = FILEVA;
+  8011cd:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  for (i = 0; i < MAXOPEN; i++) {
+  8011d2:	b9 00 00 00 00       	mov    $0x0,%ecx
+    opentab[i].o_fileid = i;
+  8011d7:	89 0a                	mov    %ecx,(%edx)
+    opentab[i].o_fd = (struct Fd *) va;
+  8011d9:	89 42 0c             	mov    %eax,0xc(%edx)
+    va += PGSIZE;
+  8011dc:	05 00 10 00 00       	add    $0x1000,%eax
+  for (i = 0; i < MAXOPEN; i++) {
+  8011e1:	83 c1 01             	add    $0x1,%ecx
+  8011e4:	83 c2 10             	add    $0x10,%edx
+  8011e7:	3d 00 00 40 d0       	cmp    $0xd0400000,%eax
+  8011ec:	75 e9                	jne    8011d7 <serve_init+0xf>
+}
+  8011ee:	c3                   	ret
+
+008011ef <openfile_alloc>:
+openfile_alloc(struct OpenFile **o) {
+  8011ef:	55                   	push   %ebp
+  8011f0:	89 e5                	mov    %esp,%ebp
+  8011f2:	57                   	push   %edi
+  8011f3:	56                   	push   %esi
+  8011f4:	53                   	push   %ebx
+  8011f5:	83 ec 0c             	sub    $0xc,%esp
+  8011f8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for (i = 0; i < MAXOPEN; i++) {
+  8011fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+    switch (pageref(opentab[i].o_fd)) {
+  801200:	89 de                	mov    %ebx,%esi
+  801202:	c1 e6 04             	shl    $0x4,%esi
+  801205:	83 ec 0c             	sub    $0xc,%esp
+  801208:	ff b6 6c 50 80 00    	push   0x80506c(%esi)
+  80120e:	e8 be 1f 00 00       	call   8031d1 <pageref>
+  801213:	83 c4 10             	add    $0x10,%esp
+  801216:	85 c0                	test   %eax,%eax
+  801218:	74 17                	je     801231 <openfile_alloc+0x42>
+  80121a:	83 f8 01             	cmp    $0x1,%eax
+  80121d:	74 30                	je     80124f <openfile_alloc+0x60>
+  for (i = 0; i < MAXOPEN; i++) {
+  80121f:	83 c3 01             	add    $0x1,%ebx
+  801222:	81 fb 00 04 00 00    	cmp    $0x400,%ebx
+  801228:	75 d6                	jne    801200 <openfile_alloc+0x11>
+  return -E_MAX_OPEN;
+  80122a:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  80122f:	eb 4f                	jmp    801280 <openfile_alloc+0x91>
+        if ((r = sys_page_alloc(0, opentab[i].o_fd, PTE_P | PTE_U | PTE_W)) < 0)
+  801231:	83 ec 04             	sub    $0x4,%esp
+  801234:	6a 07                	push   $0x7
+  801236:	89 d8                	mov    %ebx,%eax
+  801238:	c1 e0 04             	shl    $0x4,%eax
+  80123b:	ff b0 6c 50 80 00    	push   0x80506c(%eax)
+  801241:	6a 00                	push   $0x0
+  801243:	e8 35 13 00 00       	call   80257d <sys_page_alloc>
+  801248:	83 c4 10             	add    $0x10,%esp
+  80124b:	85 c0                	test   %eax,%eax
+  80124d:	78 31                	js     801280 <openfile_alloc+0x91>
+        opentab[i].o_fileid += MAXOPEN;
+  80124f:	c1 e3 04             	shl    $0x4,%ebx
+  801252:	81 83 60 50 80 00 00 	addl   $0x400,0x805060(%ebx)
+  801259:	04 00 00 
+        *o = &opentab[i];
+  80125c:	81 c6 60 50 80 00    	add    $0x805060,%esi
+  801262:	89 37                	mov    %esi,(%edi)
+        memset(opentab[i].o_fd, 0, PGSIZE);
+  801264:	83 ec 04             	sub    $0x4,%esp
+  801267:	68 00 10 00 00       	push   $0x1000
+  80126c:	6a 00                	push   $0x0
+  80126e:	ff b3 6c 50 80 00    	push   0x80506c(%ebx)
+  801274:	e8 69 10 00 00       	call   8022e2 <memset>
+        return (*o)->o_fileid;
+  801279:	8b 07                	mov    (%edi),%eax
+  80127b:	8b 00                	mov    (%eax),%eax
+  80127d:	83 c4 10             	add    $0x10,%esp
+}
+  801280:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801283:	5b                   	pop    %ebx
+  801284:	5e                   	pop    %esi
+  801285:	5f                   	pop    %edi
+  801286:	5d                   	pop    %ebp
+  801287:	c3                   	ret
+
+00801288 <openfile_lookup>:
+openfile_lookup(envid_t envid, uint32_t fileid, struct OpenFile **po) {
+  801288:	55                   	push   %ebp
+  801289:	89 e5                	mov    %esp,%ebp
+  80128b:	57                   	push   %edi
+  80128c:	56                   	push   %esi
+  80128d:	53                   	push   %ebx
+  80128e:	83 ec 18             	sub    $0x18,%esp
+  801291:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  o = &opentab[fileid % MAXOPEN];
+  801294:	89 fb                	mov    %edi,%ebx
+  801296:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  80129c:	89 de                	mov    %ebx,%esi
+  80129e:	c1 e6 04             	shl    $0x4,%esi
+  if (pageref(o->o_fd) <= 1 || o->o_fileid != fileid)
+  8012a1:	ff b6 6c 50 80 00    	push   0x80506c(%esi)
+  o = &opentab[fileid % MAXOPEN];
+  8012a7:	81 c6 60 50 80 00    	add    $0x805060,%esi
+  if (pageref(o->o_fd) <= 1 || o->o_fileid != fileid)
+  8012ad:	e8 1f 1f 00 00       	call   8031d1 <pageref>
+  8012b2:	83 c4 10             	add    $0x10,%esp
+  8012b5:	83 f8 01             	cmp    $0x1,%eax
+  8012b8:	7e 1d                	jle    8012d7 <openfile_lookup+0x4f>
+  8012ba:	c1 e3 04             	shl    $0x4,%ebx
+  8012bd:	39 bb 60 50 80 00    	cmp    %edi,0x805060(%ebx)
+  8012c3:	75 19                	jne    8012de <openfile_lookup+0x56>
+  *po = o;
+  8012c5:	8b 45 10             	mov    0x10(%ebp),%eax
+  8012c8:	89 30                	mov    %esi,(%eax)
+  return 0;
+  8012ca:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8012cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012d2:	5b                   	pop    %ebx
+  8012d3:	5e                   	pop    %esi
+  8012d4:	5f                   	pop    %edi
+  8012d5:	5d                   	pop    %ebp
+  8012d6:	c3                   	ret
+    return -E_INVAL;
+  8012d7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012dc:	eb f1                	jmp    8012cf <openfile_lookup+0x47>
+  8012de:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012e3:	eb ea                	jmp    8012cf <openfile_lookup+0x47>
+
+008012e5 <serve_set_size>:
+serve_set_size(envid_t envid, struct Fsreq_set_size *req) {
+  8012e5:	55                   	push   %ebp
+  8012e6:	89 e5                	mov    %esp,%ebp
+  8012e8:	53                   	push   %ebx
+  8012e9:	83 ec 18             	sub    $0x18,%esp
+  8012ec:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  8012ef:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8012f2:	50                   	push   %eax
+  8012f3:	ff 33                	push   (%ebx)
+  8012f5:	ff 75 08             	push   0x8(%ebp)
+  8012f8:	e8 8b ff ff ff       	call   801288 <openfile_lookup>
+  8012fd:	83 c4 10             	add    $0x10,%esp
+  801300:	85 c0                	test   %eax,%eax
+  801302:	78 14                	js     801318 <serve_set_size+0x33>
+  return file_set_size(o->o_file, req->req_size);
+  801304:	83 ec 08             	sub    $0x8,%esp
+  801307:	ff 73 04             	push   0x4(%ebx)
+  80130a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80130d:	ff 70 04             	push   0x4(%eax)
+  801310:	e8 02 fb ff ff       	call   800e17 <file_set_size>
+  801315:	83 c4 10             	add    $0x10,%esp
+}
+  801318:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80131b:	c9                   	leave
+  80131c:	c3                   	ret
+
+0080131d <serve_read>:
+serve_read(envid_t envid, union Fsipc *ipc) {
+  80131d:	55                   	push   %ebp
+  80131e:	89 e5                	mov    %esp,%ebp
+  801320:	56                   	push   %esi
+  801321:	53                   	push   %ebx
+  801322:	83 ec 14             	sub    $0x14,%esp
+  801325:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  801328:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80132b:	50                   	push   %eax
+  80132c:	ff 33                	push   (%ebx)
+  80132e:	ff 75 08             	push   0x8(%ebp)
+  801331:	e8 52 ff ff ff       	call   801288 <openfile_lookup>
+  801336:	83 c4 10             	add    $0x10,%esp
+  801339:	85 c0                	test   %eax,%eax
+  80133b:	78 2d                	js     80136a <serve_read+0x4d>
+  if ((r = file_read(o->o_file, ret->ret_buf, MIN(req->req_n, sizeof(ret->ret_buf)), o->o_fd->fd_offset)) < 0)
+  80133d:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  801340:	8b 46 0c             	mov    0xc(%esi),%eax
+  801343:	ff 70 04             	push   0x4(%eax)
+  801346:	8b 43 04             	mov    0x4(%ebx),%eax
+  801349:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80134e:	39 d0                	cmp    %edx,%eax
+  801350:	0f 47 c2             	cmova  %edx,%eax
+  801353:	50                   	push   %eax
+  801354:	53                   	push   %ebx
+  801355:	ff 76 04             	push   0x4(%esi)
+  801358:	e8 09 fa ff ff       	call   800d66 <file_read>
+  80135d:	83 c4 10             	add    $0x10,%esp
+  801360:	85 c0                	test   %eax,%eax
+  801362:	78 06                	js     80136a <serve_read+0x4d>
+  o->o_fd->fd_offset += r;
+  801364:	8b 56 0c             	mov    0xc(%esi),%edx
+  801367:	01 42 04             	add    %eax,0x4(%edx)
+}
+  80136a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80136d:	5b                   	pop    %ebx
+  80136e:	5e                   	pop    %esi
+  80136f:	5d                   	pop    %ebp
+  801370:	c3                   	ret
+
+00801371 <serve_write>:
+serve_write(envid_t envid, struct Fsreq_write *req) {
+  801371:	55                   	push   %ebp
+  801372:	89 e5                	mov    %esp,%ebp
+  801374:	56                   	push   %esi
+  801375:	53                   	push   %ebx
+  801376:	83 ec 14             	sub    $0x14,%esp
+  801379:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  80137c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80137f:	50                   	push   %eax
+  801380:	ff 33                	push   (%ebx)
+  801382:	ff 75 08             	push   0x8(%ebp)
+  801385:	e8 fe fe ff ff       	call   801288 <openfile_lookup>
+  80138a:	83 c4 10             	add    $0x10,%esp
+  80138d:	85 c0                	test   %eax,%eax
+  80138f:	78 25                	js     8013b6 <serve_write+0x45>
+  if ((r = file_write(o->o_file, req->req_buf, req->req_n, o->o_fd->fd_offset)) < 0)
+  801391:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  801394:	8b 46 0c             	mov    0xc(%esi),%eax
+  801397:	ff 70 04             	push   0x4(%eax)
+  80139a:	ff 73 04             	push   0x4(%ebx)
+  80139d:	83 c3 08             	add    $0x8,%ebx
+  8013a0:	53                   	push   %ebx
+  8013a1:	ff 76 04             	push   0x4(%esi)
+  8013a4:	e8 50 fb ff ff       	call   800ef9 <file_write>
+  8013a9:	83 c4 10             	add    $0x10,%esp
+  8013ac:	85 c0                	test   %eax,%eax
+  8013ae:	78 06                	js     8013b6 <serve_write+0x45>
+  o->o_fd->fd_offset += r;
+  8013b0:	8b 56 0c             	mov    0xc(%esi),%edx
+  8013b3:	01 42 04             	add    %eax,0x4(%edx)
+}
+  8013b6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013b9:	5b                   	pop    %ebx
+  8013ba:	5e                   	pop    %esi
+  8013bb:	5d                   	pop    %ebp
+  8013bc:	c3                   	ret
+
+008013bd <serve_stat>:
+serve_stat(envid_t envid, union Fsipc *ipc) {
+  8013bd:	55                   	push   %ebp
+  8013be:	89 e5                	mov    %esp,%ebp
+  8013c0:	56                   	push   %esi
+  8013c1:	53                   	push   %ebx
+  8013c2:	83 ec 14             	sub    $0x14,%esp
+  8013c5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  8013c8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013cb:	50                   	push   %eax
+  8013cc:	ff 33                	push   (%ebx)
+  8013ce:	ff 75 08             	push   0x8(%ebp)
+  8013d1:	e8 b2 fe ff ff       	call   801288 <openfile_lookup>
+  8013d6:	83 c4 10             	add    $0x10,%esp
+  8013d9:	85 c0                	test   %eax,%eax
+  8013db:	78 3c                	js     801419 <serve_stat+0x5c>
+  strcpy(ret->ret_name, o->o_file->f_name);
+  8013dd:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  8013e0:	83 ec 08             	sub    $0x8,%esp
+  8013e3:	ff 76 04             	push   0x4(%esi)
+  8013e6:	53                   	push   %ebx
+  8013e7:	e8 a5 0d 00 00       	call   802191 <strcpy>
+  ret->ret_size = o->o_file->f_size;
+  8013ec:	8b 46 04             	mov    0x4(%esi),%eax
+  8013ef:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  8013f5:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  ret->ret_isdir = (o->o_file->f_type == FTYPE_DIR);
+  8013fb:	8b 46 04             	mov    0x4(%esi),%eax
+  8013fe:	83 c4 10             	add    $0x10,%esp
+  801401:	83 b8 84 00 00 00 01 	cmpl   $0x1,0x84(%eax)
+  801408:	0f 94 c0             	sete   %al
+  80140b:	0f b6 c0             	movzbl %al,%eax
+  80140e:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801414:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801419:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80141c:	5b                   	pop    %ebx
+  80141d:	5e                   	pop    %esi
+  80141e:	5d                   	pop    %ebp
+  80141f:	c3                   	ret
+
+00801420 <serve_flush>:
+serve_flush(envid_t envid, struct Fsreq_flush *req) {
+  801420:	55                   	push   %ebp
+  801421:	89 e5                	mov    %esp,%ebp
+  801423:	83 ec 1c             	sub    $0x1c,%esp
+  if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  801426:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801429:	50                   	push   %eax
+  80142a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80142d:	ff 30                	push   (%eax)
+  80142f:	ff 75 08             	push   0x8(%ebp)
+  801432:	e8 51 fe ff ff       	call   801288 <openfile_lookup>
+  801437:	83 c4 10             	add    $0x10,%esp
+  80143a:	85 c0                	test   %eax,%eax
+  80143c:	78 16                	js     801454 <serve_flush+0x34>
+  file_flush(o->o_file);
+  80143e:	83 ec 0c             	sub    $0xc,%esp
+  801441:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801444:	ff 70 04             	push   0x4(%eax)
+  801447:	e8 5b fb ff ff       	call   800fa7 <file_flush>
+  return 0;
+  80144c:	83 c4 10             	add    $0x10,%esp
+  80144f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801454:	c9                   	leave
+  801455:	c3                   	ret
+
+00801456 <serve_open>:
+           void **pg_store, int *perm_store) {
+  801456:	55                   	push   %ebp
+  801457:	89 e5                	mov    %esp,%ebp
+  801459:	53                   	push   %ebx
+  80145a:	81 ec 18 04 00 00    	sub    $0x418,%esp
+  801460:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  memmove(path, req->req_path, MAXPATHLEN);
+  801463:	68 00 04 00 00       	push   $0x400
+  801468:	53                   	push   %ebx
+  801469:	8d 85 f8 fb ff ff    	lea    -0x408(%ebp),%eax
+  80146f:	50                   	push   %eax
+  801470:	e8 a2 0e 00 00       	call   802317 <memmove>
+  path[MAXPATHLEN - 1] = 0;
+  801475:	c6 45 f7 00          	movb   $0x0,-0x9(%ebp)
+  if ((r = openfile_alloc(&o)) < 0) {
+  801479:	8d 85 f0 fb ff ff    	lea    -0x410(%ebp),%eax
+  80147f:	89 04 24             	mov    %eax,(%esp)
+  801482:	e8 68 fd ff ff       	call   8011ef <openfile_alloc>
+  801487:	83 c4 10             	add    $0x10,%esp
+  80148a:	85 c0                	test   %eax,%eax
+  80148c:	0f 88 ea 00 00 00    	js     80157c <serve_open+0x126>
+  if (req->req_omode & O_CREAT) {
+  801492:	f6 83 01 04 00 00 01 	testb  $0x1,0x401(%ebx)
+  801499:	74 33                	je     8014ce <serve_open+0x78>
+    if ((r = file_create(path, &f)) < 0) {
+  80149b:	83 ec 08             	sub    $0x8,%esp
+  80149e:	8d 85 f4 fb ff ff    	lea    -0x40c(%ebp),%eax
+  8014a4:	50                   	push   %eax
+  8014a5:	8d 85 f8 fb ff ff    	lea    -0x408(%ebp),%eax
+  8014ab:	50                   	push   %eax
+  8014ac:	e8 95 fb ff ff       	call   801046 <file_create>
+  8014b1:	83 c4 10             	add    $0x10,%esp
+  8014b4:	85 c0                	test   %eax,%eax
+  8014b6:	79 37                	jns    8014ef <serve_open+0x99>
+      if (!(req->req_omode & O_EXCL) && r == -E_FILE_EXISTS)
+  8014b8:	f6 83 01 04 00 00 04 	testb  $0x4,0x401(%ebx)
+  8014bf:	0f 85 b7 00 00 00    	jne    80157c <serve_open+0x126>
+  8014c5:	83 f8 f3             	cmp    $0xfffffff3,%eax
+  8014c8:	0f 85 ae 00 00 00    	jne    80157c <serve_open+0x126>
+    if ((r = file_open(path, &f)) < 0) {
+  8014ce:	83 ec 08             	sub    $0x8,%esp
+  8014d1:	8d 85 f4 fb ff ff    	lea    -0x40c(%ebp),%eax
+  8014d7:	50                   	push   %eax
+  8014d8:	8d 85 f8 fb ff ff    	lea    -0x408(%ebp),%eax
+  8014de:	50                   	push   %eax
+  8014df:	e8 68 f8 ff ff       	call   800d4c <file_open>
+  8014e4:	83 c4 10             	add    $0x10,%esp
+  8014e7:	85 c0                	test   %eax,%eax
+  8014e9:	0f 88 8d 00 00 00    	js     80157c <serve_open+0x126>
+  if (req->req_omode & O_TRUNC) {
+  8014ef:	f6 83 01 04 00 00 02 	testb  $0x2,0x401(%ebx)
+  8014f6:	74 17                	je     80150f <serve_open+0xb9>
+    if ((r = file_set_size(f, 0)) < 0) {
+  8014f8:	83 ec 08             	sub    $0x8,%esp
+  8014fb:	6a 00                	push   $0x0
+  8014fd:	ff b5 f4 fb ff ff    	push   -0x40c(%ebp)
+  801503:	e8 0f f9 ff ff       	call   800e17 <file_set_size>
+  801508:	83 c4 10             	add    $0x10,%esp
+  80150b:	85 c0                	test   %eax,%eax
+  80150d:	78 6d                	js     80157c <serve_open+0x126>
+  if ((r = file_open(path, &f)) < 0) {
+  80150f:	83 ec 08             	sub    $0x8,%esp
+  801512:	8d 85 f4 fb ff ff    	lea    -0x40c(%ebp),%eax
+  801518:	50                   	push   %eax
+  801519:	8d 85 f8 fb ff ff    	lea    -0x408(%ebp),%eax
+  80151f:	50                   	push   %eax
+  801520:	e8 27 f8 ff ff       	call   800d4c <file_open>
+  801525:	83 c4 10             	add    $0x10,%esp
+  801528:	85 c0                	test   %eax,%eax
+  80152a:	78 50                	js     80157c <serve_open+0x126>
+  o->o_file = f;
+  80152c:	8b 85 f0 fb ff ff    	mov    -0x410(%ebp),%eax
+  801532:	8b 95 f4 fb ff ff    	mov    -0x40c(%ebp),%edx
+  801538:	89 50 04             	mov    %edx,0x4(%eax)
+  o->o_fd->fd_file.id = o->o_fileid;
+  80153b:	8b 50 0c             	mov    0xc(%eax),%edx
+  80153e:	8b 08                	mov    (%eax),%ecx
+  801540:	89 4a 0c             	mov    %ecx,0xc(%edx)
+  o->o_fd->fd_omode = req->req_omode & O_ACCMODE;
+  801543:	8b 48 0c             	mov    0xc(%eax),%ecx
+  801546:	8b 93 00 04 00 00    	mov    0x400(%ebx),%edx
+  80154c:	83 e2 03             	and    $0x3,%edx
+  80154f:	89 51 08             	mov    %edx,0x8(%ecx)
+  o->o_fd->fd_dev_id = devfile.dev_id;
+  801552:	8b 50 0c             	mov    0xc(%eax),%edx
+  801555:	8b 0d 64 90 80 00    	mov    0x809064,%ecx
+  80155b:	89 0a                	mov    %ecx,(%edx)
+  o->o_mode = req->req_omode;
+  80155d:	8b 93 00 04 00 00    	mov    0x400(%ebx),%edx
+  801563:	89 50 08             	mov    %edx,0x8(%eax)
+  *pg_store = o->o_fd;
+  801566:	8b 50 0c             	mov    0xc(%eax),%edx
+  801569:	8b 45 10             	mov    0x10(%ebp),%eax
+  80156c:	89 10                	mov    %edx,(%eax)
+  *perm_store = PTE_P | PTE_U | PTE_W | PTE_SHARE;
+  80156e:	8b 45 14             	mov    0x14(%ebp),%eax
+  801571:	c7 00 07 04 00 00    	movl   $0x407,(%eax)
+  return 0;
+  801577:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80157c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80157f:	c9                   	leave
+  801580:	c3                   	ret
+
+00801581 <serve>:
+  [FSREQ_SET_SIZE] =  (fshandler) serve_set_size,
+  [FSREQ_SYNC] =    serve_sync
+};
+
+void
+serve(void) {
+  801581:	55                   	push   %ebp
+  801582:	89 e5                	mov    %esp,%ebp
+  801584:	56                   	push   %esi
+  801585:	53                   	push   %ebx
+  801586:	83 ec 10             	sub    $0x10,%esp
+  int perm, r;
+  void *pg;
+
+  while (1) {
+    perm = 0;
+    req = ipc_recv((int32_t *) &whom, fsreq, &perm);
+  801589:	8d 5d f0             	lea    -0x10(%ebp),%ebx
+  80158c:	8d 75 f4             	lea    -0xc(%ebp),%esi
+  80158f:	eb 13                	jmp    8015a4 <serve+0x23>
+      cprintf("fs req %d from %08x [page %08x: %s]\n",
+              req, whom, uvpt[PGNUM(fsreq)], fsreq);
+
+    // All requests must contain an argument page
+    if (!(perm & PTE_P)) {
+      cprintf("Invalid request from %08x: no argument page\n",
+  801591:	83 ec 08             	sub    $0x8,%esp
+  801594:	ff 75 f4             	push   -0xc(%ebp)
+  801597:	68 14 43 80 00       	push   $0x804314
+  80159c:	e8 37 06 00 00       	call   801bd8 <cprintf>
+              whom);
+      continue; // just leave it hanging...
+  8015a1:	83 c4 10             	add    $0x10,%esp
+    perm = 0;
+  8015a4:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    req = ipc_recv((int32_t *) &whom, fsreq, &perm);
+  8015ab:	83 ec 04             	sub    $0x4,%esp
+  8015ae:	53                   	push   %ebx
+  8015af:	ff 35 44 50 80 00    	push   0x805044
+  8015b5:	56                   	push   %esi
+  8015b6:	e8 24 13 00 00       	call   8028df <ipc_recv>
+    if (!(perm & PTE_P)) {
+  8015bb:	83 c4 10             	add    $0x10,%esp
+  8015be:	f6 45 f0 01          	testb  $0x1,-0x10(%ebp)
+  8015c2:	74 cd                	je     801591 <serve+0x10>
+    }
+
+    pg = NULL;
+  8015c4:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    if (req == FSREQ_OPEN) {
+  8015cb:	83 f8 01             	cmp    $0x1,%eax
+  8015ce:	74 23                	je     8015f3 <serve+0x72>
+      r = serve_open(whom, (struct Fsreq_open *) fsreq, &pg, &perm);
+    } else if (req < ARRAY_SIZE(handlers) && handlers[req]) {
+  8015d0:	83 f8 08             	cmp    $0x8,%eax
+  8015d3:	77 36                	ja     80160b <serve+0x8a>
+  8015d5:	8b 14 85 20 50 80 00 	mov    0x805020(,%eax,4),%edx
+  8015dc:	85 d2                	test   %edx,%edx
+  8015de:	74 2b                	je     80160b <serve+0x8a>
+      r = handlers[req](whom, fsreq);
+  8015e0:	83 ec 08             	sub    $0x8,%esp
+  8015e3:	ff 35 44 50 80 00    	push   0x805044
+  8015e9:	ff 75 f4             	push   -0xc(%ebp)
+  8015ec:	ff d2                	call   *%edx
+  8015ee:	83 c4 10             	add    $0x10,%esp
+  8015f1:	eb 31                	jmp    801624 <serve+0xa3>
+      r = serve_open(whom, (struct Fsreq_open *) fsreq, &pg, &perm);
+  8015f3:	53                   	push   %ebx
+  8015f4:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8015f7:	50                   	push   %eax
+  8015f8:	ff 35 44 50 80 00    	push   0x805044
+  8015fe:	ff 75 f4             	push   -0xc(%ebp)
+  801601:	e8 50 fe ff ff       	call   801456 <serve_open>
+  801606:	83 c4 10             	add    $0x10,%esp
+  801609:	eb 19                	jmp    801624 <serve+0xa3>
+    } else {
+      cprintf("Invalid request code %d from %08x\n", req, whom);
+  80160b:	83 ec 04             	sub    $0x4,%esp
+  80160e:	ff 75 f4             	push   -0xc(%ebp)
+  801611:	50                   	push   %eax
+  801612:	68 44 43 80 00       	push   $0x804344
+  801617:	e8 bc 05 00 00       	call   801bd8 <cprintf>
+  80161c:	83 c4 10             	add    $0x10,%esp
+      r = -E_INVAL;
+  80161f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    }
+    ipc_send(whom, r, pg, perm);
+  801624:	ff 75 f0             	push   -0x10(%ebp)
+  801627:	ff 75 ec             	push   -0x14(%ebp)
+  80162a:	50                   	push   %eax
+  80162b:	ff 75 f4             	push   -0xc(%ebp)
+  80162e:	e8 20 13 00 00       	call   802953 <ipc_send>
+    sys_page_unmap(0, fsreq);
+  801633:	83 c4 08             	add    $0x8,%esp
+  801636:	ff 35 44 50 80 00    	push   0x805044
+  80163c:	6a 00                	push   $0x0
+  80163e:	e8 bf 0f 00 00       	call   802602 <sys_page_unmap>
+  801643:	83 c4 10             	add    $0x10,%esp
+  801646:	e9 59 ff ff ff       	jmp    8015a4 <serve+0x23>
+
+0080164b <umain>:
+  }
+}
+
+void
+umain(int argc, char **argv)
+{
+  80164b:	55                   	push   %ebp
+  80164c:	89 e5                	mov    %esp,%ebp
+  80164e:	83 ec 14             	sub    $0x14,%esp
+	static_assert(sizeof(struct File) == 256);
+	binaryname = "fs";
+  801651:	c7 05 60 90 80 00 67 	movl   $0x804367,0x809060
+  801658:	43 80 00 
+	cprintf("FS is running\n");
+  80165b:	68 6a 43 80 00       	push   $0x80436a
+  801660:	e8 73 05 00 00       	call   801bd8 <cprintf>
+	asm volatile("outw %0,%w1" : : "a" (data), "d" (port));
+  801665:	b8 00 8a ff ff       	mov    $0xffff8a00,%eax
+  80166a:	ba 00 8a 00 00       	mov    $0x8a00,%edx
+  80166f:	66 ef                	out    %ax,(%dx)
+
+	// Check that we are able to do I/O
+	outw(0x8A00, 0x8A00);
+	cprintf("FS can do I/O\n");
+  801671:	c7 04 24 79 43 80 00 	movl   $0x804379,(%esp)
+  801678:	e8 5b 05 00 00       	call   801bd8 <cprintf>
+
+	serve_init();
+  80167d:	e8 46 fb ff ff       	call   8011c8 <serve_init>
+	fs_init();
+  801682:	e8 fe f3 ff ff       	call   800a85 <fs_init>
+	serve();
+  801687:	e8 f5 fe ff ff       	call   801581 <serve>
+
+0080168c <fs_test>:
+
+static char *msg = "This is the NEW message of the day!\n\n";
+
+void
+fs_test(void)
+{
+  80168c:	55                   	push   %ebp
+  80168d:	89 e5                	mov    %esp,%ebp
+  80168f:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	char *blk;
+	uint32_t *bits;
+
+	// back up bitmap
+	if ((r = sys_page_alloc(0, (void*) PGSIZE, PTE_P|PTE_U|PTE_W)) < 0)
+  801692:	6a 07                	push   $0x7
+  801694:	68 00 10 00 00       	push   $0x1000
+  801699:	6a 00                	push   $0x0
+  80169b:	e8 dd 0e 00 00       	call   80257d <sys_page_alloc>
+  8016a0:	83 c4 10             	add    $0x10,%esp
+  8016a3:	85 c0                	test   %eax,%eax
+  8016a5:	0f 88 52 02 00 00    	js     8018fd <fs_test+0x271>
+		panic("sys_page_alloc: %e", r);
+	bits = (uint32_t*) PGSIZE;
+	memmove(bits, bitmap, PGSIZE);
+  8016ab:	83 ec 04             	sub    $0x4,%esp
+  8016ae:	68 00 10 00 00       	push   $0x1000
+  8016b3:	ff 35 08 a0 80 00    	push   0x80a008
+  8016b9:	68 00 10 00 00       	push   $0x1000
+  8016be:	e8 54 0c 00 00       	call   802317 <memmove>
+	// allocate block
+	if ((r = alloc_block()) < 0)
+  8016c3:	e8 f3 f1 ff ff       	call   8008bb <alloc_block>
+  8016c8:	89 c1                	mov    %eax,%ecx
+  8016ca:	83 c4 10             	add    $0x10,%esp
+  8016cd:	85 c0                	test   %eax,%eax
+  8016cf:	0f 88 3a 02 00 00    	js     80190f <fs_test+0x283>
+		panic("alloc_block: %e", r);
+	// check that block was free
+	assert(bits[r/32] & (1 << (r%32)));
+  8016d5:	8d 40 1f             	lea    0x1f(%eax),%eax
+  8016d8:	0f 49 c1             	cmovns %ecx,%eax
+  8016db:	c1 f8 05             	sar    $0x5,%eax
+  8016de:	ba 01 00 00 00       	mov    $0x1,%edx
+  8016e3:	d3 e2                	shl    %cl,%edx
+  8016e5:	89 d1                	mov    %edx,%ecx
+  8016e7:	23 0c 85 00 10 00 00 	and    0x1000(,%eax,4),%ecx
+  8016ee:	0f 84 2d 02 00 00    	je     801921 <fs_test+0x295>
+	// and is not free any more
+	assert(!(bitmap[r/32] & (1 << (r%32))));
+  8016f4:	8b 0d 08 a0 80 00    	mov    0x80a008,%ecx
+  8016fa:	23 14 81             	and    (%ecx,%eax,4),%edx
+  8016fd:	0f 85 34 02 00 00    	jne    801937 <fs_test+0x2ab>
+	cprintf("alloc_block is good\n");
+  801703:	83 ec 0c             	sub    $0xc,%esp
+  801706:	68 d0 43 80 00       	push   $0x8043d0
+  80170b:	e8 c8 04 00 00       	call   801bd8 <cprintf>
+
+	if ((r = file_open("/not-found", &f)) < 0 && r != -E_NOT_FOUND)
+  801710:	83 c4 08             	add    $0x8,%esp
+  801713:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801716:	50                   	push   %eax
+  801717:	68 e5 43 80 00       	push   $0x8043e5
+  80171c:	e8 2b f6 ff ff       	call   800d4c <file_open>
+  801721:	83 c4 10             	add    $0x10,%esp
+  801724:	85 c0                	test   %eax,%eax
+  801726:	0f 88 21 02 00 00    	js     80194d <fs_test+0x2c1>
+		panic("file_open /not-found: %e", r);
+	else if (r == 0)
+  80172c:	0f 84 36 02 00 00    	je     801968 <fs_test+0x2dc>
+		panic("file_open /not-found succeeded!");
+	if ((r = file_open("/newmotd", &f)) < 0)
+  801732:	83 ec 08             	sub    $0x8,%esp
+  801735:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801738:	50                   	push   %eax
+  801739:	68 09 44 80 00       	push   $0x804409
+  80173e:	e8 09 f6 ff ff       	call   800d4c <file_open>
+  801743:	83 c4 10             	add    $0x10,%esp
+  801746:	85 c0                	test   %eax,%eax
+  801748:	0f 88 2e 02 00 00    	js     80197c <fs_test+0x2f0>
+		panic("file_open /newmotd: %e", r);
+	cprintf("file_open is good\n");
+  80174e:	83 ec 0c             	sub    $0xc,%esp
+  801751:	68 29 44 80 00       	push   $0x804429
+  801756:	e8 7d 04 00 00       	call   801bd8 <cprintf>
+
+	if ((r = file_get_block(f, 0, &blk)) < 0)
+  80175b:	83 c4 0c             	add    $0xc,%esp
+  80175e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801761:	50                   	push   %eax
+  801762:	6a 00                	push   $0x0
+  801764:	ff 75 f4             	push   -0xc(%ebp)
+  801767:	e8 66 f3 ff ff       	call   800ad2 <file_get_block>
+  80176c:	83 c4 10             	add    $0x10,%esp
+  80176f:	85 c0                	test   %eax,%eax
+  801771:	0f 88 17 02 00 00    	js     80198e <fs_test+0x302>
+		panic("file_get_block: %e", r);
+	if (strcmp(blk, msg) != 0)
+  801777:	83 ec 08             	sub    $0x8,%esp
+  80177a:	68 70 45 80 00       	push   $0x804570
+  80177f:	ff 75 f0             	push   -0x10(%ebp)
+  801782:	e8 bb 0a 00 00       	call   802242 <strcmp>
+  801787:	83 c4 10             	add    $0x10,%esp
+  80178a:	85 c0                	test   %eax,%eax
+  80178c:	0f 85 0e 02 00 00    	jne    8019a0 <fs_test+0x314>
+		panic("file_get_block returned wrong data");
+	cprintf("file_get_block is good\n");
+  801792:	83 ec 0c             	sub    $0xc,%esp
+  801795:	68 4f 44 80 00       	push   $0x80444f
+  80179a:	e8 39 04 00 00       	call   801bd8 <cprintf>
+
+	*(volatile char*)blk = *(volatile char*)blk;
+  80179f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8017a2:	0f b6 10             	movzbl (%eax),%edx
+  8017a5:	88 10                	mov    %dl,(%eax)
+	assert((uvpt[PGNUM(blk)] & PTE_D));
+  8017a7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8017aa:	c1 e8 0c             	shr    $0xc,%eax
+  8017ad:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8017b4:	83 c4 10             	add    $0x10,%esp
+  8017b7:	a8 40                	test   $0x40,%al
+  8017b9:	0f 84 f5 01 00 00    	je     8019b4 <fs_test+0x328>
+	file_flush(f);
+  8017bf:	83 ec 0c             	sub    $0xc,%esp
+  8017c2:	ff 75 f4             	push   -0xc(%ebp)
+  8017c5:	e8 dd f7 ff ff       	call   800fa7 <file_flush>
+	assert(!(uvpt[PGNUM(blk)] & PTE_D));
+  8017ca:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8017cd:	c1 e8 0c             	shr    $0xc,%eax
+  8017d0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8017d7:	83 c4 10             	add    $0x10,%esp
+  8017da:	a8 40                	test   $0x40,%al
+  8017dc:	0f 85 e8 01 00 00    	jne    8019ca <fs_test+0x33e>
+	cprintf("file_flush is good\n");
+  8017e2:	83 ec 0c             	sub    $0xc,%esp
+  8017e5:	68 83 44 80 00       	push   $0x804483
+  8017ea:	e8 e9 03 00 00       	call   801bd8 <cprintf>
+
+	if ((r = file_set_size(f, 0)) < 0)
+  8017ef:	83 c4 08             	add    $0x8,%esp
+  8017f2:	6a 00                	push   $0x0
+  8017f4:	ff 75 f4             	push   -0xc(%ebp)
+  8017f7:	e8 1b f6 ff ff       	call   800e17 <file_set_size>
+  8017fc:	83 c4 10             	add    $0x10,%esp
+  8017ff:	85 c0                	test   %eax,%eax
+  801801:	0f 88 d9 01 00 00    	js     8019e0 <fs_test+0x354>
+		panic("file_set_size: %e", r);
+	assert(f->f_direct[0] == 0);
+  801807:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80180a:	83 b8 88 00 00 00 00 	cmpl   $0x0,0x88(%eax)
+  801811:	0f 85 db 01 00 00    	jne    8019f2 <fs_test+0x366>
+	assert(!(uvpt[PGNUM(f)] & PTE_D));
+  801817:	c1 e8 0c             	shr    $0xc,%eax
+  80181a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801821:	a8 40                	test   $0x40,%al
+  801823:	0f 85 df 01 00 00    	jne    801a08 <fs_test+0x37c>
+	cprintf("file_truncate is good\n");
+  801829:	83 ec 0c             	sub    $0xc,%esp
+  80182c:	68 d7 44 80 00       	push   $0x8044d7
+  801831:	e8 a2 03 00 00       	call   801bd8 <cprintf>
+
+	if ((r = file_set_size(f, strlen(msg))) < 0)
+  801836:	c7 04 24 70 45 80 00 	movl   $0x804570,(%esp)
+  80183d:	e8 14 09 00 00       	call   802156 <strlen>
+  801842:	83 c4 08             	add    $0x8,%esp
+  801845:	50                   	push   %eax
+  801846:	ff 75 f4             	push   -0xc(%ebp)
+  801849:	e8 c9 f5 ff ff       	call   800e17 <file_set_size>
+  80184e:	83 c4 10             	add    $0x10,%esp
+  801851:	85 c0                	test   %eax,%eax
+  801853:	0f 88 c5 01 00 00    	js     801a1e <fs_test+0x392>
+		panic("file_set_size 2: %e", r);
+	assert(!(uvpt[PGNUM(f)] & PTE_D));
+  801859:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80185c:	89 c2                	mov    %eax,%edx
+  80185e:	c1 ea 0c             	shr    $0xc,%edx
+  801861:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801868:	f6 c2 40             	test   $0x40,%dl
+  80186b:	0f 85 bf 01 00 00    	jne    801a30 <fs_test+0x3a4>
+	if ((r = file_get_block(f, 0, &blk)) < 0)
+  801871:	83 ec 04             	sub    $0x4,%esp
+  801874:	8d 55 f0             	lea    -0x10(%ebp),%edx
+  801877:	52                   	push   %edx
+  801878:	6a 00                	push   $0x0
+  80187a:	50                   	push   %eax
+  80187b:	e8 52 f2 ff ff       	call   800ad2 <file_get_block>
+  801880:	83 c4 10             	add    $0x10,%esp
+  801883:	85 c0                	test   %eax,%eax
+  801885:	0f 88 bb 01 00 00    	js     801a46 <fs_test+0x3ba>
+		panic("file_get_block 2: %e", r);
+	strcpy(blk, msg);
+  80188b:	83 ec 08             	sub    $0x8,%esp
+  80188e:	68 70 45 80 00       	push   $0x804570
+  801893:	ff 75 f0             	push   -0x10(%ebp)
+  801896:	e8 f6 08 00 00       	call   802191 <strcpy>
+	assert((uvpt[PGNUM(blk)] & PTE_D));
+  80189b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80189e:	c1 e8 0c             	shr    $0xc,%eax
+  8018a1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8018a8:	83 c4 10             	add    $0x10,%esp
+  8018ab:	a8 40                	test   $0x40,%al
+  8018ad:	0f 84 a5 01 00 00    	je     801a58 <fs_test+0x3cc>
+	file_flush(f);
+  8018b3:	83 ec 0c             	sub    $0xc,%esp
+  8018b6:	ff 75 f4             	push   -0xc(%ebp)
+  8018b9:	e8 e9 f6 ff ff       	call   800fa7 <file_flush>
+	assert(!(uvpt[PGNUM(blk)] & PTE_D));
+  8018be:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8018c1:	c1 e8 0c             	shr    $0xc,%eax
+  8018c4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8018cb:	83 c4 10             	add    $0x10,%esp
+  8018ce:	a8 40                	test   $0x40,%al
+  8018d0:	0f 85 98 01 00 00    	jne    801a6e <fs_test+0x3e2>
+	assert(!(uvpt[PGNUM(f)] & PTE_D));
+  8018d6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018d9:	c1 e8 0c             	shr    $0xc,%eax
+  8018dc:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8018e3:	a8 40                	test   $0x40,%al
+  8018e5:	0f 85 99 01 00 00    	jne    801a84 <fs_test+0x3f8>
+	cprintf("file rewrite is good\n");
+  8018eb:	83 ec 0c             	sub    $0xc,%esp
+  8018ee:	68 17 45 80 00       	push   $0x804517
+  8018f3:	e8 e0 02 00 00       	call   801bd8 <cprintf>
+}
+  8018f8:	83 c4 10             	add    $0x10,%esp
+  8018fb:	c9                   	leave
+  8018fc:	c3                   	ret
+		panic("sys_page_alloc: %e", r);
+  8018fd:	50                   	push   %eax
+  8018fe:	68 88 43 80 00       	push   $0x804388
+  801903:	6a 12                	push   $0x12
+  801905:	68 9b 43 80 00       	push   $0x80439b
+  80190a:	e8 ee 01 00 00       	call   801afd <_panic>
+		panic("alloc_block: %e", r);
+  80190f:	50                   	push   %eax
+  801910:	68 a5 43 80 00       	push   $0x8043a5
+  801915:	6a 17                	push   $0x17
+  801917:	68 9b 43 80 00       	push   $0x80439b
+  80191c:	e8 dc 01 00 00       	call   801afd <_panic>
+	assert(bits[r/32] & (1 << (r%32)));
+  801921:	68 b5 43 80 00       	push   $0x8043b5
+  801926:	68 1d 40 80 00       	push   $0x80401d
+  80192b:	6a 19                	push   $0x19
+  80192d:	68 9b 43 80 00       	push   $0x80439b
+  801932:	e8 c6 01 00 00       	call   801afd <_panic>
+	assert(!(bitmap[r/32] & (1 << (r%32))));
+  801937:	68 30 45 80 00       	push   $0x804530
+  80193c:	68 1d 40 80 00       	push   $0x80401d
+  801941:	6a 1b                	push   $0x1b
+  801943:	68 9b 43 80 00       	push   $0x80439b
+  801948:	e8 b0 01 00 00       	call   801afd <_panic>
+	if ((r = file_open("/not-found", &f)) < 0 && r != -E_NOT_FOUND)
+  80194d:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  801950:	0f 84 dc fd ff ff    	je     801732 <fs_test+0xa6>
+		panic("file_open /not-found: %e", r);
+  801956:	50                   	push   %eax
+  801957:	68 f0 43 80 00       	push   $0x8043f0
+  80195c:	6a 1f                	push   $0x1f
+  80195e:	68 9b 43 80 00       	push   $0x80439b
+  801963:	e8 95 01 00 00       	call   801afd <_panic>
+		panic("file_open /not-found succeeded!");
+  801968:	83 ec 04             	sub    $0x4,%esp
+  80196b:	68 50 45 80 00       	push   $0x804550
+  801970:	6a 21                	push   $0x21
+  801972:	68 9b 43 80 00       	push   $0x80439b
+  801977:	e8 81 01 00 00       	call   801afd <_panic>
+		panic("file_open /newmotd: %e", r);
+  80197c:	50                   	push   %eax
+  80197d:	68 12 44 80 00       	push   $0x804412
+  801982:	6a 23                	push   $0x23
+  801984:	68 9b 43 80 00       	push   $0x80439b
+  801989:	e8 6f 01 00 00       	call   801afd <_panic>
+		panic("file_get_block: %e", r);
+  80198e:	50                   	push   %eax
+  80198f:	68 3c 44 80 00       	push   $0x80443c
+  801994:	6a 27                	push   $0x27
+  801996:	68 9b 43 80 00       	push   $0x80439b
+  80199b:	e8 5d 01 00 00       	call   801afd <_panic>
+		panic("file_get_block returned wrong data");
+  8019a0:	83 ec 04             	sub    $0x4,%esp
+  8019a3:	68 98 45 80 00       	push   $0x804598
+  8019a8:	6a 29                	push   $0x29
+  8019aa:	68 9b 43 80 00       	push   $0x80439b
+  8019af:	e8 49 01 00 00       	call   801afd <_panic>
+	assert((uvpt[PGNUM(blk)] & PTE_D));
+  8019b4:	68 68 44 80 00       	push   $0x804468
+  8019b9:	68 1d 40 80 00       	push   $0x80401d
+  8019be:	6a 2d                	push   $0x2d
+  8019c0:	68 9b 43 80 00       	push   $0x80439b
+  8019c5:	e8 33 01 00 00       	call   801afd <_panic>
+	assert(!(uvpt[PGNUM(blk)] & PTE_D));
+  8019ca:	68 67 44 80 00       	push   $0x804467
+  8019cf:	68 1d 40 80 00       	push   $0x80401d
+  8019d4:	6a 2f                	push   $0x2f
+  8019d6:	68 9b 43 80 00       	push   $0x80439b
+  8019db:	e8 1d 01 00 00       	call   801afd <_panic>
+		panic("file_set_size: %e", r);
+  8019e0:	50                   	push   %eax
+  8019e1:	68 97 44 80 00       	push   $0x804497
+  8019e6:	6a 33                	push   $0x33
+  8019e8:	68 9b 43 80 00       	push   $0x80439b
+  8019ed:	e8 0b 01 00 00       	call   801afd <_panic>
+	assert(f->f_direct[0] == 0);
+  8019f2:	68 a9 44 80 00       	push   $0x8044a9
+  8019f7:	68 1d 40 80 00       	push   $0x80401d
+  8019fc:	6a 34                	push   $0x34
+  8019fe:	68 9b 43 80 00       	push   $0x80439b
+  801a03:	e8 f5 00 00 00       	call   801afd <_panic>
+	assert(!(uvpt[PGNUM(f)] & PTE_D));
+  801a08:	68 bd 44 80 00       	push   $0x8044bd
+  801a0d:	68 1d 40 80 00       	push   $0x80401d
+  801a12:	6a 35                	push   $0x35
+  801a14:	68 9b 43 80 00       	push   $0x80439b
+  801a19:	e8 df 00 00 00       	call   801afd <_panic>
+		panic("file_set_size 2: %e", r);
+  801a1e:	50                   	push   %eax
+  801a1f:	68 ee 44 80 00       	push   $0x8044ee
+  801a24:	6a 39                	push   $0x39
+  801a26:	68 9b 43 80 00       	push   $0x80439b
+  801a2b:	e8 cd 00 00 00       	call   801afd <_panic>
+	assert(!(uvpt[PGNUM(f)] & PTE_D));
+  801a30:	68 bd 44 80 00       	push   $0x8044bd
+  801a35:	68 1d 40 80 00       	push   $0x80401d
+  801a3a:	6a 3a                	push   $0x3a
+  801a3c:	68 9b 43 80 00       	push   $0x80439b
+  801a41:	e8 b7 00 00 00       	call   801afd <_panic>
+		panic("file_get_block 2: %e", r);
+  801a46:	50                   	push   %eax
+  801a47:	68 02 45 80 00       	push   $0x804502
+  801a4c:	6a 3c                	push   $0x3c
+  801a4e:	68 9b 43 80 00       	push   $0x80439b
+  801a53:	e8 a5 00 00 00       	call   801afd <_panic>
+	assert((uvpt[PGNUM(blk)] & PTE_D));
+  801a58:	68 68 44 80 00       	push   $0x804468
+  801a5d:	68 1d 40 80 00       	push   $0x80401d
+  801a62:	6a 3e                	push   $0x3e
+  801a64:	68 9b 43 80 00       	push   $0x80439b
+  801a69:	e8 8f 00 00 00       	call   801afd <_panic>
+	assert(!(uvpt[PGNUM(blk)] & PTE_D));
+  801a6e:	68 67 44 80 00       	push   $0x804467
+  801a73:	68 1d 40 80 00       	push   $0x80401d
+  801a78:	6a 40                	push   $0x40
+  801a7a:	68 9b 43 80 00       	push   $0x80439b
+  801a7f:	e8 79 00 00 00       	call   801afd <_panic>
+	assert(!(uvpt[PGNUM(f)] & PTE_D));
+  801a84:	68 bd 44 80 00       	push   $0x8044bd
+  801a89:	68 1d 40 80 00       	push   $0x80401d
+  801a8e:	6a 41                	push   $0x41
+  801a90:	68 9b 43 80 00       	push   $0x80439b
+  801a95:	e8 63 00 00 00       	call   801afd <_panic>
+
+00801a9a <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  801a9a:	55                   	push   %ebp
+  801a9b:	89 e5                	mov    %esp,%ebp
+  801a9d:	56                   	push   %esi
+  801a9e:	53                   	push   %ebx
+  801a9f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801aa2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  801aa5:	e8 95 0a 00 00       	call   80253f <sys_getenvid>
+  801aaa:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801aaf:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  801ab2:	c1 e0 04             	shl    $0x4,%eax
+  801ab5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801aba:	a3 10 a0 80 00       	mov    %eax,0x80a010
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  801abf:	85 db                	test   %ebx,%ebx
+  801ac1:	7e 07                	jle    801aca <libmain+0x30>
+    binaryname = argv[0];
+  801ac3:	8b 06                	mov    (%esi),%eax
+  801ac5:	a3 60 90 80 00       	mov    %eax,0x809060
+
+  // call user main routine
+  umain(argc, argv);
+  801aca:	83 ec 08             	sub    $0x8,%esp
+  801acd:	56                   	push   %esi
+  801ace:	53                   	push   %ebx
+  801acf:	e8 77 fb ff ff       	call   80164b <umain>
+
+  // exit gracefully
+  exit();
+  801ad4:	e8 0a 00 00 00       	call   801ae3 <exit>
+}
+  801ad9:	83 c4 10             	add    $0x10,%esp
+  801adc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801adf:	5b                   	pop    %ebx
+  801ae0:	5e                   	pop    %esi
+  801ae1:	5d                   	pop    %ebp
+  801ae2:	c3                   	ret
+
+00801ae3 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  801ae3:	55                   	push   %ebp
+  801ae4:	89 e5                	mov    %esp,%ebp
+  801ae6:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  801ae9:	e8 cc 10 00 00       	call   802bba <close_all>
+	sys_env_destroy(0);
+  801aee:	83 ec 0c             	sub    $0xc,%esp
+  801af1:	6a 00                	push   $0x0
+  801af3:	e8 06 0a 00 00       	call   8024fe <sys_env_destroy>
+}
+  801af8:	83 c4 10             	add    $0x10,%esp
+  801afb:	c9                   	leave
+  801afc:	c3                   	ret
+
+00801afd <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  801afd:	55                   	push   %ebp
+  801afe:	89 e5                	mov    %esp,%ebp
+  801b00:	56                   	push   %esi
+  801b01:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  801b02:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  801b05:	8b 35 60 90 80 00    	mov    0x809060,%esi
+  801b0b:	e8 2f 0a 00 00       	call   80253f <sys_getenvid>
+  801b10:	83 ec 0c             	sub    $0xc,%esp
+  801b13:	ff 75 0c             	push   0xc(%ebp)
+  801b16:	ff 75 08             	push   0x8(%ebp)
+  801b19:	56                   	push   %esi
+  801b1a:	50                   	push   %eax
+  801b1b:	68 c8 45 80 00       	push   $0x8045c8
+  801b20:	e8 b3 00 00 00       	call   801bd8 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  801b25:	83 c4 18             	add    $0x18,%esp
+  801b28:	53                   	push   %ebx
+  801b29:	ff 75 10             	push   0x10(%ebp)
+  801b2c:	e8 56 00 00 00       	call   801b87 <vcprintf>
+	cprintf("\n");
+  801b31:	c7 04 24 d7 41 80 00 	movl   $0x8041d7,(%esp)
+  801b38:	e8 9b 00 00 00       	call   801bd8 <cprintf>
+  801b3d:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  801b40:	cc                   	int3
+	while (1)
+  801b41:	eb fd                	jmp    801b40 <_panic+0x43>
+
+00801b43 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  801b43:	55                   	push   %ebp
+  801b44:	89 e5                	mov    %esp,%ebp
+  801b46:	53                   	push   %ebx
+  801b47:	83 ec 04             	sub    $0x4,%esp
+  801b4a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  801b4d:	8b 13                	mov    (%ebx),%edx
+  801b4f:	8d 42 01             	lea    0x1(%edx),%eax
+  801b52:	89 03                	mov    %eax,(%ebx)
+  801b54:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801b57:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  801b5b:	3d ff 00 00 00       	cmp    $0xff,%eax
+  801b60:	74 09                	je     801b6b <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  801b62:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  801b66:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b69:	c9                   	leave
+  801b6a:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  801b6b:	83 ec 08             	sub    $0x8,%esp
+  801b6e:	68 ff 00 00 00       	push   $0xff
+  801b73:	8d 43 08             	lea    0x8(%ebx),%eax
+  801b76:	50                   	push   %eax
+  801b77:	e8 45 09 00 00       	call   8024c1 <sys_cputs>
+		b->idx = 0;
+  801b7c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  801b82:	83 c4 10             	add    $0x10,%esp
+  801b85:	eb db                	jmp    801b62 <putch+0x1f>
+
+00801b87 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  801b87:	55                   	push   %ebp
+  801b88:	89 e5                	mov    %esp,%ebp
+  801b8a:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  801b90:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  801b97:	00 00 00 
+	b.cnt = 0;
+  801b9a:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  801ba1:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  801ba4:	ff 75 0c             	push   0xc(%ebp)
+  801ba7:	ff 75 08             	push   0x8(%ebp)
+  801baa:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  801bb0:	50                   	push   %eax
+  801bb1:	68 43 1b 80 00       	push   $0x801b43
+  801bb6:	e8 14 01 00 00       	call   801ccf <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  801bbb:	83 c4 08             	add    $0x8,%esp
+  801bbe:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  801bc4:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  801bca:	50                   	push   %eax
+  801bcb:	e8 f1 08 00 00       	call   8024c1 <sys_cputs>
+
+	return b.cnt;
+}
+  801bd0:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  801bd6:	c9                   	leave
+  801bd7:	c3                   	ret
+
+00801bd8 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  801bd8:	55                   	push   %ebp
+  801bd9:	89 e5                	mov    %esp,%ebp
+  801bdb:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  801bde:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  801be1:	50                   	push   %eax
+  801be2:	ff 75 08             	push   0x8(%ebp)
+  801be5:	e8 9d ff ff ff       	call   801b87 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  801bea:	c9                   	leave
+  801beb:	c3                   	ret
+
+00801bec <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  801bec:	55                   	push   %ebp
+  801bed:	89 e5                	mov    %esp,%ebp
+  801bef:	57                   	push   %edi
+  801bf0:	56                   	push   %esi
+  801bf1:	53                   	push   %ebx
+  801bf2:	83 ec 1c             	sub    $0x1c,%esp
+  801bf5:	89 c7                	mov    %eax,%edi
+  801bf7:	89 d6                	mov    %edx,%esi
+  801bf9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bfc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801bff:	89 d1                	mov    %edx,%ecx
+  801c01:	89 c2                	mov    %eax,%edx
+  801c03:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801c06:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801c09:	8b 45 10             	mov    0x10(%ebp),%eax
+  801c0c:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  801c0f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801c12:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801c19:	39 c2                	cmp    %eax,%edx
+  801c1b:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  801c1e:	72 3e                	jb     801c5e <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  801c20:	83 ec 0c             	sub    $0xc,%esp
+  801c23:	ff 75 18             	push   0x18(%ebp)
+  801c26:	83 eb 01             	sub    $0x1,%ebx
+  801c29:	53                   	push   %ebx
+  801c2a:	50                   	push   %eax
+  801c2b:	83 ec 08             	sub    $0x8,%esp
+  801c2e:	ff 75 e4             	push   -0x1c(%ebp)
+  801c31:	ff 75 e0             	push   -0x20(%ebp)
+  801c34:	ff 75 dc             	push   -0x24(%ebp)
+  801c37:	ff 75 d8             	push   -0x28(%ebp)
+  801c3a:	e8 11 20 00 00       	call   803c50 <__udivdi3>
+  801c3f:	83 c4 18             	add    $0x18,%esp
+  801c42:	52                   	push   %edx
+  801c43:	50                   	push   %eax
+  801c44:	89 f2                	mov    %esi,%edx
+  801c46:	89 f8                	mov    %edi,%eax
+  801c48:	e8 9f ff ff ff       	call   801bec <printnum>
+  801c4d:	83 c4 20             	add    $0x20,%esp
+  801c50:	eb 13                	jmp    801c65 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  801c52:	83 ec 08             	sub    $0x8,%esp
+  801c55:	56                   	push   %esi
+  801c56:	ff 75 18             	push   0x18(%ebp)
+  801c59:	ff d7                	call   *%edi
+  801c5b:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  801c5e:	83 eb 01             	sub    $0x1,%ebx
+  801c61:	85 db                	test   %ebx,%ebx
+  801c63:	7f ed                	jg     801c52 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  801c65:	83 ec 08             	sub    $0x8,%esp
+  801c68:	56                   	push   %esi
+  801c69:	83 ec 04             	sub    $0x4,%esp
+  801c6c:	ff 75 e4             	push   -0x1c(%ebp)
+  801c6f:	ff 75 e0             	push   -0x20(%ebp)
+  801c72:	ff 75 dc             	push   -0x24(%ebp)
+  801c75:	ff 75 d8             	push   -0x28(%ebp)
+  801c78:	e8 a3 20 00 00       	call   803d20 <__umoddi3>
+  801c7d:	83 c4 14             	add    $0x14,%esp
+  801c80:	0f be 80 eb 45 80 00 	movsbl 0x8045eb(%eax),%eax
+  801c87:	50                   	push   %eax
+  801c88:	ff d7                	call   *%edi
+}
+  801c8a:	83 c4 10             	add    $0x10,%esp
+  801c8d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c90:	5b                   	pop    %ebx
+  801c91:	5e                   	pop    %esi
+  801c92:	5f                   	pop    %edi
+  801c93:	5d                   	pop    %ebp
+  801c94:	c3                   	ret
+
+00801c95 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  801c95:	55                   	push   %ebp
+  801c96:	89 e5                	mov    %esp,%ebp
+  801c98:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  801c9b:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  801c9f:	8b 10                	mov    (%eax),%edx
+  801ca1:	3b 50 04             	cmp    0x4(%eax),%edx
+  801ca4:	73 0a                	jae    801cb0 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  801ca6:	8d 4a 01             	lea    0x1(%edx),%ecx
+  801ca9:	89 08                	mov    %ecx,(%eax)
+  801cab:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cae:	88 02                	mov    %al,(%edx)
+}
+  801cb0:	5d                   	pop    %ebp
+  801cb1:	c3                   	ret
+
+00801cb2 <printfmt>:
+{
+  801cb2:	55                   	push   %ebp
+  801cb3:	89 e5                	mov    %esp,%ebp
+  801cb5:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  801cb8:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  801cbb:	50                   	push   %eax
+  801cbc:	ff 75 10             	push   0x10(%ebp)
+  801cbf:	ff 75 0c             	push   0xc(%ebp)
+  801cc2:	ff 75 08             	push   0x8(%ebp)
+  801cc5:	e8 05 00 00 00       	call   801ccf <vprintfmt>
+}
+  801cca:	83 c4 10             	add    $0x10,%esp
+  801ccd:	c9                   	leave
+  801cce:	c3                   	ret
+
+00801ccf <vprintfmt>:
+{
+  801ccf:	55                   	push   %ebp
+  801cd0:	89 e5                	mov    %esp,%ebp
+  801cd2:	57                   	push   %edi
+  801cd3:	56                   	push   %esi
+  801cd4:	53                   	push   %ebx
+  801cd5:	83 ec 2c             	sub    $0x2c,%esp
+  801cd8:	8b 75 08             	mov    0x8(%ebp),%esi
+  801cdb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801cde:	8b 7d 10             	mov    0x10(%ebp),%edi
+  801ce1:	eb 0a                	jmp    801ced <vprintfmt+0x1e>
+			putch(ch, putdat);
+  801ce3:	83 ec 08             	sub    $0x8,%esp
+  801ce6:	53                   	push   %ebx
+  801ce7:	50                   	push   %eax
+  801ce8:	ff d6                	call   *%esi
+  801cea:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801ced:	83 c7 01             	add    $0x1,%edi
+  801cf0:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  801cf4:	83 f8 25             	cmp    $0x25,%eax
+  801cf7:	74 0c                	je     801d05 <vprintfmt+0x36>
+			if (ch == '\0')
+  801cf9:	85 c0                	test   %eax,%eax
+  801cfb:	75 e6                	jne    801ce3 <vprintfmt+0x14>
+}
+  801cfd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d00:	5b                   	pop    %ebx
+  801d01:	5e                   	pop    %esi
+  801d02:	5f                   	pop    %edi
+  801d03:	5d                   	pop    %ebp
+  801d04:	c3                   	ret
+		padc = ' ';
+  801d05:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  801d09:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  801d10:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  801d17:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  801d1e:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801d23:	8d 47 01             	lea    0x1(%edi),%eax
+  801d26:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801d29:	0f b6 17             	movzbl (%edi),%edx
+  801d2c:	8d 42 dd             	lea    -0x23(%edx),%eax
+  801d2f:	3c 55                	cmp    $0x55,%al
+  801d31:	0f 87 9a 03 00 00    	ja     8020d1 <vprintfmt+0x402>
+  801d37:	0f b6 c0             	movzbl %al,%eax
+  801d3a:	ff 24 85 20 47 80 00 	jmp    *0x804720(,%eax,4)
+  801d41:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  801d44:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  801d48:	eb d9                	jmp    801d23 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  801d4a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801d4d:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  801d51:	eb d0                	jmp    801d23 <vprintfmt+0x54>
+  801d53:	0f b6 d2             	movzbl %dl,%edx
+  801d56:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  801d59:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d5e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  801d61:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  801d64:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  801d68:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  801d6b:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  801d6e:	83 f9 09             	cmp    $0x9,%ecx
+  801d71:	77 55                	ja     801dc8 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  801d73:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  801d76:	eb e9                	jmp    801d61 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  801d78:	8b 45 14             	mov    0x14(%ebp),%eax
+  801d7b:	8b 00                	mov    (%eax),%eax
+  801d7d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801d80:	8b 45 14             	mov    0x14(%ebp),%eax
+  801d83:	8d 40 04             	lea    0x4(%eax),%eax
+  801d86:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  801d89:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  801d8c:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801d90:	79 91                	jns    801d23 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  801d92:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801d95:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801d98:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  801d9f:	eb 82                	jmp    801d23 <vprintfmt+0x54>
+			if (width < 0)
+  801da1:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801da4:	85 d2                	test   %edx,%edx
+  801da6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dab:	0f 49 c2             	cmovns %edx,%eax
+  801dae:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  801db1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  801db4:	e9 6a ff ff ff       	jmp    801d23 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  801db9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  801dbc:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  801dc3:	e9 5b ff ff ff       	jmp    801d23 <vprintfmt+0x54>
+  801dc8:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801dcb:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801dce:	eb bc                	jmp    801d8c <vprintfmt+0xbd>
+			lflag++;
+  801dd0:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801dd3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  801dd6:	e9 48 ff ff ff       	jmp    801d23 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  801ddb:	8b 45 14             	mov    0x14(%ebp),%eax
+  801dde:	8d 78 04             	lea    0x4(%eax),%edi
+  801de1:	83 ec 08             	sub    $0x8,%esp
+  801de4:	53                   	push   %ebx
+  801de5:	ff 30                	push   (%eax)
+  801de7:	ff d6                	call   *%esi
+			break;
+  801de9:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  801dec:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  801def:	e9 7c 02 00 00       	jmp    802070 <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  801df4:	8b 45 14             	mov    0x14(%ebp),%eax
+  801df7:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  801dfa:	8b 10                	mov    (%eax),%edx
+  801dfc:	89 d0                	mov    %edx,%eax
+  801dfe:	f7 d8                	neg    %eax
+  801e00:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  801e03:	83 f8 10             	cmp    $0x10,%eax
+  801e06:	7f 23                	jg     801e2b <vprintfmt+0x15c>
+  801e08:	8b 14 85 80 48 80 00 	mov    0x804880(,%eax,4),%edx
+  801e0f:	85 d2                	test   %edx,%edx
+  801e11:	74 18                	je     801e2b <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  801e13:	52                   	push   %edx
+  801e14:	68 2f 40 80 00       	push   $0x80402f
+  801e19:	53                   	push   %ebx
+  801e1a:	56                   	push   %esi
+  801e1b:	e8 92 fe ff ff       	call   801cb2 <printfmt>
+  801e20:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801e23:	89 7d 14             	mov    %edi,0x14(%ebp)
+  801e26:	e9 45 02 00 00       	jmp    802070 <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  801e2b:	50                   	push   %eax
+  801e2c:	68 03 46 80 00       	push   $0x804603
+  801e31:	53                   	push   %ebx
+  801e32:	56                   	push   %esi
+  801e33:	e8 7a fe ff ff       	call   801cb2 <printfmt>
+  801e38:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801e3b:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  801e3e:	e9 2d 02 00 00       	jmp    802070 <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801e43:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e46:	83 c0 04             	add    $0x4,%eax
+  801e49:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  801e4c:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e4f:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  801e51:	85 c9                	test   %ecx,%ecx
+  801e53:	b8 fc 45 80 00       	mov    $0x8045fc,%eax
+  801e58:	0f 45 c1             	cmovne %ecx,%eax
+  801e5b:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  801e5e:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801e62:	7e 06                	jle    801e6a <vprintfmt+0x19b>
+  801e64:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  801e68:	75 0b                	jne    801e75 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801e6a:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801e6d:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801e70:	89 75 08             	mov    %esi,0x8(%ebp)
+  801e73:	eb 5c                	jmp    801ed1 <vprintfmt+0x202>
+  801e75:	83 ec 08             	sub    $0x8,%esp
+  801e78:	ff 75 d0             	push   -0x30(%ebp)
+  801e7b:	ff 75 cc             	push   -0x34(%ebp)
+  801e7e:	e8 eb 02 00 00       	call   80216e <strnlen>
+  801e83:	89 c2                	mov    %eax,%edx
+  801e85:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801e88:	29 d0                	sub    %edx,%eax
+  801e8a:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  801e8d:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  801e91:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801e94:	89 75 08             	mov    %esi,0x8(%ebp)
+  801e97:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801e99:	eb 0e                	jmp    801ea9 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  801e9b:	83 ec 08             	sub    $0x8,%esp
+  801e9e:	53                   	push   %ebx
+  801e9f:	57                   	push   %edi
+  801ea0:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801ea3:	83 ee 01             	sub    $0x1,%esi
+  801ea6:	83 c4 10             	add    $0x10,%esp
+  801ea9:	85 f6                	test   %esi,%esi
+  801eab:	7f ee                	jg     801e9b <vprintfmt+0x1cc>
+  801ead:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801eb0:	8b 75 08             	mov    0x8(%ebp),%esi
+  801eb3:	85 c0                	test   %eax,%eax
+  801eb5:	ba 00 00 00 00       	mov    $0x0,%edx
+  801eba:	0f 49 d0             	cmovns %eax,%edx
+  801ebd:	29 d0                	sub    %edx,%eax
+  801ebf:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801ec2:	eb a6                	jmp    801e6a <vprintfmt+0x19b>
+					putch(ch, putdat);
+  801ec4:	83 ec 08             	sub    $0x8,%esp
+  801ec7:	53                   	push   %ebx
+  801ec8:	52                   	push   %edx
+  801ec9:	ff 55 08             	call   *0x8(%ebp)
+  801ecc:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801ecf:	89 f1                	mov    %esi,%ecx
+  801ed1:	8d 71 01             	lea    0x1(%ecx),%esi
+  801ed4:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  801ed8:	0f be d0             	movsbl %al,%edx
+  801edb:	85 d2                	test   %edx,%edx
+  801edd:	74 28                	je     801f07 <vprintfmt+0x238>
+  801edf:	85 ff                	test   %edi,%edi
+  801ee1:	78 05                	js     801ee8 <vprintfmt+0x219>
+  801ee3:	83 ef 01             	sub    $0x1,%edi
+  801ee6:	78 30                	js     801f18 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  801ee8:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  801eec:	74 d6                	je     801ec4 <vprintfmt+0x1f5>
+  801eee:	0f be c0             	movsbl %al,%eax
+  801ef1:	83 e8 20             	sub    $0x20,%eax
+  801ef4:	83 f8 5e             	cmp    $0x5e,%eax
+  801ef7:	76 cb                	jbe    801ec4 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  801ef9:	83 ec 08             	sub    $0x8,%esp
+  801efc:	53                   	push   %ebx
+  801efd:	6a 3f                	push   $0x3f
+  801eff:	ff 55 08             	call   *0x8(%ebp)
+  801f02:	83 c4 10             	add    $0x10,%esp
+  801f05:	eb c8                	jmp    801ecf <vprintfmt+0x200>
+  801f07:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f0a:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  801f0d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801f10:	01 d0                	add    %edx,%eax
+  801f12:	29 c8                	sub    %ecx,%eax
+  801f14:	89 c7                	mov    %eax,%edi
+  801f16:	eb 13                	jmp    801f2b <vprintfmt+0x25c>
+  801f18:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f1b:	eb ed                	jmp    801f0a <vprintfmt+0x23b>
+				putch(' ', putdat);
+  801f1d:	83 ec 08             	sub    $0x8,%esp
+  801f20:	53                   	push   %ebx
+  801f21:	6a 20                	push   $0x20
+  801f23:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  801f25:	83 ef 01             	sub    $0x1,%edi
+  801f28:	83 c4 10             	add    $0x10,%esp
+  801f2b:	85 ff                	test   %edi,%edi
+  801f2d:	7f ee                	jg     801f1d <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801f2f:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  801f32:	89 45 14             	mov    %eax,0x14(%ebp)
+  801f35:	e9 36 01 00 00       	jmp    802070 <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  801f3a:	83 f9 01             	cmp    $0x1,%ecx
+  801f3d:	7f 1f                	jg     801f5e <vprintfmt+0x28f>
+	else if (lflag)
+  801f3f:	85 c9                	test   %ecx,%ecx
+  801f41:	74 67                	je     801faa <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  801f43:	8b 45 14             	mov    0x14(%ebp),%eax
+  801f46:	8b 00                	mov    (%eax),%eax
+  801f48:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801f4b:	89 c1                	mov    %eax,%ecx
+  801f4d:	c1 f9 1f             	sar    $0x1f,%ecx
+  801f50:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801f53:	8b 45 14             	mov    0x14(%ebp),%eax
+  801f56:	8d 40 04             	lea    0x4(%eax),%eax
+  801f59:	89 45 14             	mov    %eax,0x14(%ebp)
+  801f5c:	eb 17                	jmp    801f75 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  801f5e:	8b 45 14             	mov    0x14(%ebp),%eax
+  801f61:	8b 50 04             	mov    0x4(%eax),%edx
+  801f64:	8b 00                	mov    (%eax),%eax
+  801f66:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801f69:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801f6c:	8b 45 14             	mov    0x14(%ebp),%eax
+  801f6f:	8d 40 08             	lea    0x8(%eax),%eax
+  801f72:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  801f75:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801f78:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  801f7b:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  801f80:	85 c9                	test   %ecx,%ecx
+  801f82:	0f 89 ce 00 00 00    	jns    802056 <vprintfmt+0x387>
+				putch('-', putdat);
+  801f88:	83 ec 08             	sub    $0x8,%esp
+  801f8b:	53                   	push   %ebx
+  801f8c:	6a 2d                	push   $0x2d
+  801f8e:	ff d6                	call   *%esi
+				num = -(long long) num;
+  801f90:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801f93:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801f96:	f7 da                	neg    %edx
+  801f98:	83 d1 00             	adc    $0x0,%ecx
+  801f9b:	f7 d9                	neg    %ecx
+  801f9d:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  801fa0:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801fa5:	e9 ac 00 00 00       	jmp    802056 <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  801faa:	8b 45 14             	mov    0x14(%ebp),%eax
+  801fad:	8b 00                	mov    (%eax),%eax
+  801faf:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801fb2:	89 c1                	mov    %eax,%ecx
+  801fb4:	c1 f9 1f             	sar    $0x1f,%ecx
+  801fb7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801fba:	8b 45 14             	mov    0x14(%ebp),%eax
+  801fbd:	8d 40 04             	lea    0x4(%eax),%eax
+  801fc0:	89 45 14             	mov    %eax,0x14(%ebp)
+  801fc3:	eb b0                	jmp    801f75 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  801fc5:	83 f9 01             	cmp    $0x1,%ecx
+  801fc8:	7f 1b                	jg     801fe5 <vprintfmt+0x316>
+	else if (lflag)
+  801fca:	85 c9                	test   %ecx,%ecx
+  801fcc:	74 2c                	je     801ffa <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  801fce:	8b 45 14             	mov    0x14(%ebp),%eax
+  801fd1:	8b 10                	mov    (%eax),%edx
+  801fd3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801fd8:	8d 40 04             	lea    0x4(%eax),%eax
+  801fdb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801fde:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  801fe3:	eb 71                	jmp    802056 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  801fe5:	8b 45 14             	mov    0x14(%ebp),%eax
+  801fe8:	8b 10                	mov    (%eax),%edx
+  801fea:	8b 48 04             	mov    0x4(%eax),%ecx
+  801fed:	8d 40 08             	lea    0x8(%eax),%eax
+  801ff0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801ff3:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  801ff8:	eb 5c                	jmp    802056 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  801ffa:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ffd:	8b 10                	mov    (%eax),%edx
+  801fff:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802004:	8d 40 04             	lea    0x4(%eax),%eax
+  802007:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80200a:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80200f:	eb 45                	jmp    802056 <vprintfmt+0x387>
+			putch('X', putdat);
+  802011:	83 ec 08             	sub    $0x8,%esp
+  802014:	53                   	push   %ebx
+  802015:	6a 58                	push   $0x58
+  802017:	ff d6                	call   *%esi
+			putch('X', putdat);
+  802019:	83 c4 08             	add    $0x8,%esp
+  80201c:	53                   	push   %ebx
+  80201d:	6a 58                	push   $0x58
+  80201f:	ff d6                	call   *%esi
+			putch('X', putdat);
+  802021:	83 c4 08             	add    $0x8,%esp
+  802024:	53                   	push   %ebx
+  802025:	6a 58                	push   $0x58
+  802027:	ff d6                	call   *%esi
+			break;
+  802029:	83 c4 10             	add    $0x10,%esp
+  80202c:	eb 42                	jmp    802070 <vprintfmt+0x3a1>
+			putch('0', putdat);
+  80202e:	83 ec 08             	sub    $0x8,%esp
+  802031:	53                   	push   %ebx
+  802032:	6a 30                	push   $0x30
+  802034:	ff d6                	call   *%esi
+			putch('x', putdat);
+  802036:	83 c4 08             	add    $0x8,%esp
+  802039:	53                   	push   %ebx
+  80203a:	6a 78                	push   $0x78
+  80203c:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  80203e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802041:	8b 10                	mov    (%eax),%edx
+  802043:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  802048:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80204b:	8d 40 04             	lea    0x4(%eax),%eax
+  80204e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802051:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  802056:	83 ec 0c             	sub    $0xc,%esp
+  802059:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80205d:	50                   	push   %eax
+  80205e:	ff 75 e0             	push   -0x20(%ebp)
+  802061:	57                   	push   %edi
+  802062:	51                   	push   %ecx
+  802063:	52                   	push   %edx
+  802064:	89 da                	mov    %ebx,%edx
+  802066:	89 f0                	mov    %esi,%eax
+  802068:	e8 7f fb ff ff       	call   801bec <printnum>
+			break;
+  80206d:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  802070:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  802073:	e9 75 fc ff ff       	jmp    801ced <vprintfmt+0x1e>
+	if (lflag >= 2)
+  802078:	83 f9 01             	cmp    $0x1,%ecx
+  80207b:	7f 1b                	jg     802098 <vprintfmt+0x3c9>
+	else if (lflag)
+  80207d:	85 c9                	test   %ecx,%ecx
+  80207f:	74 2c                	je     8020ad <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  802081:	8b 45 14             	mov    0x14(%ebp),%eax
+  802084:	8b 10                	mov    (%eax),%edx
+  802086:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80208b:	8d 40 04             	lea    0x4(%eax),%eax
+  80208e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802091:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  802096:	eb be                	jmp    802056 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  802098:	8b 45 14             	mov    0x14(%ebp),%eax
+  80209b:	8b 10                	mov    (%eax),%edx
+  80209d:	8b 48 04             	mov    0x4(%eax),%ecx
+  8020a0:	8d 40 08             	lea    0x8(%eax),%eax
+  8020a3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8020a6:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8020ab:	eb a9                	jmp    802056 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  8020ad:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020b0:	8b 10                	mov    (%eax),%edx
+  8020b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020b7:	8d 40 04             	lea    0x4(%eax),%eax
+  8020ba:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8020bd:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8020c2:	eb 92                	jmp    802056 <vprintfmt+0x387>
+			putch(ch, putdat);
+  8020c4:	83 ec 08             	sub    $0x8,%esp
+  8020c7:	53                   	push   %ebx
+  8020c8:	6a 25                	push   $0x25
+  8020ca:	ff d6                	call   *%esi
+			break;
+  8020cc:	83 c4 10             	add    $0x10,%esp
+  8020cf:	eb 9f                	jmp    802070 <vprintfmt+0x3a1>
+			putch('%', putdat);
+  8020d1:	83 ec 08             	sub    $0x8,%esp
+  8020d4:	53                   	push   %ebx
+  8020d5:	6a 25                	push   $0x25
+  8020d7:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8020d9:	83 c4 10             	add    $0x10,%esp
+  8020dc:	89 f8                	mov    %edi,%eax
+  8020de:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8020e2:	74 05                	je     8020e9 <vprintfmt+0x41a>
+  8020e4:	83 e8 01             	sub    $0x1,%eax
+  8020e7:	eb f5                	jmp    8020de <vprintfmt+0x40f>
+  8020e9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8020ec:	eb 82                	jmp    802070 <vprintfmt+0x3a1>
+
+008020ee <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8020ee:	55                   	push   %ebp
+  8020ef:	89 e5                	mov    %esp,%ebp
+  8020f1:	83 ec 18             	sub    $0x18,%esp
+  8020f4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020f7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8020fa:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8020fd:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  802101:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  802104:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80210b:	85 c0                	test   %eax,%eax
+  80210d:	74 26                	je     802135 <vsnprintf+0x47>
+  80210f:	85 d2                	test   %edx,%edx
+  802111:	7e 22                	jle    802135 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  802113:	ff 75 14             	push   0x14(%ebp)
+  802116:	ff 75 10             	push   0x10(%ebp)
+  802119:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80211c:	50                   	push   %eax
+  80211d:	68 95 1c 80 00       	push   $0x801c95
+  802122:	e8 a8 fb ff ff       	call   801ccf <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  802127:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80212a:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80212d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802130:	83 c4 10             	add    $0x10,%esp
+}
+  802133:	c9                   	leave
+  802134:	c3                   	ret
+		return -E_INVAL;
+  802135:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80213a:	eb f7                	jmp    802133 <vsnprintf+0x45>
+
+0080213c <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80213c:	55                   	push   %ebp
+  80213d:	89 e5                	mov    %esp,%ebp
+  80213f:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  802142:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  802145:	50                   	push   %eax
+  802146:	ff 75 10             	push   0x10(%ebp)
+  802149:	ff 75 0c             	push   0xc(%ebp)
+  80214c:	ff 75 08             	push   0x8(%ebp)
+  80214f:	e8 9a ff ff ff       	call   8020ee <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  802154:	c9                   	leave
+  802155:	c3                   	ret
+
+00802156 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  802156:	55                   	push   %ebp
+  802157:	89 e5                	mov    %esp,%ebp
+  802159:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80215c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802161:	eb 03                	jmp    802166 <strlen+0x10>
+		n++;
+  802163:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  802166:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80216a:	75 f7                	jne    802163 <strlen+0xd>
+	return n;
+}
+  80216c:	5d                   	pop    %ebp
+  80216d:	c3                   	ret
+
+0080216e <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80216e:	55                   	push   %ebp
+  80216f:	89 e5                	mov    %esp,%ebp
+  802171:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  802174:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802177:	b8 00 00 00 00       	mov    $0x0,%eax
+  80217c:	eb 03                	jmp    802181 <strnlen+0x13>
+		n++;
+  80217e:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  802181:	39 d0                	cmp    %edx,%eax
+  802183:	74 08                	je     80218d <strnlen+0x1f>
+  802185:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  802189:	75 f3                	jne    80217e <strnlen+0x10>
+  80218b:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80218d:	89 d0                	mov    %edx,%eax
+  80218f:	5d                   	pop    %ebp
+  802190:	c3                   	ret
+
+00802191 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  802191:	55                   	push   %ebp
+  802192:	89 e5                	mov    %esp,%ebp
+  802194:	53                   	push   %ebx
+  802195:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802198:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80219b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021a0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8021a4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8021a7:	83 c0 01             	add    $0x1,%eax
+  8021aa:	84 d2                	test   %dl,%dl
+  8021ac:	75 f2                	jne    8021a0 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8021ae:	89 c8                	mov    %ecx,%eax
+  8021b0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021b3:	c9                   	leave
+  8021b4:	c3                   	ret
+
+008021b5 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8021b5:	55                   	push   %ebp
+  8021b6:	89 e5                	mov    %esp,%ebp
+  8021b8:	53                   	push   %ebx
+  8021b9:	83 ec 10             	sub    $0x10,%esp
+  8021bc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8021bf:	53                   	push   %ebx
+  8021c0:	e8 91 ff ff ff       	call   802156 <strlen>
+  8021c5:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8021c8:	ff 75 0c             	push   0xc(%ebp)
+  8021cb:	01 d8                	add    %ebx,%eax
+  8021cd:	50                   	push   %eax
+  8021ce:	e8 be ff ff ff       	call   802191 <strcpy>
+	return dst;
+}
+  8021d3:	89 d8                	mov    %ebx,%eax
+  8021d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021d8:	c9                   	leave
+  8021d9:	c3                   	ret
+
+008021da <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8021da:	55                   	push   %ebp
+  8021db:	89 e5                	mov    %esp,%ebp
+  8021dd:	56                   	push   %esi
+  8021de:	53                   	push   %ebx
+  8021df:	8b 75 08             	mov    0x8(%ebp),%esi
+  8021e2:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8021e5:	89 f3                	mov    %esi,%ebx
+  8021e7:	03 5d 10             	add    0x10(%ebp),%ebx
+  8021ea:	89 f0                	mov    %esi,%eax
+  8021ec:	eb 0f                	jmp    8021fd <strncpy+0x23>
+		*dst++ = *src;
+  8021ee:	83 c0 01             	add    $0x1,%eax
+  8021f1:	0f b6 0a             	movzbl (%edx),%ecx
+  8021f4:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8021f7:	80 f9 01             	cmp    $0x1,%cl
+  8021fa:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8021fd:	39 d8                	cmp    %ebx,%eax
+  8021ff:	75 ed                	jne    8021ee <strncpy+0x14>
+	}
+	return ret;
+}
+  802201:	89 f0                	mov    %esi,%eax
+  802203:	5b                   	pop    %ebx
+  802204:	5e                   	pop    %esi
+  802205:	5d                   	pop    %ebp
+  802206:	c3                   	ret
+
+00802207 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  802207:	55                   	push   %ebp
+  802208:	89 e5                	mov    %esp,%ebp
+  80220a:	56                   	push   %esi
+  80220b:	53                   	push   %ebx
+  80220c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80220f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802212:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  802215:	89 f0                	mov    %esi,%eax
+  802217:	85 d2                	test   %edx,%edx
+  802219:	74 21                	je     80223c <strlcpy+0x35>
+  80221b:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80221f:	89 f2                	mov    %esi,%edx
+  802221:	eb 09                	jmp    80222c <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  802223:	83 c1 01             	add    $0x1,%ecx
+  802226:	83 c2 01             	add    $0x1,%edx
+  802229:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80222c:	39 c2                	cmp    %eax,%edx
+  80222e:	74 09                	je     802239 <strlcpy+0x32>
+  802230:	0f b6 19             	movzbl (%ecx),%ebx
+  802233:	84 db                	test   %bl,%bl
+  802235:	75 ec                	jne    802223 <strlcpy+0x1c>
+  802237:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  802239:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80223c:	29 f0                	sub    %esi,%eax
+}
+  80223e:	5b                   	pop    %ebx
+  80223f:	5e                   	pop    %esi
+  802240:	5d                   	pop    %ebp
+  802241:	c3                   	ret
+
+00802242 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  802242:	55                   	push   %ebp
+  802243:	89 e5                	mov    %esp,%ebp
+  802245:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802248:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80224b:	eb 06                	jmp    802253 <strcmp+0x11>
+		p++, q++;
+  80224d:	83 c1 01             	add    $0x1,%ecx
+  802250:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  802253:	0f b6 01             	movzbl (%ecx),%eax
+  802256:	84 c0                	test   %al,%al
+  802258:	74 04                	je     80225e <strcmp+0x1c>
+  80225a:	3a 02                	cmp    (%edx),%al
+  80225c:	74 ef                	je     80224d <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80225e:	0f b6 c0             	movzbl %al,%eax
+  802261:	0f b6 12             	movzbl (%edx),%edx
+  802264:	29 d0                	sub    %edx,%eax
+}
+  802266:	5d                   	pop    %ebp
+  802267:	c3                   	ret
+
+00802268 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  802268:	55                   	push   %ebp
+  802269:	89 e5                	mov    %esp,%ebp
+  80226b:	53                   	push   %ebx
+  80226c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80226f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802272:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  802275:	eb 09                	jmp    802280 <strncmp+0x18>
+		n--, p++, q++;
+  802277:	83 ea 01             	sub    $0x1,%edx
+  80227a:	83 c0 01             	add    $0x1,%eax
+  80227d:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  802280:	85 d2                	test   %edx,%edx
+  802282:	74 18                	je     80229c <strncmp+0x34>
+  802284:	0f b6 18             	movzbl (%eax),%ebx
+  802287:	84 db                	test   %bl,%bl
+  802289:	74 04                	je     80228f <strncmp+0x27>
+  80228b:	3a 19                	cmp    (%ecx),%bl
+  80228d:	74 e8                	je     802277 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80228f:	0f b6 00             	movzbl (%eax),%eax
+  802292:	0f b6 11             	movzbl (%ecx),%edx
+  802295:	29 d0                	sub    %edx,%eax
+}
+  802297:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80229a:	c9                   	leave
+  80229b:	c3                   	ret
+		return 0;
+  80229c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022a1:	eb f4                	jmp    802297 <strncmp+0x2f>
+
+008022a3 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8022a3:	55                   	push   %ebp
+  8022a4:	89 e5                	mov    %esp,%ebp
+  8022a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022a9:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8022ad:	eb 03                	jmp    8022b2 <strchr+0xf>
+  8022af:	83 c0 01             	add    $0x1,%eax
+  8022b2:	0f b6 10             	movzbl (%eax),%edx
+  8022b5:	84 d2                	test   %dl,%dl
+  8022b7:	74 06                	je     8022bf <strchr+0x1c>
+		if (*s == c)
+  8022b9:	38 ca                	cmp    %cl,%dl
+  8022bb:	75 f2                	jne    8022af <strchr+0xc>
+  8022bd:	eb 05                	jmp    8022c4 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8022bf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022c4:	5d                   	pop    %ebp
+  8022c5:	c3                   	ret
+
+008022c6 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8022c6:	55                   	push   %ebp
+  8022c7:	89 e5                	mov    %esp,%ebp
+  8022c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022cc:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8022d0:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8022d3:	38 ca                	cmp    %cl,%dl
+  8022d5:	74 09                	je     8022e0 <strfind+0x1a>
+  8022d7:	84 d2                	test   %dl,%dl
+  8022d9:	74 05                	je     8022e0 <strfind+0x1a>
+	for (; *s; s++)
+  8022db:	83 c0 01             	add    $0x1,%eax
+  8022de:	eb f0                	jmp    8022d0 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8022e0:	5d                   	pop    %ebp
+  8022e1:	c3                   	ret
+
+008022e2 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8022e2:	55                   	push   %ebp
+  8022e3:	89 e5                	mov    %esp,%ebp
+  8022e5:	57                   	push   %edi
+  8022e6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8022e9:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8022ec:	85 c9                	test   %ecx,%ecx
+  8022ee:	74 20                	je     802310 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8022f0:	89 f8                	mov    %edi,%eax
+  8022f2:	09 c8                	or     %ecx,%eax
+  8022f4:	a8 03                	test   $0x3,%al
+  8022f6:	75 12                	jne    80230a <memset+0x28>
+		c &= 0xFF;
+  8022f8:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8022fc:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  802302:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  802305:	fc                   	cld
+  802306:	f3 ab                	rep stos %eax,%es:(%edi)
+  802308:	eb 06                	jmp    802310 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80230a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80230d:	fc                   	cld
+  80230e:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  802310:	89 f8                	mov    %edi,%eax
+  802312:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  802315:	c9                   	leave
+  802316:	c3                   	ret
+
+00802317 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  802317:	55                   	push   %ebp
+  802318:	89 e5                	mov    %esp,%ebp
+  80231a:	57                   	push   %edi
+  80231b:	56                   	push   %esi
+  80231c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80231f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802322:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  802325:	39 c6                	cmp    %eax,%esi
+  802327:	73 32                	jae    80235b <memmove+0x44>
+  802329:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80232c:	39 d0                	cmp    %edx,%eax
+  80232e:	73 2b                	jae    80235b <memmove+0x44>
+		s += n;
+		d += n;
+  802330:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  802333:	89 d6                	mov    %edx,%esi
+  802335:	09 fe                	or     %edi,%esi
+  802337:	09 ce                	or     %ecx,%esi
+  802339:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  80233f:	75 0e                	jne    80234f <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  802341:	83 ef 04             	sub    $0x4,%edi
+  802344:	8d 72 fc             	lea    -0x4(%edx),%esi
+  802347:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  80234a:	fd                   	std
+  80234b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80234d:	eb 09                	jmp    802358 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  80234f:	83 ef 01             	sub    $0x1,%edi
+  802352:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  802355:	fd                   	std
+  802356:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  802358:	fc                   	cld
+  802359:	eb 1a                	jmp    802375 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80235b:	89 f2                	mov    %esi,%edx
+  80235d:	09 c2                	or     %eax,%edx
+  80235f:	09 ca                	or     %ecx,%edx
+  802361:	f6 c2 03             	test   $0x3,%dl
+  802364:	75 0a                	jne    802370 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  802366:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  802369:	89 c7                	mov    %eax,%edi
+  80236b:	fc                   	cld
+  80236c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80236e:	eb 05                	jmp    802375 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  802370:	89 c7                	mov    %eax,%edi
+  802372:	fc                   	cld
+  802373:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  802375:	5e                   	pop    %esi
+  802376:	5f                   	pop    %edi
+  802377:	5d                   	pop    %ebp
+  802378:	c3                   	ret
+
+00802379 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  802379:	55                   	push   %ebp
+  80237a:	89 e5                	mov    %esp,%ebp
+  80237c:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  80237f:	ff 75 10             	push   0x10(%ebp)
+  802382:	ff 75 0c             	push   0xc(%ebp)
+  802385:	ff 75 08             	push   0x8(%ebp)
+  802388:	e8 8a ff ff ff       	call   802317 <memmove>
+}
+  80238d:	c9                   	leave
+  80238e:	c3                   	ret
+
+0080238f <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  80238f:	55                   	push   %ebp
+  802390:	89 e5                	mov    %esp,%ebp
+  802392:	56                   	push   %esi
+  802393:	53                   	push   %ebx
+  802394:	8b 45 08             	mov    0x8(%ebp),%eax
+  802397:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  80239a:	89 c6                	mov    %eax,%esi
+  80239c:	03 75 10             	add    0x10(%ebp),%esi
+  80239f:	eb 06                	jmp    8023a7 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8023a1:	83 c0 01             	add    $0x1,%eax
+  8023a4:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  8023a7:	39 f0                	cmp    %esi,%eax
+  8023a9:	74 14                	je     8023bf <memcmp+0x30>
+		if (*s1 != *s2)
+  8023ab:	0f b6 08             	movzbl (%eax),%ecx
+  8023ae:	0f b6 1a             	movzbl (%edx),%ebx
+  8023b1:	38 d9                	cmp    %bl,%cl
+  8023b3:	74 ec                	je     8023a1 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  8023b5:	0f b6 c1             	movzbl %cl,%eax
+  8023b8:	0f b6 db             	movzbl %bl,%ebx
+  8023bb:	29 d8                	sub    %ebx,%eax
+  8023bd:	eb 05                	jmp    8023c4 <memcmp+0x35>
+	}
+
+	return 0;
+  8023bf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023c4:	5b                   	pop    %ebx
+  8023c5:	5e                   	pop    %esi
+  8023c6:	5d                   	pop    %ebp
+  8023c7:	c3                   	ret
+
+008023c8 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8023c8:	55                   	push   %ebp
+  8023c9:	89 e5                	mov    %esp,%ebp
+  8023cb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023ce:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8023d1:	89 c2                	mov    %eax,%edx
+  8023d3:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8023d6:	eb 03                	jmp    8023db <memfind+0x13>
+  8023d8:	83 c0 01             	add    $0x1,%eax
+  8023db:	39 d0                	cmp    %edx,%eax
+  8023dd:	73 04                	jae    8023e3 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8023df:	38 08                	cmp    %cl,(%eax)
+  8023e1:	75 f5                	jne    8023d8 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8023e3:	5d                   	pop    %ebp
+  8023e4:	c3                   	ret
+
+008023e5 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8023e5:	55                   	push   %ebp
+  8023e6:	89 e5                	mov    %esp,%ebp
+  8023e8:	57                   	push   %edi
+  8023e9:	56                   	push   %esi
+  8023ea:	53                   	push   %ebx
+  8023eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8023ee:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8023f1:	eb 03                	jmp    8023f6 <strtol+0x11>
+		s++;
+  8023f3:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  8023f6:	0f b6 02             	movzbl (%edx),%eax
+  8023f9:	3c 20                	cmp    $0x20,%al
+  8023fb:	74 f6                	je     8023f3 <strtol+0xe>
+  8023fd:	3c 09                	cmp    $0x9,%al
+  8023ff:	74 f2                	je     8023f3 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  802401:	3c 2b                	cmp    $0x2b,%al
+  802403:	74 2a                	je     80242f <strtol+0x4a>
+	int neg = 0;
+  802405:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  80240a:	3c 2d                	cmp    $0x2d,%al
+  80240c:	74 2b                	je     802439 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80240e:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  802414:	75 0f                	jne    802425 <strtol+0x40>
+  802416:	80 3a 30             	cmpb   $0x30,(%edx)
+  802419:	74 28                	je     802443 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  80241b:	85 db                	test   %ebx,%ebx
+  80241d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802422:	0f 44 d8             	cmove  %eax,%ebx
+  802425:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80242a:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  80242d:	eb 46                	jmp    802475 <strtol+0x90>
+		s++;
+  80242f:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  802432:	bf 00 00 00 00       	mov    $0x0,%edi
+  802437:	eb d5                	jmp    80240e <strtol+0x29>
+		s++, neg = 1;
+  802439:	83 c2 01             	add    $0x1,%edx
+  80243c:	bf 01 00 00 00       	mov    $0x1,%edi
+  802441:	eb cb                	jmp    80240e <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802443:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  802447:	74 0e                	je     802457 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  802449:	85 db                	test   %ebx,%ebx
+  80244b:	75 d8                	jne    802425 <strtol+0x40>
+		s++, base = 8;
+  80244d:	83 c2 01             	add    $0x1,%edx
+  802450:	bb 08 00 00 00       	mov    $0x8,%ebx
+  802455:	eb ce                	jmp    802425 <strtol+0x40>
+		s += 2, base = 16;
+  802457:	83 c2 02             	add    $0x2,%edx
+  80245a:	bb 10 00 00 00       	mov    $0x10,%ebx
+  80245f:	eb c4                	jmp    802425 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  802461:	0f be c0             	movsbl %al,%eax
+  802464:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  802467:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80246a:	7d 3a                	jge    8024a6 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  80246c:	83 c2 01             	add    $0x1,%edx
+  80246f:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  802473:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  802475:	0f b6 02             	movzbl (%edx),%eax
+  802478:	8d 70 d0             	lea    -0x30(%eax),%esi
+  80247b:	89 f3                	mov    %esi,%ebx
+  80247d:	80 fb 09             	cmp    $0x9,%bl
+  802480:	76 df                	jbe    802461 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  802482:	8d 70 9f             	lea    -0x61(%eax),%esi
+  802485:	89 f3                	mov    %esi,%ebx
+  802487:	80 fb 19             	cmp    $0x19,%bl
+  80248a:	77 08                	ja     802494 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  80248c:	0f be c0             	movsbl %al,%eax
+  80248f:	83 e8 57             	sub    $0x57,%eax
+  802492:	eb d3                	jmp    802467 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  802494:	8d 70 bf             	lea    -0x41(%eax),%esi
+  802497:	89 f3                	mov    %esi,%ebx
+  802499:	80 fb 19             	cmp    $0x19,%bl
+  80249c:	77 08                	ja     8024a6 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  80249e:	0f be c0             	movsbl %al,%eax
+  8024a1:	83 e8 37             	sub    $0x37,%eax
+  8024a4:	eb c1                	jmp    802467 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  8024a6:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8024aa:	74 05                	je     8024b1 <strtol+0xcc>
+		*endptr = (char *) s;
+  8024ac:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024af:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  8024b1:	89 c8                	mov    %ecx,%eax
+  8024b3:	f7 d8                	neg    %eax
+  8024b5:	85 ff                	test   %edi,%edi
+  8024b7:	0f 45 c8             	cmovne %eax,%ecx
+}
+  8024ba:	89 c8                	mov    %ecx,%eax
+  8024bc:	5b                   	pop    %ebx
+  8024bd:	5e                   	pop    %esi
+  8024be:	5f                   	pop    %edi
+  8024bf:	5d                   	pop    %ebp
+  8024c0:	c3                   	ret
+
+008024c1 <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8024c1:	55                   	push   %ebp
+  8024c2:	89 e5                	mov    %esp,%ebp
+  8024c4:	57                   	push   %edi
+  8024c5:	56                   	push   %esi
+  8024c6:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8024c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024cf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8024d2:	89 c3                	mov    %eax,%ebx
+  8024d4:	89 c7                	mov    %eax,%edi
+  8024d6:	89 c6                	mov    %eax,%esi
+  8024d8:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  8024da:	5b                   	pop    %ebx
+  8024db:	5e                   	pop    %esi
+  8024dc:	5f                   	pop    %edi
+  8024dd:	5d                   	pop    %ebp
+  8024de:	c3                   	ret
+
+008024df <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8024df:	55                   	push   %ebp
+  8024e0:	89 e5                	mov    %esp,%ebp
+  8024e2:	57                   	push   %edi
+  8024e3:	56                   	push   %esi
+  8024e4:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8024e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024ea:	b8 01 00 00 00       	mov    $0x1,%eax
+  8024ef:	89 d1                	mov    %edx,%ecx
+  8024f1:	89 d3                	mov    %edx,%ebx
+  8024f3:	89 d7                	mov    %edx,%edi
+  8024f5:	89 d6                	mov    %edx,%esi
+  8024f7:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8024f9:	5b                   	pop    %ebx
+  8024fa:	5e                   	pop    %esi
+  8024fb:	5f                   	pop    %edi
+  8024fc:	5d                   	pop    %ebp
+  8024fd:	c3                   	ret
+
+008024fe <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8024fe:	55                   	push   %ebp
+  8024ff:	89 e5                	mov    %esp,%ebp
+  802501:	57                   	push   %edi
+  802502:	56                   	push   %esi
+  802503:	53                   	push   %ebx
+  802504:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  802507:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80250c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80250f:	b8 03 00 00 00       	mov    $0x3,%eax
+  802514:	89 cb                	mov    %ecx,%ebx
+  802516:	89 cf                	mov    %ecx,%edi
+  802518:	89 ce                	mov    %ecx,%esi
+  80251a:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80251c:	85 c0                	test   %eax,%eax
+  80251e:	7f 08                	jg     802528 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  802520:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802523:	5b                   	pop    %ebx
+  802524:	5e                   	pop    %esi
+  802525:	5f                   	pop    %edi
+  802526:	5d                   	pop    %ebp
+  802527:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  802528:	83 ec 0c             	sub    $0xc,%esp
+  80252b:	50                   	push   %eax
+  80252c:	6a 03                	push   $0x3
+  80252e:	68 e3 48 80 00       	push   $0x8048e3
+  802533:	6a 3e                	push   $0x3e
+  802535:	68 00 49 80 00       	push   $0x804900
+  80253a:	e8 be f5 ff ff       	call   801afd <_panic>
+
+0080253f <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80253f:	55                   	push   %ebp
+  802540:	89 e5                	mov    %esp,%ebp
+  802542:	57                   	push   %edi
+  802543:	56                   	push   %esi
+  802544:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  802545:	ba 00 00 00 00       	mov    $0x0,%edx
+  80254a:	b8 02 00 00 00       	mov    $0x2,%eax
+  80254f:	89 d1                	mov    %edx,%ecx
+  802551:	89 d3                	mov    %edx,%ebx
+  802553:	89 d7                	mov    %edx,%edi
+  802555:	89 d6                	mov    %edx,%esi
+  802557:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  802559:	5b                   	pop    %ebx
+  80255a:	5e                   	pop    %esi
+  80255b:	5f                   	pop    %edi
+  80255c:	5d                   	pop    %ebp
+  80255d:	c3                   	ret
+
+0080255e <sys_yield>:
+
+void
+sys_yield(void) {
+  80255e:	55                   	push   %ebp
+  80255f:	89 e5                	mov    %esp,%ebp
+  802561:	57                   	push   %edi
+  802562:	56                   	push   %esi
+  802563:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  802564:	ba 00 00 00 00       	mov    $0x0,%edx
+  802569:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80256e:	89 d1                	mov    %edx,%ecx
+  802570:	89 d3                	mov    %edx,%ebx
+  802572:	89 d7                	mov    %edx,%edi
+  802574:	89 d6                	mov    %edx,%esi
+  802576:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  802578:	5b                   	pop    %ebx
+  802579:	5e                   	pop    %esi
+  80257a:	5f                   	pop    %edi
+  80257b:	5d                   	pop    %ebp
+  80257c:	c3                   	ret
+
+0080257d <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  80257d:	55                   	push   %ebp
+  80257e:	89 e5                	mov    %esp,%ebp
+  802580:	57                   	push   %edi
+  802581:	56                   	push   %esi
+  802582:	53                   	push   %ebx
+  802583:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  802586:	be 00 00 00 00       	mov    $0x0,%esi
+  80258b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80258e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802591:	b8 04 00 00 00       	mov    $0x4,%eax
+  802596:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802599:	89 f7                	mov    %esi,%edi
+  80259b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80259d:	85 c0                	test   %eax,%eax
+  80259f:	7f 08                	jg     8025a9 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  8025a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025a4:	5b                   	pop    %ebx
+  8025a5:	5e                   	pop    %esi
+  8025a6:	5f                   	pop    %edi
+  8025a7:	5d                   	pop    %ebp
+  8025a8:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8025a9:	83 ec 0c             	sub    $0xc,%esp
+  8025ac:	50                   	push   %eax
+  8025ad:	6a 04                	push   $0x4
+  8025af:	68 e3 48 80 00       	push   $0x8048e3
+  8025b4:	6a 3e                	push   $0x3e
+  8025b6:	68 00 49 80 00       	push   $0x804900
+  8025bb:	e8 3d f5 ff ff       	call   801afd <_panic>
+
+008025c0 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  8025c0:	55                   	push   %ebp
+  8025c1:	89 e5                	mov    %esp,%ebp
+  8025c3:	57                   	push   %edi
+  8025c4:	56                   	push   %esi
+  8025c5:	53                   	push   %ebx
+  8025c6:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8025c9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8025cc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8025cf:	b8 05 00 00 00       	mov    $0x5,%eax
+  8025d4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8025d7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8025da:	8b 75 18             	mov    0x18(%ebp),%esi
+  8025dd:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8025df:	85 c0                	test   %eax,%eax
+  8025e1:	7f 08                	jg     8025eb <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  8025e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025e6:	5b                   	pop    %ebx
+  8025e7:	5e                   	pop    %esi
+  8025e8:	5f                   	pop    %edi
+  8025e9:	5d                   	pop    %ebp
+  8025ea:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8025eb:	83 ec 0c             	sub    $0xc,%esp
+  8025ee:	50                   	push   %eax
+  8025ef:	6a 05                	push   $0x5
+  8025f1:	68 e3 48 80 00       	push   $0x8048e3
+  8025f6:	6a 3e                	push   $0x3e
+  8025f8:	68 00 49 80 00       	push   $0x804900
+  8025fd:	e8 fb f4 ff ff       	call   801afd <_panic>
+
+00802602 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  802602:	55                   	push   %ebp
+  802603:	89 e5                	mov    %esp,%ebp
+  802605:	57                   	push   %edi
+  802606:	56                   	push   %esi
+  802607:	53                   	push   %ebx
+  802608:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  80260b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802610:	8b 55 08             	mov    0x8(%ebp),%edx
+  802613:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802616:	b8 06 00 00 00       	mov    $0x6,%eax
+  80261b:	89 df                	mov    %ebx,%edi
+  80261d:	89 de                	mov    %ebx,%esi
+  80261f:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  802621:	85 c0                	test   %eax,%eax
+  802623:	7f 08                	jg     80262d <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  802625:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802628:	5b                   	pop    %ebx
+  802629:	5e                   	pop    %esi
+  80262a:	5f                   	pop    %edi
+  80262b:	5d                   	pop    %ebp
+  80262c:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80262d:	83 ec 0c             	sub    $0xc,%esp
+  802630:	50                   	push   %eax
+  802631:	6a 06                	push   $0x6
+  802633:	68 e3 48 80 00       	push   $0x8048e3
+  802638:	6a 3e                	push   $0x3e
+  80263a:	68 00 49 80 00       	push   $0x804900
+  80263f:	e8 b9 f4 ff ff       	call   801afd <_panic>
+
+00802644 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802644:	55                   	push   %ebp
+  802645:	89 e5                	mov    %esp,%ebp
+  802647:	57                   	push   %edi
+  802648:	56                   	push   %esi
+  802649:	53                   	push   %ebx
+  80264a:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  80264d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802652:	8b 55 08             	mov    0x8(%ebp),%edx
+  802655:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802658:	b8 08 00 00 00       	mov    $0x8,%eax
+  80265d:	89 df                	mov    %ebx,%edi
+  80265f:	89 de                	mov    %ebx,%esi
+  802661:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  802663:	85 c0                	test   %eax,%eax
+  802665:	7f 08                	jg     80266f <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  802667:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80266a:	5b                   	pop    %ebx
+  80266b:	5e                   	pop    %esi
+  80266c:	5f                   	pop    %edi
+  80266d:	5d                   	pop    %ebp
+  80266e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80266f:	83 ec 0c             	sub    $0xc,%esp
+  802672:	50                   	push   %eax
+  802673:	6a 08                	push   $0x8
+  802675:	68 e3 48 80 00       	push   $0x8048e3
+  80267a:	6a 3e                	push   $0x3e
+  80267c:	68 00 49 80 00       	push   $0x804900
+  802681:	e8 77 f4 ff ff       	call   801afd <_panic>
+
+00802686 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802686:	55                   	push   %ebp
+  802687:	89 e5                	mov    %esp,%ebp
+  802689:	57                   	push   %edi
+  80268a:	56                   	push   %esi
+  80268b:	53                   	push   %ebx
+  80268c:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  80268f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802694:	8b 55 08             	mov    0x8(%ebp),%edx
+  802697:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80269a:	b8 09 00 00 00       	mov    $0x9,%eax
+  80269f:	89 df                	mov    %ebx,%edi
+  8026a1:	89 de                	mov    %ebx,%esi
+  8026a3:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8026a5:	85 c0                	test   %eax,%eax
+  8026a7:	7f 08                	jg     8026b1 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8026a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026ac:	5b                   	pop    %ebx
+  8026ad:	5e                   	pop    %esi
+  8026ae:	5f                   	pop    %edi
+  8026af:	5d                   	pop    %ebp
+  8026b0:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8026b1:	83 ec 0c             	sub    $0xc,%esp
+  8026b4:	50                   	push   %eax
+  8026b5:	6a 09                	push   $0x9
+  8026b7:	68 e3 48 80 00       	push   $0x8048e3
+  8026bc:	6a 3e                	push   $0x3e
+  8026be:	68 00 49 80 00       	push   $0x804900
+  8026c3:	e8 35 f4 ff ff       	call   801afd <_panic>
+
+008026c8 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8026c8:	55                   	push   %ebp
+  8026c9:	89 e5                	mov    %esp,%ebp
+  8026cb:	57                   	push   %edi
+  8026cc:	56                   	push   %esi
+  8026cd:	53                   	push   %ebx
+  8026ce:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8026d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8026d9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8026dc:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8026e1:	89 df                	mov    %ebx,%edi
+  8026e3:	89 de                	mov    %ebx,%esi
+  8026e5:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8026e7:	85 c0                	test   %eax,%eax
+  8026e9:	7f 08                	jg     8026f3 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8026eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026ee:	5b                   	pop    %ebx
+  8026ef:	5e                   	pop    %esi
+  8026f0:	5f                   	pop    %edi
+  8026f1:	5d                   	pop    %ebp
+  8026f2:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8026f3:	83 ec 0c             	sub    $0xc,%esp
+  8026f6:	50                   	push   %eax
+  8026f7:	6a 0a                	push   $0xa
+  8026f9:	68 e3 48 80 00       	push   $0x8048e3
+  8026fe:	6a 3e                	push   $0x3e
+  802700:	68 00 49 80 00       	push   $0x804900
+  802705:	e8 f3 f3 ff ff       	call   801afd <_panic>
+
+0080270a <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  80270a:	55                   	push   %ebp
+  80270b:	89 e5                	mov    %esp,%ebp
+  80270d:	57                   	push   %edi
+  80270e:	56                   	push   %esi
+  80270f:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  802710:	8b 55 08             	mov    0x8(%ebp),%edx
+  802713:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802716:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80271b:	be 00 00 00 00       	mov    $0x0,%esi
+  802720:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802723:	8b 7d 14             	mov    0x14(%ebp),%edi
+  802726:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  802728:	5b                   	pop    %ebx
+  802729:	5e                   	pop    %esi
+  80272a:	5f                   	pop    %edi
+  80272b:	5d                   	pop    %ebp
+  80272c:	c3                   	ret
+
+0080272d <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  80272d:	55                   	push   %ebp
+  80272e:	89 e5                	mov    %esp,%ebp
+  802730:	57                   	push   %edi
+  802731:	56                   	push   %esi
+  802732:	53                   	push   %ebx
+  802733:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  802736:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80273b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80273e:	b8 0d 00 00 00       	mov    $0xd,%eax
+  802743:	89 cb                	mov    %ecx,%ebx
+  802745:	89 cf                	mov    %ecx,%edi
+  802747:	89 ce                	mov    %ecx,%esi
+  802749:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80274b:	85 c0                	test   %eax,%eax
+  80274d:	7f 08                	jg     802757 <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  80274f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802752:	5b                   	pop    %ebx
+  802753:	5e                   	pop    %esi
+  802754:	5f                   	pop    %edi
+  802755:	5d                   	pop    %ebp
+  802756:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  802757:	83 ec 0c             	sub    $0xc,%esp
+  80275a:	50                   	push   %eax
+  80275b:	6a 0d                	push   $0xd
+  80275d:	68 e3 48 80 00       	push   $0x8048e3
+  802762:	6a 3e                	push   $0x3e
+  802764:	68 00 49 80 00       	push   $0x804900
+  802769:	e8 8f f3 ff ff       	call   801afd <_panic>
+
+0080276e <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  80276e:	55                   	push   %ebp
+  80276f:	89 e5                	mov    %esp,%ebp
+  802771:	57                   	push   %edi
+  802772:	56                   	push   %esi
+  802773:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  802774:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802779:	8b 55 08             	mov    0x8(%ebp),%edx
+  80277c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80277f:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802784:	89 df                	mov    %ebx,%edi
+  802786:	89 de                	mov    %ebx,%esi
+  802788:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  80278a:	5b                   	pop    %ebx
+  80278b:	5e                   	pop    %esi
+  80278c:	5f                   	pop    %edi
+  80278d:	5d                   	pop    %ebp
+  80278e:	c3                   	ret
+
+0080278f <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  80278f:	55                   	push   %ebp
+  802790:	89 e5                	mov    %esp,%ebp
+  802792:	57                   	push   %edi
+  802793:	56                   	push   %esi
+  802794:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  802795:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80279a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80279d:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8027a2:	89 cb                	mov    %ecx,%ebx
+  8027a4:	89 cf                	mov    %ecx,%edi
+  8027a6:	89 ce                	mov    %ecx,%esi
+  8027a8:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  8027aa:	5b                   	pop    %ebx
+  8027ab:	5e                   	pop    %esi
+  8027ac:	5f                   	pop    %edi
+  8027ad:	5d                   	pop    %ebp
+  8027ae:	c3                   	ret
+
+008027af <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  8027af:	55                   	push   %ebp
+  8027b0:	89 e5                	mov    %esp,%ebp
+  8027b2:	57                   	push   %edi
+  8027b3:	56                   	push   %esi
+  8027b4:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8027b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027ba:	b8 10 00 00 00       	mov    $0x10,%eax
+  8027bf:	89 d1                	mov    %edx,%ecx
+  8027c1:	89 d3                	mov    %edx,%ebx
+  8027c3:	89 d7                	mov    %edx,%edi
+  8027c5:	89 d6                	mov    %edx,%esi
+  8027c7:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8027c9:	5b                   	pop    %ebx
+  8027ca:	5e                   	pop    %esi
+  8027cb:	5f                   	pop    %edi
+  8027cc:	5d                   	pop    %ebp
+  8027cd:	c3                   	ret
+
+008027ce <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  8027ce:	55                   	push   %ebp
+  8027cf:	89 e5                	mov    %esp,%ebp
+  8027d1:	57                   	push   %edi
+  8027d2:	56                   	push   %esi
+  8027d3:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8027d4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027d9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8027dc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8027df:	b8 11 00 00 00       	mov    $0x11,%eax
+  8027e4:	89 df                	mov    %ebx,%edi
+  8027e6:	89 de                	mov    %ebx,%esi
+  8027e8:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  8027ea:	5b                   	pop    %ebx
+  8027eb:	5e                   	pop    %esi
+  8027ec:	5f                   	pop    %edi
+  8027ed:	5d                   	pop    %ebp
+  8027ee:	c3                   	ret
+
+008027ef <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  8027ef:	55                   	push   %ebp
+  8027f0:	89 e5                	mov    %esp,%ebp
+  8027f2:	57                   	push   %edi
+  8027f3:	56                   	push   %esi
+  8027f4:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8027f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027fa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8027fd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802800:	b8 12 00 00 00       	mov    $0x12,%eax
+  802805:	89 df                	mov    %ebx,%edi
+  802807:	89 de                	mov    %ebx,%esi
+  802809:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  80280b:	5b                   	pop    %ebx
+  80280c:	5e                   	pop    %esi
+  80280d:	5f                   	pop    %edi
+  80280e:	5d                   	pop    %ebp
+  80280f:	c3                   	ret
+
+00802810 <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  802810:	55                   	push   %ebp
+  802811:	89 e5                	mov    %esp,%ebp
+  802813:	57                   	push   %edi
+  802814:	56                   	push   %esi
+  802815:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  802816:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80281b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80281e:	b8 13 00 00 00       	mov    $0x13,%eax
+  802823:	89 cb                	mov    %ecx,%ebx
+  802825:	89 cf                	mov    %ecx,%edi
+  802827:	89 ce                	mov    %ecx,%esi
+  802829:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  80282b:	5b                   	pop    %ebx
+  80282c:	5e                   	pop    %esi
+  80282d:	5f                   	pop    %edi
+  80282e:	5d                   	pop    %ebp
+  80282f:	c3                   	ret
+
+00802830 <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  802830:	55                   	push   %ebp
+  802831:	89 e5                	mov    %esp,%ebp
+  802833:	57                   	push   %edi
+  802834:	56                   	push   %esi
+  802835:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  802836:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80283b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80283e:	b8 14 00 00 00       	mov    $0x14,%eax
+  802843:	89 cb                	mov    %ecx,%ebx
+  802845:	89 cf                	mov    %ecx,%edi
+  802847:	89 ce                	mov    %ecx,%esi
+  802849:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  80284b:	5b                   	pop    %ebx
+  80284c:	5e                   	pop    %esi
+  80284d:	5f                   	pop    %edi
+  80284e:	5d                   	pop    %ebp
+  80284f:	c3                   	ret
+
+00802850 <set_pgfault_handler>:
+// allocate an exception stack (one page of memory with its top
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf)) {
+  802850:	55                   	push   %ebp
+  802851:	89 e5                	mov    %esp,%ebp
+  802853:	83 ec 08             	sub    $0x8,%esp
+  int r;
+
+  if (_pgfault_handler == 0) {
+  802856:	83 3d 14 a0 80 00 00 	cmpl   $0x0,0x80a014
+  80285d:	74 0a                	je     802869 <set_pgfault_handler+0x19>
+    if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)))
+      panic(" set_pgfault_handler sys_env_set_pgfault_upcall panic: %e\n", r);
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  80285f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802862:	a3 14 a0 80 00       	mov    %eax,0x80a014
+
+
+}
+  802867:	c9                   	leave
+  802868:	c3                   	ret
+    if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)))
+  802869:	83 ec 04             	sub    $0x4,%esp
+  80286c:	6a 07                	push   $0x7
+  80286e:	68 00 f0 bf ee       	push   $0xeebff000
+  802873:	6a 00                	push   $0x0
+  802875:	e8 03 fd ff ff       	call   80257d <sys_page_alloc>
+  80287a:	83 c4 10             	add    $0x10,%esp
+  80287d:	85 c0                	test   %eax,%eax
+  80287f:	75 28                	jne    8028a9 <set_pgfault_handler+0x59>
+    if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)))
+  802881:	83 ec 08             	sub    $0x8,%esp
+  802884:	68 bb 28 80 00       	push   $0x8028bb
+  802889:	6a 00                	push   $0x0
+  80288b:	e8 38 fe ff ff       	call   8026c8 <sys_env_set_pgfault_upcall>
+  802890:	83 c4 10             	add    $0x10,%esp
+  802893:	85 c0                	test   %eax,%eax
+  802895:	74 c8                	je     80285f <set_pgfault_handler+0xf>
+      panic(" set_pgfault_handler sys_env_set_pgfault_upcall panic: %e\n", r);
+  802897:	50                   	push   %eax
+  802898:	68 40 49 80 00       	push   $0x804940
+  80289d:	6a 22                	push   $0x22
+  80289f:	68 7b 49 80 00       	push   $0x80497b
+  8028a4:	e8 54 f2 ff ff       	call   801afd <_panic>
+      panic("set_pgfault_handler sys_page_alloc panic: %e\n", r);
+  8028a9:	50                   	push   %eax
+  8028aa:	68 10 49 80 00       	push   $0x804910
+  8028af:	6a 20                	push   $0x20
+  8028b1:	68 7b 49 80 00       	push   $0x80497b
+  8028b6:	e8 42 f2 ff ff       	call   801afd <_panic>
+
+008028bb <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8028bb:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8028bc:	a1 14 a0 80 00       	mov    0x80a014,%eax
+	call *%eax
+  8028c1:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8028c3:	83 c4 04             	add    $0x4,%esp
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	// push the trap-time %eip onto the trap-time stack
+    subl $0x4, 0x30(%esp) # for push eip
+  8028c6:	83 6c 24 30 04       	subl   $0x4,0x30(%esp)
+    movl 0x30(%esp), %ebx #regular esp
+  8028cb:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+    movl 0x28(%esp), %eax #eip
+  8028cf:	8b 44 24 28          	mov    0x28(%esp),%eax
+    movl %eax, (%ebx)
+  8028d3:	89 03                	mov    %eax,(%ebx)
+
+    // Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+    addl $8, %esp
+  8028d5:	83 c4 08             	add    $0x8,%esp
+    popal
+  8028d8:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  8028d9:	83 c4 04             	add    $0x4,%esp
+	popfl
+  8028dc:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  8028dd:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  8028de:	c3                   	ret
+
+008028df <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  8028df:	55                   	push   %ebp
+  8028e0:	89 e5                	mov    %esp,%ebp
+  8028e2:	56                   	push   %esi
+  8028e3:	53                   	push   %ebx
+  8028e4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8028e7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8028ea:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  8028ed:	85 c0                	test   %eax,%eax
+  8028ef:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8028f4:	0f 44 c2             	cmove  %edx,%eax
+  8028f7:	83 ec 0c             	sub    $0xc,%esp
+  8028fa:	50                   	push   %eax
+  8028fb:	e8 2d fe ff ff       	call   80272d <sys_ipc_recv>
+
+  if (from_env_store)
+  802900:	83 c4 10             	add    $0x10,%esp
+  802903:	85 f6                	test   %esi,%esi
+  802905:	74 17                	je     80291e <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  802907:	ba 00 00 00 00       	mov    $0x0,%edx
+  80290c:	85 c0                	test   %eax,%eax
+  80290e:	75 0c                	jne    80291c <ipc_recv+0x3d>
+  802910:	8b 15 10 a0 80 00    	mov    0x80a010,%edx
+  802916:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  80291c:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  80291e:	85 db                	test   %ebx,%ebx
+  802920:	74 2b                	je     80294d <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  802922:	85 c0                	test   %eax,%eax
+  802924:	74 0d                	je     802933 <ipc_recv+0x54>
+  802926:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  80292c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80292f:	5b                   	pop    %ebx
+  802930:	5e                   	pop    %esi
+  802931:	5d                   	pop    %ebp
+  802932:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  802933:	a1 10 a0 80 00       	mov    0x80a010,%eax
+  802938:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80293e:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  802940:	a1 10 a0 80 00       	mov    0x80a010,%eax
+  802945:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  80294b:	eb df                	jmp    80292c <ipc_recv+0x4d>
+  80294d:	85 c0                	test   %eax,%eax
+  80294f:	75 db                	jne    80292c <ipc_recv+0x4d>
+  802951:	eb ed                	jmp    802940 <ipc_recv+0x61>
+
+00802953 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  802953:	55                   	push   %ebp
+  802954:	89 e5                	mov    %esp,%ebp
+  802956:	57                   	push   %edi
+  802957:	56                   	push   %esi
+  802958:	53                   	push   %ebx
+  802959:	83 ec 0c             	sub    $0xc,%esp
+  80295c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80295f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802962:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  802965:	85 db                	test   %ebx,%ebx
+  802967:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80296c:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  80296f:	ff 75 14             	push   0x14(%ebp)
+  802972:	53                   	push   %ebx
+  802973:	56                   	push   %esi
+  802974:	57                   	push   %edi
+  802975:	e8 90 fd ff ff       	call   80270a <sys_ipc_try_send>
+  80297a:	83 c4 10             	add    $0x10,%esp
+  80297d:	85 c0                	test   %eax,%eax
+  80297f:	74 1e                	je     80299f <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  802981:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802984:	75 07                	jne    80298d <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  802986:	e8 d3 fb ff ff       	call   80255e <sys_yield>
+  80298b:	eb e2                	jmp    80296f <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  80298d:	50                   	push   %eax
+  80298e:	68 89 49 80 00       	push   $0x804989
+  802993:	6a 3c                	push   $0x3c
+  802995:	68 96 49 80 00       	push   $0x804996
+  80299a:	e8 5e f1 ff ff       	call   801afd <_panic>
+  }
+
+#endif
+}
+  80299f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029a2:	5b                   	pop    %ebx
+  8029a3:	5e                   	pop    %esi
+  8029a4:	5f                   	pop    %edi
+  8029a5:	5d                   	pop    %ebp
+  8029a6:	c3                   	ret
+
+008029a7 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  8029a7:	55                   	push   %ebp
+  8029a8:	89 e5                	mov    %esp,%ebp
+  8029aa:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  8029ad:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  8029b2:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8029b5:	c1 e0 04             	shl    $0x4,%eax
+  8029b8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8029bd:	8b 40 50             	mov    0x50(%eax),%eax
+  8029c0:	39 c8                	cmp    %ecx,%eax
+  8029c2:	74 12                	je     8029d6 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  8029c4:	83 c2 01             	add    $0x1,%edx
+  8029c7:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8029cd:	75 e3                	jne    8029b2 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  8029cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029d4:	eb 0e                	jmp    8029e4 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  8029d6:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8029d9:	c1 e0 04             	shl    $0x4,%eax
+  8029dc:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8029e1:	8b 40 48             	mov    0x48(%eax),%eax
+  8029e4:	5d                   	pop    %ebp
+  8029e5:	c3                   	ret
+
+008029e6 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8029e6:	55                   	push   %ebp
+  8029e7:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8029e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029ec:	05 00 00 00 30       	add    $0x30000000,%eax
+  8029f1:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8029f4:	5d                   	pop    %ebp
+  8029f5:	c3                   	ret
+
+008029f6 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8029f6:	55                   	push   %ebp
+  8029f7:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8029f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029fc:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  802a01:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802a06:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  802a0b:	5d                   	pop    %ebp
+  802a0c:	c3                   	ret
+
+00802a0d <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  802a0d:	55                   	push   %ebp
+  802a0e:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  802a10:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  802a15:	eb 02                	jmp    802a19 <fd_alloc+0xc>
+  802a17:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  802a19:	89 c2                	mov    %eax,%edx
+  802a1b:	c1 ea 16             	shr    $0x16,%edx
+  802a1e:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802a25:	f6 c2 01             	test   $0x1,%dl
+  802a28:	74 2b                	je     802a55 <fd_alloc+0x48>
+  802a2a:	89 c2                	mov    %eax,%edx
+  802a2c:	c1 ea 0c             	shr    $0xc,%edx
+  802a2f:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  802a36:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  802a3c:	f6 c1 01             	test   $0x1,%cl
+  802a3f:	74 14                	je     802a55 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  802a41:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  802a47:	75 ce                	jne    802a17 <fd_alloc+0xa>
+  802a49:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  802a4e:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  802a53:	eb 05                	jmp    802a5a <fd_alloc+0x4d>
+			return 0;
+  802a55:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  802a5a:	8b 55 08             	mov    0x8(%ebp),%edx
+  802a5d:	89 02                	mov    %eax,(%edx)
+}
+  802a5f:	89 c8                	mov    %ecx,%eax
+  802a61:	5d                   	pop    %ebp
+  802a62:	c3                   	ret
+
+00802a63 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  802a63:	55                   	push   %ebp
+  802a64:	89 e5                	mov    %esp,%ebp
+  802a66:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  802a69:	83 f8 1f             	cmp    $0x1f,%eax
+  802a6c:	77 30                	ja     802a9e <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  802a6e:	c1 e0 0c             	shl    $0xc,%eax
+  802a71:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  802a76:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  802a7c:	f6 c2 01             	test   $0x1,%dl
+  802a7f:	74 24                	je     802aa5 <fd_lookup+0x42>
+  802a81:	89 c2                	mov    %eax,%edx
+  802a83:	c1 ea 0c             	shr    $0xc,%edx
+  802a86:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802a8d:	f6 c2 01             	test   $0x1,%dl
+  802a90:	74 1a                	je     802aac <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  802a92:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802a95:	89 02                	mov    %eax,(%edx)
+	return 0;
+  802a97:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a9c:	5d                   	pop    %ebp
+  802a9d:	c3                   	ret
+		return -E_INVAL;
+  802a9e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802aa3:	eb f7                	jmp    802a9c <fd_lookup+0x39>
+		return -E_INVAL;
+  802aa5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802aaa:	eb f0                	jmp    802a9c <fd_lookup+0x39>
+  802aac:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ab1:	eb e9                	jmp    802a9c <fd_lookup+0x39>
+
+00802ab3 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  802ab3:	55                   	push   %ebp
+  802ab4:	89 e5                	mov    %esp,%ebp
+  802ab6:	53                   	push   %ebx
+  802ab7:	83 ec 04             	sub    $0x4,%esp
+  802aba:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  802abd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ac2:	eb 03                	jmp    802ac7 <dev_lookup+0x14>
+  802ac4:	83 c0 01             	add    $0x1,%eax
+  802ac7:	8b 1c 85 1c 4a 80 00 	mov    0x804a1c(,%eax,4),%ebx
+  802ace:	85 db                	test   %ebx,%ebx
+  802ad0:	74 0b                	je     802add <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  802ad2:	39 13                	cmp    %edx,(%ebx)
+  802ad4:	75 ee                	jne    802ac4 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  802ad6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802adb:	eb 1f                	jmp    802afc <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802add:	a1 10 a0 80 00       	mov    0x80a010,%eax
+  802ae2:	8b 40 48             	mov    0x48(%eax),%eax
+  802ae5:	83 ec 04             	sub    $0x4,%esp
+  802ae8:	52                   	push   %edx
+  802ae9:	50                   	push   %eax
+  802aea:	68 a0 49 80 00       	push   $0x8049a0
+  802aef:	e8 e4 f0 ff ff       	call   801bd8 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  802af4:	83 c4 10             	add    $0x10,%esp
+  802af7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  802afc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802aff:	89 1a                	mov    %ebx,(%edx)
+}
+  802b01:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b04:	c9                   	leave
+  802b05:	c3                   	ret
+
+00802b06 <fd_close>:
+{
+  802b06:	55                   	push   %ebp
+  802b07:	89 e5                	mov    %esp,%ebp
+  802b09:	57                   	push   %edi
+  802b0a:	56                   	push   %esi
+  802b0b:	53                   	push   %ebx
+  802b0c:	83 ec 24             	sub    $0x24,%esp
+  802b0f:	8b 75 08             	mov    0x8(%ebp),%esi
+  802b12:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  802b15:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802b18:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  802b19:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  802b1f:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  802b22:	50                   	push   %eax
+  802b23:	e8 3b ff ff ff       	call   802a63 <fd_lookup>
+  802b28:	89 c3                	mov    %eax,%ebx
+  802b2a:	83 c4 10             	add    $0x10,%esp
+  802b2d:	85 c0                	test   %eax,%eax
+  802b2f:	78 05                	js     802b36 <fd_close+0x30>
+	    || fd != fd2)
+  802b31:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  802b34:	74 16                	je     802b4c <fd_close+0x46>
+		return (must_exist ? r : 0);
+  802b36:	89 f8                	mov    %edi,%eax
+  802b38:	84 c0                	test   %al,%al
+  802b3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b3f:	0f 44 d8             	cmove  %eax,%ebx
+}
+  802b42:	89 d8                	mov    %ebx,%eax
+  802b44:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b47:	5b                   	pop    %ebx
+  802b48:	5e                   	pop    %esi
+  802b49:	5f                   	pop    %edi
+  802b4a:	5d                   	pop    %ebp
+  802b4b:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802b4c:	83 ec 08             	sub    $0x8,%esp
+  802b4f:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  802b52:	50                   	push   %eax
+  802b53:	ff 36                	push   (%esi)
+  802b55:	e8 59 ff ff ff       	call   802ab3 <dev_lookup>
+  802b5a:	89 c3                	mov    %eax,%ebx
+  802b5c:	83 c4 10             	add    $0x10,%esp
+  802b5f:	85 c0                	test   %eax,%eax
+  802b61:	78 1a                	js     802b7d <fd_close+0x77>
+		if (dev->dev_close)
+  802b63:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802b66:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  802b69:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  802b6e:	85 c0                	test   %eax,%eax
+  802b70:	74 0b                	je     802b7d <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  802b72:	83 ec 0c             	sub    $0xc,%esp
+  802b75:	56                   	push   %esi
+  802b76:	ff d0                	call   *%eax
+  802b78:	89 c3                	mov    %eax,%ebx
+  802b7a:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  802b7d:	83 ec 08             	sub    $0x8,%esp
+  802b80:	56                   	push   %esi
+  802b81:	6a 00                	push   $0x0
+  802b83:	e8 7a fa ff ff       	call   802602 <sys_page_unmap>
+	return r;
+  802b88:	83 c4 10             	add    $0x10,%esp
+  802b8b:	eb b5                	jmp    802b42 <fd_close+0x3c>
+
+00802b8d <close>:
+
+int
+close(int fdnum)
+{
+  802b8d:	55                   	push   %ebp
+  802b8e:	89 e5                	mov    %esp,%ebp
+  802b90:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802b93:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b96:	50                   	push   %eax
+  802b97:	ff 75 08             	push   0x8(%ebp)
+  802b9a:	e8 c4 fe ff ff       	call   802a63 <fd_lookup>
+  802b9f:	83 c4 10             	add    $0x10,%esp
+  802ba2:	85 c0                	test   %eax,%eax
+  802ba4:	79 02                	jns    802ba8 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  802ba6:	c9                   	leave
+  802ba7:	c3                   	ret
+		return fd_close(fd, 1);
+  802ba8:	83 ec 08             	sub    $0x8,%esp
+  802bab:	6a 01                	push   $0x1
+  802bad:	ff 75 f4             	push   -0xc(%ebp)
+  802bb0:	e8 51 ff ff ff       	call   802b06 <fd_close>
+  802bb5:	83 c4 10             	add    $0x10,%esp
+  802bb8:	eb ec                	jmp    802ba6 <close+0x19>
+
+00802bba <close_all>:
+
+void
+close_all(void)
+{
+  802bba:	55                   	push   %ebp
+  802bbb:	89 e5                	mov    %esp,%ebp
+  802bbd:	53                   	push   %ebx
+  802bbe:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  802bc1:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  802bc6:	83 ec 0c             	sub    $0xc,%esp
+  802bc9:	53                   	push   %ebx
+  802bca:	e8 be ff ff ff       	call   802b8d <close>
+	for (i = 0; i < MAXFD; i++)
+  802bcf:	83 c3 01             	add    $0x1,%ebx
+  802bd2:	83 c4 10             	add    $0x10,%esp
+  802bd5:	83 fb 20             	cmp    $0x20,%ebx
+  802bd8:	75 ec                	jne    802bc6 <close_all+0xc>
+}
+  802bda:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802bdd:	c9                   	leave
+  802bde:	c3                   	ret
+
+00802bdf <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  802bdf:	55                   	push   %ebp
+  802be0:	89 e5                	mov    %esp,%ebp
+  802be2:	57                   	push   %edi
+  802be3:	56                   	push   %esi
+  802be4:	53                   	push   %ebx
+  802be5:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802be8:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802beb:	50                   	push   %eax
+  802bec:	ff 75 08             	push   0x8(%ebp)
+  802bef:	e8 6f fe ff ff       	call   802a63 <fd_lookup>
+  802bf4:	89 c3                	mov    %eax,%ebx
+  802bf6:	83 c4 10             	add    $0x10,%esp
+  802bf9:	85 c0                	test   %eax,%eax
+  802bfb:	78 7f                	js     802c7c <dup+0x9d>
+		return r;
+	close(newfdnum);
+  802bfd:	83 ec 0c             	sub    $0xc,%esp
+  802c00:	ff 75 0c             	push   0xc(%ebp)
+  802c03:	e8 85 ff ff ff       	call   802b8d <close>
+
+	newfd = INDEX2FD(newfdnum);
+  802c08:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802c0b:	c1 e6 0c             	shl    $0xc,%esi
+  802c0e:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  802c14:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802c17:	89 3c 24             	mov    %edi,(%esp)
+  802c1a:	e8 d7 fd ff ff       	call   8029f6 <fd2data>
+  802c1f:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  802c21:	89 34 24             	mov    %esi,(%esp)
+  802c24:	e8 cd fd ff ff       	call   8029f6 <fd2data>
+  802c29:	83 c4 10             	add    $0x10,%esp
+  802c2c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  802c2f:	89 d8                	mov    %ebx,%eax
+  802c31:	c1 e8 16             	shr    $0x16,%eax
+  802c34:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802c3b:	a8 01                	test   $0x1,%al
+  802c3d:	74 11                	je     802c50 <dup+0x71>
+  802c3f:	89 d8                	mov    %ebx,%eax
+  802c41:	c1 e8 0c             	shr    $0xc,%eax
+  802c44:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802c4b:	f6 c2 01             	test   $0x1,%dl
+  802c4e:	75 36                	jne    802c86 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  802c50:	89 f8                	mov    %edi,%eax
+  802c52:	c1 e8 0c             	shr    $0xc,%eax
+  802c55:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802c5c:	83 ec 0c             	sub    $0xc,%esp
+  802c5f:	25 07 0e 00 00       	and    $0xe07,%eax
+  802c64:	50                   	push   %eax
+  802c65:	56                   	push   %esi
+  802c66:	6a 00                	push   $0x0
+  802c68:	57                   	push   %edi
+  802c69:	6a 00                	push   $0x0
+  802c6b:	e8 50 f9 ff ff       	call   8025c0 <sys_page_map>
+  802c70:	89 c3                	mov    %eax,%ebx
+  802c72:	83 c4 20             	add    $0x20,%esp
+  802c75:	85 c0                	test   %eax,%eax
+  802c77:	78 33                	js     802cac <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  802c79:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  802c7c:	89 d8                	mov    %ebx,%eax
+  802c7e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c81:	5b                   	pop    %ebx
+  802c82:	5e                   	pop    %esi
+  802c83:	5f                   	pop    %edi
+  802c84:	5d                   	pop    %ebp
+  802c85:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  802c86:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802c8d:	83 ec 0c             	sub    $0xc,%esp
+  802c90:	25 07 0e 00 00       	and    $0xe07,%eax
+  802c95:	50                   	push   %eax
+  802c96:	ff 75 d4             	push   -0x2c(%ebp)
+  802c99:	6a 00                	push   $0x0
+  802c9b:	53                   	push   %ebx
+  802c9c:	6a 00                	push   $0x0
+  802c9e:	e8 1d f9 ff ff       	call   8025c0 <sys_page_map>
+  802ca3:	89 c3                	mov    %eax,%ebx
+  802ca5:	83 c4 20             	add    $0x20,%esp
+  802ca8:	85 c0                	test   %eax,%eax
+  802caa:	79 a4                	jns    802c50 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  802cac:	83 ec 08             	sub    $0x8,%esp
+  802caf:	56                   	push   %esi
+  802cb0:	6a 00                	push   $0x0
+  802cb2:	e8 4b f9 ff ff       	call   802602 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  802cb7:	83 c4 08             	add    $0x8,%esp
+  802cba:	ff 75 d4             	push   -0x2c(%ebp)
+  802cbd:	6a 00                	push   $0x0
+  802cbf:	e8 3e f9 ff ff       	call   802602 <sys_page_unmap>
+	return r;
+  802cc4:	83 c4 10             	add    $0x10,%esp
+  802cc7:	eb b3                	jmp    802c7c <dup+0x9d>
+
+00802cc9 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  802cc9:	55                   	push   %ebp
+  802cca:	89 e5                	mov    %esp,%ebp
+  802ccc:	56                   	push   %esi
+  802ccd:	53                   	push   %ebx
+  802cce:	83 ec 18             	sub    $0x18,%esp
+  802cd1:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802cd4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802cd7:	50                   	push   %eax
+  802cd8:	56                   	push   %esi
+  802cd9:	e8 85 fd ff ff       	call   802a63 <fd_lookup>
+  802cde:	83 c4 10             	add    $0x10,%esp
+  802ce1:	85 c0                	test   %eax,%eax
+  802ce3:	78 3c                	js     802d21 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802ce5:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  802ce8:	83 ec 08             	sub    $0x8,%esp
+  802ceb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802cee:	50                   	push   %eax
+  802cef:	ff 33                	push   (%ebx)
+  802cf1:	e8 bd fd ff ff       	call   802ab3 <dev_lookup>
+  802cf6:	83 c4 10             	add    $0x10,%esp
+  802cf9:	85 c0                	test   %eax,%eax
+  802cfb:	78 24                	js     802d21 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802cfd:	8b 43 08             	mov    0x8(%ebx),%eax
+  802d00:	83 e0 03             	and    $0x3,%eax
+  802d03:	83 f8 01             	cmp    $0x1,%eax
+  802d06:	74 20                	je     802d28 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  802d08:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d0b:	8b 40 08             	mov    0x8(%eax),%eax
+  802d0e:	85 c0                	test   %eax,%eax
+  802d10:	74 37                	je     802d49 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  802d12:	83 ec 04             	sub    $0x4,%esp
+  802d15:	ff 75 10             	push   0x10(%ebp)
+  802d18:	ff 75 0c             	push   0xc(%ebp)
+  802d1b:	53                   	push   %ebx
+  802d1c:	ff d0                	call   *%eax
+  802d1e:	83 c4 10             	add    $0x10,%esp
+}
+  802d21:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d24:	5b                   	pop    %ebx
+  802d25:	5e                   	pop    %esi
+  802d26:	5d                   	pop    %ebp
+  802d27:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802d28:	a1 10 a0 80 00       	mov    0x80a010,%eax
+  802d2d:	8b 40 48             	mov    0x48(%eax),%eax
+  802d30:	83 ec 04             	sub    $0x4,%esp
+  802d33:	56                   	push   %esi
+  802d34:	50                   	push   %eax
+  802d35:	68 e1 49 80 00       	push   $0x8049e1
+  802d3a:	e8 99 ee ff ff       	call   801bd8 <cprintf>
+		return -E_INVAL;
+  802d3f:	83 c4 10             	add    $0x10,%esp
+  802d42:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d47:	eb d8                	jmp    802d21 <read+0x58>
+		return -E_NOT_SUPP;
+  802d49:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802d4e:	eb d1                	jmp    802d21 <read+0x58>
+
+00802d50 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  802d50:	55                   	push   %ebp
+  802d51:	89 e5                	mov    %esp,%ebp
+  802d53:	57                   	push   %edi
+  802d54:	56                   	push   %esi
+  802d55:	53                   	push   %ebx
+  802d56:	83 ec 0c             	sub    $0xc,%esp
+  802d59:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802d5c:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  802d5f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d64:	eb 02                	jmp    802d68 <readn+0x18>
+  802d66:	01 c3                	add    %eax,%ebx
+  802d68:	39 f3                	cmp    %esi,%ebx
+  802d6a:	73 21                	jae    802d8d <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  802d6c:	83 ec 04             	sub    $0x4,%esp
+  802d6f:	89 f0                	mov    %esi,%eax
+  802d71:	29 d8                	sub    %ebx,%eax
+  802d73:	50                   	push   %eax
+  802d74:	89 d8                	mov    %ebx,%eax
+  802d76:	03 45 0c             	add    0xc(%ebp),%eax
+  802d79:	50                   	push   %eax
+  802d7a:	57                   	push   %edi
+  802d7b:	e8 49 ff ff ff       	call   802cc9 <read>
+		if (m < 0)
+  802d80:	83 c4 10             	add    $0x10,%esp
+  802d83:	85 c0                	test   %eax,%eax
+  802d85:	78 04                	js     802d8b <readn+0x3b>
+			return m;
+		if (m == 0)
+  802d87:	75 dd                	jne    802d66 <readn+0x16>
+  802d89:	eb 02                	jmp    802d8d <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  802d8b:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  802d8d:	89 d8                	mov    %ebx,%eax
+  802d8f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d92:	5b                   	pop    %ebx
+  802d93:	5e                   	pop    %esi
+  802d94:	5f                   	pop    %edi
+  802d95:	5d                   	pop    %ebp
+  802d96:	c3                   	ret
+
+00802d97 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  802d97:	55                   	push   %ebp
+  802d98:	89 e5                	mov    %esp,%ebp
+  802d9a:	56                   	push   %esi
+  802d9b:	53                   	push   %ebx
+  802d9c:	83 ec 18             	sub    $0x18,%esp
+  802d9f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802da2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802da5:	50                   	push   %eax
+  802da6:	53                   	push   %ebx
+  802da7:	e8 b7 fc ff ff       	call   802a63 <fd_lookup>
+  802dac:	83 c4 10             	add    $0x10,%esp
+  802daf:	85 c0                	test   %eax,%eax
+  802db1:	78 37                	js     802dea <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802db3:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802db6:	83 ec 08             	sub    $0x8,%esp
+  802db9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802dbc:	50                   	push   %eax
+  802dbd:	ff 36                	push   (%esi)
+  802dbf:	e8 ef fc ff ff       	call   802ab3 <dev_lookup>
+  802dc4:	83 c4 10             	add    $0x10,%esp
+  802dc7:	85 c0                	test   %eax,%eax
+  802dc9:	78 1f                	js     802dea <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802dcb:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802dcf:	74 20                	je     802df1 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  802dd1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802dd4:	8b 40 0c             	mov    0xc(%eax),%eax
+  802dd7:	85 c0                	test   %eax,%eax
+  802dd9:	74 37                	je     802e12 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  802ddb:	83 ec 04             	sub    $0x4,%esp
+  802dde:	ff 75 10             	push   0x10(%ebp)
+  802de1:	ff 75 0c             	push   0xc(%ebp)
+  802de4:	56                   	push   %esi
+  802de5:	ff d0                	call   *%eax
+  802de7:	83 c4 10             	add    $0x10,%esp
+}
+  802dea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ded:	5b                   	pop    %ebx
+  802dee:	5e                   	pop    %esi
+  802def:	5d                   	pop    %ebp
+  802df0:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802df1:	a1 10 a0 80 00       	mov    0x80a010,%eax
+  802df6:	8b 40 48             	mov    0x48(%eax),%eax
+  802df9:	83 ec 04             	sub    $0x4,%esp
+  802dfc:	53                   	push   %ebx
+  802dfd:	50                   	push   %eax
+  802dfe:	68 fd 49 80 00       	push   $0x8049fd
+  802e03:	e8 d0 ed ff ff       	call   801bd8 <cprintf>
+		return -E_INVAL;
+  802e08:	83 c4 10             	add    $0x10,%esp
+  802e0b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e10:	eb d8                	jmp    802dea <write+0x53>
+		return -E_NOT_SUPP;
+  802e12:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802e17:	eb d1                	jmp    802dea <write+0x53>
+
+00802e19 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  802e19:	55                   	push   %ebp
+  802e1a:	89 e5                	mov    %esp,%ebp
+  802e1c:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802e1f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802e22:	50                   	push   %eax
+  802e23:	ff 75 08             	push   0x8(%ebp)
+  802e26:	e8 38 fc ff ff       	call   802a63 <fd_lookup>
+  802e2b:	83 c4 10             	add    $0x10,%esp
+  802e2e:	85 c0                	test   %eax,%eax
+  802e30:	78 0e                	js     802e40 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  802e32:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802e35:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e38:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  802e3b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e40:	c9                   	leave
+  802e41:	c3                   	ret
+
+00802e42 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  802e42:	55                   	push   %ebp
+  802e43:	89 e5                	mov    %esp,%ebp
+  802e45:	56                   	push   %esi
+  802e46:	53                   	push   %ebx
+  802e47:	83 ec 18             	sub    $0x18,%esp
+  802e4a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802e4d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802e50:	50                   	push   %eax
+  802e51:	53                   	push   %ebx
+  802e52:	e8 0c fc ff ff       	call   802a63 <fd_lookup>
+  802e57:	83 c4 10             	add    $0x10,%esp
+  802e5a:	85 c0                	test   %eax,%eax
+  802e5c:	78 34                	js     802e92 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802e5e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802e61:	83 ec 08             	sub    $0x8,%esp
+  802e64:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802e67:	50                   	push   %eax
+  802e68:	ff 36                	push   (%esi)
+  802e6a:	e8 44 fc ff ff       	call   802ab3 <dev_lookup>
+  802e6f:	83 c4 10             	add    $0x10,%esp
+  802e72:	85 c0                	test   %eax,%eax
+  802e74:	78 1c                	js     802e92 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802e76:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802e7a:	74 1d                	je     802e99 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  802e7c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e7f:	8b 40 18             	mov    0x18(%eax),%eax
+  802e82:	85 c0                	test   %eax,%eax
+  802e84:	74 34                	je     802eba <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  802e86:	83 ec 08             	sub    $0x8,%esp
+  802e89:	ff 75 0c             	push   0xc(%ebp)
+  802e8c:	56                   	push   %esi
+  802e8d:	ff d0                	call   *%eax
+  802e8f:	83 c4 10             	add    $0x10,%esp
+}
+  802e92:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e95:	5b                   	pop    %ebx
+  802e96:	5e                   	pop    %esi
+  802e97:	5d                   	pop    %ebp
+  802e98:	c3                   	ret
+			thisenv->env_id, fdnum);
+  802e99:	a1 10 a0 80 00       	mov    0x80a010,%eax
+  802e9e:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802ea1:	83 ec 04             	sub    $0x4,%esp
+  802ea4:	53                   	push   %ebx
+  802ea5:	50                   	push   %eax
+  802ea6:	68 c0 49 80 00       	push   $0x8049c0
+  802eab:	e8 28 ed ff ff       	call   801bd8 <cprintf>
+		return -E_INVAL;
+  802eb0:	83 c4 10             	add    $0x10,%esp
+  802eb3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802eb8:	eb d8                	jmp    802e92 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  802eba:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802ebf:	eb d1                	jmp    802e92 <ftruncate+0x50>
+
+00802ec1 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  802ec1:	55                   	push   %ebp
+  802ec2:	89 e5                	mov    %esp,%ebp
+  802ec4:	56                   	push   %esi
+  802ec5:	53                   	push   %ebx
+  802ec6:	83 ec 18             	sub    $0x18,%esp
+  802ec9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802ecc:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802ecf:	50                   	push   %eax
+  802ed0:	ff 75 08             	push   0x8(%ebp)
+  802ed3:	e8 8b fb ff ff       	call   802a63 <fd_lookup>
+  802ed8:	83 c4 10             	add    $0x10,%esp
+  802edb:	85 c0                	test   %eax,%eax
+  802edd:	78 49                	js     802f28 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802edf:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802ee2:	83 ec 08             	sub    $0x8,%esp
+  802ee5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802ee8:	50                   	push   %eax
+  802ee9:	ff 36                	push   (%esi)
+  802eeb:	e8 c3 fb ff ff       	call   802ab3 <dev_lookup>
+  802ef0:	83 c4 10             	add    $0x10,%esp
+  802ef3:	85 c0                	test   %eax,%eax
+  802ef5:	78 31                	js     802f28 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  802ef7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802efa:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  802efe:	74 2f                	je     802f2f <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  802f00:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  802f03:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  802f0a:	00 00 00 
+	stat->st_isdir = 0;
+  802f0d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802f14:	00 00 00 
+	stat->st_dev = dev;
+  802f17:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  802f1d:	83 ec 08             	sub    $0x8,%esp
+  802f20:	53                   	push   %ebx
+  802f21:	56                   	push   %esi
+  802f22:	ff 50 14             	call   *0x14(%eax)
+  802f25:	83 c4 10             	add    $0x10,%esp
+}
+  802f28:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f2b:	5b                   	pop    %ebx
+  802f2c:	5e                   	pop    %esi
+  802f2d:	5d                   	pop    %ebp
+  802f2e:	c3                   	ret
+		return -E_NOT_SUPP;
+  802f2f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802f34:	eb f2                	jmp    802f28 <fstat+0x67>
+
+00802f36 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  802f36:	55                   	push   %ebp
+  802f37:	89 e5                	mov    %esp,%ebp
+  802f39:	56                   	push   %esi
+  802f3a:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  802f3b:	83 ec 08             	sub    $0x8,%esp
+  802f3e:	6a 00                	push   $0x0
+  802f40:	ff 75 08             	push   0x8(%ebp)
+  802f43:	e8 e4 01 00 00       	call   80312c <open>
+  802f48:	89 c3                	mov    %eax,%ebx
+  802f4a:	83 c4 10             	add    $0x10,%esp
+  802f4d:	85 c0                	test   %eax,%eax
+  802f4f:	78 1b                	js     802f6c <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  802f51:	83 ec 08             	sub    $0x8,%esp
+  802f54:	ff 75 0c             	push   0xc(%ebp)
+  802f57:	50                   	push   %eax
+  802f58:	e8 64 ff ff ff       	call   802ec1 <fstat>
+  802f5d:	89 c6                	mov    %eax,%esi
+	close(fd);
+  802f5f:	89 1c 24             	mov    %ebx,(%esp)
+  802f62:	e8 26 fc ff ff       	call   802b8d <close>
+	return r;
+  802f67:	83 c4 10             	add    $0x10,%esp
+  802f6a:	89 f3                	mov    %esi,%ebx
+}
+  802f6c:	89 d8                	mov    %ebx,%eax
+  802f6e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f71:	5b                   	pop    %ebx
+  802f72:	5e                   	pop    %esi
+  802f73:	5d                   	pop    %ebp
+  802f74:	c3                   	ret
+
+00802f75 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  802f75:	55                   	push   %ebp
+  802f76:	89 e5                	mov    %esp,%ebp
+  802f78:	56                   	push   %esi
+  802f79:	53                   	push   %ebx
+  802f7a:	89 c6                	mov    %eax,%esi
+  802f7c:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  802f7e:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  802f85:	74 27                	je     802fae <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802f87:	6a 07                	push   $0x7
+  802f89:	68 00 b0 80 00       	push   $0x80b000
+  802f8e:	56                   	push   %esi
+  802f8f:	ff 35 00 a0 80 00    	push   0x80a000
+  802f95:	e8 b9 f9 ff ff       	call   802953 <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  802f9a:	83 c4 0c             	add    $0xc,%esp
+  802f9d:	6a 00                	push   $0x0
+  802f9f:	53                   	push   %ebx
+  802fa0:	6a 00                	push   $0x0
+  802fa2:	e8 38 f9 ff ff       	call   8028df <ipc_recv>
+}
+  802fa7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802faa:	5b                   	pop    %ebx
+  802fab:	5e                   	pop    %esi
+  802fac:	5d                   	pop    %ebp
+  802fad:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  802fae:	83 ec 0c             	sub    $0xc,%esp
+  802fb1:	6a 01                	push   $0x1
+  802fb3:	e8 ef f9 ff ff       	call   8029a7 <ipc_find_env>
+  802fb8:	a3 00 a0 80 00       	mov    %eax,0x80a000
+  802fbd:	83 c4 10             	add    $0x10,%esp
+  802fc0:	eb c5                	jmp    802f87 <fsipc+0x12>
+
+00802fc2 <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802fc2:	55                   	push   %ebp
+  802fc3:	89 e5                	mov    %esp,%ebp
+  802fc5:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802fc8:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fcb:	8b 40 0c             	mov    0xc(%eax),%eax
+  802fce:	a3 00 b0 80 00       	mov    %eax,0x80b000
+  fsipcbuf.set_size.req_size = newsize;
+  802fd3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802fd6:	a3 04 b0 80 00       	mov    %eax,0x80b004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  802fdb:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fe0:	b8 02 00 00 00       	mov    $0x2,%eax
+  802fe5:	e8 8b ff ff ff       	call   802f75 <fsipc>
+}
+  802fea:	c9                   	leave
+  802feb:	c3                   	ret
+
+00802fec <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802fec:	55                   	push   %ebp
+  802fed:	89 e5                	mov    %esp,%ebp
+  802fef:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802ff2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ff5:	8b 40 0c             	mov    0xc(%eax),%eax
+  802ff8:	a3 00 b0 80 00       	mov    %eax,0x80b000
+  return fsipc(FSREQ_FLUSH, NULL);
+  802ffd:	ba 00 00 00 00       	mov    $0x0,%edx
+  803002:	b8 06 00 00 00       	mov    $0x6,%eax
+  803007:	e8 69 ff ff ff       	call   802f75 <fsipc>
+}
+  80300c:	c9                   	leave
+  80300d:	c3                   	ret
+
+0080300e <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80300e:	55                   	push   %ebp
+  80300f:	89 e5                	mov    %esp,%ebp
+  803011:	53                   	push   %ebx
+  803012:	83 ec 04             	sub    $0x4,%esp
+  803015:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803018:	8b 45 08             	mov    0x8(%ebp),%eax
+  80301b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80301e:	a3 00 b0 80 00       	mov    %eax,0x80b000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  803023:	ba 00 00 00 00       	mov    $0x0,%edx
+  803028:	b8 05 00 00 00       	mov    $0x5,%eax
+  80302d:	e8 43 ff ff ff       	call   802f75 <fsipc>
+  803032:	85 c0                	test   %eax,%eax
+  803034:	78 2c                	js     803062 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803036:	83 ec 08             	sub    $0x8,%esp
+  803039:	68 00 b0 80 00       	push   $0x80b000
+  80303e:	53                   	push   %ebx
+  80303f:	e8 4d f1 ff ff       	call   802191 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  803044:	a1 80 b0 80 00       	mov    0x80b080,%eax
+  803049:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80304f:	a1 84 b0 80 00       	mov    0x80b084,%eax
+  803054:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  80305a:	83 c4 10             	add    $0x10,%esp
+  80305d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803062:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803065:	c9                   	leave
+  803066:	c3                   	ret
+
+00803067 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803067:	55                   	push   %ebp
+  803068:	89 e5                	mov    %esp,%ebp
+  80306a:	83 ec 0c             	sub    $0xc,%esp
+  80306d:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803070:	8b 55 08             	mov    0x8(%ebp),%edx
+  803073:	8b 52 0c             	mov    0xc(%edx),%edx
+  803076:	89 15 00 b0 80 00    	mov    %edx,0x80b000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80307c:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  803081:	39 d0                	cmp    %edx,%eax
+  803083:	0f 47 c2             	cmova  %edx,%eax
+  803086:	a3 04 b0 80 00       	mov    %eax,0x80b004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  80308b:	50                   	push   %eax
+  80308c:	ff 75 0c             	push   0xc(%ebp)
+  80308f:	68 08 b0 80 00       	push   $0x80b008
+  803094:	e8 7e f2 ff ff       	call   802317 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  803099:	ba 00 00 00 00       	mov    $0x0,%edx
+  80309e:	b8 04 00 00 00       	mov    $0x4,%eax
+  8030a3:	e8 cd fe ff ff       	call   802f75 <fsipc>
+}
+  8030a8:	c9                   	leave
+  8030a9:	c3                   	ret
+
+008030aa <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8030aa:	55                   	push   %ebp
+  8030ab:	89 e5                	mov    %esp,%ebp
+  8030ad:	56                   	push   %esi
+  8030ae:	53                   	push   %ebx
+  8030af:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8030b2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030b5:	8b 40 0c             	mov    0xc(%eax),%eax
+  8030b8:	a3 00 b0 80 00       	mov    %eax,0x80b000
+  fsipcbuf.read.req_n = n;
+  8030bd:	89 35 04 b0 80 00    	mov    %esi,0x80b004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8030c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030c8:	b8 03 00 00 00       	mov    $0x3,%eax
+  8030cd:	e8 a3 fe ff ff       	call   802f75 <fsipc>
+  8030d2:	89 c3                	mov    %eax,%ebx
+  8030d4:	85 c0                	test   %eax,%eax
+  8030d6:	78 1f                	js     8030f7 <devfile_read+0x4d>
+  assert(r <= n);
+  8030d8:	39 c6                	cmp    %eax,%esi
+  8030da:	72 24                	jb     803100 <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  8030dc:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8030e1:	7f 33                	jg     803116 <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8030e3:	83 ec 04             	sub    $0x4,%esp
+  8030e6:	50                   	push   %eax
+  8030e7:	68 00 b0 80 00       	push   $0x80b000
+  8030ec:	ff 75 0c             	push   0xc(%ebp)
+  8030ef:	e8 23 f2 ff ff       	call   802317 <memmove>
+  return r;
+  8030f4:	83 c4 10             	add    $0x10,%esp
+}
+  8030f7:	89 d8                	mov    %ebx,%eax
+  8030f9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8030fc:	5b                   	pop    %ebx
+  8030fd:	5e                   	pop    %esi
+  8030fe:	5d                   	pop    %ebp
+  8030ff:	c3                   	ret
+  assert(r <= n);
+  803100:	68 30 4a 80 00       	push   $0x804a30
+  803105:	68 1d 40 80 00       	push   $0x80401d
+  80310a:	6a 78                	push   $0x78
+  80310c:	68 37 4a 80 00       	push   $0x804a37
+  803111:	e8 e7 e9 ff ff       	call   801afd <_panic>
+  assert(r <= PGSIZE);
+  803116:	68 42 4a 80 00       	push   $0x804a42
+  80311b:	68 1d 40 80 00       	push   $0x80401d
+  803120:	6a 79                	push   $0x79
+  803122:	68 37 4a 80 00       	push   $0x804a37
+  803127:	e8 d1 e9 ff ff       	call   801afd <_panic>
+
+0080312c <open>:
+open(const char *path, int mode) {
+  80312c:	55                   	push   %ebp
+  80312d:	89 e5                	mov    %esp,%ebp
+  80312f:	56                   	push   %esi
+  803130:	53                   	push   %ebx
+  803131:	83 ec 1c             	sub    $0x1c,%esp
+  803134:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  803137:	56                   	push   %esi
+  803138:	e8 19 f0 ff ff       	call   802156 <strlen>
+  80313d:	83 c4 10             	add    $0x10,%esp
+  803140:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803145:	7f 6c                	jg     8031b3 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  803147:	83 ec 0c             	sub    $0xc,%esp
+  80314a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80314d:	50                   	push   %eax
+  80314e:	e8 ba f8 ff ff       	call   802a0d <fd_alloc>
+  803153:	89 c3                	mov    %eax,%ebx
+  803155:	83 c4 10             	add    $0x10,%esp
+  803158:	85 c0                	test   %eax,%eax
+  80315a:	78 3c                	js     803198 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  80315c:	83 ec 08             	sub    $0x8,%esp
+  80315f:	56                   	push   %esi
+  803160:	68 00 b0 80 00       	push   $0x80b000
+  803165:	e8 27 f0 ff ff       	call   802191 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  80316a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80316d:	a3 00 b4 80 00       	mov    %eax,0x80b400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803172:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803175:	b8 01 00 00 00       	mov    $0x1,%eax
+  80317a:	e8 f6 fd ff ff       	call   802f75 <fsipc>
+  80317f:	89 c3                	mov    %eax,%ebx
+  803181:	83 c4 10             	add    $0x10,%esp
+  803184:	85 c0                	test   %eax,%eax
+  803186:	78 19                	js     8031a1 <open+0x75>
+  return fd2num(fd);
+  803188:	83 ec 0c             	sub    $0xc,%esp
+  80318b:	ff 75 f4             	push   -0xc(%ebp)
+  80318e:	e8 53 f8 ff ff       	call   8029e6 <fd2num>
+  803193:	89 c3                	mov    %eax,%ebx
+  803195:	83 c4 10             	add    $0x10,%esp
+}
+  803198:	89 d8                	mov    %ebx,%eax
+  80319a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80319d:	5b                   	pop    %ebx
+  80319e:	5e                   	pop    %esi
+  80319f:	5d                   	pop    %ebp
+  8031a0:	c3                   	ret
+    fd_close(fd, 0);
+  8031a1:	83 ec 08             	sub    $0x8,%esp
+  8031a4:	6a 00                	push   $0x0
+  8031a6:	ff 75 f4             	push   -0xc(%ebp)
+  8031a9:	e8 58 f9 ff ff       	call   802b06 <fd_close>
+    return r;
+  8031ae:	83 c4 10             	add    $0x10,%esp
+  8031b1:	eb e5                	jmp    803198 <open+0x6c>
+    return -E_BAD_PATH;
+  8031b3:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8031b8:	eb de                	jmp    803198 <open+0x6c>
+
+008031ba <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  8031ba:	55                   	push   %ebp
+  8031bb:	89 e5                	mov    %esp,%ebp
+  8031bd:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  8031c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031c5:	b8 08 00 00 00       	mov    $0x8,%eax
+  8031ca:	e8 a6 fd ff ff       	call   802f75 <fsipc>
+}
+  8031cf:	c9                   	leave
+  8031d0:	c3                   	ret
+
+008031d1 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8031d1:	55                   	push   %ebp
+  8031d2:	89 e5                	mov    %esp,%ebp
+  8031d4:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8031d7:	89 c2                	mov    %eax,%edx
+  8031d9:	c1 ea 16             	shr    $0x16,%edx
+  8031dc:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8031e3:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8031e8:	f6 c1 01             	test   $0x1,%cl
+  8031eb:	74 1c                	je     803209 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  8031ed:	c1 e8 0c             	shr    $0xc,%eax
+  8031f0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8031f7:	a8 01                	test   $0x1,%al
+  8031f9:	74 0e                	je     803209 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8031fb:	c1 e8 0c             	shr    $0xc,%eax
+  8031fe:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  803205:	ef 
+  803206:	0f b7 d2             	movzwl %dx,%edx
+}
+  803209:	89 d0                	mov    %edx,%eax
+  80320b:	5d                   	pop    %ebp
+  80320c:	c3                   	ret
+
+0080320d <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80320d:	55                   	push   %ebp
+  80320e:	89 e5                	mov    %esp,%ebp
+  803210:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  803213:	68 4e 4a 80 00       	push   $0x804a4e
+  803218:	ff 75 0c             	push   0xc(%ebp)
+  80321b:	e8 71 ef ff ff       	call   802191 <strcpy>
+	return 0;
+}
+  803220:	b8 00 00 00 00       	mov    $0x0,%eax
+  803225:	c9                   	leave
+  803226:	c3                   	ret
+
+00803227 <devsock_close>:
+{
+  803227:	55                   	push   %ebp
+  803228:	89 e5                	mov    %esp,%ebp
+  80322a:	53                   	push   %ebx
+  80322b:	83 ec 10             	sub    $0x10,%esp
+  80322e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  803231:	53                   	push   %ebx
+  803232:	e8 9a ff ff ff       	call   8031d1 <pageref>
+  803237:	89 c2                	mov    %eax,%edx
+  803239:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80323c:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  803241:	83 fa 01             	cmp    $0x1,%edx
+  803244:	74 05                	je     80324b <devsock_close+0x24>
+}
+  803246:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803249:	c9                   	leave
+  80324a:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  80324b:	83 ec 0c             	sub    $0xc,%esp
+  80324e:	ff 73 0c             	push   0xc(%ebx)
+  803251:	e8 b7 02 00 00       	call   80350d <nsipc_close>
+  803256:	83 c4 10             	add    $0x10,%esp
+  803259:	eb eb                	jmp    803246 <devsock_close+0x1f>
+
+0080325b <devsock_write>:
+{
+  80325b:	55                   	push   %ebp
+  80325c:	89 e5                	mov    %esp,%ebp
+  80325e:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  803261:	6a 00                	push   $0x0
+  803263:	ff 75 10             	push   0x10(%ebp)
+  803266:	ff 75 0c             	push   0xc(%ebp)
+  803269:	8b 45 08             	mov    0x8(%ebp),%eax
+  80326c:	ff 70 0c             	push   0xc(%eax)
+  80326f:	e8 79 03 00 00       	call   8035ed <nsipc_send>
+}
+  803274:	c9                   	leave
+  803275:	c3                   	ret
+
+00803276 <devsock_read>:
+{
+  803276:	55                   	push   %ebp
+  803277:	89 e5                	mov    %esp,%ebp
+  803279:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  80327c:	6a 00                	push   $0x0
+  80327e:	ff 75 10             	push   0x10(%ebp)
+  803281:	ff 75 0c             	push   0xc(%ebp)
+  803284:	8b 45 08             	mov    0x8(%ebp),%eax
+  803287:	ff 70 0c             	push   0xc(%eax)
+  80328a:	e8 ef 02 00 00       	call   80357e <nsipc_recv>
+}
+  80328f:	c9                   	leave
+  803290:	c3                   	ret
+
+00803291 <fd2sockid>:
+{
+  803291:	55                   	push   %ebp
+  803292:	89 e5                	mov    %esp,%ebp
+  803294:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  803297:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80329a:	52                   	push   %edx
+  80329b:	50                   	push   %eax
+  80329c:	e8 c2 f7 ff ff       	call   802a63 <fd_lookup>
+  8032a1:	83 c4 10             	add    $0x10,%esp
+  8032a4:	85 c0                	test   %eax,%eax
+  8032a6:	78 10                	js     8032b8 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8032a8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8032ab:	8b 0d 80 90 80 00    	mov    0x809080,%ecx
+  8032b1:	39 08                	cmp    %ecx,(%eax)
+  8032b3:	75 05                	jne    8032ba <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8032b5:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8032b8:	c9                   	leave
+  8032b9:	c3                   	ret
+		return -E_NOT_SUPP;
+  8032ba:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8032bf:	eb f7                	jmp    8032b8 <fd2sockid+0x27>
+
+008032c1 <alloc_sockfd>:
+{
+  8032c1:	55                   	push   %ebp
+  8032c2:	89 e5                	mov    %esp,%ebp
+  8032c4:	56                   	push   %esi
+  8032c5:	53                   	push   %ebx
+  8032c6:	83 ec 1c             	sub    $0x1c,%esp
+  8032c9:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8032cb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8032ce:	50                   	push   %eax
+  8032cf:	e8 39 f7 ff ff       	call   802a0d <fd_alloc>
+  8032d4:	89 c3                	mov    %eax,%ebx
+  8032d6:	83 c4 10             	add    $0x10,%esp
+  8032d9:	85 c0                	test   %eax,%eax
+  8032db:	78 43                	js     803320 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8032dd:	83 ec 04             	sub    $0x4,%esp
+  8032e0:	68 07 04 00 00       	push   $0x407
+  8032e5:	ff 75 f4             	push   -0xc(%ebp)
+  8032e8:	6a 00                	push   $0x0
+  8032ea:	e8 8e f2 ff ff       	call   80257d <sys_page_alloc>
+  8032ef:	89 c3                	mov    %eax,%ebx
+  8032f1:	83 c4 10             	add    $0x10,%esp
+  8032f4:	85 c0                	test   %eax,%eax
+  8032f6:	78 28                	js     803320 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8032f8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8032fb:	8b 15 80 90 80 00    	mov    0x809080,%edx
+  803301:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  803303:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803306:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  80330d:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  803310:	83 ec 0c             	sub    $0xc,%esp
+  803313:	50                   	push   %eax
+  803314:	e8 cd f6 ff ff       	call   8029e6 <fd2num>
+  803319:	89 c3                	mov    %eax,%ebx
+  80331b:	83 c4 10             	add    $0x10,%esp
+  80331e:	eb 0c                	jmp    80332c <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  803320:	83 ec 0c             	sub    $0xc,%esp
+  803323:	56                   	push   %esi
+  803324:	e8 e4 01 00 00       	call   80350d <nsipc_close>
+		return r;
+  803329:	83 c4 10             	add    $0x10,%esp
+}
+  80332c:	89 d8                	mov    %ebx,%eax
+  80332e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803331:	5b                   	pop    %ebx
+  803332:	5e                   	pop    %esi
+  803333:	5d                   	pop    %ebp
+  803334:	c3                   	ret
+
+00803335 <accept>:
+{
+  803335:	55                   	push   %ebp
+  803336:	89 e5                	mov    %esp,%ebp
+  803338:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80333b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80333e:	e8 4e ff ff ff       	call   803291 <fd2sockid>
+  803343:	85 c0                	test   %eax,%eax
+  803345:	78 1b                	js     803362 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  803347:	83 ec 04             	sub    $0x4,%esp
+  80334a:	ff 75 10             	push   0x10(%ebp)
+  80334d:	ff 75 0c             	push   0xc(%ebp)
+  803350:	50                   	push   %eax
+  803351:	e8 0e 01 00 00       	call   803464 <nsipc_accept>
+  803356:	83 c4 10             	add    $0x10,%esp
+  803359:	85 c0                	test   %eax,%eax
+  80335b:	78 05                	js     803362 <accept+0x2d>
+	return alloc_sockfd(r);
+  80335d:	e8 5f ff ff ff       	call   8032c1 <alloc_sockfd>
+}
+  803362:	c9                   	leave
+  803363:	c3                   	ret
+
+00803364 <bind>:
+{
+  803364:	55                   	push   %ebp
+  803365:	89 e5                	mov    %esp,%ebp
+  803367:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80336a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80336d:	e8 1f ff ff ff       	call   803291 <fd2sockid>
+  803372:	85 c0                	test   %eax,%eax
+  803374:	78 12                	js     803388 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  803376:	83 ec 04             	sub    $0x4,%esp
+  803379:	ff 75 10             	push   0x10(%ebp)
+  80337c:	ff 75 0c             	push   0xc(%ebp)
+  80337f:	50                   	push   %eax
+  803380:	e8 31 01 00 00       	call   8034b6 <nsipc_bind>
+  803385:	83 c4 10             	add    $0x10,%esp
+}
+  803388:	c9                   	leave
+  803389:	c3                   	ret
+
+0080338a <shutdown>:
+{
+  80338a:	55                   	push   %ebp
+  80338b:	89 e5                	mov    %esp,%ebp
+  80338d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803390:	8b 45 08             	mov    0x8(%ebp),%eax
+  803393:	e8 f9 fe ff ff       	call   803291 <fd2sockid>
+  803398:	85 c0                	test   %eax,%eax
+  80339a:	78 0f                	js     8033ab <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  80339c:	83 ec 08             	sub    $0x8,%esp
+  80339f:	ff 75 0c             	push   0xc(%ebp)
+  8033a2:	50                   	push   %eax
+  8033a3:	e8 43 01 00 00       	call   8034eb <nsipc_shutdown>
+  8033a8:	83 c4 10             	add    $0x10,%esp
+}
+  8033ab:	c9                   	leave
+  8033ac:	c3                   	ret
+
+008033ad <connect>:
+{
+  8033ad:	55                   	push   %ebp
+  8033ae:	89 e5                	mov    %esp,%ebp
+  8033b0:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8033b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033b6:	e8 d6 fe ff ff       	call   803291 <fd2sockid>
+  8033bb:	85 c0                	test   %eax,%eax
+  8033bd:	78 12                	js     8033d1 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8033bf:	83 ec 04             	sub    $0x4,%esp
+  8033c2:	ff 75 10             	push   0x10(%ebp)
+  8033c5:	ff 75 0c             	push   0xc(%ebp)
+  8033c8:	50                   	push   %eax
+  8033c9:	e8 59 01 00 00       	call   803527 <nsipc_connect>
+  8033ce:	83 c4 10             	add    $0x10,%esp
+}
+  8033d1:	c9                   	leave
+  8033d2:	c3                   	ret
+
+008033d3 <listen>:
+{
+  8033d3:	55                   	push   %ebp
+  8033d4:	89 e5                	mov    %esp,%ebp
+  8033d6:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8033d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033dc:	e8 b0 fe ff ff       	call   803291 <fd2sockid>
+  8033e1:	85 c0                	test   %eax,%eax
+  8033e3:	78 0f                	js     8033f4 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8033e5:	83 ec 08             	sub    $0x8,%esp
+  8033e8:	ff 75 0c             	push   0xc(%ebp)
+  8033eb:	50                   	push   %eax
+  8033ec:	e8 6b 01 00 00       	call   80355c <nsipc_listen>
+  8033f1:	83 c4 10             	add    $0x10,%esp
+}
+  8033f4:	c9                   	leave
+  8033f5:	c3                   	ret
+
+008033f6 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8033f6:	55                   	push   %ebp
+  8033f7:	89 e5                	mov    %esp,%ebp
+  8033f9:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8033fc:	ff 75 10             	push   0x10(%ebp)
+  8033ff:	ff 75 0c             	push   0xc(%ebp)
+  803402:	ff 75 08             	push   0x8(%ebp)
+  803405:	e8 41 02 00 00       	call   80364b <nsipc_socket>
+  80340a:	83 c4 10             	add    $0x10,%esp
+  80340d:	85 c0                	test   %eax,%eax
+  80340f:	78 05                	js     803416 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  803411:	e8 ab fe ff ff       	call   8032c1 <alloc_sockfd>
+}
+  803416:	c9                   	leave
+  803417:	c3                   	ret
+
+00803418 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  803418:	55                   	push   %ebp
+  803419:	89 e5                	mov    %esp,%ebp
+  80341b:	53                   	push   %ebx
+  80341c:	83 ec 04             	sub    $0x4,%esp
+  80341f:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  803421:	83 3d 04 a0 80 00 00 	cmpl   $0x0,0x80a004
+  803428:	74 26                	je     803450 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  80342a:	6a 07                	push   $0x7
+  80342c:	68 00 c0 80 00       	push   $0x80c000
+  803431:	53                   	push   %ebx
+  803432:	ff 35 04 a0 80 00    	push   0x80a004
+  803438:	e8 16 f5 ff ff       	call   802953 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  80343d:	83 c4 0c             	add    $0xc,%esp
+  803440:	6a 00                	push   $0x0
+  803442:	6a 00                	push   $0x0
+  803444:	6a 00                	push   $0x0
+  803446:	e8 94 f4 ff ff       	call   8028df <ipc_recv>
+}
+  80344b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80344e:	c9                   	leave
+  80344f:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  803450:	83 ec 0c             	sub    $0xc,%esp
+  803453:	6a 02                	push   $0x2
+  803455:	e8 4d f5 ff ff       	call   8029a7 <ipc_find_env>
+  80345a:	a3 04 a0 80 00       	mov    %eax,0x80a004
+  80345f:	83 c4 10             	add    $0x10,%esp
+  803462:	eb c6                	jmp    80342a <nsipc+0x12>
+
+00803464 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  803464:	55                   	push   %ebp
+  803465:	89 e5                	mov    %esp,%ebp
+  803467:	56                   	push   %esi
+  803468:	53                   	push   %ebx
+  803469:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  80346c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80346f:	a3 00 c0 80 00       	mov    %eax,0x80c000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  803474:	8b 06                	mov    (%esi),%eax
+  803476:	a3 04 c0 80 00       	mov    %eax,0x80c004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  80347b:	b8 01 00 00 00       	mov    $0x1,%eax
+  803480:	e8 93 ff ff ff       	call   803418 <nsipc>
+  803485:	89 c3                	mov    %eax,%ebx
+  803487:	85 c0                	test   %eax,%eax
+  803489:	79 09                	jns    803494 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  80348b:	89 d8                	mov    %ebx,%eax
+  80348d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803490:	5b                   	pop    %ebx
+  803491:	5e                   	pop    %esi
+  803492:	5d                   	pop    %ebp
+  803493:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  803494:	83 ec 04             	sub    $0x4,%esp
+  803497:	ff 35 10 c0 80 00    	push   0x80c010
+  80349d:	68 00 c0 80 00       	push   $0x80c000
+  8034a2:	ff 75 0c             	push   0xc(%ebp)
+  8034a5:	e8 6d ee ff ff       	call   802317 <memmove>
+		*addrlen = ret->ret_addrlen;
+  8034aa:	a1 10 c0 80 00       	mov    0x80c010,%eax
+  8034af:	89 06                	mov    %eax,(%esi)
+  8034b1:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8034b4:	eb d5                	jmp    80348b <nsipc_accept+0x27>
+
+008034b6 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8034b6:	55                   	push   %ebp
+  8034b7:	89 e5                	mov    %esp,%ebp
+  8034b9:	53                   	push   %ebx
+  8034ba:	83 ec 08             	sub    $0x8,%esp
+  8034bd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8034c0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034c3:	a3 00 c0 80 00       	mov    %eax,0x80c000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8034c8:	53                   	push   %ebx
+  8034c9:	ff 75 0c             	push   0xc(%ebp)
+  8034cc:	68 04 c0 80 00       	push   $0x80c004
+  8034d1:	e8 41 ee ff ff       	call   802317 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8034d6:	89 1d 14 c0 80 00    	mov    %ebx,0x80c014
+	return nsipc(NSREQ_BIND);
+  8034dc:	b8 02 00 00 00       	mov    $0x2,%eax
+  8034e1:	e8 32 ff ff ff       	call   803418 <nsipc>
+}
+  8034e6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8034e9:	c9                   	leave
+  8034ea:	c3                   	ret
+
+008034eb <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8034eb:	55                   	push   %ebp
+  8034ec:	89 e5                	mov    %esp,%ebp
+  8034ee:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8034f1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034f4:	a3 00 c0 80 00       	mov    %eax,0x80c000
+	nsipcbuf.shutdown.req_how = how;
+  8034f9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8034fc:	a3 04 c0 80 00       	mov    %eax,0x80c004
+	return nsipc(NSREQ_SHUTDOWN);
+  803501:	b8 03 00 00 00       	mov    $0x3,%eax
+  803506:	e8 0d ff ff ff       	call   803418 <nsipc>
+}
+  80350b:	c9                   	leave
+  80350c:	c3                   	ret
+
+0080350d <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  80350d:	55                   	push   %ebp
+  80350e:	89 e5                	mov    %esp,%ebp
+  803510:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  803513:	8b 45 08             	mov    0x8(%ebp),%eax
+  803516:	a3 00 c0 80 00       	mov    %eax,0x80c000
+	return nsipc(NSREQ_CLOSE);
+  80351b:	b8 04 00 00 00       	mov    $0x4,%eax
+  803520:	e8 f3 fe ff ff       	call   803418 <nsipc>
+}
+  803525:	c9                   	leave
+  803526:	c3                   	ret
+
+00803527 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  803527:	55                   	push   %ebp
+  803528:	89 e5                	mov    %esp,%ebp
+  80352a:	53                   	push   %ebx
+  80352b:	83 ec 08             	sub    $0x8,%esp
+  80352e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  803531:	8b 45 08             	mov    0x8(%ebp),%eax
+  803534:	a3 00 c0 80 00       	mov    %eax,0x80c000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  803539:	53                   	push   %ebx
+  80353a:	ff 75 0c             	push   0xc(%ebp)
+  80353d:	68 04 c0 80 00       	push   $0x80c004
+  803542:	e8 d0 ed ff ff       	call   802317 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  803547:	89 1d 14 c0 80 00    	mov    %ebx,0x80c014
+	return nsipc(NSREQ_CONNECT);
+  80354d:	b8 05 00 00 00       	mov    $0x5,%eax
+  803552:	e8 c1 fe ff ff       	call   803418 <nsipc>
+}
+  803557:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80355a:	c9                   	leave
+  80355b:	c3                   	ret
+
+0080355c <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  80355c:	55                   	push   %ebp
+  80355d:	89 e5                	mov    %esp,%ebp
+  80355f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  803562:	8b 45 08             	mov    0x8(%ebp),%eax
+  803565:	a3 00 c0 80 00       	mov    %eax,0x80c000
+	nsipcbuf.listen.req_backlog = backlog;
+  80356a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80356d:	a3 04 c0 80 00       	mov    %eax,0x80c004
+	return nsipc(NSREQ_LISTEN);
+  803572:	b8 06 00 00 00       	mov    $0x6,%eax
+  803577:	e8 9c fe ff ff       	call   803418 <nsipc>
+}
+  80357c:	c9                   	leave
+  80357d:	c3                   	ret
+
+0080357e <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  80357e:	55                   	push   %ebp
+  80357f:	89 e5                	mov    %esp,%ebp
+  803581:	56                   	push   %esi
+  803582:	53                   	push   %ebx
+  803583:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  803586:	8b 45 08             	mov    0x8(%ebp),%eax
+  803589:	a3 00 c0 80 00       	mov    %eax,0x80c000
+	nsipcbuf.recv.req_len = len;
+  80358e:	89 35 04 c0 80 00    	mov    %esi,0x80c004
+	nsipcbuf.recv.req_flags = flags;
+  803594:	8b 45 14             	mov    0x14(%ebp),%eax
+  803597:	a3 08 c0 80 00       	mov    %eax,0x80c008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  80359c:	b8 07 00 00 00       	mov    $0x7,%eax
+  8035a1:	e8 72 fe ff ff       	call   803418 <nsipc>
+  8035a6:	89 c3                	mov    %eax,%ebx
+  8035a8:	85 c0                	test   %eax,%eax
+  8035aa:	78 22                	js     8035ce <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8035ac:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8035b1:	39 c6                	cmp    %eax,%esi
+  8035b3:	0f 4e c6             	cmovle %esi,%eax
+  8035b6:	39 c3                	cmp    %eax,%ebx
+  8035b8:	7f 1d                	jg     8035d7 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8035ba:	83 ec 04             	sub    $0x4,%esp
+  8035bd:	53                   	push   %ebx
+  8035be:	68 00 c0 80 00       	push   $0x80c000
+  8035c3:	ff 75 0c             	push   0xc(%ebp)
+  8035c6:	e8 4c ed ff ff       	call   802317 <memmove>
+  8035cb:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8035ce:	89 d8                	mov    %ebx,%eax
+  8035d0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8035d3:	5b                   	pop    %ebx
+  8035d4:	5e                   	pop    %esi
+  8035d5:	5d                   	pop    %ebp
+  8035d6:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8035d7:	68 5a 4a 80 00       	push   $0x804a5a
+  8035dc:	68 1d 40 80 00       	push   $0x80401d
+  8035e1:	6a 62                	push   $0x62
+  8035e3:	68 6f 4a 80 00       	push   $0x804a6f
+  8035e8:	e8 10 e5 ff ff       	call   801afd <_panic>
+
+008035ed <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8035ed:	55                   	push   %ebp
+  8035ee:	89 e5                	mov    %esp,%ebp
+  8035f0:	53                   	push   %ebx
+  8035f1:	83 ec 04             	sub    $0x4,%esp
+  8035f4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8035f7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035fa:	a3 00 c0 80 00       	mov    %eax,0x80c000
+	assert(size < 1600);
+  8035ff:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  803605:	7f 2e                	jg     803635 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  803607:	83 ec 04             	sub    $0x4,%esp
+  80360a:	53                   	push   %ebx
+  80360b:	ff 75 0c             	push   0xc(%ebp)
+  80360e:	68 0c c0 80 00       	push   $0x80c00c
+  803613:	e8 ff ec ff ff       	call   802317 <memmove>
+	nsipcbuf.send.req_size = size;
+  803618:	89 1d 04 c0 80 00    	mov    %ebx,0x80c004
+	nsipcbuf.send.req_flags = flags;
+  80361e:	8b 45 14             	mov    0x14(%ebp),%eax
+  803621:	a3 08 c0 80 00       	mov    %eax,0x80c008
+	return nsipc(NSREQ_SEND);
+  803626:	b8 08 00 00 00       	mov    $0x8,%eax
+  80362b:	e8 e8 fd ff ff       	call   803418 <nsipc>
+}
+  803630:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803633:	c9                   	leave
+  803634:	c3                   	ret
+	assert(size < 1600);
+  803635:	68 7b 4a 80 00       	push   $0x804a7b
+  80363a:	68 1d 40 80 00       	push   $0x80401d
+  80363f:	6a 6d                	push   $0x6d
+  803641:	68 6f 4a 80 00       	push   $0x804a6f
+  803646:	e8 b2 e4 ff ff       	call   801afd <_panic>
+
+0080364b <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80364b:	55                   	push   %ebp
+  80364c:	89 e5                	mov    %esp,%ebp
+  80364e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  803651:	8b 45 08             	mov    0x8(%ebp),%eax
+  803654:	a3 00 c0 80 00       	mov    %eax,0x80c000
+	nsipcbuf.socket.req_type = type;
+  803659:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80365c:	a3 04 c0 80 00       	mov    %eax,0x80c004
+	nsipcbuf.socket.req_protocol = protocol;
+  803661:	8b 45 10             	mov    0x10(%ebp),%eax
+  803664:	a3 08 c0 80 00       	mov    %eax,0x80c008
+	return nsipc(NSREQ_SOCKET);
+  803669:	b8 09 00 00 00       	mov    $0x9,%eax
+  80366e:	e8 a5 fd ff ff       	call   803418 <nsipc>
+}
+  803673:	c9                   	leave
+  803674:	c3                   	ret
+
+00803675 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  803675:	55                   	push   %ebp
+  803676:	89 e5                	mov    %esp,%ebp
+  803678:	56                   	push   %esi
+  803679:	53                   	push   %ebx
+  80367a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80367d:	83 ec 0c             	sub    $0xc,%esp
+  803680:	ff 75 08             	push   0x8(%ebp)
+  803683:	e8 6e f3 ff ff       	call   8029f6 <fd2data>
+  803688:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80368a:	83 c4 08             	add    $0x8,%esp
+  80368d:	68 87 4a 80 00       	push   $0x804a87
+  803692:	53                   	push   %ebx
+  803693:	e8 f9 ea ff ff       	call   802191 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  803698:	8b 46 04             	mov    0x4(%esi),%eax
+  80369b:	2b 06                	sub    (%esi),%eax
+  80369d:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8036a3:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8036aa:	00 00 00 
+	stat->st_dev = &devpipe;
+  8036ad:	c7 83 88 00 00 00 9c 	movl   $0x80909c,0x88(%ebx)
+  8036b4:	90 80 00 
+	return 0;
+}
+  8036b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036bc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8036bf:	5b                   	pop    %ebx
+  8036c0:	5e                   	pop    %esi
+  8036c1:	5d                   	pop    %ebp
+  8036c2:	c3                   	ret
+
+008036c3 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8036c3:	55                   	push   %ebp
+  8036c4:	89 e5                	mov    %esp,%ebp
+  8036c6:	53                   	push   %ebx
+  8036c7:	83 ec 0c             	sub    $0xc,%esp
+  8036ca:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8036cd:	53                   	push   %ebx
+  8036ce:	6a 00                	push   $0x0
+  8036d0:	e8 2d ef ff ff       	call   802602 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8036d5:	89 1c 24             	mov    %ebx,(%esp)
+  8036d8:	e8 19 f3 ff ff       	call   8029f6 <fd2data>
+  8036dd:	83 c4 08             	add    $0x8,%esp
+  8036e0:	50                   	push   %eax
+  8036e1:	6a 00                	push   $0x0
+  8036e3:	e8 1a ef ff ff       	call   802602 <sys_page_unmap>
+}
+  8036e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8036eb:	c9                   	leave
+  8036ec:	c3                   	ret
+
+008036ed <_pipeisclosed>:
+{
+  8036ed:	55                   	push   %ebp
+  8036ee:	89 e5                	mov    %esp,%ebp
+  8036f0:	57                   	push   %edi
+  8036f1:	56                   	push   %esi
+  8036f2:	53                   	push   %ebx
+  8036f3:	83 ec 1c             	sub    $0x1c,%esp
+  8036f6:	89 c7                	mov    %eax,%edi
+  8036f8:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  8036fa:	a1 10 a0 80 00       	mov    0x80a010,%eax
+  8036ff:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  803702:	83 ec 0c             	sub    $0xc,%esp
+  803705:	57                   	push   %edi
+  803706:	e8 c6 fa ff ff       	call   8031d1 <pageref>
+  80370b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80370e:	89 34 24             	mov    %esi,(%esp)
+  803711:	e8 bb fa ff ff       	call   8031d1 <pageref>
+		nn = thisenv->env_runs;
+  803716:	8b 15 10 a0 80 00    	mov    0x80a010,%edx
+  80371c:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  80371f:	83 c4 10             	add    $0x10,%esp
+  803722:	39 cb                	cmp    %ecx,%ebx
+  803724:	74 1b                	je     803741 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  803726:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803729:	75 cf                	jne    8036fa <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80372b:	8b 42 58             	mov    0x58(%edx),%eax
+  80372e:	6a 01                	push   $0x1
+  803730:	50                   	push   %eax
+  803731:	53                   	push   %ebx
+  803732:	68 8e 4a 80 00       	push   $0x804a8e
+  803737:	e8 9c e4 ff ff       	call   801bd8 <cprintf>
+  80373c:	83 c4 10             	add    $0x10,%esp
+  80373f:	eb b9                	jmp    8036fa <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  803741:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803744:	0f 94 c0             	sete   %al
+  803747:	0f b6 c0             	movzbl %al,%eax
+}
+  80374a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80374d:	5b                   	pop    %ebx
+  80374e:	5e                   	pop    %esi
+  80374f:	5f                   	pop    %edi
+  803750:	5d                   	pop    %ebp
+  803751:	c3                   	ret
+
+00803752 <devpipe_write>:
+{
+  803752:	55                   	push   %ebp
+  803753:	89 e5                	mov    %esp,%ebp
+  803755:	57                   	push   %edi
+  803756:	56                   	push   %esi
+  803757:	53                   	push   %ebx
+  803758:	83 ec 28             	sub    $0x28,%esp
+  80375b:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  80375e:	56                   	push   %esi
+  80375f:	e8 92 f2 ff ff       	call   8029f6 <fd2data>
+  803764:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803766:	83 c4 10             	add    $0x10,%esp
+  803769:	bf 00 00 00 00       	mov    $0x0,%edi
+  80376e:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  803771:	75 09                	jne    80377c <devpipe_write+0x2a>
+	return i;
+  803773:	89 f8                	mov    %edi,%eax
+  803775:	eb 23                	jmp    80379a <devpipe_write+0x48>
+			sys_yield();
+  803777:	e8 e2 ed ff ff       	call   80255e <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80377c:	8b 43 04             	mov    0x4(%ebx),%eax
+  80377f:	8b 0b                	mov    (%ebx),%ecx
+  803781:	8d 51 20             	lea    0x20(%ecx),%edx
+  803784:	39 d0                	cmp    %edx,%eax
+  803786:	72 1a                	jb     8037a2 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  803788:	89 da                	mov    %ebx,%edx
+  80378a:	89 f0                	mov    %esi,%eax
+  80378c:	e8 5c ff ff ff       	call   8036ed <_pipeisclosed>
+  803791:	85 c0                	test   %eax,%eax
+  803793:	74 e2                	je     803777 <devpipe_write+0x25>
+				return 0;
+  803795:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80379a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80379d:	5b                   	pop    %ebx
+  80379e:	5e                   	pop    %esi
+  80379f:	5f                   	pop    %edi
+  8037a0:	5d                   	pop    %ebp
+  8037a1:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8037a2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8037a5:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8037a9:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8037ac:	89 c2                	mov    %eax,%edx
+  8037ae:	c1 fa 1f             	sar    $0x1f,%edx
+  8037b1:	89 d1                	mov    %edx,%ecx
+  8037b3:	c1 e9 1b             	shr    $0x1b,%ecx
+  8037b6:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8037b9:	83 e2 1f             	and    $0x1f,%edx
+  8037bc:	29 ca                	sub    %ecx,%edx
+  8037be:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8037c2:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8037c6:	83 c0 01             	add    $0x1,%eax
+  8037c9:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8037cc:	83 c7 01             	add    $0x1,%edi
+  8037cf:	eb 9d                	jmp    80376e <devpipe_write+0x1c>
+
+008037d1 <devpipe_read>:
+{
+  8037d1:	55                   	push   %ebp
+  8037d2:	89 e5                	mov    %esp,%ebp
+  8037d4:	57                   	push   %edi
+  8037d5:	56                   	push   %esi
+  8037d6:	53                   	push   %ebx
+  8037d7:	83 ec 18             	sub    $0x18,%esp
+  8037da:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8037dd:	57                   	push   %edi
+  8037de:	e8 13 f2 ff ff       	call   8029f6 <fd2data>
+  8037e3:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8037e5:	83 c4 10             	add    $0x10,%esp
+  8037e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8037ed:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8037f0:	75 13                	jne    803805 <devpipe_read+0x34>
+	return i;
+  8037f2:	89 f0                	mov    %esi,%eax
+  8037f4:	eb 02                	jmp    8037f8 <devpipe_read+0x27>
+				return i;
+  8037f6:	89 f0                	mov    %esi,%eax
+}
+  8037f8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8037fb:	5b                   	pop    %ebx
+  8037fc:	5e                   	pop    %esi
+  8037fd:	5f                   	pop    %edi
+  8037fe:	5d                   	pop    %ebp
+  8037ff:	c3                   	ret
+			sys_yield();
+  803800:	e8 59 ed ff ff       	call   80255e <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  803805:	8b 03                	mov    (%ebx),%eax
+  803807:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80380a:	75 18                	jne    803824 <devpipe_read+0x53>
+			if (i > 0)
+  80380c:	85 f6                	test   %esi,%esi
+  80380e:	75 e6                	jne    8037f6 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  803810:	89 da                	mov    %ebx,%edx
+  803812:	89 f8                	mov    %edi,%eax
+  803814:	e8 d4 fe ff ff       	call   8036ed <_pipeisclosed>
+  803819:	85 c0                	test   %eax,%eax
+  80381b:	74 e3                	je     803800 <devpipe_read+0x2f>
+				return 0;
+  80381d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803822:	eb d4                	jmp    8037f8 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803824:	99                   	cltd
+  803825:	c1 ea 1b             	shr    $0x1b,%edx
+  803828:	01 d0                	add    %edx,%eax
+  80382a:	83 e0 1f             	and    $0x1f,%eax
+  80382d:	29 d0                	sub    %edx,%eax
+  80382f:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  803834:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803837:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80383a:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80383d:	83 c6 01             	add    $0x1,%esi
+  803840:	eb ab                	jmp    8037ed <devpipe_read+0x1c>
+
+00803842 <pipe>:
+{
+  803842:	55                   	push   %ebp
+  803843:	89 e5                	mov    %esp,%ebp
+  803845:	56                   	push   %esi
+  803846:	53                   	push   %ebx
+  803847:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80384a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80384d:	50                   	push   %eax
+  80384e:	e8 ba f1 ff ff       	call   802a0d <fd_alloc>
+  803853:	89 c3                	mov    %eax,%ebx
+  803855:	83 c4 10             	add    $0x10,%esp
+  803858:	85 c0                	test   %eax,%eax
+  80385a:	0f 88 23 01 00 00    	js     803983 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803860:	83 ec 04             	sub    $0x4,%esp
+  803863:	68 07 04 00 00       	push   $0x407
+  803868:	ff 75 f4             	push   -0xc(%ebp)
+  80386b:	6a 00                	push   $0x0
+  80386d:	e8 0b ed ff ff       	call   80257d <sys_page_alloc>
+  803872:	89 c3                	mov    %eax,%ebx
+  803874:	83 c4 10             	add    $0x10,%esp
+  803877:	85 c0                	test   %eax,%eax
+  803879:	0f 88 04 01 00 00    	js     803983 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80387f:	83 ec 0c             	sub    $0xc,%esp
+  803882:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803885:	50                   	push   %eax
+  803886:	e8 82 f1 ff ff       	call   802a0d <fd_alloc>
+  80388b:	89 c3                	mov    %eax,%ebx
+  80388d:	83 c4 10             	add    $0x10,%esp
+  803890:	85 c0                	test   %eax,%eax
+  803892:	0f 88 db 00 00 00    	js     803973 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803898:	83 ec 04             	sub    $0x4,%esp
+  80389b:	68 07 04 00 00       	push   $0x407
+  8038a0:	ff 75 f0             	push   -0x10(%ebp)
+  8038a3:	6a 00                	push   $0x0
+  8038a5:	e8 d3 ec ff ff       	call   80257d <sys_page_alloc>
+  8038aa:	89 c3                	mov    %eax,%ebx
+  8038ac:	83 c4 10             	add    $0x10,%esp
+  8038af:	85 c0                	test   %eax,%eax
+  8038b1:	0f 88 bc 00 00 00    	js     803973 <pipe+0x131>
+	va = fd2data(fd0);
+  8038b7:	83 ec 0c             	sub    $0xc,%esp
+  8038ba:	ff 75 f4             	push   -0xc(%ebp)
+  8038bd:	e8 34 f1 ff ff       	call   8029f6 <fd2data>
+  8038c2:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8038c4:	83 c4 0c             	add    $0xc,%esp
+  8038c7:	68 07 04 00 00       	push   $0x407
+  8038cc:	50                   	push   %eax
+  8038cd:	6a 00                	push   $0x0
+  8038cf:	e8 a9 ec ff ff       	call   80257d <sys_page_alloc>
+  8038d4:	89 c3                	mov    %eax,%ebx
+  8038d6:	83 c4 10             	add    $0x10,%esp
+  8038d9:	85 c0                	test   %eax,%eax
+  8038db:	0f 88 82 00 00 00    	js     803963 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8038e1:	83 ec 0c             	sub    $0xc,%esp
+  8038e4:	ff 75 f0             	push   -0x10(%ebp)
+  8038e7:	e8 0a f1 ff ff       	call   8029f6 <fd2data>
+  8038ec:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8038f3:	50                   	push   %eax
+  8038f4:	6a 00                	push   $0x0
+  8038f6:	56                   	push   %esi
+  8038f7:	6a 00                	push   $0x0
+  8038f9:	e8 c2 ec ff ff       	call   8025c0 <sys_page_map>
+  8038fe:	89 c3                	mov    %eax,%ebx
+  803900:	83 c4 20             	add    $0x20,%esp
+  803903:	85 c0                	test   %eax,%eax
+  803905:	78 4e                	js     803955 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803907:	a1 9c 90 80 00       	mov    0x80909c,%eax
+  80390c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80390f:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803911:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803914:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80391b:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80391e:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803920:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803923:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80392a:	83 ec 0c             	sub    $0xc,%esp
+  80392d:	ff 75 f4             	push   -0xc(%ebp)
+  803930:	e8 b1 f0 ff ff       	call   8029e6 <fd2num>
+  803935:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803938:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80393a:	83 c4 04             	add    $0x4,%esp
+  80393d:	ff 75 f0             	push   -0x10(%ebp)
+  803940:	e8 a1 f0 ff ff       	call   8029e6 <fd2num>
+  803945:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803948:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80394b:	83 c4 10             	add    $0x10,%esp
+  80394e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803953:	eb 2e                	jmp    803983 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803955:	83 ec 08             	sub    $0x8,%esp
+  803958:	56                   	push   %esi
+  803959:	6a 00                	push   $0x0
+  80395b:	e8 a2 ec ff ff       	call   802602 <sys_page_unmap>
+  803960:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803963:	83 ec 08             	sub    $0x8,%esp
+  803966:	ff 75 f0             	push   -0x10(%ebp)
+  803969:	6a 00                	push   $0x0
+  80396b:	e8 92 ec ff ff       	call   802602 <sys_page_unmap>
+  803970:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803973:	83 ec 08             	sub    $0x8,%esp
+  803976:	ff 75 f4             	push   -0xc(%ebp)
+  803979:	6a 00                	push   $0x0
+  80397b:	e8 82 ec ff ff       	call   802602 <sys_page_unmap>
+  803980:	83 c4 10             	add    $0x10,%esp
+}
+  803983:	89 d8                	mov    %ebx,%eax
+  803985:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803988:	5b                   	pop    %ebx
+  803989:	5e                   	pop    %esi
+  80398a:	5d                   	pop    %ebp
+  80398b:	c3                   	ret
+
+0080398c <pipeisclosed>:
+{
+  80398c:	55                   	push   %ebp
+  80398d:	89 e5                	mov    %esp,%ebp
+  80398f:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803992:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803995:	50                   	push   %eax
+  803996:	ff 75 08             	push   0x8(%ebp)
+  803999:	e8 c5 f0 ff ff       	call   802a63 <fd_lookup>
+  80399e:	83 c4 10             	add    $0x10,%esp
+  8039a1:	85 c0                	test   %eax,%eax
+  8039a3:	78 18                	js     8039bd <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8039a5:	83 ec 0c             	sub    $0xc,%esp
+  8039a8:	ff 75 f4             	push   -0xc(%ebp)
+  8039ab:	e8 46 f0 ff ff       	call   8029f6 <fd2data>
+  8039b0:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8039b2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8039b5:	e8 33 fd ff ff       	call   8036ed <_pipeisclosed>
+  8039ba:	83 c4 10             	add    $0x10,%esp
+}
+  8039bd:	c9                   	leave
+  8039be:	c3                   	ret
+
+008039bf <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8039bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039c4:	c3                   	ret
+
+008039c5 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8039c5:	55                   	push   %ebp
+  8039c6:	89 e5                	mov    %esp,%ebp
+  8039c8:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8039cb:	68 a6 4a 80 00       	push   $0x804aa6
+  8039d0:	ff 75 0c             	push   0xc(%ebp)
+  8039d3:	e8 b9 e7 ff ff       	call   802191 <strcpy>
+	return 0;
+}
+  8039d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039dd:	c9                   	leave
+  8039de:	c3                   	ret
+
+008039df <devcons_write>:
+{
+  8039df:	55                   	push   %ebp
+  8039e0:	89 e5                	mov    %esp,%ebp
+  8039e2:	57                   	push   %edi
+  8039e3:	56                   	push   %esi
+  8039e4:	53                   	push   %ebx
+  8039e5:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8039eb:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8039f0:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8039f6:	eb 2e                	jmp    803a26 <devcons_write+0x47>
+		m = n - tot;
+  8039f8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8039fb:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8039fd:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803a02:	39 c3                	cmp    %eax,%ebx
+  803a04:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803a07:	83 ec 04             	sub    $0x4,%esp
+  803a0a:	53                   	push   %ebx
+  803a0b:	89 f0                	mov    %esi,%eax
+  803a0d:	03 45 0c             	add    0xc(%ebp),%eax
+  803a10:	50                   	push   %eax
+  803a11:	57                   	push   %edi
+  803a12:	e8 00 e9 ff ff       	call   802317 <memmove>
+		sys_cputs(buf, m);
+  803a17:	83 c4 08             	add    $0x8,%esp
+  803a1a:	53                   	push   %ebx
+  803a1b:	57                   	push   %edi
+  803a1c:	e8 a0 ea ff ff       	call   8024c1 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803a21:	01 de                	add    %ebx,%esi
+  803a23:	83 c4 10             	add    $0x10,%esp
+  803a26:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803a29:	72 cd                	jb     8039f8 <devcons_write+0x19>
+}
+  803a2b:	89 f0                	mov    %esi,%eax
+  803a2d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a30:	5b                   	pop    %ebx
+  803a31:	5e                   	pop    %esi
+  803a32:	5f                   	pop    %edi
+  803a33:	5d                   	pop    %ebp
+  803a34:	c3                   	ret
+
+00803a35 <devcons_read>:
+{
+  803a35:	55                   	push   %ebp
+  803a36:	89 e5                	mov    %esp,%ebp
+  803a38:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  803a3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a40:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803a44:	75 07                	jne    803a4d <devcons_read+0x18>
+  803a46:	eb 1f                	jmp    803a67 <devcons_read+0x32>
+		sys_yield();
+  803a48:	e8 11 eb ff ff       	call   80255e <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  803a4d:	e8 8d ea ff ff       	call   8024df <sys_cgetc>
+  803a52:	85 c0                	test   %eax,%eax
+  803a54:	74 f2                	je     803a48 <devcons_read+0x13>
+	if (c < 0)
+  803a56:	78 0f                	js     803a67 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  803a58:	83 f8 04             	cmp    $0x4,%eax
+  803a5b:	74 0c                	je     803a69 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  803a5d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803a60:	88 02                	mov    %al,(%edx)
+	return 1;
+  803a62:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803a67:	c9                   	leave
+  803a68:	c3                   	ret
+		return 0;
+  803a69:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a6e:	eb f7                	jmp    803a67 <devcons_read+0x32>
+
+00803a70 <cputchar>:
+{
+  803a70:	55                   	push   %ebp
+  803a71:	89 e5                	mov    %esp,%ebp
+  803a73:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803a76:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a79:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803a7c:	6a 01                	push   $0x1
+  803a7e:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803a81:	50                   	push   %eax
+  803a82:	e8 3a ea ff ff       	call   8024c1 <sys_cputs>
+}
+  803a87:	83 c4 10             	add    $0x10,%esp
+  803a8a:	c9                   	leave
+  803a8b:	c3                   	ret
+
+00803a8c <getchar>:
+{
+  803a8c:	55                   	push   %ebp
+  803a8d:	89 e5                	mov    %esp,%ebp
+  803a8f:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803a92:	6a 01                	push   $0x1
+  803a94:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803a97:	50                   	push   %eax
+  803a98:	6a 00                	push   $0x0
+  803a9a:	e8 2a f2 ff ff       	call   802cc9 <read>
+	if (r < 0)
+  803a9f:	83 c4 10             	add    $0x10,%esp
+  803aa2:	85 c0                	test   %eax,%eax
+  803aa4:	78 06                	js     803aac <getchar+0x20>
+	if (r < 1)
+  803aa6:	74 06                	je     803aae <getchar+0x22>
+	return c;
+  803aa8:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803aac:	c9                   	leave
+  803aad:	c3                   	ret
+		return -E_EOF;
+  803aae:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803ab3:	eb f7                	jmp    803aac <getchar+0x20>
+
+00803ab5 <iscons>:
+{
+  803ab5:	55                   	push   %ebp
+  803ab6:	89 e5                	mov    %esp,%ebp
+  803ab8:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803abb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803abe:	50                   	push   %eax
+  803abf:	ff 75 08             	push   0x8(%ebp)
+  803ac2:	e8 9c ef ff ff       	call   802a63 <fd_lookup>
+  803ac7:	83 c4 10             	add    $0x10,%esp
+  803aca:	85 c0                	test   %eax,%eax
+  803acc:	78 11                	js     803adf <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803ace:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803ad1:	8b 15 b8 90 80 00    	mov    0x8090b8,%edx
+  803ad7:	39 10                	cmp    %edx,(%eax)
+  803ad9:	0f 94 c0             	sete   %al
+  803adc:	0f b6 c0             	movzbl %al,%eax
+}
+  803adf:	c9                   	leave
+  803ae0:	c3                   	ret
+
+00803ae1 <opencons>:
+{
+  803ae1:	55                   	push   %ebp
+  803ae2:	89 e5                	mov    %esp,%ebp
+  803ae4:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803ae7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803aea:	50                   	push   %eax
+  803aeb:	e8 1d ef ff ff       	call   802a0d <fd_alloc>
+  803af0:	83 c4 10             	add    $0x10,%esp
+  803af3:	85 c0                	test   %eax,%eax
+  803af5:	78 3a                	js     803b31 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803af7:	83 ec 04             	sub    $0x4,%esp
+  803afa:	68 07 04 00 00       	push   $0x407
+  803aff:	ff 75 f4             	push   -0xc(%ebp)
+  803b02:	6a 00                	push   $0x0
+  803b04:	e8 74 ea ff ff       	call   80257d <sys_page_alloc>
+  803b09:	83 c4 10             	add    $0x10,%esp
+  803b0c:	85 c0                	test   %eax,%eax
+  803b0e:	78 21                	js     803b31 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803b10:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803b13:	8b 15 b8 90 80 00    	mov    0x8090b8,%edx
+  803b19:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803b1b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803b1e:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803b25:	83 ec 0c             	sub    $0xc,%esp
+  803b28:	50                   	push   %eax
+  803b29:	e8 b8 ee ff ff       	call   8029e6 <fd2num>
+  803b2e:	83 c4 10             	add    $0x10,%esp
+}
+  803b31:	c9                   	leave
+  803b32:	c3                   	ret
+  803b33:	66 90                	xchg   %ax,%ax
+  803b35:	66 90                	xchg   %ax,%ax
+  803b37:	66 90                	xchg   %ax,%ax
+  803b39:	66 90                	xchg   %ax,%ax
+  803b3b:	66 90                	xchg   %ax,%ax
+  803b3d:	66 90                	xchg   %ax,%ax
+  803b3f:	90                   	nop
+
+00803b40 <__udivmoddi4>:
+  803b40:	55                   	push   %ebp
+  803b41:	57                   	push   %edi
+  803b42:	56                   	push   %esi
+  803b43:	53                   	push   %ebx
+  803b44:	83 ec 24             	sub    $0x24,%esp
+  803b47:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803b4b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803b4f:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  803b53:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803b57:	8b 54 24 44          	mov    0x44(%esp),%edx
+  803b5b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803b5f:	8b 44 24 40          	mov    0x40(%esp),%eax
+  803b63:	89 d3                	mov    %edx,%ebx
+  803b65:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803b69:	09 c3                	or     %eax,%ebx
+  803b6b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803b6f:	0f 84 9c 00 00 00    	je     803c11 <__udivmoddi4+0xd1>
+  803b75:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803b7c:	00 
+  803b7d:	31 c0                	xor    %eax,%eax
+  803b7f:	31 d2                	xor    %edx,%edx
+  803b81:	89 fb                	mov    %edi,%ebx
+  803b83:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803b8a:	00 
+  803b8b:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803b90:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803b94:	01 c0                	add    %eax,%eax
+  803b96:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803b9d:	00 
+  803b9e:	89 c6                	mov    %eax,%esi
+  803ba0:	89 d7                	mov    %edx,%edi
+  803ba2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803ba6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803baa:	0f ad d0             	shrd   %cl,%edx,%eax
+  803bad:	d3 ea                	shr    %cl,%edx
+  803baf:	f6 c1 20             	test   $0x20,%cl
+  803bb2:	0f 45 c2             	cmovne %edx,%eax
+  803bb5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803bb9:	83 e0 01             	and    $0x1,%eax
+  803bbc:	09 fa                	or     %edi,%edx
+  803bbe:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  803bc2:	89 04 24             	mov    %eax,(%esp)
+  803bc5:	8b 04 24             	mov    (%esp),%eax
+  803bc8:	89 d5                	mov    %edx,%ebp
+  803bca:	09 f0                	or     %esi,%eax
+  803bcc:	8b 74 24 08          	mov    0x8(%esp),%esi
+  803bd0:	39 f0                	cmp    %esi,%eax
+  803bd2:	19 fd                	sbb    %edi,%ebp
+  803bd4:	72 1d                	jb     803bf3 <__udivmoddi4+0xb3>
+  803bd6:	29 f0                	sub    %esi,%eax
+  803bd8:	19 fa                	sbb    %edi,%edx
+  803bda:	89 cf                	mov    %ecx,%edi
+  803bdc:	c1 ef 05             	shr    $0x5,%edi
+  803bdf:	83 e7 01             	and    $0x1,%edi
+  803be2:	89 fe                	mov    %edi,%esi
+  803be4:	d3 e7                	shl    %cl,%edi
+  803be6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803bea:	83 f6 01             	xor    $0x1,%esi
+  803bed:	d3 e6                	shl    %cl,%esi
+  803bef:	09 74 24 18          	or     %esi,0x18(%esp)
+  803bf3:	83 e9 01             	sub    $0x1,%ecx
+  803bf6:	73 98                	jae    803b90 <__udivmoddi4+0x50>
+  803bf8:	85 db                	test   %ebx,%ebx
+  803bfa:	74 05                	je     803c01 <__udivmoddi4+0xc1>
+  803bfc:	89 03                	mov    %eax,(%ebx)
+  803bfe:	89 53 04             	mov    %edx,0x4(%ebx)
+  803c01:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803c05:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803c09:	83 c4 24             	add    $0x24,%esp
+  803c0c:	5b                   	pop    %ebx
+  803c0d:	5e                   	pop    %esi
+  803c0e:	5f                   	pop    %edi
+  803c0f:	5d                   	pop    %ebp
+  803c10:	c3                   	ret
+  803c11:	85 ff                	test   %edi,%edi
+  803c13:	74 0d                	je     803c22 <__udivmoddi4+0xe2>
+  803c15:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  803c1b:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  803c22:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803c26:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803c2a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  803c2e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803c32:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  803c36:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803c3a:	83 c4 24             	add    $0x24,%esp
+  803c3d:	5b                   	pop    %ebx
+  803c3e:	5e                   	pop    %esi
+  803c3f:	5f                   	pop    %edi
+  803c40:	5d                   	pop    %ebp
+  803c41:	c3                   	ret
+  803c42:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  803c49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00803c50 <__udivdi3>:
+  803c50:	57                   	push   %edi
+  803c51:	56                   	push   %esi
+  803c52:	53                   	push   %ebx
+  803c53:	83 ec 20             	sub    $0x20,%esp
+  803c56:	8b 54 24 34          	mov    0x34(%esp),%edx
+  803c5a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  803c5e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803c62:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803c66:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803c6a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803c6e:	89 d1                	mov    %edx,%ecx
+  803c70:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803c74:	09 c1                	or     %eax,%ecx
+  803c76:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803c7a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  803c7e:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  803c82:	0f 84 88 00 00 00    	je     803d10 <__udivdi3+0xc0>
+  803c88:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803c8f:	00 
+  803c90:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803c95:	31 c0                	xor    %eax,%eax
+  803c97:	31 d2                	xor    %edx,%edx
+  803c99:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803ca0:	00 
+  803ca1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  803ca8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803cac:	01 c0                	add    %eax,%eax
+  803cae:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803cb5:	00 
+  803cb6:	89 c6                	mov    %eax,%esi
+  803cb8:	89 d7                	mov    %edx,%edi
+  803cba:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803cbe:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803cc2:	0f ad d0             	shrd   %cl,%edx,%eax
+  803cc5:	d3 ea                	shr    %cl,%edx
+  803cc7:	f6 c1 20             	test   $0x20,%cl
+  803cca:	0f 45 c2             	cmovne %edx,%eax
+  803ccd:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803cd1:	83 e0 01             	and    $0x1,%eax
+  803cd4:	09 fa                	or     %edi,%edx
+  803cd6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803cda:	89 04 24             	mov    %eax,(%esp)
+  803cdd:	8b 04 24             	mov    (%esp),%eax
+  803ce0:	89 d3                	mov    %edx,%ebx
+  803ce2:	09 f0                	or     %esi,%eax
+  803ce4:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803ce8:	39 f0                	cmp    %esi,%eax
+  803cea:	19 fb                	sbb    %edi,%ebx
+  803cec:	72 1d                	jb     803d0b <__udivdi3+0xbb>
+  803cee:	29 f0                	sub    %esi,%eax
+  803cf0:	19 fa                	sbb    %edi,%edx
+  803cf2:	89 cf                	mov    %ecx,%edi
+  803cf4:	c1 ef 05             	shr    $0x5,%edi
+  803cf7:	83 e7 01             	and    $0x1,%edi
+  803cfa:	89 fe                	mov    %edi,%esi
+  803cfc:	d3 e7                	shl    %cl,%edi
+  803cfe:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803d02:	83 f6 01             	xor    $0x1,%esi
+  803d05:	d3 e6                	shl    %cl,%esi
+  803d07:	09 74 24 18          	or     %esi,0x18(%esp)
+  803d0b:	83 e9 01             	sub    $0x1,%ecx
+  803d0e:	73 98                	jae    803ca8 <__udivdi3+0x58>
+  803d10:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803d14:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803d18:	83 c4 20             	add    $0x20,%esp
+  803d1b:	5b                   	pop    %ebx
+  803d1c:	5e                   	pop    %esi
+  803d1d:	5f                   	pop    %edi
+  803d1e:	c3                   	ret
+  803d1f:	90                   	nop
+
+00803d20 <__umoddi3>:
+  803d20:	57                   	push   %edi
+  803d21:	56                   	push   %esi
+  803d22:	53                   	push   %ebx
+  803d23:	83 ec 18             	sub    $0x18,%esp
+  803d26:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803d2a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803d2e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803d32:	8b 54 24 34          	mov    0x34(%esp),%edx
+  803d36:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803d3a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  803d3e:	89 d1                	mov    %edx,%ecx
+  803d40:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803d44:	09 c1                	or     %eax,%ecx
+  803d46:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803d4a:	74 5b                	je     803da7 <__umoddi3+0x87>
+  803d4c:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803d51:	31 c0                	xor    %eax,%eax
+  803d53:	31 d2                	xor    %edx,%edx
+  803d55:	8d 76 00             	lea    0x0(%esi),%esi
+  803d58:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803d5c:	01 c0                	add    %eax,%eax
+  803d5e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803d65:	00 
+  803d66:	89 c6                	mov    %eax,%esi
+  803d68:	89 d7                	mov    %edx,%edi
+  803d6a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803d6e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803d72:	0f ad d0             	shrd   %cl,%edx,%eax
+  803d75:	d3 ea                	shr    %cl,%edx
+  803d77:	f6 c1 20             	test   $0x20,%cl
+  803d7a:	0f 45 c2             	cmovne %edx,%eax
+  803d7d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803d81:	83 e0 01             	and    $0x1,%eax
+  803d84:	09 fa                	or     %edi,%edx
+  803d86:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803d8a:	89 04 24             	mov    %eax,(%esp)
+  803d8d:	8b 04 24             	mov    (%esp),%eax
+  803d90:	89 d3                	mov    %edx,%ebx
+  803d92:	09 f0                	or     %esi,%eax
+  803d94:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803d98:	39 f0                	cmp    %esi,%eax
+  803d9a:	19 fb                	sbb    %edi,%ebx
+  803d9c:	72 04                	jb     803da2 <__umoddi3+0x82>
+  803d9e:	29 f0                	sub    %esi,%eax
+  803da0:	19 fa                	sbb    %edi,%edx
+  803da2:	83 e9 01             	sub    $0x1,%ecx
+  803da5:	73 b1                	jae    803d58 <__umoddi3+0x38>
+  803da7:	83 c4 18             	add    $0x18,%esp
+  803daa:	5b                   	pop    %ebx
+  803dab:	5e                   	pop    %esi
+  803dac:	5f                   	pop    %edi
+  803dad:	c3                   	ret
+  803dae:	66 90                	xchg   %ax,%ax
+
+00803db0 <__divdi3>:
+  803db0:	55                   	push   %ebp
+  803db1:	57                   	push   %edi
+  803db2:	56                   	push   %esi
+  803db3:	53                   	push   %ebx
+  803db4:	83 ec 24             	sub    $0x24,%esp
+  803db7:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  803dbb:	8b 74 24 44          	mov    0x44(%esp),%esi
+  803dbf:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803dc3:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803dc7:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  803dcb:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  803dcf:	85 d2                	test   %edx,%edx
+  803dd1:	0f 88 e0 00 00 00    	js     803eb7 <__divdi3+0x107>
+  803dd7:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  803ddb:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  803ddf:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803de3:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803de7:	85 f6                	test   %esi,%esi
+  803de9:	78 16                	js     803e01 <__divdi3+0x51>
+  803deb:	89 f1                	mov    %esi,%ecx
+  803ded:	31 c0                	xor    %eax,%eax
+  803def:	31 d2                	xor    %edx,%edx
+  803df1:	09 d9                	or     %ebx,%ecx
+  803df3:	0f 85 f3 00 00 00    	jne    803eec <__divdi3+0x13c>
+  803df9:	83 c4 24             	add    $0x24,%esp
+  803dfc:	5b                   	pop    %ebx
+  803dfd:	5e                   	pop    %esi
+  803dfe:	5f                   	pop    %edi
+  803dff:	5d                   	pop    %ebp
+  803e00:	c3                   	ret
+  803e01:	bf 01 00 00 00       	mov    $0x1,%edi
+  803e06:	f7 5c 24 08          	negl   0x8(%esp)
+  803e0a:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  803e0f:	f7 5c 24 0c          	negl   0xc(%esp)
+  803e13:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803e1a:	00 
+  803e1b:	31 c0                	xor    %eax,%eax
+  803e1d:	31 d2                	xor    %edx,%edx
+  803e1f:	89 fb                	mov    %edi,%ebx
+  803e21:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803e28:	00 
+  803e29:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803e2e:	66 90                	xchg   %ax,%ax
+  803e30:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803e34:	01 c0                	add    %eax,%eax
+  803e36:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803e3d:	00 
+  803e3e:	89 c6                	mov    %eax,%esi
+  803e40:	89 d7                	mov    %edx,%edi
+  803e42:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803e46:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803e4a:	0f ad d0             	shrd   %cl,%edx,%eax
+  803e4d:	d3 ea                	shr    %cl,%edx
+  803e4f:	f6 c1 20             	test   $0x20,%cl
+  803e52:	0f 45 c2             	cmovne %edx,%eax
+  803e55:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803e59:	83 e0 01             	and    $0x1,%eax
+  803e5c:	09 fa                	or     %edi,%edx
+  803e5e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  803e62:	89 04 24             	mov    %eax,(%esp)
+  803e65:	8b 04 24             	mov    (%esp),%eax
+  803e68:	89 d5                	mov    %edx,%ebp
+  803e6a:	09 f0                	or     %esi,%eax
+  803e6c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  803e70:	39 f0                	cmp    %esi,%eax
+  803e72:	19 fd                	sbb    %edi,%ebp
+  803e74:	72 1d                	jb     803e93 <__divdi3+0xe3>
+  803e76:	29 f0                	sub    %esi,%eax
+  803e78:	19 fa                	sbb    %edi,%edx
+  803e7a:	89 cf                	mov    %ecx,%edi
+  803e7c:	c1 ef 05             	shr    $0x5,%edi
+  803e7f:	83 e7 01             	and    $0x1,%edi
+  803e82:	89 fe                	mov    %edi,%esi
+  803e84:	d3 e7                	shl    %cl,%edi
+  803e86:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803e8a:	83 f6 01             	xor    $0x1,%esi
+  803e8d:	d3 e6                	shl    %cl,%esi
+  803e8f:	09 74 24 18          	or     %esi,0x18(%esp)
+  803e93:	83 e9 01             	sub    $0x1,%ecx
+  803e96:	73 98                	jae    803e30 <__divdi3+0x80>
+  803e98:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803e9c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803ea0:	85 db                	test   %ebx,%ebx
+  803ea2:	0f 84 51 ff ff ff    	je     803df9 <__divdi3+0x49>
+  803ea8:	f7 d8                	neg    %eax
+  803eaa:	83 d2 00             	adc    $0x0,%edx
+  803ead:	83 c4 24             	add    $0x24,%esp
+  803eb0:	5b                   	pop    %ebx
+  803eb1:	f7 da                	neg    %edx
+  803eb3:	5e                   	pop    %esi
+  803eb4:	5f                   	pop    %edi
+  803eb5:	5d                   	pop    %ebp
+  803eb6:	c3                   	ret
+  803eb7:	f7 d8                	neg    %eax
+  803eb9:	83 d2 00             	adc    $0x0,%edx
+  803ebc:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803ec0:	f7 da                	neg    %edx
+  803ec2:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803ec6:	85 f6                	test   %esi,%esi
+  803ec8:	78 1b                	js     803ee5 <__divdi3+0x135>
+  803eca:	89 f1                	mov    %esi,%ecx
+  803ecc:	31 c0                	xor    %eax,%eax
+  803ece:	31 d2                	xor    %edx,%edx
+  803ed0:	bf 01 00 00 00       	mov    $0x1,%edi
+  803ed5:	09 d9                	or     %ebx,%ecx
+  803ed7:	0f 85 36 ff ff ff    	jne    803e13 <__divdi3+0x63>
+  803edd:	83 c4 24             	add    $0x24,%esp
+  803ee0:	5b                   	pop    %ebx
+  803ee1:	5e                   	pop    %esi
+  803ee2:	5f                   	pop    %edi
+  803ee3:	5d                   	pop    %ebp
+  803ee4:	c3                   	ret
+  803ee5:	31 ff                	xor    %edi,%edi
+  803ee7:	e9 1a ff ff ff       	jmp    803e06 <__divdi3+0x56>
+  803eec:	31 ff                	xor    %edi,%edi
+  803eee:	e9 20 ff ff ff       	jmp    803e13 <__divdi3+0x63>
+  803ef3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  803efa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00803f00 <__moddi3>:
+  803f00:	55                   	push   %ebp
+  803f01:	57                   	push   %edi
+  803f02:	56                   	push   %esi
+  803f03:	53                   	push   %ebx
+  803f04:	83 ec 1c             	sub    $0x1c,%esp
+  803f07:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  803f0b:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  803f0f:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  803f13:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  803f17:	89 c8                	mov    %ecx,%eax
+  803f19:	89 f2                	mov    %esi,%edx
+  803f1b:	89 f3                	mov    %esi,%ebx
+  803f1d:	85 ed                	test   %ebp,%ebp
+  803f1f:	0f 88 9d 00 00 00    	js     803fc2 <__moddi3+0xc2>
+  803f25:	09 cb                	or     %ecx,%ebx
+  803f27:	0f 84 8d 00 00 00    	je     803fba <__moddi3+0xba>
+  803f2d:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  803f31:	31 db                	xor    %ebx,%ebx
+  803f33:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  803f37:	89 ca                	mov    %ecx,%edx
+  803f39:	89 f0                	mov    %esi,%eax
+  803f3b:	89 dd                	mov    %ebx,%ebp
+  803f3d:	f7 da                	neg    %edx
+  803f3f:	83 d0 00             	adc    $0x0,%eax
+  803f42:	f7 d8                	neg    %eax
+  803f44:	0f 49 f0             	cmovns %eax,%esi
+  803f47:	0f 49 ca             	cmovns %edx,%ecx
+  803f4a:	31 c0                	xor    %eax,%eax
+  803f4c:	31 d2                	xor    %edx,%edx
+  803f4e:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  803f52:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803f56:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803f5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  803f5f:	90                   	nop
+  803f60:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803f64:	01 c0                	add    %eax,%eax
+  803f66:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803f6d:	00 
+  803f6e:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  803f72:	89 c6                	mov    %eax,%esi
+  803f74:	89 d7                	mov    %edx,%edi
+  803f76:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803f7a:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803f7e:	0f ad d0             	shrd   %cl,%edx,%eax
+  803f81:	d3 ea                	shr    %cl,%edx
+  803f83:	f6 c1 20             	test   $0x20,%cl
+  803f86:	0f 45 c2             	cmovne %edx,%eax
+  803f89:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803f8d:	83 e0 01             	and    $0x1,%eax
+  803f90:	09 fa                	or     %edi,%edx
+  803f92:	89 04 24             	mov    %eax,(%esp)
+  803f95:	8b 04 24             	mov    (%esp),%eax
+  803f98:	89 d7                	mov    %edx,%edi
+  803f9a:	09 f0                	or     %esi,%eax
+  803f9c:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  803fa0:	39 d8                	cmp    %ebx,%eax
+  803fa2:	19 f7                	sbb    %esi,%edi
+  803fa4:	72 04                	jb     803faa <__moddi3+0xaa>
+  803fa6:	29 d8                	sub    %ebx,%eax
+  803fa8:	19 f2                	sbb    %esi,%edx
+  803faa:	83 e9 01             	sub    $0x1,%ecx
+  803fad:	73 b1                	jae    803f60 <__moddi3+0x60>
+  803faf:	85 ed                	test   %ebp,%ebp
+  803fb1:	74 07                	je     803fba <__moddi3+0xba>
+  803fb3:	f7 d8                	neg    %eax
+  803fb5:	83 d2 00             	adc    $0x0,%edx
+  803fb8:	f7 da                	neg    %edx
+  803fba:	83 c4 1c             	add    $0x1c,%esp
+  803fbd:	5b                   	pop    %ebx
+  803fbe:	5e                   	pop    %esi
+  803fbf:	5f                   	pop    %edi
+  803fc0:	5d                   	pop    %ebp
+  803fc1:	c3                   	ret
+  803fc2:	09 cb                	or     %ecx,%ebx
+  803fc4:	74 f4                	je     803fba <__moddi3+0xba>
+  803fc6:	f7 df                	neg    %edi
+  803fc8:	bb 01 00 00 00       	mov    $0x1,%ebx
+  803fcd:	83 d5 00             	adc    $0x0,%ebp
+  803fd0:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  803fd4:	f7 dd                	neg    %ebp
+  803fd6:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  803fda:	e9 58 ff ff ff       	jmp    803f37 <__moddi3+0x37>
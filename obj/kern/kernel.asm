@@ -0,0 +1,15611 @@
+
+obj/kern/kernel:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+f0100000 <_start+0xeffffff4>:
+f0100000:	02 b0 ad 1b 00 00    	add    0x1bad(%eax),%dh
+f0100006:	00 00                	add    %al,(%eax)
+f0100008:	fe 4f 52             	decb   0x52(%edi)
+f010000b:	e4                   	.byte 0xe4
+
+f010000c <entry>:
+.globl		_start
+_start = RELOC(entry)
+
+.globl entry
+entry:
+	movw	$0x1234,0x472			# warm boot
+f010000c:	66 c7 05 72 04 00 00 	movw   $0x1234,0x472
+f0100013:	34 12 
+	# sufficient until we set up our real page table in mem_init
+	# in lab 2.
+
+	# Load the physical address of entry_pgdir into cr3.  entry_pgdir
+	# is defined in entrypgdir.c.
+	movl	$(RELOC(entry_pgdir)), %eax
+f0100015:	b8 00 50 11 00       	mov    $0x115000,%eax
+	movl	%eax, %cr3
+f010001a:	0f 22 d8             	mov    %eax,%cr3
+	# Turn on huge page
+	movl	%cr4, %eax
+f010001d:	0f 20 e0             	mov    %cr4,%eax
+	orl	$(CR4_PSE), %eax
+f0100020:	83 c8 10             	or     $0x10,%eax
+	movl	%eax, %cr4
+f0100023:	0f 22 e0             	mov    %eax,%cr4
+	# Turn on paging.
+	movl	%cr0, %eax
+f0100026:	0f 20 c0             	mov    %cr0,%eax
+	orl	$(CR0_PE|CR0_PG|CR0_WP), %eax
+f0100029:	0d 01 00 01 80       	or     $0x80010001,%eax
+	movl	%eax, %cr0
+f010002e:	0f 22 c0             	mov    %eax,%cr0
+	# Turn on page size extension.
+    movl	%cr4, %eax
+f0100031:	0f 20 e0             	mov    %cr4,%eax
+	orl	$(CR4_PSE), %eax
+f0100034:	83 c8 10             	or     $0x10,%eax
+	movl	%eax, %cr4
+f0100037:	0f 22 e0             	mov    %eax,%cr4
+
+	# Now paging is enabled, but we're still running at a low EIP
+	# (why is this okay?).  Jump up above KERNBASE before entering
+	# C code.
+	mov	$relocated, %eax
+f010003a:	b8 41 00 10 f0       	mov    $0xf0100041,%eax
+	jmp	*%eax
+f010003f:	ff e0                	jmp    *%eax
+
+f0100041 <relocated>:
+relocated:
+
+	# Clear the frame pointer register (EBP)
+	# so that once we get into debugging C code,
+	# stack backtraces will be terminated properly.
+	movl	$0x0,%ebp			# nuke frame pointer
+f0100041:	bd 00 00 00 00       	mov    $0x0,%ebp
+
+	# Set the stack pointer
+	movl	$(bootstacktop),%esp
+f0100046:	bc 00 40 11 f0       	mov    $0xf0114000,%esp
+
+	# now to C code
+	call	i386_init
+f010004b:	e8 61 00 00 00       	call   f01000b1 <i386_init>
+
+f0100050 <spin>:
+
+	# Should never get here, but in case we do, just spin.
+spin:	jmp	spin
+f0100050:	eb fe                	jmp    f0100050 <spin>
+
+f0100052 <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: mesg", and then enters the kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt,...)
+{
+f0100052:	55                   	push   %ebp
+f0100053:	89 e5                	mov    %esp,%ebp
+f0100055:	53                   	push   %ebx
+f0100056:	83 ec 04             	sub    $0x4,%esp
+	va_list ap;
+
+	if (panicstr)
+f0100059:	83 3d c0 76 66 f0 00 	cmpl   $0x0,0xf06676c0
+f0100060:	74 0f                	je     f0100071 <_panic+0x1f>
+	va_end(ap);
+
+dead:
+	/* break into the kernel monitor */
+	while (1)
+		monitor(NULL);
+f0100062:	83 ec 0c             	sub    $0xc,%esp
+f0100065:	6a 00                	push   $0x0
+f0100067:	e8 29 0a 00 00       	call   f0100a95 <monitor>
+f010006c:	83 c4 10             	add    $0x10,%esp
+f010006f:	eb f1                	jmp    f0100062 <_panic+0x10>
+	panicstr = fmt;
+f0100071:	8b 45 10             	mov    0x10(%ebp),%eax
+f0100074:	a3 c0 76 66 f0       	mov    %eax,0xf06676c0
+	asm volatile("cli; cld");
+f0100079:	fa                   	cli
+f010007a:	fc                   	cld
+	va_start(ap, fmt);
+f010007b:	8d 5d 14             	lea    0x14(%ebp),%ebx
+	cprintf("kernel panic on CPU %d at %s:%d: ", cpunum(), file, line);
+f010007e:	e8 95 6f 00 00       	call   f0107018 <cpunum>
+f0100083:	ff 75 0c             	push   0xc(%ebp)
+f0100086:	ff 75 08             	push   0x8(%ebp)
+f0100089:	50                   	push   %eax
+f010008a:	68 40 82 10 f0       	push   $0xf0108240
+f010008f:	e8 46 43 00 00       	call   f01043da <cprintf>
+	vcprintf(fmt, ap);
+f0100094:	83 c4 08             	add    $0x8,%esp
+f0100097:	53                   	push   %ebx
+f0100098:	ff 75 10             	push   0x10(%ebp)
+f010009b:	e8 c1 42 00 00       	call   f0104361 <vcprintf>
+	cprintf("\n");
+f01000a0:	c7 04 24 9c 95 10 f0 	movl   $0xf010959c,(%esp)
+f01000a7:	e8 2e 43 00 00       	call   f01043da <cprintf>
+f01000ac:	83 c4 10             	add    $0x10,%esp
+f01000af:	eb b1                	jmp    f0100062 <_panic+0x10>
+
+f01000b1 <i386_init>:
+{
+f01000b1:	55                   	push   %ebp
+f01000b2:	89 e5                	mov    %esp,%ebp
+f01000b4:	53                   	push   %ebx
+f01000b5:	83 ec 04             	sub    $0x4,%esp
+	env_init_percpu();
+f01000b8:	e8 dd 34 00 00       	call   f010359a <env_init_percpu>
+	cons_init();
+f01000bd:	e8 ee 05 00 00       	call   f01006b0 <cons_init>
+	cprintf("6828 decimal is %o octal!\n", 6828);
+f01000c2:	83 ec 08             	sub    $0x8,%esp
+f01000c5:	68 ac 1a 00 00       	push   $0x1aac
+f01000ca:	68 ac 82 10 f0       	push   $0xf01082ac
+f01000cf:	e8 06 43 00 00       	call   f01043da <cprintf>
+	mem_init();
+f01000d4:	e8 30 14 00 00       	call   f0101509 <mem_init>
+	env_init();
+f01000d9:	e8 49 35 00 00       	call   f0103627 <env_init>
+	trap_init();
+f01000de:	e8 00 44 00 00       	call   f01044e3 <trap_init>
+	mp_init();
+f01000e3:	e8 19 6b 00 00       	call   f0106c01 <mp_init>
+	lapic_init();
+f01000e8:	e8 01 6e 00 00       	call   f0106eee <lapic_init>
+	pic_init();
+f01000ed:	e8 a4 41 00 00       	call   f0104296 <pic_init>
+	time_init();
+f01000f2:	e8 4d 7c 00 00       	call   f0107d44 <time_init>
+	pci_init();
+f01000f7:	e8 28 7c 00 00       	call   f0107d24 <pci_init>
+extern struct spinlock kernel_lock;
+
+static inline void
+lock_kernel(void)
+{
+	spin_lock(&kernel_lock);
+f01000fc:	c7 04 24 e0 66 11 f0 	movl   $0xf01166e0,(%esp)
+f0100103:	e8 e2 70 00 00       	call   f01071ea <spin_lock>
+#define KADDR(pa) _kaddr(__FILE__, __LINE__, pa)
+
+static inline void*
+_kaddr(const char *file, int line, physaddr_t pa)
+{
+	if (PGNUM(pa) >= npages)
+f0100108:	83 c4 10             	add    $0x10,%esp
+f010010b:	83 3d c8 76 66 f0 07 	cmpl   $0x7,0xf06676c8
+f0100112:	76 27                	jbe    f010013b <i386_init+0x8a>
+	memmove(code, mpentry_start, mpentry_end - mpentry_start);
+f0100114:	83 ec 04             	sub    $0x4,%esp
+f0100117:	b8 5e 6b 10 f0       	mov    $0xf0106b5e,%eax
+f010011c:	2d dc 6a 10 f0       	sub    $0xf0106adc,%eax
+f0100121:	50                   	push   %eax
+f0100122:	68 dc 6a 10 f0       	push   $0xf0106adc
+f0100127:	68 00 70 00 f0       	push   $0xf0007000
+f010012c:	e8 ff 67 00 00       	call   f0106930 <memmove>
+	for (c = cpus; c < cpus + ncpu; c++) {
+f0100131:	83 c4 10             	add    $0x10,%esp
+f0100134:	bb 00 49 11 f0       	mov    $0xf0114900,%ebx
+f0100139:	eb 1c                	jmp    f0100157 <i386_init+0xa6>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f010013b:	68 00 70 00 00       	push   $0x7000
+f0100140:	68 64 82 10 f0       	push   $0xf0108264
+f0100145:	6a 67                	push   $0x67
+f0100147:	68 c7 82 10 f0       	push   $0xf01082c7
+f010014c:	e8 01 ff ff ff       	call   f0100052 <_panic>
+f0100151:	81 c3 84 00 00 00    	add    $0x84,%ebx
+f0100157:	69 05 08 80 66 f0 84 	imul   $0x84,0xf0668008,%eax
+f010015e:	00 00 00 
+f0100161:	05 00 49 11 f0       	add    $0xf0114900,%eax
+f0100166:	39 c3                	cmp    %eax,%ebx
+f0100168:	73 51                	jae    f01001bb <i386_init+0x10a>
+		if (c == cpus + cpunum())  // We've started already.
+f010016a:	e8 a9 6e 00 00       	call   f0107018 <cpunum>
+f010016f:	69 c0 84 00 00 00    	imul   $0x84,%eax,%eax
+f0100175:	05 00 49 11 f0       	add    $0xf0114900,%eax
+f010017a:	39 c3                	cmp    %eax,%ebx
+f010017c:	74 d3                	je     f0100151 <i386_init+0xa0>
+		mpentry_kstack = percpu_kstacks[c - cpus] + KSTKSIZE;
+f010017e:	89 d8                	mov    %ebx,%eax
+f0100180:	2d 00 49 11 f0       	sub    $0xf0114900,%eax
+f0100185:	c1 f8 02             	sar    $0x2,%eax
+f0100188:	69 c0 e1 83 0f 3e    	imul   $0x3e0f83e1,%eax,%eax
+f010018e:	c1 e0 0f             	shl    $0xf,%eax
+f0100191:	8d 80 00 10 67 f0    	lea    -0xf98f000(%eax),%eax
+f0100197:	a3 c4 76 66 f0       	mov    %eax,0xf06676c4
+		lapic_startap(c->cpu_id, PADDR(code));
+f010019c:	83 ec 08             	sub    $0x8,%esp
+f010019f:	68 00 70 00 00       	push   $0x7000
+f01001a4:	0f b6 43 04          	movzbl 0x4(%ebx),%eax
+f01001a8:	50                   	push   %eax
+f01001a9:	e8 a1 6e 00 00       	call   f010704f <lapic_startap>
+		while(c->cpu_status != CPU_STARTED)
+f01001ae:	83 c4 10             	add    $0x10,%esp
+f01001b1:	8b 43 08             	mov    0x8(%ebx),%eax
+f01001b4:	83 f8 01             	cmp    $0x1,%eax
+f01001b7:	75 f8                	jne    f01001b1 <i386_init+0x100>
+f01001b9:	eb 96                	jmp    f0100151 <i386_init+0xa0>
+	ENV_CREATE(fs_fs, ENV_TYPE_FS);
+f01001bb:	83 ec 08             	sub    $0x8,%esp
+f01001be:	6a 01                	push   $0x1
+f01001c0:	68 14 c1 43 f0       	push   $0xf043c114
+f01001c5:	e8 64 38 00 00       	call   f0103a2e <env_create>
+	ENV_CREATE(net_ns, ENV_TYPE_NS);
+f01001ca:	83 c4 08             	add    $0x8,%esp
+f01001cd:	6a 02                	push   $0x2
+f01001cf:	68 b8 17 4e f0       	push   $0xf04e17b8
+f01001d4:	e8 55 38 00 00       	call   f0103a2e <env_create>
+	ENV_CREATE(user_icode, ENV_TYPE_USER);
+f01001d9:	83 c4 08             	add    $0x8,%esp
+f01001dc:	6a 00                	push   $0x0
+f01001de:	68 68 5c 42 f0       	push   $0xf0425c68
+f01001e3:	e8 46 38 00 00       	call   f0103a2e <env_create>
+	kbd_intr();
+f01001e8:	e8 4e 04 00 00       	call   f010063b <kbd_intr>
+  sched_yield();
+f01001ed:	e8 99 50 00 00       	call   f010528b <sched_yield>
+
+f01001f2 <mp_main>:
+{
+f01001f2:	55                   	push   %ebp
+f01001f3:	89 e5                	mov    %esp,%ebp
+f01001f5:	83 ec 08             	sub    $0x8,%esp
+	lcr3(PADDR(kern_pgdir));
+f01001f8:	a1 cc 76 66 f0       	mov    0xf06676cc,%eax
+	if ((uint32_t)kva < KERNBASE)
+f01001fd:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0100202:	76 4b                	jbe    f010024f <mp_main+0x5d>
+	return (physaddr_t)kva - KERNBASE;
+f0100204:	05 00 00 00 10       	add    $0x10000000,%eax
+}
+
+static inline void
+lcr3(uint32_t val)
+{
+	asm volatile("movl %0,%%cr3" : : "r" (val));
+f0100209:	0f 22 d8             	mov    %eax,%cr3
+	env_init_percpu();
+f010020c:	e8 89 33 00 00       	call   f010359a <env_init_percpu>
+	cprintf("SMP: CPU %d starting\n", cpunum());
+f0100211:	e8 02 6e 00 00       	call   f0107018 <cpunum>
+f0100216:	83 ec 08             	sub    $0x8,%esp
+f0100219:	50                   	push   %eax
+f010021a:	68 d3 82 10 f0       	push   $0xf01082d3
+f010021f:	e8 b6 41 00 00       	call   f01043da <cprintf>
+	lapic_init();
+f0100224:	e8 c5 6c 00 00       	call   f0106eee <lapic_init>
+	trap_init_percpu();
+f0100229:	e8 28 42 00 00       	call   f0104456 <trap_init_percpu>
+// ID read over MMIO.
+static inline struct CpuInfo *
+percpu_self(void)
+{
+	struct CpuInfo *c;
+	asm volatile("movl %%gs:%c1,%0"
+f010022e:	65 8b 15 00 00 00 00 	mov    %gs:0x0,%edx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+f0100235:	b8 01 00 00 00       	mov    $0x1,%eax
+f010023a:	f0 87 42 08          	lock xchg %eax,0x8(%edx)
+f010023e:	c7 04 24 e0 66 11 f0 	movl   $0xf01166e0,(%esp)
+f0100245:	e8 a0 6f 00 00       	call   f01071ea <spin_lock>
+  sched_yield();
+f010024a:	e8 3c 50 00 00       	call   f010528b <sched_yield>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f010024f:	50                   	push   %eax
+f0100250:	68 88 82 10 f0       	push   $0xf0108288
+f0100255:	6a 7d                	push   $0x7d
+f0100257:	68 c7 82 10 f0       	push   $0xf01082c7
+f010025c:	e8 f1 fd ff ff       	call   f0100052 <_panic>
+
+f0100261 <_warn>:
+}
+
+/* like panic, but don't */
+void
+_warn(const char *file, int line, const char *fmt,...)
+{
+f0100261:	55                   	push   %ebp
+f0100262:	89 e5                	mov    %esp,%ebp
+f0100264:	53                   	push   %ebx
+f0100265:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+
+	va_start(ap, fmt);
+f0100268:	8d 5d 14             	lea    0x14(%ebp),%ebx
+	cprintf("kernel warning at %s:%d: ", file, line);
+f010026b:	ff 75 0c             	push   0xc(%ebp)
+f010026e:	ff 75 08             	push   0x8(%ebp)
+f0100271:	68 e9 82 10 f0       	push   $0xf01082e9
+f0100276:	e8 5f 41 00 00       	call   f01043da <cprintf>
+	vcprintf(fmt, ap);
+f010027b:	83 c4 08             	add    $0x8,%esp
+f010027e:	53                   	push   %ebx
+f010027f:	ff 75 10             	push   0x10(%ebp)
+f0100282:	e8 da 40 00 00       	call   f0104361 <vcprintf>
+	cprintf("\n");
+f0100287:	c7 04 24 9c 95 10 f0 	movl   $0xf010959c,(%esp)
+f010028e:	e8 47 41 00 00       	call   f01043da <cprintf>
+	va_end(ap);
+}
+f0100293:	83 c4 10             	add    $0x10,%esp
+f0100296:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0100299:	c9                   	leave
+f010029a:	c3                   	ret
+
+f010029b <serial_proc_data>:
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f010029b:	ba fd 03 00 00       	mov    $0x3fd,%edx
+f01002a0:	ec                   	in     (%dx),%al
+static bool serial_exists;
+
+static int
+serial_proc_data(void)
+{
+	if (!(inb(COM1+COM_LSR) & COM_LSR_DATA))
+f01002a1:	a8 01                	test   $0x1,%al
+f01002a3:	74 0a                	je     f01002af <serial_proc_data+0x14>
+f01002a5:	ba f8 03 00 00       	mov    $0x3f8,%edx
+f01002aa:	ec                   	in     (%dx),%al
+		return -1;
+	return inb(COM1+COM_RX);
+f01002ab:	0f b6 c0             	movzbl %al,%eax
+f01002ae:	c3                   	ret
+		return -1;
+f01002af:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+f01002b4:	c3                   	ret
+
+f01002b5 <cons_intr>:
+
+// called by device interrupt routines to feed input characters
+// into the circular console input buffer.
+static void
+cons_intr(int (*proc)(void))
+{
+f01002b5:	55                   	push   %ebp
+f01002b6:	89 e5                	mov    %esp,%ebp
+f01002b8:	53                   	push   %ebx
+f01002b9:	83 ec 10             	sub    $0x10,%esp
+f01002bc:	89 c3                	mov    %eax,%ebx
+	int c;
+
+	spin_lock(&cons_in_lock);
+f01002be:	68 a0 60 11 f0       	push   $0xf01160a0
+f01002c3:	e8 22 6f 00 00       	call   f01071ea <spin_lock>
+	while ((c = (*proc)()) != -1) {
+f01002c8:	83 c4 10             	add    $0x10,%esp
+f01002cb:	eb 23                	jmp    f01002f0 <cons_intr+0x3b>
+		if (c == 0)
+			continue;
+		cons.buf[cons.wpos++] = c;
+f01002cd:	8b 0d 24 42 62 f0    	mov    0xf0624224,%ecx
+f01002d3:	8d 51 01             	lea    0x1(%ecx),%edx
+f01002d6:	88 81 20 40 62 f0    	mov    %al,-0xf9dbfe0(%ecx)
+		if (cons.wpos == CONSBUFSIZE)
+f01002dc:	81 fa 00 02 00 00    	cmp    $0x200,%edx
+			cons.wpos = 0;
+f01002e2:	b8 00 00 00 00       	mov    $0x0,%eax
+f01002e7:	0f 44 d0             	cmove  %eax,%edx
+f01002ea:	89 15 24 42 62 f0    	mov    %edx,0xf0624224
+	while ((c = (*proc)()) != -1) {
+f01002f0:	ff d3                	call   *%ebx
+f01002f2:	83 f8 ff             	cmp    $0xffffffff,%eax
+f01002f5:	74 06                	je     f01002fd <cons_intr+0x48>
+		if (c == 0)
+f01002f7:	85 c0                	test   %eax,%eax
+f01002f9:	75 d2                	jne    f01002cd <cons_intr+0x18>
+f01002fb:	eb f3                	jmp    f01002f0 <cons_intr+0x3b>
+	}
+	spin_unlock(&cons_in_lock);
+f01002fd:	83 ec 0c             	sub    $0xc,%esp
+f0100300:	68 a0 60 11 f0       	push   $0xf01160a0
+f0100305:	e8 d8 6f 00 00       	call   f01072e2 <spin_unlock>
+}
+f010030a:	83 c4 10             	add    $0x10,%esp
+f010030d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0100310:	c9                   	leave
+f0100311:	c3                   	ret
+
+f0100312 <kbd_proc_data>:
+{
+f0100312:	55                   	push   %ebp
+f0100313:	89 e5                	mov    %esp,%ebp
+f0100315:	53                   	push   %ebx
+f0100316:	83 ec 04             	sub    $0x4,%esp
+f0100319:	ba 64 00 00 00       	mov    $0x64,%edx
+f010031e:	ec                   	in     (%dx),%al
+	if ((stat & KBS_DIB) == 0)
+f010031f:	a8 01                	test   $0x1,%al
+f0100321:	0f 84 ee 00 00 00    	je     f0100415 <kbd_proc_data+0x103>
+	if (stat & KBS_TERR)
+f0100327:	a8 20                	test   $0x20,%al
+f0100329:	0f 85 ed 00 00 00    	jne    f010041c <kbd_proc_data+0x10a>
+f010032f:	ba 60 00 00 00       	mov    $0x60,%edx
+f0100334:	ec                   	in     (%dx),%al
+f0100335:	89 c2                	mov    %eax,%edx
+	if (data == 0xE0) {
+f0100337:	3c e0                	cmp    $0xe0,%al
+f0100339:	74 61                	je     f010039c <kbd_proc_data+0x8a>
+	} else if (data & 0x80) {
+f010033b:	84 c0                	test   %al,%al
+f010033d:	78 70                	js     f01003af <kbd_proc_data+0x9d>
+	} else if (shift & E0ESC) {
+f010033f:	8b 0d 00 40 62 f0    	mov    0xf0624000,%ecx
+f0100345:	f6 c1 40             	test   $0x40,%cl
+f0100348:	74 0e                	je     f0100358 <kbd_proc_data+0x46>
+		data |= 0x80;
+f010034a:	83 c8 80             	or     $0xffffff80,%eax
+f010034d:	89 c2                	mov    %eax,%edx
+		shift &= ~E0ESC;
+f010034f:	83 e1 bf             	and    $0xffffffbf,%ecx
+f0100352:	89 0d 00 40 62 f0    	mov    %ecx,0xf0624000
+	shift |= shiftcode[data];
+f0100358:	0f b6 d2             	movzbl %dl,%edx
+f010035b:	0f b6 82 80 84 10 f0 	movzbl -0xfef7b80(%edx),%eax
+f0100362:	0b 05 00 40 62 f0    	or     0xf0624000,%eax
+	shift ^= togglecode[data];
+f0100368:	0f b6 8a 80 83 10 f0 	movzbl -0xfef7c80(%edx),%ecx
+f010036f:	31 c8                	xor    %ecx,%eax
+f0100371:	a3 00 40 62 f0       	mov    %eax,0xf0624000
+	c = charcode[shift & (CTL | SHIFT)][data];
+f0100376:	89 c1                	mov    %eax,%ecx
+f0100378:	83 e1 03             	and    $0x3,%ecx
+f010037b:	8b 0c 8d 60 83 10 f0 	mov    -0xfef7ca0(,%ecx,4),%ecx
+f0100382:	0f b6 14 11          	movzbl (%ecx,%edx,1),%edx
+f0100386:	0f b6 da             	movzbl %dl,%ebx
+	if (shift & CAPSLOCK) {
+f0100389:	a8 08                	test   $0x8,%al
+f010038b:	74 5d                	je     f01003ea <kbd_proc_data+0xd8>
+		if ('a' <= c && c <= 'z')
+f010038d:	89 da                	mov    %ebx,%edx
+f010038f:	8d 4b 9f             	lea    -0x61(%ebx),%ecx
+f0100392:	83 f9 19             	cmp    $0x19,%ecx
+f0100395:	77 47                	ja     f01003de <kbd_proc_data+0xcc>
+			c += 'A' - 'a';
+f0100397:	83 eb 20             	sub    $0x20,%ebx
+	if (!(~shift & (CTL | ALT)) && c == KEY_DEL) {
+f010039a:	eb 0c                	jmp    f01003a8 <kbd_proc_data+0x96>
+		shift |= E0ESC;
+f010039c:	83 0d 00 40 62 f0 40 	orl    $0x40,0xf0624000
+		return 0;
+f01003a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+f01003a8:	89 d8                	mov    %ebx,%eax
+f01003aa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01003ad:	c9                   	leave
+f01003ae:	c3                   	ret
+		data = (shift & E0ESC ? data : data & 0x7F);
+f01003af:	8b 0d 00 40 62 f0    	mov    0xf0624000,%ecx
+f01003b5:	83 e0 7f             	and    $0x7f,%eax
+f01003b8:	f6 c1 40             	test   $0x40,%cl
+f01003bb:	0f 44 d0             	cmove  %eax,%edx
+		shift &= ~(shiftcode[data] | E0ESC);
+f01003be:	0f b6 d2             	movzbl %dl,%edx
+f01003c1:	0f b6 82 80 84 10 f0 	movzbl -0xfef7b80(%edx),%eax
+f01003c8:	83 c8 40             	or     $0x40,%eax
+f01003cb:	0f b6 c0             	movzbl %al,%eax
+f01003ce:	f7 d0                	not    %eax
+f01003d0:	21 c8                	and    %ecx,%eax
+f01003d2:	a3 00 40 62 f0       	mov    %eax,0xf0624000
+		return 0;
+f01003d7:	bb 00 00 00 00       	mov    $0x0,%ebx
+f01003dc:	eb ca                	jmp    f01003a8 <kbd_proc_data+0x96>
+		else if ('A' <= c && c <= 'Z')
+f01003de:	83 ea 41             	sub    $0x41,%edx
+			c += 'a' - 'A';
+f01003e1:	8d 4b 20             	lea    0x20(%ebx),%ecx
+f01003e4:	83 fa 1a             	cmp    $0x1a,%edx
+f01003e7:	0f 42 d9             	cmovb  %ecx,%ebx
+	if (!(~shift & (CTL | ALT)) && c == KEY_DEL) {
+f01003ea:	f7 d0                	not    %eax
+f01003ec:	a8 06                	test   $0x6,%al
+f01003ee:	75 b8                	jne    f01003a8 <kbd_proc_data+0x96>
+f01003f0:	81 fb e9 00 00 00    	cmp    $0xe9,%ebx
+f01003f6:	75 b0                	jne    f01003a8 <kbd_proc_data+0x96>
+		cprintf("Rebooting!\n");
+f01003f8:	83 ec 0c             	sub    $0xc,%esp
+f01003fb:	68 03 83 10 f0       	push   $0xf0108303
+f0100400:	e8 d5 3f 00 00       	call   f01043da <cprintf>
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0100405:	b8 03 00 00 00       	mov    $0x3,%eax
+f010040a:	ba 92 00 00 00       	mov    $0x92,%edx
+f010040f:	ee                   	out    %al,(%dx)
+}
+f0100410:	83 c4 10             	add    $0x10,%esp
+f0100413:	eb 93                	jmp    f01003a8 <kbd_proc_data+0x96>
+		return -1;
+f0100415:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+f010041a:	eb 8c                	jmp    f01003a8 <kbd_proc_data+0x96>
+		return -1;
+f010041c:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+f0100421:	eb 85                	jmp    f01003a8 <kbd_proc_data+0x96>
+
+f0100423 <cons_putc>:
+}
+
+// output a character to the console
+static void
+cons_putc(int c)
+{
+f0100423:	55                   	push   %ebp
+f0100424:	89 e5                	mov    %esp,%ebp
+f0100426:	57                   	push   %edi
+f0100427:	56                   	push   %esi
+f0100428:	53                   	push   %ebx
+f0100429:	83 ec 1c             	sub    $0x1c,%esp
+f010042c:	89 c7                	mov    %eax,%edi
+	for (i = 0;
+f010042e:	bb 00 00 00 00       	mov    $0x0,%ebx
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f0100433:	be fd 03 00 00       	mov    $0x3fd,%esi
+f0100438:	b9 84 00 00 00       	mov    $0x84,%ecx
+f010043d:	89 f2                	mov    %esi,%edx
+f010043f:	ec                   	in     (%dx),%al
+	     !(inb(COM1 + COM_LSR) & COM_LSR_TXRDY) && i < 12800;
+f0100440:	a8 20                	test   $0x20,%al
+f0100442:	75 13                	jne    f0100457 <cons_putc+0x34>
+f0100444:	81 fb ff 31 00 00    	cmp    $0x31ff,%ebx
+f010044a:	7f 0b                	jg     f0100457 <cons_putc+0x34>
+f010044c:	89 ca                	mov    %ecx,%edx
+f010044e:	ec                   	in     (%dx),%al
+f010044f:	ec                   	in     (%dx),%al
+f0100450:	ec                   	in     (%dx),%al
+f0100451:	ec                   	in     (%dx),%al
+	     i++)
+f0100452:	83 c3 01             	add    $0x1,%ebx
+f0100455:	eb e6                	jmp    f010043d <cons_putc+0x1a>
+	outb(COM1 + COM_TX, c);
+f0100457:	89 f8                	mov    %edi,%eax
+f0100459:	88 45 e7             	mov    %al,-0x19(%ebp)
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f010045c:	ba f8 03 00 00       	mov    $0x3f8,%edx
+f0100461:	ee                   	out    %al,(%dx)
+	for (i = 0; !(inb(0x378+1) & 0x80) && i < 12800; i++)
+f0100462:	bb 00 00 00 00       	mov    $0x0,%ebx
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f0100467:	be 79 03 00 00       	mov    $0x379,%esi
+f010046c:	b9 84 00 00 00       	mov    $0x84,%ecx
+f0100471:	89 f2                	mov    %esi,%edx
+f0100473:	ec                   	in     (%dx),%al
+f0100474:	81 fb ff 31 00 00    	cmp    $0x31ff,%ebx
+f010047a:	7f 0f                	jg     f010048b <cons_putc+0x68>
+f010047c:	84 c0                	test   %al,%al
+f010047e:	78 0b                	js     f010048b <cons_putc+0x68>
+f0100480:	89 ca                	mov    %ecx,%edx
+f0100482:	ec                   	in     (%dx),%al
+f0100483:	ec                   	in     (%dx),%al
+f0100484:	ec                   	in     (%dx),%al
+f0100485:	ec                   	in     (%dx),%al
+f0100486:	83 c3 01             	add    $0x1,%ebx
+f0100489:	eb e6                	jmp    f0100471 <cons_putc+0x4e>
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f010048b:	ba 78 03 00 00       	mov    $0x378,%edx
+f0100490:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+f0100494:	ee                   	out    %al,(%dx)
+f0100495:	ba 7a 03 00 00       	mov    $0x37a,%edx
+f010049a:	b8 0d 00 00 00       	mov    $0xd,%eax
+f010049f:	ee                   	out    %al,(%dx)
+f01004a0:	b8 08 00 00 00       	mov    $0x8,%eax
+f01004a5:	ee                   	out    %al,(%dx)
+		c |= 0x0700;
+f01004a6:	89 f8                	mov    %edi,%eax
+f01004a8:	80 cc 07             	or     $0x7,%ah
+f01004ab:	81 ff 00 01 00 00    	cmp    $0x100,%edi
+f01004b1:	0f 42 f8             	cmovb  %eax,%edi
+	switch (c & 0xff) {
+f01004b4:	89 f8                	mov    %edi,%eax
+f01004b6:	0f b6 c0             	movzbl %al,%eax
+f01004b9:	89 fb                	mov    %edi,%ebx
+f01004bb:	80 fb 0a             	cmp    $0xa,%bl
+f01004be:	0f 84 e1 00 00 00    	je     f01005a5 <cons_putc+0x182>
+f01004c4:	83 f8 0a             	cmp    $0xa,%eax
+f01004c7:	7f 46                	jg     f010050f <cons_putc+0xec>
+f01004c9:	83 f8 08             	cmp    $0x8,%eax
+f01004cc:	0f 84 a7 00 00 00    	je     f0100579 <cons_putc+0x156>
+f01004d2:	83 f8 09             	cmp    $0x9,%eax
+f01004d5:	0f 85 d7 00 00 00    	jne    f01005b2 <cons_putc+0x18f>
+		cons_putc(' ');
+f01004db:	b8 20 00 00 00       	mov    $0x20,%eax
+f01004e0:	e8 3e ff ff ff       	call   f0100423 <cons_putc>
+		cons_putc(' ');
+f01004e5:	b8 20 00 00 00       	mov    $0x20,%eax
+f01004ea:	e8 34 ff ff ff       	call   f0100423 <cons_putc>
+		cons_putc(' ');
+f01004ef:	b8 20 00 00 00       	mov    $0x20,%eax
+f01004f4:	e8 2a ff ff ff       	call   f0100423 <cons_putc>
+		cons_putc(' ');
+f01004f9:	b8 20 00 00 00       	mov    $0x20,%eax
+f01004fe:	e8 20 ff ff ff       	call   f0100423 <cons_putc>
+		cons_putc(' ');
+f0100503:	b8 20 00 00 00       	mov    $0x20,%eax
+f0100508:	e8 16 ff ff ff       	call   f0100423 <cons_putc>
+		break;
+f010050d:	eb 25                	jmp    f0100534 <cons_putc+0x111>
+	switch (c & 0xff) {
+f010050f:	83 f8 0d             	cmp    $0xd,%eax
+f0100512:	0f 85 9a 00 00 00    	jne    f01005b2 <cons_putc+0x18f>
+		crt_pos -= (crt_pos % CRT_COLS);
+f0100518:	0f b7 05 28 42 62 f0 	movzwl 0xf0624228,%eax
+f010051f:	69 c0 cd cc 00 00    	imul   $0xcccd,%eax,%eax
+f0100525:	c1 e8 16             	shr    $0x16,%eax
+f0100528:	8d 04 80             	lea    (%eax,%eax,4),%eax
+f010052b:	c1 e0 04             	shl    $0x4,%eax
+f010052e:	66 a3 28 42 62 f0    	mov    %ax,0xf0624228
+	if (crt_pos >= CRT_SIZE) {
+f0100534:	66 81 3d 28 42 62 f0 	cmpw   $0x7cf,0xf0624228
+f010053b:	cf 07 
+f010053d:	0f 87 92 00 00 00    	ja     f01005d5 <cons_putc+0x1b2>
+	outb(addr_6845, 14);
+f0100543:	8b 0d 30 42 62 f0    	mov    0xf0624230,%ecx
+f0100549:	b8 0e 00 00 00       	mov    $0xe,%eax
+f010054e:	89 ca                	mov    %ecx,%edx
+f0100550:	ee                   	out    %al,(%dx)
+	outb(addr_6845 + 1, crt_pos >> 8);
+f0100551:	0f b7 1d 28 42 62 f0 	movzwl 0xf0624228,%ebx
+f0100558:	8d 71 01             	lea    0x1(%ecx),%esi
+f010055b:	89 d8                	mov    %ebx,%eax
+f010055d:	66 c1 e8 08          	shr    $0x8,%ax
+f0100561:	89 f2                	mov    %esi,%edx
+f0100563:	ee                   	out    %al,(%dx)
+f0100564:	b8 0f 00 00 00       	mov    $0xf,%eax
+f0100569:	89 ca                	mov    %ecx,%edx
+f010056b:	ee                   	out    %al,(%dx)
+f010056c:	89 d8                	mov    %ebx,%eax
+f010056e:	89 f2                	mov    %esi,%edx
+f0100570:	ee                   	out    %al,(%dx)
+	serial_putc(c);
+	lpt_putc(c);
+	cga_putc(c);
+}
+f0100571:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0100574:	5b                   	pop    %ebx
+f0100575:	5e                   	pop    %esi
+f0100576:	5f                   	pop    %edi
+f0100577:	5d                   	pop    %ebp
+f0100578:	c3                   	ret
+		if (crt_pos > 0) {
+f0100579:	0f b7 05 28 42 62 f0 	movzwl 0xf0624228,%eax
+f0100580:	66 85 c0             	test   %ax,%ax
+f0100583:	74 be                	je     f0100543 <cons_putc+0x120>
+			crt_pos--;
+f0100585:	83 e8 01             	sub    $0x1,%eax
+f0100588:	66 a3 28 42 62 f0    	mov    %ax,0xf0624228
+			crt_buf[crt_pos] = (c & ~0xff) | ' ';
+f010058e:	0f b7 c0             	movzwl %ax,%eax
+f0100591:	66 81 e7 00 ff       	and    $0xff00,%di
+f0100596:	83 cf 20             	or     $0x20,%edi
+f0100599:	8b 15 2c 42 62 f0    	mov    0xf062422c,%edx
+f010059f:	66 89 3c 42          	mov    %di,(%edx,%eax,2)
+f01005a3:	eb 8f                	jmp    f0100534 <cons_putc+0x111>
+		crt_pos += CRT_COLS;
+f01005a5:	66 83 05 28 42 62 f0 	addw   $0x50,0xf0624228
+f01005ac:	50 
+f01005ad:	e9 66 ff ff ff       	jmp    f0100518 <cons_putc+0xf5>
+		crt_buf[crt_pos++] = c;		/* write the character */
+f01005b2:	0f b7 05 28 42 62 f0 	movzwl 0xf0624228,%eax
+f01005b9:	8d 50 01             	lea    0x1(%eax),%edx
+f01005bc:	66 89 15 28 42 62 f0 	mov    %dx,0xf0624228
+f01005c3:	0f b7 c0             	movzwl %ax,%eax
+f01005c6:	8b 15 2c 42 62 f0    	mov    0xf062422c,%edx
+f01005cc:	66 89 3c 42          	mov    %di,(%edx,%eax,2)
+		break;
+f01005d0:	e9 5f ff ff ff       	jmp    f0100534 <cons_putc+0x111>
+		memmove(crt_buf, crt_buf + CRT_COLS, (CRT_SIZE - CRT_COLS) * sizeof(uint16_t));
+f01005d5:	a1 2c 42 62 f0       	mov    0xf062422c,%eax
+f01005da:	83 ec 04             	sub    $0x4,%esp
+f01005dd:	68 00 0f 00 00       	push   $0xf00
+f01005e2:	8d 90 a0 00 00 00    	lea    0xa0(%eax),%edx
+f01005e8:	52                   	push   %edx
+f01005e9:	50                   	push   %eax
+f01005ea:	e8 41 63 00 00       	call   f0106930 <memmove>
+			crt_buf[i] = 0x0700 | ' ';
+f01005ef:	8b 15 2c 42 62 f0    	mov    0xf062422c,%edx
+f01005f5:	8d 82 00 0f 00 00    	lea    0xf00(%edx),%eax
+f01005fb:	81 c2 a0 0f 00 00    	add    $0xfa0,%edx
+		for (i = CRT_SIZE - CRT_COLS; i < CRT_SIZE; i++)
+f0100601:	83 c4 10             	add    $0x10,%esp
+f0100604:	eb 08                	jmp    f010060e <cons_putc+0x1eb>
+			crt_buf[i] = 0x0700 | ' ';
+f0100606:	66 c7 00 20 07       	movw   $0x720,(%eax)
+		for (i = CRT_SIZE - CRT_COLS; i < CRT_SIZE; i++)
+f010060b:	83 c0 02             	add    $0x2,%eax
+f010060e:	39 d0                	cmp    %edx,%eax
+f0100610:	75 f4                	jne    f0100606 <cons_putc+0x1e3>
+		crt_pos -= CRT_COLS;
+f0100612:	66 83 2d 28 42 62 f0 	subw   $0x50,0xf0624228
+f0100619:	50 
+f010061a:	e9 24 ff ff ff       	jmp    f0100543 <cons_putc+0x120>
+
+f010061f <serial_intr>:
+	if (serial_exists)
+f010061f:	80 3d 34 42 62 f0 00 	cmpb   $0x0,0xf0624234
+f0100626:	75 01                	jne    f0100629 <serial_intr+0xa>
+f0100628:	c3                   	ret
+{
+f0100629:	55                   	push   %ebp
+f010062a:	89 e5                	mov    %esp,%ebp
+f010062c:	83 ec 08             	sub    $0x8,%esp
+		cons_intr(serial_proc_data);
+f010062f:	b8 9b 02 10 f0       	mov    $0xf010029b,%eax
+f0100634:	e8 7c fc ff ff       	call   f01002b5 <cons_intr>
+}
+f0100639:	c9                   	leave
+f010063a:	c3                   	ret
+
+f010063b <kbd_intr>:
+{
+f010063b:	55                   	push   %ebp
+f010063c:	89 e5                	mov    %esp,%ebp
+f010063e:	83 ec 08             	sub    $0x8,%esp
+	cons_intr(kbd_proc_data);
+f0100641:	b8 12 03 10 f0       	mov    $0xf0100312,%eax
+f0100646:	e8 6a fc ff ff       	call   f01002b5 <cons_intr>
+}
+f010064b:	c9                   	leave
+f010064c:	c3                   	ret
+
+f010064d <cons_getc>:
+{
+f010064d:	55                   	push   %ebp
+f010064e:	89 e5                	mov    %esp,%ebp
+f0100650:	53                   	push   %ebx
+f0100651:	83 ec 04             	sub    $0x4,%esp
+	serial_intr();
+f0100654:	e8 c6 ff ff ff       	call   f010061f <serial_intr>
+	kbd_intr();
+f0100659:	e8 dd ff ff ff       	call   f010063b <kbd_intr>
+	spin_lock(&cons_in_lock);
+f010065e:	83 ec 0c             	sub    $0xc,%esp
+f0100661:	68 a0 60 11 f0       	push   $0xf01160a0
+f0100666:	e8 7f 6b 00 00       	call   f01071ea <spin_lock>
+	if (cons.rpos != cons.wpos) {
+f010066b:	a1 20 42 62 f0       	mov    0xf0624220,%eax
+f0100670:	83 c4 10             	add    $0x10,%esp
+	c = 0;
+f0100673:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (cons.rpos != cons.wpos) {
+f0100678:	3b 05 24 42 62 f0    	cmp    0xf0624224,%eax
+f010067e:	74 1c                	je     f010069c <cons_getc+0x4f>
+		c = cons.buf[cons.rpos++];
+f0100680:	8d 50 01             	lea    0x1(%eax),%edx
+f0100683:	0f b6 98 20 40 62 f0 	movzbl -0xf9dbfe0(%eax),%ebx
+			cons.rpos = 0;
+f010068a:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+f010068f:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100694:	0f 45 c2             	cmovne %edx,%eax
+f0100697:	a3 20 42 62 f0       	mov    %eax,0xf0624220
+	spin_unlock(&cons_in_lock);
+f010069c:	83 ec 0c             	sub    $0xc,%esp
+f010069f:	68 a0 60 11 f0       	push   $0xf01160a0
+f01006a4:	e8 39 6c 00 00       	call   f01072e2 <spin_unlock>
+}
+f01006a9:	89 d8                	mov    %ebx,%eax
+f01006ab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01006ae:	c9                   	leave
+f01006af:	c3                   	ret
+
+f01006b0 <cons_init>:
+
+// initialize the console devices
+void
+cons_init(void)
+{
+f01006b0:	55                   	push   %ebp
+f01006b1:	89 e5                	mov    %esp,%ebp
+f01006b3:	57                   	push   %edi
+f01006b4:	56                   	push   %esi
+f01006b5:	53                   	push   %ebx
+f01006b6:	83 ec 0c             	sub    $0xc,%esp
+	was = *cp;
+f01006b9:	0f b7 15 00 80 0b f0 	movzwl 0xf00b8000,%edx
+	*cp = (uint16_t) 0xA55A;
+f01006c0:	66 c7 05 00 80 0b f0 	movw   $0xa55a,0xf00b8000
+f01006c7:	5a a5 
+	if (*cp != 0xA55A) {
+f01006c9:	0f b7 05 00 80 0b f0 	movzwl 0xf00b8000,%eax
+f01006d0:	bb b4 03 00 00       	mov    $0x3b4,%ebx
+		cp = (uint16_t*) (KERNBASE + MONO_BUF);
+f01006d5:	be 00 00 0b f0       	mov    $0xf00b0000,%esi
+	if (*cp != 0xA55A) {
+f01006da:	66 3d 5a a5          	cmp    $0xa55a,%ax
+f01006de:	0f 84 cd 00 00 00    	je     f01007b1 <cons_init+0x101>
+		addr_6845 = MONO_BASE;
+f01006e4:	89 1d 30 42 62 f0    	mov    %ebx,0xf0624230
+f01006ea:	b8 0e 00 00 00       	mov    $0xe,%eax
+f01006ef:	89 da                	mov    %ebx,%edx
+f01006f1:	ee                   	out    %al,(%dx)
+	pos = inb(addr_6845 + 1) << 8;
+f01006f2:	8d 7b 01             	lea    0x1(%ebx),%edi
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f01006f5:	89 fa                	mov    %edi,%edx
+f01006f7:	ec                   	in     (%dx),%al
+f01006f8:	0f b6 c8             	movzbl %al,%ecx
+f01006fb:	c1 e1 08             	shl    $0x8,%ecx
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f01006fe:	b8 0f 00 00 00       	mov    $0xf,%eax
+f0100703:	89 da                	mov    %ebx,%edx
+f0100705:	ee                   	out    %al,(%dx)
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f0100706:	89 fa                	mov    %edi,%edx
+f0100708:	ec                   	in     (%dx),%al
+	crt_buf = (uint16_t*) cp;
+f0100709:	89 35 2c 42 62 f0    	mov    %esi,0xf062422c
+	pos |= inb(addr_6845 + 1);
+f010070f:	0f b6 c0             	movzbl %al,%eax
+f0100712:	09 c8                	or     %ecx,%eax
+	crt_pos = pos;
+f0100714:	66 a3 28 42 62 f0    	mov    %ax,0xf0624228
+	kbd_intr();
+f010071a:	e8 1c ff ff ff       	call   f010063b <kbd_intr>
+	irq_setmask_8259A(irq_mask_8259A & ~(1<<IRQ_KBD));
+f010071f:	83 ec 0c             	sub    $0xc,%esp
+f0100722:	0f b7 05 2c 66 11 f0 	movzwl 0xf011662c,%eax
+f0100729:	25 fd ff 00 00       	and    $0xfffd,%eax
+f010072e:	50                   	push   %eax
+f010072f:	e8 df 3a 00 00       	call   f0104213 <irq_setmask_8259A>
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0100734:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0100739:	bb fa 03 00 00       	mov    $0x3fa,%ebx
+f010073e:	89 c8                	mov    %ecx,%eax
+f0100740:	89 da                	mov    %ebx,%edx
+f0100742:	ee                   	out    %al,(%dx)
+f0100743:	bf fb 03 00 00       	mov    $0x3fb,%edi
+f0100748:	b8 80 ff ff ff       	mov    $0xffffff80,%eax
+f010074d:	89 fa                	mov    %edi,%edx
+f010074f:	ee                   	out    %al,(%dx)
+f0100750:	b8 0c 00 00 00       	mov    $0xc,%eax
+f0100755:	ba f8 03 00 00       	mov    $0x3f8,%edx
+f010075a:	ee                   	out    %al,(%dx)
+f010075b:	be f9 03 00 00       	mov    $0x3f9,%esi
+f0100760:	89 c8                	mov    %ecx,%eax
+f0100762:	89 f2                	mov    %esi,%edx
+f0100764:	ee                   	out    %al,(%dx)
+f0100765:	b8 03 00 00 00       	mov    $0x3,%eax
+f010076a:	89 fa                	mov    %edi,%edx
+f010076c:	ee                   	out    %al,(%dx)
+f010076d:	ba fc 03 00 00       	mov    $0x3fc,%edx
+f0100772:	89 c8                	mov    %ecx,%eax
+f0100774:	ee                   	out    %al,(%dx)
+f0100775:	b8 01 00 00 00       	mov    $0x1,%eax
+f010077a:	89 f2                	mov    %esi,%edx
+f010077c:	ee                   	out    %al,(%dx)
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f010077d:	ba fd 03 00 00       	mov    $0x3fd,%edx
+f0100782:	ec                   	in     (%dx),%al
+f0100783:	89 c1                	mov    %eax,%ecx
+	serial_exists = (inb(COM1+COM_LSR) != 0xFF);
+f0100785:	83 c4 10             	add    $0x10,%esp
+f0100788:	3c ff                	cmp    $0xff,%al
+f010078a:	0f 95 05 34 42 62 f0 	setne  0xf0624234
+f0100791:	89 da                	mov    %ebx,%edx
+f0100793:	ec                   	in     (%dx),%al
+f0100794:	ba f8 03 00 00       	mov    $0x3f8,%edx
+f0100799:	ec                   	in     (%dx),%al
+	if (serial_exists)
+f010079a:	80 f9 ff             	cmp    $0xff,%cl
+f010079d:	75 28                	jne    f01007c7 <cons_init+0x117>
+	cga_init();
+	kbd_init();
+	serial_init();
+
+	if (!serial_exists)
+		cprintf("Serial port does not exist!\n");
+f010079f:	83 ec 0c             	sub    $0xc,%esp
+f01007a2:	68 0f 83 10 f0       	push   $0xf010830f
+f01007a7:	e8 2e 3c 00 00       	call   f01043da <cprintf>
+f01007ac:	83 c4 10             	add    $0x10,%esp
+}
+f01007af:	eb 37                	jmp    f01007e8 <cons_init+0x138>
+		*cp = was;
+f01007b1:	66 89 15 00 80 0b f0 	mov    %dx,0xf00b8000
+f01007b8:	bb d4 03 00 00       	mov    $0x3d4,%ebx
+	cp = (uint16_t*) (KERNBASE + CGA_BUF);
+f01007bd:	be 00 80 0b f0       	mov    $0xf00b8000,%esi
+f01007c2:	e9 1d ff ff ff       	jmp    f01006e4 <cons_init+0x34>
+		irq_setmask_8259A(irq_mask_8259A & ~(1<<IRQ_SERIAL));
+f01007c7:	83 ec 0c             	sub    $0xc,%esp
+f01007ca:	0f b7 05 2c 66 11 f0 	movzwl 0xf011662c,%eax
+f01007d1:	25 ef ff 00 00       	and    $0xffef,%eax
+f01007d6:	50                   	push   %eax
+f01007d7:	e8 37 3a 00 00       	call   f0104213 <irq_setmask_8259A>
+	if (!serial_exists)
+f01007dc:	83 c4 10             	add    $0x10,%esp
+f01007df:	80 3d 34 42 62 f0 00 	cmpb   $0x0,0xf0624234
+f01007e6:	74 b7                	je     f010079f <cons_init+0xef>
+}
+f01007e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01007eb:	5b                   	pop    %ebx
+f01007ec:	5e                   	pop    %esi
+f01007ed:	5f                   	pop    %edi
+f01007ee:	5d                   	pop    %ebp
+f01007ef:	c3                   	ret
+
+f01007f0 <cputchar>:
+
+// `High'-level console I/O.  Used by readline and cprintf.
+
+void
+cputchar(int c)
+{
+f01007f0:	55                   	push   %ebp
+f01007f1:	89 e5                	mov    %esp,%ebp
+f01007f3:	83 ec 08             	sub    $0x8,%esp
+	cons_putc(c);
+f01007f6:	8b 45 08             	mov    0x8(%ebp),%eax
+f01007f9:	e8 25 fc ff ff       	call   f0100423 <cons_putc>
+}
+f01007fe:	c9                   	leave
+f01007ff:	c3                   	ret
+
+f0100800 <getchar>:
+
+int
+getchar(void)
+{
+f0100800:	55                   	push   %ebp
+f0100801:	89 e5                	mov    %esp,%ebp
+f0100803:	83 ec 08             	sub    $0x8,%esp
+	int c;
+
+	while ((c = cons_getc()) == 0)
+f0100806:	e8 42 fe ff ff       	call   f010064d <cons_getc>
+f010080b:	85 c0                	test   %eax,%eax
+f010080d:	74 f7                	je     f0100806 <getchar+0x6>
+		/* do nothing */;
+	return c;
+}
+f010080f:	c9                   	leave
+f0100810:	c3                   	ret
+
+f0100811 <iscons>:
+int
+iscons(int fdnum)
+{
+	// used by readline
+	return 1;
+}
+f0100811:	b8 01 00 00 00       	mov    $0x1,%eax
+f0100816:	c3                   	ret
+
+f0100817 <mon_help>:
+
+/***** Implementations of basic kernel monitor commands *****/
+
+int
+mon_help(int argc, char **argv, struct Trapframe *tf)
+{
+f0100817:	55                   	push   %ebp
+f0100818:	89 e5                	mov    %esp,%ebp
+f010081a:	83 ec 0c             	sub    $0xc,%esp
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(commands); i++)
+		cprintf("%s - %s\n", commands[i].name, commands[i].desc);
+f010081d:	68 80 85 10 f0       	push   $0xf0108580
+f0100822:	68 9e 85 10 f0       	push   $0xf010859e
+f0100827:	68 a3 85 10 f0       	push   $0xf01085a3
+f010082c:	e8 a9 3b 00 00       	call   f01043da <cprintf>
+f0100831:	83 c4 0c             	add    $0xc,%esp
+f0100834:	68 4c 86 10 f0       	push   $0xf010864c
+f0100839:	68 ac 85 10 f0       	push   $0xf01085ac
+f010083e:	68 a3 85 10 f0       	push   $0xf01085a3
+f0100843:	e8 92 3b 00 00       	call   f01043da <cprintf>
+f0100848:	83 c4 0c             	add    $0xc,%esp
+f010084b:	68 74 86 10 f0       	push   $0xf0108674
+f0100850:	68 b5 85 10 f0       	push   $0xf01085b5
+f0100855:	68 a3 85 10 f0       	push   $0xf01085a3
+f010085a:	e8 7b 3b 00 00       	call   f01043da <cprintf>
+f010085f:	83 c4 0c             	add    $0xc,%esp
+f0100862:	68 9c 86 10 f0       	push   $0xf010869c
+f0100867:	68 ba 85 10 f0       	push   $0xf01085ba
+f010086c:	68 a3 85 10 f0       	push   $0xf01085a3
+f0100871:	e8 64 3b 00 00       	call   f01043da <cprintf>
+	return 0;
+}
+f0100876:	b8 00 00 00 00       	mov    $0x0,%eax
+f010087b:	c9                   	leave
+f010087c:	c3                   	ret
+
+f010087d <mon_kerninfo>:
+
+int
+mon_kerninfo(int argc, char **argv, struct Trapframe *tf)
+{
+f010087d:	55                   	push   %ebp
+f010087e:	89 e5                	mov    %esp,%ebp
+f0100880:	83 ec 14             	sub    $0x14,%esp
+	extern char _start[], entry[], etext[], edata[], end[];
+
+	cprintf("Special kernel symbols:\n");
+f0100883:	68 c0 85 10 f0       	push   $0xf01085c0
+f0100888:	e8 4d 3b 00 00       	call   f01043da <cprintf>
+	cprintf("  _start                  %08x (phys)\n", _start);
+f010088d:	83 c4 08             	add    $0x8,%esp
+f0100890:	68 0c 00 10 00       	push   $0x10000c
+f0100895:	68 cc 86 10 f0       	push   $0xf01086cc
+f010089a:	e8 3b 3b 00 00       	call   f01043da <cprintf>
+	cprintf("  entry  %08x (virt)  %08x (phys)\n", entry, entry - KERNBASE);
+f010089f:	83 c4 0c             	add    $0xc,%esp
+f01008a2:	68 0c 00 10 00       	push   $0x10000c
+f01008a7:	68 0c 00 10 f0       	push   $0xf010000c
+f01008ac:	68 f4 86 10 f0       	push   $0xf01086f4
+f01008b1:	e8 24 3b 00 00       	call   f01043da <cprintf>
+	cprintf("  etext  %08x (virt)  %08x (phys)\n", etext, etext - KERNBASE);
+f01008b6:	83 c4 0c             	add    $0xc,%esp
+f01008b9:	68 2f 82 10 00       	push   $0x10822f
+f01008be:	68 2f 82 10 f0       	push   $0xf010822f
+f01008c3:	68 18 87 10 f0       	push   $0xf0108718
+f01008c8:	e8 0d 3b 00 00       	call   f01043da <cprintf>
+	cprintf("  edata  %08x (virt)  %08x (phys)\n", edata, edata - KERNBASE);
+f01008cd:	83 c4 0c             	add    $0xc,%esp
+f01008d0:	68 00 40 62 00       	push   $0x624000
+f01008d5:	68 00 40 62 f0       	push   $0xf0624000
+f01008da:	68 3c 87 10 f0       	push   $0xf010873c
+f01008df:	e8 f6 3a 00 00       	call   f01043da <cprintf>
+	cprintf("  end    %08x (virt)  %08x (phys)\n", end, end - KERNBASE);
+f01008e4:	83 c4 0c             	add    $0xc,%esp
+f01008e7:	68 e0 8c 76 00       	push   $0x768ce0
+f01008ec:	68 e0 8c 76 f0       	push   $0xf0768ce0
+f01008f1:	68 60 87 10 f0       	push   $0xf0108760
+f01008f6:	e8 df 3a 00 00       	call   f01043da <cprintf>
+	cprintf("Kernel executable memory footprint: %dKB\n",
+f01008fb:	83 c4 08             	add    $0x8,%esp
+		ROUNDUP(end - entry, 1024) / 1024);
+f01008fe:	b8 e0 8c 76 f0       	mov    $0xf0768ce0,%eax
+f0100903:	2d 0d fc 0f f0       	sub    $0xf00ffc0d,%eax
+	cprintf("Kernel executable memory footprint: %dKB\n",
+f0100908:	c1 f8 0a             	sar    $0xa,%eax
+f010090b:	50                   	push   %eax
+f010090c:	68 84 87 10 f0       	push   $0xf0108784
+f0100911:	e8 c4 3a 00 00       	call   f01043da <cprintf>
+	return 0;
+}
+f0100916:	b8 00 00 00 00       	mov    $0x0,%eax
+f010091b:	c9                   	leave
+f010091c:	c3                   	ret
+
+f010091d <mon_kpti>:
+
+int
+mon_kpti(int argc, char **argv, struct Trapframe *tf)
+{
+f010091d:	55                   	push   %ebp
+f010091e:	89 e5                	mov    %esp,%ebp
+f0100920:	83 ec 0c             	sub    $0xc,%esp
+	cprintf("Isolation checks: %u full, %u fast\n",
+f0100923:	ff 35 d8 76 66 f0    	push   0xf06676d8
+f0100929:	ff 35 d4 76 66 f0    	push   0xf06676d4
+f010092f:	68 b0 87 10 f0       	push   $0xf01087b0
+f0100934:	e8 a1 3a 00 00       	call   f01043da <cprintf>
+		kpti_stats.full_checks, kpti_stats.fast_checks);
+	cprintf("PTE probes saved on the switch path: %llu\n",
+f0100939:	83 c4 0c             	add    $0xc,%esp
+f010093c:	b8 00 08 01 00       	mov    $0x10800,%eax
+f0100941:	f7 25 d8 76 66 f0    	mull   0xf06676d8
+f0100947:	52                   	push   %edx
+f0100948:	50                   	push   %eax
+f0100949:	68 d4 87 10 f0       	push   $0xf01087d4
+f010094e:	e8 87 3a 00 00       	call   f01043da <cprintf>
+		(uint64_t) kpti_stats.fast_checks * KPTI_PROBES);
+	return 0;
+}
+f0100953:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100958:	c9                   	leave
+f0100959:	c3                   	ret
+
+f010095a <mon_locks>:
+
+int
+mon_locks(int argc, char **argv, struct Trapframe *tf)
+{
+f010095a:	55                   	push   %ebp
+f010095b:	89 e5                	mov    %esp,%ebp
+f010095d:	57                   	push   %edi
+f010095e:	56                   	push   %esi
+f010095f:	53                   	push   %ebx
+f0100960:	83 ec 3c             	sub    $0x3c,%esp
+#ifdef DEBUG_SPINLOCK
+	struct Eipdebuginfo info;
+	struct spinlock *lk;
+	uint32_t i, n;
+
+	if (argc > 1 && strcmp(argv[1], "reset") == 0) {
+f0100963:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+f0100967:	7e 1a                	jle    f0100983 <mon_locks+0x29>
+f0100969:	83 ec 08             	sub    $0x8,%esp
+f010096c:	68 d9 85 10 f0       	push   $0xf01085d9
+f0100971:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0100974:	ff 70 04             	push   0x4(%eax)
+f0100977:	e8 df 5e 00 00       	call   f010685b <strcmp>
+f010097c:	83 c4 10             	add    $0x10,%esp
+f010097f:	85 c0                	test   %eax,%eax
+f0100981:	74 48                	je     f01009cb <mon_locks+0x71>
+		spin_stats_reset();
+		return 0;
+	}
+
+	n = MIN(nspinlocks, NSPINLOCK);
+f0100983:	8b 15 a0 90 6a f0    	mov    0xf06a90a0,%edx
+f0100989:	b8 20 00 00 00       	mov    $0x20,%eax
+f010098e:	39 c2                	cmp    %eax,%edx
+f0100990:	0f 46 c2             	cmovbe %edx,%eax
+f0100993:	89 45 bc             	mov    %eax,-0x44(%ebp)
+	cprintf("%-14s %10s %10s %12s %12s %12s\n", "lock", "acquired",
+f0100996:	83 ec 04             	sub    $0x4,%esp
+f0100999:	68 df 85 10 f0       	push   $0xf01085df
+f010099e:	68 e8 85 10 f0       	push   $0xf01085e8
+f01009a3:	68 f1 85 10 f0       	push   $0xf01085f1
+f01009a8:	68 fa 85 10 f0       	push   $0xf01085fa
+f01009ad:	68 04 86 10 f0       	push   $0xf0108604
+f01009b2:	68 26 96 10 f0       	push   $0xf0109626
+f01009b7:	68 00 88 10 f0       	push   $0xf0108800
+f01009bc:	e8 19 3a 00 00       	call   f01043da <cprintf>
+		"contended", "spin/acq", "hold/acq", "max hold");
+	for (i = 0; i < n; i++) {
+f01009c1:	83 c4 20             	add    $0x20,%esp
+f01009c4:	be 00 00 00 00       	mov    $0x0,%esi
+f01009c9:	eb 15                	jmp    f01009e0 <mon_locks+0x86>
+		spin_stats_reset();
+f01009cb:	e8 6c 67 00 00       	call   f010713c <spin_stats_reset>
+	}
+#else
+	cprintf("Build with DEBUG_SPINLOCK to collect lock statistics\n");
+#endif
+	return 0;
+}
+f01009d0:	b8 00 00 00 00       	mov    $0x0,%eax
+f01009d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01009d8:	5b                   	pop    %ebx
+f01009d9:	5e                   	pop    %esi
+f01009da:	5f                   	pop    %edi
+f01009db:	5d                   	pop    %ebp
+f01009dc:	c3                   	ret
+	for (i = 0; i < n; i++) {
+f01009dd:	83 c6 01             	add    $0x1,%esi
+f01009e0:	8b 45 bc             	mov    -0x44(%ebp),%eax
+f01009e3:	39 c6                	cmp    %eax,%esi
+f01009e5:	74 e9                	je     f01009d0 <mon_locks+0x76>
+		lk = spinlocks[i];
+f01009e7:	8b 1c b5 20 90 6a f0 	mov    -0xf956fe0(,%esi,4),%ebx
+		if (!lk->acquisitions)
+f01009ee:	8b 7b 38             	mov    0x38(%ebx),%edi
+f01009f1:	85 ff                	test   %edi,%edi
+f01009f3:	74 e8                	je     f01009dd <mon_locks+0x83>
+			lk->hold_cycles / lk->acquisitions, lk->max_hold);
+f01009f5:	ba 00 00 00 00       	mov    $0x0,%edx
+		cprintf("%-14s %10u %10u %12llu %12llu %12llu\n", lk->name,
+f01009fa:	83 ec 08             	sub    $0x8,%esp
+f01009fd:	ff 73 54             	push   0x54(%ebx)
+f0100a00:	ff 73 50             	push   0x50(%ebx)
+f0100a03:	89 7d c0             	mov    %edi,-0x40(%ebp)
+f0100a06:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+f0100a09:	52                   	push   %edx
+f0100a0a:	57                   	push   %edi
+f0100a0b:	ff 73 4c             	push   0x4c(%ebx)
+f0100a0e:	ff 73 48             	push   0x48(%ebx)
+f0100a11:	e8 8a 74 00 00       	call   f0107ea0 <__udivdi3>
+f0100a16:	83 c4 10             	add    $0x10,%esp
+f0100a19:	52                   	push   %edx
+f0100a1a:	50                   	push   %eax
+f0100a1b:	83 ec 08             	sub    $0x8,%esp
+f0100a1e:	ff 75 c4             	push   -0x3c(%ebp)
+f0100a21:	ff 75 c0             	push   -0x40(%ebp)
+f0100a24:	ff 73 44             	push   0x44(%ebx)
+f0100a27:	ff 73 40             	push   0x40(%ebx)
+f0100a2a:	e8 71 74 00 00       	call   f0107ea0 <__udivdi3>
+f0100a2f:	83 c4 18             	add    $0x18,%esp
+f0100a32:	52                   	push   %edx
+f0100a33:	50                   	push   %eax
+f0100a34:	ff 73 3c             	push   0x3c(%ebx)
+f0100a37:	57                   	push   %edi
+f0100a38:	ff 73 0c             	push   0xc(%ebx)
+f0100a3b:	68 20 88 10 f0       	push   $0xf0108820
+f0100a40:	e8 95 39 00 00       	call   f01043da <cprintf>
+		if (lk->max_pcs[0] && debuginfo_eip(lk->max_pcs[0], &info) >= 0)
+f0100a45:	8b 43 58             	mov    0x58(%ebx),%eax
+f0100a48:	83 c4 30             	add    $0x30,%esp
+f0100a4b:	85 c0                	test   %eax,%eax
+f0100a4d:	74 8e                	je     f01009dd <mon_locks+0x83>
+f0100a4f:	83 ec 08             	sub    $0x8,%esp
+f0100a52:	8d 4d d0             	lea    -0x30(%ebp),%ecx
+f0100a55:	51                   	push   %ecx
+f0100a56:	50                   	push   %eax
+f0100a57:	e8 02 54 00 00       	call   f0105e5e <debuginfo_eip>
+f0100a5c:	83 c4 10             	add    $0x10,%esp
+f0100a5f:	85 c0                	test   %eax,%eax
+f0100a61:	0f 88 76 ff ff ff    	js     f01009dd <mon_locks+0x83>
+			cprintf("  longest hold taken at %s:%d: %.*s+%x\n",
+f0100a67:	83 ec 08             	sub    $0x8,%esp
+f0100a6a:	8b 43 58             	mov    0x58(%ebx),%eax
+f0100a6d:	2b 45 e0             	sub    -0x20(%ebp),%eax
+f0100a70:	50                   	push   %eax
+f0100a71:	ff 75 d8             	push   -0x28(%ebp)
+f0100a74:	ff 75 dc             	push   -0x24(%ebp)
+f0100a77:	ff 75 d4             	push   -0x2c(%ebp)
+f0100a7a:	ff 75 d0             	push   -0x30(%ebp)
+f0100a7d:	68 48 88 10 f0       	push   $0xf0108848
+f0100a82:	e8 53 39 00 00       	call   f01043da <cprintf>
+f0100a87:	83 c4 20             	add    $0x20,%esp
+f0100a8a:	e9 4e ff ff ff       	jmp    f01009dd <mon_locks+0x83>
+
+f0100a8f <mon_backtrace>:
+int
+mon_backtrace(int argc, char **argv, struct Trapframe *tf)
+{
+	// Your code here.
+	return 0;
+}
+f0100a8f:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100a94:	c3                   	ret
+
+f0100a95 <monitor>:
+	return 0;
+}
+
+void
+monitor(struct Trapframe *tf)
+{
+f0100a95:	55                   	push   %ebp
+f0100a96:	89 e5                	mov    %esp,%ebp
+f0100a98:	57                   	push   %edi
+f0100a99:	56                   	push   %esi
+f0100a9a:	53                   	push   %ebx
+f0100a9b:	83 ec 58             	sub    $0x58,%esp
+	char *buf;
+
+	cprintf("Welcome to the JOS kernel monitor!\n");
+f0100a9e:	68 70 88 10 f0       	push   $0xf0108870
+f0100aa3:	e8 32 39 00 00       	call   f01043da <cprintf>
+	cprintf("Type 'help' for a list of commands.\n");
+f0100aa8:	c7 04 24 94 88 10 f0 	movl   $0xf0108894,(%esp)
+f0100aaf:	e8 26 39 00 00       	call   f01043da <cprintf>
+
+	if (tf != NULL)
+f0100ab4:	83 c4 10             	add    $0x10,%esp
+f0100ab7:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+f0100abb:	74 57                	je     f0100b14 <monitor+0x7f>
+		print_trapframe(tf);
+f0100abd:	83 ec 0c             	sub    $0xc,%esp
+f0100ac0:	ff 75 08             	push   0x8(%ebp)
+f0100ac3:	e8 97 40 00 00       	call   f0104b5f <print_trapframe>
+f0100ac8:	83 c4 10             	add    $0x10,%esp
+f0100acb:	eb 47                	jmp    f0100b14 <monitor+0x7f>
+		while (*buf && strchr(WHITESPACE, *buf))
+f0100acd:	83 ec 08             	sub    $0x8,%esp
+f0100ad0:	0f be c0             	movsbl %al,%eax
+f0100ad3:	50                   	push   %eax
+f0100ad4:	68 11 86 10 f0       	push   $0xf0108611
+f0100ad9:	e8 de 5d 00 00       	call   f01068bc <strchr>
+f0100ade:	83 c4 10             	add    $0x10,%esp
+f0100ae1:	85 c0                	test   %eax,%eax
+f0100ae3:	74 0a                	je     f0100aef <monitor+0x5a>
+			*buf++ = 0;
+f0100ae5:	c6 03 00             	movb   $0x0,(%ebx)
+f0100ae8:	89 f7                	mov    %esi,%edi
+f0100aea:	8d 5b 01             	lea    0x1(%ebx),%ebx
+f0100aed:	eb 6b                	jmp    f0100b5a <monitor+0xc5>
+		if (*buf == 0)
+f0100aef:	80 3b 00             	cmpb   $0x0,(%ebx)
+f0100af2:	74 73                	je     f0100b67 <monitor+0xd2>
+		if (argc == MAXARGS-1) {
+f0100af4:	83 fe 0f             	cmp    $0xf,%esi
+f0100af7:	74 09                	je     f0100b02 <monitor+0x6d>
+		argv[argc++] = buf;
+f0100af9:	8d 7e 01             	lea    0x1(%esi),%edi
+f0100afc:	89 5c b5 a8          	mov    %ebx,-0x58(%ebp,%esi,4)
+		while (*buf && !strchr(WHITESPACE, *buf))
+f0100b00:	eb 39                	jmp    f0100b3b <monitor+0xa6>
+			cprintf("Too many arguments (max %d)\n", MAXARGS);
+f0100b02:	83 ec 08             	sub    $0x8,%esp
+f0100b05:	6a 10                	push   $0x10
+f0100b07:	68 16 86 10 f0       	push   $0xf0108616
+f0100b0c:	e8 c9 38 00 00       	call   f01043da <cprintf>
+			return 0;
+f0100b11:	83 c4 10             	add    $0x10,%esp
+
+	while (1) {
+		buf = readline("K> ");
+f0100b14:	83 ec 0c             	sub    $0xc,%esp
+f0100b17:	68 0d 86 10 f0       	push   $0xf010860d
+f0100b1c:	e8 60 5b 00 00       	call   f0106681 <readline>
+f0100b21:	89 c3                	mov    %eax,%ebx
+		if (buf != NULL)
+f0100b23:	83 c4 10             	add    $0x10,%esp
+f0100b26:	85 c0                	test   %eax,%eax
+f0100b28:	74 ea                	je     f0100b14 <monitor+0x7f>
+	argv[argc] = 0;
+f0100b2a:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%ebp)
+	argc = 0;
+f0100b31:	be 00 00 00 00       	mov    $0x0,%esi
+f0100b36:	eb 24                	jmp    f0100b5c <monitor+0xc7>
+			buf++;
+f0100b38:	83 c3 01             	add    $0x1,%ebx
+		while (*buf && !strchr(WHITESPACE, *buf))
+f0100b3b:	0f b6 03             	movzbl (%ebx),%eax
+f0100b3e:	84 c0                	test   %al,%al
+f0100b40:	74 18                	je     f0100b5a <monitor+0xc5>
+f0100b42:	83 ec 08             	sub    $0x8,%esp
+f0100b45:	0f be c0             	movsbl %al,%eax
+f0100b48:	50                   	push   %eax
+f0100b49:	68 11 86 10 f0       	push   $0xf0108611
+f0100b4e:	e8 69 5d 00 00       	call   f01068bc <strchr>
+f0100b53:	83 c4 10             	add    $0x10,%esp
+f0100b56:	85 c0                	test   %eax,%eax
+f0100b58:	74 de                	je     f0100b38 <monitor+0xa3>
+			*buf++ = 0;
+f0100b5a:	89 fe                	mov    %edi,%esi
+		while (*buf && strchr(WHITESPACE, *buf))
+f0100b5c:	0f b6 03             	movzbl (%ebx),%eax
+f0100b5f:	84 c0                	test   %al,%al
+f0100b61:	0f 85 66 ff ff ff    	jne    f0100acd <monitor+0x38>
+	argv[argc] = 0;
+f0100b67:	c7 44 b5 a8 00 00 00 	movl   $0x0,-0x58(%ebp,%esi,4)
+f0100b6e:	00 
+	if (argc == 0)
+f0100b6f:	85 f6                	test   %esi,%esi
+f0100b71:	74 a1                	je     f0100b14 <monitor+0x7f>
+	for (i = 0; i < ARRAY_SIZE(commands); i++) {
+f0100b73:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (strcmp(argv[0], commands[i].name) == 0)
+f0100b78:	83 ec 08             	sub    $0x8,%esp
+f0100b7b:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+f0100b7e:	ff 34 85 c0 88 10 f0 	push   -0xfef7740(,%eax,4)
+f0100b85:	ff 75 a8             	push   -0x58(%ebp)
+f0100b88:	e8 ce 5c 00 00       	call   f010685b <strcmp>
+f0100b8d:	83 c4 10             	add    $0x10,%esp
+f0100b90:	85 c0                	test   %eax,%eax
+f0100b92:	74 20                	je     f0100bb4 <monitor+0x11f>
+	for (i = 0; i < ARRAY_SIZE(commands); i++) {
+f0100b94:	83 c3 01             	add    $0x1,%ebx
+f0100b97:	83 fb 04             	cmp    $0x4,%ebx
+f0100b9a:	75 dc                	jne    f0100b78 <monitor+0xe3>
+	cprintf("Unknown command '%s'\n", argv[0]);
+f0100b9c:	83 ec 08             	sub    $0x8,%esp
+f0100b9f:	ff 75 a8             	push   -0x58(%ebp)
+f0100ba2:	68 33 86 10 f0       	push   $0xf0108633
+f0100ba7:	e8 2e 38 00 00       	call   f01043da <cprintf>
+	return 0;
+f0100bac:	83 c4 10             	add    $0x10,%esp
+f0100baf:	e9 60 ff ff ff       	jmp    f0100b14 <monitor+0x7f>
+			return commands[i].func(argc, argv, tf);
+f0100bb4:	83 ec 04             	sub    $0x4,%esp
+f0100bb7:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+f0100bba:	ff 75 08             	push   0x8(%ebp)
+f0100bbd:	8d 55 a8             	lea    -0x58(%ebp),%edx
+f0100bc0:	52                   	push   %edx
+f0100bc1:	56                   	push   %esi
+f0100bc2:	ff 14 85 c8 88 10 f0 	call   *-0xfef7738(,%eax,4)
+			if (runcmd(buf, tf) < 0)
+f0100bc9:	83 c4 10             	add    $0x10,%esp
+f0100bcc:	85 c0                	test   %eax,%eax
+f0100bce:	0f 89 40 ff ff ff    	jns    f0100b14 <monitor+0x7f>
+				break;
+	}
+}
+f0100bd4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0100bd7:	5b                   	pop    %ebx
+f0100bd8:	5e                   	pop    %esi
+f0100bd9:	5f                   	pop    %edi
+f0100bda:	5d                   	pop    %ebp
+f0100bdb:	c3                   	ret
+
+f0100bdc <nvram_read>:
+// --------------------------------------------------------------
+// Detect machine's physical memory setup.
+// --------------------------------------------------------------
+
+static int
+nvram_read(int r) {
+f0100bdc:	55                   	push   %ebp
+f0100bdd:	89 e5                	mov    %esp,%ebp
+f0100bdf:	56                   	push   %esi
+f0100be0:	53                   	push   %ebx
+f0100be1:	89 c3                	mov    %eax,%ebx
+    return mc146818_read(r) | (mc146818_read(r + 1) << 8);
+f0100be3:	83 ec 0c             	sub    $0xc,%esp
+f0100be6:	50                   	push   %eax
+f0100be7:	e8 f9 35 00 00       	call   f01041e5 <mc146818_read>
+f0100bec:	89 c6                	mov    %eax,%esi
+f0100bee:	83 c3 01             	add    $0x1,%ebx
+f0100bf1:	89 1c 24             	mov    %ebx,(%esp)
+f0100bf4:	e8 ec 35 00 00       	call   f01041e5 <mc146818_read>
+f0100bf9:	c1 e0 08             	shl    $0x8,%eax
+f0100bfc:	09 f0                	or     %esi,%eax
+}
+f0100bfe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0100c01:	5b                   	pop    %ebx
+f0100c02:	5e                   	pop    %esi
+f0100c03:	5d                   	pop    %ebp
+f0100c04:	c3                   	ret
+
+f0100c05 <boot_alloc>:
+// This function may ONLY be used during initialization,
+// before the page_free_list list has been set up.
+// Note that when this function is called, we are still using entry_pgdir,
+// which only maps the first 4MB of physical memory.
+static void *
+boot_alloc(uint32_t n) {
+f0100c05:	55                   	push   %ebp
+f0100c06:	89 e5                	mov    %esp,%ebp
+f0100c08:	53                   	push   %ebx
+f0100c09:	83 ec 04             	sub    $0x4,%esp
+    // Initialize nextfree if this is the first time.
+    // 'end' is a magic symbol automatically generated by the linker,
+    // which points to the end of the kernel's bss segment:
+    // the first virtual address that the linker did *not* assign
+    // to any kernel code or global variables.
+    if (!nextfree) {
+f0100c0c:	83 3d 38 42 62 f0 00 	cmpl   $0x0,0xf0624238
+f0100c13:	74 38                	je     f0100c4d <boot_alloc+0x48>
+    // Allocate a chunk large enough to hold 'n' bytes, then update
+    // nextfree.  Make sure nextfree is kept aligned
+    // to a multiple of PGSIZE.
+    //
+    // LAB 2: Your code here.
+    result = nextfree;
+f0100c15:	8b 15 38 42 62 f0    	mov    0xf0624238,%edx
+    nextfree = KADDR(PADDR(ROUNDUP(nextfree + n, PGSIZE)));
+f0100c1b:	8d 84 02 ff 0f 00 00 	lea    0xfff(%edx,%eax,1),%eax
+f0100c22:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if ((uint32_t)kva < KERNBASE)
+f0100c27:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0100c2c:	76 32                	jbe    f0100c60 <boot_alloc+0x5b>
+	return (physaddr_t)kva - KERNBASE;
+f0100c2e:	8d 88 00 00 00 10    	lea    0x10000000(%eax),%ecx
+	if (PGNUM(pa) >= npages)
+f0100c34:	89 cb                	mov    %ecx,%ebx
+f0100c36:	c1 eb 0c             	shr    $0xc,%ebx
+f0100c39:	3b 1d c8 76 66 f0    	cmp    0xf06676c8,%ebx
+f0100c3f:	73 34                	jae    f0100c75 <boot_alloc+0x70>
+f0100c41:	a3 38 42 62 f0       	mov    %eax,0xf0624238
+    return result;
+}
+f0100c46:	89 d0                	mov    %edx,%eax
+f0100c48:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0100c4b:	c9                   	leave
+f0100c4c:	c3                   	ret
+        nextfree = ROUNDUP((char *) end, PGSIZE);
+f0100c4d:	ba df 9c 76 f0       	mov    $0xf0769cdf,%edx
+f0100c52:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+f0100c58:	89 15 38 42 62 f0    	mov    %edx,0xf0624238
+f0100c5e:	eb b5                	jmp    f0100c15 <boot_alloc+0x10>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0100c60:	50                   	push   %eax
+f0100c61:	68 88 82 10 f0       	push   $0xf0108288
+f0100c66:	68 8a 00 00 00       	push   $0x8a
+f0100c6b:	68 f9 92 10 f0       	push   $0xf01092f9
+f0100c70:	e8 dd f3 ff ff       	call   f0100052 <_panic>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0100c75:	51                   	push   %ecx
+f0100c76:	68 64 82 10 f0       	push   $0xf0108264
+f0100c7b:	68 8a 00 00 00       	push   $0x8a
+f0100c80:	68 f9 92 10 f0       	push   $0xf01092f9
+f0100c85:	e8 c8 f3 ff ff       	call   f0100052 <_panic>
+
+f0100c8a <check_va2pa>:
+
+static physaddr_t
+check_va2pa(pde_t *pgdir, uintptr_t va) {
+    pte_t *p;
+
+    pgdir = &pgdir[PDX(va)];
+f0100c8a:	89 d1                	mov    %edx,%ecx
+f0100c8c:	c1 e9 16             	shr    $0x16,%ecx
+    if (!(*pgdir & PTE_P))
+f0100c8f:	8b 04 88             	mov    (%eax,%ecx,4),%eax
+f0100c92:	a8 01                	test   $0x1,%al
+f0100c94:	74 51                	je     f0100ce7 <check_va2pa+0x5d>
+        return ~0;
+    p = (pte_t *) KADDR(PTE_ADDR(*pgdir));
+f0100c96:	89 c1                	mov    %eax,%ecx
+f0100c98:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	if (PGNUM(pa) >= npages)
+f0100c9e:	c1 e8 0c             	shr    $0xc,%eax
+f0100ca1:	3b 05 c8 76 66 f0    	cmp    0xf06676c8,%eax
+f0100ca7:	73 23                	jae    f0100ccc <check_va2pa+0x42>
+    if (!(p[PTX(va)] & PTE_P))
+f0100ca9:	c1 ea 0c             	shr    $0xc,%edx
+f0100cac:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+f0100cb2:	8b 94 91 00 00 00 f0 	mov    -0x10000000(%ecx,%edx,4),%edx
+        return ~0;
+    return PTE_ADDR(p[PTX(va)]);
+f0100cb9:	89 d0                	mov    %edx,%eax
+f0100cbb:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f0100cc0:	f6 c2 01             	test   $0x1,%dl
+f0100cc3:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+f0100cc8:	0f 44 c2             	cmove  %edx,%eax
+f0100ccb:	c3                   	ret
+check_va2pa(pde_t *pgdir, uintptr_t va) {
+f0100ccc:	55                   	push   %ebp
+f0100ccd:	89 e5                	mov    %esp,%ebp
+f0100ccf:	83 ec 08             	sub    $0x8,%esp
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0100cd2:	51                   	push   %ecx
+f0100cd3:	68 64 82 10 f0       	push   $0xf0108264
+f0100cd8:	68 b4 03 00 00       	push   $0x3b4
+f0100cdd:	68 f9 92 10 f0       	push   $0xf01092f9
+f0100ce2:	e8 6b f3 ff ff       	call   f0100052 <_panic>
+        return ~0;
+f0100ce7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+f0100cec:	c3                   	ret
+
+f0100ced <check_page_free_list>:
+check_page_free_list(bool only_low_memory) {
+f0100ced:	55                   	push   %ebp
+f0100cee:	89 e5                	mov    %esp,%ebp
+f0100cf0:	57                   	push   %edi
+f0100cf1:	56                   	push   %esi
+f0100cf2:	53                   	push   %ebx
+f0100cf3:	83 ec 2c             	sub    $0x2c,%esp
+    unsigned pdx_limit = only_low_memory ? 1 : NPDENTRIES;
+f0100cf6:	84 c0                	test   %al,%al
+f0100cf8:	0f 85 82 02 00 00    	jne    f0100f80 <check_page_free_list+0x293>
+    if (!page_free_list)
+f0100cfe:	83 3d 40 42 62 f0 00 	cmpl   $0x0,0xf0624240
+f0100d05:	74 0a                	je     f0100d11 <check_page_free_list+0x24>
+    unsigned pdx_limit = only_low_memory ? 1 : NPDENTRIES;
+f0100d07:	be 00 04 00 00       	mov    $0x400,%esi
+f0100d0c:	e9 ca 02 00 00       	jmp    f0100fdb <check_page_free_list+0x2ee>
+        panic("'page_free_list' is a null pointer!");
+f0100d11:	83 ec 04             	sub    $0x4,%esp
+f0100d14:	68 f0 88 10 f0       	push   $0xf01088f0
+f0100d19:	68 e3 02 00 00       	push   $0x2e3
+f0100d1e:	68 f9 92 10 f0       	push   $0xf01092f9
+f0100d23:	e8 2a f3 ff ff       	call   f0100052 <_panic>
+f0100d28:	50                   	push   %eax
+f0100d29:	68 64 82 10 f0       	push   $0xf0108264
+f0100d2e:	6a 5a                	push   $0x5a
+f0100d30:	68 05 93 10 f0       	push   $0xf0109305
+f0100d35:	e8 18 f3 ff ff       	call   f0100052 <_panic>
+    for (pp = page_free_list; pp; pp = pp->pp_link)
+f0100d3a:	8b 1b                	mov    (%ebx),%ebx
+f0100d3c:	85 db                	test   %ebx,%ebx
+f0100d3e:	74 41                	je     f0100d81 <check_page_free_list+0x94>
+void	user_mem_assert(struct Env *env, const void *va, size_t len, int perm);
+
+static inline physaddr_t
+page2pa(struct PageInfo *pp)
+{
+	return (pp - pages) << PGSHIFT;
+f0100d40:	89 d8                	mov    %ebx,%eax
+f0100d42:	2b 05 d0 76 66 f0    	sub    0xf06676d0,%eax
+f0100d48:	c1 f8 03             	sar    $0x3,%eax
+f0100d4b:	c1 e0 0c             	shl    $0xc,%eax
+        if (PDX(page2pa(pp)) < pdx_limit)
+f0100d4e:	89 c2                	mov    %eax,%edx
+f0100d50:	c1 ea 16             	shr    $0x16,%edx
+f0100d53:	39 f2                	cmp    %esi,%edx
+f0100d55:	73 e3                	jae    f0100d3a <check_page_free_list+0x4d>
+	if (PGNUM(pa) >= npages)
+f0100d57:	89 c2                	mov    %eax,%edx
+f0100d59:	c1 ea 0c             	shr    $0xc,%edx
+f0100d5c:	3b 15 c8 76 66 f0    	cmp    0xf06676c8,%edx
+f0100d62:	73 c4                	jae    f0100d28 <check_page_free_list+0x3b>
+            memset(page2kva(pp), 0x97, 128);
+f0100d64:	83 ec 04             	sub    $0x4,%esp
+f0100d67:	68 80 00 00 00       	push   $0x80
+f0100d6c:	68 97 00 00 00       	push   $0x97
+	return (void *)(pa + KERNBASE);
+f0100d71:	2d 00 00 00 10       	sub    $0x10000000,%eax
+f0100d76:	50                   	push   %eax
+f0100d77:	e8 7f 5b 00 00       	call   f01068fb <memset>
+f0100d7c:	83 c4 10             	add    $0x10,%esp
+f0100d7f:	eb b9                	jmp    f0100d3a <check_page_free_list+0x4d>
+    first_free_page = (char *) boot_alloc(0);
+f0100d81:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100d86:	e8 7a fe ff ff       	call   f0100c05 <boot_alloc>
+f0100d8b:	89 45 c8             	mov    %eax,-0x38(%ebp)
+    for (pp = page_free_list; pp; pp = pp->pp_link) {
+f0100d8e:	8b 15 40 42 62 f0    	mov    0xf0624240,%edx
+        assert(pp >= pages);
+f0100d94:	8b 0d d0 76 66 f0    	mov    0xf06676d0,%ecx
+        assert(pp < pages + npages);
+f0100d9a:	a1 c8 76 66 f0       	mov    0xf06676c8,%eax
+f0100d9f:	89 45 cc             	mov    %eax,-0x34(%ebp)
+f0100da2:	8d 34 c1             	lea    (%ecx,%eax,8),%esi
+    int nfree_basemem = 0, nfree_extmem = 0;
+f0100da5:	bf 00 00 00 00       	mov    $0x0,%edi
+f0100daa:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+f0100dad:	89 7d d0             	mov    %edi,-0x30(%ebp)
+    for (pp = page_free_list; pp; pp = pp->pp_link) {
+f0100db0:	e9 fe 00 00 00       	jmp    f0100eb3 <check_page_free_list+0x1c6>
+        assert(pp >= pages);
+f0100db5:	68 13 93 10 f0       	push   $0xf0109313
+f0100dba:	68 1f 93 10 f0       	push   $0xf010931f
+f0100dbf:	68 fd 02 00 00       	push   $0x2fd
+f0100dc4:	68 f9 92 10 f0       	push   $0xf01092f9
+f0100dc9:	e8 84 f2 ff ff       	call   f0100052 <_panic>
+        assert(pp < pages + npages);
+f0100dce:	68 34 93 10 f0       	push   $0xf0109334
+f0100dd3:	68 1f 93 10 f0       	push   $0xf010931f
+f0100dd8:	68 fe 02 00 00       	push   $0x2fe
+f0100ddd:	68 f9 92 10 f0       	push   $0xf01092f9
+f0100de2:	e8 6b f2 ff ff       	call   f0100052 <_panic>
+        assert(((char *) pp - (char *) pages) % sizeof(*pp) == 0);
+f0100de7:	68 14 89 10 f0       	push   $0xf0108914
+f0100dec:	68 1f 93 10 f0       	push   $0xf010931f
+f0100df1:	68 ff 02 00 00       	push   $0x2ff
+f0100df6:	68 f9 92 10 f0       	push   $0xf01092f9
+f0100dfb:	e8 52 f2 ff ff       	call   f0100052 <_panic>
+        assert(page2pa(pp) != 0);
+f0100e00:	68 48 93 10 f0       	push   $0xf0109348
+f0100e05:	68 1f 93 10 f0       	push   $0xf010931f
+f0100e0a:	68 02 03 00 00       	push   $0x302
+f0100e0f:	68 f9 92 10 f0       	push   $0xf01092f9
+f0100e14:	e8 39 f2 ff ff       	call   f0100052 <_panic>
+        assert(page2pa(pp) != IOPHYSMEM);
+f0100e19:	68 59 93 10 f0       	push   $0xf0109359
+f0100e1e:	68 1f 93 10 f0       	push   $0xf010931f
+f0100e23:	68 03 03 00 00       	push   $0x303
+f0100e28:	68 f9 92 10 f0       	push   $0xf01092f9
+f0100e2d:	e8 20 f2 ff ff       	call   f0100052 <_panic>
+        assert(page2pa(pp) != EXTPHYSMEM - PGSIZE);
+f0100e32:	68 48 89 10 f0       	push   $0xf0108948
+f0100e37:	68 1f 93 10 f0       	push   $0xf010931f
+f0100e3c:	68 04 03 00 00       	push   $0x304
+f0100e41:	68 f9 92 10 f0       	push   $0xf01092f9
+f0100e46:	e8 07 f2 ff ff       	call   f0100052 <_panic>
+        assert(page2pa(pp) != EXTPHYSMEM);
+f0100e4b:	68 72 93 10 f0       	push   $0xf0109372
+f0100e50:	68 1f 93 10 f0       	push   $0xf010931f
+f0100e55:	68 05 03 00 00       	push   $0x305
+f0100e5a:	68 f9 92 10 f0       	push   $0xf01092f9
+f0100e5f:	e8 ee f1 ff ff       	call   f0100052 <_panic>
+	if (PGNUM(pa) >= npages)
+f0100e64:	89 c3                	mov    %eax,%ebx
+f0100e66:	c1 eb 0c             	shr    $0xc,%ebx
+f0100e69:	8b 7d cc             	mov    -0x34(%ebp),%edi
+f0100e6c:	39 fb                	cmp    %edi,%ebx
+f0100e6e:	73 12                	jae    f0100e82 <check_page_free_list+0x195>
+	return (void *)(pa + KERNBASE);
+f0100e70:	2d 00 00 00 10       	sub    $0x10000000,%eax
+        assert(page2pa(pp) < EXTPHYSMEM || (char *) page2kva(pp) >= first_free_page);
+f0100e75:	8b 7d c8             	mov    -0x38(%ebp),%edi
+f0100e78:	39 f8                	cmp    %edi,%eax
+f0100e7a:	72 18                	jb     f0100e94 <check_page_free_list+0x1a7>
+            ++nfree_extmem;
+f0100e7c:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+f0100e80:	eb 2f                	jmp    f0100eb1 <check_page_free_list+0x1c4>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0100e82:	50                   	push   %eax
+f0100e83:	68 64 82 10 f0       	push   $0xf0108264
+f0100e88:	6a 5a                	push   $0x5a
+f0100e8a:	68 05 93 10 f0       	push   $0xf0109305
+f0100e8f:	e8 be f1 ff ff       	call   f0100052 <_panic>
+        assert(page2pa(pp) < EXTPHYSMEM || (char *) page2kva(pp) >= first_free_page);
+f0100e94:	68 6c 89 10 f0       	push   $0xf010896c
+f0100e99:	68 1f 93 10 f0       	push   $0xf010931f
+f0100e9e:	68 06 03 00 00       	push   $0x306
+f0100ea3:	68 f9 92 10 f0       	push   $0xf01092f9
+f0100ea8:	e8 a5 f1 ff ff       	call   f0100052 <_panic>
+            ++nfree_basemem;
+f0100ead:	83 45 d4 01          	addl   $0x1,-0x2c(%ebp)
+    for (pp = page_free_list; pp; pp = pp->pp_link) {
+f0100eb1:	8b 12                	mov    (%edx),%edx
+f0100eb3:	85 d2                	test   %edx,%edx
+f0100eb5:	74 74                	je     f0100f2b <check_page_free_list+0x23e>
+        assert(pp >= pages);
+f0100eb7:	39 ca                	cmp    %ecx,%edx
+f0100eb9:	0f 82 f6 fe ff ff    	jb     f0100db5 <check_page_free_list+0xc8>
+        assert(pp < pages + npages);
+f0100ebf:	39 f2                	cmp    %esi,%edx
+f0100ec1:	0f 83 07 ff ff ff    	jae    f0100dce <check_page_free_list+0xe1>
+        assert(((char *) pp - (char *) pages) % sizeof(*pp) == 0);
+f0100ec7:	89 d0                	mov    %edx,%eax
+f0100ec9:	29 c8                	sub    %ecx,%eax
+f0100ecb:	a8 07                	test   $0x7,%al
+f0100ecd:	0f 85 14 ff ff ff    	jne    f0100de7 <check_page_free_list+0xfa>
+	return (pp - pages) << PGSHIFT;
+f0100ed3:	c1 f8 03             	sar    $0x3,%eax
+        assert(page2pa(pp) != 0);
+f0100ed6:	c1 e0 0c             	shl    $0xc,%eax
+f0100ed9:	0f 84 21 ff ff ff    	je     f0100e00 <check_page_free_list+0x113>
+        assert(page2pa(pp) != IOPHYSMEM);
+f0100edf:	3d 00 00 0a 00       	cmp    $0xa0000,%eax
+f0100ee4:	0f 84 2f ff ff ff    	je     f0100e19 <check_page_free_list+0x12c>
+        assert(page2pa(pp) != EXTPHYSMEM - PGSIZE);
+f0100eea:	3d 00 f0 0f 00       	cmp    $0xff000,%eax
+f0100eef:	0f 84 3d ff ff ff    	je     f0100e32 <check_page_free_list+0x145>
+        assert(page2pa(pp) != EXTPHYSMEM);
+f0100ef5:	3d 00 00 10 00       	cmp    $0x100000,%eax
+f0100efa:	0f 84 4b ff ff ff    	je     f0100e4b <check_page_free_list+0x15e>
+        assert(page2pa(pp) < EXTPHYSMEM || (char *) page2kva(pp) >= first_free_page);
+f0100f00:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+f0100f05:	0f 87 59 ff ff ff    	ja     f0100e64 <check_page_free_list+0x177>
+        assert(page2pa(pp) != MPENTRY_PADDR);
+f0100f0b:	3d 00 70 00 00       	cmp    $0x7000,%eax
+f0100f10:	75 9b                	jne    f0100ead <check_page_free_list+0x1c0>
+f0100f12:	68 8c 93 10 f0       	push   $0xf010938c
+f0100f17:	68 1f 93 10 f0       	push   $0xf010931f
+f0100f1c:	68 08 03 00 00       	push   $0x308
+f0100f21:	68 f9 92 10 f0       	push   $0xf01092f9
+f0100f26:	e8 27 f1 ff ff       	call   f0100052 <_panic>
+    assert(nfree_basemem > 0);
+f0100f2b:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+f0100f2e:	8b 7d d0             	mov    -0x30(%ebp),%edi
+f0100f31:	85 db                	test   %ebx,%ebx
+f0100f33:	7e 19                	jle    f0100f4e <check_page_free_list+0x261>
+    assert(nfree_extmem > 0);
+f0100f35:	85 ff                	test   %edi,%edi
+f0100f37:	7e 2e                	jle    f0100f67 <check_page_free_list+0x27a>
+    cprintf("check_page_free_list() succeeded!\n");
+f0100f39:	83 ec 0c             	sub    $0xc,%esp
+f0100f3c:	68 b4 89 10 f0       	push   $0xf01089b4
+f0100f41:	e8 94 34 00 00       	call   f01043da <cprintf>
+}
+f0100f46:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0100f49:	5b                   	pop    %ebx
+f0100f4a:	5e                   	pop    %esi
+f0100f4b:	5f                   	pop    %edi
+f0100f4c:	5d                   	pop    %ebp
+f0100f4d:	c3                   	ret
+    assert(nfree_basemem > 0);
+f0100f4e:	68 a9 93 10 f0       	push   $0xf01093a9
+f0100f53:	68 1f 93 10 f0       	push   $0xf010931f
+f0100f58:	68 10 03 00 00       	push   $0x310
+f0100f5d:	68 f9 92 10 f0       	push   $0xf01092f9
+f0100f62:	e8 eb f0 ff ff       	call   f0100052 <_panic>
+    assert(nfree_extmem > 0);
+f0100f67:	68 bb 93 10 f0       	push   $0xf01093bb
+f0100f6c:	68 1f 93 10 f0       	push   $0xf010931f
+f0100f71:	68 11 03 00 00       	push   $0x311
+f0100f76:	68 f9 92 10 f0       	push   $0xf01092f9
+f0100f7b:	e8 d2 f0 ff ff       	call   f0100052 <_panic>
+    if (!page_free_list)
+f0100f80:	a1 40 42 62 f0       	mov    0xf0624240,%eax
+f0100f85:	85 c0                	test   %eax,%eax
+f0100f87:	0f 84 84 fd ff ff    	je     f0100d11 <check_page_free_list+0x24>
+        struct PageInfo **tp[2] = {&pp1, &pp2};
+f0100f8d:	8d 55 d8             	lea    -0x28(%ebp),%edx
+f0100f90:	89 55 e0             	mov    %edx,-0x20(%ebp)
+f0100f93:	8d 55 dc             	lea    -0x24(%ebp),%edx
+f0100f96:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+f0100f99:	89 c2                	mov    %eax,%edx
+f0100f9b:	2b 15 d0 76 66 f0    	sub    0xf06676d0,%edx
+            int pagetype = PDX(page2pa(pp)) >= pdx_limit;
+f0100fa1:	f7 c2 00 e0 7f 00    	test   $0x7fe000,%edx
+f0100fa7:	0f 95 c2             	setne  %dl
+f0100faa:	0f b6 d2             	movzbl %dl,%edx
+            *tp[pagetype] = pp;
+f0100fad:	8b 4c 95 e0          	mov    -0x20(%ebp,%edx,4),%ecx
+f0100fb1:	89 01                	mov    %eax,(%ecx)
+            tp[pagetype] = &pp->pp_link;
+f0100fb3:	89 44 95 e0          	mov    %eax,-0x20(%ebp,%edx,4)
+        for (pp = page_free_list; pp; pp = pp->pp_link) {
+f0100fb7:	8b 00                	mov    (%eax),%eax
+f0100fb9:	85 c0                	test   %eax,%eax
+f0100fbb:	75 dc                	jne    f0100f99 <check_page_free_list+0x2ac>
+        *tp[1] = 0;
+f0100fbd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0100fc0:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+        *tp[0] = pp2;
+f0100fc6:	8b 55 dc             	mov    -0x24(%ebp),%edx
+f0100fc9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0100fcc:	89 10                	mov    %edx,(%eax)
+        page_free_list = pp1;
+f0100fce:	8b 45 d8             	mov    -0x28(%ebp),%eax
+f0100fd1:	a3 40 42 62 f0       	mov    %eax,0xf0624240
+    unsigned pdx_limit = only_low_memory ? 1 : NPDENTRIES;
+f0100fd6:	be 01 00 00 00       	mov    $0x1,%esi
+    for (pp = page_free_list; pp; pp = pp->pp_link)
+f0100fdb:	8b 1d 40 42 62 f0    	mov    0xf0624240,%ebx
+f0100fe1:	e9 56 fd ff ff       	jmp    f0100d3c <check_page_free_list+0x4f>
+
+f0100fe6 <page_init>:
+page_init(void) {
+f0100fe6:	55                   	push   %ebp
+f0100fe7:	89 e5                	mov    %esp,%ebp
+f0100fe9:	57                   	push   %edi
+f0100fea:	56                   	push   %esi
+f0100feb:	53                   	push   %ebx
+f0100fec:	83 ec 0c             	sub    $0xc,%esp
+        END_PG = PGNUM(PADDR(boot_alloc(0)));
+f0100fef:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100ff4:	e8 0c fc ff ff       	call   f0100c05 <boot_alloc>
+	if ((uint32_t)kva < KERNBASE)
+f0100ff9:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0100ffe:	76 3b                	jbe    f010103b <page_init+0x55>
+	return (physaddr_t)kva - KERNBASE;
+f0101000:	8d 90 00 00 00 10    	lea    0x10000000(%eax),%edx
+f0101006:	c1 ea 0c             	shr    $0xc,%edx
+    page_free_list = NULL;
+f0101009:	c7 05 40 42 62 f0 00 	movl   $0x0,0xf0624240
+f0101010:	00 00 00 
+        pages[i].pp_ref = 1;
+f0101013:	a1 d0 76 66 f0       	mov    0xf06676d0,%eax
+f0101018:	66 c7 40 04 01 00    	movw   $0x1,0x4(%eax)
+        pages[i].pp_link = NULL;
+f010101e:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    for (; i < npages_basemem; ++i) {
+f0101024:	8b 3d 44 42 62 f0    	mov    0xf0624244,%edi
+f010102a:	bb 00 00 00 00       	mov    $0x0,%ebx
+f010102f:	be 00 00 00 00       	mov    $0x0,%esi
+f0101034:	b8 01 00 00 00       	mov    $0x1,%eax
+f0101039:	eb 2b                	jmp    f0101066 <page_init+0x80>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f010103b:	50                   	push   %eax
+f010103c:	68 88 82 10 f0       	push   $0xf0108288
+f0101041:	68 54 01 00 00       	push   $0x154
+f0101046:	68 f9 92 10 f0       	push   $0xf01092f9
+f010104b:	e8 02 f0 ff ff       	call   f0100052 <_panic>
+            pages[i].pp_ref = 1;
+f0101050:	8b 0d d0 76 66 f0    	mov    0xf06676d0,%ecx
+f0101056:	66 c7 41 3c 01 00    	movw   $0x1,0x3c(%ecx)
+            pages[i].pp_link = NULL;
+f010105c:	c7 41 38 00 00 00 00 	movl   $0x0,0x38(%ecx)
+    for (; i < npages_basemem; ++i) {
+f0101063:	83 c0 01             	add    $0x1,%eax
+f0101066:	39 f8                	cmp    %edi,%eax
+f0101068:	73 2b                	jae    f0101095 <page_init+0xaf>
+        if (i == MPENTRY_PG) {
+f010106a:	83 f8 07             	cmp    $0x7,%eax
+f010106d:	74 e1                	je     f0101050 <page_init+0x6a>
+            pages[i].pp_ref = 0;
+f010106f:	8d 0c c5 00 00 00 00 	lea    0x0(,%eax,8),%ecx
+f0101076:	89 cb                	mov    %ecx,%ebx
+f0101078:	03 1d d0 76 66 f0    	add    0xf06676d0,%ebx
+f010107e:	66 c7 43 04 00 00    	movw   $0x0,0x4(%ebx)
+            pages[i].pp_link = page_free_list;
+f0101084:	89 33                	mov    %esi,(%ebx)
+            page_free_list = pages + i;
+f0101086:	89 ce                	mov    %ecx,%esi
+f0101088:	03 35 d0 76 66 f0    	add    0xf06676d0,%esi
+f010108e:	bb 01 00 00 00       	mov    $0x1,%ebx
+f0101093:	eb ce                	jmp    f0101063 <page_init+0x7d>
+f0101095:	8d 47 ff             	lea    -0x1(%edi),%eax
+f0101098:	85 ff                	test   %edi,%edi
+f010109a:	b9 00 00 00 00       	mov    $0x0,%ecx
+f010109f:	0f 44 c1             	cmove  %ecx,%eax
+f01010a2:	8d 78 01             	lea    0x1(%eax),%edi
+f01010a5:	84 db                	test   %bl,%bl
+f01010a7:	74 06                	je     f01010af <page_init+0xc9>
+f01010a9:	89 35 40 42 62 f0    	mov    %esi,0xf0624240
+    for (; i < npages_basemem; ++i) {
+f01010af:	89 f8                	mov    %edi,%eax
+f01010b1:	eb 18                	jmp    f01010cb <page_init+0xe5>
+        pages[i].pp_ref = 1;
+f01010b3:	8b 0d d0 76 66 f0    	mov    0xf06676d0,%ecx
+f01010b9:	8d 0c c1             	lea    (%ecx,%eax,8),%ecx
+f01010bc:	66 c7 41 04 01 00    	movw   $0x1,0x4(%ecx)
+        pages[i].pp_link = NULL;
+f01010c2:	c7 01 00 00 00 00    	movl   $0x0,(%ecx)
+    for (; i < EXTPHYSMEM_PG; ++i) {
+f01010c8:	83 c0 01             	add    $0x1,%eax
+f01010cb:	3d ff 00 00 00       	cmp    $0xff,%eax
+f01010d0:	76 e1                	jbe    f01010b3 <page_init+0xcd>
+f01010d2:	b8 00 01 00 00       	mov    $0x100,%eax
+f01010d7:	29 f8                	sub    %edi,%eax
+f01010d9:	81 ff 00 01 00 00    	cmp    $0x100,%edi
+f01010df:	b9 00 00 00 00       	mov    $0x0,%ecx
+f01010e4:	0f 47 c1             	cmova  %ecx,%eax
+f01010e7:	01 f8                	add    %edi,%eax
+f01010e9:	89 c1                	mov    %eax,%ecx
+f01010eb:	eb 18                	jmp    f0101105 <page_init+0x11f>
+        pages[i].pp_ref = 1;
+f01010ed:	8b 1d d0 76 66 f0    	mov    0xf06676d0,%ebx
+f01010f3:	8d 1c cb             	lea    (%ebx,%ecx,8),%ebx
+f01010f6:	66 c7 43 04 01 00    	movw   $0x1,0x4(%ebx)
+        pages[i].pp_link = NULL;
+f01010fc:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    for (; i < END_PG; ++i) {
+f0101102:	83 c1 01             	add    $0x1,%ecx
+f0101105:	39 d1                	cmp    %edx,%ecx
+f0101107:	72 e4                	jb     f01010ed <page_init+0x107>
+f0101109:	89 d1                	mov    %edx,%ecx
+f010110b:	29 c1                	sub    %eax,%ecx
+f010110d:	39 c2                	cmp    %eax,%edx
+f010110f:	ba 00 00 00 00       	mov    $0x0,%edx
+f0101114:	0f 42 ca             	cmovb  %edx,%ecx
+f0101117:	01 c8                	add    %ecx,%eax
+f0101119:	8b 1d 40 42 62 f0    	mov    0xf0624240,%ebx
+    for (; i < npages; ++i) {
+f010111f:	be 01 00 00 00       	mov    $0x1,%esi
+f0101124:	eb 24                	jmp    f010114a <page_init+0x164>
+        pages[i].pp_ref = 0;
+f0101126:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+f010112d:	89 d1                	mov    %edx,%ecx
+f010112f:	03 0d d0 76 66 f0    	add    0xf06676d0,%ecx
+f0101135:	66 c7 41 04 00 00    	movw   $0x0,0x4(%ecx)
+        pages[i].pp_link = page_free_list;
+f010113b:	89 19                	mov    %ebx,(%ecx)
+        page_free_list = pages + i;
+f010113d:	03 15 d0 76 66 f0    	add    0xf06676d0,%edx
+f0101143:	89 d3                	mov    %edx,%ebx
+    for (; i < npages; ++i) {
+f0101145:	83 c0 01             	add    $0x1,%eax
+f0101148:	89 f2                	mov    %esi,%edx
+f010114a:	3b 05 c8 76 66 f0    	cmp    0xf06676c8,%eax
+f0101150:	72 d4                	jb     f0101126 <page_init+0x140>
+f0101152:	84 d2                	test   %dl,%dl
+f0101154:	74 06                	je     f010115c <page_init+0x176>
+f0101156:	89 1d 40 42 62 f0    	mov    %ebx,0xf0624240
+}
+f010115c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010115f:	5b                   	pop    %ebx
+f0101160:	5e                   	pop    %esi
+f0101161:	5f                   	pop    %edi
+f0101162:	5d                   	pop    %ebp
+f0101163:	c3                   	ret
+
+f0101164 <page_alloc>:
+page_alloc(int alloc_flags) {
+f0101164:	55                   	push   %ebp
+f0101165:	89 e5                	mov    %esp,%ebp
+f0101167:	53                   	push   %ebx
+f0101168:	83 ec 10             	sub    $0x10,%esp
+    spin_lock(&page_lock);
+f010116b:	68 00 65 11 f0       	push   $0xf0116500
+f0101170:	e8 75 60 00 00       	call   f01071ea <spin_lock>
+    if (!(ret = page_free_list)) {
+f0101175:	8b 1d 40 42 62 f0    	mov    0xf0624240,%ebx
+f010117b:	83 c4 10             	add    $0x10,%esp
+f010117e:	85 db                	test   %ebx,%ebx
+f0101180:	74 30                	je     f01011b2 <page_alloc+0x4e>
+    page_free_list = page_free_list->pp_link;
+f0101182:	8b 03                	mov    (%ebx),%eax
+f0101184:	a3 40 42 62 f0       	mov    %eax,0xf0624240
+    spin_unlock(&page_lock);
+f0101189:	83 ec 0c             	sub    $0xc,%esp
+f010118c:	68 00 65 11 f0       	push   $0xf0116500
+f0101191:	e8 4c 61 00 00       	call   f01072e2 <spin_unlock>
+    ret->pp_link = NULL;
+f0101196:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    ret->pp_ref = 0;
+f010119c:	66 c7 43 04 00 00    	movw   $0x0,0x4(%ebx)
+    if (alloc_flags & ALLOC_ZERO)
+f01011a2:	83 c4 10             	add    $0x10,%esp
+f01011a5:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+f01011a9:	75 19                	jne    f01011c4 <page_alloc+0x60>
+}
+f01011ab:	89 d8                	mov    %ebx,%eax
+f01011ad:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01011b0:	c9                   	leave
+f01011b1:	c3                   	ret
+        spin_unlock(&page_lock);
+f01011b2:	83 ec 0c             	sub    $0xc,%esp
+f01011b5:	68 00 65 11 f0       	push   $0xf0116500
+f01011ba:	e8 23 61 00 00       	call   f01072e2 <spin_unlock>
+        return NULL;
+f01011bf:	83 c4 10             	add    $0x10,%esp
+f01011c2:	eb e7                	jmp    f01011ab <page_alloc+0x47>
+	return (pp - pages) << PGSHIFT;
+f01011c4:	89 d8                	mov    %ebx,%eax
+f01011c6:	2b 05 d0 76 66 f0    	sub    0xf06676d0,%eax
+f01011cc:	c1 f8 03             	sar    $0x3,%eax
+f01011cf:	89 c2                	mov    %eax,%edx
+f01011d1:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f01011d4:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f01011d9:	3b 05 c8 76 66 f0    	cmp    0xf06676c8,%eax
+f01011df:	73 1b                	jae    f01011fc <page_alloc+0x98>
+        memset(page2kva(ret), 0, PGSIZE);
+f01011e1:	83 ec 04             	sub    $0x4,%esp
+f01011e4:	68 00 10 00 00       	push   $0x1000
+f01011e9:	6a 00                	push   $0x0
+	return (void *)(pa + KERNBASE);
+f01011eb:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f01011f1:	52                   	push   %edx
+f01011f2:	e8 04 57 00 00       	call   f01068fb <memset>
+f01011f7:	83 c4 10             	add    $0x10,%esp
+f01011fa:	eb af                	jmp    f01011ab <page_alloc+0x47>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f01011fc:	52                   	push   %edx
+f01011fd:	68 64 82 10 f0       	push   $0xf0108264
+f0101202:	6a 5a                	push   $0x5a
+f0101204:	68 05 93 10 f0       	push   $0xf0109305
+f0101209:	e8 44 ee ff ff       	call   f0100052 <_panic>
+
+f010120e <page_free>:
+page_free(struct PageInfo *pp) {
+f010120e:	55                   	push   %ebp
+f010120f:	89 e5                	mov    %esp,%ebp
+f0101211:	53                   	push   %ebx
+f0101212:	83 ec 04             	sub    $0x4,%esp
+f0101215:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    if (pp->pp_ref || pp->pp_link)
+f0101218:	66 83 7b 04 00       	cmpw   $0x0,0x4(%ebx)
+f010121d:	75 33                	jne    f0101252 <page_free+0x44>
+f010121f:	83 3b 00             	cmpl   $0x0,(%ebx)
+f0101222:	75 2e                	jne    f0101252 <page_free+0x44>
+    spin_lock(&page_lock);
+f0101224:	83 ec 0c             	sub    $0xc,%esp
+f0101227:	68 00 65 11 f0       	push   $0xf0116500
+f010122c:	e8 b9 5f 00 00       	call   f01071ea <spin_lock>
+    pp->pp_link = page_free_list;
+f0101231:	a1 40 42 62 f0       	mov    0xf0624240,%eax
+f0101236:	89 03                	mov    %eax,(%ebx)
+    page_free_list = pp;
+f0101238:	89 1d 40 42 62 f0    	mov    %ebx,0xf0624240
+    spin_unlock(&page_lock);
+f010123e:	c7 04 24 00 65 11 f0 	movl   $0xf0116500,(%esp)
+f0101245:	e8 98 60 00 00       	call   f01072e2 <spin_unlock>
+}
+f010124a:	83 c4 10             	add    $0x10,%esp
+f010124d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0101250:	c9                   	leave
+f0101251:	c3                   	ret
+        panic("page_free: free a nonfree physical page");
+f0101252:	83 ec 04             	sub    $0x4,%esp
+f0101255:	68 d8 89 10 f0       	push   $0xf01089d8
+f010125a:	68 a2 01 00 00       	push   $0x1a2
+f010125f:	68 f9 92 10 f0       	push   $0xf01092f9
+f0101264:	e8 e9 ed ff ff       	call   f0100052 <_panic>
+
+f0101269 <page_decref>:
+page_decref(struct PageInfo *pp) {
+f0101269:	55                   	push   %ebp
+f010126a:	89 e5                	mov    %esp,%ebp
+f010126c:	83 ec 08             	sub    $0x8,%esp
+f010126f:	8b 55 08             	mov    0x8(%ebp),%edx
+    if (--pp->pp_ref == 0)
+f0101272:	0f b7 42 04          	movzwl 0x4(%edx),%eax
+f0101276:	83 e8 01             	sub    $0x1,%eax
+f0101279:	66 89 42 04          	mov    %ax,0x4(%edx)
+f010127d:	66 85 c0             	test   %ax,%ax
+f0101280:	74 02                	je     f0101284 <page_decref+0x1b>
+}
+f0101282:	c9                   	leave
+f0101283:	c3                   	ret
+        page_free(pp);
+f0101284:	83 ec 0c             	sub    $0xc,%esp
+f0101287:	52                   	push   %edx
+f0101288:	e8 81 ff ff ff       	call   f010120e <page_free>
+f010128d:	83 c4 10             	add    $0x10,%esp
+}
+f0101290:	eb f0                	jmp    f0101282 <page_decref+0x19>
+
+f0101292 <pgdir_walk>:
+pgdir_walk(pde_t *pgdir, const void *va, int create) {
+f0101292:	55                   	push   %ebp
+f0101293:	89 e5                	mov    %esp,%ebp
+f0101295:	56                   	push   %esi
+f0101296:	53                   	push   %ebx
+f0101297:	8b 75 0c             	mov    0xc(%ebp),%esi
+    pde_t *pde = pgdir + PDX(va);
+f010129a:	89 f3                	mov    %esi,%ebx
+f010129c:	c1 eb 16             	shr    $0x16,%ebx
+f010129f:	c1 e3 02             	shl    $0x2,%ebx
+f01012a2:	03 5d 08             	add    0x8(%ebp),%ebx
+    if ((*pde & PTE_P) == 0) {
+f01012a5:	f6 03 01             	testb  $0x1,(%ebx)
+f01012a8:	75 2d                	jne    f01012d7 <pgdir_walk+0x45>
+        if (!create || (pp = (struct PageInfo *) page_alloc(ALLOC_ZERO)) == 0)
+f01012aa:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+f01012ae:	74 68                	je     f0101318 <pgdir_walk+0x86>
+f01012b0:	83 ec 0c             	sub    $0xc,%esp
+f01012b3:	6a 01                	push   $0x1
+f01012b5:	e8 aa fe ff ff       	call   f0101164 <page_alloc>
+f01012ba:	83 c4 10             	add    $0x10,%esp
+f01012bd:	85 c0                	test   %eax,%eax
+f01012bf:	74 3b                	je     f01012fc <pgdir_walk+0x6a>
+        ++pp->pp_ref;
+f01012c1:	66 83 40 04 01       	addw   $0x1,0x4(%eax)
+	return (pp - pages) << PGSHIFT;
+f01012c6:	2b 05 d0 76 66 f0    	sub    0xf06676d0,%eax
+f01012cc:	c1 f8 03             	sar    $0x3,%eax
+f01012cf:	c1 e0 0c             	shl    $0xc,%eax
+        *pde = page2pa(pp) | PTE_P | PTE_W | PTE_U;
+f01012d2:	83 c8 07             	or     $0x7,%eax
+f01012d5:	89 03                	mov    %eax,(%ebx)
+    pgtab = KADDR(PTE_ADDR(*pde));
+f01012d7:	8b 03                	mov    (%ebx),%eax
+f01012d9:	89 c2                	mov    %eax,%edx
+f01012db:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+	if (PGNUM(pa) >= npages)
+f01012e1:	c1 e8 0c             	shr    $0xc,%eax
+f01012e4:	3b 05 c8 76 66 f0    	cmp    0xf06676c8,%eax
+f01012ea:	73 17                	jae    f0101303 <pgdir_walk+0x71>
+    return pgtab + PTX(va);
+f01012ec:	c1 ee 0a             	shr    $0xa,%esi
+f01012ef:	81 e6 fc 0f 00 00    	and    $0xffc,%esi
+f01012f5:	8d 84 32 00 00 00 f0 	lea    -0x10000000(%edx,%esi,1),%eax
+}
+f01012fc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f01012ff:	5b                   	pop    %ebx
+f0101300:	5e                   	pop    %esi
+f0101301:	5d                   	pop    %ebp
+f0101302:	c3                   	ret
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0101303:	52                   	push   %edx
+f0101304:	68 64 82 10 f0       	push   $0xf0108264
+f0101309:	68 d8 01 00 00       	push   $0x1d8
+f010130e:	68 f9 92 10 f0       	push   $0xf01092f9
+f0101313:	e8 3a ed ff ff       	call   f0100052 <_panic>
+            return NULL;
+f0101318:	b8 00 00 00 00       	mov    $0x0,%eax
+f010131d:	eb dd                	jmp    f01012fc <pgdir_walk+0x6a>
+
+f010131f <boot_map_region>:
+boot_map_region(pde_t *pgdir, uintptr_t va, size_t size, physaddr_t pa, int perm) {
+f010131f:	55                   	push   %ebp
+f0101320:	89 e5                	mov    %esp,%ebp
+f0101322:	57                   	push   %edi
+f0101323:	56                   	push   %esi
+f0101324:	53                   	push   %ebx
+f0101325:	83 ec 0c             	sub    $0xc,%esp
+f0101328:	8b 7d 08             	mov    0x8(%ebp),%edi
+f010132b:	8b 75 10             	mov    0x10(%ebp),%esi
+    for (int i = 0; i < size; i += PGSIZE) {
+f010132e:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0101333:	eb 29                	jmp    f010135e <boot_map_region+0x3f>
+        pte_t *pte = pgdir_walk(pgdir, (void *) (va + i), 1);
+f0101335:	83 ec 04             	sub    $0x4,%esp
+f0101338:	6a 01                	push   $0x1
+f010133a:	89 d8                	mov    %ebx,%eax
+f010133c:	03 45 0c             	add    0xc(%ebp),%eax
+f010133f:	50                   	push   %eax
+f0101340:	57                   	push   %edi
+f0101341:	e8 4c ff ff ff       	call   f0101292 <pgdir_walk>
+f0101346:	89 c2                	mov    %eax,%edx
+        *pte = (pa + i) | perm | PTE_P;
+f0101348:	89 d8                	mov    %ebx,%eax
+f010134a:	03 45 14             	add    0x14(%ebp),%eax
+f010134d:	0b 45 18             	or     0x18(%ebp),%eax
+f0101350:	83 c8 01             	or     $0x1,%eax
+f0101353:	89 02                	mov    %eax,(%edx)
+    for (int i = 0; i < size; i += PGSIZE) {
+f0101355:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f010135b:	83 c4 10             	add    $0x10,%esp
+f010135e:	39 f3                	cmp    %esi,%ebx
+f0101360:	72 d3                	jb     f0101335 <boot_map_region+0x16>
+}
+f0101362:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101365:	5b                   	pop    %ebx
+f0101366:	5e                   	pop    %esi
+f0101367:	5f                   	pop    %edi
+f0101368:	5d                   	pop    %ebp
+f0101369:	c3                   	ret
+
+f010136a <page_lookup>:
+page_lookup(pde_t *pgdir, void *va, pte_t **pte_store) {
+f010136a:	55                   	push   %ebp
+f010136b:	89 e5                	mov    %esp,%ebp
+f010136d:	53                   	push   %ebx
+f010136e:	83 ec 08             	sub    $0x8,%esp
+f0101371:	8b 5d 10             	mov    0x10(%ebp),%ebx
+    pte_t *pte = pgdir_walk(pgdir, va, 0);
+f0101374:	6a 00                	push   $0x0
+f0101376:	ff 75 0c             	push   0xc(%ebp)
+f0101379:	ff 75 08             	push   0x8(%ebp)
+f010137c:	e8 11 ff ff ff       	call   f0101292 <pgdir_walk>
+    if (pte_store)
+f0101381:	83 c4 10             	add    $0x10,%esp
+f0101384:	85 db                	test   %ebx,%ebx
+f0101386:	74 02                	je     f010138a <page_lookup+0x20>
+        *pte_store = pte;
+f0101388:	89 03                	mov    %eax,(%ebx)
+    if (pte && (*pte & PTE_P))
+f010138a:	85 c0                	test   %eax,%eax
+f010138c:	74 0c                	je     f010139a <page_lookup+0x30>
+f010138e:	8b 10                	mov    (%eax),%edx
+    return NULL;
+f0101390:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (pte && (*pte & PTE_P))
+f0101395:	f6 c2 01             	test   $0x1,%dl
+f0101398:	75 05                	jne    f010139f <page_lookup+0x35>
+}
+f010139a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010139d:	c9                   	leave
+f010139e:	c3                   	ret
+}
+
+static inline struct PageInfo*
+pa2page(physaddr_t pa)
+{
+	if (PGNUM(pa) >= npages)
+f010139f:	c1 ea 0c             	shr    $0xc,%edx
+f01013a2:	3b 15 c8 76 66 f0    	cmp    0xf06676c8,%edx
+f01013a8:	73 0a                	jae    f01013b4 <page_lookup+0x4a>
+		panic("pa2page called with invalid pa");
+	return &pages[PGNUM(pa)];
+f01013aa:	a1 d0 76 66 f0       	mov    0xf06676d0,%eax
+f01013af:	8d 04 d0             	lea    (%eax,%edx,8),%eax
+        return pa2page(PTE_ADDR(*pte));
+f01013b2:	eb e6                	jmp    f010139a <page_lookup+0x30>
+		panic("pa2page called with invalid pa");
+f01013b4:	83 ec 04             	sub    $0x4,%esp
+f01013b7:	68 00 8a 10 f0       	push   $0xf0108a00
+f01013bc:	6a 53                	push   $0x53
+f01013be:	68 05 93 10 f0       	push   $0xf0109305
+f01013c3:	e8 8a ec ff ff       	call   f0100052 <_panic>
+
+f01013c8 <tlb_invalidate>:
+tlb_invalidate(pde_t *pgdir, void *va) {
+f01013c8:	55                   	push   %ebp
+f01013c9:	89 e5                	mov    %esp,%ebp
+f01013cb:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+    if (!curenv || curenv->env_pgdir == pgdir)
+f01013d1:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+f01013d5:	74 11                	je     f01013e8 <tlb_invalidate+0x20>
+f01013d7:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f01013dd:	8b 40 0c             	mov    0xc(%eax),%eax
+f01013e0:	8b 55 08             	mov    0x8(%ebp),%edx
+f01013e3:	39 50 70             	cmp    %edx,0x70(%eax)
+f01013e6:	75 06                	jne    f01013ee <tlb_invalidate+0x26>
+	asm volatile("invlpg (%0)" : : "r" (addr) : "memory");
+f01013e8:	8b 45 0c             	mov    0xc(%ebp),%eax
+f01013eb:	0f 01 38             	invlpg (%eax)
+}
+f01013ee:	5d                   	pop    %ebp
+f01013ef:	c3                   	ret
+
+f01013f0 <page_remove>:
+page_remove(pde_t *pgdir, void *va) {
+f01013f0:	55                   	push   %ebp
+f01013f1:	89 e5                	mov    %esp,%ebp
+f01013f3:	56                   	push   %esi
+f01013f4:	53                   	push   %ebx
+f01013f5:	83 ec 14             	sub    $0x14,%esp
+f01013f8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f01013fb:	8b 75 0c             	mov    0xc(%ebp),%esi
+    pte_t *pte_store = NULL;
+f01013fe:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    struct PageInfo *pp = page_lookup(pgdir, va, &pte_store);
+f0101405:	8d 45 f4             	lea    -0xc(%ebp),%eax
+f0101408:	50                   	push   %eax
+f0101409:	56                   	push   %esi
+f010140a:	53                   	push   %ebx
+f010140b:	e8 5a ff ff ff       	call   f010136a <page_lookup>
+    if (!pp) return;
+f0101410:	83 c4 10             	add    $0x10,%esp
+f0101413:	85 c0                	test   %eax,%eax
+f0101415:	74 1f                	je     f0101436 <page_remove+0x46>
+    page_decref(pp);
+f0101417:	83 ec 0c             	sub    $0xc,%esp
+f010141a:	50                   	push   %eax
+f010141b:	e8 49 fe ff ff       	call   f0101269 <page_decref>
+    *pte_store = 0;
+f0101420:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f0101423:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    tlb_invalidate(pgdir, va);
+f0101429:	83 c4 08             	add    $0x8,%esp
+f010142c:	56                   	push   %esi
+f010142d:	53                   	push   %ebx
+f010142e:	e8 95 ff ff ff       	call   f01013c8 <tlb_invalidate>
+f0101433:	83 c4 10             	add    $0x10,%esp
+}
+f0101436:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0101439:	5b                   	pop    %ebx
+f010143a:	5e                   	pop    %esi
+f010143b:	5d                   	pop    %ebp
+f010143c:	c3                   	ret
+
+f010143d <page_insert>:
+page_insert(pde_t *pgdir, struct PageInfo *pp, void *va, int perm) {
+f010143d:	55                   	push   %ebp
+f010143e:	89 e5                	mov    %esp,%ebp
+f0101440:	57                   	push   %edi
+f0101441:	56                   	push   %esi
+f0101442:	53                   	push   %ebx
+f0101443:	83 ec 10             	sub    $0x10,%esp
+f0101446:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f0101449:	8b 7d 10             	mov    0x10(%ebp),%edi
+    pte_t *pte = pgdir_walk(pgdir, va, 1);
+f010144c:	6a 01                	push   $0x1
+f010144e:	57                   	push   %edi
+f010144f:	ff 75 08             	push   0x8(%ebp)
+f0101452:	e8 3b fe ff ff       	call   f0101292 <pgdir_walk>
+    if (!pte)
+f0101457:	83 c4 10             	add    $0x10,%esp
+f010145a:	85 c0                	test   %eax,%eax
+f010145c:	74 3e                	je     f010149c <page_insert+0x5f>
+f010145e:	89 c6                	mov    %eax,%esi
+    pp->pp_ref++;
+f0101460:	66 83 43 04 01       	addw   $0x1,0x4(%ebx)
+    if (*pte & PTE_P)
+f0101465:	f6 00 01             	testb  $0x1,(%eax)
+f0101468:	75 21                	jne    f010148b <page_insert+0x4e>
+	return (pp - pages) << PGSHIFT;
+f010146a:	2b 1d d0 76 66 f0    	sub    0xf06676d0,%ebx
+f0101470:	c1 fb 03             	sar    $0x3,%ebx
+f0101473:	c1 e3 0c             	shl    $0xc,%ebx
+    *pte = page2pa(pp) | perm | PTE_P;
+f0101476:	0b 5d 14             	or     0x14(%ebp),%ebx
+f0101479:	83 cb 01             	or     $0x1,%ebx
+f010147c:	89 1e                	mov    %ebx,(%esi)
+    return 0;
+f010147e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0101483:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101486:	5b                   	pop    %ebx
+f0101487:	5e                   	pop    %esi
+f0101488:	5f                   	pop    %edi
+f0101489:	5d                   	pop    %ebp
+f010148a:	c3                   	ret
+        page_remove(pgdir, va);
+f010148b:	83 ec 08             	sub    $0x8,%esp
+f010148e:	57                   	push   %edi
+f010148f:	ff 75 08             	push   0x8(%ebp)
+f0101492:	e8 59 ff ff ff       	call   f01013f0 <page_remove>
+f0101497:	83 c4 10             	add    $0x10,%esp
+f010149a:	eb ce                	jmp    f010146a <page_insert+0x2d>
+        return -E_NO_MEM;
+f010149c:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f01014a1:	eb e0                	jmp    f0101483 <page_insert+0x46>
+
+f01014a3 <mmio_map_region>:
+mmio_map_region(physaddr_t pa, size_t size) {
+f01014a3:	55                   	push   %ebp
+f01014a4:	89 e5                	mov    %esp,%ebp
+f01014a6:	56                   	push   %esi
+f01014a7:	53                   	push   %ebx
+    pa = ROUNDDOWN(pa, PGSIZE);
+f01014a8:	8b 45 08             	mov    0x8(%ebp),%eax
+f01014ab:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    size = ROUNDUP(size, PGSIZE);
+f01014b0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f01014b3:	8d 99 ff 0f 00 00    	lea    0xfff(%ecx),%ebx
+f01014b9:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+    if (base + size > MMIOLIM)
+f01014bf:	8b 35 40 64 11 f0    	mov    0xf0116440,%esi
+f01014c5:	8d 14 1e             	lea    (%esi,%ebx,1),%edx
+f01014c8:	81 fa 00 00 c0 ef    	cmp    $0xefc00000,%edx
+f01014ce:	77 22                	ja     f01014f2 <mmio_map_region+0x4f>
+    boot_map_region(kern_pgdir, base, size, pa, PTE_PCD | PTE_PWT | PTE_W);
+f01014d0:	83 ec 0c             	sub    $0xc,%esp
+f01014d3:	6a 1a                	push   $0x1a
+f01014d5:	50                   	push   %eax
+f01014d6:	53                   	push   %ebx
+f01014d7:	56                   	push   %esi
+f01014d8:	ff 35 cc 76 66 f0    	push   0xf06676cc
+f01014de:	e8 3c fe ff ff       	call   f010131f <boot_map_region>
+    base += size;
+f01014e3:	01 1d 40 64 11 f0    	add    %ebx,0xf0116440
+}
+f01014e9:	89 f0                	mov    %esi,%eax
+f01014eb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f01014ee:	5b                   	pop    %ebx
+f01014ef:	5e                   	pop    %esi
+f01014f0:	5d                   	pop    %ebp
+f01014f1:	c3                   	ret
+        panic("mmio_map_region: overflow");
+f01014f2:	83 ec 04             	sub    $0x4,%esp
+f01014f5:	68 cc 93 10 f0       	push   $0xf01093cc
+f01014fa:	68 8c 02 00 00       	push   $0x28c
+f01014ff:	68 f9 92 10 f0       	push   $0xf01092f9
+f0101504:	e8 49 eb ff ff       	call   f0100052 <_panic>
+
+f0101509 <mem_init>:
+mem_init(void) {
+f0101509:	55                   	push   %ebp
+f010150a:	89 e5                	mov    %esp,%ebp
+f010150c:	57                   	push   %edi
+f010150d:	56                   	push   %esi
+f010150e:	53                   	push   %ebx
+f010150f:	83 ec 3c             	sub    $0x3c,%esp
+    basemem = nvram_read(NVRAM_BASELO);
+f0101512:	b8 15 00 00 00       	mov    $0x15,%eax
+f0101517:	e8 c0 f6 ff ff       	call   f0100bdc <nvram_read>
+f010151c:	89 c3                	mov    %eax,%ebx
+    extmem = nvram_read(NVRAM_EXTLO);
+f010151e:	b8 17 00 00 00       	mov    $0x17,%eax
+f0101523:	e8 b4 f6 ff ff       	call   f0100bdc <nvram_read>
+f0101528:	89 c6                	mov    %eax,%esi
+    ext16mem = nvram_read(NVRAM_EXT16LO) * 64;
+f010152a:	b8 34 00 00 00       	mov    $0x34,%eax
+f010152f:	e8 a8 f6 ff ff       	call   f0100bdc <nvram_read>
+    if (ext16mem)
+f0101534:	c1 e0 06             	shl    $0x6,%eax
+f0101537:	0f 84 ae 00 00 00    	je     f01015eb <mem_init+0xe2>
+        totalmem = 16 * 1024 + ext16mem;
+f010153d:	05 00 40 00 00       	add    $0x4000,%eax
+    npages = totalmem / (PGSIZE / 1024);
+f0101542:	89 c2                	mov    %eax,%edx
+f0101544:	c1 ea 02             	shr    $0x2,%edx
+f0101547:	89 15 c8 76 66 f0    	mov    %edx,0xf06676c8
+    npages_basemem = basemem / (PGSIZE / 1024);
+f010154d:	89 da                	mov    %ebx,%edx
+f010154f:	c1 ea 02             	shr    $0x2,%edx
+f0101552:	89 15 44 42 62 f0    	mov    %edx,0xf0624244
+    cprintf("Physical memory: %uK available, base = %uK, extended = %uK\n",
+f0101558:	89 c2                	mov    %eax,%edx
+f010155a:	29 da                	sub    %ebx,%edx
+f010155c:	52                   	push   %edx
+f010155d:	53                   	push   %ebx
+f010155e:	50                   	push   %eax
+f010155f:	68 20 8a 10 f0       	push   $0xf0108a20
+f0101564:	e8 71 2e 00 00       	call   f01043da <cprintf>
+    kern_pgdir = (pde_t *) boot_alloc(PGSIZE);
+f0101569:	b8 00 10 00 00       	mov    $0x1000,%eax
+f010156e:	e8 92 f6 ff ff       	call   f0100c05 <boot_alloc>
+f0101573:	a3 cc 76 66 f0       	mov    %eax,0xf06676cc
+    memset(kern_pgdir, 0, PGSIZE);
+f0101578:	83 c4 0c             	add    $0xc,%esp
+f010157b:	68 00 10 00 00       	push   $0x1000
+f0101580:	6a 00                	push   $0x0
+f0101582:	50                   	push   %eax
+f0101583:	e8 73 53 00 00       	call   f01068fb <memset>
+    kern_pgdir[PDX(UVPT)] = PADDR(kern_pgdir) | PTE_U | PTE_P;
+f0101588:	a1 cc 76 66 f0       	mov    0xf06676cc,%eax
+	if ((uint32_t)kva < KERNBASE)
+f010158d:	83 c4 10             	add    $0x10,%esp
+f0101590:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0101595:	76 64                	jbe    f01015fb <mem_init+0xf2>
+	return (physaddr_t)kva - KERNBASE;
+f0101597:	8d 90 00 00 00 10    	lea    0x10000000(%eax),%edx
+f010159d:	83 ca 05             	or     $0x5,%edx
+f01015a0:	89 90 f4 0e 00 00    	mov    %edx,0xef4(%eax)
+    pages = (struct PageInfo *) boot_alloc(npages * sizeof(struct PageInfo));
+f01015a6:	a1 c8 76 66 f0       	mov    0xf06676c8,%eax
+f01015ab:	c1 e0 03             	shl    $0x3,%eax
+f01015ae:	e8 52 f6 ff ff       	call   f0100c05 <boot_alloc>
+f01015b3:	a3 d0 76 66 f0       	mov    %eax,0xf06676d0
+    envs = (struct Env *) boot_alloc(NENV * sizeof(struct Env));
+f01015b8:	b8 00 40 02 00       	mov    $0x24000,%eax
+f01015bd:	e8 43 f6 ff ff       	call   f0100c05 <boot_alloc>
+f01015c2:	a3 60 42 62 f0       	mov    %eax,0xf0624260
+    page_init();
+f01015c7:	e8 1a fa ff ff       	call   f0100fe6 <page_init>
+    check_page_free_list(1);
+f01015cc:	b8 01 00 00 00       	mov    $0x1,%eax
+f01015d1:	e8 17 f7 ff ff       	call   f0100ced <check_page_free_list>
+    if (!pages)
+f01015d6:	83 3d d0 76 66 f0 00 	cmpl   $0x0,0xf06676d0
+f01015dd:	74 31                	je     f0101610 <mem_init+0x107>
+    for (pp = page_free_list, nfree = 0; pp; pp = pp->pp_link)
+f01015df:	a1 40 42 62 f0       	mov    0xf0624240,%eax
+f01015e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+f01015e9:	eb 41                	jmp    f010162c <mem_init+0x123>
+        totalmem = 1 * 1024 + extmem;
+f01015eb:	8d 86 00 04 00 00    	lea    0x400(%esi),%eax
+f01015f1:	85 f6                	test   %esi,%esi
+f01015f3:	0f 44 c3             	cmove  %ebx,%eax
+f01015f6:	e9 47 ff ff ff       	jmp    f0101542 <mem_init+0x39>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f01015fb:	50                   	push   %eax
+f01015fc:	68 88 82 10 f0       	push   $0xf0108288
+f0101601:	68 ad 00 00 00       	push   $0xad
+f0101606:	68 f9 92 10 f0       	push   $0xf01092f9
+f010160b:	e8 42 ea ff ff       	call   f0100052 <_panic>
+        panic("'pages' is a null pointer!");
+f0101610:	83 ec 04             	sub    $0x4,%esp
+f0101613:	68 e6 93 10 f0       	push   $0xf01093e6
+f0101618:	68 23 03 00 00       	push   $0x323
+f010161d:	68 f9 92 10 f0       	push   $0xf01092f9
+f0101622:	e8 2b ea ff ff       	call   f0100052 <_panic>
+        ++nfree;
+f0101627:	83 c3 01             	add    $0x1,%ebx
+    for (pp = page_free_list, nfree = 0; pp; pp = pp->pp_link)
+f010162a:	8b 00                	mov    (%eax),%eax
+f010162c:	85 c0                	test   %eax,%eax
+f010162e:	75 f7                	jne    f0101627 <mem_init+0x11e>
+    assert((pp0 = page_alloc(0)));
+f0101630:	83 ec 0c             	sub    $0xc,%esp
+f0101633:	6a 00                	push   $0x0
+f0101635:	e8 2a fb ff ff       	call   f0101164 <page_alloc>
+f010163a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f010163d:	83 c4 10             	add    $0x10,%esp
+f0101640:	85 c0                	test   %eax,%eax
+f0101642:	0f 84 fc 01 00 00    	je     f0101844 <mem_init+0x33b>
+    assert((pp1 = page_alloc(0)));
+f0101648:	83 ec 0c             	sub    $0xc,%esp
+f010164b:	6a 00                	push   $0x0
+f010164d:	e8 12 fb ff ff       	call   f0101164 <page_alloc>
+f0101652:	89 c7                	mov    %eax,%edi
+f0101654:	83 c4 10             	add    $0x10,%esp
+f0101657:	85 c0                	test   %eax,%eax
+f0101659:	0f 84 fe 01 00 00    	je     f010185d <mem_init+0x354>
+    assert((pp2 = page_alloc(0)));
+f010165f:	83 ec 0c             	sub    $0xc,%esp
+f0101662:	6a 00                	push   $0x0
+f0101664:	e8 fb fa ff ff       	call   f0101164 <page_alloc>
+f0101669:	89 c6                	mov    %eax,%esi
+f010166b:	83 c4 10             	add    $0x10,%esp
+f010166e:	85 c0                	test   %eax,%eax
+f0101670:	0f 84 00 02 00 00    	je     f0101876 <mem_init+0x36d>
+    assert(pp1 && pp1 != pp0);
+f0101676:	39 7d d4             	cmp    %edi,-0x2c(%ebp)
+f0101679:	0f 84 10 02 00 00    	je     f010188f <mem_init+0x386>
+    assert(pp2 && pp2 != pp1 && pp2 != pp0);
+f010167f:	39 45 d4             	cmp    %eax,-0x2c(%ebp)
+f0101682:	0f 84 20 02 00 00    	je     f01018a8 <mem_init+0x39f>
+f0101688:	39 c7                	cmp    %eax,%edi
+f010168a:	0f 84 18 02 00 00    	je     f01018a8 <mem_init+0x39f>
+	return (pp - pages) << PGSHIFT;
+f0101690:	8b 0d d0 76 66 f0    	mov    0xf06676d0,%ecx
+    assert(page2pa(pp0) < npages * PGSIZE);
+f0101696:	a1 c8 76 66 f0       	mov    0xf06676c8,%eax
+f010169b:	c1 e0 0c             	shl    $0xc,%eax
+f010169e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+f01016a1:	29 ca                	sub    %ecx,%edx
+f01016a3:	c1 fa 03             	sar    $0x3,%edx
+f01016a6:	c1 e2 0c             	shl    $0xc,%edx
+f01016a9:	39 c2                	cmp    %eax,%edx
+f01016ab:	0f 83 10 02 00 00    	jae    f01018c1 <mem_init+0x3b8>
+f01016b1:	89 fa                	mov    %edi,%edx
+f01016b3:	29 ca                	sub    %ecx,%edx
+f01016b5:	c1 fa 03             	sar    $0x3,%edx
+f01016b8:	c1 e2 0c             	shl    $0xc,%edx
+    assert(page2pa(pp1) < npages * PGSIZE);
+f01016bb:	39 c2                	cmp    %eax,%edx
+f01016bd:	0f 83 17 02 00 00    	jae    f01018da <mem_init+0x3d1>
+f01016c3:	89 f2                	mov    %esi,%edx
+f01016c5:	29 ca                	sub    %ecx,%edx
+f01016c7:	c1 fa 03             	sar    $0x3,%edx
+f01016ca:	c1 e2 0c             	shl    $0xc,%edx
+    assert(page2pa(pp2) < npages * PGSIZE);
+f01016cd:	39 c2                	cmp    %eax,%edx
+f01016cf:	0f 83 1e 02 00 00    	jae    f01018f3 <mem_init+0x3ea>
+    fl = page_free_list;
+f01016d5:	a1 40 42 62 f0       	mov    0xf0624240,%eax
+f01016da:	89 45 d0             	mov    %eax,-0x30(%ebp)
+    page_free_list = 0;
+f01016dd:	c7 05 40 42 62 f0 00 	movl   $0x0,0xf0624240
+f01016e4:	00 00 00 
+    assert(!page_alloc(0));
+f01016e7:	83 ec 0c             	sub    $0xc,%esp
+f01016ea:	6a 00                	push   $0x0
+f01016ec:	e8 73 fa ff ff       	call   f0101164 <page_alloc>
+f01016f1:	83 c4 10             	add    $0x10,%esp
+f01016f4:	85 c0                	test   %eax,%eax
+f01016f6:	0f 85 10 02 00 00    	jne    f010190c <mem_init+0x403>
+    page_free(pp0);
+f01016fc:	83 ec 0c             	sub    $0xc,%esp
+f01016ff:	ff 75 d4             	push   -0x2c(%ebp)
+f0101702:	e8 07 fb ff ff       	call   f010120e <page_free>
+    page_free(pp1);
+f0101707:	89 3c 24             	mov    %edi,(%esp)
+f010170a:	e8 ff fa ff ff       	call   f010120e <page_free>
+    page_free(pp2);
+f010170f:	89 34 24             	mov    %esi,(%esp)
+f0101712:	e8 f7 fa ff ff       	call   f010120e <page_free>
+    assert((pp0 = page_alloc(0)));
+f0101717:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+f010171e:	e8 41 fa ff ff       	call   f0101164 <page_alloc>
+f0101723:	89 c6                	mov    %eax,%esi
+f0101725:	83 c4 10             	add    $0x10,%esp
+f0101728:	85 c0                	test   %eax,%eax
+f010172a:	0f 84 f5 01 00 00    	je     f0101925 <mem_init+0x41c>
+    assert((pp1 = page_alloc(0)));
+f0101730:	83 ec 0c             	sub    $0xc,%esp
+f0101733:	6a 00                	push   $0x0
+f0101735:	e8 2a fa ff ff       	call   f0101164 <page_alloc>
+f010173a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f010173d:	83 c4 10             	add    $0x10,%esp
+f0101740:	85 c0                	test   %eax,%eax
+f0101742:	0f 84 f6 01 00 00    	je     f010193e <mem_init+0x435>
+    assert((pp2 = page_alloc(0)));
+f0101748:	83 ec 0c             	sub    $0xc,%esp
+f010174b:	6a 00                	push   $0x0
+f010174d:	e8 12 fa ff ff       	call   f0101164 <page_alloc>
+f0101752:	89 c7                	mov    %eax,%edi
+f0101754:	83 c4 10             	add    $0x10,%esp
+f0101757:	85 c0                	test   %eax,%eax
+f0101759:	0f 84 f8 01 00 00    	je     f0101957 <mem_init+0x44e>
+    assert(pp1 && pp1 != pp0);
+f010175f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0101762:	39 c6                	cmp    %eax,%esi
+f0101764:	0f 84 06 02 00 00    	je     f0101970 <mem_init+0x467>
+    assert(pp2 && pp2 != pp1 && pp2 != pp0);
+f010176a:	39 7d d4             	cmp    %edi,-0x2c(%ebp)
+f010176d:	0f 84 16 02 00 00    	je     f0101989 <mem_init+0x480>
+f0101773:	39 fe                	cmp    %edi,%esi
+f0101775:	0f 84 0e 02 00 00    	je     f0101989 <mem_init+0x480>
+    assert(!page_alloc(0));
+f010177b:	83 ec 0c             	sub    $0xc,%esp
+f010177e:	6a 00                	push   $0x0
+f0101780:	e8 df f9 ff ff       	call   f0101164 <page_alloc>
+f0101785:	83 c4 10             	add    $0x10,%esp
+f0101788:	85 c0                	test   %eax,%eax
+f010178a:	0f 85 12 02 00 00    	jne    f01019a2 <mem_init+0x499>
+f0101790:	89 f0                	mov    %esi,%eax
+f0101792:	2b 05 d0 76 66 f0    	sub    0xf06676d0,%eax
+f0101798:	c1 f8 03             	sar    $0x3,%eax
+f010179b:	89 c2                	mov    %eax,%edx
+f010179d:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f01017a0:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f01017a5:	3b 05 c8 76 66 f0    	cmp    0xf06676c8,%eax
+f01017ab:	0f 83 0a 02 00 00    	jae    f01019bb <mem_init+0x4b2>
+    memset(page2kva(pp0), 1, PGSIZE);
+f01017b1:	83 ec 04             	sub    $0x4,%esp
+f01017b4:	68 00 10 00 00       	push   $0x1000
+f01017b9:	6a 01                	push   $0x1
+	return (void *)(pa + KERNBASE);
+f01017bb:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f01017c1:	52                   	push   %edx
+f01017c2:	e8 34 51 00 00       	call   f01068fb <memset>
+    page_free(pp0);
+f01017c7:	89 34 24             	mov    %esi,(%esp)
+f01017ca:	e8 3f fa ff ff       	call   f010120e <page_free>
+    assert((pp = page_alloc(ALLOC_ZERO)));
+f01017cf:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+f01017d6:	e8 89 f9 ff ff       	call   f0101164 <page_alloc>
+f01017db:	83 c4 10             	add    $0x10,%esp
+f01017de:	85 c0                	test   %eax,%eax
+f01017e0:	0f 84 e7 01 00 00    	je     f01019cd <mem_init+0x4c4>
+    assert(pp && pp0 == pp);
+f01017e6:	39 c6                	cmp    %eax,%esi
+f01017e8:	0f 85 f8 01 00 00    	jne    f01019e6 <mem_init+0x4dd>
+	return (pp - pages) << PGSHIFT;
+f01017ee:	2b 05 d0 76 66 f0    	sub    0xf06676d0,%eax
+f01017f4:	c1 f8 03             	sar    $0x3,%eax
+f01017f7:	89 c1                	mov    %eax,%ecx
+f01017f9:	c1 e1 0c             	shl    $0xc,%ecx
+	if (PGNUM(pa) >= npages)
+f01017fc:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0101801:	3b 05 c8 76 66 f0    	cmp    0xf06676c8,%eax
+f0101807:	0f 83 f2 01 00 00    	jae    f01019ff <mem_init+0x4f6>
+	return (void *)(pa + KERNBASE);
+f010180d:	8d 81 00 00 00 f0    	lea    -0x10000000(%ecx),%eax
+    for (i = 0; i < PGSIZE; i++)
+f0101813:	81 e9 00 f0 ff 0f    	sub    $0xffff000,%ecx
+f0101819:	39 c8                	cmp    %ecx,%eax
+f010181b:	0f 84 f0 01 00 00    	je     f0101a11 <mem_init+0x508>
+        assert(c[i] == 0);
+f0101821:	0f b6 10             	movzbl (%eax),%edx
+f0101824:	83 c0 01             	add    $0x1,%eax
+f0101827:	84 d2                	test   %dl,%dl
+f0101829:	74 ee                	je     f0101819 <mem_init+0x310>
+f010182b:	68 92 94 10 f0       	push   $0xf0109492
+f0101830:	68 1f 93 10 f0       	push   $0xf010931f
+f0101835:	68 51 03 00 00       	push   $0x351
+f010183a:	68 f9 92 10 f0       	push   $0xf01092f9
+f010183f:	e8 0e e8 ff ff       	call   f0100052 <_panic>
+    assert((pp0 = page_alloc(0)));
+f0101844:	68 01 94 10 f0       	push   $0xf0109401
+f0101849:	68 1f 93 10 f0       	push   $0xf010931f
+f010184e:	68 2b 03 00 00       	push   $0x32b
+f0101853:	68 f9 92 10 f0       	push   $0xf01092f9
+f0101858:	e8 f5 e7 ff ff       	call   f0100052 <_panic>
+    assert((pp1 = page_alloc(0)));
+f010185d:	68 17 94 10 f0       	push   $0xf0109417
+f0101862:	68 1f 93 10 f0       	push   $0xf010931f
+f0101867:	68 2c 03 00 00       	push   $0x32c
+f010186c:	68 f9 92 10 f0       	push   $0xf01092f9
+f0101871:	e8 dc e7 ff ff       	call   f0100052 <_panic>
+    assert((pp2 = page_alloc(0)));
+f0101876:	68 2d 94 10 f0       	push   $0xf010942d
+f010187b:	68 1f 93 10 f0       	push   $0xf010931f
+f0101880:	68 2d 03 00 00       	push   $0x32d
+f0101885:	68 f9 92 10 f0       	push   $0xf01092f9
+f010188a:	e8 c3 e7 ff ff       	call   f0100052 <_panic>
+    assert(pp1 && pp1 != pp0);
+f010188f:	68 43 94 10 f0       	push   $0xf0109443
+f0101894:	68 1f 93 10 f0       	push   $0xf010931f
+f0101899:	68 30 03 00 00       	push   $0x330
+f010189e:	68 f9 92 10 f0       	push   $0xf01092f9
+f01018a3:	e8 aa e7 ff ff       	call   f0100052 <_panic>
+    assert(pp2 && pp2 != pp1 && pp2 != pp0);
+f01018a8:	68 5c 8a 10 f0       	push   $0xf0108a5c
+f01018ad:	68 1f 93 10 f0       	push   $0xf010931f
+f01018b2:	68 31 03 00 00       	push   $0x331
+f01018b7:	68 f9 92 10 f0       	push   $0xf01092f9
+f01018bc:	e8 91 e7 ff ff       	call   f0100052 <_panic>
+    assert(page2pa(pp0) < npages * PGSIZE);
+f01018c1:	68 7c 8a 10 f0       	push   $0xf0108a7c
+f01018c6:	68 1f 93 10 f0       	push   $0xf010931f
+f01018cb:	68 32 03 00 00       	push   $0x332
+f01018d0:	68 f9 92 10 f0       	push   $0xf01092f9
+f01018d5:	e8 78 e7 ff ff       	call   f0100052 <_panic>
+    assert(page2pa(pp1) < npages * PGSIZE);
+f01018da:	68 9c 8a 10 f0       	push   $0xf0108a9c
+f01018df:	68 1f 93 10 f0       	push   $0xf010931f
+f01018e4:	68 33 03 00 00       	push   $0x333
+f01018e9:	68 f9 92 10 f0       	push   $0xf01092f9
+f01018ee:	e8 5f e7 ff ff       	call   f0100052 <_panic>
+    assert(page2pa(pp2) < npages * PGSIZE);
+f01018f3:	68 bc 8a 10 f0       	push   $0xf0108abc
+f01018f8:	68 1f 93 10 f0       	push   $0xf010931f
+f01018fd:	68 34 03 00 00       	push   $0x334
+f0101902:	68 f9 92 10 f0       	push   $0xf01092f9
+f0101907:	e8 46 e7 ff ff       	call   f0100052 <_panic>
+    assert(!page_alloc(0));
+f010190c:	68 55 94 10 f0       	push   $0xf0109455
+f0101911:	68 1f 93 10 f0       	push   $0xf010931f
+f0101916:	68 3b 03 00 00       	push   $0x33b
+f010191b:	68 f9 92 10 f0       	push   $0xf01092f9
+f0101920:	e8 2d e7 ff ff       	call   f0100052 <_panic>
+    assert((pp0 = page_alloc(0)));
+f0101925:	68 01 94 10 f0       	push   $0xf0109401
+f010192a:	68 1f 93 10 f0       	push   $0xf010931f
+f010192f:	68 42 03 00 00       	push   $0x342
+f0101934:	68 f9 92 10 f0       	push   $0xf01092f9
+f0101939:	e8 14 e7 ff ff       	call   f0100052 <_panic>
+    assert((pp1 = page_alloc(0)));
+f010193e:	68 17 94 10 f0       	push   $0xf0109417
+f0101943:	68 1f 93 10 f0       	push   $0xf010931f
+f0101948:	68 43 03 00 00       	push   $0x343
+f010194d:	68 f9 92 10 f0       	push   $0xf01092f9
+f0101952:	e8 fb e6 ff ff       	call   f0100052 <_panic>
+    assert((pp2 = page_alloc(0)));
+f0101957:	68 2d 94 10 f0       	push   $0xf010942d
+f010195c:	68 1f 93 10 f0       	push   $0xf010931f
+f0101961:	68 44 03 00 00       	push   $0x344
+f0101966:	68 f9 92 10 f0       	push   $0xf01092f9
+f010196b:	e8 e2 e6 ff ff       	call   f0100052 <_panic>
+    assert(pp1 && pp1 != pp0);
+f0101970:	68 43 94 10 f0       	push   $0xf0109443
+f0101975:	68 1f 93 10 f0       	push   $0xf010931f
+f010197a:	68 46 03 00 00       	push   $0x346
+f010197f:	68 f9 92 10 f0       	push   $0xf01092f9
+f0101984:	e8 c9 e6 ff ff       	call   f0100052 <_panic>
+    assert(pp2 && pp2 != pp1 && pp2 != pp0);
+f0101989:	68 5c 8a 10 f0       	push   $0xf0108a5c
+f010198e:	68 1f 93 10 f0       	push   $0xf010931f
+f0101993:	68 47 03 00 00       	push   $0x347
+f0101998:	68 f9 92 10 f0       	push   $0xf01092f9
+f010199d:	e8 b0 e6 ff ff       	call   f0100052 <_panic>
+    assert(!page_alloc(0));
+f01019a2:	68 55 94 10 f0       	push   $0xf0109455
+f01019a7:	68 1f 93 10 f0       	push   $0xf010931f
+f01019ac:	68 48 03 00 00       	push   $0x348
+f01019b1:	68 f9 92 10 f0       	push   $0xf01092f9
+f01019b6:	e8 97 e6 ff ff       	call   f0100052 <_panic>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f01019bb:	52                   	push   %edx
+f01019bc:	68 64 82 10 f0       	push   $0xf0108264
+f01019c1:	6a 5a                	push   $0x5a
+f01019c3:	68 05 93 10 f0       	push   $0xf0109305
+f01019c8:	e8 85 e6 ff ff       	call   f0100052 <_panic>
+    assert((pp = page_alloc(ALLOC_ZERO)));
+f01019cd:	68 64 94 10 f0       	push   $0xf0109464
+f01019d2:	68 1f 93 10 f0       	push   $0xf010931f
+f01019d7:	68 4d 03 00 00       	push   $0x34d
+f01019dc:	68 f9 92 10 f0       	push   $0xf01092f9
+f01019e1:	e8 6c e6 ff ff       	call   f0100052 <_panic>
+    assert(pp && pp0 == pp);
+f01019e6:	68 82 94 10 f0       	push   $0xf0109482
+f01019eb:	68 1f 93 10 f0       	push   $0xf010931f
+f01019f0:	68 4e 03 00 00       	push   $0x34e
+f01019f5:	68 f9 92 10 f0       	push   $0xf01092f9
+f01019fa:	e8 53 e6 ff ff       	call   f0100052 <_panic>
+f01019ff:	51                   	push   %ecx
+f0101a00:	68 64 82 10 f0       	push   $0xf0108264
+f0101a05:	6a 5a                	push   $0x5a
+f0101a07:	68 05 93 10 f0       	push   $0xf0109305
+f0101a0c:	e8 41 e6 ff ff       	call   f0100052 <_panic>
+    page_free_list = fl;
+f0101a11:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0101a14:	a3 40 42 62 f0       	mov    %eax,0xf0624240
+    page_free(pp0);
+f0101a19:	83 ec 0c             	sub    $0xc,%esp
+f0101a1c:	56                   	push   %esi
+f0101a1d:	e8 ec f7 ff ff       	call   f010120e <page_free>
+    page_free(pp1);
+f0101a22:	83 c4 04             	add    $0x4,%esp
+f0101a25:	ff 75 d4             	push   -0x2c(%ebp)
+f0101a28:	e8 e1 f7 ff ff       	call   f010120e <page_free>
+    page_free(pp2);
+f0101a2d:	89 3c 24             	mov    %edi,(%esp)
+f0101a30:	e8 d9 f7 ff ff       	call   f010120e <page_free>
+    for (pp = page_free_list; pp; pp = pp->pp_link)
+f0101a35:	a1 40 42 62 f0       	mov    0xf0624240,%eax
+f0101a3a:	83 c4 10             	add    $0x10,%esp
+f0101a3d:	85 c0                	test   %eax,%eax
+f0101a3f:	74 07                	je     f0101a48 <mem_init+0x53f>
+        --nfree;
+f0101a41:	83 eb 01             	sub    $0x1,%ebx
+    for (pp = page_free_list; pp; pp = pp->pp_link)
+f0101a44:	8b 00                	mov    (%eax),%eax
+f0101a46:	eb f5                	jmp    f0101a3d <mem_init+0x534>
+    assert(nfree == 0);
+f0101a48:	85 db                	test   %ebx,%ebx
+f0101a4a:	0f 85 7e 06 00 00    	jne    f01020ce <mem_init+0xbc5>
+    cprintf("check_page_alloc() succeeded!\n");
+f0101a50:	83 ec 0c             	sub    $0xc,%esp
+f0101a53:	68 dc 8a 10 f0       	push   $0xf0108adc
+f0101a58:	e8 7d 29 00 00       	call   f01043da <cprintf>
+    int i;
+    extern pde_t entry_pgdir[];
+
+    // should be able to allocate three pages
+    pp0 = pp1 = pp2 = 0;
+    assert((pp0 = page_alloc(0)));
+f0101a5d:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+f0101a64:	e8 fb f6 ff ff       	call   f0101164 <page_alloc>
+f0101a69:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f0101a6c:	83 c4 10             	add    $0x10,%esp
+f0101a6f:	85 c0                	test   %eax,%eax
+f0101a71:	0f 84 70 06 00 00    	je     f01020e7 <mem_init+0xbde>
+    assert((pp1 = page_alloc(0)));
+f0101a77:	83 ec 0c             	sub    $0xc,%esp
+f0101a7a:	6a 00                	push   $0x0
+f0101a7c:	e8 e3 f6 ff ff       	call   f0101164 <page_alloc>
+f0101a81:	89 c7                	mov    %eax,%edi
+f0101a83:	83 c4 10             	add    $0x10,%esp
+f0101a86:	85 c0                	test   %eax,%eax
+f0101a88:	0f 84 72 06 00 00    	je     f0102100 <mem_init+0xbf7>
+    assert((pp2 = page_alloc(0)));
+f0101a8e:	83 ec 0c             	sub    $0xc,%esp
+f0101a91:	6a 00                	push   $0x0
+f0101a93:	e8 cc f6 ff ff       	call   f0101164 <page_alloc>
+f0101a98:	89 c3                	mov    %eax,%ebx
+f0101a9a:	83 c4 10             	add    $0x10,%esp
+f0101a9d:	85 c0                	test   %eax,%eax
+f0101a9f:	0f 84 74 06 00 00    	je     f0102119 <mem_init+0xc10>
+
+    assert(pp0);
+    assert(pp1 && pp1 != pp0);
+f0101aa5:	39 7d d4             	cmp    %edi,-0x2c(%ebp)
+f0101aa8:	0f 84 84 06 00 00    	je     f0102132 <mem_init+0xc29>
+    assert(pp2 && pp2 != pp1 && pp2 != pp0);
+f0101aae:	39 45 d4             	cmp    %eax,-0x2c(%ebp)
+f0101ab1:	0f 84 94 06 00 00    	je     f010214b <mem_init+0xc42>
+f0101ab7:	39 c7                	cmp    %eax,%edi
+f0101ab9:	0f 84 8c 06 00 00    	je     f010214b <mem_init+0xc42>
+
+    // temporarily steal the rest of the free pages
+    fl = page_free_list;
+f0101abf:	a1 40 42 62 f0       	mov    0xf0624240,%eax
+f0101ac4:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    page_free_list = 0;
+f0101ac7:	c7 05 40 42 62 f0 00 	movl   $0x0,0xf0624240
+f0101ace:	00 00 00 
+
+    // should be no free memory
+    assert(!page_alloc(0));
+f0101ad1:	83 ec 0c             	sub    $0xc,%esp
+f0101ad4:	6a 00                	push   $0x0
+f0101ad6:	e8 89 f6 ff ff       	call   f0101164 <page_alloc>
+f0101adb:	83 c4 10             	add    $0x10,%esp
+f0101ade:	85 c0                	test   %eax,%eax
+f0101ae0:	0f 85 7e 06 00 00    	jne    f0102164 <mem_init+0xc5b>
+
+    // there is no page allocated at address 0
+    assert(page_lookup(kern_pgdir, (void *) 0x0, &ptep) == NULL);
+f0101ae6:	83 ec 04             	sub    $0x4,%esp
+f0101ae9:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0101aec:	50                   	push   %eax
+f0101aed:	6a 00                	push   $0x0
+f0101aef:	ff 35 cc 76 66 f0    	push   0xf06676cc
+f0101af5:	e8 70 f8 ff ff       	call   f010136a <page_lookup>
+f0101afa:	83 c4 10             	add    $0x10,%esp
+f0101afd:	85 c0                	test   %eax,%eax
+f0101aff:	0f 85 78 06 00 00    	jne    f010217d <mem_init+0xc74>
+
+    // there is no free memory, so we can't allocate a page table
+    assert(page_insert(kern_pgdir, pp1, 0x0, PTE_W) < 0);
+f0101b05:	6a 02                	push   $0x2
+f0101b07:	6a 00                	push   $0x0
+f0101b09:	57                   	push   %edi
+f0101b0a:	ff 35 cc 76 66 f0    	push   0xf06676cc
+f0101b10:	e8 28 f9 ff ff       	call   f010143d <page_insert>
+f0101b15:	83 c4 10             	add    $0x10,%esp
+f0101b18:	85 c0                	test   %eax,%eax
+f0101b1a:	0f 89 76 06 00 00    	jns    f0102196 <mem_init+0xc8d>
+
+    // free pp0 and try again: pp0 should be used for page table
+    page_free(pp0);
+f0101b20:	83 ec 0c             	sub    $0xc,%esp
+f0101b23:	ff 75 d4             	push   -0x2c(%ebp)
+f0101b26:	e8 e3 f6 ff ff       	call   f010120e <page_free>
+    assert(page_insert(kern_pgdir, pp1, 0x0, PTE_W) == 0);
+f0101b2b:	6a 02                	push   $0x2
+f0101b2d:	6a 00                	push   $0x0
+f0101b2f:	57                   	push   %edi
+f0101b30:	ff 35 cc 76 66 f0    	push   0xf06676cc
+f0101b36:	e8 02 f9 ff ff       	call   f010143d <page_insert>
+f0101b3b:	83 c4 20             	add    $0x20,%esp
+f0101b3e:	85 c0                	test   %eax,%eax
+f0101b40:	0f 85 69 06 00 00    	jne    f01021af <mem_init+0xca6>
+    assert(PTE_ADDR(kern_pgdir[0]) == page2pa(pp0));
+f0101b46:	8b 35 cc 76 66 f0    	mov    0xf06676cc,%esi
+	return (pp - pages) << PGSHIFT;
+f0101b4c:	8b 0d d0 76 66 f0    	mov    0xf06676d0,%ecx
+f0101b52:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+f0101b55:	8b 16                	mov    (%esi),%edx
+f0101b57:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+f0101b5d:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0101b60:	29 c8                	sub    %ecx,%eax
+f0101b62:	c1 f8 03             	sar    $0x3,%eax
+f0101b65:	c1 e0 0c             	shl    $0xc,%eax
+f0101b68:	39 c2                	cmp    %eax,%edx
+f0101b6a:	0f 85 58 06 00 00    	jne    f01021c8 <mem_init+0xcbf>
+    assert(check_va2pa(kern_pgdir, 0x0) == page2pa(pp1));
+f0101b70:	ba 00 00 00 00       	mov    $0x0,%edx
+f0101b75:	89 f0                	mov    %esi,%eax
+f0101b77:	e8 0e f1 ff ff       	call   f0100c8a <check_va2pa>
+f0101b7c:	89 c2                	mov    %eax,%edx
+f0101b7e:	89 f8                	mov    %edi,%eax
+f0101b80:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+f0101b83:	29 c8                	sub    %ecx,%eax
+f0101b85:	c1 f8 03             	sar    $0x3,%eax
+f0101b88:	c1 e0 0c             	shl    $0xc,%eax
+f0101b8b:	39 c2                	cmp    %eax,%edx
+f0101b8d:	0f 85 4e 06 00 00    	jne    f01021e1 <mem_init+0xcd8>
+    assert(pp1->pp_ref == 1);
+f0101b93:	66 83 7f 04 01       	cmpw   $0x1,0x4(%edi)
+f0101b98:	0f 85 5c 06 00 00    	jne    f01021fa <mem_init+0xcf1>
+    assert(pp0->pp_ref == 1);
+f0101b9e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0101ba1:	66 83 78 04 01       	cmpw   $0x1,0x4(%eax)
+f0101ba6:	0f 85 67 06 00 00    	jne    f0102213 <mem_init+0xd0a>
+
+    // should be able to map pp2 at PGSIZE because pp0 is already allocated for page table
+    assert(page_insert(kern_pgdir, pp2, (void *) PGSIZE, PTE_W) == 0);
+f0101bac:	6a 02                	push   $0x2
+f0101bae:	68 00 10 00 00       	push   $0x1000
+f0101bb3:	53                   	push   %ebx
+f0101bb4:	56                   	push   %esi
+f0101bb5:	e8 83 f8 ff ff       	call   f010143d <page_insert>
+f0101bba:	83 c4 10             	add    $0x10,%esp
+f0101bbd:	85 c0                	test   %eax,%eax
+f0101bbf:	0f 85 67 06 00 00    	jne    f010222c <mem_init+0xd23>
+    assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp2));
+f0101bc5:	ba 00 10 00 00       	mov    $0x1000,%edx
+f0101bca:	a1 cc 76 66 f0       	mov    0xf06676cc,%eax
+f0101bcf:	e8 b6 f0 ff ff       	call   f0100c8a <check_va2pa>
+f0101bd4:	89 c2                	mov    %eax,%edx
+f0101bd6:	89 d8                	mov    %ebx,%eax
+f0101bd8:	2b 05 d0 76 66 f0    	sub    0xf06676d0,%eax
+f0101bde:	c1 f8 03             	sar    $0x3,%eax
+f0101be1:	c1 e0 0c             	shl    $0xc,%eax
+f0101be4:	39 c2                	cmp    %eax,%edx
+f0101be6:	0f 85 59 06 00 00    	jne    f0102245 <mem_init+0xd3c>
+    assert(pp2->pp_ref == 1);
+f0101bec:	66 83 7b 04 01       	cmpw   $0x1,0x4(%ebx)
+f0101bf1:	0f 85 67 06 00 00    	jne    f010225e <mem_init+0xd55>
+
+    // should be no free memory
+    assert(!page_alloc(0));
+f0101bf7:	83 ec 0c             	sub    $0xc,%esp
+f0101bfa:	6a 00                	push   $0x0
+f0101bfc:	e8 63 f5 ff ff       	call   f0101164 <page_alloc>
+f0101c01:	83 c4 10             	add    $0x10,%esp
+f0101c04:	85 c0                	test   %eax,%eax
+f0101c06:	0f 85 6b 06 00 00    	jne    f0102277 <mem_init+0xd6e>
+
+    // should be able to map pp2 at PGSIZE because it's already there
+    assert(page_insert(kern_pgdir, pp2, (void *) PGSIZE, PTE_W) == 0);
+f0101c0c:	6a 02                	push   $0x2
+f0101c0e:	68 00 10 00 00       	push   $0x1000
+f0101c13:	53                   	push   %ebx
+f0101c14:	ff 35 cc 76 66 f0    	push   0xf06676cc
+f0101c1a:	e8 1e f8 ff ff       	call   f010143d <page_insert>
+f0101c1f:	83 c4 10             	add    $0x10,%esp
+f0101c22:	85 c0                	test   %eax,%eax
+f0101c24:	0f 85 66 06 00 00    	jne    f0102290 <mem_init+0xd87>
+    assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp2));
+f0101c2a:	ba 00 10 00 00       	mov    $0x1000,%edx
+f0101c2f:	a1 cc 76 66 f0       	mov    0xf06676cc,%eax
+f0101c34:	e8 51 f0 ff ff       	call   f0100c8a <check_va2pa>
+f0101c39:	89 c2                	mov    %eax,%edx
+f0101c3b:	89 d8                	mov    %ebx,%eax
+f0101c3d:	2b 05 d0 76 66 f0    	sub    0xf06676d0,%eax
+f0101c43:	c1 f8 03             	sar    $0x3,%eax
+f0101c46:	c1 e0 0c             	shl    $0xc,%eax
+f0101c49:	39 c2                	cmp    %eax,%edx
+f0101c4b:	0f 85 58 06 00 00    	jne    f01022a9 <mem_init+0xda0>
+    assert(pp2->pp_ref == 1);
+f0101c51:	66 83 7b 04 01       	cmpw   $0x1,0x4(%ebx)
+f0101c56:	0f 85 66 06 00 00    	jne    f01022c2 <mem_init+0xdb9>
+
+    // pp2 should NOT be on the free list
+    // could happen in ref counts are handled sloppily in page_insert
+    assert(!page_alloc(0));
+f0101c5c:	83 ec 0c             	sub    $0xc,%esp
+f0101c5f:	6a 00                	push   $0x0
+f0101c61:	e8 fe f4 ff ff       	call   f0101164 <page_alloc>
+f0101c66:	83 c4 10             	add    $0x10,%esp
+f0101c69:	85 c0                	test   %eax,%eax
+f0101c6b:	0f 85 6a 06 00 00    	jne    f01022db <mem_init+0xdd2>
+
+    // check that pgdir_walk returns a pointer to the pte
+    ptep = (pte_t *) KADDR(PTE_ADDR(kern_pgdir[PDX(PGSIZE)]));
+f0101c71:	8b 15 cc 76 66 f0    	mov    0xf06676cc,%edx
+f0101c77:	8b 02                	mov    (%edx),%eax
+f0101c79:	89 c6                	mov    %eax,%esi
+f0101c7b:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (PGNUM(pa) >= npages)
+f0101c81:	c1 e8 0c             	shr    $0xc,%eax
+f0101c84:	3b 05 c8 76 66 f0    	cmp    0xf06676c8,%eax
+f0101c8a:	0f 83 64 06 00 00    	jae    f01022f4 <mem_init+0xdeb>
+    assert(pgdir_walk(kern_pgdir, (void *) PGSIZE, 0) == ptep + PTX(PGSIZE));
+f0101c90:	83 ec 04             	sub    $0x4,%esp
+f0101c93:	6a 00                	push   $0x0
+f0101c95:	68 00 10 00 00       	push   $0x1000
+f0101c9a:	52                   	push   %edx
+f0101c9b:	e8 f2 f5 ff ff       	call   f0101292 <pgdir_walk>
+f0101ca0:	81 ee fc ff ff 0f    	sub    $0xffffffc,%esi
+f0101ca6:	83 c4 10             	add    $0x10,%esp
+f0101ca9:	39 f0                	cmp    %esi,%eax
+f0101cab:	0f 85 58 06 00 00    	jne    f0102309 <mem_init+0xe00>
+
+    // should be able to change permissions too.
+    assert(page_insert(kern_pgdir, pp2, (void *) PGSIZE, PTE_W | PTE_U) == 0);
+f0101cb1:	6a 06                	push   $0x6
+f0101cb3:	68 00 10 00 00       	push   $0x1000
+f0101cb8:	53                   	push   %ebx
+f0101cb9:	ff 35 cc 76 66 f0    	push   0xf06676cc
+f0101cbf:	e8 79 f7 ff ff       	call   f010143d <page_insert>
+f0101cc4:	83 c4 10             	add    $0x10,%esp
+f0101cc7:	85 c0                	test   %eax,%eax
+f0101cc9:	0f 85 53 06 00 00    	jne    f0102322 <mem_init+0xe19>
+    assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp2));
+f0101ccf:	8b 35 cc 76 66 f0    	mov    0xf06676cc,%esi
+f0101cd5:	ba 00 10 00 00       	mov    $0x1000,%edx
+f0101cda:	89 f0                	mov    %esi,%eax
+f0101cdc:	e8 a9 ef ff ff       	call   f0100c8a <check_va2pa>
+f0101ce1:	89 c2                	mov    %eax,%edx
+	return (pp - pages) << PGSHIFT;
+f0101ce3:	89 d8                	mov    %ebx,%eax
+f0101ce5:	2b 05 d0 76 66 f0    	sub    0xf06676d0,%eax
+f0101ceb:	c1 f8 03             	sar    $0x3,%eax
+f0101cee:	c1 e0 0c             	shl    $0xc,%eax
+f0101cf1:	39 c2                	cmp    %eax,%edx
+f0101cf3:	0f 85 42 06 00 00    	jne    f010233b <mem_init+0xe32>
+    assert(pp2->pp_ref == 1);
+f0101cf9:	66 83 7b 04 01       	cmpw   $0x1,0x4(%ebx)
+f0101cfe:	0f 85 50 06 00 00    	jne    f0102354 <mem_init+0xe4b>
+    assert(*pgdir_walk(kern_pgdir, (void *) PGSIZE, 0) & PTE_U);
+f0101d04:	83 ec 04             	sub    $0x4,%esp
+f0101d07:	6a 00                	push   $0x0
+f0101d09:	68 00 10 00 00       	push   $0x1000
+f0101d0e:	56                   	push   %esi
+f0101d0f:	e8 7e f5 ff ff       	call   f0101292 <pgdir_walk>
+f0101d14:	83 c4 10             	add    $0x10,%esp
+f0101d17:	f6 00 04             	testb  $0x4,(%eax)
+f0101d1a:	0f 84 4d 06 00 00    	je     f010236d <mem_init+0xe64>
+    assert(kern_pgdir[0] & PTE_U);
+f0101d20:	a1 cc 76 66 f0       	mov    0xf06676cc,%eax
+f0101d25:	f6 00 04             	testb  $0x4,(%eax)
+f0101d28:	0f 84 58 06 00 00    	je     f0102386 <mem_init+0xe7d>
+
+    // should be able to remap with fewer permissions
+    assert(page_insert(kern_pgdir, pp2, (void *) PGSIZE, PTE_W) == 0);
+f0101d2e:	6a 02                	push   $0x2
+f0101d30:	68 00 10 00 00       	push   $0x1000
+f0101d35:	53                   	push   %ebx
+f0101d36:	50                   	push   %eax
+f0101d37:	e8 01 f7 ff ff       	call   f010143d <page_insert>
+f0101d3c:	83 c4 10             	add    $0x10,%esp
+f0101d3f:	85 c0                	test   %eax,%eax
+f0101d41:	0f 85 58 06 00 00    	jne    f010239f <mem_init+0xe96>
+    assert(*pgdir_walk(kern_pgdir, (void *) PGSIZE, 0) & PTE_W);
+f0101d47:	83 ec 04             	sub    $0x4,%esp
+f0101d4a:	6a 00                	push   $0x0
+f0101d4c:	68 00 10 00 00       	push   $0x1000
+f0101d51:	ff 35 cc 76 66 f0    	push   0xf06676cc
+f0101d57:	e8 36 f5 ff ff       	call   f0101292 <pgdir_walk>
+f0101d5c:	83 c4 10             	add    $0x10,%esp
+f0101d5f:	f6 00 02             	testb  $0x2,(%eax)
+f0101d62:	0f 84 50 06 00 00    	je     f01023b8 <mem_init+0xeaf>
+    assert(!(*pgdir_walk(kern_pgdir, (void *) PGSIZE, 0) & PTE_U));
+f0101d68:	83 ec 04             	sub    $0x4,%esp
+f0101d6b:	6a 00                	push   $0x0
+f0101d6d:	68 00 10 00 00       	push   $0x1000
+f0101d72:	ff 35 cc 76 66 f0    	push   0xf06676cc
+f0101d78:	e8 15 f5 ff ff       	call   f0101292 <pgdir_walk>
+f0101d7d:	83 c4 10             	add    $0x10,%esp
+f0101d80:	f6 00 04             	testb  $0x4,(%eax)
+f0101d83:	0f 85 48 06 00 00    	jne    f01023d1 <mem_init+0xec8>
+
+    // should not be able to map at PTSIZE because need free page for page table
+    assert(page_insert(kern_pgdir, pp0, (void *) PTSIZE, PTE_W) < 0);
+f0101d89:	6a 02                	push   $0x2
+f0101d8b:	68 00 00 40 00       	push   $0x400000
+f0101d90:	ff 75 d4             	push   -0x2c(%ebp)
+f0101d93:	ff 35 cc 76 66 f0    	push   0xf06676cc
+f0101d99:	e8 9f f6 ff ff       	call   f010143d <page_insert>
+f0101d9e:	83 c4 10             	add    $0x10,%esp
+f0101da1:	85 c0                	test   %eax,%eax
+f0101da3:	0f 89 41 06 00 00    	jns    f01023ea <mem_init+0xee1>
+
+    // insert pp1 at PGSIZE (replacing pp2)
+    assert(page_insert(kern_pgdir, pp1, (void *) PGSIZE, PTE_W) == 0);
+f0101da9:	6a 02                	push   $0x2
+f0101dab:	68 00 10 00 00       	push   $0x1000
+f0101db0:	57                   	push   %edi
+f0101db1:	ff 35 cc 76 66 f0    	push   0xf06676cc
+f0101db7:	e8 81 f6 ff ff       	call   f010143d <page_insert>
+f0101dbc:	83 c4 10             	add    $0x10,%esp
+f0101dbf:	85 c0                	test   %eax,%eax
+f0101dc1:	0f 85 3c 06 00 00    	jne    f0102403 <mem_init+0xefa>
+    assert(!(*pgdir_walk(kern_pgdir, (void *) PGSIZE, 0) & PTE_U));
+f0101dc7:	83 ec 04             	sub    $0x4,%esp
+f0101dca:	6a 00                	push   $0x0
+f0101dcc:	68 00 10 00 00       	push   $0x1000
+f0101dd1:	ff 35 cc 76 66 f0    	push   0xf06676cc
+f0101dd7:	e8 b6 f4 ff ff       	call   f0101292 <pgdir_walk>
+f0101ddc:	83 c4 10             	add    $0x10,%esp
+f0101ddf:	f6 00 04             	testb  $0x4,(%eax)
+f0101de2:	0f 85 34 06 00 00    	jne    f010241c <mem_init+0xf13>
+
+    // should have pp1 at both 0 and PGSIZE, pp2 nowhere, ...
+    assert(check_va2pa(kern_pgdir, 0) == page2pa(pp1));
+f0101de8:	a1 cc 76 66 f0       	mov    0xf06676cc,%eax
+f0101ded:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f0101df0:	ba 00 00 00 00       	mov    $0x0,%edx
+f0101df5:	e8 90 ee ff ff       	call   f0100c8a <check_va2pa>
+f0101dfa:	89 fe                	mov    %edi,%esi
+f0101dfc:	2b 35 d0 76 66 f0    	sub    0xf06676d0,%esi
+f0101e02:	c1 fe 03             	sar    $0x3,%esi
+f0101e05:	c1 e6 0c             	shl    $0xc,%esi
+f0101e08:	39 f0                	cmp    %esi,%eax
+f0101e0a:	0f 85 25 06 00 00    	jne    f0102435 <mem_init+0xf2c>
+    assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp1));
+f0101e10:	ba 00 10 00 00       	mov    $0x1000,%edx
+f0101e15:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0101e18:	e8 6d ee ff ff       	call   f0100c8a <check_va2pa>
+f0101e1d:	39 c6                	cmp    %eax,%esi
+f0101e1f:	0f 85 29 06 00 00    	jne    f010244e <mem_init+0xf45>
+    // ... and ref counts should reflect this
+    assert(pp1->pp_ref == 2);
+f0101e25:	66 83 7f 04 02       	cmpw   $0x2,0x4(%edi)
+f0101e2a:	0f 85 37 06 00 00    	jne    f0102467 <mem_init+0xf5e>
+    assert(pp2->pp_ref == 0);
+f0101e30:	66 83 7b 04 00       	cmpw   $0x0,0x4(%ebx)
+f0101e35:	0f 85 45 06 00 00    	jne    f0102480 <mem_init+0xf77>
+
+    // pp2 should be returned by page_alloc
+    assert((pp = page_alloc(0)) && pp == pp2);
+f0101e3b:	83 ec 0c             	sub    $0xc,%esp
+f0101e3e:	6a 00                	push   $0x0
+f0101e40:	e8 1f f3 ff ff       	call   f0101164 <page_alloc>
+f0101e45:	83 c4 10             	add    $0x10,%esp
+f0101e48:	85 c0                	test   %eax,%eax
+f0101e4a:	0f 84 49 06 00 00    	je     f0102499 <mem_init+0xf90>
+f0101e50:	39 c3                	cmp    %eax,%ebx
+f0101e52:	0f 85 41 06 00 00    	jne    f0102499 <mem_init+0xf90>
+
+    // unmapping pp1 at 0 should keep pp1 at PGSIZE
+    page_remove(kern_pgdir, 0x0);
+f0101e58:	83 ec 08             	sub    $0x8,%esp
+f0101e5b:	6a 00                	push   $0x0
+f0101e5d:	ff 35 cc 76 66 f0    	push   0xf06676cc
+f0101e63:	e8 88 f5 ff ff       	call   f01013f0 <page_remove>
+    assert(check_va2pa(kern_pgdir, 0x0) == ~0);
+f0101e68:	8b 35 cc 76 66 f0    	mov    0xf06676cc,%esi
+f0101e6e:	ba 00 00 00 00       	mov    $0x0,%edx
+f0101e73:	89 f0                	mov    %esi,%eax
+f0101e75:	e8 10 ee ff ff       	call   f0100c8a <check_va2pa>
+f0101e7a:	83 c4 10             	add    $0x10,%esp
+f0101e7d:	83 f8 ff             	cmp    $0xffffffff,%eax
+f0101e80:	0f 85 2c 06 00 00    	jne    f01024b2 <mem_init+0xfa9>
+    assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp1));
+f0101e86:	ba 00 10 00 00       	mov    $0x1000,%edx
+f0101e8b:	89 f0                	mov    %esi,%eax
+f0101e8d:	e8 f8 ed ff ff       	call   f0100c8a <check_va2pa>
+f0101e92:	89 c2                	mov    %eax,%edx
+f0101e94:	89 f8                	mov    %edi,%eax
+f0101e96:	2b 05 d0 76 66 f0    	sub    0xf06676d0,%eax
+f0101e9c:	c1 f8 03             	sar    $0x3,%eax
+f0101e9f:	c1 e0 0c             	shl    $0xc,%eax
+f0101ea2:	39 c2                	cmp    %eax,%edx
+f0101ea4:	0f 85 21 06 00 00    	jne    f01024cb <mem_init+0xfc2>
+    assert(pp1->pp_ref == 1);
+f0101eaa:	66 83 7f 04 01       	cmpw   $0x1,0x4(%edi)
+f0101eaf:	0f 85 2f 06 00 00    	jne    f01024e4 <mem_init+0xfdb>
+    assert(pp2->pp_ref == 0);
+f0101eb5:	66 83 7b 04 00       	cmpw   $0x0,0x4(%ebx)
+f0101eba:	0f 85 3d 06 00 00    	jne    f01024fd <mem_init+0xff4>
+
+    // test re-inserting pp1 at PGSIZE
+    assert(page_insert(kern_pgdir, pp1, (void *) PGSIZE, 0) == 0);
+f0101ec0:	6a 00                	push   $0x0
+f0101ec2:	68 00 10 00 00       	push   $0x1000
+f0101ec7:	57                   	push   %edi
+f0101ec8:	56                   	push   %esi
+f0101ec9:	e8 6f f5 ff ff       	call   f010143d <page_insert>
+f0101ece:	83 c4 10             	add    $0x10,%esp
+f0101ed1:	85 c0                	test   %eax,%eax
+f0101ed3:	0f 85 3d 06 00 00    	jne    f0102516 <mem_init+0x100d>
+    assert(pp1->pp_ref);
+f0101ed9:	66 83 7f 04 00       	cmpw   $0x0,0x4(%edi)
+f0101ede:	0f 84 4b 06 00 00    	je     f010252f <mem_init+0x1026>
+    assert(pp1->pp_link == NULL);
+f0101ee4:	83 3f 00             	cmpl   $0x0,(%edi)
+f0101ee7:	0f 85 5b 06 00 00    	jne    f0102548 <mem_init+0x103f>
+
+    // unmapping pp1 at PGSIZE should free it
+    page_remove(kern_pgdir, (void *) PGSIZE);
+f0101eed:	83 ec 08             	sub    $0x8,%esp
+f0101ef0:	68 00 10 00 00       	push   $0x1000
+f0101ef5:	ff 35 cc 76 66 f0    	push   0xf06676cc
+f0101efb:	e8 f0 f4 ff ff       	call   f01013f0 <page_remove>
+    assert(check_va2pa(kern_pgdir, 0x0) == ~0);
+f0101f00:	8b 35 cc 76 66 f0    	mov    0xf06676cc,%esi
+f0101f06:	ba 00 00 00 00       	mov    $0x0,%edx
+f0101f0b:	89 f0                	mov    %esi,%eax
+f0101f0d:	e8 78 ed ff ff       	call   f0100c8a <check_va2pa>
+f0101f12:	83 c4 10             	add    $0x10,%esp
+f0101f15:	83 f8 ff             	cmp    $0xffffffff,%eax
+f0101f18:	0f 85 43 06 00 00    	jne    f0102561 <mem_init+0x1058>
+    assert(check_va2pa(kern_pgdir, PGSIZE) == ~0);
+f0101f1e:	ba 00 10 00 00       	mov    $0x1000,%edx
+f0101f23:	89 f0                	mov    %esi,%eax
+f0101f25:	e8 60 ed ff ff       	call   f0100c8a <check_va2pa>
+f0101f2a:	83 f8 ff             	cmp    $0xffffffff,%eax
+f0101f2d:	0f 85 47 06 00 00    	jne    f010257a <mem_init+0x1071>
+    assert(pp1->pp_ref == 0);
+f0101f33:	66 83 7f 04 00       	cmpw   $0x0,0x4(%edi)
+f0101f38:	0f 85 55 06 00 00    	jne    f0102593 <mem_init+0x108a>
+    assert(pp2->pp_ref == 0);
+f0101f3e:	66 83 7b 04 00       	cmpw   $0x0,0x4(%ebx)
+f0101f43:	0f 85 63 06 00 00    	jne    f01025ac <mem_init+0x10a3>
+
+    // so it should be returned by page_alloc
+    assert((pp = page_alloc(0)) && pp == pp1);
+f0101f49:	83 ec 0c             	sub    $0xc,%esp
+f0101f4c:	6a 00                	push   $0x0
+f0101f4e:	e8 11 f2 ff ff       	call   f0101164 <page_alloc>
+f0101f53:	83 c4 10             	add    $0x10,%esp
+f0101f56:	39 c7                	cmp    %eax,%edi
+f0101f58:	0f 85 67 06 00 00    	jne    f01025c5 <mem_init+0x10bc>
+f0101f5e:	85 c0                	test   %eax,%eax
+f0101f60:	0f 84 5f 06 00 00    	je     f01025c5 <mem_init+0x10bc>
+
+    // should be no free memory
+    assert(!page_alloc(0));
+f0101f66:	83 ec 0c             	sub    $0xc,%esp
+f0101f69:	6a 00                	push   $0x0
+f0101f6b:	e8 f4 f1 ff ff       	call   f0101164 <page_alloc>
+f0101f70:	83 c4 10             	add    $0x10,%esp
+f0101f73:	85 c0                	test   %eax,%eax
+f0101f75:	0f 85 63 06 00 00    	jne    f01025de <mem_init+0x10d5>
+
+    // forcibly take pp0 back
+    assert(PTE_ADDR(kern_pgdir[0]) == page2pa(pp0));
+f0101f7b:	8b 0d cc 76 66 f0    	mov    0xf06676cc,%ecx
+f0101f81:	8b 11                	mov    (%ecx),%edx
+f0101f83:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+f0101f89:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0101f8c:	2b 05 d0 76 66 f0    	sub    0xf06676d0,%eax
+f0101f92:	c1 f8 03             	sar    $0x3,%eax
+f0101f95:	c1 e0 0c             	shl    $0xc,%eax
+f0101f98:	39 c2                	cmp    %eax,%edx
+f0101f9a:	0f 85 57 06 00 00    	jne    f01025f7 <mem_init+0x10ee>
+    kern_pgdir[0] = 0;
+f0101fa0:	c7 01 00 00 00 00    	movl   $0x0,(%ecx)
+    assert(pp0->pp_ref == 1);
+f0101fa6:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0101fa9:	66 83 78 04 01       	cmpw   $0x1,0x4(%eax)
+f0101fae:	0f 85 5c 06 00 00    	jne    f0102610 <mem_init+0x1107>
+    pp0->pp_ref = 0;
+f0101fb4:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0101fb7:	66 c7 40 04 00 00    	movw   $0x0,0x4(%eax)
+
+    // check pointer arithmetic in pgdir_walk
+    page_free(pp0);
+f0101fbd:	83 ec 0c             	sub    $0xc,%esp
+f0101fc0:	50                   	push   %eax
+f0101fc1:	e8 48 f2 ff ff       	call   f010120e <page_free>
+    va = (void *) (PGSIZE * NPDENTRIES + PGSIZE);
+    ptep = pgdir_walk(kern_pgdir, va, 1);
+f0101fc6:	83 c4 0c             	add    $0xc,%esp
+f0101fc9:	6a 01                	push   $0x1
+f0101fcb:	68 00 10 40 00       	push   $0x401000
+f0101fd0:	ff 35 cc 76 66 f0    	push   0xf06676cc
+f0101fd6:	e8 b7 f2 ff ff       	call   f0101292 <pgdir_walk>
+f0101fdb:	89 45 d0             	mov    %eax,-0x30(%ebp)
+    ptep1 = (pte_t *) KADDR(PTE_ADDR(kern_pgdir[PDX(va)]));
+f0101fde:	8b 0d cc 76 66 f0    	mov    0xf06676cc,%ecx
+f0101fe4:	8b 41 04             	mov    0x4(%ecx),%eax
+f0101fe7:	89 c6                	mov    %eax,%esi
+f0101fe9:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (PGNUM(pa) >= npages)
+f0101fef:	8b 15 c8 76 66 f0    	mov    0xf06676c8,%edx
+f0101ff5:	c1 e8 0c             	shr    $0xc,%eax
+f0101ff8:	83 c4 10             	add    $0x10,%esp
+f0101ffb:	39 d0                	cmp    %edx,%eax
+f0101ffd:	0f 83 26 06 00 00    	jae    f0102629 <mem_init+0x1120>
+    assert(ptep == ptep1 + PTX(va));
+f0102003:	81 ee fc ff ff 0f    	sub    $0xffffffc,%esi
+f0102009:	39 75 d0             	cmp    %esi,-0x30(%ebp)
+f010200c:	0f 85 2c 06 00 00    	jne    f010263e <mem_init+0x1135>
+    kern_pgdir[PDX(va)] = 0;
+f0102012:	c7 41 04 00 00 00 00 	movl   $0x0,0x4(%ecx)
+    pp0->pp_ref = 0;
+f0102019:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f010201c:	66 c7 40 04 00 00    	movw   $0x0,0x4(%eax)
+	return (pp - pages) << PGSHIFT;
+f0102022:	2b 05 d0 76 66 f0    	sub    0xf06676d0,%eax
+f0102028:	c1 f8 03             	sar    $0x3,%eax
+f010202b:	89 c1                	mov    %eax,%ecx
+f010202d:	c1 e1 0c             	shl    $0xc,%ecx
+	if (PGNUM(pa) >= npages)
+f0102030:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0102035:	39 d0                	cmp    %edx,%eax
+f0102037:	0f 83 1a 06 00 00    	jae    f0102657 <mem_init+0x114e>
+
+    // check that new page tables get cleared
+    memset(page2kva(pp0), 0xFF, PGSIZE);
+f010203d:	83 ec 04             	sub    $0x4,%esp
+f0102040:	68 00 10 00 00       	push   $0x1000
+f0102045:	68 ff 00 00 00       	push   $0xff
+	return (void *)(pa + KERNBASE);
+f010204a:	81 e9 00 00 00 10    	sub    $0x10000000,%ecx
+f0102050:	51                   	push   %ecx
+f0102051:	e8 a5 48 00 00       	call   f01068fb <memset>
+    page_free(pp0);
+f0102056:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+f0102059:	89 34 24             	mov    %esi,(%esp)
+f010205c:	e8 ad f1 ff ff       	call   f010120e <page_free>
+    pgdir_walk(kern_pgdir, 0x0, 1);
+f0102061:	83 c4 0c             	add    $0xc,%esp
+f0102064:	6a 01                	push   $0x1
+f0102066:	6a 00                	push   $0x0
+f0102068:	ff 35 cc 76 66 f0    	push   0xf06676cc
+f010206e:	e8 1f f2 ff ff       	call   f0101292 <pgdir_walk>
+	return (pp - pages) << PGSHIFT;
+f0102073:	89 f0                	mov    %esi,%eax
+f0102075:	2b 05 d0 76 66 f0    	sub    0xf06676d0,%eax
+f010207b:	c1 f8 03             	sar    $0x3,%eax
+f010207e:	89 c1                	mov    %eax,%ecx
+f0102080:	c1 e1 0c             	shl    $0xc,%ecx
+	if (PGNUM(pa) >= npages)
+f0102083:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0102088:	83 c4 10             	add    $0x10,%esp
+f010208b:	3b 05 c8 76 66 f0    	cmp    0xf06676c8,%eax
+f0102091:	0f 83 d2 05 00 00    	jae    f0102669 <mem_init+0x1160>
+	return (void *)(pa + KERNBASE);
+f0102097:	8d 81 00 00 00 f0    	lea    -0x10000000(%ecx),%eax
+    ptep = (pte_t *) page2kva(pp0);
+    for (i = 0; i < NPTENTRIES; i++)
+f010209d:	81 e9 00 f0 ff 0f    	sub    $0xffff000,%ecx
+f01020a3:	39 c8                	cmp    %ecx,%eax
+f01020a5:	0f 84 d0 05 00 00    	je     f010267b <mem_init+0x1172>
+        assert((ptep[i] & PTE_P) == 0);
+f01020ab:	8b 10                	mov    (%eax),%edx
+f01020ad:	83 c0 04             	add    $0x4,%eax
+f01020b0:	f6 c2 01             	test   $0x1,%dl
+f01020b3:	74 ee                	je     f01020a3 <mem_init+0xb9a>
+f01020b5:	68 5c 95 10 f0       	push   $0xf010955c
+f01020ba:	68 1f 93 10 f0       	push   $0xf010931f
+f01020bf:	68 4c 04 00 00       	push   $0x44c
+f01020c4:	68 f9 92 10 f0       	push   $0xf01092f9
+f01020c9:	e8 84 df ff ff       	call   f0100052 <_panic>
+    assert(nfree == 0);
+f01020ce:	68 9c 94 10 f0       	push   $0xf010949c
+f01020d3:	68 1f 93 10 f0       	push   $0xf010931f
+f01020d8:	68 5e 03 00 00       	push   $0x35e
+f01020dd:	68 f9 92 10 f0       	push   $0xf01092f9
+f01020e2:	e8 6b df ff ff       	call   f0100052 <_panic>
+    assert((pp0 = page_alloc(0)));
+f01020e7:	68 01 94 10 f0       	push   $0xf0109401
+f01020ec:	68 1f 93 10 f0       	push   $0xf010931f
+f01020f1:	68 cf 03 00 00       	push   $0x3cf
+f01020f6:	68 f9 92 10 f0       	push   $0xf01092f9
+f01020fb:	e8 52 df ff ff       	call   f0100052 <_panic>
+    assert((pp1 = page_alloc(0)));
+f0102100:	68 17 94 10 f0       	push   $0xf0109417
+f0102105:	68 1f 93 10 f0       	push   $0xf010931f
+f010210a:	68 d0 03 00 00       	push   $0x3d0
+f010210f:	68 f9 92 10 f0       	push   $0xf01092f9
+f0102114:	e8 39 df ff ff       	call   f0100052 <_panic>
+    assert((pp2 = page_alloc(0)));
+f0102119:	68 2d 94 10 f0       	push   $0xf010942d
+f010211e:	68 1f 93 10 f0       	push   $0xf010931f
+f0102123:	68 d1 03 00 00       	push   $0x3d1
+f0102128:	68 f9 92 10 f0       	push   $0xf01092f9
+f010212d:	e8 20 df ff ff       	call   f0100052 <_panic>
+    assert(pp1 && pp1 != pp0);
+f0102132:	68 43 94 10 f0       	push   $0xf0109443
+f0102137:	68 1f 93 10 f0       	push   $0xf010931f
+f010213c:	68 d4 03 00 00       	push   $0x3d4
+f0102141:	68 f9 92 10 f0       	push   $0xf01092f9
+f0102146:	e8 07 df ff ff       	call   f0100052 <_panic>
+    assert(pp2 && pp2 != pp1 && pp2 != pp0);
+f010214b:	68 5c 8a 10 f0       	push   $0xf0108a5c
+f0102150:	68 1f 93 10 f0       	push   $0xf010931f
+f0102155:	68 d5 03 00 00       	push   $0x3d5
+f010215a:	68 f9 92 10 f0       	push   $0xf01092f9
+f010215f:	e8 ee de ff ff       	call   f0100052 <_panic>
+    assert(!page_alloc(0));
+f0102164:	68 55 94 10 f0       	push   $0xf0109455
+f0102169:	68 1f 93 10 f0       	push   $0xf010931f
+f010216e:	68 dc 03 00 00       	push   $0x3dc
+f0102173:	68 f9 92 10 f0       	push   $0xf01092f9
+f0102178:	e8 d5 de ff ff       	call   f0100052 <_panic>
+    assert(page_lookup(kern_pgdir, (void *) 0x0, &ptep) == NULL);
+f010217d:	68 fc 8a 10 f0       	push   $0xf0108afc
+f0102182:	68 1f 93 10 f0       	push   $0xf010931f
+f0102187:	68 df 03 00 00       	push   $0x3df
+f010218c:	68 f9 92 10 f0       	push   $0xf01092f9
+f0102191:	e8 bc de ff ff       	call   f0100052 <_panic>
+    assert(page_insert(kern_pgdir, pp1, 0x0, PTE_W) < 0);
+f0102196:	68 34 8b 10 f0       	push   $0xf0108b34
+f010219b:	68 1f 93 10 f0       	push   $0xf010931f
+f01021a0:	68 e2 03 00 00       	push   $0x3e2
+f01021a5:	68 f9 92 10 f0       	push   $0xf01092f9
+f01021aa:	e8 a3 de ff ff       	call   f0100052 <_panic>
+    assert(page_insert(kern_pgdir, pp1, 0x0, PTE_W) == 0);
+f01021af:	68 64 8b 10 f0       	push   $0xf0108b64
+f01021b4:	68 1f 93 10 f0       	push   $0xf010931f
+f01021b9:	68 e6 03 00 00       	push   $0x3e6
+f01021be:	68 f9 92 10 f0       	push   $0xf01092f9
+f01021c3:	e8 8a de ff ff       	call   f0100052 <_panic>
+    assert(PTE_ADDR(kern_pgdir[0]) == page2pa(pp0));
+f01021c8:	68 94 8b 10 f0       	push   $0xf0108b94
+f01021cd:	68 1f 93 10 f0       	push   $0xf010931f
+f01021d2:	68 e7 03 00 00       	push   $0x3e7
+f01021d7:	68 f9 92 10 f0       	push   $0xf01092f9
+f01021dc:	e8 71 de ff ff       	call   f0100052 <_panic>
+    assert(check_va2pa(kern_pgdir, 0x0) == page2pa(pp1));
+f01021e1:	68 bc 8b 10 f0       	push   $0xf0108bbc
+f01021e6:	68 1f 93 10 f0       	push   $0xf010931f
+f01021eb:	68 e8 03 00 00       	push   $0x3e8
+f01021f0:	68 f9 92 10 f0       	push   $0xf01092f9
+f01021f5:	e8 58 de ff ff       	call   f0100052 <_panic>
+    assert(pp1->pp_ref == 1);
+f01021fa:	68 a7 94 10 f0       	push   $0xf01094a7
+f01021ff:	68 1f 93 10 f0       	push   $0xf010931f
+f0102204:	68 e9 03 00 00       	push   $0x3e9
+f0102209:	68 f9 92 10 f0       	push   $0xf01092f9
+f010220e:	e8 3f de ff ff       	call   f0100052 <_panic>
+    assert(pp0->pp_ref == 1);
+f0102213:	68 b8 94 10 f0       	push   $0xf01094b8
+f0102218:	68 1f 93 10 f0       	push   $0xf010931f
+f010221d:	68 ea 03 00 00       	push   $0x3ea
+f0102222:	68 f9 92 10 f0       	push   $0xf01092f9
+f0102227:	e8 26 de ff ff       	call   f0100052 <_panic>
+    assert(page_insert(kern_pgdir, pp2, (void *) PGSIZE, PTE_W) == 0);
+f010222c:	68 ec 8b 10 f0       	push   $0xf0108bec
+f0102231:	68 1f 93 10 f0       	push   $0xf010931f
+f0102236:	68 ed 03 00 00       	push   $0x3ed
+f010223b:	68 f9 92 10 f0       	push   $0xf01092f9
+f0102240:	e8 0d de ff ff       	call   f0100052 <_panic>
+    assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp2));
+f0102245:	68 28 8c 10 f0       	push   $0xf0108c28
+f010224a:	68 1f 93 10 f0       	push   $0xf010931f
+f010224f:	68 ee 03 00 00       	push   $0x3ee
+f0102254:	68 f9 92 10 f0       	push   $0xf01092f9
+f0102259:	e8 f4 dd ff ff       	call   f0100052 <_panic>
+    assert(pp2->pp_ref == 1);
+f010225e:	68 c9 94 10 f0       	push   $0xf01094c9
+f0102263:	68 1f 93 10 f0       	push   $0xf010931f
+f0102268:	68 ef 03 00 00       	push   $0x3ef
+f010226d:	68 f9 92 10 f0       	push   $0xf01092f9
+f0102272:	e8 db dd ff ff       	call   f0100052 <_panic>
+    assert(!page_alloc(0));
+f0102277:	68 55 94 10 f0       	push   $0xf0109455
+f010227c:	68 1f 93 10 f0       	push   $0xf010931f
+f0102281:	68 f2 03 00 00       	push   $0x3f2
+f0102286:	68 f9 92 10 f0       	push   $0xf01092f9
+f010228b:	e8 c2 dd ff ff       	call   f0100052 <_panic>
+    assert(page_insert(kern_pgdir, pp2, (void *) PGSIZE, PTE_W) == 0);
+f0102290:	68 ec 8b 10 f0       	push   $0xf0108bec
+f0102295:	68 1f 93 10 f0       	push   $0xf010931f
+f010229a:	68 f5 03 00 00       	push   $0x3f5
+f010229f:	68 f9 92 10 f0       	push   $0xf01092f9
+f01022a4:	e8 a9 dd ff ff       	call   f0100052 <_panic>
+    assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp2));
+f01022a9:	68 28 8c 10 f0       	push   $0xf0108c28
+f01022ae:	68 1f 93 10 f0       	push   $0xf010931f
+f01022b3:	68 f6 03 00 00       	push   $0x3f6
+f01022b8:	68 f9 92 10 f0       	push   $0xf01092f9
+f01022bd:	e8 90 dd ff ff       	call   f0100052 <_panic>
+    assert(pp2->pp_ref == 1);
+f01022c2:	68 c9 94 10 f0       	push   $0xf01094c9
+f01022c7:	68 1f 93 10 f0       	push   $0xf010931f
+f01022cc:	68 f7 03 00 00       	push   $0x3f7
+f01022d1:	68 f9 92 10 f0       	push   $0xf01092f9
+f01022d6:	e8 77 dd ff ff       	call   f0100052 <_panic>
+    assert(!page_alloc(0));
+f01022db:	68 55 94 10 f0       	push   $0xf0109455
+f01022e0:	68 1f 93 10 f0       	push   $0xf010931f
+f01022e5:	68 fb 03 00 00       	push   $0x3fb
+f01022ea:	68 f9 92 10 f0       	push   $0xf01092f9
+f01022ef:	e8 5e dd ff ff       	call   f0100052 <_panic>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f01022f4:	56                   	push   %esi
+f01022f5:	68 64 82 10 f0       	push   $0xf0108264
+f01022fa:	68 fe 03 00 00       	push   $0x3fe
+f01022ff:	68 f9 92 10 f0       	push   $0xf01092f9
+f0102304:	e8 49 dd ff ff       	call   f0100052 <_panic>
+    assert(pgdir_walk(kern_pgdir, (void *) PGSIZE, 0) == ptep + PTX(PGSIZE));
+f0102309:	68 58 8c 10 f0       	push   $0xf0108c58
+f010230e:	68 1f 93 10 f0       	push   $0xf010931f
+f0102313:	68 ff 03 00 00       	push   $0x3ff
+f0102318:	68 f9 92 10 f0       	push   $0xf01092f9
+f010231d:	e8 30 dd ff ff       	call   f0100052 <_panic>
+    assert(page_insert(kern_pgdir, pp2, (void *) PGSIZE, PTE_W | PTE_U) == 0);
+f0102322:	68 9c 8c 10 f0       	push   $0xf0108c9c
+f0102327:	68 1f 93 10 f0       	push   $0xf010931f
+f010232c:	68 02 04 00 00       	push   $0x402
+f0102331:	68 f9 92 10 f0       	push   $0xf01092f9
+f0102336:	e8 17 dd ff ff       	call   f0100052 <_panic>
+    assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp2));
+f010233b:	68 28 8c 10 f0       	push   $0xf0108c28
+f0102340:	68 1f 93 10 f0       	push   $0xf010931f
+f0102345:	68 03 04 00 00       	push   $0x403
+f010234a:	68 f9 92 10 f0       	push   $0xf01092f9
+f010234f:	e8 fe dc ff ff       	call   f0100052 <_panic>
+    assert(pp2->pp_ref == 1);
+f0102354:	68 c9 94 10 f0       	push   $0xf01094c9
+f0102359:	68 1f 93 10 f0       	push   $0xf010931f
+f010235e:	68 04 04 00 00       	push   $0x404
+f0102363:	68 f9 92 10 f0       	push   $0xf01092f9
+f0102368:	e8 e5 dc ff ff       	call   f0100052 <_panic>
+    assert(*pgdir_walk(kern_pgdir, (void *) PGSIZE, 0) & PTE_U);
+f010236d:	68 e0 8c 10 f0       	push   $0xf0108ce0
+f0102372:	68 1f 93 10 f0       	push   $0xf010931f
+f0102377:	68 05 04 00 00       	push   $0x405
+f010237c:	68 f9 92 10 f0       	push   $0xf01092f9
+f0102381:	e8 cc dc ff ff       	call   f0100052 <_panic>
+    assert(kern_pgdir[0] & PTE_U);
+f0102386:	68 da 94 10 f0       	push   $0xf01094da
+f010238b:	68 1f 93 10 f0       	push   $0xf010931f
+f0102390:	68 06 04 00 00       	push   $0x406
+f0102395:	68 f9 92 10 f0       	push   $0xf01092f9
+f010239a:	e8 b3 dc ff ff       	call   f0100052 <_panic>
+    assert(page_insert(kern_pgdir, pp2, (void *) PGSIZE, PTE_W) == 0);
+f010239f:	68 ec 8b 10 f0       	push   $0xf0108bec
+f01023a4:	68 1f 93 10 f0       	push   $0xf010931f
+f01023a9:	68 09 04 00 00       	push   $0x409
+f01023ae:	68 f9 92 10 f0       	push   $0xf01092f9
+f01023b3:	e8 9a dc ff ff       	call   f0100052 <_panic>
+    assert(*pgdir_walk(kern_pgdir, (void *) PGSIZE, 0) & PTE_W);
+f01023b8:	68 14 8d 10 f0       	push   $0xf0108d14
+f01023bd:	68 1f 93 10 f0       	push   $0xf010931f
+f01023c2:	68 0a 04 00 00       	push   $0x40a
+f01023c7:	68 f9 92 10 f0       	push   $0xf01092f9
+f01023cc:	e8 81 dc ff ff       	call   f0100052 <_panic>
+    assert(!(*pgdir_walk(kern_pgdir, (void *) PGSIZE, 0) & PTE_U));
+f01023d1:	68 48 8d 10 f0       	push   $0xf0108d48
+f01023d6:	68 1f 93 10 f0       	push   $0xf010931f
+f01023db:	68 0b 04 00 00       	push   $0x40b
+f01023e0:	68 f9 92 10 f0       	push   $0xf01092f9
+f01023e5:	e8 68 dc ff ff       	call   f0100052 <_panic>
+    assert(page_insert(kern_pgdir, pp0, (void *) PTSIZE, PTE_W) < 0);
+f01023ea:	68 80 8d 10 f0       	push   $0xf0108d80
+f01023ef:	68 1f 93 10 f0       	push   $0xf010931f
+f01023f4:	68 0e 04 00 00       	push   $0x40e
+f01023f9:	68 f9 92 10 f0       	push   $0xf01092f9
+f01023fe:	e8 4f dc ff ff       	call   f0100052 <_panic>
+    assert(page_insert(kern_pgdir, pp1, (void *) PGSIZE, PTE_W) == 0);
+f0102403:	68 bc 8d 10 f0       	push   $0xf0108dbc
+f0102408:	68 1f 93 10 f0       	push   $0xf010931f
+f010240d:	68 11 04 00 00       	push   $0x411
+f0102412:	68 f9 92 10 f0       	push   $0xf01092f9
+f0102417:	e8 36 dc ff ff       	call   f0100052 <_panic>
+    assert(!(*pgdir_walk(kern_pgdir, (void *) PGSIZE, 0) & PTE_U));
+f010241c:	68 48 8d 10 f0       	push   $0xf0108d48
+f0102421:	68 1f 93 10 f0       	push   $0xf010931f
+f0102426:	68 12 04 00 00       	push   $0x412
+f010242b:	68 f9 92 10 f0       	push   $0xf01092f9
+f0102430:	e8 1d dc ff ff       	call   f0100052 <_panic>
+    assert(check_va2pa(kern_pgdir, 0) == page2pa(pp1));
+f0102435:	68 f8 8d 10 f0       	push   $0xf0108df8
+f010243a:	68 1f 93 10 f0       	push   $0xf010931f
+f010243f:	68 15 04 00 00       	push   $0x415
+f0102444:	68 f9 92 10 f0       	push   $0xf01092f9
+f0102449:	e8 04 dc ff ff       	call   f0100052 <_panic>
+    assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp1));
+f010244e:	68 24 8e 10 f0       	push   $0xf0108e24
+f0102453:	68 1f 93 10 f0       	push   $0xf010931f
+f0102458:	68 16 04 00 00       	push   $0x416
+f010245d:	68 f9 92 10 f0       	push   $0xf01092f9
+f0102462:	e8 eb db ff ff       	call   f0100052 <_panic>
+    assert(pp1->pp_ref == 2);
+f0102467:	68 f0 94 10 f0       	push   $0xf01094f0
+f010246c:	68 1f 93 10 f0       	push   $0xf010931f
+f0102471:	68 18 04 00 00       	push   $0x418
+f0102476:	68 f9 92 10 f0       	push   $0xf01092f9
+f010247b:	e8 d2 db ff ff       	call   f0100052 <_panic>
+    assert(pp2->pp_ref == 0);
+f0102480:	68 01 95 10 f0       	push   $0xf0109501
+f0102485:	68 1f 93 10 f0       	push   $0xf010931f
+f010248a:	68 19 04 00 00       	push   $0x419
+f010248f:	68 f9 92 10 f0       	push   $0xf01092f9
+f0102494:	e8 b9 db ff ff       	call   f0100052 <_panic>
+    assert((pp = page_alloc(0)) && pp == pp2);
+f0102499:	68 54 8e 10 f0       	push   $0xf0108e54
+f010249e:	68 1f 93 10 f0       	push   $0xf010931f
+f01024a3:	68 1c 04 00 00       	push   $0x41c
+f01024a8:	68 f9 92 10 f0       	push   $0xf01092f9
+f01024ad:	e8 a0 db ff ff       	call   f0100052 <_panic>
+    assert(check_va2pa(kern_pgdir, 0x0) == ~0);
+f01024b2:	68 78 8e 10 f0       	push   $0xf0108e78
+f01024b7:	68 1f 93 10 f0       	push   $0xf010931f
+f01024bc:	68 20 04 00 00       	push   $0x420
+f01024c1:	68 f9 92 10 f0       	push   $0xf01092f9
+f01024c6:	e8 87 db ff ff       	call   f0100052 <_panic>
+    assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp1));
+f01024cb:	68 24 8e 10 f0       	push   $0xf0108e24
+f01024d0:	68 1f 93 10 f0       	push   $0xf010931f
+f01024d5:	68 21 04 00 00       	push   $0x421
+f01024da:	68 f9 92 10 f0       	push   $0xf01092f9
+f01024df:	e8 6e db ff ff       	call   f0100052 <_panic>
+    assert(pp1->pp_ref == 1);
+f01024e4:	68 a7 94 10 f0       	push   $0xf01094a7
+f01024e9:	68 1f 93 10 f0       	push   $0xf010931f
+f01024ee:	68 22 04 00 00       	push   $0x422
+f01024f3:	68 f9 92 10 f0       	push   $0xf01092f9
+f01024f8:	e8 55 db ff ff       	call   f0100052 <_panic>
+    assert(pp2->pp_ref == 0);
+f01024fd:	68 01 95 10 f0       	push   $0xf0109501
+f0102502:	68 1f 93 10 f0       	push   $0xf010931f
+f0102507:	68 23 04 00 00       	push   $0x423
+f010250c:	68 f9 92 10 f0       	push   $0xf01092f9
+f0102511:	e8 3c db ff ff       	call   f0100052 <_panic>
+    assert(page_insert(kern_pgdir, pp1, (void *) PGSIZE, 0) == 0);
+f0102516:	68 9c 8e 10 f0       	push   $0xf0108e9c
+f010251b:	68 1f 93 10 f0       	push   $0xf010931f
+f0102520:	68 26 04 00 00       	push   $0x426
+f0102525:	68 f9 92 10 f0       	push   $0xf01092f9
+f010252a:	e8 23 db ff ff       	call   f0100052 <_panic>
+    assert(pp1->pp_ref);
+f010252f:	68 12 95 10 f0       	push   $0xf0109512
+f0102534:	68 1f 93 10 f0       	push   $0xf010931f
+f0102539:	68 27 04 00 00       	push   $0x427
+f010253e:	68 f9 92 10 f0       	push   $0xf01092f9
+f0102543:	e8 0a db ff ff       	call   f0100052 <_panic>
+    assert(pp1->pp_link == NULL);
+f0102548:	68 1e 95 10 f0       	push   $0xf010951e
+f010254d:	68 1f 93 10 f0       	push   $0xf010931f
+f0102552:	68 28 04 00 00       	push   $0x428
+f0102557:	68 f9 92 10 f0       	push   $0xf01092f9
+f010255c:	e8 f1 da ff ff       	call   f0100052 <_panic>
+    assert(check_va2pa(kern_pgdir, 0x0) == ~0);
+f0102561:	68 78 8e 10 f0       	push   $0xf0108e78
+f0102566:	68 1f 93 10 f0       	push   $0xf010931f
+f010256b:	68 2c 04 00 00       	push   $0x42c
+f0102570:	68 f9 92 10 f0       	push   $0xf01092f9
+f0102575:	e8 d8 da ff ff       	call   f0100052 <_panic>
+    assert(check_va2pa(kern_pgdir, PGSIZE) == ~0);
+f010257a:	68 d4 8e 10 f0       	push   $0xf0108ed4
+f010257f:	68 1f 93 10 f0       	push   $0xf010931f
+f0102584:	68 2d 04 00 00       	push   $0x42d
+f0102589:	68 f9 92 10 f0       	push   $0xf01092f9
+f010258e:	e8 bf da ff ff       	call   f0100052 <_panic>
+    assert(pp1->pp_ref == 0);
+f0102593:	68 33 95 10 f0       	push   $0xf0109533
+f0102598:	68 1f 93 10 f0       	push   $0xf010931f
+f010259d:	68 2e 04 00 00       	push   $0x42e
+f01025a2:	68 f9 92 10 f0       	push   $0xf01092f9
+f01025a7:	e8 a6 da ff ff       	call   f0100052 <_panic>
+    assert(pp2->pp_ref == 0);
+f01025ac:	68 01 95 10 f0       	push   $0xf0109501
+f01025b1:	68 1f 93 10 f0       	push   $0xf010931f
+f01025b6:	68 2f 04 00 00       	push   $0x42f
+f01025bb:	68 f9 92 10 f0       	push   $0xf01092f9
+f01025c0:	e8 8d da ff ff       	call   f0100052 <_panic>
+    assert((pp = page_alloc(0)) && pp == pp1);
+f01025c5:	68 fc 8e 10 f0       	push   $0xf0108efc
+f01025ca:	68 1f 93 10 f0       	push   $0xf010931f
+f01025cf:	68 32 04 00 00       	push   $0x432
+f01025d4:	68 f9 92 10 f0       	push   $0xf01092f9
+f01025d9:	e8 74 da ff ff       	call   f0100052 <_panic>
+    assert(!page_alloc(0));
+f01025de:	68 55 94 10 f0       	push   $0xf0109455
+f01025e3:	68 1f 93 10 f0       	push   $0xf010931f
+f01025e8:	68 35 04 00 00       	push   $0x435
+f01025ed:	68 f9 92 10 f0       	push   $0xf01092f9
+f01025f2:	e8 5b da ff ff       	call   f0100052 <_panic>
+    assert(PTE_ADDR(kern_pgdir[0]) == page2pa(pp0));
+f01025f7:	68 94 8b 10 f0       	push   $0xf0108b94
+f01025fc:	68 1f 93 10 f0       	push   $0xf010931f
+f0102601:	68 38 04 00 00       	push   $0x438
+f0102606:	68 f9 92 10 f0       	push   $0xf01092f9
+f010260b:	e8 42 da ff ff       	call   f0100052 <_panic>
+    assert(pp0->pp_ref == 1);
+f0102610:	68 b8 94 10 f0       	push   $0xf01094b8
+f0102615:	68 1f 93 10 f0       	push   $0xf010931f
+f010261a:	68 3a 04 00 00       	push   $0x43a
+f010261f:	68 f9 92 10 f0       	push   $0xf01092f9
+f0102624:	e8 29 da ff ff       	call   f0100052 <_panic>
+f0102629:	56                   	push   %esi
+f010262a:	68 64 82 10 f0       	push   $0xf0108264
+f010262f:	68 41 04 00 00       	push   $0x441
+f0102634:	68 f9 92 10 f0       	push   $0xf01092f9
+f0102639:	e8 14 da ff ff       	call   f0100052 <_panic>
+    assert(ptep == ptep1 + PTX(va));
+f010263e:	68 44 95 10 f0       	push   $0xf0109544
+f0102643:	68 1f 93 10 f0       	push   $0xf010931f
+f0102648:	68 42 04 00 00       	push   $0x442
+f010264d:	68 f9 92 10 f0       	push   $0xf01092f9
+f0102652:	e8 fb d9 ff ff       	call   f0100052 <_panic>
+f0102657:	51                   	push   %ecx
+f0102658:	68 64 82 10 f0       	push   $0xf0108264
+f010265d:	6a 5a                	push   $0x5a
+f010265f:	68 05 93 10 f0       	push   $0xf0109305
+f0102664:	e8 e9 d9 ff ff       	call   f0100052 <_panic>
+f0102669:	51                   	push   %ecx
+f010266a:	68 64 82 10 f0       	push   $0xf0108264
+f010266f:	6a 5a                	push   $0x5a
+f0102671:	68 05 93 10 f0       	push   $0xf0109305
+f0102676:	e8 d7 d9 ff ff       	call   f0100052 <_panic>
+    kern_pgdir[0] = 0;
+f010267b:	a1 cc 76 66 f0       	mov    0xf06676cc,%eax
+f0102680:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    pp0->pp_ref = 0;
+f0102686:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0102689:	66 c7 40 04 00 00    	movw   $0x0,0x4(%eax)
+
+    // give free list back
+    page_free_list = fl;
+f010268f:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+f0102692:	89 0d 40 42 62 f0    	mov    %ecx,0xf0624240
+
+    // free the pages we took
+    page_free(pp0);
+f0102698:	83 ec 0c             	sub    $0xc,%esp
+f010269b:	50                   	push   %eax
+f010269c:	e8 6d eb ff ff       	call   f010120e <page_free>
+    page_free(pp1);
+f01026a1:	89 3c 24             	mov    %edi,(%esp)
+f01026a4:	e8 65 eb ff ff       	call   f010120e <page_free>
+    page_free(pp2);
+f01026a9:	89 1c 24             	mov    %ebx,(%esp)
+f01026ac:	e8 5d eb ff ff       	call   f010120e <page_free>
+
+    // test mmio_map_region
+    mm1 = (uintptr_t) mmio_map_region(0, 4097);
+f01026b1:	83 c4 08             	add    $0x8,%esp
+f01026b4:	68 01 10 00 00       	push   $0x1001
+f01026b9:	6a 00                	push   $0x0
+f01026bb:	e8 e3 ed ff ff       	call   f01014a3 <mmio_map_region>
+f01026c0:	89 c3                	mov    %eax,%ebx
+    mm2 = (uintptr_t) mmio_map_region(0, 4096);
+f01026c2:	83 c4 08             	add    $0x8,%esp
+f01026c5:	68 00 10 00 00       	push   $0x1000
+f01026ca:	6a 00                	push   $0x0
+f01026cc:	e8 d2 ed ff ff       	call   f01014a3 <mmio_map_region>
+f01026d1:	89 c6                	mov    %eax,%esi
+    // check that they're in the right region
+    assert(mm1 >= MMIOBASE && mm1 + 8192 < MMIOLIM);
+f01026d3:	8d 83 00 20 00 00    	lea    0x2000(%ebx),%eax
+f01026d9:	83 c4 10             	add    $0x10,%esp
+f01026dc:	81 fb ff ff 7f ef    	cmp    $0xef7fffff,%ebx
+f01026e2:	0f 86 3c 02 00 00    	jbe    f0102924 <mem_init+0x141b>
+f01026e8:	3d ff ff bf ef       	cmp    $0xefbfffff,%eax
+f01026ed:	0f 87 31 02 00 00    	ja     f0102924 <mem_init+0x141b>
+    assert(mm2 >= MMIOBASE && mm2 + 8192 < MMIOLIM);
+f01026f3:	8d 96 00 20 00 00    	lea    0x2000(%esi),%edx
+f01026f9:	81 fa ff ff bf ef    	cmp    $0xefbfffff,%edx
+f01026ff:	0f 87 38 02 00 00    	ja     f010293d <mem_init+0x1434>
+f0102705:	81 fe ff ff 7f ef    	cmp    $0xef7fffff,%esi
+f010270b:	0f 86 2c 02 00 00    	jbe    f010293d <mem_init+0x1434>
+    // check that they're page-aligned
+    assert(mm1 % PGSIZE == 0 && mm2 % PGSIZE == 0);
+f0102711:	89 da                	mov    %ebx,%edx
+f0102713:	09 f2                	or     %esi,%edx
+f0102715:	f7 c2 ff 0f 00 00    	test   $0xfff,%edx
+f010271b:	0f 85 35 02 00 00    	jne    f0102956 <mem_init+0x144d>
+    // check that they don't overlap
+    assert(mm1 + 8192 <= mm2);
+f0102721:	39 c6                	cmp    %eax,%esi
+f0102723:	0f 82 46 02 00 00    	jb     f010296f <mem_init+0x1466>
+    // check page mappings
+    assert(check_va2pa(kern_pgdir, mm1) == 0);
+f0102729:	8b 3d cc 76 66 f0    	mov    0xf06676cc,%edi
+f010272f:	89 da                	mov    %ebx,%edx
+f0102731:	89 f8                	mov    %edi,%eax
+f0102733:	e8 52 e5 ff ff       	call   f0100c8a <check_va2pa>
+f0102738:	85 c0                	test   %eax,%eax
+f010273a:	0f 85 48 02 00 00    	jne    f0102988 <mem_init+0x147f>
+    assert(check_va2pa(kern_pgdir, mm1 + PGSIZE) == PGSIZE);
+f0102740:	8d 83 00 10 00 00    	lea    0x1000(%ebx),%eax
+f0102746:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f0102749:	89 c2                	mov    %eax,%edx
+f010274b:	89 f8                	mov    %edi,%eax
+f010274d:	e8 38 e5 ff ff       	call   f0100c8a <check_va2pa>
+f0102752:	3d 00 10 00 00       	cmp    $0x1000,%eax
+f0102757:	0f 85 44 02 00 00    	jne    f01029a1 <mem_init+0x1498>
+    assert(check_va2pa(kern_pgdir, mm2) == 0);
+f010275d:	89 f2                	mov    %esi,%edx
+f010275f:	89 f8                	mov    %edi,%eax
+f0102761:	e8 24 e5 ff ff       	call   f0100c8a <check_va2pa>
+f0102766:	85 c0                	test   %eax,%eax
+f0102768:	0f 85 4c 02 00 00    	jne    f01029ba <mem_init+0x14b1>
+    assert(check_va2pa(kern_pgdir, mm2 + PGSIZE) == ~0);
+f010276e:	8d 96 00 10 00 00    	lea    0x1000(%esi),%edx
+f0102774:	89 f8                	mov    %edi,%eax
+f0102776:	e8 0f e5 ff ff       	call   f0100c8a <check_va2pa>
+f010277b:	83 f8 ff             	cmp    $0xffffffff,%eax
+f010277e:	0f 85 4f 02 00 00    	jne    f01029d3 <mem_init+0x14ca>
+    // check permissions
+    assert(*pgdir_walk(kern_pgdir, (void *) mm1, 0) & (PTE_W | PTE_PWT | PTE_PCD));
+f0102784:	83 ec 04             	sub    $0x4,%esp
+f0102787:	6a 00                	push   $0x0
+f0102789:	53                   	push   %ebx
+f010278a:	57                   	push   %edi
+f010278b:	e8 02 eb ff ff       	call   f0101292 <pgdir_walk>
+f0102790:	83 c4 10             	add    $0x10,%esp
+f0102793:	f6 00 1a             	testb  $0x1a,(%eax)
+f0102796:	0f 84 50 02 00 00    	je     f01029ec <mem_init+0x14e3>
+    assert(!(*pgdir_walk(kern_pgdir, (void *) mm1, 0) & PTE_U));
+f010279c:	83 ec 04             	sub    $0x4,%esp
+f010279f:	6a 00                	push   $0x0
+f01027a1:	53                   	push   %ebx
+f01027a2:	ff 35 cc 76 66 f0    	push   0xf06676cc
+f01027a8:	e8 e5 ea ff ff       	call   f0101292 <pgdir_walk>
+f01027ad:	8b 00                	mov    (%eax),%eax
+f01027af:	83 c4 10             	add    $0x10,%esp
+f01027b2:	83 e0 04             	and    $0x4,%eax
+f01027b5:	89 c7                	mov    %eax,%edi
+f01027b7:	0f 85 48 02 00 00    	jne    f0102a05 <mem_init+0x14fc>
+    // clear the mappings
+    *pgdir_walk(kern_pgdir, (void *) mm1, 0) = 0;
+f01027bd:	83 ec 04             	sub    $0x4,%esp
+f01027c0:	6a 00                	push   $0x0
+f01027c2:	53                   	push   %ebx
+f01027c3:	ff 35 cc 76 66 f0    	push   0xf06676cc
+f01027c9:	e8 c4 ea ff ff       	call   f0101292 <pgdir_walk>
+f01027ce:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    *pgdir_walk(kern_pgdir, (void *) mm1 + PGSIZE, 0) = 0;
+f01027d4:	83 c4 0c             	add    $0xc,%esp
+f01027d7:	6a 00                	push   $0x0
+f01027d9:	ff 75 d4             	push   -0x2c(%ebp)
+f01027dc:	ff 35 cc 76 66 f0    	push   0xf06676cc
+f01027e2:	e8 ab ea ff ff       	call   f0101292 <pgdir_walk>
+f01027e7:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    *pgdir_walk(kern_pgdir, (void *) mm2, 0) = 0;
+f01027ed:	83 c4 0c             	add    $0xc,%esp
+f01027f0:	6a 00                	push   $0x0
+f01027f2:	56                   	push   %esi
+f01027f3:	ff 35 cc 76 66 f0    	push   0xf06676cc
+f01027f9:	e8 94 ea ff ff       	call   f0101292 <pgdir_walk>
+f01027fe:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+
+    cprintf("check_page() succeeded!\n");
+f0102804:	c7 04 24 85 95 10 f0 	movl   $0xf0109585,(%esp)
+f010280b:	e8 ca 1b 00 00       	call   f01043da <cprintf>
+    boot_map_region(kern_pgdir, UPAGES, PTSIZE, PADDR(pages), PTE_U);
+f0102810:	a1 d0 76 66 f0       	mov    0xf06676d0,%eax
+	if ((uint32_t)kva < KERNBASE)
+f0102815:	83 c4 10             	add    $0x10,%esp
+f0102818:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f010281d:	0f 86 fb 01 00 00    	jbe    f0102a1e <mem_init+0x1515>
+f0102823:	83 ec 0c             	sub    $0xc,%esp
+f0102826:	6a 04                	push   $0x4
+	return (physaddr_t)kva - KERNBASE;
+f0102828:	05 00 00 00 10       	add    $0x10000000,%eax
+f010282d:	50                   	push   %eax
+f010282e:	68 00 00 40 00       	push   $0x400000
+f0102833:	68 00 00 00 ef       	push   $0xef000000
+f0102838:	ff 35 cc 76 66 f0    	push   0xf06676cc
+f010283e:	e8 dc ea ff ff       	call   f010131f <boot_map_region>
+    boot_map_region(kern_pgdir, UENVS, PTSIZE, PADDR(envs), PTE_U);
+f0102843:	a1 60 42 62 f0       	mov    0xf0624260,%eax
+	if ((uint32_t)kva < KERNBASE)
+f0102848:	83 c4 20             	add    $0x20,%esp
+f010284b:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0102850:	0f 86 dd 01 00 00    	jbe    f0102a33 <mem_init+0x152a>
+f0102856:	83 ec 0c             	sub    $0xc,%esp
+f0102859:	6a 04                	push   $0x4
+	return (physaddr_t)kva - KERNBASE;
+f010285b:	05 00 00 00 10       	add    $0x10000000,%eax
+f0102860:	50                   	push   %eax
+f0102861:	68 00 00 40 00       	push   $0x400000
+f0102866:	68 00 00 c0 ee       	push   $0xeec00000
+f010286b:	ff 35 cc 76 66 f0    	push   0xf06676cc
+f0102871:	e8 a9 ea ff ff       	call   f010131f <boot_map_region>
+	if ((uint32_t)kva < KERNBASE)
+f0102876:	83 c4 20             	add    $0x20,%esp
+f0102879:	b8 00 c0 10 f0       	mov    $0xf010c000,%eax
+f010287e:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0102883:	0f 86 bf 01 00 00    	jbe    f0102a48 <mem_init+0x153f>
+    boot_map_region(kern_pgdir, KSTACKTOP - KSTKSIZE, KSTKSIZE, PADDR(bootstack), PTE_W);
+f0102889:	83 ec 0c             	sub    $0xc,%esp
+f010288c:	6a 02                	push   $0x2
+f010288e:	68 00 c0 10 00       	push   $0x10c000
+f0102893:	68 00 80 00 00       	push   $0x8000
+f0102898:	68 00 80 ff ef       	push   $0xefff8000
+f010289d:	ff 35 cc 76 66 f0    	push   0xf06676cc
+f01028a3:	e8 77 ea ff ff       	call   f010131f <boot_map_region>
+    boot_map_region(kern_pgdir, KERNBASE, -KERNBASE, 0, PTE_W);
+f01028a8:	83 c4 14             	add    $0x14,%esp
+f01028ab:	6a 02                	push   $0x2
+f01028ad:	6a 00                	push   $0x0
+f01028af:	68 00 00 00 10       	push   $0x10000000
+f01028b4:	68 00 00 00 f0       	push   $0xf0000000
+f01028b9:	ff 35 cc 76 66 f0    	push   0xf06676cc
+f01028bf:	e8 5b ea ff ff       	call   f010131f <boot_map_region>
+    for (int i = 0; i < NCPU; ++i) {
+f01028c4:	c7 45 d4 00 90 66 f0 	movl   $0xf0669000,-0x2c(%ebp)
+f01028cb:	be 00 90 6a f0       	mov    $0xf06a9000,%esi
+f01028d0:	83 c4 20             	add    $0x20,%esp
+f01028d3:	b8 00 90 66 f0       	mov    $0xf0669000,%eax
+f01028d8:	bb 00 80 ff ef       	mov    $0xefff8000,%ebx
+f01028dd:	89 7d d0             	mov    %edi,-0x30(%ebp)
+f01028e0:	89 c7                	mov    %eax,%edi
+f01028e2:	39 f7                	cmp    %esi,%edi
+f01028e4:	0f 84 88 01 00 00    	je     f0102a72 <mem_init+0x1569>
+f01028ea:	81 ff ff ff ff ef    	cmp    $0xefffffff,%edi
+f01028f0:	0f 86 67 01 00 00    	jbe    f0102a5d <mem_init+0x1554>
+        boot_map_region(kern_pgdir, i_stacktop - KSTKSIZE, KSTKSIZE, PADDR(percpu_kstacks[i]), PTE_W);
+f01028f6:	83 ec 0c             	sub    $0xc,%esp
+f01028f9:	6a 02                	push   $0x2
+	return (physaddr_t)kva - KERNBASE;
+f01028fb:	8d 87 00 00 00 10    	lea    0x10000000(%edi),%eax
+f0102901:	50                   	push   %eax
+f0102902:	68 00 80 00 00       	push   $0x8000
+f0102907:	53                   	push   %ebx
+f0102908:	ff 35 cc 76 66 f0    	push   0xf06676cc
+f010290e:	e8 0c ea ff ff       	call   f010131f <boot_map_region>
+    for (int i = 0; i < NCPU; ++i) {
+f0102913:	81 eb 00 00 01 00    	sub    $0x10000,%ebx
+f0102919:	81 c7 00 80 00 00    	add    $0x8000,%edi
+f010291f:	83 c4 20             	add    $0x20,%esp
+f0102922:	eb be                	jmp    f01028e2 <mem_init+0x13d9>
+    assert(mm1 >= MMIOBASE && mm1 + 8192 < MMIOLIM);
+f0102924:	68 20 8f 10 f0       	push   $0xf0108f20
+f0102929:	68 1f 93 10 f0       	push   $0xf010931f
+f010292e:	68 5c 04 00 00       	push   $0x45c
+f0102933:	68 f9 92 10 f0       	push   $0xf01092f9
+f0102938:	e8 15 d7 ff ff       	call   f0100052 <_panic>
+    assert(mm2 >= MMIOBASE && mm2 + 8192 < MMIOLIM);
+f010293d:	68 48 8f 10 f0       	push   $0xf0108f48
+f0102942:	68 1f 93 10 f0       	push   $0xf010931f
+f0102947:	68 5d 04 00 00       	push   $0x45d
+f010294c:	68 f9 92 10 f0       	push   $0xf01092f9
+f0102951:	e8 fc d6 ff ff       	call   f0100052 <_panic>
+    assert(mm1 % PGSIZE == 0 && mm2 % PGSIZE == 0);
+f0102956:	68 70 8f 10 f0       	push   $0xf0108f70
+f010295b:	68 1f 93 10 f0       	push   $0xf010931f
+f0102960:	68 5f 04 00 00       	push   $0x45f
+f0102965:	68 f9 92 10 f0       	push   $0xf01092f9
+f010296a:	e8 e3 d6 ff ff       	call   f0100052 <_panic>
+    assert(mm1 + 8192 <= mm2);
+f010296f:	68 73 95 10 f0       	push   $0xf0109573
+f0102974:	68 1f 93 10 f0       	push   $0xf010931f
+f0102979:	68 61 04 00 00       	push   $0x461
+f010297e:	68 f9 92 10 f0       	push   $0xf01092f9
+f0102983:	e8 ca d6 ff ff       	call   f0100052 <_panic>
+    assert(check_va2pa(kern_pgdir, mm1) == 0);
+f0102988:	68 98 8f 10 f0       	push   $0xf0108f98
+f010298d:	68 1f 93 10 f0       	push   $0xf010931f
+f0102992:	68 63 04 00 00       	push   $0x463
+f0102997:	68 f9 92 10 f0       	push   $0xf01092f9
+f010299c:	e8 b1 d6 ff ff       	call   f0100052 <_panic>
+    assert(check_va2pa(kern_pgdir, mm1 + PGSIZE) == PGSIZE);
+f01029a1:	68 bc 8f 10 f0       	push   $0xf0108fbc
+f01029a6:	68 1f 93 10 f0       	push   $0xf010931f
+f01029ab:	68 64 04 00 00       	push   $0x464
+f01029b0:	68 f9 92 10 f0       	push   $0xf01092f9
+f01029b5:	e8 98 d6 ff ff       	call   f0100052 <_panic>
+    assert(check_va2pa(kern_pgdir, mm2) == 0);
+f01029ba:	68 ec 8f 10 f0       	push   $0xf0108fec
+f01029bf:	68 1f 93 10 f0       	push   $0xf010931f
+f01029c4:	68 65 04 00 00       	push   $0x465
+f01029c9:	68 f9 92 10 f0       	push   $0xf01092f9
+f01029ce:	e8 7f d6 ff ff       	call   f0100052 <_panic>
+    assert(check_va2pa(kern_pgdir, mm2 + PGSIZE) == ~0);
+f01029d3:	68 10 90 10 f0       	push   $0xf0109010
+f01029d8:	68 1f 93 10 f0       	push   $0xf010931f
+f01029dd:	68 66 04 00 00       	push   $0x466
+f01029e2:	68 f9 92 10 f0       	push   $0xf01092f9
+f01029e7:	e8 66 d6 ff ff       	call   f0100052 <_panic>
+    assert(*pgdir_walk(kern_pgdir, (void *) mm1, 0) & (PTE_W | PTE_PWT | PTE_PCD));
+f01029ec:	68 3c 90 10 f0       	push   $0xf010903c
+f01029f1:	68 1f 93 10 f0       	push   $0xf010931f
+f01029f6:	68 68 04 00 00       	push   $0x468
+f01029fb:	68 f9 92 10 f0       	push   $0xf01092f9
+f0102a00:	e8 4d d6 ff ff       	call   f0100052 <_panic>
+    assert(!(*pgdir_walk(kern_pgdir, (void *) mm1, 0) & PTE_U));
+f0102a05:	68 84 90 10 f0       	push   $0xf0109084
+f0102a0a:	68 1f 93 10 f0       	push   $0xf010931f
+f0102a0f:	68 69 04 00 00       	push   $0x469
+f0102a14:	68 f9 92 10 f0       	push   $0xf01092f9
+f0102a19:	e8 34 d6 ff ff       	call   f0100052 <_panic>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0102a1e:	50                   	push   %eax
+f0102a1f:	68 88 82 10 f0       	push   $0xf0108288
+f0102a24:	68 d4 00 00 00       	push   $0xd4
+f0102a29:	68 f9 92 10 f0       	push   $0xf01092f9
+f0102a2e:	e8 1f d6 ff ff       	call   f0100052 <_panic>
+f0102a33:	50                   	push   %eax
+f0102a34:	68 88 82 10 f0       	push   $0xf0108288
+f0102a39:	68 dc 00 00 00       	push   $0xdc
+f0102a3e:	68 f9 92 10 f0       	push   $0xf01092f9
+f0102a43:	e8 0a d6 ff ff       	call   f0100052 <_panic>
+f0102a48:	50                   	push   %eax
+f0102a49:	68 88 82 10 f0       	push   $0xf0108288
+f0102a4e:	68 e8 00 00 00       	push   $0xe8
+f0102a53:	68 f9 92 10 f0       	push   $0xf01092f9
+f0102a58:	e8 f5 d5 ff ff       	call   f0100052 <_panic>
+f0102a5d:	57                   	push   %edi
+f0102a5e:	68 88 82 10 f0       	push   $0xf0108288
+f0102a63:	68 29 01 00 00       	push   $0x129
+f0102a68:	68 f9 92 10 f0       	push   $0xf01092f9
+f0102a6d:	e8 e0 d5 ff ff       	call   f0100052 <_panic>
+    pgdir = kern_pgdir;
+f0102a72:	89 7d bc             	mov    %edi,-0x44(%ebp)
+f0102a75:	8b 7d d0             	mov    -0x30(%ebp),%edi
+f0102a78:	a1 cc 76 66 f0       	mov    0xf06676cc,%eax
+f0102a7d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+    n = ROUNDUP(npages * sizeof(struct PageInfo), PGSIZE);
+f0102a80:	a1 c8 76 66 f0       	mov    0xf06676c8,%eax
+f0102a85:	89 45 c8             	mov    %eax,-0x38(%ebp)
+f0102a88:	8d 04 c5 ff 0f 00 00 	lea    0xfff(,%eax,8),%eax
+f0102a8f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f0102a94:	89 c6                	mov    %eax,%esi
+        assert(check_va2pa(pgdir, UPAGES + i) == PADDR(pages) + i);
+f0102a96:	a1 d0 76 66 f0       	mov    0xf06676d0,%eax
+f0102a9b:	89 45 cc             	mov    %eax,-0x34(%ebp)
+	return (physaddr_t)kva - KERNBASE;
+f0102a9e:	05 00 00 00 10       	add    $0x10000000,%eax
+    for (i = 0; i < n; i += PGSIZE)
+f0102aa3:	89 fb                	mov    %edi,%ebx
+f0102aa5:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+f0102aa8:	89 c7                	mov    %eax,%edi
+f0102aaa:	eb 1d                	jmp    f0102ac9 <mem_init+0x15c0>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0102aac:	ff 75 cc             	push   -0x34(%ebp)
+f0102aaf:	68 88 82 10 f0       	push   $0xf0108288
+f0102ab4:	68 75 03 00 00       	push   $0x375
+f0102ab9:	68 f9 92 10 f0       	push   $0xf01092f9
+f0102abe:	e8 8f d5 ff ff       	call   f0100052 <_panic>
+f0102ac3:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f0102ac9:	39 f3                	cmp    %esi,%ebx
+f0102acb:	73 37                	jae    f0102b04 <mem_init+0x15fb>
+        assert(check_va2pa(pgdir, UPAGES + i) == PADDR(pages) + i);
+f0102acd:	8d 93 00 00 00 ef    	lea    -0x11000000(%ebx),%edx
+f0102ad3:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0102ad6:	e8 af e1 ff ff       	call   f0100c8a <check_va2pa>
+	if ((uint32_t)kva < KERNBASE)
+f0102adb:	81 7d cc ff ff ff ef 	cmpl   $0xefffffff,-0x34(%ebp)
+f0102ae2:	76 c8                	jbe    f0102aac <mem_init+0x15a3>
+f0102ae4:	8d 14 3b             	lea    (%ebx,%edi,1),%edx
+f0102ae7:	39 d0                	cmp    %edx,%eax
+f0102ae9:	74 d8                	je     f0102ac3 <mem_init+0x15ba>
+f0102aeb:	68 b8 90 10 f0       	push   $0xf01090b8
+f0102af0:	68 1f 93 10 f0       	push   $0xf010931f
+f0102af5:	68 75 03 00 00       	push   $0x375
+f0102afa:	68 f9 92 10 f0       	push   $0xf01092f9
+f0102aff:	e8 4e d5 ff ff       	call   f0100052 <_panic>
+        assert(check_va2pa(pgdir, UENVS + i) == PADDR(envs) + i);
+f0102b04:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+f0102b07:	8b 15 60 42 62 f0    	mov    0xf0624260,%edx
+f0102b0d:	bb 00 00 c0 ee       	mov    $0xeec00000,%ebx
+f0102b12:	8d b2 00 f0 3f 21    	lea    0x213ff000(%edx),%esi
+f0102b18:	89 7d cc             	mov    %edi,-0x34(%ebp)
+f0102b1b:	89 d7                	mov    %edx,%edi
+f0102b1d:	89 da                	mov    %ebx,%edx
+f0102b1f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0102b22:	e8 63 e1 ff ff       	call   f0100c8a <check_va2pa>
+f0102b27:	81 ff ff ff ff ef    	cmp    $0xefffffff,%edi
+f0102b2d:	76 55                	jbe    f0102b84 <mem_init+0x167b>
+f0102b2f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f0102b35:	8d 14 1e             	lea    (%esi,%ebx,1),%edx
+f0102b38:	39 d0                	cmp    %edx,%eax
+f0102b3a:	75 5d                	jne    f0102b99 <mem_init+0x1690>
+    for (i = 0; i < n; i += PGSIZE)
+f0102b3c:	81 fb 00 40 c2 ee    	cmp    $0xeec24000,%ebx
+f0102b42:	75 d9                	jne    f0102b1d <mem_init+0x1614>
+    if (!(*pgdir & PTE_P) | !(*pgdir & PTE_PS))
+f0102b44:	8b 7d cc             	mov    -0x34(%ebp),%edi
+f0102b47:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0102b4a:	8b 90 00 0f 00 00    	mov    0xf00(%eax),%edx
+f0102b50:	89 d0                	mov    %edx,%eax
+f0102b52:	25 81 00 00 00       	and    $0x81,%eax
+f0102b57:	3d 81 00 00 00       	cmp    $0x81,%eax
+f0102b5c:	75 13                	jne    f0102b71 <mem_init+0x1668>
+        for (i = 0; i < npages * PGSIZE; i += PTSIZE)
+f0102b5e:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+f0102b61:	c1 e3 0c             	shl    $0xc,%ebx
+f0102b64:	89 f8                	mov    %edi,%eax
+f0102b66:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+    if (check_va2pa_large(pgdir, KERNBASE) == 0) {
+f0102b69:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+f0102b6f:	76 50                	jbe    f0102bc1 <mem_init+0x16b8>
+        for (i = 0; i < npages * PGSIZE; i += PGSIZE)
+f0102b71:	8b 75 c8             	mov    -0x38(%ebp),%esi
+f0102b74:	c1 e6 0c             	shl    $0xc,%esi
+f0102b77:	89 fb                	mov    %edi,%ebx
+f0102b79:	89 7d cc             	mov    %edi,-0x34(%ebp)
+f0102b7c:	8b 7d d0             	mov    -0x30(%ebp),%edi
+f0102b7f:	e9 b2 00 00 00       	jmp    f0102c36 <mem_init+0x172d>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0102b84:	57                   	push   %edi
+f0102b85:	68 88 82 10 f0       	push   $0xf0108288
+f0102b8a:	68 7a 03 00 00       	push   $0x37a
+f0102b8f:	68 f9 92 10 f0       	push   $0xf01092f9
+f0102b94:	e8 b9 d4 ff ff       	call   f0100052 <_panic>
+        assert(check_va2pa(pgdir, UENVS + i) == PADDR(envs) + i);
+f0102b99:	68 ec 90 10 f0       	push   $0xf01090ec
+f0102b9e:	68 1f 93 10 f0       	push   $0xf010931f
+f0102ba3:	68 7a 03 00 00       	push   $0x37a
+f0102ba8:	68 f9 92 10 f0       	push   $0xf01092f9
+f0102bad:	e8 a0 d4 ff ff       	call   f0100052 <_panic>
+    return PTE_ADDR(*pgdir);
+f0102bb2:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+            assert(check_va2pa_large(pgdir, KERNBASE + i) == i);
+f0102bb8:	39 d0                	cmp    %edx,%eax
+f0102bba:	75 25                	jne    f0102be1 <mem_init+0x16d8>
+        for (i = 0; i < npages * PGSIZE; i += PTSIZE)
+f0102bbc:	05 00 00 40 00       	add    $0x400000,%eax
+f0102bc1:	39 d8                	cmp    %ebx,%eax
+f0102bc3:	73 35                	jae    f0102bfa <mem_init+0x16f1>
+            assert(check_va2pa_large(pgdir, KERNBASE + i) == i);
+f0102bc5:	8d 90 00 00 00 f0    	lea    -0x10000000(%eax),%edx
+    pgdir = &pgdir[PDX(va)];
+f0102bcb:	c1 ea 16             	shr    $0x16,%edx
+    if (!(*pgdir & PTE_P) | !(*pgdir & PTE_PS))
+f0102bce:	8b 14 91             	mov    (%ecx,%edx,4),%edx
+f0102bd1:	89 d6                	mov    %edx,%esi
+f0102bd3:	81 e6 81 00 00 00    	and    $0x81,%esi
+f0102bd9:	81 fe 81 00 00 00    	cmp    $0x81,%esi
+f0102bdf:	74 d1                	je     f0102bb2 <mem_init+0x16a9>
+            assert(check_va2pa_large(pgdir, KERNBASE + i) == i);
+f0102be1:	68 20 91 10 f0       	push   $0xf0109120
+f0102be6:	68 1f 93 10 f0       	push   $0xf010931f
+f0102beb:	68 7f 03 00 00       	push   $0x37f
+f0102bf0:	68 f9 92 10 f0       	push   $0xf01092f9
+f0102bf5:	e8 58 d4 ff ff       	call   f0100052 <_panic>
+        cprintf("large page installed!\n");
+f0102bfa:	83 ec 0c             	sub    $0xc,%esp
+f0102bfd:	68 9e 95 10 f0       	push   $0xf010959e
+f0102c02:	e8 d3 17 00 00       	call   f01043da <cprintf>
+f0102c07:	83 c4 10             	add    $0x10,%esp
+f0102c0a:	c7 45 c8 00 10 67 00 	movl   $0x671000,-0x38(%ebp)
+f0102c11:	b8 00 00 ff ef       	mov    $0xefff0000,%eax
+f0102c16:	2d 00 90 66 f0       	sub    $0xf0669000,%eax
+f0102c1b:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+        for (i = 0; i < npages * PGSIZE; i += PGSIZE)
+f0102c1e:	c7 45 cc 00 80 ff ef 	movl   $0xefff8000,-0x34(%ebp)
+f0102c25:	89 7d b8             	mov    %edi,-0x48(%ebp)
+f0102c28:	8b 7d d0             	mov    -0x30(%ebp),%edi
+f0102c2b:	e9 bc 00 00 00       	jmp    f0102cec <mem_init+0x17e3>
+f0102c30:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f0102c36:	39 f3                	cmp    %esi,%ebx
+f0102c38:	73 2a                	jae    f0102c64 <mem_init+0x175b>
+            assert(check_va2pa(pgdir, KERNBASE + i) == i);
+f0102c3a:	8d 93 00 00 00 f0    	lea    -0x10000000(%ebx),%edx
+f0102c40:	89 f8                	mov    %edi,%eax
+f0102c42:	e8 43 e0 ff ff       	call   f0100c8a <check_va2pa>
+f0102c47:	39 c3                	cmp    %eax,%ebx
+f0102c49:	74 e5                	je     f0102c30 <mem_init+0x1727>
+f0102c4b:	68 4c 91 10 f0       	push   $0xf010914c
+f0102c50:	68 1f 93 10 f0       	push   $0xf010931f
+f0102c55:	68 84 03 00 00       	push   $0x384
+f0102c5a:	68 f9 92 10 f0       	push   $0xf01092f9
+f0102c5f:	e8 ee d3 ff ff       	call   f0100052 <_panic>
+f0102c64:	8b 7d cc             	mov    -0x34(%ebp),%edi
+f0102c67:	eb a1                	jmp    f0102c0a <mem_init+0x1701>
+f0102c69:	ff 75 d4             	push   -0x2c(%ebp)
+f0102c6c:	68 88 82 10 f0       	push   $0xf0108288
+f0102c71:	68 8d 03 00 00       	push   $0x38d
+f0102c76:	68 f9 92 10 f0       	push   $0xf01092f9
+f0102c7b:	e8 d2 d3 ff ff       	call   f0100052 <_panic>
+            assert(check_va2pa(pgdir, base + KSTKGAP + i)
+f0102c80:	68 74 91 10 f0       	push   $0xf0109174
+f0102c85:	68 1f 93 10 f0       	push   $0xf010931f
+f0102c8a:	68 8c 03 00 00       	push   $0x38c
+f0102c8f:	68 f9 92 10 f0       	push   $0xf01092f9
+f0102c94:	e8 b9 d3 ff ff       	call   f0100052 <_panic>
+f0102c99:	8b 75 c0             	mov    -0x40(%ebp),%esi
+f0102c9c:	8b 5d cc             	mov    -0x34(%ebp),%ebx
+        for (i = 0; i < KSTKGAP; i += PGSIZE)
+f0102c9f:	39 f3                	cmp    %esi,%ebx
+f0102ca1:	74 2d                	je     f0102cd0 <mem_init+0x17c7>
+            assert(check_va2pa(pgdir, base + i) == ~0);
+f0102ca3:	89 f2                	mov    %esi,%edx
+f0102ca5:	89 f8                	mov    %edi,%eax
+f0102ca7:	e8 de df ff ff       	call   f0100c8a <check_va2pa>
+f0102cac:	81 c6 00 10 00 00    	add    $0x1000,%esi
+f0102cb2:	83 f8 ff             	cmp    $0xffffffff,%eax
+f0102cb5:	74 e8                	je     f0102c9f <mem_init+0x1796>
+f0102cb7:	68 bc 91 10 f0       	push   $0xf01091bc
+f0102cbc:	68 1f 93 10 f0       	push   $0xf010931f
+f0102cc1:	68 8f 03 00 00       	push   $0x38f
+f0102cc6:	68 f9 92 10 f0       	push   $0xf01092f9
+f0102ccb:	e8 82 d3 ff ff       	call   f0100052 <_panic>
+    for (n = 0; n < NCPU; n++) {
+f0102cd0:	81 6d cc 00 00 01 00 	subl   $0x10000,-0x34(%ebp)
+f0102cd7:	81 45 d4 00 80 00 00 	addl   $0x8000,-0x2c(%ebp)
+f0102cde:	81 45 c8 00 80 00 00 	addl   $0x8000,-0x38(%ebp)
+f0102ce5:	81 6d c4 00 80 01 00 	subl   $0x18000,-0x3c(%ebp)
+f0102cec:	8b 4d bc             	mov    -0x44(%ebp),%ecx
+f0102cef:	39 4d d4             	cmp    %ecx,-0x2c(%ebp)
+f0102cf2:	74 55                	je     f0102d49 <mem_init+0x1840>
+        uint32_t base = KSTACKTOP - (KSTKSIZE + KSTKGAP) * (n + 1);
+f0102cf4:	8b 45 cc             	mov    -0x34(%ebp),%eax
+f0102cf7:	8d b0 00 80 ff ff    	lea    -0x8000(%eax),%esi
+	return (physaddr_t)kva - KERNBASE;
+f0102cfd:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0102d00:	8d 98 00 00 00 10    	lea    0x10000000(%eax),%ebx
+            assert(check_va2pa(pgdir, base + KSTKGAP + i)
+f0102d06:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+f0102d09:	2d 00 80 ff 0f       	sub    $0xfff8000,%eax
+f0102d0e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f0102d11:	89 75 c0             	mov    %esi,-0x40(%ebp)
+f0102d14:	8b 75 c8             	mov    -0x38(%ebp),%esi
+        for (i = 0; i < KSTKSIZE; i += PGSIZE)
+f0102d17:	39 f3                	cmp    %esi,%ebx
+f0102d19:	0f 84 7a ff ff ff    	je     f0102c99 <mem_init+0x1790>
+            assert(check_va2pa(pgdir, base + KSTKGAP + i)
+f0102d1f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0102d22:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+f0102d25:	89 f8                	mov    %edi,%eax
+f0102d27:	e8 5e df ff ff       	call   f0100c8a <check_va2pa>
+	if ((uint32_t)kva < KERNBASE)
+f0102d2c:	81 7d d4 ff ff ff ef 	cmpl   $0xefffffff,-0x2c(%ebp)
+f0102d33:	0f 86 30 ff ff ff    	jbe    f0102c69 <mem_init+0x1760>
+f0102d39:	39 d8                	cmp    %ebx,%eax
+f0102d3b:	0f 85 3f ff ff ff    	jne    f0102c80 <mem_init+0x1777>
+        for (i = 0; i < KSTKSIZE; i += PGSIZE)
+f0102d41:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f0102d47:	eb ce                	jmp    f0102d17 <mem_init+0x180e>
+f0102d49:	89 fa                	mov    %edi,%edx
+f0102d4b:	8b 7d b8             	mov    -0x48(%ebp),%edi
+f0102d4e:	eb 35                	jmp    f0102d85 <mem_init+0x187c>
+                assert(pgdir[i] & PTE_P);
+f0102d50:	f6 04 ba 01          	testb  $0x1,(%edx,%edi,4)
+f0102d54:	75 24                	jne    f0102d7a <mem_init+0x1871>
+f0102d56:	68 b5 95 10 f0       	push   $0xf01095b5
+f0102d5b:	68 1f 93 10 f0       	push   $0xf010931f
+f0102d60:	68 9a 03 00 00       	push   $0x39a
+f0102d65:	68 f9 92 10 f0       	push   $0xf01092f9
+f0102d6a:	e8 e3 d2 ff ff       	call   f0100052 <_panic>
+                    assert(pgdir[i] & PTE_P);
+f0102d6f:	8b 04 ba             	mov    (%edx,%edi,4),%eax
+f0102d72:	a8 01                	test   $0x1,%al
+f0102d74:	74 41                	je     f0102db7 <mem_init+0x18ae>
+                    assert(pgdir[i] & PTE_W);
+f0102d76:	a8 02                	test   $0x2,%al
+f0102d78:	74 56                	je     f0102dd0 <mem_init+0x18c7>
+    for (i = 0; i < NPDENTRIES; i++) {
+f0102d7a:	83 c7 01             	add    $0x1,%edi
+f0102d7d:	81 ff 00 04 00 00    	cmp    $0x400,%edi
+f0102d83:	74 64                	je     f0102de9 <mem_init+0x18e0>
+        switch (i) {
+f0102d85:	8d 87 45 fc ff ff    	lea    -0x3bb(%edi),%eax
+f0102d8b:	83 f8 04             	cmp    $0x4,%eax
+f0102d8e:	76 c0                	jbe    f0102d50 <mem_init+0x1847>
+                if (i >= PDX(KERNBASE)) {
+f0102d90:	81 ff bf 03 00 00    	cmp    $0x3bf,%edi
+f0102d96:	77 d7                	ja     f0102d6f <mem_init+0x1866>
+                    assert(pgdir[i] == 0);
+f0102d98:	83 3c ba 00          	cmpl   $0x0,(%edx,%edi,4)
+f0102d9c:	74 dc                	je     f0102d7a <mem_init+0x1871>
+f0102d9e:	68 d7 95 10 f0       	push   $0xf01095d7
+f0102da3:	68 1f 93 10 f0       	push   $0xf010931f
+f0102da8:	68 a1 03 00 00       	push   $0x3a1
+f0102dad:	68 f9 92 10 f0       	push   $0xf01092f9
+f0102db2:	e8 9b d2 ff ff       	call   f0100052 <_panic>
+                    assert(pgdir[i] & PTE_P);
+f0102db7:	68 b5 95 10 f0       	push   $0xf01095b5
+f0102dbc:	68 1f 93 10 f0       	push   $0xf010931f
+f0102dc1:	68 9e 03 00 00       	push   $0x39e
+f0102dc6:	68 f9 92 10 f0       	push   $0xf01092f9
+f0102dcb:	e8 82 d2 ff ff       	call   f0100052 <_panic>
+                    assert(pgdir[i] & PTE_W);
+f0102dd0:	68 c6 95 10 f0       	push   $0xf01095c6
+f0102dd5:	68 1f 93 10 f0       	push   $0xf010931f
+f0102dda:	68 9f 03 00 00       	push   $0x39f
+f0102ddf:	68 f9 92 10 f0       	push   $0xf01092f9
+f0102de4:	e8 69 d2 ff ff       	call   f0100052 <_panic>
+    cprintf("check_kern_pgdir() succeeded!\n");
+f0102de9:	83 ec 0c             	sub    $0xc,%esp
+f0102dec:	68 e0 91 10 f0       	push   $0xf01091e0
+f0102df1:	e8 e4 15 00 00       	call   f01043da <cprintf>
+    lcr3(PADDR(kern_pgdir));
+f0102df6:	a1 cc 76 66 f0       	mov    0xf06676cc,%eax
+f0102dfb:	83 c4 10             	add    $0x10,%esp
+f0102dfe:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0102e03:	0f 86 2a 02 00 00    	jbe    f0103033 <mem_init+0x1b2a>
+	return (physaddr_t)kva - KERNBASE;
+f0102e09:	05 00 00 00 10       	add    $0x10000000,%eax
+	asm volatile("movl %0,%%cr3" : : "r" (val));
+f0102e0e:	0f 22 d8             	mov    %eax,%cr3
+    check_page_free_list(0);
+f0102e11:	b8 00 00 00 00       	mov    $0x0,%eax
+f0102e16:	e8 d2 de ff ff       	call   f0100ced <check_page_free_list>
+	asm volatile("movl %%cr0,%0" : "=r" (val));
+f0102e1b:	0f 20 c0             	mov    %cr0,%eax
+    cr0 &= ~(CR0_TS | CR0_EM);
+f0102e1e:	83 e0 f3             	and    $0xfffffff3,%eax
+f0102e21:	0d 23 00 05 80       	or     $0x80050023,%eax
+	asm volatile("movl %0,%%cr0" : : "r" (val));
+f0102e26:	0f 22 c0             	mov    %eax,%cr0
+    uintptr_t va;
+    int i;
+
+    // check that we can read and write installed pages
+    pp1 = pp2 = 0;
+    assert((pp0 = page_alloc(0)));
+f0102e29:	83 ec 0c             	sub    $0xc,%esp
+f0102e2c:	6a 00                	push   $0x0
+f0102e2e:	e8 31 e3 ff ff       	call   f0101164 <page_alloc>
+f0102e33:	89 c3                	mov    %eax,%ebx
+f0102e35:	83 c4 10             	add    $0x10,%esp
+f0102e38:	85 c0                	test   %eax,%eax
+f0102e3a:	0f 84 08 02 00 00    	je     f0103048 <mem_init+0x1b3f>
+    assert((pp1 = page_alloc(0)));
+f0102e40:	83 ec 0c             	sub    $0xc,%esp
+f0102e43:	6a 00                	push   $0x0
+f0102e45:	e8 1a e3 ff ff       	call   f0101164 <page_alloc>
+f0102e4a:	89 c7                	mov    %eax,%edi
+f0102e4c:	83 c4 10             	add    $0x10,%esp
+f0102e4f:	85 c0                	test   %eax,%eax
+f0102e51:	0f 84 0a 02 00 00    	je     f0103061 <mem_init+0x1b58>
+    assert((pp2 = page_alloc(0)));
+f0102e57:	83 ec 0c             	sub    $0xc,%esp
+f0102e5a:	6a 00                	push   $0x0
+f0102e5c:	e8 03 e3 ff ff       	call   f0101164 <page_alloc>
+f0102e61:	89 c6                	mov    %eax,%esi
+f0102e63:	83 c4 10             	add    $0x10,%esp
+f0102e66:	85 c0                	test   %eax,%eax
+f0102e68:	0f 84 0c 02 00 00    	je     f010307a <mem_init+0x1b71>
+    page_free(pp0);
+f0102e6e:	83 ec 0c             	sub    $0xc,%esp
+f0102e71:	53                   	push   %ebx
+f0102e72:	e8 97 e3 ff ff       	call   f010120e <page_free>
+	return (pp - pages) << PGSHIFT;
+f0102e77:	89 f8                	mov    %edi,%eax
+f0102e79:	2b 05 d0 76 66 f0    	sub    0xf06676d0,%eax
+f0102e7f:	c1 f8 03             	sar    $0x3,%eax
+f0102e82:	89 c2                	mov    %eax,%edx
+f0102e84:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f0102e87:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0102e8c:	83 c4 10             	add    $0x10,%esp
+f0102e8f:	3b 05 c8 76 66 f0    	cmp    0xf06676c8,%eax
+f0102e95:	0f 83 f8 01 00 00    	jae    f0103093 <mem_init+0x1b8a>
+    memset(page2kva(pp1), 1, PGSIZE);
+f0102e9b:	83 ec 04             	sub    $0x4,%esp
+f0102e9e:	68 00 10 00 00       	push   $0x1000
+f0102ea3:	6a 01                	push   $0x1
+	return (void *)(pa + KERNBASE);
+f0102ea5:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f0102eab:	52                   	push   %edx
+f0102eac:	e8 4a 3a 00 00       	call   f01068fb <memset>
+	return (pp - pages) << PGSHIFT;
+f0102eb1:	89 f0                	mov    %esi,%eax
+f0102eb3:	2b 05 d0 76 66 f0    	sub    0xf06676d0,%eax
+f0102eb9:	c1 f8 03             	sar    $0x3,%eax
+f0102ebc:	89 c2                	mov    %eax,%edx
+f0102ebe:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f0102ec1:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0102ec6:	83 c4 10             	add    $0x10,%esp
+f0102ec9:	3b 05 c8 76 66 f0    	cmp    0xf06676c8,%eax
+f0102ecf:	0f 83 d0 01 00 00    	jae    f01030a5 <mem_init+0x1b9c>
+    memset(page2kva(pp2), 2, PGSIZE);
+f0102ed5:	83 ec 04             	sub    $0x4,%esp
+f0102ed8:	68 00 10 00 00       	push   $0x1000
+f0102edd:	6a 02                	push   $0x2
+	return (void *)(pa + KERNBASE);
+f0102edf:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f0102ee5:	52                   	push   %edx
+f0102ee6:	e8 10 3a 00 00       	call   f01068fb <memset>
+    page_insert(kern_pgdir, pp1, (void *) PGSIZE, PTE_W);
+f0102eeb:	6a 02                	push   $0x2
+f0102eed:	68 00 10 00 00       	push   $0x1000
+f0102ef2:	57                   	push   %edi
+f0102ef3:	ff 35 cc 76 66 f0    	push   0xf06676cc
+f0102ef9:	e8 3f e5 ff ff       	call   f010143d <page_insert>
+    assert(pp1->pp_ref == 1);
+f0102efe:	83 c4 20             	add    $0x20,%esp
+f0102f01:	66 83 7f 04 01       	cmpw   $0x1,0x4(%edi)
+f0102f06:	0f 85 ab 01 00 00    	jne    f01030b7 <mem_init+0x1bae>
+    assert(*(uint32_t *) PGSIZE == 0x01010101U);
+f0102f0c:	81 3d 00 10 00 00 01 	cmpl   $0x1010101,0x1000
+f0102f13:	01 01 01 
+f0102f16:	0f 85 b4 01 00 00    	jne    f01030d0 <mem_init+0x1bc7>
+    page_insert(kern_pgdir, pp2, (void *) PGSIZE, PTE_W);
+f0102f1c:	6a 02                	push   $0x2
+f0102f1e:	68 00 10 00 00       	push   $0x1000
+f0102f23:	56                   	push   %esi
+f0102f24:	ff 35 cc 76 66 f0    	push   0xf06676cc
+f0102f2a:	e8 0e e5 ff ff       	call   f010143d <page_insert>
+    assert(*(uint32_t *) PGSIZE == 0x02020202U);
+f0102f2f:	83 c4 10             	add    $0x10,%esp
+f0102f32:	81 3d 00 10 00 00 02 	cmpl   $0x2020202,0x1000
+f0102f39:	02 02 02 
+f0102f3c:	0f 85 a7 01 00 00    	jne    f01030e9 <mem_init+0x1be0>
+    assert(pp2->pp_ref == 1);
+f0102f42:	66 83 7e 04 01       	cmpw   $0x1,0x4(%esi)
+f0102f47:	0f 85 b5 01 00 00    	jne    f0103102 <mem_init+0x1bf9>
+    assert(pp1->pp_ref == 0);
+f0102f4d:	66 83 7f 04 00       	cmpw   $0x0,0x4(%edi)
+f0102f52:	0f 85 c3 01 00 00    	jne    f010311b <mem_init+0x1c12>
+    *(uint32_t *) PGSIZE = 0x03030303U;
+f0102f58:	c7 05 00 10 00 00 03 	movl   $0x3030303,0x1000
+f0102f5f:	03 03 03 
+	return (pp - pages) << PGSHIFT;
+f0102f62:	89 f0                	mov    %esi,%eax
+f0102f64:	2b 05 d0 76 66 f0    	sub    0xf06676d0,%eax
+f0102f6a:	c1 f8 03             	sar    $0x3,%eax
+f0102f6d:	89 c2                	mov    %eax,%edx
+f0102f6f:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f0102f72:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0102f77:	3b 05 c8 76 66 f0    	cmp    0xf06676c8,%eax
+f0102f7d:	0f 83 b1 01 00 00    	jae    f0103134 <mem_init+0x1c2b>
+    assert(*(uint32_t *) page2kva(pp2) == 0x03030303U);
+f0102f83:	81 ba 00 00 00 f0 03 	cmpl   $0x3030303,-0x10000000(%edx)
+f0102f8a:	03 03 03 
+f0102f8d:	0f 85 b3 01 00 00    	jne    f0103146 <mem_init+0x1c3d>
+    page_remove(kern_pgdir, (void *) PGSIZE);
+f0102f93:	83 ec 08             	sub    $0x8,%esp
+f0102f96:	68 00 10 00 00       	push   $0x1000
+f0102f9b:	ff 35 cc 76 66 f0    	push   0xf06676cc
+f0102fa1:	e8 4a e4 ff ff       	call   f01013f0 <page_remove>
+    assert(pp2->pp_ref == 0);
+f0102fa6:	83 c4 10             	add    $0x10,%esp
+f0102fa9:	66 83 7e 04 00       	cmpw   $0x0,0x4(%esi)
+f0102fae:	0f 85 ab 01 00 00    	jne    f010315f <mem_init+0x1c56>
+
+    // forcibly take pp0 back
+    assert(PTE_ADDR(kern_pgdir[0]) == page2pa(pp0));
+f0102fb4:	8b 0d cc 76 66 f0    	mov    0xf06676cc,%ecx
+f0102fba:	8b 11                	mov    (%ecx),%edx
+f0102fbc:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+	return (pp - pages) << PGSHIFT;
+f0102fc2:	89 d8                	mov    %ebx,%eax
+f0102fc4:	2b 05 d0 76 66 f0    	sub    0xf06676d0,%eax
+f0102fca:	c1 f8 03             	sar    $0x3,%eax
+f0102fcd:	c1 e0 0c             	shl    $0xc,%eax
+f0102fd0:	39 c2                	cmp    %eax,%edx
+f0102fd2:	0f 85 a0 01 00 00    	jne    f0103178 <mem_init+0x1c6f>
+    kern_pgdir[0] = 0;
+f0102fd8:	c7 01 00 00 00 00    	movl   $0x0,(%ecx)
+    assert(pp0->pp_ref == 1);
+f0102fde:	66 83 7b 04 01       	cmpw   $0x1,0x4(%ebx)
+f0102fe3:	0f 85 a8 01 00 00    	jne    f0103191 <mem_init+0x1c88>
+    pp0->pp_ref = 0;
+f0102fe9:	66 c7 43 04 00 00    	movw   $0x0,0x4(%ebx)
+
+    // free the pages we took
+    page_free(pp0);
+f0102fef:	83 ec 0c             	sub    $0xc,%esp
+f0102ff2:	53                   	push   %ebx
+f0102ff3:	e8 16 e2 ff ff       	call   f010120e <page_free>
+
+    cprintf("check_page_installed_pgdir() succeeded! ");
+f0102ff8:	c7 04 24 74 92 10 f0 	movl   $0xf0109274,(%esp)
+f0102fff:	e8 d6 13 00 00       	call   f01043da <cprintf>
+    cprintf("__USER_MAP_BEGIN__ = %08x\n", __USER_MAP_BEGIN__);
+f0103004:	83 c4 08             	add    $0x8,%esp
+f0103007:	68 00 b0 10 f0       	push   $0xf010b000
+f010300c:	68 e5 95 10 f0       	push   $0xf01095e5
+f0103011:	e8 c4 13 00 00       	call   f01043da <cprintf>
+    cprintf("__USER_MAP_END__ = %08x\n", __USER_MAP_END__);
+f0103016:	83 c4 08             	add    $0x8,%esp
+f0103019:	68 00 50 11 f0       	push   $0xf0115000
+f010301e:	68 00 96 10 f0       	push   $0xf0109600
+f0103023:	e8 b2 13 00 00       	call   f01043da <cprintf>
+}
+f0103028:	83 c4 10             	add    $0x10,%esp
+f010302b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010302e:	5b                   	pop    %ebx
+f010302f:	5e                   	pop    %esi
+f0103030:	5f                   	pop    %edi
+f0103031:	5d                   	pop    %ebp
+f0103032:	c3                   	ret
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0103033:	50                   	push   %eax
+f0103034:	68 88 82 10 f0       	push   $0xf0108288
+f0103039:	68 00 01 00 00       	push   $0x100
+f010303e:	68 f9 92 10 f0       	push   $0xf01092f9
+f0103043:	e8 0a d0 ff ff       	call   f0100052 <_panic>
+    assert((pp0 = page_alloc(0)));
+f0103048:	68 01 94 10 f0       	push   $0xf0109401
+f010304d:	68 1f 93 10 f0       	push   $0xf010931f
+f0103052:	68 7d 04 00 00       	push   $0x47d
+f0103057:	68 f9 92 10 f0       	push   $0xf01092f9
+f010305c:	e8 f1 cf ff ff       	call   f0100052 <_panic>
+    assert((pp1 = page_alloc(0)));
+f0103061:	68 17 94 10 f0       	push   $0xf0109417
+f0103066:	68 1f 93 10 f0       	push   $0xf010931f
+f010306b:	68 7e 04 00 00       	push   $0x47e
+f0103070:	68 f9 92 10 f0       	push   $0xf01092f9
+f0103075:	e8 d8 cf ff ff       	call   f0100052 <_panic>
+    assert((pp2 = page_alloc(0)));
+f010307a:	68 2d 94 10 f0       	push   $0xf010942d
+f010307f:	68 1f 93 10 f0       	push   $0xf010931f
+f0103084:	68 7f 04 00 00       	push   $0x47f
+f0103089:	68 f9 92 10 f0       	push   $0xf01092f9
+f010308e:	e8 bf cf ff ff       	call   f0100052 <_panic>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0103093:	52                   	push   %edx
+f0103094:	68 64 82 10 f0       	push   $0xf0108264
+f0103099:	6a 5a                	push   $0x5a
+f010309b:	68 05 93 10 f0       	push   $0xf0109305
+f01030a0:	e8 ad cf ff ff       	call   f0100052 <_panic>
+f01030a5:	52                   	push   %edx
+f01030a6:	68 64 82 10 f0       	push   $0xf0108264
+f01030ab:	6a 5a                	push   $0x5a
+f01030ad:	68 05 93 10 f0       	push   $0xf0109305
+f01030b2:	e8 9b cf ff ff       	call   f0100052 <_panic>
+    assert(pp1->pp_ref == 1);
+f01030b7:	68 a7 94 10 f0       	push   $0xf01094a7
+f01030bc:	68 1f 93 10 f0       	push   $0xf010931f
+f01030c1:	68 84 04 00 00       	push   $0x484
+f01030c6:	68 f9 92 10 f0       	push   $0xf01092f9
+f01030cb:	e8 82 cf ff ff       	call   f0100052 <_panic>
+    assert(*(uint32_t *) PGSIZE == 0x01010101U);
+f01030d0:	68 00 92 10 f0       	push   $0xf0109200
+f01030d5:	68 1f 93 10 f0       	push   $0xf010931f
+f01030da:	68 85 04 00 00       	push   $0x485
+f01030df:	68 f9 92 10 f0       	push   $0xf01092f9
+f01030e4:	e8 69 cf ff ff       	call   f0100052 <_panic>
+    assert(*(uint32_t *) PGSIZE == 0x02020202U);
+f01030e9:	68 24 92 10 f0       	push   $0xf0109224
+f01030ee:	68 1f 93 10 f0       	push   $0xf010931f
+f01030f3:	68 87 04 00 00       	push   $0x487
+f01030f8:	68 f9 92 10 f0       	push   $0xf01092f9
+f01030fd:	e8 50 cf ff ff       	call   f0100052 <_panic>
+    assert(pp2->pp_ref == 1);
+f0103102:	68 c9 94 10 f0       	push   $0xf01094c9
+f0103107:	68 1f 93 10 f0       	push   $0xf010931f
+f010310c:	68 88 04 00 00       	push   $0x488
+f0103111:	68 f9 92 10 f0       	push   $0xf01092f9
+f0103116:	e8 37 cf ff ff       	call   f0100052 <_panic>
+    assert(pp1->pp_ref == 0);
+f010311b:	68 33 95 10 f0       	push   $0xf0109533
+f0103120:	68 1f 93 10 f0       	push   $0xf010931f
+f0103125:	68 89 04 00 00       	push   $0x489
+f010312a:	68 f9 92 10 f0       	push   $0xf01092f9
+f010312f:	e8 1e cf ff ff       	call   f0100052 <_panic>
+f0103134:	52                   	push   %edx
+f0103135:	68 64 82 10 f0       	push   $0xf0108264
+f010313a:	6a 5a                	push   $0x5a
+f010313c:	68 05 93 10 f0       	push   $0xf0109305
+f0103141:	e8 0c cf ff ff       	call   f0100052 <_panic>
+    assert(*(uint32_t *) page2kva(pp2) == 0x03030303U);
+f0103146:	68 48 92 10 f0       	push   $0xf0109248
+f010314b:	68 1f 93 10 f0       	push   $0xf010931f
+f0103150:	68 8b 04 00 00       	push   $0x48b
+f0103155:	68 f9 92 10 f0       	push   $0xf01092f9
+f010315a:	e8 f3 ce ff ff       	call   f0100052 <_panic>
+    assert(pp2->pp_ref == 0);
+f010315f:	68 01 95 10 f0       	push   $0xf0109501
+f0103164:	68 1f 93 10 f0       	push   $0xf010931f
+f0103169:	68 8d 04 00 00       	push   $0x48d
+f010316e:	68 f9 92 10 f0       	push   $0xf01092f9
+f0103173:	e8 da ce ff ff       	call   f0100052 <_panic>
+    assert(PTE_ADDR(kern_pgdir[0]) == page2pa(pp0));
+f0103178:	68 94 8b 10 f0       	push   $0xf0108b94
+f010317d:	68 1f 93 10 f0       	push   $0xf010931f
+f0103182:	68 90 04 00 00       	push   $0x490
+f0103187:	68 f9 92 10 f0       	push   $0xf01092f9
+f010318c:	e8 c1 ce ff ff       	call   f0100052 <_panic>
+    assert(pp0->pp_ref == 1);
+f0103191:	68 b8 94 10 f0       	push   $0xf01094b8
+f0103196:	68 1f 93 10 f0       	push   $0xf010931f
+f010319b:	68 92 04 00 00       	push   $0x492
+f01031a0:	68 f9 92 10 f0       	push   $0xf01092f9
+f01031a5:	e8 a8 ce ff ff       	call   f0100052 <_panic>
+
+f01031aa <user_mem_check>:
+user_mem_check(struct Env *env, const void *va, size_t len, int perm) {
+f01031aa:	55                   	push   %ebp
+f01031ab:	89 e5                	mov    %esp,%ebp
+f01031ad:	57                   	push   %edi
+f01031ae:	56                   	push   %esi
+f01031af:	53                   	push   %ebx
+f01031b0:	83 ec 0c             	sub    $0xc,%esp
+f01031b3:	8b 45 0c             	mov    0xc(%ebp),%eax
+    if (!env)
+f01031b6:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+f01031ba:	74 27                	je     f01031e3 <user_mem_check+0x39>
+    perm = PGOFF(perm);
+f01031bc:	8b 75 14             	mov    0x14(%ebp),%esi
+f01031bf:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+    uintptr_t vptr = (uintptr_t) va, vend = vptr + len - 1;
+f01031c5:	89 c3                	mov    %eax,%ebx
+f01031c7:	8b 55 10             	mov    0x10(%ebp),%edx
+f01031ca:	8d 7c 10 ff          	lea    -0x1(%eax,%edx,1),%edi
+    if (vend >= ULIM) {
+f01031ce:	81 ff ff ff 7f ef    	cmp    $0xef7fffff,%edi
+f01031d4:	76 2a                	jbe    f0103200 <user_mem_check+0x56>
+        user_mem_check_addr = vend;
+f01031d6:	89 3d 3c 42 62 f0    	mov    %edi,0xf062423c
+        return -E_FAULT;
+f01031dc:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+f01031e1:	eb 4c                	jmp    f010322f <user_mem_check+0x85>
+        panic("user_mem_check: null pointer 'env'\n");
+f01031e3:	83 ec 04             	sub    $0x4,%esp
+f01031e6:	68 a0 92 10 f0       	push   $0xf01092a0
+f01031eb:	68 ad 02 00 00       	push   $0x2ad
+f01031f0:	68 f9 92 10 f0       	push   $0xf01092f9
+f01031f5:	e8 58 ce ff ff       	call   f0100052 <_panic>
+        vptr += PGSIZE;
+f01031fa:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+    while (vptr <= vend) {
+f0103200:	39 df                	cmp    %ebx,%edi
+f0103202:	72 33                	jb     f0103237 <user_mem_check+0x8d>
+        pte_t *pte = pgdir_walk(env->env_pgdir, (const void *) vptr, 0);
+f0103204:	83 ec 04             	sub    $0x4,%esp
+f0103207:	6a 00                	push   $0x0
+f0103209:	53                   	push   %ebx
+f010320a:	8b 45 08             	mov    0x8(%ebp),%eax
+f010320d:	ff 70 70             	push   0x70(%eax)
+f0103210:	e8 7d e0 ff ff       	call   f0101292 <pgdir_walk>
+        if (!(pte && (*pte & perm) == perm)) {
+f0103215:	83 c4 10             	add    $0x10,%esp
+f0103218:	85 c0                	test   %eax,%eax
+f010321a:	74 08                	je     f0103224 <user_mem_check+0x7a>
+f010321c:	89 f1                	mov    %esi,%ecx
+f010321e:	23 08                	and    (%eax),%ecx
+f0103220:	39 ce                	cmp    %ecx,%esi
+f0103222:	74 d6                	je     f01031fa <user_mem_check+0x50>
+            user_mem_check_addr = vptr;
+f0103224:	89 1d 3c 42 62 f0    	mov    %ebx,0xf062423c
+            return -E_FAULT;
+f010322a:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+}
+f010322f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0103232:	5b                   	pop    %ebx
+f0103233:	5e                   	pop    %esi
+f0103234:	5f                   	pop    %edi
+f0103235:	5d                   	pop    %ebp
+f0103236:	c3                   	ret
+    return 0;
+f0103237:	b8 00 00 00 00       	mov    $0x0,%eax
+f010323c:	eb f1                	jmp    f010322f <user_mem_check+0x85>
+
+f010323e <user_mem_assert>:
+user_mem_assert(struct Env *env, const void *va, size_t len, int perm) {
+f010323e:	55                   	push   %ebp
+f010323f:	89 e5                	mov    %esp,%ebp
+f0103241:	53                   	push   %ebx
+f0103242:	83 ec 04             	sub    $0x4,%esp
+f0103245:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    if (user_mem_check(env, va, len, perm | PTE_U) < 0) {
+f0103248:	8b 45 14             	mov    0x14(%ebp),%eax
+f010324b:	83 c8 04             	or     $0x4,%eax
+f010324e:	50                   	push   %eax
+f010324f:	ff 75 10             	push   0x10(%ebp)
+f0103252:	ff 75 0c             	push   0xc(%ebp)
+f0103255:	53                   	push   %ebx
+f0103256:	e8 4f ff ff ff       	call   f01031aa <user_mem_check>
+f010325b:	83 c4 10             	add    $0x10,%esp
+f010325e:	85 c0                	test   %eax,%eax
+f0103260:	78 05                	js     f0103267 <user_mem_assert+0x29>
+}
+f0103262:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0103265:	c9                   	leave
+f0103266:	c3                   	ret
+        cprintf("[%08x] user_mem_check assertion failure for "
+f0103267:	83 ec 04             	sub    $0x4,%esp
+f010326a:	ff 35 3c 42 62 f0    	push   0xf062423c
+f0103270:	ff 73 48             	push   0x48(%ebx)
+f0103273:	68 c4 92 10 f0       	push   $0xf01092c4
+f0103278:	e8 5d 11 00 00       	call   f01043da <cprintf>
+        env_destroy(env);    // may not return
+f010327d:	89 1c 24             	mov    %ebx,(%esp)
+f0103280:	e8 ab 0d 00 00       	call   f0104030 <env_destroy>
+f0103285:	83 c4 10             	add    $0x10,%esp
+}
+f0103288:	eb d8                	jmp    f0103262 <user_mem_assert+0x24>
+
+f010328a <check_user_map>:
+        sched_yield();
+    }
+}
+
+static void
+check_user_map(pde_t *pgdir, void *va, uint32_t len, const char *name) {
+f010328a:	55                   	push   %ebp
+f010328b:	89 e5                	mov    %esp,%ebp
+f010328d:	57                   	push   %edi
+f010328e:	56                   	push   %esi
+f010328f:	53                   	push   %ebx
+f0103290:	83 ec 2c             	sub    $0x2c,%esp
+f0103293:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    for (uintptr_t _va = ROUNDDOWN((uintptr_t) va, PGSIZE);
+f0103296:	89 d3                	mov    %edx,%ebx
+f0103298:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+         _va < ROUNDUP((uintptr_t) va + len, PGSIZE); _va += PGSIZE) {
+f010329e:	8d b4 0a ff 0f 00 00 	lea    0xfff(%edx,%ecx,1),%esi
+f01032a5:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+        pte_t *pte;
+        if (page_lookup(pgdir, (void *) _va, &pte) == NULL) {
+f01032ab:	8d 7d e4             	lea    -0x1c(%ebp),%edi
+    for (uintptr_t _va = ROUNDDOWN((uintptr_t) va, PGSIZE);
+f01032ae:	eb 21                	jmp    f01032d1 <check_user_map+0x47>
+            cprintf("%s not mapped in env_pgdir\n", name);
+f01032b0:	83 ec 08             	sub    $0x8,%esp
+f01032b3:	ff 75 08             	push   0x8(%ebp)
+f01032b6:	68 42 96 10 f0       	push   $0xf0109642
+f01032bb:	e8 1a 11 00 00       	call   f01043da <cprintf>
+            return;
+f01032c0:	83 c4 10             	add    $0x10,%esp
+        if (*pte & PTE_U) {
+            cprintf("%s wrong permission in env_pgdir\n", name);
+            return;
+        }
+    }
+}
+f01032c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01032c6:	5b                   	pop    %ebx
+f01032c7:	5e                   	pop    %esi
+f01032c8:	5f                   	pop    %edi
+f01032c9:	5d                   	pop    %ebp
+f01032ca:	c3                   	ret
+         _va < ROUNDUP((uintptr_t) va + len, PGSIZE); _va += PGSIZE) {
+f01032cb:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f01032d1:	39 f3                	cmp    %esi,%ebx
+f01032d3:	73 ee                	jae    f01032c3 <check_user_map+0x39>
+        if (page_lookup(pgdir, (void *) _va, &pte) == NULL) {
+f01032d5:	83 ec 04             	sub    $0x4,%esp
+f01032d8:	57                   	push   %edi
+f01032d9:	53                   	push   %ebx
+f01032da:	ff 75 d4             	push   -0x2c(%ebp)
+f01032dd:	e8 88 e0 ff ff       	call   f010136a <page_lookup>
+f01032e2:	83 c4 10             	add    $0x10,%esp
+f01032e5:	85 c0                	test   %eax,%eax
+f01032e7:	74 c7                	je     f01032b0 <check_user_map+0x26>
+        if (*pte & PTE_U) {
+f01032e9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01032ec:	f6 00 04             	testb  $0x4,(%eax)
+f01032ef:	74 da                	je     f01032cb <check_user_map+0x41>
+            cprintf("%s wrong permission in env_pgdir\n", name);
+f01032f1:	83 ec 08             	sub    $0x8,%esp
+f01032f4:	ff 75 08             	push   0x8(%ebp)
+f01032f7:	68 8c 96 10 f0       	push   $0xf010968c
+f01032fc:	e8 d9 10 00 00       	call   f01043da <cprintf>
+            return;
+f0103301:	83 c4 10             	add    $0x10,%esp
+f0103304:	eb bd                	jmp    f01032c3 <check_user_map+0x39>
+
+f0103306 <check_isolate>:
+
+// Walk every page from ULIM to 4GB and panic if anything other than
+// the user-mapped kernel text/data, kernel stacks and envs is present.
+// Snapshots the kernel-half PDEs the verification holds for.
+static void
+check_isolate(struct Env *e) {
+f0103306:	55                   	push   %ebp
+f0103307:	89 e5                	mov    %esp,%ebp
+f0103309:	57                   	push   %edi
+f010330a:	56                   	push   %esi
+f010330b:	53                   	push   %ebx
+f010330c:	83 ec 2c             	sub    $0x2c,%esp
+f010330f:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    pde_t *pgdir = e->env_pgdir;
+f0103312:	8b 78 70             	mov    0x70(%eax),%edi
+    for (uintptr_t va = ULIM; va; va += PGSIZE) {
+        if ((uintptr_t) __USER_MAP_BEGIN__ <= va && va < (uintptr_t) __USER_MAP_END__)
+            continue;
+        if (KSTACKTOP - (KSTKSIZE + KSTKGAP) * NCPU <= va && va < KSTACKTOP)
+            continue;
+        if ((uintptr_t) envs <= va && va < (uintptr_t) (envs + NENV))
+f0103315:	8b 0d 60 42 62 f0    	mov    0xf0624260,%ecx
+f010331b:	8d b1 00 40 02 00    	lea    0x24000(%ecx),%esi
+	if (PGNUM(pa) >= npages)
+f0103321:	a1 c8 76 66 f0       	mov    0xf06676c8,%eax
+f0103326:	89 45 d0             	mov    %eax,-0x30(%ebp)
+    for (uintptr_t va = ULIM; va; va += PGSIZE) {
+f0103329:	b8 00 00 80 ef       	mov    $0xef800000,%eax
+f010332e:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+f0103331:	eb 40                	jmp    f0103373 <check_isolate+0x6d>
+            continue;
+        if (pgdir[PDX(va)] & PTE_P) {
+f0103333:	89 c2                	mov    %eax,%edx
+f0103335:	c1 ea 16             	shr    $0x16,%edx
+f0103338:	8b 14 97             	mov    (%edi,%edx,4),%edx
+f010333b:	f6 c2 01             	test   $0x1,%dl
+f010333e:	74 2c                	je     f010336c <check_isolate+0x66>
+            if (pgdir[PDX(va)] & PTE_PS)
+f0103340:	f6 c2 80             	test   $0x80,%dl
+f0103343:	75 57                	jne    f010339c <check_isolate+0x96>
+                panic("User page table has kernel address %08x mapped", va);
+            else {
+                pte_t *pte = KADDR(PTE_ADDR(pgdir[PDX(va)]));
+f0103345:	89 d3                	mov    %edx,%ebx
+f0103347:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+f010334d:	c1 ea 0c             	shr    $0xc,%edx
+f0103350:	8b 75 d0             	mov    -0x30(%ebp),%esi
+f0103353:	39 f2                	cmp    %esi,%edx
+f0103355:	73 5a                	jae    f01033b1 <check_isolate+0xab>
+                if (pte[PTX(va)] & PTE_P)
+f0103357:	89 c2                	mov    %eax,%edx
+f0103359:	c1 ea 0c             	shr    $0xc,%edx
+f010335c:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+f0103362:	f6 84 93 00 00 00 f0 	testb  $0x1,-0x10000000(%ebx,%edx,4)
+f0103369:	01 
+f010336a:	75 5a                	jne    f01033c6 <check_isolate+0xc0>
+    for (uintptr_t va = ULIM; va; va += PGSIZE) {
+f010336c:	05 00 10 00 00       	add    $0x1000,%eax
+f0103371:	74 68                	je     f01033db <check_isolate+0xd5>
+        if ((uintptr_t) __USER_MAP_BEGIN__ <= va && va < (uintptr_t) __USER_MAP_END__)
+f0103373:	3d 00 b0 10 f0       	cmp    $0xf010b000,%eax
+f0103378:	72 07                	jb     f0103381 <check_isolate+0x7b>
+f010337a:	3d 00 50 11 f0       	cmp    $0xf0115000,%eax
+f010337f:	72 eb                	jb     f010336c <check_isolate+0x66>
+        if (KSTACKTOP - (KSTKSIZE + KSTKGAP) * NCPU <= va && va < KSTACKTOP)
+f0103381:	8d 90 00 00 08 10    	lea    0x10080000(%eax),%edx
+f0103387:	81 fa ff ff 07 00    	cmp    $0x7ffff,%edx
+f010338d:	76 dd                	jbe    f010336c <check_isolate+0x66>
+        if ((uintptr_t) envs <= va && va < (uintptr_t) (envs + NENV))
+f010338f:	39 c8                	cmp    %ecx,%eax
+f0103391:	72 a0                	jb     f0103333 <check_isolate+0x2d>
+f0103393:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+f0103396:	39 f0                	cmp    %esi,%eax
+f0103398:	73 99                	jae    f0103333 <check_isolate+0x2d>
+f010339a:	eb d0                	jmp    f010336c <check_isolate+0x66>
+                panic("User page table has kernel address %08x mapped", va);
+f010339c:	50                   	push   %eax
+f010339d:	68 b0 96 10 f0       	push   $0xf01096b0
+f01033a2:	68 a1 02 00 00       	push   $0x2a1
+f01033a7:	68 37 96 10 f0       	push   $0xf0109637
+f01033ac:	e8 a1 cc ff ff       	call   f0100052 <_panic>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f01033b1:	53                   	push   %ebx
+f01033b2:	68 64 82 10 f0       	push   $0xf0108264
+f01033b7:	68 a3 02 00 00       	push   $0x2a3
+f01033bc:	68 37 96 10 f0       	push   $0xf0109637
+f01033c1:	e8 8c cc ff ff       	call   f0100052 <_panic>
+                    panic("User page table has kernel address %08x mapped", va);
+f01033c6:	50                   	push   %eax
+f01033c7:	68 b0 96 10 f0       	push   $0xf01096b0
+f01033cc:	68 a5 02 00 00       	push   $0x2a5
+f01033d1:	68 37 96 10 f0       	push   $0xf0109637
+f01033d6:	e8 77 cc ff ff       	call   f0100052 <_panic>
+            }
+        }
+    }
+    check_user_map(pgdir, gdt, sizeof(gdt), "GDT");
+f01033db:	83 ec 0c             	sub    $0xc,%esp
+f01033de:	68 5e 96 10 f0       	push   $0xf010965e
+f01033e3:	b9 a8 00 00 00       	mov    $0xa8,%ecx
+f01033e8:	ba 20 40 11 f0       	mov    $0xf0114020,%edx
+f01033ed:	89 f8                	mov    %edi,%eax
+f01033ef:	e8 96 fe ff ff       	call   f010328a <check_user_map>
+    check_user_map(pgdir, (void *) idt_pd.pd_base, idt_pd.pd_lim, "IDT");
+f01033f4:	0f b7 0d e0 40 11 f0 	movzwl 0xf01140e0,%ecx
+f01033fb:	c7 04 24 62 96 10 f0 	movl   $0xf0109662,(%esp)
+f0103402:	8b 15 e2 40 11 f0    	mov    0xf01140e2,%edx
+f0103408:	89 f8                	mov    %edi,%eax
+f010340a:	e8 7b fe ff ff       	call   f010328a <check_user_map>
+f010340f:	83 c4 10             	add    $0x10,%esp
+f0103412:	bb 05 00 00 00       	mov    $0x5,%ebx
+    for (int i = 0; i < NCPU; i++) {
+        char name[] = "TSS0";
+        name[3] = '0' + i;
+        check_user_map(pgdir, (void *) SEG_BASE(gdt[(GD_TSS0 >> 3) + i]), SEG_LIM(gdt[(GD_TSS0 >> 3) + i]), name);
+f0103417:	be 20 40 11 f0       	mov    $0xf0114020,%esi
+        char name[] = "TSS0";
+f010341c:	c7 45 e0 54 53 53 30 	movl   $0x30535354,-0x20(%ebp)
+f0103423:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+        name[3] = '0' + i;
+f0103427:	8d 43 2b             	lea    0x2b(%ebx),%eax
+f010342a:	88 45 e3             	mov    %al,-0x1d(%ebp)
+        check_user_map(pgdir, (void *) SEG_BASE(gdt[(GD_TSS0 >> 3) + i]), SEG_LIM(gdt[(GD_TSS0 >> 3) + i]), name);
+f010342d:	0f b6 4c de 06       	movzbl 0x6(%esi,%ebx,8),%ecx
+f0103432:	83 e1 0f             	and    $0xf,%ecx
+f0103435:	c1 e1 10             	shl    $0x10,%ecx
+f0103438:	0f b7 04 de          	movzwl (%esi,%ebx,8),%eax
+f010343c:	09 c1                	or     %eax,%ecx
+f010343e:	0f b6 54 de 04       	movzbl 0x4(%esi,%ebx,8),%edx
+f0103443:	c1 e2 10             	shl    $0x10,%edx
+f0103446:	0f b6 44 de 07       	movzbl 0x7(%esi,%ebx,8),%eax
+f010344b:	c1 e0 18             	shl    $0x18,%eax
+f010344e:	09 c2                	or     %eax,%edx
+f0103450:	0f b7 44 de 02       	movzwl 0x2(%esi,%ebx,8),%eax
+f0103455:	09 c2                	or     %eax,%edx
+f0103457:	83 ec 0c             	sub    $0xc,%esp
+f010345a:	8d 45 e0             	lea    -0x20(%ebp),%eax
+f010345d:	50                   	push   %eax
+f010345e:	89 f8                	mov    %edi,%eax
+f0103460:	e8 25 fe ff ff       	call   f010328a <check_user_map>
+    for (int i = 0; i < NCPU; i++) {
+f0103465:	83 c3 01             	add    $0x1,%ebx
+f0103468:	83 c4 10             	add    $0x10,%esp
+f010346b:	83 fb 0d             	cmp    $0xd,%ebx
+f010346e:	75 ac                	jne    f010341c <check_isolate+0x116>
+f0103470:	be 00 80 ff ef       	mov    $0xefff8000,%esi
+f0103475:	bb 30 00 00 00       	mov    $0x30,%ebx
+    }
+    for (int i = 0; i < NCPU; i++) {
+        char name[] = "kstack0";
+f010347a:	c7 45 e0 6b 73 74 61 	movl   $0x6174736b,-0x20(%ebp)
+f0103481:	c7 45 e4 63 6b 30 00 	movl   $0x306b63,-0x1c(%ebp)
+        name[6] = '0' + i;
+f0103488:	88 5d e6             	mov    %bl,-0x1a(%ebp)
+        check_user_map(pgdir, (void *) KSTACKTOP - (KSTKSIZE + KSTKGAP) * i - KSTKSIZE, KSTKSIZE, name);
+f010348b:	83 ec 0c             	sub    $0xc,%esp
+f010348e:	8d 45 e0             	lea    -0x20(%ebp),%eax
+f0103491:	50                   	push   %eax
+f0103492:	b9 00 80 00 00       	mov    $0x8000,%ecx
+f0103497:	89 f2                	mov    %esi,%edx
+f0103499:	89 f8                	mov    %edi,%eax
+f010349b:	e8 ea fd ff ff       	call   f010328a <check_user_map>
+    for (int i = 0; i < NCPU; i++) {
+f01034a0:	83 c3 01             	add    $0x1,%ebx
+f01034a3:	81 ee 00 00 01 00    	sub    $0x10000,%esi
+f01034a9:	83 c4 10             	add    $0x10,%esp
+f01034ac:	80 fb 38             	cmp    $0x38,%bl
+f01034af:	75 c9                	jne    f010347a <check_isolate+0x174>
+    }
+    check_user_map(pgdir, env_pop_tf, sizeof(env_pop_tf), "env_pop_tf");
+f01034b1:	83 ec 0c             	sub    $0xc,%esp
+f01034b4:	68 66 96 10 f0       	push   $0xf0109666
+f01034b9:	b9 01 00 00 00       	mov    $0x1,%ecx
+f01034be:	ba 00 b0 10 f0       	mov    $0xf010b000,%edx
+f01034c3:	89 f8                	mov    %edi,%eax
+f01034c5:	e8 c0 fd ff ff       	call   f010328a <check_user_map>
+
+    memcpy(kpti_pdes[e - envs], &pgdir[PDX(ULIM)], sizeof(kpti_pdes[0]));
+f01034ca:	83 c4 0c             	add    $0xc,%esp
+f01034cd:	68 08 01 00 00       	push   $0x108
+f01034d2:	8d 87 f8 0e 00 00    	lea    0xef8(%edi),%eax
+f01034d8:	50                   	push   %eax
+f01034d9:	8b 45 cc             	mov    -0x34(%ebp),%eax
+f01034dc:	2b 05 60 42 62 f0    	sub    0xf0624260,%eax
+f01034e2:	c1 f8 04             	sar    $0x4,%eax
+f01034e5:	69 c0 c8 aa aa aa    	imul   $0xaaaaaac8,%eax,%eax
+f01034eb:	05 80 42 62 f0       	add    $0xf0624280,%eax
+f01034f0:	50                   	push   %eax
+f01034f1:	e8 9c 34 00 00       	call   f0106992 <memcpy>
+    kpti_stats.full_checks++;
+f01034f6:	83 05 d4 76 66 f0 01 	addl   $0x1,0xf06676d4
+}
+f01034fd:	83 c4 10             	add    $0x10,%esp
+f0103500:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0103503:	5b                   	pop    %ebx
+f0103504:	5e                   	pop    %esi
+f0103505:	5f                   	pop    %edi
+f0103506:	5d                   	pop    %ebp
+f0103507:	c3                   	ret
+
+f0103508 <envid2env>:
+envid2env(envid_t envid, struct Env **env_store, bool checkperm) {
+f0103508:	55                   	push   %ebp
+f0103509:	89 e5                	mov    %esp,%ebp
+f010350b:	53                   	push   %ebx
+f010350c:	8b 55 08             	mov    0x8(%ebp),%edx
+f010350f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    if (envid == 0) {
+f0103512:	85 d2                	test   %edx,%edx
+f0103514:	74 57                	je     f010356d <envid2env+0x65>
+    e = &envs[ENVX(envid)];
+f0103516:	89 d0                	mov    %edx,%eax
+f0103518:	25 ff 03 00 00       	and    $0x3ff,%eax
+f010351d:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+f0103520:	c1 e0 04             	shl    $0x4,%eax
+f0103523:	03 05 60 42 62 f0    	add    0xf0624260,%eax
+    if (e->env_status == ENV_FREE || e->env_id != envid) {
+f0103529:	83 78 54 00          	cmpl   $0x0,0x54(%eax)
+f010352d:	74 53                	je     f0103582 <envid2env+0x7a>
+f010352f:	39 50 48             	cmp    %edx,0x48(%eax)
+f0103532:	75 5a                	jne    f010358e <envid2env+0x86>
+    return 0;
+f0103534:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (checkperm && e != curenv && e->env_parent_id != curenv->env_id) {
+f0103539:	84 c9                	test   %cl,%cl
+f010353b:	74 39                	je     f0103576 <envid2env+0x6e>
+f010353d:	65 8b 0d 00 00 00 00 	mov    %gs:0x0,%ecx
+f0103544:	39 41 0c             	cmp    %eax,0xc(%ecx)
+f0103547:	74 2d                	je     f0103576 <envid2env+0x6e>
+f0103549:	65 8b 15 00 00 00 00 	mov    %gs:0x0,%edx
+f0103550:	8b 4a 0c             	mov    0xc(%edx),%ecx
+f0103553:	8b 58 4c             	mov    0x4c(%eax),%ebx
+    return 0;
+f0103556:	3b 59 48             	cmp    0x48(%ecx),%ebx
+f0103559:	0f 94 c2             	sete   %dl
+f010355c:	0f b6 d2             	movzbl %dl,%edx
+f010355f:	8d 54 12 fe          	lea    -0x2(%edx,%edx,1),%edx
+f0103563:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0103568:	0f 45 c1             	cmovne %ecx,%eax
+f010356b:	eb 09                	jmp    f0103576 <envid2env+0x6e>
+f010356d:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+        *env_store = curenv;
+f0103573:	8b 40 0c             	mov    0xc(%eax),%eax
+f0103576:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f0103579:	89 01                	mov    %eax,(%ecx)
+}
+f010357b:	89 d0                	mov    %edx,%eax
+f010357d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0103580:	c9                   	leave
+f0103581:	c3                   	ret
+f0103582:	b8 00 00 00 00       	mov    $0x0,%eax
+        return -E_BAD_ENV;
+f0103587:	ba fe ff ff ff       	mov    $0xfffffffe,%edx
+f010358c:	eb e8                	jmp    f0103576 <envid2env+0x6e>
+f010358e:	b8 00 00 00 00       	mov    $0x0,%eax
+f0103593:	ba fe ff ff ff       	mov    $0xfffffffe,%edx
+f0103598:	eb dc                	jmp    f0103576 <envid2env+0x6e>
+
+f010359a <env_init_percpu>:
+env_init_percpu(void) {
+f010359a:	55                   	push   %ebp
+f010359b:	89 e5                	mov    %esp,%ebp
+f010359d:	53                   	push   %ebx
+f010359e:	83 ec 04             	sub    $0x4,%esp
+    int i = cpunum();
+f01035a1:	e8 72 3a 00 00       	call   f0107018 <cpunum>
+f01035a6:	89 c1                	mov    %eax,%ecx
+	asm volatile("lgdt (%0)" : : "r" (p));
+f01035a8:	b8 00 40 11 f0       	mov    $0xf0114000,%eax
+f01035ad:	0f 01 10             	lgdtl  (%eax)
+    cpus[i].cpu_self = &cpus[i];
+f01035b0:	69 c1 84 00 00 00    	imul   $0x84,%ecx,%eax
+f01035b6:	05 00 49 11 f0       	add    $0xf0114900,%eax
+f01035bb:	89 00                	mov    %eax,(%eax)
+    gdt[(GD_CPU0 >> 3) + i] = SEG16(STA_W, (uint32_t) &cpus[i],
+f01035bd:	8d 51 0d             	lea    0xd(%ecx),%edx
+f01035c0:	66 c7 04 d5 20 40 11 	movw   $0x83,-0xfeebfe0(,%edx,8)
+f01035c7:	f0 83 00 
+f01035ca:	66 89 04 d5 22 40 11 	mov    %ax,-0xfeebfde(,%edx,8)
+f01035d1:	f0 
+f01035d2:	89 c3                	mov    %eax,%ebx
+f01035d4:	c1 eb 10             	shr    $0x10,%ebx
+f01035d7:	88 1c d5 24 40 11 f0 	mov    %bl,-0xfeebfdc(,%edx,8)
+f01035de:	c6 04 d5 25 40 11 f0 	movb   $0x92,-0xfeebfdb(,%edx,8)
+f01035e5:	92 
+f01035e6:	c6 04 d5 26 40 11 f0 	movb   $0x40,-0xfeebfda(,%edx,8)
+f01035ed:	40 
+f01035ee:	c1 e8 18             	shr    $0x18,%eax
+f01035f1:	88 04 d5 27 40 11 f0 	mov    %al,-0xfeebfd9(,%edx,8)
+    asm volatile("movw %%ax,%%gs" : : "a" (GD_CPU0 + (i << 3)));
+f01035f8:	8d 04 cd 68 00 00 00 	lea    0x68(,%ecx,8),%eax
+f01035ff:	8e e8                	mov    %eax,%gs
+    asm volatile("movw %%ax,%%fs" : : "a" (GD_UD | 3));
+f0103601:	b8 23 00 00 00       	mov    $0x23,%eax
+f0103606:	8e e0                	mov    %eax,%fs
+    asm volatile("movw %%ax,%%es" : : "a" (GD_KD));
+f0103608:	b8 10 00 00 00       	mov    $0x10,%eax
+f010360d:	8e c0                	mov    %eax,%es
+    asm volatile("movw %%ax,%%ds" : : "a" (GD_KD));
+f010360f:	8e d8                	mov    %eax,%ds
+    asm volatile("movw %%ax,%%ss" : : "a" (GD_KD));
+f0103611:	8e d0                	mov    %eax,%ss
+    asm volatile("ljmp %0,$1f\n 1:\n" : : "i" (GD_KT));
+f0103613:	ea 1a 36 10 f0 08 00 	ljmp   $0x8,$0xf010361a
+	asm volatile("lldt %0" : : "r" (sel));
+f010361a:	b8 00 00 00 00       	mov    $0x0,%eax
+f010361f:	0f 00 d0             	lldt   %ax
+}
+f0103622:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0103625:	c9                   	leave
+f0103626:	c3                   	ret
+
+f0103627 <env_init>:
+env_init(void) {
+f0103627:	55                   	push   %ebp
+f0103628:	89 e5                	mov    %esp,%ebp
+f010362a:	56                   	push   %esi
+f010362b:	53                   	push   %ebx
+        envs[i].env_rq_cpu = -1;
+f010362c:	8b 1d 60 42 62 f0    	mov    0xf0624260,%ebx
+f0103632:	8b 15 80 62 66 f0    	mov    0xf0666280,%edx
+f0103638:	8d 83 70 3f 02 00    	lea    0x23f70(%ebx),%eax
+f010363e:	81 eb 90 00 00 00    	sub    $0x90,%ebx
+    for (int i = NENV - 1; i > -1; --i) {
+f0103644:	b9 00 00 00 00       	mov    $0x0,%ecx
+        envs[i].env_link = env_free_list;
+f0103649:	be 01 00 00 00       	mov    $0x1,%esi
+    for (int i = NENV - 1; i > -1; --i) {
+f010364e:	eb 15                	jmp    f0103665 <env_init+0x3e>
+        envs[i].env_rq_cpu = -1;
+f0103650:	89 c1                	mov    %eax,%ecx
+f0103652:	c7 40 68 ff ff ff ff 	movl   $0xffffffff,0x68(%eax)
+        envs[i].env_link = env_free_list;
+f0103659:	89 50 44             	mov    %edx,0x44(%eax)
+    for (int i = NENV - 1; i > -1; --i) {
+f010365c:	2d 90 00 00 00       	sub    $0x90,%eax
+        env_free_list = envs + i;
+f0103661:	89 ca                	mov    %ecx,%edx
+        envs[i].env_link = env_free_list;
+f0103663:	89 f1                	mov    %esi,%ecx
+    for (int i = NENV - 1; i > -1; --i) {
+f0103665:	39 d8                	cmp    %ebx,%eax
+f0103667:	75 e7                	jne    f0103650 <env_init+0x29>
+f0103669:	84 c9                	test   %cl,%cl
+f010366b:	74 06                	je     f0103673 <env_init+0x4c>
+f010366d:	89 15 80 62 66 f0    	mov    %edx,0xf0666280
+    env_init_percpu();
+f0103673:	e8 22 ff ff ff       	call   f010359a <env_init_percpu>
+}
+f0103678:	5b                   	pop    %ebx
+f0103679:	5e                   	pop    %esi
+f010367a:	5d                   	pop    %ebp
+f010367b:	c3                   	ret
+
+f010367c <env_alloc>:
+env_alloc(struct Env **newenv_store, envid_t parent_id) {
+f010367c:	55                   	push   %ebp
+f010367d:	89 e5                	mov    %esp,%ebp
+f010367f:	56                   	push   %esi
+f0103680:	53                   	push   %ebx
+    spin_lock(&env_lock);
+f0103681:	83 ec 0c             	sub    $0xc,%esp
+f0103684:	68 a0 65 11 f0       	push   $0xf01165a0
+f0103689:	e8 5c 3b 00 00       	call   f01071ea <spin_lock>
+    if (!(e = env_free_list)) {
+f010368e:	8b 1d 80 62 66 f0    	mov    0xf0666280,%ebx
+f0103694:	83 c4 10             	add    $0x10,%esp
+f0103697:	85 db                	test   %ebx,%ebx
+f0103699:	0f 84 23 02 00 00    	je     f01038c2 <env_alloc+0x246>
+    env_free_list = e->env_link;
+f010369f:	8b 43 44             	mov    0x44(%ebx),%eax
+f01036a2:	a3 80 62 66 f0       	mov    %eax,0xf0666280
+    spin_unlock(&env_lock);
+f01036a7:	83 ec 0c             	sub    $0xc,%esp
+f01036aa:	68 a0 65 11 f0       	push   $0xf01165a0
+f01036af:	e8 2e 3c 00 00       	call   f01072e2 <spin_unlock>
+    if (!(pp = page_alloc(ALLOC_ZERO)))
+f01036b4:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+f01036bb:	e8 a4 da ff ff       	call   f0101164 <page_alloc>
+f01036c0:	83 c4 10             	add    $0x10,%esp
+f01036c3:	85 c0                	test   %eax,%eax
+f01036c5:	0f 84 71 02 00 00    	je     f010393c <env_alloc+0x2c0>
+	return (pp - pages) << PGSHIFT;
+f01036cb:	89 c2                	mov    %eax,%edx
+f01036cd:	2b 15 d0 76 66 f0    	sub    0xf06676d0,%edx
+f01036d3:	c1 fa 03             	sar    $0x3,%edx
+f01036d6:	89 d1                	mov    %edx,%ecx
+f01036d8:	c1 e1 0c             	shl    $0xc,%ecx
+	if (PGNUM(pa) >= npages)
+f01036db:	81 e2 ff ff 0f 00    	and    $0xfffff,%edx
+f01036e1:	3b 15 c8 76 66 f0    	cmp    0xf06676c8,%edx
+f01036e7:	0f 83 ec 01 00 00    	jae    f01038d9 <env_alloc+0x25d>
+	return (void *)(pa + KERNBASE);
+f01036ed:	81 e9 00 00 00 10    	sub    $0x10000000,%ecx
+f01036f3:	89 4b 70             	mov    %ecx,0x70(%ebx)
+    ++pp->pp_ref;
+f01036f6:	66 83 40 04 01       	addw   $0x1,0x4(%eax)
+    e->env_pgdir[PDX(UVPT)] = PADDR(e->env_pgdir) | PTE_P | PTE_U;
+f01036fb:	8b 43 70             	mov    0x70(%ebx),%eax
+	if ((uint32_t)kva < KERNBASE)
+f01036fe:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0103703:	0f 86 e2 01 00 00    	jbe    f01038eb <env_alloc+0x26f>
+	return (physaddr_t)kva - KERNBASE;
+f0103709:	8d 90 00 00 00 10    	lea    0x10000000(%eax),%edx
+f010370f:	83 ca 05             	or     $0x5,%edx
+f0103712:	89 90 f4 0e 00 00    	mov    %edx,0xef4(%eax)
+	if ((uint32_t)kva < KERNBASE)
+f0103718:	b8 00 b0 10 f0       	mov    $0xf010b000,%eax
+f010371d:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0103722:	0f 86 d8 01 00 00    	jbe    f0103900 <env_alloc+0x284>
+    boot_map_region(e->env_pgdir, (uintptr_t) __USER_MAP_BEGIN__, __USER_MAP_END__ - __USER_MAP_BEGIN__,
+f0103728:	83 ec 0c             	sub    $0xc,%esp
+f010372b:	6a 03                	push   $0x3
+f010372d:	68 00 b0 10 00       	push   $0x10b000
+f0103732:	b8 00 50 11 f0       	mov    $0xf0115000,%eax
+f0103737:	2d 00 b0 10 f0       	sub    $0xf010b000,%eax
+f010373c:	50                   	push   %eax
+f010373d:	68 00 b0 10 f0       	push   $0xf010b000
+f0103742:	ff 73 70             	push   0x70(%ebx)
+f0103745:	e8 d5 db ff ff       	call   f010131f <boot_map_region>
+f010374a:	83 c4 20             	add    $0x20,%esp
+    for (uintptr_t va = KSTACKTOP - (KSTKSIZE + KSTKGAP) * NCPU; va < KSTACKTOP; va += PGSIZE)
+f010374d:	b8 00 00 f8 ef       	mov    $0xeff80000,%eax
+        e->env_pgdir[PDX(va)] = kern_pgdir[PDX(va)];
+f0103752:	89 c2                	mov    %eax,%edx
+f0103754:	c1 ea 16             	shr    $0x16,%edx
+f0103757:	8b 0d cc 76 66 f0    	mov    0xf06676cc,%ecx
+f010375d:	8b 34 91             	mov    (%ecx,%edx,4),%esi
+f0103760:	8b 4b 70             	mov    0x70(%ebx),%ecx
+f0103763:	89 34 91             	mov    %esi,(%ecx,%edx,4)
+    for (uintptr_t va = KSTACKTOP - (KSTKSIZE + KSTKGAP) * NCPU; va < KSTACKTOP; va += PGSIZE)
+f0103766:	05 00 10 00 00       	add    $0x1000,%eax
+f010376b:	3d 00 00 00 f0       	cmp    $0xf0000000,%eax
+f0103770:	75 e0                	jne    f0103752 <env_alloc+0xd6>
+    e->env_pgdir[PDX(UENVS)] = kern_pgdir[PDX(UENVS)];
+f0103772:	8b 43 70             	mov    0x70(%ebx),%eax
+f0103775:	8b 15 cc 76 66 f0    	mov    0xf06676cc,%edx
+f010377b:	8b 92 ec 0e 00 00    	mov    0xeec(%edx),%edx
+f0103781:	89 90 ec 0e 00 00    	mov    %edx,0xeec(%eax)
+    boot_map_region(e->env_pgdir, (uintptr_t) envs, NENV * sizeof(struct Env), PADDR(envs), PTE_P | PTE_W);
+f0103787:	a1 60 42 62 f0       	mov    0xf0624260,%eax
+f010378c:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0103791:	0f 86 7e 01 00 00    	jbe    f0103915 <env_alloc+0x299>
+f0103797:	83 ec 0c             	sub    $0xc,%esp
+f010379a:	6a 03                	push   $0x3
+	return (physaddr_t)kva - KERNBASE;
+f010379c:	8d 90 00 00 00 10    	lea    0x10000000(%eax),%edx
+f01037a2:	52                   	push   %edx
+f01037a3:	68 00 40 02 00       	push   $0x24000
+f01037a8:	50                   	push   %eax
+f01037a9:	ff 73 70             	push   0x70(%ebx)
+f01037ac:	e8 6e db ff ff       	call   f010131f <boot_map_region>
+    if (!(pp = page_alloc(ALLOC_ZERO)))
+f01037b1:	83 c4 14             	add    $0x14,%esp
+f01037b4:	6a 01                	push   $0x1
+f01037b6:	e8 a9 d9 ff ff       	call   f0101164 <page_alloc>
+f01037bb:	83 c4 10             	add    $0x10,%esp
+f01037be:	85 c0                	test   %eax,%eax
+f01037c0:	0f 84 76 01 00 00    	je     f010393c <env_alloc+0x2c0>
+	return (pp - pages) << PGSHIFT;
+f01037c6:	89 c2                	mov    %eax,%edx
+f01037c8:	2b 15 d0 76 66 f0    	sub    0xf06676d0,%edx
+f01037ce:	c1 fa 03             	sar    $0x3,%edx
+f01037d1:	89 d1                	mov    %edx,%ecx
+f01037d3:	c1 e1 0c             	shl    $0xc,%ecx
+	if (PGNUM(pa) >= npages)
+f01037d6:	81 e2 ff ff 0f 00    	and    $0xfffff,%edx
+f01037dc:	3b 15 c8 76 66 f0    	cmp    0xf06676c8,%edx
+f01037e2:	0f 83 42 01 00 00    	jae    f010392a <env_alloc+0x2ae>
+	return (void *)(pa + KERNBASE);
+f01037e8:	81 e9 00 00 00 10    	sub    $0x10000000,%ecx
+f01037ee:	89 4b 74             	mov    %ecx,0x74(%ebx)
+    ++pp->pp_ref;
+f01037f1:	66 83 40 04 01       	addw   $0x1,0x4(%eax)
+    memmove(e->env_kern_pgdir, kern_pgdir, PGSIZE);
+f01037f6:	83 ec 04             	sub    $0x4,%esp
+f01037f9:	68 00 10 00 00       	push   $0x1000
+f01037fe:	ff 35 cc 76 66 f0    	push   0xf06676cc
+f0103804:	ff 73 74             	push   0x74(%ebx)
+f0103807:	e8 24 31 00 00       	call   f0106930 <memmove>
+    check_isolate(e);
+f010380c:	89 d8                	mov    %ebx,%eax
+f010380e:	e8 f3 fa ff ff       	call   f0103306 <check_isolate>
+    generation = (e->env_id + (1 << ENVGENSHIFT)) & ~(NENV - 1);
+f0103813:	8b 43 48             	mov    0x48(%ebx),%eax
+f0103816:	05 00 10 00 00       	add    $0x1000,%eax
+    if (generation <= 0)  // Don't create a negative env_id.
+f010381b:	83 c4 0c             	add    $0xc,%esp
+        generation = 1 << ENVGENSHIFT;
+f010381e:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+f0103823:	ba 00 10 00 00       	mov    $0x1000,%edx
+f0103828:	0f 4e c2             	cmovle %edx,%eax
+    e->env_id = generation | (e - envs);
+f010382b:	89 da                	mov    %ebx,%edx
+f010382d:	2b 15 60 42 62 f0    	sub    0xf0624260,%edx
+f0103833:	c1 fa 04             	sar    $0x4,%edx
+f0103836:	69 d2 39 8e e3 38    	imul   $0x38e38e39,%edx,%edx
+f010383c:	09 d0                	or     %edx,%eax
+f010383e:	89 43 48             	mov    %eax,0x48(%ebx)
+    e->env_parent_id = parent_id;
+f0103841:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0103844:	89 43 4c             	mov    %eax,0x4c(%ebx)
+    e->env_type = ENV_TYPE_USER;
+f0103847:	c7 43 50 00 00 00 00 	movl   $0x0,0x50(%ebx)
+    e->env_status = ENV_RUNNABLE;
+f010384e:	c7 43 54 02 00 00 00 	movl   $0x2,0x54(%ebx)
+    e->env_runs = 0;
+f0103855:	c7 43 58 00 00 00 00 	movl   $0x0,0x58(%ebx)
+    memset(&e->env_tf, 0, sizeof(e->env_tf));
+f010385c:	6a 44                	push   $0x44
+f010385e:	6a 00                	push   $0x0
+f0103860:	53                   	push   %ebx
+f0103861:	e8 95 30 00 00       	call   f01068fb <memset>
+    e->env_tf.tf_ds = GD_UD | 3;
+f0103866:	66 c7 43 24 23 00    	movw   $0x23,0x24(%ebx)
+    e->env_tf.tf_es = GD_UD | 3;
+f010386c:	66 c7 43 20 23 00    	movw   $0x23,0x20(%ebx)
+    e->env_tf.tf_ss = GD_UD | 3;
+f0103872:	66 c7 43 40 23 00    	movw   $0x23,0x40(%ebx)
+    e->env_tf.tf_esp = USTACKTOP;
+f0103878:	c7 43 3c 00 e0 bf ee 	movl   $0xeebfe000,0x3c(%ebx)
+    e->env_tf.tf_cs = GD_UT | 3;
+f010387f:	66 c7 43 34 1b 00    	movw   $0x1b,0x34(%ebx)
+    e->env_tf.tf_eflags |= FL_IF;
+f0103885:	81 4b 38 00 02 00 00 	orl    $0x200,0x38(%ebx)
+    e->env_pgfault_upcall = 0;
+f010388c:	c7 43 78 00 00 00 00 	movl   $0x0,0x78(%ebx)
+    e->env_ipc_recving = 0;
+f0103893:	c6 43 7c 00          	movb   $0x0,0x7c(%ebx)
+    *newenv_store = e;
+f0103897:	8b 45 08             	mov    0x8(%ebp),%eax
+f010389a:	89 18                	mov    %ebx,(%eax)
+f010389c:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+    e->env_cpunum = thiscpu - cpus;
+f01038a2:	2d 00 49 11 f0       	sub    $0xf0114900,%eax
+f01038a7:	c1 f8 02             	sar    $0x2,%eax
+f01038aa:	69 c0 e1 83 0f 3e    	imul   $0x3e0f83e1,%eax,%eax
+f01038b0:	89 43 5c             	mov    %eax,0x5c(%ebx)
+    return 0;
+f01038b3:	83 c4 10             	add    $0x10,%esp
+f01038b6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f01038bb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f01038be:	5b                   	pop    %ebx
+f01038bf:	5e                   	pop    %esi
+f01038c0:	5d                   	pop    %ebp
+f01038c1:	c3                   	ret
+        spin_unlock(&env_lock);
+f01038c2:	83 ec 0c             	sub    $0xc,%esp
+f01038c5:	68 a0 65 11 f0       	push   $0xf01165a0
+f01038ca:	e8 13 3a 00 00       	call   f01072e2 <spin_unlock>
+        return -E_NO_FREE_ENV;
+f01038cf:	83 c4 10             	add    $0x10,%esp
+f01038d2:	b8 fb ff ff ff       	mov    $0xfffffffb,%eax
+f01038d7:	eb e2                	jmp    f01038bb <env_alloc+0x23f>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f01038d9:	51                   	push   %ecx
+f01038da:	68 64 82 10 f0       	push   $0xf0108264
+f01038df:	6a 5a                	push   $0x5a
+f01038e1:	68 05 93 10 f0       	push   $0xf0109305
+f01038e6:	e8 67 c7 ff ff       	call   f0100052 <_panic>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f01038eb:	50                   	push   %eax
+f01038ec:	68 88 82 10 f0       	push   $0xf0108288
+f01038f1:	68 db 00 00 00       	push   $0xdb
+f01038f6:	68 37 96 10 f0       	push   $0xf0109637
+f01038fb:	e8 52 c7 ff ff       	call   f0100052 <_panic>
+f0103900:	50                   	push   %eax
+f0103901:	68 88 82 10 f0       	push   $0xf0108288
+f0103906:	68 de 00 00 00       	push   $0xde
+f010390b:	68 37 96 10 f0       	push   $0xf0109637
+f0103910:	e8 3d c7 ff ff       	call   f0100052 <_panic>
+f0103915:	50                   	push   %eax
+f0103916:	68 88 82 10 f0       	push   $0xf0108288
+f010391b:	68 e4 00 00 00       	push   $0xe4
+f0103920:	68 37 96 10 f0       	push   $0xf0109637
+f0103925:	e8 28 c7 ff ff       	call   f0100052 <_panic>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f010392a:	51                   	push   %ecx
+f010392b:	68 64 82 10 f0       	push   $0xf0108264
+f0103930:	6a 5a                	push   $0x5a
+f0103932:	68 05 93 10 f0       	push   $0xf0109305
+f0103937:	e8 16 c7 ff ff       	call   f0100052 <_panic>
+        spin_lock(&env_lock);
+f010393c:	83 ec 0c             	sub    $0xc,%esp
+f010393f:	68 a0 65 11 f0       	push   $0xf01165a0
+f0103944:	e8 a1 38 00 00       	call   f01071ea <spin_lock>
+        e->env_link = env_free_list;
+f0103949:	a1 80 62 66 f0       	mov    0xf0666280,%eax
+f010394e:	89 43 44             	mov    %eax,0x44(%ebx)
+        env_free_list = e;
+f0103951:	89 1d 80 62 66 f0    	mov    %ebx,0xf0666280
+        spin_unlock(&env_lock);
+f0103957:	c7 04 24 a0 65 11 f0 	movl   $0xf01165a0,(%esp)
+f010395e:	e8 7f 39 00 00       	call   f01072e2 <spin_unlock>
+        return r;
+f0103963:	83 c4 10             	add    $0x10,%esp
+f0103966:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f010396b:	e9 4b ff ff ff       	jmp    f01038bb <env_alloc+0x23f>
+
+f0103970 <region_alloc>:
+region_alloc(struct Env *e, void *va, size_t len) {
+f0103970:	55                   	push   %ebp
+f0103971:	89 e5                	mov    %esp,%ebp
+f0103973:	57                   	push   %edi
+f0103974:	56                   	push   %esi
+f0103975:	53                   	push   %ebx
+f0103976:	83 ec 1c             	sub    $0x1c,%esp
+f0103979:	8b 7d 08             	mov    0x8(%ebp),%edi
+f010397c:	8b 45 0c             	mov    0xc(%ebp),%eax
+    uintptr_t vstart = (uintptr_t) ROUNDDOWN((uintptr_t) va, PGSIZE),
+f010397f:	89 c6                	mov    %eax,%esi
+f0103981:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+        vend = (uintptr_t) ROUNDUP((uintptr_t) va + len, PGSIZE);
+f0103987:	8b 55 10             	mov    0x10(%ebp),%edx
+f010398a:	8d 84 10 ff 0f 00 00 	lea    0xfff(%eax,%edx,1),%eax
+f0103991:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f0103996:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    for (uintptr_t vptr = vstart; vptr < vend; vptr += PGSIZE) {
+f0103999:	eb 34                	jmp    f01039cf <region_alloc+0x5f>
+            panic("region_alloc: page_alloc failed");
+f010399b:	83 ec 04             	sub    $0x4,%esp
+f010399e:	68 e0 96 10 f0       	push   $0xf01096e0
+f01039a3:	68 62 01 00 00       	push   $0x162
+f01039a8:	68 37 96 10 f0       	push   $0xf0109637
+f01039ad:	e8 a0 c6 ff ff       	call   f0100052 <_panic>
+            panic("region_alloc: page_insert failed");
+f01039b2:	83 ec 04             	sub    $0x4,%esp
+f01039b5:	68 00 97 10 f0       	push   $0xf0109700
+f01039ba:	68 64 01 00 00       	push   $0x164
+f01039bf:	68 37 96 10 f0       	push   $0xf0109637
+f01039c4:	e8 89 c6 ff ff       	call   f0100052 <_panic>
+    for (uintptr_t vptr = vstart; vptr < vend; vptr += PGSIZE) {
+f01039c9:	81 c6 00 10 00 00    	add    $0x1000,%esi
+f01039cf:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01039d2:	39 c6                	cmp    %eax,%esi
+f01039d4:	73 50                	jae    f0103a26 <region_alloc+0xb6>
+        struct PageInfo *pp = page_alloc(0);
+f01039d6:	83 ec 0c             	sub    $0xc,%esp
+f01039d9:	6a 00                	push   $0x0
+f01039db:	e8 84 d7 ff ff       	call   f0101164 <page_alloc>
+f01039e0:	89 c3                	mov    %eax,%ebx
+        if (!pp)
+f01039e2:	83 c4 10             	add    $0x10,%esp
+f01039e5:	85 c0                	test   %eax,%eax
+f01039e7:	74 b2                	je     f010399b <region_alloc+0x2b>
+        if (page_insert(e->env_pgdir, pp, (void *) vptr, PTE_W | PTE_U))
+f01039e9:	6a 06                	push   $0x6
+f01039eb:	56                   	push   %esi
+f01039ec:	50                   	push   %eax
+f01039ed:	ff 77 70             	push   0x70(%edi)
+f01039f0:	e8 48 da ff ff       	call   f010143d <page_insert>
+f01039f5:	83 c4 10             	add    $0x10,%esp
+f01039f8:	85 c0                	test   %eax,%eax
+f01039fa:	75 b6                	jne    f01039b2 <region_alloc+0x42>
+        if (page_insert(e->env_kern_pgdir, pp, (void *) vptr, PTE_W | PTE_U))
+f01039fc:	6a 06                	push   $0x6
+f01039fe:	56                   	push   %esi
+f01039ff:	53                   	push   %ebx
+f0103a00:	ff 77 74             	push   0x74(%edi)
+f0103a03:	e8 35 da ff ff       	call   f010143d <page_insert>
+f0103a08:	83 c4 10             	add    $0x10,%esp
+f0103a0b:	85 c0                	test   %eax,%eax
+f0103a0d:	74 ba                	je     f01039c9 <region_alloc+0x59>
+            panic("region_alloc: page_insert failed");
+f0103a0f:	83 ec 04             	sub    $0x4,%esp
+f0103a12:	68 00 97 10 f0       	push   $0xf0109700
+f0103a17:	68 67 01 00 00       	push   $0x167
+f0103a1c:	68 37 96 10 f0       	push   $0xf0109637
+f0103a21:	e8 2c c6 ff ff       	call   f0100052 <_panic>
+}
+f0103a26:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0103a29:	5b                   	pop    %ebx
+f0103a2a:	5e                   	pop    %esi
+f0103a2b:	5f                   	pop    %edi
+f0103a2c:	5d                   	pop    %ebp
+f0103a2d:	c3                   	ret
+
+f0103a2e <env_create>:
+env_create(uint8_t *binary, enum EnvType type) {
+f0103a2e:	55                   	push   %ebp
+f0103a2f:	89 e5                	mov    %esp,%ebp
+f0103a31:	57                   	push   %edi
+f0103a32:	56                   	push   %esi
+f0103a33:	53                   	push   %ebx
+f0103a34:	83 ec 44             	sub    $0x44,%esp
+f0103a37:	8b 75 0c             	mov    0xc(%ebp),%esi
+    struct Env *e = NULL;
+f0103a3a:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+    if ((ret = env_alloc(&e, 0)))
+f0103a41:	6a 00                	push   $0x0
+f0103a43:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0103a46:	50                   	push   %eax
+f0103a47:	e8 30 fc ff ff       	call   f010367c <env_alloc>
+f0103a4c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f0103a4f:	83 c4 10             	add    $0x10,%esp
+f0103a52:	85 c0                	test   %eax,%eax
+f0103a54:	75 30                	jne    f0103a86 <env_create+0x58>
+    e->env_type = type;
+f0103a56:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0103a59:	89 45 c0             	mov    %eax,-0x40(%ebp)
+f0103a5c:	89 70 50             	mov    %esi,0x50(%eax)
+    if (ELFHDR->e_magic != ELF_MAGIC)
+f0103a5f:	8b 45 08             	mov    0x8(%ebp),%eax
+f0103a62:	81 38 7f 45 4c 46    	cmpl   $0x464c457f,(%eax)
+f0103a68:	75 31                	jne    f0103a9b <env_create+0x6d>
+    ph = (struct Proghdr *) ((uint8_t *) ELFHDR + ELFHDR->e_phoff);
+f0103a6a:	8b 45 08             	mov    0x8(%ebp),%eax
+f0103a6d:	89 c3                	mov    %eax,%ebx
+f0103a6f:	03 58 1c             	add    0x1c(%eax),%ebx
+    eph = ph + ELFHDR->e_phnum;
+f0103a72:	0f b7 40 2c          	movzwl 0x2c(%eax),%eax
+f0103a76:	c1 e0 05             	shl    $0x5,%eax
+f0103a79:	01 d8                	add    %ebx,%eax
+f0103a7b:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    for (; ph < eph; ++ph) {
+f0103a7e:	89 75 0c             	mov    %esi,0xc(%ebp)
+f0103a81:	e9 5c 01 00 00       	jmp    f0103be2 <env_create+0x1b4>
+        panic("env_create: %e", ret);
+f0103a86:	50                   	push   %eax
+f0103a87:	68 71 96 10 f0       	push   $0xf0109671
+f0103a8c:	68 ef 01 00 00       	push   $0x1ef
+f0103a91:	68 37 96 10 f0       	push   $0xf0109637
+f0103a96:	e8 b7 c5 ff ff       	call   f0100052 <_panic>
+        panic("load_icode: binary is not ELF_MAGIC");
+f0103a9b:	83 ec 04             	sub    $0x4,%esp
+f0103a9e:	68 24 97 10 f0       	push   $0xf0109724
+f0103aa3:	68 c9 01 00 00       	push   $0x1c9
+f0103aa8:	68 37 96 10 f0       	push   $0xf0109637
+f0103aad:	e8 a0 c5 ff ff       	call   f0100052 <_panic>
+f0103ab2:	51                   	push   %ecx
+f0103ab3:	68 64 82 10 f0       	push   $0xf0108264
+f0103ab8:	6a 5a                	push   $0x5a
+f0103aba:	68 05 93 10 f0       	push   $0xf0109305
+f0103abf:	e8 8e c5 ff ff       	call   f0100052 <_panic>
+        addr += size;
+f0103ac4:	01 df                	add    %ebx,%edi
+        n -= size;
+f0103ac6:	29 de                	sub    %ebx,%esi
+        off = 0;
+f0103ac8:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0103acb:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    while (n > 0) {
+f0103ace:	85 f6                	test   %esi,%esi
+f0103ad0:	74 5e                	je     f0103b30 <env_create+0x102>
+        int size = n > PGSIZE ? PGSIZE - off : n;
+f0103ad2:	bb 00 10 00 00       	mov    $0x1000,%ebx
+f0103ad7:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0103ada:	29 c3                	sub    %eax,%ebx
+f0103adc:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+f0103ae2:	0f 46 de             	cmovbe %esi,%ebx
+        struct PageInfo *pp = page_lookup(pgdir, (void *) addr, NULL);
+f0103ae5:	83 ec 04             	sub    $0x4,%esp
+f0103ae8:	6a 00                	push   $0x0
+f0103aea:	57                   	push   %edi
+f0103aeb:	ff 75 cc             	push   -0x34(%ebp)
+f0103aee:	e8 77 d8 ff ff       	call   f010136a <page_lookup>
+        if (pp)
+f0103af3:	83 c4 10             	add    $0x10,%esp
+f0103af6:	85 c0                	test   %eax,%eax
+f0103af8:	74 ca                	je     f0103ac4 <env_create+0x96>
+	return (pp - pages) << PGSHIFT;
+f0103afa:	2b 05 d0 76 66 f0    	sub    0xf06676d0,%eax
+f0103b00:	c1 f8 03             	sar    $0x3,%eax
+f0103b03:	89 c1                	mov    %eax,%ecx
+f0103b05:	c1 e1 0c             	shl    $0xc,%ecx
+	if (PGNUM(pa) >= npages)
+f0103b08:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0103b0d:	3b 05 c8 76 66 f0    	cmp    0xf06676c8,%eax
+f0103b13:	73 9d                	jae    f0103ab2 <env_create+0x84>
+            memset(page2kva(pp) + off, c, size);
+f0103b15:	83 ec 04             	sub    $0x4,%esp
+f0103b18:	53                   	push   %ebx
+f0103b19:	6a 00                	push   $0x0
+f0103b1b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0103b1e:	8d 84 08 00 00 00 f0 	lea    -0x10000000(%eax,%ecx,1),%eax
+f0103b25:	50                   	push   %eax
+f0103b26:	e8 d0 2d 00 00       	call   f01068fb <memset>
+f0103b2b:	83 c4 10             	add    $0x10,%esp
+f0103b2e:	eb 94                	jmp    f0103ac4 <env_create+0x96>
+            user_memmove(e->env_pgdir, (void *) ph->p_va, binary + ph->p_offset, ph->p_filesz);
+f0103b30:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+f0103b33:	8b 73 10             	mov    0x10(%ebx),%esi
+f0103b36:	8b 7b 08             	mov    0x8(%ebx),%edi
+f0103b39:	8b 45 c0             	mov    -0x40(%ebp),%eax
+f0103b3c:	8b 40 70             	mov    0x70(%eax),%eax
+f0103b3f:	89 45 c8             	mov    %eax,-0x38(%ebp)
+f0103b42:	8b 45 08             	mov    0x8(%ebp),%eax
+f0103b45:	03 43 04             	add    0x4(%ebx),%eax
+f0103b48:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    int off = addr - ROUNDDOWN(addr, PGSIZE);
+f0103b4b:	89 f8                	mov    %edi,%eax
+f0103b4d:	25 ff 0f 00 00       	and    $0xfff,%eax
+f0103b52:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    while (n > 0) {
+f0103b55:	89 5d bc             	mov    %ebx,-0x44(%ebp)
+f0103b58:	eb 1f                	jmp    f0103b79 <env_create+0x14b>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0103b5a:	51                   	push   %ecx
+f0103b5b:	68 64 82 10 f0       	push   $0xf0108264
+f0103b60:	6a 5a                	push   $0x5a
+f0103b62:	68 05 93 10 f0       	push   $0xf0109305
+f0103b67:	e8 e6 c4 ff ff       	call   f0100052 <_panic>
+        addr += size;
+f0103b6c:	01 df                	add    %ebx,%edi
+        cur_src += size;
+f0103b6e:	01 5d cc             	add    %ebx,-0x34(%ebp)
+        n -= size;
+f0103b71:	29 de                	sub    %ebx,%esi
+        off = 0;
+f0103b73:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0103b76:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    while (n > 0) {
+f0103b79:	85 f6                	test   %esi,%esi
+f0103b7b:	74 5f                	je     f0103bdc <env_create+0x1ae>
+        int size = n > PGSIZE ? PGSIZE - off : n;
+f0103b7d:	bb 00 10 00 00       	mov    $0x1000,%ebx
+f0103b82:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0103b85:	29 c3                	sub    %eax,%ebx
+f0103b87:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+f0103b8d:	0f 46 de             	cmovbe %esi,%ebx
+        struct PageInfo *pp = page_lookup(pgdir, (void *) addr, NULL);
+f0103b90:	83 ec 04             	sub    $0x4,%esp
+f0103b93:	6a 00                	push   $0x0
+f0103b95:	57                   	push   %edi
+f0103b96:	ff 75 c8             	push   -0x38(%ebp)
+f0103b99:	e8 cc d7 ff ff       	call   f010136a <page_lookup>
+        if (pp)
+f0103b9e:	83 c4 10             	add    $0x10,%esp
+f0103ba1:	85 c0                	test   %eax,%eax
+f0103ba3:	74 c7                	je     f0103b6c <env_create+0x13e>
+	return (pp - pages) << PGSHIFT;
+f0103ba5:	2b 05 d0 76 66 f0    	sub    0xf06676d0,%eax
+f0103bab:	c1 f8 03             	sar    $0x3,%eax
+f0103bae:	89 c1                	mov    %eax,%ecx
+f0103bb0:	c1 e1 0c             	shl    $0xc,%ecx
+	if (PGNUM(pa) >= npages)
+f0103bb3:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0103bb8:	3b 05 c8 76 66 f0    	cmp    0xf06676c8,%eax
+f0103bbe:	73 9a                	jae    f0103b5a <env_create+0x12c>
+            memmove(page2kva(pp) + off, (const void *) cur_src, size);
+f0103bc0:	83 ec 04             	sub    $0x4,%esp
+f0103bc3:	53                   	push   %ebx
+f0103bc4:	ff 75 cc             	push   -0x34(%ebp)
+f0103bc7:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0103bca:	8d 84 08 00 00 00 f0 	lea    -0x10000000(%eax,%ecx,1),%eax
+f0103bd1:	50                   	push   %eax
+f0103bd2:	e8 59 2d 00 00       	call   f0106930 <memmove>
+f0103bd7:	83 c4 10             	add    $0x10,%esp
+f0103bda:	eb 90                	jmp    f0103b6c <env_create+0x13e>
+f0103bdc:	8b 5d bc             	mov    -0x44(%ebp),%ebx
+    for (; ph < eph; ++ph) {
+f0103bdf:	83 c3 20             	add    $0x20,%ebx
+f0103be2:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+f0103be5:	39 c3                	cmp    %eax,%ebx
+f0103be7:	73 3a                	jae    f0103c23 <env_create+0x1f5>
+        if (ph->p_type == ELF_PROG_LOAD) {
+f0103be9:	83 3b 01             	cmpl   $0x1,(%ebx)
+f0103bec:	75 f1                	jne    f0103bdf <env_create+0x1b1>
+            region_alloc(e, (void *) ph->p_va, ph->p_memsz);
+f0103bee:	83 ec 04             	sub    $0x4,%esp
+f0103bf1:	ff 73 14             	push   0x14(%ebx)
+f0103bf4:	ff 73 08             	push   0x8(%ebx)
+f0103bf7:	ff 75 c0             	push   -0x40(%ebp)
+f0103bfa:	e8 71 fd ff ff       	call   f0103970 <region_alloc>
+            user_memset(e->env_pgdir, (void *) ph->p_va, 0, ph->p_memsz);
+f0103bff:	8b 73 14             	mov    0x14(%ebx),%esi
+f0103c02:	8b 7b 08             	mov    0x8(%ebx),%edi
+f0103c05:	8b 45 c0             	mov    -0x40(%ebp),%eax
+f0103c08:	8b 40 70             	mov    0x70(%eax),%eax
+f0103c0b:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    int off = addr - ROUNDDOWN(addr, PGSIZE);
+f0103c0e:	89 f8                	mov    %edi,%eax
+f0103c10:	25 ff 0f 00 00       	and    $0xfff,%eax
+f0103c15:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    while (n > 0) {
+f0103c18:	83 c4 10             	add    $0x10,%esp
+f0103c1b:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+f0103c1e:	e9 ab fe ff ff       	jmp    f0103ace <env_create+0xa0>
+    region_alloc(e, (void *) (USTACKTOP - PGSIZE), PGSIZE);
+f0103c23:	8b 75 0c             	mov    0xc(%ebp),%esi
+f0103c26:	83 ec 04             	sub    $0x4,%esp
+f0103c29:	68 00 10 00 00       	push   $0x1000
+f0103c2e:	68 00 d0 bf ee       	push   $0xeebfd000
+f0103c33:	8b 7d c0             	mov    -0x40(%ebp),%edi
+f0103c36:	57                   	push   %edi
+f0103c37:	e8 34 fd ff ff       	call   f0103970 <region_alloc>
+    e->env_brk = USTACKTOP - PGSIZE;
+f0103c3c:	c7 47 6c 00 d0 bf ee 	movl   $0xeebfd000,0x6c(%edi)
+    e->env_tf.tf_eip = ELFHDR->e_entry;
+f0103c43:	8b 45 08             	mov    0x8(%ebp),%eax
+f0103c46:	8b 40 18             	mov    0x18(%eax),%eax
+f0103c49:	89 47 30             	mov    %eax,0x30(%edi)
+    if (type == ENV_TYPE_FS)
+f0103c4c:	83 c4 10             	add    $0x10,%esp
+f0103c4f:	83 fe 01             	cmp    $0x1,%esi
+f0103c52:	74 16                	je     f0103c6a <env_create+0x23c>
+    sched_enqueue(e);
+f0103c54:	83 ec 0c             	sub    $0xc,%esp
+f0103c57:	ff 75 c0             	push   -0x40(%ebp)
+f0103c5a:	e8 1b 14 00 00       	call   f010507a <sched_enqueue>
+}
+f0103c5f:	83 c4 10             	add    $0x10,%esp
+f0103c62:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0103c65:	5b                   	pop    %ebx
+f0103c66:	5e                   	pop    %esi
+f0103c67:	5f                   	pop    %edi
+f0103c68:	5d                   	pop    %ebp
+f0103c69:	c3                   	ret
+        e->env_tf.tf_eflags |= FL_IOPL_MASK;
+f0103c6a:	8b 45 c0             	mov    -0x40(%ebp),%eax
+f0103c6d:	81 48 38 00 30 00 00 	orl    $0x3000,0x38(%eax)
+f0103c74:	eb de                	jmp    f0103c54 <env_create+0x226>
+
+f0103c76 <env_free>:
+env_free(struct Env *e) {
+f0103c76:	55                   	push   %ebp
+f0103c77:	89 e5                	mov    %esp,%ebp
+f0103c79:	57                   	push   %edi
+f0103c7a:	56                   	push   %esi
+f0103c7b:	53                   	push   %ebx
+f0103c7c:	83 ec 1c             	sub    $0x1c,%esp
+f0103c7f:	8b 7d 08             	mov    0x8(%ebp),%edi
+f0103c82:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+    if (e == curenv)
+f0103c88:	39 78 0c             	cmp    %edi,0xc(%eax)
+f0103c8b:	74 1c                	je     f0103ca9 <env_free+0x33>
+    spin_lock(&vm_lock);
+f0103c8d:	83 ec 0c             	sub    $0xc,%esp
+f0103c90:	68 60 64 11 f0       	push   $0xf0116460
+f0103c95:	e8 50 35 00 00       	call   f01071ea <spin_lock>
+f0103c9a:	83 c4 10             	add    $0x10,%esp
+f0103c9d:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+f0103ca4:	e9 5a 01 00 00       	jmp    f0103e03 <env_free+0x18d>
+        lcr3(PADDR(kern_pgdir));
+f0103ca9:	a1 cc 76 66 f0       	mov    0xf06676cc,%eax
+	if ((uint32_t)kva < KERNBASE)
+f0103cae:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0103cb3:	76 0a                	jbe    f0103cbf <env_free+0x49>
+	return (physaddr_t)kva - KERNBASE;
+f0103cb5:	05 00 00 00 10       	add    $0x10000000,%eax
+	asm volatile("movl %0,%%cr3" : : "r" (val));
+f0103cba:	0f 22 d8             	mov    %eax,%cr3
+}
+f0103cbd:	eb ce                	jmp    f0103c8d <env_free+0x17>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0103cbf:	50                   	push   %eax
+f0103cc0:	68 88 82 10 f0       	push   $0xf0108288
+f0103cc5:	68 09 02 00 00       	push   $0x209
+f0103cca:	68 37 96 10 f0       	push   $0xf0109637
+f0103ccf:	e8 7e c3 ff ff       	call   f0100052 <_panic>
+        pa = PTE_ADDR(e->env_pgdir[pdeno]);
+f0103cd4:	89 c6                	mov    %eax,%esi
+f0103cd6:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (PGNUM(pa) >= npages)
+f0103cdc:	c1 e8 0c             	shr    $0xc,%eax
+f0103cdf:	89 c2                	mov    %eax,%edx
+f0103ce1:	3b 05 c8 76 66 f0    	cmp    0xf06676c8,%eax
+f0103ce7:	73 19                	jae    f0103d02 <env_free+0x8c>
+	return (void *)(pa + KERNBASE);
+f0103ce9:	81 ee 00 00 00 10    	sub    $0x10000000,%esi
+        for (pteno = 0; pteno <= PTX(~0); pteno++) {
+f0103cef:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0103cf2:	c1 e0 14             	shl    $0x14,%eax
+f0103cf5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0103cf8:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0103cfd:	89 55 dc             	mov    %edx,-0x24(%ebp)
+f0103d00:	eb 26                	jmp    f0103d28 <env_free+0xb2>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0103d02:	56                   	push   %esi
+f0103d03:	68 64 82 10 f0       	push   $0xf0108264
+f0103d08:	68 1a 02 00 00       	push   $0x21a
+f0103d0d:	68 37 96 10 f0       	push   $0xf0109637
+f0103d12:	e8 3b c3 ff ff       	call   f0100052 <_panic>
+f0103d17:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f0103d1d:	83 c6 04             	add    $0x4,%esi
+f0103d20:	81 fb 00 00 40 00    	cmp    $0x400000,%ebx
+f0103d26:	74 1b                	je     f0103d43 <env_free+0xcd>
+            if (pt[pteno] & PTE_P)
+f0103d28:	f6 06 01             	testb  $0x1,(%esi)
+f0103d2b:	74 ea                	je     f0103d17 <env_free+0xa1>
+                page_remove(e->env_pgdir, PGADDR(pdeno, pteno, 0));
+f0103d2d:	83 ec 08             	sub    $0x8,%esp
+f0103d30:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0103d33:	09 d8                	or     %ebx,%eax
+f0103d35:	50                   	push   %eax
+f0103d36:	ff 77 70             	push   0x70(%edi)
+f0103d39:	e8 b2 d6 ff ff       	call   f01013f0 <page_remove>
+f0103d3e:	83 c4 10             	add    $0x10,%esp
+f0103d41:	eb d4                	jmp    f0103d17 <env_free+0xa1>
+        e->env_pgdir[pdeno] = 0;
+f0103d43:	8b 55 dc             	mov    -0x24(%ebp),%edx
+f0103d46:	8b 47 70             	mov    0x70(%edi),%eax
+f0103d49:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+f0103d4c:	c7 04 08 00 00 00 00 	movl   $0x0,(%eax,%ecx,1)
+	if (PGNUM(pa) >= npages)
+f0103d53:	3b 15 c8 76 66 f0    	cmp    0xf06676c8,%edx
+f0103d59:	73 19                	jae    f0103d74 <env_free+0xfe>
+        page_decref(pa2page(pa));
+f0103d5b:	83 ec 0c             	sub    $0xc,%esp
+	return &pages[PGNUM(pa)];
+f0103d5e:	a1 d0 76 66 f0       	mov    0xf06676d0,%eax
+f0103d63:	8d 04 d0             	lea    (%eax,%edx,8),%eax
+f0103d66:	50                   	push   %eax
+f0103d67:	e8 fd d4 ff ff       	call   f0101269 <page_decref>
+f0103d6c:	83 c4 10             	add    $0x10,%esp
+f0103d6f:	e9 a0 00 00 00       	jmp    f0103e14 <env_free+0x19e>
+		panic("pa2page called with invalid pa");
+f0103d74:	83 ec 04             	sub    $0x4,%esp
+f0103d77:	68 00 8a 10 f0       	push   $0xf0108a00
+f0103d7c:	6a 53                	push   $0x53
+f0103d7e:	68 05 93 10 f0       	push   $0xf0109305
+f0103d83:	e8 ca c2 ff ff       	call   f0100052 <_panic>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0103d88:	56                   	push   %esi
+f0103d89:	68 64 82 10 f0       	push   $0xf0108264
+f0103d8e:	68 2d 02 00 00       	push   $0x22d
+f0103d93:	68 37 96 10 f0       	push   $0xf0109637
+f0103d98:	e8 b5 c2 ff ff       	call   f0100052 <_panic>
+        for (pteno = 0; pteno <= PTX(~0); pteno++) {
+f0103d9d:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f0103da3:	83 c6 04             	add    $0x4,%esi
+f0103da6:	81 fb 00 00 40 00    	cmp    $0x400000,%ebx
+f0103dac:	74 1b                	je     f0103dc9 <env_free+0x153>
+            if (pt[pteno] & PTE_P)
+f0103dae:	f6 06 01             	testb  $0x1,(%esi)
+f0103db1:	74 ea                	je     f0103d9d <env_free+0x127>
+                page_remove(e->env_kern_pgdir, PGADDR(pdeno, pteno, 0));
+f0103db3:	83 ec 08             	sub    $0x8,%esp
+f0103db6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0103db9:	09 d8                	or     %ebx,%eax
+f0103dbb:	50                   	push   %eax
+f0103dbc:	ff 77 74             	push   0x74(%edi)
+f0103dbf:	e8 2c d6 ff ff       	call   f01013f0 <page_remove>
+f0103dc4:	83 c4 10             	add    $0x10,%esp
+f0103dc7:	eb d4                	jmp    f0103d9d <env_free+0x127>
+        e->env_kern_pgdir[pdeno] = 0;
+f0103dc9:	8b 55 dc             	mov    -0x24(%ebp),%edx
+f0103dcc:	8b 47 74             	mov    0x74(%edi),%eax
+f0103dcf:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+f0103dd2:	c7 04 08 00 00 00 00 	movl   $0x0,(%eax,%ecx,1)
+	if (PGNUM(pa) >= npages)
+f0103dd9:	3b 15 c8 76 66 f0    	cmp    0xf06676c8,%edx
+f0103ddf:	73 75                	jae    f0103e56 <env_free+0x1e0>
+        page_decref(pa2page(pa));
+f0103de1:	83 ec 0c             	sub    $0xc,%esp
+	return &pages[PGNUM(pa)];
+f0103de4:	a1 d0 76 66 f0       	mov    0xf06676d0,%eax
+f0103de9:	8d 04 d0             	lea    (%eax,%edx,8),%eax
+f0103dec:	50                   	push   %eax
+f0103ded:	e8 77 d4 ff ff       	call   f0101269 <page_decref>
+f0103df2:	83 c4 10             	add    $0x10,%esp
+    for (pdeno = 0; pdeno < PDX(UTOP); pdeno++) {
+f0103df5:	83 45 e0 04          	addl   $0x4,-0x20(%ebp)
+f0103df9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0103dfc:	3d ec 0e 00 00       	cmp    $0xeec,%eax
+f0103e01:	74 67                	je     f0103e6a <env_free+0x1f4>
+        if (!(e->env_pgdir[pdeno] & PTE_P))
+f0103e03:	8b 47 70             	mov    0x70(%edi),%eax
+f0103e06:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+f0103e09:	8b 04 08             	mov    (%eax,%ecx,1),%eax
+f0103e0c:	a8 01                	test   $0x1,%al
+f0103e0e:	0f 85 c0 fe ff ff    	jne    f0103cd4 <env_free+0x5e>
+        if (!(e->env_kern_pgdir[pdeno] & PTE_P))
+f0103e14:	8b 47 74             	mov    0x74(%edi),%eax
+f0103e17:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+f0103e1a:	8b 04 08             	mov    (%eax,%ecx,1),%eax
+f0103e1d:	a8 01                	test   $0x1,%al
+f0103e1f:	74 d4                	je     f0103df5 <env_free+0x17f>
+        pa = PTE_ADDR(e->env_kern_pgdir[pdeno]);
+f0103e21:	89 c6                	mov    %eax,%esi
+f0103e23:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (PGNUM(pa) >= npages)
+f0103e29:	c1 e8 0c             	shr    $0xc,%eax
+f0103e2c:	89 c2                	mov    %eax,%edx
+f0103e2e:	3b 05 c8 76 66 f0    	cmp    0xf06676c8,%eax
+f0103e34:	0f 83 4e ff ff ff    	jae    f0103d88 <env_free+0x112>
+	return (void *)(pa + KERNBASE);
+f0103e3a:	81 ee 00 00 00 10    	sub    $0x10000000,%esi
+        for (pteno = 0; pteno <= PTX(~0); pteno++) {
+f0103e40:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0103e43:	c1 e0 14             	shl    $0x14,%eax
+f0103e46:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0103e49:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0103e4e:	89 55 dc             	mov    %edx,-0x24(%ebp)
+f0103e51:	e9 58 ff ff ff       	jmp    f0103dae <env_free+0x138>
+		panic("pa2page called with invalid pa");
+f0103e56:	83 ec 04             	sub    $0x4,%esp
+f0103e59:	68 00 8a 10 f0       	push   $0xf0108a00
+f0103e5e:	6a 53                	push   $0x53
+f0103e60:	68 05 93 10 f0       	push   $0xf0109305
+f0103e65:	e8 e8 c1 ff ff       	call   f0100052 <_panic>
+    for (uintptr_t va = (uintptr_t) __USER_MAP_BEGIN__; va < (uintptr_t) __USER_MAP_END__; va += PGSIZE) {
+f0103e6a:	bb 00 b0 10 f0       	mov    $0xf010b000,%ebx
+f0103e6f:	eb 1b                	jmp    f0103e8c <env_free+0x216>
+        page_decref(pa2page(pa));
+f0103e71:	83 ec 0c             	sub    $0xc,%esp
+	return &pages[PGNUM(pa)];
+f0103e74:	8b 15 d0 76 66 f0    	mov    0xf06676d0,%edx
+f0103e7a:	8d 04 c2             	lea    (%edx,%eax,8),%eax
+f0103e7d:	50                   	push   %eax
+f0103e7e:	e8 e6 d3 ff ff       	call   f0101269 <page_decref>
+    for (uintptr_t va = (uintptr_t) __USER_MAP_BEGIN__; va < (uintptr_t) __USER_MAP_END__; va += PGSIZE) {
+f0103e83:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f0103e89:	83 c4 10             	add    $0x10,%esp
+f0103e8c:	81 fb 00 50 11 f0    	cmp    $0xf0115000,%ebx
+f0103e92:	73 2a                	jae    f0103ebe <env_free+0x248>
+        pa = PTE_ADDR(e->env_pgdir[PDX(va)]);
+f0103e94:	89 da                	mov    %ebx,%edx
+f0103e96:	c1 ea 16             	shr    $0x16,%edx
+f0103e99:	8b 47 70             	mov    0x70(%edi),%eax
+f0103e9c:	8b 04 90             	mov    (%eax,%edx,4),%eax
+f0103e9f:	c1 e8 0c             	shr    $0xc,%eax
+	if (PGNUM(pa) >= npages)
+f0103ea2:	3b 05 c8 76 66 f0    	cmp    0xf06676c8,%eax
+f0103ea8:	72 c7                	jb     f0103e71 <env_free+0x1fb>
+		panic("pa2page called with invalid pa");
+f0103eaa:	83 ec 04             	sub    $0x4,%esp
+f0103ead:	68 00 8a 10 f0       	push   $0xf0108a00
+f0103eb2:	6a 53                	push   $0x53
+f0103eb4:	68 05 93 10 f0       	push   $0xf0109305
+f0103eb9:	e8 94 c1 ff ff       	call   f0100052 <_panic>
+    for (uintptr_t va = (uintptr_t) envs; va < (uintptr_t) (envs + NENV); va += PGSIZE) {
+f0103ebe:	8b 1d 60 42 62 f0    	mov    0xf0624260,%ebx
+f0103ec4:	a1 60 42 62 f0       	mov    0xf0624260,%eax
+f0103ec9:	05 00 40 02 00       	add    $0x24000,%eax
+f0103ece:	39 c3                	cmp    %eax,%ebx
+f0103ed0:	73 47                	jae    f0103f19 <env_free+0x2a3>
+        pa = PTE_ADDR(e->env_pgdir[PDX(va)]);
+f0103ed2:	89 da                	mov    %ebx,%edx
+f0103ed4:	c1 ea 16             	shr    $0x16,%edx
+f0103ed7:	8b 47 70             	mov    0x70(%edi),%eax
+f0103eda:	8b 04 90             	mov    (%eax,%edx,4),%eax
+f0103edd:	c1 e8 0c             	shr    $0xc,%eax
+	if (PGNUM(pa) >= npages)
+f0103ee0:	3b 05 c8 76 66 f0    	cmp    0xf06676c8,%eax
+f0103ee6:	73 1d                	jae    f0103f05 <env_free+0x28f>
+        page_decref(pa2page(pa));
+f0103ee8:	83 ec 0c             	sub    $0xc,%esp
+	return &pages[PGNUM(pa)];
+f0103eeb:	8b 15 d0 76 66 f0    	mov    0xf06676d0,%edx
+f0103ef1:	8d 04 c2             	lea    (%edx,%eax,8),%eax
+f0103ef4:	50                   	push   %eax
+f0103ef5:	e8 6f d3 ff ff       	call   f0101269 <page_decref>
+    for (uintptr_t va = (uintptr_t) envs; va < (uintptr_t) (envs + NENV); va += PGSIZE) {
+f0103efa:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f0103f00:	83 c4 10             	add    $0x10,%esp
+f0103f03:	eb bf                	jmp    f0103ec4 <env_free+0x24e>
+		panic("pa2page called with invalid pa");
+f0103f05:	83 ec 04             	sub    $0x4,%esp
+f0103f08:	68 00 8a 10 f0       	push   $0xf0108a00
+f0103f0d:	6a 53                	push   $0x53
+f0103f0f:	68 05 93 10 f0       	push   $0xf0109305
+f0103f14:	e8 39 c1 ff ff       	call   f0100052 <_panic>
+    pa = PADDR(e->env_pgdir);
+f0103f19:	8b 47 70             	mov    0x70(%edi),%eax
+	if ((uint32_t)kva < KERNBASE)
+f0103f1c:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0103f21:	0f 86 b7 00 00 00    	jbe    f0103fde <env_free+0x368>
+    e->env_pgdir = 0;
+f0103f27:	c7 47 70 00 00 00 00 	movl   $0x0,0x70(%edi)
+	return (physaddr_t)kva - KERNBASE;
+f0103f2e:	05 00 00 00 10       	add    $0x10000000,%eax
+	if (PGNUM(pa) >= npages)
+f0103f33:	c1 e8 0c             	shr    $0xc,%eax
+f0103f36:	3b 05 c8 76 66 f0    	cmp    0xf06676c8,%eax
+f0103f3c:	0f 83 b1 00 00 00    	jae    f0103ff3 <env_free+0x37d>
+    page_decref(pa2page(pa));
+f0103f42:	83 ec 0c             	sub    $0xc,%esp
+	return &pages[PGNUM(pa)];
+f0103f45:	8b 15 d0 76 66 f0    	mov    0xf06676d0,%edx
+f0103f4b:	8d 04 c2             	lea    (%edx,%eax,8),%eax
+f0103f4e:	50                   	push   %eax
+f0103f4f:	e8 15 d3 ff ff       	call   f0101269 <page_decref>
+    pa = PADDR(e->env_kern_pgdir);
+f0103f54:	8b 47 74             	mov    0x74(%edi),%eax
+	if ((uint32_t)kva < KERNBASE)
+f0103f57:	83 c4 10             	add    $0x10,%esp
+f0103f5a:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0103f5f:	0f 86 a2 00 00 00    	jbe    f0104007 <env_free+0x391>
+    e->env_kern_pgdir = 0;
+f0103f65:	c7 47 74 00 00 00 00 	movl   $0x0,0x74(%edi)
+	return (physaddr_t)kva - KERNBASE;
+f0103f6c:	05 00 00 00 10       	add    $0x10000000,%eax
+	if (PGNUM(pa) >= npages)
+f0103f71:	c1 e8 0c             	shr    $0xc,%eax
+f0103f74:	3b 05 c8 76 66 f0    	cmp    0xf06676c8,%eax
+f0103f7a:	0f 83 9c 00 00 00    	jae    f010401c <env_free+0x3a6>
+    page_decref(pa2page(pa));
+f0103f80:	83 ec 0c             	sub    $0xc,%esp
+	return &pages[PGNUM(pa)];
+f0103f83:	8b 15 d0 76 66 f0    	mov    0xf06676d0,%edx
+f0103f89:	8d 04 c2             	lea    (%edx,%eax,8),%eax
+f0103f8c:	50                   	push   %eax
+f0103f8d:	e8 d7 d2 ff ff       	call   f0101269 <page_decref>
+    spin_lock(&env_lock);
+f0103f92:	c7 04 24 a0 65 11 f0 	movl   $0xf01165a0,(%esp)
+f0103f99:	e8 4c 32 00 00       	call   f01071ea <spin_lock>
+    sched_remove(e);
+f0103f9e:	89 3c 24             	mov    %edi,(%esp)
+f0103fa1:	e8 80 11 00 00       	call   f0105126 <sched_remove>
+    e->env_status = ENV_FREE;
+f0103fa6:	c7 47 54 00 00 00 00 	movl   $0x0,0x54(%edi)
+    e->env_link = env_free_list;
+f0103fad:	a1 80 62 66 f0       	mov    0xf0666280,%eax
+f0103fb2:	89 47 44             	mov    %eax,0x44(%edi)
+    env_free_list = e;
+f0103fb5:	89 3d 80 62 66 f0    	mov    %edi,0xf0666280
+    spin_unlock(&env_lock);
+f0103fbb:	c7 04 24 a0 65 11 f0 	movl   $0xf01165a0,(%esp)
+f0103fc2:	e8 1b 33 00 00       	call   f01072e2 <spin_unlock>
+    spin_unlock(&vm_lock);
+f0103fc7:	c7 04 24 60 64 11 f0 	movl   $0xf0116460,(%esp)
+f0103fce:	e8 0f 33 00 00       	call   f01072e2 <spin_unlock>
+}
+f0103fd3:	83 c4 10             	add    $0x10,%esp
+f0103fd6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0103fd9:	5b                   	pop    %ebx
+f0103fda:	5e                   	pop    %esi
+f0103fdb:	5f                   	pop    %edi
+f0103fdc:	5d                   	pop    %ebp
+f0103fdd:	c3                   	ret
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0103fde:	50                   	push   %eax
+f0103fdf:	68 88 82 10 f0       	push   $0xf0108288
+f0103fe4:	68 45 02 00 00       	push   $0x245
+f0103fe9:	68 37 96 10 f0       	push   $0xf0109637
+f0103fee:	e8 5f c0 ff ff       	call   f0100052 <_panic>
+		panic("pa2page called with invalid pa");
+f0103ff3:	83 ec 04             	sub    $0x4,%esp
+f0103ff6:	68 00 8a 10 f0       	push   $0xf0108a00
+f0103ffb:	6a 53                	push   $0x53
+f0103ffd:	68 05 93 10 f0       	push   $0xf0109305
+f0104002:	e8 4b c0 ff ff       	call   f0100052 <_panic>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0104007:	50                   	push   %eax
+f0104008:	68 88 82 10 f0       	push   $0xf0108288
+f010400d:	68 49 02 00 00       	push   $0x249
+f0104012:	68 37 96 10 f0       	push   $0xf0109637
+f0104017:	e8 36 c0 ff ff       	call   f0100052 <_panic>
+		panic("pa2page called with invalid pa");
+f010401c:	83 ec 04             	sub    $0x4,%esp
+f010401f:	68 00 8a 10 f0       	push   $0xf0108a00
+f0104024:	6a 53                	push   $0x53
+f0104026:	68 05 93 10 f0       	push   $0xf0109305
+f010402b:	e8 22 c0 ff ff       	call   f0100052 <_panic>
+
+f0104030 <env_destroy>:
+env_destroy(struct Env *e) {
+f0104030:	55                   	push   %ebp
+f0104031:	89 e5                	mov    %esp,%ebp
+f0104033:	53                   	push   %ebx
+f0104034:	83 ec 10             	sub    $0x10,%esp
+f0104037:	8b 5d 08             	mov    0x8(%ebp),%ebx
+
+// Acquire the big kernel lock unless this CPU already holds it.
+static inline void
+lock_kernel_lazy(void)
+{
+	if (!spin_holding(&kernel_lock))
+f010403a:	68 e0 66 11 f0       	push   $0xf01166e0
+f010403f:	e8 58 31 00 00       	call   f010719c <spin_holding>
+f0104044:	83 c4 10             	add    $0x10,%esp
+f0104047:	85 c0                	test   %eax,%eax
+f0104049:	74 4e                	je     f0104099 <env_destroy+0x69>
+    spin_lock(&env_lock);
+f010404b:	83 ec 0c             	sub    $0xc,%esp
+f010404e:	68 a0 65 11 f0       	push   $0xf01165a0
+f0104053:	e8 92 31 00 00       	call   f01071ea <spin_lock>
+    if ((e->env_status == ENV_RUNNING || e->env_status == ENV_DYING)
+f0104058:	8b 43 54             	mov    0x54(%ebx),%eax
+f010405b:	83 e0 fd             	and    $0xfffffffd,%eax
+f010405e:	83 c4 10             	add    $0x10,%esp
+f0104061:	83 f8 01             	cmp    $0x1,%eax
+f0104064:	75 0b                	jne    f0104071 <env_destroy+0x41>
+f0104066:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+        && curenv != e) {
+f010406c:	39 58 0c             	cmp    %ebx,0xc(%eax)
+f010406f:	75 3a                	jne    f01040ab <env_destroy+0x7b>
+    spin_unlock(&env_lock);
+f0104071:	83 ec 0c             	sub    $0xc,%esp
+f0104074:	68 a0 65 11 f0       	push   $0xf01165a0
+f0104079:	e8 64 32 00 00       	call   f01072e2 <spin_unlock>
+    env_free(e);
+f010407e:	89 1c 24             	mov    %ebx,(%esp)
+f0104081:	e8 f0 fb ff ff       	call   f0103c76 <env_free>
+f0104086:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+    if (curenv == e) {
+f010408c:	83 c4 10             	add    $0x10,%esp
+f010408f:	39 58 0c             	cmp    %ebx,0xc(%eax)
+f0104092:	74 30                	je     f01040c4 <env_destroy+0x94>
+}
+f0104094:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0104097:	c9                   	leave
+f0104098:	c3                   	ret
+	spin_lock(&kernel_lock);
+f0104099:	83 ec 0c             	sub    $0xc,%esp
+f010409c:	68 e0 66 11 f0       	push   $0xf01166e0
+f01040a1:	e8 44 31 00 00       	call   f01071ea <spin_lock>
+}
+f01040a6:	83 c4 10             	add    $0x10,%esp
+f01040a9:	eb a0                	jmp    f010404b <env_destroy+0x1b>
+        e->env_status = ENV_DYING;
+f01040ab:	c7 43 54 01 00 00 00 	movl   $0x1,0x54(%ebx)
+        spin_unlock(&env_lock);
+f01040b2:	83 ec 0c             	sub    $0xc,%esp
+f01040b5:	68 a0 65 11 f0       	push   $0xf01165a0
+f01040ba:	e8 23 32 00 00       	call   f01072e2 <spin_unlock>
+        return;
+f01040bf:	83 c4 10             	add    $0x10,%esp
+f01040c2:	eb d0                	jmp    f0104094 <env_destroy+0x64>
+f01040c4:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+        curenv = NULL;
+f01040ca:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+        sched_yield();
+f01040d1:	e8 b5 11 00 00       	call   f010528b <sched_yield>
+
+f01040d6 <env_run>:
+//
+// This function does not return.
+//
+
+void
+env_run(struct Env *e) {
+f01040d6:	55                   	push   %ebp
+f01040d7:	89 e5                	mov    %esp,%ebp
+f01040d9:	53                   	push   %ebx
+f01040da:	83 ec 08             	sub    $0x8,%esp
+f01040dd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    return memcmp(&e->env_pgdir[PDX(ULIM)], kpti_pdes[e - envs],
+f01040e0:	68 08 01 00 00       	push   $0x108
+f01040e5:	89 d8                	mov    %ebx,%eax
+f01040e7:	2b 05 60 42 62 f0    	sub    0xf0624260,%eax
+f01040ed:	c1 f8 04             	sar    $0x4,%eax
+f01040f0:	69 c0 c8 aa aa aa    	imul   $0xaaaaaac8,%eax,%eax
+f01040f6:	05 80 42 62 f0       	add    $0xf0624280,%eax
+f01040fb:	50                   	push   %eax
+f01040fc:	8b 43 70             	mov    0x70(%ebx),%eax
+f01040ff:	05 f8 0e 00 00       	add    $0xef8,%eax
+f0104104:	50                   	push   %eax
+f0104105:	e8 9e 28 00 00       	call   f01069a8 <memcmp>
+    // done when the pgdir was built; only redo it if the kernel-half
+    // PDEs have changed since then.
+#ifdef DEBUG_KPTI
+    check_isolate(e);
+#else
+    if (!kpti_pde_same(e))
+f010410a:	83 c4 10             	add    $0x10,%esp
+f010410d:	85 c0                	test   %eax,%eax
+f010410f:	0f 85 8a 00 00 00    	jne    f010419f <env_run+0xc9>
+        check_isolate(e);
+    else
+        kpti_stats.fast_checks++;
+f0104115:	83 05 d8 76 66 f0 01 	addl   $0x1,0xf06676d8
+    //	e->env_tf.  Go back through the code you wrote above
+    //	and make sure you have set the relevant parts of
+    //	e->env_tf to sensible values.
+
+    // LAB 3: Your code here.
+    spin_lock(&env_lock);
+f010411c:	83 ec 0c             	sub    $0xc,%esp
+f010411f:	68 a0 65 11 f0       	push   $0xf01165a0
+f0104124:	e8 c1 30 00 00       	call   f01071ea <spin_lock>
+f0104129:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+    if (curenv != e) {
+f010412f:	83 c4 10             	add    $0x10,%esp
+f0104132:	39 58 0c             	cmp    %ebx,0xc(%eax)
+f0104135:	74 24                	je     f010415b <env_run+0x85>
+f0104137:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+        if (curenv && curenv->env_status == ENV_RUNNING) {
+f010413d:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+f0104141:	74 0f                	je     f0104152 <env_run+0x7c>
+f0104143:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0104149:	8b 40 0c             	mov    0xc(%eax),%eax
+f010414c:	83 78 54 03          	cmpl   $0x3,0x54(%eax)
+f0104150:	74 59                	je     f01041ab <env_run+0xd5>
+f0104152:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+            curenv->env_status = ENV_RUNNABLE;
+            sched_enqueue(curenv);
+        }
+        curenv = e;
+f0104158:	89 58 0c             	mov    %ebx,0xc(%eax)
+    }
+    sched_remove(e);
+f010415b:	83 ec 0c             	sub    $0xc,%esp
+f010415e:	53                   	push   %ebx
+f010415f:	e8 c2 0f 00 00       	call   f0105126 <sched_remove>
+    // A syscall that ran without the big kernel lock can return here
+    // after another CPU marked us ENV_DYING; trap() reaps us later.
+    if (e->env_status != ENV_DYING)
+f0104164:	83 c4 10             	add    $0x10,%esp
+f0104167:	83 7b 54 01          	cmpl   $0x1,0x54(%ebx)
+f010416b:	74 07                	je     f0104174 <env_run+0x9e>
+        e->env_status = ENV_RUNNING;
+f010416d:	c7 43 54 03 00 00 00 	movl   $0x3,0x54(%ebx)
+    spin_unlock(&env_lock);
+f0104174:	83 ec 0c             	sub    $0xc,%esp
+f0104177:	68 a0 65 11 f0       	push   $0xf01165a0
+f010417c:	e8 61 31 00 00       	call   f01072e2 <spin_unlock>
+    ++e->env_runs;
+f0104181:	83 43 58 01          	addl   $0x1,0x58(%ebx)
+
+    if (spin_holding(&kernel_lock))
+f0104185:	c7 04 24 e0 66 11 f0 	movl   $0xf01166e0,(%esp)
+f010418c:	e8 0b 30 00 00       	call   f010719c <spin_holding>
+f0104191:	83 c4 10             	add    $0x10,%esp
+f0104194:	85 c0                	test   %eax,%eax
+f0104196:	75 39                	jne    f01041d1 <env_run+0xfb>
+        unlock_kernel();
+    kpti_run(e);
+f0104198:	89 d8                	mov    %ebx,%eax
+f010419a:	e8 85 6e 00 00       	call   f010b024 <kpti_run>
+        check_isolate(e);
+f010419f:	89 d8                	mov    %ebx,%eax
+f01041a1:	e8 60 f1 ff ff       	call   f0103306 <check_isolate>
+f01041a6:	e9 71 ff ff ff       	jmp    f010411c <env_run+0x46>
+f01041ab:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+            curenv->env_status = ENV_RUNNABLE;
+f01041b1:	8b 40 0c             	mov    0xc(%eax),%eax
+f01041b4:	c7 40 54 02 00 00 00 	movl   $0x2,0x54(%eax)
+f01041bb:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+            sched_enqueue(curenv);
+f01041c1:	83 ec 0c             	sub    $0xc,%esp
+f01041c4:	ff 70 0c             	push   0xc(%eax)
+f01041c7:	e8 ae 0e 00 00       	call   f010507a <sched_enqueue>
+f01041cc:	83 c4 10             	add    $0x10,%esp
+f01041cf:	eb 81                	jmp    f0104152 <env_run+0x7c>
+	spin_unlock(&kernel_lock);
+f01041d1:	83 ec 0c             	sub    $0xc,%esp
+f01041d4:	68 e0 66 11 f0       	push   $0xf01166e0
+f01041d9:	e8 04 31 00 00       	call   f01072e2 <spin_unlock>
+	asm volatile("pause");
+f01041de:	f3 90                	pause
+}
+f01041e0:	83 c4 10             	add    $0x10,%esp
+f01041e3:	eb b3                	jmp    f0104198 <env_run+0xc2>
+
+f01041e5 <mc146818_read>:
+#include <kern/kclock.h>
+
+
+unsigned
+mc146818_read(unsigned reg)
+{
+f01041e5:	55                   	push   %ebp
+f01041e6:	89 e5                	mov    %esp,%ebp
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f01041e8:	8b 45 08             	mov    0x8(%ebp),%eax
+f01041eb:	ba 70 00 00 00       	mov    $0x70,%edx
+f01041f0:	ee                   	out    %al,(%dx)
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f01041f1:	ba 71 00 00 00       	mov    $0x71,%edx
+f01041f6:	ec                   	in     (%dx),%al
+	outb(IO_RTC, reg);
+	return inb(IO_RTC+1);
+f01041f7:	0f b6 c0             	movzbl %al,%eax
+}
+f01041fa:	5d                   	pop    %ebp
+f01041fb:	c3                   	ret
+
+f01041fc <mc146818_write>:
+
+void
+mc146818_write(unsigned reg, unsigned datum)
+{
+f01041fc:	55                   	push   %ebp
+f01041fd:	89 e5                	mov    %esp,%ebp
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f01041ff:	8b 45 08             	mov    0x8(%ebp),%eax
+f0104202:	ba 70 00 00 00       	mov    $0x70,%edx
+f0104207:	ee                   	out    %al,(%dx)
+f0104208:	8b 45 0c             	mov    0xc(%ebp),%eax
+f010420b:	ba 71 00 00 00       	mov    $0x71,%edx
+f0104210:	ee                   	out    %al,(%dx)
+	outb(IO_RTC, reg);
+	outb(IO_RTC+1, datum);
+}
+f0104211:	5d                   	pop    %ebp
+f0104212:	c3                   	ret
+
+f0104213 <irq_setmask_8259A>:
+		irq_setmask_8259A(irq_mask_8259A);
+}
+
+void
+irq_setmask_8259A(uint16_t mask)
+{
+f0104213:	55                   	push   %ebp
+f0104214:	89 e5                	mov    %esp,%ebp
+f0104216:	56                   	push   %esi
+f0104217:	53                   	push   %ebx
+f0104218:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	irq_mask_8259A = mask;
+f010421b:	66 89 0d 2c 66 11 f0 	mov    %cx,0xf011662c
+	if (!didinit)
+f0104222:	80 3d 84 62 66 f0 00 	cmpb   $0x0,0xf0666284
+f0104229:	75 07                	jne    f0104232 <irq_setmask_8259A+0x1f>
+	cprintf("enabled interrupts:");
+	for (i = 0; i < 16; i++)
+		if (~mask & (1<<i))
+			cprintf(" %d", i);
+	cprintf("\n");
+}
+f010422b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f010422e:	5b                   	pop    %ebx
+f010422f:	5e                   	pop    %esi
+f0104230:	5d                   	pop    %ebp
+f0104231:	c3                   	ret
+f0104232:	89 ce                	mov    %ecx,%esi
+f0104234:	ba 21 00 00 00       	mov    $0x21,%edx
+f0104239:	89 c8                	mov    %ecx,%eax
+f010423b:	ee                   	out    %al,(%dx)
+	outb(IO_PIC2+1, (char)(mask >> 8));
+f010423c:	89 c8                	mov    %ecx,%eax
+f010423e:	66 c1 e8 08          	shr    $0x8,%ax
+f0104242:	ba a1 00 00 00       	mov    $0xa1,%edx
+f0104247:	ee                   	out    %al,(%dx)
+	cprintf("enabled interrupts:");
+f0104248:	83 ec 0c             	sub    $0xc,%esp
+f010424b:	68 48 97 10 f0       	push   $0xf0109748
+f0104250:	e8 85 01 00 00       	call   f01043da <cprintf>
+f0104255:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < 16; i++)
+f0104258:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (~mask & (1<<i))
+f010425d:	0f b7 f6             	movzwl %si,%esi
+f0104260:	f7 d6                	not    %esi
+f0104262:	eb 08                	jmp    f010426c <irq_setmask_8259A+0x59>
+	for (i = 0; i < 16; i++)
+f0104264:	83 c3 01             	add    $0x1,%ebx
+f0104267:	83 fb 10             	cmp    $0x10,%ebx
+f010426a:	74 18                	je     f0104284 <irq_setmask_8259A+0x71>
+		if (~mask & (1<<i))
+f010426c:	0f a3 de             	bt     %ebx,%esi
+f010426f:	73 f3                	jae    f0104264 <irq_setmask_8259A+0x51>
+			cprintf(" %d", i);
+f0104271:	83 ec 08             	sub    $0x8,%esp
+f0104274:	53                   	push   %ebx
+f0104275:	68 1b 9d 10 f0       	push   $0xf0109d1b
+f010427a:	e8 5b 01 00 00       	call   f01043da <cprintf>
+f010427f:	83 c4 10             	add    $0x10,%esp
+f0104282:	eb e0                	jmp    f0104264 <irq_setmask_8259A+0x51>
+	cprintf("\n");
+f0104284:	83 ec 0c             	sub    $0xc,%esp
+f0104287:	68 9c 95 10 f0       	push   $0xf010959c
+f010428c:	e8 49 01 00 00       	call   f01043da <cprintf>
+f0104291:	83 c4 10             	add    $0x10,%esp
+f0104294:	eb 95                	jmp    f010422b <irq_setmask_8259A+0x18>
+
+f0104296 <pic_init>:
+{
+f0104296:	55                   	push   %ebp
+f0104297:	89 e5                	mov    %esp,%ebp
+f0104299:	57                   	push   %edi
+f010429a:	56                   	push   %esi
+f010429b:	53                   	push   %ebx
+f010429c:	83 ec 0c             	sub    $0xc,%esp
+	didinit = 1;
+f010429f:	c6 05 84 62 66 f0 01 	movb   $0x1,0xf0666284
+f01042a6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f01042ab:	bb 21 00 00 00       	mov    $0x21,%ebx
+f01042b0:	89 da                	mov    %ebx,%edx
+f01042b2:	ee                   	out    %al,(%dx)
+f01042b3:	b9 a1 00 00 00       	mov    $0xa1,%ecx
+f01042b8:	89 ca                	mov    %ecx,%edx
+f01042ba:	ee                   	out    %al,(%dx)
+f01042bb:	bf 11 00 00 00       	mov    $0x11,%edi
+f01042c0:	be 20 00 00 00       	mov    $0x20,%esi
+f01042c5:	89 f8                	mov    %edi,%eax
+f01042c7:	89 f2                	mov    %esi,%edx
+f01042c9:	ee                   	out    %al,(%dx)
+f01042ca:	b8 20 00 00 00       	mov    $0x20,%eax
+f01042cf:	89 da                	mov    %ebx,%edx
+f01042d1:	ee                   	out    %al,(%dx)
+f01042d2:	b8 04 00 00 00       	mov    $0x4,%eax
+f01042d7:	ee                   	out    %al,(%dx)
+f01042d8:	b8 03 00 00 00       	mov    $0x3,%eax
+f01042dd:	ee                   	out    %al,(%dx)
+f01042de:	bb a0 00 00 00       	mov    $0xa0,%ebx
+f01042e3:	89 f8                	mov    %edi,%eax
+f01042e5:	89 da                	mov    %ebx,%edx
+f01042e7:	ee                   	out    %al,(%dx)
+f01042e8:	b8 28 00 00 00       	mov    $0x28,%eax
+f01042ed:	89 ca                	mov    %ecx,%edx
+f01042ef:	ee                   	out    %al,(%dx)
+f01042f0:	b8 02 00 00 00       	mov    $0x2,%eax
+f01042f5:	ee                   	out    %al,(%dx)
+f01042f6:	b8 01 00 00 00       	mov    $0x1,%eax
+f01042fb:	ee                   	out    %al,(%dx)
+f01042fc:	bf 68 00 00 00       	mov    $0x68,%edi
+f0104301:	89 f8                	mov    %edi,%eax
+f0104303:	89 f2                	mov    %esi,%edx
+f0104305:	ee                   	out    %al,(%dx)
+f0104306:	b9 0a 00 00 00       	mov    $0xa,%ecx
+f010430b:	89 c8                	mov    %ecx,%eax
+f010430d:	ee                   	out    %al,(%dx)
+f010430e:	89 f8                	mov    %edi,%eax
+f0104310:	89 da                	mov    %ebx,%edx
+f0104312:	ee                   	out    %al,(%dx)
+f0104313:	89 c8                	mov    %ecx,%eax
+f0104315:	ee                   	out    %al,(%dx)
+	if (irq_mask_8259A != 0xFFFF)
+f0104316:	0f b7 05 2c 66 11 f0 	movzwl 0xf011662c,%eax
+f010431d:	66 83 f8 ff          	cmp    $0xffff,%ax
+f0104321:	75 08                	jne    f010432b <pic_init+0x95>
+}
+f0104323:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0104326:	5b                   	pop    %ebx
+f0104327:	5e                   	pop    %esi
+f0104328:	5f                   	pop    %edi
+f0104329:	5d                   	pop    %ebp
+f010432a:	c3                   	ret
+		irq_setmask_8259A(irq_mask_8259A);
+f010432b:	83 ec 0c             	sub    $0xc,%esp
+f010432e:	0f b7 c0             	movzwl %ax,%eax
+f0104331:	50                   	push   %eax
+f0104332:	e8 dc fe ff ff       	call   f0104213 <irq_setmask_8259A>
+f0104337:	83 c4 10             	add    $0x10,%esp
+}
+f010433a:	eb e7                	jmp    f0104323 <pic_init+0x8d>
+
+f010433c <irq_eoi>:
+f010433c:	b8 20 00 00 00       	mov    $0x20,%eax
+f0104341:	ba 20 00 00 00       	mov    $0x20,%edx
+f0104346:	ee                   	out    %al,(%dx)
+f0104347:	ba a0 00 00 00       	mov    $0xa0,%edx
+f010434c:	ee                   	out    %al,(%dx)
+	//   s: specific
+	//   e: end-of-interrupt
+	// xxx: specific interrupt line
+	outb(IO_PIC1, 0x20);
+	outb(IO_PIC2, 0x20);
+}
+f010434d:	c3                   	ret
+
+f010434e <putch>:
+#include <kern/spinlock.h>
+
+
+static void
+putch(int ch, int *cnt)
+{
+f010434e:	55                   	push   %ebp
+f010434f:	89 e5                	mov    %esp,%ebp
+f0104351:	83 ec 14             	sub    $0x14,%esp
+	cputchar(ch);
+f0104354:	ff 75 08             	push   0x8(%ebp)
+f0104357:	e8 94 c4 ff ff       	call   f01007f0 <cputchar>
+	*cnt++;
+}
+f010435c:	83 c4 10             	add    $0x10,%esp
+f010435f:	c9                   	leave
+f0104360:	c3                   	ret
+
+f0104361 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+f0104361:	55                   	push   %ebp
+f0104362:	89 e5                	mov    %esp,%ebp
+f0104364:	83 ec 18             	sub    $0x18,%esp
+	extern const char *panicstr;
+	int cnt = 0;
+f0104367:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	// A fault or assert while formatting panics and lands back here
+	// on the same CPU with cons_lock held, and once the kernel has
+	// panicked another CPU may never release it.  Print unlocked in
+	// either case rather than hang before the panic message is out.
+	locked = !panicstr && !spin_holding(&cons_lock);
+f010436e:	83 3d c0 76 66 f0 00 	cmpl   $0x0,0xf06676c0
+f0104375:	74 1c                	je     f0104393 <vcprintf+0x32>
+	if (locked)
+		spin_lock(&cons_lock);
+	vprintfmt((void*)putch, &cnt, fmt, ap);
+f0104377:	ff 75 0c             	push   0xc(%ebp)
+f010437a:	ff 75 08             	push   0x8(%ebp)
+f010437d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+f0104380:	50                   	push   %eax
+f0104381:	68 4e 43 10 f0       	push   $0xf010434e
+f0104386:	e8 6f 1e 00 00       	call   f01061fa <vprintfmt>
+f010438b:	83 c4 10             	add    $0x10,%esp
+	if (locked)
+		spin_unlock(&cons_lock);
+	return cnt;
+f010438e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+f0104391:	c9                   	leave
+f0104392:	c3                   	ret
+	locked = !panicstr && !spin_holding(&cons_lock);
+f0104393:	83 ec 0c             	sub    $0xc,%esp
+f0104396:	68 00 60 11 f0       	push   $0xf0116000
+f010439b:	e8 fc 2d 00 00       	call   f010719c <spin_holding>
+f01043a0:	83 c4 10             	add    $0x10,%esp
+f01043a3:	85 c0                	test   %eax,%eax
+f01043a5:	75 d0                	jne    f0104377 <vcprintf+0x16>
+		spin_lock(&cons_lock);
+f01043a7:	83 ec 0c             	sub    $0xc,%esp
+f01043aa:	68 00 60 11 f0       	push   $0xf0116000
+f01043af:	e8 36 2e 00 00       	call   f01071ea <spin_lock>
+	vprintfmt((void*)putch, &cnt, fmt, ap);
+f01043b4:	ff 75 0c             	push   0xc(%ebp)
+f01043b7:	ff 75 08             	push   0x8(%ebp)
+f01043ba:	8d 45 f4             	lea    -0xc(%ebp),%eax
+f01043bd:	50                   	push   %eax
+f01043be:	68 4e 43 10 f0       	push   $0xf010434e
+f01043c3:	e8 32 1e 00 00       	call   f01061fa <vprintfmt>
+		spin_unlock(&cons_lock);
+f01043c8:	83 c4 14             	add    $0x14,%esp
+f01043cb:	68 00 60 11 f0       	push   $0xf0116000
+f01043d0:	e8 0d 2f 00 00       	call   f01072e2 <spin_unlock>
+f01043d5:	83 c4 10             	add    $0x10,%esp
+f01043d8:	eb b4                	jmp    f010438e <vcprintf+0x2d>
+
+f01043da <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+f01043da:	55                   	push   %ebp
+f01043db:	89 e5                	mov    %esp,%ebp
+f01043dd:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+f01043e0:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+f01043e3:	50                   	push   %eax
+f01043e4:	ff 75 08             	push   0x8(%ebp)
+f01043e7:	e8 75 ff ff ff       	call   f0104361 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+f01043ec:	c9                   	leave
+f01043ed:	c3                   	ret
+
+f01043ee <reap_curenv>:
+f01043ee:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+
+// Free curenv if another CPU marked it ENV_DYING, and pick
+// something else to run.
+static void
+reap_curenv(void) {
+  if (curenv && curenv->env_status == ENV_DYING) {
+f01043f4:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+f01043f8:	74 0f                	je     f0104409 <reap_curenv+0x1b>
+f01043fa:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0104400:	8b 40 0c             	mov    0xc(%eax),%eax
+f0104403:	83 78 54 01          	cmpl   $0x1,0x54(%eax)
+f0104407:	74 01                	je     f010440a <reap_curenv+0x1c>
+f0104409:	c3                   	ret
+reap_curenv(void) {
+f010440a:	55                   	push   %ebp
+f010440b:	89 e5                	mov    %esp,%ebp
+f010440d:	83 ec 14             	sub    $0x14,%esp
+	if (!spin_holding(&kernel_lock))
+f0104410:	68 e0 66 11 f0       	push   $0xf01166e0
+f0104415:	e8 82 2d 00 00       	call   f010719c <spin_holding>
+f010441a:	83 c4 10             	add    $0x10,%esp
+f010441d:	85 c0                	test   %eax,%eax
+f010441f:	74 23                	je     f0104444 <reap_curenv+0x56>
+f0104421:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+    lock_kernel_lazy();
+    env_free(curenv);
+f0104427:	83 ec 0c             	sub    $0xc,%esp
+f010442a:	ff 70 0c             	push   0xc(%eax)
+f010442d:	e8 44 f8 ff ff       	call   f0103c76 <env_free>
+f0104432:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+    curenv = NULL;
+f0104438:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+    sched_yield();
+f010443f:	e8 47 0e 00 00       	call   f010528b <sched_yield>
+	spin_lock(&kernel_lock);
+f0104444:	83 ec 0c             	sub    $0xc,%esp
+f0104447:	68 e0 66 11 f0       	push   $0xf01166e0
+f010444c:	e8 99 2d 00 00       	call   f01071ea <spin_lock>
+}
+f0104451:	83 c4 10             	add    $0x10,%esp
+f0104454:	eb cb                	jmp    f0104421 <reap_curenv+0x33>
+
+f0104456 <trap_init_percpu>:
+trap_init_percpu(void) {
+f0104456:	55                   	push   %ebp
+f0104457:	89 e5                	mov    %esp,%ebp
+f0104459:	57                   	push   %edi
+f010445a:	56                   	push   %esi
+f010445b:	53                   	push   %ebx
+f010445c:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+  int i = thiscpu->cpu_id;
+f0104462:	0f b6 50 04          	movzbl 0x4(%eax),%edx
+f0104466:	0f b6 c2             	movzbl %dl,%eax
+f0104469:	65 8b 1d 00 00 00 00 	mov    %gs:0x0,%ebx
+  struct Taskstate *cpu_ts = &thiscpu->cpu_ts;
+f0104470:	8d 4b 10             	lea    0x10(%ebx),%ecx
+  cpu_ts->ts_esp0 = KSTACKTOP - i * (KSTKSIZE + KSTKGAP);
+f0104473:	89 c7                	mov    %eax,%edi
+f0104475:	c1 e7 10             	shl    $0x10,%edi
+f0104478:	be 00 00 00 f0       	mov    $0xf0000000,%esi
+f010447d:	29 fe                	sub    %edi,%esi
+f010447f:	89 73 14             	mov    %esi,0x14(%ebx)
+  cpu_ts->ts_ss0 = GD_KD;
+f0104482:	66 c7 43 18 10 00    	movw   $0x10,0x18(%ebx)
+  cpu_ts->ts_iomb = sizeof(struct Taskstate);
+f0104488:	66 c7 43 76 68 00    	movw   $0x68,0x76(%ebx)
+  gdt[(GD_TSS0 >> 3) + i] = SEG16(STS_T32A, (uint32_t) cpu_ts, sizeof(struct Taskstate), 0);
+f010448e:	83 c0 05             	add    $0x5,%eax
+f0104491:	66 c7 04 c5 20 40 11 	movw   $0x68,-0xfeebfe0(,%eax,8)
+f0104498:	f0 68 00 
+f010449b:	66 89 0c c5 22 40 11 	mov    %cx,-0xfeebfde(,%eax,8)
+f01044a2:	f0 
+f01044a3:	89 cb                	mov    %ecx,%ebx
+f01044a5:	c1 eb 10             	shr    $0x10,%ebx
+f01044a8:	88 1c c5 24 40 11 f0 	mov    %bl,-0xfeebfdc(,%eax,8)
+f01044af:	c6 04 c5 26 40 11 f0 	movb   $0x40,-0xfeebfda(,%eax,8)
+f01044b6:	40 
+f01044b7:	c1 e9 18             	shr    $0x18,%ecx
+f01044ba:	88 0c c5 27 40 11 f0 	mov    %cl,-0xfeebfd9(,%eax,8)
+  gdt[(GD_TSS0 >> 3) + i].sd_s = 0;
+f01044c1:	c6 04 c5 25 40 11 f0 	movb   $0x89,-0xfeebfdb(,%eax,8)
+f01044c8:	89 
+  ltr(GD_TSS0 + (i << 3));
+f01044c9:	0f b6 d2             	movzbl %dl,%edx
+f01044cc:	8d 14 d5 28 00 00 00 	lea    0x28(,%edx,8),%edx
+	asm volatile("ltr %0" : : "r" (sel));
+f01044d3:	0f 00 da             	ltr    %dx
+	asm volatile("lidt (%0)" : : "r" (p));
+f01044d6:	b8 e0 40 11 f0       	mov    $0xf01140e0,%eax
+f01044db:	0f 01 18             	lidtl  (%eax)
+}
+f01044de:	5b                   	pop    %ebx
+f01044df:	5e                   	pop    %esi
+f01044e0:	5f                   	pop    %edi
+f01044e1:	5d                   	pop    %ebp
+f01044e2:	c3                   	ret
+
+f01044e3 <trap_init>:
+trap_init(void) {
+f01044e3:	55                   	push   %ebp
+f01044e4:	89 e5                	mov    %esp,%ebp
+f01044e6:	83 ec 08             	sub    $0x8,%esp
+  SETGATE(idt[T_DIVIDE], 0, GD_KT, t_divide_handler, 0);
+f01044e9:	b8 dc b0 10 f0       	mov    $0xf010b0dc,%eax
+f01044ee:	66 a3 00 41 11 f0    	mov    %ax,0xf0114100
+f01044f4:	66 c7 05 02 41 11 f0 	movw   $0x8,0xf0114102
+f01044fb:	08 00 
+f01044fd:	c6 05 04 41 11 f0 00 	movb   $0x0,0xf0114104
+f0104504:	c6 05 05 41 11 f0 8e 	movb   $0x8e,0xf0114105
+f010450b:	c1 e8 10             	shr    $0x10,%eax
+f010450e:	66 a3 06 41 11 f0    	mov    %ax,0xf0114106
+  SETGATE(idt[T_DEBUG], 0, GD_KT, t_debug_handler, 0);
+f0104514:	b8 e6 b0 10 f0       	mov    $0xf010b0e6,%eax
+f0104519:	66 a3 08 41 11 f0    	mov    %ax,0xf0114108
+f010451f:	66 c7 05 0a 41 11 f0 	movw   $0x8,0xf011410a
+f0104526:	08 00 
+f0104528:	c6 05 0c 41 11 f0 00 	movb   $0x0,0xf011410c
+f010452f:	c6 05 0d 41 11 f0 8e 	movb   $0x8e,0xf011410d
+f0104536:	c1 e8 10             	shr    $0x10,%eax
+f0104539:	66 a3 0e 41 11 f0    	mov    %ax,0xf011410e
+  SETGATE(idt[T_NMI], 0, GD_KT, t_nmi_handler, 0);
+f010453f:	b8 f0 b0 10 f0       	mov    $0xf010b0f0,%eax
+f0104544:	66 a3 10 41 11 f0    	mov    %ax,0xf0114110
+f010454a:	66 c7 05 12 41 11 f0 	movw   $0x8,0xf0114112
+f0104551:	08 00 
+f0104553:	c6 05 14 41 11 f0 00 	movb   $0x0,0xf0114114
+f010455a:	c6 05 15 41 11 f0 8e 	movb   $0x8e,0xf0114115
+f0104561:	c1 e8 10             	shr    $0x10,%eax
+f0104564:	66 a3 16 41 11 f0    	mov    %ax,0xf0114116
+  SETGATE(idt[T_BRKPT], 0, GD_KT, t_brkpt_handler, 3);
+f010456a:	b8 fa b0 10 f0       	mov    $0xf010b0fa,%eax
+f010456f:	66 a3 18 41 11 f0    	mov    %ax,0xf0114118
+f0104575:	66 c7 05 1a 41 11 f0 	movw   $0x8,0xf011411a
+f010457c:	08 00 
+f010457e:	c6 05 1c 41 11 f0 00 	movb   $0x0,0xf011411c
+f0104585:	c6 05 1d 41 11 f0 ee 	movb   $0xee,0xf011411d
+f010458c:	c1 e8 10             	shr    $0x10,%eax
+f010458f:	66 a3 1e 41 11 f0    	mov    %ax,0xf011411e
+  SETGATE(idt[T_OFLOW], 0, GD_KT, t_oflow_handler, 3);
+f0104595:	b8 04 b1 10 f0       	mov    $0xf010b104,%eax
+f010459a:	66 a3 20 41 11 f0    	mov    %ax,0xf0114120
+f01045a0:	66 c7 05 22 41 11 f0 	movw   $0x8,0xf0114122
+f01045a7:	08 00 
+f01045a9:	c6 05 24 41 11 f0 00 	movb   $0x0,0xf0114124
+f01045b0:	c6 05 25 41 11 f0 ee 	movb   $0xee,0xf0114125
+f01045b7:	c1 e8 10             	shr    $0x10,%eax
+f01045ba:	66 a3 26 41 11 f0    	mov    %ax,0xf0114126
+  SETGATE(idt[T_BOUND], 0, GD_KT, t_bound_handler, 3);
+f01045c0:	b8 0e b1 10 f0       	mov    $0xf010b10e,%eax
+f01045c5:	66 a3 28 41 11 f0    	mov    %ax,0xf0114128
+f01045cb:	66 c7 05 2a 41 11 f0 	movw   $0x8,0xf011412a
+f01045d2:	08 00 
+f01045d4:	c6 05 2c 41 11 f0 00 	movb   $0x0,0xf011412c
+f01045db:	c6 05 2d 41 11 f0 ee 	movb   $0xee,0xf011412d
+f01045e2:	c1 e8 10             	shr    $0x10,%eax
+f01045e5:	66 a3 2e 41 11 f0    	mov    %ax,0xf011412e
+  SETGATE(idt[T_ILLOP], 0, GD_KT, t_illop_handler, 0);
+f01045eb:	b8 18 b1 10 f0       	mov    $0xf010b118,%eax
+f01045f0:	66 a3 30 41 11 f0    	mov    %ax,0xf0114130
+f01045f6:	66 c7 05 32 41 11 f0 	movw   $0x8,0xf0114132
+f01045fd:	08 00 
+f01045ff:	c6 05 34 41 11 f0 00 	movb   $0x0,0xf0114134
+f0104606:	c6 05 35 41 11 f0 8e 	movb   $0x8e,0xf0114135
+f010460d:	c1 e8 10             	shr    $0x10,%eax
+f0104610:	66 a3 36 41 11 f0    	mov    %ax,0xf0114136
+  SETGATE(idt[T_DEVICE], 0, GD_KT, t_device_handler, 0);
+f0104616:	b8 22 b1 10 f0       	mov    $0xf010b122,%eax
+f010461b:	66 a3 38 41 11 f0    	mov    %ax,0xf0114138
+f0104621:	66 c7 05 3a 41 11 f0 	movw   $0x8,0xf011413a
+f0104628:	08 00 
+f010462a:	c6 05 3c 41 11 f0 00 	movb   $0x0,0xf011413c
+f0104631:	c6 05 3d 41 11 f0 8e 	movb   $0x8e,0xf011413d
+f0104638:	c1 e8 10             	shr    $0x10,%eax
+f010463b:	66 a3 3e 41 11 f0    	mov    %ax,0xf011413e
+  SETGATE(idt[T_DBLFLT], 0, GD_KT, t_dblflt_handler, 0);
+f0104641:	b8 2c b1 10 f0       	mov    $0xf010b12c,%eax
+f0104646:	66 a3 40 41 11 f0    	mov    %ax,0xf0114140
+f010464c:	66 c7 05 42 41 11 f0 	movw   $0x8,0xf0114142
+f0104653:	08 00 
+f0104655:	c6 05 44 41 11 f0 00 	movb   $0x0,0xf0114144
+f010465c:	c6 05 45 41 11 f0 8e 	movb   $0x8e,0xf0114145
+f0104663:	c1 e8 10             	shr    $0x10,%eax
+f0104666:	66 a3 46 41 11 f0    	mov    %ax,0xf0114146
+  SETGATE(idt[T_TSS], 0, GD_KT, t_tss_handler, 0);
+f010466c:	b8 34 b1 10 f0       	mov    $0xf010b134,%eax
+f0104671:	66 a3 50 41 11 f0    	mov    %ax,0xf0114150
+f0104677:	66 c7 05 52 41 11 f0 	movw   $0x8,0xf0114152
+f010467e:	08 00 
+f0104680:	c6 05 54 41 11 f0 00 	movb   $0x0,0xf0114154
+f0104687:	c6 05 55 41 11 f0 8e 	movb   $0x8e,0xf0114155
+f010468e:	c1 e8 10             	shr    $0x10,%eax
+f0104691:	66 a3 56 41 11 f0    	mov    %ax,0xf0114156
+  SETGATE(idt[T_SEGNP], 0, GD_KT, t_segnp_handler, 0);
+f0104697:	b8 3c b1 10 f0       	mov    $0xf010b13c,%eax
+f010469c:	66 a3 58 41 11 f0    	mov    %ax,0xf0114158
+f01046a2:	66 c7 05 5a 41 11 f0 	movw   $0x8,0xf011415a
+f01046a9:	08 00 
+f01046ab:	c6 05 5c 41 11 f0 00 	movb   $0x0,0xf011415c
+f01046b2:	c6 05 5d 41 11 f0 8e 	movb   $0x8e,0xf011415d
+f01046b9:	c1 e8 10             	shr    $0x10,%eax
+f01046bc:	66 a3 5e 41 11 f0    	mov    %ax,0xf011415e
+  SETGATE(idt[T_STACK], 0, GD_KT, t_stack_handler, 0);
+f01046c2:	b8 44 b1 10 f0       	mov    $0xf010b144,%eax
+f01046c7:	66 a3 60 41 11 f0    	mov    %ax,0xf0114160
+f01046cd:	66 c7 05 62 41 11 f0 	movw   $0x8,0xf0114162
+f01046d4:	08 00 
+f01046d6:	c6 05 64 41 11 f0 00 	movb   $0x0,0xf0114164
+f01046dd:	c6 05 65 41 11 f0 8e 	movb   $0x8e,0xf0114165
+f01046e4:	c1 e8 10             	shr    $0x10,%eax
+f01046e7:	66 a3 66 41 11 f0    	mov    %ax,0xf0114166
+  SETGATE(idt[T_GPFLT], 0, GD_KT, t_gpflt_handler, 0);
+f01046ed:	b8 4c b1 10 f0       	mov    $0xf010b14c,%eax
+f01046f2:	66 a3 68 41 11 f0    	mov    %ax,0xf0114168
+f01046f8:	66 c7 05 6a 41 11 f0 	movw   $0x8,0xf011416a
+f01046ff:	08 00 
+f0104701:	c6 05 6c 41 11 f0 00 	movb   $0x0,0xf011416c
+f0104708:	c6 05 6d 41 11 f0 8e 	movb   $0x8e,0xf011416d
+f010470f:	c1 e8 10             	shr    $0x10,%eax
+f0104712:	66 a3 6e 41 11 f0    	mov    %ax,0xf011416e
+  SETGATE(idt[T_PGFLT], 0, GD_KT, t_pgflt_handler, 0);
+f0104718:	b8 54 b1 10 f0       	mov    $0xf010b154,%eax
+f010471d:	66 a3 70 41 11 f0    	mov    %ax,0xf0114170
+f0104723:	66 c7 05 72 41 11 f0 	movw   $0x8,0xf0114172
+f010472a:	08 00 
+f010472c:	c6 05 74 41 11 f0 00 	movb   $0x0,0xf0114174
+f0104733:	c6 05 75 41 11 f0 8e 	movb   $0x8e,0xf0114175
+f010473a:	c1 e8 10             	shr    $0x10,%eax
+f010473d:	66 a3 76 41 11 f0    	mov    %ax,0xf0114176
+  SETGATE(idt[T_FPERR], 0, GD_KT, t_fperr_handler, 0);
+f0104743:	b8 58 b1 10 f0       	mov    $0xf010b158,%eax
+f0104748:	66 a3 80 41 11 f0    	mov    %ax,0xf0114180
+f010474e:	66 c7 05 82 41 11 f0 	movw   $0x8,0xf0114182
+f0104755:	08 00 
+f0104757:	c6 05 84 41 11 f0 00 	movb   $0x0,0xf0114184
+f010475e:	c6 05 85 41 11 f0 8e 	movb   $0x8e,0xf0114185
+f0104765:	c1 e8 10             	shr    $0x10,%eax
+f0104768:	66 a3 86 41 11 f0    	mov    %ax,0xf0114186
+  SETGATE(idt[T_ALIGN], 0, GD_KT, t_align_handler, 0);
+f010476e:	b8 5e b1 10 f0       	mov    $0xf010b15e,%eax
+f0104773:	66 a3 88 41 11 f0    	mov    %ax,0xf0114188
+f0104779:	66 c7 05 8a 41 11 f0 	movw   $0x8,0xf011418a
+f0104780:	08 00 
+f0104782:	c6 05 8c 41 11 f0 00 	movb   $0x0,0xf011418c
+f0104789:	c6 05 8d 41 11 f0 8e 	movb   $0x8e,0xf011418d
+f0104790:	c1 e8 10             	shr    $0x10,%eax
+f0104793:	66 a3 8e 41 11 f0    	mov    %ax,0xf011418e
+  SETGATE(idt[T_MCHK], 0, GD_KT, t_mchk_handler, 0);
+f0104799:	b8 62 b1 10 f0       	mov    $0xf010b162,%eax
+f010479e:	66 a3 90 41 11 f0    	mov    %ax,0xf0114190
+f01047a4:	66 c7 05 92 41 11 f0 	movw   $0x8,0xf0114192
+f01047ab:	08 00 
+f01047ad:	c6 05 94 41 11 f0 00 	movb   $0x0,0xf0114194
+f01047b4:	c6 05 95 41 11 f0 8e 	movb   $0x8e,0xf0114195
+f01047bb:	c1 e8 10             	shr    $0x10,%eax
+f01047be:	66 a3 96 41 11 f0    	mov    %ax,0xf0114196
+  SETGATE(idt[T_SIMDERR], 0, GD_KT, t_simderr_handler, 0);
+f01047c4:	b8 68 b1 10 f0       	mov    $0xf010b168,%eax
+f01047c9:	66 a3 98 41 11 f0    	mov    %ax,0xf0114198
+f01047cf:	66 c7 05 9a 41 11 f0 	movw   $0x8,0xf011419a
+f01047d6:	08 00 
+f01047d8:	c6 05 9c 41 11 f0 00 	movb   $0x0,0xf011419c
+f01047df:	c6 05 9d 41 11 f0 8e 	movb   $0x8e,0xf011419d
+f01047e6:	c1 e8 10             	shr    $0x10,%eax
+f01047e9:	66 a3 9e 41 11 f0    	mov    %ax,0xf011419e
+  SETGATE(idt[IRQ_OFFSET + IRQ_TIMER], 0, GD_KT, irq_timer_handler, 0);
+f01047ef:	b8 74 b1 10 f0       	mov    $0xf010b174,%eax
+f01047f4:	66 a3 00 42 11 f0    	mov    %ax,0xf0114200
+f01047fa:	66 c7 05 02 42 11 f0 	movw   $0x8,0xf0114202
+f0104801:	08 00 
+f0104803:	c6 05 04 42 11 f0 00 	movb   $0x0,0xf0114204
+f010480a:	c6 05 05 42 11 f0 8e 	movb   $0x8e,0xf0114205
+f0104811:	c1 e8 10             	shr    $0x10,%eax
+f0104814:	66 a3 06 42 11 f0    	mov    %ax,0xf0114206
+  SETGATE(idt[IRQ_OFFSET + IRQ_KBD], 0, GD_KT, irq_kbd_handler, 0);
+f010481a:	b8 7a b1 10 f0       	mov    $0xf010b17a,%eax
+f010481f:	66 a3 08 42 11 f0    	mov    %ax,0xf0114208
+f0104825:	66 c7 05 0a 42 11 f0 	movw   $0x8,0xf011420a
+f010482c:	08 00 
+f010482e:	c6 05 0c 42 11 f0 00 	movb   $0x0,0xf011420c
+f0104835:	c6 05 0d 42 11 f0 8e 	movb   $0x8e,0xf011420d
+f010483c:	c1 e8 10             	shr    $0x10,%eax
+f010483f:	66 a3 0e 42 11 f0    	mov    %ax,0xf011420e
+  SETGATE(idt[IRQ_OFFSET + 2], 0, GD_KT, irq_2_handler, 0);
+f0104845:	b8 80 b1 10 f0       	mov    $0xf010b180,%eax
+f010484a:	66 a3 10 42 11 f0    	mov    %ax,0xf0114210
+f0104850:	66 c7 05 12 42 11 f0 	movw   $0x8,0xf0114212
+f0104857:	08 00 
+f0104859:	c6 05 14 42 11 f0 00 	movb   $0x0,0xf0114214
+f0104860:	c6 05 15 42 11 f0 8e 	movb   $0x8e,0xf0114215
+f0104867:	c1 e8 10             	shr    $0x10,%eax
+f010486a:	66 a3 16 42 11 f0    	mov    %ax,0xf0114216
+  SETGATE(idt[IRQ_OFFSET + 3], 0, GD_KT, irq_3_handler, 0);
+f0104870:	b8 86 b1 10 f0       	mov    $0xf010b186,%eax
+f0104875:	66 a3 18 42 11 f0    	mov    %ax,0xf0114218
+f010487b:	66 c7 05 1a 42 11 f0 	movw   $0x8,0xf011421a
+f0104882:	08 00 
+f0104884:	c6 05 1c 42 11 f0 00 	movb   $0x0,0xf011421c
+f010488b:	c6 05 1d 42 11 f0 8e 	movb   $0x8e,0xf011421d
+f0104892:	c1 e8 10             	shr    $0x10,%eax
+f0104895:	66 a3 1e 42 11 f0    	mov    %ax,0xf011421e
+  SETGATE(idt[IRQ_OFFSET + IRQ_SERIAL], 0, GD_KT, irq_serial_handler, 0);
+f010489b:	b8 8c b1 10 f0       	mov    $0xf010b18c,%eax
+f01048a0:	66 a3 20 42 11 f0    	mov    %ax,0xf0114220
+f01048a6:	66 c7 05 22 42 11 f0 	movw   $0x8,0xf0114222
+f01048ad:	08 00 
+f01048af:	c6 05 24 42 11 f0 00 	movb   $0x0,0xf0114224
+f01048b6:	c6 05 25 42 11 f0 8e 	movb   $0x8e,0xf0114225
+f01048bd:	c1 e8 10             	shr    $0x10,%eax
+f01048c0:	66 a3 26 42 11 f0    	mov    %ax,0xf0114226
+  SETGATE(idt[IRQ_OFFSET + 5], 0, GD_KT, irq_5_handler, 0);
+f01048c6:	b8 92 b1 10 f0       	mov    $0xf010b192,%eax
+f01048cb:	66 a3 28 42 11 f0    	mov    %ax,0xf0114228
+f01048d1:	66 c7 05 2a 42 11 f0 	movw   $0x8,0xf011422a
+f01048d8:	08 00 
+f01048da:	c6 05 2c 42 11 f0 00 	movb   $0x0,0xf011422c
+f01048e1:	c6 05 2d 42 11 f0 8e 	movb   $0x8e,0xf011422d
+f01048e8:	c1 e8 10             	shr    $0x10,%eax
+f01048eb:	66 a3 2e 42 11 f0    	mov    %ax,0xf011422e
+  SETGATE(idt[IRQ_OFFSET + 6], 0, GD_KT, irq_6_handler, 0);
+f01048f1:	b8 98 b1 10 f0       	mov    $0xf010b198,%eax
+f01048f6:	66 a3 30 42 11 f0    	mov    %ax,0xf0114230
+f01048fc:	66 c7 05 32 42 11 f0 	movw   $0x8,0xf0114232
+f0104903:	08 00 
+f0104905:	c6 05 34 42 11 f0 00 	movb   $0x0,0xf0114234
+f010490c:	c6 05 35 42 11 f0 8e 	movb   $0x8e,0xf0114235
+f0104913:	c1 e8 10             	shr    $0x10,%eax
+f0104916:	66 a3 36 42 11 f0    	mov    %ax,0xf0114236
+  SETGATE(idt[IRQ_OFFSET + IRQ_SPURIOUS], 0, GD_KT, irq_spurious_handler, 0);
+f010491c:	b8 9e b1 10 f0       	mov    $0xf010b19e,%eax
+f0104921:	66 a3 38 42 11 f0    	mov    %ax,0xf0114238
+f0104927:	66 c7 05 3a 42 11 f0 	movw   $0x8,0xf011423a
+f010492e:	08 00 
+f0104930:	c6 05 3c 42 11 f0 00 	movb   $0x0,0xf011423c
+f0104937:	c6 05 3d 42 11 f0 8e 	movb   $0x8e,0xf011423d
+f010493e:	c1 e8 10             	shr    $0x10,%eax
+f0104941:	66 a3 3e 42 11 f0    	mov    %ax,0xf011423e
+  SETGATE(idt[IRQ_OFFSET + 8], 0, GD_KT, irq_8_handler, 0);
+f0104947:	b8 a4 b1 10 f0       	mov    $0xf010b1a4,%eax
+f010494c:	66 a3 40 42 11 f0    	mov    %ax,0xf0114240
+f0104952:	66 c7 05 42 42 11 f0 	movw   $0x8,0xf0114242
+f0104959:	08 00 
+f010495b:	c6 05 44 42 11 f0 00 	movb   $0x0,0xf0114244
+f0104962:	c6 05 45 42 11 f0 8e 	movb   $0x8e,0xf0114245
+f0104969:	c1 e8 10             	shr    $0x10,%eax
+f010496c:	66 a3 46 42 11 f0    	mov    %ax,0xf0114246
+  SETGATE(idt[IRQ_OFFSET + 9], 0, GD_KT, irq_9_handler, 0);
+f0104972:	b8 aa b1 10 f0       	mov    $0xf010b1aa,%eax
+f0104977:	66 a3 48 42 11 f0    	mov    %ax,0xf0114248
+f010497d:	66 c7 05 4a 42 11 f0 	movw   $0x8,0xf011424a
+f0104984:	08 00 
+f0104986:	c6 05 4c 42 11 f0 00 	movb   $0x0,0xf011424c
+f010498d:	c6 05 4d 42 11 f0 8e 	movb   $0x8e,0xf011424d
+f0104994:	c1 e8 10             	shr    $0x10,%eax
+f0104997:	66 a3 4e 42 11 f0    	mov    %ax,0xf011424e
+  SETGATE(idt[IRQ_OFFSET + 10], 0, GD_KT, irq_10_handler, 0);
+f010499d:	b8 b0 b1 10 f0       	mov    $0xf010b1b0,%eax
+f01049a2:	66 a3 50 42 11 f0    	mov    %ax,0xf0114250
+f01049a8:	66 c7 05 52 42 11 f0 	movw   $0x8,0xf0114252
+f01049af:	08 00 
+f01049b1:	c6 05 54 42 11 f0 00 	movb   $0x0,0xf0114254
+f01049b8:	c6 05 55 42 11 f0 8e 	movb   $0x8e,0xf0114255
+f01049bf:	c1 e8 10             	shr    $0x10,%eax
+f01049c2:	66 a3 56 42 11 f0    	mov    %ax,0xf0114256
+  SETGATE(idt[IRQ_OFFSET + 11], 0, GD_KT, irq_11_handler, 0);
+f01049c8:	b8 b6 b1 10 f0       	mov    $0xf010b1b6,%eax
+f01049cd:	66 a3 58 42 11 f0    	mov    %ax,0xf0114258
+f01049d3:	66 c7 05 5a 42 11 f0 	movw   $0x8,0xf011425a
+f01049da:	08 00 
+f01049dc:	c6 05 5c 42 11 f0 00 	movb   $0x0,0xf011425c
+f01049e3:	c6 05 5d 42 11 f0 8e 	movb   $0x8e,0xf011425d
+f01049ea:	c1 e8 10             	shr    $0x10,%eax
+f01049ed:	66 a3 5e 42 11 f0    	mov    %ax,0xf011425e
+  SETGATE(idt[IRQ_OFFSET + 12], 0, GD_KT, irq_12_handler, 0);
+f01049f3:	b8 bc b1 10 f0       	mov    $0xf010b1bc,%eax
+f01049f8:	66 a3 60 42 11 f0    	mov    %ax,0xf0114260
+f01049fe:	66 c7 05 62 42 11 f0 	movw   $0x8,0xf0114262
+f0104a05:	08 00 
+f0104a07:	c6 05 64 42 11 f0 00 	movb   $0x0,0xf0114264
+f0104a0e:	c6 05 65 42 11 f0 8e 	movb   $0x8e,0xf0114265
+f0104a15:	c1 e8 10             	shr    $0x10,%eax
+f0104a18:	66 a3 66 42 11 f0    	mov    %ax,0xf0114266
+  SETGATE(idt[IRQ_OFFSET + 13], 0, GD_KT, irq_13_handler, 0);
+f0104a1e:	b8 c2 b1 10 f0       	mov    $0xf010b1c2,%eax
+f0104a23:	66 a3 68 42 11 f0    	mov    %ax,0xf0114268
+f0104a29:	66 c7 05 6a 42 11 f0 	movw   $0x8,0xf011426a
+f0104a30:	08 00 
+f0104a32:	c6 05 6c 42 11 f0 00 	movb   $0x0,0xf011426c
+f0104a39:	c6 05 6d 42 11 f0 8e 	movb   $0x8e,0xf011426d
+f0104a40:	c1 e8 10             	shr    $0x10,%eax
+f0104a43:	66 a3 6e 42 11 f0    	mov    %ax,0xf011426e
+  SETGATE(idt[IRQ_OFFSET + IRQ_IDE], 0, GD_KT, irq_ide_handler, 0);
+f0104a49:	b8 c8 b1 10 f0       	mov    $0xf010b1c8,%eax
+f0104a4e:	66 a3 70 42 11 f0    	mov    %ax,0xf0114270
+f0104a54:	66 c7 05 72 42 11 f0 	movw   $0x8,0xf0114272
+f0104a5b:	08 00 
+f0104a5d:	c6 05 74 42 11 f0 00 	movb   $0x0,0xf0114274
+f0104a64:	c6 05 75 42 11 f0 8e 	movb   $0x8e,0xf0114275
+f0104a6b:	c1 e8 10             	shr    $0x10,%eax
+f0104a6e:	66 a3 76 42 11 f0    	mov    %ax,0xf0114276
+  SETGATE(idt[IRQ_OFFSET + 15], 0, GD_KT, irq_15_handler, 0);
+f0104a74:	b8 ce b1 10 f0       	mov    $0xf010b1ce,%eax
+f0104a79:	66 a3 78 42 11 f0    	mov    %ax,0xf0114278
+f0104a7f:	66 c7 05 7a 42 11 f0 	movw   $0x8,0xf011427a
+f0104a86:	08 00 
+f0104a88:	c6 05 7c 42 11 f0 00 	movb   $0x0,0xf011427c
+f0104a8f:	c6 05 7d 42 11 f0 8e 	movb   $0x8e,0xf011427d
+f0104a96:	c1 e8 10             	shr    $0x10,%eax
+f0104a99:	66 a3 7e 42 11 f0    	mov    %ax,0xf011427e
+  SETGATE(idt[T_SYSCALL], 0, GD_KT, t_syscall_handler, 3);
+f0104a9f:	b8 6e b1 10 f0       	mov    $0xf010b16e,%eax
+f0104aa4:	66 a3 80 42 11 f0    	mov    %ax,0xf0114280
+f0104aaa:	66 c7 05 82 42 11 f0 	movw   $0x8,0xf0114282
+f0104ab1:	08 00 
+f0104ab3:	c6 05 84 42 11 f0 00 	movb   $0x0,0xf0114284
+f0104aba:	c6 05 85 42 11 f0 ee 	movb   $0xee,0xf0114285
+f0104ac1:	c1 e8 10             	shr    $0x10,%eax
+f0104ac4:	66 a3 86 42 11 f0    	mov    %ax,0xf0114286
+  trap_init_percpu();
+f0104aca:	e8 87 f9 ff ff       	call   f0104456 <trap_init_percpu>
+}
+f0104acf:	c9                   	leave
+f0104ad0:	c3                   	ret
+
+f0104ad1 <print_regs>:
+print_regs(struct PushRegs *regs) {
+f0104ad1:	55                   	push   %ebp
+f0104ad2:	89 e5                	mov    %esp,%ebp
+f0104ad4:	53                   	push   %ebx
+f0104ad5:	83 ec 0c             	sub    $0xc,%esp
+f0104ad8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  cprintf("  edi  0x%08x\n", regs->reg_edi);
+f0104adb:	ff 33                	push   (%ebx)
+f0104add:	68 5c 97 10 f0       	push   $0xf010975c
+f0104ae2:	e8 f3 f8 ff ff       	call   f01043da <cprintf>
+  cprintf("  esi  0x%08x\n", regs->reg_esi);
+f0104ae7:	83 c4 08             	add    $0x8,%esp
+f0104aea:	ff 73 04             	push   0x4(%ebx)
+f0104aed:	68 6b 97 10 f0       	push   $0xf010976b
+f0104af2:	e8 e3 f8 ff ff       	call   f01043da <cprintf>
+  cprintf("  ebp  0x%08x\n", regs->reg_ebp);
+f0104af7:	83 c4 08             	add    $0x8,%esp
+f0104afa:	ff 73 08             	push   0x8(%ebx)
+f0104afd:	68 7a 97 10 f0       	push   $0xf010977a
+f0104b02:	e8 d3 f8 ff ff       	call   f01043da <cprintf>
+  cprintf("  oesp 0x%08x\n", regs->reg_oesp);
+f0104b07:	83 c4 08             	add    $0x8,%esp
+f0104b0a:	ff 73 0c             	push   0xc(%ebx)
+f0104b0d:	68 89 97 10 f0       	push   $0xf0109789
+f0104b12:	e8 c3 f8 ff ff       	call   f01043da <cprintf>
+  cprintf("  ebx  0x%08x\n", regs->reg_ebx);
+f0104b17:	83 c4 08             	add    $0x8,%esp
+f0104b1a:	ff 73 10             	push   0x10(%ebx)
+f0104b1d:	68 98 97 10 f0       	push   $0xf0109798
+f0104b22:	e8 b3 f8 ff ff       	call   f01043da <cprintf>
+  cprintf("  edx  0x%08x\n", regs->reg_edx);
+f0104b27:	83 c4 08             	add    $0x8,%esp
+f0104b2a:	ff 73 14             	push   0x14(%ebx)
+f0104b2d:	68 a7 97 10 f0       	push   $0xf01097a7
+f0104b32:	e8 a3 f8 ff ff       	call   f01043da <cprintf>
+  cprintf("  ecx  0x%08x\n", regs->reg_ecx);
+f0104b37:	83 c4 08             	add    $0x8,%esp
+f0104b3a:	ff 73 18             	push   0x18(%ebx)
+f0104b3d:	68 b6 97 10 f0       	push   $0xf01097b6
+f0104b42:	e8 93 f8 ff ff       	call   f01043da <cprintf>
+  cprintf("  eax  0x%08x\n", regs->reg_eax);
+f0104b47:	83 c4 08             	add    $0x8,%esp
+f0104b4a:	ff 73 1c             	push   0x1c(%ebx)
+f0104b4d:	68 c5 97 10 f0       	push   $0xf01097c5
+f0104b52:	e8 83 f8 ff ff       	call   f01043da <cprintf>
+}
+f0104b57:	83 c4 10             	add    $0x10,%esp
+f0104b5a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0104b5d:	c9                   	leave
+f0104b5e:	c3                   	ret
+
+f0104b5f <print_trapframe>:
+print_trapframe(struct Trapframe *tf) {
+f0104b5f:	55                   	push   %ebp
+f0104b60:	89 e5                	mov    %esp,%ebp
+f0104b62:	56                   	push   %esi
+f0104b63:	53                   	push   %ebx
+f0104b64:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  cprintf("TRAP frame at %p from CPU %d\n", tf, cpunum());
+f0104b67:	e8 ac 24 00 00       	call   f0107018 <cpunum>
+f0104b6c:	83 ec 04             	sub    $0x4,%esp
+f0104b6f:	50                   	push   %eax
+f0104b70:	53                   	push   %ebx
+f0104b71:	68 29 98 10 f0       	push   $0xf0109829
+f0104b76:	e8 5f f8 ff ff       	call   f01043da <cprintf>
+  print_regs(&tf->tf_regs);
+f0104b7b:	89 1c 24             	mov    %ebx,(%esp)
+f0104b7e:	e8 4e ff ff ff       	call   f0104ad1 <print_regs>
+  cprintf("  es   0x----%04x\n", tf->tf_es);
+f0104b83:	83 c4 08             	add    $0x8,%esp
+f0104b86:	0f b7 43 20          	movzwl 0x20(%ebx),%eax
+f0104b8a:	50                   	push   %eax
+f0104b8b:	68 47 98 10 f0       	push   $0xf0109847
+f0104b90:	e8 45 f8 ff ff       	call   f01043da <cprintf>
+  cprintf("  ds   0x----%04x\n", tf->tf_ds);
+f0104b95:	83 c4 08             	add    $0x8,%esp
+f0104b98:	0f b7 43 24          	movzwl 0x24(%ebx),%eax
+f0104b9c:	50                   	push   %eax
+f0104b9d:	68 5a 98 10 f0       	push   $0xf010985a
+f0104ba2:	e8 33 f8 ff ff       	call   f01043da <cprintf>
+  cprintf("  trap 0x%08x %s\n", tf->tf_trapno, trapname(tf->tf_trapno));
+f0104ba7:	8b 43 28             	mov    0x28(%ebx),%eax
+  if (trapno < ARRAY_SIZE(excnames))
+f0104baa:	83 c4 10             	add    $0x10,%esp
+f0104bad:	83 f8 13             	cmp    $0x13,%eax
+f0104bb0:	0f 86 da 00 00 00    	jbe    f0104c90 <print_trapframe+0x131>
+    return "System call";
+f0104bb6:	ba d4 97 10 f0       	mov    $0xf01097d4,%edx
+  if (trapno == T_SYSCALL)
+f0104bbb:	83 f8 30             	cmp    $0x30,%eax
+f0104bbe:	74 13                	je     f0104bd3 <print_trapframe+0x74>
+  if (trapno >= IRQ_OFFSET && trapno < IRQ_OFFSET + 16)
+f0104bc0:	8d 50 e0             	lea    -0x20(%eax),%edx
+  return "(unknown trap)";
+f0104bc3:	83 fa 10             	cmp    $0x10,%edx
+f0104bc6:	ba ef 97 10 f0       	mov    $0xf01097ef,%edx
+f0104bcb:	b9 e0 97 10 f0       	mov    $0xf01097e0,%ecx
+f0104bd0:	0f 43 d1             	cmovae %ecx,%edx
+  cprintf("  trap 0x%08x %s\n", tf->tf_trapno, trapname(tf->tf_trapno));
+f0104bd3:	83 ec 04             	sub    $0x4,%esp
+f0104bd6:	52                   	push   %edx
+f0104bd7:	50                   	push   %eax
+f0104bd8:	68 6d 98 10 f0       	push   $0xf010986d
+f0104bdd:	e8 f8 f7 ff ff       	call   f01043da <cprintf>
+  if (tf == last_tf && tf->tf_trapno == T_PGFLT)
+f0104be2:	83 c4 10             	add    $0x10,%esp
+f0104be5:	39 1d 88 62 66 f0    	cmp    %ebx,0xf0666288
+f0104beb:	0f 84 ab 00 00 00    	je     f0104c9c <print_trapframe+0x13d>
+  cprintf("  err  0x%08x", tf->tf_err);
+f0104bf1:	83 ec 08             	sub    $0x8,%esp
+f0104bf4:	ff 73 2c             	push   0x2c(%ebx)
+f0104bf7:	68 8e 98 10 f0       	push   $0xf010988e
+f0104bfc:	e8 d9 f7 ff ff       	call   f01043da <cprintf>
+  if (tf->tf_trapno == T_PGFLT)
+f0104c01:	83 c4 10             	add    $0x10,%esp
+f0104c04:	83 7b 28 0e          	cmpl   $0xe,0x28(%ebx)
+f0104c08:	0f 85 b1 00 00 00    	jne    f0104cbf <print_trapframe+0x160>
+            tf->tf_err & 1 ? "protection" : "not-present");
+f0104c0e:	8b 43 2c             	mov    0x2c(%ebx),%eax
+    cprintf(" [%s, %s, %s]\n",
+f0104c11:	a8 01                	test   $0x1,%al
+f0104c13:	b9 0d 98 10 f0       	mov    $0xf010980d,%ecx
+f0104c18:	ba 02 98 10 f0       	mov    $0xf0109802,%edx
+f0104c1d:	0f 45 ca             	cmovne %edx,%ecx
+f0104c20:	a8 02                	test   $0x2,%al
+f0104c22:	ba 1f 98 10 f0       	mov    $0xf010981f,%edx
+f0104c27:	be 19 98 10 f0       	mov    $0xf0109819,%esi
+f0104c2c:	0f 45 d6             	cmovne %esi,%edx
+f0104c2f:	a8 04                	test   $0x4,%al
+f0104c31:	b8 59 99 10 f0       	mov    $0xf0109959,%eax
+f0104c36:	be 24 98 10 f0       	mov    $0xf0109824,%esi
+f0104c3b:	0f 45 c6             	cmovne %esi,%eax
+f0104c3e:	51                   	push   %ecx
+f0104c3f:	52                   	push   %edx
+f0104c40:	50                   	push   %eax
+f0104c41:	68 9c 98 10 f0       	push   $0xf010989c
+f0104c46:	e8 8f f7 ff ff       	call   f01043da <cprintf>
+f0104c4b:	83 c4 10             	add    $0x10,%esp
+  cprintf("  eip  0x%08x\n", tf->tf_eip);
+f0104c4e:	83 ec 08             	sub    $0x8,%esp
+f0104c51:	ff 73 30             	push   0x30(%ebx)
+f0104c54:	68 ab 98 10 f0       	push   $0xf01098ab
+f0104c59:	e8 7c f7 ff ff       	call   f01043da <cprintf>
+  cprintf("  cs   0x----%04x\n", tf->tf_cs);
+f0104c5e:	83 c4 08             	add    $0x8,%esp
+f0104c61:	0f b7 43 34          	movzwl 0x34(%ebx),%eax
+f0104c65:	50                   	push   %eax
+f0104c66:	68 ba 98 10 f0       	push   $0xf01098ba
+f0104c6b:	e8 6a f7 ff ff       	call   f01043da <cprintf>
+  cprintf("  flag 0x%08x\n", tf->tf_eflags);
+f0104c70:	83 c4 08             	add    $0x8,%esp
+f0104c73:	ff 73 38             	push   0x38(%ebx)
+f0104c76:	68 cd 98 10 f0       	push   $0xf01098cd
+f0104c7b:	e8 5a f7 ff ff       	call   f01043da <cprintf>
+  if ((tf->tf_cs & 3) != 0) {
+f0104c80:	83 c4 10             	add    $0x10,%esp
+f0104c83:	f6 43 34 03          	testb  $0x3,0x34(%ebx)
+f0104c87:	75 4b                	jne    f0104cd4 <print_trapframe+0x175>
+}
+f0104c89:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0104c8c:	5b                   	pop    %ebx
+f0104c8d:	5e                   	pop    %esi
+f0104c8e:	5d                   	pop    %ebp
+f0104c8f:	c3                   	ret
+    return excnames[trapno];
+f0104c90:	8b 14 85 c0 9b 10 f0 	mov    -0xfef6440(,%eax,4),%edx
+f0104c97:	e9 37 ff ff ff       	jmp    f0104bd3 <print_trapframe+0x74>
+  if (tf == last_tf && tf->tf_trapno == T_PGFLT)
+f0104c9c:	83 7b 28 0e          	cmpl   $0xe,0x28(%ebx)
+f0104ca0:	0f 85 4b ff ff ff    	jne    f0104bf1 <print_trapframe+0x92>
+	asm volatile("movl %%cr2,%0" : "=r" (val));
+f0104ca6:	0f 20 d0             	mov    %cr2,%eax
+    cprintf("  cr2  0x%08x\n", rcr2());
+f0104ca9:	83 ec 08             	sub    $0x8,%esp
+f0104cac:	50                   	push   %eax
+f0104cad:	68 7f 98 10 f0       	push   $0xf010987f
+f0104cb2:	e8 23 f7 ff ff       	call   f01043da <cprintf>
+f0104cb7:	83 c4 10             	add    $0x10,%esp
+f0104cba:	e9 32 ff ff ff       	jmp    f0104bf1 <print_trapframe+0x92>
+    cprintf("\n");
+f0104cbf:	83 ec 0c             	sub    $0xc,%esp
+f0104cc2:	68 9c 95 10 f0       	push   $0xf010959c
+f0104cc7:	e8 0e f7 ff ff       	call   f01043da <cprintf>
+f0104ccc:	83 c4 10             	add    $0x10,%esp
+f0104ccf:	e9 7a ff ff ff       	jmp    f0104c4e <print_trapframe+0xef>
+    cprintf("  esp  0x%08x\n", tf->tf_esp);
+f0104cd4:	83 ec 08             	sub    $0x8,%esp
+f0104cd7:	ff 73 3c             	push   0x3c(%ebx)
+f0104cda:	68 dc 98 10 f0       	push   $0xf01098dc
+f0104cdf:	e8 f6 f6 ff ff       	call   f01043da <cprintf>
+    cprintf("  ss   0x----%04x\n", tf->tf_ss);
+f0104ce4:	83 c4 08             	add    $0x8,%esp
+f0104ce7:	0f b7 43 40          	movzwl 0x40(%ebx),%eax
+f0104ceb:	50                   	push   %eax
+f0104cec:	68 eb 98 10 f0       	push   $0xf01098eb
+f0104cf1:	e8 e4 f6 ff ff       	call   f01043da <cprintf>
+f0104cf6:	83 c4 10             	add    $0x10,%esp
+}
+f0104cf9:	eb 8e                	jmp    f0104c89 <print_trapframe+0x12a>
+
+f0104cfb <page_fault_handler>:
+    sched_yield();
+}
+
+
+void
+page_fault_handler(struct Trapframe *tf) {
+f0104cfb:	55                   	push   %ebp
+f0104cfc:	89 e5                	mov    %esp,%ebp
+f0104cfe:	57                   	push   %edi
+f0104cff:	56                   	push   %esi
+f0104d00:	53                   	push   %ebx
+f0104d01:	83 ec 0c             	sub    $0xc,%esp
+f0104d04:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f0104d07:	0f 20 d6             	mov    %cr2,%esi
+
+  // Read processor's CR2 register to find the faulting address
+  fault_va = rcr2();
+
+  // Handle kernel-mode page faults.
+  if (!(tf->tf_cs & 0x3))
+f0104d0a:	f6 43 34 03          	testb  $0x3,0x34(%ebx)
+f0104d0e:	74 4d                	je     f0104d5d <page_fault_handler+0x62>
+f0104d10:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+  //   To change what the user environment runs, modify 'curenv->env_tf'
+  //   (the 'tf' variable points at 'curenv->env_tf').
+
+  // LAB 4: Your code here.
+
+  if (curenv->env_pgfault_upcall) {
+f0104d16:	8b 40 0c             	mov    0xc(%eax),%eax
+f0104d19:	83 78 78 00          	cmpl   $0x0,0x78(%eax)
+f0104d1d:	75 55                	jne    f0104d74 <page_fault_handler+0x79>
+f0104d1f:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+    curenv->env_tf.tf_esp = (uintptr_t) utf;
+    env_run(curenv);
+
+  }
+  // Destroy the environment that caused the fault.
+  cprintf("[%08x] user fault va %08x ip %08x\n",
+f0104d25:	ff 73 30             	push   0x30(%ebx)
+f0104d28:	56                   	push   %esi
+f0104d29:	8b 40 0c             	mov    0xc(%eax),%eax
+f0104d2c:	ff 70 48             	push   0x48(%eax)
+f0104d2f:	68 d4 9a 10 f0       	push   $0xf0109ad4
+f0104d34:	e8 a1 f6 ff ff       	call   f01043da <cprintf>
+          curenv->env_id, fault_va, tf->tf_eip);
+  print_trapframe(tf);
+f0104d39:	89 1c 24             	mov    %ebx,(%esp)
+f0104d3c:	e8 1e fe ff ff       	call   f0104b5f <print_trapframe>
+f0104d41:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+  env_destroy(curenv);
+f0104d47:	83 c4 04             	add    $0x4,%esp
+f0104d4a:	ff 70 0c             	push   0xc(%eax)
+f0104d4d:	e8 de f2 ff ff       	call   f0104030 <env_destroy>
+
+}
+f0104d52:	83 c4 10             	add    $0x10,%esp
+f0104d55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0104d58:	5b                   	pop    %ebx
+f0104d59:	5e                   	pop    %esi
+f0104d5a:	5f                   	pop    %edi
+f0104d5b:	5d                   	pop    %ebp
+f0104d5c:	c3                   	ret
+    panic("trap.c page_fault_handler: kernel page fault");
+f0104d5d:	83 ec 04             	sub    $0x4,%esp
+f0104d60:	68 a4 9a 10 f0       	push   $0xf0109aa4
+f0104d65:	68 91 01 00 00       	push   $0x191
+f0104d6a:	68 fe 98 10 f0       	push   $0xf01098fe
+f0104d6f:	e8 de b2 ff ff       	call   f0100052 <_panic>
+        ((tf->tf_esp >= UXSTACKTOP - PGSIZE && tf->tf_esp <= UXSTACKTOP - 1 ?
+f0104d74:	8b 43 3c             	mov    0x3c(%ebx),%eax
+f0104d77:	8d 90 00 10 40 11    	lea    0x11401000(%eax),%edx
+    struct UTrapframe *utf = (struct UTrapframe *)
+f0104d7d:	bf cc ff bf ee       	mov    $0xeebfffcc,%edi
+f0104d82:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+f0104d88:	77 05                	ja     f0104d8f <page_fault_handler+0x94>
+          tf->tf_esp - 4 : UXSTACKTOP) -
+f0104d8a:	83 e8 38             	sub    $0x38,%eax
+f0104d8d:	89 c7                	mov    %eax,%edi
+f0104d8f:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+    user_mem_assert(curenv, (void *) utf, sizeof(struct UTrapframe), PTE_U | PTE_W | PTE_P);
+f0104d95:	6a 07                	push   $0x7
+f0104d97:	6a 34                	push   $0x34
+f0104d99:	57                   	push   %edi
+f0104d9a:	ff 70 0c             	push   0xc(%eax)
+f0104d9d:	e8 9c e4 ff ff       	call   f010323e <user_mem_assert>
+    utf->utf_fault_va = fault_va;
+f0104da2:	89 fa                	mov    %edi,%edx
+f0104da4:	89 37                	mov    %esi,(%edi)
+    utf->utf_err = tf->tf_err;
+f0104da6:	8b 43 2c             	mov    0x2c(%ebx),%eax
+f0104da9:	89 47 04             	mov    %eax,0x4(%edi)
+    utf->utf_regs = tf->tf_regs;
+f0104dac:	8d 7f 08             	lea    0x8(%edi),%edi
+f0104daf:	b9 08 00 00 00       	mov    $0x8,%ecx
+f0104db4:	89 de                	mov    %ebx,%esi
+f0104db6:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    utf->utf_eip = tf->tf_eip;
+f0104db8:	8b 43 30             	mov    0x30(%ebx),%eax
+f0104dbb:	89 d1                	mov    %edx,%ecx
+f0104dbd:	89 42 28             	mov    %eax,0x28(%edx)
+    utf->utf_eflags = tf->tf_eflags;
+f0104dc0:	8b 43 38             	mov    0x38(%ebx),%eax
+f0104dc3:	89 42 2c             	mov    %eax,0x2c(%edx)
+    utf->utf_esp = tf->tf_esp;
+f0104dc6:	8b 43 3c             	mov    0x3c(%ebx),%eax
+f0104dc9:	89 42 30             	mov    %eax,0x30(%edx)
+f0104dcc:	65 8b 15 00 00 00 00 	mov    %gs:0x0,%edx
+f0104dd3:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+    curenv->env_tf.tf_eip = (uintptr_t) curenv->env_pgfault_upcall;
+f0104dd9:	8b 40 0c             	mov    0xc(%eax),%eax
+f0104ddc:	8b 52 0c             	mov    0xc(%edx),%edx
+f0104ddf:	8b 52 78             	mov    0x78(%edx),%edx
+f0104de2:	89 50 30             	mov    %edx,0x30(%eax)
+f0104de5:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+    curenv->env_tf.tf_esp = (uintptr_t) utf;
+f0104deb:	8b 40 0c             	mov    0xc(%eax),%eax
+f0104dee:	89 48 3c             	mov    %ecx,0x3c(%eax)
+f0104df1:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+    env_run(curenv);
+f0104df7:	83 c4 04             	add    $0x4,%esp
+f0104dfa:	ff 70 0c             	push   0xc(%eax)
+f0104dfd:	e8 d4 f2 ff ff       	call   f01040d6 <env_run>
+
+f0104e02 <trap>:
+trap(struct Trapframe *tf) {
+f0104e02:	55                   	push   %ebp
+f0104e03:	89 e5                	mov    %esp,%ebp
+f0104e05:	57                   	push   %edi
+f0104e06:	56                   	push   %esi
+f0104e07:	8b 75 08             	mov    0x8(%ebp),%esi
+  asm volatile("cld":: : "cc");
+f0104e0a:	fc                   	cld
+  if (panicstr)
+f0104e0b:	83 3d c0 76 66 f0 00 	cmpl   $0x0,0xf06676c0
+f0104e12:	74 01                	je     f0104e15 <trap+0x13>
+      asm volatile("hlt");
+f0104e14:	f4                   	hlt
+f0104e15:	65 8b 15 00 00 00 00 	mov    %gs:0x0,%edx
+	asm volatile("lock; xchgl %0, %1"
+f0104e1c:	b8 01 00 00 00       	mov    $0x1,%eax
+f0104e21:	f0 87 42 08          	lock xchg %eax,0x8(%edx)
+  if (xchg(&thiscpu->cpu_status, CPU_STARTED) == CPU_HALTED)
+f0104e25:	83 f8 02             	cmp    $0x2,%eax
+f0104e28:	74 7e                	je     f0104ea8 <trap+0xa6>
+	asm volatile("pushfl; popl %0" : "=r" (eflags));
+f0104e2a:	9c                   	pushf
+f0104e2b:	58                   	pop    %eax
+  assert(!(read_eflags() & FL_IF));
+f0104e2c:	f6 c4 02             	test   $0x2,%ah
+f0104e2f:	0f 85 88 00 00 00    	jne    f0104ebd <trap+0xbb>
+  if ((tf->tf_cs & 3) == 3) {
+f0104e35:	0f b7 46 34          	movzwl 0x34(%esi),%eax
+f0104e39:	83 e0 03             	and    $0x3,%eax
+f0104e3c:	66 83 f8 03          	cmp    $0x3,%ax
+f0104e40:	75 4a                	jne    f0104e8c <trap+0x8a>
+f0104e42:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+    assert(curenv);
+f0104e48:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+f0104e4c:	0f 84 84 00 00 00    	je     f0104ed6 <trap+0xd4>
+    if (tf->tf_trapno != T_SYSCALL || !syscall_nolock(tf->tf_regs.reg_eax))
+f0104e52:	83 7e 28 30          	cmpl   $0x30,0x28(%esi)
+f0104e56:	0f 84 93 00 00 00    	je     f0104eef <trap+0xed>
+	spin_lock(&kernel_lock);
+f0104e5c:	83 ec 0c             	sub    $0xc,%esp
+f0104e5f:	68 e0 66 11 f0       	push   $0xf01166e0
+f0104e64:	e8 81 23 00 00       	call   f01071ea <spin_lock>
+}
+f0104e69:	83 c4 10             	add    $0x10,%esp
+    reap_curenv();
+f0104e6c:	e8 7d f5 ff ff       	call   f01043ee <reap_curenv>
+f0104e71:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+    curenv->env_tf = *tf;
+f0104e77:	8b 40 0c             	mov    0xc(%eax),%eax
+f0104e7a:	b9 11 00 00 00       	mov    $0x11,%ecx
+f0104e7f:	89 c7                	mov    %eax,%edi
+f0104e81:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+f0104e83:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+    tf = &curenv->env_tf;
+f0104e89:	8b 70 0c             	mov    0xc(%eax),%esi
+  last_tf = tf;
+f0104e8c:	89 35 88 62 66 f0    	mov    %esi,0xf0666288
+  switch (tf->tf_trapno) {
+f0104e92:	8b 46 28             	mov    0x28(%esi),%eax
+f0104e95:	83 e8 03             	sub    $0x3,%eax
+f0104e98:	83 f8 2d             	cmp    $0x2d,%eax
+f0104e9b:	0f 87 0d 01 00 00    	ja     f0104fae <trap+0x1ac>
+f0104ea1:	ff 24 85 00 9b 10 f0 	jmp    *-0xfef6500(,%eax,4)
+	spin_lock(&kernel_lock);
+f0104ea8:	83 ec 0c             	sub    $0xc,%esp
+f0104eab:	68 e0 66 11 f0       	push   $0xf01166e0
+f0104eb0:	e8 35 23 00 00       	call   f01071ea <spin_lock>
+}
+f0104eb5:	83 c4 10             	add    $0x10,%esp
+f0104eb8:	e9 6d ff ff ff       	jmp    f0104e2a <trap+0x28>
+  assert(!(read_eflags() & FL_IF));
+f0104ebd:	68 0a 99 10 f0       	push   $0xf010990a
+f0104ec2:	68 1f 93 10 f0       	push   $0xf010931f
+f0104ec7:	68 5c 01 00 00       	push   $0x15c
+f0104ecc:	68 fe 98 10 f0       	push   $0xf01098fe
+f0104ed1:	e8 7c b1 ff ff       	call   f0100052 <_panic>
+    assert(curenv);
+f0104ed6:	68 23 99 10 f0       	push   $0xf0109923
+f0104edb:	68 1f 93 10 f0       	push   $0xf010931f
+f0104ee0:	68 64 01 00 00       	push   $0x164
+f0104ee5:	68 fe 98 10 f0       	push   $0xf01098fe
+f0104eea:	e8 63 b1 ff ff       	call   f0100052 <_panic>
+    if (tf->tf_trapno != T_SYSCALL || !syscall_nolock(tf->tf_regs.reg_eax))
+f0104eef:	83 ec 0c             	sub    $0xc,%esp
+f0104ef2:	ff 76 1c             	push   0x1c(%esi)
+f0104ef5:	e8 2d 05 00 00       	call   f0105427 <syscall_nolock>
+f0104efa:	83 c4 10             	add    $0x10,%esp
+f0104efd:	84 c0                	test   %al,%al
+f0104eff:	0f 85 67 ff ff ff    	jne    f0104e6c <trap+0x6a>
+f0104f05:	e9 52 ff ff ff       	jmp    f0104e5c <trap+0x5a>
+      monitor(tf);
+f0104f0a:	83 ec 0c             	sub    $0xc,%esp
+f0104f0d:	56                   	push   %esi
+f0104f0e:	e8 82 bb ff ff       	call   f0100a95 <monitor>
+      return;
+f0104f13:	83 c4 10             	add    $0x10,%esp
+  reap_curenv();
+f0104f16:	e8 d3 f4 ff ff       	call   f01043ee <reap_curenv>
+f0104f1b:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+  if (curenv && curenv->env_status == ENV_RUNNING)
+f0104f21:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+f0104f25:	74 13                	je     f0104f3a <trap+0x138>
+f0104f27:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f0104f2d:	8b 40 0c             	mov    0xc(%eax),%eax
+f0104f30:	83 78 54 03          	cmpl   $0x3,0x54(%eax)
+f0104f34:	0f 84 b7 00 00 00    	je     f0104ff1 <trap+0x1ef>
+    sched_yield();
+f0104f3a:	e8 4c 03 00 00       	call   f010528b <sched_yield>
+      page_fault_handler(tf);
+f0104f3f:	83 ec 0c             	sub    $0xc,%esp
+f0104f42:	56                   	push   %esi
+f0104f43:	e8 b3 fd ff ff       	call   f0104cfb <page_fault_handler>
+      return;
+f0104f48:	83 c4 10             	add    $0x10,%esp
+f0104f4b:	eb c9                	jmp    f0104f16 <trap+0x114>
+      r->reg_eax = syscall(r->reg_eax, r->reg_edx, r->reg_ecx, r->reg_ebx, r->reg_edi, r->reg_esi);
+f0104f4d:	83 ec 08             	sub    $0x8,%esp
+f0104f50:	ff 76 04             	push   0x4(%esi)
+f0104f53:	ff 36                	push   (%esi)
+f0104f55:	ff 76 10             	push   0x10(%esi)
+f0104f58:	ff 76 18             	push   0x18(%esi)
+f0104f5b:	ff 76 14             	push   0x14(%esi)
+f0104f5e:	ff 76 1c             	push   0x1c(%esi)
+f0104f61:	e8 e0 04 00 00       	call   f0105446 <syscall>
+f0104f66:	89 46 1c             	mov    %eax,0x1c(%esi)
+      return;
+f0104f69:	83 c4 20             	add    $0x20,%esp
+f0104f6c:	eb a8                	jmp    f0104f16 <trap+0x114>
+      time_tick();
+f0104f6e:	e8 dc 2d 00 00       	call   f0107d4f <time_tick>
+      lapic_eoi();
+f0104f73:	e8 b6 20 00 00       	call   f010702e <lapic_eoi>
+      sched_yield();
+f0104f78:	e8 0e 03 00 00       	call   f010528b <sched_yield>
+      cprintf("Spurious interrupt on irq 7\n");
+f0104f7d:	83 ec 0c             	sub    $0xc,%esp
+f0104f80:	68 2a 99 10 f0       	push   $0xf010992a
+f0104f85:	e8 50 f4 ff ff       	call   f01043da <cprintf>
+      print_trapframe(tf);
+f0104f8a:	89 34 24             	mov    %esi,(%esp)
+f0104f8d:	e8 cd fb ff ff       	call   f0104b5f <print_trapframe>
+      return;
+f0104f92:	83 c4 10             	add    $0x10,%esp
+f0104f95:	e9 7c ff ff ff       	jmp    f0104f16 <trap+0x114>
+      kbd_intr();
+f0104f9a:	e8 9c b6 ff ff       	call   f010063b <kbd_intr>
+      return;
+f0104f9f:	e9 72 ff ff ff       	jmp    f0104f16 <trap+0x114>
+      serial_intr();
+f0104fa4:	e8 76 b6 ff ff       	call   f010061f <serial_intr>
+      return;
+f0104fa9:	e9 68 ff ff ff       	jmp    f0104f16 <trap+0x114>
+  print_trapframe(tf);
+f0104fae:	83 ec 0c             	sub    $0xc,%esp
+f0104fb1:	56                   	push   %esi
+f0104fb2:	e8 a8 fb ff ff       	call   f0104b5f <print_trapframe>
+  if (tf->tf_cs == GD_KT)
+f0104fb7:	83 c4 10             	add    $0x10,%esp
+f0104fba:	66 83 7e 34 08       	cmpw   $0x8,0x34(%esi)
+f0104fbf:	74 19                	je     f0104fda <trap+0x1d8>
+f0104fc1:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+    env_destroy(curenv);
+f0104fc7:	83 ec 0c             	sub    $0xc,%esp
+f0104fca:	ff 70 0c             	push   0xc(%eax)
+f0104fcd:	e8 5e f0 ff ff       	call   f0104030 <env_destroy>
+    return;
+f0104fd2:	83 c4 10             	add    $0x10,%esp
+f0104fd5:	e9 3c ff ff ff       	jmp    f0104f16 <trap+0x114>
+    panic("unhandled trap in kernel");
+f0104fda:	83 ec 04             	sub    $0x4,%esp
+f0104fdd:	68 47 99 10 f0       	push   $0xf0109947
+f0104fe2:	68 37 01 00 00       	push   $0x137
+f0104fe7:	68 fe 98 10 f0       	push   $0xf01098fe
+f0104fec:	e8 61 b0 ff ff       	call   f0100052 <_panic>
+f0104ff1:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+    env_run(curenv);
+f0104ff7:	83 ec 0c             	sub    $0xc,%esp
+f0104ffa:	ff 70 0c             	push   0xc(%eax)
+f0104ffd:	e8 d4 f0 ff ff       	call   f01040d6 <env_run>
+
+f0105002 <runq_pop>:
+}
+
+// Remove and return the env at the head of c's ready queue,
+// or NULL if the queue is empty.
+static struct Env *
+runq_pop(struct CpuInfo *c) {
+f0105002:	89 c2                	mov    %eax,%edx
+  struct Env *e = c->cpu_runq_head;
+f0105004:	8b 40 78             	mov    0x78(%eax),%eax
+
+  if (e) {
+f0105007:	85 c0                	test   %eax,%eax
+f0105009:	74 6e                	je     f0105079 <runq_pop+0x77>
+runq_pop(struct CpuInfo *c) {
+f010500b:	55                   	push   %ebp
+f010500c:	89 e5                	mov    %esp,%ebp
+f010500e:	53                   	push   %ebx
+f010500f:	83 ec 04             	sub    $0x4,%esp
+  if (e->env_rq_prev)
+f0105012:	8b 48 64             	mov    0x64(%eax),%ecx
+f0105015:	85 c9                	test   %ecx,%ecx
+f0105017:	74 3a                	je     f0105053 <runq_pop+0x51>
+    e->env_rq_prev->env_rq_next = e->env_rq_next;
+f0105019:	8b 58 60             	mov    0x60(%eax),%ebx
+f010501c:	89 59 60             	mov    %ebx,0x60(%ecx)
+  if (e->env_rq_next)
+f010501f:	8b 48 60             	mov    0x60(%eax),%ecx
+f0105022:	85 c9                	test   %ecx,%ecx
+f0105024:	74 35                	je     f010505b <runq_pop+0x59>
+    e->env_rq_next->env_rq_prev = e->env_rq_prev;
+f0105026:	8b 58 64             	mov    0x64(%eax),%ebx
+f0105029:	89 59 64             	mov    %ebx,0x64(%ecx)
+  e->env_rq_next = e->env_rq_prev = NULL;
+f010502c:	c7 40 64 00 00 00 00 	movl   $0x0,0x64(%eax)
+f0105033:	c7 40 60 00 00 00 00 	movl   $0x0,0x60(%eax)
+  e->env_rq_cpu = -1;
+f010503a:	c7 40 68 ff ff ff ff 	movl   $0xffffffff,0x68(%eax)
+  c->cpu_runq_len--;
+f0105041:	83 aa 80 00 00 00 01 	subl   $0x1,0x80(%edx)
+    runq_unlink(c, e);
+    assert(e->env_status == ENV_RUNNABLE);
+f0105048:	83 78 54 02          	cmpl   $0x2,0x54(%eax)
+f010504c:	75 15                	jne    f0105063 <runq_pop+0x61>
+  }
+  return e;
+}
+f010504e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0105051:	c9                   	leave
+f0105052:	c3                   	ret
+    c->cpu_runq_head = e->env_rq_next;
+f0105053:	8b 48 60             	mov    0x60(%eax),%ecx
+f0105056:	89 4a 78             	mov    %ecx,0x78(%edx)
+f0105059:	eb c4                	jmp    f010501f <runq_pop+0x1d>
+    c->cpu_runq_tail = e->env_rq_prev;
+f010505b:	8b 48 64             	mov    0x64(%eax),%ecx
+f010505e:	89 4a 7c             	mov    %ecx,0x7c(%edx)
+f0105061:	eb c9                	jmp    f010502c <runq_pop+0x2a>
+    assert(e->env_status == ENV_RUNNABLE);
+f0105063:	68 10 9c 10 f0       	push   $0xf0109c10
+f0105068:	68 1f 93 10 f0       	push   $0xf010931f
+f010506d:	6a 37                	push   $0x37
+f010506f:	68 2e 9c 10 f0       	push   $0xf0109c2e
+f0105074:	e8 d9 af ff ff       	call   f0100052 <_panic>
+}
+f0105079:	c3                   	ret
+
+f010507a <sched_enqueue>:
+
+// Put a runnable env on a ready queue.  Envs go back to the CPU they
+// last ran on, which keeps their cache footprint warm; idle CPUs
+// rebalance by stealing in sched_yield().
+void
+sched_enqueue(struct Env *e) {
+f010507a:	55                   	push   %ebp
+f010507b:	89 e5                	mov    %esp,%ebp
+f010507d:	56                   	push   %esi
+f010507e:	53                   	push   %ebx
+f010507f:	8b 75 08             	mov    0x8(%ebp),%esi
+  int cpu = e->env_cpunum;
+f0105082:	8b 5e 5c             	mov    0x5c(%esi),%ebx
+
+  if (cpu < 0 || cpu >= ncpu)
+f0105085:	85 db                	test   %ebx,%ebx
+f0105087:	78 08                	js     f0105091 <sched_enqueue+0x17>
+f0105089:	39 1d 08 80 66 f0    	cmp    %ebx,0xf0668008
+f010508f:	7f 16                	jg     f01050a7 <sched_enqueue+0x2d>
+f0105091:	65 8b 1d 00 00 00 00 	mov    %gs:0x0,%ebx
+    cpu = thiscpu - cpus;
+f0105098:	81 eb 00 49 11 f0    	sub    $0xf0114900,%ebx
+f010509e:	c1 fb 02             	sar    $0x2,%ebx
+f01050a1:	69 db e1 83 0f 3e    	imul   $0x3e0f83e1,%ebx,%ebx
+  spin_lock(&runq_lock);
+f01050a7:	83 ec 0c             	sub    $0xc,%esp
+f01050aa:	68 40 66 11 f0       	push   $0xf0116640
+f01050af:	e8 36 21 00 00       	call   f01071ea <spin_lock>
+  if (e->env_rq_cpu < 0)
+f01050b4:	83 c4 10             	add    $0x10,%esp
+f01050b7:	83 7e 68 00          	cmpl   $0x0,0x68(%esi)
+f01050bb:	78 17                	js     f01050d4 <sched_enqueue+0x5a>
+    runq_push(&cpus[cpu], e);
+  spin_unlock(&runq_lock);
+f01050bd:	83 ec 0c             	sub    $0xc,%esp
+f01050c0:	68 40 66 11 f0       	push   $0xf0116640
+f01050c5:	e8 18 22 00 00       	call   f01072e2 <spin_unlock>
+}
+f01050ca:	83 c4 10             	add    $0x10,%esp
+f01050cd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f01050d0:	5b                   	pop    %ebx
+f01050d1:	5e                   	pop    %esi
+f01050d2:	5d                   	pop    %ebp
+f01050d3:	c3                   	ret
+    runq_push(&cpus[cpu], e);
+f01050d4:	69 c3 84 00 00 00    	imul   $0x84,%ebx,%eax
+  e->env_rq_next = NULL;
+f01050da:	c7 46 60 00 00 00 00 	movl   $0x0,0x60(%esi)
+  e->env_rq_prev = c->cpu_runq_tail;
+f01050e1:	8b 90 7c 49 11 f0    	mov    -0xfeeb684(%eax),%edx
+f01050e7:	89 56 64             	mov    %edx,0x64(%esi)
+  if (c->cpu_runq_tail)
+f01050ea:	85 d2                	test   %edx,%edx
+f01050ec:	74 2a                	je     f0105118 <sched_enqueue+0x9e>
+    c->cpu_runq_tail->env_rq_next = e;
+f01050ee:	89 72 60             	mov    %esi,0x60(%edx)
+  c->cpu_runq_tail = e;
+f01050f1:	69 db 84 00 00 00    	imul   $0x84,%ebx,%ebx
+f01050f7:	89 b3 7c 49 11 f0    	mov    %esi,-0xfeeb684(%ebx)
+f01050fd:	81 c3 00 49 11 f0    	add    $0xf0114900,%ebx
+  c->cpu_runq_len++;
+f0105103:	83 83 80 00 00 00 01 	addl   $0x1,0x80(%ebx)
+  e->env_rq_cpu = c - cpus;
+f010510a:	c1 f8 02             	sar    $0x2,%eax
+f010510d:	69 c0 e1 83 0f 3e    	imul   $0x3e0f83e1,%eax,%eax
+f0105113:	89 46 68             	mov    %eax,0x68(%esi)
+}
+f0105116:	eb a5                	jmp    f01050bd <sched_enqueue+0x43>
+    c->cpu_runq_head = e;
+f0105118:	69 d3 84 00 00 00    	imul   $0x84,%ebx,%edx
+f010511e:	89 b2 78 49 11 f0    	mov    %esi,-0xfeeb688(%edx)
+f0105124:	eb cb                	jmp    f01050f1 <sched_enqueue+0x77>
+
+f0105126 <sched_remove>:
+
+// Take e off whichever ready queue it is on, if any.
+void
+sched_remove(struct Env *e) {
+f0105126:	55                   	push   %ebp
+f0105127:	89 e5                	mov    %esp,%ebp
+f0105129:	53                   	push   %ebx
+f010512a:	83 ec 10             	sub    $0x10,%esp
+f010512d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  spin_lock(&runq_lock);
+f0105130:	68 40 66 11 f0       	push   $0xf0116640
+f0105135:	e8 b0 20 00 00       	call   f01071ea <spin_lock>
+  if (e->env_rq_cpu >= 0)
+f010513a:	8b 43 68             	mov    0x68(%ebx),%eax
+f010513d:	83 c4 10             	add    $0x10,%esp
+f0105140:	85 c0                	test   %eax,%eax
+f0105142:	79 15                	jns    f0105159 <sched_remove+0x33>
+    runq_unlink(&cpus[e->env_rq_cpu], e);
+  spin_unlock(&runq_lock);
+f0105144:	83 ec 0c             	sub    $0xc,%esp
+f0105147:	68 40 66 11 f0       	push   $0xf0116640
+f010514c:	e8 91 21 00 00       	call   f01072e2 <spin_unlock>
+}
+f0105151:	83 c4 10             	add    $0x10,%esp
+f0105154:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0105157:	c9                   	leave
+f0105158:	c3                   	ret
+  if (e->env_rq_prev)
+f0105159:	8b 53 64             	mov    0x64(%ebx),%edx
+f010515c:	85 d2                	test   %edx,%edx
+f010515e:	74 37                	je     f0105197 <sched_remove+0x71>
+    e->env_rq_prev->env_rq_next = e->env_rq_next;
+f0105160:	8b 4b 60             	mov    0x60(%ebx),%ecx
+f0105163:	89 4a 60             	mov    %ecx,0x60(%edx)
+  if (e->env_rq_next)
+f0105166:	8b 53 60             	mov    0x60(%ebx),%edx
+f0105169:	85 d2                	test   %edx,%edx
+f010516b:	74 3b                	je     f01051a8 <sched_remove+0x82>
+    e->env_rq_next->env_rq_prev = e->env_rq_prev;
+f010516d:	8b 4b 64             	mov    0x64(%ebx),%ecx
+f0105170:	89 4a 64             	mov    %ecx,0x64(%edx)
+  e->env_rq_next = e->env_rq_prev = NULL;
+f0105173:	c7 43 64 00 00 00 00 	movl   $0x0,0x64(%ebx)
+f010517a:	c7 43 60 00 00 00 00 	movl   $0x0,0x60(%ebx)
+  e->env_rq_cpu = -1;
+f0105181:	c7 43 68 ff ff ff ff 	movl   $0xffffffff,0x68(%ebx)
+  c->cpu_runq_len--;
+f0105188:	69 c0 84 00 00 00    	imul   $0x84,%eax,%eax
+f010518e:	83 a8 80 49 11 f0 01 	subl   $0x1,-0xfeeb680(%eax)
+}
+f0105195:	eb ad                	jmp    f0105144 <sched_remove+0x1e>
+    c->cpu_runq_head = e->env_rq_next;
+f0105197:	8b 4b 60             	mov    0x60(%ebx),%ecx
+f010519a:	69 d0 84 00 00 00    	imul   $0x84,%eax,%edx
+f01051a0:	89 8a 78 49 11 f0    	mov    %ecx,-0xfeeb688(%edx)
+f01051a6:	eb be                	jmp    f0105166 <sched_remove+0x40>
+    c->cpu_runq_tail = e->env_rq_prev;
+f01051a8:	8b 4b 64             	mov    0x64(%ebx),%ecx
+f01051ab:	69 d0 84 00 00 00    	imul   $0x84,%eax,%edx
+f01051b1:	89 8a 7c 49 11 f0    	mov    %ecx,-0xfeeb684(%edx)
+f01051b7:	eb ba                	jmp    f0105173 <sched_remove+0x4d>
+
+f01051b9 <sched_halt>:
+
+// Halt this CPU when there is nothing to do. Wait until the
+// timer interrupt wakes it up. This function never returns.
+//
+void
+sched_halt(void) {
+f01051b9:	55                   	push   %ebp
+f01051ba:	89 e5                	mov    %esp,%ebp
+f01051bc:	83 ec 08             	sub    $0x8,%esp
+  for (c = cpus; c < cpus + ncpu; c++)
+f01051bf:	69 0d 08 80 66 f0 84 	imul   $0x84,0xf0668008,%ecx
+f01051c6:	00 00 00 
+f01051c9:	81 c1 00 49 11 f0    	add    $0xf0114900,%ecx
+f01051cf:	b8 00 49 11 f0       	mov    $0xf0114900,%eax
+f01051d4:	eb 05                	jmp    f01051db <sched_halt+0x22>
+f01051d6:	05 84 00 00 00       	add    $0x84,%eax
+f01051db:	39 c8                	cmp    %ecx,%eax
+f01051dd:	0f 83 89 00 00 00    	jae    f010526c <sched_halt+0xb3>
+    if (c->cpu_runq_len > 0 || (c != thiscpu && c->cpu_env))
+f01051e3:	83 b8 80 00 00 00 00 	cmpl   $0x0,0x80(%eax)
+f01051ea:	7f 11                	jg     f01051fd <sched_halt+0x44>
+f01051ec:	65 8b 15 00 00 00 00 	mov    %gs:0x0,%edx
+f01051f3:	39 d0                	cmp    %edx,%eax
+f01051f5:	74 df                	je     f01051d6 <sched_halt+0x1d>
+f01051f7:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+f01051fb:	74 d9                	je     f01051d6 <sched_halt+0x1d>
+f01051fd:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+    while (1)
+      monitor(NULL);
+  }
+
+  // Mark that no environment is running on this CPU
+  curenv = NULL;
+f0105203:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  lcr3(PADDR(kern_pgdir));
+f010520a:	a1 cc 76 66 f0       	mov    0xf06676cc,%eax
+	if ((uint32_t)kva < KERNBASE)
+f010520f:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0105214:	76 41                	jbe    f0105257 <sched_halt+0x9e>
+	return (physaddr_t)kva - KERNBASE;
+f0105216:	05 00 00 00 10       	add    $0x10000000,%eax
+	asm volatile("movl %0,%%cr3" : : "r" (val));
+f010521b:	0f 22 d8             	mov    %eax,%cr3
+f010521e:	65 8b 15 00 00 00 00 	mov    %gs:0x0,%edx
+	asm volatile("lock; xchgl %0, %1"
+f0105225:	b8 02 00 00 00       	mov    $0x2,%eax
+f010522a:	f0 87 42 08          	lock xchg %eax,0x8(%edx)
+	spin_unlock(&kernel_lock);
+f010522e:	83 ec 0c             	sub    $0xc,%esp
+f0105231:	68 e0 66 11 f0       	push   $0xf01166e0
+f0105236:	e8 a7 20 00 00       	call   f01072e2 <spin_unlock>
+	asm volatile("pause");
+f010523b:	f3 90                	pause
+f010523d:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+
+  // Release the big kernel lock as if we were "leaving" the kernel
+  unlock_kernel();
+
+  // Reset stack pointer, enable interrupts and then halt.
+  asm volatile (
+f0105243:	8b 40 14             	mov    0x14(%eax),%eax
+f0105246:	bd 00 00 00 00       	mov    $0x0,%ebp
+f010524b:	89 c4                	mov    %eax,%esp
+f010524d:	6a 00                	push   $0x0
+f010524f:	6a 00                	push   $0x0
+f0105251:	fb                   	sti
+f0105252:	f4                   	hlt
+f0105253:	eb fd                	jmp    f0105252 <sched_halt+0x99>
+  "sti\n"
+  "1:\n"
+  "hlt\n"
+  "jmp 1b\n"
+  : : "a" (thiscpu->cpu_ts.ts_esp0));
+}
+f0105255:	c9                   	leave
+f0105256:	c3                   	ret
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0105257:	50                   	push   %eax
+f0105258:	68 88 82 10 f0       	push   $0xf0108288
+f010525d:	68 a7 00 00 00       	push   $0xa7
+f0105262:	68 2e 9c 10 f0       	push   $0xf0109c2e
+f0105267:	e8 e6 ad ff ff       	call   f0100052 <_panic>
+    cprintf("No runnable environments in the system!\n");
+f010526c:	83 ec 0c             	sub    $0xc,%esp
+f010526f:	68 48 9c 10 f0       	push   $0xf0109c48
+f0105274:	e8 61 f1 ff ff       	call   f01043da <cprintf>
+f0105279:	83 c4 10             	add    $0x10,%esp
+      monitor(NULL);
+f010527c:	83 ec 0c             	sub    $0xc,%esp
+f010527f:	6a 00                	push   $0x0
+f0105281:	e8 0f b8 ff ff       	call   f0100a95 <monitor>
+f0105286:	83 c4 10             	add    $0x10,%esp
+f0105289:	eb f1                	jmp    f010527c <sched_halt+0xc3>
+
+f010528b <sched_yield>:
+sched_yield(void) {
+f010528b:	55                   	push   %ebp
+f010528c:	89 e5                	mov    %esp,%ebp
+f010528e:	53                   	push   %ebx
+f010528f:	83 ec 10             	sub    $0x10,%esp
+	if (!spin_holding(&kernel_lock))
+f0105292:	68 e0 66 11 f0       	push   $0xf01166e0
+f0105297:	e8 00 1f 00 00       	call   f010719c <spin_holding>
+f010529c:	83 c4 10             	add    $0x10,%esp
+f010529f:	85 c0                	test   %eax,%eax
+f01052a1:	74 3a                	je     f01052dd <sched_yield+0x52>
+  spin_lock(&runq_lock);
+f01052a3:	83 ec 0c             	sub    $0xc,%esp
+f01052a6:	68 40 66 11 f0       	push   $0xf0116640
+f01052ab:	e8 3a 1f 00 00       	call   f01071ea <spin_lock>
+f01052b0:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+  if (!(e = runq_pop(thiscpu)))
+f01052b6:	e8 47 fd ff ff       	call   f0105002 <runq_pop>
+f01052bb:	89 c3                	mov    %eax,%ebx
+f01052bd:	83 c4 10             	add    $0x10,%esp
+f01052c0:	85 c0                	test   %eax,%eax
+f01052c2:	74 2b                	je     f01052ef <sched_yield+0x64>
+  spin_unlock(&runq_lock);
+f01052c4:	83 ec 0c             	sub    $0xc,%esp
+f01052c7:	68 40 66 11 f0       	push   $0xf0116640
+f01052cc:	e8 11 20 00 00       	call   f01072e2 <spin_unlock>
+f01052d1:	83 c4 10             	add    $0x10,%esp
+    env_run(e);
+f01052d4:	83 ec 0c             	sub    $0xc,%esp
+f01052d7:	53                   	push   %ebx
+f01052d8:	e8 f9 ed ff ff       	call   f01040d6 <env_run>
+	spin_lock(&kernel_lock);
+f01052dd:	83 ec 0c             	sub    $0xc,%esp
+f01052e0:	68 e0 66 11 f0       	push   $0xf01166e0
+f01052e5:	e8 00 1f 00 00       	call   f01071ea <spin_lock>
+}
+f01052ea:	83 c4 10             	add    $0x10,%esp
+f01052ed:	eb b4                	jmp    f01052a3 <sched_yield+0x18>
+  for (c = cpus; c < cpus + ncpu; c++)
+f01052ef:	69 0d 08 80 66 f0 84 	imul   $0x84,0xf0668008,%ecx
+f01052f6:	00 00 00 
+f01052f9:	81 c1 00 49 11 f0    	add    $0xf0114900,%ecx
+f01052ff:	b8 00 49 11 f0       	mov    $0xf0114900,%eax
+f0105304:	eb 07                	jmp    f010530d <sched_yield+0x82>
+      victim = c;
+f0105306:	89 c3                	mov    %eax,%ebx
+  for (c = cpus; c < cpus + ncpu; c++)
+f0105308:	05 84 00 00 00       	add    $0x84,%eax
+f010530d:	39 c8                	cmp    %ecx,%eax
+f010530f:	73 24                	jae    f0105335 <sched_yield+0xaa>
+f0105311:	65 8b 15 00 00 00 00 	mov    %gs:0x0,%edx
+    if (c != thiscpu && c->cpu_runq_len > 0 &&
+f0105318:	39 c2                	cmp    %eax,%edx
+f010531a:	74 ec                	je     f0105308 <sched_yield+0x7d>
+f010531c:	8b 90 80 00 00 00    	mov    0x80(%eax),%edx
+f0105322:	85 d2                	test   %edx,%edx
+f0105324:	7e e2                	jle    f0105308 <sched_yield+0x7d>
+f0105326:	85 db                	test   %ebx,%ebx
+f0105328:	74 dc                	je     f0105306 <sched_yield+0x7b>
+      victim = c;
+f010532a:	3b 93 80 00 00 00    	cmp    0x80(%ebx),%edx
+f0105330:	0f 4f d8             	cmovg  %eax,%ebx
+f0105333:	eb d3                	jmp    f0105308 <sched_yield+0x7d>
+  return victim ? runq_pop(victim) : NULL;
+f0105335:	85 db                	test   %ebx,%ebx
+f0105337:	74 57                	je     f0105390 <sched_yield+0x105>
+f0105339:	89 d8                	mov    %ebx,%eax
+f010533b:	e8 c2 fc ff ff       	call   f0105002 <runq_pop>
+f0105340:	89 c3                	mov    %eax,%ebx
+  spin_unlock(&runq_lock);
+f0105342:	83 ec 0c             	sub    $0xc,%esp
+f0105345:	68 40 66 11 f0       	push   $0xf0116640
+f010534a:	e8 93 1f 00 00       	call   f01072e2 <spin_unlock>
+  if ((e = sched_pick()))
+f010534f:	83 c4 10             	add    $0x10,%esp
+f0105352:	85 db                	test   %ebx,%ebx
+f0105354:	0f 85 7a ff ff ff    	jne    f01052d4 <sched_yield+0x49>
+f010535a:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+  if (curenv && curenv->env_status == ENV_RUNNING)
+f0105360:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+f0105364:	74 0f                	je     f0105375 <sched_yield+0xea>
+f0105366:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f010536c:	8b 40 0c             	mov    0xc(%eax),%eax
+f010536f:	83 78 54 03          	cmpl   $0x3,0x54(%eax)
+f0105373:	74 0a                	je     f010537f <sched_yield+0xf4>
+  sched_halt();
+f0105375:	e8 3f fe ff ff       	call   f01051b9 <sched_halt>
+}
+f010537a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010537d:	c9                   	leave
+f010537e:	c3                   	ret
+f010537f:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+    env_run(curenv);
+f0105385:	83 ec 0c             	sub    $0xc,%esp
+f0105388:	ff 70 0c             	push   0xc(%eax)
+f010538b:	e8 46 ed ff ff       	call   f01040d6 <env_run>
+  spin_unlock(&runq_lock);
+f0105390:	83 ec 0c             	sub    $0xc,%esp
+f0105393:	68 40 66 11 f0       	push   $0xf0116640
+f0105398:	e8 45 1f 00 00       	call   f01072e2 <spin_unlock>
+f010539d:	83 c4 10             	add    $0x10,%esp
+f01053a0:	eb b8                	jmp    f010535a <sched_yield+0xcf>
+
+f01053a2 <sys_net_send>:
+    // LAB 6: Your code here.
+    return time_msec();
+}
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+f01053a2:	55                   	push   %ebp
+f01053a3:	89 e5                	mov    %esp,%ebp
+f01053a5:	56                   	push   %esi
+f01053a6:	53                   	push   %ebx
+f01053a7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f01053aa:	8b 75 0c             	mov    0xc(%ebp),%esi
+f01053ad:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+    // LAB 6: Your code here.
+    // Check the user permission to [buf, buf + len]
+    // Call e1000_tx to send the packet
+    // Hint: e1000_tx only accept kernel virtual address
+    user_mem_assert(curenv, buf, len, PTE_P | PTE_W | PTE_U);
+f01053b3:	6a 07                	push   $0x7
+f01053b5:	56                   	push   %esi
+f01053b6:	53                   	push   %ebx
+f01053b7:	ff 70 0c             	push   0xc(%eax)
+f01053ba:	e8 7f de ff ff       	call   f010323e <user_mem_assert>
+    return e1000_tx(buf, len);
+f01053bf:	83 c4 08             	add    $0x8,%esp
+f01053c2:	56                   	push   %esi
+f01053c3:	53                   	push   %ebx
+f01053c4:	e8 06 23 00 00       	call   f01076cf <e1000_tx>
+}
+f01053c9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f01053cc:	5b                   	pop    %ebx
+f01053cd:	5e                   	pop    %esi
+f01053ce:	5d                   	pop    %ebp
+f01053cf:	c3                   	ret
+
+f01053d0 <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+f01053d0:	55                   	push   %ebp
+f01053d1:	89 e5                	mov    %esp,%ebp
+f01053d3:	56                   	push   %esi
+f01053d4:	53                   	push   %ebx
+f01053d5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f01053d8:	8b 75 0c             	mov    0xc(%ebp),%esi
+f01053db:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+    // LAB 6: Your code here.
+    // Check the user permission to [buf, buf + len]
+    // Call e1000_rx to fill the buffer
+    // Hint: e1000_rx only accept kernel virtual address
+    user_mem_assert(curenv, buf, len, PTE_P | PTE_W | PTE_U);
+f01053e1:	6a 07                	push   $0x7
+f01053e3:	56                   	push   %esi
+f01053e4:	53                   	push   %ebx
+f01053e5:	ff 70 0c             	push   0xc(%eax)
+f01053e8:	e8 51 de ff ff       	call   f010323e <user_mem_assert>
+    return e1000_rx(buf, len);
+f01053ed:	83 c4 08             	add    $0x8,%esp
+f01053f0:	56                   	push   %esi
+f01053f1:	53                   	push   %ebx
+f01053f2:	e8 73 23 00 00       	call   f010776a <e1000_rx>
+}
+f01053f7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f01053fa:	5b                   	pop    %ebx
+f01053fb:	5e                   	pop    %esi
+f01053fc:	5d                   	pop    %ebp
+f01053fd:	c3                   	ret
+
+f01053fe <sys_sleep>:
+
+int sys_sleep(unsigned msec) {
+f01053fe:	55                   	push   %ebp
+f01053ff:	89 e5                	mov    %esp,%ebp
+f0105401:	53                   	push   %ebx
+f0105402:	83 ec 04             	sub    $0x4,%esp
+    unsigned start = time_msec(), end = start + msec;
+f0105405:	e8 73 29 00 00       	call   f0107d7d <time_msec>
+f010540a:	03 45 08             	add    0x8(%ebp),%eax
+f010540d:	89 c3                	mov    %eax,%ebx
+    while (time_msec() < end)
+f010540f:	e8 69 29 00 00       	call   f0107d7d <time_msec>
+f0105414:	39 d8                	cmp    %ebx,%eax
+f0105416:	72 0a                	jb     f0105422 <sys_sleep+0x24>
+        sched_yield();
+    return 0;
+}
+f0105418:	b8 00 00 00 00       	mov    $0x0,%eax
+f010541d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0105420:	c9                   	leave
+f0105421:	c3                   	ret
+        sched_yield();
+f0105422:	e8 64 fe ff ff       	call   f010528b <sched_yield>
+
+f0105427 <syscall_nolock>:
+// Returns true if syscallno can run without the big kernel lock.
+// These syscalls only touch state guarded by the finer-grained locks
+// in kern/spinlock.h; anything that blocks or schedules still takes
+// the big lock, lazily if need be.
+bool
+syscall_nolock(uint32_t syscallno) {
+f0105427:	55                   	push   %ebp
+f0105428:	89 e5                	mov    %esp,%ebp
+f010542a:	8b 45 08             	mov    0x8(%ebp),%eax
+    switch (syscallno) {
+f010542d:	83 f8 10             	cmp    $0x10,%eax
+f0105430:	77 0d                	ja     f010543f <syscall_nolock+0x18>
+f0105432:	ba f7 10 01 00       	mov    $0x110f7,%edx
+f0105437:	0f a3 c2             	bt     %eax,%edx
+f010543a:	0f 92 c0             	setb   %al
+#endif
+            return 1;
+        default:
+            return 0;
+    }
+}
+f010543d:	5d                   	pop    %ebp
+f010543e:	c3                   	ret
+    switch (syscallno) {
+f010543f:	b8 00 00 00 00       	mov    $0x0,%eax
+f0105444:	eb f7                	jmp    f010543d <syscall_nolock+0x16>
+
+f0105446 <syscall>:
+
+// Dispatches to the correct kernel function, passing the arguments.
+int32_t
+syscall(uint32_t syscallno, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5) {
+f0105446:	55                   	push   %ebp
+f0105447:	89 e5                	mov    %esp,%ebp
+f0105449:	57                   	push   %edi
+f010544a:	56                   	push   %esi
+f010544b:	53                   	push   %ebx
+f010544c:	83 ec 1c             	sub    $0x1c,%esp
+f010544f:	8b 45 08             	mov    0x8(%ebp),%eax
+    // Call the function corresponding to the 'syscallno' parameter.
+    // Return any appropriate return value.
+    // LAB 3: Your code here.
+    int r = 0;
+
+    switch (syscallno) {
+f0105452:	83 f8 14             	cmp    $0x14,%eax
+f0105455:	0f 87 60 08 00 00    	ja     f0105cbb <syscall+0x875>
+f010545b:	ff 24 85 a0 9c 10 f0 	jmp    *-0xfef6360(,%eax,4)
+    if (!s) panic("sys_cputs: string ptr NULL");
+f0105462:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+f0105466:	74 33                	je     f010549b <syscall+0x55>
+f0105468:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+    user_mem_assert(curenv, s, len, 0);
+f010546e:	6a 00                	push   $0x0
+f0105470:	ff 75 10             	push   0x10(%ebp)
+f0105473:	ff 75 0c             	push   0xc(%ebp)
+f0105476:	ff 70 0c             	push   0xc(%eax)
+f0105479:	e8 c0 dd ff ff       	call   f010323e <user_mem_assert>
+    cprintf("%.*s", len, s);
+f010547e:	83 c4 0c             	add    $0xc,%esp
+f0105481:	ff 75 0c             	push   0xc(%ebp)
+f0105484:	ff 75 10             	push   0x10(%ebp)
+f0105487:	68 9b 9c 10 f0       	push   $0xf0109c9b
+f010548c:	e8 49 ef ff ff       	call   f01043da <cprintf>
+}
+f0105491:	83 c4 10             	add    $0x10,%esp
+    int r = 0;
+f0105494:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+f0105499:	eb 1b                	jmp    f01054b6 <syscall+0x70>
+    if (!s) panic("sys_cputs: string ptr NULL");
+f010549b:	83 ec 04             	sub    $0x4,%esp
+f010549e:	68 71 9c 10 f0       	push   $0xf0109c71
+f01054a3:	6a 1f                	push   $0x1f
+f01054a5:	68 8c 9c 10 f0       	push   $0xf0109c8c
+f01054aa:	e8 a3 ab ff ff       	call   f0100052 <_panic>
+    return cons_getc();
+f01054af:	e8 99 b1 ff ff       	call   f010064d <cons_getc>
+f01054b4:	89 c3                	mov    %eax,%ebx
+            break;
+        default:
+            r = -E_INVAL;
+    }
+    return r;
+}
+f01054b6:	89 d8                	mov    %ebx,%eax
+f01054b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01054bb:	5b                   	pop    %ebx
+f01054bc:	5e                   	pop    %esi
+f01054bd:	5f                   	pop    %edi
+f01054be:	5d                   	pop    %ebp
+f01054bf:	c3                   	ret
+f01054c0:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+    return curenv->env_id;
+f01054c6:	8b 40 0c             	mov    0xc(%eax),%eax
+f01054c9:	8b 58 48             	mov    0x48(%eax),%ebx
+            break;
+f01054cc:	eb e8                	jmp    f01054b6 <syscall+0x70>
+    if ((r = envid2env(envid, &e, 1)) < 0)
+f01054ce:	83 ec 04             	sub    $0x4,%esp
+f01054d1:	6a 01                	push   $0x1
+f01054d3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f01054d6:	50                   	push   %eax
+f01054d7:	ff 75 0c             	push   0xc(%ebp)
+f01054da:	e8 29 e0 ff ff       	call   f0103508 <envid2env>
+f01054df:	89 c3                	mov    %eax,%ebx
+f01054e1:	83 c4 10             	add    $0x10,%esp
+f01054e4:	85 c0                	test   %eax,%eax
+f01054e6:	78 ce                	js     f01054b6 <syscall+0x70>
+    env_destroy(e);
+f01054e8:	83 ec 0c             	sub    $0xc,%esp
+f01054eb:	ff 75 e4             	push   -0x1c(%ebp)
+f01054ee:	e8 3d eb ff ff       	call   f0104030 <env_destroy>
+    return 0;
+f01054f3:	83 c4 10             	add    $0x10,%esp
+f01054f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+            break;
+f01054fb:	eb b9                	jmp    f01054b6 <syscall+0x70>
+	if ((uint32_t)kva < KERNBASE)
+f01054fd:	81 7d 0c ff ff ff ef 	cmpl   $0xefffffff,0xc(%ebp)
+f0105504:	76 5f                	jbe    f0105565 <syscall+0x11f>
+	return (physaddr_t)kva - KERNBASE;
+f0105506:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0105509:	05 00 00 00 10       	add    $0x10000000,%eax
+	if (PGNUM(pa) >= npages)
+f010550e:	c1 e8 0c             	shr    $0xc,%eax
+f0105511:	3b 05 c8 76 66 f0    	cmp    0xf06676c8,%eax
+f0105517:	73 63                	jae    f010557c <syscall+0x136>
+	return &pages[PGNUM(pa)];
+f0105519:	8b 15 d0 76 66 f0    	mov    0xf06676d0,%edx
+f010551f:	8d 1c c2             	lea    (%edx,%eax,8),%ebx
+    if (p == NULL)
+f0105522:	85 db                	test   %ebx,%ebx
+f0105524:	0f 84 9b 07 00 00    	je     f0105cc5 <syscall+0x87f>
+    spin_lock(&vm_lock);
+f010552a:	83 ec 0c             	sub    $0xc,%esp
+f010552d:	68 60 64 11 f0       	push   $0xf0116460
+f0105532:	e8 b3 1c 00 00       	call   f01071ea <spin_lock>
+f0105537:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+    r = page_insert(curenv->env_pgdir, p, va, PTE_U | PTE_W);
+f010553d:	6a 06                	push   $0x6
+f010553f:	ff 75 10             	push   0x10(%ebp)
+f0105542:	53                   	push   %ebx
+f0105543:	8b 40 0c             	mov    0xc(%eax),%eax
+f0105546:	ff 70 70             	push   0x70(%eax)
+f0105549:	e8 ef be ff ff       	call   f010143d <page_insert>
+f010554e:	89 c3                	mov    %eax,%ebx
+    spin_unlock(&vm_lock);
+f0105550:	83 c4 14             	add    $0x14,%esp
+f0105553:	68 60 64 11 f0       	push   $0xf0116460
+f0105558:	e8 85 1d 00 00       	call   f01072e2 <spin_unlock>
+    return r;
+f010555d:	83 c4 10             	add    $0x10,%esp
+f0105560:	e9 51 ff ff ff       	jmp    f01054b6 <syscall+0x70>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0105565:	ff 75 0c             	push   0xc(%ebp)
+f0105568:	68 88 82 10 f0       	push   $0xf0108288
+f010556d:	68 ff 01 00 00       	push   $0x1ff
+f0105572:	68 8c 9c 10 f0       	push   $0xf0109c8c
+f0105577:	e8 d6 aa ff ff       	call   f0100052 <_panic>
+		panic("pa2page called with invalid pa");
+f010557c:	83 ec 04             	sub    $0x4,%esp
+f010557f:	68 00 8a 10 f0       	push   $0xf0108a00
+f0105584:	6a 53                	push   $0x53
+f0105586:	68 05 93 10 f0       	push   $0xf0109305
+f010558b:	e8 c2 aa ff ff       	call   f0100052 <_panic>
+f0105590:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+    uintptr_t curbrk = curenv->env_brk;
+f0105596:	8b 40 0c             	mov    0xc(%eax),%eax
+f0105599:	8b 58 6c             	mov    0x6c(%eax),%ebx
+    spin_lock(&vm_lock);
+f010559c:	83 ec 0c             	sub    $0xc,%esp
+f010559f:	68 60 64 11 f0       	push   $0xf0116460
+f01055a4:	e8 41 1c 00 00       	call   f01071ea <spin_lock>
+    region_alloc(curenv, (void *) (curbrk - inc), inc);
+f01055a9:	2b 5d 0c             	sub    0xc(%ebp),%ebx
+f01055ac:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+f01055b2:	83 c4 0c             	add    $0xc,%esp
+f01055b5:	ff 75 0c             	push   0xc(%ebp)
+f01055b8:	53                   	push   %ebx
+f01055b9:	ff 70 0c             	push   0xc(%eax)
+f01055bc:	e8 af e3 ff ff       	call   f0103970 <region_alloc>
+    spin_unlock(&vm_lock);
+f01055c1:	c7 04 24 60 64 11 f0 	movl   $0xf0116460,(%esp)
+f01055c8:	e8 15 1d 00 00       	call   f01072e2 <spin_unlock>
+f01055cd:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+    curenv->env_brk = ROUNDDOWN(curbrk - inc, PGSIZE);
+f01055d3:	8b 40 0c             	mov    0xc(%eax),%eax
+f01055d6:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+f01055dc:	89 58 6c             	mov    %ebx,0x6c(%eax)
+f01055df:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+    return curenv->env_brk;
+f01055e5:	8b 40 0c             	mov    0xc(%eax),%eax
+f01055e8:	8b 58 6c             	mov    0x6c(%eax),%ebx
+            break;
+f01055eb:	83 c4 10             	add    $0x10,%esp
+f01055ee:	e9 c3 fe ff ff       	jmp    f01054b6 <syscall+0x70>
+    sched_yield();
+f01055f3:	e8 93 fc ff ff       	call   f010528b <sched_yield>
+f01055f8:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+    if ((r = env_alloc(&child, curenv->env_id)) < 0)
+f01055fe:	83 ec 08             	sub    $0x8,%esp
+f0105601:	8b 40 0c             	mov    0xc(%eax),%eax
+f0105604:	ff 70 48             	push   0x48(%eax)
+f0105607:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f010560a:	50                   	push   %eax
+f010560b:	e8 6c e0 ff ff       	call   f010367c <env_alloc>
+f0105610:	89 c3                	mov    %eax,%ebx
+f0105612:	83 c4 10             	add    $0x10,%esp
+f0105615:	85 c0                	test   %eax,%eax
+f0105617:	0f 88 99 fe ff ff    	js     f01054b6 <syscall+0x70>
+    child->env_status = ENV_NOT_RUNNABLE;
+f010561d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0105620:	c7 40 54 04 00 00 00 	movl   $0x4,0x54(%eax)
+f0105627:	65 8b 15 00 00 00 00 	mov    %gs:0x0,%edx
+    child->env_tf = curenv->env_tf;
+f010562e:	8b 72 0c             	mov    0xc(%edx),%esi
+f0105631:	b9 11 00 00 00       	mov    $0x11,%ecx
+f0105636:	89 c7                	mov    %eax,%edi
+f0105638:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    child->env_tf.tf_regs.reg_eax = 0;
+f010563a:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+    return child->env_id;
+f0105641:	8b 58 48             	mov    0x48(%eax),%ebx
+            break;
+f0105644:	e9 6d fe ff ff       	jmp    f01054b6 <syscall+0x70>
+    if (envid2env(envid, &e, 1))
+f0105649:	83 ec 04             	sub    $0x4,%esp
+f010564c:	6a 01                	push   $0x1
+f010564e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0105651:	50                   	push   %eax
+f0105652:	ff 75 0c             	push   0xc(%ebp)
+f0105655:	e8 ae de ff ff       	call   f0103508 <envid2env>
+f010565a:	89 c3                	mov    %eax,%ebx
+f010565c:	83 c4 10             	add    $0x10,%esp
+f010565f:	85 c0                	test   %eax,%eax
+f0105661:	75 5a                	jne    f01056bd <syscall+0x277>
+    if (!(status == ENV_RUNNABLE || status == ENV_NOT_RUNNABLE))
+f0105663:	8b 45 10             	mov    0x10(%ebp),%eax
+f0105666:	83 e8 02             	sub    $0x2,%eax
+f0105669:	a9 fd ff ff ff       	test   $0xfffffffd,%eax
+f010566e:	75 57                	jne    f01056c7 <syscall+0x281>
+    spin_lock(&env_lock);
+f0105670:	83 ec 0c             	sub    $0xc,%esp
+f0105673:	68 a0 65 11 f0       	push   $0xf01165a0
+f0105678:	e8 6d 1b 00 00       	call   f01071ea <spin_lock>
+    e->env_status = status;
+f010567d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0105680:	8b 7d 10             	mov    0x10(%ebp),%edi
+f0105683:	89 78 54             	mov    %edi,0x54(%eax)
+    if (status == ENV_RUNNABLE)
+f0105686:	83 c4 10             	add    $0x10,%esp
+f0105689:	83 ff 02             	cmp    $0x2,%edi
+f010568c:	74 21                	je     f01056af <syscall+0x269>
+        sched_remove(e);
+f010568e:	83 ec 0c             	sub    $0xc,%esp
+f0105691:	50                   	push   %eax
+f0105692:	e8 8f fa ff ff       	call   f0105126 <sched_remove>
+f0105697:	83 c4 10             	add    $0x10,%esp
+    spin_unlock(&env_lock);
+f010569a:	83 ec 0c             	sub    $0xc,%esp
+f010569d:	68 a0 65 11 f0       	push   $0xf01165a0
+f01056a2:	e8 3b 1c 00 00       	call   f01072e2 <spin_unlock>
+    return 0;
+f01056a7:	83 c4 10             	add    $0x10,%esp
+f01056aa:	e9 07 fe ff ff       	jmp    f01054b6 <syscall+0x70>
+        sched_enqueue(e);
+f01056af:	83 ec 0c             	sub    $0xc,%esp
+f01056b2:	50                   	push   %eax
+f01056b3:	e8 c2 f9 ff ff       	call   f010507a <sched_enqueue>
+f01056b8:	83 c4 10             	add    $0x10,%esp
+f01056bb:	eb dd                	jmp    f010569a <syscall+0x254>
+        return -E_BAD_ENV;
+f01056bd:	bb fe ff ff ff       	mov    $0xfffffffe,%ebx
+f01056c2:	e9 ef fd ff ff       	jmp    f01054b6 <syscall+0x70>
+        return -E_INVAL;
+f01056c7:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+            break;
+f01056cc:	e9 e5 fd ff ff       	jmp    f01054b6 <syscall+0x70>
+    if ((uintptr_t) va >= UTOP || PGOFF(va)
+f01056d1:	81 7d 10 ff ff bf ee 	cmpl   $0xeebfffff,0x10(%ebp)
+f01056d8:	0f 87 d4 00 00 00    	ja     f01057b2 <syscall+0x36c>
+f01056de:	f7 45 10 ff 0f 00 00 	testl  $0xfff,0x10(%ebp)
+f01056e5:	0f 85 d1 00 00 00    	jne    f01057bc <syscall+0x376>
+        || perm & (~PTE_SYSCALL))
+f01056eb:	8b 45 14             	mov    0x14(%ebp),%eax
+f01056ee:	25 fd f1 ff ff       	and    $0xfffff1fd,%eax
+f01056f3:	83 f8 05             	cmp    $0x5,%eax
+f01056f6:	0f 85 ca 00 00 00    	jne    f01057c6 <syscall+0x380>
+    if (!(pp = page_alloc(ALLOC_ZERO)))
+f01056fc:	83 ec 0c             	sub    $0xc,%esp
+f01056ff:	6a 01                	push   $0x1
+f0105701:	e8 5e ba ff ff       	call   f0101164 <page_alloc>
+f0105706:	89 c6                	mov    %eax,%esi
+f0105708:	83 c4 10             	add    $0x10,%esp
+f010570b:	85 c0                	test   %eax,%eax
+f010570d:	0f 84 bd 00 00 00    	je     f01057d0 <syscall+0x38a>
+    spin_lock(&vm_lock);
+f0105713:	83 ec 0c             	sub    $0xc,%esp
+f0105716:	68 60 64 11 f0       	push   $0xf0116460
+f010571b:	e8 ca 1a 00 00       	call   f01071ea <spin_lock>
+    if (envid2env(envid, &e, 1)) {
+f0105720:	83 c4 0c             	add    $0xc,%esp
+f0105723:	6a 01                	push   $0x1
+f0105725:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0105728:	50                   	push   %eax
+f0105729:	ff 75 0c             	push   0xc(%ebp)
+f010572c:	e8 d7 dd ff ff       	call   f0103508 <envid2env>
+f0105731:	83 c4 10             	add    $0x10,%esp
+        r = -E_BAD_ENV;
+f0105734:	bb fe ff ff ff       	mov    $0xfffffffe,%ebx
+    if (envid2env(envid, &e, 1)) {
+f0105739:	85 c0                	test   %eax,%eax
+f010573b:	74 21                	je     f010575e <syscall+0x318>
+    page_free(pp);
+f010573d:	83 ec 0c             	sub    $0xc,%esp
+f0105740:	56                   	push   %esi
+f0105741:	e8 c8 ba ff ff       	call   f010120e <page_free>
+f0105746:	83 c4 10             	add    $0x10,%esp
+    spin_unlock(&vm_lock);
+f0105749:	83 ec 0c             	sub    $0xc,%esp
+f010574c:	68 60 64 11 f0       	push   $0xf0116460
+f0105751:	e8 8c 1b 00 00       	call   f01072e2 <spin_unlock>
+    return r;
+f0105756:	83 c4 10             	add    $0x10,%esp
+f0105759:	e9 58 fd ff ff       	jmp    f01054b6 <syscall+0x70>
+    if (page_insert(e->env_pgdir, pp, va, perm))
+f010575e:	ff 75 14             	push   0x14(%ebp)
+f0105761:	ff 75 10             	push   0x10(%ebp)
+f0105764:	56                   	push   %esi
+f0105765:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0105768:	ff 70 70             	push   0x70(%eax)
+f010576b:	e8 cd bc ff ff       	call   f010143d <page_insert>
+f0105770:	83 c4 10             	add    $0x10,%esp
+    int r = -E_NO_MEM;
+f0105773:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+    if (page_insert(e->env_pgdir, pp, va, perm))
+f0105778:	85 c0                	test   %eax,%eax
+f010577a:	75 c1                	jne    f010573d <syscall+0x2f7>
+    if (page_insert(e->env_kern_pgdir, pp, va, perm)) {
+f010577c:	ff 75 14             	push   0x14(%ebp)
+f010577f:	ff 75 10             	push   0x10(%ebp)
+f0105782:	56                   	push   %esi
+f0105783:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0105786:	ff 70 74             	push   0x74(%eax)
+f0105789:	e8 af bc ff ff       	call   f010143d <page_insert>
+f010578e:	89 c3                	mov    %eax,%ebx
+f0105790:	83 c4 10             	add    $0x10,%esp
+f0105793:	85 c0                	test   %eax,%eax
+f0105795:	74 b2                	je     f0105749 <syscall+0x303>
+        page_remove(e->env_pgdir, va);
+f0105797:	83 ec 08             	sub    $0x8,%esp
+f010579a:	ff 75 10             	push   0x10(%ebp)
+f010579d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01057a0:	ff 70 70             	push   0x70(%eax)
+f01057a3:	e8 48 bc ff ff       	call   f01013f0 <page_remove>
+        goto out;
+f01057a8:	83 c4 10             	add    $0x10,%esp
+    int r = -E_NO_MEM;
+f01057ab:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+        goto out;
+f01057b0:	eb 97                	jmp    f0105749 <syscall+0x303>
+        return -E_INVAL;
+f01057b2:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f01057b7:	e9 fa fc ff ff       	jmp    f01054b6 <syscall+0x70>
+f01057bc:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f01057c1:	e9 f0 fc ff ff       	jmp    f01054b6 <syscall+0x70>
+f01057c6:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f01057cb:	e9 e6 fc ff ff       	jmp    f01054b6 <syscall+0x70>
+        return -E_NO_MEM;
+f01057d0:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+            break;
+f01057d5:	e9 dc fc ff ff       	jmp    f01054b6 <syscall+0x70>
+            r = sys_page_map(a1, (void *) a2, a3, (void *) a4, a5);
+f01057da:	8b 75 18             	mov    0x18(%ebp),%esi
+    if ((uintptr_t) srcva >= UTOP || PGOFF(srcva)
+f01057dd:	81 7d 10 ff ff bf ee 	cmpl   $0xeebfffff,0x10(%ebp)
+f01057e4:	0f 87 e5 04 00 00    	ja     f0105ccf <syscall+0x889>
+        || (uintptr_t) dstva >= UTOP || PGOFF(dstva)
+f01057ea:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+f01057f0:	0f 87 e3 04 00 00    	ja     f0105cd9 <syscall+0x893>
+f01057f6:	8b 45 10             	mov    0x10(%ebp),%eax
+f01057f9:	09 f0                	or     %esi,%eax
+f01057fb:	a9 ff 0f 00 00       	test   $0xfff,%eax
+f0105800:	0f 85 dd 04 00 00    	jne    f0105ce3 <syscall+0x89d>
+        || (perm & (PTE_U | PTE_P)) != (PTE_U | PTE_P) || perm & ~PTE_SYSCALL)
+f0105806:	8b 45 1c             	mov    0x1c(%ebp),%eax
+f0105809:	25 fd f1 ff ff       	and    $0xfffff1fd,%eax
+f010580e:	83 f8 05             	cmp    $0x5,%eax
+f0105811:	0f 85 d6 04 00 00    	jne    f0105ced <syscall+0x8a7>
+    spin_lock(&vm_lock);
+f0105817:	83 ec 0c             	sub    $0xc,%esp
+f010581a:	68 60 64 11 f0       	push   $0xf0116460
+f010581f:	e8 c6 19 00 00       	call   f01071ea <spin_lock>
+    if (envid2env(srcenvid, &srcenv, 1) || envid2env(dstenvid, &dstenv, 1))
+f0105824:	83 c4 0c             	add    $0xc,%esp
+f0105827:	6a 01                	push   $0x1
+f0105829:	8d 45 dc             	lea    -0x24(%ebp),%eax
+f010582c:	50                   	push   %eax
+f010582d:	ff 75 0c             	push   0xc(%ebp)
+f0105830:	e8 d3 dc ff ff       	call   f0103508 <envid2env>
+f0105835:	83 c4 10             	add    $0x10,%esp
+f0105838:	85 c0                	test   %eax,%eax
+f010583a:	0f 85 a6 00 00 00    	jne    f01058e6 <syscall+0x4a0>
+f0105840:	83 ec 04             	sub    $0x4,%esp
+f0105843:	6a 01                	push   $0x1
+f0105845:	8d 45 e0             	lea    -0x20(%ebp),%eax
+f0105848:	50                   	push   %eax
+f0105849:	ff 75 14             	push   0x14(%ebp)
+f010584c:	e8 b7 dc ff ff       	call   f0103508 <envid2env>
+f0105851:	83 c4 10             	add    $0x10,%esp
+f0105854:	85 c0                	test   %eax,%eax
+f0105856:	0f 85 91 00 00 00    	jne    f01058ed <syscall+0x4a7>
+    if (!(pp = page_lookup(srcenv->env_pgdir, srcva, &pte)))
+f010585c:	83 ec 04             	sub    $0x4,%esp
+f010585f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0105862:	50                   	push   %eax
+f0105863:	ff 75 10             	push   0x10(%ebp)
+f0105866:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f0105869:	ff 70 70             	push   0x70(%eax)
+f010586c:	e8 f9 ba ff ff       	call   f010136a <page_lookup>
+f0105871:	89 c3                	mov    %eax,%ebx
+f0105873:	83 c4 10             	add    $0x10,%esp
+f0105876:	85 c0                	test   %eax,%eax
+f0105878:	74 7a                	je     f01058f4 <syscall+0x4ae>
+    if (!(*pte & PTE_W) && (perm & PTE_W))
+f010587a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010587d:	f6 00 02             	testb  $0x2,(%eax)
+f0105880:	75 06                	jne    f0105888 <syscall+0x442>
+f0105882:	f6 45 1c 02          	testb  $0x2,0x1c(%ebp)
+f0105886:	75 73                	jne    f01058fb <syscall+0x4b5>
+    if (page_insert(dstenv->env_pgdir, pp, dstva, perm))
+f0105888:	ff 75 1c             	push   0x1c(%ebp)
+f010588b:	56                   	push   %esi
+f010588c:	53                   	push   %ebx
+f010588d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0105890:	ff 70 70             	push   0x70(%eax)
+f0105893:	e8 a5 bb ff ff       	call   f010143d <page_insert>
+f0105898:	83 c4 10             	add    $0x10,%esp
+f010589b:	85 c0                	test   %eax,%eax
+f010589d:	75 63                	jne    f0105902 <syscall+0x4bc>
+    if (page_insert(dstenv->env_kern_pgdir, pp, dstva, perm)) {
+f010589f:	ff 75 1c             	push   0x1c(%ebp)
+f01058a2:	56                   	push   %esi
+f01058a3:	53                   	push   %ebx
+f01058a4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f01058a7:	ff 70 74             	push   0x74(%eax)
+f01058aa:	e8 8e bb ff ff       	call   f010143d <page_insert>
+f01058af:	89 c3                	mov    %eax,%ebx
+f01058b1:	83 c4 10             	add    $0x10,%esp
+f01058b4:	85 c0                	test   %eax,%eax
+f01058b6:	75 15                	jne    f01058cd <syscall+0x487>
+    spin_unlock(&vm_lock);
+f01058b8:	83 ec 0c             	sub    $0xc,%esp
+f01058bb:	68 60 64 11 f0       	push   $0xf0116460
+f01058c0:	e8 1d 1a 00 00       	call   f01072e2 <spin_unlock>
+    return r;
+f01058c5:	83 c4 10             	add    $0x10,%esp
+f01058c8:	e9 e9 fb ff ff       	jmp    f01054b6 <syscall+0x70>
+        page_remove(dstenv->env_pgdir, dstva);
+f01058cd:	83 ec 08             	sub    $0x8,%esp
+f01058d0:	56                   	push   %esi
+f01058d1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f01058d4:	ff 70 70             	push   0x70(%eax)
+f01058d7:	e8 14 bb ff ff       	call   f01013f0 <page_remove>
+        return -E_NO_MEM;
+f01058dc:	83 c4 10             	add    $0x10,%esp
+f01058df:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+f01058e4:	eb d2                	jmp    f01058b8 <syscall+0x472>
+        return -E_BAD_ENV;
+f01058e6:	bb fe ff ff ff       	mov    $0xfffffffe,%ebx
+f01058eb:	eb cb                	jmp    f01058b8 <syscall+0x472>
+f01058ed:	bb fe ff ff ff       	mov    $0xfffffffe,%ebx
+f01058f2:	eb c4                	jmp    f01058b8 <syscall+0x472>
+        return -E_INVAL;
+f01058f4:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f01058f9:	eb bd                	jmp    f01058b8 <syscall+0x472>
+        return -E_INVAL;
+f01058fb:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f0105900:	eb b6                	jmp    f01058b8 <syscall+0x472>
+        return -E_NO_MEM;
+f0105902:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+f0105907:	eb af                	jmp    f01058b8 <syscall+0x472>
+    if ((uintptr_t) va >= UTOP || PGOFF(va))
+f0105909:	81 7d 10 ff ff bf ee 	cmpl   $0xeebfffff,0x10(%ebp)
+f0105910:	0f 87 84 00 00 00    	ja     f010599a <syscall+0x554>
+f0105916:	f7 45 10 ff 0f 00 00 	testl  $0xfff,0x10(%ebp)
+f010591d:	0f 85 81 00 00 00    	jne    f01059a4 <syscall+0x55e>
+    spin_lock(&vm_lock);
+f0105923:	83 ec 0c             	sub    $0xc,%esp
+f0105926:	68 60 64 11 f0       	push   $0xf0116460
+f010592b:	e8 ba 18 00 00       	call   f01071ea <spin_lock>
+    if (envid2env(envid, &e, 1)) {
+f0105930:	83 c4 0c             	add    $0xc,%esp
+f0105933:	6a 01                	push   $0x1
+f0105935:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0105938:	50                   	push   %eax
+f0105939:	ff 75 0c             	push   0xc(%ebp)
+f010593c:	e8 c7 db ff ff       	call   f0103508 <envid2env>
+f0105941:	89 c3                	mov    %eax,%ebx
+f0105943:	83 c4 10             	add    $0x10,%esp
+f0105946:	85 c0                	test   %eax,%eax
+f0105948:	75 36                	jne    f0105980 <syscall+0x53a>
+    page_remove(e->env_pgdir, va);
+f010594a:	83 ec 08             	sub    $0x8,%esp
+f010594d:	ff 75 10             	push   0x10(%ebp)
+f0105950:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0105953:	ff 70 70             	push   0x70(%eax)
+f0105956:	e8 95 ba ff ff       	call   f01013f0 <page_remove>
+    page_remove(e->env_kern_pgdir, va);
+f010595b:	83 c4 08             	add    $0x8,%esp
+f010595e:	ff 75 10             	push   0x10(%ebp)
+f0105961:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0105964:	ff 70 74             	push   0x74(%eax)
+f0105967:	e8 84 ba ff ff       	call   f01013f0 <page_remove>
+    spin_unlock(&vm_lock);
+f010596c:	c7 04 24 60 64 11 f0 	movl   $0xf0116460,(%esp)
+f0105973:	e8 6a 19 00 00       	call   f01072e2 <spin_unlock>
+    return 0;
+f0105978:	83 c4 10             	add    $0x10,%esp
+f010597b:	e9 36 fb ff ff       	jmp    f01054b6 <syscall+0x70>
+        spin_unlock(&vm_lock);
+f0105980:	83 ec 0c             	sub    $0xc,%esp
+f0105983:	68 60 64 11 f0       	push   $0xf0116460
+f0105988:	e8 55 19 00 00       	call   f01072e2 <spin_unlock>
+        return -E_BAD_ENV;
+f010598d:	83 c4 10             	add    $0x10,%esp
+f0105990:	bb fe ff ff ff       	mov    $0xfffffffe,%ebx
+f0105995:	e9 1c fb ff ff       	jmp    f01054b6 <syscall+0x70>
+        return -E_INVAL;
+f010599a:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f010599f:	e9 12 fb ff ff       	jmp    f01054b6 <syscall+0x70>
+f01059a4:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+            break;
+f01059a9:	e9 08 fb ff ff       	jmp    f01054b6 <syscall+0x70>
+    if (envid2env(envid, &e, 1))
+f01059ae:	83 ec 04             	sub    $0x4,%esp
+f01059b1:	6a 01                	push   $0x1
+f01059b3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f01059b6:	50                   	push   %eax
+f01059b7:	ff 75 0c             	push   0xc(%ebp)
+f01059ba:	e8 49 db ff ff       	call   f0103508 <envid2env>
+f01059bf:	89 c3                	mov    %eax,%ebx
+f01059c1:	83 c4 10             	add    $0x10,%esp
+f01059c4:	85 c0                	test   %eax,%eax
+f01059c6:	75 0e                	jne    f01059d6 <syscall+0x590>
+    e->env_pgfault_upcall = func;
+f01059c8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01059cb:	8b 7d 10             	mov    0x10(%ebp),%edi
+f01059ce:	89 78 78             	mov    %edi,0x78(%eax)
+    return 0;
+f01059d1:	e9 e0 fa ff ff       	jmp    f01054b6 <syscall+0x70>
+        return -E_BAD_ENV;
+f01059d6:	bb fe ff ff ff       	mov    $0xfffffffe,%ebx
+            break;
+f01059db:	e9 d6 fa ff ff       	jmp    f01054b6 <syscall+0x70>
+    if ((uintptr_t) dstva < UTOP && PGOFF(dstva))
+f01059e0:	81 7d 0c ff ff bf ee 	cmpl   $0xeebfffff,0xc(%ebp)
+f01059e7:	0f 87 5b 03 00 00    	ja     f0105d48 <syscall+0x902>
+f01059ed:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+f01059f4:	0f 84 fd 02 00 00    	je     f0105cf7 <syscall+0x8b1>
+            r = sys_ipc_recv((void *) a1);
+f01059fa:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+    return r;
+f01059ff:	e9 b2 fa ff ff       	jmp    f01054b6 <syscall+0x70>
+    spin_lock(&vm_lock);
+f0105a04:	83 ec 0c             	sub    $0xc,%esp
+f0105a07:	68 60 64 11 f0       	push   $0xf0116460
+f0105a0c:	e8 d9 17 00 00       	call   f01071ea <spin_lock>
+    if (envid2env(envid, &env, 0)) {
+f0105a11:	83 c4 0c             	add    $0xc,%esp
+f0105a14:	6a 00                	push   $0x0
+f0105a16:	8d 45 e0             	lea    -0x20(%ebp),%eax
+f0105a19:	50                   	push   %eax
+f0105a1a:	ff 75 0c             	push   0xc(%ebp)
+f0105a1d:	e8 e6 da ff ff       	call   f0103508 <envid2env>
+f0105a22:	89 c3                	mov    %eax,%ebx
+f0105a24:	83 c4 10             	add    $0x10,%esp
+f0105a27:	85 c0                	test   %eax,%eax
+f0105a29:	75 5f                	jne    f0105a8a <syscall+0x644>
+    spin_lock(&env_lock);
+f0105a2b:	83 ec 0c             	sub    $0xc,%esp
+f0105a2e:	68 a0 65 11 f0       	push   $0xf01165a0
+f0105a33:	e8 b2 17 00 00       	call   f01071ea <spin_lock>
+    if (!env->env_ipc_recving) {
+f0105a38:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0105a3b:	0f b6 70 7c          	movzbl 0x7c(%eax),%esi
+f0105a3f:	83 c4 10             	add    $0x10,%esp
+f0105a42:	89 f1                	mov    %esi,%ecx
+f0105a44:	84 c9                	test   %cl,%cl
+f0105a46:	0f 84 72 01 00 00    	je     f0105bbe <syscall+0x778>
+    bool send_page = (uintptr_t) srcva < UTOP && env->env_ipc_dstva;
+f0105a4c:	81 7d 14 ff ff bf ee 	cmpl   $0xeebfffff,0x14(%ebp)
+f0105a53:	0f 87 e5 00 00 00    	ja     f0105b3e <syscall+0x6f8>
+f0105a59:	83 b8 80 00 00 00 00 	cmpl   $0x0,0x80(%eax)
+f0105a60:	0f 84 51 01 00 00    	je     f0105bb7 <syscall+0x771>
+        if (PGOFF(srcva))
+f0105a66:	f7 45 14 ff 0f 00 00 	testl  $0xfff,0x14(%ebp)
+f0105a6d:	0f 85 52 01 00 00    	jne    f0105bc5 <syscall+0x77f>
+        if ((perm & (PTE_U | PTE_P)) != (PTE_U | PTE_P) || perm & (~PTE_SYSCALL))
+f0105a73:	8b 45 18             	mov    0x18(%ebp),%eax
+f0105a76:	25 fd f1 ff ff       	and    $0xfffff1fd,%eax
+f0105a7b:	83 f8 05             	cmp    $0x5,%eax
+f0105a7e:	74 24                	je     f0105aa4 <syscall+0x65e>
+    r = -E_INVAL;
+f0105a80:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f0105a85:	e9 0c 01 00 00       	jmp    f0105b96 <syscall+0x750>
+        spin_unlock(&vm_lock);
+f0105a8a:	83 ec 0c             	sub    $0xc,%esp
+f0105a8d:	68 60 64 11 f0       	push   $0xf0116460
+f0105a92:	e8 4b 18 00 00       	call   f01072e2 <spin_unlock>
+        return -E_BAD_ENV;
+f0105a97:	83 c4 10             	add    $0x10,%esp
+f0105a9a:	bb fe ff ff ff       	mov    $0xfffffffe,%ebx
+f0105a9f:	e9 12 fa ff ff       	jmp    f01054b6 <syscall+0x70>
+f0105aa4:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+        if (!(pp = page_lookup(curenv->env_pgdir, srcva, &pte)))
+f0105aaa:	83 ec 04             	sub    $0x4,%esp
+f0105aad:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+f0105ab0:	52                   	push   %edx
+f0105ab1:	ff 75 14             	push   0x14(%ebp)
+f0105ab4:	8b 40 0c             	mov    0xc(%eax),%eax
+f0105ab7:	ff 70 70             	push   0x70(%eax)
+f0105aba:	e8 ab b8 ff ff       	call   f010136a <page_lookup>
+f0105abf:	89 c7                	mov    %eax,%edi
+f0105ac1:	83 c4 10             	add    $0x10,%esp
+f0105ac4:	85 c0                	test   %eax,%eax
+f0105ac6:	0f 84 00 01 00 00    	je     f0105bcc <syscall+0x786>
+        if ((perm & PTE_W) && !(*pte & PTE_W))
+f0105acc:	f6 45 18 02          	testb  $0x2,0x18(%ebp)
+f0105ad0:	74 0c                	je     f0105ade <syscall+0x698>
+f0105ad2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0105ad5:	f6 00 02             	testb  $0x2,(%eax)
+f0105ad8:	0f 84 f5 00 00 00    	je     f0105bd3 <syscall+0x78d>
+        if (page_insert(env->env_pgdir, pp, env->env_ipc_dstva, perm))
+f0105ade:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0105ae1:	ff 75 18             	push   0x18(%ebp)
+f0105ae4:	ff b0 80 00 00 00    	push   0x80(%eax)
+f0105aea:	57                   	push   %edi
+f0105aeb:	ff 70 70             	push   0x70(%eax)
+f0105aee:	e8 4a b9 ff ff       	call   f010143d <page_insert>
+f0105af3:	83 c4 10             	add    $0x10,%esp
+f0105af6:	85 c0                	test   %eax,%eax
+f0105af8:	74 0a                	je     f0105b04 <syscall+0x6be>
+        r = -E_NO_MEM;
+f0105afa:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+f0105aff:	e9 92 00 00 00       	jmp    f0105b96 <syscall+0x750>
+        if (page_insert(env->env_kern_pgdir, pp, env->env_ipc_dstva, perm)) {
+f0105b04:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0105b07:	ff 75 18             	push   0x18(%ebp)
+f0105b0a:	ff b0 80 00 00 00    	push   0x80(%eax)
+f0105b10:	57                   	push   %edi
+f0105b11:	ff 70 74             	push   0x74(%eax)
+f0105b14:	e8 24 b9 ff ff       	call   f010143d <page_insert>
+f0105b19:	83 c4 10             	add    $0x10,%esp
+f0105b1c:	85 c0                	test   %eax,%eax
+f0105b1e:	74 23                	je     f0105b43 <syscall+0x6fd>
+            page_remove(env->env_pgdir, env->env_ipc_dstva);
+f0105b20:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0105b23:	83 ec 08             	sub    $0x8,%esp
+f0105b26:	ff b0 80 00 00 00    	push   0x80(%eax)
+f0105b2c:	ff 70 70             	push   0x70(%eax)
+f0105b2f:	e8 bc b8 ff ff       	call   f01013f0 <page_remove>
+            goto out;
+f0105b34:	83 c4 10             	add    $0x10,%esp
+        r = -E_NO_MEM;
+f0105b37:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+            goto out;
+f0105b3c:	eb 58                	jmp    f0105b96 <syscall+0x750>
+    bool send_page = (uintptr_t) srcva < UTOP && env->env_ipc_dstva;
+f0105b3e:	be 00 00 00 00       	mov    $0x0,%esi
+    env->env_ipc_recving = 0;
+f0105b43:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0105b46:	c6 40 7c 00          	movb   $0x0,0x7c(%eax)
+f0105b4a:	65 8b 15 00 00 00 00 	mov    %gs:0x0,%edx
+    env->env_ipc_from = curenv->env_id;
+f0105b51:	8b 52 0c             	mov    0xc(%edx),%edx
+f0105b54:	8b 52 48             	mov    0x48(%edx),%edx
+f0105b57:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+    env->env_ipc_value = value;
+f0105b5d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+f0105b60:	89 88 84 00 00 00    	mov    %ecx,0x84(%eax)
+    env->env_ipc_perm = send_page ? perm : 0;
+f0105b66:	89 f1                	mov    %esi,%ecx
+f0105b68:	84 c9                	test   %cl,%cl
+f0105b6a:	ba 00 00 00 00       	mov    $0x0,%edx
+f0105b6f:	0f 45 55 18          	cmovne 0x18(%ebp),%edx
+f0105b73:	89 55 18             	mov    %edx,0x18(%ebp)
+f0105b76:	89 90 8c 00 00 00    	mov    %edx,0x8c(%eax)
+    env->env_tf.tf_regs.reg_eax = 0;
+f0105b7c:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+    env->env_status = ENV_RUNNABLE;
+f0105b83:	c7 40 54 02 00 00 00 	movl   $0x2,0x54(%eax)
+    sched_enqueue(env);
+f0105b8a:	83 ec 0c             	sub    $0xc,%esp
+f0105b8d:	50                   	push   %eax
+f0105b8e:	e8 e7 f4 ff ff       	call   f010507a <sched_enqueue>
+f0105b93:	83 c4 10             	add    $0x10,%esp
+    spin_unlock(&env_lock);
+f0105b96:	83 ec 0c             	sub    $0xc,%esp
+f0105b99:	68 a0 65 11 f0       	push   $0xf01165a0
+f0105b9e:	e8 3f 17 00 00       	call   f01072e2 <spin_unlock>
+    spin_unlock(&vm_lock);
+f0105ba3:	c7 04 24 60 64 11 f0 	movl   $0xf0116460,(%esp)
+f0105baa:	e8 33 17 00 00       	call   f01072e2 <spin_unlock>
+    return r;
+f0105baf:	83 c4 10             	add    $0x10,%esp
+            break;
+f0105bb2:	e9 ff f8 ff ff       	jmp    f01054b6 <syscall+0x70>
+    bool send_page = (uintptr_t) srcva < UTOP && env->env_ipc_dstva;
+f0105bb7:	be 00 00 00 00       	mov    $0x0,%esi
+f0105bbc:	eb 85                	jmp    f0105b43 <syscall+0x6fd>
+        r = -E_IPC_NOT_RECV;
+f0105bbe:	bb f9 ff ff ff       	mov    $0xfffffff9,%ebx
+f0105bc3:	eb d1                	jmp    f0105b96 <syscall+0x750>
+    r = -E_INVAL;
+f0105bc5:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f0105bca:	eb ca                	jmp    f0105b96 <syscall+0x750>
+f0105bcc:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f0105bd1:	eb c3                	jmp    f0105b96 <syscall+0x750>
+f0105bd3:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f0105bd8:	eb bc                	jmp    f0105b96 <syscall+0x750>
+            r = sys_env_set_trapframe(a1, (struct Trapframe *) a2);
+f0105bda:	8b 75 10             	mov    0x10(%ebp),%esi
+    if (envid2env(envid, &e, 1))
+f0105bdd:	83 ec 04             	sub    $0x4,%esp
+f0105be0:	6a 01                	push   $0x1
+f0105be2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0105be5:	50                   	push   %eax
+f0105be6:	ff 75 0c             	push   0xc(%ebp)
+f0105be9:	e8 1a d9 ff ff       	call   f0103508 <envid2env>
+f0105bee:	89 c3                	mov    %eax,%ebx
+f0105bf0:	83 c4 10             	add    $0x10,%esp
+f0105bf3:	85 c0                	test   %eax,%eax
+f0105bf5:	75 35                	jne    f0105c2c <syscall+0x7e6>
+f0105bf7:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+    user_mem_assert(curenv, tf, sizeof(struct Trapframe), 0);
+f0105bfd:	6a 00                	push   $0x0
+f0105bff:	6a 44                	push   $0x44
+f0105c01:	ff 75 10             	push   0x10(%ebp)
+f0105c04:	ff 70 0c             	push   0xc(%eax)
+f0105c07:	e8 32 d6 ff ff       	call   f010323e <user_mem_assert>
+    e->env_tf = *tf;
+f0105c0c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0105c0f:	b9 11 00 00 00       	mov    $0x11,%ecx
+f0105c14:	89 c7                	mov    %eax,%edi
+f0105c16:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    e->env_tf.tf_cs |= 3;
+f0105c18:	66 83 48 34 03       	orw    $0x3,0x34(%eax)
+    e->env_tf.tf_eflags |= FL_IF;
+f0105c1d:	81 48 38 00 02 00 00 	orl    $0x200,0x38(%eax)
+    return 0;
+f0105c24:	83 c4 10             	add    $0x10,%esp
+f0105c27:	e9 8a f8 ff ff       	jmp    f01054b6 <syscall+0x70>
+        return -E_BAD_ENV;
+f0105c2c:	bb fe ff ff ff       	mov    $0xfffffffe,%ebx
+            break;
+f0105c31:	e9 80 f8 ff ff       	jmp    f01054b6 <syscall+0x70>
+    return time_msec();
+f0105c36:	e8 42 21 00 00       	call   f0107d7d <time_msec>
+f0105c3b:	89 c3                	mov    %eax,%ebx
+            break;
+f0105c3d:	e9 74 f8 ff ff       	jmp    f01054b6 <syscall+0x70>
+            r = sys_net_send((const void *) a1, a2);
+f0105c42:	83 ec 08             	sub    $0x8,%esp
+f0105c45:	ff 75 10             	push   0x10(%ebp)
+f0105c48:	ff 75 0c             	push   0xc(%ebp)
+f0105c4b:	e8 52 f7 ff ff       	call   f01053a2 <sys_net_send>
+f0105c50:	89 c3                	mov    %eax,%ebx
+            break;
+f0105c52:	83 c4 10             	add    $0x10,%esp
+f0105c55:	e9 5c f8 ff ff       	jmp    f01054b6 <syscall+0x70>
+            r = sys_net_recv((void *) a1, a2);
+f0105c5a:	83 ec 08             	sub    $0x8,%esp
+f0105c5d:	ff 75 10             	push   0x10(%ebp)
+f0105c60:	ff 75 0c             	push   0xc(%ebp)
+f0105c63:	e8 68 f7 ff ff       	call   f01053d0 <sys_net_recv>
+f0105c68:	89 c3                	mov    %eax,%ebx
+            break;
+f0105c6a:	83 c4 10             	add    $0x10,%esp
+f0105c6d:	e9 44 f8 ff ff       	jmp    f01054b6 <syscall+0x70>
+            r = sys_sleep(a1);
+f0105c72:	83 ec 0c             	sub    $0xc,%esp
+f0105c75:	ff 75 0c             	push   0xc(%ebp)
+f0105c78:	e8 81 f7 ff ff       	call   f01053fe <sys_sleep>
+f0105c7d:	89 c3                	mov    %eax,%ebx
+            break;
+f0105c7f:	83 c4 10             	add    $0x10,%esp
+f0105c82:	e9 2f f8 ff ff       	jmp    f01054b6 <syscall+0x70>
+f0105c87:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+    user_mem_assert(curenv, macaddr, MACADDR_SIZE, PTE_W);
+f0105c8d:	6a 02                	push   $0x2
+f0105c8f:	6a 06                	push   $0x6
+f0105c91:	ff 75 0c             	push   0xc(%ebp)
+f0105c94:	ff 70 0c             	push   0xc(%eax)
+f0105c97:	e8 a2 d5 ff ff       	call   f010323e <user_mem_assert>
+    memmove(macaddr, e1000_macaddr, MACADDR_SIZE);
+f0105c9c:	83 c4 0c             	add    $0xc,%esp
+f0105c9f:	6a 06                	push   $0x6
+f0105ca1:	68 c0 a0 6a f0       	push   $0xf06aa0c0
+f0105ca6:	ff 75 0c             	push   0xc(%ebp)
+f0105ca9:	e8 82 0c 00 00       	call   f0106930 <memmove>
+            break;
+f0105cae:	83 c4 10             	add    $0x10,%esp
+            r = sys_net_get_macaddr((char *) a1);
+f0105cb1:	bb 00 00 00 00       	mov    $0x0,%ebx
+            break;
+f0105cb6:	e9 fb f7 ff ff       	jmp    f01054b6 <syscall+0x70>
+    switch (syscallno) {
+f0105cbb:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f0105cc0:	e9 f1 f7 ff ff       	jmp    f01054b6 <syscall+0x70>
+        return E_INVAL;
+f0105cc5:	bb 03 00 00 00       	mov    $0x3,%ebx
+f0105cca:	e9 e7 f7 ff ff       	jmp    f01054b6 <syscall+0x70>
+        return -E_INVAL;
+f0105ccf:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f0105cd4:	e9 dd f7 ff ff       	jmp    f01054b6 <syscall+0x70>
+f0105cd9:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f0105cde:	e9 d3 f7 ff ff       	jmp    f01054b6 <syscall+0x70>
+f0105ce3:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f0105ce8:	e9 c9 f7 ff ff       	jmp    f01054b6 <syscall+0x70>
+f0105ced:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f0105cf2:	e9 bf f7 ff ff       	jmp    f01054b6 <syscall+0x70>
+    spin_lock(&env_lock);
+f0105cf7:	83 ec 0c             	sub    $0xc,%esp
+f0105cfa:	68 a0 65 11 f0       	push   $0xf01165a0
+f0105cff:	e8 e6 14 00 00       	call   f01071ea <spin_lock>
+f0105d04:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+        curenv->env_ipc_dstva = dstva;
+f0105d0a:	8b 40 0c             	mov    0xc(%eax),%eax
+f0105d0d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+f0105d10:	89 b8 80 00 00 00    	mov    %edi,0x80(%eax)
+f0105d16:	83 c4 10             	add    $0x10,%esp
+f0105d19:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+    curenv->env_ipc_recving = 1;
+f0105d1f:	8b 40 0c             	mov    0xc(%eax),%eax
+f0105d22:	c6 40 7c 01          	movb   $0x1,0x7c(%eax)
+f0105d26:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+    curenv->env_status = ENV_NOT_RUNNABLE;
+f0105d2c:	8b 40 0c             	mov    0xc(%eax),%eax
+f0105d2f:	c7 40 54 04 00 00 00 	movl   $0x4,0x54(%eax)
+    spin_unlock(&env_lock);
+f0105d36:	83 ec 0c             	sub    $0xc,%esp
+f0105d39:	68 a0 65 11 f0       	push   $0xf01165a0
+f0105d3e:	e8 9f 15 00 00       	call   f01072e2 <spin_unlock>
+    sched_yield();
+f0105d43:	e8 43 f5 ff ff       	call   f010528b <sched_yield>
+    spin_lock(&env_lock);
+f0105d48:	83 ec 0c             	sub    $0xc,%esp
+f0105d4b:	68 a0 65 11 f0       	push   $0xf01165a0
+f0105d50:	e8 95 14 00 00       	call   f01071ea <spin_lock>
+f0105d55:	83 c4 10             	add    $0x10,%esp
+f0105d58:	eb bf                	jmp    f0105d19 <syscall+0x8d3>
+
+f0105d5a <stab_binsearch>:
+//	will exit setting left = 118, right = 554.
+//
+static void
+stab_binsearch(const struct Stab *stabs, int *region_left, int *region_right,
+	       int type, uintptr_t addr)
+{
+f0105d5a:	55                   	push   %ebp
+f0105d5b:	89 e5                	mov    %esp,%ebp
+f0105d5d:	57                   	push   %edi
+f0105d5e:	56                   	push   %esi
+f0105d5f:	53                   	push   %ebx
+f0105d60:	83 ec 14             	sub    $0x14,%esp
+f0105d63:	89 45 f0             	mov    %eax,-0x10(%ebp)
+f0105d66:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+f0105d69:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	int l = *region_left, r = *region_right, any_matches = 0;
+f0105d6c:	8b 1a                	mov    (%edx),%ebx
+f0105d6e:	8b 09                	mov    (%ecx),%ecx
+f0105d70:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+
+	while (l <= r) {
+f0105d77:	eb 4f                	jmp    f0105dc8 <stab_binsearch+0x6e>
+		int true_m = (l + r) / 2, m = true_m;
+
+		// search for earliest stab with right type
+		while (m >= l && stabs[m].n_type != type)
+			m--;
+f0105d79:	83 e8 01             	sub    $0x1,%eax
+		while (m >= l && stabs[m].n_type != type)
+f0105d7c:	39 c3                	cmp    %eax,%ebx
+f0105d7e:	0f 8f cc 00 00 00    	jg     f0105e50 <stab_binsearch+0xf6>
+f0105d84:	0f b6 0a             	movzbl (%edx),%ecx
+f0105d87:	83 ea 0c             	sub    $0xc,%edx
+f0105d8a:	39 f1                	cmp    %esi,%ecx
+f0105d8c:	75 eb                	jne    f0105d79 <stab_binsearch+0x1f>
+f0105d8e:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+f0105d91:	89 75 08             	mov    %esi,0x8(%ebp)
+			continue;
+		}
+
+		// actual binary search
+		any_matches = 1;
+		if (stabs[m].n_value < addr) {
+f0105d94:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f0105d97:	8b 75 f0             	mov    -0x10(%ebp),%esi
+f0105d9a:	8b 54 96 08          	mov    0x8(%esi,%edx,4),%edx
+f0105d9e:	3b 55 0c             	cmp    0xc(%ebp),%edx
+f0105da1:	72 16                	jb     f0105db9 <stab_binsearch+0x5f>
+			*region_left = m;
+			l = true_m + 1;
+		} else if (stabs[m].n_value > addr) {
+f0105da3:	39 55 0c             	cmp    %edx,0xc(%ebp)
+f0105da6:	73 48                	jae    f0105df0 <stab_binsearch+0x96>
+			*region_right = m - 1;
+f0105da8:	8d 48 ff             	lea    -0x1(%eax),%ecx
+f0105dab:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0105dae:	89 08                	mov    %ecx,(%eax)
+		any_matches = 1;
+f0105db0:	c7 45 e8 01 00 00 00 	movl   $0x1,-0x18(%ebp)
+f0105db7:	eb 0f                	jmp    f0105dc8 <stab_binsearch+0x6e>
+			*region_left = m;
+f0105db9:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+f0105dbc:	89 06                	mov    %eax,(%esi)
+			l = true_m + 1;
+f0105dbe:	8d 5f 01             	lea    0x1(%edi),%ebx
+		any_matches = 1;
+f0105dc1:	c7 45 e8 01 00 00 00 	movl   $0x1,-0x18(%ebp)
+	while (l <= r) {
+f0105dc8:	39 cb                	cmp    %ecx,%ebx
+f0105dca:	7f 38                	jg     f0105e04 <stab_binsearch+0xaa>
+		int true_m = (l + r) / 2, m = true_m;
+f0105dcc:	8d 04 0b             	lea    (%ebx,%ecx,1),%eax
+f0105dcf:	89 c2                	mov    %eax,%edx
+f0105dd1:	c1 ea 1f             	shr    $0x1f,%edx
+f0105dd4:	01 d0                	add    %edx,%eax
+f0105dd6:	89 c7                	mov    %eax,%edi
+f0105dd8:	d1 ff                	sar    %edi
+		while (m >= l && stabs[m].n_type != type)
+f0105dda:	83 e0 fe             	and    $0xfffffffe,%eax
+f0105ddd:	01 f8                	add    %edi,%eax
+f0105ddf:	8b 55 f0             	mov    -0x10(%ebp),%edx
+f0105de2:	8d 54 82 04          	lea    0x4(%edx,%eax,4),%edx
+		int true_m = (l + r) / 2, m = true_m;
+f0105de6:	89 f8                	mov    %edi,%eax
+f0105de8:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+f0105deb:	8b 75 08             	mov    0x8(%ebp),%esi
+		while (m >= l && stabs[m].n_type != type)
+f0105dee:	eb 8c                	jmp    f0105d7c <stab_binsearch+0x22>
+			r = m - 1;
+		} else {
+			// exact match for 'addr', but continue loop to find
+			// *region_right
+			*region_left = m;
+f0105df0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0105df3:	89 07                	mov    %eax,(%edi)
+			l = m;
+			addr++;
+f0105df5:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+f0105df9:	89 c3                	mov    %eax,%ebx
+		any_matches = 1;
+f0105dfb:	c7 45 e8 01 00 00 00 	movl   $0x1,-0x18(%ebp)
+f0105e02:	eb c4                	jmp    f0105dc8 <stab_binsearch+0x6e>
+		}
+	}
+
+	if (!any_matches)
+f0105e04:	8b 75 08             	mov    0x8(%ebp),%esi
+f0105e07:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+f0105e0b:	75 15                	jne    f0105e22 <stab_binsearch+0xc8>
+		*region_right = *region_left - 1;
+f0105e0d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0105e10:	8b 00                	mov    (%eax),%eax
+f0105e12:	83 e8 01             	sub    $0x1,%eax
+f0105e15:	8b 7d e0             	mov    -0x20(%ebp),%edi
+f0105e18:	89 07                	mov    %eax,(%edi)
+		     l > *region_left && stabs[l].n_type != type;
+		     l--)
+			/* do nothing */;
+		*region_left = l;
+	}
+}
+f0105e1a:	83 c4 14             	add    $0x14,%esp
+f0105e1d:	5b                   	pop    %ebx
+f0105e1e:	5e                   	pop    %esi
+f0105e1f:	5f                   	pop    %edi
+f0105e20:	5d                   	pop    %ebp
+f0105e21:	c3                   	ret
+		for (l = *region_right;
+f0105e22:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0105e25:	8b 00                	mov    (%eax),%eax
+		     l > *region_left && stabs[l].n_type != type;
+f0105e27:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0105e2a:	8b 0f                	mov    (%edi),%ecx
+f0105e2c:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f0105e2f:	8b 7d f0             	mov    -0x10(%ebp),%edi
+f0105e32:	8d 54 97 04          	lea    0x4(%edi,%edx,4),%edx
+f0105e36:	39 c1                	cmp    %eax,%ecx
+f0105e38:	7d 0f                	jge    f0105e49 <stab_binsearch+0xef>
+f0105e3a:	0f b6 1a             	movzbl (%edx),%ebx
+f0105e3d:	83 ea 0c             	sub    $0xc,%edx
+f0105e40:	39 f3                	cmp    %esi,%ebx
+f0105e42:	74 05                	je     f0105e49 <stab_binsearch+0xef>
+		     l--)
+f0105e44:	83 e8 01             	sub    $0x1,%eax
+f0105e47:	eb ed                	jmp    f0105e36 <stab_binsearch+0xdc>
+		*region_left = l;
+f0105e49:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0105e4c:	89 07                	mov    %eax,(%edi)
+}
+f0105e4e:	eb ca                	jmp    f0105e1a <stab_binsearch+0xc0>
+			l = true_m + 1;
+f0105e50:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+f0105e53:	89 75 08             	mov    %esi,0x8(%ebp)
+f0105e56:	8d 5f 01             	lea    0x1(%edi),%ebx
+			continue;
+f0105e59:	e9 6a ff ff ff       	jmp    f0105dc8 <stab_binsearch+0x6e>
+
+f0105e5e <debuginfo_eip>:
+//	negative if not.  But even if it returns negative it has stored some
+//	information into '*info'.
+//
+int
+debuginfo_eip(uintptr_t addr, struct Eipdebuginfo *info)
+{
+f0105e5e:	55                   	push   %ebp
+f0105e5f:	89 e5                	mov    %esp,%ebp
+f0105e61:	57                   	push   %edi
+f0105e62:	56                   	push   %esi
+f0105e63:	53                   	push   %ebx
+f0105e64:	83 ec 3c             	sub    $0x3c,%esp
+	const struct Stab *stabs, *stab_end;
+	const char *stabstr, *stabstr_end;
+	int lfile, rfile, lfun, rfun, lline, rline;
+
+	// Initialize *info
+	info->eip_file = "<unknown>";
+f0105e67:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0105e6a:	c7 00 f4 9c 10 f0    	movl   $0xf0109cf4,(%eax)
+	info->eip_line = 0;
+f0105e70:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	info->eip_fn_name = "<unknown>";
+f0105e77:	c7 40 08 f4 9c 10 f0 	movl   $0xf0109cf4,0x8(%eax)
+	info->eip_fn_namelen = 9;
+f0105e7e:	c7 40 0c 09 00 00 00 	movl   $0x9,0xc(%eax)
+	info->eip_fn_addr = addr;
+f0105e85:	8b 7d 08             	mov    0x8(%ebp),%edi
+f0105e88:	89 78 10             	mov    %edi,0x10(%eax)
+	info->eip_fn_narg = 0;
+f0105e8b:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+
+	// Find the relevant set of stabs
+	if (addr >= ULIM) {
+f0105e92:	81 ff ff ff 7f ef    	cmp    $0xef7fffff,%edi
+f0105e98:	0f 86 29 01 00 00    	jbe    f0105fc7 <debuginfo_eip+0x169>
+		stabs = __STAB_BEGIN__;
+		stab_end = __STAB_END__;
+		stabstr = __STABSTR_BEGIN__;
+		stabstr_end = __STABSTR_END__;
+f0105e9e:	c7 45 c4 14 a5 10 f0 	movl   $0xf010a514,-0x3c(%ebp)
+		stabstr = __STABSTR_BEGIN__;
+f0105ea5:	c7 45 c0 14 a5 10 f0 	movl   $0xf010a514,-0x40(%ebp)
+		stab_end = __STAB_END__;
+f0105eac:	be 13 a5 10 f0       	mov    $0xf010a513,%esi
+		stabs = __STAB_BEGIN__;
+f0105eb1:	bf 13 a5 10 f0       	mov    $0xf010a513,%edi
+        || user_mem_check(curenv, stabstr, stabstr_end-stabstr, PTE_U) < 0)
+      return -1;
+	}
+
+	// String table validity checks
+	if (stabstr_end <= stabstr || stabstr_end[-1] != 0)
+f0105eb6:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+f0105eb9:	39 4d c0             	cmp    %ecx,-0x40(%ebp)
+f0105ebc:	0f 83 2c 02 00 00    	jae    f01060ee <debuginfo_eip+0x290>
+f0105ec2:	80 79 ff 00          	cmpb   $0x0,-0x1(%ecx)
+f0105ec6:	0f 85 29 02 00 00    	jne    f01060f5 <debuginfo_eip+0x297>
+	// 'eip'.  First, we find the basic source file containing 'eip'.
+	// Then, we look in that source file for the function.  Then we look
+	// for the line number.
+
+	// Search the entire set of stabs for the source file (type N_SO).
+	lfile = 0;
+f0105ecc:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	rfile = (stab_end - stabs) - 1;
+f0105ed3:	29 fe                	sub    %edi,%esi
+f0105ed5:	c1 fe 02             	sar    $0x2,%esi
+f0105ed8:	69 c6 ab aa aa aa    	imul   $0xaaaaaaab,%esi,%eax
+f0105ede:	83 e8 01             	sub    $0x1,%eax
+f0105ee1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	stab_binsearch(stabs, &lfile, &rfile, N_SO, addr);
+f0105ee4:	83 ec 08             	sub    $0x8,%esp
+f0105ee7:	ff 75 08             	push   0x8(%ebp)
+f0105eea:	6a 64                	push   $0x64
+f0105eec:	8d 45 e0             	lea    -0x20(%ebp),%eax
+f0105eef:	89 c1                	mov    %eax,%ecx
+f0105ef1:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+f0105ef4:	89 f8                	mov    %edi,%eax
+f0105ef6:	e8 5f fe ff ff       	call   f0105d5a <stab_binsearch>
+	if (lfile == 0)
+f0105efb:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+f0105efe:	83 c4 10             	add    $0x10,%esp
+f0105f01:	85 f6                	test   %esi,%esi
+f0105f03:	0f 84 f3 01 00 00    	je     f01060fc <debuginfo_eip+0x29e>
+		return -1;
+
+	// Search within that file's stabs for the function definition
+	// (N_FUN).
+	lfun = lfile;
+f0105f09:	89 75 dc             	mov    %esi,-0x24(%ebp)
+	rfun = rfile;
+f0105f0c:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+f0105f0f:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+	stab_binsearch(stabs, &lfun, &rfun, N_FUN, addr);
+f0105f12:	83 ec 08             	sub    $0x8,%esp
+f0105f15:	ff 75 08             	push   0x8(%ebp)
+f0105f18:	6a 24                	push   $0x24
+f0105f1a:	8d 45 d8             	lea    -0x28(%ebp),%eax
+f0105f1d:	89 c1                	mov    %eax,%ecx
+f0105f1f:	8d 55 dc             	lea    -0x24(%ebp),%edx
+f0105f22:	89 f8                	mov    %edi,%eax
+f0105f24:	e8 31 fe ff ff       	call   f0105d5a <stab_binsearch>
+
+	if (lfun <= rfun) {
+f0105f29:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f0105f2c:	89 45 bc             	mov    %eax,-0x44(%ebp)
+f0105f2f:	8b 55 d8             	mov    -0x28(%ebp),%edx
+f0105f32:	89 55 b8             	mov    %edx,-0x48(%ebp)
+f0105f35:	83 c4 10             	add    $0x10,%esp
+f0105f38:	39 d0                	cmp    %edx,%eax
+f0105f3a:	0f 8f 1e 01 00 00    	jg     f010605e <debuginfo_eip+0x200>
+		// stabs[lfun] points to the function name
+		// in the string table, but check bounds just in case.
+		if (stabs[lfun].n_strx < stabstr_end - stabstr)
+f0105f40:	8d 04 40             	lea    (%eax,%eax,2),%eax
+f0105f43:	8d 14 87             	lea    (%edi,%eax,4),%edx
+f0105f46:	8b 02                	mov    (%edx),%eax
+f0105f48:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+f0105f4b:	8b 5d c0             	mov    -0x40(%ebp),%ebx
+f0105f4e:	29 d9                	sub    %ebx,%ecx
+f0105f50:	39 c8                	cmp    %ecx,%eax
+f0105f52:	73 08                	jae    f0105f5c <debuginfo_eip+0xfe>
+			info->eip_fn_name = stabstr + stabs[lfun].n_strx;
+f0105f54:	01 d8                	add    %ebx,%eax
+f0105f56:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f0105f59:	89 43 08             	mov    %eax,0x8(%ebx)
+		info->eip_fn_addr = stabs[lfun].n_value;
+f0105f5c:	8b 42 08             	mov    0x8(%edx),%eax
+		addr -= info->eip_fn_addr;
+f0105f5f:	29 45 08             	sub    %eax,0x8(%ebp)
+		// Search within the function definition for the line number.
+		lline = lfun;
+		rline = rfun;
+f0105f62:	8b 55 bc             	mov    -0x44(%ebp),%edx
+f0105f65:	8b 5d b8             	mov    -0x48(%ebp),%ebx
+		info->eip_fn_addr = stabs[lfun].n_value;
+f0105f68:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f0105f6b:	89 41 10             	mov    %eax,0x10(%ecx)
+		lline = lfun;
+f0105f6e:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+		rline = rfun;
+f0105f71:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+		info->eip_fn_addr = addr;
+		lline = lfile;
+		rline = rfile;
+	}
+	// Ignore stuff after the colon.
+	info->eip_fn_namelen = strfind(info->eip_fn_name, ':') - info->eip_fn_name;
+f0105f74:	83 ec 08             	sub    $0x8,%esp
+f0105f77:	6a 3a                	push   $0x3a
+f0105f79:	ff 71 08             	push   0x8(%ecx)
+f0105f7c:	e8 5e 09 00 00       	call   f01068df <strfind>
+f0105f81:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f0105f84:	2b 43 08             	sub    0x8(%ebx),%eax
+f0105f87:	89 43 0c             	mov    %eax,0xc(%ebx)
+	// Hint:
+	//	There's a particular stabs type used for line numbers.
+	//	Look at the STABS documentation and <inc/stab.h> to find
+	//	which one.
+	// Your code here.
+  stab_binsearch(stabs, &lline, &rline, N_SLINE, addr);
+f0105f8a:	83 c4 08             	add    $0x8,%esp
+f0105f8d:	ff 75 08             	push   0x8(%ebp)
+f0105f90:	6a 44                	push   $0x44
+f0105f92:	8d 4d d0             	lea    -0x30(%ebp),%ecx
+f0105f95:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+f0105f98:	89 f8                	mov    %edi,%eax
+f0105f9a:	e8 bb fd ff ff       	call   f0105d5a <stab_binsearch>
+  if (lline <= rline)
+f0105f9f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0105fa2:	83 c4 10             	add    $0x10,%esp
+f0105fa5:	3b 45 d0             	cmp    -0x30(%ebp),%eax
+f0105fa8:	0f 8f 55 01 00 00    	jg     f0106103 <debuginfo_eip+0x2a5>
+    info->eip_line = stabs[lline].n_desc;
+f0105fae:	89 c2                	mov    %eax,%edx
+f0105fb0:	8d 04 40             	lea    (%eax,%eax,2),%eax
+f0105fb3:	0f b7 4c 87 06       	movzwl 0x6(%edi,%eax,4),%ecx
+f0105fb8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f0105fbb:	89 4b 04             	mov    %ecx,0x4(%ebx)
+	// Search backwards from the line number for the relevant filename
+	// stab.
+	// We can't just use the "lfile" stab because inlined functions
+	// can interpolate code from a different file!
+	// Such included source files use the N_SOL stab type.
+	while (lline >= lfile
+f0105fbe:	8d 44 87 04          	lea    0x4(%edi,%eax,4),%eax
+f0105fc2:	e9 a7 00 00 00       	jmp    f010606e <debuginfo_eip+0x210>
+		stabs = usd->stabs;
+f0105fc7:	8b 3d 00 00 20 00    	mov    0x200000,%edi
+		stab_end = usd->stab_end;
+f0105fcd:	8b 35 04 00 20 00    	mov    0x200004,%esi
+		stabstr = usd->stabstr;
+f0105fd3:	8b 1d 08 00 20 00    	mov    0x200008,%ebx
+f0105fd9:	89 5d c0             	mov    %ebx,-0x40(%ebp)
+		stabstr_end = usd->stabstr_end;
+f0105fdc:	8b 15 0c 00 20 00    	mov    0x20000c,%edx
+f0105fe2:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+f0105fe5:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+    if (user_mem_check(curenv, usd, sizeof(struct UserStabData), PTE_U) < 0
+f0105feb:	6a 04                	push   $0x4
+f0105fed:	6a 10                	push   $0x10
+f0105fef:	68 00 00 20 00       	push   $0x200000
+f0105ff4:	ff 70 0c             	push   0xc(%eax)
+f0105ff7:	e8 ae d1 ff ff       	call   f01031aa <user_mem_check>
+f0105ffc:	83 c4 10             	add    $0x10,%esp
+f0105fff:	85 c0                	test   %eax,%eax
+f0106001:	0f 88 d9 00 00 00    	js     f01060e0 <debuginfo_eip+0x282>
+f0106007:	65 8b 15 00 00 00 00 	mov    %gs:0x0,%edx
+        || user_mem_check(curenv, stabs  , stab_end   -stabs  , PTE_U) < 0
+f010600e:	6a 04                	push   $0x4
+f0106010:	89 f0                	mov    %esi,%eax
+f0106012:	29 f8                	sub    %edi,%eax
+f0106014:	c1 f8 02             	sar    $0x2,%eax
+f0106017:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f010601d:	50                   	push   %eax
+f010601e:	57                   	push   %edi
+f010601f:	ff 72 0c             	push   0xc(%edx)
+f0106022:	e8 83 d1 ff ff       	call   f01031aa <user_mem_check>
+f0106027:	83 c4 10             	add    $0x10,%esp
+f010602a:	85 c0                	test   %eax,%eax
+f010602c:	0f 88 b5 00 00 00    	js     f01060e7 <debuginfo_eip+0x289>
+f0106032:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+        || user_mem_check(curenv, stabstr, stabstr_end-stabstr, PTE_U) < 0)
+f0106038:	6a 04                	push   $0x4
+f010603a:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+f010603d:	29 da                	sub    %ebx,%edx
+f010603f:	52                   	push   %edx
+f0106040:	53                   	push   %ebx
+f0106041:	ff 70 0c             	push   0xc(%eax)
+f0106044:	e8 61 d1 ff ff       	call   f01031aa <user_mem_check>
+f0106049:	83 c4 10             	add    $0x10,%esp
+f010604c:	85 c0                	test   %eax,%eax
+f010604e:	0f 89 62 fe ff ff    	jns    f0105eb6 <debuginfo_eip+0x58>
+      return -1;
+f0106054:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0106059:	e9 b1 00 00 00       	jmp    f010610f <debuginfo_eip+0x2b1>
+f010605e:	8b 45 08             	mov    0x8(%ebp),%eax
+f0106061:	89 f2                	mov    %esi,%edx
+f0106063:	e9 00 ff ff ff       	jmp    f0105f68 <debuginfo_eip+0x10a>
+	       && stabs[lline].n_type != N_SOL
+	       && (stabs[lline].n_type != N_SO || !stabs[lline].n_value))
+		lline--;
+f0106068:	83 ea 01             	sub    $0x1,%edx
+f010606b:	83 e8 0c             	sub    $0xc,%eax
+	       && (stabs[lline].n_type != N_SO || !stabs[lline].n_value))
+f010606e:	39 d6                	cmp    %edx,%esi
+f0106070:	7f 31                	jg     f01060a3 <debuginfo_eip+0x245>
+	       && stabs[lline].n_type != N_SOL
+f0106072:	0f b6 08             	movzbl (%eax),%ecx
+f0106075:	80 f9 84             	cmp    $0x84,%cl
+f0106078:	74 0b                	je     f0106085 <debuginfo_eip+0x227>
+	       && (stabs[lline].n_type != N_SO || !stabs[lline].n_value))
+f010607a:	80 f9 64             	cmp    $0x64,%cl
+f010607d:	75 e9                	jne    f0106068 <debuginfo_eip+0x20a>
+f010607f:	83 78 04 00          	cmpl   $0x0,0x4(%eax)
+f0106083:	74 e3                	je     f0106068 <debuginfo_eip+0x20a>
+	if (lline >= lfile && stabs[lline].n_strx < stabstr_end - stabstr)
+f0106085:	8d 04 52             	lea    (%edx,%edx,2),%eax
+f0106088:	8b 14 87             	mov    (%edi,%eax,4),%edx
+f010608b:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+f010608e:	8b 75 c0             	mov    -0x40(%ebp),%esi
+f0106091:	29 f0                	sub    %esi,%eax
+f0106093:	39 c2                	cmp    %eax,%edx
+f0106095:	73 0c                	jae    f01060a3 <debuginfo_eip+0x245>
+		info->eip_file = stabstr + stabs[lline].n_strx;
+f0106097:	8b 45 c0             	mov    -0x40(%ebp),%eax
+f010609a:	01 d0                	add    %edx,%eax
+f010609c:	89 c2                	mov    %eax,%edx
+f010609e:	8b 45 0c             	mov    0xc(%ebp),%eax
+f01060a1:	89 10                	mov    %edx,(%eax)
+		for (lline = lfun + 1;
+		     lline < rfun && stabs[lline].n_type == N_PSYM;
+		     lline++)
+			info->eip_fn_narg++;
+
+	return 0;
+f01060a3:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (lfun < rfun)
+f01060a8:	8b 5d bc             	mov    -0x44(%ebp),%ebx
+f01060ab:	8b 75 b8             	mov    -0x48(%ebp),%esi
+f01060ae:	39 f3                	cmp    %esi,%ebx
+f01060b0:	7d 5d                	jge    f010610f <debuginfo_eip+0x2b1>
+		for (lline = lfun + 1;
+f01060b2:	89 d8                	mov    %ebx,%eax
+f01060b4:	83 c0 01             	add    $0x1,%eax
+f01060b7:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f01060ba:	8d 54 97 04          	lea    0x4(%edi,%edx,4),%edx
+f01060be:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f01060c1:	eb 04                	jmp    f01060c7 <debuginfo_eip+0x269>
+			info->eip_fn_narg++;
+f01060c3:	83 43 14 01          	addl   $0x1,0x14(%ebx)
+		     lline < rfun && stabs[lline].n_type == N_PSYM;
+f01060c7:	39 c6                	cmp    %eax,%esi
+f01060c9:	7e 3f                	jle    f010610a <debuginfo_eip+0x2ac>
+f01060cb:	0f b6 0a             	movzbl (%edx),%ecx
+f01060ce:	83 c0 01             	add    $0x1,%eax
+f01060d1:	83 c2 0c             	add    $0xc,%edx
+f01060d4:	80 f9 a0             	cmp    $0xa0,%cl
+f01060d7:	74 ea                	je     f01060c3 <debuginfo_eip+0x265>
+	return 0;
+f01060d9:	b8 00 00 00 00       	mov    $0x0,%eax
+f01060de:	eb 2f                	jmp    f010610f <debuginfo_eip+0x2b1>
+      return -1;
+f01060e0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f01060e5:	eb 28                	jmp    f010610f <debuginfo_eip+0x2b1>
+f01060e7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f01060ec:	eb 21                	jmp    f010610f <debuginfo_eip+0x2b1>
+		return -1;
+f01060ee:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f01060f3:	eb 1a                	jmp    f010610f <debuginfo_eip+0x2b1>
+f01060f5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f01060fa:	eb 13                	jmp    f010610f <debuginfo_eip+0x2b1>
+		return -1;
+f01060fc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0106101:	eb 0c                	jmp    f010610f <debuginfo_eip+0x2b1>
+    return -1;
+f0106103:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0106108:	eb 05                	jmp    f010610f <debuginfo_eip+0x2b1>
+	return 0;
+f010610a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f010610f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0106112:	5b                   	pop    %ebx
+f0106113:	5e                   	pop    %esi
+f0106114:	5f                   	pop    %edi
+f0106115:	5d                   	pop    %ebp
+f0106116:	c3                   	ret
+
+f0106117 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+f0106117:	55                   	push   %ebp
+f0106118:	89 e5                	mov    %esp,%ebp
+f010611a:	57                   	push   %edi
+f010611b:	56                   	push   %esi
+f010611c:	53                   	push   %ebx
+f010611d:	83 ec 1c             	sub    $0x1c,%esp
+f0106120:	89 c7                	mov    %eax,%edi
+f0106122:	89 d6                	mov    %edx,%esi
+f0106124:	8b 45 08             	mov    0x8(%ebp),%eax
+f0106127:	8b 55 0c             	mov    0xc(%ebp),%edx
+f010612a:	89 d1                	mov    %edx,%ecx
+f010612c:	89 c2                	mov    %eax,%edx
+f010612e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+f0106131:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+f0106134:	8b 45 10             	mov    0x10(%ebp),%eax
+f0106137:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+f010613a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f010613d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+f0106144:	39 c2                	cmp    %eax,%edx
+f0106146:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+f0106149:	72 3e                	jb     f0106189 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+f010614b:	83 ec 0c             	sub    $0xc,%esp
+f010614e:	ff 75 18             	push   0x18(%ebp)
+f0106151:	83 eb 01             	sub    $0x1,%ebx
+f0106154:	53                   	push   %ebx
+f0106155:	50                   	push   %eax
+f0106156:	83 ec 08             	sub    $0x8,%esp
+f0106159:	ff 75 e4             	push   -0x1c(%ebp)
+f010615c:	ff 75 e0             	push   -0x20(%ebp)
+f010615f:	ff 75 dc             	push   -0x24(%ebp)
+f0106162:	ff 75 d8             	push   -0x28(%ebp)
+f0106165:	e8 36 1d 00 00       	call   f0107ea0 <__udivdi3>
+f010616a:	83 c4 18             	add    $0x18,%esp
+f010616d:	52                   	push   %edx
+f010616e:	50                   	push   %eax
+f010616f:	89 f2                	mov    %esi,%edx
+f0106171:	89 f8                	mov    %edi,%eax
+f0106173:	e8 9f ff ff ff       	call   f0106117 <printnum>
+f0106178:	83 c4 20             	add    $0x20,%esp
+f010617b:	eb 13                	jmp    f0106190 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+f010617d:	83 ec 08             	sub    $0x8,%esp
+f0106180:	56                   	push   %esi
+f0106181:	ff 75 18             	push   0x18(%ebp)
+f0106184:	ff d7                	call   *%edi
+f0106186:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+f0106189:	83 eb 01             	sub    $0x1,%ebx
+f010618c:	85 db                	test   %ebx,%ebx
+f010618e:	7f ed                	jg     f010617d <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+f0106190:	83 ec 08             	sub    $0x8,%esp
+f0106193:	56                   	push   %esi
+f0106194:	83 ec 04             	sub    $0x4,%esp
+f0106197:	ff 75 e4             	push   -0x1c(%ebp)
+f010619a:	ff 75 e0             	push   -0x20(%ebp)
+f010619d:	ff 75 dc             	push   -0x24(%ebp)
+f01061a0:	ff 75 d8             	push   -0x28(%ebp)
+f01061a3:	e8 c8 1d 00 00       	call   f0107f70 <__umoddi3>
+f01061a8:	83 c4 14             	add    $0x14,%esp
+f01061ab:	0f be 80 fe 9c 10 f0 	movsbl -0xfef6302(%eax),%eax
+f01061b2:	50                   	push   %eax
+f01061b3:	ff d7                	call   *%edi
+}
+f01061b5:	83 c4 10             	add    $0x10,%esp
+f01061b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01061bb:	5b                   	pop    %ebx
+f01061bc:	5e                   	pop    %esi
+f01061bd:	5f                   	pop    %edi
+f01061be:	5d                   	pop    %ebp
+f01061bf:	c3                   	ret
+
+f01061c0 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+f01061c0:	55                   	push   %ebp
+f01061c1:	89 e5                	mov    %esp,%ebp
+f01061c3:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+f01061c6:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+f01061ca:	8b 10                	mov    (%eax),%edx
+f01061cc:	3b 50 04             	cmp    0x4(%eax),%edx
+f01061cf:	73 0a                	jae    f01061db <sprintputch+0x1b>
+		*b->buf++ = ch;
+f01061d1:	8d 4a 01             	lea    0x1(%edx),%ecx
+f01061d4:	89 08                	mov    %ecx,(%eax)
+f01061d6:	8b 45 08             	mov    0x8(%ebp),%eax
+f01061d9:	88 02                	mov    %al,(%edx)
+}
+f01061db:	5d                   	pop    %ebp
+f01061dc:	c3                   	ret
+
+f01061dd <printfmt>:
+{
+f01061dd:	55                   	push   %ebp
+f01061de:	89 e5                	mov    %esp,%ebp
+f01061e0:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+f01061e3:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+f01061e6:	50                   	push   %eax
+f01061e7:	ff 75 10             	push   0x10(%ebp)
+f01061ea:	ff 75 0c             	push   0xc(%ebp)
+f01061ed:	ff 75 08             	push   0x8(%ebp)
+f01061f0:	e8 05 00 00 00       	call   f01061fa <vprintfmt>
+}
+f01061f5:	83 c4 10             	add    $0x10,%esp
+f01061f8:	c9                   	leave
+f01061f9:	c3                   	ret
+
+f01061fa <vprintfmt>:
+{
+f01061fa:	55                   	push   %ebp
+f01061fb:	89 e5                	mov    %esp,%ebp
+f01061fd:	57                   	push   %edi
+f01061fe:	56                   	push   %esi
+f01061ff:	53                   	push   %ebx
+f0106200:	83 ec 2c             	sub    $0x2c,%esp
+f0106203:	8b 75 08             	mov    0x8(%ebp),%esi
+f0106206:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f0106209:	8b 7d 10             	mov    0x10(%ebp),%edi
+f010620c:	eb 0a                	jmp    f0106218 <vprintfmt+0x1e>
+			putch(ch, putdat);
+f010620e:	83 ec 08             	sub    $0x8,%esp
+f0106211:	53                   	push   %ebx
+f0106212:	50                   	push   %eax
+f0106213:	ff d6                	call   *%esi
+f0106215:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+f0106218:	83 c7 01             	add    $0x1,%edi
+f010621b:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+f010621f:	83 f8 25             	cmp    $0x25,%eax
+f0106222:	74 0c                	je     f0106230 <vprintfmt+0x36>
+			if (ch == '\0')
+f0106224:	85 c0                	test   %eax,%eax
+f0106226:	75 e6                	jne    f010620e <vprintfmt+0x14>
+}
+f0106228:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010622b:	5b                   	pop    %ebx
+f010622c:	5e                   	pop    %esi
+f010622d:	5f                   	pop    %edi
+f010622e:	5d                   	pop    %ebp
+f010622f:	c3                   	ret
+		padc = ' ';
+f0106230:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+f0106234:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+f010623b:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+f0106242:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+f0106249:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+f010624e:	8d 47 01             	lea    0x1(%edi),%eax
+f0106251:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0106254:	0f b6 17             	movzbl (%edi),%edx
+f0106257:	8d 42 dd             	lea    -0x23(%edx),%eax
+f010625a:	3c 55                	cmp    $0x55,%al
+f010625c:	0f 87 9a 03 00 00    	ja     f01065fc <vprintfmt+0x402>
+f0106262:	0f b6 c0             	movzbl %al,%eax
+f0106265:	ff 24 85 40 9e 10 f0 	jmp    *-0xfef61c0(,%eax,4)
+f010626c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+f010626f:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+f0106273:	eb d9                	jmp    f010624e <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+f0106275:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0106278:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+f010627c:	eb d0                	jmp    f010624e <vprintfmt+0x54>
+f010627e:	0f b6 d2             	movzbl %dl,%edx
+f0106281:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+f0106284:	b8 00 00 00 00       	mov    $0x0,%eax
+f0106289:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+f010628c:	8d 04 80             	lea    (%eax,%eax,4),%eax
+f010628f:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+f0106293:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+f0106296:	8d 4a d0             	lea    -0x30(%edx),%ecx
+f0106299:	83 f9 09             	cmp    $0x9,%ecx
+f010629c:	77 55                	ja     f01062f3 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+f010629e:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+f01062a1:	eb e9                	jmp    f010628c <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+f01062a3:	8b 45 14             	mov    0x14(%ebp),%eax
+f01062a6:	8b 00                	mov    (%eax),%eax
+f01062a8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f01062ab:	8b 45 14             	mov    0x14(%ebp),%eax
+f01062ae:	8d 40 04             	lea    0x4(%eax),%eax
+f01062b1:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+f01062b4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+f01062b7:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+f01062bb:	79 91                	jns    f010624e <vprintfmt+0x54>
+				width = precision, precision = -1;
+f01062bd:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f01062c0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f01062c3:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+f01062ca:	eb 82                	jmp    f010624e <vprintfmt+0x54>
+			if (width < 0)
+f01062cc:	8b 55 e0             	mov    -0x20(%ebp),%edx
+f01062cf:	85 d2                	test   %edx,%edx
+f01062d1:	b8 00 00 00 00       	mov    $0x0,%eax
+f01062d6:	0f 49 c2             	cmovns %edx,%eax
+f01062d9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+f01062dc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+f01062df:	e9 6a ff ff ff       	jmp    f010624e <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+f01062e4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+f01062e7:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+f01062ee:	e9 5b ff ff ff       	jmp    f010624e <vprintfmt+0x54>
+f01062f3:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f01062f6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f01062f9:	eb bc                	jmp    f01062b7 <vprintfmt+0xbd>
+			lflag++;
+f01062fb:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+f01062fe:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+f0106301:	e9 48 ff ff ff       	jmp    f010624e <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+f0106306:	8b 45 14             	mov    0x14(%ebp),%eax
+f0106309:	8d 78 04             	lea    0x4(%eax),%edi
+f010630c:	83 ec 08             	sub    $0x8,%esp
+f010630f:	53                   	push   %ebx
+f0106310:	ff 30                	push   (%eax)
+f0106312:	ff d6                	call   *%esi
+			break;
+f0106314:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+f0106317:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+f010631a:	e9 7c 02 00 00       	jmp    f010659b <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+f010631f:	8b 45 14             	mov    0x14(%ebp),%eax
+f0106322:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+f0106325:	8b 10                	mov    (%eax),%edx
+f0106327:	89 d0                	mov    %edx,%eax
+f0106329:	f7 d8                	neg    %eax
+f010632b:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+f010632e:	83 f8 10             	cmp    $0x10,%eax
+f0106331:	7f 23                	jg     f0106356 <vprintfmt+0x15c>
+f0106333:	8b 14 85 a0 9f 10 f0 	mov    -0xfef6060(,%eax,4),%edx
+f010633a:	85 d2                	test   %edx,%edx
+f010633c:	74 18                	je     f0106356 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+f010633e:	52                   	push   %edx
+f010633f:	68 31 93 10 f0       	push   $0xf0109331
+f0106344:	53                   	push   %ebx
+f0106345:	56                   	push   %esi
+f0106346:	e8 92 fe ff ff       	call   f01061dd <printfmt>
+f010634b:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+f010634e:	89 7d 14             	mov    %edi,0x14(%ebp)
+f0106351:	e9 45 02 00 00       	jmp    f010659b <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+f0106356:	50                   	push   %eax
+f0106357:	68 16 9d 10 f0       	push   $0xf0109d16
+f010635c:	53                   	push   %ebx
+f010635d:	56                   	push   %esi
+f010635e:	e8 7a fe ff ff       	call   f01061dd <printfmt>
+f0106363:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+f0106366:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+f0106369:	e9 2d 02 00 00       	jmp    f010659b <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+f010636e:	8b 45 14             	mov    0x14(%ebp),%eax
+f0106371:	83 c0 04             	add    $0x4,%eax
+f0106374:	89 45 c8             	mov    %eax,-0x38(%ebp)
+f0106377:	8b 45 14             	mov    0x14(%ebp),%eax
+f010637a:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+f010637c:	85 c9                	test   %ecx,%ecx
+f010637e:	b8 0f 9d 10 f0       	mov    $0xf0109d0f,%eax
+f0106383:	0f 45 c1             	cmovne %ecx,%eax
+f0106386:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+f0106389:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+f010638d:	7e 06                	jle    f0106395 <vprintfmt+0x19b>
+f010638f:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+f0106393:	75 0b                	jne    f01063a0 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+f0106395:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+f0106398:	8b 7d d0             	mov    -0x30(%ebp),%edi
+f010639b:	89 75 08             	mov    %esi,0x8(%ebp)
+f010639e:	eb 5c                	jmp    f01063fc <vprintfmt+0x202>
+f01063a0:	83 ec 08             	sub    $0x8,%esp
+f01063a3:	ff 75 d0             	push   -0x30(%ebp)
+f01063a6:	ff 75 cc             	push   -0x34(%ebp)
+f01063a9:	e8 d9 03 00 00       	call   f0106787 <strnlen>
+f01063ae:	89 c2                	mov    %eax,%edx
+f01063b0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f01063b3:	29 d0                	sub    %edx,%eax
+f01063b5:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+f01063b8:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+f01063bc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f01063bf:	89 75 08             	mov    %esi,0x8(%ebp)
+f01063c2:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+f01063c4:	eb 0e                	jmp    f01063d4 <vprintfmt+0x1da>
+					putch(padc, putdat);
+f01063c6:	83 ec 08             	sub    $0x8,%esp
+f01063c9:	53                   	push   %ebx
+f01063ca:	57                   	push   %edi
+f01063cb:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+f01063ce:	83 ee 01             	sub    $0x1,%esi
+f01063d1:	83 c4 10             	add    $0x10,%esp
+f01063d4:	85 f6                	test   %esi,%esi
+f01063d6:	7f ee                	jg     f01063c6 <vprintfmt+0x1cc>
+f01063d8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f01063db:	8b 75 08             	mov    0x8(%ebp),%esi
+f01063de:	85 c0                	test   %eax,%eax
+f01063e0:	ba 00 00 00 00       	mov    $0x0,%edx
+f01063e5:	0f 49 d0             	cmovns %eax,%edx
+f01063e8:	29 d0                	sub    %edx,%eax
+f01063ea:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f01063ed:	eb a6                	jmp    f0106395 <vprintfmt+0x19b>
+					putch(ch, putdat);
+f01063ef:	83 ec 08             	sub    $0x8,%esp
+f01063f2:	53                   	push   %ebx
+f01063f3:	52                   	push   %edx
+f01063f4:	ff 55 08             	call   *0x8(%ebp)
+f01063f7:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+f01063fa:	89 f1                	mov    %esi,%ecx
+f01063fc:	8d 71 01             	lea    0x1(%ecx),%esi
+f01063ff:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+f0106403:	0f be d0             	movsbl %al,%edx
+f0106406:	85 d2                	test   %edx,%edx
+f0106408:	74 28                	je     f0106432 <vprintfmt+0x238>
+f010640a:	85 ff                	test   %edi,%edi
+f010640c:	78 05                	js     f0106413 <vprintfmt+0x219>
+f010640e:	83 ef 01             	sub    $0x1,%edi
+f0106411:	78 30                	js     f0106443 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+f0106413:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+f0106417:	74 d6                	je     f01063ef <vprintfmt+0x1f5>
+f0106419:	0f be c0             	movsbl %al,%eax
+f010641c:	83 e8 20             	sub    $0x20,%eax
+f010641f:	83 f8 5e             	cmp    $0x5e,%eax
+f0106422:	76 cb                	jbe    f01063ef <vprintfmt+0x1f5>
+					putch('?', putdat);
+f0106424:	83 ec 08             	sub    $0x8,%esp
+f0106427:	53                   	push   %ebx
+f0106428:	6a 3f                	push   $0x3f
+f010642a:	ff 55 08             	call   *0x8(%ebp)
+f010642d:	83 c4 10             	add    $0x10,%esp
+f0106430:	eb c8                	jmp    f01063fa <vprintfmt+0x200>
+f0106432:	8b 75 08             	mov    0x8(%ebp),%esi
+f0106435:	8b 45 cc             	mov    -0x34(%ebp),%eax
+f0106438:	8b 55 e0             	mov    -0x20(%ebp),%edx
+f010643b:	01 d0                	add    %edx,%eax
+f010643d:	29 c8                	sub    %ecx,%eax
+f010643f:	89 c7                	mov    %eax,%edi
+f0106441:	eb 13                	jmp    f0106456 <vprintfmt+0x25c>
+f0106443:	8b 75 08             	mov    0x8(%ebp),%esi
+f0106446:	eb ed                	jmp    f0106435 <vprintfmt+0x23b>
+				putch(' ', putdat);
+f0106448:	83 ec 08             	sub    $0x8,%esp
+f010644b:	53                   	push   %ebx
+f010644c:	6a 20                	push   $0x20
+f010644e:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+f0106450:	83 ef 01             	sub    $0x1,%edi
+f0106453:	83 c4 10             	add    $0x10,%esp
+f0106456:	85 ff                	test   %edi,%edi
+f0106458:	7f ee                	jg     f0106448 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+f010645a:	8b 45 c8             	mov    -0x38(%ebp),%eax
+f010645d:	89 45 14             	mov    %eax,0x14(%ebp)
+f0106460:	e9 36 01 00 00       	jmp    f010659b <vprintfmt+0x3a1>
+	if (lflag >= 2)
+f0106465:	83 f9 01             	cmp    $0x1,%ecx
+f0106468:	7f 1f                	jg     f0106489 <vprintfmt+0x28f>
+	else if (lflag)
+f010646a:	85 c9                	test   %ecx,%ecx
+f010646c:	74 67                	je     f01064d5 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+f010646e:	8b 45 14             	mov    0x14(%ebp),%eax
+f0106471:	8b 00                	mov    (%eax),%eax
+f0106473:	89 45 d8             	mov    %eax,-0x28(%ebp)
+f0106476:	89 c1                	mov    %eax,%ecx
+f0106478:	c1 f9 1f             	sar    $0x1f,%ecx
+f010647b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+f010647e:	8b 45 14             	mov    0x14(%ebp),%eax
+f0106481:	8d 40 04             	lea    0x4(%eax),%eax
+f0106484:	89 45 14             	mov    %eax,0x14(%ebp)
+f0106487:	eb 17                	jmp    f01064a0 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+f0106489:	8b 45 14             	mov    0x14(%ebp),%eax
+f010648c:	8b 50 04             	mov    0x4(%eax),%edx
+f010648f:	8b 00                	mov    (%eax),%eax
+f0106491:	89 45 d8             	mov    %eax,-0x28(%ebp)
+f0106494:	89 55 dc             	mov    %edx,-0x24(%ebp)
+f0106497:	8b 45 14             	mov    0x14(%ebp),%eax
+f010649a:	8d 40 08             	lea    0x8(%eax),%eax
+f010649d:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+f01064a0:	8b 55 d8             	mov    -0x28(%ebp),%edx
+f01064a3:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+f01064a6:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+f01064ab:	85 c9                	test   %ecx,%ecx
+f01064ad:	0f 89 ce 00 00 00    	jns    f0106581 <vprintfmt+0x387>
+				putch('-', putdat);
+f01064b3:	83 ec 08             	sub    $0x8,%esp
+f01064b6:	53                   	push   %ebx
+f01064b7:	6a 2d                	push   $0x2d
+f01064b9:	ff d6                	call   *%esi
+				num = -(long long) num;
+f01064bb:	8b 55 d8             	mov    -0x28(%ebp),%edx
+f01064be:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+f01064c1:	f7 da                	neg    %edx
+f01064c3:	83 d1 00             	adc    $0x0,%ecx
+f01064c6:	f7 d9                	neg    %ecx
+f01064c8:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+f01064cb:	bf 0a 00 00 00       	mov    $0xa,%edi
+f01064d0:	e9 ac 00 00 00       	jmp    f0106581 <vprintfmt+0x387>
+		return va_arg(*ap, int);
+f01064d5:	8b 45 14             	mov    0x14(%ebp),%eax
+f01064d8:	8b 00                	mov    (%eax),%eax
+f01064da:	89 45 d8             	mov    %eax,-0x28(%ebp)
+f01064dd:	89 c1                	mov    %eax,%ecx
+f01064df:	c1 f9 1f             	sar    $0x1f,%ecx
+f01064e2:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+f01064e5:	8b 45 14             	mov    0x14(%ebp),%eax
+f01064e8:	8d 40 04             	lea    0x4(%eax),%eax
+f01064eb:	89 45 14             	mov    %eax,0x14(%ebp)
+f01064ee:	eb b0                	jmp    f01064a0 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+f01064f0:	83 f9 01             	cmp    $0x1,%ecx
+f01064f3:	7f 1b                	jg     f0106510 <vprintfmt+0x316>
+	else if (lflag)
+f01064f5:	85 c9                	test   %ecx,%ecx
+f01064f7:	74 2c                	je     f0106525 <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+f01064f9:	8b 45 14             	mov    0x14(%ebp),%eax
+f01064fc:	8b 10                	mov    (%eax),%edx
+f01064fe:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0106503:	8d 40 04             	lea    0x4(%eax),%eax
+f0106506:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+f0106509:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+f010650e:	eb 71                	jmp    f0106581 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+f0106510:	8b 45 14             	mov    0x14(%ebp),%eax
+f0106513:	8b 10                	mov    (%eax),%edx
+f0106515:	8b 48 04             	mov    0x4(%eax),%ecx
+f0106518:	8d 40 08             	lea    0x8(%eax),%eax
+f010651b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+f010651e:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+f0106523:	eb 5c                	jmp    f0106581 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+f0106525:	8b 45 14             	mov    0x14(%ebp),%eax
+f0106528:	8b 10                	mov    (%eax),%edx
+f010652a:	b9 00 00 00 00       	mov    $0x0,%ecx
+f010652f:	8d 40 04             	lea    0x4(%eax),%eax
+f0106532:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+f0106535:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+f010653a:	eb 45                	jmp    f0106581 <vprintfmt+0x387>
+			putch('X', putdat);
+f010653c:	83 ec 08             	sub    $0x8,%esp
+f010653f:	53                   	push   %ebx
+f0106540:	6a 58                	push   $0x58
+f0106542:	ff d6                	call   *%esi
+			putch('X', putdat);
+f0106544:	83 c4 08             	add    $0x8,%esp
+f0106547:	53                   	push   %ebx
+f0106548:	6a 58                	push   $0x58
+f010654a:	ff d6                	call   *%esi
+			putch('X', putdat);
+f010654c:	83 c4 08             	add    $0x8,%esp
+f010654f:	53                   	push   %ebx
+f0106550:	6a 58                	push   $0x58
+f0106552:	ff d6                	call   *%esi
+			break;
+f0106554:	83 c4 10             	add    $0x10,%esp
+f0106557:	eb 42                	jmp    f010659b <vprintfmt+0x3a1>
+			putch('0', putdat);
+f0106559:	83 ec 08             	sub    $0x8,%esp
+f010655c:	53                   	push   %ebx
+f010655d:	6a 30                	push   $0x30
+f010655f:	ff d6                	call   *%esi
+			putch('x', putdat);
+f0106561:	83 c4 08             	add    $0x8,%esp
+f0106564:	53                   	push   %ebx
+f0106565:	6a 78                	push   $0x78
+f0106567:	ff d6                	call   *%esi
+			num = (unsigned long long)
+f0106569:	8b 45 14             	mov    0x14(%ebp),%eax
+f010656c:	8b 10                	mov    (%eax),%edx
+f010656e:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+f0106573:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+f0106576:	8d 40 04             	lea    0x4(%eax),%eax
+f0106579:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+f010657c:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+f0106581:	83 ec 0c             	sub    $0xc,%esp
+f0106584:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+f0106588:	50                   	push   %eax
+f0106589:	ff 75 e0             	push   -0x20(%ebp)
+f010658c:	57                   	push   %edi
+f010658d:	51                   	push   %ecx
+f010658e:	52                   	push   %edx
+f010658f:	89 da                	mov    %ebx,%edx
+f0106591:	89 f0                	mov    %esi,%eax
+f0106593:	e8 7f fb ff ff       	call   f0106117 <printnum>
+			break;
+f0106598:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+f010659b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+f010659e:	e9 75 fc ff ff       	jmp    f0106218 <vprintfmt+0x1e>
+	if (lflag >= 2)
+f01065a3:	83 f9 01             	cmp    $0x1,%ecx
+f01065a6:	7f 1b                	jg     f01065c3 <vprintfmt+0x3c9>
+	else if (lflag)
+f01065a8:	85 c9                	test   %ecx,%ecx
+f01065aa:	74 2c                	je     f01065d8 <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+f01065ac:	8b 45 14             	mov    0x14(%ebp),%eax
+f01065af:	8b 10                	mov    (%eax),%edx
+f01065b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+f01065b6:	8d 40 04             	lea    0x4(%eax),%eax
+f01065b9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+f01065bc:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+f01065c1:	eb be                	jmp    f0106581 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+f01065c3:	8b 45 14             	mov    0x14(%ebp),%eax
+f01065c6:	8b 10                	mov    (%eax),%edx
+f01065c8:	8b 48 04             	mov    0x4(%eax),%ecx
+f01065cb:	8d 40 08             	lea    0x8(%eax),%eax
+f01065ce:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+f01065d1:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+f01065d6:	eb a9                	jmp    f0106581 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+f01065d8:	8b 45 14             	mov    0x14(%ebp),%eax
+f01065db:	8b 10                	mov    (%eax),%edx
+f01065dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+f01065e2:	8d 40 04             	lea    0x4(%eax),%eax
+f01065e5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+f01065e8:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+f01065ed:	eb 92                	jmp    f0106581 <vprintfmt+0x387>
+			putch(ch, putdat);
+f01065ef:	83 ec 08             	sub    $0x8,%esp
+f01065f2:	53                   	push   %ebx
+f01065f3:	6a 25                	push   $0x25
+f01065f5:	ff d6                	call   *%esi
+			break;
+f01065f7:	83 c4 10             	add    $0x10,%esp
+f01065fa:	eb 9f                	jmp    f010659b <vprintfmt+0x3a1>
+			putch('%', putdat);
+f01065fc:	83 ec 08             	sub    $0x8,%esp
+f01065ff:	53                   	push   %ebx
+f0106600:	6a 25                	push   $0x25
+f0106602:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+f0106604:	83 c4 10             	add    $0x10,%esp
+f0106607:	89 f8                	mov    %edi,%eax
+f0106609:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+f010660d:	74 05                	je     f0106614 <vprintfmt+0x41a>
+f010660f:	83 e8 01             	sub    $0x1,%eax
+f0106612:	eb f5                	jmp    f0106609 <vprintfmt+0x40f>
+f0106614:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0106617:	eb 82                	jmp    f010659b <vprintfmt+0x3a1>
+
+f0106619 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+f0106619:	55                   	push   %ebp
+f010661a:	89 e5                	mov    %esp,%ebp
+f010661c:	83 ec 18             	sub    $0x18,%esp
+f010661f:	8b 45 08             	mov    0x8(%ebp),%eax
+f0106622:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+f0106625:	89 45 ec             	mov    %eax,-0x14(%ebp)
+f0106628:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+f010662c:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+f010662f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+f0106636:	85 c0                	test   %eax,%eax
+f0106638:	74 26                	je     f0106660 <vsnprintf+0x47>
+f010663a:	85 d2                	test   %edx,%edx
+f010663c:	7e 22                	jle    f0106660 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+f010663e:	ff 75 14             	push   0x14(%ebp)
+f0106641:	ff 75 10             	push   0x10(%ebp)
+f0106644:	8d 45 ec             	lea    -0x14(%ebp),%eax
+f0106647:	50                   	push   %eax
+f0106648:	68 c0 61 10 f0       	push   $0xf01061c0
+f010664d:	e8 a8 fb ff ff       	call   f01061fa <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+f0106652:	8b 45 ec             	mov    -0x14(%ebp),%eax
+f0106655:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+f0106658:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f010665b:	83 c4 10             	add    $0x10,%esp
+}
+f010665e:	c9                   	leave
+f010665f:	c3                   	ret
+		return -E_INVAL;
+f0106660:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0106665:	eb f7                	jmp    f010665e <vsnprintf+0x45>
+
+f0106667 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+f0106667:	55                   	push   %ebp
+f0106668:	89 e5                	mov    %esp,%ebp
+f010666a:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+f010666d:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+f0106670:	50                   	push   %eax
+f0106671:	ff 75 10             	push   0x10(%ebp)
+f0106674:	ff 75 0c             	push   0xc(%ebp)
+f0106677:	ff 75 08             	push   0x8(%ebp)
+f010667a:	e8 9a ff ff ff       	call   f0106619 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+f010667f:	c9                   	leave
+f0106680:	c3                   	ret
+
+f0106681 <readline>:
+#define BUFLEN 1024
+static char buf[BUFLEN];
+
+char *
+readline(const char *prompt)
+{
+f0106681:	55                   	push   %ebp
+f0106682:	89 e5                	mov    %esp,%ebp
+f0106684:	57                   	push   %edi
+f0106685:	56                   	push   %esi
+f0106686:	53                   	push   %ebx
+f0106687:	83 ec 0c             	sub    $0xc,%esp
+f010668a:	8b 45 08             	mov    0x8(%ebp),%eax
+	int i, c, echoing;
+
+#if JOS_KERNEL
+	if (prompt != NULL)
+f010668d:	85 c0                	test   %eax,%eax
+f010668f:	74 11                	je     f01066a2 <readline+0x21>
+		cprintf("%s", prompt);
+f0106691:	83 ec 08             	sub    $0x8,%esp
+f0106694:	50                   	push   %eax
+f0106695:	68 31 93 10 f0       	push   $0xf0109331
+f010669a:	e8 3b dd ff ff       	call   f01043da <cprintf>
+f010669f:	83 c4 10             	add    $0x10,%esp
+	if (prompt != NULL)
+		fprintf(1, "%s", prompt);
+#endif
+
+	i = 0;
+	echoing = iscons(0);
+f01066a2:	83 ec 0c             	sub    $0xc,%esp
+f01066a5:	6a 00                	push   $0x0
+f01066a7:	e8 65 a1 ff ff       	call   f0100811 <iscons>
+f01066ac:	89 c7                	mov    %eax,%edi
+f01066ae:	83 c4 10             	add    $0x10,%esp
+	i = 0;
+f01066b1:	be 00 00 00 00       	mov    $0x0,%esi
+f01066b6:	eb 4b                	jmp    f0106703 <readline+0x82>
+	while (1) {
+		c = getchar();
+		if (c < 0) {
+			if (c != -E_EOF)
+				cprintf("read error: %e\n", c);
+			return NULL;
+f01066b8:	b8 00 00 00 00       	mov    $0x0,%eax
+			if (c != -E_EOF)
+f01066bd:	83 fb f8             	cmp    $0xfffffff8,%ebx
+f01066c0:	75 08                	jne    f01066ca <readline+0x49>
+				cputchar('\n');
+			buf[i] = 0;
+			return buf;
+		}
+	}
+}
+f01066c2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01066c5:	5b                   	pop    %ebx
+f01066c6:	5e                   	pop    %esi
+f01066c7:	5f                   	pop    %edi
+f01066c8:	5d                   	pop    %ebp
+f01066c9:	c3                   	ret
+				cprintf("read error: %e\n", c);
+f01066ca:	83 ec 08             	sub    $0x8,%esp
+f01066cd:	53                   	push   %ebx
+f01066ce:	68 03 a0 10 f0       	push   $0xf010a003
+f01066d3:	e8 02 dd ff ff       	call   f01043da <cprintf>
+f01066d8:	83 c4 10             	add    $0x10,%esp
+			return NULL;
+f01066db:	b8 00 00 00 00       	mov    $0x0,%eax
+f01066e0:	eb e0                	jmp    f01066c2 <readline+0x41>
+			if (echoing)
+f01066e2:	85 ff                	test   %edi,%edi
+f01066e4:	75 05                	jne    f01066eb <readline+0x6a>
+			i--;
+f01066e6:	83 ee 01             	sub    $0x1,%esi
+f01066e9:	eb 18                	jmp    f0106703 <readline+0x82>
+				cputchar('\b');
+f01066eb:	83 ec 0c             	sub    $0xc,%esp
+f01066ee:	6a 08                	push   $0x8
+f01066f0:	e8 fb a0 ff ff       	call   f01007f0 <cputchar>
+f01066f5:	83 c4 10             	add    $0x10,%esp
+f01066f8:	eb ec                	jmp    f01066e6 <readline+0x65>
+			buf[i++] = c;
+f01066fa:	88 9e a0 62 66 f0    	mov    %bl,-0xf999d60(%esi)
+f0106700:	8d 76 01             	lea    0x1(%esi),%esi
+		c = getchar();
+f0106703:	e8 f8 a0 ff ff       	call   f0100800 <getchar>
+f0106708:	89 c3                	mov    %eax,%ebx
+		if (c < 0) {
+f010670a:	85 c0                	test   %eax,%eax
+f010670c:	78 aa                	js     f01066b8 <readline+0x37>
+		} else if ((c == '\b' || c == '\x7f') && i > 0) {
+f010670e:	83 f8 08             	cmp    $0x8,%eax
+f0106711:	0f 94 c0             	sete   %al
+f0106714:	83 fb 7f             	cmp    $0x7f,%ebx
+f0106717:	0f 94 c2             	sete   %dl
+f010671a:	08 d0                	or     %dl,%al
+f010671c:	74 04                	je     f0106722 <readline+0xa1>
+f010671e:	85 f6                	test   %esi,%esi
+f0106720:	7f c0                	jg     f01066e2 <readline+0x61>
+		} else if (c >= ' ' && i < BUFLEN-1) {
+f0106722:	83 fb 1f             	cmp    $0x1f,%ebx
+f0106725:	7e 1a                	jle    f0106741 <readline+0xc0>
+f0106727:	81 fe fe 03 00 00    	cmp    $0x3fe,%esi
+f010672d:	7f 12                	jg     f0106741 <readline+0xc0>
+			if (echoing)
+f010672f:	85 ff                	test   %edi,%edi
+f0106731:	74 c7                	je     f01066fa <readline+0x79>
+				cputchar(c);
+f0106733:	83 ec 0c             	sub    $0xc,%esp
+f0106736:	53                   	push   %ebx
+f0106737:	e8 b4 a0 ff ff       	call   f01007f0 <cputchar>
+f010673c:	83 c4 10             	add    $0x10,%esp
+f010673f:	eb b9                	jmp    f01066fa <readline+0x79>
+		} else if (c == '\n' || c == '\r') {
+f0106741:	83 fb 0a             	cmp    $0xa,%ebx
+f0106744:	74 05                	je     f010674b <readline+0xca>
+f0106746:	83 fb 0d             	cmp    $0xd,%ebx
+f0106749:	75 b8                	jne    f0106703 <readline+0x82>
+			if (echoing)
+f010674b:	85 ff                	test   %edi,%edi
+f010674d:	75 11                	jne    f0106760 <readline+0xdf>
+			buf[i] = 0;
+f010674f:	c6 86 a0 62 66 f0 00 	movb   $0x0,-0xf999d60(%esi)
+			return buf;
+f0106756:	b8 a0 62 66 f0       	mov    $0xf06662a0,%eax
+f010675b:	e9 62 ff ff ff       	jmp    f01066c2 <readline+0x41>
+				cputchar('\n');
+f0106760:	83 ec 0c             	sub    $0xc,%esp
+f0106763:	6a 0a                	push   $0xa
+f0106765:	e8 86 a0 ff ff       	call   f01007f0 <cputchar>
+f010676a:	83 c4 10             	add    $0x10,%esp
+f010676d:	eb e0                	jmp    f010674f <readline+0xce>
+
+f010676f <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+f010676f:	55                   	push   %ebp
+f0106770:	89 e5                	mov    %esp,%ebp
+f0106772:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+f0106775:	b8 00 00 00 00       	mov    $0x0,%eax
+f010677a:	eb 03                	jmp    f010677f <strlen+0x10>
+		n++;
+f010677c:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+f010677f:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+f0106783:	75 f7                	jne    f010677c <strlen+0xd>
+	return n;
+}
+f0106785:	5d                   	pop    %ebp
+f0106786:	c3                   	ret
+
+f0106787 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+f0106787:	55                   	push   %ebp
+f0106788:	89 e5                	mov    %esp,%ebp
+f010678a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+f010678d:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0106790:	b8 00 00 00 00       	mov    $0x0,%eax
+f0106795:	eb 03                	jmp    f010679a <strnlen+0x13>
+		n++;
+f0106797:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+f010679a:	39 d0                	cmp    %edx,%eax
+f010679c:	74 08                	je     f01067a6 <strnlen+0x1f>
+f010679e:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+f01067a2:	75 f3                	jne    f0106797 <strnlen+0x10>
+f01067a4:	89 c2                	mov    %eax,%edx
+	return n;
+}
+f01067a6:	89 d0                	mov    %edx,%eax
+f01067a8:	5d                   	pop    %ebp
+f01067a9:	c3                   	ret
+
+f01067aa <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+f01067aa:	55                   	push   %ebp
+f01067ab:	89 e5                	mov    %esp,%ebp
+f01067ad:	53                   	push   %ebx
+f01067ae:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f01067b1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+f01067b4:	b8 00 00 00 00       	mov    $0x0,%eax
+f01067b9:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+f01067bd:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+f01067c0:	83 c0 01             	add    $0x1,%eax
+f01067c3:	84 d2                	test   %dl,%dl
+f01067c5:	75 f2                	jne    f01067b9 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+f01067c7:	89 c8                	mov    %ecx,%eax
+f01067c9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01067cc:	c9                   	leave
+f01067cd:	c3                   	ret
+
+f01067ce <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+f01067ce:	55                   	push   %ebp
+f01067cf:	89 e5                	mov    %esp,%ebp
+f01067d1:	53                   	push   %ebx
+f01067d2:	83 ec 10             	sub    $0x10,%esp
+f01067d5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+f01067d8:	53                   	push   %ebx
+f01067d9:	e8 91 ff ff ff       	call   f010676f <strlen>
+f01067de:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+f01067e1:	ff 75 0c             	push   0xc(%ebp)
+f01067e4:	01 d8                	add    %ebx,%eax
+f01067e6:	50                   	push   %eax
+f01067e7:	e8 be ff ff ff       	call   f01067aa <strcpy>
+	return dst;
+}
+f01067ec:	89 d8                	mov    %ebx,%eax
+f01067ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01067f1:	c9                   	leave
+f01067f2:	c3                   	ret
+
+f01067f3 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+f01067f3:	55                   	push   %ebp
+f01067f4:	89 e5                	mov    %esp,%ebp
+f01067f6:	56                   	push   %esi
+f01067f7:	53                   	push   %ebx
+f01067f8:	8b 75 08             	mov    0x8(%ebp),%esi
+f01067fb:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+f01067fe:	89 f3                	mov    %esi,%ebx
+f0106800:	03 5d 10             	add    0x10(%ebp),%ebx
+f0106803:	89 f0                	mov    %esi,%eax
+f0106805:	eb 0f                	jmp    f0106816 <strncpy+0x23>
+		*dst++ = *src;
+f0106807:	83 c0 01             	add    $0x1,%eax
+f010680a:	0f b6 0a             	movzbl (%edx),%ecx
+f010680d:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+f0106810:	80 f9 01             	cmp    $0x1,%cl
+f0106813:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+f0106816:	39 d8                	cmp    %ebx,%eax
+f0106818:	75 ed                	jne    f0106807 <strncpy+0x14>
+	}
+	return ret;
+}
+f010681a:	89 f0                	mov    %esi,%eax
+f010681c:	5b                   	pop    %ebx
+f010681d:	5e                   	pop    %esi
+f010681e:	5d                   	pop    %ebp
+f010681f:	c3                   	ret
+
+f0106820 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+f0106820:	55                   	push   %ebp
+f0106821:	89 e5                	mov    %esp,%ebp
+f0106823:	56                   	push   %esi
+f0106824:	53                   	push   %ebx
+f0106825:	8b 75 08             	mov    0x8(%ebp),%esi
+f0106828:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f010682b:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+f010682e:	89 f0                	mov    %esi,%eax
+f0106830:	85 d2                	test   %edx,%edx
+f0106832:	74 21                	je     f0106855 <strlcpy+0x35>
+f0106834:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+f0106838:	89 f2                	mov    %esi,%edx
+f010683a:	eb 09                	jmp    f0106845 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+f010683c:	83 c1 01             	add    $0x1,%ecx
+f010683f:	83 c2 01             	add    $0x1,%edx
+f0106842:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+f0106845:	39 c2                	cmp    %eax,%edx
+f0106847:	74 09                	je     f0106852 <strlcpy+0x32>
+f0106849:	0f b6 19             	movzbl (%ecx),%ebx
+f010684c:	84 db                	test   %bl,%bl
+f010684e:	75 ec                	jne    f010683c <strlcpy+0x1c>
+f0106850:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+f0106852:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+f0106855:	29 f0                	sub    %esi,%eax
+}
+f0106857:	5b                   	pop    %ebx
+f0106858:	5e                   	pop    %esi
+f0106859:	5d                   	pop    %ebp
+f010685a:	c3                   	ret
+
+f010685b <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+f010685b:	55                   	push   %ebp
+f010685c:	89 e5                	mov    %esp,%ebp
+f010685e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f0106861:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+f0106864:	eb 06                	jmp    f010686c <strcmp+0x11>
+		p++, q++;
+f0106866:	83 c1 01             	add    $0x1,%ecx
+f0106869:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+f010686c:	0f b6 01             	movzbl (%ecx),%eax
+f010686f:	84 c0                	test   %al,%al
+f0106871:	74 04                	je     f0106877 <strcmp+0x1c>
+f0106873:	3a 02                	cmp    (%edx),%al
+f0106875:	74 ef                	je     f0106866 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+f0106877:	0f b6 c0             	movzbl %al,%eax
+f010687a:	0f b6 12             	movzbl (%edx),%edx
+f010687d:	29 d0                	sub    %edx,%eax
+}
+f010687f:	5d                   	pop    %ebp
+f0106880:	c3                   	ret
+
+f0106881 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+f0106881:	55                   	push   %ebp
+f0106882:	89 e5                	mov    %esp,%ebp
+f0106884:	53                   	push   %ebx
+f0106885:	8b 45 08             	mov    0x8(%ebp),%eax
+f0106888:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f010688b:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+f010688e:	eb 09                	jmp    f0106899 <strncmp+0x18>
+		n--, p++, q++;
+f0106890:	83 ea 01             	sub    $0x1,%edx
+f0106893:	83 c0 01             	add    $0x1,%eax
+f0106896:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+f0106899:	85 d2                	test   %edx,%edx
+f010689b:	74 18                	je     f01068b5 <strncmp+0x34>
+f010689d:	0f b6 18             	movzbl (%eax),%ebx
+f01068a0:	84 db                	test   %bl,%bl
+f01068a2:	74 04                	je     f01068a8 <strncmp+0x27>
+f01068a4:	3a 19                	cmp    (%ecx),%bl
+f01068a6:	74 e8                	je     f0106890 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+f01068a8:	0f b6 00             	movzbl (%eax),%eax
+f01068ab:	0f b6 11             	movzbl (%ecx),%edx
+f01068ae:	29 d0                	sub    %edx,%eax
+}
+f01068b0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01068b3:	c9                   	leave
+f01068b4:	c3                   	ret
+		return 0;
+f01068b5:	b8 00 00 00 00       	mov    $0x0,%eax
+f01068ba:	eb f4                	jmp    f01068b0 <strncmp+0x2f>
+
+f01068bc <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+f01068bc:	55                   	push   %ebp
+f01068bd:	89 e5                	mov    %esp,%ebp
+f01068bf:	8b 45 08             	mov    0x8(%ebp),%eax
+f01068c2:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+f01068c6:	eb 03                	jmp    f01068cb <strchr+0xf>
+f01068c8:	83 c0 01             	add    $0x1,%eax
+f01068cb:	0f b6 10             	movzbl (%eax),%edx
+f01068ce:	84 d2                	test   %dl,%dl
+f01068d0:	74 06                	je     f01068d8 <strchr+0x1c>
+		if (*s == c)
+f01068d2:	38 ca                	cmp    %cl,%dl
+f01068d4:	75 f2                	jne    f01068c8 <strchr+0xc>
+f01068d6:	eb 05                	jmp    f01068dd <strchr+0x21>
+			return (char *) s;
+	return 0;
+f01068d8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f01068dd:	5d                   	pop    %ebp
+f01068de:	c3                   	ret
+
+f01068df <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+f01068df:	55                   	push   %ebp
+f01068e0:	89 e5                	mov    %esp,%ebp
+f01068e2:	8b 45 08             	mov    0x8(%ebp),%eax
+f01068e5:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+f01068e9:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+f01068ec:	38 ca                	cmp    %cl,%dl
+f01068ee:	74 09                	je     f01068f9 <strfind+0x1a>
+f01068f0:	84 d2                	test   %dl,%dl
+f01068f2:	74 05                	je     f01068f9 <strfind+0x1a>
+	for (; *s; s++)
+f01068f4:	83 c0 01             	add    $0x1,%eax
+f01068f7:	eb f0                	jmp    f01068e9 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+f01068f9:	5d                   	pop    %ebp
+f01068fa:	c3                   	ret
+
+f01068fb <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+f01068fb:	55                   	push   %ebp
+f01068fc:	89 e5                	mov    %esp,%ebp
+f01068fe:	57                   	push   %edi
+f01068ff:	8b 7d 08             	mov    0x8(%ebp),%edi
+f0106902:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+f0106905:	85 c9                	test   %ecx,%ecx
+f0106907:	74 20                	je     f0106929 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+f0106909:	89 f8                	mov    %edi,%eax
+f010690b:	09 c8                	or     %ecx,%eax
+f010690d:	a8 03                	test   $0x3,%al
+f010690f:	75 12                	jne    f0106923 <memset+0x28>
+		c &= 0xFF;
+f0106911:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+f0106915:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+f010691b:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+f010691e:	fc                   	cld
+f010691f:	f3 ab                	rep stos %eax,%es:(%edi)
+f0106921:	eb 06                	jmp    f0106929 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+f0106923:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0106926:	fc                   	cld
+f0106927:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+f0106929:	89 f8                	mov    %edi,%eax
+f010692b:	8b 7d fc             	mov    -0x4(%ebp),%edi
+f010692e:	c9                   	leave
+f010692f:	c3                   	ret
+
+f0106930 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+f0106930:	55                   	push   %ebp
+f0106931:	89 e5                	mov    %esp,%ebp
+f0106933:	57                   	push   %edi
+f0106934:	56                   	push   %esi
+f0106935:	8b 45 08             	mov    0x8(%ebp),%eax
+f0106938:	8b 75 0c             	mov    0xc(%ebp),%esi
+f010693b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+f010693e:	39 c6                	cmp    %eax,%esi
+f0106940:	73 32                	jae    f0106974 <memmove+0x44>
+f0106942:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+f0106945:	39 d0                	cmp    %edx,%eax
+f0106947:	73 2b                	jae    f0106974 <memmove+0x44>
+		s += n;
+		d += n;
+f0106949:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+f010694c:	89 d6                	mov    %edx,%esi
+f010694e:	09 fe                	or     %edi,%esi
+f0106950:	09 ce                	or     %ecx,%esi
+f0106952:	f7 c6 03 00 00 00    	test   $0x3,%esi
+f0106958:	75 0e                	jne    f0106968 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+f010695a:	83 ef 04             	sub    $0x4,%edi
+f010695d:	8d 72 fc             	lea    -0x4(%edx),%esi
+f0106960:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+f0106963:	fd                   	std
+f0106964:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+f0106966:	eb 09                	jmp    f0106971 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+f0106968:	83 ef 01             	sub    $0x1,%edi
+f010696b:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+f010696e:	fd                   	std
+f010696f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+f0106971:	fc                   	cld
+f0106972:	eb 1a                	jmp    f010698e <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+f0106974:	89 f2                	mov    %esi,%edx
+f0106976:	09 c2                	or     %eax,%edx
+f0106978:	09 ca                	or     %ecx,%edx
+f010697a:	f6 c2 03             	test   $0x3,%dl
+f010697d:	75 0a                	jne    f0106989 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+f010697f:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+f0106982:	89 c7                	mov    %eax,%edi
+f0106984:	fc                   	cld
+f0106985:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+f0106987:	eb 05                	jmp    f010698e <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+f0106989:	89 c7                	mov    %eax,%edi
+f010698b:	fc                   	cld
+f010698c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+f010698e:	5e                   	pop    %esi
+f010698f:	5f                   	pop    %edi
+f0106990:	5d                   	pop    %ebp
+f0106991:	c3                   	ret
+
+f0106992 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+f0106992:	55                   	push   %ebp
+f0106993:	89 e5                	mov    %esp,%ebp
+f0106995:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+f0106998:	ff 75 10             	push   0x10(%ebp)
+f010699b:	ff 75 0c             	push   0xc(%ebp)
+f010699e:	ff 75 08             	push   0x8(%ebp)
+f01069a1:	e8 8a ff ff ff       	call   f0106930 <memmove>
+}
+f01069a6:	c9                   	leave
+f01069a7:	c3                   	ret
+
+f01069a8 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+f01069a8:	55                   	push   %ebp
+f01069a9:	89 e5                	mov    %esp,%ebp
+f01069ab:	56                   	push   %esi
+f01069ac:	53                   	push   %ebx
+f01069ad:	8b 45 08             	mov    0x8(%ebp),%eax
+f01069b0:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+f01069b3:	89 c6                	mov    %eax,%esi
+f01069b5:	03 75 10             	add    0x10(%ebp),%esi
+f01069b8:	eb 06                	jmp    f01069c0 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+f01069ba:	83 c0 01             	add    $0x1,%eax
+f01069bd:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+f01069c0:	39 f0                	cmp    %esi,%eax
+f01069c2:	74 14                	je     f01069d8 <memcmp+0x30>
+		if (*s1 != *s2)
+f01069c4:	0f b6 08             	movzbl (%eax),%ecx
+f01069c7:	0f b6 1a             	movzbl (%edx),%ebx
+f01069ca:	38 d9                	cmp    %bl,%cl
+f01069cc:	74 ec                	je     f01069ba <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+f01069ce:	0f b6 c1             	movzbl %cl,%eax
+f01069d1:	0f b6 db             	movzbl %bl,%ebx
+f01069d4:	29 d8                	sub    %ebx,%eax
+f01069d6:	eb 05                	jmp    f01069dd <memcmp+0x35>
+	}
+
+	return 0;
+f01069d8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f01069dd:	5b                   	pop    %ebx
+f01069de:	5e                   	pop    %esi
+f01069df:	5d                   	pop    %ebp
+f01069e0:	c3                   	ret
+
+f01069e1 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+f01069e1:	55                   	push   %ebp
+f01069e2:	89 e5                	mov    %esp,%ebp
+f01069e4:	8b 45 08             	mov    0x8(%ebp),%eax
+f01069e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+f01069ea:	89 c2                	mov    %eax,%edx
+f01069ec:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+f01069ef:	eb 03                	jmp    f01069f4 <memfind+0x13>
+f01069f1:	83 c0 01             	add    $0x1,%eax
+f01069f4:	39 d0                	cmp    %edx,%eax
+f01069f6:	73 04                	jae    f01069fc <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+f01069f8:	38 08                	cmp    %cl,(%eax)
+f01069fa:	75 f5                	jne    f01069f1 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+f01069fc:	5d                   	pop    %ebp
+f01069fd:	c3                   	ret
+
+f01069fe <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+f01069fe:	55                   	push   %ebp
+f01069ff:	89 e5                	mov    %esp,%ebp
+f0106a01:	57                   	push   %edi
+f0106a02:	56                   	push   %esi
+f0106a03:	53                   	push   %ebx
+f0106a04:	8b 55 08             	mov    0x8(%ebp),%edx
+f0106a07:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+f0106a0a:	eb 03                	jmp    f0106a0f <strtol+0x11>
+		s++;
+f0106a0c:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+f0106a0f:	0f b6 02             	movzbl (%edx),%eax
+f0106a12:	3c 20                	cmp    $0x20,%al
+f0106a14:	74 f6                	je     f0106a0c <strtol+0xe>
+f0106a16:	3c 09                	cmp    $0x9,%al
+f0106a18:	74 f2                	je     f0106a0c <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+f0106a1a:	3c 2b                	cmp    $0x2b,%al
+f0106a1c:	74 2a                	je     f0106a48 <strtol+0x4a>
+	int neg = 0;
+f0106a1e:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+f0106a23:	3c 2d                	cmp    $0x2d,%al
+f0106a25:	74 2b                	je     f0106a52 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+f0106a27:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+f0106a2d:	75 0f                	jne    f0106a3e <strtol+0x40>
+f0106a2f:	80 3a 30             	cmpb   $0x30,(%edx)
+f0106a32:	74 28                	je     f0106a5c <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+f0106a34:	85 db                	test   %ebx,%ebx
+f0106a36:	b8 0a 00 00 00       	mov    $0xa,%eax
+f0106a3b:	0f 44 d8             	cmove  %eax,%ebx
+f0106a3e:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0106a43:	89 5d 10             	mov    %ebx,0x10(%ebp)
+f0106a46:	eb 46                	jmp    f0106a8e <strtol+0x90>
+		s++;
+f0106a48:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+f0106a4b:	bf 00 00 00 00       	mov    $0x0,%edi
+f0106a50:	eb d5                	jmp    f0106a27 <strtol+0x29>
+		s++, neg = 1;
+f0106a52:	83 c2 01             	add    $0x1,%edx
+f0106a55:	bf 01 00 00 00       	mov    $0x1,%edi
+f0106a5a:	eb cb                	jmp    f0106a27 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+f0106a5c:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+f0106a60:	74 0e                	je     f0106a70 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+f0106a62:	85 db                	test   %ebx,%ebx
+f0106a64:	75 d8                	jne    f0106a3e <strtol+0x40>
+		s++, base = 8;
+f0106a66:	83 c2 01             	add    $0x1,%edx
+f0106a69:	bb 08 00 00 00       	mov    $0x8,%ebx
+f0106a6e:	eb ce                	jmp    f0106a3e <strtol+0x40>
+		s += 2, base = 16;
+f0106a70:	83 c2 02             	add    $0x2,%edx
+f0106a73:	bb 10 00 00 00       	mov    $0x10,%ebx
+f0106a78:	eb c4                	jmp    f0106a3e <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+f0106a7a:	0f be c0             	movsbl %al,%eax
+f0106a7d:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+f0106a80:	3b 45 10             	cmp    0x10(%ebp),%eax
+f0106a83:	7d 3a                	jge    f0106abf <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+f0106a85:	83 c2 01             	add    $0x1,%edx
+f0106a88:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+f0106a8c:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+f0106a8e:	0f b6 02             	movzbl (%edx),%eax
+f0106a91:	8d 70 d0             	lea    -0x30(%eax),%esi
+f0106a94:	89 f3                	mov    %esi,%ebx
+f0106a96:	80 fb 09             	cmp    $0x9,%bl
+f0106a99:	76 df                	jbe    f0106a7a <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+f0106a9b:	8d 70 9f             	lea    -0x61(%eax),%esi
+f0106a9e:	89 f3                	mov    %esi,%ebx
+f0106aa0:	80 fb 19             	cmp    $0x19,%bl
+f0106aa3:	77 08                	ja     f0106aad <strtol+0xaf>
+			dig = *s - 'a' + 10;
+f0106aa5:	0f be c0             	movsbl %al,%eax
+f0106aa8:	83 e8 57             	sub    $0x57,%eax
+f0106aab:	eb d3                	jmp    f0106a80 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+f0106aad:	8d 70 bf             	lea    -0x41(%eax),%esi
+f0106ab0:	89 f3                	mov    %esi,%ebx
+f0106ab2:	80 fb 19             	cmp    $0x19,%bl
+f0106ab5:	77 08                	ja     f0106abf <strtol+0xc1>
+			dig = *s - 'A' + 10;
+f0106ab7:	0f be c0             	movsbl %al,%eax
+f0106aba:	83 e8 37             	sub    $0x37,%eax
+f0106abd:	eb c1                	jmp    f0106a80 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+f0106abf:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+f0106ac3:	74 05                	je     f0106aca <strtol+0xcc>
+		*endptr = (char *) s;
+f0106ac5:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0106ac8:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+f0106aca:	89 c8                	mov    %ecx,%eax
+f0106acc:	f7 d8                	neg    %eax
+f0106ace:	85 ff                	test   %edi,%edi
+f0106ad0:	0f 45 c8             	cmovne %eax,%ecx
+}
+f0106ad3:	89 c8                	mov    %ecx,%eax
+f0106ad5:	5b                   	pop    %ebx
+f0106ad6:	5e                   	pop    %esi
+f0106ad7:	5f                   	pop    %edi
+f0106ad8:	5d                   	pop    %ebp
+f0106ad9:	c3                   	ret
+f0106ada:	66 90                	xchg   %ax,%ax
+
+f0106adc <mpentry_start>:
+.set PROT_MODE_DSEG, 0x10	# kernel data segment selector
+
+.code16           
+.globl mpentry_start
+mpentry_start:
+	cli            
+f0106adc:	fa                   	cli
+
+	xorw    %ax, %ax
+f0106add:	31 c0                	xor    %eax,%eax
+	movw    %ax, %ds
+f0106adf:	8e d8                	mov    %eax,%ds
+	movw    %ax, %es
+f0106ae1:	8e c0                	mov    %eax,%es
+	movw    %ax, %ss
+f0106ae3:	8e d0                	mov    %eax,%ss
+
+	lgdt    MPBOOTPHYS(gdtdesc)
+f0106ae5:	0f 01 16             	lgdtl  (%esi)
+f0106ae8:	7c 70                	jl     f0106b5a <gdtdesc+0x2>
+	movl    %cr0, %eax
+f0106aea:	0f 20 c0             	mov    %cr0,%eax
+	orl     $CR0_PE, %eax
+f0106aed:	66 83 c8 01          	or     $0x1,%ax
+	movl    %eax, %cr0
+f0106af1:	0f 22 c0             	mov    %eax,%cr0
+
+	ljmpl   $(PROT_MODE_CSEG), $(MPBOOTPHYS(start32))
+f0106af4:	66 ea 20 70 00 00    	ljmpw  $0x0,$0x7020
+f0106afa:	08 00                	or     %al,(%eax)
+
+f0106afc <start32>:
+
+.code32
+start32:
+	movw    $(PROT_MODE_DSEG), %ax
+f0106afc:	66 b8 10 00          	mov    $0x10,%ax
+	movw    %ax, %ds
+f0106b00:	8e d8                	mov    %eax,%ds
+	movw    %ax, %es
+f0106b02:	8e c0                	mov    %eax,%es
+	movw    %ax, %ss
+f0106b04:	8e d0                	mov    %eax,%ss
+	movw    $0, %ax
+f0106b06:	66 b8 00 00          	mov    $0x0,%ax
+	movw    %ax, %fs
+f0106b0a:	8e e0                	mov    %eax,%fs
+	movw    %ax, %gs
+f0106b0c:	8e e8                	mov    %eax,%gs
+
+	# Set up initial page table. We cannot use kern_pgdir yet because
+	# we are still running at a low EIP.
+	movl    $(RELOC(entry_pgdir)), %eax
+f0106b0e:	b8 00 50 11 00       	mov    $0x115000,%eax
+	movl    %eax, %cr3
+f0106b13:	0f 22 d8             	mov    %eax,%cr3
+	# Turn on huge page
+	movl    %cr4, %eax
+f0106b16:	0f 20 e0             	mov    %cr4,%eax
+	orl     $(CR4_PSE), %eax
+f0106b19:	83 c8 10             	or     $0x10,%eax
+	movl    %eax, %cr4
+f0106b1c:	0f 22 e0             	mov    %eax,%cr4
+	# Turn on paging.
+	movl    %cr0, %eax
+f0106b1f:	0f 20 c0             	mov    %cr0,%eax
+	orl     $(CR0_PE|CR0_PG|CR0_WP), %eax
+f0106b22:	0d 01 00 01 80       	or     $0x80010001,%eax
+	movl    %eax, %cr0
+f0106b27:	0f 22 c0             	mov    %eax,%cr0
+
+	# Switch to the per-cpu stack allocated in boot_aps()
+	movl    mpentry_kstack, %esp
+f0106b2a:	8b 25 c4 76 66 f0    	mov    0xf06676c4,%esp
+	movl    $0x0, %ebp       # nuke frame pointer
+f0106b30:	bd 00 00 00 00       	mov    $0x0,%ebp
+
+	# Call mp_main().  (Exercise for the reader: why the indirect call?)
+	movl    $mp_main, %eax
+f0106b35:	b8 f2 01 10 f0       	mov    $0xf01001f2,%eax
+	call    *%eax
+f0106b3a:	ff d0                	call   *%eax
+
+f0106b3c <spin>:
+
+	# If mp_main returns (it shouldn't), loop.
+spin:
+	jmp     spin
+f0106b3c:	eb fe                	jmp    f0106b3c <spin>
+f0106b3e:	66 90                	xchg   %ax,%ax
+
+f0106b40 <gdt>:
+	...
+f0106b48:	ff                   	(bad)
+f0106b49:	ff 00                	incl   (%eax)
+f0106b4b:	00 00                	add    %al,(%eax)
+f0106b4d:	9a cf 00 ff ff 00 00 	lcall  $0x0,$0xffff00cf
+f0106b54:	00                   	.byte 0x0
+f0106b55:	92                   	xchg   %eax,%edx
+f0106b56:	cf                   	iret
+	...
+
+f0106b58 <gdtdesc>:
+f0106b58:	17                   	pop    %ss
+f0106b59:	00 64 70 00          	add    %ah,0x0(%eax,%esi,2)
+	...
+
+f0106b5e <mpentry_end>:
+	.word   0x17				# sizeof(gdt) - 1
+	.long   MPBOOTPHYS(gdt)			# address gdt
+
+.globl mpentry_end
+mpentry_end:
+	nop
+f0106b5e:	90                   	nop
+
+f0106b5f <mpsearch1>:
+}
+
+// Look for an MP structure in the len bytes at physical address addr.
+static struct mp *
+mpsearch1(physaddr_t a, int len)
+{
+f0106b5f:	55                   	push   %ebp
+f0106b60:	89 e5                	mov    %esp,%ebp
+f0106b62:	57                   	push   %edi
+f0106b63:	56                   	push   %esi
+f0106b64:	53                   	push   %ebx
+f0106b65:	83 ec 0c             	sub    $0xc,%esp
+f0106b68:	89 c3                	mov    %eax,%ebx
+f0106b6a:	89 d7                	mov    %edx,%edi
+	if (PGNUM(pa) >= npages)
+f0106b6c:	a1 c8 76 66 f0       	mov    0xf06676c8,%eax
+f0106b71:	89 da                	mov    %ebx,%edx
+f0106b73:	c1 ea 0c             	shr    $0xc,%edx
+f0106b76:	39 c2                	cmp    %eax,%edx
+f0106b78:	73 1f                	jae    f0106b99 <mpsearch1+0x3a>
+	return (void *)(pa + KERNBASE);
+f0106b7a:	8d b3 00 00 00 f0    	lea    -0x10000000(%ebx),%esi
+	struct mp *mp = KADDR(a), *end = KADDR(a + len);
+f0106b80:	01 df                	add    %ebx,%edi
+	if (PGNUM(pa) >= npages)
+f0106b82:	89 fa                	mov    %edi,%edx
+f0106b84:	c1 ea 0c             	shr    $0xc,%edx
+f0106b87:	39 c2                	cmp    %eax,%edx
+f0106b89:	73 20                	jae    f0106bab <mpsearch1+0x4c>
+	return (void *)(pa + KERNBASE);
+f0106b8b:	81 ef 00 00 00 10    	sub    $0x10000000,%edi
+
+	for (; mp < end; mp++)
+f0106b91:	81 eb f0 ff ff 0f    	sub    $0xffffff0,%ebx
+f0106b97:	eb 3a                	jmp    f0106bd3 <mpsearch1+0x74>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0106b99:	53                   	push   %ebx
+f0106b9a:	68 64 82 10 f0       	push   $0xf0108264
+f0106b9f:	6a 58                	push   $0x58
+f0106ba1:	68 a1 a1 10 f0       	push   $0xf010a1a1
+f0106ba6:	e8 a7 94 ff ff       	call   f0100052 <_panic>
+f0106bab:	57                   	push   %edi
+f0106bac:	68 64 82 10 f0       	push   $0xf0108264
+f0106bb1:	6a 58                	push   $0x58
+f0106bb3:	68 a1 a1 10 f0       	push   $0xf010a1a1
+f0106bb8:	e8 95 94 ff ff       	call   f0100052 <_panic>
+		sum += ((uint8_t *)addr)[i];
+f0106bbd:	0f b6 0a             	movzbl (%edx),%ecx
+f0106bc0:	01 c8                	add    %ecx,%eax
+	for (i = 0; i < len; i++)
+f0106bc2:	83 c2 01             	add    $0x1,%edx
+f0106bc5:	39 da                	cmp    %ebx,%edx
+f0106bc7:	75 f4                	jne    f0106bbd <mpsearch1+0x5e>
+		if (memcmp(mp->signature, "_MP_", 4) == 0 &&
+f0106bc9:	84 c0                	test   %al,%al
+f0106bcb:	74 2a                	je     f0106bf7 <mpsearch1+0x98>
+	for (; mp < end; mp++)
+f0106bcd:	83 c6 10             	add    $0x10,%esi
+f0106bd0:	83 c3 10             	add    $0x10,%ebx
+f0106bd3:	39 fe                	cmp    %edi,%esi
+f0106bd5:	73 1b                	jae    f0106bf2 <mpsearch1+0x93>
+		if (memcmp(mp->signature, "_MP_", 4) == 0 &&
+f0106bd7:	83 ec 04             	sub    $0x4,%esp
+f0106bda:	6a 04                	push   $0x4
+f0106bdc:	68 b1 a1 10 f0       	push   $0xf010a1b1
+f0106be1:	56                   	push   %esi
+f0106be2:	e8 c1 fd ff ff       	call   f01069a8 <memcmp>
+f0106be7:	83 c4 10             	add    $0x10,%esp
+f0106bea:	89 f2                	mov    %esi,%edx
+f0106bec:	85 c0                	test   %eax,%eax
+f0106bee:	74 d5                	je     f0106bc5 <mpsearch1+0x66>
+f0106bf0:	eb db                	jmp    f0106bcd <mpsearch1+0x6e>
+		    sum(mp, sizeof(*mp)) == 0)
+			return mp;
+	return NULL;
+f0106bf2:	be 00 00 00 00       	mov    $0x0,%esi
+}
+f0106bf7:	89 f0                	mov    %esi,%eax
+f0106bf9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0106bfc:	5b                   	pop    %ebx
+f0106bfd:	5e                   	pop    %esi
+f0106bfe:	5f                   	pop    %edi
+f0106bff:	5d                   	pop    %ebp
+f0106c00:	c3                   	ret
+
+f0106c01 <mp_init>:
+	return conf;
+}
+
+void
+mp_init(void)
+{
+f0106c01:	55                   	push   %ebp
+f0106c02:	89 e5                	mov    %esp,%ebp
+f0106c04:	57                   	push   %edi
+f0106c05:	56                   	push   %esi
+f0106c06:	53                   	push   %ebx
+f0106c07:	83 ec 1c             	sub    $0x1c,%esp
+	struct mpconf *conf;
+	struct mpproc *proc;
+	uint8_t *p;
+	unsigned int i;
+
+	bootcpu = &cpus[0];
+f0106c0a:	c7 05 04 80 66 f0 00 	movl   $0xf0114900,0xf0668004
+f0106c11:	49 11 f0 
+	if (PGNUM(pa) >= npages)
+f0106c14:	83 3d c8 76 66 f0 00 	cmpl   $0x0,0xf06676c8
+f0106c1b:	0f 84 86 00 00 00    	je     f0106ca7 <mp_init+0xa6>
+	if ((p = *(uint16_t *) (bda + 0x0E))) {
+f0106c21:	0f b7 05 0e 04 00 f0 	movzwl 0xf000040e,%eax
+f0106c28:	85 c0                	test   %eax,%eax
+f0106c2a:	0f 84 8d 00 00 00    	je     f0106cbd <mp_init+0xbc>
+		p <<= 4;	// Translate from segment to PA
+f0106c30:	c1 e0 04             	shl    $0x4,%eax
+		if ((mp = mpsearch1(p, 1024)))
+f0106c33:	ba 00 04 00 00       	mov    $0x400,%edx
+f0106c38:	e8 22 ff ff ff       	call   f0106b5f <mpsearch1>
+f0106c3d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0106c40:	85 c0                	test   %eax,%eax
+f0106c42:	75 1a                	jne    f0106c5e <mp_init+0x5d>
+	return mpsearch1(0xF0000, 0x10000);
+f0106c44:	ba 00 00 01 00       	mov    $0x10000,%edx
+f0106c49:	b8 00 00 0f 00       	mov    $0xf0000,%eax
+f0106c4e:	e8 0c ff ff ff       	call   f0106b5f <mpsearch1>
+f0106c53:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((mp = mpsearch()) == 0)
+f0106c56:	85 c0                	test   %eax,%eax
+f0106c58:	0f 84 27 02 00 00    	je     f0106e85 <mp_init+0x284>
+	if (mp->physaddr == 0 || mp->type != 0) {
+f0106c5e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0106c61:	8b 58 04             	mov    0x4(%eax),%ebx
+f0106c64:	85 db                	test   %ebx,%ebx
+f0106c66:	74 7a                	je     f0106ce2 <mp_init+0xe1>
+f0106c68:	80 78 0b 00          	cmpb   $0x0,0xb(%eax)
+f0106c6c:	75 74                	jne    f0106ce2 <mp_init+0xe1>
+f0106c6e:	89 d8                	mov    %ebx,%eax
+f0106c70:	c1 e8 0c             	shr    $0xc,%eax
+f0106c73:	3b 05 c8 76 66 f0    	cmp    0xf06676c8,%eax
+f0106c79:	73 7c                	jae    f0106cf7 <mp_init+0xf6>
+	return (void *)(pa + KERNBASE);
+f0106c7b:	81 eb 00 00 00 10    	sub    $0x10000000,%ebx
+f0106c81:	89 de                	mov    %ebx,%esi
+	if (memcmp(conf, "PCMP", 4) != 0) {
+f0106c83:	83 ec 04             	sub    $0x4,%esp
+f0106c86:	6a 04                	push   $0x4
+f0106c88:	68 b6 a1 10 f0       	push   $0xf010a1b6
+f0106c8d:	53                   	push   %ebx
+f0106c8e:	e8 15 fd ff ff       	call   f01069a8 <memcmp>
+f0106c93:	83 c4 10             	add    $0x10,%esp
+f0106c96:	85 c0                	test   %eax,%eax
+f0106c98:	75 72                	jne    f0106d0c <mp_init+0x10b>
+	for (i = 0; i < len; i++)
+f0106c9a:	0f b7 7b 04          	movzwl 0x4(%ebx),%edi
+f0106c9e:	01 df                	add    %ebx,%edi
+	sum = 0;
+f0106ca0:	89 c2                	mov    %eax,%edx
+	for (i = 0; i < len; i++)
+f0106ca2:	e9 82 00 00 00       	jmp    f0106d29 <mp_init+0x128>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0106ca7:	68 00 04 00 00       	push   $0x400
+f0106cac:	68 64 82 10 f0       	push   $0xf0108264
+f0106cb1:	6a 70                	push   $0x70
+f0106cb3:	68 a1 a1 10 f0       	push   $0xf010a1a1
+f0106cb8:	e8 95 93 ff ff       	call   f0100052 <_panic>
+		p = *(uint16_t *) (bda + 0x13) * 1024;
+f0106cbd:	0f b7 05 13 04 00 f0 	movzwl 0xf0000413,%eax
+f0106cc4:	c1 e0 0a             	shl    $0xa,%eax
+		if ((mp = mpsearch1(p - 1024, 1024)))
+f0106cc7:	2d 00 04 00 00       	sub    $0x400,%eax
+f0106ccc:	ba 00 04 00 00       	mov    $0x400,%edx
+f0106cd1:	e8 89 fe ff ff       	call   f0106b5f <mpsearch1>
+f0106cd6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0106cd9:	85 c0                	test   %eax,%eax
+f0106cdb:	75 81                	jne    f0106c5e <mp_init+0x5d>
+f0106cdd:	e9 62 ff ff ff       	jmp    f0106c44 <mp_init+0x43>
+		cprintf("SMP: Default configurations not implemented\n");
+f0106ce2:	83 ec 0c             	sub    $0xc,%esp
+f0106ce5:	68 14 a0 10 f0       	push   $0xf010a014
+f0106cea:	e8 eb d6 ff ff       	call   f01043da <cprintf>
+		return NULL;
+f0106cef:	83 c4 10             	add    $0x10,%esp
+f0106cf2:	e9 8e 01 00 00       	jmp    f0106e85 <mp_init+0x284>
+f0106cf7:	53                   	push   %ebx
+f0106cf8:	68 64 82 10 f0       	push   $0xf0108264
+f0106cfd:	68 91 00 00 00       	push   $0x91
+f0106d02:	68 a1 a1 10 f0       	push   $0xf010a1a1
+f0106d07:	e8 46 93 ff ff       	call   f0100052 <_panic>
+		cprintf("SMP: Incorrect MP configuration table signature\n");
+f0106d0c:	83 ec 0c             	sub    $0xc,%esp
+f0106d0f:	68 44 a0 10 f0       	push   $0xf010a044
+f0106d14:	e8 c1 d6 ff ff       	call   f01043da <cprintf>
+		return NULL;
+f0106d19:	83 c4 10             	add    $0x10,%esp
+f0106d1c:	e9 64 01 00 00       	jmp    f0106e85 <mp_init+0x284>
+		sum += ((uint8_t *)addr)[i];
+f0106d21:	0f b6 0b             	movzbl (%ebx),%ecx
+f0106d24:	01 ca                	add    %ecx,%edx
+	for (i = 0; i < len; i++)
+f0106d26:	83 c3 01             	add    $0x1,%ebx
+f0106d29:	39 fb                	cmp    %edi,%ebx
+f0106d2b:	75 f4                	jne    f0106d21 <mp_init+0x120>
+	if (sum(conf, conf->length) != 0) {
+f0106d2d:	84 d2                	test   %dl,%dl
+f0106d2f:	75 16                	jne    f0106d47 <mp_init+0x146>
+	if (conf->version != 1 && conf->version != 4) {
+f0106d31:	0f b6 56 06          	movzbl 0x6(%esi),%edx
+f0106d35:	80 fa 01             	cmp    $0x1,%dl
+f0106d38:	74 05                	je     f0106d3f <mp_init+0x13e>
+f0106d3a:	80 fa 04             	cmp    $0x4,%dl
+f0106d3d:	75 1d                	jne    f0106d5c <mp_init+0x15b>
+	for (i = 0; i < len; i++)
+f0106d3f:	0f b7 4e 28          	movzwl 0x28(%esi),%ecx
+f0106d43:	01 d9                	add    %ebx,%ecx
+f0106d45:	eb 36                	jmp    f0106d7d <mp_init+0x17c>
+		cprintf("SMP: Bad MP configuration checksum\n");
+f0106d47:	83 ec 0c             	sub    $0xc,%esp
+f0106d4a:	68 78 a0 10 f0       	push   $0xf010a078
+f0106d4f:	e8 86 d6 ff ff       	call   f01043da <cprintf>
+		return NULL;
+f0106d54:	83 c4 10             	add    $0x10,%esp
+f0106d57:	e9 29 01 00 00       	jmp    f0106e85 <mp_init+0x284>
+		cprintf("SMP: Unsupported MP version %d\n", conf->version);
+f0106d5c:	83 ec 08             	sub    $0x8,%esp
+f0106d5f:	0f b6 d2             	movzbl %dl,%edx
+f0106d62:	52                   	push   %edx
+f0106d63:	68 9c a0 10 f0       	push   $0xf010a09c
+f0106d68:	e8 6d d6 ff ff       	call   f01043da <cprintf>
+		return NULL;
+f0106d6d:	83 c4 10             	add    $0x10,%esp
+f0106d70:	e9 10 01 00 00       	jmp    f0106e85 <mp_init+0x284>
+		sum += ((uint8_t *)addr)[i];
+f0106d75:	0f b6 13             	movzbl (%ebx),%edx
+f0106d78:	01 d0                	add    %edx,%eax
+	for (i = 0; i < len; i++)
+f0106d7a:	83 c3 01             	add    $0x1,%ebx
+f0106d7d:	39 d9                	cmp    %ebx,%ecx
+f0106d7f:	75 f4                	jne    f0106d75 <mp_init+0x174>
+	if ((sum((uint8_t *)conf + conf->length, conf->xlength) + conf->xchecksum) & 0xff) {
+f0106d81:	02 46 2a             	add    0x2a(%esi),%al
+f0106d84:	75 1c                	jne    f0106da2 <mp_init+0x1a1>
+	if ((conf = mpconfig(&mp)) == 0)
+		return;
+	ismp = 1;
+f0106d86:	c7 05 00 80 66 f0 01 	movl   $0x1,0xf0668000
+f0106d8d:	00 00 00 
+	lapicaddr = conf->lapicaddr;
+f0106d90:	8b 46 24             	mov    0x24(%esi),%eax
+f0106d93:	a3 00 90 6a f0       	mov    %eax,0xf06a9000
+
+	for (p = conf->entries, i = 0; i < conf->entry; i++) {
+f0106d98:	8d 7e 2c             	lea    0x2c(%esi),%edi
+f0106d9b:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0106da0:	eb 53                	jmp    f0106df5 <mp_init+0x1f4>
+		cprintf("SMP: Bad MP configuration extended checksum\n");
+f0106da2:	83 ec 0c             	sub    $0xc,%esp
+f0106da5:	68 bc a0 10 f0       	push   $0xf010a0bc
+f0106daa:	e8 2b d6 ff ff       	call   f01043da <cprintf>
+		return NULL;
+f0106daf:	83 c4 10             	add    $0x10,%esp
+f0106db2:	e9 ce 00 00 00       	jmp    f0106e85 <mp_init+0x284>
+		switch (*p) {
+		case MPPROC:
+			proc = (struct mpproc *)p;
+			if (proc->flags & MPPROC_BOOT)
+f0106db7:	f6 47 03 02          	testb  $0x2,0x3(%edi)
+f0106dbb:	74 14                	je     f0106dd1 <mp_init+0x1d0>
+				bootcpu = &cpus[ncpu];
+f0106dbd:	69 05 08 80 66 f0 84 	imul   $0x84,0xf0668008,%eax
+f0106dc4:	00 00 00 
+f0106dc7:	05 00 49 11 f0       	add    $0xf0114900,%eax
+f0106dcc:	a3 04 80 66 f0       	mov    %eax,0xf0668004
+			if (ncpu < NCPU) {
+f0106dd1:	a1 08 80 66 f0       	mov    0xf0668008,%eax
+f0106dd6:	83 f8 07             	cmp    $0x7,%eax
+f0106dd9:	7f 36                	jg     f0106e11 <mp_init+0x210>
+				cpus[ncpu].cpu_id = ncpu;
+f0106ddb:	69 d0 84 00 00 00    	imul   $0x84,%eax,%edx
+f0106de1:	88 82 04 49 11 f0    	mov    %al,-0xfeeb6fc(%edx)
+				ncpu++;
+f0106de7:	83 c0 01             	add    $0x1,%eax
+f0106dea:	a3 08 80 66 f0       	mov    %eax,0xf0668008
+			} else {
+				cprintf("SMP: too many CPUs, CPU %d disabled\n",
+					proc->apicid);
+			}
+			p += sizeof(struct mpproc);
+f0106def:	83 c7 14             	add    $0x14,%edi
+	for (p = conf->entries, i = 0; i < conf->entry; i++) {
+f0106df2:	83 c3 01             	add    $0x1,%ebx
+f0106df5:	0f b7 46 22          	movzwl 0x22(%esi),%eax
+f0106df9:	39 c3                	cmp    %eax,%ebx
+f0106dfb:	73 4f                	jae    f0106e4c <mp_init+0x24b>
+		switch (*p) {
+f0106dfd:	0f b6 07             	movzbl (%edi),%eax
+f0106e00:	84 c0                	test   %al,%al
+f0106e02:	74 b3                	je     f0106db7 <mp_init+0x1b6>
+f0106e04:	8d 50 ff             	lea    -0x1(%eax),%edx
+f0106e07:	80 fa 03             	cmp    $0x3,%dl
+f0106e0a:	77 1c                	ja     f0106e28 <mp_init+0x227>
+			continue;
+		case MPBUS:
+		case MPIOAPIC:
+		case MPIOINTR:
+		case MPLINTR:
+			p += 8;
+f0106e0c:	83 c7 08             	add    $0x8,%edi
+			continue;
+f0106e0f:	eb e1                	jmp    f0106df2 <mp_init+0x1f1>
+				cprintf("SMP: too many CPUs, CPU %d disabled\n",
+f0106e11:	83 ec 08             	sub    $0x8,%esp
+f0106e14:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+f0106e18:	50                   	push   %eax
+f0106e19:	68 ec a0 10 f0       	push   $0xf010a0ec
+f0106e1e:	e8 b7 d5 ff ff       	call   f01043da <cprintf>
+f0106e23:	83 c4 10             	add    $0x10,%esp
+f0106e26:	eb c7                	jmp    f0106def <mp_init+0x1ee>
+		default:
+			cprintf("mpinit: unknown config type %x\n", *p);
+f0106e28:	83 ec 08             	sub    $0x8,%esp
+		switch (*p) {
+f0106e2b:	0f b6 c0             	movzbl %al,%eax
+			cprintf("mpinit: unknown config type %x\n", *p);
+f0106e2e:	50                   	push   %eax
+f0106e2f:	68 14 a1 10 f0       	push   $0xf010a114
+f0106e34:	e8 a1 d5 ff ff       	call   f01043da <cprintf>
+			ismp = 0;
+f0106e39:	c7 05 00 80 66 f0 00 	movl   $0x0,0xf0668000
+f0106e40:	00 00 00 
+			i = conf->entry;
+f0106e43:	0f b7 5e 22          	movzwl 0x22(%esi),%ebx
+f0106e47:	83 c4 10             	add    $0x10,%esp
+f0106e4a:	eb a6                	jmp    f0106df2 <mp_init+0x1f1>
+		}
+	}
+
+	bootcpu->cpu_status = CPU_STARTED;
+f0106e4c:	a1 04 80 66 f0       	mov    0xf0668004,%eax
+f0106e51:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	if (!ismp) {
+f0106e58:	83 3d 00 80 66 f0 00 	cmpl   $0x0,0xf0668000
+f0106e5f:	74 2c                	je     f0106e8d <mp_init+0x28c>
+		ncpu = 1;
+		lapicaddr = 0;
+		cprintf("SMP: configuration not found, SMP disabled\n");
+		return;
+	}
+	cprintf("SMP: CPU %d found %d CPU(s)\n", bootcpu->cpu_id,  ncpu);
+f0106e61:	83 ec 04             	sub    $0x4,%esp
+f0106e64:	ff 35 08 80 66 f0    	push   0xf0668008
+f0106e6a:	0f b6 40 04          	movzbl 0x4(%eax),%eax
+f0106e6e:	50                   	push   %eax
+f0106e6f:	68 bb a1 10 f0       	push   $0xf010a1bb
+f0106e74:	e8 61 d5 ff ff       	call   f01043da <cprintf>
+
+	if (mp->imcrp) {
+f0106e79:	83 c4 10             	add    $0x10,%esp
+f0106e7c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0106e7f:	80 78 0c 00          	cmpb   $0x0,0xc(%eax)
+f0106e83:	75 2e                	jne    f0106eb3 <mp_init+0x2b2>
+		// switch to getting interrupts from the LAPIC.
+		cprintf("SMP: Setting IMCR to switch from PIC mode to symmetric I/O mode\n");
+		outb(0x22, 0x70);   // Select IMCR
+		outb(0x23, inb(0x23) | 1);  // Mask external interrupts.
+	}
+}
+f0106e85:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0106e88:	5b                   	pop    %ebx
+f0106e89:	5e                   	pop    %esi
+f0106e8a:	5f                   	pop    %edi
+f0106e8b:	5d                   	pop    %ebp
+f0106e8c:	c3                   	ret
+		ncpu = 1;
+f0106e8d:	c7 05 08 80 66 f0 01 	movl   $0x1,0xf0668008
+f0106e94:	00 00 00 
+		lapicaddr = 0;
+f0106e97:	c7 05 00 90 6a f0 00 	movl   $0x0,0xf06a9000
+f0106e9e:	00 00 00 
+		cprintf("SMP: configuration not found, SMP disabled\n");
+f0106ea1:	83 ec 0c             	sub    $0xc,%esp
+f0106ea4:	68 34 a1 10 f0       	push   $0xf010a134
+f0106ea9:	e8 2c d5 ff ff       	call   f01043da <cprintf>
+		return;
+f0106eae:	83 c4 10             	add    $0x10,%esp
+f0106eb1:	eb d2                	jmp    f0106e85 <mp_init+0x284>
+		cprintf("SMP: Setting IMCR to switch from PIC mode to symmetric I/O mode\n");
+f0106eb3:	83 ec 0c             	sub    $0xc,%esp
+f0106eb6:	68 60 a1 10 f0       	push   $0xf010a160
+f0106ebb:	e8 1a d5 ff ff       	call   f01043da <cprintf>
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0106ec0:	b8 70 00 00 00       	mov    $0x70,%eax
+f0106ec5:	ba 22 00 00 00       	mov    $0x22,%edx
+f0106eca:	ee                   	out    %al,(%dx)
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f0106ecb:	ba 23 00 00 00       	mov    $0x23,%edx
+f0106ed0:	ec                   	in     (%dx),%al
+		outb(0x23, inb(0x23) | 1);  // Mask external interrupts.
+f0106ed1:	83 c8 01             	or     $0x1,%eax
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0106ed4:	ee                   	out    %al,(%dx)
+}
+f0106ed5:	83 c4 10             	add    $0x10,%esp
+f0106ed8:	eb ab                	jmp    f0106e85 <mp_init+0x284>
+
+f0106eda <lapicw>:
+volatile uint32_t *lapic;
+
+static void
+lapicw(int index, int value)
+{
+	lapic[index] = value;
+f0106eda:	8b 0d 04 90 6a f0    	mov    0xf06a9004,%ecx
+f0106ee0:	8d 04 81             	lea    (%ecx,%eax,4),%eax
+f0106ee3:	89 10                	mov    %edx,(%eax)
+	lapic[ID];  // wait for write to finish, by reading
+f0106ee5:	a1 04 90 6a f0       	mov    0xf06a9004,%eax
+f0106eea:	8b 40 20             	mov    0x20(%eax),%eax
+}
+f0106eed:	c3                   	ret
+
+f0106eee <lapic_init>:
+
+void
+lapic_init(void)
+{
+	if (!lapicaddr)
+f0106eee:	a1 00 90 6a f0       	mov    0xf06a9000,%eax
+f0106ef3:	85 c0                	test   %eax,%eax
+f0106ef5:	75 01                	jne    f0106ef8 <lapic_init+0xa>
+f0106ef7:	c3                   	ret
+{
+f0106ef8:	55                   	push   %ebp
+f0106ef9:	89 e5                	mov    %esp,%ebp
+f0106efb:	83 ec 10             	sub    $0x10,%esp
+		return;
+
+	// lapicaddr is the physical address of the LAPIC's 4K MMIO
+	// region.  Map it in to virtual memory so we can access it.
+	lapic = mmio_map_region(lapicaddr, 4096);
+f0106efe:	68 00 10 00 00       	push   $0x1000
+f0106f03:	50                   	push   %eax
+f0106f04:	e8 9a a5 ff ff       	call   f01014a3 <mmio_map_region>
+f0106f09:	a3 04 90 6a f0       	mov    %eax,0xf06a9004
+
+	// Enable local APIC; set spurious interrupt vector.
+	lapicw(SVR, ENABLE | (IRQ_OFFSET + IRQ_SPURIOUS));
+f0106f0e:	ba 27 01 00 00       	mov    $0x127,%edx
+f0106f13:	b8 3c 00 00 00       	mov    $0x3c,%eax
+f0106f18:	e8 bd ff ff ff       	call   f0106eda <lapicw>
+
+	// The timer repeatedly counts down at bus frequency
+	// from lapic[TICR] and then issues an interrupt.  
+	// If we cared more about precise timekeeping,
+	// TICR would be calibrated using an external time source.
+	lapicw(TDCR, X1);
+f0106f1d:	ba 0b 00 00 00       	mov    $0xb,%edx
+f0106f22:	b8 f8 00 00 00       	mov    $0xf8,%eax
+f0106f27:	e8 ae ff ff ff       	call   f0106eda <lapicw>
+	lapicw(TIMER, PERIODIC | (IRQ_OFFSET + IRQ_TIMER));
+f0106f2c:	ba 20 00 02 00       	mov    $0x20020,%edx
+f0106f31:	b8 c8 00 00 00       	mov    $0xc8,%eax
+f0106f36:	e8 9f ff ff ff       	call   f0106eda <lapicw>
+	lapicw(TICR, 10000000); 
+f0106f3b:	ba 80 96 98 00       	mov    $0x989680,%edx
+f0106f40:	b8 e0 00 00 00       	mov    $0xe0,%eax
+f0106f45:	e8 90 ff ff ff       	call   f0106eda <lapicw>
+f0106f4a:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+	//
+	// According to Intel MP Specification, the BIOS should initialize
+	// BSP's local APIC in Virtual Wire Mode, in which 8259A's
+	// INTR is virtually connected to BSP's LINTIN0. In this mode,
+	// we do not need to program the IOAPIC.
+	if (thiscpu != bootcpu)
+f0106f50:	83 c4 10             	add    $0x10,%esp
+f0106f53:	39 05 04 80 66 f0    	cmp    %eax,0xf0668004
+f0106f59:	74 0f                	je     f0106f6a <lapic_init+0x7c>
+		lapicw(LINT0, MASKED);
+f0106f5b:	ba 00 00 01 00       	mov    $0x10000,%edx
+f0106f60:	b8 d4 00 00 00       	mov    $0xd4,%eax
+f0106f65:	e8 70 ff ff ff       	call   f0106eda <lapicw>
+
+	// Disable NMI (LINT1) on all CPUs
+	lapicw(LINT1, MASKED);
+f0106f6a:	ba 00 00 01 00       	mov    $0x10000,%edx
+f0106f6f:	b8 d8 00 00 00       	mov    $0xd8,%eax
+f0106f74:	e8 61 ff ff ff       	call   f0106eda <lapicw>
+
+	// Disable performance counter overflow interrupts
+	// on machines that provide that interrupt entry.
+	if (((lapic[VER]>>16) & 0xFF) >= 4)
+f0106f79:	a1 04 90 6a f0       	mov    0xf06a9004,%eax
+f0106f7e:	8b 40 30             	mov    0x30(%eax),%eax
+f0106f81:	c1 e8 10             	shr    $0x10,%eax
+f0106f84:	a8 fc                	test   $0xfc,%al
+f0106f86:	75 7c                	jne    f0107004 <lapic_init+0x116>
+		lapicw(PCINT, MASKED);
+
+	// Map error interrupt to IRQ_ERROR.
+	lapicw(ERROR, IRQ_OFFSET + IRQ_ERROR);
+f0106f88:	ba 33 00 00 00       	mov    $0x33,%edx
+f0106f8d:	b8 dc 00 00 00       	mov    $0xdc,%eax
+f0106f92:	e8 43 ff ff ff       	call   f0106eda <lapicw>
+
+	// Clear error status register (requires back-to-back writes).
+	lapicw(ESR, 0);
+f0106f97:	ba 00 00 00 00       	mov    $0x0,%edx
+f0106f9c:	b8 a0 00 00 00       	mov    $0xa0,%eax
+f0106fa1:	e8 34 ff ff ff       	call   f0106eda <lapicw>
+	lapicw(ESR, 0);
+f0106fa6:	ba 00 00 00 00       	mov    $0x0,%edx
+f0106fab:	b8 a0 00 00 00       	mov    $0xa0,%eax
+f0106fb0:	e8 25 ff ff ff       	call   f0106eda <lapicw>
+
+	// Ack any outstanding interrupts.
+	lapicw(EOI, 0);
+f0106fb5:	ba 00 00 00 00       	mov    $0x0,%edx
+f0106fba:	b8 2c 00 00 00       	mov    $0x2c,%eax
+f0106fbf:	e8 16 ff ff ff       	call   f0106eda <lapicw>
+
+	// Send an Init Level De-Assert to synchronize arbitration ID's.
+	lapicw(ICRHI, 0);
+f0106fc4:	ba 00 00 00 00       	mov    $0x0,%edx
+f0106fc9:	b8 c4 00 00 00       	mov    $0xc4,%eax
+f0106fce:	e8 07 ff ff ff       	call   f0106eda <lapicw>
+	lapicw(ICRLO, BCAST | INIT | LEVEL);
+f0106fd3:	ba 00 85 08 00       	mov    $0x88500,%edx
+f0106fd8:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f0106fdd:	e8 f8 fe ff ff       	call   f0106eda <lapicw>
+	while(lapic[ICRLO] & DELIVS)
+f0106fe2:	8b 15 04 90 6a f0    	mov    0xf06a9004,%edx
+f0106fe8:	8b 82 00 03 00 00    	mov    0x300(%edx),%eax
+f0106fee:	f6 c4 10             	test   $0x10,%ah
+f0106ff1:	75 f5                	jne    f0106fe8 <lapic_init+0xfa>
+		;
+
+	// Enable interrupts on the APIC (but not on the processor).
+	lapicw(TPR, 0);
+f0106ff3:	ba 00 00 00 00       	mov    $0x0,%edx
+f0106ff8:	b8 20 00 00 00       	mov    $0x20,%eax
+f0106ffd:	e8 d8 fe ff ff       	call   f0106eda <lapicw>
+}
+f0107002:	c9                   	leave
+f0107003:	c3                   	ret
+		lapicw(PCINT, MASKED);
+f0107004:	ba 00 00 01 00       	mov    $0x10000,%edx
+f0107009:	b8 d0 00 00 00       	mov    $0xd0,%eax
+f010700e:	e8 c7 fe ff ff       	call   f0106eda <lapicw>
+f0107013:	e9 70 ff ff ff       	jmp    f0106f88 <lapic_init+0x9a>
+
+f0107018 <cpunum>:
+
+int
+cpunum(void)
+{
+	if (lapic)
+f0107018:	8b 15 04 90 6a f0    	mov    0xf06a9004,%edx
+		return lapic[ID] >> 24;
+	return 0;
+f010701e:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (lapic)
+f0107023:	85 d2                	test   %edx,%edx
+f0107025:	74 06                	je     f010702d <cpunum+0x15>
+		return lapic[ID] >> 24;
+f0107027:	8b 42 20             	mov    0x20(%edx),%eax
+f010702a:	c1 e8 18             	shr    $0x18,%eax
+}
+f010702d:	c3                   	ret
+
+f010702e <lapic_eoi>:
+
+// Acknowledge interrupt.
+void
+lapic_eoi(void)
+{
+	if (lapic)
+f010702e:	83 3d 04 90 6a f0 00 	cmpl   $0x0,0xf06a9004
+f0107035:	74 17                	je     f010704e <lapic_eoi+0x20>
+{
+f0107037:	55                   	push   %ebp
+f0107038:	89 e5                	mov    %esp,%ebp
+f010703a:	83 ec 08             	sub    $0x8,%esp
+		lapicw(EOI, 0);
+f010703d:	ba 00 00 00 00       	mov    $0x0,%edx
+f0107042:	b8 2c 00 00 00       	mov    $0x2c,%eax
+f0107047:	e8 8e fe ff ff       	call   f0106eda <lapicw>
+}
+f010704c:	c9                   	leave
+f010704d:	c3                   	ret
+f010704e:	c3                   	ret
+
+f010704f <lapic_startap>:
+
+// Start additional processor running entry code at addr.
+// See Appendix B of MultiProcessor Specification.
+void
+lapic_startap(uint8_t apicid, uint32_t addr)
+{
+f010704f:	55                   	push   %ebp
+f0107050:	89 e5                	mov    %esp,%ebp
+f0107052:	56                   	push   %esi
+f0107053:	53                   	push   %ebx
+f0107054:	8b 75 08             	mov    0x8(%ebp),%esi
+f0107057:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f010705a:	b8 0f 00 00 00       	mov    $0xf,%eax
+f010705f:	ba 70 00 00 00       	mov    $0x70,%edx
+f0107064:	ee                   	out    %al,(%dx)
+f0107065:	b8 0a 00 00 00       	mov    $0xa,%eax
+f010706a:	ba 71 00 00 00       	mov    $0x71,%edx
+f010706f:	ee                   	out    %al,(%dx)
+	if (PGNUM(pa) >= npages)
+f0107070:	83 3d c8 76 66 f0 00 	cmpl   $0x0,0xf06676c8
+f0107077:	74 7e                	je     f01070f7 <lapic_startap+0xa8>
+	// and the warm reset vector (DWORD based at 40:67) to point at
+	// the AP startup code prior to the [universal startup algorithm]."
+	outb(IO_RTC, 0xF);  // offset 0xF is shutdown code
+	outb(IO_RTC+1, 0x0A);
+	wrv = (uint16_t *)KADDR((0x40 << 4 | 0x67));  // Warm reset vector
+	wrv[0] = 0;
+f0107079:	66 c7 05 67 04 00 f0 	movw   $0x0,0xf0000467
+f0107080:	00 00 
+	wrv[1] = addr >> 4;
+f0107082:	89 d8                	mov    %ebx,%eax
+f0107084:	c1 e8 04             	shr    $0x4,%eax
+f0107087:	66 a3 69 04 00 f0    	mov    %ax,0xf0000469
+
+	// "Universal startup algorithm."
+	// Send INIT (level-triggered) interrupt to reset other CPU.
+	lapicw(ICRHI, apicid << 24);
+f010708d:	c1 e6 18             	shl    $0x18,%esi
+f0107090:	89 f2                	mov    %esi,%edx
+f0107092:	b8 c4 00 00 00       	mov    $0xc4,%eax
+f0107097:	e8 3e fe ff ff       	call   f0106eda <lapicw>
+	lapicw(ICRLO, INIT | LEVEL | ASSERT);
+f010709c:	ba 00 c5 00 00       	mov    $0xc500,%edx
+f01070a1:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f01070a6:	e8 2f fe ff ff       	call   f0106eda <lapicw>
+	microdelay(200);
+	lapicw(ICRLO, INIT | LEVEL);
+f01070ab:	ba 00 85 00 00       	mov    $0x8500,%edx
+f01070b0:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f01070b5:	e8 20 fe ff ff       	call   f0106eda <lapicw>
+	// when it is in the halted state due to an INIT.  So the second
+	// should be ignored, but it is part of the official Intel algorithm.
+	// Bochs complains about the second one.  Too bad for Bochs.
+	for (i = 0; i < 2; i++) {
+		lapicw(ICRHI, apicid << 24);
+		lapicw(ICRLO, STARTUP | (addr >> 12));
+f01070ba:	c1 eb 0c             	shr    $0xc,%ebx
+f01070bd:	80 cf 06             	or     $0x6,%bh
+		lapicw(ICRHI, apicid << 24);
+f01070c0:	89 f2                	mov    %esi,%edx
+f01070c2:	b8 c4 00 00 00       	mov    $0xc4,%eax
+f01070c7:	e8 0e fe ff ff       	call   f0106eda <lapicw>
+		lapicw(ICRLO, STARTUP | (addr >> 12));
+f01070cc:	89 da                	mov    %ebx,%edx
+f01070ce:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f01070d3:	e8 02 fe ff ff       	call   f0106eda <lapicw>
+		lapicw(ICRHI, apicid << 24);
+f01070d8:	89 f2                	mov    %esi,%edx
+f01070da:	b8 c4 00 00 00       	mov    $0xc4,%eax
+f01070df:	e8 f6 fd ff ff       	call   f0106eda <lapicw>
+		lapicw(ICRLO, STARTUP | (addr >> 12));
+f01070e4:	89 da                	mov    %ebx,%edx
+f01070e6:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f01070eb:	e8 ea fd ff ff       	call   f0106eda <lapicw>
+		microdelay(200);
+	}
+}
+f01070f0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f01070f3:	5b                   	pop    %ebx
+f01070f4:	5e                   	pop    %esi
+f01070f5:	5d                   	pop    %ebp
+f01070f6:	c3                   	ret
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f01070f7:	68 67 04 00 00       	push   $0x467
+f01070fc:	68 64 82 10 f0       	push   $0xf0108264
+f0107101:	68 99 00 00 00       	push   $0x99
+f0107106:	68 d8 a1 10 f0       	push   $0xf010a1d8
+f010710b:	e8 42 8f ff ff       	call   f0100052 <_panic>
+
+f0107110 <lapic_ipi>:
+
+void
+lapic_ipi(int vector)
+{
+f0107110:	55                   	push   %ebp
+f0107111:	89 e5                	mov    %esp,%ebp
+f0107113:	83 ec 08             	sub    $0x8,%esp
+	lapicw(ICRLO, OTHERS | FIXED | vector);
+f0107116:	8b 55 08             	mov    0x8(%ebp),%edx
+f0107119:	81 ca 00 00 0c 00    	or     $0xc0000,%edx
+f010711f:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f0107124:	e8 b1 fd ff ff       	call   f0106eda <lapicw>
+	while (lapic[ICRLO] & DELIVS)
+f0107129:	8b 15 04 90 6a f0    	mov    0xf06a9004,%edx
+f010712f:	8b 82 00 03 00 00    	mov    0x300(%edx),%eax
+f0107135:	f6 c4 10             	test   $0x10,%ah
+f0107138:	75 f5                	jne    f010712f <lapic_ipi+0x1f>
+		;
+}
+f010713a:	c9                   	leave
+f010713b:	c3                   	ret
+
+f010713c <spin_stats_reset>:
+spin_stats_reset(void)
+{
+	uint32_t i;
+	struct spinlock *lk;
+
+	for (i = 0; i < nspinlocks && i < NSPINLOCK; i++) {
+f010713c:	8b 0d a0 90 6a f0    	mov    0xf06a90a0,%ecx
+f0107142:	ba 00 00 00 00       	mov    $0x0,%edx
+f0107147:	83 fa 1f             	cmp    $0x1f,%edx
+f010714a:	77 4f                	ja     f010719b <spin_stats_reset+0x5f>
+f010714c:	39 ca                	cmp    %ecx,%edx
+f010714e:	73 4b                	jae    f010719b <spin_stats_reset+0x5f>
+		lk = spinlocks[i];
+f0107150:	8b 04 95 20 90 6a f0 	mov    -0xf956fe0(,%edx,4),%eax
+		lk->acquisitions = lk->contended = 0;
+f0107157:	c7 40 3c 00 00 00 00 	movl   $0x0,0x3c(%eax)
+f010715e:	c7 40 38 00 00 00 00 	movl   $0x0,0x38(%eax)
+		lk->spin_cycles = lk->hold_cycles = lk->max_hold = 0;
+f0107165:	c7 40 50 00 00 00 00 	movl   $0x0,0x50(%eax)
+f010716c:	c7 40 54 00 00 00 00 	movl   $0x0,0x54(%eax)
+f0107173:	c7 40 48 00 00 00 00 	movl   $0x0,0x48(%eax)
+f010717a:	c7 40 4c 00 00 00 00 	movl   $0x0,0x4c(%eax)
+f0107181:	c7 40 40 00 00 00 00 	movl   $0x0,0x40(%eax)
+f0107188:	c7 40 44 00 00 00 00 	movl   $0x0,0x44(%eax)
+		lk->max_pcs[0] = 0;
+f010718f:	c7 40 58 00 00 00 00 	movl   $0x0,0x58(%eax)
+	for (i = 0; i < nspinlocks && i < NSPINLOCK; i++) {
+f0107196:	83 c2 01             	add    $0x1,%edx
+f0107199:	eb ac                	jmp    f0107147 <spin_stats_reset+0xb>
+	}
+}
+f010719b:	c3                   	ret
+
+f010719c <spin_holding>:
+#endif
+
+// Check whether this CPU is holding the lock.
+int
+spin_holding(struct spinlock *lock)
+{
+f010719c:	55                   	push   %ebp
+f010719d:	89 e5                	mov    %esp,%ebp
+f010719f:	53                   	push   %ebx
+f01071a0:	8b 45 08             	mov    0x8(%ebp),%eax
+	return lock->next != lock->owner && lock->cpu == thiscpu;
+f01071a3:	8b 18                	mov    (%eax),%ebx
+f01071a5:	8b 48 04             	mov    0x4(%eax),%ecx
+f01071a8:	ba 00 00 00 00       	mov    $0x0,%edx
+f01071ad:	39 cb                	cmp    %ecx,%ebx
+f01071af:	74 10                	je     f01071c1 <spin_holding+0x25>
+f01071b1:	65 8b 15 00 00 00 00 	mov    %gs:0x0,%edx
+f01071b8:	39 50 08             	cmp    %edx,0x8(%eax)
+f01071bb:	0f 94 c2             	sete   %dl
+f01071be:	0f b6 d2             	movzbl %dl,%edx
+}
+f01071c1:	89 d0                	mov    %edx,%eax
+f01071c3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01071c6:	c9                   	leave
+f01071c7:	c3                   	ret
+
+f01071c8 <__spin_initlock>:
+
+void
+__spin_initlock(struct spinlock *lk, char *name)
+{
+f01071c8:	55                   	push   %ebp
+f01071c9:	89 e5                	mov    %esp,%ebp
+f01071cb:	8b 45 08             	mov    0x8(%ebp),%eax
+	lk->next = lk->owner = 0;
+f01071ce:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+f01071d5:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	lk->cpu = 0;
+f01071db:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+#ifdef DEBUG_SPINLOCK
+	lk->name = name;
+f01071e2:	8b 55 0c             	mov    0xc(%ebp),%edx
+f01071e5:	89 50 0c             	mov    %edx,0xc(%eax)
+#endif
+}
+f01071e8:	5d                   	pop    %ebp
+f01071e9:	c3                   	ret
+
+f01071ea <spin_lock>:
+// Loops (spins) until the lock is acquired.
+// Holding a lock for a long time may cause
+// other CPUs to waste time spinning to acquire it.
+void
+spin_lock(struct spinlock *lk)
+{
+f01071ea:	55                   	push   %ebp
+f01071eb:	89 e5                	mov    %esp,%ebp
+f01071ed:	57                   	push   %edi
+f01071ee:	56                   	push   %esi
+f01071ef:	53                   	push   %ebx
+f01071f0:	83 ec 28             	sub    $0x28,%esp
+f01071f3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t ticket;
+#ifdef DEBUG_SPINLOCK
+	uint64_t spun = 0;
+
+	if (spin_holding(lk))
+f01071f6:	53                   	push   %ebx
+f01071f7:	e8 a0 ff ff ff       	call   f010719c <spin_holding>
+f01071fc:	83 c4 10             	add    $0x10,%esp
+f01071ff:	85 c0                	test   %eax,%eax
+f0107201:	75 26                	jne    f0107229 <spin_lock+0x3f>
+f0107203:	89 c1                	mov    %eax,%ecx
+
+// Atomically add incr to *addr and return the old value.
+static inline uint32_t
+xadd(volatile uint32_t *addr, uint32_t incr)
+{
+	asm volatile("lock; xaddl %0, %1"
+f0107205:	be 01 00 00 00       	mov    $0x1,%esi
+f010720a:	f0 0f c1 33          	lock xadd %esi,(%ebx)
+
+	// The xadd is atomic and hands out tickets in order.
+	// It also serializes, so that reads after acquire are not
+	// reordered before it.
+	ticket = xadd(&lk->next, 1);
+	if (lk->owner != ticket) {
+f010720e:	8b 7b 04             	mov    0x4(%ebx),%edi
+	uint64_t spun = 0;
+f0107211:	b8 00 00 00 00       	mov    $0x0,%eax
+f0107216:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (lk->owner != ticket) {
+f010721b:	39 f7                	cmp    %esi,%edi
+f010721d:	74 39                	je     f0107258 <spin_lock+0x6e>
+	asm volatile("rdtsc" : "=A" (tsc));
+f010721f:	0f 31                	rdtsc
+f0107221:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f0107224:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+#ifdef DEBUG_SPINLOCK
+		spun = read_tsc();
+#endif
+		while (lk->owner != ticket)
+f0107227:	eb 20                	jmp    f0107249 <spin_lock+0x5f>
+		panic("CPU %d cannot acquire %s: already holding", cpunum(), lk->name);
+f0107229:	8b 5b 0c             	mov    0xc(%ebx),%ebx
+f010722c:	e8 e7 fd ff ff       	call   f0107018 <cpunum>
+f0107231:	83 ec 0c             	sub    $0xc,%esp
+f0107234:	53                   	push   %ebx
+f0107235:	50                   	push   %eax
+f0107236:	68 e8 a1 10 f0       	push   $0xf010a1e8
+f010723b:	6a 77                	push   $0x77
+f010723d:	68 4a a2 10 f0       	push   $0xf010a24a
+f0107242:	e8 0b 8e ff ff       	call   f0100052 <_panic>
+			asm volatile ("pause");
+f0107247:	f3 90                	pause
+		while (lk->owner != ticket)
+f0107249:	8b 43 04             	mov    0x4(%ebx),%eax
+f010724c:	39 f0                	cmp    %esi,%eax
+f010724e:	75 f7                	jne    f0107247 <spin_lock+0x5d>
+f0107250:	0f 31                	rdtsc
+#ifdef DEBUG_SPINLOCK
+		spun = read_tsc() - spun;
+f0107252:	2b 45 e0             	sub    -0x20(%ebp),%eax
+f0107255:	1b 55 e4             	sbb    -0x1c(%ebp),%edx
+f0107258:	65 8b 35 00 00 00 00 	mov    %gs:0x0,%esi
+#endif
+	}
+
+	// Record info about lock acquisition for debugging.
+	lk->cpu = thiscpu;
+f010725f:	89 73 08             	mov    %esi,0x8(%ebx)
+	asm volatile("movl %%ebp,%0" : "=r" (ebp));
+f0107262:	89 ee                	mov    %ebp,%esi
+		if (ebp == 0 || ebp < (uint32_t *)ULIM)
+f0107264:	83 f9 09             	cmp    $0x9,%ecx
+f0107267:	7f 21                	jg     f010728a <spin_lock+0xa0>
+f0107269:	81 fe ff ff 7f ef    	cmp    $0xef7fffff,%esi
+f010726f:	76 19                	jbe    f010728a <spin_lock+0xa0>
+		pcs[i] = ebp[1];          // saved %eip
+f0107271:	8b 7e 04             	mov    0x4(%esi),%edi
+f0107274:	89 7c 8b 10          	mov    %edi,0x10(%ebx,%ecx,4)
+		ebp = (uint32_t *)ebp[0]; // saved %ebp
+f0107278:	8b 36                	mov    (%esi),%esi
+	for (i = 0; i < 10; i++){
+f010727a:	83 c1 01             	add    $0x1,%ecx
+f010727d:	eb e5                	jmp    f0107264 <spin_lock+0x7a>
+		pcs[i] = 0;
+f010727f:	c7 44 8b 10 00 00 00 	movl   $0x0,0x10(%ebx,%ecx,4)
+f0107286:	00 
+	for (; i < 10; i++)
+f0107287:	83 c1 01             	add    $0x1,%ecx
+f010728a:	83 f9 09             	cmp    $0x9,%ecx
+f010728d:	7e f0                	jle    f010727f <spin_lock+0x95>
+	if (!lk->registered) {
+f010728f:	80 bb 88 00 00 00 00 	cmpb   $0x0,0x88(%ebx)
+f0107296:	75 20                	jne    f01072b8 <spin_lock+0xce>
+	asm volatile("lock; xaddl %0, %1"
+f0107298:	b9 01 00 00 00       	mov    $0x1,%ecx
+f010729d:	f0 0f c1 0d a0 90 6a 	lock xadd %ecx,0xf06a90a0
+f01072a4:	f0 
+		if ((i = xadd(&nspinlocks, 1)) < NSPINLOCK)
+f01072a5:	83 f9 1f             	cmp    $0x1f,%ecx
+f01072a8:	77 07                	ja     f01072b1 <spin_lock+0xc7>
+			spinlocks[i] = lk;
+f01072aa:	89 1c 8d 20 90 6a f0 	mov    %ebx,-0xf956fe0(,%ecx,4)
+		lk->registered = 1;
+f01072b1:	c6 83 88 00 00 00 01 	movb   $0x1,0x88(%ebx)
+	lk->acquisitions++;
+f01072b8:	83 43 38 01          	addl   $0x1,0x38(%ebx)
+	if (spun) {
+f01072bc:	89 d7                	mov    %edx,%edi
+f01072be:	09 c7                	or     %eax,%edi
+f01072c0:	74 0a                	je     f01072cc <spin_lock+0xe2>
+		lk->contended++;
+f01072c2:	83 43 3c 01          	addl   $0x1,0x3c(%ebx)
+		lk->spin_cycles += spun;
+f01072c6:	01 43 40             	add    %eax,0x40(%ebx)
+f01072c9:	11 53 44             	adc    %edx,0x44(%ebx)
+	asm volatile("rdtsc" : "=A" (tsc));
+f01072cc:	0f 31                	rdtsc
+	lk->acquired_at = read_tsc();
+f01072ce:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+f01072d4:	89 93 84 00 00 00    	mov    %edx,0x84(%ebx)
+#ifdef DEBUG_SPINLOCK
+	get_caller_pcs(lk->pcs);
+	spin_stats_acquire(lk, spun);
+#endif
+}
+f01072da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01072dd:	5b                   	pop    %ebx
+f01072de:	5e                   	pop    %esi
+f01072df:	5f                   	pop    %edi
+f01072e0:	5d                   	pop    %ebp
+f01072e1:	c3                   	ret
+
+f01072e2 <spin_unlock>:
+
+// Release the lock.
+void
+spin_unlock(struct spinlock *lk)
+{
+f01072e2:	55                   	push   %ebp
+f01072e3:	89 e5                	mov    %esp,%ebp
+f01072e5:	57                   	push   %edi
+f01072e6:	56                   	push   %esi
+f01072e7:	53                   	push   %ebx
+f01072e8:	83 ec 68             	sub    $0x68,%esp
+f01072eb:	8b 75 08             	mov    0x8(%ebp),%esi
+#ifdef DEBUG_SPINLOCK
+	if (!spin_holding(lk)) {
+f01072ee:	56                   	push   %esi
+f01072ef:	e8 a8 fe ff ff       	call   f010719c <spin_holding>
+f01072f4:	83 c4 10             	add    $0x10,%esp
+f01072f7:	85 c0                	test   %eax,%eax
+f01072f9:	74 41                	je     f010733c <spin_unlock+0x5a>
+f01072fb:	0f 31                	rdtsc
+	uint64_t held = read_tsc() - lk->acquired_at;
+f01072fd:	2b 86 80 00 00 00    	sub    0x80(%esi),%eax
+f0107303:	1b 96 84 00 00 00    	sbb    0x84(%esi),%edx
+	lk->hold_cycles += held;
+f0107309:	01 46 48             	add    %eax,0x48(%esi)
+f010730c:	11 56 4c             	adc    %edx,0x4c(%esi)
+	if (held > lk->max_hold) {
+f010730f:	8b 4e 54             	mov    0x54(%esi),%ecx
+f0107312:	39 46 50             	cmp    %eax,0x50(%esi)
+f0107315:	19 d1                	sbb    %edx,%ecx
+f0107317:	0f 82 cf 00 00 00    	jb     f01073ec <spin_unlock+0x10a>
+		}
+		panic("spin_unlock");
+	}
+
+	spin_stats_release(lk);
+	lk->pcs[0] = 0;
+f010731d:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+#endif
+	lk->cpu = 0;
+f0107324:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+	// Only the holder writes 'owner', and x86 does not reorder stores
+	// with earlier loads or stores (vol 3, 8.2.2), so a plain store
+	// releases the lock.  The compiler barrier keeps gcc from moving
+	// critical-section accesses past it.
+	asm volatile("" : : : "memory");
+	lk->owner++;
+f010732b:	8b 46 04             	mov    0x4(%esi),%eax
+f010732e:	83 c0 01             	add    $0x1,%eax
+f0107331:	89 46 04             	mov    %eax,0x4(%esi)
+}
+f0107334:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0107337:	5b                   	pop    %ebx
+f0107338:	5e                   	pop    %esi
+f0107339:	5f                   	pop    %edi
+f010733a:	5d                   	pop    %ebp
+f010733b:	c3                   	ret
+		memmove(pcs, lk->pcs, sizeof pcs);
+f010733c:	83 ec 04             	sub    $0x4,%esp
+f010733f:	6a 28                	push   $0x28
+f0107341:	8d 46 10             	lea    0x10(%esi),%eax
+f0107344:	50                   	push   %eax
+f0107345:	8d 5d c0             	lea    -0x40(%ebp),%ebx
+f0107348:	53                   	push   %ebx
+f0107349:	e8 e2 f5 ff ff       	call   f0106930 <memmove>
+			cpunum(), lk->name, lk->cpu->cpu_id);
+f010734e:	8b 46 08             	mov    0x8(%esi),%eax
+		cprintf("CPU %d cannot release %s: held by CPU %d\nAcquired at:", 
+f0107351:	0f b6 78 04          	movzbl 0x4(%eax),%edi
+f0107355:	8b 76 0c             	mov    0xc(%esi),%esi
+f0107358:	e8 bb fc ff ff       	call   f0107018 <cpunum>
+f010735d:	57                   	push   %edi
+f010735e:	56                   	push   %esi
+f010735f:	50                   	push   %eax
+f0107360:	68 14 a2 10 f0       	push   $0xf010a214
+f0107365:	e8 70 d0 ff ff       	call   f01043da <cprintf>
+		for (i = 0; i < 10 && pcs[i]; i++) {
+f010736a:	8d 7d e8             	lea    -0x18(%ebp),%edi
+f010736d:	83 c4 20             	add    $0x20,%esp
+			if (debuginfo_eip(pcs[i], &info) >= 0)
+f0107370:	8d 75 a8             	lea    -0x58(%ebp),%esi
+		for (i = 0; i < 10 && pcs[i]; i++) {
+f0107373:	eb 18                	jmp    f010738d <spin_unlock+0xab>
+				cprintf("  %08x\n", pcs[i]);
+f0107375:	83 ec 08             	sub    $0x8,%esp
+f0107378:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+f010737b:	ff 30                	push   (%eax)
+f010737d:	68 71 a2 10 f0       	push   $0xf010a271
+f0107382:	e8 53 d0 ff ff       	call   f01043da <cprintf>
+f0107387:	83 c4 10             	add    $0x10,%esp
+		for (i = 0; i < 10 && pcs[i]; i++) {
+f010738a:	83 c3 04             	add    $0x4,%ebx
+f010738d:	39 fb                	cmp    %edi,%ebx
+f010738f:	74 44                	je     f01073d5 <spin_unlock+0xf3>
+f0107391:	89 5d a4             	mov    %ebx,-0x5c(%ebp)
+f0107394:	8b 03                	mov    (%ebx),%eax
+f0107396:	85 c0                	test   %eax,%eax
+f0107398:	74 3b                	je     f01073d5 <spin_unlock+0xf3>
+			if (debuginfo_eip(pcs[i], &info) >= 0)
+f010739a:	83 ec 08             	sub    $0x8,%esp
+f010739d:	56                   	push   %esi
+f010739e:	50                   	push   %eax
+f010739f:	e8 ba ea ff ff       	call   f0105e5e <debuginfo_eip>
+f01073a4:	83 c4 10             	add    $0x10,%esp
+f01073a7:	85 c0                	test   %eax,%eax
+f01073a9:	78 ca                	js     f0107375 <spin_unlock+0x93>
+					pcs[i] - info.eip_fn_addr);
+f01073ab:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+f01073ae:	8b 00                	mov    (%eax),%eax
+				cprintf("  %08x %s:%d: %.*s+%x\n", pcs[i],
+f01073b0:	83 ec 04             	sub    $0x4,%esp
+f01073b3:	89 c2                	mov    %eax,%edx
+f01073b5:	2b 55 b8             	sub    -0x48(%ebp),%edx
+f01073b8:	52                   	push   %edx
+f01073b9:	ff 75 b0             	push   -0x50(%ebp)
+f01073bc:	ff 75 b4             	push   -0x4c(%ebp)
+f01073bf:	ff 75 ac             	push   -0x54(%ebp)
+f01073c2:	ff 75 a8             	push   -0x58(%ebp)
+f01073c5:	50                   	push   %eax
+f01073c6:	68 5a a2 10 f0       	push   $0xf010a25a
+f01073cb:	e8 0a d0 ff ff       	call   f01043da <cprintf>
+f01073d0:	83 c4 20             	add    $0x20,%esp
+f01073d3:	eb b5                	jmp    f010738a <spin_unlock+0xa8>
+		panic("spin_unlock");
+f01073d5:	83 ec 04             	sub    $0x4,%esp
+f01073d8:	68 79 a2 10 f0       	push   $0xf010a279
+f01073dd:	68 a7 00 00 00       	push   $0xa7
+f01073e2:	68 4a a2 10 f0       	push   $0xf010a24a
+f01073e7:	e8 66 8c ff ff       	call   f0100052 <_panic>
+		lk->max_hold = held;
+f01073ec:	89 46 50             	mov    %eax,0x50(%esi)
+f01073ef:	89 56 54             	mov    %edx,0x54(%esi)
+		memmove(lk->max_pcs, lk->pcs, sizeof(lk->max_pcs));
+f01073f2:	83 ec 04             	sub    $0x4,%esp
+f01073f5:	6a 28                	push   $0x28
+f01073f7:	8d 46 10             	lea    0x10(%esi),%eax
+f01073fa:	50                   	push   %eax
+f01073fb:	8d 46 58             	lea    0x58(%esi),%eax
+f01073fe:	50                   	push   %eax
+f01073ff:	e8 2c f5 ff ff       	call   f0106930 <memmove>
+f0107404:	83 c4 10             	add    $0x10,%esp
+f0107407:	e9 11 ff ff ff       	jmp    f010731d <spin_unlock+0x3b>
+
+f010740c <pci_e1000_attach>:
+  return 0;
+}
+
+
+int
+pci_e1000_attach(struct pci_func *pcif) {
+f010740c:	55                   	push   %ebp
+f010740d:	89 e5                	mov    %esp,%ebp
+f010740f:	56                   	push   %esi
+f0107410:	53                   	push   %ebx
+f0107411:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  // Enable PCI function
+  pci_func_enable(pcif);
+f0107414:	83 ec 0c             	sub    $0xc,%esp
+f0107417:	53                   	push   %ebx
+f0107418:	e8 c3 07 00 00       	call   f0107be0 <pci_func_enable>
+
+  // Map MMIO region and save the address in 'base;
+  base = (struct E1000 *) mmio_map_region(pcif->reg_base[0], pcif->reg_size[0]);
+f010741d:	83 c4 08             	add    $0x8,%esp
+f0107420:	ff 73 2c             	push   0x2c(%ebx)
+f0107423:	ff 73 14             	push   0x14(%ebx)
+f0107426:	e8 78 a0 ff ff       	call   f01014a3 <mmio_map_region>
+f010742b:	89 c2                	mov    %eax,%edx
+f010742d:	a3 a0 66 66 f0       	mov    %eax,0xf06666a0
+  assert(base->STATUS == 0x80080783);
+f0107432:	8b 40 08             	mov    0x8(%eax),%eax
+f0107435:	83 c4 10             	add    $0x10,%esp
+f0107438:	3d 83 07 08 80       	cmp    $0x80080783,%eax
+f010743d:	75 73                	jne    f01074b2 <pci_e1000_attach+0xa6>
+  for (unsigned i = 0; i < 3; ++i)
+f010743f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  base->EERD = addr << 8 | E1000_EERD_START;
+f0107444:	89 c8                	mov    %ecx,%eax
+f0107446:	c1 e0 08             	shl    $0x8,%eax
+f0107449:	83 c8 01             	or     $0x1,%eax
+f010744c:	89 42 14             	mov    %eax,0x14(%edx)
+  while (!(base->EERD & E1000_EERD_DONE));
+f010744f:	8b 42 14             	mov    0x14(%edx),%eax
+f0107452:	a8 10                	test   $0x10,%al
+f0107454:	74 f9                	je     f010744f <pci_e1000_attach+0x43>
+  return base->EERD >> 16;
+f0107456:	8b 42 14             	mov    0x14(%edx),%eax
+f0107459:	c1 e8 10             	shr    $0x10,%eax
+f010745c:	66 89 84 09 c0 a0 6a 	mov    %ax,-0xf955f40(%ecx,%ecx,1)
+f0107463:	f0 
+  for (unsigned i = 0; i < 3; ++i)
+f0107464:	83 c1 01             	add    $0x1,%ecx
+f0107467:	83 f9 03             	cmp    $0x3,%ecx
+f010746a:	75 d8                	jne    f0107444 <pci_e1000_attach+0x38>
+  memset(tx_descs, 0, sizeof(tx_descs));
+f010746c:	83 ec 04             	sub    $0x4,%esp
+f010746f:	68 00 10 00 00       	push   $0x1000
+f0107474:	6a 00                	push   $0x0
+f0107476:	68 c0 90 6a f0       	push   $0xf06a90c0
+f010747b:	e8 7b f4 ff ff       	call   f01068fb <memset>
+  memset(tx_bufs, 0, sizeof(tx_bufs));
+f0107480:	83 c4 0c             	add    $0xc,%esp
+f0107483:	68 00 ee 05 00       	push   $0x5ee00
+f0107488:	6a 00                	push   $0x0
+f010748a:	68 e0 b0 6a f0       	push   $0xf06ab0e0
+f010748f:	e8 67 f4 ff ff       	call   f01068fb <memset>
+  for (int i = 0; i < N_TXDESC; ++i) {
+f0107494:	ba e0 b0 6a f0       	mov    $0xf06ab0e0,%edx
+f0107499:	b9 e0 b0 6a 00       	mov    $0x6ab0e0,%ecx
+f010749e:	bb 00 00 00 00       	mov    $0x0,%ebx
+f01074a3:	be c0 a0 6a f0       	mov    $0xf06aa0c0,%esi
+f01074a8:	83 c4 10             	add    $0x10,%esp
+f01074ab:	b8 c0 90 6a f0       	mov    $0xf06a90c0,%eax
+f01074b0:	eb 35                	jmp    f01074e7 <pci_e1000_attach+0xdb>
+  assert(base->STATUS == 0x80080783);
+f01074b2:	68 91 a2 10 f0       	push   $0xf010a291
+f01074b7:	68 1f 93 10 f0       	push   $0xf010931f
+f01074bc:	6a 5e                	push   $0x5e
+f01074be:	68 ac a2 10 f0       	push   $0xf010a2ac
+f01074c3:	e8 8a 8b ff ff       	call   f0100052 <_panic>
+    tx_descs[i].addr = PADDR(tx_bufs[i]);
+f01074c8:	89 08                	mov    %ecx,(%eax)
+f01074ca:	89 58 04             	mov    %ebx,0x4(%eax)
+    tx_descs[i].cmd = 0;
+f01074cd:	c6 40 0b 00          	movb   $0x0,0xb(%eax)
+    tx_descs[i].status |= E1000_TX_STATUS_DD;
+f01074d1:	80 48 0c 01          	orb    $0x1,0xc(%eax)
+  for (int i = 0; i < N_TXDESC; ++i) {
+f01074d5:	81 c1 ee 05 00 00    	add    $0x5ee,%ecx
+f01074db:	83 d3 00             	adc    $0x0,%ebx
+f01074de:	83 c0 10             	add    $0x10,%eax
+f01074e1:	81 c2 ee 05 00 00    	add    $0x5ee,%edx
+f01074e7:	39 f0                	cmp    %esi,%eax
+f01074e9:	74 1a                	je     f0107505 <pci_e1000_attach+0xf9>
+	if ((uint32_t)kva < KERNBASE)
+f01074eb:	81 fa ff ff ff ef    	cmp    $0xefffffff,%edx
+f01074f1:	77 d5                	ja     f01074c8 <pci_e1000_attach+0xbc>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f01074f3:	52                   	push   %edx
+f01074f4:	68 88 82 10 f0       	push   $0xf0108288
+f01074f9:	6a 21                	push   $0x21
+f01074fb:	68 ac a2 10 f0       	push   $0xf010a2ac
+f0107500:	e8 4d 8b ff ff       	call   f0100052 <_panic>
+  base->TDLEN = sizeof(struct tx_desc) * N_TXDESC;
+f0107505:	a1 a0 66 66 f0       	mov    0xf06666a0,%eax
+f010750a:	c7 80 08 38 00 00 00 	movl   $0x1000,0x3808(%eax)
+f0107511:	10 00 00 
+	if ((uint32_t)kva < KERNBASE)
+f0107514:	ba c0 90 6a f0       	mov    $0xf06a90c0,%edx
+f0107519:	81 fa ff ff ff ef    	cmp    $0xefffffff,%edx
+f010751f:	0f 86 d8 00 00 00    	jbe    f01075fd <pci_e1000_attach+0x1f1>
+  base->TDBAL = PADDR(tx_descs);
+f0107525:	c7 80 00 38 00 00 c0 	movl   $0x6a90c0,0x3800(%eax)
+f010752c:	90 6a 00 
+  base->TDBAH = 0;
+f010752f:	c7 80 04 38 00 00 00 	movl   $0x0,0x3804(%eax)
+f0107536:	00 00 00 
+  base->TDH = 0;
+f0107539:	c7 80 10 38 00 00 00 	movl   $0x0,0x3810(%eax)
+f0107540:	00 00 00 
+  base->TDT = 0;
+f0107543:	c7 80 18 38 00 00 00 	movl   $0x0,0x3818(%eax)
+f010754a:	00 00 00 
+  base->TCTL |= E1000_TCTL_EN;
+f010754d:	8b 90 00 04 00 00    	mov    0x400(%eax),%edx
+f0107553:	83 ca 02             	or     $0x2,%edx
+f0107556:	89 90 00 04 00 00    	mov    %edx,0x400(%eax)
+  base->TCTL |= E1000_TCTL_PSP;
+f010755c:	8b 90 00 04 00 00    	mov    0x400(%eax),%edx
+f0107562:	83 ca 08             	or     $0x8,%edx
+f0107565:	89 90 00 04 00 00    	mov    %edx,0x400(%eax)
+  base->TCTL |= E1000_TCTL_CT_ETHER;
+f010756b:	8b 90 00 04 00 00    	mov    0x400(%eax),%edx
+f0107571:	80 ce 01             	or     $0x1,%dh
+f0107574:	89 90 00 04 00 00    	mov    %edx,0x400(%eax)
+  base->TCTL |= E1000_TCTL_COLD_FULL_DUPLEX;
+f010757a:	8b 90 00 04 00 00    	mov    0x400(%eax),%edx
+f0107580:	81 ca 00 00 04 00    	or     $0x40000,%edx
+f0107586:	89 90 00 04 00 00    	mov    %edx,0x400(%eax)
+  base->TIPG = E1000_TIPG_DEFAULT;
+f010758c:	c7 80 10 04 00 00 0a 	movl   $0x60100a,0x410(%eax)
+f0107593:	10 60 00 
+  memset(rx_descs, 0, sizeof(rx_descs));
+f0107596:	83 ec 04             	sub    $0x4,%esp
+f0107599:	68 00 10 00 00       	push   $0x1000
+f010759e:	6a 00                	push   $0x0
+f01075a0:	68 d0 a0 6a f0       	push   $0xf06aa0d0
+f01075a5:	e8 51 f3 ff ff       	call   f01068fb <memset>
+  memset(rx_bufs, 0, sizeof(rx_bufs));
+f01075aa:	83 c4 0c             	add    $0xc,%esp
+f01075ad:	68 00 ee 05 00       	push   $0x5ee00
+f01075b2:	6a 00                	push   $0x0
+f01075b4:	68 e0 9e 70 f0       	push   $0xf0709ee0
+f01075b9:	e8 3d f3 ff ff       	call   f01068fb <memset>
+  for (int i = 0; i < N_RXDESC; ++i)
+f01075be:	b8 e0 9e 70 f0       	mov    $0xf0709ee0,%eax
+f01075c3:	b9 e0 9e 70 00       	mov    $0x709ee0,%ecx
+f01075c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+f01075cd:	be e0 8c 76 f0       	mov    $0xf0768ce0,%esi
+f01075d2:	83 c4 10             	add    $0x10,%esp
+f01075d5:	ba d0 a0 6a f0       	mov    $0xf06aa0d0,%edx
+f01075da:	39 f0                	cmp    %esi,%eax
+f01075dc:	74 43                	je     f0107621 <pci_e1000_attach+0x215>
+f01075de:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f01075e3:	76 2a                	jbe    f010760f <pci_e1000_attach+0x203>
+    rx_descs[i].addr = PADDR(rx_bufs[i]);
+f01075e5:	89 0a                	mov    %ecx,(%edx)
+f01075e7:	89 5a 04             	mov    %ebx,0x4(%edx)
+  for (int i = 0; i < N_RXDESC; ++i)
+f01075ea:	81 c1 ee 05 00 00    	add    $0x5ee,%ecx
+f01075f0:	83 d3 00             	adc    $0x0,%ebx
+f01075f3:	83 c2 10             	add    $0x10,%edx
+f01075f6:	05 ee 05 00 00       	add    $0x5ee,%eax
+f01075fb:	eb dd                	jmp    f01075da <pci_e1000_attach+0x1ce>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f01075fd:	52                   	push   %edx
+f01075fe:	68 88 82 10 f0       	push   $0xf0108288
+f0107603:	6a 28                	push   $0x28
+f0107605:	68 ac a2 10 f0       	push   $0xf010a2ac
+f010760a:	e8 43 8a ff ff       	call   f0100052 <_panic>
+f010760f:	50                   	push   %eax
+f0107610:	68 88 82 10 f0       	push   $0xf0108288
+f0107615:	6a 45                	push   $0x45
+f0107617:	68 ac a2 10 f0       	push   $0xf010a2ac
+f010761c:	e8 31 8a ff ff       	call   f0100052 <_panic>
+  base->RAL = *(uint32_t *) e1000_macaddr;
+f0107621:	a1 a0 66 66 f0       	mov    0xf06666a0,%eax
+f0107626:	8b 15 c0 a0 6a f0    	mov    0xf06aa0c0,%edx
+f010762c:	89 90 1c 3a 00 00    	mov    %edx,0x3a1c(%eax)
+  base->RAH = *(uint16_t *) (e1000_macaddr + 4) | 0x80000000;
+f0107632:	0f b7 15 c4 a0 6a f0 	movzwl 0xf06aa0c4,%edx
+f0107639:	81 ca 00 00 00 80    	or     $0x80000000,%edx
+f010763f:	89 90 20 3a 00 00    	mov    %edx,0x3a20(%eax)
+	if ((uint32_t)kva < KERNBASE)
+f0107645:	ba d0 a0 6a f0       	mov    $0xf06aa0d0,%edx
+f010764a:	81 fa ff ff ff ef    	cmp    $0xefffffff,%edx
+f0107650:	76 6b                	jbe    f01076bd <pci_e1000_attach+0x2b1>
+  base->RDBAL = PADDR(rx_descs);
+f0107652:	c7 80 00 28 00 00 d0 	movl   $0x6aa0d0,0x2800(%eax)
+f0107659:	a0 6a 00 
+  base->RDBAH = 0;
+f010765c:	c7 80 04 28 00 00 00 	movl   $0x0,0x2804(%eax)
+f0107663:	00 00 00 
+  base->RDLEN = sizeof(rx_descs);
+f0107666:	c7 80 08 28 00 00 00 	movl   $0x1000,0x2808(%eax)
+f010766d:	10 00 00 
+  base->RDH = 1;
+f0107670:	c7 80 10 28 00 00 01 	movl   $0x1,0x2810(%eax)
+f0107677:	00 00 00 
+  base->RDT = 0;
+f010767a:	c7 80 18 28 00 00 00 	movl   $0x0,0x2818(%eax)
+f0107681:	00 00 00 
+  base->RCTL |= E1000_RCTL_EN;
+f0107684:	8b 90 00 01 00 00    	mov    0x100(%eax),%edx
+f010768a:	83 ca 02             	or     $0x2,%edx
+f010768d:	89 90 00 01 00 00    	mov    %edx,0x100(%eax)
+  base->RCTL |= E1000_RCTL_BSIZE_2048;
+f0107693:	8b 90 00 01 00 00    	mov    0x100(%eax),%edx
+f0107699:	89 90 00 01 00 00    	mov    %edx,0x100(%eax)
+  base->RCTL |= E1000_RCTL_SECRC;
+f010769f:	8b 90 00 01 00 00    	mov    0x100(%eax),%edx
+f01076a5:	81 ca 00 00 00 04    	or     $0x4000000,%edx
+f01076ab:	89 90 00 01 00 00    	mov    %edx,0x100(%eax)
+
+  e1000_mac_init();
+  e1000_tx_init();
+  e1000_rx_init();
+  return 0;
+}
+f01076b1:	b8 00 00 00 00       	mov    $0x0,%eax
+f01076b6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f01076b9:	5b                   	pop    %ebx
+f01076ba:	5e                   	pop    %esi
+f01076bb:	5d                   	pop    %ebp
+f01076bc:	c3                   	ret
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f01076bd:	52                   	push   %edx
+f01076be:	68 88 82 10 f0       	push   $0xf0108288
+f01076c3:	6a 4a                	push   $0x4a
+f01076c5:	68 ac a2 10 f0       	push   $0xf010a2ac
+f01076ca:	e8 83 89 ff ff       	call   f0100052 <_panic>
+
+f01076cf <e1000_tx>:
+
+// return -E_AGAIN on queue full, 0 on OK
+int
+e1000_tx(const void *buf, uint32_t len) {
+f01076cf:	55                   	push   %ebp
+f01076d0:	89 e5                	mov    %esp,%ebp
+f01076d2:	57                   	push   %edi
+f01076d3:	56                   	push   %esi
+f01076d4:	53                   	push   %ebx
+f01076d5:	83 ec 0c             	sub    $0xc,%esp
+f01076d8:	8b 7d 08             	mov    0x8(%ebp),%edi
+f01076db:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // Send 'len' bytes in 'buf' to ethernet
+  // Hint: buf is a kernel virtual address
+  if (!buf || len > E1000_PKTSIZE)
+f01076de:	85 ff                	test   %edi,%edi
+f01076e0:	74 7a                	je     f010775c <e1000_tx+0x8d>
+f01076e2:	81 fe ee 05 00 00    	cmp    $0x5ee,%esi
+f01076e8:	77 72                	ja     f010775c <e1000_tx+0x8d>
+    return -E_INVAL;
+
+  uint32_t tdt = base->TDT;
+f01076ea:	a1 a0 66 66 f0       	mov    0xf06666a0,%eax
+f01076ef:	8b 98 18 38 00 00    	mov    0x3818(%eax),%ebx
+  struct tx_desc *txDesc = &tx_descs[tdt];
+  char *tx_buf = tx_bufs[tdt];
+f01076f5:	69 cb ee 05 00 00    	imul   $0x5ee,%ebx,%ecx
+f01076fb:	81 c1 e0 b0 6a f0    	add    $0xf06ab0e0,%ecx
+
+  if (!(txDesc->status & E1000_TX_STATUS_DD))
+f0107701:	89 d8                	mov    %ebx,%eax
+f0107703:	c1 e0 04             	shl    $0x4,%eax
+f0107706:	0f b6 90 cc 90 6a f0 	movzbl -0xf956f34(%eax),%edx
+f010770d:	f6 c2 01             	test   $0x1,%dl
+f0107710:	74 51                	je     f0107763 <e1000_tx+0x94>
+    return -E_AGAIN;
+
+  txDesc->length = len;
+f0107712:	89 d8                	mov    %ebx,%eax
+f0107714:	c1 e0 04             	shl    $0x4,%eax
+f0107717:	66 89 b0 c8 90 6a f0 	mov    %si,-0xf956f38(%eax)
+  txDesc->status &= ~E1000_TX_STATUS_DD;
+f010771e:	83 e2 fe             	and    $0xfffffffe,%edx
+f0107721:	88 90 cc 90 6a f0    	mov    %dl,-0xf956f34(%eax)
+  txDesc->length = len;
+f0107727:	05 c0 90 6a f0       	add    $0xf06a90c0,%eax
+  txDesc->cmd |= (E1000_TX_CMD_EOP | E1000_TX_CMD_RS);
+f010772c:	80 48 0b 05          	orb    $0x5,0xb(%eax)
+  memcpy(tx_buf, buf, len);
+f0107730:	83 ec 04             	sub    $0x4,%esp
+f0107733:	56                   	push   %esi
+f0107734:	57                   	push   %edi
+f0107735:	51                   	push   %ecx
+f0107736:	e8 57 f2 ff ff       	call   f0106992 <memcpy>
+  base->TDT = (tdt + 1) % N_TXDESC;
+f010773b:	83 c3 01             	add    $0x1,%ebx
+f010773e:	0f b6 db             	movzbl %bl,%ebx
+f0107741:	a1 a0 66 66 f0       	mov    0xf06666a0,%eax
+f0107746:	89 98 18 38 00 00    	mov    %ebx,0x3818(%eax)
+  return 0;
+f010774c:	83 c4 10             	add    $0x10,%esp
+f010774f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0107754:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0107757:	5b                   	pop    %ebx
+f0107758:	5e                   	pop    %esi
+f0107759:	5f                   	pop    %edi
+f010775a:	5d                   	pop    %ebp
+f010775b:	c3                   	ret
+    return -E_INVAL;
+f010775c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0107761:	eb f1                	jmp    f0107754 <e1000_tx+0x85>
+    return -E_AGAIN;
+f0107763:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+f0107768:	eb ea                	jmp    f0107754 <e1000_tx+0x85>
+
+f010776a <e1000_rx>:
+
+int
+e1000_rx(void *buf, uint32_t len) {
+f010776a:	55                   	push   %ebp
+f010776b:	89 e5                	mov    %esp,%ebp
+f010776d:	56                   	push   %esi
+f010776e:	53                   	push   %ebx
+f010776f:	8b 55 08             	mov    0x8(%ebp),%edx
+  // You could return -E_AGAIN if there is no packet
+  // Check whether the buf is large enough to hold
+  // the packet
+  // Do not forget to reset the decscriptor and
+  // give it back to hardware by modifying RDT
+  if (!buf)
+f0107772:	85 d2                	test   %edx,%edx
+f0107774:	74 77                	je     f01077ed <e1000_rx+0x83>
+    return -E_INVAL;
+
+  uint32_t rdt = (base->RDT + 1) % N_RXDESC;
+f0107776:	a1 a0 66 66 f0       	mov    0xf06666a0,%eax
+f010777b:	8b 98 18 28 00 00    	mov    0x2818(%eax),%ebx
+f0107781:	83 c3 01             	add    $0x1,%ebx
+f0107784:	0f b6 db             	movzbl %bl,%ebx
+  struct rx_desc *rxDesc = &rx_descs[rdt];
+  char *rx_buf = rx_bufs[rdt];
+f0107787:	69 cb ee 05 00 00    	imul   $0x5ee,%ebx,%ecx
+f010778d:	81 c1 e0 9e 70 f0    	add    $0xf0709ee0,%ecx
+
+  if (!(rxDesc->status & E1000_RX_STATUS_DD))
+f0107793:	89 d8                	mov    %ebx,%eax
+f0107795:	c1 e0 04             	shl    $0x4,%eax
+f0107798:	0f b6 80 dc a0 6a f0 	movzbl -0xf955f24(%eax),%eax
+f010779f:	a8 01                	test   $0x1,%al
+f01077a1:	74 51                	je     f01077f4 <e1000_rx+0x8a>
+    return -E_AGAIN;
+  if (rxDesc->error)
+f01077a3:	89 de                	mov    %ebx,%esi
+f01077a5:	c1 e6 04             	shl    $0x4,%esi
+f01077a8:	80 be dd a0 6a f0 00 	cmpb   $0x0,-0xf955f23(%esi)
+f01077af:	75 4a                	jne    f01077fb <e1000_rx+0x91>
+    return -E_AGAIN;
+
+  rxDesc->status &= ~E1000_RX_STATUS_DD;
+f01077b1:	89 de                	mov    %ebx,%esi
+f01077b3:	c1 e6 04             	shl    $0x4,%esi
+f01077b6:	83 e0 fe             	and    $0xfffffffe,%eax
+f01077b9:	88 86 dc a0 6a f0    	mov    %al,-0xf955f24(%esi)
+  memcpy(buf, rx_buf, rxDesc->length);
+f01077bf:	83 ec 04             	sub    $0x4,%esp
+f01077c2:	0f b7 86 d8 a0 6a f0 	movzwl -0xf955f28(%esi),%eax
+f01077c9:	50                   	push   %eax
+f01077ca:	51                   	push   %ecx
+f01077cb:	52                   	push   %edx
+f01077cc:	e8 c1 f1 ff ff       	call   f0106992 <memcpy>
+  base->RDT = rdt;
+f01077d1:	a1 a0 66 66 f0       	mov    0xf06666a0,%eax
+f01077d6:	89 98 18 28 00 00    	mov    %ebx,0x2818(%eax)
+  return rxDesc->length;
+f01077dc:	0f b7 86 d8 a0 6a f0 	movzwl -0xf955f28(%esi),%eax
+f01077e3:	83 c4 10             	add    $0x10,%esp
+}
+f01077e6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f01077e9:	5b                   	pop    %ebx
+f01077ea:	5e                   	pop    %esi
+f01077eb:	5d                   	pop    %ebp
+f01077ec:	c3                   	ret
+    return -E_INVAL;
+f01077ed:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01077f2:	eb f2                	jmp    f01077e6 <e1000_rx+0x7c>
+    return -E_AGAIN;
+f01077f4:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+f01077f9:	eb eb                	jmp    f01077e6 <e1000_rx+0x7c>
+    return -E_AGAIN;
+f01077fb:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+f0107800:	eb e4                	jmp    f01077e6 <e1000_rx+0x7c>
+
+f0107802 <pci_attach_match>:
+}
+
+static int __attribute__((warn_unused_result))
+pci_attach_match(uint32_t key1, uint32_t key2,
+		 struct pci_driver *list, struct pci_func *pcif)
+{
+f0107802:	55                   	push   %ebp
+f0107803:	89 e5                	mov    %esp,%ebp
+f0107805:	57                   	push   %edi
+f0107806:	56                   	push   %esi
+f0107807:	53                   	push   %ebx
+f0107808:	83 ec 1c             	sub    $0x1c,%esp
+f010780b:	89 c7                	mov    %eax,%edi
+f010780d:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+	uint32_t i;
+
+	for (i = 0; list[i].attachfn; i++) {
+f0107810:	89 cb                	mov    %ecx,%ebx
+f0107812:	eb 03                	jmp    f0107817 <pci_attach_match+0x15>
+f0107814:	83 c3 0c             	add    $0xc,%ebx
+f0107817:	89 de                	mov    %ebx,%esi
+f0107819:	8b 43 08             	mov    0x8(%ebx),%eax
+f010781c:	85 c0                	test   %eax,%eax
+f010781e:	74 37                	je     f0107857 <pci_attach_match+0x55>
+		if (list[i].key1 == key1 && list[i].key2 == key2) {
+f0107820:	39 3b                	cmp    %edi,(%ebx)
+f0107822:	75 f0                	jne    f0107814 <pci_attach_match+0x12>
+f0107824:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+f0107827:	39 56 04             	cmp    %edx,0x4(%esi)
+f010782a:	75 e8                	jne    f0107814 <pci_attach_match+0x12>
+			int r = list[i].attachfn(pcif);
+f010782c:	83 ec 0c             	sub    $0xc,%esp
+f010782f:	ff 75 08             	push   0x8(%ebp)
+f0107832:	ff d0                	call   *%eax
+			if (r > 0)
+f0107834:	83 c4 10             	add    $0x10,%esp
+f0107837:	85 c0                	test   %eax,%eax
+f0107839:	7f 1c                	jg     f0107857 <pci_attach_match+0x55>
+				return r;
+			if (r < 0)
+f010783b:	79 d7                	jns    f0107814 <pci_attach_match+0x12>
+				cprintf("pci_attach_match: attaching "
+f010783d:	83 ec 0c             	sub    $0xc,%esp
+f0107840:	50                   	push   %eax
+f0107841:	ff 76 08             	push   0x8(%esi)
+f0107844:	ff 75 e4             	push   -0x1c(%ebp)
+f0107847:	57                   	push   %edi
+f0107848:	68 bc a2 10 f0       	push   $0xf010a2bc
+f010784d:	e8 88 cb ff ff       	call   f01043da <cprintf>
+f0107852:	83 c4 20             	add    $0x20,%esp
+f0107855:	eb bd                	jmp    f0107814 <pci_attach_match+0x12>
+					"%x.%x (%p): e\n",
+					key1, key2, list[i].attachfn, r);
+		}
+	}
+	return 0;
+}
+f0107857:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010785a:	5b                   	pop    %ebx
+f010785b:	5e                   	pop    %esi
+f010785c:	5f                   	pop    %edi
+f010785d:	5d                   	pop    %ebp
+f010785e:	c3                   	ret
+
+f010785f <pci_conf1_set_addr>:
+{
+f010785f:	55                   	push   %ebp
+f0107860:	89 e5                	mov    %esp,%ebp
+f0107862:	56                   	push   %esi
+f0107863:	53                   	push   %ebx
+f0107864:	8b 75 08             	mov    0x8(%ebp),%esi
+	assert(bus < 256);
+f0107867:	3d ff 00 00 00       	cmp    $0xff,%eax
+f010786c:	77 3b                	ja     f01078a9 <pci_conf1_set_addr+0x4a>
+	assert(dev < 32);
+f010786e:	83 fa 1f             	cmp    $0x1f,%edx
+f0107871:	77 4c                	ja     f01078bf <pci_conf1_set_addr+0x60>
+	assert(func < 8);
+f0107873:	83 f9 07             	cmp    $0x7,%ecx
+f0107876:	77 5d                	ja     f01078d5 <pci_conf1_set_addr+0x76>
+	assert(offset < 256);
+f0107878:	81 fe ff 00 00 00    	cmp    $0xff,%esi
+f010787e:	77 6b                	ja     f01078eb <pci_conf1_set_addr+0x8c>
+	assert((offset & 0x3) == 0);
+f0107880:	f7 c6 03 00 00 00    	test   $0x3,%esi
+f0107886:	75 79                	jne    f0107901 <pci_conf1_set_addr+0xa2>
+		(bus << 16) | (dev << 11) | (func << 8) | (offset);
+f0107888:	c1 e0 10             	shl    $0x10,%eax
+f010788b:	09 f0                	or     %esi,%eax
+f010788d:	c1 e1 08             	shl    $0x8,%ecx
+f0107890:	09 c8                	or     %ecx,%eax
+f0107892:	c1 e2 0b             	shl    $0xb,%edx
+f0107895:	09 d0                	or     %edx,%eax
+	uint32_t v = (1 << 31) |		// config-space
+f0107897:	0d 00 00 00 80       	or     $0x80000000,%eax
+	asm volatile("outl %0,%w1" : : "a" (data), "d" (port));
+f010789c:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+f01078a1:	ef                   	out    %eax,(%dx)
+}
+f01078a2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f01078a5:	5b                   	pop    %ebx
+f01078a6:	5e                   	pop    %esi
+f01078a7:	5d                   	pop    %ebp
+f01078a8:	c3                   	ret
+	assert(bus < 256);
+f01078a9:	68 13 a4 10 f0       	push   $0xf010a413
+f01078ae:	68 1f 93 10 f0       	push   $0xf010931f
+f01078b3:	6a 2c                	push   $0x2c
+f01078b5:	68 1d a4 10 f0       	push   $0xf010a41d
+f01078ba:	e8 93 87 ff ff       	call   f0100052 <_panic>
+	assert(dev < 32);
+f01078bf:	68 28 a4 10 f0       	push   $0xf010a428
+f01078c4:	68 1f 93 10 f0       	push   $0xf010931f
+f01078c9:	6a 2d                	push   $0x2d
+f01078cb:	68 1d a4 10 f0       	push   $0xf010a41d
+f01078d0:	e8 7d 87 ff ff       	call   f0100052 <_panic>
+	assert(func < 8);
+f01078d5:	68 31 a4 10 f0       	push   $0xf010a431
+f01078da:	68 1f 93 10 f0       	push   $0xf010931f
+f01078df:	6a 2e                	push   $0x2e
+f01078e1:	68 1d a4 10 f0       	push   $0xf010a41d
+f01078e6:	e8 67 87 ff ff       	call   f0100052 <_panic>
+	assert(offset < 256);
+f01078eb:	68 3a a4 10 f0       	push   $0xf010a43a
+f01078f0:	68 1f 93 10 f0       	push   $0xf010931f
+f01078f5:	6a 2f                	push   $0x2f
+f01078f7:	68 1d a4 10 f0       	push   $0xf010a41d
+f01078fc:	e8 51 87 ff ff       	call   f0100052 <_panic>
+	assert((offset & 0x3) == 0);
+f0107901:	68 47 a4 10 f0       	push   $0xf010a447
+f0107906:	68 1f 93 10 f0       	push   $0xf010931f
+f010790b:	6a 30                	push   $0x30
+f010790d:	68 1d a4 10 f0       	push   $0xf010a41d
+f0107912:	e8 3b 87 ff ff       	call   f0100052 <_panic>
+
+f0107917 <pci_conf_read>:
+{
+f0107917:	55                   	push   %ebp
+f0107918:	89 e5                	mov    %esp,%ebp
+f010791a:	53                   	push   %ebx
+f010791b:	83 ec 10             	sub    $0x10,%esp
+f010791e:	89 d3                	mov    %edx,%ebx
+	pci_conf1_set_addr(f->bus->busno, f->dev, f->func, off);
+f0107920:	8b 48 08             	mov    0x8(%eax),%ecx
+f0107923:	8b 50 04             	mov    0x4(%eax),%edx
+f0107926:	8b 00                	mov    (%eax),%eax
+f0107928:	8b 40 04             	mov    0x4(%eax),%eax
+f010792b:	53                   	push   %ebx
+f010792c:	e8 2e ff ff ff       	call   f010785f <pci_conf1_set_addr>
+	asm volatile("inl %w1,%0" : "=a" (data) : "d" (port));
+f0107931:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+f0107936:	ed                   	in     (%dx),%eax
+}
+f0107937:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010793a:	c9                   	leave
+f010793b:	c3                   	ret
+
+f010793c <pci_scan_bus>:
+		f->irq_line);
+}
+
+static int
+pci_scan_bus(struct pci_bus *bus)
+{
+f010793c:	55                   	push   %ebp
+f010793d:	89 e5                	mov    %esp,%ebp
+f010793f:	57                   	push   %edi
+f0107940:	56                   	push   %esi
+f0107941:	53                   	push   %ebx
+f0107942:	81 ec 00 01 00 00    	sub    $0x100,%esp
+f0107948:	89 c3                	mov    %eax,%ebx
+	int totaldev = 0;
+	struct pci_func df;
+	memset(&df, 0, sizeof(df));
+f010794a:	6a 48                	push   $0x48
+f010794c:	6a 00                	push   $0x0
+f010794e:	8d 45 a0             	lea    -0x60(%ebp),%eax
+f0107951:	50                   	push   %eax
+f0107952:	e8 a4 ef ff ff       	call   f01068fb <memset>
+	df.bus = bus;
+f0107957:	89 5d a0             	mov    %ebx,-0x60(%ebp)
+
+	for (df.dev = 0; df.dev < 32; df.dev++) {
+f010795a:	83 c4 10             	add    $0x10,%esp
+f010795d:	b8 00 00 00 00       	mov    $0x0,%eax
+	int totaldev = 0;
+f0107962:	c7 85 f8 fe ff ff 00 	movl   $0x0,-0x108(%ebp)
+f0107969:	00 00 00 
+	for (df.dev = 0; df.dev < 32; df.dev++) {
+f010796c:	e9 3e 01 00 00       	jmp    f0107aaf <pci_scan_bus+0x173>
+	cprintf("PCI: %02x:%02x.%d: %04x:%04x: class: %x.%x (%s) irq: %d\n",
+f0107971:	83 ec 08             	sub    $0x8,%esp
+f0107974:	89 fa                	mov    %edi,%edx
+f0107976:	0f b6 fa             	movzbl %dl,%edi
+f0107979:	57                   	push   %edi
+f010797a:	51                   	push   %ecx
+		PCI_CLASS(f->dev_class), PCI_SUBCLASS(f->dev_class), class,
+f010797b:	c1 e8 10             	shr    $0x10,%eax
+	cprintf("PCI: %02x:%02x.%d: %04x:%04x: class: %x.%x (%s) irq: %d\n",
+f010797e:	0f b6 c0             	movzbl %al,%eax
+f0107981:	50                   	push   %eax
+f0107982:	ff b5 00 ff ff ff    	push   -0x100(%ebp)
+f0107988:	c1 ee 10             	shr    $0x10,%esi
+f010798b:	56                   	push   %esi
+f010798c:	ff b5 04 ff ff ff    	push   -0xfc(%ebp)
+f0107992:	53                   	push   %ebx
+f0107993:	ff b5 5c ff ff ff    	push   -0xa4(%ebp)
+f0107999:	8b 85 58 ff ff ff    	mov    -0xa8(%ebp),%eax
+f010799f:	ff 70 04             	push   0x4(%eax)
+f01079a2:	68 e8 a2 10 f0       	push   $0xf010a2e8
+f01079a7:	e8 2e ca ff ff       	call   f01043da <cprintf>
+				 PCI_SUBCLASS(f->dev_class),
+f01079ac:	8b 85 68 ff ff ff    	mov    -0x98(%ebp),%eax
+		pci_attach_match(PCI_CLASS(f->dev_class),
+f01079b2:	83 c4 24             	add    $0x24,%esp
+				 PCI_SUBCLASS(f->dev_class),
+f01079b5:	89 c2                	mov    %eax,%edx
+f01079b7:	c1 ea 10             	shr    $0x10,%edx
+		pci_attach_match(PCI_CLASS(f->dev_class),
+f01079ba:	0f b6 d2             	movzbl %dl,%edx
+f01079bd:	c1 e8 18             	shr    $0x18,%eax
+f01079c0:	8d 8d 58 ff ff ff    	lea    -0xa8(%ebp),%ecx
+f01079c6:	51                   	push   %ecx
+f01079c7:	b9 84 67 11 f0       	mov    $0xf0116784,%ecx
+f01079cc:	e8 31 fe ff ff       	call   f0107802 <pci_attach_match>
+				 &pci_attach_class[0], f) ||
+f01079d1:	83 c4 10             	add    $0x10,%esp
+f01079d4:	85 c0                	test   %eax,%eax
+f01079d6:	0f 84 a3 00 00 00    	je     f0107a7f <pci_scan_bus+0x143>
+
+		totaldev++;
+
+		struct pci_func f = df;
+		for (f.func = 0; f.func < (PCI_HDRTYPE_MULTIFN(bhlc) ? 8 : 1);
+		     f.func++) {
+f01079dc:	83 c3 01             	add    $0x1,%ebx
+		for (f.func = 0; f.func < (PCI_HDRTYPE_MULTIFN(bhlc) ? 8 : 1);
+f01079df:	89 9d 18 ff ff ff    	mov    %ebx,-0xe8(%ebp)
+f01079e5:	8b 85 fc fe ff ff    	mov    -0x104(%ebp),%eax
+f01079eb:	39 c3                	cmp    %eax,%ebx
+f01079ed:	0f 83 b6 00 00 00    	jae    f0107aa9 <pci_scan_bus+0x16d>
+			struct pci_func af = f;
+f01079f3:	8d bd 58 ff ff ff    	lea    -0xa8(%ebp),%edi
+f01079f9:	8d b5 10 ff ff ff    	lea    -0xf0(%ebp),%esi
+f01079ff:	b9 12 00 00 00       	mov    $0x12,%ecx
+f0107a04:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+
+			af.dev_id = pci_conf_read(&f, PCI_ID_REG);
+f0107a06:	ba 00 00 00 00       	mov    $0x0,%edx
+f0107a0b:	8d 85 10 ff ff ff    	lea    -0xf0(%ebp),%eax
+f0107a11:	e8 01 ff ff ff       	call   f0107917 <pci_conf_read>
+f0107a16:	89 c6                	mov    %eax,%esi
+f0107a18:	89 85 64 ff ff ff    	mov    %eax,-0x9c(%ebp)
+			if (PCI_VENDOR(af.dev_id) == 0xffff)
+f0107a1e:	0f b7 c0             	movzwl %ax,%eax
+f0107a21:	89 85 04 ff ff ff    	mov    %eax,-0xfc(%ebp)
+f0107a27:	66 83 fe ff          	cmp    $0xffff,%si
+f0107a2b:	74 af                	je     f01079dc <pci_scan_bus+0xa0>
+				continue;
+
+			uint32_t intr = pci_conf_read(&af, PCI_INTERRUPT_REG);
+f0107a2d:	ba 3c 00 00 00       	mov    $0x3c,%edx
+f0107a32:	8d 85 58 ff ff ff    	lea    -0xa8(%ebp),%eax
+f0107a38:	e8 da fe ff ff       	call   f0107917 <pci_conf_read>
+f0107a3d:	89 c7                	mov    %eax,%edi
+			af.irq_line = PCI_INTERRUPT_LINE(intr);
+f0107a3f:	88 45 9c             	mov    %al,-0x64(%ebp)
+
+			af.dev_class = pci_conf_read(&af, PCI_CLASS_REG);
+f0107a42:	ba 08 00 00 00       	mov    $0x8,%edx
+f0107a47:	8d 85 58 ff ff ff    	lea    -0xa8(%ebp),%eax
+f0107a4d:	e8 c5 fe ff ff       	call   f0107917 <pci_conf_read>
+f0107a52:	89 85 68 ff ff ff    	mov    %eax,-0x98(%ebp)
+	if (PCI_CLASS(f->dev_class) < ARRAY_SIZE(pci_class))
+f0107a58:	89 c2                	mov    %eax,%edx
+f0107a5a:	c1 ea 18             	shr    $0x18,%edx
+f0107a5d:	89 95 00 ff ff ff    	mov    %edx,-0x100(%ebp)
+	const char *class = pci_class[0];
+f0107a63:	b9 5b a4 10 f0       	mov    $0xf010a45b,%ecx
+	if (PCI_CLASS(f->dev_class) < ARRAY_SIZE(pci_class))
+f0107a68:	3d ff ff ff 06       	cmp    $0x6ffffff,%eax
+f0107a6d:	0f 87 fe fe ff ff    	ja     f0107971 <pci_scan_bus+0x35>
+		class = pci_class[PCI_CLASS(f->dev_class)];
+f0107a73:	8b 0c 95 d0 a4 10 f0 	mov    -0xfef5b30(,%edx,4),%ecx
+f0107a7a:	e9 f2 fe ff ff       	jmp    f0107971 <pci_scan_bus+0x35>
+				 PCI_PRODUCT(f->dev_id),
+f0107a7f:	8b 85 64 ff ff ff    	mov    -0x9c(%ebp),%eax
+		pci_attach_match(PCI_VENDOR(f->dev_id),
+f0107a85:	89 c2                	mov    %eax,%edx
+f0107a87:	c1 ea 10             	shr    $0x10,%edx
+f0107a8a:	0f b7 c0             	movzwl %ax,%eax
+f0107a8d:	83 ec 0c             	sub    $0xc,%esp
+f0107a90:	8d bd 58 ff ff ff    	lea    -0xa8(%ebp),%edi
+f0107a96:	57                   	push   %edi
+f0107a97:	b9 6c 67 11 f0       	mov    $0xf011676c,%ecx
+f0107a9c:	e8 61 fd ff ff       	call   f0107802 <pci_attach_match>
+f0107aa1:	83 c4 10             	add    $0x10,%esp
+f0107aa4:	e9 33 ff ff ff       	jmp    f01079dc <pci_scan_bus+0xa0>
+	for (df.dev = 0; df.dev < 32; df.dev++) {
+f0107aa9:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+f0107aac:	83 c0 01             	add    $0x1,%eax
+f0107aaf:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+f0107ab2:	83 f8 1f             	cmp    $0x1f,%eax
+f0107ab5:	77 4b                	ja     f0107b02 <pci_scan_bus+0x1c6>
+		uint32_t bhlc = pci_conf_read(&df, PCI_BHLC_REG);
+f0107ab7:	ba 0c 00 00 00       	mov    $0xc,%edx
+f0107abc:	8d 45 a0             	lea    -0x60(%ebp),%eax
+f0107abf:	e8 53 fe ff ff       	call   f0107917 <pci_conf_read>
+		if (PCI_HDRTYPE_TYPE(bhlc) > 1)	    // Unsupported or no device
+f0107ac4:	89 c2                	mov    %eax,%edx
+f0107ac6:	c1 ea 10             	shr    $0x10,%edx
+f0107ac9:	89 d3                	mov    %edx,%ebx
+f0107acb:	83 e3 7e             	and    $0x7e,%ebx
+f0107ace:	75 d9                	jne    f0107aa9 <pci_scan_bus+0x16d>
+		totaldev++;
+f0107ad0:	83 85 f8 fe ff ff 01 	addl   $0x1,-0x108(%ebp)
+		struct pci_func f = df;
+f0107ad7:	8d bd 10 ff ff ff    	lea    -0xf0(%ebp),%edi
+f0107add:	8d 75 a0             	lea    -0x60(%ebp),%esi
+f0107ae0:	b9 12 00 00 00       	mov    $0x12,%ecx
+f0107ae5:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+		for (f.func = 0; f.func < (PCI_HDRTYPE_MULTIFN(bhlc) ? 8 : 1);
+f0107ae7:	25 00 00 80 00       	and    $0x800000,%eax
+f0107aec:	83 f8 01             	cmp    $0x1,%eax
+f0107aef:	19 c0                	sbb    %eax,%eax
+f0107af1:	83 e0 f9             	and    $0xfffffff9,%eax
+f0107af4:	83 c0 08             	add    $0x8,%eax
+f0107af7:	89 85 fc fe ff ff    	mov    %eax,-0x104(%ebp)
+f0107afd:	e9 dd fe ff ff       	jmp    f01079df <pci_scan_bus+0xa3>
+			pci_attach(&af);
+		}
+	}
+
+	return totaldev;
+}
+f0107b02:	8b 85 f8 fe ff ff    	mov    -0x108(%ebp),%eax
+f0107b08:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0107b0b:	5b                   	pop    %ebx
+f0107b0c:	5e                   	pop    %esi
+f0107b0d:	5f                   	pop    %edi
+f0107b0e:	5d                   	pop    %ebp
+f0107b0f:	c3                   	ret
+
+f0107b10 <pci_bridge_attach>:
+
+static int
+pci_bridge_attach(struct pci_func *pcif)
+{
+f0107b10:	55                   	push   %ebp
+f0107b11:	89 e5                	mov    %esp,%ebp
+f0107b13:	57                   	push   %edi
+f0107b14:	56                   	push   %esi
+f0107b15:	53                   	push   %ebx
+f0107b16:	83 ec 1c             	sub    $0x1c,%esp
+f0107b19:	8b 75 08             	mov    0x8(%ebp),%esi
+	uint32_t ioreg  = pci_conf_read(pcif, PCI_BRIDGE_STATIO_REG);
+f0107b1c:	ba 1c 00 00 00       	mov    $0x1c,%edx
+f0107b21:	89 f0                	mov    %esi,%eax
+f0107b23:	e8 ef fd ff ff       	call   f0107917 <pci_conf_read>
+f0107b28:	89 c7                	mov    %eax,%edi
+	uint32_t busreg = pci_conf_read(pcif, PCI_BRIDGE_BUS_REG);
+f0107b2a:	ba 18 00 00 00       	mov    $0x18,%edx
+f0107b2f:	89 f0                	mov    %esi,%eax
+f0107b31:	e8 e1 fd ff ff       	call   f0107917 <pci_conf_read>
+
+	if (PCI_BRIDGE_IO_32BITS(ioreg)) {
+f0107b36:	83 e7 0f             	and    $0xf,%edi
+f0107b39:	83 ff 01             	cmp    $0x1,%edi
+f0107b3c:	74 52                	je     f0107b90 <pci_bridge_attach+0x80>
+f0107b3e:	89 c3                	mov    %eax,%ebx
+			pcif->bus->busno, pcif->dev, pcif->func);
+		return 0;
+	}
+
+	struct pci_bus nbus;
+	memset(&nbus, 0, sizeof(nbus));
+f0107b40:	83 ec 04             	sub    $0x4,%esp
+f0107b43:	6a 08                	push   $0x8
+f0107b45:	6a 00                	push   $0x0
+f0107b47:	8d 7d e0             	lea    -0x20(%ebp),%edi
+f0107b4a:	57                   	push   %edi
+f0107b4b:	e8 ab ed ff ff       	call   f01068fb <memset>
+	nbus.parent_bridge = pcif;
+f0107b50:	89 75 e0             	mov    %esi,-0x20(%ebp)
+	nbus.busno = (busreg >> PCI_BRIDGE_BUS_SECONDARY_SHIFT) & 0xff;
+f0107b53:	0f b6 c7             	movzbl %bh,%eax
+f0107b56:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+
+	if (pci_show_devs)
+		cprintf("PCI: %02x:%02x.%d: bridge to PCI bus %d--%d\n",
+f0107b59:	83 c4 08             	add    $0x8,%esp
+			pcif->bus->busno, pcif->dev, pcif->func,
+			nbus.busno,
+			(busreg >> PCI_BRIDGE_BUS_SUBORDINATE_SHIFT) & 0xff);
+f0107b5c:	c1 eb 10             	shr    $0x10,%ebx
+		cprintf("PCI: %02x:%02x.%d: bridge to PCI bus %d--%d\n",
+f0107b5f:	0f b6 db             	movzbl %bl,%ebx
+f0107b62:	53                   	push   %ebx
+f0107b63:	50                   	push   %eax
+f0107b64:	ff 76 08             	push   0x8(%esi)
+f0107b67:	ff 76 04             	push   0x4(%esi)
+f0107b6a:	8b 06                	mov    (%esi),%eax
+f0107b6c:	ff 70 04             	push   0x4(%eax)
+f0107b6f:	68 58 a3 10 f0       	push   $0xf010a358
+f0107b74:	e8 61 c8 ff ff       	call   f01043da <cprintf>
+
+	pci_scan_bus(&nbus);
+f0107b79:	83 c4 20             	add    $0x20,%esp
+f0107b7c:	89 f8                	mov    %edi,%eax
+f0107b7e:	e8 b9 fd ff ff       	call   f010793c <pci_scan_bus>
+	return 1;
+f0107b83:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+f0107b88:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0107b8b:	5b                   	pop    %ebx
+f0107b8c:	5e                   	pop    %esi
+f0107b8d:	5f                   	pop    %edi
+f0107b8e:	5d                   	pop    %ebp
+f0107b8f:	c3                   	ret
+		cprintf("PCI: %02x:%02x.%d: 32-bit bridge IO not supported.\n",
+f0107b90:	ff 76 08             	push   0x8(%esi)
+f0107b93:	ff 76 04             	push   0x4(%esi)
+f0107b96:	8b 06                	mov    (%esi),%eax
+f0107b98:	ff 70 04             	push   0x4(%eax)
+f0107b9b:	68 24 a3 10 f0       	push   $0xf010a324
+f0107ba0:	e8 35 c8 ff ff       	call   f01043da <cprintf>
+		return 0;
+f0107ba5:	83 c4 10             	add    $0x10,%esp
+f0107ba8:	b8 00 00 00 00       	mov    $0x0,%eax
+f0107bad:	eb d9                	jmp    f0107b88 <pci_bridge_attach+0x78>
+
+f0107baf <pci_conf_write>:
+{
+f0107baf:	55                   	push   %ebp
+f0107bb0:	89 e5                	mov    %esp,%ebp
+f0107bb2:	57                   	push   %edi
+f0107bb3:	56                   	push   %esi
+f0107bb4:	53                   	push   %ebx
+f0107bb5:	83 ec 18             	sub    $0x18,%esp
+f0107bb8:	89 d7                	mov    %edx,%edi
+f0107bba:	89 ce                	mov    %ecx,%esi
+	pci_conf1_set_addr(f->bus->busno, f->dev, f->func, off);
+f0107bbc:	8b 48 08             	mov    0x8(%eax),%ecx
+f0107bbf:	8b 50 04             	mov    0x4(%eax),%edx
+f0107bc2:	8b 00                	mov    (%eax),%eax
+f0107bc4:	8b 40 04             	mov    0x4(%eax),%eax
+f0107bc7:	57                   	push   %edi
+f0107bc8:	e8 92 fc ff ff       	call   f010785f <pci_conf1_set_addr>
+	asm volatile("outl %0,%w1" : : "a" (data), "d" (port));
+f0107bcd:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+f0107bd2:	89 f0                	mov    %esi,%eax
+f0107bd4:	ef                   	out    %eax,(%dx)
+}
+f0107bd5:	83 c4 10             	add    $0x10,%esp
+f0107bd8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0107bdb:	5b                   	pop    %ebx
+f0107bdc:	5e                   	pop    %esi
+f0107bdd:	5f                   	pop    %edi
+f0107bde:	5d                   	pop    %ebp
+f0107bdf:	c3                   	ret
+
+f0107be0 <pci_func_enable>:
+
+// External PCI subsystem interface
+
+void
+pci_func_enable(struct pci_func *f)
+{
+f0107be0:	55                   	push   %ebp
+f0107be1:	89 e5                	mov    %esp,%ebp
+f0107be3:	57                   	push   %edi
+f0107be4:	56                   	push   %esi
+f0107be5:	53                   	push   %ebx
+f0107be6:	83 ec 1c             	sub    $0x1c,%esp
+f0107be9:	8b 7d 08             	mov    0x8(%ebp),%edi
+	pci_conf_write(f, PCI_COMMAND_STATUS_REG,
+f0107bec:	b9 07 00 00 00       	mov    $0x7,%ecx
+f0107bf1:	ba 04 00 00 00       	mov    $0x4,%edx
+f0107bf6:	89 f8                	mov    %edi,%eax
+f0107bf8:	e8 b2 ff ff ff       	call   f0107baf <pci_conf_write>
+		       PCI_COMMAND_MEM_ENABLE |
+		       PCI_COMMAND_MASTER_ENABLE);
+
+	uint32_t bar_width;
+	uint32_t bar;
+	for (bar = PCI_MAPREG_START; bar < PCI_MAPREG_END;
+f0107bfd:	be 10 00 00 00       	mov    $0x10,%esi
+f0107c02:	eb 29                	jmp    f0107c2d <pci_func_enable+0x4d>
+			base = PCI_MAPREG_MEM_ADDR(oldv);
+			if (pci_show_addrs)
+				cprintf("  mem region %d: %d bytes at 0x%x\n",
+					regnum, size, base);
+		} else {
+			size = PCI_MAPREG_IO_SIZE(rv);
+f0107c04:	89 d8                	mov    %ebx,%eax
+f0107c06:	83 e0 fc             	and    $0xfffffffc,%eax
+f0107c09:	f7 d8                	neg    %eax
+f0107c0b:	21 c3                	and    %eax,%ebx
+			base = PCI_MAPREG_IO_ADDR(oldv);
+f0107c0d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0107c10:	83 e0 fc             	and    $0xfffffffc,%eax
+f0107c13:	89 45 dc             	mov    %eax,-0x24(%ebp)
+		bar_width = 4;
+f0107c16:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+f0107c1d:	eb 7a                	jmp    f0107c99 <pci_func_enable+0xb9>
+	     bar += bar_width)
+f0107c1f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0107c22:	01 c6                	add    %eax,%esi
+	for (bar = PCI_MAPREG_START; bar < PCI_MAPREG_END;
+f0107c24:	83 fe 27             	cmp    $0x27,%esi
+f0107c27:	0f 87 c7 00 00 00    	ja     f0107cf4 <pci_func_enable+0x114>
+		uint32_t oldv = pci_conf_read(f, bar);
+f0107c2d:	89 f2                	mov    %esi,%edx
+f0107c2f:	89 f8                	mov    %edi,%eax
+f0107c31:	e8 e1 fc ff ff       	call   f0107917 <pci_conf_read>
+f0107c36:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		pci_conf_write(f, bar, 0xffffffff);
+f0107c39:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+f0107c3e:	89 f2                	mov    %esi,%edx
+f0107c40:	89 f8                	mov    %edi,%eax
+f0107c42:	e8 68 ff ff ff       	call   f0107baf <pci_conf_write>
+		uint32_t rv = pci_conf_read(f, bar);
+f0107c47:	89 f2                	mov    %esi,%edx
+f0107c49:	89 f8                	mov    %edi,%eax
+f0107c4b:	e8 c7 fc ff ff       	call   f0107917 <pci_conf_read>
+f0107c50:	89 c3                	mov    %eax,%ebx
+		bar_width = 4;
+f0107c52:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+		if (rv == 0)
+f0107c59:	85 c0                	test   %eax,%eax
+f0107c5b:	74 c2                	je     f0107c1f <pci_func_enable+0x3f>
+		int regnum = PCI_MAPREG_NUM(bar);
+f0107c5d:	8d 46 f0             	lea    -0x10(%esi),%eax
+f0107c60:	89 c2                	mov    %eax,%edx
+f0107c62:	c1 ea 02             	shr    $0x2,%edx
+f0107c65:	89 55 d8             	mov    %edx,-0x28(%ebp)
+		if (PCI_MAPREG_TYPE(rv) == PCI_MAPREG_TYPE_MEM) {
+f0107c68:	f6 c3 01             	test   $0x1,%bl
+f0107c6b:	75 97                	jne    f0107c04 <pci_func_enable+0x24>
+			if (PCI_MAPREG_MEM_TYPE(rv) == PCI_MAPREG_MEM_TYPE_64BIT)
+f0107c6d:	89 da                	mov    %ebx,%edx
+f0107c6f:	83 e2 06             	and    $0x6,%edx
+		bar_width = 4;
+f0107c72:	83 fa 04             	cmp    $0x4,%edx
+f0107c75:	0f 94 c1             	sete   %cl
+f0107c78:	0f b6 c9             	movzbl %cl,%ecx
+f0107c7b:	8d 14 8d 04 00 00 00 	lea    0x4(,%ecx,4),%edx
+f0107c82:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+			size = PCI_MAPREG_MEM_SIZE(rv);
+f0107c85:	89 da                	mov    %ebx,%edx
+f0107c87:	83 e2 f0             	and    $0xfffffff0,%edx
+f0107c8a:	89 d0                	mov    %edx,%eax
+f0107c8c:	f7 d8                	neg    %eax
+f0107c8e:	21 c3                	and    %eax,%ebx
+			base = PCI_MAPREG_MEM_ADDR(oldv);
+f0107c90:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0107c93:	83 e0 f0             	and    $0xfffffff0,%eax
+f0107c96:	89 45 dc             	mov    %eax,-0x24(%ebp)
+			if (pci_show_addrs)
+				cprintf("  io region %d: %d bytes at 0x%x\n",
+					regnum, size, base);
+		}
+
+		pci_conf_write(f, bar, oldv);
+f0107c99:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+f0107c9c:	89 f2                	mov    %esi,%edx
+f0107c9e:	89 f8                	mov    %edi,%eax
+f0107ca0:	e8 0a ff ff ff       	call   f0107baf <pci_conf_write>
+		f->reg_base[regnum] = base;
+f0107ca5:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+f0107ca8:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f0107cab:	89 44 8f 14          	mov    %eax,0x14(%edi,%ecx,4)
+		f->reg_size[regnum] = size;
+f0107caf:	89 5c 8f 2c          	mov    %ebx,0x2c(%edi,%ecx,4)
+
+		if (size && !base)
+f0107cb3:	85 db                	test   %ebx,%ebx
+f0107cb5:	0f 84 64 ff ff ff    	je     f0107c1f <pci_func_enable+0x3f>
+f0107cbb:	85 c0                	test   %eax,%eax
+f0107cbd:	0f 85 5c ff ff ff    	jne    f0107c1f <pci_func_enable+0x3f>
+			cprintf("PCI device %02x:%02x.%d (%04x:%04x) "
+				"may be misconfigured: "
+				"region %d: base 0x%x, size %d\n",
+				f->bus->busno, f->dev, f->func,
+				PCI_VENDOR(f->dev_id), PCI_PRODUCT(f->dev_id),
+f0107cc3:	8b 47 0c             	mov    0xc(%edi),%eax
+			cprintf("PCI device %02x:%02x.%d (%04x:%04x) "
+f0107cc6:	83 ec 0c             	sub    $0xc,%esp
+f0107cc9:	53                   	push   %ebx
+f0107cca:	6a 00                	push   $0x0
+f0107ccc:	51                   	push   %ecx
+f0107ccd:	89 c2                	mov    %eax,%edx
+f0107ccf:	c1 ea 10             	shr    $0x10,%edx
+f0107cd2:	52                   	push   %edx
+f0107cd3:	0f b7 c0             	movzwl %ax,%eax
+f0107cd6:	50                   	push   %eax
+f0107cd7:	ff 77 08             	push   0x8(%edi)
+f0107cda:	ff 77 04             	push   0x4(%edi)
+f0107cdd:	8b 07                	mov    (%edi),%eax
+f0107cdf:	ff 70 04             	push   0x4(%eax)
+f0107ce2:	68 88 a3 10 f0       	push   $0xf010a388
+f0107ce7:	e8 ee c6 ff ff       	call   f01043da <cprintf>
+f0107cec:	83 c4 30             	add    $0x30,%esp
+f0107cef:	e9 2b ff ff ff       	jmp    f0107c1f <pci_func_enable+0x3f>
+				regnum, base, size);
+	}
+
+	cprintf("PCI function %02x:%02x.%d (%04x:%04x) enabled\n",
+		f->bus->busno, f->dev, f->func,
+		PCI_VENDOR(f->dev_id), PCI_PRODUCT(f->dev_id));
+f0107cf4:	8b 47 0c             	mov    0xc(%edi),%eax
+	cprintf("PCI function %02x:%02x.%d (%04x:%04x) enabled\n",
+f0107cf7:	83 ec 08             	sub    $0x8,%esp
+f0107cfa:	89 c2                	mov    %eax,%edx
+f0107cfc:	c1 ea 10             	shr    $0x10,%edx
+f0107cff:	52                   	push   %edx
+f0107d00:	0f b7 c0             	movzwl %ax,%eax
+f0107d03:	50                   	push   %eax
+f0107d04:	ff 77 08             	push   0x8(%edi)
+f0107d07:	ff 77 04             	push   0x4(%edi)
+f0107d0a:	8b 07                	mov    (%edi),%eax
+f0107d0c:	ff 70 04             	push   0x4(%eax)
+f0107d0f:	68 e4 a3 10 f0       	push   $0xf010a3e4
+f0107d14:	e8 c1 c6 ff ff       	call   f01043da <cprintf>
+}
+f0107d19:	83 c4 20             	add    $0x20,%esp
+f0107d1c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0107d1f:	5b                   	pop    %ebx
+f0107d20:	5e                   	pop    %esi
+f0107d21:	5f                   	pop    %edi
+f0107d22:	5d                   	pop    %ebp
+f0107d23:	c3                   	ret
+
+f0107d24 <pci_init>:
+
+int
+pci_init(void)
+{
+f0107d24:	55                   	push   %ebp
+f0107d25:	89 e5                	mov    %esp,%ebp
+f0107d27:	83 ec 0c             	sub    $0xc,%esp
+	static struct pci_bus root_bus;
+	memset(&root_bus, 0, sizeof(root_bus));
+f0107d2a:	6a 08                	push   $0x8
+f0107d2c:	6a 00                	push   $0x0
+f0107d2e:	68 a4 66 66 f0       	push   $0xf06666a4
+f0107d33:	e8 c3 eb ff ff       	call   f01068fb <memset>
+
+	return pci_scan_bus(&root_bus);
+f0107d38:	b8 a4 66 66 f0       	mov    $0xf06666a4,%eax
+f0107d3d:	e8 fa fb ff ff       	call   f010793c <pci_scan_bus>
+}
+f0107d42:	c9                   	leave
+f0107d43:	c3                   	ret
+
+f0107d44 <time_init>:
+static unsigned int ticks;
+
+void
+time_init(void)
+{
+	ticks = 0;
+f0107d44:	c7 05 ac 66 66 f0 00 	movl   $0x0,0xf06666ac
+f0107d4b:	00 00 00 
+}
+f0107d4e:	c3                   	ret
+
+f0107d4f <time_tick>:
+// This should be called once per timer interrupt.  A timer interrupt
+// fires every 10 ms.
+void
+time_tick(void)
+{
+	ticks++;
+f0107d4f:	a1 ac 66 66 f0       	mov    0xf06666ac,%eax
+f0107d54:	83 c0 01             	add    $0x1,%eax
+f0107d57:	a3 ac 66 66 f0       	mov    %eax,0xf06666ac
+	if (ticks * 10 < ticks)
+f0107d5c:	8d 14 80             	lea    (%eax,%eax,4),%edx
+f0107d5f:	01 d2                	add    %edx,%edx
+f0107d61:	39 c2                	cmp    %eax,%edx
+f0107d63:	72 01                	jb     f0107d66 <time_tick+0x17>
+f0107d65:	c3                   	ret
+{
+f0107d66:	55                   	push   %ebp
+f0107d67:	89 e5                	mov    %esp,%ebp
+f0107d69:	83 ec 0c             	sub    $0xc,%esp
+		panic("time_tick: time overflowed");
+f0107d6c:	68 ec a4 10 f0       	push   $0xf010a4ec
+f0107d71:	6a 13                	push   $0x13
+f0107d73:	68 07 a5 10 f0       	push   $0xf010a507
+f0107d78:	e8 d5 82 ff ff       	call   f0100052 <_panic>
+
+f0107d7d <time_msec>:
+}
+
+unsigned int
+time_msec(void)
+{
+	return ticks * 10;
+f0107d7d:	a1 ac 66 66 f0       	mov    0xf06666ac,%eax
+f0107d82:	8d 04 80             	lea    (%eax,%eax,4),%eax
+f0107d85:	01 c0                	add    %eax,%eax
+}
+f0107d87:	c3                   	ret
+f0107d88:	66 90                	xchg   %ax,%ax
+f0107d8a:	66 90                	xchg   %ax,%ax
+f0107d8c:	66 90                	xchg   %ax,%ax
+f0107d8e:	66 90                	xchg   %ax,%ax
+
+f0107d90 <__udivmoddi4>:
+f0107d90:	55                   	push   %ebp
+f0107d91:	57                   	push   %edi
+f0107d92:	56                   	push   %esi
+f0107d93:	53                   	push   %ebx
+f0107d94:	83 ec 24             	sub    $0x24,%esp
+f0107d97:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+f0107d9b:	8b 44 24 38          	mov    0x38(%esp),%eax
+f0107d9f:	8b 7c 24 48          	mov    0x48(%esp),%edi
+f0107da3:	89 54 24 14          	mov    %edx,0x14(%esp)
+f0107da7:	8b 54 24 44          	mov    0x44(%esp),%edx
+f0107dab:	89 44 24 10          	mov    %eax,0x10(%esp)
+f0107daf:	8b 44 24 40          	mov    0x40(%esp),%eax
+f0107db3:	89 d3                	mov    %edx,%ebx
+f0107db5:	89 54 24 0c          	mov    %edx,0xc(%esp)
+f0107db9:	09 c3                	or     %eax,%ebx
+f0107dbb:	89 44 24 08          	mov    %eax,0x8(%esp)
+f0107dbf:	0f 84 9c 00 00 00    	je     f0107e61 <__udivmoddi4+0xd1>
+f0107dc5:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+f0107dcc:	00 
+f0107dcd:	31 c0                	xor    %eax,%eax
+f0107dcf:	31 d2                	xor    %edx,%edx
+f0107dd1:	89 fb                	mov    %edi,%ebx
+f0107dd3:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+f0107dda:	00 
+f0107ddb:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+f0107de0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+f0107de4:	01 c0                	add    %eax,%eax
+f0107de6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+f0107ded:	00 
+f0107dee:	89 c6                	mov    %eax,%esi
+f0107df0:	89 d7                	mov    %edx,%edi
+f0107df2:	8b 44 24 10          	mov    0x10(%esp),%eax
+f0107df6:	8b 54 24 14          	mov    0x14(%esp),%edx
+f0107dfa:	0f ad d0             	shrd   %cl,%edx,%eax
+f0107dfd:	d3 ea                	shr    %cl,%edx
+f0107dff:	f6 c1 20             	test   $0x20,%cl
+f0107e02:	0f 45 c2             	cmovne %edx,%eax
+f0107e05:	8b 54 24 04          	mov    0x4(%esp),%edx
+f0107e09:	83 e0 01             	and    $0x1,%eax
+f0107e0c:	09 fa                	or     %edi,%edx
+f0107e0e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+f0107e12:	89 04 24             	mov    %eax,(%esp)
+f0107e15:	8b 04 24             	mov    (%esp),%eax
+f0107e18:	89 d5                	mov    %edx,%ebp
+f0107e1a:	09 f0                	or     %esi,%eax
+f0107e1c:	8b 74 24 08          	mov    0x8(%esp),%esi
+f0107e20:	39 f0                	cmp    %esi,%eax
+f0107e22:	19 fd                	sbb    %edi,%ebp
+f0107e24:	72 1d                	jb     f0107e43 <__udivmoddi4+0xb3>
+f0107e26:	29 f0                	sub    %esi,%eax
+f0107e28:	19 fa                	sbb    %edi,%edx
+f0107e2a:	89 cf                	mov    %ecx,%edi
+f0107e2c:	c1 ef 05             	shr    $0x5,%edi
+f0107e2f:	83 e7 01             	and    $0x1,%edi
+f0107e32:	89 fe                	mov    %edi,%esi
+f0107e34:	d3 e7                	shl    %cl,%edi
+f0107e36:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+f0107e3a:	83 f6 01             	xor    $0x1,%esi
+f0107e3d:	d3 e6                	shl    %cl,%esi
+f0107e3f:	09 74 24 18          	or     %esi,0x18(%esp)
+f0107e43:	83 e9 01             	sub    $0x1,%ecx
+f0107e46:	73 98                	jae    f0107de0 <__udivmoddi4+0x50>
+f0107e48:	85 db                	test   %ebx,%ebx
+f0107e4a:	74 05                	je     f0107e51 <__udivmoddi4+0xc1>
+f0107e4c:	89 03                	mov    %eax,(%ebx)
+f0107e4e:	89 53 04             	mov    %edx,0x4(%ebx)
+f0107e51:	8b 44 24 18          	mov    0x18(%esp),%eax
+f0107e55:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+f0107e59:	83 c4 24             	add    $0x24,%esp
+f0107e5c:	5b                   	pop    %ebx
+f0107e5d:	5e                   	pop    %esi
+f0107e5e:	5f                   	pop    %edi
+f0107e5f:	5d                   	pop    %ebp
+f0107e60:	c3                   	ret
+f0107e61:	85 ff                	test   %edi,%edi
+f0107e63:	74 0d                	je     f0107e72 <__udivmoddi4+0xe2>
+f0107e65:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+f0107e6b:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+f0107e72:	8b 44 24 08          	mov    0x8(%esp),%eax
+f0107e76:	8b 54 24 0c          	mov    0xc(%esp),%edx
+f0107e7a:	89 44 24 18          	mov    %eax,0x18(%esp)
+f0107e7e:	8b 44 24 18          	mov    0x18(%esp),%eax
+f0107e82:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+f0107e86:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+f0107e8a:	83 c4 24             	add    $0x24,%esp
+f0107e8d:	5b                   	pop    %ebx
+f0107e8e:	5e                   	pop    %esi
+f0107e8f:	5f                   	pop    %edi
+f0107e90:	5d                   	pop    %ebp
+f0107e91:	c3                   	ret
+f0107e92:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+f0107e99:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+f0107ea0 <__udivdi3>:
+f0107ea0:	57                   	push   %edi
+f0107ea1:	56                   	push   %esi
+f0107ea2:	53                   	push   %ebx
+f0107ea3:	83 ec 20             	sub    $0x20,%esp
+f0107ea6:	8b 54 24 34          	mov    0x34(%esp),%edx
+f0107eaa:	8b 44 24 30          	mov    0x30(%esp),%eax
+f0107eae:	89 54 24 0c          	mov    %edx,0xc(%esp)
+f0107eb2:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+f0107eb6:	89 44 24 08          	mov    %eax,0x8(%esp)
+f0107eba:	8b 44 24 38          	mov    0x38(%esp),%eax
+f0107ebe:	89 d1                	mov    %edx,%ecx
+f0107ec0:	89 54 24 14          	mov    %edx,0x14(%esp)
+f0107ec4:	09 c1                	or     %eax,%ecx
+f0107ec6:	89 44 24 10          	mov    %eax,0x10(%esp)
+f0107eca:	89 44 24 18          	mov    %eax,0x18(%esp)
+f0107ece:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+f0107ed2:	0f 84 88 00 00 00    	je     f0107f60 <__udivdi3+0xc0>
+f0107ed8:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+f0107edf:	00 
+f0107ee0:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+f0107ee5:	31 c0                	xor    %eax,%eax
+f0107ee7:	31 d2                	xor    %edx,%edx
+f0107ee9:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+f0107ef0:	00 
+f0107ef1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+f0107ef8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+f0107efc:	01 c0                	add    %eax,%eax
+f0107efe:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+f0107f05:	00 
+f0107f06:	89 c6                	mov    %eax,%esi
+f0107f08:	89 d7                	mov    %edx,%edi
+f0107f0a:	8b 44 24 08          	mov    0x8(%esp),%eax
+f0107f0e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+f0107f12:	0f ad d0             	shrd   %cl,%edx,%eax
+f0107f15:	d3 ea                	shr    %cl,%edx
+f0107f17:	f6 c1 20             	test   $0x20,%cl
+f0107f1a:	0f 45 c2             	cmovne %edx,%eax
+f0107f1d:	8b 54 24 04          	mov    0x4(%esp),%edx
+f0107f21:	83 e0 01             	and    $0x1,%eax
+f0107f24:	09 fa                	or     %edi,%edx
+f0107f26:	8b 7c 24 14          	mov    0x14(%esp),%edi
+f0107f2a:	89 04 24             	mov    %eax,(%esp)
+f0107f2d:	8b 04 24             	mov    (%esp),%eax
+f0107f30:	89 d3                	mov    %edx,%ebx
+f0107f32:	09 f0                	or     %esi,%eax
+f0107f34:	8b 74 24 10          	mov    0x10(%esp),%esi
+f0107f38:	39 f0                	cmp    %esi,%eax
+f0107f3a:	19 fb                	sbb    %edi,%ebx
+f0107f3c:	72 1d                	jb     f0107f5b <__udivdi3+0xbb>
+f0107f3e:	29 f0                	sub    %esi,%eax
+f0107f40:	19 fa                	sbb    %edi,%edx
+f0107f42:	89 cf                	mov    %ecx,%edi
+f0107f44:	c1 ef 05             	shr    $0x5,%edi
+f0107f47:	83 e7 01             	and    $0x1,%edi
+f0107f4a:	89 fe                	mov    %edi,%esi
+f0107f4c:	d3 e7                	shl    %cl,%edi
+f0107f4e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+f0107f52:	83 f6 01             	xor    $0x1,%esi
+f0107f55:	d3 e6                	shl    %cl,%esi
+f0107f57:	09 74 24 18          	or     %esi,0x18(%esp)
+f0107f5b:	83 e9 01             	sub    $0x1,%ecx
+f0107f5e:	73 98                	jae    f0107ef8 <__udivdi3+0x58>
+f0107f60:	8b 44 24 18          	mov    0x18(%esp),%eax
+f0107f64:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+f0107f68:	83 c4 20             	add    $0x20,%esp
+f0107f6b:	5b                   	pop    %ebx
+f0107f6c:	5e                   	pop    %esi
+f0107f6d:	5f                   	pop    %edi
+f0107f6e:	c3                   	ret
+f0107f6f:	90                   	nop
+
+f0107f70 <__umoddi3>:
+f0107f70:	57                   	push   %edi
+f0107f71:	56                   	push   %esi
+f0107f72:	53                   	push   %ebx
+f0107f73:	83 ec 18             	sub    $0x18,%esp
+f0107f76:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+f0107f7a:	8b 44 24 28          	mov    0x28(%esp),%eax
+f0107f7e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+f0107f82:	8b 54 24 34          	mov    0x34(%esp),%edx
+f0107f86:	89 44 24 08          	mov    %eax,0x8(%esp)
+f0107f8a:	8b 44 24 30          	mov    0x30(%esp),%eax
+f0107f8e:	89 d1                	mov    %edx,%ecx
+f0107f90:	89 54 24 14          	mov    %edx,0x14(%esp)
+f0107f94:	09 c1                	or     %eax,%ecx
+f0107f96:	89 44 24 10          	mov    %eax,0x10(%esp)
+f0107f9a:	74 5b                	je     f0107ff7 <__umoddi3+0x87>
+f0107f9c:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+f0107fa1:	31 c0                	xor    %eax,%eax
+f0107fa3:	31 d2                	xor    %edx,%edx
+f0107fa5:	8d 76 00             	lea    0x0(%esi),%esi
+f0107fa8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+f0107fac:	01 c0                	add    %eax,%eax
+f0107fae:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+f0107fb5:	00 
+f0107fb6:	89 c6                	mov    %eax,%esi
+f0107fb8:	89 d7                	mov    %edx,%edi
+f0107fba:	8b 44 24 08          	mov    0x8(%esp),%eax
+f0107fbe:	8b 54 24 0c          	mov    0xc(%esp),%edx
+f0107fc2:	0f ad d0             	shrd   %cl,%edx,%eax
+f0107fc5:	d3 ea                	shr    %cl,%edx
+f0107fc7:	f6 c1 20             	test   $0x20,%cl
+f0107fca:	0f 45 c2             	cmovne %edx,%eax
+f0107fcd:	8b 54 24 04          	mov    0x4(%esp),%edx
+f0107fd1:	83 e0 01             	and    $0x1,%eax
+f0107fd4:	09 fa                	or     %edi,%edx
+f0107fd6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+f0107fda:	89 04 24             	mov    %eax,(%esp)
+f0107fdd:	8b 04 24             	mov    (%esp),%eax
+f0107fe0:	89 d3                	mov    %edx,%ebx
+f0107fe2:	09 f0                	or     %esi,%eax
+f0107fe4:	8b 74 24 10          	mov    0x10(%esp),%esi
+f0107fe8:	39 f0                	cmp    %esi,%eax
+f0107fea:	19 fb                	sbb    %edi,%ebx
+f0107fec:	72 04                	jb     f0107ff2 <__umoddi3+0x82>
+f0107fee:	29 f0                	sub    %esi,%eax
+f0107ff0:	19 fa                	sbb    %edi,%edx
+f0107ff2:	83 e9 01             	sub    $0x1,%ecx
+f0107ff5:	73 b1                	jae    f0107fa8 <__umoddi3+0x38>
+f0107ff7:	83 c4 18             	add    $0x18,%esp
+f0107ffa:	5b                   	pop    %ebx
+f0107ffb:	5e                   	pop    %esi
+f0107ffc:	5f                   	pop    %edi
+f0107ffd:	c3                   	ret
+f0107ffe:	66 90                	xchg   %ax,%ax
+
+f0108000 <__divdi3>:
+f0108000:	55                   	push   %ebp
+f0108001:	57                   	push   %edi
+f0108002:	56                   	push   %esi
+f0108003:	53                   	push   %ebx
+f0108004:	83 ec 24             	sub    $0x24,%esp
+f0108007:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+f010800b:	8b 74 24 44          	mov    0x44(%esp),%esi
+f010800f:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+f0108013:	8b 44 24 38          	mov    0x38(%esp),%eax
+f0108017:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+f010801b:	89 74 24 0c          	mov    %esi,0xc(%esp)
+f010801f:	85 d2                	test   %edx,%edx
+f0108021:	0f 88 e0 00 00 00    	js     f0108107 <__divdi3+0x107>
+f0108027:	8b 74 24 0c          	mov    0xc(%esp),%esi
+f010802b:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+f010802f:	89 44 24 10          	mov    %eax,0x10(%esp)
+f0108033:	89 54 24 14          	mov    %edx,0x14(%esp)
+f0108037:	85 f6                	test   %esi,%esi
+f0108039:	78 16                	js     f0108051 <__divdi3+0x51>
+f010803b:	89 f1                	mov    %esi,%ecx
+f010803d:	31 c0                	xor    %eax,%eax
+f010803f:	31 d2                	xor    %edx,%edx
+f0108041:	09 d9                	or     %ebx,%ecx
+f0108043:	0f 85 f3 00 00 00    	jne    f010813c <__divdi3+0x13c>
+f0108049:	83 c4 24             	add    $0x24,%esp
+f010804c:	5b                   	pop    %ebx
+f010804d:	5e                   	pop    %esi
+f010804e:	5f                   	pop    %edi
+f010804f:	5d                   	pop    %ebp
+f0108050:	c3                   	ret
+f0108051:	bf 01 00 00 00       	mov    $0x1,%edi
+f0108056:	f7 5c 24 08          	negl   0x8(%esp)
+f010805a:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+f010805f:	f7 5c 24 0c          	negl   0xc(%esp)
+f0108063:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+f010806a:	00 
+f010806b:	31 c0                	xor    %eax,%eax
+f010806d:	31 d2                	xor    %edx,%edx
+f010806f:	89 fb                	mov    %edi,%ebx
+f0108071:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+f0108078:	00 
+f0108079:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+f010807e:	66 90                	xchg   %ax,%ax
+f0108080:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+f0108084:	01 c0                	add    %eax,%eax
+f0108086:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+f010808d:	00 
+f010808e:	89 c6                	mov    %eax,%esi
+f0108090:	89 d7                	mov    %edx,%edi
+f0108092:	8b 44 24 10          	mov    0x10(%esp),%eax
+f0108096:	8b 54 24 14          	mov    0x14(%esp),%edx
+f010809a:	0f ad d0             	shrd   %cl,%edx,%eax
+f010809d:	d3 ea                	shr    %cl,%edx
+f010809f:	f6 c1 20             	test   $0x20,%cl
+f01080a2:	0f 45 c2             	cmovne %edx,%eax
+f01080a5:	8b 54 24 04          	mov    0x4(%esp),%edx
+f01080a9:	83 e0 01             	and    $0x1,%eax
+f01080ac:	09 fa                	or     %edi,%edx
+f01080ae:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+f01080b2:	89 04 24             	mov    %eax,(%esp)
+f01080b5:	8b 04 24             	mov    (%esp),%eax
+f01080b8:	89 d5                	mov    %edx,%ebp
+f01080ba:	09 f0                	or     %esi,%eax
+f01080bc:	8b 74 24 08          	mov    0x8(%esp),%esi
+f01080c0:	39 f0                	cmp    %esi,%eax
+f01080c2:	19 fd                	sbb    %edi,%ebp
+f01080c4:	72 1d                	jb     f01080e3 <__divdi3+0xe3>
+f01080c6:	29 f0                	sub    %esi,%eax
+f01080c8:	19 fa                	sbb    %edi,%edx
+f01080ca:	89 cf                	mov    %ecx,%edi
+f01080cc:	c1 ef 05             	shr    $0x5,%edi
+f01080cf:	83 e7 01             	and    $0x1,%edi
+f01080d2:	89 fe                	mov    %edi,%esi
+f01080d4:	d3 e7                	shl    %cl,%edi
+f01080d6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+f01080da:	83 f6 01             	xor    $0x1,%esi
+f01080dd:	d3 e6                	shl    %cl,%esi
+f01080df:	09 74 24 18          	or     %esi,0x18(%esp)
+f01080e3:	83 e9 01             	sub    $0x1,%ecx
+f01080e6:	73 98                	jae    f0108080 <__divdi3+0x80>
+f01080e8:	8b 44 24 18          	mov    0x18(%esp),%eax
+f01080ec:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+f01080f0:	85 db                	test   %ebx,%ebx
+f01080f2:	0f 84 51 ff ff ff    	je     f0108049 <__divdi3+0x49>
+f01080f8:	f7 d8                	neg    %eax
+f01080fa:	83 d2 00             	adc    $0x0,%edx
+f01080fd:	83 c4 24             	add    $0x24,%esp
+f0108100:	5b                   	pop    %ebx
+f0108101:	f7 da                	neg    %edx
+f0108103:	5e                   	pop    %esi
+f0108104:	5f                   	pop    %edi
+f0108105:	5d                   	pop    %ebp
+f0108106:	c3                   	ret
+f0108107:	f7 d8                	neg    %eax
+f0108109:	83 d2 00             	adc    $0x0,%edx
+f010810c:	89 44 24 10          	mov    %eax,0x10(%esp)
+f0108110:	f7 da                	neg    %edx
+f0108112:	89 54 24 14          	mov    %edx,0x14(%esp)
+f0108116:	85 f6                	test   %esi,%esi
+f0108118:	78 1b                	js     f0108135 <__divdi3+0x135>
+f010811a:	89 f1                	mov    %esi,%ecx
+f010811c:	31 c0                	xor    %eax,%eax
+f010811e:	31 d2                	xor    %edx,%edx
+f0108120:	bf 01 00 00 00       	mov    $0x1,%edi
+f0108125:	09 d9                	or     %ebx,%ecx
+f0108127:	0f 85 36 ff ff ff    	jne    f0108063 <__divdi3+0x63>
+f010812d:	83 c4 24             	add    $0x24,%esp
+f0108130:	5b                   	pop    %ebx
+f0108131:	5e                   	pop    %esi
+f0108132:	5f                   	pop    %edi
+f0108133:	5d                   	pop    %ebp
+f0108134:	c3                   	ret
+f0108135:	31 ff                	xor    %edi,%edi
+f0108137:	e9 1a ff ff ff       	jmp    f0108056 <__divdi3+0x56>
+f010813c:	31 ff                	xor    %edi,%edi
+f010813e:	e9 20 ff ff ff       	jmp    f0108063 <__divdi3+0x63>
+f0108143:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+f010814a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+f0108150 <__moddi3>:
+f0108150:	55                   	push   %ebp
+f0108151:	57                   	push   %edi
+f0108152:	56                   	push   %esi
+f0108153:	53                   	push   %ebx
+f0108154:	83 ec 1c             	sub    $0x1c,%esp
+f0108157:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+f010815b:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+f010815f:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+f0108163:	8b 7c 24 30          	mov    0x30(%esp),%edi
+f0108167:	89 c8                	mov    %ecx,%eax
+f0108169:	89 f2                	mov    %esi,%edx
+f010816b:	89 f3                	mov    %esi,%ebx
+f010816d:	85 ed                	test   %ebp,%ebp
+f010816f:	0f 88 9d 00 00 00    	js     f0108212 <__moddi3+0xc2>
+f0108175:	09 cb                	or     %ecx,%ebx
+f0108177:	0f 84 8d 00 00 00    	je     f010820a <__moddi3+0xba>
+f010817d:	89 7c 24 10          	mov    %edi,0x10(%esp)
+f0108181:	31 db                	xor    %ebx,%ebx
+f0108183:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+f0108187:	89 ca                	mov    %ecx,%edx
+f0108189:	89 f0                	mov    %esi,%eax
+f010818b:	89 dd                	mov    %ebx,%ebp
+f010818d:	f7 da                	neg    %edx
+f010818f:	83 d0 00             	adc    $0x0,%eax
+f0108192:	f7 d8                	neg    %eax
+f0108194:	0f 49 f0             	cmovns %eax,%esi
+f0108197:	0f 49 ca             	cmovns %edx,%ecx
+f010819a:	31 c0                	xor    %eax,%eax
+f010819c:	31 d2                	xor    %edx,%edx
+f010819e:	89 74 24 0c          	mov    %esi,0xc(%esp)
+f01081a2:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+f01081a6:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+f01081ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+f01081af:	90                   	nop
+f01081b0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+f01081b4:	01 c0                	add    %eax,%eax
+f01081b6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+f01081bd:	00 
+f01081be:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+f01081c2:	89 c6                	mov    %eax,%esi
+f01081c4:	89 d7                	mov    %edx,%edi
+f01081c6:	8b 44 24 10          	mov    0x10(%esp),%eax
+f01081ca:	8b 54 24 14          	mov    0x14(%esp),%edx
+f01081ce:	0f ad d0             	shrd   %cl,%edx,%eax
+f01081d1:	d3 ea                	shr    %cl,%edx
+f01081d3:	f6 c1 20             	test   $0x20,%cl
+f01081d6:	0f 45 c2             	cmovne %edx,%eax
+f01081d9:	8b 54 24 04          	mov    0x4(%esp),%edx
+f01081dd:	83 e0 01             	and    $0x1,%eax
+f01081e0:	09 fa                	or     %edi,%edx
+f01081e2:	89 04 24             	mov    %eax,(%esp)
+f01081e5:	8b 04 24             	mov    (%esp),%eax
+f01081e8:	89 d7                	mov    %edx,%edi
+f01081ea:	09 f0                	or     %esi,%eax
+f01081ec:	8b 74 24 0c          	mov    0xc(%esp),%esi
+f01081f0:	39 d8                	cmp    %ebx,%eax
+f01081f2:	19 f7                	sbb    %esi,%edi
+f01081f4:	72 04                	jb     f01081fa <__moddi3+0xaa>
+f01081f6:	29 d8                	sub    %ebx,%eax
+f01081f8:	19 f2                	sbb    %esi,%edx
+f01081fa:	83 e9 01             	sub    $0x1,%ecx
+f01081fd:	73 b1                	jae    f01081b0 <__moddi3+0x60>
+f01081ff:	85 ed                	test   %ebp,%ebp
+f0108201:	74 07                	je     f010820a <__moddi3+0xba>
+f0108203:	f7 d8                	neg    %eax
+f0108205:	83 d2 00             	adc    $0x0,%edx
+f0108208:	f7 da                	neg    %edx
+f010820a:	83 c4 1c             	add    $0x1c,%esp
+f010820d:	5b                   	pop    %ebx
+f010820e:	5e                   	pop    %esi
+f010820f:	5f                   	pop    %edi
+f0108210:	5d                   	pop    %ebp
+f0108211:	c3                   	ret
+f0108212:	09 cb                	or     %ecx,%ebx
+f0108214:	74 f4                	je     f010820a <__moddi3+0xba>
+f0108216:	f7 df                	neg    %edi
+f0108218:	bb 01 00 00 00       	mov    $0x1,%ebx
+f010821d:	83 d5 00             	adc    $0x0,%ebp
+f0108220:	89 7c 24 10          	mov    %edi,0x10(%esp)
+f0108224:	f7 dd                	neg    %ebp
+f0108226:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+f010822a:	e9 58 ff ff ff       	jmp    f0108187 <__moddi3+0x37>
+
+Disassembly of section .user_mapped:
+
+f010b000 <env_pop_tf>:
+env_pop_tf(struct Trapframe *tf) {
+f010b000:	55                   	push   %ebp
+f010b001:	89 e5                	mov    %esp,%ebp
+f010b003:	83 ec 0c             	sub    $0xc,%esp
+    asm volatile(
+f010b006:	8b 65 08             	mov    0x8(%ebp),%esp
+f010b009:	61                   	popa
+f010b00a:	07                   	pop    %es
+f010b00b:	1f                   	pop    %ds
+f010b00c:	83 c4 08             	add    $0x8,%esp
+f010b00f:	cf                   	iret
+    panic("iret failed");  /* mostly to placate the compiler */
+f010b010:	68 2b 96 10 f0       	push   $0xf010962b
+f010b015:	68 ce 02 00 00       	push   $0x2ce
+f010b01a:	68 37 96 10 f0       	push   $0xf0109637
+f010b01f:	e8 2e 50 ff ff       	call   f0100052 <_panic>
+
+f010b024 <kpti_run>:
+kpti_run(struct Env *e) {
+f010b024:	55                   	push   %ebp
+f010b025:	89 e5                	mov    %esp,%ebp
+f010b027:	83 ec 08             	sub    $0x8,%esp
+f010b02a:	65 8b 0d 00 00 00 00 	mov    %gs:0x0,%ecx
+f010b031:	65 8b 15 00 00 00 00 	mov    %gs:0x0,%edx
+    curenv->env_cpunum = thiscpu->cpu_id;
+f010b038:	8b 52 0c             	mov    0xc(%edx),%edx
+f010b03b:	0f b6 49 04          	movzbl 0x4(%ecx),%ecx
+f010b03f:	89 4a 5c             	mov    %ecx,0x5c(%edx)
+    lcr3(PADDR(e->env_pgdir));
+f010b042:	8b 50 70             	mov    0x70(%eax),%edx
+	if ((uint32_t)kva < KERNBASE)
+f010b045:	81 fa ff ff ff ef    	cmp    $0xefffffff,%edx
+f010b04b:	76 12                	jbe    f010b05f <kpti_run+0x3b>
+	return (physaddr_t)kva - KERNBASE;
+f010b04d:	81 c2 00 00 00 10    	add    $0x10000000,%edx
+	asm volatile("movl %0,%%cr3" : : "r" (val));
+f010b053:	0f 22 da             	mov    %edx,%cr3
+    env_pop_tf(&e->env_tf);
+f010b056:	83 ec 0c             	sub    $0xc,%esp
+f010b059:	50                   	push   %eax
+f010b05a:	e8 a1 ff ff ff       	call   f010b000 <env_pop_tf>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f010b05f:	52                   	push   %edx
+f010b060:	68 88 82 10 f0       	push   $0xf0108288
+f010b065:	68 d7 02 00 00       	push   $0x2d7
+f010b06a:	68 37 96 10 f0       	push   $0xf0109637
+f010b06f:	e8 de 4f ff ff       	call   f0100052 <_panic>
+
+f010b074 <switch_and_trap>:
+
+__user_mapped_text void
+switch_and_trap(struct Trapframe *frame) {
+f010b074:	55                   	push   %ebp
+f010b075:	89 e5                	mov    %esp,%ebp
+f010b077:	83 ec 08             	sub    $0x8,%esp
+f010b07a:	8b 55 08             	mov    0x8(%ebp),%edx
+  // LAB7: Your code here
+  if ((frame->tf_cs & 3) == 3) {
+f010b07d:	0f b7 42 34          	movzwl 0x34(%edx),%eax
+f010b081:	83 e0 03             	and    $0x3,%eax
+f010b084:	66 83 f8 03          	cmp    $0x3,%ax
+f010b088:	75 33                	jne    f010b0bd <switch_and_trap+0x49>
+
+    // Calculate the current CPU core number
+    int cpunum = (KERNBASE - (uintptr_t) (frame - 1)) / (KSTKSIZE + KSTKGAP);
+f010b08a:	b8 44 00 00 f0       	mov    $0xf0000044,%eax
+f010b08f:	29 d0                	sub    %edx,%eax
+f010b091:	c1 e8 10             	shr    $0x10,%eax
+    struct Env *e = cpus[cpunum].cpu_env;
+f010b094:	69 c8 84 00 00 00    	imul   $0x84,%eax,%ecx
+
+    // Load the physical address of kernel page table
+    // Switch to the kernel page table
+    lcr3(PADDR(e->env_kern_pgdir));
+f010b09a:	8b 89 0c 49 11 f0    	mov    -0xfeeb6f4(%ecx),%ecx
+f010b0a0:	8b 49 74             	mov    0x74(%ecx),%ecx
+	if ((uint32_t)kva < KERNBASE)
+f010b0a3:	81 f9 ff ff ff ef    	cmp    $0xefffffff,%ecx
+f010b0a9:	76 1b                	jbe    f010b0c6 <switch_and_trap+0x52>
+	return (physaddr_t)kva - KERNBASE;
+f010b0ab:	81 c1 00 00 00 10    	add    $0x10000000,%ecx
+f010b0b1:	0f 22 d9             	mov    %ecx,%cr3
+
+    // iret to user mode nulled GS; point it back at our CpuInfo
+    asm volatile("movw %%ax,%%gs" : : "a" (GD_CPU0 + (cpunum << 3)));
+f010b0b4:	8d 04 c5 68 00 00 00 	lea    0x68(,%eax,8),%eax
+f010b0bb:	8e e8                	mov    %eax,%gs
+  }
+  trap(frame);
+f010b0bd:	83 ec 0c             	sub    $0xc,%esp
+f010b0c0:	52                   	push   %edx
+f010b0c1:	e8 3c 9d ff ff       	call   f0104e02 <trap>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f010b0c6:	51                   	push   %ecx
+f010b0c7:	68 88 82 10 f0       	push   $0xf0108288
+f010b0cc:	68 df 01 00 00       	push   $0x1df
+f010b0d1:	68 fe 98 10 f0       	push   $0xf01098fe
+f010b0d6:	e8 77 4f ff ff       	call   f0100052 <_panic>
+f010b0db:	90                   	nop
+
+f010b0dc <t_divide_handler>:
+f010b0dc:	6a 00                	push   $0x0
+f010b0de:	6a 00                	push   $0x0
+f010b0e0:	e9 ef 00 00 00       	jmp    f010b1d4 <_alltraps>
+	...
+
+f010b0e6 <t_debug_handler>:
+f010b0e6:	6a 00                	push   $0x0
+f010b0e8:	6a 01                	push   $0x1
+f010b0ea:	e9 e5 00 00 00       	jmp    f010b1d4 <_alltraps>
+	...
+
+f010b0f0 <t_nmi_handler>:
+f010b0f0:	6a 00                	push   $0x0
+f010b0f2:	6a 02                	push   $0x2
+f010b0f4:	e9 db 00 00 00       	jmp    f010b1d4 <_alltraps>
+	...
+
+f010b0fa <t_brkpt_handler>:
+f010b0fa:	6a 00                	push   $0x0
+f010b0fc:	6a 03                	push   $0x3
+f010b0fe:	e9 d1 00 00 00       	jmp    f010b1d4 <_alltraps>
+	...
+
+f010b104 <t_oflow_handler>:
+f010b104:	6a 00                	push   $0x0
+f010b106:	6a 04                	push   $0x4
+f010b108:	e9 c7 00 00 00       	jmp    f010b1d4 <_alltraps>
+	...
+
+f010b10e <t_bound_handler>:
+f010b10e:	6a 00                	push   $0x0
+f010b110:	6a 05                	push   $0x5
+f010b112:	e9 bd 00 00 00       	jmp    f010b1d4 <_alltraps>
+	...
+
+f010b118 <t_illop_handler>:
+f010b118:	6a 00                	push   $0x0
+f010b11a:	6a 06                	push   $0x6
+f010b11c:	e9 b3 00 00 00       	jmp    f010b1d4 <_alltraps>
+	...
+
+f010b122 <t_device_handler>:
+f010b122:	6a 00                	push   $0x0
+f010b124:	6a 07                	push   $0x7
+f010b126:	e9 a9 00 00 00       	jmp    f010b1d4 <_alltraps>
+	...
+
+f010b12c <t_dblflt_handler>:
+f010b12c:	6a 08                	push   $0x8
+f010b12e:	e9 a1 00 00 00       	jmp    f010b1d4 <_alltraps>
+	...
+
+f010b134 <t_tss_handler>:
+f010b134:	6a 0a                	push   $0xa
+f010b136:	e9 99 00 00 00       	jmp    f010b1d4 <_alltraps>
+	...
+
+f010b13c <t_segnp_handler>:
+f010b13c:	6a 0b                	push   $0xb
+f010b13e:	e9 91 00 00 00       	jmp    f010b1d4 <_alltraps>
+	...
+
+f010b144 <t_stack_handler>:
+f010b144:	6a 0c                	push   $0xc
+f010b146:	e9 89 00 00 00       	jmp    f010b1d4 <_alltraps>
+	...
+
+f010b14c <t_gpflt_handler>:
+f010b14c:	6a 0d                	push   $0xd
+f010b14e:	e9 81 00 00 00       	jmp    f010b1d4 <_alltraps>
+	...
+
+f010b154 <t_pgflt_handler>:
+f010b154:	6a 0e                	push   $0xe
+f010b156:	eb 7c                	jmp    f010b1d4 <_alltraps>
+
+f010b158 <t_fperr_handler>:
+f010b158:	6a 00                	push   $0x0
+f010b15a:	6a 10                	push   $0x10
+f010b15c:	eb 76                	jmp    f010b1d4 <_alltraps>
+
+f010b15e <t_align_handler>:
+f010b15e:	6a 11                	push   $0x11
+f010b160:	eb 72                	jmp    f010b1d4 <_alltraps>
+
+f010b162 <t_mchk_handler>:
+f010b162:	6a 00                	push   $0x0
+f010b164:	6a 12                	push   $0x12
+f010b166:	eb 6c                	jmp    f010b1d4 <_alltraps>
+
+f010b168 <t_simderr_handler>:
+f010b168:	6a 00                	push   $0x0
+f010b16a:	6a 13                	push   $0x13
+f010b16c:	eb 66                	jmp    f010b1d4 <_alltraps>
+
+f010b16e <t_syscall_handler>:
+f010b16e:	6a 00                	push   $0x0
+f010b170:	6a 30                	push   $0x30
+f010b172:	eb 60                	jmp    f010b1d4 <_alltraps>
+
+f010b174 <irq_timer_handler>:
+f010b174:	6a 00                	push   $0x0
+f010b176:	6a 20                	push   $0x20
+f010b178:	eb 5a                	jmp    f010b1d4 <_alltraps>
+
+f010b17a <irq_kbd_handler>:
+f010b17a:	6a 00                	push   $0x0
+f010b17c:	6a 21                	push   $0x21
+f010b17e:	eb 54                	jmp    f010b1d4 <_alltraps>
+
+f010b180 <irq_2_handler>:
+f010b180:	6a 00                	push   $0x0
+f010b182:	6a 22                	push   $0x22
+f010b184:	eb 4e                	jmp    f010b1d4 <_alltraps>
+
+f010b186 <irq_3_handler>:
+f010b186:	6a 00                	push   $0x0
+f010b188:	6a 23                	push   $0x23
+f010b18a:	eb 48                	jmp    f010b1d4 <_alltraps>
+
+f010b18c <irq_serial_handler>:
+f010b18c:	6a 00                	push   $0x0
+f010b18e:	6a 24                	push   $0x24
+f010b190:	eb 42                	jmp    f010b1d4 <_alltraps>
+
+f010b192 <irq_5_handler>:
+f010b192:	6a 00                	push   $0x0
+f010b194:	6a 25                	push   $0x25
+f010b196:	eb 3c                	jmp    f010b1d4 <_alltraps>
+
+f010b198 <irq_6_handler>:
+f010b198:	6a 00                	push   $0x0
+f010b19a:	6a 26                	push   $0x26
+f010b19c:	eb 36                	jmp    f010b1d4 <_alltraps>
+
+f010b19e <irq_spurious_handler>:
+f010b19e:	6a 00                	push   $0x0
+f010b1a0:	6a 27                	push   $0x27
+f010b1a2:	eb 30                	jmp    f010b1d4 <_alltraps>
+
+f010b1a4 <irq_8_handler>:
+f010b1a4:	6a 00                	push   $0x0
+f010b1a6:	6a 28                	push   $0x28
+f010b1a8:	eb 2a                	jmp    f010b1d4 <_alltraps>
+
+f010b1aa <irq_9_handler>:
+f010b1aa:	6a 00                	push   $0x0
+f010b1ac:	6a 29                	push   $0x29
+f010b1ae:	eb 24                	jmp    f010b1d4 <_alltraps>
+
+f010b1b0 <irq_10_handler>:
+f010b1b0:	6a 00                	push   $0x0
+f010b1b2:	6a 2a                	push   $0x2a
+f010b1b4:	eb 1e                	jmp    f010b1d4 <_alltraps>
+
+f010b1b6 <irq_11_handler>:
+f010b1b6:	6a 00                	push   $0x0
+f010b1b8:	6a 2b                	push   $0x2b
+f010b1ba:	eb 18                	jmp    f010b1d4 <_alltraps>
+
+f010b1bc <irq_12_handler>:
+f010b1bc:	6a 00                	push   $0x0
+f010b1be:	6a 2c                	push   $0x2c
+f010b1c0:	eb 12                	jmp    f010b1d4 <_alltraps>
+
+f010b1c2 <irq_13_handler>:
+f010b1c2:	6a 00                	push   $0x0
+f010b1c4:	6a 2d                	push   $0x2d
+f010b1c6:	eb 0c                	jmp    f010b1d4 <_alltraps>
+
+f010b1c8 <irq_ide_handler>:
+f010b1c8:	6a 00                	push   $0x0
+f010b1ca:	6a 2e                	push   $0x2e
+f010b1cc:	eb 06                	jmp    f010b1d4 <_alltraps>
+
+f010b1ce <irq_15_handler>:
+f010b1ce:	6a 00                	push   $0x0
+f010b1d0:	6a 2f                	push   $0x2f
+f010b1d2:	eb 00                	jmp    f010b1d4 <_alltraps>
+
+f010b1d4 <_alltraps>:
+f010b1d4:	1e                   	push   %ds
+f010b1d5:	06                   	push   %es
+f010b1d6:	60                   	pusha
+f010b1d7:	b8 10 00 00 00       	mov    $0x10,%eax
+f010b1dc:	8e d8                	mov    %eax,%ds
+f010b1de:	8e c0                	mov    %eax,%es
+f010b1e0:	54                   	push   %esp
+f010b1e1:	e8 8e fe ff ff       	call   f010b074 <switch_and_trap>
+f010b1e6:	66 90                	xchg   %ax,%ax
+f010b1e8:	66 90                	xchg   %ax,%ax
+f010b1ea:	66 90                	xchg   %ax,%ax
+f010b1ec:	66 90                	xchg   %ax,%ax
+f010b1ee:	66 90                	xchg   %ax,%ax
+f010b1f0:	66 90                	xchg   %ax,%ax
+f010b1f2:	66 90                	xchg   %ax,%ax
+f010b1f4:	66 90                	xchg   %ax,%ax
+f010b1f6:	66 90                	xchg   %ax,%ax
+f010b1f8:	66 90                	xchg   %ax,%ax
+f010b1fa:	66 90                	xchg   %ax,%ax
+f010b1fc:	66 90                	xchg   %ax,%ax
+f010b1fe:	66 90                	xchg   %ax,%ax
+f010b200:	66 90                	xchg   %ax,%ax
+f010b202:	66 90                	xchg   %ax,%ax
+f010b204:	66 90                	xchg   %ax,%ax
+f010b206:	66 90                	xchg   %ax,%ax
+f010b208:	66 90                	xchg   %ax,%ax
+f010b20a:	66 90                	xchg   %ax,%ax
+f010b20c:	66 90                	xchg   %ax,%ax
+f010b20e:	66 90                	xchg   %ax,%ax
+f010b210:	66 90                	xchg   %ax,%ax
+f010b212:	66 90                	xchg   %ax,%ax
+f010b214:	66 90                	xchg   %ax,%ax
+f010b216:	66 90                	xchg   %ax,%ax
+f010b218:	66 90                	xchg   %ax,%ax
+f010b21a:	66 90                	xchg   %ax,%ax
+f010b21c:	66 90                	xchg   %ax,%ax
+f010b21e:	66 90                	xchg   %ax,%ax
+f010b220:	66 90                	xchg   %ax,%ax
+f010b222:	66 90                	xchg   %ax,%ax
+f010b224:	66 90                	xchg   %ax,%ax
+f010b226:	66 90                	xchg   %ax,%ax
+f010b228:	66 90                	xchg   %ax,%ax
+f010b22a:	66 90                	xchg   %ax,%ax
+f010b22c:	66 90                	xchg   %ax,%ax
+f010b22e:	66 90                	xchg   %ax,%ax
+f010b230:	66 90                	xchg   %ax,%ax
+f010b232:	66 90                	xchg   %ax,%ax
+f010b234:	66 90                	xchg   %ax,%ax
+f010b236:	66 90                	xchg   %ax,%ax
+f010b238:	66 90                	xchg   %ax,%ax
+f010b23a:	66 90                	xchg   %ax,%ax
+f010b23c:	66 90                	xchg   %ax,%ax
+f010b23e:	66 90                	xchg   %ax,%ax
+f010b240:	66 90                	xchg   %ax,%ax
+f010b242:	66 90                	xchg   %ax,%ax
+f010b244:	66 90                	xchg   %ax,%ax
+f010b246:	66 90                	xchg   %ax,%ax
+f010b248:	66 90                	xchg   %ax,%ax
+f010b24a:	66 90                	xchg   %ax,%ax
+f010b24c:	66 90                	xchg   %ax,%ax
+f010b24e:	66 90                	xchg   %ax,%ax
+f010b250:	66 90                	xchg   %ax,%ax
+f010b252:	66 90                	xchg   %ax,%ax
+f010b254:	66 90                	xchg   %ax,%ax
+f010b256:	66 90                	xchg   %ax,%ax
+f010b258:	66 90                	xchg   %ax,%ax
+f010b25a:	66 90                	xchg   %ax,%ax
+f010b25c:	66 90                	xchg   %ax,%ax
+f010b25e:	66 90                	xchg   %ax,%ax
+f010b260:	66 90                	xchg   %ax,%ax
+f010b262:	66 90                	xchg   %ax,%ax
+f010b264:	66 90                	xchg   %ax,%ax
+f010b266:	66 90                	xchg   %ax,%ax
+f010b268:	66 90                	xchg   %ax,%ax
+f010b26a:	66 90                	xchg   %ax,%ax
+f010b26c:	66 90                	xchg   %ax,%ax
+f010b26e:	66 90                	xchg   %ax,%ax
+f010b270:	66 90                	xchg   %ax,%ax
+f010b272:	66 90                	xchg   %ax,%ax
+f010b274:	66 90                	xchg   %ax,%ax
+f010b276:	66 90                	xchg   %ax,%ax
+f010b278:	66 90                	xchg   %ax,%ax
+f010b27a:	66 90                	xchg   %ax,%ax
+f010b27c:	66 90                	xchg   %ax,%ax
+f010b27e:	66 90                	xchg   %ax,%ax
+f010b280:	66 90                	xchg   %ax,%ax
+f010b282:	66 90                	xchg   %ax,%ax
+f010b284:	66 90                	xchg   %ax,%ax
+f010b286:	66 90                	xchg   %ax,%ax
+f010b288:	66 90                	xchg   %ax,%ax
+f010b28a:	66 90                	xchg   %ax,%ax
+f010b28c:	66 90                	xchg   %ax,%ax
+f010b28e:	66 90                	xchg   %ax,%ax
+f010b290:	66 90                	xchg   %ax,%ax
+f010b292:	66 90                	xchg   %ax,%ax
+f010b294:	66 90                	xchg   %ax,%ax
+f010b296:	66 90                	xchg   %ax,%ax
+f010b298:	66 90                	xchg   %ax,%ax
+f010b29a:	66 90                	xchg   %ax,%ax
+f010b29c:	66 90                	xchg   %ax,%ax
+f010b29e:	66 90                	xchg   %ax,%ax
+f010b2a0:	66 90                	xchg   %ax,%ax
+f010b2a2:	66 90                	xchg   %ax,%ax
+f010b2a4:	66 90                	xchg   %ax,%ax
+f010b2a6:	66 90                	xchg   %ax,%ax
+f010b2a8:	66 90                	xchg   %ax,%ax
+f010b2aa:	66 90                	xchg   %ax,%ax
+f010b2ac:	66 90                	xchg   %ax,%ax
+f010b2ae:	66 90                	xchg   %ax,%ax
+f010b2b0:	66 90                	xchg   %ax,%ax
+f010b2b2:	66 90                	xchg   %ax,%ax
+f010b2b4:	66 90                	xchg   %ax,%ax
+f010b2b6:	66 90                	xchg   %ax,%ax
+f010b2b8:	66 90                	xchg   %ax,%ax
+f010b2ba:	66 90                	xchg   %ax,%ax
+f010b2bc:	66 90                	xchg   %ax,%ax
+f010b2be:	66 90                	xchg   %ax,%ax
+f010b2c0:	66 90                	xchg   %ax,%ax
+f010b2c2:	66 90                	xchg   %ax,%ax
+f010b2c4:	66 90                	xchg   %ax,%ax
+f010b2c6:	66 90                	xchg   %ax,%ax
+f010b2c8:	66 90                	xchg   %ax,%ax
+f010b2ca:	66 90                	xchg   %ax,%ax
+f010b2cc:	66 90                	xchg   %ax,%ax
+f010b2ce:	66 90                	xchg   %ax,%ax
+f010b2d0:	66 90                	xchg   %ax,%ax
+f010b2d2:	66 90                	xchg   %ax,%ax
+f010b2d4:	66 90                	xchg   %ax,%ax
+f010b2d6:	66 90                	xchg   %ax,%ax
+f010b2d8:	66 90                	xchg   %ax,%ax
+f010b2da:	66 90                	xchg   %ax,%ax
+f010b2dc:	66 90                	xchg   %ax,%ax
+f010b2de:	66 90                	xchg   %ax,%ax
+f010b2e0:	66 90                	xchg   %ax,%ax
+f010b2e2:	66 90                	xchg   %ax,%ax
+f010b2e4:	66 90                	xchg   %ax,%ax
+f010b2e6:	66 90                	xchg   %ax,%ax
+f010b2e8:	66 90                	xchg   %ax,%ax
+f010b2ea:	66 90                	xchg   %ax,%ax
+f010b2ec:	66 90                	xchg   %ax,%ax
+f010b2ee:	66 90                	xchg   %ax,%ax
+f010b2f0:	66 90                	xchg   %ax,%ax
+f010b2f2:	66 90                	xchg   %ax,%ax
+f010b2f4:	66 90                	xchg   %ax,%ax
+f010b2f6:	66 90                	xchg   %ax,%ax
+f010b2f8:	66 90                	xchg   %ax,%ax
+f010b2fa:	66 90                	xchg   %ax,%ax
+f010b2fc:	66 90                	xchg   %ax,%ax
+f010b2fe:	66 90                	xchg   %ax,%ax
+f010b300:	66 90                	xchg   %ax,%ax
+f010b302:	66 90                	xchg   %ax,%ax
+f010b304:	66 90                	xchg   %ax,%ax
+f010b306:	66 90                	xchg   %ax,%ax
+f010b308:	66 90                	xchg   %ax,%ax
+f010b30a:	66 90                	xchg   %ax,%ax
+f010b30c:	66 90                	xchg   %ax,%ax
+f010b30e:	66 90                	xchg   %ax,%ax
+f010b310:	66 90                	xchg   %ax,%ax
+f010b312:	66 90                	xchg   %ax,%ax
+f010b314:	66 90                	xchg   %ax,%ax
+f010b316:	66 90                	xchg   %ax,%ax
+f010b318:	66 90                	xchg   %ax,%ax
+f010b31a:	66 90                	xchg   %ax,%ax
+f010b31c:	66 90                	xchg   %ax,%ax
+f010b31e:	66 90                	xchg   %ax,%ax
+f010b320:	66 90                	xchg   %ax,%ax
+f010b322:	66 90                	xchg   %ax,%ax
+f010b324:	66 90                	xchg   %ax,%ax
+f010b326:	66 90                	xchg   %ax,%ax
+f010b328:	66 90                	xchg   %ax,%ax
+f010b32a:	66 90                	xchg   %ax,%ax
+f010b32c:	66 90                	xchg   %ax,%ax
+f010b32e:	66 90                	xchg   %ax,%ax
+f010b330:	66 90                	xchg   %ax,%ax
+f010b332:	66 90                	xchg   %ax,%ax
+f010b334:	66 90                	xchg   %ax,%ax
+f010b336:	66 90                	xchg   %ax,%ax
+f010b338:	66 90                	xchg   %ax,%ax
+f010b33a:	66 90                	xchg   %ax,%ax
+f010b33c:	66 90                	xchg   %ax,%ax
+f010b33e:	66 90                	xchg   %ax,%ax
+f010b340:	66 90                	xchg   %ax,%ax
+f010b342:	66 90                	xchg   %ax,%ax
+f010b344:	66 90                	xchg   %ax,%ax
+f010b346:	66 90                	xchg   %ax,%ax
+f010b348:	66 90                	xchg   %ax,%ax
+f010b34a:	66 90                	xchg   %ax,%ax
+f010b34c:	66 90                	xchg   %ax,%ax
+f010b34e:	66 90                	xchg   %ax,%ax
+f010b350:	66 90                	xchg   %ax,%ax
+f010b352:	66 90                	xchg   %ax,%ax
+f010b354:	66 90                	xchg   %ax,%ax
+f010b356:	66 90                	xchg   %ax,%ax
+f010b358:	66 90                	xchg   %ax,%ax
+f010b35a:	66 90                	xchg   %ax,%ax
+f010b35c:	66 90                	xchg   %ax,%ax
+f010b35e:	66 90                	xchg   %ax,%ax
+f010b360:	66 90                	xchg   %ax,%ax
+f010b362:	66 90                	xchg   %ax,%ax
+f010b364:	66 90                	xchg   %ax,%ax
+f010b366:	66 90                	xchg   %ax,%ax
+f010b368:	66 90                	xchg   %ax,%ax
+f010b36a:	66 90                	xchg   %ax,%ax
+f010b36c:	66 90                	xchg   %ax,%ax
+f010b36e:	66 90                	xchg   %ax,%ax
+f010b370:	66 90                	xchg   %ax,%ax
+f010b372:	66 90                	xchg   %ax,%ax
+f010b374:	66 90                	xchg   %ax,%ax
+f010b376:	66 90                	xchg   %ax,%ax
+f010b378:	66 90                	xchg   %ax,%ax
+f010b37a:	66 90                	xchg   %ax,%ax
+f010b37c:	66 90                	xchg   %ax,%ax
+f010b37e:	66 90                	xchg   %ax,%ax
+f010b380:	66 90                	xchg   %ax,%ax
+f010b382:	66 90                	xchg   %ax,%ax
+f010b384:	66 90                	xchg   %ax,%ax
+f010b386:	66 90                	xchg   %ax,%ax
+f010b388:	66 90                	xchg   %ax,%ax
+f010b38a:	66 90                	xchg   %ax,%ax
+f010b38c:	66 90                	xchg   %ax,%ax
+f010b38e:	66 90                	xchg   %ax,%ax
+f010b390:	66 90                	xchg   %ax,%ax
+f010b392:	66 90                	xchg   %ax,%ax
+f010b394:	66 90                	xchg   %ax,%ax
+f010b396:	66 90                	xchg   %ax,%ax
+f010b398:	66 90                	xchg   %ax,%ax
+f010b39a:	66 90                	xchg   %ax,%ax
+f010b39c:	66 90                	xchg   %ax,%ax
+f010b39e:	66 90                	xchg   %ax,%ax
+f010b3a0:	66 90                	xchg   %ax,%ax
+f010b3a2:	66 90                	xchg   %ax,%ax
+f010b3a4:	66 90                	xchg   %ax,%ax
+f010b3a6:	66 90                	xchg   %ax,%ax
+f010b3a8:	66 90                	xchg   %ax,%ax
+f010b3aa:	66 90                	xchg   %ax,%ax
+f010b3ac:	66 90                	xchg   %ax,%ax
+f010b3ae:	66 90                	xchg   %ax,%ax
+f010b3b0:	66 90                	xchg   %ax,%ax
+f010b3b2:	66 90                	xchg   %ax,%ax
+f010b3b4:	66 90                	xchg   %ax,%ax
+f010b3b6:	66 90                	xchg   %ax,%ax
+f010b3b8:	66 90                	xchg   %ax,%ax
+f010b3ba:	66 90                	xchg   %ax,%ax
+f010b3bc:	66 90                	xchg   %ax,%ax
+f010b3be:	66 90                	xchg   %ax,%ax
+f010b3c0:	66 90                	xchg   %ax,%ax
+f010b3c2:	66 90                	xchg   %ax,%ax
+f010b3c4:	66 90                	xchg   %ax,%ax
+f010b3c6:	66 90                	xchg   %ax,%ax
+f010b3c8:	66 90                	xchg   %ax,%ax
+f010b3ca:	66 90                	xchg   %ax,%ax
+f010b3cc:	66 90                	xchg   %ax,%ax
+f010b3ce:	66 90                	xchg   %ax,%ax
+f010b3d0:	66 90                	xchg   %ax,%ax
+f010b3d2:	66 90                	xchg   %ax,%ax
+f010b3d4:	66 90                	xchg   %ax,%ax
+f010b3d6:	66 90                	xchg   %ax,%ax
+f010b3d8:	66 90                	xchg   %ax,%ax
+f010b3da:	66 90                	xchg   %ax,%ax
+f010b3dc:	66 90                	xchg   %ax,%ax
+f010b3de:	66 90                	xchg   %ax,%ax
+f010b3e0:	66 90                	xchg   %ax,%ax
+f010b3e2:	66 90                	xchg   %ax,%ax
+f010b3e4:	66 90                	xchg   %ax,%ax
+f010b3e6:	66 90                	xchg   %ax,%ax
+f010b3e8:	66 90                	xchg   %ax,%ax
+f010b3ea:	66 90                	xchg   %ax,%ax
+f010b3ec:	66 90                	xchg   %ax,%ax
+f010b3ee:	66 90                	xchg   %ax,%ax
+f010b3f0:	66 90                	xchg   %ax,%ax
+f010b3f2:	66 90                	xchg   %ax,%ax
+f010b3f4:	66 90                	xchg   %ax,%ax
+f010b3f6:	66 90                	xchg   %ax,%ax
+f010b3f8:	66 90                	xchg   %ax,%ax
+f010b3fa:	66 90                	xchg   %ax,%ax
+f010b3fc:	66 90                	xchg   %ax,%ax
+f010b3fe:	66 90                	xchg   %ax,%ax
+f010b400:	66 90                	xchg   %ax,%ax
+f010b402:	66 90                	xchg   %ax,%ax
+f010b404:	66 90                	xchg   %ax,%ax
+f010b406:	66 90                	xchg   %ax,%ax
+f010b408:	66 90                	xchg   %ax,%ax
+f010b40a:	66 90                	xchg   %ax,%ax
+f010b40c:	66 90                	xchg   %ax,%ax
+f010b40e:	66 90                	xchg   %ax,%ax
+f010b410:	66 90                	xchg   %ax,%ax
+f010b412:	66 90                	xchg   %ax,%ax
+f010b414:	66 90                	xchg   %ax,%ax
+f010b416:	66 90                	xchg   %ax,%ax
+f010b418:	66 90                	xchg   %ax,%ax
+f010b41a:	66 90                	xchg   %ax,%ax
+f010b41c:	66 90                	xchg   %ax,%ax
+f010b41e:	66 90                	xchg   %ax,%ax
+f010b420:	66 90                	xchg   %ax,%ax
+f010b422:	66 90                	xchg   %ax,%ax
+f010b424:	66 90                	xchg   %ax,%ax
+f010b426:	66 90                	xchg   %ax,%ax
+f010b428:	66 90                	xchg   %ax,%ax
+f010b42a:	66 90                	xchg   %ax,%ax
+f010b42c:	66 90                	xchg   %ax,%ax
+f010b42e:	66 90                	xchg   %ax,%ax
+f010b430:	66 90                	xchg   %ax,%ax
+f010b432:	66 90                	xchg   %ax,%ax
+f010b434:	66 90                	xchg   %ax,%ax
+f010b436:	66 90                	xchg   %ax,%ax
+f010b438:	66 90                	xchg   %ax,%ax
+f010b43a:	66 90                	xchg   %ax,%ax
+f010b43c:	66 90                	xchg   %ax,%ax
+f010b43e:	66 90                	xchg   %ax,%ax
+f010b440:	66 90                	xchg   %ax,%ax
+f010b442:	66 90                	xchg   %ax,%ax
+f010b444:	66 90                	xchg   %ax,%ax
+f010b446:	66 90                	xchg   %ax,%ax
+f010b448:	66 90                	xchg   %ax,%ax
+f010b44a:	66 90                	xchg   %ax,%ax
+f010b44c:	66 90                	xchg   %ax,%ax
+f010b44e:	66 90                	xchg   %ax,%ax
+f010b450:	66 90                	xchg   %ax,%ax
+f010b452:	66 90                	xchg   %ax,%ax
+f010b454:	66 90                	xchg   %ax,%ax
+f010b456:	66 90                	xchg   %ax,%ax
+f010b458:	66 90                	xchg   %ax,%ax
+f010b45a:	66 90                	xchg   %ax,%ax
+f010b45c:	66 90                	xchg   %ax,%ax
+f010b45e:	66 90                	xchg   %ax,%ax
+f010b460:	66 90                	xchg   %ax,%ax
+f010b462:	66 90                	xchg   %ax,%ax
+f010b464:	66 90                	xchg   %ax,%ax
+f010b466:	66 90                	xchg   %ax,%ax
+f010b468:	66 90                	xchg   %ax,%ax
+f010b46a:	66 90                	xchg   %ax,%ax
+f010b46c:	66 90                	xchg   %ax,%ax
+f010b46e:	66 90                	xchg   %ax,%ax
+f010b470:	66 90                	xchg   %ax,%ax
+f010b472:	66 90                	xchg   %ax,%ax
+f010b474:	66 90                	xchg   %ax,%ax
+f010b476:	66 90                	xchg   %ax,%ax
+f010b478:	66 90                	xchg   %ax,%ax
+f010b47a:	66 90                	xchg   %ax,%ax
+f010b47c:	66 90                	xchg   %ax,%ax
+f010b47e:	66 90                	xchg   %ax,%ax
+f010b480:	66 90                	xchg   %ax,%ax
+f010b482:	66 90                	xchg   %ax,%ax
+f010b484:	66 90                	xchg   %ax,%ax
+f010b486:	66 90                	xchg   %ax,%ax
+f010b488:	66 90                	xchg   %ax,%ax
+f010b48a:	66 90                	xchg   %ax,%ax
+f010b48c:	66 90                	xchg   %ax,%ax
+f010b48e:	66 90                	xchg   %ax,%ax
+f010b490:	66 90                	xchg   %ax,%ax
+f010b492:	66 90                	xchg   %ax,%ax
+f010b494:	66 90                	xchg   %ax,%ax
+f010b496:	66 90                	xchg   %ax,%ax
+f010b498:	66 90                	xchg   %ax,%ax
+f010b49a:	66 90                	xchg   %ax,%ax
+f010b49c:	66 90                	xchg   %ax,%ax
+f010b49e:	66 90                	xchg   %ax,%ax
+f010b4a0:	66 90                	xchg   %ax,%ax
+f010b4a2:	66 90                	xchg   %ax,%ax
+f010b4a4:	66 90                	xchg   %ax,%ax
+f010b4a6:	66 90                	xchg   %ax,%ax
+f010b4a8:	66 90                	xchg   %ax,%ax
+f010b4aa:	66 90                	xchg   %ax,%ax
+f010b4ac:	66 90                	xchg   %ax,%ax
+f010b4ae:	66 90                	xchg   %ax,%ax
+f010b4b0:	66 90                	xchg   %ax,%ax
+f010b4b2:	66 90                	xchg   %ax,%ax
+f010b4b4:	66 90                	xchg   %ax,%ax
+f010b4b6:	66 90                	xchg   %ax,%ax
+f010b4b8:	66 90                	xchg   %ax,%ax
+f010b4ba:	66 90                	xchg   %ax,%ax
+f010b4bc:	66 90                	xchg   %ax,%ax
+f010b4be:	66 90                	xchg   %ax,%ax
+f010b4c0:	66 90                	xchg   %ax,%ax
+f010b4c2:	66 90                	xchg   %ax,%ax
+f010b4c4:	66 90                	xchg   %ax,%ax
+f010b4c6:	66 90                	xchg   %ax,%ax
+f010b4c8:	66 90                	xchg   %ax,%ax
+f010b4ca:	66 90                	xchg   %ax,%ax
+f010b4cc:	66 90                	xchg   %ax,%ax
+f010b4ce:	66 90                	xchg   %ax,%ax
+f010b4d0:	66 90                	xchg   %ax,%ax
+f010b4d2:	66 90                	xchg   %ax,%ax
+f010b4d4:	66 90                	xchg   %ax,%ax
+f010b4d6:	66 90                	xchg   %ax,%ax
+f010b4d8:	66 90                	xchg   %ax,%ax
+f010b4da:	66 90                	xchg   %ax,%ax
+f010b4dc:	66 90                	xchg   %ax,%ax
+f010b4de:	66 90                	xchg   %ax,%ax
+f010b4e0:	66 90                	xchg   %ax,%ax
+f010b4e2:	66 90                	xchg   %ax,%ax
+f010b4e4:	66 90                	xchg   %ax,%ax
+f010b4e6:	66 90                	xchg   %ax,%ax
+f010b4e8:	66 90                	xchg   %ax,%ax
+f010b4ea:	66 90                	xchg   %ax,%ax
+f010b4ec:	66 90                	xchg   %ax,%ax
+f010b4ee:	66 90                	xchg   %ax,%ax
+f010b4f0:	66 90                	xchg   %ax,%ax
+f010b4f2:	66 90                	xchg   %ax,%ax
+f010b4f4:	66 90                	xchg   %ax,%ax
+f010b4f6:	66 90                	xchg   %ax,%ax
+f010b4f8:	66 90                	xchg   %ax,%ax
+f010b4fa:	66 90                	xchg   %ax,%ax
+f010b4fc:	66 90                	xchg   %ax,%ax
+f010b4fe:	66 90                	xchg   %ax,%ax
+f010b500:	66 90                	xchg   %ax,%ax
+f010b502:	66 90                	xchg   %ax,%ax
+f010b504:	66 90                	xchg   %ax,%ax
+f010b506:	66 90                	xchg   %ax,%ax
+f010b508:	66 90                	xchg   %ax,%ax
+f010b50a:	66 90                	xchg   %ax,%ax
+f010b50c:	66 90                	xchg   %ax,%ax
+f010b50e:	66 90                	xchg   %ax,%ax
+f010b510:	66 90                	xchg   %ax,%ax
+f010b512:	66 90                	xchg   %ax,%ax
+f010b514:	66 90                	xchg   %ax,%ax
+f010b516:	66 90                	xchg   %ax,%ax
+f010b518:	66 90                	xchg   %ax,%ax
+f010b51a:	66 90                	xchg   %ax,%ax
+f010b51c:	66 90                	xchg   %ax,%ax
+f010b51e:	66 90                	xchg   %ax,%ax
+f010b520:	66 90                	xchg   %ax,%ax
+f010b522:	66 90                	xchg   %ax,%ax
+f010b524:	66 90                	xchg   %ax,%ax
+f010b526:	66 90                	xchg   %ax,%ax
+f010b528:	66 90                	xchg   %ax,%ax
+f010b52a:	66 90                	xchg   %ax,%ax
+f010b52c:	66 90                	xchg   %ax,%ax
+f010b52e:	66 90                	xchg   %ax,%ax
+f010b530:	66 90                	xchg   %ax,%ax
+f010b532:	66 90                	xchg   %ax,%ax
+f010b534:	66 90                	xchg   %ax,%ax
+f010b536:	66 90                	xchg   %ax,%ax
+f010b538:	66 90                	xchg   %ax,%ax
+f010b53a:	66 90                	xchg   %ax,%ax
+f010b53c:	66 90                	xchg   %ax,%ax
+f010b53e:	66 90                	xchg   %ax,%ax
+f010b540:	66 90                	xchg   %ax,%ax
+f010b542:	66 90                	xchg   %ax,%ax
+f010b544:	66 90                	xchg   %ax,%ax
+f010b546:	66 90                	xchg   %ax,%ax
+f010b548:	66 90                	xchg   %ax,%ax
+f010b54a:	66 90                	xchg   %ax,%ax
+f010b54c:	66 90                	xchg   %ax,%ax
+f010b54e:	66 90                	xchg   %ax,%ax
+f010b550:	66 90                	xchg   %ax,%ax
+f010b552:	66 90                	xchg   %ax,%ax
+f010b554:	66 90                	xchg   %ax,%ax
+f010b556:	66 90                	xchg   %ax,%ax
+f010b558:	66 90                	xchg   %ax,%ax
+f010b55a:	66 90                	xchg   %ax,%ax
+f010b55c:	66 90                	xchg   %ax,%ax
+f010b55e:	66 90                	xchg   %ax,%ax
+f010b560:	66 90                	xchg   %ax,%ax
+f010b562:	66 90                	xchg   %ax,%ax
+f010b564:	66 90                	xchg   %ax,%ax
+f010b566:	66 90                	xchg   %ax,%ax
+f010b568:	66 90                	xchg   %ax,%ax
+f010b56a:	66 90                	xchg   %ax,%ax
+f010b56c:	66 90                	xchg   %ax,%ax
+f010b56e:	66 90                	xchg   %ax,%ax
+f010b570:	66 90                	xchg   %ax,%ax
+f010b572:	66 90                	xchg   %ax,%ax
+f010b574:	66 90                	xchg   %ax,%ax
+f010b576:	66 90                	xchg   %ax,%ax
+f010b578:	66 90                	xchg   %ax,%ax
+f010b57a:	66 90                	xchg   %ax,%ax
+f010b57c:	66 90                	xchg   %ax,%ax
+f010b57e:	66 90                	xchg   %ax,%ax
+f010b580:	66 90                	xchg   %ax,%ax
+f010b582:	66 90                	xchg   %ax,%ax
+f010b584:	66 90                	xchg   %ax,%ax
+f010b586:	66 90                	xchg   %ax,%ax
+f010b588:	66 90                	xchg   %ax,%ax
+f010b58a:	66 90                	xchg   %ax,%ax
+f010b58c:	66 90                	xchg   %ax,%ax
+f010b58e:	66 90                	xchg   %ax,%ax
+f010b590:	66 90                	xchg   %ax,%ax
+f010b592:	66 90                	xchg   %ax,%ax
+f010b594:	66 90                	xchg   %ax,%ax
+f010b596:	66 90                	xchg   %ax,%ax
+f010b598:	66 90                	xchg   %ax,%ax
+f010b59a:	66 90                	xchg   %ax,%ax
+f010b59c:	66 90                	xchg   %ax,%ax
+f010b59e:	66 90                	xchg   %ax,%ax
+f010b5a0:	66 90                	xchg   %ax,%ax
+f010b5a2:	66 90                	xchg   %ax,%ax
+f010b5a4:	66 90                	xchg   %ax,%ax
+f010b5a6:	66 90                	xchg   %ax,%ax
+f010b5a8:	66 90                	xchg   %ax,%ax
+f010b5aa:	66 90                	xchg   %ax,%ax
+f010b5ac:	66 90                	xchg   %ax,%ax
+f010b5ae:	66 90                	xchg   %ax,%ax
+f010b5b0:	66 90                	xchg   %ax,%ax
+f010b5b2:	66 90                	xchg   %ax,%ax
+f010b5b4:	66 90                	xchg   %ax,%ax
+f010b5b6:	66 90                	xchg   %ax,%ax
+f010b5b8:	66 90                	xchg   %ax,%ax
+f010b5ba:	66 90                	xchg   %ax,%ax
+f010b5bc:	66 90                	xchg   %ax,%ax
+f010b5be:	66 90                	xchg   %ax,%ax
+f010b5c0:	66 90                	xchg   %ax,%ax
+f010b5c2:	66 90                	xchg   %ax,%ax
+f010b5c4:	66 90                	xchg   %ax,%ax
+f010b5c6:	66 90                	xchg   %ax,%ax
+f010b5c8:	66 90                	xchg   %ax,%ax
+f010b5ca:	66 90                	xchg   %ax,%ax
+f010b5cc:	66 90                	xchg   %ax,%ax
+f010b5ce:	66 90                	xchg   %ax,%ax
+f010b5d0:	66 90                	xchg   %ax,%ax
+f010b5d2:	66 90                	xchg   %ax,%ax
+f010b5d4:	66 90                	xchg   %ax,%ax
+f010b5d6:	66 90                	xchg   %ax,%ax
+f010b5d8:	66 90                	xchg   %ax,%ax
+f010b5da:	66 90                	xchg   %ax,%ax
+f010b5dc:	66 90                	xchg   %ax,%ax
+f010b5de:	66 90                	xchg   %ax,%ax
+f010b5e0:	66 90                	xchg   %ax,%ax
+f010b5e2:	66 90                	xchg   %ax,%ax
+f010b5e4:	66 90                	xchg   %ax,%ax
+f010b5e6:	66 90                	xchg   %ax,%ax
+f010b5e8:	66 90                	xchg   %ax,%ax
+f010b5ea:	66 90                	xchg   %ax,%ax
+f010b5ec:	66 90                	xchg   %ax,%ax
+f010b5ee:	66 90                	xchg   %ax,%ax
+f010b5f0:	66 90                	xchg   %ax,%ax
+f010b5f2:	66 90                	xchg   %ax,%ax
+f010b5f4:	66 90                	xchg   %ax,%ax
+f010b5f6:	66 90                	xchg   %ax,%ax
+f010b5f8:	66 90                	xchg   %ax,%ax
+f010b5fa:	66 90                	xchg   %ax,%ax
+f010b5fc:	66 90                	xchg   %ax,%ax
+f010b5fe:	66 90                	xchg   %ax,%ax
+f010b600:	66 90                	xchg   %ax,%ax
+f010b602:	66 90                	xchg   %ax,%ax
+f010b604:	66 90                	xchg   %ax,%ax
+f010b606:	66 90                	xchg   %ax,%ax
+f010b608:	66 90                	xchg   %ax,%ax
+f010b60a:	66 90                	xchg   %ax,%ax
+f010b60c:	66 90                	xchg   %ax,%ax
+f010b60e:	66 90                	xchg   %ax,%ax
+f010b610:	66 90                	xchg   %ax,%ax
+f010b612:	66 90                	xchg   %ax,%ax
+f010b614:	66 90                	xchg   %ax,%ax
+f010b616:	66 90                	xchg   %ax,%ax
+f010b618:	66 90                	xchg   %ax,%ax
+f010b61a:	66 90                	xchg   %ax,%ax
+f010b61c:	66 90                	xchg   %ax,%ax
+f010b61e:	66 90                	xchg   %ax,%ax
+f010b620:	66 90                	xchg   %ax,%ax
+f010b622:	66 90                	xchg   %ax,%ax
+f010b624:	66 90                	xchg   %ax,%ax
+f010b626:	66 90                	xchg   %ax,%ax
+f010b628:	66 90                	xchg   %ax,%ax
+f010b62a:	66 90                	xchg   %ax,%ax
+f010b62c:	66 90                	xchg   %ax,%ax
+f010b62e:	66 90                	xchg   %ax,%ax
+f010b630:	66 90                	xchg   %ax,%ax
+f010b632:	66 90                	xchg   %ax,%ax
+f010b634:	66 90                	xchg   %ax,%ax
+f010b636:	66 90                	xchg   %ax,%ax
+f010b638:	66 90                	xchg   %ax,%ax
+f010b63a:	66 90                	xchg   %ax,%ax
+f010b63c:	66 90                	xchg   %ax,%ax
+f010b63e:	66 90                	xchg   %ax,%ax
+f010b640:	66 90                	xchg   %ax,%ax
+f010b642:	66 90                	xchg   %ax,%ax
+f010b644:	66 90                	xchg   %ax,%ax
+f010b646:	66 90                	xchg   %ax,%ax
+f010b648:	66 90                	xchg   %ax,%ax
+f010b64a:	66 90                	xchg   %ax,%ax
+f010b64c:	66 90                	xchg   %ax,%ax
+f010b64e:	66 90                	xchg   %ax,%ax
+f010b650:	66 90                	xchg   %ax,%ax
+f010b652:	66 90                	xchg   %ax,%ax
+f010b654:	66 90                	xchg   %ax,%ax
+f010b656:	66 90                	xchg   %ax,%ax
+f010b658:	66 90                	xchg   %ax,%ax
+f010b65a:	66 90                	xchg   %ax,%ax
+f010b65c:	66 90                	xchg   %ax,%ax
+f010b65e:	66 90                	xchg   %ax,%ax
+f010b660:	66 90                	xchg   %ax,%ax
+f010b662:	66 90                	xchg   %ax,%ax
+f010b664:	66 90                	xchg   %ax,%ax
+f010b666:	66 90                	xchg   %ax,%ax
+f010b668:	66 90                	xchg   %ax,%ax
+f010b66a:	66 90                	xchg   %ax,%ax
+f010b66c:	66 90                	xchg   %ax,%ax
+f010b66e:	66 90                	xchg   %ax,%ax
+f010b670:	66 90                	xchg   %ax,%ax
+f010b672:	66 90                	xchg   %ax,%ax
+f010b674:	66 90                	xchg   %ax,%ax
+f010b676:	66 90                	xchg   %ax,%ax
+f010b678:	66 90                	xchg   %ax,%ax
+f010b67a:	66 90                	xchg   %ax,%ax
+f010b67c:	66 90                	xchg   %ax,%ax
+f010b67e:	66 90                	xchg   %ax,%ax
+f010b680:	66 90                	xchg   %ax,%ax
+f010b682:	66 90                	xchg   %ax,%ax
+f010b684:	66 90                	xchg   %ax,%ax
+f010b686:	66 90                	xchg   %ax,%ax
+f010b688:	66 90                	xchg   %ax,%ax
+f010b68a:	66 90                	xchg   %ax,%ax
+f010b68c:	66 90                	xchg   %ax,%ax
+f010b68e:	66 90                	xchg   %ax,%ax
+f010b690:	66 90                	xchg   %ax,%ax
+f010b692:	66 90                	xchg   %ax,%ax
+f010b694:	66 90                	xchg   %ax,%ax
+f010b696:	66 90                	xchg   %ax,%ax
+f010b698:	66 90                	xchg   %ax,%ax
+f010b69a:	66 90                	xchg   %ax,%ax
+f010b69c:	66 90                	xchg   %ax,%ax
+f010b69e:	66 90                	xchg   %ax,%ax
+f010b6a0:	66 90                	xchg   %ax,%ax
+f010b6a2:	66 90                	xchg   %ax,%ax
+f010b6a4:	66 90                	xchg   %ax,%ax
+f010b6a6:	66 90                	xchg   %ax,%ax
+f010b6a8:	66 90                	xchg   %ax,%ax
+f010b6aa:	66 90                	xchg   %ax,%ax
+f010b6ac:	66 90                	xchg   %ax,%ax
+f010b6ae:	66 90                	xchg   %ax,%ax
+f010b6b0:	66 90                	xchg   %ax,%ax
+f010b6b2:	66 90                	xchg   %ax,%ax
+f010b6b4:	66 90                	xchg   %ax,%ax
+f010b6b6:	66 90                	xchg   %ax,%ax
+f010b6b8:	66 90                	xchg   %ax,%ax
+f010b6ba:	66 90                	xchg   %ax,%ax
+f010b6bc:	66 90                	xchg   %ax,%ax
+f010b6be:	66 90                	xchg   %ax,%ax
+f010b6c0:	66 90                	xchg   %ax,%ax
+f010b6c2:	66 90                	xchg   %ax,%ax
+f010b6c4:	66 90                	xchg   %ax,%ax
+f010b6c6:	66 90                	xchg   %ax,%ax
+f010b6c8:	66 90                	xchg   %ax,%ax
+f010b6ca:	66 90                	xchg   %ax,%ax
+f010b6cc:	66 90                	xchg   %ax,%ax
+f010b6ce:	66 90                	xchg   %ax,%ax
+f010b6d0:	66 90                	xchg   %ax,%ax
+f010b6d2:	66 90                	xchg   %ax,%ax
+f010b6d4:	66 90                	xchg   %ax,%ax
+f010b6d6:	66 90                	xchg   %ax,%ax
+f010b6d8:	66 90                	xchg   %ax,%ax
+f010b6da:	66 90                	xchg   %ax,%ax
+f010b6dc:	66 90                	xchg   %ax,%ax
+f010b6de:	66 90                	xchg   %ax,%ax
+f010b6e0:	66 90                	xchg   %ax,%ax
+f010b6e2:	66 90                	xchg   %ax,%ax
+f010b6e4:	66 90                	xchg   %ax,%ax
+f010b6e6:	66 90                	xchg   %ax,%ax
+f010b6e8:	66 90                	xchg   %ax,%ax
+f010b6ea:	66 90                	xchg   %ax,%ax
+f010b6ec:	66 90                	xchg   %ax,%ax
+f010b6ee:	66 90                	xchg   %ax,%ax
+f010b6f0:	66 90                	xchg   %ax,%ax
+f010b6f2:	66 90                	xchg   %ax,%ax
+f010b6f4:	66 90                	xchg   %ax,%ax
+f010b6f6:	66 90                	xchg   %ax,%ax
+f010b6f8:	66 90                	xchg   %ax,%ax
+f010b6fa:	66 90                	xchg   %ax,%ax
+f010b6fc:	66 90                	xchg   %ax,%ax
+f010b6fe:	66 90                	xchg   %ax,%ax
+f010b700:	66 90                	xchg   %ax,%ax
+f010b702:	66 90                	xchg   %ax,%ax
+f010b704:	66 90                	xchg   %ax,%ax
+f010b706:	66 90                	xchg   %ax,%ax
+f010b708:	66 90                	xchg   %ax,%ax
+f010b70a:	66 90                	xchg   %ax,%ax
+f010b70c:	66 90                	xchg   %ax,%ax
+f010b70e:	66 90                	xchg   %ax,%ax
+f010b710:	66 90                	xchg   %ax,%ax
+f010b712:	66 90                	xchg   %ax,%ax
+f010b714:	66 90                	xchg   %ax,%ax
+f010b716:	66 90                	xchg   %ax,%ax
+f010b718:	66 90                	xchg   %ax,%ax
+f010b71a:	66 90                	xchg   %ax,%ax
+f010b71c:	66 90                	xchg   %ax,%ax
+f010b71e:	66 90                	xchg   %ax,%ax
+f010b720:	66 90                	xchg   %ax,%ax
+f010b722:	66 90                	xchg   %ax,%ax
+f010b724:	66 90                	xchg   %ax,%ax
+f010b726:	66 90                	xchg   %ax,%ax
+f010b728:	66 90                	xchg   %ax,%ax
+f010b72a:	66 90                	xchg   %ax,%ax
+f010b72c:	66 90                	xchg   %ax,%ax
+f010b72e:	66 90                	xchg   %ax,%ax
+f010b730:	66 90                	xchg   %ax,%ax
+f010b732:	66 90                	xchg   %ax,%ax
+f010b734:	66 90                	xchg   %ax,%ax
+f010b736:	66 90                	xchg   %ax,%ax
+f010b738:	66 90                	xchg   %ax,%ax
+f010b73a:	66 90                	xchg   %ax,%ax
+f010b73c:	66 90                	xchg   %ax,%ax
+f010b73e:	66 90                	xchg   %ax,%ax
+f010b740:	66 90                	xchg   %ax,%ax
+f010b742:	66 90                	xchg   %ax,%ax
+f010b744:	66 90                	xchg   %ax,%ax
+f010b746:	66 90                	xchg   %ax,%ax
+f010b748:	66 90                	xchg   %ax,%ax
+f010b74a:	66 90                	xchg   %ax,%ax
+f010b74c:	66 90                	xchg   %ax,%ax
+f010b74e:	66 90                	xchg   %ax,%ax
+f010b750:	66 90                	xchg   %ax,%ax
+f010b752:	66 90                	xchg   %ax,%ax
+f010b754:	66 90                	xchg   %ax,%ax
+f010b756:	66 90                	xchg   %ax,%ax
+f010b758:	66 90                	xchg   %ax,%ax
+f010b75a:	66 90                	xchg   %ax,%ax
+f010b75c:	66 90                	xchg   %ax,%ax
+f010b75e:	66 90                	xchg   %ax,%ax
+f010b760:	66 90                	xchg   %ax,%ax
+f010b762:	66 90                	xchg   %ax,%ax
+f010b764:	66 90                	xchg   %ax,%ax
+f010b766:	66 90                	xchg   %ax,%ax
+f010b768:	66 90                	xchg   %ax,%ax
+f010b76a:	66 90                	xchg   %ax,%ax
+f010b76c:	66 90                	xchg   %ax,%ax
+f010b76e:	66 90                	xchg   %ax,%ax
+f010b770:	66 90                	xchg   %ax,%ax
+f010b772:	66 90                	xchg   %ax,%ax
+f010b774:	66 90                	xchg   %ax,%ax
+f010b776:	66 90                	xchg   %ax,%ax
+f010b778:	66 90                	xchg   %ax,%ax
+f010b77a:	66 90                	xchg   %ax,%ax
+f010b77c:	66 90                	xchg   %ax,%ax
+f010b77e:	66 90                	xchg   %ax,%ax
+f010b780:	66 90                	xchg   %ax,%ax
+f010b782:	66 90                	xchg   %ax,%ax
+f010b784:	66 90                	xchg   %ax,%ax
+f010b786:	66 90                	xchg   %ax,%ax
+f010b788:	66 90                	xchg   %ax,%ax
+f010b78a:	66 90                	xchg   %ax,%ax
+f010b78c:	66 90                	xchg   %ax,%ax
+f010b78e:	66 90                	xchg   %ax,%ax
+f010b790:	66 90                	xchg   %ax,%ax
+f010b792:	66 90                	xchg   %ax,%ax
+f010b794:	66 90                	xchg   %ax,%ax
+f010b796:	66 90                	xchg   %ax,%ax
+f010b798:	66 90                	xchg   %ax,%ax
+f010b79a:	66 90                	xchg   %ax,%ax
+f010b79c:	66 90                	xchg   %ax,%ax
+f010b79e:	66 90                	xchg   %ax,%ax
+f010b7a0:	66 90                	xchg   %ax,%ax
+f010b7a2:	66 90                	xchg   %ax,%ax
+f010b7a4:	66 90                	xchg   %ax,%ax
+f010b7a6:	66 90                	xchg   %ax,%ax
+f010b7a8:	66 90                	xchg   %ax,%ax
+f010b7aa:	66 90                	xchg   %ax,%ax
+f010b7ac:	66 90                	xchg   %ax,%ax
+f010b7ae:	66 90                	xchg   %ax,%ax
+f010b7b0:	66 90                	xchg   %ax,%ax
+f010b7b2:	66 90                	xchg   %ax,%ax
+f010b7b4:	66 90                	xchg   %ax,%ax
+f010b7b6:	66 90                	xchg   %ax,%ax
+f010b7b8:	66 90                	xchg   %ax,%ax
+f010b7ba:	66 90                	xchg   %ax,%ax
+f010b7bc:	66 90                	xchg   %ax,%ax
+f010b7be:	66 90                	xchg   %ax,%ax
+f010b7c0:	66 90                	xchg   %ax,%ax
+f010b7c2:	66 90                	xchg   %ax,%ax
+f010b7c4:	66 90                	xchg   %ax,%ax
+f010b7c6:	66 90                	xchg   %ax,%ax
+f010b7c8:	66 90                	xchg   %ax,%ax
+f010b7ca:	66 90                	xchg   %ax,%ax
+f010b7cc:	66 90                	xchg   %ax,%ax
+f010b7ce:	66 90                	xchg   %ax,%ax
+f010b7d0:	66 90                	xchg   %ax,%ax
+f010b7d2:	66 90                	xchg   %ax,%ax
+f010b7d4:	66 90                	xchg   %ax,%ax
+f010b7d6:	66 90                	xchg   %ax,%ax
+f010b7d8:	66 90                	xchg   %ax,%ax
+f010b7da:	66 90                	xchg   %ax,%ax
+f010b7dc:	66 90                	xchg   %ax,%ax
+f010b7de:	66 90                	xchg   %ax,%ax
+f010b7e0:	66 90                	xchg   %ax,%ax
+f010b7e2:	66 90                	xchg   %ax,%ax
+f010b7e4:	66 90                	xchg   %ax,%ax
+f010b7e6:	66 90                	xchg   %ax,%ax
+f010b7e8:	66 90                	xchg   %ax,%ax
+f010b7ea:	66 90                	xchg   %ax,%ax
+f010b7ec:	66 90                	xchg   %ax,%ax
+f010b7ee:	66 90                	xchg   %ax,%ax
+f010b7f0:	66 90                	xchg   %ax,%ax
+f010b7f2:	66 90                	xchg   %ax,%ax
+f010b7f4:	66 90                	xchg   %ax,%ax
+f010b7f6:	66 90                	xchg   %ax,%ax
+f010b7f8:	66 90                	xchg   %ax,%ax
+f010b7fa:	66 90                	xchg   %ax,%ax
+f010b7fc:	66 90                	xchg   %ax,%ax
+f010b7fe:	66 90                	xchg   %ax,%ax
+f010b800:	66 90                	xchg   %ax,%ax
+f010b802:	66 90                	xchg   %ax,%ax
+f010b804:	66 90                	xchg   %ax,%ax
+f010b806:	66 90                	xchg   %ax,%ax
+f010b808:	66 90                	xchg   %ax,%ax
+f010b80a:	66 90                	xchg   %ax,%ax
+f010b80c:	66 90                	xchg   %ax,%ax
+f010b80e:	66 90                	xchg   %ax,%ax
+f010b810:	66 90                	xchg   %ax,%ax
+f010b812:	66 90                	xchg   %ax,%ax
+f010b814:	66 90                	xchg   %ax,%ax
+f010b816:	66 90                	xchg   %ax,%ax
+f010b818:	66 90                	xchg   %ax,%ax
+f010b81a:	66 90                	xchg   %ax,%ax
+f010b81c:	66 90                	xchg   %ax,%ax
+f010b81e:	66 90                	xchg   %ax,%ax
+f010b820:	66 90                	xchg   %ax,%ax
+f010b822:	66 90                	xchg   %ax,%ax
+f010b824:	66 90                	xchg   %ax,%ax
+f010b826:	66 90                	xchg   %ax,%ax
+f010b828:	66 90                	xchg   %ax,%ax
+f010b82a:	66 90                	xchg   %ax,%ax
+f010b82c:	66 90                	xchg   %ax,%ax
+f010b82e:	66 90                	xchg   %ax,%ax
+f010b830:	66 90                	xchg   %ax,%ax
+f010b832:	66 90                	xchg   %ax,%ax
+f010b834:	66 90                	xchg   %ax,%ax
+f010b836:	66 90                	xchg   %ax,%ax
+f010b838:	66 90                	xchg   %ax,%ax
+f010b83a:	66 90                	xchg   %ax,%ax
+f010b83c:	66 90                	xchg   %ax,%ax
+f010b83e:	66 90                	xchg   %ax,%ax
+f010b840:	66 90                	xchg   %ax,%ax
+f010b842:	66 90                	xchg   %ax,%ax
+f010b844:	66 90                	xchg   %ax,%ax
+f010b846:	66 90                	xchg   %ax,%ax
+f010b848:	66 90                	xchg   %ax,%ax
+f010b84a:	66 90                	xchg   %ax,%ax
+f010b84c:	66 90                	xchg   %ax,%ax
+f010b84e:	66 90                	xchg   %ax,%ax
+f010b850:	66 90                	xchg   %ax,%ax
+f010b852:	66 90                	xchg   %ax,%ax
+f010b854:	66 90                	xchg   %ax,%ax
+f010b856:	66 90                	xchg   %ax,%ax
+f010b858:	66 90                	xchg   %ax,%ax
+f010b85a:	66 90                	xchg   %ax,%ax
+f010b85c:	66 90                	xchg   %ax,%ax
+f010b85e:	66 90                	xchg   %ax,%ax
+f010b860:	66 90                	xchg   %ax,%ax
+f010b862:	66 90                	xchg   %ax,%ax
+f010b864:	66 90                	xchg   %ax,%ax
+f010b866:	66 90                	xchg   %ax,%ax
+f010b868:	66 90                	xchg   %ax,%ax
+f010b86a:	66 90                	xchg   %ax,%ax
+f010b86c:	66 90                	xchg   %ax,%ax
+f010b86e:	66 90                	xchg   %ax,%ax
+f010b870:	66 90                	xchg   %ax,%ax
+f010b872:	66 90                	xchg   %ax,%ax
+f010b874:	66 90                	xchg   %ax,%ax
+f010b876:	66 90                	xchg   %ax,%ax
+f010b878:	66 90                	xchg   %ax,%ax
+f010b87a:	66 90                	xchg   %ax,%ax
+f010b87c:	66 90                	xchg   %ax,%ax
+f010b87e:	66 90                	xchg   %ax,%ax
+f010b880:	66 90                	xchg   %ax,%ax
+f010b882:	66 90                	xchg   %ax,%ax
+f010b884:	66 90                	xchg   %ax,%ax
+f010b886:	66 90                	xchg   %ax,%ax
+f010b888:	66 90                	xchg   %ax,%ax
+f010b88a:	66 90                	xchg   %ax,%ax
+f010b88c:	66 90                	xchg   %ax,%ax
+f010b88e:	66 90                	xchg   %ax,%ax
+f010b890:	66 90                	xchg   %ax,%ax
+f010b892:	66 90                	xchg   %ax,%ax
+f010b894:	66 90                	xchg   %ax,%ax
+f010b896:	66 90                	xchg   %ax,%ax
+f010b898:	66 90                	xchg   %ax,%ax
+f010b89a:	66 90                	xchg   %ax,%ax
+f010b89c:	66 90                	xchg   %ax,%ax
+f010b89e:	66 90                	xchg   %ax,%ax
+f010b8a0:	66 90                	xchg   %ax,%ax
+f010b8a2:	66 90                	xchg   %ax,%ax
+f010b8a4:	66 90                	xchg   %ax,%ax
+f010b8a6:	66 90                	xchg   %ax,%ax
+f010b8a8:	66 90                	xchg   %ax,%ax
+f010b8aa:	66 90                	xchg   %ax,%ax
+f010b8ac:	66 90                	xchg   %ax,%ax
+f010b8ae:	66 90                	xchg   %ax,%ax
+f010b8b0:	66 90                	xchg   %ax,%ax
+f010b8b2:	66 90                	xchg   %ax,%ax
+f010b8b4:	66 90                	xchg   %ax,%ax
+f010b8b6:	66 90                	xchg   %ax,%ax
+f010b8b8:	66 90                	xchg   %ax,%ax
+f010b8ba:	66 90                	xchg   %ax,%ax
+f010b8bc:	66 90                	xchg   %ax,%ax
+f010b8be:	66 90                	xchg   %ax,%ax
+f010b8c0:	66 90                	xchg   %ax,%ax
+f010b8c2:	66 90                	xchg   %ax,%ax
+f010b8c4:	66 90                	xchg   %ax,%ax
+f010b8c6:	66 90                	xchg   %ax,%ax
+f010b8c8:	66 90                	xchg   %ax,%ax
+f010b8ca:	66 90                	xchg   %ax,%ax
+f010b8cc:	66 90                	xchg   %ax,%ax
+f010b8ce:	66 90                	xchg   %ax,%ax
+f010b8d0:	66 90                	xchg   %ax,%ax
+f010b8d2:	66 90                	xchg   %ax,%ax
+f010b8d4:	66 90                	xchg   %ax,%ax
+f010b8d6:	66 90                	xchg   %ax,%ax
+f010b8d8:	66 90                	xchg   %ax,%ax
+f010b8da:	66 90                	xchg   %ax,%ax
+f010b8dc:	66 90                	xchg   %ax,%ax
+f010b8de:	66 90                	xchg   %ax,%ax
+f010b8e0:	66 90                	xchg   %ax,%ax
+f010b8e2:	66 90                	xchg   %ax,%ax
+f010b8e4:	66 90                	xchg   %ax,%ax
+f010b8e6:	66 90                	xchg   %ax,%ax
+f010b8e8:	66 90                	xchg   %ax,%ax
+f010b8ea:	66 90                	xchg   %ax,%ax
+f010b8ec:	66 90                	xchg   %ax,%ax
+f010b8ee:	66 90                	xchg   %ax,%ax
+f010b8f0:	66 90                	xchg   %ax,%ax
+f010b8f2:	66 90                	xchg   %ax,%ax
+f010b8f4:	66 90                	xchg   %ax,%ax
+f010b8f6:	66 90                	xchg   %ax,%ax
+f010b8f8:	66 90                	xchg   %ax,%ax
+f010b8fa:	66 90                	xchg   %ax,%ax
+f010b8fc:	66 90                	xchg   %ax,%ax
+f010b8fe:	66 90                	xchg   %ax,%ax
+f010b900:	66 90                	xchg   %ax,%ax
+f010b902:	66 90                	xchg   %ax,%ax
+f010b904:	66 90                	xchg   %ax,%ax
+f010b906:	66 90                	xchg   %ax,%ax
+f010b908:	66 90                	xchg   %ax,%ax
+f010b90a:	66 90                	xchg   %ax,%ax
+f010b90c:	66 90                	xchg   %ax,%ax
+f010b90e:	66 90                	xchg   %ax,%ax
+f010b910:	66 90                	xchg   %ax,%ax
+f010b912:	66 90                	xchg   %ax,%ax
+f010b914:	66 90                	xchg   %ax,%ax
+f010b916:	66 90                	xchg   %ax,%ax
+f010b918:	66 90                	xchg   %ax,%ax
+f010b91a:	66 90                	xchg   %ax,%ax
+f010b91c:	66 90                	xchg   %ax,%ax
+f010b91e:	66 90                	xchg   %ax,%ax
+f010b920:	66 90                	xchg   %ax,%ax
+f010b922:	66 90                	xchg   %ax,%ax
+f010b924:	66 90                	xchg   %ax,%ax
+f010b926:	66 90                	xchg   %ax,%ax
+f010b928:	66 90                	xchg   %ax,%ax
+f010b92a:	66 90                	xchg   %ax,%ax
+f010b92c:	66 90                	xchg   %ax,%ax
+f010b92e:	66 90                	xchg   %ax,%ax
+f010b930:	66 90                	xchg   %ax,%ax
+f010b932:	66 90                	xchg   %ax,%ax
+f010b934:	66 90                	xchg   %ax,%ax
+f010b936:	66 90                	xchg   %ax,%ax
+f010b938:	66 90                	xchg   %ax,%ax
+f010b93a:	66 90                	xchg   %ax,%ax
+f010b93c:	66 90                	xchg   %ax,%ax
+f010b93e:	66 90                	xchg   %ax,%ax
+f010b940:	66 90                	xchg   %ax,%ax
+f010b942:	66 90                	xchg   %ax,%ax
+f010b944:	66 90                	xchg   %ax,%ax
+f010b946:	66 90                	xchg   %ax,%ax
+f010b948:	66 90                	xchg   %ax,%ax
+f010b94a:	66 90                	xchg   %ax,%ax
+f010b94c:	66 90                	xchg   %ax,%ax
+f010b94e:	66 90                	xchg   %ax,%ax
+f010b950:	66 90                	xchg   %ax,%ax
+f010b952:	66 90                	xchg   %ax,%ax
+f010b954:	66 90                	xchg   %ax,%ax
+f010b956:	66 90                	xchg   %ax,%ax
+f010b958:	66 90                	xchg   %ax,%ax
+f010b95a:	66 90                	xchg   %ax,%ax
+f010b95c:	66 90                	xchg   %ax,%ax
+f010b95e:	66 90                	xchg   %ax,%ax
+f010b960:	66 90                	xchg   %ax,%ax
+f010b962:	66 90                	xchg   %ax,%ax
+f010b964:	66 90                	xchg   %ax,%ax
+f010b966:	66 90                	xchg   %ax,%ax
+f010b968:	66 90                	xchg   %ax,%ax
+f010b96a:	66 90                	xchg   %ax,%ax
+f010b96c:	66 90                	xchg   %ax,%ax
+f010b96e:	66 90                	xchg   %ax,%ax
+f010b970:	66 90                	xchg   %ax,%ax
+f010b972:	66 90                	xchg   %ax,%ax
+f010b974:	66 90                	xchg   %ax,%ax
+f010b976:	66 90                	xchg   %ax,%ax
+f010b978:	66 90                	xchg   %ax,%ax
+f010b97a:	66 90                	xchg   %ax,%ax
+f010b97c:	66 90                	xchg   %ax,%ax
+f010b97e:	66 90                	xchg   %ax,%ax
+f010b980:	66 90                	xchg   %ax,%ax
+f010b982:	66 90                	xchg   %ax,%ax
+f010b984:	66 90                	xchg   %ax,%ax
+f010b986:	66 90                	xchg   %ax,%ax
+f010b988:	66 90                	xchg   %ax,%ax
+f010b98a:	66 90                	xchg   %ax,%ax
+f010b98c:	66 90                	xchg   %ax,%ax
+f010b98e:	66 90                	xchg   %ax,%ax
+f010b990:	66 90                	xchg   %ax,%ax
+f010b992:	66 90                	xchg   %ax,%ax
+f010b994:	66 90                	xchg   %ax,%ax
+f010b996:	66 90                	xchg   %ax,%ax
+f010b998:	66 90                	xchg   %ax,%ax
+f010b99a:	66 90                	xchg   %ax,%ax
+f010b99c:	66 90                	xchg   %ax,%ax
+f010b99e:	66 90                	xchg   %ax,%ax
+f010b9a0:	66 90                	xchg   %ax,%ax
+f010b9a2:	66 90                	xchg   %ax,%ax
+f010b9a4:	66 90                	xchg   %ax,%ax
+f010b9a6:	66 90                	xchg   %ax,%ax
+f010b9a8:	66 90                	xchg   %ax,%ax
+f010b9aa:	66 90                	xchg   %ax,%ax
+f010b9ac:	66 90                	xchg   %ax,%ax
+f010b9ae:	66 90                	xchg   %ax,%ax
+f010b9b0:	66 90                	xchg   %ax,%ax
+f010b9b2:	66 90                	xchg   %ax,%ax
+f010b9b4:	66 90                	xchg   %ax,%ax
+f010b9b6:	66 90                	xchg   %ax,%ax
+f010b9b8:	66 90                	xchg   %ax,%ax
+f010b9ba:	66 90                	xchg   %ax,%ax
+f010b9bc:	66 90                	xchg   %ax,%ax
+f010b9be:	66 90                	xchg   %ax,%ax
+f010b9c0:	66 90                	xchg   %ax,%ax
+f010b9c2:	66 90                	xchg   %ax,%ax
+f010b9c4:	66 90                	xchg   %ax,%ax
+f010b9c6:	66 90                	xchg   %ax,%ax
+f010b9c8:	66 90                	xchg   %ax,%ax
+f010b9ca:	66 90                	xchg   %ax,%ax
+f010b9cc:	66 90                	xchg   %ax,%ax
+f010b9ce:	66 90                	xchg   %ax,%ax
+f010b9d0:	66 90                	xchg   %ax,%ax
+f010b9d2:	66 90                	xchg   %ax,%ax
+f010b9d4:	66 90                	xchg   %ax,%ax
+f010b9d6:	66 90                	xchg   %ax,%ax
+f010b9d8:	66 90                	xchg   %ax,%ax
+f010b9da:	66 90                	xchg   %ax,%ax
+f010b9dc:	66 90                	xchg   %ax,%ax
+f010b9de:	66 90                	xchg   %ax,%ax
+f010b9e0:	66 90                	xchg   %ax,%ax
+f010b9e2:	66 90                	xchg   %ax,%ax
+f010b9e4:	66 90                	xchg   %ax,%ax
+f010b9e6:	66 90                	xchg   %ax,%ax
+f010b9e8:	66 90                	xchg   %ax,%ax
+f010b9ea:	66 90                	xchg   %ax,%ax
+f010b9ec:	66 90                	xchg   %ax,%ax
+f010b9ee:	66 90                	xchg   %ax,%ax
+f010b9f0:	66 90                	xchg   %ax,%ax
+f010b9f2:	66 90                	xchg   %ax,%ax
+f010b9f4:	66 90                	xchg   %ax,%ax
+f010b9f6:	66 90                	xchg   %ax,%ax
+f010b9f8:	66 90                	xchg   %ax,%ax
+f010b9fa:	66 90                	xchg   %ax,%ax
+f010b9fc:	66 90                	xchg   %ax,%ax
+f010b9fe:	66 90                	xchg   %ax,%ax
+f010ba00:	66 90                	xchg   %ax,%ax
+f010ba02:	66 90                	xchg   %ax,%ax
+f010ba04:	66 90                	xchg   %ax,%ax
+f010ba06:	66 90                	xchg   %ax,%ax
+f010ba08:	66 90                	xchg   %ax,%ax
+f010ba0a:	66 90                	xchg   %ax,%ax
+f010ba0c:	66 90                	xchg   %ax,%ax
+f010ba0e:	66 90                	xchg   %ax,%ax
+f010ba10:	66 90                	xchg   %ax,%ax
+f010ba12:	66 90                	xchg   %ax,%ax
+f010ba14:	66 90                	xchg   %ax,%ax
+f010ba16:	66 90                	xchg   %ax,%ax
+f010ba18:	66 90                	xchg   %ax,%ax
+f010ba1a:	66 90                	xchg   %ax,%ax
+f010ba1c:	66 90                	xchg   %ax,%ax
+f010ba1e:	66 90                	xchg   %ax,%ax
+f010ba20:	66 90                	xchg   %ax,%ax
+f010ba22:	66 90                	xchg   %ax,%ax
+f010ba24:	66 90                	xchg   %ax,%ax
+f010ba26:	66 90                	xchg   %ax,%ax
+f010ba28:	66 90                	xchg   %ax,%ax
+f010ba2a:	66 90                	xchg   %ax,%ax
+f010ba2c:	66 90                	xchg   %ax,%ax
+f010ba2e:	66 90                	xchg   %ax,%ax
+f010ba30:	66 90                	xchg   %ax,%ax
+f010ba32:	66 90                	xchg   %ax,%ax
+f010ba34:	66 90                	xchg   %ax,%ax
+f010ba36:	66 90                	xchg   %ax,%ax
+f010ba38:	66 90                	xchg   %ax,%ax
+f010ba3a:	66 90                	xchg   %ax,%ax
+f010ba3c:	66 90                	xchg   %ax,%ax
+f010ba3e:	66 90                	xchg   %ax,%ax
+f010ba40:	66 90                	xchg   %ax,%ax
+f010ba42:	66 90                	xchg   %ax,%ax
+f010ba44:	66 90                	xchg   %ax,%ax
+f010ba46:	66 90                	xchg   %ax,%ax
+f010ba48:	66 90                	xchg   %ax,%ax
+f010ba4a:	66 90                	xchg   %ax,%ax
+f010ba4c:	66 90                	xchg   %ax,%ax
+f010ba4e:	66 90                	xchg   %ax,%ax
+f010ba50:	66 90                	xchg   %ax,%ax
+f010ba52:	66 90                	xchg   %ax,%ax
+f010ba54:	66 90                	xchg   %ax,%ax
+f010ba56:	66 90                	xchg   %ax,%ax
+f010ba58:	66 90                	xchg   %ax,%ax
+f010ba5a:	66 90                	xchg   %ax,%ax
+f010ba5c:	66 90                	xchg   %ax,%ax
+f010ba5e:	66 90                	xchg   %ax,%ax
+f010ba60:	66 90                	xchg   %ax,%ax
+f010ba62:	66 90                	xchg   %ax,%ax
+f010ba64:	66 90                	xchg   %ax,%ax
+f010ba66:	66 90                	xchg   %ax,%ax
+f010ba68:	66 90                	xchg   %ax,%ax
+f010ba6a:	66 90                	xchg   %ax,%ax
+f010ba6c:	66 90                	xchg   %ax,%ax
+f010ba6e:	66 90                	xchg   %ax,%ax
+f010ba70:	66 90                	xchg   %ax,%ax
+f010ba72:	66 90                	xchg   %ax,%ax
+f010ba74:	66 90                	xchg   %ax,%ax
+f010ba76:	66 90                	xchg   %ax,%ax
+f010ba78:	66 90                	xchg   %ax,%ax
+f010ba7a:	66 90                	xchg   %ax,%ax
+f010ba7c:	66 90                	xchg   %ax,%ax
+f010ba7e:	66 90                	xchg   %ax,%ax
+f010ba80:	66 90                	xchg   %ax,%ax
+f010ba82:	66 90                	xchg   %ax,%ax
+f010ba84:	66 90                	xchg   %ax,%ax
+f010ba86:	66 90                	xchg   %ax,%ax
+f010ba88:	66 90                	xchg   %ax,%ax
+f010ba8a:	66 90                	xchg   %ax,%ax
+f010ba8c:	66 90                	xchg   %ax,%ax
+f010ba8e:	66 90                	xchg   %ax,%ax
+f010ba90:	66 90                	xchg   %ax,%ax
+f010ba92:	66 90                	xchg   %ax,%ax
+f010ba94:	66 90                	xchg   %ax,%ax
+f010ba96:	66 90                	xchg   %ax,%ax
+f010ba98:	66 90                	xchg   %ax,%ax
+f010ba9a:	66 90                	xchg   %ax,%ax
+f010ba9c:	66 90                	xchg   %ax,%ax
+f010ba9e:	66 90                	xchg   %ax,%ax
+f010baa0:	66 90                	xchg   %ax,%ax
+f010baa2:	66 90                	xchg   %ax,%ax
+f010baa4:	66 90                	xchg   %ax,%ax
+f010baa6:	66 90                	xchg   %ax,%ax
+f010baa8:	66 90                	xchg   %ax,%ax
+f010baaa:	66 90                	xchg   %ax,%ax
+f010baac:	66 90                	xchg   %ax,%ax
+f010baae:	66 90                	xchg   %ax,%ax
+f010bab0:	66 90                	xchg   %ax,%ax
+f010bab2:	66 90                	xchg   %ax,%ax
+f010bab4:	66 90                	xchg   %ax,%ax
+f010bab6:	66 90                	xchg   %ax,%ax
+f010bab8:	66 90                	xchg   %ax,%ax
+f010baba:	66 90                	xchg   %ax,%ax
+f010babc:	66 90                	xchg   %ax,%ax
+f010babe:	66 90                	xchg   %ax,%ax
+f010bac0:	66 90                	xchg   %ax,%ax
+f010bac2:	66 90                	xchg   %ax,%ax
+f010bac4:	66 90                	xchg   %ax,%ax
+f010bac6:	66 90                	xchg   %ax,%ax
+f010bac8:	66 90                	xchg   %ax,%ax
+f010baca:	66 90                	xchg   %ax,%ax
+f010bacc:	66 90                	xchg   %ax,%ax
+f010bace:	66 90                	xchg   %ax,%ax
+f010bad0:	66 90                	xchg   %ax,%ax
+f010bad2:	66 90                	xchg   %ax,%ax
+f010bad4:	66 90                	xchg   %ax,%ax
+f010bad6:	66 90                	xchg   %ax,%ax
+f010bad8:	66 90                	xchg   %ax,%ax
+f010bada:	66 90                	xchg   %ax,%ax
+f010badc:	66 90                	xchg   %ax,%ax
+f010bade:	66 90                	xchg   %ax,%ax
+f010bae0:	66 90                	xchg   %ax,%ax
+f010bae2:	66 90                	xchg   %ax,%ax
+f010bae4:	66 90                	xchg   %ax,%ax
+f010bae6:	66 90                	xchg   %ax,%ax
+f010bae8:	66 90                	xchg   %ax,%ax
+f010baea:	66 90                	xchg   %ax,%ax
+f010baec:	66 90                	xchg   %ax,%ax
+f010baee:	66 90                	xchg   %ax,%ax
+f010baf0:	66 90                	xchg   %ax,%ax
+f010baf2:	66 90                	xchg   %ax,%ax
+f010baf4:	66 90                	xchg   %ax,%ax
+f010baf6:	66 90                	xchg   %ax,%ax
+f010baf8:	66 90                	xchg   %ax,%ax
+f010bafa:	66 90                	xchg   %ax,%ax
+f010bafc:	66 90                	xchg   %ax,%ax
+f010bafe:	66 90                	xchg   %ax,%ax
+f010bb00:	66 90                	xchg   %ax,%ax
+f010bb02:	66 90                	xchg   %ax,%ax
+f010bb04:	66 90                	xchg   %ax,%ax
+f010bb06:	66 90                	xchg   %ax,%ax
+f010bb08:	66 90                	xchg   %ax,%ax
+f010bb0a:	66 90                	xchg   %ax,%ax
+f010bb0c:	66 90                	xchg   %ax,%ax
+f010bb0e:	66 90                	xchg   %ax,%ax
+f010bb10:	66 90                	xchg   %ax,%ax
+f010bb12:	66 90                	xchg   %ax,%ax
+f010bb14:	66 90                	xchg   %ax,%ax
+f010bb16:	66 90                	xchg   %ax,%ax
+f010bb18:	66 90                	xchg   %ax,%ax
+f010bb1a:	66 90                	xchg   %ax,%ax
+f010bb1c:	66 90                	xchg   %ax,%ax
+f010bb1e:	66 90                	xchg   %ax,%ax
+f010bb20:	66 90                	xchg   %ax,%ax
+f010bb22:	66 90                	xchg   %ax,%ax
+f010bb24:	66 90                	xchg   %ax,%ax
+f010bb26:	66 90                	xchg   %ax,%ax
+f010bb28:	66 90                	xchg   %ax,%ax
+f010bb2a:	66 90                	xchg   %ax,%ax
+f010bb2c:	66 90                	xchg   %ax,%ax
+f010bb2e:	66 90                	xchg   %ax,%ax
+f010bb30:	66 90                	xchg   %ax,%ax
+f010bb32:	66 90                	xchg   %ax,%ax
+f010bb34:	66 90                	xchg   %ax,%ax
+f010bb36:	66 90                	xchg   %ax,%ax
+f010bb38:	66 90                	xchg   %ax,%ax
+f010bb3a:	66 90                	xchg   %ax,%ax
+f010bb3c:	66 90                	xchg   %ax,%ax
+f010bb3e:	66 90                	xchg   %ax,%ax
+f010bb40:	66 90                	xchg   %ax,%ax
+f010bb42:	66 90                	xchg   %ax,%ax
+f010bb44:	66 90                	xchg   %ax,%ax
+f010bb46:	66 90                	xchg   %ax,%ax
+f010bb48:	66 90                	xchg   %ax,%ax
+f010bb4a:	66 90                	xchg   %ax,%ax
+f010bb4c:	66 90                	xchg   %ax,%ax
+f010bb4e:	66 90                	xchg   %ax,%ax
+f010bb50:	66 90                	xchg   %ax,%ax
+f010bb52:	66 90                	xchg   %ax,%ax
+f010bb54:	66 90                	xchg   %ax,%ax
+f010bb56:	66 90                	xchg   %ax,%ax
+f010bb58:	66 90                	xchg   %ax,%ax
+f010bb5a:	66 90                	xchg   %ax,%ax
+f010bb5c:	66 90                	xchg   %ax,%ax
+f010bb5e:	66 90                	xchg   %ax,%ax
+f010bb60:	66 90                	xchg   %ax,%ax
+f010bb62:	66 90                	xchg   %ax,%ax
+f010bb64:	66 90                	xchg   %ax,%ax
+f010bb66:	66 90                	xchg   %ax,%ax
+f010bb68:	66 90                	xchg   %ax,%ax
+f010bb6a:	66 90                	xchg   %ax,%ax
+f010bb6c:	66 90                	xchg   %ax,%ax
+f010bb6e:	66 90                	xchg   %ax,%ax
+f010bb70:	66 90                	xchg   %ax,%ax
+f010bb72:	66 90                	xchg   %ax,%ax
+f010bb74:	66 90                	xchg   %ax,%ax
+f010bb76:	66 90                	xchg   %ax,%ax
+f010bb78:	66 90                	xchg   %ax,%ax
+f010bb7a:	66 90                	xchg   %ax,%ax
+f010bb7c:	66 90                	xchg   %ax,%ax
+f010bb7e:	66 90                	xchg   %ax,%ax
+f010bb80:	66 90                	xchg   %ax,%ax
+f010bb82:	66 90                	xchg   %ax,%ax
+f010bb84:	66 90                	xchg   %ax,%ax
+f010bb86:	66 90                	xchg   %ax,%ax
+f010bb88:	66 90                	xchg   %ax,%ax
+f010bb8a:	66 90                	xchg   %ax,%ax
+f010bb8c:	66 90                	xchg   %ax,%ax
+f010bb8e:	66 90                	xchg   %ax,%ax
+f010bb90:	66 90                	xchg   %ax,%ax
+f010bb92:	66 90                	xchg   %ax,%ax
+f010bb94:	66 90                	xchg   %ax,%ax
+f010bb96:	66 90                	xchg   %ax,%ax
+f010bb98:	66 90                	xchg   %ax,%ax
+f010bb9a:	66 90                	xchg   %ax,%ax
+f010bb9c:	66 90                	xchg   %ax,%ax
+f010bb9e:	66 90                	xchg   %ax,%ax
+f010bba0:	66 90                	xchg   %ax,%ax
+f010bba2:	66 90                	xchg   %ax,%ax
+f010bba4:	66 90                	xchg   %ax,%ax
+f010bba6:	66 90                	xchg   %ax,%ax
+f010bba8:	66 90                	xchg   %ax,%ax
+f010bbaa:	66 90                	xchg   %ax,%ax
+f010bbac:	66 90                	xchg   %ax,%ax
+f010bbae:	66 90                	xchg   %ax,%ax
+f010bbb0:	66 90                	xchg   %ax,%ax
+f010bbb2:	66 90                	xchg   %ax,%ax
+f010bbb4:	66 90                	xchg   %ax,%ax
+f010bbb6:	66 90                	xchg   %ax,%ax
+f010bbb8:	66 90                	xchg   %ax,%ax
+f010bbba:	66 90                	xchg   %ax,%ax
+f010bbbc:	66 90                	xchg   %ax,%ax
+f010bbbe:	66 90                	xchg   %ax,%ax
+f010bbc0:	66 90                	xchg   %ax,%ax
+f010bbc2:	66 90                	xchg   %ax,%ax
+f010bbc4:	66 90                	xchg   %ax,%ax
+f010bbc6:	66 90                	xchg   %ax,%ax
+f010bbc8:	66 90                	xchg   %ax,%ax
+f010bbca:	66 90                	xchg   %ax,%ax
+f010bbcc:	66 90                	xchg   %ax,%ax
+f010bbce:	66 90                	xchg   %ax,%ax
+f010bbd0:	66 90                	xchg   %ax,%ax
+f010bbd2:	66 90                	xchg   %ax,%ax
+f010bbd4:	66 90                	xchg   %ax,%ax
+f010bbd6:	66 90                	xchg   %ax,%ax
+f010bbd8:	66 90                	xchg   %ax,%ax
+f010bbda:	66 90                	xchg   %ax,%ax
+f010bbdc:	66 90                	xchg   %ax,%ax
+f010bbde:	66 90                	xchg   %ax,%ax
+f010bbe0:	66 90                	xchg   %ax,%ax
+f010bbe2:	66 90                	xchg   %ax,%ax
+f010bbe4:	66 90                	xchg   %ax,%ax
+f010bbe6:	66 90                	xchg   %ax,%ax
+f010bbe8:	66 90                	xchg   %ax,%ax
+f010bbea:	66 90                	xchg   %ax,%ax
+f010bbec:	66 90                	xchg   %ax,%ax
+f010bbee:	66 90                	xchg   %ax,%ax
+f010bbf0:	66 90                	xchg   %ax,%ax
+f010bbf2:	66 90                	xchg   %ax,%ax
+f010bbf4:	66 90                	xchg   %ax,%ax
+f010bbf6:	66 90                	xchg   %ax,%ax
+f010bbf8:	66 90                	xchg   %ax,%ax
+f010bbfa:	66 90                	xchg   %ax,%ax
+f010bbfc:	66 90                	xchg   %ax,%ax
+f010bbfe:	66 90                	xchg   %ax,%ax
+f010bc00:	66 90                	xchg   %ax,%ax
+f010bc02:	66 90                	xchg   %ax,%ax
+f010bc04:	66 90                	xchg   %ax,%ax
+f010bc06:	66 90                	xchg   %ax,%ax
+f010bc08:	66 90                	xchg   %ax,%ax
+f010bc0a:	66 90                	xchg   %ax,%ax
+f010bc0c:	66 90                	xchg   %ax,%ax
+f010bc0e:	66 90                	xchg   %ax,%ax
+f010bc10:	66 90                	xchg   %ax,%ax
+f010bc12:	66 90                	xchg   %ax,%ax
+f010bc14:	66 90                	xchg   %ax,%ax
+f010bc16:	66 90                	xchg   %ax,%ax
+f010bc18:	66 90                	xchg   %ax,%ax
+f010bc1a:	66 90                	xchg   %ax,%ax
+f010bc1c:	66 90                	xchg   %ax,%ax
+f010bc1e:	66 90                	xchg   %ax,%ax
+f010bc20:	66 90                	xchg   %ax,%ax
+f010bc22:	66 90                	xchg   %ax,%ax
+f010bc24:	66 90                	xchg   %ax,%ax
+f010bc26:	66 90                	xchg   %ax,%ax
+f010bc28:	66 90                	xchg   %ax,%ax
+f010bc2a:	66 90                	xchg   %ax,%ax
+f010bc2c:	66 90                	xchg   %ax,%ax
+f010bc2e:	66 90                	xchg   %ax,%ax
+f010bc30:	66 90                	xchg   %ax,%ax
+f010bc32:	66 90                	xchg   %ax,%ax
+f010bc34:	66 90                	xchg   %ax,%ax
+f010bc36:	66 90                	xchg   %ax,%ax
+f010bc38:	66 90                	xchg   %ax,%ax
+f010bc3a:	66 90                	xchg   %ax,%ax
+f010bc3c:	66 90                	xchg   %ax,%ax
+f010bc3e:	66 90                	xchg   %ax,%ax
+f010bc40:	66 90                	xchg   %ax,%ax
+f010bc42:	66 90                	xchg   %ax,%ax
+f010bc44:	66 90                	xchg   %ax,%ax
+f010bc46:	66 90                	xchg   %ax,%ax
+f010bc48:	66 90                	xchg   %ax,%ax
+f010bc4a:	66 90                	xchg   %ax,%ax
+f010bc4c:	66 90                	xchg   %ax,%ax
+f010bc4e:	66 90                	xchg   %ax,%ax
+f010bc50:	66 90                	xchg   %ax,%ax
+f010bc52:	66 90                	xchg   %ax,%ax
+f010bc54:	66 90                	xchg   %ax,%ax
+f010bc56:	66 90                	xchg   %ax,%ax
+f010bc58:	66 90                	xchg   %ax,%ax
+f010bc5a:	66 90                	xchg   %ax,%ax
+f010bc5c:	66 90                	xchg   %ax,%ax
+f010bc5e:	66 90                	xchg   %ax,%ax
+f010bc60:	66 90                	xchg   %ax,%ax
+f010bc62:	66 90                	xchg   %ax,%ax
+f010bc64:	66 90                	xchg   %ax,%ax
+f010bc66:	66 90                	xchg   %ax,%ax
+f010bc68:	66 90                	xchg   %ax,%ax
+f010bc6a:	66 90                	xchg   %ax,%ax
+f010bc6c:	66 90                	xchg   %ax,%ax
+f010bc6e:	66 90                	xchg   %ax,%ax
+f010bc70:	66 90                	xchg   %ax,%ax
+f010bc72:	66 90                	xchg   %ax,%ax
+f010bc74:	66 90                	xchg   %ax,%ax
+f010bc76:	66 90                	xchg   %ax,%ax
+f010bc78:	66 90                	xchg   %ax,%ax
+f010bc7a:	66 90                	xchg   %ax,%ax
+f010bc7c:	66 90                	xchg   %ax,%ax
+f010bc7e:	66 90                	xchg   %ax,%ax
+f010bc80:	66 90                	xchg   %ax,%ax
+f010bc82:	66 90                	xchg   %ax,%ax
+f010bc84:	66 90                	xchg   %ax,%ax
+f010bc86:	66 90                	xchg   %ax,%ax
+f010bc88:	66 90                	xchg   %ax,%ax
+f010bc8a:	66 90                	xchg   %ax,%ax
+f010bc8c:	66 90                	xchg   %ax,%ax
+f010bc8e:	66 90                	xchg   %ax,%ax
+f010bc90:	66 90                	xchg   %ax,%ax
+f010bc92:	66 90                	xchg   %ax,%ax
+f010bc94:	66 90                	xchg   %ax,%ax
+f010bc96:	66 90                	xchg   %ax,%ax
+f010bc98:	66 90                	xchg   %ax,%ax
+f010bc9a:	66 90                	xchg   %ax,%ax
+f010bc9c:	66 90                	xchg   %ax,%ax
+f010bc9e:	66 90                	xchg   %ax,%ax
+f010bca0:	66 90                	xchg   %ax,%ax
+f010bca2:	66 90                	xchg   %ax,%ax
+f010bca4:	66 90                	xchg   %ax,%ax
+f010bca6:	66 90                	xchg   %ax,%ax
+f010bca8:	66 90                	xchg   %ax,%ax
+f010bcaa:	66 90                	xchg   %ax,%ax
+f010bcac:	66 90                	xchg   %ax,%ax
+f010bcae:	66 90                	xchg   %ax,%ax
+f010bcb0:	66 90                	xchg   %ax,%ax
+f010bcb2:	66 90                	xchg   %ax,%ax
+f010bcb4:	66 90                	xchg   %ax,%ax
+f010bcb6:	66 90                	xchg   %ax,%ax
+f010bcb8:	66 90                	xchg   %ax,%ax
+f010bcba:	66 90                	xchg   %ax,%ax
+f010bcbc:	66 90                	xchg   %ax,%ax
+f010bcbe:	66 90                	xchg   %ax,%ax
+f010bcc0:	66 90                	xchg   %ax,%ax
+f010bcc2:	66 90                	xchg   %ax,%ax
+f010bcc4:	66 90                	xchg   %ax,%ax
+f010bcc6:	66 90                	xchg   %ax,%ax
+f010bcc8:	66 90                	xchg   %ax,%ax
+f010bcca:	66 90                	xchg   %ax,%ax
+f010bccc:	66 90                	xchg   %ax,%ax
+f010bcce:	66 90                	xchg   %ax,%ax
+f010bcd0:	66 90                	xchg   %ax,%ax
+f010bcd2:	66 90                	xchg   %ax,%ax
+f010bcd4:	66 90                	xchg   %ax,%ax
+f010bcd6:	66 90                	xchg   %ax,%ax
+f010bcd8:	66 90                	xchg   %ax,%ax
+f010bcda:	66 90                	xchg   %ax,%ax
+f010bcdc:	66 90                	xchg   %ax,%ax
+f010bcde:	66 90                	xchg   %ax,%ax
+f010bce0:	66 90                	xchg   %ax,%ax
+f010bce2:	66 90                	xchg   %ax,%ax
+f010bce4:	66 90                	xchg   %ax,%ax
+f010bce6:	66 90                	xchg   %ax,%ax
+f010bce8:	66 90                	xchg   %ax,%ax
+f010bcea:	66 90                	xchg   %ax,%ax
+f010bcec:	66 90                	xchg   %ax,%ax
+f010bcee:	66 90                	xchg   %ax,%ax
+f010bcf0:	66 90                	xchg   %ax,%ax
+f010bcf2:	66 90                	xchg   %ax,%ax
+f010bcf4:	66 90                	xchg   %ax,%ax
+f010bcf6:	66 90                	xchg   %ax,%ax
+f010bcf8:	66 90                	xchg   %ax,%ax
+f010bcfa:	66 90                	xchg   %ax,%ax
+f010bcfc:	66 90                	xchg   %ax,%ax
+f010bcfe:	66 90                	xchg   %ax,%ax
+f010bd00:	66 90                	xchg   %ax,%ax
+f010bd02:	66 90                	xchg   %ax,%ax
+f010bd04:	66 90                	xchg   %ax,%ax
+f010bd06:	66 90                	xchg   %ax,%ax
+f010bd08:	66 90                	xchg   %ax,%ax
+f010bd0a:	66 90                	xchg   %ax,%ax
+f010bd0c:	66 90                	xchg   %ax,%ax
+f010bd0e:	66 90                	xchg   %ax,%ax
+f010bd10:	66 90                	xchg   %ax,%ax
+f010bd12:	66 90                	xchg   %ax,%ax
+f010bd14:	66 90                	xchg   %ax,%ax
+f010bd16:	66 90                	xchg   %ax,%ax
+f010bd18:	66 90                	xchg   %ax,%ax
+f010bd1a:	66 90                	xchg   %ax,%ax
+f010bd1c:	66 90                	xchg   %ax,%ax
+f010bd1e:	66 90                	xchg   %ax,%ax
+f010bd20:	66 90                	xchg   %ax,%ax
+f010bd22:	66 90                	xchg   %ax,%ax
+f010bd24:	66 90                	xchg   %ax,%ax
+f010bd26:	66 90                	xchg   %ax,%ax
+f010bd28:	66 90                	xchg   %ax,%ax
+f010bd2a:	66 90                	xchg   %ax,%ax
+f010bd2c:	66 90                	xchg   %ax,%ax
+f010bd2e:	66 90                	xchg   %ax,%ax
+f010bd30:	66 90                	xchg   %ax,%ax
+f010bd32:	66 90                	xchg   %ax,%ax
+f010bd34:	66 90                	xchg   %ax,%ax
+f010bd36:	66 90                	xchg   %ax,%ax
+f010bd38:	66 90                	xchg   %ax,%ax
+f010bd3a:	66 90                	xchg   %ax,%ax
+f010bd3c:	66 90                	xchg   %ax,%ax
+f010bd3e:	66 90                	xchg   %ax,%ax
+f010bd40:	66 90                	xchg   %ax,%ax
+f010bd42:	66 90                	xchg   %ax,%ax
+f010bd44:	66 90                	xchg   %ax,%ax
+f010bd46:	66 90                	xchg   %ax,%ax
+f010bd48:	66 90                	xchg   %ax,%ax
+f010bd4a:	66 90                	xchg   %ax,%ax
+f010bd4c:	66 90                	xchg   %ax,%ax
+f010bd4e:	66 90                	xchg   %ax,%ax
+f010bd50:	66 90                	xchg   %ax,%ax
+f010bd52:	66 90                	xchg   %ax,%ax
+f010bd54:	66 90                	xchg   %ax,%ax
+f010bd56:	66 90                	xchg   %ax,%ax
+f010bd58:	66 90                	xchg   %ax,%ax
+f010bd5a:	66 90                	xchg   %ax,%ax
+f010bd5c:	66 90                	xchg   %ax,%ax
+f010bd5e:	66 90                	xchg   %ax,%ax
+f010bd60:	66 90                	xchg   %ax,%ax
+f010bd62:	66 90                	xchg   %ax,%ax
+f010bd64:	66 90                	xchg   %ax,%ax
+f010bd66:	66 90                	xchg   %ax,%ax
+f010bd68:	66 90                	xchg   %ax,%ax
+f010bd6a:	66 90                	xchg   %ax,%ax
+f010bd6c:	66 90                	xchg   %ax,%ax
+f010bd6e:	66 90                	xchg   %ax,%ax
+f010bd70:	66 90                	xchg   %ax,%ax
+f010bd72:	66 90                	xchg   %ax,%ax
+f010bd74:	66 90                	xchg   %ax,%ax
+f010bd76:	66 90                	xchg   %ax,%ax
+f010bd78:	66 90                	xchg   %ax,%ax
+f010bd7a:	66 90                	xchg   %ax,%ax
+f010bd7c:	66 90                	xchg   %ax,%ax
+f010bd7e:	66 90                	xchg   %ax,%ax
+f010bd80:	66 90                	xchg   %ax,%ax
+f010bd82:	66 90                	xchg   %ax,%ax
+f010bd84:	66 90                	xchg   %ax,%ax
+f010bd86:	66 90                	xchg   %ax,%ax
+f010bd88:	66 90                	xchg   %ax,%ax
+f010bd8a:	66 90                	xchg   %ax,%ax
+f010bd8c:	66 90                	xchg   %ax,%ax
+f010bd8e:	66 90                	xchg   %ax,%ax
+f010bd90:	66 90                	xchg   %ax,%ax
+f010bd92:	66 90                	xchg   %ax,%ax
+f010bd94:	66 90                	xchg   %ax,%ax
+f010bd96:	66 90                	xchg   %ax,%ax
+f010bd98:	66 90                	xchg   %ax,%ax
+f010bd9a:	66 90                	xchg   %ax,%ax
+f010bd9c:	66 90                	xchg   %ax,%ax
+f010bd9e:	66 90                	xchg   %ax,%ax
+f010bda0:	66 90                	xchg   %ax,%ax
+f010bda2:	66 90                	xchg   %ax,%ax
+f010bda4:	66 90                	xchg   %ax,%ax
+f010bda6:	66 90                	xchg   %ax,%ax
+f010bda8:	66 90                	xchg   %ax,%ax
+f010bdaa:	66 90                	xchg   %ax,%ax
+f010bdac:	66 90                	xchg   %ax,%ax
+f010bdae:	66 90                	xchg   %ax,%ax
+f010bdb0:	66 90                	xchg   %ax,%ax
+f010bdb2:	66 90                	xchg   %ax,%ax
+f010bdb4:	66 90                	xchg   %ax,%ax
+f010bdb6:	66 90                	xchg   %ax,%ax
+f010bdb8:	66 90                	xchg   %ax,%ax
+f010bdba:	66 90                	xchg   %ax,%ax
+f010bdbc:	66 90                	xchg   %ax,%ax
+f010bdbe:	66 90                	xchg   %ax,%ax
+f010bdc0:	66 90                	xchg   %ax,%ax
+f010bdc2:	66 90                	xchg   %ax,%ax
+f010bdc4:	66 90                	xchg   %ax,%ax
+f010bdc6:	66 90                	xchg   %ax,%ax
+f010bdc8:	66 90                	xchg   %ax,%ax
+f010bdca:	66 90                	xchg   %ax,%ax
+f010bdcc:	66 90                	xchg   %ax,%ax
+f010bdce:	66 90                	xchg   %ax,%ax
+f010bdd0:	66 90                	xchg   %ax,%ax
+f010bdd2:	66 90                	xchg   %ax,%ax
+f010bdd4:	66 90                	xchg   %ax,%ax
+f010bdd6:	66 90                	xchg   %ax,%ax
+f010bdd8:	66 90                	xchg   %ax,%ax
+f010bdda:	66 90                	xchg   %ax,%ax
+f010bddc:	66 90                	xchg   %ax,%ax
+f010bdde:	66 90                	xchg   %ax,%ax
+f010bde0:	66 90                	xchg   %ax,%ax
+f010bde2:	66 90                	xchg   %ax,%ax
+f010bde4:	66 90                	xchg   %ax,%ax
+f010bde6:	66 90                	xchg   %ax,%ax
+f010bde8:	66 90                	xchg   %ax,%ax
+f010bdea:	66 90                	xchg   %ax,%ax
+f010bdec:	66 90                	xchg   %ax,%ax
+f010bdee:	66 90                	xchg   %ax,%ax
+f010bdf0:	66 90                	xchg   %ax,%ax
+f010bdf2:	66 90                	xchg   %ax,%ax
+f010bdf4:	66 90                	xchg   %ax,%ax
+f010bdf6:	66 90                	xchg   %ax,%ax
+f010bdf8:	66 90                	xchg   %ax,%ax
+f010bdfa:	66 90                	xchg   %ax,%ax
+f010bdfc:	66 90                	xchg   %ax,%ax
+f010bdfe:	66 90                	xchg   %ax,%ax
+f010be00:	66 90                	xchg   %ax,%ax
+f010be02:	66 90                	xchg   %ax,%ax
+f010be04:	66 90                	xchg   %ax,%ax
+f010be06:	66 90                	xchg   %ax,%ax
+f010be08:	66 90                	xchg   %ax,%ax
+f010be0a:	66 90                	xchg   %ax,%ax
+f010be0c:	66 90                	xchg   %ax,%ax
+f010be0e:	66 90                	xchg   %ax,%ax
+f010be10:	66 90                	xchg   %ax,%ax
+f010be12:	66 90                	xchg   %ax,%ax
+f010be14:	66 90                	xchg   %ax,%ax
+f010be16:	66 90                	xchg   %ax,%ax
+f010be18:	66 90                	xchg   %ax,%ax
+f010be1a:	66 90                	xchg   %ax,%ax
+f010be1c:	66 90                	xchg   %ax,%ax
+f010be1e:	66 90                	xchg   %ax,%ax
+f010be20:	66 90                	xchg   %ax,%ax
+f010be22:	66 90                	xchg   %ax,%ax
+f010be24:	66 90                	xchg   %ax,%ax
+f010be26:	66 90                	xchg   %ax,%ax
+f010be28:	66 90                	xchg   %ax,%ax
+f010be2a:	66 90                	xchg   %ax,%ax
+f010be2c:	66 90                	xchg   %ax,%ax
+f010be2e:	66 90                	xchg   %ax,%ax
+f010be30:	66 90                	xchg   %ax,%ax
+f010be32:	66 90                	xchg   %ax,%ax
+f010be34:	66 90                	xchg   %ax,%ax
+f010be36:	66 90                	xchg   %ax,%ax
+f010be38:	66 90                	xchg   %ax,%ax
+f010be3a:	66 90                	xchg   %ax,%ax
+f010be3c:	66 90                	xchg   %ax,%ax
+f010be3e:	66 90                	xchg   %ax,%ax
+f010be40:	66 90                	xchg   %ax,%ax
+f010be42:	66 90                	xchg   %ax,%ax
+f010be44:	66 90                	xchg   %ax,%ax
+f010be46:	66 90                	xchg   %ax,%ax
+f010be48:	66 90                	xchg   %ax,%ax
+f010be4a:	66 90                	xchg   %ax,%ax
+f010be4c:	66 90                	xchg   %ax,%ax
+f010be4e:	66 90                	xchg   %ax,%ax
+f010be50:	66 90                	xchg   %ax,%ax
+f010be52:	66 90                	xchg   %ax,%ax
+f010be54:	66 90                	xchg   %ax,%ax
+f010be56:	66 90                	xchg   %ax,%ax
+f010be58:	66 90                	xchg   %ax,%ax
+f010be5a:	66 90                	xchg   %ax,%ax
+f010be5c:	66 90                	xchg   %ax,%ax
+f010be5e:	66 90                	xchg   %ax,%ax
+f010be60:	66 90                	xchg   %ax,%ax
+f010be62:	66 90                	xchg   %ax,%ax
+f010be64:	66 90                	xchg   %ax,%ax
+f010be66:	66 90                	xchg   %ax,%ax
+f010be68:	66 90                	xchg   %ax,%ax
+f010be6a:	66 90                	xchg   %ax,%ax
+f010be6c:	66 90                	xchg   %ax,%ax
+f010be6e:	66 90                	xchg   %ax,%ax
+f010be70:	66 90                	xchg   %ax,%ax
+f010be72:	66 90                	xchg   %ax,%ax
+f010be74:	66 90                	xchg   %ax,%ax
+f010be76:	66 90                	xchg   %ax,%ax
+f010be78:	66 90                	xchg   %ax,%ax
+f010be7a:	66 90                	xchg   %ax,%ax
+f010be7c:	66 90                	xchg   %ax,%ax
+f010be7e:	66 90                	xchg   %ax,%ax
+f010be80:	66 90                	xchg   %ax,%ax
+f010be82:	66 90                	xchg   %ax,%ax
+f010be84:	66 90                	xchg   %ax,%ax
+f010be86:	66 90                	xchg   %ax,%ax
+f010be88:	66 90                	xchg   %ax,%ax
+f010be8a:	66 90                	xchg   %ax,%ax
+f010be8c:	66 90                	xchg   %ax,%ax
+f010be8e:	66 90                	xchg   %ax,%ax
+f010be90:	66 90                	xchg   %ax,%ax
+f010be92:	66 90                	xchg   %ax,%ax
+f010be94:	66 90                	xchg   %ax,%ax
+f010be96:	66 90                	xchg   %ax,%ax
+f010be98:	66 90                	xchg   %ax,%ax
+f010be9a:	66 90                	xchg   %ax,%ax
+f010be9c:	66 90                	xchg   %ax,%ax
+f010be9e:	66 90                	xchg   %ax,%ax
+f010bea0:	66 90                	xchg   %ax,%ax
+f010bea2:	66 90                	xchg   %ax,%ax
+f010bea4:	66 90                	xchg   %ax,%ax
+f010bea6:	66 90                	xchg   %ax,%ax
+f010bea8:	66 90                	xchg   %ax,%ax
+f010beaa:	66 90                	xchg   %ax,%ax
+f010beac:	66 90                	xchg   %ax,%ax
+f010beae:	66 90                	xchg   %ax,%ax
+f010beb0:	66 90                	xchg   %ax,%ax
+f010beb2:	66 90                	xchg   %ax,%ax
+f010beb4:	66 90                	xchg   %ax,%ax
+f010beb6:	66 90                	xchg   %ax,%ax
+f010beb8:	66 90                	xchg   %ax,%ax
+f010beba:	66 90                	xchg   %ax,%ax
+f010bebc:	66 90                	xchg   %ax,%ax
+f010bebe:	66 90                	xchg   %ax,%ax
+f010bec0:	66 90                	xchg   %ax,%ax
+f010bec2:	66 90                	xchg   %ax,%ax
+f010bec4:	66 90                	xchg   %ax,%ax
+f010bec6:	66 90                	xchg   %ax,%ax
+f010bec8:	66 90                	xchg   %ax,%ax
+f010beca:	66 90                	xchg   %ax,%ax
+f010becc:	66 90                	xchg   %ax,%ax
+f010bece:	66 90                	xchg   %ax,%ax
+f010bed0:	66 90                	xchg   %ax,%ax
+f010bed2:	66 90                	xchg   %ax,%ax
+f010bed4:	66 90                	xchg   %ax,%ax
+f010bed6:	66 90                	xchg   %ax,%ax
+f010bed8:	66 90                	xchg   %ax,%ax
+f010beda:	66 90                	xchg   %ax,%ax
+f010bedc:	66 90                	xchg   %ax,%ax
+f010bede:	66 90                	xchg   %ax,%ax
+f010bee0:	66 90                	xchg   %ax,%ax
+f010bee2:	66 90                	xchg   %ax,%ax
+f010bee4:	66 90                	xchg   %ax,%ax
+f010bee6:	66 90                	xchg   %ax,%ax
+f010bee8:	66 90                	xchg   %ax,%ax
+f010beea:	66 90                	xchg   %ax,%ax
+f010beec:	66 90                	xchg   %ax,%ax
+f010beee:	66 90                	xchg   %ax,%ax
+f010bef0:	66 90                	xchg   %ax,%ax
+f010bef2:	66 90                	xchg   %ax,%ax
+f010bef4:	66 90                	xchg   %ax,%ax
+f010bef6:	66 90                	xchg   %ax,%ax
+f010bef8:	66 90                	xchg   %ax,%ax
+f010befa:	66 90                	xchg   %ax,%ax
+f010befc:	66 90                	xchg   %ax,%ax
+f010befe:	66 90                	xchg   %ax,%ax
+f010bf00:	66 90                	xchg   %ax,%ax
+f010bf02:	66 90                	xchg   %ax,%ax
+f010bf04:	66 90                	xchg   %ax,%ax
+f010bf06:	66 90                	xchg   %ax,%ax
+f010bf08:	66 90                	xchg   %ax,%ax
+f010bf0a:	66 90                	xchg   %ax,%ax
+f010bf0c:	66 90                	xchg   %ax,%ax
+f010bf0e:	66 90                	xchg   %ax,%ax
+f010bf10:	66 90                	xchg   %ax,%ax
+f010bf12:	66 90                	xchg   %ax,%ax
+f010bf14:	66 90                	xchg   %ax,%ax
+f010bf16:	66 90                	xchg   %ax,%ax
+f010bf18:	66 90                	xchg   %ax,%ax
+f010bf1a:	66 90                	xchg   %ax,%ax
+f010bf1c:	66 90                	xchg   %ax,%ax
+f010bf1e:	66 90                	xchg   %ax,%ax
+f010bf20:	66 90                	xchg   %ax,%ax
+f010bf22:	66 90                	xchg   %ax,%ax
+f010bf24:	66 90                	xchg   %ax,%ax
+f010bf26:	66 90                	xchg   %ax,%ax
+f010bf28:	66 90                	xchg   %ax,%ax
+f010bf2a:	66 90                	xchg   %ax,%ax
+f010bf2c:	66 90                	xchg   %ax,%ax
+f010bf2e:	66 90                	xchg   %ax,%ax
+f010bf30:	66 90                	xchg   %ax,%ax
+f010bf32:	66 90                	xchg   %ax,%ax
+f010bf34:	66 90                	xchg   %ax,%ax
+f010bf36:	66 90                	xchg   %ax,%ax
+f010bf38:	66 90                	xchg   %ax,%ax
+f010bf3a:	66 90                	xchg   %ax,%ax
+f010bf3c:	66 90                	xchg   %ax,%ax
+f010bf3e:	66 90                	xchg   %ax,%ax
+f010bf40:	66 90                	xchg   %ax,%ax
+f010bf42:	66 90                	xchg   %ax,%ax
+f010bf44:	66 90                	xchg   %ax,%ax
+f010bf46:	66 90                	xchg   %ax,%ax
+f010bf48:	66 90                	xchg   %ax,%ax
+f010bf4a:	66 90                	xchg   %ax,%ax
+f010bf4c:	66 90                	xchg   %ax,%ax
+f010bf4e:	66 90                	xchg   %ax,%ax
+f010bf50:	66 90                	xchg   %ax,%ax
+f010bf52:	66 90                	xchg   %ax,%ax
+f010bf54:	66 90                	xchg   %ax,%ax
+f010bf56:	66 90                	xchg   %ax,%ax
+f010bf58:	66 90                	xchg   %ax,%ax
+f010bf5a:	66 90                	xchg   %ax,%ax
+f010bf5c:	66 90                	xchg   %ax,%ax
+f010bf5e:	66 90                	xchg   %ax,%ax
+f010bf60:	66 90                	xchg   %ax,%ax
+f010bf62:	66 90                	xchg   %ax,%ax
+f010bf64:	66 90                	xchg   %ax,%ax
+f010bf66:	66 90                	xchg   %ax,%ax
+f010bf68:	66 90                	xchg   %ax,%ax
+f010bf6a:	66 90                	xchg   %ax,%ax
+f010bf6c:	66 90                	xchg   %ax,%ax
+f010bf6e:	66 90                	xchg   %ax,%ax
+f010bf70:	66 90                	xchg   %ax,%ax
+f010bf72:	66 90                	xchg   %ax,%ax
+f010bf74:	66 90                	xchg   %ax,%ax
+f010bf76:	66 90                	xchg   %ax,%ax
+f010bf78:	66 90                	xchg   %ax,%ax
+f010bf7a:	66 90                	xchg   %ax,%ax
+f010bf7c:	66 90                	xchg   %ax,%ax
+f010bf7e:	66 90                	xchg   %ax,%ax
+f010bf80:	66 90                	xchg   %ax,%ax
+f010bf82:	66 90                	xchg   %ax,%ax
+f010bf84:	66 90                	xchg   %ax,%ax
+f010bf86:	66 90                	xchg   %ax,%ax
+f010bf88:	66 90                	xchg   %ax,%ax
+f010bf8a:	66 90                	xchg   %ax,%ax
+f010bf8c:	66 90                	xchg   %ax,%ax
+f010bf8e:	66 90                	xchg   %ax,%ax
+f010bf90:	66 90                	xchg   %ax,%ax
+f010bf92:	66 90                	xchg   %ax,%ax
+f010bf94:	66 90                	xchg   %ax,%ax
+f010bf96:	66 90                	xchg   %ax,%ax
+f010bf98:	66 90                	xchg   %ax,%ax
+f010bf9a:	66 90                	xchg   %ax,%ax
+f010bf9c:	66 90                	xchg   %ax,%ax
+f010bf9e:	66 90                	xchg   %ax,%ax
+f010bfa0:	66 90                	xchg   %ax,%ax
+f010bfa2:	66 90                	xchg   %ax,%ax
+f010bfa4:	66 90                	xchg   %ax,%ax
+f010bfa6:	66 90                	xchg   %ax,%ax
+f010bfa8:	66 90                	xchg   %ax,%ax
+f010bfaa:	66 90                	xchg   %ax,%ax
+f010bfac:	66 90                	xchg   %ax,%ax
+f010bfae:	66 90                	xchg   %ax,%ax
+f010bfb0:	66 90                	xchg   %ax,%ax
+f010bfb2:	66 90                	xchg   %ax,%ax
+f010bfb4:	66 90                	xchg   %ax,%ax
+f010bfb6:	66 90                	xchg   %ax,%ax
+f010bfb8:	66 90                	xchg   %ax,%ax
+f010bfba:	66 90                	xchg   %ax,%ax
+f010bfbc:	66 90                	xchg   %ax,%ax
+f010bfbe:	66 90                	xchg   %ax,%ax
+f010bfc0:	66 90                	xchg   %ax,%ax
+f010bfc2:	66 90                	xchg   %ax,%ax
+f010bfc4:	66 90                	xchg   %ax,%ax
+f010bfc6:	66 90                	xchg   %ax,%ax
+f010bfc8:	66 90                	xchg   %ax,%ax
+f010bfca:	66 90                	xchg   %ax,%ax
+f010bfcc:	66 90                	xchg   %ax,%ax
+f010bfce:	66 90                	xchg   %ax,%ax
+f010bfd0:	66 90                	xchg   %ax,%ax
+f010bfd2:	66 90                	xchg   %ax,%ax
+f010bfd4:	66 90                	xchg   %ax,%ax
+f010bfd6:	66 90                	xchg   %ax,%ax
+f010bfd8:	66 90                	xchg   %ax,%ax
+f010bfda:	66 90                	xchg   %ax,%ax
+f010bfdc:	66 90                	xchg   %ax,%ax
+f010bfde:	66 90                	xchg   %ax,%ax
+f010bfe0:	66 90                	xchg   %ax,%ax
+f010bfe2:	66 90                	xchg   %ax,%ax
+f010bfe4:	66 90                	xchg   %ax,%ax
+f010bfe6:	66 90                	xchg   %ax,%ax
+f010bfe8:	66 90                	xchg   %ax,%ax
+f010bfea:	66 90                	xchg   %ax,%ax
+f010bfec:	66 90                	xchg   %ax,%ax
+f010bfee:	66 90                	xchg   %ax,%ax
+f010bff0:	66 90                	xchg   %ax,%ax
+f010bff2:	66 90                	xchg   %ax,%ax
+f010bff4:	66 90                	xchg   %ax,%ax
+f010bff6:	66 90                	xchg   %ax,%ax
+f010bff8:	66 90                	xchg   %ax,%ax
+f010bffa:	66 90                	xchg   %ax,%ax
+f010bffc:	66 90                	xchg   %ax,%ax
+f010bffe:	66 90                	xchg   %ax,%ax
+
+f010c000 <bootstack>:
+	...
+
+f0114000 <gdt_pd>:
+f0114000:	a7 00 20 40 11 f0 00 00 00 00 00 00 00 00 00 00     .. @............
+	...
+
+f0114020 <gdt>:
+	...
+f0114028:	ff ff 00 00 00 9a cf 00 ff ff 00 00 00 92 cf 00     ................
+f0114038:	ff ff 00 00 00 fa cf 00 ff ff 00 00 00 f2 cf 00     ................
+	...
+f01140c8:	66 90 66 90 66 90 66 90 66 90 66 90 66 90 66 90     f.f.f.f.f.f.f.f.
+f01140d8:	66 90 66 90 66 90 66 90                             f.f.f.f.
+
+f01140e0 <idt_pd>:
+f01140e0:	ff 07 00 41 11 f0 00 00 00 00 00 00 00 00 00 00     ...A............
+	...
+
+f0114100 <idt>:
+	...
+
+f0114900 <cpus>:
+	...
@@ -0,0 +1,6646 @@
+
+obj/net/testinput:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 db 07 00 00       	call   80080c <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+	}
+}
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 7c             	sub    $0x7c,%esp
+	envid_t ns_envid = sys_getenvid();
+  80003c:	e8 70 12 00 00       	call   8012b1 <sys_getenvid>
+  800041:	89 c3                	mov    %eax,%ebx
+	int i, r, first = 1;
+
+	binaryname = "testinput";
+  800043:	c7 05 00 40 80 00 60 	movl   $0x803060,0x804000
+  80004a:	30 80 00 
+
+	output_envid = fork();
+  80004d:	e8 6b 16 00 00       	call   8016bd <fork>
+  800052:	a3 04 50 80 00       	mov    %eax,0x805004
+	if (output_envid < 0)
+  800057:	85 c0                	test   %eax,%eax
+  800059:	0f 88 7a 01 00 00    	js     8001d9 <umain+0x1a6>
+		panic("error forking");
+	else if (output_envid == 0) {
+  80005f:	0f 84 88 01 00 00    	je     8001ed <umain+0x1ba>
+		output(ns_envid);
+		return;
+	}
+
+	input_envid = fork();
+  800065:	e8 53 16 00 00       	call   8016bd <fork>
+  80006a:	a3 00 50 80 00       	mov    %eax,0x805000
+	if (input_envid < 0)
+  80006f:	85 c0                	test   %eax,%eax
+  800071:	0f 88 8a 01 00 00    	js     800201 <umain+0x1ce>
+		panic("error forking");
+	else if (input_envid == 0) {
+  800077:	0f 84 98 01 00 00    	je     800215 <umain+0x1e2>
+		input(ns_envid);
+		return;
+	}
+
+	cprintf("Sending ARP announcement...\n");
+  80007d:	83 ec 0c             	sub    $0xc,%esp
+  800080:	68 88 30 80 00       	push   $0x803088
+  800085:	e8 c0 08 00 00       	call   80094a <cprintf>
+	uint8_t mac[6] = {0x52, 0x54, 0x00, 0x12, 0x34, 0x56};
+  80008a:	c7 45 98 52 54 00 12 	movl   $0x12005452,-0x68(%ebp)
+  800091:	66 c7 45 9c 34 56    	movw   $0x5634,-0x64(%ebp)
+	uint32_t myip = inet_addr(IP);
+  800097:	c7 04 24 a5 30 80 00 	movl   $0x8030a5,(%esp)
+  80009e:	e8 2f 07 00 00       	call   8007d2 <inet_addr>
+  8000a3:	89 45 90             	mov    %eax,-0x70(%ebp)
+	uint32_t gwip = inet_addr(DEFAULT);
+  8000a6:	c7 04 24 af 30 80 00 	movl   $0x8030af,(%esp)
+  8000ad:	e8 20 07 00 00       	call   8007d2 <inet_addr>
+  8000b2:	89 45 94             	mov    %eax,-0x6c(%ebp)
+	if ((r = sys_page_alloc(0, pkt, PTE_P|PTE_U|PTE_W)) < 0)
+  8000b5:	83 c4 0c             	add    $0xc,%esp
+  8000b8:	6a 07                	push   $0x7
+  8000ba:	68 00 b0 fe 0f       	push   $0xffeb000
+  8000bf:	6a 00                	push   $0x0
+  8000c1:	e8 29 12 00 00       	call   8012ef <sys_page_alloc>
+  8000c6:	83 c4 10             	add    $0x10,%esp
+  8000c9:	85 c0                	test   %eax,%eax
+  8000cb:	0f 88 52 01 00 00    	js     800223 <umain+0x1f0>
+	pkt->jp_len = sizeof(*arp);
+  8000d1:	c7 05 00 b0 fe 0f 2a 	movl   $0x2a,0xffeb000
+  8000d8:	00 00 00 
+	memset(arp->ethhdr.dest.addr, 0xff, ETHARP_HWADDR_LEN);
+  8000db:	83 ec 04             	sub    $0x4,%esp
+  8000de:	6a 06                	push   $0x6
+  8000e0:	68 ff 00 00 00       	push   $0xff
+  8000e5:	68 04 b0 fe 0f       	push   $0xffeb004
+  8000ea:	e8 65 0f 00 00       	call   801054 <memset>
+	memcpy(arp->ethhdr.src.addr,  mac,  ETHARP_HWADDR_LEN);
+  8000ef:	83 c4 0c             	add    $0xc,%esp
+  8000f2:	6a 06                	push   $0x6
+  8000f4:	8d 5d 98             	lea    -0x68(%ebp),%ebx
+  8000f7:	53                   	push   %ebx
+  8000f8:	68 0a b0 fe 0f       	push   $0xffeb00a
+  8000fd:	e8 e9 0f 00 00       	call   8010eb <memcpy>
+	arp->ethhdr.type = htons(ETHTYPE_ARP);
+  800102:	c7 04 24 06 08 00 00 	movl   $0x806,(%esp)
+  800109:	e8 a6 04 00 00       	call   8005b4 <htons>
+  80010e:	66 a3 10 b0 fe 0f    	mov    %ax,0xffeb010
+	arp->hwtype = htons(1); // Ethernet
+  800114:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  80011b:	e8 94 04 00 00       	call   8005b4 <htons>
+  800120:	66 a3 12 b0 fe 0f    	mov    %ax,0xffeb012
+	arp->proto = htons(ETHTYPE_IP);
+  800126:	c7 04 24 00 08 00 00 	movl   $0x800,(%esp)
+  80012d:	e8 82 04 00 00       	call   8005b4 <htons>
+  800132:	66 a3 14 b0 fe 0f    	mov    %ax,0xffeb014
+	arp->_hwlen_protolen = htons((ETHARP_HWADDR_LEN << 8) | 4);
+  800138:	c7 04 24 04 06 00 00 	movl   $0x604,(%esp)
+  80013f:	e8 70 04 00 00       	call   8005b4 <htons>
+  800144:	66 a3 16 b0 fe 0f    	mov    %ax,0xffeb016
+	arp->opcode = htons(ARP_REQUEST);
+  80014a:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  800151:	e8 5e 04 00 00       	call   8005b4 <htons>
+  800156:	66 a3 18 b0 fe 0f    	mov    %ax,0xffeb018
+	memcpy(arp->shwaddr.addr,  mac,   ETHARP_HWADDR_LEN);
+  80015c:	83 c4 0c             	add    $0xc,%esp
+  80015f:	6a 06                	push   $0x6
+  800161:	53                   	push   %ebx
+  800162:	68 1a b0 fe 0f       	push   $0xffeb01a
+  800167:	e8 7f 0f 00 00       	call   8010eb <memcpy>
+	memcpy(arp->sipaddr.addrw, &myip, 4);
+  80016c:	83 c4 0c             	add    $0xc,%esp
+  80016f:	6a 04                	push   $0x4
+  800171:	8d 45 90             	lea    -0x70(%ebp),%eax
+  800174:	50                   	push   %eax
+  800175:	68 20 b0 fe 0f       	push   $0xffeb020
+  80017a:	e8 6c 0f 00 00       	call   8010eb <memcpy>
+	memset(arp->dhwaddr.addr,  0x00,  ETHARP_HWADDR_LEN);
+  80017f:	83 c4 0c             	add    $0xc,%esp
+  800182:	6a 06                	push   $0x6
+  800184:	6a 00                	push   $0x0
+  800186:	68 24 b0 fe 0f       	push   $0xffeb024
+  80018b:	e8 c4 0e 00 00       	call   801054 <memset>
+	memcpy(arp->dipaddr.addrw, &gwip, 4);
+  800190:	83 c4 0c             	add    $0xc,%esp
+  800193:	6a 04                	push   $0x4
+  800195:	8d 45 94             	lea    -0x6c(%ebp),%eax
+  800198:	50                   	push   %eax
+  800199:	68 2a b0 fe 0f       	push   $0xffeb02a
+  80019e:	e8 48 0f 00 00       	call   8010eb <memcpy>
+	ipc_send(output_envid, NSREQ_OUTPUT, pkt, PTE_P|PTE_W|PTE_U);
+  8001a3:	6a 07                	push   $0x7
+  8001a5:	68 00 b0 fe 0f       	push   $0xffeb000
+  8001aa:	6a 0b                	push   $0xb
+  8001ac:	ff 35 04 50 80 00    	push   0x805004
+  8001b2:	e8 96 17 00 00       	call   80194d <ipc_send>
+	sys_page_unmap(0, pkt);
+  8001b7:	83 c4 18             	add    $0x18,%esp
+  8001ba:	68 00 b0 fe 0f       	push   $0xffeb000
+  8001bf:	6a 00                	push   $0x0
+  8001c1:	e8 ae 11 00 00       	call   801374 <sys_page_unmap>
+}
+  8001c6:	83 c4 10             	add    $0x10,%esp
+	int i, r, first = 1;
+  8001c9:	bf 01 00 00 00       	mov    $0x1,%edi
+			out = buf + snprintf(buf, end - buf,
+  8001ce:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%ebp)
+}
+  8001d4:	e9 65 01 00 00       	jmp    80033e <umain+0x30b>
+		panic("error forking");
+  8001d9:	83 ec 04             	sub    $0x4,%esp
+  8001dc:	68 6a 30 80 00       	push   $0x80306a
+  8001e1:	6a 4d                	push   $0x4d
+  8001e3:	68 78 30 80 00       	push   $0x803078
+  8001e8:	e8 82 06 00 00       	call   80086f <_panic>
+		output(ns_envid);
+  8001ed:	83 ec 0c             	sub    $0xc,%esp
+  8001f0:	53                   	push   %ebx
+  8001f1:	e8 c4 02 00 00       	call   8004ba <output>
+		return;
+  8001f6:	83 c4 10             	add    $0x10,%esp
+		// we've received the ARP reply
+		if (first)
+			cprintf("Waiting for packets...\n");
+		first = 0;
+	}
+}
+  8001f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001fc:	5b                   	pop    %ebx
+  8001fd:	5e                   	pop    %esi
+  8001fe:	5f                   	pop    %edi
+  8001ff:	5d                   	pop    %ebp
+  800200:	c3                   	ret
+		panic("error forking");
+  800201:	83 ec 04             	sub    $0x4,%esp
+  800204:	68 6a 30 80 00       	push   $0x80306a
+  800209:	6a 55                	push   $0x55
+  80020b:	68 78 30 80 00       	push   $0x803078
+  800210:	e8 5a 06 00 00       	call   80086f <_panic>
+		input(ns_envid);
+  800215:	83 ec 0c             	sub    $0xc,%esp
+  800218:	53                   	push   %ebx
+  800219:	e8 19 02 00 00       	call   800437 <input>
+		return;
+  80021e:	83 c4 10             	add    $0x10,%esp
+  800221:	eb d6                	jmp    8001f9 <umain+0x1c6>
+		panic("sys_page_map: %e", r);
+  800223:	50                   	push   %eax
+  800224:	68 b8 30 80 00       	push   $0x8030b8
+  800229:	6a 19                	push   $0x19
+  80022b:	68 78 30 80 00       	push   $0x803078
+  800230:	e8 3a 06 00 00       	call   80086f <_panic>
+			panic("ipc_recv: %e", req);
+  800235:	50                   	push   %eax
+  800236:	68 c9 30 80 00       	push   $0x8030c9
+  80023b:	6a 64                	push   $0x64
+  80023d:	68 78 30 80 00       	push   $0x803078
+  800242:	e8 28 06 00 00       	call   80086f <_panic>
+			panic("IPC from unexpected environment %08x", whom);
+  800247:	52                   	push   %edx
+  800248:	68 20 31 80 00       	push   $0x803120
+  80024d:	6a 66                	push   $0x66
+  80024f:	68 78 30 80 00       	push   $0x803078
+  800254:	e8 16 06 00 00       	call   80086f <_panic>
+			panic("Unexpected IPC %d", req);
+  800259:	50                   	push   %eax
+  80025a:	68 d6 30 80 00       	push   $0x8030d6
+  80025f:	6a 68                	push   $0x68
+  800261:	68 78 30 80 00       	push   $0x803078
+  800266:	e8 04 06 00 00       	call   80086f <_panic>
+			out = buf + snprintf(buf, end - buf,
+  80026b:	83 ec 0c             	sub    $0xc,%esp
+  80026e:	53                   	push   %ebx
+  80026f:	68 e8 30 80 00       	push   $0x8030e8
+  800274:	68 f0 30 80 00       	push   $0x8030f0
+  800279:	6a 50                	push   $0x50
+  80027b:	8d 45 98             	lea    -0x68(%ebp),%eax
+  80027e:	50                   	push   %eax
+  80027f:	e8 2a 0c 00 00       	call   800eae <snprintf>
+  800284:	8d 4d 98             	lea    -0x68(%ebp),%ecx
+  800287:	8d 34 01             	lea    (%ecx,%eax,1),%esi
+  80028a:	83 c4 20             	add    $0x20,%esp
+  80028d:	eb 40                	jmp    8002cf <umain+0x29c>
+			cprintf("%.*s\n", out - buf, buf);
+  80028f:	83 ec 04             	sub    $0x4,%esp
+  800292:	8d 45 98             	lea    -0x68(%ebp),%eax
+  800295:	50                   	push   %eax
+  800296:	89 f0                	mov    %esi,%eax
+  800298:	8d 4d 98             	lea    -0x68(%ebp),%ecx
+  80029b:	29 c8                	sub    %ecx,%eax
+  80029d:	50                   	push   %eax
+  80029e:	68 ff 30 80 00       	push   $0x8030ff
+  8002a3:	e8 a2 06 00 00       	call   80094a <cprintf>
+  8002a8:	83 c4 10             	add    $0x10,%esp
+		if (i % 2 == 1)
+  8002ab:	89 da                	mov    %ebx,%edx
+  8002ad:	c1 ea 1f             	shr    $0x1f,%edx
+  8002b0:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+  8002b3:	83 e0 01             	and    $0x1,%eax
+  8002b6:	29 d0                	sub    %edx,%eax
+  8002b8:	83 f8 01             	cmp    $0x1,%eax
+  8002bb:	74 4e                	je     80030b <umain+0x2d8>
+		if (i % 16 == 7)
+  8002bd:	83 ff 07             	cmp    $0x7,%edi
+  8002c0:	74 51                	je     800313 <umain+0x2e0>
+	for (i = 0; i < len; i++) {
+  8002c2:	83 c3 01             	add    $0x1,%ebx
+  8002c5:	39 5d 84             	cmp    %ebx,-0x7c(%ebp)
+  8002c8:	7e 51                	jle    80031b <umain+0x2e8>
+		if (i % 16 == 0)
+  8002ca:	f6 c3 0f             	test   $0xf,%bl
+  8002cd:	74 9c                	je     80026b <umain+0x238>
+		out += snprintf(out, end - out, "%02x", ((uint8_t*)data)[i]);
+  8002cf:	0f b6 83 04 b0 fe 0f 	movzbl 0xffeb004(%ebx),%eax
+  8002d6:	50                   	push   %eax
+  8002d7:	68 fa 30 80 00       	push   $0x8030fa
+  8002dc:	8d 45 e8             	lea    -0x18(%ebp),%eax
+  8002df:	29 f0                	sub    %esi,%eax
+  8002e1:	50                   	push   %eax
+  8002e2:	56                   	push   %esi
+  8002e3:	e8 c6 0b 00 00       	call   800eae <snprintf>
+  8002e8:	01 c6                	add    %eax,%esi
+		if (i % 16 == 15 || i == len - 1)
+  8002ea:	89 d8                	mov    %ebx,%eax
+  8002ec:	c1 f8 1f             	sar    $0x1f,%eax
+  8002ef:	c1 e8 1c             	shr    $0x1c,%eax
+  8002f2:	8d 3c 03             	lea    (%ebx,%eax,1),%edi
+  8002f5:	83 e7 0f             	and    $0xf,%edi
+  8002f8:	29 c7                	sub    %eax,%edi
+  8002fa:	83 c4 10             	add    $0x10,%esp
+  8002fd:	83 ff 0f             	cmp    $0xf,%edi
+  800300:	74 8d                	je     80028f <umain+0x25c>
+  800302:	8b 45 80             	mov    -0x80(%ebp),%eax
+  800305:	39 c3                	cmp    %eax,%ebx
+  800307:	75 a2                	jne    8002ab <umain+0x278>
+  800309:	eb 84                	jmp    80028f <umain+0x25c>
+			*(out++) = ' ';
+  80030b:	c6 06 20             	movb   $0x20,(%esi)
+  80030e:	8d 76 01             	lea    0x1(%esi),%esi
+  800311:	eb aa                	jmp    8002bd <umain+0x28a>
+			*(out++) = ' ';
+  800313:	c6 06 20             	movb   $0x20,(%esi)
+  800316:	8d 76 01             	lea    0x1(%esi),%esi
+  800319:	eb a7                	jmp    8002c2 <umain+0x28f>
+		cprintf("\n");
+  80031b:	83 ec 0c             	sub    $0xc,%esp
+  80031e:	68 1b 31 80 00       	push   $0x80311b
+  800323:	e8 22 06 00 00       	call   80094a <cprintf>
+		if (first)
+  800328:	83 c4 10             	add    $0x10,%esp
+  80032b:	83 bd 7c ff ff ff 00 	cmpl   $0x0,-0x84(%ebp)
+  800332:	75 60                	jne    800394 <umain+0x361>
+		first = 0;
+  800334:	c7 85 7c ff ff ff 00 	movl   $0x0,-0x84(%ebp)
+  80033b:	00 00 00 
+		int32_t req = ipc_recv((int32_t *)&whom, pkt, &perm);
+  80033e:	83 ec 04             	sub    $0x4,%esp
+  800341:	8d 45 94             	lea    -0x6c(%ebp),%eax
+  800344:	50                   	push   %eax
+  800345:	68 00 b0 fe 0f       	push   $0xffeb000
+  80034a:	8d 45 90             	lea    -0x70(%ebp),%eax
+  80034d:	50                   	push   %eax
+  80034e:	e8 86 15 00 00       	call   8018d9 <ipc_recv>
+		if (req < 0)
+  800353:	83 c4 10             	add    $0x10,%esp
+  800356:	85 c0                	test   %eax,%eax
+  800358:	0f 88 d7 fe ff ff    	js     800235 <umain+0x202>
+		if (whom != input_envid)
+  80035e:	8b 55 90             	mov    -0x70(%ebp),%edx
+  800361:	3b 15 00 50 80 00    	cmp    0x805000,%edx
+  800367:	0f 85 da fe ff ff    	jne    800247 <umain+0x214>
+		if (req != NSREQ_INPUT)
+  80036d:	83 f8 0a             	cmp    $0xa,%eax
+  800370:	0f 85 e3 fe ff ff    	jne    800259 <umain+0x226>
+		hexdump("input: ", pkt->jp_data, pkt->jp_len);
+  800376:	8b 0d 00 b0 fe 0f    	mov    0xffeb000,%ecx
+	char *out = NULL;
+  80037c:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < len; i++) {
+  800381:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (i % 16 == 15 || i == len - 1)
+  800386:	8d 41 ff             	lea    -0x1(%ecx),%eax
+  800389:	89 45 80             	mov    %eax,-0x80(%ebp)
+  80038c:	89 4d 84             	mov    %ecx,-0x7c(%ebp)
+	for (i = 0; i < len; i++) {
+  80038f:	e9 31 ff ff ff       	jmp    8002c5 <umain+0x292>
+			cprintf("Waiting for packets...\n");
+  800394:	83 ec 0c             	sub    $0xc,%esp
+  800397:	68 05 31 80 00       	push   $0x803105
+  80039c:	e8 a9 05 00 00       	call   80094a <cprintf>
+  8003a1:	83 c4 10             	add    $0x10,%esp
+  8003a4:	eb 8e                	jmp    800334 <umain+0x301>
+
+008003a6 <timer>:
+#include "ns.h"
+
+void
+timer(envid_t ns_envid, uint32_t initial_to) {
+  8003a6:	55                   	push   %ebp
+  8003a7:	89 e5                	mov    %esp,%ebp
+  8003a9:	57                   	push   %edi
+  8003aa:	56                   	push   %esi
+  8003ab:	53                   	push   %ebx
+  8003ac:	83 ec 1c             	sub    $0x1c,%esp
+  8003af:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	uint32_t stop = sys_time_msec() + initial_to;
+  8003b2:	e8 6a 11 00 00       	call   801521 <sys_time_msec>
+  8003b7:	03 45 0c             	add    0xc(%ebp),%eax
+  8003ba:	89 c3                	mov    %eax,%ebx
+
+	binaryname = "ns_timer";
+  8003bc:	c7 05 00 40 80 00 45 	movl   $0x803145,0x804000
+  8003c3:	31 80 00 
+
+		ipc_send(ns_envid, NSREQ_TIMER, 0, 0);
+
+		while (1) {
+			uint32_t to, whom;
+			to = ipc_recv((int32_t *) &whom, 0, 0);
+  8003c6:	8d 7d e4             	lea    -0x1c(%ebp),%edi
+  8003c9:	eb 05                	jmp    8003d0 <timer+0x2a>
+			sys_yield();
+  8003cb:	e8 00 0f 00 00       	call   8012d0 <sys_yield>
+		while((r = sys_time_msec()) < stop && r >= 0) {
+  8003d0:	e8 4c 11 00 00       	call   801521 <sys_time_msec>
+  8003d5:	39 d8                	cmp    %ebx,%eax
+  8003d7:	73 16                	jae    8003ef <timer+0x49>
+  8003d9:	85 c0                	test   %eax,%eax
+  8003db:	79 ee                	jns    8003cb <timer+0x25>
+			panic("sys_time_msec: %e", r);
+  8003dd:	50                   	push   %eax
+  8003de:	68 4e 31 80 00       	push   $0x80314e
+  8003e3:	6a 0f                	push   $0xf
+  8003e5:	68 60 31 80 00       	push   $0x803160
+  8003ea:	e8 80 04 00 00       	call   80086f <_panic>
+		if (r < 0)
+  8003ef:	85 c0                	test   %eax,%eax
+  8003f1:	78 ea                	js     8003dd <timer+0x37>
+		ipc_send(ns_envid, NSREQ_TIMER, 0, 0);
+  8003f3:	6a 00                	push   $0x0
+  8003f5:	6a 00                	push   $0x0
+  8003f7:	6a 0c                	push   $0xc
+  8003f9:	56                   	push   %esi
+  8003fa:	e8 4e 15 00 00       	call   80194d <ipc_send>
+  8003ff:	83 c4 10             	add    $0x10,%esp
+			to = ipc_recv((int32_t *) &whom, 0, 0);
+  800402:	83 ec 04             	sub    $0x4,%esp
+  800405:	6a 00                	push   $0x0
+  800407:	6a 00                	push   $0x0
+  800409:	57                   	push   %edi
+  80040a:	e8 ca 14 00 00       	call   8018d9 <ipc_recv>
+  80040f:	89 c3                	mov    %eax,%ebx
+
+			if (whom != ns_envid) {
+  800411:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800414:	83 c4 10             	add    $0x10,%esp
+  800417:	39 f0                	cmp    %esi,%eax
+  800419:	75 09                	jne    800424 <timer+0x7e>
+				cprintf("NS TIMER: timer thread got IPC message from env %x not NS\n", whom);
+				continue;
+			}
+
+			stop = sys_time_msec() + to;
+  80041b:	e8 01 11 00 00       	call   801521 <sys_time_msec>
+  800420:	01 c3                	add    %eax,%ebx
+			break;
+  800422:	eb ac                	jmp    8003d0 <timer+0x2a>
+				cprintf("NS TIMER: timer thread got IPC message from env %x not NS\n", whom);
+  800424:	83 ec 08             	sub    $0x8,%esp
+  800427:	50                   	push   %eax
+  800428:	68 6c 31 80 00       	push   $0x80316c
+  80042d:	e8 18 05 00 00       	call   80094a <cprintf>
+				continue;
+  800432:	83 c4 10             	add    $0x10,%esp
+  800435:	eb cb                	jmp    800402 <timer+0x5c>
+
+00800437 <input>:
+#include "ns.h"
+
+extern union Nsipc nsipcbuf;
+
+void
+input(envid_t ns_envid) {
+  800437:	55                   	push   %ebp
+  800438:	89 e5                	mov    %esp,%ebp
+  80043a:	57                   	push   %edi
+  80043b:	56                   	push   %esi
+  80043c:	53                   	push   %ebx
+  80043d:	81 ec 0c 08 00 00    	sub    $0x80c,%esp
+  800443:	8b 7d 08             	mov    0x8(%ebp),%edi
+  binaryname = "ns_input";
+  800446:	c7 05 00 40 80 00 a7 	movl   $0x8031a7,0x804000
+  80044d:	31 80 00 
+  // another packet in to the same physical page.
+  char buf[2048];
+
+  for(;;) {
+    int len;
+    if ((len = sys_net_recv(buf, 0)) < 0) {
+  800450:	8d b5 e8 f7 ff ff    	lea    -0x818(%ebp),%esi
+  800456:	eb 0d                	jmp    800465 <input+0x2e>
+      sys_sleep(30);
+  800458:	83 ec 0c             	sub    $0xc,%esp
+  80045b:	6a 1e                	push   $0x1e
+  80045d:	e8 20 11 00 00       	call   801582 <sys_sleep>
+      continue;
+  800462:	83 c4 10             	add    $0x10,%esp
+    if ((len = sys_net_recv(buf, 0)) < 0) {
+  800465:	83 ec 08             	sub    $0x8,%esp
+  800468:	6a 00                	push   $0x0
+  80046a:	56                   	push   %esi
+  80046b:	e8 f1 10 00 00       	call   801561 <sys_net_recv>
+  800470:	89 c3                	mov    %eax,%ebx
+  800472:	83 c4 10             	add    $0x10,%esp
+  800475:	85 c0                	test   %eax,%eax
+  800477:	78 df                	js     800458 <input+0x21>
+    }
+    if (sys_page_alloc(0, &nsipcbuf, PTE_P | PTE_W | PTE_U) < 0)
+  800479:	83 ec 04             	sub    $0x4,%esp
+  80047c:	6a 07                	push   $0x7
+  80047e:	68 00 70 80 00       	push   $0x807000
+  800483:	6a 00                	push   $0x0
+  800485:	e8 65 0e 00 00       	call   8012ef <sys_page_alloc>
+  80048a:	83 c4 10             	add    $0x10,%esp
+  80048d:	85 c0                	test   %eax,%eax
+  80048f:	78 d4                	js     800465 <input+0x2e>
+      continue;
+    memmove(nsipcbuf.pkt.jp_data, buf, len);
+  800491:	83 ec 04             	sub    $0x4,%esp
+  800494:	53                   	push   %ebx
+  800495:	56                   	push   %esi
+  800496:	68 04 70 80 00       	push   $0x807004
+  80049b:	e8 e9 0b 00 00       	call   801089 <memmove>
+    nsipcbuf.pkt.jp_len = len;
+  8004a0:	89 1d 00 70 80 00    	mov    %ebx,0x807000
+    ipc_send(ns_envid, NSREQ_INPUT, &nsipcbuf, PTE_P | PTE_W | PTE_U);
+  8004a6:	6a 07                	push   $0x7
+  8004a8:	68 00 70 80 00       	push   $0x807000
+  8004ad:	6a 0a                	push   $0xa
+  8004af:	57                   	push   %edi
+  8004b0:	e8 98 14 00 00       	call   80194d <ipc_send>
+  8004b5:	83 c4 20             	add    $0x20,%esp
+  8004b8:	eb ab                	jmp    800465 <input+0x2e>
+
+008004ba <output>:
+#include "ns.h"
+
+extern union Nsipc nsipcbuf;
+
+void
+output(envid_t ns_envid) {
+  8004ba:	55                   	push   %ebp
+  8004bb:	89 e5                	mov    %esp,%ebp
+  8004bd:	56                   	push   %esi
+  8004be:	53                   	push   %ebx
+  8004bf:	83 ec 10             	sub    $0x10,%esp
+  binaryname = "ns_output";
+  8004c2:	c7 05 00 40 80 00 b0 	movl   $0x8031b0,0x804000
+  8004c9:	31 80 00 
+  int r;
+  envid_t whom;
+  int perm;
+
+  for (;;) {
+    r = ipc_recv(&whom, &nsipcbuf, &perm);
+  8004cc:	8d 75 f0             	lea    -0x10(%ebp),%esi
+  8004cf:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+  8004d2:	eb 1f                	jmp    8004f3 <output+0x39>
+    if (r != NSREQ_OUTPUT)
+      continue;
+    jifpkt = &nsipcbuf.pkt;
+    while (sys_net_send(jifpkt->jp_data, jifpkt->jp_len) < 0)
+      sys_yield();
+  8004d4:	e8 f7 0d 00 00       	call   8012d0 <sys_yield>
+    while (sys_net_send(jifpkt->jp_data, jifpkt->jp_len) < 0)
+  8004d9:	83 ec 08             	sub    $0x8,%esp
+  8004dc:	ff 35 00 70 80 00    	push   0x807000
+  8004e2:	68 04 70 80 00       	push   $0x807004
+  8004e7:	e8 54 10 00 00       	call   801540 <sys_net_send>
+  8004ec:	83 c4 10             	add    $0x10,%esp
+  8004ef:	85 c0                	test   %eax,%eax
+  8004f1:	78 e1                	js     8004d4 <output+0x1a>
+    r = ipc_recv(&whom, &nsipcbuf, &perm);
+  8004f3:	83 ec 04             	sub    $0x4,%esp
+  8004f6:	56                   	push   %esi
+  8004f7:	68 00 70 80 00       	push   $0x807000
+  8004fc:	53                   	push   %ebx
+  8004fd:	e8 d7 13 00 00       	call   8018d9 <ipc_recv>
+    if (r != NSREQ_OUTPUT)
+  800502:	83 c4 10             	add    $0x10,%esp
+  800505:	83 f8 0b             	cmp    $0xb,%eax
+  800508:	75 e9                	jne    8004f3 <output+0x39>
+  80050a:	eb cd                	jmp    8004d9 <output+0x1f>
+
+0080050c <inet_ntoa>:
+ * @return pointer to a global static (!) buffer that holds the ASCII
+ *         represenation of addr
+ */
+char *
+inet_ntoa(struct in_addr addr)
+{
+  80050c:	55                   	push   %ebp
+  80050d:	89 e5                	mov    %esp,%ebp
+  80050f:	57                   	push   %edi
+  800510:	56                   	push   %esi
+  800511:	53                   	push   %ebx
+  800512:	83 ec 1c             	sub    $0x1c,%esp
+  static char str[16];
+  u32_t s_addr = addr.s_addr;
+  800515:	8b 45 08             	mov    0x8(%ebp),%eax
+  800518:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  u8_t rem;
+  u8_t n;
+  u8_t i;
+
+  rp = str;
+  ap = (u8_t *)&s_addr;
+  80051b:	8d 7d f0             	lea    -0x10(%ebp),%edi
+  rp = str;
+  80051e:	b9 08 50 80 00       	mov    $0x805008,%ecx
+  for(n = 0; n < 4; n++) {
+    i = 0;
+    do {
+      rem = *ap % (u8_t)10;
+  800523:	be cd ff ff ff       	mov    $0xffffffcd,%esi
+  800528:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80052b:	eb 31                	jmp    80055e <inet_ntoa+0x52>
+      *ap /= (u8_t)10;
+      inv[i++] = '0' + rem;
+    } while(*ap);
+    while(i--)
+      *rp++ = inv[i];
+  80052d:	0f b6 c8             	movzbl %al,%ecx
+  800530:	0f b6 4c 0d ed       	movzbl -0x13(%ebp,%ecx,1),%ecx
+  800535:	88 0a                	mov    %cl,(%edx)
+  800537:	83 c2 01             	add    $0x1,%edx
+    while(i--)
+  80053a:	83 e8 01             	sub    $0x1,%eax
+  80053d:	3c ff                	cmp    $0xff,%al
+  80053f:	75 ec                	jne    80052d <inet_ntoa+0x21>
+  800541:	0f b6 db             	movzbl %bl,%ebx
+  800544:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  800547:	01 d8                	add    %ebx,%eax
+  800549:	89 c3                	mov    %eax,%ebx
+    *rp++ = '.';
+  80054b:	8d 40 01             	lea    0x1(%eax),%eax
+  80054e:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800551:	c6 03 2e             	movb   $0x2e,(%ebx)
+    ap++;
+  800554:	83 c7 01             	add    $0x1,%edi
+  for(n = 0; n < 4; n++) {
+  800557:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80055a:	39 c7                	cmp    %eax,%edi
+  80055c:	74 46                	je     8005a4 <inet_ntoa+0x98>
+  80055e:	0f b6 17             	movzbl (%edi),%edx
+    i = 0;
+  800561:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800566:	89 7d d8             	mov    %edi,-0x28(%ebp)
+      rem = *ap % (u8_t)10;
+  800569:	89 f0                	mov    %esi,%eax
+  80056b:	f6 e2                	mul    %dl
+  80056d:	66 c1 e8 0b          	shr    $0xb,%ax
+  800571:	88 45 e3             	mov    %al,-0x1d(%ebp)
+  800574:	8d 0c 80             	lea    (%eax,%eax,4),%ecx
+  800577:	01 c9                	add    %ecx,%ecx
+  800579:	89 d0                	mov    %edx,%eax
+  80057b:	29 c8                	sub    %ecx,%eax
+      *ap /= (u8_t)10;
+  80057d:	89 d7                	mov    %edx,%edi
+  80057f:	0f b6 55 e3          	movzbl -0x1d(%ebp),%edx
+      inv[i++] = '0' + rem;
+  800583:	89 d9                	mov    %ebx,%ecx
+  800585:	83 c3 01             	add    $0x1,%ebx
+  800588:	0f b6 c9             	movzbl %cl,%ecx
+  80058b:	83 c0 30             	add    $0x30,%eax
+  80058e:	88 44 0d ed          	mov    %al,-0x13(%ebp,%ecx,1)
+    } while(*ap);
+  800592:	89 f8                	mov    %edi,%eax
+  800594:	3c 09                	cmp    $0x9,%al
+  800596:	77 d1                	ja     800569 <inet_ntoa+0x5d>
+  800598:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  80059b:	88 17                	mov    %dl,(%edi)
+  80059d:	8b 55 dc             	mov    -0x24(%ebp),%edx
+      inv[i++] = '0' + rem;
+  8005a0:	89 d8                	mov    %ebx,%eax
+  8005a2:	eb 96                	jmp    80053a <inet_ntoa+0x2e>
+  }
+  *--rp = 0;
+  8005a4:	c6 03 00             	movb   $0x0,(%ebx)
+  return str;
+}
+  8005a7:	b8 08 50 80 00       	mov    $0x805008,%eax
+  8005ac:	83 c4 1c             	add    $0x1c,%esp
+  8005af:	5b                   	pop    %ebx
+  8005b0:	5e                   	pop    %esi
+  8005b1:	5f                   	pop    %edi
+  8005b2:	5d                   	pop    %ebp
+  8005b3:	c3                   	ret
+
+008005b4 <htons>:
+ * @param n u16_t in host byte order
+ * @return n in network byte order
+ */
+u16_t
+htons(u16_t n)
+{
+  8005b4:	55                   	push   %ebp
+  8005b5:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  8005b7:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  8005bb:	66 c1 c0 08          	rol    $0x8,%ax
+}
+  8005bf:	5d                   	pop    %ebp
+  8005c0:	c3                   	ret
+
+008005c1 <ntohs>:
+ * @param n u16_t in network byte order
+ * @return n in host byte order
+ */
+u16_t
+ntohs(u16_t n)
+{
+  8005c1:	55                   	push   %ebp
+  8005c2:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  8005c4:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  8005c8:	66 c1 c0 08          	rol    $0x8,%ax
+  return htons(n);
+}
+  8005cc:	5d                   	pop    %ebp
+  8005cd:	c3                   	ret
+
+008005ce <htonl>:
+ * @param n u32_t in host byte order
+ * @return n in network byte order
+ */
+u32_t
+htonl(u32_t n)
+{
+  8005ce:	55                   	push   %ebp
+  8005cf:	89 e5                	mov    %esp,%ebp
+  8005d1:	8b 55 08             	mov    0x8(%ebp),%edx
+  return ((n & 0xff) << 24) |
+  8005d4:	89 d0                	mov    %edx,%eax
+  8005d6:	c1 e0 18             	shl    $0x18,%eax
+    ((n & 0xff00) << 8) |
+    ((n & 0xff0000UL) >> 8) |
+    ((n & 0xff000000UL) >> 24);
+  8005d9:	89 d1                	mov    %edx,%ecx
+  8005db:	c1 e9 18             	shr    $0x18,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  8005de:	09 c8                	or     %ecx,%eax
+    ((n & 0xff00) << 8) |
+  8005e0:	89 d1                	mov    %edx,%ecx
+  8005e2:	c1 e1 08             	shl    $0x8,%ecx
+  8005e5:	81 e1 00 00 ff 00    	and    $0xff0000,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  8005eb:	09 c8                	or     %ecx,%eax
+  8005ed:	c1 ea 08             	shr    $0x8,%edx
+  8005f0:	81 e2 00 ff 00 00    	and    $0xff00,%edx
+  8005f6:	09 d0                	or     %edx,%eax
+}
+  8005f8:	5d                   	pop    %ebp
+  8005f9:	c3                   	ret
+
+008005fa <inet_aton>:
+{
+  8005fa:	55                   	push   %ebp
+  8005fb:	89 e5                	mov    %esp,%ebp
+  8005fd:	57                   	push   %edi
+  8005fe:	56                   	push   %esi
+  8005ff:	53                   	push   %ebx
+  800600:	83 ec 2c             	sub    $0x2c,%esp
+  800603:	8b 55 08             	mov    0x8(%ebp),%edx
+  c = *cp;
+  800606:	0f be 02             	movsbl (%edx),%eax
+  u32_t *pp = parts;
+  800609:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+      if (pp >= parts + 3)
+  80060c:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  80060f:	e9 9b 00 00 00       	jmp    8006af <inet_aton+0xb5>
+      c = *++cp;
+  800614:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+      if (c == 'x' || c == 'X') {
+  800618:	89 c1                	mov    %eax,%ecx
+  80061a:	83 e1 df             	and    $0xffffffdf,%ecx
+  80061d:	80 f9 58             	cmp    $0x58,%cl
+  800620:	74 10                	je     800632 <inet_aton+0x38>
+      c = *++cp;
+  800622:	83 c2 01             	add    $0x1,%edx
+  800625:	0f be c0             	movsbl %al,%eax
+        base = 8;
+  800628:	bf 08 00 00 00       	mov    $0x8,%edi
+  80062d:	e9 97 00 00 00       	jmp    8006c9 <inet_aton+0xcf>
+        c = *++cp;
+  800632:	0f be 42 02          	movsbl 0x2(%edx),%eax
+  800636:	8d 52 02             	lea    0x2(%edx),%edx
+        base = 16;
+  800639:	bf 10 00 00 00       	mov    $0x10,%edi
+  80063e:	e9 86 00 00 00       	jmp    8006c9 <inet_aton+0xcf>
+        val = (val * base) + (int)(c - '0');
+  800643:	0f af d7             	imul   %edi,%edx
+  800646:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+        c = *++cp;
+  80064a:	0f be 01             	movsbl (%ecx),%eax
+  80064d:	83 c1 01             	add    $0x1,%ecx
+      if (isdigit(c)) {
+  800650:	88 45 d7             	mov    %al,-0x29(%ebp)
+  800653:	8d 58 d0             	lea    -0x30(%eax),%ebx
+  800656:	80 fb 09             	cmp    $0x9,%bl
+  800659:	76 e8                	jbe    800643 <inet_aton+0x49>
+      } else if (base == 16 && isxdigit(c)) {
+  80065b:	83 ff 10             	cmp    $0x10,%edi
+  80065e:	75 2e                	jne    80068e <inet_aton+0x94>
+  800660:	0f b6 5d d7          	movzbl -0x29(%ebp),%ebx
+  800664:	8d 73 9f             	lea    -0x61(%ebx),%esi
+  800667:	83 e3 df             	and    $0xffffffdf,%ebx
+  80066a:	83 eb 41             	sub    $0x41,%ebx
+  80066d:	80 fb 05             	cmp    $0x5,%bl
+  800670:	77 1c                	ja     80068e <inet_aton+0x94>
+        val = (val << 4) | (int)(c + 10 - (islower(c) ? 'a' : 'A'));
+  800672:	c1 e2 04             	shl    $0x4,%edx
+  800675:	83 c0 0a             	add    $0xa,%eax
+  800678:	89 f3                	mov    %esi,%ebx
+  80067a:	80 fb 1a             	cmp    $0x1a,%bl
+  80067d:	19 db                	sbb    %ebx,%ebx
+  80067f:	83 e3 20             	and    $0x20,%ebx
+  800682:	83 c3 41             	add    $0x41,%ebx
+  800685:	29 d8                	sub    %ebx,%eax
+  800687:	09 c2                	or     %eax,%edx
+        c = *++cp;
+  800689:	0f be 01             	movsbl (%ecx),%eax
+  80068c:	eb bf                	jmp    80064d <inet_aton+0x53>
+    if (c == '.') {
+  80068e:	83 f8 2e             	cmp    $0x2e,%eax
+  800691:	75 43                	jne    8006d6 <inet_aton+0xdc>
+      if (pp >= parts + 3)
+  800693:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800696:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  800699:	39 f0                	cmp    %esi,%eax
+  80069b:	0f 84 22 01 00 00    	je     8007c3 <inet_aton+0x1c9>
+      *pp++ = val;
+  8006a1:	83 c0 04             	add    $0x4,%eax
+  8006a4:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8006a7:	89 50 fc             	mov    %edx,-0x4(%eax)
+      c = *++cp;
+  8006aa:	89 ca                	mov    %ecx,%edx
+  8006ac:	0f be 01             	movsbl (%ecx),%eax
+    if (!isdigit(c))
+  8006af:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8006b2:	80 f9 09             	cmp    $0x9,%cl
+  8006b5:	0f 87 01 01 00 00    	ja     8007bc <inet_aton+0x1c2>
+    base = 10;
+  8006bb:	bf 0a 00 00 00       	mov    $0xa,%edi
+    if (c == '0') {
+  8006c0:	83 f8 30             	cmp    $0x30,%eax
+  8006c3:	0f 84 4b ff ff ff    	je     800614 <inet_aton+0x1a>
+  8006c9:	8d 4a 01             	lea    0x1(%edx),%ecx
+        base = 8;
+  8006cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006d1:	e9 7a ff ff ff       	jmp    800650 <inet_aton+0x56>
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  8006d6:	0f b6 7d d7          	movzbl -0x29(%ebp),%edi
+  8006da:	89 d6                	mov    %edx,%esi
+  8006dc:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8006df:	85 c0                	test   %eax,%eax
+  8006e1:	74 2e                	je     800711 <inet_aton+0x117>
+    return (0);
+  8006e3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  8006e8:	89 fa                	mov    %edi,%edx
+  8006ea:	80 fa 1f             	cmp    $0x1f,%dl
+  8006ed:	0f 86 d5 00 00 00    	jbe    8007c8 <inet_aton+0x1ce>
+  8006f3:	84 c0                	test   %al,%al
+  8006f5:	0f 88 cd 00 00 00    	js     8007c8 <inet_aton+0x1ce>
+  8006fb:	8d 48 f7             	lea    -0x9(%eax),%ecx
+  8006fe:	83 f9 04             	cmp    $0x4,%ecx
+  800701:	76 0e                	jbe    800711 <inet_aton+0x117>
+    return (0);
+  800703:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  800708:	83 f8 20             	cmp    $0x20,%eax
+  80070b:	0f 85 b7 00 00 00    	jne    8007c8 <inet_aton+0x1ce>
+  n = pp - parts + 1;
+  800711:	8d 4d d8             	lea    -0x28(%ebp),%ecx
+  800714:	89 d8                	mov    %ebx,%eax
+  800716:	29 c8                	sub    %ecx,%eax
+  800718:	c1 f8 02             	sar    $0x2,%eax
+  80071b:	8d 48 01             	lea    0x1(%eax),%ecx
+  switch (n) {
+  80071e:	83 f8 02             	cmp    $0x2,%eax
+  800721:	74 7a                	je     80079d <inet_aton+0x1a3>
+  800723:	83 f9 03             	cmp    $0x3,%ecx
+  800726:	7f 49                	jg     800771 <inet_aton+0x177>
+  800728:	85 c9                	test   %ecx,%ecx
+  80072a:	0f 84 98 00 00 00    	je     8007c8 <inet_aton+0x1ce>
+  800730:	83 f9 02             	cmp    $0x2,%ecx
+  800733:	75 19                	jne    80074e <inet_aton+0x154>
+      return (0);
+  800735:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffffffUL)
+  80073a:	81 fe ff ff ff 00    	cmp    $0xffffff,%esi
+  800740:	0f 87 82 00 00 00    	ja     8007c8 <inet_aton+0x1ce>
+    val |= parts[0] << 24;
+  800746:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  800749:	c1 e0 18             	shl    $0x18,%eax
+  80074c:	09 c6                	or     %eax,%esi
+  return (1);
+  80074e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  if (addr)
+  800753:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800757:	74 6f                	je     8007c8 <inet_aton+0x1ce>
+    addr->s_addr = htonl(val);
+  800759:	83 ec 0c             	sub    $0xc,%esp
+  80075c:	56                   	push   %esi
+  80075d:	e8 6c fe ff ff       	call   8005ce <htonl>
+  800762:	83 c4 10             	add    $0x10,%esp
+  800765:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800768:	89 06                	mov    %eax,(%esi)
+  return (1);
+  80076a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80076f:	eb 57                	jmp    8007c8 <inet_aton+0x1ce>
+  switch (n) {
+  800771:	83 f9 04             	cmp    $0x4,%ecx
+  800774:	75 d8                	jne    80074e <inet_aton+0x154>
+      return (0);
+  800776:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xff)
+  80077b:	81 fe ff 00 00 00    	cmp    $0xff,%esi
+  800781:	77 45                	ja     8007c8 <inet_aton+0x1ce>
+    val |= (parts[0] << 24) | (parts[1] << 16) | (parts[2] << 8);
+  800783:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  800786:	c1 e0 18             	shl    $0x18,%eax
+  800789:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80078c:	c1 e1 10             	shl    $0x10,%ecx
+  80078f:	09 c8                	or     %ecx,%eax
+  800791:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  800794:	c1 e1 08             	shl    $0x8,%ecx
+  800797:	09 c8                	or     %ecx,%eax
+  800799:	09 c6                	or     %eax,%esi
+    break;
+  80079b:	eb b1                	jmp    80074e <inet_aton+0x154>
+      return (0);
+  80079d:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffff)
+  8007a2:	81 fe ff ff 00 00    	cmp    $0xffff,%esi
+  8007a8:	77 1e                	ja     8007c8 <inet_aton+0x1ce>
+    val |= (parts[0] << 24) | (parts[1] << 16);
+  8007aa:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8007ad:	c1 e0 18             	shl    $0x18,%eax
+  8007b0:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8007b3:	c1 e1 10             	shl    $0x10,%ecx
+  8007b6:	09 c8                	or     %ecx,%eax
+  8007b8:	09 c6                	or     %eax,%esi
+    break;
+  8007ba:	eb 92                	jmp    80074e <inet_aton+0x154>
+      return (0);
+  8007bc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007c1:	eb 05                	jmp    8007c8 <inet_aton+0x1ce>
+        return (0);
+  8007c3:	b9 00 00 00 00       	mov    $0x0,%ecx
+}
+  8007c8:	89 c8                	mov    %ecx,%eax
+  8007ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007cd:	5b                   	pop    %ebx
+  8007ce:	5e                   	pop    %esi
+  8007cf:	5f                   	pop    %edi
+  8007d0:	5d                   	pop    %ebp
+  8007d1:	c3                   	ret
+
+008007d2 <inet_addr>:
+{
+  8007d2:	55                   	push   %ebp
+  8007d3:	89 e5                	mov    %esp,%ebp
+  8007d5:	83 ec 20             	sub    $0x20,%esp
+  if (inet_aton(cp, &val)) {
+  8007d8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8007db:	50                   	push   %eax
+  8007dc:	ff 75 08             	push   0x8(%ebp)
+  8007df:	e8 16 fe ff ff       	call   8005fa <inet_aton>
+  8007e4:	89 c2                	mov    %eax,%edx
+  8007e6:	83 c4 10             	add    $0x10,%esp
+  return (INADDR_NONE);
+  8007e9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  if (inet_aton(cp, &val)) {
+  8007ee:	85 d2                	test   %edx,%edx
+  8007f0:	75 02                	jne    8007f4 <inet_addr+0x22>
+}
+  8007f2:	c9                   	leave
+  8007f3:	c3                   	ret
+    return (val.s_addr);
+  8007f4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007f7:	eb f9                	jmp    8007f2 <inet_addr+0x20>
+
+008007f9 <ntohl>:
+ * @param n u32_t in network byte order
+ * @return n in host byte order
+ */
+u32_t
+ntohl(u32_t n)
+{
+  8007f9:	55                   	push   %ebp
+  8007fa:	89 e5                	mov    %esp,%ebp
+  8007fc:	83 ec 14             	sub    $0x14,%esp
+  return htonl(n);
+  8007ff:	ff 75 08             	push   0x8(%ebp)
+  800802:	e8 c7 fd ff ff       	call   8005ce <htonl>
+  800807:	83 c4 10             	add    $0x10,%esp
+}
+  80080a:	c9                   	leave
+  80080b:	c3                   	ret
+
+0080080c <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  80080c:	55                   	push   %ebp
+  80080d:	89 e5                	mov    %esp,%ebp
+  80080f:	56                   	push   %esi
+  800810:	53                   	push   %ebx
+  800811:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800814:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  800817:	e8 95 0a 00 00       	call   8012b1 <sys_getenvid>
+  80081c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800821:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800824:	c1 e0 04             	shl    $0x4,%eax
+  800827:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80082c:	a3 20 50 80 00       	mov    %eax,0x805020
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800831:	85 db                	test   %ebx,%ebx
+  800833:	7e 07                	jle    80083c <libmain+0x30>
+    binaryname = argv[0];
+  800835:	8b 06                	mov    (%esi),%eax
+  800837:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  80083c:	83 ec 08             	sub    $0x8,%esp
+  80083f:	56                   	push   %esi
+  800840:	53                   	push   %ebx
+  800841:	e8 ed f7 ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  800846:	e8 0a 00 00 00       	call   800855 <exit>
+}
+  80084b:	83 c4 10             	add    $0x10,%esp
+  80084e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800851:	5b                   	pop    %ebx
+  800852:	5e                   	pop    %esi
+  800853:	5d                   	pop    %ebp
+  800854:	c3                   	ret
+
+00800855 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800855:	55                   	push   %ebp
+  800856:	89 e5                	mov    %esp,%ebp
+  800858:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80085b:	e8 54 13 00 00       	call   801bb4 <close_all>
+	sys_env_destroy(0);
+  800860:	83 ec 0c             	sub    $0xc,%esp
+  800863:	6a 00                	push   $0x0
+  800865:	e8 06 0a 00 00       	call   801270 <sys_env_destroy>
+}
+  80086a:	83 c4 10             	add    $0x10,%esp
+  80086d:	c9                   	leave
+  80086e:	c3                   	ret
+
+0080086f <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80086f:	55                   	push   %ebp
+  800870:	89 e5                	mov    %esp,%ebp
+  800872:	56                   	push   %esi
+  800873:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800874:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800877:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  80087d:	e8 2f 0a 00 00       	call   8012b1 <sys_getenvid>
+  800882:	83 ec 0c             	sub    $0xc,%esp
+  800885:	ff 75 0c             	push   0xc(%ebp)
+  800888:	ff 75 08             	push   0x8(%ebp)
+  80088b:	56                   	push   %esi
+  80088c:	50                   	push   %eax
+  80088d:	68 c4 31 80 00       	push   $0x8031c4
+  800892:	e8 b3 00 00 00       	call   80094a <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800897:	83 c4 18             	add    $0x18,%esp
+  80089a:	53                   	push   %ebx
+  80089b:	ff 75 10             	push   0x10(%ebp)
+  80089e:	e8 56 00 00 00       	call   8008f9 <vcprintf>
+	cprintf("\n");
+  8008a3:	c7 04 24 1b 31 80 00 	movl   $0x80311b,(%esp)
+  8008aa:	e8 9b 00 00 00       	call   80094a <cprintf>
+  8008af:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8008b2:	cc                   	int3
+	while (1)
+  8008b3:	eb fd                	jmp    8008b2 <_panic+0x43>
+
+008008b5 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8008b5:	55                   	push   %ebp
+  8008b6:	89 e5                	mov    %esp,%ebp
+  8008b8:	53                   	push   %ebx
+  8008b9:	83 ec 04             	sub    $0x4,%esp
+  8008bc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8008bf:	8b 13                	mov    (%ebx),%edx
+  8008c1:	8d 42 01             	lea    0x1(%edx),%eax
+  8008c4:	89 03                	mov    %eax,(%ebx)
+  8008c6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008c9:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8008cd:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8008d2:	74 09                	je     8008dd <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8008d4:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8008d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008db:	c9                   	leave
+  8008dc:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8008dd:	83 ec 08             	sub    $0x8,%esp
+  8008e0:	68 ff 00 00 00       	push   $0xff
+  8008e5:	8d 43 08             	lea    0x8(%ebx),%eax
+  8008e8:	50                   	push   %eax
+  8008e9:	e8 45 09 00 00       	call   801233 <sys_cputs>
+		b->idx = 0;
+  8008ee:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8008f4:	83 c4 10             	add    $0x10,%esp
+  8008f7:	eb db                	jmp    8008d4 <putch+0x1f>
+
+008008f9 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8008f9:	55                   	push   %ebp
+  8008fa:	89 e5                	mov    %esp,%ebp
+  8008fc:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800902:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800909:	00 00 00 
+	b.cnt = 0;
+  80090c:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800913:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800916:	ff 75 0c             	push   0xc(%ebp)
+  800919:	ff 75 08             	push   0x8(%ebp)
+  80091c:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800922:	50                   	push   %eax
+  800923:	68 b5 08 80 00       	push   $0x8008b5
+  800928:	e8 14 01 00 00       	call   800a41 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80092d:	83 c4 08             	add    $0x8,%esp
+  800930:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800936:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80093c:	50                   	push   %eax
+  80093d:	e8 f1 08 00 00       	call   801233 <sys_cputs>
+
+	return b.cnt;
+}
+  800942:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800948:	c9                   	leave
+  800949:	c3                   	ret
+
+0080094a <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80094a:	55                   	push   %ebp
+  80094b:	89 e5                	mov    %esp,%ebp
+  80094d:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800950:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800953:	50                   	push   %eax
+  800954:	ff 75 08             	push   0x8(%ebp)
+  800957:	e8 9d ff ff ff       	call   8008f9 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80095c:	c9                   	leave
+  80095d:	c3                   	ret
+
+0080095e <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80095e:	55                   	push   %ebp
+  80095f:	89 e5                	mov    %esp,%ebp
+  800961:	57                   	push   %edi
+  800962:	56                   	push   %esi
+  800963:	53                   	push   %ebx
+  800964:	83 ec 1c             	sub    $0x1c,%esp
+  800967:	89 c7                	mov    %eax,%edi
+  800969:	89 d6                	mov    %edx,%esi
+  80096b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80096e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800971:	89 d1                	mov    %edx,%ecx
+  800973:	89 c2                	mov    %eax,%edx
+  800975:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800978:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80097b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80097e:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800981:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800984:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80098b:	39 c2                	cmp    %eax,%edx
+  80098d:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800990:	72 3e                	jb     8009d0 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800992:	83 ec 0c             	sub    $0xc,%esp
+  800995:	ff 75 18             	push   0x18(%ebp)
+  800998:	83 eb 01             	sub    $0x1,%ebx
+  80099b:	53                   	push   %ebx
+  80099c:	50                   	push   %eax
+  80099d:	83 ec 08             	sub    $0x8,%esp
+  8009a0:	ff 75 e4             	push   -0x1c(%ebp)
+  8009a3:	ff 75 e0             	push   -0x20(%ebp)
+  8009a6:	ff 75 dc             	push   -0x24(%ebp)
+  8009a9:	ff 75 d8             	push   -0x28(%ebp)
+  8009ac:	e8 1f 23 00 00       	call   802cd0 <__udivdi3>
+  8009b1:	83 c4 18             	add    $0x18,%esp
+  8009b4:	52                   	push   %edx
+  8009b5:	50                   	push   %eax
+  8009b6:	89 f2                	mov    %esi,%edx
+  8009b8:	89 f8                	mov    %edi,%eax
+  8009ba:	e8 9f ff ff ff       	call   80095e <printnum>
+  8009bf:	83 c4 20             	add    $0x20,%esp
+  8009c2:	eb 13                	jmp    8009d7 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8009c4:	83 ec 08             	sub    $0x8,%esp
+  8009c7:	56                   	push   %esi
+  8009c8:	ff 75 18             	push   0x18(%ebp)
+  8009cb:	ff d7                	call   *%edi
+  8009cd:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8009d0:	83 eb 01             	sub    $0x1,%ebx
+  8009d3:	85 db                	test   %ebx,%ebx
+  8009d5:	7f ed                	jg     8009c4 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8009d7:	83 ec 08             	sub    $0x8,%esp
+  8009da:	56                   	push   %esi
+  8009db:	83 ec 04             	sub    $0x4,%esp
+  8009de:	ff 75 e4             	push   -0x1c(%ebp)
+  8009e1:	ff 75 e0             	push   -0x20(%ebp)
+  8009e4:	ff 75 dc             	push   -0x24(%ebp)
+  8009e7:	ff 75 d8             	push   -0x28(%ebp)
+  8009ea:	e8 b1 23 00 00       	call   802da0 <__umoddi3>
+  8009ef:	83 c4 14             	add    $0x14,%esp
+  8009f2:	0f be 80 e7 31 80 00 	movsbl 0x8031e7(%eax),%eax
+  8009f9:	50                   	push   %eax
+  8009fa:	ff d7                	call   *%edi
+}
+  8009fc:	83 c4 10             	add    $0x10,%esp
+  8009ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a02:	5b                   	pop    %ebx
+  800a03:	5e                   	pop    %esi
+  800a04:	5f                   	pop    %edi
+  800a05:	5d                   	pop    %ebp
+  800a06:	c3                   	ret
+
+00800a07 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800a07:	55                   	push   %ebp
+  800a08:	89 e5                	mov    %esp,%ebp
+  800a0a:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800a0d:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800a11:	8b 10                	mov    (%eax),%edx
+  800a13:	3b 50 04             	cmp    0x4(%eax),%edx
+  800a16:	73 0a                	jae    800a22 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800a18:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800a1b:	89 08                	mov    %ecx,(%eax)
+  800a1d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a20:	88 02                	mov    %al,(%edx)
+}
+  800a22:	5d                   	pop    %ebp
+  800a23:	c3                   	ret
+
+00800a24 <printfmt>:
+{
+  800a24:	55                   	push   %ebp
+  800a25:	89 e5                	mov    %esp,%ebp
+  800a27:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800a2a:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800a2d:	50                   	push   %eax
+  800a2e:	ff 75 10             	push   0x10(%ebp)
+  800a31:	ff 75 0c             	push   0xc(%ebp)
+  800a34:	ff 75 08             	push   0x8(%ebp)
+  800a37:	e8 05 00 00 00       	call   800a41 <vprintfmt>
+}
+  800a3c:	83 c4 10             	add    $0x10,%esp
+  800a3f:	c9                   	leave
+  800a40:	c3                   	ret
+
+00800a41 <vprintfmt>:
+{
+  800a41:	55                   	push   %ebp
+  800a42:	89 e5                	mov    %esp,%ebp
+  800a44:	57                   	push   %edi
+  800a45:	56                   	push   %esi
+  800a46:	53                   	push   %ebx
+  800a47:	83 ec 2c             	sub    $0x2c,%esp
+  800a4a:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a4d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800a50:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800a53:	eb 0a                	jmp    800a5f <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800a55:	83 ec 08             	sub    $0x8,%esp
+  800a58:	53                   	push   %ebx
+  800a59:	50                   	push   %eax
+  800a5a:	ff d6                	call   *%esi
+  800a5c:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800a5f:	83 c7 01             	add    $0x1,%edi
+  800a62:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800a66:	83 f8 25             	cmp    $0x25,%eax
+  800a69:	74 0c                	je     800a77 <vprintfmt+0x36>
+			if (ch == '\0')
+  800a6b:	85 c0                	test   %eax,%eax
+  800a6d:	75 e6                	jne    800a55 <vprintfmt+0x14>
+}
+  800a6f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a72:	5b                   	pop    %ebx
+  800a73:	5e                   	pop    %esi
+  800a74:	5f                   	pop    %edi
+  800a75:	5d                   	pop    %ebp
+  800a76:	c3                   	ret
+		padc = ' ';
+  800a77:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800a7b:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800a82:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800a89:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800a90:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800a95:	8d 47 01             	lea    0x1(%edi),%eax
+  800a98:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800a9b:	0f b6 17             	movzbl (%edi),%edx
+  800a9e:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800aa1:	3c 55                	cmp    $0x55,%al
+  800aa3:	0f 87 9a 03 00 00    	ja     800e43 <vprintfmt+0x402>
+  800aa9:	0f b6 c0             	movzbl %al,%eax
+  800aac:	ff 24 85 20 33 80 00 	jmp    *0x803320(,%eax,4)
+  800ab3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800ab6:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800aba:	eb d9                	jmp    800a95 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800abc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800abf:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800ac3:	eb d0                	jmp    800a95 <vprintfmt+0x54>
+  800ac5:	0f b6 d2             	movzbl %dl,%edx
+  800ac8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800acb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ad0:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800ad3:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800ad6:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800ada:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800add:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800ae0:	83 f9 09             	cmp    $0x9,%ecx
+  800ae3:	77 55                	ja     800b3a <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800ae5:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800ae8:	eb e9                	jmp    800ad3 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800aea:	8b 45 14             	mov    0x14(%ebp),%eax
+  800aed:	8b 00                	mov    (%eax),%eax
+  800aef:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800af2:	8b 45 14             	mov    0x14(%ebp),%eax
+  800af5:	8d 40 04             	lea    0x4(%eax),%eax
+  800af8:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800afb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800afe:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800b02:	79 91                	jns    800a95 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800b04:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800b07:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800b0a:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800b11:	eb 82                	jmp    800a95 <vprintfmt+0x54>
+			if (width < 0)
+  800b13:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800b16:	85 d2                	test   %edx,%edx
+  800b18:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b1d:	0f 49 c2             	cmovns %edx,%eax
+  800b20:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800b23:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800b26:	e9 6a ff ff ff       	jmp    800a95 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800b2b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800b2e:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800b35:	e9 5b ff ff ff       	jmp    800a95 <vprintfmt+0x54>
+  800b3a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800b3d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800b40:	eb bc                	jmp    800afe <vprintfmt+0xbd>
+			lflag++;
+  800b42:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800b45:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800b48:	e9 48 ff ff ff       	jmp    800a95 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800b4d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b50:	8d 78 04             	lea    0x4(%eax),%edi
+  800b53:	83 ec 08             	sub    $0x8,%esp
+  800b56:	53                   	push   %ebx
+  800b57:	ff 30                	push   (%eax)
+  800b59:	ff d6                	call   *%esi
+			break;
+  800b5b:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800b5e:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800b61:	e9 7c 02 00 00       	jmp    800de2 <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  800b66:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b69:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800b6c:	8b 10                	mov    (%eax),%edx
+  800b6e:	89 d0                	mov    %edx,%eax
+  800b70:	f7 d8                	neg    %eax
+  800b72:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800b75:	83 f8 10             	cmp    $0x10,%eax
+  800b78:	7f 23                	jg     800b9d <vprintfmt+0x15c>
+  800b7a:	8b 14 85 80 34 80 00 	mov    0x803480(,%eax,4),%edx
+  800b81:	85 d2                	test   %edx,%edx
+  800b83:	74 18                	je     800b9d <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800b85:	52                   	push   %edx
+  800b86:	68 dd 36 80 00       	push   $0x8036dd
+  800b8b:	53                   	push   %ebx
+  800b8c:	56                   	push   %esi
+  800b8d:	e8 92 fe ff ff       	call   800a24 <printfmt>
+  800b92:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800b95:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800b98:	e9 45 02 00 00       	jmp    800de2 <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  800b9d:	50                   	push   %eax
+  800b9e:	68 ff 31 80 00       	push   $0x8031ff
+  800ba3:	53                   	push   %ebx
+  800ba4:	56                   	push   %esi
+  800ba5:	e8 7a fe ff ff       	call   800a24 <printfmt>
+  800baa:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800bad:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800bb0:	e9 2d 02 00 00       	jmp    800de2 <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800bb5:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bb8:	83 c0 04             	add    $0x4,%eax
+  800bbb:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800bbe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bc1:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800bc3:	85 c9                	test   %ecx,%ecx
+  800bc5:	b8 f8 31 80 00       	mov    $0x8031f8,%eax
+  800bca:	0f 45 c1             	cmovne %ecx,%eax
+  800bcd:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800bd0:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800bd4:	7e 06                	jle    800bdc <vprintfmt+0x19b>
+  800bd6:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800bda:	75 0b                	jne    800be7 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800bdc:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800bdf:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800be2:	89 75 08             	mov    %esi,0x8(%ebp)
+  800be5:	eb 5c                	jmp    800c43 <vprintfmt+0x202>
+  800be7:	83 ec 08             	sub    $0x8,%esp
+  800bea:	ff 75 d0             	push   -0x30(%ebp)
+  800bed:	ff 75 cc             	push   -0x34(%ebp)
+  800bf0:	e8 eb 02 00 00       	call   800ee0 <strnlen>
+  800bf5:	89 c2                	mov    %eax,%edx
+  800bf7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800bfa:	29 d0                	sub    %edx,%eax
+  800bfc:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800bff:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800c03:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800c06:	89 75 08             	mov    %esi,0x8(%ebp)
+  800c09:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800c0b:	eb 0e                	jmp    800c1b <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800c0d:	83 ec 08             	sub    $0x8,%esp
+  800c10:	53                   	push   %ebx
+  800c11:	57                   	push   %edi
+  800c12:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800c15:	83 ee 01             	sub    $0x1,%esi
+  800c18:	83 c4 10             	add    $0x10,%esp
+  800c1b:	85 f6                	test   %esi,%esi
+  800c1d:	7f ee                	jg     800c0d <vprintfmt+0x1cc>
+  800c1f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800c22:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c25:	85 c0                	test   %eax,%eax
+  800c27:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c2c:	0f 49 d0             	cmovns %eax,%edx
+  800c2f:	29 d0                	sub    %edx,%eax
+  800c31:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800c34:	eb a6                	jmp    800bdc <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800c36:	83 ec 08             	sub    $0x8,%esp
+  800c39:	53                   	push   %ebx
+  800c3a:	52                   	push   %edx
+  800c3b:	ff 55 08             	call   *0x8(%ebp)
+  800c3e:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800c41:	89 f1                	mov    %esi,%ecx
+  800c43:	8d 71 01             	lea    0x1(%ecx),%esi
+  800c46:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800c4a:	0f be d0             	movsbl %al,%edx
+  800c4d:	85 d2                	test   %edx,%edx
+  800c4f:	74 28                	je     800c79 <vprintfmt+0x238>
+  800c51:	85 ff                	test   %edi,%edi
+  800c53:	78 05                	js     800c5a <vprintfmt+0x219>
+  800c55:	83 ef 01             	sub    $0x1,%edi
+  800c58:	78 30                	js     800c8a <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800c5a:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800c5e:	74 d6                	je     800c36 <vprintfmt+0x1f5>
+  800c60:	0f be c0             	movsbl %al,%eax
+  800c63:	83 e8 20             	sub    $0x20,%eax
+  800c66:	83 f8 5e             	cmp    $0x5e,%eax
+  800c69:	76 cb                	jbe    800c36 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800c6b:	83 ec 08             	sub    $0x8,%esp
+  800c6e:	53                   	push   %ebx
+  800c6f:	6a 3f                	push   $0x3f
+  800c71:	ff 55 08             	call   *0x8(%ebp)
+  800c74:	83 c4 10             	add    $0x10,%esp
+  800c77:	eb c8                	jmp    800c41 <vprintfmt+0x200>
+  800c79:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c7c:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800c7f:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800c82:	01 d0                	add    %edx,%eax
+  800c84:	29 c8                	sub    %ecx,%eax
+  800c86:	89 c7                	mov    %eax,%edi
+  800c88:	eb 13                	jmp    800c9d <vprintfmt+0x25c>
+  800c8a:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c8d:	eb ed                	jmp    800c7c <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800c8f:	83 ec 08             	sub    $0x8,%esp
+  800c92:	53                   	push   %ebx
+  800c93:	6a 20                	push   $0x20
+  800c95:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800c97:	83 ef 01             	sub    $0x1,%edi
+  800c9a:	83 c4 10             	add    $0x10,%esp
+  800c9d:	85 ff                	test   %edi,%edi
+  800c9f:	7f ee                	jg     800c8f <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800ca1:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800ca4:	89 45 14             	mov    %eax,0x14(%ebp)
+  800ca7:	e9 36 01 00 00       	jmp    800de2 <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  800cac:	83 f9 01             	cmp    $0x1,%ecx
+  800caf:	7f 1f                	jg     800cd0 <vprintfmt+0x28f>
+	else if (lflag)
+  800cb1:	85 c9                	test   %ecx,%ecx
+  800cb3:	74 67                	je     800d1c <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800cb5:	8b 45 14             	mov    0x14(%ebp),%eax
+  800cb8:	8b 00                	mov    (%eax),%eax
+  800cba:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800cbd:	89 c1                	mov    %eax,%ecx
+  800cbf:	c1 f9 1f             	sar    $0x1f,%ecx
+  800cc2:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800cc5:	8b 45 14             	mov    0x14(%ebp),%eax
+  800cc8:	8d 40 04             	lea    0x4(%eax),%eax
+  800ccb:	89 45 14             	mov    %eax,0x14(%ebp)
+  800cce:	eb 17                	jmp    800ce7 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800cd0:	8b 45 14             	mov    0x14(%ebp),%eax
+  800cd3:	8b 50 04             	mov    0x4(%eax),%edx
+  800cd6:	8b 00                	mov    (%eax),%eax
+  800cd8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800cdb:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800cde:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ce1:	8d 40 08             	lea    0x8(%eax),%eax
+  800ce4:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800ce7:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800cea:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800ced:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800cf2:	85 c9                	test   %ecx,%ecx
+  800cf4:	0f 89 ce 00 00 00    	jns    800dc8 <vprintfmt+0x387>
+				putch('-', putdat);
+  800cfa:	83 ec 08             	sub    $0x8,%esp
+  800cfd:	53                   	push   %ebx
+  800cfe:	6a 2d                	push   $0x2d
+  800d00:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800d02:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800d05:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800d08:	f7 da                	neg    %edx
+  800d0a:	83 d1 00             	adc    $0x0,%ecx
+  800d0d:	f7 d9                	neg    %ecx
+  800d0f:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800d12:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800d17:	e9 ac 00 00 00       	jmp    800dc8 <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  800d1c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d1f:	8b 00                	mov    (%eax),%eax
+  800d21:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800d24:	89 c1                	mov    %eax,%ecx
+  800d26:	c1 f9 1f             	sar    $0x1f,%ecx
+  800d29:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800d2c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d2f:	8d 40 04             	lea    0x4(%eax),%eax
+  800d32:	89 45 14             	mov    %eax,0x14(%ebp)
+  800d35:	eb b0                	jmp    800ce7 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800d37:	83 f9 01             	cmp    $0x1,%ecx
+  800d3a:	7f 1b                	jg     800d57 <vprintfmt+0x316>
+	else if (lflag)
+  800d3c:	85 c9                	test   %ecx,%ecx
+  800d3e:	74 2c                	je     800d6c <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  800d40:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d43:	8b 10                	mov    (%eax),%edx
+  800d45:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d4a:	8d 40 04             	lea    0x4(%eax),%eax
+  800d4d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800d50:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800d55:	eb 71                	jmp    800dc8 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  800d57:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d5a:	8b 10                	mov    (%eax),%edx
+  800d5c:	8b 48 04             	mov    0x4(%eax),%ecx
+  800d5f:	8d 40 08             	lea    0x8(%eax),%eax
+  800d62:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800d65:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800d6a:	eb 5c                	jmp    800dc8 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  800d6c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d6f:	8b 10                	mov    (%eax),%edx
+  800d71:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d76:	8d 40 04             	lea    0x4(%eax),%eax
+  800d79:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800d7c:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800d81:	eb 45                	jmp    800dc8 <vprintfmt+0x387>
+			putch('X', putdat);
+  800d83:	83 ec 08             	sub    $0x8,%esp
+  800d86:	53                   	push   %ebx
+  800d87:	6a 58                	push   $0x58
+  800d89:	ff d6                	call   *%esi
+			putch('X', putdat);
+  800d8b:	83 c4 08             	add    $0x8,%esp
+  800d8e:	53                   	push   %ebx
+  800d8f:	6a 58                	push   $0x58
+  800d91:	ff d6                	call   *%esi
+			putch('X', putdat);
+  800d93:	83 c4 08             	add    $0x8,%esp
+  800d96:	53                   	push   %ebx
+  800d97:	6a 58                	push   $0x58
+  800d99:	ff d6                	call   *%esi
+			break;
+  800d9b:	83 c4 10             	add    $0x10,%esp
+  800d9e:	eb 42                	jmp    800de2 <vprintfmt+0x3a1>
+			putch('0', putdat);
+  800da0:	83 ec 08             	sub    $0x8,%esp
+  800da3:	53                   	push   %ebx
+  800da4:	6a 30                	push   $0x30
+  800da6:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800da8:	83 c4 08             	add    $0x8,%esp
+  800dab:	53                   	push   %ebx
+  800dac:	6a 78                	push   $0x78
+  800dae:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800db0:	8b 45 14             	mov    0x14(%ebp),%eax
+  800db3:	8b 10                	mov    (%eax),%edx
+  800db5:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800dba:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800dbd:	8d 40 04             	lea    0x4(%eax),%eax
+  800dc0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800dc3:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800dc8:	83 ec 0c             	sub    $0xc,%esp
+  800dcb:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800dcf:	50                   	push   %eax
+  800dd0:	ff 75 e0             	push   -0x20(%ebp)
+  800dd3:	57                   	push   %edi
+  800dd4:	51                   	push   %ecx
+  800dd5:	52                   	push   %edx
+  800dd6:	89 da                	mov    %ebx,%edx
+  800dd8:	89 f0                	mov    %esi,%eax
+  800dda:	e8 7f fb ff ff       	call   80095e <printnum>
+			break;
+  800ddf:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800de2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800de5:	e9 75 fc ff ff       	jmp    800a5f <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800dea:	83 f9 01             	cmp    $0x1,%ecx
+  800ded:	7f 1b                	jg     800e0a <vprintfmt+0x3c9>
+	else if (lflag)
+  800def:	85 c9                	test   %ecx,%ecx
+  800df1:	74 2c                	je     800e1f <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  800df3:	8b 45 14             	mov    0x14(%ebp),%eax
+  800df6:	8b 10                	mov    (%eax),%edx
+  800df8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dfd:	8d 40 04             	lea    0x4(%eax),%eax
+  800e00:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800e03:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800e08:	eb be                	jmp    800dc8 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  800e0a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e0d:	8b 10                	mov    (%eax),%edx
+  800e0f:	8b 48 04             	mov    0x4(%eax),%ecx
+  800e12:	8d 40 08             	lea    0x8(%eax),%eax
+  800e15:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800e18:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800e1d:	eb a9                	jmp    800dc8 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  800e1f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e22:	8b 10                	mov    (%eax),%edx
+  800e24:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e29:	8d 40 04             	lea    0x4(%eax),%eax
+  800e2c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800e2f:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800e34:	eb 92                	jmp    800dc8 <vprintfmt+0x387>
+			putch(ch, putdat);
+  800e36:	83 ec 08             	sub    $0x8,%esp
+  800e39:	53                   	push   %ebx
+  800e3a:	6a 25                	push   $0x25
+  800e3c:	ff d6                	call   *%esi
+			break;
+  800e3e:	83 c4 10             	add    $0x10,%esp
+  800e41:	eb 9f                	jmp    800de2 <vprintfmt+0x3a1>
+			putch('%', putdat);
+  800e43:	83 ec 08             	sub    $0x8,%esp
+  800e46:	53                   	push   %ebx
+  800e47:	6a 25                	push   $0x25
+  800e49:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800e4b:	83 c4 10             	add    $0x10,%esp
+  800e4e:	89 f8                	mov    %edi,%eax
+  800e50:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800e54:	74 05                	je     800e5b <vprintfmt+0x41a>
+  800e56:	83 e8 01             	sub    $0x1,%eax
+  800e59:	eb f5                	jmp    800e50 <vprintfmt+0x40f>
+  800e5b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800e5e:	eb 82                	jmp    800de2 <vprintfmt+0x3a1>
+
+00800e60 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800e60:	55                   	push   %ebp
+  800e61:	89 e5                	mov    %esp,%ebp
+  800e63:	83 ec 18             	sub    $0x18,%esp
+  800e66:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e69:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800e6c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800e6f:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800e73:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800e76:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800e7d:	85 c0                	test   %eax,%eax
+  800e7f:	74 26                	je     800ea7 <vsnprintf+0x47>
+  800e81:	85 d2                	test   %edx,%edx
+  800e83:	7e 22                	jle    800ea7 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800e85:	ff 75 14             	push   0x14(%ebp)
+  800e88:	ff 75 10             	push   0x10(%ebp)
+  800e8b:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800e8e:	50                   	push   %eax
+  800e8f:	68 07 0a 80 00       	push   $0x800a07
+  800e94:	e8 a8 fb ff ff       	call   800a41 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800e99:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800e9c:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800e9f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ea2:	83 c4 10             	add    $0x10,%esp
+}
+  800ea5:	c9                   	leave
+  800ea6:	c3                   	ret
+		return -E_INVAL;
+  800ea7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800eac:	eb f7                	jmp    800ea5 <vsnprintf+0x45>
+
+00800eae <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800eae:	55                   	push   %ebp
+  800eaf:	89 e5                	mov    %esp,%ebp
+  800eb1:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800eb4:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800eb7:	50                   	push   %eax
+  800eb8:	ff 75 10             	push   0x10(%ebp)
+  800ebb:	ff 75 0c             	push   0xc(%ebp)
+  800ebe:	ff 75 08             	push   0x8(%ebp)
+  800ec1:	e8 9a ff ff ff       	call   800e60 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800ec6:	c9                   	leave
+  800ec7:	c3                   	ret
+
+00800ec8 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800ec8:	55                   	push   %ebp
+  800ec9:	89 e5                	mov    %esp,%ebp
+  800ecb:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800ece:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ed3:	eb 03                	jmp    800ed8 <strlen+0x10>
+		n++;
+  800ed5:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800ed8:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800edc:	75 f7                	jne    800ed5 <strlen+0xd>
+	return n;
+}
+  800ede:	5d                   	pop    %ebp
+  800edf:	c3                   	ret
+
+00800ee0 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800ee0:	55                   	push   %ebp
+  800ee1:	89 e5                	mov    %esp,%ebp
+  800ee3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800ee6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ee9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800eee:	eb 03                	jmp    800ef3 <strnlen+0x13>
+		n++;
+  800ef0:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800ef3:	39 d0                	cmp    %edx,%eax
+  800ef5:	74 08                	je     800eff <strnlen+0x1f>
+  800ef7:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800efb:	75 f3                	jne    800ef0 <strnlen+0x10>
+  800efd:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800eff:	89 d0                	mov    %edx,%eax
+  800f01:	5d                   	pop    %ebp
+  800f02:	c3                   	ret
+
+00800f03 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800f03:	55                   	push   %ebp
+  800f04:	89 e5                	mov    %esp,%ebp
+  800f06:	53                   	push   %ebx
+  800f07:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800f0a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800f0d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f12:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800f16:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800f19:	83 c0 01             	add    $0x1,%eax
+  800f1c:	84 d2                	test   %dl,%dl
+  800f1e:	75 f2                	jne    800f12 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800f20:	89 c8                	mov    %ecx,%eax
+  800f22:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f25:	c9                   	leave
+  800f26:	c3                   	ret
+
+00800f27 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800f27:	55                   	push   %ebp
+  800f28:	89 e5                	mov    %esp,%ebp
+  800f2a:	53                   	push   %ebx
+  800f2b:	83 ec 10             	sub    $0x10,%esp
+  800f2e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800f31:	53                   	push   %ebx
+  800f32:	e8 91 ff ff ff       	call   800ec8 <strlen>
+  800f37:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800f3a:	ff 75 0c             	push   0xc(%ebp)
+  800f3d:	01 d8                	add    %ebx,%eax
+  800f3f:	50                   	push   %eax
+  800f40:	e8 be ff ff ff       	call   800f03 <strcpy>
+	return dst;
+}
+  800f45:	89 d8                	mov    %ebx,%eax
+  800f47:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f4a:	c9                   	leave
+  800f4b:	c3                   	ret
+
+00800f4c <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800f4c:	55                   	push   %ebp
+  800f4d:	89 e5                	mov    %esp,%ebp
+  800f4f:	56                   	push   %esi
+  800f50:	53                   	push   %ebx
+  800f51:	8b 75 08             	mov    0x8(%ebp),%esi
+  800f54:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800f57:	89 f3                	mov    %esi,%ebx
+  800f59:	03 5d 10             	add    0x10(%ebp),%ebx
+  800f5c:	89 f0                	mov    %esi,%eax
+  800f5e:	eb 0f                	jmp    800f6f <strncpy+0x23>
+		*dst++ = *src;
+  800f60:	83 c0 01             	add    $0x1,%eax
+  800f63:	0f b6 0a             	movzbl (%edx),%ecx
+  800f66:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800f69:	80 f9 01             	cmp    $0x1,%cl
+  800f6c:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800f6f:	39 d8                	cmp    %ebx,%eax
+  800f71:	75 ed                	jne    800f60 <strncpy+0x14>
+	}
+	return ret;
+}
+  800f73:	89 f0                	mov    %esi,%eax
+  800f75:	5b                   	pop    %ebx
+  800f76:	5e                   	pop    %esi
+  800f77:	5d                   	pop    %ebp
+  800f78:	c3                   	ret
+
+00800f79 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800f79:	55                   	push   %ebp
+  800f7a:	89 e5                	mov    %esp,%ebp
+  800f7c:	56                   	push   %esi
+  800f7d:	53                   	push   %ebx
+  800f7e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800f81:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f84:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800f87:	89 f0                	mov    %esi,%eax
+  800f89:	85 d2                	test   %edx,%edx
+  800f8b:	74 21                	je     800fae <strlcpy+0x35>
+  800f8d:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800f91:	89 f2                	mov    %esi,%edx
+  800f93:	eb 09                	jmp    800f9e <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800f95:	83 c1 01             	add    $0x1,%ecx
+  800f98:	83 c2 01             	add    $0x1,%edx
+  800f9b:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800f9e:	39 c2                	cmp    %eax,%edx
+  800fa0:	74 09                	je     800fab <strlcpy+0x32>
+  800fa2:	0f b6 19             	movzbl (%ecx),%ebx
+  800fa5:	84 db                	test   %bl,%bl
+  800fa7:	75 ec                	jne    800f95 <strlcpy+0x1c>
+  800fa9:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800fab:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800fae:	29 f0                	sub    %esi,%eax
+}
+  800fb0:	5b                   	pop    %ebx
+  800fb1:	5e                   	pop    %esi
+  800fb2:	5d                   	pop    %ebp
+  800fb3:	c3                   	ret
+
+00800fb4 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800fb4:	55                   	push   %ebp
+  800fb5:	89 e5                	mov    %esp,%ebp
+  800fb7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800fba:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800fbd:	eb 06                	jmp    800fc5 <strcmp+0x11>
+		p++, q++;
+  800fbf:	83 c1 01             	add    $0x1,%ecx
+  800fc2:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800fc5:	0f b6 01             	movzbl (%ecx),%eax
+  800fc8:	84 c0                	test   %al,%al
+  800fca:	74 04                	je     800fd0 <strcmp+0x1c>
+  800fcc:	3a 02                	cmp    (%edx),%al
+  800fce:	74 ef                	je     800fbf <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800fd0:	0f b6 c0             	movzbl %al,%eax
+  800fd3:	0f b6 12             	movzbl (%edx),%edx
+  800fd6:	29 d0                	sub    %edx,%eax
+}
+  800fd8:	5d                   	pop    %ebp
+  800fd9:	c3                   	ret
+
+00800fda <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800fda:	55                   	push   %ebp
+  800fdb:	89 e5                	mov    %esp,%ebp
+  800fdd:	53                   	push   %ebx
+  800fde:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fe1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe4:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800fe7:	eb 09                	jmp    800ff2 <strncmp+0x18>
+		n--, p++, q++;
+  800fe9:	83 ea 01             	sub    $0x1,%edx
+  800fec:	83 c0 01             	add    $0x1,%eax
+  800fef:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800ff2:	85 d2                	test   %edx,%edx
+  800ff4:	74 18                	je     80100e <strncmp+0x34>
+  800ff6:	0f b6 18             	movzbl (%eax),%ebx
+  800ff9:	84 db                	test   %bl,%bl
+  800ffb:	74 04                	je     801001 <strncmp+0x27>
+  800ffd:	3a 19                	cmp    (%ecx),%bl
+  800fff:	74 e8                	je     800fe9 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801001:	0f b6 00             	movzbl (%eax),%eax
+  801004:	0f b6 11             	movzbl (%ecx),%edx
+  801007:	29 d0                	sub    %edx,%eax
+}
+  801009:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80100c:	c9                   	leave
+  80100d:	c3                   	ret
+		return 0;
+  80100e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801013:	eb f4                	jmp    801009 <strncmp+0x2f>
+
+00801015 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801015:	55                   	push   %ebp
+  801016:	89 e5                	mov    %esp,%ebp
+  801018:	8b 45 08             	mov    0x8(%ebp),%eax
+  80101b:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80101f:	eb 03                	jmp    801024 <strchr+0xf>
+  801021:	83 c0 01             	add    $0x1,%eax
+  801024:	0f b6 10             	movzbl (%eax),%edx
+  801027:	84 d2                	test   %dl,%dl
+  801029:	74 06                	je     801031 <strchr+0x1c>
+		if (*s == c)
+  80102b:	38 ca                	cmp    %cl,%dl
+  80102d:	75 f2                	jne    801021 <strchr+0xc>
+  80102f:	eb 05                	jmp    801036 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  801031:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801036:	5d                   	pop    %ebp
+  801037:	c3                   	ret
+
+00801038 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801038:	55                   	push   %ebp
+  801039:	89 e5                	mov    %esp,%ebp
+  80103b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80103e:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801042:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  801045:	38 ca                	cmp    %cl,%dl
+  801047:	74 09                	je     801052 <strfind+0x1a>
+  801049:	84 d2                	test   %dl,%dl
+  80104b:	74 05                	je     801052 <strfind+0x1a>
+	for (; *s; s++)
+  80104d:	83 c0 01             	add    $0x1,%eax
+  801050:	eb f0                	jmp    801042 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  801052:	5d                   	pop    %ebp
+  801053:	c3                   	ret
+
+00801054 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801054:	55                   	push   %ebp
+  801055:	89 e5                	mov    %esp,%ebp
+  801057:	57                   	push   %edi
+  801058:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80105b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  80105e:	85 c9                	test   %ecx,%ecx
+  801060:	74 20                	je     801082 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  801062:	89 f8                	mov    %edi,%eax
+  801064:	09 c8                	or     %ecx,%eax
+  801066:	a8 03                	test   $0x3,%al
+  801068:	75 12                	jne    80107c <memset+0x28>
+		c &= 0xFF;
+  80106a:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80106e:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  801074:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  801077:	fc                   	cld
+  801078:	f3 ab                	rep stos %eax,%es:(%edi)
+  80107a:	eb 06                	jmp    801082 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80107c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80107f:	fc                   	cld
+  801080:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  801082:	89 f8                	mov    %edi,%eax
+  801084:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  801087:	c9                   	leave
+  801088:	c3                   	ret
+
+00801089 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801089:	55                   	push   %ebp
+  80108a:	89 e5                	mov    %esp,%ebp
+  80108c:	57                   	push   %edi
+  80108d:	56                   	push   %esi
+  80108e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801091:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801094:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  801097:	39 c6                	cmp    %eax,%esi
+  801099:	73 32                	jae    8010cd <memmove+0x44>
+  80109b:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80109e:	39 d0                	cmp    %edx,%eax
+  8010a0:	73 2b                	jae    8010cd <memmove+0x44>
+		s += n;
+		d += n;
+  8010a2:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8010a5:	89 d6                	mov    %edx,%esi
+  8010a7:	09 fe                	or     %edi,%esi
+  8010a9:	09 ce                	or     %ecx,%esi
+  8010ab:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8010b1:	75 0e                	jne    8010c1 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8010b3:	83 ef 04             	sub    $0x4,%edi
+  8010b6:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8010b9:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8010bc:	fd                   	std
+  8010bd:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8010bf:	eb 09                	jmp    8010ca <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8010c1:	83 ef 01             	sub    $0x1,%edi
+  8010c4:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8010c7:	fd                   	std
+  8010c8:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8010ca:	fc                   	cld
+  8010cb:	eb 1a                	jmp    8010e7 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8010cd:	89 f2                	mov    %esi,%edx
+  8010cf:	09 c2                	or     %eax,%edx
+  8010d1:	09 ca                	or     %ecx,%edx
+  8010d3:	f6 c2 03             	test   $0x3,%dl
+  8010d6:	75 0a                	jne    8010e2 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8010d8:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8010db:	89 c7                	mov    %eax,%edi
+  8010dd:	fc                   	cld
+  8010de:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8010e0:	eb 05                	jmp    8010e7 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8010e2:	89 c7                	mov    %eax,%edi
+  8010e4:	fc                   	cld
+  8010e5:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8010e7:	5e                   	pop    %esi
+  8010e8:	5f                   	pop    %edi
+  8010e9:	5d                   	pop    %ebp
+  8010ea:	c3                   	ret
+
+008010eb <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8010eb:	55                   	push   %ebp
+  8010ec:	89 e5                	mov    %esp,%ebp
+  8010ee:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8010f1:	ff 75 10             	push   0x10(%ebp)
+  8010f4:	ff 75 0c             	push   0xc(%ebp)
+  8010f7:	ff 75 08             	push   0x8(%ebp)
+  8010fa:	e8 8a ff ff ff       	call   801089 <memmove>
+}
+  8010ff:	c9                   	leave
+  801100:	c3                   	ret
+
+00801101 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801101:	55                   	push   %ebp
+  801102:	89 e5                	mov    %esp,%ebp
+  801104:	56                   	push   %esi
+  801105:	53                   	push   %ebx
+  801106:	8b 45 08             	mov    0x8(%ebp),%eax
+  801109:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  80110c:	89 c6                	mov    %eax,%esi
+  80110e:	03 75 10             	add    0x10(%ebp),%esi
+  801111:	eb 06                	jmp    801119 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  801113:	83 c0 01             	add    $0x1,%eax
+  801116:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  801119:	39 f0                	cmp    %esi,%eax
+  80111b:	74 14                	je     801131 <memcmp+0x30>
+		if (*s1 != *s2)
+  80111d:	0f b6 08             	movzbl (%eax),%ecx
+  801120:	0f b6 1a             	movzbl (%edx),%ebx
+  801123:	38 d9                	cmp    %bl,%cl
+  801125:	74 ec                	je     801113 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  801127:	0f b6 c1             	movzbl %cl,%eax
+  80112a:	0f b6 db             	movzbl %bl,%ebx
+  80112d:	29 d8                	sub    %ebx,%eax
+  80112f:	eb 05                	jmp    801136 <memcmp+0x35>
+	}
+
+	return 0;
+  801131:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801136:	5b                   	pop    %ebx
+  801137:	5e                   	pop    %esi
+  801138:	5d                   	pop    %ebp
+  801139:	c3                   	ret
+
+0080113a <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  80113a:	55                   	push   %ebp
+  80113b:	89 e5                	mov    %esp,%ebp
+  80113d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801140:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  801143:	89 c2                	mov    %eax,%edx
+  801145:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  801148:	eb 03                	jmp    80114d <memfind+0x13>
+  80114a:	83 c0 01             	add    $0x1,%eax
+  80114d:	39 d0                	cmp    %edx,%eax
+  80114f:	73 04                	jae    801155 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801151:	38 08                	cmp    %cl,(%eax)
+  801153:	75 f5                	jne    80114a <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  801155:	5d                   	pop    %ebp
+  801156:	c3                   	ret
+
+00801157 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  801157:	55                   	push   %ebp
+  801158:	89 e5                	mov    %esp,%ebp
+  80115a:	57                   	push   %edi
+  80115b:	56                   	push   %esi
+  80115c:	53                   	push   %ebx
+  80115d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801160:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801163:	eb 03                	jmp    801168 <strtol+0x11>
+		s++;
+  801165:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  801168:	0f b6 02             	movzbl (%edx),%eax
+  80116b:	3c 20                	cmp    $0x20,%al
+  80116d:	74 f6                	je     801165 <strtol+0xe>
+  80116f:	3c 09                	cmp    $0x9,%al
+  801171:	74 f2                	je     801165 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  801173:	3c 2b                	cmp    $0x2b,%al
+  801175:	74 2a                	je     8011a1 <strtol+0x4a>
+	int neg = 0;
+  801177:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  80117c:	3c 2d                	cmp    $0x2d,%al
+  80117e:	74 2b                	je     8011ab <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801180:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  801186:	75 0f                	jne    801197 <strtol+0x40>
+  801188:	80 3a 30             	cmpb   $0x30,(%edx)
+  80118b:	74 28                	je     8011b5 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  80118d:	85 db                	test   %ebx,%ebx
+  80118f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801194:	0f 44 d8             	cmove  %eax,%ebx
+  801197:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80119c:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  80119f:	eb 46                	jmp    8011e7 <strtol+0x90>
+		s++;
+  8011a1:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  8011a4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8011a9:	eb d5                	jmp    801180 <strtol+0x29>
+		s++, neg = 1;
+  8011ab:	83 c2 01             	add    $0x1,%edx
+  8011ae:	bf 01 00 00 00       	mov    $0x1,%edi
+  8011b3:	eb cb                	jmp    801180 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8011b5:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8011b9:	74 0e                	je     8011c9 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  8011bb:	85 db                	test   %ebx,%ebx
+  8011bd:	75 d8                	jne    801197 <strtol+0x40>
+		s++, base = 8;
+  8011bf:	83 c2 01             	add    $0x1,%edx
+  8011c2:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8011c7:	eb ce                	jmp    801197 <strtol+0x40>
+		s += 2, base = 16;
+  8011c9:	83 c2 02             	add    $0x2,%edx
+  8011cc:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8011d1:	eb c4                	jmp    801197 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  8011d3:	0f be c0             	movsbl %al,%eax
+  8011d6:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  8011d9:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8011dc:	7d 3a                	jge    801218 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  8011de:	83 c2 01             	add    $0x1,%edx
+  8011e1:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  8011e5:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  8011e7:	0f b6 02             	movzbl (%edx),%eax
+  8011ea:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8011ed:	89 f3                	mov    %esi,%ebx
+  8011ef:	80 fb 09             	cmp    $0x9,%bl
+  8011f2:	76 df                	jbe    8011d3 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  8011f4:	8d 70 9f             	lea    -0x61(%eax),%esi
+  8011f7:	89 f3                	mov    %esi,%ebx
+  8011f9:	80 fb 19             	cmp    $0x19,%bl
+  8011fc:	77 08                	ja     801206 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  8011fe:	0f be c0             	movsbl %al,%eax
+  801201:	83 e8 57             	sub    $0x57,%eax
+  801204:	eb d3                	jmp    8011d9 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  801206:	8d 70 bf             	lea    -0x41(%eax),%esi
+  801209:	89 f3                	mov    %esi,%ebx
+  80120b:	80 fb 19             	cmp    $0x19,%bl
+  80120e:	77 08                	ja     801218 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  801210:	0f be c0             	movsbl %al,%eax
+  801213:	83 e8 37             	sub    $0x37,%eax
+  801216:	eb c1                	jmp    8011d9 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801218:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80121c:	74 05                	je     801223 <strtol+0xcc>
+		*endptr = (char *) s;
+  80121e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801221:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  801223:	89 c8                	mov    %ecx,%eax
+  801225:	f7 d8                	neg    %eax
+  801227:	85 ff                	test   %edi,%edi
+  801229:	0f 45 c8             	cmovne %eax,%ecx
+}
+  80122c:	89 c8                	mov    %ecx,%eax
+  80122e:	5b                   	pop    %ebx
+  80122f:	5e                   	pop    %esi
+  801230:	5f                   	pop    %edi
+  801231:	5d                   	pop    %ebp
+  801232:	c3                   	ret
+
+00801233 <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801233:	55                   	push   %ebp
+  801234:	89 e5                	mov    %esp,%ebp
+  801236:	57                   	push   %edi
+  801237:	56                   	push   %esi
+  801238:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  801239:	b8 00 00 00 00       	mov    $0x0,%eax
+  80123e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801241:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801244:	89 c3                	mov    %eax,%ebx
+  801246:	89 c7                	mov    %eax,%edi
+  801248:	89 c6                	mov    %eax,%esi
+  80124a:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  80124c:	5b                   	pop    %ebx
+  80124d:	5e                   	pop    %esi
+  80124e:	5f                   	pop    %edi
+  80124f:	5d                   	pop    %ebp
+  801250:	c3                   	ret
+
+00801251 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801251:	55                   	push   %ebp
+  801252:	89 e5                	mov    %esp,%ebp
+  801254:	57                   	push   %edi
+  801255:	56                   	push   %esi
+  801256:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  801257:	ba 00 00 00 00       	mov    $0x0,%edx
+  80125c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801261:	89 d1                	mov    %edx,%ecx
+  801263:	89 d3                	mov    %edx,%ebx
+  801265:	89 d7                	mov    %edx,%edi
+  801267:	89 d6                	mov    %edx,%esi
+  801269:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  80126b:	5b                   	pop    %ebx
+  80126c:	5e                   	pop    %esi
+  80126d:	5f                   	pop    %edi
+  80126e:	5d                   	pop    %ebp
+  80126f:	c3                   	ret
+
+00801270 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801270:	55                   	push   %ebp
+  801271:	89 e5                	mov    %esp,%ebp
+  801273:	57                   	push   %edi
+  801274:	56                   	push   %esi
+  801275:	53                   	push   %ebx
+  801276:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  801279:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80127e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801281:	b8 03 00 00 00       	mov    $0x3,%eax
+  801286:	89 cb                	mov    %ecx,%ebx
+  801288:	89 cf                	mov    %ecx,%edi
+  80128a:	89 ce                	mov    %ecx,%esi
+  80128c:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80128e:	85 c0                	test   %eax,%eax
+  801290:	7f 08                	jg     80129a <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  801292:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801295:	5b                   	pop    %ebx
+  801296:	5e                   	pop    %esi
+  801297:	5f                   	pop    %edi
+  801298:	5d                   	pop    %ebp
+  801299:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80129a:	83 ec 0c             	sub    $0xc,%esp
+  80129d:	50                   	push   %eax
+  80129e:	6a 03                	push   $0x3
+  8012a0:	68 e3 34 80 00       	push   $0x8034e3
+  8012a5:	6a 3e                	push   $0x3e
+  8012a7:	68 00 35 80 00       	push   $0x803500
+  8012ac:	e8 be f5 ff ff       	call   80086f <_panic>
+
+008012b1 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8012b1:	55                   	push   %ebp
+  8012b2:	89 e5                	mov    %esp,%ebp
+  8012b4:	57                   	push   %edi
+  8012b5:	56                   	push   %esi
+  8012b6:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8012b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012bc:	b8 02 00 00 00       	mov    $0x2,%eax
+  8012c1:	89 d1                	mov    %edx,%ecx
+  8012c3:	89 d3                	mov    %edx,%ebx
+  8012c5:	89 d7                	mov    %edx,%edi
+  8012c7:	89 d6                	mov    %edx,%esi
+  8012c9:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  8012cb:	5b                   	pop    %ebx
+  8012cc:	5e                   	pop    %esi
+  8012cd:	5f                   	pop    %edi
+  8012ce:	5d                   	pop    %ebp
+  8012cf:	c3                   	ret
+
+008012d0 <sys_yield>:
+
+void
+sys_yield(void) {
+  8012d0:	55                   	push   %ebp
+  8012d1:	89 e5                	mov    %esp,%ebp
+  8012d3:	57                   	push   %edi
+  8012d4:	56                   	push   %esi
+  8012d5:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8012d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012db:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8012e0:	89 d1                	mov    %edx,%ecx
+  8012e2:	89 d3                	mov    %edx,%ebx
+  8012e4:	89 d7                	mov    %edx,%edi
+  8012e6:	89 d6                	mov    %edx,%esi
+  8012e8:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  8012ea:	5b                   	pop    %ebx
+  8012eb:	5e                   	pop    %esi
+  8012ec:	5f                   	pop    %edi
+  8012ed:	5d                   	pop    %ebp
+  8012ee:	c3                   	ret
+
+008012ef <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  8012ef:	55                   	push   %ebp
+  8012f0:	89 e5                	mov    %esp,%ebp
+  8012f2:	57                   	push   %edi
+  8012f3:	56                   	push   %esi
+  8012f4:	53                   	push   %ebx
+  8012f5:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8012f8:	be 00 00 00 00       	mov    $0x0,%esi
+  8012fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801300:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801303:	b8 04 00 00 00       	mov    $0x4,%eax
+  801308:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80130b:	89 f7                	mov    %esi,%edi
+  80130d:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80130f:	85 c0                	test   %eax,%eax
+  801311:	7f 08                	jg     80131b <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  801313:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801316:	5b                   	pop    %ebx
+  801317:	5e                   	pop    %esi
+  801318:	5f                   	pop    %edi
+  801319:	5d                   	pop    %ebp
+  80131a:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80131b:	83 ec 0c             	sub    $0xc,%esp
+  80131e:	50                   	push   %eax
+  80131f:	6a 04                	push   $0x4
+  801321:	68 e3 34 80 00       	push   $0x8034e3
+  801326:	6a 3e                	push   $0x3e
+  801328:	68 00 35 80 00       	push   $0x803500
+  80132d:	e8 3d f5 ff ff       	call   80086f <_panic>
+
+00801332 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  801332:	55                   	push   %ebp
+  801333:	89 e5                	mov    %esp,%ebp
+  801335:	57                   	push   %edi
+  801336:	56                   	push   %esi
+  801337:	53                   	push   %ebx
+  801338:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  80133b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80133e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801341:	b8 05 00 00 00       	mov    $0x5,%eax
+  801346:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801349:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80134c:	8b 75 18             	mov    0x18(%ebp),%esi
+  80134f:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801351:	85 c0                	test   %eax,%eax
+  801353:	7f 08                	jg     80135d <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  801355:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801358:	5b                   	pop    %ebx
+  801359:	5e                   	pop    %esi
+  80135a:	5f                   	pop    %edi
+  80135b:	5d                   	pop    %ebp
+  80135c:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80135d:	83 ec 0c             	sub    $0xc,%esp
+  801360:	50                   	push   %eax
+  801361:	6a 05                	push   $0x5
+  801363:	68 e3 34 80 00       	push   $0x8034e3
+  801368:	6a 3e                	push   $0x3e
+  80136a:	68 00 35 80 00       	push   $0x803500
+  80136f:	e8 fb f4 ff ff       	call   80086f <_panic>
+
+00801374 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  801374:	55                   	push   %ebp
+  801375:	89 e5                	mov    %esp,%ebp
+  801377:	57                   	push   %edi
+  801378:	56                   	push   %esi
+  801379:	53                   	push   %ebx
+  80137a:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  80137d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801382:	8b 55 08             	mov    0x8(%ebp),%edx
+  801385:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801388:	b8 06 00 00 00       	mov    $0x6,%eax
+  80138d:	89 df                	mov    %ebx,%edi
+  80138f:	89 de                	mov    %ebx,%esi
+  801391:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801393:	85 c0                	test   %eax,%eax
+  801395:	7f 08                	jg     80139f <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  801397:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80139a:	5b                   	pop    %ebx
+  80139b:	5e                   	pop    %esi
+  80139c:	5f                   	pop    %edi
+  80139d:	5d                   	pop    %ebp
+  80139e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80139f:	83 ec 0c             	sub    $0xc,%esp
+  8013a2:	50                   	push   %eax
+  8013a3:	6a 06                	push   $0x6
+  8013a5:	68 e3 34 80 00       	push   $0x8034e3
+  8013aa:	6a 3e                	push   $0x3e
+  8013ac:	68 00 35 80 00       	push   $0x803500
+  8013b1:	e8 b9 f4 ff ff       	call   80086f <_panic>
+
+008013b6 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8013b6:	55                   	push   %ebp
+  8013b7:	89 e5                	mov    %esp,%ebp
+  8013b9:	57                   	push   %edi
+  8013ba:	56                   	push   %esi
+  8013bb:	53                   	push   %ebx
+  8013bc:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8013bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013ca:	b8 08 00 00 00       	mov    $0x8,%eax
+  8013cf:	89 df                	mov    %ebx,%edi
+  8013d1:	89 de                	mov    %ebx,%esi
+  8013d3:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8013d5:	85 c0                	test   %eax,%eax
+  8013d7:	7f 08                	jg     8013e1 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8013d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013dc:	5b                   	pop    %ebx
+  8013dd:	5e                   	pop    %esi
+  8013de:	5f                   	pop    %edi
+  8013df:	5d                   	pop    %ebp
+  8013e0:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8013e1:	83 ec 0c             	sub    $0xc,%esp
+  8013e4:	50                   	push   %eax
+  8013e5:	6a 08                	push   $0x8
+  8013e7:	68 e3 34 80 00       	push   $0x8034e3
+  8013ec:	6a 3e                	push   $0x3e
+  8013ee:	68 00 35 80 00       	push   $0x803500
+  8013f3:	e8 77 f4 ff ff       	call   80086f <_panic>
+
+008013f8 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8013f8:	55                   	push   %ebp
+  8013f9:	89 e5                	mov    %esp,%ebp
+  8013fb:	57                   	push   %edi
+  8013fc:	56                   	push   %esi
+  8013fd:	53                   	push   %ebx
+  8013fe:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  801401:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801406:	8b 55 08             	mov    0x8(%ebp),%edx
+  801409:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80140c:	b8 09 00 00 00       	mov    $0x9,%eax
+  801411:	89 df                	mov    %ebx,%edi
+  801413:	89 de                	mov    %ebx,%esi
+  801415:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801417:	85 c0                	test   %eax,%eax
+  801419:	7f 08                	jg     801423 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  80141b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80141e:	5b                   	pop    %ebx
+  80141f:	5e                   	pop    %esi
+  801420:	5f                   	pop    %edi
+  801421:	5d                   	pop    %ebp
+  801422:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801423:	83 ec 0c             	sub    $0xc,%esp
+  801426:	50                   	push   %eax
+  801427:	6a 09                	push   $0x9
+  801429:	68 e3 34 80 00       	push   $0x8034e3
+  80142e:	6a 3e                	push   $0x3e
+  801430:	68 00 35 80 00       	push   $0x803500
+  801435:	e8 35 f4 ff ff       	call   80086f <_panic>
+
+0080143a <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80143a:	55                   	push   %ebp
+  80143b:	89 e5                	mov    %esp,%ebp
+  80143d:	57                   	push   %edi
+  80143e:	56                   	push   %esi
+  80143f:	53                   	push   %ebx
+  801440:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  801443:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801448:	8b 55 08             	mov    0x8(%ebp),%edx
+  80144b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80144e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801453:	89 df                	mov    %ebx,%edi
+  801455:	89 de                	mov    %ebx,%esi
+  801457:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801459:	85 c0                	test   %eax,%eax
+  80145b:	7f 08                	jg     801465 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80145d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801460:	5b                   	pop    %ebx
+  801461:	5e                   	pop    %esi
+  801462:	5f                   	pop    %edi
+  801463:	5d                   	pop    %ebp
+  801464:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801465:	83 ec 0c             	sub    $0xc,%esp
+  801468:	50                   	push   %eax
+  801469:	6a 0a                	push   $0xa
+  80146b:	68 e3 34 80 00       	push   $0x8034e3
+  801470:	6a 3e                	push   $0x3e
+  801472:	68 00 35 80 00       	push   $0x803500
+  801477:	e8 f3 f3 ff ff       	call   80086f <_panic>
+
+0080147c <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  80147c:	55                   	push   %ebp
+  80147d:	89 e5                	mov    %esp,%ebp
+  80147f:	57                   	push   %edi
+  801480:	56                   	push   %esi
+  801481:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  801482:	8b 55 08             	mov    0x8(%ebp),%edx
+  801485:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801488:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80148d:	be 00 00 00 00       	mov    $0x0,%esi
+  801492:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801495:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801498:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  80149a:	5b                   	pop    %ebx
+  80149b:	5e                   	pop    %esi
+  80149c:	5f                   	pop    %edi
+  80149d:	5d                   	pop    %ebp
+  80149e:	c3                   	ret
+
+0080149f <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  80149f:	55                   	push   %ebp
+  8014a0:	89 e5                	mov    %esp,%ebp
+  8014a2:	57                   	push   %edi
+  8014a3:	56                   	push   %esi
+  8014a4:	53                   	push   %ebx
+  8014a5:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8014a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014b0:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8014b5:	89 cb                	mov    %ecx,%ebx
+  8014b7:	89 cf                	mov    %ecx,%edi
+  8014b9:	89 ce                	mov    %ecx,%esi
+  8014bb:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8014bd:	85 c0                	test   %eax,%eax
+  8014bf:	7f 08                	jg     8014c9 <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  8014c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014c4:	5b                   	pop    %ebx
+  8014c5:	5e                   	pop    %esi
+  8014c6:	5f                   	pop    %edi
+  8014c7:	5d                   	pop    %ebp
+  8014c8:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8014c9:	83 ec 0c             	sub    $0xc,%esp
+  8014cc:	50                   	push   %eax
+  8014cd:	6a 0d                	push   $0xd
+  8014cf:	68 e3 34 80 00       	push   $0x8034e3
+  8014d4:	6a 3e                	push   $0x3e
+  8014d6:	68 00 35 80 00       	push   $0x803500
+  8014db:	e8 8f f3 ff ff       	call   80086f <_panic>
+
+008014e0 <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  8014e0:	55                   	push   %ebp
+  8014e1:	89 e5                	mov    %esp,%ebp
+  8014e3:	57                   	push   %edi
+  8014e4:	56                   	push   %esi
+  8014e5:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8014e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014f1:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8014f6:	89 df                	mov    %ebx,%edi
+  8014f8:	89 de                	mov    %ebx,%esi
+  8014fa:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  8014fc:	5b                   	pop    %ebx
+  8014fd:	5e                   	pop    %esi
+  8014fe:	5f                   	pop    %edi
+  8014ff:	5d                   	pop    %ebp
+  801500:	c3                   	ret
+
+00801501 <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  801501:	55                   	push   %ebp
+  801502:	89 e5                	mov    %esp,%ebp
+  801504:	57                   	push   %edi
+  801505:	56                   	push   %esi
+  801506:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  801507:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80150c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80150f:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801514:	89 cb                	mov    %ecx,%ebx
+  801516:	89 cf                	mov    %ecx,%edi
+  801518:	89 ce                	mov    %ecx,%esi
+  80151a:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  80151c:	5b                   	pop    %ebx
+  80151d:	5e                   	pop    %esi
+  80151e:	5f                   	pop    %edi
+  80151f:	5d                   	pop    %ebp
+  801520:	c3                   	ret
+
+00801521 <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  801521:	55                   	push   %ebp
+  801522:	89 e5                	mov    %esp,%ebp
+  801524:	57                   	push   %edi
+  801525:	56                   	push   %esi
+  801526:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  801527:	ba 00 00 00 00       	mov    $0x0,%edx
+  80152c:	b8 10 00 00 00       	mov    $0x10,%eax
+  801531:	89 d1                	mov    %edx,%ecx
+  801533:	89 d3                	mov    %edx,%ebx
+  801535:	89 d7                	mov    %edx,%edi
+  801537:	89 d6                	mov    %edx,%esi
+  801539:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80153b:	5b                   	pop    %ebx
+  80153c:	5e                   	pop    %esi
+  80153d:	5f                   	pop    %edi
+  80153e:	5d                   	pop    %ebp
+  80153f:	c3                   	ret
+
+00801540 <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  801540:	55                   	push   %ebp
+  801541:	89 e5                	mov    %esp,%ebp
+  801543:	57                   	push   %edi
+  801544:	56                   	push   %esi
+  801545:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  801546:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80154b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80154e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801551:	b8 11 00 00 00       	mov    $0x11,%eax
+  801556:	89 df                	mov    %ebx,%edi
+  801558:	89 de                	mov    %ebx,%esi
+  80155a:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  80155c:	5b                   	pop    %ebx
+  80155d:	5e                   	pop    %esi
+  80155e:	5f                   	pop    %edi
+  80155f:	5d                   	pop    %ebp
+  801560:	c3                   	ret
+
+00801561 <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  801561:	55                   	push   %ebp
+  801562:	89 e5                	mov    %esp,%ebp
+  801564:	57                   	push   %edi
+  801565:	56                   	push   %esi
+  801566:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  801567:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80156c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80156f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801572:	b8 12 00 00 00       	mov    $0x12,%eax
+  801577:	89 df                	mov    %ebx,%edi
+  801579:	89 de                	mov    %ebx,%esi
+  80157b:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  80157d:	5b                   	pop    %ebx
+  80157e:	5e                   	pop    %esi
+  80157f:	5f                   	pop    %edi
+  801580:	5d                   	pop    %ebp
+  801581:	c3                   	ret
+
+00801582 <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  801582:	55                   	push   %ebp
+  801583:	89 e5                	mov    %esp,%ebp
+  801585:	57                   	push   %edi
+  801586:	56                   	push   %esi
+  801587:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  801588:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80158d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801590:	b8 13 00 00 00       	mov    $0x13,%eax
+  801595:	89 cb                	mov    %ecx,%ebx
+  801597:	89 cf                	mov    %ecx,%edi
+  801599:	89 ce                	mov    %ecx,%esi
+  80159b:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  80159d:	5b                   	pop    %ebx
+  80159e:	5e                   	pop    %esi
+  80159f:	5f                   	pop    %edi
+  8015a0:	5d                   	pop    %ebp
+  8015a1:	c3                   	ret
+
+008015a2 <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  8015a2:	55                   	push   %ebp
+  8015a3:	89 e5                	mov    %esp,%ebp
+  8015a5:	57                   	push   %edi
+  8015a6:	56                   	push   %esi
+  8015a7:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8015a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015b0:	b8 14 00 00 00       	mov    $0x14,%eax
+  8015b5:	89 cb                	mov    %ecx,%ebx
+  8015b7:	89 cf                	mov    %ecx,%edi
+  8015b9:	89 ce                	mov    %ecx,%esi
+  8015bb:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  8015bd:	5b                   	pop    %ebx
+  8015be:	5e                   	pop    %esi
+  8015bf:	5f                   	pop    %edi
+  8015c0:	5d                   	pop    %ebp
+  8015c1:	c3                   	ret
+
+008015c2 <pgfault>:
+//
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf) {
+  8015c2:	55                   	push   %ebp
+  8015c3:	89 e5                	mov    %esp,%ebp
+  8015c5:	53                   	push   %ebx
+  8015c6:	83 ec 04             	sub    $0x4,%esp
+  8015c9:	8b 45 08             	mov    0x8(%ebp),%eax
+    void *addr = (void *) utf->utf_fault_va;
+  8015cc:	8b 18                	mov    (%eax),%ebx
+    // Hint:
+    //   Use the read-only page table mappings at uvpt
+    //   (see <inc/memlayout.h>).
+
+    // LAB 4: Your code here.
+    if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P) ||
+  8015ce:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  8015d2:	0f 84 95 00 00 00    	je     80166d <pgfault+0xab>
+  8015d8:	89 d8                	mov    %ebx,%eax
+  8015da:	c1 e8 16             	shr    $0x16,%eax
+  8015dd:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8015e4:	a8 01                	test   $0x1,%al
+  8015e6:	0f 84 81 00 00 00    	je     80166d <pgfault+0xab>
+        (uvpt[PGNUM(addr)] & (PTE_P | PTE_COW)) != (PTE_P | PTE_COW)) {
+  8015ec:	89 d8                	mov    %ebx,%eax
+  8015ee:	c1 e8 0c             	shr    $0xc,%eax
+  8015f1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8015f8:	25 01 08 00 00       	and    $0x801,%eax
+    if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P) ||
+  8015fd:	3d 01 08 00 00       	cmp    $0x801,%eax
+  801602:	75 69                	jne    80166d <pgfault+0xab>
+    // Hint:
+    //   You should make three system calls.
+
+    // LAB 4: Your code here.
+
+    if (sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W))
+  801604:	83 ec 04             	sub    $0x4,%esp
+  801607:	6a 07                	push   $0x7
+  801609:	68 00 f0 7f 00       	push   $0x7ff000
+  80160e:	6a 00                	push   $0x0
+  801610:	e8 da fc ff ff       	call   8012ef <sys_page_alloc>
+  801615:	83 c4 10             	add    $0x10,%esp
+  801618:	85 c0                	test   %eax,%eax
+  80161a:	75 65                	jne    801681 <pgfault+0xbf>
+        panic("sys_page_alloc failed");
+
+    addr = ROUNDDOWN(addr, PGSIZE);
+  80161c:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+    memmove(PFTEMP, addr, PGSIZE);
+  801622:	83 ec 04             	sub    $0x4,%esp
+  801625:	68 00 10 00 00       	push   $0x1000
+  80162a:	53                   	push   %ebx
+  80162b:	68 00 f0 7f 00       	push   $0x7ff000
+  801630:	e8 54 fa ff ff       	call   801089 <memmove>
+
+    if (sys_page_map(0, PFTEMP, 0, addr, PTE_P | PTE_U | PTE_W))
+  801635:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80163c:	53                   	push   %ebx
+  80163d:	6a 00                	push   $0x0
+  80163f:	68 00 f0 7f 00       	push   $0x7ff000
+  801644:	6a 00                	push   $0x0
+  801646:	e8 e7 fc ff ff       	call   801332 <sys_page_map>
+  80164b:	83 c4 20             	add    $0x20,%esp
+  80164e:	85 c0                	test   %eax,%eax
+  801650:	75 43                	jne    801695 <pgfault+0xd3>
+        panic("sys_page_map failed");
+    if (sys_page_unmap(0, PFTEMP))
+  801652:	83 ec 08             	sub    $0x8,%esp
+  801655:	68 00 f0 7f 00       	push   $0x7ff000
+  80165a:	6a 00                	push   $0x0
+  80165c:	e8 13 fd ff ff       	call   801374 <sys_page_unmap>
+  801661:	83 c4 10             	add    $0x10,%esp
+  801664:	85 c0                	test   %eax,%eax
+  801666:	75 41                	jne    8016a9 <pgfault+0xe7>
+        panic("sys_page_unmap failed");
+
+}
+  801668:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80166b:	c9                   	leave
+  80166c:	c3                   	ret
+        panic("pgfault: faulting access invalid");
+  80166d:	83 ec 04             	sub    $0x4,%esp
+  801670:	68 10 35 80 00       	push   $0x803510
+  801675:	6a 1e                	push   $0x1e
+  801677:	68 7c 35 80 00       	push   $0x80357c
+  80167c:	e8 ee f1 ff ff       	call   80086f <_panic>
+        panic("sys_page_alloc failed");
+  801681:	83 ec 04             	sub    $0x4,%esp
+  801684:	68 ef 35 80 00       	push   $0x8035ef
+  801689:	6a 2a                	push   $0x2a
+  80168b:	68 7c 35 80 00       	push   $0x80357c
+  801690:	e8 da f1 ff ff       	call   80086f <_panic>
+        panic("sys_page_map failed");
+  801695:	83 ec 04             	sub    $0x4,%esp
+  801698:	68 87 35 80 00       	push   $0x803587
+  80169d:	6a 30                	push   $0x30
+  80169f:	68 7c 35 80 00       	push   $0x80357c
+  8016a4:	e8 c6 f1 ff ff       	call   80086f <_panic>
+        panic("sys_page_unmap failed");
+  8016a9:	83 ec 04             	sub    $0x4,%esp
+  8016ac:	68 9b 35 80 00       	push   $0x80359b
+  8016b1:	6a 32                	push   $0x32
+  8016b3:	68 7c 35 80 00       	push   $0x80357c
+  8016b8:	e8 b2 f1 ff ff       	call   80086f <_panic>
+
+008016bd <fork>:
+//   Remember to fix "thisenv" in the child process.
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void) {
+  8016bd:	55                   	push   %ebp
+  8016be:	89 e5                	mov    %esp,%ebp
+  8016c0:	57                   	push   %edi
+  8016c1:	56                   	push   %esi
+  8016c2:	53                   	push   %ebx
+  8016c3:	83 ec 18             	sub    $0x18,%esp
+    // LAB 4: Your code here.
+    set_pgfault_handler(pgfault);
+  8016c6:	68 c2 15 80 00       	push   $0x8015c2
+  8016cb:	e8 21 14 00 00       	call   802af1 <set_pgfault_handler>
+
+// This must be inlined.  Exercise for reader: why?
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+  envid_t ret;
+  asm volatile("int %2"
+  8016d0:	b8 07 00 00 00       	mov    $0x7,%eax
+  8016d5:	cd 30                	int    $0x30
+  8016d7:	89 c6                	mov    %eax,%esi
+
+    envid_t envid = sys_exofork();
+    if (envid < 0)
+  8016d9:	83 c4 10             	add    $0x10,%esp
+  8016dc:	85 c0                	test   %eax,%eax
+  8016de:	78 2a                	js     80170a <fork+0x4d>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+
+    uintptr_t addr;
+    for (addr = 0; addr < UTOP; addr += PGSIZE) {
+  8016e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (envid == 0) {
+  8016e5:	0f 85 a2 00 00 00    	jne    80178d <fork+0xd0>
+        thisenv = &envs[ENVX(sys_getenvid())];
+  8016eb:	e8 c1 fb ff ff       	call   8012b1 <sys_getenvid>
+  8016f0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8016f5:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8016f8:	c1 e0 04             	shl    $0x4,%eax
+  8016fb:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801700:	a3 20 50 80 00       	mov    %eax,0x805020
+        return 0;
+  801705:	e9 6c 01 00 00       	jmp    801876 <fork+0x1b9>
+        panic("fork: sys_exofork error: %e", envid);
+  80170a:	50                   	push   %eax
+  80170b:	68 b1 35 80 00       	push   $0x8035b1
+  801710:	6a 6f                	push   $0x6f
+  801712:	68 7c 35 80 00       	push   $0x80357c
+  801717:	e8 53 f1 ff ff       	call   80086f <_panic>
+        if ((r = sys_page_map(0, vptr, envid, vptr, uvpt[pn] & PTE_SYSCALL)) < 0)
+  80171c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801723:	83 ec 0c             	sub    $0xc,%esp
+  801726:	25 07 0e 00 00       	and    $0xe07,%eax
+  80172b:	50                   	push   %eax
+  80172c:	57                   	push   %edi
+  80172d:	56                   	push   %esi
+  80172e:	57                   	push   %edi
+  80172f:	6a 00                	push   $0x0
+  801731:	e8 fc fb ff ff       	call   801332 <sys_page_map>
+  801736:	83 c4 20             	add    $0x20,%esp
+  801739:	85 c0                	test   %eax,%eax
+  80173b:	79 3e                	jns    80177b <fork+0xbe>
+            panic("duppage :in sys_page_map %e", r);
+  80173d:	50                   	push   %eax
+  80173e:	68 cd 35 80 00       	push   $0x8035cd
+  801743:	6a 49                	push   $0x49
+  801745:	68 7c 35 80 00       	push   $0x80357c
+  80174a:	e8 20 f1 ff ff       	call   80086f <_panic>
+            panic("duppage :in sys_page_map %e", r);
+  80174f:	50                   	push   %eax
+  801750:	68 cd 35 80 00       	push   $0x8035cd
+  801755:	6a 4e                	push   $0x4e
+  801757:	68 7c 35 80 00       	push   $0x80357c
+  80175c:	e8 0e f1 ff ff       	call   80086f <_panic>
+    } else if ((r = sys_page_map(0, vptr, envid, vptr, PTE_P | PTE_U)) < 0)
+  801761:	83 ec 0c             	sub    $0xc,%esp
+  801764:	6a 05                	push   $0x5
+  801766:	57                   	push   %edi
+  801767:	56                   	push   %esi
+  801768:	57                   	push   %edi
+  801769:	6a 00                	push   $0x0
+  80176b:	e8 c2 fb ff ff       	call   801332 <sys_page_map>
+  801770:	83 c4 20             	add    $0x20,%esp
+  801773:	85 c0                	test   %eax,%eax
+  801775:	0f 88 ab 00 00 00    	js     801826 <fork+0x169>
+    for (addr = 0; addr < UTOP; addr += PGSIZE) {
+  80177b:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801781:	81 fb 00 00 c0 ee    	cmp    $0xeec00000,%ebx
+  801787:	0f 84 ab 00 00 00    	je     801838 <fork+0x17b>
+        if (uvpd[PDX(addr)] & PTE_P && uvpt[PGNUM(addr)] & PTE_P && addr != UXSTACKTOP - PGSIZE) {
+  80178d:	89 d8                	mov    %ebx,%eax
+  80178f:	c1 e8 16             	shr    $0x16,%eax
+  801792:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801799:	a8 01                	test   $0x1,%al
+  80179b:	74 de                	je     80177b <fork+0xbe>
+  80179d:	89 d8                	mov    %ebx,%eax
+  80179f:	c1 e8 0c             	shr    $0xc,%eax
+  8017a2:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8017a9:	f6 c2 01             	test   $0x1,%dl
+  8017ac:	74 cd                	je     80177b <fork+0xbe>
+  8017ae:	81 fb 00 f0 bf ee    	cmp    $0xeebff000,%ebx
+  8017b4:	74 c5                	je     80177b <fork+0xbe>
+    void *vptr = (void *) (pn * PGSIZE);
+  8017b6:	89 c7                	mov    %eax,%edi
+  8017b8:	c1 e7 0c             	shl    $0xc,%edi
+    if (uvpt[pn] & PTE_SHARE) {
+  8017bb:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8017c2:	f6 c6 04             	test   $0x4,%dh
+  8017c5:	0f 85 51 ff ff ff    	jne    80171c <fork+0x5f>
+    } else if (uvpt[pn] & (PTE_W | PTE_COW)) {
+  8017cb:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8017d2:	a9 02 08 00 00       	test   $0x802,%eax
+  8017d7:	74 88                	je     801761 <fork+0xa4>
+        if ((r = sys_page_map(0, vptr, envid, vptr, PTE_P | PTE_U | PTE_COW)) < 0)
+  8017d9:	83 ec 0c             	sub    $0xc,%esp
+  8017dc:	68 05 08 00 00       	push   $0x805
+  8017e1:	57                   	push   %edi
+  8017e2:	56                   	push   %esi
+  8017e3:	57                   	push   %edi
+  8017e4:	6a 00                	push   $0x0
+  8017e6:	e8 47 fb ff ff       	call   801332 <sys_page_map>
+  8017eb:	83 c4 20             	add    $0x20,%esp
+  8017ee:	85 c0                	test   %eax,%eax
+  8017f0:	0f 88 59 ff ff ff    	js     80174f <fork+0x92>
+        if ((r = sys_page_map(0, vptr, 0, vptr, PTE_P | PTE_U | PTE_COW)) < 0)
+  8017f6:	83 ec 0c             	sub    $0xc,%esp
+  8017f9:	68 05 08 00 00       	push   $0x805
+  8017fe:	57                   	push   %edi
+  8017ff:	6a 00                	push   $0x0
+  801801:	57                   	push   %edi
+  801802:	6a 00                	push   $0x0
+  801804:	e8 29 fb ff ff       	call   801332 <sys_page_map>
+  801809:	83 c4 20             	add    $0x20,%esp
+  80180c:	85 c0                	test   %eax,%eax
+  80180e:	0f 89 67 ff ff ff    	jns    80177b <fork+0xbe>
+            panic("duppage :in sys_page_map %e", r);
+  801814:	50                   	push   %eax
+  801815:	68 cd 35 80 00       	push   $0x8035cd
+  80181a:	6a 50                	push   $0x50
+  80181c:	68 7c 35 80 00       	push   $0x80357c
+  801821:	e8 49 f0 ff ff       	call   80086f <_panic>
+        panic("duppage :in sys_page_map %e", r);
+  801826:	50                   	push   %eax
+  801827:	68 cd 35 80 00       	push   $0x8035cd
+  80182c:	6a 53                	push   $0x53
+  80182e:	68 7c 35 80 00       	push   $0x80357c
+  801833:	e8 37 f0 ff ff       	call   80086f <_panic>
+            duppage(envid, PGNUM(addr));
+        }
+    }
+    if (sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W))
+  801838:	83 ec 04             	sub    $0x4,%esp
+  80183b:	6a 07                	push   $0x7
+  80183d:	68 00 f0 bf ee       	push   $0xeebff000
+  801842:	56                   	push   %esi
+  801843:	e8 a7 fa ff ff       	call   8012ef <sys_page_alloc>
+  801848:	83 c4 10             	add    $0x10,%esp
+  80184b:	85 c0                	test   %eax,%eax
+  80184d:	75 31                	jne    801880 <fork+0x1c3>
+        panic("fork: sys_page_alloc failed");
+    if (sys_env_set_pgfault_upcall(envid, _pgfault_upcall))
+  80184f:	83 ec 08             	sub    $0x8,%esp
+  801852:	68 5c 2b 80 00       	push   $0x802b5c
+  801857:	56                   	push   %esi
+  801858:	e8 dd fb ff ff       	call   80143a <sys_env_set_pgfault_upcall>
+  80185d:	83 c4 10             	add    $0x10,%esp
+  801860:	85 c0                	test   %eax,%eax
+  801862:	75 30                	jne    801894 <fork+0x1d7>
+        panic("fork: sys_env_set_pgfault_upcall failed");
+    if (sys_env_set_status(envid, ENV_RUNNABLE))
+  801864:	83 ec 08             	sub    $0x8,%esp
+  801867:	6a 02                	push   $0x2
+  801869:	56                   	push   %esi
+  80186a:	e8 47 fb ff ff       	call   8013b6 <sys_env_set_status>
+  80186f:	83 c4 10             	add    $0x10,%esp
+  801872:	85 c0                	test   %eax,%eax
+  801874:	75 32                	jne    8018a8 <fork+0x1eb>
+        panic("fork: sys_env_set_status failed");
+
+    return envid;
+
+}
+  801876:	89 f0                	mov    %esi,%eax
+  801878:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80187b:	5b                   	pop    %ebx
+  80187c:	5e                   	pop    %esi
+  80187d:	5f                   	pop    %edi
+  80187e:	5d                   	pop    %ebp
+  80187f:	c3                   	ret
+        panic("fork: sys_page_alloc failed");
+  801880:	83 ec 04             	sub    $0x4,%esp
+  801883:	68 e9 35 80 00       	push   $0x8035e9
+  801888:	6a 7d                	push   $0x7d
+  80188a:	68 7c 35 80 00       	push   $0x80357c
+  80188f:	e8 db ef ff ff       	call   80086f <_panic>
+        panic("fork: sys_env_set_pgfault_upcall failed");
+  801894:	83 ec 04             	sub    $0x4,%esp
+  801897:	68 34 35 80 00       	push   $0x803534
+  80189c:	6a 7f                	push   $0x7f
+  80189e:	68 7c 35 80 00       	push   $0x80357c
+  8018a3:	e8 c7 ef ff ff       	call   80086f <_panic>
+        panic("fork: sys_env_set_status failed");
+  8018a8:	83 ec 04             	sub    $0x4,%esp
+  8018ab:	68 5c 35 80 00       	push   $0x80355c
+  8018b0:	68 81 00 00 00       	push   $0x81
+  8018b5:	68 7c 35 80 00       	push   $0x80357c
+  8018ba:	e8 b0 ef ff ff       	call   80086f <_panic>
+
+008018bf <sfork>:
+
+// Challenge!
+int
+sfork(void) {
+  8018bf:	55                   	push   %ebp
+  8018c0:	89 e5                	mov    %esp,%ebp
+  8018c2:	83 ec 0c             	sub    $0xc,%esp
+    panic("sfork not implemented");
+  8018c5:	68 05 36 80 00       	push   $0x803605
+  8018ca:	68 8a 00 00 00       	push   $0x8a
+  8018cf:	68 7c 35 80 00       	push   $0x80357c
+  8018d4:	e8 96 ef ff ff       	call   80086f <_panic>
+
+008018d9 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  8018d9:	55                   	push   %ebp
+  8018da:	89 e5                	mov    %esp,%ebp
+  8018dc:	56                   	push   %esi
+  8018dd:	53                   	push   %ebx
+  8018de:	8b 75 08             	mov    0x8(%ebp),%esi
+  8018e1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8018e4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  8018e7:	85 c0                	test   %eax,%eax
+  8018e9:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8018ee:	0f 44 c2             	cmove  %edx,%eax
+  8018f1:	83 ec 0c             	sub    $0xc,%esp
+  8018f4:	50                   	push   %eax
+  8018f5:	e8 a5 fb ff ff       	call   80149f <sys_ipc_recv>
+
+  if (from_env_store)
+  8018fa:	83 c4 10             	add    $0x10,%esp
+  8018fd:	85 f6                	test   %esi,%esi
+  8018ff:	74 17                	je     801918 <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  801901:	ba 00 00 00 00       	mov    $0x0,%edx
+  801906:	85 c0                	test   %eax,%eax
+  801908:	75 0c                	jne    801916 <ipc_recv+0x3d>
+  80190a:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  801910:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  801916:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  801918:	85 db                	test   %ebx,%ebx
+  80191a:	74 2b                	je     801947 <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  80191c:	85 c0                	test   %eax,%eax
+  80191e:	74 0d                	je     80192d <ipc_recv+0x54>
+  801920:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  801926:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801929:	5b                   	pop    %ebx
+  80192a:	5e                   	pop    %esi
+  80192b:	5d                   	pop    %ebp
+  80192c:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  80192d:	a1 20 50 80 00       	mov    0x805020,%eax
+  801932:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  801938:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  80193a:	a1 20 50 80 00       	mov    0x805020,%eax
+  80193f:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  801945:	eb df                	jmp    801926 <ipc_recv+0x4d>
+  801947:	85 c0                	test   %eax,%eax
+  801949:	75 db                	jne    801926 <ipc_recv+0x4d>
+  80194b:	eb ed                	jmp    80193a <ipc_recv+0x61>
+
+0080194d <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  80194d:	55                   	push   %ebp
+  80194e:	89 e5                	mov    %esp,%ebp
+  801950:	57                   	push   %edi
+  801951:	56                   	push   %esi
+  801952:	53                   	push   %ebx
+  801953:	83 ec 0c             	sub    $0xc,%esp
+  801956:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801959:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80195c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  80195f:	85 db                	test   %ebx,%ebx
+  801961:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801966:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  801969:	ff 75 14             	push   0x14(%ebp)
+  80196c:	53                   	push   %ebx
+  80196d:	56                   	push   %esi
+  80196e:	57                   	push   %edi
+  80196f:	e8 08 fb ff ff       	call   80147c <sys_ipc_try_send>
+  801974:	83 c4 10             	add    $0x10,%esp
+  801977:	85 c0                	test   %eax,%eax
+  801979:	74 1e                	je     801999 <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  80197b:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80197e:	75 07                	jne    801987 <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  801980:	e8 4b f9 ff ff       	call   8012d0 <sys_yield>
+  801985:	eb e2                	jmp    801969 <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  801987:	50                   	push   %eax
+  801988:	68 1b 36 80 00       	push   $0x80361b
+  80198d:	6a 3c                	push   $0x3c
+  80198f:	68 28 36 80 00       	push   $0x803628
+  801994:	e8 d6 ee ff ff       	call   80086f <_panic>
+  }
+
+#endif
+}
+  801999:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80199c:	5b                   	pop    %ebx
+  80199d:	5e                   	pop    %esi
+  80199e:	5f                   	pop    %edi
+  80199f:	5d                   	pop    %ebp
+  8019a0:	c3                   	ret
+
+008019a1 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  8019a1:	55                   	push   %ebp
+  8019a2:	89 e5                	mov    %esp,%ebp
+  8019a4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  8019a7:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  8019ac:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8019af:	c1 e0 04             	shl    $0x4,%eax
+  8019b2:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8019b7:	8b 40 50             	mov    0x50(%eax),%eax
+  8019ba:	39 c8                	cmp    %ecx,%eax
+  8019bc:	74 12                	je     8019d0 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  8019be:	83 c2 01             	add    $0x1,%edx
+  8019c1:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8019c7:	75 e3                	jne    8019ac <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  8019c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019ce:	eb 0e                	jmp    8019de <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  8019d0:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8019d3:	c1 e0 04             	shl    $0x4,%eax
+  8019d6:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8019db:	8b 40 48             	mov    0x48(%eax),%eax
+  8019de:	5d                   	pop    %ebp
+  8019df:	c3                   	ret
+
+008019e0 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8019e0:	55                   	push   %ebp
+  8019e1:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8019e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019e6:	05 00 00 00 30       	add    $0x30000000,%eax
+  8019eb:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8019ee:	5d                   	pop    %ebp
+  8019ef:	c3                   	ret
+
+008019f0 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8019f0:	55                   	push   %ebp
+  8019f1:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8019f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019f6:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8019fb:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801a00:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801a05:	5d                   	pop    %ebp
+  801a06:	c3                   	ret
+
+00801a07 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801a07:	55                   	push   %ebp
+  801a08:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801a0a:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801a0f:	eb 02                	jmp    801a13 <fd_alloc+0xc>
+  801a11:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801a13:	89 c2                	mov    %eax,%edx
+  801a15:	c1 ea 16             	shr    $0x16,%edx
+  801a18:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801a1f:	f6 c2 01             	test   $0x1,%dl
+  801a22:	74 2b                	je     801a4f <fd_alloc+0x48>
+  801a24:	89 c2                	mov    %eax,%edx
+  801a26:	c1 ea 0c             	shr    $0xc,%edx
+  801a29:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801a30:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801a36:	f6 c1 01             	test   $0x1,%cl
+  801a39:	74 14                	je     801a4f <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801a3b:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801a41:	75 ce                	jne    801a11 <fd_alloc+0xa>
+  801a43:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801a48:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801a4d:	eb 05                	jmp    801a54 <fd_alloc+0x4d>
+			return 0;
+  801a4f:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801a54:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a57:	89 02                	mov    %eax,(%edx)
+}
+  801a59:	89 c8                	mov    %ecx,%eax
+  801a5b:	5d                   	pop    %ebp
+  801a5c:	c3                   	ret
+
+00801a5d <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801a5d:	55                   	push   %ebp
+  801a5e:	89 e5                	mov    %esp,%ebp
+  801a60:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801a63:	83 f8 1f             	cmp    $0x1f,%eax
+  801a66:	77 30                	ja     801a98 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801a68:	c1 e0 0c             	shl    $0xc,%eax
+  801a6b:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801a70:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801a76:	f6 c2 01             	test   $0x1,%dl
+  801a79:	74 24                	je     801a9f <fd_lookup+0x42>
+  801a7b:	89 c2                	mov    %eax,%edx
+  801a7d:	c1 ea 0c             	shr    $0xc,%edx
+  801a80:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801a87:	f6 c2 01             	test   $0x1,%dl
+  801a8a:	74 1a                	je     801aa6 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801a8c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a8f:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801a91:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a96:	5d                   	pop    %ebp
+  801a97:	c3                   	ret
+		return -E_INVAL;
+  801a98:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a9d:	eb f7                	jmp    801a96 <fd_lookup+0x39>
+		return -E_INVAL;
+  801a9f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801aa4:	eb f0                	jmp    801a96 <fd_lookup+0x39>
+  801aa6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801aab:	eb e9                	jmp    801a96 <fd_lookup+0x39>
+
+00801aad <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801aad:	55                   	push   %ebp
+  801aae:	89 e5                	mov    %esp,%ebp
+  801ab0:	53                   	push   %ebx
+  801ab1:	83 ec 04             	sub    $0x4,%esp
+  801ab4:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801ab7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801abc:	eb 03                	jmp    801ac1 <dev_lookup+0x14>
+  801abe:	83 c0 01             	add    $0x1,%eax
+  801ac1:	8b 1c 85 b0 36 80 00 	mov    0x8036b0(,%eax,4),%ebx
+  801ac8:	85 db                	test   %ebx,%ebx
+  801aca:	74 0b                	je     801ad7 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801acc:	39 13                	cmp    %edx,(%ebx)
+  801ace:	75 ee                	jne    801abe <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801ad0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ad5:	eb 1f                	jmp    801af6 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801ad7:	a1 20 50 80 00       	mov    0x805020,%eax
+  801adc:	8b 40 48             	mov    0x48(%eax),%eax
+  801adf:	83 ec 04             	sub    $0x4,%esp
+  801ae2:	52                   	push   %edx
+  801ae3:	50                   	push   %eax
+  801ae4:	68 34 36 80 00       	push   $0x803634
+  801ae9:	e8 5c ee ff ff       	call   80094a <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801aee:	83 c4 10             	add    $0x10,%esp
+  801af1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801af6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801af9:	89 1a                	mov    %ebx,(%edx)
+}
+  801afb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801afe:	c9                   	leave
+  801aff:	c3                   	ret
+
+00801b00 <fd_close>:
+{
+  801b00:	55                   	push   %ebp
+  801b01:	89 e5                	mov    %esp,%ebp
+  801b03:	57                   	push   %edi
+  801b04:	56                   	push   %esi
+  801b05:	53                   	push   %ebx
+  801b06:	83 ec 24             	sub    $0x24,%esp
+  801b09:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b0c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801b0f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801b12:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801b13:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801b19:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801b1c:	50                   	push   %eax
+  801b1d:	e8 3b ff ff ff       	call   801a5d <fd_lookup>
+  801b22:	89 c3                	mov    %eax,%ebx
+  801b24:	83 c4 10             	add    $0x10,%esp
+  801b27:	85 c0                	test   %eax,%eax
+  801b29:	78 05                	js     801b30 <fd_close+0x30>
+	    || fd != fd2)
+  801b2b:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801b2e:	74 16                	je     801b46 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801b30:	89 f8                	mov    %edi,%eax
+  801b32:	84 c0                	test   %al,%al
+  801b34:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b39:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801b3c:	89 d8                	mov    %ebx,%eax
+  801b3e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b41:	5b                   	pop    %ebx
+  801b42:	5e                   	pop    %esi
+  801b43:	5f                   	pop    %edi
+  801b44:	5d                   	pop    %ebp
+  801b45:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801b46:	83 ec 08             	sub    $0x8,%esp
+  801b49:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801b4c:	50                   	push   %eax
+  801b4d:	ff 36                	push   (%esi)
+  801b4f:	e8 59 ff ff ff       	call   801aad <dev_lookup>
+  801b54:	89 c3                	mov    %eax,%ebx
+  801b56:	83 c4 10             	add    $0x10,%esp
+  801b59:	85 c0                	test   %eax,%eax
+  801b5b:	78 1a                	js     801b77 <fd_close+0x77>
+		if (dev->dev_close)
+  801b5d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801b60:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801b63:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801b68:	85 c0                	test   %eax,%eax
+  801b6a:	74 0b                	je     801b77 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801b6c:	83 ec 0c             	sub    $0xc,%esp
+  801b6f:	56                   	push   %esi
+  801b70:	ff d0                	call   *%eax
+  801b72:	89 c3                	mov    %eax,%ebx
+  801b74:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801b77:	83 ec 08             	sub    $0x8,%esp
+  801b7a:	56                   	push   %esi
+  801b7b:	6a 00                	push   $0x0
+  801b7d:	e8 f2 f7 ff ff       	call   801374 <sys_page_unmap>
+	return r;
+  801b82:	83 c4 10             	add    $0x10,%esp
+  801b85:	eb b5                	jmp    801b3c <fd_close+0x3c>
+
+00801b87 <close>:
+
+int
+close(int fdnum)
+{
+  801b87:	55                   	push   %ebp
+  801b88:	89 e5                	mov    %esp,%ebp
+  801b8a:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801b8d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b90:	50                   	push   %eax
+  801b91:	ff 75 08             	push   0x8(%ebp)
+  801b94:	e8 c4 fe ff ff       	call   801a5d <fd_lookup>
+  801b99:	83 c4 10             	add    $0x10,%esp
+  801b9c:	85 c0                	test   %eax,%eax
+  801b9e:	79 02                	jns    801ba2 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801ba0:	c9                   	leave
+  801ba1:	c3                   	ret
+		return fd_close(fd, 1);
+  801ba2:	83 ec 08             	sub    $0x8,%esp
+  801ba5:	6a 01                	push   $0x1
+  801ba7:	ff 75 f4             	push   -0xc(%ebp)
+  801baa:	e8 51 ff ff ff       	call   801b00 <fd_close>
+  801baf:	83 c4 10             	add    $0x10,%esp
+  801bb2:	eb ec                	jmp    801ba0 <close+0x19>
+
+00801bb4 <close_all>:
+
+void
+close_all(void)
+{
+  801bb4:	55                   	push   %ebp
+  801bb5:	89 e5                	mov    %esp,%ebp
+  801bb7:	53                   	push   %ebx
+  801bb8:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801bbb:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801bc0:	83 ec 0c             	sub    $0xc,%esp
+  801bc3:	53                   	push   %ebx
+  801bc4:	e8 be ff ff ff       	call   801b87 <close>
+	for (i = 0; i < MAXFD; i++)
+  801bc9:	83 c3 01             	add    $0x1,%ebx
+  801bcc:	83 c4 10             	add    $0x10,%esp
+  801bcf:	83 fb 20             	cmp    $0x20,%ebx
+  801bd2:	75 ec                	jne    801bc0 <close_all+0xc>
+}
+  801bd4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bd7:	c9                   	leave
+  801bd8:	c3                   	ret
+
+00801bd9 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801bd9:	55                   	push   %ebp
+  801bda:	89 e5                	mov    %esp,%ebp
+  801bdc:	57                   	push   %edi
+  801bdd:	56                   	push   %esi
+  801bde:	53                   	push   %ebx
+  801bdf:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801be2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801be5:	50                   	push   %eax
+  801be6:	ff 75 08             	push   0x8(%ebp)
+  801be9:	e8 6f fe ff ff       	call   801a5d <fd_lookup>
+  801bee:	89 c3                	mov    %eax,%ebx
+  801bf0:	83 c4 10             	add    $0x10,%esp
+  801bf3:	85 c0                	test   %eax,%eax
+  801bf5:	78 7f                	js     801c76 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801bf7:	83 ec 0c             	sub    $0xc,%esp
+  801bfa:	ff 75 0c             	push   0xc(%ebp)
+  801bfd:	e8 85 ff ff ff       	call   801b87 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801c02:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801c05:	c1 e6 0c             	shl    $0xc,%esi
+  801c08:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801c0e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801c11:	89 3c 24             	mov    %edi,(%esp)
+  801c14:	e8 d7 fd ff ff       	call   8019f0 <fd2data>
+  801c19:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801c1b:	89 34 24             	mov    %esi,(%esp)
+  801c1e:	e8 cd fd ff ff       	call   8019f0 <fd2data>
+  801c23:	83 c4 10             	add    $0x10,%esp
+  801c26:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801c29:	89 d8                	mov    %ebx,%eax
+  801c2b:	c1 e8 16             	shr    $0x16,%eax
+  801c2e:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801c35:	a8 01                	test   $0x1,%al
+  801c37:	74 11                	je     801c4a <dup+0x71>
+  801c39:	89 d8                	mov    %ebx,%eax
+  801c3b:	c1 e8 0c             	shr    $0xc,%eax
+  801c3e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801c45:	f6 c2 01             	test   $0x1,%dl
+  801c48:	75 36                	jne    801c80 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801c4a:	89 f8                	mov    %edi,%eax
+  801c4c:	c1 e8 0c             	shr    $0xc,%eax
+  801c4f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801c56:	83 ec 0c             	sub    $0xc,%esp
+  801c59:	25 07 0e 00 00       	and    $0xe07,%eax
+  801c5e:	50                   	push   %eax
+  801c5f:	56                   	push   %esi
+  801c60:	6a 00                	push   $0x0
+  801c62:	57                   	push   %edi
+  801c63:	6a 00                	push   $0x0
+  801c65:	e8 c8 f6 ff ff       	call   801332 <sys_page_map>
+  801c6a:	89 c3                	mov    %eax,%ebx
+  801c6c:	83 c4 20             	add    $0x20,%esp
+  801c6f:	85 c0                	test   %eax,%eax
+  801c71:	78 33                	js     801ca6 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801c73:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801c76:	89 d8                	mov    %ebx,%eax
+  801c78:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c7b:	5b                   	pop    %ebx
+  801c7c:	5e                   	pop    %esi
+  801c7d:	5f                   	pop    %edi
+  801c7e:	5d                   	pop    %ebp
+  801c7f:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801c80:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801c87:	83 ec 0c             	sub    $0xc,%esp
+  801c8a:	25 07 0e 00 00       	and    $0xe07,%eax
+  801c8f:	50                   	push   %eax
+  801c90:	ff 75 d4             	push   -0x2c(%ebp)
+  801c93:	6a 00                	push   $0x0
+  801c95:	53                   	push   %ebx
+  801c96:	6a 00                	push   $0x0
+  801c98:	e8 95 f6 ff ff       	call   801332 <sys_page_map>
+  801c9d:	89 c3                	mov    %eax,%ebx
+  801c9f:	83 c4 20             	add    $0x20,%esp
+  801ca2:	85 c0                	test   %eax,%eax
+  801ca4:	79 a4                	jns    801c4a <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801ca6:	83 ec 08             	sub    $0x8,%esp
+  801ca9:	56                   	push   %esi
+  801caa:	6a 00                	push   $0x0
+  801cac:	e8 c3 f6 ff ff       	call   801374 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801cb1:	83 c4 08             	add    $0x8,%esp
+  801cb4:	ff 75 d4             	push   -0x2c(%ebp)
+  801cb7:	6a 00                	push   $0x0
+  801cb9:	e8 b6 f6 ff ff       	call   801374 <sys_page_unmap>
+	return r;
+  801cbe:	83 c4 10             	add    $0x10,%esp
+  801cc1:	eb b3                	jmp    801c76 <dup+0x9d>
+
+00801cc3 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801cc3:	55                   	push   %ebp
+  801cc4:	89 e5                	mov    %esp,%ebp
+  801cc6:	56                   	push   %esi
+  801cc7:	53                   	push   %ebx
+  801cc8:	83 ec 18             	sub    $0x18,%esp
+  801ccb:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801cce:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801cd1:	50                   	push   %eax
+  801cd2:	56                   	push   %esi
+  801cd3:	e8 85 fd ff ff       	call   801a5d <fd_lookup>
+  801cd8:	83 c4 10             	add    $0x10,%esp
+  801cdb:	85 c0                	test   %eax,%eax
+  801cdd:	78 3c                	js     801d1b <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801cdf:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801ce2:	83 ec 08             	sub    $0x8,%esp
+  801ce5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ce8:	50                   	push   %eax
+  801ce9:	ff 33                	push   (%ebx)
+  801ceb:	e8 bd fd ff ff       	call   801aad <dev_lookup>
+  801cf0:	83 c4 10             	add    $0x10,%esp
+  801cf3:	85 c0                	test   %eax,%eax
+  801cf5:	78 24                	js     801d1b <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801cf7:	8b 43 08             	mov    0x8(%ebx),%eax
+  801cfa:	83 e0 03             	and    $0x3,%eax
+  801cfd:	83 f8 01             	cmp    $0x1,%eax
+  801d00:	74 20                	je     801d22 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801d02:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d05:	8b 40 08             	mov    0x8(%eax),%eax
+  801d08:	85 c0                	test   %eax,%eax
+  801d0a:	74 37                	je     801d43 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801d0c:	83 ec 04             	sub    $0x4,%esp
+  801d0f:	ff 75 10             	push   0x10(%ebp)
+  801d12:	ff 75 0c             	push   0xc(%ebp)
+  801d15:	53                   	push   %ebx
+  801d16:	ff d0                	call   *%eax
+  801d18:	83 c4 10             	add    $0x10,%esp
+}
+  801d1b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d1e:	5b                   	pop    %ebx
+  801d1f:	5e                   	pop    %esi
+  801d20:	5d                   	pop    %ebp
+  801d21:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d22:	a1 20 50 80 00       	mov    0x805020,%eax
+  801d27:	8b 40 48             	mov    0x48(%eax),%eax
+  801d2a:	83 ec 04             	sub    $0x4,%esp
+  801d2d:	56                   	push   %esi
+  801d2e:	50                   	push   %eax
+  801d2f:	68 75 36 80 00       	push   $0x803675
+  801d34:	e8 11 ec ff ff       	call   80094a <cprintf>
+		return -E_INVAL;
+  801d39:	83 c4 10             	add    $0x10,%esp
+  801d3c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d41:	eb d8                	jmp    801d1b <read+0x58>
+		return -E_NOT_SUPP;
+  801d43:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d48:	eb d1                	jmp    801d1b <read+0x58>
+
+00801d4a <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801d4a:	55                   	push   %ebp
+  801d4b:	89 e5                	mov    %esp,%ebp
+  801d4d:	57                   	push   %edi
+  801d4e:	56                   	push   %esi
+  801d4f:	53                   	push   %ebx
+  801d50:	83 ec 0c             	sub    $0xc,%esp
+  801d53:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801d56:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801d59:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d5e:	eb 02                	jmp    801d62 <readn+0x18>
+  801d60:	01 c3                	add    %eax,%ebx
+  801d62:	39 f3                	cmp    %esi,%ebx
+  801d64:	73 21                	jae    801d87 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801d66:	83 ec 04             	sub    $0x4,%esp
+  801d69:	89 f0                	mov    %esi,%eax
+  801d6b:	29 d8                	sub    %ebx,%eax
+  801d6d:	50                   	push   %eax
+  801d6e:	89 d8                	mov    %ebx,%eax
+  801d70:	03 45 0c             	add    0xc(%ebp),%eax
+  801d73:	50                   	push   %eax
+  801d74:	57                   	push   %edi
+  801d75:	e8 49 ff ff ff       	call   801cc3 <read>
+		if (m < 0)
+  801d7a:	83 c4 10             	add    $0x10,%esp
+  801d7d:	85 c0                	test   %eax,%eax
+  801d7f:	78 04                	js     801d85 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801d81:	75 dd                	jne    801d60 <readn+0x16>
+  801d83:	eb 02                	jmp    801d87 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801d85:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801d87:	89 d8                	mov    %ebx,%eax
+  801d89:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d8c:	5b                   	pop    %ebx
+  801d8d:	5e                   	pop    %esi
+  801d8e:	5f                   	pop    %edi
+  801d8f:	5d                   	pop    %ebp
+  801d90:	c3                   	ret
+
+00801d91 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801d91:	55                   	push   %ebp
+  801d92:	89 e5                	mov    %esp,%ebp
+  801d94:	56                   	push   %esi
+  801d95:	53                   	push   %ebx
+  801d96:	83 ec 18             	sub    $0x18,%esp
+  801d99:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d9c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d9f:	50                   	push   %eax
+  801da0:	53                   	push   %ebx
+  801da1:	e8 b7 fc ff ff       	call   801a5d <fd_lookup>
+  801da6:	83 c4 10             	add    $0x10,%esp
+  801da9:	85 c0                	test   %eax,%eax
+  801dab:	78 37                	js     801de4 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801dad:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801db0:	83 ec 08             	sub    $0x8,%esp
+  801db3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801db6:	50                   	push   %eax
+  801db7:	ff 36                	push   (%esi)
+  801db9:	e8 ef fc ff ff       	call   801aad <dev_lookup>
+  801dbe:	83 c4 10             	add    $0x10,%esp
+  801dc1:	85 c0                	test   %eax,%eax
+  801dc3:	78 1f                	js     801de4 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801dc5:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801dc9:	74 20                	je     801deb <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801dcb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dce:	8b 40 0c             	mov    0xc(%eax),%eax
+  801dd1:	85 c0                	test   %eax,%eax
+  801dd3:	74 37                	je     801e0c <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801dd5:	83 ec 04             	sub    $0x4,%esp
+  801dd8:	ff 75 10             	push   0x10(%ebp)
+  801ddb:	ff 75 0c             	push   0xc(%ebp)
+  801dde:	56                   	push   %esi
+  801ddf:	ff d0                	call   *%eax
+  801de1:	83 c4 10             	add    $0x10,%esp
+}
+  801de4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801de7:	5b                   	pop    %ebx
+  801de8:	5e                   	pop    %esi
+  801de9:	5d                   	pop    %ebp
+  801dea:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801deb:	a1 20 50 80 00       	mov    0x805020,%eax
+  801df0:	8b 40 48             	mov    0x48(%eax),%eax
+  801df3:	83 ec 04             	sub    $0x4,%esp
+  801df6:	53                   	push   %ebx
+  801df7:	50                   	push   %eax
+  801df8:	68 91 36 80 00       	push   $0x803691
+  801dfd:	e8 48 eb ff ff       	call   80094a <cprintf>
+		return -E_INVAL;
+  801e02:	83 c4 10             	add    $0x10,%esp
+  801e05:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e0a:	eb d8                	jmp    801de4 <write+0x53>
+		return -E_NOT_SUPP;
+  801e0c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e11:	eb d1                	jmp    801de4 <write+0x53>
+
+00801e13 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801e13:	55                   	push   %ebp
+  801e14:	89 e5                	mov    %esp,%ebp
+  801e16:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801e19:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e1c:	50                   	push   %eax
+  801e1d:	ff 75 08             	push   0x8(%ebp)
+  801e20:	e8 38 fc ff ff       	call   801a5d <fd_lookup>
+  801e25:	83 c4 10             	add    $0x10,%esp
+  801e28:	85 c0                	test   %eax,%eax
+  801e2a:	78 0e                	js     801e3a <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801e2c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e2f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e32:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801e35:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e3a:	c9                   	leave
+  801e3b:	c3                   	ret
+
+00801e3c <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801e3c:	55                   	push   %ebp
+  801e3d:	89 e5                	mov    %esp,%ebp
+  801e3f:	56                   	push   %esi
+  801e40:	53                   	push   %ebx
+  801e41:	83 ec 18             	sub    $0x18,%esp
+  801e44:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801e47:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e4a:	50                   	push   %eax
+  801e4b:	53                   	push   %ebx
+  801e4c:	e8 0c fc ff ff       	call   801a5d <fd_lookup>
+  801e51:	83 c4 10             	add    $0x10,%esp
+  801e54:	85 c0                	test   %eax,%eax
+  801e56:	78 34                	js     801e8c <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801e58:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801e5b:	83 ec 08             	sub    $0x8,%esp
+  801e5e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e61:	50                   	push   %eax
+  801e62:	ff 36                	push   (%esi)
+  801e64:	e8 44 fc ff ff       	call   801aad <dev_lookup>
+  801e69:	83 c4 10             	add    $0x10,%esp
+  801e6c:	85 c0                	test   %eax,%eax
+  801e6e:	78 1c                	js     801e8c <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e70:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801e74:	74 1d                	je     801e93 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801e76:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e79:	8b 40 18             	mov    0x18(%eax),%eax
+  801e7c:	85 c0                	test   %eax,%eax
+  801e7e:	74 34                	je     801eb4 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801e80:	83 ec 08             	sub    $0x8,%esp
+  801e83:	ff 75 0c             	push   0xc(%ebp)
+  801e86:	56                   	push   %esi
+  801e87:	ff d0                	call   *%eax
+  801e89:	83 c4 10             	add    $0x10,%esp
+}
+  801e8c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e8f:	5b                   	pop    %ebx
+  801e90:	5e                   	pop    %esi
+  801e91:	5d                   	pop    %ebp
+  801e92:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801e93:	a1 20 50 80 00       	mov    0x805020,%eax
+  801e98:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801e9b:	83 ec 04             	sub    $0x4,%esp
+  801e9e:	53                   	push   %ebx
+  801e9f:	50                   	push   %eax
+  801ea0:	68 54 36 80 00       	push   $0x803654
+  801ea5:	e8 a0 ea ff ff       	call   80094a <cprintf>
+		return -E_INVAL;
+  801eaa:	83 c4 10             	add    $0x10,%esp
+  801ead:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801eb2:	eb d8                	jmp    801e8c <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801eb4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801eb9:	eb d1                	jmp    801e8c <ftruncate+0x50>
+
+00801ebb <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801ebb:	55                   	push   %ebp
+  801ebc:	89 e5                	mov    %esp,%ebp
+  801ebe:	56                   	push   %esi
+  801ebf:	53                   	push   %ebx
+  801ec0:	83 ec 18             	sub    $0x18,%esp
+  801ec3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801ec6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ec9:	50                   	push   %eax
+  801eca:	ff 75 08             	push   0x8(%ebp)
+  801ecd:	e8 8b fb ff ff       	call   801a5d <fd_lookup>
+  801ed2:	83 c4 10             	add    $0x10,%esp
+  801ed5:	85 c0                	test   %eax,%eax
+  801ed7:	78 49                	js     801f22 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801ed9:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801edc:	83 ec 08             	sub    $0x8,%esp
+  801edf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ee2:	50                   	push   %eax
+  801ee3:	ff 36                	push   (%esi)
+  801ee5:	e8 c3 fb ff ff       	call   801aad <dev_lookup>
+  801eea:	83 c4 10             	add    $0x10,%esp
+  801eed:	85 c0                	test   %eax,%eax
+  801eef:	78 31                	js     801f22 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801ef1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ef4:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801ef8:	74 2f                	je     801f29 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801efa:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801efd:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801f04:	00 00 00 
+	stat->st_isdir = 0;
+  801f07:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801f0e:	00 00 00 
+	stat->st_dev = dev;
+  801f11:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801f17:	83 ec 08             	sub    $0x8,%esp
+  801f1a:	53                   	push   %ebx
+  801f1b:	56                   	push   %esi
+  801f1c:	ff 50 14             	call   *0x14(%eax)
+  801f1f:	83 c4 10             	add    $0x10,%esp
+}
+  801f22:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f25:	5b                   	pop    %ebx
+  801f26:	5e                   	pop    %esi
+  801f27:	5d                   	pop    %ebp
+  801f28:	c3                   	ret
+		return -E_NOT_SUPP;
+  801f29:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f2e:	eb f2                	jmp    801f22 <fstat+0x67>
+
+00801f30 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801f30:	55                   	push   %ebp
+  801f31:	89 e5                	mov    %esp,%ebp
+  801f33:	56                   	push   %esi
+  801f34:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801f35:	83 ec 08             	sub    $0x8,%esp
+  801f38:	6a 00                	push   $0x0
+  801f3a:	ff 75 08             	push   0x8(%ebp)
+  801f3d:	e8 e4 01 00 00       	call   802126 <open>
+  801f42:	89 c3                	mov    %eax,%ebx
+  801f44:	83 c4 10             	add    $0x10,%esp
+  801f47:	85 c0                	test   %eax,%eax
+  801f49:	78 1b                	js     801f66 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801f4b:	83 ec 08             	sub    $0x8,%esp
+  801f4e:	ff 75 0c             	push   0xc(%ebp)
+  801f51:	50                   	push   %eax
+  801f52:	e8 64 ff ff ff       	call   801ebb <fstat>
+  801f57:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801f59:	89 1c 24             	mov    %ebx,(%esp)
+  801f5c:	e8 26 fc ff ff       	call   801b87 <close>
+	return r;
+  801f61:	83 c4 10             	add    $0x10,%esp
+  801f64:	89 f3                	mov    %esi,%ebx
+}
+  801f66:	89 d8                	mov    %ebx,%eax
+  801f68:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f6b:	5b                   	pop    %ebx
+  801f6c:	5e                   	pop    %esi
+  801f6d:	5d                   	pop    %ebp
+  801f6e:	c3                   	ret
+
+00801f6f <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  801f6f:	55                   	push   %ebp
+  801f70:	89 e5                	mov    %esp,%ebp
+  801f72:	56                   	push   %esi
+  801f73:	53                   	push   %ebx
+  801f74:	89 c6                	mov    %eax,%esi
+  801f76:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  801f78:	83 3d 18 50 80 00 00 	cmpl   $0x0,0x805018
+  801f7f:	74 27                	je     801fa8 <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801f81:	6a 07                	push   $0x7
+  801f83:	68 00 60 80 00       	push   $0x806000
+  801f88:	56                   	push   %esi
+  801f89:	ff 35 18 50 80 00    	push   0x805018
+  801f8f:	e8 b9 f9 ff ff       	call   80194d <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  801f94:	83 c4 0c             	add    $0xc,%esp
+  801f97:	6a 00                	push   $0x0
+  801f99:	53                   	push   %ebx
+  801f9a:	6a 00                	push   $0x0
+  801f9c:	e8 38 f9 ff ff       	call   8018d9 <ipc_recv>
+}
+  801fa1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fa4:	5b                   	pop    %ebx
+  801fa5:	5e                   	pop    %esi
+  801fa6:	5d                   	pop    %ebp
+  801fa7:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  801fa8:	83 ec 0c             	sub    $0xc,%esp
+  801fab:	6a 01                	push   $0x1
+  801fad:	e8 ef f9 ff ff       	call   8019a1 <ipc_find_env>
+  801fb2:	a3 18 50 80 00       	mov    %eax,0x805018
+  801fb7:	83 c4 10             	add    $0x10,%esp
+  801fba:	eb c5                	jmp    801f81 <fsipc+0x12>
+
+00801fbc <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801fbc:	55                   	push   %ebp
+  801fbd:	89 e5                	mov    %esp,%ebp
+  801fbf:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801fc2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fc5:	8b 40 0c             	mov    0xc(%eax),%eax
+  801fc8:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.set_size.req_size = newsize;
+  801fcd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fd0:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801fd5:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fda:	b8 02 00 00 00       	mov    $0x2,%eax
+  801fdf:	e8 8b ff ff ff       	call   801f6f <fsipc>
+}
+  801fe4:	c9                   	leave
+  801fe5:	c3                   	ret
+
+00801fe6 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801fe6:	55                   	push   %ebp
+  801fe7:	89 e5                	mov    %esp,%ebp
+  801fe9:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801fec:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fef:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ff2:	a3 00 60 80 00       	mov    %eax,0x806000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801ff7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ffc:	b8 06 00 00 00       	mov    $0x6,%eax
+  802001:	e8 69 ff ff ff       	call   801f6f <fsipc>
+}
+  802006:	c9                   	leave
+  802007:	c3                   	ret
+
+00802008 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802008:	55                   	push   %ebp
+  802009:	89 e5                	mov    %esp,%ebp
+  80200b:	53                   	push   %ebx
+  80200c:	83 ec 04             	sub    $0x4,%esp
+  80200f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802012:	8b 45 08             	mov    0x8(%ebp),%eax
+  802015:	8b 40 0c             	mov    0xc(%eax),%eax
+  802018:	a3 00 60 80 00       	mov    %eax,0x806000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80201d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802022:	b8 05 00 00 00       	mov    $0x5,%eax
+  802027:	e8 43 ff ff ff       	call   801f6f <fsipc>
+  80202c:	85 c0                	test   %eax,%eax
+  80202e:	78 2c                	js     80205c <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802030:	83 ec 08             	sub    $0x8,%esp
+  802033:	68 00 60 80 00       	push   $0x806000
+  802038:	53                   	push   %ebx
+  802039:	e8 c5 ee ff ff       	call   800f03 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  80203e:	a1 80 60 80 00       	mov    0x806080,%eax
+  802043:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802049:	a1 84 60 80 00       	mov    0x806084,%eax
+  80204e:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  802054:	83 c4 10             	add    $0x10,%esp
+  802057:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80205c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80205f:	c9                   	leave
+  802060:	c3                   	ret
+
+00802061 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802061:	55                   	push   %ebp
+  802062:	89 e5                	mov    %esp,%ebp
+  802064:	83 ec 0c             	sub    $0xc,%esp
+  802067:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80206a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80206d:	8b 52 0c             	mov    0xc(%edx),%edx
+  802070:	89 15 00 60 80 00    	mov    %edx,0x806000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  802076:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  80207b:	39 d0                	cmp    %edx,%eax
+  80207d:	0f 47 c2             	cmova  %edx,%eax
+  802080:	a3 04 60 80 00       	mov    %eax,0x806004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  802085:	50                   	push   %eax
+  802086:	ff 75 0c             	push   0xc(%ebp)
+  802089:	68 08 60 80 00       	push   $0x806008
+  80208e:	e8 f6 ef ff ff       	call   801089 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  802093:	ba 00 00 00 00       	mov    $0x0,%edx
+  802098:	b8 04 00 00 00       	mov    $0x4,%eax
+  80209d:	e8 cd fe ff ff       	call   801f6f <fsipc>
+}
+  8020a2:	c9                   	leave
+  8020a3:	c3                   	ret
+
+008020a4 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8020a4:	55                   	push   %ebp
+  8020a5:	89 e5                	mov    %esp,%ebp
+  8020a7:	56                   	push   %esi
+  8020a8:	53                   	push   %ebx
+  8020a9:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8020ac:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020af:	8b 40 0c             	mov    0xc(%eax),%eax
+  8020b2:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read.req_n = n;
+  8020b7:	89 35 04 60 80 00    	mov    %esi,0x806004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8020bd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020c2:	b8 03 00 00 00       	mov    $0x3,%eax
+  8020c7:	e8 a3 fe ff ff       	call   801f6f <fsipc>
+  8020cc:	89 c3                	mov    %eax,%ebx
+  8020ce:	85 c0                	test   %eax,%eax
+  8020d0:	78 1f                	js     8020f1 <devfile_read+0x4d>
+  assert(r <= n);
+  8020d2:	39 c6                	cmp    %eax,%esi
+  8020d4:	72 24                	jb     8020fa <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  8020d6:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8020db:	7f 33                	jg     802110 <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8020dd:	83 ec 04             	sub    $0x4,%esp
+  8020e0:	50                   	push   %eax
+  8020e1:	68 00 60 80 00       	push   $0x806000
+  8020e6:	ff 75 0c             	push   0xc(%ebp)
+  8020e9:	e8 9b ef ff ff       	call   801089 <memmove>
+  return r;
+  8020ee:	83 c4 10             	add    $0x10,%esp
+}
+  8020f1:	89 d8                	mov    %ebx,%eax
+  8020f3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020f6:	5b                   	pop    %ebx
+  8020f7:	5e                   	pop    %esi
+  8020f8:	5d                   	pop    %ebp
+  8020f9:	c3                   	ret
+  assert(r <= n);
+  8020fa:	68 c4 36 80 00       	push   $0x8036c4
+  8020ff:	68 cb 36 80 00       	push   $0x8036cb
+  802104:	6a 78                	push   $0x78
+  802106:	68 e0 36 80 00       	push   $0x8036e0
+  80210b:	e8 5f e7 ff ff       	call   80086f <_panic>
+  assert(r <= PGSIZE);
+  802110:	68 eb 36 80 00       	push   $0x8036eb
+  802115:	68 cb 36 80 00       	push   $0x8036cb
+  80211a:	6a 79                	push   $0x79
+  80211c:	68 e0 36 80 00       	push   $0x8036e0
+  802121:	e8 49 e7 ff ff       	call   80086f <_panic>
+
+00802126 <open>:
+open(const char *path, int mode) {
+  802126:	55                   	push   %ebp
+  802127:	89 e5                	mov    %esp,%ebp
+  802129:	56                   	push   %esi
+  80212a:	53                   	push   %ebx
+  80212b:	83 ec 1c             	sub    $0x1c,%esp
+  80212e:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  802131:	56                   	push   %esi
+  802132:	e8 91 ed ff ff       	call   800ec8 <strlen>
+  802137:	83 c4 10             	add    $0x10,%esp
+  80213a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80213f:	7f 6c                	jg     8021ad <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  802141:	83 ec 0c             	sub    $0xc,%esp
+  802144:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802147:	50                   	push   %eax
+  802148:	e8 ba f8 ff ff       	call   801a07 <fd_alloc>
+  80214d:	89 c3                	mov    %eax,%ebx
+  80214f:	83 c4 10             	add    $0x10,%esp
+  802152:	85 c0                	test   %eax,%eax
+  802154:	78 3c                	js     802192 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  802156:	83 ec 08             	sub    $0x8,%esp
+  802159:	56                   	push   %esi
+  80215a:	68 00 60 80 00       	push   $0x806000
+  80215f:	e8 9f ed ff ff       	call   800f03 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  802164:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802167:	a3 00 64 80 00       	mov    %eax,0x806400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80216c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80216f:	b8 01 00 00 00       	mov    $0x1,%eax
+  802174:	e8 f6 fd ff ff       	call   801f6f <fsipc>
+  802179:	89 c3                	mov    %eax,%ebx
+  80217b:	83 c4 10             	add    $0x10,%esp
+  80217e:	85 c0                	test   %eax,%eax
+  802180:	78 19                	js     80219b <open+0x75>
+  return fd2num(fd);
+  802182:	83 ec 0c             	sub    $0xc,%esp
+  802185:	ff 75 f4             	push   -0xc(%ebp)
+  802188:	e8 53 f8 ff ff       	call   8019e0 <fd2num>
+  80218d:	89 c3                	mov    %eax,%ebx
+  80218f:	83 c4 10             	add    $0x10,%esp
+}
+  802192:	89 d8                	mov    %ebx,%eax
+  802194:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802197:	5b                   	pop    %ebx
+  802198:	5e                   	pop    %esi
+  802199:	5d                   	pop    %ebp
+  80219a:	c3                   	ret
+    fd_close(fd, 0);
+  80219b:	83 ec 08             	sub    $0x8,%esp
+  80219e:	6a 00                	push   $0x0
+  8021a0:	ff 75 f4             	push   -0xc(%ebp)
+  8021a3:	e8 58 f9 ff ff       	call   801b00 <fd_close>
+    return r;
+  8021a8:	83 c4 10             	add    $0x10,%esp
+  8021ab:	eb e5                	jmp    802192 <open+0x6c>
+    return -E_BAD_PATH;
+  8021ad:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8021b2:	eb de                	jmp    802192 <open+0x6c>
+
+008021b4 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  8021b4:	55                   	push   %ebp
+  8021b5:	89 e5                	mov    %esp,%ebp
+  8021b7:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  8021ba:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021bf:	b8 08 00 00 00       	mov    $0x8,%eax
+  8021c4:	e8 a6 fd ff ff       	call   801f6f <fsipc>
+}
+  8021c9:	c9                   	leave
+  8021ca:	c3                   	ret
+
+008021cb <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8021cb:	55                   	push   %ebp
+  8021cc:	89 e5                	mov    %esp,%ebp
+  8021ce:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8021d1:	68 f7 36 80 00       	push   $0x8036f7
+  8021d6:	ff 75 0c             	push   0xc(%ebp)
+  8021d9:	e8 25 ed ff ff       	call   800f03 <strcpy>
+	return 0;
+}
+  8021de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021e3:	c9                   	leave
+  8021e4:	c3                   	ret
+
+008021e5 <devsock_close>:
+{
+  8021e5:	55                   	push   %ebp
+  8021e6:	89 e5                	mov    %esp,%ebp
+  8021e8:	53                   	push   %ebx
+  8021e9:	83 ec 10             	sub    $0x10,%esp
+  8021ec:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8021ef:	53                   	push   %ebx
+  8021f0:	e8 8b 09 00 00       	call   802b80 <pageref>
+  8021f5:	89 c2                	mov    %eax,%edx
+  8021f7:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8021fa:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8021ff:	83 fa 01             	cmp    $0x1,%edx
+  802202:	74 05                	je     802209 <devsock_close+0x24>
+}
+  802204:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802207:	c9                   	leave
+  802208:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802209:	83 ec 0c             	sub    $0xc,%esp
+  80220c:	ff 73 0c             	push   0xc(%ebx)
+  80220f:	e8 b7 02 00 00       	call   8024cb <nsipc_close>
+  802214:	83 c4 10             	add    $0x10,%esp
+  802217:	eb eb                	jmp    802204 <devsock_close+0x1f>
+
+00802219 <devsock_write>:
+{
+  802219:	55                   	push   %ebp
+  80221a:	89 e5                	mov    %esp,%ebp
+  80221c:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  80221f:	6a 00                	push   $0x0
+  802221:	ff 75 10             	push   0x10(%ebp)
+  802224:	ff 75 0c             	push   0xc(%ebp)
+  802227:	8b 45 08             	mov    0x8(%ebp),%eax
+  80222a:	ff 70 0c             	push   0xc(%eax)
+  80222d:	e8 79 03 00 00       	call   8025ab <nsipc_send>
+}
+  802232:	c9                   	leave
+  802233:	c3                   	ret
+
+00802234 <devsock_read>:
+{
+  802234:	55                   	push   %ebp
+  802235:	89 e5                	mov    %esp,%ebp
+  802237:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  80223a:	6a 00                	push   $0x0
+  80223c:	ff 75 10             	push   0x10(%ebp)
+  80223f:	ff 75 0c             	push   0xc(%ebp)
+  802242:	8b 45 08             	mov    0x8(%ebp),%eax
+  802245:	ff 70 0c             	push   0xc(%eax)
+  802248:	e8 ef 02 00 00       	call   80253c <nsipc_recv>
+}
+  80224d:	c9                   	leave
+  80224e:	c3                   	ret
+
+0080224f <fd2sockid>:
+{
+  80224f:	55                   	push   %ebp
+  802250:	89 e5                	mov    %esp,%ebp
+  802252:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802255:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802258:	52                   	push   %edx
+  802259:	50                   	push   %eax
+  80225a:	e8 fe f7 ff ff       	call   801a5d <fd_lookup>
+  80225f:	83 c4 10             	add    $0x10,%esp
+  802262:	85 c0                	test   %eax,%eax
+  802264:	78 10                	js     802276 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802266:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802269:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  80226f:	39 08                	cmp    %ecx,(%eax)
+  802271:	75 05                	jne    802278 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802273:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802276:	c9                   	leave
+  802277:	c3                   	ret
+		return -E_NOT_SUPP;
+  802278:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80227d:	eb f7                	jmp    802276 <fd2sockid+0x27>
+
+0080227f <alloc_sockfd>:
+{
+  80227f:	55                   	push   %ebp
+  802280:	89 e5                	mov    %esp,%ebp
+  802282:	56                   	push   %esi
+  802283:	53                   	push   %ebx
+  802284:	83 ec 1c             	sub    $0x1c,%esp
+  802287:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802289:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80228c:	50                   	push   %eax
+  80228d:	e8 75 f7 ff ff       	call   801a07 <fd_alloc>
+  802292:	89 c3                	mov    %eax,%ebx
+  802294:	83 c4 10             	add    $0x10,%esp
+  802297:	85 c0                	test   %eax,%eax
+  802299:	78 43                	js     8022de <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80229b:	83 ec 04             	sub    $0x4,%esp
+  80229e:	68 07 04 00 00       	push   $0x407
+  8022a3:	ff 75 f4             	push   -0xc(%ebp)
+  8022a6:	6a 00                	push   $0x0
+  8022a8:	e8 42 f0 ff ff       	call   8012ef <sys_page_alloc>
+  8022ad:	89 c3                	mov    %eax,%ebx
+  8022af:	83 c4 10             	add    $0x10,%esp
+  8022b2:	85 c0                	test   %eax,%eax
+  8022b4:	78 28                	js     8022de <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8022b6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022b9:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  8022bf:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8022c1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022c4:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8022cb:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8022ce:	83 ec 0c             	sub    $0xc,%esp
+  8022d1:	50                   	push   %eax
+  8022d2:	e8 09 f7 ff ff       	call   8019e0 <fd2num>
+  8022d7:	89 c3                	mov    %eax,%ebx
+  8022d9:	83 c4 10             	add    $0x10,%esp
+  8022dc:	eb 0c                	jmp    8022ea <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8022de:	83 ec 0c             	sub    $0xc,%esp
+  8022e1:	56                   	push   %esi
+  8022e2:	e8 e4 01 00 00       	call   8024cb <nsipc_close>
+		return r;
+  8022e7:	83 c4 10             	add    $0x10,%esp
+}
+  8022ea:	89 d8                	mov    %ebx,%eax
+  8022ec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022ef:	5b                   	pop    %ebx
+  8022f0:	5e                   	pop    %esi
+  8022f1:	5d                   	pop    %ebp
+  8022f2:	c3                   	ret
+
+008022f3 <accept>:
+{
+  8022f3:	55                   	push   %ebp
+  8022f4:	89 e5                	mov    %esp,%ebp
+  8022f6:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8022f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022fc:	e8 4e ff ff ff       	call   80224f <fd2sockid>
+  802301:	85 c0                	test   %eax,%eax
+  802303:	78 1b                	js     802320 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802305:	83 ec 04             	sub    $0x4,%esp
+  802308:	ff 75 10             	push   0x10(%ebp)
+  80230b:	ff 75 0c             	push   0xc(%ebp)
+  80230e:	50                   	push   %eax
+  80230f:	e8 0e 01 00 00       	call   802422 <nsipc_accept>
+  802314:	83 c4 10             	add    $0x10,%esp
+  802317:	85 c0                	test   %eax,%eax
+  802319:	78 05                	js     802320 <accept+0x2d>
+	return alloc_sockfd(r);
+  80231b:	e8 5f ff ff ff       	call   80227f <alloc_sockfd>
+}
+  802320:	c9                   	leave
+  802321:	c3                   	ret
+
+00802322 <bind>:
+{
+  802322:	55                   	push   %ebp
+  802323:	89 e5                	mov    %esp,%ebp
+  802325:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802328:	8b 45 08             	mov    0x8(%ebp),%eax
+  80232b:	e8 1f ff ff ff       	call   80224f <fd2sockid>
+  802330:	85 c0                	test   %eax,%eax
+  802332:	78 12                	js     802346 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802334:	83 ec 04             	sub    $0x4,%esp
+  802337:	ff 75 10             	push   0x10(%ebp)
+  80233a:	ff 75 0c             	push   0xc(%ebp)
+  80233d:	50                   	push   %eax
+  80233e:	e8 31 01 00 00       	call   802474 <nsipc_bind>
+  802343:	83 c4 10             	add    $0x10,%esp
+}
+  802346:	c9                   	leave
+  802347:	c3                   	ret
+
+00802348 <shutdown>:
+{
+  802348:	55                   	push   %ebp
+  802349:	89 e5                	mov    %esp,%ebp
+  80234b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80234e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802351:	e8 f9 fe ff ff       	call   80224f <fd2sockid>
+  802356:	85 c0                	test   %eax,%eax
+  802358:	78 0f                	js     802369 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  80235a:	83 ec 08             	sub    $0x8,%esp
+  80235d:	ff 75 0c             	push   0xc(%ebp)
+  802360:	50                   	push   %eax
+  802361:	e8 43 01 00 00       	call   8024a9 <nsipc_shutdown>
+  802366:	83 c4 10             	add    $0x10,%esp
+}
+  802369:	c9                   	leave
+  80236a:	c3                   	ret
+
+0080236b <connect>:
+{
+  80236b:	55                   	push   %ebp
+  80236c:	89 e5                	mov    %esp,%ebp
+  80236e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802371:	8b 45 08             	mov    0x8(%ebp),%eax
+  802374:	e8 d6 fe ff ff       	call   80224f <fd2sockid>
+  802379:	85 c0                	test   %eax,%eax
+  80237b:	78 12                	js     80238f <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  80237d:	83 ec 04             	sub    $0x4,%esp
+  802380:	ff 75 10             	push   0x10(%ebp)
+  802383:	ff 75 0c             	push   0xc(%ebp)
+  802386:	50                   	push   %eax
+  802387:	e8 59 01 00 00       	call   8024e5 <nsipc_connect>
+  80238c:	83 c4 10             	add    $0x10,%esp
+}
+  80238f:	c9                   	leave
+  802390:	c3                   	ret
+
+00802391 <listen>:
+{
+  802391:	55                   	push   %ebp
+  802392:	89 e5                	mov    %esp,%ebp
+  802394:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802397:	8b 45 08             	mov    0x8(%ebp),%eax
+  80239a:	e8 b0 fe ff ff       	call   80224f <fd2sockid>
+  80239f:	85 c0                	test   %eax,%eax
+  8023a1:	78 0f                	js     8023b2 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8023a3:	83 ec 08             	sub    $0x8,%esp
+  8023a6:	ff 75 0c             	push   0xc(%ebp)
+  8023a9:	50                   	push   %eax
+  8023aa:	e8 6b 01 00 00       	call   80251a <nsipc_listen>
+  8023af:	83 c4 10             	add    $0x10,%esp
+}
+  8023b2:	c9                   	leave
+  8023b3:	c3                   	ret
+
+008023b4 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8023b4:	55                   	push   %ebp
+  8023b5:	89 e5                	mov    %esp,%ebp
+  8023b7:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8023ba:	ff 75 10             	push   0x10(%ebp)
+  8023bd:	ff 75 0c             	push   0xc(%ebp)
+  8023c0:	ff 75 08             	push   0x8(%ebp)
+  8023c3:	e8 41 02 00 00       	call   802609 <nsipc_socket>
+  8023c8:	83 c4 10             	add    $0x10,%esp
+  8023cb:	85 c0                	test   %eax,%eax
+  8023cd:	78 05                	js     8023d4 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8023cf:	e8 ab fe ff ff       	call   80227f <alloc_sockfd>
+}
+  8023d4:	c9                   	leave
+  8023d5:	c3                   	ret
+
+008023d6 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8023d6:	55                   	push   %ebp
+  8023d7:	89 e5                	mov    %esp,%ebp
+  8023d9:	53                   	push   %ebx
+  8023da:	83 ec 04             	sub    $0x4,%esp
+  8023dd:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  8023df:	83 3d 1c 50 80 00 00 	cmpl   $0x0,0x80501c
+  8023e6:	74 26                	je     80240e <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8023e8:	6a 07                	push   $0x7
+  8023ea:	68 00 70 80 00       	push   $0x807000
+  8023ef:	53                   	push   %ebx
+  8023f0:	ff 35 1c 50 80 00    	push   0x80501c
+  8023f6:	e8 52 f5 ff ff       	call   80194d <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8023fb:	83 c4 0c             	add    $0xc,%esp
+  8023fe:	6a 00                	push   $0x0
+  802400:	6a 00                	push   $0x0
+  802402:	6a 00                	push   $0x0
+  802404:	e8 d0 f4 ff ff       	call   8018d9 <ipc_recv>
+}
+  802409:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80240c:	c9                   	leave
+  80240d:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80240e:	83 ec 0c             	sub    $0xc,%esp
+  802411:	6a 02                	push   $0x2
+  802413:	e8 89 f5 ff ff       	call   8019a1 <ipc_find_env>
+  802418:	a3 1c 50 80 00       	mov    %eax,0x80501c
+  80241d:	83 c4 10             	add    $0x10,%esp
+  802420:	eb c6                	jmp    8023e8 <nsipc+0x12>
+
+00802422 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802422:	55                   	push   %ebp
+  802423:	89 e5                	mov    %esp,%ebp
+  802425:	56                   	push   %esi
+  802426:	53                   	push   %ebx
+  802427:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  80242a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80242d:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802432:	8b 06                	mov    (%esi),%eax
+  802434:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802439:	b8 01 00 00 00       	mov    $0x1,%eax
+  80243e:	e8 93 ff ff ff       	call   8023d6 <nsipc>
+  802443:	89 c3                	mov    %eax,%ebx
+  802445:	85 c0                	test   %eax,%eax
+  802447:	79 09                	jns    802452 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802449:	89 d8                	mov    %ebx,%eax
+  80244b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80244e:	5b                   	pop    %ebx
+  80244f:	5e                   	pop    %esi
+  802450:	5d                   	pop    %ebp
+  802451:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802452:	83 ec 04             	sub    $0x4,%esp
+  802455:	ff 35 10 70 80 00    	push   0x807010
+  80245b:	68 00 70 80 00       	push   $0x807000
+  802460:	ff 75 0c             	push   0xc(%ebp)
+  802463:	e8 21 ec ff ff       	call   801089 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802468:	a1 10 70 80 00       	mov    0x807010,%eax
+  80246d:	89 06                	mov    %eax,(%esi)
+  80246f:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802472:	eb d5                	jmp    802449 <nsipc_accept+0x27>
+
+00802474 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802474:	55                   	push   %ebp
+  802475:	89 e5                	mov    %esp,%ebp
+  802477:	53                   	push   %ebx
+  802478:	83 ec 08             	sub    $0x8,%esp
+  80247b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  80247e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802481:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802486:	53                   	push   %ebx
+  802487:	ff 75 0c             	push   0xc(%ebp)
+  80248a:	68 04 70 80 00       	push   $0x807004
+  80248f:	e8 f5 eb ff ff       	call   801089 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802494:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  80249a:	b8 02 00 00 00       	mov    $0x2,%eax
+  80249f:	e8 32 ff ff ff       	call   8023d6 <nsipc>
+}
+  8024a4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024a7:	c9                   	leave
+  8024a8:	c3                   	ret
+
+008024a9 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8024a9:	55                   	push   %ebp
+  8024aa:	89 e5                	mov    %esp,%ebp
+  8024ac:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8024af:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024b2:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  8024b7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024ba:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  8024bf:	b8 03 00 00 00       	mov    $0x3,%eax
+  8024c4:	e8 0d ff ff ff       	call   8023d6 <nsipc>
+}
+  8024c9:	c9                   	leave
+  8024ca:	c3                   	ret
+
+008024cb <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8024cb:	55                   	push   %ebp
+  8024cc:	89 e5                	mov    %esp,%ebp
+  8024ce:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8024d1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024d4:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  8024d9:	b8 04 00 00 00       	mov    $0x4,%eax
+  8024de:	e8 f3 fe ff ff       	call   8023d6 <nsipc>
+}
+  8024e3:	c9                   	leave
+  8024e4:	c3                   	ret
+
+008024e5 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8024e5:	55                   	push   %ebp
+  8024e6:	89 e5                	mov    %esp,%ebp
+  8024e8:	53                   	push   %ebx
+  8024e9:	83 ec 08             	sub    $0x8,%esp
+  8024ec:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8024ef:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024f2:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8024f7:	53                   	push   %ebx
+  8024f8:	ff 75 0c             	push   0xc(%ebp)
+  8024fb:	68 04 70 80 00       	push   $0x807004
+  802500:	e8 84 eb ff ff       	call   801089 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802505:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  80250b:	b8 05 00 00 00       	mov    $0x5,%eax
+  802510:	e8 c1 fe ff ff       	call   8023d6 <nsipc>
+}
+  802515:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802518:	c9                   	leave
+  802519:	c3                   	ret
+
+0080251a <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  80251a:	55                   	push   %ebp
+  80251b:	89 e5                	mov    %esp,%ebp
+  80251d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802520:	8b 45 08             	mov    0x8(%ebp),%eax
+  802523:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  802528:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80252b:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  802530:	b8 06 00 00 00       	mov    $0x6,%eax
+  802535:	e8 9c fe ff ff       	call   8023d6 <nsipc>
+}
+  80253a:	c9                   	leave
+  80253b:	c3                   	ret
+
+0080253c <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  80253c:	55                   	push   %ebp
+  80253d:	89 e5                	mov    %esp,%ebp
+  80253f:	56                   	push   %esi
+  802540:	53                   	push   %ebx
+  802541:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802544:	8b 45 08             	mov    0x8(%ebp),%eax
+  802547:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  80254c:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  802552:	8b 45 14             	mov    0x14(%ebp),%eax
+  802555:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  80255a:	b8 07 00 00 00       	mov    $0x7,%eax
+  80255f:	e8 72 fe ff ff       	call   8023d6 <nsipc>
+  802564:	89 c3                	mov    %eax,%ebx
+  802566:	85 c0                	test   %eax,%eax
+  802568:	78 22                	js     80258c <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  80256a:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80256f:	39 c6                	cmp    %eax,%esi
+  802571:	0f 4e c6             	cmovle %esi,%eax
+  802574:	39 c3                	cmp    %eax,%ebx
+  802576:	7f 1d                	jg     802595 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802578:	83 ec 04             	sub    $0x4,%esp
+  80257b:	53                   	push   %ebx
+  80257c:	68 00 70 80 00       	push   $0x807000
+  802581:	ff 75 0c             	push   0xc(%ebp)
+  802584:	e8 00 eb ff ff       	call   801089 <memmove>
+  802589:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  80258c:	89 d8                	mov    %ebx,%eax
+  80258e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802591:	5b                   	pop    %ebx
+  802592:	5e                   	pop    %esi
+  802593:	5d                   	pop    %ebp
+  802594:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802595:	68 03 37 80 00       	push   $0x803703
+  80259a:	68 cb 36 80 00       	push   $0x8036cb
+  80259f:	6a 62                	push   $0x62
+  8025a1:	68 18 37 80 00       	push   $0x803718
+  8025a6:	e8 c4 e2 ff ff       	call   80086f <_panic>
+
+008025ab <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8025ab:	55                   	push   %ebp
+  8025ac:	89 e5                	mov    %esp,%ebp
+  8025ae:	53                   	push   %ebx
+  8025af:	83 ec 04             	sub    $0x4,%esp
+  8025b2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8025b5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025b8:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  8025bd:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8025c3:	7f 2e                	jg     8025f3 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8025c5:	83 ec 04             	sub    $0x4,%esp
+  8025c8:	53                   	push   %ebx
+  8025c9:	ff 75 0c             	push   0xc(%ebp)
+  8025cc:	68 0c 70 80 00       	push   $0x80700c
+  8025d1:	e8 b3 ea ff ff       	call   801089 <memmove>
+	nsipcbuf.send.req_size = size;
+  8025d6:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  8025dc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8025df:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  8025e4:	b8 08 00 00 00       	mov    $0x8,%eax
+  8025e9:	e8 e8 fd ff ff       	call   8023d6 <nsipc>
+}
+  8025ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025f1:	c9                   	leave
+  8025f2:	c3                   	ret
+	assert(size < 1600);
+  8025f3:	68 24 37 80 00       	push   $0x803724
+  8025f8:	68 cb 36 80 00       	push   $0x8036cb
+  8025fd:	6a 6d                	push   $0x6d
+  8025ff:	68 18 37 80 00       	push   $0x803718
+  802604:	e8 66 e2 ff ff       	call   80086f <_panic>
+
+00802609 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802609:	55                   	push   %ebp
+  80260a:	89 e5                	mov    %esp,%ebp
+  80260c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  80260f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802612:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  802617:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80261a:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  80261f:	8b 45 10             	mov    0x10(%ebp),%eax
+  802622:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  802627:	b8 09 00 00 00       	mov    $0x9,%eax
+  80262c:	e8 a5 fd ff ff       	call   8023d6 <nsipc>
+}
+  802631:	c9                   	leave
+  802632:	c3                   	ret
+
+00802633 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802633:	55                   	push   %ebp
+  802634:	89 e5                	mov    %esp,%ebp
+  802636:	56                   	push   %esi
+  802637:	53                   	push   %ebx
+  802638:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80263b:	83 ec 0c             	sub    $0xc,%esp
+  80263e:	ff 75 08             	push   0x8(%ebp)
+  802641:	e8 aa f3 ff ff       	call   8019f0 <fd2data>
+  802646:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802648:	83 c4 08             	add    $0x8,%esp
+  80264b:	68 30 37 80 00       	push   $0x803730
+  802650:	53                   	push   %ebx
+  802651:	e8 ad e8 ff ff       	call   800f03 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802656:	8b 46 04             	mov    0x4(%esi),%eax
+  802659:	2b 06                	sub    (%esi),%eax
+  80265b:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802661:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802668:	00 00 00 
+	stat->st_dev = &devpipe;
+  80266b:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  802672:	40 80 00 
+	return 0;
+}
+  802675:	b8 00 00 00 00       	mov    $0x0,%eax
+  80267a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80267d:	5b                   	pop    %ebx
+  80267e:	5e                   	pop    %esi
+  80267f:	5d                   	pop    %ebp
+  802680:	c3                   	ret
+
+00802681 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802681:	55                   	push   %ebp
+  802682:	89 e5                	mov    %esp,%ebp
+  802684:	53                   	push   %ebx
+  802685:	83 ec 0c             	sub    $0xc,%esp
+  802688:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  80268b:	53                   	push   %ebx
+  80268c:	6a 00                	push   $0x0
+  80268e:	e8 e1 ec ff ff       	call   801374 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802693:	89 1c 24             	mov    %ebx,(%esp)
+  802696:	e8 55 f3 ff ff       	call   8019f0 <fd2data>
+  80269b:	83 c4 08             	add    $0x8,%esp
+  80269e:	50                   	push   %eax
+  80269f:	6a 00                	push   $0x0
+  8026a1:	e8 ce ec ff ff       	call   801374 <sys_page_unmap>
+}
+  8026a6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026a9:	c9                   	leave
+  8026aa:	c3                   	ret
+
+008026ab <_pipeisclosed>:
+{
+  8026ab:	55                   	push   %ebp
+  8026ac:	89 e5                	mov    %esp,%ebp
+  8026ae:	57                   	push   %edi
+  8026af:	56                   	push   %esi
+  8026b0:	53                   	push   %ebx
+  8026b1:	83 ec 1c             	sub    $0x1c,%esp
+  8026b4:	89 c7                	mov    %eax,%edi
+  8026b6:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  8026b8:	a1 20 50 80 00       	mov    0x805020,%eax
+  8026bd:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8026c0:	83 ec 0c             	sub    $0xc,%esp
+  8026c3:	57                   	push   %edi
+  8026c4:	e8 b7 04 00 00       	call   802b80 <pageref>
+  8026c9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8026cc:	89 34 24             	mov    %esi,(%esp)
+  8026cf:	e8 ac 04 00 00       	call   802b80 <pageref>
+		nn = thisenv->env_runs;
+  8026d4:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  8026da:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  8026dd:	83 c4 10             	add    $0x10,%esp
+  8026e0:	39 cb                	cmp    %ecx,%ebx
+  8026e2:	74 1b                	je     8026ff <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  8026e4:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8026e7:	75 cf                	jne    8026b8 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8026e9:	8b 42 58             	mov    0x58(%edx),%eax
+  8026ec:	6a 01                	push   $0x1
+  8026ee:	50                   	push   %eax
+  8026ef:	53                   	push   %ebx
+  8026f0:	68 37 37 80 00       	push   $0x803737
+  8026f5:	e8 50 e2 ff ff       	call   80094a <cprintf>
+  8026fa:	83 c4 10             	add    $0x10,%esp
+  8026fd:	eb b9                	jmp    8026b8 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  8026ff:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802702:	0f 94 c0             	sete   %al
+  802705:	0f b6 c0             	movzbl %al,%eax
+}
+  802708:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80270b:	5b                   	pop    %ebx
+  80270c:	5e                   	pop    %esi
+  80270d:	5f                   	pop    %edi
+  80270e:	5d                   	pop    %ebp
+  80270f:	c3                   	ret
+
+00802710 <devpipe_write>:
+{
+  802710:	55                   	push   %ebp
+  802711:	89 e5                	mov    %esp,%ebp
+  802713:	57                   	push   %edi
+  802714:	56                   	push   %esi
+  802715:	53                   	push   %ebx
+  802716:	83 ec 28             	sub    $0x28,%esp
+  802719:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  80271c:	56                   	push   %esi
+  80271d:	e8 ce f2 ff ff       	call   8019f0 <fd2data>
+  802722:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802724:	83 c4 10             	add    $0x10,%esp
+  802727:	bf 00 00 00 00       	mov    $0x0,%edi
+  80272c:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  80272f:	75 09                	jne    80273a <devpipe_write+0x2a>
+	return i;
+  802731:	89 f8                	mov    %edi,%eax
+  802733:	eb 23                	jmp    802758 <devpipe_write+0x48>
+			sys_yield();
+  802735:	e8 96 eb ff ff       	call   8012d0 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80273a:	8b 43 04             	mov    0x4(%ebx),%eax
+  80273d:	8b 0b                	mov    (%ebx),%ecx
+  80273f:	8d 51 20             	lea    0x20(%ecx),%edx
+  802742:	39 d0                	cmp    %edx,%eax
+  802744:	72 1a                	jb     802760 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802746:	89 da                	mov    %ebx,%edx
+  802748:	89 f0                	mov    %esi,%eax
+  80274a:	e8 5c ff ff ff       	call   8026ab <_pipeisclosed>
+  80274f:	85 c0                	test   %eax,%eax
+  802751:	74 e2                	je     802735 <devpipe_write+0x25>
+				return 0;
+  802753:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802758:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80275b:	5b                   	pop    %ebx
+  80275c:	5e                   	pop    %esi
+  80275d:	5f                   	pop    %edi
+  80275e:	5d                   	pop    %ebp
+  80275f:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802760:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802763:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802767:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  80276a:	89 c2                	mov    %eax,%edx
+  80276c:	c1 fa 1f             	sar    $0x1f,%edx
+  80276f:	89 d1                	mov    %edx,%ecx
+  802771:	c1 e9 1b             	shr    $0x1b,%ecx
+  802774:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802777:	83 e2 1f             	and    $0x1f,%edx
+  80277a:	29 ca                	sub    %ecx,%edx
+  80277c:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802780:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802784:	83 c0 01             	add    $0x1,%eax
+  802787:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  80278a:	83 c7 01             	add    $0x1,%edi
+  80278d:	eb 9d                	jmp    80272c <devpipe_write+0x1c>
+
+0080278f <devpipe_read>:
+{
+  80278f:	55                   	push   %ebp
+  802790:	89 e5                	mov    %esp,%ebp
+  802792:	57                   	push   %edi
+  802793:	56                   	push   %esi
+  802794:	53                   	push   %ebx
+  802795:	83 ec 18             	sub    $0x18,%esp
+  802798:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  80279b:	57                   	push   %edi
+  80279c:	e8 4f f2 ff ff       	call   8019f0 <fd2data>
+  8027a1:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8027a3:	83 c4 10             	add    $0x10,%esp
+  8027a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8027ab:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8027ae:	75 13                	jne    8027c3 <devpipe_read+0x34>
+	return i;
+  8027b0:	89 f0                	mov    %esi,%eax
+  8027b2:	eb 02                	jmp    8027b6 <devpipe_read+0x27>
+				return i;
+  8027b4:	89 f0                	mov    %esi,%eax
+}
+  8027b6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027b9:	5b                   	pop    %ebx
+  8027ba:	5e                   	pop    %esi
+  8027bb:	5f                   	pop    %edi
+  8027bc:	5d                   	pop    %ebp
+  8027bd:	c3                   	ret
+			sys_yield();
+  8027be:	e8 0d eb ff ff       	call   8012d0 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  8027c3:	8b 03                	mov    (%ebx),%eax
+  8027c5:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8027c8:	75 18                	jne    8027e2 <devpipe_read+0x53>
+			if (i > 0)
+  8027ca:	85 f6                	test   %esi,%esi
+  8027cc:	75 e6                	jne    8027b4 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  8027ce:	89 da                	mov    %ebx,%edx
+  8027d0:	89 f8                	mov    %edi,%eax
+  8027d2:	e8 d4 fe ff ff       	call   8026ab <_pipeisclosed>
+  8027d7:	85 c0                	test   %eax,%eax
+  8027d9:	74 e3                	je     8027be <devpipe_read+0x2f>
+				return 0;
+  8027db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027e0:	eb d4                	jmp    8027b6 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8027e2:	99                   	cltd
+  8027e3:	c1 ea 1b             	shr    $0x1b,%edx
+  8027e6:	01 d0                	add    %edx,%eax
+  8027e8:	83 e0 1f             	and    $0x1f,%eax
+  8027eb:	29 d0                	sub    %edx,%eax
+  8027ed:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8027f2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8027f5:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8027f8:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8027fb:	83 c6 01             	add    $0x1,%esi
+  8027fe:	eb ab                	jmp    8027ab <devpipe_read+0x1c>
+
+00802800 <pipe>:
+{
+  802800:	55                   	push   %ebp
+  802801:	89 e5                	mov    %esp,%ebp
+  802803:	56                   	push   %esi
+  802804:	53                   	push   %ebx
+  802805:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802808:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80280b:	50                   	push   %eax
+  80280c:	e8 f6 f1 ff ff       	call   801a07 <fd_alloc>
+  802811:	89 c3                	mov    %eax,%ebx
+  802813:	83 c4 10             	add    $0x10,%esp
+  802816:	85 c0                	test   %eax,%eax
+  802818:	0f 88 23 01 00 00    	js     802941 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80281e:	83 ec 04             	sub    $0x4,%esp
+  802821:	68 07 04 00 00       	push   $0x407
+  802826:	ff 75 f4             	push   -0xc(%ebp)
+  802829:	6a 00                	push   $0x0
+  80282b:	e8 bf ea ff ff       	call   8012ef <sys_page_alloc>
+  802830:	89 c3                	mov    %eax,%ebx
+  802832:	83 c4 10             	add    $0x10,%esp
+  802835:	85 c0                	test   %eax,%eax
+  802837:	0f 88 04 01 00 00    	js     802941 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80283d:	83 ec 0c             	sub    $0xc,%esp
+  802840:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802843:	50                   	push   %eax
+  802844:	e8 be f1 ff ff       	call   801a07 <fd_alloc>
+  802849:	89 c3                	mov    %eax,%ebx
+  80284b:	83 c4 10             	add    $0x10,%esp
+  80284e:	85 c0                	test   %eax,%eax
+  802850:	0f 88 db 00 00 00    	js     802931 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802856:	83 ec 04             	sub    $0x4,%esp
+  802859:	68 07 04 00 00       	push   $0x407
+  80285e:	ff 75 f0             	push   -0x10(%ebp)
+  802861:	6a 00                	push   $0x0
+  802863:	e8 87 ea ff ff       	call   8012ef <sys_page_alloc>
+  802868:	89 c3                	mov    %eax,%ebx
+  80286a:	83 c4 10             	add    $0x10,%esp
+  80286d:	85 c0                	test   %eax,%eax
+  80286f:	0f 88 bc 00 00 00    	js     802931 <pipe+0x131>
+	va = fd2data(fd0);
+  802875:	83 ec 0c             	sub    $0xc,%esp
+  802878:	ff 75 f4             	push   -0xc(%ebp)
+  80287b:	e8 70 f1 ff ff       	call   8019f0 <fd2data>
+  802880:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802882:	83 c4 0c             	add    $0xc,%esp
+  802885:	68 07 04 00 00       	push   $0x407
+  80288a:	50                   	push   %eax
+  80288b:	6a 00                	push   $0x0
+  80288d:	e8 5d ea ff ff       	call   8012ef <sys_page_alloc>
+  802892:	89 c3                	mov    %eax,%ebx
+  802894:	83 c4 10             	add    $0x10,%esp
+  802897:	85 c0                	test   %eax,%eax
+  802899:	0f 88 82 00 00 00    	js     802921 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80289f:	83 ec 0c             	sub    $0xc,%esp
+  8028a2:	ff 75 f0             	push   -0x10(%ebp)
+  8028a5:	e8 46 f1 ff ff       	call   8019f0 <fd2data>
+  8028aa:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8028b1:	50                   	push   %eax
+  8028b2:	6a 00                	push   $0x0
+  8028b4:	56                   	push   %esi
+  8028b5:	6a 00                	push   $0x0
+  8028b7:	e8 76 ea ff ff       	call   801332 <sys_page_map>
+  8028bc:	89 c3                	mov    %eax,%ebx
+  8028be:	83 c4 20             	add    $0x20,%esp
+  8028c1:	85 c0                	test   %eax,%eax
+  8028c3:	78 4e                	js     802913 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8028c5:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  8028ca:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8028cd:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8028cf:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8028d2:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8028d9:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8028dc:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8028de:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8028e1:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8028e8:	83 ec 0c             	sub    $0xc,%esp
+  8028eb:	ff 75 f4             	push   -0xc(%ebp)
+  8028ee:	e8 ed f0 ff ff       	call   8019e0 <fd2num>
+  8028f3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8028f6:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8028f8:	83 c4 04             	add    $0x4,%esp
+  8028fb:	ff 75 f0             	push   -0x10(%ebp)
+  8028fe:	e8 dd f0 ff ff       	call   8019e0 <fd2num>
+  802903:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802906:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802909:	83 c4 10             	add    $0x10,%esp
+  80290c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802911:	eb 2e                	jmp    802941 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802913:	83 ec 08             	sub    $0x8,%esp
+  802916:	56                   	push   %esi
+  802917:	6a 00                	push   $0x0
+  802919:	e8 56 ea ff ff       	call   801374 <sys_page_unmap>
+  80291e:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802921:	83 ec 08             	sub    $0x8,%esp
+  802924:	ff 75 f0             	push   -0x10(%ebp)
+  802927:	6a 00                	push   $0x0
+  802929:	e8 46 ea ff ff       	call   801374 <sys_page_unmap>
+  80292e:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802931:	83 ec 08             	sub    $0x8,%esp
+  802934:	ff 75 f4             	push   -0xc(%ebp)
+  802937:	6a 00                	push   $0x0
+  802939:	e8 36 ea ff ff       	call   801374 <sys_page_unmap>
+  80293e:	83 c4 10             	add    $0x10,%esp
+}
+  802941:	89 d8                	mov    %ebx,%eax
+  802943:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802946:	5b                   	pop    %ebx
+  802947:	5e                   	pop    %esi
+  802948:	5d                   	pop    %ebp
+  802949:	c3                   	ret
+
+0080294a <pipeisclosed>:
+{
+  80294a:	55                   	push   %ebp
+  80294b:	89 e5                	mov    %esp,%ebp
+  80294d:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802950:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802953:	50                   	push   %eax
+  802954:	ff 75 08             	push   0x8(%ebp)
+  802957:	e8 01 f1 ff ff       	call   801a5d <fd_lookup>
+  80295c:	83 c4 10             	add    $0x10,%esp
+  80295f:	85 c0                	test   %eax,%eax
+  802961:	78 18                	js     80297b <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802963:	83 ec 0c             	sub    $0xc,%esp
+  802966:	ff 75 f4             	push   -0xc(%ebp)
+  802969:	e8 82 f0 ff ff       	call   8019f0 <fd2data>
+  80296e:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802970:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802973:	e8 33 fd ff ff       	call   8026ab <_pipeisclosed>
+  802978:	83 c4 10             	add    $0x10,%esp
+}
+  80297b:	c9                   	leave
+  80297c:	c3                   	ret
+
+0080297d <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80297d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802982:	c3                   	ret
+
+00802983 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802983:	55                   	push   %ebp
+  802984:	89 e5                	mov    %esp,%ebp
+  802986:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802989:	68 4f 37 80 00       	push   $0x80374f
+  80298e:	ff 75 0c             	push   0xc(%ebp)
+  802991:	e8 6d e5 ff ff       	call   800f03 <strcpy>
+	return 0;
+}
+  802996:	b8 00 00 00 00       	mov    $0x0,%eax
+  80299b:	c9                   	leave
+  80299c:	c3                   	ret
+
+0080299d <devcons_write>:
+{
+  80299d:	55                   	push   %ebp
+  80299e:	89 e5                	mov    %esp,%ebp
+  8029a0:	57                   	push   %edi
+  8029a1:	56                   	push   %esi
+  8029a2:	53                   	push   %ebx
+  8029a3:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8029a9:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8029ae:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8029b4:	eb 2e                	jmp    8029e4 <devcons_write+0x47>
+		m = n - tot;
+  8029b6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8029b9:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8029bb:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8029c0:	39 c3                	cmp    %eax,%ebx
+  8029c2:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8029c5:	83 ec 04             	sub    $0x4,%esp
+  8029c8:	53                   	push   %ebx
+  8029c9:	89 f0                	mov    %esi,%eax
+  8029cb:	03 45 0c             	add    0xc(%ebp),%eax
+  8029ce:	50                   	push   %eax
+  8029cf:	57                   	push   %edi
+  8029d0:	e8 b4 e6 ff ff       	call   801089 <memmove>
+		sys_cputs(buf, m);
+  8029d5:	83 c4 08             	add    $0x8,%esp
+  8029d8:	53                   	push   %ebx
+  8029d9:	57                   	push   %edi
+  8029da:	e8 54 e8 ff ff       	call   801233 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8029df:	01 de                	add    %ebx,%esi
+  8029e1:	83 c4 10             	add    $0x10,%esp
+  8029e4:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8029e7:	72 cd                	jb     8029b6 <devcons_write+0x19>
+}
+  8029e9:	89 f0                	mov    %esi,%eax
+  8029eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029ee:	5b                   	pop    %ebx
+  8029ef:	5e                   	pop    %esi
+  8029f0:	5f                   	pop    %edi
+  8029f1:	5d                   	pop    %ebp
+  8029f2:	c3                   	ret
+
+008029f3 <devcons_read>:
+{
+  8029f3:	55                   	push   %ebp
+  8029f4:	89 e5                	mov    %esp,%ebp
+  8029f6:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8029f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029fe:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802a02:	75 07                	jne    802a0b <devcons_read+0x18>
+  802a04:	eb 1f                	jmp    802a25 <devcons_read+0x32>
+		sys_yield();
+  802a06:	e8 c5 e8 ff ff       	call   8012d0 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802a0b:	e8 41 e8 ff ff       	call   801251 <sys_cgetc>
+  802a10:	85 c0                	test   %eax,%eax
+  802a12:	74 f2                	je     802a06 <devcons_read+0x13>
+	if (c < 0)
+  802a14:	78 0f                	js     802a25 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802a16:	83 f8 04             	cmp    $0x4,%eax
+  802a19:	74 0c                	je     802a27 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802a1b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802a1e:	88 02                	mov    %al,(%edx)
+	return 1;
+  802a20:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802a25:	c9                   	leave
+  802a26:	c3                   	ret
+		return 0;
+  802a27:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a2c:	eb f7                	jmp    802a25 <devcons_read+0x32>
+
+00802a2e <cputchar>:
+{
+  802a2e:	55                   	push   %ebp
+  802a2f:	89 e5                	mov    %esp,%ebp
+  802a31:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802a34:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a37:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802a3a:	6a 01                	push   $0x1
+  802a3c:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802a3f:	50                   	push   %eax
+  802a40:	e8 ee e7 ff ff       	call   801233 <sys_cputs>
+}
+  802a45:	83 c4 10             	add    $0x10,%esp
+  802a48:	c9                   	leave
+  802a49:	c3                   	ret
+
+00802a4a <getchar>:
+{
+  802a4a:	55                   	push   %ebp
+  802a4b:	89 e5                	mov    %esp,%ebp
+  802a4d:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802a50:	6a 01                	push   $0x1
+  802a52:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802a55:	50                   	push   %eax
+  802a56:	6a 00                	push   $0x0
+  802a58:	e8 66 f2 ff ff       	call   801cc3 <read>
+	if (r < 0)
+  802a5d:	83 c4 10             	add    $0x10,%esp
+  802a60:	85 c0                	test   %eax,%eax
+  802a62:	78 06                	js     802a6a <getchar+0x20>
+	if (r < 1)
+  802a64:	74 06                	je     802a6c <getchar+0x22>
+	return c;
+  802a66:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802a6a:	c9                   	leave
+  802a6b:	c3                   	ret
+		return -E_EOF;
+  802a6c:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802a71:	eb f7                	jmp    802a6a <getchar+0x20>
+
+00802a73 <iscons>:
+{
+  802a73:	55                   	push   %ebp
+  802a74:	89 e5                	mov    %esp,%ebp
+  802a76:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802a79:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a7c:	50                   	push   %eax
+  802a7d:	ff 75 08             	push   0x8(%ebp)
+  802a80:	e8 d8 ef ff ff       	call   801a5d <fd_lookup>
+  802a85:	83 c4 10             	add    $0x10,%esp
+  802a88:	85 c0                	test   %eax,%eax
+  802a8a:	78 11                	js     802a9d <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802a8c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a8f:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802a95:	39 10                	cmp    %edx,(%eax)
+  802a97:	0f 94 c0             	sete   %al
+  802a9a:	0f b6 c0             	movzbl %al,%eax
+}
+  802a9d:	c9                   	leave
+  802a9e:	c3                   	ret
+
+00802a9f <opencons>:
+{
+  802a9f:	55                   	push   %ebp
+  802aa0:	89 e5                	mov    %esp,%ebp
+  802aa2:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802aa5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802aa8:	50                   	push   %eax
+  802aa9:	e8 59 ef ff ff       	call   801a07 <fd_alloc>
+  802aae:	83 c4 10             	add    $0x10,%esp
+  802ab1:	85 c0                	test   %eax,%eax
+  802ab3:	78 3a                	js     802aef <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802ab5:	83 ec 04             	sub    $0x4,%esp
+  802ab8:	68 07 04 00 00       	push   $0x407
+  802abd:	ff 75 f4             	push   -0xc(%ebp)
+  802ac0:	6a 00                	push   $0x0
+  802ac2:	e8 28 e8 ff ff       	call   8012ef <sys_page_alloc>
+  802ac7:	83 c4 10             	add    $0x10,%esp
+  802aca:	85 c0                	test   %eax,%eax
+  802acc:	78 21                	js     802aef <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802ace:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ad1:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802ad7:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802ad9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802adc:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802ae3:	83 ec 0c             	sub    $0xc,%esp
+  802ae6:	50                   	push   %eax
+  802ae7:	e8 f4 ee ff ff       	call   8019e0 <fd2num>
+  802aec:	83 c4 10             	add    $0x10,%esp
+}
+  802aef:	c9                   	leave
+  802af0:	c3                   	ret
+
+00802af1 <set_pgfault_handler>:
+// allocate an exception stack (one page of memory with its top
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf)) {
+  802af1:	55                   	push   %ebp
+  802af2:	89 e5                	mov    %esp,%ebp
+  802af4:	83 ec 08             	sub    $0x8,%esp
+  int r;
+
+  if (_pgfault_handler == 0) {
+  802af7:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  802afe:	74 0a                	je     802b0a <set_pgfault_handler+0x19>
+    if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)))
+      panic(" set_pgfault_handler sys_env_set_pgfault_upcall panic: %e\n", r);
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  802b00:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b03:	a3 00 80 80 00       	mov    %eax,0x808000
+
+
+}
+  802b08:	c9                   	leave
+  802b09:	c3                   	ret
+    if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)))
+  802b0a:	83 ec 04             	sub    $0x4,%esp
+  802b0d:	6a 07                	push   $0x7
+  802b0f:	68 00 f0 bf ee       	push   $0xeebff000
+  802b14:	6a 00                	push   $0x0
+  802b16:	e8 d4 e7 ff ff       	call   8012ef <sys_page_alloc>
+  802b1b:	83 c4 10             	add    $0x10,%esp
+  802b1e:	85 c0                	test   %eax,%eax
+  802b20:	75 28                	jne    802b4a <set_pgfault_handler+0x59>
+    if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)))
+  802b22:	83 ec 08             	sub    $0x8,%esp
+  802b25:	68 5c 2b 80 00       	push   $0x802b5c
+  802b2a:	6a 00                	push   $0x0
+  802b2c:	e8 09 e9 ff ff       	call   80143a <sys_env_set_pgfault_upcall>
+  802b31:	83 c4 10             	add    $0x10,%esp
+  802b34:	85 c0                	test   %eax,%eax
+  802b36:	74 c8                	je     802b00 <set_pgfault_handler+0xf>
+      panic(" set_pgfault_handler sys_env_set_pgfault_upcall panic: %e\n", r);
+  802b38:	50                   	push   %eax
+  802b39:	68 8c 37 80 00       	push   $0x80378c
+  802b3e:	6a 22                	push   $0x22
+  802b40:	68 c7 37 80 00       	push   $0x8037c7
+  802b45:	e8 25 dd ff ff       	call   80086f <_panic>
+      panic("set_pgfault_handler sys_page_alloc panic: %e\n", r);
+  802b4a:	50                   	push   %eax
+  802b4b:	68 5c 37 80 00       	push   $0x80375c
+  802b50:	6a 20                	push   $0x20
+  802b52:	68 c7 37 80 00       	push   $0x8037c7
+  802b57:	e8 13 dd ff ff       	call   80086f <_panic>
+
+00802b5c <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  802b5c:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  802b5d:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  802b62:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  802b64:	83 c4 04             	add    $0x4,%esp
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	// push the trap-time %eip onto the trap-time stack
+    subl $0x4, 0x30(%esp) # for push eip
+  802b67:	83 6c 24 30 04       	subl   $0x4,0x30(%esp)
+    movl 0x30(%esp), %ebx #regular esp
+  802b6c:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+    movl 0x28(%esp), %eax #eip
+  802b70:	8b 44 24 28          	mov    0x28(%esp),%eax
+    movl %eax, (%ebx)
+  802b74:	89 03                	mov    %eax,(%ebx)
+
+    // Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+    addl $8, %esp
+  802b76:	83 c4 08             	add    $0x8,%esp
+    popal
+  802b79:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  802b7a:	83 c4 04             	add    $0x4,%esp
+	popfl
+  802b7d:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  802b7e:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  802b7f:	c3                   	ret
+
+00802b80 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802b80:	55                   	push   %ebp
+  802b81:	89 e5                	mov    %esp,%ebp
+  802b83:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802b86:	89 c2                	mov    %eax,%edx
+  802b88:	c1 ea 16             	shr    $0x16,%edx
+  802b8b:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802b92:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802b97:	f6 c1 01             	test   $0x1,%cl
+  802b9a:	74 1c                	je     802bb8 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  802b9c:	c1 e8 0c             	shr    $0xc,%eax
+  802b9f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802ba6:	a8 01                	test   $0x1,%al
+  802ba8:	74 0e                	je     802bb8 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802baa:	c1 e8 0c             	shr    $0xc,%eax
+  802bad:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802bb4:	ef 
+  802bb5:	0f b7 d2             	movzwl %dx,%edx
+}
+  802bb8:	89 d0                	mov    %edx,%eax
+  802bba:	5d                   	pop    %ebp
+  802bbb:	c3                   	ret
+  802bbc:	66 90                	xchg   %ax,%ax
+  802bbe:	66 90                	xchg   %ax,%ax
+
+00802bc0 <__udivmoddi4>:
+  802bc0:	55                   	push   %ebp
+  802bc1:	57                   	push   %edi
+  802bc2:	56                   	push   %esi
+  802bc3:	53                   	push   %ebx
+  802bc4:	83 ec 24             	sub    $0x24,%esp
+  802bc7:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802bcb:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802bcf:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  802bd3:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802bd7:	8b 54 24 44          	mov    0x44(%esp),%edx
+  802bdb:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802bdf:	8b 44 24 40          	mov    0x40(%esp),%eax
+  802be3:	89 d3                	mov    %edx,%ebx
+  802be5:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802be9:	09 c3                	or     %eax,%ebx
+  802beb:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802bef:	0f 84 9c 00 00 00    	je     802c91 <__udivmoddi4+0xd1>
+  802bf5:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802bfc:	00 
+  802bfd:	31 c0                	xor    %eax,%eax
+  802bff:	31 d2                	xor    %edx,%edx
+  802c01:	89 fb                	mov    %edi,%ebx
+  802c03:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802c0a:	00 
+  802c0b:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802c10:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802c14:	01 c0                	add    %eax,%eax
+  802c16:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802c1d:	00 
+  802c1e:	89 c6                	mov    %eax,%esi
+  802c20:	89 d7                	mov    %edx,%edi
+  802c22:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802c26:	8b 54 24 14          	mov    0x14(%esp),%edx
+  802c2a:	0f ad d0             	shrd   %cl,%edx,%eax
+  802c2d:	d3 ea                	shr    %cl,%edx
+  802c2f:	f6 c1 20             	test   $0x20,%cl
+  802c32:	0f 45 c2             	cmovne %edx,%eax
+  802c35:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802c39:	83 e0 01             	and    $0x1,%eax
+  802c3c:	09 fa                	or     %edi,%edx
+  802c3e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802c42:	89 04 24             	mov    %eax,(%esp)
+  802c45:	8b 04 24             	mov    (%esp),%eax
+  802c48:	89 d5                	mov    %edx,%ebp
+  802c4a:	09 f0                	or     %esi,%eax
+  802c4c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802c50:	39 f0                	cmp    %esi,%eax
+  802c52:	19 fd                	sbb    %edi,%ebp
+  802c54:	72 1d                	jb     802c73 <__udivmoddi4+0xb3>
+  802c56:	29 f0                	sub    %esi,%eax
+  802c58:	19 fa                	sbb    %edi,%edx
+  802c5a:	89 cf                	mov    %ecx,%edi
+  802c5c:	c1 ef 05             	shr    $0x5,%edi
+  802c5f:	83 e7 01             	and    $0x1,%edi
+  802c62:	89 fe                	mov    %edi,%esi
+  802c64:	d3 e7                	shl    %cl,%edi
+  802c66:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802c6a:	83 f6 01             	xor    $0x1,%esi
+  802c6d:	d3 e6                	shl    %cl,%esi
+  802c6f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802c73:	83 e9 01             	sub    $0x1,%ecx
+  802c76:	73 98                	jae    802c10 <__udivmoddi4+0x50>
+  802c78:	85 db                	test   %ebx,%ebx
+  802c7a:	74 05                	je     802c81 <__udivmoddi4+0xc1>
+  802c7c:	89 03                	mov    %eax,(%ebx)
+  802c7e:	89 53 04             	mov    %edx,0x4(%ebx)
+  802c81:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802c85:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802c89:	83 c4 24             	add    $0x24,%esp
+  802c8c:	5b                   	pop    %ebx
+  802c8d:	5e                   	pop    %esi
+  802c8e:	5f                   	pop    %edi
+  802c8f:	5d                   	pop    %ebp
+  802c90:	c3                   	ret
+  802c91:	85 ff                	test   %edi,%edi
+  802c93:	74 0d                	je     802ca2 <__udivmoddi4+0xe2>
+  802c95:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  802c9b:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  802ca2:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802ca6:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802caa:	89 44 24 18          	mov    %eax,0x18(%esp)
+  802cae:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802cb2:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802cb6:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802cba:	83 c4 24             	add    $0x24,%esp
+  802cbd:	5b                   	pop    %ebx
+  802cbe:	5e                   	pop    %esi
+  802cbf:	5f                   	pop    %edi
+  802cc0:	5d                   	pop    %ebp
+  802cc1:	c3                   	ret
+  802cc2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802cc9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00802cd0 <__udivdi3>:
+  802cd0:	57                   	push   %edi
+  802cd1:	56                   	push   %esi
+  802cd2:	53                   	push   %ebx
+  802cd3:	83 ec 20             	sub    $0x20,%esp
+  802cd6:	8b 54 24 34          	mov    0x34(%esp),%edx
+  802cda:	8b 44 24 30          	mov    0x30(%esp),%eax
+  802cde:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802ce2:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802ce6:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802cea:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802cee:	89 d1                	mov    %edx,%ecx
+  802cf0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802cf4:	09 c1                	or     %eax,%ecx
+  802cf6:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802cfa:	89 44 24 18          	mov    %eax,0x18(%esp)
+  802cfe:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802d02:	0f 84 88 00 00 00    	je     802d90 <__udivdi3+0xc0>
+  802d08:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802d0f:	00 
+  802d10:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802d15:	31 c0                	xor    %eax,%eax
+  802d17:	31 d2                	xor    %edx,%edx
+  802d19:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802d20:	00 
+  802d21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802d28:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802d2c:	01 c0                	add    %eax,%eax
+  802d2e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802d35:	00 
+  802d36:	89 c6                	mov    %eax,%esi
+  802d38:	89 d7                	mov    %edx,%edi
+  802d3a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802d3e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802d42:	0f ad d0             	shrd   %cl,%edx,%eax
+  802d45:	d3 ea                	shr    %cl,%edx
+  802d47:	f6 c1 20             	test   $0x20,%cl
+  802d4a:	0f 45 c2             	cmovne %edx,%eax
+  802d4d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802d51:	83 e0 01             	and    $0x1,%eax
+  802d54:	09 fa                	or     %edi,%edx
+  802d56:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802d5a:	89 04 24             	mov    %eax,(%esp)
+  802d5d:	8b 04 24             	mov    (%esp),%eax
+  802d60:	89 d3                	mov    %edx,%ebx
+  802d62:	09 f0                	or     %esi,%eax
+  802d64:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802d68:	39 f0                	cmp    %esi,%eax
+  802d6a:	19 fb                	sbb    %edi,%ebx
+  802d6c:	72 1d                	jb     802d8b <__udivdi3+0xbb>
+  802d6e:	29 f0                	sub    %esi,%eax
+  802d70:	19 fa                	sbb    %edi,%edx
+  802d72:	89 cf                	mov    %ecx,%edi
+  802d74:	c1 ef 05             	shr    $0x5,%edi
+  802d77:	83 e7 01             	and    $0x1,%edi
+  802d7a:	89 fe                	mov    %edi,%esi
+  802d7c:	d3 e7                	shl    %cl,%edi
+  802d7e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802d82:	83 f6 01             	xor    $0x1,%esi
+  802d85:	d3 e6                	shl    %cl,%esi
+  802d87:	09 74 24 18          	or     %esi,0x18(%esp)
+  802d8b:	83 e9 01             	sub    $0x1,%ecx
+  802d8e:	73 98                	jae    802d28 <__udivdi3+0x58>
+  802d90:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802d94:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802d98:	83 c4 20             	add    $0x20,%esp
+  802d9b:	5b                   	pop    %ebx
+  802d9c:	5e                   	pop    %esi
+  802d9d:	5f                   	pop    %edi
+  802d9e:	c3                   	ret
+  802d9f:	90                   	nop
+
+00802da0 <__umoddi3>:
+  802da0:	57                   	push   %edi
+  802da1:	56                   	push   %esi
+  802da2:	53                   	push   %ebx
+  802da3:	83 ec 18             	sub    $0x18,%esp
+  802da6:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802daa:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802dae:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802db2:	8b 54 24 34          	mov    0x34(%esp),%edx
+  802db6:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802dba:	8b 44 24 30          	mov    0x30(%esp),%eax
+  802dbe:	89 d1                	mov    %edx,%ecx
+  802dc0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802dc4:	09 c1                	or     %eax,%ecx
+  802dc6:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802dca:	74 5b                	je     802e27 <__umoddi3+0x87>
+  802dcc:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802dd1:	31 c0                	xor    %eax,%eax
+  802dd3:	31 d2                	xor    %edx,%edx
+  802dd5:	8d 76 00             	lea    0x0(%esi),%esi
+  802dd8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802ddc:	01 c0                	add    %eax,%eax
+  802dde:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802de5:	00 
+  802de6:	89 c6                	mov    %eax,%esi
+  802de8:	89 d7                	mov    %edx,%edi
+  802dea:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802dee:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802df2:	0f ad d0             	shrd   %cl,%edx,%eax
+  802df5:	d3 ea                	shr    %cl,%edx
+  802df7:	f6 c1 20             	test   $0x20,%cl
+  802dfa:	0f 45 c2             	cmovne %edx,%eax
+  802dfd:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802e01:	83 e0 01             	and    $0x1,%eax
+  802e04:	09 fa                	or     %edi,%edx
+  802e06:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802e0a:	89 04 24             	mov    %eax,(%esp)
+  802e0d:	8b 04 24             	mov    (%esp),%eax
+  802e10:	89 d3                	mov    %edx,%ebx
+  802e12:	09 f0                	or     %esi,%eax
+  802e14:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802e18:	39 f0                	cmp    %esi,%eax
+  802e1a:	19 fb                	sbb    %edi,%ebx
+  802e1c:	72 04                	jb     802e22 <__umoddi3+0x82>
+  802e1e:	29 f0                	sub    %esi,%eax
+  802e20:	19 fa                	sbb    %edi,%edx
+  802e22:	83 e9 01             	sub    $0x1,%ecx
+  802e25:	73 b1                	jae    802dd8 <__umoddi3+0x38>
+  802e27:	83 c4 18             	add    $0x18,%esp
+  802e2a:	5b                   	pop    %ebx
+  802e2b:	5e                   	pop    %esi
+  802e2c:	5f                   	pop    %edi
+  802e2d:	c3                   	ret
+  802e2e:	66 90                	xchg   %ax,%ax
+
+00802e30 <__divdi3>:
+  802e30:	55                   	push   %ebp
+  802e31:	57                   	push   %edi
+  802e32:	56                   	push   %esi
+  802e33:	53                   	push   %ebx
+  802e34:	83 ec 24             	sub    $0x24,%esp
+  802e37:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  802e3b:	8b 74 24 44          	mov    0x44(%esp),%esi
+  802e3f:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802e43:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802e47:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  802e4b:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802e4f:	85 d2                	test   %edx,%edx
+  802e51:	0f 88 e0 00 00 00    	js     802f37 <__divdi3+0x107>
+  802e57:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  802e5b:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  802e5f:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802e63:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802e67:	85 f6                	test   %esi,%esi
+  802e69:	78 16                	js     802e81 <__divdi3+0x51>
+  802e6b:	89 f1                	mov    %esi,%ecx
+  802e6d:	31 c0                	xor    %eax,%eax
+  802e6f:	31 d2                	xor    %edx,%edx
+  802e71:	09 d9                	or     %ebx,%ecx
+  802e73:	0f 85 f3 00 00 00    	jne    802f6c <__divdi3+0x13c>
+  802e79:	83 c4 24             	add    $0x24,%esp
+  802e7c:	5b                   	pop    %ebx
+  802e7d:	5e                   	pop    %esi
+  802e7e:	5f                   	pop    %edi
+  802e7f:	5d                   	pop    %ebp
+  802e80:	c3                   	ret
+  802e81:	bf 01 00 00 00       	mov    $0x1,%edi
+  802e86:	f7 5c 24 08          	negl   0x8(%esp)
+  802e8a:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  802e8f:	f7 5c 24 0c          	negl   0xc(%esp)
+  802e93:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802e9a:	00 
+  802e9b:	31 c0                	xor    %eax,%eax
+  802e9d:	31 d2                	xor    %edx,%edx
+  802e9f:	89 fb                	mov    %edi,%ebx
+  802ea1:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802ea8:	00 
+  802ea9:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802eae:	66 90                	xchg   %ax,%ax
+  802eb0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802eb4:	01 c0                	add    %eax,%eax
+  802eb6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802ebd:	00 
+  802ebe:	89 c6                	mov    %eax,%esi
+  802ec0:	89 d7                	mov    %edx,%edi
+  802ec2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802ec6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  802eca:	0f ad d0             	shrd   %cl,%edx,%eax
+  802ecd:	d3 ea                	shr    %cl,%edx
+  802ecf:	f6 c1 20             	test   $0x20,%cl
+  802ed2:	0f 45 c2             	cmovne %edx,%eax
+  802ed5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802ed9:	83 e0 01             	and    $0x1,%eax
+  802edc:	09 fa                	or     %edi,%edx
+  802ede:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802ee2:	89 04 24             	mov    %eax,(%esp)
+  802ee5:	8b 04 24             	mov    (%esp),%eax
+  802ee8:	89 d5                	mov    %edx,%ebp
+  802eea:	09 f0                	or     %esi,%eax
+  802eec:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802ef0:	39 f0                	cmp    %esi,%eax
+  802ef2:	19 fd                	sbb    %edi,%ebp
+  802ef4:	72 1d                	jb     802f13 <__divdi3+0xe3>
+  802ef6:	29 f0                	sub    %esi,%eax
+  802ef8:	19 fa                	sbb    %edi,%edx
+  802efa:	89 cf                	mov    %ecx,%edi
+  802efc:	c1 ef 05             	shr    $0x5,%edi
+  802eff:	83 e7 01             	and    $0x1,%edi
+  802f02:	89 fe                	mov    %edi,%esi
+  802f04:	d3 e7                	shl    %cl,%edi
+  802f06:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802f0a:	83 f6 01             	xor    $0x1,%esi
+  802f0d:	d3 e6                	shl    %cl,%esi
+  802f0f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802f13:	83 e9 01             	sub    $0x1,%ecx
+  802f16:	73 98                	jae    802eb0 <__divdi3+0x80>
+  802f18:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802f1c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802f20:	85 db                	test   %ebx,%ebx
+  802f22:	0f 84 51 ff ff ff    	je     802e79 <__divdi3+0x49>
+  802f28:	f7 d8                	neg    %eax
+  802f2a:	83 d2 00             	adc    $0x0,%edx
+  802f2d:	83 c4 24             	add    $0x24,%esp
+  802f30:	5b                   	pop    %ebx
+  802f31:	f7 da                	neg    %edx
+  802f33:	5e                   	pop    %esi
+  802f34:	5f                   	pop    %edi
+  802f35:	5d                   	pop    %ebp
+  802f36:	c3                   	ret
+  802f37:	f7 d8                	neg    %eax
+  802f39:	83 d2 00             	adc    $0x0,%edx
+  802f3c:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802f40:	f7 da                	neg    %edx
+  802f42:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802f46:	85 f6                	test   %esi,%esi
+  802f48:	78 1b                	js     802f65 <__divdi3+0x135>
+  802f4a:	89 f1                	mov    %esi,%ecx
+  802f4c:	31 c0                	xor    %eax,%eax
+  802f4e:	31 d2                	xor    %edx,%edx
+  802f50:	bf 01 00 00 00       	mov    $0x1,%edi
+  802f55:	09 d9                	or     %ebx,%ecx
+  802f57:	0f 85 36 ff ff ff    	jne    802e93 <__divdi3+0x63>
+  802f5d:	83 c4 24             	add    $0x24,%esp
+  802f60:	5b                   	pop    %ebx
+  802f61:	5e                   	pop    %esi
+  802f62:	5f                   	pop    %edi
+  802f63:	5d                   	pop    %ebp
+  802f64:	c3                   	ret
+  802f65:	31 ff                	xor    %edi,%edi
+  802f67:	e9 1a ff ff ff       	jmp    802e86 <__divdi3+0x56>
+  802f6c:	31 ff                	xor    %edi,%edi
+  802f6e:	e9 20 ff ff ff       	jmp    802e93 <__divdi3+0x63>
+  802f73:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802f7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00802f80 <__moddi3>:
+  802f80:	55                   	push   %ebp
+  802f81:	57                   	push   %edi
+  802f82:	56                   	push   %esi
+  802f83:	53                   	push   %ebx
+  802f84:	83 ec 1c             	sub    $0x1c,%esp
+  802f87:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  802f8b:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  802f8f:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  802f93:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  802f97:	89 c8                	mov    %ecx,%eax
+  802f99:	89 f2                	mov    %esi,%edx
+  802f9b:	89 f3                	mov    %esi,%ebx
+  802f9d:	85 ed                	test   %ebp,%ebp
+  802f9f:	0f 88 9d 00 00 00    	js     803042 <__moddi3+0xc2>
+  802fa5:	09 cb                	or     %ecx,%ebx
+  802fa7:	0f 84 8d 00 00 00    	je     80303a <__moddi3+0xba>
+  802fad:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802fb1:	31 db                	xor    %ebx,%ebx
+  802fb3:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802fb7:	89 ca                	mov    %ecx,%edx
+  802fb9:	89 f0                	mov    %esi,%eax
+  802fbb:	89 dd                	mov    %ebx,%ebp
+  802fbd:	f7 da                	neg    %edx
+  802fbf:	83 d0 00             	adc    $0x0,%eax
+  802fc2:	f7 d8                	neg    %eax
+  802fc4:	0f 49 f0             	cmovns %eax,%esi
+  802fc7:	0f 49 ca             	cmovns %edx,%ecx
+  802fca:	31 c0                	xor    %eax,%eax
+  802fcc:	31 d2                	xor    %edx,%edx
+  802fce:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802fd2:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802fd6:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802fdb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  802fdf:	90                   	nop
+  802fe0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802fe4:	01 c0                	add    %eax,%eax
+  802fe6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802fed:	00 
+  802fee:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  802ff2:	89 c6                	mov    %eax,%esi
+  802ff4:	89 d7                	mov    %edx,%edi
+  802ff6:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802ffa:	8b 54 24 14          	mov    0x14(%esp),%edx
+  802ffe:	0f ad d0             	shrd   %cl,%edx,%eax
+  803001:	d3 ea                	shr    %cl,%edx
+  803003:	f6 c1 20             	test   $0x20,%cl
+  803006:	0f 45 c2             	cmovne %edx,%eax
+  803009:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80300d:	83 e0 01             	and    $0x1,%eax
+  803010:	09 fa                	or     %edi,%edx
+  803012:	89 04 24             	mov    %eax,(%esp)
+  803015:	8b 04 24             	mov    (%esp),%eax
+  803018:	89 d7                	mov    %edx,%edi
+  80301a:	09 f0                	or     %esi,%eax
+  80301c:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  803020:	39 d8                	cmp    %ebx,%eax
+  803022:	19 f7                	sbb    %esi,%edi
+  803024:	72 04                	jb     80302a <__moddi3+0xaa>
+  803026:	29 d8                	sub    %ebx,%eax
+  803028:	19 f2                	sbb    %esi,%edx
+  80302a:	83 e9 01             	sub    $0x1,%ecx
+  80302d:	73 b1                	jae    802fe0 <__moddi3+0x60>
+  80302f:	85 ed                	test   %ebp,%ebp
+  803031:	74 07                	je     80303a <__moddi3+0xba>
+  803033:	f7 d8                	neg    %eax
+  803035:	83 d2 00             	adc    $0x0,%edx
+  803038:	f7 da                	neg    %edx
+  80303a:	83 c4 1c             	add    $0x1c,%esp
+  80303d:	5b                   	pop    %ebx
+  80303e:	5e                   	pop    %esi
+  80303f:	5f                   	pop    %edi
+  803040:	5d                   	pop    %ebp
+  803041:	c3                   	ret
+  803042:	09 cb                	or     %ecx,%ebx
+  803044:	74 f4                	je     80303a <__moddi3+0xba>
+  803046:	f7 df                	neg    %edi
+  803048:	bb 01 00 00 00       	mov    $0x1,%ebx
+  80304d:	83 d5 00             	adc    $0x0,%ebp
+  803050:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  803054:	f7 dd                	neg    %ebp
+  803056:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  80305a:	e9 58 ff ff ff       	jmp    802fb7 <__moddi3+0x37>
@@ -0,0 +1,6006 @@
+
+obj/net/testoutput:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 55 02 00 00       	call   800286 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+static struct jif_pkt *pkt = (struct jif_pkt*)REQVA;
+
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+	envid_t ns_envid = sys_getenvid();
+  800038:	e8 ee 0c 00 00       	call   800d2b <sys_getenvid>
+  80003d:	89 c6                	mov    %eax,%esi
+	int i, r;
+
+	binaryname = "testoutput";
+  80003f:	c7 05 00 40 80 00 e0 	movl   $0x802ae0,0x804000
+  800046:	2a 80 00 
+
+	output_envid = fork();
+  800049:	e8 e9 10 00 00       	call   801137 <fork>
+  80004e:	a3 00 50 80 00       	mov    %eax,0x805000
+	if (output_envid < 0)
+  800053:	85 c0                	test   %eax,%eax
+  800055:	0f 88 80 00 00 00    	js     8000db <umain+0xa8>
+	else if (output_envid == 0) {
+		output(ns_envid);
+		return;
+	}
+
+	for (i = 0; i < TESTOUTPUT_COUNT; i++) {
+  80005b:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (output_envid == 0) {
+  800060:	0f 84 89 00 00 00    	je     8000ef <umain+0xbc>
+		if ((r = sys_page_alloc(0, pkt, PTE_P|PTE_U|PTE_W)) < 0)
+  800066:	83 ec 04             	sub    $0x4,%esp
+  800069:	6a 07                	push   $0x7
+  80006b:	68 00 b0 fe 0f       	push   $0xffeb000
+  800070:	6a 00                	push   $0x0
+  800072:	e8 f2 0c 00 00       	call   800d69 <sys_page_alloc>
+  800077:	83 c4 10             	add    $0x10,%esp
+  80007a:	85 c0                	test   %eax,%eax
+  80007c:	78 7f                	js     8000fd <umain+0xca>
+			panic("sys_page_alloc: %e", r);
+		pkt->jp_len = snprintf(pkt->jp_data,
+  80007e:	53                   	push   %ebx
+  80007f:	68 1d 2b 80 00       	push   $0x802b1d
+  800084:	68 fc 0f 00 00       	push   $0xffc
+  800089:	68 04 b0 fe 0f       	push   $0xffeb004
+  80008e:	e8 95 08 00 00       	call   800928 <snprintf>
+  800093:	a3 00 b0 fe 0f       	mov    %eax,0xffeb000
+				       PGSIZE - sizeof(pkt->jp_len),
+				       "Packet %02d", i);
+		cprintf("Transmitting packet %d\n", i);
+  800098:	83 c4 08             	add    $0x8,%esp
+  80009b:	53                   	push   %ebx
+  80009c:	68 29 2b 80 00       	push   $0x802b29
+  8000a1:	e8 1e 03 00 00       	call   8003c4 <cprintf>
+		ipc_send(output_envid, NSREQ_OUTPUT, pkt, PTE_P|PTE_W|PTE_U);
+  8000a6:	6a 07                	push   $0x7
+  8000a8:	68 00 b0 fe 0f       	push   $0xffeb000
+  8000ad:	6a 0b                	push   $0xb
+  8000af:	ff 35 00 50 80 00    	push   0x805000
+  8000b5:	e8 0d 13 00 00       	call   8013c7 <ipc_send>
+		sys_page_unmap(0, pkt);
+  8000ba:	83 c4 18             	add    $0x18,%esp
+  8000bd:	68 00 b0 fe 0f       	push   $0xffeb000
+  8000c2:	6a 00                	push   $0x0
+  8000c4:	e8 25 0d 00 00       	call   800dee <sys_page_unmap>
+	for (i = 0; i < TESTOUTPUT_COUNT; i++) {
+  8000c9:	83 c3 01             	add    $0x1,%ebx
+  8000cc:	83 c4 10             	add    $0x10,%esp
+  8000cf:	83 fb 0a             	cmp    $0xa,%ebx
+  8000d2:	75 92                	jne    800066 <umain+0x33>
+  8000d4:	bb 15 00 00 00       	mov    $0x15,%ebx
+  8000d9:	eb 39                	jmp    800114 <umain+0xe1>
+		panic("error forking");
+  8000db:	83 ec 04             	sub    $0x4,%esp
+  8000de:	68 eb 2a 80 00       	push   $0x802aeb
+  8000e3:	6a 16                	push   $0x16
+  8000e5:	68 f9 2a 80 00       	push   $0x802af9
+  8000ea:	e8 fa 01 00 00       	call   8002e9 <_panic>
+		output(ns_envid);
+  8000ef:	83 ec 0c             	sub    $0xc,%esp
+  8000f2:	56                   	push   %esi
+  8000f3:	e8 3c 01 00 00       	call   800234 <output>
+		return;
+  8000f8:	83 c4 10             	add    $0x10,%esp
+  8000fb:	eb 1c                	jmp    800119 <umain+0xe6>
+			panic("sys_page_alloc: %e", r);
+  8000fd:	50                   	push   %eax
+  8000fe:	68 0a 2b 80 00       	push   $0x802b0a
+  800103:	6a 1e                	push   $0x1e
+  800105:	68 f9 2a 80 00       	push   $0x802af9
+  80010a:	e8 da 01 00 00       	call   8002e9 <_panic>
+	}
+
+	// Spin for a while, just in case IPC's or packets need to be flushed
+	for (i = 0; i < TESTOUTPUT_COUNT*2; i++)
+		sys_yield();
+  80010f:	e8 36 0c 00 00       	call   800d4a <sys_yield>
+	for (i = 0; i < TESTOUTPUT_COUNT*2; i++)
+  800114:	83 eb 01             	sub    $0x1,%ebx
+  800117:	75 f6                	jne    80010f <umain+0xdc>
+}
+  800119:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80011c:	5b                   	pop    %ebx
+  80011d:	5e                   	pop    %esi
+  80011e:	5d                   	pop    %ebp
+  80011f:	c3                   	ret
+
+00800120 <timer>:
+#include "ns.h"
+
+void
+timer(envid_t ns_envid, uint32_t initial_to) {
+  800120:	55                   	push   %ebp
+  800121:	89 e5                	mov    %esp,%ebp
+  800123:	57                   	push   %edi
+  800124:	56                   	push   %esi
+  800125:	53                   	push   %ebx
+  800126:	83 ec 1c             	sub    $0x1c,%esp
+  800129:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	uint32_t stop = sys_time_msec() + initial_to;
+  80012c:	e8 6a 0e 00 00       	call   800f9b <sys_time_msec>
+  800131:	03 45 0c             	add    0xc(%ebp),%eax
+  800134:	89 c3                	mov    %eax,%ebx
+
+	binaryname = "ns_timer";
+  800136:	c7 05 00 40 80 00 41 	movl   $0x802b41,0x804000
+  80013d:	2b 80 00 
+
+		ipc_send(ns_envid, NSREQ_TIMER, 0, 0);
+
+		while (1) {
+			uint32_t to, whom;
+			to = ipc_recv((int32_t *) &whom, 0, 0);
+  800140:	8d 7d e4             	lea    -0x1c(%ebp),%edi
+  800143:	eb 05                	jmp    80014a <timer+0x2a>
+			sys_yield();
+  800145:	e8 00 0c 00 00       	call   800d4a <sys_yield>
+		while((r = sys_time_msec()) < stop && r >= 0) {
+  80014a:	e8 4c 0e 00 00       	call   800f9b <sys_time_msec>
+  80014f:	39 d8                	cmp    %ebx,%eax
+  800151:	73 16                	jae    800169 <timer+0x49>
+  800153:	85 c0                	test   %eax,%eax
+  800155:	79 ee                	jns    800145 <timer+0x25>
+			panic("sys_time_msec: %e", r);
+  800157:	50                   	push   %eax
+  800158:	68 4a 2b 80 00       	push   $0x802b4a
+  80015d:	6a 0f                	push   $0xf
+  80015f:	68 5c 2b 80 00       	push   $0x802b5c
+  800164:	e8 80 01 00 00       	call   8002e9 <_panic>
+		if (r < 0)
+  800169:	85 c0                	test   %eax,%eax
+  80016b:	78 ea                	js     800157 <timer+0x37>
+		ipc_send(ns_envid, NSREQ_TIMER, 0, 0);
+  80016d:	6a 00                	push   $0x0
+  80016f:	6a 00                	push   $0x0
+  800171:	6a 0c                	push   $0xc
+  800173:	56                   	push   %esi
+  800174:	e8 4e 12 00 00       	call   8013c7 <ipc_send>
+  800179:	83 c4 10             	add    $0x10,%esp
+			to = ipc_recv((int32_t *) &whom, 0, 0);
+  80017c:	83 ec 04             	sub    $0x4,%esp
+  80017f:	6a 00                	push   $0x0
+  800181:	6a 00                	push   $0x0
+  800183:	57                   	push   %edi
+  800184:	e8 ca 11 00 00       	call   801353 <ipc_recv>
+  800189:	89 c3                	mov    %eax,%ebx
+
+			if (whom != ns_envid) {
+  80018b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80018e:	83 c4 10             	add    $0x10,%esp
+  800191:	39 f0                	cmp    %esi,%eax
+  800193:	75 09                	jne    80019e <timer+0x7e>
+				cprintf("NS TIMER: timer thread got IPC message from env %x not NS\n", whom);
+				continue;
+			}
+
+			stop = sys_time_msec() + to;
+  800195:	e8 01 0e 00 00       	call   800f9b <sys_time_msec>
+  80019a:	01 c3                	add    %eax,%ebx
+			break;
+  80019c:	eb ac                	jmp    80014a <timer+0x2a>
+				cprintf("NS TIMER: timer thread got IPC message from env %x not NS\n", whom);
+  80019e:	83 ec 08             	sub    $0x8,%esp
+  8001a1:	50                   	push   %eax
+  8001a2:	68 68 2b 80 00       	push   $0x802b68
+  8001a7:	e8 18 02 00 00       	call   8003c4 <cprintf>
+				continue;
+  8001ac:	83 c4 10             	add    $0x10,%esp
+  8001af:	eb cb                	jmp    80017c <timer+0x5c>
+
+008001b1 <input>:
+#include "ns.h"
+
+extern union Nsipc nsipcbuf;
+
+void
+input(envid_t ns_envid) {
+  8001b1:	55                   	push   %ebp
+  8001b2:	89 e5                	mov    %esp,%ebp
+  8001b4:	57                   	push   %edi
+  8001b5:	56                   	push   %esi
+  8001b6:	53                   	push   %ebx
+  8001b7:	81 ec 0c 08 00 00    	sub    $0x80c,%esp
+  8001bd:	8b 7d 08             	mov    0x8(%ebp),%edi
+  binaryname = "ns_input";
+  8001c0:	c7 05 00 40 80 00 a3 	movl   $0x802ba3,0x804000
+  8001c7:	2b 80 00 
+  // another packet in to the same physical page.
+  char buf[2048];
+
+  for(;;) {
+    int len;
+    if ((len = sys_net_recv(buf, 0)) < 0) {
+  8001ca:	8d b5 e8 f7 ff ff    	lea    -0x818(%ebp),%esi
+  8001d0:	eb 0d                	jmp    8001df <input+0x2e>
+      sys_sleep(30);
+  8001d2:	83 ec 0c             	sub    $0xc,%esp
+  8001d5:	6a 1e                	push   $0x1e
+  8001d7:	e8 20 0e 00 00       	call   800ffc <sys_sleep>
+      continue;
+  8001dc:	83 c4 10             	add    $0x10,%esp
+    if ((len = sys_net_recv(buf, 0)) < 0) {
+  8001df:	83 ec 08             	sub    $0x8,%esp
+  8001e2:	6a 00                	push   $0x0
+  8001e4:	56                   	push   %esi
+  8001e5:	e8 f1 0d 00 00       	call   800fdb <sys_net_recv>
+  8001ea:	89 c3                	mov    %eax,%ebx
+  8001ec:	83 c4 10             	add    $0x10,%esp
+  8001ef:	85 c0                	test   %eax,%eax
+  8001f1:	78 df                	js     8001d2 <input+0x21>
+    }
+    if (sys_page_alloc(0, &nsipcbuf, PTE_P | PTE_W | PTE_U) < 0)
+  8001f3:	83 ec 04             	sub    $0x4,%esp
+  8001f6:	6a 07                	push   $0x7
+  8001f8:	68 00 70 80 00       	push   $0x807000
+  8001fd:	6a 00                	push   $0x0
+  8001ff:	e8 65 0b 00 00       	call   800d69 <sys_page_alloc>
+  800204:	83 c4 10             	add    $0x10,%esp
+  800207:	85 c0                	test   %eax,%eax
+  800209:	78 d4                	js     8001df <input+0x2e>
+      continue;
+    memmove(nsipcbuf.pkt.jp_data, buf, len);
+  80020b:	83 ec 04             	sub    $0x4,%esp
+  80020e:	53                   	push   %ebx
+  80020f:	56                   	push   %esi
+  800210:	68 04 70 80 00       	push   $0x807004
+  800215:	e8 e9 08 00 00       	call   800b03 <memmove>
+    nsipcbuf.pkt.jp_len = len;
+  80021a:	89 1d 00 70 80 00    	mov    %ebx,0x807000
+    ipc_send(ns_envid, NSREQ_INPUT, &nsipcbuf, PTE_P | PTE_W | PTE_U);
+  800220:	6a 07                	push   $0x7
+  800222:	68 00 70 80 00       	push   $0x807000
+  800227:	6a 0a                	push   $0xa
+  800229:	57                   	push   %edi
+  80022a:	e8 98 11 00 00       	call   8013c7 <ipc_send>
+  80022f:	83 c4 20             	add    $0x20,%esp
+  800232:	eb ab                	jmp    8001df <input+0x2e>
+
+00800234 <output>:
+#include "ns.h"
+
+extern union Nsipc nsipcbuf;
+
+void
+output(envid_t ns_envid) {
+  800234:	55                   	push   %ebp
+  800235:	89 e5                	mov    %esp,%ebp
+  800237:	56                   	push   %esi
+  800238:	53                   	push   %ebx
+  800239:	83 ec 10             	sub    $0x10,%esp
+  binaryname = "ns_output";
+  80023c:	c7 05 00 40 80 00 ac 	movl   $0x802bac,0x804000
+  800243:	2b 80 00 
+  int r;
+  envid_t whom;
+  int perm;
+
+  for (;;) {
+    r = ipc_recv(&whom, &nsipcbuf, &perm);
+  800246:	8d 75 f0             	lea    -0x10(%ebp),%esi
+  800249:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+  80024c:	eb 1f                	jmp    80026d <output+0x39>
+    if (r != NSREQ_OUTPUT)
+      continue;
+    jifpkt = &nsipcbuf.pkt;
+    while (sys_net_send(jifpkt->jp_data, jifpkt->jp_len) < 0)
+      sys_yield();
+  80024e:	e8 f7 0a 00 00       	call   800d4a <sys_yield>
+    while (sys_net_send(jifpkt->jp_data, jifpkt->jp_len) < 0)
+  800253:	83 ec 08             	sub    $0x8,%esp
+  800256:	ff 35 00 70 80 00    	push   0x807000
+  80025c:	68 04 70 80 00       	push   $0x807004
+  800261:	e8 54 0d 00 00       	call   800fba <sys_net_send>
+  800266:	83 c4 10             	add    $0x10,%esp
+  800269:	85 c0                	test   %eax,%eax
+  80026b:	78 e1                	js     80024e <output+0x1a>
+    r = ipc_recv(&whom, &nsipcbuf, &perm);
+  80026d:	83 ec 04             	sub    $0x4,%esp
+  800270:	56                   	push   %esi
+  800271:	68 00 70 80 00       	push   $0x807000
+  800276:	53                   	push   %ebx
+  800277:	e8 d7 10 00 00       	call   801353 <ipc_recv>
+    if (r != NSREQ_OUTPUT)
+  80027c:	83 c4 10             	add    $0x10,%esp
+  80027f:	83 f8 0b             	cmp    $0xb,%eax
+  800282:	75 e9                	jne    80026d <output+0x39>
+  800284:	eb cd                	jmp    800253 <output+0x1f>
+
+00800286 <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  800286:	55                   	push   %ebp
+  800287:	89 e5                	mov    %esp,%ebp
+  800289:	56                   	push   %esi
+  80028a:	53                   	push   %ebx
+  80028b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80028e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  800291:	e8 95 0a 00 00       	call   800d2b <sys_getenvid>
+  800296:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80029b:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80029e:	c1 e0 04             	shl    $0x4,%eax
+  8002a1:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8002a6:	a3 0c 50 80 00       	mov    %eax,0x80500c
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8002ab:	85 db                	test   %ebx,%ebx
+  8002ad:	7e 07                	jle    8002b6 <libmain+0x30>
+    binaryname = argv[0];
+  8002af:	8b 06                	mov    (%esi),%eax
+  8002b1:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  8002b6:	83 ec 08             	sub    $0x8,%esp
+  8002b9:	56                   	push   %esi
+  8002ba:	53                   	push   %ebx
+  8002bb:	e8 73 fd ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  8002c0:	e8 0a 00 00 00       	call   8002cf <exit>
+}
+  8002c5:	83 c4 10             	add    $0x10,%esp
+  8002c8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8002cb:	5b                   	pop    %ebx
+  8002cc:	5e                   	pop    %esi
+  8002cd:	5d                   	pop    %ebp
+  8002ce:	c3                   	ret
+
+008002cf <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8002cf:	55                   	push   %ebp
+  8002d0:	89 e5                	mov    %esp,%ebp
+  8002d2:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8002d5:	e8 54 13 00 00       	call   80162e <close_all>
+	sys_env_destroy(0);
+  8002da:	83 ec 0c             	sub    $0xc,%esp
+  8002dd:	6a 00                	push   $0x0
+  8002df:	e8 06 0a 00 00       	call   800cea <sys_env_destroy>
+}
+  8002e4:	83 c4 10             	add    $0x10,%esp
+  8002e7:	c9                   	leave
+  8002e8:	c3                   	ret
+
+008002e9 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8002e9:	55                   	push   %ebp
+  8002ea:	89 e5                	mov    %esp,%ebp
+  8002ec:	56                   	push   %esi
+  8002ed:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8002ee:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8002f1:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  8002f7:	e8 2f 0a 00 00       	call   800d2b <sys_getenvid>
+  8002fc:	83 ec 0c             	sub    $0xc,%esp
+  8002ff:	ff 75 0c             	push   0xc(%ebp)
+  800302:	ff 75 08             	push   0x8(%ebp)
+  800305:	56                   	push   %esi
+  800306:	50                   	push   %eax
+  800307:	68 c0 2b 80 00       	push   $0x802bc0
+  80030c:	e8 b3 00 00 00       	call   8003c4 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800311:	83 c4 18             	add    $0x18,%esp
+  800314:	53                   	push   %ebx
+  800315:	ff 75 10             	push   0x10(%ebp)
+  800318:	e8 56 00 00 00       	call   800373 <vcprintf>
+	cprintf("\n");
+  80031d:	c7 04 24 3f 2b 80 00 	movl   $0x802b3f,(%esp)
+  800324:	e8 9b 00 00 00       	call   8003c4 <cprintf>
+  800329:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80032c:	cc                   	int3
+	while (1)
+  80032d:	eb fd                	jmp    80032c <_panic+0x43>
+
+0080032f <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80032f:	55                   	push   %ebp
+  800330:	89 e5                	mov    %esp,%ebp
+  800332:	53                   	push   %ebx
+  800333:	83 ec 04             	sub    $0x4,%esp
+  800336:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800339:	8b 13                	mov    (%ebx),%edx
+  80033b:	8d 42 01             	lea    0x1(%edx),%eax
+  80033e:	89 03                	mov    %eax,(%ebx)
+  800340:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800343:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800347:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80034c:	74 09                	je     800357 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80034e:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800352:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800355:	c9                   	leave
+  800356:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800357:	83 ec 08             	sub    $0x8,%esp
+  80035a:	68 ff 00 00 00       	push   $0xff
+  80035f:	8d 43 08             	lea    0x8(%ebx),%eax
+  800362:	50                   	push   %eax
+  800363:	e8 45 09 00 00       	call   800cad <sys_cputs>
+		b->idx = 0;
+  800368:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80036e:	83 c4 10             	add    $0x10,%esp
+  800371:	eb db                	jmp    80034e <putch+0x1f>
+
+00800373 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800373:	55                   	push   %ebp
+  800374:	89 e5                	mov    %esp,%ebp
+  800376:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80037c:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800383:	00 00 00 
+	b.cnt = 0;
+  800386:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80038d:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800390:	ff 75 0c             	push   0xc(%ebp)
+  800393:	ff 75 08             	push   0x8(%ebp)
+  800396:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80039c:	50                   	push   %eax
+  80039d:	68 2f 03 80 00       	push   $0x80032f
+  8003a2:	e8 14 01 00 00       	call   8004bb <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8003a7:	83 c4 08             	add    $0x8,%esp
+  8003aa:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8003b0:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8003b6:	50                   	push   %eax
+  8003b7:	e8 f1 08 00 00       	call   800cad <sys_cputs>
+
+	return b.cnt;
+}
+  8003bc:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8003c2:	c9                   	leave
+  8003c3:	c3                   	ret
+
+008003c4 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8003c4:	55                   	push   %ebp
+  8003c5:	89 e5                	mov    %esp,%ebp
+  8003c7:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8003ca:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8003cd:	50                   	push   %eax
+  8003ce:	ff 75 08             	push   0x8(%ebp)
+  8003d1:	e8 9d ff ff ff       	call   800373 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8003d6:	c9                   	leave
+  8003d7:	c3                   	ret
+
+008003d8 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8003d8:	55                   	push   %ebp
+  8003d9:	89 e5                	mov    %esp,%ebp
+  8003db:	57                   	push   %edi
+  8003dc:	56                   	push   %esi
+  8003dd:	53                   	push   %ebx
+  8003de:	83 ec 1c             	sub    $0x1c,%esp
+  8003e1:	89 c7                	mov    %eax,%edi
+  8003e3:	89 d6                	mov    %edx,%esi
+  8003e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003e8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8003eb:	89 d1                	mov    %edx,%ecx
+  8003ed:	89 c2                	mov    %eax,%edx
+  8003ef:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8003f2:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8003f5:	8b 45 10             	mov    0x10(%ebp),%eax
+  8003f8:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8003fb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003fe:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800405:	39 c2                	cmp    %eax,%edx
+  800407:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80040a:	72 3e                	jb     80044a <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80040c:	83 ec 0c             	sub    $0xc,%esp
+  80040f:	ff 75 18             	push   0x18(%ebp)
+  800412:	83 eb 01             	sub    $0x1,%ebx
+  800415:	53                   	push   %ebx
+  800416:	50                   	push   %eax
+  800417:	83 ec 08             	sub    $0x8,%esp
+  80041a:	ff 75 e4             	push   -0x1c(%ebp)
+  80041d:	ff 75 e0             	push   -0x20(%ebp)
+  800420:	ff 75 dc             	push   -0x24(%ebp)
+  800423:	ff 75 d8             	push   -0x28(%ebp)
+  800426:	e8 25 23 00 00       	call   802750 <__udivdi3>
+  80042b:	83 c4 18             	add    $0x18,%esp
+  80042e:	52                   	push   %edx
+  80042f:	50                   	push   %eax
+  800430:	89 f2                	mov    %esi,%edx
+  800432:	89 f8                	mov    %edi,%eax
+  800434:	e8 9f ff ff ff       	call   8003d8 <printnum>
+  800439:	83 c4 20             	add    $0x20,%esp
+  80043c:	eb 13                	jmp    800451 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80043e:	83 ec 08             	sub    $0x8,%esp
+  800441:	56                   	push   %esi
+  800442:	ff 75 18             	push   0x18(%ebp)
+  800445:	ff d7                	call   *%edi
+  800447:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80044a:	83 eb 01             	sub    $0x1,%ebx
+  80044d:	85 db                	test   %ebx,%ebx
+  80044f:	7f ed                	jg     80043e <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800451:	83 ec 08             	sub    $0x8,%esp
+  800454:	56                   	push   %esi
+  800455:	83 ec 04             	sub    $0x4,%esp
+  800458:	ff 75 e4             	push   -0x1c(%ebp)
+  80045b:	ff 75 e0             	push   -0x20(%ebp)
+  80045e:	ff 75 dc             	push   -0x24(%ebp)
+  800461:	ff 75 d8             	push   -0x28(%ebp)
+  800464:	e8 b7 23 00 00       	call   802820 <__umoddi3>
+  800469:	83 c4 14             	add    $0x14,%esp
+  80046c:	0f be 80 e3 2b 80 00 	movsbl 0x802be3(%eax),%eax
+  800473:	50                   	push   %eax
+  800474:	ff d7                	call   *%edi
+}
+  800476:	83 c4 10             	add    $0x10,%esp
+  800479:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80047c:	5b                   	pop    %ebx
+  80047d:	5e                   	pop    %esi
+  80047e:	5f                   	pop    %edi
+  80047f:	5d                   	pop    %ebp
+  800480:	c3                   	ret
+
+00800481 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800481:	55                   	push   %ebp
+  800482:	89 e5                	mov    %esp,%ebp
+  800484:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800487:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80048b:	8b 10                	mov    (%eax),%edx
+  80048d:	3b 50 04             	cmp    0x4(%eax),%edx
+  800490:	73 0a                	jae    80049c <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800492:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800495:	89 08                	mov    %ecx,(%eax)
+  800497:	8b 45 08             	mov    0x8(%ebp),%eax
+  80049a:	88 02                	mov    %al,(%edx)
+}
+  80049c:	5d                   	pop    %ebp
+  80049d:	c3                   	ret
+
+0080049e <printfmt>:
+{
+  80049e:	55                   	push   %ebp
+  80049f:	89 e5                	mov    %esp,%ebp
+  8004a1:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8004a4:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8004a7:	50                   	push   %eax
+  8004a8:	ff 75 10             	push   0x10(%ebp)
+  8004ab:	ff 75 0c             	push   0xc(%ebp)
+  8004ae:	ff 75 08             	push   0x8(%ebp)
+  8004b1:	e8 05 00 00 00       	call   8004bb <vprintfmt>
+}
+  8004b6:	83 c4 10             	add    $0x10,%esp
+  8004b9:	c9                   	leave
+  8004ba:	c3                   	ret
+
+008004bb <vprintfmt>:
+{
+  8004bb:	55                   	push   %ebp
+  8004bc:	89 e5                	mov    %esp,%ebp
+  8004be:	57                   	push   %edi
+  8004bf:	56                   	push   %esi
+  8004c0:	53                   	push   %ebx
+  8004c1:	83 ec 2c             	sub    $0x2c,%esp
+  8004c4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004c7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8004ca:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8004cd:	eb 0a                	jmp    8004d9 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8004cf:	83 ec 08             	sub    $0x8,%esp
+  8004d2:	53                   	push   %ebx
+  8004d3:	50                   	push   %eax
+  8004d4:	ff d6                	call   *%esi
+  8004d6:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8004d9:	83 c7 01             	add    $0x1,%edi
+  8004dc:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8004e0:	83 f8 25             	cmp    $0x25,%eax
+  8004e3:	74 0c                	je     8004f1 <vprintfmt+0x36>
+			if (ch == '\0')
+  8004e5:	85 c0                	test   %eax,%eax
+  8004e7:	75 e6                	jne    8004cf <vprintfmt+0x14>
+}
+  8004e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004ec:	5b                   	pop    %ebx
+  8004ed:	5e                   	pop    %esi
+  8004ee:	5f                   	pop    %edi
+  8004ef:	5d                   	pop    %ebp
+  8004f0:	c3                   	ret
+		padc = ' ';
+  8004f1:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8004f5:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8004fc:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800503:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80050a:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80050f:	8d 47 01             	lea    0x1(%edi),%eax
+  800512:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800515:	0f b6 17             	movzbl (%edi),%edx
+  800518:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80051b:	3c 55                	cmp    $0x55,%al
+  80051d:	0f 87 9a 03 00 00    	ja     8008bd <vprintfmt+0x402>
+  800523:	0f b6 c0             	movzbl %al,%eax
+  800526:	ff 24 85 20 2d 80 00 	jmp    *0x802d20(,%eax,4)
+  80052d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800530:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800534:	eb d9                	jmp    80050f <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800536:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800539:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80053d:	eb d0                	jmp    80050f <vprintfmt+0x54>
+  80053f:	0f b6 d2             	movzbl %dl,%edx
+  800542:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800545:	b8 00 00 00 00       	mov    $0x0,%eax
+  80054a:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80054d:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800550:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800554:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800557:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80055a:	83 f9 09             	cmp    $0x9,%ecx
+  80055d:	77 55                	ja     8005b4 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  80055f:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800562:	eb e9                	jmp    80054d <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800564:	8b 45 14             	mov    0x14(%ebp),%eax
+  800567:	8b 00                	mov    (%eax),%eax
+  800569:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80056c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80056f:	8d 40 04             	lea    0x4(%eax),%eax
+  800572:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800575:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800578:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80057c:	79 91                	jns    80050f <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80057e:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800581:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800584:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80058b:	eb 82                	jmp    80050f <vprintfmt+0x54>
+			if (width < 0)
+  80058d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800590:	85 d2                	test   %edx,%edx
+  800592:	b8 00 00 00 00       	mov    $0x0,%eax
+  800597:	0f 49 c2             	cmovns %edx,%eax
+  80059a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80059d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8005a0:	e9 6a ff ff ff       	jmp    80050f <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8005a5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8005a8:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8005af:	e9 5b ff ff ff       	jmp    80050f <vprintfmt+0x54>
+  8005b4:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8005b7:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8005ba:	eb bc                	jmp    800578 <vprintfmt+0xbd>
+			lflag++;
+  8005bc:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8005bf:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8005c2:	e9 48 ff ff ff       	jmp    80050f <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8005c7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ca:	8d 78 04             	lea    0x4(%eax),%edi
+  8005cd:	83 ec 08             	sub    $0x8,%esp
+  8005d0:	53                   	push   %ebx
+  8005d1:	ff 30                	push   (%eax)
+  8005d3:	ff d6                	call   *%esi
+			break;
+  8005d5:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8005d8:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8005db:	e9 7c 02 00 00       	jmp    80085c <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  8005e0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e3:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8005e6:	8b 10                	mov    (%eax),%edx
+  8005e8:	89 d0                	mov    %edx,%eax
+  8005ea:	f7 d8                	neg    %eax
+  8005ec:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8005ef:	83 f8 10             	cmp    $0x10,%eax
+  8005f2:	7f 23                	jg     800617 <vprintfmt+0x15c>
+  8005f4:	8b 14 85 80 2e 80 00 	mov    0x802e80(,%eax,4),%edx
+  8005fb:	85 d2                	test   %edx,%edx
+  8005fd:	74 18                	je     800617 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8005ff:	52                   	push   %edx
+  800600:	68 dd 30 80 00       	push   $0x8030dd
+  800605:	53                   	push   %ebx
+  800606:	56                   	push   %esi
+  800607:	e8 92 fe ff ff       	call   80049e <printfmt>
+  80060c:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80060f:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800612:	e9 45 02 00 00       	jmp    80085c <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  800617:	50                   	push   %eax
+  800618:	68 fb 2b 80 00       	push   $0x802bfb
+  80061d:	53                   	push   %ebx
+  80061e:	56                   	push   %esi
+  80061f:	e8 7a fe ff ff       	call   80049e <printfmt>
+  800624:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800627:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80062a:	e9 2d 02 00 00       	jmp    80085c <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80062f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800632:	83 c0 04             	add    $0x4,%eax
+  800635:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800638:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063b:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80063d:	85 c9                	test   %ecx,%ecx
+  80063f:	b8 f4 2b 80 00       	mov    $0x802bf4,%eax
+  800644:	0f 45 c1             	cmovne %ecx,%eax
+  800647:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80064a:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80064e:	7e 06                	jle    800656 <vprintfmt+0x19b>
+  800650:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800654:	75 0b                	jne    800661 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800656:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800659:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80065c:	89 75 08             	mov    %esi,0x8(%ebp)
+  80065f:	eb 5c                	jmp    8006bd <vprintfmt+0x202>
+  800661:	83 ec 08             	sub    $0x8,%esp
+  800664:	ff 75 d0             	push   -0x30(%ebp)
+  800667:	ff 75 cc             	push   -0x34(%ebp)
+  80066a:	e8 eb 02 00 00       	call   80095a <strnlen>
+  80066f:	89 c2                	mov    %eax,%edx
+  800671:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800674:	29 d0                	sub    %edx,%eax
+  800676:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800679:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80067d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800680:	89 75 08             	mov    %esi,0x8(%ebp)
+  800683:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800685:	eb 0e                	jmp    800695 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800687:	83 ec 08             	sub    $0x8,%esp
+  80068a:	53                   	push   %ebx
+  80068b:	57                   	push   %edi
+  80068c:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80068f:	83 ee 01             	sub    $0x1,%esi
+  800692:	83 c4 10             	add    $0x10,%esp
+  800695:	85 f6                	test   %esi,%esi
+  800697:	7f ee                	jg     800687 <vprintfmt+0x1cc>
+  800699:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80069c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80069f:	85 c0                	test   %eax,%eax
+  8006a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006a6:	0f 49 d0             	cmovns %eax,%edx
+  8006a9:	29 d0                	sub    %edx,%eax
+  8006ab:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006ae:	eb a6                	jmp    800656 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8006b0:	83 ec 08             	sub    $0x8,%esp
+  8006b3:	53                   	push   %ebx
+  8006b4:	52                   	push   %edx
+  8006b5:	ff 55 08             	call   *0x8(%ebp)
+  8006b8:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8006bb:	89 f1                	mov    %esi,%ecx
+  8006bd:	8d 71 01             	lea    0x1(%ecx),%esi
+  8006c0:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8006c4:	0f be d0             	movsbl %al,%edx
+  8006c7:	85 d2                	test   %edx,%edx
+  8006c9:	74 28                	je     8006f3 <vprintfmt+0x238>
+  8006cb:	85 ff                	test   %edi,%edi
+  8006cd:	78 05                	js     8006d4 <vprintfmt+0x219>
+  8006cf:	83 ef 01             	sub    $0x1,%edi
+  8006d2:	78 30                	js     800704 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8006d4:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8006d8:	74 d6                	je     8006b0 <vprintfmt+0x1f5>
+  8006da:	0f be c0             	movsbl %al,%eax
+  8006dd:	83 e8 20             	sub    $0x20,%eax
+  8006e0:	83 f8 5e             	cmp    $0x5e,%eax
+  8006e3:	76 cb                	jbe    8006b0 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8006e5:	83 ec 08             	sub    $0x8,%esp
+  8006e8:	53                   	push   %ebx
+  8006e9:	6a 3f                	push   $0x3f
+  8006eb:	ff 55 08             	call   *0x8(%ebp)
+  8006ee:	83 c4 10             	add    $0x10,%esp
+  8006f1:	eb c8                	jmp    8006bb <vprintfmt+0x200>
+  8006f3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006f6:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8006f9:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8006fc:	01 d0                	add    %edx,%eax
+  8006fe:	29 c8                	sub    %ecx,%eax
+  800700:	89 c7                	mov    %eax,%edi
+  800702:	eb 13                	jmp    800717 <vprintfmt+0x25c>
+  800704:	8b 75 08             	mov    0x8(%ebp),%esi
+  800707:	eb ed                	jmp    8006f6 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800709:	83 ec 08             	sub    $0x8,%esp
+  80070c:	53                   	push   %ebx
+  80070d:	6a 20                	push   $0x20
+  80070f:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800711:	83 ef 01             	sub    $0x1,%edi
+  800714:	83 c4 10             	add    $0x10,%esp
+  800717:	85 ff                	test   %edi,%edi
+  800719:	7f ee                	jg     800709 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80071b:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80071e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800721:	e9 36 01 00 00       	jmp    80085c <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  800726:	83 f9 01             	cmp    $0x1,%ecx
+  800729:	7f 1f                	jg     80074a <vprintfmt+0x28f>
+	else if (lflag)
+  80072b:	85 c9                	test   %ecx,%ecx
+  80072d:	74 67                	je     800796 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  80072f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800732:	8b 00                	mov    (%eax),%eax
+  800734:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800737:	89 c1                	mov    %eax,%ecx
+  800739:	c1 f9 1f             	sar    $0x1f,%ecx
+  80073c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80073f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800742:	8d 40 04             	lea    0x4(%eax),%eax
+  800745:	89 45 14             	mov    %eax,0x14(%ebp)
+  800748:	eb 17                	jmp    800761 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  80074a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80074d:	8b 50 04             	mov    0x4(%eax),%edx
+  800750:	8b 00                	mov    (%eax),%eax
+  800752:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800755:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800758:	8b 45 14             	mov    0x14(%ebp),%eax
+  80075b:	8d 40 08             	lea    0x8(%eax),%eax
+  80075e:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800761:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800764:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800767:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80076c:	85 c9                	test   %ecx,%ecx
+  80076e:	0f 89 ce 00 00 00    	jns    800842 <vprintfmt+0x387>
+				putch('-', putdat);
+  800774:	83 ec 08             	sub    $0x8,%esp
+  800777:	53                   	push   %ebx
+  800778:	6a 2d                	push   $0x2d
+  80077a:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80077c:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80077f:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800782:	f7 da                	neg    %edx
+  800784:	83 d1 00             	adc    $0x0,%ecx
+  800787:	f7 d9                	neg    %ecx
+  800789:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80078c:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800791:	e9 ac 00 00 00       	jmp    800842 <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  800796:	8b 45 14             	mov    0x14(%ebp),%eax
+  800799:	8b 00                	mov    (%eax),%eax
+  80079b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80079e:	89 c1                	mov    %eax,%ecx
+  8007a0:	c1 f9 1f             	sar    $0x1f,%ecx
+  8007a3:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8007a6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a9:	8d 40 04             	lea    0x4(%eax),%eax
+  8007ac:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007af:	eb b0                	jmp    800761 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8007b1:	83 f9 01             	cmp    $0x1,%ecx
+  8007b4:	7f 1b                	jg     8007d1 <vprintfmt+0x316>
+	else if (lflag)
+  8007b6:	85 c9                	test   %ecx,%ecx
+  8007b8:	74 2c                	je     8007e6 <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  8007ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007bd:	8b 10                	mov    (%eax),%edx
+  8007bf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007c4:	8d 40 04             	lea    0x4(%eax),%eax
+  8007c7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007ca:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8007cf:	eb 71                	jmp    800842 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  8007d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d4:	8b 10                	mov    (%eax),%edx
+  8007d6:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007d9:	8d 40 08             	lea    0x8(%eax),%eax
+  8007dc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007df:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8007e4:	eb 5c                	jmp    800842 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  8007e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e9:	8b 10                	mov    (%eax),%edx
+  8007eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007f0:	8d 40 04             	lea    0x4(%eax),%eax
+  8007f3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007f6:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8007fb:	eb 45                	jmp    800842 <vprintfmt+0x387>
+			putch('X', putdat);
+  8007fd:	83 ec 08             	sub    $0x8,%esp
+  800800:	53                   	push   %ebx
+  800801:	6a 58                	push   $0x58
+  800803:	ff d6                	call   *%esi
+			putch('X', putdat);
+  800805:	83 c4 08             	add    $0x8,%esp
+  800808:	53                   	push   %ebx
+  800809:	6a 58                	push   $0x58
+  80080b:	ff d6                	call   *%esi
+			putch('X', putdat);
+  80080d:	83 c4 08             	add    $0x8,%esp
+  800810:	53                   	push   %ebx
+  800811:	6a 58                	push   $0x58
+  800813:	ff d6                	call   *%esi
+			break;
+  800815:	83 c4 10             	add    $0x10,%esp
+  800818:	eb 42                	jmp    80085c <vprintfmt+0x3a1>
+			putch('0', putdat);
+  80081a:	83 ec 08             	sub    $0x8,%esp
+  80081d:	53                   	push   %ebx
+  80081e:	6a 30                	push   $0x30
+  800820:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800822:	83 c4 08             	add    $0x8,%esp
+  800825:	53                   	push   %ebx
+  800826:	6a 78                	push   $0x78
+  800828:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  80082a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80082d:	8b 10                	mov    (%eax),%edx
+  80082f:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800834:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800837:	8d 40 04             	lea    0x4(%eax),%eax
+  80083a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80083d:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800842:	83 ec 0c             	sub    $0xc,%esp
+  800845:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800849:	50                   	push   %eax
+  80084a:	ff 75 e0             	push   -0x20(%ebp)
+  80084d:	57                   	push   %edi
+  80084e:	51                   	push   %ecx
+  80084f:	52                   	push   %edx
+  800850:	89 da                	mov    %ebx,%edx
+  800852:	89 f0                	mov    %esi,%eax
+  800854:	e8 7f fb ff ff       	call   8003d8 <printnum>
+			break;
+  800859:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80085c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80085f:	e9 75 fc ff ff       	jmp    8004d9 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800864:	83 f9 01             	cmp    $0x1,%ecx
+  800867:	7f 1b                	jg     800884 <vprintfmt+0x3c9>
+	else if (lflag)
+  800869:	85 c9                	test   %ecx,%ecx
+  80086b:	74 2c                	je     800899 <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  80086d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800870:	8b 10                	mov    (%eax),%edx
+  800872:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800877:	8d 40 04             	lea    0x4(%eax),%eax
+  80087a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80087d:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800882:	eb be                	jmp    800842 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  800884:	8b 45 14             	mov    0x14(%ebp),%eax
+  800887:	8b 10                	mov    (%eax),%edx
+  800889:	8b 48 04             	mov    0x4(%eax),%ecx
+  80088c:	8d 40 08             	lea    0x8(%eax),%eax
+  80088f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800892:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800897:	eb a9                	jmp    800842 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  800899:	8b 45 14             	mov    0x14(%ebp),%eax
+  80089c:	8b 10                	mov    (%eax),%edx
+  80089e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008a3:	8d 40 04             	lea    0x4(%eax),%eax
+  8008a6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008a9:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8008ae:	eb 92                	jmp    800842 <vprintfmt+0x387>
+			putch(ch, putdat);
+  8008b0:	83 ec 08             	sub    $0x8,%esp
+  8008b3:	53                   	push   %ebx
+  8008b4:	6a 25                	push   $0x25
+  8008b6:	ff d6                	call   *%esi
+			break;
+  8008b8:	83 c4 10             	add    $0x10,%esp
+  8008bb:	eb 9f                	jmp    80085c <vprintfmt+0x3a1>
+			putch('%', putdat);
+  8008bd:	83 ec 08             	sub    $0x8,%esp
+  8008c0:	53                   	push   %ebx
+  8008c1:	6a 25                	push   $0x25
+  8008c3:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8008c5:	83 c4 10             	add    $0x10,%esp
+  8008c8:	89 f8                	mov    %edi,%eax
+  8008ca:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8008ce:	74 05                	je     8008d5 <vprintfmt+0x41a>
+  8008d0:	83 e8 01             	sub    $0x1,%eax
+  8008d3:	eb f5                	jmp    8008ca <vprintfmt+0x40f>
+  8008d5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8008d8:	eb 82                	jmp    80085c <vprintfmt+0x3a1>
+
+008008da <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8008da:	55                   	push   %ebp
+  8008db:	89 e5                	mov    %esp,%ebp
+  8008dd:	83 ec 18             	sub    $0x18,%esp
+  8008e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008e3:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8008e6:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8008e9:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8008ed:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8008f0:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8008f7:	85 c0                	test   %eax,%eax
+  8008f9:	74 26                	je     800921 <vsnprintf+0x47>
+  8008fb:	85 d2                	test   %edx,%edx
+  8008fd:	7e 22                	jle    800921 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8008ff:	ff 75 14             	push   0x14(%ebp)
+  800902:	ff 75 10             	push   0x10(%ebp)
+  800905:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800908:	50                   	push   %eax
+  800909:	68 81 04 80 00       	push   $0x800481
+  80090e:	e8 a8 fb ff ff       	call   8004bb <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800913:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800916:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800919:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80091c:	83 c4 10             	add    $0x10,%esp
+}
+  80091f:	c9                   	leave
+  800920:	c3                   	ret
+		return -E_INVAL;
+  800921:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800926:	eb f7                	jmp    80091f <vsnprintf+0x45>
+
+00800928 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800928:	55                   	push   %ebp
+  800929:	89 e5                	mov    %esp,%ebp
+  80092b:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80092e:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800931:	50                   	push   %eax
+  800932:	ff 75 10             	push   0x10(%ebp)
+  800935:	ff 75 0c             	push   0xc(%ebp)
+  800938:	ff 75 08             	push   0x8(%ebp)
+  80093b:	e8 9a ff ff ff       	call   8008da <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800940:	c9                   	leave
+  800941:	c3                   	ret
+
+00800942 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800942:	55                   	push   %ebp
+  800943:	89 e5                	mov    %esp,%ebp
+  800945:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800948:	b8 00 00 00 00       	mov    $0x0,%eax
+  80094d:	eb 03                	jmp    800952 <strlen+0x10>
+		n++;
+  80094f:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800952:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800956:	75 f7                	jne    80094f <strlen+0xd>
+	return n;
+}
+  800958:	5d                   	pop    %ebp
+  800959:	c3                   	ret
+
+0080095a <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80095a:	55                   	push   %ebp
+  80095b:	89 e5                	mov    %esp,%ebp
+  80095d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800960:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800963:	b8 00 00 00 00       	mov    $0x0,%eax
+  800968:	eb 03                	jmp    80096d <strnlen+0x13>
+		n++;
+  80096a:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80096d:	39 d0                	cmp    %edx,%eax
+  80096f:	74 08                	je     800979 <strnlen+0x1f>
+  800971:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800975:	75 f3                	jne    80096a <strnlen+0x10>
+  800977:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800979:	89 d0                	mov    %edx,%eax
+  80097b:	5d                   	pop    %ebp
+  80097c:	c3                   	ret
+
+0080097d <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80097d:	55                   	push   %ebp
+  80097e:	89 e5                	mov    %esp,%ebp
+  800980:	53                   	push   %ebx
+  800981:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800984:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800987:	b8 00 00 00 00       	mov    $0x0,%eax
+  80098c:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800990:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800993:	83 c0 01             	add    $0x1,%eax
+  800996:	84 d2                	test   %dl,%dl
+  800998:	75 f2                	jne    80098c <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80099a:	89 c8                	mov    %ecx,%eax
+  80099c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80099f:	c9                   	leave
+  8009a0:	c3                   	ret
+
+008009a1 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8009a1:	55                   	push   %ebp
+  8009a2:	89 e5                	mov    %esp,%ebp
+  8009a4:	53                   	push   %ebx
+  8009a5:	83 ec 10             	sub    $0x10,%esp
+  8009a8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8009ab:	53                   	push   %ebx
+  8009ac:	e8 91 ff ff ff       	call   800942 <strlen>
+  8009b1:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8009b4:	ff 75 0c             	push   0xc(%ebp)
+  8009b7:	01 d8                	add    %ebx,%eax
+  8009b9:	50                   	push   %eax
+  8009ba:	e8 be ff ff ff       	call   80097d <strcpy>
+	return dst;
+}
+  8009bf:	89 d8                	mov    %ebx,%eax
+  8009c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009c4:	c9                   	leave
+  8009c5:	c3                   	ret
+
+008009c6 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8009c6:	55                   	push   %ebp
+  8009c7:	89 e5                	mov    %esp,%ebp
+  8009c9:	56                   	push   %esi
+  8009ca:	53                   	push   %ebx
+  8009cb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009ce:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8009d1:	89 f3                	mov    %esi,%ebx
+  8009d3:	03 5d 10             	add    0x10(%ebp),%ebx
+  8009d6:	89 f0                	mov    %esi,%eax
+  8009d8:	eb 0f                	jmp    8009e9 <strncpy+0x23>
+		*dst++ = *src;
+  8009da:	83 c0 01             	add    $0x1,%eax
+  8009dd:	0f b6 0a             	movzbl (%edx),%ecx
+  8009e0:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8009e3:	80 f9 01             	cmp    $0x1,%cl
+  8009e6:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8009e9:	39 d8                	cmp    %ebx,%eax
+  8009eb:	75 ed                	jne    8009da <strncpy+0x14>
+	}
+	return ret;
+}
+  8009ed:	89 f0                	mov    %esi,%eax
+  8009ef:	5b                   	pop    %ebx
+  8009f0:	5e                   	pop    %esi
+  8009f1:	5d                   	pop    %ebp
+  8009f2:	c3                   	ret
+
+008009f3 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8009f3:	55                   	push   %ebp
+  8009f4:	89 e5                	mov    %esp,%ebp
+  8009f6:	56                   	push   %esi
+  8009f7:	53                   	push   %ebx
+  8009f8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009fb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009fe:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800a01:	89 f0                	mov    %esi,%eax
+  800a03:	85 d2                	test   %edx,%edx
+  800a05:	74 21                	je     800a28 <strlcpy+0x35>
+  800a07:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800a0b:	89 f2                	mov    %esi,%edx
+  800a0d:	eb 09                	jmp    800a18 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800a0f:	83 c1 01             	add    $0x1,%ecx
+  800a12:	83 c2 01             	add    $0x1,%edx
+  800a15:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800a18:	39 c2                	cmp    %eax,%edx
+  800a1a:	74 09                	je     800a25 <strlcpy+0x32>
+  800a1c:	0f b6 19             	movzbl (%ecx),%ebx
+  800a1f:	84 db                	test   %bl,%bl
+  800a21:	75 ec                	jne    800a0f <strlcpy+0x1c>
+  800a23:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800a25:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800a28:	29 f0                	sub    %esi,%eax
+}
+  800a2a:	5b                   	pop    %ebx
+  800a2b:	5e                   	pop    %esi
+  800a2c:	5d                   	pop    %ebp
+  800a2d:	c3                   	ret
+
+00800a2e <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800a2e:	55                   	push   %ebp
+  800a2f:	89 e5                	mov    %esp,%ebp
+  800a31:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a34:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800a37:	eb 06                	jmp    800a3f <strcmp+0x11>
+		p++, q++;
+  800a39:	83 c1 01             	add    $0x1,%ecx
+  800a3c:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800a3f:	0f b6 01             	movzbl (%ecx),%eax
+  800a42:	84 c0                	test   %al,%al
+  800a44:	74 04                	je     800a4a <strcmp+0x1c>
+  800a46:	3a 02                	cmp    (%edx),%al
+  800a48:	74 ef                	je     800a39 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a4a:	0f b6 c0             	movzbl %al,%eax
+  800a4d:	0f b6 12             	movzbl (%edx),%edx
+  800a50:	29 d0                	sub    %edx,%eax
+}
+  800a52:	5d                   	pop    %ebp
+  800a53:	c3                   	ret
+
+00800a54 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800a54:	55                   	push   %ebp
+  800a55:	89 e5                	mov    %esp,%ebp
+  800a57:	53                   	push   %ebx
+  800a58:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a5b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a5e:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800a61:	eb 09                	jmp    800a6c <strncmp+0x18>
+		n--, p++, q++;
+  800a63:	83 ea 01             	sub    $0x1,%edx
+  800a66:	83 c0 01             	add    $0x1,%eax
+  800a69:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800a6c:	85 d2                	test   %edx,%edx
+  800a6e:	74 18                	je     800a88 <strncmp+0x34>
+  800a70:	0f b6 18             	movzbl (%eax),%ebx
+  800a73:	84 db                	test   %bl,%bl
+  800a75:	74 04                	je     800a7b <strncmp+0x27>
+  800a77:	3a 19                	cmp    (%ecx),%bl
+  800a79:	74 e8                	je     800a63 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a7b:	0f b6 00             	movzbl (%eax),%eax
+  800a7e:	0f b6 11             	movzbl (%ecx),%edx
+  800a81:	29 d0                	sub    %edx,%eax
+}
+  800a83:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a86:	c9                   	leave
+  800a87:	c3                   	ret
+		return 0;
+  800a88:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a8d:	eb f4                	jmp    800a83 <strncmp+0x2f>
+
+00800a8f <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a8f:	55                   	push   %ebp
+  800a90:	89 e5                	mov    %esp,%ebp
+  800a92:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a95:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a99:	eb 03                	jmp    800a9e <strchr+0xf>
+  800a9b:	83 c0 01             	add    $0x1,%eax
+  800a9e:	0f b6 10             	movzbl (%eax),%edx
+  800aa1:	84 d2                	test   %dl,%dl
+  800aa3:	74 06                	je     800aab <strchr+0x1c>
+		if (*s == c)
+  800aa5:	38 ca                	cmp    %cl,%dl
+  800aa7:	75 f2                	jne    800a9b <strchr+0xc>
+  800aa9:	eb 05                	jmp    800ab0 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800aab:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ab0:	5d                   	pop    %ebp
+  800ab1:	c3                   	ret
+
+00800ab2 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800ab2:	55                   	push   %ebp
+  800ab3:	89 e5                	mov    %esp,%ebp
+  800ab5:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ab8:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800abc:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800abf:	38 ca                	cmp    %cl,%dl
+  800ac1:	74 09                	je     800acc <strfind+0x1a>
+  800ac3:	84 d2                	test   %dl,%dl
+  800ac5:	74 05                	je     800acc <strfind+0x1a>
+	for (; *s; s++)
+  800ac7:	83 c0 01             	add    $0x1,%eax
+  800aca:	eb f0                	jmp    800abc <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800acc:	5d                   	pop    %ebp
+  800acd:	c3                   	ret
+
+00800ace <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800ace:	55                   	push   %ebp
+  800acf:	89 e5                	mov    %esp,%ebp
+  800ad1:	57                   	push   %edi
+  800ad2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800ad5:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800ad8:	85 c9                	test   %ecx,%ecx
+  800ada:	74 20                	je     800afc <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800adc:	89 f8                	mov    %edi,%eax
+  800ade:	09 c8                	or     %ecx,%eax
+  800ae0:	a8 03                	test   $0x3,%al
+  800ae2:	75 12                	jne    800af6 <memset+0x28>
+		c &= 0xFF;
+  800ae4:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800ae8:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800aee:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800af1:	fc                   	cld
+  800af2:	f3 ab                	rep stos %eax,%es:(%edi)
+  800af4:	eb 06                	jmp    800afc <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800af6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800af9:	fc                   	cld
+  800afa:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800afc:	89 f8                	mov    %edi,%eax
+  800afe:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800b01:	c9                   	leave
+  800b02:	c3                   	ret
+
+00800b03 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800b03:	55                   	push   %ebp
+  800b04:	89 e5                	mov    %esp,%ebp
+  800b06:	57                   	push   %edi
+  800b07:	56                   	push   %esi
+  800b08:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b0b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b0e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800b11:	39 c6                	cmp    %eax,%esi
+  800b13:	73 32                	jae    800b47 <memmove+0x44>
+  800b15:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800b18:	39 d0                	cmp    %edx,%eax
+  800b1a:	73 2b                	jae    800b47 <memmove+0x44>
+		s += n;
+		d += n;
+  800b1c:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b1f:	89 d6                	mov    %edx,%esi
+  800b21:	09 fe                	or     %edi,%esi
+  800b23:	09 ce                	or     %ecx,%esi
+  800b25:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800b2b:	75 0e                	jne    800b3b <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800b2d:	83 ef 04             	sub    $0x4,%edi
+  800b30:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800b33:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800b36:	fd                   	std
+  800b37:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b39:	eb 09                	jmp    800b44 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800b3b:	83 ef 01             	sub    $0x1,%edi
+  800b3e:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800b41:	fd                   	std
+  800b42:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800b44:	fc                   	cld
+  800b45:	eb 1a                	jmp    800b61 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b47:	89 f2                	mov    %esi,%edx
+  800b49:	09 c2                	or     %eax,%edx
+  800b4b:	09 ca                	or     %ecx,%edx
+  800b4d:	f6 c2 03             	test   $0x3,%dl
+  800b50:	75 0a                	jne    800b5c <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800b52:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800b55:	89 c7                	mov    %eax,%edi
+  800b57:	fc                   	cld
+  800b58:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b5a:	eb 05                	jmp    800b61 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800b5c:	89 c7                	mov    %eax,%edi
+  800b5e:	fc                   	cld
+  800b5f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800b61:	5e                   	pop    %esi
+  800b62:	5f                   	pop    %edi
+  800b63:	5d                   	pop    %ebp
+  800b64:	c3                   	ret
+
+00800b65 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800b65:	55                   	push   %ebp
+  800b66:	89 e5                	mov    %esp,%ebp
+  800b68:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800b6b:	ff 75 10             	push   0x10(%ebp)
+  800b6e:	ff 75 0c             	push   0xc(%ebp)
+  800b71:	ff 75 08             	push   0x8(%ebp)
+  800b74:	e8 8a ff ff ff       	call   800b03 <memmove>
+}
+  800b79:	c9                   	leave
+  800b7a:	c3                   	ret
+
+00800b7b <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800b7b:	55                   	push   %ebp
+  800b7c:	89 e5                	mov    %esp,%ebp
+  800b7e:	56                   	push   %esi
+  800b7f:	53                   	push   %ebx
+  800b80:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b83:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800b86:	89 c6                	mov    %eax,%esi
+  800b88:	03 75 10             	add    0x10(%ebp),%esi
+  800b8b:	eb 06                	jmp    800b93 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800b8d:	83 c0 01             	add    $0x1,%eax
+  800b90:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b93:	39 f0                	cmp    %esi,%eax
+  800b95:	74 14                	je     800bab <memcmp+0x30>
+		if (*s1 != *s2)
+  800b97:	0f b6 08             	movzbl (%eax),%ecx
+  800b9a:	0f b6 1a             	movzbl (%edx),%ebx
+  800b9d:	38 d9                	cmp    %bl,%cl
+  800b9f:	74 ec                	je     800b8d <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800ba1:	0f b6 c1             	movzbl %cl,%eax
+  800ba4:	0f b6 db             	movzbl %bl,%ebx
+  800ba7:	29 d8                	sub    %ebx,%eax
+  800ba9:	eb 05                	jmp    800bb0 <memcmp+0x35>
+	}
+
+	return 0;
+  800bab:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800bb0:	5b                   	pop    %ebx
+  800bb1:	5e                   	pop    %esi
+  800bb2:	5d                   	pop    %ebp
+  800bb3:	c3                   	ret
+
+00800bb4 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800bb4:	55                   	push   %ebp
+  800bb5:	89 e5                	mov    %esp,%ebp
+  800bb7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800bbd:	89 c2                	mov    %eax,%edx
+  800bbf:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800bc2:	eb 03                	jmp    800bc7 <memfind+0x13>
+  800bc4:	83 c0 01             	add    $0x1,%eax
+  800bc7:	39 d0                	cmp    %edx,%eax
+  800bc9:	73 04                	jae    800bcf <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800bcb:	38 08                	cmp    %cl,(%eax)
+  800bcd:	75 f5                	jne    800bc4 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800bcf:	5d                   	pop    %ebp
+  800bd0:	c3                   	ret
+
+00800bd1 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800bd1:	55                   	push   %ebp
+  800bd2:	89 e5                	mov    %esp,%ebp
+  800bd4:	57                   	push   %edi
+  800bd5:	56                   	push   %esi
+  800bd6:	53                   	push   %ebx
+  800bd7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bda:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800bdd:	eb 03                	jmp    800be2 <strtol+0x11>
+		s++;
+  800bdf:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800be2:	0f b6 02             	movzbl (%edx),%eax
+  800be5:	3c 20                	cmp    $0x20,%al
+  800be7:	74 f6                	je     800bdf <strtol+0xe>
+  800be9:	3c 09                	cmp    $0x9,%al
+  800beb:	74 f2                	je     800bdf <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800bed:	3c 2b                	cmp    $0x2b,%al
+  800bef:	74 2a                	je     800c1b <strtol+0x4a>
+	int neg = 0;
+  800bf1:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800bf6:	3c 2d                	cmp    $0x2d,%al
+  800bf8:	74 2b                	je     800c25 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800bfa:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800c00:	75 0f                	jne    800c11 <strtol+0x40>
+  800c02:	80 3a 30             	cmpb   $0x30,(%edx)
+  800c05:	74 28                	je     800c2f <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800c07:	85 db                	test   %ebx,%ebx
+  800c09:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c0e:	0f 44 d8             	cmove  %eax,%ebx
+  800c11:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c16:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800c19:	eb 46                	jmp    800c61 <strtol+0x90>
+		s++;
+  800c1b:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800c1e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c23:	eb d5                	jmp    800bfa <strtol+0x29>
+		s++, neg = 1;
+  800c25:	83 c2 01             	add    $0x1,%edx
+  800c28:	bf 01 00 00 00       	mov    $0x1,%edi
+  800c2d:	eb cb                	jmp    800bfa <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c2f:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800c33:	74 0e                	je     800c43 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800c35:	85 db                	test   %ebx,%ebx
+  800c37:	75 d8                	jne    800c11 <strtol+0x40>
+		s++, base = 8;
+  800c39:	83 c2 01             	add    $0x1,%edx
+  800c3c:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800c41:	eb ce                	jmp    800c11 <strtol+0x40>
+		s += 2, base = 16;
+  800c43:	83 c2 02             	add    $0x2,%edx
+  800c46:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800c4b:	eb c4                	jmp    800c11 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800c4d:	0f be c0             	movsbl %al,%eax
+  800c50:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800c53:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800c56:	7d 3a                	jge    800c92 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800c58:	83 c2 01             	add    $0x1,%edx
+  800c5b:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800c5f:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800c61:	0f b6 02             	movzbl (%edx),%eax
+  800c64:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800c67:	89 f3                	mov    %esi,%ebx
+  800c69:	80 fb 09             	cmp    $0x9,%bl
+  800c6c:	76 df                	jbe    800c4d <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800c6e:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800c71:	89 f3                	mov    %esi,%ebx
+  800c73:	80 fb 19             	cmp    $0x19,%bl
+  800c76:	77 08                	ja     800c80 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800c78:	0f be c0             	movsbl %al,%eax
+  800c7b:	83 e8 57             	sub    $0x57,%eax
+  800c7e:	eb d3                	jmp    800c53 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800c80:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c83:	89 f3                	mov    %esi,%ebx
+  800c85:	80 fb 19             	cmp    $0x19,%bl
+  800c88:	77 08                	ja     800c92 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800c8a:	0f be c0             	movsbl %al,%eax
+  800c8d:	83 e8 37             	sub    $0x37,%eax
+  800c90:	eb c1                	jmp    800c53 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c92:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c96:	74 05                	je     800c9d <strtol+0xcc>
+		*endptr = (char *) s;
+  800c98:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c9b:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800c9d:	89 c8                	mov    %ecx,%eax
+  800c9f:	f7 d8                	neg    %eax
+  800ca1:	85 ff                	test   %edi,%edi
+  800ca3:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800ca6:	89 c8                	mov    %ecx,%eax
+  800ca8:	5b                   	pop    %ebx
+  800ca9:	5e                   	pop    %esi
+  800caa:	5f                   	pop    %edi
+  800cab:	5d                   	pop    %ebp
+  800cac:	c3                   	ret
+
+00800cad <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800cad:	55                   	push   %ebp
+  800cae:	89 e5                	mov    %esp,%ebp
+  800cb0:	57                   	push   %edi
+  800cb1:	56                   	push   %esi
+  800cb2:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800cb3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cb8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cbb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cbe:	89 c3                	mov    %eax,%ebx
+  800cc0:	89 c7                	mov    %eax,%edi
+  800cc2:	89 c6                	mov    %eax,%esi
+  800cc4:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  800cc6:	5b                   	pop    %ebx
+  800cc7:	5e                   	pop    %esi
+  800cc8:	5f                   	pop    %edi
+  800cc9:	5d                   	pop    %ebp
+  800cca:	c3                   	ret
+
+00800ccb <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800ccb:	55                   	push   %ebp
+  800ccc:	89 e5                	mov    %esp,%ebp
+  800cce:	57                   	push   %edi
+  800ccf:	56                   	push   %esi
+  800cd0:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800cd1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cd6:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cdb:	89 d1                	mov    %edx,%ecx
+  800cdd:	89 d3                	mov    %edx,%ebx
+  800cdf:	89 d7                	mov    %edx,%edi
+  800ce1:	89 d6                	mov    %edx,%esi
+  800ce3:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800ce5:	5b                   	pop    %ebx
+  800ce6:	5e                   	pop    %esi
+  800ce7:	5f                   	pop    %edi
+  800ce8:	5d                   	pop    %ebp
+  800ce9:	c3                   	ret
+
+00800cea <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800cea:	55                   	push   %ebp
+  800ceb:	89 e5                	mov    %esp,%ebp
+  800ced:	57                   	push   %edi
+  800cee:	56                   	push   %esi
+  800cef:	53                   	push   %ebx
+  800cf0:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800cf3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cf8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cfb:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d00:	89 cb                	mov    %ecx,%ebx
+  800d02:	89 cf                	mov    %ecx,%edi
+  800d04:	89 ce                	mov    %ecx,%esi
+  800d06:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d08:	85 c0                	test   %eax,%eax
+  800d0a:	7f 08                	jg     800d14 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800d0c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d0f:	5b                   	pop    %ebx
+  800d10:	5e                   	pop    %esi
+  800d11:	5f                   	pop    %edi
+  800d12:	5d                   	pop    %ebp
+  800d13:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d14:	83 ec 0c             	sub    $0xc,%esp
+  800d17:	50                   	push   %eax
+  800d18:	6a 03                	push   $0x3
+  800d1a:	68 e3 2e 80 00       	push   $0x802ee3
+  800d1f:	6a 3e                	push   $0x3e
+  800d21:	68 00 2f 80 00       	push   $0x802f00
+  800d26:	e8 be f5 ff ff       	call   8002e9 <_panic>
+
+00800d2b <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800d2b:	55                   	push   %ebp
+  800d2c:	89 e5                	mov    %esp,%ebp
+  800d2e:	57                   	push   %edi
+  800d2f:	56                   	push   %esi
+  800d30:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d31:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d36:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d3b:	89 d1                	mov    %edx,%ecx
+  800d3d:	89 d3                	mov    %edx,%ebx
+  800d3f:	89 d7                	mov    %edx,%edi
+  800d41:	89 d6                	mov    %edx,%esi
+  800d43:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800d45:	5b                   	pop    %ebx
+  800d46:	5e                   	pop    %esi
+  800d47:	5f                   	pop    %edi
+  800d48:	5d                   	pop    %ebp
+  800d49:	c3                   	ret
+
+00800d4a <sys_yield>:
+
+void
+sys_yield(void) {
+  800d4a:	55                   	push   %ebp
+  800d4b:	89 e5                	mov    %esp,%ebp
+  800d4d:	57                   	push   %edi
+  800d4e:	56                   	push   %esi
+  800d4f:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d50:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d55:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d5a:	89 d1                	mov    %edx,%ecx
+  800d5c:	89 d3                	mov    %edx,%ebx
+  800d5e:	89 d7                	mov    %edx,%edi
+  800d60:	89 d6                	mov    %edx,%esi
+  800d62:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800d64:	5b                   	pop    %ebx
+  800d65:	5e                   	pop    %esi
+  800d66:	5f                   	pop    %edi
+  800d67:	5d                   	pop    %ebp
+  800d68:	c3                   	ret
+
+00800d69 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  800d69:	55                   	push   %ebp
+  800d6a:	89 e5                	mov    %esp,%ebp
+  800d6c:	57                   	push   %edi
+  800d6d:	56                   	push   %esi
+  800d6e:	53                   	push   %ebx
+  800d6f:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800d72:	be 00 00 00 00       	mov    $0x0,%esi
+  800d77:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d7a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d7d:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d82:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d85:	89 f7                	mov    %esi,%edi
+  800d87:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d89:	85 c0                	test   %eax,%eax
+  800d8b:	7f 08                	jg     800d95 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800d8d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d90:	5b                   	pop    %ebx
+  800d91:	5e                   	pop    %esi
+  800d92:	5f                   	pop    %edi
+  800d93:	5d                   	pop    %ebp
+  800d94:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d95:	83 ec 0c             	sub    $0xc,%esp
+  800d98:	50                   	push   %eax
+  800d99:	6a 04                	push   $0x4
+  800d9b:	68 e3 2e 80 00       	push   $0x802ee3
+  800da0:	6a 3e                	push   $0x3e
+  800da2:	68 00 2f 80 00       	push   $0x802f00
+  800da7:	e8 3d f5 ff ff       	call   8002e9 <_panic>
+
+00800dac <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  800dac:	55                   	push   %ebp
+  800dad:	89 e5                	mov    %esp,%ebp
+  800daf:	57                   	push   %edi
+  800db0:	56                   	push   %esi
+  800db1:	53                   	push   %ebx
+  800db2:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800db5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800db8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dbb:	b8 05 00 00 00       	mov    $0x5,%eax
+  800dc0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dc3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dc6:	8b 75 18             	mov    0x18(%ebp),%esi
+  800dc9:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800dcb:	85 c0                	test   %eax,%eax
+  800dcd:	7f 08                	jg     800dd7 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800dcf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dd2:	5b                   	pop    %ebx
+  800dd3:	5e                   	pop    %esi
+  800dd4:	5f                   	pop    %edi
+  800dd5:	5d                   	pop    %ebp
+  800dd6:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800dd7:	83 ec 0c             	sub    $0xc,%esp
+  800dda:	50                   	push   %eax
+  800ddb:	6a 05                	push   $0x5
+  800ddd:	68 e3 2e 80 00       	push   $0x802ee3
+  800de2:	6a 3e                	push   $0x3e
+  800de4:	68 00 2f 80 00       	push   $0x802f00
+  800de9:	e8 fb f4 ff ff       	call   8002e9 <_panic>
+
+00800dee <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  800dee:	55                   	push   %ebp
+  800def:	89 e5                	mov    %esp,%ebp
+  800df1:	57                   	push   %edi
+  800df2:	56                   	push   %esi
+  800df3:	53                   	push   %ebx
+  800df4:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800df7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dfc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e02:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e07:	89 df                	mov    %ebx,%edi
+  800e09:	89 de                	mov    %ebx,%esi
+  800e0b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e0d:	85 c0                	test   %eax,%eax
+  800e0f:	7f 08                	jg     800e19 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e11:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e14:	5b                   	pop    %ebx
+  800e15:	5e                   	pop    %esi
+  800e16:	5f                   	pop    %edi
+  800e17:	5d                   	pop    %ebp
+  800e18:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e19:	83 ec 0c             	sub    $0xc,%esp
+  800e1c:	50                   	push   %eax
+  800e1d:	6a 06                	push   $0x6
+  800e1f:	68 e3 2e 80 00       	push   $0x802ee3
+  800e24:	6a 3e                	push   $0x3e
+  800e26:	68 00 2f 80 00       	push   $0x802f00
+  800e2b:	e8 b9 f4 ff ff       	call   8002e9 <_panic>
+
+00800e30 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800e30:	55                   	push   %ebp
+  800e31:	89 e5                	mov    %esp,%ebp
+  800e33:	57                   	push   %edi
+  800e34:	56                   	push   %esi
+  800e35:	53                   	push   %ebx
+  800e36:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800e39:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e3e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e41:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e44:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e49:	89 df                	mov    %ebx,%edi
+  800e4b:	89 de                	mov    %ebx,%esi
+  800e4d:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e4f:	85 c0                	test   %eax,%eax
+  800e51:	7f 08                	jg     800e5b <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800e53:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e56:	5b                   	pop    %ebx
+  800e57:	5e                   	pop    %esi
+  800e58:	5f                   	pop    %edi
+  800e59:	5d                   	pop    %ebp
+  800e5a:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e5b:	83 ec 0c             	sub    $0xc,%esp
+  800e5e:	50                   	push   %eax
+  800e5f:	6a 08                	push   $0x8
+  800e61:	68 e3 2e 80 00       	push   $0x802ee3
+  800e66:	6a 3e                	push   $0x3e
+  800e68:	68 00 2f 80 00       	push   $0x802f00
+  800e6d:	e8 77 f4 ff ff       	call   8002e9 <_panic>
+
+00800e72 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800e72:	55                   	push   %ebp
+  800e73:	89 e5                	mov    %esp,%ebp
+  800e75:	57                   	push   %edi
+  800e76:	56                   	push   %esi
+  800e77:	53                   	push   %ebx
+  800e78:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800e7b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e80:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e83:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e86:	b8 09 00 00 00       	mov    $0x9,%eax
+  800e8b:	89 df                	mov    %ebx,%edi
+  800e8d:	89 de                	mov    %ebx,%esi
+  800e8f:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e91:	85 c0                	test   %eax,%eax
+  800e93:	7f 08                	jg     800e9d <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800e95:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e98:	5b                   	pop    %ebx
+  800e99:	5e                   	pop    %esi
+  800e9a:	5f                   	pop    %edi
+  800e9b:	5d                   	pop    %ebp
+  800e9c:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e9d:	83 ec 0c             	sub    $0xc,%esp
+  800ea0:	50                   	push   %eax
+  800ea1:	6a 09                	push   $0x9
+  800ea3:	68 e3 2e 80 00       	push   $0x802ee3
+  800ea8:	6a 3e                	push   $0x3e
+  800eaa:	68 00 2f 80 00       	push   $0x802f00
+  800eaf:	e8 35 f4 ff ff       	call   8002e9 <_panic>
+
+00800eb4 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800eb4:	55                   	push   %ebp
+  800eb5:	89 e5                	mov    %esp,%ebp
+  800eb7:	57                   	push   %edi
+  800eb8:	56                   	push   %esi
+  800eb9:	53                   	push   %ebx
+  800eba:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800ebd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ec2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec8:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ecd:	89 df                	mov    %ebx,%edi
+  800ecf:	89 de                	mov    %ebx,%esi
+  800ed1:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ed3:	85 c0                	test   %eax,%eax
+  800ed5:	7f 08                	jg     800edf <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800ed7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eda:	5b                   	pop    %ebx
+  800edb:	5e                   	pop    %esi
+  800edc:	5f                   	pop    %edi
+  800edd:	5d                   	pop    %ebp
+  800ede:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800edf:	83 ec 0c             	sub    $0xc,%esp
+  800ee2:	50                   	push   %eax
+  800ee3:	6a 0a                	push   $0xa
+  800ee5:	68 e3 2e 80 00       	push   $0x802ee3
+  800eea:	6a 3e                	push   $0x3e
+  800eec:	68 00 2f 80 00       	push   $0x802f00
+  800ef1:	e8 f3 f3 ff ff       	call   8002e9 <_panic>
+
+00800ef6 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  800ef6:	55                   	push   %ebp
+  800ef7:	89 e5                	mov    %esp,%ebp
+  800ef9:	57                   	push   %edi
+  800efa:	56                   	push   %esi
+  800efb:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800efc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f02:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f07:	be 00 00 00 00       	mov    $0x0,%esi
+  800f0c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f0f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f12:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800f14:	5b                   	pop    %ebx
+  800f15:	5e                   	pop    %esi
+  800f16:	5f                   	pop    %edi
+  800f17:	5d                   	pop    %ebp
+  800f18:	c3                   	ret
+
+00800f19 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  800f19:	55                   	push   %ebp
+  800f1a:	89 e5                	mov    %esp,%ebp
+  800f1c:	57                   	push   %edi
+  800f1d:	56                   	push   %esi
+  800f1e:	53                   	push   %ebx
+  800f1f:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800f22:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f27:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f2a:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f2f:	89 cb                	mov    %ecx,%ebx
+  800f31:	89 cf                	mov    %ecx,%edi
+  800f33:	89 ce                	mov    %ecx,%esi
+  800f35:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f37:	85 c0                	test   %eax,%eax
+  800f39:	7f 08                	jg     800f43 <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  800f3b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f3e:	5b                   	pop    %ebx
+  800f3f:	5e                   	pop    %esi
+  800f40:	5f                   	pop    %edi
+  800f41:	5d                   	pop    %ebp
+  800f42:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f43:	83 ec 0c             	sub    $0xc,%esp
+  800f46:	50                   	push   %eax
+  800f47:	6a 0d                	push   $0xd
+  800f49:	68 e3 2e 80 00       	push   $0x802ee3
+  800f4e:	6a 3e                	push   $0x3e
+  800f50:	68 00 2f 80 00       	push   $0x802f00
+  800f55:	e8 8f f3 ff ff       	call   8002e9 <_panic>
+
+00800f5a <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  800f5a:	55                   	push   %ebp
+  800f5b:	89 e5                	mov    %esp,%ebp
+  800f5d:	57                   	push   %edi
+  800f5e:	56                   	push   %esi
+  800f5f:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800f60:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f65:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f68:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f6b:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800f70:	89 df                	mov    %ebx,%edi
+  800f72:	89 de                	mov    %ebx,%esi
+  800f74:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  800f76:	5b                   	pop    %ebx
+  800f77:	5e                   	pop    %esi
+  800f78:	5f                   	pop    %edi
+  800f79:	5d                   	pop    %ebp
+  800f7a:	c3                   	ret
+
+00800f7b <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  800f7b:	55                   	push   %ebp
+  800f7c:	89 e5                	mov    %esp,%ebp
+  800f7e:	57                   	push   %edi
+  800f7f:	56                   	push   %esi
+  800f80:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800f81:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f86:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f89:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f8e:	89 cb                	mov    %ecx,%ebx
+  800f90:	89 cf                	mov    %ecx,%edi
+  800f92:	89 ce                	mov    %ecx,%esi
+  800f94:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  800f96:	5b                   	pop    %ebx
+  800f97:	5e                   	pop    %esi
+  800f98:	5f                   	pop    %edi
+  800f99:	5d                   	pop    %ebp
+  800f9a:	c3                   	ret
+
+00800f9b <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  800f9b:	55                   	push   %ebp
+  800f9c:	89 e5                	mov    %esp,%ebp
+  800f9e:	57                   	push   %edi
+  800f9f:	56                   	push   %esi
+  800fa0:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800fa1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fa6:	b8 10 00 00 00       	mov    $0x10,%eax
+  800fab:	89 d1                	mov    %edx,%ecx
+  800fad:	89 d3                	mov    %edx,%ebx
+  800faf:	89 d7                	mov    %edx,%edi
+  800fb1:	89 d6                	mov    %edx,%esi
+  800fb3:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800fb5:	5b                   	pop    %ebx
+  800fb6:	5e                   	pop    %esi
+  800fb7:	5f                   	pop    %edi
+  800fb8:	5d                   	pop    %ebp
+  800fb9:	c3                   	ret
+
+00800fba <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  800fba:	55                   	push   %ebp
+  800fbb:	89 e5                	mov    %esp,%ebp
+  800fbd:	57                   	push   %edi
+  800fbe:	56                   	push   %esi
+  800fbf:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800fc0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fc5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fcb:	b8 11 00 00 00       	mov    $0x11,%eax
+  800fd0:	89 df                	mov    %ebx,%edi
+  800fd2:	89 de                	mov    %ebx,%esi
+  800fd4:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800fd6:	5b                   	pop    %ebx
+  800fd7:	5e                   	pop    %esi
+  800fd8:	5f                   	pop    %edi
+  800fd9:	5d                   	pop    %ebp
+  800fda:	c3                   	ret
+
+00800fdb <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  800fdb:	55                   	push   %ebp
+  800fdc:	89 e5                	mov    %esp,%ebp
+  800fde:	57                   	push   %edi
+  800fdf:	56                   	push   %esi
+  800fe0:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800fe1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fe6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fec:	b8 12 00 00 00       	mov    $0x12,%eax
+  800ff1:	89 df                	mov    %ebx,%edi
+  800ff3:	89 de                	mov    %ebx,%esi
+  800ff5:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800ff7:	5b                   	pop    %ebx
+  800ff8:	5e                   	pop    %esi
+  800ff9:	5f                   	pop    %edi
+  800ffa:	5d                   	pop    %ebp
+  800ffb:	c3                   	ret
+
+00800ffc <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  800ffc:	55                   	push   %ebp
+  800ffd:	89 e5                	mov    %esp,%ebp
+  800fff:	57                   	push   %edi
+  801000:	56                   	push   %esi
+  801001:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  801002:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801007:	8b 55 08             	mov    0x8(%ebp),%edx
+  80100a:	b8 13 00 00 00       	mov    $0x13,%eax
+  80100f:	89 cb                	mov    %ecx,%ebx
+  801011:	89 cf                	mov    %ecx,%edi
+  801013:	89 ce                	mov    %ecx,%esi
+  801015:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  801017:	5b                   	pop    %ebx
+  801018:	5e                   	pop    %esi
+  801019:	5f                   	pop    %edi
+  80101a:	5d                   	pop    %ebp
+  80101b:	c3                   	ret
+
+0080101c <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  80101c:	55                   	push   %ebp
+  80101d:	89 e5                	mov    %esp,%ebp
+  80101f:	57                   	push   %edi
+  801020:	56                   	push   %esi
+  801021:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  801022:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801027:	8b 55 08             	mov    0x8(%ebp),%edx
+  80102a:	b8 14 00 00 00       	mov    $0x14,%eax
+  80102f:	89 cb                	mov    %ecx,%ebx
+  801031:	89 cf                	mov    %ecx,%edi
+  801033:	89 ce                	mov    %ecx,%esi
+  801035:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  801037:	5b                   	pop    %ebx
+  801038:	5e                   	pop    %esi
+  801039:	5f                   	pop    %edi
+  80103a:	5d                   	pop    %ebp
+  80103b:	c3                   	ret
+
+0080103c <pgfault>:
+//
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf) {
+  80103c:	55                   	push   %ebp
+  80103d:	89 e5                	mov    %esp,%ebp
+  80103f:	53                   	push   %ebx
+  801040:	83 ec 04             	sub    $0x4,%esp
+  801043:	8b 45 08             	mov    0x8(%ebp),%eax
+    void *addr = (void *) utf->utf_fault_va;
+  801046:	8b 18                	mov    (%eax),%ebx
+    // Hint:
+    //   Use the read-only page table mappings at uvpt
+    //   (see <inc/memlayout.h>).
+
+    // LAB 4: Your code here.
+    if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P) ||
+  801048:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  80104c:	0f 84 95 00 00 00    	je     8010e7 <pgfault+0xab>
+  801052:	89 d8                	mov    %ebx,%eax
+  801054:	c1 e8 16             	shr    $0x16,%eax
+  801057:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80105e:	a8 01                	test   $0x1,%al
+  801060:	0f 84 81 00 00 00    	je     8010e7 <pgfault+0xab>
+        (uvpt[PGNUM(addr)] & (PTE_P | PTE_COW)) != (PTE_P | PTE_COW)) {
+  801066:	89 d8                	mov    %ebx,%eax
+  801068:	c1 e8 0c             	shr    $0xc,%eax
+  80106b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801072:	25 01 08 00 00       	and    $0x801,%eax
+    if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P) ||
+  801077:	3d 01 08 00 00       	cmp    $0x801,%eax
+  80107c:	75 69                	jne    8010e7 <pgfault+0xab>
+    // Hint:
+    //   You should make three system calls.
+
+    // LAB 4: Your code here.
+
+    if (sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W))
+  80107e:	83 ec 04             	sub    $0x4,%esp
+  801081:	6a 07                	push   $0x7
+  801083:	68 00 f0 7f 00       	push   $0x7ff000
+  801088:	6a 00                	push   $0x0
+  80108a:	e8 da fc ff ff       	call   800d69 <sys_page_alloc>
+  80108f:	83 c4 10             	add    $0x10,%esp
+  801092:	85 c0                	test   %eax,%eax
+  801094:	75 65                	jne    8010fb <pgfault+0xbf>
+        panic("sys_page_alloc failed");
+
+    addr = ROUNDDOWN(addr, PGSIZE);
+  801096:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+    memmove(PFTEMP, addr, PGSIZE);
+  80109c:	83 ec 04             	sub    $0x4,%esp
+  80109f:	68 00 10 00 00       	push   $0x1000
+  8010a4:	53                   	push   %ebx
+  8010a5:	68 00 f0 7f 00       	push   $0x7ff000
+  8010aa:	e8 54 fa ff ff       	call   800b03 <memmove>
+
+    if (sys_page_map(0, PFTEMP, 0, addr, PTE_P | PTE_U | PTE_W))
+  8010af:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8010b6:	53                   	push   %ebx
+  8010b7:	6a 00                	push   $0x0
+  8010b9:	68 00 f0 7f 00       	push   $0x7ff000
+  8010be:	6a 00                	push   $0x0
+  8010c0:	e8 e7 fc ff ff       	call   800dac <sys_page_map>
+  8010c5:	83 c4 20             	add    $0x20,%esp
+  8010c8:	85 c0                	test   %eax,%eax
+  8010ca:	75 43                	jne    80110f <pgfault+0xd3>
+        panic("sys_page_map failed");
+    if (sys_page_unmap(0, PFTEMP))
+  8010cc:	83 ec 08             	sub    $0x8,%esp
+  8010cf:	68 00 f0 7f 00       	push   $0x7ff000
+  8010d4:	6a 00                	push   $0x0
+  8010d6:	e8 13 fd ff ff       	call   800dee <sys_page_unmap>
+  8010db:	83 c4 10             	add    $0x10,%esp
+  8010de:	85 c0                	test   %eax,%eax
+  8010e0:	75 41                	jne    801123 <pgfault+0xe7>
+        panic("sys_page_unmap failed");
+
+}
+  8010e2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010e5:	c9                   	leave
+  8010e6:	c3                   	ret
+        panic("pgfault: faulting access invalid");
+  8010e7:	83 ec 04             	sub    $0x4,%esp
+  8010ea:	68 10 2f 80 00       	push   $0x802f10
+  8010ef:	6a 1e                	push   $0x1e
+  8010f1:	68 7c 2f 80 00       	push   $0x802f7c
+  8010f6:	e8 ee f1 ff ff       	call   8002e9 <_panic>
+        panic("sys_page_alloc failed");
+  8010fb:	83 ec 04             	sub    $0x4,%esp
+  8010fe:	68 ef 2f 80 00       	push   $0x802fef
+  801103:	6a 2a                	push   $0x2a
+  801105:	68 7c 2f 80 00       	push   $0x802f7c
+  80110a:	e8 da f1 ff ff       	call   8002e9 <_panic>
+        panic("sys_page_map failed");
+  80110f:	83 ec 04             	sub    $0x4,%esp
+  801112:	68 87 2f 80 00       	push   $0x802f87
+  801117:	6a 30                	push   $0x30
+  801119:	68 7c 2f 80 00       	push   $0x802f7c
+  80111e:	e8 c6 f1 ff ff       	call   8002e9 <_panic>
+        panic("sys_page_unmap failed");
+  801123:	83 ec 04             	sub    $0x4,%esp
+  801126:	68 9b 2f 80 00       	push   $0x802f9b
+  80112b:	6a 32                	push   $0x32
+  80112d:	68 7c 2f 80 00       	push   $0x802f7c
+  801132:	e8 b2 f1 ff ff       	call   8002e9 <_panic>
+
+00801137 <fork>:
+//   Remember to fix "thisenv" in the child process.
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void) {
+  801137:	55                   	push   %ebp
+  801138:	89 e5                	mov    %esp,%ebp
+  80113a:	57                   	push   %edi
+  80113b:	56                   	push   %esi
+  80113c:	53                   	push   %ebx
+  80113d:	83 ec 18             	sub    $0x18,%esp
+    // LAB 4: Your code here.
+    set_pgfault_handler(pgfault);
+  801140:	68 3c 10 80 00       	push   $0x80103c
+  801145:	e8 21 14 00 00       	call   80256b <set_pgfault_handler>
+
+// This must be inlined.  Exercise for reader: why?
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+  envid_t ret;
+  asm volatile("int %2"
+  80114a:	b8 07 00 00 00       	mov    $0x7,%eax
+  80114f:	cd 30                	int    $0x30
+  801151:	89 c6                	mov    %eax,%esi
+
+    envid_t envid = sys_exofork();
+    if (envid < 0)
+  801153:	83 c4 10             	add    $0x10,%esp
+  801156:	85 c0                	test   %eax,%eax
+  801158:	78 2a                	js     801184 <fork+0x4d>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+
+    uintptr_t addr;
+    for (addr = 0; addr < UTOP; addr += PGSIZE) {
+  80115a:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (envid == 0) {
+  80115f:	0f 85 a2 00 00 00    	jne    801207 <fork+0xd0>
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801165:	e8 c1 fb ff ff       	call   800d2b <sys_getenvid>
+  80116a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80116f:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  801172:	c1 e0 04             	shl    $0x4,%eax
+  801175:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80117a:	a3 0c 50 80 00       	mov    %eax,0x80500c
+        return 0;
+  80117f:	e9 6c 01 00 00       	jmp    8012f0 <fork+0x1b9>
+        panic("fork: sys_exofork error: %e", envid);
+  801184:	50                   	push   %eax
+  801185:	68 b1 2f 80 00       	push   $0x802fb1
+  80118a:	6a 6f                	push   $0x6f
+  80118c:	68 7c 2f 80 00       	push   $0x802f7c
+  801191:	e8 53 f1 ff ff       	call   8002e9 <_panic>
+        if ((r = sys_page_map(0, vptr, envid, vptr, uvpt[pn] & PTE_SYSCALL)) < 0)
+  801196:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80119d:	83 ec 0c             	sub    $0xc,%esp
+  8011a0:	25 07 0e 00 00       	and    $0xe07,%eax
+  8011a5:	50                   	push   %eax
+  8011a6:	57                   	push   %edi
+  8011a7:	56                   	push   %esi
+  8011a8:	57                   	push   %edi
+  8011a9:	6a 00                	push   $0x0
+  8011ab:	e8 fc fb ff ff       	call   800dac <sys_page_map>
+  8011b0:	83 c4 20             	add    $0x20,%esp
+  8011b3:	85 c0                	test   %eax,%eax
+  8011b5:	79 3e                	jns    8011f5 <fork+0xbe>
+            panic("duppage :in sys_page_map %e", r);
+  8011b7:	50                   	push   %eax
+  8011b8:	68 cd 2f 80 00       	push   $0x802fcd
+  8011bd:	6a 49                	push   $0x49
+  8011bf:	68 7c 2f 80 00       	push   $0x802f7c
+  8011c4:	e8 20 f1 ff ff       	call   8002e9 <_panic>
+            panic("duppage :in sys_page_map %e", r);
+  8011c9:	50                   	push   %eax
+  8011ca:	68 cd 2f 80 00       	push   $0x802fcd
+  8011cf:	6a 4e                	push   $0x4e
+  8011d1:	68 7c 2f 80 00       	push   $0x802f7c
+  8011d6:	e8 0e f1 ff ff       	call   8002e9 <_panic>
+    } else if ((r = sys_page_map(0, vptr, envid, vptr, PTE_P | PTE_U)) < 0)
+  8011db:	83 ec 0c             	sub    $0xc,%esp
+  8011de:	6a 05                	push   $0x5
+  8011e0:	57                   	push   %edi
+  8011e1:	56                   	push   %esi
+  8011e2:	57                   	push   %edi
+  8011e3:	6a 00                	push   $0x0
+  8011e5:	e8 c2 fb ff ff       	call   800dac <sys_page_map>
+  8011ea:	83 c4 20             	add    $0x20,%esp
+  8011ed:	85 c0                	test   %eax,%eax
+  8011ef:	0f 88 ab 00 00 00    	js     8012a0 <fork+0x169>
+    for (addr = 0; addr < UTOP; addr += PGSIZE) {
+  8011f5:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8011fb:	81 fb 00 00 c0 ee    	cmp    $0xeec00000,%ebx
+  801201:	0f 84 ab 00 00 00    	je     8012b2 <fork+0x17b>
+        if (uvpd[PDX(addr)] & PTE_P && uvpt[PGNUM(addr)] & PTE_P && addr != UXSTACKTOP - PGSIZE) {
+  801207:	89 d8                	mov    %ebx,%eax
+  801209:	c1 e8 16             	shr    $0x16,%eax
+  80120c:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801213:	a8 01                	test   $0x1,%al
+  801215:	74 de                	je     8011f5 <fork+0xbe>
+  801217:	89 d8                	mov    %ebx,%eax
+  801219:	c1 e8 0c             	shr    $0xc,%eax
+  80121c:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801223:	f6 c2 01             	test   $0x1,%dl
+  801226:	74 cd                	je     8011f5 <fork+0xbe>
+  801228:	81 fb 00 f0 bf ee    	cmp    $0xeebff000,%ebx
+  80122e:	74 c5                	je     8011f5 <fork+0xbe>
+    void *vptr = (void *) (pn * PGSIZE);
+  801230:	89 c7                	mov    %eax,%edi
+  801232:	c1 e7 0c             	shl    $0xc,%edi
+    if (uvpt[pn] & PTE_SHARE) {
+  801235:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80123c:	f6 c6 04             	test   $0x4,%dh
+  80123f:	0f 85 51 ff ff ff    	jne    801196 <fork+0x5f>
+    } else if (uvpt[pn] & (PTE_W | PTE_COW)) {
+  801245:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80124c:	a9 02 08 00 00       	test   $0x802,%eax
+  801251:	74 88                	je     8011db <fork+0xa4>
+        if ((r = sys_page_map(0, vptr, envid, vptr, PTE_P | PTE_U | PTE_COW)) < 0)
+  801253:	83 ec 0c             	sub    $0xc,%esp
+  801256:	68 05 08 00 00       	push   $0x805
+  80125b:	57                   	push   %edi
+  80125c:	56                   	push   %esi
+  80125d:	57                   	push   %edi
+  80125e:	6a 00                	push   $0x0
+  801260:	e8 47 fb ff ff       	call   800dac <sys_page_map>
+  801265:	83 c4 20             	add    $0x20,%esp
+  801268:	85 c0                	test   %eax,%eax
+  80126a:	0f 88 59 ff ff ff    	js     8011c9 <fork+0x92>
+        if ((r = sys_page_map(0, vptr, 0, vptr, PTE_P | PTE_U | PTE_COW)) < 0)
+  801270:	83 ec 0c             	sub    $0xc,%esp
+  801273:	68 05 08 00 00       	push   $0x805
+  801278:	57                   	push   %edi
+  801279:	6a 00                	push   $0x0
+  80127b:	57                   	push   %edi
+  80127c:	6a 00                	push   $0x0
+  80127e:	e8 29 fb ff ff       	call   800dac <sys_page_map>
+  801283:	83 c4 20             	add    $0x20,%esp
+  801286:	85 c0                	test   %eax,%eax
+  801288:	0f 89 67 ff ff ff    	jns    8011f5 <fork+0xbe>
+            panic("duppage :in sys_page_map %e", r);
+  80128e:	50                   	push   %eax
+  80128f:	68 cd 2f 80 00       	push   $0x802fcd
+  801294:	6a 50                	push   $0x50
+  801296:	68 7c 2f 80 00       	push   $0x802f7c
+  80129b:	e8 49 f0 ff ff       	call   8002e9 <_panic>
+        panic("duppage :in sys_page_map %e", r);
+  8012a0:	50                   	push   %eax
+  8012a1:	68 cd 2f 80 00       	push   $0x802fcd
+  8012a6:	6a 53                	push   $0x53
+  8012a8:	68 7c 2f 80 00       	push   $0x802f7c
+  8012ad:	e8 37 f0 ff ff       	call   8002e9 <_panic>
+            duppage(envid, PGNUM(addr));
+        }
+    }
+    if (sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W))
+  8012b2:	83 ec 04             	sub    $0x4,%esp
+  8012b5:	6a 07                	push   $0x7
+  8012b7:	68 00 f0 bf ee       	push   $0xeebff000
+  8012bc:	56                   	push   %esi
+  8012bd:	e8 a7 fa ff ff       	call   800d69 <sys_page_alloc>
+  8012c2:	83 c4 10             	add    $0x10,%esp
+  8012c5:	85 c0                	test   %eax,%eax
+  8012c7:	75 31                	jne    8012fa <fork+0x1c3>
+        panic("fork: sys_page_alloc failed");
+    if (sys_env_set_pgfault_upcall(envid, _pgfault_upcall))
+  8012c9:	83 ec 08             	sub    $0x8,%esp
+  8012cc:	68 d6 25 80 00       	push   $0x8025d6
+  8012d1:	56                   	push   %esi
+  8012d2:	e8 dd fb ff ff       	call   800eb4 <sys_env_set_pgfault_upcall>
+  8012d7:	83 c4 10             	add    $0x10,%esp
+  8012da:	85 c0                	test   %eax,%eax
+  8012dc:	75 30                	jne    80130e <fork+0x1d7>
+        panic("fork: sys_env_set_pgfault_upcall failed");
+    if (sys_env_set_status(envid, ENV_RUNNABLE))
+  8012de:	83 ec 08             	sub    $0x8,%esp
+  8012e1:	6a 02                	push   $0x2
+  8012e3:	56                   	push   %esi
+  8012e4:	e8 47 fb ff ff       	call   800e30 <sys_env_set_status>
+  8012e9:	83 c4 10             	add    $0x10,%esp
+  8012ec:	85 c0                	test   %eax,%eax
+  8012ee:	75 32                	jne    801322 <fork+0x1eb>
+        panic("fork: sys_env_set_status failed");
+
+    return envid;
+
+}
+  8012f0:	89 f0                	mov    %esi,%eax
+  8012f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012f5:	5b                   	pop    %ebx
+  8012f6:	5e                   	pop    %esi
+  8012f7:	5f                   	pop    %edi
+  8012f8:	5d                   	pop    %ebp
+  8012f9:	c3                   	ret
+        panic("fork: sys_page_alloc failed");
+  8012fa:	83 ec 04             	sub    $0x4,%esp
+  8012fd:	68 e9 2f 80 00       	push   $0x802fe9
+  801302:	6a 7d                	push   $0x7d
+  801304:	68 7c 2f 80 00       	push   $0x802f7c
+  801309:	e8 db ef ff ff       	call   8002e9 <_panic>
+        panic("fork: sys_env_set_pgfault_upcall failed");
+  80130e:	83 ec 04             	sub    $0x4,%esp
+  801311:	68 34 2f 80 00       	push   $0x802f34
+  801316:	6a 7f                	push   $0x7f
+  801318:	68 7c 2f 80 00       	push   $0x802f7c
+  80131d:	e8 c7 ef ff ff       	call   8002e9 <_panic>
+        panic("fork: sys_env_set_status failed");
+  801322:	83 ec 04             	sub    $0x4,%esp
+  801325:	68 5c 2f 80 00       	push   $0x802f5c
+  80132a:	68 81 00 00 00       	push   $0x81
+  80132f:	68 7c 2f 80 00       	push   $0x802f7c
+  801334:	e8 b0 ef ff ff       	call   8002e9 <_panic>
+
+00801339 <sfork>:
+
+// Challenge!
+int
+sfork(void) {
+  801339:	55                   	push   %ebp
+  80133a:	89 e5                	mov    %esp,%ebp
+  80133c:	83 ec 0c             	sub    $0xc,%esp
+    panic("sfork not implemented");
+  80133f:	68 05 30 80 00       	push   $0x803005
+  801344:	68 8a 00 00 00       	push   $0x8a
+  801349:	68 7c 2f 80 00       	push   $0x802f7c
+  80134e:	e8 96 ef ff ff       	call   8002e9 <_panic>
+
+00801353 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  801353:	55                   	push   %ebp
+  801354:	89 e5                	mov    %esp,%ebp
+  801356:	56                   	push   %esi
+  801357:	53                   	push   %ebx
+  801358:	8b 75 08             	mov    0x8(%ebp),%esi
+  80135b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80135e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  801361:	85 c0                	test   %eax,%eax
+  801363:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801368:	0f 44 c2             	cmove  %edx,%eax
+  80136b:	83 ec 0c             	sub    $0xc,%esp
+  80136e:	50                   	push   %eax
+  80136f:	e8 a5 fb ff ff       	call   800f19 <sys_ipc_recv>
+
+  if (from_env_store)
+  801374:	83 c4 10             	add    $0x10,%esp
+  801377:	85 f6                	test   %esi,%esi
+  801379:	74 17                	je     801392 <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  80137b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801380:	85 c0                	test   %eax,%eax
+  801382:	75 0c                	jne    801390 <ipc_recv+0x3d>
+  801384:	8b 15 0c 50 80 00    	mov    0x80500c,%edx
+  80138a:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  801390:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  801392:	85 db                	test   %ebx,%ebx
+  801394:	74 2b                	je     8013c1 <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  801396:	85 c0                	test   %eax,%eax
+  801398:	74 0d                	je     8013a7 <ipc_recv+0x54>
+  80139a:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  8013a0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013a3:	5b                   	pop    %ebx
+  8013a4:	5e                   	pop    %esi
+  8013a5:	5d                   	pop    %ebp
+  8013a6:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  8013a7:	a1 0c 50 80 00       	mov    0x80500c,%eax
+  8013ac:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8013b2:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  8013b4:	a1 0c 50 80 00       	mov    0x80500c,%eax
+  8013b9:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  8013bf:	eb df                	jmp    8013a0 <ipc_recv+0x4d>
+  8013c1:	85 c0                	test   %eax,%eax
+  8013c3:	75 db                	jne    8013a0 <ipc_recv+0x4d>
+  8013c5:	eb ed                	jmp    8013b4 <ipc_recv+0x61>
+
+008013c7 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  8013c7:	55                   	push   %ebp
+  8013c8:	89 e5                	mov    %esp,%ebp
+  8013ca:	57                   	push   %edi
+  8013cb:	56                   	push   %esi
+  8013cc:	53                   	push   %ebx
+  8013cd:	83 ec 0c             	sub    $0xc,%esp
+  8013d0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8013d3:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8013d6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  8013d9:	85 db                	test   %ebx,%ebx
+  8013db:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8013e0:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  8013e3:	ff 75 14             	push   0x14(%ebp)
+  8013e6:	53                   	push   %ebx
+  8013e7:	56                   	push   %esi
+  8013e8:	57                   	push   %edi
+  8013e9:	e8 08 fb ff ff       	call   800ef6 <sys_ipc_try_send>
+  8013ee:	83 c4 10             	add    $0x10,%esp
+  8013f1:	85 c0                	test   %eax,%eax
+  8013f3:	74 1e                	je     801413 <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  8013f5:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8013f8:	75 07                	jne    801401 <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  8013fa:	e8 4b f9 ff ff       	call   800d4a <sys_yield>
+  8013ff:	eb e2                	jmp    8013e3 <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  801401:	50                   	push   %eax
+  801402:	68 1b 30 80 00       	push   $0x80301b
+  801407:	6a 3c                	push   $0x3c
+  801409:	68 28 30 80 00       	push   $0x803028
+  80140e:	e8 d6 ee ff ff       	call   8002e9 <_panic>
+  }
+
+#endif
+}
+  801413:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801416:	5b                   	pop    %ebx
+  801417:	5e                   	pop    %esi
+  801418:	5f                   	pop    %edi
+  801419:	5d                   	pop    %ebp
+  80141a:	c3                   	ret
+
+0080141b <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  80141b:	55                   	push   %ebp
+  80141c:	89 e5                	mov    %esp,%ebp
+  80141e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  801421:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  801426:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  801429:	c1 e0 04             	shl    $0x4,%eax
+  80142c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801431:	8b 40 50             	mov    0x50(%eax),%eax
+  801434:	39 c8                	cmp    %ecx,%eax
+  801436:	74 12                	je     80144a <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  801438:	83 c2 01             	add    $0x1,%edx
+  80143b:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  801441:	75 e3                	jne    801426 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  801443:	b8 00 00 00 00       	mov    $0x0,%eax
+  801448:	eb 0e                	jmp    801458 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  80144a:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80144d:	c1 e0 04             	shl    $0x4,%eax
+  801450:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801455:	8b 40 48             	mov    0x48(%eax),%eax
+  801458:	5d                   	pop    %ebp
+  801459:	c3                   	ret
+
+0080145a <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80145a:	55                   	push   %ebp
+  80145b:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80145d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801460:	05 00 00 00 30       	add    $0x30000000,%eax
+  801465:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801468:	5d                   	pop    %ebp
+  801469:	c3                   	ret
+
+0080146a <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80146a:	55                   	push   %ebp
+  80146b:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80146d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801470:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801475:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80147a:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80147f:	5d                   	pop    %ebp
+  801480:	c3                   	ret
+
+00801481 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801481:	55                   	push   %ebp
+  801482:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801484:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801489:	eb 02                	jmp    80148d <fd_alloc+0xc>
+  80148b:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80148d:	89 c2                	mov    %eax,%edx
+  80148f:	c1 ea 16             	shr    $0x16,%edx
+  801492:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801499:	f6 c2 01             	test   $0x1,%dl
+  80149c:	74 2b                	je     8014c9 <fd_alloc+0x48>
+  80149e:	89 c2                	mov    %eax,%edx
+  8014a0:	c1 ea 0c             	shr    $0xc,%edx
+  8014a3:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8014aa:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8014b0:	f6 c1 01             	test   $0x1,%cl
+  8014b3:	74 14                	je     8014c9 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8014b5:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8014bb:	75 ce                	jne    80148b <fd_alloc+0xa>
+  8014bd:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8014c2:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8014c7:	eb 05                	jmp    8014ce <fd_alloc+0x4d>
+			return 0;
+  8014c9:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8014ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014d1:	89 02                	mov    %eax,(%edx)
+}
+  8014d3:	89 c8                	mov    %ecx,%eax
+  8014d5:	5d                   	pop    %ebp
+  8014d6:	c3                   	ret
+
+008014d7 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8014d7:	55                   	push   %ebp
+  8014d8:	89 e5                	mov    %esp,%ebp
+  8014da:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8014dd:	83 f8 1f             	cmp    $0x1f,%eax
+  8014e0:	77 30                	ja     801512 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8014e2:	c1 e0 0c             	shl    $0xc,%eax
+  8014e5:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8014ea:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8014f0:	f6 c2 01             	test   $0x1,%dl
+  8014f3:	74 24                	je     801519 <fd_lookup+0x42>
+  8014f5:	89 c2                	mov    %eax,%edx
+  8014f7:	c1 ea 0c             	shr    $0xc,%edx
+  8014fa:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801501:	f6 c2 01             	test   $0x1,%dl
+  801504:	74 1a                	je     801520 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801506:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801509:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80150b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801510:	5d                   	pop    %ebp
+  801511:	c3                   	ret
+		return -E_INVAL;
+  801512:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801517:	eb f7                	jmp    801510 <fd_lookup+0x39>
+		return -E_INVAL;
+  801519:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80151e:	eb f0                	jmp    801510 <fd_lookup+0x39>
+  801520:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801525:	eb e9                	jmp    801510 <fd_lookup+0x39>
+
+00801527 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801527:	55                   	push   %ebp
+  801528:	89 e5                	mov    %esp,%ebp
+  80152a:	53                   	push   %ebx
+  80152b:	83 ec 04             	sub    $0x4,%esp
+  80152e:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801531:	b8 00 00 00 00       	mov    $0x0,%eax
+  801536:	eb 03                	jmp    80153b <dev_lookup+0x14>
+  801538:	83 c0 01             	add    $0x1,%eax
+  80153b:	8b 1c 85 b0 30 80 00 	mov    0x8030b0(,%eax,4),%ebx
+  801542:	85 db                	test   %ebx,%ebx
+  801544:	74 0b                	je     801551 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801546:	39 13                	cmp    %edx,(%ebx)
+  801548:	75 ee                	jne    801538 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  80154a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80154f:	eb 1f                	jmp    801570 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801551:	a1 0c 50 80 00       	mov    0x80500c,%eax
+  801556:	8b 40 48             	mov    0x48(%eax),%eax
+  801559:	83 ec 04             	sub    $0x4,%esp
+  80155c:	52                   	push   %edx
+  80155d:	50                   	push   %eax
+  80155e:	68 34 30 80 00       	push   $0x803034
+  801563:	e8 5c ee ff ff       	call   8003c4 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801568:	83 c4 10             	add    $0x10,%esp
+  80156b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801570:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801573:	89 1a                	mov    %ebx,(%edx)
+}
+  801575:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801578:	c9                   	leave
+  801579:	c3                   	ret
+
+0080157a <fd_close>:
+{
+  80157a:	55                   	push   %ebp
+  80157b:	89 e5                	mov    %esp,%ebp
+  80157d:	57                   	push   %edi
+  80157e:	56                   	push   %esi
+  80157f:	53                   	push   %ebx
+  801580:	83 ec 24             	sub    $0x24,%esp
+  801583:	8b 75 08             	mov    0x8(%ebp),%esi
+  801586:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801589:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80158c:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80158d:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801593:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801596:	50                   	push   %eax
+  801597:	e8 3b ff ff ff       	call   8014d7 <fd_lookup>
+  80159c:	89 c3                	mov    %eax,%ebx
+  80159e:	83 c4 10             	add    $0x10,%esp
+  8015a1:	85 c0                	test   %eax,%eax
+  8015a3:	78 05                	js     8015aa <fd_close+0x30>
+	    || fd != fd2)
+  8015a5:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8015a8:	74 16                	je     8015c0 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8015aa:	89 f8                	mov    %edi,%eax
+  8015ac:	84 c0                	test   %al,%al
+  8015ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015b3:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8015b6:	89 d8                	mov    %ebx,%eax
+  8015b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015bb:	5b                   	pop    %ebx
+  8015bc:	5e                   	pop    %esi
+  8015bd:	5f                   	pop    %edi
+  8015be:	5d                   	pop    %ebp
+  8015bf:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8015c0:	83 ec 08             	sub    $0x8,%esp
+  8015c3:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8015c6:	50                   	push   %eax
+  8015c7:	ff 36                	push   (%esi)
+  8015c9:	e8 59 ff ff ff       	call   801527 <dev_lookup>
+  8015ce:	89 c3                	mov    %eax,%ebx
+  8015d0:	83 c4 10             	add    $0x10,%esp
+  8015d3:	85 c0                	test   %eax,%eax
+  8015d5:	78 1a                	js     8015f1 <fd_close+0x77>
+		if (dev->dev_close)
+  8015d7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8015da:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8015dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8015e2:	85 c0                	test   %eax,%eax
+  8015e4:	74 0b                	je     8015f1 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8015e6:	83 ec 0c             	sub    $0xc,%esp
+  8015e9:	56                   	push   %esi
+  8015ea:	ff d0                	call   *%eax
+  8015ec:	89 c3                	mov    %eax,%ebx
+  8015ee:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8015f1:	83 ec 08             	sub    $0x8,%esp
+  8015f4:	56                   	push   %esi
+  8015f5:	6a 00                	push   $0x0
+  8015f7:	e8 f2 f7 ff ff       	call   800dee <sys_page_unmap>
+	return r;
+  8015fc:	83 c4 10             	add    $0x10,%esp
+  8015ff:	eb b5                	jmp    8015b6 <fd_close+0x3c>
+
+00801601 <close>:
+
+int
+close(int fdnum)
+{
+  801601:	55                   	push   %ebp
+  801602:	89 e5                	mov    %esp,%ebp
+  801604:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801607:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80160a:	50                   	push   %eax
+  80160b:	ff 75 08             	push   0x8(%ebp)
+  80160e:	e8 c4 fe ff ff       	call   8014d7 <fd_lookup>
+  801613:	83 c4 10             	add    $0x10,%esp
+  801616:	85 c0                	test   %eax,%eax
+  801618:	79 02                	jns    80161c <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80161a:	c9                   	leave
+  80161b:	c3                   	ret
+		return fd_close(fd, 1);
+  80161c:	83 ec 08             	sub    $0x8,%esp
+  80161f:	6a 01                	push   $0x1
+  801621:	ff 75 f4             	push   -0xc(%ebp)
+  801624:	e8 51 ff ff ff       	call   80157a <fd_close>
+  801629:	83 c4 10             	add    $0x10,%esp
+  80162c:	eb ec                	jmp    80161a <close+0x19>
+
+0080162e <close_all>:
+
+void
+close_all(void)
+{
+  80162e:	55                   	push   %ebp
+  80162f:	89 e5                	mov    %esp,%ebp
+  801631:	53                   	push   %ebx
+  801632:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801635:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80163a:	83 ec 0c             	sub    $0xc,%esp
+  80163d:	53                   	push   %ebx
+  80163e:	e8 be ff ff ff       	call   801601 <close>
+	for (i = 0; i < MAXFD; i++)
+  801643:	83 c3 01             	add    $0x1,%ebx
+  801646:	83 c4 10             	add    $0x10,%esp
+  801649:	83 fb 20             	cmp    $0x20,%ebx
+  80164c:	75 ec                	jne    80163a <close_all+0xc>
+}
+  80164e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801651:	c9                   	leave
+  801652:	c3                   	ret
+
+00801653 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801653:	55                   	push   %ebp
+  801654:	89 e5                	mov    %esp,%ebp
+  801656:	57                   	push   %edi
+  801657:	56                   	push   %esi
+  801658:	53                   	push   %ebx
+  801659:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80165c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80165f:	50                   	push   %eax
+  801660:	ff 75 08             	push   0x8(%ebp)
+  801663:	e8 6f fe ff ff       	call   8014d7 <fd_lookup>
+  801668:	89 c3                	mov    %eax,%ebx
+  80166a:	83 c4 10             	add    $0x10,%esp
+  80166d:	85 c0                	test   %eax,%eax
+  80166f:	78 7f                	js     8016f0 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801671:	83 ec 0c             	sub    $0xc,%esp
+  801674:	ff 75 0c             	push   0xc(%ebp)
+  801677:	e8 85 ff ff ff       	call   801601 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80167c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80167f:	c1 e6 0c             	shl    $0xc,%esi
+  801682:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801688:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80168b:	89 3c 24             	mov    %edi,(%esp)
+  80168e:	e8 d7 fd ff ff       	call   80146a <fd2data>
+  801693:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801695:	89 34 24             	mov    %esi,(%esp)
+  801698:	e8 cd fd ff ff       	call   80146a <fd2data>
+  80169d:	83 c4 10             	add    $0x10,%esp
+  8016a0:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8016a3:	89 d8                	mov    %ebx,%eax
+  8016a5:	c1 e8 16             	shr    $0x16,%eax
+  8016a8:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8016af:	a8 01                	test   $0x1,%al
+  8016b1:	74 11                	je     8016c4 <dup+0x71>
+  8016b3:	89 d8                	mov    %ebx,%eax
+  8016b5:	c1 e8 0c             	shr    $0xc,%eax
+  8016b8:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8016bf:	f6 c2 01             	test   $0x1,%dl
+  8016c2:	75 36                	jne    8016fa <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8016c4:	89 f8                	mov    %edi,%eax
+  8016c6:	c1 e8 0c             	shr    $0xc,%eax
+  8016c9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8016d0:	83 ec 0c             	sub    $0xc,%esp
+  8016d3:	25 07 0e 00 00       	and    $0xe07,%eax
+  8016d8:	50                   	push   %eax
+  8016d9:	56                   	push   %esi
+  8016da:	6a 00                	push   $0x0
+  8016dc:	57                   	push   %edi
+  8016dd:	6a 00                	push   $0x0
+  8016df:	e8 c8 f6 ff ff       	call   800dac <sys_page_map>
+  8016e4:	89 c3                	mov    %eax,%ebx
+  8016e6:	83 c4 20             	add    $0x20,%esp
+  8016e9:	85 c0                	test   %eax,%eax
+  8016eb:	78 33                	js     801720 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8016ed:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8016f0:	89 d8                	mov    %ebx,%eax
+  8016f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016f5:	5b                   	pop    %ebx
+  8016f6:	5e                   	pop    %esi
+  8016f7:	5f                   	pop    %edi
+  8016f8:	5d                   	pop    %ebp
+  8016f9:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8016fa:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801701:	83 ec 0c             	sub    $0xc,%esp
+  801704:	25 07 0e 00 00       	and    $0xe07,%eax
+  801709:	50                   	push   %eax
+  80170a:	ff 75 d4             	push   -0x2c(%ebp)
+  80170d:	6a 00                	push   $0x0
+  80170f:	53                   	push   %ebx
+  801710:	6a 00                	push   $0x0
+  801712:	e8 95 f6 ff ff       	call   800dac <sys_page_map>
+  801717:	89 c3                	mov    %eax,%ebx
+  801719:	83 c4 20             	add    $0x20,%esp
+  80171c:	85 c0                	test   %eax,%eax
+  80171e:	79 a4                	jns    8016c4 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801720:	83 ec 08             	sub    $0x8,%esp
+  801723:	56                   	push   %esi
+  801724:	6a 00                	push   $0x0
+  801726:	e8 c3 f6 ff ff       	call   800dee <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  80172b:	83 c4 08             	add    $0x8,%esp
+  80172e:	ff 75 d4             	push   -0x2c(%ebp)
+  801731:	6a 00                	push   $0x0
+  801733:	e8 b6 f6 ff ff       	call   800dee <sys_page_unmap>
+	return r;
+  801738:	83 c4 10             	add    $0x10,%esp
+  80173b:	eb b3                	jmp    8016f0 <dup+0x9d>
+
+0080173d <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80173d:	55                   	push   %ebp
+  80173e:	89 e5                	mov    %esp,%ebp
+  801740:	56                   	push   %esi
+  801741:	53                   	push   %ebx
+  801742:	83 ec 18             	sub    $0x18,%esp
+  801745:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801748:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80174b:	50                   	push   %eax
+  80174c:	56                   	push   %esi
+  80174d:	e8 85 fd ff ff       	call   8014d7 <fd_lookup>
+  801752:	83 c4 10             	add    $0x10,%esp
+  801755:	85 c0                	test   %eax,%eax
+  801757:	78 3c                	js     801795 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801759:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80175c:	83 ec 08             	sub    $0x8,%esp
+  80175f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801762:	50                   	push   %eax
+  801763:	ff 33                	push   (%ebx)
+  801765:	e8 bd fd ff ff       	call   801527 <dev_lookup>
+  80176a:	83 c4 10             	add    $0x10,%esp
+  80176d:	85 c0                	test   %eax,%eax
+  80176f:	78 24                	js     801795 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801771:	8b 43 08             	mov    0x8(%ebx),%eax
+  801774:	83 e0 03             	and    $0x3,%eax
+  801777:	83 f8 01             	cmp    $0x1,%eax
+  80177a:	74 20                	je     80179c <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80177c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80177f:	8b 40 08             	mov    0x8(%eax),%eax
+  801782:	85 c0                	test   %eax,%eax
+  801784:	74 37                	je     8017bd <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801786:	83 ec 04             	sub    $0x4,%esp
+  801789:	ff 75 10             	push   0x10(%ebp)
+  80178c:	ff 75 0c             	push   0xc(%ebp)
+  80178f:	53                   	push   %ebx
+  801790:	ff d0                	call   *%eax
+  801792:	83 c4 10             	add    $0x10,%esp
+}
+  801795:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801798:	5b                   	pop    %ebx
+  801799:	5e                   	pop    %esi
+  80179a:	5d                   	pop    %ebp
+  80179b:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80179c:	a1 0c 50 80 00       	mov    0x80500c,%eax
+  8017a1:	8b 40 48             	mov    0x48(%eax),%eax
+  8017a4:	83 ec 04             	sub    $0x4,%esp
+  8017a7:	56                   	push   %esi
+  8017a8:	50                   	push   %eax
+  8017a9:	68 75 30 80 00       	push   $0x803075
+  8017ae:	e8 11 ec ff ff       	call   8003c4 <cprintf>
+		return -E_INVAL;
+  8017b3:	83 c4 10             	add    $0x10,%esp
+  8017b6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017bb:	eb d8                	jmp    801795 <read+0x58>
+		return -E_NOT_SUPP;
+  8017bd:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017c2:	eb d1                	jmp    801795 <read+0x58>
+
+008017c4 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8017c4:	55                   	push   %ebp
+  8017c5:	89 e5                	mov    %esp,%ebp
+  8017c7:	57                   	push   %edi
+  8017c8:	56                   	push   %esi
+  8017c9:	53                   	push   %ebx
+  8017ca:	83 ec 0c             	sub    $0xc,%esp
+  8017cd:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8017d0:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8017d3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017d8:	eb 02                	jmp    8017dc <readn+0x18>
+  8017da:	01 c3                	add    %eax,%ebx
+  8017dc:	39 f3                	cmp    %esi,%ebx
+  8017de:	73 21                	jae    801801 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8017e0:	83 ec 04             	sub    $0x4,%esp
+  8017e3:	89 f0                	mov    %esi,%eax
+  8017e5:	29 d8                	sub    %ebx,%eax
+  8017e7:	50                   	push   %eax
+  8017e8:	89 d8                	mov    %ebx,%eax
+  8017ea:	03 45 0c             	add    0xc(%ebp),%eax
+  8017ed:	50                   	push   %eax
+  8017ee:	57                   	push   %edi
+  8017ef:	e8 49 ff ff ff       	call   80173d <read>
+		if (m < 0)
+  8017f4:	83 c4 10             	add    $0x10,%esp
+  8017f7:	85 c0                	test   %eax,%eax
+  8017f9:	78 04                	js     8017ff <readn+0x3b>
+			return m;
+		if (m == 0)
+  8017fb:	75 dd                	jne    8017da <readn+0x16>
+  8017fd:	eb 02                	jmp    801801 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8017ff:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801801:	89 d8                	mov    %ebx,%eax
+  801803:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801806:	5b                   	pop    %ebx
+  801807:	5e                   	pop    %esi
+  801808:	5f                   	pop    %edi
+  801809:	5d                   	pop    %ebp
+  80180a:	c3                   	ret
+
+0080180b <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80180b:	55                   	push   %ebp
+  80180c:	89 e5                	mov    %esp,%ebp
+  80180e:	56                   	push   %esi
+  80180f:	53                   	push   %ebx
+  801810:	83 ec 18             	sub    $0x18,%esp
+  801813:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801816:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801819:	50                   	push   %eax
+  80181a:	53                   	push   %ebx
+  80181b:	e8 b7 fc ff ff       	call   8014d7 <fd_lookup>
+  801820:	83 c4 10             	add    $0x10,%esp
+  801823:	85 c0                	test   %eax,%eax
+  801825:	78 37                	js     80185e <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801827:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80182a:	83 ec 08             	sub    $0x8,%esp
+  80182d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801830:	50                   	push   %eax
+  801831:	ff 36                	push   (%esi)
+  801833:	e8 ef fc ff ff       	call   801527 <dev_lookup>
+  801838:	83 c4 10             	add    $0x10,%esp
+  80183b:	85 c0                	test   %eax,%eax
+  80183d:	78 1f                	js     80185e <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80183f:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801843:	74 20                	je     801865 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801845:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801848:	8b 40 0c             	mov    0xc(%eax),%eax
+  80184b:	85 c0                	test   %eax,%eax
+  80184d:	74 37                	je     801886 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80184f:	83 ec 04             	sub    $0x4,%esp
+  801852:	ff 75 10             	push   0x10(%ebp)
+  801855:	ff 75 0c             	push   0xc(%ebp)
+  801858:	56                   	push   %esi
+  801859:	ff d0                	call   *%eax
+  80185b:	83 c4 10             	add    $0x10,%esp
+}
+  80185e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801861:	5b                   	pop    %ebx
+  801862:	5e                   	pop    %esi
+  801863:	5d                   	pop    %ebp
+  801864:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801865:	a1 0c 50 80 00       	mov    0x80500c,%eax
+  80186a:	8b 40 48             	mov    0x48(%eax),%eax
+  80186d:	83 ec 04             	sub    $0x4,%esp
+  801870:	53                   	push   %ebx
+  801871:	50                   	push   %eax
+  801872:	68 91 30 80 00       	push   $0x803091
+  801877:	e8 48 eb ff ff       	call   8003c4 <cprintf>
+		return -E_INVAL;
+  80187c:	83 c4 10             	add    $0x10,%esp
+  80187f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801884:	eb d8                	jmp    80185e <write+0x53>
+		return -E_NOT_SUPP;
+  801886:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80188b:	eb d1                	jmp    80185e <write+0x53>
+
+0080188d <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80188d:	55                   	push   %ebp
+  80188e:	89 e5                	mov    %esp,%ebp
+  801890:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801893:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801896:	50                   	push   %eax
+  801897:	ff 75 08             	push   0x8(%ebp)
+  80189a:	e8 38 fc ff ff       	call   8014d7 <fd_lookup>
+  80189f:	83 c4 10             	add    $0x10,%esp
+  8018a2:	85 c0                	test   %eax,%eax
+  8018a4:	78 0e                	js     8018b4 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8018a6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8018a9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018ac:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8018af:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018b4:	c9                   	leave
+  8018b5:	c3                   	ret
+
+008018b6 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8018b6:	55                   	push   %ebp
+  8018b7:	89 e5                	mov    %esp,%ebp
+  8018b9:	56                   	push   %esi
+  8018ba:	53                   	push   %ebx
+  8018bb:	83 ec 18             	sub    $0x18,%esp
+  8018be:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018c1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018c4:	50                   	push   %eax
+  8018c5:	53                   	push   %ebx
+  8018c6:	e8 0c fc ff ff       	call   8014d7 <fd_lookup>
+  8018cb:	83 c4 10             	add    $0x10,%esp
+  8018ce:	85 c0                	test   %eax,%eax
+  8018d0:	78 34                	js     801906 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8018d2:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8018d5:	83 ec 08             	sub    $0x8,%esp
+  8018d8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018db:	50                   	push   %eax
+  8018dc:	ff 36                	push   (%esi)
+  8018de:	e8 44 fc ff ff       	call   801527 <dev_lookup>
+  8018e3:	83 c4 10             	add    $0x10,%esp
+  8018e6:	85 c0                	test   %eax,%eax
+  8018e8:	78 1c                	js     801906 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8018ea:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8018ee:	74 1d                	je     80190d <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8018f0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018f3:	8b 40 18             	mov    0x18(%eax),%eax
+  8018f6:	85 c0                	test   %eax,%eax
+  8018f8:	74 34                	je     80192e <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8018fa:	83 ec 08             	sub    $0x8,%esp
+  8018fd:	ff 75 0c             	push   0xc(%ebp)
+  801900:	56                   	push   %esi
+  801901:	ff d0                	call   *%eax
+  801903:	83 c4 10             	add    $0x10,%esp
+}
+  801906:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801909:	5b                   	pop    %ebx
+  80190a:	5e                   	pop    %esi
+  80190b:	5d                   	pop    %ebp
+  80190c:	c3                   	ret
+			thisenv->env_id, fdnum);
+  80190d:	a1 0c 50 80 00       	mov    0x80500c,%eax
+  801912:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801915:	83 ec 04             	sub    $0x4,%esp
+  801918:	53                   	push   %ebx
+  801919:	50                   	push   %eax
+  80191a:	68 54 30 80 00       	push   $0x803054
+  80191f:	e8 a0 ea ff ff       	call   8003c4 <cprintf>
+		return -E_INVAL;
+  801924:	83 c4 10             	add    $0x10,%esp
+  801927:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80192c:	eb d8                	jmp    801906 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  80192e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801933:	eb d1                	jmp    801906 <ftruncate+0x50>
+
+00801935 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801935:	55                   	push   %ebp
+  801936:	89 e5                	mov    %esp,%ebp
+  801938:	56                   	push   %esi
+  801939:	53                   	push   %ebx
+  80193a:	83 ec 18             	sub    $0x18,%esp
+  80193d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801940:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801943:	50                   	push   %eax
+  801944:	ff 75 08             	push   0x8(%ebp)
+  801947:	e8 8b fb ff ff       	call   8014d7 <fd_lookup>
+  80194c:	83 c4 10             	add    $0x10,%esp
+  80194f:	85 c0                	test   %eax,%eax
+  801951:	78 49                	js     80199c <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801953:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801956:	83 ec 08             	sub    $0x8,%esp
+  801959:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80195c:	50                   	push   %eax
+  80195d:	ff 36                	push   (%esi)
+  80195f:	e8 c3 fb ff ff       	call   801527 <dev_lookup>
+  801964:	83 c4 10             	add    $0x10,%esp
+  801967:	85 c0                	test   %eax,%eax
+  801969:	78 31                	js     80199c <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  80196b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80196e:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801972:	74 2f                	je     8019a3 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801974:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801977:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80197e:	00 00 00 
+	stat->st_isdir = 0;
+  801981:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801988:	00 00 00 
+	stat->st_dev = dev;
+  80198b:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801991:	83 ec 08             	sub    $0x8,%esp
+  801994:	53                   	push   %ebx
+  801995:	56                   	push   %esi
+  801996:	ff 50 14             	call   *0x14(%eax)
+  801999:	83 c4 10             	add    $0x10,%esp
+}
+  80199c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80199f:	5b                   	pop    %ebx
+  8019a0:	5e                   	pop    %esi
+  8019a1:	5d                   	pop    %ebp
+  8019a2:	c3                   	ret
+		return -E_NOT_SUPP;
+  8019a3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8019a8:	eb f2                	jmp    80199c <fstat+0x67>
+
+008019aa <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8019aa:	55                   	push   %ebp
+  8019ab:	89 e5                	mov    %esp,%ebp
+  8019ad:	56                   	push   %esi
+  8019ae:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8019af:	83 ec 08             	sub    $0x8,%esp
+  8019b2:	6a 00                	push   $0x0
+  8019b4:	ff 75 08             	push   0x8(%ebp)
+  8019b7:	e8 e4 01 00 00       	call   801ba0 <open>
+  8019bc:	89 c3                	mov    %eax,%ebx
+  8019be:	83 c4 10             	add    $0x10,%esp
+  8019c1:	85 c0                	test   %eax,%eax
+  8019c3:	78 1b                	js     8019e0 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8019c5:	83 ec 08             	sub    $0x8,%esp
+  8019c8:	ff 75 0c             	push   0xc(%ebp)
+  8019cb:	50                   	push   %eax
+  8019cc:	e8 64 ff ff ff       	call   801935 <fstat>
+  8019d1:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8019d3:	89 1c 24             	mov    %ebx,(%esp)
+  8019d6:	e8 26 fc ff ff       	call   801601 <close>
+	return r;
+  8019db:	83 c4 10             	add    $0x10,%esp
+  8019de:	89 f3                	mov    %esi,%ebx
+}
+  8019e0:	89 d8                	mov    %ebx,%eax
+  8019e2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019e5:	5b                   	pop    %ebx
+  8019e6:	5e                   	pop    %esi
+  8019e7:	5d                   	pop    %ebp
+  8019e8:	c3                   	ret
+
+008019e9 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  8019e9:	55                   	push   %ebp
+  8019ea:	89 e5                	mov    %esp,%ebp
+  8019ec:	56                   	push   %esi
+  8019ed:	53                   	push   %ebx
+  8019ee:	89 c6                	mov    %eax,%esi
+  8019f0:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  8019f2:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  8019f9:	74 27                	je     801a22 <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8019fb:	6a 07                	push   $0x7
+  8019fd:	68 00 60 80 00       	push   $0x806000
+  801a02:	56                   	push   %esi
+  801a03:	ff 35 04 50 80 00    	push   0x805004
+  801a09:	e8 b9 f9 ff ff       	call   8013c7 <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  801a0e:	83 c4 0c             	add    $0xc,%esp
+  801a11:	6a 00                	push   $0x0
+  801a13:	53                   	push   %ebx
+  801a14:	6a 00                	push   $0x0
+  801a16:	e8 38 f9 ff ff       	call   801353 <ipc_recv>
+}
+  801a1b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a1e:	5b                   	pop    %ebx
+  801a1f:	5e                   	pop    %esi
+  801a20:	5d                   	pop    %ebp
+  801a21:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  801a22:	83 ec 0c             	sub    $0xc,%esp
+  801a25:	6a 01                	push   $0x1
+  801a27:	e8 ef f9 ff ff       	call   80141b <ipc_find_env>
+  801a2c:	a3 04 50 80 00       	mov    %eax,0x805004
+  801a31:	83 c4 10             	add    $0x10,%esp
+  801a34:	eb c5                	jmp    8019fb <fsipc+0x12>
+
+00801a36 <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801a36:	55                   	push   %ebp
+  801a37:	89 e5                	mov    %esp,%ebp
+  801a39:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801a3c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a3f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a42:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.set_size.req_size = newsize;
+  801a47:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a4a:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801a4f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a54:	b8 02 00 00 00       	mov    $0x2,%eax
+  801a59:	e8 8b ff ff ff       	call   8019e9 <fsipc>
+}
+  801a5e:	c9                   	leave
+  801a5f:	c3                   	ret
+
+00801a60 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801a60:	55                   	push   %ebp
+  801a61:	89 e5                	mov    %esp,%ebp
+  801a63:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801a66:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a69:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a6c:	a3 00 60 80 00       	mov    %eax,0x806000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801a71:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a76:	b8 06 00 00 00       	mov    $0x6,%eax
+  801a7b:	e8 69 ff ff ff       	call   8019e9 <fsipc>
+}
+  801a80:	c9                   	leave
+  801a81:	c3                   	ret
+
+00801a82 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801a82:	55                   	push   %ebp
+  801a83:	89 e5                	mov    %esp,%ebp
+  801a85:	53                   	push   %ebx
+  801a86:	83 ec 04             	sub    $0x4,%esp
+  801a89:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801a8c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a8f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a92:	a3 00 60 80 00       	mov    %eax,0x806000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801a97:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a9c:	b8 05 00 00 00       	mov    $0x5,%eax
+  801aa1:	e8 43 ff ff ff       	call   8019e9 <fsipc>
+  801aa6:	85 c0                	test   %eax,%eax
+  801aa8:	78 2c                	js     801ad6 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801aaa:	83 ec 08             	sub    $0x8,%esp
+  801aad:	68 00 60 80 00       	push   $0x806000
+  801ab2:	53                   	push   %ebx
+  801ab3:	e8 c5 ee ff ff       	call   80097d <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801ab8:	a1 80 60 80 00       	mov    0x806080,%eax
+  801abd:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801ac3:	a1 84 60 80 00       	mov    0x806084,%eax
+  801ac8:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801ace:	83 c4 10             	add    $0x10,%esp
+  801ad1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ad6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ad9:	c9                   	leave
+  801ada:	c3                   	ret
+
+00801adb <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801adb:	55                   	push   %ebp
+  801adc:	89 e5                	mov    %esp,%ebp
+  801ade:	83 ec 0c             	sub    $0xc,%esp
+  801ae1:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801ae4:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ae7:	8b 52 0c             	mov    0xc(%edx),%edx
+  801aea:	89 15 00 60 80 00    	mov    %edx,0x806000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801af0:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801af5:	39 d0                	cmp    %edx,%eax
+  801af7:	0f 47 c2             	cmova  %edx,%eax
+  801afa:	a3 04 60 80 00       	mov    %eax,0x806004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  801aff:	50                   	push   %eax
+  801b00:	ff 75 0c             	push   0xc(%ebp)
+  801b03:	68 08 60 80 00       	push   $0x806008
+  801b08:	e8 f6 ef ff ff       	call   800b03 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801b0d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b12:	b8 04 00 00 00       	mov    $0x4,%eax
+  801b17:	e8 cd fe ff ff       	call   8019e9 <fsipc>
+}
+  801b1c:	c9                   	leave
+  801b1d:	c3                   	ret
+
+00801b1e <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801b1e:	55                   	push   %ebp
+  801b1f:	89 e5                	mov    %esp,%ebp
+  801b21:	56                   	push   %esi
+  801b22:	53                   	push   %ebx
+  801b23:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801b26:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b29:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b2c:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read.req_n = n;
+  801b31:	89 35 04 60 80 00    	mov    %esi,0x806004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801b37:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b3c:	b8 03 00 00 00       	mov    $0x3,%eax
+  801b41:	e8 a3 fe ff ff       	call   8019e9 <fsipc>
+  801b46:	89 c3                	mov    %eax,%ebx
+  801b48:	85 c0                	test   %eax,%eax
+  801b4a:	78 1f                	js     801b6b <devfile_read+0x4d>
+  assert(r <= n);
+  801b4c:	39 c6                	cmp    %eax,%esi
+  801b4e:	72 24                	jb     801b74 <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  801b50:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801b55:	7f 33                	jg     801b8a <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801b57:	83 ec 04             	sub    $0x4,%esp
+  801b5a:	50                   	push   %eax
+  801b5b:	68 00 60 80 00       	push   $0x806000
+  801b60:	ff 75 0c             	push   0xc(%ebp)
+  801b63:	e8 9b ef ff ff       	call   800b03 <memmove>
+  return r;
+  801b68:	83 c4 10             	add    $0x10,%esp
+}
+  801b6b:	89 d8                	mov    %ebx,%eax
+  801b6d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b70:	5b                   	pop    %ebx
+  801b71:	5e                   	pop    %esi
+  801b72:	5d                   	pop    %ebp
+  801b73:	c3                   	ret
+  assert(r <= n);
+  801b74:	68 c4 30 80 00       	push   $0x8030c4
+  801b79:	68 cb 30 80 00       	push   $0x8030cb
+  801b7e:	6a 78                	push   $0x78
+  801b80:	68 e0 30 80 00       	push   $0x8030e0
+  801b85:	e8 5f e7 ff ff       	call   8002e9 <_panic>
+  assert(r <= PGSIZE);
+  801b8a:	68 eb 30 80 00       	push   $0x8030eb
+  801b8f:	68 cb 30 80 00       	push   $0x8030cb
+  801b94:	6a 79                	push   $0x79
+  801b96:	68 e0 30 80 00       	push   $0x8030e0
+  801b9b:	e8 49 e7 ff ff       	call   8002e9 <_panic>
+
+00801ba0 <open>:
+open(const char *path, int mode) {
+  801ba0:	55                   	push   %ebp
+  801ba1:	89 e5                	mov    %esp,%ebp
+  801ba3:	56                   	push   %esi
+  801ba4:	53                   	push   %ebx
+  801ba5:	83 ec 1c             	sub    $0x1c,%esp
+  801ba8:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801bab:	56                   	push   %esi
+  801bac:	e8 91 ed ff ff       	call   800942 <strlen>
+  801bb1:	83 c4 10             	add    $0x10,%esp
+  801bb4:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801bb9:	7f 6c                	jg     801c27 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801bbb:	83 ec 0c             	sub    $0xc,%esp
+  801bbe:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bc1:	50                   	push   %eax
+  801bc2:	e8 ba f8 ff ff       	call   801481 <fd_alloc>
+  801bc7:	89 c3                	mov    %eax,%ebx
+  801bc9:	83 c4 10             	add    $0x10,%esp
+  801bcc:	85 c0                	test   %eax,%eax
+  801bce:	78 3c                	js     801c0c <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801bd0:	83 ec 08             	sub    $0x8,%esp
+  801bd3:	56                   	push   %esi
+  801bd4:	68 00 60 80 00       	push   $0x806000
+  801bd9:	e8 9f ed ff ff       	call   80097d <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801bde:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801be1:	a3 00 64 80 00       	mov    %eax,0x806400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801be6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801be9:	b8 01 00 00 00       	mov    $0x1,%eax
+  801bee:	e8 f6 fd ff ff       	call   8019e9 <fsipc>
+  801bf3:	89 c3                	mov    %eax,%ebx
+  801bf5:	83 c4 10             	add    $0x10,%esp
+  801bf8:	85 c0                	test   %eax,%eax
+  801bfa:	78 19                	js     801c15 <open+0x75>
+  return fd2num(fd);
+  801bfc:	83 ec 0c             	sub    $0xc,%esp
+  801bff:	ff 75 f4             	push   -0xc(%ebp)
+  801c02:	e8 53 f8 ff ff       	call   80145a <fd2num>
+  801c07:	89 c3                	mov    %eax,%ebx
+  801c09:	83 c4 10             	add    $0x10,%esp
+}
+  801c0c:	89 d8                	mov    %ebx,%eax
+  801c0e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c11:	5b                   	pop    %ebx
+  801c12:	5e                   	pop    %esi
+  801c13:	5d                   	pop    %ebp
+  801c14:	c3                   	ret
+    fd_close(fd, 0);
+  801c15:	83 ec 08             	sub    $0x8,%esp
+  801c18:	6a 00                	push   $0x0
+  801c1a:	ff 75 f4             	push   -0xc(%ebp)
+  801c1d:	e8 58 f9 ff ff       	call   80157a <fd_close>
+    return r;
+  801c22:	83 c4 10             	add    $0x10,%esp
+  801c25:	eb e5                	jmp    801c0c <open+0x6c>
+    return -E_BAD_PATH;
+  801c27:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801c2c:	eb de                	jmp    801c0c <open+0x6c>
+
+00801c2e <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  801c2e:	55                   	push   %ebp
+  801c2f:	89 e5                	mov    %esp,%ebp
+  801c31:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801c34:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c39:	b8 08 00 00 00       	mov    $0x8,%eax
+  801c3e:	e8 a6 fd ff ff       	call   8019e9 <fsipc>
+}
+  801c43:	c9                   	leave
+  801c44:	c3                   	ret
+
+00801c45 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801c45:	55                   	push   %ebp
+  801c46:	89 e5                	mov    %esp,%ebp
+  801c48:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801c4b:	68 f7 30 80 00       	push   $0x8030f7
+  801c50:	ff 75 0c             	push   0xc(%ebp)
+  801c53:	e8 25 ed ff ff       	call   80097d <strcpy>
+	return 0;
+}
+  801c58:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c5d:	c9                   	leave
+  801c5e:	c3                   	ret
+
+00801c5f <devsock_close>:
+{
+  801c5f:	55                   	push   %ebp
+  801c60:	89 e5                	mov    %esp,%ebp
+  801c62:	53                   	push   %ebx
+  801c63:	83 ec 10             	sub    $0x10,%esp
+  801c66:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801c69:	53                   	push   %ebx
+  801c6a:	e8 8b 09 00 00       	call   8025fa <pageref>
+  801c6f:	89 c2                	mov    %eax,%edx
+  801c71:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801c74:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801c79:	83 fa 01             	cmp    $0x1,%edx
+  801c7c:	74 05                	je     801c83 <devsock_close+0x24>
+}
+  801c7e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c81:	c9                   	leave
+  801c82:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801c83:	83 ec 0c             	sub    $0xc,%esp
+  801c86:	ff 73 0c             	push   0xc(%ebx)
+  801c89:	e8 b7 02 00 00       	call   801f45 <nsipc_close>
+  801c8e:	83 c4 10             	add    $0x10,%esp
+  801c91:	eb eb                	jmp    801c7e <devsock_close+0x1f>
+
+00801c93 <devsock_write>:
+{
+  801c93:	55                   	push   %ebp
+  801c94:	89 e5                	mov    %esp,%ebp
+  801c96:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801c99:	6a 00                	push   $0x0
+  801c9b:	ff 75 10             	push   0x10(%ebp)
+  801c9e:	ff 75 0c             	push   0xc(%ebp)
+  801ca1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ca4:	ff 70 0c             	push   0xc(%eax)
+  801ca7:	e8 79 03 00 00       	call   802025 <nsipc_send>
+}
+  801cac:	c9                   	leave
+  801cad:	c3                   	ret
+
+00801cae <devsock_read>:
+{
+  801cae:	55                   	push   %ebp
+  801caf:	89 e5                	mov    %esp,%ebp
+  801cb1:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801cb4:	6a 00                	push   $0x0
+  801cb6:	ff 75 10             	push   0x10(%ebp)
+  801cb9:	ff 75 0c             	push   0xc(%ebp)
+  801cbc:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cbf:	ff 70 0c             	push   0xc(%eax)
+  801cc2:	e8 ef 02 00 00       	call   801fb6 <nsipc_recv>
+}
+  801cc7:	c9                   	leave
+  801cc8:	c3                   	ret
+
+00801cc9 <fd2sockid>:
+{
+  801cc9:	55                   	push   %ebp
+  801cca:	89 e5                	mov    %esp,%ebp
+  801ccc:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801ccf:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801cd2:	52                   	push   %edx
+  801cd3:	50                   	push   %eax
+  801cd4:	e8 fe f7 ff ff       	call   8014d7 <fd_lookup>
+  801cd9:	83 c4 10             	add    $0x10,%esp
+  801cdc:	85 c0                	test   %eax,%eax
+  801cde:	78 10                	js     801cf0 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801ce0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ce3:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  801ce9:	39 08                	cmp    %ecx,(%eax)
+  801ceb:	75 05                	jne    801cf2 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801ced:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801cf0:	c9                   	leave
+  801cf1:	c3                   	ret
+		return -E_NOT_SUPP;
+  801cf2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801cf7:	eb f7                	jmp    801cf0 <fd2sockid+0x27>
+
+00801cf9 <alloc_sockfd>:
+{
+  801cf9:	55                   	push   %ebp
+  801cfa:	89 e5                	mov    %esp,%ebp
+  801cfc:	56                   	push   %esi
+  801cfd:	53                   	push   %ebx
+  801cfe:	83 ec 1c             	sub    $0x1c,%esp
+  801d01:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801d03:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d06:	50                   	push   %eax
+  801d07:	e8 75 f7 ff ff       	call   801481 <fd_alloc>
+  801d0c:	89 c3                	mov    %eax,%ebx
+  801d0e:	83 c4 10             	add    $0x10,%esp
+  801d11:	85 c0                	test   %eax,%eax
+  801d13:	78 43                	js     801d58 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801d15:	83 ec 04             	sub    $0x4,%esp
+  801d18:	68 07 04 00 00       	push   $0x407
+  801d1d:	ff 75 f4             	push   -0xc(%ebp)
+  801d20:	6a 00                	push   $0x0
+  801d22:	e8 42 f0 ff ff       	call   800d69 <sys_page_alloc>
+  801d27:	89 c3                	mov    %eax,%ebx
+  801d29:	83 c4 10             	add    $0x10,%esp
+  801d2c:	85 c0                	test   %eax,%eax
+  801d2e:	78 28                	js     801d58 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801d30:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d33:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801d39:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801d3b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d3e:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801d45:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801d48:	83 ec 0c             	sub    $0xc,%esp
+  801d4b:	50                   	push   %eax
+  801d4c:	e8 09 f7 ff ff       	call   80145a <fd2num>
+  801d51:	89 c3                	mov    %eax,%ebx
+  801d53:	83 c4 10             	add    $0x10,%esp
+  801d56:	eb 0c                	jmp    801d64 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801d58:	83 ec 0c             	sub    $0xc,%esp
+  801d5b:	56                   	push   %esi
+  801d5c:	e8 e4 01 00 00       	call   801f45 <nsipc_close>
+		return r;
+  801d61:	83 c4 10             	add    $0x10,%esp
+}
+  801d64:	89 d8                	mov    %ebx,%eax
+  801d66:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d69:	5b                   	pop    %ebx
+  801d6a:	5e                   	pop    %esi
+  801d6b:	5d                   	pop    %ebp
+  801d6c:	c3                   	ret
+
+00801d6d <accept>:
+{
+  801d6d:	55                   	push   %ebp
+  801d6e:	89 e5                	mov    %esp,%ebp
+  801d70:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d73:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d76:	e8 4e ff ff ff       	call   801cc9 <fd2sockid>
+  801d7b:	85 c0                	test   %eax,%eax
+  801d7d:	78 1b                	js     801d9a <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801d7f:	83 ec 04             	sub    $0x4,%esp
+  801d82:	ff 75 10             	push   0x10(%ebp)
+  801d85:	ff 75 0c             	push   0xc(%ebp)
+  801d88:	50                   	push   %eax
+  801d89:	e8 0e 01 00 00       	call   801e9c <nsipc_accept>
+  801d8e:	83 c4 10             	add    $0x10,%esp
+  801d91:	85 c0                	test   %eax,%eax
+  801d93:	78 05                	js     801d9a <accept+0x2d>
+	return alloc_sockfd(r);
+  801d95:	e8 5f ff ff ff       	call   801cf9 <alloc_sockfd>
+}
+  801d9a:	c9                   	leave
+  801d9b:	c3                   	ret
+
+00801d9c <bind>:
+{
+  801d9c:	55                   	push   %ebp
+  801d9d:	89 e5                	mov    %esp,%ebp
+  801d9f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801da2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801da5:	e8 1f ff ff ff       	call   801cc9 <fd2sockid>
+  801daa:	85 c0                	test   %eax,%eax
+  801dac:	78 12                	js     801dc0 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801dae:	83 ec 04             	sub    $0x4,%esp
+  801db1:	ff 75 10             	push   0x10(%ebp)
+  801db4:	ff 75 0c             	push   0xc(%ebp)
+  801db7:	50                   	push   %eax
+  801db8:	e8 31 01 00 00       	call   801eee <nsipc_bind>
+  801dbd:	83 c4 10             	add    $0x10,%esp
+}
+  801dc0:	c9                   	leave
+  801dc1:	c3                   	ret
+
+00801dc2 <shutdown>:
+{
+  801dc2:	55                   	push   %ebp
+  801dc3:	89 e5                	mov    %esp,%ebp
+  801dc5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801dc8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dcb:	e8 f9 fe ff ff       	call   801cc9 <fd2sockid>
+  801dd0:	85 c0                	test   %eax,%eax
+  801dd2:	78 0f                	js     801de3 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801dd4:	83 ec 08             	sub    $0x8,%esp
+  801dd7:	ff 75 0c             	push   0xc(%ebp)
+  801dda:	50                   	push   %eax
+  801ddb:	e8 43 01 00 00       	call   801f23 <nsipc_shutdown>
+  801de0:	83 c4 10             	add    $0x10,%esp
+}
+  801de3:	c9                   	leave
+  801de4:	c3                   	ret
+
+00801de5 <connect>:
+{
+  801de5:	55                   	push   %ebp
+  801de6:	89 e5                	mov    %esp,%ebp
+  801de8:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801deb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dee:	e8 d6 fe ff ff       	call   801cc9 <fd2sockid>
+  801df3:	85 c0                	test   %eax,%eax
+  801df5:	78 12                	js     801e09 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801df7:	83 ec 04             	sub    $0x4,%esp
+  801dfa:	ff 75 10             	push   0x10(%ebp)
+  801dfd:	ff 75 0c             	push   0xc(%ebp)
+  801e00:	50                   	push   %eax
+  801e01:	e8 59 01 00 00       	call   801f5f <nsipc_connect>
+  801e06:	83 c4 10             	add    $0x10,%esp
+}
+  801e09:	c9                   	leave
+  801e0a:	c3                   	ret
+
+00801e0b <listen>:
+{
+  801e0b:	55                   	push   %ebp
+  801e0c:	89 e5                	mov    %esp,%ebp
+  801e0e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e11:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e14:	e8 b0 fe ff ff       	call   801cc9 <fd2sockid>
+  801e19:	85 c0                	test   %eax,%eax
+  801e1b:	78 0f                	js     801e2c <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801e1d:	83 ec 08             	sub    $0x8,%esp
+  801e20:	ff 75 0c             	push   0xc(%ebp)
+  801e23:	50                   	push   %eax
+  801e24:	e8 6b 01 00 00       	call   801f94 <nsipc_listen>
+  801e29:	83 c4 10             	add    $0x10,%esp
+}
+  801e2c:	c9                   	leave
+  801e2d:	c3                   	ret
+
+00801e2e <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801e2e:	55                   	push   %ebp
+  801e2f:	89 e5                	mov    %esp,%ebp
+  801e31:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801e34:	ff 75 10             	push   0x10(%ebp)
+  801e37:	ff 75 0c             	push   0xc(%ebp)
+  801e3a:	ff 75 08             	push   0x8(%ebp)
+  801e3d:	e8 41 02 00 00       	call   802083 <nsipc_socket>
+  801e42:	83 c4 10             	add    $0x10,%esp
+  801e45:	85 c0                	test   %eax,%eax
+  801e47:	78 05                	js     801e4e <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801e49:	e8 ab fe ff ff       	call   801cf9 <alloc_sockfd>
+}
+  801e4e:	c9                   	leave
+  801e4f:	c3                   	ret
+
+00801e50 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801e50:	55                   	push   %ebp
+  801e51:	89 e5                	mov    %esp,%ebp
+  801e53:	53                   	push   %ebx
+  801e54:	83 ec 04             	sub    $0x4,%esp
+  801e57:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801e59:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  801e60:	74 26                	je     801e88 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801e62:	6a 07                	push   $0x7
+  801e64:	68 00 70 80 00       	push   $0x807000
+  801e69:	53                   	push   %ebx
+  801e6a:	ff 35 08 50 80 00    	push   0x805008
+  801e70:	e8 52 f5 ff ff       	call   8013c7 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801e75:	83 c4 0c             	add    $0xc,%esp
+  801e78:	6a 00                	push   $0x0
+  801e7a:	6a 00                	push   $0x0
+  801e7c:	6a 00                	push   $0x0
+  801e7e:	e8 d0 f4 ff ff       	call   801353 <ipc_recv>
+}
+  801e83:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e86:	c9                   	leave
+  801e87:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801e88:	83 ec 0c             	sub    $0xc,%esp
+  801e8b:	6a 02                	push   $0x2
+  801e8d:	e8 89 f5 ff ff       	call   80141b <ipc_find_env>
+  801e92:	a3 08 50 80 00       	mov    %eax,0x805008
+  801e97:	83 c4 10             	add    $0x10,%esp
+  801e9a:	eb c6                	jmp    801e62 <nsipc+0x12>
+
+00801e9c <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801e9c:	55                   	push   %ebp
+  801e9d:	89 e5                	mov    %esp,%ebp
+  801e9f:	56                   	push   %esi
+  801ea0:	53                   	push   %ebx
+  801ea1:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801ea4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ea7:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801eac:	8b 06                	mov    (%esi),%eax
+  801eae:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801eb3:	b8 01 00 00 00       	mov    $0x1,%eax
+  801eb8:	e8 93 ff ff ff       	call   801e50 <nsipc>
+  801ebd:	89 c3                	mov    %eax,%ebx
+  801ebf:	85 c0                	test   %eax,%eax
+  801ec1:	79 09                	jns    801ecc <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801ec3:	89 d8                	mov    %ebx,%eax
+  801ec5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ec8:	5b                   	pop    %ebx
+  801ec9:	5e                   	pop    %esi
+  801eca:	5d                   	pop    %ebp
+  801ecb:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801ecc:	83 ec 04             	sub    $0x4,%esp
+  801ecf:	ff 35 10 70 80 00    	push   0x807010
+  801ed5:	68 00 70 80 00       	push   $0x807000
+  801eda:	ff 75 0c             	push   0xc(%ebp)
+  801edd:	e8 21 ec ff ff       	call   800b03 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801ee2:	a1 10 70 80 00       	mov    0x807010,%eax
+  801ee7:	89 06                	mov    %eax,(%esi)
+  801ee9:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801eec:	eb d5                	jmp    801ec3 <nsipc_accept+0x27>
+
+00801eee <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801eee:	55                   	push   %ebp
+  801eef:	89 e5                	mov    %esp,%ebp
+  801ef1:	53                   	push   %ebx
+  801ef2:	83 ec 08             	sub    $0x8,%esp
+  801ef5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801ef8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801efb:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801f00:	53                   	push   %ebx
+  801f01:	ff 75 0c             	push   0xc(%ebp)
+  801f04:	68 04 70 80 00       	push   $0x807004
+  801f09:	e8 f5 eb ff ff       	call   800b03 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801f0e:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  801f14:	b8 02 00 00 00       	mov    $0x2,%eax
+  801f19:	e8 32 ff ff ff       	call   801e50 <nsipc>
+}
+  801f1e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f21:	c9                   	leave
+  801f22:	c3                   	ret
+
+00801f23 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801f23:	55                   	push   %ebp
+  801f24:	89 e5                	mov    %esp,%ebp
+  801f26:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801f29:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f2c:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  801f31:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f34:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  801f39:	b8 03 00 00 00       	mov    $0x3,%eax
+  801f3e:	e8 0d ff ff ff       	call   801e50 <nsipc>
+}
+  801f43:	c9                   	leave
+  801f44:	c3                   	ret
+
+00801f45 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801f45:	55                   	push   %ebp
+  801f46:	89 e5                	mov    %esp,%ebp
+  801f48:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801f4b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f4e:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  801f53:	b8 04 00 00 00       	mov    $0x4,%eax
+  801f58:	e8 f3 fe ff ff       	call   801e50 <nsipc>
+}
+  801f5d:	c9                   	leave
+  801f5e:	c3                   	ret
+
+00801f5f <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801f5f:	55                   	push   %ebp
+  801f60:	89 e5                	mov    %esp,%ebp
+  801f62:	53                   	push   %ebx
+  801f63:	83 ec 08             	sub    $0x8,%esp
+  801f66:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801f69:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f6c:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801f71:	53                   	push   %ebx
+  801f72:	ff 75 0c             	push   0xc(%ebp)
+  801f75:	68 04 70 80 00       	push   $0x807004
+  801f7a:	e8 84 eb ff ff       	call   800b03 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801f7f:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  801f85:	b8 05 00 00 00       	mov    $0x5,%eax
+  801f8a:	e8 c1 fe ff ff       	call   801e50 <nsipc>
+}
+  801f8f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f92:	c9                   	leave
+  801f93:	c3                   	ret
+
+00801f94 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801f94:	55                   	push   %ebp
+  801f95:	89 e5                	mov    %esp,%ebp
+  801f97:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801f9a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f9d:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  801fa2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fa5:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  801faa:	b8 06 00 00 00       	mov    $0x6,%eax
+  801faf:	e8 9c fe ff ff       	call   801e50 <nsipc>
+}
+  801fb4:	c9                   	leave
+  801fb5:	c3                   	ret
+
+00801fb6 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801fb6:	55                   	push   %ebp
+  801fb7:	89 e5                	mov    %esp,%ebp
+  801fb9:	56                   	push   %esi
+  801fba:	53                   	push   %ebx
+  801fbb:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801fbe:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fc1:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  801fc6:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  801fcc:	8b 45 14             	mov    0x14(%ebp),%eax
+  801fcf:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801fd4:	b8 07 00 00 00       	mov    $0x7,%eax
+  801fd9:	e8 72 fe ff ff       	call   801e50 <nsipc>
+  801fde:	89 c3                	mov    %eax,%ebx
+  801fe0:	85 c0                	test   %eax,%eax
+  801fe2:	78 22                	js     802006 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801fe4:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801fe9:	39 c6                	cmp    %eax,%esi
+  801feb:	0f 4e c6             	cmovle %esi,%eax
+  801fee:	39 c3                	cmp    %eax,%ebx
+  801ff0:	7f 1d                	jg     80200f <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801ff2:	83 ec 04             	sub    $0x4,%esp
+  801ff5:	53                   	push   %ebx
+  801ff6:	68 00 70 80 00       	push   $0x807000
+  801ffb:	ff 75 0c             	push   0xc(%ebp)
+  801ffe:	e8 00 eb ff ff       	call   800b03 <memmove>
+  802003:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802006:	89 d8                	mov    %ebx,%eax
+  802008:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80200b:	5b                   	pop    %ebx
+  80200c:	5e                   	pop    %esi
+  80200d:	5d                   	pop    %ebp
+  80200e:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  80200f:	68 03 31 80 00       	push   $0x803103
+  802014:	68 cb 30 80 00       	push   $0x8030cb
+  802019:	6a 62                	push   $0x62
+  80201b:	68 18 31 80 00       	push   $0x803118
+  802020:	e8 c4 e2 ff ff       	call   8002e9 <_panic>
+
+00802025 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802025:	55                   	push   %ebp
+  802026:	89 e5                	mov    %esp,%ebp
+  802028:	53                   	push   %ebx
+  802029:	83 ec 04             	sub    $0x4,%esp
+  80202c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  80202f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802032:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  802037:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80203d:	7f 2e                	jg     80206d <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  80203f:	83 ec 04             	sub    $0x4,%esp
+  802042:	53                   	push   %ebx
+  802043:	ff 75 0c             	push   0xc(%ebp)
+  802046:	68 0c 70 80 00       	push   $0x80700c
+  80204b:	e8 b3 ea ff ff       	call   800b03 <memmove>
+	nsipcbuf.send.req_size = size;
+  802050:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  802056:	8b 45 14             	mov    0x14(%ebp),%eax
+  802059:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  80205e:	b8 08 00 00 00       	mov    $0x8,%eax
+  802063:	e8 e8 fd ff ff       	call   801e50 <nsipc>
+}
+  802068:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80206b:	c9                   	leave
+  80206c:	c3                   	ret
+	assert(size < 1600);
+  80206d:	68 24 31 80 00       	push   $0x803124
+  802072:	68 cb 30 80 00       	push   $0x8030cb
+  802077:	6a 6d                	push   $0x6d
+  802079:	68 18 31 80 00       	push   $0x803118
+  80207e:	e8 66 e2 ff ff       	call   8002e9 <_panic>
+
+00802083 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802083:	55                   	push   %ebp
+  802084:	89 e5                	mov    %esp,%ebp
+  802086:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802089:	8b 45 08             	mov    0x8(%ebp),%eax
+  80208c:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  802091:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802094:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  802099:	8b 45 10             	mov    0x10(%ebp),%eax
+  80209c:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  8020a1:	b8 09 00 00 00       	mov    $0x9,%eax
+  8020a6:	e8 a5 fd ff ff       	call   801e50 <nsipc>
+}
+  8020ab:	c9                   	leave
+  8020ac:	c3                   	ret
+
+008020ad <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8020ad:	55                   	push   %ebp
+  8020ae:	89 e5                	mov    %esp,%ebp
+  8020b0:	56                   	push   %esi
+  8020b1:	53                   	push   %ebx
+  8020b2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8020b5:	83 ec 0c             	sub    $0xc,%esp
+  8020b8:	ff 75 08             	push   0x8(%ebp)
+  8020bb:	e8 aa f3 ff ff       	call   80146a <fd2data>
+  8020c0:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8020c2:	83 c4 08             	add    $0x8,%esp
+  8020c5:	68 30 31 80 00       	push   $0x803130
+  8020ca:	53                   	push   %ebx
+  8020cb:	e8 ad e8 ff ff       	call   80097d <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8020d0:	8b 46 04             	mov    0x4(%esi),%eax
+  8020d3:	2b 06                	sub    (%esi),%eax
+  8020d5:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8020db:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8020e2:	00 00 00 
+	stat->st_dev = &devpipe;
+  8020e5:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  8020ec:	40 80 00 
+	return 0;
+}
+  8020ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020f4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020f7:	5b                   	pop    %ebx
+  8020f8:	5e                   	pop    %esi
+  8020f9:	5d                   	pop    %ebp
+  8020fa:	c3                   	ret
+
+008020fb <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8020fb:	55                   	push   %ebp
+  8020fc:	89 e5                	mov    %esp,%ebp
+  8020fe:	53                   	push   %ebx
+  8020ff:	83 ec 0c             	sub    $0xc,%esp
+  802102:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802105:	53                   	push   %ebx
+  802106:	6a 00                	push   $0x0
+  802108:	e8 e1 ec ff ff       	call   800dee <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  80210d:	89 1c 24             	mov    %ebx,(%esp)
+  802110:	e8 55 f3 ff ff       	call   80146a <fd2data>
+  802115:	83 c4 08             	add    $0x8,%esp
+  802118:	50                   	push   %eax
+  802119:	6a 00                	push   $0x0
+  80211b:	e8 ce ec ff ff       	call   800dee <sys_page_unmap>
+}
+  802120:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802123:	c9                   	leave
+  802124:	c3                   	ret
+
+00802125 <_pipeisclosed>:
+{
+  802125:	55                   	push   %ebp
+  802126:	89 e5                	mov    %esp,%ebp
+  802128:	57                   	push   %edi
+  802129:	56                   	push   %esi
+  80212a:	53                   	push   %ebx
+  80212b:	83 ec 1c             	sub    $0x1c,%esp
+  80212e:	89 c7                	mov    %eax,%edi
+  802130:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  802132:	a1 0c 50 80 00       	mov    0x80500c,%eax
+  802137:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  80213a:	83 ec 0c             	sub    $0xc,%esp
+  80213d:	57                   	push   %edi
+  80213e:	e8 b7 04 00 00       	call   8025fa <pageref>
+  802143:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802146:	89 34 24             	mov    %esi,(%esp)
+  802149:	e8 ac 04 00 00       	call   8025fa <pageref>
+		nn = thisenv->env_runs;
+  80214e:	8b 15 0c 50 80 00    	mov    0x80500c,%edx
+  802154:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  802157:	83 c4 10             	add    $0x10,%esp
+  80215a:	39 cb                	cmp    %ecx,%ebx
+  80215c:	74 1b                	je     802179 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  80215e:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802161:	75 cf                	jne    802132 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802163:	8b 42 58             	mov    0x58(%edx),%eax
+  802166:	6a 01                	push   $0x1
+  802168:	50                   	push   %eax
+  802169:	53                   	push   %ebx
+  80216a:	68 37 31 80 00       	push   $0x803137
+  80216f:	e8 50 e2 ff ff       	call   8003c4 <cprintf>
+  802174:	83 c4 10             	add    $0x10,%esp
+  802177:	eb b9                	jmp    802132 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802179:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80217c:	0f 94 c0             	sete   %al
+  80217f:	0f b6 c0             	movzbl %al,%eax
+}
+  802182:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802185:	5b                   	pop    %ebx
+  802186:	5e                   	pop    %esi
+  802187:	5f                   	pop    %edi
+  802188:	5d                   	pop    %ebp
+  802189:	c3                   	ret
+
+0080218a <devpipe_write>:
+{
+  80218a:	55                   	push   %ebp
+  80218b:	89 e5                	mov    %esp,%ebp
+  80218d:	57                   	push   %edi
+  80218e:	56                   	push   %esi
+  80218f:	53                   	push   %ebx
+  802190:	83 ec 28             	sub    $0x28,%esp
+  802193:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802196:	56                   	push   %esi
+  802197:	e8 ce f2 ff ff       	call   80146a <fd2data>
+  80219c:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80219e:	83 c4 10             	add    $0x10,%esp
+  8021a1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021a6:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8021a9:	75 09                	jne    8021b4 <devpipe_write+0x2a>
+	return i;
+  8021ab:	89 f8                	mov    %edi,%eax
+  8021ad:	eb 23                	jmp    8021d2 <devpipe_write+0x48>
+			sys_yield();
+  8021af:	e8 96 eb ff ff       	call   800d4a <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8021b4:	8b 43 04             	mov    0x4(%ebx),%eax
+  8021b7:	8b 0b                	mov    (%ebx),%ecx
+  8021b9:	8d 51 20             	lea    0x20(%ecx),%edx
+  8021bc:	39 d0                	cmp    %edx,%eax
+  8021be:	72 1a                	jb     8021da <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8021c0:	89 da                	mov    %ebx,%edx
+  8021c2:	89 f0                	mov    %esi,%eax
+  8021c4:	e8 5c ff ff ff       	call   802125 <_pipeisclosed>
+  8021c9:	85 c0                	test   %eax,%eax
+  8021cb:	74 e2                	je     8021af <devpipe_write+0x25>
+				return 0;
+  8021cd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021d5:	5b                   	pop    %ebx
+  8021d6:	5e                   	pop    %esi
+  8021d7:	5f                   	pop    %edi
+  8021d8:	5d                   	pop    %ebp
+  8021d9:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8021da:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8021dd:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8021e1:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8021e4:	89 c2                	mov    %eax,%edx
+  8021e6:	c1 fa 1f             	sar    $0x1f,%edx
+  8021e9:	89 d1                	mov    %edx,%ecx
+  8021eb:	c1 e9 1b             	shr    $0x1b,%ecx
+  8021ee:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8021f1:	83 e2 1f             	and    $0x1f,%edx
+  8021f4:	29 ca                	sub    %ecx,%edx
+  8021f6:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8021fa:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8021fe:	83 c0 01             	add    $0x1,%eax
+  802201:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802204:	83 c7 01             	add    $0x1,%edi
+  802207:	eb 9d                	jmp    8021a6 <devpipe_write+0x1c>
+
+00802209 <devpipe_read>:
+{
+  802209:	55                   	push   %ebp
+  80220a:	89 e5                	mov    %esp,%ebp
+  80220c:	57                   	push   %edi
+  80220d:	56                   	push   %esi
+  80220e:	53                   	push   %ebx
+  80220f:	83 ec 18             	sub    $0x18,%esp
+  802212:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802215:	57                   	push   %edi
+  802216:	e8 4f f2 ff ff       	call   80146a <fd2data>
+  80221b:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80221d:	83 c4 10             	add    $0x10,%esp
+  802220:	be 00 00 00 00       	mov    $0x0,%esi
+  802225:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802228:	75 13                	jne    80223d <devpipe_read+0x34>
+	return i;
+  80222a:	89 f0                	mov    %esi,%eax
+  80222c:	eb 02                	jmp    802230 <devpipe_read+0x27>
+				return i;
+  80222e:	89 f0                	mov    %esi,%eax
+}
+  802230:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802233:	5b                   	pop    %ebx
+  802234:	5e                   	pop    %esi
+  802235:	5f                   	pop    %edi
+  802236:	5d                   	pop    %ebp
+  802237:	c3                   	ret
+			sys_yield();
+  802238:	e8 0d eb ff ff       	call   800d4a <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  80223d:	8b 03                	mov    (%ebx),%eax
+  80223f:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802242:	75 18                	jne    80225c <devpipe_read+0x53>
+			if (i > 0)
+  802244:	85 f6                	test   %esi,%esi
+  802246:	75 e6                	jne    80222e <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802248:	89 da                	mov    %ebx,%edx
+  80224a:	89 f8                	mov    %edi,%eax
+  80224c:	e8 d4 fe ff ff       	call   802125 <_pipeisclosed>
+  802251:	85 c0                	test   %eax,%eax
+  802253:	74 e3                	je     802238 <devpipe_read+0x2f>
+				return 0;
+  802255:	b8 00 00 00 00       	mov    $0x0,%eax
+  80225a:	eb d4                	jmp    802230 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80225c:	99                   	cltd
+  80225d:	c1 ea 1b             	shr    $0x1b,%edx
+  802260:	01 d0                	add    %edx,%eax
+  802262:	83 e0 1f             	and    $0x1f,%eax
+  802265:	29 d0                	sub    %edx,%eax
+  802267:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  80226c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80226f:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802272:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802275:	83 c6 01             	add    $0x1,%esi
+  802278:	eb ab                	jmp    802225 <devpipe_read+0x1c>
+
+0080227a <pipe>:
+{
+  80227a:	55                   	push   %ebp
+  80227b:	89 e5                	mov    %esp,%ebp
+  80227d:	56                   	push   %esi
+  80227e:	53                   	push   %ebx
+  80227f:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802282:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802285:	50                   	push   %eax
+  802286:	e8 f6 f1 ff ff       	call   801481 <fd_alloc>
+  80228b:	89 c3                	mov    %eax,%ebx
+  80228d:	83 c4 10             	add    $0x10,%esp
+  802290:	85 c0                	test   %eax,%eax
+  802292:	0f 88 23 01 00 00    	js     8023bb <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802298:	83 ec 04             	sub    $0x4,%esp
+  80229b:	68 07 04 00 00       	push   $0x407
+  8022a0:	ff 75 f4             	push   -0xc(%ebp)
+  8022a3:	6a 00                	push   $0x0
+  8022a5:	e8 bf ea ff ff       	call   800d69 <sys_page_alloc>
+  8022aa:	89 c3                	mov    %eax,%ebx
+  8022ac:	83 c4 10             	add    $0x10,%esp
+  8022af:	85 c0                	test   %eax,%eax
+  8022b1:	0f 88 04 01 00 00    	js     8023bb <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8022b7:	83 ec 0c             	sub    $0xc,%esp
+  8022ba:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8022bd:	50                   	push   %eax
+  8022be:	e8 be f1 ff ff       	call   801481 <fd_alloc>
+  8022c3:	89 c3                	mov    %eax,%ebx
+  8022c5:	83 c4 10             	add    $0x10,%esp
+  8022c8:	85 c0                	test   %eax,%eax
+  8022ca:	0f 88 db 00 00 00    	js     8023ab <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8022d0:	83 ec 04             	sub    $0x4,%esp
+  8022d3:	68 07 04 00 00       	push   $0x407
+  8022d8:	ff 75 f0             	push   -0x10(%ebp)
+  8022db:	6a 00                	push   $0x0
+  8022dd:	e8 87 ea ff ff       	call   800d69 <sys_page_alloc>
+  8022e2:	89 c3                	mov    %eax,%ebx
+  8022e4:	83 c4 10             	add    $0x10,%esp
+  8022e7:	85 c0                	test   %eax,%eax
+  8022e9:	0f 88 bc 00 00 00    	js     8023ab <pipe+0x131>
+	va = fd2data(fd0);
+  8022ef:	83 ec 0c             	sub    $0xc,%esp
+  8022f2:	ff 75 f4             	push   -0xc(%ebp)
+  8022f5:	e8 70 f1 ff ff       	call   80146a <fd2data>
+  8022fa:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8022fc:	83 c4 0c             	add    $0xc,%esp
+  8022ff:	68 07 04 00 00       	push   $0x407
+  802304:	50                   	push   %eax
+  802305:	6a 00                	push   $0x0
+  802307:	e8 5d ea ff ff       	call   800d69 <sys_page_alloc>
+  80230c:	89 c3                	mov    %eax,%ebx
+  80230e:	83 c4 10             	add    $0x10,%esp
+  802311:	85 c0                	test   %eax,%eax
+  802313:	0f 88 82 00 00 00    	js     80239b <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802319:	83 ec 0c             	sub    $0xc,%esp
+  80231c:	ff 75 f0             	push   -0x10(%ebp)
+  80231f:	e8 46 f1 ff ff       	call   80146a <fd2data>
+  802324:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80232b:	50                   	push   %eax
+  80232c:	6a 00                	push   $0x0
+  80232e:	56                   	push   %esi
+  80232f:	6a 00                	push   $0x0
+  802331:	e8 76 ea ff ff       	call   800dac <sys_page_map>
+  802336:	89 c3                	mov    %eax,%ebx
+  802338:	83 c4 20             	add    $0x20,%esp
+  80233b:	85 c0                	test   %eax,%eax
+  80233d:	78 4e                	js     80238d <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80233f:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  802344:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802347:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802349:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80234c:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802353:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802356:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802358:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80235b:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802362:	83 ec 0c             	sub    $0xc,%esp
+  802365:	ff 75 f4             	push   -0xc(%ebp)
+  802368:	e8 ed f0 ff ff       	call   80145a <fd2num>
+  80236d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802370:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802372:	83 c4 04             	add    $0x4,%esp
+  802375:	ff 75 f0             	push   -0x10(%ebp)
+  802378:	e8 dd f0 ff ff       	call   80145a <fd2num>
+  80237d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802380:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802383:	83 c4 10             	add    $0x10,%esp
+  802386:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80238b:	eb 2e                	jmp    8023bb <pipe+0x141>
+	sys_page_unmap(0, va);
+  80238d:	83 ec 08             	sub    $0x8,%esp
+  802390:	56                   	push   %esi
+  802391:	6a 00                	push   $0x0
+  802393:	e8 56 ea ff ff       	call   800dee <sys_page_unmap>
+  802398:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80239b:	83 ec 08             	sub    $0x8,%esp
+  80239e:	ff 75 f0             	push   -0x10(%ebp)
+  8023a1:	6a 00                	push   $0x0
+  8023a3:	e8 46 ea ff ff       	call   800dee <sys_page_unmap>
+  8023a8:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8023ab:	83 ec 08             	sub    $0x8,%esp
+  8023ae:	ff 75 f4             	push   -0xc(%ebp)
+  8023b1:	6a 00                	push   $0x0
+  8023b3:	e8 36 ea ff ff       	call   800dee <sys_page_unmap>
+  8023b8:	83 c4 10             	add    $0x10,%esp
+}
+  8023bb:	89 d8                	mov    %ebx,%eax
+  8023bd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023c0:	5b                   	pop    %ebx
+  8023c1:	5e                   	pop    %esi
+  8023c2:	5d                   	pop    %ebp
+  8023c3:	c3                   	ret
+
+008023c4 <pipeisclosed>:
+{
+  8023c4:	55                   	push   %ebp
+  8023c5:	89 e5                	mov    %esp,%ebp
+  8023c7:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8023ca:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023cd:	50                   	push   %eax
+  8023ce:	ff 75 08             	push   0x8(%ebp)
+  8023d1:	e8 01 f1 ff ff       	call   8014d7 <fd_lookup>
+  8023d6:	83 c4 10             	add    $0x10,%esp
+  8023d9:	85 c0                	test   %eax,%eax
+  8023db:	78 18                	js     8023f5 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8023dd:	83 ec 0c             	sub    $0xc,%esp
+  8023e0:	ff 75 f4             	push   -0xc(%ebp)
+  8023e3:	e8 82 f0 ff ff       	call   80146a <fd2data>
+  8023e8:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8023ea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023ed:	e8 33 fd ff ff       	call   802125 <_pipeisclosed>
+  8023f2:	83 c4 10             	add    $0x10,%esp
+}
+  8023f5:	c9                   	leave
+  8023f6:	c3                   	ret
+
+008023f7 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8023f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023fc:	c3                   	ret
+
+008023fd <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8023fd:	55                   	push   %ebp
+  8023fe:	89 e5                	mov    %esp,%ebp
+  802400:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802403:	68 4f 31 80 00       	push   $0x80314f
+  802408:	ff 75 0c             	push   0xc(%ebp)
+  80240b:	e8 6d e5 ff ff       	call   80097d <strcpy>
+	return 0;
+}
+  802410:	b8 00 00 00 00       	mov    $0x0,%eax
+  802415:	c9                   	leave
+  802416:	c3                   	ret
+
+00802417 <devcons_write>:
+{
+  802417:	55                   	push   %ebp
+  802418:	89 e5                	mov    %esp,%ebp
+  80241a:	57                   	push   %edi
+  80241b:	56                   	push   %esi
+  80241c:	53                   	push   %ebx
+  80241d:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802423:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802428:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80242e:	eb 2e                	jmp    80245e <devcons_write+0x47>
+		m = n - tot;
+  802430:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802433:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802435:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80243a:	39 c3                	cmp    %eax,%ebx
+  80243c:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80243f:	83 ec 04             	sub    $0x4,%esp
+  802442:	53                   	push   %ebx
+  802443:	89 f0                	mov    %esi,%eax
+  802445:	03 45 0c             	add    0xc(%ebp),%eax
+  802448:	50                   	push   %eax
+  802449:	57                   	push   %edi
+  80244a:	e8 b4 e6 ff ff       	call   800b03 <memmove>
+		sys_cputs(buf, m);
+  80244f:	83 c4 08             	add    $0x8,%esp
+  802452:	53                   	push   %ebx
+  802453:	57                   	push   %edi
+  802454:	e8 54 e8 ff ff       	call   800cad <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802459:	01 de                	add    %ebx,%esi
+  80245b:	83 c4 10             	add    $0x10,%esp
+  80245e:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802461:	72 cd                	jb     802430 <devcons_write+0x19>
+}
+  802463:	89 f0                	mov    %esi,%eax
+  802465:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802468:	5b                   	pop    %ebx
+  802469:	5e                   	pop    %esi
+  80246a:	5f                   	pop    %edi
+  80246b:	5d                   	pop    %ebp
+  80246c:	c3                   	ret
+
+0080246d <devcons_read>:
+{
+  80246d:	55                   	push   %ebp
+  80246e:	89 e5                	mov    %esp,%ebp
+  802470:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802473:	b8 00 00 00 00       	mov    $0x0,%eax
+  802478:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80247c:	75 07                	jne    802485 <devcons_read+0x18>
+  80247e:	eb 1f                	jmp    80249f <devcons_read+0x32>
+		sys_yield();
+  802480:	e8 c5 e8 ff ff       	call   800d4a <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802485:	e8 41 e8 ff ff       	call   800ccb <sys_cgetc>
+  80248a:	85 c0                	test   %eax,%eax
+  80248c:	74 f2                	je     802480 <devcons_read+0x13>
+	if (c < 0)
+  80248e:	78 0f                	js     80249f <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802490:	83 f8 04             	cmp    $0x4,%eax
+  802493:	74 0c                	je     8024a1 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802495:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802498:	88 02                	mov    %al,(%edx)
+	return 1;
+  80249a:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80249f:	c9                   	leave
+  8024a0:	c3                   	ret
+		return 0;
+  8024a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024a6:	eb f7                	jmp    80249f <devcons_read+0x32>
+
+008024a8 <cputchar>:
+{
+  8024a8:	55                   	push   %ebp
+  8024a9:	89 e5                	mov    %esp,%ebp
+  8024ab:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8024ae:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024b1:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8024b4:	6a 01                	push   $0x1
+  8024b6:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8024b9:	50                   	push   %eax
+  8024ba:	e8 ee e7 ff ff       	call   800cad <sys_cputs>
+}
+  8024bf:	83 c4 10             	add    $0x10,%esp
+  8024c2:	c9                   	leave
+  8024c3:	c3                   	ret
+
+008024c4 <getchar>:
+{
+  8024c4:	55                   	push   %ebp
+  8024c5:	89 e5                	mov    %esp,%ebp
+  8024c7:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8024ca:	6a 01                	push   $0x1
+  8024cc:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8024cf:	50                   	push   %eax
+  8024d0:	6a 00                	push   $0x0
+  8024d2:	e8 66 f2 ff ff       	call   80173d <read>
+	if (r < 0)
+  8024d7:	83 c4 10             	add    $0x10,%esp
+  8024da:	85 c0                	test   %eax,%eax
+  8024dc:	78 06                	js     8024e4 <getchar+0x20>
+	if (r < 1)
+  8024de:	74 06                	je     8024e6 <getchar+0x22>
+	return c;
+  8024e0:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8024e4:	c9                   	leave
+  8024e5:	c3                   	ret
+		return -E_EOF;
+  8024e6:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8024eb:	eb f7                	jmp    8024e4 <getchar+0x20>
+
+008024ed <iscons>:
+{
+  8024ed:	55                   	push   %ebp
+  8024ee:	89 e5                	mov    %esp,%ebp
+  8024f0:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8024f3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024f6:	50                   	push   %eax
+  8024f7:	ff 75 08             	push   0x8(%ebp)
+  8024fa:	e8 d8 ef ff ff       	call   8014d7 <fd_lookup>
+  8024ff:	83 c4 10             	add    $0x10,%esp
+  802502:	85 c0                	test   %eax,%eax
+  802504:	78 11                	js     802517 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802506:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802509:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  80250f:	39 10                	cmp    %edx,(%eax)
+  802511:	0f 94 c0             	sete   %al
+  802514:	0f b6 c0             	movzbl %al,%eax
+}
+  802517:	c9                   	leave
+  802518:	c3                   	ret
+
+00802519 <opencons>:
+{
+  802519:	55                   	push   %ebp
+  80251a:	89 e5                	mov    %esp,%ebp
+  80251c:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80251f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802522:	50                   	push   %eax
+  802523:	e8 59 ef ff ff       	call   801481 <fd_alloc>
+  802528:	83 c4 10             	add    $0x10,%esp
+  80252b:	85 c0                	test   %eax,%eax
+  80252d:	78 3a                	js     802569 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80252f:	83 ec 04             	sub    $0x4,%esp
+  802532:	68 07 04 00 00       	push   $0x407
+  802537:	ff 75 f4             	push   -0xc(%ebp)
+  80253a:	6a 00                	push   $0x0
+  80253c:	e8 28 e8 ff ff       	call   800d69 <sys_page_alloc>
+  802541:	83 c4 10             	add    $0x10,%esp
+  802544:	85 c0                	test   %eax,%eax
+  802546:	78 21                	js     802569 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802548:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80254b:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802551:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802553:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802556:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80255d:	83 ec 0c             	sub    $0xc,%esp
+  802560:	50                   	push   %eax
+  802561:	e8 f4 ee ff ff       	call   80145a <fd2num>
+  802566:	83 c4 10             	add    $0x10,%esp
+}
+  802569:	c9                   	leave
+  80256a:	c3                   	ret
+
+0080256b <set_pgfault_handler>:
+// allocate an exception stack (one page of memory with its top
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf)) {
+  80256b:	55                   	push   %ebp
+  80256c:	89 e5                	mov    %esp,%ebp
+  80256e:	83 ec 08             	sub    $0x8,%esp
+  int r;
+
+  if (_pgfault_handler == 0) {
+  802571:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  802578:	74 0a                	je     802584 <set_pgfault_handler+0x19>
+    if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)))
+      panic(" set_pgfault_handler sys_env_set_pgfault_upcall panic: %e\n", r);
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  80257a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80257d:	a3 00 80 80 00       	mov    %eax,0x808000
+
+
+}
+  802582:	c9                   	leave
+  802583:	c3                   	ret
+    if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)))
+  802584:	83 ec 04             	sub    $0x4,%esp
+  802587:	6a 07                	push   $0x7
+  802589:	68 00 f0 bf ee       	push   $0xeebff000
+  80258e:	6a 00                	push   $0x0
+  802590:	e8 d4 e7 ff ff       	call   800d69 <sys_page_alloc>
+  802595:	83 c4 10             	add    $0x10,%esp
+  802598:	85 c0                	test   %eax,%eax
+  80259a:	75 28                	jne    8025c4 <set_pgfault_handler+0x59>
+    if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)))
+  80259c:	83 ec 08             	sub    $0x8,%esp
+  80259f:	68 d6 25 80 00       	push   $0x8025d6
+  8025a4:	6a 00                	push   $0x0
+  8025a6:	e8 09 e9 ff ff       	call   800eb4 <sys_env_set_pgfault_upcall>
+  8025ab:	83 c4 10             	add    $0x10,%esp
+  8025ae:	85 c0                	test   %eax,%eax
+  8025b0:	74 c8                	je     80257a <set_pgfault_handler+0xf>
+      panic(" set_pgfault_handler sys_env_set_pgfault_upcall panic: %e\n", r);
+  8025b2:	50                   	push   %eax
+  8025b3:	68 8c 31 80 00       	push   $0x80318c
+  8025b8:	6a 22                	push   $0x22
+  8025ba:	68 c7 31 80 00       	push   $0x8031c7
+  8025bf:	e8 25 dd ff ff       	call   8002e9 <_panic>
+      panic("set_pgfault_handler sys_page_alloc panic: %e\n", r);
+  8025c4:	50                   	push   %eax
+  8025c5:	68 5c 31 80 00       	push   $0x80315c
+  8025ca:	6a 20                	push   $0x20
+  8025cc:	68 c7 31 80 00       	push   $0x8031c7
+  8025d1:	e8 13 dd ff ff       	call   8002e9 <_panic>
+
+008025d6 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8025d6:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8025d7:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  8025dc:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8025de:	83 c4 04             	add    $0x4,%esp
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	// push the trap-time %eip onto the trap-time stack
+    subl $0x4, 0x30(%esp) # for push eip
+  8025e1:	83 6c 24 30 04       	subl   $0x4,0x30(%esp)
+    movl 0x30(%esp), %ebx #regular esp
+  8025e6:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+    movl 0x28(%esp), %eax #eip
+  8025ea:	8b 44 24 28          	mov    0x28(%esp),%eax
+    movl %eax, (%ebx)
+  8025ee:	89 03                	mov    %eax,(%ebx)
+
+    // Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+    addl $8, %esp
+  8025f0:	83 c4 08             	add    $0x8,%esp
+    popal
+  8025f3:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  8025f4:	83 c4 04             	add    $0x4,%esp
+	popfl
+  8025f7:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  8025f8:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  8025f9:	c3                   	ret
+
+008025fa <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8025fa:	55                   	push   %ebp
+  8025fb:	89 e5                	mov    %esp,%ebp
+  8025fd:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802600:	89 c2                	mov    %eax,%edx
+  802602:	c1 ea 16             	shr    $0x16,%edx
+  802605:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80260c:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802611:	f6 c1 01             	test   $0x1,%cl
+  802614:	74 1c                	je     802632 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  802616:	c1 e8 0c             	shr    $0xc,%eax
+  802619:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802620:	a8 01                	test   $0x1,%al
+  802622:	74 0e                	je     802632 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802624:	c1 e8 0c             	shr    $0xc,%eax
+  802627:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  80262e:	ef 
+  80262f:	0f b7 d2             	movzwl %dx,%edx
+}
+  802632:	89 d0                	mov    %edx,%eax
+  802634:	5d                   	pop    %ebp
+  802635:	c3                   	ret
+  802636:	66 90                	xchg   %ax,%ax
+  802638:	66 90                	xchg   %ax,%ax
+  80263a:	66 90                	xchg   %ax,%ax
+  80263c:	66 90                	xchg   %ax,%ax
+  80263e:	66 90                	xchg   %ax,%ax
+
+00802640 <__udivmoddi4>:
+  802640:	55                   	push   %ebp
+  802641:	57                   	push   %edi
+  802642:	56                   	push   %esi
+  802643:	53                   	push   %ebx
+  802644:	83 ec 24             	sub    $0x24,%esp
+  802647:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80264b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80264f:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  802653:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802657:	8b 54 24 44          	mov    0x44(%esp),%edx
+  80265b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80265f:	8b 44 24 40          	mov    0x40(%esp),%eax
+  802663:	89 d3                	mov    %edx,%ebx
+  802665:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802669:	09 c3                	or     %eax,%ebx
+  80266b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80266f:	0f 84 9c 00 00 00    	je     802711 <__udivmoddi4+0xd1>
+  802675:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80267c:	00 
+  80267d:	31 c0                	xor    %eax,%eax
+  80267f:	31 d2                	xor    %edx,%edx
+  802681:	89 fb                	mov    %edi,%ebx
+  802683:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80268a:	00 
+  80268b:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802690:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802694:	01 c0                	add    %eax,%eax
+  802696:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80269d:	00 
+  80269e:	89 c6                	mov    %eax,%esi
+  8026a0:	89 d7                	mov    %edx,%edi
+  8026a2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8026a6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8026aa:	0f ad d0             	shrd   %cl,%edx,%eax
+  8026ad:	d3 ea                	shr    %cl,%edx
+  8026af:	f6 c1 20             	test   $0x20,%cl
+  8026b2:	0f 45 c2             	cmovne %edx,%eax
+  8026b5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8026b9:	83 e0 01             	and    $0x1,%eax
+  8026bc:	09 fa                	or     %edi,%edx
+  8026be:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8026c2:	89 04 24             	mov    %eax,(%esp)
+  8026c5:	8b 04 24             	mov    (%esp),%eax
+  8026c8:	89 d5                	mov    %edx,%ebp
+  8026ca:	09 f0                	or     %esi,%eax
+  8026cc:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8026d0:	39 f0                	cmp    %esi,%eax
+  8026d2:	19 fd                	sbb    %edi,%ebp
+  8026d4:	72 1d                	jb     8026f3 <__udivmoddi4+0xb3>
+  8026d6:	29 f0                	sub    %esi,%eax
+  8026d8:	19 fa                	sbb    %edi,%edx
+  8026da:	89 cf                	mov    %ecx,%edi
+  8026dc:	c1 ef 05             	shr    $0x5,%edi
+  8026df:	83 e7 01             	and    $0x1,%edi
+  8026e2:	89 fe                	mov    %edi,%esi
+  8026e4:	d3 e7                	shl    %cl,%edi
+  8026e6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8026ea:	83 f6 01             	xor    $0x1,%esi
+  8026ed:	d3 e6                	shl    %cl,%esi
+  8026ef:	09 74 24 18          	or     %esi,0x18(%esp)
+  8026f3:	83 e9 01             	sub    $0x1,%ecx
+  8026f6:	73 98                	jae    802690 <__udivmoddi4+0x50>
+  8026f8:	85 db                	test   %ebx,%ebx
+  8026fa:	74 05                	je     802701 <__udivmoddi4+0xc1>
+  8026fc:	89 03                	mov    %eax,(%ebx)
+  8026fe:	89 53 04             	mov    %edx,0x4(%ebx)
+  802701:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802705:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802709:	83 c4 24             	add    $0x24,%esp
+  80270c:	5b                   	pop    %ebx
+  80270d:	5e                   	pop    %esi
+  80270e:	5f                   	pop    %edi
+  80270f:	5d                   	pop    %ebp
+  802710:	c3                   	ret
+  802711:	85 ff                	test   %edi,%edi
+  802713:	74 0d                	je     802722 <__udivmoddi4+0xe2>
+  802715:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  80271b:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  802722:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802726:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80272a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80272e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802732:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802736:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80273a:	83 c4 24             	add    $0x24,%esp
+  80273d:	5b                   	pop    %ebx
+  80273e:	5e                   	pop    %esi
+  80273f:	5f                   	pop    %edi
+  802740:	5d                   	pop    %ebp
+  802741:	c3                   	ret
+  802742:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802749:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00802750 <__udivdi3>:
+  802750:	57                   	push   %edi
+  802751:	56                   	push   %esi
+  802752:	53                   	push   %ebx
+  802753:	83 ec 20             	sub    $0x20,%esp
+  802756:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80275a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80275e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802762:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802766:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80276a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80276e:	89 d1                	mov    %edx,%ecx
+  802770:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802774:	09 c1                	or     %eax,%ecx
+  802776:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80277a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80277e:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802782:	0f 84 88 00 00 00    	je     802810 <__udivdi3+0xc0>
+  802788:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80278f:	00 
+  802790:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802795:	31 c0                	xor    %eax,%eax
+  802797:	31 d2                	xor    %edx,%edx
+  802799:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8027a0:	00 
+  8027a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8027a8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8027ac:	01 c0                	add    %eax,%eax
+  8027ae:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8027b5:	00 
+  8027b6:	89 c6                	mov    %eax,%esi
+  8027b8:	89 d7                	mov    %edx,%edi
+  8027ba:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8027be:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8027c2:	0f ad d0             	shrd   %cl,%edx,%eax
+  8027c5:	d3 ea                	shr    %cl,%edx
+  8027c7:	f6 c1 20             	test   $0x20,%cl
+  8027ca:	0f 45 c2             	cmovne %edx,%eax
+  8027cd:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8027d1:	83 e0 01             	and    $0x1,%eax
+  8027d4:	09 fa                	or     %edi,%edx
+  8027d6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8027da:	89 04 24             	mov    %eax,(%esp)
+  8027dd:	8b 04 24             	mov    (%esp),%eax
+  8027e0:	89 d3                	mov    %edx,%ebx
+  8027e2:	09 f0                	or     %esi,%eax
+  8027e4:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8027e8:	39 f0                	cmp    %esi,%eax
+  8027ea:	19 fb                	sbb    %edi,%ebx
+  8027ec:	72 1d                	jb     80280b <__udivdi3+0xbb>
+  8027ee:	29 f0                	sub    %esi,%eax
+  8027f0:	19 fa                	sbb    %edi,%edx
+  8027f2:	89 cf                	mov    %ecx,%edi
+  8027f4:	c1 ef 05             	shr    $0x5,%edi
+  8027f7:	83 e7 01             	and    $0x1,%edi
+  8027fa:	89 fe                	mov    %edi,%esi
+  8027fc:	d3 e7                	shl    %cl,%edi
+  8027fe:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802802:	83 f6 01             	xor    $0x1,%esi
+  802805:	d3 e6                	shl    %cl,%esi
+  802807:	09 74 24 18          	or     %esi,0x18(%esp)
+  80280b:	83 e9 01             	sub    $0x1,%ecx
+  80280e:	73 98                	jae    8027a8 <__udivdi3+0x58>
+  802810:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802814:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802818:	83 c4 20             	add    $0x20,%esp
+  80281b:	5b                   	pop    %ebx
+  80281c:	5e                   	pop    %esi
+  80281d:	5f                   	pop    %edi
+  80281e:	c3                   	ret
+  80281f:	90                   	nop
+
+00802820 <__umoddi3>:
+  802820:	57                   	push   %edi
+  802821:	56                   	push   %esi
+  802822:	53                   	push   %ebx
+  802823:	83 ec 18             	sub    $0x18,%esp
+  802826:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80282a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80282e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802832:	8b 54 24 34          	mov    0x34(%esp),%edx
+  802836:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80283a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80283e:	89 d1                	mov    %edx,%ecx
+  802840:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802844:	09 c1                	or     %eax,%ecx
+  802846:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80284a:	74 5b                	je     8028a7 <__umoddi3+0x87>
+  80284c:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802851:	31 c0                	xor    %eax,%eax
+  802853:	31 d2                	xor    %edx,%edx
+  802855:	8d 76 00             	lea    0x0(%esi),%esi
+  802858:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80285c:	01 c0                	add    %eax,%eax
+  80285e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802865:	00 
+  802866:	89 c6                	mov    %eax,%esi
+  802868:	89 d7                	mov    %edx,%edi
+  80286a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80286e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802872:	0f ad d0             	shrd   %cl,%edx,%eax
+  802875:	d3 ea                	shr    %cl,%edx
+  802877:	f6 c1 20             	test   $0x20,%cl
+  80287a:	0f 45 c2             	cmovne %edx,%eax
+  80287d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802881:	83 e0 01             	and    $0x1,%eax
+  802884:	09 fa                	or     %edi,%edx
+  802886:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80288a:	89 04 24             	mov    %eax,(%esp)
+  80288d:	8b 04 24             	mov    (%esp),%eax
+  802890:	89 d3                	mov    %edx,%ebx
+  802892:	09 f0                	or     %esi,%eax
+  802894:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802898:	39 f0                	cmp    %esi,%eax
+  80289a:	19 fb                	sbb    %edi,%ebx
+  80289c:	72 04                	jb     8028a2 <__umoddi3+0x82>
+  80289e:	29 f0                	sub    %esi,%eax
+  8028a0:	19 fa                	sbb    %edi,%edx
+  8028a2:	83 e9 01             	sub    $0x1,%ecx
+  8028a5:	73 b1                	jae    802858 <__umoddi3+0x38>
+  8028a7:	83 c4 18             	add    $0x18,%esp
+  8028aa:	5b                   	pop    %ebx
+  8028ab:	5e                   	pop    %esi
+  8028ac:	5f                   	pop    %edi
+  8028ad:	c3                   	ret
+  8028ae:	66 90                	xchg   %ax,%ax
+
+008028b0 <__divdi3>:
+  8028b0:	55                   	push   %ebp
+  8028b1:	57                   	push   %edi
+  8028b2:	56                   	push   %esi
+  8028b3:	53                   	push   %ebx
+  8028b4:	83 ec 24             	sub    $0x24,%esp
+  8028b7:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  8028bb:	8b 74 24 44          	mov    0x44(%esp),%esi
+  8028bf:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8028c3:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8028c7:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  8028cb:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8028cf:	85 d2                	test   %edx,%edx
+  8028d1:	0f 88 e0 00 00 00    	js     8029b7 <__divdi3+0x107>
+  8028d7:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  8028db:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  8028df:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8028e3:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8028e7:	85 f6                	test   %esi,%esi
+  8028e9:	78 16                	js     802901 <__divdi3+0x51>
+  8028eb:	89 f1                	mov    %esi,%ecx
+  8028ed:	31 c0                	xor    %eax,%eax
+  8028ef:	31 d2                	xor    %edx,%edx
+  8028f1:	09 d9                	or     %ebx,%ecx
+  8028f3:	0f 85 f3 00 00 00    	jne    8029ec <__divdi3+0x13c>
+  8028f9:	83 c4 24             	add    $0x24,%esp
+  8028fc:	5b                   	pop    %ebx
+  8028fd:	5e                   	pop    %esi
+  8028fe:	5f                   	pop    %edi
+  8028ff:	5d                   	pop    %ebp
+  802900:	c3                   	ret
+  802901:	bf 01 00 00 00       	mov    $0x1,%edi
+  802906:	f7 5c 24 08          	negl   0x8(%esp)
+  80290a:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  80290f:	f7 5c 24 0c          	negl   0xc(%esp)
+  802913:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80291a:	00 
+  80291b:	31 c0                	xor    %eax,%eax
+  80291d:	31 d2                	xor    %edx,%edx
+  80291f:	89 fb                	mov    %edi,%ebx
+  802921:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802928:	00 
+  802929:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80292e:	66 90                	xchg   %ax,%ax
+  802930:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802934:	01 c0                	add    %eax,%eax
+  802936:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80293d:	00 
+  80293e:	89 c6                	mov    %eax,%esi
+  802940:	89 d7                	mov    %edx,%edi
+  802942:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802946:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80294a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80294d:	d3 ea                	shr    %cl,%edx
+  80294f:	f6 c1 20             	test   $0x20,%cl
+  802952:	0f 45 c2             	cmovne %edx,%eax
+  802955:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802959:	83 e0 01             	and    $0x1,%eax
+  80295c:	09 fa                	or     %edi,%edx
+  80295e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802962:	89 04 24             	mov    %eax,(%esp)
+  802965:	8b 04 24             	mov    (%esp),%eax
+  802968:	89 d5                	mov    %edx,%ebp
+  80296a:	09 f0                	or     %esi,%eax
+  80296c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802970:	39 f0                	cmp    %esi,%eax
+  802972:	19 fd                	sbb    %edi,%ebp
+  802974:	72 1d                	jb     802993 <__divdi3+0xe3>
+  802976:	29 f0                	sub    %esi,%eax
+  802978:	19 fa                	sbb    %edi,%edx
+  80297a:	89 cf                	mov    %ecx,%edi
+  80297c:	c1 ef 05             	shr    $0x5,%edi
+  80297f:	83 e7 01             	and    $0x1,%edi
+  802982:	89 fe                	mov    %edi,%esi
+  802984:	d3 e7                	shl    %cl,%edi
+  802986:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80298a:	83 f6 01             	xor    $0x1,%esi
+  80298d:	d3 e6                	shl    %cl,%esi
+  80298f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802993:	83 e9 01             	sub    $0x1,%ecx
+  802996:	73 98                	jae    802930 <__divdi3+0x80>
+  802998:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80299c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8029a0:	85 db                	test   %ebx,%ebx
+  8029a2:	0f 84 51 ff ff ff    	je     8028f9 <__divdi3+0x49>
+  8029a8:	f7 d8                	neg    %eax
+  8029aa:	83 d2 00             	adc    $0x0,%edx
+  8029ad:	83 c4 24             	add    $0x24,%esp
+  8029b0:	5b                   	pop    %ebx
+  8029b1:	f7 da                	neg    %edx
+  8029b3:	5e                   	pop    %esi
+  8029b4:	5f                   	pop    %edi
+  8029b5:	5d                   	pop    %ebp
+  8029b6:	c3                   	ret
+  8029b7:	f7 d8                	neg    %eax
+  8029b9:	83 d2 00             	adc    $0x0,%edx
+  8029bc:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8029c0:	f7 da                	neg    %edx
+  8029c2:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8029c6:	85 f6                	test   %esi,%esi
+  8029c8:	78 1b                	js     8029e5 <__divdi3+0x135>
+  8029ca:	89 f1                	mov    %esi,%ecx
+  8029cc:	31 c0                	xor    %eax,%eax
+  8029ce:	31 d2                	xor    %edx,%edx
+  8029d0:	bf 01 00 00 00       	mov    $0x1,%edi
+  8029d5:	09 d9                	or     %ebx,%ecx
+  8029d7:	0f 85 36 ff ff ff    	jne    802913 <__divdi3+0x63>
+  8029dd:	83 c4 24             	add    $0x24,%esp
+  8029e0:	5b                   	pop    %ebx
+  8029e1:	5e                   	pop    %esi
+  8029e2:	5f                   	pop    %edi
+  8029e3:	5d                   	pop    %ebp
+  8029e4:	c3                   	ret
+  8029e5:	31 ff                	xor    %edi,%edi
+  8029e7:	e9 1a ff ff ff       	jmp    802906 <__divdi3+0x56>
+  8029ec:	31 ff                	xor    %edi,%edi
+  8029ee:	e9 20 ff ff ff       	jmp    802913 <__divdi3+0x63>
+  8029f3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8029fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00802a00 <__moddi3>:
+  802a00:	55                   	push   %ebp
+  802a01:	57                   	push   %edi
+  802a02:	56                   	push   %esi
+  802a03:	53                   	push   %ebx
+  802a04:	83 ec 1c             	sub    $0x1c,%esp
+  802a07:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  802a0b:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  802a0f:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  802a13:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  802a17:	89 c8                	mov    %ecx,%eax
+  802a19:	89 f2                	mov    %esi,%edx
+  802a1b:	89 f3                	mov    %esi,%ebx
+  802a1d:	85 ed                	test   %ebp,%ebp
+  802a1f:	0f 88 9d 00 00 00    	js     802ac2 <__moddi3+0xc2>
+  802a25:	09 cb                	or     %ecx,%ebx
+  802a27:	0f 84 8d 00 00 00    	je     802aba <__moddi3+0xba>
+  802a2d:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802a31:	31 db                	xor    %ebx,%ebx
+  802a33:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802a37:	89 ca                	mov    %ecx,%edx
+  802a39:	89 f0                	mov    %esi,%eax
+  802a3b:	89 dd                	mov    %ebx,%ebp
+  802a3d:	f7 da                	neg    %edx
+  802a3f:	83 d0 00             	adc    $0x0,%eax
+  802a42:	f7 d8                	neg    %eax
+  802a44:	0f 49 f0             	cmovns %eax,%esi
+  802a47:	0f 49 ca             	cmovns %edx,%ecx
+  802a4a:	31 c0                	xor    %eax,%eax
+  802a4c:	31 d2                	xor    %edx,%edx
+  802a4e:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802a52:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802a56:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802a5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  802a5f:	90                   	nop
+  802a60:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802a64:	01 c0                	add    %eax,%eax
+  802a66:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802a6d:	00 
+  802a6e:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  802a72:	89 c6                	mov    %eax,%esi
+  802a74:	89 d7                	mov    %edx,%edi
+  802a76:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802a7a:	8b 54 24 14          	mov    0x14(%esp),%edx
+  802a7e:	0f ad d0             	shrd   %cl,%edx,%eax
+  802a81:	d3 ea                	shr    %cl,%edx
+  802a83:	f6 c1 20             	test   $0x20,%cl
+  802a86:	0f 45 c2             	cmovne %edx,%eax
+  802a89:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802a8d:	83 e0 01             	and    $0x1,%eax
+  802a90:	09 fa                	or     %edi,%edx
+  802a92:	89 04 24             	mov    %eax,(%esp)
+  802a95:	8b 04 24             	mov    (%esp),%eax
+  802a98:	89 d7                	mov    %edx,%edi
+  802a9a:	09 f0                	or     %esi,%eax
+  802a9c:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  802aa0:	39 d8                	cmp    %ebx,%eax
+  802aa2:	19 f7                	sbb    %esi,%edi
+  802aa4:	72 04                	jb     802aaa <__moddi3+0xaa>
+  802aa6:	29 d8                	sub    %ebx,%eax
+  802aa8:	19 f2                	sbb    %esi,%edx
+  802aaa:	83 e9 01             	sub    $0x1,%ecx
+  802aad:	73 b1                	jae    802a60 <__moddi3+0x60>
+  802aaf:	85 ed                	test   %ebp,%ebp
+  802ab1:	74 07                	je     802aba <__moddi3+0xba>
+  802ab3:	f7 d8                	neg    %eax
+  802ab5:	83 d2 00             	adc    $0x0,%edx
+  802ab8:	f7 da                	neg    %edx
+  802aba:	83 c4 1c             	add    $0x1c,%esp
+  802abd:	5b                   	pop    %ebx
+  802abe:	5e                   	pop    %esi
+  802abf:	5f                   	pop    %edi
+  802ac0:	5d                   	pop    %ebp
+  802ac1:	c3                   	ret
+  802ac2:	09 cb                	or     %ecx,%ebx
+  802ac4:	74 f4                	je     802aba <__moddi3+0xba>
+  802ac6:	f7 df                	neg    %edi
+  802ac8:	bb 01 00 00 00       	mov    $0x1,%ebx
+  802acd:	83 d5 00             	adc    $0x0,%ebp
+  802ad0:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802ad4:	f7 dd                	neg    %ebp
+  802ad6:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802ada:	e9 58 ff ff ff       	jmp    802a37 <__moddi3+0x37>
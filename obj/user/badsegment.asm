@@ -0,0 +1,5253 @@
+
+obj/user/badsegment.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 09 00 00 00       	call   80003a <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+	// Try to load the kernel's TSS selector into the DS register.
+	asm volatile("movw $0x28,%ax; movw %ax,%ds");
+  800033:	66 b8 28 00          	mov    $0x28,%ax
+  800037:	8e d8                	mov    %eax,%ds
+}
+  800039:	c3                   	ret
+
+0080003a <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  80003a:	55                   	push   %ebp
+  80003b:	89 e5                	mov    %esp,%ebp
+  80003d:	56                   	push   %esi
+  80003e:	53                   	push   %ebx
+  80003f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800042:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  800045:	e8 d1 00 00 00       	call   80011b <sys_getenvid>
+  80004a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80004f:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800052:	c1 e0 04             	shl    $0x4,%eax
+  800055:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80005a:	a3 08 40 80 00       	mov    %eax,0x804008
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  80005f:	85 db                	test   %ebx,%ebx
+  800061:	7e 07                	jle    80006a <libmain+0x30>
+    binaryname = argv[0];
+  800063:	8b 06                	mov    (%esi),%eax
+  800065:	a3 00 30 80 00       	mov    %eax,0x803000
+
+  // call user main routine
+  umain(argc, argv);
+  80006a:	83 ec 08             	sub    $0x8,%esp
+  80006d:	56                   	push   %esi
+  80006e:	53                   	push   %ebx
+  80006f:	e8 bf ff ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  800074:	e8 0a 00 00 00       	call   800083 <exit>
+}
+  800079:	83 c4 10             	add    $0x10,%esp
+  80007c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80007f:	5b                   	pop    %ebx
+  800080:	5e                   	pop    %esi
+  800081:	5d                   	pop    %ebp
+  800082:	c3                   	ret
+
+00800083 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800083:	55                   	push   %ebp
+  800084:	89 e5                	mov    %esp,%ebp
+  800086:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800089:	e8 72 05 00 00       	call   800600 <close_all>
+	sys_env_destroy(0);
+  80008e:	83 ec 0c             	sub    $0xc,%esp
+  800091:	6a 00                	push   $0x0
+  800093:	e8 42 00 00 00       	call   8000da <sys_env_destroy>
+}
+  800098:	83 c4 10             	add    $0x10,%esp
+  80009b:	c9                   	leave
+  80009c:	c3                   	ret
+
+0080009d <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80009d:	55                   	push   %ebp
+  80009e:	89 e5                	mov    %esp,%ebp
+  8000a0:	57                   	push   %edi
+  8000a1:	56                   	push   %esi
+  8000a2:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8000a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000ab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000ae:	89 c3                	mov    %eax,%ebx
+  8000b0:	89 c7                	mov    %eax,%edi
+  8000b2:	89 c6                	mov    %eax,%esi
+  8000b4:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  8000b6:	5b                   	pop    %ebx
+  8000b7:	5e                   	pop    %esi
+  8000b8:	5f                   	pop    %edi
+  8000b9:	5d                   	pop    %ebp
+  8000ba:	c3                   	ret
+
+008000bb <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8000bb:	55                   	push   %ebp
+  8000bc:	89 e5                	mov    %esp,%ebp
+  8000be:	57                   	push   %edi
+  8000bf:	56                   	push   %esi
+  8000c0:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8000c1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000c6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000cb:	89 d1                	mov    %edx,%ecx
+  8000cd:	89 d3                	mov    %edx,%ebx
+  8000cf:	89 d7                	mov    %edx,%edi
+  8000d1:	89 d6                	mov    %edx,%esi
+  8000d3:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8000d5:	5b                   	pop    %ebx
+  8000d6:	5e                   	pop    %esi
+  8000d7:	5f                   	pop    %edi
+  8000d8:	5d                   	pop    %ebp
+  8000d9:	c3                   	ret
+
+008000da <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8000da:	55                   	push   %ebp
+  8000db:	89 e5                	mov    %esp,%ebp
+  8000dd:	57                   	push   %edi
+  8000de:	56                   	push   %esi
+  8000df:	53                   	push   %ebx
+  8000e0:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8000e3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000e8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000eb:	b8 03 00 00 00       	mov    $0x3,%eax
+  8000f0:	89 cb                	mov    %ecx,%ebx
+  8000f2:	89 cf                	mov    %ecx,%edi
+  8000f4:	89 ce                	mov    %ecx,%esi
+  8000f6:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8000f8:	85 c0                	test   %eax,%eax
+  8000fa:	7f 08                	jg     800104 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  8000fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000ff:	5b                   	pop    %ebx
+  800100:	5e                   	pop    %esi
+  800101:	5f                   	pop    %edi
+  800102:	5d                   	pop    %ebp
+  800103:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800104:	83 ec 0c             	sub    $0xc,%esp
+  800107:	50                   	push   %eax
+  800108:	6a 03                	push   $0x3
+  80010a:	68 0a 25 80 00       	push   $0x80250a
+  80010f:	6a 3e                	push   $0x3e
+  800111:	68 27 25 80 00       	push   $0x802527
+  800116:	e8 22 14 00 00       	call   80153d <_panic>
+
+0080011b <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80011b:	55                   	push   %ebp
+  80011c:	89 e5                	mov    %esp,%ebp
+  80011e:	57                   	push   %edi
+  80011f:	56                   	push   %esi
+  800120:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800121:	ba 00 00 00 00       	mov    $0x0,%edx
+  800126:	b8 02 00 00 00       	mov    $0x2,%eax
+  80012b:	89 d1                	mov    %edx,%ecx
+  80012d:	89 d3                	mov    %edx,%ebx
+  80012f:	89 d7                	mov    %edx,%edi
+  800131:	89 d6                	mov    %edx,%esi
+  800133:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800135:	5b                   	pop    %ebx
+  800136:	5e                   	pop    %esi
+  800137:	5f                   	pop    %edi
+  800138:	5d                   	pop    %ebp
+  800139:	c3                   	ret
+
+0080013a <sys_yield>:
+
+void
+sys_yield(void) {
+  80013a:	55                   	push   %ebp
+  80013b:	89 e5                	mov    %esp,%ebp
+  80013d:	57                   	push   %edi
+  80013e:	56                   	push   %esi
+  80013f:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800140:	ba 00 00 00 00       	mov    $0x0,%edx
+  800145:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80014a:	89 d1                	mov    %edx,%ecx
+  80014c:	89 d3                	mov    %edx,%ebx
+  80014e:	89 d7                	mov    %edx,%edi
+  800150:	89 d6                	mov    %edx,%esi
+  800152:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800154:	5b                   	pop    %ebx
+  800155:	5e                   	pop    %esi
+  800156:	5f                   	pop    %edi
+  800157:	5d                   	pop    %ebp
+  800158:	c3                   	ret
+
+00800159 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  800159:	55                   	push   %ebp
+  80015a:	89 e5                	mov    %esp,%ebp
+  80015c:	57                   	push   %edi
+  80015d:	56                   	push   %esi
+  80015e:	53                   	push   %ebx
+  80015f:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800162:	be 00 00 00 00       	mov    $0x0,%esi
+  800167:	8b 55 08             	mov    0x8(%ebp),%edx
+  80016a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80016d:	b8 04 00 00 00       	mov    $0x4,%eax
+  800172:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800175:	89 f7                	mov    %esi,%edi
+  800177:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800179:	85 c0                	test   %eax,%eax
+  80017b:	7f 08                	jg     800185 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  80017d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800180:	5b                   	pop    %ebx
+  800181:	5e                   	pop    %esi
+  800182:	5f                   	pop    %edi
+  800183:	5d                   	pop    %ebp
+  800184:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800185:	83 ec 0c             	sub    $0xc,%esp
+  800188:	50                   	push   %eax
+  800189:	6a 04                	push   $0x4
+  80018b:	68 0a 25 80 00       	push   $0x80250a
+  800190:	6a 3e                	push   $0x3e
+  800192:	68 27 25 80 00       	push   $0x802527
+  800197:	e8 a1 13 00 00       	call   80153d <_panic>
+
+0080019c <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  80019c:	55                   	push   %ebp
+  80019d:	89 e5                	mov    %esp,%ebp
+  80019f:	57                   	push   %edi
+  8001a0:	56                   	push   %esi
+  8001a1:	53                   	push   %ebx
+  8001a2:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8001a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001a8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001ab:	b8 05 00 00 00       	mov    $0x5,%eax
+  8001b0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001b3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8001b6:	8b 75 18             	mov    0x18(%ebp),%esi
+  8001b9:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8001bb:	85 c0                	test   %eax,%eax
+  8001bd:	7f 08                	jg     8001c7 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  8001bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001c2:	5b                   	pop    %ebx
+  8001c3:	5e                   	pop    %esi
+  8001c4:	5f                   	pop    %edi
+  8001c5:	5d                   	pop    %ebp
+  8001c6:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8001c7:	83 ec 0c             	sub    $0xc,%esp
+  8001ca:	50                   	push   %eax
+  8001cb:	6a 05                	push   $0x5
+  8001cd:	68 0a 25 80 00       	push   $0x80250a
+  8001d2:	6a 3e                	push   $0x3e
+  8001d4:	68 27 25 80 00       	push   $0x802527
+  8001d9:	e8 5f 13 00 00       	call   80153d <_panic>
+
+008001de <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  8001de:	55                   	push   %ebp
+  8001df:	89 e5                	mov    %esp,%ebp
+  8001e1:	57                   	push   %edi
+  8001e2:	56                   	push   %esi
+  8001e3:	53                   	push   %ebx
+  8001e4:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8001e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001ef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001f2:	b8 06 00 00 00       	mov    $0x6,%eax
+  8001f7:	89 df                	mov    %ebx,%edi
+  8001f9:	89 de                	mov    %ebx,%esi
+  8001fb:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8001fd:	85 c0                	test   %eax,%eax
+  8001ff:	7f 08                	jg     800209 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800201:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800204:	5b                   	pop    %ebx
+  800205:	5e                   	pop    %esi
+  800206:	5f                   	pop    %edi
+  800207:	5d                   	pop    %ebp
+  800208:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800209:	83 ec 0c             	sub    $0xc,%esp
+  80020c:	50                   	push   %eax
+  80020d:	6a 06                	push   $0x6
+  80020f:	68 0a 25 80 00       	push   $0x80250a
+  800214:	6a 3e                	push   $0x3e
+  800216:	68 27 25 80 00       	push   $0x802527
+  80021b:	e8 1d 13 00 00       	call   80153d <_panic>
+
+00800220 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800220:	55                   	push   %ebp
+  800221:	89 e5                	mov    %esp,%ebp
+  800223:	57                   	push   %edi
+  800224:	56                   	push   %esi
+  800225:	53                   	push   %ebx
+  800226:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800229:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80022e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800231:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800234:	b8 08 00 00 00       	mov    $0x8,%eax
+  800239:	89 df                	mov    %ebx,%edi
+  80023b:	89 de                	mov    %ebx,%esi
+  80023d:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80023f:	85 c0                	test   %eax,%eax
+  800241:	7f 08                	jg     80024b <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800243:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800246:	5b                   	pop    %ebx
+  800247:	5e                   	pop    %esi
+  800248:	5f                   	pop    %edi
+  800249:	5d                   	pop    %ebp
+  80024a:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80024b:	83 ec 0c             	sub    $0xc,%esp
+  80024e:	50                   	push   %eax
+  80024f:	6a 08                	push   $0x8
+  800251:	68 0a 25 80 00       	push   $0x80250a
+  800256:	6a 3e                	push   $0x3e
+  800258:	68 27 25 80 00       	push   $0x802527
+  80025d:	e8 db 12 00 00       	call   80153d <_panic>
+
+00800262 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800262:	55                   	push   %ebp
+  800263:	89 e5                	mov    %esp,%ebp
+  800265:	57                   	push   %edi
+  800266:	56                   	push   %esi
+  800267:	53                   	push   %ebx
+  800268:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  80026b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800270:	8b 55 08             	mov    0x8(%ebp),%edx
+  800273:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800276:	b8 09 00 00 00       	mov    $0x9,%eax
+  80027b:	89 df                	mov    %ebx,%edi
+  80027d:	89 de                	mov    %ebx,%esi
+  80027f:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800281:	85 c0                	test   %eax,%eax
+  800283:	7f 08                	jg     80028d <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800285:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800288:	5b                   	pop    %ebx
+  800289:	5e                   	pop    %esi
+  80028a:	5f                   	pop    %edi
+  80028b:	5d                   	pop    %ebp
+  80028c:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80028d:	83 ec 0c             	sub    $0xc,%esp
+  800290:	50                   	push   %eax
+  800291:	6a 09                	push   $0x9
+  800293:	68 0a 25 80 00       	push   $0x80250a
+  800298:	6a 3e                	push   $0x3e
+  80029a:	68 27 25 80 00       	push   $0x802527
+  80029f:	e8 99 12 00 00       	call   80153d <_panic>
+
+008002a4 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8002a4:	55                   	push   %ebp
+  8002a5:	89 e5                	mov    %esp,%ebp
+  8002a7:	57                   	push   %edi
+  8002a8:	56                   	push   %esi
+  8002a9:	53                   	push   %ebx
+  8002aa:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8002ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002b5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002b8:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8002bd:	89 df                	mov    %ebx,%edi
+  8002bf:	89 de                	mov    %ebx,%esi
+  8002c1:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8002c3:	85 c0                	test   %eax,%eax
+  8002c5:	7f 08                	jg     8002cf <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8002c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002ca:	5b                   	pop    %ebx
+  8002cb:	5e                   	pop    %esi
+  8002cc:	5f                   	pop    %edi
+  8002cd:	5d                   	pop    %ebp
+  8002ce:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8002cf:	83 ec 0c             	sub    $0xc,%esp
+  8002d2:	50                   	push   %eax
+  8002d3:	6a 0a                	push   $0xa
+  8002d5:	68 0a 25 80 00       	push   $0x80250a
+  8002da:	6a 3e                	push   $0x3e
+  8002dc:	68 27 25 80 00       	push   $0x802527
+  8002e1:	e8 57 12 00 00       	call   80153d <_panic>
+
+008002e6 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  8002e6:	55                   	push   %ebp
+  8002e7:	89 e5                	mov    %esp,%ebp
+  8002e9:	57                   	push   %edi
+  8002ea:	56                   	push   %esi
+  8002eb:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8002ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002ef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002f2:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8002f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8002fc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8002ff:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800302:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800304:	5b                   	pop    %ebx
+  800305:	5e                   	pop    %esi
+  800306:	5f                   	pop    %edi
+  800307:	5d                   	pop    %ebp
+  800308:	c3                   	ret
+
+00800309 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  800309:	55                   	push   %ebp
+  80030a:	89 e5                	mov    %esp,%ebp
+  80030c:	57                   	push   %edi
+  80030d:	56                   	push   %esi
+  80030e:	53                   	push   %ebx
+  80030f:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800312:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800317:	8b 55 08             	mov    0x8(%ebp),%edx
+  80031a:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80031f:	89 cb                	mov    %ecx,%ebx
+  800321:	89 cf                	mov    %ecx,%edi
+  800323:	89 ce                	mov    %ecx,%esi
+  800325:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800327:	85 c0                	test   %eax,%eax
+  800329:	7f 08                	jg     800333 <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  80032b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80032e:	5b                   	pop    %ebx
+  80032f:	5e                   	pop    %esi
+  800330:	5f                   	pop    %edi
+  800331:	5d                   	pop    %ebp
+  800332:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800333:	83 ec 0c             	sub    $0xc,%esp
+  800336:	50                   	push   %eax
+  800337:	6a 0d                	push   $0xd
+  800339:	68 0a 25 80 00       	push   $0x80250a
+  80033e:	6a 3e                	push   $0x3e
+  800340:	68 27 25 80 00       	push   $0x802527
+  800345:	e8 f3 11 00 00       	call   80153d <_panic>
+
+0080034a <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  80034a:	55                   	push   %ebp
+  80034b:	89 e5                	mov    %esp,%ebp
+  80034d:	57                   	push   %edi
+  80034e:	56                   	push   %esi
+  80034f:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800350:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800355:	8b 55 08             	mov    0x8(%ebp),%edx
+  800358:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80035b:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800360:	89 df                	mov    %ebx,%edi
+  800362:	89 de                	mov    %ebx,%esi
+  800364:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  800366:	5b                   	pop    %ebx
+  800367:	5e                   	pop    %esi
+  800368:	5f                   	pop    %edi
+  800369:	5d                   	pop    %ebp
+  80036a:	c3                   	ret
+
+0080036b <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  80036b:	55                   	push   %ebp
+  80036c:	89 e5                	mov    %esp,%ebp
+  80036e:	57                   	push   %edi
+  80036f:	56                   	push   %esi
+  800370:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800371:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800376:	8b 55 08             	mov    0x8(%ebp),%edx
+  800379:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80037e:	89 cb                	mov    %ecx,%ebx
+  800380:	89 cf                	mov    %ecx,%edi
+  800382:	89 ce                	mov    %ecx,%esi
+  800384:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  800386:	5b                   	pop    %ebx
+  800387:	5e                   	pop    %esi
+  800388:	5f                   	pop    %edi
+  800389:	5d                   	pop    %ebp
+  80038a:	c3                   	ret
+
+0080038b <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  80038b:	55                   	push   %ebp
+  80038c:	89 e5                	mov    %esp,%ebp
+  80038e:	57                   	push   %edi
+  80038f:	56                   	push   %esi
+  800390:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800391:	ba 00 00 00 00       	mov    $0x0,%edx
+  800396:	b8 10 00 00 00       	mov    $0x10,%eax
+  80039b:	89 d1                	mov    %edx,%ecx
+  80039d:	89 d3                	mov    %edx,%ebx
+  80039f:	89 d7                	mov    %edx,%edi
+  8003a1:	89 d6                	mov    %edx,%esi
+  8003a3:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8003a5:	5b                   	pop    %ebx
+  8003a6:	5e                   	pop    %esi
+  8003a7:	5f                   	pop    %edi
+  8003a8:	5d                   	pop    %ebp
+  8003a9:	c3                   	ret
+
+008003aa <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  8003aa:	55                   	push   %ebp
+  8003ab:	89 e5                	mov    %esp,%ebp
+  8003ad:	57                   	push   %edi
+  8003ae:	56                   	push   %esi
+  8003af:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8003b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003b5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003b8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003bb:	b8 11 00 00 00       	mov    $0x11,%eax
+  8003c0:	89 df                	mov    %ebx,%edi
+  8003c2:	89 de                	mov    %ebx,%esi
+  8003c4:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  8003c6:	5b                   	pop    %ebx
+  8003c7:	5e                   	pop    %esi
+  8003c8:	5f                   	pop    %edi
+  8003c9:	5d                   	pop    %ebp
+  8003ca:	c3                   	ret
+
+008003cb <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  8003cb:	55                   	push   %ebp
+  8003cc:	89 e5                	mov    %esp,%ebp
+  8003ce:	57                   	push   %edi
+  8003cf:	56                   	push   %esi
+  8003d0:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8003d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003d9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003dc:	b8 12 00 00 00       	mov    $0x12,%eax
+  8003e1:	89 df                	mov    %ebx,%edi
+  8003e3:	89 de                	mov    %ebx,%esi
+  8003e5:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  8003e7:	5b                   	pop    %ebx
+  8003e8:	5e                   	pop    %esi
+  8003e9:	5f                   	pop    %edi
+  8003ea:	5d                   	pop    %ebp
+  8003eb:	c3                   	ret
+
+008003ec <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  8003ec:	55                   	push   %ebp
+  8003ed:	89 e5                	mov    %esp,%ebp
+  8003ef:	57                   	push   %edi
+  8003f0:	56                   	push   %esi
+  8003f1:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8003f2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8003f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003fa:	b8 13 00 00 00       	mov    $0x13,%eax
+  8003ff:	89 cb                	mov    %ecx,%ebx
+  800401:	89 cf                	mov    %ecx,%edi
+  800403:	89 ce                	mov    %ecx,%esi
+  800405:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  800407:	5b                   	pop    %ebx
+  800408:	5e                   	pop    %esi
+  800409:	5f                   	pop    %edi
+  80040a:	5d                   	pop    %ebp
+  80040b:	c3                   	ret
+
+0080040c <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  80040c:	55                   	push   %ebp
+  80040d:	89 e5                	mov    %esp,%ebp
+  80040f:	57                   	push   %edi
+  800410:	56                   	push   %esi
+  800411:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800412:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800417:	8b 55 08             	mov    0x8(%ebp),%edx
+  80041a:	b8 14 00 00 00       	mov    $0x14,%eax
+  80041f:	89 cb                	mov    %ecx,%ebx
+  800421:	89 cf                	mov    %ecx,%edi
+  800423:	89 ce                	mov    %ecx,%esi
+  800425:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  800427:	5b                   	pop    %ebx
+  800428:	5e                   	pop    %esi
+  800429:	5f                   	pop    %edi
+  80042a:	5d                   	pop    %ebp
+  80042b:	c3                   	ret
+
+0080042c <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80042c:	55                   	push   %ebp
+  80042d:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80042f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800432:	05 00 00 00 30       	add    $0x30000000,%eax
+  800437:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80043a:	5d                   	pop    %ebp
+  80043b:	c3                   	ret
+
+0080043c <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80043c:	55                   	push   %ebp
+  80043d:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80043f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800442:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800447:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80044c:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800451:	5d                   	pop    %ebp
+  800452:	c3                   	ret
+
+00800453 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800453:	55                   	push   %ebp
+  800454:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  800456:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80045b:	eb 02                	jmp    80045f <fd_alloc+0xc>
+  80045d:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80045f:	89 c2                	mov    %eax,%edx
+  800461:	c1 ea 16             	shr    $0x16,%edx
+  800464:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80046b:	f6 c2 01             	test   $0x1,%dl
+  80046e:	74 2b                	je     80049b <fd_alloc+0x48>
+  800470:	89 c2                	mov    %eax,%edx
+  800472:	c1 ea 0c             	shr    $0xc,%edx
+  800475:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80047c:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  800482:	f6 c1 01             	test   $0x1,%cl
+  800485:	74 14                	je     80049b <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  800487:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80048d:	75 ce                	jne    80045d <fd_alloc+0xa>
+  80048f:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  800494:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800499:	eb 05                	jmp    8004a0 <fd_alloc+0x4d>
+			return 0;
+  80049b:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8004a0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004a3:	89 02                	mov    %eax,(%edx)
+}
+  8004a5:	89 c8                	mov    %ecx,%eax
+  8004a7:	5d                   	pop    %ebp
+  8004a8:	c3                   	ret
+
+008004a9 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8004a9:	55                   	push   %ebp
+  8004aa:	89 e5                	mov    %esp,%ebp
+  8004ac:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8004af:	83 f8 1f             	cmp    $0x1f,%eax
+  8004b2:	77 30                	ja     8004e4 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8004b4:	c1 e0 0c             	shl    $0xc,%eax
+  8004b7:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8004bc:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8004c2:	f6 c2 01             	test   $0x1,%dl
+  8004c5:	74 24                	je     8004eb <fd_lookup+0x42>
+  8004c7:	89 c2                	mov    %eax,%edx
+  8004c9:	c1 ea 0c             	shr    $0xc,%edx
+  8004cc:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8004d3:	f6 c2 01             	test   $0x1,%dl
+  8004d6:	74 1a                	je     8004f2 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8004d8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8004db:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8004dd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8004e2:	5d                   	pop    %ebp
+  8004e3:	c3                   	ret
+		return -E_INVAL;
+  8004e4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8004e9:	eb f7                	jmp    8004e2 <fd_lookup+0x39>
+		return -E_INVAL;
+  8004eb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8004f0:	eb f0                	jmp    8004e2 <fd_lookup+0x39>
+  8004f2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8004f7:	eb e9                	jmp    8004e2 <fd_lookup+0x39>
+
+008004f9 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8004f9:	55                   	push   %ebp
+  8004fa:	89 e5                	mov    %esp,%ebp
+  8004fc:	53                   	push   %ebx
+  8004fd:	83 ec 04             	sub    $0x4,%esp
+  800500:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  800503:	b8 00 00 00 00       	mov    $0x0,%eax
+  800508:	eb 03                	jmp    80050d <dev_lookup+0x14>
+  80050a:	83 c0 01             	add    $0x1,%eax
+  80050d:	8b 1c 85 b4 25 80 00 	mov    0x8025b4(,%eax,4),%ebx
+  800514:	85 db                	test   %ebx,%ebx
+  800516:	74 0b                	je     800523 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  800518:	39 13                	cmp    %edx,(%ebx)
+  80051a:	75 ee                	jne    80050a <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  80051c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800521:	eb 1f                	jmp    800542 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800523:	a1 08 40 80 00       	mov    0x804008,%eax
+  800528:	8b 40 48             	mov    0x48(%eax),%eax
+  80052b:	83 ec 04             	sub    $0x4,%esp
+  80052e:	52                   	push   %edx
+  80052f:	50                   	push   %eax
+  800530:	68 38 25 80 00       	push   $0x802538
+  800535:	e8 de 10 00 00       	call   801618 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80053a:	83 c4 10             	add    $0x10,%esp
+  80053d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  800542:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800545:	89 1a                	mov    %ebx,(%edx)
+}
+  800547:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80054a:	c9                   	leave
+  80054b:	c3                   	ret
+
+0080054c <fd_close>:
+{
+  80054c:	55                   	push   %ebp
+  80054d:	89 e5                	mov    %esp,%ebp
+  80054f:	57                   	push   %edi
+  800550:	56                   	push   %esi
+  800551:	53                   	push   %ebx
+  800552:	83 ec 24             	sub    $0x24,%esp
+  800555:	8b 75 08             	mov    0x8(%ebp),%esi
+  800558:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80055b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80055e:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80055f:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800565:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800568:	50                   	push   %eax
+  800569:	e8 3b ff ff ff       	call   8004a9 <fd_lookup>
+  80056e:	89 c3                	mov    %eax,%ebx
+  800570:	83 c4 10             	add    $0x10,%esp
+  800573:	85 c0                	test   %eax,%eax
+  800575:	78 05                	js     80057c <fd_close+0x30>
+	    || fd != fd2)
+  800577:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80057a:	74 16                	je     800592 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80057c:	89 f8                	mov    %edi,%eax
+  80057e:	84 c0                	test   %al,%al
+  800580:	b8 00 00 00 00       	mov    $0x0,%eax
+  800585:	0f 44 d8             	cmove  %eax,%ebx
+}
+  800588:	89 d8                	mov    %ebx,%eax
+  80058a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80058d:	5b                   	pop    %ebx
+  80058e:	5e                   	pop    %esi
+  80058f:	5f                   	pop    %edi
+  800590:	5d                   	pop    %ebp
+  800591:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800592:	83 ec 08             	sub    $0x8,%esp
+  800595:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800598:	50                   	push   %eax
+  800599:	ff 36                	push   (%esi)
+  80059b:	e8 59 ff ff ff       	call   8004f9 <dev_lookup>
+  8005a0:	89 c3                	mov    %eax,%ebx
+  8005a2:	83 c4 10             	add    $0x10,%esp
+  8005a5:	85 c0                	test   %eax,%eax
+  8005a7:	78 1a                	js     8005c3 <fd_close+0x77>
+		if (dev->dev_close)
+  8005a9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005ac:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8005af:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8005b4:	85 c0                	test   %eax,%eax
+  8005b6:	74 0b                	je     8005c3 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8005b8:	83 ec 0c             	sub    $0xc,%esp
+  8005bb:	56                   	push   %esi
+  8005bc:	ff d0                	call   *%eax
+  8005be:	89 c3                	mov    %eax,%ebx
+  8005c0:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8005c3:	83 ec 08             	sub    $0x8,%esp
+  8005c6:	56                   	push   %esi
+  8005c7:	6a 00                	push   $0x0
+  8005c9:	e8 10 fc ff ff       	call   8001de <sys_page_unmap>
+	return r;
+  8005ce:	83 c4 10             	add    $0x10,%esp
+  8005d1:	eb b5                	jmp    800588 <fd_close+0x3c>
+
+008005d3 <close>:
+
+int
+close(int fdnum)
+{
+  8005d3:	55                   	push   %ebp
+  8005d4:	89 e5                	mov    %esp,%ebp
+  8005d6:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8005d9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8005dc:	50                   	push   %eax
+  8005dd:	ff 75 08             	push   0x8(%ebp)
+  8005e0:	e8 c4 fe ff ff       	call   8004a9 <fd_lookup>
+  8005e5:	83 c4 10             	add    $0x10,%esp
+  8005e8:	85 c0                	test   %eax,%eax
+  8005ea:	79 02                	jns    8005ee <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8005ec:	c9                   	leave
+  8005ed:	c3                   	ret
+		return fd_close(fd, 1);
+  8005ee:	83 ec 08             	sub    $0x8,%esp
+  8005f1:	6a 01                	push   $0x1
+  8005f3:	ff 75 f4             	push   -0xc(%ebp)
+  8005f6:	e8 51 ff ff ff       	call   80054c <fd_close>
+  8005fb:	83 c4 10             	add    $0x10,%esp
+  8005fe:	eb ec                	jmp    8005ec <close+0x19>
+
+00800600 <close_all>:
+
+void
+close_all(void)
+{
+  800600:	55                   	push   %ebp
+  800601:	89 e5                	mov    %esp,%ebp
+  800603:	53                   	push   %ebx
+  800604:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  800607:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80060c:	83 ec 0c             	sub    $0xc,%esp
+  80060f:	53                   	push   %ebx
+  800610:	e8 be ff ff ff       	call   8005d3 <close>
+	for (i = 0; i < MAXFD; i++)
+  800615:	83 c3 01             	add    $0x1,%ebx
+  800618:	83 c4 10             	add    $0x10,%esp
+  80061b:	83 fb 20             	cmp    $0x20,%ebx
+  80061e:	75 ec                	jne    80060c <close_all+0xc>
+}
+  800620:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800623:	c9                   	leave
+  800624:	c3                   	ret
+
+00800625 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  800625:	55                   	push   %ebp
+  800626:	89 e5                	mov    %esp,%ebp
+  800628:	57                   	push   %edi
+  800629:	56                   	push   %esi
+  80062a:	53                   	push   %ebx
+  80062b:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80062e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800631:	50                   	push   %eax
+  800632:	ff 75 08             	push   0x8(%ebp)
+  800635:	e8 6f fe ff ff       	call   8004a9 <fd_lookup>
+  80063a:	89 c3                	mov    %eax,%ebx
+  80063c:	83 c4 10             	add    $0x10,%esp
+  80063f:	85 c0                	test   %eax,%eax
+  800641:	78 7f                	js     8006c2 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  800643:	83 ec 0c             	sub    $0xc,%esp
+  800646:	ff 75 0c             	push   0xc(%ebp)
+  800649:	e8 85 ff ff ff       	call   8005d3 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80064e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800651:	c1 e6 0c             	shl    $0xc,%esi
+  800654:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80065a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80065d:	89 3c 24             	mov    %edi,(%esp)
+  800660:	e8 d7 fd ff ff       	call   80043c <fd2data>
+  800665:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  800667:	89 34 24             	mov    %esi,(%esp)
+  80066a:	e8 cd fd ff ff       	call   80043c <fd2data>
+  80066f:	83 c4 10             	add    $0x10,%esp
+  800672:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  800675:	89 d8                	mov    %ebx,%eax
+  800677:	c1 e8 16             	shr    $0x16,%eax
+  80067a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  800681:	a8 01                	test   $0x1,%al
+  800683:	74 11                	je     800696 <dup+0x71>
+  800685:	89 d8                	mov    %ebx,%eax
+  800687:	c1 e8 0c             	shr    $0xc,%eax
+  80068a:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  800691:	f6 c2 01             	test   $0x1,%dl
+  800694:	75 36                	jne    8006cc <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  800696:	89 f8                	mov    %edi,%eax
+  800698:	c1 e8 0c             	shr    $0xc,%eax
+  80069b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8006a2:	83 ec 0c             	sub    $0xc,%esp
+  8006a5:	25 07 0e 00 00       	and    $0xe07,%eax
+  8006aa:	50                   	push   %eax
+  8006ab:	56                   	push   %esi
+  8006ac:	6a 00                	push   $0x0
+  8006ae:	57                   	push   %edi
+  8006af:	6a 00                	push   $0x0
+  8006b1:	e8 e6 fa ff ff       	call   80019c <sys_page_map>
+  8006b6:	89 c3                	mov    %eax,%ebx
+  8006b8:	83 c4 20             	add    $0x20,%esp
+  8006bb:	85 c0                	test   %eax,%eax
+  8006bd:	78 33                	js     8006f2 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8006bf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8006c2:	89 d8                	mov    %ebx,%eax
+  8006c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006c7:	5b                   	pop    %ebx
+  8006c8:	5e                   	pop    %esi
+  8006c9:	5f                   	pop    %edi
+  8006ca:	5d                   	pop    %ebp
+  8006cb:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8006cc:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8006d3:	83 ec 0c             	sub    $0xc,%esp
+  8006d6:	25 07 0e 00 00       	and    $0xe07,%eax
+  8006db:	50                   	push   %eax
+  8006dc:	ff 75 d4             	push   -0x2c(%ebp)
+  8006df:	6a 00                	push   $0x0
+  8006e1:	53                   	push   %ebx
+  8006e2:	6a 00                	push   $0x0
+  8006e4:	e8 b3 fa ff ff       	call   80019c <sys_page_map>
+  8006e9:	89 c3                	mov    %eax,%ebx
+  8006eb:	83 c4 20             	add    $0x20,%esp
+  8006ee:	85 c0                	test   %eax,%eax
+  8006f0:	79 a4                	jns    800696 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8006f2:	83 ec 08             	sub    $0x8,%esp
+  8006f5:	56                   	push   %esi
+  8006f6:	6a 00                	push   $0x0
+  8006f8:	e8 e1 fa ff ff       	call   8001de <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8006fd:	83 c4 08             	add    $0x8,%esp
+  800700:	ff 75 d4             	push   -0x2c(%ebp)
+  800703:	6a 00                	push   $0x0
+  800705:	e8 d4 fa ff ff       	call   8001de <sys_page_unmap>
+	return r;
+  80070a:	83 c4 10             	add    $0x10,%esp
+  80070d:	eb b3                	jmp    8006c2 <dup+0x9d>
+
+0080070f <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80070f:	55                   	push   %ebp
+  800710:	89 e5                	mov    %esp,%ebp
+  800712:	56                   	push   %esi
+  800713:	53                   	push   %ebx
+  800714:	83 ec 18             	sub    $0x18,%esp
+  800717:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80071a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80071d:	50                   	push   %eax
+  80071e:	56                   	push   %esi
+  80071f:	e8 85 fd ff ff       	call   8004a9 <fd_lookup>
+  800724:	83 c4 10             	add    $0x10,%esp
+  800727:	85 c0                	test   %eax,%eax
+  800729:	78 3c                	js     800767 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80072b:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80072e:	83 ec 08             	sub    $0x8,%esp
+  800731:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800734:	50                   	push   %eax
+  800735:	ff 33                	push   (%ebx)
+  800737:	e8 bd fd ff ff       	call   8004f9 <dev_lookup>
+  80073c:	83 c4 10             	add    $0x10,%esp
+  80073f:	85 c0                	test   %eax,%eax
+  800741:	78 24                	js     800767 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800743:	8b 43 08             	mov    0x8(%ebx),%eax
+  800746:	83 e0 03             	and    $0x3,%eax
+  800749:	83 f8 01             	cmp    $0x1,%eax
+  80074c:	74 20                	je     80076e <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80074e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800751:	8b 40 08             	mov    0x8(%eax),%eax
+  800754:	85 c0                	test   %eax,%eax
+  800756:	74 37                	je     80078f <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  800758:	83 ec 04             	sub    $0x4,%esp
+  80075b:	ff 75 10             	push   0x10(%ebp)
+  80075e:	ff 75 0c             	push   0xc(%ebp)
+  800761:	53                   	push   %ebx
+  800762:	ff d0                	call   *%eax
+  800764:	83 c4 10             	add    $0x10,%esp
+}
+  800767:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80076a:	5b                   	pop    %ebx
+  80076b:	5e                   	pop    %esi
+  80076c:	5d                   	pop    %ebp
+  80076d:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80076e:	a1 08 40 80 00       	mov    0x804008,%eax
+  800773:	8b 40 48             	mov    0x48(%eax),%eax
+  800776:	83 ec 04             	sub    $0x4,%esp
+  800779:	56                   	push   %esi
+  80077a:	50                   	push   %eax
+  80077b:	68 79 25 80 00       	push   $0x802579
+  800780:	e8 93 0e 00 00       	call   801618 <cprintf>
+		return -E_INVAL;
+  800785:	83 c4 10             	add    $0x10,%esp
+  800788:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80078d:	eb d8                	jmp    800767 <read+0x58>
+		return -E_NOT_SUPP;
+  80078f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800794:	eb d1                	jmp    800767 <read+0x58>
+
+00800796 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  800796:	55                   	push   %ebp
+  800797:	89 e5                	mov    %esp,%ebp
+  800799:	57                   	push   %edi
+  80079a:	56                   	push   %esi
+  80079b:	53                   	push   %ebx
+  80079c:	83 ec 0c             	sub    $0xc,%esp
+  80079f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8007a2:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8007a5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8007aa:	eb 02                	jmp    8007ae <readn+0x18>
+  8007ac:	01 c3                	add    %eax,%ebx
+  8007ae:	39 f3                	cmp    %esi,%ebx
+  8007b0:	73 21                	jae    8007d3 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8007b2:	83 ec 04             	sub    $0x4,%esp
+  8007b5:	89 f0                	mov    %esi,%eax
+  8007b7:	29 d8                	sub    %ebx,%eax
+  8007b9:	50                   	push   %eax
+  8007ba:	89 d8                	mov    %ebx,%eax
+  8007bc:	03 45 0c             	add    0xc(%ebp),%eax
+  8007bf:	50                   	push   %eax
+  8007c0:	57                   	push   %edi
+  8007c1:	e8 49 ff ff ff       	call   80070f <read>
+		if (m < 0)
+  8007c6:	83 c4 10             	add    $0x10,%esp
+  8007c9:	85 c0                	test   %eax,%eax
+  8007cb:	78 04                	js     8007d1 <readn+0x3b>
+			return m;
+		if (m == 0)
+  8007cd:	75 dd                	jne    8007ac <readn+0x16>
+  8007cf:	eb 02                	jmp    8007d3 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8007d1:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8007d3:	89 d8                	mov    %ebx,%eax
+  8007d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007d8:	5b                   	pop    %ebx
+  8007d9:	5e                   	pop    %esi
+  8007da:	5f                   	pop    %edi
+  8007db:	5d                   	pop    %ebp
+  8007dc:	c3                   	ret
+
+008007dd <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8007dd:	55                   	push   %ebp
+  8007de:	89 e5                	mov    %esp,%ebp
+  8007e0:	56                   	push   %esi
+  8007e1:	53                   	push   %ebx
+  8007e2:	83 ec 18             	sub    $0x18,%esp
+  8007e5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8007e8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8007eb:	50                   	push   %eax
+  8007ec:	53                   	push   %ebx
+  8007ed:	e8 b7 fc ff ff       	call   8004a9 <fd_lookup>
+  8007f2:	83 c4 10             	add    $0x10,%esp
+  8007f5:	85 c0                	test   %eax,%eax
+  8007f7:	78 37                	js     800830 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8007f9:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8007fc:	83 ec 08             	sub    $0x8,%esp
+  8007ff:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800802:	50                   	push   %eax
+  800803:	ff 36                	push   (%esi)
+  800805:	e8 ef fc ff ff       	call   8004f9 <dev_lookup>
+  80080a:	83 c4 10             	add    $0x10,%esp
+  80080d:	85 c0                	test   %eax,%eax
+  80080f:	78 1f                	js     800830 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800811:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800815:	74 20                	je     800837 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  800817:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80081a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80081d:	85 c0                	test   %eax,%eax
+  80081f:	74 37                	je     800858 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  800821:	83 ec 04             	sub    $0x4,%esp
+  800824:	ff 75 10             	push   0x10(%ebp)
+  800827:	ff 75 0c             	push   0xc(%ebp)
+  80082a:	56                   	push   %esi
+  80082b:	ff d0                	call   *%eax
+  80082d:	83 c4 10             	add    $0x10,%esp
+}
+  800830:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800833:	5b                   	pop    %ebx
+  800834:	5e                   	pop    %esi
+  800835:	5d                   	pop    %ebp
+  800836:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800837:	a1 08 40 80 00       	mov    0x804008,%eax
+  80083c:	8b 40 48             	mov    0x48(%eax),%eax
+  80083f:	83 ec 04             	sub    $0x4,%esp
+  800842:	53                   	push   %ebx
+  800843:	50                   	push   %eax
+  800844:	68 95 25 80 00       	push   $0x802595
+  800849:	e8 ca 0d 00 00       	call   801618 <cprintf>
+		return -E_INVAL;
+  80084e:	83 c4 10             	add    $0x10,%esp
+  800851:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800856:	eb d8                	jmp    800830 <write+0x53>
+		return -E_NOT_SUPP;
+  800858:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80085d:	eb d1                	jmp    800830 <write+0x53>
+
+0080085f <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80085f:	55                   	push   %ebp
+  800860:	89 e5                	mov    %esp,%ebp
+  800862:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800865:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800868:	50                   	push   %eax
+  800869:	ff 75 08             	push   0x8(%ebp)
+  80086c:	e8 38 fc ff ff       	call   8004a9 <fd_lookup>
+  800871:	83 c4 10             	add    $0x10,%esp
+  800874:	85 c0                	test   %eax,%eax
+  800876:	78 0e                	js     800886 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  800878:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80087b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80087e:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	c9                   	leave
+  800887:	c3                   	ret
+
+00800888 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800888:	55                   	push   %ebp
+  800889:	89 e5                	mov    %esp,%ebp
+  80088b:	56                   	push   %esi
+  80088c:	53                   	push   %ebx
+  80088d:	83 ec 18             	sub    $0x18,%esp
+  800890:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800893:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800896:	50                   	push   %eax
+  800897:	53                   	push   %ebx
+  800898:	e8 0c fc ff ff       	call   8004a9 <fd_lookup>
+  80089d:	83 c4 10             	add    $0x10,%esp
+  8008a0:	85 c0                	test   %eax,%eax
+  8008a2:	78 34                	js     8008d8 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8008a4:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8008a7:	83 ec 08             	sub    $0x8,%esp
+  8008aa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8008ad:	50                   	push   %eax
+  8008ae:	ff 36                	push   (%esi)
+  8008b0:	e8 44 fc ff ff       	call   8004f9 <dev_lookup>
+  8008b5:	83 c4 10             	add    $0x10,%esp
+  8008b8:	85 c0                	test   %eax,%eax
+  8008ba:	78 1c                	js     8008d8 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8008bc:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8008c0:	74 1d                	je     8008df <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8008c2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008c5:	8b 40 18             	mov    0x18(%eax),%eax
+  8008c8:	85 c0                	test   %eax,%eax
+  8008ca:	74 34                	je     800900 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8008cc:	83 ec 08             	sub    $0x8,%esp
+  8008cf:	ff 75 0c             	push   0xc(%ebp)
+  8008d2:	56                   	push   %esi
+  8008d3:	ff d0                	call   *%eax
+  8008d5:	83 c4 10             	add    $0x10,%esp
+}
+  8008d8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8008db:	5b                   	pop    %ebx
+  8008dc:	5e                   	pop    %esi
+  8008dd:	5d                   	pop    %ebp
+  8008de:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8008df:	a1 08 40 80 00       	mov    0x804008,%eax
+  8008e4:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8008e7:	83 ec 04             	sub    $0x4,%esp
+  8008ea:	53                   	push   %ebx
+  8008eb:	50                   	push   %eax
+  8008ec:	68 58 25 80 00       	push   $0x802558
+  8008f1:	e8 22 0d 00 00       	call   801618 <cprintf>
+		return -E_INVAL;
+  8008f6:	83 c4 10             	add    $0x10,%esp
+  8008f9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008fe:	eb d8                	jmp    8008d8 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  800900:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800905:	eb d1                	jmp    8008d8 <ftruncate+0x50>
+
+00800907 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800907:	55                   	push   %ebp
+  800908:	89 e5                	mov    %esp,%ebp
+  80090a:	56                   	push   %esi
+  80090b:	53                   	push   %ebx
+  80090c:	83 ec 18             	sub    $0x18,%esp
+  80090f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800912:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800915:	50                   	push   %eax
+  800916:	ff 75 08             	push   0x8(%ebp)
+  800919:	e8 8b fb ff ff       	call   8004a9 <fd_lookup>
+  80091e:	83 c4 10             	add    $0x10,%esp
+  800921:	85 c0                	test   %eax,%eax
+  800923:	78 49                	js     80096e <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800925:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800928:	83 ec 08             	sub    $0x8,%esp
+  80092b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80092e:	50                   	push   %eax
+  80092f:	ff 36                	push   (%esi)
+  800931:	e8 c3 fb ff ff       	call   8004f9 <dev_lookup>
+  800936:	83 c4 10             	add    $0x10,%esp
+  800939:	85 c0                	test   %eax,%eax
+  80093b:	78 31                	js     80096e <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  80093d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800940:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800944:	74 2f                	je     800975 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  800946:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  800949:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800950:	00 00 00 
+	stat->st_isdir = 0;
+  800953:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80095a:	00 00 00 
+	stat->st_dev = dev;
+  80095d:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  800963:	83 ec 08             	sub    $0x8,%esp
+  800966:	53                   	push   %ebx
+  800967:	56                   	push   %esi
+  800968:	ff 50 14             	call   *0x14(%eax)
+  80096b:	83 c4 10             	add    $0x10,%esp
+}
+  80096e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800971:	5b                   	pop    %ebx
+  800972:	5e                   	pop    %esi
+  800973:	5d                   	pop    %ebp
+  800974:	c3                   	ret
+		return -E_NOT_SUPP;
+  800975:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80097a:	eb f2                	jmp    80096e <fstat+0x67>
+
+0080097c <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80097c:	55                   	push   %ebp
+  80097d:	89 e5                	mov    %esp,%ebp
+  80097f:	56                   	push   %esi
+  800980:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  800981:	83 ec 08             	sub    $0x8,%esp
+  800984:	6a 00                	push   $0x0
+  800986:	ff 75 08             	push   0x8(%ebp)
+  800989:	e8 e4 01 00 00       	call   800b72 <open>
+  80098e:	89 c3                	mov    %eax,%ebx
+  800990:	83 c4 10             	add    $0x10,%esp
+  800993:	85 c0                	test   %eax,%eax
+  800995:	78 1b                	js     8009b2 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  800997:	83 ec 08             	sub    $0x8,%esp
+  80099a:	ff 75 0c             	push   0xc(%ebp)
+  80099d:	50                   	push   %eax
+  80099e:	e8 64 ff ff ff       	call   800907 <fstat>
+  8009a3:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8009a5:	89 1c 24             	mov    %ebx,(%esp)
+  8009a8:	e8 26 fc ff ff       	call   8005d3 <close>
+	return r;
+  8009ad:	83 c4 10             	add    $0x10,%esp
+  8009b0:	89 f3                	mov    %esi,%ebx
+}
+  8009b2:	89 d8                	mov    %ebx,%eax
+  8009b4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8009b7:	5b                   	pop    %ebx
+  8009b8:	5e                   	pop    %esi
+  8009b9:	5d                   	pop    %ebp
+  8009ba:	c3                   	ret
+
+008009bb <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  8009bb:	55                   	push   %ebp
+  8009bc:	89 e5                	mov    %esp,%ebp
+  8009be:	56                   	push   %esi
+  8009bf:	53                   	push   %ebx
+  8009c0:	89 c6                	mov    %eax,%esi
+  8009c2:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  8009c4:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  8009cb:	74 27                	je     8009f4 <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8009cd:	6a 07                	push   $0x7
+  8009cf:	68 00 50 80 00       	push   $0x805000
+  8009d4:	56                   	push   %esi
+  8009d5:	ff 35 00 40 80 00    	push   0x804000
+  8009db:	e8 95 15 00 00       	call   801f75 <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  8009e0:	83 c4 0c             	add    $0xc,%esp
+  8009e3:	6a 00                	push   $0x0
+  8009e5:	53                   	push   %ebx
+  8009e6:	6a 00                	push   $0x0
+  8009e8:	e8 14 15 00 00       	call   801f01 <ipc_recv>
+}
+  8009ed:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8009f0:	5b                   	pop    %ebx
+  8009f1:	5e                   	pop    %esi
+  8009f2:	5d                   	pop    %ebp
+  8009f3:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  8009f4:	83 ec 0c             	sub    $0xc,%esp
+  8009f7:	6a 01                	push   $0x1
+  8009f9:	e8 cb 15 00 00       	call   801fc9 <ipc_find_env>
+  8009fe:	a3 00 40 80 00       	mov    %eax,0x804000
+  800a03:	83 c4 10             	add    $0x10,%esp
+  800a06:	eb c5                	jmp    8009cd <fsipc+0x12>
+
+00800a08 <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  800a08:	55                   	push   %ebp
+  800a09:	89 e5                	mov    %esp,%ebp
+  800a0b:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800a0e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a11:	8b 40 0c             	mov    0xc(%eax),%eax
+  800a14:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.set_size.req_size = newsize;
+  800a19:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a1c:	a3 04 50 80 00       	mov    %eax,0x805004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  800a21:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a26:	b8 02 00 00 00       	mov    $0x2,%eax
+  800a2b:	e8 8b ff ff ff       	call   8009bb <fsipc>
+}
+  800a30:	c9                   	leave
+  800a31:	c3                   	ret
+
+00800a32 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  800a32:	55                   	push   %ebp
+  800a33:	89 e5                	mov    %esp,%ebp
+  800a35:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800a38:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a3b:	8b 40 0c             	mov    0xc(%eax),%eax
+  800a3e:	a3 00 50 80 00       	mov    %eax,0x805000
+  return fsipc(FSREQ_FLUSH, NULL);
+  800a43:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a48:	b8 06 00 00 00       	mov    $0x6,%eax
+  800a4d:	e8 69 ff ff ff       	call   8009bb <fsipc>
+}
+  800a52:	c9                   	leave
+  800a53:	c3                   	ret
+
+00800a54 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  800a54:	55                   	push   %ebp
+  800a55:	89 e5                	mov    %esp,%ebp
+  800a57:	53                   	push   %ebx
+  800a58:	83 ec 04             	sub    $0x4,%esp
+  800a5b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800a5e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a61:	8b 40 0c             	mov    0xc(%eax),%eax
+  800a64:	a3 00 50 80 00       	mov    %eax,0x805000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  800a69:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a6e:	b8 05 00 00 00       	mov    $0x5,%eax
+  800a73:	e8 43 ff ff ff       	call   8009bb <fsipc>
+  800a78:	85 c0                	test   %eax,%eax
+  800a7a:	78 2c                	js     800aa8 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800a7c:	83 ec 08             	sub    $0x8,%esp
+  800a7f:	68 00 50 80 00       	push   $0x805000
+  800a84:	53                   	push   %ebx
+  800a85:	e8 47 11 00 00       	call   801bd1 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  800a8a:	a1 80 50 80 00       	mov    0x805080,%eax
+  800a8f:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800a95:	a1 84 50 80 00       	mov    0x805084,%eax
+  800a9a:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  800aa0:	83 c4 10             	add    $0x10,%esp
+  800aa3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800aa8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800aab:	c9                   	leave
+  800aac:	c3                   	ret
+
+00800aad <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  800aad:	55                   	push   %ebp
+  800aae:	89 e5                	mov    %esp,%ebp
+  800ab0:	83 ec 0c             	sub    $0xc,%esp
+  800ab3:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800ab6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ab9:	8b 52 0c             	mov    0xc(%edx),%edx
+  800abc:	89 15 00 50 80 00    	mov    %edx,0x805000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  800ac2:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  800ac7:	39 d0                	cmp    %edx,%eax
+  800ac9:	0f 47 c2             	cmova  %edx,%eax
+  800acc:	a3 04 50 80 00       	mov    %eax,0x805004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  800ad1:	50                   	push   %eax
+  800ad2:	ff 75 0c             	push   0xc(%ebp)
+  800ad5:	68 08 50 80 00       	push   $0x805008
+  800ada:	e8 78 12 00 00       	call   801d57 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  800adf:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ae4:	b8 04 00 00 00       	mov    $0x4,%eax
+  800ae9:	e8 cd fe ff ff       	call   8009bb <fsipc>
+}
+  800aee:	c9                   	leave
+  800aef:	c3                   	ret
+
+00800af0 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  800af0:	55                   	push   %ebp
+  800af1:	89 e5                	mov    %esp,%ebp
+  800af3:	56                   	push   %esi
+  800af4:	53                   	push   %ebx
+  800af5:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800af8:	8b 45 08             	mov    0x8(%ebp),%eax
+  800afb:	8b 40 0c             	mov    0xc(%eax),%eax
+  800afe:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.read.req_n = n;
+  800b03:	89 35 04 50 80 00    	mov    %esi,0x805004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  800b09:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b0e:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b13:	e8 a3 fe ff ff       	call   8009bb <fsipc>
+  800b18:	89 c3                	mov    %eax,%ebx
+  800b1a:	85 c0                	test   %eax,%eax
+  800b1c:	78 1f                	js     800b3d <devfile_read+0x4d>
+  assert(r <= n);
+  800b1e:	39 c6                	cmp    %eax,%esi
+  800b20:	72 24                	jb     800b46 <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  800b22:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800b27:	7f 33                	jg     800b5c <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  800b29:	83 ec 04             	sub    $0x4,%esp
+  800b2c:	50                   	push   %eax
+  800b2d:	68 00 50 80 00       	push   $0x805000
+  800b32:	ff 75 0c             	push   0xc(%ebp)
+  800b35:	e8 1d 12 00 00       	call   801d57 <memmove>
+  return r;
+  800b3a:	83 c4 10             	add    $0x10,%esp
+}
+  800b3d:	89 d8                	mov    %ebx,%eax
+  800b3f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b42:	5b                   	pop    %ebx
+  800b43:	5e                   	pop    %esi
+  800b44:	5d                   	pop    %ebp
+  800b45:	c3                   	ret
+  assert(r <= n);
+  800b46:	68 c8 25 80 00       	push   $0x8025c8
+  800b4b:	68 cf 25 80 00       	push   $0x8025cf
+  800b50:	6a 78                	push   $0x78
+  800b52:	68 e4 25 80 00       	push   $0x8025e4
+  800b57:	e8 e1 09 00 00       	call   80153d <_panic>
+  assert(r <= PGSIZE);
+  800b5c:	68 ef 25 80 00       	push   $0x8025ef
+  800b61:	68 cf 25 80 00       	push   $0x8025cf
+  800b66:	6a 79                	push   $0x79
+  800b68:	68 e4 25 80 00       	push   $0x8025e4
+  800b6d:	e8 cb 09 00 00       	call   80153d <_panic>
+
+00800b72 <open>:
+open(const char *path, int mode) {
+  800b72:	55                   	push   %ebp
+  800b73:	89 e5                	mov    %esp,%ebp
+  800b75:	56                   	push   %esi
+  800b76:	53                   	push   %ebx
+  800b77:	83 ec 1c             	sub    $0x1c,%esp
+  800b7a:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  800b7d:	56                   	push   %esi
+  800b7e:	e8 13 10 00 00       	call   801b96 <strlen>
+  800b83:	83 c4 10             	add    $0x10,%esp
+  800b86:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800b8b:	7f 6c                	jg     800bf9 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  800b8d:	83 ec 0c             	sub    $0xc,%esp
+  800b90:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b93:	50                   	push   %eax
+  800b94:	e8 ba f8 ff ff       	call   800453 <fd_alloc>
+  800b99:	89 c3                	mov    %eax,%ebx
+  800b9b:	83 c4 10             	add    $0x10,%esp
+  800b9e:	85 c0                	test   %eax,%eax
+  800ba0:	78 3c                	js     800bde <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  800ba2:	83 ec 08             	sub    $0x8,%esp
+  800ba5:	56                   	push   %esi
+  800ba6:	68 00 50 80 00       	push   $0x805000
+  800bab:	e8 21 10 00 00       	call   801bd1 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  800bb0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bb3:	a3 00 54 80 00       	mov    %eax,0x805400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  800bb8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  800bbb:	b8 01 00 00 00       	mov    $0x1,%eax
+  800bc0:	e8 f6 fd ff ff       	call   8009bb <fsipc>
+  800bc5:	89 c3                	mov    %eax,%ebx
+  800bc7:	83 c4 10             	add    $0x10,%esp
+  800bca:	85 c0                	test   %eax,%eax
+  800bcc:	78 19                	js     800be7 <open+0x75>
+  return fd2num(fd);
+  800bce:	83 ec 0c             	sub    $0xc,%esp
+  800bd1:	ff 75 f4             	push   -0xc(%ebp)
+  800bd4:	e8 53 f8 ff ff       	call   80042c <fd2num>
+  800bd9:	89 c3                	mov    %eax,%ebx
+  800bdb:	83 c4 10             	add    $0x10,%esp
+}
+  800bde:	89 d8                	mov    %ebx,%eax
+  800be0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800be3:	5b                   	pop    %ebx
+  800be4:	5e                   	pop    %esi
+  800be5:	5d                   	pop    %ebp
+  800be6:	c3                   	ret
+    fd_close(fd, 0);
+  800be7:	83 ec 08             	sub    $0x8,%esp
+  800bea:	6a 00                	push   $0x0
+  800bec:	ff 75 f4             	push   -0xc(%ebp)
+  800bef:	e8 58 f9 ff ff       	call   80054c <fd_close>
+    return r;
+  800bf4:	83 c4 10             	add    $0x10,%esp
+  800bf7:	eb e5                	jmp    800bde <open+0x6c>
+    return -E_BAD_PATH;
+  800bf9:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  800bfe:	eb de                	jmp    800bde <open+0x6c>
+
+00800c00 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  800c00:	55                   	push   %ebp
+  800c01:	89 e5                	mov    %esp,%ebp
+  800c03:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  800c06:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c0b:	b8 08 00 00 00       	mov    $0x8,%eax
+  800c10:	e8 a6 fd ff ff       	call   8009bb <fsipc>
+}
+  800c15:	c9                   	leave
+  800c16:	c3                   	ret
+
+00800c17 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  800c17:	55                   	push   %ebp
+  800c18:	89 e5                	mov    %esp,%ebp
+  800c1a:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  800c1d:	68 fb 25 80 00       	push   $0x8025fb
+  800c22:	ff 75 0c             	push   0xc(%ebp)
+  800c25:	e8 a7 0f 00 00       	call   801bd1 <strcpy>
+	return 0;
+}
+  800c2a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c2f:	c9                   	leave
+  800c30:	c3                   	ret
+
+00800c31 <devsock_close>:
+{
+  800c31:	55                   	push   %ebp
+  800c32:	89 e5                	mov    %esp,%ebp
+  800c34:	53                   	push   %ebx
+  800c35:	83 ec 10             	sub    $0x10,%esp
+  800c38:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  800c3b:	53                   	push   %ebx
+  800c3c:	e8 c7 13 00 00       	call   802008 <pageref>
+  800c41:	89 c2                	mov    %eax,%edx
+  800c43:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  800c46:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  800c4b:	83 fa 01             	cmp    $0x1,%edx
+  800c4e:	74 05                	je     800c55 <devsock_close+0x24>
+}
+  800c50:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c53:	c9                   	leave
+  800c54:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  800c55:	83 ec 0c             	sub    $0xc,%esp
+  800c58:	ff 73 0c             	push   0xc(%ebx)
+  800c5b:	e8 b7 02 00 00       	call   800f17 <nsipc_close>
+  800c60:	83 c4 10             	add    $0x10,%esp
+  800c63:	eb eb                	jmp    800c50 <devsock_close+0x1f>
+
+00800c65 <devsock_write>:
+{
+  800c65:	55                   	push   %ebp
+  800c66:	89 e5                	mov    %esp,%ebp
+  800c68:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  800c6b:	6a 00                	push   $0x0
+  800c6d:	ff 75 10             	push   0x10(%ebp)
+  800c70:	ff 75 0c             	push   0xc(%ebp)
+  800c73:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c76:	ff 70 0c             	push   0xc(%eax)
+  800c79:	e8 79 03 00 00       	call   800ff7 <nsipc_send>
+}
+  800c7e:	c9                   	leave
+  800c7f:	c3                   	ret
+
+00800c80 <devsock_read>:
+{
+  800c80:	55                   	push   %ebp
+  800c81:	89 e5                	mov    %esp,%ebp
+  800c83:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  800c86:	6a 00                	push   $0x0
+  800c88:	ff 75 10             	push   0x10(%ebp)
+  800c8b:	ff 75 0c             	push   0xc(%ebp)
+  800c8e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c91:	ff 70 0c             	push   0xc(%eax)
+  800c94:	e8 ef 02 00 00       	call   800f88 <nsipc_recv>
+}
+  800c99:	c9                   	leave
+  800c9a:	c3                   	ret
+
+00800c9b <fd2sockid>:
+{
+  800c9b:	55                   	push   %ebp
+  800c9c:	89 e5                	mov    %esp,%ebp
+  800c9e:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  800ca1:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  800ca4:	52                   	push   %edx
+  800ca5:	50                   	push   %eax
+  800ca6:	e8 fe f7 ff ff       	call   8004a9 <fd_lookup>
+  800cab:	83 c4 10             	add    $0x10,%esp
+  800cae:	85 c0                	test   %eax,%eax
+  800cb0:	78 10                	js     800cc2 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  800cb2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800cb5:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  800cbb:	39 08                	cmp    %ecx,(%eax)
+  800cbd:	75 05                	jne    800cc4 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  800cbf:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  800cc2:	c9                   	leave
+  800cc3:	c3                   	ret
+		return -E_NOT_SUPP;
+  800cc4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800cc9:	eb f7                	jmp    800cc2 <fd2sockid+0x27>
+
+00800ccb <alloc_sockfd>:
+{
+  800ccb:	55                   	push   %ebp
+  800ccc:	89 e5                	mov    %esp,%ebp
+  800cce:	56                   	push   %esi
+  800ccf:	53                   	push   %ebx
+  800cd0:	83 ec 1c             	sub    $0x1c,%esp
+  800cd3:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  800cd5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800cd8:	50                   	push   %eax
+  800cd9:	e8 75 f7 ff ff       	call   800453 <fd_alloc>
+  800cde:	89 c3                	mov    %eax,%ebx
+  800ce0:	83 c4 10             	add    $0x10,%esp
+  800ce3:	85 c0                	test   %eax,%eax
+  800ce5:	78 43                	js     800d2a <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  800ce7:	83 ec 04             	sub    $0x4,%esp
+  800cea:	68 07 04 00 00       	push   $0x407
+  800cef:	ff 75 f4             	push   -0xc(%ebp)
+  800cf2:	6a 00                	push   $0x0
+  800cf4:	e8 60 f4 ff ff       	call   800159 <sys_page_alloc>
+  800cf9:	89 c3                	mov    %eax,%ebx
+  800cfb:	83 c4 10             	add    $0x10,%esp
+  800cfe:	85 c0                	test   %eax,%eax
+  800d00:	78 28                	js     800d2a <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  800d02:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800d05:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  800d0b:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  800d0d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800d10:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  800d17:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  800d1a:	83 ec 0c             	sub    $0xc,%esp
+  800d1d:	50                   	push   %eax
+  800d1e:	e8 09 f7 ff ff       	call   80042c <fd2num>
+  800d23:	89 c3                	mov    %eax,%ebx
+  800d25:	83 c4 10             	add    $0x10,%esp
+  800d28:	eb 0c                	jmp    800d36 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  800d2a:	83 ec 0c             	sub    $0xc,%esp
+  800d2d:	56                   	push   %esi
+  800d2e:	e8 e4 01 00 00       	call   800f17 <nsipc_close>
+		return r;
+  800d33:	83 c4 10             	add    $0x10,%esp
+}
+  800d36:	89 d8                	mov    %ebx,%eax
+  800d38:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d3b:	5b                   	pop    %ebx
+  800d3c:	5e                   	pop    %esi
+  800d3d:	5d                   	pop    %ebp
+  800d3e:	c3                   	ret
+
+00800d3f <accept>:
+{
+  800d3f:	55                   	push   %ebp
+  800d40:	89 e5                	mov    %esp,%ebp
+  800d42:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800d45:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d48:	e8 4e ff ff ff       	call   800c9b <fd2sockid>
+  800d4d:	85 c0                	test   %eax,%eax
+  800d4f:	78 1b                	js     800d6c <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  800d51:	83 ec 04             	sub    $0x4,%esp
+  800d54:	ff 75 10             	push   0x10(%ebp)
+  800d57:	ff 75 0c             	push   0xc(%ebp)
+  800d5a:	50                   	push   %eax
+  800d5b:	e8 0e 01 00 00       	call   800e6e <nsipc_accept>
+  800d60:	83 c4 10             	add    $0x10,%esp
+  800d63:	85 c0                	test   %eax,%eax
+  800d65:	78 05                	js     800d6c <accept+0x2d>
+	return alloc_sockfd(r);
+  800d67:	e8 5f ff ff ff       	call   800ccb <alloc_sockfd>
+}
+  800d6c:	c9                   	leave
+  800d6d:	c3                   	ret
+
+00800d6e <bind>:
+{
+  800d6e:	55                   	push   %ebp
+  800d6f:	89 e5                	mov    %esp,%ebp
+  800d71:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800d74:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d77:	e8 1f ff ff ff       	call   800c9b <fd2sockid>
+  800d7c:	85 c0                	test   %eax,%eax
+  800d7e:	78 12                	js     800d92 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  800d80:	83 ec 04             	sub    $0x4,%esp
+  800d83:	ff 75 10             	push   0x10(%ebp)
+  800d86:	ff 75 0c             	push   0xc(%ebp)
+  800d89:	50                   	push   %eax
+  800d8a:	e8 31 01 00 00       	call   800ec0 <nsipc_bind>
+  800d8f:	83 c4 10             	add    $0x10,%esp
+}
+  800d92:	c9                   	leave
+  800d93:	c3                   	ret
+
+00800d94 <shutdown>:
+{
+  800d94:	55                   	push   %ebp
+  800d95:	89 e5                	mov    %esp,%ebp
+  800d97:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800d9a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d9d:	e8 f9 fe ff ff       	call   800c9b <fd2sockid>
+  800da2:	85 c0                	test   %eax,%eax
+  800da4:	78 0f                	js     800db5 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  800da6:	83 ec 08             	sub    $0x8,%esp
+  800da9:	ff 75 0c             	push   0xc(%ebp)
+  800dac:	50                   	push   %eax
+  800dad:	e8 43 01 00 00       	call   800ef5 <nsipc_shutdown>
+  800db2:	83 c4 10             	add    $0x10,%esp
+}
+  800db5:	c9                   	leave
+  800db6:	c3                   	ret
+
+00800db7 <connect>:
+{
+  800db7:	55                   	push   %ebp
+  800db8:	89 e5                	mov    %esp,%ebp
+  800dba:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800dbd:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dc0:	e8 d6 fe ff ff       	call   800c9b <fd2sockid>
+  800dc5:	85 c0                	test   %eax,%eax
+  800dc7:	78 12                	js     800ddb <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  800dc9:	83 ec 04             	sub    $0x4,%esp
+  800dcc:	ff 75 10             	push   0x10(%ebp)
+  800dcf:	ff 75 0c             	push   0xc(%ebp)
+  800dd2:	50                   	push   %eax
+  800dd3:	e8 59 01 00 00       	call   800f31 <nsipc_connect>
+  800dd8:	83 c4 10             	add    $0x10,%esp
+}
+  800ddb:	c9                   	leave
+  800ddc:	c3                   	ret
+
+00800ddd <listen>:
+{
+  800ddd:	55                   	push   %ebp
+  800dde:	89 e5                	mov    %esp,%ebp
+  800de0:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800de3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800de6:	e8 b0 fe ff ff       	call   800c9b <fd2sockid>
+  800deb:	85 c0                	test   %eax,%eax
+  800ded:	78 0f                	js     800dfe <listen+0x21>
+	return nsipc_listen(r, backlog);
+  800def:	83 ec 08             	sub    $0x8,%esp
+  800df2:	ff 75 0c             	push   0xc(%ebp)
+  800df5:	50                   	push   %eax
+  800df6:	e8 6b 01 00 00       	call   800f66 <nsipc_listen>
+  800dfb:	83 c4 10             	add    $0x10,%esp
+}
+  800dfe:	c9                   	leave
+  800dff:	c3                   	ret
+
+00800e00 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  800e00:	55                   	push   %ebp
+  800e01:	89 e5                	mov    %esp,%ebp
+  800e03:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  800e06:	ff 75 10             	push   0x10(%ebp)
+  800e09:	ff 75 0c             	push   0xc(%ebp)
+  800e0c:	ff 75 08             	push   0x8(%ebp)
+  800e0f:	e8 41 02 00 00       	call   801055 <nsipc_socket>
+  800e14:	83 c4 10             	add    $0x10,%esp
+  800e17:	85 c0                	test   %eax,%eax
+  800e19:	78 05                	js     800e20 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  800e1b:	e8 ab fe ff ff       	call   800ccb <alloc_sockfd>
+}
+  800e20:	c9                   	leave
+  800e21:	c3                   	ret
+
+00800e22 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  800e22:	55                   	push   %ebp
+  800e23:	89 e5                	mov    %esp,%ebp
+  800e25:	53                   	push   %ebx
+  800e26:	83 ec 04             	sub    $0x4,%esp
+  800e29:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  800e2b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800e32:	74 26                	je     800e5a <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  800e34:	6a 07                	push   $0x7
+  800e36:	68 00 60 80 00       	push   $0x806000
+  800e3b:	53                   	push   %ebx
+  800e3c:	ff 35 04 40 80 00    	push   0x804004
+  800e42:	e8 2e 11 00 00       	call   801f75 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  800e47:	83 c4 0c             	add    $0xc,%esp
+  800e4a:	6a 00                	push   $0x0
+  800e4c:	6a 00                	push   $0x0
+  800e4e:	6a 00                	push   $0x0
+  800e50:	e8 ac 10 00 00       	call   801f01 <ipc_recv>
+}
+  800e55:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e58:	c9                   	leave
+  800e59:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  800e5a:	83 ec 0c             	sub    $0xc,%esp
+  800e5d:	6a 02                	push   $0x2
+  800e5f:	e8 65 11 00 00       	call   801fc9 <ipc_find_env>
+  800e64:	a3 04 40 80 00       	mov    %eax,0x804004
+  800e69:	83 c4 10             	add    $0x10,%esp
+  800e6c:	eb c6                	jmp    800e34 <nsipc+0x12>
+
+00800e6e <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  800e6e:	55                   	push   %ebp
+  800e6f:	89 e5                	mov    %esp,%ebp
+  800e71:	56                   	push   %esi
+  800e72:	53                   	push   %ebx
+  800e73:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  800e76:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e79:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  800e7e:	8b 06                	mov    (%esi),%eax
+  800e80:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  800e85:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e8a:	e8 93 ff ff ff       	call   800e22 <nsipc>
+  800e8f:	89 c3                	mov    %eax,%ebx
+  800e91:	85 c0                	test   %eax,%eax
+  800e93:	79 09                	jns    800e9e <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  800e95:	89 d8                	mov    %ebx,%eax
+  800e97:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e9a:	5b                   	pop    %ebx
+  800e9b:	5e                   	pop    %esi
+  800e9c:	5d                   	pop    %ebp
+  800e9d:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  800e9e:	83 ec 04             	sub    $0x4,%esp
+  800ea1:	ff 35 10 60 80 00    	push   0x806010
+  800ea7:	68 00 60 80 00       	push   $0x806000
+  800eac:	ff 75 0c             	push   0xc(%ebp)
+  800eaf:	e8 a3 0e 00 00       	call   801d57 <memmove>
+		*addrlen = ret->ret_addrlen;
+  800eb4:	a1 10 60 80 00       	mov    0x806010,%eax
+  800eb9:	89 06                	mov    %eax,(%esi)
+  800ebb:	83 c4 10             	add    $0x10,%esp
+	return r;
+  800ebe:	eb d5                	jmp    800e95 <nsipc_accept+0x27>
+
+00800ec0 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  800ec0:	55                   	push   %ebp
+  800ec1:	89 e5                	mov    %esp,%ebp
+  800ec3:	53                   	push   %ebx
+  800ec4:	83 ec 08             	sub    $0x8,%esp
+  800ec7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  800eca:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ecd:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  800ed2:	53                   	push   %ebx
+  800ed3:	ff 75 0c             	push   0xc(%ebp)
+  800ed6:	68 04 60 80 00       	push   $0x806004
+  800edb:	e8 77 0e 00 00       	call   801d57 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  800ee0:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  800ee6:	b8 02 00 00 00       	mov    $0x2,%eax
+  800eeb:	e8 32 ff ff ff       	call   800e22 <nsipc>
+}
+  800ef0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ef3:	c9                   	leave
+  800ef4:	c3                   	ret
+
+00800ef5 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  800ef5:	55                   	push   %ebp
+  800ef6:	89 e5                	mov    %esp,%ebp
+  800ef8:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  800efb:	8b 45 08             	mov    0x8(%ebp),%eax
+  800efe:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  800f03:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f06:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  800f0b:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f10:	e8 0d ff ff ff       	call   800e22 <nsipc>
+}
+  800f15:	c9                   	leave
+  800f16:	c3                   	ret
+
+00800f17 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  800f17:	55                   	push   %ebp
+  800f18:	89 e5                	mov    %esp,%ebp
+  800f1a:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  800f1d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f20:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  800f25:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f2a:	e8 f3 fe ff ff       	call   800e22 <nsipc>
+}
+  800f2f:	c9                   	leave
+  800f30:	c3                   	ret
+
+00800f31 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  800f31:	55                   	push   %ebp
+  800f32:	89 e5                	mov    %esp,%ebp
+  800f34:	53                   	push   %ebx
+  800f35:	83 ec 08             	sub    $0x8,%esp
+  800f38:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  800f3b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f3e:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  800f43:	53                   	push   %ebx
+  800f44:	ff 75 0c             	push   0xc(%ebp)
+  800f47:	68 04 60 80 00       	push   $0x806004
+  800f4c:	e8 06 0e 00 00       	call   801d57 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  800f51:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  800f57:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f5c:	e8 c1 fe ff ff       	call   800e22 <nsipc>
+}
+  800f61:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f64:	c9                   	leave
+  800f65:	c3                   	ret
+
+00800f66 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  800f66:	55                   	push   %ebp
+  800f67:	89 e5                	mov    %esp,%ebp
+  800f69:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  800f6c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f6f:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  800f74:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f77:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  800f7c:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f81:	e8 9c fe ff ff       	call   800e22 <nsipc>
+}
+  800f86:	c9                   	leave
+  800f87:	c3                   	ret
+
+00800f88 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  800f88:	55                   	push   %ebp
+  800f89:	89 e5                	mov    %esp,%ebp
+  800f8b:	56                   	push   %esi
+  800f8c:	53                   	push   %ebx
+  800f8d:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  800f90:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f93:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  800f98:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  800f9e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800fa1:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  800fa6:	b8 07 00 00 00       	mov    $0x7,%eax
+  800fab:	e8 72 fe ff ff       	call   800e22 <nsipc>
+  800fb0:	89 c3                	mov    %eax,%ebx
+  800fb2:	85 c0                	test   %eax,%eax
+  800fb4:	78 22                	js     800fd8 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  800fb6:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  800fbb:	39 c6                	cmp    %eax,%esi
+  800fbd:	0f 4e c6             	cmovle %esi,%eax
+  800fc0:	39 c3                	cmp    %eax,%ebx
+  800fc2:	7f 1d                	jg     800fe1 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  800fc4:	83 ec 04             	sub    $0x4,%esp
+  800fc7:	53                   	push   %ebx
+  800fc8:	68 00 60 80 00       	push   $0x806000
+  800fcd:	ff 75 0c             	push   0xc(%ebp)
+  800fd0:	e8 82 0d 00 00       	call   801d57 <memmove>
+  800fd5:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  800fd8:	89 d8                	mov    %ebx,%eax
+  800fda:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fdd:	5b                   	pop    %ebx
+  800fde:	5e                   	pop    %esi
+  800fdf:	5d                   	pop    %ebp
+  800fe0:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  800fe1:	68 07 26 80 00       	push   $0x802607
+  800fe6:	68 cf 25 80 00       	push   $0x8025cf
+  800feb:	6a 62                	push   $0x62
+  800fed:	68 1c 26 80 00       	push   $0x80261c
+  800ff2:	e8 46 05 00 00       	call   80153d <_panic>
+
+00800ff7 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  800ff7:	55                   	push   %ebp
+  800ff8:	89 e5                	mov    %esp,%ebp
+  800ffa:	53                   	push   %ebx
+  800ffb:	83 ec 04             	sub    $0x4,%esp
+  800ffe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801001:	8b 45 08             	mov    0x8(%ebp),%eax
+  801004:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  801009:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80100f:	7f 2e                	jg     80103f <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801011:	83 ec 04             	sub    $0x4,%esp
+  801014:	53                   	push   %ebx
+  801015:	ff 75 0c             	push   0xc(%ebp)
+  801018:	68 0c 60 80 00       	push   $0x80600c
+  80101d:	e8 35 0d 00 00       	call   801d57 <memmove>
+	nsipcbuf.send.req_size = size;
+  801022:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  801028:	8b 45 14             	mov    0x14(%ebp),%eax
+  80102b:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  801030:	b8 08 00 00 00       	mov    $0x8,%eax
+  801035:	e8 e8 fd ff ff       	call   800e22 <nsipc>
+}
+  80103a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80103d:	c9                   	leave
+  80103e:	c3                   	ret
+	assert(size < 1600);
+  80103f:	68 28 26 80 00       	push   $0x802628
+  801044:	68 cf 25 80 00       	push   $0x8025cf
+  801049:	6a 6d                	push   $0x6d
+  80104b:	68 1c 26 80 00       	push   $0x80261c
+  801050:	e8 e8 04 00 00       	call   80153d <_panic>
+
+00801055 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801055:	55                   	push   %ebp
+  801056:	89 e5                	mov    %esp,%ebp
+  801058:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  80105b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80105e:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  801063:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801066:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  80106b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80106e:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  801073:	b8 09 00 00 00       	mov    $0x9,%eax
+  801078:	e8 a5 fd ff ff       	call   800e22 <nsipc>
+}
+  80107d:	c9                   	leave
+  80107e:	c3                   	ret
+
+0080107f <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80107f:	55                   	push   %ebp
+  801080:	89 e5                	mov    %esp,%ebp
+  801082:	56                   	push   %esi
+  801083:	53                   	push   %ebx
+  801084:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801087:	83 ec 0c             	sub    $0xc,%esp
+  80108a:	ff 75 08             	push   0x8(%ebp)
+  80108d:	e8 aa f3 ff ff       	call   80043c <fd2data>
+  801092:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801094:	83 c4 08             	add    $0x8,%esp
+  801097:	68 34 26 80 00       	push   $0x802634
+  80109c:	53                   	push   %ebx
+  80109d:	e8 2f 0b 00 00       	call   801bd1 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8010a2:	8b 46 04             	mov    0x4(%esi),%eax
+  8010a5:	2b 06                	sub    (%esi),%eax
+  8010a7:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8010ad:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8010b4:	00 00 00 
+	stat->st_dev = &devpipe;
+  8010b7:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  8010be:	30 80 00 
+	return 0;
+}
+  8010c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010c6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8010c9:	5b                   	pop    %ebx
+  8010ca:	5e                   	pop    %esi
+  8010cb:	5d                   	pop    %ebp
+  8010cc:	c3                   	ret
+
+008010cd <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8010cd:	55                   	push   %ebp
+  8010ce:	89 e5                	mov    %esp,%ebp
+  8010d0:	53                   	push   %ebx
+  8010d1:	83 ec 0c             	sub    $0xc,%esp
+  8010d4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8010d7:	53                   	push   %ebx
+  8010d8:	6a 00                	push   $0x0
+  8010da:	e8 ff f0 ff ff       	call   8001de <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8010df:	89 1c 24             	mov    %ebx,(%esp)
+  8010e2:	e8 55 f3 ff ff       	call   80043c <fd2data>
+  8010e7:	83 c4 08             	add    $0x8,%esp
+  8010ea:	50                   	push   %eax
+  8010eb:	6a 00                	push   $0x0
+  8010ed:	e8 ec f0 ff ff       	call   8001de <sys_page_unmap>
+}
+  8010f2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010f5:	c9                   	leave
+  8010f6:	c3                   	ret
+
+008010f7 <_pipeisclosed>:
+{
+  8010f7:	55                   	push   %ebp
+  8010f8:	89 e5                	mov    %esp,%ebp
+  8010fa:	57                   	push   %edi
+  8010fb:	56                   	push   %esi
+  8010fc:	53                   	push   %ebx
+  8010fd:	83 ec 1c             	sub    $0x1c,%esp
+  801100:	89 c7                	mov    %eax,%edi
+  801102:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801104:	a1 08 40 80 00       	mov    0x804008,%eax
+  801109:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  80110c:	83 ec 0c             	sub    $0xc,%esp
+  80110f:	57                   	push   %edi
+  801110:	e8 f3 0e 00 00       	call   802008 <pageref>
+  801115:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801118:	89 34 24             	mov    %esi,(%esp)
+  80111b:	e8 e8 0e 00 00       	call   802008 <pageref>
+		nn = thisenv->env_runs;
+  801120:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801126:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801129:	83 c4 10             	add    $0x10,%esp
+  80112c:	39 cb                	cmp    %ecx,%ebx
+  80112e:	74 1b                	je     80114b <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801130:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801133:	75 cf                	jne    801104 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801135:	8b 42 58             	mov    0x58(%edx),%eax
+  801138:	6a 01                	push   $0x1
+  80113a:	50                   	push   %eax
+  80113b:	53                   	push   %ebx
+  80113c:	68 3b 26 80 00       	push   $0x80263b
+  801141:	e8 d2 04 00 00       	call   801618 <cprintf>
+  801146:	83 c4 10             	add    $0x10,%esp
+  801149:	eb b9                	jmp    801104 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  80114b:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80114e:	0f 94 c0             	sete   %al
+  801151:	0f b6 c0             	movzbl %al,%eax
+}
+  801154:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801157:	5b                   	pop    %ebx
+  801158:	5e                   	pop    %esi
+  801159:	5f                   	pop    %edi
+  80115a:	5d                   	pop    %ebp
+  80115b:	c3                   	ret
+
+0080115c <devpipe_write>:
+{
+  80115c:	55                   	push   %ebp
+  80115d:	89 e5                	mov    %esp,%ebp
+  80115f:	57                   	push   %edi
+  801160:	56                   	push   %esi
+  801161:	53                   	push   %ebx
+  801162:	83 ec 28             	sub    $0x28,%esp
+  801165:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801168:	56                   	push   %esi
+  801169:	e8 ce f2 ff ff       	call   80043c <fd2data>
+  80116e:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801170:	83 c4 10             	add    $0x10,%esp
+  801173:	bf 00 00 00 00       	mov    $0x0,%edi
+  801178:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  80117b:	75 09                	jne    801186 <devpipe_write+0x2a>
+	return i;
+  80117d:	89 f8                	mov    %edi,%eax
+  80117f:	eb 23                	jmp    8011a4 <devpipe_write+0x48>
+			sys_yield();
+  801181:	e8 b4 ef ff ff       	call   80013a <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801186:	8b 43 04             	mov    0x4(%ebx),%eax
+  801189:	8b 0b                	mov    (%ebx),%ecx
+  80118b:	8d 51 20             	lea    0x20(%ecx),%edx
+  80118e:	39 d0                	cmp    %edx,%eax
+  801190:	72 1a                	jb     8011ac <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  801192:	89 da                	mov    %ebx,%edx
+  801194:	89 f0                	mov    %esi,%eax
+  801196:	e8 5c ff ff ff       	call   8010f7 <_pipeisclosed>
+  80119b:	85 c0                	test   %eax,%eax
+  80119d:	74 e2                	je     801181 <devpipe_write+0x25>
+				return 0;
+  80119f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011a7:	5b                   	pop    %ebx
+  8011a8:	5e                   	pop    %esi
+  8011a9:	5f                   	pop    %edi
+  8011aa:	5d                   	pop    %ebp
+  8011ab:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8011ac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011af:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8011b3:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8011b6:	89 c2                	mov    %eax,%edx
+  8011b8:	c1 fa 1f             	sar    $0x1f,%edx
+  8011bb:	89 d1                	mov    %edx,%ecx
+  8011bd:	c1 e9 1b             	shr    $0x1b,%ecx
+  8011c0:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8011c3:	83 e2 1f             	and    $0x1f,%edx
+  8011c6:	29 ca                	sub    %ecx,%edx
+  8011c8:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8011cc:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8011d0:	83 c0 01             	add    $0x1,%eax
+  8011d3:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8011d6:	83 c7 01             	add    $0x1,%edi
+  8011d9:	eb 9d                	jmp    801178 <devpipe_write+0x1c>
+
+008011db <devpipe_read>:
+{
+  8011db:	55                   	push   %ebp
+  8011dc:	89 e5                	mov    %esp,%ebp
+  8011de:	57                   	push   %edi
+  8011df:	56                   	push   %esi
+  8011e0:	53                   	push   %ebx
+  8011e1:	83 ec 18             	sub    $0x18,%esp
+  8011e4:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8011e7:	57                   	push   %edi
+  8011e8:	e8 4f f2 ff ff       	call   80043c <fd2data>
+  8011ed:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8011ef:	83 c4 10             	add    $0x10,%esp
+  8011f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8011f7:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8011fa:	75 13                	jne    80120f <devpipe_read+0x34>
+	return i;
+  8011fc:	89 f0                	mov    %esi,%eax
+  8011fe:	eb 02                	jmp    801202 <devpipe_read+0x27>
+				return i;
+  801200:	89 f0                	mov    %esi,%eax
+}
+  801202:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801205:	5b                   	pop    %ebx
+  801206:	5e                   	pop    %esi
+  801207:	5f                   	pop    %edi
+  801208:	5d                   	pop    %ebp
+  801209:	c3                   	ret
+			sys_yield();
+  80120a:	e8 2b ef ff ff       	call   80013a <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  80120f:	8b 03                	mov    (%ebx),%eax
+  801211:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801214:	75 18                	jne    80122e <devpipe_read+0x53>
+			if (i > 0)
+  801216:	85 f6                	test   %esi,%esi
+  801218:	75 e6                	jne    801200 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  80121a:	89 da                	mov    %ebx,%edx
+  80121c:	89 f8                	mov    %edi,%eax
+  80121e:	e8 d4 fe ff ff       	call   8010f7 <_pipeisclosed>
+  801223:	85 c0                	test   %eax,%eax
+  801225:	74 e3                	je     80120a <devpipe_read+0x2f>
+				return 0;
+  801227:	b8 00 00 00 00       	mov    $0x0,%eax
+  80122c:	eb d4                	jmp    801202 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80122e:	99                   	cltd
+  80122f:	c1 ea 1b             	shr    $0x1b,%edx
+  801232:	01 d0                	add    %edx,%eax
+  801234:	83 e0 1f             	and    $0x1f,%eax
+  801237:	29 d0                	sub    %edx,%eax
+  801239:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  80123e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801241:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  801244:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  801247:	83 c6 01             	add    $0x1,%esi
+  80124a:	eb ab                	jmp    8011f7 <devpipe_read+0x1c>
+
+0080124c <pipe>:
+{
+  80124c:	55                   	push   %ebp
+  80124d:	89 e5                	mov    %esp,%ebp
+  80124f:	56                   	push   %esi
+  801250:	53                   	push   %ebx
+  801251:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801254:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801257:	50                   	push   %eax
+  801258:	e8 f6 f1 ff ff       	call   800453 <fd_alloc>
+  80125d:	89 c3                	mov    %eax,%ebx
+  80125f:	83 c4 10             	add    $0x10,%esp
+  801262:	85 c0                	test   %eax,%eax
+  801264:	0f 88 23 01 00 00    	js     80138d <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80126a:	83 ec 04             	sub    $0x4,%esp
+  80126d:	68 07 04 00 00       	push   $0x407
+  801272:	ff 75 f4             	push   -0xc(%ebp)
+  801275:	6a 00                	push   $0x0
+  801277:	e8 dd ee ff ff       	call   800159 <sys_page_alloc>
+  80127c:	89 c3                	mov    %eax,%ebx
+  80127e:	83 c4 10             	add    $0x10,%esp
+  801281:	85 c0                	test   %eax,%eax
+  801283:	0f 88 04 01 00 00    	js     80138d <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801289:	83 ec 0c             	sub    $0xc,%esp
+  80128c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80128f:	50                   	push   %eax
+  801290:	e8 be f1 ff ff       	call   800453 <fd_alloc>
+  801295:	89 c3                	mov    %eax,%ebx
+  801297:	83 c4 10             	add    $0x10,%esp
+  80129a:	85 c0                	test   %eax,%eax
+  80129c:	0f 88 db 00 00 00    	js     80137d <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8012a2:	83 ec 04             	sub    $0x4,%esp
+  8012a5:	68 07 04 00 00       	push   $0x407
+  8012aa:	ff 75 f0             	push   -0x10(%ebp)
+  8012ad:	6a 00                	push   $0x0
+  8012af:	e8 a5 ee ff ff       	call   800159 <sys_page_alloc>
+  8012b4:	89 c3                	mov    %eax,%ebx
+  8012b6:	83 c4 10             	add    $0x10,%esp
+  8012b9:	85 c0                	test   %eax,%eax
+  8012bb:	0f 88 bc 00 00 00    	js     80137d <pipe+0x131>
+	va = fd2data(fd0);
+  8012c1:	83 ec 0c             	sub    $0xc,%esp
+  8012c4:	ff 75 f4             	push   -0xc(%ebp)
+  8012c7:	e8 70 f1 ff ff       	call   80043c <fd2data>
+  8012cc:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8012ce:	83 c4 0c             	add    $0xc,%esp
+  8012d1:	68 07 04 00 00       	push   $0x407
+  8012d6:	50                   	push   %eax
+  8012d7:	6a 00                	push   $0x0
+  8012d9:	e8 7b ee ff ff       	call   800159 <sys_page_alloc>
+  8012de:	89 c3                	mov    %eax,%ebx
+  8012e0:	83 c4 10             	add    $0x10,%esp
+  8012e3:	85 c0                	test   %eax,%eax
+  8012e5:	0f 88 82 00 00 00    	js     80136d <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8012eb:	83 ec 0c             	sub    $0xc,%esp
+  8012ee:	ff 75 f0             	push   -0x10(%ebp)
+  8012f1:	e8 46 f1 ff ff       	call   80043c <fd2data>
+  8012f6:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8012fd:	50                   	push   %eax
+  8012fe:	6a 00                	push   $0x0
+  801300:	56                   	push   %esi
+  801301:	6a 00                	push   $0x0
+  801303:	e8 94 ee ff ff       	call   80019c <sys_page_map>
+  801308:	89 c3                	mov    %eax,%ebx
+  80130a:	83 c4 20             	add    $0x20,%esp
+  80130d:	85 c0                	test   %eax,%eax
+  80130f:	78 4e                	js     80135f <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  801311:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  801316:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801319:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80131b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80131e:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  801325:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801328:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80132a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80132d:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  801334:	83 ec 0c             	sub    $0xc,%esp
+  801337:	ff 75 f4             	push   -0xc(%ebp)
+  80133a:	e8 ed f0 ff ff       	call   80042c <fd2num>
+  80133f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801342:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  801344:	83 c4 04             	add    $0x4,%esp
+  801347:	ff 75 f0             	push   -0x10(%ebp)
+  80134a:	e8 dd f0 ff ff       	call   80042c <fd2num>
+  80134f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801352:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  801355:	83 c4 10             	add    $0x10,%esp
+  801358:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80135d:	eb 2e                	jmp    80138d <pipe+0x141>
+	sys_page_unmap(0, va);
+  80135f:	83 ec 08             	sub    $0x8,%esp
+  801362:	56                   	push   %esi
+  801363:	6a 00                	push   $0x0
+  801365:	e8 74 ee ff ff       	call   8001de <sys_page_unmap>
+  80136a:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80136d:	83 ec 08             	sub    $0x8,%esp
+  801370:	ff 75 f0             	push   -0x10(%ebp)
+  801373:	6a 00                	push   $0x0
+  801375:	e8 64 ee ff ff       	call   8001de <sys_page_unmap>
+  80137a:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80137d:	83 ec 08             	sub    $0x8,%esp
+  801380:	ff 75 f4             	push   -0xc(%ebp)
+  801383:	6a 00                	push   $0x0
+  801385:	e8 54 ee ff ff       	call   8001de <sys_page_unmap>
+  80138a:	83 c4 10             	add    $0x10,%esp
+}
+  80138d:	89 d8                	mov    %ebx,%eax
+  80138f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801392:	5b                   	pop    %ebx
+  801393:	5e                   	pop    %esi
+  801394:	5d                   	pop    %ebp
+  801395:	c3                   	ret
+
+00801396 <pipeisclosed>:
+{
+  801396:	55                   	push   %ebp
+  801397:	89 e5                	mov    %esp,%ebp
+  801399:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80139c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80139f:	50                   	push   %eax
+  8013a0:	ff 75 08             	push   0x8(%ebp)
+  8013a3:	e8 01 f1 ff ff       	call   8004a9 <fd_lookup>
+  8013a8:	83 c4 10             	add    $0x10,%esp
+  8013ab:	85 c0                	test   %eax,%eax
+  8013ad:	78 18                	js     8013c7 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8013af:	83 ec 0c             	sub    $0xc,%esp
+  8013b2:	ff 75 f4             	push   -0xc(%ebp)
+  8013b5:	e8 82 f0 ff ff       	call   80043c <fd2data>
+  8013ba:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8013bc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013bf:	e8 33 fd ff ff       	call   8010f7 <_pipeisclosed>
+  8013c4:	83 c4 10             	add    $0x10,%esp
+}
+  8013c7:	c9                   	leave
+  8013c8:	c3                   	ret
+
+008013c9 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8013c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013ce:	c3                   	ret
+
+008013cf <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8013cf:	55                   	push   %ebp
+  8013d0:	89 e5                	mov    %esp,%ebp
+  8013d2:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8013d5:	68 53 26 80 00       	push   $0x802653
+  8013da:	ff 75 0c             	push   0xc(%ebp)
+  8013dd:	e8 ef 07 00 00       	call   801bd1 <strcpy>
+	return 0;
+}
+  8013e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013e7:	c9                   	leave
+  8013e8:	c3                   	ret
+
+008013e9 <devcons_write>:
+{
+  8013e9:	55                   	push   %ebp
+  8013ea:	89 e5                	mov    %esp,%ebp
+  8013ec:	57                   	push   %edi
+  8013ed:	56                   	push   %esi
+  8013ee:	53                   	push   %ebx
+  8013ef:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8013f5:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8013fa:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  801400:	eb 2e                	jmp    801430 <devcons_write+0x47>
+		m = n - tot;
+  801402:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801405:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  801407:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80140c:	39 c3                	cmp    %eax,%ebx
+  80140e:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  801411:	83 ec 04             	sub    $0x4,%esp
+  801414:	53                   	push   %ebx
+  801415:	89 f0                	mov    %esi,%eax
+  801417:	03 45 0c             	add    0xc(%ebp),%eax
+  80141a:	50                   	push   %eax
+  80141b:	57                   	push   %edi
+  80141c:	e8 36 09 00 00       	call   801d57 <memmove>
+		sys_cputs(buf, m);
+  801421:	83 c4 08             	add    $0x8,%esp
+  801424:	53                   	push   %ebx
+  801425:	57                   	push   %edi
+  801426:	e8 72 ec ff ff       	call   80009d <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80142b:	01 de                	add    %ebx,%esi
+  80142d:	83 c4 10             	add    $0x10,%esp
+  801430:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801433:	72 cd                	jb     801402 <devcons_write+0x19>
+}
+  801435:	89 f0                	mov    %esi,%eax
+  801437:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80143a:	5b                   	pop    %ebx
+  80143b:	5e                   	pop    %esi
+  80143c:	5f                   	pop    %edi
+  80143d:	5d                   	pop    %ebp
+  80143e:	c3                   	ret
+
+0080143f <devcons_read>:
+{
+  80143f:	55                   	push   %ebp
+  801440:	89 e5                	mov    %esp,%ebp
+  801442:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  801445:	b8 00 00 00 00       	mov    $0x0,%eax
+  80144a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80144e:	75 07                	jne    801457 <devcons_read+0x18>
+  801450:	eb 1f                	jmp    801471 <devcons_read+0x32>
+		sys_yield();
+  801452:	e8 e3 ec ff ff       	call   80013a <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  801457:	e8 5f ec ff ff       	call   8000bb <sys_cgetc>
+  80145c:	85 c0                	test   %eax,%eax
+  80145e:	74 f2                	je     801452 <devcons_read+0x13>
+	if (c < 0)
+  801460:	78 0f                	js     801471 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  801462:	83 f8 04             	cmp    $0x4,%eax
+  801465:	74 0c                	je     801473 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  801467:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80146a:	88 02                	mov    %al,(%edx)
+	return 1;
+  80146c:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  801471:	c9                   	leave
+  801472:	c3                   	ret
+		return 0;
+  801473:	b8 00 00 00 00       	mov    $0x0,%eax
+  801478:	eb f7                	jmp    801471 <devcons_read+0x32>
+
+0080147a <cputchar>:
+{
+  80147a:	55                   	push   %ebp
+  80147b:	89 e5                	mov    %esp,%ebp
+  80147d:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  801480:	8b 45 08             	mov    0x8(%ebp),%eax
+  801483:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  801486:	6a 01                	push   $0x1
+  801488:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80148b:	50                   	push   %eax
+  80148c:	e8 0c ec ff ff       	call   80009d <sys_cputs>
+}
+  801491:	83 c4 10             	add    $0x10,%esp
+  801494:	c9                   	leave
+  801495:	c3                   	ret
+
+00801496 <getchar>:
+{
+  801496:	55                   	push   %ebp
+  801497:	89 e5                	mov    %esp,%ebp
+  801499:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80149c:	6a 01                	push   $0x1
+  80149e:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8014a1:	50                   	push   %eax
+  8014a2:	6a 00                	push   $0x0
+  8014a4:	e8 66 f2 ff ff       	call   80070f <read>
+	if (r < 0)
+  8014a9:	83 c4 10             	add    $0x10,%esp
+  8014ac:	85 c0                	test   %eax,%eax
+  8014ae:	78 06                	js     8014b6 <getchar+0x20>
+	if (r < 1)
+  8014b0:	74 06                	je     8014b8 <getchar+0x22>
+	return c;
+  8014b2:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8014b6:	c9                   	leave
+  8014b7:	c3                   	ret
+		return -E_EOF;
+  8014b8:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8014bd:	eb f7                	jmp    8014b6 <getchar+0x20>
+
+008014bf <iscons>:
+{
+  8014bf:	55                   	push   %ebp
+  8014c0:	89 e5                	mov    %esp,%ebp
+  8014c2:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8014c5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014c8:	50                   	push   %eax
+  8014c9:	ff 75 08             	push   0x8(%ebp)
+  8014cc:	e8 d8 ef ff ff       	call   8004a9 <fd_lookup>
+  8014d1:	83 c4 10             	add    $0x10,%esp
+  8014d4:	85 c0                	test   %eax,%eax
+  8014d6:	78 11                	js     8014e9 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8014d8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014db:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  8014e1:	39 10                	cmp    %edx,(%eax)
+  8014e3:	0f 94 c0             	sete   %al
+  8014e6:	0f b6 c0             	movzbl %al,%eax
+}
+  8014e9:	c9                   	leave
+  8014ea:	c3                   	ret
+
+008014eb <opencons>:
+{
+  8014eb:	55                   	push   %ebp
+  8014ec:	89 e5                	mov    %esp,%ebp
+  8014ee:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8014f1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014f4:	50                   	push   %eax
+  8014f5:	e8 59 ef ff ff       	call   800453 <fd_alloc>
+  8014fa:	83 c4 10             	add    $0x10,%esp
+  8014fd:	85 c0                	test   %eax,%eax
+  8014ff:	78 3a                	js     80153b <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  801501:	83 ec 04             	sub    $0x4,%esp
+  801504:	68 07 04 00 00       	push   $0x407
+  801509:	ff 75 f4             	push   -0xc(%ebp)
+  80150c:	6a 00                	push   $0x0
+  80150e:	e8 46 ec ff ff       	call   800159 <sys_page_alloc>
+  801513:	83 c4 10             	add    $0x10,%esp
+  801516:	85 c0                	test   %eax,%eax
+  801518:	78 21                	js     80153b <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80151a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80151d:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  801523:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  801525:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801528:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80152f:	83 ec 0c             	sub    $0xc,%esp
+  801532:	50                   	push   %eax
+  801533:	e8 f4 ee ff ff       	call   80042c <fd2num>
+  801538:	83 c4 10             	add    $0x10,%esp
+}
+  80153b:	c9                   	leave
+  80153c:	c3                   	ret
+
+0080153d <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80153d:	55                   	push   %ebp
+  80153e:	89 e5                	mov    %esp,%ebp
+  801540:	56                   	push   %esi
+  801541:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  801542:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  801545:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  80154b:	e8 cb eb ff ff       	call   80011b <sys_getenvid>
+  801550:	83 ec 0c             	sub    $0xc,%esp
+  801553:	ff 75 0c             	push   0xc(%ebp)
+  801556:	ff 75 08             	push   0x8(%ebp)
+  801559:	56                   	push   %esi
+  80155a:	50                   	push   %eax
+  80155b:	68 60 26 80 00       	push   $0x802660
+  801560:	e8 b3 00 00 00       	call   801618 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  801565:	83 c4 18             	add    $0x18,%esp
+  801568:	53                   	push   %ebx
+  801569:	ff 75 10             	push   0x10(%ebp)
+  80156c:	e8 56 00 00 00       	call   8015c7 <vcprintf>
+	cprintf("\n");
+  801571:	c7 04 24 4c 26 80 00 	movl   $0x80264c,(%esp)
+  801578:	e8 9b 00 00 00       	call   801618 <cprintf>
+  80157d:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  801580:	cc                   	int3
+	while (1)
+  801581:	eb fd                	jmp    801580 <_panic+0x43>
+
+00801583 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  801583:	55                   	push   %ebp
+  801584:	89 e5                	mov    %esp,%ebp
+  801586:	53                   	push   %ebx
+  801587:	83 ec 04             	sub    $0x4,%esp
+  80158a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80158d:	8b 13                	mov    (%ebx),%edx
+  80158f:	8d 42 01             	lea    0x1(%edx),%eax
+  801592:	89 03                	mov    %eax,(%ebx)
+  801594:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801597:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80159b:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8015a0:	74 09                	je     8015ab <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8015a2:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8015a6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015a9:	c9                   	leave
+  8015aa:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8015ab:	83 ec 08             	sub    $0x8,%esp
+  8015ae:	68 ff 00 00 00       	push   $0xff
+  8015b3:	8d 43 08             	lea    0x8(%ebx),%eax
+  8015b6:	50                   	push   %eax
+  8015b7:	e8 e1 ea ff ff       	call   80009d <sys_cputs>
+		b->idx = 0;
+  8015bc:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8015c2:	83 c4 10             	add    $0x10,%esp
+  8015c5:	eb db                	jmp    8015a2 <putch+0x1f>
+
+008015c7 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8015c7:	55                   	push   %ebp
+  8015c8:	89 e5                	mov    %esp,%ebp
+  8015ca:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8015d0:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8015d7:	00 00 00 
+	b.cnt = 0;
+  8015da:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8015e1:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8015e4:	ff 75 0c             	push   0xc(%ebp)
+  8015e7:	ff 75 08             	push   0x8(%ebp)
+  8015ea:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8015f0:	50                   	push   %eax
+  8015f1:	68 83 15 80 00       	push   $0x801583
+  8015f6:	e8 14 01 00 00       	call   80170f <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8015fb:	83 c4 08             	add    $0x8,%esp
+  8015fe:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  801604:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80160a:	50                   	push   %eax
+  80160b:	e8 8d ea ff ff       	call   80009d <sys_cputs>
+
+	return b.cnt;
+}
+  801610:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  801616:	c9                   	leave
+  801617:	c3                   	ret
+
+00801618 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  801618:	55                   	push   %ebp
+  801619:	89 e5                	mov    %esp,%ebp
+  80161b:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80161e:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  801621:	50                   	push   %eax
+  801622:	ff 75 08             	push   0x8(%ebp)
+  801625:	e8 9d ff ff ff       	call   8015c7 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80162a:	c9                   	leave
+  80162b:	c3                   	ret
+
+0080162c <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80162c:	55                   	push   %ebp
+  80162d:	89 e5                	mov    %esp,%ebp
+  80162f:	57                   	push   %edi
+  801630:	56                   	push   %esi
+  801631:	53                   	push   %ebx
+  801632:	83 ec 1c             	sub    $0x1c,%esp
+  801635:	89 c7                	mov    %eax,%edi
+  801637:	89 d6                	mov    %edx,%esi
+  801639:	8b 45 08             	mov    0x8(%ebp),%eax
+  80163c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80163f:	89 d1                	mov    %edx,%ecx
+  801641:	89 c2                	mov    %eax,%edx
+  801643:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801646:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801649:	8b 45 10             	mov    0x10(%ebp),%eax
+  80164c:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80164f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801652:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801659:	39 c2                	cmp    %eax,%edx
+  80165b:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80165e:	72 3e                	jb     80169e <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  801660:	83 ec 0c             	sub    $0xc,%esp
+  801663:	ff 75 18             	push   0x18(%ebp)
+  801666:	83 eb 01             	sub    $0x1,%ebx
+  801669:	53                   	push   %ebx
+  80166a:	50                   	push   %eax
+  80166b:	83 ec 08             	sub    $0x8,%esp
+  80166e:	ff 75 e4             	push   -0x1c(%ebp)
+  801671:	ff 75 e0             	push   -0x20(%ebp)
+  801674:	ff 75 dc             	push   -0x24(%ebp)
+  801677:	ff 75 d8             	push   -0x28(%ebp)
+  80167a:	e8 e1 0a 00 00       	call   802160 <__udivdi3>
+  80167f:	83 c4 18             	add    $0x18,%esp
+  801682:	52                   	push   %edx
+  801683:	50                   	push   %eax
+  801684:	89 f2                	mov    %esi,%edx
+  801686:	89 f8                	mov    %edi,%eax
+  801688:	e8 9f ff ff ff       	call   80162c <printnum>
+  80168d:	83 c4 20             	add    $0x20,%esp
+  801690:	eb 13                	jmp    8016a5 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  801692:	83 ec 08             	sub    $0x8,%esp
+  801695:	56                   	push   %esi
+  801696:	ff 75 18             	push   0x18(%ebp)
+  801699:	ff d7                	call   *%edi
+  80169b:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80169e:	83 eb 01             	sub    $0x1,%ebx
+  8016a1:	85 db                	test   %ebx,%ebx
+  8016a3:	7f ed                	jg     801692 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8016a5:	83 ec 08             	sub    $0x8,%esp
+  8016a8:	56                   	push   %esi
+  8016a9:	83 ec 04             	sub    $0x4,%esp
+  8016ac:	ff 75 e4             	push   -0x1c(%ebp)
+  8016af:	ff 75 e0             	push   -0x20(%ebp)
+  8016b2:	ff 75 dc             	push   -0x24(%ebp)
+  8016b5:	ff 75 d8             	push   -0x28(%ebp)
+  8016b8:	e8 73 0b 00 00       	call   802230 <__umoddi3>
+  8016bd:	83 c4 14             	add    $0x14,%esp
+  8016c0:	0f be 80 83 26 80 00 	movsbl 0x802683(%eax),%eax
+  8016c7:	50                   	push   %eax
+  8016c8:	ff d7                	call   *%edi
+}
+  8016ca:	83 c4 10             	add    $0x10,%esp
+  8016cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016d0:	5b                   	pop    %ebx
+  8016d1:	5e                   	pop    %esi
+  8016d2:	5f                   	pop    %edi
+  8016d3:	5d                   	pop    %ebp
+  8016d4:	c3                   	ret
+
+008016d5 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8016d5:	55                   	push   %ebp
+  8016d6:	89 e5                	mov    %esp,%ebp
+  8016d8:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8016db:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8016df:	8b 10                	mov    (%eax),%edx
+  8016e1:	3b 50 04             	cmp    0x4(%eax),%edx
+  8016e4:	73 0a                	jae    8016f0 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8016e6:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8016e9:	89 08                	mov    %ecx,(%eax)
+  8016eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016ee:	88 02                	mov    %al,(%edx)
+}
+  8016f0:	5d                   	pop    %ebp
+  8016f1:	c3                   	ret
+
+008016f2 <printfmt>:
+{
+  8016f2:	55                   	push   %ebp
+  8016f3:	89 e5                	mov    %esp,%ebp
+  8016f5:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8016f8:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8016fb:	50                   	push   %eax
+  8016fc:	ff 75 10             	push   0x10(%ebp)
+  8016ff:	ff 75 0c             	push   0xc(%ebp)
+  801702:	ff 75 08             	push   0x8(%ebp)
+  801705:	e8 05 00 00 00       	call   80170f <vprintfmt>
+}
+  80170a:	83 c4 10             	add    $0x10,%esp
+  80170d:	c9                   	leave
+  80170e:	c3                   	ret
+
+0080170f <vprintfmt>:
+{
+  80170f:	55                   	push   %ebp
+  801710:	89 e5                	mov    %esp,%ebp
+  801712:	57                   	push   %edi
+  801713:	56                   	push   %esi
+  801714:	53                   	push   %ebx
+  801715:	83 ec 2c             	sub    $0x2c,%esp
+  801718:	8b 75 08             	mov    0x8(%ebp),%esi
+  80171b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80171e:	8b 7d 10             	mov    0x10(%ebp),%edi
+  801721:	eb 0a                	jmp    80172d <vprintfmt+0x1e>
+			putch(ch, putdat);
+  801723:	83 ec 08             	sub    $0x8,%esp
+  801726:	53                   	push   %ebx
+  801727:	50                   	push   %eax
+  801728:	ff d6                	call   *%esi
+  80172a:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80172d:	83 c7 01             	add    $0x1,%edi
+  801730:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  801734:	83 f8 25             	cmp    $0x25,%eax
+  801737:	74 0c                	je     801745 <vprintfmt+0x36>
+			if (ch == '\0')
+  801739:	85 c0                	test   %eax,%eax
+  80173b:	75 e6                	jne    801723 <vprintfmt+0x14>
+}
+  80173d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801740:	5b                   	pop    %ebx
+  801741:	5e                   	pop    %esi
+  801742:	5f                   	pop    %edi
+  801743:	5d                   	pop    %ebp
+  801744:	c3                   	ret
+		padc = ' ';
+  801745:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  801749:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  801750:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  801757:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80175e:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801763:	8d 47 01             	lea    0x1(%edi),%eax
+  801766:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801769:	0f b6 17             	movzbl (%edi),%edx
+  80176c:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80176f:	3c 55                	cmp    $0x55,%al
+  801771:	0f 87 9a 03 00 00    	ja     801b11 <vprintfmt+0x402>
+  801777:	0f b6 c0             	movzbl %al,%eax
+  80177a:	ff 24 85 c0 27 80 00 	jmp    *0x8027c0(,%eax,4)
+  801781:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  801784:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  801788:	eb d9                	jmp    801763 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80178a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80178d:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  801791:	eb d0                	jmp    801763 <vprintfmt+0x54>
+  801793:	0f b6 d2             	movzbl %dl,%edx
+  801796:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  801799:	b8 00 00 00 00       	mov    $0x0,%eax
+  80179e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8017a1:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8017a4:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8017a8:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8017ab:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8017ae:	83 f9 09             	cmp    $0x9,%ecx
+  8017b1:	77 55                	ja     801808 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8017b3:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8017b6:	eb e9                	jmp    8017a1 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8017b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8017bb:	8b 00                	mov    (%eax),%eax
+  8017bd:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8017c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8017c3:	8d 40 04             	lea    0x4(%eax),%eax
+  8017c6:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8017c9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8017cc:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8017d0:	79 91                	jns    801763 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8017d2:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8017d5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8017d8:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8017df:	eb 82                	jmp    801763 <vprintfmt+0x54>
+			if (width < 0)
+  8017e1:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8017e4:	85 d2                	test   %edx,%edx
+  8017e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017eb:	0f 49 c2             	cmovns %edx,%eax
+  8017ee:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8017f1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8017f4:	e9 6a ff ff ff       	jmp    801763 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8017f9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8017fc:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  801803:	e9 5b ff ff ff       	jmp    801763 <vprintfmt+0x54>
+  801808:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80180b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80180e:	eb bc                	jmp    8017cc <vprintfmt+0xbd>
+			lflag++;
+  801810:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801813:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  801816:	e9 48 ff ff ff       	jmp    801763 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80181b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80181e:	8d 78 04             	lea    0x4(%eax),%edi
+  801821:	83 ec 08             	sub    $0x8,%esp
+  801824:	53                   	push   %ebx
+  801825:	ff 30                	push   (%eax)
+  801827:	ff d6                	call   *%esi
+			break;
+  801829:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80182c:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80182f:	e9 7c 02 00 00       	jmp    801ab0 <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  801834:	8b 45 14             	mov    0x14(%ebp),%eax
+  801837:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80183a:	8b 10                	mov    (%eax),%edx
+  80183c:	89 d0                	mov    %edx,%eax
+  80183e:	f7 d8                	neg    %eax
+  801840:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  801843:	83 f8 10             	cmp    $0x10,%eax
+  801846:	7f 23                	jg     80186b <vprintfmt+0x15c>
+  801848:	8b 14 85 20 29 80 00 	mov    0x802920(,%eax,4),%edx
+  80184f:	85 d2                	test   %edx,%edx
+  801851:	74 18                	je     80186b <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  801853:	52                   	push   %edx
+  801854:	68 e1 25 80 00       	push   $0x8025e1
+  801859:	53                   	push   %ebx
+  80185a:	56                   	push   %esi
+  80185b:	e8 92 fe ff ff       	call   8016f2 <printfmt>
+  801860:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801863:	89 7d 14             	mov    %edi,0x14(%ebp)
+  801866:	e9 45 02 00 00       	jmp    801ab0 <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  80186b:	50                   	push   %eax
+  80186c:	68 9b 26 80 00       	push   $0x80269b
+  801871:	53                   	push   %ebx
+  801872:	56                   	push   %esi
+  801873:	e8 7a fe ff ff       	call   8016f2 <printfmt>
+  801878:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80187b:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80187e:	e9 2d 02 00 00       	jmp    801ab0 <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801883:	8b 45 14             	mov    0x14(%ebp),%eax
+  801886:	83 c0 04             	add    $0x4,%eax
+  801889:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80188c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80188f:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  801891:	85 c9                	test   %ecx,%ecx
+  801893:	b8 94 26 80 00       	mov    $0x802694,%eax
+  801898:	0f 45 c1             	cmovne %ecx,%eax
+  80189b:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80189e:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8018a2:	7e 06                	jle    8018aa <vprintfmt+0x19b>
+  8018a4:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8018a8:	75 0b                	jne    8018b5 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8018aa:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8018ad:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8018b0:	89 75 08             	mov    %esi,0x8(%ebp)
+  8018b3:	eb 5c                	jmp    801911 <vprintfmt+0x202>
+  8018b5:	83 ec 08             	sub    $0x8,%esp
+  8018b8:	ff 75 d0             	push   -0x30(%ebp)
+  8018bb:	ff 75 cc             	push   -0x34(%ebp)
+  8018be:	e8 eb 02 00 00       	call   801bae <strnlen>
+  8018c3:	89 c2                	mov    %eax,%edx
+  8018c5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8018c8:	29 d0                	sub    %edx,%eax
+  8018ca:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8018cd:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8018d1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8018d4:	89 75 08             	mov    %esi,0x8(%ebp)
+  8018d7:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8018d9:	eb 0e                	jmp    8018e9 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8018db:	83 ec 08             	sub    $0x8,%esp
+  8018de:	53                   	push   %ebx
+  8018df:	57                   	push   %edi
+  8018e0:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8018e3:	83 ee 01             	sub    $0x1,%esi
+  8018e6:	83 c4 10             	add    $0x10,%esp
+  8018e9:	85 f6                	test   %esi,%esi
+  8018eb:	7f ee                	jg     8018db <vprintfmt+0x1cc>
+  8018ed:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8018f0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8018f3:	85 c0                	test   %eax,%eax
+  8018f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018fa:	0f 49 d0             	cmovns %eax,%edx
+  8018fd:	29 d0                	sub    %edx,%eax
+  8018ff:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801902:	eb a6                	jmp    8018aa <vprintfmt+0x19b>
+					putch(ch, putdat);
+  801904:	83 ec 08             	sub    $0x8,%esp
+  801907:	53                   	push   %ebx
+  801908:	52                   	push   %edx
+  801909:	ff 55 08             	call   *0x8(%ebp)
+  80190c:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80190f:	89 f1                	mov    %esi,%ecx
+  801911:	8d 71 01             	lea    0x1(%ecx),%esi
+  801914:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  801918:	0f be d0             	movsbl %al,%edx
+  80191b:	85 d2                	test   %edx,%edx
+  80191d:	74 28                	je     801947 <vprintfmt+0x238>
+  80191f:	85 ff                	test   %edi,%edi
+  801921:	78 05                	js     801928 <vprintfmt+0x219>
+  801923:	83 ef 01             	sub    $0x1,%edi
+  801926:	78 30                	js     801958 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  801928:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80192c:	74 d6                	je     801904 <vprintfmt+0x1f5>
+  80192e:	0f be c0             	movsbl %al,%eax
+  801931:	83 e8 20             	sub    $0x20,%eax
+  801934:	83 f8 5e             	cmp    $0x5e,%eax
+  801937:	76 cb                	jbe    801904 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  801939:	83 ec 08             	sub    $0x8,%esp
+  80193c:	53                   	push   %ebx
+  80193d:	6a 3f                	push   $0x3f
+  80193f:	ff 55 08             	call   *0x8(%ebp)
+  801942:	83 c4 10             	add    $0x10,%esp
+  801945:	eb c8                	jmp    80190f <vprintfmt+0x200>
+  801947:	8b 75 08             	mov    0x8(%ebp),%esi
+  80194a:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80194d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801950:	01 d0                	add    %edx,%eax
+  801952:	29 c8                	sub    %ecx,%eax
+  801954:	89 c7                	mov    %eax,%edi
+  801956:	eb 13                	jmp    80196b <vprintfmt+0x25c>
+  801958:	8b 75 08             	mov    0x8(%ebp),%esi
+  80195b:	eb ed                	jmp    80194a <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80195d:	83 ec 08             	sub    $0x8,%esp
+  801960:	53                   	push   %ebx
+  801961:	6a 20                	push   $0x20
+  801963:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  801965:	83 ef 01             	sub    $0x1,%edi
+  801968:	83 c4 10             	add    $0x10,%esp
+  80196b:	85 ff                	test   %edi,%edi
+  80196d:	7f ee                	jg     80195d <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80196f:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  801972:	89 45 14             	mov    %eax,0x14(%ebp)
+  801975:	e9 36 01 00 00       	jmp    801ab0 <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  80197a:	83 f9 01             	cmp    $0x1,%ecx
+  80197d:	7f 1f                	jg     80199e <vprintfmt+0x28f>
+	else if (lflag)
+  80197f:	85 c9                	test   %ecx,%ecx
+  801981:	74 67                	je     8019ea <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  801983:	8b 45 14             	mov    0x14(%ebp),%eax
+  801986:	8b 00                	mov    (%eax),%eax
+  801988:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80198b:	89 c1                	mov    %eax,%ecx
+  80198d:	c1 f9 1f             	sar    $0x1f,%ecx
+  801990:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801993:	8b 45 14             	mov    0x14(%ebp),%eax
+  801996:	8d 40 04             	lea    0x4(%eax),%eax
+  801999:	89 45 14             	mov    %eax,0x14(%ebp)
+  80199c:	eb 17                	jmp    8019b5 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  80199e:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019a1:	8b 50 04             	mov    0x4(%eax),%edx
+  8019a4:	8b 00                	mov    (%eax),%eax
+  8019a6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8019a9:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8019ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019af:	8d 40 08             	lea    0x8(%eax),%eax
+  8019b2:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8019b5:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8019b8:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8019bb:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8019c0:	85 c9                	test   %ecx,%ecx
+  8019c2:	0f 89 ce 00 00 00    	jns    801a96 <vprintfmt+0x387>
+				putch('-', putdat);
+  8019c8:	83 ec 08             	sub    $0x8,%esp
+  8019cb:	53                   	push   %ebx
+  8019cc:	6a 2d                	push   $0x2d
+  8019ce:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8019d0:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8019d3:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8019d6:	f7 da                	neg    %edx
+  8019d8:	83 d1 00             	adc    $0x0,%ecx
+  8019db:	f7 d9                	neg    %ecx
+  8019dd:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8019e0:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8019e5:	e9 ac 00 00 00       	jmp    801a96 <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  8019ea:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019ed:	8b 00                	mov    (%eax),%eax
+  8019ef:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8019f2:	89 c1                	mov    %eax,%ecx
+  8019f4:	c1 f9 1f             	sar    $0x1f,%ecx
+  8019f7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8019fa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019fd:	8d 40 04             	lea    0x4(%eax),%eax
+  801a00:	89 45 14             	mov    %eax,0x14(%ebp)
+  801a03:	eb b0                	jmp    8019b5 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  801a05:	83 f9 01             	cmp    $0x1,%ecx
+  801a08:	7f 1b                	jg     801a25 <vprintfmt+0x316>
+	else if (lflag)
+  801a0a:	85 c9                	test   %ecx,%ecx
+  801a0c:	74 2c                	je     801a3a <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  801a0e:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a11:	8b 10                	mov    (%eax),%edx
+  801a13:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a18:	8d 40 04             	lea    0x4(%eax),%eax
+  801a1b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801a1e:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  801a23:	eb 71                	jmp    801a96 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  801a25:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a28:	8b 10                	mov    (%eax),%edx
+  801a2a:	8b 48 04             	mov    0x4(%eax),%ecx
+  801a2d:	8d 40 08             	lea    0x8(%eax),%eax
+  801a30:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801a33:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  801a38:	eb 5c                	jmp    801a96 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  801a3a:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a3d:	8b 10                	mov    (%eax),%edx
+  801a3f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a44:	8d 40 04             	lea    0x4(%eax),%eax
+  801a47:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801a4a:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  801a4f:	eb 45                	jmp    801a96 <vprintfmt+0x387>
+			putch('X', putdat);
+  801a51:	83 ec 08             	sub    $0x8,%esp
+  801a54:	53                   	push   %ebx
+  801a55:	6a 58                	push   $0x58
+  801a57:	ff d6                	call   *%esi
+			putch('X', putdat);
+  801a59:	83 c4 08             	add    $0x8,%esp
+  801a5c:	53                   	push   %ebx
+  801a5d:	6a 58                	push   $0x58
+  801a5f:	ff d6                	call   *%esi
+			putch('X', putdat);
+  801a61:	83 c4 08             	add    $0x8,%esp
+  801a64:	53                   	push   %ebx
+  801a65:	6a 58                	push   $0x58
+  801a67:	ff d6                	call   *%esi
+			break;
+  801a69:	83 c4 10             	add    $0x10,%esp
+  801a6c:	eb 42                	jmp    801ab0 <vprintfmt+0x3a1>
+			putch('0', putdat);
+  801a6e:	83 ec 08             	sub    $0x8,%esp
+  801a71:	53                   	push   %ebx
+  801a72:	6a 30                	push   $0x30
+  801a74:	ff d6                	call   *%esi
+			putch('x', putdat);
+  801a76:	83 c4 08             	add    $0x8,%esp
+  801a79:	53                   	push   %ebx
+  801a7a:	6a 78                	push   $0x78
+  801a7c:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  801a7e:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a81:	8b 10                	mov    (%eax),%edx
+  801a83:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  801a88:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  801a8b:	8d 40 04             	lea    0x4(%eax),%eax
+  801a8e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801a91:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  801a96:	83 ec 0c             	sub    $0xc,%esp
+  801a99:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  801a9d:	50                   	push   %eax
+  801a9e:	ff 75 e0             	push   -0x20(%ebp)
+  801aa1:	57                   	push   %edi
+  801aa2:	51                   	push   %ecx
+  801aa3:	52                   	push   %edx
+  801aa4:	89 da                	mov    %ebx,%edx
+  801aa6:	89 f0                	mov    %esi,%eax
+  801aa8:	e8 7f fb ff ff       	call   80162c <printnum>
+			break;
+  801aad:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  801ab0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801ab3:	e9 75 fc ff ff       	jmp    80172d <vprintfmt+0x1e>
+	if (lflag >= 2)
+  801ab8:	83 f9 01             	cmp    $0x1,%ecx
+  801abb:	7f 1b                	jg     801ad8 <vprintfmt+0x3c9>
+	else if (lflag)
+  801abd:	85 c9                	test   %ecx,%ecx
+  801abf:	74 2c                	je     801aed <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  801ac1:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ac4:	8b 10                	mov    (%eax),%edx
+  801ac6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801acb:	8d 40 04             	lea    0x4(%eax),%eax
+  801ace:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801ad1:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  801ad6:	eb be                	jmp    801a96 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  801ad8:	8b 45 14             	mov    0x14(%ebp),%eax
+  801adb:	8b 10                	mov    (%eax),%edx
+  801add:	8b 48 04             	mov    0x4(%eax),%ecx
+  801ae0:	8d 40 08             	lea    0x8(%eax),%eax
+  801ae3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801ae6:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  801aeb:	eb a9                	jmp    801a96 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  801aed:	8b 45 14             	mov    0x14(%ebp),%eax
+  801af0:	8b 10                	mov    (%eax),%edx
+  801af2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801af7:	8d 40 04             	lea    0x4(%eax),%eax
+  801afa:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801afd:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  801b02:	eb 92                	jmp    801a96 <vprintfmt+0x387>
+			putch(ch, putdat);
+  801b04:	83 ec 08             	sub    $0x8,%esp
+  801b07:	53                   	push   %ebx
+  801b08:	6a 25                	push   $0x25
+  801b0a:	ff d6                	call   *%esi
+			break;
+  801b0c:	83 c4 10             	add    $0x10,%esp
+  801b0f:	eb 9f                	jmp    801ab0 <vprintfmt+0x3a1>
+			putch('%', putdat);
+  801b11:	83 ec 08             	sub    $0x8,%esp
+  801b14:	53                   	push   %ebx
+  801b15:	6a 25                	push   $0x25
+  801b17:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801b19:	83 c4 10             	add    $0x10,%esp
+  801b1c:	89 f8                	mov    %edi,%eax
+  801b1e:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  801b22:	74 05                	je     801b29 <vprintfmt+0x41a>
+  801b24:	83 e8 01             	sub    $0x1,%eax
+  801b27:	eb f5                	jmp    801b1e <vprintfmt+0x40f>
+  801b29:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801b2c:	eb 82                	jmp    801ab0 <vprintfmt+0x3a1>
+
+00801b2e <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  801b2e:	55                   	push   %ebp
+  801b2f:	89 e5                	mov    %esp,%ebp
+  801b31:	83 ec 18             	sub    $0x18,%esp
+  801b34:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b37:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  801b3a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  801b3d:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  801b41:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  801b44:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  801b4b:	85 c0                	test   %eax,%eax
+  801b4d:	74 26                	je     801b75 <vsnprintf+0x47>
+  801b4f:	85 d2                	test   %edx,%edx
+  801b51:	7e 22                	jle    801b75 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  801b53:	ff 75 14             	push   0x14(%ebp)
+  801b56:	ff 75 10             	push   0x10(%ebp)
+  801b59:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  801b5c:	50                   	push   %eax
+  801b5d:	68 d5 16 80 00       	push   $0x8016d5
+  801b62:	e8 a8 fb ff ff       	call   80170f <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  801b67:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801b6a:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  801b6d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b70:	83 c4 10             	add    $0x10,%esp
+}
+  801b73:	c9                   	leave
+  801b74:	c3                   	ret
+		return -E_INVAL;
+  801b75:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b7a:	eb f7                	jmp    801b73 <vsnprintf+0x45>
+
+00801b7c <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801b7c:	55                   	push   %ebp
+  801b7d:	89 e5                	mov    %esp,%ebp
+  801b7f:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  801b82:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  801b85:	50                   	push   %eax
+  801b86:	ff 75 10             	push   0x10(%ebp)
+  801b89:	ff 75 0c             	push   0xc(%ebp)
+  801b8c:	ff 75 08             	push   0x8(%ebp)
+  801b8f:	e8 9a ff ff ff       	call   801b2e <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  801b94:	c9                   	leave
+  801b95:	c3                   	ret
+
+00801b96 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  801b96:	55                   	push   %ebp
+  801b97:	89 e5                	mov    %esp,%ebp
+  801b99:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  801b9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ba1:	eb 03                	jmp    801ba6 <strlen+0x10>
+		n++;
+  801ba3:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  801ba6:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  801baa:	75 f7                	jne    801ba3 <strlen+0xd>
+	return n;
+}
+  801bac:	5d                   	pop    %ebp
+  801bad:	c3                   	ret
+
+00801bae <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  801bae:	55                   	push   %ebp
+  801baf:	89 e5                	mov    %esp,%ebp
+  801bb1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801bb4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801bb7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bbc:	eb 03                	jmp    801bc1 <strnlen+0x13>
+		n++;
+  801bbe:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801bc1:	39 d0                	cmp    %edx,%eax
+  801bc3:	74 08                	je     801bcd <strnlen+0x1f>
+  801bc5:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  801bc9:	75 f3                	jne    801bbe <strnlen+0x10>
+  801bcb:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  801bcd:	89 d0                	mov    %edx,%eax
+  801bcf:	5d                   	pop    %ebp
+  801bd0:	c3                   	ret
+
+00801bd1 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801bd1:	55                   	push   %ebp
+  801bd2:	89 e5                	mov    %esp,%ebp
+  801bd4:	53                   	push   %ebx
+  801bd5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801bd8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  801bdb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801be0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  801be4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  801be7:	83 c0 01             	add    $0x1,%eax
+  801bea:	84 d2                	test   %dl,%dl
+  801bec:	75 f2                	jne    801be0 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  801bee:	89 c8                	mov    %ecx,%eax
+  801bf0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bf3:	c9                   	leave
+  801bf4:	c3                   	ret
+
+00801bf5 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801bf5:	55                   	push   %ebp
+  801bf6:	89 e5                	mov    %esp,%ebp
+  801bf8:	53                   	push   %ebx
+  801bf9:	83 ec 10             	sub    $0x10,%esp
+  801bfc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  801bff:	53                   	push   %ebx
+  801c00:	e8 91 ff ff ff       	call   801b96 <strlen>
+  801c05:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  801c08:	ff 75 0c             	push   0xc(%ebp)
+  801c0b:	01 d8                	add    %ebx,%eax
+  801c0d:	50                   	push   %eax
+  801c0e:	e8 be ff ff ff       	call   801bd1 <strcpy>
+	return dst;
+}
+  801c13:	89 d8                	mov    %ebx,%eax
+  801c15:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c18:	c9                   	leave
+  801c19:	c3                   	ret
+
+00801c1a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801c1a:	55                   	push   %ebp
+  801c1b:	89 e5                	mov    %esp,%ebp
+  801c1d:	56                   	push   %esi
+  801c1e:	53                   	push   %ebx
+  801c1f:	8b 75 08             	mov    0x8(%ebp),%esi
+  801c22:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  801c25:	89 f3                	mov    %esi,%ebx
+  801c27:	03 5d 10             	add    0x10(%ebp),%ebx
+  801c2a:	89 f0                	mov    %esi,%eax
+  801c2c:	eb 0f                	jmp    801c3d <strncpy+0x23>
+		*dst++ = *src;
+  801c2e:	83 c0 01             	add    $0x1,%eax
+  801c31:	0f b6 0a             	movzbl (%edx),%ecx
+  801c34:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  801c37:	80 f9 01             	cmp    $0x1,%cl
+  801c3a:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  801c3d:	39 d8                	cmp    %ebx,%eax
+  801c3f:	75 ed                	jne    801c2e <strncpy+0x14>
+	}
+	return ret;
+}
+  801c41:	89 f0                	mov    %esi,%eax
+  801c43:	5b                   	pop    %ebx
+  801c44:	5e                   	pop    %esi
+  801c45:	5d                   	pop    %ebp
+  801c46:	c3                   	ret
+
+00801c47 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801c47:	55                   	push   %ebp
+  801c48:	89 e5                	mov    %esp,%ebp
+  801c4a:	56                   	push   %esi
+  801c4b:	53                   	push   %ebx
+  801c4c:	8b 75 08             	mov    0x8(%ebp),%esi
+  801c4f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c52:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  801c55:	89 f0                	mov    %esi,%eax
+  801c57:	85 d2                	test   %edx,%edx
+  801c59:	74 21                	je     801c7c <strlcpy+0x35>
+  801c5b:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  801c5f:	89 f2                	mov    %esi,%edx
+  801c61:	eb 09                	jmp    801c6c <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  801c63:	83 c1 01             	add    $0x1,%ecx
+  801c66:	83 c2 01             	add    $0x1,%edx
+  801c69:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  801c6c:	39 c2                	cmp    %eax,%edx
+  801c6e:	74 09                	je     801c79 <strlcpy+0x32>
+  801c70:	0f b6 19             	movzbl (%ecx),%ebx
+  801c73:	84 db                	test   %bl,%bl
+  801c75:	75 ec                	jne    801c63 <strlcpy+0x1c>
+  801c77:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  801c79:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  801c7c:	29 f0                	sub    %esi,%eax
+}
+  801c7e:	5b                   	pop    %ebx
+  801c7f:	5e                   	pop    %esi
+  801c80:	5d                   	pop    %ebp
+  801c81:	c3                   	ret
+
+00801c82 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  801c82:	55                   	push   %ebp
+  801c83:	89 e5                	mov    %esp,%ebp
+  801c85:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801c88:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  801c8b:	eb 06                	jmp    801c93 <strcmp+0x11>
+		p++, q++;
+  801c8d:	83 c1 01             	add    $0x1,%ecx
+  801c90:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  801c93:	0f b6 01             	movzbl (%ecx),%eax
+  801c96:	84 c0                	test   %al,%al
+  801c98:	74 04                	je     801c9e <strcmp+0x1c>
+  801c9a:	3a 02                	cmp    (%edx),%al
+  801c9c:	74 ef                	je     801c8d <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801c9e:	0f b6 c0             	movzbl %al,%eax
+  801ca1:	0f b6 12             	movzbl (%edx),%edx
+  801ca4:	29 d0                	sub    %edx,%eax
+}
+  801ca6:	5d                   	pop    %ebp
+  801ca7:	c3                   	ret
+
+00801ca8 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801ca8:	55                   	push   %ebp
+  801ca9:	89 e5                	mov    %esp,%ebp
+  801cab:	53                   	push   %ebx
+  801cac:	8b 45 08             	mov    0x8(%ebp),%eax
+  801caf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801cb2:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  801cb5:	eb 09                	jmp    801cc0 <strncmp+0x18>
+		n--, p++, q++;
+  801cb7:	83 ea 01             	sub    $0x1,%edx
+  801cba:	83 c0 01             	add    $0x1,%eax
+  801cbd:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  801cc0:	85 d2                	test   %edx,%edx
+  801cc2:	74 18                	je     801cdc <strncmp+0x34>
+  801cc4:	0f b6 18             	movzbl (%eax),%ebx
+  801cc7:	84 db                	test   %bl,%bl
+  801cc9:	74 04                	je     801ccf <strncmp+0x27>
+  801ccb:	3a 19                	cmp    (%ecx),%bl
+  801ccd:	74 e8                	je     801cb7 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801ccf:	0f b6 00             	movzbl (%eax),%eax
+  801cd2:	0f b6 11             	movzbl (%ecx),%edx
+  801cd5:	29 d0                	sub    %edx,%eax
+}
+  801cd7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cda:	c9                   	leave
+  801cdb:	c3                   	ret
+		return 0;
+  801cdc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ce1:	eb f4                	jmp    801cd7 <strncmp+0x2f>
+
+00801ce3 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801ce3:	55                   	push   %ebp
+  801ce4:	89 e5                	mov    %esp,%ebp
+  801ce6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ce9:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801ced:	eb 03                	jmp    801cf2 <strchr+0xf>
+  801cef:	83 c0 01             	add    $0x1,%eax
+  801cf2:	0f b6 10             	movzbl (%eax),%edx
+  801cf5:	84 d2                	test   %dl,%dl
+  801cf7:	74 06                	je     801cff <strchr+0x1c>
+		if (*s == c)
+  801cf9:	38 ca                	cmp    %cl,%dl
+  801cfb:	75 f2                	jne    801cef <strchr+0xc>
+  801cfd:	eb 05                	jmp    801d04 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  801cff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d04:	5d                   	pop    %ebp
+  801d05:	c3                   	ret
+
+00801d06 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801d06:	55                   	push   %ebp
+  801d07:	89 e5                	mov    %esp,%ebp
+  801d09:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d0c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801d10:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  801d13:	38 ca                	cmp    %cl,%dl
+  801d15:	74 09                	je     801d20 <strfind+0x1a>
+  801d17:	84 d2                	test   %dl,%dl
+  801d19:	74 05                	je     801d20 <strfind+0x1a>
+	for (; *s; s++)
+  801d1b:	83 c0 01             	add    $0x1,%eax
+  801d1e:	eb f0                	jmp    801d10 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  801d20:	5d                   	pop    %ebp
+  801d21:	c3                   	ret
+
+00801d22 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801d22:	55                   	push   %ebp
+  801d23:	89 e5                	mov    %esp,%ebp
+  801d25:	57                   	push   %edi
+  801d26:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801d29:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  801d2c:	85 c9                	test   %ecx,%ecx
+  801d2e:	74 20                	je     801d50 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  801d30:	89 f8                	mov    %edi,%eax
+  801d32:	09 c8                	or     %ecx,%eax
+  801d34:	a8 03                	test   $0x3,%al
+  801d36:	75 12                	jne    801d4a <memset+0x28>
+		c &= 0xFF;
+  801d38:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  801d3c:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  801d42:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  801d45:	fc                   	cld
+  801d46:	f3 ab                	rep stos %eax,%es:(%edi)
+  801d48:	eb 06                	jmp    801d50 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801d4a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d4d:	fc                   	cld
+  801d4e:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  801d50:	89 f8                	mov    %edi,%eax
+  801d52:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  801d55:	c9                   	leave
+  801d56:	c3                   	ret
+
+00801d57 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801d57:	55                   	push   %ebp
+  801d58:	89 e5                	mov    %esp,%ebp
+  801d5a:	57                   	push   %edi
+  801d5b:	56                   	push   %esi
+  801d5c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d5f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801d62:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  801d65:	39 c6                	cmp    %eax,%esi
+  801d67:	73 32                	jae    801d9b <memmove+0x44>
+  801d69:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  801d6c:	39 d0                	cmp    %edx,%eax
+  801d6e:	73 2b                	jae    801d9b <memmove+0x44>
+		s += n;
+		d += n;
+  801d70:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801d73:	89 d6                	mov    %edx,%esi
+  801d75:	09 fe                	or     %edi,%esi
+  801d77:	09 ce                	or     %ecx,%esi
+  801d79:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  801d7f:	75 0e                	jne    801d8f <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801d81:	83 ef 04             	sub    $0x4,%edi
+  801d84:	8d 72 fc             	lea    -0x4(%edx),%esi
+  801d87:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  801d8a:	fd                   	std
+  801d8b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801d8d:	eb 09                	jmp    801d98 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801d8f:	83 ef 01             	sub    $0x1,%edi
+  801d92:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  801d95:	fd                   	std
+  801d96:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801d98:	fc                   	cld
+  801d99:	eb 1a                	jmp    801db5 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801d9b:	89 f2                	mov    %esi,%edx
+  801d9d:	09 c2                	or     %eax,%edx
+  801d9f:	09 ca                	or     %ecx,%edx
+  801da1:	f6 c2 03             	test   $0x3,%dl
+  801da4:	75 0a                	jne    801db0 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801da6:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  801da9:	89 c7                	mov    %eax,%edi
+  801dab:	fc                   	cld
+  801dac:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801dae:	eb 05                	jmp    801db5 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  801db0:	89 c7                	mov    %eax,%edi
+  801db2:	fc                   	cld
+  801db3:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  801db5:	5e                   	pop    %esi
+  801db6:	5f                   	pop    %edi
+  801db7:	5d                   	pop    %ebp
+  801db8:	c3                   	ret
+
+00801db9 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801db9:	55                   	push   %ebp
+  801dba:	89 e5                	mov    %esp,%ebp
+  801dbc:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  801dbf:	ff 75 10             	push   0x10(%ebp)
+  801dc2:	ff 75 0c             	push   0xc(%ebp)
+  801dc5:	ff 75 08             	push   0x8(%ebp)
+  801dc8:	e8 8a ff ff ff       	call   801d57 <memmove>
+}
+  801dcd:	c9                   	leave
+  801dce:	c3                   	ret
+
+00801dcf <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801dcf:	55                   	push   %ebp
+  801dd0:	89 e5                	mov    %esp,%ebp
+  801dd2:	56                   	push   %esi
+  801dd3:	53                   	push   %ebx
+  801dd4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dd7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  801dda:	89 c6                	mov    %eax,%esi
+  801ddc:	03 75 10             	add    0x10(%ebp),%esi
+  801ddf:	eb 06                	jmp    801de7 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  801de1:	83 c0 01             	add    $0x1,%eax
+  801de4:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  801de7:	39 f0                	cmp    %esi,%eax
+  801de9:	74 14                	je     801dff <memcmp+0x30>
+		if (*s1 != *s2)
+  801deb:	0f b6 08             	movzbl (%eax),%ecx
+  801dee:	0f b6 1a             	movzbl (%edx),%ebx
+  801df1:	38 d9                	cmp    %bl,%cl
+  801df3:	74 ec                	je     801de1 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  801df5:	0f b6 c1             	movzbl %cl,%eax
+  801df8:	0f b6 db             	movzbl %bl,%ebx
+  801dfb:	29 d8                	sub    %ebx,%eax
+  801dfd:	eb 05                	jmp    801e04 <memcmp+0x35>
+	}
+
+	return 0;
+  801dff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e04:	5b                   	pop    %ebx
+  801e05:	5e                   	pop    %esi
+  801e06:	5d                   	pop    %ebp
+  801e07:	c3                   	ret
+
+00801e08 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801e08:	55                   	push   %ebp
+  801e09:	89 e5                	mov    %esp,%ebp
+  801e0b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e0e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  801e11:	89 c2                	mov    %eax,%edx
+  801e13:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  801e16:	eb 03                	jmp    801e1b <memfind+0x13>
+  801e18:	83 c0 01             	add    $0x1,%eax
+  801e1b:	39 d0                	cmp    %edx,%eax
+  801e1d:	73 04                	jae    801e23 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801e1f:	38 08                	cmp    %cl,(%eax)
+  801e21:	75 f5                	jne    801e18 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  801e23:	5d                   	pop    %ebp
+  801e24:	c3                   	ret
+
+00801e25 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  801e25:	55                   	push   %ebp
+  801e26:	89 e5                	mov    %esp,%ebp
+  801e28:	57                   	push   %edi
+  801e29:	56                   	push   %esi
+  801e2a:	53                   	push   %ebx
+  801e2b:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e2e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801e31:	eb 03                	jmp    801e36 <strtol+0x11>
+		s++;
+  801e33:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  801e36:	0f b6 02             	movzbl (%edx),%eax
+  801e39:	3c 20                	cmp    $0x20,%al
+  801e3b:	74 f6                	je     801e33 <strtol+0xe>
+  801e3d:	3c 09                	cmp    $0x9,%al
+  801e3f:	74 f2                	je     801e33 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  801e41:	3c 2b                	cmp    $0x2b,%al
+  801e43:	74 2a                	je     801e6f <strtol+0x4a>
+	int neg = 0;
+  801e45:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  801e4a:	3c 2d                	cmp    $0x2d,%al
+  801e4c:	74 2b                	je     801e79 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801e4e:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  801e54:	75 0f                	jne    801e65 <strtol+0x40>
+  801e56:	80 3a 30             	cmpb   $0x30,(%edx)
+  801e59:	74 28                	je     801e83 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  801e5b:	85 db                	test   %ebx,%ebx
+  801e5d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801e62:	0f 44 d8             	cmove  %eax,%ebx
+  801e65:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e6a:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  801e6d:	eb 46                	jmp    801eb5 <strtol+0x90>
+		s++;
+  801e6f:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  801e72:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e77:	eb d5                	jmp    801e4e <strtol+0x29>
+		s++, neg = 1;
+  801e79:	83 c2 01             	add    $0x1,%edx
+  801e7c:	bf 01 00 00 00       	mov    $0x1,%edi
+  801e81:	eb cb                	jmp    801e4e <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801e83:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  801e87:	74 0e                	je     801e97 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  801e89:	85 db                	test   %ebx,%ebx
+  801e8b:	75 d8                	jne    801e65 <strtol+0x40>
+		s++, base = 8;
+  801e8d:	83 c2 01             	add    $0x1,%edx
+  801e90:	bb 08 00 00 00       	mov    $0x8,%ebx
+  801e95:	eb ce                	jmp    801e65 <strtol+0x40>
+		s += 2, base = 16;
+  801e97:	83 c2 02             	add    $0x2,%edx
+  801e9a:	bb 10 00 00 00       	mov    $0x10,%ebx
+  801e9f:	eb c4                	jmp    801e65 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  801ea1:	0f be c0             	movsbl %al,%eax
+  801ea4:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  801ea7:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801eaa:	7d 3a                	jge    801ee6 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  801eac:	83 c2 01             	add    $0x1,%edx
+  801eaf:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  801eb3:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  801eb5:	0f b6 02             	movzbl (%edx),%eax
+  801eb8:	8d 70 d0             	lea    -0x30(%eax),%esi
+  801ebb:	89 f3                	mov    %esi,%ebx
+  801ebd:	80 fb 09             	cmp    $0x9,%bl
+  801ec0:	76 df                	jbe    801ea1 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  801ec2:	8d 70 9f             	lea    -0x61(%eax),%esi
+  801ec5:	89 f3                	mov    %esi,%ebx
+  801ec7:	80 fb 19             	cmp    $0x19,%bl
+  801eca:	77 08                	ja     801ed4 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  801ecc:	0f be c0             	movsbl %al,%eax
+  801ecf:	83 e8 57             	sub    $0x57,%eax
+  801ed2:	eb d3                	jmp    801ea7 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  801ed4:	8d 70 bf             	lea    -0x41(%eax),%esi
+  801ed7:	89 f3                	mov    %esi,%ebx
+  801ed9:	80 fb 19             	cmp    $0x19,%bl
+  801edc:	77 08                	ja     801ee6 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  801ede:	0f be c0             	movsbl %al,%eax
+  801ee1:	83 e8 37             	sub    $0x37,%eax
+  801ee4:	eb c1                	jmp    801ea7 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801ee6:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  801eea:	74 05                	je     801ef1 <strtol+0xcc>
+		*endptr = (char *) s;
+  801eec:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801eef:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  801ef1:	89 c8                	mov    %ecx,%eax
+  801ef3:	f7 d8                	neg    %eax
+  801ef5:	85 ff                	test   %edi,%edi
+  801ef7:	0f 45 c8             	cmovne %eax,%ecx
+}
+  801efa:	89 c8                	mov    %ecx,%eax
+  801efc:	5b                   	pop    %ebx
+  801efd:	5e                   	pop    %esi
+  801efe:	5f                   	pop    %edi
+  801eff:	5d                   	pop    %ebp
+  801f00:	c3                   	ret
+
+00801f01 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  801f01:	55                   	push   %ebp
+  801f02:	89 e5                	mov    %esp,%ebp
+  801f04:	56                   	push   %esi
+  801f05:	53                   	push   %ebx
+  801f06:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f09:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f0c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  801f0f:	85 c0                	test   %eax,%eax
+  801f11:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801f16:	0f 44 c2             	cmove  %edx,%eax
+  801f19:	83 ec 0c             	sub    $0xc,%esp
+  801f1c:	50                   	push   %eax
+  801f1d:	e8 e7 e3 ff ff       	call   800309 <sys_ipc_recv>
+
+  if (from_env_store)
+  801f22:	83 c4 10             	add    $0x10,%esp
+  801f25:	85 f6                	test   %esi,%esi
+  801f27:	74 17                	je     801f40 <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  801f29:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f2e:	85 c0                	test   %eax,%eax
+  801f30:	75 0c                	jne    801f3e <ipc_recv+0x3d>
+  801f32:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801f38:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  801f3e:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  801f40:	85 db                	test   %ebx,%ebx
+  801f42:	74 2b                	je     801f6f <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  801f44:	85 c0                	test   %eax,%eax
+  801f46:	74 0d                	je     801f55 <ipc_recv+0x54>
+  801f48:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  801f4e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f51:	5b                   	pop    %ebx
+  801f52:	5e                   	pop    %esi
+  801f53:	5d                   	pop    %ebp
+  801f54:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  801f55:	a1 08 40 80 00       	mov    0x804008,%eax
+  801f5a:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  801f60:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  801f62:	a1 08 40 80 00       	mov    0x804008,%eax
+  801f67:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  801f6d:	eb df                	jmp    801f4e <ipc_recv+0x4d>
+  801f6f:	85 c0                	test   %eax,%eax
+  801f71:	75 db                	jne    801f4e <ipc_recv+0x4d>
+  801f73:	eb ed                	jmp    801f62 <ipc_recv+0x61>
+
+00801f75 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  801f75:	55                   	push   %ebp
+  801f76:	89 e5                	mov    %esp,%ebp
+  801f78:	57                   	push   %edi
+  801f79:	56                   	push   %esi
+  801f7a:	53                   	push   %ebx
+  801f7b:	83 ec 0c             	sub    $0xc,%esp
+  801f7e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801f81:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801f84:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  801f87:	85 db                	test   %ebx,%ebx
+  801f89:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801f8e:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  801f91:	ff 75 14             	push   0x14(%ebp)
+  801f94:	53                   	push   %ebx
+  801f95:	56                   	push   %esi
+  801f96:	57                   	push   %edi
+  801f97:	e8 4a e3 ff ff       	call   8002e6 <sys_ipc_try_send>
+  801f9c:	83 c4 10             	add    $0x10,%esp
+  801f9f:	85 c0                	test   %eax,%eax
+  801fa1:	74 1e                	je     801fc1 <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  801fa3:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801fa6:	75 07                	jne    801faf <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  801fa8:	e8 8d e1 ff ff       	call   80013a <sys_yield>
+  801fad:	eb e2                	jmp    801f91 <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  801faf:	50                   	push   %eax
+  801fb0:	68 83 29 80 00       	push   $0x802983
+  801fb5:	6a 3c                	push   $0x3c
+  801fb7:	68 90 29 80 00       	push   $0x802990
+  801fbc:	e8 7c f5 ff ff       	call   80153d <_panic>
+  }
+
+#endif
+}
+  801fc1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fc4:	5b                   	pop    %ebx
+  801fc5:	5e                   	pop    %esi
+  801fc6:	5f                   	pop    %edi
+  801fc7:	5d                   	pop    %ebp
+  801fc8:	c3                   	ret
+
+00801fc9 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  801fc9:	55                   	push   %ebp
+  801fca:	89 e5                	mov    %esp,%ebp
+  801fcc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  801fcf:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  801fd4:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  801fd7:	c1 e0 04             	shl    $0x4,%eax
+  801fda:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801fdf:	8b 40 50             	mov    0x50(%eax),%eax
+  801fe2:	39 c8                	cmp    %ecx,%eax
+  801fe4:	74 12                	je     801ff8 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  801fe6:	83 c2 01             	add    $0x1,%edx
+  801fe9:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  801fef:	75 e3                	jne    801fd4 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  801ff1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ff6:	eb 0e                	jmp    802006 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  801ff8:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  801ffb:	c1 e0 04             	shl    $0x4,%eax
+  801ffe:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802003:	8b 40 48             	mov    0x48(%eax),%eax
+  802006:	5d                   	pop    %ebp
+  802007:	c3                   	ret
+
+00802008 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802008:	55                   	push   %ebp
+  802009:	89 e5                	mov    %esp,%ebp
+  80200b:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80200e:	89 c2                	mov    %eax,%edx
+  802010:	c1 ea 16             	shr    $0x16,%edx
+  802013:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80201a:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80201f:	f6 c1 01             	test   $0x1,%cl
+  802022:	74 1c                	je     802040 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  802024:	c1 e8 0c             	shr    $0xc,%eax
+  802027:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80202e:	a8 01                	test   $0x1,%al
+  802030:	74 0e                	je     802040 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802032:	c1 e8 0c             	shr    $0xc,%eax
+  802035:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  80203c:	ef 
+  80203d:	0f b7 d2             	movzwl %dx,%edx
+}
+  802040:	89 d0                	mov    %edx,%eax
+  802042:	5d                   	pop    %ebp
+  802043:	c3                   	ret
+  802044:	66 90                	xchg   %ax,%ax
+  802046:	66 90                	xchg   %ax,%ax
+  802048:	66 90                	xchg   %ax,%ax
+  80204a:	66 90                	xchg   %ax,%ax
+  80204c:	66 90                	xchg   %ax,%ax
+  80204e:	66 90                	xchg   %ax,%ax
+
+00802050 <__udivmoddi4>:
+  802050:	55                   	push   %ebp
+  802051:	57                   	push   %edi
+  802052:	56                   	push   %esi
+  802053:	53                   	push   %ebx
+  802054:	83 ec 24             	sub    $0x24,%esp
+  802057:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80205b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80205f:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  802063:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802067:	8b 54 24 44          	mov    0x44(%esp),%edx
+  80206b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80206f:	8b 44 24 40          	mov    0x40(%esp),%eax
+  802073:	89 d3                	mov    %edx,%ebx
+  802075:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802079:	09 c3                	or     %eax,%ebx
+  80207b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80207f:	0f 84 9c 00 00 00    	je     802121 <__udivmoddi4+0xd1>
+  802085:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80208c:	00 
+  80208d:	31 c0                	xor    %eax,%eax
+  80208f:	31 d2                	xor    %edx,%edx
+  802091:	89 fb                	mov    %edi,%ebx
+  802093:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80209a:	00 
+  80209b:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8020a0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8020a4:	01 c0                	add    %eax,%eax
+  8020a6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8020ad:	00 
+  8020ae:	89 c6                	mov    %eax,%esi
+  8020b0:	89 d7                	mov    %edx,%edi
+  8020b2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8020b6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8020ba:	0f ad d0             	shrd   %cl,%edx,%eax
+  8020bd:	d3 ea                	shr    %cl,%edx
+  8020bf:	f6 c1 20             	test   $0x20,%cl
+  8020c2:	0f 45 c2             	cmovne %edx,%eax
+  8020c5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8020c9:	83 e0 01             	and    $0x1,%eax
+  8020cc:	09 fa                	or     %edi,%edx
+  8020ce:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8020d2:	89 04 24             	mov    %eax,(%esp)
+  8020d5:	8b 04 24             	mov    (%esp),%eax
+  8020d8:	89 d5                	mov    %edx,%ebp
+  8020da:	09 f0                	or     %esi,%eax
+  8020dc:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8020e0:	39 f0                	cmp    %esi,%eax
+  8020e2:	19 fd                	sbb    %edi,%ebp
+  8020e4:	72 1d                	jb     802103 <__udivmoddi4+0xb3>
+  8020e6:	29 f0                	sub    %esi,%eax
+  8020e8:	19 fa                	sbb    %edi,%edx
+  8020ea:	89 cf                	mov    %ecx,%edi
+  8020ec:	c1 ef 05             	shr    $0x5,%edi
+  8020ef:	83 e7 01             	and    $0x1,%edi
+  8020f2:	89 fe                	mov    %edi,%esi
+  8020f4:	d3 e7                	shl    %cl,%edi
+  8020f6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8020fa:	83 f6 01             	xor    $0x1,%esi
+  8020fd:	d3 e6                	shl    %cl,%esi
+  8020ff:	09 74 24 18          	or     %esi,0x18(%esp)
+  802103:	83 e9 01             	sub    $0x1,%ecx
+  802106:	73 98                	jae    8020a0 <__udivmoddi4+0x50>
+  802108:	85 db                	test   %ebx,%ebx
+  80210a:	74 05                	je     802111 <__udivmoddi4+0xc1>
+  80210c:	89 03                	mov    %eax,(%ebx)
+  80210e:	89 53 04             	mov    %edx,0x4(%ebx)
+  802111:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802115:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802119:	83 c4 24             	add    $0x24,%esp
+  80211c:	5b                   	pop    %ebx
+  80211d:	5e                   	pop    %esi
+  80211e:	5f                   	pop    %edi
+  80211f:	5d                   	pop    %ebp
+  802120:	c3                   	ret
+  802121:	85 ff                	test   %edi,%edi
+  802123:	74 0d                	je     802132 <__udivmoddi4+0xe2>
+  802125:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  80212b:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  802132:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802136:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80213a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80213e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802142:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802146:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80214a:	83 c4 24             	add    $0x24,%esp
+  80214d:	5b                   	pop    %ebx
+  80214e:	5e                   	pop    %esi
+  80214f:	5f                   	pop    %edi
+  802150:	5d                   	pop    %ebp
+  802151:	c3                   	ret
+  802152:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802159:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00802160 <__udivdi3>:
+  802160:	57                   	push   %edi
+  802161:	56                   	push   %esi
+  802162:	53                   	push   %ebx
+  802163:	83 ec 20             	sub    $0x20,%esp
+  802166:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80216a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80216e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802172:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802176:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80217a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80217e:	89 d1                	mov    %edx,%ecx
+  802180:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802184:	09 c1                	or     %eax,%ecx
+  802186:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80218a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80218e:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802192:	0f 84 88 00 00 00    	je     802220 <__udivdi3+0xc0>
+  802198:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80219f:	00 
+  8021a0:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8021a5:	31 c0                	xor    %eax,%eax
+  8021a7:	31 d2                	xor    %edx,%edx
+  8021a9:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8021b0:	00 
+  8021b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8021b8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8021bc:	01 c0                	add    %eax,%eax
+  8021be:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8021c5:	00 
+  8021c6:	89 c6                	mov    %eax,%esi
+  8021c8:	89 d7                	mov    %edx,%edi
+  8021ca:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8021ce:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8021d2:	0f ad d0             	shrd   %cl,%edx,%eax
+  8021d5:	d3 ea                	shr    %cl,%edx
+  8021d7:	f6 c1 20             	test   $0x20,%cl
+  8021da:	0f 45 c2             	cmovne %edx,%eax
+  8021dd:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8021e1:	83 e0 01             	and    $0x1,%eax
+  8021e4:	09 fa                	or     %edi,%edx
+  8021e6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8021ea:	89 04 24             	mov    %eax,(%esp)
+  8021ed:	8b 04 24             	mov    (%esp),%eax
+  8021f0:	89 d3                	mov    %edx,%ebx
+  8021f2:	09 f0                	or     %esi,%eax
+  8021f4:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8021f8:	39 f0                	cmp    %esi,%eax
+  8021fa:	19 fb                	sbb    %edi,%ebx
+  8021fc:	72 1d                	jb     80221b <__udivdi3+0xbb>
+  8021fe:	29 f0                	sub    %esi,%eax
+  802200:	19 fa                	sbb    %edi,%edx
+  802202:	89 cf                	mov    %ecx,%edi
+  802204:	c1 ef 05             	shr    $0x5,%edi
+  802207:	83 e7 01             	and    $0x1,%edi
+  80220a:	89 fe                	mov    %edi,%esi
+  80220c:	d3 e7                	shl    %cl,%edi
+  80220e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802212:	83 f6 01             	xor    $0x1,%esi
+  802215:	d3 e6                	shl    %cl,%esi
+  802217:	09 74 24 18          	or     %esi,0x18(%esp)
+  80221b:	83 e9 01             	sub    $0x1,%ecx
+  80221e:	73 98                	jae    8021b8 <__udivdi3+0x58>
+  802220:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802224:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802228:	83 c4 20             	add    $0x20,%esp
+  80222b:	5b                   	pop    %ebx
+  80222c:	5e                   	pop    %esi
+  80222d:	5f                   	pop    %edi
+  80222e:	c3                   	ret
+  80222f:	90                   	nop
+
+00802230 <__umoddi3>:
+  802230:	57                   	push   %edi
+  802231:	56                   	push   %esi
+  802232:	53                   	push   %ebx
+  802233:	83 ec 18             	sub    $0x18,%esp
+  802236:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80223a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80223e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802242:	8b 54 24 34          	mov    0x34(%esp),%edx
+  802246:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80224a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80224e:	89 d1                	mov    %edx,%ecx
+  802250:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802254:	09 c1                	or     %eax,%ecx
+  802256:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80225a:	74 5b                	je     8022b7 <__umoddi3+0x87>
+  80225c:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802261:	31 c0                	xor    %eax,%eax
+  802263:	31 d2                	xor    %edx,%edx
+  802265:	8d 76 00             	lea    0x0(%esi),%esi
+  802268:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80226c:	01 c0                	add    %eax,%eax
+  80226e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802275:	00 
+  802276:	89 c6                	mov    %eax,%esi
+  802278:	89 d7                	mov    %edx,%edi
+  80227a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80227e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802282:	0f ad d0             	shrd   %cl,%edx,%eax
+  802285:	d3 ea                	shr    %cl,%edx
+  802287:	f6 c1 20             	test   $0x20,%cl
+  80228a:	0f 45 c2             	cmovne %edx,%eax
+  80228d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802291:	83 e0 01             	and    $0x1,%eax
+  802294:	09 fa                	or     %edi,%edx
+  802296:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80229a:	89 04 24             	mov    %eax,(%esp)
+  80229d:	8b 04 24             	mov    (%esp),%eax
+  8022a0:	89 d3                	mov    %edx,%ebx
+  8022a2:	09 f0                	or     %esi,%eax
+  8022a4:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8022a8:	39 f0                	cmp    %esi,%eax
+  8022aa:	19 fb                	sbb    %edi,%ebx
+  8022ac:	72 04                	jb     8022b2 <__umoddi3+0x82>
+  8022ae:	29 f0                	sub    %esi,%eax
+  8022b0:	19 fa                	sbb    %edi,%edx
+  8022b2:	83 e9 01             	sub    $0x1,%ecx
+  8022b5:	73 b1                	jae    802268 <__umoddi3+0x38>
+  8022b7:	83 c4 18             	add    $0x18,%esp
+  8022ba:	5b                   	pop    %ebx
+  8022bb:	5e                   	pop    %esi
+  8022bc:	5f                   	pop    %edi
+  8022bd:	c3                   	ret
+  8022be:	66 90                	xchg   %ax,%ax
+
+008022c0 <__divdi3>:
+  8022c0:	55                   	push   %ebp
+  8022c1:	57                   	push   %edi
+  8022c2:	56                   	push   %esi
+  8022c3:	53                   	push   %ebx
+  8022c4:	83 ec 24             	sub    $0x24,%esp
+  8022c7:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  8022cb:	8b 74 24 44          	mov    0x44(%esp),%esi
+  8022cf:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8022d3:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8022d7:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  8022db:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8022df:	85 d2                	test   %edx,%edx
+  8022e1:	0f 88 e0 00 00 00    	js     8023c7 <__divdi3+0x107>
+  8022e7:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  8022eb:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  8022ef:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8022f3:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8022f7:	85 f6                	test   %esi,%esi
+  8022f9:	78 16                	js     802311 <__divdi3+0x51>
+  8022fb:	89 f1                	mov    %esi,%ecx
+  8022fd:	31 c0                	xor    %eax,%eax
+  8022ff:	31 d2                	xor    %edx,%edx
+  802301:	09 d9                	or     %ebx,%ecx
+  802303:	0f 85 f3 00 00 00    	jne    8023fc <__divdi3+0x13c>
+  802309:	83 c4 24             	add    $0x24,%esp
+  80230c:	5b                   	pop    %ebx
+  80230d:	5e                   	pop    %esi
+  80230e:	5f                   	pop    %edi
+  80230f:	5d                   	pop    %ebp
+  802310:	c3                   	ret
+  802311:	bf 01 00 00 00       	mov    $0x1,%edi
+  802316:	f7 5c 24 08          	negl   0x8(%esp)
+  80231a:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  80231f:	f7 5c 24 0c          	negl   0xc(%esp)
+  802323:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80232a:	00 
+  80232b:	31 c0                	xor    %eax,%eax
+  80232d:	31 d2                	xor    %edx,%edx
+  80232f:	89 fb                	mov    %edi,%ebx
+  802331:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802338:	00 
+  802339:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80233e:	66 90                	xchg   %ax,%ax
+  802340:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802344:	01 c0                	add    %eax,%eax
+  802346:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80234d:	00 
+  80234e:	89 c6                	mov    %eax,%esi
+  802350:	89 d7                	mov    %edx,%edi
+  802352:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802356:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80235a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80235d:	d3 ea                	shr    %cl,%edx
+  80235f:	f6 c1 20             	test   $0x20,%cl
+  802362:	0f 45 c2             	cmovne %edx,%eax
+  802365:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802369:	83 e0 01             	and    $0x1,%eax
+  80236c:	09 fa                	or     %edi,%edx
+  80236e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802372:	89 04 24             	mov    %eax,(%esp)
+  802375:	8b 04 24             	mov    (%esp),%eax
+  802378:	89 d5                	mov    %edx,%ebp
+  80237a:	09 f0                	or     %esi,%eax
+  80237c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802380:	39 f0                	cmp    %esi,%eax
+  802382:	19 fd                	sbb    %edi,%ebp
+  802384:	72 1d                	jb     8023a3 <__divdi3+0xe3>
+  802386:	29 f0                	sub    %esi,%eax
+  802388:	19 fa                	sbb    %edi,%edx
+  80238a:	89 cf                	mov    %ecx,%edi
+  80238c:	c1 ef 05             	shr    $0x5,%edi
+  80238f:	83 e7 01             	and    $0x1,%edi
+  802392:	89 fe                	mov    %edi,%esi
+  802394:	d3 e7                	shl    %cl,%edi
+  802396:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80239a:	83 f6 01             	xor    $0x1,%esi
+  80239d:	d3 e6                	shl    %cl,%esi
+  80239f:	09 74 24 18          	or     %esi,0x18(%esp)
+  8023a3:	83 e9 01             	sub    $0x1,%ecx
+  8023a6:	73 98                	jae    802340 <__divdi3+0x80>
+  8023a8:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8023ac:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8023b0:	85 db                	test   %ebx,%ebx
+  8023b2:	0f 84 51 ff ff ff    	je     802309 <__divdi3+0x49>
+  8023b8:	f7 d8                	neg    %eax
+  8023ba:	83 d2 00             	adc    $0x0,%edx
+  8023bd:	83 c4 24             	add    $0x24,%esp
+  8023c0:	5b                   	pop    %ebx
+  8023c1:	f7 da                	neg    %edx
+  8023c3:	5e                   	pop    %esi
+  8023c4:	5f                   	pop    %edi
+  8023c5:	5d                   	pop    %ebp
+  8023c6:	c3                   	ret
+  8023c7:	f7 d8                	neg    %eax
+  8023c9:	83 d2 00             	adc    $0x0,%edx
+  8023cc:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8023d0:	f7 da                	neg    %edx
+  8023d2:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8023d6:	85 f6                	test   %esi,%esi
+  8023d8:	78 1b                	js     8023f5 <__divdi3+0x135>
+  8023da:	89 f1                	mov    %esi,%ecx
+  8023dc:	31 c0                	xor    %eax,%eax
+  8023de:	31 d2                	xor    %edx,%edx
+  8023e0:	bf 01 00 00 00       	mov    $0x1,%edi
+  8023e5:	09 d9                	or     %ebx,%ecx
+  8023e7:	0f 85 36 ff ff ff    	jne    802323 <__divdi3+0x63>
+  8023ed:	83 c4 24             	add    $0x24,%esp
+  8023f0:	5b                   	pop    %ebx
+  8023f1:	5e                   	pop    %esi
+  8023f2:	5f                   	pop    %edi
+  8023f3:	5d                   	pop    %ebp
+  8023f4:	c3                   	ret
+  8023f5:	31 ff                	xor    %edi,%edi
+  8023f7:	e9 1a ff ff ff       	jmp    802316 <__divdi3+0x56>
+  8023fc:	31 ff                	xor    %edi,%edi
+  8023fe:	e9 20 ff ff ff       	jmp    802323 <__divdi3+0x63>
+  802403:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80240a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00802410 <__moddi3>:
+  802410:	55                   	push   %ebp
+  802411:	57                   	push   %edi
+  802412:	56                   	push   %esi
+  802413:	53                   	push   %ebx
+  802414:	83 ec 1c             	sub    $0x1c,%esp
+  802417:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  80241b:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  80241f:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  802423:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  802427:	89 c8                	mov    %ecx,%eax
+  802429:	89 f2                	mov    %esi,%edx
+  80242b:	89 f3                	mov    %esi,%ebx
+  80242d:	85 ed                	test   %ebp,%ebp
+  80242f:	0f 88 9d 00 00 00    	js     8024d2 <__moddi3+0xc2>
+  802435:	09 cb                	or     %ecx,%ebx
+  802437:	0f 84 8d 00 00 00    	je     8024ca <__moddi3+0xba>
+  80243d:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802441:	31 db                	xor    %ebx,%ebx
+  802443:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802447:	89 ca                	mov    %ecx,%edx
+  802449:	89 f0                	mov    %esi,%eax
+  80244b:	89 dd                	mov    %ebx,%ebp
+  80244d:	f7 da                	neg    %edx
+  80244f:	83 d0 00             	adc    $0x0,%eax
+  802452:	f7 d8                	neg    %eax
+  802454:	0f 49 f0             	cmovns %eax,%esi
+  802457:	0f 49 ca             	cmovns %edx,%ecx
+  80245a:	31 c0                	xor    %eax,%eax
+  80245c:	31 d2                	xor    %edx,%edx
+  80245e:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802462:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802466:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80246b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80246f:	90                   	nop
+  802470:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802474:	01 c0                	add    %eax,%eax
+  802476:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80247d:	00 
+  80247e:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  802482:	89 c6                	mov    %eax,%esi
+  802484:	89 d7                	mov    %edx,%edi
+  802486:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80248a:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80248e:	0f ad d0             	shrd   %cl,%edx,%eax
+  802491:	d3 ea                	shr    %cl,%edx
+  802493:	f6 c1 20             	test   $0x20,%cl
+  802496:	0f 45 c2             	cmovne %edx,%eax
+  802499:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80249d:	83 e0 01             	and    $0x1,%eax
+  8024a0:	09 fa                	or     %edi,%edx
+  8024a2:	89 04 24             	mov    %eax,(%esp)
+  8024a5:	8b 04 24             	mov    (%esp),%eax
+  8024a8:	89 d7                	mov    %edx,%edi
+  8024aa:	09 f0                	or     %esi,%eax
+  8024ac:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  8024b0:	39 d8                	cmp    %ebx,%eax
+  8024b2:	19 f7                	sbb    %esi,%edi
+  8024b4:	72 04                	jb     8024ba <__moddi3+0xaa>
+  8024b6:	29 d8                	sub    %ebx,%eax
+  8024b8:	19 f2                	sbb    %esi,%edx
+  8024ba:	83 e9 01             	sub    $0x1,%ecx
+  8024bd:	73 b1                	jae    802470 <__moddi3+0x60>
+  8024bf:	85 ed                	test   %ebp,%ebp
+  8024c1:	74 07                	je     8024ca <__moddi3+0xba>
+  8024c3:	f7 d8                	neg    %eax
+  8024c5:	83 d2 00             	adc    $0x0,%edx
+  8024c8:	f7 da                	neg    %edx
+  8024ca:	83 c4 1c             	add    $0x1c,%esp
+  8024cd:	5b                   	pop    %ebx
+  8024ce:	5e                   	pop    %esi
+  8024cf:	5f                   	pop    %edi
+  8024d0:	5d                   	pop    %ebp
+  8024d1:	c3                   	ret
+  8024d2:	09 cb                	or     %ecx,%ebx
+  8024d4:	74 f4                	je     8024ca <__moddi3+0xba>
+  8024d6:	f7 df                	neg    %edi
+  8024d8:	bb 01 00 00 00       	mov    $0x1,%ebx
+  8024dd:	83 d5 00             	adc    $0x0,%ebp
+  8024e0:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  8024e4:	f7 dd                	neg    %ebp
+  8024e6:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  8024ea:	e9 58 ff ff ff       	jmp    802447 <__moddi3+0x37>
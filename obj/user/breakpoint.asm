@@ -0,0 +1,5247 @@
+
+obj/user/breakpoint.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 04 00 00 00       	call   800035 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+	asm volatile("int $3");
+  800033:	cc                   	int3
+}
+  800034:	c3                   	ret
+
+00800035 <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	56                   	push   %esi
+  800039:	53                   	push   %ebx
+  80003a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80003d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  800040:	e8 d1 00 00 00       	call   800116 <sys_getenvid>
+  800045:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80004a:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80004d:	c1 e0 04             	shl    $0x4,%eax
+  800050:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800055:	a3 08 40 80 00       	mov    %eax,0x804008
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  80005a:	85 db                	test   %ebx,%ebx
+  80005c:	7e 07                	jle    800065 <libmain+0x30>
+    binaryname = argv[0];
+  80005e:	8b 06                	mov    (%esi),%eax
+  800060:	a3 00 30 80 00       	mov    %eax,0x803000
+
+  // call user main routine
+  umain(argc, argv);
+  800065:	83 ec 08             	sub    $0x8,%esp
+  800068:	56                   	push   %esi
+  800069:	53                   	push   %ebx
+  80006a:	e8 c4 ff ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  80006f:	e8 0a 00 00 00       	call   80007e <exit>
+}
+  800074:	83 c4 10             	add    $0x10,%esp
+  800077:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80007a:	5b                   	pop    %ebx
+  80007b:	5e                   	pop    %esi
+  80007c:	5d                   	pop    %ebp
+  80007d:	c3                   	ret
+
+0080007e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80007e:	55                   	push   %ebp
+  80007f:	89 e5                	mov    %esp,%ebp
+  800081:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800084:	e8 72 05 00 00       	call   8005fb <close_all>
+	sys_env_destroy(0);
+  800089:	83 ec 0c             	sub    $0xc,%esp
+  80008c:	6a 00                	push   $0x0
+  80008e:	e8 42 00 00 00       	call   8000d5 <sys_env_destroy>
+}
+  800093:	83 c4 10             	add    $0x10,%esp
+  800096:	c9                   	leave
+  800097:	c3                   	ret
+
+00800098 <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800098:	55                   	push   %ebp
+  800099:	89 e5                	mov    %esp,%ebp
+  80009b:	57                   	push   %edi
+  80009c:	56                   	push   %esi
+  80009d:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80009e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000a6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000a9:	89 c3                	mov    %eax,%ebx
+  8000ab:	89 c7                	mov    %eax,%edi
+  8000ad:	89 c6                	mov    %eax,%esi
+  8000af:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  8000b1:	5b                   	pop    %ebx
+  8000b2:	5e                   	pop    %esi
+  8000b3:	5f                   	pop    %edi
+  8000b4:	5d                   	pop    %ebp
+  8000b5:	c3                   	ret
+
+008000b6 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8000b6:	55                   	push   %ebp
+  8000b7:	89 e5                	mov    %esp,%ebp
+  8000b9:	57                   	push   %edi
+  8000ba:	56                   	push   %esi
+  8000bb:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8000bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000c1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000c6:	89 d1                	mov    %edx,%ecx
+  8000c8:	89 d3                	mov    %edx,%ebx
+  8000ca:	89 d7                	mov    %edx,%edi
+  8000cc:	89 d6                	mov    %edx,%esi
+  8000ce:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8000d0:	5b                   	pop    %ebx
+  8000d1:	5e                   	pop    %esi
+  8000d2:	5f                   	pop    %edi
+  8000d3:	5d                   	pop    %ebp
+  8000d4:	c3                   	ret
+
+008000d5 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8000d5:	55                   	push   %ebp
+  8000d6:	89 e5                	mov    %esp,%ebp
+  8000d8:	57                   	push   %edi
+  8000d9:	56                   	push   %esi
+  8000da:	53                   	push   %ebx
+  8000db:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8000de:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000e6:	b8 03 00 00 00       	mov    $0x3,%eax
+  8000eb:	89 cb                	mov    %ecx,%ebx
+  8000ed:	89 cf                	mov    %ecx,%edi
+  8000ef:	89 ce                	mov    %ecx,%esi
+  8000f1:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8000f3:	85 c0                	test   %eax,%eax
+  8000f5:	7f 08                	jg     8000ff <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  8000f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000fa:	5b                   	pop    %ebx
+  8000fb:	5e                   	pop    %esi
+  8000fc:	5f                   	pop    %edi
+  8000fd:	5d                   	pop    %ebp
+  8000fe:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8000ff:	83 ec 0c             	sub    $0xc,%esp
+  800102:	50                   	push   %eax
+  800103:	6a 03                	push   $0x3
+  800105:	68 ea 24 80 00       	push   $0x8024ea
+  80010a:	6a 3e                	push   $0x3e
+  80010c:	68 07 25 80 00       	push   $0x802507
+  800111:	e8 22 14 00 00       	call   801538 <_panic>
+
+00800116 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800116:	55                   	push   %ebp
+  800117:	89 e5                	mov    %esp,%ebp
+  800119:	57                   	push   %edi
+  80011a:	56                   	push   %esi
+  80011b:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80011c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800121:	b8 02 00 00 00       	mov    $0x2,%eax
+  800126:	89 d1                	mov    %edx,%ecx
+  800128:	89 d3                	mov    %edx,%ebx
+  80012a:	89 d7                	mov    %edx,%edi
+  80012c:	89 d6                	mov    %edx,%esi
+  80012e:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800130:	5b                   	pop    %ebx
+  800131:	5e                   	pop    %esi
+  800132:	5f                   	pop    %edi
+  800133:	5d                   	pop    %ebp
+  800134:	c3                   	ret
+
+00800135 <sys_yield>:
+
+void
+sys_yield(void) {
+  800135:	55                   	push   %ebp
+  800136:	89 e5                	mov    %esp,%ebp
+  800138:	57                   	push   %edi
+  800139:	56                   	push   %esi
+  80013a:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80013b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800140:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800145:	89 d1                	mov    %edx,%ecx
+  800147:	89 d3                	mov    %edx,%ebx
+  800149:	89 d7                	mov    %edx,%edi
+  80014b:	89 d6                	mov    %edx,%esi
+  80014d:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  80014f:	5b                   	pop    %ebx
+  800150:	5e                   	pop    %esi
+  800151:	5f                   	pop    %edi
+  800152:	5d                   	pop    %ebp
+  800153:	c3                   	ret
+
+00800154 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  800154:	55                   	push   %ebp
+  800155:	89 e5                	mov    %esp,%ebp
+  800157:	57                   	push   %edi
+  800158:	56                   	push   %esi
+  800159:	53                   	push   %ebx
+  80015a:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  80015d:	be 00 00 00 00       	mov    $0x0,%esi
+  800162:	8b 55 08             	mov    0x8(%ebp),%edx
+  800165:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800168:	b8 04 00 00 00       	mov    $0x4,%eax
+  80016d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800170:	89 f7                	mov    %esi,%edi
+  800172:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800174:	85 c0                	test   %eax,%eax
+  800176:	7f 08                	jg     800180 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800178:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80017b:	5b                   	pop    %ebx
+  80017c:	5e                   	pop    %esi
+  80017d:	5f                   	pop    %edi
+  80017e:	5d                   	pop    %ebp
+  80017f:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800180:	83 ec 0c             	sub    $0xc,%esp
+  800183:	50                   	push   %eax
+  800184:	6a 04                	push   $0x4
+  800186:	68 ea 24 80 00       	push   $0x8024ea
+  80018b:	6a 3e                	push   $0x3e
+  80018d:	68 07 25 80 00       	push   $0x802507
+  800192:	e8 a1 13 00 00       	call   801538 <_panic>
+
+00800197 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  800197:	55                   	push   %ebp
+  800198:	89 e5                	mov    %esp,%ebp
+  80019a:	57                   	push   %edi
+  80019b:	56                   	push   %esi
+  80019c:	53                   	push   %ebx
+  80019d:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8001a0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001a3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001a6:	b8 05 00 00 00       	mov    $0x5,%eax
+  8001ab:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001ae:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8001b1:	8b 75 18             	mov    0x18(%ebp),%esi
+  8001b4:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8001b6:	85 c0                	test   %eax,%eax
+  8001b8:	7f 08                	jg     8001c2 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  8001ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001bd:	5b                   	pop    %ebx
+  8001be:	5e                   	pop    %esi
+  8001bf:	5f                   	pop    %edi
+  8001c0:	5d                   	pop    %ebp
+  8001c1:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8001c2:	83 ec 0c             	sub    $0xc,%esp
+  8001c5:	50                   	push   %eax
+  8001c6:	6a 05                	push   $0x5
+  8001c8:	68 ea 24 80 00       	push   $0x8024ea
+  8001cd:	6a 3e                	push   $0x3e
+  8001cf:	68 07 25 80 00       	push   $0x802507
+  8001d4:	e8 5f 13 00 00       	call   801538 <_panic>
+
+008001d9 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  8001d9:	55                   	push   %ebp
+  8001da:	89 e5                	mov    %esp,%ebp
+  8001dc:	57                   	push   %edi
+  8001dd:	56                   	push   %esi
+  8001de:	53                   	push   %ebx
+  8001df:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8001e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001e7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001ea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001ed:	b8 06 00 00 00       	mov    $0x6,%eax
+  8001f2:	89 df                	mov    %ebx,%edi
+  8001f4:	89 de                	mov    %ebx,%esi
+  8001f6:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8001f8:	85 c0                	test   %eax,%eax
+  8001fa:	7f 08                	jg     800204 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  8001fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001ff:	5b                   	pop    %ebx
+  800200:	5e                   	pop    %esi
+  800201:	5f                   	pop    %edi
+  800202:	5d                   	pop    %ebp
+  800203:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800204:	83 ec 0c             	sub    $0xc,%esp
+  800207:	50                   	push   %eax
+  800208:	6a 06                	push   $0x6
+  80020a:	68 ea 24 80 00       	push   $0x8024ea
+  80020f:	6a 3e                	push   $0x3e
+  800211:	68 07 25 80 00       	push   $0x802507
+  800216:	e8 1d 13 00 00       	call   801538 <_panic>
+
+0080021b <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80021b:	55                   	push   %ebp
+  80021c:	89 e5                	mov    %esp,%ebp
+  80021e:	57                   	push   %edi
+  80021f:	56                   	push   %esi
+  800220:	53                   	push   %ebx
+  800221:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800224:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800229:	8b 55 08             	mov    0x8(%ebp),%edx
+  80022c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80022f:	b8 08 00 00 00       	mov    $0x8,%eax
+  800234:	89 df                	mov    %ebx,%edi
+  800236:	89 de                	mov    %ebx,%esi
+  800238:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80023a:	85 c0                	test   %eax,%eax
+  80023c:	7f 08                	jg     800246 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  80023e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800241:	5b                   	pop    %ebx
+  800242:	5e                   	pop    %esi
+  800243:	5f                   	pop    %edi
+  800244:	5d                   	pop    %ebp
+  800245:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800246:	83 ec 0c             	sub    $0xc,%esp
+  800249:	50                   	push   %eax
+  80024a:	6a 08                	push   $0x8
+  80024c:	68 ea 24 80 00       	push   $0x8024ea
+  800251:	6a 3e                	push   $0x3e
+  800253:	68 07 25 80 00       	push   $0x802507
+  800258:	e8 db 12 00 00       	call   801538 <_panic>
+
+0080025d <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80025d:	55                   	push   %ebp
+  80025e:	89 e5                	mov    %esp,%ebp
+  800260:	57                   	push   %edi
+  800261:	56                   	push   %esi
+  800262:	53                   	push   %ebx
+  800263:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800266:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80026b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80026e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800271:	b8 09 00 00 00       	mov    $0x9,%eax
+  800276:	89 df                	mov    %ebx,%edi
+  800278:	89 de                	mov    %ebx,%esi
+  80027a:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80027c:	85 c0                	test   %eax,%eax
+  80027e:	7f 08                	jg     800288 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800280:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800283:	5b                   	pop    %ebx
+  800284:	5e                   	pop    %esi
+  800285:	5f                   	pop    %edi
+  800286:	5d                   	pop    %ebp
+  800287:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800288:	83 ec 0c             	sub    $0xc,%esp
+  80028b:	50                   	push   %eax
+  80028c:	6a 09                	push   $0x9
+  80028e:	68 ea 24 80 00       	push   $0x8024ea
+  800293:	6a 3e                	push   $0x3e
+  800295:	68 07 25 80 00       	push   $0x802507
+  80029a:	e8 99 12 00 00       	call   801538 <_panic>
+
+0080029f <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80029f:	55                   	push   %ebp
+  8002a0:	89 e5                	mov    %esp,%ebp
+  8002a2:	57                   	push   %edi
+  8002a3:	56                   	push   %esi
+  8002a4:	53                   	push   %ebx
+  8002a5:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8002a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002b0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002b3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8002b8:	89 df                	mov    %ebx,%edi
+  8002ba:	89 de                	mov    %ebx,%esi
+  8002bc:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8002be:	85 c0                	test   %eax,%eax
+  8002c0:	7f 08                	jg     8002ca <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8002c2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002c5:	5b                   	pop    %ebx
+  8002c6:	5e                   	pop    %esi
+  8002c7:	5f                   	pop    %edi
+  8002c8:	5d                   	pop    %ebp
+  8002c9:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8002ca:	83 ec 0c             	sub    $0xc,%esp
+  8002cd:	50                   	push   %eax
+  8002ce:	6a 0a                	push   $0xa
+  8002d0:	68 ea 24 80 00       	push   $0x8024ea
+  8002d5:	6a 3e                	push   $0x3e
+  8002d7:	68 07 25 80 00       	push   $0x802507
+  8002dc:	e8 57 12 00 00       	call   801538 <_panic>
+
+008002e1 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  8002e1:	55                   	push   %ebp
+  8002e2:	89 e5                	mov    %esp,%ebp
+  8002e4:	57                   	push   %edi
+  8002e5:	56                   	push   %esi
+  8002e6:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8002e7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002ea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002ed:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8002f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8002f7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8002fa:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8002fd:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8002ff:	5b                   	pop    %ebx
+  800300:	5e                   	pop    %esi
+  800301:	5f                   	pop    %edi
+  800302:	5d                   	pop    %ebp
+  800303:	c3                   	ret
+
+00800304 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  800304:	55                   	push   %ebp
+  800305:	89 e5                	mov    %esp,%ebp
+  800307:	57                   	push   %edi
+  800308:	56                   	push   %esi
+  800309:	53                   	push   %ebx
+  80030a:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  80030d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800312:	8b 55 08             	mov    0x8(%ebp),%edx
+  800315:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80031a:	89 cb                	mov    %ecx,%ebx
+  80031c:	89 cf                	mov    %ecx,%edi
+  80031e:	89 ce                	mov    %ecx,%esi
+  800320:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800322:	85 c0                	test   %eax,%eax
+  800324:	7f 08                	jg     80032e <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  800326:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800329:	5b                   	pop    %ebx
+  80032a:	5e                   	pop    %esi
+  80032b:	5f                   	pop    %edi
+  80032c:	5d                   	pop    %ebp
+  80032d:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80032e:	83 ec 0c             	sub    $0xc,%esp
+  800331:	50                   	push   %eax
+  800332:	6a 0d                	push   $0xd
+  800334:	68 ea 24 80 00       	push   $0x8024ea
+  800339:	6a 3e                	push   $0x3e
+  80033b:	68 07 25 80 00       	push   $0x802507
+  800340:	e8 f3 11 00 00       	call   801538 <_panic>
+
+00800345 <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  800345:	55                   	push   %ebp
+  800346:	89 e5                	mov    %esp,%ebp
+  800348:	57                   	push   %edi
+  800349:	56                   	push   %esi
+  80034a:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80034b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800350:	8b 55 08             	mov    0x8(%ebp),%edx
+  800353:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800356:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80035b:	89 df                	mov    %ebx,%edi
+  80035d:	89 de                	mov    %ebx,%esi
+  80035f:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  800361:	5b                   	pop    %ebx
+  800362:	5e                   	pop    %esi
+  800363:	5f                   	pop    %edi
+  800364:	5d                   	pop    %ebp
+  800365:	c3                   	ret
+
+00800366 <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  800366:	55                   	push   %ebp
+  800367:	89 e5                	mov    %esp,%ebp
+  800369:	57                   	push   %edi
+  80036a:	56                   	push   %esi
+  80036b:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80036c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800371:	8b 55 08             	mov    0x8(%ebp),%edx
+  800374:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800379:	89 cb                	mov    %ecx,%ebx
+  80037b:	89 cf                	mov    %ecx,%edi
+  80037d:	89 ce                	mov    %ecx,%esi
+  80037f:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  800381:	5b                   	pop    %ebx
+  800382:	5e                   	pop    %esi
+  800383:	5f                   	pop    %edi
+  800384:	5d                   	pop    %ebp
+  800385:	c3                   	ret
+
+00800386 <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  800386:	55                   	push   %ebp
+  800387:	89 e5                	mov    %esp,%ebp
+  800389:	57                   	push   %edi
+  80038a:	56                   	push   %esi
+  80038b:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80038c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800391:	b8 10 00 00 00       	mov    $0x10,%eax
+  800396:	89 d1                	mov    %edx,%ecx
+  800398:	89 d3                	mov    %edx,%ebx
+  80039a:	89 d7                	mov    %edx,%edi
+  80039c:	89 d6                	mov    %edx,%esi
+  80039e:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8003a0:	5b                   	pop    %ebx
+  8003a1:	5e                   	pop    %esi
+  8003a2:	5f                   	pop    %edi
+  8003a3:	5d                   	pop    %ebp
+  8003a4:	c3                   	ret
+
+008003a5 <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  8003a5:	55                   	push   %ebp
+  8003a6:	89 e5                	mov    %esp,%ebp
+  8003a8:	57                   	push   %edi
+  8003a9:	56                   	push   %esi
+  8003aa:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8003ab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003b3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003b6:	b8 11 00 00 00       	mov    $0x11,%eax
+  8003bb:	89 df                	mov    %ebx,%edi
+  8003bd:	89 de                	mov    %ebx,%esi
+  8003bf:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  8003c1:	5b                   	pop    %ebx
+  8003c2:	5e                   	pop    %esi
+  8003c3:	5f                   	pop    %edi
+  8003c4:	5d                   	pop    %ebp
+  8003c5:	c3                   	ret
+
+008003c6 <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  8003c6:	55                   	push   %ebp
+  8003c7:	89 e5                	mov    %esp,%ebp
+  8003c9:	57                   	push   %edi
+  8003ca:	56                   	push   %esi
+  8003cb:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8003cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003d1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003d4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003d7:	b8 12 00 00 00       	mov    $0x12,%eax
+  8003dc:	89 df                	mov    %ebx,%edi
+  8003de:	89 de                	mov    %ebx,%esi
+  8003e0:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  8003e2:	5b                   	pop    %ebx
+  8003e3:	5e                   	pop    %esi
+  8003e4:	5f                   	pop    %edi
+  8003e5:	5d                   	pop    %ebp
+  8003e6:	c3                   	ret
+
+008003e7 <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  8003e7:	55                   	push   %ebp
+  8003e8:	89 e5                	mov    %esp,%ebp
+  8003ea:	57                   	push   %edi
+  8003eb:	56                   	push   %esi
+  8003ec:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8003ed:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8003f2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003f5:	b8 13 00 00 00       	mov    $0x13,%eax
+  8003fa:	89 cb                	mov    %ecx,%ebx
+  8003fc:	89 cf                	mov    %ecx,%edi
+  8003fe:	89 ce                	mov    %ecx,%esi
+  800400:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  800402:	5b                   	pop    %ebx
+  800403:	5e                   	pop    %esi
+  800404:	5f                   	pop    %edi
+  800405:	5d                   	pop    %ebp
+  800406:	c3                   	ret
+
+00800407 <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  800407:	55                   	push   %ebp
+  800408:	89 e5                	mov    %esp,%ebp
+  80040a:	57                   	push   %edi
+  80040b:	56                   	push   %esi
+  80040c:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80040d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800412:	8b 55 08             	mov    0x8(%ebp),%edx
+  800415:	b8 14 00 00 00       	mov    $0x14,%eax
+  80041a:	89 cb                	mov    %ecx,%ebx
+  80041c:	89 cf                	mov    %ecx,%edi
+  80041e:	89 ce                	mov    %ecx,%esi
+  800420:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  800422:	5b                   	pop    %ebx
+  800423:	5e                   	pop    %esi
+  800424:	5f                   	pop    %edi
+  800425:	5d                   	pop    %ebp
+  800426:	c3                   	ret
+
+00800427 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800427:	55                   	push   %ebp
+  800428:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80042a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80042d:	05 00 00 00 30       	add    $0x30000000,%eax
+  800432:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800435:	5d                   	pop    %ebp
+  800436:	c3                   	ret
+
+00800437 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800437:	55                   	push   %ebp
+  800438:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80043a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80043d:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800442:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800447:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80044c:	5d                   	pop    %ebp
+  80044d:	c3                   	ret
+
+0080044e <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80044e:	55                   	push   %ebp
+  80044f:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  800451:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800456:	eb 02                	jmp    80045a <fd_alloc+0xc>
+  800458:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80045a:	89 c2                	mov    %eax,%edx
+  80045c:	c1 ea 16             	shr    $0x16,%edx
+  80045f:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800466:	f6 c2 01             	test   $0x1,%dl
+  800469:	74 2b                	je     800496 <fd_alloc+0x48>
+  80046b:	89 c2                	mov    %eax,%edx
+  80046d:	c1 ea 0c             	shr    $0xc,%edx
+  800470:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  800477:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80047d:	f6 c1 01             	test   $0x1,%cl
+  800480:	74 14                	je     800496 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  800482:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  800488:	75 ce                	jne    800458 <fd_alloc+0xa>
+  80048a:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80048f:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800494:	eb 05                	jmp    80049b <fd_alloc+0x4d>
+			return 0;
+  800496:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80049b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80049e:	89 02                	mov    %eax,(%edx)
+}
+  8004a0:	89 c8                	mov    %ecx,%eax
+  8004a2:	5d                   	pop    %ebp
+  8004a3:	c3                   	ret
+
+008004a4 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8004a4:	55                   	push   %ebp
+  8004a5:	89 e5                	mov    %esp,%ebp
+  8004a7:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8004aa:	83 f8 1f             	cmp    $0x1f,%eax
+  8004ad:	77 30                	ja     8004df <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8004af:	c1 e0 0c             	shl    $0xc,%eax
+  8004b2:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8004b7:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8004bd:	f6 c2 01             	test   $0x1,%dl
+  8004c0:	74 24                	je     8004e6 <fd_lookup+0x42>
+  8004c2:	89 c2                	mov    %eax,%edx
+  8004c4:	c1 ea 0c             	shr    $0xc,%edx
+  8004c7:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8004ce:	f6 c2 01             	test   $0x1,%dl
+  8004d1:	74 1a                	je     8004ed <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8004d3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8004d6:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8004d8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8004dd:	5d                   	pop    %ebp
+  8004de:	c3                   	ret
+		return -E_INVAL;
+  8004df:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8004e4:	eb f7                	jmp    8004dd <fd_lookup+0x39>
+		return -E_INVAL;
+  8004e6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8004eb:	eb f0                	jmp    8004dd <fd_lookup+0x39>
+  8004ed:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8004f2:	eb e9                	jmp    8004dd <fd_lookup+0x39>
+
+008004f4 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8004f4:	55                   	push   %ebp
+  8004f5:	89 e5                	mov    %esp,%ebp
+  8004f7:	53                   	push   %ebx
+  8004f8:	83 ec 04             	sub    $0x4,%esp
+  8004fb:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8004fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800503:	eb 03                	jmp    800508 <dev_lookup+0x14>
+  800505:	83 c0 01             	add    $0x1,%eax
+  800508:	8b 1c 85 94 25 80 00 	mov    0x802594(,%eax,4),%ebx
+  80050f:	85 db                	test   %ebx,%ebx
+  800511:	74 0b                	je     80051e <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  800513:	39 13                	cmp    %edx,(%ebx)
+  800515:	75 ee                	jne    800505 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  800517:	b8 00 00 00 00       	mov    $0x0,%eax
+  80051c:	eb 1f                	jmp    80053d <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80051e:	a1 08 40 80 00       	mov    0x804008,%eax
+  800523:	8b 40 48             	mov    0x48(%eax),%eax
+  800526:	83 ec 04             	sub    $0x4,%esp
+  800529:	52                   	push   %edx
+  80052a:	50                   	push   %eax
+  80052b:	68 18 25 80 00       	push   $0x802518
+  800530:	e8 de 10 00 00       	call   801613 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  800535:	83 c4 10             	add    $0x10,%esp
+  800538:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80053d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800540:	89 1a                	mov    %ebx,(%edx)
+}
+  800542:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800545:	c9                   	leave
+  800546:	c3                   	ret
+
+00800547 <fd_close>:
+{
+  800547:	55                   	push   %ebp
+  800548:	89 e5                	mov    %esp,%ebp
+  80054a:	57                   	push   %edi
+  80054b:	56                   	push   %esi
+  80054c:	53                   	push   %ebx
+  80054d:	83 ec 24             	sub    $0x24,%esp
+  800550:	8b 75 08             	mov    0x8(%ebp),%esi
+  800553:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800556:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800559:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80055a:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800560:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800563:	50                   	push   %eax
+  800564:	e8 3b ff ff ff       	call   8004a4 <fd_lookup>
+  800569:	89 c3                	mov    %eax,%ebx
+  80056b:	83 c4 10             	add    $0x10,%esp
+  80056e:	85 c0                	test   %eax,%eax
+  800570:	78 05                	js     800577 <fd_close+0x30>
+	    || fd != fd2)
+  800572:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  800575:	74 16                	je     80058d <fd_close+0x46>
+		return (must_exist ? r : 0);
+  800577:	89 f8                	mov    %edi,%eax
+  800579:	84 c0                	test   %al,%al
+  80057b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800580:	0f 44 d8             	cmove  %eax,%ebx
+}
+  800583:	89 d8                	mov    %ebx,%eax
+  800585:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800588:	5b                   	pop    %ebx
+  800589:	5e                   	pop    %esi
+  80058a:	5f                   	pop    %edi
+  80058b:	5d                   	pop    %ebp
+  80058c:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80058d:	83 ec 08             	sub    $0x8,%esp
+  800590:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800593:	50                   	push   %eax
+  800594:	ff 36                	push   (%esi)
+  800596:	e8 59 ff ff ff       	call   8004f4 <dev_lookup>
+  80059b:	89 c3                	mov    %eax,%ebx
+  80059d:	83 c4 10             	add    $0x10,%esp
+  8005a0:	85 c0                	test   %eax,%eax
+  8005a2:	78 1a                	js     8005be <fd_close+0x77>
+		if (dev->dev_close)
+  8005a4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005a7:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8005aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8005af:	85 c0                	test   %eax,%eax
+  8005b1:	74 0b                	je     8005be <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8005b3:	83 ec 0c             	sub    $0xc,%esp
+  8005b6:	56                   	push   %esi
+  8005b7:	ff d0                	call   *%eax
+  8005b9:	89 c3                	mov    %eax,%ebx
+  8005bb:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8005be:	83 ec 08             	sub    $0x8,%esp
+  8005c1:	56                   	push   %esi
+  8005c2:	6a 00                	push   $0x0
+  8005c4:	e8 10 fc ff ff       	call   8001d9 <sys_page_unmap>
+	return r;
+  8005c9:	83 c4 10             	add    $0x10,%esp
+  8005cc:	eb b5                	jmp    800583 <fd_close+0x3c>
+
+008005ce <close>:
+
+int
+close(int fdnum)
+{
+  8005ce:	55                   	push   %ebp
+  8005cf:	89 e5                	mov    %esp,%ebp
+  8005d1:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8005d4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8005d7:	50                   	push   %eax
+  8005d8:	ff 75 08             	push   0x8(%ebp)
+  8005db:	e8 c4 fe ff ff       	call   8004a4 <fd_lookup>
+  8005e0:	83 c4 10             	add    $0x10,%esp
+  8005e3:	85 c0                	test   %eax,%eax
+  8005e5:	79 02                	jns    8005e9 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8005e7:	c9                   	leave
+  8005e8:	c3                   	ret
+		return fd_close(fd, 1);
+  8005e9:	83 ec 08             	sub    $0x8,%esp
+  8005ec:	6a 01                	push   $0x1
+  8005ee:	ff 75 f4             	push   -0xc(%ebp)
+  8005f1:	e8 51 ff ff ff       	call   800547 <fd_close>
+  8005f6:	83 c4 10             	add    $0x10,%esp
+  8005f9:	eb ec                	jmp    8005e7 <close+0x19>
+
+008005fb <close_all>:
+
+void
+close_all(void)
+{
+  8005fb:	55                   	push   %ebp
+  8005fc:	89 e5                	mov    %esp,%ebp
+  8005fe:	53                   	push   %ebx
+  8005ff:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  800602:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  800607:	83 ec 0c             	sub    $0xc,%esp
+  80060a:	53                   	push   %ebx
+  80060b:	e8 be ff ff ff       	call   8005ce <close>
+	for (i = 0; i < MAXFD; i++)
+  800610:	83 c3 01             	add    $0x1,%ebx
+  800613:	83 c4 10             	add    $0x10,%esp
+  800616:	83 fb 20             	cmp    $0x20,%ebx
+  800619:	75 ec                	jne    800607 <close_all+0xc>
+}
+  80061b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80061e:	c9                   	leave
+  80061f:	c3                   	ret
+
+00800620 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  800620:	55                   	push   %ebp
+  800621:	89 e5                	mov    %esp,%ebp
+  800623:	57                   	push   %edi
+  800624:	56                   	push   %esi
+  800625:	53                   	push   %ebx
+  800626:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800629:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80062c:	50                   	push   %eax
+  80062d:	ff 75 08             	push   0x8(%ebp)
+  800630:	e8 6f fe ff ff       	call   8004a4 <fd_lookup>
+  800635:	89 c3                	mov    %eax,%ebx
+  800637:	83 c4 10             	add    $0x10,%esp
+  80063a:	85 c0                	test   %eax,%eax
+  80063c:	78 7f                	js     8006bd <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80063e:	83 ec 0c             	sub    $0xc,%esp
+  800641:	ff 75 0c             	push   0xc(%ebp)
+  800644:	e8 85 ff ff ff       	call   8005ce <close>
+
+	newfd = INDEX2FD(newfdnum);
+  800649:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80064c:	c1 e6 0c             	shl    $0xc,%esi
+  80064f:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  800655:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800658:	89 3c 24             	mov    %edi,(%esp)
+  80065b:	e8 d7 fd ff ff       	call   800437 <fd2data>
+  800660:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  800662:	89 34 24             	mov    %esi,(%esp)
+  800665:	e8 cd fd ff ff       	call   800437 <fd2data>
+  80066a:	83 c4 10             	add    $0x10,%esp
+  80066d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  800670:	89 d8                	mov    %ebx,%eax
+  800672:	c1 e8 16             	shr    $0x16,%eax
+  800675:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80067c:	a8 01                	test   $0x1,%al
+  80067e:	74 11                	je     800691 <dup+0x71>
+  800680:	89 d8                	mov    %ebx,%eax
+  800682:	c1 e8 0c             	shr    $0xc,%eax
+  800685:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80068c:	f6 c2 01             	test   $0x1,%dl
+  80068f:	75 36                	jne    8006c7 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  800691:	89 f8                	mov    %edi,%eax
+  800693:	c1 e8 0c             	shr    $0xc,%eax
+  800696:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80069d:	83 ec 0c             	sub    $0xc,%esp
+  8006a0:	25 07 0e 00 00       	and    $0xe07,%eax
+  8006a5:	50                   	push   %eax
+  8006a6:	56                   	push   %esi
+  8006a7:	6a 00                	push   $0x0
+  8006a9:	57                   	push   %edi
+  8006aa:	6a 00                	push   $0x0
+  8006ac:	e8 e6 fa ff ff       	call   800197 <sys_page_map>
+  8006b1:	89 c3                	mov    %eax,%ebx
+  8006b3:	83 c4 20             	add    $0x20,%esp
+  8006b6:	85 c0                	test   %eax,%eax
+  8006b8:	78 33                	js     8006ed <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8006ba:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8006bd:	89 d8                	mov    %ebx,%eax
+  8006bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006c2:	5b                   	pop    %ebx
+  8006c3:	5e                   	pop    %esi
+  8006c4:	5f                   	pop    %edi
+  8006c5:	5d                   	pop    %ebp
+  8006c6:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8006c7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8006ce:	83 ec 0c             	sub    $0xc,%esp
+  8006d1:	25 07 0e 00 00       	and    $0xe07,%eax
+  8006d6:	50                   	push   %eax
+  8006d7:	ff 75 d4             	push   -0x2c(%ebp)
+  8006da:	6a 00                	push   $0x0
+  8006dc:	53                   	push   %ebx
+  8006dd:	6a 00                	push   $0x0
+  8006df:	e8 b3 fa ff ff       	call   800197 <sys_page_map>
+  8006e4:	89 c3                	mov    %eax,%ebx
+  8006e6:	83 c4 20             	add    $0x20,%esp
+  8006e9:	85 c0                	test   %eax,%eax
+  8006eb:	79 a4                	jns    800691 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8006ed:	83 ec 08             	sub    $0x8,%esp
+  8006f0:	56                   	push   %esi
+  8006f1:	6a 00                	push   $0x0
+  8006f3:	e8 e1 fa ff ff       	call   8001d9 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8006f8:	83 c4 08             	add    $0x8,%esp
+  8006fb:	ff 75 d4             	push   -0x2c(%ebp)
+  8006fe:	6a 00                	push   $0x0
+  800700:	e8 d4 fa ff ff       	call   8001d9 <sys_page_unmap>
+	return r;
+  800705:	83 c4 10             	add    $0x10,%esp
+  800708:	eb b3                	jmp    8006bd <dup+0x9d>
+
+0080070a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80070a:	55                   	push   %ebp
+  80070b:	89 e5                	mov    %esp,%ebp
+  80070d:	56                   	push   %esi
+  80070e:	53                   	push   %ebx
+  80070f:	83 ec 18             	sub    $0x18,%esp
+  800712:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800715:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800718:	50                   	push   %eax
+  800719:	56                   	push   %esi
+  80071a:	e8 85 fd ff ff       	call   8004a4 <fd_lookup>
+  80071f:	83 c4 10             	add    $0x10,%esp
+  800722:	85 c0                	test   %eax,%eax
+  800724:	78 3c                	js     800762 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800726:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  800729:	83 ec 08             	sub    $0x8,%esp
+  80072c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80072f:	50                   	push   %eax
+  800730:	ff 33                	push   (%ebx)
+  800732:	e8 bd fd ff ff       	call   8004f4 <dev_lookup>
+  800737:	83 c4 10             	add    $0x10,%esp
+  80073a:	85 c0                	test   %eax,%eax
+  80073c:	78 24                	js     800762 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80073e:	8b 43 08             	mov    0x8(%ebx),%eax
+  800741:	83 e0 03             	and    $0x3,%eax
+  800744:	83 f8 01             	cmp    $0x1,%eax
+  800747:	74 20                	je     800769 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  800749:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80074c:	8b 40 08             	mov    0x8(%eax),%eax
+  80074f:	85 c0                	test   %eax,%eax
+  800751:	74 37                	je     80078a <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  800753:	83 ec 04             	sub    $0x4,%esp
+  800756:	ff 75 10             	push   0x10(%ebp)
+  800759:	ff 75 0c             	push   0xc(%ebp)
+  80075c:	53                   	push   %ebx
+  80075d:	ff d0                	call   *%eax
+  80075f:	83 c4 10             	add    $0x10,%esp
+}
+  800762:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800765:	5b                   	pop    %ebx
+  800766:	5e                   	pop    %esi
+  800767:	5d                   	pop    %ebp
+  800768:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800769:	a1 08 40 80 00       	mov    0x804008,%eax
+  80076e:	8b 40 48             	mov    0x48(%eax),%eax
+  800771:	83 ec 04             	sub    $0x4,%esp
+  800774:	56                   	push   %esi
+  800775:	50                   	push   %eax
+  800776:	68 59 25 80 00       	push   $0x802559
+  80077b:	e8 93 0e 00 00       	call   801613 <cprintf>
+		return -E_INVAL;
+  800780:	83 c4 10             	add    $0x10,%esp
+  800783:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800788:	eb d8                	jmp    800762 <read+0x58>
+		return -E_NOT_SUPP;
+  80078a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80078f:	eb d1                	jmp    800762 <read+0x58>
+
+00800791 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  800791:	55                   	push   %ebp
+  800792:	89 e5                	mov    %esp,%ebp
+  800794:	57                   	push   %edi
+  800795:	56                   	push   %esi
+  800796:	53                   	push   %ebx
+  800797:	83 ec 0c             	sub    $0xc,%esp
+  80079a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80079d:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8007a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8007a5:	eb 02                	jmp    8007a9 <readn+0x18>
+  8007a7:	01 c3                	add    %eax,%ebx
+  8007a9:	39 f3                	cmp    %esi,%ebx
+  8007ab:	73 21                	jae    8007ce <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8007ad:	83 ec 04             	sub    $0x4,%esp
+  8007b0:	89 f0                	mov    %esi,%eax
+  8007b2:	29 d8                	sub    %ebx,%eax
+  8007b4:	50                   	push   %eax
+  8007b5:	89 d8                	mov    %ebx,%eax
+  8007b7:	03 45 0c             	add    0xc(%ebp),%eax
+  8007ba:	50                   	push   %eax
+  8007bb:	57                   	push   %edi
+  8007bc:	e8 49 ff ff ff       	call   80070a <read>
+		if (m < 0)
+  8007c1:	83 c4 10             	add    $0x10,%esp
+  8007c4:	85 c0                	test   %eax,%eax
+  8007c6:	78 04                	js     8007cc <readn+0x3b>
+			return m;
+		if (m == 0)
+  8007c8:	75 dd                	jne    8007a7 <readn+0x16>
+  8007ca:	eb 02                	jmp    8007ce <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8007cc:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8007ce:	89 d8                	mov    %ebx,%eax
+  8007d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007d3:	5b                   	pop    %ebx
+  8007d4:	5e                   	pop    %esi
+  8007d5:	5f                   	pop    %edi
+  8007d6:	5d                   	pop    %ebp
+  8007d7:	c3                   	ret
+
+008007d8 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8007d8:	55                   	push   %ebp
+  8007d9:	89 e5                	mov    %esp,%ebp
+  8007db:	56                   	push   %esi
+  8007dc:	53                   	push   %ebx
+  8007dd:	83 ec 18             	sub    $0x18,%esp
+  8007e0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8007e3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8007e6:	50                   	push   %eax
+  8007e7:	53                   	push   %ebx
+  8007e8:	e8 b7 fc ff ff       	call   8004a4 <fd_lookup>
+  8007ed:	83 c4 10             	add    $0x10,%esp
+  8007f0:	85 c0                	test   %eax,%eax
+  8007f2:	78 37                	js     80082b <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8007f4:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8007f7:	83 ec 08             	sub    $0x8,%esp
+  8007fa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8007fd:	50                   	push   %eax
+  8007fe:	ff 36                	push   (%esi)
+  800800:	e8 ef fc ff ff       	call   8004f4 <dev_lookup>
+  800805:	83 c4 10             	add    $0x10,%esp
+  800808:	85 c0                	test   %eax,%eax
+  80080a:	78 1f                	js     80082b <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80080c:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800810:	74 20                	je     800832 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  800812:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800815:	8b 40 0c             	mov    0xc(%eax),%eax
+  800818:	85 c0                	test   %eax,%eax
+  80081a:	74 37                	je     800853 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80081c:	83 ec 04             	sub    $0x4,%esp
+  80081f:	ff 75 10             	push   0x10(%ebp)
+  800822:	ff 75 0c             	push   0xc(%ebp)
+  800825:	56                   	push   %esi
+  800826:	ff d0                	call   *%eax
+  800828:	83 c4 10             	add    $0x10,%esp
+}
+  80082b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80082e:	5b                   	pop    %ebx
+  80082f:	5e                   	pop    %esi
+  800830:	5d                   	pop    %ebp
+  800831:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800832:	a1 08 40 80 00       	mov    0x804008,%eax
+  800837:	8b 40 48             	mov    0x48(%eax),%eax
+  80083a:	83 ec 04             	sub    $0x4,%esp
+  80083d:	53                   	push   %ebx
+  80083e:	50                   	push   %eax
+  80083f:	68 75 25 80 00       	push   $0x802575
+  800844:	e8 ca 0d 00 00       	call   801613 <cprintf>
+		return -E_INVAL;
+  800849:	83 c4 10             	add    $0x10,%esp
+  80084c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800851:	eb d8                	jmp    80082b <write+0x53>
+		return -E_NOT_SUPP;
+  800853:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800858:	eb d1                	jmp    80082b <write+0x53>
+
+0080085a <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80085a:	55                   	push   %ebp
+  80085b:	89 e5                	mov    %esp,%ebp
+  80085d:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800860:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800863:	50                   	push   %eax
+  800864:	ff 75 08             	push   0x8(%ebp)
+  800867:	e8 38 fc ff ff       	call   8004a4 <fd_lookup>
+  80086c:	83 c4 10             	add    $0x10,%esp
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 0e                	js     800881 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  800873:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800876:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800879:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80087c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800881:	c9                   	leave
+  800882:	c3                   	ret
+
+00800883 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800883:	55                   	push   %ebp
+  800884:	89 e5                	mov    %esp,%ebp
+  800886:	56                   	push   %esi
+  800887:	53                   	push   %ebx
+  800888:	83 ec 18             	sub    $0x18,%esp
+  80088b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80088e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800891:	50                   	push   %eax
+  800892:	53                   	push   %ebx
+  800893:	e8 0c fc ff ff       	call   8004a4 <fd_lookup>
+  800898:	83 c4 10             	add    $0x10,%esp
+  80089b:	85 c0                	test   %eax,%eax
+  80089d:	78 34                	js     8008d3 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80089f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8008a2:	83 ec 08             	sub    $0x8,%esp
+  8008a5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8008a8:	50                   	push   %eax
+  8008a9:	ff 36                	push   (%esi)
+  8008ab:	e8 44 fc ff ff       	call   8004f4 <dev_lookup>
+  8008b0:	83 c4 10             	add    $0x10,%esp
+  8008b3:	85 c0                	test   %eax,%eax
+  8008b5:	78 1c                	js     8008d3 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8008b7:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8008bb:	74 1d                	je     8008da <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8008bd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008c0:	8b 40 18             	mov    0x18(%eax),%eax
+  8008c3:	85 c0                	test   %eax,%eax
+  8008c5:	74 34                	je     8008fb <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8008c7:	83 ec 08             	sub    $0x8,%esp
+  8008ca:	ff 75 0c             	push   0xc(%ebp)
+  8008cd:	56                   	push   %esi
+  8008ce:	ff d0                	call   *%eax
+  8008d0:	83 c4 10             	add    $0x10,%esp
+}
+  8008d3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8008d6:	5b                   	pop    %ebx
+  8008d7:	5e                   	pop    %esi
+  8008d8:	5d                   	pop    %ebp
+  8008d9:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8008da:	a1 08 40 80 00       	mov    0x804008,%eax
+  8008df:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8008e2:	83 ec 04             	sub    $0x4,%esp
+  8008e5:	53                   	push   %ebx
+  8008e6:	50                   	push   %eax
+  8008e7:	68 38 25 80 00       	push   $0x802538
+  8008ec:	e8 22 0d 00 00       	call   801613 <cprintf>
+		return -E_INVAL;
+  8008f1:	83 c4 10             	add    $0x10,%esp
+  8008f4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008f9:	eb d8                	jmp    8008d3 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8008fb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800900:	eb d1                	jmp    8008d3 <ftruncate+0x50>
+
+00800902 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800902:	55                   	push   %ebp
+  800903:	89 e5                	mov    %esp,%ebp
+  800905:	56                   	push   %esi
+  800906:	53                   	push   %ebx
+  800907:	83 ec 18             	sub    $0x18,%esp
+  80090a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80090d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800910:	50                   	push   %eax
+  800911:	ff 75 08             	push   0x8(%ebp)
+  800914:	e8 8b fb ff ff       	call   8004a4 <fd_lookup>
+  800919:	83 c4 10             	add    $0x10,%esp
+  80091c:	85 c0                	test   %eax,%eax
+  80091e:	78 49                	js     800969 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800920:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800923:	83 ec 08             	sub    $0x8,%esp
+  800926:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800929:	50                   	push   %eax
+  80092a:	ff 36                	push   (%esi)
+  80092c:	e8 c3 fb ff ff       	call   8004f4 <dev_lookup>
+  800931:	83 c4 10             	add    $0x10,%esp
+  800934:	85 c0                	test   %eax,%eax
+  800936:	78 31                	js     800969 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  800938:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80093b:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80093f:	74 2f                	je     800970 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  800941:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  800944:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80094b:	00 00 00 
+	stat->st_isdir = 0;
+  80094e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800955:	00 00 00 
+	stat->st_dev = dev;
+  800958:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80095e:	83 ec 08             	sub    $0x8,%esp
+  800961:	53                   	push   %ebx
+  800962:	56                   	push   %esi
+  800963:	ff 50 14             	call   *0x14(%eax)
+  800966:	83 c4 10             	add    $0x10,%esp
+}
+  800969:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80096c:	5b                   	pop    %ebx
+  80096d:	5e                   	pop    %esi
+  80096e:	5d                   	pop    %ebp
+  80096f:	c3                   	ret
+		return -E_NOT_SUPP;
+  800970:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800975:	eb f2                	jmp    800969 <fstat+0x67>
+
+00800977 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  800977:	55                   	push   %ebp
+  800978:	89 e5                	mov    %esp,%ebp
+  80097a:	56                   	push   %esi
+  80097b:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80097c:	83 ec 08             	sub    $0x8,%esp
+  80097f:	6a 00                	push   $0x0
+  800981:	ff 75 08             	push   0x8(%ebp)
+  800984:	e8 e4 01 00 00       	call   800b6d <open>
+  800989:	89 c3                	mov    %eax,%ebx
+  80098b:	83 c4 10             	add    $0x10,%esp
+  80098e:	85 c0                	test   %eax,%eax
+  800990:	78 1b                	js     8009ad <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  800992:	83 ec 08             	sub    $0x8,%esp
+  800995:	ff 75 0c             	push   0xc(%ebp)
+  800998:	50                   	push   %eax
+  800999:	e8 64 ff ff ff       	call   800902 <fstat>
+  80099e:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8009a0:	89 1c 24             	mov    %ebx,(%esp)
+  8009a3:	e8 26 fc ff ff       	call   8005ce <close>
+	return r;
+  8009a8:	83 c4 10             	add    $0x10,%esp
+  8009ab:	89 f3                	mov    %esi,%ebx
+}
+  8009ad:	89 d8                	mov    %ebx,%eax
+  8009af:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8009b2:	5b                   	pop    %ebx
+  8009b3:	5e                   	pop    %esi
+  8009b4:	5d                   	pop    %ebp
+  8009b5:	c3                   	ret
+
+008009b6 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  8009b6:	55                   	push   %ebp
+  8009b7:	89 e5                	mov    %esp,%ebp
+  8009b9:	56                   	push   %esi
+  8009ba:	53                   	push   %ebx
+  8009bb:	89 c6                	mov    %eax,%esi
+  8009bd:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  8009bf:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  8009c6:	74 27                	je     8009ef <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8009c8:	6a 07                	push   $0x7
+  8009ca:	68 00 50 80 00       	push   $0x805000
+  8009cf:	56                   	push   %esi
+  8009d0:	ff 35 00 40 80 00    	push   0x804000
+  8009d6:	e8 95 15 00 00       	call   801f70 <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  8009db:	83 c4 0c             	add    $0xc,%esp
+  8009de:	6a 00                	push   $0x0
+  8009e0:	53                   	push   %ebx
+  8009e1:	6a 00                	push   $0x0
+  8009e3:	e8 14 15 00 00       	call   801efc <ipc_recv>
+}
+  8009e8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8009eb:	5b                   	pop    %ebx
+  8009ec:	5e                   	pop    %esi
+  8009ed:	5d                   	pop    %ebp
+  8009ee:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  8009ef:	83 ec 0c             	sub    $0xc,%esp
+  8009f2:	6a 01                	push   $0x1
+  8009f4:	e8 cb 15 00 00       	call   801fc4 <ipc_find_env>
+  8009f9:	a3 00 40 80 00       	mov    %eax,0x804000
+  8009fe:	83 c4 10             	add    $0x10,%esp
+  800a01:	eb c5                	jmp    8009c8 <fsipc+0x12>
+
+00800a03 <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  800a03:	55                   	push   %ebp
+  800a04:	89 e5                	mov    %esp,%ebp
+  800a06:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800a09:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a0c:	8b 40 0c             	mov    0xc(%eax),%eax
+  800a0f:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.set_size.req_size = newsize;
+  800a14:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a17:	a3 04 50 80 00       	mov    %eax,0x805004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  800a1c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a21:	b8 02 00 00 00       	mov    $0x2,%eax
+  800a26:	e8 8b ff ff ff       	call   8009b6 <fsipc>
+}
+  800a2b:	c9                   	leave
+  800a2c:	c3                   	ret
+
+00800a2d <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  800a2d:	55                   	push   %ebp
+  800a2e:	89 e5                	mov    %esp,%ebp
+  800a30:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800a33:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a36:	8b 40 0c             	mov    0xc(%eax),%eax
+  800a39:	a3 00 50 80 00       	mov    %eax,0x805000
+  return fsipc(FSREQ_FLUSH, NULL);
+  800a3e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a43:	b8 06 00 00 00       	mov    $0x6,%eax
+  800a48:	e8 69 ff ff ff       	call   8009b6 <fsipc>
+}
+  800a4d:	c9                   	leave
+  800a4e:	c3                   	ret
+
+00800a4f <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  800a4f:	55                   	push   %ebp
+  800a50:	89 e5                	mov    %esp,%ebp
+  800a52:	53                   	push   %ebx
+  800a53:	83 ec 04             	sub    $0x4,%esp
+  800a56:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800a59:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a5c:	8b 40 0c             	mov    0xc(%eax),%eax
+  800a5f:	a3 00 50 80 00       	mov    %eax,0x805000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  800a64:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a69:	b8 05 00 00 00       	mov    $0x5,%eax
+  800a6e:	e8 43 ff ff ff       	call   8009b6 <fsipc>
+  800a73:	85 c0                	test   %eax,%eax
+  800a75:	78 2c                	js     800aa3 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800a77:	83 ec 08             	sub    $0x8,%esp
+  800a7a:	68 00 50 80 00       	push   $0x805000
+  800a7f:	53                   	push   %ebx
+  800a80:	e8 47 11 00 00       	call   801bcc <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  800a85:	a1 80 50 80 00       	mov    0x805080,%eax
+  800a8a:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800a90:	a1 84 50 80 00       	mov    0x805084,%eax
+  800a95:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  800a9b:	83 c4 10             	add    $0x10,%esp
+  800a9e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800aa3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800aa6:	c9                   	leave
+  800aa7:	c3                   	ret
+
+00800aa8 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  800aa8:	55                   	push   %ebp
+  800aa9:	89 e5                	mov    %esp,%ebp
+  800aab:	83 ec 0c             	sub    $0xc,%esp
+  800aae:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800ab1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ab4:	8b 52 0c             	mov    0xc(%edx),%edx
+  800ab7:	89 15 00 50 80 00    	mov    %edx,0x805000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  800abd:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  800ac2:	39 d0                	cmp    %edx,%eax
+  800ac4:	0f 47 c2             	cmova  %edx,%eax
+  800ac7:	a3 04 50 80 00       	mov    %eax,0x805004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  800acc:	50                   	push   %eax
+  800acd:	ff 75 0c             	push   0xc(%ebp)
+  800ad0:	68 08 50 80 00       	push   $0x805008
+  800ad5:	e8 78 12 00 00       	call   801d52 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  800ada:	ba 00 00 00 00       	mov    $0x0,%edx
+  800adf:	b8 04 00 00 00       	mov    $0x4,%eax
+  800ae4:	e8 cd fe ff ff       	call   8009b6 <fsipc>
+}
+  800ae9:	c9                   	leave
+  800aea:	c3                   	ret
+
+00800aeb <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  800aeb:	55                   	push   %ebp
+  800aec:	89 e5                	mov    %esp,%ebp
+  800aee:	56                   	push   %esi
+  800aef:	53                   	push   %ebx
+  800af0:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800af3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800af6:	8b 40 0c             	mov    0xc(%eax),%eax
+  800af9:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.read.req_n = n;
+  800afe:	89 35 04 50 80 00    	mov    %esi,0x805004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  800b04:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b09:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b0e:	e8 a3 fe ff ff       	call   8009b6 <fsipc>
+  800b13:	89 c3                	mov    %eax,%ebx
+  800b15:	85 c0                	test   %eax,%eax
+  800b17:	78 1f                	js     800b38 <devfile_read+0x4d>
+  assert(r <= n);
+  800b19:	39 c6                	cmp    %eax,%esi
+  800b1b:	72 24                	jb     800b41 <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  800b1d:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800b22:	7f 33                	jg     800b57 <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  800b24:	83 ec 04             	sub    $0x4,%esp
+  800b27:	50                   	push   %eax
+  800b28:	68 00 50 80 00       	push   $0x805000
+  800b2d:	ff 75 0c             	push   0xc(%ebp)
+  800b30:	e8 1d 12 00 00       	call   801d52 <memmove>
+  return r;
+  800b35:	83 c4 10             	add    $0x10,%esp
+}
+  800b38:	89 d8                	mov    %ebx,%eax
+  800b3a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b3d:	5b                   	pop    %ebx
+  800b3e:	5e                   	pop    %esi
+  800b3f:	5d                   	pop    %ebp
+  800b40:	c3                   	ret
+  assert(r <= n);
+  800b41:	68 a8 25 80 00       	push   $0x8025a8
+  800b46:	68 af 25 80 00       	push   $0x8025af
+  800b4b:	6a 78                	push   $0x78
+  800b4d:	68 c4 25 80 00       	push   $0x8025c4
+  800b52:	e8 e1 09 00 00       	call   801538 <_panic>
+  assert(r <= PGSIZE);
+  800b57:	68 cf 25 80 00       	push   $0x8025cf
+  800b5c:	68 af 25 80 00       	push   $0x8025af
+  800b61:	6a 79                	push   $0x79
+  800b63:	68 c4 25 80 00       	push   $0x8025c4
+  800b68:	e8 cb 09 00 00       	call   801538 <_panic>
+
+00800b6d <open>:
+open(const char *path, int mode) {
+  800b6d:	55                   	push   %ebp
+  800b6e:	89 e5                	mov    %esp,%ebp
+  800b70:	56                   	push   %esi
+  800b71:	53                   	push   %ebx
+  800b72:	83 ec 1c             	sub    $0x1c,%esp
+  800b75:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  800b78:	56                   	push   %esi
+  800b79:	e8 13 10 00 00       	call   801b91 <strlen>
+  800b7e:	83 c4 10             	add    $0x10,%esp
+  800b81:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800b86:	7f 6c                	jg     800bf4 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  800b88:	83 ec 0c             	sub    $0xc,%esp
+  800b8b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b8e:	50                   	push   %eax
+  800b8f:	e8 ba f8 ff ff       	call   80044e <fd_alloc>
+  800b94:	89 c3                	mov    %eax,%ebx
+  800b96:	83 c4 10             	add    $0x10,%esp
+  800b99:	85 c0                	test   %eax,%eax
+  800b9b:	78 3c                	js     800bd9 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  800b9d:	83 ec 08             	sub    $0x8,%esp
+  800ba0:	56                   	push   %esi
+  800ba1:	68 00 50 80 00       	push   $0x805000
+  800ba6:	e8 21 10 00 00       	call   801bcc <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  800bab:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bae:	a3 00 54 80 00       	mov    %eax,0x805400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  800bb3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  800bb6:	b8 01 00 00 00       	mov    $0x1,%eax
+  800bbb:	e8 f6 fd ff ff       	call   8009b6 <fsipc>
+  800bc0:	89 c3                	mov    %eax,%ebx
+  800bc2:	83 c4 10             	add    $0x10,%esp
+  800bc5:	85 c0                	test   %eax,%eax
+  800bc7:	78 19                	js     800be2 <open+0x75>
+  return fd2num(fd);
+  800bc9:	83 ec 0c             	sub    $0xc,%esp
+  800bcc:	ff 75 f4             	push   -0xc(%ebp)
+  800bcf:	e8 53 f8 ff ff       	call   800427 <fd2num>
+  800bd4:	89 c3                	mov    %eax,%ebx
+  800bd6:	83 c4 10             	add    $0x10,%esp
+}
+  800bd9:	89 d8                	mov    %ebx,%eax
+  800bdb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800bde:	5b                   	pop    %ebx
+  800bdf:	5e                   	pop    %esi
+  800be0:	5d                   	pop    %ebp
+  800be1:	c3                   	ret
+    fd_close(fd, 0);
+  800be2:	83 ec 08             	sub    $0x8,%esp
+  800be5:	6a 00                	push   $0x0
+  800be7:	ff 75 f4             	push   -0xc(%ebp)
+  800bea:	e8 58 f9 ff ff       	call   800547 <fd_close>
+    return r;
+  800bef:	83 c4 10             	add    $0x10,%esp
+  800bf2:	eb e5                	jmp    800bd9 <open+0x6c>
+    return -E_BAD_PATH;
+  800bf4:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  800bf9:	eb de                	jmp    800bd9 <open+0x6c>
+
+00800bfb <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  800bfb:	55                   	push   %ebp
+  800bfc:	89 e5                	mov    %esp,%ebp
+  800bfe:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  800c01:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c06:	b8 08 00 00 00       	mov    $0x8,%eax
+  800c0b:	e8 a6 fd ff ff       	call   8009b6 <fsipc>
+}
+  800c10:	c9                   	leave
+  800c11:	c3                   	ret
+
+00800c12 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  800c12:	55                   	push   %ebp
+  800c13:	89 e5                	mov    %esp,%ebp
+  800c15:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  800c18:	68 db 25 80 00       	push   $0x8025db
+  800c1d:	ff 75 0c             	push   0xc(%ebp)
+  800c20:	e8 a7 0f 00 00       	call   801bcc <strcpy>
+	return 0;
+}
+  800c25:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c2a:	c9                   	leave
+  800c2b:	c3                   	ret
+
+00800c2c <devsock_close>:
+{
+  800c2c:	55                   	push   %ebp
+  800c2d:	89 e5                	mov    %esp,%ebp
+  800c2f:	53                   	push   %ebx
+  800c30:	83 ec 10             	sub    $0x10,%esp
+  800c33:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  800c36:	53                   	push   %ebx
+  800c37:	e8 c7 13 00 00       	call   802003 <pageref>
+  800c3c:	89 c2                	mov    %eax,%edx
+  800c3e:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  800c41:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  800c46:	83 fa 01             	cmp    $0x1,%edx
+  800c49:	74 05                	je     800c50 <devsock_close+0x24>
+}
+  800c4b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c4e:	c9                   	leave
+  800c4f:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  800c50:	83 ec 0c             	sub    $0xc,%esp
+  800c53:	ff 73 0c             	push   0xc(%ebx)
+  800c56:	e8 b7 02 00 00       	call   800f12 <nsipc_close>
+  800c5b:	83 c4 10             	add    $0x10,%esp
+  800c5e:	eb eb                	jmp    800c4b <devsock_close+0x1f>
+
+00800c60 <devsock_write>:
+{
+  800c60:	55                   	push   %ebp
+  800c61:	89 e5                	mov    %esp,%ebp
+  800c63:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  800c66:	6a 00                	push   $0x0
+  800c68:	ff 75 10             	push   0x10(%ebp)
+  800c6b:	ff 75 0c             	push   0xc(%ebp)
+  800c6e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c71:	ff 70 0c             	push   0xc(%eax)
+  800c74:	e8 79 03 00 00       	call   800ff2 <nsipc_send>
+}
+  800c79:	c9                   	leave
+  800c7a:	c3                   	ret
+
+00800c7b <devsock_read>:
+{
+  800c7b:	55                   	push   %ebp
+  800c7c:	89 e5                	mov    %esp,%ebp
+  800c7e:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  800c81:	6a 00                	push   $0x0
+  800c83:	ff 75 10             	push   0x10(%ebp)
+  800c86:	ff 75 0c             	push   0xc(%ebp)
+  800c89:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c8c:	ff 70 0c             	push   0xc(%eax)
+  800c8f:	e8 ef 02 00 00       	call   800f83 <nsipc_recv>
+}
+  800c94:	c9                   	leave
+  800c95:	c3                   	ret
+
+00800c96 <fd2sockid>:
+{
+  800c96:	55                   	push   %ebp
+  800c97:	89 e5                	mov    %esp,%ebp
+  800c99:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  800c9c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  800c9f:	52                   	push   %edx
+  800ca0:	50                   	push   %eax
+  800ca1:	e8 fe f7 ff ff       	call   8004a4 <fd_lookup>
+  800ca6:	83 c4 10             	add    $0x10,%esp
+  800ca9:	85 c0                	test   %eax,%eax
+  800cab:	78 10                	js     800cbd <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  800cad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800cb0:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  800cb6:	39 08                	cmp    %ecx,(%eax)
+  800cb8:	75 05                	jne    800cbf <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  800cba:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  800cbd:	c9                   	leave
+  800cbe:	c3                   	ret
+		return -E_NOT_SUPP;
+  800cbf:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800cc4:	eb f7                	jmp    800cbd <fd2sockid+0x27>
+
+00800cc6 <alloc_sockfd>:
+{
+  800cc6:	55                   	push   %ebp
+  800cc7:	89 e5                	mov    %esp,%ebp
+  800cc9:	56                   	push   %esi
+  800cca:	53                   	push   %ebx
+  800ccb:	83 ec 1c             	sub    $0x1c,%esp
+  800cce:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  800cd0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800cd3:	50                   	push   %eax
+  800cd4:	e8 75 f7 ff ff       	call   80044e <fd_alloc>
+  800cd9:	89 c3                	mov    %eax,%ebx
+  800cdb:	83 c4 10             	add    $0x10,%esp
+  800cde:	85 c0                	test   %eax,%eax
+  800ce0:	78 43                	js     800d25 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  800ce2:	83 ec 04             	sub    $0x4,%esp
+  800ce5:	68 07 04 00 00       	push   $0x407
+  800cea:	ff 75 f4             	push   -0xc(%ebp)
+  800ced:	6a 00                	push   $0x0
+  800cef:	e8 60 f4 ff ff       	call   800154 <sys_page_alloc>
+  800cf4:	89 c3                	mov    %eax,%ebx
+  800cf6:	83 c4 10             	add    $0x10,%esp
+  800cf9:	85 c0                	test   %eax,%eax
+  800cfb:	78 28                	js     800d25 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  800cfd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800d00:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  800d06:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  800d08:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800d0b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  800d12:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  800d15:	83 ec 0c             	sub    $0xc,%esp
+  800d18:	50                   	push   %eax
+  800d19:	e8 09 f7 ff ff       	call   800427 <fd2num>
+  800d1e:	89 c3                	mov    %eax,%ebx
+  800d20:	83 c4 10             	add    $0x10,%esp
+  800d23:	eb 0c                	jmp    800d31 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  800d25:	83 ec 0c             	sub    $0xc,%esp
+  800d28:	56                   	push   %esi
+  800d29:	e8 e4 01 00 00       	call   800f12 <nsipc_close>
+		return r;
+  800d2e:	83 c4 10             	add    $0x10,%esp
+}
+  800d31:	89 d8                	mov    %ebx,%eax
+  800d33:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d36:	5b                   	pop    %ebx
+  800d37:	5e                   	pop    %esi
+  800d38:	5d                   	pop    %ebp
+  800d39:	c3                   	ret
+
+00800d3a <accept>:
+{
+  800d3a:	55                   	push   %ebp
+  800d3b:	89 e5                	mov    %esp,%ebp
+  800d3d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800d40:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d43:	e8 4e ff ff ff       	call   800c96 <fd2sockid>
+  800d48:	85 c0                	test   %eax,%eax
+  800d4a:	78 1b                	js     800d67 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  800d4c:	83 ec 04             	sub    $0x4,%esp
+  800d4f:	ff 75 10             	push   0x10(%ebp)
+  800d52:	ff 75 0c             	push   0xc(%ebp)
+  800d55:	50                   	push   %eax
+  800d56:	e8 0e 01 00 00       	call   800e69 <nsipc_accept>
+  800d5b:	83 c4 10             	add    $0x10,%esp
+  800d5e:	85 c0                	test   %eax,%eax
+  800d60:	78 05                	js     800d67 <accept+0x2d>
+	return alloc_sockfd(r);
+  800d62:	e8 5f ff ff ff       	call   800cc6 <alloc_sockfd>
+}
+  800d67:	c9                   	leave
+  800d68:	c3                   	ret
+
+00800d69 <bind>:
+{
+  800d69:	55                   	push   %ebp
+  800d6a:	89 e5                	mov    %esp,%ebp
+  800d6c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800d6f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d72:	e8 1f ff ff ff       	call   800c96 <fd2sockid>
+  800d77:	85 c0                	test   %eax,%eax
+  800d79:	78 12                	js     800d8d <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  800d7b:	83 ec 04             	sub    $0x4,%esp
+  800d7e:	ff 75 10             	push   0x10(%ebp)
+  800d81:	ff 75 0c             	push   0xc(%ebp)
+  800d84:	50                   	push   %eax
+  800d85:	e8 31 01 00 00       	call   800ebb <nsipc_bind>
+  800d8a:	83 c4 10             	add    $0x10,%esp
+}
+  800d8d:	c9                   	leave
+  800d8e:	c3                   	ret
+
+00800d8f <shutdown>:
+{
+  800d8f:	55                   	push   %ebp
+  800d90:	89 e5                	mov    %esp,%ebp
+  800d92:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800d95:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d98:	e8 f9 fe ff ff       	call   800c96 <fd2sockid>
+  800d9d:	85 c0                	test   %eax,%eax
+  800d9f:	78 0f                	js     800db0 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  800da1:	83 ec 08             	sub    $0x8,%esp
+  800da4:	ff 75 0c             	push   0xc(%ebp)
+  800da7:	50                   	push   %eax
+  800da8:	e8 43 01 00 00       	call   800ef0 <nsipc_shutdown>
+  800dad:	83 c4 10             	add    $0x10,%esp
+}
+  800db0:	c9                   	leave
+  800db1:	c3                   	ret
+
+00800db2 <connect>:
+{
+  800db2:	55                   	push   %ebp
+  800db3:	89 e5                	mov    %esp,%ebp
+  800db5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800db8:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dbb:	e8 d6 fe ff ff       	call   800c96 <fd2sockid>
+  800dc0:	85 c0                	test   %eax,%eax
+  800dc2:	78 12                	js     800dd6 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  800dc4:	83 ec 04             	sub    $0x4,%esp
+  800dc7:	ff 75 10             	push   0x10(%ebp)
+  800dca:	ff 75 0c             	push   0xc(%ebp)
+  800dcd:	50                   	push   %eax
+  800dce:	e8 59 01 00 00       	call   800f2c <nsipc_connect>
+  800dd3:	83 c4 10             	add    $0x10,%esp
+}
+  800dd6:	c9                   	leave
+  800dd7:	c3                   	ret
+
+00800dd8 <listen>:
+{
+  800dd8:	55                   	push   %ebp
+  800dd9:	89 e5                	mov    %esp,%ebp
+  800ddb:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800dde:	8b 45 08             	mov    0x8(%ebp),%eax
+  800de1:	e8 b0 fe ff ff       	call   800c96 <fd2sockid>
+  800de6:	85 c0                	test   %eax,%eax
+  800de8:	78 0f                	js     800df9 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  800dea:	83 ec 08             	sub    $0x8,%esp
+  800ded:	ff 75 0c             	push   0xc(%ebp)
+  800df0:	50                   	push   %eax
+  800df1:	e8 6b 01 00 00       	call   800f61 <nsipc_listen>
+  800df6:	83 c4 10             	add    $0x10,%esp
+}
+  800df9:	c9                   	leave
+  800dfa:	c3                   	ret
+
+00800dfb <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  800dfb:	55                   	push   %ebp
+  800dfc:	89 e5                	mov    %esp,%ebp
+  800dfe:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  800e01:	ff 75 10             	push   0x10(%ebp)
+  800e04:	ff 75 0c             	push   0xc(%ebp)
+  800e07:	ff 75 08             	push   0x8(%ebp)
+  800e0a:	e8 41 02 00 00       	call   801050 <nsipc_socket>
+  800e0f:	83 c4 10             	add    $0x10,%esp
+  800e12:	85 c0                	test   %eax,%eax
+  800e14:	78 05                	js     800e1b <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  800e16:	e8 ab fe ff ff       	call   800cc6 <alloc_sockfd>
+}
+  800e1b:	c9                   	leave
+  800e1c:	c3                   	ret
+
+00800e1d <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  800e1d:	55                   	push   %ebp
+  800e1e:	89 e5                	mov    %esp,%ebp
+  800e20:	53                   	push   %ebx
+  800e21:	83 ec 04             	sub    $0x4,%esp
+  800e24:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  800e26:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800e2d:	74 26                	je     800e55 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  800e2f:	6a 07                	push   $0x7
+  800e31:	68 00 60 80 00       	push   $0x806000
+  800e36:	53                   	push   %ebx
+  800e37:	ff 35 04 40 80 00    	push   0x804004
+  800e3d:	e8 2e 11 00 00       	call   801f70 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  800e42:	83 c4 0c             	add    $0xc,%esp
+  800e45:	6a 00                	push   $0x0
+  800e47:	6a 00                	push   $0x0
+  800e49:	6a 00                	push   $0x0
+  800e4b:	e8 ac 10 00 00       	call   801efc <ipc_recv>
+}
+  800e50:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e53:	c9                   	leave
+  800e54:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  800e55:	83 ec 0c             	sub    $0xc,%esp
+  800e58:	6a 02                	push   $0x2
+  800e5a:	e8 65 11 00 00       	call   801fc4 <ipc_find_env>
+  800e5f:	a3 04 40 80 00       	mov    %eax,0x804004
+  800e64:	83 c4 10             	add    $0x10,%esp
+  800e67:	eb c6                	jmp    800e2f <nsipc+0x12>
+
+00800e69 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  800e69:	55                   	push   %ebp
+  800e6a:	89 e5                	mov    %esp,%ebp
+  800e6c:	56                   	push   %esi
+  800e6d:	53                   	push   %ebx
+  800e6e:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  800e71:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e74:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  800e79:	8b 06                	mov    (%esi),%eax
+  800e7b:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  800e80:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e85:	e8 93 ff ff ff       	call   800e1d <nsipc>
+  800e8a:	89 c3                	mov    %eax,%ebx
+  800e8c:	85 c0                	test   %eax,%eax
+  800e8e:	79 09                	jns    800e99 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  800e90:	89 d8                	mov    %ebx,%eax
+  800e92:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e95:	5b                   	pop    %ebx
+  800e96:	5e                   	pop    %esi
+  800e97:	5d                   	pop    %ebp
+  800e98:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  800e99:	83 ec 04             	sub    $0x4,%esp
+  800e9c:	ff 35 10 60 80 00    	push   0x806010
+  800ea2:	68 00 60 80 00       	push   $0x806000
+  800ea7:	ff 75 0c             	push   0xc(%ebp)
+  800eaa:	e8 a3 0e 00 00       	call   801d52 <memmove>
+		*addrlen = ret->ret_addrlen;
+  800eaf:	a1 10 60 80 00       	mov    0x806010,%eax
+  800eb4:	89 06                	mov    %eax,(%esi)
+  800eb6:	83 c4 10             	add    $0x10,%esp
+	return r;
+  800eb9:	eb d5                	jmp    800e90 <nsipc_accept+0x27>
+
+00800ebb <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  800ebb:	55                   	push   %ebp
+  800ebc:	89 e5                	mov    %esp,%ebp
+  800ebe:	53                   	push   %ebx
+  800ebf:	83 ec 08             	sub    $0x8,%esp
+  800ec2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  800ec5:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ec8:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  800ecd:	53                   	push   %ebx
+  800ece:	ff 75 0c             	push   0xc(%ebp)
+  800ed1:	68 04 60 80 00       	push   $0x806004
+  800ed6:	e8 77 0e 00 00       	call   801d52 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  800edb:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  800ee1:	b8 02 00 00 00       	mov    $0x2,%eax
+  800ee6:	e8 32 ff ff ff       	call   800e1d <nsipc>
+}
+  800eeb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800eee:	c9                   	leave
+  800eef:	c3                   	ret
+
+00800ef0 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  800ef0:	55                   	push   %ebp
+  800ef1:	89 e5                	mov    %esp,%ebp
+  800ef3:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  800ef6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ef9:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  800efe:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f01:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  800f06:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f0b:	e8 0d ff ff ff       	call   800e1d <nsipc>
+}
+  800f10:	c9                   	leave
+  800f11:	c3                   	ret
+
+00800f12 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  800f12:	55                   	push   %ebp
+  800f13:	89 e5                	mov    %esp,%ebp
+  800f15:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  800f18:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f1b:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  800f20:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f25:	e8 f3 fe ff ff       	call   800e1d <nsipc>
+}
+  800f2a:	c9                   	leave
+  800f2b:	c3                   	ret
+
+00800f2c <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  800f2c:	55                   	push   %ebp
+  800f2d:	89 e5                	mov    %esp,%ebp
+  800f2f:	53                   	push   %ebx
+  800f30:	83 ec 08             	sub    $0x8,%esp
+  800f33:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  800f36:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f39:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  800f3e:	53                   	push   %ebx
+  800f3f:	ff 75 0c             	push   0xc(%ebp)
+  800f42:	68 04 60 80 00       	push   $0x806004
+  800f47:	e8 06 0e 00 00       	call   801d52 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  800f4c:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  800f52:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f57:	e8 c1 fe ff ff       	call   800e1d <nsipc>
+}
+  800f5c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f5f:	c9                   	leave
+  800f60:	c3                   	ret
+
+00800f61 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  800f61:	55                   	push   %ebp
+  800f62:	89 e5                	mov    %esp,%ebp
+  800f64:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  800f67:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f6a:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  800f6f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f72:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  800f77:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f7c:	e8 9c fe ff ff       	call   800e1d <nsipc>
+}
+  800f81:	c9                   	leave
+  800f82:	c3                   	ret
+
+00800f83 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  800f83:	55                   	push   %ebp
+  800f84:	89 e5                	mov    %esp,%ebp
+  800f86:	56                   	push   %esi
+  800f87:	53                   	push   %ebx
+  800f88:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  800f8b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f8e:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  800f93:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  800f99:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f9c:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  800fa1:	b8 07 00 00 00       	mov    $0x7,%eax
+  800fa6:	e8 72 fe ff ff       	call   800e1d <nsipc>
+  800fab:	89 c3                	mov    %eax,%ebx
+  800fad:	85 c0                	test   %eax,%eax
+  800faf:	78 22                	js     800fd3 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  800fb1:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  800fb6:	39 c6                	cmp    %eax,%esi
+  800fb8:	0f 4e c6             	cmovle %esi,%eax
+  800fbb:	39 c3                	cmp    %eax,%ebx
+  800fbd:	7f 1d                	jg     800fdc <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  800fbf:	83 ec 04             	sub    $0x4,%esp
+  800fc2:	53                   	push   %ebx
+  800fc3:	68 00 60 80 00       	push   $0x806000
+  800fc8:	ff 75 0c             	push   0xc(%ebp)
+  800fcb:	e8 82 0d 00 00       	call   801d52 <memmove>
+  800fd0:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  800fd3:	89 d8                	mov    %ebx,%eax
+  800fd5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fd8:	5b                   	pop    %ebx
+  800fd9:	5e                   	pop    %esi
+  800fda:	5d                   	pop    %ebp
+  800fdb:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  800fdc:	68 e7 25 80 00       	push   $0x8025e7
+  800fe1:	68 af 25 80 00       	push   $0x8025af
+  800fe6:	6a 62                	push   $0x62
+  800fe8:	68 fc 25 80 00       	push   $0x8025fc
+  800fed:	e8 46 05 00 00       	call   801538 <_panic>
+
+00800ff2 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  800ff2:	55                   	push   %ebp
+  800ff3:	89 e5                	mov    %esp,%ebp
+  800ff5:	53                   	push   %ebx
+  800ff6:	83 ec 04             	sub    $0x4,%esp
+  800ff9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  800ffc:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fff:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  801004:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80100a:	7f 2e                	jg     80103a <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  80100c:	83 ec 04             	sub    $0x4,%esp
+  80100f:	53                   	push   %ebx
+  801010:	ff 75 0c             	push   0xc(%ebp)
+  801013:	68 0c 60 80 00       	push   $0x80600c
+  801018:	e8 35 0d 00 00       	call   801d52 <memmove>
+	nsipcbuf.send.req_size = size;
+  80101d:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  801023:	8b 45 14             	mov    0x14(%ebp),%eax
+  801026:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  80102b:	b8 08 00 00 00       	mov    $0x8,%eax
+  801030:	e8 e8 fd ff ff       	call   800e1d <nsipc>
+}
+  801035:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801038:	c9                   	leave
+  801039:	c3                   	ret
+	assert(size < 1600);
+  80103a:	68 08 26 80 00       	push   $0x802608
+  80103f:	68 af 25 80 00       	push   $0x8025af
+  801044:	6a 6d                	push   $0x6d
+  801046:	68 fc 25 80 00       	push   $0x8025fc
+  80104b:	e8 e8 04 00 00       	call   801538 <_panic>
+
+00801050 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801050:	55                   	push   %ebp
+  801051:	89 e5                	mov    %esp,%ebp
+  801053:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801056:	8b 45 08             	mov    0x8(%ebp),%eax
+  801059:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  80105e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801061:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  801066:	8b 45 10             	mov    0x10(%ebp),%eax
+  801069:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  80106e:	b8 09 00 00 00       	mov    $0x9,%eax
+  801073:	e8 a5 fd ff ff       	call   800e1d <nsipc>
+}
+  801078:	c9                   	leave
+  801079:	c3                   	ret
+
+0080107a <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80107a:	55                   	push   %ebp
+  80107b:	89 e5                	mov    %esp,%ebp
+  80107d:	56                   	push   %esi
+  80107e:	53                   	push   %ebx
+  80107f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801082:	83 ec 0c             	sub    $0xc,%esp
+  801085:	ff 75 08             	push   0x8(%ebp)
+  801088:	e8 aa f3 ff ff       	call   800437 <fd2data>
+  80108d:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80108f:	83 c4 08             	add    $0x8,%esp
+  801092:	68 14 26 80 00       	push   $0x802614
+  801097:	53                   	push   %ebx
+  801098:	e8 2f 0b 00 00       	call   801bcc <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  80109d:	8b 46 04             	mov    0x4(%esi),%eax
+  8010a0:	2b 06                	sub    (%esi),%eax
+  8010a2:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8010a8:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8010af:	00 00 00 
+	stat->st_dev = &devpipe;
+  8010b2:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  8010b9:	30 80 00 
+	return 0;
+}
+  8010bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010c1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8010c4:	5b                   	pop    %ebx
+  8010c5:	5e                   	pop    %esi
+  8010c6:	5d                   	pop    %ebp
+  8010c7:	c3                   	ret
+
+008010c8 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8010c8:	55                   	push   %ebp
+  8010c9:	89 e5                	mov    %esp,%ebp
+  8010cb:	53                   	push   %ebx
+  8010cc:	83 ec 0c             	sub    $0xc,%esp
+  8010cf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8010d2:	53                   	push   %ebx
+  8010d3:	6a 00                	push   $0x0
+  8010d5:	e8 ff f0 ff ff       	call   8001d9 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8010da:	89 1c 24             	mov    %ebx,(%esp)
+  8010dd:	e8 55 f3 ff ff       	call   800437 <fd2data>
+  8010e2:	83 c4 08             	add    $0x8,%esp
+  8010e5:	50                   	push   %eax
+  8010e6:	6a 00                	push   $0x0
+  8010e8:	e8 ec f0 ff ff       	call   8001d9 <sys_page_unmap>
+}
+  8010ed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010f0:	c9                   	leave
+  8010f1:	c3                   	ret
+
+008010f2 <_pipeisclosed>:
+{
+  8010f2:	55                   	push   %ebp
+  8010f3:	89 e5                	mov    %esp,%ebp
+  8010f5:	57                   	push   %edi
+  8010f6:	56                   	push   %esi
+  8010f7:	53                   	push   %ebx
+  8010f8:	83 ec 1c             	sub    $0x1c,%esp
+  8010fb:	89 c7                	mov    %eax,%edi
+  8010fd:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  8010ff:	a1 08 40 80 00       	mov    0x804008,%eax
+  801104:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801107:	83 ec 0c             	sub    $0xc,%esp
+  80110a:	57                   	push   %edi
+  80110b:	e8 f3 0e 00 00       	call   802003 <pageref>
+  801110:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801113:	89 34 24             	mov    %esi,(%esp)
+  801116:	e8 e8 0e 00 00       	call   802003 <pageref>
+		nn = thisenv->env_runs;
+  80111b:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801121:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801124:	83 c4 10             	add    $0x10,%esp
+  801127:	39 cb                	cmp    %ecx,%ebx
+  801129:	74 1b                	je     801146 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  80112b:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80112e:	75 cf                	jne    8010ff <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801130:	8b 42 58             	mov    0x58(%edx),%eax
+  801133:	6a 01                	push   $0x1
+  801135:	50                   	push   %eax
+  801136:	53                   	push   %ebx
+  801137:	68 1b 26 80 00       	push   $0x80261b
+  80113c:	e8 d2 04 00 00       	call   801613 <cprintf>
+  801141:	83 c4 10             	add    $0x10,%esp
+  801144:	eb b9                	jmp    8010ff <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801146:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801149:	0f 94 c0             	sete   %al
+  80114c:	0f b6 c0             	movzbl %al,%eax
+}
+  80114f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801152:	5b                   	pop    %ebx
+  801153:	5e                   	pop    %esi
+  801154:	5f                   	pop    %edi
+  801155:	5d                   	pop    %ebp
+  801156:	c3                   	ret
+
+00801157 <devpipe_write>:
+{
+  801157:	55                   	push   %ebp
+  801158:	89 e5                	mov    %esp,%ebp
+  80115a:	57                   	push   %edi
+  80115b:	56                   	push   %esi
+  80115c:	53                   	push   %ebx
+  80115d:	83 ec 28             	sub    $0x28,%esp
+  801160:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801163:	56                   	push   %esi
+  801164:	e8 ce f2 ff ff       	call   800437 <fd2data>
+  801169:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80116b:	83 c4 10             	add    $0x10,%esp
+  80116e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801173:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801176:	75 09                	jne    801181 <devpipe_write+0x2a>
+	return i;
+  801178:	89 f8                	mov    %edi,%eax
+  80117a:	eb 23                	jmp    80119f <devpipe_write+0x48>
+			sys_yield();
+  80117c:	e8 b4 ef ff ff       	call   800135 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801181:	8b 43 04             	mov    0x4(%ebx),%eax
+  801184:	8b 0b                	mov    (%ebx),%ecx
+  801186:	8d 51 20             	lea    0x20(%ecx),%edx
+  801189:	39 d0                	cmp    %edx,%eax
+  80118b:	72 1a                	jb     8011a7 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  80118d:	89 da                	mov    %ebx,%edx
+  80118f:	89 f0                	mov    %esi,%eax
+  801191:	e8 5c ff ff ff       	call   8010f2 <_pipeisclosed>
+  801196:	85 c0                	test   %eax,%eax
+  801198:	74 e2                	je     80117c <devpipe_write+0x25>
+				return 0;
+  80119a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80119f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011a2:	5b                   	pop    %ebx
+  8011a3:	5e                   	pop    %esi
+  8011a4:	5f                   	pop    %edi
+  8011a5:	5d                   	pop    %ebp
+  8011a6:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8011a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011aa:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8011ae:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8011b1:	89 c2                	mov    %eax,%edx
+  8011b3:	c1 fa 1f             	sar    $0x1f,%edx
+  8011b6:	89 d1                	mov    %edx,%ecx
+  8011b8:	c1 e9 1b             	shr    $0x1b,%ecx
+  8011bb:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8011be:	83 e2 1f             	and    $0x1f,%edx
+  8011c1:	29 ca                	sub    %ecx,%edx
+  8011c3:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8011c7:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8011cb:	83 c0 01             	add    $0x1,%eax
+  8011ce:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8011d1:	83 c7 01             	add    $0x1,%edi
+  8011d4:	eb 9d                	jmp    801173 <devpipe_write+0x1c>
+
+008011d6 <devpipe_read>:
+{
+  8011d6:	55                   	push   %ebp
+  8011d7:	89 e5                	mov    %esp,%ebp
+  8011d9:	57                   	push   %edi
+  8011da:	56                   	push   %esi
+  8011db:	53                   	push   %ebx
+  8011dc:	83 ec 18             	sub    $0x18,%esp
+  8011df:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8011e2:	57                   	push   %edi
+  8011e3:	e8 4f f2 ff ff       	call   800437 <fd2data>
+  8011e8:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8011ea:	83 c4 10             	add    $0x10,%esp
+  8011ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8011f2:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8011f5:	75 13                	jne    80120a <devpipe_read+0x34>
+	return i;
+  8011f7:	89 f0                	mov    %esi,%eax
+  8011f9:	eb 02                	jmp    8011fd <devpipe_read+0x27>
+				return i;
+  8011fb:	89 f0                	mov    %esi,%eax
+}
+  8011fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801200:	5b                   	pop    %ebx
+  801201:	5e                   	pop    %esi
+  801202:	5f                   	pop    %edi
+  801203:	5d                   	pop    %ebp
+  801204:	c3                   	ret
+			sys_yield();
+  801205:	e8 2b ef ff ff       	call   800135 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  80120a:	8b 03                	mov    (%ebx),%eax
+  80120c:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80120f:	75 18                	jne    801229 <devpipe_read+0x53>
+			if (i > 0)
+  801211:	85 f6                	test   %esi,%esi
+  801213:	75 e6                	jne    8011fb <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  801215:	89 da                	mov    %ebx,%edx
+  801217:	89 f8                	mov    %edi,%eax
+  801219:	e8 d4 fe ff ff       	call   8010f2 <_pipeisclosed>
+  80121e:	85 c0                	test   %eax,%eax
+  801220:	74 e3                	je     801205 <devpipe_read+0x2f>
+				return 0;
+  801222:	b8 00 00 00 00       	mov    $0x0,%eax
+  801227:	eb d4                	jmp    8011fd <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801229:	99                   	cltd
+  80122a:	c1 ea 1b             	shr    $0x1b,%edx
+  80122d:	01 d0                	add    %edx,%eax
+  80122f:	83 e0 1f             	and    $0x1f,%eax
+  801232:	29 d0                	sub    %edx,%eax
+  801234:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801239:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80123c:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80123f:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  801242:	83 c6 01             	add    $0x1,%esi
+  801245:	eb ab                	jmp    8011f2 <devpipe_read+0x1c>
+
+00801247 <pipe>:
+{
+  801247:	55                   	push   %ebp
+  801248:	89 e5                	mov    %esp,%ebp
+  80124a:	56                   	push   %esi
+  80124b:	53                   	push   %ebx
+  80124c:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80124f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801252:	50                   	push   %eax
+  801253:	e8 f6 f1 ff ff       	call   80044e <fd_alloc>
+  801258:	89 c3                	mov    %eax,%ebx
+  80125a:	83 c4 10             	add    $0x10,%esp
+  80125d:	85 c0                	test   %eax,%eax
+  80125f:	0f 88 23 01 00 00    	js     801388 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801265:	83 ec 04             	sub    $0x4,%esp
+  801268:	68 07 04 00 00       	push   $0x407
+  80126d:	ff 75 f4             	push   -0xc(%ebp)
+  801270:	6a 00                	push   $0x0
+  801272:	e8 dd ee ff ff       	call   800154 <sys_page_alloc>
+  801277:	89 c3                	mov    %eax,%ebx
+  801279:	83 c4 10             	add    $0x10,%esp
+  80127c:	85 c0                	test   %eax,%eax
+  80127e:	0f 88 04 01 00 00    	js     801388 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801284:	83 ec 0c             	sub    $0xc,%esp
+  801287:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80128a:	50                   	push   %eax
+  80128b:	e8 be f1 ff ff       	call   80044e <fd_alloc>
+  801290:	89 c3                	mov    %eax,%ebx
+  801292:	83 c4 10             	add    $0x10,%esp
+  801295:	85 c0                	test   %eax,%eax
+  801297:	0f 88 db 00 00 00    	js     801378 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80129d:	83 ec 04             	sub    $0x4,%esp
+  8012a0:	68 07 04 00 00       	push   $0x407
+  8012a5:	ff 75 f0             	push   -0x10(%ebp)
+  8012a8:	6a 00                	push   $0x0
+  8012aa:	e8 a5 ee ff ff       	call   800154 <sys_page_alloc>
+  8012af:	89 c3                	mov    %eax,%ebx
+  8012b1:	83 c4 10             	add    $0x10,%esp
+  8012b4:	85 c0                	test   %eax,%eax
+  8012b6:	0f 88 bc 00 00 00    	js     801378 <pipe+0x131>
+	va = fd2data(fd0);
+  8012bc:	83 ec 0c             	sub    $0xc,%esp
+  8012bf:	ff 75 f4             	push   -0xc(%ebp)
+  8012c2:	e8 70 f1 ff ff       	call   800437 <fd2data>
+  8012c7:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8012c9:	83 c4 0c             	add    $0xc,%esp
+  8012cc:	68 07 04 00 00       	push   $0x407
+  8012d1:	50                   	push   %eax
+  8012d2:	6a 00                	push   $0x0
+  8012d4:	e8 7b ee ff ff       	call   800154 <sys_page_alloc>
+  8012d9:	89 c3                	mov    %eax,%ebx
+  8012db:	83 c4 10             	add    $0x10,%esp
+  8012de:	85 c0                	test   %eax,%eax
+  8012e0:	0f 88 82 00 00 00    	js     801368 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8012e6:	83 ec 0c             	sub    $0xc,%esp
+  8012e9:	ff 75 f0             	push   -0x10(%ebp)
+  8012ec:	e8 46 f1 ff ff       	call   800437 <fd2data>
+  8012f1:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8012f8:	50                   	push   %eax
+  8012f9:	6a 00                	push   $0x0
+  8012fb:	56                   	push   %esi
+  8012fc:	6a 00                	push   $0x0
+  8012fe:	e8 94 ee ff ff       	call   800197 <sys_page_map>
+  801303:	89 c3                	mov    %eax,%ebx
+  801305:	83 c4 20             	add    $0x20,%esp
+  801308:	85 c0                	test   %eax,%eax
+  80130a:	78 4e                	js     80135a <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80130c:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  801311:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801314:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  801316:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801319:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  801320:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801323:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  801325:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801328:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80132f:	83 ec 0c             	sub    $0xc,%esp
+  801332:	ff 75 f4             	push   -0xc(%ebp)
+  801335:	e8 ed f0 ff ff       	call   800427 <fd2num>
+  80133a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80133d:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80133f:	83 c4 04             	add    $0x4,%esp
+  801342:	ff 75 f0             	push   -0x10(%ebp)
+  801345:	e8 dd f0 ff ff       	call   800427 <fd2num>
+  80134a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80134d:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  801350:	83 c4 10             	add    $0x10,%esp
+  801353:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801358:	eb 2e                	jmp    801388 <pipe+0x141>
+	sys_page_unmap(0, va);
+  80135a:	83 ec 08             	sub    $0x8,%esp
+  80135d:	56                   	push   %esi
+  80135e:	6a 00                	push   $0x0
+  801360:	e8 74 ee ff ff       	call   8001d9 <sys_page_unmap>
+  801365:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  801368:	83 ec 08             	sub    $0x8,%esp
+  80136b:	ff 75 f0             	push   -0x10(%ebp)
+  80136e:	6a 00                	push   $0x0
+  801370:	e8 64 ee ff ff       	call   8001d9 <sys_page_unmap>
+  801375:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  801378:	83 ec 08             	sub    $0x8,%esp
+  80137b:	ff 75 f4             	push   -0xc(%ebp)
+  80137e:	6a 00                	push   $0x0
+  801380:	e8 54 ee ff ff       	call   8001d9 <sys_page_unmap>
+  801385:	83 c4 10             	add    $0x10,%esp
+}
+  801388:	89 d8                	mov    %ebx,%eax
+  80138a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80138d:	5b                   	pop    %ebx
+  80138e:	5e                   	pop    %esi
+  80138f:	5d                   	pop    %ebp
+  801390:	c3                   	ret
+
+00801391 <pipeisclosed>:
+{
+  801391:	55                   	push   %ebp
+  801392:	89 e5                	mov    %esp,%ebp
+  801394:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801397:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80139a:	50                   	push   %eax
+  80139b:	ff 75 08             	push   0x8(%ebp)
+  80139e:	e8 01 f1 ff ff       	call   8004a4 <fd_lookup>
+  8013a3:	83 c4 10             	add    $0x10,%esp
+  8013a6:	85 c0                	test   %eax,%eax
+  8013a8:	78 18                	js     8013c2 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8013aa:	83 ec 0c             	sub    $0xc,%esp
+  8013ad:	ff 75 f4             	push   -0xc(%ebp)
+  8013b0:	e8 82 f0 ff ff       	call   800437 <fd2data>
+  8013b5:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8013b7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013ba:	e8 33 fd ff ff       	call   8010f2 <_pipeisclosed>
+  8013bf:	83 c4 10             	add    $0x10,%esp
+}
+  8013c2:	c9                   	leave
+  8013c3:	c3                   	ret
+
+008013c4 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8013c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013c9:	c3                   	ret
+
+008013ca <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8013ca:	55                   	push   %ebp
+  8013cb:	89 e5                	mov    %esp,%ebp
+  8013cd:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8013d0:	68 33 26 80 00       	push   $0x802633
+  8013d5:	ff 75 0c             	push   0xc(%ebp)
+  8013d8:	e8 ef 07 00 00       	call   801bcc <strcpy>
+	return 0;
+}
+  8013dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013e2:	c9                   	leave
+  8013e3:	c3                   	ret
+
+008013e4 <devcons_write>:
+{
+  8013e4:	55                   	push   %ebp
+  8013e5:	89 e5                	mov    %esp,%ebp
+  8013e7:	57                   	push   %edi
+  8013e8:	56                   	push   %esi
+  8013e9:	53                   	push   %ebx
+  8013ea:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8013f0:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8013f5:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8013fb:	eb 2e                	jmp    80142b <devcons_write+0x47>
+		m = n - tot;
+  8013fd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801400:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  801402:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801407:	39 c3                	cmp    %eax,%ebx
+  801409:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80140c:	83 ec 04             	sub    $0x4,%esp
+  80140f:	53                   	push   %ebx
+  801410:	89 f0                	mov    %esi,%eax
+  801412:	03 45 0c             	add    0xc(%ebp),%eax
+  801415:	50                   	push   %eax
+  801416:	57                   	push   %edi
+  801417:	e8 36 09 00 00       	call   801d52 <memmove>
+		sys_cputs(buf, m);
+  80141c:	83 c4 08             	add    $0x8,%esp
+  80141f:	53                   	push   %ebx
+  801420:	57                   	push   %edi
+  801421:	e8 72 ec ff ff       	call   800098 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  801426:	01 de                	add    %ebx,%esi
+  801428:	83 c4 10             	add    $0x10,%esp
+  80142b:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80142e:	72 cd                	jb     8013fd <devcons_write+0x19>
+}
+  801430:	89 f0                	mov    %esi,%eax
+  801432:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801435:	5b                   	pop    %ebx
+  801436:	5e                   	pop    %esi
+  801437:	5f                   	pop    %edi
+  801438:	5d                   	pop    %ebp
+  801439:	c3                   	ret
+
+0080143a <devcons_read>:
+{
+  80143a:	55                   	push   %ebp
+  80143b:	89 e5                	mov    %esp,%ebp
+  80143d:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  801440:	b8 00 00 00 00       	mov    $0x0,%eax
+  801445:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801449:	75 07                	jne    801452 <devcons_read+0x18>
+  80144b:	eb 1f                	jmp    80146c <devcons_read+0x32>
+		sys_yield();
+  80144d:	e8 e3 ec ff ff       	call   800135 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  801452:	e8 5f ec ff ff       	call   8000b6 <sys_cgetc>
+  801457:	85 c0                	test   %eax,%eax
+  801459:	74 f2                	je     80144d <devcons_read+0x13>
+	if (c < 0)
+  80145b:	78 0f                	js     80146c <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80145d:	83 f8 04             	cmp    $0x4,%eax
+  801460:	74 0c                	je     80146e <devcons_read+0x34>
+	*(char*)vbuf = c;
+  801462:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801465:	88 02                	mov    %al,(%edx)
+	return 1;
+  801467:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80146c:	c9                   	leave
+  80146d:	c3                   	ret
+		return 0;
+  80146e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801473:	eb f7                	jmp    80146c <devcons_read+0x32>
+
+00801475 <cputchar>:
+{
+  801475:	55                   	push   %ebp
+  801476:	89 e5                	mov    %esp,%ebp
+  801478:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80147b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80147e:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  801481:	6a 01                	push   $0x1
+  801483:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801486:	50                   	push   %eax
+  801487:	e8 0c ec ff ff       	call   800098 <sys_cputs>
+}
+  80148c:	83 c4 10             	add    $0x10,%esp
+  80148f:	c9                   	leave
+  801490:	c3                   	ret
+
+00801491 <getchar>:
+{
+  801491:	55                   	push   %ebp
+  801492:	89 e5                	mov    %esp,%ebp
+  801494:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  801497:	6a 01                	push   $0x1
+  801499:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80149c:	50                   	push   %eax
+  80149d:	6a 00                	push   $0x0
+  80149f:	e8 66 f2 ff ff       	call   80070a <read>
+	if (r < 0)
+  8014a4:	83 c4 10             	add    $0x10,%esp
+  8014a7:	85 c0                	test   %eax,%eax
+  8014a9:	78 06                	js     8014b1 <getchar+0x20>
+	if (r < 1)
+  8014ab:	74 06                	je     8014b3 <getchar+0x22>
+	return c;
+  8014ad:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8014b1:	c9                   	leave
+  8014b2:	c3                   	ret
+		return -E_EOF;
+  8014b3:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8014b8:	eb f7                	jmp    8014b1 <getchar+0x20>
+
+008014ba <iscons>:
+{
+  8014ba:	55                   	push   %ebp
+  8014bb:	89 e5                	mov    %esp,%ebp
+  8014bd:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8014c0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014c3:	50                   	push   %eax
+  8014c4:	ff 75 08             	push   0x8(%ebp)
+  8014c7:	e8 d8 ef ff ff       	call   8004a4 <fd_lookup>
+  8014cc:	83 c4 10             	add    $0x10,%esp
+  8014cf:	85 c0                	test   %eax,%eax
+  8014d1:	78 11                	js     8014e4 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8014d3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014d6:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  8014dc:	39 10                	cmp    %edx,(%eax)
+  8014de:	0f 94 c0             	sete   %al
+  8014e1:	0f b6 c0             	movzbl %al,%eax
+}
+  8014e4:	c9                   	leave
+  8014e5:	c3                   	ret
+
+008014e6 <opencons>:
+{
+  8014e6:	55                   	push   %ebp
+  8014e7:	89 e5                	mov    %esp,%ebp
+  8014e9:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8014ec:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014ef:	50                   	push   %eax
+  8014f0:	e8 59 ef ff ff       	call   80044e <fd_alloc>
+  8014f5:	83 c4 10             	add    $0x10,%esp
+  8014f8:	85 c0                	test   %eax,%eax
+  8014fa:	78 3a                	js     801536 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8014fc:	83 ec 04             	sub    $0x4,%esp
+  8014ff:	68 07 04 00 00       	push   $0x407
+  801504:	ff 75 f4             	push   -0xc(%ebp)
+  801507:	6a 00                	push   $0x0
+  801509:	e8 46 ec ff ff       	call   800154 <sys_page_alloc>
+  80150e:	83 c4 10             	add    $0x10,%esp
+  801511:	85 c0                	test   %eax,%eax
+  801513:	78 21                	js     801536 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  801515:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801518:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  80151e:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  801520:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801523:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80152a:	83 ec 0c             	sub    $0xc,%esp
+  80152d:	50                   	push   %eax
+  80152e:	e8 f4 ee ff ff       	call   800427 <fd2num>
+  801533:	83 c4 10             	add    $0x10,%esp
+}
+  801536:	c9                   	leave
+  801537:	c3                   	ret
+
+00801538 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  801538:	55                   	push   %ebp
+  801539:	89 e5                	mov    %esp,%ebp
+  80153b:	56                   	push   %esi
+  80153c:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80153d:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  801540:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  801546:	e8 cb eb ff ff       	call   800116 <sys_getenvid>
+  80154b:	83 ec 0c             	sub    $0xc,%esp
+  80154e:	ff 75 0c             	push   0xc(%ebp)
+  801551:	ff 75 08             	push   0x8(%ebp)
+  801554:	56                   	push   %esi
+  801555:	50                   	push   %eax
+  801556:	68 40 26 80 00       	push   $0x802640
+  80155b:	e8 b3 00 00 00       	call   801613 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  801560:	83 c4 18             	add    $0x18,%esp
+  801563:	53                   	push   %ebx
+  801564:	ff 75 10             	push   0x10(%ebp)
+  801567:	e8 56 00 00 00       	call   8015c2 <vcprintf>
+	cprintf("\n");
+  80156c:	c7 04 24 2c 26 80 00 	movl   $0x80262c,(%esp)
+  801573:	e8 9b 00 00 00       	call   801613 <cprintf>
+  801578:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80157b:	cc                   	int3
+	while (1)
+  80157c:	eb fd                	jmp    80157b <_panic+0x43>
+
+0080157e <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80157e:	55                   	push   %ebp
+  80157f:	89 e5                	mov    %esp,%ebp
+  801581:	53                   	push   %ebx
+  801582:	83 ec 04             	sub    $0x4,%esp
+  801585:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  801588:	8b 13                	mov    (%ebx),%edx
+  80158a:	8d 42 01             	lea    0x1(%edx),%eax
+  80158d:	89 03                	mov    %eax,(%ebx)
+  80158f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801592:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  801596:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80159b:	74 09                	je     8015a6 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80159d:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8015a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015a4:	c9                   	leave
+  8015a5:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8015a6:	83 ec 08             	sub    $0x8,%esp
+  8015a9:	68 ff 00 00 00       	push   $0xff
+  8015ae:	8d 43 08             	lea    0x8(%ebx),%eax
+  8015b1:	50                   	push   %eax
+  8015b2:	e8 e1 ea ff ff       	call   800098 <sys_cputs>
+		b->idx = 0;
+  8015b7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8015bd:	83 c4 10             	add    $0x10,%esp
+  8015c0:	eb db                	jmp    80159d <putch+0x1f>
+
+008015c2 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8015c2:	55                   	push   %ebp
+  8015c3:	89 e5                	mov    %esp,%ebp
+  8015c5:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8015cb:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8015d2:	00 00 00 
+	b.cnt = 0;
+  8015d5:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8015dc:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8015df:	ff 75 0c             	push   0xc(%ebp)
+  8015e2:	ff 75 08             	push   0x8(%ebp)
+  8015e5:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8015eb:	50                   	push   %eax
+  8015ec:	68 7e 15 80 00       	push   $0x80157e
+  8015f1:	e8 14 01 00 00       	call   80170a <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8015f6:	83 c4 08             	add    $0x8,%esp
+  8015f9:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8015ff:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  801605:	50                   	push   %eax
+  801606:	e8 8d ea ff ff       	call   800098 <sys_cputs>
+
+	return b.cnt;
+}
+  80160b:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  801611:	c9                   	leave
+  801612:	c3                   	ret
+
+00801613 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  801613:	55                   	push   %ebp
+  801614:	89 e5                	mov    %esp,%ebp
+  801616:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  801619:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80161c:	50                   	push   %eax
+  80161d:	ff 75 08             	push   0x8(%ebp)
+  801620:	e8 9d ff ff ff       	call   8015c2 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  801625:	c9                   	leave
+  801626:	c3                   	ret
+
+00801627 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  801627:	55                   	push   %ebp
+  801628:	89 e5                	mov    %esp,%ebp
+  80162a:	57                   	push   %edi
+  80162b:	56                   	push   %esi
+  80162c:	53                   	push   %ebx
+  80162d:	83 ec 1c             	sub    $0x1c,%esp
+  801630:	89 c7                	mov    %eax,%edi
+  801632:	89 d6                	mov    %edx,%esi
+  801634:	8b 45 08             	mov    0x8(%ebp),%eax
+  801637:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80163a:	89 d1                	mov    %edx,%ecx
+  80163c:	89 c2                	mov    %eax,%edx
+  80163e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801641:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801644:	8b 45 10             	mov    0x10(%ebp),%eax
+  801647:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80164a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80164d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801654:	39 c2                	cmp    %eax,%edx
+  801656:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  801659:	72 3e                	jb     801699 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80165b:	83 ec 0c             	sub    $0xc,%esp
+  80165e:	ff 75 18             	push   0x18(%ebp)
+  801661:	83 eb 01             	sub    $0x1,%ebx
+  801664:	53                   	push   %ebx
+  801665:	50                   	push   %eax
+  801666:	83 ec 08             	sub    $0x8,%esp
+  801669:	ff 75 e4             	push   -0x1c(%ebp)
+  80166c:	ff 75 e0             	push   -0x20(%ebp)
+  80166f:	ff 75 dc             	push   -0x24(%ebp)
+  801672:	ff 75 d8             	push   -0x28(%ebp)
+  801675:	e8 d6 0a 00 00       	call   802150 <__udivdi3>
+  80167a:	83 c4 18             	add    $0x18,%esp
+  80167d:	52                   	push   %edx
+  80167e:	50                   	push   %eax
+  80167f:	89 f2                	mov    %esi,%edx
+  801681:	89 f8                	mov    %edi,%eax
+  801683:	e8 9f ff ff ff       	call   801627 <printnum>
+  801688:	83 c4 20             	add    $0x20,%esp
+  80168b:	eb 13                	jmp    8016a0 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80168d:	83 ec 08             	sub    $0x8,%esp
+  801690:	56                   	push   %esi
+  801691:	ff 75 18             	push   0x18(%ebp)
+  801694:	ff d7                	call   *%edi
+  801696:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  801699:	83 eb 01             	sub    $0x1,%ebx
+  80169c:	85 db                	test   %ebx,%ebx
+  80169e:	7f ed                	jg     80168d <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8016a0:	83 ec 08             	sub    $0x8,%esp
+  8016a3:	56                   	push   %esi
+  8016a4:	83 ec 04             	sub    $0x4,%esp
+  8016a7:	ff 75 e4             	push   -0x1c(%ebp)
+  8016aa:	ff 75 e0             	push   -0x20(%ebp)
+  8016ad:	ff 75 dc             	push   -0x24(%ebp)
+  8016b0:	ff 75 d8             	push   -0x28(%ebp)
+  8016b3:	e8 68 0b 00 00       	call   802220 <__umoddi3>
+  8016b8:	83 c4 14             	add    $0x14,%esp
+  8016bb:	0f be 80 63 26 80 00 	movsbl 0x802663(%eax),%eax
+  8016c2:	50                   	push   %eax
+  8016c3:	ff d7                	call   *%edi
+}
+  8016c5:	83 c4 10             	add    $0x10,%esp
+  8016c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016cb:	5b                   	pop    %ebx
+  8016cc:	5e                   	pop    %esi
+  8016cd:	5f                   	pop    %edi
+  8016ce:	5d                   	pop    %ebp
+  8016cf:	c3                   	ret
+
+008016d0 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8016d0:	55                   	push   %ebp
+  8016d1:	89 e5                	mov    %esp,%ebp
+  8016d3:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8016d6:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8016da:	8b 10                	mov    (%eax),%edx
+  8016dc:	3b 50 04             	cmp    0x4(%eax),%edx
+  8016df:	73 0a                	jae    8016eb <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8016e1:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8016e4:	89 08                	mov    %ecx,(%eax)
+  8016e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016e9:	88 02                	mov    %al,(%edx)
+}
+  8016eb:	5d                   	pop    %ebp
+  8016ec:	c3                   	ret
+
+008016ed <printfmt>:
+{
+  8016ed:	55                   	push   %ebp
+  8016ee:	89 e5                	mov    %esp,%ebp
+  8016f0:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8016f3:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8016f6:	50                   	push   %eax
+  8016f7:	ff 75 10             	push   0x10(%ebp)
+  8016fa:	ff 75 0c             	push   0xc(%ebp)
+  8016fd:	ff 75 08             	push   0x8(%ebp)
+  801700:	e8 05 00 00 00       	call   80170a <vprintfmt>
+}
+  801705:	83 c4 10             	add    $0x10,%esp
+  801708:	c9                   	leave
+  801709:	c3                   	ret
+
+0080170a <vprintfmt>:
+{
+  80170a:	55                   	push   %ebp
+  80170b:	89 e5                	mov    %esp,%ebp
+  80170d:	57                   	push   %edi
+  80170e:	56                   	push   %esi
+  80170f:	53                   	push   %ebx
+  801710:	83 ec 2c             	sub    $0x2c,%esp
+  801713:	8b 75 08             	mov    0x8(%ebp),%esi
+  801716:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801719:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80171c:	eb 0a                	jmp    801728 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80171e:	83 ec 08             	sub    $0x8,%esp
+  801721:	53                   	push   %ebx
+  801722:	50                   	push   %eax
+  801723:	ff d6                	call   *%esi
+  801725:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801728:	83 c7 01             	add    $0x1,%edi
+  80172b:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80172f:	83 f8 25             	cmp    $0x25,%eax
+  801732:	74 0c                	je     801740 <vprintfmt+0x36>
+			if (ch == '\0')
+  801734:	85 c0                	test   %eax,%eax
+  801736:	75 e6                	jne    80171e <vprintfmt+0x14>
+}
+  801738:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80173b:	5b                   	pop    %ebx
+  80173c:	5e                   	pop    %esi
+  80173d:	5f                   	pop    %edi
+  80173e:	5d                   	pop    %ebp
+  80173f:	c3                   	ret
+		padc = ' ';
+  801740:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  801744:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80174b:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  801752:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  801759:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80175e:	8d 47 01             	lea    0x1(%edi),%eax
+  801761:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801764:	0f b6 17             	movzbl (%edi),%edx
+  801767:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80176a:	3c 55                	cmp    $0x55,%al
+  80176c:	0f 87 9a 03 00 00    	ja     801b0c <vprintfmt+0x402>
+  801772:	0f b6 c0             	movzbl %al,%eax
+  801775:	ff 24 85 a0 27 80 00 	jmp    *0x8027a0(,%eax,4)
+  80177c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  80177f:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  801783:	eb d9                	jmp    80175e <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  801785:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801788:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80178c:	eb d0                	jmp    80175e <vprintfmt+0x54>
+  80178e:	0f b6 d2             	movzbl %dl,%edx
+  801791:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  801794:	b8 00 00 00 00       	mov    $0x0,%eax
+  801799:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80179c:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80179f:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8017a3:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8017a6:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8017a9:	83 f9 09             	cmp    $0x9,%ecx
+  8017ac:	77 55                	ja     801803 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8017ae:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8017b1:	eb e9                	jmp    80179c <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8017b3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8017b6:	8b 00                	mov    (%eax),%eax
+  8017b8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8017bb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8017be:	8d 40 04             	lea    0x4(%eax),%eax
+  8017c1:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8017c4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8017c7:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8017cb:	79 91                	jns    80175e <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8017cd:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8017d0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8017d3:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8017da:	eb 82                	jmp    80175e <vprintfmt+0x54>
+			if (width < 0)
+  8017dc:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8017df:	85 d2                	test   %edx,%edx
+  8017e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017e6:	0f 49 c2             	cmovns %edx,%eax
+  8017e9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8017ec:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8017ef:	e9 6a ff ff ff       	jmp    80175e <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8017f4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8017f7:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8017fe:	e9 5b ff ff ff       	jmp    80175e <vprintfmt+0x54>
+  801803:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801806:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801809:	eb bc                	jmp    8017c7 <vprintfmt+0xbd>
+			lflag++;
+  80180b:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80180e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  801811:	e9 48 ff ff ff       	jmp    80175e <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  801816:	8b 45 14             	mov    0x14(%ebp),%eax
+  801819:	8d 78 04             	lea    0x4(%eax),%edi
+  80181c:	83 ec 08             	sub    $0x8,%esp
+  80181f:	53                   	push   %ebx
+  801820:	ff 30                	push   (%eax)
+  801822:	ff d6                	call   *%esi
+			break;
+  801824:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  801827:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80182a:	e9 7c 02 00 00       	jmp    801aab <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  80182f:	8b 45 14             	mov    0x14(%ebp),%eax
+  801832:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  801835:	8b 10                	mov    (%eax),%edx
+  801837:	89 d0                	mov    %edx,%eax
+  801839:	f7 d8                	neg    %eax
+  80183b:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80183e:	83 f8 10             	cmp    $0x10,%eax
+  801841:	7f 23                	jg     801866 <vprintfmt+0x15c>
+  801843:	8b 14 85 00 29 80 00 	mov    0x802900(,%eax,4),%edx
+  80184a:	85 d2                	test   %edx,%edx
+  80184c:	74 18                	je     801866 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  80184e:	52                   	push   %edx
+  80184f:	68 c1 25 80 00       	push   $0x8025c1
+  801854:	53                   	push   %ebx
+  801855:	56                   	push   %esi
+  801856:	e8 92 fe ff ff       	call   8016ed <printfmt>
+  80185b:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80185e:	89 7d 14             	mov    %edi,0x14(%ebp)
+  801861:	e9 45 02 00 00       	jmp    801aab <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  801866:	50                   	push   %eax
+  801867:	68 7b 26 80 00       	push   $0x80267b
+  80186c:	53                   	push   %ebx
+  80186d:	56                   	push   %esi
+  80186e:	e8 7a fe ff ff       	call   8016ed <printfmt>
+  801873:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801876:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  801879:	e9 2d 02 00 00       	jmp    801aab <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80187e:	8b 45 14             	mov    0x14(%ebp),%eax
+  801881:	83 c0 04             	add    $0x4,%eax
+  801884:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  801887:	8b 45 14             	mov    0x14(%ebp),%eax
+  80188a:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80188c:	85 c9                	test   %ecx,%ecx
+  80188e:	b8 74 26 80 00       	mov    $0x802674,%eax
+  801893:	0f 45 c1             	cmovne %ecx,%eax
+  801896:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  801899:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80189d:	7e 06                	jle    8018a5 <vprintfmt+0x19b>
+  80189f:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8018a3:	75 0b                	jne    8018b0 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8018a5:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8018a8:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8018ab:	89 75 08             	mov    %esi,0x8(%ebp)
+  8018ae:	eb 5c                	jmp    80190c <vprintfmt+0x202>
+  8018b0:	83 ec 08             	sub    $0x8,%esp
+  8018b3:	ff 75 d0             	push   -0x30(%ebp)
+  8018b6:	ff 75 cc             	push   -0x34(%ebp)
+  8018b9:	e8 eb 02 00 00       	call   801ba9 <strnlen>
+  8018be:	89 c2                	mov    %eax,%edx
+  8018c0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8018c3:	29 d0                	sub    %edx,%eax
+  8018c5:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8018c8:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8018cc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8018cf:	89 75 08             	mov    %esi,0x8(%ebp)
+  8018d2:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8018d4:	eb 0e                	jmp    8018e4 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8018d6:	83 ec 08             	sub    $0x8,%esp
+  8018d9:	53                   	push   %ebx
+  8018da:	57                   	push   %edi
+  8018db:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8018de:	83 ee 01             	sub    $0x1,%esi
+  8018e1:	83 c4 10             	add    $0x10,%esp
+  8018e4:	85 f6                	test   %esi,%esi
+  8018e6:	7f ee                	jg     8018d6 <vprintfmt+0x1cc>
+  8018e8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8018eb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8018ee:	85 c0                	test   %eax,%eax
+  8018f0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018f5:	0f 49 d0             	cmovns %eax,%edx
+  8018f8:	29 d0                	sub    %edx,%eax
+  8018fa:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8018fd:	eb a6                	jmp    8018a5 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8018ff:	83 ec 08             	sub    $0x8,%esp
+  801902:	53                   	push   %ebx
+  801903:	52                   	push   %edx
+  801904:	ff 55 08             	call   *0x8(%ebp)
+  801907:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80190a:	89 f1                	mov    %esi,%ecx
+  80190c:	8d 71 01             	lea    0x1(%ecx),%esi
+  80190f:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  801913:	0f be d0             	movsbl %al,%edx
+  801916:	85 d2                	test   %edx,%edx
+  801918:	74 28                	je     801942 <vprintfmt+0x238>
+  80191a:	85 ff                	test   %edi,%edi
+  80191c:	78 05                	js     801923 <vprintfmt+0x219>
+  80191e:	83 ef 01             	sub    $0x1,%edi
+  801921:	78 30                	js     801953 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  801923:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  801927:	74 d6                	je     8018ff <vprintfmt+0x1f5>
+  801929:	0f be c0             	movsbl %al,%eax
+  80192c:	83 e8 20             	sub    $0x20,%eax
+  80192f:	83 f8 5e             	cmp    $0x5e,%eax
+  801932:	76 cb                	jbe    8018ff <vprintfmt+0x1f5>
+					putch('?', putdat);
+  801934:	83 ec 08             	sub    $0x8,%esp
+  801937:	53                   	push   %ebx
+  801938:	6a 3f                	push   $0x3f
+  80193a:	ff 55 08             	call   *0x8(%ebp)
+  80193d:	83 c4 10             	add    $0x10,%esp
+  801940:	eb c8                	jmp    80190a <vprintfmt+0x200>
+  801942:	8b 75 08             	mov    0x8(%ebp),%esi
+  801945:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  801948:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80194b:	01 d0                	add    %edx,%eax
+  80194d:	29 c8                	sub    %ecx,%eax
+  80194f:	89 c7                	mov    %eax,%edi
+  801951:	eb 13                	jmp    801966 <vprintfmt+0x25c>
+  801953:	8b 75 08             	mov    0x8(%ebp),%esi
+  801956:	eb ed                	jmp    801945 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  801958:	83 ec 08             	sub    $0x8,%esp
+  80195b:	53                   	push   %ebx
+  80195c:	6a 20                	push   $0x20
+  80195e:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  801960:	83 ef 01             	sub    $0x1,%edi
+  801963:	83 c4 10             	add    $0x10,%esp
+  801966:	85 ff                	test   %edi,%edi
+  801968:	7f ee                	jg     801958 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80196a:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80196d:	89 45 14             	mov    %eax,0x14(%ebp)
+  801970:	e9 36 01 00 00       	jmp    801aab <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  801975:	83 f9 01             	cmp    $0x1,%ecx
+  801978:	7f 1f                	jg     801999 <vprintfmt+0x28f>
+	else if (lflag)
+  80197a:	85 c9                	test   %ecx,%ecx
+  80197c:	74 67                	je     8019e5 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  80197e:	8b 45 14             	mov    0x14(%ebp),%eax
+  801981:	8b 00                	mov    (%eax),%eax
+  801983:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801986:	89 c1                	mov    %eax,%ecx
+  801988:	c1 f9 1f             	sar    $0x1f,%ecx
+  80198b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80198e:	8b 45 14             	mov    0x14(%ebp),%eax
+  801991:	8d 40 04             	lea    0x4(%eax),%eax
+  801994:	89 45 14             	mov    %eax,0x14(%ebp)
+  801997:	eb 17                	jmp    8019b0 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  801999:	8b 45 14             	mov    0x14(%ebp),%eax
+  80199c:	8b 50 04             	mov    0x4(%eax),%edx
+  80199f:	8b 00                	mov    (%eax),%eax
+  8019a1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8019a4:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8019a7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019aa:	8d 40 08             	lea    0x8(%eax),%eax
+  8019ad:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8019b0:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8019b3:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8019b6:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8019bb:	85 c9                	test   %ecx,%ecx
+  8019bd:	0f 89 ce 00 00 00    	jns    801a91 <vprintfmt+0x387>
+				putch('-', putdat);
+  8019c3:	83 ec 08             	sub    $0x8,%esp
+  8019c6:	53                   	push   %ebx
+  8019c7:	6a 2d                	push   $0x2d
+  8019c9:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8019cb:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8019ce:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8019d1:	f7 da                	neg    %edx
+  8019d3:	83 d1 00             	adc    $0x0,%ecx
+  8019d6:	f7 d9                	neg    %ecx
+  8019d8:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8019db:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8019e0:	e9 ac 00 00 00       	jmp    801a91 <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  8019e5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019e8:	8b 00                	mov    (%eax),%eax
+  8019ea:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8019ed:	89 c1                	mov    %eax,%ecx
+  8019ef:	c1 f9 1f             	sar    $0x1f,%ecx
+  8019f2:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8019f5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019f8:	8d 40 04             	lea    0x4(%eax),%eax
+  8019fb:	89 45 14             	mov    %eax,0x14(%ebp)
+  8019fe:	eb b0                	jmp    8019b0 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  801a00:	83 f9 01             	cmp    $0x1,%ecx
+  801a03:	7f 1b                	jg     801a20 <vprintfmt+0x316>
+	else if (lflag)
+  801a05:	85 c9                	test   %ecx,%ecx
+  801a07:	74 2c                	je     801a35 <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  801a09:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a0c:	8b 10                	mov    (%eax),%edx
+  801a0e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a13:	8d 40 04             	lea    0x4(%eax),%eax
+  801a16:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801a19:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  801a1e:	eb 71                	jmp    801a91 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  801a20:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a23:	8b 10                	mov    (%eax),%edx
+  801a25:	8b 48 04             	mov    0x4(%eax),%ecx
+  801a28:	8d 40 08             	lea    0x8(%eax),%eax
+  801a2b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801a2e:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  801a33:	eb 5c                	jmp    801a91 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  801a35:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a38:	8b 10                	mov    (%eax),%edx
+  801a3a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a3f:	8d 40 04             	lea    0x4(%eax),%eax
+  801a42:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801a45:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  801a4a:	eb 45                	jmp    801a91 <vprintfmt+0x387>
+			putch('X', putdat);
+  801a4c:	83 ec 08             	sub    $0x8,%esp
+  801a4f:	53                   	push   %ebx
+  801a50:	6a 58                	push   $0x58
+  801a52:	ff d6                	call   *%esi
+			putch('X', putdat);
+  801a54:	83 c4 08             	add    $0x8,%esp
+  801a57:	53                   	push   %ebx
+  801a58:	6a 58                	push   $0x58
+  801a5a:	ff d6                	call   *%esi
+			putch('X', putdat);
+  801a5c:	83 c4 08             	add    $0x8,%esp
+  801a5f:	53                   	push   %ebx
+  801a60:	6a 58                	push   $0x58
+  801a62:	ff d6                	call   *%esi
+			break;
+  801a64:	83 c4 10             	add    $0x10,%esp
+  801a67:	eb 42                	jmp    801aab <vprintfmt+0x3a1>
+			putch('0', putdat);
+  801a69:	83 ec 08             	sub    $0x8,%esp
+  801a6c:	53                   	push   %ebx
+  801a6d:	6a 30                	push   $0x30
+  801a6f:	ff d6                	call   *%esi
+			putch('x', putdat);
+  801a71:	83 c4 08             	add    $0x8,%esp
+  801a74:	53                   	push   %ebx
+  801a75:	6a 78                	push   $0x78
+  801a77:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  801a79:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a7c:	8b 10                	mov    (%eax),%edx
+  801a7e:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  801a83:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  801a86:	8d 40 04             	lea    0x4(%eax),%eax
+  801a89:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801a8c:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  801a91:	83 ec 0c             	sub    $0xc,%esp
+  801a94:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  801a98:	50                   	push   %eax
+  801a99:	ff 75 e0             	push   -0x20(%ebp)
+  801a9c:	57                   	push   %edi
+  801a9d:	51                   	push   %ecx
+  801a9e:	52                   	push   %edx
+  801a9f:	89 da                	mov    %ebx,%edx
+  801aa1:	89 f0                	mov    %esi,%eax
+  801aa3:	e8 7f fb ff ff       	call   801627 <printnum>
+			break;
+  801aa8:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  801aab:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801aae:	e9 75 fc ff ff       	jmp    801728 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  801ab3:	83 f9 01             	cmp    $0x1,%ecx
+  801ab6:	7f 1b                	jg     801ad3 <vprintfmt+0x3c9>
+	else if (lflag)
+  801ab8:	85 c9                	test   %ecx,%ecx
+  801aba:	74 2c                	je     801ae8 <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  801abc:	8b 45 14             	mov    0x14(%ebp),%eax
+  801abf:	8b 10                	mov    (%eax),%edx
+  801ac1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ac6:	8d 40 04             	lea    0x4(%eax),%eax
+  801ac9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801acc:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  801ad1:	eb be                	jmp    801a91 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  801ad3:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ad6:	8b 10                	mov    (%eax),%edx
+  801ad8:	8b 48 04             	mov    0x4(%eax),%ecx
+  801adb:	8d 40 08             	lea    0x8(%eax),%eax
+  801ade:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801ae1:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  801ae6:	eb a9                	jmp    801a91 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  801ae8:	8b 45 14             	mov    0x14(%ebp),%eax
+  801aeb:	8b 10                	mov    (%eax),%edx
+  801aed:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801af2:	8d 40 04             	lea    0x4(%eax),%eax
+  801af5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801af8:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  801afd:	eb 92                	jmp    801a91 <vprintfmt+0x387>
+			putch(ch, putdat);
+  801aff:	83 ec 08             	sub    $0x8,%esp
+  801b02:	53                   	push   %ebx
+  801b03:	6a 25                	push   $0x25
+  801b05:	ff d6                	call   *%esi
+			break;
+  801b07:	83 c4 10             	add    $0x10,%esp
+  801b0a:	eb 9f                	jmp    801aab <vprintfmt+0x3a1>
+			putch('%', putdat);
+  801b0c:	83 ec 08             	sub    $0x8,%esp
+  801b0f:	53                   	push   %ebx
+  801b10:	6a 25                	push   $0x25
+  801b12:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801b14:	83 c4 10             	add    $0x10,%esp
+  801b17:	89 f8                	mov    %edi,%eax
+  801b19:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  801b1d:	74 05                	je     801b24 <vprintfmt+0x41a>
+  801b1f:	83 e8 01             	sub    $0x1,%eax
+  801b22:	eb f5                	jmp    801b19 <vprintfmt+0x40f>
+  801b24:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801b27:	eb 82                	jmp    801aab <vprintfmt+0x3a1>
+
+00801b29 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  801b29:	55                   	push   %ebp
+  801b2a:	89 e5                	mov    %esp,%ebp
+  801b2c:	83 ec 18             	sub    $0x18,%esp
+  801b2f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b32:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  801b35:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  801b38:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  801b3c:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  801b3f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  801b46:	85 c0                	test   %eax,%eax
+  801b48:	74 26                	je     801b70 <vsnprintf+0x47>
+  801b4a:	85 d2                	test   %edx,%edx
+  801b4c:	7e 22                	jle    801b70 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  801b4e:	ff 75 14             	push   0x14(%ebp)
+  801b51:	ff 75 10             	push   0x10(%ebp)
+  801b54:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  801b57:	50                   	push   %eax
+  801b58:	68 d0 16 80 00       	push   $0x8016d0
+  801b5d:	e8 a8 fb ff ff       	call   80170a <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  801b62:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801b65:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  801b68:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b6b:	83 c4 10             	add    $0x10,%esp
+}
+  801b6e:	c9                   	leave
+  801b6f:	c3                   	ret
+		return -E_INVAL;
+  801b70:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b75:	eb f7                	jmp    801b6e <vsnprintf+0x45>
+
+00801b77 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801b77:	55                   	push   %ebp
+  801b78:	89 e5                	mov    %esp,%ebp
+  801b7a:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  801b7d:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  801b80:	50                   	push   %eax
+  801b81:	ff 75 10             	push   0x10(%ebp)
+  801b84:	ff 75 0c             	push   0xc(%ebp)
+  801b87:	ff 75 08             	push   0x8(%ebp)
+  801b8a:	e8 9a ff ff ff       	call   801b29 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  801b8f:	c9                   	leave
+  801b90:	c3                   	ret
+
+00801b91 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  801b91:	55                   	push   %ebp
+  801b92:	89 e5                	mov    %esp,%ebp
+  801b94:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  801b97:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b9c:	eb 03                	jmp    801ba1 <strlen+0x10>
+		n++;
+  801b9e:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  801ba1:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  801ba5:	75 f7                	jne    801b9e <strlen+0xd>
+	return n;
+}
+  801ba7:	5d                   	pop    %ebp
+  801ba8:	c3                   	ret
+
+00801ba9 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  801ba9:	55                   	push   %ebp
+  801baa:	89 e5                	mov    %esp,%ebp
+  801bac:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801baf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801bb2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bb7:	eb 03                	jmp    801bbc <strnlen+0x13>
+		n++;
+  801bb9:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801bbc:	39 d0                	cmp    %edx,%eax
+  801bbe:	74 08                	je     801bc8 <strnlen+0x1f>
+  801bc0:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  801bc4:	75 f3                	jne    801bb9 <strnlen+0x10>
+  801bc6:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  801bc8:	89 d0                	mov    %edx,%eax
+  801bca:	5d                   	pop    %ebp
+  801bcb:	c3                   	ret
+
+00801bcc <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801bcc:	55                   	push   %ebp
+  801bcd:	89 e5                	mov    %esp,%ebp
+  801bcf:	53                   	push   %ebx
+  801bd0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801bd3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  801bd6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bdb:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  801bdf:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  801be2:	83 c0 01             	add    $0x1,%eax
+  801be5:	84 d2                	test   %dl,%dl
+  801be7:	75 f2                	jne    801bdb <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  801be9:	89 c8                	mov    %ecx,%eax
+  801beb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bee:	c9                   	leave
+  801bef:	c3                   	ret
+
+00801bf0 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801bf0:	55                   	push   %ebp
+  801bf1:	89 e5                	mov    %esp,%ebp
+  801bf3:	53                   	push   %ebx
+  801bf4:	83 ec 10             	sub    $0x10,%esp
+  801bf7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  801bfa:	53                   	push   %ebx
+  801bfb:	e8 91 ff ff ff       	call   801b91 <strlen>
+  801c00:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  801c03:	ff 75 0c             	push   0xc(%ebp)
+  801c06:	01 d8                	add    %ebx,%eax
+  801c08:	50                   	push   %eax
+  801c09:	e8 be ff ff ff       	call   801bcc <strcpy>
+	return dst;
+}
+  801c0e:	89 d8                	mov    %ebx,%eax
+  801c10:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c13:	c9                   	leave
+  801c14:	c3                   	ret
+
+00801c15 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801c15:	55                   	push   %ebp
+  801c16:	89 e5                	mov    %esp,%ebp
+  801c18:	56                   	push   %esi
+  801c19:	53                   	push   %ebx
+  801c1a:	8b 75 08             	mov    0x8(%ebp),%esi
+  801c1d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  801c20:	89 f3                	mov    %esi,%ebx
+  801c22:	03 5d 10             	add    0x10(%ebp),%ebx
+  801c25:	89 f0                	mov    %esi,%eax
+  801c27:	eb 0f                	jmp    801c38 <strncpy+0x23>
+		*dst++ = *src;
+  801c29:	83 c0 01             	add    $0x1,%eax
+  801c2c:	0f b6 0a             	movzbl (%edx),%ecx
+  801c2f:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  801c32:	80 f9 01             	cmp    $0x1,%cl
+  801c35:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  801c38:	39 d8                	cmp    %ebx,%eax
+  801c3a:	75 ed                	jne    801c29 <strncpy+0x14>
+	}
+	return ret;
+}
+  801c3c:	89 f0                	mov    %esi,%eax
+  801c3e:	5b                   	pop    %ebx
+  801c3f:	5e                   	pop    %esi
+  801c40:	5d                   	pop    %ebp
+  801c41:	c3                   	ret
+
+00801c42 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801c42:	55                   	push   %ebp
+  801c43:	89 e5                	mov    %esp,%ebp
+  801c45:	56                   	push   %esi
+  801c46:	53                   	push   %ebx
+  801c47:	8b 75 08             	mov    0x8(%ebp),%esi
+  801c4a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c4d:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  801c50:	89 f0                	mov    %esi,%eax
+  801c52:	85 d2                	test   %edx,%edx
+  801c54:	74 21                	je     801c77 <strlcpy+0x35>
+  801c56:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  801c5a:	89 f2                	mov    %esi,%edx
+  801c5c:	eb 09                	jmp    801c67 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  801c5e:	83 c1 01             	add    $0x1,%ecx
+  801c61:	83 c2 01             	add    $0x1,%edx
+  801c64:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  801c67:	39 c2                	cmp    %eax,%edx
+  801c69:	74 09                	je     801c74 <strlcpy+0x32>
+  801c6b:	0f b6 19             	movzbl (%ecx),%ebx
+  801c6e:	84 db                	test   %bl,%bl
+  801c70:	75 ec                	jne    801c5e <strlcpy+0x1c>
+  801c72:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  801c74:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  801c77:	29 f0                	sub    %esi,%eax
+}
+  801c79:	5b                   	pop    %ebx
+  801c7a:	5e                   	pop    %esi
+  801c7b:	5d                   	pop    %ebp
+  801c7c:	c3                   	ret
+
+00801c7d <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  801c7d:	55                   	push   %ebp
+  801c7e:	89 e5                	mov    %esp,%ebp
+  801c80:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801c83:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  801c86:	eb 06                	jmp    801c8e <strcmp+0x11>
+		p++, q++;
+  801c88:	83 c1 01             	add    $0x1,%ecx
+  801c8b:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  801c8e:	0f b6 01             	movzbl (%ecx),%eax
+  801c91:	84 c0                	test   %al,%al
+  801c93:	74 04                	je     801c99 <strcmp+0x1c>
+  801c95:	3a 02                	cmp    (%edx),%al
+  801c97:	74 ef                	je     801c88 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801c99:	0f b6 c0             	movzbl %al,%eax
+  801c9c:	0f b6 12             	movzbl (%edx),%edx
+  801c9f:	29 d0                	sub    %edx,%eax
+}
+  801ca1:	5d                   	pop    %ebp
+  801ca2:	c3                   	ret
+
+00801ca3 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801ca3:	55                   	push   %ebp
+  801ca4:	89 e5                	mov    %esp,%ebp
+  801ca6:	53                   	push   %ebx
+  801ca7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801caa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801cad:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  801cb0:	eb 09                	jmp    801cbb <strncmp+0x18>
+		n--, p++, q++;
+  801cb2:	83 ea 01             	sub    $0x1,%edx
+  801cb5:	83 c0 01             	add    $0x1,%eax
+  801cb8:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  801cbb:	85 d2                	test   %edx,%edx
+  801cbd:	74 18                	je     801cd7 <strncmp+0x34>
+  801cbf:	0f b6 18             	movzbl (%eax),%ebx
+  801cc2:	84 db                	test   %bl,%bl
+  801cc4:	74 04                	je     801cca <strncmp+0x27>
+  801cc6:	3a 19                	cmp    (%ecx),%bl
+  801cc8:	74 e8                	je     801cb2 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801cca:	0f b6 00             	movzbl (%eax),%eax
+  801ccd:	0f b6 11             	movzbl (%ecx),%edx
+  801cd0:	29 d0                	sub    %edx,%eax
+}
+  801cd2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cd5:	c9                   	leave
+  801cd6:	c3                   	ret
+		return 0;
+  801cd7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cdc:	eb f4                	jmp    801cd2 <strncmp+0x2f>
+
+00801cde <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801cde:	55                   	push   %ebp
+  801cdf:	89 e5                	mov    %esp,%ebp
+  801ce1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ce4:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801ce8:	eb 03                	jmp    801ced <strchr+0xf>
+  801cea:	83 c0 01             	add    $0x1,%eax
+  801ced:	0f b6 10             	movzbl (%eax),%edx
+  801cf0:	84 d2                	test   %dl,%dl
+  801cf2:	74 06                	je     801cfa <strchr+0x1c>
+		if (*s == c)
+  801cf4:	38 ca                	cmp    %cl,%dl
+  801cf6:	75 f2                	jne    801cea <strchr+0xc>
+  801cf8:	eb 05                	jmp    801cff <strchr+0x21>
+			return (char *) s;
+	return 0;
+  801cfa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801cff:	5d                   	pop    %ebp
+  801d00:	c3                   	ret
+
+00801d01 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801d01:	55                   	push   %ebp
+  801d02:	89 e5                	mov    %esp,%ebp
+  801d04:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d07:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801d0b:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  801d0e:	38 ca                	cmp    %cl,%dl
+  801d10:	74 09                	je     801d1b <strfind+0x1a>
+  801d12:	84 d2                	test   %dl,%dl
+  801d14:	74 05                	je     801d1b <strfind+0x1a>
+	for (; *s; s++)
+  801d16:	83 c0 01             	add    $0x1,%eax
+  801d19:	eb f0                	jmp    801d0b <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  801d1b:	5d                   	pop    %ebp
+  801d1c:	c3                   	ret
+
+00801d1d <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801d1d:	55                   	push   %ebp
+  801d1e:	89 e5                	mov    %esp,%ebp
+  801d20:	57                   	push   %edi
+  801d21:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801d24:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  801d27:	85 c9                	test   %ecx,%ecx
+  801d29:	74 20                	je     801d4b <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  801d2b:	89 f8                	mov    %edi,%eax
+  801d2d:	09 c8                	or     %ecx,%eax
+  801d2f:	a8 03                	test   $0x3,%al
+  801d31:	75 12                	jne    801d45 <memset+0x28>
+		c &= 0xFF;
+  801d33:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  801d37:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  801d3d:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  801d40:	fc                   	cld
+  801d41:	f3 ab                	rep stos %eax,%es:(%edi)
+  801d43:	eb 06                	jmp    801d4b <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801d45:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d48:	fc                   	cld
+  801d49:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  801d4b:	89 f8                	mov    %edi,%eax
+  801d4d:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  801d50:	c9                   	leave
+  801d51:	c3                   	ret
+
+00801d52 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801d52:	55                   	push   %ebp
+  801d53:	89 e5                	mov    %esp,%ebp
+  801d55:	57                   	push   %edi
+  801d56:	56                   	push   %esi
+  801d57:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d5a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801d5d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  801d60:	39 c6                	cmp    %eax,%esi
+  801d62:	73 32                	jae    801d96 <memmove+0x44>
+  801d64:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  801d67:	39 d0                	cmp    %edx,%eax
+  801d69:	73 2b                	jae    801d96 <memmove+0x44>
+		s += n;
+		d += n;
+  801d6b:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801d6e:	89 d6                	mov    %edx,%esi
+  801d70:	09 fe                	or     %edi,%esi
+  801d72:	09 ce                	or     %ecx,%esi
+  801d74:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  801d7a:	75 0e                	jne    801d8a <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801d7c:	83 ef 04             	sub    $0x4,%edi
+  801d7f:	8d 72 fc             	lea    -0x4(%edx),%esi
+  801d82:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  801d85:	fd                   	std
+  801d86:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801d88:	eb 09                	jmp    801d93 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801d8a:	83 ef 01             	sub    $0x1,%edi
+  801d8d:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  801d90:	fd                   	std
+  801d91:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801d93:	fc                   	cld
+  801d94:	eb 1a                	jmp    801db0 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801d96:	89 f2                	mov    %esi,%edx
+  801d98:	09 c2                	or     %eax,%edx
+  801d9a:	09 ca                	or     %ecx,%edx
+  801d9c:	f6 c2 03             	test   $0x3,%dl
+  801d9f:	75 0a                	jne    801dab <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801da1:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  801da4:	89 c7                	mov    %eax,%edi
+  801da6:	fc                   	cld
+  801da7:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801da9:	eb 05                	jmp    801db0 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  801dab:	89 c7                	mov    %eax,%edi
+  801dad:	fc                   	cld
+  801dae:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  801db0:	5e                   	pop    %esi
+  801db1:	5f                   	pop    %edi
+  801db2:	5d                   	pop    %ebp
+  801db3:	c3                   	ret
+
+00801db4 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801db4:	55                   	push   %ebp
+  801db5:	89 e5                	mov    %esp,%ebp
+  801db7:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  801dba:	ff 75 10             	push   0x10(%ebp)
+  801dbd:	ff 75 0c             	push   0xc(%ebp)
+  801dc0:	ff 75 08             	push   0x8(%ebp)
+  801dc3:	e8 8a ff ff ff       	call   801d52 <memmove>
+}
+  801dc8:	c9                   	leave
+  801dc9:	c3                   	ret
+
+00801dca <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801dca:	55                   	push   %ebp
+  801dcb:	89 e5                	mov    %esp,%ebp
+  801dcd:	56                   	push   %esi
+  801dce:	53                   	push   %ebx
+  801dcf:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dd2:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  801dd5:	89 c6                	mov    %eax,%esi
+  801dd7:	03 75 10             	add    0x10(%ebp),%esi
+  801dda:	eb 06                	jmp    801de2 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  801ddc:	83 c0 01             	add    $0x1,%eax
+  801ddf:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  801de2:	39 f0                	cmp    %esi,%eax
+  801de4:	74 14                	je     801dfa <memcmp+0x30>
+		if (*s1 != *s2)
+  801de6:	0f b6 08             	movzbl (%eax),%ecx
+  801de9:	0f b6 1a             	movzbl (%edx),%ebx
+  801dec:	38 d9                	cmp    %bl,%cl
+  801dee:	74 ec                	je     801ddc <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  801df0:	0f b6 c1             	movzbl %cl,%eax
+  801df3:	0f b6 db             	movzbl %bl,%ebx
+  801df6:	29 d8                	sub    %ebx,%eax
+  801df8:	eb 05                	jmp    801dff <memcmp+0x35>
+	}
+
+	return 0;
+  801dfa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801dff:	5b                   	pop    %ebx
+  801e00:	5e                   	pop    %esi
+  801e01:	5d                   	pop    %ebp
+  801e02:	c3                   	ret
+
+00801e03 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801e03:	55                   	push   %ebp
+  801e04:	89 e5                	mov    %esp,%ebp
+  801e06:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e09:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  801e0c:	89 c2                	mov    %eax,%edx
+  801e0e:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  801e11:	eb 03                	jmp    801e16 <memfind+0x13>
+  801e13:	83 c0 01             	add    $0x1,%eax
+  801e16:	39 d0                	cmp    %edx,%eax
+  801e18:	73 04                	jae    801e1e <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801e1a:	38 08                	cmp    %cl,(%eax)
+  801e1c:	75 f5                	jne    801e13 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  801e1e:	5d                   	pop    %ebp
+  801e1f:	c3                   	ret
+
+00801e20 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  801e20:	55                   	push   %ebp
+  801e21:	89 e5                	mov    %esp,%ebp
+  801e23:	57                   	push   %edi
+  801e24:	56                   	push   %esi
+  801e25:	53                   	push   %ebx
+  801e26:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e29:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801e2c:	eb 03                	jmp    801e31 <strtol+0x11>
+		s++;
+  801e2e:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  801e31:	0f b6 02             	movzbl (%edx),%eax
+  801e34:	3c 20                	cmp    $0x20,%al
+  801e36:	74 f6                	je     801e2e <strtol+0xe>
+  801e38:	3c 09                	cmp    $0x9,%al
+  801e3a:	74 f2                	je     801e2e <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  801e3c:	3c 2b                	cmp    $0x2b,%al
+  801e3e:	74 2a                	je     801e6a <strtol+0x4a>
+	int neg = 0;
+  801e40:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  801e45:	3c 2d                	cmp    $0x2d,%al
+  801e47:	74 2b                	je     801e74 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801e49:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  801e4f:	75 0f                	jne    801e60 <strtol+0x40>
+  801e51:	80 3a 30             	cmpb   $0x30,(%edx)
+  801e54:	74 28                	je     801e7e <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  801e56:	85 db                	test   %ebx,%ebx
+  801e58:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801e5d:	0f 44 d8             	cmove  %eax,%ebx
+  801e60:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e65:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  801e68:	eb 46                	jmp    801eb0 <strtol+0x90>
+		s++;
+  801e6a:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  801e6d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e72:	eb d5                	jmp    801e49 <strtol+0x29>
+		s++, neg = 1;
+  801e74:	83 c2 01             	add    $0x1,%edx
+  801e77:	bf 01 00 00 00       	mov    $0x1,%edi
+  801e7c:	eb cb                	jmp    801e49 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801e7e:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  801e82:	74 0e                	je     801e92 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  801e84:	85 db                	test   %ebx,%ebx
+  801e86:	75 d8                	jne    801e60 <strtol+0x40>
+		s++, base = 8;
+  801e88:	83 c2 01             	add    $0x1,%edx
+  801e8b:	bb 08 00 00 00       	mov    $0x8,%ebx
+  801e90:	eb ce                	jmp    801e60 <strtol+0x40>
+		s += 2, base = 16;
+  801e92:	83 c2 02             	add    $0x2,%edx
+  801e95:	bb 10 00 00 00       	mov    $0x10,%ebx
+  801e9a:	eb c4                	jmp    801e60 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  801e9c:	0f be c0             	movsbl %al,%eax
+  801e9f:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  801ea2:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801ea5:	7d 3a                	jge    801ee1 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  801ea7:	83 c2 01             	add    $0x1,%edx
+  801eaa:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  801eae:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  801eb0:	0f b6 02             	movzbl (%edx),%eax
+  801eb3:	8d 70 d0             	lea    -0x30(%eax),%esi
+  801eb6:	89 f3                	mov    %esi,%ebx
+  801eb8:	80 fb 09             	cmp    $0x9,%bl
+  801ebb:	76 df                	jbe    801e9c <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  801ebd:	8d 70 9f             	lea    -0x61(%eax),%esi
+  801ec0:	89 f3                	mov    %esi,%ebx
+  801ec2:	80 fb 19             	cmp    $0x19,%bl
+  801ec5:	77 08                	ja     801ecf <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  801ec7:	0f be c0             	movsbl %al,%eax
+  801eca:	83 e8 57             	sub    $0x57,%eax
+  801ecd:	eb d3                	jmp    801ea2 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  801ecf:	8d 70 bf             	lea    -0x41(%eax),%esi
+  801ed2:	89 f3                	mov    %esi,%ebx
+  801ed4:	80 fb 19             	cmp    $0x19,%bl
+  801ed7:	77 08                	ja     801ee1 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  801ed9:	0f be c0             	movsbl %al,%eax
+  801edc:	83 e8 37             	sub    $0x37,%eax
+  801edf:	eb c1                	jmp    801ea2 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801ee1:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  801ee5:	74 05                	je     801eec <strtol+0xcc>
+		*endptr = (char *) s;
+  801ee7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801eea:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  801eec:	89 c8                	mov    %ecx,%eax
+  801eee:	f7 d8                	neg    %eax
+  801ef0:	85 ff                	test   %edi,%edi
+  801ef2:	0f 45 c8             	cmovne %eax,%ecx
+}
+  801ef5:	89 c8                	mov    %ecx,%eax
+  801ef7:	5b                   	pop    %ebx
+  801ef8:	5e                   	pop    %esi
+  801ef9:	5f                   	pop    %edi
+  801efa:	5d                   	pop    %ebp
+  801efb:	c3                   	ret
+
+00801efc <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  801efc:	55                   	push   %ebp
+  801efd:	89 e5                	mov    %esp,%ebp
+  801eff:	56                   	push   %esi
+  801f00:	53                   	push   %ebx
+  801f01:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f04:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f07:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  801f0a:	85 c0                	test   %eax,%eax
+  801f0c:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801f11:	0f 44 c2             	cmove  %edx,%eax
+  801f14:	83 ec 0c             	sub    $0xc,%esp
+  801f17:	50                   	push   %eax
+  801f18:	e8 e7 e3 ff ff       	call   800304 <sys_ipc_recv>
+
+  if (from_env_store)
+  801f1d:	83 c4 10             	add    $0x10,%esp
+  801f20:	85 f6                	test   %esi,%esi
+  801f22:	74 17                	je     801f3b <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  801f24:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f29:	85 c0                	test   %eax,%eax
+  801f2b:	75 0c                	jne    801f39 <ipc_recv+0x3d>
+  801f2d:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801f33:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  801f39:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  801f3b:	85 db                	test   %ebx,%ebx
+  801f3d:	74 2b                	je     801f6a <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  801f3f:	85 c0                	test   %eax,%eax
+  801f41:	74 0d                	je     801f50 <ipc_recv+0x54>
+  801f43:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  801f49:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f4c:	5b                   	pop    %ebx
+  801f4d:	5e                   	pop    %esi
+  801f4e:	5d                   	pop    %ebp
+  801f4f:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  801f50:	a1 08 40 80 00       	mov    0x804008,%eax
+  801f55:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  801f5b:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  801f5d:	a1 08 40 80 00       	mov    0x804008,%eax
+  801f62:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  801f68:	eb df                	jmp    801f49 <ipc_recv+0x4d>
+  801f6a:	85 c0                	test   %eax,%eax
+  801f6c:	75 db                	jne    801f49 <ipc_recv+0x4d>
+  801f6e:	eb ed                	jmp    801f5d <ipc_recv+0x61>
+
+00801f70 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  801f70:	55                   	push   %ebp
+  801f71:	89 e5                	mov    %esp,%ebp
+  801f73:	57                   	push   %edi
+  801f74:	56                   	push   %esi
+  801f75:	53                   	push   %ebx
+  801f76:	83 ec 0c             	sub    $0xc,%esp
+  801f79:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801f7c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801f7f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  801f82:	85 db                	test   %ebx,%ebx
+  801f84:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801f89:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  801f8c:	ff 75 14             	push   0x14(%ebp)
+  801f8f:	53                   	push   %ebx
+  801f90:	56                   	push   %esi
+  801f91:	57                   	push   %edi
+  801f92:	e8 4a e3 ff ff       	call   8002e1 <sys_ipc_try_send>
+  801f97:	83 c4 10             	add    $0x10,%esp
+  801f9a:	85 c0                	test   %eax,%eax
+  801f9c:	74 1e                	je     801fbc <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  801f9e:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801fa1:	75 07                	jne    801faa <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  801fa3:	e8 8d e1 ff ff       	call   800135 <sys_yield>
+  801fa8:	eb e2                	jmp    801f8c <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  801faa:	50                   	push   %eax
+  801fab:	68 63 29 80 00       	push   $0x802963
+  801fb0:	6a 3c                	push   $0x3c
+  801fb2:	68 70 29 80 00       	push   $0x802970
+  801fb7:	e8 7c f5 ff ff       	call   801538 <_panic>
+  }
+
+#endif
+}
+  801fbc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fbf:	5b                   	pop    %ebx
+  801fc0:	5e                   	pop    %esi
+  801fc1:	5f                   	pop    %edi
+  801fc2:	5d                   	pop    %ebp
+  801fc3:	c3                   	ret
+
+00801fc4 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  801fc4:	55                   	push   %ebp
+  801fc5:	89 e5                	mov    %esp,%ebp
+  801fc7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  801fca:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  801fcf:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  801fd2:	c1 e0 04             	shl    $0x4,%eax
+  801fd5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801fda:	8b 40 50             	mov    0x50(%eax),%eax
+  801fdd:	39 c8                	cmp    %ecx,%eax
+  801fdf:	74 12                	je     801ff3 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  801fe1:	83 c2 01             	add    $0x1,%edx
+  801fe4:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  801fea:	75 e3                	jne    801fcf <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  801fec:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ff1:	eb 0e                	jmp    802001 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  801ff3:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  801ff6:	c1 e0 04             	shl    $0x4,%eax
+  801ff9:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801ffe:	8b 40 48             	mov    0x48(%eax),%eax
+  802001:	5d                   	pop    %ebp
+  802002:	c3                   	ret
+
+00802003 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802003:	55                   	push   %ebp
+  802004:	89 e5                	mov    %esp,%ebp
+  802006:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802009:	89 c2                	mov    %eax,%edx
+  80200b:	c1 ea 16             	shr    $0x16,%edx
+  80200e:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802015:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80201a:	f6 c1 01             	test   $0x1,%cl
+  80201d:	74 1c                	je     80203b <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  80201f:	c1 e8 0c             	shr    $0xc,%eax
+  802022:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802029:	a8 01                	test   $0x1,%al
+  80202b:	74 0e                	je     80203b <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80202d:	c1 e8 0c             	shr    $0xc,%eax
+  802030:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802037:	ef 
+  802038:	0f b7 d2             	movzwl %dx,%edx
+}
+  80203b:	89 d0                	mov    %edx,%eax
+  80203d:	5d                   	pop    %ebp
+  80203e:	c3                   	ret
+  80203f:	90                   	nop
+
+00802040 <__udivmoddi4>:
+  802040:	55                   	push   %ebp
+  802041:	57                   	push   %edi
+  802042:	56                   	push   %esi
+  802043:	53                   	push   %ebx
+  802044:	83 ec 24             	sub    $0x24,%esp
+  802047:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80204b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80204f:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  802053:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802057:	8b 54 24 44          	mov    0x44(%esp),%edx
+  80205b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80205f:	8b 44 24 40          	mov    0x40(%esp),%eax
+  802063:	89 d3                	mov    %edx,%ebx
+  802065:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802069:	09 c3                	or     %eax,%ebx
+  80206b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80206f:	0f 84 9c 00 00 00    	je     802111 <__udivmoddi4+0xd1>
+  802075:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80207c:	00 
+  80207d:	31 c0                	xor    %eax,%eax
+  80207f:	31 d2                	xor    %edx,%edx
+  802081:	89 fb                	mov    %edi,%ebx
+  802083:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80208a:	00 
+  80208b:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802090:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802094:	01 c0                	add    %eax,%eax
+  802096:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80209d:	00 
+  80209e:	89 c6                	mov    %eax,%esi
+  8020a0:	89 d7                	mov    %edx,%edi
+  8020a2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8020a6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8020aa:	0f ad d0             	shrd   %cl,%edx,%eax
+  8020ad:	d3 ea                	shr    %cl,%edx
+  8020af:	f6 c1 20             	test   $0x20,%cl
+  8020b2:	0f 45 c2             	cmovne %edx,%eax
+  8020b5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8020b9:	83 e0 01             	and    $0x1,%eax
+  8020bc:	09 fa                	or     %edi,%edx
+  8020be:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8020c2:	89 04 24             	mov    %eax,(%esp)
+  8020c5:	8b 04 24             	mov    (%esp),%eax
+  8020c8:	89 d5                	mov    %edx,%ebp
+  8020ca:	09 f0                	or     %esi,%eax
+  8020cc:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8020d0:	39 f0                	cmp    %esi,%eax
+  8020d2:	19 fd                	sbb    %edi,%ebp
+  8020d4:	72 1d                	jb     8020f3 <__udivmoddi4+0xb3>
+  8020d6:	29 f0                	sub    %esi,%eax
+  8020d8:	19 fa                	sbb    %edi,%edx
+  8020da:	89 cf                	mov    %ecx,%edi
+  8020dc:	c1 ef 05             	shr    $0x5,%edi
+  8020df:	83 e7 01             	and    $0x1,%edi
+  8020e2:	89 fe                	mov    %edi,%esi
+  8020e4:	d3 e7                	shl    %cl,%edi
+  8020e6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8020ea:	83 f6 01             	xor    $0x1,%esi
+  8020ed:	d3 e6                	shl    %cl,%esi
+  8020ef:	09 74 24 18          	or     %esi,0x18(%esp)
+  8020f3:	83 e9 01             	sub    $0x1,%ecx
+  8020f6:	73 98                	jae    802090 <__udivmoddi4+0x50>
+  8020f8:	85 db                	test   %ebx,%ebx
+  8020fa:	74 05                	je     802101 <__udivmoddi4+0xc1>
+  8020fc:	89 03                	mov    %eax,(%ebx)
+  8020fe:	89 53 04             	mov    %edx,0x4(%ebx)
+  802101:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802105:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802109:	83 c4 24             	add    $0x24,%esp
+  80210c:	5b                   	pop    %ebx
+  80210d:	5e                   	pop    %esi
+  80210e:	5f                   	pop    %edi
+  80210f:	5d                   	pop    %ebp
+  802110:	c3                   	ret
+  802111:	85 ff                	test   %edi,%edi
+  802113:	74 0d                	je     802122 <__udivmoddi4+0xe2>
+  802115:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  80211b:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  802122:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802126:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80212a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80212e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802132:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802136:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80213a:	83 c4 24             	add    $0x24,%esp
+  80213d:	5b                   	pop    %ebx
+  80213e:	5e                   	pop    %esi
+  80213f:	5f                   	pop    %edi
+  802140:	5d                   	pop    %ebp
+  802141:	c3                   	ret
+  802142:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802149:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00802150 <__udivdi3>:
+  802150:	57                   	push   %edi
+  802151:	56                   	push   %esi
+  802152:	53                   	push   %ebx
+  802153:	83 ec 20             	sub    $0x20,%esp
+  802156:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80215a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80215e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802162:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802166:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80216a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80216e:	89 d1                	mov    %edx,%ecx
+  802170:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802174:	09 c1                	or     %eax,%ecx
+  802176:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80217a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80217e:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802182:	0f 84 88 00 00 00    	je     802210 <__udivdi3+0xc0>
+  802188:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80218f:	00 
+  802190:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802195:	31 c0                	xor    %eax,%eax
+  802197:	31 d2                	xor    %edx,%edx
+  802199:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8021a0:	00 
+  8021a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8021a8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8021ac:	01 c0                	add    %eax,%eax
+  8021ae:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8021b5:	00 
+  8021b6:	89 c6                	mov    %eax,%esi
+  8021b8:	89 d7                	mov    %edx,%edi
+  8021ba:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8021be:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8021c2:	0f ad d0             	shrd   %cl,%edx,%eax
+  8021c5:	d3 ea                	shr    %cl,%edx
+  8021c7:	f6 c1 20             	test   $0x20,%cl
+  8021ca:	0f 45 c2             	cmovne %edx,%eax
+  8021cd:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8021d1:	83 e0 01             	and    $0x1,%eax
+  8021d4:	09 fa                	or     %edi,%edx
+  8021d6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8021da:	89 04 24             	mov    %eax,(%esp)
+  8021dd:	8b 04 24             	mov    (%esp),%eax
+  8021e0:	89 d3                	mov    %edx,%ebx
+  8021e2:	09 f0                	or     %esi,%eax
+  8021e4:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8021e8:	39 f0                	cmp    %esi,%eax
+  8021ea:	19 fb                	sbb    %edi,%ebx
+  8021ec:	72 1d                	jb     80220b <__udivdi3+0xbb>
+  8021ee:	29 f0                	sub    %esi,%eax
+  8021f0:	19 fa                	sbb    %edi,%edx
+  8021f2:	89 cf                	mov    %ecx,%edi
+  8021f4:	c1 ef 05             	shr    $0x5,%edi
+  8021f7:	83 e7 01             	and    $0x1,%edi
+  8021fa:	89 fe                	mov    %edi,%esi
+  8021fc:	d3 e7                	shl    %cl,%edi
+  8021fe:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802202:	83 f6 01             	xor    $0x1,%esi
+  802205:	d3 e6                	shl    %cl,%esi
+  802207:	09 74 24 18          	or     %esi,0x18(%esp)
+  80220b:	83 e9 01             	sub    $0x1,%ecx
+  80220e:	73 98                	jae    8021a8 <__udivdi3+0x58>
+  802210:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802214:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802218:	83 c4 20             	add    $0x20,%esp
+  80221b:	5b                   	pop    %ebx
+  80221c:	5e                   	pop    %esi
+  80221d:	5f                   	pop    %edi
+  80221e:	c3                   	ret
+  80221f:	90                   	nop
+
+00802220 <__umoddi3>:
+  802220:	57                   	push   %edi
+  802221:	56                   	push   %esi
+  802222:	53                   	push   %ebx
+  802223:	83 ec 18             	sub    $0x18,%esp
+  802226:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80222a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80222e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802232:	8b 54 24 34          	mov    0x34(%esp),%edx
+  802236:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80223a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80223e:	89 d1                	mov    %edx,%ecx
+  802240:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802244:	09 c1                	or     %eax,%ecx
+  802246:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80224a:	74 5b                	je     8022a7 <__umoddi3+0x87>
+  80224c:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802251:	31 c0                	xor    %eax,%eax
+  802253:	31 d2                	xor    %edx,%edx
+  802255:	8d 76 00             	lea    0x0(%esi),%esi
+  802258:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80225c:	01 c0                	add    %eax,%eax
+  80225e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802265:	00 
+  802266:	89 c6                	mov    %eax,%esi
+  802268:	89 d7                	mov    %edx,%edi
+  80226a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80226e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802272:	0f ad d0             	shrd   %cl,%edx,%eax
+  802275:	d3 ea                	shr    %cl,%edx
+  802277:	f6 c1 20             	test   $0x20,%cl
+  80227a:	0f 45 c2             	cmovne %edx,%eax
+  80227d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802281:	83 e0 01             	and    $0x1,%eax
+  802284:	09 fa                	or     %edi,%edx
+  802286:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80228a:	89 04 24             	mov    %eax,(%esp)
+  80228d:	8b 04 24             	mov    (%esp),%eax
+  802290:	89 d3                	mov    %edx,%ebx
+  802292:	09 f0                	or     %esi,%eax
+  802294:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802298:	39 f0                	cmp    %esi,%eax
+  80229a:	19 fb                	sbb    %edi,%ebx
+  80229c:	72 04                	jb     8022a2 <__umoddi3+0x82>
+  80229e:	29 f0                	sub    %esi,%eax
+  8022a0:	19 fa                	sbb    %edi,%edx
+  8022a2:	83 e9 01             	sub    $0x1,%ecx
+  8022a5:	73 b1                	jae    802258 <__umoddi3+0x38>
+  8022a7:	83 c4 18             	add    $0x18,%esp
+  8022aa:	5b                   	pop    %ebx
+  8022ab:	5e                   	pop    %esi
+  8022ac:	5f                   	pop    %edi
+  8022ad:	c3                   	ret
+  8022ae:	66 90                	xchg   %ax,%ax
+
+008022b0 <__divdi3>:
+  8022b0:	55                   	push   %ebp
+  8022b1:	57                   	push   %edi
+  8022b2:	56                   	push   %esi
+  8022b3:	53                   	push   %ebx
+  8022b4:	83 ec 24             	sub    $0x24,%esp
+  8022b7:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  8022bb:	8b 74 24 44          	mov    0x44(%esp),%esi
+  8022bf:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8022c3:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8022c7:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  8022cb:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8022cf:	85 d2                	test   %edx,%edx
+  8022d1:	0f 88 e0 00 00 00    	js     8023b7 <__divdi3+0x107>
+  8022d7:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  8022db:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  8022df:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8022e3:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8022e7:	85 f6                	test   %esi,%esi
+  8022e9:	78 16                	js     802301 <__divdi3+0x51>
+  8022eb:	89 f1                	mov    %esi,%ecx
+  8022ed:	31 c0                	xor    %eax,%eax
+  8022ef:	31 d2                	xor    %edx,%edx
+  8022f1:	09 d9                	or     %ebx,%ecx
+  8022f3:	0f 85 f3 00 00 00    	jne    8023ec <__divdi3+0x13c>
+  8022f9:	83 c4 24             	add    $0x24,%esp
+  8022fc:	5b                   	pop    %ebx
+  8022fd:	5e                   	pop    %esi
+  8022fe:	5f                   	pop    %edi
+  8022ff:	5d                   	pop    %ebp
+  802300:	c3                   	ret
+  802301:	bf 01 00 00 00       	mov    $0x1,%edi
+  802306:	f7 5c 24 08          	negl   0x8(%esp)
+  80230a:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  80230f:	f7 5c 24 0c          	negl   0xc(%esp)
+  802313:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80231a:	00 
+  80231b:	31 c0                	xor    %eax,%eax
+  80231d:	31 d2                	xor    %edx,%edx
+  80231f:	89 fb                	mov    %edi,%ebx
+  802321:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802328:	00 
+  802329:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80232e:	66 90                	xchg   %ax,%ax
+  802330:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802334:	01 c0                	add    %eax,%eax
+  802336:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80233d:	00 
+  80233e:	89 c6                	mov    %eax,%esi
+  802340:	89 d7                	mov    %edx,%edi
+  802342:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802346:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80234a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80234d:	d3 ea                	shr    %cl,%edx
+  80234f:	f6 c1 20             	test   $0x20,%cl
+  802352:	0f 45 c2             	cmovne %edx,%eax
+  802355:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802359:	83 e0 01             	and    $0x1,%eax
+  80235c:	09 fa                	or     %edi,%edx
+  80235e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802362:	89 04 24             	mov    %eax,(%esp)
+  802365:	8b 04 24             	mov    (%esp),%eax
+  802368:	89 d5                	mov    %edx,%ebp
+  80236a:	09 f0                	or     %esi,%eax
+  80236c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802370:	39 f0                	cmp    %esi,%eax
+  802372:	19 fd                	sbb    %edi,%ebp
+  802374:	72 1d                	jb     802393 <__divdi3+0xe3>
+  802376:	29 f0                	sub    %esi,%eax
+  802378:	19 fa                	sbb    %edi,%edx
+  80237a:	89 cf                	mov    %ecx,%edi
+  80237c:	c1 ef 05             	shr    $0x5,%edi
+  80237f:	83 e7 01             	and    $0x1,%edi
+  802382:	89 fe                	mov    %edi,%esi
+  802384:	d3 e7                	shl    %cl,%edi
+  802386:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80238a:	83 f6 01             	xor    $0x1,%esi
+  80238d:	d3 e6                	shl    %cl,%esi
+  80238f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802393:	83 e9 01             	sub    $0x1,%ecx
+  802396:	73 98                	jae    802330 <__divdi3+0x80>
+  802398:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80239c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8023a0:	85 db                	test   %ebx,%ebx
+  8023a2:	0f 84 51 ff ff ff    	je     8022f9 <__divdi3+0x49>
+  8023a8:	f7 d8                	neg    %eax
+  8023aa:	83 d2 00             	adc    $0x0,%edx
+  8023ad:	83 c4 24             	add    $0x24,%esp
+  8023b0:	5b                   	pop    %ebx
+  8023b1:	f7 da                	neg    %edx
+  8023b3:	5e                   	pop    %esi
+  8023b4:	5f                   	pop    %edi
+  8023b5:	5d                   	pop    %ebp
+  8023b6:	c3                   	ret
+  8023b7:	f7 d8                	neg    %eax
+  8023b9:	83 d2 00             	adc    $0x0,%edx
+  8023bc:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8023c0:	f7 da                	neg    %edx
+  8023c2:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8023c6:	85 f6                	test   %esi,%esi
+  8023c8:	78 1b                	js     8023e5 <__divdi3+0x135>
+  8023ca:	89 f1                	mov    %esi,%ecx
+  8023cc:	31 c0                	xor    %eax,%eax
+  8023ce:	31 d2                	xor    %edx,%edx
+  8023d0:	bf 01 00 00 00       	mov    $0x1,%edi
+  8023d5:	09 d9                	or     %ebx,%ecx
+  8023d7:	0f 85 36 ff ff ff    	jne    802313 <__divdi3+0x63>
+  8023dd:	83 c4 24             	add    $0x24,%esp
+  8023e0:	5b                   	pop    %ebx
+  8023e1:	5e                   	pop    %esi
+  8023e2:	5f                   	pop    %edi
+  8023e3:	5d                   	pop    %ebp
+  8023e4:	c3                   	ret
+  8023e5:	31 ff                	xor    %edi,%edi
+  8023e7:	e9 1a ff ff ff       	jmp    802306 <__divdi3+0x56>
+  8023ec:	31 ff                	xor    %edi,%edi
+  8023ee:	e9 20 ff ff ff       	jmp    802313 <__divdi3+0x63>
+  8023f3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8023fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00802400 <__moddi3>:
+  802400:	55                   	push   %ebp
+  802401:	57                   	push   %edi
+  802402:	56                   	push   %esi
+  802403:	53                   	push   %ebx
+  802404:	83 ec 1c             	sub    $0x1c,%esp
+  802407:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  80240b:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  80240f:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  802413:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  802417:	89 c8                	mov    %ecx,%eax
+  802419:	89 f2                	mov    %esi,%edx
+  80241b:	89 f3                	mov    %esi,%ebx
+  80241d:	85 ed                	test   %ebp,%ebp
+  80241f:	0f 88 9d 00 00 00    	js     8024c2 <__moddi3+0xc2>
+  802425:	09 cb                	or     %ecx,%ebx
+  802427:	0f 84 8d 00 00 00    	je     8024ba <__moddi3+0xba>
+  80242d:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802431:	31 db                	xor    %ebx,%ebx
+  802433:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802437:	89 ca                	mov    %ecx,%edx
+  802439:	89 f0                	mov    %esi,%eax
+  80243b:	89 dd                	mov    %ebx,%ebp
+  80243d:	f7 da                	neg    %edx
+  80243f:	83 d0 00             	adc    $0x0,%eax
+  802442:	f7 d8                	neg    %eax
+  802444:	0f 49 f0             	cmovns %eax,%esi
+  802447:	0f 49 ca             	cmovns %edx,%ecx
+  80244a:	31 c0                	xor    %eax,%eax
+  80244c:	31 d2                	xor    %edx,%edx
+  80244e:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802452:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802456:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80245b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80245f:	90                   	nop
+  802460:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802464:	01 c0                	add    %eax,%eax
+  802466:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80246d:	00 
+  80246e:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  802472:	89 c6                	mov    %eax,%esi
+  802474:	89 d7                	mov    %edx,%edi
+  802476:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80247a:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80247e:	0f ad d0             	shrd   %cl,%edx,%eax
+  802481:	d3 ea                	shr    %cl,%edx
+  802483:	f6 c1 20             	test   $0x20,%cl
+  802486:	0f 45 c2             	cmovne %edx,%eax
+  802489:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80248d:	83 e0 01             	and    $0x1,%eax
+  802490:	09 fa                	or     %edi,%edx
+  802492:	89 04 24             	mov    %eax,(%esp)
+  802495:	8b 04 24             	mov    (%esp),%eax
+  802498:	89 d7                	mov    %edx,%edi
+  80249a:	09 f0                	or     %esi,%eax
+  80249c:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  8024a0:	39 d8                	cmp    %ebx,%eax
+  8024a2:	19 f7                	sbb    %esi,%edi
+  8024a4:	72 04                	jb     8024aa <__moddi3+0xaa>
+  8024a6:	29 d8                	sub    %ebx,%eax
+  8024a8:	19 f2                	sbb    %esi,%edx
+  8024aa:	83 e9 01             	sub    $0x1,%ecx
+  8024ad:	73 b1                	jae    802460 <__moddi3+0x60>
+  8024af:	85 ed                	test   %ebp,%ebp
+  8024b1:	74 07                	je     8024ba <__moddi3+0xba>
+  8024b3:	f7 d8                	neg    %eax
+  8024b5:	83 d2 00             	adc    $0x0,%edx
+  8024b8:	f7 da                	neg    %edx
+  8024ba:	83 c4 1c             	add    $0x1c,%esp
+  8024bd:	5b                   	pop    %ebx
+  8024be:	5e                   	pop    %esi
+  8024bf:	5f                   	pop    %edi
+  8024c0:	5d                   	pop    %ebp
+  8024c1:	c3                   	ret
+  8024c2:	09 cb                	or     %ecx,%ebx
+  8024c4:	74 f4                	je     8024ba <__moddi3+0xba>
+  8024c6:	f7 df                	neg    %edi
+  8024c8:	bb 01 00 00 00       	mov    $0x1,%ebx
+  8024cd:	83 d5 00             	adc    $0x0,%ebp
+  8024d0:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  8024d4:	f7 dd                	neg    %ebp
+  8024d6:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  8024da:	e9 58 ff ff ff       	jmp    802437 <__moddi3+0x37>
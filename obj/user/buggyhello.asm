@@ -0,0 +1,5262 @@
+
+obj/user/buggyhello.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 16 00 00 00       	call   800047 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	sys_cputs((char*)1, 1);
+  800039:	6a 01                	push   $0x1
+  80003b:	6a 01                	push   $0x1
+  80003d:	e8 68 00 00 00       	call   8000aa <sys_cputs>
+}
+  800042:	83 c4 10             	add    $0x10,%esp
+  800045:	c9                   	leave
+  800046:	c3                   	ret
+
+00800047 <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  800047:	55                   	push   %ebp
+  800048:	89 e5                	mov    %esp,%ebp
+  80004a:	56                   	push   %esi
+  80004b:	53                   	push   %ebx
+  80004c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80004f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  800052:	e8 d1 00 00 00       	call   800128 <sys_getenvid>
+  800057:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80005c:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80005f:	c1 e0 04             	shl    $0x4,%eax
+  800062:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800067:	a3 08 40 80 00       	mov    %eax,0x804008
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  80006c:	85 db                	test   %ebx,%ebx
+  80006e:	7e 07                	jle    800077 <libmain+0x30>
+    binaryname = argv[0];
+  800070:	8b 06                	mov    (%esi),%eax
+  800072:	a3 00 30 80 00       	mov    %eax,0x803000
+
+  // call user main routine
+  umain(argc, argv);
+  800077:	83 ec 08             	sub    $0x8,%esp
+  80007a:	56                   	push   %esi
+  80007b:	53                   	push   %ebx
+  80007c:	e8 b2 ff ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  800081:	e8 0a 00 00 00       	call   800090 <exit>
+}
+  800086:	83 c4 10             	add    $0x10,%esp
+  800089:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80008c:	5b                   	pop    %ebx
+  80008d:	5e                   	pop    %esi
+  80008e:	5d                   	pop    %ebp
+  80008f:	c3                   	ret
+
+00800090 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800090:	55                   	push   %ebp
+  800091:	89 e5                	mov    %esp,%ebp
+  800093:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800096:	e8 72 05 00 00       	call   80060d <close_all>
+	sys_env_destroy(0);
+  80009b:	83 ec 0c             	sub    $0xc,%esp
+  80009e:	6a 00                	push   $0x0
+  8000a0:	e8 42 00 00 00       	call   8000e7 <sys_env_destroy>
+}
+  8000a5:	83 c4 10             	add    $0x10,%esp
+  8000a8:	c9                   	leave
+  8000a9:	c3                   	ret
+
+008000aa <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8000aa:	55                   	push   %ebp
+  8000ab:	89 e5                	mov    %esp,%ebp
+  8000ad:	57                   	push   %edi
+  8000ae:	56                   	push   %esi
+  8000af:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8000b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000b5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000b8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000bb:	89 c3                	mov    %eax,%ebx
+  8000bd:	89 c7                	mov    %eax,%edi
+  8000bf:	89 c6                	mov    %eax,%esi
+  8000c1:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  8000c3:	5b                   	pop    %ebx
+  8000c4:	5e                   	pop    %esi
+  8000c5:	5f                   	pop    %edi
+  8000c6:	5d                   	pop    %ebp
+  8000c7:	c3                   	ret
+
+008000c8 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8000c8:	55                   	push   %ebp
+  8000c9:	89 e5                	mov    %esp,%ebp
+  8000cb:	57                   	push   %edi
+  8000cc:	56                   	push   %esi
+  8000cd:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8000ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000d3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000d8:	89 d1                	mov    %edx,%ecx
+  8000da:	89 d3                	mov    %edx,%ebx
+  8000dc:	89 d7                	mov    %edx,%edi
+  8000de:	89 d6                	mov    %edx,%esi
+  8000e0:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8000e2:	5b                   	pop    %ebx
+  8000e3:	5e                   	pop    %esi
+  8000e4:	5f                   	pop    %edi
+  8000e5:	5d                   	pop    %ebp
+  8000e6:	c3                   	ret
+
+008000e7 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8000e7:	55                   	push   %ebp
+  8000e8:	89 e5                	mov    %esp,%ebp
+  8000ea:	57                   	push   %edi
+  8000eb:	56                   	push   %esi
+  8000ec:	53                   	push   %ebx
+  8000ed:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8000f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000f5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000f8:	b8 03 00 00 00       	mov    $0x3,%eax
+  8000fd:	89 cb                	mov    %ecx,%ebx
+  8000ff:	89 cf                	mov    %ecx,%edi
+  800101:	89 ce                	mov    %ecx,%esi
+  800103:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800105:	85 c0                	test   %eax,%eax
+  800107:	7f 08                	jg     800111 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800109:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80010c:	5b                   	pop    %ebx
+  80010d:	5e                   	pop    %esi
+  80010e:	5f                   	pop    %edi
+  80010f:	5d                   	pop    %ebp
+  800110:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800111:	83 ec 0c             	sub    $0xc,%esp
+  800114:	50                   	push   %eax
+  800115:	6a 03                	push   $0x3
+  800117:	68 0a 25 80 00       	push   $0x80250a
+  80011c:	6a 3e                	push   $0x3e
+  80011e:	68 27 25 80 00       	push   $0x802527
+  800123:	e8 22 14 00 00       	call   80154a <_panic>
+
+00800128 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800128:	55                   	push   %ebp
+  800129:	89 e5                	mov    %esp,%ebp
+  80012b:	57                   	push   %edi
+  80012c:	56                   	push   %esi
+  80012d:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80012e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800133:	b8 02 00 00 00       	mov    $0x2,%eax
+  800138:	89 d1                	mov    %edx,%ecx
+  80013a:	89 d3                	mov    %edx,%ebx
+  80013c:	89 d7                	mov    %edx,%edi
+  80013e:	89 d6                	mov    %edx,%esi
+  800140:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800142:	5b                   	pop    %ebx
+  800143:	5e                   	pop    %esi
+  800144:	5f                   	pop    %edi
+  800145:	5d                   	pop    %ebp
+  800146:	c3                   	ret
+
+00800147 <sys_yield>:
+
+void
+sys_yield(void) {
+  800147:	55                   	push   %ebp
+  800148:	89 e5                	mov    %esp,%ebp
+  80014a:	57                   	push   %edi
+  80014b:	56                   	push   %esi
+  80014c:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80014d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800152:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800157:	89 d1                	mov    %edx,%ecx
+  800159:	89 d3                	mov    %edx,%ebx
+  80015b:	89 d7                	mov    %edx,%edi
+  80015d:	89 d6                	mov    %edx,%esi
+  80015f:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800161:	5b                   	pop    %ebx
+  800162:	5e                   	pop    %esi
+  800163:	5f                   	pop    %edi
+  800164:	5d                   	pop    %ebp
+  800165:	c3                   	ret
+
+00800166 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  800166:	55                   	push   %ebp
+  800167:	89 e5                	mov    %esp,%ebp
+  800169:	57                   	push   %edi
+  80016a:	56                   	push   %esi
+  80016b:	53                   	push   %ebx
+  80016c:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  80016f:	be 00 00 00 00       	mov    $0x0,%esi
+  800174:	8b 55 08             	mov    0x8(%ebp),%edx
+  800177:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80017a:	b8 04 00 00 00       	mov    $0x4,%eax
+  80017f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800182:	89 f7                	mov    %esi,%edi
+  800184:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800186:	85 c0                	test   %eax,%eax
+  800188:	7f 08                	jg     800192 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  80018a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80018d:	5b                   	pop    %ebx
+  80018e:	5e                   	pop    %esi
+  80018f:	5f                   	pop    %edi
+  800190:	5d                   	pop    %ebp
+  800191:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800192:	83 ec 0c             	sub    $0xc,%esp
+  800195:	50                   	push   %eax
+  800196:	6a 04                	push   $0x4
+  800198:	68 0a 25 80 00       	push   $0x80250a
+  80019d:	6a 3e                	push   $0x3e
+  80019f:	68 27 25 80 00       	push   $0x802527
+  8001a4:	e8 a1 13 00 00       	call   80154a <_panic>
+
+008001a9 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  8001a9:	55                   	push   %ebp
+  8001aa:	89 e5                	mov    %esp,%ebp
+  8001ac:	57                   	push   %edi
+  8001ad:	56                   	push   %esi
+  8001ae:	53                   	push   %ebx
+  8001af:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8001b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001b5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001b8:	b8 05 00 00 00       	mov    $0x5,%eax
+  8001bd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001c0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8001c3:	8b 75 18             	mov    0x18(%ebp),%esi
+  8001c6:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8001c8:	85 c0                	test   %eax,%eax
+  8001ca:	7f 08                	jg     8001d4 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  8001cc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001cf:	5b                   	pop    %ebx
+  8001d0:	5e                   	pop    %esi
+  8001d1:	5f                   	pop    %edi
+  8001d2:	5d                   	pop    %ebp
+  8001d3:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8001d4:	83 ec 0c             	sub    $0xc,%esp
+  8001d7:	50                   	push   %eax
+  8001d8:	6a 05                	push   $0x5
+  8001da:	68 0a 25 80 00       	push   $0x80250a
+  8001df:	6a 3e                	push   $0x3e
+  8001e1:	68 27 25 80 00       	push   $0x802527
+  8001e6:	e8 5f 13 00 00       	call   80154a <_panic>
+
+008001eb <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  8001eb:	55                   	push   %ebp
+  8001ec:	89 e5                	mov    %esp,%ebp
+  8001ee:	57                   	push   %edi
+  8001ef:	56                   	push   %esi
+  8001f0:	53                   	push   %ebx
+  8001f1:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8001f4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001f9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001fc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001ff:	b8 06 00 00 00       	mov    $0x6,%eax
+  800204:	89 df                	mov    %ebx,%edi
+  800206:	89 de                	mov    %ebx,%esi
+  800208:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80020a:	85 c0                	test   %eax,%eax
+  80020c:	7f 08                	jg     800216 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  80020e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800211:	5b                   	pop    %ebx
+  800212:	5e                   	pop    %esi
+  800213:	5f                   	pop    %edi
+  800214:	5d                   	pop    %ebp
+  800215:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800216:	83 ec 0c             	sub    $0xc,%esp
+  800219:	50                   	push   %eax
+  80021a:	6a 06                	push   $0x6
+  80021c:	68 0a 25 80 00       	push   $0x80250a
+  800221:	6a 3e                	push   $0x3e
+  800223:	68 27 25 80 00       	push   $0x802527
+  800228:	e8 1d 13 00 00       	call   80154a <_panic>
+
+0080022d <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80022d:	55                   	push   %ebp
+  80022e:	89 e5                	mov    %esp,%ebp
+  800230:	57                   	push   %edi
+  800231:	56                   	push   %esi
+  800232:	53                   	push   %ebx
+  800233:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800236:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80023b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80023e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800241:	b8 08 00 00 00       	mov    $0x8,%eax
+  800246:	89 df                	mov    %ebx,%edi
+  800248:	89 de                	mov    %ebx,%esi
+  80024a:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80024c:	85 c0                	test   %eax,%eax
+  80024e:	7f 08                	jg     800258 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800250:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800253:	5b                   	pop    %ebx
+  800254:	5e                   	pop    %esi
+  800255:	5f                   	pop    %edi
+  800256:	5d                   	pop    %ebp
+  800257:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800258:	83 ec 0c             	sub    $0xc,%esp
+  80025b:	50                   	push   %eax
+  80025c:	6a 08                	push   $0x8
+  80025e:	68 0a 25 80 00       	push   $0x80250a
+  800263:	6a 3e                	push   $0x3e
+  800265:	68 27 25 80 00       	push   $0x802527
+  80026a:	e8 db 12 00 00       	call   80154a <_panic>
+
+0080026f <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80026f:	55                   	push   %ebp
+  800270:	89 e5                	mov    %esp,%ebp
+  800272:	57                   	push   %edi
+  800273:	56                   	push   %esi
+  800274:	53                   	push   %ebx
+  800275:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800278:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80027d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800280:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800283:	b8 09 00 00 00       	mov    $0x9,%eax
+  800288:	89 df                	mov    %ebx,%edi
+  80028a:	89 de                	mov    %ebx,%esi
+  80028c:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80028e:	85 c0                	test   %eax,%eax
+  800290:	7f 08                	jg     80029a <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800292:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800295:	5b                   	pop    %ebx
+  800296:	5e                   	pop    %esi
+  800297:	5f                   	pop    %edi
+  800298:	5d                   	pop    %ebp
+  800299:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80029a:	83 ec 0c             	sub    $0xc,%esp
+  80029d:	50                   	push   %eax
+  80029e:	6a 09                	push   $0x9
+  8002a0:	68 0a 25 80 00       	push   $0x80250a
+  8002a5:	6a 3e                	push   $0x3e
+  8002a7:	68 27 25 80 00       	push   $0x802527
+  8002ac:	e8 99 12 00 00       	call   80154a <_panic>
+
+008002b1 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8002b1:	55                   	push   %ebp
+  8002b2:	89 e5                	mov    %esp,%ebp
+  8002b4:	57                   	push   %edi
+  8002b5:	56                   	push   %esi
+  8002b6:	53                   	push   %ebx
+  8002b7:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8002ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002c2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002c5:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8002ca:	89 df                	mov    %ebx,%edi
+  8002cc:	89 de                	mov    %ebx,%esi
+  8002ce:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8002d0:	85 c0                	test   %eax,%eax
+  8002d2:	7f 08                	jg     8002dc <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8002d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002d7:	5b                   	pop    %ebx
+  8002d8:	5e                   	pop    %esi
+  8002d9:	5f                   	pop    %edi
+  8002da:	5d                   	pop    %ebp
+  8002db:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8002dc:	83 ec 0c             	sub    $0xc,%esp
+  8002df:	50                   	push   %eax
+  8002e0:	6a 0a                	push   $0xa
+  8002e2:	68 0a 25 80 00       	push   $0x80250a
+  8002e7:	6a 3e                	push   $0x3e
+  8002e9:	68 27 25 80 00       	push   $0x802527
+  8002ee:	e8 57 12 00 00       	call   80154a <_panic>
+
+008002f3 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  8002f3:	55                   	push   %ebp
+  8002f4:	89 e5                	mov    %esp,%ebp
+  8002f6:	57                   	push   %edi
+  8002f7:	56                   	push   %esi
+  8002f8:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8002f9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002fc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002ff:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800304:	be 00 00 00 00       	mov    $0x0,%esi
+  800309:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80030c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80030f:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800311:	5b                   	pop    %ebx
+  800312:	5e                   	pop    %esi
+  800313:	5f                   	pop    %edi
+  800314:	5d                   	pop    %ebp
+  800315:	c3                   	ret
+
+00800316 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  800316:	55                   	push   %ebp
+  800317:	89 e5                	mov    %esp,%ebp
+  800319:	57                   	push   %edi
+  80031a:	56                   	push   %esi
+  80031b:	53                   	push   %ebx
+  80031c:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  80031f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800324:	8b 55 08             	mov    0x8(%ebp),%edx
+  800327:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80032c:	89 cb                	mov    %ecx,%ebx
+  80032e:	89 cf                	mov    %ecx,%edi
+  800330:	89 ce                	mov    %ecx,%esi
+  800332:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800334:	85 c0                	test   %eax,%eax
+  800336:	7f 08                	jg     800340 <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  800338:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80033b:	5b                   	pop    %ebx
+  80033c:	5e                   	pop    %esi
+  80033d:	5f                   	pop    %edi
+  80033e:	5d                   	pop    %ebp
+  80033f:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800340:	83 ec 0c             	sub    $0xc,%esp
+  800343:	50                   	push   %eax
+  800344:	6a 0d                	push   $0xd
+  800346:	68 0a 25 80 00       	push   $0x80250a
+  80034b:	6a 3e                	push   $0x3e
+  80034d:	68 27 25 80 00       	push   $0x802527
+  800352:	e8 f3 11 00 00       	call   80154a <_panic>
+
+00800357 <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  800357:	55                   	push   %ebp
+  800358:	89 e5                	mov    %esp,%ebp
+  80035a:	57                   	push   %edi
+  80035b:	56                   	push   %esi
+  80035c:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80035d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800362:	8b 55 08             	mov    0x8(%ebp),%edx
+  800365:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800368:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80036d:	89 df                	mov    %ebx,%edi
+  80036f:	89 de                	mov    %ebx,%esi
+  800371:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  800373:	5b                   	pop    %ebx
+  800374:	5e                   	pop    %esi
+  800375:	5f                   	pop    %edi
+  800376:	5d                   	pop    %ebp
+  800377:	c3                   	ret
+
+00800378 <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  800378:	55                   	push   %ebp
+  800379:	89 e5                	mov    %esp,%ebp
+  80037b:	57                   	push   %edi
+  80037c:	56                   	push   %esi
+  80037d:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80037e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800383:	8b 55 08             	mov    0x8(%ebp),%edx
+  800386:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80038b:	89 cb                	mov    %ecx,%ebx
+  80038d:	89 cf                	mov    %ecx,%edi
+  80038f:	89 ce                	mov    %ecx,%esi
+  800391:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  800393:	5b                   	pop    %ebx
+  800394:	5e                   	pop    %esi
+  800395:	5f                   	pop    %edi
+  800396:	5d                   	pop    %ebp
+  800397:	c3                   	ret
+
+00800398 <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  800398:	55                   	push   %ebp
+  800399:	89 e5                	mov    %esp,%ebp
+  80039b:	57                   	push   %edi
+  80039c:	56                   	push   %esi
+  80039d:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80039e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003a3:	b8 10 00 00 00       	mov    $0x10,%eax
+  8003a8:	89 d1                	mov    %edx,%ecx
+  8003aa:	89 d3                	mov    %edx,%ebx
+  8003ac:	89 d7                	mov    %edx,%edi
+  8003ae:	89 d6                	mov    %edx,%esi
+  8003b0:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8003b2:	5b                   	pop    %ebx
+  8003b3:	5e                   	pop    %esi
+  8003b4:	5f                   	pop    %edi
+  8003b5:	5d                   	pop    %ebp
+  8003b6:	c3                   	ret
+
+008003b7 <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  8003b7:	55                   	push   %ebp
+  8003b8:	89 e5                	mov    %esp,%ebp
+  8003ba:	57                   	push   %edi
+  8003bb:	56                   	push   %esi
+  8003bc:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8003bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003c5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003c8:	b8 11 00 00 00       	mov    $0x11,%eax
+  8003cd:	89 df                	mov    %ebx,%edi
+  8003cf:	89 de                	mov    %ebx,%esi
+  8003d1:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  8003d3:	5b                   	pop    %ebx
+  8003d4:	5e                   	pop    %esi
+  8003d5:	5f                   	pop    %edi
+  8003d6:	5d                   	pop    %ebp
+  8003d7:	c3                   	ret
+
+008003d8 <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  8003d8:	55                   	push   %ebp
+  8003d9:	89 e5                	mov    %esp,%ebp
+  8003db:	57                   	push   %edi
+  8003dc:	56                   	push   %esi
+  8003dd:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8003de:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003e9:	b8 12 00 00 00       	mov    $0x12,%eax
+  8003ee:	89 df                	mov    %ebx,%edi
+  8003f0:	89 de                	mov    %ebx,%esi
+  8003f2:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  8003f4:	5b                   	pop    %ebx
+  8003f5:	5e                   	pop    %esi
+  8003f6:	5f                   	pop    %edi
+  8003f7:	5d                   	pop    %ebp
+  8003f8:	c3                   	ret
+
+008003f9 <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  8003f9:	55                   	push   %ebp
+  8003fa:	89 e5                	mov    %esp,%ebp
+  8003fc:	57                   	push   %edi
+  8003fd:	56                   	push   %esi
+  8003fe:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8003ff:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800404:	8b 55 08             	mov    0x8(%ebp),%edx
+  800407:	b8 13 00 00 00       	mov    $0x13,%eax
+  80040c:	89 cb                	mov    %ecx,%ebx
+  80040e:	89 cf                	mov    %ecx,%edi
+  800410:	89 ce                	mov    %ecx,%esi
+  800412:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  800414:	5b                   	pop    %ebx
+  800415:	5e                   	pop    %esi
+  800416:	5f                   	pop    %edi
+  800417:	5d                   	pop    %ebp
+  800418:	c3                   	ret
+
+00800419 <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  800419:	55                   	push   %ebp
+  80041a:	89 e5                	mov    %esp,%ebp
+  80041c:	57                   	push   %edi
+  80041d:	56                   	push   %esi
+  80041e:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80041f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800424:	8b 55 08             	mov    0x8(%ebp),%edx
+  800427:	b8 14 00 00 00       	mov    $0x14,%eax
+  80042c:	89 cb                	mov    %ecx,%ebx
+  80042e:	89 cf                	mov    %ecx,%edi
+  800430:	89 ce                	mov    %ecx,%esi
+  800432:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  800434:	5b                   	pop    %ebx
+  800435:	5e                   	pop    %esi
+  800436:	5f                   	pop    %edi
+  800437:	5d                   	pop    %ebp
+  800438:	c3                   	ret
+
+00800439 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800439:	55                   	push   %ebp
+  80043a:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80043c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80043f:	05 00 00 00 30       	add    $0x30000000,%eax
+  800444:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800447:	5d                   	pop    %ebp
+  800448:	c3                   	ret
+
+00800449 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800449:	55                   	push   %ebp
+  80044a:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80044c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80044f:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800454:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800459:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80045e:	5d                   	pop    %ebp
+  80045f:	c3                   	ret
+
+00800460 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800460:	55                   	push   %ebp
+  800461:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  800463:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800468:	eb 02                	jmp    80046c <fd_alloc+0xc>
+  80046a:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80046c:	89 c2                	mov    %eax,%edx
+  80046e:	c1 ea 16             	shr    $0x16,%edx
+  800471:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800478:	f6 c2 01             	test   $0x1,%dl
+  80047b:	74 2b                	je     8004a8 <fd_alloc+0x48>
+  80047d:	89 c2                	mov    %eax,%edx
+  80047f:	c1 ea 0c             	shr    $0xc,%edx
+  800482:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  800489:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80048f:	f6 c1 01             	test   $0x1,%cl
+  800492:	74 14                	je     8004a8 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  800494:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80049a:	75 ce                	jne    80046a <fd_alloc+0xa>
+  80049c:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8004a1:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8004a6:	eb 05                	jmp    8004ad <fd_alloc+0x4d>
+			return 0;
+  8004a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8004ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004b0:	89 02                	mov    %eax,(%edx)
+}
+  8004b2:	89 c8                	mov    %ecx,%eax
+  8004b4:	5d                   	pop    %ebp
+  8004b5:	c3                   	ret
+
+008004b6 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8004b6:	55                   	push   %ebp
+  8004b7:	89 e5                	mov    %esp,%ebp
+  8004b9:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8004bc:	83 f8 1f             	cmp    $0x1f,%eax
+  8004bf:	77 30                	ja     8004f1 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8004c1:	c1 e0 0c             	shl    $0xc,%eax
+  8004c4:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8004c9:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8004cf:	f6 c2 01             	test   $0x1,%dl
+  8004d2:	74 24                	je     8004f8 <fd_lookup+0x42>
+  8004d4:	89 c2                	mov    %eax,%edx
+  8004d6:	c1 ea 0c             	shr    $0xc,%edx
+  8004d9:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8004e0:	f6 c2 01             	test   $0x1,%dl
+  8004e3:	74 1a                	je     8004ff <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8004e5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8004e8:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8004ea:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8004ef:	5d                   	pop    %ebp
+  8004f0:	c3                   	ret
+		return -E_INVAL;
+  8004f1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8004f6:	eb f7                	jmp    8004ef <fd_lookup+0x39>
+		return -E_INVAL;
+  8004f8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8004fd:	eb f0                	jmp    8004ef <fd_lookup+0x39>
+  8004ff:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800504:	eb e9                	jmp    8004ef <fd_lookup+0x39>
+
+00800506 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  800506:	55                   	push   %ebp
+  800507:	89 e5                	mov    %esp,%ebp
+  800509:	53                   	push   %ebx
+  80050a:	83 ec 04             	sub    $0x4,%esp
+  80050d:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  800510:	b8 00 00 00 00       	mov    $0x0,%eax
+  800515:	eb 03                	jmp    80051a <dev_lookup+0x14>
+  800517:	83 c0 01             	add    $0x1,%eax
+  80051a:	8b 1c 85 b4 25 80 00 	mov    0x8025b4(,%eax,4),%ebx
+  800521:	85 db                	test   %ebx,%ebx
+  800523:	74 0b                	je     800530 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  800525:	39 13                	cmp    %edx,(%ebx)
+  800527:	75 ee                	jne    800517 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  800529:	b8 00 00 00 00       	mov    $0x0,%eax
+  80052e:	eb 1f                	jmp    80054f <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800530:	a1 08 40 80 00       	mov    0x804008,%eax
+  800535:	8b 40 48             	mov    0x48(%eax),%eax
+  800538:	83 ec 04             	sub    $0x4,%esp
+  80053b:	52                   	push   %edx
+  80053c:	50                   	push   %eax
+  80053d:	68 38 25 80 00       	push   $0x802538
+  800542:	e8 de 10 00 00       	call   801625 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  800547:	83 c4 10             	add    $0x10,%esp
+  80054a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80054f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800552:	89 1a                	mov    %ebx,(%edx)
+}
+  800554:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800557:	c9                   	leave
+  800558:	c3                   	ret
+
+00800559 <fd_close>:
+{
+  800559:	55                   	push   %ebp
+  80055a:	89 e5                	mov    %esp,%ebp
+  80055c:	57                   	push   %edi
+  80055d:	56                   	push   %esi
+  80055e:	53                   	push   %ebx
+  80055f:	83 ec 24             	sub    $0x24,%esp
+  800562:	8b 75 08             	mov    0x8(%ebp),%esi
+  800565:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800568:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80056b:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80056c:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800572:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800575:	50                   	push   %eax
+  800576:	e8 3b ff ff ff       	call   8004b6 <fd_lookup>
+  80057b:	89 c3                	mov    %eax,%ebx
+  80057d:	83 c4 10             	add    $0x10,%esp
+  800580:	85 c0                	test   %eax,%eax
+  800582:	78 05                	js     800589 <fd_close+0x30>
+	    || fd != fd2)
+  800584:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  800587:	74 16                	je     80059f <fd_close+0x46>
+		return (must_exist ? r : 0);
+  800589:	89 f8                	mov    %edi,%eax
+  80058b:	84 c0                	test   %al,%al
+  80058d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800592:	0f 44 d8             	cmove  %eax,%ebx
+}
+  800595:	89 d8                	mov    %ebx,%eax
+  800597:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80059a:	5b                   	pop    %ebx
+  80059b:	5e                   	pop    %esi
+  80059c:	5f                   	pop    %edi
+  80059d:	5d                   	pop    %ebp
+  80059e:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80059f:	83 ec 08             	sub    $0x8,%esp
+  8005a2:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8005a5:	50                   	push   %eax
+  8005a6:	ff 36                	push   (%esi)
+  8005a8:	e8 59 ff ff ff       	call   800506 <dev_lookup>
+  8005ad:	89 c3                	mov    %eax,%ebx
+  8005af:	83 c4 10             	add    $0x10,%esp
+  8005b2:	85 c0                	test   %eax,%eax
+  8005b4:	78 1a                	js     8005d0 <fd_close+0x77>
+		if (dev->dev_close)
+  8005b6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005b9:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8005bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8005c1:	85 c0                	test   %eax,%eax
+  8005c3:	74 0b                	je     8005d0 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8005c5:	83 ec 0c             	sub    $0xc,%esp
+  8005c8:	56                   	push   %esi
+  8005c9:	ff d0                	call   *%eax
+  8005cb:	89 c3                	mov    %eax,%ebx
+  8005cd:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8005d0:	83 ec 08             	sub    $0x8,%esp
+  8005d3:	56                   	push   %esi
+  8005d4:	6a 00                	push   $0x0
+  8005d6:	e8 10 fc ff ff       	call   8001eb <sys_page_unmap>
+	return r;
+  8005db:	83 c4 10             	add    $0x10,%esp
+  8005de:	eb b5                	jmp    800595 <fd_close+0x3c>
+
+008005e0 <close>:
+
+int
+close(int fdnum)
+{
+  8005e0:	55                   	push   %ebp
+  8005e1:	89 e5                	mov    %esp,%ebp
+  8005e3:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8005e6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8005e9:	50                   	push   %eax
+  8005ea:	ff 75 08             	push   0x8(%ebp)
+  8005ed:	e8 c4 fe ff ff       	call   8004b6 <fd_lookup>
+  8005f2:	83 c4 10             	add    $0x10,%esp
+  8005f5:	85 c0                	test   %eax,%eax
+  8005f7:	79 02                	jns    8005fb <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8005f9:	c9                   	leave
+  8005fa:	c3                   	ret
+		return fd_close(fd, 1);
+  8005fb:	83 ec 08             	sub    $0x8,%esp
+  8005fe:	6a 01                	push   $0x1
+  800600:	ff 75 f4             	push   -0xc(%ebp)
+  800603:	e8 51 ff ff ff       	call   800559 <fd_close>
+  800608:	83 c4 10             	add    $0x10,%esp
+  80060b:	eb ec                	jmp    8005f9 <close+0x19>
+
+0080060d <close_all>:
+
+void
+close_all(void)
+{
+  80060d:	55                   	push   %ebp
+  80060e:	89 e5                	mov    %esp,%ebp
+  800610:	53                   	push   %ebx
+  800611:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  800614:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  800619:	83 ec 0c             	sub    $0xc,%esp
+  80061c:	53                   	push   %ebx
+  80061d:	e8 be ff ff ff       	call   8005e0 <close>
+	for (i = 0; i < MAXFD; i++)
+  800622:	83 c3 01             	add    $0x1,%ebx
+  800625:	83 c4 10             	add    $0x10,%esp
+  800628:	83 fb 20             	cmp    $0x20,%ebx
+  80062b:	75 ec                	jne    800619 <close_all+0xc>
+}
+  80062d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800630:	c9                   	leave
+  800631:	c3                   	ret
+
+00800632 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  800632:	55                   	push   %ebp
+  800633:	89 e5                	mov    %esp,%ebp
+  800635:	57                   	push   %edi
+  800636:	56                   	push   %esi
+  800637:	53                   	push   %ebx
+  800638:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80063b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80063e:	50                   	push   %eax
+  80063f:	ff 75 08             	push   0x8(%ebp)
+  800642:	e8 6f fe ff ff       	call   8004b6 <fd_lookup>
+  800647:	89 c3                	mov    %eax,%ebx
+  800649:	83 c4 10             	add    $0x10,%esp
+  80064c:	85 c0                	test   %eax,%eax
+  80064e:	78 7f                	js     8006cf <dup+0x9d>
+		return r;
+	close(newfdnum);
+  800650:	83 ec 0c             	sub    $0xc,%esp
+  800653:	ff 75 0c             	push   0xc(%ebp)
+  800656:	e8 85 ff ff ff       	call   8005e0 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80065b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80065e:	c1 e6 0c             	shl    $0xc,%esi
+  800661:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  800667:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80066a:	89 3c 24             	mov    %edi,(%esp)
+  80066d:	e8 d7 fd ff ff       	call   800449 <fd2data>
+  800672:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  800674:	89 34 24             	mov    %esi,(%esp)
+  800677:	e8 cd fd ff ff       	call   800449 <fd2data>
+  80067c:	83 c4 10             	add    $0x10,%esp
+  80067f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  800682:	89 d8                	mov    %ebx,%eax
+  800684:	c1 e8 16             	shr    $0x16,%eax
+  800687:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80068e:	a8 01                	test   $0x1,%al
+  800690:	74 11                	je     8006a3 <dup+0x71>
+  800692:	89 d8                	mov    %ebx,%eax
+  800694:	c1 e8 0c             	shr    $0xc,%eax
+  800697:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80069e:	f6 c2 01             	test   $0x1,%dl
+  8006a1:	75 36                	jne    8006d9 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8006a3:	89 f8                	mov    %edi,%eax
+  8006a5:	c1 e8 0c             	shr    $0xc,%eax
+  8006a8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8006af:	83 ec 0c             	sub    $0xc,%esp
+  8006b2:	25 07 0e 00 00       	and    $0xe07,%eax
+  8006b7:	50                   	push   %eax
+  8006b8:	56                   	push   %esi
+  8006b9:	6a 00                	push   $0x0
+  8006bb:	57                   	push   %edi
+  8006bc:	6a 00                	push   $0x0
+  8006be:	e8 e6 fa ff ff       	call   8001a9 <sys_page_map>
+  8006c3:	89 c3                	mov    %eax,%ebx
+  8006c5:	83 c4 20             	add    $0x20,%esp
+  8006c8:	85 c0                	test   %eax,%eax
+  8006ca:	78 33                	js     8006ff <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8006cc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8006cf:	89 d8                	mov    %ebx,%eax
+  8006d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006d4:	5b                   	pop    %ebx
+  8006d5:	5e                   	pop    %esi
+  8006d6:	5f                   	pop    %edi
+  8006d7:	5d                   	pop    %ebp
+  8006d8:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8006d9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8006e0:	83 ec 0c             	sub    $0xc,%esp
+  8006e3:	25 07 0e 00 00       	and    $0xe07,%eax
+  8006e8:	50                   	push   %eax
+  8006e9:	ff 75 d4             	push   -0x2c(%ebp)
+  8006ec:	6a 00                	push   $0x0
+  8006ee:	53                   	push   %ebx
+  8006ef:	6a 00                	push   $0x0
+  8006f1:	e8 b3 fa ff ff       	call   8001a9 <sys_page_map>
+  8006f6:	89 c3                	mov    %eax,%ebx
+  8006f8:	83 c4 20             	add    $0x20,%esp
+  8006fb:	85 c0                	test   %eax,%eax
+  8006fd:	79 a4                	jns    8006a3 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8006ff:	83 ec 08             	sub    $0x8,%esp
+  800702:	56                   	push   %esi
+  800703:	6a 00                	push   $0x0
+  800705:	e8 e1 fa ff ff       	call   8001eb <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  80070a:	83 c4 08             	add    $0x8,%esp
+  80070d:	ff 75 d4             	push   -0x2c(%ebp)
+  800710:	6a 00                	push   $0x0
+  800712:	e8 d4 fa ff ff       	call   8001eb <sys_page_unmap>
+	return r;
+  800717:	83 c4 10             	add    $0x10,%esp
+  80071a:	eb b3                	jmp    8006cf <dup+0x9d>
+
+0080071c <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80071c:	55                   	push   %ebp
+  80071d:	89 e5                	mov    %esp,%ebp
+  80071f:	56                   	push   %esi
+  800720:	53                   	push   %ebx
+  800721:	83 ec 18             	sub    $0x18,%esp
+  800724:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800727:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80072a:	50                   	push   %eax
+  80072b:	56                   	push   %esi
+  80072c:	e8 85 fd ff ff       	call   8004b6 <fd_lookup>
+  800731:	83 c4 10             	add    $0x10,%esp
+  800734:	85 c0                	test   %eax,%eax
+  800736:	78 3c                	js     800774 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800738:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80073b:	83 ec 08             	sub    $0x8,%esp
+  80073e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800741:	50                   	push   %eax
+  800742:	ff 33                	push   (%ebx)
+  800744:	e8 bd fd ff ff       	call   800506 <dev_lookup>
+  800749:	83 c4 10             	add    $0x10,%esp
+  80074c:	85 c0                	test   %eax,%eax
+  80074e:	78 24                	js     800774 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800750:	8b 43 08             	mov    0x8(%ebx),%eax
+  800753:	83 e0 03             	and    $0x3,%eax
+  800756:	83 f8 01             	cmp    $0x1,%eax
+  800759:	74 20                	je     80077b <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80075b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80075e:	8b 40 08             	mov    0x8(%eax),%eax
+  800761:	85 c0                	test   %eax,%eax
+  800763:	74 37                	je     80079c <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  800765:	83 ec 04             	sub    $0x4,%esp
+  800768:	ff 75 10             	push   0x10(%ebp)
+  80076b:	ff 75 0c             	push   0xc(%ebp)
+  80076e:	53                   	push   %ebx
+  80076f:	ff d0                	call   *%eax
+  800771:	83 c4 10             	add    $0x10,%esp
+}
+  800774:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800777:	5b                   	pop    %ebx
+  800778:	5e                   	pop    %esi
+  800779:	5d                   	pop    %ebp
+  80077a:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80077b:	a1 08 40 80 00       	mov    0x804008,%eax
+  800780:	8b 40 48             	mov    0x48(%eax),%eax
+  800783:	83 ec 04             	sub    $0x4,%esp
+  800786:	56                   	push   %esi
+  800787:	50                   	push   %eax
+  800788:	68 79 25 80 00       	push   $0x802579
+  80078d:	e8 93 0e 00 00       	call   801625 <cprintf>
+		return -E_INVAL;
+  800792:	83 c4 10             	add    $0x10,%esp
+  800795:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80079a:	eb d8                	jmp    800774 <read+0x58>
+		return -E_NOT_SUPP;
+  80079c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8007a1:	eb d1                	jmp    800774 <read+0x58>
+
+008007a3 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8007a3:	55                   	push   %ebp
+  8007a4:	89 e5                	mov    %esp,%ebp
+  8007a6:	57                   	push   %edi
+  8007a7:	56                   	push   %esi
+  8007a8:	53                   	push   %ebx
+  8007a9:	83 ec 0c             	sub    $0xc,%esp
+  8007ac:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8007af:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8007b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8007b7:	eb 02                	jmp    8007bb <readn+0x18>
+  8007b9:	01 c3                	add    %eax,%ebx
+  8007bb:	39 f3                	cmp    %esi,%ebx
+  8007bd:	73 21                	jae    8007e0 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8007bf:	83 ec 04             	sub    $0x4,%esp
+  8007c2:	89 f0                	mov    %esi,%eax
+  8007c4:	29 d8                	sub    %ebx,%eax
+  8007c6:	50                   	push   %eax
+  8007c7:	89 d8                	mov    %ebx,%eax
+  8007c9:	03 45 0c             	add    0xc(%ebp),%eax
+  8007cc:	50                   	push   %eax
+  8007cd:	57                   	push   %edi
+  8007ce:	e8 49 ff ff ff       	call   80071c <read>
+		if (m < 0)
+  8007d3:	83 c4 10             	add    $0x10,%esp
+  8007d6:	85 c0                	test   %eax,%eax
+  8007d8:	78 04                	js     8007de <readn+0x3b>
+			return m;
+		if (m == 0)
+  8007da:	75 dd                	jne    8007b9 <readn+0x16>
+  8007dc:	eb 02                	jmp    8007e0 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8007de:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8007e0:	89 d8                	mov    %ebx,%eax
+  8007e2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007e5:	5b                   	pop    %ebx
+  8007e6:	5e                   	pop    %esi
+  8007e7:	5f                   	pop    %edi
+  8007e8:	5d                   	pop    %ebp
+  8007e9:	c3                   	ret
+
+008007ea <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8007ea:	55                   	push   %ebp
+  8007eb:	89 e5                	mov    %esp,%ebp
+  8007ed:	56                   	push   %esi
+  8007ee:	53                   	push   %ebx
+  8007ef:	83 ec 18             	sub    $0x18,%esp
+  8007f2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8007f5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8007f8:	50                   	push   %eax
+  8007f9:	53                   	push   %ebx
+  8007fa:	e8 b7 fc ff ff       	call   8004b6 <fd_lookup>
+  8007ff:	83 c4 10             	add    $0x10,%esp
+  800802:	85 c0                	test   %eax,%eax
+  800804:	78 37                	js     80083d <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800806:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800809:	83 ec 08             	sub    $0x8,%esp
+  80080c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80080f:	50                   	push   %eax
+  800810:	ff 36                	push   (%esi)
+  800812:	e8 ef fc ff ff       	call   800506 <dev_lookup>
+  800817:	83 c4 10             	add    $0x10,%esp
+  80081a:	85 c0                	test   %eax,%eax
+  80081c:	78 1f                	js     80083d <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80081e:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800822:	74 20                	je     800844 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  800824:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800827:	8b 40 0c             	mov    0xc(%eax),%eax
+  80082a:	85 c0                	test   %eax,%eax
+  80082c:	74 37                	je     800865 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80082e:	83 ec 04             	sub    $0x4,%esp
+  800831:	ff 75 10             	push   0x10(%ebp)
+  800834:	ff 75 0c             	push   0xc(%ebp)
+  800837:	56                   	push   %esi
+  800838:	ff d0                	call   *%eax
+  80083a:	83 c4 10             	add    $0x10,%esp
+}
+  80083d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800840:	5b                   	pop    %ebx
+  800841:	5e                   	pop    %esi
+  800842:	5d                   	pop    %ebp
+  800843:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800844:	a1 08 40 80 00       	mov    0x804008,%eax
+  800849:	8b 40 48             	mov    0x48(%eax),%eax
+  80084c:	83 ec 04             	sub    $0x4,%esp
+  80084f:	53                   	push   %ebx
+  800850:	50                   	push   %eax
+  800851:	68 95 25 80 00       	push   $0x802595
+  800856:	e8 ca 0d 00 00       	call   801625 <cprintf>
+		return -E_INVAL;
+  80085b:	83 c4 10             	add    $0x10,%esp
+  80085e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800863:	eb d8                	jmp    80083d <write+0x53>
+		return -E_NOT_SUPP;
+  800865:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80086a:	eb d1                	jmp    80083d <write+0x53>
+
+0080086c <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80086c:	55                   	push   %ebp
+  80086d:	89 e5                	mov    %esp,%ebp
+  80086f:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800872:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800875:	50                   	push   %eax
+  800876:	ff 75 08             	push   0x8(%ebp)
+  800879:	e8 38 fc ff ff       	call   8004b6 <fd_lookup>
+  80087e:	83 c4 10             	add    $0x10,%esp
+  800881:	85 c0                	test   %eax,%eax
+  800883:	78 0e                	js     800893 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  800885:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800888:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80088b:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80088e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800893:	c9                   	leave
+  800894:	c3                   	ret
+
+00800895 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800895:	55                   	push   %ebp
+  800896:	89 e5                	mov    %esp,%ebp
+  800898:	56                   	push   %esi
+  800899:	53                   	push   %ebx
+  80089a:	83 ec 18             	sub    $0x18,%esp
+  80089d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8008a0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8008a3:	50                   	push   %eax
+  8008a4:	53                   	push   %ebx
+  8008a5:	e8 0c fc ff ff       	call   8004b6 <fd_lookup>
+  8008aa:	83 c4 10             	add    $0x10,%esp
+  8008ad:	85 c0                	test   %eax,%eax
+  8008af:	78 34                	js     8008e5 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8008b1:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8008b4:	83 ec 08             	sub    $0x8,%esp
+  8008b7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8008ba:	50                   	push   %eax
+  8008bb:	ff 36                	push   (%esi)
+  8008bd:	e8 44 fc ff ff       	call   800506 <dev_lookup>
+  8008c2:	83 c4 10             	add    $0x10,%esp
+  8008c5:	85 c0                	test   %eax,%eax
+  8008c7:	78 1c                	js     8008e5 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8008c9:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8008cd:	74 1d                	je     8008ec <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8008cf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008d2:	8b 40 18             	mov    0x18(%eax),%eax
+  8008d5:	85 c0                	test   %eax,%eax
+  8008d7:	74 34                	je     80090d <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8008d9:	83 ec 08             	sub    $0x8,%esp
+  8008dc:	ff 75 0c             	push   0xc(%ebp)
+  8008df:	56                   	push   %esi
+  8008e0:	ff d0                	call   *%eax
+  8008e2:	83 c4 10             	add    $0x10,%esp
+}
+  8008e5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8008e8:	5b                   	pop    %ebx
+  8008e9:	5e                   	pop    %esi
+  8008ea:	5d                   	pop    %ebp
+  8008eb:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8008ec:	a1 08 40 80 00       	mov    0x804008,%eax
+  8008f1:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8008f4:	83 ec 04             	sub    $0x4,%esp
+  8008f7:	53                   	push   %ebx
+  8008f8:	50                   	push   %eax
+  8008f9:	68 58 25 80 00       	push   $0x802558
+  8008fe:	e8 22 0d 00 00       	call   801625 <cprintf>
+		return -E_INVAL;
+  800903:	83 c4 10             	add    $0x10,%esp
+  800906:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80090b:	eb d8                	jmp    8008e5 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  80090d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800912:	eb d1                	jmp    8008e5 <ftruncate+0x50>
+
+00800914 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800914:	55                   	push   %ebp
+  800915:	89 e5                	mov    %esp,%ebp
+  800917:	56                   	push   %esi
+  800918:	53                   	push   %ebx
+  800919:	83 ec 18             	sub    $0x18,%esp
+  80091c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80091f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800922:	50                   	push   %eax
+  800923:	ff 75 08             	push   0x8(%ebp)
+  800926:	e8 8b fb ff ff       	call   8004b6 <fd_lookup>
+  80092b:	83 c4 10             	add    $0x10,%esp
+  80092e:	85 c0                	test   %eax,%eax
+  800930:	78 49                	js     80097b <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800932:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800935:	83 ec 08             	sub    $0x8,%esp
+  800938:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80093b:	50                   	push   %eax
+  80093c:	ff 36                	push   (%esi)
+  80093e:	e8 c3 fb ff ff       	call   800506 <dev_lookup>
+  800943:	83 c4 10             	add    $0x10,%esp
+  800946:	85 c0                	test   %eax,%eax
+  800948:	78 31                	js     80097b <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  80094a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80094d:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800951:	74 2f                	je     800982 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  800953:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  800956:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80095d:	00 00 00 
+	stat->st_isdir = 0;
+  800960:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800967:	00 00 00 
+	stat->st_dev = dev;
+  80096a:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  800970:	83 ec 08             	sub    $0x8,%esp
+  800973:	53                   	push   %ebx
+  800974:	56                   	push   %esi
+  800975:	ff 50 14             	call   *0x14(%eax)
+  800978:	83 c4 10             	add    $0x10,%esp
+}
+  80097b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80097e:	5b                   	pop    %ebx
+  80097f:	5e                   	pop    %esi
+  800980:	5d                   	pop    %ebp
+  800981:	c3                   	ret
+		return -E_NOT_SUPP;
+  800982:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800987:	eb f2                	jmp    80097b <fstat+0x67>
+
+00800989 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  800989:	55                   	push   %ebp
+  80098a:	89 e5                	mov    %esp,%ebp
+  80098c:	56                   	push   %esi
+  80098d:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80098e:	83 ec 08             	sub    $0x8,%esp
+  800991:	6a 00                	push   $0x0
+  800993:	ff 75 08             	push   0x8(%ebp)
+  800996:	e8 e4 01 00 00       	call   800b7f <open>
+  80099b:	89 c3                	mov    %eax,%ebx
+  80099d:	83 c4 10             	add    $0x10,%esp
+  8009a0:	85 c0                	test   %eax,%eax
+  8009a2:	78 1b                	js     8009bf <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8009a4:	83 ec 08             	sub    $0x8,%esp
+  8009a7:	ff 75 0c             	push   0xc(%ebp)
+  8009aa:	50                   	push   %eax
+  8009ab:	e8 64 ff ff ff       	call   800914 <fstat>
+  8009b0:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8009b2:	89 1c 24             	mov    %ebx,(%esp)
+  8009b5:	e8 26 fc ff ff       	call   8005e0 <close>
+	return r;
+  8009ba:	83 c4 10             	add    $0x10,%esp
+  8009bd:	89 f3                	mov    %esi,%ebx
+}
+  8009bf:	89 d8                	mov    %ebx,%eax
+  8009c1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8009c4:	5b                   	pop    %ebx
+  8009c5:	5e                   	pop    %esi
+  8009c6:	5d                   	pop    %ebp
+  8009c7:	c3                   	ret
+
+008009c8 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  8009c8:	55                   	push   %ebp
+  8009c9:	89 e5                	mov    %esp,%ebp
+  8009cb:	56                   	push   %esi
+  8009cc:	53                   	push   %ebx
+  8009cd:	89 c6                	mov    %eax,%esi
+  8009cf:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  8009d1:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  8009d8:	74 27                	je     800a01 <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8009da:	6a 07                	push   $0x7
+  8009dc:	68 00 50 80 00       	push   $0x805000
+  8009e1:	56                   	push   %esi
+  8009e2:	ff 35 00 40 80 00    	push   0x804000
+  8009e8:	e8 95 15 00 00       	call   801f82 <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  8009ed:	83 c4 0c             	add    $0xc,%esp
+  8009f0:	6a 00                	push   $0x0
+  8009f2:	53                   	push   %ebx
+  8009f3:	6a 00                	push   $0x0
+  8009f5:	e8 14 15 00 00       	call   801f0e <ipc_recv>
+}
+  8009fa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8009fd:	5b                   	pop    %ebx
+  8009fe:	5e                   	pop    %esi
+  8009ff:	5d                   	pop    %ebp
+  800a00:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  800a01:	83 ec 0c             	sub    $0xc,%esp
+  800a04:	6a 01                	push   $0x1
+  800a06:	e8 cb 15 00 00       	call   801fd6 <ipc_find_env>
+  800a0b:	a3 00 40 80 00       	mov    %eax,0x804000
+  800a10:	83 c4 10             	add    $0x10,%esp
+  800a13:	eb c5                	jmp    8009da <fsipc+0x12>
+
+00800a15 <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  800a15:	55                   	push   %ebp
+  800a16:	89 e5                	mov    %esp,%ebp
+  800a18:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800a1b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a1e:	8b 40 0c             	mov    0xc(%eax),%eax
+  800a21:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.set_size.req_size = newsize;
+  800a26:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a29:	a3 04 50 80 00       	mov    %eax,0x805004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  800a2e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a33:	b8 02 00 00 00       	mov    $0x2,%eax
+  800a38:	e8 8b ff ff ff       	call   8009c8 <fsipc>
+}
+  800a3d:	c9                   	leave
+  800a3e:	c3                   	ret
+
+00800a3f <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  800a3f:	55                   	push   %ebp
+  800a40:	89 e5                	mov    %esp,%ebp
+  800a42:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800a45:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a48:	8b 40 0c             	mov    0xc(%eax),%eax
+  800a4b:	a3 00 50 80 00       	mov    %eax,0x805000
+  return fsipc(FSREQ_FLUSH, NULL);
+  800a50:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a55:	b8 06 00 00 00       	mov    $0x6,%eax
+  800a5a:	e8 69 ff ff ff       	call   8009c8 <fsipc>
+}
+  800a5f:	c9                   	leave
+  800a60:	c3                   	ret
+
+00800a61 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  800a61:	55                   	push   %ebp
+  800a62:	89 e5                	mov    %esp,%ebp
+  800a64:	53                   	push   %ebx
+  800a65:	83 ec 04             	sub    $0x4,%esp
+  800a68:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800a6b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a6e:	8b 40 0c             	mov    0xc(%eax),%eax
+  800a71:	a3 00 50 80 00       	mov    %eax,0x805000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  800a76:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a7b:	b8 05 00 00 00       	mov    $0x5,%eax
+  800a80:	e8 43 ff ff ff       	call   8009c8 <fsipc>
+  800a85:	85 c0                	test   %eax,%eax
+  800a87:	78 2c                	js     800ab5 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800a89:	83 ec 08             	sub    $0x8,%esp
+  800a8c:	68 00 50 80 00       	push   $0x805000
+  800a91:	53                   	push   %ebx
+  800a92:	e8 47 11 00 00       	call   801bde <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  800a97:	a1 80 50 80 00       	mov    0x805080,%eax
+  800a9c:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800aa2:	a1 84 50 80 00       	mov    0x805084,%eax
+  800aa7:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  800aad:	83 c4 10             	add    $0x10,%esp
+  800ab0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ab5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ab8:	c9                   	leave
+  800ab9:	c3                   	ret
+
+00800aba <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  800aba:	55                   	push   %ebp
+  800abb:	89 e5                	mov    %esp,%ebp
+  800abd:	83 ec 0c             	sub    $0xc,%esp
+  800ac0:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800ac3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ac6:	8b 52 0c             	mov    0xc(%edx),%edx
+  800ac9:	89 15 00 50 80 00    	mov    %edx,0x805000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  800acf:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  800ad4:	39 d0                	cmp    %edx,%eax
+  800ad6:	0f 47 c2             	cmova  %edx,%eax
+  800ad9:	a3 04 50 80 00       	mov    %eax,0x805004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  800ade:	50                   	push   %eax
+  800adf:	ff 75 0c             	push   0xc(%ebp)
+  800ae2:	68 08 50 80 00       	push   $0x805008
+  800ae7:	e8 78 12 00 00       	call   801d64 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  800aec:	ba 00 00 00 00       	mov    $0x0,%edx
+  800af1:	b8 04 00 00 00       	mov    $0x4,%eax
+  800af6:	e8 cd fe ff ff       	call   8009c8 <fsipc>
+}
+  800afb:	c9                   	leave
+  800afc:	c3                   	ret
+
+00800afd <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  800afd:	55                   	push   %ebp
+  800afe:	89 e5                	mov    %esp,%ebp
+  800b00:	56                   	push   %esi
+  800b01:	53                   	push   %ebx
+  800b02:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800b05:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b08:	8b 40 0c             	mov    0xc(%eax),%eax
+  800b0b:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.read.req_n = n;
+  800b10:	89 35 04 50 80 00    	mov    %esi,0x805004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  800b16:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b1b:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b20:	e8 a3 fe ff ff       	call   8009c8 <fsipc>
+  800b25:	89 c3                	mov    %eax,%ebx
+  800b27:	85 c0                	test   %eax,%eax
+  800b29:	78 1f                	js     800b4a <devfile_read+0x4d>
+  assert(r <= n);
+  800b2b:	39 c6                	cmp    %eax,%esi
+  800b2d:	72 24                	jb     800b53 <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  800b2f:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800b34:	7f 33                	jg     800b69 <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  800b36:	83 ec 04             	sub    $0x4,%esp
+  800b39:	50                   	push   %eax
+  800b3a:	68 00 50 80 00       	push   $0x805000
+  800b3f:	ff 75 0c             	push   0xc(%ebp)
+  800b42:	e8 1d 12 00 00       	call   801d64 <memmove>
+  return r;
+  800b47:	83 c4 10             	add    $0x10,%esp
+}
+  800b4a:	89 d8                	mov    %ebx,%eax
+  800b4c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b4f:	5b                   	pop    %ebx
+  800b50:	5e                   	pop    %esi
+  800b51:	5d                   	pop    %ebp
+  800b52:	c3                   	ret
+  assert(r <= n);
+  800b53:	68 c8 25 80 00       	push   $0x8025c8
+  800b58:	68 cf 25 80 00       	push   $0x8025cf
+  800b5d:	6a 78                	push   $0x78
+  800b5f:	68 e4 25 80 00       	push   $0x8025e4
+  800b64:	e8 e1 09 00 00       	call   80154a <_panic>
+  assert(r <= PGSIZE);
+  800b69:	68 ef 25 80 00       	push   $0x8025ef
+  800b6e:	68 cf 25 80 00       	push   $0x8025cf
+  800b73:	6a 79                	push   $0x79
+  800b75:	68 e4 25 80 00       	push   $0x8025e4
+  800b7a:	e8 cb 09 00 00       	call   80154a <_panic>
+
+00800b7f <open>:
+open(const char *path, int mode) {
+  800b7f:	55                   	push   %ebp
+  800b80:	89 e5                	mov    %esp,%ebp
+  800b82:	56                   	push   %esi
+  800b83:	53                   	push   %ebx
+  800b84:	83 ec 1c             	sub    $0x1c,%esp
+  800b87:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  800b8a:	56                   	push   %esi
+  800b8b:	e8 13 10 00 00       	call   801ba3 <strlen>
+  800b90:	83 c4 10             	add    $0x10,%esp
+  800b93:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800b98:	7f 6c                	jg     800c06 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  800b9a:	83 ec 0c             	sub    $0xc,%esp
+  800b9d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800ba0:	50                   	push   %eax
+  800ba1:	e8 ba f8 ff ff       	call   800460 <fd_alloc>
+  800ba6:	89 c3                	mov    %eax,%ebx
+  800ba8:	83 c4 10             	add    $0x10,%esp
+  800bab:	85 c0                	test   %eax,%eax
+  800bad:	78 3c                	js     800beb <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  800baf:	83 ec 08             	sub    $0x8,%esp
+  800bb2:	56                   	push   %esi
+  800bb3:	68 00 50 80 00       	push   $0x805000
+  800bb8:	e8 21 10 00 00       	call   801bde <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  800bbd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bc0:	a3 00 54 80 00       	mov    %eax,0x805400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  800bc5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  800bc8:	b8 01 00 00 00       	mov    $0x1,%eax
+  800bcd:	e8 f6 fd ff ff       	call   8009c8 <fsipc>
+  800bd2:	89 c3                	mov    %eax,%ebx
+  800bd4:	83 c4 10             	add    $0x10,%esp
+  800bd7:	85 c0                	test   %eax,%eax
+  800bd9:	78 19                	js     800bf4 <open+0x75>
+  return fd2num(fd);
+  800bdb:	83 ec 0c             	sub    $0xc,%esp
+  800bde:	ff 75 f4             	push   -0xc(%ebp)
+  800be1:	e8 53 f8 ff ff       	call   800439 <fd2num>
+  800be6:	89 c3                	mov    %eax,%ebx
+  800be8:	83 c4 10             	add    $0x10,%esp
+}
+  800beb:	89 d8                	mov    %ebx,%eax
+  800bed:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800bf0:	5b                   	pop    %ebx
+  800bf1:	5e                   	pop    %esi
+  800bf2:	5d                   	pop    %ebp
+  800bf3:	c3                   	ret
+    fd_close(fd, 0);
+  800bf4:	83 ec 08             	sub    $0x8,%esp
+  800bf7:	6a 00                	push   $0x0
+  800bf9:	ff 75 f4             	push   -0xc(%ebp)
+  800bfc:	e8 58 f9 ff ff       	call   800559 <fd_close>
+    return r;
+  800c01:	83 c4 10             	add    $0x10,%esp
+  800c04:	eb e5                	jmp    800beb <open+0x6c>
+    return -E_BAD_PATH;
+  800c06:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  800c0b:	eb de                	jmp    800beb <open+0x6c>
+
+00800c0d <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  800c0d:	55                   	push   %ebp
+  800c0e:	89 e5                	mov    %esp,%ebp
+  800c10:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  800c13:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c18:	b8 08 00 00 00       	mov    $0x8,%eax
+  800c1d:	e8 a6 fd ff ff       	call   8009c8 <fsipc>
+}
+  800c22:	c9                   	leave
+  800c23:	c3                   	ret
+
+00800c24 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  800c24:	55                   	push   %ebp
+  800c25:	89 e5                	mov    %esp,%ebp
+  800c27:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  800c2a:	68 fb 25 80 00       	push   $0x8025fb
+  800c2f:	ff 75 0c             	push   0xc(%ebp)
+  800c32:	e8 a7 0f 00 00       	call   801bde <strcpy>
+	return 0;
+}
+  800c37:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c3c:	c9                   	leave
+  800c3d:	c3                   	ret
+
+00800c3e <devsock_close>:
+{
+  800c3e:	55                   	push   %ebp
+  800c3f:	89 e5                	mov    %esp,%ebp
+  800c41:	53                   	push   %ebx
+  800c42:	83 ec 10             	sub    $0x10,%esp
+  800c45:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  800c48:	53                   	push   %ebx
+  800c49:	e8 c7 13 00 00       	call   802015 <pageref>
+  800c4e:	89 c2                	mov    %eax,%edx
+  800c50:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  800c53:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  800c58:	83 fa 01             	cmp    $0x1,%edx
+  800c5b:	74 05                	je     800c62 <devsock_close+0x24>
+}
+  800c5d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c60:	c9                   	leave
+  800c61:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  800c62:	83 ec 0c             	sub    $0xc,%esp
+  800c65:	ff 73 0c             	push   0xc(%ebx)
+  800c68:	e8 b7 02 00 00       	call   800f24 <nsipc_close>
+  800c6d:	83 c4 10             	add    $0x10,%esp
+  800c70:	eb eb                	jmp    800c5d <devsock_close+0x1f>
+
+00800c72 <devsock_write>:
+{
+  800c72:	55                   	push   %ebp
+  800c73:	89 e5                	mov    %esp,%ebp
+  800c75:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  800c78:	6a 00                	push   $0x0
+  800c7a:	ff 75 10             	push   0x10(%ebp)
+  800c7d:	ff 75 0c             	push   0xc(%ebp)
+  800c80:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c83:	ff 70 0c             	push   0xc(%eax)
+  800c86:	e8 79 03 00 00       	call   801004 <nsipc_send>
+}
+  800c8b:	c9                   	leave
+  800c8c:	c3                   	ret
+
+00800c8d <devsock_read>:
+{
+  800c8d:	55                   	push   %ebp
+  800c8e:	89 e5                	mov    %esp,%ebp
+  800c90:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  800c93:	6a 00                	push   $0x0
+  800c95:	ff 75 10             	push   0x10(%ebp)
+  800c98:	ff 75 0c             	push   0xc(%ebp)
+  800c9b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c9e:	ff 70 0c             	push   0xc(%eax)
+  800ca1:	e8 ef 02 00 00       	call   800f95 <nsipc_recv>
+}
+  800ca6:	c9                   	leave
+  800ca7:	c3                   	ret
+
+00800ca8 <fd2sockid>:
+{
+  800ca8:	55                   	push   %ebp
+  800ca9:	89 e5                	mov    %esp,%ebp
+  800cab:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  800cae:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  800cb1:	52                   	push   %edx
+  800cb2:	50                   	push   %eax
+  800cb3:	e8 fe f7 ff ff       	call   8004b6 <fd_lookup>
+  800cb8:	83 c4 10             	add    $0x10,%esp
+  800cbb:	85 c0                	test   %eax,%eax
+  800cbd:	78 10                	js     800ccf <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  800cbf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800cc2:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  800cc8:	39 08                	cmp    %ecx,(%eax)
+  800cca:	75 05                	jne    800cd1 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  800ccc:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  800ccf:	c9                   	leave
+  800cd0:	c3                   	ret
+		return -E_NOT_SUPP;
+  800cd1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800cd6:	eb f7                	jmp    800ccf <fd2sockid+0x27>
+
+00800cd8 <alloc_sockfd>:
+{
+  800cd8:	55                   	push   %ebp
+  800cd9:	89 e5                	mov    %esp,%ebp
+  800cdb:	56                   	push   %esi
+  800cdc:	53                   	push   %ebx
+  800cdd:	83 ec 1c             	sub    $0x1c,%esp
+  800ce0:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  800ce2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800ce5:	50                   	push   %eax
+  800ce6:	e8 75 f7 ff ff       	call   800460 <fd_alloc>
+  800ceb:	89 c3                	mov    %eax,%ebx
+  800ced:	83 c4 10             	add    $0x10,%esp
+  800cf0:	85 c0                	test   %eax,%eax
+  800cf2:	78 43                	js     800d37 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  800cf4:	83 ec 04             	sub    $0x4,%esp
+  800cf7:	68 07 04 00 00       	push   $0x407
+  800cfc:	ff 75 f4             	push   -0xc(%ebp)
+  800cff:	6a 00                	push   $0x0
+  800d01:	e8 60 f4 ff ff       	call   800166 <sys_page_alloc>
+  800d06:	89 c3                	mov    %eax,%ebx
+  800d08:	83 c4 10             	add    $0x10,%esp
+  800d0b:	85 c0                	test   %eax,%eax
+  800d0d:	78 28                	js     800d37 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  800d0f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800d12:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  800d18:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  800d1a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800d1d:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  800d24:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  800d27:	83 ec 0c             	sub    $0xc,%esp
+  800d2a:	50                   	push   %eax
+  800d2b:	e8 09 f7 ff ff       	call   800439 <fd2num>
+  800d30:	89 c3                	mov    %eax,%ebx
+  800d32:	83 c4 10             	add    $0x10,%esp
+  800d35:	eb 0c                	jmp    800d43 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  800d37:	83 ec 0c             	sub    $0xc,%esp
+  800d3a:	56                   	push   %esi
+  800d3b:	e8 e4 01 00 00       	call   800f24 <nsipc_close>
+		return r;
+  800d40:	83 c4 10             	add    $0x10,%esp
+}
+  800d43:	89 d8                	mov    %ebx,%eax
+  800d45:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d48:	5b                   	pop    %ebx
+  800d49:	5e                   	pop    %esi
+  800d4a:	5d                   	pop    %ebp
+  800d4b:	c3                   	ret
+
+00800d4c <accept>:
+{
+  800d4c:	55                   	push   %ebp
+  800d4d:	89 e5                	mov    %esp,%ebp
+  800d4f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800d52:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d55:	e8 4e ff ff ff       	call   800ca8 <fd2sockid>
+  800d5a:	85 c0                	test   %eax,%eax
+  800d5c:	78 1b                	js     800d79 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  800d5e:	83 ec 04             	sub    $0x4,%esp
+  800d61:	ff 75 10             	push   0x10(%ebp)
+  800d64:	ff 75 0c             	push   0xc(%ebp)
+  800d67:	50                   	push   %eax
+  800d68:	e8 0e 01 00 00       	call   800e7b <nsipc_accept>
+  800d6d:	83 c4 10             	add    $0x10,%esp
+  800d70:	85 c0                	test   %eax,%eax
+  800d72:	78 05                	js     800d79 <accept+0x2d>
+	return alloc_sockfd(r);
+  800d74:	e8 5f ff ff ff       	call   800cd8 <alloc_sockfd>
+}
+  800d79:	c9                   	leave
+  800d7a:	c3                   	ret
+
+00800d7b <bind>:
+{
+  800d7b:	55                   	push   %ebp
+  800d7c:	89 e5                	mov    %esp,%ebp
+  800d7e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800d81:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d84:	e8 1f ff ff ff       	call   800ca8 <fd2sockid>
+  800d89:	85 c0                	test   %eax,%eax
+  800d8b:	78 12                	js     800d9f <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  800d8d:	83 ec 04             	sub    $0x4,%esp
+  800d90:	ff 75 10             	push   0x10(%ebp)
+  800d93:	ff 75 0c             	push   0xc(%ebp)
+  800d96:	50                   	push   %eax
+  800d97:	e8 31 01 00 00       	call   800ecd <nsipc_bind>
+  800d9c:	83 c4 10             	add    $0x10,%esp
+}
+  800d9f:	c9                   	leave
+  800da0:	c3                   	ret
+
+00800da1 <shutdown>:
+{
+  800da1:	55                   	push   %ebp
+  800da2:	89 e5                	mov    %esp,%ebp
+  800da4:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800da7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800daa:	e8 f9 fe ff ff       	call   800ca8 <fd2sockid>
+  800daf:	85 c0                	test   %eax,%eax
+  800db1:	78 0f                	js     800dc2 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  800db3:	83 ec 08             	sub    $0x8,%esp
+  800db6:	ff 75 0c             	push   0xc(%ebp)
+  800db9:	50                   	push   %eax
+  800dba:	e8 43 01 00 00       	call   800f02 <nsipc_shutdown>
+  800dbf:	83 c4 10             	add    $0x10,%esp
+}
+  800dc2:	c9                   	leave
+  800dc3:	c3                   	ret
+
+00800dc4 <connect>:
+{
+  800dc4:	55                   	push   %ebp
+  800dc5:	89 e5                	mov    %esp,%ebp
+  800dc7:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800dca:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dcd:	e8 d6 fe ff ff       	call   800ca8 <fd2sockid>
+  800dd2:	85 c0                	test   %eax,%eax
+  800dd4:	78 12                	js     800de8 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  800dd6:	83 ec 04             	sub    $0x4,%esp
+  800dd9:	ff 75 10             	push   0x10(%ebp)
+  800ddc:	ff 75 0c             	push   0xc(%ebp)
+  800ddf:	50                   	push   %eax
+  800de0:	e8 59 01 00 00       	call   800f3e <nsipc_connect>
+  800de5:	83 c4 10             	add    $0x10,%esp
+}
+  800de8:	c9                   	leave
+  800de9:	c3                   	ret
+
+00800dea <listen>:
+{
+  800dea:	55                   	push   %ebp
+  800deb:	89 e5                	mov    %esp,%ebp
+  800ded:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800df0:	8b 45 08             	mov    0x8(%ebp),%eax
+  800df3:	e8 b0 fe ff ff       	call   800ca8 <fd2sockid>
+  800df8:	85 c0                	test   %eax,%eax
+  800dfa:	78 0f                	js     800e0b <listen+0x21>
+	return nsipc_listen(r, backlog);
+  800dfc:	83 ec 08             	sub    $0x8,%esp
+  800dff:	ff 75 0c             	push   0xc(%ebp)
+  800e02:	50                   	push   %eax
+  800e03:	e8 6b 01 00 00       	call   800f73 <nsipc_listen>
+  800e08:	83 c4 10             	add    $0x10,%esp
+}
+  800e0b:	c9                   	leave
+  800e0c:	c3                   	ret
+
+00800e0d <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  800e0d:	55                   	push   %ebp
+  800e0e:	89 e5                	mov    %esp,%ebp
+  800e10:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  800e13:	ff 75 10             	push   0x10(%ebp)
+  800e16:	ff 75 0c             	push   0xc(%ebp)
+  800e19:	ff 75 08             	push   0x8(%ebp)
+  800e1c:	e8 41 02 00 00       	call   801062 <nsipc_socket>
+  800e21:	83 c4 10             	add    $0x10,%esp
+  800e24:	85 c0                	test   %eax,%eax
+  800e26:	78 05                	js     800e2d <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  800e28:	e8 ab fe ff ff       	call   800cd8 <alloc_sockfd>
+}
+  800e2d:	c9                   	leave
+  800e2e:	c3                   	ret
+
+00800e2f <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  800e2f:	55                   	push   %ebp
+  800e30:	89 e5                	mov    %esp,%ebp
+  800e32:	53                   	push   %ebx
+  800e33:	83 ec 04             	sub    $0x4,%esp
+  800e36:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  800e38:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800e3f:	74 26                	je     800e67 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  800e41:	6a 07                	push   $0x7
+  800e43:	68 00 60 80 00       	push   $0x806000
+  800e48:	53                   	push   %ebx
+  800e49:	ff 35 04 40 80 00    	push   0x804004
+  800e4f:	e8 2e 11 00 00       	call   801f82 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  800e54:	83 c4 0c             	add    $0xc,%esp
+  800e57:	6a 00                	push   $0x0
+  800e59:	6a 00                	push   $0x0
+  800e5b:	6a 00                	push   $0x0
+  800e5d:	e8 ac 10 00 00       	call   801f0e <ipc_recv>
+}
+  800e62:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e65:	c9                   	leave
+  800e66:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  800e67:	83 ec 0c             	sub    $0xc,%esp
+  800e6a:	6a 02                	push   $0x2
+  800e6c:	e8 65 11 00 00       	call   801fd6 <ipc_find_env>
+  800e71:	a3 04 40 80 00       	mov    %eax,0x804004
+  800e76:	83 c4 10             	add    $0x10,%esp
+  800e79:	eb c6                	jmp    800e41 <nsipc+0x12>
+
+00800e7b <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  800e7b:	55                   	push   %ebp
+  800e7c:	89 e5                	mov    %esp,%ebp
+  800e7e:	56                   	push   %esi
+  800e7f:	53                   	push   %ebx
+  800e80:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  800e83:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e86:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  800e8b:	8b 06                	mov    (%esi),%eax
+  800e8d:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  800e92:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e97:	e8 93 ff ff ff       	call   800e2f <nsipc>
+  800e9c:	89 c3                	mov    %eax,%ebx
+  800e9e:	85 c0                	test   %eax,%eax
+  800ea0:	79 09                	jns    800eab <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  800ea2:	89 d8                	mov    %ebx,%eax
+  800ea4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ea7:	5b                   	pop    %ebx
+  800ea8:	5e                   	pop    %esi
+  800ea9:	5d                   	pop    %ebp
+  800eaa:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  800eab:	83 ec 04             	sub    $0x4,%esp
+  800eae:	ff 35 10 60 80 00    	push   0x806010
+  800eb4:	68 00 60 80 00       	push   $0x806000
+  800eb9:	ff 75 0c             	push   0xc(%ebp)
+  800ebc:	e8 a3 0e 00 00       	call   801d64 <memmove>
+		*addrlen = ret->ret_addrlen;
+  800ec1:	a1 10 60 80 00       	mov    0x806010,%eax
+  800ec6:	89 06                	mov    %eax,(%esi)
+  800ec8:	83 c4 10             	add    $0x10,%esp
+	return r;
+  800ecb:	eb d5                	jmp    800ea2 <nsipc_accept+0x27>
+
+00800ecd <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  800ecd:	55                   	push   %ebp
+  800ece:	89 e5                	mov    %esp,%ebp
+  800ed0:	53                   	push   %ebx
+  800ed1:	83 ec 08             	sub    $0x8,%esp
+  800ed4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  800ed7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800eda:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  800edf:	53                   	push   %ebx
+  800ee0:	ff 75 0c             	push   0xc(%ebp)
+  800ee3:	68 04 60 80 00       	push   $0x806004
+  800ee8:	e8 77 0e 00 00       	call   801d64 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  800eed:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  800ef3:	b8 02 00 00 00       	mov    $0x2,%eax
+  800ef8:	e8 32 ff ff ff       	call   800e2f <nsipc>
+}
+  800efd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f00:	c9                   	leave
+  800f01:	c3                   	ret
+
+00800f02 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  800f02:	55                   	push   %ebp
+  800f03:	89 e5                	mov    %esp,%ebp
+  800f05:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  800f08:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f0b:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  800f10:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f13:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  800f18:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f1d:	e8 0d ff ff ff       	call   800e2f <nsipc>
+}
+  800f22:	c9                   	leave
+  800f23:	c3                   	ret
+
+00800f24 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  800f24:	55                   	push   %ebp
+  800f25:	89 e5                	mov    %esp,%ebp
+  800f27:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  800f2a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f2d:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  800f32:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f37:	e8 f3 fe ff ff       	call   800e2f <nsipc>
+}
+  800f3c:	c9                   	leave
+  800f3d:	c3                   	ret
+
+00800f3e <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  800f3e:	55                   	push   %ebp
+  800f3f:	89 e5                	mov    %esp,%ebp
+  800f41:	53                   	push   %ebx
+  800f42:	83 ec 08             	sub    $0x8,%esp
+  800f45:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  800f48:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f4b:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  800f50:	53                   	push   %ebx
+  800f51:	ff 75 0c             	push   0xc(%ebp)
+  800f54:	68 04 60 80 00       	push   $0x806004
+  800f59:	e8 06 0e 00 00       	call   801d64 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  800f5e:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  800f64:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f69:	e8 c1 fe ff ff       	call   800e2f <nsipc>
+}
+  800f6e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f71:	c9                   	leave
+  800f72:	c3                   	ret
+
+00800f73 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  800f73:	55                   	push   %ebp
+  800f74:	89 e5                	mov    %esp,%ebp
+  800f76:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  800f79:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f7c:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  800f81:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f84:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  800f89:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f8e:	e8 9c fe ff ff       	call   800e2f <nsipc>
+}
+  800f93:	c9                   	leave
+  800f94:	c3                   	ret
+
+00800f95 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  800f95:	55                   	push   %ebp
+  800f96:	89 e5                	mov    %esp,%ebp
+  800f98:	56                   	push   %esi
+  800f99:	53                   	push   %ebx
+  800f9a:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  800f9d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fa0:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  800fa5:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  800fab:	8b 45 14             	mov    0x14(%ebp),%eax
+  800fae:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  800fb3:	b8 07 00 00 00       	mov    $0x7,%eax
+  800fb8:	e8 72 fe ff ff       	call   800e2f <nsipc>
+  800fbd:	89 c3                	mov    %eax,%ebx
+  800fbf:	85 c0                	test   %eax,%eax
+  800fc1:	78 22                	js     800fe5 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  800fc3:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  800fc8:	39 c6                	cmp    %eax,%esi
+  800fca:	0f 4e c6             	cmovle %esi,%eax
+  800fcd:	39 c3                	cmp    %eax,%ebx
+  800fcf:	7f 1d                	jg     800fee <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  800fd1:	83 ec 04             	sub    $0x4,%esp
+  800fd4:	53                   	push   %ebx
+  800fd5:	68 00 60 80 00       	push   $0x806000
+  800fda:	ff 75 0c             	push   0xc(%ebp)
+  800fdd:	e8 82 0d 00 00       	call   801d64 <memmove>
+  800fe2:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  800fe5:	89 d8                	mov    %ebx,%eax
+  800fe7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fea:	5b                   	pop    %ebx
+  800feb:	5e                   	pop    %esi
+  800fec:	5d                   	pop    %ebp
+  800fed:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  800fee:	68 07 26 80 00       	push   $0x802607
+  800ff3:	68 cf 25 80 00       	push   $0x8025cf
+  800ff8:	6a 62                	push   $0x62
+  800ffa:	68 1c 26 80 00       	push   $0x80261c
+  800fff:	e8 46 05 00 00       	call   80154a <_panic>
+
+00801004 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801004:	55                   	push   %ebp
+  801005:	89 e5                	mov    %esp,%ebp
+  801007:	53                   	push   %ebx
+  801008:	83 ec 04             	sub    $0x4,%esp
+  80100b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  80100e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801011:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  801016:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80101c:	7f 2e                	jg     80104c <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  80101e:	83 ec 04             	sub    $0x4,%esp
+  801021:	53                   	push   %ebx
+  801022:	ff 75 0c             	push   0xc(%ebp)
+  801025:	68 0c 60 80 00       	push   $0x80600c
+  80102a:	e8 35 0d 00 00       	call   801d64 <memmove>
+	nsipcbuf.send.req_size = size;
+  80102f:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  801035:	8b 45 14             	mov    0x14(%ebp),%eax
+  801038:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  80103d:	b8 08 00 00 00       	mov    $0x8,%eax
+  801042:	e8 e8 fd ff ff       	call   800e2f <nsipc>
+}
+  801047:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80104a:	c9                   	leave
+  80104b:	c3                   	ret
+	assert(size < 1600);
+  80104c:	68 28 26 80 00       	push   $0x802628
+  801051:	68 cf 25 80 00       	push   $0x8025cf
+  801056:	6a 6d                	push   $0x6d
+  801058:	68 1c 26 80 00       	push   $0x80261c
+  80105d:	e8 e8 04 00 00       	call   80154a <_panic>
+
+00801062 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801062:	55                   	push   %ebp
+  801063:	89 e5                	mov    %esp,%ebp
+  801065:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801068:	8b 45 08             	mov    0x8(%ebp),%eax
+  80106b:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  801070:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801073:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  801078:	8b 45 10             	mov    0x10(%ebp),%eax
+  80107b:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  801080:	b8 09 00 00 00       	mov    $0x9,%eax
+  801085:	e8 a5 fd ff ff       	call   800e2f <nsipc>
+}
+  80108a:	c9                   	leave
+  80108b:	c3                   	ret
+
+0080108c <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80108c:	55                   	push   %ebp
+  80108d:	89 e5                	mov    %esp,%ebp
+  80108f:	56                   	push   %esi
+  801090:	53                   	push   %ebx
+  801091:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801094:	83 ec 0c             	sub    $0xc,%esp
+  801097:	ff 75 08             	push   0x8(%ebp)
+  80109a:	e8 aa f3 ff ff       	call   800449 <fd2data>
+  80109f:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8010a1:	83 c4 08             	add    $0x8,%esp
+  8010a4:	68 34 26 80 00       	push   $0x802634
+  8010a9:	53                   	push   %ebx
+  8010aa:	e8 2f 0b 00 00       	call   801bde <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8010af:	8b 46 04             	mov    0x4(%esi),%eax
+  8010b2:	2b 06                	sub    (%esi),%eax
+  8010b4:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8010ba:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8010c1:	00 00 00 
+	stat->st_dev = &devpipe;
+  8010c4:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  8010cb:	30 80 00 
+	return 0;
+}
+  8010ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010d3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8010d6:	5b                   	pop    %ebx
+  8010d7:	5e                   	pop    %esi
+  8010d8:	5d                   	pop    %ebp
+  8010d9:	c3                   	ret
+
+008010da <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8010da:	55                   	push   %ebp
+  8010db:	89 e5                	mov    %esp,%ebp
+  8010dd:	53                   	push   %ebx
+  8010de:	83 ec 0c             	sub    $0xc,%esp
+  8010e1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8010e4:	53                   	push   %ebx
+  8010e5:	6a 00                	push   $0x0
+  8010e7:	e8 ff f0 ff ff       	call   8001eb <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8010ec:	89 1c 24             	mov    %ebx,(%esp)
+  8010ef:	e8 55 f3 ff ff       	call   800449 <fd2data>
+  8010f4:	83 c4 08             	add    $0x8,%esp
+  8010f7:	50                   	push   %eax
+  8010f8:	6a 00                	push   $0x0
+  8010fa:	e8 ec f0 ff ff       	call   8001eb <sys_page_unmap>
+}
+  8010ff:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801102:	c9                   	leave
+  801103:	c3                   	ret
+
+00801104 <_pipeisclosed>:
+{
+  801104:	55                   	push   %ebp
+  801105:	89 e5                	mov    %esp,%ebp
+  801107:	57                   	push   %edi
+  801108:	56                   	push   %esi
+  801109:	53                   	push   %ebx
+  80110a:	83 ec 1c             	sub    $0x1c,%esp
+  80110d:	89 c7                	mov    %eax,%edi
+  80110f:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801111:	a1 08 40 80 00       	mov    0x804008,%eax
+  801116:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801119:	83 ec 0c             	sub    $0xc,%esp
+  80111c:	57                   	push   %edi
+  80111d:	e8 f3 0e 00 00       	call   802015 <pageref>
+  801122:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801125:	89 34 24             	mov    %esi,(%esp)
+  801128:	e8 e8 0e 00 00       	call   802015 <pageref>
+		nn = thisenv->env_runs;
+  80112d:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801133:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801136:	83 c4 10             	add    $0x10,%esp
+  801139:	39 cb                	cmp    %ecx,%ebx
+  80113b:	74 1b                	je     801158 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  80113d:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801140:	75 cf                	jne    801111 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801142:	8b 42 58             	mov    0x58(%edx),%eax
+  801145:	6a 01                	push   $0x1
+  801147:	50                   	push   %eax
+  801148:	53                   	push   %ebx
+  801149:	68 3b 26 80 00       	push   $0x80263b
+  80114e:	e8 d2 04 00 00       	call   801625 <cprintf>
+  801153:	83 c4 10             	add    $0x10,%esp
+  801156:	eb b9                	jmp    801111 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801158:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80115b:	0f 94 c0             	sete   %al
+  80115e:	0f b6 c0             	movzbl %al,%eax
+}
+  801161:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801164:	5b                   	pop    %ebx
+  801165:	5e                   	pop    %esi
+  801166:	5f                   	pop    %edi
+  801167:	5d                   	pop    %ebp
+  801168:	c3                   	ret
+
+00801169 <devpipe_write>:
+{
+  801169:	55                   	push   %ebp
+  80116a:	89 e5                	mov    %esp,%ebp
+  80116c:	57                   	push   %edi
+  80116d:	56                   	push   %esi
+  80116e:	53                   	push   %ebx
+  80116f:	83 ec 28             	sub    $0x28,%esp
+  801172:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801175:	56                   	push   %esi
+  801176:	e8 ce f2 ff ff       	call   800449 <fd2data>
+  80117b:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80117d:	83 c4 10             	add    $0x10,%esp
+  801180:	bf 00 00 00 00       	mov    $0x0,%edi
+  801185:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801188:	75 09                	jne    801193 <devpipe_write+0x2a>
+	return i;
+  80118a:	89 f8                	mov    %edi,%eax
+  80118c:	eb 23                	jmp    8011b1 <devpipe_write+0x48>
+			sys_yield();
+  80118e:	e8 b4 ef ff ff       	call   800147 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801193:	8b 43 04             	mov    0x4(%ebx),%eax
+  801196:	8b 0b                	mov    (%ebx),%ecx
+  801198:	8d 51 20             	lea    0x20(%ecx),%edx
+  80119b:	39 d0                	cmp    %edx,%eax
+  80119d:	72 1a                	jb     8011b9 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  80119f:	89 da                	mov    %ebx,%edx
+  8011a1:	89 f0                	mov    %esi,%eax
+  8011a3:	e8 5c ff ff ff       	call   801104 <_pipeisclosed>
+  8011a8:	85 c0                	test   %eax,%eax
+  8011aa:	74 e2                	je     80118e <devpipe_write+0x25>
+				return 0;
+  8011ac:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011b4:	5b                   	pop    %ebx
+  8011b5:	5e                   	pop    %esi
+  8011b6:	5f                   	pop    %edi
+  8011b7:	5d                   	pop    %ebp
+  8011b8:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8011b9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011bc:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8011c0:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8011c3:	89 c2                	mov    %eax,%edx
+  8011c5:	c1 fa 1f             	sar    $0x1f,%edx
+  8011c8:	89 d1                	mov    %edx,%ecx
+  8011ca:	c1 e9 1b             	shr    $0x1b,%ecx
+  8011cd:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8011d0:	83 e2 1f             	and    $0x1f,%edx
+  8011d3:	29 ca                	sub    %ecx,%edx
+  8011d5:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8011d9:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8011dd:	83 c0 01             	add    $0x1,%eax
+  8011e0:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8011e3:	83 c7 01             	add    $0x1,%edi
+  8011e6:	eb 9d                	jmp    801185 <devpipe_write+0x1c>
+
+008011e8 <devpipe_read>:
+{
+  8011e8:	55                   	push   %ebp
+  8011e9:	89 e5                	mov    %esp,%ebp
+  8011eb:	57                   	push   %edi
+  8011ec:	56                   	push   %esi
+  8011ed:	53                   	push   %ebx
+  8011ee:	83 ec 18             	sub    $0x18,%esp
+  8011f1:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8011f4:	57                   	push   %edi
+  8011f5:	e8 4f f2 ff ff       	call   800449 <fd2data>
+  8011fa:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8011fc:	83 c4 10             	add    $0x10,%esp
+  8011ff:	be 00 00 00 00       	mov    $0x0,%esi
+  801204:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801207:	75 13                	jne    80121c <devpipe_read+0x34>
+	return i;
+  801209:	89 f0                	mov    %esi,%eax
+  80120b:	eb 02                	jmp    80120f <devpipe_read+0x27>
+				return i;
+  80120d:	89 f0                	mov    %esi,%eax
+}
+  80120f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801212:	5b                   	pop    %ebx
+  801213:	5e                   	pop    %esi
+  801214:	5f                   	pop    %edi
+  801215:	5d                   	pop    %ebp
+  801216:	c3                   	ret
+			sys_yield();
+  801217:	e8 2b ef ff ff       	call   800147 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  80121c:	8b 03                	mov    (%ebx),%eax
+  80121e:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801221:	75 18                	jne    80123b <devpipe_read+0x53>
+			if (i > 0)
+  801223:	85 f6                	test   %esi,%esi
+  801225:	75 e6                	jne    80120d <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  801227:	89 da                	mov    %ebx,%edx
+  801229:	89 f8                	mov    %edi,%eax
+  80122b:	e8 d4 fe ff ff       	call   801104 <_pipeisclosed>
+  801230:	85 c0                	test   %eax,%eax
+  801232:	74 e3                	je     801217 <devpipe_read+0x2f>
+				return 0;
+  801234:	b8 00 00 00 00       	mov    $0x0,%eax
+  801239:	eb d4                	jmp    80120f <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80123b:	99                   	cltd
+  80123c:	c1 ea 1b             	shr    $0x1b,%edx
+  80123f:	01 d0                	add    %edx,%eax
+  801241:	83 e0 1f             	and    $0x1f,%eax
+  801244:	29 d0                	sub    %edx,%eax
+  801246:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  80124b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80124e:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  801251:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  801254:	83 c6 01             	add    $0x1,%esi
+  801257:	eb ab                	jmp    801204 <devpipe_read+0x1c>
+
+00801259 <pipe>:
+{
+  801259:	55                   	push   %ebp
+  80125a:	89 e5                	mov    %esp,%ebp
+  80125c:	56                   	push   %esi
+  80125d:	53                   	push   %ebx
+  80125e:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801261:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801264:	50                   	push   %eax
+  801265:	e8 f6 f1 ff ff       	call   800460 <fd_alloc>
+  80126a:	89 c3                	mov    %eax,%ebx
+  80126c:	83 c4 10             	add    $0x10,%esp
+  80126f:	85 c0                	test   %eax,%eax
+  801271:	0f 88 23 01 00 00    	js     80139a <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801277:	83 ec 04             	sub    $0x4,%esp
+  80127a:	68 07 04 00 00       	push   $0x407
+  80127f:	ff 75 f4             	push   -0xc(%ebp)
+  801282:	6a 00                	push   $0x0
+  801284:	e8 dd ee ff ff       	call   800166 <sys_page_alloc>
+  801289:	89 c3                	mov    %eax,%ebx
+  80128b:	83 c4 10             	add    $0x10,%esp
+  80128e:	85 c0                	test   %eax,%eax
+  801290:	0f 88 04 01 00 00    	js     80139a <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801296:	83 ec 0c             	sub    $0xc,%esp
+  801299:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80129c:	50                   	push   %eax
+  80129d:	e8 be f1 ff ff       	call   800460 <fd_alloc>
+  8012a2:	89 c3                	mov    %eax,%ebx
+  8012a4:	83 c4 10             	add    $0x10,%esp
+  8012a7:	85 c0                	test   %eax,%eax
+  8012a9:	0f 88 db 00 00 00    	js     80138a <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8012af:	83 ec 04             	sub    $0x4,%esp
+  8012b2:	68 07 04 00 00       	push   $0x407
+  8012b7:	ff 75 f0             	push   -0x10(%ebp)
+  8012ba:	6a 00                	push   $0x0
+  8012bc:	e8 a5 ee ff ff       	call   800166 <sys_page_alloc>
+  8012c1:	89 c3                	mov    %eax,%ebx
+  8012c3:	83 c4 10             	add    $0x10,%esp
+  8012c6:	85 c0                	test   %eax,%eax
+  8012c8:	0f 88 bc 00 00 00    	js     80138a <pipe+0x131>
+	va = fd2data(fd0);
+  8012ce:	83 ec 0c             	sub    $0xc,%esp
+  8012d1:	ff 75 f4             	push   -0xc(%ebp)
+  8012d4:	e8 70 f1 ff ff       	call   800449 <fd2data>
+  8012d9:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8012db:	83 c4 0c             	add    $0xc,%esp
+  8012de:	68 07 04 00 00       	push   $0x407
+  8012e3:	50                   	push   %eax
+  8012e4:	6a 00                	push   $0x0
+  8012e6:	e8 7b ee ff ff       	call   800166 <sys_page_alloc>
+  8012eb:	89 c3                	mov    %eax,%ebx
+  8012ed:	83 c4 10             	add    $0x10,%esp
+  8012f0:	85 c0                	test   %eax,%eax
+  8012f2:	0f 88 82 00 00 00    	js     80137a <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8012f8:	83 ec 0c             	sub    $0xc,%esp
+  8012fb:	ff 75 f0             	push   -0x10(%ebp)
+  8012fe:	e8 46 f1 ff ff       	call   800449 <fd2data>
+  801303:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80130a:	50                   	push   %eax
+  80130b:	6a 00                	push   $0x0
+  80130d:	56                   	push   %esi
+  80130e:	6a 00                	push   $0x0
+  801310:	e8 94 ee ff ff       	call   8001a9 <sys_page_map>
+  801315:	89 c3                	mov    %eax,%ebx
+  801317:	83 c4 20             	add    $0x20,%esp
+  80131a:	85 c0                	test   %eax,%eax
+  80131c:	78 4e                	js     80136c <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80131e:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  801323:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801326:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  801328:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80132b:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  801332:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801335:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  801337:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80133a:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  801341:	83 ec 0c             	sub    $0xc,%esp
+  801344:	ff 75 f4             	push   -0xc(%ebp)
+  801347:	e8 ed f0 ff ff       	call   800439 <fd2num>
+  80134c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80134f:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  801351:	83 c4 04             	add    $0x4,%esp
+  801354:	ff 75 f0             	push   -0x10(%ebp)
+  801357:	e8 dd f0 ff ff       	call   800439 <fd2num>
+  80135c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80135f:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  801362:	83 c4 10             	add    $0x10,%esp
+  801365:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80136a:	eb 2e                	jmp    80139a <pipe+0x141>
+	sys_page_unmap(0, va);
+  80136c:	83 ec 08             	sub    $0x8,%esp
+  80136f:	56                   	push   %esi
+  801370:	6a 00                	push   $0x0
+  801372:	e8 74 ee ff ff       	call   8001eb <sys_page_unmap>
+  801377:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80137a:	83 ec 08             	sub    $0x8,%esp
+  80137d:	ff 75 f0             	push   -0x10(%ebp)
+  801380:	6a 00                	push   $0x0
+  801382:	e8 64 ee ff ff       	call   8001eb <sys_page_unmap>
+  801387:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80138a:	83 ec 08             	sub    $0x8,%esp
+  80138d:	ff 75 f4             	push   -0xc(%ebp)
+  801390:	6a 00                	push   $0x0
+  801392:	e8 54 ee ff ff       	call   8001eb <sys_page_unmap>
+  801397:	83 c4 10             	add    $0x10,%esp
+}
+  80139a:	89 d8                	mov    %ebx,%eax
+  80139c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80139f:	5b                   	pop    %ebx
+  8013a0:	5e                   	pop    %esi
+  8013a1:	5d                   	pop    %ebp
+  8013a2:	c3                   	ret
+
+008013a3 <pipeisclosed>:
+{
+  8013a3:	55                   	push   %ebp
+  8013a4:	89 e5                	mov    %esp,%ebp
+  8013a6:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8013a9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013ac:	50                   	push   %eax
+  8013ad:	ff 75 08             	push   0x8(%ebp)
+  8013b0:	e8 01 f1 ff ff       	call   8004b6 <fd_lookup>
+  8013b5:	83 c4 10             	add    $0x10,%esp
+  8013b8:	85 c0                	test   %eax,%eax
+  8013ba:	78 18                	js     8013d4 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8013bc:	83 ec 0c             	sub    $0xc,%esp
+  8013bf:	ff 75 f4             	push   -0xc(%ebp)
+  8013c2:	e8 82 f0 ff ff       	call   800449 <fd2data>
+  8013c7:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8013c9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013cc:	e8 33 fd ff ff       	call   801104 <_pipeisclosed>
+  8013d1:	83 c4 10             	add    $0x10,%esp
+}
+  8013d4:	c9                   	leave
+  8013d5:	c3                   	ret
+
+008013d6 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8013d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013db:	c3                   	ret
+
+008013dc <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8013dc:	55                   	push   %ebp
+  8013dd:	89 e5                	mov    %esp,%ebp
+  8013df:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8013e2:	68 53 26 80 00       	push   $0x802653
+  8013e7:	ff 75 0c             	push   0xc(%ebp)
+  8013ea:	e8 ef 07 00 00       	call   801bde <strcpy>
+	return 0;
+}
+  8013ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013f4:	c9                   	leave
+  8013f5:	c3                   	ret
+
+008013f6 <devcons_write>:
+{
+  8013f6:	55                   	push   %ebp
+  8013f7:	89 e5                	mov    %esp,%ebp
+  8013f9:	57                   	push   %edi
+  8013fa:	56                   	push   %esi
+  8013fb:	53                   	push   %ebx
+  8013fc:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  801402:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  801407:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80140d:	eb 2e                	jmp    80143d <devcons_write+0x47>
+		m = n - tot;
+  80140f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801412:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  801414:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801419:	39 c3                	cmp    %eax,%ebx
+  80141b:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80141e:	83 ec 04             	sub    $0x4,%esp
+  801421:	53                   	push   %ebx
+  801422:	89 f0                	mov    %esi,%eax
+  801424:	03 45 0c             	add    0xc(%ebp),%eax
+  801427:	50                   	push   %eax
+  801428:	57                   	push   %edi
+  801429:	e8 36 09 00 00       	call   801d64 <memmove>
+		sys_cputs(buf, m);
+  80142e:	83 c4 08             	add    $0x8,%esp
+  801431:	53                   	push   %ebx
+  801432:	57                   	push   %edi
+  801433:	e8 72 ec ff ff       	call   8000aa <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  801438:	01 de                	add    %ebx,%esi
+  80143a:	83 c4 10             	add    $0x10,%esp
+  80143d:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801440:	72 cd                	jb     80140f <devcons_write+0x19>
+}
+  801442:	89 f0                	mov    %esi,%eax
+  801444:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801447:	5b                   	pop    %ebx
+  801448:	5e                   	pop    %esi
+  801449:	5f                   	pop    %edi
+  80144a:	5d                   	pop    %ebp
+  80144b:	c3                   	ret
+
+0080144c <devcons_read>:
+{
+  80144c:	55                   	push   %ebp
+  80144d:	89 e5                	mov    %esp,%ebp
+  80144f:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  801452:	b8 00 00 00 00       	mov    $0x0,%eax
+  801457:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80145b:	75 07                	jne    801464 <devcons_read+0x18>
+  80145d:	eb 1f                	jmp    80147e <devcons_read+0x32>
+		sys_yield();
+  80145f:	e8 e3 ec ff ff       	call   800147 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  801464:	e8 5f ec ff ff       	call   8000c8 <sys_cgetc>
+  801469:	85 c0                	test   %eax,%eax
+  80146b:	74 f2                	je     80145f <devcons_read+0x13>
+	if (c < 0)
+  80146d:	78 0f                	js     80147e <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80146f:	83 f8 04             	cmp    $0x4,%eax
+  801472:	74 0c                	je     801480 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  801474:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801477:	88 02                	mov    %al,(%edx)
+	return 1;
+  801479:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80147e:	c9                   	leave
+  80147f:	c3                   	ret
+		return 0;
+  801480:	b8 00 00 00 00       	mov    $0x0,%eax
+  801485:	eb f7                	jmp    80147e <devcons_read+0x32>
+
+00801487 <cputchar>:
+{
+  801487:	55                   	push   %ebp
+  801488:	89 e5                	mov    %esp,%ebp
+  80148a:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80148d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801490:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  801493:	6a 01                	push   $0x1
+  801495:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801498:	50                   	push   %eax
+  801499:	e8 0c ec ff ff       	call   8000aa <sys_cputs>
+}
+  80149e:	83 c4 10             	add    $0x10,%esp
+  8014a1:	c9                   	leave
+  8014a2:	c3                   	ret
+
+008014a3 <getchar>:
+{
+  8014a3:	55                   	push   %ebp
+  8014a4:	89 e5                	mov    %esp,%ebp
+  8014a6:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8014a9:	6a 01                	push   $0x1
+  8014ab:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8014ae:	50                   	push   %eax
+  8014af:	6a 00                	push   $0x0
+  8014b1:	e8 66 f2 ff ff       	call   80071c <read>
+	if (r < 0)
+  8014b6:	83 c4 10             	add    $0x10,%esp
+  8014b9:	85 c0                	test   %eax,%eax
+  8014bb:	78 06                	js     8014c3 <getchar+0x20>
+	if (r < 1)
+  8014bd:	74 06                	je     8014c5 <getchar+0x22>
+	return c;
+  8014bf:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8014c3:	c9                   	leave
+  8014c4:	c3                   	ret
+		return -E_EOF;
+  8014c5:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8014ca:	eb f7                	jmp    8014c3 <getchar+0x20>
+
+008014cc <iscons>:
+{
+  8014cc:	55                   	push   %ebp
+  8014cd:	89 e5                	mov    %esp,%ebp
+  8014cf:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8014d2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014d5:	50                   	push   %eax
+  8014d6:	ff 75 08             	push   0x8(%ebp)
+  8014d9:	e8 d8 ef ff ff       	call   8004b6 <fd_lookup>
+  8014de:	83 c4 10             	add    $0x10,%esp
+  8014e1:	85 c0                	test   %eax,%eax
+  8014e3:	78 11                	js     8014f6 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8014e5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014e8:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  8014ee:	39 10                	cmp    %edx,(%eax)
+  8014f0:	0f 94 c0             	sete   %al
+  8014f3:	0f b6 c0             	movzbl %al,%eax
+}
+  8014f6:	c9                   	leave
+  8014f7:	c3                   	ret
+
+008014f8 <opencons>:
+{
+  8014f8:	55                   	push   %ebp
+  8014f9:	89 e5                	mov    %esp,%ebp
+  8014fb:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8014fe:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801501:	50                   	push   %eax
+  801502:	e8 59 ef ff ff       	call   800460 <fd_alloc>
+  801507:	83 c4 10             	add    $0x10,%esp
+  80150a:	85 c0                	test   %eax,%eax
+  80150c:	78 3a                	js     801548 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80150e:	83 ec 04             	sub    $0x4,%esp
+  801511:	68 07 04 00 00       	push   $0x407
+  801516:	ff 75 f4             	push   -0xc(%ebp)
+  801519:	6a 00                	push   $0x0
+  80151b:	e8 46 ec ff ff       	call   800166 <sys_page_alloc>
+  801520:	83 c4 10             	add    $0x10,%esp
+  801523:	85 c0                	test   %eax,%eax
+  801525:	78 21                	js     801548 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  801527:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80152a:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  801530:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  801532:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801535:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80153c:	83 ec 0c             	sub    $0xc,%esp
+  80153f:	50                   	push   %eax
+  801540:	e8 f4 ee ff ff       	call   800439 <fd2num>
+  801545:	83 c4 10             	add    $0x10,%esp
+}
+  801548:	c9                   	leave
+  801549:	c3                   	ret
+
+0080154a <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80154a:	55                   	push   %ebp
+  80154b:	89 e5                	mov    %esp,%ebp
+  80154d:	56                   	push   %esi
+  80154e:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80154f:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  801552:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  801558:	e8 cb eb ff ff       	call   800128 <sys_getenvid>
+  80155d:	83 ec 0c             	sub    $0xc,%esp
+  801560:	ff 75 0c             	push   0xc(%ebp)
+  801563:	ff 75 08             	push   0x8(%ebp)
+  801566:	56                   	push   %esi
+  801567:	50                   	push   %eax
+  801568:	68 60 26 80 00       	push   $0x802660
+  80156d:	e8 b3 00 00 00       	call   801625 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  801572:	83 c4 18             	add    $0x18,%esp
+  801575:	53                   	push   %ebx
+  801576:	ff 75 10             	push   0x10(%ebp)
+  801579:	e8 56 00 00 00       	call   8015d4 <vcprintf>
+	cprintf("\n");
+  80157e:	c7 04 24 4c 26 80 00 	movl   $0x80264c,(%esp)
+  801585:	e8 9b 00 00 00       	call   801625 <cprintf>
+  80158a:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80158d:	cc                   	int3
+	while (1)
+  80158e:	eb fd                	jmp    80158d <_panic+0x43>
+
+00801590 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  801590:	55                   	push   %ebp
+  801591:	89 e5                	mov    %esp,%ebp
+  801593:	53                   	push   %ebx
+  801594:	83 ec 04             	sub    $0x4,%esp
+  801597:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80159a:	8b 13                	mov    (%ebx),%edx
+  80159c:	8d 42 01             	lea    0x1(%edx),%eax
+  80159f:	89 03                	mov    %eax,(%ebx)
+  8015a1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8015a4:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8015a8:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8015ad:	74 09                	je     8015b8 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8015af:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8015b3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015b6:	c9                   	leave
+  8015b7:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8015b8:	83 ec 08             	sub    $0x8,%esp
+  8015bb:	68 ff 00 00 00       	push   $0xff
+  8015c0:	8d 43 08             	lea    0x8(%ebx),%eax
+  8015c3:	50                   	push   %eax
+  8015c4:	e8 e1 ea ff ff       	call   8000aa <sys_cputs>
+		b->idx = 0;
+  8015c9:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8015cf:	83 c4 10             	add    $0x10,%esp
+  8015d2:	eb db                	jmp    8015af <putch+0x1f>
+
+008015d4 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8015d4:	55                   	push   %ebp
+  8015d5:	89 e5                	mov    %esp,%ebp
+  8015d7:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8015dd:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8015e4:	00 00 00 
+	b.cnt = 0;
+  8015e7:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8015ee:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8015f1:	ff 75 0c             	push   0xc(%ebp)
+  8015f4:	ff 75 08             	push   0x8(%ebp)
+  8015f7:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8015fd:	50                   	push   %eax
+  8015fe:	68 90 15 80 00       	push   $0x801590
+  801603:	e8 14 01 00 00       	call   80171c <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  801608:	83 c4 08             	add    $0x8,%esp
+  80160b:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  801611:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  801617:	50                   	push   %eax
+  801618:	e8 8d ea ff ff       	call   8000aa <sys_cputs>
+
+	return b.cnt;
+}
+  80161d:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  801623:	c9                   	leave
+  801624:	c3                   	ret
+
+00801625 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  801625:	55                   	push   %ebp
+  801626:	89 e5                	mov    %esp,%ebp
+  801628:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80162b:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80162e:	50                   	push   %eax
+  80162f:	ff 75 08             	push   0x8(%ebp)
+  801632:	e8 9d ff ff ff       	call   8015d4 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  801637:	c9                   	leave
+  801638:	c3                   	ret
+
+00801639 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  801639:	55                   	push   %ebp
+  80163a:	89 e5                	mov    %esp,%ebp
+  80163c:	57                   	push   %edi
+  80163d:	56                   	push   %esi
+  80163e:	53                   	push   %ebx
+  80163f:	83 ec 1c             	sub    $0x1c,%esp
+  801642:	89 c7                	mov    %eax,%edi
+  801644:	89 d6                	mov    %edx,%esi
+  801646:	8b 45 08             	mov    0x8(%ebp),%eax
+  801649:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80164c:	89 d1                	mov    %edx,%ecx
+  80164e:	89 c2                	mov    %eax,%edx
+  801650:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801653:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801656:	8b 45 10             	mov    0x10(%ebp),%eax
+  801659:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80165c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80165f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801666:	39 c2                	cmp    %eax,%edx
+  801668:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80166b:	72 3e                	jb     8016ab <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80166d:	83 ec 0c             	sub    $0xc,%esp
+  801670:	ff 75 18             	push   0x18(%ebp)
+  801673:	83 eb 01             	sub    $0x1,%ebx
+  801676:	53                   	push   %ebx
+  801677:	50                   	push   %eax
+  801678:	83 ec 08             	sub    $0x8,%esp
+  80167b:	ff 75 e4             	push   -0x1c(%ebp)
+  80167e:	ff 75 e0             	push   -0x20(%ebp)
+  801681:	ff 75 dc             	push   -0x24(%ebp)
+  801684:	ff 75 d8             	push   -0x28(%ebp)
+  801687:	e8 e4 0a 00 00       	call   802170 <__udivdi3>
+  80168c:	83 c4 18             	add    $0x18,%esp
+  80168f:	52                   	push   %edx
+  801690:	50                   	push   %eax
+  801691:	89 f2                	mov    %esi,%edx
+  801693:	89 f8                	mov    %edi,%eax
+  801695:	e8 9f ff ff ff       	call   801639 <printnum>
+  80169a:	83 c4 20             	add    $0x20,%esp
+  80169d:	eb 13                	jmp    8016b2 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80169f:	83 ec 08             	sub    $0x8,%esp
+  8016a2:	56                   	push   %esi
+  8016a3:	ff 75 18             	push   0x18(%ebp)
+  8016a6:	ff d7                	call   *%edi
+  8016a8:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8016ab:	83 eb 01             	sub    $0x1,%ebx
+  8016ae:	85 db                	test   %ebx,%ebx
+  8016b0:	7f ed                	jg     80169f <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8016b2:	83 ec 08             	sub    $0x8,%esp
+  8016b5:	56                   	push   %esi
+  8016b6:	83 ec 04             	sub    $0x4,%esp
+  8016b9:	ff 75 e4             	push   -0x1c(%ebp)
+  8016bc:	ff 75 e0             	push   -0x20(%ebp)
+  8016bf:	ff 75 dc             	push   -0x24(%ebp)
+  8016c2:	ff 75 d8             	push   -0x28(%ebp)
+  8016c5:	e8 76 0b 00 00       	call   802240 <__umoddi3>
+  8016ca:	83 c4 14             	add    $0x14,%esp
+  8016cd:	0f be 80 83 26 80 00 	movsbl 0x802683(%eax),%eax
+  8016d4:	50                   	push   %eax
+  8016d5:	ff d7                	call   *%edi
+}
+  8016d7:	83 c4 10             	add    $0x10,%esp
+  8016da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016dd:	5b                   	pop    %ebx
+  8016de:	5e                   	pop    %esi
+  8016df:	5f                   	pop    %edi
+  8016e0:	5d                   	pop    %ebp
+  8016e1:	c3                   	ret
+
+008016e2 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8016e2:	55                   	push   %ebp
+  8016e3:	89 e5                	mov    %esp,%ebp
+  8016e5:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8016e8:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8016ec:	8b 10                	mov    (%eax),%edx
+  8016ee:	3b 50 04             	cmp    0x4(%eax),%edx
+  8016f1:	73 0a                	jae    8016fd <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8016f3:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8016f6:	89 08                	mov    %ecx,(%eax)
+  8016f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016fb:	88 02                	mov    %al,(%edx)
+}
+  8016fd:	5d                   	pop    %ebp
+  8016fe:	c3                   	ret
+
+008016ff <printfmt>:
+{
+  8016ff:	55                   	push   %ebp
+  801700:	89 e5                	mov    %esp,%ebp
+  801702:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  801705:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  801708:	50                   	push   %eax
+  801709:	ff 75 10             	push   0x10(%ebp)
+  80170c:	ff 75 0c             	push   0xc(%ebp)
+  80170f:	ff 75 08             	push   0x8(%ebp)
+  801712:	e8 05 00 00 00       	call   80171c <vprintfmt>
+}
+  801717:	83 c4 10             	add    $0x10,%esp
+  80171a:	c9                   	leave
+  80171b:	c3                   	ret
+
+0080171c <vprintfmt>:
+{
+  80171c:	55                   	push   %ebp
+  80171d:	89 e5                	mov    %esp,%ebp
+  80171f:	57                   	push   %edi
+  801720:	56                   	push   %esi
+  801721:	53                   	push   %ebx
+  801722:	83 ec 2c             	sub    $0x2c,%esp
+  801725:	8b 75 08             	mov    0x8(%ebp),%esi
+  801728:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80172b:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80172e:	eb 0a                	jmp    80173a <vprintfmt+0x1e>
+			putch(ch, putdat);
+  801730:	83 ec 08             	sub    $0x8,%esp
+  801733:	53                   	push   %ebx
+  801734:	50                   	push   %eax
+  801735:	ff d6                	call   *%esi
+  801737:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80173a:	83 c7 01             	add    $0x1,%edi
+  80173d:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  801741:	83 f8 25             	cmp    $0x25,%eax
+  801744:	74 0c                	je     801752 <vprintfmt+0x36>
+			if (ch == '\0')
+  801746:	85 c0                	test   %eax,%eax
+  801748:	75 e6                	jne    801730 <vprintfmt+0x14>
+}
+  80174a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80174d:	5b                   	pop    %ebx
+  80174e:	5e                   	pop    %esi
+  80174f:	5f                   	pop    %edi
+  801750:	5d                   	pop    %ebp
+  801751:	c3                   	ret
+		padc = ' ';
+  801752:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  801756:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80175d:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  801764:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80176b:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801770:	8d 47 01             	lea    0x1(%edi),%eax
+  801773:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801776:	0f b6 17             	movzbl (%edi),%edx
+  801779:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80177c:	3c 55                	cmp    $0x55,%al
+  80177e:	0f 87 9a 03 00 00    	ja     801b1e <vprintfmt+0x402>
+  801784:	0f b6 c0             	movzbl %al,%eax
+  801787:	ff 24 85 c0 27 80 00 	jmp    *0x8027c0(,%eax,4)
+  80178e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  801791:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  801795:	eb d9                	jmp    801770 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  801797:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80179a:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80179e:	eb d0                	jmp    801770 <vprintfmt+0x54>
+  8017a0:	0f b6 d2             	movzbl %dl,%edx
+  8017a3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8017a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017ab:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8017ae:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8017b1:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8017b5:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8017b8:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8017bb:	83 f9 09             	cmp    $0x9,%ecx
+  8017be:	77 55                	ja     801815 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8017c0:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8017c3:	eb e9                	jmp    8017ae <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8017c5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8017c8:	8b 00                	mov    (%eax),%eax
+  8017ca:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8017cd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8017d0:	8d 40 04             	lea    0x4(%eax),%eax
+  8017d3:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8017d6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8017d9:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8017dd:	79 91                	jns    801770 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8017df:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8017e2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8017e5:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8017ec:	eb 82                	jmp    801770 <vprintfmt+0x54>
+			if (width < 0)
+  8017ee:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8017f1:	85 d2                	test   %edx,%edx
+  8017f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017f8:	0f 49 c2             	cmovns %edx,%eax
+  8017fb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8017fe:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  801801:	e9 6a ff ff ff       	jmp    801770 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  801806:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  801809:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  801810:	e9 5b ff ff ff       	jmp    801770 <vprintfmt+0x54>
+  801815:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801818:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80181b:	eb bc                	jmp    8017d9 <vprintfmt+0xbd>
+			lflag++;
+  80181d:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801820:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  801823:	e9 48 ff ff ff       	jmp    801770 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  801828:	8b 45 14             	mov    0x14(%ebp),%eax
+  80182b:	8d 78 04             	lea    0x4(%eax),%edi
+  80182e:	83 ec 08             	sub    $0x8,%esp
+  801831:	53                   	push   %ebx
+  801832:	ff 30                	push   (%eax)
+  801834:	ff d6                	call   *%esi
+			break;
+  801836:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  801839:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80183c:	e9 7c 02 00 00       	jmp    801abd <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  801841:	8b 45 14             	mov    0x14(%ebp),%eax
+  801844:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  801847:	8b 10                	mov    (%eax),%edx
+  801849:	89 d0                	mov    %edx,%eax
+  80184b:	f7 d8                	neg    %eax
+  80184d:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  801850:	83 f8 10             	cmp    $0x10,%eax
+  801853:	7f 23                	jg     801878 <vprintfmt+0x15c>
+  801855:	8b 14 85 20 29 80 00 	mov    0x802920(,%eax,4),%edx
+  80185c:	85 d2                	test   %edx,%edx
+  80185e:	74 18                	je     801878 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  801860:	52                   	push   %edx
+  801861:	68 e1 25 80 00       	push   $0x8025e1
+  801866:	53                   	push   %ebx
+  801867:	56                   	push   %esi
+  801868:	e8 92 fe ff ff       	call   8016ff <printfmt>
+  80186d:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801870:	89 7d 14             	mov    %edi,0x14(%ebp)
+  801873:	e9 45 02 00 00       	jmp    801abd <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  801878:	50                   	push   %eax
+  801879:	68 9b 26 80 00       	push   $0x80269b
+  80187e:	53                   	push   %ebx
+  80187f:	56                   	push   %esi
+  801880:	e8 7a fe ff ff       	call   8016ff <printfmt>
+  801885:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801888:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80188b:	e9 2d 02 00 00       	jmp    801abd <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801890:	8b 45 14             	mov    0x14(%ebp),%eax
+  801893:	83 c0 04             	add    $0x4,%eax
+  801896:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  801899:	8b 45 14             	mov    0x14(%ebp),%eax
+  80189c:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80189e:	85 c9                	test   %ecx,%ecx
+  8018a0:	b8 94 26 80 00       	mov    $0x802694,%eax
+  8018a5:	0f 45 c1             	cmovne %ecx,%eax
+  8018a8:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8018ab:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8018af:	7e 06                	jle    8018b7 <vprintfmt+0x19b>
+  8018b1:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8018b5:	75 0b                	jne    8018c2 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8018b7:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8018ba:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8018bd:	89 75 08             	mov    %esi,0x8(%ebp)
+  8018c0:	eb 5c                	jmp    80191e <vprintfmt+0x202>
+  8018c2:	83 ec 08             	sub    $0x8,%esp
+  8018c5:	ff 75 d0             	push   -0x30(%ebp)
+  8018c8:	ff 75 cc             	push   -0x34(%ebp)
+  8018cb:	e8 eb 02 00 00       	call   801bbb <strnlen>
+  8018d0:	89 c2                	mov    %eax,%edx
+  8018d2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8018d5:	29 d0                	sub    %edx,%eax
+  8018d7:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8018da:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8018de:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8018e1:	89 75 08             	mov    %esi,0x8(%ebp)
+  8018e4:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8018e6:	eb 0e                	jmp    8018f6 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8018e8:	83 ec 08             	sub    $0x8,%esp
+  8018eb:	53                   	push   %ebx
+  8018ec:	57                   	push   %edi
+  8018ed:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8018f0:	83 ee 01             	sub    $0x1,%esi
+  8018f3:	83 c4 10             	add    $0x10,%esp
+  8018f6:	85 f6                	test   %esi,%esi
+  8018f8:	7f ee                	jg     8018e8 <vprintfmt+0x1cc>
+  8018fa:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8018fd:	8b 75 08             	mov    0x8(%ebp),%esi
+  801900:	85 c0                	test   %eax,%eax
+  801902:	ba 00 00 00 00       	mov    $0x0,%edx
+  801907:	0f 49 d0             	cmovns %eax,%edx
+  80190a:	29 d0                	sub    %edx,%eax
+  80190c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80190f:	eb a6                	jmp    8018b7 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  801911:	83 ec 08             	sub    $0x8,%esp
+  801914:	53                   	push   %ebx
+  801915:	52                   	push   %edx
+  801916:	ff 55 08             	call   *0x8(%ebp)
+  801919:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80191c:	89 f1                	mov    %esi,%ecx
+  80191e:	8d 71 01             	lea    0x1(%ecx),%esi
+  801921:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  801925:	0f be d0             	movsbl %al,%edx
+  801928:	85 d2                	test   %edx,%edx
+  80192a:	74 28                	je     801954 <vprintfmt+0x238>
+  80192c:	85 ff                	test   %edi,%edi
+  80192e:	78 05                	js     801935 <vprintfmt+0x219>
+  801930:	83 ef 01             	sub    $0x1,%edi
+  801933:	78 30                	js     801965 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  801935:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  801939:	74 d6                	je     801911 <vprintfmt+0x1f5>
+  80193b:	0f be c0             	movsbl %al,%eax
+  80193e:	83 e8 20             	sub    $0x20,%eax
+  801941:	83 f8 5e             	cmp    $0x5e,%eax
+  801944:	76 cb                	jbe    801911 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  801946:	83 ec 08             	sub    $0x8,%esp
+  801949:	53                   	push   %ebx
+  80194a:	6a 3f                	push   $0x3f
+  80194c:	ff 55 08             	call   *0x8(%ebp)
+  80194f:	83 c4 10             	add    $0x10,%esp
+  801952:	eb c8                	jmp    80191c <vprintfmt+0x200>
+  801954:	8b 75 08             	mov    0x8(%ebp),%esi
+  801957:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80195a:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80195d:	01 d0                	add    %edx,%eax
+  80195f:	29 c8                	sub    %ecx,%eax
+  801961:	89 c7                	mov    %eax,%edi
+  801963:	eb 13                	jmp    801978 <vprintfmt+0x25c>
+  801965:	8b 75 08             	mov    0x8(%ebp),%esi
+  801968:	eb ed                	jmp    801957 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80196a:	83 ec 08             	sub    $0x8,%esp
+  80196d:	53                   	push   %ebx
+  80196e:	6a 20                	push   $0x20
+  801970:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  801972:	83 ef 01             	sub    $0x1,%edi
+  801975:	83 c4 10             	add    $0x10,%esp
+  801978:	85 ff                	test   %edi,%edi
+  80197a:	7f ee                	jg     80196a <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80197c:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80197f:	89 45 14             	mov    %eax,0x14(%ebp)
+  801982:	e9 36 01 00 00       	jmp    801abd <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  801987:	83 f9 01             	cmp    $0x1,%ecx
+  80198a:	7f 1f                	jg     8019ab <vprintfmt+0x28f>
+	else if (lflag)
+  80198c:	85 c9                	test   %ecx,%ecx
+  80198e:	74 67                	je     8019f7 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  801990:	8b 45 14             	mov    0x14(%ebp),%eax
+  801993:	8b 00                	mov    (%eax),%eax
+  801995:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801998:	89 c1                	mov    %eax,%ecx
+  80199a:	c1 f9 1f             	sar    $0x1f,%ecx
+  80199d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8019a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019a3:	8d 40 04             	lea    0x4(%eax),%eax
+  8019a6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8019a9:	eb 17                	jmp    8019c2 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8019ab:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019ae:	8b 50 04             	mov    0x4(%eax),%edx
+  8019b1:	8b 00                	mov    (%eax),%eax
+  8019b3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8019b6:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8019b9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019bc:	8d 40 08             	lea    0x8(%eax),%eax
+  8019bf:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8019c2:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8019c5:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8019c8:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8019cd:	85 c9                	test   %ecx,%ecx
+  8019cf:	0f 89 ce 00 00 00    	jns    801aa3 <vprintfmt+0x387>
+				putch('-', putdat);
+  8019d5:	83 ec 08             	sub    $0x8,%esp
+  8019d8:	53                   	push   %ebx
+  8019d9:	6a 2d                	push   $0x2d
+  8019db:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8019dd:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8019e0:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8019e3:	f7 da                	neg    %edx
+  8019e5:	83 d1 00             	adc    $0x0,%ecx
+  8019e8:	f7 d9                	neg    %ecx
+  8019ea:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8019ed:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8019f2:	e9 ac 00 00 00       	jmp    801aa3 <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  8019f7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019fa:	8b 00                	mov    (%eax),%eax
+  8019fc:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8019ff:	89 c1                	mov    %eax,%ecx
+  801a01:	c1 f9 1f             	sar    $0x1f,%ecx
+  801a04:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801a07:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a0a:	8d 40 04             	lea    0x4(%eax),%eax
+  801a0d:	89 45 14             	mov    %eax,0x14(%ebp)
+  801a10:	eb b0                	jmp    8019c2 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  801a12:	83 f9 01             	cmp    $0x1,%ecx
+  801a15:	7f 1b                	jg     801a32 <vprintfmt+0x316>
+	else if (lflag)
+  801a17:	85 c9                	test   %ecx,%ecx
+  801a19:	74 2c                	je     801a47 <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  801a1b:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a1e:	8b 10                	mov    (%eax),%edx
+  801a20:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a25:	8d 40 04             	lea    0x4(%eax),%eax
+  801a28:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801a2b:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  801a30:	eb 71                	jmp    801aa3 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  801a32:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a35:	8b 10                	mov    (%eax),%edx
+  801a37:	8b 48 04             	mov    0x4(%eax),%ecx
+  801a3a:	8d 40 08             	lea    0x8(%eax),%eax
+  801a3d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801a40:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  801a45:	eb 5c                	jmp    801aa3 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  801a47:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a4a:	8b 10                	mov    (%eax),%edx
+  801a4c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a51:	8d 40 04             	lea    0x4(%eax),%eax
+  801a54:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801a57:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  801a5c:	eb 45                	jmp    801aa3 <vprintfmt+0x387>
+			putch('X', putdat);
+  801a5e:	83 ec 08             	sub    $0x8,%esp
+  801a61:	53                   	push   %ebx
+  801a62:	6a 58                	push   $0x58
+  801a64:	ff d6                	call   *%esi
+			putch('X', putdat);
+  801a66:	83 c4 08             	add    $0x8,%esp
+  801a69:	53                   	push   %ebx
+  801a6a:	6a 58                	push   $0x58
+  801a6c:	ff d6                	call   *%esi
+			putch('X', putdat);
+  801a6e:	83 c4 08             	add    $0x8,%esp
+  801a71:	53                   	push   %ebx
+  801a72:	6a 58                	push   $0x58
+  801a74:	ff d6                	call   *%esi
+			break;
+  801a76:	83 c4 10             	add    $0x10,%esp
+  801a79:	eb 42                	jmp    801abd <vprintfmt+0x3a1>
+			putch('0', putdat);
+  801a7b:	83 ec 08             	sub    $0x8,%esp
+  801a7e:	53                   	push   %ebx
+  801a7f:	6a 30                	push   $0x30
+  801a81:	ff d6                	call   *%esi
+			putch('x', putdat);
+  801a83:	83 c4 08             	add    $0x8,%esp
+  801a86:	53                   	push   %ebx
+  801a87:	6a 78                	push   $0x78
+  801a89:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  801a8b:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a8e:	8b 10                	mov    (%eax),%edx
+  801a90:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  801a95:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  801a98:	8d 40 04             	lea    0x4(%eax),%eax
+  801a9b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801a9e:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  801aa3:	83 ec 0c             	sub    $0xc,%esp
+  801aa6:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  801aaa:	50                   	push   %eax
+  801aab:	ff 75 e0             	push   -0x20(%ebp)
+  801aae:	57                   	push   %edi
+  801aaf:	51                   	push   %ecx
+  801ab0:	52                   	push   %edx
+  801ab1:	89 da                	mov    %ebx,%edx
+  801ab3:	89 f0                	mov    %esi,%eax
+  801ab5:	e8 7f fb ff ff       	call   801639 <printnum>
+			break;
+  801aba:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  801abd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801ac0:	e9 75 fc ff ff       	jmp    80173a <vprintfmt+0x1e>
+	if (lflag >= 2)
+  801ac5:	83 f9 01             	cmp    $0x1,%ecx
+  801ac8:	7f 1b                	jg     801ae5 <vprintfmt+0x3c9>
+	else if (lflag)
+  801aca:	85 c9                	test   %ecx,%ecx
+  801acc:	74 2c                	je     801afa <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  801ace:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ad1:	8b 10                	mov    (%eax),%edx
+  801ad3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ad8:	8d 40 04             	lea    0x4(%eax),%eax
+  801adb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801ade:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  801ae3:	eb be                	jmp    801aa3 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  801ae5:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ae8:	8b 10                	mov    (%eax),%edx
+  801aea:	8b 48 04             	mov    0x4(%eax),%ecx
+  801aed:	8d 40 08             	lea    0x8(%eax),%eax
+  801af0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801af3:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  801af8:	eb a9                	jmp    801aa3 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  801afa:	8b 45 14             	mov    0x14(%ebp),%eax
+  801afd:	8b 10                	mov    (%eax),%edx
+  801aff:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b04:	8d 40 04             	lea    0x4(%eax),%eax
+  801b07:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801b0a:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  801b0f:	eb 92                	jmp    801aa3 <vprintfmt+0x387>
+			putch(ch, putdat);
+  801b11:	83 ec 08             	sub    $0x8,%esp
+  801b14:	53                   	push   %ebx
+  801b15:	6a 25                	push   $0x25
+  801b17:	ff d6                	call   *%esi
+			break;
+  801b19:	83 c4 10             	add    $0x10,%esp
+  801b1c:	eb 9f                	jmp    801abd <vprintfmt+0x3a1>
+			putch('%', putdat);
+  801b1e:	83 ec 08             	sub    $0x8,%esp
+  801b21:	53                   	push   %ebx
+  801b22:	6a 25                	push   $0x25
+  801b24:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801b26:	83 c4 10             	add    $0x10,%esp
+  801b29:	89 f8                	mov    %edi,%eax
+  801b2b:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  801b2f:	74 05                	je     801b36 <vprintfmt+0x41a>
+  801b31:	83 e8 01             	sub    $0x1,%eax
+  801b34:	eb f5                	jmp    801b2b <vprintfmt+0x40f>
+  801b36:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801b39:	eb 82                	jmp    801abd <vprintfmt+0x3a1>
+
+00801b3b <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  801b3b:	55                   	push   %ebp
+  801b3c:	89 e5                	mov    %esp,%ebp
+  801b3e:	83 ec 18             	sub    $0x18,%esp
+  801b41:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b44:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  801b47:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  801b4a:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  801b4e:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  801b51:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  801b58:	85 c0                	test   %eax,%eax
+  801b5a:	74 26                	je     801b82 <vsnprintf+0x47>
+  801b5c:	85 d2                	test   %edx,%edx
+  801b5e:	7e 22                	jle    801b82 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  801b60:	ff 75 14             	push   0x14(%ebp)
+  801b63:	ff 75 10             	push   0x10(%ebp)
+  801b66:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  801b69:	50                   	push   %eax
+  801b6a:	68 e2 16 80 00       	push   $0x8016e2
+  801b6f:	e8 a8 fb ff ff       	call   80171c <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  801b74:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801b77:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  801b7a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b7d:	83 c4 10             	add    $0x10,%esp
+}
+  801b80:	c9                   	leave
+  801b81:	c3                   	ret
+		return -E_INVAL;
+  801b82:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b87:	eb f7                	jmp    801b80 <vsnprintf+0x45>
+
+00801b89 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801b89:	55                   	push   %ebp
+  801b8a:	89 e5                	mov    %esp,%ebp
+  801b8c:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  801b8f:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  801b92:	50                   	push   %eax
+  801b93:	ff 75 10             	push   0x10(%ebp)
+  801b96:	ff 75 0c             	push   0xc(%ebp)
+  801b99:	ff 75 08             	push   0x8(%ebp)
+  801b9c:	e8 9a ff ff ff       	call   801b3b <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  801ba1:	c9                   	leave
+  801ba2:	c3                   	ret
+
+00801ba3 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  801ba3:	55                   	push   %ebp
+  801ba4:	89 e5                	mov    %esp,%ebp
+  801ba6:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  801ba9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bae:	eb 03                	jmp    801bb3 <strlen+0x10>
+		n++;
+  801bb0:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  801bb3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  801bb7:	75 f7                	jne    801bb0 <strlen+0xd>
+	return n;
+}
+  801bb9:	5d                   	pop    %ebp
+  801bba:	c3                   	ret
+
+00801bbb <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  801bbb:	55                   	push   %ebp
+  801bbc:	89 e5                	mov    %esp,%ebp
+  801bbe:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801bc1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801bc4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bc9:	eb 03                	jmp    801bce <strnlen+0x13>
+		n++;
+  801bcb:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801bce:	39 d0                	cmp    %edx,%eax
+  801bd0:	74 08                	je     801bda <strnlen+0x1f>
+  801bd2:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  801bd6:	75 f3                	jne    801bcb <strnlen+0x10>
+  801bd8:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  801bda:	89 d0                	mov    %edx,%eax
+  801bdc:	5d                   	pop    %ebp
+  801bdd:	c3                   	ret
+
+00801bde <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801bde:	55                   	push   %ebp
+  801bdf:	89 e5                	mov    %esp,%ebp
+  801be1:	53                   	push   %ebx
+  801be2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801be5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  801be8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bed:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  801bf1:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  801bf4:	83 c0 01             	add    $0x1,%eax
+  801bf7:	84 d2                	test   %dl,%dl
+  801bf9:	75 f2                	jne    801bed <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  801bfb:	89 c8                	mov    %ecx,%eax
+  801bfd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c00:	c9                   	leave
+  801c01:	c3                   	ret
+
+00801c02 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801c02:	55                   	push   %ebp
+  801c03:	89 e5                	mov    %esp,%ebp
+  801c05:	53                   	push   %ebx
+  801c06:	83 ec 10             	sub    $0x10,%esp
+  801c09:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  801c0c:	53                   	push   %ebx
+  801c0d:	e8 91 ff ff ff       	call   801ba3 <strlen>
+  801c12:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  801c15:	ff 75 0c             	push   0xc(%ebp)
+  801c18:	01 d8                	add    %ebx,%eax
+  801c1a:	50                   	push   %eax
+  801c1b:	e8 be ff ff ff       	call   801bde <strcpy>
+	return dst;
+}
+  801c20:	89 d8                	mov    %ebx,%eax
+  801c22:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c25:	c9                   	leave
+  801c26:	c3                   	ret
+
+00801c27 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801c27:	55                   	push   %ebp
+  801c28:	89 e5                	mov    %esp,%ebp
+  801c2a:	56                   	push   %esi
+  801c2b:	53                   	push   %ebx
+  801c2c:	8b 75 08             	mov    0x8(%ebp),%esi
+  801c2f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  801c32:	89 f3                	mov    %esi,%ebx
+  801c34:	03 5d 10             	add    0x10(%ebp),%ebx
+  801c37:	89 f0                	mov    %esi,%eax
+  801c39:	eb 0f                	jmp    801c4a <strncpy+0x23>
+		*dst++ = *src;
+  801c3b:	83 c0 01             	add    $0x1,%eax
+  801c3e:	0f b6 0a             	movzbl (%edx),%ecx
+  801c41:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  801c44:	80 f9 01             	cmp    $0x1,%cl
+  801c47:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  801c4a:	39 d8                	cmp    %ebx,%eax
+  801c4c:	75 ed                	jne    801c3b <strncpy+0x14>
+	}
+	return ret;
+}
+  801c4e:	89 f0                	mov    %esi,%eax
+  801c50:	5b                   	pop    %ebx
+  801c51:	5e                   	pop    %esi
+  801c52:	5d                   	pop    %ebp
+  801c53:	c3                   	ret
+
+00801c54 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801c54:	55                   	push   %ebp
+  801c55:	89 e5                	mov    %esp,%ebp
+  801c57:	56                   	push   %esi
+  801c58:	53                   	push   %ebx
+  801c59:	8b 75 08             	mov    0x8(%ebp),%esi
+  801c5c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c5f:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  801c62:	89 f0                	mov    %esi,%eax
+  801c64:	85 d2                	test   %edx,%edx
+  801c66:	74 21                	je     801c89 <strlcpy+0x35>
+  801c68:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  801c6c:	89 f2                	mov    %esi,%edx
+  801c6e:	eb 09                	jmp    801c79 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  801c70:	83 c1 01             	add    $0x1,%ecx
+  801c73:	83 c2 01             	add    $0x1,%edx
+  801c76:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  801c79:	39 c2                	cmp    %eax,%edx
+  801c7b:	74 09                	je     801c86 <strlcpy+0x32>
+  801c7d:	0f b6 19             	movzbl (%ecx),%ebx
+  801c80:	84 db                	test   %bl,%bl
+  801c82:	75 ec                	jne    801c70 <strlcpy+0x1c>
+  801c84:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  801c86:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  801c89:	29 f0                	sub    %esi,%eax
+}
+  801c8b:	5b                   	pop    %ebx
+  801c8c:	5e                   	pop    %esi
+  801c8d:	5d                   	pop    %ebp
+  801c8e:	c3                   	ret
+
+00801c8f <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  801c8f:	55                   	push   %ebp
+  801c90:	89 e5                	mov    %esp,%ebp
+  801c92:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801c95:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  801c98:	eb 06                	jmp    801ca0 <strcmp+0x11>
+		p++, q++;
+  801c9a:	83 c1 01             	add    $0x1,%ecx
+  801c9d:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  801ca0:	0f b6 01             	movzbl (%ecx),%eax
+  801ca3:	84 c0                	test   %al,%al
+  801ca5:	74 04                	je     801cab <strcmp+0x1c>
+  801ca7:	3a 02                	cmp    (%edx),%al
+  801ca9:	74 ef                	je     801c9a <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801cab:	0f b6 c0             	movzbl %al,%eax
+  801cae:	0f b6 12             	movzbl (%edx),%edx
+  801cb1:	29 d0                	sub    %edx,%eax
+}
+  801cb3:	5d                   	pop    %ebp
+  801cb4:	c3                   	ret
+
+00801cb5 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801cb5:	55                   	push   %ebp
+  801cb6:	89 e5                	mov    %esp,%ebp
+  801cb8:	53                   	push   %ebx
+  801cb9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cbc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801cbf:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  801cc2:	eb 09                	jmp    801ccd <strncmp+0x18>
+		n--, p++, q++;
+  801cc4:	83 ea 01             	sub    $0x1,%edx
+  801cc7:	83 c0 01             	add    $0x1,%eax
+  801cca:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  801ccd:	85 d2                	test   %edx,%edx
+  801ccf:	74 18                	je     801ce9 <strncmp+0x34>
+  801cd1:	0f b6 18             	movzbl (%eax),%ebx
+  801cd4:	84 db                	test   %bl,%bl
+  801cd6:	74 04                	je     801cdc <strncmp+0x27>
+  801cd8:	3a 19                	cmp    (%ecx),%bl
+  801cda:	74 e8                	je     801cc4 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801cdc:	0f b6 00             	movzbl (%eax),%eax
+  801cdf:	0f b6 11             	movzbl (%ecx),%edx
+  801ce2:	29 d0                	sub    %edx,%eax
+}
+  801ce4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ce7:	c9                   	leave
+  801ce8:	c3                   	ret
+		return 0;
+  801ce9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cee:	eb f4                	jmp    801ce4 <strncmp+0x2f>
+
+00801cf0 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801cf0:	55                   	push   %ebp
+  801cf1:	89 e5                	mov    %esp,%ebp
+  801cf3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cf6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801cfa:	eb 03                	jmp    801cff <strchr+0xf>
+  801cfc:	83 c0 01             	add    $0x1,%eax
+  801cff:	0f b6 10             	movzbl (%eax),%edx
+  801d02:	84 d2                	test   %dl,%dl
+  801d04:	74 06                	je     801d0c <strchr+0x1c>
+		if (*s == c)
+  801d06:	38 ca                	cmp    %cl,%dl
+  801d08:	75 f2                	jne    801cfc <strchr+0xc>
+  801d0a:	eb 05                	jmp    801d11 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  801d0c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d11:	5d                   	pop    %ebp
+  801d12:	c3                   	ret
+
+00801d13 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801d13:	55                   	push   %ebp
+  801d14:	89 e5                	mov    %esp,%ebp
+  801d16:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d19:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801d1d:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  801d20:	38 ca                	cmp    %cl,%dl
+  801d22:	74 09                	je     801d2d <strfind+0x1a>
+  801d24:	84 d2                	test   %dl,%dl
+  801d26:	74 05                	je     801d2d <strfind+0x1a>
+	for (; *s; s++)
+  801d28:	83 c0 01             	add    $0x1,%eax
+  801d2b:	eb f0                	jmp    801d1d <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  801d2d:	5d                   	pop    %ebp
+  801d2e:	c3                   	ret
+
+00801d2f <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801d2f:	55                   	push   %ebp
+  801d30:	89 e5                	mov    %esp,%ebp
+  801d32:	57                   	push   %edi
+  801d33:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801d36:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  801d39:	85 c9                	test   %ecx,%ecx
+  801d3b:	74 20                	je     801d5d <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  801d3d:	89 f8                	mov    %edi,%eax
+  801d3f:	09 c8                	or     %ecx,%eax
+  801d41:	a8 03                	test   $0x3,%al
+  801d43:	75 12                	jne    801d57 <memset+0x28>
+		c &= 0xFF;
+  801d45:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  801d49:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  801d4f:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  801d52:	fc                   	cld
+  801d53:	f3 ab                	rep stos %eax,%es:(%edi)
+  801d55:	eb 06                	jmp    801d5d <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801d57:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d5a:	fc                   	cld
+  801d5b:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  801d5d:	89 f8                	mov    %edi,%eax
+  801d5f:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  801d62:	c9                   	leave
+  801d63:	c3                   	ret
+
+00801d64 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801d64:	55                   	push   %ebp
+  801d65:	89 e5                	mov    %esp,%ebp
+  801d67:	57                   	push   %edi
+  801d68:	56                   	push   %esi
+  801d69:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d6c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801d6f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  801d72:	39 c6                	cmp    %eax,%esi
+  801d74:	73 32                	jae    801da8 <memmove+0x44>
+  801d76:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  801d79:	39 d0                	cmp    %edx,%eax
+  801d7b:	73 2b                	jae    801da8 <memmove+0x44>
+		s += n;
+		d += n;
+  801d7d:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801d80:	89 d6                	mov    %edx,%esi
+  801d82:	09 fe                	or     %edi,%esi
+  801d84:	09 ce                	or     %ecx,%esi
+  801d86:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  801d8c:	75 0e                	jne    801d9c <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801d8e:	83 ef 04             	sub    $0x4,%edi
+  801d91:	8d 72 fc             	lea    -0x4(%edx),%esi
+  801d94:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  801d97:	fd                   	std
+  801d98:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801d9a:	eb 09                	jmp    801da5 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801d9c:	83 ef 01             	sub    $0x1,%edi
+  801d9f:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  801da2:	fd                   	std
+  801da3:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801da5:	fc                   	cld
+  801da6:	eb 1a                	jmp    801dc2 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801da8:	89 f2                	mov    %esi,%edx
+  801daa:	09 c2                	or     %eax,%edx
+  801dac:	09 ca                	or     %ecx,%edx
+  801dae:	f6 c2 03             	test   $0x3,%dl
+  801db1:	75 0a                	jne    801dbd <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801db3:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  801db6:	89 c7                	mov    %eax,%edi
+  801db8:	fc                   	cld
+  801db9:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801dbb:	eb 05                	jmp    801dc2 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  801dbd:	89 c7                	mov    %eax,%edi
+  801dbf:	fc                   	cld
+  801dc0:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  801dc2:	5e                   	pop    %esi
+  801dc3:	5f                   	pop    %edi
+  801dc4:	5d                   	pop    %ebp
+  801dc5:	c3                   	ret
+
+00801dc6 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801dc6:	55                   	push   %ebp
+  801dc7:	89 e5                	mov    %esp,%ebp
+  801dc9:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  801dcc:	ff 75 10             	push   0x10(%ebp)
+  801dcf:	ff 75 0c             	push   0xc(%ebp)
+  801dd2:	ff 75 08             	push   0x8(%ebp)
+  801dd5:	e8 8a ff ff ff       	call   801d64 <memmove>
+}
+  801dda:	c9                   	leave
+  801ddb:	c3                   	ret
+
+00801ddc <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801ddc:	55                   	push   %ebp
+  801ddd:	89 e5                	mov    %esp,%ebp
+  801ddf:	56                   	push   %esi
+  801de0:	53                   	push   %ebx
+  801de1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801de4:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  801de7:	89 c6                	mov    %eax,%esi
+  801de9:	03 75 10             	add    0x10(%ebp),%esi
+  801dec:	eb 06                	jmp    801df4 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  801dee:	83 c0 01             	add    $0x1,%eax
+  801df1:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  801df4:	39 f0                	cmp    %esi,%eax
+  801df6:	74 14                	je     801e0c <memcmp+0x30>
+		if (*s1 != *s2)
+  801df8:	0f b6 08             	movzbl (%eax),%ecx
+  801dfb:	0f b6 1a             	movzbl (%edx),%ebx
+  801dfe:	38 d9                	cmp    %bl,%cl
+  801e00:	74 ec                	je     801dee <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  801e02:	0f b6 c1             	movzbl %cl,%eax
+  801e05:	0f b6 db             	movzbl %bl,%ebx
+  801e08:	29 d8                	sub    %ebx,%eax
+  801e0a:	eb 05                	jmp    801e11 <memcmp+0x35>
+	}
+
+	return 0;
+  801e0c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e11:	5b                   	pop    %ebx
+  801e12:	5e                   	pop    %esi
+  801e13:	5d                   	pop    %ebp
+  801e14:	c3                   	ret
+
+00801e15 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801e15:	55                   	push   %ebp
+  801e16:	89 e5                	mov    %esp,%ebp
+  801e18:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e1b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  801e1e:	89 c2                	mov    %eax,%edx
+  801e20:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  801e23:	eb 03                	jmp    801e28 <memfind+0x13>
+  801e25:	83 c0 01             	add    $0x1,%eax
+  801e28:	39 d0                	cmp    %edx,%eax
+  801e2a:	73 04                	jae    801e30 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801e2c:	38 08                	cmp    %cl,(%eax)
+  801e2e:	75 f5                	jne    801e25 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  801e30:	5d                   	pop    %ebp
+  801e31:	c3                   	ret
+
+00801e32 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  801e32:	55                   	push   %ebp
+  801e33:	89 e5                	mov    %esp,%ebp
+  801e35:	57                   	push   %edi
+  801e36:	56                   	push   %esi
+  801e37:	53                   	push   %ebx
+  801e38:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e3b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801e3e:	eb 03                	jmp    801e43 <strtol+0x11>
+		s++;
+  801e40:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  801e43:	0f b6 02             	movzbl (%edx),%eax
+  801e46:	3c 20                	cmp    $0x20,%al
+  801e48:	74 f6                	je     801e40 <strtol+0xe>
+  801e4a:	3c 09                	cmp    $0x9,%al
+  801e4c:	74 f2                	je     801e40 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  801e4e:	3c 2b                	cmp    $0x2b,%al
+  801e50:	74 2a                	je     801e7c <strtol+0x4a>
+	int neg = 0;
+  801e52:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  801e57:	3c 2d                	cmp    $0x2d,%al
+  801e59:	74 2b                	je     801e86 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801e5b:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  801e61:	75 0f                	jne    801e72 <strtol+0x40>
+  801e63:	80 3a 30             	cmpb   $0x30,(%edx)
+  801e66:	74 28                	je     801e90 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  801e68:	85 db                	test   %ebx,%ebx
+  801e6a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801e6f:	0f 44 d8             	cmove  %eax,%ebx
+  801e72:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e77:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  801e7a:	eb 46                	jmp    801ec2 <strtol+0x90>
+		s++;
+  801e7c:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  801e7f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e84:	eb d5                	jmp    801e5b <strtol+0x29>
+		s++, neg = 1;
+  801e86:	83 c2 01             	add    $0x1,%edx
+  801e89:	bf 01 00 00 00       	mov    $0x1,%edi
+  801e8e:	eb cb                	jmp    801e5b <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801e90:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  801e94:	74 0e                	je     801ea4 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  801e96:	85 db                	test   %ebx,%ebx
+  801e98:	75 d8                	jne    801e72 <strtol+0x40>
+		s++, base = 8;
+  801e9a:	83 c2 01             	add    $0x1,%edx
+  801e9d:	bb 08 00 00 00       	mov    $0x8,%ebx
+  801ea2:	eb ce                	jmp    801e72 <strtol+0x40>
+		s += 2, base = 16;
+  801ea4:	83 c2 02             	add    $0x2,%edx
+  801ea7:	bb 10 00 00 00       	mov    $0x10,%ebx
+  801eac:	eb c4                	jmp    801e72 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  801eae:	0f be c0             	movsbl %al,%eax
+  801eb1:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  801eb4:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801eb7:	7d 3a                	jge    801ef3 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  801eb9:	83 c2 01             	add    $0x1,%edx
+  801ebc:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  801ec0:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  801ec2:	0f b6 02             	movzbl (%edx),%eax
+  801ec5:	8d 70 d0             	lea    -0x30(%eax),%esi
+  801ec8:	89 f3                	mov    %esi,%ebx
+  801eca:	80 fb 09             	cmp    $0x9,%bl
+  801ecd:	76 df                	jbe    801eae <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  801ecf:	8d 70 9f             	lea    -0x61(%eax),%esi
+  801ed2:	89 f3                	mov    %esi,%ebx
+  801ed4:	80 fb 19             	cmp    $0x19,%bl
+  801ed7:	77 08                	ja     801ee1 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  801ed9:	0f be c0             	movsbl %al,%eax
+  801edc:	83 e8 57             	sub    $0x57,%eax
+  801edf:	eb d3                	jmp    801eb4 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  801ee1:	8d 70 bf             	lea    -0x41(%eax),%esi
+  801ee4:	89 f3                	mov    %esi,%ebx
+  801ee6:	80 fb 19             	cmp    $0x19,%bl
+  801ee9:	77 08                	ja     801ef3 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  801eeb:	0f be c0             	movsbl %al,%eax
+  801eee:	83 e8 37             	sub    $0x37,%eax
+  801ef1:	eb c1                	jmp    801eb4 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801ef3:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  801ef7:	74 05                	je     801efe <strtol+0xcc>
+		*endptr = (char *) s;
+  801ef9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801efc:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  801efe:	89 c8                	mov    %ecx,%eax
+  801f00:	f7 d8                	neg    %eax
+  801f02:	85 ff                	test   %edi,%edi
+  801f04:	0f 45 c8             	cmovne %eax,%ecx
+}
+  801f07:	89 c8                	mov    %ecx,%eax
+  801f09:	5b                   	pop    %ebx
+  801f0a:	5e                   	pop    %esi
+  801f0b:	5f                   	pop    %edi
+  801f0c:	5d                   	pop    %ebp
+  801f0d:	c3                   	ret
+
+00801f0e <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  801f0e:	55                   	push   %ebp
+  801f0f:	89 e5                	mov    %esp,%ebp
+  801f11:	56                   	push   %esi
+  801f12:	53                   	push   %ebx
+  801f13:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f16:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f19:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  801f1c:	85 c0                	test   %eax,%eax
+  801f1e:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801f23:	0f 44 c2             	cmove  %edx,%eax
+  801f26:	83 ec 0c             	sub    $0xc,%esp
+  801f29:	50                   	push   %eax
+  801f2a:	e8 e7 e3 ff ff       	call   800316 <sys_ipc_recv>
+
+  if (from_env_store)
+  801f2f:	83 c4 10             	add    $0x10,%esp
+  801f32:	85 f6                	test   %esi,%esi
+  801f34:	74 17                	je     801f4d <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  801f36:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f3b:	85 c0                	test   %eax,%eax
+  801f3d:	75 0c                	jne    801f4b <ipc_recv+0x3d>
+  801f3f:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801f45:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  801f4b:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  801f4d:	85 db                	test   %ebx,%ebx
+  801f4f:	74 2b                	je     801f7c <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  801f51:	85 c0                	test   %eax,%eax
+  801f53:	74 0d                	je     801f62 <ipc_recv+0x54>
+  801f55:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  801f5b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f5e:	5b                   	pop    %ebx
+  801f5f:	5e                   	pop    %esi
+  801f60:	5d                   	pop    %ebp
+  801f61:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  801f62:	a1 08 40 80 00       	mov    0x804008,%eax
+  801f67:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  801f6d:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  801f6f:	a1 08 40 80 00       	mov    0x804008,%eax
+  801f74:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  801f7a:	eb df                	jmp    801f5b <ipc_recv+0x4d>
+  801f7c:	85 c0                	test   %eax,%eax
+  801f7e:	75 db                	jne    801f5b <ipc_recv+0x4d>
+  801f80:	eb ed                	jmp    801f6f <ipc_recv+0x61>
+
+00801f82 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  801f82:	55                   	push   %ebp
+  801f83:	89 e5                	mov    %esp,%ebp
+  801f85:	57                   	push   %edi
+  801f86:	56                   	push   %esi
+  801f87:	53                   	push   %ebx
+  801f88:	83 ec 0c             	sub    $0xc,%esp
+  801f8b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801f8e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801f91:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  801f94:	85 db                	test   %ebx,%ebx
+  801f96:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801f9b:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  801f9e:	ff 75 14             	push   0x14(%ebp)
+  801fa1:	53                   	push   %ebx
+  801fa2:	56                   	push   %esi
+  801fa3:	57                   	push   %edi
+  801fa4:	e8 4a e3 ff ff       	call   8002f3 <sys_ipc_try_send>
+  801fa9:	83 c4 10             	add    $0x10,%esp
+  801fac:	85 c0                	test   %eax,%eax
+  801fae:	74 1e                	je     801fce <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  801fb0:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801fb3:	75 07                	jne    801fbc <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  801fb5:	e8 8d e1 ff ff       	call   800147 <sys_yield>
+  801fba:	eb e2                	jmp    801f9e <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  801fbc:	50                   	push   %eax
+  801fbd:	68 83 29 80 00       	push   $0x802983
+  801fc2:	6a 3c                	push   $0x3c
+  801fc4:	68 90 29 80 00       	push   $0x802990
+  801fc9:	e8 7c f5 ff ff       	call   80154a <_panic>
+  }
+
+#endif
+}
+  801fce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fd1:	5b                   	pop    %ebx
+  801fd2:	5e                   	pop    %esi
+  801fd3:	5f                   	pop    %edi
+  801fd4:	5d                   	pop    %ebp
+  801fd5:	c3                   	ret
+
+00801fd6 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  801fd6:	55                   	push   %ebp
+  801fd7:	89 e5                	mov    %esp,%ebp
+  801fd9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  801fdc:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  801fe1:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  801fe4:	c1 e0 04             	shl    $0x4,%eax
+  801fe7:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801fec:	8b 40 50             	mov    0x50(%eax),%eax
+  801fef:	39 c8                	cmp    %ecx,%eax
+  801ff1:	74 12                	je     802005 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  801ff3:	83 c2 01             	add    $0x1,%edx
+  801ff6:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  801ffc:	75 e3                	jne    801fe1 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  801ffe:	b8 00 00 00 00       	mov    $0x0,%eax
+  802003:	eb 0e                	jmp    802013 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  802005:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802008:	c1 e0 04             	shl    $0x4,%eax
+  80200b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802010:	8b 40 48             	mov    0x48(%eax),%eax
+  802013:	5d                   	pop    %ebp
+  802014:	c3                   	ret
+
+00802015 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802015:	55                   	push   %ebp
+  802016:	89 e5                	mov    %esp,%ebp
+  802018:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80201b:	89 c2                	mov    %eax,%edx
+  80201d:	c1 ea 16             	shr    $0x16,%edx
+  802020:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802027:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80202c:	f6 c1 01             	test   $0x1,%cl
+  80202f:	74 1c                	je     80204d <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  802031:	c1 e8 0c             	shr    $0xc,%eax
+  802034:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80203b:	a8 01                	test   $0x1,%al
+  80203d:	74 0e                	je     80204d <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80203f:	c1 e8 0c             	shr    $0xc,%eax
+  802042:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802049:	ef 
+  80204a:	0f b7 d2             	movzwl %dx,%edx
+}
+  80204d:	89 d0                	mov    %edx,%eax
+  80204f:	5d                   	pop    %ebp
+  802050:	c3                   	ret
+  802051:	66 90                	xchg   %ax,%ax
+  802053:	66 90                	xchg   %ax,%ax
+  802055:	66 90                	xchg   %ax,%ax
+  802057:	66 90                	xchg   %ax,%ax
+  802059:	66 90                	xchg   %ax,%ax
+  80205b:	66 90                	xchg   %ax,%ax
+  80205d:	66 90                	xchg   %ax,%ax
+  80205f:	90                   	nop
+
+00802060 <__udivmoddi4>:
+  802060:	55                   	push   %ebp
+  802061:	57                   	push   %edi
+  802062:	56                   	push   %esi
+  802063:	53                   	push   %ebx
+  802064:	83 ec 24             	sub    $0x24,%esp
+  802067:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80206b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80206f:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  802073:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802077:	8b 54 24 44          	mov    0x44(%esp),%edx
+  80207b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80207f:	8b 44 24 40          	mov    0x40(%esp),%eax
+  802083:	89 d3                	mov    %edx,%ebx
+  802085:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802089:	09 c3                	or     %eax,%ebx
+  80208b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80208f:	0f 84 9c 00 00 00    	je     802131 <__udivmoddi4+0xd1>
+  802095:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80209c:	00 
+  80209d:	31 c0                	xor    %eax,%eax
+  80209f:	31 d2                	xor    %edx,%edx
+  8020a1:	89 fb                	mov    %edi,%ebx
+  8020a3:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8020aa:	00 
+  8020ab:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8020b0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8020b4:	01 c0                	add    %eax,%eax
+  8020b6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8020bd:	00 
+  8020be:	89 c6                	mov    %eax,%esi
+  8020c0:	89 d7                	mov    %edx,%edi
+  8020c2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8020c6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8020ca:	0f ad d0             	shrd   %cl,%edx,%eax
+  8020cd:	d3 ea                	shr    %cl,%edx
+  8020cf:	f6 c1 20             	test   $0x20,%cl
+  8020d2:	0f 45 c2             	cmovne %edx,%eax
+  8020d5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8020d9:	83 e0 01             	and    $0x1,%eax
+  8020dc:	09 fa                	or     %edi,%edx
+  8020de:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8020e2:	89 04 24             	mov    %eax,(%esp)
+  8020e5:	8b 04 24             	mov    (%esp),%eax
+  8020e8:	89 d5                	mov    %edx,%ebp
+  8020ea:	09 f0                	or     %esi,%eax
+  8020ec:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8020f0:	39 f0                	cmp    %esi,%eax
+  8020f2:	19 fd                	sbb    %edi,%ebp
+  8020f4:	72 1d                	jb     802113 <__udivmoddi4+0xb3>
+  8020f6:	29 f0                	sub    %esi,%eax
+  8020f8:	19 fa                	sbb    %edi,%edx
+  8020fa:	89 cf                	mov    %ecx,%edi
+  8020fc:	c1 ef 05             	shr    $0x5,%edi
+  8020ff:	83 e7 01             	and    $0x1,%edi
+  802102:	89 fe                	mov    %edi,%esi
+  802104:	d3 e7                	shl    %cl,%edi
+  802106:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80210a:	83 f6 01             	xor    $0x1,%esi
+  80210d:	d3 e6                	shl    %cl,%esi
+  80210f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802113:	83 e9 01             	sub    $0x1,%ecx
+  802116:	73 98                	jae    8020b0 <__udivmoddi4+0x50>
+  802118:	85 db                	test   %ebx,%ebx
+  80211a:	74 05                	je     802121 <__udivmoddi4+0xc1>
+  80211c:	89 03                	mov    %eax,(%ebx)
+  80211e:	89 53 04             	mov    %edx,0x4(%ebx)
+  802121:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802125:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802129:	83 c4 24             	add    $0x24,%esp
+  80212c:	5b                   	pop    %ebx
+  80212d:	5e                   	pop    %esi
+  80212e:	5f                   	pop    %edi
+  80212f:	5d                   	pop    %ebp
+  802130:	c3                   	ret
+  802131:	85 ff                	test   %edi,%edi
+  802133:	74 0d                	je     802142 <__udivmoddi4+0xe2>
+  802135:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  80213b:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  802142:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802146:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80214a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80214e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802152:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802156:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80215a:	83 c4 24             	add    $0x24,%esp
+  80215d:	5b                   	pop    %ebx
+  80215e:	5e                   	pop    %esi
+  80215f:	5f                   	pop    %edi
+  802160:	5d                   	pop    %ebp
+  802161:	c3                   	ret
+  802162:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802169:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00802170 <__udivdi3>:
+  802170:	57                   	push   %edi
+  802171:	56                   	push   %esi
+  802172:	53                   	push   %ebx
+  802173:	83 ec 20             	sub    $0x20,%esp
+  802176:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80217a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80217e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802182:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802186:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80218a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80218e:	89 d1                	mov    %edx,%ecx
+  802190:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802194:	09 c1                	or     %eax,%ecx
+  802196:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80219a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80219e:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  8021a2:	0f 84 88 00 00 00    	je     802230 <__udivdi3+0xc0>
+  8021a8:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8021af:	00 
+  8021b0:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8021b5:	31 c0                	xor    %eax,%eax
+  8021b7:	31 d2                	xor    %edx,%edx
+  8021b9:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8021c0:	00 
+  8021c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8021c8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8021cc:	01 c0                	add    %eax,%eax
+  8021ce:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8021d5:	00 
+  8021d6:	89 c6                	mov    %eax,%esi
+  8021d8:	89 d7                	mov    %edx,%edi
+  8021da:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8021de:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8021e2:	0f ad d0             	shrd   %cl,%edx,%eax
+  8021e5:	d3 ea                	shr    %cl,%edx
+  8021e7:	f6 c1 20             	test   $0x20,%cl
+  8021ea:	0f 45 c2             	cmovne %edx,%eax
+  8021ed:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8021f1:	83 e0 01             	and    $0x1,%eax
+  8021f4:	09 fa                	or     %edi,%edx
+  8021f6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8021fa:	89 04 24             	mov    %eax,(%esp)
+  8021fd:	8b 04 24             	mov    (%esp),%eax
+  802200:	89 d3                	mov    %edx,%ebx
+  802202:	09 f0                	or     %esi,%eax
+  802204:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802208:	39 f0                	cmp    %esi,%eax
+  80220a:	19 fb                	sbb    %edi,%ebx
+  80220c:	72 1d                	jb     80222b <__udivdi3+0xbb>
+  80220e:	29 f0                	sub    %esi,%eax
+  802210:	19 fa                	sbb    %edi,%edx
+  802212:	89 cf                	mov    %ecx,%edi
+  802214:	c1 ef 05             	shr    $0x5,%edi
+  802217:	83 e7 01             	and    $0x1,%edi
+  80221a:	89 fe                	mov    %edi,%esi
+  80221c:	d3 e7                	shl    %cl,%edi
+  80221e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802222:	83 f6 01             	xor    $0x1,%esi
+  802225:	d3 e6                	shl    %cl,%esi
+  802227:	09 74 24 18          	or     %esi,0x18(%esp)
+  80222b:	83 e9 01             	sub    $0x1,%ecx
+  80222e:	73 98                	jae    8021c8 <__udivdi3+0x58>
+  802230:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802234:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802238:	83 c4 20             	add    $0x20,%esp
+  80223b:	5b                   	pop    %ebx
+  80223c:	5e                   	pop    %esi
+  80223d:	5f                   	pop    %edi
+  80223e:	c3                   	ret
+  80223f:	90                   	nop
+
+00802240 <__umoddi3>:
+  802240:	57                   	push   %edi
+  802241:	56                   	push   %esi
+  802242:	53                   	push   %ebx
+  802243:	83 ec 18             	sub    $0x18,%esp
+  802246:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80224a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80224e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802252:	8b 54 24 34          	mov    0x34(%esp),%edx
+  802256:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80225a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80225e:	89 d1                	mov    %edx,%ecx
+  802260:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802264:	09 c1                	or     %eax,%ecx
+  802266:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80226a:	74 5b                	je     8022c7 <__umoddi3+0x87>
+  80226c:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802271:	31 c0                	xor    %eax,%eax
+  802273:	31 d2                	xor    %edx,%edx
+  802275:	8d 76 00             	lea    0x0(%esi),%esi
+  802278:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80227c:	01 c0                	add    %eax,%eax
+  80227e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802285:	00 
+  802286:	89 c6                	mov    %eax,%esi
+  802288:	89 d7                	mov    %edx,%edi
+  80228a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80228e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802292:	0f ad d0             	shrd   %cl,%edx,%eax
+  802295:	d3 ea                	shr    %cl,%edx
+  802297:	f6 c1 20             	test   $0x20,%cl
+  80229a:	0f 45 c2             	cmovne %edx,%eax
+  80229d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8022a1:	83 e0 01             	and    $0x1,%eax
+  8022a4:	09 fa                	or     %edi,%edx
+  8022a6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8022aa:	89 04 24             	mov    %eax,(%esp)
+  8022ad:	8b 04 24             	mov    (%esp),%eax
+  8022b0:	89 d3                	mov    %edx,%ebx
+  8022b2:	09 f0                	or     %esi,%eax
+  8022b4:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8022b8:	39 f0                	cmp    %esi,%eax
+  8022ba:	19 fb                	sbb    %edi,%ebx
+  8022bc:	72 04                	jb     8022c2 <__umoddi3+0x82>
+  8022be:	29 f0                	sub    %esi,%eax
+  8022c0:	19 fa                	sbb    %edi,%edx
+  8022c2:	83 e9 01             	sub    $0x1,%ecx
+  8022c5:	73 b1                	jae    802278 <__umoddi3+0x38>
+  8022c7:	83 c4 18             	add    $0x18,%esp
+  8022ca:	5b                   	pop    %ebx
+  8022cb:	5e                   	pop    %esi
+  8022cc:	5f                   	pop    %edi
+  8022cd:	c3                   	ret
+  8022ce:	66 90                	xchg   %ax,%ax
+
+008022d0 <__divdi3>:
+  8022d0:	55                   	push   %ebp
+  8022d1:	57                   	push   %edi
+  8022d2:	56                   	push   %esi
+  8022d3:	53                   	push   %ebx
+  8022d4:	83 ec 24             	sub    $0x24,%esp
+  8022d7:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  8022db:	8b 74 24 44          	mov    0x44(%esp),%esi
+  8022df:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8022e3:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8022e7:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  8022eb:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8022ef:	85 d2                	test   %edx,%edx
+  8022f1:	0f 88 e0 00 00 00    	js     8023d7 <__divdi3+0x107>
+  8022f7:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  8022fb:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  8022ff:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802303:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802307:	85 f6                	test   %esi,%esi
+  802309:	78 16                	js     802321 <__divdi3+0x51>
+  80230b:	89 f1                	mov    %esi,%ecx
+  80230d:	31 c0                	xor    %eax,%eax
+  80230f:	31 d2                	xor    %edx,%edx
+  802311:	09 d9                	or     %ebx,%ecx
+  802313:	0f 85 f3 00 00 00    	jne    80240c <__divdi3+0x13c>
+  802319:	83 c4 24             	add    $0x24,%esp
+  80231c:	5b                   	pop    %ebx
+  80231d:	5e                   	pop    %esi
+  80231e:	5f                   	pop    %edi
+  80231f:	5d                   	pop    %ebp
+  802320:	c3                   	ret
+  802321:	bf 01 00 00 00       	mov    $0x1,%edi
+  802326:	f7 5c 24 08          	negl   0x8(%esp)
+  80232a:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  80232f:	f7 5c 24 0c          	negl   0xc(%esp)
+  802333:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80233a:	00 
+  80233b:	31 c0                	xor    %eax,%eax
+  80233d:	31 d2                	xor    %edx,%edx
+  80233f:	89 fb                	mov    %edi,%ebx
+  802341:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802348:	00 
+  802349:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80234e:	66 90                	xchg   %ax,%ax
+  802350:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802354:	01 c0                	add    %eax,%eax
+  802356:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80235d:	00 
+  80235e:	89 c6                	mov    %eax,%esi
+  802360:	89 d7                	mov    %edx,%edi
+  802362:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802366:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80236a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80236d:	d3 ea                	shr    %cl,%edx
+  80236f:	f6 c1 20             	test   $0x20,%cl
+  802372:	0f 45 c2             	cmovne %edx,%eax
+  802375:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802379:	83 e0 01             	and    $0x1,%eax
+  80237c:	09 fa                	or     %edi,%edx
+  80237e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802382:	89 04 24             	mov    %eax,(%esp)
+  802385:	8b 04 24             	mov    (%esp),%eax
+  802388:	89 d5                	mov    %edx,%ebp
+  80238a:	09 f0                	or     %esi,%eax
+  80238c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802390:	39 f0                	cmp    %esi,%eax
+  802392:	19 fd                	sbb    %edi,%ebp
+  802394:	72 1d                	jb     8023b3 <__divdi3+0xe3>
+  802396:	29 f0                	sub    %esi,%eax
+  802398:	19 fa                	sbb    %edi,%edx
+  80239a:	89 cf                	mov    %ecx,%edi
+  80239c:	c1 ef 05             	shr    $0x5,%edi
+  80239f:	83 e7 01             	and    $0x1,%edi
+  8023a2:	89 fe                	mov    %edi,%esi
+  8023a4:	d3 e7                	shl    %cl,%edi
+  8023a6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8023aa:	83 f6 01             	xor    $0x1,%esi
+  8023ad:	d3 e6                	shl    %cl,%esi
+  8023af:	09 74 24 18          	or     %esi,0x18(%esp)
+  8023b3:	83 e9 01             	sub    $0x1,%ecx
+  8023b6:	73 98                	jae    802350 <__divdi3+0x80>
+  8023b8:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8023bc:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8023c0:	85 db                	test   %ebx,%ebx
+  8023c2:	0f 84 51 ff ff ff    	je     802319 <__divdi3+0x49>
+  8023c8:	f7 d8                	neg    %eax
+  8023ca:	83 d2 00             	adc    $0x0,%edx
+  8023cd:	83 c4 24             	add    $0x24,%esp
+  8023d0:	5b                   	pop    %ebx
+  8023d1:	f7 da                	neg    %edx
+  8023d3:	5e                   	pop    %esi
+  8023d4:	5f                   	pop    %edi
+  8023d5:	5d                   	pop    %ebp
+  8023d6:	c3                   	ret
+  8023d7:	f7 d8                	neg    %eax
+  8023d9:	83 d2 00             	adc    $0x0,%edx
+  8023dc:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8023e0:	f7 da                	neg    %edx
+  8023e2:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8023e6:	85 f6                	test   %esi,%esi
+  8023e8:	78 1b                	js     802405 <__divdi3+0x135>
+  8023ea:	89 f1                	mov    %esi,%ecx
+  8023ec:	31 c0                	xor    %eax,%eax
+  8023ee:	31 d2                	xor    %edx,%edx
+  8023f0:	bf 01 00 00 00       	mov    $0x1,%edi
+  8023f5:	09 d9                	or     %ebx,%ecx
+  8023f7:	0f 85 36 ff ff ff    	jne    802333 <__divdi3+0x63>
+  8023fd:	83 c4 24             	add    $0x24,%esp
+  802400:	5b                   	pop    %ebx
+  802401:	5e                   	pop    %esi
+  802402:	5f                   	pop    %edi
+  802403:	5d                   	pop    %ebp
+  802404:	c3                   	ret
+  802405:	31 ff                	xor    %edi,%edi
+  802407:	e9 1a ff ff ff       	jmp    802326 <__divdi3+0x56>
+  80240c:	31 ff                	xor    %edi,%edi
+  80240e:	e9 20 ff ff ff       	jmp    802333 <__divdi3+0x63>
+  802413:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80241a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00802420 <__moddi3>:
+  802420:	55                   	push   %ebp
+  802421:	57                   	push   %edi
+  802422:	56                   	push   %esi
+  802423:	53                   	push   %ebx
+  802424:	83 ec 1c             	sub    $0x1c,%esp
+  802427:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  80242b:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  80242f:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  802433:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  802437:	89 c8                	mov    %ecx,%eax
+  802439:	89 f2                	mov    %esi,%edx
+  80243b:	89 f3                	mov    %esi,%ebx
+  80243d:	85 ed                	test   %ebp,%ebp
+  80243f:	0f 88 9d 00 00 00    	js     8024e2 <__moddi3+0xc2>
+  802445:	09 cb                	or     %ecx,%ebx
+  802447:	0f 84 8d 00 00 00    	je     8024da <__moddi3+0xba>
+  80244d:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802451:	31 db                	xor    %ebx,%ebx
+  802453:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802457:	89 ca                	mov    %ecx,%edx
+  802459:	89 f0                	mov    %esi,%eax
+  80245b:	89 dd                	mov    %ebx,%ebp
+  80245d:	f7 da                	neg    %edx
+  80245f:	83 d0 00             	adc    $0x0,%eax
+  802462:	f7 d8                	neg    %eax
+  802464:	0f 49 f0             	cmovns %eax,%esi
+  802467:	0f 49 ca             	cmovns %edx,%ecx
+  80246a:	31 c0                	xor    %eax,%eax
+  80246c:	31 d2                	xor    %edx,%edx
+  80246e:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802472:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802476:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80247b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80247f:	90                   	nop
+  802480:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802484:	01 c0                	add    %eax,%eax
+  802486:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80248d:	00 
+  80248e:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  802492:	89 c6                	mov    %eax,%esi
+  802494:	89 d7                	mov    %edx,%edi
+  802496:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80249a:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80249e:	0f ad d0             	shrd   %cl,%edx,%eax
+  8024a1:	d3 ea                	shr    %cl,%edx
+  8024a3:	f6 c1 20             	test   $0x20,%cl
+  8024a6:	0f 45 c2             	cmovne %edx,%eax
+  8024a9:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8024ad:	83 e0 01             	and    $0x1,%eax
+  8024b0:	09 fa                	or     %edi,%edx
+  8024b2:	89 04 24             	mov    %eax,(%esp)
+  8024b5:	8b 04 24             	mov    (%esp),%eax
+  8024b8:	89 d7                	mov    %edx,%edi
+  8024ba:	09 f0                	or     %esi,%eax
+  8024bc:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  8024c0:	39 d8                	cmp    %ebx,%eax
+  8024c2:	19 f7                	sbb    %esi,%edi
+  8024c4:	72 04                	jb     8024ca <__moddi3+0xaa>
+  8024c6:	29 d8                	sub    %ebx,%eax
+  8024c8:	19 f2                	sbb    %esi,%edx
+  8024ca:	83 e9 01             	sub    $0x1,%ecx
+  8024cd:	73 b1                	jae    802480 <__moddi3+0x60>
+  8024cf:	85 ed                	test   %ebp,%ebp
+  8024d1:	74 07                	je     8024da <__moddi3+0xba>
+  8024d3:	f7 d8                	neg    %eax
+  8024d5:	83 d2 00             	adc    $0x0,%edx
+  8024d8:	f7 da                	neg    %edx
+  8024da:	83 c4 1c             	add    $0x1c,%esp
+  8024dd:	5b                   	pop    %ebx
+  8024de:	5e                   	pop    %esi
+  8024df:	5f                   	pop    %edi
+  8024e0:	5d                   	pop    %ebp
+  8024e1:	c3                   	ret
+  8024e2:	09 cb                	or     %ecx,%ebx
+  8024e4:	74 f4                	je     8024da <__moddi3+0xba>
+  8024e6:	f7 df                	neg    %edi
+  8024e8:	bb 01 00 00 00       	mov    $0x1,%ebx
+  8024ed:	83 d5 00             	adc    $0x0,%ebp
+  8024f0:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  8024f4:	f7 dd                	neg    %ebp
+  8024f6:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  8024fa:	e9 58 ff ff ff       	jmp    802457 <__moddi3+0x37>
@@ -0,0 +1,5258 @@
+
+obj/user/buggyhello2.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 1d 00 00 00       	call   80004e <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+const char *hello = "hello, world\n";
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	sys_cputs(hello, 1024*1024);
+  800039:	68 00 00 10 00       	push   $0x100000
+  80003e:	ff 35 00 30 80 00    	push   0x803000
+  800044:	e8 68 00 00 00       	call   8000b1 <sys_cputs>
+}
+  800049:	83 c4 10             	add    $0x10,%esp
+  80004c:	c9                   	leave
+  80004d:	c3                   	ret
+
+0080004e <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  80004e:	55                   	push   %ebp
+  80004f:	89 e5                	mov    %esp,%ebp
+  800051:	56                   	push   %esi
+  800052:	53                   	push   %ebx
+  800053:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800056:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  800059:	e8 d1 00 00 00       	call   80012f <sys_getenvid>
+  80005e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800063:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800066:	c1 e0 04             	shl    $0x4,%eax
+  800069:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80006e:	a3 08 40 80 00       	mov    %eax,0x804008
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800073:	85 db                	test   %ebx,%ebx
+  800075:	7e 07                	jle    80007e <libmain+0x30>
+    binaryname = argv[0];
+  800077:	8b 06                	mov    (%esi),%eax
+  800079:	a3 04 30 80 00       	mov    %eax,0x803004
+
+  // call user main routine
+  umain(argc, argv);
+  80007e:	83 ec 08             	sub    $0x8,%esp
+  800081:	56                   	push   %esi
+  800082:	53                   	push   %ebx
+  800083:	e8 ab ff ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  800088:	e8 0a 00 00 00       	call   800097 <exit>
+}
+  80008d:	83 c4 10             	add    $0x10,%esp
+  800090:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800093:	5b                   	pop    %ebx
+  800094:	5e                   	pop    %esi
+  800095:	5d                   	pop    %ebp
+  800096:	c3                   	ret
+
+00800097 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800097:	55                   	push   %ebp
+  800098:	89 e5                	mov    %esp,%ebp
+  80009a:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80009d:	e8 72 05 00 00       	call   800614 <close_all>
+	sys_env_destroy(0);
+  8000a2:	83 ec 0c             	sub    $0xc,%esp
+  8000a5:	6a 00                	push   $0x0
+  8000a7:	e8 42 00 00 00       	call   8000ee <sys_env_destroy>
+}
+  8000ac:	83 c4 10             	add    $0x10,%esp
+  8000af:	c9                   	leave
+  8000b0:	c3                   	ret
+
+008000b1 <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8000b1:	55                   	push   %ebp
+  8000b2:	89 e5                	mov    %esp,%ebp
+  8000b4:	57                   	push   %edi
+  8000b5:	56                   	push   %esi
+  8000b6:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8000b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000bf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000c2:	89 c3                	mov    %eax,%ebx
+  8000c4:	89 c7                	mov    %eax,%edi
+  8000c6:	89 c6                	mov    %eax,%esi
+  8000c8:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  8000ca:	5b                   	pop    %ebx
+  8000cb:	5e                   	pop    %esi
+  8000cc:	5f                   	pop    %edi
+  8000cd:	5d                   	pop    %ebp
+  8000ce:	c3                   	ret
+
+008000cf <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8000cf:	55                   	push   %ebp
+  8000d0:	89 e5                	mov    %esp,%ebp
+  8000d2:	57                   	push   %edi
+  8000d3:	56                   	push   %esi
+  8000d4:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8000d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000da:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000df:	89 d1                	mov    %edx,%ecx
+  8000e1:	89 d3                	mov    %edx,%ebx
+  8000e3:	89 d7                	mov    %edx,%edi
+  8000e5:	89 d6                	mov    %edx,%esi
+  8000e7:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8000e9:	5b                   	pop    %ebx
+  8000ea:	5e                   	pop    %esi
+  8000eb:	5f                   	pop    %edi
+  8000ec:	5d                   	pop    %ebp
+  8000ed:	c3                   	ret
+
+008000ee <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8000ee:	55                   	push   %ebp
+  8000ef:	89 e5                	mov    %esp,%ebp
+  8000f1:	57                   	push   %edi
+  8000f2:	56                   	push   %esi
+  8000f3:	53                   	push   %ebx
+  8000f4:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8000f7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000fc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000ff:	b8 03 00 00 00       	mov    $0x3,%eax
+  800104:	89 cb                	mov    %ecx,%ebx
+  800106:	89 cf                	mov    %ecx,%edi
+  800108:	89 ce                	mov    %ecx,%esi
+  80010a:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80010c:	85 c0                	test   %eax,%eax
+  80010e:	7f 08                	jg     800118 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800110:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800113:	5b                   	pop    %ebx
+  800114:	5e                   	pop    %esi
+  800115:	5f                   	pop    %edi
+  800116:	5d                   	pop    %ebp
+  800117:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800118:	83 ec 0c             	sub    $0xc,%esp
+  80011b:	50                   	push   %eax
+  80011c:	6a 03                	push   $0x3
+  80011e:	68 18 25 80 00       	push   $0x802518
+  800123:	6a 3e                	push   $0x3e
+  800125:	68 35 25 80 00       	push   $0x802535
+  80012a:	e8 22 14 00 00       	call   801551 <_panic>
+
+0080012f <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80012f:	55                   	push   %ebp
+  800130:	89 e5                	mov    %esp,%ebp
+  800132:	57                   	push   %edi
+  800133:	56                   	push   %esi
+  800134:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800135:	ba 00 00 00 00       	mov    $0x0,%edx
+  80013a:	b8 02 00 00 00       	mov    $0x2,%eax
+  80013f:	89 d1                	mov    %edx,%ecx
+  800141:	89 d3                	mov    %edx,%ebx
+  800143:	89 d7                	mov    %edx,%edi
+  800145:	89 d6                	mov    %edx,%esi
+  800147:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800149:	5b                   	pop    %ebx
+  80014a:	5e                   	pop    %esi
+  80014b:	5f                   	pop    %edi
+  80014c:	5d                   	pop    %ebp
+  80014d:	c3                   	ret
+
+0080014e <sys_yield>:
+
+void
+sys_yield(void) {
+  80014e:	55                   	push   %ebp
+  80014f:	89 e5                	mov    %esp,%ebp
+  800151:	57                   	push   %edi
+  800152:	56                   	push   %esi
+  800153:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800154:	ba 00 00 00 00       	mov    $0x0,%edx
+  800159:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80015e:	89 d1                	mov    %edx,%ecx
+  800160:	89 d3                	mov    %edx,%ebx
+  800162:	89 d7                	mov    %edx,%edi
+  800164:	89 d6                	mov    %edx,%esi
+  800166:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800168:	5b                   	pop    %ebx
+  800169:	5e                   	pop    %esi
+  80016a:	5f                   	pop    %edi
+  80016b:	5d                   	pop    %ebp
+  80016c:	c3                   	ret
+
+0080016d <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  80016d:	55                   	push   %ebp
+  80016e:	89 e5                	mov    %esp,%ebp
+  800170:	57                   	push   %edi
+  800171:	56                   	push   %esi
+  800172:	53                   	push   %ebx
+  800173:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800176:	be 00 00 00 00       	mov    $0x0,%esi
+  80017b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80017e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800181:	b8 04 00 00 00       	mov    $0x4,%eax
+  800186:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800189:	89 f7                	mov    %esi,%edi
+  80018b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80018d:	85 c0                	test   %eax,%eax
+  80018f:	7f 08                	jg     800199 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800191:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800194:	5b                   	pop    %ebx
+  800195:	5e                   	pop    %esi
+  800196:	5f                   	pop    %edi
+  800197:	5d                   	pop    %ebp
+  800198:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800199:	83 ec 0c             	sub    $0xc,%esp
+  80019c:	50                   	push   %eax
+  80019d:	6a 04                	push   $0x4
+  80019f:	68 18 25 80 00       	push   $0x802518
+  8001a4:	6a 3e                	push   $0x3e
+  8001a6:	68 35 25 80 00       	push   $0x802535
+  8001ab:	e8 a1 13 00 00       	call   801551 <_panic>
+
+008001b0 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  8001b0:	55                   	push   %ebp
+  8001b1:	89 e5                	mov    %esp,%ebp
+  8001b3:	57                   	push   %edi
+  8001b4:	56                   	push   %esi
+  8001b5:	53                   	push   %ebx
+  8001b6:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8001b9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001bc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001bf:	b8 05 00 00 00       	mov    $0x5,%eax
+  8001c4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001c7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8001ca:	8b 75 18             	mov    0x18(%ebp),%esi
+  8001cd:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8001cf:	85 c0                	test   %eax,%eax
+  8001d1:	7f 08                	jg     8001db <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  8001d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001d6:	5b                   	pop    %ebx
+  8001d7:	5e                   	pop    %esi
+  8001d8:	5f                   	pop    %edi
+  8001d9:	5d                   	pop    %ebp
+  8001da:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8001db:	83 ec 0c             	sub    $0xc,%esp
+  8001de:	50                   	push   %eax
+  8001df:	6a 05                	push   $0x5
+  8001e1:	68 18 25 80 00       	push   $0x802518
+  8001e6:	6a 3e                	push   $0x3e
+  8001e8:	68 35 25 80 00       	push   $0x802535
+  8001ed:	e8 5f 13 00 00       	call   801551 <_panic>
+
+008001f2 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  8001f2:	55                   	push   %ebp
+  8001f3:	89 e5                	mov    %esp,%ebp
+  8001f5:	57                   	push   %edi
+  8001f6:	56                   	push   %esi
+  8001f7:	53                   	push   %ebx
+  8001f8:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8001fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800200:	8b 55 08             	mov    0x8(%ebp),%edx
+  800203:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800206:	b8 06 00 00 00       	mov    $0x6,%eax
+  80020b:	89 df                	mov    %ebx,%edi
+  80020d:	89 de                	mov    %ebx,%esi
+  80020f:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800211:	85 c0                	test   %eax,%eax
+  800213:	7f 08                	jg     80021d <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800215:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800218:	5b                   	pop    %ebx
+  800219:	5e                   	pop    %esi
+  80021a:	5f                   	pop    %edi
+  80021b:	5d                   	pop    %ebp
+  80021c:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80021d:	83 ec 0c             	sub    $0xc,%esp
+  800220:	50                   	push   %eax
+  800221:	6a 06                	push   $0x6
+  800223:	68 18 25 80 00       	push   $0x802518
+  800228:	6a 3e                	push   $0x3e
+  80022a:	68 35 25 80 00       	push   $0x802535
+  80022f:	e8 1d 13 00 00       	call   801551 <_panic>
+
+00800234 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800234:	55                   	push   %ebp
+  800235:	89 e5                	mov    %esp,%ebp
+  800237:	57                   	push   %edi
+  800238:	56                   	push   %esi
+  800239:	53                   	push   %ebx
+  80023a:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  80023d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800242:	8b 55 08             	mov    0x8(%ebp),%edx
+  800245:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800248:	b8 08 00 00 00       	mov    $0x8,%eax
+  80024d:	89 df                	mov    %ebx,%edi
+  80024f:	89 de                	mov    %ebx,%esi
+  800251:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800253:	85 c0                	test   %eax,%eax
+  800255:	7f 08                	jg     80025f <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800257:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80025a:	5b                   	pop    %ebx
+  80025b:	5e                   	pop    %esi
+  80025c:	5f                   	pop    %edi
+  80025d:	5d                   	pop    %ebp
+  80025e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80025f:	83 ec 0c             	sub    $0xc,%esp
+  800262:	50                   	push   %eax
+  800263:	6a 08                	push   $0x8
+  800265:	68 18 25 80 00       	push   $0x802518
+  80026a:	6a 3e                	push   $0x3e
+  80026c:	68 35 25 80 00       	push   $0x802535
+  800271:	e8 db 12 00 00       	call   801551 <_panic>
+
+00800276 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800276:	55                   	push   %ebp
+  800277:	89 e5                	mov    %esp,%ebp
+  800279:	57                   	push   %edi
+  80027a:	56                   	push   %esi
+  80027b:	53                   	push   %ebx
+  80027c:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  80027f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800284:	8b 55 08             	mov    0x8(%ebp),%edx
+  800287:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80028a:	b8 09 00 00 00       	mov    $0x9,%eax
+  80028f:	89 df                	mov    %ebx,%edi
+  800291:	89 de                	mov    %ebx,%esi
+  800293:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800295:	85 c0                	test   %eax,%eax
+  800297:	7f 08                	jg     8002a1 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800299:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80029c:	5b                   	pop    %ebx
+  80029d:	5e                   	pop    %esi
+  80029e:	5f                   	pop    %edi
+  80029f:	5d                   	pop    %ebp
+  8002a0:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8002a1:	83 ec 0c             	sub    $0xc,%esp
+  8002a4:	50                   	push   %eax
+  8002a5:	6a 09                	push   $0x9
+  8002a7:	68 18 25 80 00       	push   $0x802518
+  8002ac:	6a 3e                	push   $0x3e
+  8002ae:	68 35 25 80 00       	push   $0x802535
+  8002b3:	e8 99 12 00 00       	call   801551 <_panic>
+
+008002b8 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8002b8:	55                   	push   %ebp
+  8002b9:	89 e5                	mov    %esp,%ebp
+  8002bb:	57                   	push   %edi
+  8002bc:	56                   	push   %esi
+  8002bd:	53                   	push   %ebx
+  8002be:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8002c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002c6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002c9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002cc:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8002d1:	89 df                	mov    %ebx,%edi
+  8002d3:	89 de                	mov    %ebx,%esi
+  8002d5:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8002d7:	85 c0                	test   %eax,%eax
+  8002d9:	7f 08                	jg     8002e3 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8002db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002de:	5b                   	pop    %ebx
+  8002df:	5e                   	pop    %esi
+  8002e0:	5f                   	pop    %edi
+  8002e1:	5d                   	pop    %ebp
+  8002e2:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8002e3:	83 ec 0c             	sub    $0xc,%esp
+  8002e6:	50                   	push   %eax
+  8002e7:	6a 0a                	push   $0xa
+  8002e9:	68 18 25 80 00       	push   $0x802518
+  8002ee:	6a 3e                	push   $0x3e
+  8002f0:	68 35 25 80 00       	push   $0x802535
+  8002f5:	e8 57 12 00 00       	call   801551 <_panic>
+
+008002fa <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  8002fa:	55                   	push   %ebp
+  8002fb:	89 e5                	mov    %esp,%ebp
+  8002fd:	57                   	push   %edi
+  8002fe:	56                   	push   %esi
+  8002ff:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800300:	8b 55 08             	mov    0x8(%ebp),%edx
+  800303:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800306:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80030b:	be 00 00 00 00       	mov    $0x0,%esi
+  800310:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800313:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800316:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800318:	5b                   	pop    %ebx
+  800319:	5e                   	pop    %esi
+  80031a:	5f                   	pop    %edi
+  80031b:	5d                   	pop    %ebp
+  80031c:	c3                   	ret
+
+0080031d <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  80031d:	55                   	push   %ebp
+  80031e:	89 e5                	mov    %esp,%ebp
+  800320:	57                   	push   %edi
+  800321:	56                   	push   %esi
+  800322:	53                   	push   %ebx
+  800323:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800326:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80032b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80032e:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800333:	89 cb                	mov    %ecx,%ebx
+  800335:	89 cf                	mov    %ecx,%edi
+  800337:	89 ce                	mov    %ecx,%esi
+  800339:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80033b:	85 c0                	test   %eax,%eax
+  80033d:	7f 08                	jg     800347 <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  80033f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800342:	5b                   	pop    %ebx
+  800343:	5e                   	pop    %esi
+  800344:	5f                   	pop    %edi
+  800345:	5d                   	pop    %ebp
+  800346:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800347:	83 ec 0c             	sub    $0xc,%esp
+  80034a:	50                   	push   %eax
+  80034b:	6a 0d                	push   $0xd
+  80034d:	68 18 25 80 00       	push   $0x802518
+  800352:	6a 3e                	push   $0x3e
+  800354:	68 35 25 80 00       	push   $0x802535
+  800359:	e8 f3 11 00 00       	call   801551 <_panic>
+
+0080035e <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  80035e:	55                   	push   %ebp
+  80035f:	89 e5                	mov    %esp,%ebp
+  800361:	57                   	push   %edi
+  800362:	56                   	push   %esi
+  800363:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800364:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800369:	8b 55 08             	mov    0x8(%ebp),%edx
+  80036c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80036f:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800374:	89 df                	mov    %ebx,%edi
+  800376:	89 de                	mov    %ebx,%esi
+  800378:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  80037a:	5b                   	pop    %ebx
+  80037b:	5e                   	pop    %esi
+  80037c:	5f                   	pop    %edi
+  80037d:	5d                   	pop    %ebp
+  80037e:	c3                   	ret
+
+0080037f <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  80037f:	55                   	push   %ebp
+  800380:	89 e5                	mov    %esp,%ebp
+  800382:	57                   	push   %edi
+  800383:	56                   	push   %esi
+  800384:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800385:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80038a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80038d:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800392:	89 cb                	mov    %ecx,%ebx
+  800394:	89 cf                	mov    %ecx,%edi
+  800396:	89 ce                	mov    %ecx,%esi
+  800398:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  80039a:	5b                   	pop    %ebx
+  80039b:	5e                   	pop    %esi
+  80039c:	5f                   	pop    %edi
+  80039d:	5d                   	pop    %ebp
+  80039e:	c3                   	ret
+
+0080039f <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  80039f:	55                   	push   %ebp
+  8003a0:	89 e5                	mov    %esp,%ebp
+  8003a2:	57                   	push   %edi
+  8003a3:	56                   	push   %esi
+  8003a4:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8003a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003aa:	b8 10 00 00 00       	mov    $0x10,%eax
+  8003af:	89 d1                	mov    %edx,%ecx
+  8003b1:	89 d3                	mov    %edx,%ebx
+  8003b3:	89 d7                	mov    %edx,%edi
+  8003b5:	89 d6                	mov    %edx,%esi
+  8003b7:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8003b9:	5b                   	pop    %ebx
+  8003ba:	5e                   	pop    %esi
+  8003bb:	5f                   	pop    %edi
+  8003bc:	5d                   	pop    %ebp
+  8003bd:	c3                   	ret
+
+008003be <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  8003be:	55                   	push   %ebp
+  8003bf:	89 e5                	mov    %esp,%ebp
+  8003c1:	57                   	push   %edi
+  8003c2:	56                   	push   %esi
+  8003c3:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8003c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003c9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003cc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003cf:	b8 11 00 00 00       	mov    $0x11,%eax
+  8003d4:	89 df                	mov    %ebx,%edi
+  8003d6:	89 de                	mov    %ebx,%esi
+  8003d8:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  8003da:	5b                   	pop    %ebx
+  8003db:	5e                   	pop    %esi
+  8003dc:	5f                   	pop    %edi
+  8003dd:	5d                   	pop    %ebp
+  8003de:	c3                   	ret
+
+008003df <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  8003df:	55                   	push   %ebp
+  8003e0:	89 e5                	mov    %esp,%ebp
+  8003e2:	57                   	push   %edi
+  8003e3:	56                   	push   %esi
+  8003e4:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8003e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003ed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003f0:	b8 12 00 00 00       	mov    $0x12,%eax
+  8003f5:	89 df                	mov    %ebx,%edi
+  8003f7:	89 de                	mov    %ebx,%esi
+  8003f9:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  8003fb:	5b                   	pop    %ebx
+  8003fc:	5e                   	pop    %esi
+  8003fd:	5f                   	pop    %edi
+  8003fe:	5d                   	pop    %ebp
+  8003ff:	c3                   	ret
+
+00800400 <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  800400:	55                   	push   %ebp
+  800401:	89 e5                	mov    %esp,%ebp
+  800403:	57                   	push   %edi
+  800404:	56                   	push   %esi
+  800405:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800406:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80040b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80040e:	b8 13 00 00 00       	mov    $0x13,%eax
+  800413:	89 cb                	mov    %ecx,%ebx
+  800415:	89 cf                	mov    %ecx,%edi
+  800417:	89 ce                	mov    %ecx,%esi
+  800419:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  80041b:	5b                   	pop    %ebx
+  80041c:	5e                   	pop    %esi
+  80041d:	5f                   	pop    %edi
+  80041e:	5d                   	pop    %ebp
+  80041f:	c3                   	ret
+
+00800420 <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  800420:	55                   	push   %ebp
+  800421:	89 e5                	mov    %esp,%ebp
+  800423:	57                   	push   %edi
+  800424:	56                   	push   %esi
+  800425:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800426:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80042b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80042e:	b8 14 00 00 00       	mov    $0x14,%eax
+  800433:	89 cb                	mov    %ecx,%ebx
+  800435:	89 cf                	mov    %ecx,%edi
+  800437:	89 ce                	mov    %ecx,%esi
+  800439:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  80043b:	5b                   	pop    %ebx
+  80043c:	5e                   	pop    %esi
+  80043d:	5f                   	pop    %edi
+  80043e:	5d                   	pop    %ebp
+  80043f:	c3                   	ret
+
+00800440 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800440:	55                   	push   %ebp
+  800441:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800443:	8b 45 08             	mov    0x8(%ebp),%eax
+  800446:	05 00 00 00 30       	add    $0x30000000,%eax
+  80044b:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80044e:	5d                   	pop    %ebp
+  80044f:	c3                   	ret
+
+00800450 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800450:	55                   	push   %ebp
+  800451:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800453:	8b 45 08             	mov    0x8(%ebp),%eax
+  800456:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80045b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800460:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800465:	5d                   	pop    %ebp
+  800466:	c3                   	ret
+
+00800467 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800467:	55                   	push   %ebp
+  800468:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80046a:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80046f:	eb 02                	jmp    800473 <fd_alloc+0xc>
+  800471:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800473:	89 c2                	mov    %eax,%edx
+  800475:	c1 ea 16             	shr    $0x16,%edx
+  800478:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80047f:	f6 c2 01             	test   $0x1,%dl
+  800482:	74 2b                	je     8004af <fd_alloc+0x48>
+  800484:	89 c2                	mov    %eax,%edx
+  800486:	c1 ea 0c             	shr    $0xc,%edx
+  800489:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  800490:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  800496:	f6 c1 01             	test   $0x1,%cl
+  800499:	74 14                	je     8004af <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80049b:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8004a1:	75 ce                	jne    800471 <fd_alloc+0xa>
+  8004a3:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8004a8:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8004ad:	eb 05                	jmp    8004b4 <fd_alloc+0x4d>
+			return 0;
+  8004af:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8004b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004b7:	89 02                	mov    %eax,(%edx)
+}
+  8004b9:	89 c8                	mov    %ecx,%eax
+  8004bb:	5d                   	pop    %ebp
+  8004bc:	c3                   	ret
+
+008004bd <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8004bd:	55                   	push   %ebp
+  8004be:	89 e5                	mov    %esp,%ebp
+  8004c0:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8004c3:	83 f8 1f             	cmp    $0x1f,%eax
+  8004c6:	77 30                	ja     8004f8 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8004c8:	c1 e0 0c             	shl    $0xc,%eax
+  8004cb:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8004d0:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8004d6:	f6 c2 01             	test   $0x1,%dl
+  8004d9:	74 24                	je     8004ff <fd_lookup+0x42>
+  8004db:	89 c2                	mov    %eax,%edx
+  8004dd:	c1 ea 0c             	shr    $0xc,%edx
+  8004e0:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8004e7:	f6 c2 01             	test   $0x1,%dl
+  8004ea:	74 1a                	je     800506 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8004ec:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8004ef:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8004f1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8004f6:	5d                   	pop    %ebp
+  8004f7:	c3                   	ret
+		return -E_INVAL;
+  8004f8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8004fd:	eb f7                	jmp    8004f6 <fd_lookup+0x39>
+		return -E_INVAL;
+  8004ff:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800504:	eb f0                	jmp    8004f6 <fd_lookup+0x39>
+  800506:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80050b:	eb e9                	jmp    8004f6 <fd_lookup+0x39>
+
+0080050d <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80050d:	55                   	push   %ebp
+  80050e:	89 e5                	mov    %esp,%ebp
+  800510:	53                   	push   %ebx
+  800511:	83 ec 04             	sub    $0x4,%esp
+  800514:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  800517:	b8 00 00 00 00       	mov    $0x0,%eax
+  80051c:	eb 03                	jmp    800521 <dev_lookup+0x14>
+  80051e:	83 c0 01             	add    $0x1,%eax
+  800521:	8b 1c 85 c0 25 80 00 	mov    0x8025c0(,%eax,4),%ebx
+  800528:	85 db                	test   %ebx,%ebx
+  80052a:	74 0b                	je     800537 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  80052c:	39 13                	cmp    %edx,(%ebx)
+  80052e:	75 ee                	jne    80051e <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  800530:	b8 00 00 00 00       	mov    $0x0,%eax
+  800535:	eb 1f                	jmp    800556 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800537:	a1 08 40 80 00       	mov    0x804008,%eax
+  80053c:	8b 40 48             	mov    0x48(%eax),%eax
+  80053f:	83 ec 04             	sub    $0x4,%esp
+  800542:	52                   	push   %edx
+  800543:	50                   	push   %eax
+  800544:	68 44 25 80 00       	push   $0x802544
+  800549:	e8 de 10 00 00       	call   80162c <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80054e:	83 c4 10             	add    $0x10,%esp
+  800551:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  800556:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800559:	89 1a                	mov    %ebx,(%edx)
+}
+  80055b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80055e:	c9                   	leave
+  80055f:	c3                   	ret
+
+00800560 <fd_close>:
+{
+  800560:	55                   	push   %ebp
+  800561:	89 e5                	mov    %esp,%ebp
+  800563:	57                   	push   %edi
+  800564:	56                   	push   %esi
+  800565:	53                   	push   %ebx
+  800566:	83 ec 24             	sub    $0x24,%esp
+  800569:	8b 75 08             	mov    0x8(%ebp),%esi
+  80056c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80056f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800572:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800573:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800579:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80057c:	50                   	push   %eax
+  80057d:	e8 3b ff ff ff       	call   8004bd <fd_lookup>
+  800582:	89 c3                	mov    %eax,%ebx
+  800584:	83 c4 10             	add    $0x10,%esp
+  800587:	85 c0                	test   %eax,%eax
+  800589:	78 05                	js     800590 <fd_close+0x30>
+	    || fd != fd2)
+  80058b:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80058e:	74 16                	je     8005a6 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  800590:	89 f8                	mov    %edi,%eax
+  800592:	84 c0                	test   %al,%al
+  800594:	b8 00 00 00 00       	mov    $0x0,%eax
+  800599:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80059c:	89 d8                	mov    %ebx,%eax
+  80059e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005a1:	5b                   	pop    %ebx
+  8005a2:	5e                   	pop    %esi
+  8005a3:	5f                   	pop    %edi
+  8005a4:	5d                   	pop    %ebp
+  8005a5:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8005a6:	83 ec 08             	sub    $0x8,%esp
+  8005a9:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8005ac:	50                   	push   %eax
+  8005ad:	ff 36                	push   (%esi)
+  8005af:	e8 59 ff ff ff       	call   80050d <dev_lookup>
+  8005b4:	89 c3                	mov    %eax,%ebx
+  8005b6:	83 c4 10             	add    $0x10,%esp
+  8005b9:	85 c0                	test   %eax,%eax
+  8005bb:	78 1a                	js     8005d7 <fd_close+0x77>
+		if (dev->dev_close)
+  8005bd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005c0:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8005c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8005c8:	85 c0                	test   %eax,%eax
+  8005ca:	74 0b                	je     8005d7 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8005cc:	83 ec 0c             	sub    $0xc,%esp
+  8005cf:	56                   	push   %esi
+  8005d0:	ff d0                	call   *%eax
+  8005d2:	89 c3                	mov    %eax,%ebx
+  8005d4:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8005d7:	83 ec 08             	sub    $0x8,%esp
+  8005da:	56                   	push   %esi
+  8005db:	6a 00                	push   $0x0
+  8005dd:	e8 10 fc ff ff       	call   8001f2 <sys_page_unmap>
+	return r;
+  8005e2:	83 c4 10             	add    $0x10,%esp
+  8005e5:	eb b5                	jmp    80059c <fd_close+0x3c>
+
+008005e7 <close>:
+
+int
+close(int fdnum)
+{
+  8005e7:	55                   	push   %ebp
+  8005e8:	89 e5                	mov    %esp,%ebp
+  8005ea:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8005ed:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8005f0:	50                   	push   %eax
+  8005f1:	ff 75 08             	push   0x8(%ebp)
+  8005f4:	e8 c4 fe ff ff       	call   8004bd <fd_lookup>
+  8005f9:	83 c4 10             	add    $0x10,%esp
+  8005fc:	85 c0                	test   %eax,%eax
+  8005fe:	79 02                	jns    800602 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  800600:	c9                   	leave
+  800601:	c3                   	ret
+		return fd_close(fd, 1);
+  800602:	83 ec 08             	sub    $0x8,%esp
+  800605:	6a 01                	push   $0x1
+  800607:	ff 75 f4             	push   -0xc(%ebp)
+  80060a:	e8 51 ff ff ff       	call   800560 <fd_close>
+  80060f:	83 c4 10             	add    $0x10,%esp
+  800612:	eb ec                	jmp    800600 <close+0x19>
+
+00800614 <close_all>:
+
+void
+close_all(void)
+{
+  800614:	55                   	push   %ebp
+  800615:	89 e5                	mov    %esp,%ebp
+  800617:	53                   	push   %ebx
+  800618:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80061b:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  800620:	83 ec 0c             	sub    $0xc,%esp
+  800623:	53                   	push   %ebx
+  800624:	e8 be ff ff ff       	call   8005e7 <close>
+	for (i = 0; i < MAXFD; i++)
+  800629:	83 c3 01             	add    $0x1,%ebx
+  80062c:	83 c4 10             	add    $0x10,%esp
+  80062f:	83 fb 20             	cmp    $0x20,%ebx
+  800632:	75 ec                	jne    800620 <close_all+0xc>
+}
+  800634:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800637:	c9                   	leave
+  800638:	c3                   	ret
+
+00800639 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  800639:	55                   	push   %ebp
+  80063a:	89 e5                	mov    %esp,%ebp
+  80063c:	57                   	push   %edi
+  80063d:	56                   	push   %esi
+  80063e:	53                   	push   %ebx
+  80063f:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800642:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800645:	50                   	push   %eax
+  800646:	ff 75 08             	push   0x8(%ebp)
+  800649:	e8 6f fe ff ff       	call   8004bd <fd_lookup>
+  80064e:	89 c3                	mov    %eax,%ebx
+  800650:	83 c4 10             	add    $0x10,%esp
+  800653:	85 c0                	test   %eax,%eax
+  800655:	78 7f                	js     8006d6 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  800657:	83 ec 0c             	sub    $0xc,%esp
+  80065a:	ff 75 0c             	push   0xc(%ebp)
+  80065d:	e8 85 ff ff ff       	call   8005e7 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  800662:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800665:	c1 e6 0c             	shl    $0xc,%esi
+  800668:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80066e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800671:	89 3c 24             	mov    %edi,(%esp)
+  800674:	e8 d7 fd ff ff       	call   800450 <fd2data>
+  800679:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80067b:	89 34 24             	mov    %esi,(%esp)
+  80067e:	e8 cd fd ff ff       	call   800450 <fd2data>
+  800683:	83 c4 10             	add    $0x10,%esp
+  800686:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  800689:	89 d8                	mov    %ebx,%eax
+  80068b:	c1 e8 16             	shr    $0x16,%eax
+  80068e:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  800695:	a8 01                	test   $0x1,%al
+  800697:	74 11                	je     8006aa <dup+0x71>
+  800699:	89 d8                	mov    %ebx,%eax
+  80069b:	c1 e8 0c             	shr    $0xc,%eax
+  80069e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8006a5:	f6 c2 01             	test   $0x1,%dl
+  8006a8:	75 36                	jne    8006e0 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8006aa:	89 f8                	mov    %edi,%eax
+  8006ac:	c1 e8 0c             	shr    $0xc,%eax
+  8006af:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8006b6:	83 ec 0c             	sub    $0xc,%esp
+  8006b9:	25 07 0e 00 00       	and    $0xe07,%eax
+  8006be:	50                   	push   %eax
+  8006bf:	56                   	push   %esi
+  8006c0:	6a 00                	push   $0x0
+  8006c2:	57                   	push   %edi
+  8006c3:	6a 00                	push   $0x0
+  8006c5:	e8 e6 fa ff ff       	call   8001b0 <sys_page_map>
+  8006ca:	89 c3                	mov    %eax,%ebx
+  8006cc:	83 c4 20             	add    $0x20,%esp
+  8006cf:	85 c0                	test   %eax,%eax
+  8006d1:	78 33                	js     800706 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8006d3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8006d6:	89 d8                	mov    %ebx,%eax
+  8006d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006db:	5b                   	pop    %ebx
+  8006dc:	5e                   	pop    %esi
+  8006dd:	5f                   	pop    %edi
+  8006de:	5d                   	pop    %ebp
+  8006df:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8006e0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8006e7:	83 ec 0c             	sub    $0xc,%esp
+  8006ea:	25 07 0e 00 00       	and    $0xe07,%eax
+  8006ef:	50                   	push   %eax
+  8006f0:	ff 75 d4             	push   -0x2c(%ebp)
+  8006f3:	6a 00                	push   $0x0
+  8006f5:	53                   	push   %ebx
+  8006f6:	6a 00                	push   $0x0
+  8006f8:	e8 b3 fa ff ff       	call   8001b0 <sys_page_map>
+  8006fd:	89 c3                	mov    %eax,%ebx
+  8006ff:	83 c4 20             	add    $0x20,%esp
+  800702:	85 c0                	test   %eax,%eax
+  800704:	79 a4                	jns    8006aa <dup+0x71>
+	sys_page_unmap(0, newfd);
+  800706:	83 ec 08             	sub    $0x8,%esp
+  800709:	56                   	push   %esi
+  80070a:	6a 00                	push   $0x0
+  80070c:	e8 e1 fa ff ff       	call   8001f2 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  800711:	83 c4 08             	add    $0x8,%esp
+  800714:	ff 75 d4             	push   -0x2c(%ebp)
+  800717:	6a 00                	push   $0x0
+  800719:	e8 d4 fa ff ff       	call   8001f2 <sys_page_unmap>
+	return r;
+  80071e:	83 c4 10             	add    $0x10,%esp
+  800721:	eb b3                	jmp    8006d6 <dup+0x9d>
+
+00800723 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  800723:	55                   	push   %ebp
+  800724:	89 e5                	mov    %esp,%ebp
+  800726:	56                   	push   %esi
+  800727:	53                   	push   %ebx
+  800728:	83 ec 18             	sub    $0x18,%esp
+  80072b:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80072e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800731:	50                   	push   %eax
+  800732:	56                   	push   %esi
+  800733:	e8 85 fd ff ff       	call   8004bd <fd_lookup>
+  800738:	83 c4 10             	add    $0x10,%esp
+  80073b:	85 c0                	test   %eax,%eax
+  80073d:	78 3c                	js     80077b <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80073f:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  800742:	83 ec 08             	sub    $0x8,%esp
+  800745:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800748:	50                   	push   %eax
+  800749:	ff 33                	push   (%ebx)
+  80074b:	e8 bd fd ff ff       	call   80050d <dev_lookup>
+  800750:	83 c4 10             	add    $0x10,%esp
+  800753:	85 c0                	test   %eax,%eax
+  800755:	78 24                	js     80077b <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800757:	8b 43 08             	mov    0x8(%ebx),%eax
+  80075a:	83 e0 03             	and    $0x3,%eax
+  80075d:	83 f8 01             	cmp    $0x1,%eax
+  800760:	74 20                	je     800782 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  800762:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800765:	8b 40 08             	mov    0x8(%eax),%eax
+  800768:	85 c0                	test   %eax,%eax
+  80076a:	74 37                	je     8007a3 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80076c:	83 ec 04             	sub    $0x4,%esp
+  80076f:	ff 75 10             	push   0x10(%ebp)
+  800772:	ff 75 0c             	push   0xc(%ebp)
+  800775:	53                   	push   %ebx
+  800776:	ff d0                	call   *%eax
+  800778:	83 c4 10             	add    $0x10,%esp
+}
+  80077b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80077e:	5b                   	pop    %ebx
+  80077f:	5e                   	pop    %esi
+  800780:	5d                   	pop    %ebp
+  800781:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800782:	a1 08 40 80 00       	mov    0x804008,%eax
+  800787:	8b 40 48             	mov    0x48(%eax),%eax
+  80078a:	83 ec 04             	sub    $0x4,%esp
+  80078d:	56                   	push   %esi
+  80078e:	50                   	push   %eax
+  80078f:	68 85 25 80 00       	push   $0x802585
+  800794:	e8 93 0e 00 00       	call   80162c <cprintf>
+		return -E_INVAL;
+  800799:	83 c4 10             	add    $0x10,%esp
+  80079c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007a1:	eb d8                	jmp    80077b <read+0x58>
+		return -E_NOT_SUPP;
+  8007a3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8007a8:	eb d1                	jmp    80077b <read+0x58>
+
+008007aa <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8007aa:	55                   	push   %ebp
+  8007ab:	89 e5                	mov    %esp,%ebp
+  8007ad:	57                   	push   %edi
+  8007ae:	56                   	push   %esi
+  8007af:	53                   	push   %ebx
+  8007b0:	83 ec 0c             	sub    $0xc,%esp
+  8007b3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8007b6:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8007b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8007be:	eb 02                	jmp    8007c2 <readn+0x18>
+  8007c0:	01 c3                	add    %eax,%ebx
+  8007c2:	39 f3                	cmp    %esi,%ebx
+  8007c4:	73 21                	jae    8007e7 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8007c6:	83 ec 04             	sub    $0x4,%esp
+  8007c9:	89 f0                	mov    %esi,%eax
+  8007cb:	29 d8                	sub    %ebx,%eax
+  8007cd:	50                   	push   %eax
+  8007ce:	89 d8                	mov    %ebx,%eax
+  8007d0:	03 45 0c             	add    0xc(%ebp),%eax
+  8007d3:	50                   	push   %eax
+  8007d4:	57                   	push   %edi
+  8007d5:	e8 49 ff ff ff       	call   800723 <read>
+		if (m < 0)
+  8007da:	83 c4 10             	add    $0x10,%esp
+  8007dd:	85 c0                	test   %eax,%eax
+  8007df:	78 04                	js     8007e5 <readn+0x3b>
+			return m;
+		if (m == 0)
+  8007e1:	75 dd                	jne    8007c0 <readn+0x16>
+  8007e3:	eb 02                	jmp    8007e7 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8007e5:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8007e7:	89 d8                	mov    %ebx,%eax
+  8007e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007ec:	5b                   	pop    %ebx
+  8007ed:	5e                   	pop    %esi
+  8007ee:	5f                   	pop    %edi
+  8007ef:	5d                   	pop    %ebp
+  8007f0:	c3                   	ret
+
+008007f1 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8007f1:	55                   	push   %ebp
+  8007f2:	89 e5                	mov    %esp,%ebp
+  8007f4:	56                   	push   %esi
+  8007f5:	53                   	push   %ebx
+  8007f6:	83 ec 18             	sub    $0x18,%esp
+  8007f9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8007fc:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8007ff:	50                   	push   %eax
+  800800:	53                   	push   %ebx
+  800801:	e8 b7 fc ff ff       	call   8004bd <fd_lookup>
+  800806:	83 c4 10             	add    $0x10,%esp
+  800809:	85 c0                	test   %eax,%eax
+  80080b:	78 37                	js     800844 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80080d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800810:	83 ec 08             	sub    $0x8,%esp
+  800813:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800816:	50                   	push   %eax
+  800817:	ff 36                	push   (%esi)
+  800819:	e8 ef fc ff ff       	call   80050d <dev_lookup>
+  80081e:	83 c4 10             	add    $0x10,%esp
+  800821:	85 c0                	test   %eax,%eax
+  800823:	78 1f                	js     800844 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800825:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800829:	74 20                	je     80084b <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80082b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80082e:	8b 40 0c             	mov    0xc(%eax),%eax
+  800831:	85 c0                	test   %eax,%eax
+  800833:	74 37                	je     80086c <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  800835:	83 ec 04             	sub    $0x4,%esp
+  800838:	ff 75 10             	push   0x10(%ebp)
+  80083b:	ff 75 0c             	push   0xc(%ebp)
+  80083e:	56                   	push   %esi
+  80083f:	ff d0                	call   *%eax
+  800841:	83 c4 10             	add    $0x10,%esp
+}
+  800844:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800847:	5b                   	pop    %ebx
+  800848:	5e                   	pop    %esi
+  800849:	5d                   	pop    %ebp
+  80084a:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80084b:	a1 08 40 80 00       	mov    0x804008,%eax
+  800850:	8b 40 48             	mov    0x48(%eax),%eax
+  800853:	83 ec 04             	sub    $0x4,%esp
+  800856:	53                   	push   %ebx
+  800857:	50                   	push   %eax
+  800858:	68 a1 25 80 00       	push   $0x8025a1
+  80085d:	e8 ca 0d 00 00       	call   80162c <cprintf>
+		return -E_INVAL;
+  800862:	83 c4 10             	add    $0x10,%esp
+  800865:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80086a:	eb d8                	jmp    800844 <write+0x53>
+		return -E_NOT_SUPP;
+  80086c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800871:	eb d1                	jmp    800844 <write+0x53>
+
+00800873 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  800873:	55                   	push   %ebp
+  800874:	89 e5                	mov    %esp,%ebp
+  800876:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800879:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80087c:	50                   	push   %eax
+  80087d:	ff 75 08             	push   0x8(%ebp)
+  800880:	e8 38 fc ff ff       	call   8004bd <fd_lookup>
+  800885:	83 c4 10             	add    $0x10,%esp
+  800888:	85 c0                	test   %eax,%eax
+  80088a:	78 0e                	js     80089a <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80088c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80088f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800892:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  800895:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80089a:	c9                   	leave
+  80089b:	c3                   	ret
+
+0080089c <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80089c:	55                   	push   %ebp
+  80089d:	89 e5                	mov    %esp,%ebp
+  80089f:	56                   	push   %esi
+  8008a0:	53                   	push   %ebx
+  8008a1:	83 ec 18             	sub    $0x18,%esp
+  8008a4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8008a7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8008aa:	50                   	push   %eax
+  8008ab:	53                   	push   %ebx
+  8008ac:	e8 0c fc ff ff       	call   8004bd <fd_lookup>
+  8008b1:	83 c4 10             	add    $0x10,%esp
+  8008b4:	85 c0                	test   %eax,%eax
+  8008b6:	78 34                	js     8008ec <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8008b8:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8008bb:	83 ec 08             	sub    $0x8,%esp
+  8008be:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8008c1:	50                   	push   %eax
+  8008c2:	ff 36                	push   (%esi)
+  8008c4:	e8 44 fc ff ff       	call   80050d <dev_lookup>
+  8008c9:	83 c4 10             	add    $0x10,%esp
+  8008cc:	85 c0                	test   %eax,%eax
+  8008ce:	78 1c                	js     8008ec <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8008d0:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8008d4:	74 1d                	je     8008f3 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8008d6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008d9:	8b 40 18             	mov    0x18(%eax),%eax
+  8008dc:	85 c0                	test   %eax,%eax
+  8008de:	74 34                	je     800914 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8008e0:	83 ec 08             	sub    $0x8,%esp
+  8008e3:	ff 75 0c             	push   0xc(%ebp)
+  8008e6:	56                   	push   %esi
+  8008e7:	ff d0                	call   *%eax
+  8008e9:	83 c4 10             	add    $0x10,%esp
+}
+  8008ec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8008ef:	5b                   	pop    %ebx
+  8008f0:	5e                   	pop    %esi
+  8008f1:	5d                   	pop    %ebp
+  8008f2:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8008f3:	a1 08 40 80 00       	mov    0x804008,%eax
+  8008f8:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8008fb:	83 ec 04             	sub    $0x4,%esp
+  8008fe:	53                   	push   %ebx
+  8008ff:	50                   	push   %eax
+  800900:	68 64 25 80 00       	push   $0x802564
+  800905:	e8 22 0d 00 00       	call   80162c <cprintf>
+		return -E_INVAL;
+  80090a:	83 c4 10             	add    $0x10,%esp
+  80090d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800912:	eb d8                	jmp    8008ec <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  800914:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800919:	eb d1                	jmp    8008ec <ftruncate+0x50>
+
+0080091b <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80091b:	55                   	push   %ebp
+  80091c:	89 e5                	mov    %esp,%ebp
+  80091e:	56                   	push   %esi
+  80091f:	53                   	push   %ebx
+  800920:	83 ec 18             	sub    $0x18,%esp
+  800923:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800926:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800929:	50                   	push   %eax
+  80092a:	ff 75 08             	push   0x8(%ebp)
+  80092d:	e8 8b fb ff ff       	call   8004bd <fd_lookup>
+  800932:	83 c4 10             	add    $0x10,%esp
+  800935:	85 c0                	test   %eax,%eax
+  800937:	78 49                	js     800982 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800939:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80093c:	83 ec 08             	sub    $0x8,%esp
+  80093f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800942:	50                   	push   %eax
+  800943:	ff 36                	push   (%esi)
+  800945:	e8 c3 fb ff ff       	call   80050d <dev_lookup>
+  80094a:	83 c4 10             	add    $0x10,%esp
+  80094d:	85 c0                	test   %eax,%eax
+  80094f:	78 31                	js     800982 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  800951:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800954:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800958:	74 2f                	je     800989 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80095a:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80095d:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800964:	00 00 00 
+	stat->st_isdir = 0;
+  800967:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80096e:	00 00 00 
+	stat->st_dev = dev;
+  800971:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  800977:	83 ec 08             	sub    $0x8,%esp
+  80097a:	53                   	push   %ebx
+  80097b:	56                   	push   %esi
+  80097c:	ff 50 14             	call   *0x14(%eax)
+  80097f:	83 c4 10             	add    $0x10,%esp
+}
+  800982:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800985:	5b                   	pop    %ebx
+  800986:	5e                   	pop    %esi
+  800987:	5d                   	pop    %ebp
+  800988:	c3                   	ret
+		return -E_NOT_SUPP;
+  800989:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80098e:	eb f2                	jmp    800982 <fstat+0x67>
+
+00800990 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  800990:	55                   	push   %ebp
+  800991:	89 e5                	mov    %esp,%ebp
+  800993:	56                   	push   %esi
+  800994:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  800995:	83 ec 08             	sub    $0x8,%esp
+  800998:	6a 00                	push   $0x0
+  80099a:	ff 75 08             	push   0x8(%ebp)
+  80099d:	e8 e4 01 00 00       	call   800b86 <open>
+  8009a2:	89 c3                	mov    %eax,%ebx
+  8009a4:	83 c4 10             	add    $0x10,%esp
+  8009a7:	85 c0                	test   %eax,%eax
+  8009a9:	78 1b                	js     8009c6 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8009ab:	83 ec 08             	sub    $0x8,%esp
+  8009ae:	ff 75 0c             	push   0xc(%ebp)
+  8009b1:	50                   	push   %eax
+  8009b2:	e8 64 ff ff ff       	call   80091b <fstat>
+  8009b7:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8009b9:	89 1c 24             	mov    %ebx,(%esp)
+  8009bc:	e8 26 fc ff ff       	call   8005e7 <close>
+	return r;
+  8009c1:	83 c4 10             	add    $0x10,%esp
+  8009c4:	89 f3                	mov    %esi,%ebx
+}
+  8009c6:	89 d8                	mov    %ebx,%eax
+  8009c8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8009cb:	5b                   	pop    %ebx
+  8009cc:	5e                   	pop    %esi
+  8009cd:	5d                   	pop    %ebp
+  8009ce:	c3                   	ret
+
+008009cf <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  8009cf:	55                   	push   %ebp
+  8009d0:	89 e5                	mov    %esp,%ebp
+  8009d2:	56                   	push   %esi
+  8009d3:	53                   	push   %ebx
+  8009d4:	89 c6                	mov    %eax,%esi
+  8009d6:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  8009d8:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  8009df:	74 27                	je     800a08 <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8009e1:	6a 07                	push   $0x7
+  8009e3:	68 00 50 80 00       	push   $0x805000
+  8009e8:	56                   	push   %esi
+  8009e9:	ff 35 00 40 80 00    	push   0x804000
+  8009ef:	e8 95 15 00 00       	call   801f89 <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  8009f4:	83 c4 0c             	add    $0xc,%esp
+  8009f7:	6a 00                	push   $0x0
+  8009f9:	53                   	push   %ebx
+  8009fa:	6a 00                	push   $0x0
+  8009fc:	e8 14 15 00 00       	call   801f15 <ipc_recv>
+}
+  800a01:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800a04:	5b                   	pop    %ebx
+  800a05:	5e                   	pop    %esi
+  800a06:	5d                   	pop    %ebp
+  800a07:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  800a08:	83 ec 0c             	sub    $0xc,%esp
+  800a0b:	6a 01                	push   $0x1
+  800a0d:	e8 cb 15 00 00       	call   801fdd <ipc_find_env>
+  800a12:	a3 00 40 80 00       	mov    %eax,0x804000
+  800a17:	83 c4 10             	add    $0x10,%esp
+  800a1a:	eb c5                	jmp    8009e1 <fsipc+0x12>
+
+00800a1c <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  800a1c:	55                   	push   %ebp
+  800a1d:	89 e5                	mov    %esp,%ebp
+  800a1f:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800a22:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a25:	8b 40 0c             	mov    0xc(%eax),%eax
+  800a28:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.set_size.req_size = newsize;
+  800a2d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a30:	a3 04 50 80 00       	mov    %eax,0x805004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  800a35:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a3a:	b8 02 00 00 00       	mov    $0x2,%eax
+  800a3f:	e8 8b ff ff ff       	call   8009cf <fsipc>
+}
+  800a44:	c9                   	leave
+  800a45:	c3                   	ret
+
+00800a46 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  800a46:	55                   	push   %ebp
+  800a47:	89 e5                	mov    %esp,%ebp
+  800a49:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800a4c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a4f:	8b 40 0c             	mov    0xc(%eax),%eax
+  800a52:	a3 00 50 80 00       	mov    %eax,0x805000
+  return fsipc(FSREQ_FLUSH, NULL);
+  800a57:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a5c:	b8 06 00 00 00       	mov    $0x6,%eax
+  800a61:	e8 69 ff ff ff       	call   8009cf <fsipc>
+}
+  800a66:	c9                   	leave
+  800a67:	c3                   	ret
+
+00800a68 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  800a68:	55                   	push   %ebp
+  800a69:	89 e5                	mov    %esp,%ebp
+  800a6b:	53                   	push   %ebx
+  800a6c:	83 ec 04             	sub    $0x4,%esp
+  800a6f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800a72:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a75:	8b 40 0c             	mov    0xc(%eax),%eax
+  800a78:	a3 00 50 80 00       	mov    %eax,0x805000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  800a7d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a82:	b8 05 00 00 00       	mov    $0x5,%eax
+  800a87:	e8 43 ff ff ff       	call   8009cf <fsipc>
+  800a8c:	85 c0                	test   %eax,%eax
+  800a8e:	78 2c                	js     800abc <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800a90:	83 ec 08             	sub    $0x8,%esp
+  800a93:	68 00 50 80 00       	push   $0x805000
+  800a98:	53                   	push   %ebx
+  800a99:	e8 47 11 00 00       	call   801be5 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  800a9e:	a1 80 50 80 00       	mov    0x805080,%eax
+  800aa3:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800aa9:	a1 84 50 80 00       	mov    0x805084,%eax
+  800aae:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  800ab4:	83 c4 10             	add    $0x10,%esp
+  800ab7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800abc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800abf:	c9                   	leave
+  800ac0:	c3                   	ret
+
+00800ac1 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  800ac1:	55                   	push   %ebp
+  800ac2:	89 e5                	mov    %esp,%ebp
+  800ac4:	83 ec 0c             	sub    $0xc,%esp
+  800ac7:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800aca:	8b 55 08             	mov    0x8(%ebp),%edx
+  800acd:	8b 52 0c             	mov    0xc(%edx),%edx
+  800ad0:	89 15 00 50 80 00    	mov    %edx,0x805000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  800ad6:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  800adb:	39 d0                	cmp    %edx,%eax
+  800add:	0f 47 c2             	cmova  %edx,%eax
+  800ae0:	a3 04 50 80 00       	mov    %eax,0x805004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  800ae5:	50                   	push   %eax
+  800ae6:	ff 75 0c             	push   0xc(%ebp)
+  800ae9:	68 08 50 80 00       	push   $0x805008
+  800aee:	e8 78 12 00 00       	call   801d6b <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  800af3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800af8:	b8 04 00 00 00       	mov    $0x4,%eax
+  800afd:	e8 cd fe ff ff       	call   8009cf <fsipc>
+}
+  800b02:	c9                   	leave
+  800b03:	c3                   	ret
+
+00800b04 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  800b04:	55                   	push   %ebp
+  800b05:	89 e5                	mov    %esp,%ebp
+  800b07:	56                   	push   %esi
+  800b08:	53                   	push   %ebx
+  800b09:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800b0c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b0f:	8b 40 0c             	mov    0xc(%eax),%eax
+  800b12:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.read.req_n = n;
+  800b17:	89 35 04 50 80 00    	mov    %esi,0x805004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  800b1d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b22:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b27:	e8 a3 fe ff ff       	call   8009cf <fsipc>
+  800b2c:	89 c3                	mov    %eax,%ebx
+  800b2e:	85 c0                	test   %eax,%eax
+  800b30:	78 1f                	js     800b51 <devfile_read+0x4d>
+  assert(r <= n);
+  800b32:	39 c6                	cmp    %eax,%esi
+  800b34:	72 24                	jb     800b5a <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  800b36:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800b3b:	7f 33                	jg     800b70 <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  800b3d:	83 ec 04             	sub    $0x4,%esp
+  800b40:	50                   	push   %eax
+  800b41:	68 00 50 80 00       	push   $0x805000
+  800b46:	ff 75 0c             	push   0xc(%ebp)
+  800b49:	e8 1d 12 00 00       	call   801d6b <memmove>
+  return r;
+  800b4e:	83 c4 10             	add    $0x10,%esp
+}
+  800b51:	89 d8                	mov    %ebx,%eax
+  800b53:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b56:	5b                   	pop    %ebx
+  800b57:	5e                   	pop    %esi
+  800b58:	5d                   	pop    %ebp
+  800b59:	c3                   	ret
+  assert(r <= n);
+  800b5a:	68 d4 25 80 00       	push   $0x8025d4
+  800b5f:	68 db 25 80 00       	push   $0x8025db
+  800b64:	6a 78                	push   $0x78
+  800b66:	68 f0 25 80 00       	push   $0x8025f0
+  800b6b:	e8 e1 09 00 00       	call   801551 <_panic>
+  assert(r <= PGSIZE);
+  800b70:	68 fb 25 80 00       	push   $0x8025fb
+  800b75:	68 db 25 80 00       	push   $0x8025db
+  800b7a:	6a 79                	push   $0x79
+  800b7c:	68 f0 25 80 00       	push   $0x8025f0
+  800b81:	e8 cb 09 00 00       	call   801551 <_panic>
+
+00800b86 <open>:
+open(const char *path, int mode) {
+  800b86:	55                   	push   %ebp
+  800b87:	89 e5                	mov    %esp,%ebp
+  800b89:	56                   	push   %esi
+  800b8a:	53                   	push   %ebx
+  800b8b:	83 ec 1c             	sub    $0x1c,%esp
+  800b8e:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  800b91:	56                   	push   %esi
+  800b92:	e8 13 10 00 00       	call   801baa <strlen>
+  800b97:	83 c4 10             	add    $0x10,%esp
+  800b9a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800b9f:	7f 6c                	jg     800c0d <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  800ba1:	83 ec 0c             	sub    $0xc,%esp
+  800ba4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800ba7:	50                   	push   %eax
+  800ba8:	e8 ba f8 ff ff       	call   800467 <fd_alloc>
+  800bad:	89 c3                	mov    %eax,%ebx
+  800baf:	83 c4 10             	add    $0x10,%esp
+  800bb2:	85 c0                	test   %eax,%eax
+  800bb4:	78 3c                	js     800bf2 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  800bb6:	83 ec 08             	sub    $0x8,%esp
+  800bb9:	56                   	push   %esi
+  800bba:	68 00 50 80 00       	push   $0x805000
+  800bbf:	e8 21 10 00 00       	call   801be5 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  800bc4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bc7:	a3 00 54 80 00       	mov    %eax,0x805400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  800bcc:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  800bcf:	b8 01 00 00 00       	mov    $0x1,%eax
+  800bd4:	e8 f6 fd ff ff       	call   8009cf <fsipc>
+  800bd9:	89 c3                	mov    %eax,%ebx
+  800bdb:	83 c4 10             	add    $0x10,%esp
+  800bde:	85 c0                	test   %eax,%eax
+  800be0:	78 19                	js     800bfb <open+0x75>
+  return fd2num(fd);
+  800be2:	83 ec 0c             	sub    $0xc,%esp
+  800be5:	ff 75 f4             	push   -0xc(%ebp)
+  800be8:	e8 53 f8 ff ff       	call   800440 <fd2num>
+  800bed:	89 c3                	mov    %eax,%ebx
+  800bef:	83 c4 10             	add    $0x10,%esp
+}
+  800bf2:	89 d8                	mov    %ebx,%eax
+  800bf4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800bf7:	5b                   	pop    %ebx
+  800bf8:	5e                   	pop    %esi
+  800bf9:	5d                   	pop    %ebp
+  800bfa:	c3                   	ret
+    fd_close(fd, 0);
+  800bfb:	83 ec 08             	sub    $0x8,%esp
+  800bfe:	6a 00                	push   $0x0
+  800c00:	ff 75 f4             	push   -0xc(%ebp)
+  800c03:	e8 58 f9 ff ff       	call   800560 <fd_close>
+    return r;
+  800c08:	83 c4 10             	add    $0x10,%esp
+  800c0b:	eb e5                	jmp    800bf2 <open+0x6c>
+    return -E_BAD_PATH;
+  800c0d:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  800c12:	eb de                	jmp    800bf2 <open+0x6c>
+
+00800c14 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  800c14:	55                   	push   %ebp
+  800c15:	89 e5                	mov    %esp,%ebp
+  800c17:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  800c1a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c1f:	b8 08 00 00 00       	mov    $0x8,%eax
+  800c24:	e8 a6 fd ff ff       	call   8009cf <fsipc>
+}
+  800c29:	c9                   	leave
+  800c2a:	c3                   	ret
+
+00800c2b <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  800c2b:	55                   	push   %ebp
+  800c2c:	89 e5                	mov    %esp,%ebp
+  800c2e:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  800c31:	68 07 26 80 00       	push   $0x802607
+  800c36:	ff 75 0c             	push   0xc(%ebp)
+  800c39:	e8 a7 0f 00 00       	call   801be5 <strcpy>
+	return 0;
+}
+  800c3e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c43:	c9                   	leave
+  800c44:	c3                   	ret
+
+00800c45 <devsock_close>:
+{
+  800c45:	55                   	push   %ebp
+  800c46:	89 e5                	mov    %esp,%ebp
+  800c48:	53                   	push   %ebx
+  800c49:	83 ec 10             	sub    $0x10,%esp
+  800c4c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  800c4f:	53                   	push   %ebx
+  800c50:	e8 c7 13 00 00       	call   80201c <pageref>
+  800c55:	89 c2                	mov    %eax,%edx
+  800c57:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  800c5a:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  800c5f:	83 fa 01             	cmp    $0x1,%edx
+  800c62:	74 05                	je     800c69 <devsock_close+0x24>
+}
+  800c64:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c67:	c9                   	leave
+  800c68:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  800c69:	83 ec 0c             	sub    $0xc,%esp
+  800c6c:	ff 73 0c             	push   0xc(%ebx)
+  800c6f:	e8 b7 02 00 00       	call   800f2b <nsipc_close>
+  800c74:	83 c4 10             	add    $0x10,%esp
+  800c77:	eb eb                	jmp    800c64 <devsock_close+0x1f>
+
+00800c79 <devsock_write>:
+{
+  800c79:	55                   	push   %ebp
+  800c7a:	89 e5                	mov    %esp,%ebp
+  800c7c:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  800c7f:	6a 00                	push   $0x0
+  800c81:	ff 75 10             	push   0x10(%ebp)
+  800c84:	ff 75 0c             	push   0xc(%ebp)
+  800c87:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c8a:	ff 70 0c             	push   0xc(%eax)
+  800c8d:	e8 79 03 00 00       	call   80100b <nsipc_send>
+}
+  800c92:	c9                   	leave
+  800c93:	c3                   	ret
+
+00800c94 <devsock_read>:
+{
+  800c94:	55                   	push   %ebp
+  800c95:	89 e5                	mov    %esp,%ebp
+  800c97:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  800c9a:	6a 00                	push   $0x0
+  800c9c:	ff 75 10             	push   0x10(%ebp)
+  800c9f:	ff 75 0c             	push   0xc(%ebp)
+  800ca2:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ca5:	ff 70 0c             	push   0xc(%eax)
+  800ca8:	e8 ef 02 00 00       	call   800f9c <nsipc_recv>
+}
+  800cad:	c9                   	leave
+  800cae:	c3                   	ret
+
+00800caf <fd2sockid>:
+{
+  800caf:	55                   	push   %ebp
+  800cb0:	89 e5                	mov    %esp,%ebp
+  800cb2:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  800cb5:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  800cb8:	52                   	push   %edx
+  800cb9:	50                   	push   %eax
+  800cba:	e8 fe f7 ff ff       	call   8004bd <fd_lookup>
+  800cbf:	83 c4 10             	add    $0x10,%esp
+  800cc2:	85 c0                	test   %eax,%eax
+  800cc4:	78 10                	js     800cd6 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  800cc6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800cc9:	8b 0d 24 30 80 00    	mov    0x803024,%ecx
+  800ccf:	39 08                	cmp    %ecx,(%eax)
+  800cd1:	75 05                	jne    800cd8 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  800cd3:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  800cd6:	c9                   	leave
+  800cd7:	c3                   	ret
+		return -E_NOT_SUPP;
+  800cd8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800cdd:	eb f7                	jmp    800cd6 <fd2sockid+0x27>
+
+00800cdf <alloc_sockfd>:
+{
+  800cdf:	55                   	push   %ebp
+  800ce0:	89 e5                	mov    %esp,%ebp
+  800ce2:	56                   	push   %esi
+  800ce3:	53                   	push   %ebx
+  800ce4:	83 ec 1c             	sub    $0x1c,%esp
+  800ce7:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  800ce9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800cec:	50                   	push   %eax
+  800ced:	e8 75 f7 ff ff       	call   800467 <fd_alloc>
+  800cf2:	89 c3                	mov    %eax,%ebx
+  800cf4:	83 c4 10             	add    $0x10,%esp
+  800cf7:	85 c0                	test   %eax,%eax
+  800cf9:	78 43                	js     800d3e <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  800cfb:	83 ec 04             	sub    $0x4,%esp
+  800cfe:	68 07 04 00 00       	push   $0x407
+  800d03:	ff 75 f4             	push   -0xc(%ebp)
+  800d06:	6a 00                	push   $0x0
+  800d08:	e8 60 f4 ff ff       	call   80016d <sys_page_alloc>
+  800d0d:	89 c3                	mov    %eax,%ebx
+  800d0f:	83 c4 10             	add    $0x10,%esp
+  800d12:	85 c0                	test   %eax,%eax
+  800d14:	78 28                	js     800d3e <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  800d16:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800d19:	8b 15 24 30 80 00    	mov    0x803024,%edx
+  800d1f:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  800d21:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800d24:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  800d2b:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  800d2e:	83 ec 0c             	sub    $0xc,%esp
+  800d31:	50                   	push   %eax
+  800d32:	e8 09 f7 ff ff       	call   800440 <fd2num>
+  800d37:	89 c3                	mov    %eax,%ebx
+  800d39:	83 c4 10             	add    $0x10,%esp
+  800d3c:	eb 0c                	jmp    800d4a <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  800d3e:	83 ec 0c             	sub    $0xc,%esp
+  800d41:	56                   	push   %esi
+  800d42:	e8 e4 01 00 00       	call   800f2b <nsipc_close>
+		return r;
+  800d47:	83 c4 10             	add    $0x10,%esp
+}
+  800d4a:	89 d8                	mov    %ebx,%eax
+  800d4c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d4f:	5b                   	pop    %ebx
+  800d50:	5e                   	pop    %esi
+  800d51:	5d                   	pop    %ebp
+  800d52:	c3                   	ret
+
+00800d53 <accept>:
+{
+  800d53:	55                   	push   %ebp
+  800d54:	89 e5                	mov    %esp,%ebp
+  800d56:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800d59:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d5c:	e8 4e ff ff ff       	call   800caf <fd2sockid>
+  800d61:	85 c0                	test   %eax,%eax
+  800d63:	78 1b                	js     800d80 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  800d65:	83 ec 04             	sub    $0x4,%esp
+  800d68:	ff 75 10             	push   0x10(%ebp)
+  800d6b:	ff 75 0c             	push   0xc(%ebp)
+  800d6e:	50                   	push   %eax
+  800d6f:	e8 0e 01 00 00       	call   800e82 <nsipc_accept>
+  800d74:	83 c4 10             	add    $0x10,%esp
+  800d77:	85 c0                	test   %eax,%eax
+  800d79:	78 05                	js     800d80 <accept+0x2d>
+	return alloc_sockfd(r);
+  800d7b:	e8 5f ff ff ff       	call   800cdf <alloc_sockfd>
+}
+  800d80:	c9                   	leave
+  800d81:	c3                   	ret
+
+00800d82 <bind>:
+{
+  800d82:	55                   	push   %ebp
+  800d83:	89 e5                	mov    %esp,%ebp
+  800d85:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800d88:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d8b:	e8 1f ff ff ff       	call   800caf <fd2sockid>
+  800d90:	85 c0                	test   %eax,%eax
+  800d92:	78 12                	js     800da6 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  800d94:	83 ec 04             	sub    $0x4,%esp
+  800d97:	ff 75 10             	push   0x10(%ebp)
+  800d9a:	ff 75 0c             	push   0xc(%ebp)
+  800d9d:	50                   	push   %eax
+  800d9e:	e8 31 01 00 00       	call   800ed4 <nsipc_bind>
+  800da3:	83 c4 10             	add    $0x10,%esp
+}
+  800da6:	c9                   	leave
+  800da7:	c3                   	ret
+
+00800da8 <shutdown>:
+{
+  800da8:	55                   	push   %ebp
+  800da9:	89 e5                	mov    %esp,%ebp
+  800dab:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800dae:	8b 45 08             	mov    0x8(%ebp),%eax
+  800db1:	e8 f9 fe ff ff       	call   800caf <fd2sockid>
+  800db6:	85 c0                	test   %eax,%eax
+  800db8:	78 0f                	js     800dc9 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  800dba:	83 ec 08             	sub    $0x8,%esp
+  800dbd:	ff 75 0c             	push   0xc(%ebp)
+  800dc0:	50                   	push   %eax
+  800dc1:	e8 43 01 00 00       	call   800f09 <nsipc_shutdown>
+  800dc6:	83 c4 10             	add    $0x10,%esp
+}
+  800dc9:	c9                   	leave
+  800dca:	c3                   	ret
+
+00800dcb <connect>:
+{
+  800dcb:	55                   	push   %ebp
+  800dcc:	89 e5                	mov    %esp,%ebp
+  800dce:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800dd1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dd4:	e8 d6 fe ff ff       	call   800caf <fd2sockid>
+  800dd9:	85 c0                	test   %eax,%eax
+  800ddb:	78 12                	js     800def <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  800ddd:	83 ec 04             	sub    $0x4,%esp
+  800de0:	ff 75 10             	push   0x10(%ebp)
+  800de3:	ff 75 0c             	push   0xc(%ebp)
+  800de6:	50                   	push   %eax
+  800de7:	e8 59 01 00 00       	call   800f45 <nsipc_connect>
+  800dec:	83 c4 10             	add    $0x10,%esp
+}
+  800def:	c9                   	leave
+  800df0:	c3                   	ret
+
+00800df1 <listen>:
+{
+  800df1:	55                   	push   %ebp
+  800df2:	89 e5                	mov    %esp,%ebp
+  800df4:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800df7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dfa:	e8 b0 fe ff ff       	call   800caf <fd2sockid>
+  800dff:	85 c0                	test   %eax,%eax
+  800e01:	78 0f                	js     800e12 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  800e03:	83 ec 08             	sub    $0x8,%esp
+  800e06:	ff 75 0c             	push   0xc(%ebp)
+  800e09:	50                   	push   %eax
+  800e0a:	e8 6b 01 00 00       	call   800f7a <nsipc_listen>
+  800e0f:	83 c4 10             	add    $0x10,%esp
+}
+  800e12:	c9                   	leave
+  800e13:	c3                   	ret
+
+00800e14 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  800e14:	55                   	push   %ebp
+  800e15:	89 e5                	mov    %esp,%ebp
+  800e17:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  800e1a:	ff 75 10             	push   0x10(%ebp)
+  800e1d:	ff 75 0c             	push   0xc(%ebp)
+  800e20:	ff 75 08             	push   0x8(%ebp)
+  800e23:	e8 41 02 00 00       	call   801069 <nsipc_socket>
+  800e28:	83 c4 10             	add    $0x10,%esp
+  800e2b:	85 c0                	test   %eax,%eax
+  800e2d:	78 05                	js     800e34 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  800e2f:	e8 ab fe ff ff       	call   800cdf <alloc_sockfd>
+}
+  800e34:	c9                   	leave
+  800e35:	c3                   	ret
+
+00800e36 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  800e36:	55                   	push   %ebp
+  800e37:	89 e5                	mov    %esp,%ebp
+  800e39:	53                   	push   %ebx
+  800e3a:	83 ec 04             	sub    $0x4,%esp
+  800e3d:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  800e3f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800e46:	74 26                	je     800e6e <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  800e48:	6a 07                	push   $0x7
+  800e4a:	68 00 60 80 00       	push   $0x806000
+  800e4f:	53                   	push   %ebx
+  800e50:	ff 35 04 40 80 00    	push   0x804004
+  800e56:	e8 2e 11 00 00       	call   801f89 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  800e5b:	83 c4 0c             	add    $0xc,%esp
+  800e5e:	6a 00                	push   $0x0
+  800e60:	6a 00                	push   $0x0
+  800e62:	6a 00                	push   $0x0
+  800e64:	e8 ac 10 00 00       	call   801f15 <ipc_recv>
+}
+  800e69:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e6c:	c9                   	leave
+  800e6d:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  800e6e:	83 ec 0c             	sub    $0xc,%esp
+  800e71:	6a 02                	push   $0x2
+  800e73:	e8 65 11 00 00       	call   801fdd <ipc_find_env>
+  800e78:	a3 04 40 80 00       	mov    %eax,0x804004
+  800e7d:	83 c4 10             	add    $0x10,%esp
+  800e80:	eb c6                	jmp    800e48 <nsipc+0x12>
+
+00800e82 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  800e82:	55                   	push   %ebp
+  800e83:	89 e5                	mov    %esp,%ebp
+  800e85:	56                   	push   %esi
+  800e86:	53                   	push   %ebx
+  800e87:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  800e8a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e8d:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  800e92:	8b 06                	mov    (%esi),%eax
+  800e94:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  800e99:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e9e:	e8 93 ff ff ff       	call   800e36 <nsipc>
+  800ea3:	89 c3                	mov    %eax,%ebx
+  800ea5:	85 c0                	test   %eax,%eax
+  800ea7:	79 09                	jns    800eb2 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  800ea9:	89 d8                	mov    %ebx,%eax
+  800eab:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800eae:	5b                   	pop    %ebx
+  800eaf:	5e                   	pop    %esi
+  800eb0:	5d                   	pop    %ebp
+  800eb1:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  800eb2:	83 ec 04             	sub    $0x4,%esp
+  800eb5:	ff 35 10 60 80 00    	push   0x806010
+  800ebb:	68 00 60 80 00       	push   $0x806000
+  800ec0:	ff 75 0c             	push   0xc(%ebp)
+  800ec3:	e8 a3 0e 00 00       	call   801d6b <memmove>
+		*addrlen = ret->ret_addrlen;
+  800ec8:	a1 10 60 80 00       	mov    0x806010,%eax
+  800ecd:	89 06                	mov    %eax,(%esi)
+  800ecf:	83 c4 10             	add    $0x10,%esp
+	return r;
+  800ed2:	eb d5                	jmp    800ea9 <nsipc_accept+0x27>
+
+00800ed4 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  800ed4:	55                   	push   %ebp
+  800ed5:	89 e5                	mov    %esp,%ebp
+  800ed7:	53                   	push   %ebx
+  800ed8:	83 ec 08             	sub    $0x8,%esp
+  800edb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  800ede:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ee1:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  800ee6:	53                   	push   %ebx
+  800ee7:	ff 75 0c             	push   0xc(%ebp)
+  800eea:	68 04 60 80 00       	push   $0x806004
+  800eef:	e8 77 0e 00 00       	call   801d6b <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  800ef4:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  800efa:	b8 02 00 00 00       	mov    $0x2,%eax
+  800eff:	e8 32 ff ff ff       	call   800e36 <nsipc>
+}
+  800f04:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f07:	c9                   	leave
+  800f08:	c3                   	ret
+
+00800f09 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  800f09:	55                   	push   %ebp
+  800f0a:	89 e5                	mov    %esp,%ebp
+  800f0c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  800f0f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f12:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  800f17:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f1a:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  800f1f:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f24:	e8 0d ff ff ff       	call   800e36 <nsipc>
+}
+  800f29:	c9                   	leave
+  800f2a:	c3                   	ret
+
+00800f2b <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  800f2b:	55                   	push   %ebp
+  800f2c:	89 e5                	mov    %esp,%ebp
+  800f2e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  800f31:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f34:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  800f39:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f3e:	e8 f3 fe ff ff       	call   800e36 <nsipc>
+}
+  800f43:	c9                   	leave
+  800f44:	c3                   	ret
+
+00800f45 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  800f45:	55                   	push   %ebp
+  800f46:	89 e5                	mov    %esp,%ebp
+  800f48:	53                   	push   %ebx
+  800f49:	83 ec 08             	sub    $0x8,%esp
+  800f4c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  800f4f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f52:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  800f57:	53                   	push   %ebx
+  800f58:	ff 75 0c             	push   0xc(%ebp)
+  800f5b:	68 04 60 80 00       	push   $0x806004
+  800f60:	e8 06 0e 00 00       	call   801d6b <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  800f65:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  800f6b:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f70:	e8 c1 fe ff ff       	call   800e36 <nsipc>
+}
+  800f75:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f78:	c9                   	leave
+  800f79:	c3                   	ret
+
+00800f7a <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  800f7a:	55                   	push   %ebp
+  800f7b:	89 e5                	mov    %esp,%ebp
+  800f7d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  800f80:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f83:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  800f88:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f8b:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  800f90:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f95:	e8 9c fe ff ff       	call   800e36 <nsipc>
+}
+  800f9a:	c9                   	leave
+  800f9b:	c3                   	ret
+
+00800f9c <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  800f9c:	55                   	push   %ebp
+  800f9d:	89 e5                	mov    %esp,%ebp
+  800f9f:	56                   	push   %esi
+  800fa0:	53                   	push   %ebx
+  800fa1:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  800fa4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fa7:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  800fac:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  800fb2:	8b 45 14             	mov    0x14(%ebp),%eax
+  800fb5:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  800fba:	b8 07 00 00 00       	mov    $0x7,%eax
+  800fbf:	e8 72 fe ff ff       	call   800e36 <nsipc>
+  800fc4:	89 c3                	mov    %eax,%ebx
+  800fc6:	85 c0                	test   %eax,%eax
+  800fc8:	78 22                	js     800fec <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  800fca:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  800fcf:	39 c6                	cmp    %eax,%esi
+  800fd1:	0f 4e c6             	cmovle %esi,%eax
+  800fd4:	39 c3                	cmp    %eax,%ebx
+  800fd6:	7f 1d                	jg     800ff5 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  800fd8:	83 ec 04             	sub    $0x4,%esp
+  800fdb:	53                   	push   %ebx
+  800fdc:	68 00 60 80 00       	push   $0x806000
+  800fe1:	ff 75 0c             	push   0xc(%ebp)
+  800fe4:	e8 82 0d 00 00       	call   801d6b <memmove>
+  800fe9:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  800fec:	89 d8                	mov    %ebx,%eax
+  800fee:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ff1:	5b                   	pop    %ebx
+  800ff2:	5e                   	pop    %esi
+  800ff3:	5d                   	pop    %ebp
+  800ff4:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  800ff5:	68 13 26 80 00       	push   $0x802613
+  800ffa:	68 db 25 80 00       	push   $0x8025db
+  800fff:	6a 62                	push   $0x62
+  801001:	68 28 26 80 00       	push   $0x802628
+  801006:	e8 46 05 00 00       	call   801551 <_panic>
+
+0080100b <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  80100b:	55                   	push   %ebp
+  80100c:	89 e5                	mov    %esp,%ebp
+  80100e:	53                   	push   %ebx
+  80100f:	83 ec 04             	sub    $0x4,%esp
+  801012:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801015:	8b 45 08             	mov    0x8(%ebp),%eax
+  801018:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  80101d:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801023:	7f 2e                	jg     801053 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801025:	83 ec 04             	sub    $0x4,%esp
+  801028:	53                   	push   %ebx
+  801029:	ff 75 0c             	push   0xc(%ebp)
+  80102c:	68 0c 60 80 00       	push   $0x80600c
+  801031:	e8 35 0d 00 00       	call   801d6b <memmove>
+	nsipcbuf.send.req_size = size;
+  801036:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  80103c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80103f:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  801044:	b8 08 00 00 00       	mov    $0x8,%eax
+  801049:	e8 e8 fd ff ff       	call   800e36 <nsipc>
+}
+  80104e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801051:	c9                   	leave
+  801052:	c3                   	ret
+	assert(size < 1600);
+  801053:	68 34 26 80 00       	push   $0x802634
+  801058:	68 db 25 80 00       	push   $0x8025db
+  80105d:	6a 6d                	push   $0x6d
+  80105f:	68 28 26 80 00       	push   $0x802628
+  801064:	e8 e8 04 00 00       	call   801551 <_panic>
+
+00801069 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801069:	55                   	push   %ebp
+  80106a:	89 e5                	mov    %esp,%ebp
+  80106c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  80106f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801072:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  801077:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80107a:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  80107f:	8b 45 10             	mov    0x10(%ebp),%eax
+  801082:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  801087:	b8 09 00 00 00       	mov    $0x9,%eax
+  80108c:	e8 a5 fd ff ff       	call   800e36 <nsipc>
+}
+  801091:	c9                   	leave
+  801092:	c3                   	ret
+
+00801093 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801093:	55                   	push   %ebp
+  801094:	89 e5                	mov    %esp,%ebp
+  801096:	56                   	push   %esi
+  801097:	53                   	push   %ebx
+  801098:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80109b:	83 ec 0c             	sub    $0xc,%esp
+  80109e:	ff 75 08             	push   0x8(%ebp)
+  8010a1:	e8 aa f3 ff ff       	call   800450 <fd2data>
+  8010a6:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8010a8:	83 c4 08             	add    $0x8,%esp
+  8010ab:	68 40 26 80 00       	push   $0x802640
+  8010b0:	53                   	push   %ebx
+  8010b1:	e8 2f 0b 00 00       	call   801be5 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8010b6:	8b 46 04             	mov    0x4(%esi),%eax
+  8010b9:	2b 06                	sub    (%esi),%eax
+  8010bb:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8010c1:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8010c8:	00 00 00 
+	stat->st_dev = &devpipe;
+  8010cb:	c7 83 88 00 00 00 40 	movl   $0x803040,0x88(%ebx)
+  8010d2:	30 80 00 
+	return 0;
+}
+  8010d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010da:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8010dd:	5b                   	pop    %ebx
+  8010de:	5e                   	pop    %esi
+  8010df:	5d                   	pop    %ebp
+  8010e0:	c3                   	ret
+
+008010e1 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8010e1:	55                   	push   %ebp
+  8010e2:	89 e5                	mov    %esp,%ebp
+  8010e4:	53                   	push   %ebx
+  8010e5:	83 ec 0c             	sub    $0xc,%esp
+  8010e8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8010eb:	53                   	push   %ebx
+  8010ec:	6a 00                	push   $0x0
+  8010ee:	e8 ff f0 ff ff       	call   8001f2 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8010f3:	89 1c 24             	mov    %ebx,(%esp)
+  8010f6:	e8 55 f3 ff ff       	call   800450 <fd2data>
+  8010fb:	83 c4 08             	add    $0x8,%esp
+  8010fe:	50                   	push   %eax
+  8010ff:	6a 00                	push   $0x0
+  801101:	e8 ec f0 ff ff       	call   8001f2 <sys_page_unmap>
+}
+  801106:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801109:	c9                   	leave
+  80110a:	c3                   	ret
+
+0080110b <_pipeisclosed>:
+{
+  80110b:	55                   	push   %ebp
+  80110c:	89 e5                	mov    %esp,%ebp
+  80110e:	57                   	push   %edi
+  80110f:	56                   	push   %esi
+  801110:	53                   	push   %ebx
+  801111:	83 ec 1c             	sub    $0x1c,%esp
+  801114:	89 c7                	mov    %eax,%edi
+  801116:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801118:	a1 08 40 80 00       	mov    0x804008,%eax
+  80111d:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801120:	83 ec 0c             	sub    $0xc,%esp
+  801123:	57                   	push   %edi
+  801124:	e8 f3 0e 00 00       	call   80201c <pageref>
+  801129:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80112c:	89 34 24             	mov    %esi,(%esp)
+  80112f:	e8 e8 0e 00 00       	call   80201c <pageref>
+		nn = thisenv->env_runs;
+  801134:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  80113a:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  80113d:	83 c4 10             	add    $0x10,%esp
+  801140:	39 cb                	cmp    %ecx,%ebx
+  801142:	74 1b                	je     80115f <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801144:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801147:	75 cf                	jne    801118 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801149:	8b 42 58             	mov    0x58(%edx),%eax
+  80114c:	6a 01                	push   $0x1
+  80114e:	50                   	push   %eax
+  80114f:	53                   	push   %ebx
+  801150:	68 47 26 80 00       	push   $0x802647
+  801155:	e8 d2 04 00 00       	call   80162c <cprintf>
+  80115a:	83 c4 10             	add    $0x10,%esp
+  80115d:	eb b9                	jmp    801118 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  80115f:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801162:	0f 94 c0             	sete   %al
+  801165:	0f b6 c0             	movzbl %al,%eax
+}
+  801168:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80116b:	5b                   	pop    %ebx
+  80116c:	5e                   	pop    %esi
+  80116d:	5f                   	pop    %edi
+  80116e:	5d                   	pop    %ebp
+  80116f:	c3                   	ret
+
+00801170 <devpipe_write>:
+{
+  801170:	55                   	push   %ebp
+  801171:	89 e5                	mov    %esp,%ebp
+  801173:	57                   	push   %edi
+  801174:	56                   	push   %esi
+  801175:	53                   	push   %ebx
+  801176:	83 ec 28             	sub    $0x28,%esp
+  801179:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  80117c:	56                   	push   %esi
+  80117d:	e8 ce f2 ff ff       	call   800450 <fd2data>
+  801182:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801184:	83 c4 10             	add    $0x10,%esp
+  801187:	bf 00 00 00 00       	mov    $0x0,%edi
+  80118c:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  80118f:	75 09                	jne    80119a <devpipe_write+0x2a>
+	return i;
+  801191:	89 f8                	mov    %edi,%eax
+  801193:	eb 23                	jmp    8011b8 <devpipe_write+0x48>
+			sys_yield();
+  801195:	e8 b4 ef ff ff       	call   80014e <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80119a:	8b 43 04             	mov    0x4(%ebx),%eax
+  80119d:	8b 0b                	mov    (%ebx),%ecx
+  80119f:	8d 51 20             	lea    0x20(%ecx),%edx
+  8011a2:	39 d0                	cmp    %edx,%eax
+  8011a4:	72 1a                	jb     8011c0 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8011a6:	89 da                	mov    %ebx,%edx
+  8011a8:	89 f0                	mov    %esi,%eax
+  8011aa:	e8 5c ff ff ff       	call   80110b <_pipeisclosed>
+  8011af:	85 c0                	test   %eax,%eax
+  8011b1:	74 e2                	je     801195 <devpipe_write+0x25>
+				return 0;
+  8011b3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011bb:	5b                   	pop    %ebx
+  8011bc:	5e                   	pop    %esi
+  8011bd:	5f                   	pop    %edi
+  8011be:	5d                   	pop    %ebp
+  8011bf:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8011c0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011c3:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8011c7:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8011ca:	89 c2                	mov    %eax,%edx
+  8011cc:	c1 fa 1f             	sar    $0x1f,%edx
+  8011cf:	89 d1                	mov    %edx,%ecx
+  8011d1:	c1 e9 1b             	shr    $0x1b,%ecx
+  8011d4:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8011d7:	83 e2 1f             	and    $0x1f,%edx
+  8011da:	29 ca                	sub    %ecx,%edx
+  8011dc:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8011e0:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8011e4:	83 c0 01             	add    $0x1,%eax
+  8011e7:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8011ea:	83 c7 01             	add    $0x1,%edi
+  8011ed:	eb 9d                	jmp    80118c <devpipe_write+0x1c>
+
+008011ef <devpipe_read>:
+{
+  8011ef:	55                   	push   %ebp
+  8011f0:	89 e5                	mov    %esp,%ebp
+  8011f2:	57                   	push   %edi
+  8011f3:	56                   	push   %esi
+  8011f4:	53                   	push   %ebx
+  8011f5:	83 ec 18             	sub    $0x18,%esp
+  8011f8:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8011fb:	57                   	push   %edi
+  8011fc:	e8 4f f2 ff ff       	call   800450 <fd2data>
+  801201:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801203:	83 c4 10             	add    $0x10,%esp
+  801206:	be 00 00 00 00       	mov    $0x0,%esi
+  80120b:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80120e:	75 13                	jne    801223 <devpipe_read+0x34>
+	return i;
+  801210:	89 f0                	mov    %esi,%eax
+  801212:	eb 02                	jmp    801216 <devpipe_read+0x27>
+				return i;
+  801214:	89 f0                	mov    %esi,%eax
+}
+  801216:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801219:	5b                   	pop    %ebx
+  80121a:	5e                   	pop    %esi
+  80121b:	5f                   	pop    %edi
+  80121c:	5d                   	pop    %ebp
+  80121d:	c3                   	ret
+			sys_yield();
+  80121e:	e8 2b ef ff ff       	call   80014e <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  801223:	8b 03                	mov    (%ebx),%eax
+  801225:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801228:	75 18                	jne    801242 <devpipe_read+0x53>
+			if (i > 0)
+  80122a:	85 f6                	test   %esi,%esi
+  80122c:	75 e6                	jne    801214 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  80122e:	89 da                	mov    %ebx,%edx
+  801230:	89 f8                	mov    %edi,%eax
+  801232:	e8 d4 fe ff ff       	call   80110b <_pipeisclosed>
+  801237:	85 c0                	test   %eax,%eax
+  801239:	74 e3                	je     80121e <devpipe_read+0x2f>
+				return 0;
+  80123b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801240:	eb d4                	jmp    801216 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801242:	99                   	cltd
+  801243:	c1 ea 1b             	shr    $0x1b,%edx
+  801246:	01 d0                	add    %edx,%eax
+  801248:	83 e0 1f             	and    $0x1f,%eax
+  80124b:	29 d0                	sub    %edx,%eax
+  80124d:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801252:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801255:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  801258:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80125b:	83 c6 01             	add    $0x1,%esi
+  80125e:	eb ab                	jmp    80120b <devpipe_read+0x1c>
+
+00801260 <pipe>:
+{
+  801260:	55                   	push   %ebp
+  801261:	89 e5                	mov    %esp,%ebp
+  801263:	56                   	push   %esi
+  801264:	53                   	push   %ebx
+  801265:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801268:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80126b:	50                   	push   %eax
+  80126c:	e8 f6 f1 ff ff       	call   800467 <fd_alloc>
+  801271:	89 c3                	mov    %eax,%ebx
+  801273:	83 c4 10             	add    $0x10,%esp
+  801276:	85 c0                	test   %eax,%eax
+  801278:	0f 88 23 01 00 00    	js     8013a1 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80127e:	83 ec 04             	sub    $0x4,%esp
+  801281:	68 07 04 00 00       	push   $0x407
+  801286:	ff 75 f4             	push   -0xc(%ebp)
+  801289:	6a 00                	push   $0x0
+  80128b:	e8 dd ee ff ff       	call   80016d <sys_page_alloc>
+  801290:	89 c3                	mov    %eax,%ebx
+  801292:	83 c4 10             	add    $0x10,%esp
+  801295:	85 c0                	test   %eax,%eax
+  801297:	0f 88 04 01 00 00    	js     8013a1 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80129d:	83 ec 0c             	sub    $0xc,%esp
+  8012a0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8012a3:	50                   	push   %eax
+  8012a4:	e8 be f1 ff ff       	call   800467 <fd_alloc>
+  8012a9:	89 c3                	mov    %eax,%ebx
+  8012ab:	83 c4 10             	add    $0x10,%esp
+  8012ae:	85 c0                	test   %eax,%eax
+  8012b0:	0f 88 db 00 00 00    	js     801391 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8012b6:	83 ec 04             	sub    $0x4,%esp
+  8012b9:	68 07 04 00 00       	push   $0x407
+  8012be:	ff 75 f0             	push   -0x10(%ebp)
+  8012c1:	6a 00                	push   $0x0
+  8012c3:	e8 a5 ee ff ff       	call   80016d <sys_page_alloc>
+  8012c8:	89 c3                	mov    %eax,%ebx
+  8012ca:	83 c4 10             	add    $0x10,%esp
+  8012cd:	85 c0                	test   %eax,%eax
+  8012cf:	0f 88 bc 00 00 00    	js     801391 <pipe+0x131>
+	va = fd2data(fd0);
+  8012d5:	83 ec 0c             	sub    $0xc,%esp
+  8012d8:	ff 75 f4             	push   -0xc(%ebp)
+  8012db:	e8 70 f1 ff ff       	call   800450 <fd2data>
+  8012e0:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8012e2:	83 c4 0c             	add    $0xc,%esp
+  8012e5:	68 07 04 00 00       	push   $0x407
+  8012ea:	50                   	push   %eax
+  8012eb:	6a 00                	push   $0x0
+  8012ed:	e8 7b ee ff ff       	call   80016d <sys_page_alloc>
+  8012f2:	89 c3                	mov    %eax,%ebx
+  8012f4:	83 c4 10             	add    $0x10,%esp
+  8012f7:	85 c0                	test   %eax,%eax
+  8012f9:	0f 88 82 00 00 00    	js     801381 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8012ff:	83 ec 0c             	sub    $0xc,%esp
+  801302:	ff 75 f0             	push   -0x10(%ebp)
+  801305:	e8 46 f1 ff ff       	call   800450 <fd2data>
+  80130a:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801311:	50                   	push   %eax
+  801312:	6a 00                	push   $0x0
+  801314:	56                   	push   %esi
+  801315:	6a 00                	push   $0x0
+  801317:	e8 94 ee ff ff       	call   8001b0 <sys_page_map>
+  80131c:	89 c3                	mov    %eax,%ebx
+  80131e:	83 c4 20             	add    $0x20,%esp
+  801321:	85 c0                	test   %eax,%eax
+  801323:	78 4e                	js     801373 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  801325:	a1 40 30 80 00       	mov    0x803040,%eax
+  80132a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80132d:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80132f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801332:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  801339:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80133c:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80133e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801341:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  801348:	83 ec 0c             	sub    $0xc,%esp
+  80134b:	ff 75 f4             	push   -0xc(%ebp)
+  80134e:	e8 ed f0 ff ff       	call   800440 <fd2num>
+  801353:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801356:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  801358:	83 c4 04             	add    $0x4,%esp
+  80135b:	ff 75 f0             	push   -0x10(%ebp)
+  80135e:	e8 dd f0 ff ff       	call   800440 <fd2num>
+  801363:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801366:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  801369:	83 c4 10             	add    $0x10,%esp
+  80136c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801371:	eb 2e                	jmp    8013a1 <pipe+0x141>
+	sys_page_unmap(0, va);
+  801373:	83 ec 08             	sub    $0x8,%esp
+  801376:	56                   	push   %esi
+  801377:	6a 00                	push   $0x0
+  801379:	e8 74 ee ff ff       	call   8001f2 <sys_page_unmap>
+  80137e:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  801381:	83 ec 08             	sub    $0x8,%esp
+  801384:	ff 75 f0             	push   -0x10(%ebp)
+  801387:	6a 00                	push   $0x0
+  801389:	e8 64 ee ff ff       	call   8001f2 <sys_page_unmap>
+  80138e:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  801391:	83 ec 08             	sub    $0x8,%esp
+  801394:	ff 75 f4             	push   -0xc(%ebp)
+  801397:	6a 00                	push   $0x0
+  801399:	e8 54 ee ff ff       	call   8001f2 <sys_page_unmap>
+  80139e:	83 c4 10             	add    $0x10,%esp
+}
+  8013a1:	89 d8                	mov    %ebx,%eax
+  8013a3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013a6:	5b                   	pop    %ebx
+  8013a7:	5e                   	pop    %esi
+  8013a8:	5d                   	pop    %ebp
+  8013a9:	c3                   	ret
+
+008013aa <pipeisclosed>:
+{
+  8013aa:	55                   	push   %ebp
+  8013ab:	89 e5                	mov    %esp,%ebp
+  8013ad:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8013b0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013b3:	50                   	push   %eax
+  8013b4:	ff 75 08             	push   0x8(%ebp)
+  8013b7:	e8 01 f1 ff ff       	call   8004bd <fd_lookup>
+  8013bc:	83 c4 10             	add    $0x10,%esp
+  8013bf:	85 c0                	test   %eax,%eax
+  8013c1:	78 18                	js     8013db <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8013c3:	83 ec 0c             	sub    $0xc,%esp
+  8013c6:	ff 75 f4             	push   -0xc(%ebp)
+  8013c9:	e8 82 f0 ff ff       	call   800450 <fd2data>
+  8013ce:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8013d0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013d3:	e8 33 fd ff ff       	call   80110b <_pipeisclosed>
+  8013d8:	83 c4 10             	add    $0x10,%esp
+}
+  8013db:	c9                   	leave
+  8013dc:	c3                   	ret
+
+008013dd <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8013dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013e2:	c3                   	ret
+
+008013e3 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8013e3:	55                   	push   %ebp
+  8013e4:	89 e5                	mov    %esp,%ebp
+  8013e6:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8013e9:	68 5f 26 80 00       	push   $0x80265f
+  8013ee:	ff 75 0c             	push   0xc(%ebp)
+  8013f1:	e8 ef 07 00 00       	call   801be5 <strcpy>
+	return 0;
+}
+  8013f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013fb:	c9                   	leave
+  8013fc:	c3                   	ret
+
+008013fd <devcons_write>:
+{
+  8013fd:	55                   	push   %ebp
+  8013fe:	89 e5                	mov    %esp,%ebp
+  801400:	57                   	push   %edi
+  801401:	56                   	push   %esi
+  801402:	53                   	push   %ebx
+  801403:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  801409:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80140e:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  801414:	eb 2e                	jmp    801444 <devcons_write+0x47>
+		m = n - tot;
+  801416:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801419:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80141b:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801420:	39 c3                	cmp    %eax,%ebx
+  801422:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  801425:	83 ec 04             	sub    $0x4,%esp
+  801428:	53                   	push   %ebx
+  801429:	89 f0                	mov    %esi,%eax
+  80142b:	03 45 0c             	add    0xc(%ebp),%eax
+  80142e:	50                   	push   %eax
+  80142f:	57                   	push   %edi
+  801430:	e8 36 09 00 00       	call   801d6b <memmove>
+		sys_cputs(buf, m);
+  801435:	83 c4 08             	add    $0x8,%esp
+  801438:	53                   	push   %ebx
+  801439:	57                   	push   %edi
+  80143a:	e8 72 ec ff ff       	call   8000b1 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80143f:	01 de                	add    %ebx,%esi
+  801441:	83 c4 10             	add    $0x10,%esp
+  801444:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801447:	72 cd                	jb     801416 <devcons_write+0x19>
+}
+  801449:	89 f0                	mov    %esi,%eax
+  80144b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80144e:	5b                   	pop    %ebx
+  80144f:	5e                   	pop    %esi
+  801450:	5f                   	pop    %edi
+  801451:	5d                   	pop    %ebp
+  801452:	c3                   	ret
+
+00801453 <devcons_read>:
+{
+  801453:	55                   	push   %ebp
+  801454:	89 e5                	mov    %esp,%ebp
+  801456:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  801459:	b8 00 00 00 00       	mov    $0x0,%eax
+  80145e:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801462:	75 07                	jne    80146b <devcons_read+0x18>
+  801464:	eb 1f                	jmp    801485 <devcons_read+0x32>
+		sys_yield();
+  801466:	e8 e3 ec ff ff       	call   80014e <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80146b:	e8 5f ec ff ff       	call   8000cf <sys_cgetc>
+  801470:	85 c0                	test   %eax,%eax
+  801472:	74 f2                	je     801466 <devcons_read+0x13>
+	if (c < 0)
+  801474:	78 0f                	js     801485 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  801476:	83 f8 04             	cmp    $0x4,%eax
+  801479:	74 0c                	je     801487 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80147b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80147e:	88 02                	mov    %al,(%edx)
+	return 1;
+  801480:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  801485:	c9                   	leave
+  801486:	c3                   	ret
+		return 0;
+  801487:	b8 00 00 00 00       	mov    $0x0,%eax
+  80148c:	eb f7                	jmp    801485 <devcons_read+0x32>
+
+0080148e <cputchar>:
+{
+  80148e:	55                   	push   %ebp
+  80148f:	89 e5                	mov    %esp,%ebp
+  801491:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  801494:	8b 45 08             	mov    0x8(%ebp),%eax
+  801497:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80149a:	6a 01                	push   $0x1
+  80149c:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80149f:	50                   	push   %eax
+  8014a0:	e8 0c ec ff ff       	call   8000b1 <sys_cputs>
+}
+  8014a5:	83 c4 10             	add    $0x10,%esp
+  8014a8:	c9                   	leave
+  8014a9:	c3                   	ret
+
+008014aa <getchar>:
+{
+  8014aa:	55                   	push   %ebp
+  8014ab:	89 e5                	mov    %esp,%ebp
+  8014ad:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8014b0:	6a 01                	push   $0x1
+  8014b2:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8014b5:	50                   	push   %eax
+  8014b6:	6a 00                	push   $0x0
+  8014b8:	e8 66 f2 ff ff       	call   800723 <read>
+	if (r < 0)
+  8014bd:	83 c4 10             	add    $0x10,%esp
+  8014c0:	85 c0                	test   %eax,%eax
+  8014c2:	78 06                	js     8014ca <getchar+0x20>
+	if (r < 1)
+  8014c4:	74 06                	je     8014cc <getchar+0x22>
+	return c;
+  8014c6:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8014ca:	c9                   	leave
+  8014cb:	c3                   	ret
+		return -E_EOF;
+  8014cc:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8014d1:	eb f7                	jmp    8014ca <getchar+0x20>
+
+008014d3 <iscons>:
+{
+  8014d3:	55                   	push   %ebp
+  8014d4:	89 e5                	mov    %esp,%ebp
+  8014d6:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8014d9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014dc:	50                   	push   %eax
+  8014dd:	ff 75 08             	push   0x8(%ebp)
+  8014e0:	e8 d8 ef ff ff       	call   8004bd <fd_lookup>
+  8014e5:	83 c4 10             	add    $0x10,%esp
+  8014e8:	85 c0                	test   %eax,%eax
+  8014ea:	78 11                	js     8014fd <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8014ec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014ef:	8b 15 5c 30 80 00    	mov    0x80305c,%edx
+  8014f5:	39 10                	cmp    %edx,(%eax)
+  8014f7:	0f 94 c0             	sete   %al
+  8014fa:	0f b6 c0             	movzbl %al,%eax
+}
+  8014fd:	c9                   	leave
+  8014fe:	c3                   	ret
+
+008014ff <opencons>:
+{
+  8014ff:	55                   	push   %ebp
+  801500:	89 e5                	mov    %esp,%ebp
+  801502:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  801505:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801508:	50                   	push   %eax
+  801509:	e8 59 ef ff ff       	call   800467 <fd_alloc>
+  80150e:	83 c4 10             	add    $0x10,%esp
+  801511:	85 c0                	test   %eax,%eax
+  801513:	78 3a                	js     80154f <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  801515:	83 ec 04             	sub    $0x4,%esp
+  801518:	68 07 04 00 00       	push   $0x407
+  80151d:	ff 75 f4             	push   -0xc(%ebp)
+  801520:	6a 00                	push   $0x0
+  801522:	e8 46 ec ff ff       	call   80016d <sys_page_alloc>
+  801527:	83 c4 10             	add    $0x10,%esp
+  80152a:	85 c0                	test   %eax,%eax
+  80152c:	78 21                	js     80154f <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80152e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801531:	8b 15 5c 30 80 00    	mov    0x80305c,%edx
+  801537:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  801539:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80153c:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  801543:	83 ec 0c             	sub    $0xc,%esp
+  801546:	50                   	push   %eax
+  801547:	e8 f4 ee ff ff       	call   800440 <fd2num>
+  80154c:	83 c4 10             	add    $0x10,%esp
+}
+  80154f:	c9                   	leave
+  801550:	c3                   	ret
+
+00801551 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  801551:	55                   	push   %ebp
+  801552:	89 e5                	mov    %esp,%ebp
+  801554:	56                   	push   %esi
+  801555:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  801556:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  801559:	8b 35 04 30 80 00    	mov    0x803004,%esi
+  80155f:	e8 cb eb ff ff       	call   80012f <sys_getenvid>
+  801564:	83 ec 0c             	sub    $0xc,%esp
+  801567:	ff 75 0c             	push   0xc(%ebp)
+  80156a:	ff 75 08             	push   0x8(%ebp)
+  80156d:	56                   	push   %esi
+  80156e:	50                   	push   %eax
+  80156f:	68 6c 26 80 00       	push   $0x80266c
+  801574:	e8 b3 00 00 00       	call   80162c <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  801579:	83 c4 18             	add    $0x18,%esp
+  80157c:	53                   	push   %ebx
+  80157d:	ff 75 10             	push   0x10(%ebp)
+  801580:	e8 56 00 00 00       	call   8015db <vcprintf>
+	cprintf("\n");
+  801585:	c7 04 24 58 26 80 00 	movl   $0x802658,(%esp)
+  80158c:	e8 9b 00 00 00       	call   80162c <cprintf>
+  801591:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  801594:	cc                   	int3
+	while (1)
+  801595:	eb fd                	jmp    801594 <_panic+0x43>
+
+00801597 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  801597:	55                   	push   %ebp
+  801598:	89 e5                	mov    %esp,%ebp
+  80159a:	53                   	push   %ebx
+  80159b:	83 ec 04             	sub    $0x4,%esp
+  80159e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8015a1:	8b 13                	mov    (%ebx),%edx
+  8015a3:	8d 42 01             	lea    0x1(%edx),%eax
+  8015a6:	89 03                	mov    %eax,(%ebx)
+  8015a8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8015ab:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8015af:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8015b4:	74 09                	je     8015bf <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8015b6:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8015ba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015bd:	c9                   	leave
+  8015be:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8015bf:	83 ec 08             	sub    $0x8,%esp
+  8015c2:	68 ff 00 00 00       	push   $0xff
+  8015c7:	8d 43 08             	lea    0x8(%ebx),%eax
+  8015ca:	50                   	push   %eax
+  8015cb:	e8 e1 ea ff ff       	call   8000b1 <sys_cputs>
+		b->idx = 0;
+  8015d0:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8015d6:	83 c4 10             	add    $0x10,%esp
+  8015d9:	eb db                	jmp    8015b6 <putch+0x1f>
+
+008015db <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8015db:	55                   	push   %ebp
+  8015dc:	89 e5                	mov    %esp,%ebp
+  8015de:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8015e4:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8015eb:	00 00 00 
+	b.cnt = 0;
+  8015ee:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8015f5:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8015f8:	ff 75 0c             	push   0xc(%ebp)
+  8015fb:	ff 75 08             	push   0x8(%ebp)
+  8015fe:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  801604:	50                   	push   %eax
+  801605:	68 97 15 80 00       	push   $0x801597
+  80160a:	e8 14 01 00 00       	call   801723 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80160f:	83 c4 08             	add    $0x8,%esp
+  801612:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  801618:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80161e:	50                   	push   %eax
+  80161f:	e8 8d ea ff ff       	call   8000b1 <sys_cputs>
+
+	return b.cnt;
+}
+  801624:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80162a:	c9                   	leave
+  80162b:	c3                   	ret
+
+0080162c <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80162c:	55                   	push   %ebp
+  80162d:	89 e5                	mov    %esp,%ebp
+  80162f:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  801632:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  801635:	50                   	push   %eax
+  801636:	ff 75 08             	push   0x8(%ebp)
+  801639:	e8 9d ff ff ff       	call   8015db <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80163e:	c9                   	leave
+  80163f:	c3                   	ret
+
+00801640 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  801640:	55                   	push   %ebp
+  801641:	89 e5                	mov    %esp,%ebp
+  801643:	57                   	push   %edi
+  801644:	56                   	push   %esi
+  801645:	53                   	push   %ebx
+  801646:	83 ec 1c             	sub    $0x1c,%esp
+  801649:	89 c7                	mov    %eax,%edi
+  80164b:	89 d6                	mov    %edx,%esi
+  80164d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801650:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801653:	89 d1                	mov    %edx,%ecx
+  801655:	89 c2                	mov    %eax,%edx
+  801657:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80165a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80165d:	8b 45 10             	mov    0x10(%ebp),%eax
+  801660:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  801663:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801666:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80166d:	39 c2                	cmp    %eax,%edx
+  80166f:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  801672:	72 3e                	jb     8016b2 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  801674:	83 ec 0c             	sub    $0xc,%esp
+  801677:	ff 75 18             	push   0x18(%ebp)
+  80167a:	83 eb 01             	sub    $0x1,%ebx
+  80167d:	53                   	push   %ebx
+  80167e:	50                   	push   %eax
+  80167f:	83 ec 08             	sub    $0x8,%esp
+  801682:	ff 75 e4             	push   -0x1c(%ebp)
+  801685:	ff 75 e0             	push   -0x20(%ebp)
+  801688:	ff 75 dc             	push   -0x24(%ebp)
+  80168b:	ff 75 d8             	push   -0x28(%ebp)
+  80168e:	e8 dd 0a 00 00       	call   802170 <__udivdi3>
+  801693:	83 c4 18             	add    $0x18,%esp
+  801696:	52                   	push   %edx
+  801697:	50                   	push   %eax
+  801698:	89 f2                	mov    %esi,%edx
+  80169a:	89 f8                	mov    %edi,%eax
+  80169c:	e8 9f ff ff ff       	call   801640 <printnum>
+  8016a1:	83 c4 20             	add    $0x20,%esp
+  8016a4:	eb 13                	jmp    8016b9 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8016a6:	83 ec 08             	sub    $0x8,%esp
+  8016a9:	56                   	push   %esi
+  8016aa:	ff 75 18             	push   0x18(%ebp)
+  8016ad:	ff d7                	call   *%edi
+  8016af:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8016b2:	83 eb 01             	sub    $0x1,%ebx
+  8016b5:	85 db                	test   %ebx,%ebx
+  8016b7:	7f ed                	jg     8016a6 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8016b9:	83 ec 08             	sub    $0x8,%esp
+  8016bc:	56                   	push   %esi
+  8016bd:	83 ec 04             	sub    $0x4,%esp
+  8016c0:	ff 75 e4             	push   -0x1c(%ebp)
+  8016c3:	ff 75 e0             	push   -0x20(%ebp)
+  8016c6:	ff 75 dc             	push   -0x24(%ebp)
+  8016c9:	ff 75 d8             	push   -0x28(%ebp)
+  8016cc:	e8 6f 0b 00 00       	call   802240 <__umoddi3>
+  8016d1:	83 c4 14             	add    $0x14,%esp
+  8016d4:	0f be 80 8f 26 80 00 	movsbl 0x80268f(%eax),%eax
+  8016db:	50                   	push   %eax
+  8016dc:	ff d7                	call   *%edi
+}
+  8016de:	83 c4 10             	add    $0x10,%esp
+  8016e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016e4:	5b                   	pop    %ebx
+  8016e5:	5e                   	pop    %esi
+  8016e6:	5f                   	pop    %edi
+  8016e7:	5d                   	pop    %ebp
+  8016e8:	c3                   	ret
+
+008016e9 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8016e9:	55                   	push   %ebp
+  8016ea:	89 e5                	mov    %esp,%ebp
+  8016ec:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8016ef:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8016f3:	8b 10                	mov    (%eax),%edx
+  8016f5:	3b 50 04             	cmp    0x4(%eax),%edx
+  8016f8:	73 0a                	jae    801704 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8016fa:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8016fd:	89 08                	mov    %ecx,(%eax)
+  8016ff:	8b 45 08             	mov    0x8(%ebp),%eax
+  801702:	88 02                	mov    %al,(%edx)
+}
+  801704:	5d                   	pop    %ebp
+  801705:	c3                   	ret
+
+00801706 <printfmt>:
+{
+  801706:	55                   	push   %ebp
+  801707:	89 e5                	mov    %esp,%ebp
+  801709:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80170c:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80170f:	50                   	push   %eax
+  801710:	ff 75 10             	push   0x10(%ebp)
+  801713:	ff 75 0c             	push   0xc(%ebp)
+  801716:	ff 75 08             	push   0x8(%ebp)
+  801719:	e8 05 00 00 00       	call   801723 <vprintfmt>
+}
+  80171e:	83 c4 10             	add    $0x10,%esp
+  801721:	c9                   	leave
+  801722:	c3                   	ret
+
+00801723 <vprintfmt>:
+{
+  801723:	55                   	push   %ebp
+  801724:	89 e5                	mov    %esp,%ebp
+  801726:	57                   	push   %edi
+  801727:	56                   	push   %esi
+  801728:	53                   	push   %ebx
+  801729:	83 ec 2c             	sub    $0x2c,%esp
+  80172c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80172f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801732:	8b 7d 10             	mov    0x10(%ebp),%edi
+  801735:	eb 0a                	jmp    801741 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  801737:	83 ec 08             	sub    $0x8,%esp
+  80173a:	53                   	push   %ebx
+  80173b:	50                   	push   %eax
+  80173c:	ff d6                	call   *%esi
+  80173e:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801741:	83 c7 01             	add    $0x1,%edi
+  801744:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  801748:	83 f8 25             	cmp    $0x25,%eax
+  80174b:	74 0c                	je     801759 <vprintfmt+0x36>
+			if (ch == '\0')
+  80174d:	85 c0                	test   %eax,%eax
+  80174f:	75 e6                	jne    801737 <vprintfmt+0x14>
+}
+  801751:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801754:	5b                   	pop    %ebx
+  801755:	5e                   	pop    %esi
+  801756:	5f                   	pop    %edi
+  801757:	5d                   	pop    %ebp
+  801758:	c3                   	ret
+		padc = ' ';
+  801759:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80175d:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  801764:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80176b:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  801772:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801777:	8d 47 01             	lea    0x1(%edi),%eax
+  80177a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80177d:	0f b6 17             	movzbl (%edi),%edx
+  801780:	8d 42 dd             	lea    -0x23(%edx),%eax
+  801783:	3c 55                	cmp    $0x55,%al
+  801785:	0f 87 9a 03 00 00    	ja     801b25 <vprintfmt+0x402>
+  80178b:	0f b6 c0             	movzbl %al,%eax
+  80178e:	ff 24 85 e0 27 80 00 	jmp    *0x8027e0(,%eax,4)
+  801795:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  801798:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80179c:	eb d9                	jmp    801777 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80179e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8017a1:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8017a5:	eb d0                	jmp    801777 <vprintfmt+0x54>
+  8017a7:	0f b6 d2             	movzbl %dl,%edx
+  8017aa:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8017ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017b2:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8017b5:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8017b8:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8017bc:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8017bf:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8017c2:	83 f9 09             	cmp    $0x9,%ecx
+  8017c5:	77 55                	ja     80181c <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8017c7:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8017ca:	eb e9                	jmp    8017b5 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8017cc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8017cf:	8b 00                	mov    (%eax),%eax
+  8017d1:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8017d4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8017d7:	8d 40 04             	lea    0x4(%eax),%eax
+  8017da:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8017dd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8017e0:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8017e4:	79 91                	jns    801777 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8017e6:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8017e9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8017ec:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8017f3:	eb 82                	jmp    801777 <vprintfmt+0x54>
+			if (width < 0)
+  8017f5:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8017f8:	85 d2                	test   %edx,%edx
+  8017fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017ff:	0f 49 c2             	cmovns %edx,%eax
+  801802:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  801805:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  801808:	e9 6a ff ff ff       	jmp    801777 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80180d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  801810:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  801817:	e9 5b ff ff ff       	jmp    801777 <vprintfmt+0x54>
+  80181c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80181f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801822:	eb bc                	jmp    8017e0 <vprintfmt+0xbd>
+			lflag++;
+  801824:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801827:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80182a:	e9 48 ff ff ff       	jmp    801777 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80182f:	8b 45 14             	mov    0x14(%ebp),%eax
+  801832:	8d 78 04             	lea    0x4(%eax),%edi
+  801835:	83 ec 08             	sub    $0x8,%esp
+  801838:	53                   	push   %ebx
+  801839:	ff 30                	push   (%eax)
+  80183b:	ff d6                	call   *%esi
+			break;
+  80183d:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  801840:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  801843:	e9 7c 02 00 00       	jmp    801ac4 <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  801848:	8b 45 14             	mov    0x14(%ebp),%eax
+  80184b:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80184e:	8b 10                	mov    (%eax),%edx
+  801850:	89 d0                	mov    %edx,%eax
+  801852:	f7 d8                	neg    %eax
+  801854:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  801857:	83 f8 10             	cmp    $0x10,%eax
+  80185a:	7f 23                	jg     80187f <vprintfmt+0x15c>
+  80185c:	8b 14 85 40 29 80 00 	mov    0x802940(,%eax,4),%edx
+  801863:	85 d2                	test   %edx,%edx
+  801865:	74 18                	je     80187f <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  801867:	52                   	push   %edx
+  801868:	68 ed 25 80 00       	push   $0x8025ed
+  80186d:	53                   	push   %ebx
+  80186e:	56                   	push   %esi
+  80186f:	e8 92 fe ff ff       	call   801706 <printfmt>
+  801874:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801877:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80187a:	e9 45 02 00 00       	jmp    801ac4 <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  80187f:	50                   	push   %eax
+  801880:	68 a7 26 80 00       	push   $0x8026a7
+  801885:	53                   	push   %ebx
+  801886:	56                   	push   %esi
+  801887:	e8 7a fe ff ff       	call   801706 <printfmt>
+  80188c:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80188f:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  801892:	e9 2d 02 00 00       	jmp    801ac4 <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801897:	8b 45 14             	mov    0x14(%ebp),%eax
+  80189a:	83 c0 04             	add    $0x4,%eax
+  80189d:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8018a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8018a3:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8018a5:	85 c9                	test   %ecx,%ecx
+  8018a7:	b8 a0 26 80 00       	mov    $0x8026a0,%eax
+  8018ac:	0f 45 c1             	cmovne %ecx,%eax
+  8018af:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8018b2:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8018b6:	7e 06                	jle    8018be <vprintfmt+0x19b>
+  8018b8:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8018bc:	75 0b                	jne    8018c9 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8018be:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8018c1:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8018c4:	89 75 08             	mov    %esi,0x8(%ebp)
+  8018c7:	eb 5c                	jmp    801925 <vprintfmt+0x202>
+  8018c9:	83 ec 08             	sub    $0x8,%esp
+  8018cc:	ff 75 d0             	push   -0x30(%ebp)
+  8018cf:	ff 75 cc             	push   -0x34(%ebp)
+  8018d2:	e8 eb 02 00 00       	call   801bc2 <strnlen>
+  8018d7:	89 c2                	mov    %eax,%edx
+  8018d9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8018dc:	29 d0                	sub    %edx,%eax
+  8018de:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8018e1:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8018e5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8018e8:	89 75 08             	mov    %esi,0x8(%ebp)
+  8018eb:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8018ed:	eb 0e                	jmp    8018fd <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8018ef:	83 ec 08             	sub    $0x8,%esp
+  8018f2:	53                   	push   %ebx
+  8018f3:	57                   	push   %edi
+  8018f4:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8018f7:	83 ee 01             	sub    $0x1,%esi
+  8018fa:	83 c4 10             	add    $0x10,%esp
+  8018fd:	85 f6                	test   %esi,%esi
+  8018ff:	7f ee                	jg     8018ef <vprintfmt+0x1cc>
+  801901:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801904:	8b 75 08             	mov    0x8(%ebp),%esi
+  801907:	85 c0                	test   %eax,%eax
+  801909:	ba 00 00 00 00       	mov    $0x0,%edx
+  80190e:	0f 49 d0             	cmovns %eax,%edx
+  801911:	29 d0                	sub    %edx,%eax
+  801913:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801916:	eb a6                	jmp    8018be <vprintfmt+0x19b>
+					putch(ch, putdat);
+  801918:	83 ec 08             	sub    $0x8,%esp
+  80191b:	53                   	push   %ebx
+  80191c:	52                   	push   %edx
+  80191d:	ff 55 08             	call   *0x8(%ebp)
+  801920:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801923:	89 f1                	mov    %esi,%ecx
+  801925:	8d 71 01             	lea    0x1(%ecx),%esi
+  801928:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80192c:	0f be d0             	movsbl %al,%edx
+  80192f:	85 d2                	test   %edx,%edx
+  801931:	74 28                	je     80195b <vprintfmt+0x238>
+  801933:	85 ff                	test   %edi,%edi
+  801935:	78 05                	js     80193c <vprintfmt+0x219>
+  801937:	83 ef 01             	sub    $0x1,%edi
+  80193a:	78 30                	js     80196c <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80193c:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  801940:	74 d6                	je     801918 <vprintfmt+0x1f5>
+  801942:	0f be c0             	movsbl %al,%eax
+  801945:	83 e8 20             	sub    $0x20,%eax
+  801948:	83 f8 5e             	cmp    $0x5e,%eax
+  80194b:	76 cb                	jbe    801918 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80194d:	83 ec 08             	sub    $0x8,%esp
+  801950:	53                   	push   %ebx
+  801951:	6a 3f                	push   $0x3f
+  801953:	ff 55 08             	call   *0x8(%ebp)
+  801956:	83 c4 10             	add    $0x10,%esp
+  801959:	eb c8                	jmp    801923 <vprintfmt+0x200>
+  80195b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80195e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  801961:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801964:	01 d0                	add    %edx,%eax
+  801966:	29 c8                	sub    %ecx,%eax
+  801968:	89 c7                	mov    %eax,%edi
+  80196a:	eb 13                	jmp    80197f <vprintfmt+0x25c>
+  80196c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80196f:	eb ed                	jmp    80195e <vprintfmt+0x23b>
+				putch(' ', putdat);
+  801971:	83 ec 08             	sub    $0x8,%esp
+  801974:	53                   	push   %ebx
+  801975:	6a 20                	push   $0x20
+  801977:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  801979:	83 ef 01             	sub    $0x1,%edi
+  80197c:	83 c4 10             	add    $0x10,%esp
+  80197f:	85 ff                	test   %edi,%edi
+  801981:	7f ee                	jg     801971 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801983:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  801986:	89 45 14             	mov    %eax,0x14(%ebp)
+  801989:	e9 36 01 00 00       	jmp    801ac4 <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  80198e:	83 f9 01             	cmp    $0x1,%ecx
+  801991:	7f 1f                	jg     8019b2 <vprintfmt+0x28f>
+	else if (lflag)
+  801993:	85 c9                	test   %ecx,%ecx
+  801995:	74 67                	je     8019fe <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  801997:	8b 45 14             	mov    0x14(%ebp),%eax
+  80199a:	8b 00                	mov    (%eax),%eax
+  80199c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80199f:	89 c1                	mov    %eax,%ecx
+  8019a1:	c1 f9 1f             	sar    $0x1f,%ecx
+  8019a4:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8019a7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019aa:	8d 40 04             	lea    0x4(%eax),%eax
+  8019ad:	89 45 14             	mov    %eax,0x14(%ebp)
+  8019b0:	eb 17                	jmp    8019c9 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8019b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019b5:	8b 50 04             	mov    0x4(%eax),%edx
+  8019b8:	8b 00                	mov    (%eax),%eax
+  8019ba:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8019bd:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8019c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019c3:	8d 40 08             	lea    0x8(%eax),%eax
+  8019c6:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8019c9:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8019cc:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8019cf:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8019d4:	85 c9                	test   %ecx,%ecx
+  8019d6:	0f 89 ce 00 00 00    	jns    801aaa <vprintfmt+0x387>
+				putch('-', putdat);
+  8019dc:	83 ec 08             	sub    $0x8,%esp
+  8019df:	53                   	push   %ebx
+  8019e0:	6a 2d                	push   $0x2d
+  8019e2:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8019e4:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8019e7:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8019ea:	f7 da                	neg    %edx
+  8019ec:	83 d1 00             	adc    $0x0,%ecx
+  8019ef:	f7 d9                	neg    %ecx
+  8019f1:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8019f4:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8019f9:	e9 ac 00 00 00       	jmp    801aaa <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  8019fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a01:	8b 00                	mov    (%eax),%eax
+  801a03:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801a06:	89 c1                	mov    %eax,%ecx
+  801a08:	c1 f9 1f             	sar    $0x1f,%ecx
+  801a0b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801a0e:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a11:	8d 40 04             	lea    0x4(%eax),%eax
+  801a14:	89 45 14             	mov    %eax,0x14(%ebp)
+  801a17:	eb b0                	jmp    8019c9 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  801a19:	83 f9 01             	cmp    $0x1,%ecx
+  801a1c:	7f 1b                	jg     801a39 <vprintfmt+0x316>
+	else if (lflag)
+  801a1e:	85 c9                	test   %ecx,%ecx
+  801a20:	74 2c                	je     801a4e <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  801a22:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a25:	8b 10                	mov    (%eax),%edx
+  801a27:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a2c:	8d 40 04             	lea    0x4(%eax),%eax
+  801a2f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801a32:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  801a37:	eb 71                	jmp    801aaa <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  801a39:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a3c:	8b 10                	mov    (%eax),%edx
+  801a3e:	8b 48 04             	mov    0x4(%eax),%ecx
+  801a41:	8d 40 08             	lea    0x8(%eax),%eax
+  801a44:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801a47:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  801a4c:	eb 5c                	jmp    801aaa <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  801a4e:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a51:	8b 10                	mov    (%eax),%edx
+  801a53:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a58:	8d 40 04             	lea    0x4(%eax),%eax
+  801a5b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801a5e:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  801a63:	eb 45                	jmp    801aaa <vprintfmt+0x387>
+			putch('X', putdat);
+  801a65:	83 ec 08             	sub    $0x8,%esp
+  801a68:	53                   	push   %ebx
+  801a69:	6a 58                	push   $0x58
+  801a6b:	ff d6                	call   *%esi
+			putch('X', putdat);
+  801a6d:	83 c4 08             	add    $0x8,%esp
+  801a70:	53                   	push   %ebx
+  801a71:	6a 58                	push   $0x58
+  801a73:	ff d6                	call   *%esi
+			putch('X', putdat);
+  801a75:	83 c4 08             	add    $0x8,%esp
+  801a78:	53                   	push   %ebx
+  801a79:	6a 58                	push   $0x58
+  801a7b:	ff d6                	call   *%esi
+			break;
+  801a7d:	83 c4 10             	add    $0x10,%esp
+  801a80:	eb 42                	jmp    801ac4 <vprintfmt+0x3a1>
+			putch('0', putdat);
+  801a82:	83 ec 08             	sub    $0x8,%esp
+  801a85:	53                   	push   %ebx
+  801a86:	6a 30                	push   $0x30
+  801a88:	ff d6                	call   *%esi
+			putch('x', putdat);
+  801a8a:	83 c4 08             	add    $0x8,%esp
+  801a8d:	53                   	push   %ebx
+  801a8e:	6a 78                	push   $0x78
+  801a90:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  801a92:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a95:	8b 10                	mov    (%eax),%edx
+  801a97:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  801a9c:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  801a9f:	8d 40 04             	lea    0x4(%eax),%eax
+  801aa2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801aa5:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  801aaa:	83 ec 0c             	sub    $0xc,%esp
+  801aad:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  801ab1:	50                   	push   %eax
+  801ab2:	ff 75 e0             	push   -0x20(%ebp)
+  801ab5:	57                   	push   %edi
+  801ab6:	51                   	push   %ecx
+  801ab7:	52                   	push   %edx
+  801ab8:	89 da                	mov    %ebx,%edx
+  801aba:	89 f0                	mov    %esi,%eax
+  801abc:	e8 7f fb ff ff       	call   801640 <printnum>
+			break;
+  801ac1:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  801ac4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801ac7:	e9 75 fc ff ff       	jmp    801741 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  801acc:	83 f9 01             	cmp    $0x1,%ecx
+  801acf:	7f 1b                	jg     801aec <vprintfmt+0x3c9>
+	else if (lflag)
+  801ad1:	85 c9                	test   %ecx,%ecx
+  801ad3:	74 2c                	je     801b01 <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  801ad5:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ad8:	8b 10                	mov    (%eax),%edx
+  801ada:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801adf:	8d 40 04             	lea    0x4(%eax),%eax
+  801ae2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801ae5:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  801aea:	eb be                	jmp    801aaa <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  801aec:	8b 45 14             	mov    0x14(%ebp),%eax
+  801aef:	8b 10                	mov    (%eax),%edx
+  801af1:	8b 48 04             	mov    0x4(%eax),%ecx
+  801af4:	8d 40 08             	lea    0x8(%eax),%eax
+  801af7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801afa:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  801aff:	eb a9                	jmp    801aaa <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  801b01:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b04:	8b 10                	mov    (%eax),%edx
+  801b06:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b0b:	8d 40 04             	lea    0x4(%eax),%eax
+  801b0e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801b11:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  801b16:	eb 92                	jmp    801aaa <vprintfmt+0x387>
+			putch(ch, putdat);
+  801b18:	83 ec 08             	sub    $0x8,%esp
+  801b1b:	53                   	push   %ebx
+  801b1c:	6a 25                	push   $0x25
+  801b1e:	ff d6                	call   *%esi
+			break;
+  801b20:	83 c4 10             	add    $0x10,%esp
+  801b23:	eb 9f                	jmp    801ac4 <vprintfmt+0x3a1>
+			putch('%', putdat);
+  801b25:	83 ec 08             	sub    $0x8,%esp
+  801b28:	53                   	push   %ebx
+  801b29:	6a 25                	push   $0x25
+  801b2b:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801b2d:	83 c4 10             	add    $0x10,%esp
+  801b30:	89 f8                	mov    %edi,%eax
+  801b32:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  801b36:	74 05                	je     801b3d <vprintfmt+0x41a>
+  801b38:	83 e8 01             	sub    $0x1,%eax
+  801b3b:	eb f5                	jmp    801b32 <vprintfmt+0x40f>
+  801b3d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801b40:	eb 82                	jmp    801ac4 <vprintfmt+0x3a1>
+
+00801b42 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  801b42:	55                   	push   %ebp
+  801b43:	89 e5                	mov    %esp,%ebp
+  801b45:	83 ec 18             	sub    $0x18,%esp
+  801b48:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b4b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  801b4e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  801b51:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  801b55:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  801b58:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  801b5f:	85 c0                	test   %eax,%eax
+  801b61:	74 26                	je     801b89 <vsnprintf+0x47>
+  801b63:	85 d2                	test   %edx,%edx
+  801b65:	7e 22                	jle    801b89 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  801b67:	ff 75 14             	push   0x14(%ebp)
+  801b6a:	ff 75 10             	push   0x10(%ebp)
+  801b6d:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  801b70:	50                   	push   %eax
+  801b71:	68 e9 16 80 00       	push   $0x8016e9
+  801b76:	e8 a8 fb ff ff       	call   801723 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  801b7b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801b7e:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  801b81:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b84:	83 c4 10             	add    $0x10,%esp
+}
+  801b87:	c9                   	leave
+  801b88:	c3                   	ret
+		return -E_INVAL;
+  801b89:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b8e:	eb f7                	jmp    801b87 <vsnprintf+0x45>
+
+00801b90 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801b90:	55                   	push   %ebp
+  801b91:	89 e5                	mov    %esp,%ebp
+  801b93:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  801b96:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  801b99:	50                   	push   %eax
+  801b9a:	ff 75 10             	push   0x10(%ebp)
+  801b9d:	ff 75 0c             	push   0xc(%ebp)
+  801ba0:	ff 75 08             	push   0x8(%ebp)
+  801ba3:	e8 9a ff ff ff       	call   801b42 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  801ba8:	c9                   	leave
+  801ba9:	c3                   	ret
+
+00801baa <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  801baa:	55                   	push   %ebp
+  801bab:	89 e5                	mov    %esp,%ebp
+  801bad:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  801bb0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bb5:	eb 03                	jmp    801bba <strlen+0x10>
+		n++;
+  801bb7:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  801bba:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  801bbe:	75 f7                	jne    801bb7 <strlen+0xd>
+	return n;
+}
+  801bc0:	5d                   	pop    %ebp
+  801bc1:	c3                   	ret
+
+00801bc2 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  801bc2:	55                   	push   %ebp
+  801bc3:	89 e5                	mov    %esp,%ebp
+  801bc5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801bc8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801bcb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bd0:	eb 03                	jmp    801bd5 <strnlen+0x13>
+		n++;
+  801bd2:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801bd5:	39 d0                	cmp    %edx,%eax
+  801bd7:	74 08                	je     801be1 <strnlen+0x1f>
+  801bd9:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  801bdd:	75 f3                	jne    801bd2 <strnlen+0x10>
+  801bdf:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  801be1:	89 d0                	mov    %edx,%eax
+  801be3:	5d                   	pop    %ebp
+  801be4:	c3                   	ret
+
+00801be5 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801be5:	55                   	push   %ebp
+  801be6:	89 e5                	mov    %esp,%ebp
+  801be8:	53                   	push   %ebx
+  801be9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801bec:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  801bef:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bf4:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  801bf8:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  801bfb:	83 c0 01             	add    $0x1,%eax
+  801bfe:	84 d2                	test   %dl,%dl
+  801c00:	75 f2                	jne    801bf4 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  801c02:	89 c8                	mov    %ecx,%eax
+  801c04:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c07:	c9                   	leave
+  801c08:	c3                   	ret
+
+00801c09 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801c09:	55                   	push   %ebp
+  801c0a:	89 e5                	mov    %esp,%ebp
+  801c0c:	53                   	push   %ebx
+  801c0d:	83 ec 10             	sub    $0x10,%esp
+  801c10:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  801c13:	53                   	push   %ebx
+  801c14:	e8 91 ff ff ff       	call   801baa <strlen>
+  801c19:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  801c1c:	ff 75 0c             	push   0xc(%ebp)
+  801c1f:	01 d8                	add    %ebx,%eax
+  801c21:	50                   	push   %eax
+  801c22:	e8 be ff ff ff       	call   801be5 <strcpy>
+	return dst;
+}
+  801c27:	89 d8                	mov    %ebx,%eax
+  801c29:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c2c:	c9                   	leave
+  801c2d:	c3                   	ret
+
+00801c2e <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801c2e:	55                   	push   %ebp
+  801c2f:	89 e5                	mov    %esp,%ebp
+  801c31:	56                   	push   %esi
+  801c32:	53                   	push   %ebx
+  801c33:	8b 75 08             	mov    0x8(%ebp),%esi
+  801c36:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  801c39:	89 f3                	mov    %esi,%ebx
+  801c3b:	03 5d 10             	add    0x10(%ebp),%ebx
+  801c3e:	89 f0                	mov    %esi,%eax
+  801c40:	eb 0f                	jmp    801c51 <strncpy+0x23>
+		*dst++ = *src;
+  801c42:	83 c0 01             	add    $0x1,%eax
+  801c45:	0f b6 0a             	movzbl (%edx),%ecx
+  801c48:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  801c4b:	80 f9 01             	cmp    $0x1,%cl
+  801c4e:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  801c51:	39 d8                	cmp    %ebx,%eax
+  801c53:	75 ed                	jne    801c42 <strncpy+0x14>
+	}
+	return ret;
+}
+  801c55:	89 f0                	mov    %esi,%eax
+  801c57:	5b                   	pop    %ebx
+  801c58:	5e                   	pop    %esi
+  801c59:	5d                   	pop    %ebp
+  801c5a:	c3                   	ret
+
+00801c5b <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801c5b:	55                   	push   %ebp
+  801c5c:	89 e5                	mov    %esp,%ebp
+  801c5e:	56                   	push   %esi
+  801c5f:	53                   	push   %ebx
+  801c60:	8b 75 08             	mov    0x8(%ebp),%esi
+  801c63:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c66:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  801c69:	89 f0                	mov    %esi,%eax
+  801c6b:	85 d2                	test   %edx,%edx
+  801c6d:	74 21                	je     801c90 <strlcpy+0x35>
+  801c6f:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  801c73:	89 f2                	mov    %esi,%edx
+  801c75:	eb 09                	jmp    801c80 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  801c77:	83 c1 01             	add    $0x1,%ecx
+  801c7a:	83 c2 01             	add    $0x1,%edx
+  801c7d:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  801c80:	39 c2                	cmp    %eax,%edx
+  801c82:	74 09                	je     801c8d <strlcpy+0x32>
+  801c84:	0f b6 19             	movzbl (%ecx),%ebx
+  801c87:	84 db                	test   %bl,%bl
+  801c89:	75 ec                	jne    801c77 <strlcpy+0x1c>
+  801c8b:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  801c8d:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  801c90:	29 f0                	sub    %esi,%eax
+}
+  801c92:	5b                   	pop    %ebx
+  801c93:	5e                   	pop    %esi
+  801c94:	5d                   	pop    %ebp
+  801c95:	c3                   	ret
+
+00801c96 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  801c96:	55                   	push   %ebp
+  801c97:	89 e5                	mov    %esp,%ebp
+  801c99:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801c9c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  801c9f:	eb 06                	jmp    801ca7 <strcmp+0x11>
+		p++, q++;
+  801ca1:	83 c1 01             	add    $0x1,%ecx
+  801ca4:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  801ca7:	0f b6 01             	movzbl (%ecx),%eax
+  801caa:	84 c0                	test   %al,%al
+  801cac:	74 04                	je     801cb2 <strcmp+0x1c>
+  801cae:	3a 02                	cmp    (%edx),%al
+  801cb0:	74 ef                	je     801ca1 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801cb2:	0f b6 c0             	movzbl %al,%eax
+  801cb5:	0f b6 12             	movzbl (%edx),%edx
+  801cb8:	29 d0                	sub    %edx,%eax
+}
+  801cba:	5d                   	pop    %ebp
+  801cbb:	c3                   	ret
+
+00801cbc <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801cbc:	55                   	push   %ebp
+  801cbd:	89 e5                	mov    %esp,%ebp
+  801cbf:	53                   	push   %ebx
+  801cc0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cc3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801cc6:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  801cc9:	eb 09                	jmp    801cd4 <strncmp+0x18>
+		n--, p++, q++;
+  801ccb:	83 ea 01             	sub    $0x1,%edx
+  801cce:	83 c0 01             	add    $0x1,%eax
+  801cd1:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  801cd4:	85 d2                	test   %edx,%edx
+  801cd6:	74 18                	je     801cf0 <strncmp+0x34>
+  801cd8:	0f b6 18             	movzbl (%eax),%ebx
+  801cdb:	84 db                	test   %bl,%bl
+  801cdd:	74 04                	je     801ce3 <strncmp+0x27>
+  801cdf:	3a 19                	cmp    (%ecx),%bl
+  801ce1:	74 e8                	je     801ccb <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801ce3:	0f b6 00             	movzbl (%eax),%eax
+  801ce6:	0f b6 11             	movzbl (%ecx),%edx
+  801ce9:	29 d0                	sub    %edx,%eax
+}
+  801ceb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cee:	c9                   	leave
+  801cef:	c3                   	ret
+		return 0;
+  801cf0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cf5:	eb f4                	jmp    801ceb <strncmp+0x2f>
+
+00801cf7 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801cf7:	55                   	push   %ebp
+  801cf8:	89 e5                	mov    %esp,%ebp
+  801cfa:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cfd:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801d01:	eb 03                	jmp    801d06 <strchr+0xf>
+  801d03:	83 c0 01             	add    $0x1,%eax
+  801d06:	0f b6 10             	movzbl (%eax),%edx
+  801d09:	84 d2                	test   %dl,%dl
+  801d0b:	74 06                	je     801d13 <strchr+0x1c>
+		if (*s == c)
+  801d0d:	38 ca                	cmp    %cl,%dl
+  801d0f:	75 f2                	jne    801d03 <strchr+0xc>
+  801d11:	eb 05                	jmp    801d18 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  801d13:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d18:	5d                   	pop    %ebp
+  801d19:	c3                   	ret
+
+00801d1a <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801d1a:	55                   	push   %ebp
+  801d1b:	89 e5                	mov    %esp,%ebp
+  801d1d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d20:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801d24:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  801d27:	38 ca                	cmp    %cl,%dl
+  801d29:	74 09                	je     801d34 <strfind+0x1a>
+  801d2b:	84 d2                	test   %dl,%dl
+  801d2d:	74 05                	je     801d34 <strfind+0x1a>
+	for (; *s; s++)
+  801d2f:	83 c0 01             	add    $0x1,%eax
+  801d32:	eb f0                	jmp    801d24 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  801d34:	5d                   	pop    %ebp
+  801d35:	c3                   	ret
+
+00801d36 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801d36:	55                   	push   %ebp
+  801d37:	89 e5                	mov    %esp,%ebp
+  801d39:	57                   	push   %edi
+  801d3a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801d3d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  801d40:	85 c9                	test   %ecx,%ecx
+  801d42:	74 20                	je     801d64 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  801d44:	89 f8                	mov    %edi,%eax
+  801d46:	09 c8                	or     %ecx,%eax
+  801d48:	a8 03                	test   $0x3,%al
+  801d4a:	75 12                	jne    801d5e <memset+0x28>
+		c &= 0xFF;
+  801d4c:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  801d50:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  801d56:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  801d59:	fc                   	cld
+  801d5a:	f3 ab                	rep stos %eax,%es:(%edi)
+  801d5c:	eb 06                	jmp    801d64 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801d5e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d61:	fc                   	cld
+  801d62:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  801d64:	89 f8                	mov    %edi,%eax
+  801d66:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  801d69:	c9                   	leave
+  801d6a:	c3                   	ret
+
+00801d6b <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801d6b:	55                   	push   %ebp
+  801d6c:	89 e5                	mov    %esp,%ebp
+  801d6e:	57                   	push   %edi
+  801d6f:	56                   	push   %esi
+  801d70:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d73:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801d76:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  801d79:	39 c6                	cmp    %eax,%esi
+  801d7b:	73 32                	jae    801daf <memmove+0x44>
+  801d7d:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  801d80:	39 d0                	cmp    %edx,%eax
+  801d82:	73 2b                	jae    801daf <memmove+0x44>
+		s += n;
+		d += n;
+  801d84:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801d87:	89 d6                	mov    %edx,%esi
+  801d89:	09 fe                	or     %edi,%esi
+  801d8b:	09 ce                	or     %ecx,%esi
+  801d8d:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  801d93:	75 0e                	jne    801da3 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801d95:	83 ef 04             	sub    $0x4,%edi
+  801d98:	8d 72 fc             	lea    -0x4(%edx),%esi
+  801d9b:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  801d9e:	fd                   	std
+  801d9f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801da1:	eb 09                	jmp    801dac <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801da3:	83 ef 01             	sub    $0x1,%edi
+  801da6:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  801da9:	fd                   	std
+  801daa:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801dac:	fc                   	cld
+  801dad:	eb 1a                	jmp    801dc9 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801daf:	89 f2                	mov    %esi,%edx
+  801db1:	09 c2                	or     %eax,%edx
+  801db3:	09 ca                	or     %ecx,%edx
+  801db5:	f6 c2 03             	test   $0x3,%dl
+  801db8:	75 0a                	jne    801dc4 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801dba:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  801dbd:	89 c7                	mov    %eax,%edi
+  801dbf:	fc                   	cld
+  801dc0:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801dc2:	eb 05                	jmp    801dc9 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  801dc4:	89 c7                	mov    %eax,%edi
+  801dc6:	fc                   	cld
+  801dc7:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  801dc9:	5e                   	pop    %esi
+  801dca:	5f                   	pop    %edi
+  801dcb:	5d                   	pop    %ebp
+  801dcc:	c3                   	ret
+
+00801dcd <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801dcd:	55                   	push   %ebp
+  801dce:	89 e5                	mov    %esp,%ebp
+  801dd0:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  801dd3:	ff 75 10             	push   0x10(%ebp)
+  801dd6:	ff 75 0c             	push   0xc(%ebp)
+  801dd9:	ff 75 08             	push   0x8(%ebp)
+  801ddc:	e8 8a ff ff ff       	call   801d6b <memmove>
+}
+  801de1:	c9                   	leave
+  801de2:	c3                   	ret
+
+00801de3 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801de3:	55                   	push   %ebp
+  801de4:	89 e5                	mov    %esp,%ebp
+  801de6:	56                   	push   %esi
+  801de7:	53                   	push   %ebx
+  801de8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801deb:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  801dee:	89 c6                	mov    %eax,%esi
+  801df0:	03 75 10             	add    0x10(%ebp),%esi
+  801df3:	eb 06                	jmp    801dfb <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  801df5:	83 c0 01             	add    $0x1,%eax
+  801df8:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  801dfb:	39 f0                	cmp    %esi,%eax
+  801dfd:	74 14                	je     801e13 <memcmp+0x30>
+		if (*s1 != *s2)
+  801dff:	0f b6 08             	movzbl (%eax),%ecx
+  801e02:	0f b6 1a             	movzbl (%edx),%ebx
+  801e05:	38 d9                	cmp    %bl,%cl
+  801e07:	74 ec                	je     801df5 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  801e09:	0f b6 c1             	movzbl %cl,%eax
+  801e0c:	0f b6 db             	movzbl %bl,%ebx
+  801e0f:	29 d8                	sub    %ebx,%eax
+  801e11:	eb 05                	jmp    801e18 <memcmp+0x35>
+	}
+
+	return 0;
+  801e13:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e18:	5b                   	pop    %ebx
+  801e19:	5e                   	pop    %esi
+  801e1a:	5d                   	pop    %ebp
+  801e1b:	c3                   	ret
+
+00801e1c <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801e1c:	55                   	push   %ebp
+  801e1d:	89 e5                	mov    %esp,%ebp
+  801e1f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e22:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  801e25:	89 c2                	mov    %eax,%edx
+  801e27:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  801e2a:	eb 03                	jmp    801e2f <memfind+0x13>
+  801e2c:	83 c0 01             	add    $0x1,%eax
+  801e2f:	39 d0                	cmp    %edx,%eax
+  801e31:	73 04                	jae    801e37 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801e33:	38 08                	cmp    %cl,(%eax)
+  801e35:	75 f5                	jne    801e2c <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  801e37:	5d                   	pop    %ebp
+  801e38:	c3                   	ret
+
+00801e39 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  801e39:	55                   	push   %ebp
+  801e3a:	89 e5                	mov    %esp,%ebp
+  801e3c:	57                   	push   %edi
+  801e3d:	56                   	push   %esi
+  801e3e:	53                   	push   %ebx
+  801e3f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e42:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801e45:	eb 03                	jmp    801e4a <strtol+0x11>
+		s++;
+  801e47:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  801e4a:	0f b6 02             	movzbl (%edx),%eax
+  801e4d:	3c 20                	cmp    $0x20,%al
+  801e4f:	74 f6                	je     801e47 <strtol+0xe>
+  801e51:	3c 09                	cmp    $0x9,%al
+  801e53:	74 f2                	je     801e47 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  801e55:	3c 2b                	cmp    $0x2b,%al
+  801e57:	74 2a                	je     801e83 <strtol+0x4a>
+	int neg = 0;
+  801e59:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  801e5e:	3c 2d                	cmp    $0x2d,%al
+  801e60:	74 2b                	je     801e8d <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801e62:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  801e68:	75 0f                	jne    801e79 <strtol+0x40>
+  801e6a:	80 3a 30             	cmpb   $0x30,(%edx)
+  801e6d:	74 28                	je     801e97 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  801e6f:	85 db                	test   %ebx,%ebx
+  801e71:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801e76:	0f 44 d8             	cmove  %eax,%ebx
+  801e79:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e7e:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  801e81:	eb 46                	jmp    801ec9 <strtol+0x90>
+		s++;
+  801e83:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  801e86:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e8b:	eb d5                	jmp    801e62 <strtol+0x29>
+		s++, neg = 1;
+  801e8d:	83 c2 01             	add    $0x1,%edx
+  801e90:	bf 01 00 00 00       	mov    $0x1,%edi
+  801e95:	eb cb                	jmp    801e62 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801e97:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  801e9b:	74 0e                	je     801eab <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  801e9d:	85 db                	test   %ebx,%ebx
+  801e9f:	75 d8                	jne    801e79 <strtol+0x40>
+		s++, base = 8;
+  801ea1:	83 c2 01             	add    $0x1,%edx
+  801ea4:	bb 08 00 00 00       	mov    $0x8,%ebx
+  801ea9:	eb ce                	jmp    801e79 <strtol+0x40>
+		s += 2, base = 16;
+  801eab:	83 c2 02             	add    $0x2,%edx
+  801eae:	bb 10 00 00 00       	mov    $0x10,%ebx
+  801eb3:	eb c4                	jmp    801e79 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  801eb5:	0f be c0             	movsbl %al,%eax
+  801eb8:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  801ebb:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801ebe:	7d 3a                	jge    801efa <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  801ec0:	83 c2 01             	add    $0x1,%edx
+  801ec3:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  801ec7:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  801ec9:	0f b6 02             	movzbl (%edx),%eax
+  801ecc:	8d 70 d0             	lea    -0x30(%eax),%esi
+  801ecf:	89 f3                	mov    %esi,%ebx
+  801ed1:	80 fb 09             	cmp    $0x9,%bl
+  801ed4:	76 df                	jbe    801eb5 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  801ed6:	8d 70 9f             	lea    -0x61(%eax),%esi
+  801ed9:	89 f3                	mov    %esi,%ebx
+  801edb:	80 fb 19             	cmp    $0x19,%bl
+  801ede:	77 08                	ja     801ee8 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  801ee0:	0f be c0             	movsbl %al,%eax
+  801ee3:	83 e8 57             	sub    $0x57,%eax
+  801ee6:	eb d3                	jmp    801ebb <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  801ee8:	8d 70 bf             	lea    -0x41(%eax),%esi
+  801eeb:	89 f3                	mov    %esi,%ebx
+  801eed:	80 fb 19             	cmp    $0x19,%bl
+  801ef0:	77 08                	ja     801efa <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  801ef2:	0f be c0             	movsbl %al,%eax
+  801ef5:	83 e8 37             	sub    $0x37,%eax
+  801ef8:	eb c1                	jmp    801ebb <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801efa:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  801efe:	74 05                	je     801f05 <strtol+0xcc>
+		*endptr = (char *) s;
+  801f00:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f03:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  801f05:	89 c8                	mov    %ecx,%eax
+  801f07:	f7 d8                	neg    %eax
+  801f09:	85 ff                	test   %edi,%edi
+  801f0b:	0f 45 c8             	cmovne %eax,%ecx
+}
+  801f0e:	89 c8                	mov    %ecx,%eax
+  801f10:	5b                   	pop    %ebx
+  801f11:	5e                   	pop    %esi
+  801f12:	5f                   	pop    %edi
+  801f13:	5d                   	pop    %ebp
+  801f14:	c3                   	ret
+
+00801f15 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  801f15:	55                   	push   %ebp
+  801f16:	89 e5                	mov    %esp,%ebp
+  801f18:	56                   	push   %esi
+  801f19:	53                   	push   %ebx
+  801f1a:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f1d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f20:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  801f23:	85 c0                	test   %eax,%eax
+  801f25:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801f2a:	0f 44 c2             	cmove  %edx,%eax
+  801f2d:	83 ec 0c             	sub    $0xc,%esp
+  801f30:	50                   	push   %eax
+  801f31:	e8 e7 e3 ff ff       	call   80031d <sys_ipc_recv>
+
+  if (from_env_store)
+  801f36:	83 c4 10             	add    $0x10,%esp
+  801f39:	85 f6                	test   %esi,%esi
+  801f3b:	74 17                	je     801f54 <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  801f3d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f42:	85 c0                	test   %eax,%eax
+  801f44:	75 0c                	jne    801f52 <ipc_recv+0x3d>
+  801f46:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801f4c:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  801f52:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  801f54:	85 db                	test   %ebx,%ebx
+  801f56:	74 2b                	je     801f83 <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  801f58:	85 c0                	test   %eax,%eax
+  801f5a:	74 0d                	je     801f69 <ipc_recv+0x54>
+  801f5c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  801f62:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f65:	5b                   	pop    %ebx
+  801f66:	5e                   	pop    %esi
+  801f67:	5d                   	pop    %ebp
+  801f68:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  801f69:	a1 08 40 80 00       	mov    0x804008,%eax
+  801f6e:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  801f74:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  801f76:	a1 08 40 80 00       	mov    0x804008,%eax
+  801f7b:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  801f81:	eb df                	jmp    801f62 <ipc_recv+0x4d>
+  801f83:	85 c0                	test   %eax,%eax
+  801f85:	75 db                	jne    801f62 <ipc_recv+0x4d>
+  801f87:	eb ed                	jmp    801f76 <ipc_recv+0x61>
+
+00801f89 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  801f89:	55                   	push   %ebp
+  801f8a:	89 e5                	mov    %esp,%ebp
+  801f8c:	57                   	push   %edi
+  801f8d:	56                   	push   %esi
+  801f8e:	53                   	push   %ebx
+  801f8f:	83 ec 0c             	sub    $0xc,%esp
+  801f92:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801f95:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801f98:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  801f9b:	85 db                	test   %ebx,%ebx
+  801f9d:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801fa2:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  801fa5:	ff 75 14             	push   0x14(%ebp)
+  801fa8:	53                   	push   %ebx
+  801fa9:	56                   	push   %esi
+  801faa:	57                   	push   %edi
+  801fab:	e8 4a e3 ff ff       	call   8002fa <sys_ipc_try_send>
+  801fb0:	83 c4 10             	add    $0x10,%esp
+  801fb3:	85 c0                	test   %eax,%eax
+  801fb5:	74 1e                	je     801fd5 <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  801fb7:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801fba:	75 07                	jne    801fc3 <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  801fbc:	e8 8d e1 ff ff       	call   80014e <sys_yield>
+  801fc1:	eb e2                	jmp    801fa5 <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  801fc3:	50                   	push   %eax
+  801fc4:	68 a3 29 80 00       	push   $0x8029a3
+  801fc9:	6a 3c                	push   $0x3c
+  801fcb:	68 b0 29 80 00       	push   $0x8029b0
+  801fd0:	e8 7c f5 ff ff       	call   801551 <_panic>
+  }
+
+#endif
+}
+  801fd5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fd8:	5b                   	pop    %ebx
+  801fd9:	5e                   	pop    %esi
+  801fda:	5f                   	pop    %edi
+  801fdb:	5d                   	pop    %ebp
+  801fdc:	c3                   	ret
+
+00801fdd <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  801fdd:	55                   	push   %ebp
+  801fde:	89 e5                	mov    %esp,%ebp
+  801fe0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  801fe3:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  801fe8:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  801feb:	c1 e0 04             	shl    $0x4,%eax
+  801fee:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801ff3:	8b 40 50             	mov    0x50(%eax),%eax
+  801ff6:	39 c8                	cmp    %ecx,%eax
+  801ff8:	74 12                	je     80200c <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  801ffa:	83 c2 01             	add    $0x1,%edx
+  801ffd:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802003:	75 e3                	jne    801fe8 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802005:	b8 00 00 00 00       	mov    $0x0,%eax
+  80200a:	eb 0e                	jmp    80201a <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  80200c:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80200f:	c1 e0 04             	shl    $0x4,%eax
+  802012:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802017:	8b 40 48             	mov    0x48(%eax),%eax
+  80201a:	5d                   	pop    %ebp
+  80201b:	c3                   	ret
+
+0080201c <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80201c:	55                   	push   %ebp
+  80201d:	89 e5                	mov    %esp,%ebp
+  80201f:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802022:	89 c2                	mov    %eax,%edx
+  802024:	c1 ea 16             	shr    $0x16,%edx
+  802027:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80202e:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802033:	f6 c1 01             	test   $0x1,%cl
+  802036:	74 1c                	je     802054 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  802038:	c1 e8 0c             	shr    $0xc,%eax
+  80203b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802042:	a8 01                	test   $0x1,%al
+  802044:	74 0e                	je     802054 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802046:	c1 e8 0c             	shr    $0xc,%eax
+  802049:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802050:	ef 
+  802051:	0f b7 d2             	movzwl %dx,%edx
+}
+  802054:	89 d0                	mov    %edx,%eax
+  802056:	5d                   	pop    %ebp
+  802057:	c3                   	ret
+  802058:	66 90                	xchg   %ax,%ax
+  80205a:	66 90                	xchg   %ax,%ax
+  80205c:	66 90                	xchg   %ax,%ax
+  80205e:	66 90                	xchg   %ax,%ax
+
+00802060 <__udivmoddi4>:
+  802060:	55                   	push   %ebp
+  802061:	57                   	push   %edi
+  802062:	56                   	push   %esi
+  802063:	53                   	push   %ebx
+  802064:	83 ec 24             	sub    $0x24,%esp
+  802067:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80206b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80206f:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  802073:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802077:	8b 54 24 44          	mov    0x44(%esp),%edx
+  80207b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80207f:	8b 44 24 40          	mov    0x40(%esp),%eax
+  802083:	89 d3                	mov    %edx,%ebx
+  802085:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802089:	09 c3                	or     %eax,%ebx
+  80208b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80208f:	0f 84 9c 00 00 00    	je     802131 <__udivmoddi4+0xd1>
+  802095:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80209c:	00 
+  80209d:	31 c0                	xor    %eax,%eax
+  80209f:	31 d2                	xor    %edx,%edx
+  8020a1:	89 fb                	mov    %edi,%ebx
+  8020a3:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8020aa:	00 
+  8020ab:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8020b0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8020b4:	01 c0                	add    %eax,%eax
+  8020b6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8020bd:	00 
+  8020be:	89 c6                	mov    %eax,%esi
+  8020c0:	89 d7                	mov    %edx,%edi
+  8020c2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8020c6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8020ca:	0f ad d0             	shrd   %cl,%edx,%eax
+  8020cd:	d3 ea                	shr    %cl,%edx
+  8020cf:	f6 c1 20             	test   $0x20,%cl
+  8020d2:	0f 45 c2             	cmovne %edx,%eax
+  8020d5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8020d9:	83 e0 01             	and    $0x1,%eax
+  8020dc:	09 fa                	or     %edi,%edx
+  8020de:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8020e2:	89 04 24             	mov    %eax,(%esp)
+  8020e5:	8b 04 24             	mov    (%esp),%eax
+  8020e8:	89 d5                	mov    %edx,%ebp
+  8020ea:	09 f0                	or     %esi,%eax
+  8020ec:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8020f0:	39 f0                	cmp    %esi,%eax
+  8020f2:	19 fd                	sbb    %edi,%ebp
+  8020f4:	72 1d                	jb     802113 <__udivmoddi4+0xb3>
+  8020f6:	29 f0                	sub    %esi,%eax
+  8020f8:	19 fa                	sbb    %edi,%edx
+  8020fa:	89 cf                	mov    %ecx,%edi
+  8020fc:	c1 ef 05             	shr    $0x5,%edi
+  8020ff:	83 e7 01             	and    $0x1,%edi
+  802102:	89 fe                	mov    %edi,%esi
+  802104:	d3 e7                	shl    %cl,%edi
+  802106:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80210a:	83 f6 01             	xor    $0x1,%esi
+  80210d:	d3 e6                	shl    %cl,%esi
+  80210f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802113:	83 e9 01             	sub    $0x1,%ecx
+  802116:	73 98                	jae    8020b0 <__udivmoddi4+0x50>
+  802118:	85 db                	test   %ebx,%ebx
+  80211a:	74 05                	je     802121 <__udivmoddi4+0xc1>
+  80211c:	89 03                	mov    %eax,(%ebx)
+  80211e:	89 53 04             	mov    %edx,0x4(%ebx)
+  802121:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802125:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802129:	83 c4 24             	add    $0x24,%esp
+  80212c:	5b                   	pop    %ebx
+  80212d:	5e                   	pop    %esi
+  80212e:	5f                   	pop    %edi
+  80212f:	5d                   	pop    %ebp
+  802130:	c3                   	ret
+  802131:	85 ff                	test   %edi,%edi
+  802133:	74 0d                	je     802142 <__udivmoddi4+0xe2>
+  802135:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  80213b:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  802142:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802146:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80214a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80214e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802152:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802156:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80215a:	83 c4 24             	add    $0x24,%esp
+  80215d:	5b                   	pop    %ebx
+  80215e:	5e                   	pop    %esi
+  80215f:	5f                   	pop    %edi
+  802160:	5d                   	pop    %ebp
+  802161:	c3                   	ret
+  802162:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802169:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00802170 <__udivdi3>:
+  802170:	57                   	push   %edi
+  802171:	56                   	push   %esi
+  802172:	53                   	push   %ebx
+  802173:	83 ec 20             	sub    $0x20,%esp
+  802176:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80217a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80217e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802182:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802186:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80218a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80218e:	89 d1                	mov    %edx,%ecx
+  802190:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802194:	09 c1                	or     %eax,%ecx
+  802196:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80219a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80219e:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  8021a2:	0f 84 88 00 00 00    	je     802230 <__udivdi3+0xc0>
+  8021a8:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8021af:	00 
+  8021b0:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8021b5:	31 c0                	xor    %eax,%eax
+  8021b7:	31 d2                	xor    %edx,%edx
+  8021b9:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8021c0:	00 
+  8021c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8021c8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8021cc:	01 c0                	add    %eax,%eax
+  8021ce:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8021d5:	00 
+  8021d6:	89 c6                	mov    %eax,%esi
+  8021d8:	89 d7                	mov    %edx,%edi
+  8021da:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8021de:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8021e2:	0f ad d0             	shrd   %cl,%edx,%eax
+  8021e5:	d3 ea                	shr    %cl,%edx
+  8021e7:	f6 c1 20             	test   $0x20,%cl
+  8021ea:	0f 45 c2             	cmovne %edx,%eax
+  8021ed:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8021f1:	83 e0 01             	and    $0x1,%eax
+  8021f4:	09 fa                	or     %edi,%edx
+  8021f6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8021fa:	89 04 24             	mov    %eax,(%esp)
+  8021fd:	8b 04 24             	mov    (%esp),%eax
+  802200:	89 d3                	mov    %edx,%ebx
+  802202:	09 f0                	or     %esi,%eax
+  802204:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802208:	39 f0                	cmp    %esi,%eax
+  80220a:	19 fb                	sbb    %edi,%ebx
+  80220c:	72 1d                	jb     80222b <__udivdi3+0xbb>
+  80220e:	29 f0                	sub    %esi,%eax
+  802210:	19 fa                	sbb    %edi,%edx
+  802212:	89 cf                	mov    %ecx,%edi
+  802214:	c1 ef 05             	shr    $0x5,%edi
+  802217:	83 e7 01             	and    $0x1,%edi
+  80221a:	89 fe                	mov    %edi,%esi
+  80221c:	d3 e7                	shl    %cl,%edi
+  80221e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802222:	83 f6 01             	xor    $0x1,%esi
+  802225:	d3 e6                	shl    %cl,%esi
+  802227:	09 74 24 18          	or     %esi,0x18(%esp)
+  80222b:	83 e9 01             	sub    $0x1,%ecx
+  80222e:	73 98                	jae    8021c8 <__udivdi3+0x58>
+  802230:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802234:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802238:	83 c4 20             	add    $0x20,%esp
+  80223b:	5b                   	pop    %ebx
+  80223c:	5e                   	pop    %esi
+  80223d:	5f                   	pop    %edi
+  80223e:	c3                   	ret
+  80223f:	90                   	nop
+
+00802240 <__umoddi3>:
+  802240:	57                   	push   %edi
+  802241:	56                   	push   %esi
+  802242:	53                   	push   %ebx
+  802243:	83 ec 18             	sub    $0x18,%esp
+  802246:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80224a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80224e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802252:	8b 54 24 34          	mov    0x34(%esp),%edx
+  802256:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80225a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80225e:	89 d1                	mov    %edx,%ecx
+  802260:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802264:	09 c1                	or     %eax,%ecx
+  802266:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80226a:	74 5b                	je     8022c7 <__umoddi3+0x87>
+  80226c:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802271:	31 c0                	xor    %eax,%eax
+  802273:	31 d2                	xor    %edx,%edx
+  802275:	8d 76 00             	lea    0x0(%esi),%esi
+  802278:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80227c:	01 c0                	add    %eax,%eax
+  80227e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802285:	00 
+  802286:	89 c6                	mov    %eax,%esi
+  802288:	89 d7                	mov    %edx,%edi
+  80228a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80228e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802292:	0f ad d0             	shrd   %cl,%edx,%eax
+  802295:	d3 ea                	shr    %cl,%edx
+  802297:	f6 c1 20             	test   $0x20,%cl
+  80229a:	0f 45 c2             	cmovne %edx,%eax
+  80229d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8022a1:	83 e0 01             	and    $0x1,%eax
+  8022a4:	09 fa                	or     %edi,%edx
+  8022a6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8022aa:	89 04 24             	mov    %eax,(%esp)
+  8022ad:	8b 04 24             	mov    (%esp),%eax
+  8022b0:	89 d3                	mov    %edx,%ebx
+  8022b2:	09 f0                	or     %esi,%eax
+  8022b4:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8022b8:	39 f0                	cmp    %esi,%eax
+  8022ba:	19 fb                	sbb    %edi,%ebx
+  8022bc:	72 04                	jb     8022c2 <__umoddi3+0x82>
+  8022be:	29 f0                	sub    %esi,%eax
+  8022c0:	19 fa                	sbb    %edi,%edx
+  8022c2:	83 e9 01             	sub    $0x1,%ecx
+  8022c5:	73 b1                	jae    802278 <__umoddi3+0x38>
+  8022c7:	83 c4 18             	add    $0x18,%esp
+  8022ca:	5b                   	pop    %ebx
+  8022cb:	5e                   	pop    %esi
+  8022cc:	5f                   	pop    %edi
+  8022cd:	c3                   	ret
+  8022ce:	66 90                	xchg   %ax,%ax
+
+008022d0 <__divdi3>:
+  8022d0:	55                   	push   %ebp
+  8022d1:	57                   	push   %edi
+  8022d2:	56                   	push   %esi
+  8022d3:	53                   	push   %ebx
+  8022d4:	83 ec 24             	sub    $0x24,%esp
+  8022d7:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  8022db:	8b 74 24 44          	mov    0x44(%esp),%esi
+  8022df:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8022e3:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8022e7:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  8022eb:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8022ef:	85 d2                	test   %edx,%edx
+  8022f1:	0f 88 e0 00 00 00    	js     8023d7 <__divdi3+0x107>
+  8022f7:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  8022fb:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  8022ff:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802303:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802307:	85 f6                	test   %esi,%esi
+  802309:	78 16                	js     802321 <__divdi3+0x51>
+  80230b:	89 f1                	mov    %esi,%ecx
+  80230d:	31 c0                	xor    %eax,%eax
+  80230f:	31 d2                	xor    %edx,%edx
+  802311:	09 d9                	or     %ebx,%ecx
+  802313:	0f 85 f3 00 00 00    	jne    80240c <__divdi3+0x13c>
+  802319:	83 c4 24             	add    $0x24,%esp
+  80231c:	5b                   	pop    %ebx
+  80231d:	5e                   	pop    %esi
+  80231e:	5f                   	pop    %edi
+  80231f:	5d                   	pop    %ebp
+  802320:	c3                   	ret
+  802321:	bf 01 00 00 00       	mov    $0x1,%edi
+  802326:	f7 5c 24 08          	negl   0x8(%esp)
+  80232a:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  80232f:	f7 5c 24 0c          	negl   0xc(%esp)
+  802333:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80233a:	00 
+  80233b:	31 c0                	xor    %eax,%eax
+  80233d:	31 d2                	xor    %edx,%edx
+  80233f:	89 fb                	mov    %edi,%ebx
+  802341:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802348:	00 
+  802349:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80234e:	66 90                	xchg   %ax,%ax
+  802350:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802354:	01 c0                	add    %eax,%eax
+  802356:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80235d:	00 
+  80235e:	89 c6                	mov    %eax,%esi
+  802360:	89 d7                	mov    %edx,%edi
+  802362:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802366:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80236a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80236d:	d3 ea                	shr    %cl,%edx
+  80236f:	f6 c1 20             	test   $0x20,%cl
+  802372:	0f 45 c2             	cmovne %edx,%eax
+  802375:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802379:	83 e0 01             	and    $0x1,%eax
+  80237c:	09 fa                	or     %edi,%edx
+  80237e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802382:	89 04 24             	mov    %eax,(%esp)
+  802385:	8b 04 24             	mov    (%esp),%eax
+  802388:	89 d5                	mov    %edx,%ebp
+  80238a:	09 f0                	or     %esi,%eax
+  80238c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802390:	39 f0                	cmp    %esi,%eax
+  802392:	19 fd                	sbb    %edi,%ebp
+  802394:	72 1d                	jb     8023b3 <__divdi3+0xe3>
+  802396:	29 f0                	sub    %esi,%eax
+  802398:	19 fa                	sbb    %edi,%edx
+  80239a:	89 cf                	mov    %ecx,%edi
+  80239c:	c1 ef 05             	shr    $0x5,%edi
+  80239f:	83 e7 01             	and    $0x1,%edi
+  8023a2:	89 fe                	mov    %edi,%esi
+  8023a4:	d3 e7                	shl    %cl,%edi
+  8023a6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8023aa:	83 f6 01             	xor    $0x1,%esi
+  8023ad:	d3 e6                	shl    %cl,%esi
+  8023af:	09 74 24 18          	or     %esi,0x18(%esp)
+  8023b3:	83 e9 01             	sub    $0x1,%ecx
+  8023b6:	73 98                	jae    802350 <__divdi3+0x80>
+  8023b8:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8023bc:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8023c0:	85 db                	test   %ebx,%ebx
+  8023c2:	0f 84 51 ff ff ff    	je     802319 <__divdi3+0x49>
+  8023c8:	f7 d8                	neg    %eax
+  8023ca:	83 d2 00             	adc    $0x0,%edx
+  8023cd:	83 c4 24             	add    $0x24,%esp
+  8023d0:	5b                   	pop    %ebx
+  8023d1:	f7 da                	neg    %edx
+  8023d3:	5e                   	pop    %esi
+  8023d4:	5f                   	pop    %edi
+  8023d5:	5d                   	pop    %ebp
+  8023d6:	c3                   	ret
+  8023d7:	f7 d8                	neg    %eax
+  8023d9:	83 d2 00             	adc    $0x0,%edx
+  8023dc:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8023e0:	f7 da                	neg    %edx
+  8023e2:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8023e6:	85 f6                	test   %esi,%esi
+  8023e8:	78 1b                	js     802405 <__divdi3+0x135>
+  8023ea:	89 f1                	mov    %esi,%ecx
+  8023ec:	31 c0                	xor    %eax,%eax
+  8023ee:	31 d2                	xor    %edx,%edx
+  8023f0:	bf 01 00 00 00       	mov    $0x1,%edi
+  8023f5:	09 d9                	or     %ebx,%ecx
+  8023f7:	0f 85 36 ff ff ff    	jne    802333 <__divdi3+0x63>
+  8023fd:	83 c4 24             	add    $0x24,%esp
+  802400:	5b                   	pop    %ebx
+  802401:	5e                   	pop    %esi
+  802402:	5f                   	pop    %edi
+  802403:	5d                   	pop    %ebp
+  802404:	c3                   	ret
+  802405:	31 ff                	xor    %edi,%edi
+  802407:	e9 1a ff ff ff       	jmp    802326 <__divdi3+0x56>
+  80240c:	31 ff                	xor    %edi,%edi
+  80240e:	e9 20 ff ff ff       	jmp    802333 <__divdi3+0x63>
+  802413:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80241a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00802420 <__moddi3>:
+  802420:	55                   	push   %ebp
+  802421:	57                   	push   %edi
+  802422:	56                   	push   %esi
+  802423:	53                   	push   %ebx
+  802424:	83 ec 1c             	sub    $0x1c,%esp
+  802427:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  80242b:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  80242f:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  802433:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  802437:	89 c8                	mov    %ecx,%eax
+  802439:	89 f2                	mov    %esi,%edx
+  80243b:	89 f3                	mov    %esi,%ebx
+  80243d:	85 ed                	test   %ebp,%ebp
+  80243f:	0f 88 9d 00 00 00    	js     8024e2 <__moddi3+0xc2>
+  802445:	09 cb                	or     %ecx,%ebx
+  802447:	0f 84 8d 00 00 00    	je     8024da <__moddi3+0xba>
+  80244d:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802451:	31 db                	xor    %ebx,%ebx
+  802453:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802457:	89 ca                	mov    %ecx,%edx
+  802459:	89 f0                	mov    %esi,%eax
+  80245b:	89 dd                	mov    %ebx,%ebp
+  80245d:	f7 da                	neg    %edx
+  80245f:	83 d0 00             	adc    $0x0,%eax
+  802462:	f7 d8                	neg    %eax
+  802464:	0f 49 f0             	cmovns %eax,%esi
+  802467:	0f 49 ca             	cmovns %edx,%ecx
+  80246a:	31 c0                	xor    %eax,%eax
+  80246c:	31 d2                	xor    %edx,%edx
+  80246e:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802472:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802476:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80247b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80247f:	90                   	nop
+  802480:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802484:	01 c0                	add    %eax,%eax
+  802486:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80248d:	00 
+  80248e:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  802492:	89 c6                	mov    %eax,%esi
+  802494:	89 d7                	mov    %edx,%edi
+  802496:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80249a:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80249e:	0f ad d0             	shrd   %cl,%edx,%eax
+  8024a1:	d3 ea                	shr    %cl,%edx
+  8024a3:	f6 c1 20             	test   $0x20,%cl
+  8024a6:	0f 45 c2             	cmovne %edx,%eax
+  8024a9:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8024ad:	83 e0 01             	and    $0x1,%eax
+  8024b0:	09 fa                	or     %edi,%edx
+  8024b2:	89 04 24             	mov    %eax,(%esp)
+  8024b5:	8b 04 24             	mov    (%esp),%eax
+  8024b8:	89 d7                	mov    %edx,%edi
+  8024ba:	09 f0                	or     %esi,%eax
+  8024bc:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  8024c0:	39 d8                	cmp    %ebx,%eax
+  8024c2:	19 f7                	sbb    %esi,%edi
+  8024c4:	72 04                	jb     8024ca <__moddi3+0xaa>
+  8024c6:	29 d8                	sub    %ebx,%eax
+  8024c8:	19 f2                	sbb    %esi,%edx
+  8024ca:	83 e9 01             	sub    $0x1,%ecx
+  8024cd:	73 b1                	jae    802480 <__moddi3+0x60>
+  8024cf:	85 ed                	test   %ebp,%ebp
+  8024d1:	74 07                	je     8024da <__moddi3+0xba>
+  8024d3:	f7 d8                	neg    %eax
+  8024d5:	83 d2 00             	adc    $0x0,%edx
+  8024d8:	f7 da                	neg    %edx
+  8024da:	83 c4 1c             	add    $0x1c,%esp
+  8024dd:	5b                   	pop    %ebx
+  8024de:	5e                   	pop    %esi
+  8024df:	5f                   	pop    %edi
+  8024e0:	5d                   	pop    %ebp
+  8024e1:	c3                   	ret
+  8024e2:	09 cb                	or     %ecx,%ebx
+  8024e4:	74 f4                	je     8024da <__moddi3+0xba>
+  8024e6:	f7 df                	neg    %edi
+  8024e8:	bb 01 00 00 00       	mov    $0x1,%ebx
+  8024ed:	83 d5 00             	adc    $0x0,%ebp
+  8024f0:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  8024f4:	f7 dd                	neg    %ebp
+  8024f6:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  8024fa:	e9 58 ff ff ff       	jmp    802457 <__moddi3+0x37>
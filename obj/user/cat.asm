@@ -0,0 +1,5548 @@
+
+obj/user/cat.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 fc 00 00 00       	call   80012d <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <cat>:
+
+char buf[8192];
+
+void
+cat(int f, char *s)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	8b 75 08             	mov    0x8(%ebp),%esi
+	long n;
+	int r;
+
+	while ((n = read(f, buf, (long)sizeof(buf))) > 0)
+  80003b:	83 ec 04             	sub    $0x4,%esp
+  80003e:	68 00 20 00 00       	push   $0x2000
+  800043:	68 20 40 80 00       	push   $0x804020
+  800048:	56                   	push   %esi
+  800049:	e8 78 11 00 00       	call   8011c6 <read>
+  80004e:	89 c3                	mov    %eax,%ebx
+  800050:	83 c4 10             	add    $0x10,%esp
+  800053:	85 c0                	test   %eax,%eax
+  800055:	7e 2f                	jle    800086 <cat+0x53>
+		if ((r = write(1, buf, n)) != n)
+  800057:	83 ec 04             	sub    $0x4,%esp
+  80005a:	53                   	push   %ebx
+  80005b:	68 20 40 80 00       	push   $0x804020
+  800060:	6a 01                	push   $0x1
+  800062:	e8 2d 12 00 00       	call   801294 <write>
+  800067:	83 c4 10             	add    $0x10,%esp
+  80006a:	39 c3                	cmp    %eax,%ebx
+  80006c:	74 cd                	je     80003b <cat+0x8>
+			panic("write error copying %s: %e", s, r);
+  80006e:	83 ec 0c             	sub    $0xc,%esp
+  800071:	50                   	push   %eax
+  800072:	ff 75 0c             	push   0xc(%ebp)
+  800075:	68 00 27 80 00       	push   $0x802700
+  80007a:	6a 0d                	push   $0xd
+  80007c:	68 1b 27 80 00       	push   $0x80271b
+  800081:	e8 0a 01 00 00       	call   800190 <_panic>
+	if (n < 0)
+  800086:	78 07                	js     80008f <cat+0x5c>
+		panic("error reading %s: %e", s, n);
+}
+  800088:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80008b:	5b                   	pop    %ebx
+  80008c:	5e                   	pop    %esi
+  80008d:	5d                   	pop    %ebp
+  80008e:	c3                   	ret
+		panic("error reading %s: %e", s, n);
+  80008f:	83 ec 0c             	sub    $0xc,%esp
+  800092:	50                   	push   %eax
+  800093:	ff 75 0c             	push   0xc(%ebp)
+  800096:	68 26 27 80 00       	push   $0x802726
+  80009b:	6a 0f                	push   $0xf
+  80009d:	68 1b 27 80 00       	push   $0x80271b
+  8000a2:	e8 e9 00 00 00       	call   800190 <_panic>
+
+008000a7 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8000a7:	55                   	push   %ebp
+  8000a8:	89 e5                	mov    %esp,%ebp
+  8000aa:	57                   	push   %edi
+  8000ab:	56                   	push   %esi
+  8000ac:	53                   	push   %ebx
+  8000ad:	83 ec 0c             	sub    $0xc,%esp
+  8000b0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	int f, i;
+
+	binaryname = "cat";
+  8000b3:	c7 05 00 30 80 00 3b 	movl   $0x80273b,0x803000
+  8000ba:	27 80 00 
+	if (argc == 1)
+		cat(0, "<stdin>");
+	else
+		for (i = 1; i < argc; i++) {
+  8000bd:	be 01 00 00 00       	mov    $0x1,%esi
+	if (argc == 1)
+  8000c2:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  8000c6:	75 31                	jne    8000f9 <umain+0x52>
+		cat(0, "<stdin>");
+  8000c8:	83 ec 08             	sub    $0x8,%esp
+  8000cb:	68 3f 27 80 00       	push   $0x80273f
+  8000d0:	6a 00                	push   $0x0
+  8000d2:	e8 5c ff ff ff       	call   800033 <cat>
+  8000d7:	83 c4 10             	add    $0x10,%esp
+			else {
+				cat(f, argv[i]);
+				close(f);
+			}
+		}
+}
+  8000da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000dd:	5b                   	pop    %ebx
+  8000de:	5e                   	pop    %esi
+  8000df:	5f                   	pop    %edi
+  8000e0:	5d                   	pop    %ebp
+  8000e1:	c3                   	ret
+				printf("can't open %s: %e\n", argv[i], f);
+  8000e2:	83 ec 04             	sub    $0x4,%esp
+  8000e5:	50                   	push   %eax
+  8000e6:	ff 34 b7             	push   (%edi,%esi,4)
+  8000e9:	68 47 27 80 00       	push   $0x802747
+  8000ee:	e8 d9 16 00 00       	call   8017cc <printf>
+  8000f3:	83 c4 10             	add    $0x10,%esp
+		for (i = 1; i < argc; i++) {
+  8000f6:	83 c6 01             	add    $0x1,%esi
+  8000f9:	3b 75 08             	cmp    0x8(%ebp),%esi
+  8000fc:	7d dc                	jge    8000da <umain+0x33>
+			f = open(argv[i], O_RDONLY);
+  8000fe:	83 ec 08             	sub    $0x8,%esp
+  800101:	6a 00                	push   $0x0
+  800103:	ff 34 b7             	push   (%edi,%esi,4)
+  800106:	e8 1e 15 00 00       	call   801629 <open>
+  80010b:	89 c3                	mov    %eax,%ebx
+			if (f < 0)
+  80010d:	83 c4 10             	add    $0x10,%esp
+  800110:	85 c0                	test   %eax,%eax
+  800112:	78 ce                	js     8000e2 <umain+0x3b>
+				cat(f, argv[i]);
+  800114:	83 ec 08             	sub    $0x8,%esp
+  800117:	ff 34 b7             	push   (%edi,%esi,4)
+  80011a:	50                   	push   %eax
+  80011b:	e8 13 ff ff ff       	call   800033 <cat>
+				close(f);
+  800120:	89 1c 24             	mov    %ebx,(%esp)
+  800123:	e8 62 0f 00 00       	call   80108a <close>
+  800128:	83 c4 10             	add    $0x10,%esp
+  80012b:	eb c9                	jmp    8000f6 <umain+0x4f>
+
+0080012d <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  80012d:	55                   	push   %ebp
+  80012e:	89 e5                	mov    %esp,%ebp
+  800130:	56                   	push   %esi
+  800131:	53                   	push   %ebx
+  800132:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800135:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  800138:	e8 95 0a 00 00       	call   800bd2 <sys_getenvid>
+  80013d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800142:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800145:	c1 e0 04             	shl    $0x4,%eax
+  800148:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80014d:	a3 20 60 80 00       	mov    %eax,0x806020
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800152:	85 db                	test   %ebx,%ebx
+  800154:	7e 07                	jle    80015d <libmain+0x30>
+    binaryname = argv[0];
+  800156:	8b 06                	mov    (%esi),%eax
+  800158:	a3 00 30 80 00       	mov    %eax,0x803000
+
+  // call user main routine
+  umain(argc, argv);
+  80015d:	83 ec 08             	sub    $0x8,%esp
+  800160:	56                   	push   %esi
+  800161:	53                   	push   %ebx
+  800162:	e8 40 ff ff ff       	call   8000a7 <umain>
+
+  // exit gracefully
+  exit();
+  800167:	e8 0a 00 00 00       	call   800176 <exit>
+}
+  80016c:	83 c4 10             	add    $0x10,%esp
+  80016f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800172:	5b                   	pop    %ebx
+  800173:	5e                   	pop    %esi
+  800174:	5d                   	pop    %ebp
+  800175:	c3                   	ret
+
+00800176 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800176:	55                   	push   %ebp
+  800177:	89 e5                	mov    %esp,%ebp
+  800179:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80017c:	e8 36 0f 00 00       	call   8010b7 <close_all>
+	sys_env_destroy(0);
+  800181:	83 ec 0c             	sub    $0xc,%esp
+  800184:	6a 00                	push   $0x0
+  800186:	e8 06 0a 00 00       	call   800b91 <sys_env_destroy>
+}
+  80018b:	83 c4 10             	add    $0x10,%esp
+  80018e:	c9                   	leave
+  80018f:	c3                   	ret
+
+00800190 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800190:	55                   	push   %ebp
+  800191:	89 e5                	mov    %esp,%ebp
+  800193:	56                   	push   %esi
+  800194:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800195:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800198:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  80019e:	e8 2f 0a 00 00       	call   800bd2 <sys_getenvid>
+  8001a3:	83 ec 0c             	sub    $0xc,%esp
+  8001a6:	ff 75 0c             	push   0xc(%ebp)
+  8001a9:	ff 75 08             	push   0x8(%ebp)
+  8001ac:	56                   	push   %esi
+  8001ad:	50                   	push   %eax
+  8001ae:	68 64 27 80 00       	push   $0x802764
+  8001b3:	e8 b3 00 00 00       	call   80026b <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8001b8:	83 c4 18             	add    $0x18,%esp
+  8001bb:	53                   	push   %ebx
+  8001bc:	ff 75 10             	push   0x10(%ebp)
+  8001bf:	e8 56 00 00 00       	call   80021a <vcprintf>
+	cprintf("\n");
+  8001c4:	c7 04 24 c4 2b 80 00 	movl   $0x802bc4,(%esp)
+  8001cb:	e8 9b 00 00 00       	call   80026b <cprintf>
+  8001d0:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8001d3:	cc                   	int3
+	while (1)
+  8001d4:	eb fd                	jmp    8001d3 <_panic+0x43>
+
+008001d6 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8001d6:	55                   	push   %ebp
+  8001d7:	89 e5                	mov    %esp,%ebp
+  8001d9:	53                   	push   %ebx
+  8001da:	83 ec 04             	sub    $0x4,%esp
+  8001dd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8001e0:	8b 13                	mov    (%ebx),%edx
+  8001e2:	8d 42 01             	lea    0x1(%edx),%eax
+  8001e5:	89 03                	mov    %eax,(%ebx)
+  8001e7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001ea:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8001ee:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001f3:	74 09                	je     8001fe <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001f5:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001f9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001fc:	c9                   	leave
+  8001fd:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8001fe:	83 ec 08             	sub    $0x8,%esp
+  800201:	68 ff 00 00 00       	push   $0xff
+  800206:	8d 43 08             	lea    0x8(%ebx),%eax
+  800209:	50                   	push   %eax
+  80020a:	e8 45 09 00 00       	call   800b54 <sys_cputs>
+		b->idx = 0;
+  80020f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800215:	83 c4 10             	add    $0x10,%esp
+  800218:	eb db                	jmp    8001f5 <putch+0x1f>
+
+0080021a <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80021a:	55                   	push   %ebp
+  80021b:	89 e5                	mov    %esp,%ebp
+  80021d:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800223:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80022a:	00 00 00 
+	b.cnt = 0;
+  80022d:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800234:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800237:	ff 75 0c             	push   0xc(%ebp)
+  80023a:	ff 75 08             	push   0x8(%ebp)
+  80023d:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800243:	50                   	push   %eax
+  800244:	68 d6 01 80 00       	push   $0x8001d6
+  800249:	e8 14 01 00 00       	call   800362 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80024e:	83 c4 08             	add    $0x8,%esp
+  800251:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800257:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80025d:	50                   	push   %eax
+  80025e:	e8 f1 08 00 00       	call   800b54 <sys_cputs>
+
+	return b.cnt;
+}
+  800263:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800269:	c9                   	leave
+  80026a:	c3                   	ret
+
+0080026b <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80026b:	55                   	push   %ebp
+  80026c:	89 e5                	mov    %esp,%ebp
+  80026e:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800271:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800274:	50                   	push   %eax
+  800275:	ff 75 08             	push   0x8(%ebp)
+  800278:	e8 9d ff ff ff       	call   80021a <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80027d:	c9                   	leave
+  80027e:	c3                   	ret
+
+0080027f <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80027f:	55                   	push   %ebp
+  800280:	89 e5                	mov    %esp,%ebp
+  800282:	57                   	push   %edi
+  800283:	56                   	push   %esi
+  800284:	53                   	push   %ebx
+  800285:	83 ec 1c             	sub    $0x1c,%esp
+  800288:	89 c7                	mov    %eax,%edi
+  80028a:	89 d6                	mov    %edx,%esi
+  80028c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80028f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800292:	89 d1                	mov    %edx,%ecx
+  800294:	89 c2                	mov    %eax,%edx
+  800296:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800299:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80029c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80029f:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8002a2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8002a5:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8002ac:	39 c2                	cmp    %eax,%edx
+  8002ae:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8002b1:	72 3e                	jb     8002f1 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8002b3:	83 ec 0c             	sub    $0xc,%esp
+  8002b6:	ff 75 18             	push   0x18(%ebp)
+  8002b9:	83 eb 01             	sub    $0x1,%ebx
+  8002bc:	53                   	push   %ebx
+  8002bd:	50                   	push   %eax
+  8002be:	83 ec 08             	sub    $0x8,%esp
+  8002c1:	ff 75 e4             	push   -0x1c(%ebp)
+  8002c4:	ff 75 e0             	push   -0x20(%ebp)
+  8002c7:	ff 75 dc             	push   -0x24(%ebp)
+  8002ca:	ff 75 d8             	push   -0x28(%ebp)
+  8002cd:	e8 8e 20 00 00       	call   802360 <__udivdi3>
+  8002d2:	83 c4 18             	add    $0x18,%esp
+  8002d5:	52                   	push   %edx
+  8002d6:	50                   	push   %eax
+  8002d7:	89 f2                	mov    %esi,%edx
+  8002d9:	89 f8                	mov    %edi,%eax
+  8002db:	e8 9f ff ff ff       	call   80027f <printnum>
+  8002e0:	83 c4 20             	add    $0x20,%esp
+  8002e3:	eb 13                	jmp    8002f8 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8002e5:	83 ec 08             	sub    $0x8,%esp
+  8002e8:	56                   	push   %esi
+  8002e9:	ff 75 18             	push   0x18(%ebp)
+  8002ec:	ff d7                	call   *%edi
+  8002ee:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8002f1:	83 eb 01             	sub    $0x1,%ebx
+  8002f4:	85 db                	test   %ebx,%ebx
+  8002f6:	7f ed                	jg     8002e5 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8002f8:	83 ec 08             	sub    $0x8,%esp
+  8002fb:	56                   	push   %esi
+  8002fc:	83 ec 04             	sub    $0x4,%esp
+  8002ff:	ff 75 e4             	push   -0x1c(%ebp)
+  800302:	ff 75 e0             	push   -0x20(%ebp)
+  800305:	ff 75 dc             	push   -0x24(%ebp)
+  800308:	ff 75 d8             	push   -0x28(%ebp)
+  80030b:	e8 20 21 00 00       	call   802430 <__umoddi3>
+  800310:	83 c4 14             	add    $0x14,%esp
+  800313:	0f be 80 87 27 80 00 	movsbl 0x802787(%eax),%eax
+  80031a:	50                   	push   %eax
+  80031b:	ff d7                	call   *%edi
+}
+  80031d:	83 c4 10             	add    $0x10,%esp
+  800320:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800323:	5b                   	pop    %ebx
+  800324:	5e                   	pop    %esi
+  800325:	5f                   	pop    %edi
+  800326:	5d                   	pop    %ebp
+  800327:	c3                   	ret
+
+00800328 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800328:	55                   	push   %ebp
+  800329:	89 e5                	mov    %esp,%ebp
+  80032b:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80032e:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800332:	8b 10                	mov    (%eax),%edx
+  800334:	3b 50 04             	cmp    0x4(%eax),%edx
+  800337:	73 0a                	jae    800343 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800339:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80033c:	89 08                	mov    %ecx,(%eax)
+  80033e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800341:	88 02                	mov    %al,(%edx)
+}
+  800343:	5d                   	pop    %ebp
+  800344:	c3                   	ret
+
+00800345 <printfmt>:
+{
+  800345:	55                   	push   %ebp
+  800346:	89 e5                	mov    %esp,%ebp
+  800348:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80034b:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80034e:	50                   	push   %eax
+  80034f:	ff 75 10             	push   0x10(%ebp)
+  800352:	ff 75 0c             	push   0xc(%ebp)
+  800355:	ff 75 08             	push   0x8(%ebp)
+  800358:	e8 05 00 00 00       	call   800362 <vprintfmt>
+}
+  80035d:	83 c4 10             	add    $0x10,%esp
+  800360:	c9                   	leave
+  800361:	c3                   	ret
+
+00800362 <vprintfmt>:
+{
+  800362:	55                   	push   %ebp
+  800363:	89 e5                	mov    %esp,%ebp
+  800365:	57                   	push   %edi
+  800366:	56                   	push   %esi
+  800367:	53                   	push   %ebx
+  800368:	83 ec 2c             	sub    $0x2c,%esp
+  80036b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80036e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800371:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800374:	eb 0a                	jmp    800380 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800376:	83 ec 08             	sub    $0x8,%esp
+  800379:	53                   	push   %ebx
+  80037a:	50                   	push   %eax
+  80037b:	ff d6                	call   *%esi
+  80037d:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800380:	83 c7 01             	add    $0x1,%edi
+  800383:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800387:	83 f8 25             	cmp    $0x25,%eax
+  80038a:	74 0c                	je     800398 <vprintfmt+0x36>
+			if (ch == '\0')
+  80038c:	85 c0                	test   %eax,%eax
+  80038e:	75 e6                	jne    800376 <vprintfmt+0x14>
+}
+  800390:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800393:	5b                   	pop    %ebx
+  800394:	5e                   	pop    %esi
+  800395:	5f                   	pop    %edi
+  800396:	5d                   	pop    %ebp
+  800397:	c3                   	ret
+		padc = ' ';
+  800398:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80039c:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8003a3:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8003aa:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8003b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003b6:	8d 47 01             	lea    0x1(%edi),%eax
+  8003b9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003bc:	0f b6 17             	movzbl (%edi),%edx
+  8003bf:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8003c2:	3c 55                	cmp    $0x55,%al
+  8003c4:	0f 87 9a 03 00 00    	ja     800764 <vprintfmt+0x402>
+  8003ca:	0f b6 c0             	movzbl %al,%eax
+  8003cd:	ff 24 85 c0 28 80 00 	jmp    *0x8028c0(,%eax,4)
+  8003d4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8003d7:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8003db:	eb d9                	jmp    8003b6 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003dd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003e0:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8003e4:	eb d0                	jmp    8003b6 <vprintfmt+0x54>
+  8003e6:	0f b6 d2             	movzbl %dl,%edx
+  8003e9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8003ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003f1:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8003f4:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003f7:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8003fb:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8003fe:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800401:	83 f9 09             	cmp    $0x9,%ecx
+  800404:	77 55                	ja     80045b <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800406:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800409:	eb e9                	jmp    8003f4 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  80040b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80040e:	8b 00                	mov    (%eax),%eax
+  800410:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800413:	8b 45 14             	mov    0x14(%ebp),%eax
+  800416:	8d 40 04             	lea    0x4(%eax),%eax
+  800419:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80041c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80041f:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800423:	79 91                	jns    8003b6 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800425:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800428:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80042b:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800432:	eb 82                	jmp    8003b6 <vprintfmt+0x54>
+			if (width < 0)
+  800434:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800437:	85 d2                	test   %edx,%edx
+  800439:	b8 00 00 00 00       	mov    $0x0,%eax
+  80043e:	0f 49 c2             	cmovns %edx,%eax
+  800441:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800444:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800447:	e9 6a ff ff ff       	jmp    8003b6 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80044c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80044f:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800456:	e9 5b ff ff ff       	jmp    8003b6 <vprintfmt+0x54>
+  80045b:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80045e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800461:	eb bc                	jmp    80041f <vprintfmt+0xbd>
+			lflag++;
+  800463:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800466:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800469:	e9 48 ff ff ff       	jmp    8003b6 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80046e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800471:	8d 78 04             	lea    0x4(%eax),%edi
+  800474:	83 ec 08             	sub    $0x8,%esp
+  800477:	53                   	push   %ebx
+  800478:	ff 30                	push   (%eax)
+  80047a:	ff d6                	call   *%esi
+			break;
+  80047c:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80047f:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800482:	e9 7c 02 00 00       	jmp    800703 <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  800487:	8b 45 14             	mov    0x14(%ebp),%eax
+  80048a:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80048d:	8b 10                	mov    (%eax),%edx
+  80048f:	89 d0                	mov    %edx,%eax
+  800491:	f7 d8                	neg    %eax
+  800493:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800496:	83 f8 10             	cmp    $0x10,%eax
+  800499:	7f 23                	jg     8004be <vprintfmt+0x15c>
+  80049b:	8b 14 85 20 2a 80 00 	mov    0x802a20(,%eax,4),%edx
+  8004a2:	85 d2                	test   %edx,%edx
+  8004a4:	74 18                	je     8004be <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8004a6:	52                   	push   %edx
+  8004a7:	68 59 2b 80 00       	push   $0x802b59
+  8004ac:	53                   	push   %ebx
+  8004ad:	56                   	push   %esi
+  8004ae:	e8 92 fe ff ff       	call   800345 <printfmt>
+  8004b3:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004b6:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8004b9:	e9 45 02 00 00       	jmp    800703 <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  8004be:	50                   	push   %eax
+  8004bf:	68 9f 27 80 00       	push   $0x80279f
+  8004c4:	53                   	push   %ebx
+  8004c5:	56                   	push   %esi
+  8004c6:	e8 7a fe ff ff       	call   800345 <printfmt>
+  8004cb:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004ce:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8004d1:	e9 2d 02 00 00       	jmp    800703 <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004d6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004d9:	83 c0 04             	add    $0x4,%eax
+  8004dc:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8004df:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004e2:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8004e4:	85 c9                	test   %ecx,%ecx
+  8004e6:	b8 98 27 80 00       	mov    $0x802798,%eax
+  8004eb:	0f 45 c1             	cmovne %ecx,%eax
+  8004ee:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8004f1:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004f5:	7e 06                	jle    8004fd <vprintfmt+0x19b>
+  8004f7:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8004fb:	75 0b                	jne    800508 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004fd:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800500:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800503:	89 75 08             	mov    %esi,0x8(%ebp)
+  800506:	eb 5c                	jmp    800564 <vprintfmt+0x202>
+  800508:	83 ec 08             	sub    $0x8,%esp
+  80050b:	ff 75 d0             	push   -0x30(%ebp)
+  80050e:	ff 75 cc             	push   -0x34(%ebp)
+  800511:	e8 eb 02 00 00       	call   800801 <strnlen>
+  800516:	89 c2                	mov    %eax,%edx
+  800518:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80051b:	29 d0                	sub    %edx,%eax
+  80051d:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800520:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800524:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800527:	89 75 08             	mov    %esi,0x8(%ebp)
+  80052a:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80052c:	eb 0e                	jmp    80053c <vprintfmt+0x1da>
+					putch(padc, putdat);
+  80052e:	83 ec 08             	sub    $0x8,%esp
+  800531:	53                   	push   %ebx
+  800532:	57                   	push   %edi
+  800533:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800536:	83 ee 01             	sub    $0x1,%esi
+  800539:	83 c4 10             	add    $0x10,%esp
+  80053c:	85 f6                	test   %esi,%esi
+  80053e:	7f ee                	jg     80052e <vprintfmt+0x1cc>
+  800540:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800543:	8b 75 08             	mov    0x8(%ebp),%esi
+  800546:	85 c0                	test   %eax,%eax
+  800548:	ba 00 00 00 00       	mov    $0x0,%edx
+  80054d:	0f 49 d0             	cmovns %eax,%edx
+  800550:	29 d0                	sub    %edx,%eax
+  800552:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800555:	eb a6                	jmp    8004fd <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800557:	83 ec 08             	sub    $0x8,%esp
+  80055a:	53                   	push   %ebx
+  80055b:	52                   	push   %edx
+  80055c:	ff 55 08             	call   *0x8(%ebp)
+  80055f:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800562:	89 f1                	mov    %esi,%ecx
+  800564:	8d 71 01             	lea    0x1(%ecx),%esi
+  800567:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80056b:	0f be d0             	movsbl %al,%edx
+  80056e:	85 d2                	test   %edx,%edx
+  800570:	74 28                	je     80059a <vprintfmt+0x238>
+  800572:	85 ff                	test   %edi,%edi
+  800574:	78 05                	js     80057b <vprintfmt+0x219>
+  800576:	83 ef 01             	sub    $0x1,%edi
+  800579:	78 30                	js     8005ab <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80057b:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80057f:	74 d6                	je     800557 <vprintfmt+0x1f5>
+  800581:	0f be c0             	movsbl %al,%eax
+  800584:	83 e8 20             	sub    $0x20,%eax
+  800587:	83 f8 5e             	cmp    $0x5e,%eax
+  80058a:	76 cb                	jbe    800557 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80058c:	83 ec 08             	sub    $0x8,%esp
+  80058f:	53                   	push   %ebx
+  800590:	6a 3f                	push   $0x3f
+  800592:	ff 55 08             	call   *0x8(%ebp)
+  800595:	83 c4 10             	add    $0x10,%esp
+  800598:	eb c8                	jmp    800562 <vprintfmt+0x200>
+  80059a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80059d:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005a0:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8005a3:	01 d0                	add    %edx,%eax
+  8005a5:	29 c8                	sub    %ecx,%eax
+  8005a7:	89 c7                	mov    %eax,%edi
+  8005a9:	eb 13                	jmp    8005be <vprintfmt+0x25c>
+  8005ab:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005ae:	eb ed                	jmp    80059d <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8005b0:	83 ec 08             	sub    $0x8,%esp
+  8005b3:	53                   	push   %ebx
+  8005b4:	6a 20                	push   $0x20
+  8005b6:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8005b8:	83 ef 01             	sub    $0x1,%edi
+  8005bb:	83 c4 10             	add    $0x10,%esp
+  8005be:	85 ff                	test   %edi,%edi
+  8005c0:	7f ee                	jg     8005b0 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005c2:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8005c5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005c8:	e9 36 01 00 00       	jmp    800703 <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  8005cd:	83 f9 01             	cmp    $0x1,%ecx
+  8005d0:	7f 1f                	jg     8005f1 <vprintfmt+0x28f>
+	else if (lflag)
+  8005d2:	85 c9                	test   %ecx,%ecx
+  8005d4:	74 67                	je     80063d <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8005d6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d9:	8b 00                	mov    (%eax),%eax
+  8005db:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005de:	89 c1                	mov    %eax,%ecx
+  8005e0:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005e3:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e9:	8d 40 04             	lea    0x4(%eax),%eax
+  8005ec:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005ef:	eb 17                	jmp    800608 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8005f1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f4:	8b 50 04             	mov    0x4(%eax),%edx
+  8005f7:	8b 00                	mov    (%eax),%eax
+  8005f9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005fc:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005ff:	8b 45 14             	mov    0x14(%ebp),%eax
+  800602:	8d 40 08             	lea    0x8(%eax),%eax
+  800605:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800608:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80060b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80060e:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800613:	85 c9                	test   %ecx,%ecx
+  800615:	0f 89 ce 00 00 00    	jns    8006e9 <vprintfmt+0x387>
+				putch('-', putdat);
+  80061b:	83 ec 08             	sub    $0x8,%esp
+  80061e:	53                   	push   %ebx
+  80061f:	6a 2d                	push   $0x2d
+  800621:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800623:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800626:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800629:	f7 da                	neg    %edx
+  80062b:	83 d1 00             	adc    $0x0,%ecx
+  80062e:	f7 d9                	neg    %ecx
+  800630:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800633:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800638:	e9 ac 00 00 00       	jmp    8006e9 <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  80063d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800640:	8b 00                	mov    (%eax),%eax
+  800642:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800645:	89 c1                	mov    %eax,%ecx
+  800647:	c1 f9 1f             	sar    $0x1f,%ecx
+  80064a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80064d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800650:	8d 40 04             	lea    0x4(%eax),%eax
+  800653:	89 45 14             	mov    %eax,0x14(%ebp)
+  800656:	eb b0                	jmp    800608 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800658:	83 f9 01             	cmp    $0x1,%ecx
+  80065b:	7f 1b                	jg     800678 <vprintfmt+0x316>
+	else if (lflag)
+  80065d:	85 c9                	test   %ecx,%ecx
+  80065f:	74 2c                	je     80068d <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  800661:	8b 45 14             	mov    0x14(%ebp),%eax
+  800664:	8b 10                	mov    (%eax),%edx
+  800666:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80066b:	8d 40 04             	lea    0x4(%eax),%eax
+  80066e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800671:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800676:	eb 71                	jmp    8006e9 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  800678:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067b:	8b 10                	mov    (%eax),%edx
+  80067d:	8b 48 04             	mov    0x4(%eax),%ecx
+  800680:	8d 40 08             	lea    0x8(%eax),%eax
+  800683:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800686:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80068b:	eb 5c                	jmp    8006e9 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  80068d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800690:	8b 10                	mov    (%eax),%edx
+  800692:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800697:	8d 40 04             	lea    0x4(%eax),%eax
+  80069a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80069d:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8006a2:	eb 45                	jmp    8006e9 <vprintfmt+0x387>
+			putch('X', putdat);
+  8006a4:	83 ec 08             	sub    $0x8,%esp
+  8006a7:	53                   	push   %ebx
+  8006a8:	6a 58                	push   $0x58
+  8006aa:	ff d6                	call   *%esi
+			putch('X', putdat);
+  8006ac:	83 c4 08             	add    $0x8,%esp
+  8006af:	53                   	push   %ebx
+  8006b0:	6a 58                	push   $0x58
+  8006b2:	ff d6                	call   *%esi
+			putch('X', putdat);
+  8006b4:	83 c4 08             	add    $0x8,%esp
+  8006b7:	53                   	push   %ebx
+  8006b8:	6a 58                	push   $0x58
+  8006ba:	ff d6                	call   *%esi
+			break;
+  8006bc:	83 c4 10             	add    $0x10,%esp
+  8006bf:	eb 42                	jmp    800703 <vprintfmt+0x3a1>
+			putch('0', putdat);
+  8006c1:	83 ec 08             	sub    $0x8,%esp
+  8006c4:	53                   	push   %ebx
+  8006c5:	6a 30                	push   $0x30
+  8006c7:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8006c9:	83 c4 08             	add    $0x8,%esp
+  8006cc:	53                   	push   %ebx
+  8006cd:	6a 78                	push   $0x78
+  8006cf:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8006d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d4:	8b 10                	mov    (%eax),%edx
+  8006d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8006db:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8006de:	8d 40 04             	lea    0x4(%eax),%eax
+  8006e1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006e4:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8006e9:	83 ec 0c             	sub    $0xc,%esp
+  8006ec:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8006f0:	50                   	push   %eax
+  8006f1:	ff 75 e0             	push   -0x20(%ebp)
+  8006f4:	57                   	push   %edi
+  8006f5:	51                   	push   %ecx
+  8006f6:	52                   	push   %edx
+  8006f7:	89 da                	mov    %ebx,%edx
+  8006f9:	89 f0                	mov    %esi,%eax
+  8006fb:	e8 7f fb ff ff       	call   80027f <printnum>
+			break;
+  800700:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800703:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800706:	e9 75 fc ff ff       	jmp    800380 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  80070b:	83 f9 01             	cmp    $0x1,%ecx
+  80070e:	7f 1b                	jg     80072b <vprintfmt+0x3c9>
+	else if (lflag)
+  800710:	85 c9                	test   %ecx,%ecx
+  800712:	74 2c                	je     800740 <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  800714:	8b 45 14             	mov    0x14(%ebp),%eax
+  800717:	8b 10                	mov    (%eax),%edx
+  800719:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80071e:	8d 40 04             	lea    0x4(%eax),%eax
+  800721:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800724:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800729:	eb be                	jmp    8006e9 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  80072b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80072e:	8b 10                	mov    (%eax),%edx
+  800730:	8b 48 04             	mov    0x4(%eax),%ecx
+  800733:	8d 40 08             	lea    0x8(%eax),%eax
+  800736:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800739:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80073e:	eb a9                	jmp    8006e9 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  800740:	8b 45 14             	mov    0x14(%ebp),%eax
+  800743:	8b 10                	mov    (%eax),%edx
+  800745:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80074a:	8d 40 04             	lea    0x4(%eax),%eax
+  80074d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800750:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800755:	eb 92                	jmp    8006e9 <vprintfmt+0x387>
+			putch(ch, putdat);
+  800757:	83 ec 08             	sub    $0x8,%esp
+  80075a:	53                   	push   %ebx
+  80075b:	6a 25                	push   $0x25
+  80075d:	ff d6                	call   *%esi
+			break;
+  80075f:	83 c4 10             	add    $0x10,%esp
+  800762:	eb 9f                	jmp    800703 <vprintfmt+0x3a1>
+			putch('%', putdat);
+  800764:	83 ec 08             	sub    $0x8,%esp
+  800767:	53                   	push   %ebx
+  800768:	6a 25                	push   $0x25
+  80076a:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80076c:	83 c4 10             	add    $0x10,%esp
+  80076f:	89 f8                	mov    %edi,%eax
+  800771:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800775:	74 05                	je     80077c <vprintfmt+0x41a>
+  800777:	83 e8 01             	sub    $0x1,%eax
+  80077a:	eb f5                	jmp    800771 <vprintfmt+0x40f>
+  80077c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80077f:	eb 82                	jmp    800703 <vprintfmt+0x3a1>
+
+00800781 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800781:	55                   	push   %ebp
+  800782:	89 e5                	mov    %esp,%ebp
+  800784:	83 ec 18             	sub    $0x18,%esp
+  800787:	8b 45 08             	mov    0x8(%ebp),%eax
+  80078a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80078d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800790:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800794:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800797:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80079e:	85 c0                	test   %eax,%eax
+  8007a0:	74 26                	je     8007c8 <vsnprintf+0x47>
+  8007a2:	85 d2                	test   %edx,%edx
+  8007a4:	7e 22                	jle    8007c8 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8007a6:	ff 75 14             	push   0x14(%ebp)
+  8007a9:	ff 75 10             	push   0x10(%ebp)
+  8007ac:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8007af:	50                   	push   %eax
+  8007b0:	68 28 03 80 00       	push   $0x800328
+  8007b5:	e8 a8 fb ff ff       	call   800362 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8007ba:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8007bd:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8007c0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007c3:	83 c4 10             	add    $0x10,%esp
+}
+  8007c6:	c9                   	leave
+  8007c7:	c3                   	ret
+		return -E_INVAL;
+  8007c8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007cd:	eb f7                	jmp    8007c6 <vsnprintf+0x45>
+
+008007cf <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8007cf:	55                   	push   %ebp
+  8007d0:	89 e5                	mov    %esp,%ebp
+  8007d2:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8007d5:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8007d8:	50                   	push   %eax
+  8007d9:	ff 75 10             	push   0x10(%ebp)
+  8007dc:	ff 75 0c             	push   0xc(%ebp)
+  8007df:	ff 75 08             	push   0x8(%ebp)
+  8007e2:	e8 9a ff ff ff       	call   800781 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8007e7:	c9                   	leave
+  8007e8:	c3                   	ret
+
+008007e9 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007e9:	55                   	push   %ebp
+  8007ea:	89 e5                	mov    %esp,%ebp
+  8007ec:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8007ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007f4:	eb 03                	jmp    8007f9 <strlen+0x10>
+		n++;
+  8007f6:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8007f9:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007fd:	75 f7                	jne    8007f6 <strlen+0xd>
+	return n;
+}
+  8007ff:	5d                   	pop    %ebp
+  800800:	c3                   	ret
+
+00800801 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800801:	55                   	push   %ebp
+  800802:	89 e5                	mov    %esp,%ebp
+  800804:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800807:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80080a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80080f:	eb 03                	jmp    800814 <strnlen+0x13>
+		n++;
+  800811:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800814:	39 d0                	cmp    %edx,%eax
+  800816:	74 08                	je     800820 <strnlen+0x1f>
+  800818:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80081c:	75 f3                	jne    800811 <strnlen+0x10>
+  80081e:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800820:	89 d0                	mov    %edx,%eax
+  800822:	5d                   	pop    %ebp
+  800823:	c3                   	ret
+
+00800824 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800824:	55                   	push   %ebp
+  800825:	89 e5                	mov    %esp,%ebp
+  800827:	53                   	push   %ebx
+  800828:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80082b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80082e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800833:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800837:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80083a:	83 c0 01             	add    $0x1,%eax
+  80083d:	84 d2                	test   %dl,%dl
+  80083f:	75 f2                	jne    800833 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800841:	89 c8                	mov    %ecx,%eax
+  800843:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800846:	c9                   	leave
+  800847:	c3                   	ret
+
+00800848 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800848:	55                   	push   %ebp
+  800849:	89 e5                	mov    %esp,%ebp
+  80084b:	53                   	push   %ebx
+  80084c:	83 ec 10             	sub    $0x10,%esp
+  80084f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800852:	53                   	push   %ebx
+  800853:	e8 91 ff ff ff       	call   8007e9 <strlen>
+  800858:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80085b:	ff 75 0c             	push   0xc(%ebp)
+  80085e:	01 d8                	add    %ebx,%eax
+  800860:	50                   	push   %eax
+  800861:	e8 be ff ff ff       	call   800824 <strcpy>
+	return dst;
+}
+  800866:	89 d8                	mov    %ebx,%eax
+  800868:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80086b:	c9                   	leave
+  80086c:	c3                   	ret
+
+0080086d <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80086d:	55                   	push   %ebp
+  80086e:	89 e5                	mov    %esp,%ebp
+  800870:	56                   	push   %esi
+  800871:	53                   	push   %ebx
+  800872:	8b 75 08             	mov    0x8(%ebp),%esi
+  800875:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800878:	89 f3                	mov    %esi,%ebx
+  80087a:	03 5d 10             	add    0x10(%ebp),%ebx
+  80087d:	89 f0                	mov    %esi,%eax
+  80087f:	eb 0f                	jmp    800890 <strncpy+0x23>
+		*dst++ = *src;
+  800881:	83 c0 01             	add    $0x1,%eax
+  800884:	0f b6 0a             	movzbl (%edx),%ecx
+  800887:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80088a:	80 f9 01             	cmp    $0x1,%cl
+  80088d:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800890:	39 d8                	cmp    %ebx,%eax
+  800892:	75 ed                	jne    800881 <strncpy+0x14>
+	}
+	return ret;
+}
+  800894:	89 f0                	mov    %esi,%eax
+  800896:	5b                   	pop    %ebx
+  800897:	5e                   	pop    %esi
+  800898:	5d                   	pop    %ebp
+  800899:	c3                   	ret
+
+0080089a <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80089a:	55                   	push   %ebp
+  80089b:	89 e5                	mov    %esp,%ebp
+  80089d:	56                   	push   %esi
+  80089e:	53                   	push   %ebx
+  80089f:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008a2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008a5:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8008a8:	89 f0                	mov    %esi,%eax
+  8008aa:	85 d2                	test   %edx,%edx
+  8008ac:	74 21                	je     8008cf <strlcpy+0x35>
+  8008ae:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8008b2:	89 f2                	mov    %esi,%edx
+  8008b4:	eb 09                	jmp    8008bf <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8008b6:	83 c1 01             	add    $0x1,%ecx
+  8008b9:	83 c2 01             	add    $0x1,%edx
+  8008bc:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8008bf:	39 c2                	cmp    %eax,%edx
+  8008c1:	74 09                	je     8008cc <strlcpy+0x32>
+  8008c3:	0f b6 19             	movzbl (%ecx),%ebx
+  8008c6:	84 db                	test   %bl,%bl
+  8008c8:	75 ec                	jne    8008b6 <strlcpy+0x1c>
+  8008ca:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8008cc:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8008cf:	29 f0                	sub    %esi,%eax
+}
+  8008d1:	5b                   	pop    %ebx
+  8008d2:	5e                   	pop    %esi
+  8008d3:	5d                   	pop    %ebp
+  8008d4:	c3                   	ret
+
+008008d5 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8008d5:	55                   	push   %ebp
+  8008d6:	89 e5                	mov    %esp,%ebp
+  8008d8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008db:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8008de:	eb 06                	jmp    8008e6 <strcmp+0x11>
+		p++, q++;
+  8008e0:	83 c1 01             	add    $0x1,%ecx
+  8008e3:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8008e6:	0f b6 01             	movzbl (%ecx),%eax
+  8008e9:	84 c0                	test   %al,%al
+  8008eb:	74 04                	je     8008f1 <strcmp+0x1c>
+  8008ed:	3a 02                	cmp    (%edx),%al
+  8008ef:	74 ef                	je     8008e0 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008f1:	0f b6 c0             	movzbl %al,%eax
+  8008f4:	0f b6 12             	movzbl (%edx),%edx
+  8008f7:	29 d0                	sub    %edx,%eax
+}
+  8008f9:	5d                   	pop    %ebp
+  8008fa:	c3                   	ret
+
+008008fb <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8008fb:	55                   	push   %ebp
+  8008fc:	89 e5                	mov    %esp,%ebp
+  8008fe:	53                   	push   %ebx
+  8008ff:	8b 45 08             	mov    0x8(%ebp),%eax
+  800902:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800905:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800908:	eb 09                	jmp    800913 <strncmp+0x18>
+		n--, p++, q++;
+  80090a:	83 ea 01             	sub    $0x1,%edx
+  80090d:	83 c0 01             	add    $0x1,%eax
+  800910:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800913:	85 d2                	test   %edx,%edx
+  800915:	74 18                	je     80092f <strncmp+0x34>
+  800917:	0f b6 18             	movzbl (%eax),%ebx
+  80091a:	84 db                	test   %bl,%bl
+  80091c:	74 04                	je     800922 <strncmp+0x27>
+  80091e:	3a 19                	cmp    (%ecx),%bl
+  800920:	74 e8                	je     80090a <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800922:	0f b6 00             	movzbl (%eax),%eax
+  800925:	0f b6 11             	movzbl (%ecx),%edx
+  800928:	29 d0                	sub    %edx,%eax
+}
+  80092a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80092d:	c9                   	leave
+  80092e:	c3                   	ret
+		return 0;
+  80092f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800934:	eb f4                	jmp    80092a <strncmp+0x2f>
+
+00800936 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800936:	55                   	push   %ebp
+  800937:	89 e5                	mov    %esp,%ebp
+  800939:	8b 45 08             	mov    0x8(%ebp),%eax
+  80093c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800940:	eb 03                	jmp    800945 <strchr+0xf>
+  800942:	83 c0 01             	add    $0x1,%eax
+  800945:	0f b6 10             	movzbl (%eax),%edx
+  800948:	84 d2                	test   %dl,%dl
+  80094a:	74 06                	je     800952 <strchr+0x1c>
+		if (*s == c)
+  80094c:	38 ca                	cmp    %cl,%dl
+  80094e:	75 f2                	jne    800942 <strchr+0xc>
+  800950:	eb 05                	jmp    800957 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800952:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800957:	5d                   	pop    %ebp
+  800958:	c3                   	ret
+
+00800959 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800959:	55                   	push   %ebp
+  80095a:	89 e5                	mov    %esp,%ebp
+  80095c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80095f:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800963:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800966:	38 ca                	cmp    %cl,%dl
+  800968:	74 09                	je     800973 <strfind+0x1a>
+  80096a:	84 d2                	test   %dl,%dl
+  80096c:	74 05                	je     800973 <strfind+0x1a>
+	for (; *s; s++)
+  80096e:	83 c0 01             	add    $0x1,%eax
+  800971:	eb f0                	jmp    800963 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800973:	5d                   	pop    %ebp
+  800974:	c3                   	ret
+
+00800975 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800975:	55                   	push   %ebp
+  800976:	89 e5                	mov    %esp,%ebp
+  800978:	57                   	push   %edi
+  800979:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80097c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  80097f:	85 c9                	test   %ecx,%ecx
+  800981:	74 20                	je     8009a3 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800983:	89 f8                	mov    %edi,%eax
+  800985:	09 c8                	or     %ecx,%eax
+  800987:	a8 03                	test   $0x3,%al
+  800989:	75 12                	jne    80099d <memset+0x28>
+		c &= 0xFF;
+  80098b:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80098f:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800995:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800998:	fc                   	cld
+  800999:	f3 ab                	rep stos %eax,%es:(%edi)
+  80099b:	eb 06                	jmp    8009a3 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80099d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8009a0:	fc                   	cld
+  8009a1:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8009a3:	89 f8                	mov    %edi,%eax
+  8009a5:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8009a8:	c9                   	leave
+  8009a9:	c3                   	ret
+
+008009aa <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8009aa:	55                   	push   %ebp
+  8009ab:	89 e5                	mov    %esp,%ebp
+  8009ad:	57                   	push   %edi
+  8009ae:	56                   	push   %esi
+  8009af:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009b2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8009b5:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8009b8:	39 c6                	cmp    %eax,%esi
+  8009ba:	73 32                	jae    8009ee <memmove+0x44>
+  8009bc:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8009bf:	39 d0                	cmp    %edx,%eax
+  8009c1:	73 2b                	jae    8009ee <memmove+0x44>
+		s += n;
+		d += n;
+  8009c3:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009c6:	89 d6                	mov    %edx,%esi
+  8009c8:	09 fe                	or     %edi,%esi
+  8009ca:	09 ce                	or     %ecx,%esi
+  8009cc:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8009d2:	75 0e                	jne    8009e2 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8009d4:	83 ef 04             	sub    $0x4,%edi
+  8009d7:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8009da:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8009dd:	fd                   	std
+  8009de:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009e0:	eb 09                	jmp    8009eb <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8009e2:	83 ef 01             	sub    $0x1,%edi
+  8009e5:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8009e8:	fd                   	std
+  8009e9:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8009eb:	fc                   	cld
+  8009ec:	eb 1a                	jmp    800a08 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009ee:	89 f2                	mov    %esi,%edx
+  8009f0:	09 c2                	or     %eax,%edx
+  8009f2:	09 ca                	or     %ecx,%edx
+  8009f4:	f6 c2 03             	test   $0x3,%dl
+  8009f7:	75 0a                	jne    800a03 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8009f9:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8009fc:	89 c7                	mov    %eax,%edi
+  8009fe:	fc                   	cld
+  8009ff:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a01:	eb 05                	jmp    800a08 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a03:	89 c7                	mov    %eax,%edi
+  800a05:	fc                   	cld
+  800a06:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a08:	5e                   	pop    %esi
+  800a09:	5f                   	pop    %edi
+  800a0a:	5d                   	pop    %ebp
+  800a0b:	c3                   	ret
+
+00800a0c <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a0c:	55                   	push   %ebp
+  800a0d:	89 e5                	mov    %esp,%ebp
+  800a0f:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a12:	ff 75 10             	push   0x10(%ebp)
+  800a15:	ff 75 0c             	push   0xc(%ebp)
+  800a18:	ff 75 08             	push   0x8(%ebp)
+  800a1b:	e8 8a ff ff ff       	call   8009aa <memmove>
+}
+  800a20:	c9                   	leave
+  800a21:	c3                   	ret
+
+00800a22 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a22:	55                   	push   %ebp
+  800a23:	89 e5                	mov    %esp,%ebp
+  800a25:	56                   	push   %esi
+  800a26:	53                   	push   %ebx
+  800a27:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a2a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a2d:	89 c6                	mov    %eax,%esi
+  800a2f:	03 75 10             	add    0x10(%ebp),%esi
+  800a32:	eb 06                	jmp    800a3a <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a34:	83 c0 01             	add    $0x1,%eax
+  800a37:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a3a:	39 f0                	cmp    %esi,%eax
+  800a3c:	74 14                	je     800a52 <memcmp+0x30>
+		if (*s1 != *s2)
+  800a3e:	0f b6 08             	movzbl (%eax),%ecx
+  800a41:	0f b6 1a             	movzbl (%edx),%ebx
+  800a44:	38 d9                	cmp    %bl,%cl
+  800a46:	74 ec                	je     800a34 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a48:	0f b6 c1             	movzbl %cl,%eax
+  800a4b:	0f b6 db             	movzbl %bl,%ebx
+  800a4e:	29 d8                	sub    %ebx,%eax
+  800a50:	eb 05                	jmp    800a57 <memcmp+0x35>
+	}
+
+	return 0;
+  800a52:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a57:	5b                   	pop    %ebx
+  800a58:	5e                   	pop    %esi
+  800a59:	5d                   	pop    %ebp
+  800a5a:	c3                   	ret
+
+00800a5b <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a5b:	55                   	push   %ebp
+  800a5c:	89 e5                	mov    %esp,%ebp
+  800a5e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a61:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a64:	89 c2                	mov    %eax,%edx
+  800a66:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a69:	eb 03                	jmp    800a6e <memfind+0x13>
+  800a6b:	83 c0 01             	add    $0x1,%eax
+  800a6e:	39 d0                	cmp    %edx,%eax
+  800a70:	73 04                	jae    800a76 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a72:	38 08                	cmp    %cl,(%eax)
+  800a74:	75 f5                	jne    800a6b <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a76:	5d                   	pop    %ebp
+  800a77:	c3                   	ret
+
+00800a78 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a78:	55                   	push   %ebp
+  800a79:	89 e5                	mov    %esp,%ebp
+  800a7b:	57                   	push   %edi
+  800a7c:	56                   	push   %esi
+  800a7d:	53                   	push   %ebx
+  800a7e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a81:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a84:	eb 03                	jmp    800a89 <strtol+0x11>
+		s++;
+  800a86:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a89:	0f b6 02             	movzbl (%edx),%eax
+  800a8c:	3c 20                	cmp    $0x20,%al
+  800a8e:	74 f6                	je     800a86 <strtol+0xe>
+  800a90:	3c 09                	cmp    $0x9,%al
+  800a92:	74 f2                	je     800a86 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a94:	3c 2b                	cmp    $0x2b,%al
+  800a96:	74 2a                	je     800ac2 <strtol+0x4a>
+	int neg = 0;
+  800a98:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a9d:	3c 2d                	cmp    $0x2d,%al
+  800a9f:	74 2b                	je     800acc <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800aa1:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800aa7:	75 0f                	jne    800ab8 <strtol+0x40>
+  800aa9:	80 3a 30             	cmpb   $0x30,(%edx)
+  800aac:	74 28                	je     800ad6 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800aae:	85 db                	test   %ebx,%ebx
+  800ab0:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ab5:	0f 44 d8             	cmove  %eax,%ebx
+  800ab8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800abd:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800ac0:	eb 46                	jmp    800b08 <strtol+0x90>
+		s++;
+  800ac2:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800ac5:	bf 00 00 00 00       	mov    $0x0,%edi
+  800aca:	eb d5                	jmp    800aa1 <strtol+0x29>
+		s++, neg = 1;
+  800acc:	83 c2 01             	add    $0x1,%edx
+  800acf:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ad4:	eb cb                	jmp    800aa1 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ad6:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800ada:	74 0e                	je     800aea <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800adc:	85 db                	test   %ebx,%ebx
+  800ade:	75 d8                	jne    800ab8 <strtol+0x40>
+		s++, base = 8;
+  800ae0:	83 c2 01             	add    $0x1,%edx
+  800ae3:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800ae8:	eb ce                	jmp    800ab8 <strtol+0x40>
+		s += 2, base = 16;
+  800aea:	83 c2 02             	add    $0x2,%edx
+  800aed:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800af2:	eb c4                	jmp    800ab8 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800af4:	0f be c0             	movsbl %al,%eax
+  800af7:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800afa:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800afd:	7d 3a                	jge    800b39 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800aff:	83 c2 01             	add    $0x1,%edx
+  800b02:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800b06:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800b08:	0f b6 02             	movzbl (%edx),%eax
+  800b0b:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b0e:	89 f3                	mov    %esi,%ebx
+  800b10:	80 fb 09             	cmp    $0x9,%bl
+  800b13:	76 df                	jbe    800af4 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800b15:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b18:	89 f3                	mov    %esi,%ebx
+  800b1a:	80 fb 19             	cmp    $0x19,%bl
+  800b1d:	77 08                	ja     800b27 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800b1f:	0f be c0             	movsbl %al,%eax
+  800b22:	83 e8 57             	sub    $0x57,%eax
+  800b25:	eb d3                	jmp    800afa <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b27:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b2a:	89 f3                	mov    %esi,%ebx
+  800b2c:	80 fb 19             	cmp    $0x19,%bl
+  800b2f:	77 08                	ja     800b39 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800b31:	0f be c0             	movsbl %al,%eax
+  800b34:	83 e8 37             	sub    $0x37,%eax
+  800b37:	eb c1                	jmp    800afa <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b39:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b3d:	74 05                	je     800b44 <strtol+0xcc>
+		*endptr = (char *) s;
+  800b3f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b42:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800b44:	89 c8                	mov    %ecx,%eax
+  800b46:	f7 d8                	neg    %eax
+  800b48:	85 ff                	test   %edi,%edi
+  800b4a:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b4d:	89 c8                	mov    %ecx,%eax
+  800b4f:	5b                   	pop    %ebx
+  800b50:	5e                   	pop    %esi
+  800b51:	5f                   	pop    %edi
+  800b52:	5d                   	pop    %ebp
+  800b53:	c3                   	ret
+
+00800b54 <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800b54:	55                   	push   %ebp
+  800b55:	89 e5                	mov    %esp,%ebp
+  800b57:	57                   	push   %edi
+  800b58:	56                   	push   %esi
+  800b59:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800b5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b5f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b62:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b65:	89 c3                	mov    %eax,%ebx
+  800b67:	89 c7                	mov    %eax,%edi
+  800b69:	89 c6                	mov    %eax,%esi
+  800b6b:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  800b6d:	5b                   	pop    %ebx
+  800b6e:	5e                   	pop    %esi
+  800b6f:	5f                   	pop    %edi
+  800b70:	5d                   	pop    %ebp
+  800b71:	c3                   	ret
+
+00800b72 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800b72:	55                   	push   %ebp
+  800b73:	89 e5                	mov    %esp,%ebp
+  800b75:	57                   	push   %edi
+  800b76:	56                   	push   %esi
+  800b77:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800b78:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b7d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b82:	89 d1                	mov    %edx,%ecx
+  800b84:	89 d3                	mov    %edx,%ebx
+  800b86:	89 d7                	mov    %edx,%edi
+  800b88:	89 d6                	mov    %edx,%esi
+  800b8a:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800b8c:	5b                   	pop    %ebx
+  800b8d:	5e                   	pop    %esi
+  800b8e:	5f                   	pop    %edi
+  800b8f:	5d                   	pop    %ebp
+  800b90:	c3                   	ret
+
+00800b91 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800b91:	55                   	push   %ebp
+  800b92:	89 e5                	mov    %esp,%ebp
+  800b94:	57                   	push   %edi
+  800b95:	56                   	push   %esi
+  800b96:	53                   	push   %ebx
+  800b97:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800b9a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b9f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ba2:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ba7:	89 cb                	mov    %ecx,%ebx
+  800ba9:	89 cf                	mov    %ecx,%edi
+  800bab:	89 ce                	mov    %ecx,%esi
+  800bad:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800baf:	85 c0                	test   %eax,%eax
+  800bb1:	7f 08                	jg     800bbb <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800bb3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bb6:	5b                   	pop    %ebx
+  800bb7:	5e                   	pop    %esi
+  800bb8:	5f                   	pop    %edi
+  800bb9:	5d                   	pop    %ebp
+  800bba:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800bbb:	83 ec 0c             	sub    $0xc,%esp
+  800bbe:	50                   	push   %eax
+  800bbf:	6a 03                	push   $0x3
+  800bc1:	68 83 2a 80 00       	push   $0x802a83
+  800bc6:	6a 3e                	push   $0x3e
+  800bc8:	68 a0 2a 80 00       	push   $0x802aa0
+  800bcd:	e8 be f5 ff ff       	call   800190 <_panic>
+
+00800bd2 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800bd2:	55                   	push   %ebp
+  800bd3:	89 e5                	mov    %esp,%ebp
+  800bd5:	57                   	push   %edi
+  800bd6:	56                   	push   %esi
+  800bd7:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800bd8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bdd:	b8 02 00 00 00       	mov    $0x2,%eax
+  800be2:	89 d1                	mov    %edx,%ecx
+  800be4:	89 d3                	mov    %edx,%ebx
+  800be6:	89 d7                	mov    %edx,%edi
+  800be8:	89 d6                	mov    %edx,%esi
+  800bea:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800bec:	5b                   	pop    %ebx
+  800bed:	5e                   	pop    %esi
+  800bee:	5f                   	pop    %edi
+  800bef:	5d                   	pop    %ebp
+  800bf0:	c3                   	ret
+
+00800bf1 <sys_yield>:
+
+void
+sys_yield(void) {
+  800bf1:	55                   	push   %ebp
+  800bf2:	89 e5                	mov    %esp,%ebp
+  800bf4:	57                   	push   %edi
+  800bf5:	56                   	push   %esi
+  800bf6:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800bf7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bfc:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800c01:	89 d1                	mov    %edx,%ecx
+  800c03:	89 d3                	mov    %edx,%ebx
+  800c05:	89 d7                	mov    %edx,%edi
+  800c07:	89 d6                	mov    %edx,%esi
+  800c09:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800c0b:	5b                   	pop    %ebx
+  800c0c:	5e                   	pop    %esi
+  800c0d:	5f                   	pop    %edi
+  800c0e:	5d                   	pop    %ebp
+  800c0f:	c3                   	ret
+
+00800c10 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  800c10:	55                   	push   %ebp
+  800c11:	89 e5                	mov    %esp,%ebp
+  800c13:	57                   	push   %edi
+  800c14:	56                   	push   %esi
+  800c15:	53                   	push   %ebx
+  800c16:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c19:	be 00 00 00 00       	mov    $0x0,%esi
+  800c1e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c21:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c24:	b8 04 00 00 00       	mov    $0x4,%eax
+  800c29:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c2c:	89 f7                	mov    %esi,%edi
+  800c2e:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c30:	85 c0                	test   %eax,%eax
+  800c32:	7f 08                	jg     800c3c <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800c34:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c37:	5b                   	pop    %ebx
+  800c38:	5e                   	pop    %esi
+  800c39:	5f                   	pop    %edi
+  800c3a:	5d                   	pop    %ebp
+  800c3b:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c3c:	83 ec 0c             	sub    $0xc,%esp
+  800c3f:	50                   	push   %eax
+  800c40:	6a 04                	push   $0x4
+  800c42:	68 83 2a 80 00       	push   $0x802a83
+  800c47:	6a 3e                	push   $0x3e
+  800c49:	68 a0 2a 80 00       	push   $0x802aa0
+  800c4e:	e8 3d f5 ff ff       	call   800190 <_panic>
+
+00800c53 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  800c53:	55                   	push   %ebp
+  800c54:	89 e5                	mov    %esp,%ebp
+  800c56:	57                   	push   %edi
+  800c57:	56                   	push   %esi
+  800c58:	53                   	push   %ebx
+  800c59:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c5c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c5f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c62:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c67:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c6a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c6d:	8b 75 18             	mov    0x18(%ebp),%esi
+  800c70:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c72:	85 c0                	test   %eax,%eax
+  800c74:	7f 08                	jg     800c7e <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800c76:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c79:	5b                   	pop    %ebx
+  800c7a:	5e                   	pop    %esi
+  800c7b:	5f                   	pop    %edi
+  800c7c:	5d                   	pop    %ebp
+  800c7d:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c7e:	83 ec 0c             	sub    $0xc,%esp
+  800c81:	50                   	push   %eax
+  800c82:	6a 05                	push   $0x5
+  800c84:	68 83 2a 80 00       	push   $0x802a83
+  800c89:	6a 3e                	push   $0x3e
+  800c8b:	68 a0 2a 80 00       	push   $0x802aa0
+  800c90:	e8 fb f4 ff ff       	call   800190 <_panic>
+
+00800c95 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  800c95:	55                   	push   %ebp
+  800c96:	89 e5                	mov    %esp,%ebp
+  800c98:	57                   	push   %edi
+  800c99:	56                   	push   %esi
+  800c9a:	53                   	push   %ebx
+  800c9b:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c9e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ca3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ca6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ca9:	b8 06 00 00 00       	mov    $0x6,%eax
+  800cae:	89 df                	mov    %ebx,%edi
+  800cb0:	89 de                	mov    %ebx,%esi
+  800cb2:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800cb4:	85 c0                	test   %eax,%eax
+  800cb6:	7f 08                	jg     800cc0 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800cb8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cbb:	5b                   	pop    %ebx
+  800cbc:	5e                   	pop    %esi
+  800cbd:	5f                   	pop    %edi
+  800cbe:	5d                   	pop    %ebp
+  800cbf:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800cc0:	83 ec 0c             	sub    $0xc,%esp
+  800cc3:	50                   	push   %eax
+  800cc4:	6a 06                	push   $0x6
+  800cc6:	68 83 2a 80 00       	push   $0x802a83
+  800ccb:	6a 3e                	push   $0x3e
+  800ccd:	68 a0 2a 80 00       	push   $0x802aa0
+  800cd2:	e8 b9 f4 ff ff       	call   800190 <_panic>
+
+00800cd7 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800cd7:	55                   	push   %ebp
+  800cd8:	89 e5                	mov    %esp,%ebp
+  800cda:	57                   	push   %edi
+  800cdb:	56                   	push   %esi
+  800cdc:	53                   	push   %ebx
+  800cdd:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800ce0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ce5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ce8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ceb:	b8 08 00 00 00       	mov    $0x8,%eax
+  800cf0:	89 df                	mov    %ebx,%edi
+  800cf2:	89 de                	mov    %ebx,%esi
+  800cf4:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800cf6:	85 c0                	test   %eax,%eax
+  800cf8:	7f 08                	jg     800d02 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800cfa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cfd:	5b                   	pop    %ebx
+  800cfe:	5e                   	pop    %esi
+  800cff:	5f                   	pop    %edi
+  800d00:	5d                   	pop    %ebp
+  800d01:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d02:	83 ec 0c             	sub    $0xc,%esp
+  800d05:	50                   	push   %eax
+  800d06:	6a 08                	push   $0x8
+  800d08:	68 83 2a 80 00       	push   $0x802a83
+  800d0d:	6a 3e                	push   $0x3e
+  800d0f:	68 a0 2a 80 00       	push   $0x802aa0
+  800d14:	e8 77 f4 ff ff       	call   800190 <_panic>
+
+00800d19 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800d19:	55                   	push   %ebp
+  800d1a:	89 e5                	mov    %esp,%ebp
+  800d1c:	57                   	push   %edi
+  800d1d:	56                   	push   %esi
+  800d1e:	53                   	push   %ebx
+  800d1f:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800d22:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d27:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d2a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d2d:	b8 09 00 00 00       	mov    $0x9,%eax
+  800d32:	89 df                	mov    %ebx,%edi
+  800d34:	89 de                	mov    %ebx,%esi
+  800d36:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d38:	85 c0                	test   %eax,%eax
+  800d3a:	7f 08                	jg     800d44 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800d3c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d3f:	5b                   	pop    %ebx
+  800d40:	5e                   	pop    %esi
+  800d41:	5f                   	pop    %edi
+  800d42:	5d                   	pop    %ebp
+  800d43:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d44:	83 ec 0c             	sub    $0xc,%esp
+  800d47:	50                   	push   %eax
+  800d48:	6a 09                	push   $0x9
+  800d4a:	68 83 2a 80 00       	push   $0x802a83
+  800d4f:	6a 3e                	push   $0x3e
+  800d51:	68 a0 2a 80 00       	push   $0x802aa0
+  800d56:	e8 35 f4 ff ff       	call   800190 <_panic>
+
+00800d5b <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800d5b:	55                   	push   %ebp
+  800d5c:	89 e5                	mov    %esp,%ebp
+  800d5e:	57                   	push   %edi
+  800d5f:	56                   	push   %esi
+  800d60:	53                   	push   %ebx
+  800d61:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800d64:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d69:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d6c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d6f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d74:	89 df                	mov    %ebx,%edi
+  800d76:	89 de                	mov    %ebx,%esi
+  800d78:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d7a:	85 c0                	test   %eax,%eax
+  800d7c:	7f 08                	jg     800d86 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800d7e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d81:	5b                   	pop    %ebx
+  800d82:	5e                   	pop    %esi
+  800d83:	5f                   	pop    %edi
+  800d84:	5d                   	pop    %ebp
+  800d85:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d86:	83 ec 0c             	sub    $0xc,%esp
+  800d89:	50                   	push   %eax
+  800d8a:	6a 0a                	push   $0xa
+  800d8c:	68 83 2a 80 00       	push   $0x802a83
+  800d91:	6a 3e                	push   $0x3e
+  800d93:	68 a0 2a 80 00       	push   $0x802aa0
+  800d98:	e8 f3 f3 ff ff       	call   800190 <_panic>
+
+00800d9d <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  800d9d:	55                   	push   %ebp
+  800d9e:	89 e5                	mov    %esp,%ebp
+  800da0:	57                   	push   %edi
+  800da1:	56                   	push   %esi
+  800da2:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800da3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800da6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800da9:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800dae:	be 00 00 00 00       	mov    $0x0,%esi
+  800db3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800db6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800db9:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800dbb:	5b                   	pop    %ebx
+  800dbc:	5e                   	pop    %esi
+  800dbd:	5f                   	pop    %edi
+  800dbe:	5d                   	pop    %ebp
+  800dbf:	c3                   	ret
+
+00800dc0 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  800dc0:	55                   	push   %ebp
+  800dc1:	89 e5                	mov    %esp,%ebp
+  800dc3:	57                   	push   %edi
+  800dc4:	56                   	push   %esi
+  800dc5:	53                   	push   %ebx
+  800dc6:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800dc9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dce:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd1:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800dd6:	89 cb                	mov    %ecx,%ebx
+  800dd8:	89 cf                	mov    %ecx,%edi
+  800dda:	89 ce                	mov    %ecx,%esi
+  800ddc:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800dde:	85 c0                	test   %eax,%eax
+  800de0:	7f 08                	jg     800dea <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  800de2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800de5:	5b                   	pop    %ebx
+  800de6:	5e                   	pop    %esi
+  800de7:	5f                   	pop    %edi
+  800de8:	5d                   	pop    %ebp
+  800de9:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800dea:	83 ec 0c             	sub    $0xc,%esp
+  800ded:	50                   	push   %eax
+  800dee:	6a 0d                	push   $0xd
+  800df0:	68 83 2a 80 00       	push   $0x802a83
+  800df5:	6a 3e                	push   $0x3e
+  800df7:	68 a0 2a 80 00       	push   $0x802aa0
+  800dfc:	e8 8f f3 ff ff       	call   800190 <_panic>
+
+00800e01 <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  800e01:	55                   	push   %ebp
+  800e02:	89 e5                	mov    %esp,%ebp
+  800e04:	57                   	push   %edi
+  800e05:	56                   	push   %esi
+  800e06:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e07:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e0c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e0f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e12:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800e17:	89 df                	mov    %ebx,%edi
+  800e19:	89 de                	mov    %ebx,%esi
+  800e1b:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  800e1d:	5b                   	pop    %ebx
+  800e1e:	5e                   	pop    %esi
+  800e1f:	5f                   	pop    %edi
+  800e20:	5d                   	pop    %ebp
+  800e21:	c3                   	ret
+
+00800e22 <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  800e22:	55                   	push   %ebp
+  800e23:	89 e5                	mov    %esp,%ebp
+  800e25:	57                   	push   %edi
+  800e26:	56                   	push   %esi
+  800e27:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e28:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e2d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e30:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800e35:	89 cb                	mov    %ecx,%ebx
+  800e37:	89 cf                	mov    %ecx,%edi
+  800e39:	89 ce                	mov    %ecx,%esi
+  800e3b:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  800e3d:	5b                   	pop    %ebx
+  800e3e:	5e                   	pop    %esi
+  800e3f:	5f                   	pop    %edi
+  800e40:	5d                   	pop    %ebp
+  800e41:	c3                   	ret
+
+00800e42 <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  800e42:	55                   	push   %ebp
+  800e43:	89 e5                	mov    %esp,%ebp
+  800e45:	57                   	push   %edi
+  800e46:	56                   	push   %esi
+  800e47:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e48:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e4d:	b8 10 00 00 00       	mov    $0x10,%eax
+  800e52:	89 d1                	mov    %edx,%ecx
+  800e54:	89 d3                	mov    %edx,%ebx
+  800e56:	89 d7                	mov    %edx,%edi
+  800e58:	89 d6                	mov    %edx,%esi
+  800e5a:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800e5c:	5b                   	pop    %ebx
+  800e5d:	5e                   	pop    %esi
+  800e5e:	5f                   	pop    %edi
+  800e5f:	5d                   	pop    %ebp
+  800e60:	c3                   	ret
+
+00800e61 <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  800e61:	55                   	push   %ebp
+  800e62:	89 e5                	mov    %esp,%ebp
+  800e64:	57                   	push   %edi
+  800e65:	56                   	push   %esi
+  800e66:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e67:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e6f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e72:	b8 11 00 00 00       	mov    $0x11,%eax
+  800e77:	89 df                	mov    %ebx,%edi
+  800e79:	89 de                	mov    %ebx,%esi
+  800e7b:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800e7d:	5b                   	pop    %ebx
+  800e7e:	5e                   	pop    %esi
+  800e7f:	5f                   	pop    %edi
+  800e80:	5d                   	pop    %ebp
+  800e81:	c3                   	ret
+
+00800e82 <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  800e82:	55                   	push   %ebp
+  800e83:	89 e5                	mov    %esp,%ebp
+  800e85:	57                   	push   %edi
+  800e86:	56                   	push   %esi
+  800e87:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e88:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e8d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e90:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e93:	b8 12 00 00 00       	mov    $0x12,%eax
+  800e98:	89 df                	mov    %ebx,%edi
+  800e9a:	89 de                	mov    %ebx,%esi
+  800e9c:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800e9e:	5b                   	pop    %ebx
+  800e9f:	5e                   	pop    %esi
+  800ea0:	5f                   	pop    %edi
+  800ea1:	5d                   	pop    %ebp
+  800ea2:	c3                   	ret
+
+00800ea3 <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  800ea3:	55                   	push   %ebp
+  800ea4:	89 e5                	mov    %esp,%ebp
+  800ea6:	57                   	push   %edi
+  800ea7:	56                   	push   %esi
+  800ea8:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800ea9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800eae:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb1:	b8 13 00 00 00       	mov    $0x13,%eax
+  800eb6:	89 cb                	mov    %ecx,%ebx
+  800eb8:	89 cf                	mov    %ecx,%edi
+  800eba:	89 ce                	mov    %ecx,%esi
+  800ebc:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  800ebe:	5b                   	pop    %ebx
+  800ebf:	5e                   	pop    %esi
+  800ec0:	5f                   	pop    %edi
+  800ec1:	5d                   	pop    %ebp
+  800ec2:	c3                   	ret
+
+00800ec3 <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  800ec3:	55                   	push   %ebp
+  800ec4:	89 e5                	mov    %esp,%ebp
+  800ec6:	57                   	push   %edi
+  800ec7:	56                   	push   %esi
+  800ec8:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800ec9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ece:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed1:	b8 14 00 00 00       	mov    $0x14,%eax
+  800ed6:	89 cb                	mov    %ecx,%ebx
+  800ed8:	89 cf                	mov    %ecx,%edi
+  800eda:	89 ce                	mov    %ecx,%esi
+  800edc:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  800ede:	5b                   	pop    %ebx
+  800edf:	5e                   	pop    %esi
+  800ee0:	5f                   	pop    %edi
+  800ee1:	5d                   	pop    %ebp
+  800ee2:	c3                   	ret
+
+00800ee3 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800ee3:	55                   	push   %ebp
+  800ee4:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800ee6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ee9:	05 00 00 00 30       	add    $0x30000000,%eax
+  800eee:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800ef1:	5d                   	pop    %ebp
+  800ef2:	c3                   	ret
+
+00800ef3 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800ef3:	55                   	push   %ebp
+  800ef4:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800ef6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ef9:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800efe:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800f03:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800f08:	5d                   	pop    %ebp
+  800f09:	c3                   	ret
+
+00800f0a <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800f0a:	55                   	push   %ebp
+  800f0b:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  800f0d:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800f12:	eb 02                	jmp    800f16 <fd_alloc+0xc>
+  800f14:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800f16:	89 c2                	mov    %eax,%edx
+  800f18:	c1 ea 16             	shr    $0x16,%edx
+  800f1b:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800f22:	f6 c2 01             	test   $0x1,%dl
+  800f25:	74 2b                	je     800f52 <fd_alloc+0x48>
+  800f27:	89 c2                	mov    %eax,%edx
+  800f29:	c1 ea 0c             	shr    $0xc,%edx
+  800f2c:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  800f33:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  800f39:	f6 c1 01             	test   $0x1,%cl
+  800f3c:	74 14                	je     800f52 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  800f3e:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  800f44:	75 ce                	jne    800f14 <fd_alloc+0xa>
+  800f46:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  800f4b:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800f50:	eb 05                	jmp    800f57 <fd_alloc+0x4d>
+			return 0;
+  800f52:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  800f57:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f5a:	89 02                	mov    %eax,(%edx)
+}
+  800f5c:	89 c8                	mov    %ecx,%eax
+  800f5e:	5d                   	pop    %ebp
+  800f5f:	c3                   	ret
+
+00800f60 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  800f60:	55                   	push   %ebp
+  800f61:	89 e5                	mov    %esp,%ebp
+  800f63:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  800f66:	83 f8 1f             	cmp    $0x1f,%eax
+  800f69:	77 30                	ja     800f9b <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  800f6b:	c1 e0 0c             	shl    $0xc,%eax
+  800f6e:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800f73:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  800f79:	f6 c2 01             	test   $0x1,%dl
+  800f7c:	74 24                	je     800fa2 <fd_lookup+0x42>
+  800f7e:	89 c2                	mov    %eax,%edx
+  800f80:	c1 ea 0c             	shr    $0xc,%edx
+  800f83:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800f8a:	f6 c2 01             	test   $0x1,%dl
+  800f8d:	74 1a                	je     800fa9 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  800f8f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800f92:	89 02                	mov    %eax,(%edx)
+	return 0;
+  800f94:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f99:	5d                   	pop    %ebp
+  800f9a:	c3                   	ret
+		return -E_INVAL;
+  800f9b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800fa0:	eb f7                	jmp    800f99 <fd_lookup+0x39>
+		return -E_INVAL;
+  800fa2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800fa7:	eb f0                	jmp    800f99 <fd_lookup+0x39>
+  800fa9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800fae:	eb e9                	jmp    800f99 <fd_lookup+0x39>
+
+00800fb0 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  800fb0:	55                   	push   %ebp
+  800fb1:	89 e5                	mov    %esp,%ebp
+  800fb3:	53                   	push   %ebx
+  800fb4:	83 ec 04             	sub    $0x4,%esp
+  800fb7:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  800fba:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fbf:	eb 03                	jmp    800fc4 <dev_lookup+0x14>
+  800fc1:	83 c0 01             	add    $0x1,%eax
+  800fc4:	8b 1c 85 2c 2b 80 00 	mov    0x802b2c(,%eax,4),%ebx
+  800fcb:	85 db                	test   %ebx,%ebx
+  800fcd:	74 0b                	je     800fda <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  800fcf:	39 13                	cmp    %edx,(%ebx)
+  800fd1:	75 ee                	jne    800fc1 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  800fd3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fd8:	eb 1f                	jmp    800ff9 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800fda:	a1 20 60 80 00       	mov    0x806020,%eax
+  800fdf:	8b 40 48             	mov    0x48(%eax),%eax
+  800fe2:	83 ec 04             	sub    $0x4,%esp
+  800fe5:	52                   	push   %edx
+  800fe6:	50                   	push   %eax
+  800fe7:	68 b0 2a 80 00       	push   $0x802ab0
+  800fec:	e8 7a f2 ff ff       	call   80026b <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  800ff1:	83 c4 10             	add    $0x10,%esp
+  800ff4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  800ff9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ffc:	89 1a                	mov    %ebx,(%edx)
+}
+  800ffe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801001:	c9                   	leave
+  801002:	c3                   	ret
+
+00801003 <fd_close>:
+{
+  801003:	55                   	push   %ebp
+  801004:	89 e5                	mov    %esp,%ebp
+  801006:	57                   	push   %edi
+  801007:	56                   	push   %esi
+  801008:	53                   	push   %ebx
+  801009:	83 ec 24             	sub    $0x24,%esp
+  80100c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80100f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801012:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801015:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801016:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80101c:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80101f:	50                   	push   %eax
+  801020:	e8 3b ff ff ff       	call   800f60 <fd_lookup>
+  801025:	89 c3                	mov    %eax,%ebx
+  801027:	83 c4 10             	add    $0x10,%esp
+  80102a:	85 c0                	test   %eax,%eax
+  80102c:	78 05                	js     801033 <fd_close+0x30>
+	    || fd != fd2)
+  80102e:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801031:	74 16                	je     801049 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801033:	89 f8                	mov    %edi,%eax
+  801035:	84 c0                	test   %al,%al
+  801037:	b8 00 00 00 00       	mov    $0x0,%eax
+  80103c:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80103f:	89 d8                	mov    %ebx,%eax
+  801041:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801044:	5b                   	pop    %ebx
+  801045:	5e                   	pop    %esi
+  801046:	5f                   	pop    %edi
+  801047:	5d                   	pop    %ebp
+  801048:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801049:	83 ec 08             	sub    $0x8,%esp
+  80104c:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80104f:	50                   	push   %eax
+  801050:	ff 36                	push   (%esi)
+  801052:	e8 59 ff ff ff       	call   800fb0 <dev_lookup>
+  801057:	89 c3                	mov    %eax,%ebx
+  801059:	83 c4 10             	add    $0x10,%esp
+  80105c:	85 c0                	test   %eax,%eax
+  80105e:	78 1a                	js     80107a <fd_close+0x77>
+		if (dev->dev_close)
+  801060:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801063:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801066:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80106b:	85 c0                	test   %eax,%eax
+  80106d:	74 0b                	je     80107a <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80106f:	83 ec 0c             	sub    $0xc,%esp
+  801072:	56                   	push   %esi
+  801073:	ff d0                	call   *%eax
+  801075:	89 c3                	mov    %eax,%ebx
+  801077:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80107a:	83 ec 08             	sub    $0x8,%esp
+  80107d:	56                   	push   %esi
+  80107e:	6a 00                	push   $0x0
+  801080:	e8 10 fc ff ff       	call   800c95 <sys_page_unmap>
+	return r;
+  801085:	83 c4 10             	add    $0x10,%esp
+  801088:	eb b5                	jmp    80103f <fd_close+0x3c>
+
+0080108a <close>:
+
+int
+close(int fdnum)
+{
+  80108a:	55                   	push   %ebp
+  80108b:	89 e5                	mov    %esp,%ebp
+  80108d:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801090:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801093:	50                   	push   %eax
+  801094:	ff 75 08             	push   0x8(%ebp)
+  801097:	e8 c4 fe ff ff       	call   800f60 <fd_lookup>
+  80109c:	83 c4 10             	add    $0x10,%esp
+  80109f:	85 c0                	test   %eax,%eax
+  8010a1:	79 02                	jns    8010a5 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8010a3:	c9                   	leave
+  8010a4:	c3                   	ret
+		return fd_close(fd, 1);
+  8010a5:	83 ec 08             	sub    $0x8,%esp
+  8010a8:	6a 01                	push   $0x1
+  8010aa:	ff 75 f4             	push   -0xc(%ebp)
+  8010ad:	e8 51 ff ff ff       	call   801003 <fd_close>
+  8010b2:	83 c4 10             	add    $0x10,%esp
+  8010b5:	eb ec                	jmp    8010a3 <close+0x19>
+
+008010b7 <close_all>:
+
+void
+close_all(void)
+{
+  8010b7:	55                   	push   %ebp
+  8010b8:	89 e5                	mov    %esp,%ebp
+  8010ba:	53                   	push   %ebx
+  8010bb:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8010be:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8010c3:	83 ec 0c             	sub    $0xc,%esp
+  8010c6:	53                   	push   %ebx
+  8010c7:	e8 be ff ff ff       	call   80108a <close>
+	for (i = 0; i < MAXFD; i++)
+  8010cc:	83 c3 01             	add    $0x1,%ebx
+  8010cf:	83 c4 10             	add    $0x10,%esp
+  8010d2:	83 fb 20             	cmp    $0x20,%ebx
+  8010d5:	75 ec                	jne    8010c3 <close_all+0xc>
+}
+  8010d7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010da:	c9                   	leave
+  8010db:	c3                   	ret
+
+008010dc <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8010dc:	55                   	push   %ebp
+  8010dd:	89 e5                	mov    %esp,%ebp
+  8010df:	57                   	push   %edi
+  8010e0:	56                   	push   %esi
+  8010e1:	53                   	push   %ebx
+  8010e2:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8010e5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8010e8:	50                   	push   %eax
+  8010e9:	ff 75 08             	push   0x8(%ebp)
+  8010ec:	e8 6f fe ff ff       	call   800f60 <fd_lookup>
+  8010f1:	89 c3                	mov    %eax,%ebx
+  8010f3:	83 c4 10             	add    $0x10,%esp
+  8010f6:	85 c0                	test   %eax,%eax
+  8010f8:	78 7f                	js     801179 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8010fa:	83 ec 0c             	sub    $0xc,%esp
+  8010fd:	ff 75 0c             	push   0xc(%ebp)
+  801100:	e8 85 ff ff ff       	call   80108a <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801105:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801108:	c1 e6 0c             	shl    $0xc,%esi
+  80110b:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801111:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801114:	89 3c 24             	mov    %edi,(%esp)
+  801117:	e8 d7 fd ff ff       	call   800ef3 <fd2data>
+  80111c:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80111e:	89 34 24             	mov    %esi,(%esp)
+  801121:	e8 cd fd ff ff       	call   800ef3 <fd2data>
+  801126:	83 c4 10             	add    $0x10,%esp
+  801129:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80112c:	89 d8                	mov    %ebx,%eax
+  80112e:	c1 e8 16             	shr    $0x16,%eax
+  801131:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801138:	a8 01                	test   $0x1,%al
+  80113a:	74 11                	je     80114d <dup+0x71>
+  80113c:	89 d8                	mov    %ebx,%eax
+  80113e:	c1 e8 0c             	shr    $0xc,%eax
+  801141:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801148:	f6 c2 01             	test   $0x1,%dl
+  80114b:	75 36                	jne    801183 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80114d:	89 f8                	mov    %edi,%eax
+  80114f:	c1 e8 0c             	shr    $0xc,%eax
+  801152:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801159:	83 ec 0c             	sub    $0xc,%esp
+  80115c:	25 07 0e 00 00       	and    $0xe07,%eax
+  801161:	50                   	push   %eax
+  801162:	56                   	push   %esi
+  801163:	6a 00                	push   $0x0
+  801165:	57                   	push   %edi
+  801166:	6a 00                	push   $0x0
+  801168:	e8 e6 fa ff ff       	call   800c53 <sys_page_map>
+  80116d:	89 c3                	mov    %eax,%ebx
+  80116f:	83 c4 20             	add    $0x20,%esp
+  801172:	85 c0                	test   %eax,%eax
+  801174:	78 33                	js     8011a9 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801176:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801179:	89 d8                	mov    %ebx,%eax
+  80117b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80117e:	5b                   	pop    %ebx
+  80117f:	5e                   	pop    %esi
+  801180:	5f                   	pop    %edi
+  801181:	5d                   	pop    %ebp
+  801182:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801183:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80118a:	83 ec 0c             	sub    $0xc,%esp
+  80118d:	25 07 0e 00 00       	and    $0xe07,%eax
+  801192:	50                   	push   %eax
+  801193:	ff 75 d4             	push   -0x2c(%ebp)
+  801196:	6a 00                	push   $0x0
+  801198:	53                   	push   %ebx
+  801199:	6a 00                	push   $0x0
+  80119b:	e8 b3 fa ff ff       	call   800c53 <sys_page_map>
+  8011a0:	89 c3                	mov    %eax,%ebx
+  8011a2:	83 c4 20             	add    $0x20,%esp
+  8011a5:	85 c0                	test   %eax,%eax
+  8011a7:	79 a4                	jns    80114d <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8011a9:	83 ec 08             	sub    $0x8,%esp
+  8011ac:	56                   	push   %esi
+  8011ad:	6a 00                	push   $0x0
+  8011af:	e8 e1 fa ff ff       	call   800c95 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8011b4:	83 c4 08             	add    $0x8,%esp
+  8011b7:	ff 75 d4             	push   -0x2c(%ebp)
+  8011ba:	6a 00                	push   $0x0
+  8011bc:	e8 d4 fa ff ff       	call   800c95 <sys_page_unmap>
+	return r;
+  8011c1:	83 c4 10             	add    $0x10,%esp
+  8011c4:	eb b3                	jmp    801179 <dup+0x9d>
+
+008011c6 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8011c6:	55                   	push   %ebp
+  8011c7:	89 e5                	mov    %esp,%ebp
+  8011c9:	56                   	push   %esi
+  8011ca:	53                   	push   %ebx
+  8011cb:	83 ec 18             	sub    $0x18,%esp
+  8011ce:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8011d1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8011d4:	50                   	push   %eax
+  8011d5:	56                   	push   %esi
+  8011d6:	e8 85 fd ff ff       	call   800f60 <fd_lookup>
+  8011db:	83 c4 10             	add    $0x10,%esp
+  8011de:	85 c0                	test   %eax,%eax
+  8011e0:	78 3c                	js     80121e <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8011e2:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8011e5:	83 ec 08             	sub    $0x8,%esp
+  8011e8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8011eb:	50                   	push   %eax
+  8011ec:	ff 33                	push   (%ebx)
+  8011ee:	e8 bd fd ff ff       	call   800fb0 <dev_lookup>
+  8011f3:	83 c4 10             	add    $0x10,%esp
+  8011f6:	85 c0                	test   %eax,%eax
+  8011f8:	78 24                	js     80121e <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8011fa:	8b 43 08             	mov    0x8(%ebx),%eax
+  8011fd:	83 e0 03             	and    $0x3,%eax
+  801200:	83 f8 01             	cmp    $0x1,%eax
+  801203:	74 20                	je     801225 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801205:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801208:	8b 40 08             	mov    0x8(%eax),%eax
+  80120b:	85 c0                	test   %eax,%eax
+  80120d:	74 37                	je     801246 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80120f:	83 ec 04             	sub    $0x4,%esp
+  801212:	ff 75 10             	push   0x10(%ebp)
+  801215:	ff 75 0c             	push   0xc(%ebp)
+  801218:	53                   	push   %ebx
+  801219:	ff d0                	call   *%eax
+  80121b:	83 c4 10             	add    $0x10,%esp
+}
+  80121e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801221:	5b                   	pop    %ebx
+  801222:	5e                   	pop    %esi
+  801223:	5d                   	pop    %ebp
+  801224:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801225:	a1 20 60 80 00       	mov    0x806020,%eax
+  80122a:	8b 40 48             	mov    0x48(%eax),%eax
+  80122d:	83 ec 04             	sub    $0x4,%esp
+  801230:	56                   	push   %esi
+  801231:	50                   	push   %eax
+  801232:	68 f1 2a 80 00       	push   $0x802af1
+  801237:	e8 2f f0 ff ff       	call   80026b <cprintf>
+		return -E_INVAL;
+  80123c:	83 c4 10             	add    $0x10,%esp
+  80123f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801244:	eb d8                	jmp    80121e <read+0x58>
+		return -E_NOT_SUPP;
+  801246:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80124b:	eb d1                	jmp    80121e <read+0x58>
+
+0080124d <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80124d:	55                   	push   %ebp
+  80124e:	89 e5                	mov    %esp,%ebp
+  801250:	57                   	push   %edi
+  801251:	56                   	push   %esi
+  801252:	53                   	push   %ebx
+  801253:	83 ec 0c             	sub    $0xc,%esp
+  801256:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801259:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80125c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801261:	eb 02                	jmp    801265 <readn+0x18>
+  801263:	01 c3                	add    %eax,%ebx
+  801265:	39 f3                	cmp    %esi,%ebx
+  801267:	73 21                	jae    80128a <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801269:	83 ec 04             	sub    $0x4,%esp
+  80126c:	89 f0                	mov    %esi,%eax
+  80126e:	29 d8                	sub    %ebx,%eax
+  801270:	50                   	push   %eax
+  801271:	89 d8                	mov    %ebx,%eax
+  801273:	03 45 0c             	add    0xc(%ebp),%eax
+  801276:	50                   	push   %eax
+  801277:	57                   	push   %edi
+  801278:	e8 49 ff ff ff       	call   8011c6 <read>
+		if (m < 0)
+  80127d:	83 c4 10             	add    $0x10,%esp
+  801280:	85 c0                	test   %eax,%eax
+  801282:	78 04                	js     801288 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801284:	75 dd                	jne    801263 <readn+0x16>
+  801286:	eb 02                	jmp    80128a <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801288:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80128a:	89 d8                	mov    %ebx,%eax
+  80128c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80128f:	5b                   	pop    %ebx
+  801290:	5e                   	pop    %esi
+  801291:	5f                   	pop    %edi
+  801292:	5d                   	pop    %ebp
+  801293:	c3                   	ret
+
+00801294 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801294:	55                   	push   %ebp
+  801295:	89 e5                	mov    %esp,%ebp
+  801297:	56                   	push   %esi
+  801298:	53                   	push   %ebx
+  801299:	83 ec 18             	sub    $0x18,%esp
+  80129c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80129f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8012a2:	50                   	push   %eax
+  8012a3:	53                   	push   %ebx
+  8012a4:	e8 b7 fc ff ff       	call   800f60 <fd_lookup>
+  8012a9:	83 c4 10             	add    $0x10,%esp
+  8012ac:	85 c0                	test   %eax,%eax
+  8012ae:	78 37                	js     8012e7 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8012b0:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8012b3:	83 ec 08             	sub    $0x8,%esp
+  8012b6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8012b9:	50                   	push   %eax
+  8012ba:	ff 36                	push   (%esi)
+  8012bc:	e8 ef fc ff ff       	call   800fb0 <dev_lookup>
+  8012c1:	83 c4 10             	add    $0x10,%esp
+  8012c4:	85 c0                	test   %eax,%eax
+  8012c6:	78 1f                	js     8012e7 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8012c8:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8012cc:	74 20                	je     8012ee <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8012ce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8012d1:	8b 40 0c             	mov    0xc(%eax),%eax
+  8012d4:	85 c0                	test   %eax,%eax
+  8012d6:	74 37                	je     80130f <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8012d8:	83 ec 04             	sub    $0x4,%esp
+  8012db:	ff 75 10             	push   0x10(%ebp)
+  8012de:	ff 75 0c             	push   0xc(%ebp)
+  8012e1:	56                   	push   %esi
+  8012e2:	ff d0                	call   *%eax
+  8012e4:	83 c4 10             	add    $0x10,%esp
+}
+  8012e7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8012ea:	5b                   	pop    %ebx
+  8012eb:	5e                   	pop    %esi
+  8012ec:	5d                   	pop    %ebp
+  8012ed:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8012ee:	a1 20 60 80 00       	mov    0x806020,%eax
+  8012f3:	8b 40 48             	mov    0x48(%eax),%eax
+  8012f6:	83 ec 04             	sub    $0x4,%esp
+  8012f9:	53                   	push   %ebx
+  8012fa:	50                   	push   %eax
+  8012fb:	68 0d 2b 80 00       	push   $0x802b0d
+  801300:	e8 66 ef ff ff       	call   80026b <cprintf>
+		return -E_INVAL;
+  801305:	83 c4 10             	add    $0x10,%esp
+  801308:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80130d:	eb d8                	jmp    8012e7 <write+0x53>
+		return -E_NOT_SUPP;
+  80130f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801314:	eb d1                	jmp    8012e7 <write+0x53>
+
+00801316 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801316:	55                   	push   %ebp
+  801317:	89 e5                	mov    %esp,%ebp
+  801319:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80131c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80131f:	50                   	push   %eax
+  801320:	ff 75 08             	push   0x8(%ebp)
+  801323:	e8 38 fc ff ff       	call   800f60 <fd_lookup>
+  801328:	83 c4 10             	add    $0x10,%esp
+  80132b:	85 c0                	test   %eax,%eax
+  80132d:	78 0e                	js     80133d <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80132f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801332:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801335:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801338:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80133d:	c9                   	leave
+  80133e:	c3                   	ret
+
+0080133f <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80133f:	55                   	push   %ebp
+  801340:	89 e5                	mov    %esp,%ebp
+  801342:	56                   	push   %esi
+  801343:	53                   	push   %ebx
+  801344:	83 ec 18             	sub    $0x18,%esp
+  801347:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80134a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80134d:	50                   	push   %eax
+  80134e:	53                   	push   %ebx
+  80134f:	e8 0c fc ff ff       	call   800f60 <fd_lookup>
+  801354:	83 c4 10             	add    $0x10,%esp
+  801357:	85 c0                	test   %eax,%eax
+  801359:	78 34                	js     80138f <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80135b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80135e:	83 ec 08             	sub    $0x8,%esp
+  801361:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801364:	50                   	push   %eax
+  801365:	ff 36                	push   (%esi)
+  801367:	e8 44 fc ff ff       	call   800fb0 <dev_lookup>
+  80136c:	83 c4 10             	add    $0x10,%esp
+  80136f:	85 c0                	test   %eax,%eax
+  801371:	78 1c                	js     80138f <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801373:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801377:	74 1d                	je     801396 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801379:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80137c:	8b 40 18             	mov    0x18(%eax),%eax
+  80137f:	85 c0                	test   %eax,%eax
+  801381:	74 34                	je     8013b7 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801383:	83 ec 08             	sub    $0x8,%esp
+  801386:	ff 75 0c             	push   0xc(%ebp)
+  801389:	56                   	push   %esi
+  80138a:	ff d0                	call   *%eax
+  80138c:	83 c4 10             	add    $0x10,%esp
+}
+  80138f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801392:	5b                   	pop    %ebx
+  801393:	5e                   	pop    %esi
+  801394:	5d                   	pop    %ebp
+  801395:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801396:	a1 20 60 80 00       	mov    0x806020,%eax
+  80139b:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80139e:	83 ec 04             	sub    $0x4,%esp
+  8013a1:	53                   	push   %ebx
+  8013a2:	50                   	push   %eax
+  8013a3:	68 d0 2a 80 00       	push   $0x802ad0
+  8013a8:	e8 be ee ff ff       	call   80026b <cprintf>
+		return -E_INVAL;
+  8013ad:	83 c4 10             	add    $0x10,%esp
+  8013b0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013b5:	eb d8                	jmp    80138f <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8013b7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8013bc:	eb d1                	jmp    80138f <ftruncate+0x50>
+
+008013be <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8013be:	55                   	push   %ebp
+  8013bf:	89 e5                	mov    %esp,%ebp
+  8013c1:	56                   	push   %esi
+  8013c2:	53                   	push   %ebx
+  8013c3:	83 ec 18             	sub    $0x18,%esp
+  8013c6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8013c9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8013cc:	50                   	push   %eax
+  8013cd:	ff 75 08             	push   0x8(%ebp)
+  8013d0:	e8 8b fb ff ff       	call   800f60 <fd_lookup>
+  8013d5:	83 c4 10             	add    $0x10,%esp
+  8013d8:	85 c0                	test   %eax,%eax
+  8013da:	78 49                	js     801425 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8013dc:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8013df:	83 ec 08             	sub    $0x8,%esp
+  8013e2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013e5:	50                   	push   %eax
+  8013e6:	ff 36                	push   (%esi)
+  8013e8:	e8 c3 fb ff ff       	call   800fb0 <dev_lookup>
+  8013ed:	83 c4 10             	add    $0x10,%esp
+  8013f0:	85 c0                	test   %eax,%eax
+  8013f2:	78 31                	js     801425 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8013f4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013f7:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8013fb:	74 2f                	je     80142c <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8013fd:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801400:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801407:	00 00 00 
+	stat->st_isdir = 0;
+  80140a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801411:	00 00 00 
+	stat->st_dev = dev;
+  801414:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80141a:	83 ec 08             	sub    $0x8,%esp
+  80141d:	53                   	push   %ebx
+  80141e:	56                   	push   %esi
+  80141f:	ff 50 14             	call   *0x14(%eax)
+  801422:	83 c4 10             	add    $0x10,%esp
+}
+  801425:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801428:	5b                   	pop    %ebx
+  801429:	5e                   	pop    %esi
+  80142a:	5d                   	pop    %ebp
+  80142b:	c3                   	ret
+		return -E_NOT_SUPP;
+  80142c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801431:	eb f2                	jmp    801425 <fstat+0x67>
+
+00801433 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801433:	55                   	push   %ebp
+  801434:	89 e5                	mov    %esp,%ebp
+  801436:	56                   	push   %esi
+  801437:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801438:	83 ec 08             	sub    $0x8,%esp
+  80143b:	6a 00                	push   $0x0
+  80143d:	ff 75 08             	push   0x8(%ebp)
+  801440:	e8 e4 01 00 00       	call   801629 <open>
+  801445:	89 c3                	mov    %eax,%ebx
+  801447:	83 c4 10             	add    $0x10,%esp
+  80144a:	85 c0                	test   %eax,%eax
+  80144c:	78 1b                	js     801469 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80144e:	83 ec 08             	sub    $0x8,%esp
+  801451:	ff 75 0c             	push   0xc(%ebp)
+  801454:	50                   	push   %eax
+  801455:	e8 64 ff ff ff       	call   8013be <fstat>
+  80145a:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80145c:	89 1c 24             	mov    %ebx,(%esp)
+  80145f:	e8 26 fc ff ff       	call   80108a <close>
+	return r;
+  801464:	83 c4 10             	add    $0x10,%esp
+  801467:	89 f3                	mov    %esi,%ebx
+}
+  801469:	89 d8                	mov    %ebx,%eax
+  80146b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80146e:	5b                   	pop    %ebx
+  80146f:	5e                   	pop    %esi
+  801470:	5d                   	pop    %ebp
+  801471:	c3                   	ret
+
+00801472 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  801472:	55                   	push   %ebp
+  801473:	89 e5                	mov    %esp,%ebp
+  801475:	56                   	push   %esi
+  801476:	53                   	push   %ebx
+  801477:	89 c6                	mov    %eax,%esi
+  801479:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  80147b:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  801482:	74 27                	je     8014ab <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801484:	6a 07                	push   $0x7
+  801486:	68 00 70 80 00       	push   $0x807000
+  80148b:	56                   	push   %esi
+  80148c:	ff 35 00 40 80 00    	push   0x804000
+  801492:	e8 e5 0c 00 00       	call   80217c <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  801497:	83 c4 0c             	add    $0xc,%esp
+  80149a:	6a 00                	push   $0x0
+  80149c:	53                   	push   %ebx
+  80149d:	6a 00                	push   $0x0
+  80149f:	e8 64 0c 00 00       	call   802108 <ipc_recv>
+}
+  8014a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014a7:	5b                   	pop    %ebx
+  8014a8:	5e                   	pop    %esi
+  8014a9:	5d                   	pop    %ebp
+  8014aa:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  8014ab:	83 ec 0c             	sub    $0xc,%esp
+  8014ae:	6a 01                	push   $0x1
+  8014b0:	e8 1b 0d 00 00       	call   8021d0 <ipc_find_env>
+  8014b5:	a3 00 40 80 00       	mov    %eax,0x804000
+  8014ba:	83 c4 10             	add    $0x10,%esp
+  8014bd:	eb c5                	jmp    801484 <fsipc+0x12>
+
+008014bf <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8014bf:	55                   	push   %ebp
+  8014c0:	89 e5                	mov    %esp,%ebp
+  8014c2:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8014c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014c8:	8b 40 0c             	mov    0xc(%eax),%eax
+  8014cb:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.set_size.req_size = newsize;
+  8014d0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8014d3:	a3 04 70 80 00       	mov    %eax,0x807004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  8014d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014dd:	b8 02 00 00 00       	mov    $0x2,%eax
+  8014e2:	e8 8b ff ff ff       	call   801472 <fsipc>
+}
+  8014e7:	c9                   	leave
+  8014e8:	c3                   	ret
+
+008014e9 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8014e9:	55                   	push   %ebp
+  8014ea:	89 e5                	mov    %esp,%ebp
+  8014ec:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8014ef:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014f2:	8b 40 0c             	mov    0xc(%eax),%eax
+  8014f5:	a3 00 70 80 00       	mov    %eax,0x807000
+  return fsipc(FSREQ_FLUSH, NULL);
+  8014fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014ff:	b8 06 00 00 00       	mov    $0x6,%eax
+  801504:	e8 69 ff ff ff       	call   801472 <fsipc>
+}
+  801509:	c9                   	leave
+  80150a:	c3                   	ret
+
+0080150b <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80150b:	55                   	push   %ebp
+  80150c:	89 e5                	mov    %esp,%ebp
+  80150e:	53                   	push   %ebx
+  80150f:	83 ec 04             	sub    $0x4,%esp
+  801512:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801515:	8b 45 08             	mov    0x8(%ebp),%eax
+  801518:	8b 40 0c             	mov    0xc(%eax),%eax
+  80151b:	a3 00 70 80 00       	mov    %eax,0x807000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801520:	ba 00 00 00 00       	mov    $0x0,%edx
+  801525:	b8 05 00 00 00       	mov    $0x5,%eax
+  80152a:	e8 43 ff ff ff       	call   801472 <fsipc>
+  80152f:	85 c0                	test   %eax,%eax
+  801531:	78 2c                	js     80155f <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801533:	83 ec 08             	sub    $0x8,%esp
+  801536:	68 00 70 80 00       	push   $0x807000
+  80153b:	53                   	push   %ebx
+  80153c:	e8 e3 f2 ff ff       	call   800824 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801541:	a1 80 70 80 00       	mov    0x807080,%eax
+  801546:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80154c:	a1 84 70 80 00       	mov    0x807084,%eax
+  801551:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801557:	83 c4 10             	add    $0x10,%esp
+  80155a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80155f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801562:	c9                   	leave
+  801563:	c3                   	ret
+
+00801564 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801564:	55                   	push   %ebp
+  801565:	89 e5                	mov    %esp,%ebp
+  801567:	83 ec 0c             	sub    $0xc,%esp
+  80156a:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80156d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801570:	8b 52 0c             	mov    0xc(%edx),%edx
+  801573:	89 15 00 70 80 00    	mov    %edx,0x807000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801579:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  80157e:	39 d0                	cmp    %edx,%eax
+  801580:	0f 47 c2             	cmova  %edx,%eax
+  801583:	a3 04 70 80 00       	mov    %eax,0x807004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  801588:	50                   	push   %eax
+  801589:	ff 75 0c             	push   0xc(%ebp)
+  80158c:	68 08 70 80 00       	push   $0x807008
+  801591:	e8 14 f4 ff ff       	call   8009aa <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801596:	ba 00 00 00 00       	mov    $0x0,%edx
+  80159b:	b8 04 00 00 00       	mov    $0x4,%eax
+  8015a0:	e8 cd fe ff ff       	call   801472 <fsipc>
+}
+  8015a5:	c9                   	leave
+  8015a6:	c3                   	ret
+
+008015a7 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8015a7:	55                   	push   %ebp
+  8015a8:	89 e5                	mov    %esp,%ebp
+  8015aa:	56                   	push   %esi
+  8015ab:	53                   	push   %ebx
+  8015ac:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8015af:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015b2:	8b 40 0c             	mov    0xc(%eax),%eax
+  8015b5:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.read.req_n = n;
+  8015ba:	89 35 04 70 80 00    	mov    %esi,0x807004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8015c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015c5:	b8 03 00 00 00       	mov    $0x3,%eax
+  8015ca:	e8 a3 fe ff ff       	call   801472 <fsipc>
+  8015cf:	89 c3                	mov    %eax,%ebx
+  8015d1:	85 c0                	test   %eax,%eax
+  8015d3:	78 1f                	js     8015f4 <devfile_read+0x4d>
+  assert(r <= n);
+  8015d5:	39 c6                	cmp    %eax,%esi
+  8015d7:	72 24                	jb     8015fd <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  8015d9:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8015de:	7f 33                	jg     801613 <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8015e0:	83 ec 04             	sub    $0x4,%esp
+  8015e3:	50                   	push   %eax
+  8015e4:	68 00 70 80 00       	push   $0x807000
+  8015e9:	ff 75 0c             	push   0xc(%ebp)
+  8015ec:	e8 b9 f3 ff ff       	call   8009aa <memmove>
+  return r;
+  8015f1:	83 c4 10             	add    $0x10,%esp
+}
+  8015f4:	89 d8                	mov    %ebx,%eax
+  8015f6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015f9:	5b                   	pop    %ebx
+  8015fa:	5e                   	pop    %esi
+  8015fb:	5d                   	pop    %ebp
+  8015fc:	c3                   	ret
+  assert(r <= n);
+  8015fd:	68 40 2b 80 00       	push   $0x802b40
+  801602:	68 47 2b 80 00       	push   $0x802b47
+  801607:	6a 78                	push   $0x78
+  801609:	68 5c 2b 80 00       	push   $0x802b5c
+  80160e:	e8 7d eb ff ff       	call   800190 <_panic>
+  assert(r <= PGSIZE);
+  801613:	68 67 2b 80 00       	push   $0x802b67
+  801618:	68 47 2b 80 00       	push   $0x802b47
+  80161d:	6a 79                	push   $0x79
+  80161f:	68 5c 2b 80 00       	push   $0x802b5c
+  801624:	e8 67 eb ff ff       	call   800190 <_panic>
+
+00801629 <open>:
+open(const char *path, int mode) {
+  801629:	55                   	push   %ebp
+  80162a:	89 e5                	mov    %esp,%ebp
+  80162c:	56                   	push   %esi
+  80162d:	53                   	push   %ebx
+  80162e:	83 ec 1c             	sub    $0x1c,%esp
+  801631:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801634:	56                   	push   %esi
+  801635:	e8 af f1 ff ff       	call   8007e9 <strlen>
+  80163a:	83 c4 10             	add    $0x10,%esp
+  80163d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801642:	7f 6c                	jg     8016b0 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801644:	83 ec 0c             	sub    $0xc,%esp
+  801647:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80164a:	50                   	push   %eax
+  80164b:	e8 ba f8 ff ff       	call   800f0a <fd_alloc>
+  801650:	89 c3                	mov    %eax,%ebx
+  801652:	83 c4 10             	add    $0x10,%esp
+  801655:	85 c0                	test   %eax,%eax
+  801657:	78 3c                	js     801695 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801659:	83 ec 08             	sub    $0x8,%esp
+  80165c:	56                   	push   %esi
+  80165d:	68 00 70 80 00       	push   $0x807000
+  801662:	e8 bd f1 ff ff       	call   800824 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801667:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80166a:	a3 00 74 80 00       	mov    %eax,0x807400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80166f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801672:	b8 01 00 00 00       	mov    $0x1,%eax
+  801677:	e8 f6 fd ff ff       	call   801472 <fsipc>
+  80167c:	89 c3                	mov    %eax,%ebx
+  80167e:	83 c4 10             	add    $0x10,%esp
+  801681:	85 c0                	test   %eax,%eax
+  801683:	78 19                	js     80169e <open+0x75>
+  return fd2num(fd);
+  801685:	83 ec 0c             	sub    $0xc,%esp
+  801688:	ff 75 f4             	push   -0xc(%ebp)
+  80168b:	e8 53 f8 ff ff       	call   800ee3 <fd2num>
+  801690:	89 c3                	mov    %eax,%ebx
+  801692:	83 c4 10             	add    $0x10,%esp
+}
+  801695:	89 d8                	mov    %ebx,%eax
+  801697:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80169a:	5b                   	pop    %ebx
+  80169b:	5e                   	pop    %esi
+  80169c:	5d                   	pop    %ebp
+  80169d:	c3                   	ret
+    fd_close(fd, 0);
+  80169e:	83 ec 08             	sub    $0x8,%esp
+  8016a1:	6a 00                	push   $0x0
+  8016a3:	ff 75 f4             	push   -0xc(%ebp)
+  8016a6:	e8 58 f9 ff ff       	call   801003 <fd_close>
+    return r;
+  8016ab:	83 c4 10             	add    $0x10,%esp
+  8016ae:	eb e5                	jmp    801695 <open+0x6c>
+    return -E_BAD_PATH;
+  8016b0:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8016b5:	eb de                	jmp    801695 <open+0x6c>
+
+008016b7 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  8016b7:	55                   	push   %ebp
+  8016b8:	89 e5                	mov    %esp,%ebp
+  8016ba:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  8016bd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016c2:	b8 08 00 00 00       	mov    $0x8,%eax
+  8016c7:	e8 a6 fd ff ff       	call   801472 <fsipc>
+}
+  8016cc:	c9                   	leave
+  8016cd:	c3                   	ret
+
+008016ce <writebuf>:
+
+
+static void
+writebuf(struct printbuf *b)
+{
+	if (b->error > 0) {
+  8016ce:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8016d2:	7f 01                	jg     8016d5 <writebuf+0x7>
+  8016d4:	c3                   	ret
+{
+  8016d5:	55                   	push   %ebp
+  8016d6:	89 e5                	mov    %esp,%ebp
+  8016d8:	53                   	push   %ebx
+  8016d9:	83 ec 08             	sub    $0x8,%esp
+  8016dc:	89 c3                	mov    %eax,%ebx
+		ssize_t result = write(b->fd, b->buf, b->idx);
+  8016de:	ff 70 04             	push   0x4(%eax)
+  8016e1:	8d 40 10             	lea    0x10(%eax),%eax
+  8016e4:	50                   	push   %eax
+  8016e5:	ff 33                	push   (%ebx)
+  8016e7:	e8 a8 fb ff ff       	call   801294 <write>
+		if (result > 0)
+  8016ec:	83 c4 10             	add    $0x10,%esp
+  8016ef:	85 c0                	test   %eax,%eax
+  8016f1:	7e 03                	jle    8016f6 <writebuf+0x28>
+			b->result += result;
+  8016f3:	01 43 08             	add    %eax,0x8(%ebx)
+		if (result != b->idx) // error, or wrote less than supplied
+  8016f6:	39 43 04             	cmp    %eax,0x4(%ebx)
+  8016f9:	74 0d                	je     801708 <writebuf+0x3a>
+			b->error = (result < 0 ? result : 0);
+  8016fb:	85 c0                	test   %eax,%eax
+  8016fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801702:	0f 4f c2             	cmovg  %edx,%eax
+  801705:	89 43 0c             	mov    %eax,0xc(%ebx)
+	}
+}
+  801708:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80170b:	c9                   	leave
+  80170c:	c3                   	ret
+
+0080170d <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  80170d:	55                   	push   %ebp
+  80170e:	89 e5                	mov    %esp,%ebp
+  801710:	53                   	push   %ebx
+  801711:	83 ec 04             	sub    $0x4,%esp
+  801714:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct printbuf *b = (struct printbuf *) thunk;
+	b->buf[b->idx++] = ch;
+  801717:	8b 53 04             	mov    0x4(%ebx),%edx
+  80171a:	8d 42 01             	lea    0x1(%edx),%eax
+  80171d:	89 43 04             	mov    %eax,0x4(%ebx)
+  801720:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801723:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+	if (b->idx == 256) {
+  801727:	3d 00 01 00 00       	cmp    $0x100,%eax
+  80172c:	74 05                	je     801733 <putch+0x26>
+		writebuf(b);
+		b->idx = 0;
+	}
+}
+  80172e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801731:	c9                   	leave
+  801732:	c3                   	ret
+		writebuf(b);
+  801733:	89 d8                	mov    %ebx,%eax
+  801735:	e8 94 ff ff ff       	call   8016ce <writebuf>
+		b->idx = 0;
+  80173a:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+  801741:	eb eb                	jmp    80172e <putch+0x21>
+
+00801743 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  801743:	55                   	push   %ebp
+  801744:	89 e5                	mov    %esp,%ebp
+  801746:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.fd = fd;
+  80174c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80174f:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+	b.idx = 0;
+  801755:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  80175c:	00 00 00 
+	b.result = 0;
+  80175f:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  801766:	00 00 00 
+	b.error = 1;
+  801769:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  801770:	00 00 00 
+	vprintfmt(putch, &b, fmt, ap);
+  801773:	ff 75 10             	push   0x10(%ebp)
+  801776:	ff 75 0c             	push   0xc(%ebp)
+  801779:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  80177f:	50                   	push   %eax
+  801780:	68 0d 17 80 00       	push   $0x80170d
+  801785:	e8 d8 eb ff ff       	call   800362 <vprintfmt>
+	if (b.idx > 0)
+  80178a:	83 c4 10             	add    $0x10,%esp
+  80178d:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  801794:	7f 12                	jg     8017a8 <vfprintf+0x65>
+		writebuf(&b);
+
+	return (b.result ? b.result : b.error);
+  801796:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  80179c:	85 c0                	test   %eax,%eax
+  80179e:	75 06                	jne    8017a6 <vfprintf+0x63>
+  8017a0:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  8017a6:	c9                   	leave
+  8017a7:	c3                   	ret
+		writebuf(&b);
+  8017a8:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  8017ae:	e8 1b ff ff ff       	call   8016ce <writebuf>
+  8017b3:	eb e1                	jmp    801796 <vfprintf+0x53>
+
+008017b5 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  8017b5:	55                   	push   %ebp
+  8017b6:	89 e5                	mov    %esp,%ebp
+  8017b8:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8017bb:	8d 45 10             	lea    0x10(%ebp),%eax
+	cnt = vfprintf(fd, fmt, ap);
+  8017be:	50                   	push   %eax
+  8017bf:	ff 75 0c             	push   0xc(%ebp)
+  8017c2:	ff 75 08             	push   0x8(%ebp)
+  8017c5:	e8 79 ff ff ff       	call   801743 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8017ca:	c9                   	leave
+  8017cb:	c3                   	ret
+
+008017cc <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  8017cc:	55                   	push   %ebp
+  8017cd:	89 e5                	mov    %esp,%ebp
+  8017cf:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8017d2:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vfprintf(1, fmt, ap);
+  8017d5:	50                   	push   %eax
+  8017d6:	ff 75 08             	push   0x8(%ebp)
+  8017d9:	6a 01                	push   $0x1
+  8017db:	e8 63 ff ff ff       	call   801743 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8017e0:	c9                   	leave
+  8017e1:	c3                   	ret
+
+008017e2 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8017e2:	55                   	push   %ebp
+  8017e3:	89 e5                	mov    %esp,%ebp
+  8017e5:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8017e8:	68 73 2b 80 00       	push   $0x802b73
+  8017ed:	ff 75 0c             	push   0xc(%ebp)
+  8017f0:	e8 2f f0 ff ff       	call   800824 <strcpy>
+	return 0;
+}
+  8017f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017fa:	c9                   	leave
+  8017fb:	c3                   	ret
+
+008017fc <devsock_close>:
+{
+  8017fc:	55                   	push   %ebp
+  8017fd:	89 e5                	mov    %esp,%ebp
+  8017ff:	53                   	push   %ebx
+  801800:	83 ec 10             	sub    $0x10,%esp
+  801803:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801806:	53                   	push   %ebx
+  801807:	e8 03 0a 00 00       	call   80220f <pageref>
+  80180c:	89 c2                	mov    %eax,%edx
+  80180e:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801811:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801816:	83 fa 01             	cmp    $0x1,%edx
+  801819:	74 05                	je     801820 <devsock_close+0x24>
+}
+  80181b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80181e:	c9                   	leave
+  80181f:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801820:	83 ec 0c             	sub    $0xc,%esp
+  801823:	ff 73 0c             	push   0xc(%ebx)
+  801826:	e8 b7 02 00 00       	call   801ae2 <nsipc_close>
+  80182b:	83 c4 10             	add    $0x10,%esp
+  80182e:	eb eb                	jmp    80181b <devsock_close+0x1f>
+
+00801830 <devsock_write>:
+{
+  801830:	55                   	push   %ebp
+  801831:	89 e5                	mov    %esp,%ebp
+  801833:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801836:	6a 00                	push   $0x0
+  801838:	ff 75 10             	push   0x10(%ebp)
+  80183b:	ff 75 0c             	push   0xc(%ebp)
+  80183e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801841:	ff 70 0c             	push   0xc(%eax)
+  801844:	e8 79 03 00 00       	call   801bc2 <nsipc_send>
+}
+  801849:	c9                   	leave
+  80184a:	c3                   	ret
+
+0080184b <devsock_read>:
+{
+  80184b:	55                   	push   %ebp
+  80184c:	89 e5                	mov    %esp,%ebp
+  80184e:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801851:	6a 00                	push   $0x0
+  801853:	ff 75 10             	push   0x10(%ebp)
+  801856:	ff 75 0c             	push   0xc(%ebp)
+  801859:	8b 45 08             	mov    0x8(%ebp),%eax
+  80185c:	ff 70 0c             	push   0xc(%eax)
+  80185f:	e8 ef 02 00 00       	call   801b53 <nsipc_recv>
+}
+  801864:	c9                   	leave
+  801865:	c3                   	ret
+
+00801866 <fd2sockid>:
+{
+  801866:	55                   	push   %ebp
+  801867:	89 e5                	mov    %esp,%ebp
+  801869:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  80186c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80186f:	52                   	push   %edx
+  801870:	50                   	push   %eax
+  801871:	e8 ea f6 ff ff       	call   800f60 <fd_lookup>
+  801876:	83 c4 10             	add    $0x10,%esp
+  801879:	85 c0                	test   %eax,%eax
+  80187b:	78 10                	js     80188d <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  80187d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801880:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  801886:	39 08                	cmp    %ecx,(%eax)
+  801888:	75 05                	jne    80188f <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  80188a:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  80188d:	c9                   	leave
+  80188e:	c3                   	ret
+		return -E_NOT_SUPP;
+  80188f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801894:	eb f7                	jmp    80188d <fd2sockid+0x27>
+
+00801896 <alloc_sockfd>:
+{
+  801896:	55                   	push   %ebp
+  801897:	89 e5                	mov    %esp,%ebp
+  801899:	56                   	push   %esi
+  80189a:	53                   	push   %ebx
+  80189b:	83 ec 1c             	sub    $0x1c,%esp
+  80189e:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8018a0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018a3:	50                   	push   %eax
+  8018a4:	e8 61 f6 ff ff       	call   800f0a <fd_alloc>
+  8018a9:	89 c3                	mov    %eax,%ebx
+  8018ab:	83 c4 10             	add    $0x10,%esp
+  8018ae:	85 c0                	test   %eax,%eax
+  8018b0:	78 43                	js     8018f5 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8018b2:	83 ec 04             	sub    $0x4,%esp
+  8018b5:	68 07 04 00 00       	push   $0x407
+  8018ba:	ff 75 f4             	push   -0xc(%ebp)
+  8018bd:	6a 00                	push   $0x0
+  8018bf:	e8 4c f3 ff ff       	call   800c10 <sys_page_alloc>
+  8018c4:	89 c3                	mov    %eax,%ebx
+  8018c6:	83 c4 10             	add    $0x10,%esp
+  8018c9:	85 c0                	test   %eax,%eax
+  8018cb:	78 28                	js     8018f5 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8018cd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018d0:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  8018d6:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8018d8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018db:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8018e2:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8018e5:	83 ec 0c             	sub    $0xc,%esp
+  8018e8:	50                   	push   %eax
+  8018e9:	e8 f5 f5 ff ff       	call   800ee3 <fd2num>
+  8018ee:	89 c3                	mov    %eax,%ebx
+  8018f0:	83 c4 10             	add    $0x10,%esp
+  8018f3:	eb 0c                	jmp    801901 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8018f5:	83 ec 0c             	sub    $0xc,%esp
+  8018f8:	56                   	push   %esi
+  8018f9:	e8 e4 01 00 00       	call   801ae2 <nsipc_close>
+		return r;
+  8018fe:	83 c4 10             	add    $0x10,%esp
+}
+  801901:	89 d8                	mov    %ebx,%eax
+  801903:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801906:	5b                   	pop    %ebx
+  801907:	5e                   	pop    %esi
+  801908:	5d                   	pop    %ebp
+  801909:	c3                   	ret
+
+0080190a <accept>:
+{
+  80190a:	55                   	push   %ebp
+  80190b:	89 e5                	mov    %esp,%ebp
+  80190d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801910:	8b 45 08             	mov    0x8(%ebp),%eax
+  801913:	e8 4e ff ff ff       	call   801866 <fd2sockid>
+  801918:	85 c0                	test   %eax,%eax
+  80191a:	78 1b                	js     801937 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  80191c:	83 ec 04             	sub    $0x4,%esp
+  80191f:	ff 75 10             	push   0x10(%ebp)
+  801922:	ff 75 0c             	push   0xc(%ebp)
+  801925:	50                   	push   %eax
+  801926:	e8 0e 01 00 00       	call   801a39 <nsipc_accept>
+  80192b:	83 c4 10             	add    $0x10,%esp
+  80192e:	85 c0                	test   %eax,%eax
+  801930:	78 05                	js     801937 <accept+0x2d>
+	return alloc_sockfd(r);
+  801932:	e8 5f ff ff ff       	call   801896 <alloc_sockfd>
+}
+  801937:	c9                   	leave
+  801938:	c3                   	ret
+
+00801939 <bind>:
+{
+  801939:	55                   	push   %ebp
+  80193a:	89 e5                	mov    %esp,%ebp
+  80193c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80193f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801942:	e8 1f ff ff ff       	call   801866 <fd2sockid>
+  801947:	85 c0                	test   %eax,%eax
+  801949:	78 12                	js     80195d <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  80194b:	83 ec 04             	sub    $0x4,%esp
+  80194e:	ff 75 10             	push   0x10(%ebp)
+  801951:	ff 75 0c             	push   0xc(%ebp)
+  801954:	50                   	push   %eax
+  801955:	e8 31 01 00 00       	call   801a8b <nsipc_bind>
+  80195a:	83 c4 10             	add    $0x10,%esp
+}
+  80195d:	c9                   	leave
+  80195e:	c3                   	ret
+
+0080195f <shutdown>:
+{
+  80195f:	55                   	push   %ebp
+  801960:	89 e5                	mov    %esp,%ebp
+  801962:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801965:	8b 45 08             	mov    0x8(%ebp),%eax
+  801968:	e8 f9 fe ff ff       	call   801866 <fd2sockid>
+  80196d:	85 c0                	test   %eax,%eax
+  80196f:	78 0f                	js     801980 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801971:	83 ec 08             	sub    $0x8,%esp
+  801974:	ff 75 0c             	push   0xc(%ebp)
+  801977:	50                   	push   %eax
+  801978:	e8 43 01 00 00       	call   801ac0 <nsipc_shutdown>
+  80197d:	83 c4 10             	add    $0x10,%esp
+}
+  801980:	c9                   	leave
+  801981:	c3                   	ret
+
+00801982 <connect>:
+{
+  801982:	55                   	push   %ebp
+  801983:	89 e5                	mov    %esp,%ebp
+  801985:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801988:	8b 45 08             	mov    0x8(%ebp),%eax
+  80198b:	e8 d6 fe ff ff       	call   801866 <fd2sockid>
+  801990:	85 c0                	test   %eax,%eax
+  801992:	78 12                	js     8019a6 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801994:	83 ec 04             	sub    $0x4,%esp
+  801997:	ff 75 10             	push   0x10(%ebp)
+  80199a:	ff 75 0c             	push   0xc(%ebp)
+  80199d:	50                   	push   %eax
+  80199e:	e8 59 01 00 00       	call   801afc <nsipc_connect>
+  8019a3:	83 c4 10             	add    $0x10,%esp
+}
+  8019a6:	c9                   	leave
+  8019a7:	c3                   	ret
+
+008019a8 <listen>:
+{
+  8019a8:	55                   	push   %ebp
+  8019a9:	89 e5                	mov    %esp,%ebp
+  8019ab:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8019ae:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019b1:	e8 b0 fe ff ff       	call   801866 <fd2sockid>
+  8019b6:	85 c0                	test   %eax,%eax
+  8019b8:	78 0f                	js     8019c9 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8019ba:	83 ec 08             	sub    $0x8,%esp
+  8019bd:	ff 75 0c             	push   0xc(%ebp)
+  8019c0:	50                   	push   %eax
+  8019c1:	e8 6b 01 00 00       	call   801b31 <nsipc_listen>
+  8019c6:	83 c4 10             	add    $0x10,%esp
+}
+  8019c9:	c9                   	leave
+  8019ca:	c3                   	ret
+
+008019cb <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8019cb:	55                   	push   %ebp
+  8019cc:	89 e5                	mov    %esp,%ebp
+  8019ce:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8019d1:	ff 75 10             	push   0x10(%ebp)
+  8019d4:	ff 75 0c             	push   0xc(%ebp)
+  8019d7:	ff 75 08             	push   0x8(%ebp)
+  8019da:	e8 41 02 00 00       	call   801c20 <nsipc_socket>
+  8019df:	83 c4 10             	add    $0x10,%esp
+  8019e2:	85 c0                	test   %eax,%eax
+  8019e4:	78 05                	js     8019eb <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8019e6:	e8 ab fe ff ff       	call   801896 <alloc_sockfd>
+}
+  8019eb:	c9                   	leave
+  8019ec:	c3                   	ret
+
+008019ed <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8019ed:	55                   	push   %ebp
+  8019ee:	89 e5                	mov    %esp,%ebp
+  8019f0:	53                   	push   %ebx
+  8019f1:	83 ec 04             	sub    $0x4,%esp
+  8019f4:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  8019f6:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8019fd:	74 26                	je     801a25 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8019ff:	6a 07                	push   $0x7
+  801a01:	68 00 80 80 00       	push   $0x808000
+  801a06:	53                   	push   %ebx
+  801a07:	ff 35 04 40 80 00    	push   0x804004
+  801a0d:	e8 6a 07 00 00       	call   80217c <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801a12:	83 c4 0c             	add    $0xc,%esp
+  801a15:	6a 00                	push   $0x0
+  801a17:	6a 00                	push   $0x0
+  801a19:	6a 00                	push   $0x0
+  801a1b:	e8 e8 06 00 00       	call   802108 <ipc_recv>
+}
+  801a20:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a23:	c9                   	leave
+  801a24:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801a25:	83 ec 0c             	sub    $0xc,%esp
+  801a28:	6a 02                	push   $0x2
+  801a2a:	e8 a1 07 00 00       	call   8021d0 <ipc_find_env>
+  801a2f:	a3 04 40 80 00       	mov    %eax,0x804004
+  801a34:	83 c4 10             	add    $0x10,%esp
+  801a37:	eb c6                	jmp    8019ff <nsipc+0x12>
+
+00801a39 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801a39:	55                   	push   %ebp
+  801a3a:	89 e5                	mov    %esp,%ebp
+  801a3c:	56                   	push   %esi
+  801a3d:	53                   	push   %ebx
+  801a3e:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801a41:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a44:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801a49:	8b 06                	mov    (%esi),%eax
+  801a4b:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801a50:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a55:	e8 93 ff ff ff       	call   8019ed <nsipc>
+  801a5a:	89 c3                	mov    %eax,%ebx
+  801a5c:	85 c0                	test   %eax,%eax
+  801a5e:	79 09                	jns    801a69 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801a60:	89 d8                	mov    %ebx,%eax
+  801a62:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a65:	5b                   	pop    %ebx
+  801a66:	5e                   	pop    %esi
+  801a67:	5d                   	pop    %ebp
+  801a68:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801a69:	83 ec 04             	sub    $0x4,%esp
+  801a6c:	ff 35 10 80 80 00    	push   0x808010
+  801a72:	68 00 80 80 00       	push   $0x808000
+  801a77:	ff 75 0c             	push   0xc(%ebp)
+  801a7a:	e8 2b ef ff ff       	call   8009aa <memmove>
+		*addrlen = ret->ret_addrlen;
+  801a7f:	a1 10 80 80 00       	mov    0x808010,%eax
+  801a84:	89 06                	mov    %eax,(%esi)
+  801a86:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801a89:	eb d5                	jmp    801a60 <nsipc_accept+0x27>
+
+00801a8b <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801a8b:	55                   	push   %ebp
+  801a8c:	89 e5                	mov    %esp,%ebp
+  801a8e:	53                   	push   %ebx
+  801a8f:	83 ec 08             	sub    $0x8,%esp
+  801a92:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801a95:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a98:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801a9d:	53                   	push   %ebx
+  801a9e:	ff 75 0c             	push   0xc(%ebp)
+  801aa1:	68 04 80 80 00       	push   $0x808004
+  801aa6:	e8 ff ee ff ff       	call   8009aa <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801aab:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  801ab1:	b8 02 00 00 00       	mov    $0x2,%eax
+  801ab6:	e8 32 ff ff ff       	call   8019ed <nsipc>
+}
+  801abb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801abe:	c9                   	leave
+  801abf:	c3                   	ret
+
+00801ac0 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801ac0:	55                   	push   %ebp
+  801ac1:	89 e5                	mov    %esp,%ebp
+  801ac3:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801ac6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ac9:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  801ace:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ad1:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  801ad6:	b8 03 00 00 00       	mov    $0x3,%eax
+  801adb:	e8 0d ff ff ff       	call   8019ed <nsipc>
+}
+  801ae0:	c9                   	leave
+  801ae1:	c3                   	ret
+
+00801ae2 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801ae2:	55                   	push   %ebp
+  801ae3:	89 e5                	mov    %esp,%ebp
+  801ae5:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801ae8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801aeb:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  801af0:	b8 04 00 00 00       	mov    $0x4,%eax
+  801af5:	e8 f3 fe ff ff       	call   8019ed <nsipc>
+}
+  801afa:	c9                   	leave
+  801afb:	c3                   	ret
+
+00801afc <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801afc:	55                   	push   %ebp
+  801afd:	89 e5                	mov    %esp,%ebp
+  801aff:	53                   	push   %ebx
+  801b00:	83 ec 08             	sub    $0x8,%esp
+  801b03:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801b06:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b09:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801b0e:	53                   	push   %ebx
+  801b0f:	ff 75 0c             	push   0xc(%ebp)
+  801b12:	68 04 80 80 00       	push   $0x808004
+  801b17:	e8 8e ee ff ff       	call   8009aa <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801b1c:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  801b22:	b8 05 00 00 00       	mov    $0x5,%eax
+  801b27:	e8 c1 fe ff ff       	call   8019ed <nsipc>
+}
+  801b2c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b2f:	c9                   	leave
+  801b30:	c3                   	ret
+
+00801b31 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801b31:	55                   	push   %ebp
+  801b32:	89 e5                	mov    %esp,%ebp
+  801b34:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801b37:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b3a:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  801b3f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b42:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  801b47:	b8 06 00 00 00       	mov    $0x6,%eax
+  801b4c:	e8 9c fe ff ff       	call   8019ed <nsipc>
+}
+  801b51:	c9                   	leave
+  801b52:	c3                   	ret
+
+00801b53 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801b53:	55                   	push   %ebp
+  801b54:	89 e5                	mov    %esp,%ebp
+  801b56:	56                   	push   %esi
+  801b57:	53                   	push   %ebx
+  801b58:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801b5b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b5e:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  801b63:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  801b69:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b6c:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801b71:	b8 07 00 00 00       	mov    $0x7,%eax
+  801b76:	e8 72 fe ff ff       	call   8019ed <nsipc>
+  801b7b:	89 c3                	mov    %eax,%ebx
+  801b7d:	85 c0                	test   %eax,%eax
+  801b7f:	78 22                	js     801ba3 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801b81:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801b86:	39 c6                	cmp    %eax,%esi
+  801b88:	0f 4e c6             	cmovle %esi,%eax
+  801b8b:	39 c3                	cmp    %eax,%ebx
+  801b8d:	7f 1d                	jg     801bac <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801b8f:	83 ec 04             	sub    $0x4,%esp
+  801b92:	53                   	push   %ebx
+  801b93:	68 00 80 80 00       	push   $0x808000
+  801b98:	ff 75 0c             	push   0xc(%ebp)
+  801b9b:	e8 0a ee ff ff       	call   8009aa <memmove>
+  801ba0:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801ba3:	89 d8                	mov    %ebx,%eax
+  801ba5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ba8:	5b                   	pop    %ebx
+  801ba9:	5e                   	pop    %esi
+  801baa:	5d                   	pop    %ebp
+  801bab:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801bac:	68 7f 2b 80 00       	push   $0x802b7f
+  801bb1:	68 47 2b 80 00       	push   $0x802b47
+  801bb6:	6a 62                	push   $0x62
+  801bb8:	68 94 2b 80 00       	push   $0x802b94
+  801bbd:	e8 ce e5 ff ff       	call   800190 <_panic>
+
+00801bc2 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801bc2:	55                   	push   %ebp
+  801bc3:	89 e5                	mov    %esp,%ebp
+  801bc5:	53                   	push   %ebx
+  801bc6:	83 ec 04             	sub    $0x4,%esp
+  801bc9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801bcc:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bcf:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  801bd4:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801bda:	7f 2e                	jg     801c0a <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801bdc:	83 ec 04             	sub    $0x4,%esp
+  801bdf:	53                   	push   %ebx
+  801be0:	ff 75 0c             	push   0xc(%ebp)
+  801be3:	68 0c 80 80 00       	push   $0x80800c
+  801be8:	e8 bd ed ff ff       	call   8009aa <memmove>
+	nsipcbuf.send.req_size = size;
+  801bed:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  801bf3:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bf6:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  801bfb:	b8 08 00 00 00       	mov    $0x8,%eax
+  801c00:	e8 e8 fd ff ff       	call   8019ed <nsipc>
+}
+  801c05:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c08:	c9                   	leave
+  801c09:	c3                   	ret
+	assert(size < 1600);
+  801c0a:	68 a0 2b 80 00       	push   $0x802ba0
+  801c0f:	68 47 2b 80 00       	push   $0x802b47
+  801c14:	6a 6d                	push   $0x6d
+  801c16:	68 94 2b 80 00       	push   $0x802b94
+  801c1b:	e8 70 e5 ff ff       	call   800190 <_panic>
+
+00801c20 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801c20:	55                   	push   %ebp
+  801c21:	89 e5                	mov    %esp,%ebp
+  801c23:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801c26:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c29:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  801c2e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c31:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  801c36:	8b 45 10             	mov    0x10(%ebp),%eax
+  801c39:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  801c3e:	b8 09 00 00 00       	mov    $0x9,%eax
+  801c43:	e8 a5 fd ff ff       	call   8019ed <nsipc>
+}
+  801c48:	c9                   	leave
+  801c49:	c3                   	ret
+
+00801c4a <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801c4a:	55                   	push   %ebp
+  801c4b:	89 e5                	mov    %esp,%ebp
+  801c4d:	56                   	push   %esi
+  801c4e:	53                   	push   %ebx
+  801c4f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801c52:	83 ec 0c             	sub    $0xc,%esp
+  801c55:	ff 75 08             	push   0x8(%ebp)
+  801c58:	e8 96 f2 ff ff       	call   800ef3 <fd2data>
+  801c5d:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801c5f:	83 c4 08             	add    $0x8,%esp
+  801c62:	68 ac 2b 80 00       	push   $0x802bac
+  801c67:	53                   	push   %ebx
+  801c68:	e8 b7 eb ff ff       	call   800824 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801c6d:	8b 46 04             	mov    0x4(%esi),%eax
+  801c70:	2b 06                	sub    (%esi),%eax
+  801c72:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  801c78:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801c7f:	00 00 00 
+	stat->st_dev = &devpipe;
+  801c82:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  801c89:	30 80 00 
+	return 0;
+}
+  801c8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c91:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c94:	5b                   	pop    %ebx
+  801c95:	5e                   	pop    %esi
+  801c96:	5d                   	pop    %ebp
+  801c97:	c3                   	ret
+
+00801c98 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801c98:	55                   	push   %ebp
+  801c99:	89 e5                	mov    %esp,%ebp
+  801c9b:	53                   	push   %ebx
+  801c9c:	83 ec 0c             	sub    $0xc,%esp
+  801c9f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801ca2:	53                   	push   %ebx
+  801ca3:	6a 00                	push   $0x0
+  801ca5:	e8 eb ef ff ff       	call   800c95 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801caa:	89 1c 24             	mov    %ebx,(%esp)
+  801cad:	e8 41 f2 ff ff       	call   800ef3 <fd2data>
+  801cb2:	83 c4 08             	add    $0x8,%esp
+  801cb5:	50                   	push   %eax
+  801cb6:	6a 00                	push   $0x0
+  801cb8:	e8 d8 ef ff ff       	call   800c95 <sys_page_unmap>
+}
+  801cbd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cc0:	c9                   	leave
+  801cc1:	c3                   	ret
+
+00801cc2 <_pipeisclosed>:
+{
+  801cc2:	55                   	push   %ebp
+  801cc3:	89 e5                	mov    %esp,%ebp
+  801cc5:	57                   	push   %edi
+  801cc6:	56                   	push   %esi
+  801cc7:	53                   	push   %ebx
+  801cc8:	83 ec 1c             	sub    $0x1c,%esp
+  801ccb:	89 c7                	mov    %eax,%edi
+  801ccd:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801ccf:	a1 20 60 80 00       	mov    0x806020,%eax
+  801cd4:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801cd7:	83 ec 0c             	sub    $0xc,%esp
+  801cda:	57                   	push   %edi
+  801cdb:	e8 2f 05 00 00       	call   80220f <pageref>
+  801ce0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801ce3:	89 34 24             	mov    %esi,(%esp)
+  801ce6:	e8 24 05 00 00       	call   80220f <pageref>
+		nn = thisenv->env_runs;
+  801ceb:	8b 15 20 60 80 00    	mov    0x806020,%edx
+  801cf1:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801cf4:	83 c4 10             	add    $0x10,%esp
+  801cf7:	39 cb                	cmp    %ecx,%ebx
+  801cf9:	74 1b                	je     801d16 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801cfb:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801cfe:	75 cf                	jne    801ccf <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801d00:	8b 42 58             	mov    0x58(%edx),%eax
+  801d03:	6a 01                	push   $0x1
+  801d05:	50                   	push   %eax
+  801d06:	53                   	push   %ebx
+  801d07:	68 b3 2b 80 00       	push   $0x802bb3
+  801d0c:	e8 5a e5 ff ff       	call   80026b <cprintf>
+  801d11:	83 c4 10             	add    $0x10,%esp
+  801d14:	eb b9                	jmp    801ccf <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801d16:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801d19:	0f 94 c0             	sete   %al
+  801d1c:	0f b6 c0             	movzbl %al,%eax
+}
+  801d1f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d22:	5b                   	pop    %ebx
+  801d23:	5e                   	pop    %esi
+  801d24:	5f                   	pop    %edi
+  801d25:	5d                   	pop    %ebp
+  801d26:	c3                   	ret
+
+00801d27 <devpipe_write>:
+{
+  801d27:	55                   	push   %ebp
+  801d28:	89 e5                	mov    %esp,%ebp
+  801d2a:	57                   	push   %edi
+  801d2b:	56                   	push   %esi
+  801d2c:	53                   	push   %ebx
+  801d2d:	83 ec 28             	sub    $0x28,%esp
+  801d30:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801d33:	56                   	push   %esi
+  801d34:	e8 ba f1 ff ff       	call   800ef3 <fd2data>
+  801d39:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801d3b:	83 c4 10             	add    $0x10,%esp
+  801d3e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d43:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801d46:	75 09                	jne    801d51 <devpipe_write+0x2a>
+	return i;
+  801d48:	89 f8                	mov    %edi,%eax
+  801d4a:	eb 23                	jmp    801d6f <devpipe_write+0x48>
+			sys_yield();
+  801d4c:	e8 a0 ee ff ff       	call   800bf1 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801d51:	8b 43 04             	mov    0x4(%ebx),%eax
+  801d54:	8b 0b                	mov    (%ebx),%ecx
+  801d56:	8d 51 20             	lea    0x20(%ecx),%edx
+  801d59:	39 d0                	cmp    %edx,%eax
+  801d5b:	72 1a                	jb     801d77 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  801d5d:	89 da                	mov    %ebx,%edx
+  801d5f:	89 f0                	mov    %esi,%eax
+  801d61:	e8 5c ff ff ff       	call   801cc2 <_pipeisclosed>
+  801d66:	85 c0                	test   %eax,%eax
+  801d68:	74 e2                	je     801d4c <devpipe_write+0x25>
+				return 0;
+  801d6a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d6f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d72:	5b                   	pop    %ebx
+  801d73:	5e                   	pop    %esi
+  801d74:	5f                   	pop    %edi
+  801d75:	5d                   	pop    %ebp
+  801d76:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801d77:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d7a:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801d7e:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801d81:	89 c2                	mov    %eax,%edx
+  801d83:	c1 fa 1f             	sar    $0x1f,%edx
+  801d86:	89 d1                	mov    %edx,%ecx
+  801d88:	c1 e9 1b             	shr    $0x1b,%ecx
+  801d8b:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801d8e:	83 e2 1f             	and    $0x1f,%edx
+  801d91:	29 ca                	sub    %ecx,%edx
+  801d93:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801d97:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  801d9b:	83 c0 01             	add    $0x1,%eax
+  801d9e:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  801da1:	83 c7 01             	add    $0x1,%edi
+  801da4:	eb 9d                	jmp    801d43 <devpipe_write+0x1c>
+
+00801da6 <devpipe_read>:
+{
+  801da6:	55                   	push   %ebp
+  801da7:	89 e5                	mov    %esp,%ebp
+  801da9:	57                   	push   %edi
+  801daa:	56                   	push   %esi
+  801dab:	53                   	push   %ebx
+  801dac:	83 ec 18             	sub    $0x18,%esp
+  801daf:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  801db2:	57                   	push   %edi
+  801db3:	e8 3b f1 ff ff       	call   800ef3 <fd2data>
+  801db8:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801dba:	83 c4 10             	add    $0x10,%esp
+  801dbd:	be 00 00 00 00       	mov    $0x0,%esi
+  801dc2:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801dc5:	75 13                	jne    801dda <devpipe_read+0x34>
+	return i;
+  801dc7:	89 f0                	mov    %esi,%eax
+  801dc9:	eb 02                	jmp    801dcd <devpipe_read+0x27>
+				return i;
+  801dcb:	89 f0                	mov    %esi,%eax
+}
+  801dcd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801dd0:	5b                   	pop    %ebx
+  801dd1:	5e                   	pop    %esi
+  801dd2:	5f                   	pop    %edi
+  801dd3:	5d                   	pop    %ebp
+  801dd4:	c3                   	ret
+			sys_yield();
+  801dd5:	e8 17 ee ff ff       	call   800bf1 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  801dda:	8b 03                	mov    (%ebx),%eax
+  801ddc:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801ddf:	75 18                	jne    801df9 <devpipe_read+0x53>
+			if (i > 0)
+  801de1:	85 f6                	test   %esi,%esi
+  801de3:	75 e6                	jne    801dcb <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  801de5:	89 da                	mov    %ebx,%edx
+  801de7:	89 f8                	mov    %edi,%eax
+  801de9:	e8 d4 fe ff ff       	call   801cc2 <_pipeisclosed>
+  801dee:	85 c0                	test   %eax,%eax
+  801df0:	74 e3                	je     801dd5 <devpipe_read+0x2f>
+				return 0;
+  801df2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801df7:	eb d4                	jmp    801dcd <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801df9:	99                   	cltd
+  801dfa:	c1 ea 1b             	shr    $0x1b,%edx
+  801dfd:	01 d0                	add    %edx,%eax
+  801dff:	83 e0 1f             	and    $0x1f,%eax
+  801e02:	29 d0                	sub    %edx,%eax
+  801e04:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801e09:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e0c:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  801e0f:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  801e12:	83 c6 01             	add    $0x1,%esi
+  801e15:	eb ab                	jmp    801dc2 <devpipe_read+0x1c>
+
+00801e17 <pipe>:
+{
+  801e17:	55                   	push   %ebp
+  801e18:	89 e5                	mov    %esp,%ebp
+  801e1a:	56                   	push   %esi
+  801e1b:	53                   	push   %ebx
+  801e1c:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801e1f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e22:	50                   	push   %eax
+  801e23:	e8 e2 f0 ff ff       	call   800f0a <fd_alloc>
+  801e28:	89 c3                	mov    %eax,%ebx
+  801e2a:	83 c4 10             	add    $0x10,%esp
+  801e2d:	85 c0                	test   %eax,%eax
+  801e2f:	0f 88 23 01 00 00    	js     801f58 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801e35:	83 ec 04             	sub    $0x4,%esp
+  801e38:	68 07 04 00 00       	push   $0x407
+  801e3d:	ff 75 f4             	push   -0xc(%ebp)
+  801e40:	6a 00                	push   $0x0
+  801e42:	e8 c9 ed ff ff       	call   800c10 <sys_page_alloc>
+  801e47:	89 c3                	mov    %eax,%ebx
+  801e49:	83 c4 10             	add    $0x10,%esp
+  801e4c:	85 c0                	test   %eax,%eax
+  801e4e:	0f 88 04 01 00 00    	js     801f58 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801e54:	83 ec 0c             	sub    $0xc,%esp
+  801e57:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e5a:	50                   	push   %eax
+  801e5b:	e8 aa f0 ff ff       	call   800f0a <fd_alloc>
+  801e60:	89 c3                	mov    %eax,%ebx
+  801e62:	83 c4 10             	add    $0x10,%esp
+  801e65:	85 c0                	test   %eax,%eax
+  801e67:	0f 88 db 00 00 00    	js     801f48 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801e6d:	83 ec 04             	sub    $0x4,%esp
+  801e70:	68 07 04 00 00       	push   $0x407
+  801e75:	ff 75 f0             	push   -0x10(%ebp)
+  801e78:	6a 00                	push   $0x0
+  801e7a:	e8 91 ed ff ff       	call   800c10 <sys_page_alloc>
+  801e7f:	89 c3                	mov    %eax,%ebx
+  801e81:	83 c4 10             	add    $0x10,%esp
+  801e84:	85 c0                	test   %eax,%eax
+  801e86:	0f 88 bc 00 00 00    	js     801f48 <pipe+0x131>
+	va = fd2data(fd0);
+  801e8c:	83 ec 0c             	sub    $0xc,%esp
+  801e8f:	ff 75 f4             	push   -0xc(%ebp)
+  801e92:	e8 5c f0 ff ff       	call   800ef3 <fd2data>
+  801e97:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801e99:	83 c4 0c             	add    $0xc,%esp
+  801e9c:	68 07 04 00 00       	push   $0x407
+  801ea1:	50                   	push   %eax
+  801ea2:	6a 00                	push   $0x0
+  801ea4:	e8 67 ed ff ff       	call   800c10 <sys_page_alloc>
+  801ea9:	89 c3                	mov    %eax,%ebx
+  801eab:	83 c4 10             	add    $0x10,%esp
+  801eae:	85 c0                	test   %eax,%eax
+  801eb0:	0f 88 82 00 00 00    	js     801f38 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801eb6:	83 ec 0c             	sub    $0xc,%esp
+  801eb9:	ff 75 f0             	push   -0x10(%ebp)
+  801ebc:	e8 32 f0 ff ff       	call   800ef3 <fd2data>
+  801ec1:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801ec8:	50                   	push   %eax
+  801ec9:	6a 00                	push   $0x0
+  801ecb:	56                   	push   %esi
+  801ecc:	6a 00                	push   $0x0
+  801ece:	e8 80 ed ff ff       	call   800c53 <sys_page_map>
+  801ed3:	89 c3                	mov    %eax,%ebx
+  801ed5:	83 c4 20             	add    $0x20,%esp
+  801ed8:	85 c0                	test   %eax,%eax
+  801eda:	78 4e                	js     801f2a <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  801edc:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  801ee1:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801ee4:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  801ee6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801ee9:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  801ef0:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801ef3:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  801ef5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801ef8:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  801eff:	83 ec 0c             	sub    $0xc,%esp
+  801f02:	ff 75 f4             	push   -0xc(%ebp)
+  801f05:	e8 d9 ef ff ff       	call   800ee3 <fd2num>
+  801f0a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801f0d:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  801f0f:	83 c4 04             	add    $0x4,%esp
+  801f12:	ff 75 f0             	push   -0x10(%ebp)
+  801f15:	e8 c9 ef ff ff       	call   800ee3 <fd2num>
+  801f1a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801f1d:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  801f20:	83 c4 10             	add    $0x10,%esp
+  801f23:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f28:	eb 2e                	jmp    801f58 <pipe+0x141>
+	sys_page_unmap(0, va);
+  801f2a:	83 ec 08             	sub    $0x8,%esp
+  801f2d:	56                   	push   %esi
+  801f2e:	6a 00                	push   $0x0
+  801f30:	e8 60 ed ff ff       	call   800c95 <sys_page_unmap>
+  801f35:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  801f38:	83 ec 08             	sub    $0x8,%esp
+  801f3b:	ff 75 f0             	push   -0x10(%ebp)
+  801f3e:	6a 00                	push   $0x0
+  801f40:	e8 50 ed ff ff       	call   800c95 <sys_page_unmap>
+  801f45:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  801f48:	83 ec 08             	sub    $0x8,%esp
+  801f4b:	ff 75 f4             	push   -0xc(%ebp)
+  801f4e:	6a 00                	push   $0x0
+  801f50:	e8 40 ed ff ff       	call   800c95 <sys_page_unmap>
+  801f55:	83 c4 10             	add    $0x10,%esp
+}
+  801f58:	89 d8                	mov    %ebx,%eax
+  801f5a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f5d:	5b                   	pop    %ebx
+  801f5e:	5e                   	pop    %esi
+  801f5f:	5d                   	pop    %ebp
+  801f60:	c3                   	ret
+
+00801f61 <pipeisclosed>:
+{
+  801f61:	55                   	push   %ebp
+  801f62:	89 e5                	mov    %esp,%ebp
+  801f64:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801f67:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f6a:	50                   	push   %eax
+  801f6b:	ff 75 08             	push   0x8(%ebp)
+  801f6e:	e8 ed ef ff ff       	call   800f60 <fd_lookup>
+  801f73:	83 c4 10             	add    $0x10,%esp
+  801f76:	85 c0                	test   %eax,%eax
+  801f78:	78 18                	js     801f92 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  801f7a:	83 ec 0c             	sub    $0xc,%esp
+  801f7d:	ff 75 f4             	push   -0xc(%ebp)
+  801f80:	e8 6e ef ff ff       	call   800ef3 <fd2data>
+  801f85:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  801f87:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f8a:	e8 33 fd ff ff       	call   801cc2 <_pipeisclosed>
+  801f8f:	83 c4 10             	add    $0x10,%esp
+}
+  801f92:	c9                   	leave
+  801f93:	c3                   	ret
+
+00801f94 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  801f94:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f99:	c3                   	ret
+
+00801f9a <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  801f9a:	55                   	push   %ebp
+  801f9b:	89 e5                	mov    %esp,%ebp
+  801f9d:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  801fa0:	68 cb 2b 80 00       	push   $0x802bcb
+  801fa5:	ff 75 0c             	push   0xc(%ebp)
+  801fa8:	e8 77 e8 ff ff       	call   800824 <strcpy>
+	return 0;
+}
+  801fad:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fb2:	c9                   	leave
+  801fb3:	c3                   	ret
+
+00801fb4 <devcons_write>:
+{
+  801fb4:	55                   	push   %ebp
+  801fb5:	89 e5                	mov    %esp,%ebp
+  801fb7:	57                   	push   %edi
+  801fb8:	56                   	push   %esi
+  801fb9:	53                   	push   %ebx
+  801fba:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  801fc0:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  801fc5:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  801fcb:	eb 2e                	jmp    801ffb <devcons_write+0x47>
+		m = n - tot;
+  801fcd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801fd0:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  801fd2:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801fd7:	39 c3                	cmp    %eax,%ebx
+  801fd9:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  801fdc:	83 ec 04             	sub    $0x4,%esp
+  801fdf:	53                   	push   %ebx
+  801fe0:	89 f0                	mov    %esi,%eax
+  801fe2:	03 45 0c             	add    0xc(%ebp),%eax
+  801fe5:	50                   	push   %eax
+  801fe6:	57                   	push   %edi
+  801fe7:	e8 be e9 ff ff       	call   8009aa <memmove>
+		sys_cputs(buf, m);
+  801fec:	83 c4 08             	add    $0x8,%esp
+  801fef:	53                   	push   %ebx
+  801ff0:	57                   	push   %edi
+  801ff1:	e8 5e eb ff ff       	call   800b54 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  801ff6:	01 de                	add    %ebx,%esi
+  801ff8:	83 c4 10             	add    $0x10,%esp
+  801ffb:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801ffe:	72 cd                	jb     801fcd <devcons_write+0x19>
+}
+  802000:	89 f0                	mov    %esi,%eax
+  802002:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802005:	5b                   	pop    %ebx
+  802006:	5e                   	pop    %esi
+  802007:	5f                   	pop    %edi
+  802008:	5d                   	pop    %ebp
+  802009:	c3                   	ret
+
+0080200a <devcons_read>:
+{
+  80200a:	55                   	push   %ebp
+  80200b:	89 e5                	mov    %esp,%ebp
+  80200d:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802010:	b8 00 00 00 00       	mov    $0x0,%eax
+  802015:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802019:	75 07                	jne    802022 <devcons_read+0x18>
+  80201b:	eb 1f                	jmp    80203c <devcons_read+0x32>
+		sys_yield();
+  80201d:	e8 cf eb ff ff       	call   800bf1 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802022:	e8 4b eb ff ff       	call   800b72 <sys_cgetc>
+  802027:	85 c0                	test   %eax,%eax
+  802029:	74 f2                	je     80201d <devcons_read+0x13>
+	if (c < 0)
+  80202b:	78 0f                	js     80203c <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80202d:	83 f8 04             	cmp    $0x4,%eax
+  802030:	74 0c                	je     80203e <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802032:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802035:	88 02                	mov    %al,(%edx)
+	return 1;
+  802037:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80203c:	c9                   	leave
+  80203d:	c3                   	ret
+		return 0;
+  80203e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802043:	eb f7                	jmp    80203c <devcons_read+0x32>
+
+00802045 <cputchar>:
+{
+  802045:	55                   	push   %ebp
+  802046:	89 e5                	mov    %esp,%ebp
+  802048:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80204b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80204e:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802051:	6a 01                	push   $0x1
+  802053:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802056:	50                   	push   %eax
+  802057:	e8 f8 ea ff ff       	call   800b54 <sys_cputs>
+}
+  80205c:	83 c4 10             	add    $0x10,%esp
+  80205f:	c9                   	leave
+  802060:	c3                   	ret
+
+00802061 <getchar>:
+{
+  802061:	55                   	push   %ebp
+  802062:	89 e5                	mov    %esp,%ebp
+  802064:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802067:	6a 01                	push   $0x1
+  802069:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80206c:	50                   	push   %eax
+  80206d:	6a 00                	push   $0x0
+  80206f:	e8 52 f1 ff ff       	call   8011c6 <read>
+	if (r < 0)
+  802074:	83 c4 10             	add    $0x10,%esp
+  802077:	85 c0                	test   %eax,%eax
+  802079:	78 06                	js     802081 <getchar+0x20>
+	if (r < 1)
+  80207b:	74 06                	je     802083 <getchar+0x22>
+	return c;
+  80207d:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802081:	c9                   	leave
+  802082:	c3                   	ret
+		return -E_EOF;
+  802083:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802088:	eb f7                	jmp    802081 <getchar+0x20>
+
+0080208a <iscons>:
+{
+  80208a:	55                   	push   %ebp
+  80208b:	89 e5                	mov    %esp,%ebp
+  80208d:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802090:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802093:	50                   	push   %eax
+  802094:	ff 75 08             	push   0x8(%ebp)
+  802097:	e8 c4 ee ff ff       	call   800f60 <fd_lookup>
+  80209c:	83 c4 10             	add    $0x10,%esp
+  80209f:	85 c0                	test   %eax,%eax
+  8020a1:	78 11                	js     8020b4 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8020a3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020a6:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  8020ac:	39 10                	cmp    %edx,(%eax)
+  8020ae:	0f 94 c0             	sete   %al
+  8020b1:	0f b6 c0             	movzbl %al,%eax
+}
+  8020b4:	c9                   	leave
+  8020b5:	c3                   	ret
+
+008020b6 <opencons>:
+{
+  8020b6:	55                   	push   %ebp
+  8020b7:	89 e5                	mov    %esp,%ebp
+  8020b9:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8020bc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020bf:	50                   	push   %eax
+  8020c0:	e8 45 ee ff ff       	call   800f0a <fd_alloc>
+  8020c5:	83 c4 10             	add    $0x10,%esp
+  8020c8:	85 c0                	test   %eax,%eax
+  8020ca:	78 3a                	js     802106 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8020cc:	83 ec 04             	sub    $0x4,%esp
+  8020cf:	68 07 04 00 00       	push   $0x407
+  8020d4:	ff 75 f4             	push   -0xc(%ebp)
+  8020d7:	6a 00                	push   $0x0
+  8020d9:	e8 32 eb ff ff       	call   800c10 <sys_page_alloc>
+  8020de:	83 c4 10             	add    $0x10,%esp
+  8020e1:	85 c0                	test   %eax,%eax
+  8020e3:	78 21                	js     802106 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8020e5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020e8:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  8020ee:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8020f0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020f3:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8020fa:	83 ec 0c             	sub    $0xc,%esp
+  8020fd:	50                   	push   %eax
+  8020fe:	e8 e0 ed ff ff       	call   800ee3 <fd2num>
+  802103:	83 c4 10             	add    $0x10,%esp
+}
+  802106:	c9                   	leave
+  802107:	c3                   	ret
+
+00802108 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  802108:	55                   	push   %ebp
+  802109:	89 e5                	mov    %esp,%ebp
+  80210b:	56                   	push   %esi
+  80210c:	53                   	push   %ebx
+  80210d:	8b 75 08             	mov    0x8(%ebp),%esi
+  802110:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802113:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  802116:	85 c0                	test   %eax,%eax
+  802118:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80211d:	0f 44 c2             	cmove  %edx,%eax
+  802120:	83 ec 0c             	sub    $0xc,%esp
+  802123:	50                   	push   %eax
+  802124:	e8 97 ec ff ff       	call   800dc0 <sys_ipc_recv>
+
+  if (from_env_store)
+  802129:	83 c4 10             	add    $0x10,%esp
+  80212c:	85 f6                	test   %esi,%esi
+  80212e:	74 17                	je     802147 <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  802130:	ba 00 00 00 00       	mov    $0x0,%edx
+  802135:	85 c0                	test   %eax,%eax
+  802137:	75 0c                	jne    802145 <ipc_recv+0x3d>
+  802139:	8b 15 20 60 80 00    	mov    0x806020,%edx
+  80213f:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  802145:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  802147:	85 db                	test   %ebx,%ebx
+  802149:	74 2b                	je     802176 <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  80214b:	85 c0                	test   %eax,%eax
+  80214d:	74 0d                	je     80215c <ipc_recv+0x54>
+  80214f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  802155:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802158:	5b                   	pop    %ebx
+  802159:	5e                   	pop    %esi
+  80215a:	5d                   	pop    %ebp
+  80215b:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  80215c:	a1 20 60 80 00       	mov    0x806020,%eax
+  802161:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  802167:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  802169:	a1 20 60 80 00       	mov    0x806020,%eax
+  80216e:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  802174:	eb df                	jmp    802155 <ipc_recv+0x4d>
+  802176:	85 c0                	test   %eax,%eax
+  802178:	75 db                	jne    802155 <ipc_recv+0x4d>
+  80217a:	eb ed                	jmp    802169 <ipc_recv+0x61>
+
+0080217c <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  80217c:	55                   	push   %ebp
+  80217d:	89 e5                	mov    %esp,%ebp
+  80217f:	57                   	push   %edi
+  802180:	56                   	push   %esi
+  802181:	53                   	push   %ebx
+  802182:	83 ec 0c             	sub    $0xc,%esp
+  802185:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802188:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80218b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  80218e:	85 db                	test   %ebx,%ebx
+  802190:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802195:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  802198:	ff 75 14             	push   0x14(%ebp)
+  80219b:	53                   	push   %ebx
+  80219c:	56                   	push   %esi
+  80219d:	57                   	push   %edi
+  80219e:	e8 fa eb ff ff       	call   800d9d <sys_ipc_try_send>
+  8021a3:	83 c4 10             	add    $0x10,%esp
+  8021a6:	85 c0                	test   %eax,%eax
+  8021a8:	74 1e                	je     8021c8 <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  8021aa:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8021ad:	75 07                	jne    8021b6 <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  8021af:	e8 3d ea ff ff       	call   800bf1 <sys_yield>
+  8021b4:	eb e2                	jmp    802198 <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  8021b6:	50                   	push   %eax
+  8021b7:	68 d7 2b 80 00       	push   $0x802bd7
+  8021bc:	6a 3c                	push   $0x3c
+  8021be:	68 e4 2b 80 00       	push   $0x802be4
+  8021c3:	e8 c8 df ff ff       	call   800190 <_panic>
+  }
+
+#endif
+}
+  8021c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021cb:	5b                   	pop    %ebx
+  8021cc:	5e                   	pop    %esi
+  8021cd:	5f                   	pop    %edi
+  8021ce:	5d                   	pop    %ebp
+  8021cf:	c3                   	ret
+
+008021d0 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  8021d0:	55                   	push   %ebp
+  8021d1:	89 e5                	mov    %esp,%ebp
+  8021d3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  8021d6:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  8021db:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8021de:	c1 e0 04             	shl    $0x4,%eax
+  8021e1:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8021e6:	8b 40 50             	mov    0x50(%eax),%eax
+  8021e9:	39 c8                	cmp    %ecx,%eax
+  8021eb:	74 12                	je     8021ff <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  8021ed:	83 c2 01             	add    $0x1,%edx
+  8021f0:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8021f6:	75 e3                	jne    8021db <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  8021f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021fd:	eb 0e                	jmp    80220d <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  8021ff:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802202:	c1 e0 04             	shl    $0x4,%eax
+  802205:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80220a:	8b 40 48             	mov    0x48(%eax),%eax
+  80220d:	5d                   	pop    %ebp
+  80220e:	c3                   	ret
+
+0080220f <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80220f:	55                   	push   %ebp
+  802210:	89 e5                	mov    %esp,%ebp
+  802212:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802215:	89 c2                	mov    %eax,%edx
+  802217:	c1 ea 16             	shr    $0x16,%edx
+  80221a:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802221:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802226:	f6 c1 01             	test   $0x1,%cl
+  802229:	74 1c                	je     802247 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  80222b:	c1 e8 0c             	shr    $0xc,%eax
+  80222e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802235:	a8 01                	test   $0x1,%al
+  802237:	74 0e                	je     802247 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802239:	c1 e8 0c             	shr    $0xc,%eax
+  80223c:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802243:	ef 
+  802244:	0f b7 d2             	movzwl %dx,%edx
+}
+  802247:	89 d0                	mov    %edx,%eax
+  802249:	5d                   	pop    %ebp
+  80224a:	c3                   	ret
+  80224b:	66 90                	xchg   %ax,%ax
+  80224d:	66 90                	xchg   %ax,%ax
+  80224f:	90                   	nop
+
+00802250 <__udivmoddi4>:
+  802250:	55                   	push   %ebp
+  802251:	57                   	push   %edi
+  802252:	56                   	push   %esi
+  802253:	53                   	push   %ebx
+  802254:	83 ec 24             	sub    $0x24,%esp
+  802257:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80225b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80225f:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  802263:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802267:	8b 54 24 44          	mov    0x44(%esp),%edx
+  80226b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80226f:	8b 44 24 40          	mov    0x40(%esp),%eax
+  802273:	89 d3                	mov    %edx,%ebx
+  802275:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802279:	09 c3                	or     %eax,%ebx
+  80227b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80227f:	0f 84 9c 00 00 00    	je     802321 <__udivmoddi4+0xd1>
+  802285:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80228c:	00 
+  80228d:	31 c0                	xor    %eax,%eax
+  80228f:	31 d2                	xor    %edx,%edx
+  802291:	89 fb                	mov    %edi,%ebx
+  802293:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80229a:	00 
+  80229b:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8022a0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8022a4:	01 c0                	add    %eax,%eax
+  8022a6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8022ad:	00 
+  8022ae:	89 c6                	mov    %eax,%esi
+  8022b0:	89 d7                	mov    %edx,%edi
+  8022b2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8022b6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8022ba:	0f ad d0             	shrd   %cl,%edx,%eax
+  8022bd:	d3 ea                	shr    %cl,%edx
+  8022bf:	f6 c1 20             	test   $0x20,%cl
+  8022c2:	0f 45 c2             	cmovne %edx,%eax
+  8022c5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8022c9:	83 e0 01             	and    $0x1,%eax
+  8022cc:	09 fa                	or     %edi,%edx
+  8022ce:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8022d2:	89 04 24             	mov    %eax,(%esp)
+  8022d5:	8b 04 24             	mov    (%esp),%eax
+  8022d8:	89 d5                	mov    %edx,%ebp
+  8022da:	09 f0                	or     %esi,%eax
+  8022dc:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8022e0:	39 f0                	cmp    %esi,%eax
+  8022e2:	19 fd                	sbb    %edi,%ebp
+  8022e4:	72 1d                	jb     802303 <__udivmoddi4+0xb3>
+  8022e6:	29 f0                	sub    %esi,%eax
+  8022e8:	19 fa                	sbb    %edi,%edx
+  8022ea:	89 cf                	mov    %ecx,%edi
+  8022ec:	c1 ef 05             	shr    $0x5,%edi
+  8022ef:	83 e7 01             	and    $0x1,%edi
+  8022f2:	89 fe                	mov    %edi,%esi
+  8022f4:	d3 e7                	shl    %cl,%edi
+  8022f6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8022fa:	83 f6 01             	xor    $0x1,%esi
+  8022fd:	d3 e6                	shl    %cl,%esi
+  8022ff:	09 74 24 18          	or     %esi,0x18(%esp)
+  802303:	83 e9 01             	sub    $0x1,%ecx
+  802306:	73 98                	jae    8022a0 <__udivmoddi4+0x50>
+  802308:	85 db                	test   %ebx,%ebx
+  80230a:	74 05                	je     802311 <__udivmoddi4+0xc1>
+  80230c:	89 03                	mov    %eax,(%ebx)
+  80230e:	89 53 04             	mov    %edx,0x4(%ebx)
+  802311:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802315:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802319:	83 c4 24             	add    $0x24,%esp
+  80231c:	5b                   	pop    %ebx
+  80231d:	5e                   	pop    %esi
+  80231e:	5f                   	pop    %edi
+  80231f:	5d                   	pop    %ebp
+  802320:	c3                   	ret
+  802321:	85 ff                	test   %edi,%edi
+  802323:	74 0d                	je     802332 <__udivmoddi4+0xe2>
+  802325:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  80232b:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  802332:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802336:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80233a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80233e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802342:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802346:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80234a:	83 c4 24             	add    $0x24,%esp
+  80234d:	5b                   	pop    %ebx
+  80234e:	5e                   	pop    %esi
+  80234f:	5f                   	pop    %edi
+  802350:	5d                   	pop    %ebp
+  802351:	c3                   	ret
+  802352:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802359:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00802360 <__udivdi3>:
+  802360:	57                   	push   %edi
+  802361:	56                   	push   %esi
+  802362:	53                   	push   %ebx
+  802363:	83 ec 20             	sub    $0x20,%esp
+  802366:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80236a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80236e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802372:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802376:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80237a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80237e:	89 d1                	mov    %edx,%ecx
+  802380:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802384:	09 c1                	or     %eax,%ecx
+  802386:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80238a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80238e:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802392:	0f 84 88 00 00 00    	je     802420 <__udivdi3+0xc0>
+  802398:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80239f:	00 
+  8023a0:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8023a5:	31 c0                	xor    %eax,%eax
+  8023a7:	31 d2                	xor    %edx,%edx
+  8023a9:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8023b0:	00 
+  8023b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8023b8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8023bc:	01 c0                	add    %eax,%eax
+  8023be:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8023c5:	00 
+  8023c6:	89 c6                	mov    %eax,%esi
+  8023c8:	89 d7                	mov    %edx,%edi
+  8023ca:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8023ce:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8023d2:	0f ad d0             	shrd   %cl,%edx,%eax
+  8023d5:	d3 ea                	shr    %cl,%edx
+  8023d7:	f6 c1 20             	test   $0x20,%cl
+  8023da:	0f 45 c2             	cmovne %edx,%eax
+  8023dd:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8023e1:	83 e0 01             	and    $0x1,%eax
+  8023e4:	09 fa                	or     %edi,%edx
+  8023e6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8023ea:	89 04 24             	mov    %eax,(%esp)
+  8023ed:	8b 04 24             	mov    (%esp),%eax
+  8023f0:	89 d3                	mov    %edx,%ebx
+  8023f2:	09 f0                	or     %esi,%eax
+  8023f4:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8023f8:	39 f0                	cmp    %esi,%eax
+  8023fa:	19 fb                	sbb    %edi,%ebx
+  8023fc:	72 1d                	jb     80241b <__udivdi3+0xbb>
+  8023fe:	29 f0                	sub    %esi,%eax
+  802400:	19 fa                	sbb    %edi,%edx
+  802402:	89 cf                	mov    %ecx,%edi
+  802404:	c1 ef 05             	shr    $0x5,%edi
+  802407:	83 e7 01             	and    $0x1,%edi
+  80240a:	89 fe                	mov    %edi,%esi
+  80240c:	d3 e7                	shl    %cl,%edi
+  80240e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802412:	83 f6 01             	xor    $0x1,%esi
+  802415:	d3 e6                	shl    %cl,%esi
+  802417:	09 74 24 18          	or     %esi,0x18(%esp)
+  80241b:	83 e9 01             	sub    $0x1,%ecx
+  80241e:	73 98                	jae    8023b8 <__udivdi3+0x58>
+  802420:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802424:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802428:	83 c4 20             	add    $0x20,%esp
+  80242b:	5b                   	pop    %ebx
+  80242c:	5e                   	pop    %esi
+  80242d:	5f                   	pop    %edi
+  80242e:	c3                   	ret
+  80242f:	90                   	nop
+
+00802430 <__umoddi3>:
+  802430:	57                   	push   %edi
+  802431:	56                   	push   %esi
+  802432:	53                   	push   %ebx
+  802433:	83 ec 18             	sub    $0x18,%esp
+  802436:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80243a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80243e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802442:	8b 54 24 34          	mov    0x34(%esp),%edx
+  802446:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80244a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80244e:	89 d1                	mov    %edx,%ecx
+  802450:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802454:	09 c1                	or     %eax,%ecx
+  802456:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80245a:	74 5b                	je     8024b7 <__umoddi3+0x87>
+  80245c:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802461:	31 c0                	xor    %eax,%eax
+  802463:	31 d2                	xor    %edx,%edx
+  802465:	8d 76 00             	lea    0x0(%esi),%esi
+  802468:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80246c:	01 c0                	add    %eax,%eax
+  80246e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802475:	00 
+  802476:	89 c6                	mov    %eax,%esi
+  802478:	89 d7                	mov    %edx,%edi
+  80247a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80247e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802482:	0f ad d0             	shrd   %cl,%edx,%eax
+  802485:	d3 ea                	shr    %cl,%edx
+  802487:	f6 c1 20             	test   $0x20,%cl
+  80248a:	0f 45 c2             	cmovne %edx,%eax
+  80248d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802491:	83 e0 01             	and    $0x1,%eax
+  802494:	09 fa                	or     %edi,%edx
+  802496:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80249a:	89 04 24             	mov    %eax,(%esp)
+  80249d:	8b 04 24             	mov    (%esp),%eax
+  8024a0:	89 d3                	mov    %edx,%ebx
+  8024a2:	09 f0                	or     %esi,%eax
+  8024a4:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8024a8:	39 f0                	cmp    %esi,%eax
+  8024aa:	19 fb                	sbb    %edi,%ebx
+  8024ac:	72 04                	jb     8024b2 <__umoddi3+0x82>
+  8024ae:	29 f0                	sub    %esi,%eax
+  8024b0:	19 fa                	sbb    %edi,%edx
+  8024b2:	83 e9 01             	sub    $0x1,%ecx
+  8024b5:	73 b1                	jae    802468 <__umoddi3+0x38>
+  8024b7:	83 c4 18             	add    $0x18,%esp
+  8024ba:	5b                   	pop    %ebx
+  8024bb:	5e                   	pop    %esi
+  8024bc:	5f                   	pop    %edi
+  8024bd:	c3                   	ret
+  8024be:	66 90                	xchg   %ax,%ax
+
+008024c0 <__divdi3>:
+  8024c0:	55                   	push   %ebp
+  8024c1:	57                   	push   %edi
+  8024c2:	56                   	push   %esi
+  8024c3:	53                   	push   %ebx
+  8024c4:	83 ec 24             	sub    $0x24,%esp
+  8024c7:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  8024cb:	8b 74 24 44          	mov    0x44(%esp),%esi
+  8024cf:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8024d3:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8024d7:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  8024db:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8024df:	85 d2                	test   %edx,%edx
+  8024e1:	0f 88 e0 00 00 00    	js     8025c7 <__divdi3+0x107>
+  8024e7:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  8024eb:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  8024ef:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8024f3:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8024f7:	85 f6                	test   %esi,%esi
+  8024f9:	78 16                	js     802511 <__divdi3+0x51>
+  8024fb:	89 f1                	mov    %esi,%ecx
+  8024fd:	31 c0                	xor    %eax,%eax
+  8024ff:	31 d2                	xor    %edx,%edx
+  802501:	09 d9                	or     %ebx,%ecx
+  802503:	0f 85 f3 00 00 00    	jne    8025fc <__divdi3+0x13c>
+  802509:	83 c4 24             	add    $0x24,%esp
+  80250c:	5b                   	pop    %ebx
+  80250d:	5e                   	pop    %esi
+  80250e:	5f                   	pop    %edi
+  80250f:	5d                   	pop    %ebp
+  802510:	c3                   	ret
+  802511:	bf 01 00 00 00       	mov    $0x1,%edi
+  802516:	f7 5c 24 08          	negl   0x8(%esp)
+  80251a:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  80251f:	f7 5c 24 0c          	negl   0xc(%esp)
+  802523:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80252a:	00 
+  80252b:	31 c0                	xor    %eax,%eax
+  80252d:	31 d2                	xor    %edx,%edx
+  80252f:	89 fb                	mov    %edi,%ebx
+  802531:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802538:	00 
+  802539:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80253e:	66 90                	xchg   %ax,%ax
+  802540:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802544:	01 c0                	add    %eax,%eax
+  802546:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80254d:	00 
+  80254e:	89 c6                	mov    %eax,%esi
+  802550:	89 d7                	mov    %edx,%edi
+  802552:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802556:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80255a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80255d:	d3 ea                	shr    %cl,%edx
+  80255f:	f6 c1 20             	test   $0x20,%cl
+  802562:	0f 45 c2             	cmovne %edx,%eax
+  802565:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802569:	83 e0 01             	and    $0x1,%eax
+  80256c:	09 fa                	or     %edi,%edx
+  80256e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802572:	89 04 24             	mov    %eax,(%esp)
+  802575:	8b 04 24             	mov    (%esp),%eax
+  802578:	89 d5                	mov    %edx,%ebp
+  80257a:	09 f0                	or     %esi,%eax
+  80257c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802580:	39 f0                	cmp    %esi,%eax
+  802582:	19 fd                	sbb    %edi,%ebp
+  802584:	72 1d                	jb     8025a3 <__divdi3+0xe3>
+  802586:	29 f0                	sub    %esi,%eax
+  802588:	19 fa                	sbb    %edi,%edx
+  80258a:	89 cf                	mov    %ecx,%edi
+  80258c:	c1 ef 05             	shr    $0x5,%edi
+  80258f:	83 e7 01             	and    $0x1,%edi
+  802592:	89 fe                	mov    %edi,%esi
+  802594:	d3 e7                	shl    %cl,%edi
+  802596:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80259a:	83 f6 01             	xor    $0x1,%esi
+  80259d:	d3 e6                	shl    %cl,%esi
+  80259f:	09 74 24 18          	or     %esi,0x18(%esp)
+  8025a3:	83 e9 01             	sub    $0x1,%ecx
+  8025a6:	73 98                	jae    802540 <__divdi3+0x80>
+  8025a8:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8025ac:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8025b0:	85 db                	test   %ebx,%ebx
+  8025b2:	0f 84 51 ff ff ff    	je     802509 <__divdi3+0x49>
+  8025b8:	f7 d8                	neg    %eax
+  8025ba:	83 d2 00             	adc    $0x0,%edx
+  8025bd:	83 c4 24             	add    $0x24,%esp
+  8025c0:	5b                   	pop    %ebx
+  8025c1:	f7 da                	neg    %edx
+  8025c3:	5e                   	pop    %esi
+  8025c4:	5f                   	pop    %edi
+  8025c5:	5d                   	pop    %ebp
+  8025c6:	c3                   	ret
+  8025c7:	f7 d8                	neg    %eax
+  8025c9:	83 d2 00             	adc    $0x0,%edx
+  8025cc:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8025d0:	f7 da                	neg    %edx
+  8025d2:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8025d6:	85 f6                	test   %esi,%esi
+  8025d8:	78 1b                	js     8025f5 <__divdi3+0x135>
+  8025da:	89 f1                	mov    %esi,%ecx
+  8025dc:	31 c0                	xor    %eax,%eax
+  8025de:	31 d2                	xor    %edx,%edx
+  8025e0:	bf 01 00 00 00       	mov    $0x1,%edi
+  8025e5:	09 d9                	or     %ebx,%ecx
+  8025e7:	0f 85 36 ff ff ff    	jne    802523 <__divdi3+0x63>
+  8025ed:	83 c4 24             	add    $0x24,%esp
+  8025f0:	5b                   	pop    %ebx
+  8025f1:	5e                   	pop    %esi
+  8025f2:	5f                   	pop    %edi
+  8025f3:	5d                   	pop    %ebp
+  8025f4:	c3                   	ret
+  8025f5:	31 ff                	xor    %edi,%edi
+  8025f7:	e9 1a ff ff ff       	jmp    802516 <__divdi3+0x56>
+  8025fc:	31 ff                	xor    %edi,%edi
+  8025fe:	e9 20 ff ff ff       	jmp    802523 <__divdi3+0x63>
+  802603:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80260a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00802610 <__moddi3>:
+  802610:	55                   	push   %ebp
+  802611:	57                   	push   %edi
+  802612:	56                   	push   %esi
+  802613:	53                   	push   %ebx
+  802614:	83 ec 1c             	sub    $0x1c,%esp
+  802617:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  80261b:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  80261f:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  802623:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  802627:	89 c8                	mov    %ecx,%eax
+  802629:	89 f2                	mov    %esi,%edx
+  80262b:	89 f3                	mov    %esi,%ebx
+  80262d:	85 ed                	test   %ebp,%ebp
+  80262f:	0f 88 9d 00 00 00    	js     8026d2 <__moddi3+0xc2>
+  802635:	09 cb                	or     %ecx,%ebx
+  802637:	0f 84 8d 00 00 00    	je     8026ca <__moddi3+0xba>
+  80263d:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802641:	31 db                	xor    %ebx,%ebx
+  802643:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802647:	89 ca                	mov    %ecx,%edx
+  802649:	89 f0                	mov    %esi,%eax
+  80264b:	89 dd                	mov    %ebx,%ebp
+  80264d:	f7 da                	neg    %edx
+  80264f:	83 d0 00             	adc    $0x0,%eax
+  802652:	f7 d8                	neg    %eax
+  802654:	0f 49 f0             	cmovns %eax,%esi
+  802657:	0f 49 ca             	cmovns %edx,%ecx
+  80265a:	31 c0                	xor    %eax,%eax
+  80265c:	31 d2                	xor    %edx,%edx
+  80265e:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802662:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802666:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80266b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80266f:	90                   	nop
+  802670:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802674:	01 c0                	add    %eax,%eax
+  802676:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80267d:	00 
+  80267e:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  802682:	89 c6                	mov    %eax,%esi
+  802684:	89 d7                	mov    %edx,%edi
+  802686:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80268a:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80268e:	0f ad d0             	shrd   %cl,%edx,%eax
+  802691:	d3 ea                	shr    %cl,%edx
+  802693:	f6 c1 20             	test   $0x20,%cl
+  802696:	0f 45 c2             	cmovne %edx,%eax
+  802699:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80269d:	83 e0 01             	and    $0x1,%eax
+  8026a0:	09 fa                	or     %edi,%edx
+  8026a2:	89 04 24             	mov    %eax,(%esp)
+  8026a5:	8b 04 24             	mov    (%esp),%eax
+  8026a8:	89 d7                	mov    %edx,%edi
+  8026aa:	09 f0                	or     %esi,%eax
+  8026ac:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  8026b0:	39 d8                	cmp    %ebx,%eax
+  8026b2:	19 f7                	sbb    %esi,%edi
+  8026b4:	72 04                	jb     8026ba <__moddi3+0xaa>
+  8026b6:	29 d8                	sub    %ebx,%eax
+  8026b8:	19 f2                	sbb    %esi,%edx
+  8026ba:	83 e9 01             	sub    $0x1,%ecx
+  8026bd:	73 b1                	jae    802670 <__moddi3+0x60>
+  8026bf:	85 ed                	test   %ebp,%ebp
+  8026c1:	74 07                	je     8026ca <__moddi3+0xba>
+  8026c3:	f7 d8                	neg    %eax
+  8026c5:	83 d2 00             	adc    $0x0,%edx
+  8026c8:	f7 da                	neg    %edx
+  8026ca:	83 c4 1c             	add    $0x1c,%esp
+  8026cd:	5b                   	pop    %ebx
+  8026ce:	5e                   	pop    %esi
+  8026cf:	5f                   	pop    %edi
+  8026d0:	5d                   	pop    %ebp
+  8026d1:	c3                   	ret
+  8026d2:	09 cb                	or     %ecx,%ebx
+  8026d4:	74 f4                	je     8026ca <__moddi3+0xba>
+  8026d6:	f7 df                	neg    %edi
+  8026d8:	bb 01 00 00 00       	mov    $0x1,%ebx
+  8026dd:	83 d5 00             	adc    $0x0,%ebp
+  8026e0:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  8026e4:	f7 dd                	neg    %ebp
+  8026e6:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  8026ea:	e9 58 ff ff ff       	jmp    802647 <__moddi3+0x37>
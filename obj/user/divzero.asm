@@ -0,0 +1,5258 @@
+
+obj/user/divzero.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 23 00 00 00       	call   800054 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+int zero;
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	zero = 0;
+  800039:	c7 05 08 40 80 00 00 	movl   $0x0,0x804008
+  800040:	00 00 00 
+	cprintf("1/0 is %08x!\n", 1/zero);
+  800043:	6a 00                	push   $0x0
+  800045:	68 00 25 80 00       	push   $0x802500
+  80004a:	e8 fd 00 00 00       	call   80014c <cprintf>
+}
+  80004f:	83 c4 10             	add    $0x10,%esp
+  800052:	c9                   	leave
+  800053:	c3                   	ret
+
+00800054 <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  800054:	55                   	push   %ebp
+  800055:	89 e5                	mov    %esp,%ebp
+  800057:	56                   	push   %esi
+  800058:	53                   	push   %ebx
+  800059:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80005c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  80005f:	e8 4f 0a 00 00       	call   800ab3 <sys_getenvid>
+  800064:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800069:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80006c:	c1 e0 04             	shl    $0x4,%eax
+  80006f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800074:	a3 0c 40 80 00       	mov    %eax,0x80400c
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800079:	85 db                	test   %ebx,%ebx
+  80007b:	7e 07                	jle    800084 <libmain+0x30>
+    binaryname = argv[0];
+  80007d:	8b 06                	mov    (%esi),%eax
+  80007f:	a3 00 30 80 00       	mov    %eax,0x803000
+
+  // call user main routine
+  umain(argc, argv);
+  800084:	83 ec 08             	sub    $0x8,%esp
+  800087:	56                   	push   %esi
+  800088:	53                   	push   %ebx
+  800089:	e8 a5 ff ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  80008e:	e8 0a 00 00 00       	call   80009d <exit>
+}
+  800093:	83 c4 10             	add    $0x10,%esp
+  800096:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800099:	5b                   	pop    %ebx
+  80009a:	5e                   	pop    %esi
+  80009b:	5d                   	pop    %ebp
+  80009c:	c3                   	ret
+
+0080009d <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80009d:	55                   	push   %ebp
+  80009e:	89 e5                	mov    %esp,%ebp
+  8000a0:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8000a3:	e8 f0 0e 00 00       	call   800f98 <close_all>
+	sys_env_destroy(0);
+  8000a8:	83 ec 0c             	sub    $0xc,%esp
+  8000ab:	6a 00                	push   $0x0
+  8000ad:	e8 c0 09 00 00       	call   800a72 <sys_env_destroy>
+}
+  8000b2:	83 c4 10             	add    $0x10,%esp
+  8000b5:	c9                   	leave
+  8000b6:	c3                   	ret
+
+008000b7 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8000b7:	55                   	push   %ebp
+  8000b8:	89 e5                	mov    %esp,%ebp
+  8000ba:	53                   	push   %ebx
+  8000bb:	83 ec 04             	sub    $0x4,%esp
+  8000be:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8000c1:	8b 13                	mov    (%ebx),%edx
+  8000c3:	8d 42 01             	lea    0x1(%edx),%eax
+  8000c6:	89 03                	mov    %eax,(%ebx)
+  8000c8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8000cb:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8000cf:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8000d4:	74 09                	je     8000df <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8000d6:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8000da:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000dd:	c9                   	leave
+  8000de:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8000df:	83 ec 08             	sub    $0x8,%esp
+  8000e2:	68 ff 00 00 00       	push   $0xff
+  8000e7:	8d 43 08             	lea    0x8(%ebx),%eax
+  8000ea:	50                   	push   %eax
+  8000eb:	e8 45 09 00 00       	call   800a35 <sys_cputs>
+		b->idx = 0;
+  8000f0:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8000f6:	83 c4 10             	add    $0x10,%esp
+  8000f9:	eb db                	jmp    8000d6 <putch+0x1f>
+
+008000fb <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8000fb:	55                   	push   %ebp
+  8000fc:	89 e5                	mov    %esp,%ebp
+  8000fe:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800104:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80010b:	00 00 00 
+	b.cnt = 0;
+  80010e:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800115:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800118:	ff 75 0c             	push   0xc(%ebp)
+  80011b:	ff 75 08             	push   0x8(%ebp)
+  80011e:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800124:	50                   	push   %eax
+  800125:	68 b7 00 80 00       	push   $0x8000b7
+  80012a:	e8 14 01 00 00       	call   800243 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80012f:	83 c4 08             	add    $0x8,%esp
+  800132:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800138:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80013e:	50                   	push   %eax
+  80013f:	e8 f1 08 00 00       	call   800a35 <sys_cputs>
+
+	return b.cnt;
+}
+  800144:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80014a:	c9                   	leave
+  80014b:	c3                   	ret
+
+0080014c <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80014c:	55                   	push   %ebp
+  80014d:	89 e5                	mov    %esp,%ebp
+  80014f:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800152:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800155:	50                   	push   %eax
+  800156:	ff 75 08             	push   0x8(%ebp)
+  800159:	e8 9d ff ff ff       	call   8000fb <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80015e:	c9                   	leave
+  80015f:	c3                   	ret
+
+00800160 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800160:	55                   	push   %ebp
+  800161:	89 e5                	mov    %esp,%ebp
+  800163:	57                   	push   %edi
+  800164:	56                   	push   %esi
+  800165:	53                   	push   %ebx
+  800166:	83 ec 1c             	sub    $0x1c,%esp
+  800169:	89 c7                	mov    %eax,%edi
+  80016b:	89 d6                	mov    %edx,%esi
+  80016d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800170:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800173:	89 d1                	mov    %edx,%ecx
+  800175:	89 c2                	mov    %eax,%edx
+  800177:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80017a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80017d:	8b 45 10             	mov    0x10(%ebp),%eax
+  800180:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800183:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800186:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80018d:	39 c2                	cmp    %eax,%edx
+  80018f:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800192:	72 3e                	jb     8001d2 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800194:	83 ec 0c             	sub    $0xc,%esp
+  800197:	ff 75 18             	push   0x18(%ebp)
+  80019a:	83 eb 01             	sub    $0x1,%ebx
+  80019d:	53                   	push   %ebx
+  80019e:	50                   	push   %eax
+  80019f:	83 ec 08             	sub    $0x8,%esp
+  8001a2:	ff 75 e4             	push   -0x1c(%ebp)
+  8001a5:	ff 75 e0             	push   -0x20(%ebp)
+  8001a8:	ff 75 dc             	push   -0x24(%ebp)
+  8001ab:	ff 75 d8             	push   -0x28(%ebp)
+  8001ae:	e8 bd 1f 00 00       	call   802170 <__udivdi3>
+  8001b3:	83 c4 18             	add    $0x18,%esp
+  8001b6:	52                   	push   %edx
+  8001b7:	50                   	push   %eax
+  8001b8:	89 f2                	mov    %esi,%edx
+  8001ba:	89 f8                	mov    %edi,%eax
+  8001bc:	e8 9f ff ff ff       	call   800160 <printnum>
+  8001c1:	83 c4 20             	add    $0x20,%esp
+  8001c4:	eb 13                	jmp    8001d9 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8001c6:	83 ec 08             	sub    $0x8,%esp
+  8001c9:	56                   	push   %esi
+  8001ca:	ff 75 18             	push   0x18(%ebp)
+  8001cd:	ff d7                	call   *%edi
+  8001cf:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8001d2:	83 eb 01             	sub    $0x1,%ebx
+  8001d5:	85 db                	test   %ebx,%ebx
+  8001d7:	7f ed                	jg     8001c6 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8001d9:	83 ec 08             	sub    $0x8,%esp
+  8001dc:	56                   	push   %esi
+  8001dd:	83 ec 04             	sub    $0x4,%esp
+  8001e0:	ff 75 e4             	push   -0x1c(%ebp)
+  8001e3:	ff 75 e0             	push   -0x20(%ebp)
+  8001e6:	ff 75 dc             	push   -0x24(%ebp)
+  8001e9:	ff 75 d8             	push   -0x28(%ebp)
+  8001ec:	e8 4f 20 00 00       	call   802240 <__umoddi3>
+  8001f1:	83 c4 14             	add    $0x14,%esp
+  8001f4:	0f be 80 18 25 80 00 	movsbl 0x802518(%eax),%eax
+  8001fb:	50                   	push   %eax
+  8001fc:	ff d7                	call   *%edi
+}
+  8001fe:	83 c4 10             	add    $0x10,%esp
+  800201:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800204:	5b                   	pop    %ebx
+  800205:	5e                   	pop    %esi
+  800206:	5f                   	pop    %edi
+  800207:	5d                   	pop    %ebp
+  800208:	c3                   	ret
+
+00800209 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800209:	55                   	push   %ebp
+  80020a:	89 e5                	mov    %esp,%ebp
+  80020c:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80020f:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800213:	8b 10                	mov    (%eax),%edx
+  800215:	3b 50 04             	cmp    0x4(%eax),%edx
+  800218:	73 0a                	jae    800224 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80021a:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80021d:	89 08                	mov    %ecx,(%eax)
+  80021f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800222:	88 02                	mov    %al,(%edx)
+}
+  800224:	5d                   	pop    %ebp
+  800225:	c3                   	ret
+
+00800226 <printfmt>:
+{
+  800226:	55                   	push   %ebp
+  800227:	89 e5                	mov    %esp,%ebp
+  800229:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80022c:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80022f:	50                   	push   %eax
+  800230:	ff 75 10             	push   0x10(%ebp)
+  800233:	ff 75 0c             	push   0xc(%ebp)
+  800236:	ff 75 08             	push   0x8(%ebp)
+  800239:	e8 05 00 00 00       	call   800243 <vprintfmt>
+}
+  80023e:	83 c4 10             	add    $0x10,%esp
+  800241:	c9                   	leave
+  800242:	c3                   	ret
+
+00800243 <vprintfmt>:
+{
+  800243:	55                   	push   %ebp
+  800244:	89 e5                	mov    %esp,%ebp
+  800246:	57                   	push   %edi
+  800247:	56                   	push   %esi
+  800248:	53                   	push   %ebx
+  800249:	83 ec 2c             	sub    $0x2c,%esp
+  80024c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80024f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800252:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800255:	eb 0a                	jmp    800261 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800257:	83 ec 08             	sub    $0x8,%esp
+  80025a:	53                   	push   %ebx
+  80025b:	50                   	push   %eax
+  80025c:	ff d6                	call   *%esi
+  80025e:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800261:	83 c7 01             	add    $0x1,%edi
+  800264:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800268:	83 f8 25             	cmp    $0x25,%eax
+  80026b:	74 0c                	je     800279 <vprintfmt+0x36>
+			if (ch == '\0')
+  80026d:	85 c0                	test   %eax,%eax
+  80026f:	75 e6                	jne    800257 <vprintfmt+0x14>
+}
+  800271:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800274:	5b                   	pop    %ebx
+  800275:	5e                   	pop    %esi
+  800276:	5f                   	pop    %edi
+  800277:	5d                   	pop    %ebp
+  800278:	c3                   	ret
+		padc = ' ';
+  800279:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80027d:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800284:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80028b:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800292:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800297:	8d 47 01             	lea    0x1(%edi),%eax
+  80029a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80029d:	0f b6 17             	movzbl (%edi),%edx
+  8002a0:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8002a3:	3c 55                	cmp    $0x55,%al
+  8002a5:	0f 87 9a 03 00 00    	ja     800645 <vprintfmt+0x402>
+  8002ab:	0f b6 c0             	movzbl %al,%eax
+  8002ae:	ff 24 85 60 26 80 00 	jmp    *0x802660(,%eax,4)
+  8002b5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8002b8:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8002bc:	eb d9                	jmp    800297 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8002be:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8002c1:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8002c5:	eb d0                	jmp    800297 <vprintfmt+0x54>
+  8002c7:	0f b6 d2             	movzbl %dl,%edx
+  8002ca:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8002cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002d2:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8002d5:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8002d8:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8002dc:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8002df:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8002e2:	83 f9 09             	cmp    $0x9,%ecx
+  8002e5:	77 55                	ja     80033c <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8002e7:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8002ea:	eb e9                	jmp    8002d5 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8002ec:	8b 45 14             	mov    0x14(%ebp),%eax
+  8002ef:	8b 00                	mov    (%eax),%eax
+  8002f1:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8002f4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8002f7:	8d 40 04             	lea    0x4(%eax),%eax
+  8002fa:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8002fd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800300:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800304:	79 91                	jns    800297 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800306:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800309:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80030c:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800313:	eb 82                	jmp    800297 <vprintfmt+0x54>
+			if (width < 0)
+  800315:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800318:	85 d2                	test   %edx,%edx
+  80031a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80031f:	0f 49 c2             	cmovns %edx,%eax
+  800322:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800325:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800328:	e9 6a ff ff ff       	jmp    800297 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80032d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800330:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800337:	e9 5b ff ff ff       	jmp    800297 <vprintfmt+0x54>
+  80033c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80033f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800342:	eb bc                	jmp    800300 <vprintfmt+0xbd>
+			lflag++;
+  800344:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800347:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80034a:	e9 48 ff ff ff       	jmp    800297 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80034f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800352:	8d 78 04             	lea    0x4(%eax),%edi
+  800355:	83 ec 08             	sub    $0x8,%esp
+  800358:	53                   	push   %ebx
+  800359:	ff 30                	push   (%eax)
+  80035b:	ff d6                	call   *%esi
+			break;
+  80035d:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800360:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800363:	e9 7c 02 00 00       	jmp    8005e4 <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  800368:	8b 45 14             	mov    0x14(%ebp),%eax
+  80036b:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80036e:	8b 10                	mov    (%eax),%edx
+  800370:	89 d0                	mov    %edx,%eax
+  800372:	f7 d8                	neg    %eax
+  800374:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800377:	83 f8 10             	cmp    $0x10,%eax
+  80037a:	7f 23                	jg     80039f <vprintfmt+0x15c>
+  80037c:	8b 14 85 c0 27 80 00 	mov    0x8027c0(,%eax,4),%edx
+  800383:	85 d2                	test   %edx,%edx
+  800385:	74 18                	je     80039f <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800387:	52                   	push   %edx
+  800388:	68 f9 28 80 00       	push   $0x8028f9
+  80038d:	53                   	push   %ebx
+  80038e:	56                   	push   %esi
+  80038f:	e8 92 fe ff ff       	call   800226 <printfmt>
+  800394:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800397:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80039a:	e9 45 02 00 00       	jmp    8005e4 <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  80039f:	50                   	push   %eax
+  8003a0:	68 30 25 80 00       	push   $0x802530
+  8003a5:	53                   	push   %ebx
+  8003a6:	56                   	push   %esi
+  8003a7:	e8 7a fe ff ff       	call   800226 <printfmt>
+  8003ac:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003af:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8003b2:	e9 2d 02 00 00       	jmp    8005e4 <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8003b7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003ba:	83 c0 04             	add    $0x4,%eax
+  8003bd:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8003c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003c3:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8003c5:	85 c9                	test   %ecx,%ecx
+  8003c7:	b8 29 25 80 00       	mov    $0x802529,%eax
+  8003cc:	0f 45 c1             	cmovne %ecx,%eax
+  8003cf:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8003d2:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003d6:	7e 06                	jle    8003de <vprintfmt+0x19b>
+  8003d8:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8003dc:	75 0b                	jne    8003e9 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8003de:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8003e1:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8003e4:	89 75 08             	mov    %esi,0x8(%ebp)
+  8003e7:	eb 5c                	jmp    800445 <vprintfmt+0x202>
+  8003e9:	83 ec 08             	sub    $0x8,%esp
+  8003ec:	ff 75 d0             	push   -0x30(%ebp)
+  8003ef:	ff 75 cc             	push   -0x34(%ebp)
+  8003f2:	e8 eb 02 00 00       	call   8006e2 <strnlen>
+  8003f7:	89 c2                	mov    %eax,%edx
+  8003f9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8003fc:	29 d0                	sub    %edx,%eax
+  8003fe:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800401:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800405:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800408:	89 75 08             	mov    %esi,0x8(%ebp)
+  80040b:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80040d:	eb 0e                	jmp    80041d <vprintfmt+0x1da>
+					putch(padc, putdat);
+  80040f:	83 ec 08             	sub    $0x8,%esp
+  800412:	53                   	push   %ebx
+  800413:	57                   	push   %edi
+  800414:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800417:	83 ee 01             	sub    $0x1,%esi
+  80041a:	83 c4 10             	add    $0x10,%esp
+  80041d:	85 f6                	test   %esi,%esi
+  80041f:	7f ee                	jg     80040f <vprintfmt+0x1cc>
+  800421:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800424:	8b 75 08             	mov    0x8(%ebp),%esi
+  800427:	85 c0                	test   %eax,%eax
+  800429:	ba 00 00 00 00       	mov    $0x0,%edx
+  80042e:	0f 49 d0             	cmovns %eax,%edx
+  800431:	29 d0                	sub    %edx,%eax
+  800433:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800436:	eb a6                	jmp    8003de <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800438:	83 ec 08             	sub    $0x8,%esp
+  80043b:	53                   	push   %ebx
+  80043c:	52                   	push   %edx
+  80043d:	ff 55 08             	call   *0x8(%ebp)
+  800440:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800443:	89 f1                	mov    %esi,%ecx
+  800445:	8d 71 01             	lea    0x1(%ecx),%esi
+  800448:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80044c:	0f be d0             	movsbl %al,%edx
+  80044f:	85 d2                	test   %edx,%edx
+  800451:	74 28                	je     80047b <vprintfmt+0x238>
+  800453:	85 ff                	test   %edi,%edi
+  800455:	78 05                	js     80045c <vprintfmt+0x219>
+  800457:	83 ef 01             	sub    $0x1,%edi
+  80045a:	78 30                	js     80048c <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80045c:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800460:	74 d6                	je     800438 <vprintfmt+0x1f5>
+  800462:	0f be c0             	movsbl %al,%eax
+  800465:	83 e8 20             	sub    $0x20,%eax
+  800468:	83 f8 5e             	cmp    $0x5e,%eax
+  80046b:	76 cb                	jbe    800438 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80046d:	83 ec 08             	sub    $0x8,%esp
+  800470:	53                   	push   %ebx
+  800471:	6a 3f                	push   $0x3f
+  800473:	ff 55 08             	call   *0x8(%ebp)
+  800476:	83 c4 10             	add    $0x10,%esp
+  800479:	eb c8                	jmp    800443 <vprintfmt+0x200>
+  80047b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80047e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800481:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800484:	01 d0                	add    %edx,%eax
+  800486:	29 c8                	sub    %ecx,%eax
+  800488:	89 c7                	mov    %eax,%edi
+  80048a:	eb 13                	jmp    80049f <vprintfmt+0x25c>
+  80048c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80048f:	eb ed                	jmp    80047e <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800491:	83 ec 08             	sub    $0x8,%esp
+  800494:	53                   	push   %ebx
+  800495:	6a 20                	push   $0x20
+  800497:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800499:	83 ef 01             	sub    $0x1,%edi
+  80049c:	83 c4 10             	add    $0x10,%esp
+  80049f:	85 ff                	test   %edi,%edi
+  8004a1:	7f ee                	jg     800491 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004a3:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8004a6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004a9:	e9 36 01 00 00       	jmp    8005e4 <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  8004ae:	83 f9 01             	cmp    $0x1,%ecx
+  8004b1:	7f 1f                	jg     8004d2 <vprintfmt+0x28f>
+	else if (lflag)
+  8004b3:	85 c9                	test   %ecx,%ecx
+  8004b5:	74 67                	je     80051e <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8004b7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004ba:	8b 00                	mov    (%eax),%eax
+  8004bc:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004bf:	89 c1                	mov    %eax,%ecx
+  8004c1:	c1 f9 1f             	sar    $0x1f,%ecx
+  8004c4:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8004c7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004ca:	8d 40 04             	lea    0x4(%eax),%eax
+  8004cd:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004d0:	eb 17                	jmp    8004e9 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8004d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004d5:	8b 50 04             	mov    0x4(%eax),%edx
+  8004d8:	8b 00                	mov    (%eax),%eax
+  8004da:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004dd:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8004e0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004e3:	8d 40 08             	lea    0x8(%eax),%eax
+  8004e6:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8004e9:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8004ec:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8004ef:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8004f4:	85 c9                	test   %ecx,%ecx
+  8004f6:	0f 89 ce 00 00 00    	jns    8005ca <vprintfmt+0x387>
+				putch('-', putdat);
+  8004fc:	83 ec 08             	sub    $0x8,%esp
+  8004ff:	53                   	push   %ebx
+  800500:	6a 2d                	push   $0x2d
+  800502:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800504:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800507:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80050a:	f7 da                	neg    %edx
+  80050c:	83 d1 00             	adc    $0x0,%ecx
+  80050f:	f7 d9                	neg    %ecx
+  800511:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800514:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800519:	e9 ac 00 00 00       	jmp    8005ca <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  80051e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800521:	8b 00                	mov    (%eax),%eax
+  800523:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800526:	89 c1                	mov    %eax,%ecx
+  800528:	c1 f9 1f             	sar    $0x1f,%ecx
+  80052b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80052e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800531:	8d 40 04             	lea    0x4(%eax),%eax
+  800534:	89 45 14             	mov    %eax,0x14(%ebp)
+  800537:	eb b0                	jmp    8004e9 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800539:	83 f9 01             	cmp    $0x1,%ecx
+  80053c:	7f 1b                	jg     800559 <vprintfmt+0x316>
+	else if (lflag)
+  80053e:	85 c9                	test   %ecx,%ecx
+  800540:	74 2c                	je     80056e <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  800542:	8b 45 14             	mov    0x14(%ebp),%eax
+  800545:	8b 10                	mov    (%eax),%edx
+  800547:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80054c:	8d 40 04             	lea    0x4(%eax),%eax
+  80054f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800552:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800557:	eb 71                	jmp    8005ca <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  800559:	8b 45 14             	mov    0x14(%ebp),%eax
+  80055c:	8b 10                	mov    (%eax),%edx
+  80055e:	8b 48 04             	mov    0x4(%eax),%ecx
+  800561:	8d 40 08             	lea    0x8(%eax),%eax
+  800564:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800567:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80056c:	eb 5c                	jmp    8005ca <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  80056e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800571:	8b 10                	mov    (%eax),%edx
+  800573:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800578:	8d 40 04             	lea    0x4(%eax),%eax
+  80057b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80057e:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800583:	eb 45                	jmp    8005ca <vprintfmt+0x387>
+			putch('X', putdat);
+  800585:	83 ec 08             	sub    $0x8,%esp
+  800588:	53                   	push   %ebx
+  800589:	6a 58                	push   $0x58
+  80058b:	ff d6                	call   *%esi
+			putch('X', putdat);
+  80058d:	83 c4 08             	add    $0x8,%esp
+  800590:	53                   	push   %ebx
+  800591:	6a 58                	push   $0x58
+  800593:	ff d6                	call   *%esi
+			putch('X', putdat);
+  800595:	83 c4 08             	add    $0x8,%esp
+  800598:	53                   	push   %ebx
+  800599:	6a 58                	push   $0x58
+  80059b:	ff d6                	call   *%esi
+			break;
+  80059d:	83 c4 10             	add    $0x10,%esp
+  8005a0:	eb 42                	jmp    8005e4 <vprintfmt+0x3a1>
+			putch('0', putdat);
+  8005a2:	83 ec 08             	sub    $0x8,%esp
+  8005a5:	53                   	push   %ebx
+  8005a6:	6a 30                	push   $0x30
+  8005a8:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8005aa:	83 c4 08             	add    $0x8,%esp
+  8005ad:	53                   	push   %ebx
+  8005ae:	6a 78                	push   $0x78
+  8005b0:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8005b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b5:	8b 10                	mov    (%eax),%edx
+  8005b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8005bc:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8005bf:	8d 40 04             	lea    0x4(%eax),%eax
+  8005c2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8005c5:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8005ca:	83 ec 0c             	sub    $0xc,%esp
+  8005cd:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8005d1:	50                   	push   %eax
+  8005d2:	ff 75 e0             	push   -0x20(%ebp)
+  8005d5:	57                   	push   %edi
+  8005d6:	51                   	push   %ecx
+  8005d7:	52                   	push   %edx
+  8005d8:	89 da                	mov    %ebx,%edx
+  8005da:	89 f0                	mov    %esi,%eax
+  8005dc:	e8 7f fb ff ff       	call   800160 <printnum>
+			break;
+  8005e1:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8005e4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8005e7:	e9 75 fc ff ff       	jmp    800261 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8005ec:	83 f9 01             	cmp    $0x1,%ecx
+  8005ef:	7f 1b                	jg     80060c <vprintfmt+0x3c9>
+	else if (lflag)
+  8005f1:	85 c9                	test   %ecx,%ecx
+  8005f3:	74 2c                	je     800621 <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  8005f5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f8:	8b 10                	mov    (%eax),%edx
+  8005fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005ff:	8d 40 04             	lea    0x4(%eax),%eax
+  800602:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800605:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  80060a:	eb be                	jmp    8005ca <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  80060c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060f:	8b 10                	mov    (%eax),%edx
+  800611:	8b 48 04             	mov    0x4(%eax),%ecx
+  800614:	8d 40 08             	lea    0x8(%eax),%eax
+  800617:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80061a:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80061f:	eb a9                	jmp    8005ca <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  800621:	8b 45 14             	mov    0x14(%ebp),%eax
+  800624:	8b 10                	mov    (%eax),%edx
+  800626:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80062b:	8d 40 04             	lea    0x4(%eax),%eax
+  80062e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800631:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800636:	eb 92                	jmp    8005ca <vprintfmt+0x387>
+			putch(ch, putdat);
+  800638:	83 ec 08             	sub    $0x8,%esp
+  80063b:	53                   	push   %ebx
+  80063c:	6a 25                	push   $0x25
+  80063e:	ff d6                	call   *%esi
+			break;
+  800640:	83 c4 10             	add    $0x10,%esp
+  800643:	eb 9f                	jmp    8005e4 <vprintfmt+0x3a1>
+			putch('%', putdat);
+  800645:	83 ec 08             	sub    $0x8,%esp
+  800648:	53                   	push   %ebx
+  800649:	6a 25                	push   $0x25
+  80064b:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80064d:	83 c4 10             	add    $0x10,%esp
+  800650:	89 f8                	mov    %edi,%eax
+  800652:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800656:	74 05                	je     80065d <vprintfmt+0x41a>
+  800658:	83 e8 01             	sub    $0x1,%eax
+  80065b:	eb f5                	jmp    800652 <vprintfmt+0x40f>
+  80065d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800660:	eb 82                	jmp    8005e4 <vprintfmt+0x3a1>
+
+00800662 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800662:	55                   	push   %ebp
+  800663:	89 e5                	mov    %esp,%ebp
+  800665:	83 ec 18             	sub    $0x18,%esp
+  800668:	8b 45 08             	mov    0x8(%ebp),%eax
+  80066b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80066e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800671:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800675:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800678:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80067f:	85 c0                	test   %eax,%eax
+  800681:	74 26                	je     8006a9 <vsnprintf+0x47>
+  800683:	85 d2                	test   %edx,%edx
+  800685:	7e 22                	jle    8006a9 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800687:	ff 75 14             	push   0x14(%ebp)
+  80068a:	ff 75 10             	push   0x10(%ebp)
+  80068d:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800690:	50                   	push   %eax
+  800691:	68 09 02 80 00       	push   $0x800209
+  800696:	e8 a8 fb ff ff       	call   800243 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80069b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80069e:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8006a1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8006a4:	83 c4 10             	add    $0x10,%esp
+}
+  8006a7:	c9                   	leave
+  8006a8:	c3                   	ret
+		return -E_INVAL;
+  8006a9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006ae:	eb f7                	jmp    8006a7 <vsnprintf+0x45>
+
+008006b0 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8006b0:	55                   	push   %ebp
+  8006b1:	89 e5                	mov    %esp,%ebp
+  8006b3:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8006b6:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8006b9:	50                   	push   %eax
+  8006ba:	ff 75 10             	push   0x10(%ebp)
+  8006bd:	ff 75 0c             	push   0xc(%ebp)
+  8006c0:	ff 75 08             	push   0x8(%ebp)
+  8006c3:	e8 9a ff ff ff       	call   800662 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8006c8:	c9                   	leave
+  8006c9:	c3                   	ret
+
+008006ca <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8006ca:	55                   	push   %ebp
+  8006cb:	89 e5                	mov    %esp,%ebp
+  8006cd:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8006d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006d5:	eb 03                	jmp    8006da <strlen+0x10>
+		n++;
+  8006d7:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8006da:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8006de:	75 f7                	jne    8006d7 <strlen+0xd>
+	return n;
+}
+  8006e0:	5d                   	pop    %ebp
+  8006e1:	c3                   	ret
+
+008006e2 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8006e2:	55                   	push   %ebp
+  8006e3:	89 e5                	mov    %esp,%ebp
+  8006e5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8006e8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8006eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006f0:	eb 03                	jmp    8006f5 <strnlen+0x13>
+		n++;
+  8006f2:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8006f5:	39 d0                	cmp    %edx,%eax
+  8006f7:	74 08                	je     800701 <strnlen+0x1f>
+  8006f9:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8006fd:	75 f3                	jne    8006f2 <strnlen+0x10>
+  8006ff:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800701:	89 d0                	mov    %edx,%eax
+  800703:	5d                   	pop    %ebp
+  800704:	c3                   	ret
+
+00800705 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800705:	55                   	push   %ebp
+  800706:	89 e5                	mov    %esp,%ebp
+  800708:	53                   	push   %ebx
+  800709:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80070c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80070f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800714:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800718:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80071b:	83 c0 01             	add    $0x1,%eax
+  80071e:	84 d2                	test   %dl,%dl
+  800720:	75 f2                	jne    800714 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800722:	89 c8                	mov    %ecx,%eax
+  800724:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800727:	c9                   	leave
+  800728:	c3                   	ret
+
+00800729 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800729:	55                   	push   %ebp
+  80072a:	89 e5                	mov    %esp,%ebp
+  80072c:	53                   	push   %ebx
+  80072d:	83 ec 10             	sub    $0x10,%esp
+  800730:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800733:	53                   	push   %ebx
+  800734:	e8 91 ff ff ff       	call   8006ca <strlen>
+  800739:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80073c:	ff 75 0c             	push   0xc(%ebp)
+  80073f:	01 d8                	add    %ebx,%eax
+  800741:	50                   	push   %eax
+  800742:	e8 be ff ff ff       	call   800705 <strcpy>
+	return dst;
+}
+  800747:	89 d8                	mov    %ebx,%eax
+  800749:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80074c:	c9                   	leave
+  80074d:	c3                   	ret
+
+0080074e <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80074e:	55                   	push   %ebp
+  80074f:	89 e5                	mov    %esp,%ebp
+  800751:	56                   	push   %esi
+  800752:	53                   	push   %ebx
+  800753:	8b 75 08             	mov    0x8(%ebp),%esi
+  800756:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800759:	89 f3                	mov    %esi,%ebx
+  80075b:	03 5d 10             	add    0x10(%ebp),%ebx
+  80075e:	89 f0                	mov    %esi,%eax
+  800760:	eb 0f                	jmp    800771 <strncpy+0x23>
+		*dst++ = *src;
+  800762:	83 c0 01             	add    $0x1,%eax
+  800765:	0f b6 0a             	movzbl (%edx),%ecx
+  800768:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80076b:	80 f9 01             	cmp    $0x1,%cl
+  80076e:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800771:	39 d8                	cmp    %ebx,%eax
+  800773:	75 ed                	jne    800762 <strncpy+0x14>
+	}
+	return ret;
+}
+  800775:	89 f0                	mov    %esi,%eax
+  800777:	5b                   	pop    %ebx
+  800778:	5e                   	pop    %esi
+  800779:	5d                   	pop    %ebp
+  80077a:	c3                   	ret
+
+0080077b <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80077b:	55                   	push   %ebp
+  80077c:	89 e5                	mov    %esp,%ebp
+  80077e:	56                   	push   %esi
+  80077f:	53                   	push   %ebx
+  800780:	8b 75 08             	mov    0x8(%ebp),%esi
+  800783:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800786:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800789:	89 f0                	mov    %esi,%eax
+  80078b:	85 d2                	test   %edx,%edx
+  80078d:	74 21                	je     8007b0 <strlcpy+0x35>
+  80078f:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800793:	89 f2                	mov    %esi,%edx
+  800795:	eb 09                	jmp    8007a0 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800797:	83 c1 01             	add    $0x1,%ecx
+  80079a:	83 c2 01             	add    $0x1,%edx
+  80079d:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8007a0:	39 c2                	cmp    %eax,%edx
+  8007a2:	74 09                	je     8007ad <strlcpy+0x32>
+  8007a4:	0f b6 19             	movzbl (%ecx),%ebx
+  8007a7:	84 db                	test   %bl,%bl
+  8007a9:	75 ec                	jne    800797 <strlcpy+0x1c>
+  8007ab:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8007ad:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8007b0:	29 f0                	sub    %esi,%eax
+}
+  8007b2:	5b                   	pop    %ebx
+  8007b3:	5e                   	pop    %esi
+  8007b4:	5d                   	pop    %ebp
+  8007b5:	c3                   	ret
+
+008007b6 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8007b6:	55                   	push   %ebp
+  8007b7:	89 e5                	mov    %esp,%ebp
+  8007b9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007bc:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8007bf:	eb 06                	jmp    8007c7 <strcmp+0x11>
+		p++, q++;
+  8007c1:	83 c1 01             	add    $0x1,%ecx
+  8007c4:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8007c7:	0f b6 01             	movzbl (%ecx),%eax
+  8007ca:	84 c0                	test   %al,%al
+  8007cc:	74 04                	je     8007d2 <strcmp+0x1c>
+  8007ce:	3a 02                	cmp    (%edx),%al
+  8007d0:	74 ef                	je     8007c1 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8007d2:	0f b6 c0             	movzbl %al,%eax
+  8007d5:	0f b6 12             	movzbl (%edx),%edx
+  8007d8:	29 d0                	sub    %edx,%eax
+}
+  8007da:	5d                   	pop    %ebp
+  8007db:	c3                   	ret
+
+008007dc <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8007dc:	55                   	push   %ebp
+  8007dd:	89 e5                	mov    %esp,%ebp
+  8007df:	53                   	push   %ebx
+  8007e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007e3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007e6:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8007e9:	eb 09                	jmp    8007f4 <strncmp+0x18>
+		n--, p++, q++;
+  8007eb:	83 ea 01             	sub    $0x1,%edx
+  8007ee:	83 c0 01             	add    $0x1,%eax
+  8007f1:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8007f4:	85 d2                	test   %edx,%edx
+  8007f6:	74 18                	je     800810 <strncmp+0x34>
+  8007f8:	0f b6 18             	movzbl (%eax),%ebx
+  8007fb:	84 db                	test   %bl,%bl
+  8007fd:	74 04                	je     800803 <strncmp+0x27>
+  8007ff:	3a 19                	cmp    (%ecx),%bl
+  800801:	74 e8                	je     8007eb <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800803:	0f b6 00             	movzbl (%eax),%eax
+  800806:	0f b6 11             	movzbl (%ecx),%edx
+  800809:	29 d0                	sub    %edx,%eax
+}
+  80080b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80080e:	c9                   	leave
+  80080f:	c3                   	ret
+		return 0;
+  800810:	b8 00 00 00 00       	mov    $0x0,%eax
+  800815:	eb f4                	jmp    80080b <strncmp+0x2f>
+
+00800817 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800817:	55                   	push   %ebp
+  800818:	89 e5                	mov    %esp,%ebp
+  80081a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80081d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800821:	eb 03                	jmp    800826 <strchr+0xf>
+  800823:	83 c0 01             	add    $0x1,%eax
+  800826:	0f b6 10             	movzbl (%eax),%edx
+  800829:	84 d2                	test   %dl,%dl
+  80082b:	74 06                	je     800833 <strchr+0x1c>
+		if (*s == c)
+  80082d:	38 ca                	cmp    %cl,%dl
+  80082f:	75 f2                	jne    800823 <strchr+0xc>
+  800831:	eb 05                	jmp    800838 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800833:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800838:	5d                   	pop    %ebp
+  800839:	c3                   	ret
+
+0080083a <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80083a:	55                   	push   %ebp
+  80083b:	89 e5                	mov    %esp,%ebp
+  80083d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800840:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800844:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800847:	38 ca                	cmp    %cl,%dl
+  800849:	74 09                	je     800854 <strfind+0x1a>
+  80084b:	84 d2                	test   %dl,%dl
+  80084d:	74 05                	je     800854 <strfind+0x1a>
+	for (; *s; s++)
+  80084f:	83 c0 01             	add    $0x1,%eax
+  800852:	eb f0                	jmp    800844 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800854:	5d                   	pop    %ebp
+  800855:	c3                   	ret
+
+00800856 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800856:	55                   	push   %ebp
+  800857:	89 e5                	mov    %esp,%ebp
+  800859:	57                   	push   %edi
+  80085a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80085d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800860:	85 c9                	test   %ecx,%ecx
+  800862:	74 20                	je     800884 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800864:	89 f8                	mov    %edi,%eax
+  800866:	09 c8                	or     %ecx,%eax
+  800868:	a8 03                	test   $0x3,%al
+  80086a:	75 12                	jne    80087e <memset+0x28>
+		c &= 0xFF;
+  80086c:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800870:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800876:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800879:	fc                   	cld
+  80087a:	f3 ab                	rep stos %eax,%es:(%edi)
+  80087c:	eb 06                	jmp    800884 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80087e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800881:	fc                   	cld
+  800882:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800884:	89 f8                	mov    %edi,%eax
+  800886:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800889:	c9                   	leave
+  80088a:	c3                   	ret
+
+0080088b <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  80088b:	55                   	push   %ebp
+  80088c:	89 e5                	mov    %esp,%ebp
+  80088e:	57                   	push   %edi
+  80088f:	56                   	push   %esi
+  800890:	8b 45 08             	mov    0x8(%ebp),%eax
+  800893:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800896:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800899:	39 c6                	cmp    %eax,%esi
+  80089b:	73 32                	jae    8008cf <memmove+0x44>
+  80089d:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8008a0:	39 d0                	cmp    %edx,%eax
+  8008a2:	73 2b                	jae    8008cf <memmove+0x44>
+		s += n;
+		d += n;
+  8008a4:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8008a7:	89 d6                	mov    %edx,%esi
+  8008a9:	09 fe                	or     %edi,%esi
+  8008ab:	09 ce                	or     %ecx,%esi
+  8008ad:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8008b3:	75 0e                	jne    8008c3 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8008b5:	83 ef 04             	sub    $0x4,%edi
+  8008b8:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8008bb:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8008be:	fd                   	std
+  8008bf:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8008c1:	eb 09                	jmp    8008cc <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8008c3:	83 ef 01             	sub    $0x1,%edi
+  8008c6:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8008c9:	fd                   	std
+  8008ca:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8008cc:	fc                   	cld
+  8008cd:	eb 1a                	jmp    8008e9 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8008cf:	89 f2                	mov    %esi,%edx
+  8008d1:	09 c2                	or     %eax,%edx
+  8008d3:	09 ca                	or     %ecx,%edx
+  8008d5:	f6 c2 03             	test   $0x3,%dl
+  8008d8:	75 0a                	jne    8008e4 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8008da:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8008dd:	89 c7                	mov    %eax,%edi
+  8008df:	fc                   	cld
+  8008e0:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8008e2:	eb 05                	jmp    8008e9 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8008e4:	89 c7                	mov    %eax,%edi
+  8008e6:	fc                   	cld
+  8008e7:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8008e9:	5e                   	pop    %esi
+  8008ea:	5f                   	pop    %edi
+  8008eb:	5d                   	pop    %ebp
+  8008ec:	c3                   	ret
+
+008008ed <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8008ed:	55                   	push   %ebp
+  8008ee:	89 e5                	mov    %esp,%ebp
+  8008f0:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8008f3:	ff 75 10             	push   0x10(%ebp)
+  8008f6:	ff 75 0c             	push   0xc(%ebp)
+  8008f9:	ff 75 08             	push   0x8(%ebp)
+  8008fc:	e8 8a ff ff ff       	call   80088b <memmove>
+}
+  800901:	c9                   	leave
+  800902:	c3                   	ret
+
+00800903 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800903:	55                   	push   %ebp
+  800904:	89 e5                	mov    %esp,%ebp
+  800906:	56                   	push   %esi
+  800907:	53                   	push   %ebx
+  800908:	8b 45 08             	mov    0x8(%ebp),%eax
+  80090b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  80090e:	89 c6                	mov    %eax,%esi
+  800910:	03 75 10             	add    0x10(%ebp),%esi
+  800913:	eb 06                	jmp    80091b <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800915:	83 c0 01             	add    $0x1,%eax
+  800918:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  80091b:	39 f0                	cmp    %esi,%eax
+  80091d:	74 14                	je     800933 <memcmp+0x30>
+		if (*s1 != *s2)
+  80091f:	0f b6 08             	movzbl (%eax),%ecx
+  800922:	0f b6 1a             	movzbl (%edx),%ebx
+  800925:	38 d9                	cmp    %bl,%cl
+  800927:	74 ec                	je     800915 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800929:	0f b6 c1             	movzbl %cl,%eax
+  80092c:	0f b6 db             	movzbl %bl,%ebx
+  80092f:	29 d8                	sub    %ebx,%eax
+  800931:	eb 05                	jmp    800938 <memcmp+0x35>
+	}
+
+	return 0;
+  800933:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800938:	5b                   	pop    %ebx
+  800939:	5e                   	pop    %esi
+  80093a:	5d                   	pop    %ebp
+  80093b:	c3                   	ret
+
+0080093c <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  80093c:	55                   	push   %ebp
+  80093d:	89 e5                	mov    %esp,%ebp
+  80093f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800942:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800945:	89 c2                	mov    %eax,%edx
+  800947:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  80094a:	eb 03                	jmp    80094f <memfind+0x13>
+  80094c:	83 c0 01             	add    $0x1,%eax
+  80094f:	39 d0                	cmp    %edx,%eax
+  800951:	73 04                	jae    800957 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800953:	38 08                	cmp    %cl,(%eax)
+  800955:	75 f5                	jne    80094c <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800957:	5d                   	pop    %ebp
+  800958:	c3                   	ret
+
+00800959 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800959:	55                   	push   %ebp
+  80095a:	89 e5                	mov    %esp,%ebp
+  80095c:	57                   	push   %edi
+  80095d:	56                   	push   %esi
+  80095e:	53                   	push   %ebx
+  80095f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800962:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800965:	eb 03                	jmp    80096a <strtol+0x11>
+		s++;
+  800967:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  80096a:	0f b6 02             	movzbl (%edx),%eax
+  80096d:	3c 20                	cmp    $0x20,%al
+  80096f:	74 f6                	je     800967 <strtol+0xe>
+  800971:	3c 09                	cmp    $0x9,%al
+  800973:	74 f2                	je     800967 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800975:	3c 2b                	cmp    $0x2b,%al
+  800977:	74 2a                	je     8009a3 <strtol+0x4a>
+	int neg = 0;
+  800979:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  80097e:	3c 2d                	cmp    $0x2d,%al
+  800980:	74 2b                	je     8009ad <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800982:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800988:	75 0f                	jne    800999 <strtol+0x40>
+  80098a:	80 3a 30             	cmpb   $0x30,(%edx)
+  80098d:	74 28                	je     8009b7 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  80098f:	85 db                	test   %ebx,%ebx
+  800991:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800996:	0f 44 d8             	cmove  %eax,%ebx
+  800999:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80099e:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8009a1:	eb 46                	jmp    8009e9 <strtol+0x90>
+		s++;
+  8009a3:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  8009a6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009ab:	eb d5                	jmp    800982 <strtol+0x29>
+		s++, neg = 1;
+  8009ad:	83 c2 01             	add    $0x1,%edx
+  8009b0:	bf 01 00 00 00       	mov    $0x1,%edi
+  8009b5:	eb cb                	jmp    800982 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009b7:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8009bb:	74 0e                	je     8009cb <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  8009bd:	85 db                	test   %ebx,%ebx
+  8009bf:	75 d8                	jne    800999 <strtol+0x40>
+		s++, base = 8;
+  8009c1:	83 c2 01             	add    $0x1,%edx
+  8009c4:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8009c9:	eb ce                	jmp    800999 <strtol+0x40>
+		s += 2, base = 16;
+  8009cb:	83 c2 02             	add    $0x2,%edx
+  8009ce:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8009d3:	eb c4                	jmp    800999 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  8009d5:	0f be c0             	movsbl %al,%eax
+  8009d8:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  8009db:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8009de:	7d 3a                	jge    800a1a <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  8009e0:	83 c2 01             	add    $0x1,%edx
+  8009e3:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  8009e7:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  8009e9:	0f b6 02             	movzbl (%edx),%eax
+  8009ec:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8009ef:	89 f3                	mov    %esi,%ebx
+  8009f1:	80 fb 09             	cmp    $0x9,%bl
+  8009f4:	76 df                	jbe    8009d5 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  8009f6:	8d 70 9f             	lea    -0x61(%eax),%esi
+  8009f9:	89 f3                	mov    %esi,%ebx
+  8009fb:	80 fb 19             	cmp    $0x19,%bl
+  8009fe:	77 08                	ja     800a08 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800a00:	0f be c0             	movsbl %al,%eax
+  800a03:	83 e8 57             	sub    $0x57,%eax
+  800a06:	eb d3                	jmp    8009db <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800a08:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800a0b:	89 f3                	mov    %esi,%ebx
+  800a0d:	80 fb 19             	cmp    $0x19,%bl
+  800a10:	77 08                	ja     800a1a <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800a12:	0f be c0             	movsbl %al,%eax
+  800a15:	83 e8 37             	sub    $0x37,%eax
+  800a18:	eb c1                	jmp    8009db <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800a1a:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800a1e:	74 05                	je     800a25 <strtol+0xcc>
+		*endptr = (char *) s;
+  800a20:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a23:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800a25:	89 c8                	mov    %ecx,%eax
+  800a27:	f7 d8                	neg    %eax
+  800a29:	85 ff                	test   %edi,%edi
+  800a2b:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800a2e:	89 c8                	mov    %ecx,%eax
+  800a30:	5b                   	pop    %ebx
+  800a31:	5e                   	pop    %esi
+  800a32:	5f                   	pop    %edi
+  800a33:	5d                   	pop    %ebp
+  800a34:	c3                   	ret
+
+00800a35 <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800a35:	55                   	push   %ebp
+  800a36:	89 e5                	mov    %esp,%ebp
+  800a38:	57                   	push   %edi
+  800a39:	56                   	push   %esi
+  800a3a:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800a3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a40:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a43:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a46:	89 c3                	mov    %eax,%ebx
+  800a48:	89 c7                	mov    %eax,%edi
+  800a4a:	89 c6                	mov    %eax,%esi
+  800a4c:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  800a4e:	5b                   	pop    %ebx
+  800a4f:	5e                   	pop    %esi
+  800a50:	5f                   	pop    %edi
+  800a51:	5d                   	pop    %ebp
+  800a52:	c3                   	ret
+
+00800a53 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800a53:	55                   	push   %ebp
+  800a54:	89 e5                	mov    %esp,%ebp
+  800a56:	57                   	push   %edi
+  800a57:	56                   	push   %esi
+  800a58:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800a59:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a5e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800a63:	89 d1                	mov    %edx,%ecx
+  800a65:	89 d3                	mov    %edx,%ebx
+  800a67:	89 d7                	mov    %edx,%edi
+  800a69:	89 d6                	mov    %edx,%esi
+  800a6b:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800a6d:	5b                   	pop    %ebx
+  800a6e:	5e                   	pop    %esi
+  800a6f:	5f                   	pop    %edi
+  800a70:	5d                   	pop    %ebp
+  800a71:	c3                   	ret
+
+00800a72 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800a72:	55                   	push   %ebp
+  800a73:	89 e5                	mov    %esp,%ebp
+  800a75:	57                   	push   %edi
+  800a76:	56                   	push   %esi
+  800a77:	53                   	push   %ebx
+  800a78:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800a7b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a80:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a83:	b8 03 00 00 00       	mov    $0x3,%eax
+  800a88:	89 cb                	mov    %ecx,%ebx
+  800a8a:	89 cf                	mov    %ecx,%edi
+  800a8c:	89 ce                	mov    %ecx,%esi
+  800a8e:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800a90:	85 c0                	test   %eax,%eax
+  800a92:	7f 08                	jg     800a9c <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800a94:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a97:	5b                   	pop    %ebx
+  800a98:	5e                   	pop    %esi
+  800a99:	5f                   	pop    %edi
+  800a9a:	5d                   	pop    %ebp
+  800a9b:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800a9c:	83 ec 0c             	sub    $0xc,%esp
+  800a9f:	50                   	push   %eax
+  800aa0:	6a 03                	push   $0x3
+  800aa2:	68 23 28 80 00       	push   $0x802823
+  800aa7:	6a 3e                	push   $0x3e
+  800aa9:	68 40 28 80 00       	push   $0x802840
+  800aae:	e8 22 14 00 00       	call   801ed5 <_panic>
+
+00800ab3 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800ab3:	55                   	push   %ebp
+  800ab4:	89 e5                	mov    %esp,%ebp
+  800ab6:	57                   	push   %edi
+  800ab7:	56                   	push   %esi
+  800ab8:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800ab9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800abe:	b8 02 00 00 00       	mov    $0x2,%eax
+  800ac3:	89 d1                	mov    %edx,%ecx
+  800ac5:	89 d3                	mov    %edx,%ebx
+  800ac7:	89 d7                	mov    %edx,%edi
+  800ac9:	89 d6                	mov    %edx,%esi
+  800acb:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800acd:	5b                   	pop    %ebx
+  800ace:	5e                   	pop    %esi
+  800acf:	5f                   	pop    %edi
+  800ad0:	5d                   	pop    %ebp
+  800ad1:	c3                   	ret
+
+00800ad2 <sys_yield>:
+
+void
+sys_yield(void) {
+  800ad2:	55                   	push   %ebp
+  800ad3:	89 e5                	mov    %esp,%ebp
+  800ad5:	57                   	push   %edi
+  800ad6:	56                   	push   %esi
+  800ad7:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800ad8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800add:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800ae2:	89 d1                	mov    %edx,%ecx
+  800ae4:	89 d3                	mov    %edx,%ebx
+  800ae6:	89 d7                	mov    %edx,%edi
+  800ae8:	89 d6                	mov    %edx,%esi
+  800aea:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800aec:	5b                   	pop    %ebx
+  800aed:	5e                   	pop    %esi
+  800aee:	5f                   	pop    %edi
+  800aef:	5d                   	pop    %ebp
+  800af0:	c3                   	ret
+
+00800af1 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  800af1:	55                   	push   %ebp
+  800af2:	89 e5                	mov    %esp,%ebp
+  800af4:	57                   	push   %edi
+  800af5:	56                   	push   %esi
+  800af6:	53                   	push   %ebx
+  800af7:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800afa:	be 00 00 00 00       	mov    $0x0,%esi
+  800aff:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b02:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b05:	b8 04 00 00 00       	mov    $0x4,%eax
+  800b0a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b0d:	89 f7                	mov    %esi,%edi
+  800b0f:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800b11:	85 c0                	test   %eax,%eax
+  800b13:	7f 08                	jg     800b1d <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800b15:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b18:	5b                   	pop    %ebx
+  800b19:	5e                   	pop    %esi
+  800b1a:	5f                   	pop    %edi
+  800b1b:	5d                   	pop    %ebp
+  800b1c:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800b1d:	83 ec 0c             	sub    $0xc,%esp
+  800b20:	50                   	push   %eax
+  800b21:	6a 04                	push   $0x4
+  800b23:	68 23 28 80 00       	push   $0x802823
+  800b28:	6a 3e                	push   $0x3e
+  800b2a:	68 40 28 80 00       	push   $0x802840
+  800b2f:	e8 a1 13 00 00       	call   801ed5 <_panic>
+
+00800b34 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  800b34:	55                   	push   %ebp
+  800b35:	89 e5                	mov    %esp,%ebp
+  800b37:	57                   	push   %edi
+  800b38:	56                   	push   %esi
+  800b39:	53                   	push   %ebx
+  800b3a:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800b3d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b40:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b43:	b8 05 00 00 00       	mov    $0x5,%eax
+  800b48:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b4b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800b4e:	8b 75 18             	mov    0x18(%ebp),%esi
+  800b51:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800b53:	85 c0                	test   %eax,%eax
+  800b55:	7f 08                	jg     800b5f <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800b57:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b5a:	5b                   	pop    %ebx
+  800b5b:	5e                   	pop    %esi
+  800b5c:	5f                   	pop    %edi
+  800b5d:	5d                   	pop    %ebp
+  800b5e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800b5f:	83 ec 0c             	sub    $0xc,%esp
+  800b62:	50                   	push   %eax
+  800b63:	6a 05                	push   $0x5
+  800b65:	68 23 28 80 00       	push   $0x802823
+  800b6a:	6a 3e                	push   $0x3e
+  800b6c:	68 40 28 80 00       	push   $0x802840
+  800b71:	e8 5f 13 00 00       	call   801ed5 <_panic>
+
+00800b76 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  800b76:	55                   	push   %ebp
+  800b77:	89 e5                	mov    %esp,%ebp
+  800b79:	57                   	push   %edi
+  800b7a:	56                   	push   %esi
+  800b7b:	53                   	push   %ebx
+  800b7c:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800b7f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b84:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b87:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b8a:	b8 06 00 00 00       	mov    $0x6,%eax
+  800b8f:	89 df                	mov    %ebx,%edi
+  800b91:	89 de                	mov    %ebx,%esi
+  800b93:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800b95:	85 c0                	test   %eax,%eax
+  800b97:	7f 08                	jg     800ba1 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800b99:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b9c:	5b                   	pop    %ebx
+  800b9d:	5e                   	pop    %esi
+  800b9e:	5f                   	pop    %edi
+  800b9f:	5d                   	pop    %ebp
+  800ba0:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ba1:	83 ec 0c             	sub    $0xc,%esp
+  800ba4:	50                   	push   %eax
+  800ba5:	6a 06                	push   $0x6
+  800ba7:	68 23 28 80 00       	push   $0x802823
+  800bac:	6a 3e                	push   $0x3e
+  800bae:	68 40 28 80 00       	push   $0x802840
+  800bb3:	e8 1d 13 00 00       	call   801ed5 <_panic>
+
+00800bb8 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800bb8:	55                   	push   %ebp
+  800bb9:	89 e5                	mov    %esp,%ebp
+  800bbb:	57                   	push   %edi
+  800bbc:	56                   	push   %esi
+  800bbd:	53                   	push   %ebx
+  800bbe:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800bc1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800bc6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bc9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bcc:	b8 08 00 00 00       	mov    $0x8,%eax
+  800bd1:	89 df                	mov    %ebx,%edi
+  800bd3:	89 de                	mov    %ebx,%esi
+  800bd5:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800bd7:	85 c0                	test   %eax,%eax
+  800bd9:	7f 08                	jg     800be3 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800bdb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bde:	5b                   	pop    %ebx
+  800bdf:	5e                   	pop    %esi
+  800be0:	5f                   	pop    %edi
+  800be1:	5d                   	pop    %ebp
+  800be2:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800be3:	83 ec 0c             	sub    $0xc,%esp
+  800be6:	50                   	push   %eax
+  800be7:	6a 08                	push   $0x8
+  800be9:	68 23 28 80 00       	push   $0x802823
+  800bee:	6a 3e                	push   $0x3e
+  800bf0:	68 40 28 80 00       	push   $0x802840
+  800bf5:	e8 db 12 00 00       	call   801ed5 <_panic>
+
+00800bfa <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800bfa:	55                   	push   %ebp
+  800bfb:	89 e5                	mov    %esp,%ebp
+  800bfd:	57                   	push   %edi
+  800bfe:	56                   	push   %esi
+  800bff:	53                   	push   %ebx
+  800c00:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c03:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c08:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c0b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c0e:	b8 09 00 00 00       	mov    $0x9,%eax
+  800c13:	89 df                	mov    %ebx,%edi
+  800c15:	89 de                	mov    %ebx,%esi
+  800c17:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c19:	85 c0                	test   %eax,%eax
+  800c1b:	7f 08                	jg     800c25 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800c1d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c20:	5b                   	pop    %ebx
+  800c21:	5e                   	pop    %esi
+  800c22:	5f                   	pop    %edi
+  800c23:	5d                   	pop    %ebp
+  800c24:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c25:	83 ec 0c             	sub    $0xc,%esp
+  800c28:	50                   	push   %eax
+  800c29:	6a 09                	push   $0x9
+  800c2b:	68 23 28 80 00       	push   $0x802823
+  800c30:	6a 3e                	push   $0x3e
+  800c32:	68 40 28 80 00       	push   $0x802840
+  800c37:	e8 99 12 00 00       	call   801ed5 <_panic>
+
+00800c3c <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800c3c:	55                   	push   %ebp
+  800c3d:	89 e5                	mov    %esp,%ebp
+  800c3f:	57                   	push   %edi
+  800c40:	56                   	push   %esi
+  800c41:	53                   	push   %ebx
+  800c42:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c45:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c4a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c4d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c50:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c55:	89 df                	mov    %ebx,%edi
+  800c57:	89 de                	mov    %ebx,%esi
+  800c59:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c5b:	85 c0                	test   %eax,%eax
+  800c5d:	7f 08                	jg     800c67 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800c5f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c62:	5b                   	pop    %ebx
+  800c63:	5e                   	pop    %esi
+  800c64:	5f                   	pop    %edi
+  800c65:	5d                   	pop    %ebp
+  800c66:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c67:	83 ec 0c             	sub    $0xc,%esp
+  800c6a:	50                   	push   %eax
+  800c6b:	6a 0a                	push   $0xa
+  800c6d:	68 23 28 80 00       	push   $0x802823
+  800c72:	6a 3e                	push   $0x3e
+  800c74:	68 40 28 80 00       	push   $0x802840
+  800c79:	e8 57 12 00 00       	call   801ed5 <_panic>
+
+00800c7e <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  800c7e:	55                   	push   %ebp
+  800c7f:	89 e5                	mov    %esp,%ebp
+  800c81:	57                   	push   %edi
+  800c82:	56                   	push   %esi
+  800c83:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800c84:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c87:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c8a:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800c8f:	be 00 00 00 00       	mov    $0x0,%esi
+  800c94:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c97:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c9a:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800c9c:	5b                   	pop    %ebx
+  800c9d:	5e                   	pop    %esi
+  800c9e:	5f                   	pop    %edi
+  800c9f:	5d                   	pop    %ebp
+  800ca0:	c3                   	ret
+
+00800ca1 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  800ca1:	55                   	push   %ebp
+  800ca2:	89 e5                	mov    %esp,%ebp
+  800ca4:	57                   	push   %edi
+  800ca5:	56                   	push   %esi
+  800ca6:	53                   	push   %ebx
+  800ca7:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800caa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800caf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cb2:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800cb7:	89 cb                	mov    %ecx,%ebx
+  800cb9:	89 cf                	mov    %ecx,%edi
+  800cbb:	89 ce                	mov    %ecx,%esi
+  800cbd:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800cbf:	85 c0                	test   %eax,%eax
+  800cc1:	7f 08                	jg     800ccb <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  800cc3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cc6:	5b                   	pop    %ebx
+  800cc7:	5e                   	pop    %esi
+  800cc8:	5f                   	pop    %edi
+  800cc9:	5d                   	pop    %ebp
+  800cca:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ccb:	83 ec 0c             	sub    $0xc,%esp
+  800cce:	50                   	push   %eax
+  800ccf:	6a 0d                	push   $0xd
+  800cd1:	68 23 28 80 00       	push   $0x802823
+  800cd6:	6a 3e                	push   $0x3e
+  800cd8:	68 40 28 80 00       	push   $0x802840
+  800cdd:	e8 f3 11 00 00       	call   801ed5 <_panic>
+
+00800ce2 <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  800ce2:	55                   	push   %ebp
+  800ce3:	89 e5                	mov    %esp,%ebp
+  800ce5:	57                   	push   %edi
+  800ce6:	56                   	push   %esi
+  800ce7:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800ce8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ced:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cf0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cf3:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800cf8:	89 df                	mov    %ebx,%edi
+  800cfa:	89 de                	mov    %ebx,%esi
+  800cfc:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  800cfe:	5b                   	pop    %ebx
+  800cff:	5e                   	pop    %esi
+  800d00:	5f                   	pop    %edi
+  800d01:	5d                   	pop    %ebp
+  800d02:	c3                   	ret
+
+00800d03 <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  800d03:	55                   	push   %ebp
+  800d04:	89 e5                	mov    %esp,%ebp
+  800d06:	57                   	push   %edi
+  800d07:	56                   	push   %esi
+  800d08:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d09:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d0e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d11:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800d16:	89 cb                	mov    %ecx,%ebx
+  800d18:	89 cf                	mov    %ecx,%edi
+  800d1a:	89 ce                	mov    %ecx,%esi
+  800d1c:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  800d1e:	5b                   	pop    %ebx
+  800d1f:	5e                   	pop    %esi
+  800d20:	5f                   	pop    %edi
+  800d21:	5d                   	pop    %ebp
+  800d22:	c3                   	ret
+
+00800d23 <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  800d23:	55                   	push   %ebp
+  800d24:	89 e5                	mov    %esp,%ebp
+  800d26:	57                   	push   %edi
+  800d27:	56                   	push   %esi
+  800d28:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d29:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d2e:	b8 10 00 00 00       	mov    $0x10,%eax
+  800d33:	89 d1                	mov    %edx,%ecx
+  800d35:	89 d3                	mov    %edx,%ebx
+  800d37:	89 d7                	mov    %edx,%edi
+  800d39:	89 d6                	mov    %edx,%esi
+  800d3b:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800d3d:	5b                   	pop    %ebx
+  800d3e:	5e                   	pop    %esi
+  800d3f:	5f                   	pop    %edi
+  800d40:	5d                   	pop    %ebp
+  800d41:	c3                   	ret
+
+00800d42 <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  800d42:	55                   	push   %ebp
+  800d43:	89 e5                	mov    %esp,%ebp
+  800d45:	57                   	push   %edi
+  800d46:	56                   	push   %esi
+  800d47:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d48:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d4d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d50:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d53:	b8 11 00 00 00       	mov    $0x11,%eax
+  800d58:	89 df                	mov    %ebx,%edi
+  800d5a:	89 de                	mov    %ebx,%esi
+  800d5c:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800d5e:	5b                   	pop    %ebx
+  800d5f:	5e                   	pop    %esi
+  800d60:	5f                   	pop    %edi
+  800d61:	5d                   	pop    %ebp
+  800d62:	c3                   	ret
+
+00800d63 <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  800d63:	55                   	push   %ebp
+  800d64:	89 e5                	mov    %esp,%ebp
+  800d66:	57                   	push   %edi
+  800d67:	56                   	push   %esi
+  800d68:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d69:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d6e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d71:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d74:	b8 12 00 00 00       	mov    $0x12,%eax
+  800d79:	89 df                	mov    %ebx,%edi
+  800d7b:	89 de                	mov    %ebx,%esi
+  800d7d:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800d7f:	5b                   	pop    %ebx
+  800d80:	5e                   	pop    %esi
+  800d81:	5f                   	pop    %edi
+  800d82:	5d                   	pop    %ebp
+  800d83:	c3                   	ret
+
+00800d84 <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  800d84:	55                   	push   %ebp
+  800d85:	89 e5                	mov    %esp,%ebp
+  800d87:	57                   	push   %edi
+  800d88:	56                   	push   %esi
+  800d89:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d8a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d8f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d92:	b8 13 00 00 00       	mov    $0x13,%eax
+  800d97:	89 cb                	mov    %ecx,%ebx
+  800d99:	89 cf                	mov    %ecx,%edi
+  800d9b:	89 ce                	mov    %ecx,%esi
+  800d9d:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  800d9f:	5b                   	pop    %ebx
+  800da0:	5e                   	pop    %esi
+  800da1:	5f                   	pop    %edi
+  800da2:	5d                   	pop    %ebp
+  800da3:	c3                   	ret
+
+00800da4 <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  800da4:	55                   	push   %ebp
+  800da5:	89 e5                	mov    %esp,%ebp
+  800da7:	57                   	push   %edi
+  800da8:	56                   	push   %esi
+  800da9:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800daa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800daf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800db2:	b8 14 00 00 00       	mov    $0x14,%eax
+  800db7:	89 cb                	mov    %ecx,%ebx
+  800db9:	89 cf                	mov    %ecx,%edi
+  800dbb:	89 ce                	mov    %ecx,%esi
+  800dbd:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  800dbf:	5b                   	pop    %ebx
+  800dc0:	5e                   	pop    %esi
+  800dc1:	5f                   	pop    %edi
+  800dc2:	5d                   	pop    %ebp
+  800dc3:	c3                   	ret
+
+00800dc4 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800dc4:	55                   	push   %ebp
+  800dc5:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800dc7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dca:	05 00 00 00 30       	add    $0x30000000,%eax
+  800dcf:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800dd2:	5d                   	pop    %ebp
+  800dd3:	c3                   	ret
+
+00800dd4 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800dd4:	55                   	push   %ebp
+  800dd5:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800dd7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dda:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800ddf:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800de4:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800de9:	5d                   	pop    %ebp
+  800dea:	c3                   	ret
+
+00800deb <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800deb:	55                   	push   %ebp
+  800dec:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  800dee:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800df3:	eb 02                	jmp    800df7 <fd_alloc+0xc>
+  800df5:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800df7:	89 c2                	mov    %eax,%edx
+  800df9:	c1 ea 16             	shr    $0x16,%edx
+  800dfc:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800e03:	f6 c2 01             	test   $0x1,%dl
+  800e06:	74 2b                	je     800e33 <fd_alloc+0x48>
+  800e08:	89 c2                	mov    %eax,%edx
+  800e0a:	c1 ea 0c             	shr    $0xc,%edx
+  800e0d:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  800e14:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  800e1a:	f6 c1 01             	test   $0x1,%cl
+  800e1d:	74 14                	je     800e33 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  800e1f:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  800e25:	75 ce                	jne    800df5 <fd_alloc+0xa>
+  800e27:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  800e2c:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800e31:	eb 05                	jmp    800e38 <fd_alloc+0x4d>
+			return 0;
+  800e33:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  800e38:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e3b:	89 02                	mov    %eax,(%edx)
+}
+  800e3d:	89 c8                	mov    %ecx,%eax
+  800e3f:	5d                   	pop    %ebp
+  800e40:	c3                   	ret
+
+00800e41 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  800e41:	55                   	push   %ebp
+  800e42:	89 e5                	mov    %esp,%ebp
+  800e44:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  800e47:	83 f8 1f             	cmp    $0x1f,%eax
+  800e4a:	77 30                	ja     800e7c <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  800e4c:	c1 e0 0c             	shl    $0xc,%eax
+  800e4f:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800e54:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  800e5a:	f6 c2 01             	test   $0x1,%dl
+  800e5d:	74 24                	je     800e83 <fd_lookup+0x42>
+  800e5f:	89 c2                	mov    %eax,%edx
+  800e61:	c1 ea 0c             	shr    $0xc,%edx
+  800e64:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800e6b:	f6 c2 01             	test   $0x1,%dl
+  800e6e:	74 1a                	je     800e8a <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  800e70:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800e73:	89 02                	mov    %eax,(%edx)
+	return 0;
+  800e75:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e7a:	5d                   	pop    %ebp
+  800e7b:	c3                   	ret
+		return -E_INVAL;
+  800e7c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e81:	eb f7                	jmp    800e7a <fd_lookup+0x39>
+		return -E_INVAL;
+  800e83:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e88:	eb f0                	jmp    800e7a <fd_lookup+0x39>
+  800e8a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e8f:	eb e9                	jmp    800e7a <fd_lookup+0x39>
+
+00800e91 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  800e91:	55                   	push   %ebp
+  800e92:	89 e5                	mov    %esp,%ebp
+  800e94:	53                   	push   %ebx
+  800e95:	83 ec 04             	sub    $0x4,%esp
+  800e98:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  800e9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ea0:	eb 03                	jmp    800ea5 <dev_lookup+0x14>
+  800ea2:	83 c0 01             	add    $0x1,%eax
+  800ea5:	8b 1c 85 cc 28 80 00 	mov    0x8028cc(,%eax,4),%ebx
+  800eac:	85 db                	test   %ebx,%ebx
+  800eae:	74 0b                	je     800ebb <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  800eb0:	39 13                	cmp    %edx,(%ebx)
+  800eb2:	75 ee                	jne    800ea2 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  800eb4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800eb9:	eb 1f                	jmp    800eda <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800ebb:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  800ec0:	8b 40 48             	mov    0x48(%eax),%eax
+  800ec3:	83 ec 04             	sub    $0x4,%esp
+  800ec6:	52                   	push   %edx
+  800ec7:	50                   	push   %eax
+  800ec8:	68 50 28 80 00       	push   $0x802850
+  800ecd:	e8 7a f2 ff ff       	call   80014c <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  800ed2:	83 c4 10             	add    $0x10,%esp
+  800ed5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  800eda:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800edd:	89 1a                	mov    %ebx,(%edx)
+}
+  800edf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ee2:	c9                   	leave
+  800ee3:	c3                   	ret
+
+00800ee4 <fd_close>:
+{
+  800ee4:	55                   	push   %ebp
+  800ee5:	89 e5                	mov    %esp,%ebp
+  800ee7:	57                   	push   %edi
+  800ee8:	56                   	push   %esi
+  800ee9:	53                   	push   %ebx
+  800eea:	83 ec 24             	sub    $0x24,%esp
+  800eed:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ef0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800ef3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800ef6:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800ef7:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800efd:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800f00:	50                   	push   %eax
+  800f01:	e8 3b ff ff ff       	call   800e41 <fd_lookup>
+  800f06:	89 c3                	mov    %eax,%ebx
+  800f08:	83 c4 10             	add    $0x10,%esp
+  800f0b:	85 c0                	test   %eax,%eax
+  800f0d:	78 05                	js     800f14 <fd_close+0x30>
+	    || fd != fd2)
+  800f0f:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  800f12:	74 16                	je     800f2a <fd_close+0x46>
+		return (must_exist ? r : 0);
+  800f14:	89 f8                	mov    %edi,%eax
+  800f16:	84 c0                	test   %al,%al
+  800f18:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f1d:	0f 44 d8             	cmove  %eax,%ebx
+}
+  800f20:	89 d8                	mov    %ebx,%eax
+  800f22:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f25:	5b                   	pop    %ebx
+  800f26:	5e                   	pop    %esi
+  800f27:	5f                   	pop    %edi
+  800f28:	5d                   	pop    %ebp
+  800f29:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800f2a:	83 ec 08             	sub    $0x8,%esp
+  800f2d:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800f30:	50                   	push   %eax
+  800f31:	ff 36                	push   (%esi)
+  800f33:	e8 59 ff ff ff       	call   800e91 <dev_lookup>
+  800f38:	89 c3                	mov    %eax,%ebx
+  800f3a:	83 c4 10             	add    $0x10,%esp
+  800f3d:	85 c0                	test   %eax,%eax
+  800f3f:	78 1a                	js     800f5b <fd_close+0x77>
+		if (dev->dev_close)
+  800f41:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800f44:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  800f47:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  800f4c:	85 c0                	test   %eax,%eax
+  800f4e:	74 0b                	je     800f5b <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  800f50:	83 ec 0c             	sub    $0xc,%esp
+  800f53:	56                   	push   %esi
+  800f54:	ff d0                	call   *%eax
+  800f56:	89 c3                	mov    %eax,%ebx
+  800f58:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  800f5b:	83 ec 08             	sub    $0x8,%esp
+  800f5e:	56                   	push   %esi
+  800f5f:	6a 00                	push   $0x0
+  800f61:	e8 10 fc ff ff       	call   800b76 <sys_page_unmap>
+	return r;
+  800f66:	83 c4 10             	add    $0x10,%esp
+  800f69:	eb b5                	jmp    800f20 <fd_close+0x3c>
+
+00800f6b <close>:
+
+int
+close(int fdnum)
+{
+  800f6b:	55                   	push   %ebp
+  800f6c:	89 e5                	mov    %esp,%ebp
+  800f6e:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800f71:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800f74:	50                   	push   %eax
+  800f75:	ff 75 08             	push   0x8(%ebp)
+  800f78:	e8 c4 fe ff ff       	call   800e41 <fd_lookup>
+  800f7d:	83 c4 10             	add    $0x10,%esp
+  800f80:	85 c0                	test   %eax,%eax
+  800f82:	79 02                	jns    800f86 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  800f84:	c9                   	leave
+  800f85:	c3                   	ret
+		return fd_close(fd, 1);
+  800f86:	83 ec 08             	sub    $0x8,%esp
+  800f89:	6a 01                	push   $0x1
+  800f8b:	ff 75 f4             	push   -0xc(%ebp)
+  800f8e:	e8 51 ff ff ff       	call   800ee4 <fd_close>
+  800f93:	83 c4 10             	add    $0x10,%esp
+  800f96:	eb ec                	jmp    800f84 <close+0x19>
+
+00800f98 <close_all>:
+
+void
+close_all(void)
+{
+  800f98:	55                   	push   %ebp
+  800f99:	89 e5                	mov    %esp,%ebp
+  800f9b:	53                   	push   %ebx
+  800f9c:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  800f9f:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  800fa4:	83 ec 0c             	sub    $0xc,%esp
+  800fa7:	53                   	push   %ebx
+  800fa8:	e8 be ff ff ff       	call   800f6b <close>
+	for (i = 0; i < MAXFD; i++)
+  800fad:	83 c3 01             	add    $0x1,%ebx
+  800fb0:	83 c4 10             	add    $0x10,%esp
+  800fb3:	83 fb 20             	cmp    $0x20,%ebx
+  800fb6:	75 ec                	jne    800fa4 <close_all+0xc>
+}
+  800fb8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800fbb:	c9                   	leave
+  800fbc:	c3                   	ret
+
+00800fbd <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  800fbd:	55                   	push   %ebp
+  800fbe:	89 e5                	mov    %esp,%ebp
+  800fc0:	57                   	push   %edi
+  800fc1:	56                   	push   %esi
+  800fc2:	53                   	push   %ebx
+  800fc3:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800fc6:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800fc9:	50                   	push   %eax
+  800fca:	ff 75 08             	push   0x8(%ebp)
+  800fcd:	e8 6f fe ff ff       	call   800e41 <fd_lookup>
+  800fd2:	89 c3                	mov    %eax,%ebx
+  800fd4:	83 c4 10             	add    $0x10,%esp
+  800fd7:	85 c0                	test   %eax,%eax
+  800fd9:	78 7f                	js     80105a <dup+0x9d>
+		return r;
+	close(newfdnum);
+  800fdb:	83 ec 0c             	sub    $0xc,%esp
+  800fde:	ff 75 0c             	push   0xc(%ebp)
+  800fe1:	e8 85 ff ff ff       	call   800f6b <close>
+
+	newfd = INDEX2FD(newfdnum);
+  800fe6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800fe9:	c1 e6 0c             	shl    $0xc,%esi
+  800fec:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  800ff2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800ff5:	89 3c 24             	mov    %edi,(%esp)
+  800ff8:	e8 d7 fd ff ff       	call   800dd4 <fd2data>
+  800ffd:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  800fff:	89 34 24             	mov    %esi,(%esp)
+  801002:	e8 cd fd ff ff       	call   800dd4 <fd2data>
+  801007:	83 c4 10             	add    $0x10,%esp
+  80100a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80100d:	89 d8                	mov    %ebx,%eax
+  80100f:	c1 e8 16             	shr    $0x16,%eax
+  801012:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801019:	a8 01                	test   $0x1,%al
+  80101b:	74 11                	je     80102e <dup+0x71>
+  80101d:	89 d8                	mov    %ebx,%eax
+  80101f:	c1 e8 0c             	shr    $0xc,%eax
+  801022:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801029:	f6 c2 01             	test   $0x1,%dl
+  80102c:	75 36                	jne    801064 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80102e:	89 f8                	mov    %edi,%eax
+  801030:	c1 e8 0c             	shr    $0xc,%eax
+  801033:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80103a:	83 ec 0c             	sub    $0xc,%esp
+  80103d:	25 07 0e 00 00       	and    $0xe07,%eax
+  801042:	50                   	push   %eax
+  801043:	56                   	push   %esi
+  801044:	6a 00                	push   $0x0
+  801046:	57                   	push   %edi
+  801047:	6a 00                	push   $0x0
+  801049:	e8 e6 fa ff ff       	call   800b34 <sys_page_map>
+  80104e:	89 c3                	mov    %eax,%ebx
+  801050:	83 c4 20             	add    $0x20,%esp
+  801053:	85 c0                	test   %eax,%eax
+  801055:	78 33                	js     80108a <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801057:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80105a:	89 d8                	mov    %ebx,%eax
+  80105c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80105f:	5b                   	pop    %ebx
+  801060:	5e                   	pop    %esi
+  801061:	5f                   	pop    %edi
+  801062:	5d                   	pop    %ebp
+  801063:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801064:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80106b:	83 ec 0c             	sub    $0xc,%esp
+  80106e:	25 07 0e 00 00       	and    $0xe07,%eax
+  801073:	50                   	push   %eax
+  801074:	ff 75 d4             	push   -0x2c(%ebp)
+  801077:	6a 00                	push   $0x0
+  801079:	53                   	push   %ebx
+  80107a:	6a 00                	push   $0x0
+  80107c:	e8 b3 fa ff ff       	call   800b34 <sys_page_map>
+  801081:	89 c3                	mov    %eax,%ebx
+  801083:	83 c4 20             	add    $0x20,%esp
+  801086:	85 c0                	test   %eax,%eax
+  801088:	79 a4                	jns    80102e <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80108a:	83 ec 08             	sub    $0x8,%esp
+  80108d:	56                   	push   %esi
+  80108e:	6a 00                	push   $0x0
+  801090:	e8 e1 fa ff ff       	call   800b76 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801095:	83 c4 08             	add    $0x8,%esp
+  801098:	ff 75 d4             	push   -0x2c(%ebp)
+  80109b:	6a 00                	push   $0x0
+  80109d:	e8 d4 fa ff ff       	call   800b76 <sys_page_unmap>
+	return r;
+  8010a2:	83 c4 10             	add    $0x10,%esp
+  8010a5:	eb b3                	jmp    80105a <dup+0x9d>
+
+008010a7 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8010a7:	55                   	push   %ebp
+  8010a8:	89 e5                	mov    %esp,%ebp
+  8010aa:	56                   	push   %esi
+  8010ab:	53                   	push   %ebx
+  8010ac:	83 ec 18             	sub    $0x18,%esp
+  8010af:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8010b2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8010b5:	50                   	push   %eax
+  8010b6:	56                   	push   %esi
+  8010b7:	e8 85 fd ff ff       	call   800e41 <fd_lookup>
+  8010bc:	83 c4 10             	add    $0x10,%esp
+  8010bf:	85 c0                	test   %eax,%eax
+  8010c1:	78 3c                	js     8010ff <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8010c3:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8010c6:	83 ec 08             	sub    $0x8,%esp
+  8010c9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8010cc:	50                   	push   %eax
+  8010cd:	ff 33                	push   (%ebx)
+  8010cf:	e8 bd fd ff ff       	call   800e91 <dev_lookup>
+  8010d4:	83 c4 10             	add    $0x10,%esp
+  8010d7:	85 c0                	test   %eax,%eax
+  8010d9:	78 24                	js     8010ff <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8010db:	8b 43 08             	mov    0x8(%ebx),%eax
+  8010de:	83 e0 03             	and    $0x3,%eax
+  8010e1:	83 f8 01             	cmp    $0x1,%eax
+  8010e4:	74 20                	je     801106 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8010e6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8010e9:	8b 40 08             	mov    0x8(%eax),%eax
+  8010ec:	85 c0                	test   %eax,%eax
+  8010ee:	74 37                	je     801127 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8010f0:	83 ec 04             	sub    $0x4,%esp
+  8010f3:	ff 75 10             	push   0x10(%ebp)
+  8010f6:	ff 75 0c             	push   0xc(%ebp)
+  8010f9:	53                   	push   %ebx
+  8010fa:	ff d0                	call   *%eax
+  8010fc:	83 c4 10             	add    $0x10,%esp
+}
+  8010ff:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801102:	5b                   	pop    %ebx
+  801103:	5e                   	pop    %esi
+  801104:	5d                   	pop    %ebp
+  801105:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801106:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  80110b:	8b 40 48             	mov    0x48(%eax),%eax
+  80110e:	83 ec 04             	sub    $0x4,%esp
+  801111:	56                   	push   %esi
+  801112:	50                   	push   %eax
+  801113:	68 91 28 80 00       	push   $0x802891
+  801118:	e8 2f f0 ff ff       	call   80014c <cprintf>
+		return -E_INVAL;
+  80111d:	83 c4 10             	add    $0x10,%esp
+  801120:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801125:	eb d8                	jmp    8010ff <read+0x58>
+		return -E_NOT_SUPP;
+  801127:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80112c:	eb d1                	jmp    8010ff <read+0x58>
+
+0080112e <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80112e:	55                   	push   %ebp
+  80112f:	89 e5                	mov    %esp,%ebp
+  801131:	57                   	push   %edi
+  801132:	56                   	push   %esi
+  801133:	53                   	push   %ebx
+  801134:	83 ec 0c             	sub    $0xc,%esp
+  801137:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80113a:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80113d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801142:	eb 02                	jmp    801146 <readn+0x18>
+  801144:	01 c3                	add    %eax,%ebx
+  801146:	39 f3                	cmp    %esi,%ebx
+  801148:	73 21                	jae    80116b <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80114a:	83 ec 04             	sub    $0x4,%esp
+  80114d:	89 f0                	mov    %esi,%eax
+  80114f:	29 d8                	sub    %ebx,%eax
+  801151:	50                   	push   %eax
+  801152:	89 d8                	mov    %ebx,%eax
+  801154:	03 45 0c             	add    0xc(%ebp),%eax
+  801157:	50                   	push   %eax
+  801158:	57                   	push   %edi
+  801159:	e8 49 ff ff ff       	call   8010a7 <read>
+		if (m < 0)
+  80115e:	83 c4 10             	add    $0x10,%esp
+  801161:	85 c0                	test   %eax,%eax
+  801163:	78 04                	js     801169 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801165:	75 dd                	jne    801144 <readn+0x16>
+  801167:	eb 02                	jmp    80116b <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801169:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80116b:	89 d8                	mov    %ebx,%eax
+  80116d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801170:	5b                   	pop    %ebx
+  801171:	5e                   	pop    %esi
+  801172:	5f                   	pop    %edi
+  801173:	5d                   	pop    %ebp
+  801174:	c3                   	ret
+
+00801175 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801175:	55                   	push   %ebp
+  801176:	89 e5                	mov    %esp,%ebp
+  801178:	56                   	push   %esi
+  801179:	53                   	push   %ebx
+  80117a:	83 ec 18             	sub    $0x18,%esp
+  80117d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801180:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801183:	50                   	push   %eax
+  801184:	53                   	push   %ebx
+  801185:	e8 b7 fc ff ff       	call   800e41 <fd_lookup>
+  80118a:	83 c4 10             	add    $0x10,%esp
+  80118d:	85 c0                	test   %eax,%eax
+  80118f:	78 37                	js     8011c8 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801191:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801194:	83 ec 08             	sub    $0x8,%esp
+  801197:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80119a:	50                   	push   %eax
+  80119b:	ff 36                	push   (%esi)
+  80119d:	e8 ef fc ff ff       	call   800e91 <dev_lookup>
+  8011a2:	83 c4 10             	add    $0x10,%esp
+  8011a5:	85 c0                	test   %eax,%eax
+  8011a7:	78 1f                	js     8011c8 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8011a9:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8011ad:	74 20                	je     8011cf <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8011af:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8011b2:	8b 40 0c             	mov    0xc(%eax),%eax
+  8011b5:	85 c0                	test   %eax,%eax
+  8011b7:	74 37                	je     8011f0 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8011b9:	83 ec 04             	sub    $0x4,%esp
+  8011bc:	ff 75 10             	push   0x10(%ebp)
+  8011bf:	ff 75 0c             	push   0xc(%ebp)
+  8011c2:	56                   	push   %esi
+  8011c3:	ff d0                	call   *%eax
+  8011c5:	83 c4 10             	add    $0x10,%esp
+}
+  8011c8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8011cb:	5b                   	pop    %ebx
+  8011cc:	5e                   	pop    %esi
+  8011cd:	5d                   	pop    %ebp
+  8011ce:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8011cf:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  8011d4:	8b 40 48             	mov    0x48(%eax),%eax
+  8011d7:	83 ec 04             	sub    $0x4,%esp
+  8011da:	53                   	push   %ebx
+  8011db:	50                   	push   %eax
+  8011dc:	68 ad 28 80 00       	push   $0x8028ad
+  8011e1:	e8 66 ef ff ff       	call   80014c <cprintf>
+		return -E_INVAL;
+  8011e6:	83 c4 10             	add    $0x10,%esp
+  8011e9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011ee:	eb d8                	jmp    8011c8 <write+0x53>
+		return -E_NOT_SUPP;
+  8011f0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8011f5:	eb d1                	jmp    8011c8 <write+0x53>
+
+008011f7 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8011f7:	55                   	push   %ebp
+  8011f8:	89 e5                	mov    %esp,%ebp
+  8011fa:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8011fd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801200:	50                   	push   %eax
+  801201:	ff 75 08             	push   0x8(%ebp)
+  801204:	e8 38 fc ff ff       	call   800e41 <fd_lookup>
+  801209:	83 c4 10             	add    $0x10,%esp
+  80120c:	85 c0                	test   %eax,%eax
+  80120e:	78 0e                	js     80121e <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801210:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801213:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801216:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801219:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80121e:	c9                   	leave
+  80121f:	c3                   	ret
+
+00801220 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801220:	55                   	push   %ebp
+  801221:	89 e5                	mov    %esp,%ebp
+  801223:	56                   	push   %esi
+  801224:	53                   	push   %ebx
+  801225:	83 ec 18             	sub    $0x18,%esp
+  801228:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80122b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80122e:	50                   	push   %eax
+  80122f:	53                   	push   %ebx
+  801230:	e8 0c fc ff ff       	call   800e41 <fd_lookup>
+  801235:	83 c4 10             	add    $0x10,%esp
+  801238:	85 c0                	test   %eax,%eax
+  80123a:	78 34                	js     801270 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80123c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80123f:	83 ec 08             	sub    $0x8,%esp
+  801242:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801245:	50                   	push   %eax
+  801246:	ff 36                	push   (%esi)
+  801248:	e8 44 fc ff ff       	call   800e91 <dev_lookup>
+  80124d:	83 c4 10             	add    $0x10,%esp
+  801250:	85 c0                	test   %eax,%eax
+  801252:	78 1c                	js     801270 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801254:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801258:	74 1d                	je     801277 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80125a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80125d:	8b 40 18             	mov    0x18(%eax),%eax
+  801260:	85 c0                	test   %eax,%eax
+  801262:	74 34                	je     801298 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801264:	83 ec 08             	sub    $0x8,%esp
+  801267:	ff 75 0c             	push   0xc(%ebp)
+  80126a:	56                   	push   %esi
+  80126b:	ff d0                	call   *%eax
+  80126d:	83 c4 10             	add    $0x10,%esp
+}
+  801270:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801273:	5b                   	pop    %ebx
+  801274:	5e                   	pop    %esi
+  801275:	5d                   	pop    %ebp
+  801276:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801277:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  80127c:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80127f:	83 ec 04             	sub    $0x4,%esp
+  801282:	53                   	push   %ebx
+  801283:	50                   	push   %eax
+  801284:	68 70 28 80 00       	push   $0x802870
+  801289:	e8 be ee ff ff       	call   80014c <cprintf>
+		return -E_INVAL;
+  80128e:	83 c4 10             	add    $0x10,%esp
+  801291:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801296:	eb d8                	jmp    801270 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801298:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80129d:	eb d1                	jmp    801270 <ftruncate+0x50>
+
+0080129f <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80129f:	55                   	push   %ebp
+  8012a0:	89 e5                	mov    %esp,%ebp
+  8012a2:	56                   	push   %esi
+  8012a3:	53                   	push   %ebx
+  8012a4:	83 ec 18             	sub    $0x18,%esp
+  8012a7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8012aa:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8012ad:	50                   	push   %eax
+  8012ae:	ff 75 08             	push   0x8(%ebp)
+  8012b1:	e8 8b fb ff ff       	call   800e41 <fd_lookup>
+  8012b6:	83 c4 10             	add    $0x10,%esp
+  8012b9:	85 c0                	test   %eax,%eax
+  8012bb:	78 49                	js     801306 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8012bd:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8012c0:	83 ec 08             	sub    $0x8,%esp
+  8012c3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8012c6:	50                   	push   %eax
+  8012c7:	ff 36                	push   (%esi)
+  8012c9:	e8 c3 fb ff ff       	call   800e91 <dev_lookup>
+  8012ce:	83 c4 10             	add    $0x10,%esp
+  8012d1:	85 c0                	test   %eax,%eax
+  8012d3:	78 31                	js     801306 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8012d5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8012d8:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8012dc:	74 2f                	je     80130d <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8012de:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8012e1:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8012e8:	00 00 00 
+	stat->st_isdir = 0;
+  8012eb:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8012f2:	00 00 00 
+	stat->st_dev = dev;
+  8012f5:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8012fb:	83 ec 08             	sub    $0x8,%esp
+  8012fe:	53                   	push   %ebx
+  8012ff:	56                   	push   %esi
+  801300:	ff 50 14             	call   *0x14(%eax)
+  801303:	83 c4 10             	add    $0x10,%esp
+}
+  801306:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801309:	5b                   	pop    %ebx
+  80130a:	5e                   	pop    %esi
+  80130b:	5d                   	pop    %ebp
+  80130c:	c3                   	ret
+		return -E_NOT_SUPP;
+  80130d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801312:	eb f2                	jmp    801306 <fstat+0x67>
+
+00801314 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801314:	55                   	push   %ebp
+  801315:	89 e5                	mov    %esp,%ebp
+  801317:	56                   	push   %esi
+  801318:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801319:	83 ec 08             	sub    $0x8,%esp
+  80131c:	6a 00                	push   $0x0
+  80131e:	ff 75 08             	push   0x8(%ebp)
+  801321:	e8 e4 01 00 00       	call   80150a <open>
+  801326:	89 c3                	mov    %eax,%ebx
+  801328:	83 c4 10             	add    $0x10,%esp
+  80132b:	85 c0                	test   %eax,%eax
+  80132d:	78 1b                	js     80134a <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80132f:	83 ec 08             	sub    $0x8,%esp
+  801332:	ff 75 0c             	push   0xc(%ebp)
+  801335:	50                   	push   %eax
+  801336:	e8 64 ff ff ff       	call   80129f <fstat>
+  80133b:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80133d:	89 1c 24             	mov    %ebx,(%esp)
+  801340:	e8 26 fc ff ff       	call   800f6b <close>
+	return r;
+  801345:	83 c4 10             	add    $0x10,%esp
+  801348:	89 f3                	mov    %esi,%ebx
+}
+  80134a:	89 d8                	mov    %ebx,%eax
+  80134c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80134f:	5b                   	pop    %ebx
+  801350:	5e                   	pop    %esi
+  801351:	5d                   	pop    %ebp
+  801352:	c3                   	ret
+
+00801353 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  801353:	55                   	push   %ebp
+  801354:	89 e5                	mov    %esp,%ebp
+  801356:	56                   	push   %esi
+  801357:	53                   	push   %ebx
+  801358:	89 c6                	mov    %eax,%esi
+  80135a:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  80135c:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  801363:	74 27                	je     80138c <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801365:	6a 07                	push   $0x7
+  801367:	68 00 50 80 00       	push   $0x805000
+  80136c:	56                   	push   %esi
+  80136d:	ff 35 00 40 80 00    	push   0x804000
+  801373:	e8 17 0c 00 00       	call   801f8f <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  801378:	83 c4 0c             	add    $0xc,%esp
+  80137b:	6a 00                	push   $0x0
+  80137d:	53                   	push   %ebx
+  80137e:	6a 00                	push   $0x0
+  801380:	e8 96 0b 00 00       	call   801f1b <ipc_recv>
+}
+  801385:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801388:	5b                   	pop    %ebx
+  801389:	5e                   	pop    %esi
+  80138a:	5d                   	pop    %ebp
+  80138b:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  80138c:	83 ec 0c             	sub    $0xc,%esp
+  80138f:	6a 01                	push   $0x1
+  801391:	e8 4d 0c 00 00       	call   801fe3 <ipc_find_env>
+  801396:	a3 00 40 80 00       	mov    %eax,0x804000
+  80139b:	83 c4 10             	add    $0x10,%esp
+  80139e:	eb c5                	jmp    801365 <fsipc+0x12>
+
+008013a0 <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8013a0:	55                   	push   %ebp
+  8013a1:	89 e5                	mov    %esp,%ebp
+  8013a3:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8013a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013a9:	8b 40 0c             	mov    0xc(%eax),%eax
+  8013ac:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.set_size.req_size = newsize;
+  8013b1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8013b4:	a3 04 50 80 00       	mov    %eax,0x805004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  8013b9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013be:	b8 02 00 00 00       	mov    $0x2,%eax
+  8013c3:	e8 8b ff ff ff       	call   801353 <fsipc>
+}
+  8013c8:	c9                   	leave
+  8013c9:	c3                   	ret
+
+008013ca <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8013ca:	55                   	push   %ebp
+  8013cb:	89 e5                	mov    %esp,%ebp
+  8013cd:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8013d0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013d3:	8b 40 0c             	mov    0xc(%eax),%eax
+  8013d6:	a3 00 50 80 00       	mov    %eax,0x805000
+  return fsipc(FSREQ_FLUSH, NULL);
+  8013db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013e0:	b8 06 00 00 00       	mov    $0x6,%eax
+  8013e5:	e8 69 ff ff ff       	call   801353 <fsipc>
+}
+  8013ea:	c9                   	leave
+  8013eb:	c3                   	ret
+
+008013ec <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8013ec:	55                   	push   %ebp
+  8013ed:	89 e5                	mov    %esp,%ebp
+  8013ef:	53                   	push   %ebx
+  8013f0:	83 ec 04             	sub    $0x4,%esp
+  8013f3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8013f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013f9:	8b 40 0c             	mov    0xc(%eax),%eax
+  8013fc:	a3 00 50 80 00       	mov    %eax,0x805000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801401:	ba 00 00 00 00       	mov    $0x0,%edx
+  801406:	b8 05 00 00 00       	mov    $0x5,%eax
+  80140b:	e8 43 ff ff ff       	call   801353 <fsipc>
+  801410:	85 c0                	test   %eax,%eax
+  801412:	78 2c                	js     801440 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801414:	83 ec 08             	sub    $0x8,%esp
+  801417:	68 00 50 80 00       	push   $0x805000
+  80141c:	53                   	push   %ebx
+  80141d:	e8 e3 f2 ff ff       	call   800705 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801422:	a1 80 50 80 00       	mov    0x805080,%eax
+  801427:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80142d:	a1 84 50 80 00       	mov    0x805084,%eax
+  801432:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801438:	83 c4 10             	add    $0x10,%esp
+  80143b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801440:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801443:	c9                   	leave
+  801444:	c3                   	ret
+
+00801445 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801445:	55                   	push   %ebp
+  801446:	89 e5                	mov    %esp,%ebp
+  801448:	83 ec 0c             	sub    $0xc,%esp
+  80144b:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80144e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801451:	8b 52 0c             	mov    0xc(%edx),%edx
+  801454:	89 15 00 50 80 00    	mov    %edx,0x805000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80145a:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  80145f:	39 d0                	cmp    %edx,%eax
+  801461:	0f 47 c2             	cmova  %edx,%eax
+  801464:	a3 04 50 80 00       	mov    %eax,0x805004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  801469:	50                   	push   %eax
+  80146a:	ff 75 0c             	push   0xc(%ebp)
+  80146d:	68 08 50 80 00       	push   $0x805008
+  801472:	e8 14 f4 ff ff       	call   80088b <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801477:	ba 00 00 00 00       	mov    $0x0,%edx
+  80147c:	b8 04 00 00 00       	mov    $0x4,%eax
+  801481:	e8 cd fe ff ff       	call   801353 <fsipc>
+}
+  801486:	c9                   	leave
+  801487:	c3                   	ret
+
+00801488 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801488:	55                   	push   %ebp
+  801489:	89 e5                	mov    %esp,%ebp
+  80148b:	56                   	push   %esi
+  80148c:	53                   	push   %ebx
+  80148d:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801490:	8b 45 08             	mov    0x8(%ebp),%eax
+  801493:	8b 40 0c             	mov    0xc(%eax),%eax
+  801496:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.read.req_n = n;
+  80149b:	89 35 04 50 80 00    	mov    %esi,0x805004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8014a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014a6:	b8 03 00 00 00       	mov    $0x3,%eax
+  8014ab:	e8 a3 fe ff ff       	call   801353 <fsipc>
+  8014b0:	89 c3                	mov    %eax,%ebx
+  8014b2:	85 c0                	test   %eax,%eax
+  8014b4:	78 1f                	js     8014d5 <devfile_read+0x4d>
+  assert(r <= n);
+  8014b6:	39 c6                	cmp    %eax,%esi
+  8014b8:	72 24                	jb     8014de <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  8014ba:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8014bf:	7f 33                	jg     8014f4 <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8014c1:	83 ec 04             	sub    $0x4,%esp
+  8014c4:	50                   	push   %eax
+  8014c5:	68 00 50 80 00       	push   $0x805000
+  8014ca:	ff 75 0c             	push   0xc(%ebp)
+  8014cd:	e8 b9 f3 ff ff       	call   80088b <memmove>
+  return r;
+  8014d2:	83 c4 10             	add    $0x10,%esp
+}
+  8014d5:	89 d8                	mov    %ebx,%eax
+  8014d7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014da:	5b                   	pop    %ebx
+  8014db:	5e                   	pop    %esi
+  8014dc:	5d                   	pop    %ebp
+  8014dd:	c3                   	ret
+  assert(r <= n);
+  8014de:	68 e0 28 80 00       	push   $0x8028e0
+  8014e3:	68 e7 28 80 00       	push   $0x8028e7
+  8014e8:	6a 78                	push   $0x78
+  8014ea:	68 fc 28 80 00       	push   $0x8028fc
+  8014ef:	e8 e1 09 00 00       	call   801ed5 <_panic>
+  assert(r <= PGSIZE);
+  8014f4:	68 07 29 80 00       	push   $0x802907
+  8014f9:	68 e7 28 80 00       	push   $0x8028e7
+  8014fe:	6a 79                	push   $0x79
+  801500:	68 fc 28 80 00       	push   $0x8028fc
+  801505:	e8 cb 09 00 00       	call   801ed5 <_panic>
+
+0080150a <open>:
+open(const char *path, int mode) {
+  80150a:	55                   	push   %ebp
+  80150b:	89 e5                	mov    %esp,%ebp
+  80150d:	56                   	push   %esi
+  80150e:	53                   	push   %ebx
+  80150f:	83 ec 1c             	sub    $0x1c,%esp
+  801512:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801515:	56                   	push   %esi
+  801516:	e8 af f1 ff ff       	call   8006ca <strlen>
+  80151b:	83 c4 10             	add    $0x10,%esp
+  80151e:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801523:	7f 6c                	jg     801591 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801525:	83 ec 0c             	sub    $0xc,%esp
+  801528:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80152b:	50                   	push   %eax
+  80152c:	e8 ba f8 ff ff       	call   800deb <fd_alloc>
+  801531:	89 c3                	mov    %eax,%ebx
+  801533:	83 c4 10             	add    $0x10,%esp
+  801536:	85 c0                	test   %eax,%eax
+  801538:	78 3c                	js     801576 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  80153a:	83 ec 08             	sub    $0x8,%esp
+  80153d:	56                   	push   %esi
+  80153e:	68 00 50 80 00       	push   $0x805000
+  801543:	e8 bd f1 ff ff       	call   800705 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801548:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80154b:	a3 00 54 80 00       	mov    %eax,0x805400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801550:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801553:	b8 01 00 00 00       	mov    $0x1,%eax
+  801558:	e8 f6 fd ff ff       	call   801353 <fsipc>
+  80155d:	89 c3                	mov    %eax,%ebx
+  80155f:	83 c4 10             	add    $0x10,%esp
+  801562:	85 c0                	test   %eax,%eax
+  801564:	78 19                	js     80157f <open+0x75>
+  return fd2num(fd);
+  801566:	83 ec 0c             	sub    $0xc,%esp
+  801569:	ff 75 f4             	push   -0xc(%ebp)
+  80156c:	e8 53 f8 ff ff       	call   800dc4 <fd2num>
+  801571:	89 c3                	mov    %eax,%ebx
+  801573:	83 c4 10             	add    $0x10,%esp
+}
+  801576:	89 d8                	mov    %ebx,%eax
+  801578:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80157b:	5b                   	pop    %ebx
+  80157c:	5e                   	pop    %esi
+  80157d:	5d                   	pop    %ebp
+  80157e:	c3                   	ret
+    fd_close(fd, 0);
+  80157f:	83 ec 08             	sub    $0x8,%esp
+  801582:	6a 00                	push   $0x0
+  801584:	ff 75 f4             	push   -0xc(%ebp)
+  801587:	e8 58 f9 ff ff       	call   800ee4 <fd_close>
+    return r;
+  80158c:	83 c4 10             	add    $0x10,%esp
+  80158f:	eb e5                	jmp    801576 <open+0x6c>
+    return -E_BAD_PATH;
+  801591:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801596:	eb de                	jmp    801576 <open+0x6c>
+
+00801598 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  801598:	55                   	push   %ebp
+  801599:	89 e5                	mov    %esp,%ebp
+  80159b:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  80159e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015a3:	b8 08 00 00 00       	mov    $0x8,%eax
+  8015a8:	e8 a6 fd ff ff       	call   801353 <fsipc>
+}
+  8015ad:	c9                   	leave
+  8015ae:	c3                   	ret
+
+008015af <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8015af:	55                   	push   %ebp
+  8015b0:	89 e5                	mov    %esp,%ebp
+  8015b2:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8015b5:	68 13 29 80 00       	push   $0x802913
+  8015ba:	ff 75 0c             	push   0xc(%ebp)
+  8015bd:	e8 43 f1 ff ff       	call   800705 <strcpy>
+	return 0;
+}
+  8015c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015c7:	c9                   	leave
+  8015c8:	c3                   	ret
+
+008015c9 <devsock_close>:
+{
+  8015c9:	55                   	push   %ebp
+  8015ca:	89 e5                	mov    %esp,%ebp
+  8015cc:	53                   	push   %ebx
+  8015cd:	83 ec 10             	sub    $0x10,%esp
+  8015d0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8015d3:	53                   	push   %ebx
+  8015d4:	e8 49 0a 00 00       	call   802022 <pageref>
+  8015d9:	89 c2                	mov    %eax,%edx
+  8015db:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8015de:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8015e3:	83 fa 01             	cmp    $0x1,%edx
+  8015e6:	74 05                	je     8015ed <devsock_close+0x24>
+}
+  8015e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015eb:	c9                   	leave
+  8015ec:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8015ed:	83 ec 0c             	sub    $0xc,%esp
+  8015f0:	ff 73 0c             	push   0xc(%ebx)
+  8015f3:	e8 b7 02 00 00       	call   8018af <nsipc_close>
+  8015f8:	83 c4 10             	add    $0x10,%esp
+  8015fb:	eb eb                	jmp    8015e8 <devsock_close+0x1f>
+
+008015fd <devsock_write>:
+{
+  8015fd:	55                   	push   %ebp
+  8015fe:	89 e5                	mov    %esp,%ebp
+  801600:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801603:	6a 00                	push   $0x0
+  801605:	ff 75 10             	push   0x10(%ebp)
+  801608:	ff 75 0c             	push   0xc(%ebp)
+  80160b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80160e:	ff 70 0c             	push   0xc(%eax)
+  801611:	e8 79 03 00 00       	call   80198f <nsipc_send>
+}
+  801616:	c9                   	leave
+  801617:	c3                   	ret
+
+00801618 <devsock_read>:
+{
+  801618:	55                   	push   %ebp
+  801619:	89 e5                	mov    %esp,%ebp
+  80161b:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  80161e:	6a 00                	push   $0x0
+  801620:	ff 75 10             	push   0x10(%ebp)
+  801623:	ff 75 0c             	push   0xc(%ebp)
+  801626:	8b 45 08             	mov    0x8(%ebp),%eax
+  801629:	ff 70 0c             	push   0xc(%eax)
+  80162c:	e8 ef 02 00 00       	call   801920 <nsipc_recv>
+}
+  801631:	c9                   	leave
+  801632:	c3                   	ret
+
+00801633 <fd2sockid>:
+{
+  801633:	55                   	push   %ebp
+  801634:	89 e5                	mov    %esp,%ebp
+  801636:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801639:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80163c:	52                   	push   %edx
+  80163d:	50                   	push   %eax
+  80163e:	e8 fe f7 ff ff       	call   800e41 <fd_lookup>
+  801643:	83 c4 10             	add    $0x10,%esp
+  801646:	85 c0                	test   %eax,%eax
+  801648:	78 10                	js     80165a <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  80164a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80164d:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  801653:	39 08                	cmp    %ecx,(%eax)
+  801655:	75 05                	jne    80165c <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801657:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  80165a:	c9                   	leave
+  80165b:	c3                   	ret
+		return -E_NOT_SUPP;
+  80165c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801661:	eb f7                	jmp    80165a <fd2sockid+0x27>
+
+00801663 <alloc_sockfd>:
+{
+  801663:	55                   	push   %ebp
+  801664:	89 e5                	mov    %esp,%ebp
+  801666:	56                   	push   %esi
+  801667:	53                   	push   %ebx
+  801668:	83 ec 1c             	sub    $0x1c,%esp
+  80166b:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  80166d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801670:	50                   	push   %eax
+  801671:	e8 75 f7 ff ff       	call   800deb <fd_alloc>
+  801676:	89 c3                	mov    %eax,%ebx
+  801678:	83 c4 10             	add    $0x10,%esp
+  80167b:	85 c0                	test   %eax,%eax
+  80167d:	78 43                	js     8016c2 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80167f:	83 ec 04             	sub    $0x4,%esp
+  801682:	68 07 04 00 00       	push   $0x407
+  801687:	ff 75 f4             	push   -0xc(%ebp)
+  80168a:	6a 00                	push   $0x0
+  80168c:	e8 60 f4 ff ff       	call   800af1 <sys_page_alloc>
+  801691:	89 c3                	mov    %eax,%ebx
+  801693:	83 c4 10             	add    $0x10,%esp
+  801696:	85 c0                	test   %eax,%eax
+  801698:	78 28                	js     8016c2 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  80169a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80169d:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  8016a3:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8016a5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016a8:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8016af:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8016b2:	83 ec 0c             	sub    $0xc,%esp
+  8016b5:	50                   	push   %eax
+  8016b6:	e8 09 f7 ff ff       	call   800dc4 <fd2num>
+  8016bb:	89 c3                	mov    %eax,%ebx
+  8016bd:	83 c4 10             	add    $0x10,%esp
+  8016c0:	eb 0c                	jmp    8016ce <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8016c2:	83 ec 0c             	sub    $0xc,%esp
+  8016c5:	56                   	push   %esi
+  8016c6:	e8 e4 01 00 00       	call   8018af <nsipc_close>
+		return r;
+  8016cb:	83 c4 10             	add    $0x10,%esp
+}
+  8016ce:	89 d8                	mov    %ebx,%eax
+  8016d0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016d3:	5b                   	pop    %ebx
+  8016d4:	5e                   	pop    %esi
+  8016d5:	5d                   	pop    %ebp
+  8016d6:	c3                   	ret
+
+008016d7 <accept>:
+{
+  8016d7:	55                   	push   %ebp
+  8016d8:	89 e5                	mov    %esp,%ebp
+  8016da:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8016dd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016e0:	e8 4e ff ff ff       	call   801633 <fd2sockid>
+  8016e5:	85 c0                	test   %eax,%eax
+  8016e7:	78 1b                	js     801704 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8016e9:	83 ec 04             	sub    $0x4,%esp
+  8016ec:	ff 75 10             	push   0x10(%ebp)
+  8016ef:	ff 75 0c             	push   0xc(%ebp)
+  8016f2:	50                   	push   %eax
+  8016f3:	e8 0e 01 00 00       	call   801806 <nsipc_accept>
+  8016f8:	83 c4 10             	add    $0x10,%esp
+  8016fb:	85 c0                	test   %eax,%eax
+  8016fd:	78 05                	js     801704 <accept+0x2d>
+	return alloc_sockfd(r);
+  8016ff:	e8 5f ff ff ff       	call   801663 <alloc_sockfd>
+}
+  801704:	c9                   	leave
+  801705:	c3                   	ret
+
+00801706 <bind>:
+{
+  801706:	55                   	push   %ebp
+  801707:	89 e5                	mov    %esp,%ebp
+  801709:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80170c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80170f:	e8 1f ff ff ff       	call   801633 <fd2sockid>
+  801714:	85 c0                	test   %eax,%eax
+  801716:	78 12                	js     80172a <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801718:	83 ec 04             	sub    $0x4,%esp
+  80171b:	ff 75 10             	push   0x10(%ebp)
+  80171e:	ff 75 0c             	push   0xc(%ebp)
+  801721:	50                   	push   %eax
+  801722:	e8 31 01 00 00       	call   801858 <nsipc_bind>
+  801727:	83 c4 10             	add    $0x10,%esp
+}
+  80172a:	c9                   	leave
+  80172b:	c3                   	ret
+
+0080172c <shutdown>:
+{
+  80172c:	55                   	push   %ebp
+  80172d:	89 e5                	mov    %esp,%ebp
+  80172f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801732:	8b 45 08             	mov    0x8(%ebp),%eax
+  801735:	e8 f9 fe ff ff       	call   801633 <fd2sockid>
+  80173a:	85 c0                	test   %eax,%eax
+  80173c:	78 0f                	js     80174d <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  80173e:	83 ec 08             	sub    $0x8,%esp
+  801741:	ff 75 0c             	push   0xc(%ebp)
+  801744:	50                   	push   %eax
+  801745:	e8 43 01 00 00       	call   80188d <nsipc_shutdown>
+  80174a:	83 c4 10             	add    $0x10,%esp
+}
+  80174d:	c9                   	leave
+  80174e:	c3                   	ret
+
+0080174f <connect>:
+{
+  80174f:	55                   	push   %ebp
+  801750:	89 e5                	mov    %esp,%ebp
+  801752:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801755:	8b 45 08             	mov    0x8(%ebp),%eax
+  801758:	e8 d6 fe ff ff       	call   801633 <fd2sockid>
+  80175d:	85 c0                	test   %eax,%eax
+  80175f:	78 12                	js     801773 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801761:	83 ec 04             	sub    $0x4,%esp
+  801764:	ff 75 10             	push   0x10(%ebp)
+  801767:	ff 75 0c             	push   0xc(%ebp)
+  80176a:	50                   	push   %eax
+  80176b:	e8 59 01 00 00       	call   8018c9 <nsipc_connect>
+  801770:	83 c4 10             	add    $0x10,%esp
+}
+  801773:	c9                   	leave
+  801774:	c3                   	ret
+
+00801775 <listen>:
+{
+  801775:	55                   	push   %ebp
+  801776:	89 e5                	mov    %esp,%ebp
+  801778:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80177b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80177e:	e8 b0 fe ff ff       	call   801633 <fd2sockid>
+  801783:	85 c0                	test   %eax,%eax
+  801785:	78 0f                	js     801796 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801787:	83 ec 08             	sub    $0x8,%esp
+  80178a:	ff 75 0c             	push   0xc(%ebp)
+  80178d:	50                   	push   %eax
+  80178e:	e8 6b 01 00 00       	call   8018fe <nsipc_listen>
+  801793:	83 c4 10             	add    $0x10,%esp
+}
+  801796:	c9                   	leave
+  801797:	c3                   	ret
+
+00801798 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801798:	55                   	push   %ebp
+  801799:	89 e5                	mov    %esp,%ebp
+  80179b:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  80179e:	ff 75 10             	push   0x10(%ebp)
+  8017a1:	ff 75 0c             	push   0xc(%ebp)
+  8017a4:	ff 75 08             	push   0x8(%ebp)
+  8017a7:	e8 41 02 00 00       	call   8019ed <nsipc_socket>
+  8017ac:	83 c4 10             	add    $0x10,%esp
+  8017af:	85 c0                	test   %eax,%eax
+  8017b1:	78 05                	js     8017b8 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8017b3:	e8 ab fe ff ff       	call   801663 <alloc_sockfd>
+}
+  8017b8:	c9                   	leave
+  8017b9:	c3                   	ret
+
+008017ba <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8017ba:	55                   	push   %ebp
+  8017bb:	89 e5                	mov    %esp,%ebp
+  8017bd:	53                   	push   %ebx
+  8017be:	83 ec 04             	sub    $0x4,%esp
+  8017c1:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  8017c3:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8017ca:	74 26                	je     8017f2 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8017cc:	6a 07                	push   $0x7
+  8017ce:	68 00 60 80 00       	push   $0x806000
+  8017d3:	53                   	push   %ebx
+  8017d4:	ff 35 04 40 80 00    	push   0x804004
+  8017da:	e8 b0 07 00 00       	call   801f8f <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8017df:	83 c4 0c             	add    $0xc,%esp
+  8017e2:	6a 00                	push   $0x0
+  8017e4:	6a 00                	push   $0x0
+  8017e6:	6a 00                	push   $0x0
+  8017e8:	e8 2e 07 00 00       	call   801f1b <ipc_recv>
+}
+  8017ed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017f0:	c9                   	leave
+  8017f1:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8017f2:	83 ec 0c             	sub    $0xc,%esp
+  8017f5:	6a 02                	push   $0x2
+  8017f7:	e8 e7 07 00 00       	call   801fe3 <ipc_find_env>
+  8017fc:	a3 04 40 80 00       	mov    %eax,0x804004
+  801801:	83 c4 10             	add    $0x10,%esp
+  801804:	eb c6                	jmp    8017cc <nsipc+0x12>
+
+00801806 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801806:	55                   	push   %ebp
+  801807:	89 e5                	mov    %esp,%ebp
+  801809:	56                   	push   %esi
+  80180a:	53                   	push   %ebx
+  80180b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  80180e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801811:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801816:	8b 06                	mov    (%esi),%eax
+  801818:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  80181d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801822:	e8 93 ff ff ff       	call   8017ba <nsipc>
+  801827:	89 c3                	mov    %eax,%ebx
+  801829:	85 c0                	test   %eax,%eax
+  80182b:	79 09                	jns    801836 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  80182d:	89 d8                	mov    %ebx,%eax
+  80182f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801832:	5b                   	pop    %ebx
+  801833:	5e                   	pop    %esi
+  801834:	5d                   	pop    %ebp
+  801835:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801836:	83 ec 04             	sub    $0x4,%esp
+  801839:	ff 35 10 60 80 00    	push   0x806010
+  80183f:	68 00 60 80 00       	push   $0x806000
+  801844:	ff 75 0c             	push   0xc(%ebp)
+  801847:	e8 3f f0 ff ff       	call   80088b <memmove>
+		*addrlen = ret->ret_addrlen;
+  80184c:	a1 10 60 80 00       	mov    0x806010,%eax
+  801851:	89 06                	mov    %eax,(%esi)
+  801853:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801856:	eb d5                	jmp    80182d <nsipc_accept+0x27>
+
+00801858 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801858:	55                   	push   %ebp
+  801859:	89 e5                	mov    %esp,%ebp
+  80185b:	53                   	push   %ebx
+  80185c:	83 ec 08             	sub    $0x8,%esp
+  80185f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801862:	8b 45 08             	mov    0x8(%ebp),%eax
+  801865:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  80186a:	53                   	push   %ebx
+  80186b:	ff 75 0c             	push   0xc(%ebp)
+  80186e:	68 04 60 80 00       	push   $0x806004
+  801873:	e8 13 f0 ff ff       	call   80088b <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801878:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  80187e:	b8 02 00 00 00       	mov    $0x2,%eax
+  801883:	e8 32 ff ff ff       	call   8017ba <nsipc>
+}
+  801888:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80188b:	c9                   	leave
+  80188c:	c3                   	ret
+
+0080188d <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  80188d:	55                   	push   %ebp
+  80188e:	89 e5                	mov    %esp,%ebp
+  801890:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801893:	8b 45 08             	mov    0x8(%ebp),%eax
+  801896:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  80189b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80189e:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  8018a3:	b8 03 00 00 00       	mov    $0x3,%eax
+  8018a8:	e8 0d ff ff ff       	call   8017ba <nsipc>
+}
+  8018ad:	c9                   	leave
+  8018ae:	c3                   	ret
+
+008018af <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8018af:	55                   	push   %ebp
+  8018b0:	89 e5                	mov    %esp,%ebp
+  8018b2:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8018b5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018b8:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  8018bd:	b8 04 00 00 00       	mov    $0x4,%eax
+  8018c2:	e8 f3 fe ff ff       	call   8017ba <nsipc>
+}
+  8018c7:	c9                   	leave
+  8018c8:	c3                   	ret
+
+008018c9 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8018c9:	55                   	push   %ebp
+  8018ca:	89 e5                	mov    %esp,%ebp
+  8018cc:	53                   	push   %ebx
+  8018cd:	83 ec 08             	sub    $0x8,%esp
+  8018d0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8018d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018d6:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8018db:	53                   	push   %ebx
+  8018dc:	ff 75 0c             	push   0xc(%ebp)
+  8018df:	68 04 60 80 00       	push   $0x806004
+  8018e4:	e8 a2 ef ff ff       	call   80088b <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8018e9:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  8018ef:	b8 05 00 00 00       	mov    $0x5,%eax
+  8018f4:	e8 c1 fe ff ff       	call   8017ba <nsipc>
+}
+  8018f9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018fc:	c9                   	leave
+  8018fd:	c3                   	ret
+
+008018fe <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8018fe:	55                   	push   %ebp
+  8018ff:	89 e5                	mov    %esp,%ebp
+  801901:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801904:	8b 45 08             	mov    0x8(%ebp),%eax
+  801907:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  80190c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80190f:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  801914:	b8 06 00 00 00       	mov    $0x6,%eax
+  801919:	e8 9c fe ff ff       	call   8017ba <nsipc>
+}
+  80191e:	c9                   	leave
+  80191f:	c3                   	ret
+
+00801920 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801920:	55                   	push   %ebp
+  801921:	89 e5                	mov    %esp,%ebp
+  801923:	56                   	push   %esi
+  801924:	53                   	push   %ebx
+  801925:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801928:	8b 45 08             	mov    0x8(%ebp),%eax
+  80192b:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  801930:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  801936:	8b 45 14             	mov    0x14(%ebp),%eax
+  801939:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  80193e:	b8 07 00 00 00       	mov    $0x7,%eax
+  801943:	e8 72 fe ff ff       	call   8017ba <nsipc>
+  801948:	89 c3                	mov    %eax,%ebx
+  80194a:	85 c0                	test   %eax,%eax
+  80194c:	78 22                	js     801970 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  80194e:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801953:	39 c6                	cmp    %eax,%esi
+  801955:	0f 4e c6             	cmovle %esi,%eax
+  801958:	39 c3                	cmp    %eax,%ebx
+  80195a:	7f 1d                	jg     801979 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  80195c:	83 ec 04             	sub    $0x4,%esp
+  80195f:	53                   	push   %ebx
+  801960:	68 00 60 80 00       	push   $0x806000
+  801965:	ff 75 0c             	push   0xc(%ebp)
+  801968:	e8 1e ef ff ff       	call   80088b <memmove>
+  80196d:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801970:	89 d8                	mov    %ebx,%eax
+  801972:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801975:	5b                   	pop    %ebx
+  801976:	5e                   	pop    %esi
+  801977:	5d                   	pop    %ebp
+  801978:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801979:	68 1f 29 80 00       	push   $0x80291f
+  80197e:	68 e7 28 80 00       	push   $0x8028e7
+  801983:	6a 62                	push   $0x62
+  801985:	68 34 29 80 00       	push   $0x802934
+  80198a:	e8 46 05 00 00       	call   801ed5 <_panic>
+
+0080198f <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  80198f:	55                   	push   %ebp
+  801990:	89 e5                	mov    %esp,%ebp
+  801992:	53                   	push   %ebx
+  801993:	83 ec 04             	sub    $0x4,%esp
+  801996:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801999:	8b 45 08             	mov    0x8(%ebp),%eax
+  80199c:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  8019a1:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8019a7:	7f 2e                	jg     8019d7 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8019a9:	83 ec 04             	sub    $0x4,%esp
+  8019ac:	53                   	push   %ebx
+  8019ad:	ff 75 0c             	push   0xc(%ebp)
+  8019b0:	68 0c 60 80 00       	push   $0x80600c
+  8019b5:	e8 d1 ee ff ff       	call   80088b <memmove>
+	nsipcbuf.send.req_size = size;
+  8019ba:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  8019c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019c3:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  8019c8:	b8 08 00 00 00       	mov    $0x8,%eax
+  8019cd:	e8 e8 fd ff ff       	call   8017ba <nsipc>
+}
+  8019d2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019d5:	c9                   	leave
+  8019d6:	c3                   	ret
+	assert(size < 1600);
+  8019d7:	68 40 29 80 00       	push   $0x802940
+  8019dc:	68 e7 28 80 00       	push   $0x8028e7
+  8019e1:	6a 6d                	push   $0x6d
+  8019e3:	68 34 29 80 00       	push   $0x802934
+  8019e8:	e8 e8 04 00 00       	call   801ed5 <_panic>
+
+008019ed <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8019ed:	55                   	push   %ebp
+  8019ee:	89 e5                	mov    %esp,%ebp
+  8019f0:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8019f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019f6:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  8019fb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019fe:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  801a03:	8b 45 10             	mov    0x10(%ebp),%eax
+  801a06:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  801a0b:	b8 09 00 00 00       	mov    $0x9,%eax
+  801a10:	e8 a5 fd ff ff       	call   8017ba <nsipc>
+}
+  801a15:	c9                   	leave
+  801a16:	c3                   	ret
+
+00801a17 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801a17:	55                   	push   %ebp
+  801a18:	89 e5                	mov    %esp,%ebp
+  801a1a:	56                   	push   %esi
+  801a1b:	53                   	push   %ebx
+  801a1c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801a1f:	83 ec 0c             	sub    $0xc,%esp
+  801a22:	ff 75 08             	push   0x8(%ebp)
+  801a25:	e8 aa f3 ff ff       	call   800dd4 <fd2data>
+  801a2a:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801a2c:	83 c4 08             	add    $0x8,%esp
+  801a2f:	68 4c 29 80 00       	push   $0x80294c
+  801a34:	53                   	push   %ebx
+  801a35:	e8 cb ec ff ff       	call   800705 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801a3a:	8b 46 04             	mov    0x4(%esi),%eax
+  801a3d:	2b 06                	sub    (%esi),%eax
+  801a3f:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  801a45:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801a4c:	00 00 00 
+	stat->st_dev = &devpipe;
+  801a4f:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  801a56:	30 80 00 
+	return 0;
+}
+  801a59:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a5e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a61:	5b                   	pop    %ebx
+  801a62:	5e                   	pop    %esi
+  801a63:	5d                   	pop    %ebp
+  801a64:	c3                   	ret
+
+00801a65 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801a65:	55                   	push   %ebp
+  801a66:	89 e5                	mov    %esp,%ebp
+  801a68:	53                   	push   %ebx
+  801a69:	83 ec 0c             	sub    $0xc,%esp
+  801a6c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801a6f:	53                   	push   %ebx
+  801a70:	6a 00                	push   $0x0
+  801a72:	e8 ff f0 ff ff       	call   800b76 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801a77:	89 1c 24             	mov    %ebx,(%esp)
+  801a7a:	e8 55 f3 ff ff       	call   800dd4 <fd2data>
+  801a7f:	83 c4 08             	add    $0x8,%esp
+  801a82:	50                   	push   %eax
+  801a83:	6a 00                	push   $0x0
+  801a85:	e8 ec f0 ff ff       	call   800b76 <sys_page_unmap>
+}
+  801a8a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a8d:	c9                   	leave
+  801a8e:	c3                   	ret
+
+00801a8f <_pipeisclosed>:
+{
+  801a8f:	55                   	push   %ebp
+  801a90:	89 e5                	mov    %esp,%ebp
+  801a92:	57                   	push   %edi
+  801a93:	56                   	push   %esi
+  801a94:	53                   	push   %ebx
+  801a95:	83 ec 1c             	sub    $0x1c,%esp
+  801a98:	89 c7                	mov    %eax,%edi
+  801a9a:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801a9c:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  801aa1:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801aa4:	83 ec 0c             	sub    $0xc,%esp
+  801aa7:	57                   	push   %edi
+  801aa8:	e8 75 05 00 00       	call   802022 <pageref>
+  801aad:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801ab0:	89 34 24             	mov    %esi,(%esp)
+  801ab3:	e8 6a 05 00 00       	call   802022 <pageref>
+		nn = thisenv->env_runs;
+  801ab8:	8b 15 0c 40 80 00    	mov    0x80400c,%edx
+  801abe:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801ac1:	83 c4 10             	add    $0x10,%esp
+  801ac4:	39 cb                	cmp    %ecx,%ebx
+  801ac6:	74 1b                	je     801ae3 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801ac8:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801acb:	75 cf                	jne    801a9c <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801acd:	8b 42 58             	mov    0x58(%edx),%eax
+  801ad0:	6a 01                	push   $0x1
+  801ad2:	50                   	push   %eax
+  801ad3:	53                   	push   %ebx
+  801ad4:	68 53 29 80 00       	push   $0x802953
+  801ad9:	e8 6e e6 ff ff       	call   80014c <cprintf>
+  801ade:	83 c4 10             	add    $0x10,%esp
+  801ae1:	eb b9                	jmp    801a9c <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801ae3:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801ae6:	0f 94 c0             	sete   %al
+  801ae9:	0f b6 c0             	movzbl %al,%eax
+}
+  801aec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801aef:	5b                   	pop    %ebx
+  801af0:	5e                   	pop    %esi
+  801af1:	5f                   	pop    %edi
+  801af2:	5d                   	pop    %ebp
+  801af3:	c3                   	ret
+
+00801af4 <devpipe_write>:
+{
+  801af4:	55                   	push   %ebp
+  801af5:	89 e5                	mov    %esp,%ebp
+  801af7:	57                   	push   %edi
+  801af8:	56                   	push   %esi
+  801af9:	53                   	push   %ebx
+  801afa:	83 ec 28             	sub    $0x28,%esp
+  801afd:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801b00:	56                   	push   %esi
+  801b01:	e8 ce f2 ff ff       	call   800dd4 <fd2data>
+  801b06:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801b08:	83 c4 10             	add    $0x10,%esp
+  801b0b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b10:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801b13:	75 09                	jne    801b1e <devpipe_write+0x2a>
+	return i;
+  801b15:	89 f8                	mov    %edi,%eax
+  801b17:	eb 23                	jmp    801b3c <devpipe_write+0x48>
+			sys_yield();
+  801b19:	e8 b4 ef ff ff       	call   800ad2 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801b1e:	8b 43 04             	mov    0x4(%ebx),%eax
+  801b21:	8b 0b                	mov    (%ebx),%ecx
+  801b23:	8d 51 20             	lea    0x20(%ecx),%edx
+  801b26:	39 d0                	cmp    %edx,%eax
+  801b28:	72 1a                	jb     801b44 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  801b2a:	89 da                	mov    %ebx,%edx
+  801b2c:	89 f0                	mov    %esi,%eax
+  801b2e:	e8 5c ff ff ff       	call   801a8f <_pipeisclosed>
+  801b33:	85 c0                	test   %eax,%eax
+  801b35:	74 e2                	je     801b19 <devpipe_write+0x25>
+				return 0;
+  801b37:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b3c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b3f:	5b                   	pop    %ebx
+  801b40:	5e                   	pop    %esi
+  801b41:	5f                   	pop    %edi
+  801b42:	5d                   	pop    %ebp
+  801b43:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801b44:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b47:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801b4b:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801b4e:	89 c2                	mov    %eax,%edx
+  801b50:	c1 fa 1f             	sar    $0x1f,%edx
+  801b53:	89 d1                	mov    %edx,%ecx
+  801b55:	c1 e9 1b             	shr    $0x1b,%ecx
+  801b58:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801b5b:	83 e2 1f             	and    $0x1f,%edx
+  801b5e:	29 ca                	sub    %ecx,%edx
+  801b60:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801b64:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  801b68:	83 c0 01             	add    $0x1,%eax
+  801b6b:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  801b6e:	83 c7 01             	add    $0x1,%edi
+  801b71:	eb 9d                	jmp    801b10 <devpipe_write+0x1c>
+
+00801b73 <devpipe_read>:
+{
+  801b73:	55                   	push   %ebp
+  801b74:	89 e5                	mov    %esp,%ebp
+  801b76:	57                   	push   %edi
+  801b77:	56                   	push   %esi
+  801b78:	53                   	push   %ebx
+  801b79:	83 ec 18             	sub    $0x18,%esp
+  801b7c:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  801b7f:	57                   	push   %edi
+  801b80:	e8 4f f2 ff ff       	call   800dd4 <fd2data>
+  801b85:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801b87:	83 c4 10             	add    $0x10,%esp
+  801b8a:	be 00 00 00 00       	mov    $0x0,%esi
+  801b8f:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801b92:	75 13                	jne    801ba7 <devpipe_read+0x34>
+	return i;
+  801b94:	89 f0                	mov    %esi,%eax
+  801b96:	eb 02                	jmp    801b9a <devpipe_read+0x27>
+				return i;
+  801b98:	89 f0                	mov    %esi,%eax
+}
+  801b9a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b9d:	5b                   	pop    %ebx
+  801b9e:	5e                   	pop    %esi
+  801b9f:	5f                   	pop    %edi
+  801ba0:	5d                   	pop    %ebp
+  801ba1:	c3                   	ret
+			sys_yield();
+  801ba2:	e8 2b ef ff ff       	call   800ad2 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  801ba7:	8b 03                	mov    (%ebx),%eax
+  801ba9:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801bac:	75 18                	jne    801bc6 <devpipe_read+0x53>
+			if (i > 0)
+  801bae:	85 f6                	test   %esi,%esi
+  801bb0:	75 e6                	jne    801b98 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  801bb2:	89 da                	mov    %ebx,%edx
+  801bb4:	89 f8                	mov    %edi,%eax
+  801bb6:	e8 d4 fe ff ff       	call   801a8f <_pipeisclosed>
+  801bbb:	85 c0                	test   %eax,%eax
+  801bbd:	74 e3                	je     801ba2 <devpipe_read+0x2f>
+				return 0;
+  801bbf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bc4:	eb d4                	jmp    801b9a <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801bc6:	99                   	cltd
+  801bc7:	c1 ea 1b             	shr    $0x1b,%edx
+  801bca:	01 d0                	add    %edx,%eax
+  801bcc:	83 e0 1f             	and    $0x1f,%eax
+  801bcf:	29 d0                	sub    %edx,%eax
+  801bd1:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801bd6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801bd9:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  801bdc:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  801bdf:	83 c6 01             	add    $0x1,%esi
+  801be2:	eb ab                	jmp    801b8f <devpipe_read+0x1c>
+
+00801be4 <pipe>:
+{
+  801be4:	55                   	push   %ebp
+  801be5:	89 e5                	mov    %esp,%ebp
+  801be7:	56                   	push   %esi
+  801be8:	53                   	push   %ebx
+  801be9:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801bec:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bef:	50                   	push   %eax
+  801bf0:	e8 f6 f1 ff ff       	call   800deb <fd_alloc>
+  801bf5:	89 c3                	mov    %eax,%ebx
+  801bf7:	83 c4 10             	add    $0x10,%esp
+  801bfa:	85 c0                	test   %eax,%eax
+  801bfc:	0f 88 23 01 00 00    	js     801d25 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801c02:	83 ec 04             	sub    $0x4,%esp
+  801c05:	68 07 04 00 00       	push   $0x407
+  801c0a:	ff 75 f4             	push   -0xc(%ebp)
+  801c0d:	6a 00                	push   $0x0
+  801c0f:	e8 dd ee ff ff       	call   800af1 <sys_page_alloc>
+  801c14:	89 c3                	mov    %eax,%ebx
+  801c16:	83 c4 10             	add    $0x10,%esp
+  801c19:	85 c0                	test   %eax,%eax
+  801c1b:	0f 88 04 01 00 00    	js     801d25 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801c21:	83 ec 0c             	sub    $0xc,%esp
+  801c24:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c27:	50                   	push   %eax
+  801c28:	e8 be f1 ff ff       	call   800deb <fd_alloc>
+  801c2d:	89 c3                	mov    %eax,%ebx
+  801c2f:	83 c4 10             	add    $0x10,%esp
+  801c32:	85 c0                	test   %eax,%eax
+  801c34:	0f 88 db 00 00 00    	js     801d15 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801c3a:	83 ec 04             	sub    $0x4,%esp
+  801c3d:	68 07 04 00 00       	push   $0x407
+  801c42:	ff 75 f0             	push   -0x10(%ebp)
+  801c45:	6a 00                	push   $0x0
+  801c47:	e8 a5 ee ff ff       	call   800af1 <sys_page_alloc>
+  801c4c:	89 c3                	mov    %eax,%ebx
+  801c4e:	83 c4 10             	add    $0x10,%esp
+  801c51:	85 c0                	test   %eax,%eax
+  801c53:	0f 88 bc 00 00 00    	js     801d15 <pipe+0x131>
+	va = fd2data(fd0);
+  801c59:	83 ec 0c             	sub    $0xc,%esp
+  801c5c:	ff 75 f4             	push   -0xc(%ebp)
+  801c5f:	e8 70 f1 ff ff       	call   800dd4 <fd2data>
+  801c64:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801c66:	83 c4 0c             	add    $0xc,%esp
+  801c69:	68 07 04 00 00       	push   $0x407
+  801c6e:	50                   	push   %eax
+  801c6f:	6a 00                	push   $0x0
+  801c71:	e8 7b ee ff ff       	call   800af1 <sys_page_alloc>
+  801c76:	89 c3                	mov    %eax,%ebx
+  801c78:	83 c4 10             	add    $0x10,%esp
+  801c7b:	85 c0                	test   %eax,%eax
+  801c7d:	0f 88 82 00 00 00    	js     801d05 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801c83:	83 ec 0c             	sub    $0xc,%esp
+  801c86:	ff 75 f0             	push   -0x10(%ebp)
+  801c89:	e8 46 f1 ff ff       	call   800dd4 <fd2data>
+  801c8e:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801c95:	50                   	push   %eax
+  801c96:	6a 00                	push   $0x0
+  801c98:	56                   	push   %esi
+  801c99:	6a 00                	push   $0x0
+  801c9b:	e8 94 ee ff ff       	call   800b34 <sys_page_map>
+  801ca0:	89 c3                	mov    %eax,%ebx
+  801ca2:	83 c4 20             	add    $0x20,%esp
+  801ca5:	85 c0                	test   %eax,%eax
+  801ca7:	78 4e                	js     801cf7 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  801ca9:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  801cae:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801cb1:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  801cb3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801cb6:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  801cbd:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801cc0:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  801cc2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801cc5:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  801ccc:	83 ec 0c             	sub    $0xc,%esp
+  801ccf:	ff 75 f4             	push   -0xc(%ebp)
+  801cd2:	e8 ed f0 ff ff       	call   800dc4 <fd2num>
+  801cd7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801cda:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  801cdc:	83 c4 04             	add    $0x4,%esp
+  801cdf:	ff 75 f0             	push   -0x10(%ebp)
+  801ce2:	e8 dd f0 ff ff       	call   800dc4 <fd2num>
+  801ce7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801cea:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  801ced:	83 c4 10             	add    $0x10,%esp
+  801cf0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cf5:	eb 2e                	jmp    801d25 <pipe+0x141>
+	sys_page_unmap(0, va);
+  801cf7:	83 ec 08             	sub    $0x8,%esp
+  801cfa:	56                   	push   %esi
+  801cfb:	6a 00                	push   $0x0
+  801cfd:	e8 74 ee ff ff       	call   800b76 <sys_page_unmap>
+  801d02:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  801d05:	83 ec 08             	sub    $0x8,%esp
+  801d08:	ff 75 f0             	push   -0x10(%ebp)
+  801d0b:	6a 00                	push   $0x0
+  801d0d:	e8 64 ee ff ff       	call   800b76 <sys_page_unmap>
+  801d12:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  801d15:	83 ec 08             	sub    $0x8,%esp
+  801d18:	ff 75 f4             	push   -0xc(%ebp)
+  801d1b:	6a 00                	push   $0x0
+  801d1d:	e8 54 ee ff ff       	call   800b76 <sys_page_unmap>
+  801d22:	83 c4 10             	add    $0x10,%esp
+}
+  801d25:	89 d8                	mov    %ebx,%eax
+  801d27:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d2a:	5b                   	pop    %ebx
+  801d2b:	5e                   	pop    %esi
+  801d2c:	5d                   	pop    %ebp
+  801d2d:	c3                   	ret
+
+00801d2e <pipeisclosed>:
+{
+  801d2e:	55                   	push   %ebp
+  801d2f:	89 e5                	mov    %esp,%ebp
+  801d31:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d34:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d37:	50                   	push   %eax
+  801d38:	ff 75 08             	push   0x8(%ebp)
+  801d3b:	e8 01 f1 ff ff       	call   800e41 <fd_lookup>
+  801d40:	83 c4 10             	add    $0x10,%esp
+  801d43:	85 c0                	test   %eax,%eax
+  801d45:	78 18                	js     801d5f <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  801d47:	83 ec 0c             	sub    $0xc,%esp
+  801d4a:	ff 75 f4             	push   -0xc(%ebp)
+  801d4d:	e8 82 f0 ff ff       	call   800dd4 <fd2data>
+  801d52:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  801d54:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d57:	e8 33 fd ff ff       	call   801a8f <_pipeisclosed>
+  801d5c:	83 c4 10             	add    $0x10,%esp
+}
+  801d5f:	c9                   	leave
+  801d60:	c3                   	ret
+
+00801d61 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  801d61:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d66:	c3                   	ret
+
+00801d67 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  801d67:	55                   	push   %ebp
+  801d68:	89 e5                	mov    %esp,%ebp
+  801d6a:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  801d6d:	68 6b 29 80 00       	push   $0x80296b
+  801d72:	ff 75 0c             	push   0xc(%ebp)
+  801d75:	e8 8b e9 ff ff       	call   800705 <strcpy>
+	return 0;
+}
+  801d7a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d7f:	c9                   	leave
+  801d80:	c3                   	ret
+
+00801d81 <devcons_write>:
+{
+  801d81:	55                   	push   %ebp
+  801d82:	89 e5                	mov    %esp,%ebp
+  801d84:	57                   	push   %edi
+  801d85:	56                   	push   %esi
+  801d86:	53                   	push   %ebx
+  801d87:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  801d8d:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  801d92:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  801d98:	eb 2e                	jmp    801dc8 <devcons_write+0x47>
+		m = n - tot;
+  801d9a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801d9d:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  801d9f:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801da4:	39 c3                	cmp    %eax,%ebx
+  801da6:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  801da9:	83 ec 04             	sub    $0x4,%esp
+  801dac:	53                   	push   %ebx
+  801dad:	89 f0                	mov    %esi,%eax
+  801daf:	03 45 0c             	add    0xc(%ebp),%eax
+  801db2:	50                   	push   %eax
+  801db3:	57                   	push   %edi
+  801db4:	e8 d2 ea ff ff       	call   80088b <memmove>
+		sys_cputs(buf, m);
+  801db9:	83 c4 08             	add    $0x8,%esp
+  801dbc:	53                   	push   %ebx
+  801dbd:	57                   	push   %edi
+  801dbe:	e8 72 ec ff ff       	call   800a35 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  801dc3:	01 de                	add    %ebx,%esi
+  801dc5:	83 c4 10             	add    $0x10,%esp
+  801dc8:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801dcb:	72 cd                	jb     801d9a <devcons_write+0x19>
+}
+  801dcd:	89 f0                	mov    %esi,%eax
+  801dcf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801dd2:	5b                   	pop    %ebx
+  801dd3:	5e                   	pop    %esi
+  801dd4:	5f                   	pop    %edi
+  801dd5:	5d                   	pop    %ebp
+  801dd6:	c3                   	ret
+
+00801dd7 <devcons_read>:
+{
+  801dd7:	55                   	push   %ebp
+  801dd8:	89 e5                	mov    %esp,%ebp
+  801dda:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  801ddd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801de2:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801de6:	75 07                	jne    801def <devcons_read+0x18>
+  801de8:	eb 1f                	jmp    801e09 <devcons_read+0x32>
+		sys_yield();
+  801dea:	e8 e3 ec ff ff       	call   800ad2 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  801def:	e8 5f ec ff ff       	call   800a53 <sys_cgetc>
+  801df4:	85 c0                	test   %eax,%eax
+  801df6:	74 f2                	je     801dea <devcons_read+0x13>
+	if (c < 0)
+  801df8:	78 0f                	js     801e09 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  801dfa:	83 f8 04             	cmp    $0x4,%eax
+  801dfd:	74 0c                	je     801e0b <devcons_read+0x34>
+	*(char*)vbuf = c;
+  801dff:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e02:	88 02                	mov    %al,(%edx)
+	return 1;
+  801e04:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  801e09:	c9                   	leave
+  801e0a:	c3                   	ret
+		return 0;
+  801e0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e10:	eb f7                	jmp    801e09 <devcons_read+0x32>
+
+00801e12 <cputchar>:
+{
+  801e12:	55                   	push   %ebp
+  801e13:	89 e5                	mov    %esp,%ebp
+  801e15:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  801e18:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e1b:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  801e1e:	6a 01                	push   $0x1
+  801e20:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801e23:	50                   	push   %eax
+  801e24:	e8 0c ec ff ff       	call   800a35 <sys_cputs>
+}
+  801e29:	83 c4 10             	add    $0x10,%esp
+  801e2c:	c9                   	leave
+  801e2d:	c3                   	ret
+
+00801e2e <getchar>:
+{
+  801e2e:	55                   	push   %ebp
+  801e2f:	89 e5                	mov    %esp,%ebp
+  801e31:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  801e34:	6a 01                	push   $0x1
+  801e36:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801e39:	50                   	push   %eax
+  801e3a:	6a 00                	push   $0x0
+  801e3c:	e8 66 f2 ff ff       	call   8010a7 <read>
+	if (r < 0)
+  801e41:	83 c4 10             	add    $0x10,%esp
+  801e44:	85 c0                	test   %eax,%eax
+  801e46:	78 06                	js     801e4e <getchar+0x20>
+	if (r < 1)
+  801e48:	74 06                	je     801e50 <getchar+0x22>
+	return c;
+  801e4a:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  801e4e:	c9                   	leave
+  801e4f:	c3                   	ret
+		return -E_EOF;
+  801e50:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  801e55:	eb f7                	jmp    801e4e <getchar+0x20>
+
+00801e57 <iscons>:
+{
+  801e57:	55                   	push   %ebp
+  801e58:	89 e5                	mov    %esp,%ebp
+  801e5a:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801e5d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e60:	50                   	push   %eax
+  801e61:	ff 75 08             	push   0x8(%ebp)
+  801e64:	e8 d8 ef ff ff       	call   800e41 <fd_lookup>
+  801e69:	83 c4 10             	add    $0x10,%esp
+  801e6c:	85 c0                	test   %eax,%eax
+  801e6e:	78 11                	js     801e81 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  801e70:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e73:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  801e79:	39 10                	cmp    %edx,(%eax)
+  801e7b:	0f 94 c0             	sete   %al
+  801e7e:	0f b6 c0             	movzbl %al,%eax
+}
+  801e81:	c9                   	leave
+  801e82:	c3                   	ret
+
+00801e83 <opencons>:
+{
+  801e83:	55                   	push   %ebp
+  801e84:	89 e5                	mov    %esp,%ebp
+  801e86:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  801e89:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e8c:	50                   	push   %eax
+  801e8d:	e8 59 ef ff ff       	call   800deb <fd_alloc>
+  801e92:	83 c4 10             	add    $0x10,%esp
+  801e95:	85 c0                	test   %eax,%eax
+  801e97:	78 3a                	js     801ed3 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  801e99:	83 ec 04             	sub    $0x4,%esp
+  801e9c:	68 07 04 00 00       	push   $0x407
+  801ea1:	ff 75 f4             	push   -0xc(%ebp)
+  801ea4:	6a 00                	push   $0x0
+  801ea6:	e8 46 ec ff ff       	call   800af1 <sys_page_alloc>
+  801eab:	83 c4 10             	add    $0x10,%esp
+  801eae:	85 c0                	test   %eax,%eax
+  801eb0:	78 21                	js     801ed3 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  801eb2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801eb5:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  801ebb:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  801ebd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ec0:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  801ec7:	83 ec 0c             	sub    $0xc,%esp
+  801eca:	50                   	push   %eax
+  801ecb:	e8 f4 ee ff ff       	call   800dc4 <fd2num>
+  801ed0:	83 c4 10             	add    $0x10,%esp
+}
+  801ed3:	c9                   	leave
+  801ed4:	c3                   	ret
+
+00801ed5 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  801ed5:	55                   	push   %ebp
+  801ed6:	89 e5                	mov    %esp,%ebp
+  801ed8:	56                   	push   %esi
+  801ed9:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  801eda:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  801edd:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  801ee3:	e8 cb eb ff ff       	call   800ab3 <sys_getenvid>
+  801ee8:	83 ec 0c             	sub    $0xc,%esp
+  801eeb:	ff 75 0c             	push   0xc(%ebp)
+  801eee:	ff 75 08             	push   0x8(%ebp)
+  801ef1:	56                   	push   %esi
+  801ef2:	50                   	push   %eax
+  801ef3:	68 78 29 80 00       	push   $0x802978
+  801ef8:	e8 4f e2 ff ff       	call   80014c <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  801efd:	83 c4 18             	add    $0x18,%esp
+  801f00:	53                   	push   %ebx
+  801f01:	ff 75 10             	push   0x10(%ebp)
+  801f04:	e8 f2 e1 ff ff       	call   8000fb <vcprintf>
+	cprintf("\n");
+  801f09:	c7 04 24 0c 25 80 00 	movl   $0x80250c,(%esp)
+  801f10:	e8 37 e2 ff ff       	call   80014c <cprintf>
+  801f15:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  801f18:	cc                   	int3
+	while (1)
+  801f19:	eb fd                	jmp    801f18 <_panic+0x43>
+
+00801f1b <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  801f1b:	55                   	push   %ebp
+  801f1c:	89 e5                	mov    %esp,%ebp
+  801f1e:	56                   	push   %esi
+  801f1f:	53                   	push   %ebx
+  801f20:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f23:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f26:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  801f29:	85 c0                	test   %eax,%eax
+  801f2b:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801f30:	0f 44 c2             	cmove  %edx,%eax
+  801f33:	83 ec 0c             	sub    $0xc,%esp
+  801f36:	50                   	push   %eax
+  801f37:	e8 65 ed ff ff       	call   800ca1 <sys_ipc_recv>
+
+  if (from_env_store)
+  801f3c:	83 c4 10             	add    $0x10,%esp
+  801f3f:	85 f6                	test   %esi,%esi
+  801f41:	74 17                	je     801f5a <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  801f43:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f48:	85 c0                	test   %eax,%eax
+  801f4a:	75 0c                	jne    801f58 <ipc_recv+0x3d>
+  801f4c:	8b 15 0c 40 80 00    	mov    0x80400c,%edx
+  801f52:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  801f58:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  801f5a:	85 db                	test   %ebx,%ebx
+  801f5c:	74 2b                	je     801f89 <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  801f5e:	85 c0                	test   %eax,%eax
+  801f60:	74 0d                	je     801f6f <ipc_recv+0x54>
+  801f62:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  801f68:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f6b:	5b                   	pop    %ebx
+  801f6c:	5e                   	pop    %esi
+  801f6d:	5d                   	pop    %ebp
+  801f6e:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  801f6f:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  801f74:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  801f7a:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  801f7c:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  801f81:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  801f87:	eb df                	jmp    801f68 <ipc_recv+0x4d>
+  801f89:	85 c0                	test   %eax,%eax
+  801f8b:	75 db                	jne    801f68 <ipc_recv+0x4d>
+  801f8d:	eb ed                	jmp    801f7c <ipc_recv+0x61>
+
+00801f8f <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  801f8f:	55                   	push   %ebp
+  801f90:	89 e5                	mov    %esp,%ebp
+  801f92:	57                   	push   %edi
+  801f93:	56                   	push   %esi
+  801f94:	53                   	push   %ebx
+  801f95:	83 ec 0c             	sub    $0xc,%esp
+  801f98:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801f9b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801f9e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  801fa1:	85 db                	test   %ebx,%ebx
+  801fa3:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801fa8:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  801fab:	ff 75 14             	push   0x14(%ebp)
+  801fae:	53                   	push   %ebx
+  801faf:	56                   	push   %esi
+  801fb0:	57                   	push   %edi
+  801fb1:	e8 c8 ec ff ff       	call   800c7e <sys_ipc_try_send>
+  801fb6:	83 c4 10             	add    $0x10,%esp
+  801fb9:	85 c0                	test   %eax,%eax
+  801fbb:	74 1e                	je     801fdb <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  801fbd:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801fc0:	75 07                	jne    801fc9 <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  801fc2:	e8 0b eb ff ff       	call   800ad2 <sys_yield>
+  801fc7:	eb e2                	jmp    801fab <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  801fc9:	50                   	push   %eax
+  801fca:	68 9b 29 80 00       	push   $0x80299b
+  801fcf:	6a 3c                	push   $0x3c
+  801fd1:	68 a8 29 80 00       	push   $0x8029a8
+  801fd6:	e8 fa fe ff ff       	call   801ed5 <_panic>
+  }
+
+#endif
+}
+  801fdb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fde:	5b                   	pop    %ebx
+  801fdf:	5e                   	pop    %esi
+  801fe0:	5f                   	pop    %edi
+  801fe1:	5d                   	pop    %ebp
+  801fe2:	c3                   	ret
+
+00801fe3 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  801fe3:	55                   	push   %ebp
+  801fe4:	89 e5                	mov    %esp,%ebp
+  801fe6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  801fe9:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  801fee:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  801ff1:	c1 e0 04             	shl    $0x4,%eax
+  801ff4:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801ff9:	8b 40 50             	mov    0x50(%eax),%eax
+  801ffc:	39 c8                	cmp    %ecx,%eax
+  801ffe:	74 12                	je     802012 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  802000:	83 c2 01             	add    $0x1,%edx
+  802003:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802009:	75 e3                	jne    801fee <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  80200b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802010:	eb 0e                	jmp    802020 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  802012:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802015:	c1 e0 04             	shl    $0x4,%eax
+  802018:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80201d:	8b 40 48             	mov    0x48(%eax),%eax
+  802020:	5d                   	pop    %ebp
+  802021:	c3                   	ret
+
+00802022 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802022:	55                   	push   %ebp
+  802023:	89 e5                	mov    %esp,%ebp
+  802025:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802028:	89 c2                	mov    %eax,%edx
+  80202a:	c1 ea 16             	shr    $0x16,%edx
+  80202d:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802034:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802039:	f6 c1 01             	test   $0x1,%cl
+  80203c:	74 1c                	je     80205a <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  80203e:	c1 e8 0c             	shr    $0xc,%eax
+  802041:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802048:	a8 01                	test   $0x1,%al
+  80204a:	74 0e                	je     80205a <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80204c:	c1 e8 0c             	shr    $0xc,%eax
+  80204f:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802056:	ef 
+  802057:	0f b7 d2             	movzwl %dx,%edx
+}
+  80205a:	89 d0                	mov    %edx,%eax
+  80205c:	5d                   	pop    %ebp
+  80205d:	c3                   	ret
+  80205e:	66 90                	xchg   %ax,%ax
+
+00802060 <__udivmoddi4>:
+  802060:	55                   	push   %ebp
+  802061:	57                   	push   %edi
+  802062:	56                   	push   %esi
+  802063:	53                   	push   %ebx
+  802064:	83 ec 24             	sub    $0x24,%esp
+  802067:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80206b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80206f:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  802073:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802077:	8b 54 24 44          	mov    0x44(%esp),%edx
+  80207b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80207f:	8b 44 24 40          	mov    0x40(%esp),%eax
+  802083:	89 d3                	mov    %edx,%ebx
+  802085:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802089:	09 c3                	or     %eax,%ebx
+  80208b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80208f:	0f 84 9c 00 00 00    	je     802131 <__udivmoddi4+0xd1>
+  802095:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80209c:	00 
+  80209d:	31 c0                	xor    %eax,%eax
+  80209f:	31 d2                	xor    %edx,%edx
+  8020a1:	89 fb                	mov    %edi,%ebx
+  8020a3:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8020aa:	00 
+  8020ab:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8020b0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8020b4:	01 c0                	add    %eax,%eax
+  8020b6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8020bd:	00 
+  8020be:	89 c6                	mov    %eax,%esi
+  8020c0:	89 d7                	mov    %edx,%edi
+  8020c2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8020c6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8020ca:	0f ad d0             	shrd   %cl,%edx,%eax
+  8020cd:	d3 ea                	shr    %cl,%edx
+  8020cf:	f6 c1 20             	test   $0x20,%cl
+  8020d2:	0f 45 c2             	cmovne %edx,%eax
+  8020d5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8020d9:	83 e0 01             	and    $0x1,%eax
+  8020dc:	09 fa                	or     %edi,%edx
+  8020de:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8020e2:	89 04 24             	mov    %eax,(%esp)
+  8020e5:	8b 04 24             	mov    (%esp),%eax
+  8020e8:	89 d5                	mov    %edx,%ebp
+  8020ea:	09 f0                	or     %esi,%eax
+  8020ec:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8020f0:	39 f0                	cmp    %esi,%eax
+  8020f2:	19 fd                	sbb    %edi,%ebp
+  8020f4:	72 1d                	jb     802113 <__udivmoddi4+0xb3>
+  8020f6:	29 f0                	sub    %esi,%eax
+  8020f8:	19 fa                	sbb    %edi,%edx
+  8020fa:	89 cf                	mov    %ecx,%edi
+  8020fc:	c1 ef 05             	shr    $0x5,%edi
+  8020ff:	83 e7 01             	and    $0x1,%edi
+  802102:	89 fe                	mov    %edi,%esi
+  802104:	d3 e7                	shl    %cl,%edi
+  802106:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80210a:	83 f6 01             	xor    $0x1,%esi
+  80210d:	d3 e6                	shl    %cl,%esi
+  80210f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802113:	83 e9 01             	sub    $0x1,%ecx
+  802116:	73 98                	jae    8020b0 <__udivmoddi4+0x50>
+  802118:	85 db                	test   %ebx,%ebx
+  80211a:	74 05                	je     802121 <__udivmoddi4+0xc1>
+  80211c:	89 03                	mov    %eax,(%ebx)
+  80211e:	89 53 04             	mov    %edx,0x4(%ebx)
+  802121:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802125:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802129:	83 c4 24             	add    $0x24,%esp
+  80212c:	5b                   	pop    %ebx
+  80212d:	5e                   	pop    %esi
+  80212e:	5f                   	pop    %edi
+  80212f:	5d                   	pop    %ebp
+  802130:	c3                   	ret
+  802131:	85 ff                	test   %edi,%edi
+  802133:	74 0d                	je     802142 <__udivmoddi4+0xe2>
+  802135:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  80213b:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  802142:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802146:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80214a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80214e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802152:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802156:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80215a:	83 c4 24             	add    $0x24,%esp
+  80215d:	5b                   	pop    %ebx
+  80215e:	5e                   	pop    %esi
+  80215f:	5f                   	pop    %edi
+  802160:	5d                   	pop    %ebp
+  802161:	c3                   	ret
+  802162:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802169:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00802170 <__udivdi3>:
+  802170:	57                   	push   %edi
+  802171:	56                   	push   %esi
+  802172:	53                   	push   %ebx
+  802173:	83 ec 20             	sub    $0x20,%esp
+  802176:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80217a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80217e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802182:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802186:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80218a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80218e:	89 d1                	mov    %edx,%ecx
+  802190:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802194:	09 c1                	or     %eax,%ecx
+  802196:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80219a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80219e:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  8021a2:	0f 84 88 00 00 00    	je     802230 <__udivdi3+0xc0>
+  8021a8:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8021af:	00 
+  8021b0:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8021b5:	31 c0                	xor    %eax,%eax
+  8021b7:	31 d2                	xor    %edx,%edx
+  8021b9:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8021c0:	00 
+  8021c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8021c8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8021cc:	01 c0                	add    %eax,%eax
+  8021ce:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8021d5:	00 
+  8021d6:	89 c6                	mov    %eax,%esi
+  8021d8:	89 d7                	mov    %edx,%edi
+  8021da:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8021de:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8021e2:	0f ad d0             	shrd   %cl,%edx,%eax
+  8021e5:	d3 ea                	shr    %cl,%edx
+  8021e7:	f6 c1 20             	test   $0x20,%cl
+  8021ea:	0f 45 c2             	cmovne %edx,%eax
+  8021ed:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8021f1:	83 e0 01             	and    $0x1,%eax
+  8021f4:	09 fa                	or     %edi,%edx
+  8021f6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8021fa:	89 04 24             	mov    %eax,(%esp)
+  8021fd:	8b 04 24             	mov    (%esp),%eax
+  802200:	89 d3                	mov    %edx,%ebx
+  802202:	09 f0                	or     %esi,%eax
+  802204:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802208:	39 f0                	cmp    %esi,%eax
+  80220a:	19 fb                	sbb    %edi,%ebx
+  80220c:	72 1d                	jb     80222b <__udivdi3+0xbb>
+  80220e:	29 f0                	sub    %esi,%eax
+  802210:	19 fa                	sbb    %edi,%edx
+  802212:	89 cf                	mov    %ecx,%edi
+  802214:	c1 ef 05             	shr    $0x5,%edi
+  802217:	83 e7 01             	and    $0x1,%edi
+  80221a:	89 fe                	mov    %edi,%esi
+  80221c:	d3 e7                	shl    %cl,%edi
+  80221e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802222:	83 f6 01             	xor    $0x1,%esi
+  802225:	d3 e6                	shl    %cl,%esi
+  802227:	09 74 24 18          	or     %esi,0x18(%esp)
+  80222b:	83 e9 01             	sub    $0x1,%ecx
+  80222e:	73 98                	jae    8021c8 <__udivdi3+0x58>
+  802230:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802234:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802238:	83 c4 20             	add    $0x20,%esp
+  80223b:	5b                   	pop    %ebx
+  80223c:	5e                   	pop    %esi
+  80223d:	5f                   	pop    %edi
+  80223e:	c3                   	ret
+  80223f:	90                   	nop
+
+00802240 <__umoddi3>:
+  802240:	57                   	push   %edi
+  802241:	56                   	push   %esi
+  802242:	53                   	push   %ebx
+  802243:	83 ec 18             	sub    $0x18,%esp
+  802246:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80224a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80224e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802252:	8b 54 24 34          	mov    0x34(%esp),%edx
+  802256:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80225a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80225e:	89 d1                	mov    %edx,%ecx
+  802260:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802264:	09 c1                	or     %eax,%ecx
+  802266:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80226a:	74 5b                	je     8022c7 <__umoddi3+0x87>
+  80226c:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802271:	31 c0                	xor    %eax,%eax
+  802273:	31 d2                	xor    %edx,%edx
+  802275:	8d 76 00             	lea    0x0(%esi),%esi
+  802278:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80227c:	01 c0                	add    %eax,%eax
+  80227e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802285:	00 
+  802286:	89 c6                	mov    %eax,%esi
+  802288:	89 d7                	mov    %edx,%edi
+  80228a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80228e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802292:	0f ad d0             	shrd   %cl,%edx,%eax
+  802295:	d3 ea                	shr    %cl,%edx
+  802297:	f6 c1 20             	test   $0x20,%cl
+  80229a:	0f 45 c2             	cmovne %edx,%eax
+  80229d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8022a1:	83 e0 01             	and    $0x1,%eax
+  8022a4:	09 fa                	or     %edi,%edx
+  8022a6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8022aa:	89 04 24             	mov    %eax,(%esp)
+  8022ad:	8b 04 24             	mov    (%esp),%eax
+  8022b0:	89 d3                	mov    %edx,%ebx
+  8022b2:	09 f0                	or     %esi,%eax
+  8022b4:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8022b8:	39 f0                	cmp    %esi,%eax
+  8022ba:	19 fb                	sbb    %edi,%ebx
+  8022bc:	72 04                	jb     8022c2 <__umoddi3+0x82>
+  8022be:	29 f0                	sub    %esi,%eax
+  8022c0:	19 fa                	sbb    %edi,%edx
+  8022c2:	83 e9 01             	sub    $0x1,%ecx
+  8022c5:	73 b1                	jae    802278 <__umoddi3+0x38>
+  8022c7:	83 c4 18             	add    $0x18,%esp
+  8022ca:	5b                   	pop    %ebx
+  8022cb:	5e                   	pop    %esi
+  8022cc:	5f                   	pop    %edi
+  8022cd:	c3                   	ret
+  8022ce:	66 90                	xchg   %ax,%ax
+
+008022d0 <__divdi3>:
+  8022d0:	55                   	push   %ebp
+  8022d1:	57                   	push   %edi
+  8022d2:	56                   	push   %esi
+  8022d3:	53                   	push   %ebx
+  8022d4:	83 ec 24             	sub    $0x24,%esp
+  8022d7:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  8022db:	8b 74 24 44          	mov    0x44(%esp),%esi
+  8022df:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8022e3:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8022e7:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  8022eb:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8022ef:	85 d2                	test   %edx,%edx
+  8022f1:	0f 88 e0 00 00 00    	js     8023d7 <__divdi3+0x107>
+  8022f7:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  8022fb:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  8022ff:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802303:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802307:	85 f6                	test   %esi,%esi
+  802309:	78 16                	js     802321 <__divdi3+0x51>
+  80230b:	89 f1                	mov    %esi,%ecx
+  80230d:	31 c0                	xor    %eax,%eax
+  80230f:	31 d2                	xor    %edx,%edx
+  802311:	09 d9                	or     %ebx,%ecx
+  802313:	0f 85 f3 00 00 00    	jne    80240c <__divdi3+0x13c>
+  802319:	83 c4 24             	add    $0x24,%esp
+  80231c:	5b                   	pop    %ebx
+  80231d:	5e                   	pop    %esi
+  80231e:	5f                   	pop    %edi
+  80231f:	5d                   	pop    %ebp
+  802320:	c3                   	ret
+  802321:	bf 01 00 00 00       	mov    $0x1,%edi
+  802326:	f7 5c 24 08          	negl   0x8(%esp)
+  80232a:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  80232f:	f7 5c 24 0c          	negl   0xc(%esp)
+  802333:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80233a:	00 
+  80233b:	31 c0                	xor    %eax,%eax
+  80233d:	31 d2                	xor    %edx,%edx
+  80233f:	89 fb                	mov    %edi,%ebx
+  802341:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802348:	00 
+  802349:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80234e:	66 90                	xchg   %ax,%ax
+  802350:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802354:	01 c0                	add    %eax,%eax
+  802356:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80235d:	00 
+  80235e:	89 c6                	mov    %eax,%esi
+  802360:	89 d7                	mov    %edx,%edi
+  802362:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802366:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80236a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80236d:	d3 ea                	shr    %cl,%edx
+  80236f:	f6 c1 20             	test   $0x20,%cl
+  802372:	0f 45 c2             	cmovne %edx,%eax
+  802375:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802379:	83 e0 01             	and    $0x1,%eax
+  80237c:	09 fa                	or     %edi,%edx
+  80237e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802382:	89 04 24             	mov    %eax,(%esp)
+  802385:	8b 04 24             	mov    (%esp),%eax
+  802388:	89 d5                	mov    %edx,%ebp
+  80238a:	09 f0                	or     %esi,%eax
+  80238c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802390:	39 f0                	cmp    %esi,%eax
+  802392:	19 fd                	sbb    %edi,%ebp
+  802394:	72 1d                	jb     8023b3 <__divdi3+0xe3>
+  802396:	29 f0                	sub    %esi,%eax
+  802398:	19 fa                	sbb    %edi,%edx
+  80239a:	89 cf                	mov    %ecx,%edi
+  80239c:	c1 ef 05             	shr    $0x5,%edi
+  80239f:	83 e7 01             	and    $0x1,%edi
+  8023a2:	89 fe                	mov    %edi,%esi
+  8023a4:	d3 e7                	shl    %cl,%edi
+  8023a6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8023aa:	83 f6 01             	xor    $0x1,%esi
+  8023ad:	d3 e6                	shl    %cl,%esi
+  8023af:	09 74 24 18          	or     %esi,0x18(%esp)
+  8023b3:	83 e9 01             	sub    $0x1,%ecx
+  8023b6:	73 98                	jae    802350 <__divdi3+0x80>
+  8023b8:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8023bc:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8023c0:	85 db                	test   %ebx,%ebx
+  8023c2:	0f 84 51 ff ff ff    	je     802319 <__divdi3+0x49>
+  8023c8:	f7 d8                	neg    %eax
+  8023ca:	83 d2 00             	adc    $0x0,%edx
+  8023cd:	83 c4 24             	add    $0x24,%esp
+  8023d0:	5b                   	pop    %ebx
+  8023d1:	f7 da                	neg    %edx
+  8023d3:	5e                   	pop    %esi
+  8023d4:	5f                   	pop    %edi
+  8023d5:	5d                   	pop    %ebp
+  8023d6:	c3                   	ret
+  8023d7:	f7 d8                	neg    %eax
+  8023d9:	83 d2 00             	adc    $0x0,%edx
+  8023dc:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8023e0:	f7 da                	neg    %edx
+  8023e2:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8023e6:	85 f6                	test   %esi,%esi
+  8023e8:	78 1b                	js     802405 <__divdi3+0x135>
+  8023ea:	89 f1                	mov    %esi,%ecx
+  8023ec:	31 c0                	xor    %eax,%eax
+  8023ee:	31 d2                	xor    %edx,%edx
+  8023f0:	bf 01 00 00 00       	mov    $0x1,%edi
+  8023f5:	09 d9                	or     %ebx,%ecx
+  8023f7:	0f 85 36 ff ff ff    	jne    802333 <__divdi3+0x63>
+  8023fd:	83 c4 24             	add    $0x24,%esp
+  802400:	5b                   	pop    %ebx
+  802401:	5e                   	pop    %esi
+  802402:	5f                   	pop    %edi
+  802403:	5d                   	pop    %ebp
+  802404:	c3                   	ret
+  802405:	31 ff                	xor    %edi,%edi
+  802407:	e9 1a ff ff ff       	jmp    802326 <__divdi3+0x56>
+  80240c:	31 ff                	xor    %edi,%edi
+  80240e:	e9 20 ff ff ff       	jmp    802333 <__divdi3+0x63>
+  802413:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80241a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00802420 <__moddi3>:
+  802420:	55                   	push   %ebp
+  802421:	57                   	push   %edi
+  802422:	56                   	push   %esi
+  802423:	53                   	push   %ebx
+  802424:	83 ec 1c             	sub    $0x1c,%esp
+  802427:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  80242b:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  80242f:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  802433:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  802437:	89 c8                	mov    %ecx,%eax
+  802439:	89 f2                	mov    %esi,%edx
+  80243b:	89 f3                	mov    %esi,%ebx
+  80243d:	85 ed                	test   %ebp,%ebp
+  80243f:	0f 88 9d 00 00 00    	js     8024e2 <__moddi3+0xc2>
+  802445:	09 cb                	or     %ecx,%ebx
+  802447:	0f 84 8d 00 00 00    	je     8024da <__moddi3+0xba>
+  80244d:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802451:	31 db                	xor    %ebx,%ebx
+  802453:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802457:	89 ca                	mov    %ecx,%edx
+  802459:	89 f0                	mov    %esi,%eax
+  80245b:	89 dd                	mov    %ebx,%ebp
+  80245d:	f7 da                	neg    %edx
+  80245f:	83 d0 00             	adc    $0x0,%eax
+  802462:	f7 d8                	neg    %eax
+  802464:	0f 49 f0             	cmovns %eax,%esi
+  802467:	0f 49 ca             	cmovns %edx,%ecx
+  80246a:	31 c0                	xor    %eax,%eax
+  80246c:	31 d2                	xor    %edx,%edx
+  80246e:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802472:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802476:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80247b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80247f:	90                   	nop
+  802480:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802484:	01 c0                	add    %eax,%eax
+  802486:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80248d:	00 
+  80248e:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  802492:	89 c6                	mov    %eax,%esi
+  802494:	89 d7                	mov    %edx,%edi
+  802496:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80249a:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80249e:	0f ad d0             	shrd   %cl,%edx,%eax
+  8024a1:	d3 ea                	shr    %cl,%edx
+  8024a3:	f6 c1 20             	test   $0x20,%cl
+  8024a6:	0f 45 c2             	cmovne %edx,%eax
+  8024a9:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8024ad:	83 e0 01             	and    $0x1,%eax
+  8024b0:	09 fa                	or     %edi,%edx
+  8024b2:	89 04 24             	mov    %eax,(%esp)
+  8024b5:	8b 04 24             	mov    (%esp),%eax
+  8024b8:	89 d7                	mov    %edx,%edi
+  8024ba:	09 f0                	or     %esi,%eax
+  8024bc:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  8024c0:	39 d8                	cmp    %ebx,%eax
+  8024c2:	19 f7                	sbb    %esi,%edi
+  8024c4:	72 04                	jb     8024ca <__moddi3+0xaa>
+  8024c6:	29 d8                	sub    %ebx,%eax
+  8024c8:	19 f2                	sbb    %esi,%edx
+  8024ca:	83 e9 01             	sub    $0x1,%ecx
+  8024cd:	73 b1                	jae    802480 <__moddi3+0x60>
+  8024cf:	85 ed                	test   %ebp,%ebp
+  8024d1:	74 07                	je     8024da <__moddi3+0xba>
+  8024d3:	f7 d8                	neg    %eax
+  8024d5:	83 d2 00             	adc    $0x0,%edx
+  8024d8:	f7 da                	neg    %edx
+  8024da:	83 c4 1c             	add    $0x1c,%esp
+  8024dd:	5b                   	pop    %ebx
+  8024de:	5e                   	pop    %esi
+  8024df:	5f                   	pop    %edi
+  8024e0:	5d                   	pop    %ebp
+  8024e1:	c3                   	ret
+  8024e2:	09 cb                	or     %ecx,%ebx
+  8024e4:	74 f4                	je     8024da <__moddi3+0xba>
+  8024e6:	f7 df                	neg    %edi
+  8024e8:	bb 01 00 00 00       	mov    $0x1,%ebx
+  8024ed:	83 d5 00             	adc    $0x0,%ebp
+  8024f0:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  8024f4:	f7 dd                	neg    %ebp
+  8024f6:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  8024fa:	e9 58 ff ff ff       	jmp    802457 <__moddi3+0x37>
@@ -0,0 +1,5460 @@
+
+obj/user/dumbfork.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 9d 01 00 00       	call   8001ce <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <duppage>:
+	}
+}
+
+void
+duppage(envid_t dstenv, void *addr)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	8b 75 08             	mov    0x8(%ebp),%esi
+  80003b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	// This is NOT what you should do in your fork.
+	if ((r = sys_page_alloc(dstenv, addr, PTE_P|PTE_U|PTE_W)) < 0)
+  80003e:	83 ec 04             	sub    $0x4,%esp
+  800041:	6a 07                	push   $0x7
+  800043:	53                   	push   %ebx
+  800044:	56                   	push   %esi
+  800045:	e8 67 0c 00 00       	call   800cb1 <sys_page_alloc>
+  80004a:	83 c4 10             	add    $0x10,%esp
+  80004d:	85 c0                	test   %eax,%eax
+  80004f:	78 4a                	js     80009b <duppage+0x68>
+		panic("sys_page_alloc: %e", r);
+	if ((r = sys_page_map(dstenv, addr, 0, UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  800051:	83 ec 0c             	sub    $0xc,%esp
+  800054:	6a 07                	push   $0x7
+  800056:	68 00 00 40 00       	push   $0x400000
+  80005b:	6a 00                	push   $0x0
+  80005d:	53                   	push   %ebx
+  80005e:	56                   	push   %esi
+  80005f:	e8 90 0c 00 00       	call   800cf4 <sys_page_map>
+  800064:	83 c4 20             	add    $0x20,%esp
+  800067:	85 c0                	test   %eax,%eax
+  800069:	78 42                	js     8000ad <duppage+0x7a>
+		panic("sys_page_map: %e", r);
+	memmove(UTEMP, addr, PGSIZE);
+  80006b:	83 ec 04             	sub    $0x4,%esp
+  80006e:	68 00 10 00 00       	push   $0x1000
+  800073:	53                   	push   %ebx
+  800074:	68 00 00 40 00       	push   $0x400000
+  800079:	e8 cd 09 00 00       	call   800a4b <memmove>
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  80007e:	83 c4 08             	add    $0x8,%esp
+  800081:	68 00 00 40 00       	push   $0x400000
+  800086:	6a 00                	push   $0x0
+  800088:	e8 a9 0c 00 00       	call   800d36 <sys_page_unmap>
+  80008d:	83 c4 10             	add    $0x10,%esp
+  800090:	85 c0                	test   %eax,%eax
+  800092:	78 2b                	js     8000bf <duppage+0x8c>
+		panic("sys_page_unmap: %e", r);
+}
+  800094:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800097:	5b                   	pop    %ebx
+  800098:	5e                   	pop    %esi
+  800099:	5d                   	pop    %ebp
+  80009a:	c3                   	ret
+		panic("sys_page_alloc: %e", r);
+  80009b:	50                   	push   %eax
+  80009c:	68 80 26 80 00       	push   $0x802680
+  8000a1:	6a 20                	push   $0x20
+  8000a3:	68 93 26 80 00       	push   $0x802693
+  8000a8:	e8 84 01 00 00       	call   800231 <_panic>
+		panic("sys_page_map: %e", r);
+  8000ad:	50                   	push   %eax
+  8000ae:	68 a3 26 80 00       	push   $0x8026a3
+  8000b3:	6a 22                	push   $0x22
+  8000b5:	68 93 26 80 00       	push   $0x802693
+  8000ba:	e8 72 01 00 00       	call   800231 <_panic>
+		panic("sys_page_unmap: %e", r);
+  8000bf:	50                   	push   %eax
+  8000c0:	68 b4 26 80 00       	push   $0x8026b4
+  8000c5:	6a 25                	push   $0x25
+  8000c7:	68 93 26 80 00       	push   $0x802693
+  8000cc:	e8 60 01 00 00       	call   800231 <_panic>
+
+008000d1 <dumbfork>:
+
+envid_t
+dumbfork(void)
+{
+  8000d1:	55                   	push   %ebp
+  8000d2:	89 e5                	mov    %esp,%ebp
+  8000d4:	53                   	push   %ebx
+  8000d5:	83 ec 14             	sub    $0x14,%esp
+
+// This must be inlined.  Exercise for reader: why?
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+  envid_t ret;
+  asm volatile("int %2"
+  8000d8:	b8 07 00 00 00       	mov    $0x7,%eax
+  8000dd:	cd 30                	int    $0x30
+  8000df:	89 c3                	mov    %eax,%ebx
+	// The kernel will initialize it with a copy of our register state,
+	// so that the child will appear to have called sys_exofork() too -
+	// except that in the child, this "fake" call to sys_exofork()
+	// will return 0 instead of the envid of the child.
+	envid = sys_exofork();
+	if (envid < 0)
+  8000e1:	85 c0                	test   %eax,%eax
+  8000e3:	78 23                	js     800108 <dumbfork+0x37>
+		panic("sys_exofork: %e", envid);
+	if (envid == 0) {
+  8000e5:	ba 00 00 80 00       	mov    $0x800000,%edx
+  8000ea:	75 44                	jne    800130 <dumbfork+0x5f>
+		// We're the child.
+		// The copied value of the global variable 'thisenv'
+		// is no longer valid (it refers to the parent!).
+		// Fix it and return 0.
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8000ec:	e8 82 0b 00 00       	call   800c73 <sys_getenvid>
+  8000f1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000f6:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8000f9:	c1 e0 04             	shl    $0x4,%eax
+  8000fc:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800101:	a3 08 40 80 00       	mov    %eax,0x804008
+		return 0;
+  800106:	eb 57                	jmp    80015f <dumbfork+0x8e>
+		panic("sys_exofork: %e", envid);
+  800108:	50                   	push   %eax
+  800109:	68 c7 26 80 00       	push   $0x8026c7
+  80010e:	6a 37                	push   $0x37
+  800110:	68 93 26 80 00       	push   $0x802693
+  800115:	e8 17 01 00 00       	call   800231 <_panic>
+
+	// We're the parent.
+	// Eagerly copy our entire address space into the child.
+	// This is NOT what you should do in your fork implementation.
+	for (addr = (uint8_t*) UTEXT; addr < end; addr += PGSIZE)
+		duppage(envid, addr);
+  80011a:	83 ec 08             	sub    $0x8,%esp
+  80011d:	52                   	push   %edx
+  80011e:	53                   	push   %ebx
+  80011f:	e8 0f ff ff ff       	call   800033 <duppage>
+	for (addr = (uint8_t*) UTEXT; addr < end; addr += PGSIZE)
+  800124:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800127:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80012d:	83 c4 10             	add    $0x10,%esp
+  800130:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  800133:	81 fa 00 70 80 00    	cmp    $0x807000,%edx
+  800139:	72 df                	jb     80011a <dumbfork+0x49>
+
+	// Also copy the stack we are currently running on.
+	duppage(envid, ROUNDDOWN(&addr, PGSIZE));
+  80013b:	83 ec 08             	sub    $0x8,%esp
+  80013e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800141:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800146:	50                   	push   %eax
+  800147:	53                   	push   %ebx
+  800148:	e8 e6 fe ff ff       	call   800033 <duppage>
+
+	// Start the child environment running
+	if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  80014d:	83 c4 08             	add    $0x8,%esp
+  800150:	6a 02                	push   $0x2
+  800152:	53                   	push   %ebx
+  800153:	e8 20 0c 00 00       	call   800d78 <sys_env_set_status>
+  800158:	83 c4 10             	add    $0x10,%esp
+  80015b:	85 c0                	test   %eax,%eax
+  80015d:	78 07                	js     800166 <dumbfork+0x95>
+		panic("sys_env_set_status: %e", r);
+
+	return envid;
+}
+  80015f:	89 d8                	mov    %ebx,%eax
+  800161:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800164:	c9                   	leave
+  800165:	c3                   	ret
+		panic("sys_env_set_status: %e", r);
+  800166:	50                   	push   %eax
+  800167:	68 d7 26 80 00       	push   $0x8026d7
+  80016c:	6a 4c                	push   $0x4c
+  80016e:	68 93 26 80 00       	push   $0x802693
+  800173:	e8 b9 00 00 00       	call   800231 <_panic>
+
+00800178 <umain>:
+{
+  800178:	55                   	push   %ebp
+  800179:	89 e5                	mov    %esp,%ebp
+  80017b:	57                   	push   %edi
+  80017c:	56                   	push   %esi
+  80017d:	53                   	push   %ebx
+  80017e:	83 ec 0c             	sub    $0xc,%esp
+	who = dumbfork();
+  800181:	e8 4b ff ff ff       	call   8000d1 <dumbfork>
+  800186:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < (who ? 10 : 20); i++) {
+  800188:	85 c0                	test   %eax,%eax
+  80018a:	bf ee 26 80 00       	mov    $0x8026ee,%edi
+  80018f:	b8 f5 26 80 00       	mov    $0x8026f5,%eax
+  800194:	0f 44 f8             	cmove  %eax,%edi
+  800197:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80019c:	eb 1f                	jmp    8001bd <umain+0x45>
+  80019e:	83 fb 13             	cmp    $0x13,%ebx
+  8001a1:	7f 23                	jg     8001c6 <umain+0x4e>
+		cprintf("%d: I am the %s!\n", i, who ? "parent" : "child");
+  8001a3:	83 ec 04             	sub    $0x4,%esp
+  8001a6:	57                   	push   %edi
+  8001a7:	53                   	push   %ebx
+  8001a8:	68 fb 26 80 00       	push   $0x8026fb
+  8001ad:	e8 5a 01 00 00       	call   80030c <cprintf>
+		sys_yield();
+  8001b2:	e8 db 0a 00 00       	call   800c92 <sys_yield>
+	for (i = 0; i < (who ? 10 : 20); i++) {
+  8001b7:	83 c3 01             	add    $0x1,%ebx
+  8001ba:	83 c4 10             	add    $0x10,%esp
+  8001bd:	85 f6                	test   %esi,%esi
+  8001bf:	74 dd                	je     80019e <umain+0x26>
+  8001c1:	83 fb 09             	cmp    $0x9,%ebx
+  8001c4:	7e dd                	jle    8001a3 <umain+0x2b>
+}
+  8001c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001c9:	5b                   	pop    %ebx
+  8001ca:	5e                   	pop    %esi
+  8001cb:	5f                   	pop    %edi
+  8001cc:	5d                   	pop    %ebp
+  8001cd:	c3                   	ret
+
+008001ce <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  8001ce:	55                   	push   %ebp
+  8001cf:	89 e5                	mov    %esp,%ebp
+  8001d1:	56                   	push   %esi
+  8001d2:	53                   	push   %ebx
+  8001d3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001d6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  8001d9:	e8 95 0a 00 00       	call   800c73 <sys_getenvid>
+  8001de:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001e3:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8001e6:	c1 e0 04             	shl    $0x4,%eax
+  8001e9:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001ee:	a3 08 40 80 00       	mov    %eax,0x804008
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8001f3:	85 db                	test   %ebx,%ebx
+  8001f5:	7e 07                	jle    8001fe <libmain+0x30>
+    binaryname = argv[0];
+  8001f7:	8b 06                	mov    (%esi),%eax
+  8001f9:	a3 00 30 80 00       	mov    %eax,0x803000
+
+  // call user main routine
+  umain(argc, argv);
+  8001fe:	83 ec 08             	sub    $0x8,%esp
+  800201:	56                   	push   %esi
+  800202:	53                   	push   %ebx
+  800203:	e8 70 ff ff ff       	call   800178 <umain>
+
+  // exit gracefully
+  exit();
+  800208:	e8 0a 00 00 00       	call   800217 <exit>
+}
+  80020d:	83 c4 10             	add    $0x10,%esp
+  800210:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800213:	5b                   	pop    %ebx
+  800214:	5e                   	pop    %esi
+  800215:	5d                   	pop    %ebp
+  800216:	c3                   	ret
+
+00800217 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800217:	55                   	push   %ebp
+  800218:	89 e5                	mov    %esp,%ebp
+  80021a:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80021d:	e8 36 0f 00 00       	call   801158 <close_all>
+	sys_env_destroy(0);
+  800222:	83 ec 0c             	sub    $0xc,%esp
+  800225:	6a 00                	push   $0x0
+  800227:	e8 06 0a 00 00       	call   800c32 <sys_env_destroy>
+}
+  80022c:	83 c4 10             	add    $0x10,%esp
+  80022f:	c9                   	leave
+  800230:	c3                   	ret
+
+00800231 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800231:	55                   	push   %ebp
+  800232:	89 e5                	mov    %esp,%ebp
+  800234:	56                   	push   %esi
+  800235:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800236:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800239:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  80023f:	e8 2f 0a 00 00       	call   800c73 <sys_getenvid>
+  800244:	83 ec 0c             	sub    $0xc,%esp
+  800247:	ff 75 0c             	push   0xc(%ebp)
+  80024a:	ff 75 08             	push   0x8(%ebp)
+  80024d:	56                   	push   %esi
+  80024e:	50                   	push   %eax
+  80024f:	68 18 27 80 00       	push   $0x802718
+  800254:	e8 b3 00 00 00       	call   80030c <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800259:	83 c4 18             	add    $0x18,%esp
+  80025c:	53                   	push   %ebx
+  80025d:	ff 75 10             	push   0x10(%ebp)
+  800260:	e8 56 00 00 00       	call   8002bb <vcprintf>
+	cprintf("\n");
+  800265:	c7 04 24 0b 27 80 00 	movl   $0x80270b,(%esp)
+  80026c:	e8 9b 00 00 00       	call   80030c <cprintf>
+  800271:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800274:	cc                   	int3
+	while (1)
+  800275:	eb fd                	jmp    800274 <_panic+0x43>
+
+00800277 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800277:	55                   	push   %ebp
+  800278:	89 e5                	mov    %esp,%ebp
+  80027a:	53                   	push   %ebx
+  80027b:	83 ec 04             	sub    $0x4,%esp
+  80027e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800281:	8b 13                	mov    (%ebx),%edx
+  800283:	8d 42 01             	lea    0x1(%edx),%eax
+  800286:	89 03                	mov    %eax,(%ebx)
+  800288:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80028b:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80028f:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800294:	74 09                	je     80029f <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800296:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80029a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80029d:	c9                   	leave
+  80029e:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80029f:	83 ec 08             	sub    $0x8,%esp
+  8002a2:	68 ff 00 00 00       	push   $0xff
+  8002a7:	8d 43 08             	lea    0x8(%ebx),%eax
+  8002aa:	50                   	push   %eax
+  8002ab:	e8 45 09 00 00       	call   800bf5 <sys_cputs>
+		b->idx = 0;
+  8002b0:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8002b6:	83 c4 10             	add    $0x10,%esp
+  8002b9:	eb db                	jmp    800296 <putch+0x1f>
+
+008002bb <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8002bb:	55                   	push   %ebp
+  8002bc:	89 e5                	mov    %esp,%ebp
+  8002be:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8002c4:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8002cb:	00 00 00 
+	b.cnt = 0;
+  8002ce:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8002d5:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8002d8:	ff 75 0c             	push   0xc(%ebp)
+  8002db:	ff 75 08             	push   0x8(%ebp)
+  8002de:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8002e4:	50                   	push   %eax
+  8002e5:	68 77 02 80 00       	push   $0x800277
+  8002ea:	e8 14 01 00 00       	call   800403 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8002ef:	83 c4 08             	add    $0x8,%esp
+  8002f2:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8002f8:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8002fe:	50                   	push   %eax
+  8002ff:	e8 f1 08 00 00       	call   800bf5 <sys_cputs>
+
+	return b.cnt;
+}
+  800304:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80030a:	c9                   	leave
+  80030b:	c3                   	ret
+
+0080030c <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80030c:	55                   	push   %ebp
+  80030d:	89 e5                	mov    %esp,%ebp
+  80030f:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800312:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800315:	50                   	push   %eax
+  800316:	ff 75 08             	push   0x8(%ebp)
+  800319:	e8 9d ff ff ff       	call   8002bb <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80031e:	c9                   	leave
+  80031f:	c3                   	ret
+
+00800320 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800320:	55                   	push   %ebp
+  800321:	89 e5                	mov    %esp,%ebp
+  800323:	57                   	push   %edi
+  800324:	56                   	push   %esi
+  800325:	53                   	push   %ebx
+  800326:	83 ec 1c             	sub    $0x1c,%esp
+  800329:	89 c7                	mov    %eax,%edi
+  80032b:	89 d6                	mov    %edx,%esi
+  80032d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800330:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800333:	89 d1                	mov    %edx,%ecx
+  800335:	89 c2                	mov    %eax,%edx
+  800337:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80033a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80033d:	8b 45 10             	mov    0x10(%ebp),%eax
+  800340:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800343:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800346:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80034d:	39 c2                	cmp    %eax,%edx
+  80034f:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800352:	72 3e                	jb     800392 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800354:	83 ec 0c             	sub    $0xc,%esp
+  800357:	ff 75 18             	push   0x18(%ebp)
+  80035a:	83 eb 01             	sub    $0x1,%ebx
+  80035d:	53                   	push   %ebx
+  80035e:	50                   	push   %eax
+  80035f:	83 ec 08             	sub    $0x8,%esp
+  800362:	ff 75 e4             	push   -0x1c(%ebp)
+  800365:	ff 75 e0             	push   -0x20(%ebp)
+  800368:	ff 75 dc             	push   -0x24(%ebp)
+  80036b:	ff 75 d8             	push   -0x28(%ebp)
+  80036e:	e8 7d 1f 00 00       	call   8022f0 <__udivdi3>
+  800373:	83 c4 18             	add    $0x18,%esp
+  800376:	52                   	push   %edx
+  800377:	50                   	push   %eax
+  800378:	89 f2                	mov    %esi,%edx
+  80037a:	89 f8                	mov    %edi,%eax
+  80037c:	e8 9f ff ff ff       	call   800320 <printnum>
+  800381:	83 c4 20             	add    $0x20,%esp
+  800384:	eb 13                	jmp    800399 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800386:	83 ec 08             	sub    $0x8,%esp
+  800389:	56                   	push   %esi
+  80038a:	ff 75 18             	push   0x18(%ebp)
+  80038d:	ff d7                	call   *%edi
+  80038f:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800392:	83 eb 01             	sub    $0x1,%ebx
+  800395:	85 db                	test   %ebx,%ebx
+  800397:	7f ed                	jg     800386 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800399:	83 ec 08             	sub    $0x8,%esp
+  80039c:	56                   	push   %esi
+  80039d:	83 ec 04             	sub    $0x4,%esp
+  8003a0:	ff 75 e4             	push   -0x1c(%ebp)
+  8003a3:	ff 75 e0             	push   -0x20(%ebp)
+  8003a6:	ff 75 dc             	push   -0x24(%ebp)
+  8003a9:	ff 75 d8             	push   -0x28(%ebp)
+  8003ac:	e8 0f 20 00 00       	call   8023c0 <__umoddi3>
+  8003b1:	83 c4 14             	add    $0x14,%esp
+  8003b4:	0f be 80 3b 27 80 00 	movsbl 0x80273b(%eax),%eax
+  8003bb:	50                   	push   %eax
+  8003bc:	ff d7                	call   *%edi
+}
+  8003be:	83 c4 10             	add    $0x10,%esp
+  8003c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003c4:	5b                   	pop    %ebx
+  8003c5:	5e                   	pop    %esi
+  8003c6:	5f                   	pop    %edi
+  8003c7:	5d                   	pop    %ebp
+  8003c8:	c3                   	ret
+
+008003c9 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8003c9:	55                   	push   %ebp
+  8003ca:	89 e5                	mov    %esp,%ebp
+  8003cc:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8003cf:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8003d3:	8b 10                	mov    (%eax),%edx
+  8003d5:	3b 50 04             	cmp    0x4(%eax),%edx
+  8003d8:	73 0a                	jae    8003e4 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8003da:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8003dd:	89 08                	mov    %ecx,(%eax)
+  8003df:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003e2:	88 02                	mov    %al,(%edx)
+}
+  8003e4:	5d                   	pop    %ebp
+  8003e5:	c3                   	ret
+
+008003e6 <printfmt>:
+{
+  8003e6:	55                   	push   %ebp
+  8003e7:	89 e5                	mov    %esp,%ebp
+  8003e9:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8003ec:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8003ef:	50                   	push   %eax
+  8003f0:	ff 75 10             	push   0x10(%ebp)
+  8003f3:	ff 75 0c             	push   0xc(%ebp)
+  8003f6:	ff 75 08             	push   0x8(%ebp)
+  8003f9:	e8 05 00 00 00       	call   800403 <vprintfmt>
+}
+  8003fe:	83 c4 10             	add    $0x10,%esp
+  800401:	c9                   	leave
+  800402:	c3                   	ret
+
+00800403 <vprintfmt>:
+{
+  800403:	55                   	push   %ebp
+  800404:	89 e5                	mov    %esp,%ebp
+  800406:	57                   	push   %edi
+  800407:	56                   	push   %esi
+  800408:	53                   	push   %ebx
+  800409:	83 ec 2c             	sub    $0x2c,%esp
+  80040c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80040f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800412:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800415:	eb 0a                	jmp    800421 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800417:	83 ec 08             	sub    $0x8,%esp
+  80041a:	53                   	push   %ebx
+  80041b:	50                   	push   %eax
+  80041c:	ff d6                	call   *%esi
+  80041e:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800421:	83 c7 01             	add    $0x1,%edi
+  800424:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800428:	83 f8 25             	cmp    $0x25,%eax
+  80042b:	74 0c                	je     800439 <vprintfmt+0x36>
+			if (ch == '\0')
+  80042d:	85 c0                	test   %eax,%eax
+  80042f:	75 e6                	jne    800417 <vprintfmt+0x14>
+}
+  800431:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800434:	5b                   	pop    %ebx
+  800435:	5e                   	pop    %esi
+  800436:	5f                   	pop    %edi
+  800437:	5d                   	pop    %ebp
+  800438:	c3                   	ret
+		padc = ' ';
+  800439:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80043d:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800444:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80044b:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800452:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800457:	8d 47 01             	lea    0x1(%edi),%eax
+  80045a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80045d:	0f b6 17             	movzbl (%edi),%edx
+  800460:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800463:	3c 55                	cmp    $0x55,%al
+  800465:	0f 87 9a 03 00 00    	ja     800805 <vprintfmt+0x402>
+  80046b:	0f b6 c0             	movzbl %al,%eax
+  80046e:	ff 24 85 80 28 80 00 	jmp    *0x802880(,%eax,4)
+  800475:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800478:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80047c:	eb d9                	jmp    800457 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80047e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800481:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800485:	eb d0                	jmp    800457 <vprintfmt+0x54>
+  800487:	0f b6 d2             	movzbl %dl,%edx
+  80048a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80048d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800492:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800495:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800498:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80049c:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80049f:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8004a2:	83 f9 09             	cmp    $0x9,%ecx
+  8004a5:	77 55                	ja     8004fc <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8004a7:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8004aa:	eb e9                	jmp    800495 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8004ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004af:	8b 00                	mov    (%eax),%eax
+  8004b1:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004b4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004b7:	8d 40 04             	lea    0x4(%eax),%eax
+  8004ba:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004bd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8004c0:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004c4:	79 91                	jns    800457 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8004c6:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004c9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004cc:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8004d3:	eb 82                	jmp    800457 <vprintfmt+0x54>
+			if (width < 0)
+  8004d5:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004d8:	85 d2                	test   %edx,%edx
+  8004da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004df:	0f 49 c2             	cmovns %edx,%eax
+  8004e2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004e5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8004e8:	e9 6a ff ff ff       	jmp    800457 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004ed:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8004f0:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8004f7:	e9 5b ff ff ff       	jmp    800457 <vprintfmt+0x54>
+  8004fc:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8004ff:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800502:	eb bc                	jmp    8004c0 <vprintfmt+0xbd>
+			lflag++;
+  800504:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800507:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80050a:	e9 48 ff ff ff       	jmp    800457 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80050f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800512:	8d 78 04             	lea    0x4(%eax),%edi
+  800515:	83 ec 08             	sub    $0x8,%esp
+  800518:	53                   	push   %ebx
+  800519:	ff 30                	push   (%eax)
+  80051b:	ff d6                	call   *%esi
+			break;
+  80051d:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800520:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800523:	e9 7c 02 00 00       	jmp    8007a4 <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  800528:	8b 45 14             	mov    0x14(%ebp),%eax
+  80052b:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80052e:	8b 10                	mov    (%eax),%edx
+  800530:	89 d0                	mov    %edx,%eax
+  800532:	f7 d8                	neg    %eax
+  800534:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800537:	83 f8 10             	cmp    $0x10,%eax
+  80053a:	7f 23                	jg     80055f <vprintfmt+0x15c>
+  80053c:	8b 14 85 e0 29 80 00 	mov    0x8029e0(,%eax,4),%edx
+  800543:	85 d2                	test   %edx,%edx
+  800545:	74 18                	je     80055f <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800547:	52                   	push   %edx
+  800548:	68 19 2b 80 00       	push   $0x802b19
+  80054d:	53                   	push   %ebx
+  80054e:	56                   	push   %esi
+  80054f:	e8 92 fe ff ff       	call   8003e6 <printfmt>
+  800554:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800557:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80055a:	e9 45 02 00 00       	jmp    8007a4 <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  80055f:	50                   	push   %eax
+  800560:	68 53 27 80 00       	push   $0x802753
+  800565:	53                   	push   %ebx
+  800566:	56                   	push   %esi
+  800567:	e8 7a fe ff ff       	call   8003e6 <printfmt>
+  80056c:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80056f:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800572:	e9 2d 02 00 00       	jmp    8007a4 <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800577:	8b 45 14             	mov    0x14(%ebp),%eax
+  80057a:	83 c0 04             	add    $0x4,%eax
+  80057d:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800580:	8b 45 14             	mov    0x14(%ebp),%eax
+  800583:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800585:	85 c9                	test   %ecx,%ecx
+  800587:	b8 4c 27 80 00       	mov    $0x80274c,%eax
+  80058c:	0f 45 c1             	cmovne %ecx,%eax
+  80058f:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800592:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800596:	7e 06                	jle    80059e <vprintfmt+0x19b>
+  800598:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80059c:	75 0b                	jne    8005a9 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80059e:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8005a1:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8005a4:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005a7:	eb 5c                	jmp    800605 <vprintfmt+0x202>
+  8005a9:	83 ec 08             	sub    $0x8,%esp
+  8005ac:	ff 75 d0             	push   -0x30(%ebp)
+  8005af:	ff 75 cc             	push   -0x34(%ebp)
+  8005b2:	e8 eb 02 00 00       	call   8008a2 <strnlen>
+  8005b7:	89 c2                	mov    %eax,%edx
+  8005b9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005bc:	29 d0                	sub    %edx,%eax
+  8005be:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8005c1:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8005c5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005c8:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005cb:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005cd:	eb 0e                	jmp    8005dd <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8005cf:	83 ec 08             	sub    $0x8,%esp
+  8005d2:	53                   	push   %ebx
+  8005d3:	57                   	push   %edi
+  8005d4:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005d7:	83 ee 01             	sub    $0x1,%esi
+  8005da:	83 c4 10             	add    $0x10,%esp
+  8005dd:	85 f6                	test   %esi,%esi
+  8005df:	7f ee                	jg     8005cf <vprintfmt+0x1cc>
+  8005e1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005e4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005e7:	85 c0                	test   %eax,%eax
+  8005e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005ee:	0f 49 d0             	cmovns %eax,%edx
+  8005f1:	29 d0                	sub    %edx,%eax
+  8005f3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005f6:	eb a6                	jmp    80059e <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8005f8:	83 ec 08             	sub    $0x8,%esp
+  8005fb:	53                   	push   %ebx
+  8005fc:	52                   	push   %edx
+  8005fd:	ff 55 08             	call   *0x8(%ebp)
+  800600:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800603:	89 f1                	mov    %esi,%ecx
+  800605:	8d 71 01             	lea    0x1(%ecx),%esi
+  800608:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80060c:	0f be d0             	movsbl %al,%edx
+  80060f:	85 d2                	test   %edx,%edx
+  800611:	74 28                	je     80063b <vprintfmt+0x238>
+  800613:	85 ff                	test   %edi,%edi
+  800615:	78 05                	js     80061c <vprintfmt+0x219>
+  800617:	83 ef 01             	sub    $0x1,%edi
+  80061a:	78 30                	js     80064c <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80061c:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800620:	74 d6                	je     8005f8 <vprintfmt+0x1f5>
+  800622:	0f be c0             	movsbl %al,%eax
+  800625:	83 e8 20             	sub    $0x20,%eax
+  800628:	83 f8 5e             	cmp    $0x5e,%eax
+  80062b:	76 cb                	jbe    8005f8 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80062d:	83 ec 08             	sub    $0x8,%esp
+  800630:	53                   	push   %ebx
+  800631:	6a 3f                	push   $0x3f
+  800633:	ff 55 08             	call   *0x8(%ebp)
+  800636:	83 c4 10             	add    $0x10,%esp
+  800639:	eb c8                	jmp    800603 <vprintfmt+0x200>
+  80063b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80063e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800641:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800644:	01 d0                	add    %edx,%eax
+  800646:	29 c8                	sub    %ecx,%eax
+  800648:	89 c7                	mov    %eax,%edi
+  80064a:	eb 13                	jmp    80065f <vprintfmt+0x25c>
+  80064c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80064f:	eb ed                	jmp    80063e <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800651:	83 ec 08             	sub    $0x8,%esp
+  800654:	53                   	push   %ebx
+  800655:	6a 20                	push   $0x20
+  800657:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800659:	83 ef 01             	sub    $0x1,%edi
+  80065c:	83 c4 10             	add    $0x10,%esp
+  80065f:	85 ff                	test   %edi,%edi
+  800661:	7f ee                	jg     800651 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800663:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800666:	89 45 14             	mov    %eax,0x14(%ebp)
+  800669:	e9 36 01 00 00       	jmp    8007a4 <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  80066e:	83 f9 01             	cmp    $0x1,%ecx
+  800671:	7f 1f                	jg     800692 <vprintfmt+0x28f>
+	else if (lflag)
+  800673:	85 c9                	test   %ecx,%ecx
+  800675:	74 67                	je     8006de <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800677:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067a:	8b 00                	mov    (%eax),%eax
+  80067c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80067f:	89 c1                	mov    %eax,%ecx
+  800681:	c1 f9 1f             	sar    $0x1f,%ecx
+  800684:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800687:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068a:	8d 40 04             	lea    0x4(%eax),%eax
+  80068d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800690:	eb 17                	jmp    8006a9 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800692:	8b 45 14             	mov    0x14(%ebp),%eax
+  800695:	8b 50 04             	mov    0x4(%eax),%edx
+  800698:	8b 00                	mov    (%eax),%eax
+  80069a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80069d:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8006a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a3:	8d 40 08             	lea    0x8(%eax),%eax
+  8006a6:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8006a9:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006ac:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8006af:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8006b4:	85 c9                	test   %ecx,%ecx
+  8006b6:	0f 89 ce 00 00 00    	jns    80078a <vprintfmt+0x387>
+				putch('-', putdat);
+  8006bc:	83 ec 08             	sub    $0x8,%esp
+  8006bf:	53                   	push   %ebx
+  8006c0:	6a 2d                	push   $0x2d
+  8006c2:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8006c4:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006c7:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8006ca:	f7 da                	neg    %edx
+  8006cc:	83 d1 00             	adc    $0x0,%ecx
+  8006cf:	f7 d9                	neg    %ecx
+  8006d1:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8006d4:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8006d9:	e9 ac 00 00 00       	jmp    80078a <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  8006de:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e1:	8b 00                	mov    (%eax),%eax
+  8006e3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006e6:	89 c1                	mov    %eax,%ecx
+  8006e8:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006eb:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006ee:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f1:	8d 40 04             	lea    0x4(%eax),%eax
+  8006f4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006f7:	eb b0                	jmp    8006a9 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8006f9:	83 f9 01             	cmp    $0x1,%ecx
+  8006fc:	7f 1b                	jg     800719 <vprintfmt+0x316>
+	else if (lflag)
+  8006fe:	85 c9                	test   %ecx,%ecx
+  800700:	74 2c                	je     80072e <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  800702:	8b 45 14             	mov    0x14(%ebp),%eax
+  800705:	8b 10                	mov    (%eax),%edx
+  800707:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80070c:	8d 40 04             	lea    0x4(%eax),%eax
+  80070f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800712:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800717:	eb 71                	jmp    80078a <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  800719:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071c:	8b 10                	mov    (%eax),%edx
+  80071e:	8b 48 04             	mov    0x4(%eax),%ecx
+  800721:	8d 40 08             	lea    0x8(%eax),%eax
+  800724:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800727:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80072c:	eb 5c                	jmp    80078a <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  80072e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800731:	8b 10                	mov    (%eax),%edx
+  800733:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800738:	8d 40 04             	lea    0x4(%eax),%eax
+  80073b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80073e:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800743:	eb 45                	jmp    80078a <vprintfmt+0x387>
+			putch('X', putdat);
+  800745:	83 ec 08             	sub    $0x8,%esp
+  800748:	53                   	push   %ebx
+  800749:	6a 58                	push   $0x58
+  80074b:	ff d6                	call   *%esi
+			putch('X', putdat);
+  80074d:	83 c4 08             	add    $0x8,%esp
+  800750:	53                   	push   %ebx
+  800751:	6a 58                	push   $0x58
+  800753:	ff d6                	call   *%esi
+			putch('X', putdat);
+  800755:	83 c4 08             	add    $0x8,%esp
+  800758:	53                   	push   %ebx
+  800759:	6a 58                	push   $0x58
+  80075b:	ff d6                	call   *%esi
+			break;
+  80075d:	83 c4 10             	add    $0x10,%esp
+  800760:	eb 42                	jmp    8007a4 <vprintfmt+0x3a1>
+			putch('0', putdat);
+  800762:	83 ec 08             	sub    $0x8,%esp
+  800765:	53                   	push   %ebx
+  800766:	6a 30                	push   $0x30
+  800768:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80076a:	83 c4 08             	add    $0x8,%esp
+  80076d:	53                   	push   %ebx
+  80076e:	6a 78                	push   $0x78
+  800770:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800772:	8b 45 14             	mov    0x14(%ebp),%eax
+  800775:	8b 10                	mov    (%eax),%edx
+  800777:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80077c:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80077f:	8d 40 04             	lea    0x4(%eax),%eax
+  800782:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800785:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80078a:	83 ec 0c             	sub    $0xc,%esp
+  80078d:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800791:	50                   	push   %eax
+  800792:	ff 75 e0             	push   -0x20(%ebp)
+  800795:	57                   	push   %edi
+  800796:	51                   	push   %ecx
+  800797:	52                   	push   %edx
+  800798:	89 da                	mov    %ebx,%edx
+  80079a:	89 f0                	mov    %esi,%eax
+  80079c:	e8 7f fb ff ff       	call   800320 <printnum>
+			break;
+  8007a1:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8007a4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8007a7:	e9 75 fc ff ff       	jmp    800421 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8007ac:	83 f9 01             	cmp    $0x1,%ecx
+  8007af:	7f 1b                	jg     8007cc <vprintfmt+0x3c9>
+	else if (lflag)
+  8007b1:	85 c9                	test   %ecx,%ecx
+  8007b3:	74 2c                	je     8007e1 <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  8007b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b8:	8b 10                	mov    (%eax),%edx
+  8007ba:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007bf:	8d 40 04             	lea    0x4(%eax),%eax
+  8007c2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007c5:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8007ca:	eb be                	jmp    80078a <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  8007cc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007cf:	8b 10                	mov    (%eax),%edx
+  8007d1:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007d4:	8d 40 08             	lea    0x8(%eax),%eax
+  8007d7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007da:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8007df:	eb a9                	jmp    80078a <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  8007e1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e4:	8b 10                	mov    (%eax),%edx
+  8007e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007eb:	8d 40 04             	lea    0x4(%eax),%eax
+  8007ee:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007f1:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8007f6:	eb 92                	jmp    80078a <vprintfmt+0x387>
+			putch(ch, putdat);
+  8007f8:	83 ec 08             	sub    $0x8,%esp
+  8007fb:	53                   	push   %ebx
+  8007fc:	6a 25                	push   $0x25
+  8007fe:	ff d6                	call   *%esi
+			break;
+  800800:	83 c4 10             	add    $0x10,%esp
+  800803:	eb 9f                	jmp    8007a4 <vprintfmt+0x3a1>
+			putch('%', putdat);
+  800805:	83 ec 08             	sub    $0x8,%esp
+  800808:	53                   	push   %ebx
+  800809:	6a 25                	push   $0x25
+  80080b:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80080d:	83 c4 10             	add    $0x10,%esp
+  800810:	89 f8                	mov    %edi,%eax
+  800812:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800816:	74 05                	je     80081d <vprintfmt+0x41a>
+  800818:	83 e8 01             	sub    $0x1,%eax
+  80081b:	eb f5                	jmp    800812 <vprintfmt+0x40f>
+  80081d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800820:	eb 82                	jmp    8007a4 <vprintfmt+0x3a1>
+
+00800822 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800822:	55                   	push   %ebp
+  800823:	89 e5                	mov    %esp,%ebp
+  800825:	83 ec 18             	sub    $0x18,%esp
+  800828:	8b 45 08             	mov    0x8(%ebp),%eax
+  80082b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80082e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800831:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800835:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800838:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80083f:	85 c0                	test   %eax,%eax
+  800841:	74 26                	je     800869 <vsnprintf+0x47>
+  800843:	85 d2                	test   %edx,%edx
+  800845:	7e 22                	jle    800869 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800847:	ff 75 14             	push   0x14(%ebp)
+  80084a:	ff 75 10             	push   0x10(%ebp)
+  80084d:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800850:	50                   	push   %eax
+  800851:	68 c9 03 80 00       	push   $0x8003c9
+  800856:	e8 a8 fb ff ff       	call   800403 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80085b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80085e:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800861:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800864:	83 c4 10             	add    $0x10,%esp
+}
+  800867:	c9                   	leave
+  800868:	c3                   	ret
+		return -E_INVAL;
+  800869:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80086e:	eb f7                	jmp    800867 <vsnprintf+0x45>
+
+00800870 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800870:	55                   	push   %ebp
+  800871:	89 e5                	mov    %esp,%ebp
+  800873:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800876:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800879:	50                   	push   %eax
+  80087a:	ff 75 10             	push   0x10(%ebp)
+  80087d:	ff 75 0c             	push   0xc(%ebp)
+  800880:	ff 75 08             	push   0x8(%ebp)
+  800883:	e8 9a ff ff ff       	call   800822 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800888:	c9                   	leave
+  800889:	c3                   	ret
+
+0080088a <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80088a:	55                   	push   %ebp
+  80088b:	89 e5                	mov    %esp,%ebp
+  80088d:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800890:	b8 00 00 00 00       	mov    $0x0,%eax
+  800895:	eb 03                	jmp    80089a <strlen+0x10>
+		n++;
+  800897:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80089a:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80089e:	75 f7                	jne    800897 <strlen+0xd>
+	return n;
+}
+  8008a0:	5d                   	pop    %ebp
+  8008a1:	c3                   	ret
+
+008008a2 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8008a2:	55                   	push   %ebp
+  8008a3:	89 e5                	mov    %esp,%ebp
+  8008a5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008a8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008b0:	eb 03                	jmp    8008b5 <strnlen+0x13>
+		n++;
+  8008b2:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008b5:	39 d0                	cmp    %edx,%eax
+  8008b7:	74 08                	je     8008c1 <strnlen+0x1f>
+  8008b9:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008bd:	75 f3                	jne    8008b2 <strnlen+0x10>
+  8008bf:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8008c1:	89 d0                	mov    %edx,%eax
+  8008c3:	5d                   	pop    %ebp
+  8008c4:	c3                   	ret
+
+008008c5 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8008c5:	55                   	push   %ebp
+  8008c6:	89 e5                	mov    %esp,%ebp
+  8008c8:	53                   	push   %ebx
+  8008c9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008cc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8008cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d4:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8008d8:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8008db:	83 c0 01             	add    $0x1,%eax
+  8008de:	84 d2                	test   %dl,%dl
+  8008e0:	75 f2                	jne    8008d4 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8008e2:	89 c8                	mov    %ecx,%eax
+  8008e4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008e7:	c9                   	leave
+  8008e8:	c3                   	ret
+
+008008e9 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8008e9:	55                   	push   %ebp
+  8008ea:	89 e5                	mov    %esp,%ebp
+  8008ec:	53                   	push   %ebx
+  8008ed:	83 ec 10             	sub    $0x10,%esp
+  8008f0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8008f3:	53                   	push   %ebx
+  8008f4:	e8 91 ff ff ff       	call   80088a <strlen>
+  8008f9:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8008fc:	ff 75 0c             	push   0xc(%ebp)
+  8008ff:	01 d8                	add    %ebx,%eax
+  800901:	50                   	push   %eax
+  800902:	e8 be ff ff ff       	call   8008c5 <strcpy>
+	return dst;
+}
+  800907:	89 d8                	mov    %ebx,%eax
+  800909:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80090c:	c9                   	leave
+  80090d:	c3                   	ret
+
+0080090e <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80090e:	55                   	push   %ebp
+  80090f:	89 e5                	mov    %esp,%ebp
+  800911:	56                   	push   %esi
+  800912:	53                   	push   %ebx
+  800913:	8b 75 08             	mov    0x8(%ebp),%esi
+  800916:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800919:	89 f3                	mov    %esi,%ebx
+  80091b:	03 5d 10             	add    0x10(%ebp),%ebx
+  80091e:	89 f0                	mov    %esi,%eax
+  800920:	eb 0f                	jmp    800931 <strncpy+0x23>
+		*dst++ = *src;
+  800922:	83 c0 01             	add    $0x1,%eax
+  800925:	0f b6 0a             	movzbl (%edx),%ecx
+  800928:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80092b:	80 f9 01             	cmp    $0x1,%cl
+  80092e:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800931:	39 d8                	cmp    %ebx,%eax
+  800933:	75 ed                	jne    800922 <strncpy+0x14>
+	}
+	return ret;
+}
+  800935:	89 f0                	mov    %esi,%eax
+  800937:	5b                   	pop    %ebx
+  800938:	5e                   	pop    %esi
+  800939:	5d                   	pop    %ebp
+  80093a:	c3                   	ret
+
+0080093b <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80093b:	55                   	push   %ebp
+  80093c:	89 e5                	mov    %esp,%ebp
+  80093e:	56                   	push   %esi
+  80093f:	53                   	push   %ebx
+  800940:	8b 75 08             	mov    0x8(%ebp),%esi
+  800943:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800946:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800949:	89 f0                	mov    %esi,%eax
+  80094b:	85 d2                	test   %edx,%edx
+  80094d:	74 21                	je     800970 <strlcpy+0x35>
+  80094f:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800953:	89 f2                	mov    %esi,%edx
+  800955:	eb 09                	jmp    800960 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800957:	83 c1 01             	add    $0x1,%ecx
+  80095a:	83 c2 01             	add    $0x1,%edx
+  80095d:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800960:	39 c2                	cmp    %eax,%edx
+  800962:	74 09                	je     80096d <strlcpy+0x32>
+  800964:	0f b6 19             	movzbl (%ecx),%ebx
+  800967:	84 db                	test   %bl,%bl
+  800969:	75 ec                	jne    800957 <strlcpy+0x1c>
+  80096b:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80096d:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800970:	29 f0                	sub    %esi,%eax
+}
+  800972:	5b                   	pop    %ebx
+  800973:	5e                   	pop    %esi
+  800974:	5d                   	pop    %ebp
+  800975:	c3                   	ret
+
+00800976 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800976:	55                   	push   %ebp
+  800977:	89 e5                	mov    %esp,%ebp
+  800979:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80097c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80097f:	eb 06                	jmp    800987 <strcmp+0x11>
+		p++, q++;
+  800981:	83 c1 01             	add    $0x1,%ecx
+  800984:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800987:	0f b6 01             	movzbl (%ecx),%eax
+  80098a:	84 c0                	test   %al,%al
+  80098c:	74 04                	je     800992 <strcmp+0x1c>
+  80098e:	3a 02                	cmp    (%edx),%al
+  800990:	74 ef                	je     800981 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800992:	0f b6 c0             	movzbl %al,%eax
+  800995:	0f b6 12             	movzbl (%edx),%edx
+  800998:	29 d0                	sub    %edx,%eax
+}
+  80099a:	5d                   	pop    %ebp
+  80099b:	c3                   	ret
+
+0080099c <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80099c:	55                   	push   %ebp
+  80099d:	89 e5                	mov    %esp,%ebp
+  80099f:	53                   	push   %ebx
+  8009a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009a3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009a6:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8009a9:	eb 09                	jmp    8009b4 <strncmp+0x18>
+		n--, p++, q++;
+  8009ab:	83 ea 01             	sub    $0x1,%edx
+  8009ae:	83 c0 01             	add    $0x1,%eax
+  8009b1:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8009b4:	85 d2                	test   %edx,%edx
+  8009b6:	74 18                	je     8009d0 <strncmp+0x34>
+  8009b8:	0f b6 18             	movzbl (%eax),%ebx
+  8009bb:	84 db                	test   %bl,%bl
+  8009bd:	74 04                	je     8009c3 <strncmp+0x27>
+  8009bf:	3a 19                	cmp    (%ecx),%bl
+  8009c1:	74 e8                	je     8009ab <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009c3:	0f b6 00             	movzbl (%eax),%eax
+  8009c6:	0f b6 11             	movzbl (%ecx),%edx
+  8009c9:	29 d0                	sub    %edx,%eax
+}
+  8009cb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009ce:	c9                   	leave
+  8009cf:	c3                   	ret
+		return 0;
+  8009d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009d5:	eb f4                	jmp    8009cb <strncmp+0x2f>
+
+008009d7 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8009d7:	55                   	push   %ebp
+  8009d8:	89 e5                	mov    %esp,%ebp
+  8009da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009dd:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009e1:	eb 03                	jmp    8009e6 <strchr+0xf>
+  8009e3:	83 c0 01             	add    $0x1,%eax
+  8009e6:	0f b6 10             	movzbl (%eax),%edx
+  8009e9:	84 d2                	test   %dl,%dl
+  8009eb:	74 06                	je     8009f3 <strchr+0x1c>
+		if (*s == c)
+  8009ed:	38 ca                	cmp    %cl,%dl
+  8009ef:	75 f2                	jne    8009e3 <strchr+0xc>
+  8009f1:	eb 05                	jmp    8009f8 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8009f3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009f8:	5d                   	pop    %ebp
+  8009f9:	c3                   	ret
+
+008009fa <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8009fa:	55                   	push   %ebp
+  8009fb:	89 e5                	mov    %esp,%ebp
+  8009fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a00:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a04:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a07:	38 ca                	cmp    %cl,%dl
+  800a09:	74 09                	je     800a14 <strfind+0x1a>
+  800a0b:	84 d2                	test   %dl,%dl
+  800a0d:	74 05                	je     800a14 <strfind+0x1a>
+	for (; *s; s++)
+  800a0f:	83 c0 01             	add    $0x1,%eax
+  800a12:	eb f0                	jmp    800a04 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800a14:	5d                   	pop    %ebp
+  800a15:	c3                   	ret
+
+00800a16 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a16:	55                   	push   %ebp
+  800a17:	89 e5                	mov    %esp,%ebp
+  800a19:	57                   	push   %edi
+  800a1a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a1d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a20:	85 c9                	test   %ecx,%ecx
+  800a22:	74 20                	je     800a44 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a24:	89 f8                	mov    %edi,%eax
+  800a26:	09 c8                	or     %ecx,%eax
+  800a28:	a8 03                	test   $0x3,%al
+  800a2a:	75 12                	jne    800a3e <memset+0x28>
+		c &= 0xFF;
+  800a2c:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a30:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a36:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a39:	fc                   	cld
+  800a3a:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a3c:	eb 06                	jmp    800a44 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a3e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a41:	fc                   	cld
+  800a42:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a44:	89 f8                	mov    %edi,%eax
+  800a46:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a49:	c9                   	leave
+  800a4a:	c3                   	ret
+
+00800a4b <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a4b:	55                   	push   %ebp
+  800a4c:	89 e5                	mov    %esp,%ebp
+  800a4e:	57                   	push   %edi
+  800a4f:	56                   	push   %esi
+  800a50:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a53:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a56:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a59:	39 c6                	cmp    %eax,%esi
+  800a5b:	73 32                	jae    800a8f <memmove+0x44>
+  800a5d:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a60:	39 d0                	cmp    %edx,%eax
+  800a62:	73 2b                	jae    800a8f <memmove+0x44>
+		s += n;
+		d += n;
+  800a64:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a67:	89 d6                	mov    %edx,%esi
+  800a69:	09 fe                	or     %edi,%esi
+  800a6b:	09 ce                	or     %ecx,%esi
+  800a6d:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a73:	75 0e                	jne    800a83 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a75:	83 ef 04             	sub    $0x4,%edi
+  800a78:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a7b:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a7e:	fd                   	std
+  800a7f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a81:	eb 09                	jmp    800a8c <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a83:	83 ef 01             	sub    $0x1,%edi
+  800a86:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800a89:	fd                   	std
+  800a8a:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a8c:	fc                   	cld
+  800a8d:	eb 1a                	jmp    800aa9 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a8f:	89 f2                	mov    %esi,%edx
+  800a91:	09 c2                	or     %eax,%edx
+  800a93:	09 ca                	or     %ecx,%edx
+  800a95:	f6 c2 03             	test   $0x3,%dl
+  800a98:	75 0a                	jne    800aa4 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a9a:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a9d:	89 c7                	mov    %eax,%edi
+  800a9f:	fc                   	cld
+  800aa0:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800aa2:	eb 05                	jmp    800aa9 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800aa4:	89 c7                	mov    %eax,%edi
+  800aa6:	fc                   	cld
+  800aa7:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800aa9:	5e                   	pop    %esi
+  800aaa:	5f                   	pop    %edi
+  800aab:	5d                   	pop    %ebp
+  800aac:	c3                   	ret
+
+00800aad <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800aad:	55                   	push   %ebp
+  800aae:	89 e5                	mov    %esp,%ebp
+  800ab0:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800ab3:	ff 75 10             	push   0x10(%ebp)
+  800ab6:	ff 75 0c             	push   0xc(%ebp)
+  800ab9:	ff 75 08             	push   0x8(%ebp)
+  800abc:	e8 8a ff ff ff       	call   800a4b <memmove>
+}
+  800ac1:	c9                   	leave
+  800ac2:	c3                   	ret
+
+00800ac3 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800ac3:	55                   	push   %ebp
+  800ac4:	89 e5                	mov    %esp,%ebp
+  800ac6:	56                   	push   %esi
+  800ac7:	53                   	push   %ebx
+  800ac8:	8b 45 08             	mov    0x8(%ebp),%eax
+  800acb:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800ace:	89 c6                	mov    %eax,%esi
+  800ad0:	03 75 10             	add    0x10(%ebp),%esi
+  800ad3:	eb 06                	jmp    800adb <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800ad5:	83 c0 01             	add    $0x1,%eax
+  800ad8:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800adb:	39 f0                	cmp    %esi,%eax
+  800add:	74 14                	je     800af3 <memcmp+0x30>
+		if (*s1 != *s2)
+  800adf:	0f b6 08             	movzbl (%eax),%ecx
+  800ae2:	0f b6 1a             	movzbl (%edx),%ebx
+  800ae5:	38 d9                	cmp    %bl,%cl
+  800ae7:	74 ec                	je     800ad5 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800ae9:	0f b6 c1             	movzbl %cl,%eax
+  800aec:	0f b6 db             	movzbl %bl,%ebx
+  800aef:	29 d8                	sub    %ebx,%eax
+  800af1:	eb 05                	jmp    800af8 <memcmp+0x35>
+	}
+
+	return 0;
+  800af3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800af8:	5b                   	pop    %ebx
+  800af9:	5e                   	pop    %esi
+  800afa:	5d                   	pop    %ebp
+  800afb:	c3                   	ret
+
+00800afc <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800afc:	55                   	push   %ebp
+  800afd:	89 e5                	mov    %esp,%ebp
+  800aff:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b02:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b05:	89 c2                	mov    %eax,%edx
+  800b07:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b0a:	eb 03                	jmp    800b0f <memfind+0x13>
+  800b0c:	83 c0 01             	add    $0x1,%eax
+  800b0f:	39 d0                	cmp    %edx,%eax
+  800b11:	73 04                	jae    800b17 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b13:	38 08                	cmp    %cl,(%eax)
+  800b15:	75 f5                	jne    800b0c <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800b17:	5d                   	pop    %ebp
+  800b18:	c3                   	ret
+
+00800b19 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800b19:	55                   	push   %ebp
+  800b1a:	89 e5                	mov    %esp,%ebp
+  800b1c:	57                   	push   %edi
+  800b1d:	56                   	push   %esi
+  800b1e:	53                   	push   %ebx
+  800b1f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b22:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b25:	eb 03                	jmp    800b2a <strtol+0x11>
+		s++;
+  800b27:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800b2a:	0f b6 02             	movzbl (%edx),%eax
+  800b2d:	3c 20                	cmp    $0x20,%al
+  800b2f:	74 f6                	je     800b27 <strtol+0xe>
+  800b31:	3c 09                	cmp    $0x9,%al
+  800b33:	74 f2                	je     800b27 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b35:	3c 2b                	cmp    $0x2b,%al
+  800b37:	74 2a                	je     800b63 <strtol+0x4a>
+	int neg = 0;
+  800b39:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800b3e:	3c 2d                	cmp    $0x2d,%al
+  800b40:	74 2b                	je     800b6d <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b42:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b48:	75 0f                	jne    800b59 <strtol+0x40>
+  800b4a:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b4d:	74 28                	je     800b77 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b4f:	85 db                	test   %ebx,%ebx
+  800b51:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b56:	0f 44 d8             	cmove  %eax,%ebx
+  800b59:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b5e:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b61:	eb 46                	jmp    800ba9 <strtol+0x90>
+		s++;
+  800b63:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800b66:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b6b:	eb d5                	jmp    800b42 <strtol+0x29>
+		s++, neg = 1;
+  800b6d:	83 c2 01             	add    $0x1,%edx
+  800b70:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b75:	eb cb                	jmp    800b42 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b77:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b7b:	74 0e                	je     800b8b <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800b7d:	85 db                	test   %ebx,%ebx
+  800b7f:	75 d8                	jne    800b59 <strtol+0x40>
+		s++, base = 8;
+  800b81:	83 c2 01             	add    $0x1,%edx
+  800b84:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b89:	eb ce                	jmp    800b59 <strtol+0x40>
+		s += 2, base = 16;
+  800b8b:	83 c2 02             	add    $0x2,%edx
+  800b8e:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b93:	eb c4                	jmp    800b59 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800b95:	0f be c0             	movsbl %al,%eax
+  800b98:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800b9b:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b9e:	7d 3a                	jge    800bda <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800ba0:	83 c2 01             	add    $0x1,%edx
+  800ba3:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800ba7:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800ba9:	0f b6 02             	movzbl (%edx),%eax
+  800bac:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800baf:	89 f3                	mov    %esi,%ebx
+  800bb1:	80 fb 09             	cmp    $0x9,%bl
+  800bb4:	76 df                	jbe    800b95 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800bb6:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800bb9:	89 f3                	mov    %esi,%ebx
+  800bbb:	80 fb 19             	cmp    $0x19,%bl
+  800bbe:	77 08                	ja     800bc8 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800bc0:	0f be c0             	movsbl %al,%eax
+  800bc3:	83 e8 57             	sub    $0x57,%eax
+  800bc6:	eb d3                	jmp    800b9b <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800bc8:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800bcb:	89 f3                	mov    %esi,%ebx
+  800bcd:	80 fb 19             	cmp    $0x19,%bl
+  800bd0:	77 08                	ja     800bda <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800bd2:	0f be c0             	movsbl %al,%eax
+  800bd5:	83 e8 37             	sub    $0x37,%eax
+  800bd8:	eb c1                	jmp    800b9b <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800bda:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800bde:	74 05                	je     800be5 <strtol+0xcc>
+		*endptr = (char *) s;
+  800be0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800be3:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800be5:	89 c8                	mov    %ecx,%eax
+  800be7:	f7 d8                	neg    %eax
+  800be9:	85 ff                	test   %edi,%edi
+  800beb:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800bee:	89 c8                	mov    %ecx,%eax
+  800bf0:	5b                   	pop    %ebx
+  800bf1:	5e                   	pop    %esi
+  800bf2:	5f                   	pop    %edi
+  800bf3:	5d                   	pop    %ebp
+  800bf4:	c3                   	ret
+
+00800bf5 <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800bf5:	55                   	push   %ebp
+  800bf6:	89 e5                	mov    %esp,%ebp
+  800bf8:	57                   	push   %edi
+  800bf9:	56                   	push   %esi
+  800bfa:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800bfb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c00:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c03:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c06:	89 c3                	mov    %eax,%ebx
+  800c08:	89 c7                	mov    %eax,%edi
+  800c0a:	89 c6                	mov    %eax,%esi
+  800c0c:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  800c0e:	5b                   	pop    %ebx
+  800c0f:	5e                   	pop    %esi
+  800c10:	5f                   	pop    %edi
+  800c11:	5d                   	pop    %ebp
+  800c12:	c3                   	ret
+
+00800c13 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800c13:	55                   	push   %ebp
+  800c14:	89 e5                	mov    %esp,%ebp
+  800c16:	57                   	push   %edi
+  800c17:	56                   	push   %esi
+  800c18:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800c19:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c1e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c23:	89 d1                	mov    %edx,%ecx
+  800c25:	89 d3                	mov    %edx,%ebx
+  800c27:	89 d7                	mov    %edx,%edi
+  800c29:	89 d6                	mov    %edx,%esi
+  800c2b:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c2d:	5b                   	pop    %ebx
+  800c2e:	5e                   	pop    %esi
+  800c2f:	5f                   	pop    %edi
+  800c30:	5d                   	pop    %ebp
+  800c31:	c3                   	ret
+
+00800c32 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800c32:	55                   	push   %ebp
+  800c33:	89 e5                	mov    %esp,%ebp
+  800c35:	57                   	push   %edi
+  800c36:	56                   	push   %esi
+  800c37:	53                   	push   %ebx
+  800c38:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c3b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c40:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c43:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c48:	89 cb                	mov    %ecx,%ebx
+  800c4a:	89 cf                	mov    %ecx,%edi
+  800c4c:	89 ce                	mov    %ecx,%esi
+  800c4e:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c50:	85 c0                	test   %eax,%eax
+  800c52:	7f 08                	jg     800c5c <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c54:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c57:	5b                   	pop    %ebx
+  800c58:	5e                   	pop    %esi
+  800c59:	5f                   	pop    %edi
+  800c5a:	5d                   	pop    %ebp
+  800c5b:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c5c:	83 ec 0c             	sub    $0xc,%esp
+  800c5f:	50                   	push   %eax
+  800c60:	6a 03                	push   $0x3
+  800c62:	68 43 2a 80 00       	push   $0x802a43
+  800c67:	6a 3e                	push   $0x3e
+  800c69:	68 60 2a 80 00       	push   $0x802a60
+  800c6e:	e8 be f5 ff ff       	call   800231 <_panic>
+
+00800c73 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800c73:	55                   	push   %ebp
+  800c74:	89 e5                	mov    %esp,%ebp
+  800c76:	57                   	push   %edi
+  800c77:	56                   	push   %esi
+  800c78:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800c79:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c7e:	b8 02 00 00 00       	mov    $0x2,%eax
+  800c83:	89 d1                	mov    %edx,%ecx
+  800c85:	89 d3                	mov    %edx,%ebx
+  800c87:	89 d7                	mov    %edx,%edi
+  800c89:	89 d6                	mov    %edx,%esi
+  800c8b:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800c8d:	5b                   	pop    %ebx
+  800c8e:	5e                   	pop    %esi
+  800c8f:	5f                   	pop    %edi
+  800c90:	5d                   	pop    %ebp
+  800c91:	c3                   	ret
+
+00800c92 <sys_yield>:
+
+void
+sys_yield(void) {
+  800c92:	55                   	push   %ebp
+  800c93:	89 e5                	mov    %esp,%ebp
+  800c95:	57                   	push   %edi
+  800c96:	56                   	push   %esi
+  800c97:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800c98:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c9d:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800ca2:	89 d1                	mov    %edx,%ecx
+  800ca4:	89 d3                	mov    %edx,%ebx
+  800ca6:	89 d7                	mov    %edx,%edi
+  800ca8:	89 d6                	mov    %edx,%esi
+  800caa:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800cac:	5b                   	pop    %ebx
+  800cad:	5e                   	pop    %esi
+  800cae:	5f                   	pop    %edi
+  800caf:	5d                   	pop    %ebp
+  800cb0:	c3                   	ret
+
+00800cb1 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  800cb1:	55                   	push   %ebp
+  800cb2:	89 e5                	mov    %esp,%ebp
+  800cb4:	57                   	push   %edi
+  800cb5:	56                   	push   %esi
+  800cb6:	53                   	push   %ebx
+  800cb7:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800cba:	be 00 00 00 00       	mov    $0x0,%esi
+  800cbf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cc2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cc5:	b8 04 00 00 00       	mov    $0x4,%eax
+  800cca:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ccd:	89 f7                	mov    %esi,%edi
+  800ccf:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800cd1:	85 c0                	test   %eax,%eax
+  800cd3:	7f 08                	jg     800cdd <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800cd5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cd8:	5b                   	pop    %ebx
+  800cd9:	5e                   	pop    %esi
+  800cda:	5f                   	pop    %edi
+  800cdb:	5d                   	pop    %ebp
+  800cdc:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800cdd:	83 ec 0c             	sub    $0xc,%esp
+  800ce0:	50                   	push   %eax
+  800ce1:	6a 04                	push   $0x4
+  800ce3:	68 43 2a 80 00       	push   $0x802a43
+  800ce8:	6a 3e                	push   $0x3e
+  800cea:	68 60 2a 80 00       	push   $0x802a60
+  800cef:	e8 3d f5 ff ff       	call   800231 <_panic>
+
+00800cf4 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  800cf4:	55                   	push   %ebp
+  800cf5:	89 e5                	mov    %esp,%ebp
+  800cf7:	57                   	push   %edi
+  800cf8:	56                   	push   %esi
+  800cf9:	53                   	push   %ebx
+  800cfa:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800cfd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d00:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d03:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d08:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d0b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d0e:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d11:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d13:	85 c0                	test   %eax,%eax
+  800d15:	7f 08                	jg     800d1f <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800d17:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d1a:	5b                   	pop    %ebx
+  800d1b:	5e                   	pop    %esi
+  800d1c:	5f                   	pop    %edi
+  800d1d:	5d                   	pop    %ebp
+  800d1e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d1f:	83 ec 0c             	sub    $0xc,%esp
+  800d22:	50                   	push   %eax
+  800d23:	6a 05                	push   $0x5
+  800d25:	68 43 2a 80 00       	push   $0x802a43
+  800d2a:	6a 3e                	push   $0x3e
+  800d2c:	68 60 2a 80 00       	push   $0x802a60
+  800d31:	e8 fb f4 ff ff       	call   800231 <_panic>
+
+00800d36 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  800d36:	55                   	push   %ebp
+  800d37:	89 e5                	mov    %esp,%ebp
+  800d39:	57                   	push   %edi
+  800d3a:	56                   	push   %esi
+  800d3b:	53                   	push   %ebx
+  800d3c:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800d3f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d44:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d47:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d4a:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d4f:	89 df                	mov    %ebx,%edi
+  800d51:	89 de                	mov    %ebx,%esi
+  800d53:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d55:	85 c0                	test   %eax,%eax
+  800d57:	7f 08                	jg     800d61 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800d59:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d5c:	5b                   	pop    %ebx
+  800d5d:	5e                   	pop    %esi
+  800d5e:	5f                   	pop    %edi
+  800d5f:	5d                   	pop    %ebp
+  800d60:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d61:	83 ec 0c             	sub    $0xc,%esp
+  800d64:	50                   	push   %eax
+  800d65:	6a 06                	push   $0x6
+  800d67:	68 43 2a 80 00       	push   $0x802a43
+  800d6c:	6a 3e                	push   $0x3e
+  800d6e:	68 60 2a 80 00       	push   $0x802a60
+  800d73:	e8 b9 f4 ff ff       	call   800231 <_panic>
+
+00800d78 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800d78:	55                   	push   %ebp
+  800d79:	89 e5                	mov    %esp,%ebp
+  800d7b:	57                   	push   %edi
+  800d7c:	56                   	push   %esi
+  800d7d:	53                   	push   %ebx
+  800d7e:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800d81:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d86:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d89:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d8c:	b8 08 00 00 00       	mov    $0x8,%eax
+  800d91:	89 df                	mov    %ebx,%edi
+  800d93:	89 de                	mov    %ebx,%esi
+  800d95:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d97:	85 c0                	test   %eax,%eax
+  800d99:	7f 08                	jg     800da3 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800d9b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d9e:	5b                   	pop    %ebx
+  800d9f:	5e                   	pop    %esi
+  800da0:	5f                   	pop    %edi
+  800da1:	5d                   	pop    %ebp
+  800da2:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800da3:	83 ec 0c             	sub    $0xc,%esp
+  800da6:	50                   	push   %eax
+  800da7:	6a 08                	push   $0x8
+  800da9:	68 43 2a 80 00       	push   $0x802a43
+  800dae:	6a 3e                	push   $0x3e
+  800db0:	68 60 2a 80 00       	push   $0x802a60
+  800db5:	e8 77 f4 ff ff       	call   800231 <_panic>
+
+00800dba <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800dba:	55                   	push   %ebp
+  800dbb:	89 e5                	mov    %esp,%ebp
+  800dbd:	57                   	push   %edi
+  800dbe:	56                   	push   %esi
+  800dbf:	53                   	push   %ebx
+  800dc0:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800dc3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dc8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dcb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dce:	b8 09 00 00 00       	mov    $0x9,%eax
+  800dd3:	89 df                	mov    %ebx,%edi
+  800dd5:	89 de                	mov    %ebx,%esi
+  800dd7:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800dd9:	85 c0                	test   %eax,%eax
+  800ddb:	7f 08                	jg     800de5 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800ddd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800de0:	5b                   	pop    %ebx
+  800de1:	5e                   	pop    %esi
+  800de2:	5f                   	pop    %edi
+  800de3:	5d                   	pop    %ebp
+  800de4:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800de5:	83 ec 0c             	sub    $0xc,%esp
+  800de8:	50                   	push   %eax
+  800de9:	6a 09                	push   $0x9
+  800deb:	68 43 2a 80 00       	push   $0x802a43
+  800df0:	6a 3e                	push   $0x3e
+  800df2:	68 60 2a 80 00       	push   $0x802a60
+  800df7:	e8 35 f4 ff ff       	call   800231 <_panic>
+
+00800dfc <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800dfc:	55                   	push   %ebp
+  800dfd:	89 e5                	mov    %esp,%ebp
+  800dff:	57                   	push   %edi
+  800e00:	56                   	push   %esi
+  800e01:	53                   	push   %ebx
+  800e02:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800e05:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e0a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e0d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e10:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e15:	89 df                	mov    %ebx,%edi
+  800e17:	89 de                	mov    %ebx,%esi
+  800e19:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e1b:	85 c0                	test   %eax,%eax
+  800e1d:	7f 08                	jg     800e27 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800e1f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e22:	5b                   	pop    %ebx
+  800e23:	5e                   	pop    %esi
+  800e24:	5f                   	pop    %edi
+  800e25:	5d                   	pop    %ebp
+  800e26:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e27:	83 ec 0c             	sub    $0xc,%esp
+  800e2a:	50                   	push   %eax
+  800e2b:	6a 0a                	push   $0xa
+  800e2d:	68 43 2a 80 00       	push   $0x802a43
+  800e32:	6a 3e                	push   $0x3e
+  800e34:	68 60 2a 80 00       	push   $0x802a60
+  800e39:	e8 f3 f3 ff ff       	call   800231 <_panic>
+
+00800e3e <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  800e3e:	55                   	push   %ebp
+  800e3f:	89 e5                	mov    %esp,%ebp
+  800e41:	57                   	push   %edi
+  800e42:	56                   	push   %esi
+  800e43:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e44:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e47:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e4a:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800e4f:	be 00 00 00 00       	mov    $0x0,%esi
+  800e54:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e57:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e5a:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800e5c:	5b                   	pop    %ebx
+  800e5d:	5e                   	pop    %esi
+  800e5e:	5f                   	pop    %edi
+  800e5f:	5d                   	pop    %ebp
+  800e60:	c3                   	ret
+
+00800e61 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  800e61:	55                   	push   %ebp
+  800e62:	89 e5                	mov    %esp,%ebp
+  800e64:	57                   	push   %edi
+  800e65:	56                   	push   %esi
+  800e66:	53                   	push   %ebx
+  800e67:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800e6a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e6f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e72:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e77:	89 cb                	mov    %ecx,%ebx
+  800e79:	89 cf                	mov    %ecx,%edi
+  800e7b:	89 ce                	mov    %ecx,%esi
+  800e7d:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e7f:	85 c0                	test   %eax,%eax
+  800e81:	7f 08                	jg     800e8b <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  800e83:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e86:	5b                   	pop    %ebx
+  800e87:	5e                   	pop    %esi
+  800e88:	5f                   	pop    %edi
+  800e89:	5d                   	pop    %ebp
+  800e8a:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e8b:	83 ec 0c             	sub    $0xc,%esp
+  800e8e:	50                   	push   %eax
+  800e8f:	6a 0d                	push   $0xd
+  800e91:	68 43 2a 80 00       	push   $0x802a43
+  800e96:	6a 3e                	push   $0x3e
+  800e98:	68 60 2a 80 00       	push   $0x802a60
+  800e9d:	e8 8f f3 ff ff       	call   800231 <_panic>
+
+00800ea2 <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  800ea2:	55                   	push   %ebp
+  800ea3:	89 e5                	mov    %esp,%ebp
+  800ea5:	57                   	push   %edi
+  800ea6:	56                   	push   %esi
+  800ea7:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800ea8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ead:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb3:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800eb8:	89 df                	mov    %ebx,%edi
+  800eba:	89 de                	mov    %ebx,%esi
+  800ebc:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  800ebe:	5b                   	pop    %ebx
+  800ebf:	5e                   	pop    %esi
+  800ec0:	5f                   	pop    %edi
+  800ec1:	5d                   	pop    %ebp
+  800ec2:	c3                   	ret
+
+00800ec3 <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  800ec3:	55                   	push   %ebp
+  800ec4:	89 e5                	mov    %esp,%ebp
+  800ec6:	57                   	push   %edi
+  800ec7:	56                   	push   %esi
+  800ec8:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800ec9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ece:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed1:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800ed6:	89 cb                	mov    %ecx,%ebx
+  800ed8:	89 cf                	mov    %ecx,%edi
+  800eda:	89 ce                	mov    %ecx,%esi
+  800edc:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  800ede:	5b                   	pop    %ebx
+  800edf:	5e                   	pop    %esi
+  800ee0:	5f                   	pop    %edi
+  800ee1:	5d                   	pop    %ebp
+  800ee2:	c3                   	ret
+
+00800ee3 <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  800ee3:	55                   	push   %ebp
+  800ee4:	89 e5                	mov    %esp,%ebp
+  800ee6:	57                   	push   %edi
+  800ee7:	56                   	push   %esi
+  800ee8:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800ee9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eee:	b8 10 00 00 00       	mov    $0x10,%eax
+  800ef3:	89 d1                	mov    %edx,%ecx
+  800ef5:	89 d3                	mov    %edx,%ebx
+  800ef7:	89 d7                	mov    %edx,%edi
+  800ef9:	89 d6                	mov    %edx,%esi
+  800efb:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800efd:	5b                   	pop    %ebx
+  800efe:	5e                   	pop    %esi
+  800eff:	5f                   	pop    %edi
+  800f00:	5d                   	pop    %ebp
+  800f01:	c3                   	ret
+
+00800f02 <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  800f02:	55                   	push   %ebp
+  800f03:	89 e5                	mov    %esp,%ebp
+  800f05:	57                   	push   %edi
+  800f06:	56                   	push   %esi
+  800f07:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800f08:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f0d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f10:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f13:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f18:	89 df                	mov    %ebx,%edi
+  800f1a:	89 de                	mov    %ebx,%esi
+  800f1c:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800f1e:	5b                   	pop    %ebx
+  800f1f:	5e                   	pop    %esi
+  800f20:	5f                   	pop    %edi
+  800f21:	5d                   	pop    %ebp
+  800f22:	c3                   	ret
+
+00800f23 <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  800f23:	55                   	push   %ebp
+  800f24:	89 e5                	mov    %esp,%ebp
+  800f26:	57                   	push   %edi
+  800f27:	56                   	push   %esi
+  800f28:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800f29:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f2e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f31:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f34:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f39:	89 df                	mov    %ebx,%edi
+  800f3b:	89 de                	mov    %ebx,%esi
+  800f3d:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800f3f:	5b                   	pop    %ebx
+  800f40:	5e                   	pop    %esi
+  800f41:	5f                   	pop    %edi
+  800f42:	5d                   	pop    %ebp
+  800f43:	c3                   	ret
+
+00800f44 <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  800f44:	55                   	push   %ebp
+  800f45:	89 e5                	mov    %esp,%ebp
+  800f47:	57                   	push   %edi
+  800f48:	56                   	push   %esi
+  800f49:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800f4a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f4f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f52:	b8 13 00 00 00       	mov    $0x13,%eax
+  800f57:	89 cb                	mov    %ecx,%ebx
+  800f59:	89 cf                	mov    %ecx,%edi
+  800f5b:	89 ce                	mov    %ecx,%esi
+  800f5d:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  800f5f:	5b                   	pop    %ebx
+  800f60:	5e                   	pop    %esi
+  800f61:	5f                   	pop    %edi
+  800f62:	5d                   	pop    %ebp
+  800f63:	c3                   	ret
+
+00800f64 <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  800f64:	55                   	push   %ebp
+  800f65:	89 e5                	mov    %esp,%ebp
+  800f67:	57                   	push   %edi
+  800f68:	56                   	push   %esi
+  800f69:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800f6a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f6f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f72:	b8 14 00 00 00       	mov    $0x14,%eax
+  800f77:	89 cb                	mov    %ecx,%ebx
+  800f79:	89 cf                	mov    %ecx,%edi
+  800f7b:	89 ce                	mov    %ecx,%esi
+  800f7d:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  800f7f:	5b                   	pop    %ebx
+  800f80:	5e                   	pop    %esi
+  800f81:	5f                   	pop    %edi
+  800f82:	5d                   	pop    %ebp
+  800f83:	c3                   	ret
+
+00800f84 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800f84:	55                   	push   %ebp
+  800f85:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800f87:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f8a:	05 00 00 00 30       	add    $0x30000000,%eax
+  800f8f:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800f92:	5d                   	pop    %ebp
+  800f93:	c3                   	ret
+
+00800f94 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800f94:	55                   	push   %ebp
+  800f95:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800f97:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f9a:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800f9f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800fa4:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800fa9:	5d                   	pop    %ebp
+  800faa:	c3                   	ret
+
+00800fab <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800fab:	55                   	push   %ebp
+  800fac:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  800fae:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800fb3:	eb 02                	jmp    800fb7 <fd_alloc+0xc>
+  800fb5:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800fb7:	89 c2                	mov    %eax,%edx
+  800fb9:	c1 ea 16             	shr    $0x16,%edx
+  800fbc:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800fc3:	f6 c2 01             	test   $0x1,%dl
+  800fc6:	74 2b                	je     800ff3 <fd_alloc+0x48>
+  800fc8:	89 c2                	mov    %eax,%edx
+  800fca:	c1 ea 0c             	shr    $0xc,%edx
+  800fcd:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  800fd4:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  800fda:	f6 c1 01             	test   $0x1,%cl
+  800fdd:	74 14                	je     800ff3 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  800fdf:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  800fe5:	75 ce                	jne    800fb5 <fd_alloc+0xa>
+  800fe7:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  800fec:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800ff1:	eb 05                	jmp    800ff8 <fd_alloc+0x4d>
+			return 0;
+  800ff3:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  800ff8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ffb:	89 02                	mov    %eax,(%edx)
+}
+  800ffd:	89 c8                	mov    %ecx,%eax
+  800fff:	5d                   	pop    %ebp
+  801000:	c3                   	ret
+
+00801001 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801001:	55                   	push   %ebp
+  801002:	89 e5                	mov    %esp,%ebp
+  801004:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801007:	83 f8 1f             	cmp    $0x1f,%eax
+  80100a:	77 30                	ja     80103c <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80100c:	c1 e0 0c             	shl    $0xc,%eax
+  80100f:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801014:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80101a:	f6 c2 01             	test   $0x1,%dl
+  80101d:	74 24                	je     801043 <fd_lookup+0x42>
+  80101f:	89 c2                	mov    %eax,%edx
+  801021:	c1 ea 0c             	shr    $0xc,%edx
+  801024:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80102b:	f6 c2 01             	test   $0x1,%dl
+  80102e:	74 1a                	je     80104a <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801030:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801033:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801035:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80103a:	5d                   	pop    %ebp
+  80103b:	c3                   	ret
+		return -E_INVAL;
+  80103c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801041:	eb f7                	jmp    80103a <fd_lookup+0x39>
+		return -E_INVAL;
+  801043:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801048:	eb f0                	jmp    80103a <fd_lookup+0x39>
+  80104a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80104f:	eb e9                	jmp    80103a <fd_lookup+0x39>
+
+00801051 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801051:	55                   	push   %ebp
+  801052:	89 e5                	mov    %esp,%ebp
+  801054:	53                   	push   %ebx
+  801055:	83 ec 04             	sub    $0x4,%esp
+  801058:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80105b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801060:	eb 03                	jmp    801065 <dev_lookup+0x14>
+  801062:	83 c0 01             	add    $0x1,%eax
+  801065:	8b 1c 85 ec 2a 80 00 	mov    0x802aec(,%eax,4),%ebx
+  80106c:	85 db                	test   %ebx,%ebx
+  80106e:	74 0b                	je     80107b <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801070:	39 13                	cmp    %edx,(%ebx)
+  801072:	75 ee                	jne    801062 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801074:	b8 00 00 00 00       	mov    $0x0,%eax
+  801079:	eb 1f                	jmp    80109a <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80107b:	a1 08 40 80 00       	mov    0x804008,%eax
+  801080:	8b 40 48             	mov    0x48(%eax),%eax
+  801083:	83 ec 04             	sub    $0x4,%esp
+  801086:	52                   	push   %edx
+  801087:	50                   	push   %eax
+  801088:	68 70 2a 80 00       	push   $0x802a70
+  80108d:	e8 7a f2 ff ff       	call   80030c <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801092:	83 c4 10             	add    $0x10,%esp
+  801095:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80109a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80109d:	89 1a                	mov    %ebx,(%edx)
+}
+  80109f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010a2:	c9                   	leave
+  8010a3:	c3                   	ret
+
+008010a4 <fd_close>:
+{
+  8010a4:	55                   	push   %ebp
+  8010a5:	89 e5                	mov    %esp,%ebp
+  8010a7:	57                   	push   %edi
+  8010a8:	56                   	push   %esi
+  8010a9:	53                   	push   %ebx
+  8010aa:	83 ec 24             	sub    $0x24,%esp
+  8010ad:	8b 75 08             	mov    0x8(%ebp),%esi
+  8010b0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8010b3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8010b6:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8010b7:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8010bd:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8010c0:	50                   	push   %eax
+  8010c1:	e8 3b ff ff ff       	call   801001 <fd_lookup>
+  8010c6:	89 c3                	mov    %eax,%ebx
+  8010c8:	83 c4 10             	add    $0x10,%esp
+  8010cb:	85 c0                	test   %eax,%eax
+  8010cd:	78 05                	js     8010d4 <fd_close+0x30>
+	    || fd != fd2)
+  8010cf:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8010d2:	74 16                	je     8010ea <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8010d4:	89 f8                	mov    %edi,%eax
+  8010d6:	84 c0                	test   %al,%al
+  8010d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010dd:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8010e0:	89 d8                	mov    %ebx,%eax
+  8010e2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010e5:	5b                   	pop    %ebx
+  8010e6:	5e                   	pop    %esi
+  8010e7:	5f                   	pop    %edi
+  8010e8:	5d                   	pop    %ebp
+  8010e9:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8010ea:	83 ec 08             	sub    $0x8,%esp
+  8010ed:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8010f0:	50                   	push   %eax
+  8010f1:	ff 36                	push   (%esi)
+  8010f3:	e8 59 ff ff ff       	call   801051 <dev_lookup>
+  8010f8:	89 c3                	mov    %eax,%ebx
+  8010fa:	83 c4 10             	add    $0x10,%esp
+  8010fd:	85 c0                	test   %eax,%eax
+  8010ff:	78 1a                	js     80111b <fd_close+0x77>
+		if (dev->dev_close)
+  801101:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801104:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801107:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80110c:	85 c0                	test   %eax,%eax
+  80110e:	74 0b                	je     80111b <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801110:	83 ec 0c             	sub    $0xc,%esp
+  801113:	56                   	push   %esi
+  801114:	ff d0                	call   *%eax
+  801116:	89 c3                	mov    %eax,%ebx
+  801118:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80111b:	83 ec 08             	sub    $0x8,%esp
+  80111e:	56                   	push   %esi
+  80111f:	6a 00                	push   $0x0
+  801121:	e8 10 fc ff ff       	call   800d36 <sys_page_unmap>
+	return r;
+  801126:	83 c4 10             	add    $0x10,%esp
+  801129:	eb b5                	jmp    8010e0 <fd_close+0x3c>
+
+0080112b <close>:
+
+int
+close(int fdnum)
+{
+  80112b:	55                   	push   %ebp
+  80112c:	89 e5                	mov    %esp,%ebp
+  80112e:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801131:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801134:	50                   	push   %eax
+  801135:	ff 75 08             	push   0x8(%ebp)
+  801138:	e8 c4 fe ff ff       	call   801001 <fd_lookup>
+  80113d:	83 c4 10             	add    $0x10,%esp
+  801140:	85 c0                	test   %eax,%eax
+  801142:	79 02                	jns    801146 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801144:	c9                   	leave
+  801145:	c3                   	ret
+		return fd_close(fd, 1);
+  801146:	83 ec 08             	sub    $0x8,%esp
+  801149:	6a 01                	push   $0x1
+  80114b:	ff 75 f4             	push   -0xc(%ebp)
+  80114e:	e8 51 ff ff ff       	call   8010a4 <fd_close>
+  801153:	83 c4 10             	add    $0x10,%esp
+  801156:	eb ec                	jmp    801144 <close+0x19>
+
+00801158 <close_all>:
+
+void
+close_all(void)
+{
+  801158:	55                   	push   %ebp
+  801159:	89 e5                	mov    %esp,%ebp
+  80115b:	53                   	push   %ebx
+  80115c:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80115f:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801164:	83 ec 0c             	sub    $0xc,%esp
+  801167:	53                   	push   %ebx
+  801168:	e8 be ff ff ff       	call   80112b <close>
+	for (i = 0; i < MAXFD; i++)
+  80116d:	83 c3 01             	add    $0x1,%ebx
+  801170:	83 c4 10             	add    $0x10,%esp
+  801173:	83 fb 20             	cmp    $0x20,%ebx
+  801176:	75 ec                	jne    801164 <close_all+0xc>
+}
+  801178:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80117b:	c9                   	leave
+  80117c:	c3                   	ret
+
+0080117d <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80117d:	55                   	push   %ebp
+  80117e:	89 e5                	mov    %esp,%ebp
+  801180:	57                   	push   %edi
+  801181:	56                   	push   %esi
+  801182:	53                   	push   %ebx
+  801183:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801186:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801189:	50                   	push   %eax
+  80118a:	ff 75 08             	push   0x8(%ebp)
+  80118d:	e8 6f fe ff ff       	call   801001 <fd_lookup>
+  801192:	89 c3                	mov    %eax,%ebx
+  801194:	83 c4 10             	add    $0x10,%esp
+  801197:	85 c0                	test   %eax,%eax
+  801199:	78 7f                	js     80121a <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80119b:	83 ec 0c             	sub    $0xc,%esp
+  80119e:	ff 75 0c             	push   0xc(%ebp)
+  8011a1:	e8 85 ff ff ff       	call   80112b <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8011a6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8011a9:	c1 e6 0c             	shl    $0xc,%esi
+  8011ac:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8011b2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8011b5:	89 3c 24             	mov    %edi,(%esp)
+  8011b8:	e8 d7 fd ff ff       	call   800f94 <fd2data>
+  8011bd:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8011bf:	89 34 24             	mov    %esi,(%esp)
+  8011c2:	e8 cd fd ff ff       	call   800f94 <fd2data>
+  8011c7:	83 c4 10             	add    $0x10,%esp
+  8011ca:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8011cd:	89 d8                	mov    %ebx,%eax
+  8011cf:	c1 e8 16             	shr    $0x16,%eax
+  8011d2:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8011d9:	a8 01                	test   $0x1,%al
+  8011db:	74 11                	je     8011ee <dup+0x71>
+  8011dd:	89 d8                	mov    %ebx,%eax
+  8011df:	c1 e8 0c             	shr    $0xc,%eax
+  8011e2:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8011e9:	f6 c2 01             	test   $0x1,%dl
+  8011ec:	75 36                	jne    801224 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8011ee:	89 f8                	mov    %edi,%eax
+  8011f0:	c1 e8 0c             	shr    $0xc,%eax
+  8011f3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8011fa:	83 ec 0c             	sub    $0xc,%esp
+  8011fd:	25 07 0e 00 00       	and    $0xe07,%eax
+  801202:	50                   	push   %eax
+  801203:	56                   	push   %esi
+  801204:	6a 00                	push   $0x0
+  801206:	57                   	push   %edi
+  801207:	6a 00                	push   $0x0
+  801209:	e8 e6 fa ff ff       	call   800cf4 <sys_page_map>
+  80120e:	89 c3                	mov    %eax,%ebx
+  801210:	83 c4 20             	add    $0x20,%esp
+  801213:	85 c0                	test   %eax,%eax
+  801215:	78 33                	js     80124a <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801217:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80121a:	89 d8                	mov    %ebx,%eax
+  80121c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80121f:	5b                   	pop    %ebx
+  801220:	5e                   	pop    %esi
+  801221:	5f                   	pop    %edi
+  801222:	5d                   	pop    %ebp
+  801223:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801224:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80122b:	83 ec 0c             	sub    $0xc,%esp
+  80122e:	25 07 0e 00 00       	and    $0xe07,%eax
+  801233:	50                   	push   %eax
+  801234:	ff 75 d4             	push   -0x2c(%ebp)
+  801237:	6a 00                	push   $0x0
+  801239:	53                   	push   %ebx
+  80123a:	6a 00                	push   $0x0
+  80123c:	e8 b3 fa ff ff       	call   800cf4 <sys_page_map>
+  801241:	89 c3                	mov    %eax,%ebx
+  801243:	83 c4 20             	add    $0x20,%esp
+  801246:	85 c0                	test   %eax,%eax
+  801248:	79 a4                	jns    8011ee <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80124a:	83 ec 08             	sub    $0x8,%esp
+  80124d:	56                   	push   %esi
+  80124e:	6a 00                	push   $0x0
+  801250:	e8 e1 fa ff ff       	call   800d36 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801255:	83 c4 08             	add    $0x8,%esp
+  801258:	ff 75 d4             	push   -0x2c(%ebp)
+  80125b:	6a 00                	push   $0x0
+  80125d:	e8 d4 fa ff ff       	call   800d36 <sys_page_unmap>
+	return r;
+  801262:	83 c4 10             	add    $0x10,%esp
+  801265:	eb b3                	jmp    80121a <dup+0x9d>
+
+00801267 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801267:	55                   	push   %ebp
+  801268:	89 e5                	mov    %esp,%ebp
+  80126a:	56                   	push   %esi
+  80126b:	53                   	push   %ebx
+  80126c:	83 ec 18             	sub    $0x18,%esp
+  80126f:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801272:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801275:	50                   	push   %eax
+  801276:	56                   	push   %esi
+  801277:	e8 85 fd ff ff       	call   801001 <fd_lookup>
+  80127c:	83 c4 10             	add    $0x10,%esp
+  80127f:	85 c0                	test   %eax,%eax
+  801281:	78 3c                	js     8012bf <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801283:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801286:	83 ec 08             	sub    $0x8,%esp
+  801289:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80128c:	50                   	push   %eax
+  80128d:	ff 33                	push   (%ebx)
+  80128f:	e8 bd fd ff ff       	call   801051 <dev_lookup>
+  801294:	83 c4 10             	add    $0x10,%esp
+  801297:	85 c0                	test   %eax,%eax
+  801299:	78 24                	js     8012bf <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80129b:	8b 43 08             	mov    0x8(%ebx),%eax
+  80129e:	83 e0 03             	and    $0x3,%eax
+  8012a1:	83 f8 01             	cmp    $0x1,%eax
+  8012a4:	74 20                	je     8012c6 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8012a6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8012a9:	8b 40 08             	mov    0x8(%eax),%eax
+  8012ac:	85 c0                	test   %eax,%eax
+  8012ae:	74 37                	je     8012e7 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8012b0:	83 ec 04             	sub    $0x4,%esp
+  8012b3:	ff 75 10             	push   0x10(%ebp)
+  8012b6:	ff 75 0c             	push   0xc(%ebp)
+  8012b9:	53                   	push   %ebx
+  8012ba:	ff d0                	call   *%eax
+  8012bc:	83 c4 10             	add    $0x10,%esp
+}
+  8012bf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8012c2:	5b                   	pop    %ebx
+  8012c3:	5e                   	pop    %esi
+  8012c4:	5d                   	pop    %ebp
+  8012c5:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8012c6:	a1 08 40 80 00       	mov    0x804008,%eax
+  8012cb:	8b 40 48             	mov    0x48(%eax),%eax
+  8012ce:	83 ec 04             	sub    $0x4,%esp
+  8012d1:	56                   	push   %esi
+  8012d2:	50                   	push   %eax
+  8012d3:	68 b1 2a 80 00       	push   $0x802ab1
+  8012d8:	e8 2f f0 ff ff       	call   80030c <cprintf>
+		return -E_INVAL;
+  8012dd:	83 c4 10             	add    $0x10,%esp
+  8012e0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012e5:	eb d8                	jmp    8012bf <read+0x58>
+		return -E_NOT_SUPP;
+  8012e7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8012ec:	eb d1                	jmp    8012bf <read+0x58>
+
+008012ee <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8012ee:	55                   	push   %ebp
+  8012ef:	89 e5                	mov    %esp,%ebp
+  8012f1:	57                   	push   %edi
+  8012f2:	56                   	push   %esi
+  8012f3:	53                   	push   %ebx
+  8012f4:	83 ec 0c             	sub    $0xc,%esp
+  8012f7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8012fa:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8012fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801302:	eb 02                	jmp    801306 <readn+0x18>
+  801304:	01 c3                	add    %eax,%ebx
+  801306:	39 f3                	cmp    %esi,%ebx
+  801308:	73 21                	jae    80132b <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80130a:	83 ec 04             	sub    $0x4,%esp
+  80130d:	89 f0                	mov    %esi,%eax
+  80130f:	29 d8                	sub    %ebx,%eax
+  801311:	50                   	push   %eax
+  801312:	89 d8                	mov    %ebx,%eax
+  801314:	03 45 0c             	add    0xc(%ebp),%eax
+  801317:	50                   	push   %eax
+  801318:	57                   	push   %edi
+  801319:	e8 49 ff ff ff       	call   801267 <read>
+		if (m < 0)
+  80131e:	83 c4 10             	add    $0x10,%esp
+  801321:	85 c0                	test   %eax,%eax
+  801323:	78 04                	js     801329 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801325:	75 dd                	jne    801304 <readn+0x16>
+  801327:	eb 02                	jmp    80132b <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801329:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80132b:	89 d8                	mov    %ebx,%eax
+  80132d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801330:	5b                   	pop    %ebx
+  801331:	5e                   	pop    %esi
+  801332:	5f                   	pop    %edi
+  801333:	5d                   	pop    %ebp
+  801334:	c3                   	ret
+
+00801335 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801335:	55                   	push   %ebp
+  801336:	89 e5                	mov    %esp,%ebp
+  801338:	56                   	push   %esi
+  801339:	53                   	push   %ebx
+  80133a:	83 ec 18             	sub    $0x18,%esp
+  80133d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801340:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801343:	50                   	push   %eax
+  801344:	53                   	push   %ebx
+  801345:	e8 b7 fc ff ff       	call   801001 <fd_lookup>
+  80134a:	83 c4 10             	add    $0x10,%esp
+  80134d:	85 c0                	test   %eax,%eax
+  80134f:	78 37                	js     801388 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801351:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801354:	83 ec 08             	sub    $0x8,%esp
+  801357:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80135a:	50                   	push   %eax
+  80135b:	ff 36                	push   (%esi)
+  80135d:	e8 ef fc ff ff       	call   801051 <dev_lookup>
+  801362:	83 c4 10             	add    $0x10,%esp
+  801365:	85 c0                	test   %eax,%eax
+  801367:	78 1f                	js     801388 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801369:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80136d:	74 20                	je     80138f <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80136f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801372:	8b 40 0c             	mov    0xc(%eax),%eax
+  801375:	85 c0                	test   %eax,%eax
+  801377:	74 37                	je     8013b0 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801379:	83 ec 04             	sub    $0x4,%esp
+  80137c:	ff 75 10             	push   0x10(%ebp)
+  80137f:	ff 75 0c             	push   0xc(%ebp)
+  801382:	56                   	push   %esi
+  801383:	ff d0                	call   *%eax
+  801385:	83 c4 10             	add    $0x10,%esp
+}
+  801388:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80138b:	5b                   	pop    %ebx
+  80138c:	5e                   	pop    %esi
+  80138d:	5d                   	pop    %ebp
+  80138e:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80138f:	a1 08 40 80 00       	mov    0x804008,%eax
+  801394:	8b 40 48             	mov    0x48(%eax),%eax
+  801397:	83 ec 04             	sub    $0x4,%esp
+  80139a:	53                   	push   %ebx
+  80139b:	50                   	push   %eax
+  80139c:	68 cd 2a 80 00       	push   $0x802acd
+  8013a1:	e8 66 ef ff ff       	call   80030c <cprintf>
+		return -E_INVAL;
+  8013a6:	83 c4 10             	add    $0x10,%esp
+  8013a9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013ae:	eb d8                	jmp    801388 <write+0x53>
+		return -E_NOT_SUPP;
+  8013b0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8013b5:	eb d1                	jmp    801388 <write+0x53>
+
+008013b7 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8013b7:	55                   	push   %ebp
+  8013b8:	89 e5                	mov    %esp,%ebp
+  8013ba:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8013bd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013c0:	50                   	push   %eax
+  8013c1:	ff 75 08             	push   0x8(%ebp)
+  8013c4:	e8 38 fc ff ff       	call   801001 <fd_lookup>
+  8013c9:	83 c4 10             	add    $0x10,%esp
+  8013cc:	85 c0                	test   %eax,%eax
+  8013ce:	78 0e                	js     8013de <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8013d0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8013d3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013d6:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8013d9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013de:	c9                   	leave
+  8013df:	c3                   	ret
+
+008013e0 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8013e0:	55                   	push   %ebp
+  8013e1:	89 e5                	mov    %esp,%ebp
+  8013e3:	56                   	push   %esi
+  8013e4:	53                   	push   %ebx
+  8013e5:	83 ec 18             	sub    $0x18,%esp
+  8013e8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8013eb:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8013ee:	50                   	push   %eax
+  8013ef:	53                   	push   %ebx
+  8013f0:	e8 0c fc ff ff       	call   801001 <fd_lookup>
+  8013f5:	83 c4 10             	add    $0x10,%esp
+  8013f8:	85 c0                	test   %eax,%eax
+  8013fa:	78 34                	js     801430 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8013fc:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8013ff:	83 ec 08             	sub    $0x8,%esp
+  801402:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801405:	50                   	push   %eax
+  801406:	ff 36                	push   (%esi)
+  801408:	e8 44 fc ff ff       	call   801051 <dev_lookup>
+  80140d:	83 c4 10             	add    $0x10,%esp
+  801410:	85 c0                	test   %eax,%eax
+  801412:	78 1c                	js     801430 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801414:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801418:	74 1d                	je     801437 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80141a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80141d:	8b 40 18             	mov    0x18(%eax),%eax
+  801420:	85 c0                	test   %eax,%eax
+  801422:	74 34                	je     801458 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801424:	83 ec 08             	sub    $0x8,%esp
+  801427:	ff 75 0c             	push   0xc(%ebp)
+  80142a:	56                   	push   %esi
+  80142b:	ff d0                	call   *%eax
+  80142d:	83 c4 10             	add    $0x10,%esp
+}
+  801430:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801433:	5b                   	pop    %ebx
+  801434:	5e                   	pop    %esi
+  801435:	5d                   	pop    %ebp
+  801436:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801437:	a1 08 40 80 00       	mov    0x804008,%eax
+  80143c:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80143f:	83 ec 04             	sub    $0x4,%esp
+  801442:	53                   	push   %ebx
+  801443:	50                   	push   %eax
+  801444:	68 90 2a 80 00       	push   $0x802a90
+  801449:	e8 be ee ff ff       	call   80030c <cprintf>
+		return -E_INVAL;
+  80144e:	83 c4 10             	add    $0x10,%esp
+  801451:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801456:	eb d8                	jmp    801430 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801458:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80145d:	eb d1                	jmp    801430 <ftruncate+0x50>
+
+0080145f <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80145f:	55                   	push   %ebp
+  801460:	89 e5                	mov    %esp,%ebp
+  801462:	56                   	push   %esi
+  801463:	53                   	push   %ebx
+  801464:	83 ec 18             	sub    $0x18,%esp
+  801467:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80146a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80146d:	50                   	push   %eax
+  80146e:	ff 75 08             	push   0x8(%ebp)
+  801471:	e8 8b fb ff ff       	call   801001 <fd_lookup>
+  801476:	83 c4 10             	add    $0x10,%esp
+  801479:	85 c0                	test   %eax,%eax
+  80147b:	78 49                	js     8014c6 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80147d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801480:	83 ec 08             	sub    $0x8,%esp
+  801483:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801486:	50                   	push   %eax
+  801487:	ff 36                	push   (%esi)
+  801489:	e8 c3 fb ff ff       	call   801051 <dev_lookup>
+  80148e:	83 c4 10             	add    $0x10,%esp
+  801491:	85 c0                	test   %eax,%eax
+  801493:	78 31                	js     8014c6 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801495:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801498:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80149c:	74 2f                	je     8014cd <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80149e:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8014a1:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8014a8:	00 00 00 
+	stat->st_isdir = 0;
+  8014ab:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8014b2:	00 00 00 
+	stat->st_dev = dev;
+  8014b5:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8014bb:	83 ec 08             	sub    $0x8,%esp
+  8014be:	53                   	push   %ebx
+  8014bf:	56                   	push   %esi
+  8014c0:	ff 50 14             	call   *0x14(%eax)
+  8014c3:	83 c4 10             	add    $0x10,%esp
+}
+  8014c6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014c9:	5b                   	pop    %ebx
+  8014ca:	5e                   	pop    %esi
+  8014cb:	5d                   	pop    %ebp
+  8014cc:	c3                   	ret
+		return -E_NOT_SUPP;
+  8014cd:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8014d2:	eb f2                	jmp    8014c6 <fstat+0x67>
+
+008014d4 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8014d4:	55                   	push   %ebp
+  8014d5:	89 e5                	mov    %esp,%ebp
+  8014d7:	56                   	push   %esi
+  8014d8:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8014d9:	83 ec 08             	sub    $0x8,%esp
+  8014dc:	6a 00                	push   $0x0
+  8014de:	ff 75 08             	push   0x8(%ebp)
+  8014e1:	e8 e4 01 00 00       	call   8016ca <open>
+  8014e6:	89 c3                	mov    %eax,%ebx
+  8014e8:	83 c4 10             	add    $0x10,%esp
+  8014eb:	85 c0                	test   %eax,%eax
+  8014ed:	78 1b                	js     80150a <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8014ef:	83 ec 08             	sub    $0x8,%esp
+  8014f2:	ff 75 0c             	push   0xc(%ebp)
+  8014f5:	50                   	push   %eax
+  8014f6:	e8 64 ff ff ff       	call   80145f <fstat>
+  8014fb:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8014fd:	89 1c 24             	mov    %ebx,(%esp)
+  801500:	e8 26 fc ff ff       	call   80112b <close>
+	return r;
+  801505:	83 c4 10             	add    $0x10,%esp
+  801508:	89 f3                	mov    %esi,%ebx
+}
+  80150a:	89 d8                	mov    %ebx,%eax
+  80150c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80150f:	5b                   	pop    %ebx
+  801510:	5e                   	pop    %esi
+  801511:	5d                   	pop    %ebp
+  801512:	c3                   	ret
+
+00801513 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  801513:	55                   	push   %ebp
+  801514:	89 e5                	mov    %esp,%ebp
+  801516:	56                   	push   %esi
+  801517:	53                   	push   %ebx
+  801518:	89 c6                	mov    %eax,%esi
+  80151a:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  80151c:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  801523:	74 27                	je     80154c <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801525:	6a 07                	push   $0x7
+  801527:	68 00 50 80 00       	push   $0x805000
+  80152c:	56                   	push   %esi
+  80152d:	ff 35 00 40 80 00    	push   0x804000
+  801533:	e8 d1 0b 00 00       	call   802109 <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  801538:	83 c4 0c             	add    $0xc,%esp
+  80153b:	6a 00                	push   $0x0
+  80153d:	53                   	push   %ebx
+  80153e:	6a 00                	push   $0x0
+  801540:	e8 50 0b 00 00       	call   802095 <ipc_recv>
+}
+  801545:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801548:	5b                   	pop    %ebx
+  801549:	5e                   	pop    %esi
+  80154a:	5d                   	pop    %ebp
+  80154b:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  80154c:	83 ec 0c             	sub    $0xc,%esp
+  80154f:	6a 01                	push   $0x1
+  801551:	e8 07 0c 00 00       	call   80215d <ipc_find_env>
+  801556:	a3 00 40 80 00       	mov    %eax,0x804000
+  80155b:	83 c4 10             	add    $0x10,%esp
+  80155e:	eb c5                	jmp    801525 <fsipc+0x12>
+
+00801560 <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801560:	55                   	push   %ebp
+  801561:	89 e5                	mov    %esp,%ebp
+  801563:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801566:	8b 45 08             	mov    0x8(%ebp),%eax
+  801569:	8b 40 0c             	mov    0xc(%eax),%eax
+  80156c:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.set_size.req_size = newsize;
+  801571:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801574:	a3 04 50 80 00       	mov    %eax,0x805004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801579:	ba 00 00 00 00       	mov    $0x0,%edx
+  80157e:	b8 02 00 00 00       	mov    $0x2,%eax
+  801583:	e8 8b ff ff ff       	call   801513 <fsipc>
+}
+  801588:	c9                   	leave
+  801589:	c3                   	ret
+
+0080158a <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80158a:	55                   	push   %ebp
+  80158b:	89 e5                	mov    %esp,%ebp
+  80158d:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801590:	8b 45 08             	mov    0x8(%ebp),%eax
+  801593:	8b 40 0c             	mov    0xc(%eax),%eax
+  801596:	a3 00 50 80 00       	mov    %eax,0x805000
+  return fsipc(FSREQ_FLUSH, NULL);
+  80159b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015a0:	b8 06 00 00 00       	mov    $0x6,%eax
+  8015a5:	e8 69 ff ff ff       	call   801513 <fsipc>
+}
+  8015aa:	c9                   	leave
+  8015ab:	c3                   	ret
+
+008015ac <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8015ac:	55                   	push   %ebp
+  8015ad:	89 e5                	mov    %esp,%ebp
+  8015af:	53                   	push   %ebx
+  8015b0:	83 ec 04             	sub    $0x4,%esp
+  8015b3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8015b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015b9:	8b 40 0c             	mov    0xc(%eax),%eax
+  8015bc:	a3 00 50 80 00       	mov    %eax,0x805000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8015c1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015c6:	b8 05 00 00 00       	mov    $0x5,%eax
+  8015cb:	e8 43 ff ff ff       	call   801513 <fsipc>
+  8015d0:	85 c0                	test   %eax,%eax
+  8015d2:	78 2c                	js     801600 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8015d4:	83 ec 08             	sub    $0x8,%esp
+  8015d7:	68 00 50 80 00       	push   $0x805000
+  8015dc:	53                   	push   %ebx
+  8015dd:	e8 e3 f2 ff ff       	call   8008c5 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  8015e2:	a1 80 50 80 00       	mov    0x805080,%eax
+  8015e7:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8015ed:	a1 84 50 80 00       	mov    0x805084,%eax
+  8015f2:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  8015f8:	83 c4 10             	add    $0x10,%esp
+  8015fb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801600:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801603:	c9                   	leave
+  801604:	c3                   	ret
+
+00801605 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801605:	55                   	push   %ebp
+  801606:	89 e5                	mov    %esp,%ebp
+  801608:	83 ec 0c             	sub    $0xc,%esp
+  80160b:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80160e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801611:	8b 52 0c             	mov    0xc(%edx),%edx
+  801614:	89 15 00 50 80 00    	mov    %edx,0x805000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80161a:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  80161f:	39 d0                	cmp    %edx,%eax
+  801621:	0f 47 c2             	cmova  %edx,%eax
+  801624:	a3 04 50 80 00       	mov    %eax,0x805004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  801629:	50                   	push   %eax
+  80162a:	ff 75 0c             	push   0xc(%ebp)
+  80162d:	68 08 50 80 00       	push   $0x805008
+  801632:	e8 14 f4 ff ff       	call   800a4b <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801637:	ba 00 00 00 00       	mov    $0x0,%edx
+  80163c:	b8 04 00 00 00       	mov    $0x4,%eax
+  801641:	e8 cd fe ff ff       	call   801513 <fsipc>
+}
+  801646:	c9                   	leave
+  801647:	c3                   	ret
+
+00801648 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801648:	55                   	push   %ebp
+  801649:	89 e5                	mov    %esp,%ebp
+  80164b:	56                   	push   %esi
+  80164c:	53                   	push   %ebx
+  80164d:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801650:	8b 45 08             	mov    0x8(%ebp),%eax
+  801653:	8b 40 0c             	mov    0xc(%eax),%eax
+  801656:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.read.req_n = n;
+  80165b:	89 35 04 50 80 00    	mov    %esi,0x805004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801661:	ba 00 00 00 00       	mov    $0x0,%edx
+  801666:	b8 03 00 00 00       	mov    $0x3,%eax
+  80166b:	e8 a3 fe ff ff       	call   801513 <fsipc>
+  801670:	89 c3                	mov    %eax,%ebx
+  801672:	85 c0                	test   %eax,%eax
+  801674:	78 1f                	js     801695 <devfile_read+0x4d>
+  assert(r <= n);
+  801676:	39 c6                	cmp    %eax,%esi
+  801678:	72 24                	jb     80169e <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  80167a:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80167f:	7f 33                	jg     8016b4 <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801681:	83 ec 04             	sub    $0x4,%esp
+  801684:	50                   	push   %eax
+  801685:	68 00 50 80 00       	push   $0x805000
+  80168a:	ff 75 0c             	push   0xc(%ebp)
+  80168d:	e8 b9 f3 ff ff       	call   800a4b <memmove>
+  return r;
+  801692:	83 c4 10             	add    $0x10,%esp
+}
+  801695:	89 d8                	mov    %ebx,%eax
+  801697:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80169a:	5b                   	pop    %ebx
+  80169b:	5e                   	pop    %esi
+  80169c:	5d                   	pop    %ebp
+  80169d:	c3                   	ret
+  assert(r <= n);
+  80169e:	68 00 2b 80 00       	push   $0x802b00
+  8016a3:	68 07 2b 80 00       	push   $0x802b07
+  8016a8:	6a 78                	push   $0x78
+  8016aa:	68 1c 2b 80 00       	push   $0x802b1c
+  8016af:	e8 7d eb ff ff       	call   800231 <_panic>
+  assert(r <= PGSIZE);
+  8016b4:	68 27 2b 80 00       	push   $0x802b27
+  8016b9:	68 07 2b 80 00       	push   $0x802b07
+  8016be:	6a 79                	push   $0x79
+  8016c0:	68 1c 2b 80 00       	push   $0x802b1c
+  8016c5:	e8 67 eb ff ff       	call   800231 <_panic>
+
+008016ca <open>:
+open(const char *path, int mode) {
+  8016ca:	55                   	push   %ebp
+  8016cb:	89 e5                	mov    %esp,%ebp
+  8016cd:	56                   	push   %esi
+  8016ce:	53                   	push   %ebx
+  8016cf:	83 ec 1c             	sub    $0x1c,%esp
+  8016d2:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  8016d5:	56                   	push   %esi
+  8016d6:	e8 af f1 ff ff       	call   80088a <strlen>
+  8016db:	83 c4 10             	add    $0x10,%esp
+  8016de:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8016e3:	7f 6c                	jg     801751 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  8016e5:	83 ec 0c             	sub    $0xc,%esp
+  8016e8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016eb:	50                   	push   %eax
+  8016ec:	e8 ba f8 ff ff       	call   800fab <fd_alloc>
+  8016f1:	89 c3                	mov    %eax,%ebx
+  8016f3:	83 c4 10             	add    $0x10,%esp
+  8016f6:	85 c0                	test   %eax,%eax
+  8016f8:	78 3c                	js     801736 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  8016fa:	83 ec 08             	sub    $0x8,%esp
+  8016fd:	56                   	push   %esi
+  8016fe:	68 00 50 80 00       	push   $0x805000
+  801703:	e8 bd f1 ff ff       	call   8008c5 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801708:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80170b:	a3 00 54 80 00       	mov    %eax,0x805400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801710:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801713:	b8 01 00 00 00       	mov    $0x1,%eax
+  801718:	e8 f6 fd ff ff       	call   801513 <fsipc>
+  80171d:	89 c3                	mov    %eax,%ebx
+  80171f:	83 c4 10             	add    $0x10,%esp
+  801722:	85 c0                	test   %eax,%eax
+  801724:	78 19                	js     80173f <open+0x75>
+  return fd2num(fd);
+  801726:	83 ec 0c             	sub    $0xc,%esp
+  801729:	ff 75 f4             	push   -0xc(%ebp)
+  80172c:	e8 53 f8 ff ff       	call   800f84 <fd2num>
+  801731:	89 c3                	mov    %eax,%ebx
+  801733:	83 c4 10             	add    $0x10,%esp
+}
+  801736:	89 d8                	mov    %ebx,%eax
+  801738:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80173b:	5b                   	pop    %ebx
+  80173c:	5e                   	pop    %esi
+  80173d:	5d                   	pop    %ebp
+  80173e:	c3                   	ret
+    fd_close(fd, 0);
+  80173f:	83 ec 08             	sub    $0x8,%esp
+  801742:	6a 00                	push   $0x0
+  801744:	ff 75 f4             	push   -0xc(%ebp)
+  801747:	e8 58 f9 ff ff       	call   8010a4 <fd_close>
+    return r;
+  80174c:	83 c4 10             	add    $0x10,%esp
+  80174f:	eb e5                	jmp    801736 <open+0x6c>
+    return -E_BAD_PATH;
+  801751:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801756:	eb de                	jmp    801736 <open+0x6c>
+
+00801758 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  801758:	55                   	push   %ebp
+  801759:	89 e5                	mov    %esp,%ebp
+  80175b:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  80175e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801763:	b8 08 00 00 00       	mov    $0x8,%eax
+  801768:	e8 a6 fd ff ff       	call   801513 <fsipc>
+}
+  80176d:	c9                   	leave
+  80176e:	c3                   	ret
+
+0080176f <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80176f:	55                   	push   %ebp
+  801770:	89 e5                	mov    %esp,%ebp
+  801772:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801775:	68 33 2b 80 00       	push   $0x802b33
+  80177a:	ff 75 0c             	push   0xc(%ebp)
+  80177d:	e8 43 f1 ff ff       	call   8008c5 <strcpy>
+	return 0;
+}
+  801782:	b8 00 00 00 00       	mov    $0x0,%eax
+  801787:	c9                   	leave
+  801788:	c3                   	ret
+
+00801789 <devsock_close>:
+{
+  801789:	55                   	push   %ebp
+  80178a:	89 e5                	mov    %esp,%ebp
+  80178c:	53                   	push   %ebx
+  80178d:	83 ec 10             	sub    $0x10,%esp
+  801790:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801793:	53                   	push   %ebx
+  801794:	e8 03 0a 00 00       	call   80219c <pageref>
+  801799:	89 c2                	mov    %eax,%edx
+  80179b:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80179e:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8017a3:	83 fa 01             	cmp    $0x1,%edx
+  8017a6:	74 05                	je     8017ad <devsock_close+0x24>
+}
+  8017a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017ab:	c9                   	leave
+  8017ac:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8017ad:	83 ec 0c             	sub    $0xc,%esp
+  8017b0:	ff 73 0c             	push   0xc(%ebx)
+  8017b3:	e8 b7 02 00 00       	call   801a6f <nsipc_close>
+  8017b8:	83 c4 10             	add    $0x10,%esp
+  8017bb:	eb eb                	jmp    8017a8 <devsock_close+0x1f>
+
+008017bd <devsock_write>:
+{
+  8017bd:	55                   	push   %ebp
+  8017be:	89 e5                	mov    %esp,%ebp
+  8017c0:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8017c3:	6a 00                	push   $0x0
+  8017c5:	ff 75 10             	push   0x10(%ebp)
+  8017c8:	ff 75 0c             	push   0xc(%ebp)
+  8017cb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017ce:	ff 70 0c             	push   0xc(%eax)
+  8017d1:	e8 79 03 00 00       	call   801b4f <nsipc_send>
+}
+  8017d6:	c9                   	leave
+  8017d7:	c3                   	ret
+
+008017d8 <devsock_read>:
+{
+  8017d8:	55                   	push   %ebp
+  8017d9:	89 e5                	mov    %esp,%ebp
+  8017db:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8017de:	6a 00                	push   $0x0
+  8017e0:	ff 75 10             	push   0x10(%ebp)
+  8017e3:	ff 75 0c             	push   0xc(%ebp)
+  8017e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017e9:	ff 70 0c             	push   0xc(%eax)
+  8017ec:	e8 ef 02 00 00       	call   801ae0 <nsipc_recv>
+}
+  8017f1:	c9                   	leave
+  8017f2:	c3                   	ret
+
+008017f3 <fd2sockid>:
+{
+  8017f3:	55                   	push   %ebp
+  8017f4:	89 e5                	mov    %esp,%ebp
+  8017f6:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8017f9:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8017fc:	52                   	push   %edx
+  8017fd:	50                   	push   %eax
+  8017fe:	e8 fe f7 ff ff       	call   801001 <fd_lookup>
+  801803:	83 c4 10             	add    $0x10,%esp
+  801806:	85 c0                	test   %eax,%eax
+  801808:	78 10                	js     80181a <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  80180a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80180d:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  801813:	39 08                	cmp    %ecx,(%eax)
+  801815:	75 05                	jne    80181c <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801817:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  80181a:	c9                   	leave
+  80181b:	c3                   	ret
+		return -E_NOT_SUPP;
+  80181c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801821:	eb f7                	jmp    80181a <fd2sockid+0x27>
+
+00801823 <alloc_sockfd>:
+{
+  801823:	55                   	push   %ebp
+  801824:	89 e5                	mov    %esp,%ebp
+  801826:	56                   	push   %esi
+  801827:	53                   	push   %ebx
+  801828:	83 ec 1c             	sub    $0x1c,%esp
+  80182b:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  80182d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801830:	50                   	push   %eax
+  801831:	e8 75 f7 ff ff       	call   800fab <fd_alloc>
+  801836:	89 c3                	mov    %eax,%ebx
+  801838:	83 c4 10             	add    $0x10,%esp
+  80183b:	85 c0                	test   %eax,%eax
+  80183d:	78 43                	js     801882 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80183f:	83 ec 04             	sub    $0x4,%esp
+  801842:	68 07 04 00 00       	push   $0x407
+  801847:	ff 75 f4             	push   -0xc(%ebp)
+  80184a:	6a 00                	push   $0x0
+  80184c:	e8 60 f4 ff ff       	call   800cb1 <sys_page_alloc>
+  801851:	89 c3                	mov    %eax,%ebx
+  801853:	83 c4 10             	add    $0x10,%esp
+  801856:	85 c0                	test   %eax,%eax
+  801858:	78 28                	js     801882 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  80185a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80185d:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  801863:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801865:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801868:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  80186f:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801872:	83 ec 0c             	sub    $0xc,%esp
+  801875:	50                   	push   %eax
+  801876:	e8 09 f7 ff ff       	call   800f84 <fd2num>
+  80187b:	89 c3                	mov    %eax,%ebx
+  80187d:	83 c4 10             	add    $0x10,%esp
+  801880:	eb 0c                	jmp    80188e <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801882:	83 ec 0c             	sub    $0xc,%esp
+  801885:	56                   	push   %esi
+  801886:	e8 e4 01 00 00       	call   801a6f <nsipc_close>
+		return r;
+  80188b:	83 c4 10             	add    $0x10,%esp
+}
+  80188e:	89 d8                	mov    %ebx,%eax
+  801890:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801893:	5b                   	pop    %ebx
+  801894:	5e                   	pop    %esi
+  801895:	5d                   	pop    %ebp
+  801896:	c3                   	ret
+
+00801897 <accept>:
+{
+  801897:	55                   	push   %ebp
+  801898:	89 e5                	mov    %esp,%ebp
+  80189a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80189d:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018a0:	e8 4e ff ff ff       	call   8017f3 <fd2sockid>
+  8018a5:	85 c0                	test   %eax,%eax
+  8018a7:	78 1b                	js     8018c4 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8018a9:	83 ec 04             	sub    $0x4,%esp
+  8018ac:	ff 75 10             	push   0x10(%ebp)
+  8018af:	ff 75 0c             	push   0xc(%ebp)
+  8018b2:	50                   	push   %eax
+  8018b3:	e8 0e 01 00 00       	call   8019c6 <nsipc_accept>
+  8018b8:	83 c4 10             	add    $0x10,%esp
+  8018bb:	85 c0                	test   %eax,%eax
+  8018bd:	78 05                	js     8018c4 <accept+0x2d>
+	return alloc_sockfd(r);
+  8018bf:	e8 5f ff ff ff       	call   801823 <alloc_sockfd>
+}
+  8018c4:	c9                   	leave
+  8018c5:	c3                   	ret
+
+008018c6 <bind>:
+{
+  8018c6:	55                   	push   %ebp
+  8018c7:	89 e5                	mov    %esp,%ebp
+  8018c9:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8018cc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018cf:	e8 1f ff ff ff       	call   8017f3 <fd2sockid>
+  8018d4:	85 c0                	test   %eax,%eax
+  8018d6:	78 12                	js     8018ea <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8018d8:	83 ec 04             	sub    $0x4,%esp
+  8018db:	ff 75 10             	push   0x10(%ebp)
+  8018de:	ff 75 0c             	push   0xc(%ebp)
+  8018e1:	50                   	push   %eax
+  8018e2:	e8 31 01 00 00       	call   801a18 <nsipc_bind>
+  8018e7:	83 c4 10             	add    $0x10,%esp
+}
+  8018ea:	c9                   	leave
+  8018eb:	c3                   	ret
+
+008018ec <shutdown>:
+{
+  8018ec:	55                   	push   %ebp
+  8018ed:	89 e5                	mov    %esp,%ebp
+  8018ef:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8018f2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018f5:	e8 f9 fe ff ff       	call   8017f3 <fd2sockid>
+  8018fa:	85 c0                	test   %eax,%eax
+  8018fc:	78 0f                	js     80190d <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8018fe:	83 ec 08             	sub    $0x8,%esp
+  801901:	ff 75 0c             	push   0xc(%ebp)
+  801904:	50                   	push   %eax
+  801905:	e8 43 01 00 00       	call   801a4d <nsipc_shutdown>
+  80190a:	83 c4 10             	add    $0x10,%esp
+}
+  80190d:	c9                   	leave
+  80190e:	c3                   	ret
+
+0080190f <connect>:
+{
+  80190f:	55                   	push   %ebp
+  801910:	89 e5                	mov    %esp,%ebp
+  801912:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801915:	8b 45 08             	mov    0x8(%ebp),%eax
+  801918:	e8 d6 fe ff ff       	call   8017f3 <fd2sockid>
+  80191d:	85 c0                	test   %eax,%eax
+  80191f:	78 12                	js     801933 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801921:	83 ec 04             	sub    $0x4,%esp
+  801924:	ff 75 10             	push   0x10(%ebp)
+  801927:	ff 75 0c             	push   0xc(%ebp)
+  80192a:	50                   	push   %eax
+  80192b:	e8 59 01 00 00       	call   801a89 <nsipc_connect>
+  801930:	83 c4 10             	add    $0x10,%esp
+}
+  801933:	c9                   	leave
+  801934:	c3                   	ret
+
+00801935 <listen>:
+{
+  801935:	55                   	push   %ebp
+  801936:	89 e5                	mov    %esp,%ebp
+  801938:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80193b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80193e:	e8 b0 fe ff ff       	call   8017f3 <fd2sockid>
+  801943:	85 c0                	test   %eax,%eax
+  801945:	78 0f                	js     801956 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801947:	83 ec 08             	sub    $0x8,%esp
+  80194a:	ff 75 0c             	push   0xc(%ebp)
+  80194d:	50                   	push   %eax
+  80194e:	e8 6b 01 00 00       	call   801abe <nsipc_listen>
+  801953:	83 c4 10             	add    $0x10,%esp
+}
+  801956:	c9                   	leave
+  801957:	c3                   	ret
+
+00801958 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801958:	55                   	push   %ebp
+  801959:	89 e5                	mov    %esp,%ebp
+  80195b:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  80195e:	ff 75 10             	push   0x10(%ebp)
+  801961:	ff 75 0c             	push   0xc(%ebp)
+  801964:	ff 75 08             	push   0x8(%ebp)
+  801967:	e8 41 02 00 00       	call   801bad <nsipc_socket>
+  80196c:	83 c4 10             	add    $0x10,%esp
+  80196f:	85 c0                	test   %eax,%eax
+  801971:	78 05                	js     801978 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801973:	e8 ab fe ff ff       	call   801823 <alloc_sockfd>
+}
+  801978:	c9                   	leave
+  801979:	c3                   	ret
+
+0080197a <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80197a:	55                   	push   %ebp
+  80197b:	89 e5                	mov    %esp,%ebp
+  80197d:	53                   	push   %ebx
+  80197e:	83 ec 04             	sub    $0x4,%esp
+  801981:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801983:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80198a:	74 26                	je     8019b2 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  80198c:	6a 07                	push   $0x7
+  80198e:	68 00 60 80 00       	push   $0x806000
+  801993:	53                   	push   %ebx
+  801994:	ff 35 04 40 80 00    	push   0x804004
+  80199a:	e8 6a 07 00 00       	call   802109 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  80199f:	83 c4 0c             	add    $0xc,%esp
+  8019a2:	6a 00                	push   $0x0
+  8019a4:	6a 00                	push   $0x0
+  8019a6:	6a 00                	push   $0x0
+  8019a8:	e8 e8 06 00 00       	call   802095 <ipc_recv>
+}
+  8019ad:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019b0:	c9                   	leave
+  8019b1:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8019b2:	83 ec 0c             	sub    $0xc,%esp
+  8019b5:	6a 02                	push   $0x2
+  8019b7:	e8 a1 07 00 00       	call   80215d <ipc_find_env>
+  8019bc:	a3 04 40 80 00       	mov    %eax,0x804004
+  8019c1:	83 c4 10             	add    $0x10,%esp
+  8019c4:	eb c6                	jmp    80198c <nsipc+0x12>
+
+008019c6 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8019c6:	55                   	push   %ebp
+  8019c7:	89 e5                	mov    %esp,%ebp
+  8019c9:	56                   	push   %esi
+  8019ca:	53                   	push   %ebx
+  8019cb:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8019ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019d1:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  8019d6:	8b 06                	mov    (%esi),%eax
+  8019d8:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8019dd:	b8 01 00 00 00       	mov    $0x1,%eax
+  8019e2:	e8 93 ff ff ff       	call   80197a <nsipc>
+  8019e7:	89 c3                	mov    %eax,%ebx
+  8019e9:	85 c0                	test   %eax,%eax
+  8019eb:	79 09                	jns    8019f6 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8019ed:	89 d8                	mov    %ebx,%eax
+  8019ef:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019f2:	5b                   	pop    %ebx
+  8019f3:	5e                   	pop    %esi
+  8019f4:	5d                   	pop    %ebp
+  8019f5:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8019f6:	83 ec 04             	sub    $0x4,%esp
+  8019f9:	ff 35 10 60 80 00    	push   0x806010
+  8019ff:	68 00 60 80 00       	push   $0x806000
+  801a04:	ff 75 0c             	push   0xc(%ebp)
+  801a07:	e8 3f f0 ff ff       	call   800a4b <memmove>
+		*addrlen = ret->ret_addrlen;
+  801a0c:	a1 10 60 80 00       	mov    0x806010,%eax
+  801a11:	89 06                	mov    %eax,(%esi)
+  801a13:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801a16:	eb d5                	jmp    8019ed <nsipc_accept+0x27>
+
+00801a18 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801a18:	55                   	push   %ebp
+  801a19:	89 e5                	mov    %esp,%ebp
+  801a1b:	53                   	push   %ebx
+  801a1c:	83 ec 08             	sub    $0x8,%esp
+  801a1f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801a22:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a25:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801a2a:	53                   	push   %ebx
+  801a2b:	ff 75 0c             	push   0xc(%ebp)
+  801a2e:	68 04 60 80 00       	push   $0x806004
+  801a33:	e8 13 f0 ff ff       	call   800a4b <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801a38:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  801a3e:	b8 02 00 00 00       	mov    $0x2,%eax
+  801a43:	e8 32 ff ff ff       	call   80197a <nsipc>
+}
+  801a48:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a4b:	c9                   	leave
+  801a4c:	c3                   	ret
+
+00801a4d <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801a4d:	55                   	push   %ebp
+  801a4e:	89 e5                	mov    %esp,%ebp
+  801a50:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801a53:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a56:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  801a5b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a5e:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  801a63:	b8 03 00 00 00       	mov    $0x3,%eax
+  801a68:	e8 0d ff ff ff       	call   80197a <nsipc>
+}
+  801a6d:	c9                   	leave
+  801a6e:	c3                   	ret
+
+00801a6f <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801a6f:	55                   	push   %ebp
+  801a70:	89 e5                	mov    %esp,%ebp
+  801a72:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801a75:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a78:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  801a7d:	b8 04 00 00 00       	mov    $0x4,%eax
+  801a82:	e8 f3 fe ff ff       	call   80197a <nsipc>
+}
+  801a87:	c9                   	leave
+  801a88:	c3                   	ret
+
+00801a89 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801a89:	55                   	push   %ebp
+  801a8a:	89 e5                	mov    %esp,%ebp
+  801a8c:	53                   	push   %ebx
+  801a8d:	83 ec 08             	sub    $0x8,%esp
+  801a90:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801a93:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a96:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801a9b:	53                   	push   %ebx
+  801a9c:	ff 75 0c             	push   0xc(%ebp)
+  801a9f:	68 04 60 80 00       	push   $0x806004
+  801aa4:	e8 a2 ef ff ff       	call   800a4b <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801aa9:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  801aaf:	b8 05 00 00 00       	mov    $0x5,%eax
+  801ab4:	e8 c1 fe ff ff       	call   80197a <nsipc>
+}
+  801ab9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801abc:	c9                   	leave
+  801abd:	c3                   	ret
+
+00801abe <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801abe:	55                   	push   %ebp
+  801abf:	89 e5                	mov    %esp,%ebp
+  801ac1:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801ac4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ac7:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  801acc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801acf:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  801ad4:	b8 06 00 00 00       	mov    $0x6,%eax
+  801ad9:	e8 9c fe ff ff       	call   80197a <nsipc>
+}
+  801ade:	c9                   	leave
+  801adf:	c3                   	ret
+
+00801ae0 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801ae0:	55                   	push   %ebp
+  801ae1:	89 e5                	mov    %esp,%ebp
+  801ae3:	56                   	push   %esi
+  801ae4:	53                   	push   %ebx
+  801ae5:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801ae8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801aeb:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  801af0:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  801af6:	8b 45 14             	mov    0x14(%ebp),%eax
+  801af9:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801afe:	b8 07 00 00 00       	mov    $0x7,%eax
+  801b03:	e8 72 fe ff ff       	call   80197a <nsipc>
+  801b08:	89 c3                	mov    %eax,%ebx
+  801b0a:	85 c0                	test   %eax,%eax
+  801b0c:	78 22                	js     801b30 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801b0e:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801b13:	39 c6                	cmp    %eax,%esi
+  801b15:	0f 4e c6             	cmovle %esi,%eax
+  801b18:	39 c3                	cmp    %eax,%ebx
+  801b1a:	7f 1d                	jg     801b39 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801b1c:	83 ec 04             	sub    $0x4,%esp
+  801b1f:	53                   	push   %ebx
+  801b20:	68 00 60 80 00       	push   $0x806000
+  801b25:	ff 75 0c             	push   0xc(%ebp)
+  801b28:	e8 1e ef ff ff       	call   800a4b <memmove>
+  801b2d:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801b30:	89 d8                	mov    %ebx,%eax
+  801b32:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b35:	5b                   	pop    %ebx
+  801b36:	5e                   	pop    %esi
+  801b37:	5d                   	pop    %ebp
+  801b38:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801b39:	68 3f 2b 80 00       	push   $0x802b3f
+  801b3e:	68 07 2b 80 00       	push   $0x802b07
+  801b43:	6a 62                	push   $0x62
+  801b45:	68 54 2b 80 00       	push   $0x802b54
+  801b4a:	e8 e2 e6 ff ff       	call   800231 <_panic>
+
+00801b4f <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801b4f:	55                   	push   %ebp
+  801b50:	89 e5                	mov    %esp,%ebp
+  801b52:	53                   	push   %ebx
+  801b53:	83 ec 04             	sub    $0x4,%esp
+  801b56:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801b59:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b5c:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  801b61:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801b67:	7f 2e                	jg     801b97 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801b69:	83 ec 04             	sub    $0x4,%esp
+  801b6c:	53                   	push   %ebx
+  801b6d:	ff 75 0c             	push   0xc(%ebp)
+  801b70:	68 0c 60 80 00       	push   $0x80600c
+  801b75:	e8 d1 ee ff ff       	call   800a4b <memmove>
+	nsipcbuf.send.req_size = size;
+  801b7a:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  801b80:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b83:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  801b88:	b8 08 00 00 00       	mov    $0x8,%eax
+  801b8d:	e8 e8 fd ff ff       	call   80197a <nsipc>
+}
+  801b92:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b95:	c9                   	leave
+  801b96:	c3                   	ret
+	assert(size < 1600);
+  801b97:	68 60 2b 80 00       	push   $0x802b60
+  801b9c:	68 07 2b 80 00       	push   $0x802b07
+  801ba1:	6a 6d                	push   $0x6d
+  801ba3:	68 54 2b 80 00       	push   $0x802b54
+  801ba8:	e8 84 e6 ff ff       	call   800231 <_panic>
+
+00801bad <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801bad:	55                   	push   %ebp
+  801bae:	89 e5                	mov    %esp,%ebp
+  801bb0:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801bb3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bb6:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  801bbb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801bbe:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  801bc3:	8b 45 10             	mov    0x10(%ebp),%eax
+  801bc6:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  801bcb:	b8 09 00 00 00       	mov    $0x9,%eax
+  801bd0:	e8 a5 fd ff ff       	call   80197a <nsipc>
+}
+  801bd5:	c9                   	leave
+  801bd6:	c3                   	ret
+
+00801bd7 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801bd7:	55                   	push   %ebp
+  801bd8:	89 e5                	mov    %esp,%ebp
+  801bda:	56                   	push   %esi
+  801bdb:	53                   	push   %ebx
+  801bdc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801bdf:	83 ec 0c             	sub    $0xc,%esp
+  801be2:	ff 75 08             	push   0x8(%ebp)
+  801be5:	e8 aa f3 ff ff       	call   800f94 <fd2data>
+  801bea:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801bec:	83 c4 08             	add    $0x8,%esp
+  801bef:	68 6c 2b 80 00       	push   $0x802b6c
+  801bf4:	53                   	push   %ebx
+  801bf5:	e8 cb ec ff ff       	call   8008c5 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801bfa:	8b 46 04             	mov    0x4(%esi),%eax
+  801bfd:	2b 06                	sub    (%esi),%eax
+  801bff:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  801c05:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801c0c:	00 00 00 
+	stat->st_dev = &devpipe;
+  801c0f:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  801c16:	30 80 00 
+	return 0;
+}
+  801c19:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c1e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c21:	5b                   	pop    %ebx
+  801c22:	5e                   	pop    %esi
+  801c23:	5d                   	pop    %ebp
+  801c24:	c3                   	ret
+
+00801c25 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801c25:	55                   	push   %ebp
+  801c26:	89 e5                	mov    %esp,%ebp
+  801c28:	53                   	push   %ebx
+  801c29:	83 ec 0c             	sub    $0xc,%esp
+  801c2c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801c2f:	53                   	push   %ebx
+  801c30:	6a 00                	push   $0x0
+  801c32:	e8 ff f0 ff ff       	call   800d36 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801c37:	89 1c 24             	mov    %ebx,(%esp)
+  801c3a:	e8 55 f3 ff ff       	call   800f94 <fd2data>
+  801c3f:	83 c4 08             	add    $0x8,%esp
+  801c42:	50                   	push   %eax
+  801c43:	6a 00                	push   $0x0
+  801c45:	e8 ec f0 ff ff       	call   800d36 <sys_page_unmap>
+}
+  801c4a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c4d:	c9                   	leave
+  801c4e:	c3                   	ret
+
+00801c4f <_pipeisclosed>:
+{
+  801c4f:	55                   	push   %ebp
+  801c50:	89 e5                	mov    %esp,%ebp
+  801c52:	57                   	push   %edi
+  801c53:	56                   	push   %esi
+  801c54:	53                   	push   %ebx
+  801c55:	83 ec 1c             	sub    $0x1c,%esp
+  801c58:	89 c7                	mov    %eax,%edi
+  801c5a:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801c5c:	a1 08 40 80 00       	mov    0x804008,%eax
+  801c61:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801c64:	83 ec 0c             	sub    $0xc,%esp
+  801c67:	57                   	push   %edi
+  801c68:	e8 2f 05 00 00       	call   80219c <pageref>
+  801c6d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801c70:	89 34 24             	mov    %esi,(%esp)
+  801c73:	e8 24 05 00 00       	call   80219c <pageref>
+		nn = thisenv->env_runs;
+  801c78:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801c7e:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801c81:	83 c4 10             	add    $0x10,%esp
+  801c84:	39 cb                	cmp    %ecx,%ebx
+  801c86:	74 1b                	je     801ca3 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801c88:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801c8b:	75 cf                	jne    801c5c <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801c8d:	8b 42 58             	mov    0x58(%edx),%eax
+  801c90:	6a 01                	push   $0x1
+  801c92:	50                   	push   %eax
+  801c93:	53                   	push   %ebx
+  801c94:	68 73 2b 80 00       	push   $0x802b73
+  801c99:	e8 6e e6 ff ff       	call   80030c <cprintf>
+  801c9e:	83 c4 10             	add    $0x10,%esp
+  801ca1:	eb b9                	jmp    801c5c <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801ca3:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801ca6:	0f 94 c0             	sete   %al
+  801ca9:	0f b6 c0             	movzbl %al,%eax
+}
+  801cac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801caf:	5b                   	pop    %ebx
+  801cb0:	5e                   	pop    %esi
+  801cb1:	5f                   	pop    %edi
+  801cb2:	5d                   	pop    %ebp
+  801cb3:	c3                   	ret
+
+00801cb4 <devpipe_write>:
+{
+  801cb4:	55                   	push   %ebp
+  801cb5:	89 e5                	mov    %esp,%ebp
+  801cb7:	57                   	push   %edi
+  801cb8:	56                   	push   %esi
+  801cb9:	53                   	push   %ebx
+  801cba:	83 ec 28             	sub    $0x28,%esp
+  801cbd:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801cc0:	56                   	push   %esi
+  801cc1:	e8 ce f2 ff ff       	call   800f94 <fd2data>
+  801cc6:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801cc8:	83 c4 10             	add    $0x10,%esp
+  801ccb:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cd0:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801cd3:	75 09                	jne    801cde <devpipe_write+0x2a>
+	return i;
+  801cd5:	89 f8                	mov    %edi,%eax
+  801cd7:	eb 23                	jmp    801cfc <devpipe_write+0x48>
+			sys_yield();
+  801cd9:	e8 b4 ef ff ff       	call   800c92 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801cde:	8b 43 04             	mov    0x4(%ebx),%eax
+  801ce1:	8b 0b                	mov    (%ebx),%ecx
+  801ce3:	8d 51 20             	lea    0x20(%ecx),%edx
+  801ce6:	39 d0                	cmp    %edx,%eax
+  801ce8:	72 1a                	jb     801d04 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  801cea:	89 da                	mov    %ebx,%edx
+  801cec:	89 f0                	mov    %esi,%eax
+  801cee:	e8 5c ff ff ff       	call   801c4f <_pipeisclosed>
+  801cf3:	85 c0                	test   %eax,%eax
+  801cf5:	74 e2                	je     801cd9 <devpipe_write+0x25>
+				return 0;
+  801cf7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801cfc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cff:	5b                   	pop    %ebx
+  801d00:	5e                   	pop    %esi
+  801d01:	5f                   	pop    %edi
+  801d02:	5d                   	pop    %ebp
+  801d03:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801d04:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d07:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801d0b:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801d0e:	89 c2                	mov    %eax,%edx
+  801d10:	c1 fa 1f             	sar    $0x1f,%edx
+  801d13:	89 d1                	mov    %edx,%ecx
+  801d15:	c1 e9 1b             	shr    $0x1b,%ecx
+  801d18:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801d1b:	83 e2 1f             	and    $0x1f,%edx
+  801d1e:	29 ca                	sub    %ecx,%edx
+  801d20:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801d24:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  801d28:	83 c0 01             	add    $0x1,%eax
+  801d2b:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  801d2e:	83 c7 01             	add    $0x1,%edi
+  801d31:	eb 9d                	jmp    801cd0 <devpipe_write+0x1c>
+
+00801d33 <devpipe_read>:
+{
+  801d33:	55                   	push   %ebp
+  801d34:	89 e5                	mov    %esp,%ebp
+  801d36:	57                   	push   %edi
+  801d37:	56                   	push   %esi
+  801d38:	53                   	push   %ebx
+  801d39:	83 ec 18             	sub    $0x18,%esp
+  801d3c:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  801d3f:	57                   	push   %edi
+  801d40:	e8 4f f2 ff ff       	call   800f94 <fd2data>
+  801d45:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801d47:	83 c4 10             	add    $0x10,%esp
+  801d4a:	be 00 00 00 00       	mov    $0x0,%esi
+  801d4f:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801d52:	75 13                	jne    801d67 <devpipe_read+0x34>
+	return i;
+  801d54:	89 f0                	mov    %esi,%eax
+  801d56:	eb 02                	jmp    801d5a <devpipe_read+0x27>
+				return i;
+  801d58:	89 f0                	mov    %esi,%eax
+}
+  801d5a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d5d:	5b                   	pop    %ebx
+  801d5e:	5e                   	pop    %esi
+  801d5f:	5f                   	pop    %edi
+  801d60:	5d                   	pop    %ebp
+  801d61:	c3                   	ret
+			sys_yield();
+  801d62:	e8 2b ef ff ff       	call   800c92 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  801d67:	8b 03                	mov    (%ebx),%eax
+  801d69:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801d6c:	75 18                	jne    801d86 <devpipe_read+0x53>
+			if (i > 0)
+  801d6e:	85 f6                	test   %esi,%esi
+  801d70:	75 e6                	jne    801d58 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  801d72:	89 da                	mov    %ebx,%edx
+  801d74:	89 f8                	mov    %edi,%eax
+  801d76:	e8 d4 fe ff ff       	call   801c4f <_pipeisclosed>
+  801d7b:	85 c0                	test   %eax,%eax
+  801d7d:	74 e3                	je     801d62 <devpipe_read+0x2f>
+				return 0;
+  801d7f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d84:	eb d4                	jmp    801d5a <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801d86:	99                   	cltd
+  801d87:	c1 ea 1b             	shr    $0x1b,%edx
+  801d8a:	01 d0                	add    %edx,%eax
+  801d8c:	83 e0 1f             	and    $0x1f,%eax
+  801d8f:	29 d0                	sub    %edx,%eax
+  801d91:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801d96:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d99:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  801d9c:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  801d9f:	83 c6 01             	add    $0x1,%esi
+  801da2:	eb ab                	jmp    801d4f <devpipe_read+0x1c>
+
+00801da4 <pipe>:
+{
+  801da4:	55                   	push   %ebp
+  801da5:	89 e5                	mov    %esp,%ebp
+  801da7:	56                   	push   %esi
+  801da8:	53                   	push   %ebx
+  801da9:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801dac:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801daf:	50                   	push   %eax
+  801db0:	e8 f6 f1 ff ff       	call   800fab <fd_alloc>
+  801db5:	89 c3                	mov    %eax,%ebx
+  801db7:	83 c4 10             	add    $0x10,%esp
+  801dba:	85 c0                	test   %eax,%eax
+  801dbc:	0f 88 23 01 00 00    	js     801ee5 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801dc2:	83 ec 04             	sub    $0x4,%esp
+  801dc5:	68 07 04 00 00       	push   $0x407
+  801dca:	ff 75 f4             	push   -0xc(%ebp)
+  801dcd:	6a 00                	push   $0x0
+  801dcf:	e8 dd ee ff ff       	call   800cb1 <sys_page_alloc>
+  801dd4:	89 c3                	mov    %eax,%ebx
+  801dd6:	83 c4 10             	add    $0x10,%esp
+  801dd9:	85 c0                	test   %eax,%eax
+  801ddb:	0f 88 04 01 00 00    	js     801ee5 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801de1:	83 ec 0c             	sub    $0xc,%esp
+  801de4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801de7:	50                   	push   %eax
+  801de8:	e8 be f1 ff ff       	call   800fab <fd_alloc>
+  801ded:	89 c3                	mov    %eax,%ebx
+  801def:	83 c4 10             	add    $0x10,%esp
+  801df2:	85 c0                	test   %eax,%eax
+  801df4:	0f 88 db 00 00 00    	js     801ed5 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801dfa:	83 ec 04             	sub    $0x4,%esp
+  801dfd:	68 07 04 00 00       	push   $0x407
+  801e02:	ff 75 f0             	push   -0x10(%ebp)
+  801e05:	6a 00                	push   $0x0
+  801e07:	e8 a5 ee ff ff       	call   800cb1 <sys_page_alloc>
+  801e0c:	89 c3                	mov    %eax,%ebx
+  801e0e:	83 c4 10             	add    $0x10,%esp
+  801e11:	85 c0                	test   %eax,%eax
+  801e13:	0f 88 bc 00 00 00    	js     801ed5 <pipe+0x131>
+	va = fd2data(fd0);
+  801e19:	83 ec 0c             	sub    $0xc,%esp
+  801e1c:	ff 75 f4             	push   -0xc(%ebp)
+  801e1f:	e8 70 f1 ff ff       	call   800f94 <fd2data>
+  801e24:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801e26:	83 c4 0c             	add    $0xc,%esp
+  801e29:	68 07 04 00 00       	push   $0x407
+  801e2e:	50                   	push   %eax
+  801e2f:	6a 00                	push   $0x0
+  801e31:	e8 7b ee ff ff       	call   800cb1 <sys_page_alloc>
+  801e36:	89 c3                	mov    %eax,%ebx
+  801e38:	83 c4 10             	add    $0x10,%esp
+  801e3b:	85 c0                	test   %eax,%eax
+  801e3d:	0f 88 82 00 00 00    	js     801ec5 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801e43:	83 ec 0c             	sub    $0xc,%esp
+  801e46:	ff 75 f0             	push   -0x10(%ebp)
+  801e49:	e8 46 f1 ff ff       	call   800f94 <fd2data>
+  801e4e:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801e55:	50                   	push   %eax
+  801e56:	6a 00                	push   $0x0
+  801e58:	56                   	push   %esi
+  801e59:	6a 00                	push   $0x0
+  801e5b:	e8 94 ee ff ff       	call   800cf4 <sys_page_map>
+  801e60:	89 c3                	mov    %eax,%ebx
+  801e62:	83 c4 20             	add    $0x20,%esp
+  801e65:	85 c0                	test   %eax,%eax
+  801e67:	78 4e                	js     801eb7 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  801e69:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  801e6e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801e71:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  801e73:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801e76:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  801e7d:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801e80:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  801e82:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801e85:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  801e8c:	83 ec 0c             	sub    $0xc,%esp
+  801e8f:	ff 75 f4             	push   -0xc(%ebp)
+  801e92:	e8 ed f0 ff ff       	call   800f84 <fd2num>
+  801e97:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801e9a:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  801e9c:	83 c4 04             	add    $0x4,%esp
+  801e9f:	ff 75 f0             	push   -0x10(%ebp)
+  801ea2:	e8 dd f0 ff ff       	call   800f84 <fd2num>
+  801ea7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801eaa:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  801ead:	83 c4 10             	add    $0x10,%esp
+  801eb0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801eb5:	eb 2e                	jmp    801ee5 <pipe+0x141>
+	sys_page_unmap(0, va);
+  801eb7:	83 ec 08             	sub    $0x8,%esp
+  801eba:	56                   	push   %esi
+  801ebb:	6a 00                	push   $0x0
+  801ebd:	e8 74 ee ff ff       	call   800d36 <sys_page_unmap>
+  801ec2:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  801ec5:	83 ec 08             	sub    $0x8,%esp
+  801ec8:	ff 75 f0             	push   -0x10(%ebp)
+  801ecb:	6a 00                	push   $0x0
+  801ecd:	e8 64 ee ff ff       	call   800d36 <sys_page_unmap>
+  801ed2:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  801ed5:	83 ec 08             	sub    $0x8,%esp
+  801ed8:	ff 75 f4             	push   -0xc(%ebp)
+  801edb:	6a 00                	push   $0x0
+  801edd:	e8 54 ee ff ff       	call   800d36 <sys_page_unmap>
+  801ee2:	83 c4 10             	add    $0x10,%esp
+}
+  801ee5:	89 d8                	mov    %ebx,%eax
+  801ee7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801eea:	5b                   	pop    %ebx
+  801eeb:	5e                   	pop    %esi
+  801eec:	5d                   	pop    %ebp
+  801eed:	c3                   	ret
+
+00801eee <pipeisclosed>:
+{
+  801eee:	55                   	push   %ebp
+  801eef:	89 e5                	mov    %esp,%ebp
+  801ef1:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801ef4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ef7:	50                   	push   %eax
+  801ef8:	ff 75 08             	push   0x8(%ebp)
+  801efb:	e8 01 f1 ff ff       	call   801001 <fd_lookup>
+  801f00:	83 c4 10             	add    $0x10,%esp
+  801f03:	85 c0                	test   %eax,%eax
+  801f05:	78 18                	js     801f1f <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  801f07:	83 ec 0c             	sub    $0xc,%esp
+  801f0a:	ff 75 f4             	push   -0xc(%ebp)
+  801f0d:	e8 82 f0 ff ff       	call   800f94 <fd2data>
+  801f12:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  801f14:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f17:	e8 33 fd ff ff       	call   801c4f <_pipeisclosed>
+  801f1c:	83 c4 10             	add    $0x10,%esp
+}
+  801f1f:	c9                   	leave
+  801f20:	c3                   	ret
+
+00801f21 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  801f21:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f26:	c3                   	ret
+
+00801f27 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  801f27:	55                   	push   %ebp
+  801f28:	89 e5                	mov    %esp,%ebp
+  801f2a:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  801f2d:	68 8b 2b 80 00       	push   $0x802b8b
+  801f32:	ff 75 0c             	push   0xc(%ebp)
+  801f35:	e8 8b e9 ff ff       	call   8008c5 <strcpy>
+	return 0;
+}
+  801f3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f3f:	c9                   	leave
+  801f40:	c3                   	ret
+
+00801f41 <devcons_write>:
+{
+  801f41:	55                   	push   %ebp
+  801f42:	89 e5                	mov    %esp,%ebp
+  801f44:	57                   	push   %edi
+  801f45:	56                   	push   %esi
+  801f46:	53                   	push   %ebx
+  801f47:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  801f4d:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  801f52:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  801f58:	eb 2e                	jmp    801f88 <devcons_write+0x47>
+		m = n - tot;
+  801f5a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f5d:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  801f5f:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801f64:	39 c3                	cmp    %eax,%ebx
+  801f66:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  801f69:	83 ec 04             	sub    $0x4,%esp
+  801f6c:	53                   	push   %ebx
+  801f6d:	89 f0                	mov    %esi,%eax
+  801f6f:	03 45 0c             	add    0xc(%ebp),%eax
+  801f72:	50                   	push   %eax
+  801f73:	57                   	push   %edi
+  801f74:	e8 d2 ea ff ff       	call   800a4b <memmove>
+		sys_cputs(buf, m);
+  801f79:	83 c4 08             	add    $0x8,%esp
+  801f7c:	53                   	push   %ebx
+  801f7d:	57                   	push   %edi
+  801f7e:	e8 72 ec ff ff       	call   800bf5 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  801f83:	01 de                	add    %ebx,%esi
+  801f85:	83 c4 10             	add    $0x10,%esp
+  801f88:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801f8b:	72 cd                	jb     801f5a <devcons_write+0x19>
+}
+  801f8d:	89 f0                	mov    %esi,%eax
+  801f8f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f92:	5b                   	pop    %ebx
+  801f93:	5e                   	pop    %esi
+  801f94:	5f                   	pop    %edi
+  801f95:	5d                   	pop    %ebp
+  801f96:	c3                   	ret
+
+00801f97 <devcons_read>:
+{
+  801f97:	55                   	push   %ebp
+  801f98:	89 e5                	mov    %esp,%ebp
+  801f9a:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  801f9d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fa2:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801fa6:	75 07                	jne    801faf <devcons_read+0x18>
+  801fa8:	eb 1f                	jmp    801fc9 <devcons_read+0x32>
+		sys_yield();
+  801faa:	e8 e3 ec ff ff       	call   800c92 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  801faf:	e8 5f ec ff ff       	call   800c13 <sys_cgetc>
+  801fb4:	85 c0                	test   %eax,%eax
+  801fb6:	74 f2                	je     801faa <devcons_read+0x13>
+	if (c < 0)
+  801fb8:	78 0f                	js     801fc9 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  801fba:	83 f8 04             	cmp    $0x4,%eax
+  801fbd:	74 0c                	je     801fcb <devcons_read+0x34>
+	*(char*)vbuf = c;
+  801fbf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801fc2:	88 02                	mov    %al,(%edx)
+	return 1;
+  801fc4:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  801fc9:	c9                   	leave
+  801fca:	c3                   	ret
+		return 0;
+  801fcb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fd0:	eb f7                	jmp    801fc9 <devcons_read+0x32>
+
+00801fd2 <cputchar>:
+{
+  801fd2:	55                   	push   %ebp
+  801fd3:	89 e5                	mov    %esp,%ebp
+  801fd5:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  801fd8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fdb:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  801fde:	6a 01                	push   $0x1
+  801fe0:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801fe3:	50                   	push   %eax
+  801fe4:	e8 0c ec ff ff       	call   800bf5 <sys_cputs>
+}
+  801fe9:	83 c4 10             	add    $0x10,%esp
+  801fec:	c9                   	leave
+  801fed:	c3                   	ret
+
+00801fee <getchar>:
+{
+  801fee:	55                   	push   %ebp
+  801fef:	89 e5                	mov    %esp,%ebp
+  801ff1:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  801ff4:	6a 01                	push   $0x1
+  801ff6:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801ff9:	50                   	push   %eax
+  801ffa:	6a 00                	push   $0x0
+  801ffc:	e8 66 f2 ff ff       	call   801267 <read>
+	if (r < 0)
+  802001:	83 c4 10             	add    $0x10,%esp
+  802004:	85 c0                	test   %eax,%eax
+  802006:	78 06                	js     80200e <getchar+0x20>
+	if (r < 1)
+  802008:	74 06                	je     802010 <getchar+0x22>
+	return c;
+  80200a:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80200e:	c9                   	leave
+  80200f:	c3                   	ret
+		return -E_EOF;
+  802010:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802015:	eb f7                	jmp    80200e <getchar+0x20>
+
+00802017 <iscons>:
+{
+  802017:	55                   	push   %ebp
+  802018:	89 e5                	mov    %esp,%ebp
+  80201a:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80201d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802020:	50                   	push   %eax
+  802021:	ff 75 08             	push   0x8(%ebp)
+  802024:	e8 d8 ef ff ff       	call   801001 <fd_lookup>
+  802029:	83 c4 10             	add    $0x10,%esp
+  80202c:	85 c0                	test   %eax,%eax
+  80202e:	78 11                	js     802041 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802030:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802033:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  802039:	39 10                	cmp    %edx,(%eax)
+  80203b:	0f 94 c0             	sete   %al
+  80203e:	0f b6 c0             	movzbl %al,%eax
+}
+  802041:	c9                   	leave
+  802042:	c3                   	ret
+
+00802043 <opencons>:
+{
+  802043:	55                   	push   %ebp
+  802044:	89 e5                	mov    %esp,%ebp
+  802046:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802049:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80204c:	50                   	push   %eax
+  80204d:	e8 59 ef ff ff       	call   800fab <fd_alloc>
+  802052:	83 c4 10             	add    $0x10,%esp
+  802055:	85 c0                	test   %eax,%eax
+  802057:	78 3a                	js     802093 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802059:	83 ec 04             	sub    $0x4,%esp
+  80205c:	68 07 04 00 00       	push   $0x407
+  802061:	ff 75 f4             	push   -0xc(%ebp)
+  802064:	6a 00                	push   $0x0
+  802066:	e8 46 ec ff ff       	call   800cb1 <sys_page_alloc>
+  80206b:	83 c4 10             	add    $0x10,%esp
+  80206e:	85 c0                	test   %eax,%eax
+  802070:	78 21                	js     802093 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802072:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802075:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  80207b:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80207d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802080:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802087:	83 ec 0c             	sub    $0xc,%esp
+  80208a:	50                   	push   %eax
+  80208b:	e8 f4 ee ff ff       	call   800f84 <fd2num>
+  802090:	83 c4 10             	add    $0x10,%esp
+}
+  802093:	c9                   	leave
+  802094:	c3                   	ret
+
+00802095 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  802095:	55                   	push   %ebp
+  802096:	89 e5                	mov    %esp,%ebp
+  802098:	56                   	push   %esi
+  802099:	53                   	push   %ebx
+  80209a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80209d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020a0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  8020a3:	85 c0                	test   %eax,%eax
+  8020a5:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8020aa:	0f 44 c2             	cmove  %edx,%eax
+  8020ad:	83 ec 0c             	sub    $0xc,%esp
+  8020b0:	50                   	push   %eax
+  8020b1:	e8 ab ed ff ff       	call   800e61 <sys_ipc_recv>
+
+  if (from_env_store)
+  8020b6:	83 c4 10             	add    $0x10,%esp
+  8020b9:	85 f6                	test   %esi,%esi
+  8020bb:	74 17                	je     8020d4 <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  8020bd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020c2:	85 c0                	test   %eax,%eax
+  8020c4:	75 0c                	jne    8020d2 <ipc_recv+0x3d>
+  8020c6:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  8020cc:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  8020d2:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  8020d4:	85 db                	test   %ebx,%ebx
+  8020d6:	74 2b                	je     802103 <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  8020d8:	85 c0                	test   %eax,%eax
+  8020da:	74 0d                	je     8020e9 <ipc_recv+0x54>
+  8020dc:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  8020e2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020e5:	5b                   	pop    %ebx
+  8020e6:	5e                   	pop    %esi
+  8020e7:	5d                   	pop    %ebp
+  8020e8:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  8020e9:	a1 08 40 80 00       	mov    0x804008,%eax
+  8020ee:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8020f4:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  8020f6:	a1 08 40 80 00       	mov    0x804008,%eax
+  8020fb:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  802101:	eb df                	jmp    8020e2 <ipc_recv+0x4d>
+  802103:	85 c0                	test   %eax,%eax
+  802105:	75 db                	jne    8020e2 <ipc_recv+0x4d>
+  802107:	eb ed                	jmp    8020f6 <ipc_recv+0x61>
+
+00802109 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  802109:	55                   	push   %ebp
+  80210a:	89 e5                	mov    %esp,%ebp
+  80210c:	57                   	push   %edi
+  80210d:	56                   	push   %esi
+  80210e:	53                   	push   %ebx
+  80210f:	83 ec 0c             	sub    $0xc,%esp
+  802112:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802115:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802118:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  80211b:	85 db                	test   %ebx,%ebx
+  80211d:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802122:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  802125:	ff 75 14             	push   0x14(%ebp)
+  802128:	53                   	push   %ebx
+  802129:	56                   	push   %esi
+  80212a:	57                   	push   %edi
+  80212b:	e8 0e ed ff ff       	call   800e3e <sys_ipc_try_send>
+  802130:	83 c4 10             	add    $0x10,%esp
+  802133:	85 c0                	test   %eax,%eax
+  802135:	74 1e                	je     802155 <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  802137:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80213a:	75 07                	jne    802143 <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  80213c:	e8 51 eb ff ff       	call   800c92 <sys_yield>
+  802141:	eb e2                	jmp    802125 <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  802143:	50                   	push   %eax
+  802144:	68 97 2b 80 00       	push   $0x802b97
+  802149:	6a 3c                	push   $0x3c
+  80214b:	68 a4 2b 80 00       	push   $0x802ba4
+  802150:	e8 dc e0 ff ff       	call   800231 <_panic>
+  }
+
+#endif
+}
+  802155:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802158:	5b                   	pop    %ebx
+  802159:	5e                   	pop    %esi
+  80215a:	5f                   	pop    %edi
+  80215b:	5d                   	pop    %ebp
+  80215c:	c3                   	ret
+
+0080215d <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  80215d:	55                   	push   %ebp
+  80215e:	89 e5                	mov    %esp,%ebp
+  802160:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  802163:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  802168:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80216b:	c1 e0 04             	shl    $0x4,%eax
+  80216e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802173:	8b 40 50             	mov    0x50(%eax),%eax
+  802176:	39 c8                	cmp    %ecx,%eax
+  802178:	74 12                	je     80218c <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  80217a:	83 c2 01             	add    $0x1,%edx
+  80217d:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802183:	75 e3                	jne    802168 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802185:	b8 00 00 00 00       	mov    $0x0,%eax
+  80218a:	eb 0e                	jmp    80219a <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  80218c:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80218f:	c1 e0 04             	shl    $0x4,%eax
+  802192:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802197:	8b 40 48             	mov    0x48(%eax),%eax
+  80219a:	5d                   	pop    %ebp
+  80219b:	c3                   	ret
+
+0080219c <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80219c:	55                   	push   %ebp
+  80219d:	89 e5                	mov    %esp,%ebp
+  80219f:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8021a2:	89 c2                	mov    %eax,%edx
+  8021a4:	c1 ea 16             	shr    $0x16,%edx
+  8021a7:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8021ae:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8021b3:	f6 c1 01             	test   $0x1,%cl
+  8021b6:	74 1c                	je     8021d4 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  8021b8:	c1 e8 0c             	shr    $0xc,%eax
+  8021bb:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8021c2:	a8 01                	test   $0x1,%al
+  8021c4:	74 0e                	je     8021d4 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8021c6:	c1 e8 0c             	shr    $0xc,%eax
+  8021c9:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  8021d0:	ef 
+  8021d1:	0f b7 d2             	movzwl %dx,%edx
+}
+  8021d4:	89 d0                	mov    %edx,%eax
+  8021d6:	5d                   	pop    %ebp
+  8021d7:	c3                   	ret
+  8021d8:	66 90                	xchg   %ax,%ax
+  8021da:	66 90                	xchg   %ax,%ax
+  8021dc:	66 90                	xchg   %ax,%ax
+  8021de:	66 90                	xchg   %ax,%ax
+
+008021e0 <__udivmoddi4>:
+  8021e0:	55                   	push   %ebp
+  8021e1:	57                   	push   %edi
+  8021e2:	56                   	push   %esi
+  8021e3:	53                   	push   %ebx
+  8021e4:	83 ec 24             	sub    $0x24,%esp
+  8021e7:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8021eb:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8021ef:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  8021f3:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8021f7:	8b 54 24 44          	mov    0x44(%esp),%edx
+  8021fb:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8021ff:	8b 44 24 40          	mov    0x40(%esp),%eax
+  802203:	89 d3                	mov    %edx,%ebx
+  802205:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802209:	09 c3                	or     %eax,%ebx
+  80220b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80220f:	0f 84 9c 00 00 00    	je     8022b1 <__udivmoddi4+0xd1>
+  802215:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80221c:	00 
+  80221d:	31 c0                	xor    %eax,%eax
+  80221f:	31 d2                	xor    %edx,%edx
+  802221:	89 fb                	mov    %edi,%ebx
+  802223:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80222a:	00 
+  80222b:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802230:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802234:	01 c0                	add    %eax,%eax
+  802236:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80223d:	00 
+  80223e:	89 c6                	mov    %eax,%esi
+  802240:	89 d7                	mov    %edx,%edi
+  802242:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802246:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80224a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80224d:	d3 ea                	shr    %cl,%edx
+  80224f:	f6 c1 20             	test   $0x20,%cl
+  802252:	0f 45 c2             	cmovne %edx,%eax
+  802255:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802259:	83 e0 01             	and    $0x1,%eax
+  80225c:	09 fa                	or     %edi,%edx
+  80225e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802262:	89 04 24             	mov    %eax,(%esp)
+  802265:	8b 04 24             	mov    (%esp),%eax
+  802268:	89 d5                	mov    %edx,%ebp
+  80226a:	09 f0                	or     %esi,%eax
+  80226c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802270:	39 f0                	cmp    %esi,%eax
+  802272:	19 fd                	sbb    %edi,%ebp
+  802274:	72 1d                	jb     802293 <__udivmoddi4+0xb3>
+  802276:	29 f0                	sub    %esi,%eax
+  802278:	19 fa                	sbb    %edi,%edx
+  80227a:	89 cf                	mov    %ecx,%edi
+  80227c:	c1 ef 05             	shr    $0x5,%edi
+  80227f:	83 e7 01             	and    $0x1,%edi
+  802282:	89 fe                	mov    %edi,%esi
+  802284:	d3 e7                	shl    %cl,%edi
+  802286:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80228a:	83 f6 01             	xor    $0x1,%esi
+  80228d:	d3 e6                	shl    %cl,%esi
+  80228f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802293:	83 e9 01             	sub    $0x1,%ecx
+  802296:	73 98                	jae    802230 <__udivmoddi4+0x50>
+  802298:	85 db                	test   %ebx,%ebx
+  80229a:	74 05                	je     8022a1 <__udivmoddi4+0xc1>
+  80229c:	89 03                	mov    %eax,(%ebx)
+  80229e:	89 53 04             	mov    %edx,0x4(%ebx)
+  8022a1:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8022a5:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8022a9:	83 c4 24             	add    $0x24,%esp
+  8022ac:	5b                   	pop    %ebx
+  8022ad:	5e                   	pop    %esi
+  8022ae:	5f                   	pop    %edi
+  8022af:	5d                   	pop    %ebp
+  8022b0:	c3                   	ret
+  8022b1:	85 ff                	test   %edi,%edi
+  8022b3:	74 0d                	je     8022c2 <__udivmoddi4+0xe2>
+  8022b5:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  8022bb:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  8022c2:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8022c6:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8022ca:	89 44 24 18          	mov    %eax,0x18(%esp)
+  8022ce:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8022d2:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  8022d6:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8022da:	83 c4 24             	add    $0x24,%esp
+  8022dd:	5b                   	pop    %ebx
+  8022de:	5e                   	pop    %esi
+  8022df:	5f                   	pop    %edi
+  8022e0:	5d                   	pop    %ebp
+  8022e1:	c3                   	ret
+  8022e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8022e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+008022f0 <__udivdi3>:
+  8022f0:	57                   	push   %edi
+  8022f1:	56                   	push   %esi
+  8022f2:	53                   	push   %ebx
+  8022f3:	83 ec 20             	sub    $0x20,%esp
+  8022f6:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8022fa:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8022fe:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802302:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802306:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80230a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80230e:	89 d1                	mov    %edx,%ecx
+  802310:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802314:	09 c1                	or     %eax,%ecx
+  802316:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80231a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80231e:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802322:	0f 84 88 00 00 00    	je     8023b0 <__udivdi3+0xc0>
+  802328:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80232f:	00 
+  802330:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802335:	31 c0                	xor    %eax,%eax
+  802337:	31 d2                	xor    %edx,%edx
+  802339:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802340:	00 
+  802341:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802348:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80234c:	01 c0                	add    %eax,%eax
+  80234e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802355:	00 
+  802356:	89 c6                	mov    %eax,%esi
+  802358:	89 d7                	mov    %edx,%edi
+  80235a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80235e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802362:	0f ad d0             	shrd   %cl,%edx,%eax
+  802365:	d3 ea                	shr    %cl,%edx
+  802367:	f6 c1 20             	test   $0x20,%cl
+  80236a:	0f 45 c2             	cmovne %edx,%eax
+  80236d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802371:	83 e0 01             	and    $0x1,%eax
+  802374:	09 fa                	or     %edi,%edx
+  802376:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80237a:	89 04 24             	mov    %eax,(%esp)
+  80237d:	8b 04 24             	mov    (%esp),%eax
+  802380:	89 d3                	mov    %edx,%ebx
+  802382:	09 f0                	or     %esi,%eax
+  802384:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802388:	39 f0                	cmp    %esi,%eax
+  80238a:	19 fb                	sbb    %edi,%ebx
+  80238c:	72 1d                	jb     8023ab <__udivdi3+0xbb>
+  80238e:	29 f0                	sub    %esi,%eax
+  802390:	19 fa                	sbb    %edi,%edx
+  802392:	89 cf                	mov    %ecx,%edi
+  802394:	c1 ef 05             	shr    $0x5,%edi
+  802397:	83 e7 01             	and    $0x1,%edi
+  80239a:	89 fe                	mov    %edi,%esi
+  80239c:	d3 e7                	shl    %cl,%edi
+  80239e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8023a2:	83 f6 01             	xor    $0x1,%esi
+  8023a5:	d3 e6                	shl    %cl,%esi
+  8023a7:	09 74 24 18          	or     %esi,0x18(%esp)
+  8023ab:	83 e9 01             	sub    $0x1,%ecx
+  8023ae:	73 98                	jae    802348 <__udivdi3+0x58>
+  8023b0:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8023b4:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8023b8:	83 c4 20             	add    $0x20,%esp
+  8023bb:	5b                   	pop    %ebx
+  8023bc:	5e                   	pop    %esi
+  8023bd:	5f                   	pop    %edi
+  8023be:	c3                   	ret
+  8023bf:	90                   	nop
+
+008023c0 <__umoddi3>:
+  8023c0:	57                   	push   %edi
+  8023c1:	56                   	push   %esi
+  8023c2:	53                   	push   %ebx
+  8023c3:	83 ec 18             	sub    $0x18,%esp
+  8023c6:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8023ca:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8023ce:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8023d2:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8023d6:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8023da:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8023de:	89 d1                	mov    %edx,%ecx
+  8023e0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8023e4:	09 c1                	or     %eax,%ecx
+  8023e6:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8023ea:	74 5b                	je     802447 <__umoddi3+0x87>
+  8023ec:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8023f1:	31 c0                	xor    %eax,%eax
+  8023f3:	31 d2                	xor    %edx,%edx
+  8023f5:	8d 76 00             	lea    0x0(%esi),%esi
+  8023f8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8023fc:	01 c0                	add    %eax,%eax
+  8023fe:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802405:	00 
+  802406:	89 c6                	mov    %eax,%esi
+  802408:	89 d7                	mov    %edx,%edi
+  80240a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80240e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802412:	0f ad d0             	shrd   %cl,%edx,%eax
+  802415:	d3 ea                	shr    %cl,%edx
+  802417:	f6 c1 20             	test   $0x20,%cl
+  80241a:	0f 45 c2             	cmovne %edx,%eax
+  80241d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802421:	83 e0 01             	and    $0x1,%eax
+  802424:	09 fa                	or     %edi,%edx
+  802426:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80242a:	89 04 24             	mov    %eax,(%esp)
+  80242d:	8b 04 24             	mov    (%esp),%eax
+  802430:	89 d3                	mov    %edx,%ebx
+  802432:	09 f0                	or     %esi,%eax
+  802434:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802438:	39 f0                	cmp    %esi,%eax
+  80243a:	19 fb                	sbb    %edi,%ebx
+  80243c:	72 04                	jb     802442 <__umoddi3+0x82>
+  80243e:	29 f0                	sub    %esi,%eax
+  802440:	19 fa                	sbb    %edi,%edx
+  802442:	83 e9 01             	sub    $0x1,%ecx
+  802445:	73 b1                	jae    8023f8 <__umoddi3+0x38>
+  802447:	83 c4 18             	add    $0x18,%esp
+  80244a:	5b                   	pop    %ebx
+  80244b:	5e                   	pop    %esi
+  80244c:	5f                   	pop    %edi
+  80244d:	c3                   	ret
+  80244e:	66 90                	xchg   %ax,%ax
+
+00802450 <__divdi3>:
+  802450:	55                   	push   %ebp
+  802451:	57                   	push   %edi
+  802452:	56                   	push   %esi
+  802453:	53                   	push   %ebx
+  802454:	83 ec 24             	sub    $0x24,%esp
+  802457:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  80245b:	8b 74 24 44          	mov    0x44(%esp),%esi
+  80245f:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802463:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802467:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  80246b:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  80246f:	85 d2                	test   %edx,%edx
+  802471:	0f 88 e0 00 00 00    	js     802557 <__divdi3+0x107>
+  802477:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  80247b:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  80247f:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802483:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802487:	85 f6                	test   %esi,%esi
+  802489:	78 16                	js     8024a1 <__divdi3+0x51>
+  80248b:	89 f1                	mov    %esi,%ecx
+  80248d:	31 c0                	xor    %eax,%eax
+  80248f:	31 d2                	xor    %edx,%edx
+  802491:	09 d9                	or     %ebx,%ecx
+  802493:	0f 85 f3 00 00 00    	jne    80258c <__divdi3+0x13c>
+  802499:	83 c4 24             	add    $0x24,%esp
+  80249c:	5b                   	pop    %ebx
+  80249d:	5e                   	pop    %esi
+  80249e:	5f                   	pop    %edi
+  80249f:	5d                   	pop    %ebp
+  8024a0:	c3                   	ret
+  8024a1:	bf 01 00 00 00       	mov    $0x1,%edi
+  8024a6:	f7 5c 24 08          	negl   0x8(%esp)
+  8024aa:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  8024af:	f7 5c 24 0c          	negl   0xc(%esp)
+  8024b3:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8024ba:	00 
+  8024bb:	31 c0                	xor    %eax,%eax
+  8024bd:	31 d2                	xor    %edx,%edx
+  8024bf:	89 fb                	mov    %edi,%ebx
+  8024c1:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8024c8:	00 
+  8024c9:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8024ce:	66 90                	xchg   %ax,%ax
+  8024d0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8024d4:	01 c0                	add    %eax,%eax
+  8024d6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8024dd:	00 
+  8024de:	89 c6                	mov    %eax,%esi
+  8024e0:	89 d7                	mov    %edx,%edi
+  8024e2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8024e6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8024ea:	0f ad d0             	shrd   %cl,%edx,%eax
+  8024ed:	d3 ea                	shr    %cl,%edx
+  8024ef:	f6 c1 20             	test   $0x20,%cl
+  8024f2:	0f 45 c2             	cmovne %edx,%eax
+  8024f5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8024f9:	83 e0 01             	and    $0x1,%eax
+  8024fc:	09 fa                	or     %edi,%edx
+  8024fe:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802502:	89 04 24             	mov    %eax,(%esp)
+  802505:	8b 04 24             	mov    (%esp),%eax
+  802508:	89 d5                	mov    %edx,%ebp
+  80250a:	09 f0                	or     %esi,%eax
+  80250c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802510:	39 f0                	cmp    %esi,%eax
+  802512:	19 fd                	sbb    %edi,%ebp
+  802514:	72 1d                	jb     802533 <__divdi3+0xe3>
+  802516:	29 f0                	sub    %esi,%eax
+  802518:	19 fa                	sbb    %edi,%edx
+  80251a:	89 cf                	mov    %ecx,%edi
+  80251c:	c1 ef 05             	shr    $0x5,%edi
+  80251f:	83 e7 01             	and    $0x1,%edi
+  802522:	89 fe                	mov    %edi,%esi
+  802524:	d3 e7                	shl    %cl,%edi
+  802526:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80252a:	83 f6 01             	xor    $0x1,%esi
+  80252d:	d3 e6                	shl    %cl,%esi
+  80252f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802533:	83 e9 01             	sub    $0x1,%ecx
+  802536:	73 98                	jae    8024d0 <__divdi3+0x80>
+  802538:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80253c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802540:	85 db                	test   %ebx,%ebx
+  802542:	0f 84 51 ff ff ff    	je     802499 <__divdi3+0x49>
+  802548:	f7 d8                	neg    %eax
+  80254a:	83 d2 00             	adc    $0x0,%edx
+  80254d:	83 c4 24             	add    $0x24,%esp
+  802550:	5b                   	pop    %ebx
+  802551:	f7 da                	neg    %edx
+  802553:	5e                   	pop    %esi
+  802554:	5f                   	pop    %edi
+  802555:	5d                   	pop    %ebp
+  802556:	c3                   	ret
+  802557:	f7 d8                	neg    %eax
+  802559:	83 d2 00             	adc    $0x0,%edx
+  80255c:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802560:	f7 da                	neg    %edx
+  802562:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802566:	85 f6                	test   %esi,%esi
+  802568:	78 1b                	js     802585 <__divdi3+0x135>
+  80256a:	89 f1                	mov    %esi,%ecx
+  80256c:	31 c0                	xor    %eax,%eax
+  80256e:	31 d2                	xor    %edx,%edx
+  802570:	bf 01 00 00 00       	mov    $0x1,%edi
+  802575:	09 d9                	or     %ebx,%ecx
+  802577:	0f 85 36 ff ff ff    	jne    8024b3 <__divdi3+0x63>
+  80257d:	83 c4 24             	add    $0x24,%esp
+  802580:	5b                   	pop    %ebx
+  802581:	5e                   	pop    %esi
+  802582:	5f                   	pop    %edi
+  802583:	5d                   	pop    %ebp
+  802584:	c3                   	ret
+  802585:	31 ff                	xor    %edi,%edi
+  802587:	e9 1a ff ff ff       	jmp    8024a6 <__divdi3+0x56>
+  80258c:	31 ff                	xor    %edi,%edi
+  80258e:	e9 20 ff ff ff       	jmp    8024b3 <__divdi3+0x63>
+  802593:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80259a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+008025a0 <__moddi3>:
+  8025a0:	55                   	push   %ebp
+  8025a1:	57                   	push   %edi
+  8025a2:	56                   	push   %esi
+  8025a3:	53                   	push   %ebx
+  8025a4:	83 ec 1c             	sub    $0x1c,%esp
+  8025a7:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  8025ab:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  8025af:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  8025b3:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  8025b7:	89 c8                	mov    %ecx,%eax
+  8025b9:	89 f2                	mov    %esi,%edx
+  8025bb:	89 f3                	mov    %esi,%ebx
+  8025bd:	85 ed                	test   %ebp,%ebp
+  8025bf:	0f 88 9d 00 00 00    	js     802662 <__moddi3+0xc2>
+  8025c5:	09 cb                	or     %ecx,%ebx
+  8025c7:	0f 84 8d 00 00 00    	je     80265a <__moddi3+0xba>
+  8025cd:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  8025d1:	31 db                	xor    %ebx,%ebx
+  8025d3:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  8025d7:	89 ca                	mov    %ecx,%edx
+  8025d9:	89 f0                	mov    %esi,%eax
+  8025db:	89 dd                	mov    %ebx,%ebp
+  8025dd:	f7 da                	neg    %edx
+  8025df:	83 d0 00             	adc    $0x0,%eax
+  8025e2:	f7 d8                	neg    %eax
+  8025e4:	0f 49 f0             	cmovns %eax,%esi
+  8025e7:	0f 49 ca             	cmovns %edx,%ecx
+  8025ea:	31 c0                	xor    %eax,%eax
+  8025ec:	31 d2                	xor    %edx,%edx
+  8025ee:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8025f2:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  8025f6:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8025fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  8025ff:	90                   	nop
+  802600:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802604:	01 c0                	add    %eax,%eax
+  802606:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80260d:	00 
+  80260e:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  802612:	89 c6                	mov    %eax,%esi
+  802614:	89 d7                	mov    %edx,%edi
+  802616:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80261a:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80261e:	0f ad d0             	shrd   %cl,%edx,%eax
+  802621:	d3 ea                	shr    %cl,%edx
+  802623:	f6 c1 20             	test   $0x20,%cl
+  802626:	0f 45 c2             	cmovne %edx,%eax
+  802629:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80262d:	83 e0 01             	and    $0x1,%eax
+  802630:	09 fa                	or     %edi,%edx
+  802632:	89 04 24             	mov    %eax,(%esp)
+  802635:	8b 04 24             	mov    (%esp),%eax
+  802638:	89 d7                	mov    %edx,%edi
+  80263a:	09 f0                	or     %esi,%eax
+  80263c:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  802640:	39 d8                	cmp    %ebx,%eax
+  802642:	19 f7                	sbb    %esi,%edi
+  802644:	72 04                	jb     80264a <__moddi3+0xaa>
+  802646:	29 d8                	sub    %ebx,%eax
+  802648:	19 f2                	sbb    %esi,%edx
+  80264a:	83 e9 01             	sub    $0x1,%ecx
+  80264d:	73 b1                	jae    802600 <__moddi3+0x60>
+  80264f:	85 ed                	test   %ebp,%ebp
+  802651:	74 07                	je     80265a <__moddi3+0xba>
+  802653:	f7 d8                	neg    %eax
+  802655:	83 d2 00             	adc    $0x0,%edx
+  802658:	f7 da                	neg    %edx
+  80265a:	83 c4 1c             	add    $0x1c,%esp
+  80265d:	5b                   	pop    %ebx
+  80265e:	5e                   	pop    %esi
+  80265f:	5f                   	pop    %edi
+  802660:	5d                   	pop    %ebp
+  802661:	c3                   	ret
+  802662:	09 cb                	or     %ecx,%ebx
+  802664:	74 f4                	je     80265a <__moddi3+0xba>
+  802666:	f7 df                	neg    %edi
+  802668:	bb 01 00 00 00       	mov    $0x1,%ebx
+  80266d:	83 d5 00             	adc    $0x0,%ebp
+  802670:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802674:	f7 dd                	neg    %ebp
+  802676:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  80267a:	e9 58 ff ff ff       	jmp    8025d7 <__moddi3+0x37>
@@ -0,0 +1,5331 @@
+
+obj/user/echo.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 b3 00 00 00       	call   8000e4 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 1c             	sub    $0x1c,%esp
+  80003c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80003f:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int i, nflag;
+
+	nflag = 0;
+  800042:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (argc > 1 && strcmp(argv[1], "-n") == 0) {
+  800049:	83 ff 01             	cmp    $0x1,%edi
+  80004c:	7f 07                	jg     800055 <umain+0x22>
+		nflag = 1;
+		argc--;
+		argv++;
+	}
+	for (i = 1; i < argc; i++) {
+  80004e:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800053:	eb 4c                	jmp    8000a1 <umain+0x6e>
+	if (argc > 1 && strcmp(argv[1], "-n") == 0) {
+  800055:	83 ec 08             	sub    $0x8,%esp
+  800058:	68 a0 25 80 00       	push   $0x8025a0
+  80005d:	ff 76 04             	push   0x4(%esi)
+  800060:	e8 ce 01 00 00       	call   800233 <strcmp>
+  800065:	83 c4 10             	add    $0x10,%esp
+	nflag = 0;
+  800068:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (argc > 1 && strcmp(argv[1], "-n") == 0) {
+  80006f:	85 c0                	test   %eax,%eax
+  800071:	75 db                	jne    80004e <umain+0x1b>
+		argc--;
+  800073:	83 ef 01             	sub    $0x1,%edi
+		argv++;
+  800076:	83 c6 04             	add    $0x4,%esi
+		nflag = 1;
+  800079:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+  800080:	eb cc                	jmp    80004e <umain+0x1b>
+		if (i > 1)
+			write(1, " ", 1);
+		write(1, argv[i], strlen(argv[i]));
+  800082:	83 ec 0c             	sub    $0xc,%esp
+  800085:	ff 34 9e             	push   (%esi,%ebx,4)
+  800088:	e8 ba 00 00 00       	call   800147 <strlen>
+  80008d:	83 c4 0c             	add    $0xc,%esp
+  800090:	50                   	push   %eax
+  800091:	ff 34 9e             	push   (%esi,%ebx,4)
+  800094:	6a 01                	push   $0x1
+  800096:	e8 57 0b 00 00       	call   800bf2 <write>
+	for (i = 1; i < argc; i++) {
+  80009b:	83 c3 01             	add    $0x1,%ebx
+  80009e:	83 c4 10             	add    $0x10,%esp
+  8000a1:	39 df                	cmp    %ebx,%edi
+  8000a3:	7e 1b                	jle    8000c0 <umain+0x8d>
+		if (i > 1)
+  8000a5:	83 fb 01             	cmp    $0x1,%ebx
+  8000a8:	7e d8                	jle    800082 <umain+0x4f>
+			write(1, " ", 1);
+  8000aa:	83 ec 04             	sub    $0x4,%esp
+  8000ad:	6a 01                	push   $0x1
+  8000af:	68 a3 25 80 00       	push   $0x8025a3
+  8000b4:	6a 01                	push   $0x1
+  8000b6:	e8 37 0b 00 00       	call   800bf2 <write>
+  8000bb:	83 c4 10             	add    $0x10,%esp
+  8000be:	eb c2                	jmp    800082 <umain+0x4f>
+	}
+	if (!nflag)
+  8000c0:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8000c4:	74 08                	je     8000ce <umain+0x9b>
+		write(1, "\n", 1);
+}
+  8000c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000c9:	5b                   	pop    %ebx
+  8000ca:	5e                   	pop    %esi
+  8000cb:	5f                   	pop    %edi
+  8000cc:	5d                   	pop    %ebp
+  8000cd:	c3                   	ret
+		write(1, "\n", 1);
+  8000ce:	83 ec 04             	sub    $0x4,%esp
+  8000d1:	6a 01                	push   $0x1
+  8000d3:	68 f0 26 80 00       	push   $0x8026f0
+  8000d8:	6a 01                	push   $0x1
+  8000da:	e8 13 0b 00 00       	call   800bf2 <write>
+  8000df:	83 c4 10             	add    $0x10,%esp
+}
+  8000e2:	eb e2                	jmp    8000c6 <umain+0x93>
+
+008000e4 <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  8000e4:	55                   	push   %ebp
+  8000e5:	89 e5                	mov    %esp,%ebp
+  8000e7:	56                   	push   %esi
+  8000e8:	53                   	push   %ebx
+  8000e9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000ec:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  8000ef:	e8 3c 04 00 00       	call   800530 <sys_getenvid>
+  8000f4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000f9:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8000fc:	c1 e0 04             	shl    $0x4,%eax
+  8000ff:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800104:	a3 08 40 80 00       	mov    %eax,0x804008
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800109:	85 db                	test   %ebx,%ebx
+  80010b:	7e 07                	jle    800114 <libmain+0x30>
+    binaryname = argv[0];
+  80010d:	8b 06                	mov    (%esi),%eax
+  80010f:	a3 00 30 80 00       	mov    %eax,0x803000
+
+  // call user main routine
+  umain(argc, argv);
+  800114:	83 ec 08             	sub    $0x8,%esp
+  800117:	56                   	push   %esi
+  800118:	53                   	push   %ebx
+  800119:	e8 15 ff ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  80011e:	e8 0a 00 00 00       	call   80012d <exit>
+}
+  800123:	83 c4 10             	add    $0x10,%esp
+  800126:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800129:	5b                   	pop    %ebx
+  80012a:	5e                   	pop    %esi
+  80012b:	5d                   	pop    %ebp
+  80012c:	c3                   	ret
+
+0080012d <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80012d:	55                   	push   %ebp
+  80012e:	89 e5                	mov    %esp,%ebp
+  800130:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800133:	e8 dd 08 00 00       	call   800a15 <close_all>
+	sys_env_destroy(0);
+  800138:	83 ec 0c             	sub    $0xc,%esp
+  80013b:	6a 00                	push   $0x0
+  80013d:	e8 ad 03 00 00       	call   8004ef <sys_env_destroy>
+}
+  800142:	83 c4 10             	add    $0x10,%esp
+  800145:	c9                   	leave
+  800146:	c3                   	ret
+
+00800147 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800147:	55                   	push   %ebp
+  800148:	89 e5                	mov    %esp,%ebp
+  80014a:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80014d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800152:	eb 03                	jmp    800157 <strlen+0x10>
+		n++;
+  800154:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800157:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80015b:	75 f7                	jne    800154 <strlen+0xd>
+	return n;
+}
+  80015d:	5d                   	pop    %ebp
+  80015e:	c3                   	ret
+
+0080015f <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80015f:	55                   	push   %ebp
+  800160:	89 e5                	mov    %esp,%ebp
+  800162:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800165:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800168:	b8 00 00 00 00       	mov    $0x0,%eax
+  80016d:	eb 03                	jmp    800172 <strnlen+0x13>
+		n++;
+  80016f:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800172:	39 d0                	cmp    %edx,%eax
+  800174:	74 08                	je     80017e <strnlen+0x1f>
+  800176:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80017a:	75 f3                	jne    80016f <strnlen+0x10>
+  80017c:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80017e:	89 d0                	mov    %edx,%eax
+  800180:	5d                   	pop    %ebp
+  800181:	c3                   	ret
+
+00800182 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800182:	55                   	push   %ebp
+  800183:	89 e5                	mov    %esp,%ebp
+  800185:	53                   	push   %ebx
+  800186:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800189:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80018c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800191:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800195:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800198:	83 c0 01             	add    $0x1,%eax
+  80019b:	84 d2                	test   %dl,%dl
+  80019d:	75 f2                	jne    800191 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80019f:	89 c8                	mov    %ecx,%eax
+  8001a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001a4:	c9                   	leave
+  8001a5:	c3                   	ret
+
+008001a6 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8001a6:	55                   	push   %ebp
+  8001a7:	89 e5                	mov    %esp,%ebp
+  8001a9:	53                   	push   %ebx
+  8001aa:	83 ec 10             	sub    $0x10,%esp
+  8001ad:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8001b0:	53                   	push   %ebx
+  8001b1:	e8 91 ff ff ff       	call   800147 <strlen>
+  8001b6:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8001b9:	ff 75 0c             	push   0xc(%ebp)
+  8001bc:	01 d8                	add    %ebx,%eax
+  8001be:	50                   	push   %eax
+  8001bf:	e8 be ff ff ff       	call   800182 <strcpy>
+	return dst;
+}
+  8001c4:	89 d8                	mov    %ebx,%eax
+  8001c6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001c9:	c9                   	leave
+  8001ca:	c3                   	ret
+
+008001cb <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8001cb:	55                   	push   %ebp
+  8001cc:	89 e5                	mov    %esp,%ebp
+  8001ce:	56                   	push   %esi
+  8001cf:	53                   	push   %ebx
+  8001d0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8001d3:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8001d6:	89 f3                	mov    %esi,%ebx
+  8001d8:	03 5d 10             	add    0x10(%ebp),%ebx
+  8001db:	89 f0                	mov    %esi,%eax
+  8001dd:	eb 0f                	jmp    8001ee <strncpy+0x23>
+		*dst++ = *src;
+  8001df:	83 c0 01             	add    $0x1,%eax
+  8001e2:	0f b6 0a             	movzbl (%edx),%ecx
+  8001e5:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8001e8:	80 f9 01             	cmp    $0x1,%cl
+  8001eb:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8001ee:	39 d8                	cmp    %ebx,%eax
+  8001f0:	75 ed                	jne    8001df <strncpy+0x14>
+	}
+	return ret;
+}
+  8001f2:	89 f0                	mov    %esi,%eax
+  8001f4:	5b                   	pop    %ebx
+  8001f5:	5e                   	pop    %esi
+  8001f6:	5d                   	pop    %ebp
+  8001f7:	c3                   	ret
+
+008001f8 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8001f8:	55                   	push   %ebp
+  8001f9:	89 e5                	mov    %esp,%ebp
+  8001fb:	56                   	push   %esi
+  8001fc:	53                   	push   %ebx
+  8001fd:	8b 75 08             	mov    0x8(%ebp),%esi
+  800200:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800203:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800206:	89 f0                	mov    %esi,%eax
+  800208:	85 d2                	test   %edx,%edx
+  80020a:	74 21                	je     80022d <strlcpy+0x35>
+  80020c:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800210:	89 f2                	mov    %esi,%edx
+  800212:	eb 09                	jmp    80021d <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800214:	83 c1 01             	add    $0x1,%ecx
+  800217:	83 c2 01             	add    $0x1,%edx
+  80021a:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80021d:	39 c2                	cmp    %eax,%edx
+  80021f:	74 09                	je     80022a <strlcpy+0x32>
+  800221:	0f b6 19             	movzbl (%ecx),%ebx
+  800224:	84 db                	test   %bl,%bl
+  800226:	75 ec                	jne    800214 <strlcpy+0x1c>
+  800228:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80022a:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80022d:	29 f0                	sub    %esi,%eax
+}
+  80022f:	5b                   	pop    %ebx
+  800230:	5e                   	pop    %esi
+  800231:	5d                   	pop    %ebp
+  800232:	c3                   	ret
+
+00800233 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800233:	55                   	push   %ebp
+  800234:	89 e5                	mov    %esp,%ebp
+  800236:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800239:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80023c:	eb 06                	jmp    800244 <strcmp+0x11>
+		p++, q++;
+  80023e:	83 c1 01             	add    $0x1,%ecx
+  800241:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800244:	0f b6 01             	movzbl (%ecx),%eax
+  800247:	84 c0                	test   %al,%al
+  800249:	74 04                	je     80024f <strcmp+0x1c>
+  80024b:	3a 02                	cmp    (%edx),%al
+  80024d:	74 ef                	je     80023e <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80024f:	0f b6 c0             	movzbl %al,%eax
+  800252:	0f b6 12             	movzbl (%edx),%edx
+  800255:	29 d0                	sub    %edx,%eax
+}
+  800257:	5d                   	pop    %ebp
+  800258:	c3                   	ret
+
+00800259 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800259:	55                   	push   %ebp
+  80025a:	89 e5                	mov    %esp,%ebp
+  80025c:	53                   	push   %ebx
+  80025d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800260:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800263:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800266:	eb 09                	jmp    800271 <strncmp+0x18>
+		n--, p++, q++;
+  800268:	83 ea 01             	sub    $0x1,%edx
+  80026b:	83 c0 01             	add    $0x1,%eax
+  80026e:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800271:	85 d2                	test   %edx,%edx
+  800273:	74 18                	je     80028d <strncmp+0x34>
+  800275:	0f b6 18             	movzbl (%eax),%ebx
+  800278:	84 db                	test   %bl,%bl
+  80027a:	74 04                	je     800280 <strncmp+0x27>
+  80027c:	3a 19                	cmp    (%ecx),%bl
+  80027e:	74 e8                	je     800268 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800280:	0f b6 00             	movzbl (%eax),%eax
+  800283:	0f b6 11             	movzbl (%ecx),%edx
+  800286:	29 d0                	sub    %edx,%eax
+}
+  800288:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80028b:	c9                   	leave
+  80028c:	c3                   	ret
+		return 0;
+  80028d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800292:	eb f4                	jmp    800288 <strncmp+0x2f>
+
+00800294 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800294:	55                   	push   %ebp
+  800295:	89 e5                	mov    %esp,%ebp
+  800297:	8b 45 08             	mov    0x8(%ebp),%eax
+  80029a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80029e:	eb 03                	jmp    8002a3 <strchr+0xf>
+  8002a0:	83 c0 01             	add    $0x1,%eax
+  8002a3:	0f b6 10             	movzbl (%eax),%edx
+  8002a6:	84 d2                	test   %dl,%dl
+  8002a8:	74 06                	je     8002b0 <strchr+0x1c>
+		if (*s == c)
+  8002aa:	38 ca                	cmp    %cl,%dl
+  8002ac:	75 f2                	jne    8002a0 <strchr+0xc>
+  8002ae:	eb 05                	jmp    8002b5 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8002b0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8002b5:	5d                   	pop    %ebp
+  8002b6:	c3                   	ret
+
+008002b7 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8002b7:	55                   	push   %ebp
+  8002b8:	89 e5                	mov    %esp,%ebp
+  8002ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002bd:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8002c1:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8002c4:	38 ca                	cmp    %cl,%dl
+  8002c6:	74 09                	je     8002d1 <strfind+0x1a>
+  8002c8:	84 d2                	test   %dl,%dl
+  8002ca:	74 05                	je     8002d1 <strfind+0x1a>
+	for (; *s; s++)
+  8002cc:	83 c0 01             	add    $0x1,%eax
+  8002cf:	eb f0                	jmp    8002c1 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8002d1:	5d                   	pop    %ebp
+  8002d2:	c3                   	ret
+
+008002d3 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8002d3:	55                   	push   %ebp
+  8002d4:	89 e5                	mov    %esp,%ebp
+  8002d6:	57                   	push   %edi
+  8002d7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8002da:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8002dd:	85 c9                	test   %ecx,%ecx
+  8002df:	74 20                	je     800301 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8002e1:	89 f8                	mov    %edi,%eax
+  8002e3:	09 c8                	or     %ecx,%eax
+  8002e5:	a8 03                	test   $0x3,%al
+  8002e7:	75 12                	jne    8002fb <memset+0x28>
+		c &= 0xFF;
+  8002e9:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8002ed:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8002f3:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8002f6:	fc                   	cld
+  8002f7:	f3 ab                	rep stos %eax,%es:(%edi)
+  8002f9:	eb 06                	jmp    800301 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8002fb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8002fe:	fc                   	cld
+  8002ff:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800301:	89 f8                	mov    %edi,%eax
+  800303:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800306:	c9                   	leave
+  800307:	c3                   	ret
+
+00800308 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800308:	55                   	push   %ebp
+  800309:	89 e5                	mov    %esp,%ebp
+  80030b:	57                   	push   %edi
+  80030c:	56                   	push   %esi
+  80030d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800310:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800313:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800316:	39 c6                	cmp    %eax,%esi
+  800318:	73 32                	jae    80034c <memmove+0x44>
+  80031a:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80031d:	39 d0                	cmp    %edx,%eax
+  80031f:	73 2b                	jae    80034c <memmove+0x44>
+		s += n;
+		d += n;
+  800321:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800324:	89 d6                	mov    %edx,%esi
+  800326:	09 fe                	or     %edi,%esi
+  800328:	09 ce                	or     %ecx,%esi
+  80032a:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800330:	75 0e                	jne    800340 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800332:	83 ef 04             	sub    $0x4,%edi
+  800335:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800338:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  80033b:	fd                   	std
+  80033c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80033e:	eb 09                	jmp    800349 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800340:	83 ef 01             	sub    $0x1,%edi
+  800343:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800346:	fd                   	std
+  800347:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800349:	fc                   	cld
+  80034a:	eb 1a                	jmp    800366 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80034c:	89 f2                	mov    %esi,%edx
+  80034e:	09 c2                	or     %eax,%edx
+  800350:	09 ca                	or     %ecx,%edx
+  800352:	f6 c2 03             	test   $0x3,%dl
+  800355:	75 0a                	jne    800361 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800357:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  80035a:	89 c7                	mov    %eax,%edi
+  80035c:	fc                   	cld
+  80035d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80035f:	eb 05                	jmp    800366 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800361:	89 c7                	mov    %eax,%edi
+  800363:	fc                   	cld
+  800364:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800366:	5e                   	pop    %esi
+  800367:	5f                   	pop    %edi
+  800368:	5d                   	pop    %ebp
+  800369:	c3                   	ret
+
+0080036a <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  80036a:	55                   	push   %ebp
+  80036b:	89 e5                	mov    %esp,%ebp
+  80036d:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800370:	ff 75 10             	push   0x10(%ebp)
+  800373:	ff 75 0c             	push   0xc(%ebp)
+  800376:	ff 75 08             	push   0x8(%ebp)
+  800379:	e8 8a ff ff ff       	call   800308 <memmove>
+}
+  80037e:	c9                   	leave
+  80037f:	c3                   	ret
+
+00800380 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800380:	55                   	push   %ebp
+  800381:	89 e5                	mov    %esp,%ebp
+  800383:	56                   	push   %esi
+  800384:	53                   	push   %ebx
+  800385:	8b 45 08             	mov    0x8(%ebp),%eax
+  800388:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  80038b:	89 c6                	mov    %eax,%esi
+  80038d:	03 75 10             	add    0x10(%ebp),%esi
+  800390:	eb 06                	jmp    800398 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800392:	83 c0 01             	add    $0x1,%eax
+  800395:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800398:	39 f0                	cmp    %esi,%eax
+  80039a:	74 14                	je     8003b0 <memcmp+0x30>
+		if (*s1 != *s2)
+  80039c:	0f b6 08             	movzbl (%eax),%ecx
+  80039f:	0f b6 1a             	movzbl (%edx),%ebx
+  8003a2:	38 d9                	cmp    %bl,%cl
+  8003a4:	74 ec                	je     800392 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  8003a6:	0f b6 c1             	movzbl %cl,%eax
+  8003a9:	0f b6 db             	movzbl %bl,%ebx
+  8003ac:	29 d8                	sub    %ebx,%eax
+  8003ae:	eb 05                	jmp    8003b5 <memcmp+0x35>
+	}
+
+	return 0;
+  8003b0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003b5:	5b                   	pop    %ebx
+  8003b6:	5e                   	pop    %esi
+  8003b7:	5d                   	pop    %ebp
+  8003b8:	c3                   	ret
+
+008003b9 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8003b9:	55                   	push   %ebp
+  8003ba:	89 e5                	mov    %esp,%ebp
+  8003bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003bf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8003c2:	89 c2                	mov    %eax,%edx
+  8003c4:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8003c7:	eb 03                	jmp    8003cc <memfind+0x13>
+  8003c9:	83 c0 01             	add    $0x1,%eax
+  8003cc:	39 d0                	cmp    %edx,%eax
+  8003ce:	73 04                	jae    8003d4 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8003d0:	38 08                	cmp    %cl,(%eax)
+  8003d2:	75 f5                	jne    8003c9 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8003d4:	5d                   	pop    %ebp
+  8003d5:	c3                   	ret
+
+008003d6 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8003d6:	55                   	push   %ebp
+  8003d7:	89 e5                	mov    %esp,%ebp
+  8003d9:	57                   	push   %edi
+  8003da:	56                   	push   %esi
+  8003db:	53                   	push   %ebx
+  8003dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003df:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8003e2:	eb 03                	jmp    8003e7 <strtol+0x11>
+		s++;
+  8003e4:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  8003e7:	0f b6 02             	movzbl (%edx),%eax
+  8003ea:	3c 20                	cmp    $0x20,%al
+  8003ec:	74 f6                	je     8003e4 <strtol+0xe>
+  8003ee:	3c 09                	cmp    $0x9,%al
+  8003f0:	74 f2                	je     8003e4 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8003f2:	3c 2b                	cmp    $0x2b,%al
+  8003f4:	74 2a                	je     800420 <strtol+0x4a>
+	int neg = 0;
+  8003f6:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8003fb:	3c 2d                	cmp    $0x2d,%al
+  8003fd:	74 2b                	je     80042a <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8003ff:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800405:	75 0f                	jne    800416 <strtol+0x40>
+  800407:	80 3a 30             	cmpb   $0x30,(%edx)
+  80040a:	74 28                	je     800434 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  80040c:	85 db                	test   %ebx,%ebx
+  80040e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800413:	0f 44 d8             	cmove  %eax,%ebx
+  800416:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80041b:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  80041e:	eb 46                	jmp    800466 <strtol+0x90>
+		s++;
+  800420:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800423:	bf 00 00 00 00       	mov    $0x0,%edi
+  800428:	eb d5                	jmp    8003ff <strtol+0x29>
+		s++, neg = 1;
+  80042a:	83 c2 01             	add    $0x1,%edx
+  80042d:	bf 01 00 00 00       	mov    $0x1,%edi
+  800432:	eb cb                	jmp    8003ff <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800434:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800438:	74 0e                	je     800448 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  80043a:	85 db                	test   %ebx,%ebx
+  80043c:	75 d8                	jne    800416 <strtol+0x40>
+		s++, base = 8;
+  80043e:	83 c2 01             	add    $0x1,%edx
+  800441:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800446:	eb ce                	jmp    800416 <strtol+0x40>
+		s += 2, base = 16;
+  800448:	83 c2 02             	add    $0x2,%edx
+  80044b:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800450:	eb c4                	jmp    800416 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800452:	0f be c0             	movsbl %al,%eax
+  800455:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800458:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80045b:	7d 3a                	jge    800497 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  80045d:	83 c2 01             	add    $0x1,%edx
+  800460:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800464:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800466:	0f b6 02             	movzbl (%edx),%eax
+  800469:	8d 70 d0             	lea    -0x30(%eax),%esi
+  80046c:	89 f3                	mov    %esi,%ebx
+  80046e:	80 fb 09             	cmp    $0x9,%bl
+  800471:	76 df                	jbe    800452 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800473:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800476:	89 f3                	mov    %esi,%ebx
+  800478:	80 fb 19             	cmp    $0x19,%bl
+  80047b:	77 08                	ja     800485 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  80047d:	0f be c0             	movsbl %al,%eax
+  800480:	83 e8 57             	sub    $0x57,%eax
+  800483:	eb d3                	jmp    800458 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800485:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800488:	89 f3                	mov    %esi,%ebx
+  80048a:	80 fb 19             	cmp    $0x19,%bl
+  80048d:	77 08                	ja     800497 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  80048f:	0f be c0             	movsbl %al,%eax
+  800492:	83 e8 37             	sub    $0x37,%eax
+  800495:	eb c1                	jmp    800458 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800497:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80049b:	74 05                	je     8004a2 <strtol+0xcc>
+		*endptr = (char *) s;
+  80049d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8004a0:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  8004a2:	89 c8                	mov    %ecx,%eax
+  8004a4:	f7 d8                	neg    %eax
+  8004a6:	85 ff                	test   %edi,%edi
+  8004a8:	0f 45 c8             	cmovne %eax,%ecx
+}
+  8004ab:	89 c8                	mov    %ecx,%eax
+  8004ad:	5b                   	pop    %ebx
+  8004ae:	5e                   	pop    %esi
+  8004af:	5f                   	pop    %edi
+  8004b0:	5d                   	pop    %ebp
+  8004b1:	c3                   	ret
+
+008004b2 <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8004b2:	55                   	push   %ebp
+  8004b3:	89 e5                	mov    %esp,%ebp
+  8004b5:	57                   	push   %edi
+  8004b6:	56                   	push   %esi
+  8004b7:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8004b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004bd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004c0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004c3:	89 c3                	mov    %eax,%ebx
+  8004c5:	89 c7                	mov    %eax,%edi
+  8004c7:	89 c6                	mov    %eax,%esi
+  8004c9:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  8004cb:	5b                   	pop    %ebx
+  8004cc:	5e                   	pop    %esi
+  8004cd:	5f                   	pop    %edi
+  8004ce:	5d                   	pop    %ebp
+  8004cf:	c3                   	ret
+
+008004d0 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8004d0:	55                   	push   %ebp
+  8004d1:	89 e5                	mov    %esp,%ebp
+  8004d3:	57                   	push   %edi
+  8004d4:	56                   	push   %esi
+  8004d5:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8004d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004db:	b8 01 00 00 00       	mov    $0x1,%eax
+  8004e0:	89 d1                	mov    %edx,%ecx
+  8004e2:	89 d3                	mov    %edx,%ebx
+  8004e4:	89 d7                	mov    %edx,%edi
+  8004e6:	89 d6                	mov    %edx,%esi
+  8004e8:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8004ea:	5b                   	pop    %ebx
+  8004eb:	5e                   	pop    %esi
+  8004ec:	5f                   	pop    %edi
+  8004ed:	5d                   	pop    %ebp
+  8004ee:	c3                   	ret
+
+008004ef <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8004ef:	55                   	push   %ebp
+  8004f0:	89 e5                	mov    %esp,%ebp
+  8004f2:	57                   	push   %edi
+  8004f3:	56                   	push   %esi
+  8004f4:	53                   	push   %ebx
+  8004f5:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8004f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800500:	b8 03 00 00 00       	mov    $0x3,%eax
+  800505:	89 cb                	mov    %ecx,%ebx
+  800507:	89 cf                	mov    %ecx,%edi
+  800509:	89 ce                	mov    %ecx,%esi
+  80050b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80050d:	85 c0                	test   %eax,%eax
+  80050f:	7f 08                	jg     800519 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800511:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800514:	5b                   	pop    %ebx
+  800515:	5e                   	pop    %esi
+  800516:	5f                   	pop    %edi
+  800517:	5d                   	pop    %ebp
+  800518:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800519:	83 ec 0c             	sub    $0xc,%esp
+  80051c:	50                   	push   %eax
+  80051d:	6a 03                	push   $0x3
+  80051f:	68 af 25 80 00       	push   $0x8025af
+  800524:	6a 3e                	push   $0x3e
+  800526:	68 cc 25 80 00       	push   $0x8025cc
+  80052b:	e8 22 14 00 00       	call   801952 <_panic>
+
+00800530 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800530:	55                   	push   %ebp
+  800531:	89 e5                	mov    %esp,%ebp
+  800533:	57                   	push   %edi
+  800534:	56                   	push   %esi
+  800535:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800536:	ba 00 00 00 00       	mov    $0x0,%edx
+  80053b:	b8 02 00 00 00       	mov    $0x2,%eax
+  800540:	89 d1                	mov    %edx,%ecx
+  800542:	89 d3                	mov    %edx,%ebx
+  800544:	89 d7                	mov    %edx,%edi
+  800546:	89 d6                	mov    %edx,%esi
+  800548:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  80054a:	5b                   	pop    %ebx
+  80054b:	5e                   	pop    %esi
+  80054c:	5f                   	pop    %edi
+  80054d:	5d                   	pop    %ebp
+  80054e:	c3                   	ret
+
+0080054f <sys_yield>:
+
+void
+sys_yield(void) {
+  80054f:	55                   	push   %ebp
+  800550:	89 e5                	mov    %esp,%ebp
+  800552:	57                   	push   %edi
+  800553:	56                   	push   %esi
+  800554:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800555:	ba 00 00 00 00       	mov    $0x0,%edx
+  80055a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80055f:	89 d1                	mov    %edx,%ecx
+  800561:	89 d3                	mov    %edx,%ebx
+  800563:	89 d7                	mov    %edx,%edi
+  800565:	89 d6                	mov    %edx,%esi
+  800567:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800569:	5b                   	pop    %ebx
+  80056a:	5e                   	pop    %esi
+  80056b:	5f                   	pop    %edi
+  80056c:	5d                   	pop    %ebp
+  80056d:	c3                   	ret
+
+0080056e <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  80056e:	55                   	push   %ebp
+  80056f:	89 e5                	mov    %esp,%ebp
+  800571:	57                   	push   %edi
+  800572:	56                   	push   %esi
+  800573:	53                   	push   %ebx
+  800574:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800577:	be 00 00 00 00       	mov    $0x0,%esi
+  80057c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80057f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800582:	b8 04 00 00 00       	mov    $0x4,%eax
+  800587:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80058a:	89 f7                	mov    %esi,%edi
+  80058c:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80058e:	85 c0                	test   %eax,%eax
+  800590:	7f 08                	jg     80059a <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800592:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800595:	5b                   	pop    %ebx
+  800596:	5e                   	pop    %esi
+  800597:	5f                   	pop    %edi
+  800598:	5d                   	pop    %ebp
+  800599:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80059a:	83 ec 0c             	sub    $0xc,%esp
+  80059d:	50                   	push   %eax
+  80059e:	6a 04                	push   $0x4
+  8005a0:	68 af 25 80 00       	push   $0x8025af
+  8005a5:	6a 3e                	push   $0x3e
+  8005a7:	68 cc 25 80 00       	push   $0x8025cc
+  8005ac:	e8 a1 13 00 00       	call   801952 <_panic>
+
+008005b1 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  8005b1:	55                   	push   %ebp
+  8005b2:	89 e5                	mov    %esp,%ebp
+  8005b4:	57                   	push   %edi
+  8005b5:	56                   	push   %esi
+  8005b6:	53                   	push   %ebx
+  8005b7:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8005ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005c0:	b8 05 00 00 00       	mov    $0x5,%eax
+  8005c5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8005c8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8005cb:	8b 75 18             	mov    0x18(%ebp),%esi
+  8005ce:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8005d0:	85 c0                	test   %eax,%eax
+  8005d2:	7f 08                	jg     8005dc <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  8005d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005d7:	5b                   	pop    %ebx
+  8005d8:	5e                   	pop    %esi
+  8005d9:	5f                   	pop    %edi
+  8005da:	5d                   	pop    %ebp
+  8005db:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8005dc:	83 ec 0c             	sub    $0xc,%esp
+  8005df:	50                   	push   %eax
+  8005e0:	6a 05                	push   $0x5
+  8005e2:	68 af 25 80 00       	push   $0x8025af
+  8005e7:	6a 3e                	push   $0x3e
+  8005e9:	68 cc 25 80 00       	push   $0x8025cc
+  8005ee:	e8 5f 13 00 00       	call   801952 <_panic>
+
+008005f3 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  8005f3:	55                   	push   %ebp
+  8005f4:	89 e5                	mov    %esp,%ebp
+  8005f6:	57                   	push   %edi
+  8005f7:	56                   	push   %esi
+  8005f8:	53                   	push   %ebx
+  8005f9:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8005fc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800601:	8b 55 08             	mov    0x8(%ebp),%edx
+  800604:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800607:	b8 06 00 00 00       	mov    $0x6,%eax
+  80060c:	89 df                	mov    %ebx,%edi
+  80060e:	89 de                	mov    %ebx,%esi
+  800610:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800612:	85 c0                	test   %eax,%eax
+  800614:	7f 08                	jg     80061e <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800616:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800619:	5b                   	pop    %ebx
+  80061a:	5e                   	pop    %esi
+  80061b:	5f                   	pop    %edi
+  80061c:	5d                   	pop    %ebp
+  80061d:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80061e:	83 ec 0c             	sub    $0xc,%esp
+  800621:	50                   	push   %eax
+  800622:	6a 06                	push   $0x6
+  800624:	68 af 25 80 00       	push   $0x8025af
+  800629:	6a 3e                	push   $0x3e
+  80062b:	68 cc 25 80 00       	push   $0x8025cc
+  800630:	e8 1d 13 00 00       	call   801952 <_panic>
+
+00800635 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800635:	55                   	push   %ebp
+  800636:	89 e5                	mov    %esp,%ebp
+  800638:	57                   	push   %edi
+  800639:	56                   	push   %esi
+  80063a:	53                   	push   %ebx
+  80063b:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  80063e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800643:	8b 55 08             	mov    0x8(%ebp),%edx
+  800646:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800649:	b8 08 00 00 00       	mov    $0x8,%eax
+  80064e:	89 df                	mov    %ebx,%edi
+  800650:	89 de                	mov    %ebx,%esi
+  800652:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800654:	85 c0                	test   %eax,%eax
+  800656:	7f 08                	jg     800660 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800658:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80065b:	5b                   	pop    %ebx
+  80065c:	5e                   	pop    %esi
+  80065d:	5f                   	pop    %edi
+  80065e:	5d                   	pop    %ebp
+  80065f:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800660:	83 ec 0c             	sub    $0xc,%esp
+  800663:	50                   	push   %eax
+  800664:	6a 08                	push   $0x8
+  800666:	68 af 25 80 00       	push   $0x8025af
+  80066b:	6a 3e                	push   $0x3e
+  80066d:	68 cc 25 80 00       	push   $0x8025cc
+  800672:	e8 db 12 00 00       	call   801952 <_panic>
+
+00800677 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800677:	55                   	push   %ebp
+  800678:	89 e5                	mov    %esp,%ebp
+  80067a:	57                   	push   %edi
+  80067b:	56                   	push   %esi
+  80067c:	53                   	push   %ebx
+  80067d:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800680:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800685:	8b 55 08             	mov    0x8(%ebp),%edx
+  800688:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80068b:	b8 09 00 00 00       	mov    $0x9,%eax
+  800690:	89 df                	mov    %ebx,%edi
+  800692:	89 de                	mov    %ebx,%esi
+  800694:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800696:	85 c0                	test   %eax,%eax
+  800698:	7f 08                	jg     8006a2 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  80069a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80069d:	5b                   	pop    %ebx
+  80069e:	5e                   	pop    %esi
+  80069f:	5f                   	pop    %edi
+  8006a0:	5d                   	pop    %ebp
+  8006a1:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8006a2:	83 ec 0c             	sub    $0xc,%esp
+  8006a5:	50                   	push   %eax
+  8006a6:	6a 09                	push   $0x9
+  8006a8:	68 af 25 80 00       	push   $0x8025af
+  8006ad:	6a 3e                	push   $0x3e
+  8006af:	68 cc 25 80 00       	push   $0x8025cc
+  8006b4:	e8 99 12 00 00       	call   801952 <_panic>
+
+008006b9 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8006b9:	55                   	push   %ebp
+  8006ba:	89 e5                	mov    %esp,%ebp
+  8006bc:	57                   	push   %edi
+  8006bd:	56                   	push   %esi
+  8006be:	53                   	push   %ebx
+  8006bf:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8006c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006c7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006ca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8006cd:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8006d2:	89 df                	mov    %ebx,%edi
+  8006d4:	89 de                	mov    %ebx,%esi
+  8006d6:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8006d8:	85 c0                	test   %eax,%eax
+  8006da:	7f 08                	jg     8006e4 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8006dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006df:	5b                   	pop    %ebx
+  8006e0:	5e                   	pop    %esi
+  8006e1:	5f                   	pop    %edi
+  8006e2:	5d                   	pop    %ebp
+  8006e3:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8006e4:	83 ec 0c             	sub    $0xc,%esp
+  8006e7:	50                   	push   %eax
+  8006e8:	6a 0a                	push   $0xa
+  8006ea:	68 af 25 80 00       	push   $0x8025af
+  8006ef:	6a 3e                	push   $0x3e
+  8006f1:	68 cc 25 80 00       	push   $0x8025cc
+  8006f6:	e8 57 12 00 00       	call   801952 <_panic>
+
+008006fb <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  8006fb:	55                   	push   %ebp
+  8006fc:	89 e5                	mov    %esp,%ebp
+  8006fe:	57                   	push   %edi
+  8006ff:	56                   	push   %esi
+  800700:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800701:	8b 55 08             	mov    0x8(%ebp),%edx
+  800704:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800707:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80070c:	be 00 00 00 00       	mov    $0x0,%esi
+  800711:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800714:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800717:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800719:	5b                   	pop    %ebx
+  80071a:	5e                   	pop    %esi
+  80071b:	5f                   	pop    %edi
+  80071c:	5d                   	pop    %ebp
+  80071d:	c3                   	ret
+
+0080071e <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  80071e:	55                   	push   %ebp
+  80071f:	89 e5                	mov    %esp,%ebp
+  800721:	57                   	push   %edi
+  800722:	56                   	push   %esi
+  800723:	53                   	push   %ebx
+  800724:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800727:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80072c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80072f:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800734:	89 cb                	mov    %ecx,%ebx
+  800736:	89 cf                	mov    %ecx,%edi
+  800738:	89 ce                	mov    %ecx,%esi
+  80073a:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80073c:	85 c0                	test   %eax,%eax
+  80073e:	7f 08                	jg     800748 <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  800740:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800743:	5b                   	pop    %ebx
+  800744:	5e                   	pop    %esi
+  800745:	5f                   	pop    %edi
+  800746:	5d                   	pop    %ebp
+  800747:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800748:	83 ec 0c             	sub    $0xc,%esp
+  80074b:	50                   	push   %eax
+  80074c:	6a 0d                	push   $0xd
+  80074e:	68 af 25 80 00       	push   $0x8025af
+  800753:	6a 3e                	push   $0x3e
+  800755:	68 cc 25 80 00       	push   $0x8025cc
+  80075a:	e8 f3 11 00 00       	call   801952 <_panic>
+
+0080075f <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  80075f:	55                   	push   %ebp
+  800760:	89 e5                	mov    %esp,%ebp
+  800762:	57                   	push   %edi
+  800763:	56                   	push   %esi
+  800764:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800765:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80076a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80076d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800770:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800775:	89 df                	mov    %ebx,%edi
+  800777:	89 de                	mov    %ebx,%esi
+  800779:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  80077b:	5b                   	pop    %ebx
+  80077c:	5e                   	pop    %esi
+  80077d:	5f                   	pop    %edi
+  80077e:	5d                   	pop    %ebp
+  80077f:	c3                   	ret
+
+00800780 <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  800780:	55                   	push   %ebp
+  800781:	89 e5                	mov    %esp,%ebp
+  800783:	57                   	push   %edi
+  800784:	56                   	push   %esi
+  800785:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800786:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80078b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80078e:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800793:	89 cb                	mov    %ecx,%ebx
+  800795:	89 cf                	mov    %ecx,%edi
+  800797:	89 ce                	mov    %ecx,%esi
+  800799:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  80079b:	5b                   	pop    %ebx
+  80079c:	5e                   	pop    %esi
+  80079d:	5f                   	pop    %edi
+  80079e:	5d                   	pop    %ebp
+  80079f:	c3                   	ret
+
+008007a0 <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  8007a0:	55                   	push   %ebp
+  8007a1:	89 e5                	mov    %esp,%ebp
+  8007a3:	57                   	push   %edi
+  8007a4:	56                   	push   %esi
+  8007a5:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8007a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8007ab:	b8 10 00 00 00       	mov    $0x10,%eax
+  8007b0:	89 d1                	mov    %edx,%ecx
+  8007b2:	89 d3                	mov    %edx,%ebx
+  8007b4:	89 d7                	mov    %edx,%edi
+  8007b6:	89 d6                	mov    %edx,%esi
+  8007b8:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8007ba:	5b                   	pop    %ebx
+  8007bb:	5e                   	pop    %esi
+  8007bc:	5f                   	pop    %edi
+  8007bd:	5d                   	pop    %ebp
+  8007be:	c3                   	ret
+
+008007bf <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  8007bf:	55                   	push   %ebp
+  8007c0:	89 e5                	mov    %esp,%ebp
+  8007c2:	57                   	push   %edi
+  8007c3:	56                   	push   %esi
+  8007c4:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8007c5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8007ca:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007cd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007d0:	b8 11 00 00 00       	mov    $0x11,%eax
+  8007d5:	89 df                	mov    %ebx,%edi
+  8007d7:	89 de                	mov    %ebx,%esi
+  8007d9:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  8007db:	5b                   	pop    %ebx
+  8007dc:	5e                   	pop    %esi
+  8007dd:	5f                   	pop    %edi
+  8007de:	5d                   	pop    %ebp
+  8007df:	c3                   	ret
+
+008007e0 <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  8007e0:	55                   	push   %ebp
+  8007e1:	89 e5                	mov    %esp,%ebp
+  8007e3:	57                   	push   %edi
+  8007e4:	56                   	push   %esi
+  8007e5:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8007e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8007eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007f1:	b8 12 00 00 00       	mov    $0x12,%eax
+  8007f6:	89 df                	mov    %ebx,%edi
+  8007f8:	89 de                	mov    %ebx,%esi
+  8007fa:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  8007fc:	5b                   	pop    %ebx
+  8007fd:	5e                   	pop    %esi
+  8007fe:	5f                   	pop    %edi
+  8007ff:	5d                   	pop    %ebp
+  800800:	c3                   	ret
+
+00800801 <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  800801:	55                   	push   %ebp
+  800802:	89 e5                	mov    %esp,%ebp
+  800804:	57                   	push   %edi
+  800805:	56                   	push   %esi
+  800806:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800807:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80080c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80080f:	b8 13 00 00 00       	mov    $0x13,%eax
+  800814:	89 cb                	mov    %ecx,%ebx
+  800816:	89 cf                	mov    %ecx,%edi
+  800818:	89 ce                	mov    %ecx,%esi
+  80081a:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  80081c:	5b                   	pop    %ebx
+  80081d:	5e                   	pop    %esi
+  80081e:	5f                   	pop    %edi
+  80081f:	5d                   	pop    %ebp
+  800820:	c3                   	ret
+
+00800821 <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  800821:	55                   	push   %ebp
+  800822:	89 e5                	mov    %esp,%ebp
+  800824:	57                   	push   %edi
+  800825:	56                   	push   %esi
+  800826:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800827:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80082c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80082f:	b8 14 00 00 00       	mov    $0x14,%eax
+  800834:	89 cb                	mov    %ecx,%ebx
+  800836:	89 cf                	mov    %ecx,%edi
+  800838:	89 ce                	mov    %ecx,%esi
+  80083a:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  80083c:	5b                   	pop    %ebx
+  80083d:	5e                   	pop    %esi
+  80083e:	5f                   	pop    %edi
+  80083f:	5d                   	pop    %ebp
+  800840:	c3                   	ret
+
+00800841 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800841:	55                   	push   %ebp
+  800842:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800844:	8b 45 08             	mov    0x8(%ebp),%eax
+  800847:	05 00 00 00 30       	add    $0x30000000,%eax
+  80084c:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80084f:	5d                   	pop    %ebp
+  800850:	c3                   	ret
+
+00800851 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800851:	55                   	push   %ebp
+  800852:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800854:	8b 45 08             	mov    0x8(%ebp),%eax
+  800857:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80085c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800861:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800866:	5d                   	pop    %ebp
+  800867:	c3                   	ret
+
+00800868 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800868:	55                   	push   %ebp
+  800869:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80086b:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800870:	eb 02                	jmp    800874 <fd_alloc+0xc>
+  800872:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800874:	89 c2                	mov    %eax,%edx
+  800876:	c1 ea 16             	shr    $0x16,%edx
+  800879:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800880:	f6 c2 01             	test   $0x1,%dl
+  800883:	74 2b                	je     8008b0 <fd_alloc+0x48>
+  800885:	89 c2                	mov    %eax,%edx
+  800887:	c1 ea 0c             	shr    $0xc,%edx
+  80088a:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  800891:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  800897:	f6 c1 01             	test   $0x1,%cl
+  80089a:	74 14                	je     8008b0 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80089c:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8008a2:	75 ce                	jne    800872 <fd_alloc+0xa>
+  8008a4:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8008a9:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8008ae:	eb 05                	jmp    8008b5 <fd_alloc+0x4d>
+			return 0;
+  8008b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8008b5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8008b8:	89 02                	mov    %eax,(%edx)
+}
+  8008ba:	89 c8                	mov    %ecx,%eax
+  8008bc:	5d                   	pop    %ebp
+  8008bd:	c3                   	ret
+
+008008be <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8008be:	55                   	push   %ebp
+  8008bf:	89 e5                	mov    %esp,%ebp
+  8008c1:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8008c4:	83 f8 1f             	cmp    $0x1f,%eax
+  8008c7:	77 30                	ja     8008f9 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8008c9:	c1 e0 0c             	shl    $0xc,%eax
+  8008cc:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8008d1:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8008d7:	f6 c2 01             	test   $0x1,%dl
+  8008da:	74 24                	je     800900 <fd_lookup+0x42>
+  8008dc:	89 c2                	mov    %eax,%edx
+  8008de:	c1 ea 0c             	shr    $0xc,%edx
+  8008e1:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8008e8:	f6 c2 01             	test   $0x1,%dl
+  8008eb:	74 1a                	je     800907 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8008ed:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008f0:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8008f2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008f7:	5d                   	pop    %ebp
+  8008f8:	c3                   	ret
+		return -E_INVAL;
+  8008f9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008fe:	eb f7                	jmp    8008f7 <fd_lookup+0x39>
+		return -E_INVAL;
+  800900:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800905:	eb f0                	jmp    8008f7 <fd_lookup+0x39>
+  800907:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80090c:	eb e9                	jmp    8008f7 <fd_lookup+0x39>
+
+0080090e <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80090e:	55                   	push   %ebp
+  80090f:	89 e5                	mov    %esp,%ebp
+  800911:	53                   	push   %ebx
+  800912:	83 ec 04             	sub    $0x4,%esp
+  800915:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  800918:	b8 00 00 00 00       	mov    $0x0,%eax
+  80091d:	eb 03                	jmp    800922 <dev_lookup+0x14>
+  80091f:	83 c0 01             	add    $0x1,%eax
+  800922:	8b 1c 85 58 26 80 00 	mov    0x802658(,%eax,4),%ebx
+  800929:	85 db                	test   %ebx,%ebx
+  80092b:	74 0b                	je     800938 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  80092d:	39 13                	cmp    %edx,(%ebx)
+  80092f:	75 ee                	jne    80091f <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  800931:	b8 00 00 00 00       	mov    $0x0,%eax
+  800936:	eb 1f                	jmp    800957 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800938:	a1 08 40 80 00       	mov    0x804008,%eax
+  80093d:	8b 40 48             	mov    0x48(%eax),%eax
+  800940:	83 ec 04             	sub    $0x4,%esp
+  800943:	52                   	push   %edx
+  800944:	50                   	push   %eax
+  800945:	68 dc 25 80 00       	push   $0x8025dc
+  80094a:	e8 de 10 00 00       	call   801a2d <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80094f:	83 c4 10             	add    $0x10,%esp
+  800952:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  800957:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80095a:	89 1a                	mov    %ebx,(%edx)
+}
+  80095c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80095f:	c9                   	leave
+  800960:	c3                   	ret
+
+00800961 <fd_close>:
+{
+  800961:	55                   	push   %ebp
+  800962:	89 e5                	mov    %esp,%ebp
+  800964:	57                   	push   %edi
+  800965:	56                   	push   %esi
+  800966:	53                   	push   %ebx
+  800967:	83 ec 24             	sub    $0x24,%esp
+  80096a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80096d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800970:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800973:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800974:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80097a:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80097d:	50                   	push   %eax
+  80097e:	e8 3b ff ff ff       	call   8008be <fd_lookup>
+  800983:	89 c3                	mov    %eax,%ebx
+  800985:	83 c4 10             	add    $0x10,%esp
+  800988:	85 c0                	test   %eax,%eax
+  80098a:	78 05                	js     800991 <fd_close+0x30>
+	    || fd != fd2)
+  80098c:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80098f:	74 16                	je     8009a7 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  800991:	89 f8                	mov    %edi,%eax
+  800993:	84 c0                	test   %al,%al
+  800995:	b8 00 00 00 00       	mov    $0x0,%eax
+  80099a:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80099d:	89 d8                	mov    %ebx,%eax
+  80099f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009a2:	5b                   	pop    %ebx
+  8009a3:	5e                   	pop    %esi
+  8009a4:	5f                   	pop    %edi
+  8009a5:	5d                   	pop    %ebp
+  8009a6:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8009a7:	83 ec 08             	sub    $0x8,%esp
+  8009aa:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8009ad:	50                   	push   %eax
+  8009ae:	ff 36                	push   (%esi)
+  8009b0:	e8 59 ff ff ff       	call   80090e <dev_lookup>
+  8009b5:	89 c3                	mov    %eax,%ebx
+  8009b7:	83 c4 10             	add    $0x10,%esp
+  8009ba:	85 c0                	test   %eax,%eax
+  8009bc:	78 1a                	js     8009d8 <fd_close+0x77>
+		if (dev->dev_close)
+  8009be:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8009c1:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8009c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8009c9:	85 c0                	test   %eax,%eax
+  8009cb:	74 0b                	je     8009d8 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8009cd:	83 ec 0c             	sub    $0xc,%esp
+  8009d0:	56                   	push   %esi
+  8009d1:	ff d0                	call   *%eax
+  8009d3:	89 c3                	mov    %eax,%ebx
+  8009d5:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8009d8:	83 ec 08             	sub    $0x8,%esp
+  8009db:	56                   	push   %esi
+  8009dc:	6a 00                	push   $0x0
+  8009de:	e8 10 fc ff ff       	call   8005f3 <sys_page_unmap>
+	return r;
+  8009e3:	83 c4 10             	add    $0x10,%esp
+  8009e6:	eb b5                	jmp    80099d <fd_close+0x3c>
+
+008009e8 <close>:
+
+int
+close(int fdnum)
+{
+  8009e8:	55                   	push   %ebp
+  8009e9:	89 e5                	mov    %esp,%ebp
+  8009eb:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8009ee:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8009f1:	50                   	push   %eax
+  8009f2:	ff 75 08             	push   0x8(%ebp)
+  8009f5:	e8 c4 fe ff ff       	call   8008be <fd_lookup>
+  8009fa:	83 c4 10             	add    $0x10,%esp
+  8009fd:	85 c0                	test   %eax,%eax
+  8009ff:	79 02                	jns    800a03 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  800a01:	c9                   	leave
+  800a02:	c3                   	ret
+		return fd_close(fd, 1);
+  800a03:	83 ec 08             	sub    $0x8,%esp
+  800a06:	6a 01                	push   $0x1
+  800a08:	ff 75 f4             	push   -0xc(%ebp)
+  800a0b:	e8 51 ff ff ff       	call   800961 <fd_close>
+  800a10:	83 c4 10             	add    $0x10,%esp
+  800a13:	eb ec                	jmp    800a01 <close+0x19>
+
+00800a15 <close_all>:
+
+void
+close_all(void)
+{
+  800a15:	55                   	push   %ebp
+  800a16:	89 e5                	mov    %esp,%ebp
+  800a18:	53                   	push   %ebx
+  800a19:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  800a1c:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  800a21:	83 ec 0c             	sub    $0xc,%esp
+  800a24:	53                   	push   %ebx
+  800a25:	e8 be ff ff ff       	call   8009e8 <close>
+	for (i = 0; i < MAXFD; i++)
+  800a2a:	83 c3 01             	add    $0x1,%ebx
+  800a2d:	83 c4 10             	add    $0x10,%esp
+  800a30:	83 fb 20             	cmp    $0x20,%ebx
+  800a33:	75 ec                	jne    800a21 <close_all+0xc>
+}
+  800a35:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a38:	c9                   	leave
+  800a39:	c3                   	ret
+
+00800a3a <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  800a3a:	55                   	push   %ebp
+  800a3b:	89 e5                	mov    %esp,%ebp
+  800a3d:	57                   	push   %edi
+  800a3e:	56                   	push   %esi
+  800a3f:	53                   	push   %ebx
+  800a40:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800a43:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800a46:	50                   	push   %eax
+  800a47:	ff 75 08             	push   0x8(%ebp)
+  800a4a:	e8 6f fe ff ff       	call   8008be <fd_lookup>
+  800a4f:	89 c3                	mov    %eax,%ebx
+  800a51:	83 c4 10             	add    $0x10,%esp
+  800a54:	85 c0                	test   %eax,%eax
+  800a56:	78 7f                	js     800ad7 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  800a58:	83 ec 0c             	sub    $0xc,%esp
+  800a5b:	ff 75 0c             	push   0xc(%ebp)
+  800a5e:	e8 85 ff ff ff       	call   8009e8 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  800a63:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a66:	c1 e6 0c             	shl    $0xc,%esi
+  800a69:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  800a6f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800a72:	89 3c 24             	mov    %edi,(%esp)
+  800a75:	e8 d7 fd ff ff       	call   800851 <fd2data>
+  800a7a:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  800a7c:	89 34 24             	mov    %esi,(%esp)
+  800a7f:	e8 cd fd ff ff       	call   800851 <fd2data>
+  800a84:	83 c4 10             	add    $0x10,%esp
+  800a87:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  800a8a:	89 d8                	mov    %ebx,%eax
+  800a8c:	c1 e8 16             	shr    $0x16,%eax
+  800a8f:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  800a96:	a8 01                	test   $0x1,%al
+  800a98:	74 11                	je     800aab <dup+0x71>
+  800a9a:	89 d8                	mov    %ebx,%eax
+  800a9c:	c1 e8 0c             	shr    $0xc,%eax
+  800a9f:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  800aa6:	f6 c2 01             	test   $0x1,%dl
+  800aa9:	75 36                	jne    800ae1 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  800aab:	89 f8                	mov    %edi,%eax
+  800aad:	c1 e8 0c             	shr    $0xc,%eax
+  800ab0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800ab7:	83 ec 0c             	sub    $0xc,%esp
+  800aba:	25 07 0e 00 00       	and    $0xe07,%eax
+  800abf:	50                   	push   %eax
+  800ac0:	56                   	push   %esi
+  800ac1:	6a 00                	push   $0x0
+  800ac3:	57                   	push   %edi
+  800ac4:	6a 00                	push   $0x0
+  800ac6:	e8 e6 fa ff ff       	call   8005b1 <sys_page_map>
+  800acb:	89 c3                	mov    %eax,%ebx
+  800acd:	83 c4 20             	add    $0x20,%esp
+  800ad0:	85 c0                	test   %eax,%eax
+  800ad2:	78 33                	js     800b07 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  800ad4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  800ad7:	89 d8                	mov    %ebx,%eax
+  800ad9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800adc:	5b                   	pop    %ebx
+  800add:	5e                   	pop    %esi
+  800ade:	5f                   	pop    %edi
+  800adf:	5d                   	pop    %ebp
+  800ae0:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  800ae1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800ae8:	83 ec 0c             	sub    $0xc,%esp
+  800aeb:	25 07 0e 00 00       	and    $0xe07,%eax
+  800af0:	50                   	push   %eax
+  800af1:	ff 75 d4             	push   -0x2c(%ebp)
+  800af4:	6a 00                	push   $0x0
+  800af6:	53                   	push   %ebx
+  800af7:	6a 00                	push   $0x0
+  800af9:	e8 b3 fa ff ff       	call   8005b1 <sys_page_map>
+  800afe:	89 c3                	mov    %eax,%ebx
+  800b00:	83 c4 20             	add    $0x20,%esp
+  800b03:	85 c0                	test   %eax,%eax
+  800b05:	79 a4                	jns    800aab <dup+0x71>
+	sys_page_unmap(0, newfd);
+  800b07:	83 ec 08             	sub    $0x8,%esp
+  800b0a:	56                   	push   %esi
+  800b0b:	6a 00                	push   $0x0
+  800b0d:	e8 e1 fa ff ff       	call   8005f3 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  800b12:	83 c4 08             	add    $0x8,%esp
+  800b15:	ff 75 d4             	push   -0x2c(%ebp)
+  800b18:	6a 00                	push   $0x0
+  800b1a:	e8 d4 fa ff ff       	call   8005f3 <sys_page_unmap>
+	return r;
+  800b1f:	83 c4 10             	add    $0x10,%esp
+  800b22:	eb b3                	jmp    800ad7 <dup+0x9d>
+
+00800b24 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  800b24:	55                   	push   %ebp
+  800b25:	89 e5                	mov    %esp,%ebp
+  800b27:	56                   	push   %esi
+  800b28:	53                   	push   %ebx
+  800b29:	83 ec 18             	sub    $0x18,%esp
+  800b2c:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800b2f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800b32:	50                   	push   %eax
+  800b33:	56                   	push   %esi
+  800b34:	e8 85 fd ff ff       	call   8008be <fd_lookup>
+  800b39:	83 c4 10             	add    $0x10,%esp
+  800b3c:	85 c0                	test   %eax,%eax
+  800b3e:	78 3c                	js     800b7c <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800b40:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  800b43:	83 ec 08             	sub    $0x8,%esp
+  800b46:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b49:	50                   	push   %eax
+  800b4a:	ff 33                	push   (%ebx)
+  800b4c:	e8 bd fd ff ff       	call   80090e <dev_lookup>
+  800b51:	83 c4 10             	add    $0x10,%esp
+  800b54:	85 c0                	test   %eax,%eax
+  800b56:	78 24                	js     800b7c <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800b58:	8b 43 08             	mov    0x8(%ebx),%eax
+  800b5b:	83 e0 03             	and    $0x3,%eax
+  800b5e:	83 f8 01             	cmp    $0x1,%eax
+  800b61:	74 20                	je     800b83 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  800b63:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b66:	8b 40 08             	mov    0x8(%eax),%eax
+  800b69:	85 c0                	test   %eax,%eax
+  800b6b:	74 37                	je     800ba4 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  800b6d:	83 ec 04             	sub    $0x4,%esp
+  800b70:	ff 75 10             	push   0x10(%ebp)
+  800b73:	ff 75 0c             	push   0xc(%ebp)
+  800b76:	53                   	push   %ebx
+  800b77:	ff d0                	call   *%eax
+  800b79:	83 c4 10             	add    $0x10,%esp
+}
+  800b7c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b7f:	5b                   	pop    %ebx
+  800b80:	5e                   	pop    %esi
+  800b81:	5d                   	pop    %ebp
+  800b82:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800b83:	a1 08 40 80 00       	mov    0x804008,%eax
+  800b88:	8b 40 48             	mov    0x48(%eax),%eax
+  800b8b:	83 ec 04             	sub    $0x4,%esp
+  800b8e:	56                   	push   %esi
+  800b8f:	50                   	push   %eax
+  800b90:	68 1d 26 80 00       	push   $0x80261d
+  800b95:	e8 93 0e 00 00       	call   801a2d <cprintf>
+		return -E_INVAL;
+  800b9a:	83 c4 10             	add    $0x10,%esp
+  800b9d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ba2:	eb d8                	jmp    800b7c <read+0x58>
+		return -E_NOT_SUPP;
+  800ba4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800ba9:	eb d1                	jmp    800b7c <read+0x58>
+
+00800bab <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  800bab:	55                   	push   %ebp
+  800bac:	89 e5                	mov    %esp,%ebp
+  800bae:	57                   	push   %edi
+  800baf:	56                   	push   %esi
+  800bb0:	53                   	push   %ebx
+  800bb1:	83 ec 0c             	sub    $0xc,%esp
+  800bb4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800bb7:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  800bba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800bbf:	eb 02                	jmp    800bc3 <readn+0x18>
+  800bc1:	01 c3                	add    %eax,%ebx
+  800bc3:	39 f3                	cmp    %esi,%ebx
+  800bc5:	73 21                	jae    800be8 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800bc7:	83 ec 04             	sub    $0x4,%esp
+  800bca:	89 f0                	mov    %esi,%eax
+  800bcc:	29 d8                	sub    %ebx,%eax
+  800bce:	50                   	push   %eax
+  800bcf:	89 d8                	mov    %ebx,%eax
+  800bd1:	03 45 0c             	add    0xc(%ebp),%eax
+  800bd4:	50                   	push   %eax
+  800bd5:	57                   	push   %edi
+  800bd6:	e8 49 ff ff ff       	call   800b24 <read>
+		if (m < 0)
+  800bdb:	83 c4 10             	add    $0x10,%esp
+  800bde:	85 c0                	test   %eax,%eax
+  800be0:	78 04                	js     800be6 <readn+0x3b>
+			return m;
+		if (m == 0)
+  800be2:	75 dd                	jne    800bc1 <readn+0x16>
+  800be4:	eb 02                	jmp    800be8 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800be6:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  800be8:	89 d8                	mov    %ebx,%eax
+  800bea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bed:	5b                   	pop    %ebx
+  800bee:	5e                   	pop    %esi
+  800bef:	5f                   	pop    %edi
+  800bf0:	5d                   	pop    %ebp
+  800bf1:	c3                   	ret
+
+00800bf2 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  800bf2:	55                   	push   %ebp
+  800bf3:	89 e5                	mov    %esp,%ebp
+  800bf5:	56                   	push   %esi
+  800bf6:	53                   	push   %ebx
+  800bf7:	83 ec 18             	sub    $0x18,%esp
+  800bfa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800bfd:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800c00:	50                   	push   %eax
+  800c01:	53                   	push   %ebx
+  800c02:	e8 b7 fc ff ff       	call   8008be <fd_lookup>
+  800c07:	83 c4 10             	add    $0x10,%esp
+  800c0a:	85 c0                	test   %eax,%eax
+  800c0c:	78 37                	js     800c45 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800c0e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800c11:	83 ec 08             	sub    $0x8,%esp
+  800c14:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800c17:	50                   	push   %eax
+  800c18:	ff 36                	push   (%esi)
+  800c1a:	e8 ef fc ff ff       	call   80090e <dev_lookup>
+  800c1f:	83 c4 10             	add    $0x10,%esp
+  800c22:	85 c0                	test   %eax,%eax
+  800c24:	78 1f                	js     800c45 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800c26:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800c2a:	74 20                	je     800c4c <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  800c2c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800c2f:	8b 40 0c             	mov    0xc(%eax),%eax
+  800c32:	85 c0                	test   %eax,%eax
+  800c34:	74 37                	je     800c6d <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  800c36:	83 ec 04             	sub    $0x4,%esp
+  800c39:	ff 75 10             	push   0x10(%ebp)
+  800c3c:	ff 75 0c             	push   0xc(%ebp)
+  800c3f:	56                   	push   %esi
+  800c40:	ff d0                	call   *%eax
+  800c42:	83 c4 10             	add    $0x10,%esp
+}
+  800c45:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c48:	5b                   	pop    %ebx
+  800c49:	5e                   	pop    %esi
+  800c4a:	5d                   	pop    %ebp
+  800c4b:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800c4c:	a1 08 40 80 00       	mov    0x804008,%eax
+  800c51:	8b 40 48             	mov    0x48(%eax),%eax
+  800c54:	83 ec 04             	sub    $0x4,%esp
+  800c57:	53                   	push   %ebx
+  800c58:	50                   	push   %eax
+  800c59:	68 39 26 80 00       	push   $0x802639
+  800c5e:	e8 ca 0d 00 00       	call   801a2d <cprintf>
+		return -E_INVAL;
+  800c63:	83 c4 10             	add    $0x10,%esp
+  800c66:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c6b:	eb d8                	jmp    800c45 <write+0x53>
+		return -E_NOT_SUPP;
+  800c6d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800c72:	eb d1                	jmp    800c45 <write+0x53>
+
+00800c74 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  800c74:	55                   	push   %ebp
+  800c75:	89 e5                	mov    %esp,%ebp
+  800c77:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800c7a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800c7d:	50                   	push   %eax
+  800c7e:	ff 75 08             	push   0x8(%ebp)
+  800c81:	e8 38 fc ff ff       	call   8008be <fd_lookup>
+  800c86:	83 c4 10             	add    $0x10,%esp
+  800c89:	85 c0                	test   %eax,%eax
+  800c8b:	78 0e                	js     800c9b <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  800c8d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c90:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800c93:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  800c96:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c9b:	c9                   	leave
+  800c9c:	c3                   	ret
+
+00800c9d <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800c9d:	55                   	push   %ebp
+  800c9e:	89 e5                	mov    %esp,%ebp
+  800ca0:	56                   	push   %esi
+  800ca1:	53                   	push   %ebx
+  800ca2:	83 ec 18             	sub    $0x18,%esp
+  800ca5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800ca8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800cab:	50                   	push   %eax
+  800cac:	53                   	push   %ebx
+  800cad:	e8 0c fc ff ff       	call   8008be <fd_lookup>
+  800cb2:	83 c4 10             	add    $0x10,%esp
+  800cb5:	85 c0                	test   %eax,%eax
+  800cb7:	78 34                	js     800ced <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800cb9:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800cbc:	83 ec 08             	sub    $0x8,%esp
+  800cbf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800cc2:	50                   	push   %eax
+  800cc3:	ff 36                	push   (%esi)
+  800cc5:	e8 44 fc ff ff       	call   80090e <dev_lookup>
+  800cca:	83 c4 10             	add    $0x10,%esp
+  800ccd:	85 c0                	test   %eax,%eax
+  800ccf:	78 1c                	js     800ced <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800cd1:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800cd5:	74 1d                	je     800cf4 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  800cd7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800cda:	8b 40 18             	mov    0x18(%eax),%eax
+  800cdd:	85 c0                	test   %eax,%eax
+  800cdf:	74 34                	je     800d15 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  800ce1:	83 ec 08             	sub    $0x8,%esp
+  800ce4:	ff 75 0c             	push   0xc(%ebp)
+  800ce7:	56                   	push   %esi
+  800ce8:	ff d0                	call   *%eax
+  800cea:	83 c4 10             	add    $0x10,%esp
+}
+  800ced:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800cf0:	5b                   	pop    %ebx
+  800cf1:	5e                   	pop    %esi
+  800cf2:	5d                   	pop    %ebp
+  800cf3:	c3                   	ret
+			thisenv->env_id, fdnum);
+  800cf4:	a1 08 40 80 00       	mov    0x804008,%eax
+  800cf9:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800cfc:	83 ec 04             	sub    $0x4,%esp
+  800cff:	53                   	push   %ebx
+  800d00:	50                   	push   %eax
+  800d01:	68 fc 25 80 00       	push   $0x8025fc
+  800d06:	e8 22 0d 00 00       	call   801a2d <cprintf>
+		return -E_INVAL;
+  800d0b:	83 c4 10             	add    $0x10,%esp
+  800d0e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d13:	eb d8                	jmp    800ced <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  800d15:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800d1a:	eb d1                	jmp    800ced <ftruncate+0x50>
+
+00800d1c <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800d1c:	55                   	push   %ebp
+  800d1d:	89 e5                	mov    %esp,%ebp
+  800d1f:	56                   	push   %esi
+  800d20:	53                   	push   %ebx
+  800d21:	83 ec 18             	sub    $0x18,%esp
+  800d24:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800d27:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800d2a:	50                   	push   %eax
+  800d2b:	ff 75 08             	push   0x8(%ebp)
+  800d2e:	e8 8b fb ff ff       	call   8008be <fd_lookup>
+  800d33:	83 c4 10             	add    $0x10,%esp
+  800d36:	85 c0                	test   %eax,%eax
+  800d38:	78 49                	js     800d83 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800d3a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800d3d:	83 ec 08             	sub    $0x8,%esp
+  800d40:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800d43:	50                   	push   %eax
+  800d44:	ff 36                	push   (%esi)
+  800d46:	e8 c3 fb ff ff       	call   80090e <dev_lookup>
+  800d4b:	83 c4 10             	add    $0x10,%esp
+  800d4e:	85 c0                	test   %eax,%eax
+  800d50:	78 31                	js     800d83 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  800d52:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800d55:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800d59:	74 2f                	je     800d8a <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  800d5b:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  800d5e:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800d65:	00 00 00 
+	stat->st_isdir = 0;
+  800d68:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800d6f:	00 00 00 
+	stat->st_dev = dev;
+  800d72:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  800d78:	83 ec 08             	sub    $0x8,%esp
+  800d7b:	53                   	push   %ebx
+  800d7c:	56                   	push   %esi
+  800d7d:	ff 50 14             	call   *0x14(%eax)
+  800d80:	83 c4 10             	add    $0x10,%esp
+}
+  800d83:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d86:	5b                   	pop    %ebx
+  800d87:	5e                   	pop    %esi
+  800d88:	5d                   	pop    %ebp
+  800d89:	c3                   	ret
+		return -E_NOT_SUPP;
+  800d8a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800d8f:	eb f2                	jmp    800d83 <fstat+0x67>
+
+00800d91 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  800d91:	55                   	push   %ebp
+  800d92:	89 e5                	mov    %esp,%ebp
+  800d94:	56                   	push   %esi
+  800d95:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  800d96:	83 ec 08             	sub    $0x8,%esp
+  800d99:	6a 00                	push   $0x0
+  800d9b:	ff 75 08             	push   0x8(%ebp)
+  800d9e:	e8 e4 01 00 00       	call   800f87 <open>
+  800da3:	89 c3                	mov    %eax,%ebx
+  800da5:	83 c4 10             	add    $0x10,%esp
+  800da8:	85 c0                	test   %eax,%eax
+  800daa:	78 1b                	js     800dc7 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  800dac:	83 ec 08             	sub    $0x8,%esp
+  800daf:	ff 75 0c             	push   0xc(%ebp)
+  800db2:	50                   	push   %eax
+  800db3:	e8 64 ff ff ff       	call   800d1c <fstat>
+  800db8:	89 c6                	mov    %eax,%esi
+	close(fd);
+  800dba:	89 1c 24             	mov    %ebx,(%esp)
+  800dbd:	e8 26 fc ff ff       	call   8009e8 <close>
+	return r;
+  800dc2:	83 c4 10             	add    $0x10,%esp
+  800dc5:	89 f3                	mov    %esi,%ebx
+}
+  800dc7:	89 d8                	mov    %ebx,%eax
+  800dc9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800dcc:	5b                   	pop    %ebx
+  800dcd:	5e                   	pop    %esi
+  800dce:	5d                   	pop    %ebp
+  800dcf:	c3                   	ret
+
+00800dd0 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  800dd0:	55                   	push   %ebp
+  800dd1:	89 e5                	mov    %esp,%ebp
+  800dd3:	56                   	push   %esi
+  800dd4:	53                   	push   %ebx
+  800dd5:	89 c6                	mov    %eax,%esi
+  800dd7:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  800dd9:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  800de0:	74 27                	je     800e09 <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800de2:	6a 07                	push   $0x7
+  800de4:	68 00 50 80 00       	push   $0x805000
+  800de9:	56                   	push   %esi
+  800dea:	ff 35 00 40 80 00    	push   0x804000
+  800df0:	e8 2a 12 00 00       	call   80201f <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  800df5:	83 c4 0c             	add    $0xc,%esp
+  800df8:	6a 00                	push   $0x0
+  800dfa:	53                   	push   %ebx
+  800dfb:	6a 00                	push   $0x0
+  800dfd:	e8 a9 11 00 00       	call   801fab <ipc_recv>
+}
+  800e02:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e05:	5b                   	pop    %ebx
+  800e06:	5e                   	pop    %esi
+  800e07:	5d                   	pop    %ebp
+  800e08:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  800e09:	83 ec 0c             	sub    $0xc,%esp
+  800e0c:	6a 01                	push   $0x1
+  800e0e:	e8 60 12 00 00       	call   802073 <ipc_find_env>
+  800e13:	a3 00 40 80 00       	mov    %eax,0x804000
+  800e18:	83 c4 10             	add    $0x10,%esp
+  800e1b:	eb c5                	jmp    800de2 <fsipc+0x12>
+
+00800e1d <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  800e1d:	55                   	push   %ebp
+  800e1e:	89 e5                	mov    %esp,%ebp
+  800e20:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800e23:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e26:	8b 40 0c             	mov    0xc(%eax),%eax
+  800e29:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.set_size.req_size = newsize;
+  800e2e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e31:	a3 04 50 80 00       	mov    %eax,0x805004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  800e36:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e3b:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e40:	e8 8b ff ff ff       	call   800dd0 <fsipc>
+}
+  800e45:	c9                   	leave
+  800e46:	c3                   	ret
+
+00800e47 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  800e47:	55                   	push   %ebp
+  800e48:	89 e5                	mov    %esp,%ebp
+  800e4a:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800e4d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e50:	8b 40 0c             	mov    0xc(%eax),%eax
+  800e53:	a3 00 50 80 00       	mov    %eax,0x805000
+  return fsipc(FSREQ_FLUSH, NULL);
+  800e58:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e5d:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e62:	e8 69 ff ff ff       	call   800dd0 <fsipc>
+}
+  800e67:	c9                   	leave
+  800e68:	c3                   	ret
+
+00800e69 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  800e69:	55                   	push   %ebp
+  800e6a:	89 e5                	mov    %esp,%ebp
+  800e6c:	53                   	push   %ebx
+  800e6d:	83 ec 04             	sub    $0x4,%esp
+  800e70:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800e73:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e76:	8b 40 0c             	mov    0xc(%eax),%eax
+  800e79:	a3 00 50 80 00       	mov    %eax,0x805000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  800e7e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e83:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e88:	e8 43 ff ff ff       	call   800dd0 <fsipc>
+  800e8d:	85 c0                	test   %eax,%eax
+  800e8f:	78 2c                	js     800ebd <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800e91:	83 ec 08             	sub    $0x8,%esp
+  800e94:	68 00 50 80 00       	push   $0x805000
+  800e99:	53                   	push   %ebx
+  800e9a:	e8 e3 f2 ff ff       	call   800182 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  800e9f:	a1 80 50 80 00       	mov    0x805080,%eax
+  800ea4:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800eaa:	a1 84 50 80 00       	mov    0x805084,%eax
+  800eaf:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  800eb5:	83 c4 10             	add    $0x10,%esp
+  800eb8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ebd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ec0:	c9                   	leave
+  800ec1:	c3                   	ret
+
+00800ec2 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  800ec2:	55                   	push   %ebp
+  800ec3:	89 e5                	mov    %esp,%ebp
+  800ec5:	83 ec 0c             	sub    $0xc,%esp
+  800ec8:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800ecb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ece:	8b 52 0c             	mov    0xc(%edx),%edx
+  800ed1:	89 15 00 50 80 00    	mov    %edx,0x805000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  800ed7:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  800edc:	39 d0                	cmp    %edx,%eax
+  800ede:	0f 47 c2             	cmova  %edx,%eax
+  800ee1:	a3 04 50 80 00       	mov    %eax,0x805004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  800ee6:	50                   	push   %eax
+  800ee7:	ff 75 0c             	push   0xc(%ebp)
+  800eea:	68 08 50 80 00       	push   $0x805008
+  800eef:	e8 14 f4 ff ff       	call   800308 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  800ef4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ef9:	b8 04 00 00 00       	mov    $0x4,%eax
+  800efe:	e8 cd fe ff ff       	call   800dd0 <fsipc>
+}
+  800f03:	c9                   	leave
+  800f04:	c3                   	ret
+
+00800f05 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  800f05:	55                   	push   %ebp
+  800f06:	89 e5                	mov    %esp,%ebp
+  800f08:	56                   	push   %esi
+  800f09:	53                   	push   %ebx
+  800f0a:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800f0d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f10:	8b 40 0c             	mov    0xc(%eax),%eax
+  800f13:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.read.req_n = n;
+  800f18:	89 35 04 50 80 00    	mov    %esi,0x805004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  800f1e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f23:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f28:	e8 a3 fe ff ff       	call   800dd0 <fsipc>
+  800f2d:	89 c3                	mov    %eax,%ebx
+  800f2f:	85 c0                	test   %eax,%eax
+  800f31:	78 1f                	js     800f52 <devfile_read+0x4d>
+  assert(r <= n);
+  800f33:	39 c6                	cmp    %eax,%esi
+  800f35:	72 24                	jb     800f5b <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  800f37:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800f3c:	7f 33                	jg     800f71 <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  800f3e:	83 ec 04             	sub    $0x4,%esp
+  800f41:	50                   	push   %eax
+  800f42:	68 00 50 80 00       	push   $0x805000
+  800f47:	ff 75 0c             	push   0xc(%ebp)
+  800f4a:	e8 b9 f3 ff ff       	call   800308 <memmove>
+  return r;
+  800f4f:	83 c4 10             	add    $0x10,%esp
+}
+  800f52:	89 d8                	mov    %ebx,%eax
+  800f54:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f57:	5b                   	pop    %ebx
+  800f58:	5e                   	pop    %esi
+  800f59:	5d                   	pop    %ebp
+  800f5a:	c3                   	ret
+  assert(r <= n);
+  800f5b:	68 6c 26 80 00       	push   $0x80266c
+  800f60:	68 73 26 80 00       	push   $0x802673
+  800f65:	6a 78                	push   $0x78
+  800f67:	68 88 26 80 00       	push   $0x802688
+  800f6c:	e8 e1 09 00 00       	call   801952 <_panic>
+  assert(r <= PGSIZE);
+  800f71:	68 93 26 80 00       	push   $0x802693
+  800f76:	68 73 26 80 00       	push   $0x802673
+  800f7b:	6a 79                	push   $0x79
+  800f7d:	68 88 26 80 00       	push   $0x802688
+  800f82:	e8 cb 09 00 00       	call   801952 <_panic>
+
+00800f87 <open>:
+open(const char *path, int mode) {
+  800f87:	55                   	push   %ebp
+  800f88:	89 e5                	mov    %esp,%ebp
+  800f8a:	56                   	push   %esi
+  800f8b:	53                   	push   %ebx
+  800f8c:	83 ec 1c             	sub    $0x1c,%esp
+  800f8f:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  800f92:	56                   	push   %esi
+  800f93:	e8 af f1 ff ff       	call   800147 <strlen>
+  800f98:	83 c4 10             	add    $0x10,%esp
+  800f9b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800fa0:	7f 6c                	jg     80100e <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  800fa2:	83 ec 0c             	sub    $0xc,%esp
+  800fa5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800fa8:	50                   	push   %eax
+  800fa9:	e8 ba f8 ff ff       	call   800868 <fd_alloc>
+  800fae:	89 c3                	mov    %eax,%ebx
+  800fb0:	83 c4 10             	add    $0x10,%esp
+  800fb3:	85 c0                	test   %eax,%eax
+  800fb5:	78 3c                	js     800ff3 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  800fb7:	83 ec 08             	sub    $0x8,%esp
+  800fba:	56                   	push   %esi
+  800fbb:	68 00 50 80 00       	push   $0x805000
+  800fc0:	e8 bd f1 ff ff       	call   800182 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  800fc5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800fc8:	a3 00 54 80 00       	mov    %eax,0x805400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  800fcd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  800fd0:	b8 01 00 00 00       	mov    $0x1,%eax
+  800fd5:	e8 f6 fd ff ff       	call   800dd0 <fsipc>
+  800fda:	89 c3                	mov    %eax,%ebx
+  800fdc:	83 c4 10             	add    $0x10,%esp
+  800fdf:	85 c0                	test   %eax,%eax
+  800fe1:	78 19                	js     800ffc <open+0x75>
+  return fd2num(fd);
+  800fe3:	83 ec 0c             	sub    $0xc,%esp
+  800fe6:	ff 75 f4             	push   -0xc(%ebp)
+  800fe9:	e8 53 f8 ff ff       	call   800841 <fd2num>
+  800fee:	89 c3                	mov    %eax,%ebx
+  800ff0:	83 c4 10             	add    $0x10,%esp
+}
+  800ff3:	89 d8                	mov    %ebx,%eax
+  800ff5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ff8:	5b                   	pop    %ebx
+  800ff9:	5e                   	pop    %esi
+  800ffa:	5d                   	pop    %ebp
+  800ffb:	c3                   	ret
+    fd_close(fd, 0);
+  800ffc:	83 ec 08             	sub    $0x8,%esp
+  800fff:	6a 00                	push   $0x0
+  801001:	ff 75 f4             	push   -0xc(%ebp)
+  801004:	e8 58 f9 ff ff       	call   800961 <fd_close>
+    return r;
+  801009:	83 c4 10             	add    $0x10,%esp
+  80100c:	eb e5                	jmp    800ff3 <open+0x6c>
+    return -E_BAD_PATH;
+  80100e:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801013:	eb de                	jmp    800ff3 <open+0x6c>
+
+00801015 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  801015:	55                   	push   %ebp
+  801016:	89 e5                	mov    %esp,%ebp
+  801018:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  80101b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801020:	b8 08 00 00 00       	mov    $0x8,%eax
+  801025:	e8 a6 fd ff ff       	call   800dd0 <fsipc>
+}
+  80102a:	c9                   	leave
+  80102b:	c3                   	ret
+
+0080102c <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80102c:	55                   	push   %ebp
+  80102d:	89 e5                	mov    %esp,%ebp
+  80102f:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801032:	68 9f 26 80 00       	push   $0x80269f
+  801037:	ff 75 0c             	push   0xc(%ebp)
+  80103a:	e8 43 f1 ff ff       	call   800182 <strcpy>
+	return 0;
+}
+  80103f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801044:	c9                   	leave
+  801045:	c3                   	ret
+
+00801046 <devsock_close>:
+{
+  801046:	55                   	push   %ebp
+  801047:	89 e5                	mov    %esp,%ebp
+  801049:	53                   	push   %ebx
+  80104a:	83 ec 10             	sub    $0x10,%esp
+  80104d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801050:	53                   	push   %ebx
+  801051:	e8 5c 10 00 00       	call   8020b2 <pageref>
+  801056:	89 c2                	mov    %eax,%edx
+  801058:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80105b:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801060:	83 fa 01             	cmp    $0x1,%edx
+  801063:	74 05                	je     80106a <devsock_close+0x24>
+}
+  801065:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801068:	c9                   	leave
+  801069:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  80106a:	83 ec 0c             	sub    $0xc,%esp
+  80106d:	ff 73 0c             	push   0xc(%ebx)
+  801070:	e8 b7 02 00 00       	call   80132c <nsipc_close>
+  801075:	83 c4 10             	add    $0x10,%esp
+  801078:	eb eb                	jmp    801065 <devsock_close+0x1f>
+
+0080107a <devsock_write>:
+{
+  80107a:	55                   	push   %ebp
+  80107b:	89 e5                	mov    %esp,%ebp
+  80107d:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801080:	6a 00                	push   $0x0
+  801082:	ff 75 10             	push   0x10(%ebp)
+  801085:	ff 75 0c             	push   0xc(%ebp)
+  801088:	8b 45 08             	mov    0x8(%ebp),%eax
+  80108b:	ff 70 0c             	push   0xc(%eax)
+  80108e:	e8 79 03 00 00       	call   80140c <nsipc_send>
+}
+  801093:	c9                   	leave
+  801094:	c3                   	ret
+
+00801095 <devsock_read>:
+{
+  801095:	55                   	push   %ebp
+  801096:	89 e5                	mov    %esp,%ebp
+  801098:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  80109b:	6a 00                	push   $0x0
+  80109d:	ff 75 10             	push   0x10(%ebp)
+  8010a0:	ff 75 0c             	push   0xc(%ebp)
+  8010a3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010a6:	ff 70 0c             	push   0xc(%eax)
+  8010a9:	e8 ef 02 00 00       	call   80139d <nsipc_recv>
+}
+  8010ae:	c9                   	leave
+  8010af:	c3                   	ret
+
+008010b0 <fd2sockid>:
+{
+  8010b0:	55                   	push   %ebp
+  8010b1:	89 e5                	mov    %esp,%ebp
+  8010b3:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8010b6:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8010b9:	52                   	push   %edx
+  8010ba:	50                   	push   %eax
+  8010bb:	e8 fe f7 ff ff       	call   8008be <fd_lookup>
+  8010c0:	83 c4 10             	add    $0x10,%esp
+  8010c3:	85 c0                	test   %eax,%eax
+  8010c5:	78 10                	js     8010d7 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8010c7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8010ca:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  8010d0:	39 08                	cmp    %ecx,(%eax)
+  8010d2:	75 05                	jne    8010d9 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8010d4:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8010d7:	c9                   	leave
+  8010d8:	c3                   	ret
+		return -E_NOT_SUPP;
+  8010d9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8010de:	eb f7                	jmp    8010d7 <fd2sockid+0x27>
+
+008010e0 <alloc_sockfd>:
+{
+  8010e0:	55                   	push   %ebp
+  8010e1:	89 e5                	mov    %esp,%ebp
+  8010e3:	56                   	push   %esi
+  8010e4:	53                   	push   %ebx
+  8010e5:	83 ec 1c             	sub    $0x1c,%esp
+  8010e8:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8010ea:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8010ed:	50                   	push   %eax
+  8010ee:	e8 75 f7 ff ff       	call   800868 <fd_alloc>
+  8010f3:	89 c3                	mov    %eax,%ebx
+  8010f5:	83 c4 10             	add    $0x10,%esp
+  8010f8:	85 c0                	test   %eax,%eax
+  8010fa:	78 43                	js     80113f <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8010fc:	83 ec 04             	sub    $0x4,%esp
+  8010ff:	68 07 04 00 00       	push   $0x407
+  801104:	ff 75 f4             	push   -0xc(%ebp)
+  801107:	6a 00                	push   $0x0
+  801109:	e8 60 f4 ff ff       	call   80056e <sys_page_alloc>
+  80110e:	89 c3                	mov    %eax,%ebx
+  801110:	83 c4 10             	add    $0x10,%esp
+  801113:	85 c0                	test   %eax,%eax
+  801115:	78 28                	js     80113f <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801117:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80111a:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  801120:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801122:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801125:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  80112c:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  80112f:	83 ec 0c             	sub    $0xc,%esp
+  801132:	50                   	push   %eax
+  801133:	e8 09 f7 ff ff       	call   800841 <fd2num>
+  801138:	89 c3                	mov    %eax,%ebx
+  80113a:	83 c4 10             	add    $0x10,%esp
+  80113d:	eb 0c                	jmp    80114b <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  80113f:	83 ec 0c             	sub    $0xc,%esp
+  801142:	56                   	push   %esi
+  801143:	e8 e4 01 00 00       	call   80132c <nsipc_close>
+		return r;
+  801148:	83 c4 10             	add    $0x10,%esp
+}
+  80114b:	89 d8                	mov    %ebx,%eax
+  80114d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801150:	5b                   	pop    %ebx
+  801151:	5e                   	pop    %esi
+  801152:	5d                   	pop    %ebp
+  801153:	c3                   	ret
+
+00801154 <accept>:
+{
+  801154:	55                   	push   %ebp
+  801155:	89 e5                	mov    %esp,%ebp
+  801157:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80115a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80115d:	e8 4e ff ff ff       	call   8010b0 <fd2sockid>
+  801162:	85 c0                	test   %eax,%eax
+  801164:	78 1b                	js     801181 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801166:	83 ec 04             	sub    $0x4,%esp
+  801169:	ff 75 10             	push   0x10(%ebp)
+  80116c:	ff 75 0c             	push   0xc(%ebp)
+  80116f:	50                   	push   %eax
+  801170:	e8 0e 01 00 00       	call   801283 <nsipc_accept>
+  801175:	83 c4 10             	add    $0x10,%esp
+  801178:	85 c0                	test   %eax,%eax
+  80117a:	78 05                	js     801181 <accept+0x2d>
+	return alloc_sockfd(r);
+  80117c:	e8 5f ff ff ff       	call   8010e0 <alloc_sockfd>
+}
+  801181:	c9                   	leave
+  801182:	c3                   	ret
+
+00801183 <bind>:
+{
+  801183:	55                   	push   %ebp
+  801184:	89 e5                	mov    %esp,%ebp
+  801186:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801189:	8b 45 08             	mov    0x8(%ebp),%eax
+  80118c:	e8 1f ff ff ff       	call   8010b0 <fd2sockid>
+  801191:	85 c0                	test   %eax,%eax
+  801193:	78 12                	js     8011a7 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801195:	83 ec 04             	sub    $0x4,%esp
+  801198:	ff 75 10             	push   0x10(%ebp)
+  80119b:	ff 75 0c             	push   0xc(%ebp)
+  80119e:	50                   	push   %eax
+  80119f:	e8 31 01 00 00       	call   8012d5 <nsipc_bind>
+  8011a4:	83 c4 10             	add    $0x10,%esp
+}
+  8011a7:	c9                   	leave
+  8011a8:	c3                   	ret
+
+008011a9 <shutdown>:
+{
+  8011a9:	55                   	push   %ebp
+  8011aa:	89 e5                	mov    %esp,%ebp
+  8011ac:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8011af:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011b2:	e8 f9 fe ff ff       	call   8010b0 <fd2sockid>
+  8011b7:	85 c0                	test   %eax,%eax
+  8011b9:	78 0f                	js     8011ca <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8011bb:	83 ec 08             	sub    $0x8,%esp
+  8011be:	ff 75 0c             	push   0xc(%ebp)
+  8011c1:	50                   	push   %eax
+  8011c2:	e8 43 01 00 00       	call   80130a <nsipc_shutdown>
+  8011c7:	83 c4 10             	add    $0x10,%esp
+}
+  8011ca:	c9                   	leave
+  8011cb:	c3                   	ret
+
+008011cc <connect>:
+{
+  8011cc:	55                   	push   %ebp
+  8011cd:	89 e5                	mov    %esp,%ebp
+  8011cf:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8011d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011d5:	e8 d6 fe ff ff       	call   8010b0 <fd2sockid>
+  8011da:	85 c0                	test   %eax,%eax
+  8011dc:	78 12                	js     8011f0 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8011de:	83 ec 04             	sub    $0x4,%esp
+  8011e1:	ff 75 10             	push   0x10(%ebp)
+  8011e4:	ff 75 0c             	push   0xc(%ebp)
+  8011e7:	50                   	push   %eax
+  8011e8:	e8 59 01 00 00       	call   801346 <nsipc_connect>
+  8011ed:	83 c4 10             	add    $0x10,%esp
+}
+  8011f0:	c9                   	leave
+  8011f1:	c3                   	ret
+
+008011f2 <listen>:
+{
+  8011f2:	55                   	push   %ebp
+  8011f3:	89 e5                	mov    %esp,%ebp
+  8011f5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8011f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011fb:	e8 b0 fe ff ff       	call   8010b0 <fd2sockid>
+  801200:	85 c0                	test   %eax,%eax
+  801202:	78 0f                	js     801213 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801204:	83 ec 08             	sub    $0x8,%esp
+  801207:	ff 75 0c             	push   0xc(%ebp)
+  80120a:	50                   	push   %eax
+  80120b:	e8 6b 01 00 00       	call   80137b <nsipc_listen>
+  801210:	83 c4 10             	add    $0x10,%esp
+}
+  801213:	c9                   	leave
+  801214:	c3                   	ret
+
+00801215 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801215:	55                   	push   %ebp
+  801216:	89 e5                	mov    %esp,%ebp
+  801218:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  80121b:	ff 75 10             	push   0x10(%ebp)
+  80121e:	ff 75 0c             	push   0xc(%ebp)
+  801221:	ff 75 08             	push   0x8(%ebp)
+  801224:	e8 41 02 00 00       	call   80146a <nsipc_socket>
+  801229:	83 c4 10             	add    $0x10,%esp
+  80122c:	85 c0                	test   %eax,%eax
+  80122e:	78 05                	js     801235 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801230:	e8 ab fe ff ff       	call   8010e0 <alloc_sockfd>
+}
+  801235:	c9                   	leave
+  801236:	c3                   	ret
+
+00801237 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801237:	55                   	push   %ebp
+  801238:	89 e5                	mov    %esp,%ebp
+  80123a:	53                   	push   %ebx
+  80123b:	83 ec 04             	sub    $0x4,%esp
+  80123e:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801240:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801247:	74 26                	je     80126f <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801249:	6a 07                	push   $0x7
+  80124b:	68 00 60 80 00       	push   $0x806000
+  801250:	53                   	push   %ebx
+  801251:	ff 35 04 40 80 00    	push   0x804004
+  801257:	e8 c3 0d 00 00       	call   80201f <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  80125c:	83 c4 0c             	add    $0xc,%esp
+  80125f:	6a 00                	push   $0x0
+  801261:	6a 00                	push   $0x0
+  801263:	6a 00                	push   $0x0
+  801265:	e8 41 0d 00 00       	call   801fab <ipc_recv>
+}
+  80126a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80126d:	c9                   	leave
+  80126e:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80126f:	83 ec 0c             	sub    $0xc,%esp
+  801272:	6a 02                	push   $0x2
+  801274:	e8 fa 0d 00 00       	call   802073 <ipc_find_env>
+  801279:	a3 04 40 80 00       	mov    %eax,0x804004
+  80127e:	83 c4 10             	add    $0x10,%esp
+  801281:	eb c6                	jmp    801249 <nsipc+0x12>
+
+00801283 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801283:	55                   	push   %ebp
+  801284:	89 e5                	mov    %esp,%ebp
+  801286:	56                   	push   %esi
+  801287:	53                   	push   %ebx
+  801288:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  80128b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80128e:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801293:	8b 06                	mov    (%esi),%eax
+  801295:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  80129a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80129f:	e8 93 ff ff ff       	call   801237 <nsipc>
+  8012a4:	89 c3                	mov    %eax,%ebx
+  8012a6:	85 c0                	test   %eax,%eax
+  8012a8:	79 09                	jns    8012b3 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8012aa:	89 d8                	mov    %ebx,%eax
+  8012ac:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8012af:	5b                   	pop    %ebx
+  8012b0:	5e                   	pop    %esi
+  8012b1:	5d                   	pop    %ebp
+  8012b2:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8012b3:	83 ec 04             	sub    $0x4,%esp
+  8012b6:	ff 35 10 60 80 00    	push   0x806010
+  8012bc:	68 00 60 80 00       	push   $0x806000
+  8012c1:	ff 75 0c             	push   0xc(%ebp)
+  8012c4:	e8 3f f0 ff ff       	call   800308 <memmove>
+		*addrlen = ret->ret_addrlen;
+  8012c9:	a1 10 60 80 00       	mov    0x806010,%eax
+  8012ce:	89 06                	mov    %eax,(%esi)
+  8012d0:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8012d3:	eb d5                	jmp    8012aa <nsipc_accept+0x27>
+
+008012d5 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8012d5:	55                   	push   %ebp
+  8012d6:	89 e5                	mov    %esp,%ebp
+  8012d8:	53                   	push   %ebx
+  8012d9:	83 ec 08             	sub    $0x8,%esp
+  8012dc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8012df:	8b 45 08             	mov    0x8(%ebp),%eax
+  8012e2:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8012e7:	53                   	push   %ebx
+  8012e8:	ff 75 0c             	push   0xc(%ebp)
+  8012eb:	68 04 60 80 00       	push   $0x806004
+  8012f0:	e8 13 f0 ff ff       	call   800308 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8012f5:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  8012fb:	b8 02 00 00 00       	mov    $0x2,%eax
+  801300:	e8 32 ff ff ff       	call   801237 <nsipc>
+}
+  801305:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801308:	c9                   	leave
+  801309:	c3                   	ret
+
+0080130a <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  80130a:	55                   	push   %ebp
+  80130b:	89 e5                	mov    %esp,%ebp
+  80130d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801310:	8b 45 08             	mov    0x8(%ebp),%eax
+  801313:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  801318:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80131b:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  801320:	b8 03 00 00 00       	mov    $0x3,%eax
+  801325:	e8 0d ff ff ff       	call   801237 <nsipc>
+}
+  80132a:	c9                   	leave
+  80132b:	c3                   	ret
+
+0080132c <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  80132c:	55                   	push   %ebp
+  80132d:	89 e5                	mov    %esp,%ebp
+  80132f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801332:	8b 45 08             	mov    0x8(%ebp),%eax
+  801335:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  80133a:	b8 04 00 00 00       	mov    $0x4,%eax
+  80133f:	e8 f3 fe ff ff       	call   801237 <nsipc>
+}
+  801344:	c9                   	leave
+  801345:	c3                   	ret
+
+00801346 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801346:	55                   	push   %ebp
+  801347:	89 e5                	mov    %esp,%ebp
+  801349:	53                   	push   %ebx
+  80134a:	83 ec 08             	sub    $0x8,%esp
+  80134d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801350:	8b 45 08             	mov    0x8(%ebp),%eax
+  801353:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801358:	53                   	push   %ebx
+  801359:	ff 75 0c             	push   0xc(%ebp)
+  80135c:	68 04 60 80 00       	push   $0x806004
+  801361:	e8 a2 ef ff ff       	call   800308 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801366:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  80136c:	b8 05 00 00 00       	mov    $0x5,%eax
+  801371:	e8 c1 fe ff ff       	call   801237 <nsipc>
+}
+  801376:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801379:	c9                   	leave
+  80137a:	c3                   	ret
+
+0080137b <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  80137b:	55                   	push   %ebp
+  80137c:	89 e5                	mov    %esp,%ebp
+  80137e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801381:	8b 45 08             	mov    0x8(%ebp),%eax
+  801384:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  801389:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80138c:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  801391:	b8 06 00 00 00       	mov    $0x6,%eax
+  801396:	e8 9c fe ff ff       	call   801237 <nsipc>
+}
+  80139b:	c9                   	leave
+  80139c:	c3                   	ret
+
+0080139d <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  80139d:	55                   	push   %ebp
+  80139e:	89 e5                	mov    %esp,%ebp
+  8013a0:	56                   	push   %esi
+  8013a1:	53                   	push   %ebx
+  8013a2:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8013a5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013a8:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  8013ad:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  8013b3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8013b6:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8013bb:	b8 07 00 00 00       	mov    $0x7,%eax
+  8013c0:	e8 72 fe ff ff       	call   801237 <nsipc>
+  8013c5:	89 c3                	mov    %eax,%ebx
+  8013c7:	85 c0                	test   %eax,%eax
+  8013c9:	78 22                	js     8013ed <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8013cb:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8013d0:	39 c6                	cmp    %eax,%esi
+  8013d2:	0f 4e c6             	cmovle %esi,%eax
+  8013d5:	39 c3                	cmp    %eax,%ebx
+  8013d7:	7f 1d                	jg     8013f6 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8013d9:	83 ec 04             	sub    $0x4,%esp
+  8013dc:	53                   	push   %ebx
+  8013dd:	68 00 60 80 00       	push   $0x806000
+  8013e2:	ff 75 0c             	push   0xc(%ebp)
+  8013e5:	e8 1e ef ff ff       	call   800308 <memmove>
+  8013ea:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8013ed:	89 d8                	mov    %ebx,%eax
+  8013ef:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013f2:	5b                   	pop    %ebx
+  8013f3:	5e                   	pop    %esi
+  8013f4:	5d                   	pop    %ebp
+  8013f5:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8013f6:	68 ab 26 80 00       	push   $0x8026ab
+  8013fb:	68 73 26 80 00       	push   $0x802673
+  801400:	6a 62                	push   $0x62
+  801402:	68 c0 26 80 00       	push   $0x8026c0
+  801407:	e8 46 05 00 00       	call   801952 <_panic>
+
+0080140c <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  80140c:	55                   	push   %ebp
+  80140d:	89 e5                	mov    %esp,%ebp
+  80140f:	53                   	push   %ebx
+  801410:	83 ec 04             	sub    $0x4,%esp
+  801413:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801416:	8b 45 08             	mov    0x8(%ebp),%eax
+  801419:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  80141e:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801424:	7f 2e                	jg     801454 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801426:	83 ec 04             	sub    $0x4,%esp
+  801429:	53                   	push   %ebx
+  80142a:	ff 75 0c             	push   0xc(%ebp)
+  80142d:	68 0c 60 80 00       	push   $0x80600c
+  801432:	e8 d1 ee ff ff       	call   800308 <memmove>
+	nsipcbuf.send.req_size = size;
+  801437:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  80143d:	8b 45 14             	mov    0x14(%ebp),%eax
+  801440:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  801445:	b8 08 00 00 00       	mov    $0x8,%eax
+  80144a:	e8 e8 fd ff ff       	call   801237 <nsipc>
+}
+  80144f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801452:	c9                   	leave
+  801453:	c3                   	ret
+	assert(size < 1600);
+  801454:	68 cc 26 80 00       	push   $0x8026cc
+  801459:	68 73 26 80 00       	push   $0x802673
+  80145e:	6a 6d                	push   $0x6d
+  801460:	68 c0 26 80 00       	push   $0x8026c0
+  801465:	e8 e8 04 00 00       	call   801952 <_panic>
+
+0080146a <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80146a:	55                   	push   %ebp
+  80146b:	89 e5                	mov    %esp,%ebp
+  80146d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801470:	8b 45 08             	mov    0x8(%ebp),%eax
+  801473:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  801478:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80147b:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  801480:	8b 45 10             	mov    0x10(%ebp),%eax
+  801483:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  801488:	b8 09 00 00 00       	mov    $0x9,%eax
+  80148d:	e8 a5 fd ff ff       	call   801237 <nsipc>
+}
+  801492:	c9                   	leave
+  801493:	c3                   	ret
+
+00801494 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801494:	55                   	push   %ebp
+  801495:	89 e5                	mov    %esp,%ebp
+  801497:	56                   	push   %esi
+  801498:	53                   	push   %ebx
+  801499:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80149c:	83 ec 0c             	sub    $0xc,%esp
+  80149f:	ff 75 08             	push   0x8(%ebp)
+  8014a2:	e8 aa f3 ff ff       	call   800851 <fd2data>
+  8014a7:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8014a9:	83 c4 08             	add    $0x8,%esp
+  8014ac:	68 d8 26 80 00       	push   $0x8026d8
+  8014b1:	53                   	push   %ebx
+  8014b2:	e8 cb ec ff ff       	call   800182 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8014b7:	8b 46 04             	mov    0x4(%esi),%eax
+  8014ba:	2b 06                	sub    (%esi),%eax
+  8014bc:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8014c2:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8014c9:	00 00 00 
+	stat->st_dev = &devpipe;
+  8014cc:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  8014d3:	30 80 00 
+	return 0;
+}
+  8014d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014db:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014de:	5b                   	pop    %ebx
+  8014df:	5e                   	pop    %esi
+  8014e0:	5d                   	pop    %ebp
+  8014e1:	c3                   	ret
+
+008014e2 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8014e2:	55                   	push   %ebp
+  8014e3:	89 e5                	mov    %esp,%ebp
+  8014e5:	53                   	push   %ebx
+  8014e6:	83 ec 0c             	sub    $0xc,%esp
+  8014e9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8014ec:	53                   	push   %ebx
+  8014ed:	6a 00                	push   $0x0
+  8014ef:	e8 ff f0 ff ff       	call   8005f3 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8014f4:	89 1c 24             	mov    %ebx,(%esp)
+  8014f7:	e8 55 f3 ff ff       	call   800851 <fd2data>
+  8014fc:	83 c4 08             	add    $0x8,%esp
+  8014ff:	50                   	push   %eax
+  801500:	6a 00                	push   $0x0
+  801502:	e8 ec f0 ff ff       	call   8005f3 <sys_page_unmap>
+}
+  801507:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80150a:	c9                   	leave
+  80150b:	c3                   	ret
+
+0080150c <_pipeisclosed>:
+{
+  80150c:	55                   	push   %ebp
+  80150d:	89 e5                	mov    %esp,%ebp
+  80150f:	57                   	push   %edi
+  801510:	56                   	push   %esi
+  801511:	53                   	push   %ebx
+  801512:	83 ec 1c             	sub    $0x1c,%esp
+  801515:	89 c7                	mov    %eax,%edi
+  801517:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801519:	a1 08 40 80 00       	mov    0x804008,%eax
+  80151e:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801521:	83 ec 0c             	sub    $0xc,%esp
+  801524:	57                   	push   %edi
+  801525:	e8 88 0b 00 00       	call   8020b2 <pageref>
+  80152a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80152d:	89 34 24             	mov    %esi,(%esp)
+  801530:	e8 7d 0b 00 00       	call   8020b2 <pageref>
+		nn = thisenv->env_runs;
+  801535:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  80153b:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  80153e:	83 c4 10             	add    $0x10,%esp
+  801541:	39 cb                	cmp    %ecx,%ebx
+  801543:	74 1b                	je     801560 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801545:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801548:	75 cf                	jne    801519 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80154a:	8b 42 58             	mov    0x58(%edx),%eax
+  80154d:	6a 01                	push   $0x1
+  80154f:	50                   	push   %eax
+  801550:	53                   	push   %ebx
+  801551:	68 df 26 80 00       	push   $0x8026df
+  801556:	e8 d2 04 00 00       	call   801a2d <cprintf>
+  80155b:	83 c4 10             	add    $0x10,%esp
+  80155e:	eb b9                	jmp    801519 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801560:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801563:	0f 94 c0             	sete   %al
+  801566:	0f b6 c0             	movzbl %al,%eax
+}
+  801569:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80156c:	5b                   	pop    %ebx
+  80156d:	5e                   	pop    %esi
+  80156e:	5f                   	pop    %edi
+  80156f:	5d                   	pop    %ebp
+  801570:	c3                   	ret
+
+00801571 <devpipe_write>:
+{
+  801571:	55                   	push   %ebp
+  801572:	89 e5                	mov    %esp,%ebp
+  801574:	57                   	push   %edi
+  801575:	56                   	push   %esi
+  801576:	53                   	push   %ebx
+  801577:	83 ec 28             	sub    $0x28,%esp
+  80157a:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  80157d:	56                   	push   %esi
+  80157e:	e8 ce f2 ff ff       	call   800851 <fd2data>
+  801583:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801585:	83 c4 10             	add    $0x10,%esp
+  801588:	bf 00 00 00 00       	mov    $0x0,%edi
+  80158d:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801590:	75 09                	jne    80159b <devpipe_write+0x2a>
+	return i;
+  801592:	89 f8                	mov    %edi,%eax
+  801594:	eb 23                	jmp    8015b9 <devpipe_write+0x48>
+			sys_yield();
+  801596:	e8 b4 ef ff ff       	call   80054f <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80159b:	8b 43 04             	mov    0x4(%ebx),%eax
+  80159e:	8b 0b                	mov    (%ebx),%ecx
+  8015a0:	8d 51 20             	lea    0x20(%ecx),%edx
+  8015a3:	39 d0                	cmp    %edx,%eax
+  8015a5:	72 1a                	jb     8015c1 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8015a7:	89 da                	mov    %ebx,%edx
+  8015a9:	89 f0                	mov    %esi,%eax
+  8015ab:	e8 5c ff ff ff       	call   80150c <_pipeisclosed>
+  8015b0:	85 c0                	test   %eax,%eax
+  8015b2:	74 e2                	je     801596 <devpipe_write+0x25>
+				return 0;
+  8015b4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015bc:	5b                   	pop    %ebx
+  8015bd:	5e                   	pop    %esi
+  8015be:	5f                   	pop    %edi
+  8015bf:	5d                   	pop    %ebp
+  8015c0:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8015c1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015c4:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8015c8:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8015cb:	89 c2                	mov    %eax,%edx
+  8015cd:	c1 fa 1f             	sar    $0x1f,%edx
+  8015d0:	89 d1                	mov    %edx,%ecx
+  8015d2:	c1 e9 1b             	shr    $0x1b,%ecx
+  8015d5:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8015d8:	83 e2 1f             	and    $0x1f,%edx
+  8015db:	29 ca                	sub    %ecx,%edx
+  8015dd:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8015e1:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8015e5:	83 c0 01             	add    $0x1,%eax
+  8015e8:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8015eb:	83 c7 01             	add    $0x1,%edi
+  8015ee:	eb 9d                	jmp    80158d <devpipe_write+0x1c>
+
+008015f0 <devpipe_read>:
+{
+  8015f0:	55                   	push   %ebp
+  8015f1:	89 e5                	mov    %esp,%ebp
+  8015f3:	57                   	push   %edi
+  8015f4:	56                   	push   %esi
+  8015f5:	53                   	push   %ebx
+  8015f6:	83 ec 18             	sub    $0x18,%esp
+  8015f9:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8015fc:	57                   	push   %edi
+  8015fd:	e8 4f f2 ff ff       	call   800851 <fd2data>
+  801602:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801604:	83 c4 10             	add    $0x10,%esp
+  801607:	be 00 00 00 00       	mov    $0x0,%esi
+  80160c:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80160f:	75 13                	jne    801624 <devpipe_read+0x34>
+	return i;
+  801611:	89 f0                	mov    %esi,%eax
+  801613:	eb 02                	jmp    801617 <devpipe_read+0x27>
+				return i;
+  801615:	89 f0                	mov    %esi,%eax
+}
+  801617:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80161a:	5b                   	pop    %ebx
+  80161b:	5e                   	pop    %esi
+  80161c:	5f                   	pop    %edi
+  80161d:	5d                   	pop    %ebp
+  80161e:	c3                   	ret
+			sys_yield();
+  80161f:	e8 2b ef ff ff       	call   80054f <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  801624:	8b 03                	mov    (%ebx),%eax
+  801626:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801629:	75 18                	jne    801643 <devpipe_read+0x53>
+			if (i > 0)
+  80162b:	85 f6                	test   %esi,%esi
+  80162d:	75 e6                	jne    801615 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  80162f:	89 da                	mov    %ebx,%edx
+  801631:	89 f8                	mov    %edi,%eax
+  801633:	e8 d4 fe ff ff       	call   80150c <_pipeisclosed>
+  801638:	85 c0                	test   %eax,%eax
+  80163a:	74 e3                	je     80161f <devpipe_read+0x2f>
+				return 0;
+  80163c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801641:	eb d4                	jmp    801617 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801643:	99                   	cltd
+  801644:	c1 ea 1b             	shr    $0x1b,%edx
+  801647:	01 d0                	add    %edx,%eax
+  801649:	83 e0 1f             	and    $0x1f,%eax
+  80164c:	29 d0                	sub    %edx,%eax
+  80164e:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801653:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801656:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  801659:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80165c:	83 c6 01             	add    $0x1,%esi
+  80165f:	eb ab                	jmp    80160c <devpipe_read+0x1c>
+
+00801661 <pipe>:
+{
+  801661:	55                   	push   %ebp
+  801662:	89 e5                	mov    %esp,%ebp
+  801664:	56                   	push   %esi
+  801665:	53                   	push   %ebx
+  801666:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801669:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80166c:	50                   	push   %eax
+  80166d:	e8 f6 f1 ff ff       	call   800868 <fd_alloc>
+  801672:	89 c3                	mov    %eax,%ebx
+  801674:	83 c4 10             	add    $0x10,%esp
+  801677:	85 c0                	test   %eax,%eax
+  801679:	0f 88 23 01 00 00    	js     8017a2 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80167f:	83 ec 04             	sub    $0x4,%esp
+  801682:	68 07 04 00 00       	push   $0x407
+  801687:	ff 75 f4             	push   -0xc(%ebp)
+  80168a:	6a 00                	push   $0x0
+  80168c:	e8 dd ee ff ff       	call   80056e <sys_page_alloc>
+  801691:	89 c3                	mov    %eax,%ebx
+  801693:	83 c4 10             	add    $0x10,%esp
+  801696:	85 c0                	test   %eax,%eax
+  801698:	0f 88 04 01 00 00    	js     8017a2 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80169e:	83 ec 0c             	sub    $0xc,%esp
+  8016a1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016a4:	50                   	push   %eax
+  8016a5:	e8 be f1 ff ff       	call   800868 <fd_alloc>
+  8016aa:	89 c3                	mov    %eax,%ebx
+  8016ac:	83 c4 10             	add    $0x10,%esp
+  8016af:	85 c0                	test   %eax,%eax
+  8016b1:	0f 88 db 00 00 00    	js     801792 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8016b7:	83 ec 04             	sub    $0x4,%esp
+  8016ba:	68 07 04 00 00       	push   $0x407
+  8016bf:	ff 75 f0             	push   -0x10(%ebp)
+  8016c2:	6a 00                	push   $0x0
+  8016c4:	e8 a5 ee ff ff       	call   80056e <sys_page_alloc>
+  8016c9:	89 c3                	mov    %eax,%ebx
+  8016cb:	83 c4 10             	add    $0x10,%esp
+  8016ce:	85 c0                	test   %eax,%eax
+  8016d0:	0f 88 bc 00 00 00    	js     801792 <pipe+0x131>
+	va = fd2data(fd0);
+  8016d6:	83 ec 0c             	sub    $0xc,%esp
+  8016d9:	ff 75 f4             	push   -0xc(%ebp)
+  8016dc:	e8 70 f1 ff ff       	call   800851 <fd2data>
+  8016e1:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8016e3:	83 c4 0c             	add    $0xc,%esp
+  8016e6:	68 07 04 00 00       	push   $0x407
+  8016eb:	50                   	push   %eax
+  8016ec:	6a 00                	push   $0x0
+  8016ee:	e8 7b ee ff ff       	call   80056e <sys_page_alloc>
+  8016f3:	89 c3                	mov    %eax,%ebx
+  8016f5:	83 c4 10             	add    $0x10,%esp
+  8016f8:	85 c0                	test   %eax,%eax
+  8016fa:	0f 88 82 00 00 00    	js     801782 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801700:	83 ec 0c             	sub    $0xc,%esp
+  801703:	ff 75 f0             	push   -0x10(%ebp)
+  801706:	e8 46 f1 ff ff       	call   800851 <fd2data>
+  80170b:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801712:	50                   	push   %eax
+  801713:	6a 00                	push   $0x0
+  801715:	56                   	push   %esi
+  801716:	6a 00                	push   $0x0
+  801718:	e8 94 ee ff ff       	call   8005b1 <sys_page_map>
+  80171d:	89 c3                	mov    %eax,%ebx
+  80171f:	83 c4 20             	add    $0x20,%esp
+  801722:	85 c0                	test   %eax,%eax
+  801724:	78 4e                	js     801774 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  801726:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  80172b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80172e:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  801730:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801733:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80173a:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80173d:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80173f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801742:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  801749:	83 ec 0c             	sub    $0xc,%esp
+  80174c:	ff 75 f4             	push   -0xc(%ebp)
+  80174f:	e8 ed f0 ff ff       	call   800841 <fd2num>
+  801754:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801757:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  801759:	83 c4 04             	add    $0x4,%esp
+  80175c:	ff 75 f0             	push   -0x10(%ebp)
+  80175f:	e8 dd f0 ff ff       	call   800841 <fd2num>
+  801764:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801767:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80176a:	83 c4 10             	add    $0x10,%esp
+  80176d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801772:	eb 2e                	jmp    8017a2 <pipe+0x141>
+	sys_page_unmap(0, va);
+  801774:	83 ec 08             	sub    $0x8,%esp
+  801777:	56                   	push   %esi
+  801778:	6a 00                	push   $0x0
+  80177a:	e8 74 ee ff ff       	call   8005f3 <sys_page_unmap>
+  80177f:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  801782:	83 ec 08             	sub    $0x8,%esp
+  801785:	ff 75 f0             	push   -0x10(%ebp)
+  801788:	6a 00                	push   $0x0
+  80178a:	e8 64 ee ff ff       	call   8005f3 <sys_page_unmap>
+  80178f:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  801792:	83 ec 08             	sub    $0x8,%esp
+  801795:	ff 75 f4             	push   -0xc(%ebp)
+  801798:	6a 00                	push   $0x0
+  80179a:	e8 54 ee ff ff       	call   8005f3 <sys_page_unmap>
+  80179f:	83 c4 10             	add    $0x10,%esp
+}
+  8017a2:	89 d8                	mov    %ebx,%eax
+  8017a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017a7:	5b                   	pop    %ebx
+  8017a8:	5e                   	pop    %esi
+  8017a9:	5d                   	pop    %ebp
+  8017aa:	c3                   	ret
+
+008017ab <pipeisclosed>:
+{
+  8017ab:	55                   	push   %ebp
+  8017ac:	89 e5                	mov    %esp,%ebp
+  8017ae:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8017b1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017b4:	50                   	push   %eax
+  8017b5:	ff 75 08             	push   0x8(%ebp)
+  8017b8:	e8 01 f1 ff ff       	call   8008be <fd_lookup>
+  8017bd:	83 c4 10             	add    $0x10,%esp
+  8017c0:	85 c0                	test   %eax,%eax
+  8017c2:	78 18                	js     8017dc <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8017c4:	83 ec 0c             	sub    $0xc,%esp
+  8017c7:	ff 75 f4             	push   -0xc(%ebp)
+  8017ca:	e8 82 f0 ff ff       	call   800851 <fd2data>
+  8017cf:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8017d1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017d4:	e8 33 fd ff ff       	call   80150c <_pipeisclosed>
+  8017d9:	83 c4 10             	add    $0x10,%esp
+}
+  8017dc:	c9                   	leave
+  8017dd:	c3                   	ret
+
+008017de <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8017de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017e3:	c3                   	ret
+
+008017e4 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8017e4:	55                   	push   %ebp
+  8017e5:	89 e5                	mov    %esp,%ebp
+  8017e7:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8017ea:	68 f7 26 80 00       	push   $0x8026f7
+  8017ef:	ff 75 0c             	push   0xc(%ebp)
+  8017f2:	e8 8b e9 ff ff       	call   800182 <strcpy>
+	return 0;
+}
+  8017f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017fc:	c9                   	leave
+  8017fd:	c3                   	ret
+
+008017fe <devcons_write>:
+{
+  8017fe:	55                   	push   %ebp
+  8017ff:	89 e5                	mov    %esp,%ebp
+  801801:	57                   	push   %edi
+  801802:	56                   	push   %esi
+  801803:	53                   	push   %ebx
+  801804:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80180a:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80180f:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  801815:	eb 2e                	jmp    801845 <devcons_write+0x47>
+		m = n - tot;
+  801817:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80181a:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80181c:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801821:	39 c3                	cmp    %eax,%ebx
+  801823:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  801826:	83 ec 04             	sub    $0x4,%esp
+  801829:	53                   	push   %ebx
+  80182a:	89 f0                	mov    %esi,%eax
+  80182c:	03 45 0c             	add    0xc(%ebp),%eax
+  80182f:	50                   	push   %eax
+  801830:	57                   	push   %edi
+  801831:	e8 d2 ea ff ff       	call   800308 <memmove>
+		sys_cputs(buf, m);
+  801836:	83 c4 08             	add    $0x8,%esp
+  801839:	53                   	push   %ebx
+  80183a:	57                   	push   %edi
+  80183b:	e8 72 ec ff ff       	call   8004b2 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  801840:	01 de                	add    %ebx,%esi
+  801842:	83 c4 10             	add    $0x10,%esp
+  801845:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801848:	72 cd                	jb     801817 <devcons_write+0x19>
+}
+  80184a:	89 f0                	mov    %esi,%eax
+  80184c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80184f:	5b                   	pop    %ebx
+  801850:	5e                   	pop    %esi
+  801851:	5f                   	pop    %edi
+  801852:	5d                   	pop    %ebp
+  801853:	c3                   	ret
+
+00801854 <devcons_read>:
+{
+  801854:	55                   	push   %ebp
+  801855:	89 e5                	mov    %esp,%ebp
+  801857:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80185a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80185f:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801863:	75 07                	jne    80186c <devcons_read+0x18>
+  801865:	eb 1f                	jmp    801886 <devcons_read+0x32>
+		sys_yield();
+  801867:	e8 e3 ec ff ff       	call   80054f <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80186c:	e8 5f ec ff ff       	call   8004d0 <sys_cgetc>
+  801871:	85 c0                	test   %eax,%eax
+  801873:	74 f2                	je     801867 <devcons_read+0x13>
+	if (c < 0)
+  801875:	78 0f                	js     801886 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  801877:	83 f8 04             	cmp    $0x4,%eax
+  80187a:	74 0c                	je     801888 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80187c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80187f:	88 02                	mov    %al,(%edx)
+	return 1;
+  801881:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  801886:	c9                   	leave
+  801887:	c3                   	ret
+		return 0;
+  801888:	b8 00 00 00 00       	mov    $0x0,%eax
+  80188d:	eb f7                	jmp    801886 <devcons_read+0x32>
+
+0080188f <cputchar>:
+{
+  80188f:	55                   	push   %ebp
+  801890:	89 e5                	mov    %esp,%ebp
+  801892:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  801895:	8b 45 08             	mov    0x8(%ebp),%eax
+  801898:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80189b:	6a 01                	push   $0x1
+  80189d:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8018a0:	50                   	push   %eax
+  8018a1:	e8 0c ec ff ff       	call   8004b2 <sys_cputs>
+}
+  8018a6:	83 c4 10             	add    $0x10,%esp
+  8018a9:	c9                   	leave
+  8018aa:	c3                   	ret
+
+008018ab <getchar>:
+{
+  8018ab:	55                   	push   %ebp
+  8018ac:	89 e5                	mov    %esp,%ebp
+  8018ae:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8018b1:	6a 01                	push   $0x1
+  8018b3:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8018b6:	50                   	push   %eax
+  8018b7:	6a 00                	push   $0x0
+  8018b9:	e8 66 f2 ff ff       	call   800b24 <read>
+	if (r < 0)
+  8018be:	83 c4 10             	add    $0x10,%esp
+  8018c1:	85 c0                	test   %eax,%eax
+  8018c3:	78 06                	js     8018cb <getchar+0x20>
+	if (r < 1)
+  8018c5:	74 06                	je     8018cd <getchar+0x22>
+	return c;
+  8018c7:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8018cb:	c9                   	leave
+  8018cc:	c3                   	ret
+		return -E_EOF;
+  8018cd:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8018d2:	eb f7                	jmp    8018cb <getchar+0x20>
+
+008018d4 <iscons>:
+{
+  8018d4:	55                   	push   %ebp
+  8018d5:	89 e5                	mov    %esp,%ebp
+  8018d7:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8018da:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018dd:	50                   	push   %eax
+  8018de:	ff 75 08             	push   0x8(%ebp)
+  8018e1:	e8 d8 ef ff ff       	call   8008be <fd_lookup>
+  8018e6:	83 c4 10             	add    $0x10,%esp
+  8018e9:	85 c0                	test   %eax,%eax
+  8018eb:	78 11                	js     8018fe <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8018ed:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018f0:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  8018f6:	39 10                	cmp    %edx,(%eax)
+  8018f8:	0f 94 c0             	sete   %al
+  8018fb:	0f b6 c0             	movzbl %al,%eax
+}
+  8018fe:	c9                   	leave
+  8018ff:	c3                   	ret
+
+00801900 <opencons>:
+{
+  801900:	55                   	push   %ebp
+  801901:	89 e5                	mov    %esp,%ebp
+  801903:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  801906:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801909:	50                   	push   %eax
+  80190a:	e8 59 ef ff ff       	call   800868 <fd_alloc>
+  80190f:	83 c4 10             	add    $0x10,%esp
+  801912:	85 c0                	test   %eax,%eax
+  801914:	78 3a                	js     801950 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  801916:	83 ec 04             	sub    $0x4,%esp
+  801919:	68 07 04 00 00       	push   $0x407
+  80191e:	ff 75 f4             	push   -0xc(%ebp)
+  801921:	6a 00                	push   $0x0
+  801923:	e8 46 ec ff ff       	call   80056e <sys_page_alloc>
+  801928:	83 c4 10             	add    $0x10,%esp
+  80192b:	85 c0                	test   %eax,%eax
+  80192d:	78 21                	js     801950 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80192f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801932:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  801938:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80193a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80193d:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  801944:	83 ec 0c             	sub    $0xc,%esp
+  801947:	50                   	push   %eax
+  801948:	e8 f4 ee ff ff       	call   800841 <fd2num>
+  80194d:	83 c4 10             	add    $0x10,%esp
+}
+  801950:	c9                   	leave
+  801951:	c3                   	ret
+
+00801952 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  801952:	55                   	push   %ebp
+  801953:	89 e5                	mov    %esp,%ebp
+  801955:	56                   	push   %esi
+  801956:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  801957:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80195a:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  801960:	e8 cb eb ff ff       	call   800530 <sys_getenvid>
+  801965:	83 ec 0c             	sub    $0xc,%esp
+  801968:	ff 75 0c             	push   0xc(%ebp)
+  80196b:	ff 75 08             	push   0x8(%ebp)
+  80196e:	56                   	push   %esi
+  80196f:	50                   	push   %eax
+  801970:	68 04 27 80 00       	push   $0x802704
+  801975:	e8 b3 00 00 00       	call   801a2d <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80197a:	83 c4 18             	add    $0x18,%esp
+  80197d:	53                   	push   %ebx
+  80197e:	ff 75 10             	push   0x10(%ebp)
+  801981:	e8 56 00 00 00       	call   8019dc <vcprintf>
+	cprintf("\n");
+  801986:	c7 04 24 f0 26 80 00 	movl   $0x8026f0,(%esp)
+  80198d:	e8 9b 00 00 00       	call   801a2d <cprintf>
+  801992:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  801995:	cc                   	int3
+	while (1)
+  801996:	eb fd                	jmp    801995 <_panic+0x43>
+
+00801998 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  801998:	55                   	push   %ebp
+  801999:	89 e5                	mov    %esp,%ebp
+  80199b:	53                   	push   %ebx
+  80199c:	83 ec 04             	sub    $0x4,%esp
+  80199f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8019a2:	8b 13                	mov    (%ebx),%edx
+  8019a4:	8d 42 01             	lea    0x1(%edx),%eax
+  8019a7:	89 03                	mov    %eax,(%ebx)
+  8019a9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8019ac:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8019b0:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8019b5:	74 09                	je     8019c0 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8019b7:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8019bb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019be:	c9                   	leave
+  8019bf:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8019c0:	83 ec 08             	sub    $0x8,%esp
+  8019c3:	68 ff 00 00 00       	push   $0xff
+  8019c8:	8d 43 08             	lea    0x8(%ebx),%eax
+  8019cb:	50                   	push   %eax
+  8019cc:	e8 e1 ea ff ff       	call   8004b2 <sys_cputs>
+		b->idx = 0;
+  8019d1:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8019d7:	83 c4 10             	add    $0x10,%esp
+  8019da:	eb db                	jmp    8019b7 <putch+0x1f>
+
+008019dc <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8019dc:	55                   	push   %ebp
+  8019dd:	89 e5                	mov    %esp,%ebp
+  8019df:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8019e5:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8019ec:	00 00 00 
+	b.cnt = 0;
+  8019ef:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8019f6:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8019f9:	ff 75 0c             	push   0xc(%ebp)
+  8019fc:	ff 75 08             	push   0x8(%ebp)
+  8019ff:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  801a05:	50                   	push   %eax
+  801a06:	68 98 19 80 00       	push   $0x801998
+  801a0b:	e8 14 01 00 00       	call   801b24 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  801a10:	83 c4 08             	add    $0x8,%esp
+  801a13:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  801a19:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  801a1f:	50                   	push   %eax
+  801a20:	e8 8d ea ff ff       	call   8004b2 <sys_cputs>
+
+	return b.cnt;
+}
+  801a25:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  801a2b:	c9                   	leave
+  801a2c:	c3                   	ret
+
+00801a2d <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  801a2d:	55                   	push   %ebp
+  801a2e:	89 e5                	mov    %esp,%ebp
+  801a30:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  801a33:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  801a36:	50                   	push   %eax
+  801a37:	ff 75 08             	push   0x8(%ebp)
+  801a3a:	e8 9d ff ff ff       	call   8019dc <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  801a3f:	c9                   	leave
+  801a40:	c3                   	ret
+
+00801a41 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  801a41:	55                   	push   %ebp
+  801a42:	89 e5                	mov    %esp,%ebp
+  801a44:	57                   	push   %edi
+  801a45:	56                   	push   %esi
+  801a46:	53                   	push   %ebx
+  801a47:	83 ec 1c             	sub    $0x1c,%esp
+  801a4a:	89 c7                	mov    %eax,%edi
+  801a4c:	89 d6                	mov    %edx,%esi
+  801a4e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a51:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a54:	89 d1                	mov    %edx,%ecx
+  801a56:	89 c2                	mov    %eax,%edx
+  801a58:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801a5b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801a5e:	8b 45 10             	mov    0x10(%ebp),%eax
+  801a61:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  801a64:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801a67:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801a6e:	39 c2                	cmp    %eax,%edx
+  801a70:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  801a73:	72 3e                	jb     801ab3 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  801a75:	83 ec 0c             	sub    $0xc,%esp
+  801a78:	ff 75 18             	push   0x18(%ebp)
+  801a7b:	83 eb 01             	sub    $0x1,%ebx
+  801a7e:	53                   	push   %ebx
+  801a7f:	50                   	push   %eax
+  801a80:	83 ec 08             	sub    $0x8,%esp
+  801a83:	ff 75 e4             	push   -0x1c(%ebp)
+  801a86:	ff 75 e0             	push   -0x20(%ebp)
+  801a89:	ff 75 dc             	push   -0x24(%ebp)
+  801a8c:	ff 75 d8             	push   -0x28(%ebp)
+  801a8f:	e8 6c 07 00 00       	call   802200 <__udivdi3>
+  801a94:	83 c4 18             	add    $0x18,%esp
+  801a97:	52                   	push   %edx
+  801a98:	50                   	push   %eax
+  801a99:	89 f2                	mov    %esi,%edx
+  801a9b:	89 f8                	mov    %edi,%eax
+  801a9d:	e8 9f ff ff ff       	call   801a41 <printnum>
+  801aa2:	83 c4 20             	add    $0x20,%esp
+  801aa5:	eb 13                	jmp    801aba <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  801aa7:	83 ec 08             	sub    $0x8,%esp
+  801aaa:	56                   	push   %esi
+  801aab:	ff 75 18             	push   0x18(%ebp)
+  801aae:	ff d7                	call   *%edi
+  801ab0:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  801ab3:	83 eb 01             	sub    $0x1,%ebx
+  801ab6:	85 db                	test   %ebx,%ebx
+  801ab8:	7f ed                	jg     801aa7 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  801aba:	83 ec 08             	sub    $0x8,%esp
+  801abd:	56                   	push   %esi
+  801abe:	83 ec 04             	sub    $0x4,%esp
+  801ac1:	ff 75 e4             	push   -0x1c(%ebp)
+  801ac4:	ff 75 e0             	push   -0x20(%ebp)
+  801ac7:	ff 75 dc             	push   -0x24(%ebp)
+  801aca:	ff 75 d8             	push   -0x28(%ebp)
+  801acd:	e8 fe 07 00 00       	call   8022d0 <__umoddi3>
+  801ad2:	83 c4 14             	add    $0x14,%esp
+  801ad5:	0f be 80 27 27 80 00 	movsbl 0x802727(%eax),%eax
+  801adc:	50                   	push   %eax
+  801add:	ff d7                	call   *%edi
+}
+  801adf:	83 c4 10             	add    $0x10,%esp
+  801ae2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ae5:	5b                   	pop    %ebx
+  801ae6:	5e                   	pop    %esi
+  801ae7:	5f                   	pop    %edi
+  801ae8:	5d                   	pop    %ebp
+  801ae9:	c3                   	ret
+
+00801aea <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  801aea:	55                   	push   %ebp
+  801aeb:	89 e5                	mov    %esp,%ebp
+  801aed:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  801af0:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  801af4:	8b 10                	mov    (%eax),%edx
+  801af6:	3b 50 04             	cmp    0x4(%eax),%edx
+  801af9:	73 0a                	jae    801b05 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  801afb:	8d 4a 01             	lea    0x1(%edx),%ecx
+  801afe:	89 08                	mov    %ecx,(%eax)
+  801b00:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b03:	88 02                	mov    %al,(%edx)
+}
+  801b05:	5d                   	pop    %ebp
+  801b06:	c3                   	ret
+
+00801b07 <printfmt>:
+{
+  801b07:	55                   	push   %ebp
+  801b08:	89 e5                	mov    %esp,%ebp
+  801b0a:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  801b0d:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  801b10:	50                   	push   %eax
+  801b11:	ff 75 10             	push   0x10(%ebp)
+  801b14:	ff 75 0c             	push   0xc(%ebp)
+  801b17:	ff 75 08             	push   0x8(%ebp)
+  801b1a:	e8 05 00 00 00       	call   801b24 <vprintfmt>
+}
+  801b1f:	83 c4 10             	add    $0x10,%esp
+  801b22:	c9                   	leave
+  801b23:	c3                   	ret
+
+00801b24 <vprintfmt>:
+{
+  801b24:	55                   	push   %ebp
+  801b25:	89 e5                	mov    %esp,%ebp
+  801b27:	57                   	push   %edi
+  801b28:	56                   	push   %esi
+  801b29:	53                   	push   %ebx
+  801b2a:	83 ec 2c             	sub    $0x2c,%esp
+  801b2d:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b30:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801b33:	8b 7d 10             	mov    0x10(%ebp),%edi
+  801b36:	eb 0a                	jmp    801b42 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  801b38:	83 ec 08             	sub    $0x8,%esp
+  801b3b:	53                   	push   %ebx
+  801b3c:	50                   	push   %eax
+  801b3d:	ff d6                	call   *%esi
+  801b3f:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801b42:	83 c7 01             	add    $0x1,%edi
+  801b45:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  801b49:	83 f8 25             	cmp    $0x25,%eax
+  801b4c:	74 0c                	je     801b5a <vprintfmt+0x36>
+			if (ch == '\0')
+  801b4e:	85 c0                	test   %eax,%eax
+  801b50:	75 e6                	jne    801b38 <vprintfmt+0x14>
+}
+  801b52:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b55:	5b                   	pop    %ebx
+  801b56:	5e                   	pop    %esi
+  801b57:	5f                   	pop    %edi
+  801b58:	5d                   	pop    %ebp
+  801b59:	c3                   	ret
+		padc = ' ';
+  801b5a:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  801b5e:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  801b65:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  801b6c:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  801b73:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801b78:	8d 47 01             	lea    0x1(%edi),%eax
+  801b7b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801b7e:	0f b6 17             	movzbl (%edi),%edx
+  801b81:	8d 42 dd             	lea    -0x23(%edx),%eax
+  801b84:	3c 55                	cmp    $0x55,%al
+  801b86:	0f 87 9a 03 00 00    	ja     801f26 <vprintfmt+0x402>
+  801b8c:	0f b6 c0             	movzbl %al,%eax
+  801b8f:	ff 24 85 60 28 80 00 	jmp    *0x802860(,%eax,4)
+  801b96:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  801b99:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  801b9d:	eb d9                	jmp    801b78 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  801b9f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801ba2:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  801ba6:	eb d0                	jmp    801b78 <vprintfmt+0x54>
+  801ba8:	0f b6 d2             	movzbl %dl,%edx
+  801bab:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  801bae:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bb3:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  801bb6:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  801bb9:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  801bbd:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  801bc0:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  801bc3:	83 f9 09             	cmp    $0x9,%ecx
+  801bc6:	77 55                	ja     801c1d <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  801bc8:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  801bcb:	eb e9                	jmp    801bb6 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  801bcd:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bd0:	8b 00                	mov    (%eax),%eax
+  801bd2:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801bd5:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bd8:	8d 40 04             	lea    0x4(%eax),%eax
+  801bdb:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  801bde:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  801be1:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801be5:	79 91                	jns    801b78 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  801be7:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801bea:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801bed:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  801bf4:	eb 82                	jmp    801b78 <vprintfmt+0x54>
+			if (width < 0)
+  801bf6:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801bf9:	85 d2                	test   %edx,%edx
+  801bfb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c00:	0f 49 c2             	cmovns %edx,%eax
+  801c03:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  801c06:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  801c09:	e9 6a ff ff ff       	jmp    801b78 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  801c0e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  801c11:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  801c18:	e9 5b ff ff ff       	jmp    801b78 <vprintfmt+0x54>
+  801c1d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801c20:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801c23:	eb bc                	jmp    801be1 <vprintfmt+0xbd>
+			lflag++;
+  801c25:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801c28:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  801c2b:	e9 48 ff ff ff       	jmp    801b78 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  801c30:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c33:	8d 78 04             	lea    0x4(%eax),%edi
+  801c36:	83 ec 08             	sub    $0x8,%esp
+  801c39:	53                   	push   %ebx
+  801c3a:	ff 30                	push   (%eax)
+  801c3c:	ff d6                	call   *%esi
+			break;
+  801c3e:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  801c41:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  801c44:	e9 7c 02 00 00       	jmp    801ec5 <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  801c49:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c4c:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  801c4f:	8b 10                	mov    (%eax),%edx
+  801c51:	89 d0                	mov    %edx,%eax
+  801c53:	f7 d8                	neg    %eax
+  801c55:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  801c58:	83 f8 10             	cmp    $0x10,%eax
+  801c5b:	7f 23                	jg     801c80 <vprintfmt+0x15c>
+  801c5d:	8b 14 85 c0 29 80 00 	mov    0x8029c0(,%eax,4),%edx
+  801c64:	85 d2                	test   %edx,%edx
+  801c66:	74 18                	je     801c80 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  801c68:	52                   	push   %edx
+  801c69:	68 85 26 80 00       	push   $0x802685
+  801c6e:	53                   	push   %ebx
+  801c6f:	56                   	push   %esi
+  801c70:	e8 92 fe ff ff       	call   801b07 <printfmt>
+  801c75:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801c78:	89 7d 14             	mov    %edi,0x14(%ebp)
+  801c7b:	e9 45 02 00 00       	jmp    801ec5 <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  801c80:	50                   	push   %eax
+  801c81:	68 3f 27 80 00       	push   $0x80273f
+  801c86:	53                   	push   %ebx
+  801c87:	56                   	push   %esi
+  801c88:	e8 7a fe ff ff       	call   801b07 <printfmt>
+  801c8d:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801c90:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  801c93:	e9 2d 02 00 00       	jmp    801ec5 <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801c98:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c9b:	83 c0 04             	add    $0x4,%eax
+  801c9e:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  801ca1:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ca4:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  801ca6:	85 c9                	test   %ecx,%ecx
+  801ca8:	b8 38 27 80 00       	mov    $0x802738,%eax
+  801cad:	0f 45 c1             	cmovne %ecx,%eax
+  801cb0:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  801cb3:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801cb7:	7e 06                	jle    801cbf <vprintfmt+0x19b>
+  801cb9:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  801cbd:	75 0b                	jne    801cca <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801cbf:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801cc2:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801cc5:	89 75 08             	mov    %esi,0x8(%ebp)
+  801cc8:	eb 5c                	jmp    801d26 <vprintfmt+0x202>
+  801cca:	83 ec 08             	sub    $0x8,%esp
+  801ccd:	ff 75 d0             	push   -0x30(%ebp)
+  801cd0:	ff 75 cc             	push   -0x34(%ebp)
+  801cd3:	e8 87 e4 ff ff       	call   80015f <strnlen>
+  801cd8:	89 c2                	mov    %eax,%edx
+  801cda:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801cdd:	29 d0                	sub    %edx,%eax
+  801cdf:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  801ce2:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  801ce6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801ce9:	89 75 08             	mov    %esi,0x8(%ebp)
+  801cec:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801cee:	eb 0e                	jmp    801cfe <vprintfmt+0x1da>
+					putch(padc, putdat);
+  801cf0:	83 ec 08             	sub    $0x8,%esp
+  801cf3:	53                   	push   %ebx
+  801cf4:	57                   	push   %edi
+  801cf5:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801cf8:	83 ee 01             	sub    $0x1,%esi
+  801cfb:	83 c4 10             	add    $0x10,%esp
+  801cfe:	85 f6                	test   %esi,%esi
+  801d00:	7f ee                	jg     801cf0 <vprintfmt+0x1cc>
+  801d02:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801d05:	8b 75 08             	mov    0x8(%ebp),%esi
+  801d08:	85 c0                	test   %eax,%eax
+  801d0a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d0f:	0f 49 d0             	cmovns %eax,%edx
+  801d12:	29 d0                	sub    %edx,%eax
+  801d14:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801d17:	eb a6                	jmp    801cbf <vprintfmt+0x19b>
+					putch(ch, putdat);
+  801d19:	83 ec 08             	sub    $0x8,%esp
+  801d1c:	53                   	push   %ebx
+  801d1d:	52                   	push   %edx
+  801d1e:	ff 55 08             	call   *0x8(%ebp)
+  801d21:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801d24:	89 f1                	mov    %esi,%ecx
+  801d26:	8d 71 01             	lea    0x1(%ecx),%esi
+  801d29:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  801d2d:	0f be d0             	movsbl %al,%edx
+  801d30:	85 d2                	test   %edx,%edx
+  801d32:	74 28                	je     801d5c <vprintfmt+0x238>
+  801d34:	85 ff                	test   %edi,%edi
+  801d36:	78 05                	js     801d3d <vprintfmt+0x219>
+  801d38:	83 ef 01             	sub    $0x1,%edi
+  801d3b:	78 30                	js     801d6d <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  801d3d:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  801d41:	74 d6                	je     801d19 <vprintfmt+0x1f5>
+  801d43:	0f be c0             	movsbl %al,%eax
+  801d46:	83 e8 20             	sub    $0x20,%eax
+  801d49:	83 f8 5e             	cmp    $0x5e,%eax
+  801d4c:	76 cb                	jbe    801d19 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  801d4e:	83 ec 08             	sub    $0x8,%esp
+  801d51:	53                   	push   %ebx
+  801d52:	6a 3f                	push   $0x3f
+  801d54:	ff 55 08             	call   *0x8(%ebp)
+  801d57:	83 c4 10             	add    $0x10,%esp
+  801d5a:	eb c8                	jmp    801d24 <vprintfmt+0x200>
+  801d5c:	8b 75 08             	mov    0x8(%ebp),%esi
+  801d5f:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  801d62:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801d65:	01 d0                	add    %edx,%eax
+  801d67:	29 c8                	sub    %ecx,%eax
+  801d69:	89 c7                	mov    %eax,%edi
+  801d6b:	eb 13                	jmp    801d80 <vprintfmt+0x25c>
+  801d6d:	8b 75 08             	mov    0x8(%ebp),%esi
+  801d70:	eb ed                	jmp    801d5f <vprintfmt+0x23b>
+				putch(' ', putdat);
+  801d72:	83 ec 08             	sub    $0x8,%esp
+  801d75:	53                   	push   %ebx
+  801d76:	6a 20                	push   $0x20
+  801d78:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  801d7a:	83 ef 01             	sub    $0x1,%edi
+  801d7d:	83 c4 10             	add    $0x10,%esp
+  801d80:	85 ff                	test   %edi,%edi
+  801d82:	7f ee                	jg     801d72 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801d84:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  801d87:	89 45 14             	mov    %eax,0x14(%ebp)
+  801d8a:	e9 36 01 00 00       	jmp    801ec5 <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  801d8f:	83 f9 01             	cmp    $0x1,%ecx
+  801d92:	7f 1f                	jg     801db3 <vprintfmt+0x28f>
+	else if (lflag)
+  801d94:	85 c9                	test   %ecx,%ecx
+  801d96:	74 67                	je     801dff <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  801d98:	8b 45 14             	mov    0x14(%ebp),%eax
+  801d9b:	8b 00                	mov    (%eax),%eax
+  801d9d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801da0:	89 c1                	mov    %eax,%ecx
+  801da2:	c1 f9 1f             	sar    $0x1f,%ecx
+  801da5:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801da8:	8b 45 14             	mov    0x14(%ebp),%eax
+  801dab:	8d 40 04             	lea    0x4(%eax),%eax
+  801dae:	89 45 14             	mov    %eax,0x14(%ebp)
+  801db1:	eb 17                	jmp    801dca <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  801db3:	8b 45 14             	mov    0x14(%ebp),%eax
+  801db6:	8b 50 04             	mov    0x4(%eax),%edx
+  801db9:	8b 00                	mov    (%eax),%eax
+  801dbb:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801dbe:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801dc1:	8b 45 14             	mov    0x14(%ebp),%eax
+  801dc4:	8d 40 08             	lea    0x8(%eax),%eax
+  801dc7:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  801dca:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801dcd:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  801dd0:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  801dd5:	85 c9                	test   %ecx,%ecx
+  801dd7:	0f 89 ce 00 00 00    	jns    801eab <vprintfmt+0x387>
+				putch('-', putdat);
+  801ddd:	83 ec 08             	sub    $0x8,%esp
+  801de0:	53                   	push   %ebx
+  801de1:	6a 2d                	push   $0x2d
+  801de3:	ff d6                	call   *%esi
+				num = -(long long) num;
+  801de5:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801de8:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801deb:	f7 da                	neg    %edx
+  801ded:	83 d1 00             	adc    $0x0,%ecx
+  801df0:	f7 d9                	neg    %ecx
+  801df2:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  801df5:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801dfa:	e9 ac 00 00 00       	jmp    801eab <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  801dff:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e02:	8b 00                	mov    (%eax),%eax
+  801e04:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801e07:	89 c1                	mov    %eax,%ecx
+  801e09:	c1 f9 1f             	sar    $0x1f,%ecx
+  801e0c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801e0f:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e12:	8d 40 04             	lea    0x4(%eax),%eax
+  801e15:	89 45 14             	mov    %eax,0x14(%ebp)
+  801e18:	eb b0                	jmp    801dca <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  801e1a:	83 f9 01             	cmp    $0x1,%ecx
+  801e1d:	7f 1b                	jg     801e3a <vprintfmt+0x316>
+	else if (lflag)
+  801e1f:	85 c9                	test   %ecx,%ecx
+  801e21:	74 2c                	je     801e4f <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  801e23:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e26:	8b 10                	mov    (%eax),%edx
+  801e28:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e2d:	8d 40 04             	lea    0x4(%eax),%eax
+  801e30:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801e33:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  801e38:	eb 71                	jmp    801eab <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  801e3a:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e3d:	8b 10                	mov    (%eax),%edx
+  801e3f:	8b 48 04             	mov    0x4(%eax),%ecx
+  801e42:	8d 40 08             	lea    0x8(%eax),%eax
+  801e45:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801e48:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  801e4d:	eb 5c                	jmp    801eab <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  801e4f:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e52:	8b 10                	mov    (%eax),%edx
+  801e54:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e59:	8d 40 04             	lea    0x4(%eax),%eax
+  801e5c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801e5f:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  801e64:	eb 45                	jmp    801eab <vprintfmt+0x387>
+			putch('X', putdat);
+  801e66:	83 ec 08             	sub    $0x8,%esp
+  801e69:	53                   	push   %ebx
+  801e6a:	6a 58                	push   $0x58
+  801e6c:	ff d6                	call   *%esi
+			putch('X', putdat);
+  801e6e:	83 c4 08             	add    $0x8,%esp
+  801e71:	53                   	push   %ebx
+  801e72:	6a 58                	push   $0x58
+  801e74:	ff d6                	call   *%esi
+			putch('X', putdat);
+  801e76:	83 c4 08             	add    $0x8,%esp
+  801e79:	53                   	push   %ebx
+  801e7a:	6a 58                	push   $0x58
+  801e7c:	ff d6                	call   *%esi
+			break;
+  801e7e:	83 c4 10             	add    $0x10,%esp
+  801e81:	eb 42                	jmp    801ec5 <vprintfmt+0x3a1>
+			putch('0', putdat);
+  801e83:	83 ec 08             	sub    $0x8,%esp
+  801e86:	53                   	push   %ebx
+  801e87:	6a 30                	push   $0x30
+  801e89:	ff d6                	call   *%esi
+			putch('x', putdat);
+  801e8b:	83 c4 08             	add    $0x8,%esp
+  801e8e:	53                   	push   %ebx
+  801e8f:	6a 78                	push   $0x78
+  801e91:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  801e93:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e96:	8b 10                	mov    (%eax),%edx
+  801e98:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  801e9d:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  801ea0:	8d 40 04             	lea    0x4(%eax),%eax
+  801ea3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801ea6:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  801eab:	83 ec 0c             	sub    $0xc,%esp
+  801eae:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  801eb2:	50                   	push   %eax
+  801eb3:	ff 75 e0             	push   -0x20(%ebp)
+  801eb6:	57                   	push   %edi
+  801eb7:	51                   	push   %ecx
+  801eb8:	52                   	push   %edx
+  801eb9:	89 da                	mov    %ebx,%edx
+  801ebb:	89 f0                	mov    %esi,%eax
+  801ebd:	e8 7f fb ff ff       	call   801a41 <printnum>
+			break;
+  801ec2:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  801ec5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801ec8:	e9 75 fc ff ff       	jmp    801b42 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  801ecd:	83 f9 01             	cmp    $0x1,%ecx
+  801ed0:	7f 1b                	jg     801eed <vprintfmt+0x3c9>
+	else if (lflag)
+  801ed2:	85 c9                	test   %ecx,%ecx
+  801ed4:	74 2c                	je     801f02 <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  801ed6:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ed9:	8b 10                	mov    (%eax),%edx
+  801edb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ee0:	8d 40 04             	lea    0x4(%eax),%eax
+  801ee3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801ee6:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  801eeb:	eb be                	jmp    801eab <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  801eed:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ef0:	8b 10                	mov    (%eax),%edx
+  801ef2:	8b 48 04             	mov    0x4(%eax),%ecx
+  801ef5:	8d 40 08             	lea    0x8(%eax),%eax
+  801ef8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801efb:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  801f00:	eb a9                	jmp    801eab <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  801f02:	8b 45 14             	mov    0x14(%ebp),%eax
+  801f05:	8b 10                	mov    (%eax),%edx
+  801f07:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f0c:	8d 40 04             	lea    0x4(%eax),%eax
+  801f0f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801f12:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  801f17:	eb 92                	jmp    801eab <vprintfmt+0x387>
+			putch(ch, putdat);
+  801f19:	83 ec 08             	sub    $0x8,%esp
+  801f1c:	53                   	push   %ebx
+  801f1d:	6a 25                	push   $0x25
+  801f1f:	ff d6                	call   *%esi
+			break;
+  801f21:	83 c4 10             	add    $0x10,%esp
+  801f24:	eb 9f                	jmp    801ec5 <vprintfmt+0x3a1>
+			putch('%', putdat);
+  801f26:	83 ec 08             	sub    $0x8,%esp
+  801f29:	53                   	push   %ebx
+  801f2a:	6a 25                	push   $0x25
+  801f2c:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801f2e:	83 c4 10             	add    $0x10,%esp
+  801f31:	89 f8                	mov    %edi,%eax
+  801f33:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  801f37:	74 05                	je     801f3e <vprintfmt+0x41a>
+  801f39:	83 e8 01             	sub    $0x1,%eax
+  801f3c:	eb f5                	jmp    801f33 <vprintfmt+0x40f>
+  801f3e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801f41:	eb 82                	jmp    801ec5 <vprintfmt+0x3a1>
+
+00801f43 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  801f43:	55                   	push   %ebp
+  801f44:	89 e5                	mov    %esp,%ebp
+  801f46:	83 ec 18             	sub    $0x18,%esp
+  801f49:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f4c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  801f4f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  801f52:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  801f56:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  801f59:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  801f60:	85 c0                	test   %eax,%eax
+  801f62:	74 26                	je     801f8a <vsnprintf+0x47>
+  801f64:	85 d2                	test   %edx,%edx
+  801f66:	7e 22                	jle    801f8a <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  801f68:	ff 75 14             	push   0x14(%ebp)
+  801f6b:	ff 75 10             	push   0x10(%ebp)
+  801f6e:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  801f71:	50                   	push   %eax
+  801f72:	68 ea 1a 80 00       	push   $0x801aea
+  801f77:	e8 a8 fb ff ff       	call   801b24 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  801f7c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801f7f:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  801f82:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f85:	83 c4 10             	add    $0x10,%esp
+}
+  801f88:	c9                   	leave
+  801f89:	c3                   	ret
+		return -E_INVAL;
+  801f8a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f8f:	eb f7                	jmp    801f88 <vsnprintf+0x45>
+
+00801f91 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801f91:	55                   	push   %ebp
+  801f92:	89 e5                	mov    %esp,%ebp
+  801f94:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  801f97:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  801f9a:	50                   	push   %eax
+  801f9b:	ff 75 10             	push   0x10(%ebp)
+  801f9e:	ff 75 0c             	push   0xc(%ebp)
+  801fa1:	ff 75 08             	push   0x8(%ebp)
+  801fa4:	e8 9a ff ff ff       	call   801f43 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  801fa9:	c9                   	leave
+  801faa:	c3                   	ret
+
+00801fab <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  801fab:	55                   	push   %ebp
+  801fac:	89 e5                	mov    %esp,%ebp
+  801fae:	56                   	push   %esi
+  801faf:	53                   	push   %ebx
+  801fb0:	8b 75 08             	mov    0x8(%ebp),%esi
+  801fb3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fb6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  801fb9:	85 c0                	test   %eax,%eax
+  801fbb:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801fc0:	0f 44 c2             	cmove  %edx,%eax
+  801fc3:	83 ec 0c             	sub    $0xc,%esp
+  801fc6:	50                   	push   %eax
+  801fc7:	e8 52 e7 ff ff       	call   80071e <sys_ipc_recv>
+
+  if (from_env_store)
+  801fcc:	83 c4 10             	add    $0x10,%esp
+  801fcf:	85 f6                	test   %esi,%esi
+  801fd1:	74 17                	je     801fea <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  801fd3:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fd8:	85 c0                	test   %eax,%eax
+  801fda:	75 0c                	jne    801fe8 <ipc_recv+0x3d>
+  801fdc:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801fe2:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  801fe8:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  801fea:	85 db                	test   %ebx,%ebx
+  801fec:	74 2b                	je     802019 <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  801fee:	85 c0                	test   %eax,%eax
+  801ff0:	74 0d                	je     801fff <ipc_recv+0x54>
+  801ff2:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  801ff8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ffb:	5b                   	pop    %ebx
+  801ffc:	5e                   	pop    %esi
+  801ffd:	5d                   	pop    %ebp
+  801ffe:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  801fff:	a1 08 40 80 00       	mov    0x804008,%eax
+  802004:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80200a:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  80200c:	a1 08 40 80 00       	mov    0x804008,%eax
+  802011:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  802017:	eb df                	jmp    801ff8 <ipc_recv+0x4d>
+  802019:	85 c0                	test   %eax,%eax
+  80201b:	75 db                	jne    801ff8 <ipc_recv+0x4d>
+  80201d:	eb ed                	jmp    80200c <ipc_recv+0x61>
+
+0080201f <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  80201f:	55                   	push   %ebp
+  802020:	89 e5                	mov    %esp,%ebp
+  802022:	57                   	push   %edi
+  802023:	56                   	push   %esi
+  802024:	53                   	push   %ebx
+  802025:	83 ec 0c             	sub    $0xc,%esp
+  802028:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80202b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80202e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  802031:	85 db                	test   %ebx,%ebx
+  802033:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802038:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  80203b:	ff 75 14             	push   0x14(%ebp)
+  80203e:	53                   	push   %ebx
+  80203f:	56                   	push   %esi
+  802040:	57                   	push   %edi
+  802041:	e8 b5 e6 ff ff       	call   8006fb <sys_ipc_try_send>
+  802046:	83 c4 10             	add    $0x10,%esp
+  802049:	85 c0                	test   %eax,%eax
+  80204b:	74 1e                	je     80206b <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  80204d:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802050:	75 07                	jne    802059 <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  802052:	e8 f8 e4 ff ff       	call   80054f <sys_yield>
+  802057:	eb e2                	jmp    80203b <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  802059:	50                   	push   %eax
+  80205a:	68 23 2a 80 00       	push   $0x802a23
+  80205f:	6a 3c                	push   $0x3c
+  802061:	68 30 2a 80 00       	push   $0x802a30
+  802066:	e8 e7 f8 ff ff       	call   801952 <_panic>
+  }
+
+#endif
+}
+  80206b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80206e:	5b                   	pop    %ebx
+  80206f:	5e                   	pop    %esi
+  802070:	5f                   	pop    %edi
+  802071:	5d                   	pop    %ebp
+  802072:	c3                   	ret
+
+00802073 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  802073:	55                   	push   %ebp
+  802074:	89 e5                	mov    %esp,%ebp
+  802076:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  802079:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  80207e:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802081:	c1 e0 04             	shl    $0x4,%eax
+  802084:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802089:	8b 40 50             	mov    0x50(%eax),%eax
+  80208c:	39 c8                	cmp    %ecx,%eax
+  80208e:	74 12                	je     8020a2 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  802090:	83 c2 01             	add    $0x1,%edx
+  802093:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802099:	75 e3                	jne    80207e <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  80209b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020a0:	eb 0e                	jmp    8020b0 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  8020a2:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8020a5:	c1 e0 04             	shl    $0x4,%eax
+  8020a8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8020ad:	8b 40 48             	mov    0x48(%eax),%eax
+  8020b0:	5d                   	pop    %ebp
+  8020b1:	c3                   	ret
+
+008020b2 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8020b2:	55                   	push   %ebp
+  8020b3:	89 e5                	mov    %esp,%ebp
+  8020b5:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8020b8:	89 c2                	mov    %eax,%edx
+  8020ba:	c1 ea 16             	shr    $0x16,%edx
+  8020bd:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8020c4:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8020c9:	f6 c1 01             	test   $0x1,%cl
+  8020cc:	74 1c                	je     8020ea <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  8020ce:	c1 e8 0c             	shr    $0xc,%eax
+  8020d1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8020d8:	a8 01                	test   $0x1,%al
+  8020da:	74 0e                	je     8020ea <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8020dc:	c1 e8 0c             	shr    $0xc,%eax
+  8020df:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  8020e6:	ef 
+  8020e7:	0f b7 d2             	movzwl %dx,%edx
+}
+  8020ea:	89 d0                	mov    %edx,%eax
+  8020ec:	5d                   	pop    %ebp
+  8020ed:	c3                   	ret
+  8020ee:	66 90                	xchg   %ax,%ax
+
+008020f0 <__udivmoddi4>:
+  8020f0:	55                   	push   %ebp
+  8020f1:	57                   	push   %edi
+  8020f2:	56                   	push   %esi
+  8020f3:	53                   	push   %ebx
+  8020f4:	83 ec 24             	sub    $0x24,%esp
+  8020f7:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8020fb:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8020ff:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  802103:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802107:	8b 54 24 44          	mov    0x44(%esp),%edx
+  80210b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80210f:	8b 44 24 40          	mov    0x40(%esp),%eax
+  802113:	89 d3                	mov    %edx,%ebx
+  802115:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802119:	09 c3                	or     %eax,%ebx
+  80211b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80211f:	0f 84 9c 00 00 00    	je     8021c1 <__udivmoddi4+0xd1>
+  802125:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80212c:	00 
+  80212d:	31 c0                	xor    %eax,%eax
+  80212f:	31 d2                	xor    %edx,%edx
+  802131:	89 fb                	mov    %edi,%ebx
+  802133:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80213a:	00 
+  80213b:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802140:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802144:	01 c0                	add    %eax,%eax
+  802146:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80214d:	00 
+  80214e:	89 c6                	mov    %eax,%esi
+  802150:	89 d7                	mov    %edx,%edi
+  802152:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802156:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80215a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80215d:	d3 ea                	shr    %cl,%edx
+  80215f:	f6 c1 20             	test   $0x20,%cl
+  802162:	0f 45 c2             	cmovne %edx,%eax
+  802165:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802169:	83 e0 01             	and    $0x1,%eax
+  80216c:	09 fa                	or     %edi,%edx
+  80216e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802172:	89 04 24             	mov    %eax,(%esp)
+  802175:	8b 04 24             	mov    (%esp),%eax
+  802178:	89 d5                	mov    %edx,%ebp
+  80217a:	09 f0                	or     %esi,%eax
+  80217c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802180:	39 f0                	cmp    %esi,%eax
+  802182:	19 fd                	sbb    %edi,%ebp
+  802184:	72 1d                	jb     8021a3 <__udivmoddi4+0xb3>
+  802186:	29 f0                	sub    %esi,%eax
+  802188:	19 fa                	sbb    %edi,%edx
+  80218a:	89 cf                	mov    %ecx,%edi
+  80218c:	c1 ef 05             	shr    $0x5,%edi
+  80218f:	83 e7 01             	and    $0x1,%edi
+  802192:	89 fe                	mov    %edi,%esi
+  802194:	d3 e7                	shl    %cl,%edi
+  802196:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80219a:	83 f6 01             	xor    $0x1,%esi
+  80219d:	d3 e6                	shl    %cl,%esi
+  80219f:	09 74 24 18          	or     %esi,0x18(%esp)
+  8021a3:	83 e9 01             	sub    $0x1,%ecx
+  8021a6:	73 98                	jae    802140 <__udivmoddi4+0x50>
+  8021a8:	85 db                	test   %ebx,%ebx
+  8021aa:	74 05                	je     8021b1 <__udivmoddi4+0xc1>
+  8021ac:	89 03                	mov    %eax,(%ebx)
+  8021ae:	89 53 04             	mov    %edx,0x4(%ebx)
+  8021b1:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8021b5:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8021b9:	83 c4 24             	add    $0x24,%esp
+  8021bc:	5b                   	pop    %ebx
+  8021bd:	5e                   	pop    %esi
+  8021be:	5f                   	pop    %edi
+  8021bf:	5d                   	pop    %ebp
+  8021c0:	c3                   	ret
+  8021c1:	85 ff                	test   %edi,%edi
+  8021c3:	74 0d                	je     8021d2 <__udivmoddi4+0xe2>
+  8021c5:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  8021cb:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  8021d2:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8021d6:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8021da:	89 44 24 18          	mov    %eax,0x18(%esp)
+  8021de:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8021e2:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  8021e6:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8021ea:	83 c4 24             	add    $0x24,%esp
+  8021ed:	5b                   	pop    %ebx
+  8021ee:	5e                   	pop    %esi
+  8021ef:	5f                   	pop    %edi
+  8021f0:	5d                   	pop    %ebp
+  8021f1:	c3                   	ret
+  8021f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8021f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00802200 <__udivdi3>:
+  802200:	57                   	push   %edi
+  802201:	56                   	push   %esi
+  802202:	53                   	push   %ebx
+  802203:	83 ec 20             	sub    $0x20,%esp
+  802206:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80220a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80220e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802212:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802216:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80221a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80221e:	89 d1                	mov    %edx,%ecx
+  802220:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802224:	09 c1                	or     %eax,%ecx
+  802226:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80222a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80222e:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802232:	0f 84 88 00 00 00    	je     8022c0 <__udivdi3+0xc0>
+  802238:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80223f:	00 
+  802240:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802245:	31 c0                	xor    %eax,%eax
+  802247:	31 d2                	xor    %edx,%edx
+  802249:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802250:	00 
+  802251:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802258:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80225c:	01 c0                	add    %eax,%eax
+  80225e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802265:	00 
+  802266:	89 c6                	mov    %eax,%esi
+  802268:	89 d7                	mov    %edx,%edi
+  80226a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80226e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802272:	0f ad d0             	shrd   %cl,%edx,%eax
+  802275:	d3 ea                	shr    %cl,%edx
+  802277:	f6 c1 20             	test   $0x20,%cl
+  80227a:	0f 45 c2             	cmovne %edx,%eax
+  80227d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802281:	83 e0 01             	and    $0x1,%eax
+  802284:	09 fa                	or     %edi,%edx
+  802286:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80228a:	89 04 24             	mov    %eax,(%esp)
+  80228d:	8b 04 24             	mov    (%esp),%eax
+  802290:	89 d3                	mov    %edx,%ebx
+  802292:	09 f0                	or     %esi,%eax
+  802294:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802298:	39 f0                	cmp    %esi,%eax
+  80229a:	19 fb                	sbb    %edi,%ebx
+  80229c:	72 1d                	jb     8022bb <__udivdi3+0xbb>
+  80229e:	29 f0                	sub    %esi,%eax
+  8022a0:	19 fa                	sbb    %edi,%edx
+  8022a2:	89 cf                	mov    %ecx,%edi
+  8022a4:	c1 ef 05             	shr    $0x5,%edi
+  8022a7:	83 e7 01             	and    $0x1,%edi
+  8022aa:	89 fe                	mov    %edi,%esi
+  8022ac:	d3 e7                	shl    %cl,%edi
+  8022ae:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8022b2:	83 f6 01             	xor    $0x1,%esi
+  8022b5:	d3 e6                	shl    %cl,%esi
+  8022b7:	09 74 24 18          	or     %esi,0x18(%esp)
+  8022bb:	83 e9 01             	sub    $0x1,%ecx
+  8022be:	73 98                	jae    802258 <__udivdi3+0x58>
+  8022c0:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8022c4:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8022c8:	83 c4 20             	add    $0x20,%esp
+  8022cb:	5b                   	pop    %ebx
+  8022cc:	5e                   	pop    %esi
+  8022cd:	5f                   	pop    %edi
+  8022ce:	c3                   	ret
+  8022cf:	90                   	nop
+
+008022d0 <__umoddi3>:
+  8022d0:	57                   	push   %edi
+  8022d1:	56                   	push   %esi
+  8022d2:	53                   	push   %ebx
+  8022d3:	83 ec 18             	sub    $0x18,%esp
+  8022d6:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8022da:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8022de:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8022e2:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8022e6:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8022ea:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8022ee:	89 d1                	mov    %edx,%ecx
+  8022f0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8022f4:	09 c1                	or     %eax,%ecx
+  8022f6:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8022fa:	74 5b                	je     802357 <__umoddi3+0x87>
+  8022fc:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802301:	31 c0                	xor    %eax,%eax
+  802303:	31 d2                	xor    %edx,%edx
+  802305:	8d 76 00             	lea    0x0(%esi),%esi
+  802308:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80230c:	01 c0                	add    %eax,%eax
+  80230e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802315:	00 
+  802316:	89 c6                	mov    %eax,%esi
+  802318:	89 d7                	mov    %edx,%edi
+  80231a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80231e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802322:	0f ad d0             	shrd   %cl,%edx,%eax
+  802325:	d3 ea                	shr    %cl,%edx
+  802327:	f6 c1 20             	test   $0x20,%cl
+  80232a:	0f 45 c2             	cmovne %edx,%eax
+  80232d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802331:	83 e0 01             	and    $0x1,%eax
+  802334:	09 fa                	or     %edi,%edx
+  802336:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80233a:	89 04 24             	mov    %eax,(%esp)
+  80233d:	8b 04 24             	mov    (%esp),%eax
+  802340:	89 d3                	mov    %edx,%ebx
+  802342:	09 f0                	or     %esi,%eax
+  802344:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802348:	39 f0                	cmp    %esi,%eax
+  80234a:	19 fb                	sbb    %edi,%ebx
+  80234c:	72 04                	jb     802352 <__umoddi3+0x82>
+  80234e:	29 f0                	sub    %esi,%eax
+  802350:	19 fa                	sbb    %edi,%edx
+  802352:	83 e9 01             	sub    $0x1,%ecx
+  802355:	73 b1                	jae    802308 <__umoddi3+0x38>
+  802357:	83 c4 18             	add    $0x18,%esp
+  80235a:	5b                   	pop    %ebx
+  80235b:	5e                   	pop    %esi
+  80235c:	5f                   	pop    %edi
+  80235d:	c3                   	ret
+  80235e:	66 90                	xchg   %ax,%ax
+
+00802360 <__divdi3>:
+  802360:	55                   	push   %ebp
+  802361:	57                   	push   %edi
+  802362:	56                   	push   %esi
+  802363:	53                   	push   %ebx
+  802364:	83 ec 24             	sub    $0x24,%esp
+  802367:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  80236b:	8b 74 24 44          	mov    0x44(%esp),%esi
+  80236f:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802373:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802377:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  80237b:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  80237f:	85 d2                	test   %edx,%edx
+  802381:	0f 88 e0 00 00 00    	js     802467 <__divdi3+0x107>
+  802387:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  80238b:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  80238f:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802393:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802397:	85 f6                	test   %esi,%esi
+  802399:	78 16                	js     8023b1 <__divdi3+0x51>
+  80239b:	89 f1                	mov    %esi,%ecx
+  80239d:	31 c0                	xor    %eax,%eax
+  80239f:	31 d2                	xor    %edx,%edx
+  8023a1:	09 d9                	or     %ebx,%ecx
+  8023a3:	0f 85 f3 00 00 00    	jne    80249c <__divdi3+0x13c>
+  8023a9:	83 c4 24             	add    $0x24,%esp
+  8023ac:	5b                   	pop    %ebx
+  8023ad:	5e                   	pop    %esi
+  8023ae:	5f                   	pop    %edi
+  8023af:	5d                   	pop    %ebp
+  8023b0:	c3                   	ret
+  8023b1:	bf 01 00 00 00       	mov    $0x1,%edi
+  8023b6:	f7 5c 24 08          	negl   0x8(%esp)
+  8023ba:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  8023bf:	f7 5c 24 0c          	negl   0xc(%esp)
+  8023c3:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8023ca:	00 
+  8023cb:	31 c0                	xor    %eax,%eax
+  8023cd:	31 d2                	xor    %edx,%edx
+  8023cf:	89 fb                	mov    %edi,%ebx
+  8023d1:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8023d8:	00 
+  8023d9:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8023de:	66 90                	xchg   %ax,%ax
+  8023e0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8023e4:	01 c0                	add    %eax,%eax
+  8023e6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8023ed:	00 
+  8023ee:	89 c6                	mov    %eax,%esi
+  8023f0:	89 d7                	mov    %edx,%edi
+  8023f2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8023f6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8023fa:	0f ad d0             	shrd   %cl,%edx,%eax
+  8023fd:	d3 ea                	shr    %cl,%edx
+  8023ff:	f6 c1 20             	test   $0x20,%cl
+  802402:	0f 45 c2             	cmovne %edx,%eax
+  802405:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802409:	83 e0 01             	and    $0x1,%eax
+  80240c:	09 fa                	or     %edi,%edx
+  80240e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802412:	89 04 24             	mov    %eax,(%esp)
+  802415:	8b 04 24             	mov    (%esp),%eax
+  802418:	89 d5                	mov    %edx,%ebp
+  80241a:	09 f0                	or     %esi,%eax
+  80241c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802420:	39 f0                	cmp    %esi,%eax
+  802422:	19 fd                	sbb    %edi,%ebp
+  802424:	72 1d                	jb     802443 <__divdi3+0xe3>
+  802426:	29 f0                	sub    %esi,%eax
+  802428:	19 fa                	sbb    %edi,%edx
+  80242a:	89 cf                	mov    %ecx,%edi
+  80242c:	c1 ef 05             	shr    $0x5,%edi
+  80242f:	83 e7 01             	and    $0x1,%edi
+  802432:	89 fe                	mov    %edi,%esi
+  802434:	d3 e7                	shl    %cl,%edi
+  802436:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80243a:	83 f6 01             	xor    $0x1,%esi
+  80243d:	d3 e6                	shl    %cl,%esi
+  80243f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802443:	83 e9 01             	sub    $0x1,%ecx
+  802446:	73 98                	jae    8023e0 <__divdi3+0x80>
+  802448:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80244c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802450:	85 db                	test   %ebx,%ebx
+  802452:	0f 84 51 ff ff ff    	je     8023a9 <__divdi3+0x49>
+  802458:	f7 d8                	neg    %eax
+  80245a:	83 d2 00             	adc    $0x0,%edx
+  80245d:	83 c4 24             	add    $0x24,%esp
+  802460:	5b                   	pop    %ebx
+  802461:	f7 da                	neg    %edx
+  802463:	5e                   	pop    %esi
+  802464:	5f                   	pop    %edi
+  802465:	5d                   	pop    %ebp
+  802466:	c3                   	ret
+  802467:	f7 d8                	neg    %eax
+  802469:	83 d2 00             	adc    $0x0,%edx
+  80246c:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802470:	f7 da                	neg    %edx
+  802472:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802476:	85 f6                	test   %esi,%esi
+  802478:	78 1b                	js     802495 <__divdi3+0x135>
+  80247a:	89 f1                	mov    %esi,%ecx
+  80247c:	31 c0                	xor    %eax,%eax
+  80247e:	31 d2                	xor    %edx,%edx
+  802480:	bf 01 00 00 00       	mov    $0x1,%edi
+  802485:	09 d9                	or     %ebx,%ecx
+  802487:	0f 85 36 ff ff ff    	jne    8023c3 <__divdi3+0x63>
+  80248d:	83 c4 24             	add    $0x24,%esp
+  802490:	5b                   	pop    %ebx
+  802491:	5e                   	pop    %esi
+  802492:	5f                   	pop    %edi
+  802493:	5d                   	pop    %ebp
+  802494:	c3                   	ret
+  802495:	31 ff                	xor    %edi,%edi
+  802497:	e9 1a ff ff ff       	jmp    8023b6 <__divdi3+0x56>
+  80249c:	31 ff                	xor    %edi,%edi
+  80249e:	e9 20 ff ff ff       	jmp    8023c3 <__divdi3+0x63>
+  8024a3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8024aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+008024b0 <__moddi3>:
+  8024b0:	55                   	push   %ebp
+  8024b1:	57                   	push   %edi
+  8024b2:	56                   	push   %esi
+  8024b3:	53                   	push   %ebx
+  8024b4:	83 ec 1c             	sub    $0x1c,%esp
+  8024b7:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  8024bb:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  8024bf:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  8024c3:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  8024c7:	89 c8                	mov    %ecx,%eax
+  8024c9:	89 f2                	mov    %esi,%edx
+  8024cb:	89 f3                	mov    %esi,%ebx
+  8024cd:	85 ed                	test   %ebp,%ebp
+  8024cf:	0f 88 9d 00 00 00    	js     802572 <__moddi3+0xc2>
+  8024d5:	09 cb                	or     %ecx,%ebx
+  8024d7:	0f 84 8d 00 00 00    	je     80256a <__moddi3+0xba>
+  8024dd:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  8024e1:	31 db                	xor    %ebx,%ebx
+  8024e3:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  8024e7:	89 ca                	mov    %ecx,%edx
+  8024e9:	89 f0                	mov    %esi,%eax
+  8024eb:	89 dd                	mov    %ebx,%ebp
+  8024ed:	f7 da                	neg    %edx
+  8024ef:	83 d0 00             	adc    $0x0,%eax
+  8024f2:	f7 d8                	neg    %eax
+  8024f4:	0f 49 f0             	cmovns %eax,%esi
+  8024f7:	0f 49 ca             	cmovns %edx,%ecx
+  8024fa:	31 c0                	xor    %eax,%eax
+  8024fc:	31 d2                	xor    %edx,%edx
+  8024fe:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802502:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802506:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80250b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80250f:	90                   	nop
+  802510:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802514:	01 c0                	add    %eax,%eax
+  802516:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80251d:	00 
+  80251e:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  802522:	89 c6                	mov    %eax,%esi
+  802524:	89 d7                	mov    %edx,%edi
+  802526:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80252a:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80252e:	0f ad d0             	shrd   %cl,%edx,%eax
+  802531:	d3 ea                	shr    %cl,%edx
+  802533:	f6 c1 20             	test   $0x20,%cl
+  802536:	0f 45 c2             	cmovne %edx,%eax
+  802539:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80253d:	83 e0 01             	and    $0x1,%eax
+  802540:	09 fa                	or     %edi,%edx
+  802542:	89 04 24             	mov    %eax,(%esp)
+  802545:	8b 04 24             	mov    (%esp),%eax
+  802548:	89 d7                	mov    %edx,%edi
+  80254a:	09 f0                	or     %esi,%eax
+  80254c:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  802550:	39 d8                	cmp    %ebx,%eax
+  802552:	19 f7                	sbb    %esi,%edi
+  802554:	72 04                	jb     80255a <__moddi3+0xaa>
+  802556:	29 d8                	sub    %ebx,%eax
+  802558:	19 f2                	sbb    %esi,%edx
+  80255a:	83 e9 01             	sub    $0x1,%ecx
+  80255d:	73 b1                	jae    802510 <__moddi3+0x60>
+  80255f:	85 ed                	test   %ebp,%ebp
+  802561:	74 07                	je     80256a <__moddi3+0xba>
+  802563:	f7 d8                	neg    %eax
+  802565:	83 d2 00             	adc    $0x0,%edx
+  802568:	f7 da                	neg    %edx
+  80256a:	83 c4 1c             	add    $0x1c,%esp
+  80256d:	5b                   	pop    %ebx
+  80256e:	5e                   	pop    %esi
+  80256f:	5f                   	pop    %edi
+  802570:	5d                   	pop    %ebp
+  802571:	c3                   	ret
+  802572:	09 cb                	or     %ecx,%ebx
+  802574:	74 f4                	je     80256a <__moddi3+0xba>
+  802576:	f7 df                	neg    %edi
+  802578:	bb 01 00 00 00       	mov    $0x1,%ebx
+  80257d:	83 d5 00             	adc    $0x0,%ebp
+  802580:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802584:	f7 dd                	neg    %ebp
+  802586:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  80258a:	e9 58 ff ff ff       	jmp    8024e7 <__moddi3+0x37>
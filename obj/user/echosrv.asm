@@ -0,0 +1,5901 @@
+
+obj/user/echosrv.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 be 04 00 00       	call   8004ef <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <die>:
+#define BUFFSIZE 32
+#define MAXPENDING 5    // Max connection requests
+
+static void
+die(char *m)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	cprintf("%s\n", m);
+  800039:	50                   	push   %eax
+  80003a:	68 f0 29 80 00       	push   $0x8029f0
+  80003f:	e8 a3 05 00 00       	call   8005e7 <cprintf>
+	exit();
+  800044:	e8 ef 04 00 00       	call   800538 <exit>
+}
+  800049:	83 c4 10             	add    $0x10,%esp
+  80004c:	c9                   	leave
+  80004d:	c3                   	ret
+
+0080004e <handle_client>:
+
+void
+handle_client(int sock)
+{
+  80004e:	55                   	push   %ebp
+  80004f:	89 e5                	mov    %esp,%ebp
+  800051:	57                   	push   %edi
+  800052:	56                   	push   %esi
+  800053:	53                   	push   %ebx
+  800054:	83 ec 30             	sub    $0x30,%esp
+  800057:	8b 75 08             	mov    0x8(%ebp),%esi
+	char buffer[BUFFSIZE];
+	int received = -1;
+	// Receive message
+	if ((received = read(sock, buffer, BUFFSIZE)) < 0)
+  80005a:	6a 20                	push   $0x20
+  80005c:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  80005f:	50                   	push   %eax
+  800060:	56                   	push   %esi
+  800061:	e8 dc 14 00 00       	call   801542 <read>
+  800066:	89 c3                	mov    %eax,%ebx
+  800068:	83 c4 10             	add    $0x10,%esp
+		die("Failed to receive initial bytes from client");
+
+	// Send bytes and check for more incoming data in loop
+	while (received > 0) {
+		// Send back received data
+		if (write(sock, buffer, received) != received)
+  80006b:	8d 7d c8             	lea    -0x38(%ebp),%edi
+	if ((received = read(sock, buffer, BUFFSIZE)) < 0)
+  80006e:	85 c0                	test   %eax,%eax
+  800070:	79 33                	jns    8000a5 <handle_client+0x57>
+		die("Failed to receive initial bytes from client");
+  800072:	b8 f4 29 80 00       	mov    $0x8029f4,%eax
+  800077:	e8 b7 ff ff ff       	call   800033 <die>
+
+		// Check for more data
+		if ((received = read(sock, buffer, BUFFSIZE)) < 0)
+			die("Failed to receive additional bytes from client");
+	}
+	close(sock);
+  80007c:	83 ec 0c             	sub    $0xc,%esp
+  80007f:	56                   	push   %esi
+  800080:	e8 81 13 00 00       	call   801406 <close>
+}
+  800085:	83 c4 10             	add    $0x10,%esp
+  800088:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80008b:	5b                   	pop    %ebx
+  80008c:	5e                   	pop    %esi
+  80008d:	5f                   	pop    %edi
+  80008e:	5d                   	pop    %ebp
+  80008f:	c3                   	ret
+		if ((received = read(sock, buffer, BUFFSIZE)) < 0)
+  800090:	83 ec 04             	sub    $0x4,%esp
+  800093:	6a 20                	push   $0x20
+  800095:	57                   	push   %edi
+  800096:	56                   	push   %esi
+  800097:	e8 a6 14 00 00       	call   801542 <read>
+  80009c:	89 c3                	mov    %eax,%ebx
+  80009e:	83 c4 10             	add    $0x10,%esp
+  8000a1:	85 c0                	test   %eax,%eax
+  8000a3:	78 22                	js     8000c7 <handle_client+0x79>
+	while (received > 0) {
+  8000a5:	85 db                	test   %ebx,%ebx
+  8000a7:	7e d3                	jle    80007c <handle_client+0x2e>
+		if (write(sock, buffer, received) != received)
+  8000a9:	83 ec 04             	sub    $0x4,%esp
+  8000ac:	53                   	push   %ebx
+  8000ad:	57                   	push   %edi
+  8000ae:	56                   	push   %esi
+  8000af:	e8 5c 15 00 00       	call   801610 <write>
+  8000b4:	83 c4 10             	add    $0x10,%esp
+  8000b7:	39 d8                	cmp    %ebx,%eax
+  8000b9:	74 d5                	je     800090 <handle_client+0x42>
+			die("Failed to send bytes to client");
+  8000bb:	b8 20 2a 80 00       	mov    $0x802a20,%eax
+  8000c0:	e8 6e ff ff ff       	call   800033 <die>
+  8000c5:	eb c9                	jmp    800090 <handle_client+0x42>
+			die("Failed to receive additional bytes from client");
+  8000c7:	b8 40 2a 80 00       	mov    $0x802a40,%eax
+  8000cc:	e8 62 ff ff ff       	call   800033 <die>
+  8000d1:	eb d2                	jmp    8000a5 <handle_client+0x57>
+
+008000d3 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8000d3:	55                   	push   %ebp
+  8000d4:	89 e5                	mov    %esp,%ebp
+  8000d6:	57                   	push   %edi
+  8000d7:	56                   	push   %esi
+  8000d8:	53                   	push   %ebx
+  8000d9:	83 ec 40             	sub    $0x40,%esp
+	char buffer[BUFFSIZE];
+	unsigned int echolen;
+	int received = 0;
+
+	// Create the TCP socket
+	if ((serversock = socket(PF_INET, SOCK_STREAM, IPPROTO_TCP)) < 0)
+  8000dc:	6a 06                	push   $0x6
+  8000de:	6a 01                	push   $0x1
+  8000e0:	6a 02                	push   $0x2
+  8000e2:	e8 4c 1b 00 00       	call   801c33 <socket>
+  8000e7:	89 c6                	mov    %eax,%esi
+  8000e9:	83 c4 10             	add    $0x10,%esp
+  8000ec:	85 c0                	test   %eax,%eax
+  8000ee:	0f 88 86 00 00 00    	js     80017a <umain+0xa7>
+		die("Failed to create socket");
+
+	cprintf("opened socket\n");
+  8000f4:	83 ec 0c             	sub    $0xc,%esp
+  8000f7:	68 b8 29 80 00       	push   $0x8029b8
+  8000fc:	e8 e6 04 00 00       	call   8005e7 <cprintf>
+
+	// Construct the server sockaddr_in structure
+	memset(&echoserver, 0, sizeof(echoserver));       // Clear struct
+  800101:	83 c4 0c             	add    $0xc,%esp
+  800104:	6a 10                	push   $0x10
+  800106:	6a 00                	push   $0x0
+  800108:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+  80010b:	53                   	push   %ebx
+  80010c:	e8 e0 0b 00 00       	call   800cf1 <memset>
+	echoserver.sin_family = AF_INET;                  // Internet/IP
+  800111:	c6 45 d9 02          	movb   $0x2,-0x27(%ebp)
+	echoserver.sin_addr.s_addr = htonl(INADDR_ANY);   // IP address
+  800115:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80011c:	e8 90 01 00 00       	call   8002b1 <htonl>
+  800121:	89 45 dc             	mov    %eax,-0x24(%ebp)
+	echoserver.sin_port = htons(PORT);		  // server port
+  800124:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80012b:	e8 67 01 00 00       	call   800297 <htons>
+  800130:	66 89 45 da          	mov    %ax,-0x26(%ebp)
+
+	cprintf("trying to bind\n");
+  800134:	c7 04 24 c7 29 80 00 	movl   $0x8029c7,(%esp)
+  80013b:	e8 a7 04 00 00       	call   8005e7 <cprintf>
+
+	// Bind the server socket
+	if (bind(serversock, (struct sockaddr *) &echoserver,
+  800140:	83 c4 0c             	add    $0xc,%esp
+  800143:	6a 10                	push   $0x10
+  800145:	53                   	push   %ebx
+  800146:	56                   	push   %esi
+  800147:	e8 55 1a 00 00       	call   801ba1 <bind>
+  80014c:	83 c4 10             	add    $0x10,%esp
+  80014f:	85 c0                	test   %eax,%eax
+  800151:	78 36                	js     800189 <umain+0xb6>
+		 sizeof(echoserver)) < 0) {
+		die("Failed to bind the server socket");
+	}
+
+	// Listen on the server socket
+	if (listen(serversock, MAXPENDING) < 0)
+  800153:	83 ec 08             	sub    $0x8,%esp
+  800156:	6a 05                	push   $0x5
+  800158:	56                   	push   %esi
+  800159:	e8 b2 1a 00 00       	call   801c10 <listen>
+  80015e:	83 c4 10             	add    $0x10,%esp
+  800161:	85 c0                	test   %eax,%eax
+  800163:	78 30                	js     800195 <umain+0xc2>
+		die("Failed to listen on server socket");
+
+	cprintf("bound\n");
+  800165:	83 ec 0c             	sub    $0xc,%esp
+  800168:	68 d7 29 80 00       	push   $0x8029d7
+  80016d:	e8 75 04 00 00       	call   8005e7 <cprintf>
+  800172:	83 c4 10             	add    $0x10,%esp
+	// Run until canceled
+	while (1) {
+		unsigned int clientlen = sizeof(echoclient);
+		// Wait for client connection
+		if ((clientsock =
+		     accept(serversock, (struct sockaddr *) &echoclient,
+  800175:	8d 7d c4             	lea    -0x3c(%ebp),%edi
+  800178:	eb 55                	jmp    8001cf <umain+0xfc>
+		die("Failed to create socket");
+  80017a:	b8 a0 29 80 00       	mov    $0x8029a0,%eax
+  80017f:	e8 af fe ff ff       	call   800033 <die>
+  800184:	e9 6b ff ff ff       	jmp    8000f4 <umain+0x21>
+		die("Failed to bind the server socket");
+  800189:	b8 70 2a 80 00       	mov    $0x802a70,%eax
+  80018e:	e8 a0 fe ff ff       	call   800033 <die>
+  800193:	eb be                	jmp    800153 <umain+0x80>
+		die("Failed to listen on server socket");
+  800195:	b8 94 2a 80 00       	mov    $0x802a94,%eax
+  80019a:	e8 94 fe ff ff       	call   800033 <die>
+  80019f:	eb c4                	jmp    800165 <umain+0x92>
+			    &clientlen)) < 0) {
+			die("Failed to accept client connection");
+  8001a1:	b8 b8 2a 80 00       	mov    $0x802ab8,%eax
+  8001a6:	e8 88 fe ff ff       	call   800033 <die>
+		}
+		cprintf("Client connected: %s\n", inet_ntoa(echoclient.sin_addr));
+  8001ab:	83 ec 0c             	sub    $0xc,%esp
+  8001ae:	ff 75 cc             	push   -0x34(%ebp)
+  8001b1:	e8 39 00 00 00       	call   8001ef <inet_ntoa>
+  8001b6:	83 c4 08             	add    $0x8,%esp
+  8001b9:	50                   	push   %eax
+  8001ba:	68 de 29 80 00       	push   $0x8029de
+  8001bf:	e8 23 04 00 00       	call   8005e7 <cprintf>
+		handle_client(clientsock);
+  8001c4:	89 1c 24             	mov    %ebx,(%esp)
+  8001c7:	e8 82 fe ff ff       	call   80004e <handle_client>
+	while (1) {
+  8001cc:	83 c4 10             	add    $0x10,%esp
+		unsigned int clientlen = sizeof(echoclient);
+  8001cf:	c7 45 c4 10 00 00 00 	movl   $0x10,-0x3c(%ebp)
+		     accept(serversock, (struct sockaddr *) &echoclient,
+  8001d6:	83 ec 04             	sub    $0x4,%esp
+  8001d9:	57                   	push   %edi
+  8001da:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  8001dd:	50                   	push   %eax
+  8001de:	56                   	push   %esi
+  8001df:	e8 8e 19 00 00       	call   801b72 <accept>
+  8001e4:	89 c3                	mov    %eax,%ebx
+		if ((clientsock =
+  8001e6:	83 c4 10             	add    $0x10,%esp
+  8001e9:	85 c0                	test   %eax,%eax
+  8001eb:	78 b4                	js     8001a1 <umain+0xce>
+  8001ed:	eb bc                	jmp    8001ab <umain+0xd8>
+
+008001ef <inet_ntoa>:
+ * @return pointer to a global static (!) buffer that holds the ASCII
+ *         represenation of addr
+ */
+char *
+inet_ntoa(struct in_addr addr)
+{
+  8001ef:	55                   	push   %ebp
+  8001f0:	89 e5                	mov    %esp,%ebp
+  8001f2:	57                   	push   %edi
+  8001f3:	56                   	push   %esi
+  8001f4:	53                   	push   %ebx
+  8001f5:	83 ec 1c             	sub    $0x1c,%esp
+  static char str[16];
+  u32_t s_addr = addr.s_addr;
+  8001f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001fb:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  u8_t rem;
+  u8_t n;
+  u8_t i;
+
+  rp = str;
+  ap = (u8_t *)&s_addr;
+  8001fe:	8d 7d f0             	lea    -0x10(%ebp),%edi
+  rp = str;
+  800201:	b9 00 40 80 00       	mov    $0x804000,%ecx
+  for(n = 0; n < 4; n++) {
+    i = 0;
+    do {
+      rem = *ap % (u8_t)10;
+  800206:	be cd ff ff ff       	mov    $0xffffffcd,%esi
+  80020b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80020e:	eb 31                	jmp    800241 <inet_ntoa+0x52>
+      *ap /= (u8_t)10;
+      inv[i++] = '0' + rem;
+    } while(*ap);
+    while(i--)
+      *rp++ = inv[i];
+  800210:	0f b6 c8             	movzbl %al,%ecx
+  800213:	0f b6 4c 0d ed       	movzbl -0x13(%ebp,%ecx,1),%ecx
+  800218:	88 0a                	mov    %cl,(%edx)
+  80021a:	83 c2 01             	add    $0x1,%edx
+    while(i--)
+  80021d:	83 e8 01             	sub    $0x1,%eax
+  800220:	3c ff                	cmp    $0xff,%al
+  800222:	75 ec                	jne    800210 <inet_ntoa+0x21>
+  800224:	0f b6 db             	movzbl %bl,%ebx
+  800227:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80022a:	01 d8                	add    %ebx,%eax
+  80022c:	89 c3                	mov    %eax,%ebx
+    *rp++ = '.';
+  80022e:	8d 40 01             	lea    0x1(%eax),%eax
+  800231:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800234:	c6 03 2e             	movb   $0x2e,(%ebx)
+    ap++;
+  800237:	83 c7 01             	add    $0x1,%edi
+  for(n = 0; n < 4; n++) {
+  80023a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80023d:	39 c7                	cmp    %eax,%edi
+  80023f:	74 46                	je     800287 <inet_ntoa+0x98>
+  800241:	0f b6 17             	movzbl (%edi),%edx
+    i = 0;
+  800244:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800249:	89 7d d8             	mov    %edi,-0x28(%ebp)
+      rem = *ap % (u8_t)10;
+  80024c:	89 f0                	mov    %esi,%eax
+  80024e:	f6 e2                	mul    %dl
+  800250:	66 c1 e8 0b          	shr    $0xb,%ax
+  800254:	88 45 e3             	mov    %al,-0x1d(%ebp)
+  800257:	8d 0c 80             	lea    (%eax,%eax,4),%ecx
+  80025a:	01 c9                	add    %ecx,%ecx
+  80025c:	89 d0                	mov    %edx,%eax
+  80025e:	29 c8                	sub    %ecx,%eax
+      *ap /= (u8_t)10;
+  800260:	89 d7                	mov    %edx,%edi
+  800262:	0f b6 55 e3          	movzbl -0x1d(%ebp),%edx
+      inv[i++] = '0' + rem;
+  800266:	89 d9                	mov    %ebx,%ecx
+  800268:	83 c3 01             	add    $0x1,%ebx
+  80026b:	0f b6 c9             	movzbl %cl,%ecx
+  80026e:	83 c0 30             	add    $0x30,%eax
+  800271:	88 44 0d ed          	mov    %al,-0x13(%ebp,%ecx,1)
+    } while(*ap);
+  800275:	89 f8                	mov    %edi,%eax
+  800277:	3c 09                	cmp    $0x9,%al
+  800279:	77 d1                	ja     80024c <inet_ntoa+0x5d>
+  80027b:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  80027e:	88 17                	mov    %dl,(%edi)
+  800280:	8b 55 dc             	mov    -0x24(%ebp),%edx
+      inv[i++] = '0' + rem;
+  800283:	89 d8                	mov    %ebx,%eax
+  800285:	eb 96                	jmp    80021d <inet_ntoa+0x2e>
+  }
+  *--rp = 0;
+  800287:	c6 03 00             	movb   $0x0,(%ebx)
+  return str;
+}
+  80028a:	b8 00 40 80 00       	mov    $0x804000,%eax
+  80028f:	83 c4 1c             	add    $0x1c,%esp
+  800292:	5b                   	pop    %ebx
+  800293:	5e                   	pop    %esi
+  800294:	5f                   	pop    %edi
+  800295:	5d                   	pop    %ebp
+  800296:	c3                   	ret
+
+00800297 <htons>:
+ * @param n u16_t in host byte order
+ * @return n in network byte order
+ */
+u16_t
+htons(u16_t n)
+{
+  800297:	55                   	push   %ebp
+  800298:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  80029a:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  80029e:	66 c1 c0 08          	rol    $0x8,%ax
+}
+  8002a2:	5d                   	pop    %ebp
+  8002a3:	c3                   	ret
+
+008002a4 <ntohs>:
+ * @param n u16_t in network byte order
+ * @return n in host byte order
+ */
+u16_t
+ntohs(u16_t n)
+{
+  8002a4:	55                   	push   %ebp
+  8002a5:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  8002a7:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  8002ab:	66 c1 c0 08          	rol    $0x8,%ax
+  return htons(n);
+}
+  8002af:	5d                   	pop    %ebp
+  8002b0:	c3                   	ret
+
+008002b1 <htonl>:
+ * @param n u32_t in host byte order
+ * @return n in network byte order
+ */
+u32_t
+htonl(u32_t n)
+{
+  8002b1:	55                   	push   %ebp
+  8002b2:	89 e5                	mov    %esp,%ebp
+  8002b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  return ((n & 0xff) << 24) |
+  8002b7:	89 d0                	mov    %edx,%eax
+  8002b9:	c1 e0 18             	shl    $0x18,%eax
+    ((n & 0xff00) << 8) |
+    ((n & 0xff0000UL) >> 8) |
+    ((n & 0xff000000UL) >> 24);
+  8002bc:	89 d1                	mov    %edx,%ecx
+  8002be:	c1 e9 18             	shr    $0x18,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  8002c1:	09 c8                	or     %ecx,%eax
+    ((n & 0xff00) << 8) |
+  8002c3:	89 d1                	mov    %edx,%ecx
+  8002c5:	c1 e1 08             	shl    $0x8,%ecx
+  8002c8:	81 e1 00 00 ff 00    	and    $0xff0000,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  8002ce:	09 c8                	or     %ecx,%eax
+  8002d0:	c1 ea 08             	shr    $0x8,%edx
+  8002d3:	81 e2 00 ff 00 00    	and    $0xff00,%edx
+  8002d9:	09 d0                	or     %edx,%eax
+}
+  8002db:	5d                   	pop    %ebp
+  8002dc:	c3                   	ret
+
+008002dd <inet_aton>:
+{
+  8002dd:	55                   	push   %ebp
+  8002de:	89 e5                	mov    %esp,%ebp
+  8002e0:	57                   	push   %edi
+  8002e1:	56                   	push   %esi
+  8002e2:	53                   	push   %ebx
+  8002e3:	83 ec 2c             	sub    $0x2c,%esp
+  8002e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  c = *cp;
+  8002e9:	0f be 02             	movsbl (%edx),%eax
+  u32_t *pp = parts;
+  8002ec:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+      if (pp >= parts + 3)
+  8002ef:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  8002f2:	e9 9b 00 00 00       	jmp    800392 <inet_aton+0xb5>
+      c = *++cp;
+  8002f7:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+      if (c == 'x' || c == 'X') {
+  8002fb:	89 c1                	mov    %eax,%ecx
+  8002fd:	83 e1 df             	and    $0xffffffdf,%ecx
+  800300:	80 f9 58             	cmp    $0x58,%cl
+  800303:	74 10                	je     800315 <inet_aton+0x38>
+      c = *++cp;
+  800305:	83 c2 01             	add    $0x1,%edx
+  800308:	0f be c0             	movsbl %al,%eax
+        base = 8;
+  80030b:	bf 08 00 00 00       	mov    $0x8,%edi
+  800310:	e9 97 00 00 00       	jmp    8003ac <inet_aton+0xcf>
+        c = *++cp;
+  800315:	0f be 42 02          	movsbl 0x2(%edx),%eax
+  800319:	8d 52 02             	lea    0x2(%edx),%edx
+        base = 16;
+  80031c:	bf 10 00 00 00       	mov    $0x10,%edi
+  800321:	e9 86 00 00 00       	jmp    8003ac <inet_aton+0xcf>
+        val = (val * base) + (int)(c - '0');
+  800326:	0f af d7             	imul   %edi,%edx
+  800329:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+        c = *++cp;
+  80032d:	0f be 01             	movsbl (%ecx),%eax
+  800330:	83 c1 01             	add    $0x1,%ecx
+      if (isdigit(c)) {
+  800333:	88 45 d7             	mov    %al,-0x29(%ebp)
+  800336:	8d 58 d0             	lea    -0x30(%eax),%ebx
+  800339:	80 fb 09             	cmp    $0x9,%bl
+  80033c:	76 e8                	jbe    800326 <inet_aton+0x49>
+      } else if (base == 16 && isxdigit(c)) {
+  80033e:	83 ff 10             	cmp    $0x10,%edi
+  800341:	75 2e                	jne    800371 <inet_aton+0x94>
+  800343:	0f b6 5d d7          	movzbl -0x29(%ebp),%ebx
+  800347:	8d 73 9f             	lea    -0x61(%ebx),%esi
+  80034a:	83 e3 df             	and    $0xffffffdf,%ebx
+  80034d:	83 eb 41             	sub    $0x41,%ebx
+  800350:	80 fb 05             	cmp    $0x5,%bl
+  800353:	77 1c                	ja     800371 <inet_aton+0x94>
+        val = (val << 4) | (int)(c + 10 - (islower(c) ? 'a' : 'A'));
+  800355:	c1 e2 04             	shl    $0x4,%edx
+  800358:	83 c0 0a             	add    $0xa,%eax
+  80035b:	89 f3                	mov    %esi,%ebx
+  80035d:	80 fb 1a             	cmp    $0x1a,%bl
+  800360:	19 db                	sbb    %ebx,%ebx
+  800362:	83 e3 20             	and    $0x20,%ebx
+  800365:	83 c3 41             	add    $0x41,%ebx
+  800368:	29 d8                	sub    %ebx,%eax
+  80036a:	09 c2                	or     %eax,%edx
+        c = *++cp;
+  80036c:	0f be 01             	movsbl (%ecx),%eax
+  80036f:	eb bf                	jmp    800330 <inet_aton+0x53>
+    if (c == '.') {
+  800371:	83 f8 2e             	cmp    $0x2e,%eax
+  800374:	75 43                	jne    8003b9 <inet_aton+0xdc>
+      if (pp >= parts + 3)
+  800376:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800379:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  80037c:	39 f0                	cmp    %esi,%eax
+  80037e:	0f 84 22 01 00 00    	je     8004a6 <inet_aton+0x1c9>
+      *pp++ = val;
+  800384:	83 c0 04             	add    $0x4,%eax
+  800387:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80038a:	89 50 fc             	mov    %edx,-0x4(%eax)
+      c = *++cp;
+  80038d:	89 ca                	mov    %ecx,%edx
+  80038f:	0f be 01             	movsbl (%ecx),%eax
+    if (!isdigit(c))
+  800392:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  800395:	80 f9 09             	cmp    $0x9,%cl
+  800398:	0f 87 01 01 00 00    	ja     80049f <inet_aton+0x1c2>
+    base = 10;
+  80039e:	bf 0a 00 00 00       	mov    $0xa,%edi
+    if (c == '0') {
+  8003a3:	83 f8 30             	cmp    $0x30,%eax
+  8003a6:	0f 84 4b ff ff ff    	je     8002f7 <inet_aton+0x1a>
+  8003ac:	8d 4a 01             	lea    0x1(%edx),%ecx
+        base = 8;
+  8003af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003b4:	e9 7a ff ff ff       	jmp    800333 <inet_aton+0x56>
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  8003b9:	0f b6 7d d7          	movzbl -0x29(%ebp),%edi
+  8003bd:	89 d6                	mov    %edx,%esi
+  8003bf:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8003c2:	85 c0                	test   %eax,%eax
+  8003c4:	74 2e                	je     8003f4 <inet_aton+0x117>
+    return (0);
+  8003c6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  8003cb:	89 fa                	mov    %edi,%edx
+  8003cd:	80 fa 1f             	cmp    $0x1f,%dl
+  8003d0:	0f 86 d5 00 00 00    	jbe    8004ab <inet_aton+0x1ce>
+  8003d6:	84 c0                	test   %al,%al
+  8003d8:	0f 88 cd 00 00 00    	js     8004ab <inet_aton+0x1ce>
+  8003de:	8d 48 f7             	lea    -0x9(%eax),%ecx
+  8003e1:	83 f9 04             	cmp    $0x4,%ecx
+  8003e4:	76 0e                	jbe    8003f4 <inet_aton+0x117>
+    return (0);
+  8003e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  8003eb:	83 f8 20             	cmp    $0x20,%eax
+  8003ee:	0f 85 b7 00 00 00    	jne    8004ab <inet_aton+0x1ce>
+  n = pp - parts + 1;
+  8003f4:	8d 4d d8             	lea    -0x28(%ebp),%ecx
+  8003f7:	89 d8                	mov    %ebx,%eax
+  8003f9:	29 c8                	sub    %ecx,%eax
+  8003fb:	c1 f8 02             	sar    $0x2,%eax
+  8003fe:	8d 48 01             	lea    0x1(%eax),%ecx
+  switch (n) {
+  800401:	83 f8 02             	cmp    $0x2,%eax
+  800404:	74 7a                	je     800480 <inet_aton+0x1a3>
+  800406:	83 f9 03             	cmp    $0x3,%ecx
+  800409:	7f 49                	jg     800454 <inet_aton+0x177>
+  80040b:	85 c9                	test   %ecx,%ecx
+  80040d:	0f 84 98 00 00 00    	je     8004ab <inet_aton+0x1ce>
+  800413:	83 f9 02             	cmp    $0x2,%ecx
+  800416:	75 19                	jne    800431 <inet_aton+0x154>
+      return (0);
+  800418:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffffffUL)
+  80041d:	81 fe ff ff ff 00    	cmp    $0xffffff,%esi
+  800423:	0f 87 82 00 00 00    	ja     8004ab <inet_aton+0x1ce>
+    val |= parts[0] << 24;
+  800429:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80042c:	c1 e0 18             	shl    $0x18,%eax
+  80042f:	09 c6                	or     %eax,%esi
+  return (1);
+  800431:	b9 01 00 00 00       	mov    $0x1,%ecx
+  if (addr)
+  800436:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80043a:	74 6f                	je     8004ab <inet_aton+0x1ce>
+    addr->s_addr = htonl(val);
+  80043c:	83 ec 0c             	sub    $0xc,%esp
+  80043f:	56                   	push   %esi
+  800440:	e8 6c fe ff ff       	call   8002b1 <htonl>
+  800445:	83 c4 10             	add    $0x10,%esp
+  800448:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80044b:	89 06                	mov    %eax,(%esi)
+  return (1);
+  80044d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800452:	eb 57                	jmp    8004ab <inet_aton+0x1ce>
+  switch (n) {
+  800454:	83 f9 04             	cmp    $0x4,%ecx
+  800457:	75 d8                	jne    800431 <inet_aton+0x154>
+      return (0);
+  800459:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xff)
+  80045e:	81 fe ff 00 00 00    	cmp    $0xff,%esi
+  800464:	77 45                	ja     8004ab <inet_aton+0x1ce>
+    val |= (parts[0] << 24) | (parts[1] << 16) | (parts[2] << 8);
+  800466:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  800469:	c1 e0 18             	shl    $0x18,%eax
+  80046c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80046f:	c1 e1 10             	shl    $0x10,%ecx
+  800472:	09 c8                	or     %ecx,%eax
+  800474:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  800477:	c1 e1 08             	shl    $0x8,%ecx
+  80047a:	09 c8                	or     %ecx,%eax
+  80047c:	09 c6                	or     %eax,%esi
+    break;
+  80047e:	eb b1                	jmp    800431 <inet_aton+0x154>
+      return (0);
+  800480:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffff)
+  800485:	81 fe ff ff 00 00    	cmp    $0xffff,%esi
+  80048b:	77 1e                	ja     8004ab <inet_aton+0x1ce>
+    val |= (parts[0] << 24) | (parts[1] << 16);
+  80048d:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  800490:	c1 e0 18             	shl    $0x18,%eax
+  800493:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800496:	c1 e1 10             	shl    $0x10,%ecx
+  800499:	09 c8                	or     %ecx,%eax
+  80049b:	09 c6                	or     %eax,%esi
+    break;
+  80049d:	eb 92                	jmp    800431 <inet_aton+0x154>
+      return (0);
+  80049f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004a4:	eb 05                	jmp    8004ab <inet_aton+0x1ce>
+        return (0);
+  8004a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+}
+  8004ab:	89 c8                	mov    %ecx,%eax
+  8004ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004b0:	5b                   	pop    %ebx
+  8004b1:	5e                   	pop    %esi
+  8004b2:	5f                   	pop    %edi
+  8004b3:	5d                   	pop    %ebp
+  8004b4:	c3                   	ret
+
+008004b5 <inet_addr>:
+{
+  8004b5:	55                   	push   %ebp
+  8004b6:	89 e5                	mov    %esp,%ebp
+  8004b8:	83 ec 20             	sub    $0x20,%esp
+  if (inet_aton(cp, &val)) {
+  8004bb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8004be:	50                   	push   %eax
+  8004bf:	ff 75 08             	push   0x8(%ebp)
+  8004c2:	e8 16 fe ff ff       	call   8002dd <inet_aton>
+  8004c7:	89 c2                	mov    %eax,%edx
+  8004c9:	83 c4 10             	add    $0x10,%esp
+  return (INADDR_NONE);
+  8004cc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  if (inet_aton(cp, &val)) {
+  8004d1:	85 d2                	test   %edx,%edx
+  8004d3:	75 02                	jne    8004d7 <inet_addr+0x22>
+}
+  8004d5:	c9                   	leave
+  8004d6:	c3                   	ret
+    return (val.s_addr);
+  8004d7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8004da:	eb f9                	jmp    8004d5 <inet_addr+0x20>
+
+008004dc <ntohl>:
+ * @param n u32_t in network byte order
+ * @return n in host byte order
+ */
+u32_t
+ntohl(u32_t n)
+{
+  8004dc:	55                   	push   %ebp
+  8004dd:	89 e5                	mov    %esp,%ebp
+  8004df:	83 ec 14             	sub    $0x14,%esp
+  return htonl(n);
+  8004e2:	ff 75 08             	push   0x8(%ebp)
+  8004e5:	e8 c7 fd ff ff       	call   8002b1 <htonl>
+  8004ea:	83 c4 10             	add    $0x10,%esp
+}
+  8004ed:	c9                   	leave
+  8004ee:	c3                   	ret
+
+008004ef <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  8004ef:	55                   	push   %ebp
+  8004f0:	89 e5                	mov    %esp,%ebp
+  8004f2:	56                   	push   %esi
+  8004f3:	53                   	push   %ebx
+  8004f4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8004f7:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  8004fa:	e8 4f 0a 00 00       	call   800f4e <sys_getenvid>
+  8004ff:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800504:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800507:	c1 e0 04             	shl    $0x4,%eax
+  80050a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80050f:	a3 18 40 80 00       	mov    %eax,0x804018
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800514:	85 db                	test   %ebx,%ebx
+  800516:	7e 07                	jle    80051f <libmain+0x30>
+    binaryname = argv[0];
+  800518:	8b 06                	mov    (%esi),%eax
+  80051a:	a3 00 30 80 00       	mov    %eax,0x803000
+
+  // call user main routine
+  umain(argc, argv);
+  80051f:	83 ec 08             	sub    $0x8,%esp
+  800522:	56                   	push   %esi
+  800523:	53                   	push   %ebx
+  800524:	e8 aa fb ff ff       	call   8000d3 <umain>
+
+  // exit gracefully
+  exit();
+  800529:	e8 0a 00 00 00       	call   800538 <exit>
+}
+  80052e:	83 c4 10             	add    $0x10,%esp
+  800531:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800534:	5b                   	pop    %ebx
+  800535:	5e                   	pop    %esi
+  800536:	5d                   	pop    %ebp
+  800537:	c3                   	ret
+
+00800538 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800538:	55                   	push   %ebp
+  800539:	89 e5                	mov    %esp,%ebp
+  80053b:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80053e:	e8 f0 0e 00 00       	call   801433 <close_all>
+	sys_env_destroy(0);
+  800543:	83 ec 0c             	sub    $0xc,%esp
+  800546:	6a 00                	push   $0x0
+  800548:	e8 c0 09 00 00       	call   800f0d <sys_env_destroy>
+}
+  80054d:	83 c4 10             	add    $0x10,%esp
+  800550:	c9                   	leave
+  800551:	c3                   	ret
+
+00800552 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800552:	55                   	push   %ebp
+  800553:	89 e5                	mov    %esp,%ebp
+  800555:	53                   	push   %ebx
+  800556:	83 ec 04             	sub    $0x4,%esp
+  800559:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80055c:	8b 13                	mov    (%ebx),%edx
+  80055e:	8d 42 01             	lea    0x1(%edx),%eax
+  800561:	89 03                	mov    %eax,(%ebx)
+  800563:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800566:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80056a:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80056f:	74 09                	je     80057a <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800571:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800575:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800578:	c9                   	leave
+  800579:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80057a:	83 ec 08             	sub    $0x8,%esp
+  80057d:	68 ff 00 00 00       	push   $0xff
+  800582:	8d 43 08             	lea    0x8(%ebx),%eax
+  800585:	50                   	push   %eax
+  800586:	e8 45 09 00 00       	call   800ed0 <sys_cputs>
+		b->idx = 0;
+  80058b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800591:	83 c4 10             	add    $0x10,%esp
+  800594:	eb db                	jmp    800571 <putch+0x1f>
+
+00800596 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800596:	55                   	push   %ebp
+  800597:	89 e5                	mov    %esp,%ebp
+  800599:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80059f:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8005a6:	00 00 00 
+	b.cnt = 0;
+  8005a9:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8005b0:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8005b3:	ff 75 0c             	push   0xc(%ebp)
+  8005b6:	ff 75 08             	push   0x8(%ebp)
+  8005b9:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8005bf:	50                   	push   %eax
+  8005c0:	68 52 05 80 00       	push   $0x800552
+  8005c5:	e8 14 01 00 00       	call   8006de <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8005ca:	83 c4 08             	add    $0x8,%esp
+  8005cd:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8005d3:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8005d9:	50                   	push   %eax
+  8005da:	e8 f1 08 00 00       	call   800ed0 <sys_cputs>
+
+	return b.cnt;
+}
+  8005df:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8005e5:	c9                   	leave
+  8005e6:	c3                   	ret
+
+008005e7 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8005e7:	55                   	push   %ebp
+  8005e8:	89 e5                	mov    %esp,%ebp
+  8005ea:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8005ed:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8005f0:	50                   	push   %eax
+  8005f1:	ff 75 08             	push   0x8(%ebp)
+  8005f4:	e8 9d ff ff ff       	call   800596 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8005f9:	c9                   	leave
+  8005fa:	c3                   	ret
+
+008005fb <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8005fb:	55                   	push   %ebp
+  8005fc:	89 e5                	mov    %esp,%ebp
+  8005fe:	57                   	push   %edi
+  8005ff:	56                   	push   %esi
+  800600:	53                   	push   %ebx
+  800601:	83 ec 1c             	sub    $0x1c,%esp
+  800604:	89 c7                	mov    %eax,%edi
+  800606:	89 d6                	mov    %edx,%esi
+  800608:	8b 45 08             	mov    0x8(%ebp),%eax
+  80060b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80060e:	89 d1                	mov    %edx,%ecx
+  800610:	89 c2                	mov    %eax,%edx
+  800612:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800615:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800618:	8b 45 10             	mov    0x10(%ebp),%eax
+  80061b:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80061e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800621:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800628:	39 c2                	cmp    %eax,%edx
+  80062a:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80062d:	72 3e                	jb     80066d <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80062f:	83 ec 0c             	sub    $0xc,%esp
+  800632:	ff 75 18             	push   0x18(%ebp)
+  800635:	83 eb 01             	sub    $0x1,%ebx
+  800638:	53                   	push   %ebx
+  800639:	50                   	push   %eax
+  80063a:	83 ec 08             	sub    $0x8,%esp
+  80063d:	ff 75 e4             	push   -0x1c(%ebp)
+  800640:	ff 75 e0             	push   -0x20(%ebp)
+  800643:	ff 75 dc             	push   -0x24(%ebp)
+  800646:	ff 75 d8             	push   -0x28(%ebp)
+  800649:	e8 c2 1f 00 00       	call   802610 <__udivdi3>
+  80064e:	83 c4 18             	add    $0x18,%esp
+  800651:	52                   	push   %edx
+  800652:	50                   	push   %eax
+  800653:	89 f2                	mov    %esi,%edx
+  800655:	89 f8                	mov    %edi,%eax
+  800657:	e8 9f ff ff ff       	call   8005fb <printnum>
+  80065c:	83 c4 20             	add    $0x20,%esp
+  80065f:	eb 13                	jmp    800674 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800661:	83 ec 08             	sub    $0x8,%esp
+  800664:	56                   	push   %esi
+  800665:	ff 75 18             	push   0x18(%ebp)
+  800668:	ff d7                	call   *%edi
+  80066a:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80066d:	83 eb 01             	sub    $0x1,%ebx
+  800670:	85 db                	test   %ebx,%ebx
+  800672:	7f ed                	jg     800661 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800674:	83 ec 08             	sub    $0x8,%esp
+  800677:	56                   	push   %esi
+  800678:	83 ec 04             	sub    $0x4,%esp
+  80067b:	ff 75 e4             	push   -0x1c(%ebp)
+  80067e:	ff 75 e0             	push   -0x20(%ebp)
+  800681:	ff 75 dc             	push   -0x24(%ebp)
+  800684:	ff 75 d8             	push   -0x28(%ebp)
+  800687:	e8 54 20 00 00       	call   8026e0 <__umoddi3>
+  80068c:	83 c4 14             	add    $0x14,%esp
+  80068f:	0f be 80 e5 2a 80 00 	movsbl 0x802ae5(%eax),%eax
+  800696:	50                   	push   %eax
+  800697:	ff d7                	call   *%edi
+}
+  800699:	83 c4 10             	add    $0x10,%esp
+  80069c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80069f:	5b                   	pop    %ebx
+  8006a0:	5e                   	pop    %esi
+  8006a1:	5f                   	pop    %edi
+  8006a2:	5d                   	pop    %ebp
+  8006a3:	c3                   	ret
+
+008006a4 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8006a4:	55                   	push   %ebp
+  8006a5:	89 e5                	mov    %esp,%ebp
+  8006a7:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8006aa:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8006ae:	8b 10                	mov    (%eax),%edx
+  8006b0:	3b 50 04             	cmp    0x4(%eax),%edx
+  8006b3:	73 0a                	jae    8006bf <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8006b5:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8006b8:	89 08                	mov    %ecx,(%eax)
+  8006ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006bd:	88 02                	mov    %al,(%edx)
+}
+  8006bf:	5d                   	pop    %ebp
+  8006c0:	c3                   	ret
+
+008006c1 <printfmt>:
+{
+  8006c1:	55                   	push   %ebp
+  8006c2:	89 e5                	mov    %esp,%ebp
+  8006c4:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8006c7:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8006ca:	50                   	push   %eax
+  8006cb:	ff 75 10             	push   0x10(%ebp)
+  8006ce:	ff 75 0c             	push   0xc(%ebp)
+  8006d1:	ff 75 08             	push   0x8(%ebp)
+  8006d4:	e8 05 00 00 00       	call   8006de <vprintfmt>
+}
+  8006d9:	83 c4 10             	add    $0x10,%esp
+  8006dc:	c9                   	leave
+  8006dd:	c3                   	ret
+
+008006de <vprintfmt>:
+{
+  8006de:	55                   	push   %ebp
+  8006df:	89 e5                	mov    %esp,%ebp
+  8006e1:	57                   	push   %edi
+  8006e2:	56                   	push   %esi
+  8006e3:	53                   	push   %ebx
+  8006e4:	83 ec 2c             	sub    $0x2c,%esp
+  8006e7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006ea:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8006ed:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8006f0:	eb 0a                	jmp    8006fc <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8006f2:	83 ec 08             	sub    $0x8,%esp
+  8006f5:	53                   	push   %ebx
+  8006f6:	50                   	push   %eax
+  8006f7:	ff d6                	call   *%esi
+  8006f9:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8006fc:	83 c7 01             	add    $0x1,%edi
+  8006ff:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800703:	83 f8 25             	cmp    $0x25,%eax
+  800706:	74 0c                	je     800714 <vprintfmt+0x36>
+			if (ch == '\0')
+  800708:	85 c0                	test   %eax,%eax
+  80070a:	75 e6                	jne    8006f2 <vprintfmt+0x14>
+}
+  80070c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80070f:	5b                   	pop    %ebx
+  800710:	5e                   	pop    %esi
+  800711:	5f                   	pop    %edi
+  800712:	5d                   	pop    %ebp
+  800713:	c3                   	ret
+		padc = ' ';
+  800714:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800718:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80071f:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800726:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80072d:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800732:	8d 47 01             	lea    0x1(%edi),%eax
+  800735:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800738:	0f b6 17             	movzbl (%edi),%edx
+  80073b:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80073e:	3c 55                	cmp    $0x55,%al
+  800740:	0f 87 9a 03 00 00    	ja     800ae0 <vprintfmt+0x402>
+  800746:	0f b6 c0             	movzbl %al,%eax
+  800749:	ff 24 85 20 2c 80 00 	jmp    *0x802c20(,%eax,4)
+  800750:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800753:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800757:	eb d9                	jmp    800732 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800759:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80075c:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800760:	eb d0                	jmp    800732 <vprintfmt+0x54>
+  800762:	0f b6 d2             	movzbl %dl,%edx
+  800765:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800768:	b8 00 00 00 00       	mov    $0x0,%eax
+  80076d:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800770:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800773:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800777:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80077a:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80077d:	83 f9 09             	cmp    $0x9,%ecx
+  800780:	77 55                	ja     8007d7 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800782:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800785:	eb e9                	jmp    800770 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800787:	8b 45 14             	mov    0x14(%ebp),%eax
+  80078a:	8b 00                	mov    (%eax),%eax
+  80078c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80078f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800792:	8d 40 04             	lea    0x4(%eax),%eax
+  800795:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800798:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80079b:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80079f:	79 91                	jns    800732 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8007a1:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8007a4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8007a7:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8007ae:	eb 82                	jmp    800732 <vprintfmt+0x54>
+			if (width < 0)
+  8007b0:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8007b3:	85 d2                	test   %edx,%edx
+  8007b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ba:	0f 49 c2             	cmovns %edx,%eax
+  8007bd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8007c0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8007c3:	e9 6a ff ff ff       	jmp    800732 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8007c8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8007cb:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8007d2:	e9 5b ff ff ff       	jmp    800732 <vprintfmt+0x54>
+  8007d7:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8007da:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8007dd:	eb bc                	jmp    80079b <vprintfmt+0xbd>
+			lflag++;
+  8007df:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8007e2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8007e5:	e9 48 ff ff ff       	jmp    800732 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8007ea:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ed:	8d 78 04             	lea    0x4(%eax),%edi
+  8007f0:	83 ec 08             	sub    $0x8,%esp
+  8007f3:	53                   	push   %ebx
+  8007f4:	ff 30                	push   (%eax)
+  8007f6:	ff d6                	call   *%esi
+			break;
+  8007f8:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8007fb:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8007fe:	e9 7c 02 00 00       	jmp    800a7f <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  800803:	8b 45 14             	mov    0x14(%ebp),%eax
+  800806:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800809:	8b 10                	mov    (%eax),%edx
+  80080b:	89 d0                	mov    %edx,%eax
+  80080d:	f7 d8                	neg    %eax
+  80080f:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800812:	83 f8 10             	cmp    $0x10,%eax
+  800815:	7f 23                	jg     80083a <vprintfmt+0x15c>
+  800817:	8b 14 85 80 2d 80 00 	mov    0x802d80(,%eax,4),%edx
+  80081e:	85 d2                	test   %edx,%edx
+  800820:	74 18                	je     80083a <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800822:	52                   	push   %edx
+  800823:	68 b9 2e 80 00       	push   $0x802eb9
+  800828:	53                   	push   %ebx
+  800829:	56                   	push   %esi
+  80082a:	e8 92 fe ff ff       	call   8006c1 <printfmt>
+  80082f:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800832:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800835:	e9 45 02 00 00       	jmp    800a7f <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  80083a:	50                   	push   %eax
+  80083b:	68 fd 2a 80 00       	push   $0x802afd
+  800840:	53                   	push   %ebx
+  800841:	56                   	push   %esi
+  800842:	e8 7a fe ff ff       	call   8006c1 <printfmt>
+  800847:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80084a:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80084d:	e9 2d 02 00 00       	jmp    800a7f <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800852:	8b 45 14             	mov    0x14(%ebp),%eax
+  800855:	83 c0 04             	add    $0x4,%eax
+  800858:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80085b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80085e:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800860:	85 c9                	test   %ecx,%ecx
+  800862:	b8 f6 2a 80 00       	mov    $0x802af6,%eax
+  800867:	0f 45 c1             	cmovne %ecx,%eax
+  80086a:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80086d:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800871:	7e 06                	jle    800879 <vprintfmt+0x19b>
+  800873:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800877:	75 0b                	jne    800884 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800879:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80087c:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80087f:	89 75 08             	mov    %esi,0x8(%ebp)
+  800882:	eb 5c                	jmp    8008e0 <vprintfmt+0x202>
+  800884:	83 ec 08             	sub    $0x8,%esp
+  800887:	ff 75 d0             	push   -0x30(%ebp)
+  80088a:	ff 75 cc             	push   -0x34(%ebp)
+  80088d:	e8 eb 02 00 00       	call   800b7d <strnlen>
+  800892:	89 c2                	mov    %eax,%edx
+  800894:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800897:	29 d0                	sub    %edx,%eax
+  800899:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80089c:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8008a0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8008a3:	89 75 08             	mov    %esi,0x8(%ebp)
+  8008a6:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8008a8:	eb 0e                	jmp    8008b8 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8008aa:	83 ec 08             	sub    $0x8,%esp
+  8008ad:	53                   	push   %ebx
+  8008ae:	57                   	push   %edi
+  8008af:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8008b2:	83 ee 01             	sub    $0x1,%esi
+  8008b5:	83 c4 10             	add    $0x10,%esp
+  8008b8:	85 f6                	test   %esi,%esi
+  8008ba:	7f ee                	jg     8008aa <vprintfmt+0x1cc>
+  8008bc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8008bf:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008c2:	85 c0                	test   %eax,%eax
+  8008c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008c9:	0f 49 d0             	cmovns %eax,%edx
+  8008cc:	29 d0                	sub    %edx,%eax
+  8008ce:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8008d1:	eb a6                	jmp    800879 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8008d3:	83 ec 08             	sub    $0x8,%esp
+  8008d6:	53                   	push   %ebx
+  8008d7:	52                   	push   %edx
+  8008d8:	ff 55 08             	call   *0x8(%ebp)
+  8008db:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8008de:	89 f1                	mov    %esi,%ecx
+  8008e0:	8d 71 01             	lea    0x1(%ecx),%esi
+  8008e3:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8008e7:	0f be d0             	movsbl %al,%edx
+  8008ea:	85 d2                	test   %edx,%edx
+  8008ec:	74 28                	je     800916 <vprintfmt+0x238>
+  8008ee:	85 ff                	test   %edi,%edi
+  8008f0:	78 05                	js     8008f7 <vprintfmt+0x219>
+  8008f2:	83 ef 01             	sub    $0x1,%edi
+  8008f5:	78 30                	js     800927 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8008f7:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8008fb:	74 d6                	je     8008d3 <vprintfmt+0x1f5>
+  8008fd:	0f be c0             	movsbl %al,%eax
+  800900:	83 e8 20             	sub    $0x20,%eax
+  800903:	83 f8 5e             	cmp    $0x5e,%eax
+  800906:	76 cb                	jbe    8008d3 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800908:	83 ec 08             	sub    $0x8,%esp
+  80090b:	53                   	push   %ebx
+  80090c:	6a 3f                	push   $0x3f
+  80090e:	ff 55 08             	call   *0x8(%ebp)
+  800911:	83 c4 10             	add    $0x10,%esp
+  800914:	eb c8                	jmp    8008de <vprintfmt+0x200>
+  800916:	8b 75 08             	mov    0x8(%ebp),%esi
+  800919:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80091c:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80091f:	01 d0                	add    %edx,%eax
+  800921:	29 c8                	sub    %ecx,%eax
+  800923:	89 c7                	mov    %eax,%edi
+  800925:	eb 13                	jmp    80093a <vprintfmt+0x25c>
+  800927:	8b 75 08             	mov    0x8(%ebp),%esi
+  80092a:	eb ed                	jmp    800919 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80092c:	83 ec 08             	sub    $0x8,%esp
+  80092f:	53                   	push   %ebx
+  800930:	6a 20                	push   $0x20
+  800932:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800934:	83 ef 01             	sub    $0x1,%edi
+  800937:	83 c4 10             	add    $0x10,%esp
+  80093a:	85 ff                	test   %edi,%edi
+  80093c:	7f ee                	jg     80092c <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80093e:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800941:	89 45 14             	mov    %eax,0x14(%ebp)
+  800944:	e9 36 01 00 00       	jmp    800a7f <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  800949:	83 f9 01             	cmp    $0x1,%ecx
+  80094c:	7f 1f                	jg     80096d <vprintfmt+0x28f>
+	else if (lflag)
+  80094e:	85 c9                	test   %ecx,%ecx
+  800950:	74 67                	je     8009b9 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800952:	8b 45 14             	mov    0x14(%ebp),%eax
+  800955:	8b 00                	mov    (%eax),%eax
+  800957:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80095a:	89 c1                	mov    %eax,%ecx
+  80095c:	c1 f9 1f             	sar    $0x1f,%ecx
+  80095f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800962:	8b 45 14             	mov    0x14(%ebp),%eax
+  800965:	8d 40 04             	lea    0x4(%eax),%eax
+  800968:	89 45 14             	mov    %eax,0x14(%ebp)
+  80096b:	eb 17                	jmp    800984 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  80096d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800970:	8b 50 04             	mov    0x4(%eax),%edx
+  800973:	8b 00                	mov    (%eax),%eax
+  800975:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800978:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80097b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80097e:	8d 40 08             	lea    0x8(%eax),%eax
+  800981:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800984:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800987:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80098a:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80098f:	85 c9                	test   %ecx,%ecx
+  800991:	0f 89 ce 00 00 00    	jns    800a65 <vprintfmt+0x387>
+				putch('-', putdat);
+  800997:	83 ec 08             	sub    $0x8,%esp
+  80099a:	53                   	push   %ebx
+  80099b:	6a 2d                	push   $0x2d
+  80099d:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80099f:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8009a2:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8009a5:	f7 da                	neg    %edx
+  8009a7:	83 d1 00             	adc    $0x0,%ecx
+  8009aa:	f7 d9                	neg    %ecx
+  8009ac:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8009af:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8009b4:	e9 ac 00 00 00       	jmp    800a65 <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  8009b9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009bc:	8b 00                	mov    (%eax),%eax
+  8009be:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8009c1:	89 c1                	mov    %eax,%ecx
+  8009c3:	c1 f9 1f             	sar    $0x1f,%ecx
+  8009c6:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8009c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009cc:	8d 40 04             	lea    0x4(%eax),%eax
+  8009cf:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009d2:	eb b0                	jmp    800984 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8009d4:	83 f9 01             	cmp    $0x1,%ecx
+  8009d7:	7f 1b                	jg     8009f4 <vprintfmt+0x316>
+	else if (lflag)
+  8009d9:	85 c9                	test   %ecx,%ecx
+  8009db:	74 2c                	je     800a09 <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  8009dd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009e0:	8b 10                	mov    (%eax),%edx
+  8009e2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009e7:	8d 40 04             	lea    0x4(%eax),%eax
+  8009ea:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8009ed:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8009f2:	eb 71                	jmp    800a65 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  8009f4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009f7:	8b 10                	mov    (%eax),%edx
+  8009f9:	8b 48 04             	mov    0x4(%eax),%ecx
+  8009fc:	8d 40 08             	lea    0x8(%eax),%eax
+  8009ff:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800a02:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800a07:	eb 5c                	jmp    800a65 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  800a09:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a0c:	8b 10                	mov    (%eax),%edx
+  800a0e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a13:	8d 40 04             	lea    0x4(%eax),%eax
+  800a16:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800a19:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800a1e:	eb 45                	jmp    800a65 <vprintfmt+0x387>
+			putch('X', putdat);
+  800a20:	83 ec 08             	sub    $0x8,%esp
+  800a23:	53                   	push   %ebx
+  800a24:	6a 58                	push   $0x58
+  800a26:	ff d6                	call   *%esi
+			putch('X', putdat);
+  800a28:	83 c4 08             	add    $0x8,%esp
+  800a2b:	53                   	push   %ebx
+  800a2c:	6a 58                	push   $0x58
+  800a2e:	ff d6                	call   *%esi
+			putch('X', putdat);
+  800a30:	83 c4 08             	add    $0x8,%esp
+  800a33:	53                   	push   %ebx
+  800a34:	6a 58                	push   $0x58
+  800a36:	ff d6                	call   *%esi
+			break;
+  800a38:	83 c4 10             	add    $0x10,%esp
+  800a3b:	eb 42                	jmp    800a7f <vprintfmt+0x3a1>
+			putch('0', putdat);
+  800a3d:	83 ec 08             	sub    $0x8,%esp
+  800a40:	53                   	push   %ebx
+  800a41:	6a 30                	push   $0x30
+  800a43:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800a45:	83 c4 08             	add    $0x8,%esp
+  800a48:	53                   	push   %ebx
+  800a49:	6a 78                	push   $0x78
+  800a4b:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800a4d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a50:	8b 10                	mov    (%eax),%edx
+  800a52:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800a57:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800a5a:	8d 40 04             	lea    0x4(%eax),%eax
+  800a5d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a60:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800a65:	83 ec 0c             	sub    $0xc,%esp
+  800a68:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800a6c:	50                   	push   %eax
+  800a6d:	ff 75 e0             	push   -0x20(%ebp)
+  800a70:	57                   	push   %edi
+  800a71:	51                   	push   %ecx
+  800a72:	52                   	push   %edx
+  800a73:	89 da                	mov    %ebx,%edx
+  800a75:	89 f0                	mov    %esi,%eax
+  800a77:	e8 7f fb ff ff       	call   8005fb <printnum>
+			break;
+  800a7c:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800a7f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800a82:	e9 75 fc ff ff       	jmp    8006fc <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800a87:	83 f9 01             	cmp    $0x1,%ecx
+  800a8a:	7f 1b                	jg     800aa7 <vprintfmt+0x3c9>
+	else if (lflag)
+  800a8c:	85 c9                	test   %ecx,%ecx
+  800a8e:	74 2c                	je     800abc <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  800a90:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a93:	8b 10                	mov    (%eax),%edx
+  800a95:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a9a:	8d 40 04             	lea    0x4(%eax),%eax
+  800a9d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800aa0:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800aa5:	eb be                	jmp    800a65 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  800aa7:	8b 45 14             	mov    0x14(%ebp),%eax
+  800aaa:	8b 10                	mov    (%eax),%edx
+  800aac:	8b 48 04             	mov    0x4(%eax),%ecx
+  800aaf:	8d 40 08             	lea    0x8(%eax),%eax
+  800ab2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800ab5:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800aba:	eb a9                	jmp    800a65 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  800abc:	8b 45 14             	mov    0x14(%ebp),%eax
+  800abf:	8b 10                	mov    (%eax),%edx
+  800ac1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ac6:	8d 40 04             	lea    0x4(%eax),%eax
+  800ac9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800acc:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800ad1:	eb 92                	jmp    800a65 <vprintfmt+0x387>
+			putch(ch, putdat);
+  800ad3:	83 ec 08             	sub    $0x8,%esp
+  800ad6:	53                   	push   %ebx
+  800ad7:	6a 25                	push   $0x25
+  800ad9:	ff d6                	call   *%esi
+			break;
+  800adb:	83 c4 10             	add    $0x10,%esp
+  800ade:	eb 9f                	jmp    800a7f <vprintfmt+0x3a1>
+			putch('%', putdat);
+  800ae0:	83 ec 08             	sub    $0x8,%esp
+  800ae3:	53                   	push   %ebx
+  800ae4:	6a 25                	push   $0x25
+  800ae6:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800ae8:	83 c4 10             	add    $0x10,%esp
+  800aeb:	89 f8                	mov    %edi,%eax
+  800aed:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800af1:	74 05                	je     800af8 <vprintfmt+0x41a>
+  800af3:	83 e8 01             	sub    $0x1,%eax
+  800af6:	eb f5                	jmp    800aed <vprintfmt+0x40f>
+  800af8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800afb:	eb 82                	jmp    800a7f <vprintfmt+0x3a1>
+
+00800afd <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800afd:	55                   	push   %ebp
+  800afe:	89 e5                	mov    %esp,%ebp
+  800b00:	83 ec 18             	sub    $0x18,%esp
+  800b03:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b06:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800b09:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800b0c:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800b10:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800b13:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800b1a:	85 c0                	test   %eax,%eax
+  800b1c:	74 26                	je     800b44 <vsnprintf+0x47>
+  800b1e:	85 d2                	test   %edx,%edx
+  800b20:	7e 22                	jle    800b44 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800b22:	ff 75 14             	push   0x14(%ebp)
+  800b25:	ff 75 10             	push   0x10(%ebp)
+  800b28:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800b2b:	50                   	push   %eax
+  800b2c:	68 a4 06 80 00       	push   $0x8006a4
+  800b31:	e8 a8 fb ff ff       	call   8006de <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800b36:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800b39:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800b3c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b3f:	83 c4 10             	add    $0x10,%esp
+}
+  800b42:	c9                   	leave
+  800b43:	c3                   	ret
+		return -E_INVAL;
+  800b44:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b49:	eb f7                	jmp    800b42 <vsnprintf+0x45>
+
+00800b4b <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800b4b:	55                   	push   %ebp
+  800b4c:	89 e5                	mov    %esp,%ebp
+  800b4e:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800b51:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800b54:	50                   	push   %eax
+  800b55:	ff 75 10             	push   0x10(%ebp)
+  800b58:	ff 75 0c             	push   0xc(%ebp)
+  800b5b:	ff 75 08             	push   0x8(%ebp)
+  800b5e:	e8 9a ff ff ff       	call   800afd <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800b63:	c9                   	leave
+  800b64:	c3                   	ret
+
+00800b65 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800b65:	55                   	push   %ebp
+  800b66:	89 e5                	mov    %esp,%ebp
+  800b68:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800b6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b70:	eb 03                	jmp    800b75 <strlen+0x10>
+		n++;
+  800b72:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800b75:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800b79:	75 f7                	jne    800b72 <strlen+0xd>
+	return n;
+}
+  800b7b:	5d                   	pop    %ebp
+  800b7c:	c3                   	ret
+
+00800b7d <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800b7d:	55                   	push   %ebp
+  800b7e:	89 e5                	mov    %esp,%ebp
+  800b80:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b83:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b86:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b8b:	eb 03                	jmp    800b90 <strnlen+0x13>
+		n++;
+  800b8d:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b90:	39 d0                	cmp    %edx,%eax
+  800b92:	74 08                	je     800b9c <strnlen+0x1f>
+  800b94:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800b98:	75 f3                	jne    800b8d <strnlen+0x10>
+  800b9a:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800b9c:	89 d0                	mov    %edx,%eax
+  800b9e:	5d                   	pop    %ebp
+  800b9f:	c3                   	ret
+
+00800ba0 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800ba0:	55                   	push   %ebp
+  800ba1:	89 e5                	mov    %esp,%ebp
+  800ba3:	53                   	push   %ebx
+  800ba4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ba7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800baa:	b8 00 00 00 00       	mov    $0x0,%eax
+  800baf:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800bb3:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800bb6:	83 c0 01             	add    $0x1,%eax
+  800bb9:	84 d2                	test   %dl,%dl
+  800bbb:	75 f2                	jne    800baf <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800bbd:	89 c8                	mov    %ecx,%eax
+  800bbf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bc2:	c9                   	leave
+  800bc3:	c3                   	ret
+
+00800bc4 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800bc4:	55                   	push   %ebp
+  800bc5:	89 e5                	mov    %esp,%ebp
+  800bc7:	53                   	push   %ebx
+  800bc8:	83 ec 10             	sub    $0x10,%esp
+  800bcb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800bce:	53                   	push   %ebx
+  800bcf:	e8 91 ff ff ff       	call   800b65 <strlen>
+  800bd4:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800bd7:	ff 75 0c             	push   0xc(%ebp)
+  800bda:	01 d8                	add    %ebx,%eax
+  800bdc:	50                   	push   %eax
+  800bdd:	e8 be ff ff ff       	call   800ba0 <strcpy>
+	return dst;
+}
+  800be2:	89 d8                	mov    %ebx,%eax
+  800be4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800be7:	c9                   	leave
+  800be8:	c3                   	ret
+
+00800be9 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800be9:	55                   	push   %ebp
+  800bea:	89 e5                	mov    %esp,%ebp
+  800bec:	56                   	push   %esi
+  800bed:	53                   	push   %ebx
+  800bee:	8b 75 08             	mov    0x8(%ebp),%esi
+  800bf1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800bf4:	89 f3                	mov    %esi,%ebx
+  800bf6:	03 5d 10             	add    0x10(%ebp),%ebx
+  800bf9:	89 f0                	mov    %esi,%eax
+  800bfb:	eb 0f                	jmp    800c0c <strncpy+0x23>
+		*dst++ = *src;
+  800bfd:	83 c0 01             	add    $0x1,%eax
+  800c00:	0f b6 0a             	movzbl (%edx),%ecx
+  800c03:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800c06:	80 f9 01             	cmp    $0x1,%cl
+  800c09:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800c0c:	39 d8                	cmp    %ebx,%eax
+  800c0e:	75 ed                	jne    800bfd <strncpy+0x14>
+	}
+	return ret;
+}
+  800c10:	89 f0                	mov    %esi,%eax
+  800c12:	5b                   	pop    %ebx
+  800c13:	5e                   	pop    %esi
+  800c14:	5d                   	pop    %ebp
+  800c15:	c3                   	ret
+
+00800c16 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800c16:	55                   	push   %ebp
+  800c17:	89 e5                	mov    %esp,%ebp
+  800c19:	56                   	push   %esi
+  800c1a:	53                   	push   %ebx
+  800c1b:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c1e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c21:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800c24:	89 f0                	mov    %esi,%eax
+  800c26:	85 d2                	test   %edx,%edx
+  800c28:	74 21                	je     800c4b <strlcpy+0x35>
+  800c2a:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800c2e:	89 f2                	mov    %esi,%edx
+  800c30:	eb 09                	jmp    800c3b <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800c32:	83 c1 01             	add    $0x1,%ecx
+  800c35:	83 c2 01             	add    $0x1,%edx
+  800c38:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800c3b:	39 c2                	cmp    %eax,%edx
+  800c3d:	74 09                	je     800c48 <strlcpy+0x32>
+  800c3f:	0f b6 19             	movzbl (%ecx),%ebx
+  800c42:	84 db                	test   %bl,%bl
+  800c44:	75 ec                	jne    800c32 <strlcpy+0x1c>
+  800c46:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800c48:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800c4b:	29 f0                	sub    %esi,%eax
+}
+  800c4d:	5b                   	pop    %ebx
+  800c4e:	5e                   	pop    %esi
+  800c4f:	5d                   	pop    %ebp
+  800c50:	c3                   	ret
+
+00800c51 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800c51:	55                   	push   %ebp
+  800c52:	89 e5                	mov    %esp,%ebp
+  800c54:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c57:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800c5a:	eb 06                	jmp    800c62 <strcmp+0x11>
+		p++, q++;
+  800c5c:	83 c1 01             	add    $0x1,%ecx
+  800c5f:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800c62:	0f b6 01             	movzbl (%ecx),%eax
+  800c65:	84 c0                	test   %al,%al
+  800c67:	74 04                	je     800c6d <strcmp+0x1c>
+  800c69:	3a 02                	cmp    (%edx),%al
+  800c6b:	74 ef                	je     800c5c <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800c6d:	0f b6 c0             	movzbl %al,%eax
+  800c70:	0f b6 12             	movzbl (%edx),%edx
+  800c73:	29 d0                	sub    %edx,%eax
+}
+  800c75:	5d                   	pop    %ebp
+  800c76:	c3                   	ret
+
+00800c77 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800c77:	55                   	push   %ebp
+  800c78:	89 e5                	mov    %esp,%ebp
+  800c7a:	53                   	push   %ebx
+  800c7b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c7e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c81:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800c84:	eb 09                	jmp    800c8f <strncmp+0x18>
+		n--, p++, q++;
+  800c86:	83 ea 01             	sub    $0x1,%edx
+  800c89:	83 c0 01             	add    $0x1,%eax
+  800c8c:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800c8f:	85 d2                	test   %edx,%edx
+  800c91:	74 18                	je     800cab <strncmp+0x34>
+  800c93:	0f b6 18             	movzbl (%eax),%ebx
+  800c96:	84 db                	test   %bl,%bl
+  800c98:	74 04                	je     800c9e <strncmp+0x27>
+  800c9a:	3a 19                	cmp    (%ecx),%bl
+  800c9c:	74 e8                	je     800c86 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800c9e:	0f b6 00             	movzbl (%eax),%eax
+  800ca1:	0f b6 11             	movzbl (%ecx),%edx
+  800ca4:	29 d0                	sub    %edx,%eax
+}
+  800ca6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ca9:	c9                   	leave
+  800caa:	c3                   	ret
+		return 0;
+  800cab:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cb0:	eb f4                	jmp    800ca6 <strncmp+0x2f>
+
+00800cb2 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800cb2:	55                   	push   %ebp
+  800cb3:	89 e5                	mov    %esp,%ebp
+  800cb5:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cb8:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800cbc:	eb 03                	jmp    800cc1 <strchr+0xf>
+  800cbe:	83 c0 01             	add    $0x1,%eax
+  800cc1:	0f b6 10             	movzbl (%eax),%edx
+  800cc4:	84 d2                	test   %dl,%dl
+  800cc6:	74 06                	je     800cce <strchr+0x1c>
+		if (*s == c)
+  800cc8:	38 ca                	cmp    %cl,%dl
+  800cca:	75 f2                	jne    800cbe <strchr+0xc>
+  800ccc:	eb 05                	jmp    800cd3 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800cce:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800cd3:	5d                   	pop    %ebp
+  800cd4:	c3                   	ret
+
+00800cd5 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800cd5:	55                   	push   %ebp
+  800cd6:	89 e5                	mov    %esp,%ebp
+  800cd8:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cdb:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800cdf:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800ce2:	38 ca                	cmp    %cl,%dl
+  800ce4:	74 09                	je     800cef <strfind+0x1a>
+  800ce6:	84 d2                	test   %dl,%dl
+  800ce8:	74 05                	je     800cef <strfind+0x1a>
+	for (; *s; s++)
+  800cea:	83 c0 01             	add    $0x1,%eax
+  800ced:	eb f0                	jmp    800cdf <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800cef:	5d                   	pop    %ebp
+  800cf0:	c3                   	ret
+
+00800cf1 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800cf1:	55                   	push   %ebp
+  800cf2:	89 e5                	mov    %esp,%ebp
+  800cf4:	57                   	push   %edi
+  800cf5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800cf8:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800cfb:	85 c9                	test   %ecx,%ecx
+  800cfd:	74 20                	je     800d1f <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800cff:	89 f8                	mov    %edi,%eax
+  800d01:	09 c8                	or     %ecx,%eax
+  800d03:	a8 03                	test   $0x3,%al
+  800d05:	75 12                	jne    800d19 <memset+0x28>
+		c &= 0xFF;
+  800d07:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800d0b:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800d11:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800d14:	fc                   	cld
+  800d15:	f3 ab                	rep stos %eax,%es:(%edi)
+  800d17:	eb 06                	jmp    800d1f <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800d19:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d1c:	fc                   	cld
+  800d1d:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800d1f:	89 f8                	mov    %edi,%eax
+  800d21:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800d24:	c9                   	leave
+  800d25:	c3                   	ret
+
+00800d26 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800d26:	55                   	push   %ebp
+  800d27:	89 e5                	mov    %esp,%ebp
+  800d29:	57                   	push   %edi
+  800d2a:	56                   	push   %esi
+  800d2b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d2e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800d31:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800d34:	39 c6                	cmp    %eax,%esi
+  800d36:	73 32                	jae    800d6a <memmove+0x44>
+  800d38:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800d3b:	39 d0                	cmp    %edx,%eax
+  800d3d:	73 2b                	jae    800d6a <memmove+0x44>
+		s += n;
+		d += n;
+  800d3f:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d42:	89 d6                	mov    %edx,%esi
+  800d44:	09 fe                	or     %edi,%esi
+  800d46:	09 ce                	or     %ecx,%esi
+  800d48:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800d4e:	75 0e                	jne    800d5e <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800d50:	83 ef 04             	sub    $0x4,%edi
+  800d53:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800d56:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800d59:	fd                   	std
+  800d5a:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d5c:	eb 09                	jmp    800d67 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800d5e:	83 ef 01             	sub    $0x1,%edi
+  800d61:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800d64:	fd                   	std
+  800d65:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800d67:	fc                   	cld
+  800d68:	eb 1a                	jmp    800d84 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d6a:	89 f2                	mov    %esi,%edx
+  800d6c:	09 c2                	or     %eax,%edx
+  800d6e:	09 ca                	or     %ecx,%edx
+  800d70:	f6 c2 03             	test   $0x3,%dl
+  800d73:	75 0a                	jne    800d7f <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800d75:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800d78:	89 c7                	mov    %eax,%edi
+  800d7a:	fc                   	cld
+  800d7b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d7d:	eb 05                	jmp    800d84 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800d7f:	89 c7                	mov    %eax,%edi
+  800d81:	fc                   	cld
+  800d82:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800d84:	5e                   	pop    %esi
+  800d85:	5f                   	pop    %edi
+  800d86:	5d                   	pop    %ebp
+  800d87:	c3                   	ret
+
+00800d88 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800d88:	55                   	push   %ebp
+  800d89:	89 e5                	mov    %esp,%ebp
+  800d8b:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800d8e:	ff 75 10             	push   0x10(%ebp)
+  800d91:	ff 75 0c             	push   0xc(%ebp)
+  800d94:	ff 75 08             	push   0x8(%ebp)
+  800d97:	e8 8a ff ff ff       	call   800d26 <memmove>
+}
+  800d9c:	c9                   	leave
+  800d9d:	c3                   	ret
+
+00800d9e <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800d9e:	55                   	push   %ebp
+  800d9f:	89 e5                	mov    %esp,%ebp
+  800da1:	56                   	push   %esi
+  800da2:	53                   	push   %ebx
+  800da3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800da6:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800da9:	89 c6                	mov    %eax,%esi
+  800dab:	03 75 10             	add    0x10(%ebp),%esi
+  800dae:	eb 06                	jmp    800db6 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800db0:	83 c0 01             	add    $0x1,%eax
+  800db3:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800db6:	39 f0                	cmp    %esi,%eax
+  800db8:	74 14                	je     800dce <memcmp+0x30>
+		if (*s1 != *s2)
+  800dba:	0f b6 08             	movzbl (%eax),%ecx
+  800dbd:	0f b6 1a             	movzbl (%edx),%ebx
+  800dc0:	38 d9                	cmp    %bl,%cl
+  800dc2:	74 ec                	je     800db0 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800dc4:	0f b6 c1             	movzbl %cl,%eax
+  800dc7:	0f b6 db             	movzbl %bl,%ebx
+  800dca:	29 d8                	sub    %ebx,%eax
+  800dcc:	eb 05                	jmp    800dd3 <memcmp+0x35>
+	}
+
+	return 0;
+  800dce:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800dd3:	5b                   	pop    %ebx
+  800dd4:	5e                   	pop    %esi
+  800dd5:	5d                   	pop    %ebp
+  800dd6:	c3                   	ret
+
+00800dd7 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800dd7:	55                   	push   %ebp
+  800dd8:	89 e5                	mov    %esp,%ebp
+  800dda:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ddd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800de0:	89 c2                	mov    %eax,%edx
+  800de2:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800de5:	eb 03                	jmp    800dea <memfind+0x13>
+  800de7:	83 c0 01             	add    $0x1,%eax
+  800dea:	39 d0                	cmp    %edx,%eax
+  800dec:	73 04                	jae    800df2 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800dee:	38 08                	cmp    %cl,(%eax)
+  800df0:	75 f5                	jne    800de7 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800df2:	5d                   	pop    %ebp
+  800df3:	c3                   	ret
+
+00800df4 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800df4:	55                   	push   %ebp
+  800df5:	89 e5                	mov    %esp,%ebp
+  800df7:	57                   	push   %edi
+  800df8:	56                   	push   %esi
+  800df9:	53                   	push   %ebx
+  800dfa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dfd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800e00:	eb 03                	jmp    800e05 <strtol+0x11>
+		s++;
+  800e02:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800e05:	0f b6 02             	movzbl (%edx),%eax
+  800e08:	3c 20                	cmp    $0x20,%al
+  800e0a:	74 f6                	je     800e02 <strtol+0xe>
+  800e0c:	3c 09                	cmp    $0x9,%al
+  800e0e:	74 f2                	je     800e02 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800e10:	3c 2b                	cmp    $0x2b,%al
+  800e12:	74 2a                	je     800e3e <strtol+0x4a>
+	int neg = 0;
+  800e14:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800e19:	3c 2d                	cmp    $0x2d,%al
+  800e1b:	74 2b                	je     800e48 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e1d:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800e23:	75 0f                	jne    800e34 <strtol+0x40>
+  800e25:	80 3a 30             	cmpb   $0x30,(%edx)
+  800e28:	74 28                	je     800e52 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800e2a:	85 db                	test   %ebx,%ebx
+  800e2c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e31:	0f 44 d8             	cmove  %eax,%ebx
+  800e34:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e39:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800e3c:	eb 46                	jmp    800e84 <strtol+0x90>
+		s++;
+  800e3e:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800e41:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e46:	eb d5                	jmp    800e1d <strtol+0x29>
+		s++, neg = 1;
+  800e48:	83 c2 01             	add    $0x1,%edx
+  800e4b:	bf 01 00 00 00       	mov    $0x1,%edi
+  800e50:	eb cb                	jmp    800e1d <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e52:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800e56:	74 0e                	je     800e66 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800e58:	85 db                	test   %ebx,%ebx
+  800e5a:	75 d8                	jne    800e34 <strtol+0x40>
+		s++, base = 8;
+  800e5c:	83 c2 01             	add    $0x1,%edx
+  800e5f:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800e64:	eb ce                	jmp    800e34 <strtol+0x40>
+		s += 2, base = 16;
+  800e66:	83 c2 02             	add    $0x2,%edx
+  800e69:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800e6e:	eb c4                	jmp    800e34 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800e70:	0f be c0             	movsbl %al,%eax
+  800e73:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800e76:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800e79:	7d 3a                	jge    800eb5 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800e7b:	83 c2 01             	add    $0x1,%edx
+  800e7e:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800e82:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800e84:	0f b6 02             	movzbl (%edx),%eax
+  800e87:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800e8a:	89 f3                	mov    %esi,%ebx
+  800e8c:	80 fb 09             	cmp    $0x9,%bl
+  800e8f:	76 df                	jbe    800e70 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800e91:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800e94:	89 f3                	mov    %esi,%ebx
+  800e96:	80 fb 19             	cmp    $0x19,%bl
+  800e99:	77 08                	ja     800ea3 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800e9b:	0f be c0             	movsbl %al,%eax
+  800e9e:	83 e8 57             	sub    $0x57,%eax
+  800ea1:	eb d3                	jmp    800e76 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800ea3:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800ea6:	89 f3                	mov    %esi,%ebx
+  800ea8:	80 fb 19             	cmp    $0x19,%bl
+  800eab:	77 08                	ja     800eb5 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800ead:	0f be c0             	movsbl %al,%eax
+  800eb0:	83 e8 37             	sub    $0x37,%eax
+  800eb3:	eb c1                	jmp    800e76 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800eb5:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800eb9:	74 05                	je     800ec0 <strtol+0xcc>
+		*endptr = (char *) s;
+  800ebb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ebe:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800ec0:	89 c8                	mov    %ecx,%eax
+  800ec2:	f7 d8                	neg    %eax
+  800ec4:	85 ff                	test   %edi,%edi
+  800ec6:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800ec9:	89 c8                	mov    %ecx,%eax
+  800ecb:	5b                   	pop    %ebx
+  800ecc:	5e                   	pop    %esi
+  800ecd:	5f                   	pop    %edi
+  800ece:	5d                   	pop    %ebp
+  800ecf:	c3                   	ret
+
+00800ed0 <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800ed0:	55                   	push   %ebp
+  800ed1:	89 e5                	mov    %esp,%ebp
+  800ed3:	57                   	push   %edi
+  800ed4:	56                   	push   %esi
+  800ed5:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800ed6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800edb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ede:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee1:	89 c3                	mov    %eax,%ebx
+  800ee3:	89 c7                	mov    %eax,%edi
+  800ee5:	89 c6                	mov    %eax,%esi
+  800ee7:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  800ee9:	5b                   	pop    %ebx
+  800eea:	5e                   	pop    %esi
+  800eeb:	5f                   	pop    %edi
+  800eec:	5d                   	pop    %ebp
+  800eed:	c3                   	ret
+
+00800eee <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800eee:	55                   	push   %ebp
+  800eef:	89 e5                	mov    %esp,%ebp
+  800ef1:	57                   	push   %edi
+  800ef2:	56                   	push   %esi
+  800ef3:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800ef4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ef9:	b8 01 00 00 00       	mov    $0x1,%eax
+  800efe:	89 d1                	mov    %edx,%ecx
+  800f00:	89 d3                	mov    %edx,%ebx
+  800f02:	89 d7                	mov    %edx,%edi
+  800f04:	89 d6                	mov    %edx,%esi
+  800f06:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800f08:	5b                   	pop    %ebx
+  800f09:	5e                   	pop    %esi
+  800f0a:	5f                   	pop    %edi
+  800f0b:	5d                   	pop    %ebp
+  800f0c:	c3                   	ret
+
+00800f0d <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800f0d:	55                   	push   %ebp
+  800f0e:	89 e5                	mov    %esp,%ebp
+  800f10:	57                   	push   %edi
+  800f11:	56                   	push   %esi
+  800f12:	53                   	push   %ebx
+  800f13:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800f16:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f1b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f1e:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f23:	89 cb                	mov    %ecx,%ebx
+  800f25:	89 cf                	mov    %ecx,%edi
+  800f27:	89 ce                	mov    %ecx,%esi
+  800f29:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f2b:	85 c0                	test   %eax,%eax
+  800f2d:	7f 08                	jg     800f37 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800f2f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f32:	5b                   	pop    %ebx
+  800f33:	5e                   	pop    %esi
+  800f34:	5f                   	pop    %edi
+  800f35:	5d                   	pop    %ebp
+  800f36:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f37:	83 ec 0c             	sub    $0xc,%esp
+  800f3a:	50                   	push   %eax
+  800f3b:	6a 03                	push   $0x3
+  800f3d:	68 e3 2d 80 00       	push   $0x802de3
+  800f42:	6a 3e                	push   $0x3e
+  800f44:	68 00 2e 80 00       	push   $0x802e00
+  800f49:	e8 22 14 00 00       	call   802370 <_panic>
+
+00800f4e <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800f4e:	55                   	push   %ebp
+  800f4f:	89 e5                	mov    %esp,%ebp
+  800f51:	57                   	push   %edi
+  800f52:	56                   	push   %esi
+  800f53:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800f54:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f59:	b8 02 00 00 00       	mov    $0x2,%eax
+  800f5e:	89 d1                	mov    %edx,%ecx
+  800f60:	89 d3                	mov    %edx,%ebx
+  800f62:	89 d7                	mov    %edx,%edi
+  800f64:	89 d6                	mov    %edx,%esi
+  800f66:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800f68:	5b                   	pop    %ebx
+  800f69:	5e                   	pop    %esi
+  800f6a:	5f                   	pop    %edi
+  800f6b:	5d                   	pop    %ebp
+  800f6c:	c3                   	ret
+
+00800f6d <sys_yield>:
+
+void
+sys_yield(void) {
+  800f6d:	55                   	push   %ebp
+  800f6e:	89 e5                	mov    %esp,%ebp
+  800f70:	57                   	push   %edi
+  800f71:	56                   	push   %esi
+  800f72:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800f73:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f78:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800f7d:	89 d1                	mov    %edx,%ecx
+  800f7f:	89 d3                	mov    %edx,%ebx
+  800f81:	89 d7                	mov    %edx,%edi
+  800f83:	89 d6                	mov    %edx,%esi
+  800f85:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800f87:	5b                   	pop    %ebx
+  800f88:	5e                   	pop    %esi
+  800f89:	5f                   	pop    %edi
+  800f8a:	5d                   	pop    %ebp
+  800f8b:	c3                   	ret
+
+00800f8c <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  800f8c:	55                   	push   %ebp
+  800f8d:	89 e5                	mov    %esp,%ebp
+  800f8f:	57                   	push   %edi
+  800f90:	56                   	push   %esi
+  800f91:	53                   	push   %ebx
+  800f92:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800f95:	be 00 00 00 00       	mov    $0x0,%esi
+  800f9a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f9d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fa0:	b8 04 00 00 00       	mov    $0x4,%eax
+  800fa5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fa8:	89 f7                	mov    %esi,%edi
+  800faa:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800fac:	85 c0                	test   %eax,%eax
+  800fae:	7f 08                	jg     800fb8 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800fb0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fb3:	5b                   	pop    %ebx
+  800fb4:	5e                   	pop    %esi
+  800fb5:	5f                   	pop    %edi
+  800fb6:	5d                   	pop    %ebp
+  800fb7:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800fb8:	83 ec 0c             	sub    $0xc,%esp
+  800fbb:	50                   	push   %eax
+  800fbc:	6a 04                	push   $0x4
+  800fbe:	68 e3 2d 80 00       	push   $0x802de3
+  800fc3:	6a 3e                	push   $0x3e
+  800fc5:	68 00 2e 80 00       	push   $0x802e00
+  800fca:	e8 a1 13 00 00       	call   802370 <_panic>
+
+00800fcf <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  800fcf:	55                   	push   %ebp
+  800fd0:	89 e5                	mov    %esp,%ebp
+  800fd2:	57                   	push   %edi
+  800fd3:	56                   	push   %esi
+  800fd4:	53                   	push   %ebx
+  800fd5:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800fd8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fdb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fde:	b8 05 00 00 00       	mov    $0x5,%eax
+  800fe3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fe6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fe9:	8b 75 18             	mov    0x18(%ebp),%esi
+  800fec:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800fee:	85 c0                	test   %eax,%eax
+  800ff0:	7f 08                	jg     800ffa <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800ff2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ff5:	5b                   	pop    %ebx
+  800ff6:	5e                   	pop    %esi
+  800ff7:	5f                   	pop    %edi
+  800ff8:	5d                   	pop    %ebp
+  800ff9:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ffa:	83 ec 0c             	sub    $0xc,%esp
+  800ffd:	50                   	push   %eax
+  800ffe:	6a 05                	push   $0x5
+  801000:	68 e3 2d 80 00       	push   $0x802de3
+  801005:	6a 3e                	push   $0x3e
+  801007:	68 00 2e 80 00       	push   $0x802e00
+  80100c:	e8 5f 13 00 00       	call   802370 <_panic>
+
+00801011 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  801011:	55                   	push   %ebp
+  801012:	89 e5                	mov    %esp,%ebp
+  801014:	57                   	push   %edi
+  801015:	56                   	push   %esi
+  801016:	53                   	push   %ebx
+  801017:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  80101a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80101f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801022:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801025:	b8 06 00 00 00       	mov    $0x6,%eax
+  80102a:	89 df                	mov    %ebx,%edi
+  80102c:	89 de                	mov    %ebx,%esi
+  80102e:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801030:	85 c0                	test   %eax,%eax
+  801032:	7f 08                	jg     80103c <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  801034:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801037:	5b                   	pop    %ebx
+  801038:	5e                   	pop    %esi
+  801039:	5f                   	pop    %edi
+  80103a:	5d                   	pop    %ebp
+  80103b:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80103c:	83 ec 0c             	sub    $0xc,%esp
+  80103f:	50                   	push   %eax
+  801040:	6a 06                	push   $0x6
+  801042:	68 e3 2d 80 00       	push   $0x802de3
+  801047:	6a 3e                	push   $0x3e
+  801049:	68 00 2e 80 00       	push   $0x802e00
+  80104e:	e8 1d 13 00 00       	call   802370 <_panic>
+
+00801053 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801053:	55                   	push   %ebp
+  801054:	89 e5                	mov    %esp,%ebp
+  801056:	57                   	push   %edi
+  801057:	56                   	push   %esi
+  801058:	53                   	push   %ebx
+  801059:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  80105c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801061:	8b 55 08             	mov    0x8(%ebp),%edx
+  801064:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801067:	b8 08 00 00 00       	mov    $0x8,%eax
+  80106c:	89 df                	mov    %ebx,%edi
+  80106e:	89 de                	mov    %ebx,%esi
+  801070:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801072:	85 c0                	test   %eax,%eax
+  801074:	7f 08                	jg     80107e <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801076:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801079:	5b                   	pop    %ebx
+  80107a:	5e                   	pop    %esi
+  80107b:	5f                   	pop    %edi
+  80107c:	5d                   	pop    %ebp
+  80107d:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80107e:	83 ec 0c             	sub    $0xc,%esp
+  801081:	50                   	push   %eax
+  801082:	6a 08                	push   $0x8
+  801084:	68 e3 2d 80 00       	push   $0x802de3
+  801089:	6a 3e                	push   $0x3e
+  80108b:	68 00 2e 80 00       	push   $0x802e00
+  801090:	e8 db 12 00 00       	call   802370 <_panic>
+
+00801095 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801095:	55                   	push   %ebp
+  801096:	89 e5                	mov    %esp,%ebp
+  801098:	57                   	push   %edi
+  801099:	56                   	push   %esi
+  80109a:	53                   	push   %ebx
+  80109b:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  80109e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a9:	b8 09 00 00 00       	mov    $0x9,%eax
+  8010ae:	89 df                	mov    %ebx,%edi
+  8010b0:	89 de                	mov    %ebx,%esi
+  8010b2:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8010b4:	85 c0                	test   %eax,%eax
+  8010b6:	7f 08                	jg     8010c0 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8010b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010bb:	5b                   	pop    %ebx
+  8010bc:	5e                   	pop    %esi
+  8010bd:	5f                   	pop    %edi
+  8010be:	5d                   	pop    %ebp
+  8010bf:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8010c0:	83 ec 0c             	sub    $0xc,%esp
+  8010c3:	50                   	push   %eax
+  8010c4:	6a 09                	push   $0x9
+  8010c6:	68 e3 2d 80 00       	push   $0x802de3
+  8010cb:	6a 3e                	push   $0x3e
+  8010cd:	68 00 2e 80 00       	push   $0x802e00
+  8010d2:	e8 99 12 00 00       	call   802370 <_panic>
+
+008010d7 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8010d7:	55                   	push   %ebp
+  8010d8:	89 e5                	mov    %esp,%ebp
+  8010da:	57                   	push   %edi
+  8010db:	56                   	push   %esi
+  8010dc:	53                   	push   %ebx
+  8010dd:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8010e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010e5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010eb:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010f0:	89 df                	mov    %ebx,%edi
+  8010f2:	89 de                	mov    %ebx,%esi
+  8010f4:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8010f6:	85 c0                	test   %eax,%eax
+  8010f8:	7f 08                	jg     801102 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8010fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010fd:	5b                   	pop    %ebx
+  8010fe:	5e                   	pop    %esi
+  8010ff:	5f                   	pop    %edi
+  801100:	5d                   	pop    %ebp
+  801101:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801102:	83 ec 0c             	sub    $0xc,%esp
+  801105:	50                   	push   %eax
+  801106:	6a 0a                	push   $0xa
+  801108:	68 e3 2d 80 00       	push   $0x802de3
+  80110d:	6a 3e                	push   $0x3e
+  80110f:	68 00 2e 80 00       	push   $0x802e00
+  801114:	e8 57 12 00 00       	call   802370 <_panic>
+
+00801119 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  801119:	55                   	push   %ebp
+  80111a:	89 e5                	mov    %esp,%ebp
+  80111c:	57                   	push   %edi
+  80111d:	56                   	push   %esi
+  80111e:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80111f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801122:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801125:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80112a:	be 00 00 00 00       	mov    $0x0,%esi
+  80112f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801132:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801135:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801137:	5b                   	pop    %ebx
+  801138:	5e                   	pop    %esi
+  801139:	5f                   	pop    %edi
+  80113a:	5d                   	pop    %ebp
+  80113b:	c3                   	ret
+
+0080113c <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  80113c:	55                   	push   %ebp
+  80113d:	89 e5                	mov    %esp,%ebp
+  80113f:	57                   	push   %edi
+  801140:	56                   	push   %esi
+  801141:	53                   	push   %ebx
+  801142:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  801145:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80114a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80114d:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801152:	89 cb                	mov    %ecx,%ebx
+  801154:	89 cf                	mov    %ecx,%edi
+  801156:	89 ce                	mov    %ecx,%esi
+  801158:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80115a:	85 c0                	test   %eax,%eax
+  80115c:	7f 08                	jg     801166 <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  80115e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801161:	5b                   	pop    %ebx
+  801162:	5e                   	pop    %esi
+  801163:	5f                   	pop    %edi
+  801164:	5d                   	pop    %ebp
+  801165:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801166:	83 ec 0c             	sub    $0xc,%esp
+  801169:	50                   	push   %eax
+  80116a:	6a 0d                	push   $0xd
+  80116c:	68 e3 2d 80 00       	push   $0x802de3
+  801171:	6a 3e                	push   $0x3e
+  801173:	68 00 2e 80 00       	push   $0x802e00
+  801178:	e8 f3 11 00 00       	call   802370 <_panic>
+
+0080117d <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  80117d:	55                   	push   %ebp
+  80117e:	89 e5                	mov    %esp,%ebp
+  801180:	57                   	push   %edi
+  801181:	56                   	push   %esi
+  801182:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  801183:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801188:	8b 55 08             	mov    0x8(%ebp),%edx
+  80118b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80118e:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801193:	89 df                	mov    %ebx,%edi
+  801195:	89 de                	mov    %ebx,%esi
+  801197:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  801199:	5b                   	pop    %ebx
+  80119a:	5e                   	pop    %esi
+  80119b:	5f                   	pop    %edi
+  80119c:	5d                   	pop    %ebp
+  80119d:	c3                   	ret
+
+0080119e <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  80119e:	55                   	push   %ebp
+  80119f:	89 e5                	mov    %esp,%ebp
+  8011a1:	57                   	push   %edi
+  8011a2:	56                   	push   %esi
+  8011a3:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8011a4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011a9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ac:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8011b1:	89 cb                	mov    %ecx,%ebx
+  8011b3:	89 cf                	mov    %ecx,%edi
+  8011b5:	89 ce                	mov    %ecx,%esi
+  8011b7:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  8011b9:	5b                   	pop    %ebx
+  8011ba:	5e                   	pop    %esi
+  8011bb:	5f                   	pop    %edi
+  8011bc:	5d                   	pop    %ebp
+  8011bd:	c3                   	ret
+
+008011be <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  8011be:	55                   	push   %ebp
+  8011bf:	89 e5                	mov    %esp,%ebp
+  8011c1:	57                   	push   %edi
+  8011c2:	56                   	push   %esi
+  8011c3:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8011c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011c9:	b8 10 00 00 00       	mov    $0x10,%eax
+  8011ce:	89 d1                	mov    %edx,%ecx
+  8011d0:	89 d3                	mov    %edx,%ebx
+  8011d2:	89 d7                	mov    %edx,%edi
+  8011d4:	89 d6                	mov    %edx,%esi
+  8011d6:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8011d8:	5b                   	pop    %ebx
+  8011d9:	5e                   	pop    %esi
+  8011da:	5f                   	pop    %edi
+  8011db:	5d                   	pop    %ebp
+  8011dc:	c3                   	ret
+
+008011dd <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  8011dd:	55                   	push   %ebp
+  8011de:	89 e5                	mov    %esp,%ebp
+  8011e0:	57                   	push   %edi
+  8011e1:	56                   	push   %esi
+  8011e2:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8011e3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011e8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011eb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ee:	b8 11 00 00 00       	mov    $0x11,%eax
+  8011f3:	89 df                	mov    %ebx,%edi
+  8011f5:	89 de                	mov    %ebx,%esi
+  8011f7:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  8011f9:	5b                   	pop    %ebx
+  8011fa:	5e                   	pop    %esi
+  8011fb:	5f                   	pop    %edi
+  8011fc:	5d                   	pop    %ebp
+  8011fd:	c3                   	ret
+
+008011fe <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  8011fe:	55                   	push   %ebp
+  8011ff:	89 e5                	mov    %esp,%ebp
+  801201:	57                   	push   %edi
+  801202:	56                   	push   %esi
+  801203:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  801204:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801209:	8b 55 08             	mov    0x8(%ebp),%edx
+  80120c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80120f:	b8 12 00 00 00       	mov    $0x12,%eax
+  801214:	89 df                	mov    %ebx,%edi
+  801216:	89 de                	mov    %ebx,%esi
+  801218:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  80121a:	5b                   	pop    %ebx
+  80121b:	5e                   	pop    %esi
+  80121c:	5f                   	pop    %edi
+  80121d:	5d                   	pop    %ebp
+  80121e:	c3                   	ret
+
+0080121f <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  80121f:	55                   	push   %ebp
+  801220:	89 e5                	mov    %esp,%ebp
+  801222:	57                   	push   %edi
+  801223:	56                   	push   %esi
+  801224:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  801225:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80122a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80122d:	b8 13 00 00 00       	mov    $0x13,%eax
+  801232:	89 cb                	mov    %ecx,%ebx
+  801234:	89 cf                	mov    %ecx,%edi
+  801236:	89 ce                	mov    %ecx,%esi
+  801238:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  80123a:	5b                   	pop    %ebx
+  80123b:	5e                   	pop    %esi
+  80123c:	5f                   	pop    %edi
+  80123d:	5d                   	pop    %ebp
+  80123e:	c3                   	ret
+
+0080123f <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  80123f:	55                   	push   %ebp
+  801240:	89 e5                	mov    %esp,%ebp
+  801242:	57                   	push   %edi
+  801243:	56                   	push   %esi
+  801244:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  801245:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80124a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80124d:	b8 14 00 00 00       	mov    $0x14,%eax
+  801252:	89 cb                	mov    %ecx,%ebx
+  801254:	89 cf                	mov    %ecx,%edi
+  801256:	89 ce                	mov    %ecx,%esi
+  801258:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  80125a:	5b                   	pop    %ebx
+  80125b:	5e                   	pop    %esi
+  80125c:	5f                   	pop    %edi
+  80125d:	5d                   	pop    %ebp
+  80125e:	c3                   	ret
+
+0080125f <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80125f:	55                   	push   %ebp
+  801260:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801262:	8b 45 08             	mov    0x8(%ebp),%eax
+  801265:	05 00 00 00 30       	add    $0x30000000,%eax
+  80126a:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80126d:	5d                   	pop    %ebp
+  80126e:	c3                   	ret
+
+0080126f <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80126f:	55                   	push   %ebp
+  801270:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801272:	8b 45 08             	mov    0x8(%ebp),%eax
+  801275:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80127a:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80127f:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801284:	5d                   	pop    %ebp
+  801285:	c3                   	ret
+
+00801286 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801286:	55                   	push   %ebp
+  801287:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801289:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80128e:	eb 02                	jmp    801292 <fd_alloc+0xc>
+  801290:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801292:	89 c2                	mov    %eax,%edx
+  801294:	c1 ea 16             	shr    $0x16,%edx
+  801297:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80129e:	f6 c2 01             	test   $0x1,%dl
+  8012a1:	74 2b                	je     8012ce <fd_alloc+0x48>
+  8012a3:	89 c2                	mov    %eax,%edx
+  8012a5:	c1 ea 0c             	shr    $0xc,%edx
+  8012a8:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8012af:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8012b5:	f6 c1 01             	test   $0x1,%cl
+  8012b8:	74 14                	je     8012ce <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8012ba:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8012c0:	75 ce                	jne    801290 <fd_alloc+0xa>
+  8012c2:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8012c7:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8012cc:	eb 05                	jmp    8012d3 <fd_alloc+0x4d>
+			return 0;
+  8012ce:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8012d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012d6:	89 02                	mov    %eax,(%edx)
+}
+  8012d8:	89 c8                	mov    %ecx,%eax
+  8012da:	5d                   	pop    %ebp
+  8012db:	c3                   	ret
+
+008012dc <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8012dc:	55                   	push   %ebp
+  8012dd:	89 e5                	mov    %esp,%ebp
+  8012df:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8012e2:	83 f8 1f             	cmp    $0x1f,%eax
+  8012e5:	77 30                	ja     801317 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8012e7:	c1 e0 0c             	shl    $0xc,%eax
+  8012ea:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8012ef:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8012f5:	f6 c2 01             	test   $0x1,%dl
+  8012f8:	74 24                	je     80131e <fd_lookup+0x42>
+  8012fa:	89 c2                	mov    %eax,%edx
+  8012fc:	c1 ea 0c             	shr    $0xc,%edx
+  8012ff:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801306:	f6 c2 01             	test   $0x1,%dl
+  801309:	74 1a                	je     801325 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80130b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80130e:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801310:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801315:	5d                   	pop    %ebp
+  801316:	c3                   	ret
+		return -E_INVAL;
+  801317:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80131c:	eb f7                	jmp    801315 <fd_lookup+0x39>
+		return -E_INVAL;
+  80131e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801323:	eb f0                	jmp    801315 <fd_lookup+0x39>
+  801325:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80132a:	eb e9                	jmp    801315 <fd_lookup+0x39>
+
+0080132c <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80132c:	55                   	push   %ebp
+  80132d:	89 e5                	mov    %esp,%ebp
+  80132f:	53                   	push   %ebx
+  801330:	83 ec 04             	sub    $0x4,%esp
+  801333:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801336:	b8 00 00 00 00       	mov    $0x0,%eax
+  80133b:	eb 03                	jmp    801340 <dev_lookup+0x14>
+  80133d:	83 c0 01             	add    $0x1,%eax
+  801340:	8b 1c 85 8c 2e 80 00 	mov    0x802e8c(,%eax,4),%ebx
+  801347:	85 db                	test   %ebx,%ebx
+  801349:	74 0b                	je     801356 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  80134b:	39 13                	cmp    %edx,(%ebx)
+  80134d:	75 ee                	jne    80133d <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  80134f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801354:	eb 1f                	jmp    801375 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801356:	a1 18 40 80 00       	mov    0x804018,%eax
+  80135b:	8b 40 48             	mov    0x48(%eax),%eax
+  80135e:	83 ec 04             	sub    $0x4,%esp
+  801361:	52                   	push   %edx
+  801362:	50                   	push   %eax
+  801363:	68 10 2e 80 00       	push   $0x802e10
+  801368:	e8 7a f2 ff ff       	call   8005e7 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80136d:	83 c4 10             	add    $0x10,%esp
+  801370:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801375:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801378:	89 1a                	mov    %ebx,(%edx)
+}
+  80137a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80137d:	c9                   	leave
+  80137e:	c3                   	ret
+
+0080137f <fd_close>:
+{
+  80137f:	55                   	push   %ebp
+  801380:	89 e5                	mov    %esp,%ebp
+  801382:	57                   	push   %edi
+  801383:	56                   	push   %esi
+  801384:	53                   	push   %ebx
+  801385:	83 ec 24             	sub    $0x24,%esp
+  801388:	8b 75 08             	mov    0x8(%ebp),%esi
+  80138b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80138e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801391:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801392:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801398:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80139b:	50                   	push   %eax
+  80139c:	e8 3b ff ff ff       	call   8012dc <fd_lookup>
+  8013a1:	89 c3                	mov    %eax,%ebx
+  8013a3:	83 c4 10             	add    $0x10,%esp
+  8013a6:	85 c0                	test   %eax,%eax
+  8013a8:	78 05                	js     8013af <fd_close+0x30>
+	    || fd != fd2)
+  8013aa:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8013ad:	74 16                	je     8013c5 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8013af:	89 f8                	mov    %edi,%eax
+  8013b1:	84 c0                	test   %al,%al
+  8013b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013b8:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8013bb:	89 d8                	mov    %ebx,%eax
+  8013bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013c0:	5b                   	pop    %ebx
+  8013c1:	5e                   	pop    %esi
+  8013c2:	5f                   	pop    %edi
+  8013c3:	5d                   	pop    %ebp
+  8013c4:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8013c5:	83 ec 08             	sub    $0x8,%esp
+  8013c8:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8013cb:	50                   	push   %eax
+  8013cc:	ff 36                	push   (%esi)
+  8013ce:	e8 59 ff ff ff       	call   80132c <dev_lookup>
+  8013d3:	89 c3                	mov    %eax,%ebx
+  8013d5:	83 c4 10             	add    $0x10,%esp
+  8013d8:	85 c0                	test   %eax,%eax
+  8013da:	78 1a                	js     8013f6 <fd_close+0x77>
+		if (dev->dev_close)
+  8013dc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8013df:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8013e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8013e7:	85 c0                	test   %eax,%eax
+  8013e9:	74 0b                	je     8013f6 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8013eb:	83 ec 0c             	sub    $0xc,%esp
+  8013ee:	56                   	push   %esi
+  8013ef:	ff d0                	call   *%eax
+  8013f1:	89 c3                	mov    %eax,%ebx
+  8013f3:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8013f6:	83 ec 08             	sub    $0x8,%esp
+  8013f9:	56                   	push   %esi
+  8013fa:	6a 00                	push   $0x0
+  8013fc:	e8 10 fc ff ff       	call   801011 <sys_page_unmap>
+	return r;
+  801401:	83 c4 10             	add    $0x10,%esp
+  801404:	eb b5                	jmp    8013bb <fd_close+0x3c>
+
+00801406 <close>:
+
+int
+close(int fdnum)
+{
+  801406:	55                   	push   %ebp
+  801407:	89 e5                	mov    %esp,%ebp
+  801409:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80140c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80140f:	50                   	push   %eax
+  801410:	ff 75 08             	push   0x8(%ebp)
+  801413:	e8 c4 fe ff ff       	call   8012dc <fd_lookup>
+  801418:	83 c4 10             	add    $0x10,%esp
+  80141b:	85 c0                	test   %eax,%eax
+  80141d:	79 02                	jns    801421 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80141f:	c9                   	leave
+  801420:	c3                   	ret
+		return fd_close(fd, 1);
+  801421:	83 ec 08             	sub    $0x8,%esp
+  801424:	6a 01                	push   $0x1
+  801426:	ff 75 f4             	push   -0xc(%ebp)
+  801429:	e8 51 ff ff ff       	call   80137f <fd_close>
+  80142e:	83 c4 10             	add    $0x10,%esp
+  801431:	eb ec                	jmp    80141f <close+0x19>
+
+00801433 <close_all>:
+
+void
+close_all(void)
+{
+  801433:	55                   	push   %ebp
+  801434:	89 e5                	mov    %esp,%ebp
+  801436:	53                   	push   %ebx
+  801437:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80143a:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80143f:	83 ec 0c             	sub    $0xc,%esp
+  801442:	53                   	push   %ebx
+  801443:	e8 be ff ff ff       	call   801406 <close>
+	for (i = 0; i < MAXFD; i++)
+  801448:	83 c3 01             	add    $0x1,%ebx
+  80144b:	83 c4 10             	add    $0x10,%esp
+  80144e:	83 fb 20             	cmp    $0x20,%ebx
+  801451:	75 ec                	jne    80143f <close_all+0xc>
+}
+  801453:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801456:	c9                   	leave
+  801457:	c3                   	ret
+
+00801458 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801458:	55                   	push   %ebp
+  801459:	89 e5                	mov    %esp,%ebp
+  80145b:	57                   	push   %edi
+  80145c:	56                   	push   %esi
+  80145d:	53                   	push   %ebx
+  80145e:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801461:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801464:	50                   	push   %eax
+  801465:	ff 75 08             	push   0x8(%ebp)
+  801468:	e8 6f fe ff ff       	call   8012dc <fd_lookup>
+  80146d:	89 c3                	mov    %eax,%ebx
+  80146f:	83 c4 10             	add    $0x10,%esp
+  801472:	85 c0                	test   %eax,%eax
+  801474:	78 7f                	js     8014f5 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801476:	83 ec 0c             	sub    $0xc,%esp
+  801479:	ff 75 0c             	push   0xc(%ebp)
+  80147c:	e8 85 ff ff ff       	call   801406 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801481:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801484:	c1 e6 0c             	shl    $0xc,%esi
+  801487:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80148d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801490:	89 3c 24             	mov    %edi,(%esp)
+  801493:	e8 d7 fd ff ff       	call   80126f <fd2data>
+  801498:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80149a:	89 34 24             	mov    %esi,(%esp)
+  80149d:	e8 cd fd ff ff       	call   80126f <fd2data>
+  8014a2:	83 c4 10             	add    $0x10,%esp
+  8014a5:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8014a8:	89 d8                	mov    %ebx,%eax
+  8014aa:	c1 e8 16             	shr    $0x16,%eax
+  8014ad:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8014b4:	a8 01                	test   $0x1,%al
+  8014b6:	74 11                	je     8014c9 <dup+0x71>
+  8014b8:	89 d8                	mov    %ebx,%eax
+  8014ba:	c1 e8 0c             	shr    $0xc,%eax
+  8014bd:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8014c4:	f6 c2 01             	test   $0x1,%dl
+  8014c7:	75 36                	jne    8014ff <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8014c9:	89 f8                	mov    %edi,%eax
+  8014cb:	c1 e8 0c             	shr    $0xc,%eax
+  8014ce:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8014d5:	83 ec 0c             	sub    $0xc,%esp
+  8014d8:	25 07 0e 00 00       	and    $0xe07,%eax
+  8014dd:	50                   	push   %eax
+  8014de:	56                   	push   %esi
+  8014df:	6a 00                	push   $0x0
+  8014e1:	57                   	push   %edi
+  8014e2:	6a 00                	push   $0x0
+  8014e4:	e8 e6 fa ff ff       	call   800fcf <sys_page_map>
+  8014e9:	89 c3                	mov    %eax,%ebx
+  8014eb:	83 c4 20             	add    $0x20,%esp
+  8014ee:	85 c0                	test   %eax,%eax
+  8014f0:	78 33                	js     801525 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8014f2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8014f5:	89 d8                	mov    %ebx,%eax
+  8014f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014fa:	5b                   	pop    %ebx
+  8014fb:	5e                   	pop    %esi
+  8014fc:	5f                   	pop    %edi
+  8014fd:	5d                   	pop    %ebp
+  8014fe:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8014ff:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801506:	83 ec 0c             	sub    $0xc,%esp
+  801509:	25 07 0e 00 00       	and    $0xe07,%eax
+  80150e:	50                   	push   %eax
+  80150f:	ff 75 d4             	push   -0x2c(%ebp)
+  801512:	6a 00                	push   $0x0
+  801514:	53                   	push   %ebx
+  801515:	6a 00                	push   $0x0
+  801517:	e8 b3 fa ff ff       	call   800fcf <sys_page_map>
+  80151c:	89 c3                	mov    %eax,%ebx
+  80151e:	83 c4 20             	add    $0x20,%esp
+  801521:	85 c0                	test   %eax,%eax
+  801523:	79 a4                	jns    8014c9 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801525:	83 ec 08             	sub    $0x8,%esp
+  801528:	56                   	push   %esi
+  801529:	6a 00                	push   $0x0
+  80152b:	e8 e1 fa ff ff       	call   801011 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801530:	83 c4 08             	add    $0x8,%esp
+  801533:	ff 75 d4             	push   -0x2c(%ebp)
+  801536:	6a 00                	push   $0x0
+  801538:	e8 d4 fa ff ff       	call   801011 <sys_page_unmap>
+	return r;
+  80153d:	83 c4 10             	add    $0x10,%esp
+  801540:	eb b3                	jmp    8014f5 <dup+0x9d>
+
+00801542 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801542:	55                   	push   %ebp
+  801543:	89 e5                	mov    %esp,%ebp
+  801545:	56                   	push   %esi
+  801546:	53                   	push   %ebx
+  801547:	83 ec 18             	sub    $0x18,%esp
+  80154a:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80154d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801550:	50                   	push   %eax
+  801551:	56                   	push   %esi
+  801552:	e8 85 fd ff ff       	call   8012dc <fd_lookup>
+  801557:	83 c4 10             	add    $0x10,%esp
+  80155a:	85 c0                	test   %eax,%eax
+  80155c:	78 3c                	js     80159a <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80155e:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801561:	83 ec 08             	sub    $0x8,%esp
+  801564:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801567:	50                   	push   %eax
+  801568:	ff 33                	push   (%ebx)
+  80156a:	e8 bd fd ff ff       	call   80132c <dev_lookup>
+  80156f:	83 c4 10             	add    $0x10,%esp
+  801572:	85 c0                	test   %eax,%eax
+  801574:	78 24                	js     80159a <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801576:	8b 43 08             	mov    0x8(%ebx),%eax
+  801579:	83 e0 03             	and    $0x3,%eax
+  80157c:	83 f8 01             	cmp    $0x1,%eax
+  80157f:	74 20                	je     8015a1 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801581:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801584:	8b 40 08             	mov    0x8(%eax),%eax
+  801587:	85 c0                	test   %eax,%eax
+  801589:	74 37                	je     8015c2 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80158b:	83 ec 04             	sub    $0x4,%esp
+  80158e:	ff 75 10             	push   0x10(%ebp)
+  801591:	ff 75 0c             	push   0xc(%ebp)
+  801594:	53                   	push   %ebx
+  801595:	ff d0                	call   *%eax
+  801597:	83 c4 10             	add    $0x10,%esp
+}
+  80159a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80159d:	5b                   	pop    %ebx
+  80159e:	5e                   	pop    %esi
+  80159f:	5d                   	pop    %ebp
+  8015a0:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8015a1:	a1 18 40 80 00       	mov    0x804018,%eax
+  8015a6:	8b 40 48             	mov    0x48(%eax),%eax
+  8015a9:	83 ec 04             	sub    $0x4,%esp
+  8015ac:	56                   	push   %esi
+  8015ad:	50                   	push   %eax
+  8015ae:	68 51 2e 80 00       	push   $0x802e51
+  8015b3:	e8 2f f0 ff ff       	call   8005e7 <cprintf>
+		return -E_INVAL;
+  8015b8:	83 c4 10             	add    $0x10,%esp
+  8015bb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015c0:	eb d8                	jmp    80159a <read+0x58>
+		return -E_NOT_SUPP;
+  8015c2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015c7:	eb d1                	jmp    80159a <read+0x58>
+
+008015c9 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8015c9:	55                   	push   %ebp
+  8015ca:	89 e5                	mov    %esp,%ebp
+  8015cc:	57                   	push   %edi
+  8015cd:	56                   	push   %esi
+  8015ce:	53                   	push   %ebx
+  8015cf:	83 ec 0c             	sub    $0xc,%esp
+  8015d2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8015d5:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8015d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015dd:	eb 02                	jmp    8015e1 <readn+0x18>
+  8015df:	01 c3                	add    %eax,%ebx
+  8015e1:	39 f3                	cmp    %esi,%ebx
+  8015e3:	73 21                	jae    801606 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8015e5:	83 ec 04             	sub    $0x4,%esp
+  8015e8:	89 f0                	mov    %esi,%eax
+  8015ea:	29 d8                	sub    %ebx,%eax
+  8015ec:	50                   	push   %eax
+  8015ed:	89 d8                	mov    %ebx,%eax
+  8015ef:	03 45 0c             	add    0xc(%ebp),%eax
+  8015f2:	50                   	push   %eax
+  8015f3:	57                   	push   %edi
+  8015f4:	e8 49 ff ff ff       	call   801542 <read>
+		if (m < 0)
+  8015f9:	83 c4 10             	add    $0x10,%esp
+  8015fc:	85 c0                	test   %eax,%eax
+  8015fe:	78 04                	js     801604 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801600:	75 dd                	jne    8015df <readn+0x16>
+  801602:	eb 02                	jmp    801606 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801604:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801606:	89 d8                	mov    %ebx,%eax
+  801608:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80160b:	5b                   	pop    %ebx
+  80160c:	5e                   	pop    %esi
+  80160d:	5f                   	pop    %edi
+  80160e:	5d                   	pop    %ebp
+  80160f:	c3                   	ret
+
+00801610 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801610:	55                   	push   %ebp
+  801611:	89 e5                	mov    %esp,%ebp
+  801613:	56                   	push   %esi
+  801614:	53                   	push   %ebx
+  801615:	83 ec 18             	sub    $0x18,%esp
+  801618:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80161b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80161e:	50                   	push   %eax
+  80161f:	53                   	push   %ebx
+  801620:	e8 b7 fc ff ff       	call   8012dc <fd_lookup>
+  801625:	83 c4 10             	add    $0x10,%esp
+  801628:	85 c0                	test   %eax,%eax
+  80162a:	78 37                	js     801663 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80162c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80162f:	83 ec 08             	sub    $0x8,%esp
+  801632:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801635:	50                   	push   %eax
+  801636:	ff 36                	push   (%esi)
+  801638:	e8 ef fc ff ff       	call   80132c <dev_lookup>
+  80163d:	83 c4 10             	add    $0x10,%esp
+  801640:	85 c0                	test   %eax,%eax
+  801642:	78 1f                	js     801663 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801644:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801648:	74 20                	je     80166a <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80164a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80164d:	8b 40 0c             	mov    0xc(%eax),%eax
+  801650:	85 c0                	test   %eax,%eax
+  801652:	74 37                	je     80168b <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801654:	83 ec 04             	sub    $0x4,%esp
+  801657:	ff 75 10             	push   0x10(%ebp)
+  80165a:	ff 75 0c             	push   0xc(%ebp)
+  80165d:	56                   	push   %esi
+  80165e:	ff d0                	call   *%eax
+  801660:	83 c4 10             	add    $0x10,%esp
+}
+  801663:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801666:	5b                   	pop    %ebx
+  801667:	5e                   	pop    %esi
+  801668:	5d                   	pop    %ebp
+  801669:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80166a:	a1 18 40 80 00       	mov    0x804018,%eax
+  80166f:	8b 40 48             	mov    0x48(%eax),%eax
+  801672:	83 ec 04             	sub    $0x4,%esp
+  801675:	53                   	push   %ebx
+  801676:	50                   	push   %eax
+  801677:	68 6d 2e 80 00       	push   $0x802e6d
+  80167c:	e8 66 ef ff ff       	call   8005e7 <cprintf>
+		return -E_INVAL;
+  801681:	83 c4 10             	add    $0x10,%esp
+  801684:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801689:	eb d8                	jmp    801663 <write+0x53>
+		return -E_NOT_SUPP;
+  80168b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801690:	eb d1                	jmp    801663 <write+0x53>
+
+00801692 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801692:	55                   	push   %ebp
+  801693:	89 e5                	mov    %esp,%ebp
+  801695:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801698:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80169b:	50                   	push   %eax
+  80169c:	ff 75 08             	push   0x8(%ebp)
+  80169f:	e8 38 fc ff ff       	call   8012dc <fd_lookup>
+  8016a4:	83 c4 10             	add    $0x10,%esp
+  8016a7:	85 c0                	test   %eax,%eax
+  8016a9:	78 0e                	js     8016b9 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8016ab:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8016ae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016b1:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8016b4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8016b9:	c9                   	leave
+  8016ba:	c3                   	ret
+
+008016bb <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8016bb:	55                   	push   %ebp
+  8016bc:	89 e5                	mov    %esp,%ebp
+  8016be:	56                   	push   %esi
+  8016bf:	53                   	push   %ebx
+  8016c0:	83 ec 18             	sub    $0x18,%esp
+  8016c3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016c6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016c9:	50                   	push   %eax
+  8016ca:	53                   	push   %ebx
+  8016cb:	e8 0c fc ff ff       	call   8012dc <fd_lookup>
+  8016d0:	83 c4 10             	add    $0x10,%esp
+  8016d3:	85 c0                	test   %eax,%eax
+  8016d5:	78 34                	js     80170b <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016d7:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8016da:	83 ec 08             	sub    $0x8,%esp
+  8016dd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016e0:	50                   	push   %eax
+  8016e1:	ff 36                	push   (%esi)
+  8016e3:	e8 44 fc ff ff       	call   80132c <dev_lookup>
+  8016e8:	83 c4 10             	add    $0x10,%esp
+  8016eb:	85 c0                	test   %eax,%eax
+  8016ed:	78 1c                	js     80170b <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8016ef:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8016f3:	74 1d                	je     801712 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8016f5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016f8:	8b 40 18             	mov    0x18(%eax),%eax
+  8016fb:	85 c0                	test   %eax,%eax
+  8016fd:	74 34                	je     801733 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8016ff:	83 ec 08             	sub    $0x8,%esp
+  801702:	ff 75 0c             	push   0xc(%ebp)
+  801705:	56                   	push   %esi
+  801706:	ff d0                	call   *%eax
+  801708:	83 c4 10             	add    $0x10,%esp
+}
+  80170b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80170e:	5b                   	pop    %ebx
+  80170f:	5e                   	pop    %esi
+  801710:	5d                   	pop    %ebp
+  801711:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801712:	a1 18 40 80 00       	mov    0x804018,%eax
+  801717:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80171a:	83 ec 04             	sub    $0x4,%esp
+  80171d:	53                   	push   %ebx
+  80171e:	50                   	push   %eax
+  80171f:	68 30 2e 80 00       	push   $0x802e30
+  801724:	e8 be ee ff ff       	call   8005e7 <cprintf>
+		return -E_INVAL;
+  801729:	83 c4 10             	add    $0x10,%esp
+  80172c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801731:	eb d8                	jmp    80170b <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801733:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801738:	eb d1                	jmp    80170b <ftruncate+0x50>
+
+0080173a <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80173a:	55                   	push   %ebp
+  80173b:	89 e5                	mov    %esp,%ebp
+  80173d:	56                   	push   %esi
+  80173e:	53                   	push   %ebx
+  80173f:	83 ec 18             	sub    $0x18,%esp
+  801742:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801745:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801748:	50                   	push   %eax
+  801749:	ff 75 08             	push   0x8(%ebp)
+  80174c:	e8 8b fb ff ff       	call   8012dc <fd_lookup>
+  801751:	83 c4 10             	add    $0x10,%esp
+  801754:	85 c0                	test   %eax,%eax
+  801756:	78 49                	js     8017a1 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801758:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80175b:	83 ec 08             	sub    $0x8,%esp
+  80175e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801761:	50                   	push   %eax
+  801762:	ff 36                	push   (%esi)
+  801764:	e8 c3 fb ff ff       	call   80132c <dev_lookup>
+  801769:	83 c4 10             	add    $0x10,%esp
+  80176c:	85 c0                	test   %eax,%eax
+  80176e:	78 31                	js     8017a1 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801770:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801773:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801777:	74 2f                	je     8017a8 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801779:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80177c:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801783:	00 00 00 
+	stat->st_isdir = 0;
+  801786:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80178d:	00 00 00 
+	stat->st_dev = dev;
+  801790:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801796:	83 ec 08             	sub    $0x8,%esp
+  801799:	53                   	push   %ebx
+  80179a:	56                   	push   %esi
+  80179b:	ff 50 14             	call   *0x14(%eax)
+  80179e:	83 c4 10             	add    $0x10,%esp
+}
+  8017a1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017a4:	5b                   	pop    %ebx
+  8017a5:	5e                   	pop    %esi
+  8017a6:	5d                   	pop    %ebp
+  8017a7:	c3                   	ret
+		return -E_NOT_SUPP;
+  8017a8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017ad:	eb f2                	jmp    8017a1 <fstat+0x67>
+
+008017af <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8017af:	55                   	push   %ebp
+  8017b0:	89 e5                	mov    %esp,%ebp
+  8017b2:	56                   	push   %esi
+  8017b3:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8017b4:	83 ec 08             	sub    $0x8,%esp
+  8017b7:	6a 00                	push   $0x0
+  8017b9:	ff 75 08             	push   0x8(%ebp)
+  8017bc:	e8 e4 01 00 00       	call   8019a5 <open>
+  8017c1:	89 c3                	mov    %eax,%ebx
+  8017c3:	83 c4 10             	add    $0x10,%esp
+  8017c6:	85 c0                	test   %eax,%eax
+  8017c8:	78 1b                	js     8017e5 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8017ca:	83 ec 08             	sub    $0x8,%esp
+  8017cd:	ff 75 0c             	push   0xc(%ebp)
+  8017d0:	50                   	push   %eax
+  8017d1:	e8 64 ff ff ff       	call   80173a <fstat>
+  8017d6:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8017d8:	89 1c 24             	mov    %ebx,(%esp)
+  8017db:	e8 26 fc ff ff       	call   801406 <close>
+	return r;
+  8017e0:	83 c4 10             	add    $0x10,%esp
+  8017e3:	89 f3                	mov    %esi,%ebx
+}
+  8017e5:	89 d8                	mov    %ebx,%eax
+  8017e7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017ea:	5b                   	pop    %ebx
+  8017eb:	5e                   	pop    %esi
+  8017ec:	5d                   	pop    %ebp
+  8017ed:	c3                   	ret
+
+008017ee <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  8017ee:	55                   	push   %ebp
+  8017ef:	89 e5                	mov    %esp,%ebp
+  8017f1:	56                   	push   %esi
+  8017f2:	53                   	push   %ebx
+  8017f3:	89 c6                	mov    %eax,%esi
+  8017f5:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  8017f7:	83 3d 10 40 80 00 00 	cmpl   $0x0,0x804010
+  8017fe:	74 27                	je     801827 <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801800:	6a 07                	push   $0x7
+  801802:	68 00 50 80 00       	push   $0x805000
+  801807:	56                   	push   %esi
+  801808:	ff 35 10 40 80 00    	push   0x804010
+  80180e:	e8 17 0c 00 00       	call   80242a <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  801813:	83 c4 0c             	add    $0xc,%esp
+  801816:	6a 00                	push   $0x0
+  801818:	53                   	push   %ebx
+  801819:	6a 00                	push   $0x0
+  80181b:	e8 96 0b 00 00       	call   8023b6 <ipc_recv>
+}
+  801820:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801823:	5b                   	pop    %ebx
+  801824:	5e                   	pop    %esi
+  801825:	5d                   	pop    %ebp
+  801826:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  801827:	83 ec 0c             	sub    $0xc,%esp
+  80182a:	6a 01                	push   $0x1
+  80182c:	e8 4d 0c 00 00       	call   80247e <ipc_find_env>
+  801831:	a3 10 40 80 00       	mov    %eax,0x804010
+  801836:	83 c4 10             	add    $0x10,%esp
+  801839:	eb c5                	jmp    801800 <fsipc+0x12>
+
+0080183b <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80183b:	55                   	push   %ebp
+  80183c:	89 e5                	mov    %esp,%ebp
+  80183e:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801841:	8b 45 08             	mov    0x8(%ebp),%eax
+  801844:	8b 40 0c             	mov    0xc(%eax),%eax
+  801847:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.set_size.req_size = newsize;
+  80184c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80184f:	a3 04 50 80 00       	mov    %eax,0x805004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801854:	ba 00 00 00 00       	mov    $0x0,%edx
+  801859:	b8 02 00 00 00       	mov    $0x2,%eax
+  80185e:	e8 8b ff ff ff       	call   8017ee <fsipc>
+}
+  801863:	c9                   	leave
+  801864:	c3                   	ret
+
+00801865 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801865:	55                   	push   %ebp
+  801866:	89 e5                	mov    %esp,%ebp
+  801868:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80186b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80186e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801871:	a3 00 50 80 00       	mov    %eax,0x805000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801876:	ba 00 00 00 00       	mov    $0x0,%edx
+  80187b:	b8 06 00 00 00       	mov    $0x6,%eax
+  801880:	e8 69 ff ff ff       	call   8017ee <fsipc>
+}
+  801885:	c9                   	leave
+  801886:	c3                   	ret
+
+00801887 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801887:	55                   	push   %ebp
+  801888:	89 e5                	mov    %esp,%ebp
+  80188a:	53                   	push   %ebx
+  80188b:	83 ec 04             	sub    $0x4,%esp
+  80188e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801891:	8b 45 08             	mov    0x8(%ebp),%eax
+  801894:	8b 40 0c             	mov    0xc(%eax),%eax
+  801897:	a3 00 50 80 00       	mov    %eax,0x805000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80189c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018a1:	b8 05 00 00 00       	mov    $0x5,%eax
+  8018a6:	e8 43 ff ff ff       	call   8017ee <fsipc>
+  8018ab:	85 c0                	test   %eax,%eax
+  8018ad:	78 2c                	js     8018db <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8018af:	83 ec 08             	sub    $0x8,%esp
+  8018b2:	68 00 50 80 00       	push   $0x805000
+  8018b7:	53                   	push   %ebx
+  8018b8:	e8 e3 f2 ff ff       	call   800ba0 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  8018bd:	a1 80 50 80 00       	mov    0x805080,%eax
+  8018c2:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8018c8:	a1 84 50 80 00       	mov    0x805084,%eax
+  8018cd:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  8018d3:	83 c4 10             	add    $0x10,%esp
+  8018d6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018db:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018de:	c9                   	leave
+  8018df:	c3                   	ret
+
+008018e0 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8018e0:	55                   	push   %ebp
+  8018e1:	89 e5                	mov    %esp,%ebp
+  8018e3:	83 ec 0c             	sub    $0xc,%esp
+  8018e6:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8018e9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018ec:	8b 52 0c             	mov    0xc(%edx),%edx
+  8018ef:	89 15 00 50 80 00    	mov    %edx,0x805000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8018f5:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8018fa:	39 d0                	cmp    %edx,%eax
+  8018fc:	0f 47 c2             	cmova  %edx,%eax
+  8018ff:	a3 04 50 80 00       	mov    %eax,0x805004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  801904:	50                   	push   %eax
+  801905:	ff 75 0c             	push   0xc(%ebp)
+  801908:	68 08 50 80 00       	push   $0x805008
+  80190d:	e8 14 f4 ff ff       	call   800d26 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801912:	ba 00 00 00 00       	mov    $0x0,%edx
+  801917:	b8 04 00 00 00       	mov    $0x4,%eax
+  80191c:	e8 cd fe ff ff       	call   8017ee <fsipc>
+}
+  801921:	c9                   	leave
+  801922:	c3                   	ret
+
+00801923 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801923:	55                   	push   %ebp
+  801924:	89 e5                	mov    %esp,%ebp
+  801926:	56                   	push   %esi
+  801927:	53                   	push   %ebx
+  801928:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80192b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80192e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801931:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.read.req_n = n;
+  801936:	89 35 04 50 80 00    	mov    %esi,0x805004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  80193c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801941:	b8 03 00 00 00       	mov    $0x3,%eax
+  801946:	e8 a3 fe ff ff       	call   8017ee <fsipc>
+  80194b:	89 c3                	mov    %eax,%ebx
+  80194d:	85 c0                	test   %eax,%eax
+  80194f:	78 1f                	js     801970 <devfile_read+0x4d>
+  assert(r <= n);
+  801951:	39 c6                	cmp    %eax,%esi
+  801953:	72 24                	jb     801979 <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  801955:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80195a:	7f 33                	jg     80198f <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80195c:	83 ec 04             	sub    $0x4,%esp
+  80195f:	50                   	push   %eax
+  801960:	68 00 50 80 00       	push   $0x805000
+  801965:	ff 75 0c             	push   0xc(%ebp)
+  801968:	e8 b9 f3 ff ff       	call   800d26 <memmove>
+  return r;
+  80196d:	83 c4 10             	add    $0x10,%esp
+}
+  801970:	89 d8                	mov    %ebx,%eax
+  801972:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801975:	5b                   	pop    %ebx
+  801976:	5e                   	pop    %esi
+  801977:	5d                   	pop    %ebp
+  801978:	c3                   	ret
+  assert(r <= n);
+  801979:	68 a0 2e 80 00       	push   $0x802ea0
+  80197e:	68 a7 2e 80 00       	push   $0x802ea7
+  801983:	6a 78                	push   $0x78
+  801985:	68 bc 2e 80 00       	push   $0x802ebc
+  80198a:	e8 e1 09 00 00       	call   802370 <_panic>
+  assert(r <= PGSIZE);
+  80198f:	68 c7 2e 80 00       	push   $0x802ec7
+  801994:	68 a7 2e 80 00       	push   $0x802ea7
+  801999:	6a 79                	push   $0x79
+  80199b:	68 bc 2e 80 00       	push   $0x802ebc
+  8019a0:	e8 cb 09 00 00       	call   802370 <_panic>
+
+008019a5 <open>:
+open(const char *path, int mode) {
+  8019a5:	55                   	push   %ebp
+  8019a6:	89 e5                	mov    %esp,%ebp
+  8019a8:	56                   	push   %esi
+  8019a9:	53                   	push   %ebx
+  8019aa:	83 ec 1c             	sub    $0x1c,%esp
+  8019ad:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  8019b0:	56                   	push   %esi
+  8019b1:	e8 af f1 ff ff       	call   800b65 <strlen>
+  8019b6:	83 c4 10             	add    $0x10,%esp
+  8019b9:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8019be:	7f 6c                	jg     801a2c <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  8019c0:	83 ec 0c             	sub    $0xc,%esp
+  8019c3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019c6:	50                   	push   %eax
+  8019c7:	e8 ba f8 ff ff       	call   801286 <fd_alloc>
+  8019cc:	89 c3                	mov    %eax,%ebx
+  8019ce:	83 c4 10             	add    $0x10,%esp
+  8019d1:	85 c0                	test   %eax,%eax
+  8019d3:	78 3c                	js     801a11 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  8019d5:	83 ec 08             	sub    $0x8,%esp
+  8019d8:	56                   	push   %esi
+  8019d9:	68 00 50 80 00       	push   $0x805000
+  8019de:	e8 bd f1 ff ff       	call   800ba0 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  8019e3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019e6:	a3 00 54 80 00       	mov    %eax,0x805400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8019eb:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8019ee:	b8 01 00 00 00       	mov    $0x1,%eax
+  8019f3:	e8 f6 fd ff ff       	call   8017ee <fsipc>
+  8019f8:	89 c3                	mov    %eax,%ebx
+  8019fa:	83 c4 10             	add    $0x10,%esp
+  8019fd:	85 c0                	test   %eax,%eax
+  8019ff:	78 19                	js     801a1a <open+0x75>
+  return fd2num(fd);
+  801a01:	83 ec 0c             	sub    $0xc,%esp
+  801a04:	ff 75 f4             	push   -0xc(%ebp)
+  801a07:	e8 53 f8 ff ff       	call   80125f <fd2num>
+  801a0c:	89 c3                	mov    %eax,%ebx
+  801a0e:	83 c4 10             	add    $0x10,%esp
+}
+  801a11:	89 d8                	mov    %ebx,%eax
+  801a13:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a16:	5b                   	pop    %ebx
+  801a17:	5e                   	pop    %esi
+  801a18:	5d                   	pop    %ebp
+  801a19:	c3                   	ret
+    fd_close(fd, 0);
+  801a1a:	83 ec 08             	sub    $0x8,%esp
+  801a1d:	6a 00                	push   $0x0
+  801a1f:	ff 75 f4             	push   -0xc(%ebp)
+  801a22:	e8 58 f9 ff ff       	call   80137f <fd_close>
+    return r;
+  801a27:	83 c4 10             	add    $0x10,%esp
+  801a2a:	eb e5                	jmp    801a11 <open+0x6c>
+    return -E_BAD_PATH;
+  801a2c:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801a31:	eb de                	jmp    801a11 <open+0x6c>
+
+00801a33 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  801a33:	55                   	push   %ebp
+  801a34:	89 e5                	mov    %esp,%ebp
+  801a36:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801a39:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a3e:	b8 08 00 00 00       	mov    $0x8,%eax
+  801a43:	e8 a6 fd ff ff       	call   8017ee <fsipc>
+}
+  801a48:	c9                   	leave
+  801a49:	c3                   	ret
+
+00801a4a <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801a4a:	55                   	push   %ebp
+  801a4b:	89 e5                	mov    %esp,%ebp
+  801a4d:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801a50:	68 d3 2e 80 00       	push   $0x802ed3
+  801a55:	ff 75 0c             	push   0xc(%ebp)
+  801a58:	e8 43 f1 ff ff       	call   800ba0 <strcpy>
+	return 0;
+}
+  801a5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a62:	c9                   	leave
+  801a63:	c3                   	ret
+
+00801a64 <devsock_close>:
+{
+  801a64:	55                   	push   %ebp
+  801a65:	89 e5                	mov    %esp,%ebp
+  801a67:	53                   	push   %ebx
+  801a68:	83 ec 10             	sub    $0x10,%esp
+  801a6b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801a6e:	53                   	push   %ebx
+  801a6f:	e8 49 0a 00 00       	call   8024bd <pageref>
+  801a74:	89 c2                	mov    %eax,%edx
+  801a76:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801a79:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801a7e:	83 fa 01             	cmp    $0x1,%edx
+  801a81:	74 05                	je     801a88 <devsock_close+0x24>
+}
+  801a83:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a86:	c9                   	leave
+  801a87:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801a88:	83 ec 0c             	sub    $0xc,%esp
+  801a8b:	ff 73 0c             	push   0xc(%ebx)
+  801a8e:	e8 b7 02 00 00       	call   801d4a <nsipc_close>
+  801a93:	83 c4 10             	add    $0x10,%esp
+  801a96:	eb eb                	jmp    801a83 <devsock_close+0x1f>
+
+00801a98 <devsock_write>:
+{
+  801a98:	55                   	push   %ebp
+  801a99:	89 e5                	mov    %esp,%ebp
+  801a9b:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801a9e:	6a 00                	push   $0x0
+  801aa0:	ff 75 10             	push   0x10(%ebp)
+  801aa3:	ff 75 0c             	push   0xc(%ebp)
+  801aa6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801aa9:	ff 70 0c             	push   0xc(%eax)
+  801aac:	e8 79 03 00 00       	call   801e2a <nsipc_send>
+}
+  801ab1:	c9                   	leave
+  801ab2:	c3                   	ret
+
+00801ab3 <devsock_read>:
+{
+  801ab3:	55                   	push   %ebp
+  801ab4:	89 e5                	mov    %esp,%ebp
+  801ab6:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801ab9:	6a 00                	push   $0x0
+  801abb:	ff 75 10             	push   0x10(%ebp)
+  801abe:	ff 75 0c             	push   0xc(%ebp)
+  801ac1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ac4:	ff 70 0c             	push   0xc(%eax)
+  801ac7:	e8 ef 02 00 00       	call   801dbb <nsipc_recv>
+}
+  801acc:	c9                   	leave
+  801acd:	c3                   	ret
+
+00801ace <fd2sockid>:
+{
+  801ace:	55                   	push   %ebp
+  801acf:	89 e5                	mov    %esp,%ebp
+  801ad1:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801ad4:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801ad7:	52                   	push   %edx
+  801ad8:	50                   	push   %eax
+  801ad9:	e8 fe f7 ff ff       	call   8012dc <fd_lookup>
+  801ade:	83 c4 10             	add    $0x10,%esp
+  801ae1:	85 c0                	test   %eax,%eax
+  801ae3:	78 10                	js     801af5 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801ae5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ae8:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  801aee:	39 08                	cmp    %ecx,(%eax)
+  801af0:	75 05                	jne    801af7 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801af2:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801af5:	c9                   	leave
+  801af6:	c3                   	ret
+		return -E_NOT_SUPP;
+  801af7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801afc:	eb f7                	jmp    801af5 <fd2sockid+0x27>
+
+00801afe <alloc_sockfd>:
+{
+  801afe:	55                   	push   %ebp
+  801aff:	89 e5                	mov    %esp,%ebp
+  801b01:	56                   	push   %esi
+  801b02:	53                   	push   %ebx
+  801b03:	83 ec 1c             	sub    $0x1c,%esp
+  801b06:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801b08:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b0b:	50                   	push   %eax
+  801b0c:	e8 75 f7 ff ff       	call   801286 <fd_alloc>
+  801b11:	89 c3                	mov    %eax,%ebx
+  801b13:	83 c4 10             	add    $0x10,%esp
+  801b16:	85 c0                	test   %eax,%eax
+  801b18:	78 43                	js     801b5d <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801b1a:	83 ec 04             	sub    $0x4,%esp
+  801b1d:	68 07 04 00 00       	push   $0x407
+  801b22:	ff 75 f4             	push   -0xc(%ebp)
+  801b25:	6a 00                	push   $0x0
+  801b27:	e8 60 f4 ff ff       	call   800f8c <sys_page_alloc>
+  801b2c:	89 c3                	mov    %eax,%ebx
+  801b2e:	83 c4 10             	add    $0x10,%esp
+  801b31:	85 c0                	test   %eax,%eax
+  801b33:	78 28                	js     801b5d <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801b35:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b38:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  801b3e:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801b40:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b43:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801b4a:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801b4d:	83 ec 0c             	sub    $0xc,%esp
+  801b50:	50                   	push   %eax
+  801b51:	e8 09 f7 ff ff       	call   80125f <fd2num>
+  801b56:	89 c3                	mov    %eax,%ebx
+  801b58:	83 c4 10             	add    $0x10,%esp
+  801b5b:	eb 0c                	jmp    801b69 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801b5d:	83 ec 0c             	sub    $0xc,%esp
+  801b60:	56                   	push   %esi
+  801b61:	e8 e4 01 00 00       	call   801d4a <nsipc_close>
+		return r;
+  801b66:	83 c4 10             	add    $0x10,%esp
+}
+  801b69:	89 d8                	mov    %ebx,%eax
+  801b6b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b6e:	5b                   	pop    %ebx
+  801b6f:	5e                   	pop    %esi
+  801b70:	5d                   	pop    %ebp
+  801b71:	c3                   	ret
+
+00801b72 <accept>:
+{
+  801b72:	55                   	push   %ebp
+  801b73:	89 e5                	mov    %esp,%ebp
+  801b75:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801b78:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b7b:	e8 4e ff ff ff       	call   801ace <fd2sockid>
+  801b80:	85 c0                	test   %eax,%eax
+  801b82:	78 1b                	js     801b9f <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801b84:	83 ec 04             	sub    $0x4,%esp
+  801b87:	ff 75 10             	push   0x10(%ebp)
+  801b8a:	ff 75 0c             	push   0xc(%ebp)
+  801b8d:	50                   	push   %eax
+  801b8e:	e8 0e 01 00 00       	call   801ca1 <nsipc_accept>
+  801b93:	83 c4 10             	add    $0x10,%esp
+  801b96:	85 c0                	test   %eax,%eax
+  801b98:	78 05                	js     801b9f <accept+0x2d>
+	return alloc_sockfd(r);
+  801b9a:	e8 5f ff ff ff       	call   801afe <alloc_sockfd>
+}
+  801b9f:	c9                   	leave
+  801ba0:	c3                   	ret
+
+00801ba1 <bind>:
+{
+  801ba1:	55                   	push   %ebp
+  801ba2:	89 e5                	mov    %esp,%ebp
+  801ba4:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801ba7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801baa:	e8 1f ff ff ff       	call   801ace <fd2sockid>
+  801baf:	85 c0                	test   %eax,%eax
+  801bb1:	78 12                	js     801bc5 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801bb3:	83 ec 04             	sub    $0x4,%esp
+  801bb6:	ff 75 10             	push   0x10(%ebp)
+  801bb9:	ff 75 0c             	push   0xc(%ebp)
+  801bbc:	50                   	push   %eax
+  801bbd:	e8 31 01 00 00       	call   801cf3 <nsipc_bind>
+  801bc2:	83 c4 10             	add    $0x10,%esp
+}
+  801bc5:	c9                   	leave
+  801bc6:	c3                   	ret
+
+00801bc7 <shutdown>:
+{
+  801bc7:	55                   	push   %ebp
+  801bc8:	89 e5                	mov    %esp,%ebp
+  801bca:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801bcd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bd0:	e8 f9 fe ff ff       	call   801ace <fd2sockid>
+  801bd5:	85 c0                	test   %eax,%eax
+  801bd7:	78 0f                	js     801be8 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801bd9:	83 ec 08             	sub    $0x8,%esp
+  801bdc:	ff 75 0c             	push   0xc(%ebp)
+  801bdf:	50                   	push   %eax
+  801be0:	e8 43 01 00 00       	call   801d28 <nsipc_shutdown>
+  801be5:	83 c4 10             	add    $0x10,%esp
+}
+  801be8:	c9                   	leave
+  801be9:	c3                   	ret
+
+00801bea <connect>:
+{
+  801bea:	55                   	push   %ebp
+  801beb:	89 e5                	mov    %esp,%ebp
+  801bed:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801bf0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bf3:	e8 d6 fe ff ff       	call   801ace <fd2sockid>
+  801bf8:	85 c0                	test   %eax,%eax
+  801bfa:	78 12                	js     801c0e <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801bfc:	83 ec 04             	sub    $0x4,%esp
+  801bff:	ff 75 10             	push   0x10(%ebp)
+  801c02:	ff 75 0c             	push   0xc(%ebp)
+  801c05:	50                   	push   %eax
+  801c06:	e8 59 01 00 00       	call   801d64 <nsipc_connect>
+  801c0b:	83 c4 10             	add    $0x10,%esp
+}
+  801c0e:	c9                   	leave
+  801c0f:	c3                   	ret
+
+00801c10 <listen>:
+{
+  801c10:	55                   	push   %ebp
+  801c11:	89 e5                	mov    %esp,%ebp
+  801c13:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801c16:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c19:	e8 b0 fe ff ff       	call   801ace <fd2sockid>
+  801c1e:	85 c0                	test   %eax,%eax
+  801c20:	78 0f                	js     801c31 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801c22:	83 ec 08             	sub    $0x8,%esp
+  801c25:	ff 75 0c             	push   0xc(%ebp)
+  801c28:	50                   	push   %eax
+  801c29:	e8 6b 01 00 00       	call   801d99 <nsipc_listen>
+  801c2e:	83 c4 10             	add    $0x10,%esp
+}
+  801c31:	c9                   	leave
+  801c32:	c3                   	ret
+
+00801c33 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801c33:	55                   	push   %ebp
+  801c34:	89 e5                	mov    %esp,%ebp
+  801c36:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801c39:	ff 75 10             	push   0x10(%ebp)
+  801c3c:	ff 75 0c             	push   0xc(%ebp)
+  801c3f:	ff 75 08             	push   0x8(%ebp)
+  801c42:	e8 41 02 00 00       	call   801e88 <nsipc_socket>
+  801c47:	83 c4 10             	add    $0x10,%esp
+  801c4a:	85 c0                	test   %eax,%eax
+  801c4c:	78 05                	js     801c53 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801c4e:	e8 ab fe ff ff       	call   801afe <alloc_sockfd>
+}
+  801c53:	c9                   	leave
+  801c54:	c3                   	ret
+
+00801c55 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801c55:	55                   	push   %ebp
+  801c56:	89 e5                	mov    %esp,%ebp
+  801c58:	53                   	push   %ebx
+  801c59:	83 ec 04             	sub    $0x4,%esp
+  801c5c:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801c5e:	83 3d 14 40 80 00 00 	cmpl   $0x0,0x804014
+  801c65:	74 26                	je     801c8d <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801c67:	6a 07                	push   $0x7
+  801c69:	68 00 60 80 00       	push   $0x806000
+  801c6e:	53                   	push   %ebx
+  801c6f:	ff 35 14 40 80 00    	push   0x804014
+  801c75:	e8 b0 07 00 00       	call   80242a <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801c7a:	83 c4 0c             	add    $0xc,%esp
+  801c7d:	6a 00                	push   $0x0
+  801c7f:	6a 00                	push   $0x0
+  801c81:	6a 00                	push   $0x0
+  801c83:	e8 2e 07 00 00       	call   8023b6 <ipc_recv>
+}
+  801c88:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c8b:	c9                   	leave
+  801c8c:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801c8d:	83 ec 0c             	sub    $0xc,%esp
+  801c90:	6a 02                	push   $0x2
+  801c92:	e8 e7 07 00 00       	call   80247e <ipc_find_env>
+  801c97:	a3 14 40 80 00       	mov    %eax,0x804014
+  801c9c:	83 c4 10             	add    $0x10,%esp
+  801c9f:	eb c6                	jmp    801c67 <nsipc+0x12>
+
+00801ca1 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801ca1:	55                   	push   %ebp
+  801ca2:	89 e5                	mov    %esp,%ebp
+  801ca4:	56                   	push   %esi
+  801ca5:	53                   	push   %ebx
+  801ca6:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801ca9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cac:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801cb1:	8b 06                	mov    (%esi),%eax
+  801cb3:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801cb8:	b8 01 00 00 00       	mov    $0x1,%eax
+  801cbd:	e8 93 ff ff ff       	call   801c55 <nsipc>
+  801cc2:	89 c3                	mov    %eax,%ebx
+  801cc4:	85 c0                	test   %eax,%eax
+  801cc6:	79 09                	jns    801cd1 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801cc8:	89 d8                	mov    %ebx,%eax
+  801cca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ccd:	5b                   	pop    %ebx
+  801cce:	5e                   	pop    %esi
+  801ccf:	5d                   	pop    %ebp
+  801cd0:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801cd1:	83 ec 04             	sub    $0x4,%esp
+  801cd4:	ff 35 10 60 80 00    	push   0x806010
+  801cda:	68 00 60 80 00       	push   $0x806000
+  801cdf:	ff 75 0c             	push   0xc(%ebp)
+  801ce2:	e8 3f f0 ff ff       	call   800d26 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801ce7:	a1 10 60 80 00       	mov    0x806010,%eax
+  801cec:	89 06                	mov    %eax,(%esi)
+  801cee:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801cf1:	eb d5                	jmp    801cc8 <nsipc_accept+0x27>
+
+00801cf3 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801cf3:	55                   	push   %ebp
+  801cf4:	89 e5                	mov    %esp,%ebp
+  801cf6:	53                   	push   %ebx
+  801cf7:	83 ec 08             	sub    $0x8,%esp
+  801cfa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801cfd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d00:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801d05:	53                   	push   %ebx
+  801d06:	ff 75 0c             	push   0xc(%ebp)
+  801d09:	68 04 60 80 00       	push   $0x806004
+  801d0e:	e8 13 f0 ff ff       	call   800d26 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801d13:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  801d19:	b8 02 00 00 00       	mov    $0x2,%eax
+  801d1e:	e8 32 ff ff ff       	call   801c55 <nsipc>
+}
+  801d23:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d26:	c9                   	leave
+  801d27:	c3                   	ret
+
+00801d28 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801d28:	55                   	push   %ebp
+  801d29:	89 e5                	mov    %esp,%ebp
+  801d2b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801d2e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d31:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  801d36:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d39:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  801d3e:	b8 03 00 00 00       	mov    $0x3,%eax
+  801d43:	e8 0d ff ff ff       	call   801c55 <nsipc>
+}
+  801d48:	c9                   	leave
+  801d49:	c3                   	ret
+
+00801d4a <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801d4a:	55                   	push   %ebp
+  801d4b:	89 e5                	mov    %esp,%ebp
+  801d4d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801d50:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d53:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  801d58:	b8 04 00 00 00       	mov    $0x4,%eax
+  801d5d:	e8 f3 fe ff ff       	call   801c55 <nsipc>
+}
+  801d62:	c9                   	leave
+  801d63:	c3                   	ret
+
+00801d64 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801d64:	55                   	push   %ebp
+  801d65:	89 e5                	mov    %esp,%ebp
+  801d67:	53                   	push   %ebx
+  801d68:	83 ec 08             	sub    $0x8,%esp
+  801d6b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801d6e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d71:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801d76:	53                   	push   %ebx
+  801d77:	ff 75 0c             	push   0xc(%ebp)
+  801d7a:	68 04 60 80 00       	push   $0x806004
+  801d7f:	e8 a2 ef ff ff       	call   800d26 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801d84:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  801d8a:	b8 05 00 00 00       	mov    $0x5,%eax
+  801d8f:	e8 c1 fe ff ff       	call   801c55 <nsipc>
+}
+  801d94:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d97:	c9                   	leave
+  801d98:	c3                   	ret
+
+00801d99 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801d99:	55                   	push   %ebp
+  801d9a:	89 e5                	mov    %esp,%ebp
+  801d9c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801d9f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801da2:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  801da7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801daa:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  801daf:	b8 06 00 00 00       	mov    $0x6,%eax
+  801db4:	e8 9c fe ff ff       	call   801c55 <nsipc>
+}
+  801db9:	c9                   	leave
+  801dba:	c3                   	ret
+
+00801dbb <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801dbb:	55                   	push   %ebp
+  801dbc:	89 e5                	mov    %esp,%ebp
+  801dbe:	56                   	push   %esi
+  801dbf:	53                   	push   %ebx
+  801dc0:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801dc3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dc6:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  801dcb:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  801dd1:	8b 45 14             	mov    0x14(%ebp),%eax
+  801dd4:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801dd9:	b8 07 00 00 00       	mov    $0x7,%eax
+  801dde:	e8 72 fe ff ff       	call   801c55 <nsipc>
+  801de3:	89 c3                	mov    %eax,%ebx
+  801de5:	85 c0                	test   %eax,%eax
+  801de7:	78 22                	js     801e0b <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801de9:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801dee:	39 c6                	cmp    %eax,%esi
+  801df0:	0f 4e c6             	cmovle %esi,%eax
+  801df3:	39 c3                	cmp    %eax,%ebx
+  801df5:	7f 1d                	jg     801e14 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801df7:	83 ec 04             	sub    $0x4,%esp
+  801dfa:	53                   	push   %ebx
+  801dfb:	68 00 60 80 00       	push   $0x806000
+  801e00:	ff 75 0c             	push   0xc(%ebp)
+  801e03:	e8 1e ef ff ff       	call   800d26 <memmove>
+  801e08:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801e0b:	89 d8                	mov    %ebx,%eax
+  801e0d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e10:	5b                   	pop    %ebx
+  801e11:	5e                   	pop    %esi
+  801e12:	5d                   	pop    %ebp
+  801e13:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801e14:	68 df 2e 80 00       	push   $0x802edf
+  801e19:	68 a7 2e 80 00       	push   $0x802ea7
+  801e1e:	6a 62                	push   $0x62
+  801e20:	68 f4 2e 80 00       	push   $0x802ef4
+  801e25:	e8 46 05 00 00       	call   802370 <_panic>
+
+00801e2a <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801e2a:	55                   	push   %ebp
+  801e2b:	89 e5                	mov    %esp,%ebp
+  801e2d:	53                   	push   %ebx
+  801e2e:	83 ec 04             	sub    $0x4,%esp
+  801e31:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801e34:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e37:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  801e3c:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801e42:	7f 2e                	jg     801e72 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801e44:	83 ec 04             	sub    $0x4,%esp
+  801e47:	53                   	push   %ebx
+  801e48:	ff 75 0c             	push   0xc(%ebp)
+  801e4b:	68 0c 60 80 00       	push   $0x80600c
+  801e50:	e8 d1 ee ff ff       	call   800d26 <memmove>
+	nsipcbuf.send.req_size = size;
+  801e55:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  801e5b:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e5e:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  801e63:	b8 08 00 00 00       	mov    $0x8,%eax
+  801e68:	e8 e8 fd ff ff       	call   801c55 <nsipc>
+}
+  801e6d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e70:	c9                   	leave
+  801e71:	c3                   	ret
+	assert(size < 1600);
+  801e72:	68 00 2f 80 00       	push   $0x802f00
+  801e77:	68 a7 2e 80 00       	push   $0x802ea7
+  801e7c:	6a 6d                	push   $0x6d
+  801e7e:	68 f4 2e 80 00       	push   $0x802ef4
+  801e83:	e8 e8 04 00 00       	call   802370 <_panic>
+
+00801e88 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801e88:	55                   	push   %ebp
+  801e89:	89 e5                	mov    %esp,%ebp
+  801e8b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801e8e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e91:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  801e96:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e99:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  801e9e:	8b 45 10             	mov    0x10(%ebp),%eax
+  801ea1:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  801ea6:	b8 09 00 00 00       	mov    $0x9,%eax
+  801eab:	e8 a5 fd ff ff       	call   801c55 <nsipc>
+}
+  801eb0:	c9                   	leave
+  801eb1:	c3                   	ret
+
+00801eb2 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801eb2:	55                   	push   %ebp
+  801eb3:	89 e5                	mov    %esp,%ebp
+  801eb5:	56                   	push   %esi
+  801eb6:	53                   	push   %ebx
+  801eb7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801eba:	83 ec 0c             	sub    $0xc,%esp
+  801ebd:	ff 75 08             	push   0x8(%ebp)
+  801ec0:	e8 aa f3 ff ff       	call   80126f <fd2data>
+  801ec5:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801ec7:	83 c4 08             	add    $0x8,%esp
+  801eca:	68 0c 2f 80 00       	push   $0x802f0c
+  801ecf:	53                   	push   %ebx
+  801ed0:	e8 cb ec ff ff       	call   800ba0 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801ed5:	8b 46 04             	mov    0x4(%esi),%eax
+  801ed8:	2b 06                	sub    (%esi),%eax
+  801eda:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  801ee0:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801ee7:	00 00 00 
+	stat->st_dev = &devpipe;
+  801eea:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  801ef1:	30 80 00 
+	return 0;
+}
+  801ef4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ef9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801efc:	5b                   	pop    %ebx
+  801efd:	5e                   	pop    %esi
+  801efe:	5d                   	pop    %ebp
+  801eff:	c3                   	ret
+
+00801f00 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801f00:	55                   	push   %ebp
+  801f01:	89 e5                	mov    %esp,%ebp
+  801f03:	53                   	push   %ebx
+  801f04:	83 ec 0c             	sub    $0xc,%esp
+  801f07:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801f0a:	53                   	push   %ebx
+  801f0b:	6a 00                	push   $0x0
+  801f0d:	e8 ff f0 ff ff       	call   801011 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801f12:	89 1c 24             	mov    %ebx,(%esp)
+  801f15:	e8 55 f3 ff ff       	call   80126f <fd2data>
+  801f1a:	83 c4 08             	add    $0x8,%esp
+  801f1d:	50                   	push   %eax
+  801f1e:	6a 00                	push   $0x0
+  801f20:	e8 ec f0 ff ff       	call   801011 <sys_page_unmap>
+}
+  801f25:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f28:	c9                   	leave
+  801f29:	c3                   	ret
+
+00801f2a <_pipeisclosed>:
+{
+  801f2a:	55                   	push   %ebp
+  801f2b:	89 e5                	mov    %esp,%ebp
+  801f2d:	57                   	push   %edi
+  801f2e:	56                   	push   %esi
+  801f2f:	53                   	push   %ebx
+  801f30:	83 ec 1c             	sub    $0x1c,%esp
+  801f33:	89 c7                	mov    %eax,%edi
+  801f35:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801f37:	a1 18 40 80 00       	mov    0x804018,%eax
+  801f3c:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801f3f:	83 ec 0c             	sub    $0xc,%esp
+  801f42:	57                   	push   %edi
+  801f43:	e8 75 05 00 00       	call   8024bd <pageref>
+  801f48:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801f4b:	89 34 24             	mov    %esi,(%esp)
+  801f4e:	e8 6a 05 00 00       	call   8024bd <pageref>
+		nn = thisenv->env_runs;
+  801f53:	8b 15 18 40 80 00    	mov    0x804018,%edx
+  801f59:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801f5c:	83 c4 10             	add    $0x10,%esp
+  801f5f:	39 cb                	cmp    %ecx,%ebx
+  801f61:	74 1b                	je     801f7e <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801f63:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801f66:	75 cf                	jne    801f37 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801f68:	8b 42 58             	mov    0x58(%edx),%eax
+  801f6b:	6a 01                	push   $0x1
+  801f6d:	50                   	push   %eax
+  801f6e:	53                   	push   %ebx
+  801f6f:	68 13 2f 80 00       	push   $0x802f13
+  801f74:	e8 6e e6 ff ff       	call   8005e7 <cprintf>
+  801f79:	83 c4 10             	add    $0x10,%esp
+  801f7c:	eb b9                	jmp    801f37 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801f7e:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801f81:	0f 94 c0             	sete   %al
+  801f84:	0f b6 c0             	movzbl %al,%eax
+}
+  801f87:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f8a:	5b                   	pop    %ebx
+  801f8b:	5e                   	pop    %esi
+  801f8c:	5f                   	pop    %edi
+  801f8d:	5d                   	pop    %ebp
+  801f8e:	c3                   	ret
+
+00801f8f <devpipe_write>:
+{
+  801f8f:	55                   	push   %ebp
+  801f90:	89 e5                	mov    %esp,%ebp
+  801f92:	57                   	push   %edi
+  801f93:	56                   	push   %esi
+  801f94:	53                   	push   %ebx
+  801f95:	83 ec 28             	sub    $0x28,%esp
+  801f98:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801f9b:	56                   	push   %esi
+  801f9c:	e8 ce f2 ff ff       	call   80126f <fd2data>
+  801fa1:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801fa3:	83 c4 10             	add    $0x10,%esp
+  801fa6:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fab:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801fae:	75 09                	jne    801fb9 <devpipe_write+0x2a>
+	return i;
+  801fb0:	89 f8                	mov    %edi,%eax
+  801fb2:	eb 23                	jmp    801fd7 <devpipe_write+0x48>
+			sys_yield();
+  801fb4:	e8 b4 ef ff ff       	call   800f6d <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801fb9:	8b 43 04             	mov    0x4(%ebx),%eax
+  801fbc:	8b 0b                	mov    (%ebx),%ecx
+  801fbe:	8d 51 20             	lea    0x20(%ecx),%edx
+  801fc1:	39 d0                	cmp    %edx,%eax
+  801fc3:	72 1a                	jb     801fdf <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  801fc5:	89 da                	mov    %ebx,%edx
+  801fc7:	89 f0                	mov    %esi,%eax
+  801fc9:	e8 5c ff ff ff       	call   801f2a <_pipeisclosed>
+  801fce:	85 c0                	test   %eax,%eax
+  801fd0:	74 e2                	je     801fb4 <devpipe_write+0x25>
+				return 0;
+  801fd2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801fd7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fda:	5b                   	pop    %ebx
+  801fdb:	5e                   	pop    %esi
+  801fdc:	5f                   	pop    %edi
+  801fdd:	5d                   	pop    %ebp
+  801fde:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801fdf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801fe2:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801fe6:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801fe9:	89 c2                	mov    %eax,%edx
+  801feb:	c1 fa 1f             	sar    $0x1f,%edx
+  801fee:	89 d1                	mov    %edx,%ecx
+  801ff0:	c1 e9 1b             	shr    $0x1b,%ecx
+  801ff3:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801ff6:	83 e2 1f             	and    $0x1f,%edx
+  801ff9:	29 ca                	sub    %ecx,%edx
+  801ffb:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801fff:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802003:	83 c0 01             	add    $0x1,%eax
+  802006:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802009:	83 c7 01             	add    $0x1,%edi
+  80200c:	eb 9d                	jmp    801fab <devpipe_write+0x1c>
+
+0080200e <devpipe_read>:
+{
+  80200e:	55                   	push   %ebp
+  80200f:	89 e5                	mov    %esp,%ebp
+  802011:	57                   	push   %edi
+  802012:	56                   	push   %esi
+  802013:	53                   	push   %ebx
+  802014:	83 ec 18             	sub    $0x18,%esp
+  802017:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  80201a:	57                   	push   %edi
+  80201b:	e8 4f f2 ff ff       	call   80126f <fd2data>
+  802020:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802022:	83 c4 10             	add    $0x10,%esp
+  802025:	be 00 00 00 00       	mov    $0x0,%esi
+  80202a:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80202d:	75 13                	jne    802042 <devpipe_read+0x34>
+	return i;
+  80202f:	89 f0                	mov    %esi,%eax
+  802031:	eb 02                	jmp    802035 <devpipe_read+0x27>
+				return i;
+  802033:	89 f0                	mov    %esi,%eax
+}
+  802035:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802038:	5b                   	pop    %ebx
+  802039:	5e                   	pop    %esi
+  80203a:	5f                   	pop    %edi
+  80203b:	5d                   	pop    %ebp
+  80203c:	c3                   	ret
+			sys_yield();
+  80203d:	e8 2b ef ff ff       	call   800f6d <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802042:	8b 03                	mov    (%ebx),%eax
+  802044:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802047:	75 18                	jne    802061 <devpipe_read+0x53>
+			if (i > 0)
+  802049:	85 f6                	test   %esi,%esi
+  80204b:	75 e6                	jne    802033 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  80204d:	89 da                	mov    %ebx,%edx
+  80204f:	89 f8                	mov    %edi,%eax
+  802051:	e8 d4 fe ff ff       	call   801f2a <_pipeisclosed>
+  802056:	85 c0                	test   %eax,%eax
+  802058:	74 e3                	je     80203d <devpipe_read+0x2f>
+				return 0;
+  80205a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80205f:	eb d4                	jmp    802035 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802061:	99                   	cltd
+  802062:	c1 ea 1b             	shr    $0x1b,%edx
+  802065:	01 d0                	add    %edx,%eax
+  802067:	83 e0 1f             	and    $0x1f,%eax
+  80206a:	29 d0                	sub    %edx,%eax
+  80206c:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802071:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802074:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802077:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80207a:	83 c6 01             	add    $0x1,%esi
+  80207d:	eb ab                	jmp    80202a <devpipe_read+0x1c>
+
+0080207f <pipe>:
+{
+  80207f:	55                   	push   %ebp
+  802080:	89 e5                	mov    %esp,%ebp
+  802082:	56                   	push   %esi
+  802083:	53                   	push   %ebx
+  802084:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802087:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80208a:	50                   	push   %eax
+  80208b:	e8 f6 f1 ff ff       	call   801286 <fd_alloc>
+  802090:	89 c3                	mov    %eax,%ebx
+  802092:	83 c4 10             	add    $0x10,%esp
+  802095:	85 c0                	test   %eax,%eax
+  802097:	0f 88 23 01 00 00    	js     8021c0 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80209d:	83 ec 04             	sub    $0x4,%esp
+  8020a0:	68 07 04 00 00       	push   $0x407
+  8020a5:	ff 75 f4             	push   -0xc(%ebp)
+  8020a8:	6a 00                	push   $0x0
+  8020aa:	e8 dd ee ff ff       	call   800f8c <sys_page_alloc>
+  8020af:	89 c3                	mov    %eax,%ebx
+  8020b1:	83 c4 10             	add    $0x10,%esp
+  8020b4:	85 c0                	test   %eax,%eax
+  8020b6:	0f 88 04 01 00 00    	js     8021c0 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8020bc:	83 ec 0c             	sub    $0xc,%esp
+  8020bf:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8020c2:	50                   	push   %eax
+  8020c3:	e8 be f1 ff ff       	call   801286 <fd_alloc>
+  8020c8:	89 c3                	mov    %eax,%ebx
+  8020ca:	83 c4 10             	add    $0x10,%esp
+  8020cd:	85 c0                	test   %eax,%eax
+  8020cf:	0f 88 db 00 00 00    	js     8021b0 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8020d5:	83 ec 04             	sub    $0x4,%esp
+  8020d8:	68 07 04 00 00       	push   $0x407
+  8020dd:	ff 75 f0             	push   -0x10(%ebp)
+  8020e0:	6a 00                	push   $0x0
+  8020e2:	e8 a5 ee ff ff       	call   800f8c <sys_page_alloc>
+  8020e7:	89 c3                	mov    %eax,%ebx
+  8020e9:	83 c4 10             	add    $0x10,%esp
+  8020ec:	85 c0                	test   %eax,%eax
+  8020ee:	0f 88 bc 00 00 00    	js     8021b0 <pipe+0x131>
+	va = fd2data(fd0);
+  8020f4:	83 ec 0c             	sub    $0xc,%esp
+  8020f7:	ff 75 f4             	push   -0xc(%ebp)
+  8020fa:	e8 70 f1 ff ff       	call   80126f <fd2data>
+  8020ff:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802101:	83 c4 0c             	add    $0xc,%esp
+  802104:	68 07 04 00 00       	push   $0x407
+  802109:	50                   	push   %eax
+  80210a:	6a 00                	push   $0x0
+  80210c:	e8 7b ee ff ff       	call   800f8c <sys_page_alloc>
+  802111:	89 c3                	mov    %eax,%ebx
+  802113:	83 c4 10             	add    $0x10,%esp
+  802116:	85 c0                	test   %eax,%eax
+  802118:	0f 88 82 00 00 00    	js     8021a0 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80211e:	83 ec 0c             	sub    $0xc,%esp
+  802121:	ff 75 f0             	push   -0x10(%ebp)
+  802124:	e8 46 f1 ff ff       	call   80126f <fd2data>
+  802129:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802130:	50                   	push   %eax
+  802131:	6a 00                	push   $0x0
+  802133:	56                   	push   %esi
+  802134:	6a 00                	push   $0x0
+  802136:	e8 94 ee ff ff       	call   800fcf <sys_page_map>
+  80213b:	89 c3                	mov    %eax,%ebx
+  80213d:	83 c4 20             	add    $0x20,%esp
+  802140:	85 c0                	test   %eax,%eax
+  802142:	78 4e                	js     802192 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802144:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  802149:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80214c:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80214e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802151:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802158:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80215b:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80215d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802160:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802167:	83 ec 0c             	sub    $0xc,%esp
+  80216a:	ff 75 f4             	push   -0xc(%ebp)
+  80216d:	e8 ed f0 ff ff       	call   80125f <fd2num>
+  802172:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802175:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802177:	83 c4 04             	add    $0x4,%esp
+  80217a:	ff 75 f0             	push   -0x10(%ebp)
+  80217d:	e8 dd f0 ff ff       	call   80125f <fd2num>
+  802182:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802185:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802188:	83 c4 10             	add    $0x10,%esp
+  80218b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802190:	eb 2e                	jmp    8021c0 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802192:	83 ec 08             	sub    $0x8,%esp
+  802195:	56                   	push   %esi
+  802196:	6a 00                	push   $0x0
+  802198:	e8 74 ee ff ff       	call   801011 <sys_page_unmap>
+  80219d:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8021a0:	83 ec 08             	sub    $0x8,%esp
+  8021a3:	ff 75 f0             	push   -0x10(%ebp)
+  8021a6:	6a 00                	push   $0x0
+  8021a8:	e8 64 ee ff ff       	call   801011 <sys_page_unmap>
+  8021ad:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8021b0:	83 ec 08             	sub    $0x8,%esp
+  8021b3:	ff 75 f4             	push   -0xc(%ebp)
+  8021b6:	6a 00                	push   $0x0
+  8021b8:	e8 54 ee ff ff       	call   801011 <sys_page_unmap>
+  8021bd:	83 c4 10             	add    $0x10,%esp
+}
+  8021c0:	89 d8                	mov    %ebx,%eax
+  8021c2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021c5:	5b                   	pop    %ebx
+  8021c6:	5e                   	pop    %esi
+  8021c7:	5d                   	pop    %ebp
+  8021c8:	c3                   	ret
+
+008021c9 <pipeisclosed>:
+{
+  8021c9:	55                   	push   %ebp
+  8021ca:	89 e5                	mov    %esp,%ebp
+  8021cc:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8021cf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021d2:	50                   	push   %eax
+  8021d3:	ff 75 08             	push   0x8(%ebp)
+  8021d6:	e8 01 f1 ff ff       	call   8012dc <fd_lookup>
+  8021db:	83 c4 10             	add    $0x10,%esp
+  8021de:	85 c0                	test   %eax,%eax
+  8021e0:	78 18                	js     8021fa <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8021e2:	83 ec 0c             	sub    $0xc,%esp
+  8021e5:	ff 75 f4             	push   -0xc(%ebp)
+  8021e8:	e8 82 f0 ff ff       	call   80126f <fd2data>
+  8021ed:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8021ef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021f2:	e8 33 fd ff ff       	call   801f2a <_pipeisclosed>
+  8021f7:	83 c4 10             	add    $0x10,%esp
+}
+  8021fa:	c9                   	leave
+  8021fb:	c3                   	ret
+
+008021fc <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8021fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802201:	c3                   	ret
+
+00802202 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802202:	55                   	push   %ebp
+  802203:	89 e5                	mov    %esp,%ebp
+  802205:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802208:	68 2b 2f 80 00       	push   $0x802f2b
+  80220d:	ff 75 0c             	push   0xc(%ebp)
+  802210:	e8 8b e9 ff ff       	call   800ba0 <strcpy>
+	return 0;
+}
+  802215:	b8 00 00 00 00       	mov    $0x0,%eax
+  80221a:	c9                   	leave
+  80221b:	c3                   	ret
+
+0080221c <devcons_write>:
+{
+  80221c:	55                   	push   %ebp
+  80221d:	89 e5                	mov    %esp,%ebp
+  80221f:	57                   	push   %edi
+  802220:	56                   	push   %esi
+  802221:	53                   	push   %ebx
+  802222:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802228:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80222d:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802233:	eb 2e                	jmp    802263 <devcons_write+0x47>
+		m = n - tot;
+  802235:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802238:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80223a:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80223f:	39 c3                	cmp    %eax,%ebx
+  802241:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802244:	83 ec 04             	sub    $0x4,%esp
+  802247:	53                   	push   %ebx
+  802248:	89 f0                	mov    %esi,%eax
+  80224a:	03 45 0c             	add    0xc(%ebp),%eax
+  80224d:	50                   	push   %eax
+  80224e:	57                   	push   %edi
+  80224f:	e8 d2 ea ff ff       	call   800d26 <memmove>
+		sys_cputs(buf, m);
+  802254:	83 c4 08             	add    $0x8,%esp
+  802257:	53                   	push   %ebx
+  802258:	57                   	push   %edi
+  802259:	e8 72 ec ff ff       	call   800ed0 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80225e:	01 de                	add    %ebx,%esi
+  802260:	83 c4 10             	add    $0x10,%esp
+  802263:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802266:	72 cd                	jb     802235 <devcons_write+0x19>
+}
+  802268:	89 f0                	mov    %esi,%eax
+  80226a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80226d:	5b                   	pop    %ebx
+  80226e:	5e                   	pop    %esi
+  80226f:	5f                   	pop    %edi
+  802270:	5d                   	pop    %ebp
+  802271:	c3                   	ret
+
+00802272 <devcons_read>:
+{
+  802272:	55                   	push   %ebp
+  802273:	89 e5                	mov    %esp,%ebp
+  802275:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802278:	b8 00 00 00 00       	mov    $0x0,%eax
+  80227d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802281:	75 07                	jne    80228a <devcons_read+0x18>
+  802283:	eb 1f                	jmp    8022a4 <devcons_read+0x32>
+		sys_yield();
+  802285:	e8 e3 ec ff ff       	call   800f6d <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80228a:	e8 5f ec ff ff       	call   800eee <sys_cgetc>
+  80228f:	85 c0                	test   %eax,%eax
+  802291:	74 f2                	je     802285 <devcons_read+0x13>
+	if (c < 0)
+  802293:	78 0f                	js     8022a4 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802295:	83 f8 04             	cmp    $0x4,%eax
+  802298:	74 0c                	je     8022a6 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80229a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80229d:	88 02                	mov    %al,(%edx)
+	return 1;
+  80229f:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8022a4:	c9                   	leave
+  8022a5:	c3                   	ret
+		return 0;
+  8022a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022ab:	eb f7                	jmp    8022a4 <devcons_read+0x32>
+
+008022ad <cputchar>:
+{
+  8022ad:	55                   	push   %ebp
+  8022ae:	89 e5                	mov    %esp,%ebp
+  8022b0:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8022b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022b6:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8022b9:	6a 01                	push   $0x1
+  8022bb:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8022be:	50                   	push   %eax
+  8022bf:	e8 0c ec ff ff       	call   800ed0 <sys_cputs>
+}
+  8022c4:	83 c4 10             	add    $0x10,%esp
+  8022c7:	c9                   	leave
+  8022c8:	c3                   	ret
+
+008022c9 <getchar>:
+{
+  8022c9:	55                   	push   %ebp
+  8022ca:	89 e5                	mov    %esp,%ebp
+  8022cc:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8022cf:	6a 01                	push   $0x1
+  8022d1:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8022d4:	50                   	push   %eax
+  8022d5:	6a 00                	push   $0x0
+  8022d7:	e8 66 f2 ff ff       	call   801542 <read>
+	if (r < 0)
+  8022dc:	83 c4 10             	add    $0x10,%esp
+  8022df:	85 c0                	test   %eax,%eax
+  8022e1:	78 06                	js     8022e9 <getchar+0x20>
+	if (r < 1)
+  8022e3:	74 06                	je     8022eb <getchar+0x22>
+	return c;
+  8022e5:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8022e9:	c9                   	leave
+  8022ea:	c3                   	ret
+		return -E_EOF;
+  8022eb:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8022f0:	eb f7                	jmp    8022e9 <getchar+0x20>
+
+008022f2 <iscons>:
+{
+  8022f2:	55                   	push   %ebp
+  8022f3:	89 e5                	mov    %esp,%ebp
+  8022f5:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8022f8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022fb:	50                   	push   %eax
+  8022fc:	ff 75 08             	push   0x8(%ebp)
+  8022ff:	e8 d8 ef ff ff       	call   8012dc <fd_lookup>
+  802304:	83 c4 10             	add    $0x10,%esp
+  802307:	85 c0                	test   %eax,%eax
+  802309:	78 11                	js     80231c <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80230b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80230e:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  802314:	39 10                	cmp    %edx,(%eax)
+  802316:	0f 94 c0             	sete   %al
+  802319:	0f b6 c0             	movzbl %al,%eax
+}
+  80231c:	c9                   	leave
+  80231d:	c3                   	ret
+
+0080231e <opencons>:
+{
+  80231e:	55                   	push   %ebp
+  80231f:	89 e5                	mov    %esp,%ebp
+  802321:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802324:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802327:	50                   	push   %eax
+  802328:	e8 59 ef ff ff       	call   801286 <fd_alloc>
+  80232d:	83 c4 10             	add    $0x10,%esp
+  802330:	85 c0                	test   %eax,%eax
+  802332:	78 3a                	js     80236e <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802334:	83 ec 04             	sub    $0x4,%esp
+  802337:	68 07 04 00 00       	push   $0x407
+  80233c:	ff 75 f4             	push   -0xc(%ebp)
+  80233f:	6a 00                	push   $0x0
+  802341:	e8 46 ec ff ff       	call   800f8c <sys_page_alloc>
+  802346:	83 c4 10             	add    $0x10,%esp
+  802349:	85 c0                	test   %eax,%eax
+  80234b:	78 21                	js     80236e <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80234d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802350:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  802356:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802358:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80235b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802362:	83 ec 0c             	sub    $0xc,%esp
+  802365:	50                   	push   %eax
+  802366:	e8 f4 ee ff ff       	call   80125f <fd2num>
+  80236b:	83 c4 10             	add    $0x10,%esp
+}
+  80236e:	c9                   	leave
+  80236f:	c3                   	ret
+
+00802370 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  802370:	55                   	push   %ebp
+  802371:	89 e5                	mov    %esp,%ebp
+  802373:	56                   	push   %esi
+  802374:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  802375:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  802378:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  80237e:	e8 cb eb ff ff       	call   800f4e <sys_getenvid>
+  802383:	83 ec 0c             	sub    $0xc,%esp
+  802386:	ff 75 0c             	push   0xc(%ebp)
+  802389:	ff 75 08             	push   0x8(%ebp)
+  80238c:	56                   	push   %esi
+  80238d:	50                   	push   %eax
+  80238e:	68 38 2f 80 00       	push   $0x802f38
+  802393:	e8 4f e2 ff ff       	call   8005e7 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  802398:	83 c4 18             	add    $0x18,%esp
+  80239b:	53                   	push   %ebx
+  80239c:	ff 75 10             	push   0x10(%ebp)
+  80239f:	e8 f2 e1 ff ff       	call   800596 <vcprintf>
+	cprintf("\n");
+  8023a4:	c7 04 24 24 2f 80 00 	movl   $0x802f24,(%esp)
+  8023ab:	e8 37 e2 ff ff       	call   8005e7 <cprintf>
+  8023b0:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8023b3:	cc                   	int3
+	while (1)
+  8023b4:	eb fd                	jmp    8023b3 <_panic+0x43>
+
+008023b6 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  8023b6:	55                   	push   %ebp
+  8023b7:	89 e5                	mov    %esp,%ebp
+  8023b9:	56                   	push   %esi
+  8023ba:	53                   	push   %ebx
+  8023bb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8023be:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023c1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  8023c4:	85 c0                	test   %eax,%eax
+  8023c6:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8023cb:	0f 44 c2             	cmove  %edx,%eax
+  8023ce:	83 ec 0c             	sub    $0xc,%esp
+  8023d1:	50                   	push   %eax
+  8023d2:	e8 65 ed ff ff       	call   80113c <sys_ipc_recv>
+
+  if (from_env_store)
+  8023d7:	83 c4 10             	add    $0x10,%esp
+  8023da:	85 f6                	test   %esi,%esi
+  8023dc:	74 17                	je     8023f5 <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  8023de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023e3:	85 c0                	test   %eax,%eax
+  8023e5:	75 0c                	jne    8023f3 <ipc_recv+0x3d>
+  8023e7:	8b 15 18 40 80 00    	mov    0x804018,%edx
+  8023ed:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  8023f3:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  8023f5:	85 db                	test   %ebx,%ebx
+  8023f7:	74 2b                	je     802424 <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  8023f9:	85 c0                	test   %eax,%eax
+  8023fb:	74 0d                	je     80240a <ipc_recv+0x54>
+  8023fd:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  802403:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802406:	5b                   	pop    %ebx
+  802407:	5e                   	pop    %esi
+  802408:	5d                   	pop    %ebp
+  802409:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  80240a:	a1 18 40 80 00       	mov    0x804018,%eax
+  80240f:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  802415:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  802417:	a1 18 40 80 00       	mov    0x804018,%eax
+  80241c:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  802422:	eb df                	jmp    802403 <ipc_recv+0x4d>
+  802424:	85 c0                	test   %eax,%eax
+  802426:	75 db                	jne    802403 <ipc_recv+0x4d>
+  802428:	eb ed                	jmp    802417 <ipc_recv+0x61>
+
+0080242a <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  80242a:	55                   	push   %ebp
+  80242b:	89 e5                	mov    %esp,%ebp
+  80242d:	57                   	push   %edi
+  80242e:	56                   	push   %esi
+  80242f:	53                   	push   %ebx
+  802430:	83 ec 0c             	sub    $0xc,%esp
+  802433:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802436:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802439:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  80243c:	85 db                	test   %ebx,%ebx
+  80243e:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802443:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  802446:	ff 75 14             	push   0x14(%ebp)
+  802449:	53                   	push   %ebx
+  80244a:	56                   	push   %esi
+  80244b:	57                   	push   %edi
+  80244c:	e8 c8 ec ff ff       	call   801119 <sys_ipc_try_send>
+  802451:	83 c4 10             	add    $0x10,%esp
+  802454:	85 c0                	test   %eax,%eax
+  802456:	74 1e                	je     802476 <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  802458:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80245b:	75 07                	jne    802464 <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  80245d:	e8 0b eb ff ff       	call   800f6d <sys_yield>
+  802462:	eb e2                	jmp    802446 <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  802464:	50                   	push   %eax
+  802465:	68 5b 2f 80 00       	push   $0x802f5b
+  80246a:	6a 3c                	push   $0x3c
+  80246c:	68 68 2f 80 00       	push   $0x802f68
+  802471:	e8 fa fe ff ff       	call   802370 <_panic>
+  }
+
+#endif
+}
+  802476:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802479:	5b                   	pop    %ebx
+  80247a:	5e                   	pop    %esi
+  80247b:	5f                   	pop    %edi
+  80247c:	5d                   	pop    %ebp
+  80247d:	c3                   	ret
+
+0080247e <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  80247e:	55                   	push   %ebp
+  80247f:	89 e5                	mov    %esp,%ebp
+  802481:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  802484:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  802489:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80248c:	c1 e0 04             	shl    $0x4,%eax
+  80248f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802494:	8b 40 50             	mov    0x50(%eax),%eax
+  802497:	39 c8                	cmp    %ecx,%eax
+  802499:	74 12                	je     8024ad <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  80249b:	83 c2 01             	add    $0x1,%edx
+  80249e:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8024a4:	75 e3                	jne    802489 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  8024a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024ab:	eb 0e                	jmp    8024bb <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  8024ad:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8024b0:	c1 e0 04             	shl    $0x4,%eax
+  8024b3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8024b8:	8b 40 48             	mov    0x48(%eax),%eax
+  8024bb:	5d                   	pop    %ebp
+  8024bc:	c3                   	ret
+
+008024bd <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8024bd:	55                   	push   %ebp
+  8024be:	89 e5                	mov    %esp,%ebp
+  8024c0:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8024c3:	89 c2                	mov    %eax,%edx
+  8024c5:	c1 ea 16             	shr    $0x16,%edx
+  8024c8:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8024cf:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8024d4:	f6 c1 01             	test   $0x1,%cl
+  8024d7:	74 1c                	je     8024f5 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  8024d9:	c1 e8 0c             	shr    $0xc,%eax
+  8024dc:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8024e3:	a8 01                	test   $0x1,%al
+  8024e5:	74 0e                	je     8024f5 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8024e7:	c1 e8 0c             	shr    $0xc,%eax
+  8024ea:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  8024f1:	ef 
+  8024f2:	0f b7 d2             	movzwl %dx,%edx
+}
+  8024f5:	89 d0                	mov    %edx,%eax
+  8024f7:	5d                   	pop    %ebp
+  8024f8:	c3                   	ret
+  8024f9:	66 90                	xchg   %ax,%ax
+  8024fb:	66 90                	xchg   %ax,%ax
+  8024fd:	66 90                	xchg   %ax,%ax
+  8024ff:	90                   	nop
+
+00802500 <__udivmoddi4>:
+  802500:	55                   	push   %ebp
+  802501:	57                   	push   %edi
+  802502:	56                   	push   %esi
+  802503:	53                   	push   %ebx
+  802504:	83 ec 24             	sub    $0x24,%esp
+  802507:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80250b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80250f:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  802513:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802517:	8b 54 24 44          	mov    0x44(%esp),%edx
+  80251b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80251f:	8b 44 24 40          	mov    0x40(%esp),%eax
+  802523:	89 d3                	mov    %edx,%ebx
+  802525:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802529:	09 c3                	or     %eax,%ebx
+  80252b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80252f:	0f 84 9c 00 00 00    	je     8025d1 <__udivmoddi4+0xd1>
+  802535:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80253c:	00 
+  80253d:	31 c0                	xor    %eax,%eax
+  80253f:	31 d2                	xor    %edx,%edx
+  802541:	89 fb                	mov    %edi,%ebx
+  802543:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80254a:	00 
+  80254b:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802550:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802554:	01 c0                	add    %eax,%eax
+  802556:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80255d:	00 
+  80255e:	89 c6                	mov    %eax,%esi
+  802560:	89 d7                	mov    %edx,%edi
+  802562:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802566:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80256a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80256d:	d3 ea                	shr    %cl,%edx
+  80256f:	f6 c1 20             	test   $0x20,%cl
+  802572:	0f 45 c2             	cmovne %edx,%eax
+  802575:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802579:	83 e0 01             	and    $0x1,%eax
+  80257c:	09 fa                	or     %edi,%edx
+  80257e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802582:	89 04 24             	mov    %eax,(%esp)
+  802585:	8b 04 24             	mov    (%esp),%eax
+  802588:	89 d5                	mov    %edx,%ebp
+  80258a:	09 f0                	or     %esi,%eax
+  80258c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802590:	39 f0                	cmp    %esi,%eax
+  802592:	19 fd                	sbb    %edi,%ebp
+  802594:	72 1d                	jb     8025b3 <__udivmoddi4+0xb3>
+  802596:	29 f0                	sub    %esi,%eax
+  802598:	19 fa                	sbb    %edi,%edx
+  80259a:	89 cf                	mov    %ecx,%edi
+  80259c:	c1 ef 05             	shr    $0x5,%edi
+  80259f:	83 e7 01             	and    $0x1,%edi
+  8025a2:	89 fe                	mov    %edi,%esi
+  8025a4:	d3 e7                	shl    %cl,%edi
+  8025a6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8025aa:	83 f6 01             	xor    $0x1,%esi
+  8025ad:	d3 e6                	shl    %cl,%esi
+  8025af:	09 74 24 18          	or     %esi,0x18(%esp)
+  8025b3:	83 e9 01             	sub    $0x1,%ecx
+  8025b6:	73 98                	jae    802550 <__udivmoddi4+0x50>
+  8025b8:	85 db                	test   %ebx,%ebx
+  8025ba:	74 05                	je     8025c1 <__udivmoddi4+0xc1>
+  8025bc:	89 03                	mov    %eax,(%ebx)
+  8025be:	89 53 04             	mov    %edx,0x4(%ebx)
+  8025c1:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8025c5:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8025c9:	83 c4 24             	add    $0x24,%esp
+  8025cc:	5b                   	pop    %ebx
+  8025cd:	5e                   	pop    %esi
+  8025ce:	5f                   	pop    %edi
+  8025cf:	5d                   	pop    %ebp
+  8025d0:	c3                   	ret
+  8025d1:	85 ff                	test   %edi,%edi
+  8025d3:	74 0d                	je     8025e2 <__udivmoddi4+0xe2>
+  8025d5:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  8025db:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  8025e2:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8025e6:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8025ea:	89 44 24 18          	mov    %eax,0x18(%esp)
+  8025ee:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8025f2:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  8025f6:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8025fa:	83 c4 24             	add    $0x24,%esp
+  8025fd:	5b                   	pop    %ebx
+  8025fe:	5e                   	pop    %esi
+  8025ff:	5f                   	pop    %edi
+  802600:	5d                   	pop    %ebp
+  802601:	c3                   	ret
+  802602:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802609:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00802610 <__udivdi3>:
+  802610:	57                   	push   %edi
+  802611:	56                   	push   %esi
+  802612:	53                   	push   %ebx
+  802613:	83 ec 20             	sub    $0x20,%esp
+  802616:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80261a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80261e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802622:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802626:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80262a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80262e:	89 d1                	mov    %edx,%ecx
+  802630:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802634:	09 c1                	or     %eax,%ecx
+  802636:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80263a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80263e:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802642:	0f 84 88 00 00 00    	je     8026d0 <__udivdi3+0xc0>
+  802648:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80264f:	00 
+  802650:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802655:	31 c0                	xor    %eax,%eax
+  802657:	31 d2                	xor    %edx,%edx
+  802659:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802660:	00 
+  802661:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802668:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80266c:	01 c0                	add    %eax,%eax
+  80266e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802675:	00 
+  802676:	89 c6                	mov    %eax,%esi
+  802678:	89 d7                	mov    %edx,%edi
+  80267a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80267e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802682:	0f ad d0             	shrd   %cl,%edx,%eax
+  802685:	d3 ea                	shr    %cl,%edx
+  802687:	f6 c1 20             	test   $0x20,%cl
+  80268a:	0f 45 c2             	cmovne %edx,%eax
+  80268d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802691:	83 e0 01             	and    $0x1,%eax
+  802694:	09 fa                	or     %edi,%edx
+  802696:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80269a:	89 04 24             	mov    %eax,(%esp)
+  80269d:	8b 04 24             	mov    (%esp),%eax
+  8026a0:	89 d3                	mov    %edx,%ebx
+  8026a2:	09 f0                	or     %esi,%eax
+  8026a4:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8026a8:	39 f0                	cmp    %esi,%eax
+  8026aa:	19 fb                	sbb    %edi,%ebx
+  8026ac:	72 1d                	jb     8026cb <__udivdi3+0xbb>
+  8026ae:	29 f0                	sub    %esi,%eax
+  8026b0:	19 fa                	sbb    %edi,%edx
+  8026b2:	89 cf                	mov    %ecx,%edi
+  8026b4:	c1 ef 05             	shr    $0x5,%edi
+  8026b7:	83 e7 01             	and    $0x1,%edi
+  8026ba:	89 fe                	mov    %edi,%esi
+  8026bc:	d3 e7                	shl    %cl,%edi
+  8026be:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8026c2:	83 f6 01             	xor    $0x1,%esi
+  8026c5:	d3 e6                	shl    %cl,%esi
+  8026c7:	09 74 24 18          	or     %esi,0x18(%esp)
+  8026cb:	83 e9 01             	sub    $0x1,%ecx
+  8026ce:	73 98                	jae    802668 <__udivdi3+0x58>
+  8026d0:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8026d4:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8026d8:	83 c4 20             	add    $0x20,%esp
+  8026db:	5b                   	pop    %ebx
+  8026dc:	5e                   	pop    %esi
+  8026dd:	5f                   	pop    %edi
+  8026de:	c3                   	ret
+  8026df:	90                   	nop
+
+008026e0 <__umoddi3>:
+  8026e0:	57                   	push   %edi
+  8026e1:	56                   	push   %esi
+  8026e2:	53                   	push   %ebx
+  8026e3:	83 ec 18             	sub    $0x18,%esp
+  8026e6:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8026ea:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8026ee:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8026f2:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8026f6:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8026fa:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8026fe:	89 d1                	mov    %edx,%ecx
+  802700:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802704:	09 c1                	or     %eax,%ecx
+  802706:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80270a:	74 5b                	je     802767 <__umoddi3+0x87>
+  80270c:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802711:	31 c0                	xor    %eax,%eax
+  802713:	31 d2                	xor    %edx,%edx
+  802715:	8d 76 00             	lea    0x0(%esi),%esi
+  802718:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80271c:	01 c0                	add    %eax,%eax
+  80271e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802725:	00 
+  802726:	89 c6                	mov    %eax,%esi
+  802728:	89 d7                	mov    %edx,%edi
+  80272a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80272e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802732:	0f ad d0             	shrd   %cl,%edx,%eax
+  802735:	d3 ea                	shr    %cl,%edx
+  802737:	f6 c1 20             	test   $0x20,%cl
+  80273a:	0f 45 c2             	cmovne %edx,%eax
+  80273d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802741:	83 e0 01             	and    $0x1,%eax
+  802744:	09 fa                	or     %edi,%edx
+  802746:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80274a:	89 04 24             	mov    %eax,(%esp)
+  80274d:	8b 04 24             	mov    (%esp),%eax
+  802750:	89 d3                	mov    %edx,%ebx
+  802752:	09 f0                	or     %esi,%eax
+  802754:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802758:	39 f0                	cmp    %esi,%eax
+  80275a:	19 fb                	sbb    %edi,%ebx
+  80275c:	72 04                	jb     802762 <__umoddi3+0x82>
+  80275e:	29 f0                	sub    %esi,%eax
+  802760:	19 fa                	sbb    %edi,%edx
+  802762:	83 e9 01             	sub    $0x1,%ecx
+  802765:	73 b1                	jae    802718 <__umoddi3+0x38>
+  802767:	83 c4 18             	add    $0x18,%esp
+  80276a:	5b                   	pop    %ebx
+  80276b:	5e                   	pop    %esi
+  80276c:	5f                   	pop    %edi
+  80276d:	c3                   	ret
+  80276e:	66 90                	xchg   %ax,%ax
+
+00802770 <__divdi3>:
+  802770:	55                   	push   %ebp
+  802771:	57                   	push   %edi
+  802772:	56                   	push   %esi
+  802773:	53                   	push   %ebx
+  802774:	83 ec 24             	sub    $0x24,%esp
+  802777:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  80277b:	8b 74 24 44          	mov    0x44(%esp),%esi
+  80277f:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802783:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802787:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  80278b:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  80278f:	85 d2                	test   %edx,%edx
+  802791:	0f 88 e0 00 00 00    	js     802877 <__divdi3+0x107>
+  802797:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  80279b:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  80279f:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8027a3:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8027a7:	85 f6                	test   %esi,%esi
+  8027a9:	78 16                	js     8027c1 <__divdi3+0x51>
+  8027ab:	89 f1                	mov    %esi,%ecx
+  8027ad:	31 c0                	xor    %eax,%eax
+  8027af:	31 d2                	xor    %edx,%edx
+  8027b1:	09 d9                	or     %ebx,%ecx
+  8027b3:	0f 85 f3 00 00 00    	jne    8028ac <__divdi3+0x13c>
+  8027b9:	83 c4 24             	add    $0x24,%esp
+  8027bc:	5b                   	pop    %ebx
+  8027bd:	5e                   	pop    %esi
+  8027be:	5f                   	pop    %edi
+  8027bf:	5d                   	pop    %ebp
+  8027c0:	c3                   	ret
+  8027c1:	bf 01 00 00 00       	mov    $0x1,%edi
+  8027c6:	f7 5c 24 08          	negl   0x8(%esp)
+  8027ca:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  8027cf:	f7 5c 24 0c          	negl   0xc(%esp)
+  8027d3:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8027da:	00 
+  8027db:	31 c0                	xor    %eax,%eax
+  8027dd:	31 d2                	xor    %edx,%edx
+  8027df:	89 fb                	mov    %edi,%ebx
+  8027e1:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8027e8:	00 
+  8027e9:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8027ee:	66 90                	xchg   %ax,%ax
+  8027f0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8027f4:	01 c0                	add    %eax,%eax
+  8027f6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8027fd:	00 
+  8027fe:	89 c6                	mov    %eax,%esi
+  802800:	89 d7                	mov    %edx,%edi
+  802802:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802806:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80280a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80280d:	d3 ea                	shr    %cl,%edx
+  80280f:	f6 c1 20             	test   $0x20,%cl
+  802812:	0f 45 c2             	cmovne %edx,%eax
+  802815:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802819:	83 e0 01             	and    $0x1,%eax
+  80281c:	09 fa                	or     %edi,%edx
+  80281e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802822:	89 04 24             	mov    %eax,(%esp)
+  802825:	8b 04 24             	mov    (%esp),%eax
+  802828:	89 d5                	mov    %edx,%ebp
+  80282a:	09 f0                	or     %esi,%eax
+  80282c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802830:	39 f0                	cmp    %esi,%eax
+  802832:	19 fd                	sbb    %edi,%ebp
+  802834:	72 1d                	jb     802853 <__divdi3+0xe3>
+  802836:	29 f0                	sub    %esi,%eax
+  802838:	19 fa                	sbb    %edi,%edx
+  80283a:	89 cf                	mov    %ecx,%edi
+  80283c:	c1 ef 05             	shr    $0x5,%edi
+  80283f:	83 e7 01             	and    $0x1,%edi
+  802842:	89 fe                	mov    %edi,%esi
+  802844:	d3 e7                	shl    %cl,%edi
+  802846:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80284a:	83 f6 01             	xor    $0x1,%esi
+  80284d:	d3 e6                	shl    %cl,%esi
+  80284f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802853:	83 e9 01             	sub    $0x1,%ecx
+  802856:	73 98                	jae    8027f0 <__divdi3+0x80>
+  802858:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80285c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802860:	85 db                	test   %ebx,%ebx
+  802862:	0f 84 51 ff ff ff    	je     8027b9 <__divdi3+0x49>
+  802868:	f7 d8                	neg    %eax
+  80286a:	83 d2 00             	adc    $0x0,%edx
+  80286d:	83 c4 24             	add    $0x24,%esp
+  802870:	5b                   	pop    %ebx
+  802871:	f7 da                	neg    %edx
+  802873:	5e                   	pop    %esi
+  802874:	5f                   	pop    %edi
+  802875:	5d                   	pop    %ebp
+  802876:	c3                   	ret
+  802877:	f7 d8                	neg    %eax
+  802879:	83 d2 00             	adc    $0x0,%edx
+  80287c:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802880:	f7 da                	neg    %edx
+  802882:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802886:	85 f6                	test   %esi,%esi
+  802888:	78 1b                	js     8028a5 <__divdi3+0x135>
+  80288a:	89 f1                	mov    %esi,%ecx
+  80288c:	31 c0                	xor    %eax,%eax
+  80288e:	31 d2                	xor    %edx,%edx
+  802890:	bf 01 00 00 00       	mov    $0x1,%edi
+  802895:	09 d9                	or     %ebx,%ecx
+  802897:	0f 85 36 ff ff ff    	jne    8027d3 <__divdi3+0x63>
+  80289d:	83 c4 24             	add    $0x24,%esp
+  8028a0:	5b                   	pop    %ebx
+  8028a1:	5e                   	pop    %esi
+  8028a2:	5f                   	pop    %edi
+  8028a3:	5d                   	pop    %ebp
+  8028a4:	c3                   	ret
+  8028a5:	31 ff                	xor    %edi,%edi
+  8028a7:	e9 1a ff ff ff       	jmp    8027c6 <__divdi3+0x56>
+  8028ac:	31 ff                	xor    %edi,%edi
+  8028ae:	e9 20 ff ff ff       	jmp    8027d3 <__divdi3+0x63>
+  8028b3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8028ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+008028c0 <__moddi3>:
+  8028c0:	55                   	push   %ebp
+  8028c1:	57                   	push   %edi
+  8028c2:	56                   	push   %esi
+  8028c3:	53                   	push   %ebx
+  8028c4:	83 ec 1c             	sub    $0x1c,%esp
+  8028c7:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  8028cb:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  8028cf:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  8028d3:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  8028d7:	89 c8                	mov    %ecx,%eax
+  8028d9:	89 f2                	mov    %esi,%edx
+  8028db:	89 f3                	mov    %esi,%ebx
+  8028dd:	85 ed                	test   %ebp,%ebp
+  8028df:	0f 88 9d 00 00 00    	js     802982 <__moddi3+0xc2>
+  8028e5:	09 cb                	or     %ecx,%ebx
+  8028e7:	0f 84 8d 00 00 00    	je     80297a <__moddi3+0xba>
+  8028ed:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  8028f1:	31 db                	xor    %ebx,%ebx
+  8028f3:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  8028f7:	89 ca                	mov    %ecx,%edx
+  8028f9:	89 f0                	mov    %esi,%eax
+  8028fb:	89 dd                	mov    %ebx,%ebp
+  8028fd:	f7 da                	neg    %edx
+  8028ff:	83 d0 00             	adc    $0x0,%eax
+  802902:	f7 d8                	neg    %eax
+  802904:	0f 49 f0             	cmovns %eax,%esi
+  802907:	0f 49 ca             	cmovns %edx,%ecx
+  80290a:	31 c0                	xor    %eax,%eax
+  80290c:	31 d2                	xor    %edx,%edx
+  80290e:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802912:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802916:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80291b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80291f:	90                   	nop
+  802920:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802924:	01 c0                	add    %eax,%eax
+  802926:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80292d:	00 
+  80292e:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  802932:	89 c6                	mov    %eax,%esi
+  802934:	89 d7                	mov    %edx,%edi
+  802936:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80293a:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80293e:	0f ad d0             	shrd   %cl,%edx,%eax
+  802941:	d3 ea                	shr    %cl,%edx
+  802943:	f6 c1 20             	test   $0x20,%cl
+  802946:	0f 45 c2             	cmovne %edx,%eax
+  802949:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80294d:	83 e0 01             	and    $0x1,%eax
+  802950:	09 fa                	or     %edi,%edx
+  802952:	89 04 24             	mov    %eax,(%esp)
+  802955:	8b 04 24             	mov    (%esp),%eax
+  802958:	89 d7                	mov    %edx,%edi
+  80295a:	09 f0                	or     %esi,%eax
+  80295c:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  802960:	39 d8                	cmp    %ebx,%eax
+  802962:	19 f7                	sbb    %esi,%edi
+  802964:	72 04                	jb     80296a <__moddi3+0xaa>
+  802966:	29 d8                	sub    %ebx,%eax
+  802968:	19 f2                	sbb    %esi,%edx
+  80296a:	83 e9 01             	sub    $0x1,%ecx
+  80296d:	73 b1                	jae    802920 <__moddi3+0x60>
+  80296f:	85 ed                	test   %ebp,%ebp
+  802971:	74 07                	je     80297a <__moddi3+0xba>
+  802973:	f7 d8                	neg    %eax
+  802975:	83 d2 00             	adc    $0x0,%edx
+  802978:	f7 da                	neg    %edx
+  80297a:	83 c4 1c             	add    $0x1c,%esp
+  80297d:	5b                   	pop    %ebx
+  80297e:	5e                   	pop    %esi
+  80297f:	5f                   	pop    %edi
+  802980:	5d                   	pop    %ebp
+  802981:	c3                   	ret
+  802982:	09 cb                	or     %ecx,%ebx
+  802984:	74 f4                	je     80297a <__moddi3+0xba>
+  802986:	f7 df                	neg    %edi
+  802988:	bb 01 00 00 00       	mov    $0x1,%ebx
+  80298d:	83 d5 00             	adc    $0x0,%ebp
+  802990:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802994:	f7 dd                	neg    %ebp
+  802996:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  80299a:	e9 58 ff ff ff       	jmp    8028f7 <__moddi3+0x37>
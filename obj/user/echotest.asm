@@ -0,0 +1,5859 @@
+
+obj/user/echotest.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 a6 04 00 00       	call   8004d7 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <die>:
+
+const char *msg = "Hello world!\n";
+
+static void
+die(char *m)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	cprintf("%s\n", m);
+  800039:	50                   	push   %eax
+  80003a:	68 a0 29 80 00       	push   $0x8029a0
+  80003f:	e8 8b 05 00 00       	call   8005cf <cprintf>
+	exit();
+  800044:	e8 d7 04 00 00       	call   800520 <exit>
+}
+  800049:	83 c4 10             	add    $0x10,%esp
+  80004c:	c9                   	leave
+  80004d:	c3                   	ret
+
+0080004e <umain>:
+
+void umain(int argc, char **argv)
+{
+  80004e:	55                   	push   %ebp
+  80004f:	89 e5                	mov    %esp,%ebp
+  800051:	57                   	push   %edi
+  800052:	56                   	push   %esi
+  800053:	53                   	push   %ebx
+  800054:	83 ec 58             	sub    $0x58,%esp
+	struct sockaddr_in echoserver;
+	char buffer[BUFFSIZE];
+	unsigned int echolen;
+	int received = 0;
+
+	cprintf("Connecting to:\n");
+  800057:	68 a4 29 80 00       	push   $0x8029a4
+  80005c:	e8 6e 05 00 00       	call   8005cf <cprintf>
+	cprintf("\tip address %s = %x\n", IPADDR, inet_addr(IPADDR));
+  800061:	c7 04 24 b4 29 80 00 	movl   $0x8029b4,(%esp)
+  800068:	e8 30 04 00 00       	call   80049d <inet_addr>
+  80006d:	83 c4 0c             	add    $0xc,%esp
+  800070:	50                   	push   %eax
+  800071:	68 b4 29 80 00       	push   $0x8029b4
+  800076:	68 be 29 80 00       	push   $0x8029be
+  80007b:	e8 4f 05 00 00       	call   8005cf <cprintf>
+
+	// Create the TCP socket
+	if ((sock = socket(PF_INET, SOCK_STREAM, IPPROTO_TCP)) < 0)
+  800080:	83 c4 0c             	add    $0xc,%esp
+  800083:	6a 06                	push   $0x6
+  800085:	6a 01                	push   $0x1
+  800087:	6a 02                	push   $0x2
+  800089:	e8 8d 1b 00 00       	call   801c1b <socket>
+  80008e:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  800091:	83 c4 10             	add    $0x10,%esp
+  800094:	85 c0                	test   %eax,%eax
+  800096:	0f 88 b4 00 00 00    	js     800150 <umain+0x102>
+		die("Failed to create socket");
+
+	cprintf("opened socket\n");
+  80009c:	83 ec 0c             	sub    $0xc,%esp
+  80009f:	68 eb 29 80 00       	push   $0x8029eb
+  8000a4:	e8 26 05 00 00       	call   8005cf <cprintf>
+
+	// Construct the server sockaddr_in structure
+	memset(&echoserver, 0, sizeof(echoserver));       // Clear struct
+  8000a9:	83 c4 0c             	add    $0xc,%esp
+  8000ac:	6a 10                	push   $0x10
+  8000ae:	6a 00                	push   $0x0
+  8000b0:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+  8000b3:	53                   	push   %ebx
+  8000b4:	e8 20 0c 00 00       	call   800cd9 <memset>
+	echoserver.sin_family = AF_INET;                  // Internet/IP
+  8000b9:	c6 45 d9 02          	movb   $0x2,-0x27(%ebp)
+	echoserver.sin_addr.s_addr = inet_addr(IPADDR);   // IP address
+  8000bd:	c7 04 24 b4 29 80 00 	movl   $0x8029b4,(%esp)
+  8000c4:	e8 d4 03 00 00       	call   80049d <inet_addr>
+  8000c9:	89 45 dc             	mov    %eax,-0x24(%ebp)
+	echoserver.sin_port = htons(PORT);		  // server port
+  8000cc:	c7 04 24 10 27 00 00 	movl   $0x2710,(%esp)
+  8000d3:	e8 a7 01 00 00       	call   80027f <htons>
+  8000d8:	66 89 45 da          	mov    %ax,-0x26(%ebp)
+
+	cprintf("trying to connect to server\n");
+  8000dc:	c7 04 24 fa 29 80 00 	movl   $0x8029fa,(%esp)
+  8000e3:	e8 e7 04 00 00       	call   8005cf <cprintf>
+
+	// Establish connection
+	if (connect(sock, (struct sockaddr *) &echoserver, sizeof(echoserver)) < 0)
+  8000e8:	83 c4 0c             	add    $0xc,%esp
+  8000eb:	6a 10                	push   $0x10
+  8000ed:	53                   	push   %ebx
+  8000ee:	ff 75 b4             	push   -0x4c(%ebp)
+  8000f1:	e8 dc 1a 00 00       	call   801bd2 <connect>
+  8000f6:	83 c4 10             	add    $0x10,%esp
+  8000f9:	85 c0                	test   %eax,%eax
+  8000fb:	78 62                	js     80015f <umain+0x111>
+		die("Failed to connect with server");
+
+	cprintf("connected to server\n");
+  8000fd:	83 ec 0c             	sub    $0xc,%esp
+  800100:	68 35 2a 80 00       	push   $0x802a35
+  800105:	e8 c5 04 00 00       	call   8005cf <cprintf>
+
+	// Send the word to the server
+	echolen = strlen(msg);
+  80010a:	83 c4 04             	add    $0x4,%esp
+  80010d:	ff 35 00 30 80 00    	push   0x803000
+  800113:	e8 35 0a 00 00       	call   800b4d <strlen>
+  800118:	89 c7                	mov    %eax,%edi
+  80011a:	89 45 b0             	mov    %eax,-0x50(%ebp)
+	if (write(sock, msg, echolen) != echolen)
+  80011d:	83 c4 0c             	add    $0xc,%esp
+  800120:	50                   	push   %eax
+  800121:	ff 35 00 30 80 00    	push   0x803000
+  800127:	ff 75 b4             	push   -0x4c(%ebp)
+  80012a:	e8 c9 14 00 00       	call   8015f8 <write>
+  80012f:	83 c4 10             	add    $0x10,%esp
+  800132:	39 c7                	cmp    %eax,%edi
+  800134:	75 35                	jne    80016b <umain+0x11d>
+		die("Mismatch in number of sent bytes");
+
+	// Receive the word back from the server
+	cprintf("Received: \n");
+  800136:	83 ec 0c             	sub    $0xc,%esp
+  800139:	68 4a 2a 80 00       	push   $0x802a4a
+  80013e:	e8 8c 04 00 00       	call   8005cf <cprintf>
+	while (received < echolen) {
+  800143:	83 c4 10             	add    $0x10,%esp
+	int received = 0;
+  800146:	be 00 00 00 00       	mov    $0x0,%esi
+		int bytes = 0;
+		if ((bytes = read(sock, buffer, BUFFSIZE-1)) < 1) {
+  80014b:	8d 7d b8             	lea    -0x48(%ebp),%edi
+	while (received < echolen) {
+  80014e:	eb 3a                	jmp    80018a <umain+0x13c>
+		die("Failed to create socket");
+  800150:	b8 d3 29 80 00       	mov    $0x8029d3,%eax
+  800155:	e8 d9 fe ff ff       	call   800033 <die>
+  80015a:	e9 3d ff ff ff       	jmp    80009c <umain+0x4e>
+		die("Failed to connect with server");
+  80015f:	b8 17 2a 80 00       	mov    $0x802a17,%eax
+  800164:	e8 ca fe ff ff       	call   800033 <die>
+  800169:	eb 92                	jmp    8000fd <umain+0xaf>
+		die("Mismatch in number of sent bytes");
+  80016b:	b8 64 2a 80 00       	mov    $0x802a64,%eax
+  800170:	e8 be fe ff ff       	call   800033 <die>
+  800175:	eb bf                	jmp    800136 <umain+0xe8>
+			die("Failed to receive bytes from server");
+		}
+		received += bytes;
+  800177:	01 de                	add    %ebx,%esi
+		buffer[bytes] = '\0';        // Assure null terminated string
+  800179:	c6 44 1d b8 00       	movb   $0x0,-0x48(%ebp,%ebx,1)
+		cprintf(buffer);
+  80017e:	83 ec 0c             	sub    $0xc,%esp
+  800181:	57                   	push   %edi
+  800182:	e8 48 04 00 00       	call   8005cf <cprintf>
+  800187:	83 c4 10             	add    $0x10,%esp
+	while (received < echolen) {
+  80018a:	8b 45 b0             	mov    -0x50(%ebp),%eax
+  80018d:	39 c6                	cmp    %eax,%esi
+  80018f:	73 23                	jae    8001b4 <umain+0x166>
+		if ((bytes = read(sock, buffer, BUFFSIZE-1)) < 1) {
+  800191:	83 ec 04             	sub    $0x4,%esp
+  800194:	6a 1f                	push   $0x1f
+  800196:	57                   	push   %edi
+  800197:	ff 75 b4             	push   -0x4c(%ebp)
+  80019a:	e8 8b 13 00 00       	call   80152a <read>
+  80019f:	89 c3                	mov    %eax,%ebx
+  8001a1:	83 c4 10             	add    $0x10,%esp
+  8001a4:	85 c0                	test   %eax,%eax
+  8001a6:	7f cf                	jg     800177 <umain+0x129>
+			die("Failed to receive bytes from server");
+  8001a8:	b8 88 2a 80 00       	mov    $0x802a88,%eax
+  8001ad:	e8 81 fe ff ff       	call   800033 <die>
+  8001b2:	eb c3                	jmp    800177 <umain+0x129>
+	}
+	cprintf("\n");
+  8001b4:	83 ec 0c             	sub    $0xc,%esp
+  8001b7:	68 54 2a 80 00       	push   $0x802a54
+  8001bc:	e8 0e 04 00 00       	call   8005cf <cprintf>
+
+	close(sock);
+  8001c1:	83 c4 04             	add    $0x4,%esp
+  8001c4:	ff 75 b4             	push   -0x4c(%ebp)
+  8001c7:	e8 22 12 00 00       	call   8013ee <close>
+}
+  8001cc:	83 c4 10             	add    $0x10,%esp
+  8001cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001d2:	5b                   	pop    %ebx
+  8001d3:	5e                   	pop    %esi
+  8001d4:	5f                   	pop    %edi
+  8001d5:	5d                   	pop    %ebp
+  8001d6:	c3                   	ret
+
+008001d7 <inet_ntoa>:
+ * @return pointer to a global static (!) buffer that holds the ASCII
+ *         represenation of addr
+ */
+char *
+inet_ntoa(struct in_addr addr)
+{
+  8001d7:	55                   	push   %ebp
+  8001d8:	89 e5                	mov    %esp,%ebp
+  8001da:	57                   	push   %edi
+  8001db:	56                   	push   %esi
+  8001dc:	53                   	push   %ebx
+  8001dd:	83 ec 1c             	sub    $0x1c,%esp
+  static char str[16];
+  u32_t s_addr = addr.s_addr;
+  8001e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001e3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  u8_t rem;
+  u8_t n;
+  u8_t i;
+
+  rp = str;
+  ap = (u8_t *)&s_addr;
+  8001e6:	8d 7d f0             	lea    -0x10(%ebp),%edi
+  rp = str;
+  8001e9:	b9 00 40 80 00       	mov    $0x804000,%ecx
+  for(n = 0; n < 4; n++) {
+    i = 0;
+    do {
+      rem = *ap % (u8_t)10;
+  8001ee:	be cd ff ff ff       	mov    $0xffffffcd,%esi
+  8001f3:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001f6:	eb 31                	jmp    800229 <inet_ntoa+0x52>
+      *ap /= (u8_t)10;
+      inv[i++] = '0' + rem;
+    } while(*ap);
+    while(i--)
+      *rp++ = inv[i];
+  8001f8:	0f b6 c8             	movzbl %al,%ecx
+  8001fb:	0f b6 4c 0d ed       	movzbl -0x13(%ebp,%ecx,1),%ecx
+  800200:	88 0a                	mov    %cl,(%edx)
+  800202:	83 c2 01             	add    $0x1,%edx
+    while(i--)
+  800205:	83 e8 01             	sub    $0x1,%eax
+  800208:	3c ff                	cmp    $0xff,%al
+  80020a:	75 ec                	jne    8001f8 <inet_ntoa+0x21>
+  80020c:	0f b6 db             	movzbl %bl,%ebx
+  80020f:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  800212:	01 d8                	add    %ebx,%eax
+  800214:	89 c3                	mov    %eax,%ebx
+    *rp++ = '.';
+  800216:	8d 40 01             	lea    0x1(%eax),%eax
+  800219:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80021c:	c6 03 2e             	movb   $0x2e,(%ebx)
+    ap++;
+  80021f:	83 c7 01             	add    $0x1,%edi
+  for(n = 0; n < 4; n++) {
+  800222:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800225:	39 c7                	cmp    %eax,%edi
+  800227:	74 46                	je     80026f <inet_ntoa+0x98>
+  800229:	0f b6 17             	movzbl (%edi),%edx
+    i = 0;
+  80022c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800231:	89 7d d8             	mov    %edi,-0x28(%ebp)
+      rem = *ap % (u8_t)10;
+  800234:	89 f0                	mov    %esi,%eax
+  800236:	f6 e2                	mul    %dl
+  800238:	66 c1 e8 0b          	shr    $0xb,%ax
+  80023c:	88 45 e3             	mov    %al,-0x1d(%ebp)
+  80023f:	8d 0c 80             	lea    (%eax,%eax,4),%ecx
+  800242:	01 c9                	add    %ecx,%ecx
+  800244:	89 d0                	mov    %edx,%eax
+  800246:	29 c8                	sub    %ecx,%eax
+      *ap /= (u8_t)10;
+  800248:	89 d7                	mov    %edx,%edi
+  80024a:	0f b6 55 e3          	movzbl -0x1d(%ebp),%edx
+      inv[i++] = '0' + rem;
+  80024e:	89 d9                	mov    %ebx,%ecx
+  800250:	83 c3 01             	add    $0x1,%ebx
+  800253:	0f b6 c9             	movzbl %cl,%ecx
+  800256:	83 c0 30             	add    $0x30,%eax
+  800259:	88 44 0d ed          	mov    %al,-0x13(%ebp,%ecx,1)
+    } while(*ap);
+  80025d:	89 f8                	mov    %edi,%eax
+  80025f:	3c 09                	cmp    $0x9,%al
+  800261:	77 d1                	ja     800234 <inet_ntoa+0x5d>
+  800263:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  800266:	88 17                	mov    %dl,(%edi)
+  800268:	8b 55 dc             	mov    -0x24(%ebp),%edx
+      inv[i++] = '0' + rem;
+  80026b:	89 d8                	mov    %ebx,%eax
+  80026d:	eb 96                	jmp    800205 <inet_ntoa+0x2e>
+  }
+  *--rp = 0;
+  80026f:	c6 03 00             	movb   $0x0,(%ebx)
+  return str;
+}
+  800272:	b8 00 40 80 00       	mov    $0x804000,%eax
+  800277:	83 c4 1c             	add    $0x1c,%esp
+  80027a:	5b                   	pop    %ebx
+  80027b:	5e                   	pop    %esi
+  80027c:	5f                   	pop    %edi
+  80027d:	5d                   	pop    %ebp
+  80027e:	c3                   	ret
+
+0080027f <htons>:
+ * @param n u16_t in host byte order
+ * @return n in network byte order
+ */
+u16_t
+htons(u16_t n)
+{
+  80027f:	55                   	push   %ebp
+  800280:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  800282:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  800286:	66 c1 c0 08          	rol    $0x8,%ax
+}
+  80028a:	5d                   	pop    %ebp
+  80028b:	c3                   	ret
+
+0080028c <ntohs>:
+ * @param n u16_t in network byte order
+ * @return n in host byte order
+ */
+u16_t
+ntohs(u16_t n)
+{
+  80028c:	55                   	push   %ebp
+  80028d:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  80028f:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  800293:	66 c1 c0 08          	rol    $0x8,%ax
+  return htons(n);
+}
+  800297:	5d                   	pop    %ebp
+  800298:	c3                   	ret
+
+00800299 <htonl>:
+ * @param n u32_t in host byte order
+ * @return n in network byte order
+ */
+u32_t
+htonl(u32_t n)
+{
+  800299:	55                   	push   %ebp
+  80029a:	89 e5                	mov    %esp,%ebp
+  80029c:	8b 55 08             	mov    0x8(%ebp),%edx
+  return ((n & 0xff) << 24) |
+  80029f:	89 d0                	mov    %edx,%eax
+  8002a1:	c1 e0 18             	shl    $0x18,%eax
+    ((n & 0xff00) << 8) |
+    ((n & 0xff0000UL) >> 8) |
+    ((n & 0xff000000UL) >> 24);
+  8002a4:	89 d1                	mov    %edx,%ecx
+  8002a6:	c1 e9 18             	shr    $0x18,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  8002a9:	09 c8                	or     %ecx,%eax
+    ((n & 0xff00) << 8) |
+  8002ab:	89 d1                	mov    %edx,%ecx
+  8002ad:	c1 e1 08             	shl    $0x8,%ecx
+  8002b0:	81 e1 00 00 ff 00    	and    $0xff0000,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  8002b6:	09 c8                	or     %ecx,%eax
+  8002b8:	c1 ea 08             	shr    $0x8,%edx
+  8002bb:	81 e2 00 ff 00 00    	and    $0xff00,%edx
+  8002c1:	09 d0                	or     %edx,%eax
+}
+  8002c3:	5d                   	pop    %ebp
+  8002c4:	c3                   	ret
+
+008002c5 <inet_aton>:
+{
+  8002c5:	55                   	push   %ebp
+  8002c6:	89 e5                	mov    %esp,%ebp
+  8002c8:	57                   	push   %edi
+  8002c9:	56                   	push   %esi
+  8002ca:	53                   	push   %ebx
+  8002cb:	83 ec 2c             	sub    $0x2c,%esp
+  8002ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  c = *cp;
+  8002d1:	0f be 02             	movsbl (%edx),%eax
+  u32_t *pp = parts;
+  8002d4:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+      if (pp >= parts + 3)
+  8002d7:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  8002da:	e9 9b 00 00 00       	jmp    80037a <inet_aton+0xb5>
+      c = *++cp;
+  8002df:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+      if (c == 'x' || c == 'X') {
+  8002e3:	89 c1                	mov    %eax,%ecx
+  8002e5:	83 e1 df             	and    $0xffffffdf,%ecx
+  8002e8:	80 f9 58             	cmp    $0x58,%cl
+  8002eb:	74 10                	je     8002fd <inet_aton+0x38>
+      c = *++cp;
+  8002ed:	83 c2 01             	add    $0x1,%edx
+  8002f0:	0f be c0             	movsbl %al,%eax
+        base = 8;
+  8002f3:	bf 08 00 00 00       	mov    $0x8,%edi
+  8002f8:	e9 97 00 00 00       	jmp    800394 <inet_aton+0xcf>
+        c = *++cp;
+  8002fd:	0f be 42 02          	movsbl 0x2(%edx),%eax
+  800301:	8d 52 02             	lea    0x2(%edx),%edx
+        base = 16;
+  800304:	bf 10 00 00 00       	mov    $0x10,%edi
+  800309:	e9 86 00 00 00       	jmp    800394 <inet_aton+0xcf>
+        val = (val * base) + (int)(c - '0');
+  80030e:	0f af d7             	imul   %edi,%edx
+  800311:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+        c = *++cp;
+  800315:	0f be 01             	movsbl (%ecx),%eax
+  800318:	83 c1 01             	add    $0x1,%ecx
+      if (isdigit(c)) {
+  80031b:	88 45 d7             	mov    %al,-0x29(%ebp)
+  80031e:	8d 58 d0             	lea    -0x30(%eax),%ebx
+  800321:	80 fb 09             	cmp    $0x9,%bl
+  800324:	76 e8                	jbe    80030e <inet_aton+0x49>
+      } else if (base == 16 && isxdigit(c)) {
+  800326:	83 ff 10             	cmp    $0x10,%edi
+  800329:	75 2e                	jne    800359 <inet_aton+0x94>
+  80032b:	0f b6 5d d7          	movzbl -0x29(%ebp),%ebx
+  80032f:	8d 73 9f             	lea    -0x61(%ebx),%esi
+  800332:	83 e3 df             	and    $0xffffffdf,%ebx
+  800335:	83 eb 41             	sub    $0x41,%ebx
+  800338:	80 fb 05             	cmp    $0x5,%bl
+  80033b:	77 1c                	ja     800359 <inet_aton+0x94>
+        val = (val << 4) | (int)(c + 10 - (islower(c) ? 'a' : 'A'));
+  80033d:	c1 e2 04             	shl    $0x4,%edx
+  800340:	83 c0 0a             	add    $0xa,%eax
+  800343:	89 f3                	mov    %esi,%ebx
+  800345:	80 fb 1a             	cmp    $0x1a,%bl
+  800348:	19 db                	sbb    %ebx,%ebx
+  80034a:	83 e3 20             	and    $0x20,%ebx
+  80034d:	83 c3 41             	add    $0x41,%ebx
+  800350:	29 d8                	sub    %ebx,%eax
+  800352:	09 c2                	or     %eax,%edx
+        c = *++cp;
+  800354:	0f be 01             	movsbl (%ecx),%eax
+  800357:	eb bf                	jmp    800318 <inet_aton+0x53>
+    if (c == '.') {
+  800359:	83 f8 2e             	cmp    $0x2e,%eax
+  80035c:	75 43                	jne    8003a1 <inet_aton+0xdc>
+      if (pp >= parts + 3)
+  80035e:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800361:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  800364:	39 f0                	cmp    %esi,%eax
+  800366:	0f 84 22 01 00 00    	je     80048e <inet_aton+0x1c9>
+      *pp++ = val;
+  80036c:	83 c0 04             	add    $0x4,%eax
+  80036f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800372:	89 50 fc             	mov    %edx,-0x4(%eax)
+      c = *++cp;
+  800375:	89 ca                	mov    %ecx,%edx
+  800377:	0f be 01             	movsbl (%ecx),%eax
+    if (!isdigit(c))
+  80037a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  80037d:	80 f9 09             	cmp    $0x9,%cl
+  800380:	0f 87 01 01 00 00    	ja     800487 <inet_aton+0x1c2>
+    base = 10;
+  800386:	bf 0a 00 00 00       	mov    $0xa,%edi
+    if (c == '0') {
+  80038b:	83 f8 30             	cmp    $0x30,%eax
+  80038e:	0f 84 4b ff ff ff    	je     8002df <inet_aton+0x1a>
+  800394:	8d 4a 01             	lea    0x1(%edx),%ecx
+        base = 8;
+  800397:	ba 00 00 00 00       	mov    $0x0,%edx
+  80039c:	e9 7a ff ff ff       	jmp    80031b <inet_aton+0x56>
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  8003a1:	0f b6 7d d7          	movzbl -0x29(%ebp),%edi
+  8003a5:	89 d6                	mov    %edx,%esi
+  8003a7:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8003aa:	85 c0                	test   %eax,%eax
+  8003ac:	74 2e                	je     8003dc <inet_aton+0x117>
+    return (0);
+  8003ae:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  8003b3:	89 fa                	mov    %edi,%edx
+  8003b5:	80 fa 1f             	cmp    $0x1f,%dl
+  8003b8:	0f 86 d5 00 00 00    	jbe    800493 <inet_aton+0x1ce>
+  8003be:	84 c0                	test   %al,%al
+  8003c0:	0f 88 cd 00 00 00    	js     800493 <inet_aton+0x1ce>
+  8003c6:	8d 48 f7             	lea    -0x9(%eax),%ecx
+  8003c9:	83 f9 04             	cmp    $0x4,%ecx
+  8003cc:	76 0e                	jbe    8003dc <inet_aton+0x117>
+    return (0);
+  8003ce:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  8003d3:	83 f8 20             	cmp    $0x20,%eax
+  8003d6:	0f 85 b7 00 00 00    	jne    800493 <inet_aton+0x1ce>
+  n = pp - parts + 1;
+  8003dc:	8d 4d d8             	lea    -0x28(%ebp),%ecx
+  8003df:	89 d8                	mov    %ebx,%eax
+  8003e1:	29 c8                	sub    %ecx,%eax
+  8003e3:	c1 f8 02             	sar    $0x2,%eax
+  8003e6:	8d 48 01             	lea    0x1(%eax),%ecx
+  switch (n) {
+  8003e9:	83 f8 02             	cmp    $0x2,%eax
+  8003ec:	74 7a                	je     800468 <inet_aton+0x1a3>
+  8003ee:	83 f9 03             	cmp    $0x3,%ecx
+  8003f1:	7f 49                	jg     80043c <inet_aton+0x177>
+  8003f3:	85 c9                	test   %ecx,%ecx
+  8003f5:	0f 84 98 00 00 00    	je     800493 <inet_aton+0x1ce>
+  8003fb:	83 f9 02             	cmp    $0x2,%ecx
+  8003fe:	75 19                	jne    800419 <inet_aton+0x154>
+      return (0);
+  800400:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffffffUL)
+  800405:	81 fe ff ff ff 00    	cmp    $0xffffff,%esi
+  80040b:	0f 87 82 00 00 00    	ja     800493 <inet_aton+0x1ce>
+    val |= parts[0] << 24;
+  800411:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  800414:	c1 e0 18             	shl    $0x18,%eax
+  800417:	09 c6                	or     %eax,%esi
+  return (1);
+  800419:	b9 01 00 00 00       	mov    $0x1,%ecx
+  if (addr)
+  80041e:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800422:	74 6f                	je     800493 <inet_aton+0x1ce>
+    addr->s_addr = htonl(val);
+  800424:	83 ec 0c             	sub    $0xc,%esp
+  800427:	56                   	push   %esi
+  800428:	e8 6c fe ff ff       	call   800299 <htonl>
+  80042d:	83 c4 10             	add    $0x10,%esp
+  800430:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800433:	89 06                	mov    %eax,(%esi)
+  return (1);
+  800435:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80043a:	eb 57                	jmp    800493 <inet_aton+0x1ce>
+  switch (n) {
+  80043c:	83 f9 04             	cmp    $0x4,%ecx
+  80043f:	75 d8                	jne    800419 <inet_aton+0x154>
+      return (0);
+  800441:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xff)
+  800446:	81 fe ff 00 00 00    	cmp    $0xff,%esi
+  80044c:	77 45                	ja     800493 <inet_aton+0x1ce>
+    val |= (parts[0] << 24) | (parts[1] << 16) | (parts[2] << 8);
+  80044e:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  800451:	c1 e0 18             	shl    $0x18,%eax
+  800454:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800457:	c1 e1 10             	shl    $0x10,%ecx
+  80045a:	09 c8                	or     %ecx,%eax
+  80045c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80045f:	c1 e1 08             	shl    $0x8,%ecx
+  800462:	09 c8                	or     %ecx,%eax
+  800464:	09 c6                	or     %eax,%esi
+    break;
+  800466:	eb b1                	jmp    800419 <inet_aton+0x154>
+      return (0);
+  800468:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffff)
+  80046d:	81 fe ff ff 00 00    	cmp    $0xffff,%esi
+  800473:	77 1e                	ja     800493 <inet_aton+0x1ce>
+    val |= (parts[0] << 24) | (parts[1] << 16);
+  800475:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  800478:	c1 e0 18             	shl    $0x18,%eax
+  80047b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80047e:	c1 e1 10             	shl    $0x10,%ecx
+  800481:	09 c8                	or     %ecx,%eax
+  800483:	09 c6                	or     %eax,%esi
+    break;
+  800485:	eb 92                	jmp    800419 <inet_aton+0x154>
+      return (0);
+  800487:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80048c:	eb 05                	jmp    800493 <inet_aton+0x1ce>
+        return (0);
+  80048e:	b9 00 00 00 00       	mov    $0x0,%ecx
+}
+  800493:	89 c8                	mov    %ecx,%eax
+  800495:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800498:	5b                   	pop    %ebx
+  800499:	5e                   	pop    %esi
+  80049a:	5f                   	pop    %edi
+  80049b:	5d                   	pop    %ebp
+  80049c:	c3                   	ret
+
+0080049d <inet_addr>:
+{
+  80049d:	55                   	push   %ebp
+  80049e:	89 e5                	mov    %esp,%ebp
+  8004a0:	83 ec 20             	sub    $0x20,%esp
+  if (inet_aton(cp, &val)) {
+  8004a3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8004a6:	50                   	push   %eax
+  8004a7:	ff 75 08             	push   0x8(%ebp)
+  8004aa:	e8 16 fe ff ff       	call   8002c5 <inet_aton>
+  8004af:	89 c2                	mov    %eax,%edx
+  8004b1:	83 c4 10             	add    $0x10,%esp
+  return (INADDR_NONE);
+  8004b4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  if (inet_aton(cp, &val)) {
+  8004b9:	85 d2                	test   %edx,%edx
+  8004bb:	75 02                	jne    8004bf <inet_addr+0x22>
+}
+  8004bd:	c9                   	leave
+  8004be:	c3                   	ret
+    return (val.s_addr);
+  8004bf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8004c2:	eb f9                	jmp    8004bd <inet_addr+0x20>
+
+008004c4 <ntohl>:
+ * @param n u32_t in network byte order
+ * @return n in host byte order
+ */
+u32_t
+ntohl(u32_t n)
+{
+  8004c4:	55                   	push   %ebp
+  8004c5:	89 e5                	mov    %esp,%ebp
+  8004c7:	83 ec 14             	sub    $0x14,%esp
+  return htonl(n);
+  8004ca:	ff 75 08             	push   0x8(%ebp)
+  8004cd:	e8 c7 fd ff ff       	call   800299 <htonl>
+  8004d2:	83 c4 10             	add    $0x10,%esp
+}
+  8004d5:	c9                   	leave
+  8004d6:	c3                   	ret
+
+008004d7 <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  8004d7:	55                   	push   %ebp
+  8004d8:	89 e5                	mov    %esp,%ebp
+  8004da:	56                   	push   %esi
+  8004db:	53                   	push   %ebx
+  8004dc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8004df:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  8004e2:	e8 4f 0a 00 00       	call   800f36 <sys_getenvid>
+  8004e7:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8004ec:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8004ef:	c1 e0 04             	shl    $0x4,%eax
+  8004f2:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8004f7:	a3 18 40 80 00       	mov    %eax,0x804018
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8004fc:	85 db                	test   %ebx,%ebx
+  8004fe:	7e 07                	jle    800507 <libmain+0x30>
+    binaryname = argv[0];
+  800500:	8b 06                	mov    (%esi),%eax
+  800502:	a3 04 30 80 00       	mov    %eax,0x803004
+
+  // call user main routine
+  umain(argc, argv);
+  800507:	83 ec 08             	sub    $0x8,%esp
+  80050a:	56                   	push   %esi
+  80050b:	53                   	push   %ebx
+  80050c:	e8 3d fb ff ff       	call   80004e <umain>
+
+  // exit gracefully
+  exit();
+  800511:	e8 0a 00 00 00       	call   800520 <exit>
+}
+  800516:	83 c4 10             	add    $0x10,%esp
+  800519:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80051c:	5b                   	pop    %ebx
+  80051d:	5e                   	pop    %esi
+  80051e:	5d                   	pop    %ebp
+  80051f:	c3                   	ret
+
+00800520 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800520:	55                   	push   %ebp
+  800521:	89 e5                	mov    %esp,%ebp
+  800523:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800526:	e8 f0 0e 00 00       	call   80141b <close_all>
+	sys_env_destroy(0);
+  80052b:	83 ec 0c             	sub    $0xc,%esp
+  80052e:	6a 00                	push   $0x0
+  800530:	e8 c0 09 00 00       	call   800ef5 <sys_env_destroy>
+}
+  800535:	83 c4 10             	add    $0x10,%esp
+  800538:	c9                   	leave
+  800539:	c3                   	ret
+
+0080053a <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80053a:	55                   	push   %ebp
+  80053b:	89 e5                	mov    %esp,%ebp
+  80053d:	53                   	push   %ebx
+  80053e:	83 ec 04             	sub    $0x4,%esp
+  800541:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800544:	8b 13                	mov    (%ebx),%edx
+  800546:	8d 42 01             	lea    0x1(%edx),%eax
+  800549:	89 03                	mov    %eax,(%ebx)
+  80054b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80054e:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800552:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800557:	74 09                	je     800562 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800559:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80055d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800560:	c9                   	leave
+  800561:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800562:	83 ec 08             	sub    $0x8,%esp
+  800565:	68 ff 00 00 00       	push   $0xff
+  80056a:	8d 43 08             	lea    0x8(%ebx),%eax
+  80056d:	50                   	push   %eax
+  80056e:	e8 45 09 00 00       	call   800eb8 <sys_cputs>
+		b->idx = 0;
+  800573:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800579:	83 c4 10             	add    $0x10,%esp
+  80057c:	eb db                	jmp    800559 <putch+0x1f>
+
+0080057e <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80057e:	55                   	push   %ebp
+  80057f:	89 e5                	mov    %esp,%ebp
+  800581:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800587:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80058e:	00 00 00 
+	b.cnt = 0;
+  800591:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800598:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80059b:	ff 75 0c             	push   0xc(%ebp)
+  80059e:	ff 75 08             	push   0x8(%ebp)
+  8005a1:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8005a7:	50                   	push   %eax
+  8005a8:	68 3a 05 80 00       	push   $0x80053a
+  8005ad:	e8 14 01 00 00       	call   8006c6 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8005b2:	83 c4 08             	add    $0x8,%esp
+  8005b5:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8005bb:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8005c1:	50                   	push   %eax
+  8005c2:	e8 f1 08 00 00       	call   800eb8 <sys_cputs>
+
+	return b.cnt;
+}
+  8005c7:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8005cd:	c9                   	leave
+  8005ce:	c3                   	ret
+
+008005cf <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8005cf:	55                   	push   %ebp
+  8005d0:	89 e5                	mov    %esp,%ebp
+  8005d2:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8005d5:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8005d8:	50                   	push   %eax
+  8005d9:	ff 75 08             	push   0x8(%ebp)
+  8005dc:	e8 9d ff ff ff       	call   80057e <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8005e1:	c9                   	leave
+  8005e2:	c3                   	ret
+
+008005e3 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8005e3:	55                   	push   %ebp
+  8005e4:	89 e5                	mov    %esp,%ebp
+  8005e6:	57                   	push   %edi
+  8005e7:	56                   	push   %esi
+  8005e8:	53                   	push   %ebx
+  8005e9:	83 ec 1c             	sub    $0x1c,%esp
+  8005ec:	89 c7                	mov    %eax,%edi
+  8005ee:	89 d6                	mov    %edx,%esi
+  8005f0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8005f3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8005f6:	89 d1                	mov    %edx,%ecx
+  8005f8:	89 c2                	mov    %eax,%edx
+  8005fa:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005fd:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800600:	8b 45 10             	mov    0x10(%ebp),%eax
+  800603:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800606:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800609:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800610:	39 c2                	cmp    %eax,%edx
+  800612:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800615:	72 3e                	jb     800655 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800617:	83 ec 0c             	sub    $0xc,%esp
+  80061a:	ff 75 18             	push   0x18(%ebp)
+  80061d:	83 eb 01             	sub    $0x1,%ebx
+  800620:	53                   	push   %ebx
+  800621:	50                   	push   %eax
+  800622:	83 ec 08             	sub    $0x8,%esp
+  800625:	ff 75 e4             	push   -0x1c(%ebp)
+  800628:	ff 75 e0             	push   -0x20(%ebp)
+  80062b:	ff 75 dc             	push   -0x24(%ebp)
+  80062e:	ff 75 d8             	push   -0x28(%ebp)
+  800631:	e8 ca 1f 00 00       	call   802600 <__udivdi3>
+  800636:	83 c4 18             	add    $0x18,%esp
+  800639:	52                   	push   %edx
+  80063a:	50                   	push   %eax
+  80063b:	89 f2                	mov    %esi,%edx
+  80063d:	89 f8                	mov    %edi,%eax
+  80063f:	e8 9f ff ff ff       	call   8005e3 <printnum>
+  800644:	83 c4 20             	add    $0x20,%esp
+  800647:	eb 13                	jmp    80065c <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800649:	83 ec 08             	sub    $0x8,%esp
+  80064c:	56                   	push   %esi
+  80064d:	ff 75 18             	push   0x18(%ebp)
+  800650:	ff d7                	call   *%edi
+  800652:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800655:	83 eb 01             	sub    $0x1,%ebx
+  800658:	85 db                	test   %ebx,%ebx
+  80065a:	7f ed                	jg     800649 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80065c:	83 ec 08             	sub    $0x8,%esp
+  80065f:	56                   	push   %esi
+  800660:	83 ec 04             	sub    $0x4,%esp
+  800663:	ff 75 e4             	push   -0x1c(%ebp)
+  800666:	ff 75 e0             	push   -0x20(%ebp)
+  800669:	ff 75 dc             	push   -0x24(%ebp)
+  80066c:	ff 75 d8             	push   -0x28(%ebp)
+  80066f:	e8 5c 20 00 00       	call   8026d0 <__umoddi3>
+  800674:	83 c4 14             	add    $0x14,%esp
+  800677:	0f be 80 b6 2a 80 00 	movsbl 0x802ab6(%eax),%eax
+  80067e:	50                   	push   %eax
+  80067f:	ff d7                	call   *%edi
+}
+  800681:	83 c4 10             	add    $0x10,%esp
+  800684:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800687:	5b                   	pop    %ebx
+  800688:	5e                   	pop    %esi
+  800689:	5f                   	pop    %edi
+  80068a:	5d                   	pop    %ebp
+  80068b:	c3                   	ret
+
+0080068c <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80068c:	55                   	push   %ebp
+  80068d:	89 e5                	mov    %esp,%ebp
+  80068f:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800692:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800696:	8b 10                	mov    (%eax),%edx
+  800698:	3b 50 04             	cmp    0x4(%eax),%edx
+  80069b:	73 0a                	jae    8006a7 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80069d:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8006a0:	89 08                	mov    %ecx,(%eax)
+  8006a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006a5:	88 02                	mov    %al,(%edx)
+}
+  8006a7:	5d                   	pop    %ebp
+  8006a8:	c3                   	ret
+
+008006a9 <printfmt>:
+{
+  8006a9:	55                   	push   %ebp
+  8006aa:	89 e5                	mov    %esp,%ebp
+  8006ac:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8006af:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8006b2:	50                   	push   %eax
+  8006b3:	ff 75 10             	push   0x10(%ebp)
+  8006b6:	ff 75 0c             	push   0xc(%ebp)
+  8006b9:	ff 75 08             	push   0x8(%ebp)
+  8006bc:	e8 05 00 00 00       	call   8006c6 <vprintfmt>
+}
+  8006c1:	83 c4 10             	add    $0x10,%esp
+  8006c4:	c9                   	leave
+  8006c5:	c3                   	ret
+
+008006c6 <vprintfmt>:
+{
+  8006c6:	55                   	push   %ebp
+  8006c7:	89 e5                	mov    %esp,%ebp
+  8006c9:	57                   	push   %edi
+  8006ca:	56                   	push   %esi
+  8006cb:	53                   	push   %ebx
+  8006cc:	83 ec 2c             	sub    $0x2c,%esp
+  8006cf:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006d2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8006d5:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8006d8:	eb 0a                	jmp    8006e4 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8006da:	83 ec 08             	sub    $0x8,%esp
+  8006dd:	53                   	push   %ebx
+  8006de:	50                   	push   %eax
+  8006df:	ff d6                	call   *%esi
+  8006e1:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8006e4:	83 c7 01             	add    $0x1,%edi
+  8006e7:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8006eb:	83 f8 25             	cmp    $0x25,%eax
+  8006ee:	74 0c                	je     8006fc <vprintfmt+0x36>
+			if (ch == '\0')
+  8006f0:	85 c0                	test   %eax,%eax
+  8006f2:	75 e6                	jne    8006da <vprintfmt+0x14>
+}
+  8006f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006f7:	5b                   	pop    %ebx
+  8006f8:	5e                   	pop    %esi
+  8006f9:	5f                   	pop    %edi
+  8006fa:	5d                   	pop    %ebp
+  8006fb:	c3                   	ret
+		padc = ' ';
+  8006fc:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800700:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800707:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80070e:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800715:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80071a:	8d 47 01             	lea    0x1(%edi),%eax
+  80071d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800720:	0f b6 17             	movzbl (%edi),%edx
+  800723:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800726:	3c 55                	cmp    $0x55,%al
+  800728:	0f 87 9a 03 00 00    	ja     800ac8 <vprintfmt+0x402>
+  80072e:	0f b6 c0             	movzbl %al,%eax
+  800731:	ff 24 85 00 2c 80 00 	jmp    *0x802c00(,%eax,4)
+  800738:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  80073b:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80073f:	eb d9                	jmp    80071a <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800741:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800744:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800748:	eb d0                	jmp    80071a <vprintfmt+0x54>
+  80074a:	0f b6 d2             	movzbl %dl,%edx
+  80074d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800750:	b8 00 00 00 00       	mov    $0x0,%eax
+  800755:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800758:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80075b:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80075f:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800762:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800765:	83 f9 09             	cmp    $0x9,%ecx
+  800768:	77 55                	ja     8007bf <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  80076a:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  80076d:	eb e9                	jmp    800758 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  80076f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800772:	8b 00                	mov    (%eax),%eax
+  800774:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800777:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077a:	8d 40 04             	lea    0x4(%eax),%eax
+  80077d:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800780:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800783:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800787:	79 91                	jns    80071a <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800789:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80078c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80078f:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800796:	eb 82                	jmp    80071a <vprintfmt+0x54>
+			if (width < 0)
+  800798:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80079b:	85 d2                	test   %edx,%edx
+  80079d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007a2:	0f 49 c2             	cmovns %edx,%eax
+  8007a5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8007a8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8007ab:	e9 6a ff ff ff       	jmp    80071a <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8007b0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8007b3:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8007ba:	e9 5b ff ff ff       	jmp    80071a <vprintfmt+0x54>
+  8007bf:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8007c2:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8007c5:	eb bc                	jmp    800783 <vprintfmt+0xbd>
+			lflag++;
+  8007c7:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8007ca:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8007cd:	e9 48 ff ff ff       	jmp    80071a <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8007d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d5:	8d 78 04             	lea    0x4(%eax),%edi
+  8007d8:	83 ec 08             	sub    $0x8,%esp
+  8007db:	53                   	push   %ebx
+  8007dc:	ff 30                	push   (%eax)
+  8007de:	ff d6                	call   *%esi
+			break;
+  8007e0:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8007e3:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8007e6:	e9 7c 02 00 00       	jmp    800a67 <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  8007eb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ee:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8007f1:	8b 10                	mov    (%eax),%edx
+  8007f3:	89 d0                	mov    %edx,%eax
+  8007f5:	f7 d8                	neg    %eax
+  8007f7:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8007fa:	83 f8 10             	cmp    $0x10,%eax
+  8007fd:	7f 23                	jg     800822 <vprintfmt+0x15c>
+  8007ff:	8b 14 85 60 2d 80 00 	mov    0x802d60(,%eax,4),%edx
+  800806:	85 d2                	test   %edx,%edx
+  800808:	74 18                	je     800822 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  80080a:	52                   	push   %edx
+  80080b:	68 99 2e 80 00       	push   $0x802e99
+  800810:	53                   	push   %ebx
+  800811:	56                   	push   %esi
+  800812:	e8 92 fe ff ff       	call   8006a9 <printfmt>
+  800817:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80081a:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80081d:	e9 45 02 00 00       	jmp    800a67 <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  800822:	50                   	push   %eax
+  800823:	68 ce 2a 80 00       	push   $0x802ace
+  800828:	53                   	push   %ebx
+  800829:	56                   	push   %esi
+  80082a:	e8 7a fe ff ff       	call   8006a9 <printfmt>
+  80082f:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800832:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800835:	e9 2d 02 00 00       	jmp    800a67 <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80083a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80083d:	83 c0 04             	add    $0x4,%eax
+  800840:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800843:	8b 45 14             	mov    0x14(%ebp),%eax
+  800846:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800848:	85 c9                	test   %ecx,%ecx
+  80084a:	b8 c7 2a 80 00       	mov    $0x802ac7,%eax
+  80084f:	0f 45 c1             	cmovne %ecx,%eax
+  800852:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800855:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800859:	7e 06                	jle    800861 <vprintfmt+0x19b>
+  80085b:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80085f:	75 0b                	jne    80086c <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800861:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800864:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800867:	89 75 08             	mov    %esi,0x8(%ebp)
+  80086a:	eb 5c                	jmp    8008c8 <vprintfmt+0x202>
+  80086c:	83 ec 08             	sub    $0x8,%esp
+  80086f:	ff 75 d0             	push   -0x30(%ebp)
+  800872:	ff 75 cc             	push   -0x34(%ebp)
+  800875:	e8 eb 02 00 00       	call   800b65 <strnlen>
+  80087a:	89 c2                	mov    %eax,%edx
+  80087c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80087f:	29 d0                	sub    %edx,%eax
+  800881:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800884:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800888:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80088b:	89 75 08             	mov    %esi,0x8(%ebp)
+  80088e:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800890:	eb 0e                	jmp    8008a0 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800892:	83 ec 08             	sub    $0x8,%esp
+  800895:	53                   	push   %ebx
+  800896:	57                   	push   %edi
+  800897:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80089a:	83 ee 01             	sub    $0x1,%esi
+  80089d:	83 c4 10             	add    $0x10,%esp
+  8008a0:	85 f6                	test   %esi,%esi
+  8008a2:	7f ee                	jg     800892 <vprintfmt+0x1cc>
+  8008a4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8008a7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008aa:	85 c0                	test   %eax,%eax
+  8008ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008b1:	0f 49 d0             	cmovns %eax,%edx
+  8008b4:	29 d0                	sub    %edx,%eax
+  8008b6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8008b9:	eb a6                	jmp    800861 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8008bb:	83 ec 08             	sub    $0x8,%esp
+  8008be:	53                   	push   %ebx
+  8008bf:	52                   	push   %edx
+  8008c0:	ff 55 08             	call   *0x8(%ebp)
+  8008c3:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8008c6:	89 f1                	mov    %esi,%ecx
+  8008c8:	8d 71 01             	lea    0x1(%ecx),%esi
+  8008cb:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8008cf:	0f be d0             	movsbl %al,%edx
+  8008d2:	85 d2                	test   %edx,%edx
+  8008d4:	74 28                	je     8008fe <vprintfmt+0x238>
+  8008d6:	85 ff                	test   %edi,%edi
+  8008d8:	78 05                	js     8008df <vprintfmt+0x219>
+  8008da:	83 ef 01             	sub    $0x1,%edi
+  8008dd:	78 30                	js     80090f <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8008df:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8008e3:	74 d6                	je     8008bb <vprintfmt+0x1f5>
+  8008e5:	0f be c0             	movsbl %al,%eax
+  8008e8:	83 e8 20             	sub    $0x20,%eax
+  8008eb:	83 f8 5e             	cmp    $0x5e,%eax
+  8008ee:	76 cb                	jbe    8008bb <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8008f0:	83 ec 08             	sub    $0x8,%esp
+  8008f3:	53                   	push   %ebx
+  8008f4:	6a 3f                	push   $0x3f
+  8008f6:	ff 55 08             	call   *0x8(%ebp)
+  8008f9:	83 c4 10             	add    $0x10,%esp
+  8008fc:	eb c8                	jmp    8008c6 <vprintfmt+0x200>
+  8008fe:	8b 75 08             	mov    0x8(%ebp),%esi
+  800901:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800904:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800907:	01 d0                	add    %edx,%eax
+  800909:	29 c8                	sub    %ecx,%eax
+  80090b:	89 c7                	mov    %eax,%edi
+  80090d:	eb 13                	jmp    800922 <vprintfmt+0x25c>
+  80090f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800912:	eb ed                	jmp    800901 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800914:	83 ec 08             	sub    $0x8,%esp
+  800917:	53                   	push   %ebx
+  800918:	6a 20                	push   $0x20
+  80091a:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80091c:	83 ef 01             	sub    $0x1,%edi
+  80091f:	83 c4 10             	add    $0x10,%esp
+  800922:	85 ff                	test   %edi,%edi
+  800924:	7f ee                	jg     800914 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800926:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800929:	89 45 14             	mov    %eax,0x14(%ebp)
+  80092c:	e9 36 01 00 00       	jmp    800a67 <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  800931:	83 f9 01             	cmp    $0x1,%ecx
+  800934:	7f 1f                	jg     800955 <vprintfmt+0x28f>
+	else if (lflag)
+  800936:	85 c9                	test   %ecx,%ecx
+  800938:	74 67                	je     8009a1 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  80093a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80093d:	8b 00                	mov    (%eax),%eax
+  80093f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800942:	89 c1                	mov    %eax,%ecx
+  800944:	c1 f9 1f             	sar    $0x1f,%ecx
+  800947:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80094a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80094d:	8d 40 04             	lea    0x4(%eax),%eax
+  800950:	89 45 14             	mov    %eax,0x14(%ebp)
+  800953:	eb 17                	jmp    80096c <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800955:	8b 45 14             	mov    0x14(%ebp),%eax
+  800958:	8b 50 04             	mov    0x4(%eax),%edx
+  80095b:	8b 00                	mov    (%eax),%eax
+  80095d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800960:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800963:	8b 45 14             	mov    0x14(%ebp),%eax
+  800966:	8d 40 08             	lea    0x8(%eax),%eax
+  800969:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80096c:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80096f:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800972:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800977:	85 c9                	test   %ecx,%ecx
+  800979:	0f 89 ce 00 00 00    	jns    800a4d <vprintfmt+0x387>
+				putch('-', putdat);
+  80097f:	83 ec 08             	sub    $0x8,%esp
+  800982:	53                   	push   %ebx
+  800983:	6a 2d                	push   $0x2d
+  800985:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800987:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80098a:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80098d:	f7 da                	neg    %edx
+  80098f:	83 d1 00             	adc    $0x0,%ecx
+  800992:	f7 d9                	neg    %ecx
+  800994:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800997:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80099c:	e9 ac 00 00 00       	jmp    800a4d <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  8009a1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009a4:	8b 00                	mov    (%eax),%eax
+  8009a6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8009a9:	89 c1                	mov    %eax,%ecx
+  8009ab:	c1 f9 1f             	sar    $0x1f,%ecx
+  8009ae:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8009b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009b4:	8d 40 04             	lea    0x4(%eax),%eax
+  8009b7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009ba:	eb b0                	jmp    80096c <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8009bc:	83 f9 01             	cmp    $0x1,%ecx
+  8009bf:	7f 1b                	jg     8009dc <vprintfmt+0x316>
+	else if (lflag)
+  8009c1:	85 c9                	test   %ecx,%ecx
+  8009c3:	74 2c                	je     8009f1 <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  8009c5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009c8:	8b 10                	mov    (%eax),%edx
+  8009ca:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009cf:	8d 40 04             	lea    0x4(%eax),%eax
+  8009d2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8009d5:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8009da:	eb 71                	jmp    800a4d <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  8009dc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009df:	8b 10                	mov    (%eax),%edx
+  8009e1:	8b 48 04             	mov    0x4(%eax),%ecx
+  8009e4:	8d 40 08             	lea    0x8(%eax),%eax
+  8009e7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8009ea:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8009ef:	eb 5c                	jmp    800a4d <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  8009f1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009f4:	8b 10                	mov    (%eax),%edx
+  8009f6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009fb:	8d 40 04             	lea    0x4(%eax),%eax
+  8009fe:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800a01:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800a06:	eb 45                	jmp    800a4d <vprintfmt+0x387>
+			putch('X', putdat);
+  800a08:	83 ec 08             	sub    $0x8,%esp
+  800a0b:	53                   	push   %ebx
+  800a0c:	6a 58                	push   $0x58
+  800a0e:	ff d6                	call   *%esi
+			putch('X', putdat);
+  800a10:	83 c4 08             	add    $0x8,%esp
+  800a13:	53                   	push   %ebx
+  800a14:	6a 58                	push   $0x58
+  800a16:	ff d6                	call   *%esi
+			putch('X', putdat);
+  800a18:	83 c4 08             	add    $0x8,%esp
+  800a1b:	53                   	push   %ebx
+  800a1c:	6a 58                	push   $0x58
+  800a1e:	ff d6                	call   *%esi
+			break;
+  800a20:	83 c4 10             	add    $0x10,%esp
+  800a23:	eb 42                	jmp    800a67 <vprintfmt+0x3a1>
+			putch('0', putdat);
+  800a25:	83 ec 08             	sub    $0x8,%esp
+  800a28:	53                   	push   %ebx
+  800a29:	6a 30                	push   $0x30
+  800a2b:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800a2d:	83 c4 08             	add    $0x8,%esp
+  800a30:	53                   	push   %ebx
+  800a31:	6a 78                	push   $0x78
+  800a33:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800a35:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a38:	8b 10                	mov    (%eax),%edx
+  800a3a:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800a3f:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800a42:	8d 40 04             	lea    0x4(%eax),%eax
+  800a45:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a48:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800a4d:	83 ec 0c             	sub    $0xc,%esp
+  800a50:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800a54:	50                   	push   %eax
+  800a55:	ff 75 e0             	push   -0x20(%ebp)
+  800a58:	57                   	push   %edi
+  800a59:	51                   	push   %ecx
+  800a5a:	52                   	push   %edx
+  800a5b:	89 da                	mov    %ebx,%edx
+  800a5d:	89 f0                	mov    %esi,%eax
+  800a5f:	e8 7f fb ff ff       	call   8005e3 <printnum>
+			break;
+  800a64:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800a67:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800a6a:	e9 75 fc ff ff       	jmp    8006e4 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800a6f:	83 f9 01             	cmp    $0x1,%ecx
+  800a72:	7f 1b                	jg     800a8f <vprintfmt+0x3c9>
+	else if (lflag)
+  800a74:	85 c9                	test   %ecx,%ecx
+  800a76:	74 2c                	je     800aa4 <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  800a78:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a7b:	8b 10                	mov    (%eax),%edx
+  800a7d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a82:	8d 40 04             	lea    0x4(%eax),%eax
+  800a85:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a88:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800a8d:	eb be                	jmp    800a4d <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  800a8f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a92:	8b 10                	mov    (%eax),%edx
+  800a94:	8b 48 04             	mov    0x4(%eax),%ecx
+  800a97:	8d 40 08             	lea    0x8(%eax),%eax
+  800a9a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a9d:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800aa2:	eb a9                	jmp    800a4d <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  800aa4:	8b 45 14             	mov    0x14(%ebp),%eax
+  800aa7:	8b 10                	mov    (%eax),%edx
+  800aa9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800aae:	8d 40 04             	lea    0x4(%eax),%eax
+  800ab1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800ab4:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800ab9:	eb 92                	jmp    800a4d <vprintfmt+0x387>
+			putch(ch, putdat);
+  800abb:	83 ec 08             	sub    $0x8,%esp
+  800abe:	53                   	push   %ebx
+  800abf:	6a 25                	push   $0x25
+  800ac1:	ff d6                	call   *%esi
+			break;
+  800ac3:	83 c4 10             	add    $0x10,%esp
+  800ac6:	eb 9f                	jmp    800a67 <vprintfmt+0x3a1>
+			putch('%', putdat);
+  800ac8:	83 ec 08             	sub    $0x8,%esp
+  800acb:	53                   	push   %ebx
+  800acc:	6a 25                	push   $0x25
+  800ace:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800ad0:	83 c4 10             	add    $0x10,%esp
+  800ad3:	89 f8                	mov    %edi,%eax
+  800ad5:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800ad9:	74 05                	je     800ae0 <vprintfmt+0x41a>
+  800adb:	83 e8 01             	sub    $0x1,%eax
+  800ade:	eb f5                	jmp    800ad5 <vprintfmt+0x40f>
+  800ae0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800ae3:	eb 82                	jmp    800a67 <vprintfmt+0x3a1>
+
+00800ae5 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800ae5:	55                   	push   %ebp
+  800ae6:	89 e5                	mov    %esp,%ebp
+  800ae8:	83 ec 18             	sub    $0x18,%esp
+  800aeb:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aee:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800af1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800af4:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800af8:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800afb:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800b02:	85 c0                	test   %eax,%eax
+  800b04:	74 26                	je     800b2c <vsnprintf+0x47>
+  800b06:	85 d2                	test   %edx,%edx
+  800b08:	7e 22                	jle    800b2c <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800b0a:	ff 75 14             	push   0x14(%ebp)
+  800b0d:	ff 75 10             	push   0x10(%ebp)
+  800b10:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800b13:	50                   	push   %eax
+  800b14:	68 8c 06 80 00       	push   $0x80068c
+  800b19:	e8 a8 fb ff ff       	call   8006c6 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800b1e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800b21:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800b24:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b27:	83 c4 10             	add    $0x10,%esp
+}
+  800b2a:	c9                   	leave
+  800b2b:	c3                   	ret
+		return -E_INVAL;
+  800b2c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b31:	eb f7                	jmp    800b2a <vsnprintf+0x45>
+
+00800b33 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800b33:	55                   	push   %ebp
+  800b34:	89 e5                	mov    %esp,%ebp
+  800b36:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800b39:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800b3c:	50                   	push   %eax
+  800b3d:	ff 75 10             	push   0x10(%ebp)
+  800b40:	ff 75 0c             	push   0xc(%ebp)
+  800b43:	ff 75 08             	push   0x8(%ebp)
+  800b46:	e8 9a ff ff ff       	call   800ae5 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800b4b:	c9                   	leave
+  800b4c:	c3                   	ret
+
+00800b4d <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800b4d:	55                   	push   %ebp
+  800b4e:	89 e5                	mov    %esp,%ebp
+  800b50:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800b53:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b58:	eb 03                	jmp    800b5d <strlen+0x10>
+		n++;
+  800b5a:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800b5d:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800b61:	75 f7                	jne    800b5a <strlen+0xd>
+	return n;
+}
+  800b63:	5d                   	pop    %ebp
+  800b64:	c3                   	ret
+
+00800b65 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800b65:	55                   	push   %ebp
+  800b66:	89 e5                	mov    %esp,%ebp
+  800b68:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b6b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b73:	eb 03                	jmp    800b78 <strnlen+0x13>
+		n++;
+  800b75:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b78:	39 d0                	cmp    %edx,%eax
+  800b7a:	74 08                	je     800b84 <strnlen+0x1f>
+  800b7c:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800b80:	75 f3                	jne    800b75 <strnlen+0x10>
+  800b82:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800b84:	89 d0                	mov    %edx,%eax
+  800b86:	5d                   	pop    %ebp
+  800b87:	c3                   	ret
+
+00800b88 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800b88:	55                   	push   %ebp
+  800b89:	89 e5                	mov    %esp,%ebp
+  800b8b:	53                   	push   %ebx
+  800b8c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b8f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800b92:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b97:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800b9b:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800b9e:	83 c0 01             	add    $0x1,%eax
+  800ba1:	84 d2                	test   %dl,%dl
+  800ba3:	75 f2                	jne    800b97 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800ba5:	89 c8                	mov    %ecx,%eax
+  800ba7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800baa:	c9                   	leave
+  800bab:	c3                   	ret
+
+00800bac <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800bac:	55                   	push   %ebp
+  800bad:	89 e5                	mov    %esp,%ebp
+  800baf:	53                   	push   %ebx
+  800bb0:	83 ec 10             	sub    $0x10,%esp
+  800bb3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800bb6:	53                   	push   %ebx
+  800bb7:	e8 91 ff ff ff       	call   800b4d <strlen>
+  800bbc:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800bbf:	ff 75 0c             	push   0xc(%ebp)
+  800bc2:	01 d8                	add    %ebx,%eax
+  800bc4:	50                   	push   %eax
+  800bc5:	e8 be ff ff ff       	call   800b88 <strcpy>
+	return dst;
+}
+  800bca:	89 d8                	mov    %ebx,%eax
+  800bcc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bcf:	c9                   	leave
+  800bd0:	c3                   	ret
+
+00800bd1 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800bd1:	55                   	push   %ebp
+  800bd2:	89 e5                	mov    %esp,%ebp
+  800bd4:	56                   	push   %esi
+  800bd5:	53                   	push   %ebx
+  800bd6:	8b 75 08             	mov    0x8(%ebp),%esi
+  800bd9:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800bdc:	89 f3                	mov    %esi,%ebx
+  800bde:	03 5d 10             	add    0x10(%ebp),%ebx
+  800be1:	89 f0                	mov    %esi,%eax
+  800be3:	eb 0f                	jmp    800bf4 <strncpy+0x23>
+		*dst++ = *src;
+  800be5:	83 c0 01             	add    $0x1,%eax
+  800be8:	0f b6 0a             	movzbl (%edx),%ecx
+  800beb:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800bee:	80 f9 01             	cmp    $0x1,%cl
+  800bf1:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800bf4:	39 d8                	cmp    %ebx,%eax
+  800bf6:	75 ed                	jne    800be5 <strncpy+0x14>
+	}
+	return ret;
+}
+  800bf8:	89 f0                	mov    %esi,%eax
+  800bfa:	5b                   	pop    %ebx
+  800bfb:	5e                   	pop    %esi
+  800bfc:	5d                   	pop    %ebp
+  800bfd:	c3                   	ret
+
+00800bfe <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800bfe:	55                   	push   %ebp
+  800bff:	89 e5                	mov    %esp,%ebp
+  800c01:	56                   	push   %esi
+  800c02:	53                   	push   %ebx
+  800c03:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c06:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c09:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800c0c:	89 f0                	mov    %esi,%eax
+  800c0e:	85 d2                	test   %edx,%edx
+  800c10:	74 21                	je     800c33 <strlcpy+0x35>
+  800c12:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800c16:	89 f2                	mov    %esi,%edx
+  800c18:	eb 09                	jmp    800c23 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800c1a:	83 c1 01             	add    $0x1,%ecx
+  800c1d:	83 c2 01             	add    $0x1,%edx
+  800c20:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800c23:	39 c2                	cmp    %eax,%edx
+  800c25:	74 09                	je     800c30 <strlcpy+0x32>
+  800c27:	0f b6 19             	movzbl (%ecx),%ebx
+  800c2a:	84 db                	test   %bl,%bl
+  800c2c:	75 ec                	jne    800c1a <strlcpy+0x1c>
+  800c2e:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800c30:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800c33:	29 f0                	sub    %esi,%eax
+}
+  800c35:	5b                   	pop    %ebx
+  800c36:	5e                   	pop    %esi
+  800c37:	5d                   	pop    %ebp
+  800c38:	c3                   	ret
+
+00800c39 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800c39:	55                   	push   %ebp
+  800c3a:	89 e5                	mov    %esp,%ebp
+  800c3c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c3f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800c42:	eb 06                	jmp    800c4a <strcmp+0x11>
+		p++, q++;
+  800c44:	83 c1 01             	add    $0x1,%ecx
+  800c47:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800c4a:	0f b6 01             	movzbl (%ecx),%eax
+  800c4d:	84 c0                	test   %al,%al
+  800c4f:	74 04                	je     800c55 <strcmp+0x1c>
+  800c51:	3a 02                	cmp    (%edx),%al
+  800c53:	74 ef                	je     800c44 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800c55:	0f b6 c0             	movzbl %al,%eax
+  800c58:	0f b6 12             	movzbl (%edx),%edx
+  800c5b:	29 d0                	sub    %edx,%eax
+}
+  800c5d:	5d                   	pop    %ebp
+  800c5e:	c3                   	ret
+
+00800c5f <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800c5f:	55                   	push   %ebp
+  800c60:	89 e5                	mov    %esp,%ebp
+  800c62:	53                   	push   %ebx
+  800c63:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c66:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c69:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800c6c:	eb 09                	jmp    800c77 <strncmp+0x18>
+		n--, p++, q++;
+  800c6e:	83 ea 01             	sub    $0x1,%edx
+  800c71:	83 c0 01             	add    $0x1,%eax
+  800c74:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800c77:	85 d2                	test   %edx,%edx
+  800c79:	74 18                	je     800c93 <strncmp+0x34>
+  800c7b:	0f b6 18             	movzbl (%eax),%ebx
+  800c7e:	84 db                	test   %bl,%bl
+  800c80:	74 04                	je     800c86 <strncmp+0x27>
+  800c82:	3a 19                	cmp    (%ecx),%bl
+  800c84:	74 e8                	je     800c6e <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800c86:	0f b6 00             	movzbl (%eax),%eax
+  800c89:	0f b6 11             	movzbl (%ecx),%edx
+  800c8c:	29 d0                	sub    %edx,%eax
+}
+  800c8e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c91:	c9                   	leave
+  800c92:	c3                   	ret
+		return 0;
+  800c93:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c98:	eb f4                	jmp    800c8e <strncmp+0x2f>
+
+00800c9a <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800c9a:	55                   	push   %ebp
+  800c9b:	89 e5                	mov    %esp,%ebp
+  800c9d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ca0:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800ca4:	eb 03                	jmp    800ca9 <strchr+0xf>
+  800ca6:	83 c0 01             	add    $0x1,%eax
+  800ca9:	0f b6 10             	movzbl (%eax),%edx
+  800cac:	84 d2                	test   %dl,%dl
+  800cae:	74 06                	je     800cb6 <strchr+0x1c>
+		if (*s == c)
+  800cb0:	38 ca                	cmp    %cl,%dl
+  800cb2:	75 f2                	jne    800ca6 <strchr+0xc>
+  800cb4:	eb 05                	jmp    800cbb <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800cb6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800cbb:	5d                   	pop    %ebp
+  800cbc:	c3                   	ret
+
+00800cbd <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800cbd:	55                   	push   %ebp
+  800cbe:	89 e5                	mov    %esp,%ebp
+  800cc0:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cc3:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800cc7:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800cca:	38 ca                	cmp    %cl,%dl
+  800ccc:	74 09                	je     800cd7 <strfind+0x1a>
+  800cce:	84 d2                	test   %dl,%dl
+  800cd0:	74 05                	je     800cd7 <strfind+0x1a>
+	for (; *s; s++)
+  800cd2:	83 c0 01             	add    $0x1,%eax
+  800cd5:	eb f0                	jmp    800cc7 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800cd7:	5d                   	pop    %ebp
+  800cd8:	c3                   	ret
+
+00800cd9 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800cd9:	55                   	push   %ebp
+  800cda:	89 e5                	mov    %esp,%ebp
+  800cdc:	57                   	push   %edi
+  800cdd:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800ce0:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800ce3:	85 c9                	test   %ecx,%ecx
+  800ce5:	74 20                	je     800d07 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800ce7:	89 f8                	mov    %edi,%eax
+  800ce9:	09 c8                	or     %ecx,%eax
+  800ceb:	a8 03                	test   $0x3,%al
+  800ced:	75 12                	jne    800d01 <memset+0x28>
+		c &= 0xFF;
+  800cef:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800cf3:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800cf9:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800cfc:	fc                   	cld
+  800cfd:	f3 ab                	rep stos %eax,%es:(%edi)
+  800cff:	eb 06                	jmp    800d07 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800d01:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d04:	fc                   	cld
+  800d05:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800d07:	89 f8                	mov    %edi,%eax
+  800d09:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800d0c:	c9                   	leave
+  800d0d:	c3                   	ret
+
+00800d0e <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800d0e:	55                   	push   %ebp
+  800d0f:	89 e5                	mov    %esp,%ebp
+  800d11:	57                   	push   %edi
+  800d12:	56                   	push   %esi
+  800d13:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d16:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800d19:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800d1c:	39 c6                	cmp    %eax,%esi
+  800d1e:	73 32                	jae    800d52 <memmove+0x44>
+  800d20:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800d23:	39 d0                	cmp    %edx,%eax
+  800d25:	73 2b                	jae    800d52 <memmove+0x44>
+		s += n;
+		d += n;
+  800d27:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d2a:	89 d6                	mov    %edx,%esi
+  800d2c:	09 fe                	or     %edi,%esi
+  800d2e:	09 ce                	or     %ecx,%esi
+  800d30:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800d36:	75 0e                	jne    800d46 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800d38:	83 ef 04             	sub    $0x4,%edi
+  800d3b:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800d3e:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800d41:	fd                   	std
+  800d42:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d44:	eb 09                	jmp    800d4f <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800d46:	83 ef 01             	sub    $0x1,%edi
+  800d49:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800d4c:	fd                   	std
+  800d4d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800d4f:	fc                   	cld
+  800d50:	eb 1a                	jmp    800d6c <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d52:	89 f2                	mov    %esi,%edx
+  800d54:	09 c2                	or     %eax,%edx
+  800d56:	09 ca                	or     %ecx,%edx
+  800d58:	f6 c2 03             	test   $0x3,%dl
+  800d5b:	75 0a                	jne    800d67 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800d5d:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800d60:	89 c7                	mov    %eax,%edi
+  800d62:	fc                   	cld
+  800d63:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d65:	eb 05                	jmp    800d6c <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800d67:	89 c7                	mov    %eax,%edi
+  800d69:	fc                   	cld
+  800d6a:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800d6c:	5e                   	pop    %esi
+  800d6d:	5f                   	pop    %edi
+  800d6e:	5d                   	pop    %ebp
+  800d6f:	c3                   	ret
+
+00800d70 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800d70:	55                   	push   %ebp
+  800d71:	89 e5                	mov    %esp,%ebp
+  800d73:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800d76:	ff 75 10             	push   0x10(%ebp)
+  800d79:	ff 75 0c             	push   0xc(%ebp)
+  800d7c:	ff 75 08             	push   0x8(%ebp)
+  800d7f:	e8 8a ff ff ff       	call   800d0e <memmove>
+}
+  800d84:	c9                   	leave
+  800d85:	c3                   	ret
+
+00800d86 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800d86:	55                   	push   %ebp
+  800d87:	89 e5                	mov    %esp,%ebp
+  800d89:	56                   	push   %esi
+  800d8a:	53                   	push   %ebx
+  800d8b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d8e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800d91:	89 c6                	mov    %eax,%esi
+  800d93:	03 75 10             	add    0x10(%ebp),%esi
+  800d96:	eb 06                	jmp    800d9e <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800d98:	83 c0 01             	add    $0x1,%eax
+  800d9b:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800d9e:	39 f0                	cmp    %esi,%eax
+  800da0:	74 14                	je     800db6 <memcmp+0x30>
+		if (*s1 != *s2)
+  800da2:	0f b6 08             	movzbl (%eax),%ecx
+  800da5:	0f b6 1a             	movzbl (%edx),%ebx
+  800da8:	38 d9                	cmp    %bl,%cl
+  800daa:	74 ec                	je     800d98 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800dac:	0f b6 c1             	movzbl %cl,%eax
+  800daf:	0f b6 db             	movzbl %bl,%ebx
+  800db2:	29 d8                	sub    %ebx,%eax
+  800db4:	eb 05                	jmp    800dbb <memcmp+0x35>
+	}
+
+	return 0;
+  800db6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800dbb:	5b                   	pop    %ebx
+  800dbc:	5e                   	pop    %esi
+  800dbd:	5d                   	pop    %ebp
+  800dbe:	c3                   	ret
+
+00800dbf <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800dbf:	55                   	push   %ebp
+  800dc0:	89 e5                	mov    %esp,%ebp
+  800dc2:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dc5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800dc8:	89 c2                	mov    %eax,%edx
+  800dca:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800dcd:	eb 03                	jmp    800dd2 <memfind+0x13>
+  800dcf:	83 c0 01             	add    $0x1,%eax
+  800dd2:	39 d0                	cmp    %edx,%eax
+  800dd4:	73 04                	jae    800dda <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800dd6:	38 08                	cmp    %cl,(%eax)
+  800dd8:	75 f5                	jne    800dcf <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800dda:	5d                   	pop    %ebp
+  800ddb:	c3                   	ret
+
+00800ddc <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800ddc:	55                   	push   %ebp
+  800ddd:	89 e5                	mov    %esp,%ebp
+  800ddf:	57                   	push   %edi
+  800de0:	56                   	push   %esi
+  800de1:	53                   	push   %ebx
+  800de2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800de5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800de8:	eb 03                	jmp    800ded <strtol+0x11>
+		s++;
+  800dea:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800ded:	0f b6 02             	movzbl (%edx),%eax
+  800df0:	3c 20                	cmp    $0x20,%al
+  800df2:	74 f6                	je     800dea <strtol+0xe>
+  800df4:	3c 09                	cmp    $0x9,%al
+  800df6:	74 f2                	je     800dea <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800df8:	3c 2b                	cmp    $0x2b,%al
+  800dfa:	74 2a                	je     800e26 <strtol+0x4a>
+	int neg = 0;
+  800dfc:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800e01:	3c 2d                	cmp    $0x2d,%al
+  800e03:	74 2b                	je     800e30 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e05:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800e0b:	75 0f                	jne    800e1c <strtol+0x40>
+  800e0d:	80 3a 30             	cmpb   $0x30,(%edx)
+  800e10:	74 28                	je     800e3a <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800e12:	85 db                	test   %ebx,%ebx
+  800e14:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e19:	0f 44 d8             	cmove  %eax,%ebx
+  800e1c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e21:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800e24:	eb 46                	jmp    800e6c <strtol+0x90>
+		s++;
+  800e26:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800e29:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e2e:	eb d5                	jmp    800e05 <strtol+0x29>
+		s++, neg = 1;
+  800e30:	83 c2 01             	add    $0x1,%edx
+  800e33:	bf 01 00 00 00       	mov    $0x1,%edi
+  800e38:	eb cb                	jmp    800e05 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e3a:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800e3e:	74 0e                	je     800e4e <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800e40:	85 db                	test   %ebx,%ebx
+  800e42:	75 d8                	jne    800e1c <strtol+0x40>
+		s++, base = 8;
+  800e44:	83 c2 01             	add    $0x1,%edx
+  800e47:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800e4c:	eb ce                	jmp    800e1c <strtol+0x40>
+		s += 2, base = 16;
+  800e4e:	83 c2 02             	add    $0x2,%edx
+  800e51:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800e56:	eb c4                	jmp    800e1c <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800e58:	0f be c0             	movsbl %al,%eax
+  800e5b:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800e5e:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800e61:	7d 3a                	jge    800e9d <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800e63:	83 c2 01             	add    $0x1,%edx
+  800e66:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800e6a:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800e6c:	0f b6 02             	movzbl (%edx),%eax
+  800e6f:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800e72:	89 f3                	mov    %esi,%ebx
+  800e74:	80 fb 09             	cmp    $0x9,%bl
+  800e77:	76 df                	jbe    800e58 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800e79:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800e7c:	89 f3                	mov    %esi,%ebx
+  800e7e:	80 fb 19             	cmp    $0x19,%bl
+  800e81:	77 08                	ja     800e8b <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800e83:	0f be c0             	movsbl %al,%eax
+  800e86:	83 e8 57             	sub    $0x57,%eax
+  800e89:	eb d3                	jmp    800e5e <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800e8b:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800e8e:	89 f3                	mov    %esi,%ebx
+  800e90:	80 fb 19             	cmp    $0x19,%bl
+  800e93:	77 08                	ja     800e9d <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800e95:	0f be c0             	movsbl %al,%eax
+  800e98:	83 e8 37             	sub    $0x37,%eax
+  800e9b:	eb c1                	jmp    800e5e <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800e9d:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800ea1:	74 05                	je     800ea8 <strtol+0xcc>
+		*endptr = (char *) s;
+  800ea3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ea6:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800ea8:	89 c8                	mov    %ecx,%eax
+  800eaa:	f7 d8                	neg    %eax
+  800eac:	85 ff                	test   %edi,%edi
+  800eae:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800eb1:	89 c8                	mov    %ecx,%eax
+  800eb3:	5b                   	pop    %ebx
+  800eb4:	5e                   	pop    %esi
+  800eb5:	5f                   	pop    %edi
+  800eb6:	5d                   	pop    %ebp
+  800eb7:	c3                   	ret
+
+00800eb8 <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800eb8:	55                   	push   %ebp
+  800eb9:	89 e5                	mov    %esp,%ebp
+  800ebb:	57                   	push   %edi
+  800ebc:	56                   	push   %esi
+  800ebd:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800ebe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ec3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec9:	89 c3                	mov    %eax,%ebx
+  800ecb:	89 c7                	mov    %eax,%edi
+  800ecd:	89 c6                	mov    %eax,%esi
+  800ecf:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  800ed1:	5b                   	pop    %ebx
+  800ed2:	5e                   	pop    %esi
+  800ed3:	5f                   	pop    %edi
+  800ed4:	5d                   	pop    %ebp
+  800ed5:	c3                   	ret
+
+00800ed6 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800ed6:	55                   	push   %ebp
+  800ed7:	89 e5                	mov    %esp,%ebp
+  800ed9:	57                   	push   %edi
+  800eda:	56                   	push   %esi
+  800edb:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800edc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ee1:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ee6:	89 d1                	mov    %edx,%ecx
+  800ee8:	89 d3                	mov    %edx,%ebx
+  800eea:	89 d7                	mov    %edx,%edi
+  800eec:	89 d6                	mov    %edx,%esi
+  800eee:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800ef0:	5b                   	pop    %ebx
+  800ef1:	5e                   	pop    %esi
+  800ef2:	5f                   	pop    %edi
+  800ef3:	5d                   	pop    %ebp
+  800ef4:	c3                   	ret
+
+00800ef5 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800ef5:	55                   	push   %ebp
+  800ef6:	89 e5                	mov    %esp,%ebp
+  800ef8:	57                   	push   %edi
+  800ef9:	56                   	push   %esi
+  800efa:	53                   	push   %ebx
+  800efb:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800efe:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f03:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f06:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f0b:	89 cb                	mov    %ecx,%ebx
+  800f0d:	89 cf                	mov    %ecx,%edi
+  800f0f:	89 ce                	mov    %ecx,%esi
+  800f11:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f13:	85 c0                	test   %eax,%eax
+  800f15:	7f 08                	jg     800f1f <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800f17:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f1a:	5b                   	pop    %ebx
+  800f1b:	5e                   	pop    %esi
+  800f1c:	5f                   	pop    %edi
+  800f1d:	5d                   	pop    %ebp
+  800f1e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f1f:	83 ec 0c             	sub    $0xc,%esp
+  800f22:	50                   	push   %eax
+  800f23:	6a 03                	push   $0x3
+  800f25:	68 c3 2d 80 00       	push   $0x802dc3
+  800f2a:	6a 3e                	push   $0x3e
+  800f2c:	68 e0 2d 80 00       	push   $0x802de0
+  800f31:	e8 22 14 00 00       	call   802358 <_panic>
+
+00800f36 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800f36:	55                   	push   %ebp
+  800f37:	89 e5                	mov    %esp,%ebp
+  800f39:	57                   	push   %edi
+  800f3a:	56                   	push   %esi
+  800f3b:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800f3c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f41:	b8 02 00 00 00       	mov    $0x2,%eax
+  800f46:	89 d1                	mov    %edx,%ecx
+  800f48:	89 d3                	mov    %edx,%ebx
+  800f4a:	89 d7                	mov    %edx,%edi
+  800f4c:	89 d6                	mov    %edx,%esi
+  800f4e:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800f50:	5b                   	pop    %ebx
+  800f51:	5e                   	pop    %esi
+  800f52:	5f                   	pop    %edi
+  800f53:	5d                   	pop    %ebp
+  800f54:	c3                   	ret
+
+00800f55 <sys_yield>:
+
+void
+sys_yield(void) {
+  800f55:	55                   	push   %ebp
+  800f56:	89 e5                	mov    %esp,%ebp
+  800f58:	57                   	push   %edi
+  800f59:	56                   	push   %esi
+  800f5a:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800f5b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f60:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800f65:	89 d1                	mov    %edx,%ecx
+  800f67:	89 d3                	mov    %edx,%ebx
+  800f69:	89 d7                	mov    %edx,%edi
+  800f6b:	89 d6                	mov    %edx,%esi
+  800f6d:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800f6f:	5b                   	pop    %ebx
+  800f70:	5e                   	pop    %esi
+  800f71:	5f                   	pop    %edi
+  800f72:	5d                   	pop    %ebp
+  800f73:	c3                   	ret
+
+00800f74 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  800f74:	55                   	push   %ebp
+  800f75:	89 e5                	mov    %esp,%ebp
+  800f77:	57                   	push   %edi
+  800f78:	56                   	push   %esi
+  800f79:	53                   	push   %ebx
+  800f7a:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800f7d:	be 00 00 00 00       	mov    $0x0,%esi
+  800f82:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f85:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f88:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f8d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f90:	89 f7                	mov    %esi,%edi
+  800f92:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f94:	85 c0                	test   %eax,%eax
+  800f96:	7f 08                	jg     800fa0 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800f98:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f9b:	5b                   	pop    %ebx
+  800f9c:	5e                   	pop    %esi
+  800f9d:	5f                   	pop    %edi
+  800f9e:	5d                   	pop    %ebp
+  800f9f:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800fa0:	83 ec 0c             	sub    $0xc,%esp
+  800fa3:	50                   	push   %eax
+  800fa4:	6a 04                	push   $0x4
+  800fa6:	68 c3 2d 80 00       	push   $0x802dc3
+  800fab:	6a 3e                	push   $0x3e
+  800fad:	68 e0 2d 80 00       	push   $0x802de0
+  800fb2:	e8 a1 13 00 00       	call   802358 <_panic>
+
+00800fb7 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  800fb7:	55                   	push   %ebp
+  800fb8:	89 e5                	mov    %esp,%ebp
+  800fba:	57                   	push   %edi
+  800fbb:	56                   	push   %esi
+  800fbc:	53                   	push   %ebx
+  800fbd:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800fc0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fc6:	b8 05 00 00 00       	mov    $0x5,%eax
+  800fcb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fce:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fd1:	8b 75 18             	mov    0x18(%ebp),%esi
+  800fd4:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800fd6:	85 c0                	test   %eax,%eax
+  800fd8:	7f 08                	jg     800fe2 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800fda:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fdd:	5b                   	pop    %ebx
+  800fde:	5e                   	pop    %esi
+  800fdf:	5f                   	pop    %edi
+  800fe0:	5d                   	pop    %ebp
+  800fe1:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800fe2:	83 ec 0c             	sub    $0xc,%esp
+  800fe5:	50                   	push   %eax
+  800fe6:	6a 05                	push   $0x5
+  800fe8:	68 c3 2d 80 00       	push   $0x802dc3
+  800fed:	6a 3e                	push   $0x3e
+  800fef:	68 e0 2d 80 00       	push   $0x802de0
+  800ff4:	e8 5f 13 00 00       	call   802358 <_panic>
+
+00800ff9 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  800ff9:	55                   	push   %ebp
+  800ffa:	89 e5                	mov    %esp,%ebp
+  800ffc:	57                   	push   %edi
+  800ffd:	56                   	push   %esi
+  800ffe:	53                   	push   %ebx
+  800fff:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  801002:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801007:	8b 55 08             	mov    0x8(%ebp),%edx
+  80100a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80100d:	b8 06 00 00 00       	mov    $0x6,%eax
+  801012:	89 df                	mov    %ebx,%edi
+  801014:	89 de                	mov    %ebx,%esi
+  801016:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801018:	85 c0                	test   %eax,%eax
+  80101a:	7f 08                	jg     801024 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  80101c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80101f:	5b                   	pop    %ebx
+  801020:	5e                   	pop    %esi
+  801021:	5f                   	pop    %edi
+  801022:	5d                   	pop    %ebp
+  801023:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801024:	83 ec 0c             	sub    $0xc,%esp
+  801027:	50                   	push   %eax
+  801028:	6a 06                	push   $0x6
+  80102a:	68 c3 2d 80 00       	push   $0x802dc3
+  80102f:	6a 3e                	push   $0x3e
+  801031:	68 e0 2d 80 00       	push   $0x802de0
+  801036:	e8 1d 13 00 00       	call   802358 <_panic>
+
+0080103b <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80103b:	55                   	push   %ebp
+  80103c:	89 e5                	mov    %esp,%ebp
+  80103e:	57                   	push   %edi
+  80103f:	56                   	push   %esi
+  801040:	53                   	push   %ebx
+  801041:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  801044:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801049:	8b 55 08             	mov    0x8(%ebp),%edx
+  80104c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80104f:	b8 08 00 00 00       	mov    $0x8,%eax
+  801054:	89 df                	mov    %ebx,%edi
+  801056:	89 de                	mov    %ebx,%esi
+  801058:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80105a:	85 c0                	test   %eax,%eax
+  80105c:	7f 08                	jg     801066 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  80105e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801061:	5b                   	pop    %ebx
+  801062:	5e                   	pop    %esi
+  801063:	5f                   	pop    %edi
+  801064:	5d                   	pop    %ebp
+  801065:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801066:	83 ec 0c             	sub    $0xc,%esp
+  801069:	50                   	push   %eax
+  80106a:	6a 08                	push   $0x8
+  80106c:	68 c3 2d 80 00       	push   $0x802dc3
+  801071:	6a 3e                	push   $0x3e
+  801073:	68 e0 2d 80 00       	push   $0x802de0
+  801078:	e8 db 12 00 00       	call   802358 <_panic>
+
+0080107d <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80107d:	55                   	push   %ebp
+  80107e:	89 e5                	mov    %esp,%ebp
+  801080:	57                   	push   %edi
+  801081:	56                   	push   %esi
+  801082:	53                   	push   %ebx
+  801083:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  801086:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80108b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80108e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801091:	b8 09 00 00 00       	mov    $0x9,%eax
+  801096:	89 df                	mov    %ebx,%edi
+  801098:	89 de                	mov    %ebx,%esi
+  80109a:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80109c:	85 c0                	test   %eax,%eax
+  80109e:	7f 08                	jg     8010a8 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8010a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010a3:	5b                   	pop    %ebx
+  8010a4:	5e                   	pop    %esi
+  8010a5:	5f                   	pop    %edi
+  8010a6:	5d                   	pop    %ebp
+  8010a7:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8010a8:	83 ec 0c             	sub    $0xc,%esp
+  8010ab:	50                   	push   %eax
+  8010ac:	6a 09                	push   $0x9
+  8010ae:	68 c3 2d 80 00       	push   $0x802dc3
+  8010b3:	6a 3e                	push   $0x3e
+  8010b5:	68 e0 2d 80 00       	push   $0x802de0
+  8010ba:	e8 99 12 00 00       	call   802358 <_panic>
+
+008010bf <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8010bf:	55                   	push   %ebp
+  8010c0:	89 e5                	mov    %esp,%ebp
+  8010c2:	57                   	push   %edi
+  8010c3:	56                   	push   %esi
+  8010c4:	53                   	push   %ebx
+  8010c5:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8010c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010cd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010d3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010d8:	89 df                	mov    %ebx,%edi
+  8010da:	89 de                	mov    %ebx,%esi
+  8010dc:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8010de:	85 c0                	test   %eax,%eax
+  8010e0:	7f 08                	jg     8010ea <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8010e2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010e5:	5b                   	pop    %ebx
+  8010e6:	5e                   	pop    %esi
+  8010e7:	5f                   	pop    %edi
+  8010e8:	5d                   	pop    %ebp
+  8010e9:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8010ea:	83 ec 0c             	sub    $0xc,%esp
+  8010ed:	50                   	push   %eax
+  8010ee:	6a 0a                	push   $0xa
+  8010f0:	68 c3 2d 80 00       	push   $0x802dc3
+  8010f5:	6a 3e                	push   $0x3e
+  8010f7:	68 e0 2d 80 00       	push   $0x802de0
+  8010fc:	e8 57 12 00 00       	call   802358 <_panic>
+
+00801101 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  801101:	55                   	push   %ebp
+  801102:	89 e5                	mov    %esp,%ebp
+  801104:	57                   	push   %edi
+  801105:	56                   	push   %esi
+  801106:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  801107:	8b 55 08             	mov    0x8(%ebp),%edx
+  80110a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80110d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801112:	be 00 00 00 00       	mov    $0x0,%esi
+  801117:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80111a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80111d:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  80111f:	5b                   	pop    %ebx
+  801120:	5e                   	pop    %esi
+  801121:	5f                   	pop    %edi
+  801122:	5d                   	pop    %ebp
+  801123:	c3                   	ret
+
+00801124 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  801124:	55                   	push   %ebp
+  801125:	89 e5                	mov    %esp,%ebp
+  801127:	57                   	push   %edi
+  801128:	56                   	push   %esi
+  801129:	53                   	push   %ebx
+  80112a:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  80112d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801132:	8b 55 08             	mov    0x8(%ebp),%edx
+  801135:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80113a:	89 cb                	mov    %ecx,%ebx
+  80113c:	89 cf                	mov    %ecx,%edi
+  80113e:	89 ce                	mov    %ecx,%esi
+  801140:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801142:	85 c0                	test   %eax,%eax
+  801144:	7f 08                	jg     80114e <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  801146:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801149:	5b                   	pop    %ebx
+  80114a:	5e                   	pop    %esi
+  80114b:	5f                   	pop    %edi
+  80114c:	5d                   	pop    %ebp
+  80114d:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80114e:	83 ec 0c             	sub    $0xc,%esp
+  801151:	50                   	push   %eax
+  801152:	6a 0d                	push   $0xd
+  801154:	68 c3 2d 80 00       	push   $0x802dc3
+  801159:	6a 3e                	push   $0x3e
+  80115b:	68 e0 2d 80 00       	push   $0x802de0
+  801160:	e8 f3 11 00 00       	call   802358 <_panic>
+
+00801165 <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  801165:	55                   	push   %ebp
+  801166:	89 e5                	mov    %esp,%ebp
+  801168:	57                   	push   %edi
+  801169:	56                   	push   %esi
+  80116a:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80116b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801170:	8b 55 08             	mov    0x8(%ebp),%edx
+  801173:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801176:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80117b:	89 df                	mov    %ebx,%edi
+  80117d:	89 de                	mov    %ebx,%esi
+  80117f:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  801181:	5b                   	pop    %ebx
+  801182:	5e                   	pop    %esi
+  801183:	5f                   	pop    %edi
+  801184:	5d                   	pop    %ebp
+  801185:	c3                   	ret
+
+00801186 <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  801186:	55                   	push   %ebp
+  801187:	89 e5                	mov    %esp,%ebp
+  801189:	57                   	push   %edi
+  80118a:	56                   	push   %esi
+  80118b:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80118c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801191:	8b 55 08             	mov    0x8(%ebp),%edx
+  801194:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801199:	89 cb                	mov    %ecx,%ebx
+  80119b:	89 cf                	mov    %ecx,%edi
+  80119d:	89 ce                	mov    %ecx,%esi
+  80119f:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  8011a1:	5b                   	pop    %ebx
+  8011a2:	5e                   	pop    %esi
+  8011a3:	5f                   	pop    %edi
+  8011a4:	5d                   	pop    %ebp
+  8011a5:	c3                   	ret
+
+008011a6 <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  8011a6:	55                   	push   %ebp
+  8011a7:	89 e5                	mov    %esp,%ebp
+  8011a9:	57                   	push   %edi
+  8011aa:	56                   	push   %esi
+  8011ab:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8011ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011b1:	b8 10 00 00 00       	mov    $0x10,%eax
+  8011b6:	89 d1                	mov    %edx,%ecx
+  8011b8:	89 d3                	mov    %edx,%ebx
+  8011ba:	89 d7                	mov    %edx,%edi
+  8011bc:	89 d6                	mov    %edx,%esi
+  8011be:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8011c0:	5b                   	pop    %ebx
+  8011c1:	5e                   	pop    %esi
+  8011c2:	5f                   	pop    %edi
+  8011c3:	5d                   	pop    %ebp
+  8011c4:	c3                   	ret
+
+008011c5 <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  8011c5:	55                   	push   %ebp
+  8011c6:	89 e5                	mov    %esp,%ebp
+  8011c8:	57                   	push   %edi
+  8011c9:	56                   	push   %esi
+  8011ca:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8011cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d6:	b8 11 00 00 00       	mov    $0x11,%eax
+  8011db:	89 df                	mov    %ebx,%edi
+  8011dd:	89 de                	mov    %ebx,%esi
+  8011df:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  8011e1:	5b                   	pop    %ebx
+  8011e2:	5e                   	pop    %esi
+  8011e3:	5f                   	pop    %edi
+  8011e4:	5d                   	pop    %ebp
+  8011e5:	c3                   	ret
+
+008011e6 <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  8011e6:	55                   	push   %ebp
+  8011e7:	89 e5                	mov    %esp,%ebp
+  8011e9:	57                   	push   %edi
+  8011ea:	56                   	push   %esi
+  8011eb:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8011ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011f4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011f7:	b8 12 00 00 00       	mov    $0x12,%eax
+  8011fc:	89 df                	mov    %ebx,%edi
+  8011fe:	89 de                	mov    %ebx,%esi
+  801200:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  801202:	5b                   	pop    %ebx
+  801203:	5e                   	pop    %esi
+  801204:	5f                   	pop    %edi
+  801205:	5d                   	pop    %ebp
+  801206:	c3                   	ret
+
+00801207 <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  801207:	55                   	push   %ebp
+  801208:	89 e5                	mov    %esp,%ebp
+  80120a:	57                   	push   %edi
+  80120b:	56                   	push   %esi
+  80120c:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80120d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801212:	8b 55 08             	mov    0x8(%ebp),%edx
+  801215:	b8 13 00 00 00       	mov    $0x13,%eax
+  80121a:	89 cb                	mov    %ecx,%ebx
+  80121c:	89 cf                	mov    %ecx,%edi
+  80121e:	89 ce                	mov    %ecx,%esi
+  801220:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  801222:	5b                   	pop    %ebx
+  801223:	5e                   	pop    %esi
+  801224:	5f                   	pop    %edi
+  801225:	5d                   	pop    %ebp
+  801226:	c3                   	ret
+
+00801227 <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  801227:	55                   	push   %ebp
+  801228:	89 e5                	mov    %esp,%ebp
+  80122a:	57                   	push   %edi
+  80122b:	56                   	push   %esi
+  80122c:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80122d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801232:	8b 55 08             	mov    0x8(%ebp),%edx
+  801235:	b8 14 00 00 00       	mov    $0x14,%eax
+  80123a:	89 cb                	mov    %ecx,%ebx
+  80123c:	89 cf                	mov    %ecx,%edi
+  80123e:	89 ce                	mov    %ecx,%esi
+  801240:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  801242:	5b                   	pop    %ebx
+  801243:	5e                   	pop    %esi
+  801244:	5f                   	pop    %edi
+  801245:	5d                   	pop    %ebp
+  801246:	c3                   	ret
+
+00801247 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801247:	55                   	push   %ebp
+  801248:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80124a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80124d:	05 00 00 00 30       	add    $0x30000000,%eax
+  801252:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801255:	5d                   	pop    %ebp
+  801256:	c3                   	ret
+
+00801257 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801257:	55                   	push   %ebp
+  801258:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80125a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80125d:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801262:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801267:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80126c:	5d                   	pop    %ebp
+  80126d:	c3                   	ret
+
+0080126e <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80126e:	55                   	push   %ebp
+  80126f:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801271:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801276:	eb 02                	jmp    80127a <fd_alloc+0xc>
+  801278:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80127a:	89 c2                	mov    %eax,%edx
+  80127c:	c1 ea 16             	shr    $0x16,%edx
+  80127f:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801286:	f6 c2 01             	test   $0x1,%dl
+  801289:	74 2b                	je     8012b6 <fd_alloc+0x48>
+  80128b:	89 c2                	mov    %eax,%edx
+  80128d:	c1 ea 0c             	shr    $0xc,%edx
+  801290:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801297:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80129d:	f6 c1 01             	test   $0x1,%cl
+  8012a0:	74 14                	je     8012b6 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8012a2:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8012a8:	75 ce                	jne    801278 <fd_alloc+0xa>
+  8012aa:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8012af:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8012b4:	eb 05                	jmp    8012bb <fd_alloc+0x4d>
+			return 0;
+  8012b6:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8012bb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012be:	89 02                	mov    %eax,(%edx)
+}
+  8012c0:	89 c8                	mov    %ecx,%eax
+  8012c2:	5d                   	pop    %ebp
+  8012c3:	c3                   	ret
+
+008012c4 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8012c4:	55                   	push   %ebp
+  8012c5:	89 e5                	mov    %esp,%ebp
+  8012c7:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8012ca:	83 f8 1f             	cmp    $0x1f,%eax
+  8012cd:	77 30                	ja     8012ff <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8012cf:	c1 e0 0c             	shl    $0xc,%eax
+  8012d2:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8012d7:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8012dd:	f6 c2 01             	test   $0x1,%dl
+  8012e0:	74 24                	je     801306 <fd_lookup+0x42>
+  8012e2:	89 c2                	mov    %eax,%edx
+  8012e4:	c1 ea 0c             	shr    $0xc,%edx
+  8012e7:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8012ee:	f6 c2 01             	test   $0x1,%dl
+  8012f1:	74 1a                	je     80130d <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8012f3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012f6:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8012f8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8012fd:	5d                   	pop    %ebp
+  8012fe:	c3                   	ret
+		return -E_INVAL;
+  8012ff:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801304:	eb f7                	jmp    8012fd <fd_lookup+0x39>
+		return -E_INVAL;
+  801306:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80130b:	eb f0                	jmp    8012fd <fd_lookup+0x39>
+  80130d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801312:	eb e9                	jmp    8012fd <fd_lookup+0x39>
+
+00801314 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801314:	55                   	push   %ebp
+  801315:	89 e5                	mov    %esp,%ebp
+  801317:	53                   	push   %ebx
+  801318:	83 ec 04             	sub    $0x4,%esp
+  80131b:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80131e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801323:	eb 03                	jmp    801328 <dev_lookup+0x14>
+  801325:	83 c0 01             	add    $0x1,%eax
+  801328:	8b 1c 85 6c 2e 80 00 	mov    0x802e6c(,%eax,4),%ebx
+  80132f:	85 db                	test   %ebx,%ebx
+  801331:	74 0b                	je     80133e <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801333:	39 13                	cmp    %edx,(%ebx)
+  801335:	75 ee                	jne    801325 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801337:	b8 00 00 00 00       	mov    $0x0,%eax
+  80133c:	eb 1f                	jmp    80135d <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80133e:	a1 18 40 80 00       	mov    0x804018,%eax
+  801343:	8b 40 48             	mov    0x48(%eax),%eax
+  801346:	83 ec 04             	sub    $0x4,%esp
+  801349:	52                   	push   %edx
+  80134a:	50                   	push   %eax
+  80134b:	68 f0 2d 80 00       	push   $0x802df0
+  801350:	e8 7a f2 ff ff       	call   8005cf <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801355:	83 c4 10             	add    $0x10,%esp
+  801358:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80135d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801360:	89 1a                	mov    %ebx,(%edx)
+}
+  801362:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801365:	c9                   	leave
+  801366:	c3                   	ret
+
+00801367 <fd_close>:
+{
+  801367:	55                   	push   %ebp
+  801368:	89 e5                	mov    %esp,%ebp
+  80136a:	57                   	push   %edi
+  80136b:	56                   	push   %esi
+  80136c:	53                   	push   %ebx
+  80136d:	83 ec 24             	sub    $0x24,%esp
+  801370:	8b 75 08             	mov    0x8(%ebp),%esi
+  801373:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801376:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801379:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80137a:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801380:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801383:	50                   	push   %eax
+  801384:	e8 3b ff ff ff       	call   8012c4 <fd_lookup>
+  801389:	89 c3                	mov    %eax,%ebx
+  80138b:	83 c4 10             	add    $0x10,%esp
+  80138e:	85 c0                	test   %eax,%eax
+  801390:	78 05                	js     801397 <fd_close+0x30>
+	    || fd != fd2)
+  801392:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801395:	74 16                	je     8013ad <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801397:	89 f8                	mov    %edi,%eax
+  801399:	84 c0                	test   %al,%al
+  80139b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013a0:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8013a3:	89 d8                	mov    %ebx,%eax
+  8013a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013a8:	5b                   	pop    %ebx
+  8013a9:	5e                   	pop    %esi
+  8013aa:	5f                   	pop    %edi
+  8013ab:	5d                   	pop    %ebp
+  8013ac:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8013ad:	83 ec 08             	sub    $0x8,%esp
+  8013b0:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8013b3:	50                   	push   %eax
+  8013b4:	ff 36                	push   (%esi)
+  8013b6:	e8 59 ff ff ff       	call   801314 <dev_lookup>
+  8013bb:	89 c3                	mov    %eax,%ebx
+  8013bd:	83 c4 10             	add    $0x10,%esp
+  8013c0:	85 c0                	test   %eax,%eax
+  8013c2:	78 1a                	js     8013de <fd_close+0x77>
+		if (dev->dev_close)
+  8013c4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8013c7:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8013ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8013cf:	85 c0                	test   %eax,%eax
+  8013d1:	74 0b                	je     8013de <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8013d3:	83 ec 0c             	sub    $0xc,%esp
+  8013d6:	56                   	push   %esi
+  8013d7:	ff d0                	call   *%eax
+  8013d9:	89 c3                	mov    %eax,%ebx
+  8013db:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8013de:	83 ec 08             	sub    $0x8,%esp
+  8013e1:	56                   	push   %esi
+  8013e2:	6a 00                	push   $0x0
+  8013e4:	e8 10 fc ff ff       	call   800ff9 <sys_page_unmap>
+	return r;
+  8013e9:	83 c4 10             	add    $0x10,%esp
+  8013ec:	eb b5                	jmp    8013a3 <fd_close+0x3c>
+
+008013ee <close>:
+
+int
+close(int fdnum)
+{
+  8013ee:	55                   	push   %ebp
+  8013ef:	89 e5                	mov    %esp,%ebp
+  8013f1:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8013f4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013f7:	50                   	push   %eax
+  8013f8:	ff 75 08             	push   0x8(%ebp)
+  8013fb:	e8 c4 fe ff ff       	call   8012c4 <fd_lookup>
+  801400:	83 c4 10             	add    $0x10,%esp
+  801403:	85 c0                	test   %eax,%eax
+  801405:	79 02                	jns    801409 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801407:	c9                   	leave
+  801408:	c3                   	ret
+		return fd_close(fd, 1);
+  801409:	83 ec 08             	sub    $0x8,%esp
+  80140c:	6a 01                	push   $0x1
+  80140e:	ff 75 f4             	push   -0xc(%ebp)
+  801411:	e8 51 ff ff ff       	call   801367 <fd_close>
+  801416:	83 c4 10             	add    $0x10,%esp
+  801419:	eb ec                	jmp    801407 <close+0x19>
+
+0080141b <close_all>:
+
+void
+close_all(void)
+{
+  80141b:	55                   	push   %ebp
+  80141c:	89 e5                	mov    %esp,%ebp
+  80141e:	53                   	push   %ebx
+  80141f:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801422:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801427:	83 ec 0c             	sub    $0xc,%esp
+  80142a:	53                   	push   %ebx
+  80142b:	e8 be ff ff ff       	call   8013ee <close>
+	for (i = 0; i < MAXFD; i++)
+  801430:	83 c3 01             	add    $0x1,%ebx
+  801433:	83 c4 10             	add    $0x10,%esp
+  801436:	83 fb 20             	cmp    $0x20,%ebx
+  801439:	75 ec                	jne    801427 <close_all+0xc>
+}
+  80143b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80143e:	c9                   	leave
+  80143f:	c3                   	ret
+
+00801440 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801440:	55                   	push   %ebp
+  801441:	89 e5                	mov    %esp,%ebp
+  801443:	57                   	push   %edi
+  801444:	56                   	push   %esi
+  801445:	53                   	push   %ebx
+  801446:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801449:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80144c:	50                   	push   %eax
+  80144d:	ff 75 08             	push   0x8(%ebp)
+  801450:	e8 6f fe ff ff       	call   8012c4 <fd_lookup>
+  801455:	89 c3                	mov    %eax,%ebx
+  801457:	83 c4 10             	add    $0x10,%esp
+  80145a:	85 c0                	test   %eax,%eax
+  80145c:	78 7f                	js     8014dd <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80145e:	83 ec 0c             	sub    $0xc,%esp
+  801461:	ff 75 0c             	push   0xc(%ebp)
+  801464:	e8 85 ff ff ff       	call   8013ee <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801469:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80146c:	c1 e6 0c             	shl    $0xc,%esi
+  80146f:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801475:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801478:	89 3c 24             	mov    %edi,(%esp)
+  80147b:	e8 d7 fd ff ff       	call   801257 <fd2data>
+  801480:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801482:	89 34 24             	mov    %esi,(%esp)
+  801485:	e8 cd fd ff ff       	call   801257 <fd2data>
+  80148a:	83 c4 10             	add    $0x10,%esp
+  80148d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801490:	89 d8                	mov    %ebx,%eax
+  801492:	c1 e8 16             	shr    $0x16,%eax
+  801495:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80149c:	a8 01                	test   $0x1,%al
+  80149e:	74 11                	je     8014b1 <dup+0x71>
+  8014a0:	89 d8                	mov    %ebx,%eax
+  8014a2:	c1 e8 0c             	shr    $0xc,%eax
+  8014a5:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8014ac:	f6 c2 01             	test   $0x1,%dl
+  8014af:	75 36                	jne    8014e7 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8014b1:	89 f8                	mov    %edi,%eax
+  8014b3:	c1 e8 0c             	shr    $0xc,%eax
+  8014b6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8014bd:	83 ec 0c             	sub    $0xc,%esp
+  8014c0:	25 07 0e 00 00       	and    $0xe07,%eax
+  8014c5:	50                   	push   %eax
+  8014c6:	56                   	push   %esi
+  8014c7:	6a 00                	push   $0x0
+  8014c9:	57                   	push   %edi
+  8014ca:	6a 00                	push   $0x0
+  8014cc:	e8 e6 fa ff ff       	call   800fb7 <sys_page_map>
+  8014d1:	89 c3                	mov    %eax,%ebx
+  8014d3:	83 c4 20             	add    $0x20,%esp
+  8014d6:	85 c0                	test   %eax,%eax
+  8014d8:	78 33                	js     80150d <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8014da:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8014dd:	89 d8                	mov    %ebx,%eax
+  8014df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014e2:	5b                   	pop    %ebx
+  8014e3:	5e                   	pop    %esi
+  8014e4:	5f                   	pop    %edi
+  8014e5:	5d                   	pop    %ebp
+  8014e6:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8014e7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8014ee:	83 ec 0c             	sub    $0xc,%esp
+  8014f1:	25 07 0e 00 00       	and    $0xe07,%eax
+  8014f6:	50                   	push   %eax
+  8014f7:	ff 75 d4             	push   -0x2c(%ebp)
+  8014fa:	6a 00                	push   $0x0
+  8014fc:	53                   	push   %ebx
+  8014fd:	6a 00                	push   $0x0
+  8014ff:	e8 b3 fa ff ff       	call   800fb7 <sys_page_map>
+  801504:	89 c3                	mov    %eax,%ebx
+  801506:	83 c4 20             	add    $0x20,%esp
+  801509:	85 c0                	test   %eax,%eax
+  80150b:	79 a4                	jns    8014b1 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80150d:	83 ec 08             	sub    $0x8,%esp
+  801510:	56                   	push   %esi
+  801511:	6a 00                	push   $0x0
+  801513:	e8 e1 fa ff ff       	call   800ff9 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801518:	83 c4 08             	add    $0x8,%esp
+  80151b:	ff 75 d4             	push   -0x2c(%ebp)
+  80151e:	6a 00                	push   $0x0
+  801520:	e8 d4 fa ff ff       	call   800ff9 <sys_page_unmap>
+	return r;
+  801525:	83 c4 10             	add    $0x10,%esp
+  801528:	eb b3                	jmp    8014dd <dup+0x9d>
+
+0080152a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80152a:	55                   	push   %ebp
+  80152b:	89 e5                	mov    %esp,%ebp
+  80152d:	56                   	push   %esi
+  80152e:	53                   	push   %ebx
+  80152f:	83 ec 18             	sub    $0x18,%esp
+  801532:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801535:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801538:	50                   	push   %eax
+  801539:	56                   	push   %esi
+  80153a:	e8 85 fd ff ff       	call   8012c4 <fd_lookup>
+  80153f:	83 c4 10             	add    $0x10,%esp
+  801542:	85 c0                	test   %eax,%eax
+  801544:	78 3c                	js     801582 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801546:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801549:	83 ec 08             	sub    $0x8,%esp
+  80154c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80154f:	50                   	push   %eax
+  801550:	ff 33                	push   (%ebx)
+  801552:	e8 bd fd ff ff       	call   801314 <dev_lookup>
+  801557:	83 c4 10             	add    $0x10,%esp
+  80155a:	85 c0                	test   %eax,%eax
+  80155c:	78 24                	js     801582 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80155e:	8b 43 08             	mov    0x8(%ebx),%eax
+  801561:	83 e0 03             	and    $0x3,%eax
+  801564:	83 f8 01             	cmp    $0x1,%eax
+  801567:	74 20                	je     801589 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801569:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80156c:	8b 40 08             	mov    0x8(%eax),%eax
+  80156f:	85 c0                	test   %eax,%eax
+  801571:	74 37                	je     8015aa <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801573:	83 ec 04             	sub    $0x4,%esp
+  801576:	ff 75 10             	push   0x10(%ebp)
+  801579:	ff 75 0c             	push   0xc(%ebp)
+  80157c:	53                   	push   %ebx
+  80157d:	ff d0                	call   *%eax
+  80157f:	83 c4 10             	add    $0x10,%esp
+}
+  801582:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801585:	5b                   	pop    %ebx
+  801586:	5e                   	pop    %esi
+  801587:	5d                   	pop    %ebp
+  801588:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801589:	a1 18 40 80 00       	mov    0x804018,%eax
+  80158e:	8b 40 48             	mov    0x48(%eax),%eax
+  801591:	83 ec 04             	sub    $0x4,%esp
+  801594:	56                   	push   %esi
+  801595:	50                   	push   %eax
+  801596:	68 31 2e 80 00       	push   $0x802e31
+  80159b:	e8 2f f0 ff ff       	call   8005cf <cprintf>
+		return -E_INVAL;
+  8015a0:	83 c4 10             	add    $0x10,%esp
+  8015a3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015a8:	eb d8                	jmp    801582 <read+0x58>
+		return -E_NOT_SUPP;
+  8015aa:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015af:	eb d1                	jmp    801582 <read+0x58>
+
+008015b1 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8015b1:	55                   	push   %ebp
+  8015b2:	89 e5                	mov    %esp,%ebp
+  8015b4:	57                   	push   %edi
+  8015b5:	56                   	push   %esi
+  8015b6:	53                   	push   %ebx
+  8015b7:	83 ec 0c             	sub    $0xc,%esp
+  8015ba:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8015bd:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8015c0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015c5:	eb 02                	jmp    8015c9 <readn+0x18>
+  8015c7:	01 c3                	add    %eax,%ebx
+  8015c9:	39 f3                	cmp    %esi,%ebx
+  8015cb:	73 21                	jae    8015ee <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8015cd:	83 ec 04             	sub    $0x4,%esp
+  8015d0:	89 f0                	mov    %esi,%eax
+  8015d2:	29 d8                	sub    %ebx,%eax
+  8015d4:	50                   	push   %eax
+  8015d5:	89 d8                	mov    %ebx,%eax
+  8015d7:	03 45 0c             	add    0xc(%ebp),%eax
+  8015da:	50                   	push   %eax
+  8015db:	57                   	push   %edi
+  8015dc:	e8 49 ff ff ff       	call   80152a <read>
+		if (m < 0)
+  8015e1:	83 c4 10             	add    $0x10,%esp
+  8015e4:	85 c0                	test   %eax,%eax
+  8015e6:	78 04                	js     8015ec <readn+0x3b>
+			return m;
+		if (m == 0)
+  8015e8:	75 dd                	jne    8015c7 <readn+0x16>
+  8015ea:	eb 02                	jmp    8015ee <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8015ec:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8015ee:	89 d8                	mov    %ebx,%eax
+  8015f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015f3:	5b                   	pop    %ebx
+  8015f4:	5e                   	pop    %esi
+  8015f5:	5f                   	pop    %edi
+  8015f6:	5d                   	pop    %ebp
+  8015f7:	c3                   	ret
+
+008015f8 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8015f8:	55                   	push   %ebp
+  8015f9:	89 e5                	mov    %esp,%ebp
+  8015fb:	56                   	push   %esi
+  8015fc:	53                   	push   %ebx
+  8015fd:	83 ec 18             	sub    $0x18,%esp
+  801600:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801603:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801606:	50                   	push   %eax
+  801607:	53                   	push   %ebx
+  801608:	e8 b7 fc ff ff       	call   8012c4 <fd_lookup>
+  80160d:	83 c4 10             	add    $0x10,%esp
+  801610:	85 c0                	test   %eax,%eax
+  801612:	78 37                	js     80164b <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801614:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801617:	83 ec 08             	sub    $0x8,%esp
+  80161a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80161d:	50                   	push   %eax
+  80161e:	ff 36                	push   (%esi)
+  801620:	e8 ef fc ff ff       	call   801314 <dev_lookup>
+  801625:	83 c4 10             	add    $0x10,%esp
+  801628:	85 c0                	test   %eax,%eax
+  80162a:	78 1f                	js     80164b <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80162c:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801630:	74 20                	je     801652 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801632:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801635:	8b 40 0c             	mov    0xc(%eax),%eax
+  801638:	85 c0                	test   %eax,%eax
+  80163a:	74 37                	je     801673 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80163c:	83 ec 04             	sub    $0x4,%esp
+  80163f:	ff 75 10             	push   0x10(%ebp)
+  801642:	ff 75 0c             	push   0xc(%ebp)
+  801645:	56                   	push   %esi
+  801646:	ff d0                	call   *%eax
+  801648:	83 c4 10             	add    $0x10,%esp
+}
+  80164b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80164e:	5b                   	pop    %ebx
+  80164f:	5e                   	pop    %esi
+  801650:	5d                   	pop    %ebp
+  801651:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801652:	a1 18 40 80 00       	mov    0x804018,%eax
+  801657:	8b 40 48             	mov    0x48(%eax),%eax
+  80165a:	83 ec 04             	sub    $0x4,%esp
+  80165d:	53                   	push   %ebx
+  80165e:	50                   	push   %eax
+  80165f:	68 4d 2e 80 00       	push   $0x802e4d
+  801664:	e8 66 ef ff ff       	call   8005cf <cprintf>
+		return -E_INVAL;
+  801669:	83 c4 10             	add    $0x10,%esp
+  80166c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801671:	eb d8                	jmp    80164b <write+0x53>
+		return -E_NOT_SUPP;
+  801673:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801678:	eb d1                	jmp    80164b <write+0x53>
+
+0080167a <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80167a:	55                   	push   %ebp
+  80167b:	89 e5                	mov    %esp,%ebp
+  80167d:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801680:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801683:	50                   	push   %eax
+  801684:	ff 75 08             	push   0x8(%ebp)
+  801687:	e8 38 fc ff ff       	call   8012c4 <fd_lookup>
+  80168c:	83 c4 10             	add    $0x10,%esp
+  80168f:	85 c0                	test   %eax,%eax
+  801691:	78 0e                	js     8016a1 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801693:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801696:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801699:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80169c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8016a1:	c9                   	leave
+  8016a2:	c3                   	ret
+
+008016a3 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8016a3:	55                   	push   %ebp
+  8016a4:	89 e5                	mov    %esp,%ebp
+  8016a6:	56                   	push   %esi
+  8016a7:	53                   	push   %ebx
+  8016a8:	83 ec 18             	sub    $0x18,%esp
+  8016ab:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016ae:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016b1:	50                   	push   %eax
+  8016b2:	53                   	push   %ebx
+  8016b3:	e8 0c fc ff ff       	call   8012c4 <fd_lookup>
+  8016b8:	83 c4 10             	add    $0x10,%esp
+  8016bb:	85 c0                	test   %eax,%eax
+  8016bd:	78 34                	js     8016f3 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016bf:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8016c2:	83 ec 08             	sub    $0x8,%esp
+  8016c5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016c8:	50                   	push   %eax
+  8016c9:	ff 36                	push   (%esi)
+  8016cb:	e8 44 fc ff ff       	call   801314 <dev_lookup>
+  8016d0:	83 c4 10             	add    $0x10,%esp
+  8016d3:	85 c0                	test   %eax,%eax
+  8016d5:	78 1c                	js     8016f3 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8016d7:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8016db:	74 1d                	je     8016fa <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8016dd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016e0:	8b 40 18             	mov    0x18(%eax),%eax
+  8016e3:	85 c0                	test   %eax,%eax
+  8016e5:	74 34                	je     80171b <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8016e7:	83 ec 08             	sub    $0x8,%esp
+  8016ea:	ff 75 0c             	push   0xc(%ebp)
+  8016ed:	56                   	push   %esi
+  8016ee:	ff d0                	call   *%eax
+  8016f0:	83 c4 10             	add    $0x10,%esp
+}
+  8016f3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016f6:	5b                   	pop    %ebx
+  8016f7:	5e                   	pop    %esi
+  8016f8:	5d                   	pop    %ebp
+  8016f9:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8016fa:	a1 18 40 80 00       	mov    0x804018,%eax
+  8016ff:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801702:	83 ec 04             	sub    $0x4,%esp
+  801705:	53                   	push   %ebx
+  801706:	50                   	push   %eax
+  801707:	68 10 2e 80 00       	push   $0x802e10
+  80170c:	e8 be ee ff ff       	call   8005cf <cprintf>
+		return -E_INVAL;
+  801711:	83 c4 10             	add    $0x10,%esp
+  801714:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801719:	eb d8                	jmp    8016f3 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  80171b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801720:	eb d1                	jmp    8016f3 <ftruncate+0x50>
+
+00801722 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801722:	55                   	push   %ebp
+  801723:	89 e5                	mov    %esp,%ebp
+  801725:	56                   	push   %esi
+  801726:	53                   	push   %ebx
+  801727:	83 ec 18             	sub    $0x18,%esp
+  80172a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80172d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801730:	50                   	push   %eax
+  801731:	ff 75 08             	push   0x8(%ebp)
+  801734:	e8 8b fb ff ff       	call   8012c4 <fd_lookup>
+  801739:	83 c4 10             	add    $0x10,%esp
+  80173c:	85 c0                	test   %eax,%eax
+  80173e:	78 49                	js     801789 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801740:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801743:	83 ec 08             	sub    $0x8,%esp
+  801746:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801749:	50                   	push   %eax
+  80174a:	ff 36                	push   (%esi)
+  80174c:	e8 c3 fb ff ff       	call   801314 <dev_lookup>
+  801751:	83 c4 10             	add    $0x10,%esp
+  801754:	85 c0                	test   %eax,%eax
+  801756:	78 31                	js     801789 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801758:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80175b:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80175f:	74 2f                	je     801790 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801761:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801764:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80176b:	00 00 00 
+	stat->st_isdir = 0;
+  80176e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801775:	00 00 00 
+	stat->st_dev = dev;
+  801778:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80177e:	83 ec 08             	sub    $0x8,%esp
+  801781:	53                   	push   %ebx
+  801782:	56                   	push   %esi
+  801783:	ff 50 14             	call   *0x14(%eax)
+  801786:	83 c4 10             	add    $0x10,%esp
+}
+  801789:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80178c:	5b                   	pop    %ebx
+  80178d:	5e                   	pop    %esi
+  80178e:	5d                   	pop    %ebp
+  80178f:	c3                   	ret
+		return -E_NOT_SUPP;
+  801790:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801795:	eb f2                	jmp    801789 <fstat+0x67>
+
+00801797 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801797:	55                   	push   %ebp
+  801798:	89 e5                	mov    %esp,%ebp
+  80179a:	56                   	push   %esi
+  80179b:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80179c:	83 ec 08             	sub    $0x8,%esp
+  80179f:	6a 00                	push   $0x0
+  8017a1:	ff 75 08             	push   0x8(%ebp)
+  8017a4:	e8 e4 01 00 00       	call   80198d <open>
+  8017a9:	89 c3                	mov    %eax,%ebx
+  8017ab:	83 c4 10             	add    $0x10,%esp
+  8017ae:	85 c0                	test   %eax,%eax
+  8017b0:	78 1b                	js     8017cd <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8017b2:	83 ec 08             	sub    $0x8,%esp
+  8017b5:	ff 75 0c             	push   0xc(%ebp)
+  8017b8:	50                   	push   %eax
+  8017b9:	e8 64 ff ff ff       	call   801722 <fstat>
+  8017be:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8017c0:	89 1c 24             	mov    %ebx,(%esp)
+  8017c3:	e8 26 fc ff ff       	call   8013ee <close>
+	return r;
+  8017c8:	83 c4 10             	add    $0x10,%esp
+  8017cb:	89 f3                	mov    %esi,%ebx
+}
+  8017cd:	89 d8                	mov    %ebx,%eax
+  8017cf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017d2:	5b                   	pop    %ebx
+  8017d3:	5e                   	pop    %esi
+  8017d4:	5d                   	pop    %ebp
+  8017d5:	c3                   	ret
+
+008017d6 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  8017d6:	55                   	push   %ebp
+  8017d7:	89 e5                	mov    %esp,%ebp
+  8017d9:	56                   	push   %esi
+  8017da:	53                   	push   %ebx
+  8017db:	89 c6                	mov    %eax,%esi
+  8017dd:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  8017df:	83 3d 10 40 80 00 00 	cmpl   $0x0,0x804010
+  8017e6:	74 27                	je     80180f <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8017e8:	6a 07                	push   $0x7
+  8017ea:	68 00 50 80 00       	push   $0x805000
+  8017ef:	56                   	push   %esi
+  8017f0:	ff 35 10 40 80 00    	push   0x804010
+  8017f6:	e8 17 0c 00 00       	call   802412 <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  8017fb:	83 c4 0c             	add    $0xc,%esp
+  8017fe:	6a 00                	push   $0x0
+  801800:	53                   	push   %ebx
+  801801:	6a 00                	push   $0x0
+  801803:	e8 96 0b 00 00       	call   80239e <ipc_recv>
+}
+  801808:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80180b:	5b                   	pop    %ebx
+  80180c:	5e                   	pop    %esi
+  80180d:	5d                   	pop    %ebp
+  80180e:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  80180f:	83 ec 0c             	sub    $0xc,%esp
+  801812:	6a 01                	push   $0x1
+  801814:	e8 4d 0c 00 00       	call   802466 <ipc_find_env>
+  801819:	a3 10 40 80 00       	mov    %eax,0x804010
+  80181e:	83 c4 10             	add    $0x10,%esp
+  801821:	eb c5                	jmp    8017e8 <fsipc+0x12>
+
+00801823 <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801823:	55                   	push   %ebp
+  801824:	89 e5                	mov    %esp,%ebp
+  801826:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801829:	8b 45 08             	mov    0x8(%ebp),%eax
+  80182c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80182f:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.set_size.req_size = newsize;
+  801834:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801837:	a3 04 50 80 00       	mov    %eax,0x805004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  80183c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801841:	b8 02 00 00 00       	mov    $0x2,%eax
+  801846:	e8 8b ff ff ff       	call   8017d6 <fsipc>
+}
+  80184b:	c9                   	leave
+  80184c:	c3                   	ret
+
+0080184d <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80184d:	55                   	push   %ebp
+  80184e:	89 e5                	mov    %esp,%ebp
+  801850:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801853:	8b 45 08             	mov    0x8(%ebp),%eax
+  801856:	8b 40 0c             	mov    0xc(%eax),%eax
+  801859:	a3 00 50 80 00       	mov    %eax,0x805000
+  return fsipc(FSREQ_FLUSH, NULL);
+  80185e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801863:	b8 06 00 00 00       	mov    $0x6,%eax
+  801868:	e8 69 ff ff ff       	call   8017d6 <fsipc>
+}
+  80186d:	c9                   	leave
+  80186e:	c3                   	ret
+
+0080186f <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80186f:	55                   	push   %ebp
+  801870:	89 e5                	mov    %esp,%ebp
+  801872:	53                   	push   %ebx
+  801873:	83 ec 04             	sub    $0x4,%esp
+  801876:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801879:	8b 45 08             	mov    0x8(%ebp),%eax
+  80187c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80187f:	a3 00 50 80 00       	mov    %eax,0x805000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801884:	ba 00 00 00 00       	mov    $0x0,%edx
+  801889:	b8 05 00 00 00       	mov    $0x5,%eax
+  80188e:	e8 43 ff ff ff       	call   8017d6 <fsipc>
+  801893:	85 c0                	test   %eax,%eax
+  801895:	78 2c                	js     8018c3 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801897:	83 ec 08             	sub    $0x8,%esp
+  80189a:	68 00 50 80 00       	push   $0x805000
+  80189f:	53                   	push   %ebx
+  8018a0:	e8 e3 f2 ff ff       	call   800b88 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  8018a5:	a1 80 50 80 00       	mov    0x805080,%eax
+  8018aa:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8018b0:	a1 84 50 80 00       	mov    0x805084,%eax
+  8018b5:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  8018bb:	83 c4 10             	add    $0x10,%esp
+  8018be:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018c3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018c6:	c9                   	leave
+  8018c7:	c3                   	ret
+
+008018c8 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8018c8:	55                   	push   %ebp
+  8018c9:	89 e5                	mov    %esp,%ebp
+  8018cb:	83 ec 0c             	sub    $0xc,%esp
+  8018ce:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8018d1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018d4:	8b 52 0c             	mov    0xc(%edx),%edx
+  8018d7:	89 15 00 50 80 00    	mov    %edx,0x805000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8018dd:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8018e2:	39 d0                	cmp    %edx,%eax
+  8018e4:	0f 47 c2             	cmova  %edx,%eax
+  8018e7:	a3 04 50 80 00       	mov    %eax,0x805004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  8018ec:	50                   	push   %eax
+  8018ed:	ff 75 0c             	push   0xc(%ebp)
+  8018f0:	68 08 50 80 00       	push   $0x805008
+  8018f5:	e8 14 f4 ff ff       	call   800d0e <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  8018fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018ff:	b8 04 00 00 00       	mov    $0x4,%eax
+  801904:	e8 cd fe ff ff       	call   8017d6 <fsipc>
+}
+  801909:	c9                   	leave
+  80190a:	c3                   	ret
+
+0080190b <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80190b:	55                   	push   %ebp
+  80190c:	89 e5                	mov    %esp,%ebp
+  80190e:	56                   	push   %esi
+  80190f:	53                   	push   %ebx
+  801910:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801913:	8b 45 08             	mov    0x8(%ebp),%eax
+  801916:	8b 40 0c             	mov    0xc(%eax),%eax
+  801919:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.read.req_n = n;
+  80191e:	89 35 04 50 80 00    	mov    %esi,0x805004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801924:	ba 00 00 00 00       	mov    $0x0,%edx
+  801929:	b8 03 00 00 00       	mov    $0x3,%eax
+  80192e:	e8 a3 fe ff ff       	call   8017d6 <fsipc>
+  801933:	89 c3                	mov    %eax,%ebx
+  801935:	85 c0                	test   %eax,%eax
+  801937:	78 1f                	js     801958 <devfile_read+0x4d>
+  assert(r <= n);
+  801939:	39 c6                	cmp    %eax,%esi
+  80193b:	72 24                	jb     801961 <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  80193d:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801942:	7f 33                	jg     801977 <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801944:	83 ec 04             	sub    $0x4,%esp
+  801947:	50                   	push   %eax
+  801948:	68 00 50 80 00       	push   $0x805000
+  80194d:	ff 75 0c             	push   0xc(%ebp)
+  801950:	e8 b9 f3 ff ff       	call   800d0e <memmove>
+  return r;
+  801955:	83 c4 10             	add    $0x10,%esp
+}
+  801958:	89 d8                	mov    %ebx,%eax
+  80195a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80195d:	5b                   	pop    %ebx
+  80195e:	5e                   	pop    %esi
+  80195f:	5d                   	pop    %ebp
+  801960:	c3                   	ret
+  assert(r <= n);
+  801961:	68 80 2e 80 00       	push   $0x802e80
+  801966:	68 87 2e 80 00       	push   $0x802e87
+  80196b:	6a 78                	push   $0x78
+  80196d:	68 9c 2e 80 00       	push   $0x802e9c
+  801972:	e8 e1 09 00 00       	call   802358 <_panic>
+  assert(r <= PGSIZE);
+  801977:	68 a7 2e 80 00       	push   $0x802ea7
+  80197c:	68 87 2e 80 00       	push   $0x802e87
+  801981:	6a 79                	push   $0x79
+  801983:	68 9c 2e 80 00       	push   $0x802e9c
+  801988:	e8 cb 09 00 00       	call   802358 <_panic>
+
+0080198d <open>:
+open(const char *path, int mode) {
+  80198d:	55                   	push   %ebp
+  80198e:	89 e5                	mov    %esp,%ebp
+  801990:	56                   	push   %esi
+  801991:	53                   	push   %ebx
+  801992:	83 ec 1c             	sub    $0x1c,%esp
+  801995:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801998:	56                   	push   %esi
+  801999:	e8 af f1 ff ff       	call   800b4d <strlen>
+  80199e:	83 c4 10             	add    $0x10,%esp
+  8019a1:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8019a6:	7f 6c                	jg     801a14 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  8019a8:	83 ec 0c             	sub    $0xc,%esp
+  8019ab:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019ae:	50                   	push   %eax
+  8019af:	e8 ba f8 ff ff       	call   80126e <fd_alloc>
+  8019b4:	89 c3                	mov    %eax,%ebx
+  8019b6:	83 c4 10             	add    $0x10,%esp
+  8019b9:	85 c0                	test   %eax,%eax
+  8019bb:	78 3c                	js     8019f9 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  8019bd:	83 ec 08             	sub    $0x8,%esp
+  8019c0:	56                   	push   %esi
+  8019c1:	68 00 50 80 00       	push   $0x805000
+  8019c6:	e8 bd f1 ff ff       	call   800b88 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  8019cb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019ce:	a3 00 54 80 00       	mov    %eax,0x805400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8019d3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8019d6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8019db:	e8 f6 fd ff ff       	call   8017d6 <fsipc>
+  8019e0:	89 c3                	mov    %eax,%ebx
+  8019e2:	83 c4 10             	add    $0x10,%esp
+  8019e5:	85 c0                	test   %eax,%eax
+  8019e7:	78 19                	js     801a02 <open+0x75>
+  return fd2num(fd);
+  8019e9:	83 ec 0c             	sub    $0xc,%esp
+  8019ec:	ff 75 f4             	push   -0xc(%ebp)
+  8019ef:	e8 53 f8 ff ff       	call   801247 <fd2num>
+  8019f4:	89 c3                	mov    %eax,%ebx
+  8019f6:	83 c4 10             	add    $0x10,%esp
+}
+  8019f9:	89 d8                	mov    %ebx,%eax
+  8019fb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019fe:	5b                   	pop    %ebx
+  8019ff:	5e                   	pop    %esi
+  801a00:	5d                   	pop    %ebp
+  801a01:	c3                   	ret
+    fd_close(fd, 0);
+  801a02:	83 ec 08             	sub    $0x8,%esp
+  801a05:	6a 00                	push   $0x0
+  801a07:	ff 75 f4             	push   -0xc(%ebp)
+  801a0a:	e8 58 f9 ff ff       	call   801367 <fd_close>
+    return r;
+  801a0f:	83 c4 10             	add    $0x10,%esp
+  801a12:	eb e5                	jmp    8019f9 <open+0x6c>
+    return -E_BAD_PATH;
+  801a14:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801a19:	eb de                	jmp    8019f9 <open+0x6c>
+
+00801a1b <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  801a1b:	55                   	push   %ebp
+  801a1c:	89 e5                	mov    %esp,%ebp
+  801a1e:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801a21:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a26:	b8 08 00 00 00       	mov    $0x8,%eax
+  801a2b:	e8 a6 fd ff ff       	call   8017d6 <fsipc>
+}
+  801a30:	c9                   	leave
+  801a31:	c3                   	ret
+
+00801a32 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801a32:	55                   	push   %ebp
+  801a33:	89 e5                	mov    %esp,%ebp
+  801a35:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801a38:	68 b3 2e 80 00       	push   $0x802eb3
+  801a3d:	ff 75 0c             	push   0xc(%ebp)
+  801a40:	e8 43 f1 ff ff       	call   800b88 <strcpy>
+	return 0;
+}
+  801a45:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a4a:	c9                   	leave
+  801a4b:	c3                   	ret
+
+00801a4c <devsock_close>:
+{
+  801a4c:	55                   	push   %ebp
+  801a4d:	89 e5                	mov    %esp,%ebp
+  801a4f:	53                   	push   %ebx
+  801a50:	83 ec 10             	sub    $0x10,%esp
+  801a53:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801a56:	53                   	push   %ebx
+  801a57:	e8 49 0a 00 00       	call   8024a5 <pageref>
+  801a5c:	89 c2                	mov    %eax,%edx
+  801a5e:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801a61:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801a66:	83 fa 01             	cmp    $0x1,%edx
+  801a69:	74 05                	je     801a70 <devsock_close+0x24>
+}
+  801a6b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a6e:	c9                   	leave
+  801a6f:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801a70:	83 ec 0c             	sub    $0xc,%esp
+  801a73:	ff 73 0c             	push   0xc(%ebx)
+  801a76:	e8 b7 02 00 00       	call   801d32 <nsipc_close>
+  801a7b:	83 c4 10             	add    $0x10,%esp
+  801a7e:	eb eb                	jmp    801a6b <devsock_close+0x1f>
+
+00801a80 <devsock_write>:
+{
+  801a80:	55                   	push   %ebp
+  801a81:	89 e5                	mov    %esp,%ebp
+  801a83:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801a86:	6a 00                	push   $0x0
+  801a88:	ff 75 10             	push   0x10(%ebp)
+  801a8b:	ff 75 0c             	push   0xc(%ebp)
+  801a8e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a91:	ff 70 0c             	push   0xc(%eax)
+  801a94:	e8 79 03 00 00       	call   801e12 <nsipc_send>
+}
+  801a99:	c9                   	leave
+  801a9a:	c3                   	ret
+
+00801a9b <devsock_read>:
+{
+  801a9b:	55                   	push   %ebp
+  801a9c:	89 e5                	mov    %esp,%ebp
+  801a9e:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801aa1:	6a 00                	push   $0x0
+  801aa3:	ff 75 10             	push   0x10(%ebp)
+  801aa6:	ff 75 0c             	push   0xc(%ebp)
+  801aa9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801aac:	ff 70 0c             	push   0xc(%eax)
+  801aaf:	e8 ef 02 00 00       	call   801da3 <nsipc_recv>
+}
+  801ab4:	c9                   	leave
+  801ab5:	c3                   	ret
+
+00801ab6 <fd2sockid>:
+{
+  801ab6:	55                   	push   %ebp
+  801ab7:	89 e5                	mov    %esp,%ebp
+  801ab9:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801abc:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801abf:	52                   	push   %edx
+  801ac0:	50                   	push   %eax
+  801ac1:	e8 fe f7 ff ff       	call   8012c4 <fd_lookup>
+  801ac6:	83 c4 10             	add    $0x10,%esp
+  801ac9:	85 c0                	test   %eax,%eax
+  801acb:	78 10                	js     801add <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801acd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ad0:	8b 0d 24 30 80 00    	mov    0x803024,%ecx
+  801ad6:	39 08                	cmp    %ecx,(%eax)
+  801ad8:	75 05                	jne    801adf <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801ada:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801add:	c9                   	leave
+  801ade:	c3                   	ret
+		return -E_NOT_SUPP;
+  801adf:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ae4:	eb f7                	jmp    801add <fd2sockid+0x27>
+
+00801ae6 <alloc_sockfd>:
+{
+  801ae6:	55                   	push   %ebp
+  801ae7:	89 e5                	mov    %esp,%ebp
+  801ae9:	56                   	push   %esi
+  801aea:	53                   	push   %ebx
+  801aeb:	83 ec 1c             	sub    $0x1c,%esp
+  801aee:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801af0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801af3:	50                   	push   %eax
+  801af4:	e8 75 f7 ff ff       	call   80126e <fd_alloc>
+  801af9:	89 c3                	mov    %eax,%ebx
+  801afb:	83 c4 10             	add    $0x10,%esp
+  801afe:	85 c0                	test   %eax,%eax
+  801b00:	78 43                	js     801b45 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801b02:	83 ec 04             	sub    $0x4,%esp
+  801b05:	68 07 04 00 00       	push   $0x407
+  801b0a:	ff 75 f4             	push   -0xc(%ebp)
+  801b0d:	6a 00                	push   $0x0
+  801b0f:	e8 60 f4 ff ff       	call   800f74 <sys_page_alloc>
+  801b14:	89 c3                	mov    %eax,%ebx
+  801b16:	83 c4 10             	add    $0x10,%esp
+  801b19:	85 c0                	test   %eax,%eax
+  801b1b:	78 28                	js     801b45 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801b1d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b20:	8b 15 24 30 80 00    	mov    0x803024,%edx
+  801b26:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801b28:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b2b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801b32:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801b35:	83 ec 0c             	sub    $0xc,%esp
+  801b38:	50                   	push   %eax
+  801b39:	e8 09 f7 ff ff       	call   801247 <fd2num>
+  801b3e:	89 c3                	mov    %eax,%ebx
+  801b40:	83 c4 10             	add    $0x10,%esp
+  801b43:	eb 0c                	jmp    801b51 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801b45:	83 ec 0c             	sub    $0xc,%esp
+  801b48:	56                   	push   %esi
+  801b49:	e8 e4 01 00 00       	call   801d32 <nsipc_close>
+		return r;
+  801b4e:	83 c4 10             	add    $0x10,%esp
+}
+  801b51:	89 d8                	mov    %ebx,%eax
+  801b53:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b56:	5b                   	pop    %ebx
+  801b57:	5e                   	pop    %esi
+  801b58:	5d                   	pop    %ebp
+  801b59:	c3                   	ret
+
+00801b5a <accept>:
+{
+  801b5a:	55                   	push   %ebp
+  801b5b:	89 e5                	mov    %esp,%ebp
+  801b5d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801b60:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b63:	e8 4e ff ff ff       	call   801ab6 <fd2sockid>
+  801b68:	85 c0                	test   %eax,%eax
+  801b6a:	78 1b                	js     801b87 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801b6c:	83 ec 04             	sub    $0x4,%esp
+  801b6f:	ff 75 10             	push   0x10(%ebp)
+  801b72:	ff 75 0c             	push   0xc(%ebp)
+  801b75:	50                   	push   %eax
+  801b76:	e8 0e 01 00 00       	call   801c89 <nsipc_accept>
+  801b7b:	83 c4 10             	add    $0x10,%esp
+  801b7e:	85 c0                	test   %eax,%eax
+  801b80:	78 05                	js     801b87 <accept+0x2d>
+	return alloc_sockfd(r);
+  801b82:	e8 5f ff ff ff       	call   801ae6 <alloc_sockfd>
+}
+  801b87:	c9                   	leave
+  801b88:	c3                   	ret
+
+00801b89 <bind>:
+{
+  801b89:	55                   	push   %ebp
+  801b8a:	89 e5                	mov    %esp,%ebp
+  801b8c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801b8f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b92:	e8 1f ff ff ff       	call   801ab6 <fd2sockid>
+  801b97:	85 c0                	test   %eax,%eax
+  801b99:	78 12                	js     801bad <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801b9b:	83 ec 04             	sub    $0x4,%esp
+  801b9e:	ff 75 10             	push   0x10(%ebp)
+  801ba1:	ff 75 0c             	push   0xc(%ebp)
+  801ba4:	50                   	push   %eax
+  801ba5:	e8 31 01 00 00       	call   801cdb <nsipc_bind>
+  801baa:	83 c4 10             	add    $0x10,%esp
+}
+  801bad:	c9                   	leave
+  801bae:	c3                   	ret
+
+00801baf <shutdown>:
+{
+  801baf:	55                   	push   %ebp
+  801bb0:	89 e5                	mov    %esp,%ebp
+  801bb2:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801bb5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bb8:	e8 f9 fe ff ff       	call   801ab6 <fd2sockid>
+  801bbd:	85 c0                	test   %eax,%eax
+  801bbf:	78 0f                	js     801bd0 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801bc1:	83 ec 08             	sub    $0x8,%esp
+  801bc4:	ff 75 0c             	push   0xc(%ebp)
+  801bc7:	50                   	push   %eax
+  801bc8:	e8 43 01 00 00       	call   801d10 <nsipc_shutdown>
+  801bcd:	83 c4 10             	add    $0x10,%esp
+}
+  801bd0:	c9                   	leave
+  801bd1:	c3                   	ret
+
+00801bd2 <connect>:
+{
+  801bd2:	55                   	push   %ebp
+  801bd3:	89 e5                	mov    %esp,%ebp
+  801bd5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801bd8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bdb:	e8 d6 fe ff ff       	call   801ab6 <fd2sockid>
+  801be0:	85 c0                	test   %eax,%eax
+  801be2:	78 12                	js     801bf6 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801be4:	83 ec 04             	sub    $0x4,%esp
+  801be7:	ff 75 10             	push   0x10(%ebp)
+  801bea:	ff 75 0c             	push   0xc(%ebp)
+  801bed:	50                   	push   %eax
+  801bee:	e8 59 01 00 00       	call   801d4c <nsipc_connect>
+  801bf3:	83 c4 10             	add    $0x10,%esp
+}
+  801bf6:	c9                   	leave
+  801bf7:	c3                   	ret
+
+00801bf8 <listen>:
+{
+  801bf8:	55                   	push   %ebp
+  801bf9:	89 e5                	mov    %esp,%ebp
+  801bfb:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801bfe:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c01:	e8 b0 fe ff ff       	call   801ab6 <fd2sockid>
+  801c06:	85 c0                	test   %eax,%eax
+  801c08:	78 0f                	js     801c19 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801c0a:	83 ec 08             	sub    $0x8,%esp
+  801c0d:	ff 75 0c             	push   0xc(%ebp)
+  801c10:	50                   	push   %eax
+  801c11:	e8 6b 01 00 00       	call   801d81 <nsipc_listen>
+  801c16:	83 c4 10             	add    $0x10,%esp
+}
+  801c19:	c9                   	leave
+  801c1a:	c3                   	ret
+
+00801c1b <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801c1b:	55                   	push   %ebp
+  801c1c:	89 e5                	mov    %esp,%ebp
+  801c1e:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801c21:	ff 75 10             	push   0x10(%ebp)
+  801c24:	ff 75 0c             	push   0xc(%ebp)
+  801c27:	ff 75 08             	push   0x8(%ebp)
+  801c2a:	e8 41 02 00 00       	call   801e70 <nsipc_socket>
+  801c2f:	83 c4 10             	add    $0x10,%esp
+  801c32:	85 c0                	test   %eax,%eax
+  801c34:	78 05                	js     801c3b <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801c36:	e8 ab fe ff ff       	call   801ae6 <alloc_sockfd>
+}
+  801c3b:	c9                   	leave
+  801c3c:	c3                   	ret
+
+00801c3d <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801c3d:	55                   	push   %ebp
+  801c3e:	89 e5                	mov    %esp,%ebp
+  801c40:	53                   	push   %ebx
+  801c41:	83 ec 04             	sub    $0x4,%esp
+  801c44:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801c46:	83 3d 14 40 80 00 00 	cmpl   $0x0,0x804014
+  801c4d:	74 26                	je     801c75 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801c4f:	6a 07                	push   $0x7
+  801c51:	68 00 60 80 00       	push   $0x806000
+  801c56:	53                   	push   %ebx
+  801c57:	ff 35 14 40 80 00    	push   0x804014
+  801c5d:	e8 b0 07 00 00       	call   802412 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801c62:	83 c4 0c             	add    $0xc,%esp
+  801c65:	6a 00                	push   $0x0
+  801c67:	6a 00                	push   $0x0
+  801c69:	6a 00                	push   $0x0
+  801c6b:	e8 2e 07 00 00       	call   80239e <ipc_recv>
+}
+  801c70:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c73:	c9                   	leave
+  801c74:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801c75:	83 ec 0c             	sub    $0xc,%esp
+  801c78:	6a 02                	push   $0x2
+  801c7a:	e8 e7 07 00 00       	call   802466 <ipc_find_env>
+  801c7f:	a3 14 40 80 00       	mov    %eax,0x804014
+  801c84:	83 c4 10             	add    $0x10,%esp
+  801c87:	eb c6                	jmp    801c4f <nsipc+0x12>
+
+00801c89 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801c89:	55                   	push   %ebp
+  801c8a:	89 e5                	mov    %esp,%ebp
+  801c8c:	56                   	push   %esi
+  801c8d:	53                   	push   %ebx
+  801c8e:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801c91:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c94:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801c99:	8b 06                	mov    (%esi),%eax
+  801c9b:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801ca0:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ca5:	e8 93 ff ff ff       	call   801c3d <nsipc>
+  801caa:	89 c3                	mov    %eax,%ebx
+  801cac:	85 c0                	test   %eax,%eax
+  801cae:	79 09                	jns    801cb9 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801cb0:	89 d8                	mov    %ebx,%eax
+  801cb2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cb5:	5b                   	pop    %ebx
+  801cb6:	5e                   	pop    %esi
+  801cb7:	5d                   	pop    %ebp
+  801cb8:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801cb9:	83 ec 04             	sub    $0x4,%esp
+  801cbc:	ff 35 10 60 80 00    	push   0x806010
+  801cc2:	68 00 60 80 00       	push   $0x806000
+  801cc7:	ff 75 0c             	push   0xc(%ebp)
+  801cca:	e8 3f f0 ff ff       	call   800d0e <memmove>
+		*addrlen = ret->ret_addrlen;
+  801ccf:	a1 10 60 80 00       	mov    0x806010,%eax
+  801cd4:	89 06                	mov    %eax,(%esi)
+  801cd6:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801cd9:	eb d5                	jmp    801cb0 <nsipc_accept+0x27>
+
+00801cdb <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801cdb:	55                   	push   %ebp
+  801cdc:	89 e5                	mov    %esp,%ebp
+  801cde:	53                   	push   %ebx
+  801cdf:	83 ec 08             	sub    $0x8,%esp
+  801ce2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801ce5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ce8:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801ced:	53                   	push   %ebx
+  801cee:	ff 75 0c             	push   0xc(%ebp)
+  801cf1:	68 04 60 80 00       	push   $0x806004
+  801cf6:	e8 13 f0 ff ff       	call   800d0e <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801cfb:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  801d01:	b8 02 00 00 00       	mov    $0x2,%eax
+  801d06:	e8 32 ff ff ff       	call   801c3d <nsipc>
+}
+  801d0b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d0e:	c9                   	leave
+  801d0f:	c3                   	ret
+
+00801d10 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801d10:	55                   	push   %ebp
+  801d11:	89 e5                	mov    %esp,%ebp
+  801d13:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801d16:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d19:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  801d1e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d21:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  801d26:	b8 03 00 00 00       	mov    $0x3,%eax
+  801d2b:	e8 0d ff ff ff       	call   801c3d <nsipc>
+}
+  801d30:	c9                   	leave
+  801d31:	c3                   	ret
+
+00801d32 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801d32:	55                   	push   %ebp
+  801d33:	89 e5                	mov    %esp,%ebp
+  801d35:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801d38:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d3b:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  801d40:	b8 04 00 00 00       	mov    $0x4,%eax
+  801d45:	e8 f3 fe ff ff       	call   801c3d <nsipc>
+}
+  801d4a:	c9                   	leave
+  801d4b:	c3                   	ret
+
+00801d4c <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801d4c:	55                   	push   %ebp
+  801d4d:	89 e5                	mov    %esp,%ebp
+  801d4f:	53                   	push   %ebx
+  801d50:	83 ec 08             	sub    $0x8,%esp
+  801d53:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801d56:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d59:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801d5e:	53                   	push   %ebx
+  801d5f:	ff 75 0c             	push   0xc(%ebp)
+  801d62:	68 04 60 80 00       	push   $0x806004
+  801d67:	e8 a2 ef ff ff       	call   800d0e <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801d6c:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  801d72:	b8 05 00 00 00       	mov    $0x5,%eax
+  801d77:	e8 c1 fe ff ff       	call   801c3d <nsipc>
+}
+  801d7c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d7f:	c9                   	leave
+  801d80:	c3                   	ret
+
+00801d81 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801d81:	55                   	push   %ebp
+  801d82:	89 e5                	mov    %esp,%ebp
+  801d84:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801d87:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d8a:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  801d8f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d92:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  801d97:	b8 06 00 00 00       	mov    $0x6,%eax
+  801d9c:	e8 9c fe ff ff       	call   801c3d <nsipc>
+}
+  801da1:	c9                   	leave
+  801da2:	c3                   	ret
+
+00801da3 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801da3:	55                   	push   %ebp
+  801da4:	89 e5                	mov    %esp,%ebp
+  801da6:	56                   	push   %esi
+  801da7:	53                   	push   %ebx
+  801da8:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801dab:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dae:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  801db3:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  801db9:	8b 45 14             	mov    0x14(%ebp),%eax
+  801dbc:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801dc1:	b8 07 00 00 00       	mov    $0x7,%eax
+  801dc6:	e8 72 fe ff ff       	call   801c3d <nsipc>
+  801dcb:	89 c3                	mov    %eax,%ebx
+  801dcd:	85 c0                	test   %eax,%eax
+  801dcf:	78 22                	js     801df3 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801dd1:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801dd6:	39 c6                	cmp    %eax,%esi
+  801dd8:	0f 4e c6             	cmovle %esi,%eax
+  801ddb:	39 c3                	cmp    %eax,%ebx
+  801ddd:	7f 1d                	jg     801dfc <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801ddf:	83 ec 04             	sub    $0x4,%esp
+  801de2:	53                   	push   %ebx
+  801de3:	68 00 60 80 00       	push   $0x806000
+  801de8:	ff 75 0c             	push   0xc(%ebp)
+  801deb:	e8 1e ef ff ff       	call   800d0e <memmove>
+  801df0:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801df3:	89 d8                	mov    %ebx,%eax
+  801df5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801df8:	5b                   	pop    %ebx
+  801df9:	5e                   	pop    %esi
+  801dfa:	5d                   	pop    %ebp
+  801dfb:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801dfc:	68 bf 2e 80 00       	push   $0x802ebf
+  801e01:	68 87 2e 80 00       	push   $0x802e87
+  801e06:	6a 62                	push   $0x62
+  801e08:	68 d4 2e 80 00       	push   $0x802ed4
+  801e0d:	e8 46 05 00 00       	call   802358 <_panic>
+
+00801e12 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801e12:	55                   	push   %ebp
+  801e13:	89 e5                	mov    %esp,%ebp
+  801e15:	53                   	push   %ebx
+  801e16:	83 ec 04             	sub    $0x4,%esp
+  801e19:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801e1c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e1f:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  801e24:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801e2a:	7f 2e                	jg     801e5a <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801e2c:	83 ec 04             	sub    $0x4,%esp
+  801e2f:	53                   	push   %ebx
+  801e30:	ff 75 0c             	push   0xc(%ebp)
+  801e33:	68 0c 60 80 00       	push   $0x80600c
+  801e38:	e8 d1 ee ff ff       	call   800d0e <memmove>
+	nsipcbuf.send.req_size = size;
+  801e3d:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  801e43:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e46:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  801e4b:	b8 08 00 00 00       	mov    $0x8,%eax
+  801e50:	e8 e8 fd ff ff       	call   801c3d <nsipc>
+}
+  801e55:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e58:	c9                   	leave
+  801e59:	c3                   	ret
+	assert(size < 1600);
+  801e5a:	68 e0 2e 80 00       	push   $0x802ee0
+  801e5f:	68 87 2e 80 00       	push   $0x802e87
+  801e64:	6a 6d                	push   $0x6d
+  801e66:	68 d4 2e 80 00       	push   $0x802ed4
+  801e6b:	e8 e8 04 00 00       	call   802358 <_panic>
+
+00801e70 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801e70:	55                   	push   %ebp
+  801e71:	89 e5                	mov    %esp,%ebp
+  801e73:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801e76:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e79:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  801e7e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e81:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  801e86:	8b 45 10             	mov    0x10(%ebp),%eax
+  801e89:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  801e8e:	b8 09 00 00 00       	mov    $0x9,%eax
+  801e93:	e8 a5 fd ff ff       	call   801c3d <nsipc>
+}
+  801e98:	c9                   	leave
+  801e99:	c3                   	ret
+
+00801e9a <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801e9a:	55                   	push   %ebp
+  801e9b:	89 e5                	mov    %esp,%ebp
+  801e9d:	56                   	push   %esi
+  801e9e:	53                   	push   %ebx
+  801e9f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801ea2:	83 ec 0c             	sub    $0xc,%esp
+  801ea5:	ff 75 08             	push   0x8(%ebp)
+  801ea8:	e8 aa f3 ff ff       	call   801257 <fd2data>
+  801ead:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801eaf:	83 c4 08             	add    $0x8,%esp
+  801eb2:	68 ec 2e 80 00       	push   $0x802eec
+  801eb7:	53                   	push   %ebx
+  801eb8:	e8 cb ec ff ff       	call   800b88 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801ebd:	8b 46 04             	mov    0x4(%esi),%eax
+  801ec0:	2b 06                	sub    (%esi),%eax
+  801ec2:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  801ec8:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801ecf:	00 00 00 
+	stat->st_dev = &devpipe;
+  801ed2:	c7 83 88 00 00 00 40 	movl   $0x803040,0x88(%ebx)
+  801ed9:	30 80 00 
+	return 0;
+}
+  801edc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ee1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ee4:	5b                   	pop    %ebx
+  801ee5:	5e                   	pop    %esi
+  801ee6:	5d                   	pop    %ebp
+  801ee7:	c3                   	ret
+
+00801ee8 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801ee8:	55                   	push   %ebp
+  801ee9:	89 e5                	mov    %esp,%ebp
+  801eeb:	53                   	push   %ebx
+  801eec:	83 ec 0c             	sub    $0xc,%esp
+  801eef:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801ef2:	53                   	push   %ebx
+  801ef3:	6a 00                	push   $0x0
+  801ef5:	e8 ff f0 ff ff       	call   800ff9 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801efa:	89 1c 24             	mov    %ebx,(%esp)
+  801efd:	e8 55 f3 ff ff       	call   801257 <fd2data>
+  801f02:	83 c4 08             	add    $0x8,%esp
+  801f05:	50                   	push   %eax
+  801f06:	6a 00                	push   $0x0
+  801f08:	e8 ec f0 ff ff       	call   800ff9 <sys_page_unmap>
+}
+  801f0d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f10:	c9                   	leave
+  801f11:	c3                   	ret
+
+00801f12 <_pipeisclosed>:
+{
+  801f12:	55                   	push   %ebp
+  801f13:	89 e5                	mov    %esp,%ebp
+  801f15:	57                   	push   %edi
+  801f16:	56                   	push   %esi
+  801f17:	53                   	push   %ebx
+  801f18:	83 ec 1c             	sub    $0x1c,%esp
+  801f1b:	89 c7                	mov    %eax,%edi
+  801f1d:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801f1f:	a1 18 40 80 00       	mov    0x804018,%eax
+  801f24:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801f27:	83 ec 0c             	sub    $0xc,%esp
+  801f2a:	57                   	push   %edi
+  801f2b:	e8 75 05 00 00       	call   8024a5 <pageref>
+  801f30:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801f33:	89 34 24             	mov    %esi,(%esp)
+  801f36:	e8 6a 05 00 00       	call   8024a5 <pageref>
+		nn = thisenv->env_runs;
+  801f3b:	8b 15 18 40 80 00    	mov    0x804018,%edx
+  801f41:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801f44:	83 c4 10             	add    $0x10,%esp
+  801f47:	39 cb                	cmp    %ecx,%ebx
+  801f49:	74 1b                	je     801f66 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801f4b:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801f4e:	75 cf                	jne    801f1f <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801f50:	8b 42 58             	mov    0x58(%edx),%eax
+  801f53:	6a 01                	push   $0x1
+  801f55:	50                   	push   %eax
+  801f56:	53                   	push   %ebx
+  801f57:	68 f3 2e 80 00       	push   $0x802ef3
+  801f5c:	e8 6e e6 ff ff       	call   8005cf <cprintf>
+  801f61:	83 c4 10             	add    $0x10,%esp
+  801f64:	eb b9                	jmp    801f1f <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801f66:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801f69:	0f 94 c0             	sete   %al
+  801f6c:	0f b6 c0             	movzbl %al,%eax
+}
+  801f6f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f72:	5b                   	pop    %ebx
+  801f73:	5e                   	pop    %esi
+  801f74:	5f                   	pop    %edi
+  801f75:	5d                   	pop    %ebp
+  801f76:	c3                   	ret
+
+00801f77 <devpipe_write>:
+{
+  801f77:	55                   	push   %ebp
+  801f78:	89 e5                	mov    %esp,%ebp
+  801f7a:	57                   	push   %edi
+  801f7b:	56                   	push   %esi
+  801f7c:	53                   	push   %ebx
+  801f7d:	83 ec 28             	sub    $0x28,%esp
+  801f80:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801f83:	56                   	push   %esi
+  801f84:	e8 ce f2 ff ff       	call   801257 <fd2data>
+  801f89:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801f8b:	83 c4 10             	add    $0x10,%esp
+  801f8e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f93:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801f96:	75 09                	jne    801fa1 <devpipe_write+0x2a>
+	return i;
+  801f98:	89 f8                	mov    %edi,%eax
+  801f9a:	eb 23                	jmp    801fbf <devpipe_write+0x48>
+			sys_yield();
+  801f9c:	e8 b4 ef ff ff       	call   800f55 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801fa1:	8b 43 04             	mov    0x4(%ebx),%eax
+  801fa4:	8b 0b                	mov    (%ebx),%ecx
+  801fa6:	8d 51 20             	lea    0x20(%ecx),%edx
+  801fa9:	39 d0                	cmp    %edx,%eax
+  801fab:	72 1a                	jb     801fc7 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  801fad:	89 da                	mov    %ebx,%edx
+  801faf:	89 f0                	mov    %esi,%eax
+  801fb1:	e8 5c ff ff ff       	call   801f12 <_pipeisclosed>
+  801fb6:	85 c0                	test   %eax,%eax
+  801fb8:	74 e2                	je     801f9c <devpipe_write+0x25>
+				return 0;
+  801fba:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801fbf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fc2:	5b                   	pop    %ebx
+  801fc3:	5e                   	pop    %esi
+  801fc4:	5f                   	pop    %edi
+  801fc5:	5d                   	pop    %ebp
+  801fc6:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801fc7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801fca:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801fce:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801fd1:	89 c2                	mov    %eax,%edx
+  801fd3:	c1 fa 1f             	sar    $0x1f,%edx
+  801fd6:	89 d1                	mov    %edx,%ecx
+  801fd8:	c1 e9 1b             	shr    $0x1b,%ecx
+  801fdb:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801fde:	83 e2 1f             	and    $0x1f,%edx
+  801fe1:	29 ca                	sub    %ecx,%edx
+  801fe3:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801fe7:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  801feb:	83 c0 01             	add    $0x1,%eax
+  801fee:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  801ff1:	83 c7 01             	add    $0x1,%edi
+  801ff4:	eb 9d                	jmp    801f93 <devpipe_write+0x1c>
+
+00801ff6 <devpipe_read>:
+{
+  801ff6:	55                   	push   %ebp
+  801ff7:	89 e5                	mov    %esp,%ebp
+  801ff9:	57                   	push   %edi
+  801ffa:	56                   	push   %esi
+  801ffb:	53                   	push   %ebx
+  801ffc:	83 ec 18             	sub    $0x18,%esp
+  801fff:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802002:	57                   	push   %edi
+  802003:	e8 4f f2 ff ff       	call   801257 <fd2data>
+  802008:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80200a:	83 c4 10             	add    $0x10,%esp
+  80200d:	be 00 00 00 00       	mov    $0x0,%esi
+  802012:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802015:	75 13                	jne    80202a <devpipe_read+0x34>
+	return i;
+  802017:	89 f0                	mov    %esi,%eax
+  802019:	eb 02                	jmp    80201d <devpipe_read+0x27>
+				return i;
+  80201b:	89 f0                	mov    %esi,%eax
+}
+  80201d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802020:	5b                   	pop    %ebx
+  802021:	5e                   	pop    %esi
+  802022:	5f                   	pop    %edi
+  802023:	5d                   	pop    %ebp
+  802024:	c3                   	ret
+			sys_yield();
+  802025:	e8 2b ef ff ff       	call   800f55 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  80202a:	8b 03                	mov    (%ebx),%eax
+  80202c:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80202f:	75 18                	jne    802049 <devpipe_read+0x53>
+			if (i > 0)
+  802031:	85 f6                	test   %esi,%esi
+  802033:	75 e6                	jne    80201b <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802035:	89 da                	mov    %ebx,%edx
+  802037:	89 f8                	mov    %edi,%eax
+  802039:	e8 d4 fe ff ff       	call   801f12 <_pipeisclosed>
+  80203e:	85 c0                	test   %eax,%eax
+  802040:	74 e3                	je     802025 <devpipe_read+0x2f>
+				return 0;
+  802042:	b8 00 00 00 00       	mov    $0x0,%eax
+  802047:	eb d4                	jmp    80201d <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802049:	99                   	cltd
+  80204a:	c1 ea 1b             	shr    $0x1b,%edx
+  80204d:	01 d0                	add    %edx,%eax
+  80204f:	83 e0 1f             	and    $0x1f,%eax
+  802052:	29 d0                	sub    %edx,%eax
+  802054:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802059:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80205c:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80205f:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802062:	83 c6 01             	add    $0x1,%esi
+  802065:	eb ab                	jmp    802012 <devpipe_read+0x1c>
+
+00802067 <pipe>:
+{
+  802067:	55                   	push   %ebp
+  802068:	89 e5                	mov    %esp,%ebp
+  80206a:	56                   	push   %esi
+  80206b:	53                   	push   %ebx
+  80206c:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80206f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802072:	50                   	push   %eax
+  802073:	e8 f6 f1 ff ff       	call   80126e <fd_alloc>
+  802078:	89 c3                	mov    %eax,%ebx
+  80207a:	83 c4 10             	add    $0x10,%esp
+  80207d:	85 c0                	test   %eax,%eax
+  80207f:	0f 88 23 01 00 00    	js     8021a8 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802085:	83 ec 04             	sub    $0x4,%esp
+  802088:	68 07 04 00 00       	push   $0x407
+  80208d:	ff 75 f4             	push   -0xc(%ebp)
+  802090:	6a 00                	push   $0x0
+  802092:	e8 dd ee ff ff       	call   800f74 <sys_page_alloc>
+  802097:	89 c3                	mov    %eax,%ebx
+  802099:	83 c4 10             	add    $0x10,%esp
+  80209c:	85 c0                	test   %eax,%eax
+  80209e:	0f 88 04 01 00 00    	js     8021a8 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8020a4:	83 ec 0c             	sub    $0xc,%esp
+  8020a7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8020aa:	50                   	push   %eax
+  8020ab:	e8 be f1 ff ff       	call   80126e <fd_alloc>
+  8020b0:	89 c3                	mov    %eax,%ebx
+  8020b2:	83 c4 10             	add    $0x10,%esp
+  8020b5:	85 c0                	test   %eax,%eax
+  8020b7:	0f 88 db 00 00 00    	js     802198 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8020bd:	83 ec 04             	sub    $0x4,%esp
+  8020c0:	68 07 04 00 00       	push   $0x407
+  8020c5:	ff 75 f0             	push   -0x10(%ebp)
+  8020c8:	6a 00                	push   $0x0
+  8020ca:	e8 a5 ee ff ff       	call   800f74 <sys_page_alloc>
+  8020cf:	89 c3                	mov    %eax,%ebx
+  8020d1:	83 c4 10             	add    $0x10,%esp
+  8020d4:	85 c0                	test   %eax,%eax
+  8020d6:	0f 88 bc 00 00 00    	js     802198 <pipe+0x131>
+	va = fd2data(fd0);
+  8020dc:	83 ec 0c             	sub    $0xc,%esp
+  8020df:	ff 75 f4             	push   -0xc(%ebp)
+  8020e2:	e8 70 f1 ff ff       	call   801257 <fd2data>
+  8020e7:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8020e9:	83 c4 0c             	add    $0xc,%esp
+  8020ec:	68 07 04 00 00       	push   $0x407
+  8020f1:	50                   	push   %eax
+  8020f2:	6a 00                	push   $0x0
+  8020f4:	e8 7b ee ff ff       	call   800f74 <sys_page_alloc>
+  8020f9:	89 c3                	mov    %eax,%ebx
+  8020fb:	83 c4 10             	add    $0x10,%esp
+  8020fe:	85 c0                	test   %eax,%eax
+  802100:	0f 88 82 00 00 00    	js     802188 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802106:	83 ec 0c             	sub    $0xc,%esp
+  802109:	ff 75 f0             	push   -0x10(%ebp)
+  80210c:	e8 46 f1 ff ff       	call   801257 <fd2data>
+  802111:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802118:	50                   	push   %eax
+  802119:	6a 00                	push   $0x0
+  80211b:	56                   	push   %esi
+  80211c:	6a 00                	push   $0x0
+  80211e:	e8 94 ee ff ff       	call   800fb7 <sys_page_map>
+  802123:	89 c3                	mov    %eax,%ebx
+  802125:	83 c4 20             	add    $0x20,%esp
+  802128:	85 c0                	test   %eax,%eax
+  80212a:	78 4e                	js     80217a <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80212c:	a1 40 30 80 00       	mov    0x803040,%eax
+  802131:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802134:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802136:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802139:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802140:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802143:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802145:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802148:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80214f:	83 ec 0c             	sub    $0xc,%esp
+  802152:	ff 75 f4             	push   -0xc(%ebp)
+  802155:	e8 ed f0 ff ff       	call   801247 <fd2num>
+  80215a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80215d:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80215f:	83 c4 04             	add    $0x4,%esp
+  802162:	ff 75 f0             	push   -0x10(%ebp)
+  802165:	e8 dd f0 ff ff       	call   801247 <fd2num>
+  80216a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80216d:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802170:	83 c4 10             	add    $0x10,%esp
+  802173:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802178:	eb 2e                	jmp    8021a8 <pipe+0x141>
+	sys_page_unmap(0, va);
+  80217a:	83 ec 08             	sub    $0x8,%esp
+  80217d:	56                   	push   %esi
+  80217e:	6a 00                	push   $0x0
+  802180:	e8 74 ee ff ff       	call   800ff9 <sys_page_unmap>
+  802185:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802188:	83 ec 08             	sub    $0x8,%esp
+  80218b:	ff 75 f0             	push   -0x10(%ebp)
+  80218e:	6a 00                	push   $0x0
+  802190:	e8 64 ee ff ff       	call   800ff9 <sys_page_unmap>
+  802195:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802198:	83 ec 08             	sub    $0x8,%esp
+  80219b:	ff 75 f4             	push   -0xc(%ebp)
+  80219e:	6a 00                	push   $0x0
+  8021a0:	e8 54 ee ff ff       	call   800ff9 <sys_page_unmap>
+  8021a5:	83 c4 10             	add    $0x10,%esp
+}
+  8021a8:	89 d8                	mov    %ebx,%eax
+  8021aa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021ad:	5b                   	pop    %ebx
+  8021ae:	5e                   	pop    %esi
+  8021af:	5d                   	pop    %ebp
+  8021b0:	c3                   	ret
+
+008021b1 <pipeisclosed>:
+{
+  8021b1:	55                   	push   %ebp
+  8021b2:	89 e5                	mov    %esp,%ebp
+  8021b4:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8021b7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021ba:	50                   	push   %eax
+  8021bb:	ff 75 08             	push   0x8(%ebp)
+  8021be:	e8 01 f1 ff ff       	call   8012c4 <fd_lookup>
+  8021c3:	83 c4 10             	add    $0x10,%esp
+  8021c6:	85 c0                	test   %eax,%eax
+  8021c8:	78 18                	js     8021e2 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8021ca:	83 ec 0c             	sub    $0xc,%esp
+  8021cd:	ff 75 f4             	push   -0xc(%ebp)
+  8021d0:	e8 82 f0 ff ff       	call   801257 <fd2data>
+  8021d5:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8021d7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021da:	e8 33 fd ff ff       	call   801f12 <_pipeisclosed>
+  8021df:	83 c4 10             	add    $0x10,%esp
+}
+  8021e2:	c9                   	leave
+  8021e3:	c3                   	ret
+
+008021e4 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8021e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021e9:	c3                   	ret
+
+008021ea <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8021ea:	55                   	push   %ebp
+  8021eb:	89 e5                	mov    %esp,%ebp
+  8021ed:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8021f0:	68 0b 2f 80 00       	push   $0x802f0b
+  8021f5:	ff 75 0c             	push   0xc(%ebp)
+  8021f8:	e8 8b e9 ff ff       	call   800b88 <strcpy>
+	return 0;
+}
+  8021fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802202:	c9                   	leave
+  802203:	c3                   	ret
+
+00802204 <devcons_write>:
+{
+  802204:	55                   	push   %ebp
+  802205:	89 e5                	mov    %esp,%ebp
+  802207:	57                   	push   %edi
+  802208:	56                   	push   %esi
+  802209:	53                   	push   %ebx
+  80220a:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802210:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802215:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80221b:	eb 2e                	jmp    80224b <devcons_write+0x47>
+		m = n - tot;
+  80221d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802220:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802222:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802227:	39 c3                	cmp    %eax,%ebx
+  802229:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80222c:	83 ec 04             	sub    $0x4,%esp
+  80222f:	53                   	push   %ebx
+  802230:	89 f0                	mov    %esi,%eax
+  802232:	03 45 0c             	add    0xc(%ebp),%eax
+  802235:	50                   	push   %eax
+  802236:	57                   	push   %edi
+  802237:	e8 d2 ea ff ff       	call   800d0e <memmove>
+		sys_cputs(buf, m);
+  80223c:	83 c4 08             	add    $0x8,%esp
+  80223f:	53                   	push   %ebx
+  802240:	57                   	push   %edi
+  802241:	e8 72 ec ff ff       	call   800eb8 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802246:	01 de                	add    %ebx,%esi
+  802248:	83 c4 10             	add    $0x10,%esp
+  80224b:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80224e:	72 cd                	jb     80221d <devcons_write+0x19>
+}
+  802250:	89 f0                	mov    %esi,%eax
+  802252:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802255:	5b                   	pop    %ebx
+  802256:	5e                   	pop    %esi
+  802257:	5f                   	pop    %edi
+  802258:	5d                   	pop    %ebp
+  802259:	c3                   	ret
+
+0080225a <devcons_read>:
+{
+  80225a:	55                   	push   %ebp
+  80225b:	89 e5                	mov    %esp,%ebp
+  80225d:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802260:	b8 00 00 00 00       	mov    $0x0,%eax
+  802265:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802269:	75 07                	jne    802272 <devcons_read+0x18>
+  80226b:	eb 1f                	jmp    80228c <devcons_read+0x32>
+		sys_yield();
+  80226d:	e8 e3 ec ff ff       	call   800f55 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802272:	e8 5f ec ff ff       	call   800ed6 <sys_cgetc>
+  802277:	85 c0                	test   %eax,%eax
+  802279:	74 f2                	je     80226d <devcons_read+0x13>
+	if (c < 0)
+  80227b:	78 0f                	js     80228c <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80227d:	83 f8 04             	cmp    $0x4,%eax
+  802280:	74 0c                	je     80228e <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802282:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802285:	88 02                	mov    %al,(%edx)
+	return 1;
+  802287:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80228c:	c9                   	leave
+  80228d:	c3                   	ret
+		return 0;
+  80228e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802293:	eb f7                	jmp    80228c <devcons_read+0x32>
+
+00802295 <cputchar>:
+{
+  802295:	55                   	push   %ebp
+  802296:	89 e5                	mov    %esp,%ebp
+  802298:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80229b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80229e:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8022a1:	6a 01                	push   $0x1
+  8022a3:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8022a6:	50                   	push   %eax
+  8022a7:	e8 0c ec ff ff       	call   800eb8 <sys_cputs>
+}
+  8022ac:	83 c4 10             	add    $0x10,%esp
+  8022af:	c9                   	leave
+  8022b0:	c3                   	ret
+
+008022b1 <getchar>:
+{
+  8022b1:	55                   	push   %ebp
+  8022b2:	89 e5                	mov    %esp,%ebp
+  8022b4:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8022b7:	6a 01                	push   $0x1
+  8022b9:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8022bc:	50                   	push   %eax
+  8022bd:	6a 00                	push   $0x0
+  8022bf:	e8 66 f2 ff ff       	call   80152a <read>
+	if (r < 0)
+  8022c4:	83 c4 10             	add    $0x10,%esp
+  8022c7:	85 c0                	test   %eax,%eax
+  8022c9:	78 06                	js     8022d1 <getchar+0x20>
+	if (r < 1)
+  8022cb:	74 06                	je     8022d3 <getchar+0x22>
+	return c;
+  8022cd:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8022d1:	c9                   	leave
+  8022d2:	c3                   	ret
+		return -E_EOF;
+  8022d3:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8022d8:	eb f7                	jmp    8022d1 <getchar+0x20>
+
+008022da <iscons>:
+{
+  8022da:	55                   	push   %ebp
+  8022db:	89 e5                	mov    %esp,%ebp
+  8022dd:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8022e0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022e3:	50                   	push   %eax
+  8022e4:	ff 75 08             	push   0x8(%ebp)
+  8022e7:	e8 d8 ef ff ff       	call   8012c4 <fd_lookup>
+  8022ec:	83 c4 10             	add    $0x10,%esp
+  8022ef:	85 c0                	test   %eax,%eax
+  8022f1:	78 11                	js     802304 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8022f3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022f6:	8b 15 5c 30 80 00    	mov    0x80305c,%edx
+  8022fc:	39 10                	cmp    %edx,(%eax)
+  8022fe:	0f 94 c0             	sete   %al
+  802301:	0f b6 c0             	movzbl %al,%eax
+}
+  802304:	c9                   	leave
+  802305:	c3                   	ret
+
+00802306 <opencons>:
+{
+  802306:	55                   	push   %ebp
+  802307:	89 e5                	mov    %esp,%ebp
+  802309:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80230c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80230f:	50                   	push   %eax
+  802310:	e8 59 ef ff ff       	call   80126e <fd_alloc>
+  802315:	83 c4 10             	add    $0x10,%esp
+  802318:	85 c0                	test   %eax,%eax
+  80231a:	78 3a                	js     802356 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80231c:	83 ec 04             	sub    $0x4,%esp
+  80231f:	68 07 04 00 00       	push   $0x407
+  802324:	ff 75 f4             	push   -0xc(%ebp)
+  802327:	6a 00                	push   $0x0
+  802329:	e8 46 ec ff ff       	call   800f74 <sys_page_alloc>
+  80232e:	83 c4 10             	add    $0x10,%esp
+  802331:	85 c0                	test   %eax,%eax
+  802333:	78 21                	js     802356 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802335:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802338:	8b 15 5c 30 80 00    	mov    0x80305c,%edx
+  80233e:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802340:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802343:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80234a:	83 ec 0c             	sub    $0xc,%esp
+  80234d:	50                   	push   %eax
+  80234e:	e8 f4 ee ff ff       	call   801247 <fd2num>
+  802353:	83 c4 10             	add    $0x10,%esp
+}
+  802356:	c9                   	leave
+  802357:	c3                   	ret
+
+00802358 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  802358:	55                   	push   %ebp
+  802359:	89 e5                	mov    %esp,%ebp
+  80235b:	56                   	push   %esi
+  80235c:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80235d:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  802360:	8b 35 04 30 80 00    	mov    0x803004,%esi
+  802366:	e8 cb eb ff ff       	call   800f36 <sys_getenvid>
+  80236b:	83 ec 0c             	sub    $0xc,%esp
+  80236e:	ff 75 0c             	push   0xc(%ebp)
+  802371:	ff 75 08             	push   0x8(%ebp)
+  802374:	56                   	push   %esi
+  802375:	50                   	push   %eax
+  802376:	68 18 2f 80 00       	push   $0x802f18
+  80237b:	e8 4f e2 ff ff       	call   8005cf <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  802380:	83 c4 18             	add    $0x18,%esp
+  802383:	53                   	push   %ebx
+  802384:	ff 75 10             	push   0x10(%ebp)
+  802387:	e8 f2 e1 ff ff       	call   80057e <vcprintf>
+	cprintf("\n");
+  80238c:	c7 04 24 54 2a 80 00 	movl   $0x802a54,(%esp)
+  802393:	e8 37 e2 ff ff       	call   8005cf <cprintf>
+  802398:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80239b:	cc                   	int3
+	while (1)
+  80239c:	eb fd                	jmp    80239b <_panic+0x43>
+
+0080239e <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  80239e:	55                   	push   %ebp
+  80239f:	89 e5                	mov    %esp,%ebp
+  8023a1:	56                   	push   %esi
+  8023a2:	53                   	push   %ebx
+  8023a3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8023a6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023a9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  8023ac:	85 c0                	test   %eax,%eax
+  8023ae:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8023b3:	0f 44 c2             	cmove  %edx,%eax
+  8023b6:	83 ec 0c             	sub    $0xc,%esp
+  8023b9:	50                   	push   %eax
+  8023ba:	e8 65 ed ff ff       	call   801124 <sys_ipc_recv>
+
+  if (from_env_store)
+  8023bf:	83 c4 10             	add    $0x10,%esp
+  8023c2:	85 f6                	test   %esi,%esi
+  8023c4:	74 17                	je     8023dd <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  8023c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023cb:	85 c0                	test   %eax,%eax
+  8023cd:	75 0c                	jne    8023db <ipc_recv+0x3d>
+  8023cf:	8b 15 18 40 80 00    	mov    0x804018,%edx
+  8023d5:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  8023db:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  8023dd:	85 db                	test   %ebx,%ebx
+  8023df:	74 2b                	je     80240c <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  8023e1:	85 c0                	test   %eax,%eax
+  8023e3:	74 0d                	je     8023f2 <ipc_recv+0x54>
+  8023e5:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  8023eb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023ee:	5b                   	pop    %ebx
+  8023ef:	5e                   	pop    %esi
+  8023f0:	5d                   	pop    %ebp
+  8023f1:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  8023f2:	a1 18 40 80 00       	mov    0x804018,%eax
+  8023f7:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8023fd:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  8023ff:	a1 18 40 80 00       	mov    0x804018,%eax
+  802404:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  80240a:	eb df                	jmp    8023eb <ipc_recv+0x4d>
+  80240c:	85 c0                	test   %eax,%eax
+  80240e:	75 db                	jne    8023eb <ipc_recv+0x4d>
+  802410:	eb ed                	jmp    8023ff <ipc_recv+0x61>
+
+00802412 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  802412:	55                   	push   %ebp
+  802413:	89 e5                	mov    %esp,%ebp
+  802415:	57                   	push   %edi
+  802416:	56                   	push   %esi
+  802417:	53                   	push   %ebx
+  802418:	83 ec 0c             	sub    $0xc,%esp
+  80241b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80241e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802421:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  802424:	85 db                	test   %ebx,%ebx
+  802426:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80242b:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  80242e:	ff 75 14             	push   0x14(%ebp)
+  802431:	53                   	push   %ebx
+  802432:	56                   	push   %esi
+  802433:	57                   	push   %edi
+  802434:	e8 c8 ec ff ff       	call   801101 <sys_ipc_try_send>
+  802439:	83 c4 10             	add    $0x10,%esp
+  80243c:	85 c0                	test   %eax,%eax
+  80243e:	74 1e                	je     80245e <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  802440:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802443:	75 07                	jne    80244c <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  802445:	e8 0b eb ff ff       	call   800f55 <sys_yield>
+  80244a:	eb e2                	jmp    80242e <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  80244c:	50                   	push   %eax
+  80244d:	68 3b 2f 80 00       	push   $0x802f3b
+  802452:	6a 3c                	push   $0x3c
+  802454:	68 48 2f 80 00       	push   $0x802f48
+  802459:	e8 fa fe ff ff       	call   802358 <_panic>
+  }
+
+#endif
+}
+  80245e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802461:	5b                   	pop    %ebx
+  802462:	5e                   	pop    %esi
+  802463:	5f                   	pop    %edi
+  802464:	5d                   	pop    %ebp
+  802465:	c3                   	ret
+
+00802466 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  802466:	55                   	push   %ebp
+  802467:	89 e5                	mov    %esp,%ebp
+  802469:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  80246c:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  802471:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802474:	c1 e0 04             	shl    $0x4,%eax
+  802477:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80247c:	8b 40 50             	mov    0x50(%eax),%eax
+  80247f:	39 c8                	cmp    %ecx,%eax
+  802481:	74 12                	je     802495 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  802483:	83 c2 01             	add    $0x1,%edx
+  802486:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  80248c:	75 e3                	jne    802471 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  80248e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802493:	eb 0e                	jmp    8024a3 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  802495:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802498:	c1 e0 04             	shl    $0x4,%eax
+  80249b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8024a0:	8b 40 48             	mov    0x48(%eax),%eax
+  8024a3:	5d                   	pop    %ebp
+  8024a4:	c3                   	ret
+
+008024a5 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8024a5:	55                   	push   %ebp
+  8024a6:	89 e5                	mov    %esp,%ebp
+  8024a8:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8024ab:	89 c2                	mov    %eax,%edx
+  8024ad:	c1 ea 16             	shr    $0x16,%edx
+  8024b0:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8024b7:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8024bc:	f6 c1 01             	test   $0x1,%cl
+  8024bf:	74 1c                	je     8024dd <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  8024c1:	c1 e8 0c             	shr    $0xc,%eax
+  8024c4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8024cb:	a8 01                	test   $0x1,%al
+  8024cd:	74 0e                	je     8024dd <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8024cf:	c1 e8 0c             	shr    $0xc,%eax
+  8024d2:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  8024d9:	ef 
+  8024da:	0f b7 d2             	movzwl %dx,%edx
+}
+  8024dd:	89 d0                	mov    %edx,%eax
+  8024df:	5d                   	pop    %ebp
+  8024e0:	c3                   	ret
+  8024e1:	66 90                	xchg   %ax,%ax
+  8024e3:	66 90                	xchg   %ax,%ax
+  8024e5:	66 90                	xchg   %ax,%ax
+  8024e7:	66 90                	xchg   %ax,%ax
+  8024e9:	66 90                	xchg   %ax,%ax
+  8024eb:	66 90                	xchg   %ax,%ax
+  8024ed:	66 90                	xchg   %ax,%ax
+  8024ef:	90                   	nop
+
+008024f0 <__udivmoddi4>:
+  8024f0:	55                   	push   %ebp
+  8024f1:	57                   	push   %edi
+  8024f2:	56                   	push   %esi
+  8024f3:	53                   	push   %ebx
+  8024f4:	83 ec 24             	sub    $0x24,%esp
+  8024f7:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8024fb:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8024ff:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  802503:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802507:	8b 54 24 44          	mov    0x44(%esp),%edx
+  80250b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80250f:	8b 44 24 40          	mov    0x40(%esp),%eax
+  802513:	89 d3                	mov    %edx,%ebx
+  802515:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802519:	09 c3                	or     %eax,%ebx
+  80251b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80251f:	0f 84 9c 00 00 00    	je     8025c1 <__udivmoddi4+0xd1>
+  802525:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80252c:	00 
+  80252d:	31 c0                	xor    %eax,%eax
+  80252f:	31 d2                	xor    %edx,%edx
+  802531:	89 fb                	mov    %edi,%ebx
+  802533:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80253a:	00 
+  80253b:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802540:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802544:	01 c0                	add    %eax,%eax
+  802546:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80254d:	00 
+  80254e:	89 c6                	mov    %eax,%esi
+  802550:	89 d7                	mov    %edx,%edi
+  802552:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802556:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80255a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80255d:	d3 ea                	shr    %cl,%edx
+  80255f:	f6 c1 20             	test   $0x20,%cl
+  802562:	0f 45 c2             	cmovne %edx,%eax
+  802565:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802569:	83 e0 01             	and    $0x1,%eax
+  80256c:	09 fa                	or     %edi,%edx
+  80256e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802572:	89 04 24             	mov    %eax,(%esp)
+  802575:	8b 04 24             	mov    (%esp),%eax
+  802578:	89 d5                	mov    %edx,%ebp
+  80257a:	09 f0                	or     %esi,%eax
+  80257c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802580:	39 f0                	cmp    %esi,%eax
+  802582:	19 fd                	sbb    %edi,%ebp
+  802584:	72 1d                	jb     8025a3 <__udivmoddi4+0xb3>
+  802586:	29 f0                	sub    %esi,%eax
+  802588:	19 fa                	sbb    %edi,%edx
+  80258a:	89 cf                	mov    %ecx,%edi
+  80258c:	c1 ef 05             	shr    $0x5,%edi
+  80258f:	83 e7 01             	and    $0x1,%edi
+  802592:	89 fe                	mov    %edi,%esi
+  802594:	d3 e7                	shl    %cl,%edi
+  802596:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80259a:	83 f6 01             	xor    $0x1,%esi
+  80259d:	d3 e6                	shl    %cl,%esi
+  80259f:	09 74 24 18          	or     %esi,0x18(%esp)
+  8025a3:	83 e9 01             	sub    $0x1,%ecx
+  8025a6:	73 98                	jae    802540 <__udivmoddi4+0x50>
+  8025a8:	85 db                	test   %ebx,%ebx
+  8025aa:	74 05                	je     8025b1 <__udivmoddi4+0xc1>
+  8025ac:	89 03                	mov    %eax,(%ebx)
+  8025ae:	89 53 04             	mov    %edx,0x4(%ebx)
+  8025b1:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8025b5:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8025b9:	83 c4 24             	add    $0x24,%esp
+  8025bc:	5b                   	pop    %ebx
+  8025bd:	5e                   	pop    %esi
+  8025be:	5f                   	pop    %edi
+  8025bf:	5d                   	pop    %ebp
+  8025c0:	c3                   	ret
+  8025c1:	85 ff                	test   %edi,%edi
+  8025c3:	74 0d                	je     8025d2 <__udivmoddi4+0xe2>
+  8025c5:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  8025cb:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  8025d2:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8025d6:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8025da:	89 44 24 18          	mov    %eax,0x18(%esp)
+  8025de:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8025e2:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  8025e6:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8025ea:	83 c4 24             	add    $0x24,%esp
+  8025ed:	5b                   	pop    %ebx
+  8025ee:	5e                   	pop    %esi
+  8025ef:	5f                   	pop    %edi
+  8025f0:	5d                   	pop    %ebp
+  8025f1:	c3                   	ret
+  8025f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8025f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00802600 <__udivdi3>:
+  802600:	57                   	push   %edi
+  802601:	56                   	push   %esi
+  802602:	53                   	push   %ebx
+  802603:	83 ec 20             	sub    $0x20,%esp
+  802606:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80260a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80260e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802612:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802616:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80261a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80261e:	89 d1                	mov    %edx,%ecx
+  802620:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802624:	09 c1                	or     %eax,%ecx
+  802626:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80262a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80262e:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802632:	0f 84 88 00 00 00    	je     8026c0 <__udivdi3+0xc0>
+  802638:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80263f:	00 
+  802640:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802645:	31 c0                	xor    %eax,%eax
+  802647:	31 d2                	xor    %edx,%edx
+  802649:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802650:	00 
+  802651:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802658:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80265c:	01 c0                	add    %eax,%eax
+  80265e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802665:	00 
+  802666:	89 c6                	mov    %eax,%esi
+  802668:	89 d7                	mov    %edx,%edi
+  80266a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80266e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802672:	0f ad d0             	shrd   %cl,%edx,%eax
+  802675:	d3 ea                	shr    %cl,%edx
+  802677:	f6 c1 20             	test   $0x20,%cl
+  80267a:	0f 45 c2             	cmovne %edx,%eax
+  80267d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802681:	83 e0 01             	and    $0x1,%eax
+  802684:	09 fa                	or     %edi,%edx
+  802686:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80268a:	89 04 24             	mov    %eax,(%esp)
+  80268d:	8b 04 24             	mov    (%esp),%eax
+  802690:	89 d3                	mov    %edx,%ebx
+  802692:	09 f0                	or     %esi,%eax
+  802694:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802698:	39 f0                	cmp    %esi,%eax
+  80269a:	19 fb                	sbb    %edi,%ebx
+  80269c:	72 1d                	jb     8026bb <__udivdi3+0xbb>
+  80269e:	29 f0                	sub    %esi,%eax
+  8026a0:	19 fa                	sbb    %edi,%edx
+  8026a2:	89 cf                	mov    %ecx,%edi
+  8026a4:	c1 ef 05             	shr    $0x5,%edi
+  8026a7:	83 e7 01             	and    $0x1,%edi
+  8026aa:	89 fe                	mov    %edi,%esi
+  8026ac:	d3 e7                	shl    %cl,%edi
+  8026ae:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8026b2:	83 f6 01             	xor    $0x1,%esi
+  8026b5:	d3 e6                	shl    %cl,%esi
+  8026b7:	09 74 24 18          	or     %esi,0x18(%esp)
+  8026bb:	83 e9 01             	sub    $0x1,%ecx
+  8026be:	73 98                	jae    802658 <__udivdi3+0x58>
+  8026c0:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8026c4:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8026c8:	83 c4 20             	add    $0x20,%esp
+  8026cb:	5b                   	pop    %ebx
+  8026cc:	5e                   	pop    %esi
+  8026cd:	5f                   	pop    %edi
+  8026ce:	c3                   	ret
+  8026cf:	90                   	nop
+
+008026d0 <__umoddi3>:
+  8026d0:	57                   	push   %edi
+  8026d1:	56                   	push   %esi
+  8026d2:	53                   	push   %ebx
+  8026d3:	83 ec 18             	sub    $0x18,%esp
+  8026d6:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8026da:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8026de:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8026e2:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8026e6:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8026ea:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8026ee:	89 d1                	mov    %edx,%ecx
+  8026f0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8026f4:	09 c1                	or     %eax,%ecx
+  8026f6:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8026fa:	74 5b                	je     802757 <__umoddi3+0x87>
+  8026fc:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802701:	31 c0                	xor    %eax,%eax
+  802703:	31 d2                	xor    %edx,%edx
+  802705:	8d 76 00             	lea    0x0(%esi),%esi
+  802708:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80270c:	01 c0                	add    %eax,%eax
+  80270e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802715:	00 
+  802716:	89 c6                	mov    %eax,%esi
+  802718:	89 d7                	mov    %edx,%edi
+  80271a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80271e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802722:	0f ad d0             	shrd   %cl,%edx,%eax
+  802725:	d3 ea                	shr    %cl,%edx
+  802727:	f6 c1 20             	test   $0x20,%cl
+  80272a:	0f 45 c2             	cmovne %edx,%eax
+  80272d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802731:	83 e0 01             	and    $0x1,%eax
+  802734:	09 fa                	or     %edi,%edx
+  802736:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80273a:	89 04 24             	mov    %eax,(%esp)
+  80273d:	8b 04 24             	mov    (%esp),%eax
+  802740:	89 d3                	mov    %edx,%ebx
+  802742:	09 f0                	or     %esi,%eax
+  802744:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802748:	39 f0                	cmp    %esi,%eax
+  80274a:	19 fb                	sbb    %edi,%ebx
+  80274c:	72 04                	jb     802752 <__umoddi3+0x82>
+  80274e:	29 f0                	sub    %esi,%eax
+  802750:	19 fa                	sbb    %edi,%edx
+  802752:	83 e9 01             	sub    $0x1,%ecx
+  802755:	73 b1                	jae    802708 <__umoddi3+0x38>
+  802757:	83 c4 18             	add    $0x18,%esp
+  80275a:	5b                   	pop    %ebx
+  80275b:	5e                   	pop    %esi
+  80275c:	5f                   	pop    %edi
+  80275d:	c3                   	ret
+  80275e:	66 90                	xchg   %ax,%ax
+
+00802760 <__divdi3>:
+  802760:	55                   	push   %ebp
+  802761:	57                   	push   %edi
+  802762:	56                   	push   %esi
+  802763:	53                   	push   %ebx
+  802764:	83 ec 24             	sub    $0x24,%esp
+  802767:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  80276b:	8b 74 24 44          	mov    0x44(%esp),%esi
+  80276f:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802773:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802777:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  80277b:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  80277f:	85 d2                	test   %edx,%edx
+  802781:	0f 88 e0 00 00 00    	js     802867 <__divdi3+0x107>
+  802787:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  80278b:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  80278f:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802793:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802797:	85 f6                	test   %esi,%esi
+  802799:	78 16                	js     8027b1 <__divdi3+0x51>
+  80279b:	89 f1                	mov    %esi,%ecx
+  80279d:	31 c0                	xor    %eax,%eax
+  80279f:	31 d2                	xor    %edx,%edx
+  8027a1:	09 d9                	or     %ebx,%ecx
+  8027a3:	0f 85 f3 00 00 00    	jne    80289c <__divdi3+0x13c>
+  8027a9:	83 c4 24             	add    $0x24,%esp
+  8027ac:	5b                   	pop    %ebx
+  8027ad:	5e                   	pop    %esi
+  8027ae:	5f                   	pop    %edi
+  8027af:	5d                   	pop    %ebp
+  8027b0:	c3                   	ret
+  8027b1:	bf 01 00 00 00       	mov    $0x1,%edi
+  8027b6:	f7 5c 24 08          	negl   0x8(%esp)
+  8027ba:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  8027bf:	f7 5c 24 0c          	negl   0xc(%esp)
+  8027c3:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8027ca:	00 
+  8027cb:	31 c0                	xor    %eax,%eax
+  8027cd:	31 d2                	xor    %edx,%edx
+  8027cf:	89 fb                	mov    %edi,%ebx
+  8027d1:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8027d8:	00 
+  8027d9:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8027de:	66 90                	xchg   %ax,%ax
+  8027e0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8027e4:	01 c0                	add    %eax,%eax
+  8027e6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8027ed:	00 
+  8027ee:	89 c6                	mov    %eax,%esi
+  8027f0:	89 d7                	mov    %edx,%edi
+  8027f2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8027f6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8027fa:	0f ad d0             	shrd   %cl,%edx,%eax
+  8027fd:	d3 ea                	shr    %cl,%edx
+  8027ff:	f6 c1 20             	test   $0x20,%cl
+  802802:	0f 45 c2             	cmovne %edx,%eax
+  802805:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802809:	83 e0 01             	and    $0x1,%eax
+  80280c:	09 fa                	or     %edi,%edx
+  80280e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802812:	89 04 24             	mov    %eax,(%esp)
+  802815:	8b 04 24             	mov    (%esp),%eax
+  802818:	89 d5                	mov    %edx,%ebp
+  80281a:	09 f0                	or     %esi,%eax
+  80281c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802820:	39 f0                	cmp    %esi,%eax
+  802822:	19 fd                	sbb    %edi,%ebp
+  802824:	72 1d                	jb     802843 <__divdi3+0xe3>
+  802826:	29 f0                	sub    %esi,%eax
+  802828:	19 fa                	sbb    %edi,%edx
+  80282a:	89 cf                	mov    %ecx,%edi
+  80282c:	c1 ef 05             	shr    $0x5,%edi
+  80282f:	83 e7 01             	and    $0x1,%edi
+  802832:	89 fe                	mov    %edi,%esi
+  802834:	d3 e7                	shl    %cl,%edi
+  802836:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80283a:	83 f6 01             	xor    $0x1,%esi
+  80283d:	d3 e6                	shl    %cl,%esi
+  80283f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802843:	83 e9 01             	sub    $0x1,%ecx
+  802846:	73 98                	jae    8027e0 <__divdi3+0x80>
+  802848:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80284c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802850:	85 db                	test   %ebx,%ebx
+  802852:	0f 84 51 ff ff ff    	je     8027a9 <__divdi3+0x49>
+  802858:	f7 d8                	neg    %eax
+  80285a:	83 d2 00             	adc    $0x0,%edx
+  80285d:	83 c4 24             	add    $0x24,%esp
+  802860:	5b                   	pop    %ebx
+  802861:	f7 da                	neg    %edx
+  802863:	5e                   	pop    %esi
+  802864:	5f                   	pop    %edi
+  802865:	5d                   	pop    %ebp
+  802866:	c3                   	ret
+  802867:	f7 d8                	neg    %eax
+  802869:	83 d2 00             	adc    $0x0,%edx
+  80286c:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802870:	f7 da                	neg    %edx
+  802872:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802876:	85 f6                	test   %esi,%esi
+  802878:	78 1b                	js     802895 <__divdi3+0x135>
+  80287a:	89 f1                	mov    %esi,%ecx
+  80287c:	31 c0                	xor    %eax,%eax
+  80287e:	31 d2                	xor    %edx,%edx
+  802880:	bf 01 00 00 00       	mov    $0x1,%edi
+  802885:	09 d9                	or     %ebx,%ecx
+  802887:	0f 85 36 ff ff ff    	jne    8027c3 <__divdi3+0x63>
+  80288d:	83 c4 24             	add    $0x24,%esp
+  802890:	5b                   	pop    %ebx
+  802891:	5e                   	pop    %esi
+  802892:	5f                   	pop    %edi
+  802893:	5d                   	pop    %ebp
+  802894:	c3                   	ret
+  802895:	31 ff                	xor    %edi,%edi
+  802897:	e9 1a ff ff ff       	jmp    8027b6 <__divdi3+0x56>
+  80289c:	31 ff                	xor    %edi,%edi
+  80289e:	e9 20 ff ff ff       	jmp    8027c3 <__divdi3+0x63>
+  8028a3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8028aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+008028b0 <__moddi3>:
+  8028b0:	55                   	push   %ebp
+  8028b1:	57                   	push   %edi
+  8028b2:	56                   	push   %esi
+  8028b3:	53                   	push   %ebx
+  8028b4:	83 ec 1c             	sub    $0x1c,%esp
+  8028b7:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  8028bb:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  8028bf:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  8028c3:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  8028c7:	89 c8                	mov    %ecx,%eax
+  8028c9:	89 f2                	mov    %esi,%edx
+  8028cb:	89 f3                	mov    %esi,%ebx
+  8028cd:	85 ed                	test   %ebp,%ebp
+  8028cf:	0f 88 9d 00 00 00    	js     802972 <__moddi3+0xc2>
+  8028d5:	09 cb                	or     %ecx,%ebx
+  8028d7:	0f 84 8d 00 00 00    	je     80296a <__moddi3+0xba>
+  8028dd:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  8028e1:	31 db                	xor    %ebx,%ebx
+  8028e3:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  8028e7:	89 ca                	mov    %ecx,%edx
+  8028e9:	89 f0                	mov    %esi,%eax
+  8028eb:	89 dd                	mov    %ebx,%ebp
+  8028ed:	f7 da                	neg    %edx
+  8028ef:	83 d0 00             	adc    $0x0,%eax
+  8028f2:	f7 d8                	neg    %eax
+  8028f4:	0f 49 f0             	cmovns %eax,%esi
+  8028f7:	0f 49 ca             	cmovns %edx,%ecx
+  8028fa:	31 c0                	xor    %eax,%eax
+  8028fc:	31 d2                	xor    %edx,%edx
+  8028fe:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802902:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802906:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80290b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80290f:	90                   	nop
+  802910:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802914:	01 c0                	add    %eax,%eax
+  802916:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80291d:	00 
+  80291e:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  802922:	89 c6                	mov    %eax,%esi
+  802924:	89 d7                	mov    %edx,%edi
+  802926:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80292a:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80292e:	0f ad d0             	shrd   %cl,%edx,%eax
+  802931:	d3 ea                	shr    %cl,%edx
+  802933:	f6 c1 20             	test   $0x20,%cl
+  802936:	0f 45 c2             	cmovne %edx,%eax
+  802939:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80293d:	83 e0 01             	and    $0x1,%eax
+  802940:	09 fa                	or     %edi,%edx
+  802942:	89 04 24             	mov    %eax,(%esp)
+  802945:	8b 04 24             	mov    (%esp),%eax
+  802948:	89 d7                	mov    %edx,%edi
+  80294a:	09 f0                	or     %esi,%eax
+  80294c:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  802950:	39 d8                	cmp    %ebx,%eax
+  802952:	19 f7                	sbb    %esi,%edi
+  802954:	72 04                	jb     80295a <__moddi3+0xaa>
+  802956:	29 d8                	sub    %ebx,%eax
+  802958:	19 f2                	sbb    %esi,%edx
+  80295a:	83 e9 01             	sub    $0x1,%ecx
+  80295d:	73 b1                	jae    802910 <__moddi3+0x60>
+  80295f:	85 ed                	test   %ebp,%ebp
+  802961:	74 07                	je     80296a <__moddi3+0xba>
+  802963:	f7 d8                	neg    %eax
+  802965:	83 d2 00             	adc    $0x0,%edx
+  802968:	f7 da                	neg    %edx
+  80296a:	83 c4 1c             	add    $0x1c,%esp
+  80296d:	5b                   	pop    %ebx
+  80296e:	5e                   	pop    %esi
+  80296f:	5f                   	pop    %edi
+  802970:	5d                   	pop    %ebp
+  802971:	c3                   	ret
+  802972:	09 cb                	or     %ecx,%ebx
+  802974:	74 f4                	je     80296a <__moddi3+0xba>
+  802976:	f7 df                	neg    %edi
+  802978:	bb 01 00 00 00       	mov    $0x1,%ebx
+  80297d:	83 d5 00             	adc    $0x0,%ebp
+  802980:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802984:	f7 dd                	neg    %ebp
+  802986:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  80298a:	e9 58 ff ff ff       	jmp    8028e7 <__moddi3+0x37>
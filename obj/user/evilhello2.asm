@@ -0,0 +1,5405 @@
+
+obj/user/evilhello2.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 1e 01 00 00       	call   80014f <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <evil>:
+struct Segdesc old;
+struct Segdesc *gdt;
+struct Segdesc *entry;
+
+// Call this function with ring0 privilege
+void evil() {
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  // Kernel memory access
+  *(char *) 0xf010000a = 0;
+  800037:	c6 05 0a 00 10 f0 00 	movb   $0x0,0xf010000a
+}
+
+static inline void
+outb(int port, uint8_t data)
+{
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  80003e:	bb 49 00 00 00       	mov    $0x49,%ebx
+  800043:	ba f8 03 00 00       	mov    $0x3f8,%edx
+  800048:	89 d8                	mov    %ebx,%eax
+  80004a:	ee                   	out    %al,(%dx)
+  80004b:	b9 4e 00 00 00       	mov    $0x4e,%ecx
+  800050:	89 c8                	mov    %ecx,%eax
+  800052:	ee                   	out    %al,(%dx)
+  800053:	b8 20 00 00 00       	mov    $0x20,%eax
+  800058:	ee                   	out    %al,(%dx)
+  800059:	b8 52 00 00 00       	mov    $0x52,%eax
+  80005e:	ee                   	out    %al,(%dx)
+  80005f:	89 d8                	mov    %ebx,%eax
+  800061:	ee                   	out    %al,(%dx)
+  800062:	89 c8                	mov    %ecx,%eax
+  800064:	ee                   	out    %al,(%dx)
+  800065:	b8 47 00 00 00       	mov    $0x47,%eax
+  80006a:	ee                   	out    %al,(%dx)
+  80006b:	b8 30 00 00 00       	mov    $0x30,%eax
+  800070:	ee                   	out    %al,(%dx)
+  800071:	b8 21 00 00 00       	mov    $0x21,%eax
+  800076:	ee                   	out    %al,(%dx)
+  800077:	ee                   	out    %al,(%dx)
+  800078:	ee                   	out    %al,(%dx)
+  800079:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80007e:	ee                   	out    %al,(%dx)
+  outb(0x3f8, '0');
+  outb(0x3f8, '!');
+  outb(0x3f8, '!');
+  outb(0x3f8, '!');
+  outb(0x3f8, '\n');
+}
+  80007f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800082:	c9                   	leave
+  800083:	c3                   	ret
+
+00800084 <call_fun_ptr>:
+
+void call_fun_ptr() {
+  800084:	55                   	push   %ebp
+  800085:	89 e5                	mov    %esp,%ebp
+  800087:	83 ec 08             	sub    $0x8,%esp
+  evil();
+  80008a:	e8 a4 ff ff ff       	call   800033 <evil>
+  *entry = old;
+  80008f:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  800095:	a1 44 50 80 00       	mov    0x805044,%eax
+  80009a:	8b 15 48 50 80 00    	mov    0x805048,%edx
+  8000a0:	89 01                	mov    %eax,(%ecx)
+  8000a2:	89 51 04             	mov    %edx,0x4(%ecx)
+  asm volatile("leave");
+  8000a5:	c9                   	leave
+  asm volatile("lret");
+  8000a6:	cb                   	lret
+}
+  8000a7:	c9                   	leave
+  8000a8:	c3                   	ret
+
+008000a9 <ring0_call>:
+sgdt(struct Pseudodesc *gdtd) {
+  __asm __volatile("sgdt %0" :  "=m" (*gdtd));
+}
+
+// Invoke a given function pointer with ring0 privilege, then return to ring3
+void ring0_call(void (*fun_ptr)(void)) {
+  8000a9:	55                   	push   %ebp
+  8000aa:	89 e5                	mov    %esp,%ebp
+  8000ac:	83 ec 20             	sub    $0x20,%esp
+  __asm __volatile("sgdt %0" :  "=m" (*gdtd));
+  8000af:	0f 01 45 f2          	sgdtl  -0xe(%ebp)
+
+  // Lab3 : Your Code Here
+  struct Pseudodesc r_gdt;
+  sgdt(&r_gdt);
+
+  int t = sys_map_kernel_page((void *) r_gdt.pd_base, (void *) vaddr);
+  8000b3:	68 40 40 80 00       	push   $0x804040
+  8000b8:	ff 75 f4             	push   -0xc(%ebp)
+  8000bb:	e8 1d 0d 00 00       	call   800ddd <sys_map_kernel_page>
+  if (t < 0) {
+  8000c0:	83 c4 10             	add    $0x10,%esp
+  8000c3:	85 c0                	test   %eax,%eax
+  8000c5:	78 5b                	js     800122 <ring0_call+0x79>
+    return;
+  }
+
+  uint32_t base = (uint32_t) (PGNUM(vaddr) << PTXSHIFT);
+  uint32_t index = GD_UD >> 3;
+  uint32_t offset = PGOFF(r_gdt.pd_base);
+  8000c7:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  8000ca:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  uint32_t base = (uint32_t) (PGNUM(vaddr) << PTXSHIFT);
+  8000d0:	b8 40 40 80 00       	mov    $0x804040,%eax
+  8000d5:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+
+  gdt = (struct Segdesc *) (base + offset);
+  8000da:	09 c1                	or     %eax,%ecx
+  8000dc:	89 0d 40 50 80 00    	mov    %ecx,0x805040
+  entry = gdt + index;
+  8000e2:	8d 41 20             	lea    0x20(%ecx),%eax
+  8000e5:	a3 20 40 80 00       	mov    %eax,0x804020
+  old = *entry;
+  8000ea:	8b 41 20             	mov    0x20(%ecx),%eax
+  8000ed:	8b 51 24             	mov    0x24(%ecx),%edx
+  8000f0:	a3 44 50 80 00       	mov    %eax,0x805044
+  8000f5:	89 15 48 50 80 00    	mov    %edx,0x805048
+
+  SETCALLGATE(*((struct Gatedesc *) entry), GD_KT, call_fun_ptr, 3);
+  8000fb:	b8 84 00 80 00       	mov    $0x800084,%eax
+  800100:	66 89 41 20          	mov    %ax,0x20(%ecx)
+  800104:	66 c7 41 22 08 00    	movw   $0x8,0x22(%ecx)
+  80010a:	c6 41 24 00          	movb   $0x0,0x24(%ecx)
+  80010e:	c6 41 25 ec          	movb   $0xec,0x25(%ecx)
+  800112:	c1 e8 10             	shr    $0x10,%eax
+  800115:	66 89 41 26          	mov    %ax,0x26(%ecx)
+  asm volatile("lcall $0x20, $0");
+  800119:	9a 00 00 00 00 20 00 	lcall  $0x20,$0x0
+}
+  800120:	c9                   	leave
+  800121:	c3                   	ret
+    cprintf("ring0_call: sys_map_kernel_page failed, %e\n", t);
+  800122:	83 ec 08             	sub    $0x8,%esp
+  800125:	50                   	push   %eax
+  800126:	68 00 26 80 00       	push   $0x802600
+  80012b:	e8 17 01 00 00       	call   800247 <cprintf>
+  800130:	83 c4 10             	add    $0x10,%esp
+  800133:	eb eb                	jmp    800120 <ring0_call+0x77>
+
+00800135 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800135:	55                   	push   %ebp
+  800136:	89 e5                	mov    %esp,%ebp
+  800138:	83 ec 14             	sub    $0x14,%esp
+  // call the evil function in ring0
+  ring0_call(&evil);
+  80013b:	68 33 00 80 00       	push   $0x800033
+  800140:	e8 64 ff ff ff       	call   8000a9 <ring0_call>
+
+  // call the evil function in ring3
+  evil();
+  800145:	e8 e9 fe ff ff       	call   800033 <evil>
+}
+  80014a:	83 c4 10             	add    $0x10,%esp
+  80014d:	c9                   	leave
+  80014e:	c3                   	ret
+
+0080014f <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  80014f:	55                   	push   %ebp
+  800150:	89 e5                	mov    %esp,%ebp
+  800152:	56                   	push   %esi
+  800153:	53                   	push   %ebx
+  800154:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800157:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  80015a:	e8 4f 0a 00 00       	call   800bae <sys_getenvid>
+  80015f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800164:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800167:	c1 e0 04             	shl    $0x4,%eax
+  80016a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80016f:	a3 4c 50 80 00       	mov    %eax,0x80504c
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800174:	85 db                	test   %ebx,%ebx
+  800176:	7e 07                	jle    80017f <libmain+0x30>
+    binaryname = argv[0];
+  800178:	8b 06                	mov    (%esi),%eax
+  80017a:	a3 00 30 80 00       	mov    %eax,0x803000
+
+  // call user main routine
+  umain(argc, argv);
+  80017f:	83 ec 08             	sub    $0x8,%esp
+  800182:	56                   	push   %esi
+  800183:	53                   	push   %ebx
+  800184:	e8 ac ff ff ff       	call   800135 <umain>
+
+  // exit gracefully
+  exit();
+  800189:	e8 0a 00 00 00       	call   800198 <exit>
+}
+  80018e:	83 c4 10             	add    $0x10,%esp
+  800191:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800194:	5b                   	pop    %ebx
+  800195:	5e                   	pop    %esi
+  800196:	5d                   	pop    %ebp
+  800197:	c3                   	ret
+
+00800198 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800198:	55                   	push   %ebp
+  800199:	89 e5                	mov    %esp,%ebp
+  80019b:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80019e:	e8 f0 0e 00 00       	call   801093 <close_all>
+	sys_env_destroy(0);
+  8001a3:	83 ec 0c             	sub    $0xc,%esp
+  8001a6:	6a 00                	push   $0x0
+  8001a8:	e8 c0 09 00 00       	call   800b6d <sys_env_destroy>
+}
+  8001ad:	83 c4 10             	add    $0x10,%esp
+  8001b0:	c9                   	leave
+  8001b1:	c3                   	ret
+
+008001b2 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8001b2:	55                   	push   %ebp
+  8001b3:	89 e5                	mov    %esp,%ebp
+  8001b5:	53                   	push   %ebx
+  8001b6:	83 ec 04             	sub    $0x4,%esp
+  8001b9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8001bc:	8b 13                	mov    (%ebx),%edx
+  8001be:	8d 42 01             	lea    0x1(%edx),%eax
+  8001c1:	89 03                	mov    %eax,(%ebx)
+  8001c3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001c6:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8001ca:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001cf:	74 09                	je     8001da <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001d1:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001d8:	c9                   	leave
+  8001d9:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8001da:	83 ec 08             	sub    $0x8,%esp
+  8001dd:	68 ff 00 00 00       	push   $0xff
+  8001e2:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001e5:	50                   	push   %eax
+  8001e6:	e8 45 09 00 00       	call   800b30 <sys_cputs>
+		b->idx = 0;
+  8001eb:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001f1:	83 c4 10             	add    $0x10,%esp
+  8001f4:	eb db                	jmp    8001d1 <putch+0x1f>
+
+008001f6 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001f6:	55                   	push   %ebp
+  8001f7:	89 e5                	mov    %esp,%ebp
+  8001f9:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001ff:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800206:	00 00 00 
+	b.cnt = 0;
+  800209:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800210:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800213:	ff 75 0c             	push   0xc(%ebp)
+  800216:	ff 75 08             	push   0x8(%ebp)
+  800219:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80021f:	50                   	push   %eax
+  800220:	68 b2 01 80 00       	push   $0x8001b2
+  800225:	e8 14 01 00 00       	call   80033e <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80022a:	83 c4 08             	add    $0x8,%esp
+  80022d:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800233:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800239:	50                   	push   %eax
+  80023a:	e8 f1 08 00 00       	call   800b30 <sys_cputs>
+
+	return b.cnt;
+}
+  80023f:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800245:	c9                   	leave
+  800246:	c3                   	ret
+
+00800247 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800247:	55                   	push   %ebp
+  800248:	89 e5                	mov    %esp,%ebp
+  80024a:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80024d:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800250:	50                   	push   %eax
+  800251:	ff 75 08             	push   0x8(%ebp)
+  800254:	e8 9d ff ff ff       	call   8001f6 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800259:	c9                   	leave
+  80025a:	c3                   	ret
+
+0080025b <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80025b:	55                   	push   %ebp
+  80025c:	89 e5                	mov    %esp,%ebp
+  80025e:	57                   	push   %edi
+  80025f:	56                   	push   %esi
+  800260:	53                   	push   %ebx
+  800261:	83 ec 1c             	sub    $0x1c,%esp
+  800264:	89 c7                	mov    %eax,%edi
+  800266:	89 d6                	mov    %edx,%esi
+  800268:	8b 45 08             	mov    0x8(%ebp),%eax
+  80026b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80026e:	89 d1                	mov    %edx,%ecx
+  800270:	89 c2                	mov    %eax,%edx
+  800272:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800275:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800278:	8b 45 10             	mov    0x10(%ebp),%eax
+  80027b:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80027e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800281:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800288:	39 c2                	cmp    %eax,%edx
+  80028a:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80028d:	72 3e                	jb     8002cd <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80028f:	83 ec 0c             	sub    $0xc,%esp
+  800292:	ff 75 18             	push   0x18(%ebp)
+  800295:	83 eb 01             	sub    $0x1,%ebx
+  800298:	53                   	push   %ebx
+  800299:	50                   	push   %eax
+  80029a:	83 ec 08             	sub    $0x8,%esp
+  80029d:	ff 75 e4             	push   -0x1c(%ebp)
+  8002a0:	ff 75 e0             	push   -0x20(%ebp)
+  8002a3:	ff 75 dc             	push   -0x24(%ebp)
+  8002a6:	ff 75 d8             	push   -0x28(%ebp)
+  8002a9:	e8 c2 1f 00 00       	call   802270 <__udivdi3>
+  8002ae:	83 c4 18             	add    $0x18,%esp
+  8002b1:	52                   	push   %edx
+  8002b2:	50                   	push   %eax
+  8002b3:	89 f2                	mov    %esi,%edx
+  8002b5:	89 f8                	mov    %edi,%eax
+  8002b7:	e8 9f ff ff ff       	call   80025b <printnum>
+  8002bc:	83 c4 20             	add    $0x20,%esp
+  8002bf:	eb 13                	jmp    8002d4 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8002c1:	83 ec 08             	sub    $0x8,%esp
+  8002c4:	56                   	push   %esi
+  8002c5:	ff 75 18             	push   0x18(%ebp)
+  8002c8:	ff d7                	call   *%edi
+  8002ca:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8002cd:	83 eb 01             	sub    $0x1,%ebx
+  8002d0:	85 db                	test   %ebx,%ebx
+  8002d2:	7f ed                	jg     8002c1 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8002d4:	83 ec 08             	sub    $0x8,%esp
+  8002d7:	56                   	push   %esi
+  8002d8:	83 ec 04             	sub    $0x4,%esp
+  8002db:	ff 75 e4             	push   -0x1c(%ebp)
+  8002de:	ff 75 e0             	push   -0x20(%ebp)
+  8002e1:	ff 75 dc             	push   -0x24(%ebp)
+  8002e4:	ff 75 d8             	push   -0x28(%ebp)
+  8002e7:	e8 54 20 00 00       	call   802340 <__umoddi3>
+  8002ec:	83 c4 14             	add    $0x14,%esp
+  8002ef:	0f be 80 36 26 80 00 	movsbl 0x802636(%eax),%eax
+  8002f6:	50                   	push   %eax
+  8002f7:	ff d7                	call   *%edi
+}
+  8002f9:	83 c4 10             	add    $0x10,%esp
+  8002fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002ff:	5b                   	pop    %ebx
+  800300:	5e                   	pop    %esi
+  800301:	5f                   	pop    %edi
+  800302:	5d                   	pop    %ebp
+  800303:	c3                   	ret
+
+00800304 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800304:	55                   	push   %ebp
+  800305:	89 e5                	mov    %esp,%ebp
+  800307:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80030a:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80030e:	8b 10                	mov    (%eax),%edx
+  800310:	3b 50 04             	cmp    0x4(%eax),%edx
+  800313:	73 0a                	jae    80031f <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800315:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800318:	89 08                	mov    %ecx,(%eax)
+  80031a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80031d:	88 02                	mov    %al,(%edx)
+}
+  80031f:	5d                   	pop    %ebp
+  800320:	c3                   	ret
+
+00800321 <printfmt>:
+{
+  800321:	55                   	push   %ebp
+  800322:	89 e5                	mov    %esp,%ebp
+  800324:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800327:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80032a:	50                   	push   %eax
+  80032b:	ff 75 10             	push   0x10(%ebp)
+  80032e:	ff 75 0c             	push   0xc(%ebp)
+  800331:	ff 75 08             	push   0x8(%ebp)
+  800334:	e8 05 00 00 00       	call   80033e <vprintfmt>
+}
+  800339:	83 c4 10             	add    $0x10,%esp
+  80033c:	c9                   	leave
+  80033d:	c3                   	ret
+
+0080033e <vprintfmt>:
+{
+  80033e:	55                   	push   %ebp
+  80033f:	89 e5                	mov    %esp,%ebp
+  800341:	57                   	push   %edi
+  800342:	56                   	push   %esi
+  800343:	53                   	push   %ebx
+  800344:	83 ec 2c             	sub    $0x2c,%esp
+  800347:	8b 75 08             	mov    0x8(%ebp),%esi
+  80034a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80034d:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800350:	eb 0a                	jmp    80035c <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800352:	83 ec 08             	sub    $0x8,%esp
+  800355:	53                   	push   %ebx
+  800356:	50                   	push   %eax
+  800357:	ff d6                	call   *%esi
+  800359:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80035c:	83 c7 01             	add    $0x1,%edi
+  80035f:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800363:	83 f8 25             	cmp    $0x25,%eax
+  800366:	74 0c                	je     800374 <vprintfmt+0x36>
+			if (ch == '\0')
+  800368:	85 c0                	test   %eax,%eax
+  80036a:	75 e6                	jne    800352 <vprintfmt+0x14>
+}
+  80036c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80036f:	5b                   	pop    %ebx
+  800370:	5e                   	pop    %esi
+  800371:	5f                   	pop    %edi
+  800372:	5d                   	pop    %ebp
+  800373:	c3                   	ret
+		padc = ' ';
+  800374:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800378:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80037f:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800386:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80038d:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800392:	8d 47 01             	lea    0x1(%edi),%eax
+  800395:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800398:	0f b6 17             	movzbl (%edi),%edx
+  80039b:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80039e:	3c 55                	cmp    $0x55,%al
+  8003a0:	0f 87 9a 03 00 00    	ja     800740 <vprintfmt+0x402>
+  8003a6:	0f b6 c0             	movzbl %al,%eax
+  8003a9:	ff 24 85 80 27 80 00 	jmp    *0x802780(,%eax,4)
+  8003b0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8003b3:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8003b7:	eb d9                	jmp    800392 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003b9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003bc:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8003c0:	eb d0                	jmp    800392 <vprintfmt+0x54>
+  8003c2:	0f b6 d2             	movzbl %dl,%edx
+  8003c5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8003c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003cd:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8003d0:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003d3:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8003d7:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8003da:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8003dd:	83 f9 09             	cmp    $0x9,%ecx
+  8003e0:	77 55                	ja     800437 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8003e2:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8003e5:	eb e9                	jmp    8003d0 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8003e7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003ea:	8b 00                	mov    (%eax),%eax
+  8003ec:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003ef:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003f2:	8d 40 04             	lea    0x4(%eax),%eax
+  8003f5:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003f8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8003fb:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003ff:	79 91                	jns    800392 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800401:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800404:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800407:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80040e:	eb 82                	jmp    800392 <vprintfmt+0x54>
+			if (width < 0)
+  800410:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800413:	85 d2                	test   %edx,%edx
+  800415:	b8 00 00 00 00       	mov    $0x0,%eax
+  80041a:	0f 49 c2             	cmovns %edx,%eax
+  80041d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800420:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800423:	e9 6a ff ff ff       	jmp    800392 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800428:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80042b:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800432:	e9 5b ff ff ff       	jmp    800392 <vprintfmt+0x54>
+  800437:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80043a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80043d:	eb bc                	jmp    8003fb <vprintfmt+0xbd>
+			lflag++;
+  80043f:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800442:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800445:	e9 48 ff ff ff       	jmp    800392 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80044a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80044d:	8d 78 04             	lea    0x4(%eax),%edi
+  800450:	83 ec 08             	sub    $0x8,%esp
+  800453:	53                   	push   %ebx
+  800454:	ff 30                	push   (%eax)
+  800456:	ff d6                	call   *%esi
+			break;
+  800458:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80045b:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80045e:	e9 7c 02 00 00       	jmp    8006df <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  800463:	8b 45 14             	mov    0x14(%ebp),%eax
+  800466:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800469:	8b 10                	mov    (%eax),%edx
+  80046b:	89 d0                	mov    %edx,%eax
+  80046d:	f7 d8                	neg    %eax
+  80046f:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800472:	83 f8 10             	cmp    $0x10,%eax
+  800475:	7f 23                	jg     80049a <vprintfmt+0x15c>
+  800477:	8b 14 85 e0 28 80 00 	mov    0x8028e0(,%eax,4),%edx
+  80047e:	85 d2                	test   %edx,%edx
+  800480:	74 18                	je     80049a <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800482:	52                   	push   %edx
+  800483:	68 19 2a 80 00       	push   $0x802a19
+  800488:	53                   	push   %ebx
+  800489:	56                   	push   %esi
+  80048a:	e8 92 fe ff ff       	call   800321 <printfmt>
+  80048f:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800492:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800495:	e9 45 02 00 00       	jmp    8006df <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  80049a:	50                   	push   %eax
+  80049b:	68 4e 26 80 00       	push   $0x80264e
+  8004a0:	53                   	push   %ebx
+  8004a1:	56                   	push   %esi
+  8004a2:	e8 7a fe ff ff       	call   800321 <printfmt>
+  8004a7:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004aa:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8004ad:	e9 2d 02 00 00       	jmp    8006df <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004b5:	83 c0 04             	add    $0x4,%eax
+  8004b8:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8004bb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004be:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8004c0:	85 c9                	test   %ecx,%ecx
+  8004c2:	b8 47 26 80 00       	mov    $0x802647,%eax
+  8004c7:	0f 45 c1             	cmovne %ecx,%eax
+  8004ca:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8004cd:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004d1:	7e 06                	jle    8004d9 <vprintfmt+0x19b>
+  8004d3:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8004d7:	75 0b                	jne    8004e4 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004d9:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8004dc:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8004df:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004e2:	eb 5c                	jmp    800540 <vprintfmt+0x202>
+  8004e4:	83 ec 08             	sub    $0x8,%esp
+  8004e7:	ff 75 d0             	push   -0x30(%ebp)
+  8004ea:	ff 75 cc             	push   -0x34(%ebp)
+  8004ed:	e8 eb 02 00 00       	call   8007dd <strnlen>
+  8004f2:	89 c2                	mov    %eax,%edx
+  8004f4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004f7:	29 d0                	sub    %edx,%eax
+  8004f9:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8004fc:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800500:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800503:	89 75 08             	mov    %esi,0x8(%ebp)
+  800506:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800508:	eb 0e                	jmp    800518 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  80050a:	83 ec 08             	sub    $0x8,%esp
+  80050d:	53                   	push   %ebx
+  80050e:	57                   	push   %edi
+  80050f:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800512:	83 ee 01             	sub    $0x1,%esi
+  800515:	83 c4 10             	add    $0x10,%esp
+  800518:	85 f6                	test   %esi,%esi
+  80051a:	7f ee                	jg     80050a <vprintfmt+0x1cc>
+  80051c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80051f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800522:	85 c0                	test   %eax,%eax
+  800524:	ba 00 00 00 00       	mov    $0x0,%edx
+  800529:	0f 49 d0             	cmovns %eax,%edx
+  80052c:	29 d0                	sub    %edx,%eax
+  80052e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800531:	eb a6                	jmp    8004d9 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800533:	83 ec 08             	sub    $0x8,%esp
+  800536:	53                   	push   %ebx
+  800537:	52                   	push   %edx
+  800538:	ff 55 08             	call   *0x8(%ebp)
+  80053b:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80053e:	89 f1                	mov    %esi,%ecx
+  800540:	8d 71 01             	lea    0x1(%ecx),%esi
+  800543:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800547:	0f be d0             	movsbl %al,%edx
+  80054a:	85 d2                	test   %edx,%edx
+  80054c:	74 28                	je     800576 <vprintfmt+0x238>
+  80054e:	85 ff                	test   %edi,%edi
+  800550:	78 05                	js     800557 <vprintfmt+0x219>
+  800552:	83 ef 01             	sub    $0x1,%edi
+  800555:	78 30                	js     800587 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800557:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80055b:	74 d6                	je     800533 <vprintfmt+0x1f5>
+  80055d:	0f be c0             	movsbl %al,%eax
+  800560:	83 e8 20             	sub    $0x20,%eax
+  800563:	83 f8 5e             	cmp    $0x5e,%eax
+  800566:	76 cb                	jbe    800533 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800568:	83 ec 08             	sub    $0x8,%esp
+  80056b:	53                   	push   %ebx
+  80056c:	6a 3f                	push   $0x3f
+  80056e:	ff 55 08             	call   *0x8(%ebp)
+  800571:	83 c4 10             	add    $0x10,%esp
+  800574:	eb c8                	jmp    80053e <vprintfmt+0x200>
+  800576:	8b 75 08             	mov    0x8(%ebp),%esi
+  800579:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80057c:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80057f:	01 d0                	add    %edx,%eax
+  800581:	29 c8                	sub    %ecx,%eax
+  800583:	89 c7                	mov    %eax,%edi
+  800585:	eb 13                	jmp    80059a <vprintfmt+0x25c>
+  800587:	8b 75 08             	mov    0x8(%ebp),%esi
+  80058a:	eb ed                	jmp    800579 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80058c:	83 ec 08             	sub    $0x8,%esp
+  80058f:	53                   	push   %ebx
+  800590:	6a 20                	push   $0x20
+  800592:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800594:	83 ef 01             	sub    $0x1,%edi
+  800597:	83 c4 10             	add    $0x10,%esp
+  80059a:	85 ff                	test   %edi,%edi
+  80059c:	7f ee                	jg     80058c <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80059e:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8005a1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005a4:	e9 36 01 00 00       	jmp    8006df <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  8005a9:	83 f9 01             	cmp    $0x1,%ecx
+  8005ac:	7f 1f                	jg     8005cd <vprintfmt+0x28f>
+	else if (lflag)
+  8005ae:	85 c9                	test   %ecx,%ecx
+  8005b0:	74 67                	je     800619 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8005b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b5:	8b 00                	mov    (%eax),%eax
+  8005b7:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005ba:	89 c1                	mov    %eax,%ecx
+  8005bc:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005bf:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005c2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c5:	8d 40 04             	lea    0x4(%eax),%eax
+  8005c8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005cb:	eb 17                	jmp    8005e4 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8005cd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d0:	8b 50 04             	mov    0x4(%eax),%edx
+  8005d3:	8b 00                	mov    (%eax),%eax
+  8005d5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005d8:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005db:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005de:	8d 40 08             	lea    0x8(%eax),%eax
+  8005e1:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8005e4:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005e7:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8005ea:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8005ef:	85 c9                	test   %ecx,%ecx
+  8005f1:	0f 89 ce 00 00 00    	jns    8006c5 <vprintfmt+0x387>
+				putch('-', putdat);
+  8005f7:	83 ec 08             	sub    $0x8,%esp
+  8005fa:	53                   	push   %ebx
+  8005fb:	6a 2d                	push   $0x2d
+  8005fd:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8005ff:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800602:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800605:	f7 da                	neg    %edx
+  800607:	83 d1 00             	adc    $0x0,%ecx
+  80060a:	f7 d9                	neg    %ecx
+  80060c:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80060f:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800614:	e9 ac 00 00 00       	jmp    8006c5 <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  800619:	8b 45 14             	mov    0x14(%ebp),%eax
+  80061c:	8b 00                	mov    (%eax),%eax
+  80061e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800621:	89 c1                	mov    %eax,%ecx
+  800623:	c1 f9 1f             	sar    $0x1f,%ecx
+  800626:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800629:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062c:	8d 40 04             	lea    0x4(%eax),%eax
+  80062f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800632:	eb b0                	jmp    8005e4 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800634:	83 f9 01             	cmp    $0x1,%ecx
+  800637:	7f 1b                	jg     800654 <vprintfmt+0x316>
+	else if (lflag)
+  800639:	85 c9                	test   %ecx,%ecx
+  80063b:	74 2c                	je     800669 <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  80063d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800640:	8b 10                	mov    (%eax),%edx
+  800642:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800647:	8d 40 04             	lea    0x4(%eax),%eax
+  80064a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80064d:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800652:	eb 71                	jmp    8006c5 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  800654:	8b 45 14             	mov    0x14(%ebp),%eax
+  800657:	8b 10                	mov    (%eax),%edx
+  800659:	8b 48 04             	mov    0x4(%eax),%ecx
+  80065c:	8d 40 08             	lea    0x8(%eax),%eax
+  80065f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800662:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800667:	eb 5c                	jmp    8006c5 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  800669:	8b 45 14             	mov    0x14(%ebp),%eax
+  80066c:	8b 10                	mov    (%eax),%edx
+  80066e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800673:	8d 40 04             	lea    0x4(%eax),%eax
+  800676:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800679:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80067e:	eb 45                	jmp    8006c5 <vprintfmt+0x387>
+			putch('X', putdat);
+  800680:	83 ec 08             	sub    $0x8,%esp
+  800683:	53                   	push   %ebx
+  800684:	6a 58                	push   $0x58
+  800686:	ff d6                	call   *%esi
+			putch('X', putdat);
+  800688:	83 c4 08             	add    $0x8,%esp
+  80068b:	53                   	push   %ebx
+  80068c:	6a 58                	push   $0x58
+  80068e:	ff d6                	call   *%esi
+			putch('X', putdat);
+  800690:	83 c4 08             	add    $0x8,%esp
+  800693:	53                   	push   %ebx
+  800694:	6a 58                	push   $0x58
+  800696:	ff d6                	call   *%esi
+			break;
+  800698:	83 c4 10             	add    $0x10,%esp
+  80069b:	eb 42                	jmp    8006df <vprintfmt+0x3a1>
+			putch('0', putdat);
+  80069d:	83 ec 08             	sub    $0x8,%esp
+  8006a0:	53                   	push   %ebx
+  8006a1:	6a 30                	push   $0x30
+  8006a3:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8006a5:	83 c4 08             	add    $0x8,%esp
+  8006a8:	53                   	push   %ebx
+  8006a9:	6a 78                	push   $0x78
+  8006ab:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8006ad:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b0:	8b 10                	mov    (%eax),%edx
+  8006b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8006b7:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8006ba:	8d 40 04             	lea    0x4(%eax),%eax
+  8006bd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006c0:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8006c5:	83 ec 0c             	sub    $0xc,%esp
+  8006c8:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8006cc:	50                   	push   %eax
+  8006cd:	ff 75 e0             	push   -0x20(%ebp)
+  8006d0:	57                   	push   %edi
+  8006d1:	51                   	push   %ecx
+  8006d2:	52                   	push   %edx
+  8006d3:	89 da                	mov    %ebx,%edx
+  8006d5:	89 f0                	mov    %esi,%eax
+  8006d7:	e8 7f fb ff ff       	call   80025b <printnum>
+			break;
+  8006dc:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8006df:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8006e2:	e9 75 fc ff ff       	jmp    80035c <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8006e7:	83 f9 01             	cmp    $0x1,%ecx
+  8006ea:	7f 1b                	jg     800707 <vprintfmt+0x3c9>
+	else if (lflag)
+  8006ec:	85 c9                	test   %ecx,%ecx
+  8006ee:	74 2c                	je     80071c <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  8006f0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f3:	8b 10                	mov    (%eax),%edx
+  8006f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006fa:	8d 40 04             	lea    0x4(%eax),%eax
+  8006fd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800700:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800705:	eb be                	jmp    8006c5 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  800707:	8b 45 14             	mov    0x14(%ebp),%eax
+  80070a:	8b 10                	mov    (%eax),%edx
+  80070c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80070f:	8d 40 08             	lea    0x8(%eax),%eax
+  800712:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800715:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80071a:	eb a9                	jmp    8006c5 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  80071c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071f:	8b 10                	mov    (%eax),%edx
+  800721:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800726:	8d 40 04             	lea    0x4(%eax),%eax
+  800729:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80072c:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800731:	eb 92                	jmp    8006c5 <vprintfmt+0x387>
+			putch(ch, putdat);
+  800733:	83 ec 08             	sub    $0x8,%esp
+  800736:	53                   	push   %ebx
+  800737:	6a 25                	push   $0x25
+  800739:	ff d6                	call   *%esi
+			break;
+  80073b:	83 c4 10             	add    $0x10,%esp
+  80073e:	eb 9f                	jmp    8006df <vprintfmt+0x3a1>
+			putch('%', putdat);
+  800740:	83 ec 08             	sub    $0x8,%esp
+  800743:	53                   	push   %ebx
+  800744:	6a 25                	push   $0x25
+  800746:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800748:	83 c4 10             	add    $0x10,%esp
+  80074b:	89 f8                	mov    %edi,%eax
+  80074d:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800751:	74 05                	je     800758 <vprintfmt+0x41a>
+  800753:	83 e8 01             	sub    $0x1,%eax
+  800756:	eb f5                	jmp    80074d <vprintfmt+0x40f>
+  800758:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80075b:	eb 82                	jmp    8006df <vprintfmt+0x3a1>
+
+0080075d <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80075d:	55                   	push   %ebp
+  80075e:	89 e5                	mov    %esp,%ebp
+  800760:	83 ec 18             	sub    $0x18,%esp
+  800763:	8b 45 08             	mov    0x8(%ebp),%eax
+  800766:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800769:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80076c:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800770:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800773:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80077a:	85 c0                	test   %eax,%eax
+  80077c:	74 26                	je     8007a4 <vsnprintf+0x47>
+  80077e:	85 d2                	test   %edx,%edx
+  800780:	7e 22                	jle    8007a4 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800782:	ff 75 14             	push   0x14(%ebp)
+  800785:	ff 75 10             	push   0x10(%ebp)
+  800788:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80078b:	50                   	push   %eax
+  80078c:	68 04 03 80 00       	push   $0x800304
+  800791:	e8 a8 fb ff ff       	call   80033e <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800796:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800799:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80079c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80079f:	83 c4 10             	add    $0x10,%esp
+}
+  8007a2:	c9                   	leave
+  8007a3:	c3                   	ret
+		return -E_INVAL;
+  8007a4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007a9:	eb f7                	jmp    8007a2 <vsnprintf+0x45>
+
+008007ab <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8007ab:	55                   	push   %ebp
+  8007ac:	89 e5                	mov    %esp,%ebp
+  8007ae:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8007b1:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8007b4:	50                   	push   %eax
+  8007b5:	ff 75 10             	push   0x10(%ebp)
+  8007b8:	ff 75 0c             	push   0xc(%ebp)
+  8007bb:	ff 75 08             	push   0x8(%ebp)
+  8007be:	e8 9a ff ff ff       	call   80075d <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8007c3:	c9                   	leave
+  8007c4:	c3                   	ret
+
+008007c5 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007c5:	55                   	push   %ebp
+  8007c6:	89 e5                	mov    %esp,%ebp
+  8007c8:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8007cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007d0:	eb 03                	jmp    8007d5 <strlen+0x10>
+		n++;
+  8007d2:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8007d5:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007d9:	75 f7                	jne    8007d2 <strlen+0xd>
+	return n;
+}
+  8007db:	5d                   	pop    %ebp
+  8007dc:	c3                   	ret
+
+008007dd <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8007dd:	55                   	push   %ebp
+  8007de:	89 e5                	mov    %esp,%ebp
+  8007e0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007e3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007eb:	eb 03                	jmp    8007f0 <strnlen+0x13>
+		n++;
+  8007ed:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007f0:	39 d0                	cmp    %edx,%eax
+  8007f2:	74 08                	je     8007fc <strnlen+0x1f>
+  8007f4:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8007f8:	75 f3                	jne    8007ed <strnlen+0x10>
+  8007fa:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8007fc:	89 d0                	mov    %edx,%eax
+  8007fe:	5d                   	pop    %ebp
+  8007ff:	c3                   	ret
+
+00800800 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800800:	55                   	push   %ebp
+  800801:	89 e5                	mov    %esp,%ebp
+  800803:	53                   	push   %ebx
+  800804:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800807:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80080a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80080f:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800813:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800816:	83 c0 01             	add    $0x1,%eax
+  800819:	84 d2                	test   %dl,%dl
+  80081b:	75 f2                	jne    80080f <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80081d:	89 c8                	mov    %ecx,%eax
+  80081f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800822:	c9                   	leave
+  800823:	c3                   	ret
+
+00800824 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800824:	55                   	push   %ebp
+  800825:	89 e5                	mov    %esp,%ebp
+  800827:	53                   	push   %ebx
+  800828:	83 ec 10             	sub    $0x10,%esp
+  80082b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80082e:	53                   	push   %ebx
+  80082f:	e8 91 ff ff ff       	call   8007c5 <strlen>
+  800834:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800837:	ff 75 0c             	push   0xc(%ebp)
+  80083a:	01 d8                	add    %ebx,%eax
+  80083c:	50                   	push   %eax
+  80083d:	e8 be ff ff ff       	call   800800 <strcpy>
+	return dst;
+}
+  800842:	89 d8                	mov    %ebx,%eax
+  800844:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800847:	c9                   	leave
+  800848:	c3                   	ret
+
+00800849 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800849:	55                   	push   %ebp
+  80084a:	89 e5                	mov    %esp,%ebp
+  80084c:	56                   	push   %esi
+  80084d:	53                   	push   %ebx
+  80084e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800851:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800854:	89 f3                	mov    %esi,%ebx
+  800856:	03 5d 10             	add    0x10(%ebp),%ebx
+  800859:	89 f0                	mov    %esi,%eax
+  80085b:	eb 0f                	jmp    80086c <strncpy+0x23>
+		*dst++ = *src;
+  80085d:	83 c0 01             	add    $0x1,%eax
+  800860:	0f b6 0a             	movzbl (%edx),%ecx
+  800863:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800866:	80 f9 01             	cmp    $0x1,%cl
+  800869:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80086c:	39 d8                	cmp    %ebx,%eax
+  80086e:	75 ed                	jne    80085d <strncpy+0x14>
+	}
+	return ret;
+}
+  800870:	89 f0                	mov    %esi,%eax
+  800872:	5b                   	pop    %ebx
+  800873:	5e                   	pop    %esi
+  800874:	5d                   	pop    %ebp
+  800875:	c3                   	ret
+
+00800876 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800876:	55                   	push   %ebp
+  800877:	89 e5                	mov    %esp,%ebp
+  800879:	56                   	push   %esi
+  80087a:	53                   	push   %ebx
+  80087b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80087e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800881:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800884:	89 f0                	mov    %esi,%eax
+  800886:	85 d2                	test   %edx,%edx
+  800888:	74 21                	je     8008ab <strlcpy+0x35>
+  80088a:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80088e:	89 f2                	mov    %esi,%edx
+  800890:	eb 09                	jmp    80089b <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800892:	83 c1 01             	add    $0x1,%ecx
+  800895:	83 c2 01             	add    $0x1,%edx
+  800898:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80089b:	39 c2                	cmp    %eax,%edx
+  80089d:	74 09                	je     8008a8 <strlcpy+0x32>
+  80089f:	0f b6 19             	movzbl (%ecx),%ebx
+  8008a2:	84 db                	test   %bl,%bl
+  8008a4:	75 ec                	jne    800892 <strlcpy+0x1c>
+  8008a6:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8008a8:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8008ab:	29 f0                	sub    %esi,%eax
+}
+  8008ad:	5b                   	pop    %ebx
+  8008ae:	5e                   	pop    %esi
+  8008af:	5d                   	pop    %ebp
+  8008b0:	c3                   	ret
+
+008008b1 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8008b1:	55                   	push   %ebp
+  8008b2:	89 e5                	mov    %esp,%ebp
+  8008b4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008b7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8008ba:	eb 06                	jmp    8008c2 <strcmp+0x11>
+		p++, q++;
+  8008bc:	83 c1 01             	add    $0x1,%ecx
+  8008bf:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8008c2:	0f b6 01             	movzbl (%ecx),%eax
+  8008c5:	84 c0                	test   %al,%al
+  8008c7:	74 04                	je     8008cd <strcmp+0x1c>
+  8008c9:	3a 02                	cmp    (%edx),%al
+  8008cb:	74 ef                	je     8008bc <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008cd:	0f b6 c0             	movzbl %al,%eax
+  8008d0:	0f b6 12             	movzbl (%edx),%edx
+  8008d3:	29 d0                	sub    %edx,%eax
+}
+  8008d5:	5d                   	pop    %ebp
+  8008d6:	c3                   	ret
+
+008008d7 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8008d7:	55                   	push   %ebp
+  8008d8:	89 e5                	mov    %esp,%ebp
+  8008da:	53                   	push   %ebx
+  8008db:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008de:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008e1:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8008e4:	eb 09                	jmp    8008ef <strncmp+0x18>
+		n--, p++, q++;
+  8008e6:	83 ea 01             	sub    $0x1,%edx
+  8008e9:	83 c0 01             	add    $0x1,%eax
+  8008ec:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8008ef:	85 d2                	test   %edx,%edx
+  8008f1:	74 18                	je     80090b <strncmp+0x34>
+  8008f3:	0f b6 18             	movzbl (%eax),%ebx
+  8008f6:	84 db                	test   %bl,%bl
+  8008f8:	74 04                	je     8008fe <strncmp+0x27>
+  8008fa:	3a 19                	cmp    (%ecx),%bl
+  8008fc:	74 e8                	je     8008e6 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008fe:	0f b6 00             	movzbl (%eax),%eax
+  800901:	0f b6 11             	movzbl (%ecx),%edx
+  800904:	29 d0                	sub    %edx,%eax
+}
+  800906:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800909:	c9                   	leave
+  80090a:	c3                   	ret
+		return 0;
+  80090b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800910:	eb f4                	jmp    800906 <strncmp+0x2f>
+
+00800912 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800912:	55                   	push   %ebp
+  800913:	89 e5                	mov    %esp,%ebp
+  800915:	8b 45 08             	mov    0x8(%ebp),%eax
+  800918:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80091c:	eb 03                	jmp    800921 <strchr+0xf>
+  80091e:	83 c0 01             	add    $0x1,%eax
+  800921:	0f b6 10             	movzbl (%eax),%edx
+  800924:	84 d2                	test   %dl,%dl
+  800926:	74 06                	je     80092e <strchr+0x1c>
+		if (*s == c)
+  800928:	38 ca                	cmp    %cl,%dl
+  80092a:	75 f2                	jne    80091e <strchr+0xc>
+  80092c:	eb 05                	jmp    800933 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  80092e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800933:	5d                   	pop    %ebp
+  800934:	c3                   	ret
+
+00800935 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800935:	55                   	push   %ebp
+  800936:	89 e5                	mov    %esp,%ebp
+  800938:	8b 45 08             	mov    0x8(%ebp),%eax
+  80093b:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80093f:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800942:	38 ca                	cmp    %cl,%dl
+  800944:	74 09                	je     80094f <strfind+0x1a>
+  800946:	84 d2                	test   %dl,%dl
+  800948:	74 05                	je     80094f <strfind+0x1a>
+	for (; *s; s++)
+  80094a:	83 c0 01             	add    $0x1,%eax
+  80094d:	eb f0                	jmp    80093f <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  80094f:	5d                   	pop    %ebp
+  800950:	c3                   	ret
+
+00800951 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800951:	55                   	push   %ebp
+  800952:	89 e5                	mov    %esp,%ebp
+  800954:	57                   	push   %edi
+  800955:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800958:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  80095b:	85 c9                	test   %ecx,%ecx
+  80095d:	74 20                	je     80097f <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  80095f:	89 f8                	mov    %edi,%eax
+  800961:	09 c8                	or     %ecx,%eax
+  800963:	a8 03                	test   $0x3,%al
+  800965:	75 12                	jne    800979 <memset+0x28>
+		c &= 0xFF;
+  800967:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80096b:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800971:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800974:	fc                   	cld
+  800975:	f3 ab                	rep stos %eax,%es:(%edi)
+  800977:	eb 06                	jmp    80097f <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800979:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80097c:	fc                   	cld
+  80097d:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  80097f:	89 f8                	mov    %edi,%eax
+  800981:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800984:	c9                   	leave
+  800985:	c3                   	ret
+
+00800986 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800986:	55                   	push   %ebp
+  800987:	89 e5                	mov    %esp,%ebp
+  800989:	57                   	push   %edi
+  80098a:	56                   	push   %esi
+  80098b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80098e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800991:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800994:	39 c6                	cmp    %eax,%esi
+  800996:	73 32                	jae    8009ca <memmove+0x44>
+  800998:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80099b:	39 d0                	cmp    %edx,%eax
+  80099d:	73 2b                	jae    8009ca <memmove+0x44>
+		s += n;
+		d += n;
+  80099f:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009a2:	89 d6                	mov    %edx,%esi
+  8009a4:	09 fe                	or     %edi,%esi
+  8009a6:	09 ce                	or     %ecx,%esi
+  8009a8:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8009ae:	75 0e                	jne    8009be <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8009b0:	83 ef 04             	sub    $0x4,%edi
+  8009b3:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8009b6:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8009b9:	fd                   	std
+  8009ba:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009bc:	eb 09                	jmp    8009c7 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8009be:	83 ef 01             	sub    $0x1,%edi
+  8009c1:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8009c4:	fd                   	std
+  8009c5:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8009c7:	fc                   	cld
+  8009c8:	eb 1a                	jmp    8009e4 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009ca:	89 f2                	mov    %esi,%edx
+  8009cc:	09 c2                	or     %eax,%edx
+  8009ce:	09 ca                	or     %ecx,%edx
+  8009d0:	f6 c2 03             	test   $0x3,%dl
+  8009d3:	75 0a                	jne    8009df <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8009d5:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8009d8:	89 c7                	mov    %eax,%edi
+  8009da:	fc                   	cld
+  8009db:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009dd:	eb 05                	jmp    8009e4 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8009df:	89 c7                	mov    %eax,%edi
+  8009e1:	fc                   	cld
+  8009e2:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8009e4:	5e                   	pop    %esi
+  8009e5:	5f                   	pop    %edi
+  8009e6:	5d                   	pop    %ebp
+  8009e7:	c3                   	ret
+
+008009e8 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8009e8:	55                   	push   %ebp
+  8009e9:	89 e5                	mov    %esp,%ebp
+  8009eb:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8009ee:	ff 75 10             	push   0x10(%ebp)
+  8009f1:	ff 75 0c             	push   0xc(%ebp)
+  8009f4:	ff 75 08             	push   0x8(%ebp)
+  8009f7:	e8 8a ff ff ff       	call   800986 <memmove>
+}
+  8009fc:	c9                   	leave
+  8009fd:	c3                   	ret
+
+008009fe <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8009fe:	55                   	push   %ebp
+  8009ff:	89 e5                	mov    %esp,%ebp
+  800a01:	56                   	push   %esi
+  800a02:	53                   	push   %ebx
+  800a03:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a06:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a09:	89 c6                	mov    %eax,%esi
+  800a0b:	03 75 10             	add    0x10(%ebp),%esi
+  800a0e:	eb 06                	jmp    800a16 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a10:	83 c0 01             	add    $0x1,%eax
+  800a13:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a16:	39 f0                	cmp    %esi,%eax
+  800a18:	74 14                	je     800a2e <memcmp+0x30>
+		if (*s1 != *s2)
+  800a1a:	0f b6 08             	movzbl (%eax),%ecx
+  800a1d:	0f b6 1a             	movzbl (%edx),%ebx
+  800a20:	38 d9                	cmp    %bl,%cl
+  800a22:	74 ec                	je     800a10 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a24:	0f b6 c1             	movzbl %cl,%eax
+  800a27:	0f b6 db             	movzbl %bl,%ebx
+  800a2a:	29 d8                	sub    %ebx,%eax
+  800a2c:	eb 05                	jmp    800a33 <memcmp+0x35>
+	}
+
+	return 0;
+  800a2e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a33:	5b                   	pop    %ebx
+  800a34:	5e                   	pop    %esi
+  800a35:	5d                   	pop    %ebp
+  800a36:	c3                   	ret
+
+00800a37 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a37:	55                   	push   %ebp
+  800a38:	89 e5                	mov    %esp,%ebp
+  800a3a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a3d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a40:	89 c2                	mov    %eax,%edx
+  800a42:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a45:	eb 03                	jmp    800a4a <memfind+0x13>
+  800a47:	83 c0 01             	add    $0x1,%eax
+  800a4a:	39 d0                	cmp    %edx,%eax
+  800a4c:	73 04                	jae    800a52 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a4e:	38 08                	cmp    %cl,(%eax)
+  800a50:	75 f5                	jne    800a47 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a52:	5d                   	pop    %ebp
+  800a53:	c3                   	ret
+
+00800a54 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a54:	55                   	push   %ebp
+  800a55:	89 e5                	mov    %esp,%ebp
+  800a57:	57                   	push   %edi
+  800a58:	56                   	push   %esi
+  800a59:	53                   	push   %ebx
+  800a5a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a5d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a60:	eb 03                	jmp    800a65 <strtol+0x11>
+		s++;
+  800a62:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a65:	0f b6 02             	movzbl (%edx),%eax
+  800a68:	3c 20                	cmp    $0x20,%al
+  800a6a:	74 f6                	je     800a62 <strtol+0xe>
+  800a6c:	3c 09                	cmp    $0x9,%al
+  800a6e:	74 f2                	je     800a62 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a70:	3c 2b                	cmp    $0x2b,%al
+  800a72:	74 2a                	je     800a9e <strtol+0x4a>
+	int neg = 0;
+  800a74:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a79:	3c 2d                	cmp    $0x2d,%al
+  800a7b:	74 2b                	je     800aa8 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a7d:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a83:	75 0f                	jne    800a94 <strtol+0x40>
+  800a85:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a88:	74 28                	je     800ab2 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a8a:	85 db                	test   %ebx,%ebx
+  800a8c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a91:	0f 44 d8             	cmove  %eax,%ebx
+  800a94:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a99:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a9c:	eb 46                	jmp    800ae4 <strtol+0x90>
+		s++;
+  800a9e:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800aa1:	bf 00 00 00 00       	mov    $0x0,%edi
+  800aa6:	eb d5                	jmp    800a7d <strtol+0x29>
+		s++, neg = 1;
+  800aa8:	83 c2 01             	add    $0x1,%edx
+  800aab:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ab0:	eb cb                	jmp    800a7d <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ab2:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800ab6:	74 0e                	je     800ac6 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800ab8:	85 db                	test   %ebx,%ebx
+  800aba:	75 d8                	jne    800a94 <strtol+0x40>
+		s++, base = 8;
+  800abc:	83 c2 01             	add    $0x1,%edx
+  800abf:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800ac4:	eb ce                	jmp    800a94 <strtol+0x40>
+		s += 2, base = 16;
+  800ac6:	83 c2 02             	add    $0x2,%edx
+  800ac9:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800ace:	eb c4                	jmp    800a94 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800ad0:	0f be c0             	movsbl %al,%eax
+  800ad3:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800ad6:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800ad9:	7d 3a                	jge    800b15 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800adb:	83 c2 01             	add    $0x1,%edx
+  800ade:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800ae2:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800ae4:	0f b6 02             	movzbl (%edx),%eax
+  800ae7:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800aea:	89 f3                	mov    %esi,%ebx
+  800aec:	80 fb 09             	cmp    $0x9,%bl
+  800aef:	76 df                	jbe    800ad0 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800af1:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800af4:	89 f3                	mov    %esi,%ebx
+  800af6:	80 fb 19             	cmp    $0x19,%bl
+  800af9:	77 08                	ja     800b03 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800afb:	0f be c0             	movsbl %al,%eax
+  800afe:	83 e8 57             	sub    $0x57,%eax
+  800b01:	eb d3                	jmp    800ad6 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b03:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b06:	89 f3                	mov    %esi,%ebx
+  800b08:	80 fb 19             	cmp    $0x19,%bl
+  800b0b:	77 08                	ja     800b15 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800b0d:	0f be c0             	movsbl %al,%eax
+  800b10:	83 e8 37             	sub    $0x37,%eax
+  800b13:	eb c1                	jmp    800ad6 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b15:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b19:	74 05                	je     800b20 <strtol+0xcc>
+		*endptr = (char *) s;
+  800b1b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b1e:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800b20:	89 c8                	mov    %ecx,%eax
+  800b22:	f7 d8                	neg    %eax
+  800b24:	85 ff                	test   %edi,%edi
+  800b26:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b29:	89 c8                	mov    %ecx,%eax
+  800b2b:	5b                   	pop    %ebx
+  800b2c:	5e                   	pop    %esi
+  800b2d:	5f                   	pop    %edi
+  800b2e:	5d                   	pop    %ebp
+  800b2f:	c3                   	ret
+
+00800b30 <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800b30:	55                   	push   %ebp
+  800b31:	89 e5                	mov    %esp,%ebp
+  800b33:	57                   	push   %edi
+  800b34:	56                   	push   %esi
+  800b35:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800b36:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b3b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b3e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b41:	89 c3                	mov    %eax,%ebx
+  800b43:	89 c7                	mov    %eax,%edi
+  800b45:	89 c6                	mov    %eax,%esi
+  800b47:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  800b49:	5b                   	pop    %ebx
+  800b4a:	5e                   	pop    %esi
+  800b4b:	5f                   	pop    %edi
+  800b4c:	5d                   	pop    %ebp
+  800b4d:	c3                   	ret
+
+00800b4e <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800b4e:	55                   	push   %ebp
+  800b4f:	89 e5                	mov    %esp,%ebp
+  800b51:	57                   	push   %edi
+  800b52:	56                   	push   %esi
+  800b53:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800b54:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b59:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b5e:	89 d1                	mov    %edx,%ecx
+  800b60:	89 d3                	mov    %edx,%ebx
+  800b62:	89 d7                	mov    %edx,%edi
+  800b64:	89 d6                	mov    %edx,%esi
+  800b66:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800b68:	5b                   	pop    %ebx
+  800b69:	5e                   	pop    %esi
+  800b6a:	5f                   	pop    %edi
+  800b6b:	5d                   	pop    %ebp
+  800b6c:	c3                   	ret
+
+00800b6d <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800b6d:	55                   	push   %ebp
+  800b6e:	89 e5                	mov    %esp,%ebp
+  800b70:	57                   	push   %edi
+  800b71:	56                   	push   %esi
+  800b72:	53                   	push   %ebx
+  800b73:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800b76:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b7b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b7e:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b83:	89 cb                	mov    %ecx,%ebx
+  800b85:	89 cf                	mov    %ecx,%edi
+  800b87:	89 ce                	mov    %ecx,%esi
+  800b89:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800b8b:	85 c0                	test   %eax,%eax
+  800b8d:	7f 08                	jg     800b97 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800b8f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b92:	5b                   	pop    %ebx
+  800b93:	5e                   	pop    %esi
+  800b94:	5f                   	pop    %edi
+  800b95:	5d                   	pop    %ebp
+  800b96:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800b97:	83 ec 0c             	sub    $0xc,%esp
+  800b9a:	50                   	push   %eax
+  800b9b:	6a 03                	push   $0x3
+  800b9d:	68 43 29 80 00       	push   $0x802943
+  800ba2:	6a 3e                	push   $0x3e
+  800ba4:	68 60 29 80 00       	push   $0x802960
+  800ba9:	e8 22 14 00 00       	call   801fd0 <_panic>
+
+00800bae <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800bae:	55                   	push   %ebp
+  800baf:	89 e5                	mov    %esp,%ebp
+  800bb1:	57                   	push   %edi
+  800bb2:	56                   	push   %esi
+  800bb3:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800bb4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bb9:	b8 02 00 00 00       	mov    $0x2,%eax
+  800bbe:	89 d1                	mov    %edx,%ecx
+  800bc0:	89 d3                	mov    %edx,%ebx
+  800bc2:	89 d7                	mov    %edx,%edi
+  800bc4:	89 d6                	mov    %edx,%esi
+  800bc6:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800bc8:	5b                   	pop    %ebx
+  800bc9:	5e                   	pop    %esi
+  800bca:	5f                   	pop    %edi
+  800bcb:	5d                   	pop    %ebp
+  800bcc:	c3                   	ret
+
+00800bcd <sys_yield>:
+
+void
+sys_yield(void) {
+  800bcd:	55                   	push   %ebp
+  800bce:	89 e5                	mov    %esp,%ebp
+  800bd0:	57                   	push   %edi
+  800bd1:	56                   	push   %esi
+  800bd2:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800bd3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bd8:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800bdd:	89 d1                	mov    %edx,%ecx
+  800bdf:	89 d3                	mov    %edx,%ebx
+  800be1:	89 d7                	mov    %edx,%edi
+  800be3:	89 d6                	mov    %edx,%esi
+  800be5:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800be7:	5b                   	pop    %ebx
+  800be8:	5e                   	pop    %esi
+  800be9:	5f                   	pop    %edi
+  800bea:	5d                   	pop    %ebp
+  800beb:	c3                   	ret
+
+00800bec <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  800bec:	55                   	push   %ebp
+  800bed:	89 e5                	mov    %esp,%ebp
+  800bef:	57                   	push   %edi
+  800bf0:	56                   	push   %esi
+  800bf1:	53                   	push   %ebx
+  800bf2:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800bf5:	be 00 00 00 00       	mov    $0x0,%esi
+  800bfa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bfd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c00:	b8 04 00 00 00       	mov    $0x4,%eax
+  800c05:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c08:	89 f7                	mov    %esi,%edi
+  800c0a:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c0c:	85 c0                	test   %eax,%eax
+  800c0e:	7f 08                	jg     800c18 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800c10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c13:	5b                   	pop    %ebx
+  800c14:	5e                   	pop    %esi
+  800c15:	5f                   	pop    %edi
+  800c16:	5d                   	pop    %ebp
+  800c17:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c18:	83 ec 0c             	sub    $0xc,%esp
+  800c1b:	50                   	push   %eax
+  800c1c:	6a 04                	push   $0x4
+  800c1e:	68 43 29 80 00       	push   $0x802943
+  800c23:	6a 3e                	push   $0x3e
+  800c25:	68 60 29 80 00       	push   $0x802960
+  800c2a:	e8 a1 13 00 00       	call   801fd0 <_panic>
+
+00800c2f <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  800c2f:	55                   	push   %ebp
+  800c30:	89 e5                	mov    %esp,%ebp
+  800c32:	57                   	push   %edi
+  800c33:	56                   	push   %esi
+  800c34:	53                   	push   %ebx
+  800c35:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c38:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c3b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c3e:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c43:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c46:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c49:	8b 75 18             	mov    0x18(%ebp),%esi
+  800c4c:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c4e:	85 c0                	test   %eax,%eax
+  800c50:	7f 08                	jg     800c5a <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800c52:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c55:	5b                   	pop    %ebx
+  800c56:	5e                   	pop    %esi
+  800c57:	5f                   	pop    %edi
+  800c58:	5d                   	pop    %ebp
+  800c59:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c5a:	83 ec 0c             	sub    $0xc,%esp
+  800c5d:	50                   	push   %eax
+  800c5e:	6a 05                	push   $0x5
+  800c60:	68 43 29 80 00       	push   $0x802943
+  800c65:	6a 3e                	push   $0x3e
+  800c67:	68 60 29 80 00       	push   $0x802960
+  800c6c:	e8 5f 13 00 00       	call   801fd0 <_panic>
+
+00800c71 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  800c71:	55                   	push   %ebp
+  800c72:	89 e5                	mov    %esp,%ebp
+  800c74:	57                   	push   %edi
+  800c75:	56                   	push   %esi
+  800c76:	53                   	push   %ebx
+  800c77:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c7a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c7f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c82:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c85:	b8 06 00 00 00       	mov    $0x6,%eax
+  800c8a:	89 df                	mov    %ebx,%edi
+  800c8c:	89 de                	mov    %ebx,%esi
+  800c8e:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c90:	85 c0                	test   %eax,%eax
+  800c92:	7f 08                	jg     800c9c <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800c94:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c97:	5b                   	pop    %ebx
+  800c98:	5e                   	pop    %esi
+  800c99:	5f                   	pop    %edi
+  800c9a:	5d                   	pop    %ebp
+  800c9b:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c9c:	83 ec 0c             	sub    $0xc,%esp
+  800c9f:	50                   	push   %eax
+  800ca0:	6a 06                	push   $0x6
+  800ca2:	68 43 29 80 00       	push   $0x802943
+  800ca7:	6a 3e                	push   $0x3e
+  800ca9:	68 60 29 80 00       	push   $0x802960
+  800cae:	e8 1d 13 00 00       	call   801fd0 <_panic>
+
+00800cb3 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800cb3:	55                   	push   %ebp
+  800cb4:	89 e5                	mov    %esp,%ebp
+  800cb6:	57                   	push   %edi
+  800cb7:	56                   	push   %esi
+  800cb8:	53                   	push   %ebx
+  800cb9:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800cbc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cc1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cc4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cc7:	b8 08 00 00 00       	mov    $0x8,%eax
+  800ccc:	89 df                	mov    %ebx,%edi
+  800cce:	89 de                	mov    %ebx,%esi
+  800cd0:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800cd2:	85 c0                	test   %eax,%eax
+  800cd4:	7f 08                	jg     800cde <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800cd6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cd9:	5b                   	pop    %ebx
+  800cda:	5e                   	pop    %esi
+  800cdb:	5f                   	pop    %edi
+  800cdc:	5d                   	pop    %ebp
+  800cdd:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800cde:	83 ec 0c             	sub    $0xc,%esp
+  800ce1:	50                   	push   %eax
+  800ce2:	6a 08                	push   $0x8
+  800ce4:	68 43 29 80 00       	push   $0x802943
+  800ce9:	6a 3e                	push   $0x3e
+  800ceb:	68 60 29 80 00       	push   $0x802960
+  800cf0:	e8 db 12 00 00       	call   801fd0 <_panic>
+
+00800cf5 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800cf5:	55                   	push   %ebp
+  800cf6:	89 e5                	mov    %esp,%ebp
+  800cf8:	57                   	push   %edi
+  800cf9:	56                   	push   %esi
+  800cfa:	53                   	push   %ebx
+  800cfb:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800cfe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d03:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d06:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d09:	b8 09 00 00 00       	mov    $0x9,%eax
+  800d0e:	89 df                	mov    %ebx,%edi
+  800d10:	89 de                	mov    %ebx,%esi
+  800d12:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d14:	85 c0                	test   %eax,%eax
+  800d16:	7f 08                	jg     800d20 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800d18:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d1b:	5b                   	pop    %ebx
+  800d1c:	5e                   	pop    %esi
+  800d1d:	5f                   	pop    %edi
+  800d1e:	5d                   	pop    %ebp
+  800d1f:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d20:	83 ec 0c             	sub    $0xc,%esp
+  800d23:	50                   	push   %eax
+  800d24:	6a 09                	push   $0x9
+  800d26:	68 43 29 80 00       	push   $0x802943
+  800d2b:	6a 3e                	push   $0x3e
+  800d2d:	68 60 29 80 00       	push   $0x802960
+  800d32:	e8 99 12 00 00       	call   801fd0 <_panic>
+
+00800d37 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800d37:	55                   	push   %ebp
+  800d38:	89 e5                	mov    %esp,%ebp
+  800d3a:	57                   	push   %edi
+  800d3b:	56                   	push   %esi
+  800d3c:	53                   	push   %ebx
+  800d3d:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800d40:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d45:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d48:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d4b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d50:	89 df                	mov    %ebx,%edi
+  800d52:	89 de                	mov    %ebx,%esi
+  800d54:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d56:	85 c0                	test   %eax,%eax
+  800d58:	7f 08                	jg     800d62 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800d5a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d5d:	5b                   	pop    %ebx
+  800d5e:	5e                   	pop    %esi
+  800d5f:	5f                   	pop    %edi
+  800d60:	5d                   	pop    %ebp
+  800d61:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d62:	83 ec 0c             	sub    $0xc,%esp
+  800d65:	50                   	push   %eax
+  800d66:	6a 0a                	push   $0xa
+  800d68:	68 43 29 80 00       	push   $0x802943
+  800d6d:	6a 3e                	push   $0x3e
+  800d6f:	68 60 29 80 00       	push   $0x802960
+  800d74:	e8 57 12 00 00       	call   801fd0 <_panic>
+
+00800d79 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  800d79:	55                   	push   %ebp
+  800d7a:	89 e5                	mov    %esp,%ebp
+  800d7c:	57                   	push   %edi
+  800d7d:	56                   	push   %esi
+  800d7e:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d7f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d82:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d85:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800d8a:	be 00 00 00 00       	mov    $0x0,%esi
+  800d8f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d92:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d95:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800d97:	5b                   	pop    %ebx
+  800d98:	5e                   	pop    %esi
+  800d99:	5f                   	pop    %edi
+  800d9a:	5d                   	pop    %ebp
+  800d9b:	c3                   	ret
+
+00800d9c <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  800d9c:	55                   	push   %ebp
+  800d9d:	89 e5                	mov    %esp,%ebp
+  800d9f:	57                   	push   %edi
+  800da0:	56                   	push   %esi
+  800da1:	53                   	push   %ebx
+  800da2:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800da5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800daa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dad:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800db2:	89 cb                	mov    %ecx,%ebx
+  800db4:	89 cf                	mov    %ecx,%edi
+  800db6:	89 ce                	mov    %ecx,%esi
+  800db8:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800dba:	85 c0                	test   %eax,%eax
+  800dbc:	7f 08                	jg     800dc6 <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  800dbe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dc1:	5b                   	pop    %ebx
+  800dc2:	5e                   	pop    %esi
+  800dc3:	5f                   	pop    %edi
+  800dc4:	5d                   	pop    %ebp
+  800dc5:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800dc6:	83 ec 0c             	sub    $0xc,%esp
+  800dc9:	50                   	push   %eax
+  800dca:	6a 0d                	push   $0xd
+  800dcc:	68 43 29 80 00       	push   $0x802943
+  800dd1:	6a 3e                	push   $0x3e
+  800dd3:	68 60 29 80 00       	push   $0x802960
+  800dd8:	e8 f3 11 00 00       	call   801fd0 <_panic>
+
+00800ddd <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  800ddd:	55                   	push   %ebp
+  800dde:	89 e5                	mov    %esp,%ebp
+  800de0:	57                   	push   %edi
+  800de1:	56                   	push   %esi
+  800de2:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800de3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800de8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800deb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dee:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800df3:	89 df                	mov    %ebx,%edi
+  800df5:	89 de                	mov    %ebx,%esi
+  800df7:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  800df9:	5b                   	pop    %ebx
+  800dfa:	5e                   	pop    %esi
+  800dfb:	5f                   	pop    %edi
+  800dfc:	5d                   	pop    %ebp
+  800dfd:	c3                   	ret
+
+00800dfe <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  800dfe:	55                   	push   %ebp
+  800dff:	89 e5                	mov    %esp,%ebp
+  800e01:	57                   	push   %edi
+  800e02:	56                   	push   %esi
+  800e03:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e04:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e09:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e0c:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800e11:	89 cb                	mov    %ecx,%ebx
+  800e13:	89 cf                	mov    %ecx,%edi
+  800e15:	89 ce                	mov    %ecx,%esi
+  800e17:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  800e19:	5b                   	pop    %ebx
+  800e1a:	5e                   	pop    %esi
+  800e1b:	5f                   	pop    %edi
+  800e1c:	5d                   	pop    %ebp
+  800e1d:	c3                   	ret
+
+00800e1e <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  800e1e:	55                   	push   %ebp
+  800e1f:	89 e5                	mov    %esp,%ebp
+  800e21:	57                   	push   %edi
+  800e22:	56                   	push   %esi
+  800e23:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e24:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e29:	b8 10 00 00 00       	mov    $0x10,%eax
+  800e2e:	89 d1                	mov    %edx,%ecx
+  800e30:	89 d3                	mov    %edx,%ebx
+  800e32:	89 d7                	mov    %edx,%edi
+  800e34:	89 d6                	mov    %edx,%esi
+  800e36:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800e38:	5b                   	pop    %ebx
+  800e39:	5e                   	pop    %esi
+  800e3a:	5f                   	pop    %edi
+  800e3b:	5d                   	pop    %ebp
+  800e3c:	c3                   	ret
+
+00800e3d <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  800e3d:	55                   	push   %ebp
+  800e3e:	89 e5                	mov    %esp,%ebp
+  800e40:	57                   	push   %edi
+  800e41:	56                   	push   %esi
+  800e42:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e43:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e48:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e4b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e4e:	b8 11 00 00 00       	mov    $0x11,%eax
+  800e53:	89 df                	mov    %ebx,%edi
+  800e55:	89 de                	mov    %ebx,%esi
+  800e57:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800e59:	5b                   	pop    %ebx
+  800e5a:	5e                   	pop    %esi
+  800e5b:	5f                   	pop    %edi
+  800e5c:	5d                   	pop    %ebp
+  800e5d:	c3                   	ret
+
+00800e5e <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  800e5e:	55                   	push   %ebp
+  800e5f:	89 e5                	mov    %esp,%ebp
+  800e61:	57                   	push   %edi
+  800e62:	56                   	push   %esi
+  800e63:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e64:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e69:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e6c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e6f:	b8 12 00 00 00       	mov    $0x12,%eax
+  800e74:	89 df                	mov    %ebx,%edi
+  800e76:	89 de                	mov    %ebx,%esi
+  800e78:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800e7a:	5b                   	pop    %ebx
+  800e7b:	5e                   	pop    %esi
+  800e7c:	5f                   	pop    %edi
+  800e7d:	5d                   	pop    %ebp
+  800e7e:	c3                   	ret
+
+00800e7f <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  800e7f:	55                   	push   %ebp
+  800e80:	89 e5                	mov    %esp,%ebp
+  800e82:	57                   	push   %edi
+  800e83:	56                   	push   %esi
+  800e84:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e85:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e8a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e8d:	b8 13 00 00 00       	mov    $0x13,%eax
+  800e92:	89 cb                	mov    %ecx,%ebx
+  800e94:	89 cf                	mov    %ecx,%edi
+  800e96:	89 ce                	mov    %ecx,%esi
+  800e98:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  800e9a:	5b                   	pop    %ebx
+  800e9b:	5e                   	pop    %esi
+  800e9c:	5f                   	pop    %edi
+  800e9d:	5d                   	pop    %ebp
+  800e9e:	c3                   	ret
+
+00800e9f <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  800e9f:	55                   	push   %ebp
+  800ea0:	89 e5                	mov    %esp,%ebp
+  800ea2:	57                   	push   %edi
+  800ea3:	56                   	push   %esi
+  800ea4:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800ea5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800eaa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ead:	b8 14 00 00 00       	mov    $0x14,%eax
+  800eb2:	89 cb                	mov    %ecx,%ebx
+  800eb4:	89 cf                	mov    %ecx,%edi
+  800eb6:	89 ce                	mov    %ecx,%esi
+  800eb8:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  800eba:	5b                   	pop    %ebx
+  800ebb:	5e                   	pop    %esi
+  800ebc:	5f                   	pop    %edi
+  800ebd:	5d                   	pop    %ebp
+  800ebe:	c3                   	ret
+
+00800ebf <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800ebf:	55                   	push   %ebp
+  800ec0:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800ec2:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ec5:	05 00 00 00 30       	add    $0x30000000,%eax
+  800eca:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800ecd:	5d                   	pop    %ebp
+  800ece:	c3                   	ret
+
+00800ecf <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800ecf:	55                   	push   %ebp
+  800ed0:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800ed2:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ed5:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800eda:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800edf:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800ee4:	5d                   	pop    %ebp
+  800ee5:	c3                   	ret
+
+00800ee6 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800ee6:	55                   	push   %ebp
+  800ee7:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  800ee9:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800eee:	eb 02                	jmp    800ef2 <fd_alloc+0xc>
+  800ef0:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800ef2:	89 c2                	mov    %eax,%edx
+  800ef4:	c1 ea 16             	shr    $0x16,%edx
+  800ef7:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800efe:	f6 c2 01             	test   $0x1,%dl
+  800f01:	74 2b                	je     800f2e <fd_alloc+0x48>
+  800f03:	89 c2                	mov    %eax,%edx
+  800f05:	c1 ea 0c             	shr    $0xc,%edx
+  800f08:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  800f0f:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  800f15:	f6 c1 01             	test   $0x1,%cl
+  800f18:	74 14                	je     800f2e <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  800f1a:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  800f20:	75 ce                	jne    800ef0 <fd_alloc+0xa>
+  800f22:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  800f27:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800f2c:	eb 05                	jmp    800f33 <fd_alloc+0x4d>
+			return 0;
+  800f2e:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  800f33:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f36:	89 02                	mov    %eax,(%edx)
+}
+  800f38:	89 c8                	mov    %ecx,%eax
+  800f3a:	5d                   	pop    %ebp
+  800f3b:	c3                   	ret
+
+00800f3c <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  800f3c:	55                   	push   %ebp
+  800f3d:	89 e5                	mov    %esp,%ebp
+  800f3f:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  800f42:	83 f8 1f             	cmp    $0x1f,%eax
+  800f45:	77 30                	ja     800f77 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  800f47:	c1 e0 0c             	shl    $0xc,%eax
+  800f4a:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800f4f:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  800f55:	f6 c2 01             	test   $0x1,%dl
+  800f58:	74 24                	je     800f7e <fd_lookup+0x42>
+  800f5a:	89 c2                	mov    %eax,%edx
+  800f5c:	c1 ea 0c             	shr    $0xc,%edx
+  800f5f:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800f66:	f6 c2 01             	test   $0x1,%dl
+  800f69:	74 1a                	je     800f85 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  800f6b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800f6e:	89 02                	mov    %eax,(%edx)
+	return 0;
+  800f70:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f75:	5d                   	pop    %ebp
+  800f76:	c3                   	ret
+		return -E_INVAL;
+  800f77:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f7c:	eb f7                	jmp    800f75 <fd_lookup+0x39>
+		return -E_INVAL;
+  800f7e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f83:	eb f0                	jmp    800f75 <fd_lookup+0x39>
+  800f85:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f8a:	eb e9                	jmp    800f75 <fd_lookup+0x39>
+
+00800f8c <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  800f8c:	55                   	push   %ebp
+  800f8d:	89 e5                	mov    %esp,%ebp
+  800f8f:	53                   	push   %ebx
+  800f90:	83 ec 04             	sub    $0x4,%esp
+  800f93:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  800f96:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f9b:	eb 03                	jmp    800fa0 <dev_lookup+0x14>
+  800f9d:	83 c0 01             	add    $0x1,%eax
+  800fa0:	8b 1c 85 ec 29 80 00 	mov    0x8029ec(,%eax,4),%ebx
+  800fa7:	85 db                	test   %ebx,%ebx
+  800fa9:	74 0b                	je     800fb6 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  800fab:	39 13                	cmp    %edx,(%ebx)
+  800fad:	75 ee                	jne    800f9d <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  800faf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fb4:	eb 1f                	jmp    800fd5 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800fb6:	a1 4c 50 80 00       	mov    0x80504c,%eax
+  800fbb:	8b 40 48             	mov    0x48(%eax),%eax
+  800fbe:	83 ec 04             	sub    $0x4,%esp
+  800fc1:	52                   	push   %edx
+  800fc2:	50                   	push   %eax
+  800fc3:	68 70 29 80 00       	push   $0x802970
+  800fc8:	e8 7a f2 ff ff       	call   800247 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  800fcd:	83 c4 10             	add    $0x10,%esp
+  800fd0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  800fd5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800fd8:	89 1a                	mov    %ebx,(%edx)
+}
+  800fda:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800fdd:	c9                   	leave
+  800fde:	c3                   	ret
+
+00800fdf <fd_close>:
+{
+  800fdf:	55                   	push   %ebp
+  800fe0:	89 e5                	mov    %esp,%ebp
+  800fe2:	57                   	push   %edi
+  800fe3:	56                   	push   %esi
+  800fe4:	53                   	push   %ebx
+  800fe5:	83 ec 24             	sub    $0x24,%esp
+  800fe8:	8b 75 08             	mov    0x8(%ebp),%esi
+  800feb:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800fee:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800ff1:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800ff2:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800ff8:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800ffb:	50                   	push   %eax
+  800ffc:	e8 3b ff ff ff       	call   800f3c <fd_lookup>
+  801001:	89 c3                	mov    %eax,%ebx
+  801003:	83 c4 10             	add    $0x10,%esp
+  801006:	85 c0                	test   %eax,%eax
+  801008:	78 05                	js     80100f <fd_close+0x30>
+	    || fd != fd2)
+  80100a:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80100d:	74 16                	je     801025 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80100f:	89 f8                	mov    %edi,%eax
+  801011:	84 c0                	test   %al,%al
+  801013:	b8 00 00 00 00       	mov    $0x0,%eax
+  801018:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80101b:	89 d8                	mov    %ebx,%eax
+  80101d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801020:	5b                   	pop    %ebx
+  801021:	5e                   	pop    %esi
+  801022:	5f                   	pop    %edi
+  801023:	5d                   	pop    %ebp
+  801024:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801025:	83 ec 08             	sub    $0x8,%esp
+  801028:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80102b:	50                   	push   %eax
+  80102c:	ff 36                	push   (%esi)
+  80102e:	e8 59 ff ff ff       	call   800f8c <dev_lookup>
+  801033:	89 c3                	mov    %eax,%ebx
+  801035:	83 c4 10             	add    $0x10,%esp
+  801038:	85 c0                	test   %eax,%eax
+  80103a:	78 1a                	js     801056 <fd_close+0x77>
+		if (dev->dev_close)
+  80103c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80103f:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801042:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801047:	85 c0                	test   %eax,%eax
+  801049:	74 0b                	je     801056 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80104b:	83 ec 0c             	sub    $0xc,%esp
+  80104e:	56                   	push   %esi
+  80104f:	ff d0                	call   *%eax
+  801051:	89 c3                	mov    %eax,%ebx
+  801053:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801056:	83 ec 08             	sub    $0x8,%esp
+  801059:	56                   	push   %esi
+  80105a:	6a 00                	push   $0x0
+  80105c:	e8 10 fc ff ff       	call   800c71 <sys_page_unmap>
+	return r;
+  801061:	83 c4 10             	add    $0x10,%esp
+  801064:	eb b5                	jmp    80101b <fd_close+0x3c>
+
+00801066 <close>:
+
+int
+close(int fdnum)
+{
+  801066:	55                   	push   %ebp
+  801067:	89 e5                	mov    %esp,%ebp
+  801069:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80106c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80106f:	50                   	push   %eax
+  801070:	ff 75 08             	push   0x8(%ebp)
+  801073:	e8 c4 fe ff ff       	call   800f3c <fd_lookup>
+  801078:	83 c4 10             	add    $0x10,%esp
+  80107b:	85 c0                	test   %eax,%eax
+  80107d:	79 02                	jns    801081 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80107f:	c9                   	leave
+  801080:	c3                   	ret
+		return fd_close(fd, 1);
+  801081:	83 ec 08             	sub    $0x8,%esp
+  801084:	6a 01                	push   $0x1
+  801086:	ff 75 f4             	push   -0xc(%ebp)
+  801089:	e8 51 ff ff ff       	call   800fdf <fd_close>
+  80108e:	83 c4 10             	add    $0x10,%esp
+  801091:	eb ec                	jmp    80107f <close+0x19>
+
+00801093 <close_all>:
+
+void
+close_all(void)
+{
+  801093:	55                   	push   %ebp
+  801094:	89 e5                	mov    %esp,%ebp
+  801096:	53                   	push   %ebx
+  801097:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80109a:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80109f:	83 ec 0c             	sub    $0xc,%esp
+  8010a2:	53                   	push   %ebx
+  8010a3:	e8 be ff ff ff       	call   801066 <close>
+	for (i = 0; i < MAXFD; i++)
+  8010a8:	83 c3 01             	add    $0x1,%ebx
+  8010ab:	83 c4 10             	add    $0x10,%esp
+  8010ae:	83 fb 20             	cmp    $0x20,%ebx
+  8010b1:	75 ec                	jne    80109f <close_all+0xc>
+}
+  8010b3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010b6:	c9                   	leave
+  8010b7:	c3                   	ret
+
+008010b8 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8010b8:	55                   	push   %ebp
+  8010b9:	89 e5                	mov    %esp,%ebp
+  8010bb:	57                   	push   %edi
+  8010bc:	56                   	push   %esi
+  8010bd:	53                   	push   %ebx
+  8010be:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8010c1:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8010c4:	50                   	push   %eax
+  8010c5:	ff 75 08             	push   0x8(%ebp)
+  8010c8:	e8 6f fe ff ff       	call   800f3c <fd_lookup>
+  8010cd:	89 c3                	mov    %eax,%ebx
+  8010cf:	83 c4 10             	add    $0x10,%esp
+  8010d2:	85 c0                	test   %eax,%eax
+  8010d4:	78 7f                	js     801155 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8010d6:	83 ec 0c             	sub    $0xc,%esp
+  8010d9:	ff 75 0c             	push   0xc(%ebp)
+  8010dc:	e8 85 ff ff ff       	call   801066 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8010e1:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8010e4:	c1 e6 0c             	shl    $0xc,%esi
+  8010e7:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8010ed:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8010f0:	89 3c 24             	mov    %edi,(%esp)
+  8010f3:	e8 d7 fd ff ff       	call   800ecf <fd2data>
+  8010f8:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8010fa:	89 34 24             	mov    %esi,(%esp)
+  8010fd:	e8 cd fd ff ff       	call   800ecf <fd2data>
+  801102:	83 c4 10             	add    $0x10,%esp
+  801105:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801108:	89 d8                	mov    %ebx,%eax
+  80110a:	c1 e8 16             	shr    $0x16,%eax
+  80110d:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801114:	a8 01                	test   $0x1,%al
+  801116:	74 11                	je     801129 <dup+0x71>
+  801118:	89 d8                	mov    %ebx,%eax
+  80111a:	c1 e8 0c             	shr    $0xc,%eax
+  80111d:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801124:	f6 c2 01             	test   $0x1,%dl
+  801127:	75 36                	jne    80115f <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801129:	89 f8                	mov    %edi,%eax
+  80112b:	c1 e8 0c             	shr    $0xc,%eax
+  80112e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801135:	83 ec 0c             	sub    $0xc,%esp
+  801138:	25 07 0e 00 00       	and    $0xe07,%eax
+  80113d:	50                   	push   %eax
+  80113e:	56                   	push   %esi
+  80113f:	6a 00                	push   $0x0
+  801141:	57                   	push   %edi
+  801142:	6a 00                	push   $0x0
+  801144:	e8 e6 fa ff ff       	call   800c2f <sys_page_map>
+  801149:	89 c3                	mov    %eax,%ebx
+  80114b:	83 c4 20             	add    $0x20,%esp
+  80114e:	85 c0                	test   %eax,%eax
+  801150:	78 33                	js     801185 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801152:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801155:	89 d8                	mov    %ebx,%eax
+  801157:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80115a:	5b                   	pop    %ebx
+  80115b:	5e                   	pop    %esi
+  80115c:	5f                   	pop    %edi
+  80115d:	5d                   	pop    %ebp
+  80115e:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80115f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801166:	83 ec 0c             	sub    $0xc,%esp
+  801169:	25 07 0e 00 00       	and    $0xe07,%eax
+  80116e:	50                   	push   %eax
+  80116f:	ff 75 d4             	push   -0x2c(%ebp)
+  801172:	6a 00                	push   $0x0
+  801174:	53                   	push   %ebx
+  801175:	6a 00                	push   $0x0
+  801177:	e8 b3 fa ff ff       	call   800c2f <sys_page_map>
+  80117c:	89 c3                	mov    %eax,%ebx
+  80117e:	83 c4 20             	add    $0x20,%esp
+  801181:	85 c0                	test   %eax,%eax
+  801183:	79 a4                	jns    801129 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801185:	83 ec 08             	sub    $0x8,%esp
+  801188:	56                   	push   %esi
+  801189:	6a 00                	push   $0x0
+  80118b:	e8 e1 fa ff ff       	call   800c71 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801190:	83 c4 08             	add    $0x8,%esp
+  801193:	ff 75 d4             	push   -0x2c(%ebp)
+  801196:	6a 00                	push   $0x0
+  801198:	e8 d4 fa ff ff       	call   800c71 <sys_page_unmap>
+	return r;
+  80119d:	83 c4 10             	add    $0x10,%esp
+  8011a0:	eb b3                	jmp    801155 <dup+0x9d>
+
+008011a2 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8011a2:	55                   	push   %ebp
+  8011a3:	89 e5                	mov    %esp,%ebp
+  8011a5:	56                   	push   %esi
+  8011a6:	53                   	push   %ebx
+  8011a7:	83 ec 18             	sub    $0x18,%esp
+  8011aa:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8011ad:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8011b0:	50                   	push   %eax
+  8011b1:	56                   	push   %esi
+  8011b2:	e8 85 fd ff ff       	call   800f3c <fd_lookup>
+  8011b7:	83 c4 10             	add    $0x10,%esp
+  8011ba:	85 c0                	test   %eax,%eax
+  8011bc:	78 3c                	js     8011fa <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8011be:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8011c1:	83 ec 08             	sub    $0x8,%esp
+  8011c4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8011c7:	50                   	push   %eax
+  8011c8:	ff 33                	push   (%ebx)
+  8011ca:	e8 bd fd ff ff       	call   800f8c <dev_lookup>
+  8011cf:	83 c4 10             	add    $0x10,%esp
+  8011d2:	85 c0                	test   %eax,%eax
+  8011d4:	78 24                	js     8011fa <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8011d6:	8b 43 08             	mov    0x8(%ebx),%eax
+  8011d9:	83 e0 03             	and    $0x3,%eax
+  8011dc:	83 f8 01             	cmp    $0x1,%eax
+  8011df:	74 20                	je     801201 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8011e1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8011e4:	8b 40 08             	mov    0x8(%eax),%eax
+  8011e7:	85 c0                	test   %eax,%eax
+  8011e9:	74 37                	je     801222 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8011eb:	83 ec 04             	sub    $0x4,%esp
+  8011ee:	ff 75 10             	push   0x10(%ebp)
+  8011f1:	ff 75 0c             	push   0xc(%ebp)
+  8011f4:	53                   	push   %ebx
+  8011f5:	ff d0                	call   *%eax
+  8011f7:	83 c4 10             	add    $0x10,%esp
+}
+  8011fa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8011fd:	5b                   	pop    %ebx
+  8011fe:	5e                   	pop    %esi
+  8011ff:	5d                   	pop    %ebp
+  801200:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801201:	a1 4c 50 80 00       	mov    0x80504c,%eax
+  801206:	8b 40 48             	mov    0x48(%eax),%eax
+  801209:	83 ec 04             	sub    $0x4,%esp
+  80120c:	56                   	push   %esi
+  80120d:	50                   	push   %eax
+  80120e:	68 b1 29 80 00       	push   $0x8029b1
+  801213:	e8 2f f0 ff ff       	call   800247 <cprintf>
+		return -E_INVAL;
+  801218:	83 c4 10             	add    $0x10,%esp
+  80121b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801220:	eb d8                	jmp    8011fa <read+0x58>
+		return -E_NOT_SUPP;
+  801222:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801227:	eb d1                	jmp    8011fa <read+0x58>
+
+00801229 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801229:	55                   	push   %ebp
+  80122a:	89 e5                	mov    %esp,%ebp
+  80122c:	57                   	push   %edi
+  80122d:	56                   	push   %esi
+  80122e:	53                   	push   %ebx
+  80122f:	83 ec 0c             	sub    $0xc,%esp
+  801232:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801235:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801238:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80123d:	eb 02                	jmp    801241 <readn+0x18>
+  80123f:	01 c3                	add    %eax,%ebx
+  801241:	39 f3                	cmp    %esi,%ebx
+  801243:	73 21                	jae    801266 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801245:	83 ec 04             	sub    $0x4,%esp
+  801248:	89 f0                	mov    %esi,%eax
+  80124a:	29 d8                	sub    %ebx,%eax
+  80124c:	50                   	push   %eax
+  80124d:	89 d8                	mov    %ebx,%eax
+  80124f:	03 45 0c             	add    0xc(%ebp),%eax
+  801252:	50                   	push   %eax
+  801253:	57                   	push   %edi
+  801254:	e8 49 ff ff ff       	call   8011a2 <read>
+		if (m < 0)
+  801259:	83 c4 10             	add    $0x10,%esp
+  80125c:	85 c0                	test   %eax,%eax
+  80125e:	78 04                	js     801264 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801260:	75 dd                	jne    80123f <readn+0x16>
+  801262:	eb 02                	jmp    801266 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801264:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801266:	89 d8                	mov    %ebx,%eax
+  801268:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80126b:	5b                   	pop    %ebx
+  80126c:	5e                   	pop    %esi
+  80126d:	5f                   	pop    %edi
+  80126e:	5d                   	pop    %ebp
+  80126f:	c3                   	ret
+
+00801270 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801270:	55                   	push   %ebp
+  801271:	89 e5                	mov    %esp,%ebp
+  801273:	56                   	push   %esi
+  801274:	53                   	push   %ebx
+  801275:	83 ec 18             	sub    $0x18,%esp
+  801278:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80127b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80127e:	50                   	push   %eax
+  80127f:	53                   	push   %ebx
+  801280:	e8 b7 fc ff ff       	call   800f3c <fd_lookup>
+  801285:	83 c4 10             	add    $0x10,%esp
+  801288:	85 c0                	test   %eax,%eax
+  80128a:	78 37                	js     8012c3 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80128c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80128f:	83 ec 08             	sub    $0x8,%esp
+  801292:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801295:	50                   	push   %eax
+  801296:	ff 36                	push   (%esi)
+  801298:	e8 ef fc ff ff       	call   800f8c <dev_lookup>
+  80129d:	83 c4 10             	add    $0x10,%esp
+  8012a0:	85 c0                	test   %eax,%eax
+  8012a2:	78 1f                	js     8012c3 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8012a4:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8012a8:	74 20                	je     8012ca <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8012aa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8012ad:	8b 40 0c             	mov    0xc(%eax),%eax
+  8012b0:	85 c0                	test   %eax,%eax
+  8012b2:	74 37                	je     8012eb <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8012b4:	83 ec 04             	sub    $0x4,%esp
+  8012b7:	ff 75 10             	push   0x10(%ebp)
+  8012ba:	ff 75 0c             	push   0xc(%ebp)
+  8012bd:	56                   	push   %esi
+  8012be:	ff d0                	call   *%eax
+  8012c0:	83 c4 10             	add    $0x10,%esp
+}
+  8012c3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8012c6:	5b                   	pop    %ebx
+  8012c7:	5e                   	pop    %esi
+  8012c8:	5d                   	pop    %ebp
+  8012c9:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8012ca:	a1 4c 50 80 00       	mov    0x80504c,%eax
+  8012cf:	8b 40 48             	mov    0x48(%eax),%eax
+  8012d2:	83 ec 04             	sub    $0x4,%esp
+  8012d5:	53                   	push   %ebx
+  8012d6:	50                   	push   %eax
+  8012d7:	68 cd 29 80 00       	push   $0x8029cd
+  8012dc:	e8 66 ef ff ff       	call   800247 <cprintf>
+		return -E_INVAL;
+  8012e1:	83 c4 10             	add    $0x10,%esp
+  8012e4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012e9:	eb d8                	jmp    8012c3 <write+0x53>
+		return -E_NOT_SUPP;
+  8012eb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8012f0:	eb d1                	jmp    8012c3 <write+0x53>
+
+008012f2 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8012f2:	55                   	push   %ebp
+  8012f3:	89 e5                	mov    %esp,%ebp
+  8012f5:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8012f8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8012fb:	50                   	push   %eax
+  8012fc:	ff 75 08             	push   0x8(%ebp)
+  8012ff:	e8 38 fc ff ff       	call   800f3c <fd_lookup>
+  801304:	83 c4 10             	add    $0x10,%esp
+  801307:	85 c0                	test   %eax,%eax
+  801309:	78 0e                	js     801319 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80130b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80130e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801311:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801314:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801319:	c9                   	leave
+  80131a:	c3                   	ret
+
+0080131b <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80131b:	55                   	push   %ebp
+  80131c:	89 e5                	mov    %esp,%ebp
+  80131e:	56                   	push   %esi
+  80131f:	53                   	push   %ebx
+  801320:	83 ec 18             	sub    $0x18,%esp
+  801323:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801326:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801329:	50                   	push   %eax
+  80132a:	53                   	push   %ebx
+  80132b:	e8 0c fc ff ff       	call   800f3c <fd_lookup>
+  801330:	83 c4 10             	add    $0x10,%esp
+  801333:	85 c0                	test   %eax,%eax
+  801335:	78 34                	js     80136b <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801337:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80133a:	83 ec 08             	sub    $0x8,%esp
+  80133d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801340:	50                   	push   %eax
+  801341:	ff 36                	push   (%esi)
+  801343:	e8 44 fc ff ff       	call   800f8c <dev_lookup>
+  801348:	83 c4 10             	add    $0x10,%esp
+  80134b:	85 c0                	test   %eax,%eax
+  80134d:	78 1c                	js     80136b <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80134f:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801353:	74 1d                	je     801372 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801355:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801358:	8b 40 18             	mov    0x18(%eax),%eax
+  80135b:	85 c0                	test   %eax,%eax
+  80135d:	74 34                	je     801393 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80135f:	83 ec 08             	sub    $0x8,%esp
+  801362:	ff 75 0c             	push   0xc(%ebp)
+  801365:	56                   	push   %esi
+  801366:	ff d0                	call   *%eax
+  801368:	83 c4 10             	add    $0x10,%esp
+}
+  80136b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80136e:	5b                   	pop    %ebx
+  80136f:	5e                   	pop    %esi
+  801370:	5d                   	pop    %ebp
+  801371:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801372:	a1 4c 50 80 00       	mov    0x80504c,%eax
+  801377:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80137a:	83 ec 04             	sub    $0x4,%esp
+  80137d:	53                   	push   %ebx
+  80137e:	50                   	push   %eax
+  80137f:	68 90 29 80 00       	push   $0x802990
+  801384:	e8 be ee ff ff       	call   800247 <cprintf>
+		return -E_INVAL;
+  801389:	83 c4 10             	add    $0x10,%esp
+  80138c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801391:	eb d8                	jmp    80136b <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801393:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801398:	eb d1                	jmp    80136b <ftruncate+0x50>
+
+0080139a <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80139a:	55                   	push   %ebp
+  80139b:	89 e5                	mov    %esp,%ebp
+  80139d:	56                   	push   %esi
+  80139e:	53                   	push   %ebx
+  80139f:	83 ec 18             	sub    $0x18,%esp
+  8013a2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8013a5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8013a8:	50                   	push   %eax
+  8013a9:	ff 75 08             	push   0x8(%ebp)
+  8013ac:	e8 8b fb ff ff       	call   800f3c <fd_lookup>
+  8013b1:	83 c4 10             	add    $0x10,%esp
+  8013b4:	85 c0                	test   %eax,%eax
+  8013b6:	78 49                	js     801401 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8013b8:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8013bb:	83 ec 08             	sub    $0x8,%esp
+  8013be:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013c1:	50                   	push   %eax
+  8013c2:	ff 36                	push   (%esi)
+  8013c4:	e8 c3 fb ff ff       	call   800f8c <dev_lookup>
+  8013c9:	83 c4 10             	add    $0x10,%esp
+  8013cc:	85 c0                	test   %eax,%eax
+  8013ce:	78 31                	js     801401 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8013d0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013d3:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8013d7:	74 2f                	je     801408 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8013d9:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8013dc:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8013e3:	00 00 00 
+	stat->st_isdir = 0;
+  8013e6:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8013ed:	00 00 00 
+	stat->st_dev = dev;
+  8013f0:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8013f6:	83 ec 08             	sub    $0x8,%esp
+  8013f9:	53                   	push   %ebx
+  8013fa:	56                   	push   %esi
+  8013fb:	ff 50 14             	call   *0x14(%eax)
+  8013fe:	83 c4 10             	add    $0x10,%esp
+}
+  801401:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801404:	5b                   	pop    %ebx
+  801405:	5e                   	pop    %esi
+  801406:	5d                   	pop    %ebp
+  801407:	c3                   	ret
+		return -E_NOT_SUPP;
+  801408:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80140d:	eb f2                	jmp    801401 <fstat+0x67>
+
+0080140f <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80140f:	55                   	push   %ebp
+  801410:	89 e5                	mov    %esp,%ebp
+  801412:	56                   	push   %esi
+  801413:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801414:	83 ec 08             	sub    $0x8,%esp
+  801417:	6a 00                	push   $0x0
+  801419:	ff 75 08             	push   0x8(%ebp)
+  80141c:	e8 e4 01 00 00       	call   801605 <open>
+  801421:	89 c3                	mov    %eax,%ebx
+  801423:	83 c4 10             	add    $0x10,%esp
+  801426:	85 c0                	test   %eax,%eax
+  801428:	78 1b                	js     801445 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80142a:	83 ec 08             	sub    $0x8,%esp
+  80142d:	ff 75 0c             	push   0xc(%ebp)
+  801430:	50                   	push   %eax
+  801431:	e8 64 ff ff ff       	call   80139a <fstat>
+  801436:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801438:	89 1c 24             	mov    %ebx,(%esp)
+  80143b:	e8 26 fc ff ff       	call   801066 <close>
+	return r;
+  801440:	83 c4 10             	add    $0x10,%esp
+  801443:	89 f3                	mov    %esi,%ebx
+}
+  801445:	89 d8                	mov    %ebx,%eax
+  801447:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80144a:	5b                   	pop    %ebx
+  80144b:	5e                   	pop    %esi
+  80144c:	5d                   	pop    %ebp
+  80144d:	c3                   	ret
+
+0080144e <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  80144e:	55                   	push   %ebp
+  80144f:	89 e5                	mov    %esp,%ebp
+  801451:	56                   	push   %esi
+  801452:	53                   	push   %ebx
+  801453:	89 c6                	mov    %eax,%esi
+  801455:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  801457:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  80145e:	74 27                	je     801487 <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801460:	6a 07                	push   $0x7
+  801462:	68 00 60 80 00       	push   $0x806000
+  801467:	56                   	push   %esi
+  801468:	ff 35 00 40 80 00    	push   0x804000
+  80146e:	e8 17 0c 00 00       	call   80208a <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  801473:	83 c4 0c             	add    $0xc,%esp
+  801476:	6a 00                	push   $0x0
+  801478:	53                   	push   %ebx
+  801479:	6a 00                	push   $0x0
+  80147b:	e8 96 0b 00 00       	call   802016 <ipc_recv>
+}
+  801480:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801483:	5b                   	pop    %ebx
+  801484:	5e                   	pop    %esi
+  801485:	5d                   	pop    %ebp
+  801486:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  801487:	83 ec 0c             	sub    $0xc,%esp
+  80148a:	6a 01                	push   $0x1
+  80148c:	e8 4d 0c 00 00       	call   8020de <ipc_find_env>
+  801491:	a3 00 40 80 00       	mov    %eax,0x804000
+  801496:	83 c4 10             	add    $0x10,%esp
+  801499:	eb c5                	jmp    801460 <fsipc+0x12>
+
+0080149b <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80149b:	55                   	push   %ebp
+  80149c:	89 e5                	mov    %esp,%ebp
+  80149e:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8014a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014a4:	8b 40 0c             	mov    0xc(%eax),%eax
+  8014a7:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.set_size.req_size = newsize;
+  8014ac:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8014af:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  8014b4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014b9:	b8 02 00 00 00       	mov    $0x2,%eax
+  8014be:	e8 8b ff ff ff       	call   80144e <fsipc>
+}
+  8014c3:	c9                   	leave
+  8014c4:	c3                   	ret
+
+008014c5 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8014c5:	55                   	push   %ebp
+  8014c6:	89 e5                	mov    %esp,%ebp
+  8014c8:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8014cb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014ce:	8b 40 0c             	mov    0xc(%eax),%eax
+  8014d1:	a3 00 60 80 00       	mov    %eax,0x806000
+  return fsipc(FSREQ_FLUSH, NULL);
+  8014d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014db:	b8 06 00 00 00       	mov    $0x6,%eax
+  8014e0:	e8 69 ff ff ff       	call   80144e <fsipc>
+}
+  8014e5:	c9                   	leave
+  8014e6:	c3                   	ret
+
+008014e7 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8014e7:	55                   	push   %ebp
+  8014e8:	89 e5                	mov    %esp,%ebp
+  8014ea:	53                   	push   %ebx
+  8014eb:	83 ec 04             	sub    $0x4,%esp
+  8014ee:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8014f1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014f4:	8b 40 0c             	mov    0xc(%eax),%eax
+  8014f7:	a3 00 60 80 00       	mov    %eax,0x806000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8014fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801501:	b8 05 00 00 00       	mov    $0x5,%eax
+  801506:	e8 43 ff ff ff       	call   80144e <fsipc>
+  80150b:	85 c0                	test   %eax,%eax
+  80150d:	78 2c                	js     80153b <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80150f:	83 ec 08             	sub    $0x8,%esp
+  801512:	68 00 60 80 00       	push   $0x806000
+  801517:	53                   	push   %ebx
+  801518:	e8 e3 f2 ff ff       	call   800800 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  80151d:	a1 80 60 80 00       	mov    0x806080,%eax
+  801522:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801528:	a1 84 60 80 00       	mov    0x806084,%eax
+  80152d:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801533:	83 c4 10             	add    $0x10,%esp
+  801536:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80153b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80153e:	c9                   	leave
+  80153f:	c3                   	ret
+
+00801540 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801540:	55                   	push   %ebp
+  801541:	89 e5                	mov    %esp,%ebp
+  801543:	83 ec 0c             	sub    $0xc,%esp
+  801546:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801549:	8b 55 08             	mov    0x8(%ebp),%edx
+  80154c:	8b 52 0c             	mov    0xc(%edx),%edx
+  80154f:	89 15 00 60 80 00    	mov    %edx,0x806000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801555:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  80155a:	39 d0                	cmp    %edx,%eax
+  80155c:	0f 47 c2             	cmova  %edx,%eax
+  80155f:	a3 04 60 80 00       	mov    %eax,0x806004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  801564:	50                   	push   %eax
+  801565:	ff 75 0c             	push   0xc(%ebp)
+  801568:	68 08 60 80 00       	push   $0x806008
+  80156d:	e8 14 f4 ff ff       	call   800986 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801572:	ba 00 00 00 00       	mov    $0x0,%edx
+  801577:	b8 04 00 00 00       	mov    $0x4,%eax
+  80157c:	e8 cd fe ff ff       	call   80144e <fsipc>
+}
+  801581:	c9                   	leave
+  801582:	c3                   	ret
+
+00801583 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801583:	55                   	push   %ebp
+  801584:	89 e5                	mov    %esp,%ebp
+  801586:	56                   	push   %esi
+  801587:	53                   	push   %ebx
+  801588:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80158b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80158e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801591:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read.req_n = n;
+  801596:	89 35 04 60 80 00    	mov    %esi,0x806004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  80159c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015a1:	b8 03 00 00 00       	mov    $0x3,%eax
+  8015a6:	e8 a3 fe ff ff       	call   80144e <fsipc>
+  8015ab:	89 c3                	mov    %eax,%ebx
+  8015ad:	85 c0                	test   %eax,%eax
+  8015af:	78 1f                	js     8015d0 <devfile_read+0x4d>
+  assert(r <= n);
+  8015b1:	39 c6                	cmp    %eax,%esi
+  8015b3:	72 24                	jb     8015d9 <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  8015b5:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8015ba:	7f 33                	jg     8015ef <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8015bc:	83 ec 04             	sub    $0x4,%esp
+  8015bf:	50                   	push   %eax
+  8015c0:	68 00 60 80 00       	push   $0x806000
+  8015c5:	ff 75 0c             	push   0xc(%ebp)
+  8015c8:	e8 b9 f3 ff ff       	call   800986 <memmove>
+  return r;
+  8015cd:	83 c4 10             	add    $0x10,%esp
+}
+  8015d0:	89 d8                	mov    %ebx,%eax
+  8015d2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015d5:	5b                   	pop    %ebx
+  8015d6:	5e                   	pop    %esi
+  8015d7:	5d                   	pop    %ebp
+  8015d8:	c3                   	ret
+  assert(r <= n);
+  8015d9:	68 00 2a 80 00       	push   $0x802a00
+  8015de:	68 07 2a 80 00       	push   $0x802a07
+  8015e3:	6a 78                	push   $0x78
+  8015e5:	68 1c 2a 80 00       	push   $0x802a1c
+  8015ea:	e8 e1 09 00 00       	call   801fd0 <_panic>
+  assert(r <= PGSIZE);
+  8015ef:	68 27 2a 80 00       	push   $0x802a27
+  8015f4:	68 07 2a 80 00       	push   $0x802a07
+  8015f9:	6a 79                	push   $0x79
+  8015fb:	68 1c 2a 80 00       	push   $0x802a1c
+  801600:	e8 cb 09 00 00       	call   801fd0 <_panic>
+
+00801605 <open>:
+open(const char *path, int mode) {
+  801605:	55                   	push   %ebp
+  801606:	89 e5                	mov    %esp,%ebp
+  801608:	56                   	push   %esi
+  801609:	53                   	push   %ebx
+  80160a:	83 ec 1c             	sub    $0x1c,%esp
+  80160d:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801610:	56                   	push   %esi
+  801611:	e8 af f1 ff ff       	call   8007c5 <strlen>
+  801616:	83 c4 10             	add    $0x10,%esp
+  801619:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80161e:	7f 6c                	jg     80168c <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801620:	83 ec 0c             	sub    $0xc,%esp
+  801623:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801626:	50                   	push   %eax
+  801627:	e8 ba f8 ff ff       	call   800ee6 <fd_alloc>
+  80162c:	89 c3                	mov    %eax,%ebx
+  80162e:	83 c4 10             	add    $0x10,%esp
+  801631:	85 c0                	test   %eax,%eax
+  801633:	78 3c                	js     801671 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801635:	83 ec 08             	sub    $0x8,%esp
+  801638:	56                   	push   %esi
+  801639:	68 00 60 80 00       	push   $0x806000
+  80163e:	e8 bd f1 ff ff       	call   800800 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801643:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801646:	a3 00 64 80 00       	mov    %eax,0x806400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80164b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80164e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801653:	e8 f6 fd ff ff       	call   80144e <fsipc>
+  801658:	89 c3                	mov    %eax,%ebx
+  80165a:	83 c4 10             	add    $0x10,%esp
+  80165d:	85 c0                	test   %eax,%eax
+  80165f:	78 19                	js     80167a <open+0x75>
+  return fd2num(fd);
+  801661:	83 ec 0c             	sub    $0xc,%esp
+  801664:	ff 75 f4             	push   -0xc(%ebp)
+  801667:	e8 53 f8 ff ff       	call   800ebf <fd2num>
+  80166c:	89 c3                	mov    %eax,%ebx
+  80166e:	83 c4 10             	add    $0x10,%esp
+}
+  801671:	89 d8                	mov    %ebx,%eax
+  801673:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801676:	5b                   	pop    %ebx
+  801677:	5e                   	pop    %esi
+  801678:	5d                   	pop    %ebp
+  801679:	c3                   	ret
+    fd_close(fd, 0);
+  80167a:	83 ec 08             	sub    $0x8,%esp
+  80167d:	6a 00                	push   $0x0
+  80167f:	ff 75 f4             	push   -0xc(%ebp)
+  801682:	e8 58 f9 ff ff       	call   800fdf <fd_close>
+    return r;
+  801687:	83 c4 10             	add    $0x10,%esp
+  80168a:	eb e5                	jmp    801671 <open+0x6c>
+    return -E_BAD_PATH;
+  80168c:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801691:	eb de                	jmp    801671 <open+0x6c>
+
+00801693 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  801693:	55                   	push   %ebp
+  801694:	89 e5                	mov    %esp,%ebp
+  801696:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801699:	ba 00 00 00 00       	mov    $0x0,%edx
+  80169e:	b8 08 00 00 00       	mov    $0x8,%eax
+  8016a3:	e8 a6 fd ff ff       	call   80144e <fsipc>
+}
+  8016a8:	c9                   	leave
+  8016a9:	c3                   	ret
+
+008016aa <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8016aa:	55                   	push   %ebp
+  8016ab:	89 e5                	mov    %esp,%ebp
+  8016ad:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8016b0:	68 33 2a 80 00       	push   $0x802a33
+  8016b5:	ff 75 0c             	push   0xc(%ebp)
+  8016b8:	e8 43 f1 ff ff       	call   800800 <strcpy>
+	return 0;
+}
+  8016bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016c2:	c9                   	leave
+  8016c3:	c3                   	ret
+
+008016c4 <devsock_close>:
+{
+  8016c4:	55                   	push   %ebp
+  8016c5:	89 e5                	mov    %esp,%ebp
+  8016c7:	53                   	push   %ebx
+  8016c8:	83 ec 10             	sub    $0x10,%esp
+  8016cb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8016ce:	53                   	push   %ebx
+  8016cf:	e8 49 0a 00 00       	call   80211d <pageref>
+  8016d4:	89 c2                	mov    %eax,%edx
+  8016d6:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8016d9:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8016de:	83 fa 01             	cmp    $0x1,%edx
+  8016e1:	74 05                	je     8016e8 <devsock_close+0x24>
+}
+  8016e3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016e6:	c9                   	leave
+  8016e7:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8016e8:	83 ec 0c             	sub    $0xc,%esp
+  8016eb:	ff 73 0c             	push   0xc(%ebx)
+  8016ee:	e8 b7 02 00 00       	call   8019aa <nsipc_close>
+  8016f3:	83 c4 10             	add    $0x10,%esp
+  8016f6:	eb eb                	jmp    8016e3 <devsock_close+0x1f>
+
+008016f8 <devsock_write>:
+{
+  8016f8:	55                   	push   %ebp
+  8016f9:	89 e5                	mov    %esp,%ebp
+  8016fb:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8016fe:	6a 00                	push   $0x0
+  801700:	ff 75 10             	push   0x10(%ebp)
+  801703:	ff 75 0c             	push   0xc(%ebp)
+  801706:	8b 45 08             	mov    0x8(%ebp),%eax
+  801709:	ff 70 0c             	push   0xc(%eax)
+  80170c:	e8 79 03 00 00       	call   801a8a <nsipc_send>
+}
+  801711:	c9                   	leave
+  801712:	c3                   	ret
+
+00801713 <devsock_read>:
+{
+  801713:	55                   	push   %ebp
+  801714:	89 e5                	mov    %esp,%ebp
+  801716:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801719:	6a 00                	push   $0x0
+  80171b:	ff 75 10             	push   0x10(%ebp)
+  80171e:	ff 75 0c             	push   0xc(%ebp)
+  801721:	8b 45 08             	mov    0x8(%ebp),%eax
+  801724:	ff 70 0c             	push   0xc(%eax)
+  801727:	e8 ef 02 00 00       	call   801a1b <nsipc_recv>
+}
+  80172c:	c9                   	leave
+  80172d:	c3                   	ret
+
+0080172e <fd2sockid>:
+{
+  80172e:	55                   	push   %ebp
+  80172f:	89 e5                	mov    %esp,%ebp
+  801731:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801734:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801737:	52                   	push   %edx
+  801738:	50                   	push   %eax
+  801739:	e8 fe f7 ff ff       	call   800f3c <fd_lookup>
+  80173e:	83 c4 10             	add    $0x10,%esp
+  801741:	85 c0                	test   %eax,%eax
+  801743:	78 10                	js     801755 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801745:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801748:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  80174e:	39 08                	cmp    %ecx,(%eax)
+  801750:	75 05                	jne    801757 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801752:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801755:	c9                   	leave
+  801756:	c3                   	ret
+		return -E_NOT_SUPP;
+  801757:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80175c:	eb f7                	jmp    801755 <fd2sockid+0x27>
+
+0080175e <alloc_sockfd>:
+{
+  80175e:	55                   	push   %ebp
+  80175f:	89 e5                	mov    %esp,%ebp
+  801761:	56                   	push   %esi
+  801762:	53                   	push   %ebx
+  801763:	83 ec 1c             	sub    $0x1c,%esp
+  801766:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801768:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80176b:	50                   	push   %eax
+  80176c:	e8 75 f7 ff ff       	call   800ee6 <fd_alloc>
+  801771:	89 c3                	mov    %eax,%ebx
+  801773:	83 c4 10             	add    $0x10,%esp
+  801776:	85 c0                	test   %eax,%eax
+  801778:	78 43                	js     8017bd <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80177a:	83 ec 04             	sub    $0x4,%esp
+  80177d:	68 07 04 00 00       	push   $0x407
+  801782:	ff 75 f4             	push   -0xc(%ebp)
+  801785:	6a 00                	push   $0x0
+  801787:	e8 60 f4 ff ff       	call   800bec <sys_page_alloc>
+  80178c:	89 c3                	mov    %eax,%ebx
+  80178e:	83 c4 10             	add    $0x10,%esp
+  801791:	85 c0                	test   %eax,%eax
+  801793:	78 28                	js     8017bd <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801795:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801798:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  80179e:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8017a0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017a3:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8017aa:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8017ad:	83 ec 0c             	sub    $0xc,%esp
+  8017b0:	50                   	push   %eax
+  8017b1:	e8 09 f7 ff ff       	call   800ebf <fd2num>
+  8017b6:	89 c3                	mov    %eax,%ebx
+  8017b8:	83 c4 10             	add    $0x10,%esp
+  8017bb:	eb 0c                	jmp    8017c9 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8017bd:	83 ec 0c             	sub    $0xc,%esp
+  8017c0:	56                   	push   %esi
+  8017c1:	e8 e4 01 00 00       	call   8019aa <nsipc_close>
+		return r;
+  8017c6:	83 c4 10             	add    $0x10,%esp
+}
+  8017c9:	89 d8                	mov    %ebx,%eax
+  8017cb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017ce:	5b                   	pop    %ebx
+  8017cf:	5e                   	pop    %esi
+  8017d0:	5d                   	pop    %ebp
+  8017d1:	c3                   	ret
+
+008017d2 <accept>:
+{
+  8017d2:	55                   	push   %ebp
+  8017d3:	89 e5                	mov    %esp,%ebp
+  8017d5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8017d8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017db:	e8 4e ff ff ff       	call   80172e <fd2sockid>
+  8017e0:	85 c0                	test   %eax,%eax
+  8017e2:	78 1b                	js     8017ff <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8017e4:	83 ec 04             	sub    $0x4,%esp
+  8017e7:	ff 75 10             	push   0x10(%ebp)
+  8017ea:	ff 75 0c             	push   0xc(%ebp)
+  8017ed:	50                   	push   %eax
+  8017ee:	e8 0e 01 00 00       	call   801901 <nsipc_accept>
+  8017f3:	83 c4 10             	add    $0x10,%esp
+  8017f6:	85 c0                	test   %eax,%eax
+  8017f8:	78 05                	js     8017ff <accept+0x2d>
+	return alloc_sockfd(r);
+  8017fa:	e8 5f ff ff ff       	call   80175e <alloc_sockfd>
+}
+  8017ff:	c9                   	leave
+  801800:	c3                   	ret
+
+00801801 <bind>:
+{
+  801801:	55                   	push   %ebp
+  801802:	89 e5                	mov    %esp,%ebp
+  801804:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801807:	8b 45 08             	mov    0x8(%ebp),%eax
+  80180a:	e8 1f ff ff ff       	call   80172e <fd2sockid>
+  80180f:	85 c0                	test   %eax,%eax
+  801811:	78 12                	js     801825 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801813:	83 ec 04             	sub    $0x4,%esp
+  801816:	ff 75 10             	push   0x10(%ebp)
+  801819:	ff 75 0c             	push   0xc(%ebp)
+  80181c:	50                   	push   %eax
+  80181d:	e8 31 01 00 00       	call   801953 <nsipc_bind>
+  801822:	83 c4 10             	add    $0x10,%esp
+}
+  801825:	c9                   	leave
+  801826:	c3                   	ret
+
+00801827 <shutdown>:
+{
+  801827:	55                   	push   %ebp
+  801828:	89 e5                	mov    %esp,%ebp
+  80182a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80182d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801830:	e8 f9 fe ff ff       	call   80172e <fd2sockid>
+  801835:	85 c0                	test   %eax,%eax
+  801837:	78 0f                	js     801848 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801839:	83 ec 08             	sub    $0x8,%esp
+  80183c:	ff 75 0c             	push   0xc(%ebp)
+  80183f:	50                   	push   %eax
+  801840:	e8 43 01 00 00       	call   801988 <nsipc_shutdown>
+  801845:	83 c4 10             	add    $0x10,%esp
+}
+  801848:	c9                   	leave
+  801849:	c3                   	ret
+
+0080184a <connect>:
+{
+  80184a:	55                   	push   %ebp
+  80184b:	89 e5                	mov    %esp,%ebp
+  80184d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801850:	8b 45 08             	mov    0x8(%ebp),%eax
+  801853:	e8 d6 fe ff ff       	call   80172e <fd2sockid>
+  801858:	85 c0                	test   %eax,%eax
+  80185a:	78 12                	js     80186e <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  80185c:	83 ec 04             	sub    $0x4,%esp
+  80185f:	ff 75 10             	push   0x10(%ebp)
+  801862:	ff 75 0c             	push   0xc(%ebp)
+  801865:	50                   	push   %eax
+  801866:	e8 59 01 00 00       	call   8019c4 <nsipc_connect>
+  80186b:	83 c4 10             	add    $0x10,%esp
+}
+  80186e:	c9                   	leave
+  80186f:	c3                   	ret
+
+00801870 <listen>:
+{
+  801870:	55                   	push   %ebp
+  801871:	89 e5                	mov    %esp,%ebp
+  801873:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801876:	8b 45 08             	mov    0x8(%ebp),%eax
+  801879:	e8 b0 fe ff ff       	call   80172e <fd2sockid>
+  80187e:	85 c0                	test   %eax,%eax
+  801880:	78 0f                	js     801891 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801882:	83 ec 08             	sub    $0x8,%esp
+  801885:	ff 75 0c             	push   0xc(%ebp)
+  801888:	50                   	push   %eax
+  801889:	e8 6b 01 00 00       	call   8019f9 <nsipc_listen>
+  80188e:	83 c4 10             	add    $0x10,%esp
+}
+  801891:	c9                   	leave
+  801892:	c3                   	ret
+
+00801893 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801893:	55                   	push   %ebp
+  801894:	89 e5                	mov    %esp,%ebp
+  801896:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801899:	ff 75 10             	push   0x10(%ebp)
+  80189c:	ff 75 0c             	push   0xc(%ebp)
+  80189f:	ff 75 08             	push   0x8(%ebp)
+  8018a2:	e8 41 02 00 00       	call   801ae8 <nsipc_socket>
+  8018a7:	83 c4 10             	add    $0x10,%esp
+  8018aa:	85 c0                	test   %eax,%eax
+  8018ac:	78 05                	js     8018b3 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8018ae:	e8 ab fe ff ff       	call   80175e <alloc_sockfd>
+}
+  8018b3:	c9                   	leave
+  8018b4:	c3                   	ret
+
+008018b5 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8018b5:	55                   	push   %ebp
+  8018b6:	89 e5                	mov    %esp,%ebp
+  8018b8:	53                   	push   %ebx
+  8018b9:	83 ec 04             	sub    $0x4,%esp
+  8018bc:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  8018be:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8018c5:	74 26                	je     8018ed <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8018c7:	6a 07                	push   $0x7
+  8018c9:	68 00 70 80 00       	push   $0x807000
+  8018ce:	53                   	push   %ebx
+  8018cf:	ff 35 04 40 80 00    	push   0x804004
+  8018d5:	e8 b0 07 00 00       	call   80208a <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8018da:	83 c4 0c             	add    $0xc,%esp
+  8018dd:	6a 00                	push   $0x0
+  8018df:	6a 00                	push   $0x0
+  8018e1:	6a 00                	push   $0x0
+  8018e3:	e8 2e 07 00 00       	call   802016 <ipc_recv>
+}
+  8018e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018eb:	c9                   	leave
+  8018ec:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8018ed:	83 ec 0c             	sub    $0xc,%esp
+  8018f0:	6a 02                	push   $0x2
+  8018f2:	e8 e7 07 00 00       	call   8020de <ipc_find_env>
+  8018f7:	a3 04 40 80 00       	mov    %eax,0x804004
+  8018fc:	83 c4 10             	add    $0x10,%esp
+  8018ff:	eb c6                	jmp    8018c7 <nsipc+0x12>
+
+00801901 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801901:	55                   	push   %ebp
+  801902:	89 e5                	mov    %esp,%ebp
+  801904:	56                   	push   %esi
+  801905:	53                   	push   %ebx
+  801906:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801909:	8b 45 08             	mov    0x8(%ebp),%eax
+  80190c:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801911:	8b 06                	mov    (%esi),%eax
+  801913:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801918:	b8 01 00 00 00       	mov    $0x1,%eax
+  80191d:	e8 93 ff ff ff       	call   8018b5 <nsipc>
+  801922:	89 c3                	mov    %eax,%ebx
+  801924:	85 c0                	test   %eax,%eax
+  801926:	79 09                	jns    801931 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801928:	89 d8                	mov    %ebx,%eax
+  80192a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80192d:	5b                   	pop    %ebx
+  80192e:	5e                   	pop    %esi
+  80192f:	5d                   	pop    %ebp
+  801930:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801931:	83 ec 04             	sub    $0x4,%esp
+  801934:	ff 35 10 70 80 00    	push   0x807010
+  80193a:	68 00 70 80 00       	push   $0x807000
+  80193f:	ff 75 0c             	push   0xc(%ebp)
+  801942:	e8 3f f0 ff ff       	call   800986 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801947:	a1 10 70 80 00       	mov    0x807010,%eax
+  80194c:	89 06                	mov    %eax,(%esi)
+  80194e:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801951:	eb d5                	jmp    801928 <nsipc_accept+0x27>
+
+00801953 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801953:	55                   	push   %ebp
+  801954:	89 e5                	mov    %esp,%ebp
+  801956:	53                   	push   %ebx
+  801957:	83 ec 08             	sub    $0x8,%esp
+  80195a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  80195d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801960:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801965:	53                   	push   %ebx
+  801966:	ff 75 0c             	push   0xc(%ebp)
+  801969:	68 04 70 80 00       	push   $0x807004
+  80196e:	e8 13 f0 ff ff       	call   800986 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801973:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  801979:	b8 02 00 00 00       	mov    $0x2,%eax
+  80197e:	e8 32 ff ff ff       	call   8018b5 <nsipc>
+}
+  801983:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801986:	c9                   	leave
+  801987:	c3                   	ret
+
+00801988 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801988:	55                   	push   %ebp
+  801989:	89 e5                	mov    %esp,%ebp
+  80198b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  80198e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801991:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  801996:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801999:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  80199e:	b8 03 00 00 00       	mov    $0x3,%eax
+  8019a3:	e8 0d ff ff ff       	call   8018b5 <nsipc>
+}
+  8019a8:	c9                   	leave
+  8019a9:	c3                   	ret
+
+008019aa <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8019aa:	55                   	push   %ebp
+  8019ab:	89 e5                	mov    %esp,%ebp
+  8019ad:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8019b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019b3:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  8019b8:	b8 04 00 00 00       	mov    $0x4,%eax
+  8019bd:	e8 f3 fe ff ff       	call   8018b5 <nsipc>
+}
+  8019c2:	c9                   	leave
+  8019c3:	c3                   	ret
+
+008019c4 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8019c4:	55                   	push   %ebp
+  8019c5:	89 e5                	mov    %esp,%ebp
+  8019c7:	53                   	push   %ebx
+  8019c8:	83 ec 08             	sub    $0x8,%esp
+  8019cb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8019ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019d1:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8019d6:	53                   	push   %ebx
+  8019d7:	ff 75 0c             	push   0xc(%ebp)
+  8019da:	68 04 70 80 00       	push   $0x807004
+  8019df:	e8 a2 ef ff ff       	call   800986 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8019e4:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  8019ea:	b8 05 00 00 00       	mov    $0x5,%eax
+  8019ef:	e8 c1 fe ff ff       	call   8018b5 <nsipc>
+}
+  8019f4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019f7:	c9                   	leave
+  8019f8:	c3                   	ret
+
+008019f9 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8019f9:	55                   	push   %ebp
+  8019fa:	89 e5                	mov    %esp,%ebp
+  8019fc:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8019ff:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a02:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  801a07:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a0a:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  801a0f:	b8 06 00 00 00       	mov    $0x6,%eax
+  801a14:	e8 9c fe ff ff       	call   8018b5 <nsipc>
+}
+  801a19:	c9                   	leave
+  801a1a:	c3                   	ret
+
+00801a1b <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801a1b:	55                   	push   %ebp
+  801a1c:	89 e5                	mov    %esp,%ebp
+  801a1e:	56                   	push   %esi
+  801a1f:	53                   	push   %ebx
+  801a20:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801a23:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a26:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  801a2b:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  801a31:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a34:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801a39:	b8 07 00 00 00       	mov    $0x7,%eax
+  801a3e:	e8 72 fe ff ff       	call   8018b5 <nsipc>
+  801a43:	89 c3                	mov    %eax,%ebx
+  801a45:	85 c0                	test   %eax,%eax
+  801a47:	78 22                	js     801a6b <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801a49:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801a4e:	39 c6                	cmp    %eax,%esi
+  801a50:	0f 4e c6             	cmovle %esi,%eax
+  801a53:	39 c3                	cmp    %eax,%ebx
+  801a55:	7f 1d                	jg     801a74 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801a57:	83 ec 04             	sub    $0x4,%esp
+  801a5a:	53                   	push   %ebx
+  801a5b:	68 00 70 80 00       	push   $0x807000
+  801a60:	ff 75 0c             	push   0xc(%ebp)
+  801a63:	e8 1e ef ff ff       	call   800986 <memmove>
+  801a68:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801a6b:	89 d8                	mov    %ebx,%eax
+  801a6d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a70:	5b                   	pop    %ebx
+  801a71:	5e                   	pop    %esi
+  801a72:	5d                   	pop    %ebp
+  801a73:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801a74:	68 3f 2a 80 00       	push   $0x802a3f
+  801a79:	68 07 2a 80 00       	push   $0x802a07
+  801a7e:	6a 62                	push   $0x62
+  801a80:	68 54 2a 80 00       	push   $0x802a54
+  801a85:	e8 46 05 00 00       	call   801fd0 <_panic>
+
+00801a8a <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801a8a:	55                   	push   %ebp
+  801a8b:	89 e5                	mov    %esp,%ebp
+  801a8d:	53                   	push   %ebx
+  801a8e:	83 ec 04             	sub    $0x4,%esp
+  801a91:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801a94:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a97:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  801a9c:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801aa2:	7f 2e                	jg     801ad2 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801aa4:	83 ec 04             	sub    $0x4,%esp
+  801aa7:	53                   	push   %ebx
+  801aa8:	ff 75 0c             	push   0xc(%ebp)
+  801aab:	68 0c 70 80 00       	push   $0x80700c
+  801ab0:	e8 d1 ee ff ff       	call   800986 <memmove>
+	nsipcbuf.send.req_size = size;
+  801ab5:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  801abb:	8b 45 14             	mov    0x14(%ebp),%eax
+  801abe:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  801ac3:	b8 08 00 00 00       	mov    $0x8,%eax
+  801ac8:	e8 e8 fd ff ff       	call   8018b5 <nsipc>
+}
+  801acd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ad0:	c9                   	leave
+  801ad1:	c3                   	ret
+	assert(size < 1600);
+  801ad2:	68 60 2a 80 00       	push   $0x802a60
+  801ad7:	68 07 2a 80 00       	push   $0x802a07
+  801adc:	6a 6d                	push   $0x6d
+  801ade:	68 54 2a 80 00       	push   $0x802a54
+  801ae3:	e8 e8 04 00 00       	call   801fd0 <_panic>
+
+00801ae8 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801ae8:	55                   	push   %ebp
+  801ae9:	89 e5                	mov    %esp,%ebp
+  801aeb:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801aee:	8b 45 08             	mov    0x8(%ebp),%eax
+  801af1:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  801af6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801af9:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  801afe:	8b 45 10             	mov    0x10(%ebp),%eax
+  801b01:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  801b06:	b8 09 00 00 00       	mov    $0x9,%eax
+  801b0b:	e8 a5 fd ff ff       	call   8018b5 <nsipc>
+}
+  801b10:	c9                   	leave
+  801b11:	c3                   	ret
+
+00801b12 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801b12:	55                   	push   %ebp
+  801b13:	89 e5                	mov    %esp,%ebp
+  801b15:	56                   	push   %esi
+  801b16:	53                   	push   %ebx
+  801b17:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801b1a:	83 ec 0c             	sub    $0xc,%esp
+  801b1d:	ff 75 08             	push   0x8(%ebp)
+  801b20:	e8 aa f3 ff ff       	call   800ecf <fd2data>
+  801b25:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801b27:	83 c4 08             	add    $0x8,%esp
+  801b2a:	68 6c 2a 80 00       	push   $0x802a6c
+  801b2f:	53                   	push   %ebx
+  801b30:	e8 cb ec ff ff       	call   800800 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801b35:	8b 46 04             	mov    0x4(%esi),%eax
+  801b38:	2b 06                	sub    (%esi),%eax
+  801b3a:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  801b40:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801b47:	00 00 00 
+	stat->st_dev = &devpipe;
+  801b4a:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  801b51:	30 80 00 
+	return 0;
+}
+  801b54:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b59:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b5c:	5b                   	pop    %ebx
+  801b5d:	5e                   	pop    %esi
+  801b5e:	5d                   	pop    %ebp
+  801b5f:	c3                   	ret
+
+00801b60 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801b60:	55                   	push   %ebp
+  801b61:	89 e5                	mov    %esp,%ebp
+  801b63:	53                   	push   %ebx
+  801b64:	83 ec 0c             	sub    $0xc,%esp
+  801b67:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801b6a:	53                   	push   %ebx
+  801b6b:	6a 00                	push   $0x0
+  801b6d:	e8 ff f0 ff ff       	call   800c71 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801b72:	89 1c 24             	mov    %ebx,(%esp)
+  801b75:	e8 55 f3 ff ff       	call   800ecf <fd2data>
+  801b7a:	83 c4 08             	add    $0x8,%esp
+  801b7d:	50                   	push   %eax
+  801b7e:	6a 00                	push   $0x0
+  801b80:	e8 ec f0 ff ff       	call   800c71 <sys_page_unmap>
+}
+  801b85:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b88:	c9                   	leave
+  801b89:	c3                   	ret
+
+00801b8a <_pipeisclosed>:
+{
+  801b8a:	55                   	push   %ebp
+  801b8b:	89 e5                	mov    %esp,%ebp
+  801b8d:	57                   	push   %edi
+  801b8e:	56                   	push   %esi
+  801b8f:	53                   	push   %ebx
+  801b90:	83 ec 1c             	sub    $0x1c,%esp
+  801b93:	89 c7                	mov    %eax,%edi
+  801b95:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801b97:	a1 4c 50 80 00       	mov    0x80504c,%eax
+  801b9c:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801b9f:	83 ec 0c             	sub    $0xc,%esp
+  801ba2:	57                   	push   %edi
+  801ba3:	e8 75 05 00 00       	call   80211d <pageref>
+  801ba8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801bab:	89 34 24             	mov    %esi,(%esp)
+  801bae:	e8 6a 05 00 00       	call   80211d <pageref>
+		nn = thisenv->env_runs;
+  801bb3:	8b 15 4c 50 80 00    	mov    0x80504c,%edx
+  801bb9:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801bbc:	83 c4 10             	add    $0x10,%esp
+  801bbf:	39 cb                	cmp    %ecx,%ebx
+  801bc1:	74 1b                	je     801bde <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801bc3:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801bc6:	75 cf                	jne    801b97 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801bc8:	8b 42 58             	mov    0x58(%edx),%eax
+  801bcb:	6a 01                	push   $0x1
+  801bcd:	50                   	push   %eax
+  801bce:	53                   	push   %ebx
+  801bcf:	68 73 2a 80 00       	push   $0x802a73
+  801bd4:	e8 6e e6 ff ff       	call   800247 <cprintf>
+  801bd9:	83 c4 10             	add    $0x10,%esp
+  801bdc:	eb b9                	jmp    801b97 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801bde:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801be1:	0f 94 c0             	sete   %al
+  801be4:	0f b6 c0             	movzbl %al,%eax
+}
+  801be7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bea:	5b                   	pop    %ebx
+  801beb:	5e                   	pop    %esi
+  801bec:	5f                   	pop    %edi
+  801bed:	5d                   	pop    %ebp
+  801bee:	c3                   	ret
+
+00801bef <devpipe_write>:
+{
+  801bef:	55                   	push   %ebp
+  801bf0:	89 e5                	mov    %esp,%ebp
+  801bf2:	57                   	push   %edi
+  801bf3:	56                   	push   %esi
+  801bf4:	53                   	push   %ebx
+  801bf5:	83 ec 28             	sub    $0x28,%esp
+  801bf8:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801bfb:	56                   	push   %esi
+  801bfc:	e8 ce f2 ff ff       	call   800ecf <fd2data>
+  801c01:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801c03:	83 c4 10             	add    $0x10,%esp
+  801c06:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c0b:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801c0e:	75 09                	jne    801c19 <devpipe_write+0x2a>
+	return i;
+  801c10:	89 f8                	mov    %edi,%eax
+  801c12:	eb 23                	jmp    801c37 <devpipe_write+0x48>
+			sys_yield();
+  801c14:	e8 b4 ef ff ff       	call   800bcd <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801c19:	8b 43 04             	mov    0x4(%ebx),%eax
+  801c1c:	8b 0b                	mov    (%ebx),%ecx
+  801c1e:	8d 51 20             	lea    0x20(%ecx),%edx
+  801c21:	39 d0                	cmp    %edx,%eax
+  801c23:	72 1a                	jb     801c3f <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  801c25:	89 da                	mov    %ebx,%edx
+  801c27:	89 f0                	mov    %esi,%eax
+  801c29:	e8 5c ff ff ff       	call   801b8a <_pipeisclosed>
+  801c2e:	85 c0                	test   %eax,%eax
+  801c30:	74 e2                	je     801c14 <devpipe_write+0x25>
+				return 0;
+  801c32:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c37:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c3a:	5b                   	pop    %ebx
+  801c3b:	5e                   	pop    %esi
+  801c3c:	5f                   	pop    %edi
+  801c3d:	5d                   	pop    %ebp
+  801c3e:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801c3f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c42:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801c46:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801c49:	89 c2                	mov    %eax,%edx
+  801c4b:	c1 fa 1f             	sar    $0x1f,%edx
+  801c4e:	89 d1                	mov    %edx,%ecx
+  801c50:	c1 e9 1b             	shr    $0x1b,%ecx
+  801c53:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801c56:	83 e2 1f             	and    $0x1f,%edx
+  801c59:	29 ca                	sub    %ecx,%edx
+  801c5b:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801c5f:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  801c63:	83 c0 01             	add    $0x1,%eax
+  801c66:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  801c69:	83 c7 01             	add    $0x1,%edi
+  801c6c:	eb 9d                	jmp    801c0b <devpipe_write+0x1c>
+
+00801c6e <devpipe_read>:
+{
+  801c6e:	55                   	push   %ebp
+  801c6f:	89 e5                	mov    %esp,%ebp
+  801c71:	57                   	push   %edi
+  801c72:	56                   	push   %esi
+  801c73:	53                   	push   %ebx
+  801c74:	83 ec 18             	sub    $0x18,%esp
+  801c77:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  801c7a:	57                   	push   %edi
+  801c7b:	e8 4f f2 ff ff       	call   800ecf <fd2data>
+  801c80:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801c82:	83 c4 10             	add    $0x10,%esp
+  801c85:	be 00 00 00 00       	mov    $0x0,%esi
+  801c8a:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801c8d:	75 13                	jne    801ca2 <devpipe_read+0x34>
+	return i;
+  801c8f:	89 f0                	mov    %esi,%eax
+  801c91:	eb 02                	jmp    801c95 <devpipe_read+0x27>
+				return i;
+  801c93:	89 f0                	mov    %esi,%eax
+}
+  801c95:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c98:	5b                   	pop    %ebx
+  801c99:	5e                   	pop    %esi
+  801c9a:	5f                   	pop    %edi
+  801c9b:	5d                   	pop    %ebp
+  801c9c:	c3                   	ret
+			sys_yield();
+  801c9d:	e8 2b ef ff ff       	call   800bcd <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  801ca2:	8b 03                	mov    (%ebx),%eax
+  801ca4:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801ca7:	75 18                	jne    801cc1 <devpipe_read+0x53>
+			if (i > 0)
+  801ca9:	85 f6                	test   %esi,%esi
+  801cab:	75 e6                	jne    801c93 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  801cad:	89 da                	mov    %ebx,%edx
+  801caf:	89 f8                	mov    %edi,%eax
+  801cb1:	e8 d4 fe ff ff       	call   801b8a <_pipeisclosed>
+  801cb6:	85 c0                	test   %eax,%eax
+  801cb8:	74 e3                	je     801c9d <devpipe_read+0x2f>
+				return 0;
+  801cba:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cbf:	eb d4                	jmp    801c95 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801cc1:	99                   	cltd
+  801cc2:	c1 ea 1b             	shr    $0x1b,%edx
+  801cc5:	01 d0                	add    %edx,%eax
+  801cc7:	83 e0 1f             	and    $0x1f,%eax
+  801cca:	29 d0                	sub    %edx,%eax
+  801ccc:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801cd1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801cd4:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  801cd7:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  801cda:	83 c6 01             	add    $0x1,%esi
+  801cdd:	eb ab                	jmp    801c8a <devpipe_read+0x1c>
+
+00801cdf <pipe>:
+{
+  801cdf:	55                   	push   %ebp
+  801ce0:	89 e5                	mov    %esp,%ebp
+  801ce2:	56                   	push   %esi
+  801ce3:	53                   	push   %ebx
+  801ce4:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801ce7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cea:	50                   	push   %eax
+  801ceb:	e8 f6 f1 ff ff       	call   800ee6 <fd_alloc>
+  801cf0:	89 c3                	mov    %eax,%ebx
+  801cf2:	83 c4 10             	add    $0x10,%esp
+  801cf5:	85 c0                	test   %eax,%eax
+  801cf7:	0f 88 23 01 00 00    	js     801e20 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801cfd:	83 ec 04             	sub    $0x4,%esp
+  801d00:	68 07 04 00 00       	push   $0x407
+  801d05:	ff 75 f4             	push   -0xc(%ebp)
+  801d08:	6a 00                	push   $0x0
+  801d0a:	e8 dd ee ff ff       	call   800bec <sys_page_alloc>
+  801d0f:	89 c3                	mov    %eax,%ebx
+  801d11:	83 c4 10             	add    $0x10,%esp
+  801d14:	85 c0                	test   %eax,%eax
+  801d16:	0f 88 04 01 00 00    	js     801e20 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801d1c:	83 ec 0c             	sub    $0xc,%esp
+  801d1f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d22:	50                   	push   %eax
+  801d23:	e8 be f1 ff ff       	call   800ee6 <fd_alloc>
+  801d28:	89 c3                	mov    %eax,%ebx
+  801d2a:	83 c4 10             	add    $0x10,%esp
+  801d2d:	85 c0                	test   %eax,%eax
+  801d2f:	0f 88 db 00 00 00    	js     801e10 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801d35:	83 ec 04             	sub    $0x4,%esp
+  801d38:	68 07 04 00 00       	push   $0x407
+  801d3d:	ff 75 f0             	push   -0x10(%ebp)
+  801d40:	6a 00                	push   $0x0
+  801d42:	e8 a5 ee ff ff       	call   800bec <sys_page_alloc>
+  801d47:	89 c3                	mov    %eax,%ebx
+  801d49:	83 c4 10             	add    $0x10,%esp
+  801d4c:	85 c0                	test   %eax,%eax
+  801d4e:	0f 88 bc 00 00 00    	js     801e10 <pipe+0x131>
+	va = fd2data(fd0);
+  801d54:	83 ec 0c             	sub    $0xc,%esp
+  801d57:	ff 75 f4             	push   -0xc(%ebp)
+  801d5a:	e8 70 f1 ff ff       	call   800ecf <fd2data>
+  801d5f:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801d61:	83 c4 0c             	add    $0xc,%esp
+  801d64:	68 07 04 00 00       	push   $0x407
+  801d69:	50                   	push   %eax
+  801d6a:	6a 00                	push   $0x0
+  801d6c:	e8 7b ee ff ff       	call   800bec <sys_page_alloc>
+  801d71:	89 c3                	mov    %eax,%ebx
+  801d73:	83 c4 10             	add    $0x10,%esp
+  801d76:	85 c0                	test   %eax,%eax
+  801d78:	0f 88 82 00 00 00    	js     801e00 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801d7e:	83 ec 0c             	sub    $0xc,%esp
+  801d81:	ff 75 f0             	push   -0x10(%ebp)
+  801d84:	e8 46 f1 ff ff       	call   800ecf <fd2data>
+  801d89:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801d90:	50                   	push   %eax
+  801d91:	6a 00                	push   $0x0
+  801d93:	56                   	push   %esi
+  801d94:	6a 00                	push   $0x0
+  801d96:	e8 94 ee ff ff       	call   800c2f <sys_page_map>
+  801d9b:	89 c3                	mov    %eax,%ebx
+  801d9d:	83 c4 20             	add    $0x20,%esp
+  801da0:	85 c0                	test   %eax,%eax
+  801da2:	78 4e                	js     801df2 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  801da4:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  801da9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801dac:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  801dae:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801db1:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  801db8:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801dbb:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  801dbd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801dc0:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  801dc7:	83 ec 0c             	sub    $0xc,%esp
+  801dca:	ff 75 f4             	push   -0xc(%ebp)
+  801dcd:	e8 ed f0 ff ff       	call   800ebf <fd2num>
+  801dd2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801dd5:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  801dd7:	83 c4 04             	add    $0x4,%esp
+  801dda:	ff 75 f0             	push   -0x10(%ebp)
+  801ddd:	e8 dd f0 ff ff       	call   800ebf <fd2num>
+  801de2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801de5:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  801de8:	83 c4 10             	add    $0x10,%esp
+  801deb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801df0:	eb 2e                	jmp    801e20 <pipe+0x141>
+	sys_page_unmap(0, va);
+  801df2:	83 ec 08             	sub    $0x8,%esp
+  801df5:	56                   	push   %esi
+  801df6:	6a 00                	push   $0x0
+  801df8:	e8 74 ee ff ff       	call   800c71 <sys_page_unmap>
+  801dfd:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  801e00:	83 ec 08             	sub    $0x8,%esp
+  801e03:	ff 75 f0             	push   -0x10(%ebp)
+  801e06:	6a 00                	push   $0x0
+  801e08:	e8 64 ee ff ff       	call   800c71 <sys_page_unmap>
+  801e0d:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  801e10:	83 ec 08             	sub    $0x8,%esp
+  801e13:	ff 75 f4             	push   -0xc(%ebp)
+  801e16:	6a 00                	push   $0x0
+  801e18:	e8 54 ee ff ff       	call   800c71 <sys_page_unmap>
+  801e1d:	83 c4 10             	add    $0x10,%esp
+}
+  801e20:	89 d8                	mov    %ebx,%eax
+  801e22:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e25:	5b                   	pop    %ebx
+  801e26:	5e                   	pop    %esi
+  801e27:	5d                   	pop    %ebp
+  801e28:	c3                   	ret
+
+00801e29 <pipeisclosed>:
+{
+  801e29:	55                   	push   %ebp
+  801e2a:	89 e5                	mov    %esp,%ebp
+  801e2c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801e2f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e32:	50                   	push   %eax
+  801e33:	ff 75 08             	push   0x8(%ebp)
+  801e36:	e8 01 f1 ff ff       	call   800f3c <fd_lookup>
+  801e3b:	83 c4 10             	add    $0x10,%esp
+  801e3e:	85 c0                	test   %eax,%eax
+  801e40:	78 18                	js     801e5a <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  801e42:	83 ec 0c             	sub    $0xc,%esp
+  801e45:	ff 75 f4             	push   -0xc(%ebp)
+  801e48:	e8 82 f0 ff ff       	call   800ecf <fd2data>
+  801e4d:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  801e4f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e52:	e8 33 fd ff ff       	call   801b8a <_pipeisclosed>
+  801e57:	83 c4 10             	add    $0x10,%esp
+}
+  801e5a:	c9                   	leave
+  801e5b:	c3                   	ret
+
+00801e5c <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  801e5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e61:	c3                   	ret
+
+00801e62 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  801e62:	55                   	push   %ebp
+  801e63:	89 e5                	mov    %esp,%ebp
+  801e65:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  801e68:	68 8b 2a 80 00       	push   $0x802a8b
+  801e6d:	ff 75 0c             	push   0xc(%ebp)
+  801e70:	e8 8b e9 ff ff       	call   800800 <strcpy>
+	return 0;
+}
+  801e75:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e7a:	c9                   	leave
+  801e7b:	c3                   	ret
+
+00801e7c <devcons_write>:
+{
+  801e7c:	55                   	push   %ebp
+  801e7d:	89 e5                	mov    %esp,%ebp
+  801e7f:	57                   	push   %edi
+  801e80:	56                   	push   %esi
+  801e81:	53                   	push   %ebx
+  801e82:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  801e88:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  801e8d:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  801e93:	eb 2e                	jmp    801ec3 <devcons_write+0x47>
+		m = n - tot;
+  801e95:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801e98:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  801e9a:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801e9f:	39 c3                	cmp    %eax,%ebx
+  801ea1:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  801ea4:	83 ec 04             	sub    $0x4,%esp
+  801ea7:	53                   	push   %ebx
+  801ea8:	89 f0                	mov    %esi,%eax
+  801eaa:	03 45 0c             	add    0xc(%ebp),%eax
+  801ead:	50                   	push   %eax
+  801eae:	57                   	push   %edi
+  801eaf:	e8 d2 ea ff ff       	call   800986 <memmove>
+		sys_cputs(buf, m);
+  801eb4:	83 c4 08             	add    $0x8,%esp
+  801eb7:	53                   	push   %ebx
+  801eb8:	57                   	push   %edi
+  801eb9:	e8 72 ec ff ff       	call   800b30 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  801ebe:	01 de                	add    %ebx,%esi
+  801ec0:	83 c4 10             	add    $0x10,%esp
+  801ec3:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801ec6:	72 cd                	jb     801e95 <devcons_write+0x19>
+}
+  801ec8:	89 f0                	mov    %esi,%eax
+  801eca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ecd:	5b                   	pop    %ebx
+  801ece:	5e                   	pop    %esi
+  801ecf:	5f                   	pop    %edi
+  801ed0:	5d                   	pop    %ebp
+  801ed1:	c3                   	ret
+
+00801ed2 <devcons_read>:
+{
+  801ed2:	55                   	push   %ebp
+  801ed3:	89 e5                	mov    %esp,%ebp
+  801ed5:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  801ed8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801edd:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801ee1:	75 07                	jne    801eea <devcons_read+0x18>
+  801ee3:	eb 1f                	jmp    801f04 <devcons_read+0x32>
+		sys_yield();
+  801ee5:	e8 e3 ec ff ff       	call   800bcd <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  801eea:	e8 5f ec ff ff       	call   800b4e <sys_cgetc>
+  801eef:	85 c0                	test   %eax,%eax
+  801ef1:	74 f2                	je     801ee5 <devcons_read+0x13>
+	if (c < 0)
+  801ef3:	78 0f                	js     801f04 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  801ef5:	83 f8 04             	cmp    $0x4,%eax
+  801ef8:	74 0c                	je     801f06 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  801efa:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801efd:	88 02                	mov    %al,(%edx)
+	return 1;
+  801eff:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  801f04:	c9                   	leave
+  801f05:	c3                   	ret
+		return 0;
+  801f06:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f0b:	eb f7                	jmp    801f04 <devcons_read+0x32>
+
+00801f0d <cputchar>:
+{
+  801f0d:	55                   	push   %ebp
+  801f0e:	89 e5                	mov    %esp,%ebp
+  801f10:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  801f13:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f16:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  801f19:	6a 01                	push   $0x1
+  801f1b:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801f1e:	50                   	push   %eax
+  801f1f:	e8 0c ec ff ff       	call   800b30 <sys_cputs>
+}
+  801f24:	83 c4 10             	add    $0x10,%esp
+  801f27:	c9                   	leave
+  801f28:	c3                   	ret
+
+00801f29 <getchar>:
+{
+  801f29:	55                   	push   %ebp
+  801f2a:	89 e5                	mov    %esp,%ebp
+  801f2c:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  801f2f:	6a 01                	push   $0x1
+  801f31:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801f34:	50                   	push   %eax
+  801f35:	6a 00                	push   $0x0
+  801f37:	e8 66 f2 ff ff       	call   8011a2 <read>
+	if (r < 0)
+  801f3c:	83 c4 10             	add    $0x10,%esp
+  801f3f:	85 c0                	test   %eax,%eax
+  801f41:	78 06                	js     801f49 <getchar+0x20>
+	if (r < 1)
+  801f43:	74 06                	je     801f4b <getchar+0x22>
+	return c;
+  801f45:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  801f49:	c9                   	leave
+  801f4a:	c3                   	ret
+		return -E_EOF;
+  801f4b:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  801f50:	eb f7                	jmp    801f49 <getchar+0x20>
+
+00801f52 <iscons>:
+{
+  801f52:	55                   	push   %ebp
+  801f53:	89 e5                	mov    %esp,%ebp
+  801f55:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801f58:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f5b:	50                   	push   %eax
+  801f5c:	ff 75 08             	push   0x8(%ebp)
+  801f5f:	e8 d8 ef ff ff       	call   800f3c <fd_lookup>
+  801f64:	83 c4 10             	add    $0x10,%esp
+  801f67:	85 c0                	test   %eax,%eax
+  801f69:	78 11                	js     801f7c <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  801f6b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f6e:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  801f74:	39 10                	cmp    %edx,(%eax)
+  801f76:	0f 94 c0             	sete   %al
+  801f79:	0f b6 c0             	movzbl %al,%eax
+}
+  801f7c:	c9                   	leave
+  801f7d:	c3                   	ret
+
+00801f7e <opencons>:
+{
+  801f7e:	55                   	push   %ebp
+  801f7f:	89 e5                	mov    %esp,%ebp
+  801f81:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  801f84:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f87:	50                   	push   %eax
+  801f88:	e8 59 ef ff ff       	call   800ee6 <fd_alloc>
+  801f8d:	83 c4 10             	add    $0x10,%esp
+  801f90:	85 c0                	test   %eax,%eax
+  801f92:	78 3a                	js     801fce <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  801f94:	83 ec 04             	sub    $0x4,%esp
+  801f97:	68 07 04 00 00       	push   $0x407
+  801f9c:	ff 75 f4             	push   -0xc(%ebp)
+  801f9f:	6a 00                	push   $0x0
+  801fa1:	e8 46 ec ff ff       	call   800bec <sys_page_alloc>
+  801fa6:	83 c4 10             	add    $0x10,%esp
+  801fa9:	85 c0                	test   %eax,%eax
+  801fab:	78 21                	js     801fce <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  801fad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801fb0:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  801fb6:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  801fb8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801fbb:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  801fc2:	83 ec 0c             	sub    $0xc,%esp
+  801fc5:	50                   	push   %eax
+  801fc6:	e8 f4 ee ff ff       	call   800ebf <fd2num>
+  801fcb:	83 c4 10             	add    $0x10,%esp
+}
+  801fce:	c9                   	leave
+  801fcf:	c3                   	ret
+
+00801fd0 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  801fd0:	55                   	push   %ebp
+  801fd1:	89 e5                	mov    %esp,%ebp
+  801fd3:	56                   	push   %esi
+  801fd4:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  801fd5:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  801fd8:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  801fde:	e8 cb eb ff ff       	call   800bae <sys_getenvid>
+  801fe3:	83 ec 0c             	sub    $0xc,%esp
+  801fe6:	ff 75 0c             	push   0xc(%ebp)
+  801fe9:	ff 75 08             	push   0x8(%ebp)
+  801fec:	56                   	push   %esi
+  801fed:	50                   	push   %eax
+  801fee:	68 98 2a 80 00       	push   $0x802a98
+  801ff3:	e8 4f e2 ff ff       	call   800247 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  801ff8:	83 c4 18             	add    $0x18,%esp
+  801ffb:	53                   	push   %ebx
+  801ffc:	ff 75 10             	push   0x10(%ebp)
+  801fff:	e8 f2 e1 ff ff       	call   8001f6 <vcprintf>
+	cprintf("\n");
+  802004:	c7 04 24 84 2a 80 00 	movl   $0x802a84,(%esp)
+  80200b:	e8 37 e2 ff ff       	call   800247 <cprintf>
+  802010:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  802013:	cc                   	int3
+	while (1)
+  802014:	eb fd                	jmp    802013 <_panic+0x43>
+
+00802016 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  802016:	55                   	push   %ebp
+  802017:	89 e5                	mov    %esp,%ebp
+  802019:	56                   	push   %esi
+  80201a:	53                   	push   %ebx
+  80201b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80201e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802021:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  802024:	85 c0                	test   %eax,%eax
+  802026:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80202b:	0f 44 c2             	cmove  %edx,%eax
+  80202e:	83 ec 0c             	sub    $0xc,%esp
+  802031:	50                   	push   %eax
+  802032:	e8 65 ed ff ff       	call   800d9c <sys_ipc_recv>
+
+  if (from_env_store)
+  802037:	83 c4 10             	add    $0x10,%esp
+  80203a:	85 f6                	test   %esi,%esi
+  80203c:	74 17                	je     802055 <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  80203e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802043:	85 c0                	test   %eax,%eax
+  802045:	75 0c                	jne    802053 <ipc_recv+0x3d>
+  802047:	8b 15 4c 50 80 00    	mov    0x80504c,%edx
+  80204d:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  802053:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  802055:	85 db                	test   %ebx,%ebx
+  802057:	74 2b                	je     802084 <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  802059:	85 c0                	test   %eax,%eax
+  80205b:	74 0d                	je     80206a <ipc_recv+0x54>
+  80205d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  802063:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802066:	5b                   	pop    %ebx
+  802067:	5e                   	pop    %esi
+  802068:	5d                   	pop    %ebp
+  802069:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  80206a:	a1 4c 50 80 00       	mov    0x80504c,%eax
+  80206f:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  802075:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  802077:	a1 4c 50 80 00       	mov    0x80504c,%eax
+  80207c:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  802082:	eb df                	jmp    802063 <ipc_recv+0x4d>
+  802084:	85 c0                	test   %eax,%eax
+  802086:	75 db                	jne    802063 <ipc_recv+0x4d>
+  802088:	eb ed                	jmp    802077 <ipc_recv+0x61>
+
+0080208a <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  80208a:	55                   	push   %ebp
+  80208b:	89 e5                	mov    %esp,%ebp
+  80208d:	57                   	push   %edi
+  80208e:	56                   	push   %esi
+  80208f:	53                   	push   %ebx
+  802090:	83 ec 0c             	sub    $0xc,%esp
+  802093:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802096:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802099:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  80209c:	85 db                	test   %ebx,%ebx
+  80209e:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8020a3:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  8020a6:	ff 75 14             	push   0x14(%ebp)
+  8020a9:	53                   	push   %ebx
+  8020aa:	56                   	push   %esi
+  8020ab:	57                   	push   %edi
+  8020ac:	e8 c8 ec ff ff       	call   800d79 <sys_ipc_try_send>
+  8020b1:	83 c4 10             	add    $0x10,%esp
+  8020b4:	85 c0                	test   %eax,%eax
+  8020b6:	74 1e                	je     8020d6 <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  8020b8:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8020bb:	75 07                	jne    8020c4 <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  8020bd:	e8 0b eb ff ff       	call   800bcd <sys_yield>
+  8020c2:	eb e2                	jmp    8020a6 <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  8020c4:	50                   	push   %eax
+  8020c5:	68 bb 2a 80 00       	push   $0x802abb
+  8020ca:	6a 3c                	push   $0x3c
+  8020cc:	68 c8 2a 80 00       	push   $0x802ac8
+  8020d1:	e8 fa fe ff ff       	call   801fd0 <_panic>
+  }
+
+#endif
+}
+  8020d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020d9:	5b                   	pop    %ebx
+  8020da:	5e                   	pop    %esi
+  8020db:	5f                   	pop    %edi
+  8020dc:	5d                   	pop    %ebp
+  8020dd:	c3                   	ret
+
+008020de <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  8020de:	55                   	push   %ebp
+  8020df:	89 e5                	mov    %esp,%ebp
+  8020e1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  8020e4:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  8020e9:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8020ec:	c1 e0 04             	shl    $0x4,%eax
+  8020ef:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8020f4:	8b 40 50             	mov    0x50(%eax),%eax
+  8020f7:	39 c8                	cmp    %ecx,%eax
+  8020f9:	74 12                	je     80210d <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  8020fb:	83 c2 01             	add    $0x1,%edx
+  8020fe:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802104:	75 e3                	jne    8020e9 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802106:	b8 00 00 00 00       	mov    $0x0,%eax
+  80210b:	eb 0e                	jmp    80211b <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  80210d:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802110:	c1 e0 04             	shl    $0x4,%eax
+  802113:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802118:	8b 40 48             	mov    0x48(%eax),%eax
+  80211b:	5d                   	pop    %ebp
+  80211c:	c3                   	ret
+
+0080211d <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80211d:	55                   	push   %ebp
+  80211e:	89 e5                	mov    %esp,%ebp
+  802120:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802123:	89 c2                	mov    %eax,%edx
+  802125:	c1 ea 16             	shr    $0x16,%edx
+  802128:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80212f:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802134:	f6 c1 01             	test   $0x1,%cl
+  802137:	74 1c                	je     802155 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  802139:	c1 e8 0c             	shr    $0xc,%eax
+  80213c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802143:	a8 01                	test   $0x1,%al
+  802145:	74 0e                	je     802155 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802147:	c1 e8 0c             	shr    $0xc,%eax
+  80214a:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802151:	ef 
+  802152:	0f b7 d2             	movzwl %dx,%edx
+}
+  802155:	89 d0                	mov    %edx,%eax
+  802157:	5d                   	pop    %ebp
+  802158:	c3                   	ret
+  802159:	66 90                	xchg   %ax,%ax
+  80215b:	66 90                	xchg   %ax,%ax
+  80215d:	66 90                	xchg   %ax,%ax
+  80215f:	90                   	nop
+
+00802160 <__udivmoddi4>:
+  802160:	55                   	push   %ebp
+  802161:	57                   	push   %edi
+  802162:	56                   	push   %esi
+  802163:	53                   	push   %ebx
+  802164:	83 ec 24             	sub    $0x24,%esp
+  802167:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80216b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80216f:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  802173:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802177:	8b 54 24 44          	mov    0x44(%esp),%edx
+  80217b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80217f:	8b 44 24 40          	mov    0x40(%esp),%eax
+  802183:	89 d3                	mov    %edx,%ebx
+  802185:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802189:	09 c3                	or     %eax,%ebx
+  80218b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80218f:	0f 84 9c 00 00 00    	je     802231 <__udivmoddi4+0xd1>
+  802195:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80219c:	00 
+  80219d:	31 c0                	xor    %eax,%eax
+  80219f:	31 d2                	xor    %edx,%edx
+  8021a1:	89 fb                	mov    %edi,%ebx
+  8021a3:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8021aa:	00 
+  8021ab:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8021b0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8021b4:	01 c0                	add    %eax,%eax
+  8021b6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8021bd:	00 
+  8021be:	89 c6                	mov    %eax,%esi
+  8021c0:	89 d7                	mov    %edx,%edi
+  8021c2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8021c6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8021ca:	0f ad d0             	shrd   %cl,%edx,%eax
+  8021cd:	d3 ea                	shr    %cl,%edx
+  8021cf:	f6 c1 20             	test   $0x20,%cl
+  8021d2:	0f 45 c2             	cmovne %edx,%eax
+  8021d5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8021d9:	83 e0 01             	and    $0x1,%eax
+  8021dc:	09 fa                	or     %edi,%edx
+  8021de:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8021e2:	89 04 24             	mov    %eax,(%esp)
+  8021e5:	8b 04 24             	mov    (%esp),%eax
+  8021e8:	89 d5                	mov    %edx,%ebp
+  8021ea:	09 f0                	or     %esi,%eax
+  8021ec:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8021f0:	39 f0                	cmp    %esi,%eax
+  8021f2:	19 fd                	sbb    %edi,%ebp
+  8021f4:	72 1d                	jb     802213 <__udivmoddi4+0xb3>
+  8021f6:	29 f0                	sub    %esi,%eax
+  8021f8:	19 fa                	sbb    %edi,%edx
+  8021fa:	89 cf                	mov    %ecx,%edi
+  8021fc:	c1 ef 05             	shr    $0x5,%edi
+  8021ff:	83 e7 01             	and    $0x1,%edi
+  802202:	89 fe                	mov    %edi,%esi
+  802204:	d3 e7                	shl    %cl,%edi
+  802206:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80220a:	83 f6 01             	xor    $0x1,%esi
+  80220d:	d3 e6                	shl    %cl,%esi
+  80220f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802213:	83 e9 01             	sub    $0x1,%ecx
+  802216:	73 98                	jae    8021b0 <__udivmoddi4+0x50>
+  802218:	85 db                	test   %ebx,%ebx
+  80221a:	74 05                	je     802221 <__udivmoddi4+0xc1>
+  80221c:	89 03                	mov    %eax,(%ebx)
+  80221e:	89 53 04             	mov    %edx,0x4(%ebx)
+  802221:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802225:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802229:	83 c4 24             	add    $0x24,%esp
+  80222c:	5b                   	pop    %ebx
+  80222d:	5e                   	pop    %esi
+  80222e:	5f                   	pop    %edi
+  80222f:	5d                   	pop    %ebp
+  802230:	c3                   	ret
+  802231:	85 ff                	test   %edi,%edi
+  802233:	74 0d                	je     802242 <__udivmoddi4+0xe2>
+  802235:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  80223b:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  802242:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802246:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80224a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80224e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802252:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802256:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80225a:	83 c4 24             	add    $0x24,%esp
+  80225d:	5b                   	pop    %ebx
+  80225e:	5e                   	pop    %esi
+  80225f:	5f                   	pop    %edi
+  802260:	5d                   	pop    %ebp
+  802261:	c3                   	ret
+  802262:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802269:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00802270 <__udivdi3>:
+  802270:	57                   	push   %edi
+  802271:	56                   	push   %esi
+  802272:	53                   	push   %ebx
+  802273:	83 ec 20             	sub    $0x20,%esp
+  802276:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80227a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80227e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802282:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802286:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80228a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80228e:	89 d1                	mov    %edx,%ecx
+  802290:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802294:	09 c1                	or     %eax,%ecx
+  802296:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80229a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80229e:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  8022a2:	0f 84 88 00 00 00    	je     802330 <__udivdi3+0xc0>
+  8022a8:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8022af:	00 
+  8022b0:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8022b5:	31 c0                	xor    %eax,%eax
+  8022b7:	31 d2                	xor    %edx,%edx
+  8022b9:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8022c0:	00 
+  8022c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8022c8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8022cc:	01 c0                	add    %eax,%eax
+  8022ce:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8022d5:	00 
+  8022d6:	89 c6                	mov    %eax,%esi
+  8022d8:	89 d7                	mov    %edx,%edi
+  8022da:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8022de:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8022e2:	0f ad d0             	shrd   %cl,%edx,%eax
+  8022e5:	d3 ea                	shr    %cl,%edx
+  8022e7:	f6 c1 20             	test   $0x20,%cl
+  8022ea:	0f 45 c2             	cmovne %edx,%eax
+  8022ed:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8022f1:	83 e0 01             	and    $0x1,%eax
+  8022f4:	09 fa                	or     %edi,%edx
+  8022f6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8022fa:	89 04 24             	mov    %eax,(%esp)
+  8022fd:	8b 04 24             	mov    (%esp),%eax
+  802300:	89 d3                	mov    %edx,%ebx
+  802302:	09 f0                	or     %esi,%eax
+  802304:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802308:	39 f0                	cmp    %esi,%eax
+  80230a:	19 fb                	sbb    %edi,%ebx
+  80230c:	72 1d                	jb     80232b <__udivdi3+0xbb>
+  80230e:	29 f0                	sub    %esi,%eax
+  802310:	19 fa                	sbb    %edi,%edx
+  802312:	89 cf                	mov    %ecx,%edi
+  802314:	c1 ef 05             	shr    $0x5,%edi
+  802317:	83 e7 01             	and    $0x1,%edi
+  80231a:	89 fe                	mov    %edi,%esi
+  80231c:	d3 e7                	shl    %cl,%edi
+  80231e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802322:	83 f6 01             	xor    $0x1,%esi
+  802325:	d3 e6                	shl    %cl,%esi
+  802327:	09 74 24 18          	or     %esi,0x18(%esp)
+  80232b:	83 e9 01             	sub    $0x1,%ecx
+  80232e:	73 98                	jae    8022c8 <__udivdi3+0x58>
+  802330:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802334:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802338:	83 c4 20             	add    $0x20,%esp
+  80233b:	5b                   	pop    %ebx
+  80233c:	5e                   	pop    %esi
+  80233d:	5f                   	pop    %edi
+  80233e:	c3                   	ret
+  80233f:	90                   	nop
+
+00802340 <__umoddi3>:
+  802340:	57                   	push   %edi
+  802341:	56                   	push   %esi
+  802342:	53                   	push   %ebx
+  802343:	83 ec 18             	sub    $0x18,%esp
+  802346:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80234a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80234e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802352:	8b 54 24 34          	mov    0x34(%esp),%edx
+  802356:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80235a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80235e:	89 d1                	mov    %edx,%ecx
+  802360:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802364:	09 c1                	or     %eax,%ecx
+  802366:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80236a:	74 5b                	je     8023c7 <__umoddi3+0x87>
+  80236c:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802371:	31 c0                	xor    %eax,%eax
+  802373:	31 d2                	xor    %edx,%edx
+  802375:	8d 76 00             	lea    0x0(%esi),%esi
+  802378:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80237c:	01 c0                	add    %eax,%eax
+  80237e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802385:	00 
+  802386:	89 c6                	mov    %eax,%esi
+  802388:	89 d7                	mov    %edx,%edi
+  80238a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80238e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802392:	0f ad d0             	shrd   %cl,%edx,%eax
+  802395:	d3 ea                	shr    %cl,%edx
+  802397:	f6 c1 20             	test   $0x20,%cl
+  80239a:	0f 45 c2             	cmovne %edx,%eax
+  80239d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8023a1:	83 e0 01             	and    $0x1,%eax
+  8023a4:	09 fa                	or     %edi,%edx
+  8023a6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8023aa:	89 04 24             	mov    %eax,(%esp)
+  8023ad:	8b 04 24             	mov    (%esp),%eax
+  8023b0:	89 d3                	mov    %edx,%ebx
+  8023b2:	09 f0                	or     %esi,%eax
+  8023b4:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8023b8:	39 f0                	cmp    %esi,%eax
+  8023ba:	19 fb                	sbb    %edi,%ebx
+  8023bc:	72 04                	jb     8023c2 <__umoddi3+0x82>
+  8023be:	29 f0                	sub    %esi,%eax
+  8023c0:	19 fa                	sbb    %edi,%edx
+  8023c2:	83 e9 01             	sub    $0x1,%ecx
+  8023c5:	73 b1                	jae    802378 <__umoddi3+0x38>
+  8023c7:	83 c4 18             	add    $0x18,%esp
+  8023ca:	5b                   	pop    %ebx
+  8023cb:	5e                   	pop    %esi
+  8023cc:	5f                   	pop    %edi
+  8023cd:	c3                   	ret
+  8023ce:	66 90                	xchg   %ax,%ax
+
+008023d0 <__divdi3>:
+  8023d0:	55                   	push   %ebp
+  8023d1:	57                   	push   %edi
+  8023d2:	56                   	push   %esi
+  8023d3:	53                   	push   %ebx
+  8023d4:	83 ec 24             	sub    $0x24,%esp
+  8023d7:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  8023db:	8b 74 24 44          	mov    0x44(%esp),%esi
+  8023df:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8023e3:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8023e7:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  8023eb:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8023ef:	85 d2                	test   %edx,%edx
+  8023f1:	0f 88 e0 00 00 00    	js     8024d7 <__divdi3+0x107>
+  8023f7:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  8023fb:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  8023ff:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802403:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802407:	85 f6                	test   %esi,%esi
+  802409:	78 16                	js     802421 <__divdi3+0x51>
+  80240b:	89 f1                	mov    %esi,%ecx
+  80240d:	31 c0                	xor    %eax,%eax
+  80240f:	31 d2                	xor    %edx,%edx
+  802411:	09 d9                	or     %ebx,%ecx
+  802413:	0f 85 f3 00 00 00    	jne    80250c <__divdi3+0x13c>
+  802419:	83 c4 24             	add    $0x24,%esp
+  80241c:	5b                   	pop    %ebx
+  80241d:	5e                   	pop    %esi
+  80241e:	5f                   	pop    %edi
+  80241f:	5d                   	pop    %ebp
+  802420:	c3                   	ret
+  802421:	bf 01 00 00 00       	mov    $0x1,%edi
+  802426:	f7 5c 24 08          	negl   0x8(%esp)
+  80242a:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  80242f:	f7 5c 24 0c          	negl   0xc(%esp)
+  802433:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80243a:	00 
+  80243b:	31 c0                	xor    %eax,%eax
+  80243d:	31 d2                	xor    %edx,%edx
+  80243f:	89 fb                	mov    %edi,%ebx
+  802441:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802448:	00 
+  802449:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80244e:	66 90                	xchg   %ax,%ax
+  802450:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802454:	01 c0                	add    %eax,%eax
+  802456:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80245d:	00 
+  80245e:	89 c6                	mov    %eax,%esi
+  802460:	89 d7                	mov    %edx,%edi
+  802462:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802466:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80246a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80246d:	d3 ea                	shr    %cl,%edx
+  80246f:	f6 c1 20             	test   $0x20,%cl
+  802472:	0f 45 c2             	cmovne %edx,%eax
+  802475:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802479:	83 e0 01             	and    $0x1,%eax
+  80247c:	09 fa                	or     %edi,%edx
+  80247e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802482:	89 04 24             	mov    %eax,(%esp)
+  802485:	8b 04 24             	mov    (%esp),%eax
+  802488:	89 d5                	mov    %edx,%ebp
+  80248a:	09 f0                	or     %esi,%eax
+  80248c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802490:	39 f0                	cmp    %esi,%eax
+  802492:	19 fd                	sbb    %edi,%ebp
+  802494:	72 1d                	jb     8024b3 <__divdi3+0xe3>
+  802496:	29 f0                	sub    %esi,%eax
+  802498:	19 fa                	sbb    %edi,%edx
+  80249a:	89 cf                	mov    %ecx,%edi
+  80249c:	c1 ef 05             	shr    $0x5,%edi
+  80249f:	83 e7 01             	and    $0x1,%edi
+  8024a2:	89 fe                	mov    %edi,%esi
+  8024a4:	d3 e7                	shl    %cl,%edi
+  8024a6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8024aa:	83 f6 01             	xor    $0x1,%esi
+  8024ad:	d3 e6                	shl    %cl,%esi
+  8024af:	09 74 24 18          	or     %esi,0x18(%esp)
+  8024b3:	83 e9 01             	sub    $0x1,%ecx
+  8024b6:	73 98                	jae    802450 <__divdi3+0x80>
+  8024b8:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8024bc:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8024c0:	85 db                	test   %ebx,%ebx
+  8024c2:	0f 84 51 ff ff ff    	je     802419 <__divdi3+0x49>
+  8024c8:	f7 d8                	neg    %eax
+  8024ca:	83 d2 00             	adc    $0x0,%edx
+  8024cd:	83 c4 24             	add    $0x24,%esp
+  8024d0:	5b                   	pop    %ebx
+  8024d1:	f7 da                	neg    %edx
+  8024d3:	5e                   	pop    %esi
+  8024d4:	5f                   	pop    %edi
+  8024d5:	5d                   	pop    %ebp
+  8024d6:	c3                   	ret
+  8024d7:	f7 d8                	neg    %eax
+  8024d9:	83 d2 00             	adc    $0x0,%edx
+  8024dc:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8024e0:	f7 da                	neg    %edx
+  8024e2:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8024e6:	85 f6                	test   %esi,%esi
+  8024e8:	78 1b                	js     802505 <__divdi3+0x135>
+  8024ea:	89 f1                	mov    %esi,%ecx
+  8024ec:	31 c0                	xor    %eax,%eax
+  8024ee:	31 d2                	xor    %edx,%edx
+  8024f0:	bf 01 00 00 00       	mov    $0x1,%edi
+  8024f5:	09 d9                	or     %ebx,%ecx
+  8024f7:	0f 85 36 ff ff ff    	jne    802433 <__divdi3+0x63>
+  8024fd:	83 c4 24             	add    $0x24,%esp
+  802500:	5b                   	pop    %ebx
+  802501:	5e                   	pop    %esi
+  802502:	5f                   	pop    %edi
+  802503:	5d                   	pop    %ebp
+  802504:	c3                   	ret
+  802505:	31 ff                	xor    %edi,%edi
+  802507:	e9 1a ff ff ff       	jmp    802426 <__divdi3+0x56>
+  80250c:	31 ff                	xor    %edi,%edi
+  80250e:	e9 20 ff ff ff       	jmp    802433 <__divdi3+0x63>
+  802513:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80251a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00802520 <__moddi3>:
+  802520:	55                   	push   %ebp
+  802521:	57                   	push   %edi
+  802522:	56                   	push   %esi
+  802523:	53                   	push   %ebx
+  802524:	83 ec 1c             	sub    $0x1c,%esp
+  802527:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  80252b:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  80252f:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  802533:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  802537:	89 c8                	mov    %ecx,%eax
+  802539:	89 f2                	mov    %esi,%edx
+  80253b:	89 f3                	mov    %esi,%ebx
+  80253d:	85 ed                	test   %ebp,%ebp
+  80253f:	0f 88 9d 00 00 00    	js     8025e2 <__moddi3+0xc2>
+  802545:	09 cb                	or     %ecx,%ebx
+  802547:	0f 84 8d 00 00 00    	je     8025da <__moddi3+0xba>
+  80254d:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802551:	31 db                	xor    %ebx,%ebx
+  802553:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802557:	89 ca                	mov    %ecx,%edx
+  802559:	89 f0                	mov    %esi,%eax
+  80255b:	89 dd                	mov    %ebx,%ebp
+  80255d:	f7 da                	neg    %edx
+  80255f:	83 d0 00             	adc    $0x0,%eax
+  802562:	f7 d8                	neg    %eax
+  802564:	0f 49 f0             	cmovns %eax,%esi
+  802567:	0f 49 ca             	cmovns %edx,%ecx
+  80256a:	31 c0                	xor    %eax,%eax
+  80256c:	31 d2                	xor    %edx,%edx
+  80256e:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802572:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802576:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80257b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80257f:	90                   	nop
+  802580:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802584:	01 c0                	add    %eax,%eax
+  802586:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80258d:	00 
+  80258e:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  802592:	89 c6                	mov    %eax,%esi
+  802594:	89 d7                	mov    %edx,%edi
+  802596:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80259a:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80259e:	0f ad d0             	shrd   %cl,%edx,%eax
+  8025a1:	d3 ea                	shr    %cl,%edx
+  8025a3:	f6 c1 20             	test   $0x20,%cl
+  8025a6:	0f 45 c2             	cmovne %edx,%eax
+  8025a9:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8025ad:	83 e0 01             	and    $0x1,%eax
+  8025b0:	09 fa                	or     %edi,%edx
+  8025b2:	89 04 24             	mov    %eax,(%esp)
+  8025b5:	8b 04 24             	mov    (%esp),%eax
+  8025b8:	89 d7                	mov    %edx,%edi
+  8025ba:	09 f0                	or     %esi,%eax
+  8025bc:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  8025c0:	39 d8                	cmp    %ebx,%eax
+  8025c2:	19 f7                	sbb    %esi,%edi
+  8025c4:	72 04                	jb     8025ca <__moddi3+0xaa>
+  8025c6:	29 d8                	sub    %ebx,%eax
+  8025c8:	19 f2                	sbb    %esi,%edx
+  8025ca:	83 e9 01             	sub    $0x1,%ecx
+  8025cd:	73 b1                	jae    802580 <__moddi3+0x60>
+  8025cf:	85 ed                	test   %ebp,%ebp
+  8025d1:	74 07                	je     8025da <__moddi3+0xba>
+  8025d3:	f7 d8                	neg    %eax
+  8025d5:	83 d2 00             	adc    $0x0,%edx
+  8025d8:	f7 da                	neg    %edx
+  8025da:	83 c4 1c             	add    $0x1c,%esp
+  8025dd:	5b                   	pop    %ebx
+  8025de:	5e                   	pop    %esi
+  8025df:	5f                   	pop    %edi
+  8025e0:	5d                   	pop    %ebp
+  8025e1:	c3                   	ret
+  8025e2:	09 cb                	or     %ecx,%ebx
+  8025e4:	74 f4                	je     8025da <__moddi3+0xba>
+  8025e6:	f7 df                	neg    %edi
+  8025e8:	bb 01 00 00 00       	mov    $0x1,%ebx
+  8025ed:	83 d5 00             	adc    $0x0,%ebp
+  8025f0:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  8025f4:	f7 dd                	neg    %ebp
+  8025f6:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  8025fa:	e9 58 ff ff ff       	jmp    802557 <__moddi3+0x37>
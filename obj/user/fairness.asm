@@ -0,0 +1,5299 @@
+
+obj/user/fairness.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 70 00 00 00       	call   8000a1 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	83 ec 10             	sub    $0x10,%esp
+	envid_t who, id;
+
+	id = sys_getenvid();
+  80003b:	e8 c0 0a 00 00       	call   800b00 <sys_getenvid>
+  800040:	89 c3                	mov    %eax,%ebx
+
+	if (thisenv == &envs[1]) {
+  800042:	81 3d 08 40 80 00 90 	cmpl   $0xeec00090,0x804008
+  800049:	00 c0 ee 
+  80004c:	74 2d                	je     80007b <umain+0x48>
+		while (1) {
+			ipc_recv(&who, 0, 0);
+			cprintf("%x recv from %x\n", id, who);
+		}
+	} else {
+		cprintf("%x loop sending to %x\n", id, envs[1].env_id);
+  80004e:	a1 d8 00 c0 ee       	mov    0xeec000d8,%eax
+  800053:	83 ec 04             	sub    $0x4,%esp
+  800056:	50                   	push   %eax
+  800057:	53                   	push   %ebx
+  800058:	68 71 25 80 00       	push   $0x802571
+  80005d:	e8 37 01 00 00       	call   800199 <cprintf>
+  800062:	83 c4 10             	add    $0x10,%esp
+		while (1)
+			ipc_send(envs[1].env_id, 0, 0, 0);
+  800065:	a1 d8 00 c0 ee       	mov    0xeec000d8,%eax
+  80006a:	6a 00                	push   $0x0
+  80006c:	6a 00                	push   $0x0
+  80006e:	6a 00                	push   $0x0
+  800070:	50                   	push   %eax
+  800071:	e8 0f 0e 00 00       	call   800e85 <ipc_send>
+  800076:	83 c4 10             	add    $0x10,%esp
+  800079:	eb ea                	jmp    800065 <umain+0x32>
+			ipc_recv(&who, 0, 0);
+  80007b:	8d 75 f4             	lea    -0xc(%ebp),%esi
+  80007e:	83 ec 04             	sub    $0x4,%esp
+  800081:	6a 00                	push   $0x0
+  800083:	6a 00                	push   $0x0
+  800085:	56                   	push   %esi
+  800086:	e8 86 0d 00 00       	call   800e11 <ipc_recv>
+			cprintf("%x recv from %x\n", id, who);
+  80008b:	83 c4 0c             	add    $0xc,%esp
+  80008e:	ff 75 f4             	push   -0xc(%ebp)
+  800091:	53                   	push   %ebx
+  800092:	68 60 25 80 00       	push   $0x802560
+  800097:	e8 fd 00 00 00       	call   800199 <cprintf>
+  80009c:	83 c4 10             	add    $0x10,%esp
+  80009f:	eb dd                	jmp    80007e <umain+0x4b>
+
+008000a1 <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  8000a1:	55                   	push   %ebp
+  8000a2:	89 e5                	mov    %esp,%ebp
+  8000a4:	56                   	push   %esi
+  8000a5:	53                   	push   %ebx
+  8000a6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000a9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  8000ac:	e8 4f 0a 00 00       	call   800b00 <sys_getenvid>
+  8000b1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000b6:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8000b9:	c1 e0 04             	shl    $0x4,%eax
+  8000bc:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000c1:	a3 08 40 80 00       	mov    %eax,0x804008
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8000c6:	85 db                	test   %ebx,%ebx
+  8000c8:	7e 07                	jle    8000d1 <libmain+0x30>
+    binaryname = argv[0];
+  8000ca:	8b 06                	mov    (%esi),%eax
+  8000cc:	a3 00 30 80 00       	mov    %eax,0x803000
+
+  // call user main routine
+  umain(argc, argv);
+  8000d1:	83 ec 08             	sub    $0x8,%esp
+  8000d4:	56                   	push   %esi
+  8000d5:	53                   	push   %ebx
+  8000d6:	e8 58 ff ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  8000db:	e8 0a 00 00 00       	call   8000ea <exit>
+}
+  8000e0:	83 c4 10             	add    $0x10,%esp
+  8000e3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000e6:	5b                   	pop    %ebx
+  8000e7:	5e                   	pop    %esi
+  8000e8:	5d                   	pop    %ebp
+  8000e9:	c3                   	ret
+
+008000ea <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000ea:	55                   	push   %ebp
+  8000eb:	89 e5                	mov    %esp,%ebp
+  8000ed:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8000f0:	e8 f7 0f 00 00       	call   8010ec <close_all>
+	sys_env_destroy(0);
+  8000f5:	83 ec 0c             	sub    $0xc,%esp
+  8000f8:	6a 00                	push   $0x0
+  8000fa:	e8 c0 09 00 00       	call   800abf <sys_env_destroy>
+}
+  8000ff:	83 c4 10             	add    $0x10,%esp
+  800102:	c9                   	leave
+  800103:	c3                   	ret
+
+00800104 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800104:	55                   	push   %ebp
+  800105:	89 e5                	mov    %esp,%ebp
+  800107:	53                   	push   %ebx
+  800108:	83 ec 04             	sub    $0x4,%esp
+  80010b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80010e:	8b 13                	mov    (%ebx),%edx
+  800110:	8d 42 01             	lea    0x1(%edx),%eax
+  800113:	89 03                	mov    %eax,(%ebx)
+  800115:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800118:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80011c:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800121:	74 09                	je     80012c <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800123:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800127:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80012a:	c9                   	leave
+  80012b:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80012c:	83 ec 08             	sub    $0x8,%esp
+  80012f:	68 ff 00 00 00       	push   $0xff
+  800134:	8d 43 08             	lea    0x8(%ebx),%eax
+  800137:	50                   	push   %eax
+  800138:	e8 45 09 00 00       	call   800a82 <sys_cputs>
+		b->idx = 0;
+  80013d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800143:	83 c4 10             	add    $0x10,%esp
+  800146:	eb db                	jmp    800123 <putch+0x1f>
+
+00800148 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800148:	55                   	push   %ebp
+  800149:	89 e5                	mov    %esp,%ebp
+  80014b:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800151:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800158:	00 00 00 
+	b.cnt = 0;
+  80015b:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800162:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800165:	ff 75 0c             	push   0xc(%ebp)
+  800168:	ff 75 08             	push   0x8(%ebp)
+  80016b:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800171:	50                   	push   %eax
+  800172:	68 04 01 80 00       	push   $0x800104
+  800177:	e8 14 01 00 00       	call   800290 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80017c:	83 c4 08             	add    $0x8,%esp
+  80017f:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800185:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80018b:	50                   	push   %eax
+  80018c:	e8 f1 08 00 00       	call   800a82 <sys_cputs>
+
+	return b.cnt;
+}
+  800191:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800197:	c9                   	leave
+  800198:	c3                   	ret
+
+00800199 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800199:	55                   	push   %ebp
+  80019a:	89 e5                	mov    %esp,%ebp
+  80019c:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80019f:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8001a2:	50                   	push   %eax
+  8001a3:	ff 75 08             	push   0x8(%ebp)
+  8001a6:	e8 9d ff ff ff       	call   800148 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8001ab:	c9                   	leave
+  8001ac:	c3                   	ret
+
+008001ad <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8001ad:	55                   	push   %ebp
+  8001ae:	89 e5                	mov    %esp,%ebp
+  8001b0:	57                   	push   %edi
+  8001b1:	56                   	push   %esi
+  8001b2:	53                   	push   %ebx
+  8001b3:	83 ec 1c             	sub    $0x1c,%esp
+  8001b6:	89 c7                	mov    %eax,%edi
+  8001b8:	89 d6                	mov    %edx,%esi
+  8001ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001bd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001c0:	89 d1                	mov    %edx,%ecx
+  8001c2:	89 c2                	mov    %eax,%edx
+  8001c4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001c7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001ca:	8b 45 10             	mov    0x10(%ebp),%eax
+  8001cd:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8001d0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001d3:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8001da:	39 c2                	cmp    %eax,%edx
+  8001dc:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8001df:	72 3e                	jb     80021f <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8001e1:	83 ec 0c             	sub    $0xc,%esp
+  8001e4:	ff 75 18             	push   0x18(%ebp)
+  8001e7:	83 eb 01             	sub    $0x1,%ebx
+  8001ea:	53                   	push   %ebx
+  8001eb:	50                   	push   %eax
+  8001ec:	83 ec 08             	sub    $0x8,%esp
+  8001ef:	ff 75 e4             	push   -0x1c(%ebp)
+  8001f2:	ff 75 e0             	push   -0x20(%ebp)
+  8001f5:	ff 75 dc             	push   -0x24(%ebp)
+  8001f8:	ff 75 d8             	push   -0x28(%ebp)
+  8001fb:	e8 c0 1f 00 00       	call   8021c0 <__udivdi3>
+  800200:	83 c4 18             	add    $0x18,%esp
+  800203:	52                   	push   %edx
+  800204:	50                   	push   %eax
+  800205:	89 f2                	mov    %esi,%edx
+  800207:	89 f8                	mov    %edi,%eax
+  800209:	e8 9f ff ff ff       	call   8001ad <printnum>
+  80020e:	83 c4 20             	add    $0x20,%esp
+  800211:	eb 13                	jmp    800226 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800213:	83 ec 08             	sub    $0x8,%esp
+  800216:	56                   	push   %esi
+  800217:	ff 75 18             	push   0x18(%ebp)
+  80021a:	ff d7                	call   *%edi
+  80021c:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80021f:	83 eb 01             	sub    $0x1,%ebx
+  800222:	85 db                	test   %ebx,%ebx
+  800224:	7f ed                	jg     800213 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800226:	83 ec 08             	sub    $0x8,%esp
+  800229:	56                   	push   %esi
+  80022a:	83 ec 04             	sub    $0x4,%esp
+  80022d:	ff 75 e4             	push   -0x1c(%ebp)
+  800230:	ff 75 e0             	push   -0x20(%ebp)
+  800233:	ff 75 dc             	push   -0x24(%ebp)
+  800236:	ff 75 d8             	push   -0x28(%ebp)
+  800239:	e8 52 20 00 00       	call   802290 <__umoddi3>
+  80023e:	83 c4 14             	add    $0x14,%esp
+  800241:	0f be 80 92 25 80 00 	movsbl 0x802592(%eax),%eax
+  800248:	50                   	push   %eax
+  800249:	ff d7                	call   *%edi
+}
+  80024b:	83 c4 10             	add    $0x10,%esp
+  80024e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800251:	5b                   	pop    %ebx
+  800252:	5e                   	pop    %esi
+  800253:	5f                   	pop    %edi
+  800254:	5d                   	pop    %ebp
+  800255:	c3                   	ret
+
+00800256 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800256:	55                   	push   %ebp
+  800257:	89 e5                	mov    %esp,%ebp
+  800259:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80025c:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800260:	8b 10                	mov    (%eax),%edx
+  800262:	3b 50 04             	cmp    0x4(%eax),%edx
+  800265:	73 0a                	jae    800271 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800267:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80026a:	89 08                	mov    %ecx,(%eax)
+  80026c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80026f:	88 02                	mov    %al,(%edx)
+}
+  800271:	5d                   	pop    %ebp
+  800272:	c3                   	ret
+
+00800273 <printfmt>:
+{
+  800273:	55                   	push   %ebp
+  800274:	89 e5                	mov    %esp,%ebp
+  800276:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800279:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80027c:	50                   	push   %eax
+  80027d:	ff 75 10             	push   0x10(%ebp)
+  800280:	ff 75 0c             	push   0xc(%ebp)
+  800283:	ff 75 08             	push   0x8(%ebp)
+  800286:	e8 05 00 00 00       	call   800290 <vprintfmt>
+}
+  80028b:	83 c4 10             	add    $0x10,%esp
+  80028e:	c9                   	leave
+  80028f:	c3                   	ret
+
+00800290 <vprintfmt>:
+{
+  800290:	55                   	push   %ebp
+  800291:	89 e5                	mov    %esp,%ebp
+  800293:	57                   	push   %edi
+  800294:	56                   	push   %esi
+  800295:	53                   	push   %ebx
+  800296:	83 ec 2c             	sub    $0x2c,%esp
+  800299:	8b 75 08             	mov    0x8(%ebp),%esi
+  80029c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80029f:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8002a2:	eb 0a                	jmp    8002ae <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8002a4:	83 ec 08             	sub    $0x8,%esp
+  8002a7:	53                   	push   %ebx
+  8002a8:	50                   	push   %eax
+  8002a9:	ff d6                	call   *%esi
+  8002ab:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8002ae:	83 c7 01             	add    $0x1,%edi
+  8002b1:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8002b5:	83 f8 25             	cmp    $0x25,%eax
+  8002b8:	74 0c                	je     8002c6 <vprintfmt+0x36>
+			if (ch == '\0')
+  8002ba:	85 c0                	test   %eax,%eax
+  8002bc:	75 e6                	jne    8002a4 <vprintfmt+0x14>
+}
+  8002be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002c1:	5b                   	pop    %ebx
+  8002c2:	5e                   	pop    %esi
+  8002c3:	5f                   	pop    %edi
+  8002c4:	5d                   	pop    %ebp
+  8002c5:	c3                   	ret
+		padc = ' ';
+  8002c6:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8002ca:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8002d1:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8002d8:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8002df:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8002e4:	8d 47 01             	lea    0x1(%edi),%eax
+  8002e7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8002ea:	0f b6 17             	movzbl (%edi),%edx
+  8002ed:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8002f0:	3c 55                	cmp    $0x55,%al
+  8002f2:	0f 87 9a 03 00 00    	ja     800692 <vprintfmt+0x402>
+  8002f8:	0f b6 c0             	movzbl %al,%eax
+  8002fb:	ff 24 85 e0 26 80 00 	jmp    *0x8026e0(,%eax,4)
+  800302:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800305:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800309:	eb d9                	jmp    8002e4 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80030b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80030e:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800312:	eb d0                	jmp    8002e4 <vprintfmt+0x54>
+  800314:	0f b6 d2             	movzbl %dl,%edx
+  800317:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80031a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80031f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800322:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800325:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800329:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80032c:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80032f:	83 f9 09             	cmp    $0x9,%ecx
+  800332:	77 55                	ja     800389 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800334:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800337:	eb e9                	jmp    800322 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800339:	8b 45 14             	mov    0x14(%ebp),%eax
+  80033c:	8b 00                	mov    (%eax),%eax
+  80033e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800341:	8b 45 14             	mov    0x14(%ebp),%eax
+  800344:	8d 40 04             	lea    0x4(%eax),%eax
+  800347:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80034a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80034d:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800351:	79 91                	jns    8002e4 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800353:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800356:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800359:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800360:	eb 82                	jmp    8002e4 <vprintfmt+0x54>
+			if (width < 0)
+  800362:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800365:	85 d2                	test   %edx,%edx
+  800367:	b8 00 00 00 00       	mov    $0x0,%eax
+  80036c:	0f 49 c2             	cmovns %edx,%eax
+  80036f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800372:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800375:	e9 6a ff ff ff       	jmp    8002e4 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80037a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80037d:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800384:	e9 5b ff ff ff       	jmp    8002e4 <vprintfmt+0x54>
+  800389:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80038c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80038f:	eb bc                	jmp    80034d <vprintfmt+0xbd>
+			lflag++;
+  800391:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800394:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800397:	e9 48 ff ff ff       	jmp    8002e4 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80039c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80039f:	8d 78 04             	lea    0x4(%eax),%edi
+  8003a2:	83 ec 08             	sub    $0x8,%esp
+  8003a5:	53                   	push   %ebx
+  8003a6:	ff 30                	push   (%eax)
+  8003a8:	ff d6                	call   *%esi
+			break;
+  8003aa:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8003ad:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8003b0:	e9 7c 02 00 00       	jmp    800631 <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  8003b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003b8:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8003bb:	8b 10                	mov    (%eax),%edx
+  8003bd:	89 d0                	mov    %edx,%eax
+  8003bf:	f7 d8                	neg    %eax
+  8003c1:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8003c4:	83 f8 10             	cmp    $0x10,%eax
+  8003c7:	7f 23                	jg     8003ec <vprintfmt+0x15c>
+  8003c9:	8b 14 85 40 28 80 00 	mov    0x802840(,%eax,4),%edx
+  8003d0:	85 d2                	test   %edx,%edx
+  8003d2:	74 18                	je     8003ec <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8003d4:	52                   	push   %edx
+  8003d5:	68 91 29 80 00       	push   $0x802991
+  8003da:	53                   	push   %ebx
+  8003db:	56                   	push   %esi
+  8003dc:	e8 92 fe ff ff       	call   800273 <printfmt>
+  8003e1:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003e4:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8003e7:	e9 45 02 00 00       	jmp    800631 <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  8003ec:	50                   	push   %eax
+  8003ed:	68 aa 25 80 00       	push   $0x8025aa
+  8003f2:	53                   	push   %ebx
+  8003f3:	56                   	push   %esi
+  8003f4:	e8 7a fe ff ff       	call   800273 <printfmt>
+  8003f9:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003fc:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8003ff:	e9 2d 02 00 00       	jmp    800631 <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800404:	8b 45 14             	mov    0x14(%ebp),%eax
+  800407:	83 c0 04             	add    $0x4,%eax
+  80040a:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80040d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800410:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800412:	85 c9                	test   %ecx,%ecx
+  800414:	b8 a3 25 80 00       	mov    $0x8025a3,%eax
+  800419:	0f 45 c1             	cmovne %ecx,%eax
+  80041c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80041f:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800423:	7e 06                	jle    80042b <vprintfmt+0x19b>
+  800425:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800429:	75 0b                	jne    800436 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80042b:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80042e:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800431:	89 75 08             	mov    %esi,0x8(%ebp)
+  800434:	eb 5c                	jmp    800492 <vprintfmt+0x202>
+  800436:	83 ec 08             	sub    $0x8,%esp
+  800439:	ff 75 d0             	push   -0x30(%ebp)
+  80043c:	ff 75 cc             	push   -0x34(%ebp)
+  80043f:	e8 eb 02 00 00       	call   80072f <strnlen>
+  800444:	89 c2                	mov    %eax,%edx
+  800446:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800449:	29 d0                	sub    %edx,%eax
+  80044b:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80044e:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800452:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800455:	89 75 08             	mov    %esi,0x8(%ebp)
+  800458:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80045a:	eb 0e                	jmp    80046a <vprintfmt+0x1da>
+					putch(padc, putdat);
+  80045c:	83 ec 08             	sub    $0x8,%esp
+  80045f:	53                   	push   %ebx
+  800460:	57                   	push   %edi
+  800461:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800464:	83 ee 01             	sub    $0x1,%esi
+  800467:	83 c4 10             	add    $0x10,%esp
+  80046a:	85 f6                	test   %esi,%esi
+  80046c:	7f ee                	jg     80045c <vprintfmt+0x1cc>
+  80046e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800471:	8b 75 08             	mov    0x8(%ebp),%esi
+  800474:	85 c0                	test   %eax,%eax
+  800476:	ba 00 00 00 00       	mov    $0x0,%edx
+  80047b:	0f 49 d0             	cmovns %eax,%edx
+  80047e:	29 d0                	sub    %edx,%eax
+  800480:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800483:	eb a6                	jmp    80042b <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800485:	83 ec 08             	sub    $0x8,%esp
+  800488:	53                   	push   %ebx
+  800489:	52                   	push   %edx
+  80048a:	ff 55 08             	call   *0x8(%ebp)
+  80048d:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800490:	89 f1                	mov    %esi,%ecx
+  800492:	8d 71 01             	lea    0x1(%ecx),%esi
+  800495:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800499:	0f be d0             	movsbl %al,%edx
+  80049c:	85 d2                	test   %edx,%edx
+  80049e:	74 28                	je     8004c8 <vprintfmt+0x238>
+  8004a0:	85 ff                	test   %edi,%edi
+  8004a2:	78 05                	js     8004a9 <vprintfmt+0x219>
+  8004a4:	83 ef 01             	sub    $0x1,%edi
+  8004a7:	78 30                	js     8004d9 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8004a9:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8004ad:	74 d6                	je     800485 <vprintfmt+0x1f5>
+  8004af:	0f be c0             	movsbl %al,%eax
+  8004b2:	83 e8 20             	sub    $0x20,%eax
+  8004b5:	83 f8 5e             	cmp    $0x5e,%eax
+  8004b8:	76 cb                	jbe    800485 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8004ba:	83 ec 08             	sub    $0x8,%esp
+  8004bd:	53                   	push   %ebx
+  8004be:	6a 3f                	push   $0x3f
+  8004c0:	ff 55 08             	call   *0x8(%ebp)
+  8004c3:	83 c4 10             	add    $0x10,%esp
+  8004c6:	eb c8                	jmp    800490 <vprintfmt+0x200>
+  8004c8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004cb:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8004ce:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004d1:	01 d0                	add    %edx,%eax
+  8004d3:	29 c8                	sub    %ecx,%eax
+  8004d5:	89 c7                	mov    %eax,%edi
+  8004d7:	eb 13                	jmp    8004ec <vprintfmt+0x25c>
+  8004d9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004dc:	eb ed                	jmp    8004cb <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8004de:	83 ec 08             	sub    $0x8,%esp
+  8004e1:	53                   	push   %ebx
+  8004e2:	6a 20                	push   $0x20
+  8004e4:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8004e6:	83 ef 01             	sub    $0x1,%edi
+  8004e9:	83 c4 10             	add    $0x10,%esp
+  8004ec:	85 ff                	test   %edi,%edi
+  8004ee:	7f ee                	jg     8004de <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004f0:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8004f3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004f6:	e9 36 01 00 00       	jmp    800631 <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  8004fb:	83 f9 01             	cmp    $0x1,%ecx
+  8004fe:	7f 1f                	jg     80051f <vprintfmt+0x28f>
+	else if (lflag)
+  800500:	85 c9                	test   %ecx,%ecx
+  800502:	74 67                	je     80056b <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800504:	8b 45 14             	mov    0x14(%ebp),%eax
+  800507:	8b 00                	mov    (%eax),%eax
+  800509:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80050c:	89 c1                	mov    %eax,%ecx
+  80050e:	c1 f9 1f             	sar    $0x1f,%ecx
+  800511:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800514:	8b 45 14             	mov    0x14(%ebp),%eax
+  800517:	8d 40 04             	lea    0x4(%eax),%eax
+  80051a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80051d:	eb 17                	jmp    800536 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  80051f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800522:	8b 50 04             	mov    0x4(%eax),%edx
+  800525:	8b 00                	mov    (%eax),%eax
+  800527:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80052a:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80052d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800530:	8d 40 08             	lea    0x8(%eax),%eax
+  800533:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800536:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800539:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80053c:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800541:	85 c9                	test   %ecx,%ecx
+  800543:	0f 89 ce 00 00 00    	jns    800617 <vprintfmt+0x387>
+				putch('-', putdat);
+  800549:	83 ec 08             	sub    $0x8,%esp
+  80054c:	53                   	push   %ebx
+  80054d:	6a 2d                	push   $0x2d
+  80054f:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800551:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800554:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800557:	f7 da                	neg    %edx
+  800559:	83 d1 00             	adc    $0x0,%ecx
+  80055c:	f7 d9                	neg    %ecx
+  80055e:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800561:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800566:	e9 ac 00 00 00       	jmp    800617 <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  80056b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80056e:	8b 00                	mov    (%eax),%eax
+  800570:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800573:	89 c1                	mov    %eax,%ecx
+  800575:	c1 f9 1f             	sar    $0x1f,%ecx
+  800578:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80057b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80057e:	8d 40 04             	lea    0x4(%eax),%eax
+  800581:	89 45 14             	mov    %eax,0x14(%ebp)
+  800584:	eb b0                	jmp    800536 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800586:	83 f9 01             	cmp    $0x1,%ecx
+  800589:	7f 1b                	jg     8005a6 <vprintfmt+0x316>
+	else if (lflag)
+  80058b:	85 c9                	test   %ecx,%ecx
+  80058d:	74 2c                	je     8005bb <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  80058f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800592:	8b 10                	mov    (%eax),%edx
+  800594:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800599:	8d 40 04             	lea    0x4(%eax),%eax
+  80059c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80059f:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8005a4:	eb 71                	jmp    800617 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  8005a6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a9:	8b 10                	mov    (%eax),%edx
+  8005ab:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005ae:	8d 40 08             	lea    0x8(%eax),%eax
+  8005b1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005b4:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8005b9:	eb 5c                	jmp    800617 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  8005bb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005be:	8b 10                	mov    (%eax),%edx
+  8005c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005c5:	8d 40 04             	lea    0x4(%eax),%eax
+  8005c8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005cb:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8005d0:	eb 45                	jmp    800617 <vprintfmt+0x387>
+			putch('X', putdat);
+  8005d2:	83 ec 08             	sub    $0x8,%esp
+  8005d5:	53                   	push   %ebx
+  8005d6:	6a 58                	push   $0x58
+  8005d8:	ff d6                	call   *%esi
+			putch('X', putdat);
+  8005da:	83 c4 08             	add    $0x8,%esp
+  8005dd:	53                   	push   %ebx
+  8005de:	6a 58                	push   $0x58
+  8005e0:	ff d6                	call   *%esi
+			putch('X', putdat);
+  8005e2:	83 c4 08             	add    $0x8,%esp
+  8005e5:	53                   	push   %ebx
+  8005e6:	6a 58                	push   $0x58
+  8005e8:	ff d6                	call   *%esi
+			break;
+  8005ea:	83 c4 10             	add    $0x10,%esp
+  8005ed:	eb 42                	jmp    800631 <vprintfmt+0x3a1>
+			putch('0', putdat);
+  8005ef:	83 ec 08             	sub    $0x8,%esp
+  8005f2:	53                   	push   %ebx
+  8005f3:	6a 30                	push   $0x30
+  8005f5:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8005f7:	83 c4 08             	add    $0x8,%esp
+  8005fa:	53                   	push   %ebx
+  8005fb:	6a 78                	push   $0x78
+  8005fd:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8005ff:	8b 45 14             	mov    0x14(%ebp),%eax
+  800602:	8b 10                	mov    (%eax),%edx
+  800604:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800609:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80060c:	8d 40 04             	lea    0x4(%eax),%eax
+  80060f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800612:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800617:	83 ec 0c             	sub    $0xc,%esp
+  80061a:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80061e:	50                   	push   %eax
+  80061f:	ff 75 e0             	push   -0x20(%ebp)
+  800622:	57                   	push   %edi
+  800623:	51                   	push   %ecx
+  800624:	52                   	push   %edx
+  800625:	89 da                	mov    %ebx,%edx
+  800627:	89 f0                	mov    %esi,%eax
+  800629:	e8 7f fb ff ff       	call   8001ad <printnum>
+			break;
+  80062e:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800631:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800634:	e9 75 fc ff ff       	jmp    8002ae <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800639:	83 f9 01             	cmp    $0x1,%ecx
+  80063c:	7f 1b                	jg     800659 <vprintfmt+0x3c9>
+	else if (lflag)
+  80063e:	85 c9                	test   %ecx,%ecx
+  800640:	74 2c                	je     80066e <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  800642:	8b 45 14             	mov    0x14(%ebp),%eax
+  800645:	8b 10                	mov    (%eax),%edx
+  800647:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80064c:	8d 40 04             	lea    0x4(%eax),%eax
+  80064f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800652:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800657:	eb be                	jmp    800617 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  800659:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065c:	8b 10                	mov    (%eax),%edx
+  80065e:	8b 48 04             	mov    0x4(%eax),%ecx
+  800661:	8d 40 08             	lea    0x8(%eax),%eax
+  800664:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800667:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80066c:	eb a9                	jmp    800617 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  80066e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800671:	8b 10                	mov    (%eax),%edx
+  800673:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800678:	8d 40 04             	lea    0x4(%eax),%eax
+  80067b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80067e:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800683:	eb 92                	jmp    800617 <vprintfmt+0x387>
+			putch(ch, putdat);
+  800685:	83 ec 08             	sub    $0x8,%esp
+  800688:	53                   	push   %ebx
+  800689:	6a 25                	push   $0x25
+  80068b:	ff d6                	call   *%esi
+			break;
+  80068d:	83 c4 10             	add    $0x10,%esp
+  800690:	eb 9f                	jmp    800631 <vprintfmt+0x3a1>
+			putch('%', putdat);
+  800692:	83 ec 08             	sub    $0x8,%esp
+  800695:	53                   	push   %ebx
+  800696:	6a 25                	push   $0x25
+  800698:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80069a:	83 c4 10             	add    $0x10,%esp
+  80069d:	89 f8                	mov    %edi,%eax
+  80069f:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8006a3:	74 05                	je     8006aa <vprintfmt+0x41a>
+  8006a5:	83 e8 01             	sub    $0x1,%eax
+  8006a8:	eb f5                	jmp    80069f <vprintfmt+0x40f>
+  8006aa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8006ad:	eb 82                	jmp    800631 <vprintfmt+0x3a1>
+
+008006af <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8006af:	55                   	push   %ebp
+  8006b0:	89 e5                	mov    %esp,%ebp
+  8006b2:	83 ec 18             	sub    $0x18,%esp
+  8006b5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006b8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8006bb:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8006be:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8006c2:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8006c5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8006cc:	85 c0                	test   %eax,%eax
+  8006ce:	74 26                	je     8006f6 <vsnprintf+0x47>
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	7e 22                	jle    8006f6 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8006d4:	ff 75 14             	push   0x14(%ebp)
+  8006d7:	ff 75 10             	push   0x10(%ebp)
+  8006da:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8006dd:	50                   	push   %eax
+  8006de:	68 56 02 80 00       	push   $0x800256
+  8006e3:	e8 a8 fb ff ff       	call   800290 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8006e8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8006eb:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8006ee:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8006f1:	83 c4 10             	add    $0x10,%esp
+}
+  8006f4:	c9                   	leave
+  8006f5:	c3                   	ret
+		return -E_INVAL;
+  8006f6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006fb:	eb f7                	jmp    8006f4 <vsnprintf+0x45>
+
+008006fd <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8006fd:	55                   	push   %ebp
+  8006fe:	89 e5                	mov    %esp,%ebp
+  800700:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800703:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800706:	50                   	push   %eax
+  800707:	ff 75 10             	push   0x10(%ebp)
+  80070a:	ff 75 0c             	push   0xc(%ebp)
+  80070d:	ff 75 08             	push   0x8(%ebp)
+  800710:	e8 9a ff ff ff       	call   8006af <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800715:	c9                   	leave
+  800716:	c3                   	ret
+
+00800717 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800717:	55                   	push   %ebp
+  800718:	89 e5                	mov    %esp,%ebp
+  80071a:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80071d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800722:	eb 03                	jmp    800727 <strlen+0x10>
+		n++;
+  800724:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800727:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80072b:	75 f7                	jne    800724 <strlen+0xd>
+	return n;
+}
+  80072d:	5d                   	pop    %ebp
+  80072e:	c3                   	ret
+
+0080072f <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80072f:	55                   	push   %ebp
+  800730:	89 e5                	mov    %esp,%ebp
+  800732:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800735:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800738:	b8 00 00 00 00       	mov    $0x0,%eax
+  80073d:	eb 03                	jmp    800742 <strnlen+0x13>
+		n++;
+  80073f:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800742:	39 d0                	cmp    %edx,%eax
+  800744:	74 08                	je     80074e <strnlen+0x1f>
+  800746:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80074a:	75 f3                	jne    80073f <strnlen+0x10>
+  80074c:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80074e:	89 d0                	mov    %edx,%eax
+  800750:	5d                   	pop    %ebp
+  800751:	c3                   	ret
+
+00800752 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800752:	55                   	push   %ebp
+  800753:	89 e5                	mov    %esp,%ebp
+  800755:	53                   	push   %ebx
+  800756:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800759:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80075c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800761:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800765:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800768:	83 c0 01             	add    $0x1,%eax
+  80076b:	84 d2                	test   %dl,%dl
+  80076d:	75 f2                	jne    800761 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80076f:	89 c8                	mov    %ecx,%eax
+  800771:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800774:	c9                   	leave
+  800775:	c3                   	ret
+
+00800776 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800776:	55                   	push   %ebp
+  800777:	89 e5                	mov    %esp,%ebp
+  800779:	53                   	push   %ebx
+  80077a:	83 ec 10             	sub    $0x10,%esp
+  80077d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800780:	53                   	push   %ebx
+  800781:	e8 91 ff ff ff       	call   800717 <strlen>
+  800786:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800789:	ff 75 0c             	push   0xc(%ebp)
+  80078c:	01 d8                	add    %ebx,%eax
+  80078e:	50                   	push   %eax
+  80078f:	e8 be ff ff ff       	call   800752 <strcpy>
+	return dst;
+}
+  800794:	89 d8                	mov    %ebx,%eax
+  800796:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800799:	c9                   	leave
+  80079a:	c3                   	ret
+
+0080079b <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80079b:	55                   	push   %ebp
+  80079c:	89 e5                	mov    %esp,%ebp
+  80079e:	56                   	push   %esi
+  80079f:	53                   	push   %ebx
+  8007a0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007a3:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8007a6:	89 f3                	mov    %esi,%ebx
+  8007a8:	03 5d 10             	add    0x10(%ebp),%ebx
+  8007ab:	89 f0                	mov    %esi,%eax
+  8007ad:	eb 0f                	jmp    8007be <strncpy+0x23>
+		*dst++ = *src;
+  8007af:	83 c0 01             	add    $0x1,%eax
+  8007b2:	0f b6 0a             	movzbl (%edx),%ecx
+  8007b5:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8007b8:	80 f9 01             	cmp    $0x1,%cl
+  8007bb:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8007be:	39 d8                	cmp    %ebx,%eax
+  8007c0:	75 ed                	jne    8007af <strncpy+0x14>
+	}
+	return ret;
+}
+  8007c2:	89 f0                	mov    %esi,%eax
+  8007c4:	5b                   	pop    %ebx
+  8007c5:	5e                   	pop    %esi
+  8007c6:	5d                   	pop    %ebp
+  8007c7:	c3                   	ret
+
+008007c8 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8007c8:	55                   	push   %ebp
+  8007c9:	89 e5                	mov    %esp,%ebp
+  8007cb:	56                   	push   %esi
+  8007cc:	53                   	push   %ebx
+  8007cd:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007d0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007d3:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8007d6:	89 f0                	mov    %esi,%eax
+  8007d8:	85 d2                	test   %edx,%edx
+  8007da:	74 21                	je     8007fd <strlcpy+0x35>
+  8007dc:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8007e0:	89 f2                	mov    %esi,%edx
+  8007e2:	eb 09                	jmp    8007ed <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8007e4:	83 c1 01             	add    $0x1,%ecx
+  8007e7:	83 c2 01             	add    $0x1,%edx
+  8007ea:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8007ed:	39 c2                	cmp    %eax,%edx
+  8007ef:	74 09                	je     8007fa <strlcpy+0x32>
+  8007f1:	0f b6 19             	movzbl (%ecx),%ebx
+  8007f4:	84 db                	test   %bl,%bl
+  8007f6:	75 ec                	jne    8007e4 <strlcpy+0x1c>
+  8007f8:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8007fa:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8007fd:	29 f0                	sub    %esi,%eax
+}
+  8007ff:	5b                   	pop    %ebx
+  800800:	5e                   	pop    %esi
+  800801:	5d                   	pop    %ebp
+  800802:	c3                   	ret
+
+00800803 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800803:	55                   	push   %ebp
+  800804:	89 e5                	mov    %esp,%ebp
+  800806:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800809:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80080c:	eb 06                	jmp    800814 <strcmp+0x11>
+		p++, q++;
+  80080e:	83 c1 01             	add    $0x1,%ecx
+  800811:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800814:	0f b6 01             	movzbl (%ecx),%eax
+  800817:	84 c0                	test   %al,%al
+  800819:	74 04                	je     80081f <strcmp+0x1c>
+  80081b:	3a 02                	cmp    (%edx),%al
+  80081d:	74 ef                	je     80080e <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80081f:	0f b6 c0             	movzbl %al,%eax
+  800822:	0f b6 12             	movzbl (%edx),%edx
+  800825:	29 d0                	sub    %edx,%eax
+}
+  800827:	5d                   	pop    %ebp
+  800828:	c3                   	ret
+
+00800829 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800829:	55                   	push   %ebp
+  80082a:	89 e5                	mov    %esp,%ebp
+  80082c:	53                   	push   %ebx
+  80082d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800830:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800833:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800836:	eb 09                	jmp    800841 <strncmp+0x18>
+		n--, p++, q++;
+  800838:	83 ea 01             	sub    $0x1,%edx
+  80083b:	83 c0 01             	add    $0x1,%eax
+  80083e:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800841:	85 d2                	test   %edx,%edx
+  800843:	74 18                	je     80085d <strncmp+0x34>
+  800845:	0f b6 18             	movzbl (%eax),%ebx
+  800848:	84 db                	test   %bl,%bl
+  80084a:	74 04                	je     800850 <strncmp+0x27>
+  80084c:	3a 19                	cmp    (%ecx),%bl
+  80084e:	74 e8                	je     800838 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800850:	0f b6 00             	movzbl (%eax),%eax
+  800853:	0f b6 11             	movzbl (%ecx),%edx
+  800856:	29 d0                	sub    %edx,%eax
+}
+  800858:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80085b:	c9                   	leave
+  80085c:	c3                   	ret
+		return 0;
+  80085d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800862:	eb f4                	jmp    800858 <strncmp+0x2f>
+
+00800864 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800864:	55                   	push   %ebp
+  800865:	89 e5                	mov    %esp,%ebp
+  800867:	8b 45 08             	mov    0x8(%ebp),%eax
+  80086a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80086e:	eb 03                	jmp    800873 <strchr+0xf>
+  800870:	83 c0 01             	add    $0x1,%eax
+  800873:	0f b6 10             	movzbl (%eax),%edx
+  800876:	84 d2                	test   %dl,%dl
+  800878:	74 06                	je     800880 <strchr+0x1c>
+		if (*s == c)
+  80087a:	38 ca                	cmp    %cl,%dl
+  80087c:	75 f2                	jne    800870 <strchr+0xc>
+  80087e:	eb 05                	jmp    800885 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800880:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800885:	5d                   	pop    %ebp
+  800886:	c3                   	ret
+
+00800887 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800887:	55                   	push   %ebp
+  800888:	89 e5                	mov    %esp,%ebp
+  80088a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80088d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800891:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800894:	38 ca                	cmp    %cl,%dl
+  800896:	74 09                	je     8008a1 <strfind+0x1a>
+  800898:	84 d2                	test   %dl,%dl
+  80089a:	74 05                	je     8008a1 <strfind+0x1a>
+	for (; *s; s++)
+  80089c:	83 c0 01             	add    $0x1,%eax
+  80089f:	eb f0                	jmp    800891 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8008a1:	5d                   	pop    %ebp
+  8008a2:	c3                   	ret
+
+008008a3 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8008a3:	55                   	push   %ebp
+  8008a4:	89 e5                	mov    %esp,%ebp
+  8008a6:	57                   	push   %edi
+  8008a7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8008aa:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8008ad:	85 c9                	test   %ecx,%ecx
+  8008af:	74 20                	je     8008d1 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8008b1:	89 f8                	mov    %edi,%eax
+  8008b3:	09 c8                	or     %ecx,%eax
+  8008b5:	a8 03                	test   $0x3,%al
+  8008b7:	75 12                	jne    8008cb <memset+0x28>
+		c &= 0xFF;
+  8008b9:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8008bd:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8008c3:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8008c6:	fc                   	cld
+  8008c7:	f3 ab                	rep stos %eax,%es:(%edi)
+  8008c9:	eb 06                	jmp    8008d1 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8008cb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8008ce:	fc                   	cld
+  8008cf:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8008d1:	89 f8                	mov    %edi,%eax
+  8008d3:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8008d6:	c9                   	leave
+  8008d7:	c3                   	ret
+
+008008d8 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8008d8:	55                   	push   %ebp
+  8008d9:	89 e5                	mov    %esp,%ebp
+  8008db:	57                   	push   %edi
+  8008dc:	56                   	push   %esi
+  8008dd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008e0:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8008e3:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8008e6:	39 c6                	cmp    %eax,%esi
+  8008e8:	73 32                	jae    80091c <memmove+0x44>
+  8008ea:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8008ed:	39 d0                	cmp    %edx,%eax
+  8008ef:	73 2b                	jae    80091c <memmove+0x44>
+		s += n;
+		d += n;
+  8008f1:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8008f4:	89 d6                	mov    %edx,%esi
+  8008f6:	09 fe                	or     %edi,%esi
+  8008f8:	09 ce                	or     %ecx,%esi
+  8008fa:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800900:	75 0e                	jne    800910 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800902:	83 ef 04             	sub    $0x4,%edi
+  800905:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800908:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  80090b:	fd                   	std
+  80090c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80090e:	eb 09                	jmp    800919 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800910:	83 ef 01             	sub    $0x1,%edi
+  800913:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800916:	fd                   	std
+  800917:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800919:	fc                   	cld
+  80091a:	eb 1a                	jmp    800936 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80091c:	89 f2                	mov    %esi,%edx
+  80091e:	09 c2                	or     %eax,%edx
+  800920:	09 ca                	or     %ecx,%edx
+  800922:	f6 c2 03             	test   $0x3,%dl
+  800925:	75 0a                	jne    800931 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800927:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  80092a:	89 c7                	mov    %eax,%edi
+  80092c:	fc                   	cld
+  80092d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80092f:	eb 05                	jmp    800936 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800931:	89 c7                	mov    %eax,%edi
+  800933:	fc                   	cld
+  800934:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800936:	5e                   	pop    %esi
+  800937:	5f                   	pop    %edi
+  800938:	5d                   	pop    %ebp
+  800939:	c3                   	ret
+
+0080093a <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  80093a:	55                   	push   %ebp
+  80093b:	89 e5                	mov    %esp,%ebp
+  80093d:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800940:	ff 75 10             	push   0x10(%ebp)
+  800943:	ff 75 0c             	push   0xc(%ebp)
+  800946:	ff 75 08             	push   0x8(%ebp)
+  800949:	e8 8a ff ff ff       	call   8008d8 <memmove>
+}
+  80094e:	c9                   	leave
+  80094f:	c3                   	ret
+
+00800950 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800950:	55                   	push   %ebp
+  800951:	89 e5                	mov    %esp,%ebp
+  800953:	56                   	push   %esi
+  800954:	53                   	push   %ebx
+  800955:	8b 45 08             	mov    0x8(%ebp),%eax
+  800958:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  80095b:	89 c6                	mov    %eax,%esi
+  80095d:	03 75 10             	add    0x10(%ebp),%esi
+  800960:	eb 06                	jmp    800968 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800962:	83 c0 01             	add    $0x1,%eax
+  800965:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800968:	39 f0                	cmp    %esi,%eax
+  80096a:	74 14                	je     800980 <memcmp+0x30>
+		if (*s1 != *s2)
+  80096c:	0f b6 08             	movzbl (%eax),%ecx
+  80096f:	0f b6 1a             	movzbl (%edx),%ebx
+  800972:	38 d9                	cmp    %bl,%cl
+  800974:	74 ec                	je     800962 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800976:	0f b6 c1             	movzbl %cl,%eax
+  800979:	0f b6 db             	movzbl %bl,%ebx
+  80097c:	29 d8                	sub    %ebx,%eax
+  80097e:	eb 05                	jmp    800985 <memcmp+0x35>
+	}
+
+	return 0;
+  800980:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800985:	5b                   	pop    %ebx
+  800986:	5e                   	pop    %esi
+  800987:	5d                   	pop    %ebp
+  800988:	c3                   	ret
+
+00800989 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800989:	55                   	push   %ebp
+  80098a:	89 e5                	mov    %esp,%ebp
+  80098c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80098f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800992:	89 c2                	mov    %eax,%edx
+  800994:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800997:	eb 03                	jmp    80099c <memfind+0x13>
+  800999:	83 c0 01             	add    $0x1,%eax
+  80099c:	39 d0                	cmp    %edx,%eax
+  80099e:	73 04                	jae    8009a4 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8009a0:	38 08                	cmp    %cl,(%eax)
+  8009a2:	75 f5                	jne    800999 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8009a4:	5d                   	pop    %ebp
+  8009a5:	c3                   	ret
+
+008009a6 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8009a6:	55                   	push   %ebp
+  8009a7:	89 e5                	mov    %esp,%ebp
+  8009a9:	57                   	push   %edi
+  8009aa:	56                   	push   %esi
+  8009ab:	53                   	push   %ebx
+  8009ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009af:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8009b2:	eb 03                	jmp    8009b7 <strtol+0x11>
+		s++;
+  8009b4:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  8009b7:	0f b6 02             	movzbl (%edx),%eax
+  8009ba:	3c 20                	cmp    $0x20,%al
+  8009bc:	74 f6                	je     8009b4 <strtol+0xe>
+  8009be:	3c 09                	cmp    $0x9,%al
+  8009c0:	74 f2                	je     8009b4 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8009c2:	3c 2b                	cmp    $0x2b,%al
+  8009c4:	74 2a                	je     8009f0 <strtol+0x4a>
+	int neg = 0;
+  8009c6:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8009cb:	3c 2d                	cmp    $0x2d,%al
+  8009cd:	74 2b                	je     8009fa <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009cf:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8009d5:	75 0f                	jne    8009e6 <strtol+0x40>
+  8009d7:	80 3a 30             	cmpb   $0x30,(%edx)
+  8009da:	74 28                	je     800a04 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8009dc:	85 db                	test   %ebx,%ebx
+  8009de:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8009e3:	0f 44 d8             	cmove  %eax,%ebx
+  8009e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009eb:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8009ee:	eb 46                	jmp    800a36 <strtol+0x90>
+		s++;
+  8009f0:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  8009f3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009f8:	eb d5                	jmp    8009cf <strtol+0x29>
+		s++, neg = 1;
+  8009fa:	83 c2 01             	add    $0x1,%edx
+  8009fd:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a02:	eb cb                	jmp    8009cf <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a04:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a08:	74 0e                	je     800a18 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a0a:	85 db                	test   %ebx,%ebx
+  800a0c:	75 d8                	jne    8009e6 <strtol+0x40>
+		s++, base = 8;
+  800a0e:	83 c2 01             	add    $0x1,%edx
+  800a11:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a16:	eb ce                	jmp    8009e6 <strtol+0x40>
+		s += 2, base = 16;
+  800a18:	83 c2 02             	add    $0x2,%edx
+  800a1b:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a20:	eb c4                	jmp    8009e6 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a22:	0f be c0             	movsbl %al,%eax
+  800a25:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a28:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a2b:	7d 3a                	jge    800a67 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a2d:	83 c2 01             	add    $0x1,%edx
+  800a30:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a34:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a36:	0f b6 02             	movzbl (%edx),%eax
+  800a39:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a3c:	89 f3                	mov    %esi,%ebx
+  800a3e:	80 fb 09             	cmp    $0x9,%bl
+  800a41:	76 df                	jbe    800a22 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a43:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a46:	89 f3                	mov    %esi,%ebx
+  800a48:	80 fb 19             	cmp    $0x19,%bl
+  800a4b:	77 08                	ja     800a55 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800a4d:	0f be c0             	movsbl %al,%eax
+  800a50:	83 e8 57             	sub    $0x57,%eax
+  800a53:	eb d3                	jmp    800a28 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800a55:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800a58:	89 f3                	mov    %esi,%ebx
+  800a5a:	80 fb 19             	cmp    $0x19,%bl
+  800a5d:	77 08                	ja     800a67 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800a5f:	0f be c0             	movsbl %al,%eax
+  800a62:	83 e8 37             	sub    $0x37,%eax
+  800a65:	eb c1                	jmp    800a28 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800a67:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800a6b:	74 05                	je     800a72 <strtol+0xcc>
+		*endptr = (char *) s;
+  800a6d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a70:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800a72:	89 c8                	mov    %ecx,%eax
+  800a74:	f7 d8                	neg    %eax
+  800a76:	85 ff                	test   %edi,%edi
+  800a78:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800a7b:	89 c8                	mov    %ecx,%eax
+  800a7d:	5b                   	pop    %ebx
+  800a7e:	5e                   	pop    %esi
+  800a7f:	5f                   	pop    %edi
+  800a80:	5d                   	pop    %ebp
+  800a81:	c3                   	ret
+
+00800a82 <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800a82:	55                   	push   %ebp
+  800a83:	89 e5                	mov    %esp,%ebp
+  800a85:	57                   	push   %edi
+  800a86:	56                   	push   %esi
+  800a87:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800a88:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a8d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a90:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a93:	89 c3                	mov    %eax,%ebx
+  800a95:	89 c7                	mov    %eax,%edi
+  800a97:	89 c6                	mov    %eax,%esi
+  800a99:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  800a9b:	5b                   	pop    %ebx
+  800a9c:	5e                   	pop    %esi
+  800a9d:	5f                   	pop    %edi
+  800a9e:	5d                   	pop    %ebp
+  800a9f:	c3                   	ret
+
+00800aa0 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800aa0:	55                   	push   %ebp
+  800aa1:	89 e5                	mov    %esp,%ebp
+  800aa3:	57                   	push   %edi
+  800aa4:	56                   	push   %esi
+  800aa5:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800aa6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800aab:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ab0:	89 d1                	mov    %edx,%ecx
+  800ab2:	89 d3                	mov    %edx,%ebx
+  800ab4:	89 d7                	mov    %edx,%edi
+  800ab6:	89 d6                	mov    %edx,%esi
+  800ab8:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800aba:	5b                   	pop    %ebx
+  800abb:	5e                   	pop    %esi
+  800abc:	5f                   	pop    %edi
+  800abd:	5d                   	pop    %ebp
+  800abe:	c3                   	ret
+
+00800abf <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800abf:	55                   	push   %ebp
+  800ac0:	89 e5                	mov    %esp,%ebp
+  800ac2:	57                   	push   %edi
+  800ac3:	56                   	push   %esi
+  800ac4:	53                   	push   %ebx
+  800ac5:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800ac8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800acd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ad0:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ad5:	89 cb                	mov    %ecx,%ebx
+  800ad7:	89 cf                	mov    %ecx,%edi
+  800ad9:	89 ce                	mov    %ecx,%esi
+  800adb:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800add:	85 c0                	test   %eax,%eax
+  800adf:	7f 08                	jg     800ae9 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800ae1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ae4:	5b                   	pop    %ebx
+  800ae5:	5e                   	pop    %esi
+  800ae6:	5f                   	pop    %edi
+  800ae7:	5d                   	pop    %ebp
+  800ae8:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ae9:	83 ec 0c             	sub    $0xc,%esp
+  800aec:	50                   	push   %eax
+  800aed:	6a 03                	push   $0x3
+  800aef:	68 a3 28 80 00       	push   $0x8028a3
+  800af4:	6a 3e                	push   $0x3e
+  800af6:	68 c0 28 80 00       	push   $0x8028c0
+  800afb:	e8 29 15 00 00       	call   802029 <_panic>
+
+00800b00 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800b00:	55                   	push   %ebp
+  800b01:	89 e5                	mov    %esp,%ebp
+  800b03:	57                   	push   %edi
+  800b04:	56                   	push   %esi
+  800b05:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800b06:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b0b:	b8 02 00 00 00       	mov    $0x2,%eax
+  800b10:	89 d1                	mov    %edx,%ecx
+  800b12:	89 d3                	mov    %edx,%ebx
+  800b14:	89 d7                	mov    %edx,%edi
+  800b16:	89 d6                	mov    %edx,%esi
+  800b18:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800b1a:	5b                   	pop    %ebx
+  800b1b:	5e                   	pop    %esi
+  800b1c:	5f                   	pop    %edi
+  800b1d:	5d                   	pop    %ebp
+  800b1e:	c3                   	ret
+
+00800b1f <sys_yield>:
+
+void
+sys_yield(void) {
+  800b1f:	55                   	push   %ebp
+  800b20:	89 e5                	mov    %esp,%ebp
+  800b22:	57                   	push   %edi
+  800b23:	56                   	push   %esi
+  800b24:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800b25:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b2a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800b2f:	89 d1                	mov    %edx,%ecx
+  800b31:	89 d3                	mov    %edx,%ebx
+  800b33:	89 d7                	mov    %edx,%edi
+  800b35:	89 d6                	mov    %edx,%esi
+  800b37:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800b39:	5b                   	pop    %ebx
+  800b3a:	5e                   	pop    %esi
+  800b3b:	5f                   	pop    %edi
+  800b3c:	5d                   	pop    %ebp
+  800b3d:	c3                   	ret
+
+00800b3e <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  800b3e:	55                   	push   %ebp
+  800b3f:	89 e5                	mov    %esp,%ebp
+  800b41:	57                   	push   %edi
+  800b42:	56                   	push   %esi
+  800b43:	53                   	push   %ebx
+  800b44:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800b47:	be 00 00 00 00       	mov    $0x0,%esi
+  800b4c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b4f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b52:	b8 04 00 00 00       	mov    $0x4,%eax
+  800b57:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b5a:	89 f7                	mov    %esi,%edi
+  800b5c:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800b5e:	85 c0                	test   %eax,%eax
+  800b60:	7f 08                	jg     800b6a <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800b62:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b65:	5b                   	pop    %ebx
+  800b66:	5e                   	pop    %esi
+  800b67:	5f                   	pop    %edi
+  800b68:	5d                   	pop    %ebp
+  800b69:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800b6a:	83 ec 0c             	sub    $0xc,%esp
+  800b6d:	50                   	push   %eax
+  800b6e:	6a 04                	push   $0x4
+  800b70:	68 a3 28 80 00       	push   $0x8028a3
+  800b75:	6a 3e                	push   $0x3e
+  800b77:	68 c0 28 80 00       	push   $0x8028c0
+  800b7c:	e8 a8 14 00 00       	call   802029 <_panic>
+
+00800b81 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  800b81:	55                   	push   %ebp
+  800b82:	89 e5                	mov    %esp,%ebp
+  800b84:	57                   	push   %edi
+  800b85:	56                   	push   %esi
+  800b86:	53                   	push   %ebx
+  800b87:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800b8a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b8d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b90:	b8 05 00 00 00       	mov    $0x5,%eax
+  800b95:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b98:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800b9b:	8b 75 18             	mov    0x18(%ebp),%esi
+  800b9e:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ba0:	85 c0                	test   %eax,%eax
+  800ba2:	7f 08                	jg     800bac <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800ba4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ba7:	5b                   	pop    %ebx
+  800ba8:	5e                   	pop    %esi
+  800ba9:	5f                   	pop    %edi
+  800baa:	5d                   	pop    %ebp
+  800bab:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800bac:	83 ec 0c             	sub    $0xc,%esp
+  800baf:	50                   	push   %eax
+  800bb0:	6a 05                	push   $0x5
+  800bb2:	68 a3 28 80 00       	push   $0x8028a3
+  800bb7:	6a 3e                	push   $0x3e
+  800bb9:	68 c0 28 80 00       	push   $0x8028c0
+  800bbe:	e8 66 14 00 00       	call   802029 <_panic>
+
+00800bc3 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  800bc3:	55                   	push   %ebp
+  800bc4:	89 e5                	mov    %esp,%ebp
+  800bc6:	57                   	push   %edi
+  800bc7:	56                   	push   %esi
+  800bc8:	53                   	push   %ebx
+  800bc9:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800bcc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800bd1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bd4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bd7:	b8 06 00 00 00       	mov    $0x6,%eax
+  800bdc:	89 df                	mov    %ebx,%edi
+  800bde:	89 de                	mov    %ebx,%esi
+  800be0:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800be2:	85 c0                	test   %eax,%eax
+  800be4:	7f 08                	jg     800bee <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800be6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800be9:	5b                   	pop    %ebx
+  800bea:	5e                   	pop    %esi
+  800beb:	5f                   	pop    %edi
+  800bec:	5d                   	pop    %ebp
+  800bed:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800bee:	83 ec 0c             	sub    $0xc,%esp
+  800bf1:	50                   	push   %eax
+  800bf2:	6a 06                	push   $0x6
+  800bf4:	68 a3 28 80 00       	push   $0x8028a3
+  800bf9:	6a 3e                	push   $0x3e
+  800bfb:	68 c0 28 80 00       	push   $0x8028c0
+  800c00:	e8 24 14 00 00       	call   802029 <_panic>
+
+00800c05 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800c05:	55                   	push   %ebp
+  800c06:	89 e5                	mov    %esp,%ebp
+  800c08:	57                   	push   %edi
+  800c09:	56                   	push   %esi
+  800c0a:	53                   	push   %ebx
+  800c0b:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c0e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c13:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c16:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c19:	b8 08 00 00 00       	mov    $0x8,%eax
+  800c1e:	89 df                	mov    %ebx,%edi
+  800c20:	89 de                	mov    %ebx,%esi
+  800c22:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c24:	85 c0                	test   %eax,%eax
+  800c26:	7f 08                	jg     800c30 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800c28:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c2b:	5b                   	pop    %ebx
+  800c2c:	5e                   	pop    %esi
+  800c2d:	5f                   	pop    %edi
+  800c2e:	5d                   	pop    %ebp
+  800c2f:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c30:	83 ec 0c             	sub    $0xc,%esp
+  800c33:	50                   	push   %eax
+  800c34:	6a 08                	push   $0x8
+  800c36:	68 a3 28 80 00       	push   $0x8028a3
+  800c3b:	6a 3e                	push   $0x3e
+  800c3d:	68 c0 28 80 00       	push   $0x8028c0
+  800c42:	e8 e2 13 00 00       	call   802029 <_panic>
+
+00800c47 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800c47:	55                   	push   %ebp
+  800c48:	89 e5                	mov    %esp,%ebp
+  800c4a:	57                   	push   %edi
+  800c4b:	56                   	push   %esi
+  800c4c:	53                   	push   %ebx
+  800c4d:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c50:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c55:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c58:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c5b:	b8 09 00 00 00       	mov    $0x9,%eax
+  800c60:	89 df                	mov    %ebx,%edi
+  800c62:	89 de                	mov    %ebx,%esi
+  800c64:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c66:	85 c0                	test   %eax,%eax
+  800c68:	7f 08                	jg     800c72 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800c6a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c6d:	5b                   	pop    %ebx
+  800c6e:	5e                   	pop    %esi
+  800c6f:	5f                   	pop    %edi
+  800c70:	5d                   	pop    %ebp
+  800c71:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c72:	83 ec 0c             	sub    $0xc,%esp
+  800c75:	50                   	push   %eax
+  800c76:	6a 09                	push   $0x9
+  800c78:	68 a3 28 80 00       	push   $0x8028a3
+  800c7d:	6a 3e                	push   $0x3e
+  800c7f:	68 c0 28 80 00       	push   $0x8028c0
+  800c84:	e8 a0 13 00 00       	call   802029 <_panic>
+
+00800c89 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800c89:	55                   	push   %ebp
+  800c8a:	89 e5                	mov    %esp,%ebp
+  800c8c:	57                   	push   %edi
+  800c8d:	56                   	push   %esi
+  800c8e:	53                   	push   %ebx
+  800c8f:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c92:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c97:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c9a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c9d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ca2:	89 df                	mov    %ebx,%edi
+  800ca4:	89 de                	mov    %ebx,%esi
+  800ca6:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ca8:	85 c0                	test   %eax,%eax
+  800caa:	7f 08                	jg     800cb4 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800cac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800caf:	5b                   	pop    %ebx
+  800cb0:	5e                   	pop    %esi
+  800cb1:	5f                   	pop    %edi
+  800cb2:	5d                   	pop    %ebp
+  800cb3:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800cb4:	83 ec 0c             	sub    $0xc,%esp
+  800cb7:	50                   	push   %eax
+  800cb8:	6a 0a                	push   $0xa
+  800cba:	68 a3 28 80 00       	push   $0x8028a3
+  800cbf:	6a 3e                	push   $0x3e
+  800cc1:	68 c0 28 80 00       	push   $0x8028c0
+  800cc6:	e8 5e 13 00 00       	call   802029 <_panic>
+
+00800ccb <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  800ccb:	55                   	push   %ebp
+  800ccc:	89 e5                	mov    %esp,%ebp
+  800cce:	57                   	push   %edi
+  800ccf:	56                   	push   %esi
+  800cd0:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800cd1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cd4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cd7:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800cdc:	be 00 00 00 00       	mov    $0x0,%esi
+  800ce1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ce4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ce7:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800ce9:	5b                   	pop    %ebx
+  800cea:	5e                   	pop    %esi
+  800ceb:	5f                   	pop    %edi
+  800cec:	5d                   	pop    %ebp
+  800ced:	c3                   	ret
+
+00800cee <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  800cee:	55                   	push   %ebp
+  800cef:	89 e5                	mov    %esp,%ebp
+  800cf1:	57                   	push   %edi
+  800cf2:	56                   	push   %esi
+  800cf3:	53                   	push   %ebx
+  800cf4:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800cf7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cfc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cff:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800d04:	89 cb                	mov    %ecx,%ebx
+  800d06:	89 cf                	mov    %ecx,%edi
+  800d08:	89 ce                	mov    %ecx,%esi
+  800d0a:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d0c:	85 c0                	test   %eax,%eax
+  800d0e:	7f 08                	jg     800d18 <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  800d10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d13:	5b                   	pop    %ebx
+  800d14:	5e                   	pop    %esi
+  800d15:	5f                   	pop    %edi
+  800d16:	5d                   	pop    %ebp
+  800d17:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d18:	83 ec 0c             	sub    $0xc,%esp
+  800d1b:	50                   	push   %eax
+  800d1c:	6a 0d                	push   $0xd
+  800d1e:	68 a3 28 80 00       	push   $0x8028a3
+  800d23:	6a 3e                	push   $0x3e
+  800d25:	68 c0 28 80 00       	push   $0x8028c0
+  800d2a:	e8 fa 12 00 00       	call   802029 <_panic>
+
+00800d2f <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  800d2f:	55                   	push   %ebp
+  800d30:	89 e5                	mov    %esp,%ebp
+  800d32:	57                   	push   %edi
+  800d33:	56                   	push   %esi
+  800d34:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d35:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d3a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d3d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d40:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800d45:	89 df                	mov    %ebx,%edi
+  800d47:	89 de                	mov    %ebx,%esi
+  800d49:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  800d4b:	5b                   	pop    %ebx
+  800d4c:	5e                   	pop    %esi
+  800d4d:	5f                   	pop    %edi
+  800d4e:	5d                   	pop    %ebp
+  800d4f:	c3                   	ret
+
+00800d50 <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  800d50:	55                   	push   %ebp
+  800d51:	89 e5                	mov    %esp,%ebp
+  800d53:	57                   	push   %edi
+  800d54:	56                   	push   %esi
+  800d55:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d56:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d5b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d5e:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800d63:	89 cb                	mov    %ecx,%ebx
+  800d65:	89 cf                	mov    %ecx,%edi
+  800d67:	89 ce                	mov    %ecx,%esi
+  800d69:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  800d6b:	5b                   	pop    %ebx
+  800d6c:	5e                   	pop    %esi
+  800d6d:	5f                   	pop    %edi
+  800d6e:	5d                   	pop    %ebp
+  800d6f:	c3                   	ret
+
+00800d70 <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  800d70:	55                   	push   %ebp
+  800d71:	89 e5                	mov    %esp,%ebp
+  800d73:	57                   	push   %edi
+  800d74:	56                   	push   %esi
+  800d75:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d76:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d7b:	b8 10 00 00 00       	mov    $0x10,%eax
+  800d80:	89 d1                	mov    %edx,%ecx
+  800d82:	89 d3                	mov    %edx,%ebx
+  800d84:	89 d7                	mov    %edx,%edi
+  800d86:	89 d6                	mov    %edx,%esi
+  800d88:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800d8a:	5b                   	pop    %ebx
+  800d8b:	5e                   	pop    %esi
+  800d8c:	5f                   	pop    %edi
+  800d8d:	5d                   	pop    %ebp
+  800d8e:	c3                   	ret
+
+00800d8f <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  800d8f:	55                   	push   %ebp
+  800d90:	89 e5                	mov    %esp,%ebp
+  800d92:	57                   	push   %edi
+  800d93:	56                   	push   %esi
+  800d94:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d95:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d9a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d9d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800da0:	b8 11 00 00 00       	mov    $0x11,%eax
+  800da5:	89 df                	mov    %ebx,%edi
+  800da7:	89 de                	mov    %ebx,%esi
+  800da9:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800dab:	5b                   	pop    %ebx
+  800dac:	5e                   	pop    %esi
+  800dad:	5f                   	pop    %edi
+  800dae:	5d                   	pop    %ebp
+  800daf:	c3                   	ret
+
+00800db0 <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  800db0:	55                   	push   %ebp
+  800db1:	89 e5                	mov    %esp,%ebp
+  800db3:	57                   	push   %edi
+  800db4:	56                   	push   %esi
+  800db5:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800db6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dbb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dbe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dc1:	b8 12 00 00 00       	mov    $0x12,%eax
+  800dc6:	89 df                	mov    %ebx,%edi
+  800dc8:	89 de                	mov    %ebx,%esi
+  800dca:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800dcc:	5b                   	pop    %ebx
+  800dcd:	5e                   	pop    %esi
+  800dce:	5f                   	pop    %edi
+  800dcf:	5d                   	pop    %ebp
+  800dd0:	c3                   	ret
+
+00800dd1 <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  800dd1:	55                   	push   %ebp
+  800dd2:	89 e5                	mov    %esp,%ebp
+  800dd4:	57                   	push   %edi
+  800dd5:	56                   	push   %esi
+  800dd6:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800dd7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ddc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ddf:	b8 13 00 00 00       	mov    $0x13,%eax
+  800de4:	89 cb                	mov    %ecx,%ebx
+  800de6:	89 cf                	mov    %ecx,%edi
+  800de8:	89 ce                	mov    %ecx,%esi
+  800dea:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  800dec:	5b                   	pop    %ebx
+  800ded:	5e                   	pop    %esi
+  800dee:	5f                   	pop    %edi
+  800def:	5d                   	pop    %ebp
+  800df0:	c3                   	ret
+
+00800df1 <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  800df1:	55                   	push   %ebp
+  800df2:	89 e5                	mov    %esp,%ebp
+  800df4:	57                   	push   %edi
+  800df5:	56                   	push   %esi
+  800df6:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800df7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dfc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dff:	b8 14 00 00 00       	mov    $0x14,%eax
+  800e04:	89 cb                	mov    %ecx,%ebx
+  800e06:	89 cf                	mov    %ecx,%edi
+  800e08:	89 ce                	mov    %ecx,%esi
+  800e0a:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  800e0c:	5b                   	pop    %ebx
+  800e0d:	5e                   	pop    %esi
+  800e0e:	5f                   	pop    %edi
+  800e0f:	5d                   	pop    %ebp
+  800e10:	c3                   	ret
+
+00800e11 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  800e11:	55                   	push   %ebp
+  800e12:	89 e5                	mov    %esp,%ebp
+  800e14:	56                   	push   %esi
+  800e15:	53                   	push   %ebx
+  800e16:	8b 75 08             	mov    0x8(%ebp),%esi
+  800e19:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e1c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  800e1f:	85 c0                	test   %eax,%eax
+  800e21:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  800e26:	0f 44 c2             	cmove  %edx,%eax
+  800e29:	83 ec 0c             	sub    $0xc,%esp
+  800e2c:	50                   	push   %eax
+  800e2d:	e8 bc fe ff ff       	call   800cee <sys_ipc_recv>
+
+  if (from_env_store)
+  800e32:	83 c4 10             	add    $0x10,%esp
+  800e35:	85 f6                	test   %esi,%esi
+  800e37:	74 17                	je     800e50 <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  800e39:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e3e:	85 c0                	test   %eax,%eax
+  800e40:	75 0c                	jne    800e4e <ipc_recv+0x3d>
+  800e42:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  800e48:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  800e4e:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  800e50:	85 db                	test   %ebx,%ebx
+  800e52:	74 2b                	je     800e7f <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  800e54:	85 c0                	test   %eax,%eax
+  800e56:	74 0d                	je     800e65 <ipc_recv+0x54>
+  800e58:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  800e5e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e61:	5b                   	pop    %ebx
+  800e62:	5e                   	pop    %esi
+  800e63:	5d                   	pop    %ebp
+  800e64:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  800e65:	a1 08 40 80 00       	mov    0x804008,%eax
+  800e6a:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  800e70:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  800e72:	a1 08 40 80 00       	mov    0x804008,%eax
+  800e77:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  800e7d:	eb df                	jmp    800e5e <ipc_recv+0x4d>
+  800e7f:	85 c0                	test   %eax,%eax
+  800e81:	75 db                	jne    800e5e <ipc_recv+0x4d>
+  800e83:	eb ed                	jmp    800e72 <ipc_recv+0x61>
+
+00800e85 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  800e85:	55                   	push   %ebp
+  800e86:	89 e5                	mov    %esp,%ebp
+  800e88:	57                   	push   %edi
+  800e89:	56                   	push   %esi
+  800e8a:	53                   	push   %ebx
+  800e8b:	83 ec 0c             	sub    $0xc,%esp
+  800e8e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800e91:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800e94:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  800e97:	85 db                	test   %ebx,%ebx
+  800e99:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  800e9e:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  800ea1:	ff 75 14             	push   0x14(%ebp)
+  800ea4:	53                   	push   %ebx
+  800ea5:	56                   	push   %esi
+  800ea6:	57                   	push   %edi
+  800ea7:	e8 1f fe ff ff       	call   800ccb <sys_ipc_try_send>
+  800eac:	83 c4 10             	add    $0x10,%esp
+  800eaf:	85 c0                	test   %eax,%eax
+  800eb1:	74 1e                	je     800ed1 <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  800eb3:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  800eb6:	75 07                	jne    800ebf <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  800eb8:	e8 62 fc ff ff       	call   800b1f <sys_yield>
+  800ebd:	eb e2                	jmp    800ea1 <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  800ebf:	50                   	push   %eax
+  800ec0:	68 ce 28 80 00       	push   $0x8028ce
+  800ec5:	6a 3c                	push   $0x3c
+  800ec7:	68 db 28 80 00       	push   $0x8028db
+  800ecc:	e8 58 11 00 00       	call   802029 <_panic>
+  }
+
+#endif
+}
+  800ed1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ed4:	5b                   	pop    %ebx
+  800ed5:	5e                   	pop    %esi
+  800ed6:	5f                   	pop    %edi
+  800ed7:	5d                   	pop    %ebp
+  800ed8:	c3                   	ret
+
+00800ed9 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  800ed9:	55                   	push   %ebp
+  800eda:	89 e5                	mov    %esp,%ebp
+  800edc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  800edf:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  800ee4:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  800ee7:	c1 e0 04             	shl    $0x4,%eax
+  800eea:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800eef:	8b 40 50             	mov    0x50(%eax),%eax
+  800ef2:	39 c8                	cmp    %ecx,%eax
+  800ef4:	74 12                	je     800f08 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  800ef6:	83 c2 01             	add    $0x1,%edx
+  800ef9:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  800eff:	75 e3                	jne    800ee4 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  800f01:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f06:	eb 0e                	jmp    800f16 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  800f08:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  800f0b:	c1 e0 04             	shl    $0x4,%eax
+  800f0e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800f13:	8b 40 48             	mov    0x48(%eax),%eax
+  800f16:	5d                   	pop    %ebp
+  800f17:	c3                   	ret
+
+00800f18 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800f18:	55                   	push   %ebp
+  800f19:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800f1b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f1e:	05 00 00 00 30       	add    $0x30000000,%eax
+  800f23:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800f26:	5d                   	pop    %ebp
+  800f27:	c3                   	ret
+
+00800f28 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800f28:	55                   	push   %ebp
+  800f29:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800f2b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f2e:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800f33:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800f38:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800f3d:	5d                   	pop    %ebp
+  800f3e:	c3                   	ret
+
+00800f3f <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800f3f:	55                   	push   %ebp
+  800f40:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  800f42:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800f47:	eb 02                	jmp    800f4b <fd_alloc+0xc>
+  800f49:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800f4b:	89 c2                	mov    %eax,%edx
+  800f4d:	c1 ea 16             	shr    $0x16,%edx
+  800f50:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800f57:	f6 c2 01             	test   $0x1,%dl
+  800f5a:	74 2b                	je     800f87 <fd_alloc+0x48>
+  800f5c:	89 c2                	mov    %eax,%edx
+  800f5e:	c1 ea 0c             	shr    $0xc,%edx
+  800f61:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  800f68:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  800f6e:	f6 c1 01             	test   $0x1,%cl
+  800f71:	74 14                	je     800f87 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  800f73:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  800f79:	75 ce                	jne    800f49 <fd_alloc+0xa>
+  800f7b:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  800f80:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800f85:	eb 05                	jmp    800f8c <fd_alloc+0x4d>
+			return 0;
+  800f87:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  800f8c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f8f:	89 02                	mov    %eax,(%edx)
+}
+  800f91:	89 c8                	mov    %ecx,%eax
+  800f93:	5d                   	pop    %ebp
+  800f94:	c3                   	ret
+
+00800f95 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  800f95:	55                   	push   %ebp
+  800f96:	89 e5                	mov    %esp,%ebp
+  800f98:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  800f9b:	83 f8 1f             	cmp    $0x1f,%eax
+  800f9e:	77 30                	ja     800fd0 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  800fa0:	c1 e0 0c             	shl    $0xc,%eax
+  800fa3:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800fa8:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  800fae:	f6 c2 01             	test   $0x1,%dl
+  800fb1:	74 24                	je     800fd7 <fd_lookup+0x42>
+  800fb3:	89 c2                	mov    %eax,%edx
+  800fb5:	c1 ea 0c             	shr    $0xc,%edx
+  800fb8:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800fbf:	f6 c2 01             	test   $0x1,%dl
+  800fc2:	74 1a                	je     800fde <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  800fc4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800fc7:	89 02                	mov    %eax,(%edx)
+	return 0;
+  800fc9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fce:	5d                   	pop    %ebp
+  800fcf:	c3                   	ret
+		return -E_INVAL;
+  800fd0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800fd5:	eb f7                	jmp    800fce <fd_lookup+0x39>
+		return -E_INVAL;
+  800fd7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800fdc:	eb f0                	jmp    800fce <fd_lookup+0x39>
+  800fde:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800fe3:	eb e9                	jmp    800fce <fd_lookup+0x39>
+
+00800fe5 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  800fe5:	55                   	push   %ebp
+  800fe6:	89 e5                	mov    %esp,%ebp
+  800fe8:	53                   	push   %ebx
+  800fe9:	83 ec 04             	sub    $0x4,%esp
+  800fec:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  800fef:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ff4:	eb 03                	jmp    800ff9 <dev_lookup+0x14>
+  800ff6:	83 c0 01             	add    $0x1,%eax
+  800ff9:	8b 1c 85 64 29 80 00 	mov    0x802964(,%eax,4),%ebx
+  801000:	85 db                	test   %ebx,%ebx
+  801002:	74 0b                	je     80100f <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801004:	39 13                	cmp    %edx,(%ebx)
+  801006:	75 ee                	jne    800ff6 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801008:	b8 00 00 00 00       	mov    $0x0,%eax
+  80100d:	eb 1f                	jmp    80102e <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80100f:	a1 08 40 80 00       	mov    0x804008,%eax
+  801014:	8b 40 48             	mov    0x48(%eax),%eax
+  801017:	83 ec 04             	sub    $0x4,%esp
+  80101a:	52                   	push   %edx
+  80101b:	50                   	push   %eax
+  80101c:	68 e8 28 80 00       	push   $0x8028e8
+  801021:	e8 73 f1 ff ff       	call   800199 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801026:	83 c4 10             	add    $0x10,%esp
+  801029:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80102e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801031:	89 1a                	mov    %ebx,(%edx)
+}
+  801033:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801036:	c9                   	leave
+  801037:	c3                   	ret
+
+00801038 <fd_close>:
+{
+  801038:	55                   	push   %ebp
+  801039:	89 e5                	mov    %esp,%ebp
+  80103b:	57                   	push   %edi
+  80103c:	56                   	push   %esi
+  80103d:	53                   	push   %ebx
+  80103e:	83 ec 24             	sub    $0x24,%esp
+  801041:	8b 75 08             	mov    0x8(%ebp),%esi
+  801044:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801047:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80104a:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80104b:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801051:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801054:	50                   	push   %eax
+  801055:	e8 3b ff ff ff       	call   800f95 <fd_lookup>
+  80105a:	89 c3                	mov    %eax,%ebx
+  80105c:	83 c4 10             	add    $0x10,%esp
+  80105f:	85 c0                	test   %eax,%eax
+  801061:	78 05                	js     801068 <fd_close+0x30>
+	    || fd != fd2)
+  801063:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801066:	74 16                	je     80107e <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801068:	89 f8                	mov    %edi,%eax
+  80106a:	84 c0                	test   %al,%al
+  80106c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801071:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801074:	89 d8                	mov    %ebx,%eax
+  801076:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801079:	5b                   	pop    %ebx
+  80107a:	5e                   	pop    %esi
+  80107b:	5f                   	pop    %edi
+  80107c:	5d                   	pop    %ebp
+  80107d:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80107e:	83 ec 08             	sub    $0x8,%esp
+  801081:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801084:	50                   	push   %eax
+  801085:	ff 36                	push   (%esi)
+  801087:	e8 59 ff ff ff       	call   800fe5 <dev_lookup>
+  80108c:	89 c3                	mov    %eax,%ebx
+  80108e:	83 c4 10             	add    $0x10,%esp
+  801091:	85 c0                	test   %eax,%eax
+  801093:	78 1a                	js     8010af <fd_close+0x77>
+		if (dev->dev_close)
+  801095:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801098:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80109b:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8010a0:	85 c0                	test   %eax,%eax
+  8010a2:	74 0b                	je     8010af <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8010a4:	83 ec 0c             	sub    $0xc,%esp
+  8010a7:	56                   	push   %esi
+  8010a8:	ff d0                	call   *%eax
+  8010aa:	89 c3                	mov    %eax,%ebx
+  8010ac:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8010af:	83 ec 08             	sub    $0x8,%esp
+  8010b2:	56                   	push   %esi
+  8010b3:	6a 00                	push   $0x0
+  8010b5:	e8 09 fb ff ff       	call   800bc3 <sys_page_unmap>
+	return r;
+  8010ba:	83 c4 10             	add    $0x10,%esp
+  8010bd:	eb b5                	jmp    801074 <fd_close+0x3c>
+
+008010bf <close>:
+
+int
+close(int fdnum)
+{
+  8010bf:	55                   	push   %ebp
+  8010c0:	89 e5                	mov    %esp,%ebp
+  8010c2:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8010c5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8010c8:	50                   	push   %eax
+  8010c9:	ff 75 08             	push   0x8(%ebp)
+  8010cc:	e8 c4 fe ff ff       	call   800f95 <fd_lookup>
+  8010d1:	83 c4 10             	add    $0x10,%esp
+  8010d4:	85 c0                	test   %eax,%eax
+  8010d6:	79 02                	jns    8010da <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8010d8:	c9                   	leave
+  8010d9:	c3                   	ret
+		return fd_close(fd, 1);
+  8010da:	83 ec 08             	sub    $0x8,%esp
+  8010dd:	6a 01                	push   $0x1
+  8010df:	ff 75 f4             	push   -0xc(%ebp)
+  8010e2:	e8 51 ff ff ff       	call   801038 <fd_close>
+  8010e7:	83 c4 10             	add    $0x10,%esp
+  8010ea:	eb ec                	jmp    8010d8 <close+0x19>
+
+008010ec <close_all>:
+
+void
+close_all(void)
+{
+  8010ec:	55                   	push   %ebp
+  8010ed:	89 e5                	mov    %esp,%ebp
+  8010ef:	53                   	push   %ebx
+  8010f0:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8010f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8010f8:	83 ec 0c             	sub    $0xc,%esp
+  8010fb:	53                   	push   %ebx
+  8010fc:	e8 be ff ff ff       	call   8010bf <close>
+	for (i = 0; i < MAXFD; i++)
+  801101:	83 c3 01             	add    $0x1,%ebx
+  801104:	83 c4 10             	add    $0x10,%esp
+  801107:	83 fb 20             	cmp    $0x20,%ebx
+  80110a:	75 ec                	jne    8010f8 <close_all+0xc>
+}
+  80110c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80110f:	c9                   	leave
+  801110:	c3                   	ret
+
+00801111 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801111:	55                   	push   %ebp
+  801112:	89 e5                	mov    %esp,%ebp
+  801114:	57                   	push   %edi
+  801115:	56                   	push   %esi
+  801116:	53                   	push   %ebx
+  801117:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80111a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80111d:	50                   	push   %eax
+  80111e:	ff 75 08             	push   0x8(%ebp)
+  801121:	e8 6f fe ff ff       	call   800f95 <fd_lookup>
+  801126:	89 c3                	mov    %eax,%ebx
+  801128:	83 c4 10             	add    $0x10,%esp
+  80112b:	85 c0                	test   %eax,%eax
+  80112d:	78 7f                	js     8011ae <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80112f:	83 ec 0c             	sub    $0xc,%esp
+  801132:	ff 75 0c             	push   0xc(%ebp)
+  801135:	e8 85 ff ff ff       	call   8010bf <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80113a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80113d:	c1 e6 0c             	shl    $0xc,%esi
+  801140:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801146:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801149:	89 3c 24             	mov    %edi,(%esp)
+  80114c:	e8 d7 fd ff ff       	call   800f28 <fd2data>
+  801151:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801153:	89 34 24             	mov    %esi,(%esp)
+  801156:	e8 cd fd ff ff       	call   800f28 <fd2data>
+  80115b:	83 c4 10             	add    $0x10,%esp
+  80115e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801161:	89 d8                	mov    %ebx,%eax
+  801163:	c1 e8 16             	shr    $0x16,%eax
+  801166:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80116d:	a8 01                	test   $0x1,%al
+  80116f:	74 11                	je     801182 <dup+0x71>
+  801171:	89 d8                	mov    %ebx,%eax
+  801173:	c1 e8 0c             	shr    $0xc,%eax
+  801176:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80117d:	f6 c2 01             	test   $0x1,%dl
+  801180:	75 36                	jne    8011b8 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801182:	89 f8                	mov    %edi,%eax
+  801184:	c1 e8 0c             	shr    $0xc,%eax
+  801187:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80118e:	83 ec 0c             	sub    $0xc,%esp
+  801191:	25 07 0e 00 00       	and    $0xe07,%eax
+  801196:	50                   	push   %eax
+  801197:	56                   	push   %esi
+  801198:	6a 00                	push   $0x0
+  80119a:	57                   	push   %edi
+  80119b:	6a 00                	push   $0x0
+  80119d:	e8 df f9 ff ff       	call   800b81 <sys_page_map>
+  8011a2:	89 c3                	mov    %eax,%ebx
+  8011a4:	83 c4 20             	add    $0x20,%esp
+  8011a7:	85 c0                	test   %eax,%eax
+  8011a9:	78 33                	js     8011de <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8011ab:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8011ae:	89 d8                	mov    %ebx,%eax
+  8011b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011b3:	5b                   	pop    %ebx
+  8011b4:	5e                   	pop    %esi
+  8011b5:	5f                   	pop    %edi
+  8011b6:	5d                   	pop    %ebp
+  8011b7:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8011b8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8011bf:	83 ec 0c             	sub    $0xc,%esp
+  8011c2:	25 07 0e 00 00       	and    $0xe07,%eax
+  8011c7:	50                   	push   %eax
+  8011c8:	ff 75 d4             	push   -0x2c(%ebp)
+  8011cb:	6a 00                	push   $0x0
+  8011cd:	53                   	push   %ebx
+  8011ce:	6a 00                	push   $0x0
+  8011d0:	e8 ac f9 ff ff       	call   800b81 <sys_page_map>
+  8011d5:	89 c3                	mov    %eax,%ebx
+  8011d7:	83 c4 20             	add    $0x20,%esp
+  8011da:	85 c0                	test   %eax,%eax
+  8011dc:	79 a4                	jns    801182 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8011de:	83 ec 08             	sub    $0x8,%esp
+  8011e1:	56                   	push   %esi
+  8011e2:	6a 00                	push   $0x0
+  8011e4:	e8 da f9 ff ff       	call   800bc3 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8011e9:	83 c4 08             	add    $0x8,%esp
+  8011ec:	ff 75 d4             	push   -0x2c(%ebp)
+  8011ef:	6a 00                	push   $0x0
+  8011f1:	e8 cd f9 ff ff       	call   800bc3 <sys_page_unmap>
+	return r;
+  8011f6:	83 c4 10             	add    $0x10,%esp
+  8011f9:	eb b3                	jmp    8011ae <dup+0x9d>
+
+008011fb <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8011fb:	55                   	push   %ebp
+  8011fc:	89 e5                	mov    %esp,%ebp
+  8011fe:	56                   	push   %esi
+  8011ff:	53                   	push   %ebx
+  801200:	83 ec 18             	sub    $0x18,%esp
+  801203:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801206:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801209:	50                   	push   %eax
+  80120a:	56                   	push   %esi
+  80120b:	e8 85 fd ff ff       	call   800f95 <fd_lookup>
+  801210:	83 c4 10             	add    $0x10,%esp
+  801213:	85 c0                	test   %eax,%eax
+  801215:	78 3c                	js     801253 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801217:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80121a:	83 ec 08             	sub    $0x8,%esp
+  80121d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801220:	50                   	push   %eax
+  801221:	ff 33                	push   (%ebx)
+  801223:	e8 bd fd ff ff       	call   800fe5 <dev_lookup>
+  801228:	83 c4 10             	add    $0x10,%esp
+  80122b:	85 c0                	test   %eax,%eax
+  80122d:	78 24                	js     801253 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80122f:	8b 43 08             	mov    0x8(%ebx),%eax
+  801232:	83 e0 03             	and    $0x3,%eax
+  801235:	83 f8 01             	cmp    $0x1,%eax
+  801238:	74 20                	je     80125a <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80123a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80123d:	8b 40 08             	mov    0x8(%eax),%eax
+  801240:	85 c0                	test   %eax,%eax
+  801242:	74 37                	je     80127b <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801244:	83 ec 04             	sub    $0x4,%esp
+  801247:	ff 75 10             	push   0x10(%ebp)
+  80124a:	ff 75 0c             	push   0xc(%ebp)
+  80124d:	53                   	push   %ebx
+  80124e:	ff d0                	call   *%eax
+  801250:	83 c4 10             	add    $0x10,%esp
+}
+  801253:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801256:	5b                   	pop    %ebx
+  801257:	5e                   	pop    %esi
+  801258:	5d                   	pop    %ebp
+  801259:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80125a:	a1 08 40 80 00       	mov    0x804008,%eax
+  80125f:	8b 40 48             	mov    0x48(%eax),%eax
+  801262:	83 ec 04             	sub    $0x4,%esp
+  801265:	56                   	push   %esi
+  801266:	50                   	push   %eax
+  801267:	68 29 29 80 00       	push   $0x802929
+  80126c:	e8 28 ef ff ff       	call   800199 <cprintf>
+		return -E_INVAL;
+  801271:	83 c4 10             	add    $0x10,%esp
+  801274:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801279:	eb d8                	jmp    801253 <read+0x58>
+		return -E_NOT_SUPP;
+  80127b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801280:	eb d1                	jmp    801253 <read+0x58>
+
+00801282 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801282:	55                   	push   %ebp
+  801283:	89 e5                	mov    %esp,%ebp
+  801285:	57                   	push   %edi
+  801286:	56                   	push   %esi
+  801287:	53                   	push   %ebx
+  801288:	83 ec 0c             	sub    $0xc,%esp
+  80128b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80128e:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801291:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801296:	eb 02                	jmp    80129a <readn+0x18>
+  801298:	01 c3                	add    %eax,%ebx
+  80129a:	39 f3                	cmp    %esi,%ebx
+  80129c:	73 21                	jae    8012bf <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80129e:	83 ec 04             	sub    $0x4,%esp
+  8012a1:	89 f0                	mov    %esi,%eax
+  8012a3:	29 d8                	sub    %ebx,%eax
+  8012a5:	50                   	push   %eax
+  8012a6:	89 d8                	mov    %ebx,%eax
+  8012a8:	03 45 0c             	add    0xc(%ebp),%eax
+  8012ab:	50                   	push   %eax
+  8012ac:	57                   	push   %edi
+  8012ad:	e8 49 ff ff ff       	call   8011fb <read>
+		if (m < 0)
+  8012b2:	83 c4 10             	add    $0x10,%esp
+  8012b5:	85 c0                	test   %eax,%eax
+  8012b7:	78 04                	js     8012bd <readn+0x3b>
+			return m;
+		if (m == 0)
+  8012b9:	75 dd                	jne    801298 <readn+0x16>
+  8012bb:	eb 02                	jmp    8012bf <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8012bd:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8012bf:	89 d8                	mov    %ebx,%eax
+  8012c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012c4:	5b                   	pop    %ebx
+  8012c5:	5e                   	pop    %esi
+  8012c6:	5f                   	pop    %edi
+  8012c7:	5d                   	pop    %ebp
+  8012c8:	c3                   	ret
+
+008012c9 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8012c9:	55                   	push   %ebp
+  8012ca:	89 e5                	mov    %esp,%ebp
+  8012cc:	56                   	push   %esi
+  8012cd:	53                   	push   %ebx
+  8012ce:	83 ec 18             	sub    $0x18,%esp
+  8012d1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8012d4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8012d7:	50                   	push   %eax
+  8012d8:	53                   	push   %ebx
+  8012d9:	e8 b7 fc ff ff       	call   800f95 <fd_lookup>
+  8012de:	83 c4 10             	add    $0x10,%esp
+  8012e1:	85 c0                	test   %eax,%eax
+  8012e3:	78 37                	js     80131c <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8012e5:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8012e8:	83 ec 08             	sub    $0x8,%esp
+  8012eb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8012ee:	50                   	push   %eax
+  8012ef:	ff 36                	push   (%esi)
+  8012f1:	e8 ef fc ff ff       	call   800fe5 <dev_lookup>
+  8012f6:	83 c4 10             	add    $0x10,%esp
+  8012f9:	85 c0                	test   %eax,%eax
+  8012fb:	78 1f                	js     80131c <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8012fd:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801301:	74 20                	je     801323 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801303:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801306:	8b 40 0c             	mov    0xc(%eax),%eax
+  801309:	85 c0                	test   %eax,%eax
+  80130b:	74 37                	je     801344 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80130d:	83 ec 04             	sub    $0x4,%esp
+  801310:	ff 75 10             	push   0x10(%ebp)
+  801313:	ff 75 0c             	push   0xc(%ebp)
+  801316:	56                   	push   %esi
+  801317:	ff d0                	call   *%eax
+  801319:	83 c4 10             	add    $0x10,%esp
+}
+  80131c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80131f:	5b                   	pop    %ebx
+  801320:	5e                   	pop    %esi
+  801321:	5d                   	pop    %ebp
+  801322:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801323:	a1 08 40 80 00       	mov    0x804008,%eax
+  801328:	8b 40 48             	mov    0x48(%eax),%eax
+  80132b:	83 ec 04             	sub    $0x4,%esp
+  80132e:	53                   	push   %ebx
+  80132f:	50                   	push   %eax
+  801330:	68 45 29 80 00       	push   $0x802945
+  801335:	e8 5f ee ff ff       	call   800199 <cprintf>
+		return -E_INVAL;
+  80133a:	83 c4 10             	add    $0x10,%esp
+  80133d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801342:	eb d8                	jmp    80131c <write+0x53>
+		return -E_NOT_SUPP;
+  801344:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801349:	eb d1                	jmp    80131c <write+0x53>
+
+0080134b <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80134b:	55                   	push   %ebp
+  80134c:	89 e5                	mov    %esp,%ebp
+  80134e:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801351:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801354:	50                   	push   %eax
+  801355:	ff 75 08             	push   0x8(%ebp)
+  801358:	e8 38 fc ff ff       	call   800f95 <fd_lookup>
+  80135d:	83 c4 10             	add    $0x10,%esp
+  801360:	85 c0                	test   %eax,%eax
+  801362:	78 0e                	js     801372 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801364:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801367:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80136a:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80136d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801372:	c9                   	leave
+  801373:	c3                   	ret
+
+00801374 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801374:	55                   	push   %ebp
+  801375:	89 e5                	mov    %esp,%ebp
+  801377:	56                   	push   %esi
+  801378:	53                   	push   %ebx
+  801379:	83 ec 18             	sub    $0x18,%esp
+  80137c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80137f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801382:	50                   	push   %eax
+  801383:	53                   	push   %ebx
+  801384:	e8 0c fc ff ff       	call   800f95 <fd_lookup>
+  801389:	83 c4 10             	add    $0x10,%esp
+  80138c:	85 c0                	test   %eax,%eax
+  80138e:	78 34                	js     8013c4 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801390:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801393:	83 ec 08             	sub    $0x8,%esp
+  801396:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801399:	50                   	push   %eax
+  80139a:	ff 36                	push   (%esi)
+  80139c:	e8 44 fc ff ff       	call   800fe5 <dev_lookup>
+  8013a1:	83 c4 10             	add    $0x10,%esp
+  8013a4:	85 c0                	test   %eax,%eax
+  8013a6:	78 1c                	js     8013c4 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8013a8:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8013ac:	74 1d                	je     8013cb <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8013ae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013b1:	8b 40 18             	mov    0x18(%eax),%eax
+  8013b4:	85 c0                	test   %eax,%eax
+  8013b6:	74 34                	je     8013ec <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8013b8:	83 ec 08             	sub    $0x8,%esp
+  8013bb:	ff 75 0c             	push   0xc(%ebp)
+  8013be:	56                   	push   %esi
+  8013bf:	ff d0                	call   *%eax
+  8013c1:	83 c4 10             	add    $0x10,%esp
+}
+  8013c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013c7:	5b                   	pop    %ebx
+  8013c8:	5e                   	pop    %esi
+  8013c9:	5d                   	pop    %ebp
+  8013ca:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8013cb:	a1 08 40 80 00       	mov    0x804008,%eax
+  8013d0:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8013d3:	83 ec 04             	sub    $0x4,%esp
+  8013d6:	53                   	push   %ebx
+  8013d7:	50                   	push   %eax
+  8013d8:	68 08 29 80 00       	push   $0x802908
+  8013dd:	e8 b7 ed ff ff       	call   800199 <cprintf>
+		return -E_INVAL;
+  8013e2:	83 c4 10             	add    $0x10,%esp
+  8013e5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013ea:	eb d8                	jmp    8013c4 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8013ec:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8013f1:	eb d1                	jmp    8013c4 <ftruncate+0x50>
+
+008013f3 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8013f3:	55                   	push   %ebp
+  8013f4:	89 e5                	mov    %esp,%ebp
+  8013f6:	56                   	push   %esi
+  8013f7:	53                   	push   %ebx
+  8013f8:	83 ec 18             	sub    $0x18,%esp
+  8013fb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8013fe:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801401:	50                   	push   %eax
+  801402:	ff 75 08             	push   0x8(%ebp)
+  801405:	e8 8b fb ff ff       	call   800f95 <fd_lookup>
+  80140a:	83 c4 10             	add    $0x10,%esp
+  80140d:	85 c0                	test   %eax,%eax
+  80140f:	78 49                	js     80145a <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801411:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801414:	83 ec 08             	sub    $0x8,%esp
+  801417:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80141a:	50                   	push   %eax
+  80141b:	ff 36                	push   (%esi)
+  80141d:	e8 c3 fb ff ff       	call   800fe5 <dev_lookup>
+  801422:	83 c4 10             	add    $0x10,%esp
+  801425:	85 c0                	test   %eax,%eax
+  801427:	78 31                	js     80145a <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801429:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80142c:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801430:	74 2f                	je     801461 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801432:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801435:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80143c:	00 00 00 
+	stat->st_isdir = 0;
+  80143f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801446:	00 00 00 
+	stat->st_dev = dev;
+  801449:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80144f:	83 ec 08             	sub    $0x8,%esp
+  801452:	53                   	push   %ebx
+  801453:	56                   	push   %esi
+  801454:	ff 50 14             	call   *0x14(%eax)
+  801457:	83 c4 10             	add    $0x10,%esp
+}
+  80145a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80145d:	5b                   	pop    %ebx
+  80145e:	5e                   	pop    %esi
+  80145f:	5d                   	pop    %ebp
+  801460:	c3                   	ret
+		return -E_NOT_SUPP;
+  801461:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801466:	eb f2                	jmp    80145a <fstat+0x67>
+
+00801468 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801468:	55                   	push   %ebp
+  801469:	89 e5                	mov    %esp,%ebp
+  80146b:	56                   	push   %esi
+  80146c:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80146d:	83 ec 08             	sub    $0x8,%esp
+  801470:	6a 00                	push   $0x0
+  801472:	ff 75 08             	push   0x8(%ebp)
+  801475:	e8 e4 01 00 00       	call   80165e <open>
+  80147a:	89 c3                	mov    %eax,%ebx
+  80147c:	83 c4 10             	add    $0x10,%esp
+  80147f:	85 c0                	test   %eax,%eax
+  801481:	78 1b                	js     80149e <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801483:	83 ec 08             	sub    $0x8,%esp
+  801486:	ff 75 0c             	push   0xc(%ebp)
+  801489:	50                   	push   %eax
+  80148a:	e8 64 ff ff ff       	call   8013f3 <fstat>
+  80148f:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801491:	89 1c 24             	mov    %ebx,(%esp)
+  801494:	e8 26 fc ff ff       	call   8010bf <close>
+	return r;
+  801499:	83 c4 10             	add    $0x10,%esp
+  80149c:	89 f3                	mov    %esi,%ebx
+}
+  80149e:	89 d8                	mov    %ebx,%eax
+  8014a0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014a3:	5b                   	pop    %ebx
+  8014a4:	5e                   	pop    %esi
+  8014a5:	5d                   	pop    %ebp
+  8014a6:	c3                   	ret
+
+008014a7 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  8014a7:	55                   	push   %ebp
+  8014a8:	89 e5                	mov    %esp,%ebp
+  8014aa:	56                   	push   %esi
+  8014ab:	53                   	push   %ebx
+  8014ac:	89 c6                	mov    %eax,%esi
+  8014ae:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  8014b0:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  8014b7:	74 27                	je     8014e0 <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8014b9:	6a 07                	push   $0x7
+  8014bb:	68 00 50 80 00       	push   $0x805000
+  8014c0:	56                   	push   %esi
+  8014c1:	ff 35 00 40 80 00    	push   0x804000
+  8014c7:	e8 b9 f9 ff ff       	call   800e85 <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  8014cc:	83 c4 0c             	add    $0xc,%esp
+  8014cf:	6a 00                	push   $0x0
+  8014d1:	53                   	push   %ebx
+  8014d2:	6a 00                	push   $0x0
+  8014d4:	e8 38 f9 ff ff       	call   800e11 <ipc_recv>
+}
+  8014d9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014dc:	5b                   	pop    %ebx
+  8014dd:	5e                   	pop    %esi
+  8014de:	5d                   	pop    %ebp
+  8014df:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  8014e0:	83 ec 0c             	sub    $0xc,%esp
+  8014e3:	6a 01                	push   $0x1
+  8014e5:	e8 ef f9 ff ff       	call   800ed9 <ipc_find_env>
+  8014ea:	a3 00 40 80 00       	mov    %eax,0x804000
+  8014ef:	83 c4 10             	add    $0x10,%esp
+  8014f2:	eb c5                	jmp    8014b9 <fsipc+0x12>
+
+008014f4 <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8014f4:	55                   	push   %ebp
+  8014f5:	89 e5                	mov    %esp,%ebp
+  8014f7:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8014fa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014fd:	8b 40 0c             	mov    0xc(%eax),%eax
+  801500:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.set_size.req_size = newsize;
+  801505:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801508:	a3 04 50 80 00       	mov    %eax,0x805004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  80150d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801512:	b8 02 00 00 00       	mov    $0x2,%eax
+  801517:	e8 8b ff ff ff       	call   8014a7 <fsipc>
+}
+  80151c:	c9                   	leave
+  80151d:	c3                   	ret
+
+0080151e <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80151e:	55                   	push   %ebp
+  80151f:	89 e5                	mov    %esp,%ebp
+  801521:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801524:	8b 45 08             	mov    0x8(%ebp),%eax
+  801527:	8b 40 0c             	mov    0xc(%eax),%eax
+  80152a:	a3 00 50 80 00       	mov    %eax,0x805000
+  return fsipc(FSREQ_FLUSH, NULL);
+  80152f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801534:	b8 06 00 00 00       	mov    $0x6,%eax
+  801539:	e8 69 ff ff ff       	call   8014a7 <fsipc>
+}
+  80153e:	c9                   	leave
+  80153f:	c3                   	ret
+
+00801540 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801540:	55                   	push   %ebp
+  801541:	89 e5                	mov    %esp,%ebp
+  801543:	53                   	push   %ebx
+  801544:	83 ec 04             	sub    $0x4,%esp
+  801547:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80154a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80154d:	8b 40 0c             	mov    0xc(%eax),%eax
+  801550:	a3 00 50 80 00       	mov    %eax,0x805000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801555:	ba 00 00 00 00       	mov    $0x0,%edx
+  80155a:	b8 05 00 00 00       	mov    $0x5,%eax
+  80155f:	e8 43 ff ff ff       	call   8014a7 <fsipc>
+  801564:	85 c0                	test   %eax,%eax
+  801566:	78 2c                	js     801594 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801568:	83 ec 08             	sub    $0x8,%esp
+  80156b:	68 00 50 80 00       	push   $0x805000
+  801570:	53                   	push   %ebx
+  801571:	e8 dc f1 ff ff       	call   800752 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801576:	a1 80 50 80 00       	mov    0x805080,%eax
+  80157b:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801581:	a1 84 50 80 00       	mov    0x805084,%eax
+  801586:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  80158c:	83 c4 10             	add    $0x10,%esp
+  80158f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801594:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801597:	c9                   	leave
+  801598:	c3                   	ret
+
+00801599 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801599:	55                   	push   %ebp
+  80159a:	89 e5                	mov    %esp,%ebp
+  80159c:	83 ec 0c             	sub    $0xc,%esp
+  80159f:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8015a2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015a5:	8b 52 0c             	mov    0xc(%edx),%edx
+  8015a8:	89 15 00 50 80 00    	mov    %edx,0x805000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8015ae:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8015b3:	39 d0                	cmp    %edx,%eax
+  8015b5:	0f 47 c2             	cmova  %edx,%eax
+  8015b8:	a3 04 50 80 00       	mov    %eax,0x805004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  8015bd:	50                   	push   %eax
+  8015be:	ff 75 0c             	push   0xc(%ebp)
+  8015c1:	68 08 50 80 00       	push   $0x805008
+  8015c6:	e8 0d f3 ff ff       	call   8008d8 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  8015cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015d0:	b8 04 00 00 00       	mov    $0x4,%eax
+  8015d5:	e8 cd fe ff ff       	call   8014a7 <fsipc>
+}
+  8015da:	c9                   	leave
+  8015db:	c3                   	ret
+
+008015dc <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8015dc:	55                   	push   %ebp
+  8015dd:	89 e5                	mov    %esp,%ebp
+  8015df:	56                   	push   %esi
+  8015e0:	53                   	push   %ebx
+  8015e1:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8015e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015e7:	8b 40 0c             	mov    0xc(%eax),%eax
+  8015ea:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.read.req_n = n;
+  8015ef:	89 35 04 50 80 00    	mov    %esi,0x805004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8015f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015fa:	b8 03 00 00 00       	mov    $0x3,%eax
+  8015ff:	e8 a3 fe ff ff       	call   8014a7 <fsipc>
+  801604:	89 c3                	mov    %eax,%ebx
+  801606:	85 c0                	test   %eax,%eax
+  801608:	78 1f                	js     801629 <devfile_read+0x4d>
+  assert(r <= n);
+  80160a:	39 c6                	cmp    %eax,%esi
+  80160c:	72 24                	jb     801632 <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  80160e:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801613:	7f 33                	jg     801648 <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801615:	83 ec 04             	sub    $0x4,%esp
+  801618:	50                   	push   %eax
+  801619:	68 00 50 80 00       	push   $0x805000
+  80161e:	ff 75 0c             	push   0xc(%ebp)
+  801621:	e8 b2 f2 ff ff       	call   8008d8 <memmove>
+  return r;
+  801626:	83 c4 10             	add    $0x10,%esp
+}
+  801629:	89 d8                	mov    %ebx,%eax
+  80162b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80162e:	5b                   	pop    %ebx
+  80162f:	5e                   	pop    %esi
+  801630:	5d                   	pop    %ebp
+  801631:	c3                   	ret
+  assert(r <= n);
+  801632:	68 78 29 80 00       	push   $0x802978
+  801637:	68 7f 29 80 00       	push   $0x80297f
+  80163c:	6a 78                	push   $0x78
+  80163e:	68 94 29 80 00       	push   $0x802994
+  801643:	e8 e1 09 00 00       	call   802029 <_panic>
+  assert(r <= PGSIZE);
+  801648:	68 9f 29 80 00       	push   $0x80299f
+  80164d:	68 7f 29 80 00       	push   $0x80297f
+  801652:	6a 79                	push   $0x79
+  801654:	68 94 29 80 00       	push   $0x802994
+  801659:	e8 cb 09 00 00       	call   802029 <_panic>
+
+0080165e <open>:
+open(const char *path, int mode) {
+  80165e:	55                   	push   %ebp
+  80165f:	89 e5                	mov    %esp,%ebp
+  801661:	56                   	push   %esi
+  801662:	53                   	push   %ebx
+  801663:	83 ec 1c             	sub    $0x1c,%esp
+  801666:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801669:	56                   	push   %esi
+  80166a:	e8 a8 f0 ff ff       	call   800717 <strlen>
+  80166f:	83 c4 10             	add    $0x10,%esp
+  801672:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801677:	7f 6c                	jg     8016e5 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801679:	83 ec 0c             	sub    $0xc,%esp
+  80167c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80167f:	50                   	push   %eax
+  801680:	e8 ba f8 ff ff       	call   800f3f <fd_alloc>
+  801685:	89 c3                	mov    %eax,%ebx
+  801687:	83 c4 10             	add    $0x10,%esp
+  80168a:	85 c0                	test   %eax,%eax
+  80168c:	78 3c                	js     8016ca <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  80168e:	83 ec 08             	sub    $0x8,%esp
+  801691:	56                   	push   %esi
+  801692:	68 00 50 80 00       	push   $0x805000
+  801697:	e8 b6 f0 ff ff       	call   800752 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  80169c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80169f:	a3 00 54 80 00       	mov    %eax,0x805400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8016a4:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8016a7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8016ac:	e8 f6 fd ff ff       	call   8014a7 <fsipc>
+  8016b1:	89 c3                	mov    %eax,%ebx
+  8016b3:	83 c4 10             	add    $0x10,%esp
+  8016b6:	85 c0                	test   %eax,%eax
+  8016b8:	78 19                	js     8016d3 <open+0x75>
+  return fd2num(fd);
+  8016ba:	83 ec 0c             	sub    $0xc,%esp
+  8016bd:	ff 75 f4             	push   -0xc(%ebp)
+  8016c0:	e8 53 f8 ff ff       	call   800f18 <fd2num>
+  8016c5:	89 c3                	mov    %eax,%ebx
+  8016c7:	83 c4 10             	add    $0x10,%esp
+}
+  8016ca:	89 d8                	mov    %ebx,%eax
+  8016cc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016cf:	5b                   	pop    %ebx
+  8016d0:	5e                   	pop    %esi
+  8016d1:	5d                   	pop    %ebp
+  8016d2:	c3                   	ret
+    fd_close(fd, 0);
+  8016d3:	83 ec 08             	sub    $0x8,%esp
+  8016d6:	6a 00                	push   $0x0
+  8016d8:	ff 75 f4             	push   -0xc(%ebp)
+  8016db:	e8 58 f9 ff ff       	call   801038 <fd_close>
+    return r;
+  8016e0:	83 c4 10             	add    $0x10,%esp
+  8016e3:	eb e5                	jmp    8016ca <open+0x6c>
+    return -E_BAD_PATH;
+  8016e5:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8016ea:	eb de                	jmp    8016ca <open+0x6c>
+
+008016ec <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  8016ec:	55                   	push   %ebp
+  8016ed:	89 e5                	mov    %esp,%ebp
+  8016ef:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  8016f2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016f7:	b8 08 00 00 00       	mov    $0x8,%eax
+  8016fc:	e8 a6 fd ff ff       	call   8014a7 <fsipc>
+}
+  801701:	c9                   	leave
+  801702:	c3                   	ret
+
+00801703 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801703:	55                   	push   %ebp
+  801704:	89 e5                	mov    %esp,%ebp
+  801706:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801709:	68 ab 29 80 00       	push   $0x8029ab
+  80170e:	ff 75 0c             	push   0xc(%ebp)
+  801711:	e8 3c f0 ff ff       	call   800752 <strcpy>
+	return 0;
+}
+  801716:	b8 00 00 00 00       	mov    $0x0,%eax
+  80171b:	c9                   	leave
+  80171c:	c3                   	ret
+
+0080171d <devsock_close>:
+{
+  80171d:	55                   	push   %ebp
+  80171e:	89 e5                	mov    %esp,%ebp
+  801720:	53                   	push   %ebx
+  801721:	83 ec 10             	sub    $0x10,%esp
+  801724:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801727:	53                   	push   %ebx
+  801728:	e8 42 09 00 00       	call   80206f <pageref>
+  80172d:	89 c2                	mov    %eax,%edx
+  80172f:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801732:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801737:	83 fa 01             	cmp    $0x1,%edx
+  80173a:	74 05                	je     801741 <devsock_close+0x24>
+}
+  80173c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80173f:	c9                   	leave
+  801740:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801741:	83 ec 0c             	sub    $0xc,%esp
+  801744:	ff 73 0c             	push   0xc(%ebx)
+  801747:	e8 b7 02 00 00       	call   801a03 <nsipc_close>
+  80174c:	83 c4 10             	add    $0x10,%esp
+  80174f:	eb eb                	jmp    80173c <devsock_close+0x1f>
+
+00801751 <devsock_write>:
+{
+  801751:	55                   	push   %ebp
+  801752:	89 e5                	mov    %esp,%ebp
+  801754:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801757:	6a 00                	push   $0x0
+  801759:	ff 75 10             	push   0x10(%ebp)
+  80175c:	ff 75 0c             	push   0xc(%ebp)
+  80175f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801762:	ff 70 0c             	push   0xc(%eax)
+  801765:	e8 79 03 00 00       	call   801ae3 <nsipc_send>
+}
+  80176a:	c9                   	leave
+  80176b:	c3                   	ret
+
+0080176c <devsock_read>:
+{
+  80176c:	55                   	push   %ebp
+  80176d:	89 e5                	mov    %esp,%ebp
+  80176f:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801772:	6a 00                	push   $0x0
+  801774:	ff 75 10             	push   0x10(%ebp)
+  801777:	ff 75 0c             	push   0xc(%ebp)
+  80177a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80177d:	ff 70 0c             	push   0xc(%eax)
+  801780:	e8 ef 02 00 00       	call   801a74 <nsipc_recv>
+}
+  801785:	c9                   	leave
+  801786:	c3                   	ret
+
+00801787 <fd2sockid>:
+{
+  801787:	55                   	push   %ebp
+  801788:	89 e5                	mov    %esp,%ebp
+  80178a:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  80178d:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801790:	52                   	push   %edx
+  801791:	50                   	push   %eax
+  801792:	e8 fe f7 ff ff       	call   800f95 <fd_lookup>
+  801797:	83 c4 10             	add    $0x10,%esp
+  80179a:	85 c0                	test   %eax,%eax
+  80179c:	78 10                	js     8017ae <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  80179e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017a1:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  8017a7:	39 08                	cmp    %ecx,(%eax)
+  8017a9:	75 05                	jne    8017b0 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8017ab:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8017ae:	c9                   	leave
+  8017af:	c3                   	ret
+		return -E_NOT_SUPP;
+  8017b0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017b5:	eb f7                	jmp    8017ae <fd2sockid+0x27>
+
+008017b7 <alloc_sockfd>:
+{
+  8017b7:	55                   	push   %ebp
+  8017b8:	89 e5                	mov    %esp,%ebp
+  8017ba:	56                   	push   %esi
+  8017bb:	53                   	push   %ebx
+  8017bc:	83 ec 1c             	sub    $0x1c,%esp
+  8017bf:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8017c1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017c4:	50                   	push   %eax
+  8017c5:	e8 75 f7 ff ff       	call   800f3f <fd_alloc>
+  8017ca:	89 c3                	mov    %eax,%ebx
+  8017cc:	83 c4 10             	add    $0x10,%esp
+  8017cf:	85 c0                	test   %eax,%eax
+  8017d1:	78 43                	js     801816 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8017d3:	83 ec 04             	sub    $0x4,%esp
+  8017d6:	68 07 04 00 00       	push   $0x407
+  8017db:	ff 75 f4             	push   -0xc(%ebp)
+  8017de:	6a 00                	push   $0x0
+  8017e0:	e8 59 f3 ff ff       	call   800b3e <sys_page_alloc>
+  8017e5:	89 c3                	mov    %eax,%ebx
+  8017e7:	83 c4 10             	add    $0x10,%esp
+  8017ea:	85 c0                	test   %eax,%eax
+  8017ec:	78 28                	js     801816 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8017ee:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017f1:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  8017f7:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8017f9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017fc:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801803:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801806:	83 ec 0c             	sub    $0xc,%esp
+  801809:	50                   	push   %eax
+  80180a:	e8 09 f7 ff ff       	call   800f18 <fd2num>
+  80180f:	89 c3                	mov    %eax,%ebx
+  801811:	83 c4 10             	add    $0x10,%esp
+  801814:	eb 0c                	jmp    801822 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801816:	83 ec 0c             	sub    $0xc,%esp
+  801819:	56                   	push   %esi
+  80181a:	e8 e4 01 00 00       	call   801a03 <nsipc_close>
+		return r;
+  80181f:	83 c4 10             	add    $0x10,%esp
+}
+  801822:	89 d8                	mov    %ebx,%eax
+  801824:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801827:	5b                   	pop    %ebx
+  801828:	5e                   	pop    %esi
+  801829:	5d                   	pop    %ebp
+  80182a:	c3                   	ret
+
+0080182b <accept>:
+{
+  80182b:	55                   	push   %ebp
+  80182c:	89 e5                	mov    %esp,%ebp
+  80182e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801831:	8b 45 08             	mov    0x8(%ebp),%eax
+  801834:	e8 4e ff ff ff       	call   801787 <fd2sockid>
+  801839:	85 c0                	test   %eax,%eax
+  80183b:	78 1b                	js     801858 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  80183d:	83 ec 04             	sub    $0x4,%esp
+  801840:	ff 75 10             	push   0x10(%ebp)
+  801843:	ff 75 0c             	push   0xc(%ebp)
+  801846:	50                   	push   %eax
+  801847:	e8 0e 01 00 00       	call   80195a <nsipc_accept>
+  80184c:	83 c4 10             	add    $0x10,%esp
+  80184f:	85 c0                	test   %eax,%eax
+  801851:	78 05                	js     801858 <accept+0x2d>
+	return alloc_sockfd(r);
+  801853:	e8 5f ff ff ff       	call   8017b7 <alloc_sockfd>
+}
+  801858:	c9                   	leave
+  801859:	c3                   	ret
+
+0080185a <bind>:
+{
+  80185a:	55                   	push   %ebp
+  80185b:	89 e5                	mov    %esp,%ebp
+  80185d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801860:	8b 45 08             	mov    0x8(%ebp),%eax
+  801863:	e8 1f ff ff ff       	call   801787 <fd2sockid>
+  801868:	85 c0                	test   %eax,%eax
+  80186a:	78 12                	js     80187e <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  80186c:	83 ec 04             	sub    $0x4,%esp
+  80186f:	ff 75 10             	push   0x10(%ebp)
+  801872:	ff 75 0c             	push   0xc(%ebp)
+  801875:	50                   	push   %eax
+  801876:	e8 31 01 00 00       	call   8019ac <nsipc_bind>
+  80187b:	83 c4 10             	add    $0x10,%esp
+}
+  80187e:	c9                   	leave
+  80187f:	c3                   	ret
+
+00801880 <shutdown>:
+{
+  801880:	55                   	push   %ebp
+  801881:	89 e5                	mov    %esp,%ebp
+  801883:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801886:	8b 45 08             	mov    0x8(%ebp),%eax
+  801889:	e8 f9 fe ff ff       	call   801787 <fd2sockid>
+  80188e:	85 c0                	test   %eax,%eax
+  801890:	78 0f                	js     8018a1 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801892:	83 ec 08             	sub    $0x8,%esp
+  801895:	ff 75 0c             	push   0xc(%ebp)
+  801898:	50                   	push   %eax
+  801899:	e8 43 01 00 00       	call   8019e1 <nsipc_shutdown>
+  80189e:	83 c4 10             	add    $0x10,%esp
+}
+  8018a1:	c9                   	leave
+  8018a2:	c3                   	ret
+
+008018a3 <connect>:
+{
+  8018a3:	55                   	push   %ebp
+  8018a4:	89 e5                	mov    %esp,%ebp
+  8018a6:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8018a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018ac:	e8 d6 fe ff ff       	call   801787 <fd2sockid>
+  8018b1:	85 c0                	test   %eax,%eax
+  8018b3:	78 12                	js     8018c7 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8018b5:	83 ec 04             	sub    $0x4,%esp
+  8018b8:	ff 75 10             	push   0x10(%ebp)
+  8018bb:	ff 75 0c             	push   0xc(%ebp)
+  8018be:	50                   	push   %eax
+  8018bf:	e8 59 01 00 00       	call   801a1d <nsipc_connect>
+  8018c4:	83 c4 10             	add    $0x10,%esp
+}
+  8018c7:	c9                   	leave
+  8018c8:	c3                   	ret
+
+008018c9 <listen>:
+{
+  8018c9:	55                   	push   %ebp
+  8018ca:	89 e5                	mov    %esp,%ebp
+  8018cc:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8018cf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018d2:	e8 b0 fe ff ff       	call   801787 <fd2sockid>
+  8018d7:	85 c0                	test   %eax,%eax
+  8018d9:	78 0f                	js     8018ea <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8018db:	83 ec 08             	sub    $0x8,%esp
+  8018de:	ff 75 0c             	push   0xc(%ebp)
+  8018e1:	50                   	push   %eax
+  8018e2:	e8 6b 01 00 00       	call   801a52 <nsipc_listen>
+  8018e7:	83 c4 10             	add    $0x10,%esp
+}
+  8018ea:	c9                   	leave
+  8018eb:	c3                   	ret
+
+008018ec <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8018ec:	55                   	push   %ebp
+  8018ed:	89 e5                	mov    %esp,%ebp
+  8018ef:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8018f2:	ff 75 10             	push   0x10(%ebp)
+  8018f5:	ff 75 0c             	push   0xc(%ebp)
+  8018f8:	ff 75 08             	push   0x8(%ebp)
+  8018fb:	e8 41 02 00 00       	call   801b41 <nsipc_socket>
+  801900:	83 c4 10             	add    $0x10,%esp
+  801903:	85 c0                	test   %eax,%eax
+  801905:	78 05                	js     80190c <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801907:	e8 ab fe ff ff       	call   8017b7 <alloc_sockfd>
+}
+  80190c:	c9                   	leave
+  80190d:	c3                   	ret
+
+0080190e <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80190e:	55                   	push   %ebp
+  80190f:	89 e5                	mov    %esp,%ebp
+  801911:	53                   	push   %ebx
+  801912:	83 ec 04             	sub    $0x4,%esp
+  801915:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801917:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80191e:	74 26                	je     801946 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801920:	6a 07                	push   $0x7
+  801922:	68 00 60 80 00       	push   $0x806000
+  801927:	53                   	push   %ebx
+  801928:	ff 35 04 40 80 00    	push   0x804004
+  80192e:	e8 52 f5 ff ff       	call   800e85 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801933:	83 c4 0c             	add    $0xc,%esp
+  801936:	6a 00                	push   $0x0
+  801938:	6a 00                	push   $0x0
+  80193a:	6a 00                	push   $0x0
+  80193c:	e8 d0 f4 ff ff       	call   800e11 <ipc_recv>
+}
+  801941:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801944:	c9                   	leave
+  801945:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801946:	83 ec 0c             	sub    $0xc,%esp
+  801949:	6a 02                	push   $0x2
+  80194b:	e8 89 f5 ff ff       	call   800ed9 <ipc_find_env>
+  801950:	a3 04 40 80 00       	mov    %eax,0x804004
+  801955:	83 c4 10             	add    $0x10,%esp
+  801958:	eb c6                	jmp    801920 <nsipc+0x12>
+
+0080195a <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  80195a:	55                   	push   %ebp
+  80195b:	89 e5                	mov    %esp,%ebp
+  80195d:	56                   	push   %esi
+  80195e:	53                   	push   %ebx
+  80195f:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801962:	8b 45 08             	mov    0x8(%ebp),%eax
+  801965:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  80196a:	8b 06                	mov    (%esi),%eax
+  80196c:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801971:	b8 01 00 00 00       	mov    $0x1,%eax
+  801976:	e8 93 ff ff ff       	call   80190e <nsipc>
+  80197b:	89 c3                	mov    %eax,%ebx
+  80197d:	85 c0                	test   %eax,%eax
+  80197f:	79 09                	jns    80198a <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801981:	89 d8                	mov    %ebx,%eax
+  801983:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801986:	5b                   	pop    %ebx
+  801987:	5e                   	pop    %esi
+  801988:	5d                   	pop    %ebp
+  801989:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  80198a:	83 ec 04             	sub    $0x4,%esp
+  80198d:	ff 35 10 60 80 00    	push   0x806010
+  801993:	68 00 60 80 00       	push   $0x806000
+  801998:	ff 75 0c             	push   0xc(%ebp)
+  80199b:	e8 38 ef ff ff       	call   8008d8 <memmove>
+		*addrlen = ret->ret_addrlen;
+  8019a0:	a1 10 60 80 00       	mov    0x806010,%eax
+  8019a5:	89 06                	mov    %eax,(%esi)
+  8019a7:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8019aa:	eb d5                	jmp    801981 <nsipc_accept+0x27>
+
+008019ac <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8019ac:	55                   	push   %ebp
+  8019ad:	89 e5                	mov    %esp,%ebp
+  8019af:	53                   	push   %ebx
+  8019b0:	83 ec 08             	sub    $0x8,%esp
+  8019b3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8019b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019b9:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8019be:	53                   	push   %ebx
+  8019bf:	ff 75 0c             	push   0xc(%ebp)
+  8019c2:	68 04 60 80 00       	push   $0x806004
+  8019c7:	e8 0c ef ff ff       	call   8008d8 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8019cc:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  8019d2:	b8 02 00 00 00       	mov    $0x2,%eax
+  8019d7:	e8 32 ff ff ff       	call   80190e <nsipc>
+}
+  8019dc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019df:	c9                   	leave
+  8019e0:	c3                   	ret
+
+008019e1 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8019e1:	55                   	push   %ebp
+  8019e2:	89 e5                	mov    %esp,%ebp
+  8019e4:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8019e7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019ea:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  8019ef:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019f2:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  8019f7:	b8 03 00 00 00       	mov    $0x3,%eax
+  8019fc:	e8 0d ff ff ff       	call   80190e <nsipc>
+}
+  801a01:	c9                   	leave
+  801a02:	c3                   	ret
+
+00801a03 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801a03:	55                   	push   %ebp
+  801a04:	89 e5                	mov    %esp,%ebp
+  801a06:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801a09:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a0c:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  801a11:	b8 04 00 00 00       	mov    $0x4,%eax
+  801a16:	e8 f3 fe ff ff       	call   80190e <nsipc>
+}
+  801a1b:	c9                   	leave
+  801a1c:	c3                   	ret
+
+00801a1d <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801a1d:	55                   	push   %ebp
+  801a1e:	89 e5                	mov    %esp,%ebp
+  801a20:	53                   	push   %ebx
+  801a21:	83 ec 08             	sub    $0x8,%esp
+  801a24:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801a27:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a2a:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801a2f:	53                   	push   %ebx
+  801a30:	ff 75 0c             	push   0xc(%ebp)
+  801a33:	68 04 60 80 00       	push   $0x806004
+  801a38:	e8 9b ee ff ff       	call   8008d8 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801a3d:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  801a43:	b8 05 00 00 00       	mov    $0x5,%eax
+  801a48:	e8 c1 fe ff ff       	call   80190e <nsipc>
+}
+  801a4d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a50:	c9                   	leave
+  801a51:	c3                   	ret
+
+00801a52 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801a52:	55                   	push   %ebp
+  801a53:	89 e5                	mov    %esp,%ebp
+  801a55:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801a58:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a5b:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  801a60:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a63:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  801a68:	b8 06 00 00 00       	mov    $0x6,%eax
+  801a6d:	e8 9c fe ff ff       	call   80190e <nsipc>
+}
+  801a72:	c9                   	leave
+  801a73:	c3                   	ret
+
+00801a74 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801a74:	55                   	push   %ebp
+  801a75:	89 e5                	mov    %esp,%ebp
+  801a77:	56                   	push   %esi
+  801a78:	53                   	push   %ebx
+  801a79:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801a7c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a7f:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  801a84:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  801a8a:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a8d:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801a92:	b8 07 00 00 00       	mov    $0x7,%eax
+  801a97:	e8 72 fe ff ff       	call   80190e <nsipc>
+  801a9c:	89 c3                	mov    %eax,%ebx
+  801a9e:	85 c0                	test   %eax,%eax
+  801aa0:	78 22                	js     801ac4 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801aa2:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801aa7:	39 c6                	cmp    %eax,%esi
+  801aa9:	0f 4e c6             	cmovle %esi,%eax
+  801aac:	39 c3                	cmp    %eax,%ebx
+  801aae:	7f 1d                	jg     801acd <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801ab0:	83 ec 04             	sub    $0x4,%esp
+  801ab3:	53                   	push   %ebx
+  801ab4:	68 00 60 80 00       	push   $0x806000
+  801ab9:	ff 75 0c             	push   0xc(%ebp)
+  801abc:	e8 17 ee ff ff       	call   8008d8 <memmove>
+  801ac1:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801ac4:	89 d8                	mov    %ebx,%eax
+  801ac6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ac9:	5b                   	pop    %ebx
+  801aca:	5e                   	pop    %esi
+  801acb:	5d                   	pop    %ebp
+  801acc:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801acd:	68 b7 29 80 00       	push   $0x8029b7
+  801ad2:	68 7f 29 80 00       	push   $0x80297f
+  801ad7:	6a 62                	push   $0x62
+  801ad9:	68 cc 29 80 00       	push   $0x8029cc
+  801ade:	e8 46 05 00 00       	call   802029 <_panic>
+
+00801ae3 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801ae3:	55                   	push   %ebp
+  801ae4:	89 e5                	mov    %esp,%ebp
+  801ae6:	53                   	push   %ebx
+  801ae7:	83 ec 04             	sub    $0x4,%esp
+  801aea:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801aed:	8b 45 08             	mov    0x8(%ebp),%eax
+  801af0:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  801af5:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801afb:	7f 2e                	jg     801b2b <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801afd:	83 ec 04             	sub    $0x4,%esp
+  801b00:	53                   	push   %ebx
+  801b01:	ff 75 0c             	push   0xc(%ebp)
+  801b04:	68 0c 60 80 00       	push   $0x80600c
+  801b09:	e8 ca ed ff ff       	call   8008d8 <memmove>
+	nsipcbuf.send.req_size = size;
+  801b0e:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  801b14:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b17:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  801b1c:	b8 08 00 00 00       	mov    $0x8,%eax
+  801b21:	e8 e8 fd ff ff       	call   80190e <nsipc>
+}
+  801b26:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b29:	c9                   	leave
+  801b2a:	c3                   	ret
+	assert(size < 1600);
+  801b2b:	68 d8 29 80 00       	push   $0x8029d8
+  801b30:	68 7f 29 80 00       	push   $0x80297f
+  801b35:	6a 6d                	push   $0x6d
+  801b37:	68 cc 29 80 00       	push   $0x8029cc
+  801b3c:	e8 e8 04 00 00       	call   802029 <_panic>
+
+00801b41 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801b41:	55                   	push   %ebp
+  801b42:	89 e5                	mov    %esp,%ebp
+  801b44:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801b47:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b4a:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  801b4f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b52:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  801b57:	8b 45 10             	mov    0x10(%ebp),%eax
+  801b5a:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  801b5f:	b8 09 00 00 00       	mov    $0x9,%eax
+  801b64:	e8 a5 fd ff ff       	call   80190e <nsipc>
+}
+  801b69:	c9                   	leave
+  801b6a:	c3                   	ret
+
+00801b6b <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801b6b:	55                   	push   %ebp
+  801b6c:	89 e5                	mov    %esp,%ebp
+  801b6e:	56                   	push   %esi
+  801b6f:	53                   	push   %ebx
+  801b70:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801b73:	83 ec 0c             	sub    $0xc,%esp
+  801b76:	ff 75 08             	push   0x8(%ebp)
+  801b79:	e8 aa f3 ff ff       	call   800f28 <fd2data>
+  801b7e:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801b80:	83 c4 08             	add    $0x8,%esp
+  801b83:	68 e4 29 80 00       	push   $0x8029e4
+  801b88:	53                   	push   %ebx
+  801b89:	e8 c4 eb ff ff       	call   800752 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801b8e:	8b 46 04             	mov    0x4(%esi),%eax
+  801b91:	2b 06                	sub    (%esi),%eax
+  801b93:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  801b99:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801ba0:	00 00 00 
+	stat->st_dev = &devpipe;
+  801ba3:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  801baa:	30 80 00 
+	return 0;
+}
+  801bad:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bb2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bb5:	5b                   	pop    %ebx
+  801bb6:	5e                   	pop    %esi
+  801bb7:	5d                   	pop    %ebp
+  801bb8:	c3                   	ret
+
+00801bb9 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801bb9:	55                   	push   %ebp
+  801bba:	89 e5                	mov    %esp,%ebp
+  801bbc:	53                   	push   %ebx
+  801bbd:	83 ec 0c             	sub    $0xc,%esp
+  801bc0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801bc3:	53                   	push   %ebx
+  801bc4:	6a 00                	push   $0x0
+  801bc6:	e8 f8 ef ff ff       	call   800bc3 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801bcb:	89 1c 24             	mov    %ebx,(%esp)
+  801bce:	e8 55 f3 ff ff       	call   800f28 <fd2data>
+  801bd3:	83 c4 08             	add    $0x8,%esp
+  801bd6:	50                   	push   %eax
+  801bd7:	6a 00                	push   $0x0
+  801bd9:	e8 e5 ef ff ff       	call   800bc3 <sys_page_unmap>
+}
+  801bde:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801be1:	c9                   	leave
+  801be2:	c3                   	ret
+
+00801be3 <_pipeisclosed>:
+{
+  801be3:	55                   	push   %ebp
+  801be4:	89 e5                	mov    %esp,%ebp
+  801be6:	57                   	push   %edi
+  801be7:	56                   	push   %esi
+  801be8:	53                   	push   %ebx
+  801be9:	83 ec 1c             	sub    $0x1c,%esp
+  801bec:	89 c7                	mov    %eax,%edi
+  801bee:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801bf0:	a1 08 40 80 00       	mov    0x804008,%eax
+  801bf5:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801bf8:	83 ec 0c             	sub    $0xc,%esp
+  801bfb:	57                   	push   %edi
+  801bfc:	e8 6e 04 00 00       	call   80206f <pageref>
+  801c01:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801c04:	89 34 24             	mov    %esi,(%esp)
+  801c07:	e8 63 04 00 00       	call   80206f <pageref>
+		nn = thisenv->env_runs;
+  801c0c:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801c12:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801c15:	83 c4 10             	add    $0x10,%esp
+  801c18:	39 cb                	cmp    %ecx,%ebx
+  801c1a:	74 1b                	je     801c37 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801c1c:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801c1f:	75 cf                	jne    801bf0 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801c21:	8b 42 58             	mov    0x58(%edx),%eax
+  801c24:	6a 01                	push   $0x1
+  801c26:	50                   	push   %eax
+  801c27:	53                   	push   %ebx
+  801c28:	68 eb 29 80 00       	push   $0x8029eb
+  801c2d:	e8 67 e5 ff ff       	call   800199 <cprintf>
+  801c32:	83 c4 10             	add    $0x10,%esp
+  801c35:	eb b9                	jmp    801bf0 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801c37:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801c3a:	0f 94 c0             	sete   %al
+  801c3d:	0f b6 c0             	movzbl %al,%eax
+}
+  801c40:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c43:	5b                   	pop    %ebx
+  801c44:	5e                   	pop    %esi
+  801c45:	5f                   	pop    %edi
+  801c46:	5d                   	pop    %ebp
+  801c47:	c3                   	ret
+
+00801c48 <devpipe_write>:
+{
+  801c48:	55                   	push   %ebp
+  801c49:	89 e5                	mov    %esp,%ebp
+  801c4b:	57                   	push   %edi
+  801c4c:	56                   	push   %esi
+  801c4d:	53                   	push   %ebx
+  801c4e:	83 ec 28             	sub    $0x28,%esp
+  801c51:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801c54:	56                   	push   %esi
+  801c55:	e8 ce f2 ff ff       	call   800f28 <fd2data>
+  801c5a:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801c5c:	83 c4 10             	add    $0x10,%esp
+  801c5f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c64:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801c67:	75 09                	jne    801c72 <devpipe_write+0x2a>
+	return i;
+  801c69:	89 f8                	mov    %edi,%eax
+  801c6b:	eb 23                	jmp    801c90 <devpipe_write+0x48>
+			sys_yield();
+  801c6d:	e8 ad ee ff ff       	call   800b1f <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801c72:	8b 43 04             	mov    0x4(%ebx),%eax
+  801c75:	8b 0b                	mov    (%ebx),%ecx
+  801c77:	8d 51 20             	lea    0x20(%ecx),%edx
+  801c7a:	39 d0                	cmp    %edx,%eax
+  801c7c:	72 1a                	jb     801c98 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  801c7e:	89 da                	mov    %ebx,%edx
+  801c80:	89 f0                	mov    %esi,%eax
+  801c82:	e8 5c ff ff ff       	call   801be3 <_pipeisclosed>
+  801c87:	85 c0                	test   %eax,%eax
+  801c89:	74 e2                	je     801c6d <devpipe_write+0x25>
+				return 0;
+  801c8b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c93:	5b                   	pop    %ebx
+  801c94:	5e                   	pop    %esi
+  801c95:	5f                   	pop    %edi
+  801c96:	5d                   	pop    %ebp
+  801c97:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801c98:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c9b:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801c9f:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801ca2:	89 c2                	mov    %eax,%edx
+  801ca4:	c1 fa 1f             	sar    $0x1f,%edx
+  801ca7:	89 d1                	mov    %edx,%ecx
+  801ca9:	c1 e9 1b             	shr    $0x1b,%ecx
+  801cac:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801caf:	83 e2 1f             	and    $0x1f,%edx
+  801cb2:	29 ca                	sub    %ecx,%edx
+  801cb4:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801cb8:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  801cbc:	83 c0 01             	add    $0x1,%eax
+  801cbf:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  801cc2:	83 c7 01             	add    $0x1,%edi
+  801cc5:	eb 9d                	jmp    801c64 <devpipe_write+0x1c>
+
+00801cc7 <devpipe_read>:
+{
+  801cc7:	55                   	push   %ebp
+  801cc8:	89 e5                	mov    %esp,%ebp
+  801cca:	57                   	push   %edi
+  801ccb:	56                   	push   %esi
+  801ccc:	53                   	push   %ebx
+  801ccd:	83 ec 18             	sub    $0x18,%esp
+  801cd0:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  801cd3:	57                   	push   %edi
+  801cd4:	e8 4f f2 ff ff       	call   800f28 <fd2data>
+  801cd9:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801cdb:	83 c4 10             	add    $0x10,%esp
+  801cde:	be 00 00 00 00       	mov    $0x0,%esi
+  801ce3:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801ce6:	75 13                	jne    801cfb <devpipe_read+0x34>
+	return i;
+  801ce8:	89 f0                	mov    %esi,%eax
+  801cea:	eb 02                	jmp    801cee <devpipe_read+0x27>
+				return i;
+  801cec:	89 f0                	mov    %esi,%eax
+}
+  801cee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cf1:	5b                   	pop    %ebx
+  801cf2:	5e                   	pop    %esi
+  801cf3:	5f                   	pop    %edi
+  801cf4:	5d                   	pop    %ebp
+  801cf5:	c3                   	ret
+			sys_yield();
+  801cf6:	e8 24 ee ff ff       	call   800b1f <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  801cfb:	8b 03                	mov    (%ebx),%eax
+  801cfd:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801d00:	75 18                	jne    801d1a <devpipe_read+0x53>
+			if (i > 0)
+  801d02:	85 f6                	test   %esi,%esi
+  801d04:	75 e6                	jne    801cec <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  801d06:	89 da                	mov    %ebx,%edx
+  801d08:	89 f8                	mov    %edi,%eax
+  801d0a:	e8 d4 fe ff ff       	call   801be3 <_pipeisclosed>
+  801d0f:	85 c0                	test   %eax,%eax
+  801d11:	74 e3                	je     801cf6 <devpipe_read+0x2f>
+				return 0;
+  801d13:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d18:	eb d4                	jmp    801cee <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801d1a:	99                   	cltd
+  801d1b:	c1 ea 1b             	shr    $0x1b,%edx
+  801d1e:	01 d0                	add    %edx,%eax
+  801d20:	83 e0 1f             	and    $0x1f,%eax
+  801d23:	29 d0                	sub    %edx,%eax
+  801d25:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801d2a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d2d:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  801d30:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  801d33:	83 c6 01             	add    $0x1,%esi
+  801d36:	eb ab                	jmp    801ce3 <devpipe_read+0x1c>
+
+00801d38 <pipe>:
+{
+  801d38:	55                   	push   %ebp
+  801d39:	89 e5                	mov    %esp,%ebp
+  801d3b:	56                   	push   %esi
+  801d3c:	53                   	push   %ebx
+  801d3d:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801d40:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d43:	50                   	push   %eax
+  801d44:	e8 f6 f1 ff ff       	call   800f3f <fd_alloc>
+  801d49:	89 c3                	mov    %eax,%ebx
+  801d4b:	83 c4 10             	add    $0x10,%esp
+  801d4e:	85 c0                	test   %eax,%eax
+  801d50:	0f 88 23 01 00 00    	js     801e79 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801d56:	83 ec 04             	sub    $0x4,%esp
+  801d59:	68 07 04 00 00       	push   $0x407
+  801d5e:	ff 75 f4             	push   -0xc(%ebp)
+  801d61:	6a 00                	push   $0x0
+  801d63:	e8 d6 ed ff ff       	call   800b3e <sys_page_alloc>
+  801d68:	89 c3                	mov    %eax,%ebx
+  801d6a:	83 c4 10             	add    $0x10,%esp
+  801d6d:	85 c0                	test   %eax,%eax
+  801d6f:	0f 88 04 01 00 00    	js     801e79 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801d75:	83 ec 0c             	sub    $0xc,%esp
+  801d78:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d7b:	50                   	push   %eax
+  801d7c:	e8 be f1 ff ff       	call   800f3f <fd_alloc>
+  801d81:	89 c3                	mov    %eax,%ebx
+  801d83:	83 c4 10             	add    $0x10,%esp
+  801d86:	85 c0                	test   %eax,%eax
+  801d88:	0f 88 db 00 00 00    	js     801e69 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801d8e:	83 ec 04             	sub    $0x4,%esp
+  801d91:	68 07 04 00 00       	push   $0x407
+  801d96:	ff 75 f0             	push   -0x10(%ebp)
+  801d99:	6a 00                	push   $0x0
+  801d9b:	e8 9e ed ff ff       	call   800b3e <sys_page_alloc>
+  801da0:	89 c3                	mov    %eax,%ebx
+  801da2:	83 c4 10             	add    $0x10,%esp
+  801da5:	85 c0                	test   %eax,%eax
+  801da7:	0f 88 bc 00 00 00    	js     801e69 <pipe+0x131>
+	va = fd2data(fd0);
+  801dad:	83 ec 0c             	sub    $0xc,%esp
+  801db0:	ff 75 f4             	push   -0xc(%ebp)
+  801db3:	e8 70 f1 ff ff       	call   800f28 <fd2data>
+  801db8:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801dba:	83 c4 0c             	add    $0xc,%esp
+  801dbd:	68 07 04 00 00       	push   $0x407
+  801dc2:	50                   	push   %eax
+  801dc3:	6a 00                	push   $0x0
+  801dc5:	e8 74 ed ff ff       	call   800b3e <sys_page_alloc>
+  801dca:	89 c3                	mov    %eax,%ebx
+  801dcc:	83 c4 10             	add    $0x10,%esp
+  801dcf:	85 c0                	test   %eax,%eax
+  801dd1:	0f 88 82 00 00 00    	js     801e59 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801dd7:	83 ec 0c             	sub    $0xc,%esp
+  801dda:	ff 75 f0             	push   -0x10(%ebp)
+  801ddd:	e8 46 f1 ff ff       	call   800f28 <fd2data>
+  801de2:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801de9:	50                   	push   %eax
+  801dea:	6a 00                	push   $0x0
+  801dec:	56                   	push   %esi
+  801ded:	6a 00                	push   $0x0
+  801def:	e8 8d ed ff ff       	call   800b81 <sys_page_map>
+  801df4:	89 c3                	mov    %eax,%ebx
+  801df6:	83 c4 20             	add    $0x20,%esp
+  801df9:	85 c0                	test   %eax,%eax
+  801dfb:	78 4e                	js     801e4b <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  801dfd:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  801e02:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801e05:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  801e07:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801e0a:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  801e11:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801e14:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  801e16:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801e19:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  801e20:	83 ec 0c             	sub    $0xc,%esp
+  801e23:	ff 75 f4             	push   -0xc(%ebp)
+  801e26:	e8 ed f0 ff ff       	call   800f18 <fd2num>
+  801e2b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801e2e:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  801e30:	83 c4 04             	add    $0x4,%esp
+  801e33:	ff 75 f0             	push   -0x10(%ebp)
+  801e36:	e8 dd f0 ff ff       	call   800f18 <fd2num>
+  801e3b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801e3e:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  801e41:	83 c4 10             	add    $0x10,%esp
+  801e44:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e49:	eb 2e                	jmp    801e79 <pipe+0x141>
+	sys_page_unmap(0, va);
+  801e4b:	83 ec 08             	sub    $0x8,%esp
+  801e4e:	56                   	push   %esi
+  801e4f:	6a 00                	push   $0x0
+  801e51:	e8 6d ed ff ff       	call   800bc3 <sys_page_unmap>
+  801e56:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  801e59:	83 ec 08             	sub    $0x8,%esp
+  801e5c:	ff 75 f0             	push   -0x10(%ebp)
+  801e5f:	6a 00                	push   $0x0
+  801e61:	e8 5d ed ff ff       	call   800bc3 <sys_page_unmap>
+  801e66:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  801e69:	83 ec 08             	sub    $0x8,%esp
+  801e6c:	ff 75 f4             	push   -0xc(%ebp)
+  801e6f:	6a 00                	push   $0x0
+  801e71:	e8 4d ed ff ff       	call   800bc3 <sys_page_unmap>
+  801e76:	83 c4 10             	add    $0x10,%esp
+}
+  801e79:	89 d8                	mov    %ebx,%eax
+  801e7b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e7e:	5b                   	pop    %ebx
+  801e7f:	5e                   	pop    %esi
+  801e80:	5d                   	pop    %ebp
+  801e81:	c3                   	ret
+
+00801e82 <pipeisclosed>:
+{
+  801e82:	55                   	push   %ebp
+  801e83:	89 e5                	mov    %esp,%ebp
+  801e85:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801e88:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e8b:	50                   	push   %eax
+  801e8c:	ff 75 08             	push   0x8(%ebp)
+  801e8f:	e8 01 f1 ff ff       	call   800f95 <fd_lookup>
+  801e94:	83 c4 10             	add    $0x10,%esp
+  801e97:	85 c0                	test   %eax,%eax
+  801e99:	78 18                	js     801eb3 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  801e9b:	83 ec 0c             	sub    $0xc,%esp
+  801e9e:	ff 75 f4             	push   -0xc(%ebp)
+  801ea1:	e8 82 f0 ff ff       	call   800f28 <fd2data>
+  801ea6:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  801ea8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801eab:	e8 33 fd ff ff       	call   801be3 <_pipeisclosed>
+  801eb0:	83 c4 10             	add    $0x10,%esp
+}
+  801eb3:	c9                   	leave
+  801eb4:	c3                   	ret
+
+00801eb5 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  801eb5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eba:	c3                   	ret
+
+00801ebb <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  801ebb:	55                   	push   %ebp
+  801ebc:	89 e5                	mov    %esp,%ebp
+  801ebe:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  801ec1:	68 03 2a 80 00       	push   $0x802a03
+  801ec6:	ff 75 0c             	push   0xc(%ebp)
+  801ec9:	e8 84 e8 ff ff       	call   800752 <strcpy>
+	return 0;
+}
+  801ece:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ed3:	c9                   	leave
+  801ed4:	c3                   	ret
+
+00801ed5 <devcons_write>:
+{
+  801ed5:	55                   	push   %ebp
+  801ed6:	89 e5                	mov    %esp,%ebp
+  801ed8:	57                   	push   %edi
+  801ed9:	56                   	push   %esi
+  801eda:	53                   	push   %ebx
+  801edb:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  801ee1:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  801ee6:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  801eec:	eb 2e                	jmp    801f1c <devcons_write+0x47>
+		m = n - tot;
+  801eee:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801ef1:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  801ef3:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801ef8:	39 c3                	cmp    %eax,%ebx
+  801efa:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  801efd:	83 ec 04             	sub    $0x4,%esp
+  801f00:	53                   	push   %ebx
+  801f01:	89 f0                	mov    %esi,%eax
+  801f03:	03 45 0c             	add    0xc(%ebp),%eax
+  801f06:	50                   	push   %eax
+  801f07:	57                   	push   %edi
+  801f08:	e8 cb e9 ff ff       	call   8008d8 <memmove>
+		sys_cputs(buf, m);
+  801f0d:	83 c4 08             	add    $0x8,%esp
+  801f10:	53                   	push   %ebx
+  801f11:	57                   	push   %edi
+  801f12:	e8 6b eb ff ff       	call   800a82 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  801f17:	01 de                	add    %ebx,%esi
+  801f19:	83 c4 10             	add    $0x10,%esp
+  801f1c:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801f1f:	72 cd                	jb     801eee <devcons_write+0x19>
+}
+  801f21:	89 f0                	mov    %esi,%eax
+  801f23:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f26:	5b                   	pop    %ebx
+  801f27:	5e                   	pop    %esi
+  801f28:	5f                   	pop    %edi
+  801f29:	5d                   	pop    %ebp
+  801f2a:	c3                   	ret
+
+00801f2b <devcons_read>:
+{
+  801f2b:	55                   	push   %ebp
+  801f2c:	89 e5                	mov    %esp,%ebp
+  801f2e:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  801f31:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f36:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801f3a:	75 07                	jne    801f43 <devcons_read+0x18>
+  801f3c:	eb 1f                	jmp    801f5d <devcons_read+0x32>
+		sys_yield();
+  801f3e:	e8 dc eb ff ff       	call   800b1f <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  801f43:	e8 58 eb ff ff       	call   800aa0 <sys_cgetc>
+  801f48:	85 c0                	test   %eax,%eax
+  801f4a:	74 f2                	je     801f3e <devcons_read+0x13>
+	if (c < 0)
+  801f4c:	78 0f                	js     801f5d <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  801f4e:	83 f8 04             	cmp    $0x4,%eax
+  801f51:	74 0c                	je     801f5f <devcons_read+0x34>
+	*(char*)vbuf = c;
+  801f53:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801f56:	88 02                	mov    %al,(%edx)
+	return 1;
+  801f58:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  801f5d:	c9                   	leave
+  801f5e:	c3                   	ret
+		return 0;
+  801f5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f64:	eb f7                	jmp    801f5d <devcons_read+0x32>
+
+00801f66 <cputchar>:
+{
+  801f66:	55                   	push   %ebp
+  801f67:	89 e5                	mov    %esp,%ebp
+  801f69:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  801f6c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f6f:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  801f72:	6a 01                	push   $0x1
+  801f74:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801f77:	50                   	push   %eax
+  801f78:	e8 05 eb ff ff       	call   800a82 <sys_cputs>
+}
+  801f7d:	83 c4 10             	add    $0x10,%esp
+  801f80:	c9                   	leave
+  801f81:	c3                   	ret
+
+00801f82 <getchar>:
+{
+  801f82:	55                   	push   %ebp
+  801f83:	89 e5                	mov    %esp,%ebp
+  801f85:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  801f88:	6a 01                	push   $0x1
+  801f8a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801f8d:	50                   	push   %eax
+  801f8e:	6a 00                	push   $0x0
+  801f90:	e8 66 f2 ff ff       	call   8011fb <read>
+	if (r < 0)
+  801f95:	83 c4 10             	add    $0x10,%esp
+  801f98:	85 c0                	test   %eax,%eax
+  801f9a:	78 06                	js     801fa2 <getchar+0x20>
+	if (r < 1)
+  801f9c:	74 06                	je     801fa4 <getchar+0x22>
+	return c;
+  801f9e:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  801fa2:	c9                   	leave
+  801fa3:	c3                   	ret
+		return -E_EOF;
+  801fa4:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  801fa9:	eb f7                	jmp    801fa2 <getchar+0x20>
+
+00801fab <iscons>:
+{
+  801fab:	55                   	push   %ebp
+  801fac:	89 e5                	mov    %esp,%ebp
+  801fae:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801fb1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fb4:	50                   	push   %eax
+  801fb5:	ff 75 08             	push   0x8(%ebp)
+  801fb8:	e8 d8 ef ff ff       	call   800f95 <fd_lookup>
+  801fbd:	83 c4 10             	add    $0x10,%esp
+  801fc0:	85 c0                	test   %eax,%eax
+  801fc2:	78 11                	js     801fd5 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  801fc4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801fc7:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  801fcd:	39 10                	cmp    %edx,(%eax)
+  801fcf:	0f 94 c0             	sete   %al
+  801fd2:	0f b6 c0             	movzbl %al,%eax
+}
+  801fd5:	c9                   	leave
+  801fd6:	c3                   	ret
+
+00801fd7 <opencons>:
+{
+  801fd7:	55                   	push   %ebp
+  801fd8:	89 e5                	mov    %esp,%ebp
+  801fda:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  801fdd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fe0:	50                   	push   %eax
+  801fe1:	e8 59 ef ff ff       	call   800f3f <fd_alloc>
+  801fe6:	83 c4 10             	add    $0x10,%esp
+  801fe9:	85 c0                	test   %eax,%eax
+  801feb:	78 3a                	js     802027 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  801fed:	83 ec 04             	sub    $0x4,%esp
+  801ff0:	68 07 04 00 00       	push   $0x407
+  801ff5:	ff 75 f4             	push   -0xc(%ebp)
+  801ff8:	6a 00                	push   $0x0
+  801ffa:	e8 3f eb ff ff       	call   800b3e <sys_page_alloc>
+  801fff:	83 c4 10             	add    $0x10,%esp
+  802002:	85 c0                	test   %eax,%eax
+  802004:	78 21                	js     802027 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802006:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802009:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  80200f:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802011:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802014:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80201b:	83 ec 0c             	sub    $0xc,%esp
+  80201e:	50                   	push   %eax
+  80201f:	e8 f4 ee ff ff       	call   800f18 <fd2num>
+  802024:	83 c4 10             	add    $0x10,%esp
+}
+  802027:	c9                   	leave
+  802028:	c3                   	ret
+
+00802029 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  802029:	55                   	push   %ebp
+  80202a:	89 e5                	mov    %esp,%ebp
+  80202c:	56                   	push   %esi
+  80202d:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80202e:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  802031:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  802037:	e8 c4 ea ff ff       	call   800b00 <sys_getenvid>
+  80203c:	83 ec 0c             	sub    $0xc,%esp
+  80203f:	ff 75 0c             	push   0xc(%ebp)
+  802042:	ff 75 08             	push   0x8(%ebp)
+  802045:	56                   	push   %esi
+  802046:	50                   	push   %eax
+  802047:	68 10 2a 80 00       	push   $0x802a10
+  80204c:	e8 48 e1 ff ff       	call   800199 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  802051:	83 c4 18             	add    $0x18,%esp
+  802054:	53                   	push   %ebx
+  802055:	ff 75 10             	push   0x10(%ebp)
+  802058:	e8 eb e0 ff ff       	call   800148 <vcprintf>
+	cprintf("\n");
+  80205d:	c7 04 24 fc 29 80 00 	movl   $0x8029fc,(%esp)
+  802064:	e8 30 e1 ff ff       	call   800199 <cprintf>
+  802069:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80206c:	cc                   	int3
+	while (1)
+  80206d:	eb fd                	jmp    80206c <_panic+0x43>
+
+0080206f <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80206f:	55                   	push   %ebp
+  802070:	89 e5                	mov    %esp,%ebp
+  802072:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802075:	89 c2                	mov    %eax,%edx
+  802077:	c1 ea 16             	shr    $0x16,%edx
+  80207a:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802081:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802086:	f6 c1 01             	test   $0x1,%cl
+  802089:	74 1c                	je     8020a7 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  80208b:	c1 e8 0c             	shr    $0xc,%eax
+  80208e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802095:	a8 01                	test   $0x1,%al
+  802097:	74 0e                	je     8020a7 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802099:	c1 e8 0c             	shr    $0xc,%eax
+  80209c:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  8020a3:	ef 
+  8020a4:	0f b7 d2             	movzwl %dx,%edx
+}
+  8020a7:	89 d0                	mov    %edx,%eax
+  8020a9:	5d                   	pop    %ebp
+  8020aa:	c3                   	ret
+  8020ab:	66 90                	xchg   %ax,%ax
+  8020ad:	66 90                	xchg   %ax,%ax
+  8020af:	90                   	nop
+
+008020b0 <__udivmoddi4>:
+  8020b0:	55                   	push   %ebp
+  8020b1:	57                   	push   %edi
+  8020b2:	56                   	push   %esi
+  8020b3:	53                   	push   %ebx
+  8020b4:	83 ec 24             	sub    $0x24,%esp
+  8020b7:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8020bb:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8020bf:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  8020c3:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8020c7:	8b 54 24 44          	mov    0x44(%esp),%edx
+  8020cb:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8020cf:	8b 44 24 40          	mov    0x40(%esp),%eax
+  8020d3:	89 d3                	mov    %edx,%ebx
+  8020d5:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8020d9:	09 c3                	or     %eax,%ebx
+  8020db:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8020df:	0f 84 9c 00 00 00    	je     802181 <__udivmoddi4+0xd1>
+  8020e5:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8020ec:	00 
+  8020ed:	31 c0                	xor    %eax,%eax
+  8020ef:	31 d2                	xor    %edx,%edx
+  8020f1:	89 fb                	mov    %edi,%ebx
+  8020f3:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8020fa:	00 
+  8020fb:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802100:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802104:	01 c0                	add    %eax,%eax
+  802106:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80210d:	00 
+  80210e:	89 c6                	mov    %eax,%esi
+  802110:	89 d7                	mov    %edx,%edi
+  802112:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802116:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80211a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80211d:	d3 ea                	shr    %cl,%edx
+  80211f:	f6 c1 20             	test   $0x20,%cl
+  802122:	0f 45 c2             	cmovne %edx,%eax
+  802125:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802129:	83 e0 01             	and    $0x1,%eax
+  80212c:	09 fa                	or     %edi,%edx
+  80212e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802132:	89 04 24             	mov    %eax,(%esp)
+  802135:	8b 04 24             	mov    (%esp),%eax
+  802138:	89 d5                	mov    %edx,%ebp
+  80213a:	09 f0                	or     %esi,%eax
+  80213c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802140:	39 f0                	cmp    %esi,%eax
+  802142:	19 fd                	sbb    %edi,%ebp
+  802144:	72 1d                	jb     802163 <__udivmoddi4+0xb3>
+  802146:	29 f0                	sub    %esi,%eax
+  802148:	19 fa                	sbb    %edi,%edx
+  80214a:	89 cf                	mov    %ecx,%edi
+  80214c:	c1 ef 05             	shr    $0x5,%edi
+  80214f:	83 e7 01             	and    $0x1,%edi
+  802152:	89 fe                	mov    %edi,%esi
+  802154:	d3 e7                	shl    %cl,%edi
+  802156:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80215a:	83 f6 01             	xor    $0x1,%esi
+  80215d:	d3 e6                	shl    %cl,%esi
+  80215f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802163:	83 e9 01             	sub    $0x1,%ecx
+  802166:	73 98                	jae    802100 <__udivmoddi4+0x50>
+  802168:	85 db                	test   %ebx,%ebx
+  80216a:	74 05                	je     802171 <__udivmoddi4+0xc1>
+  80216c:	89 03                	mov    %eax,(%ebx)
+  80216e:	89 53 04             	mov    %edx,0x4(%ebx)
+  802171:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802175:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802179:	83 c4 24             	add    $0x24,%esp
+  80217c:	5b                   	pop    %ebx
+  80217d:	5e                   	pop    %esi
+  80217e:	5f                   	pop    %edi
+  80217f:	5d                   	pop    %ebp
+  802180:	c3                   	ret
+  802181:	85 ff                	test   %edi,%edi
+  802183:	74 0d                	je     802192 <__udivmoddi4+0xe2>
+  802185:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  80218b:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  802192:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802196:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80219a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80219e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8021a2:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  8021a6:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8021aa:	83 c4 24             	add    $0x24,%esp
+  8021ad:	5b                   	pop    %ebx
+  8021ae:	5e                   	pop    %esi
+  8021af:	5f                   	pop    %edi
+  8021b0:	5d                   	pop    %ebp
+  8021b1:	c3                   	ret
+  8021b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8021b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+008021c0 <__udivdi3>:
+  8021c0:	57                   	push   %edi
+  8021c1:	56                   	push   %esi
+  8021c2:	53                   	push   %ebx
+  8021c3:	83 ec 20             	sub    $0x20,%esp
+  8021c6:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8021ca:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8021ce:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8021d2:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8021d6:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8021da:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8021de:	89 d1                	mov    %edx,%ecx
+  8021e0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8021e4:	09 c1                	or     %eax,%ecx
+  8021e6:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8021ea:	89 44 24 18          	mov    %eax,0x18(%esp)
+  8021ee:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  8021f2:	0f 84 88 00 00 00    	je     802280 <__udivdi3+0xc0>
+  8021f8:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8021ff:	00 
+  802200:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802205:	31 c0                	xor    %eax,%eax
+  802207:	31 d2                	xor    %edx,%edx
+  802209:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802210:	00 
+  802211:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802218:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80221c:	01 c0                	add    %eax,%eax
+  80221e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802225:	00 
+  802226:	89 c6                	mov    %eax,%esi
+  802228:	89 d7                	mov    %edx,%edi
+  80222a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80222e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802232:	0f ad d0             	shrd   %cl,%edx,%eax
+  802235:	d3 ea                	shr    %cl,%edx
+  802237:	f6 c1 20             	test   $0x20,%cl
+  80223a:	0f 45 c2             	cmovne %edx,%eax
+  80223d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802241:	83 e0 01             	and    $0x1,%eax
+  802244:	09 fa                	or     %edi,%edx
+  802246:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80224a:	89 04 24             	mov    %eax,(%esp)
+  80224d:	8b 04 24             	mov    (%esp),%eax
+  802250:	89 d3                	mov    %edx,%ebx
+  802252:	09 f0                	or     %esi,%eax
+  802254:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802258:	39 f0                	cmp    %esi,%eax
+  80225a:	19 fb                	sbb    %edi,%ebx
+  80225c:	72 1d                	jb     80227b <__udivdi3+0xbb>
+  80225e:	29 f0                	sub    %esi,%eax
+  802260:	19 fa                	sbb    %edi,%edx
+  802262:	89 cf                	mov    %ecx,%edi
+  802264:	c1 ef 05             	shr    $0x5,%edi
+  802267:	83 e7 01             	and    $0x1,%edi
+  80226a:	89 fe                	mov    %edi,%esi
+  80226c:	d3 e7                	shl    %cl,%edi
+  80226e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802272:	83 f6 01             	xor    $0x1,%esi
+  802275:	d3 e6                	shl    %cl,%esi
+  802277:	09 74 24 18          	or     %esi,0x18(%esp)
+  80227b:	83 e9 01             	sub    $0x1,%ecx
+  80227e:	73 98                	jae    802218 <__udivdi3+0x58>
+  802280:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802284:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802288:	83 c4 20             	add    $0x20,%esp
+  80228b:	5b                   	pop    %ebx
+  80228c:	5e                   	pop    %esi
+  80228d:	5f                   	pop    %edi
+  80228e:	c3                   	ret
+  80228f:	90                   	nop
+
+00802290 <__umoddi3>:
+  802290:	57                   	push   %edi
+  802291:	56                   	push   %esi
+  802292:	53                   	push   %ebx
+  802293:	83 ec 18             	sub    $0x18,%esp
+  802296:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80229a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80229e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8022a2:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8022a6:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8022aa:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8022ae:	89 d1                	mov    %edx,%ecx
+  8022b0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8022b4:	09 c1                	or     %eax,%ecx
+  8022b6:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8022ba:	74 5b                	je     802317 <__umoddi3+0x87>
+  8022bc:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8022c1:	31 c0                	xor    %eax,%eax
+  8022c3:	31 d2                	xor    %edx,%edx
+  8022c5:	8d 76 00             	lea    0x0(%esi),%esi
+  8022c8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8022cc:	01 c0                	add    %eax,%eax
+  8022ce:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8022d5:	00 
+  8022d6:	89 c6                	mov    %eax,%esi
+  8022d8:	89 d7                	mov    %edx,%edi
+  8022da:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8022de:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8022e2:	0f ad d0             	shrd   %cl,%edx,%eax
+  8022e5:	d3 ea                	shr    %cl,%edx
+  8022e7:	f6 c1 20             	test   $0x20,%cl
+  8022ea:	0f 45 c2             	cmovne %edx,%eax
+  8022ed:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8022f1:	83 e0 01             	and    $0x1,%eax
+  8022f4:	09 fa                	or     %edi,%edx
+  8022f6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8022fa:	89 04 24             	mov    %eax,(%esp)
+  8022fd:	8b 04 24             	mov    (%esp),%eax
+  802300:	89 d3                	mov    %edx,%ebx
+  802302:	09 f0                	or     %esi,%eax
+  802304:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802308:	39 f0                	cmp    %esi,%eax
+  80230a:	19 fb                	sbb    %edi,%ebx
+  80230c:	72 04                	jb     802312 <__umoddi3+0x82>
+  80230e:	29 f0                	sub    %esi,%eax
+  802310:	19 fa                	sbb    %edi,%edx
+  802312:	83 e9 01             	sub    $0x1,%ecx
+  802315:	73 b1                	jae    8022c8 <__umoddi3+0x38>
+  802317:	83 c4 18             	add    $0x18,%esp
+  80231a:	5b                   	pop    %ebx
+  80231b:	5e                   	pop    %esi
+  80231c:	5f                   	pop    %edi
+  80231d:	c3                   	ret
+  80231e:	66 90                	xchg   %ax,%ax
+
+00802320 <__divdi3>:
+  802320:	55                   	push   %ebp
+  802321:	57                   	push   %edi
+  802322:	56                   	push   %esi
+  802323:	53                   	push   %ebx
+  802324:	83 ec 24             	sub    $0x24,%esp
+  802327:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  80232b:	8b 74 24 44          	mov    0x44(%esp),%esi
+  80232f:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802333:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802337:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  80233b:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  80233f:	85 d2                	test   %edx,%edx
+  802341:	0f 88 e0 00 00 00    	js     802427 <__divdi3+0x107>
+  802347:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  80234b:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  80234f:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802353:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802357:	85 f6                	test   %esi,%esi
+  802359:	78 16                	js     802371 <__divdi3+0x51>
+  80235b:	89 f1                	mov    %esi,%ecx
+  80235d:	31 c0                	xor    %eax,%eax
+  80235f:	31 d2                	xor    %edx,%edx
+  802361:	09 d9                	or     %ebx,%ecx
+  802363:	0f 85 f3 00 00 00    	jne    80245c <__divdi3+0x13c>
+  802369:	83 c4 24             	add    $0x24,%esp
+  80236c:	5b                   	pop    %ebx
+  80236d:	5e                   	pop    %esi
+  80236e:	5f                   	pop    %edi
+  80236f:	5d                   	pop    %ebp
+  802370:	c3                   	ret
+  802371:	bf 01 00 00 00       	mov    $0x1,%edi
+  802376:	f7 5c 24 08          	negl   0x8(%esp)
+  80237a:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  80237f:	f7 5c 24 0c          	negl   0xc(%esp)
+  802383:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80238a:	00 
+  80238b:	31 c0                	xor    %eax,%eax
+  80238d:	31 d2                	xor    %edx,%edx
+  80238f:	89 fb                	mov    %edi,%ebx
+  802391:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802398:	00 
+  802399:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80239e:	66 90                	xchg   %ax,%ax
+  8023a0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8023a4:	01 c0                	add    %eax,%eax
+  8023a6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8023ad:	00 
+  8023ae:	89 c6                	mov    %eax,%esi
+  8023b0:	89 d7                	mov    %edx,%edi
+  8023b2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8023b6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8023ba:	0f ad d0             	shrd   %cl,%edx,%eax
+  8023bd:	d3 ea                	shr    %cl,%edx
+  8023bf:	f6 c1 20             	test   $0x20,%cl
+  8023c2:	0f 45 c2             	cmovne %edx,%eax
+  8023c5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8023c9:	83 e0 01             	and    $0x1,%eax
+  8023cc:	09 fa                	or     %edi,%edx
+  8023ce:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8023d2:	89 04 24             	mov    %eax,(%esp)
+  8023d5:	8b 04 24             	mov    (%esp),%eax
+  8023d8:	89 d5                	mov    %edx,%ebp
+  8023da:	09 f0                	or     %esi,%eax
+  8023dc:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8023e0:	39 f0                	cmp    %esi,%eax
+  8023e2:	19 fd                	sbb    %edi,%ebp
+  8023e4:	72 1d                	jb     802403 <__divdi3+0xe3>
+  8023e6:	29 f0                	sub    %esi,%eax
+  8023e8:	19 fa                	sbb    %edi,%edx
+  8023ea:	89 cf                	mov    %ecx,%edi
+  8023ec:	c1 ef 05             	shr    $0x5,%edi
+  8023ef:	83 e7 01             	and    $0x1,%edi
+  8023f2:	89 fe                	mov    %edi,%esi
+  8023f4:	d3 e7                	shl    %cl,%edi
+  8023f6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8023fa:	83 f6 01             	xor    $0x1,%esi
+  8023fd:	d3 e6                	shl    %cl,%esi
+  8023ff:	09 74 24 18          	or     %esi,0x18(%esp)
+  802403:	83 e9 01             	sub    $0x1,%ecx
+  802406:	73 98                	jae    8023a0 <__divdi3+0x80>
+  802408:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80240c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802410:	85 db                	test   %ebx,%ebx
+  802412:	0f 84 51 ff ff ff    	je     802369 <__divdi3+0x49>
+  802418:	f7 d8                	neg    %eax
+  80241a:	83 d2 00             	adc    $0x0,%edx
+  80241d:	83 c4 24             	add    $0x24,%esp
+  802420:	5b                   	pop    %ebx
+  802421:	f7 da                	neg    %edx
+  802423:	5e                   	pop    %esi
+  802424:	5f                   	pop    %edi
+  802425:	5d                   	pop    %ebp
+  802426:	c3                   	ret
+  802427:	f7 d8                	neg    %eax
+  802429:	83 d2 00             	adc    $0x0,%edx
+  80242c:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802430:	f7 da                	neg    %edx
+  802432:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802436:	85 f6                	test   %esi,%esi
+  802438:	78 1b                	js     802455 <__divdi3+0x135>
+  80243a:	89 f1                	mov    %esi,%ecx
+  80243c:	31 c0                	xor    %eax,%eax
+  80243e:	31 d2                	xor    %edx,%edx
+  802440:	bf 01 00 00 00       	mov    $0x1,%edi
+  802445:	09 d9                	or     %ebx,%ecx
+  802447:	0f 85 36 ff ff ff    	jne    802383 <__divdi3+0x63>
+  80244d:	83 c4 24             	add    $0x24,%esp
+  802450:	5b                   	pop    %ebx
+  802451:	5e                   	pop    %esi
+  802452:	5f                   	pop    %edi
+  802453:	5d                   	pop    %ebp
+  802454:	c3                   	ret
+  802455:	31 ff                	xor    %edi,%edi
+  802457:	e9 1a ff ff ff       	jmp    802376 <__divdi3+0x56>
+  80245c:	31 ff                	xor    %edi,%edi
+  80245e:	e9 20 ff ff ff       	jmp    802383 <__divdi3+0x63>
+  802463:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80246a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00802470 <__moddi3>:
+  802470:	55                   	push   %ebp
+  802471:	57                   	push   %edi
+  802472:	56                   	push   %esi
+  802473:	53                   	push   %ebx
+  802474:	83 ec 1c             	sub    $0x1c,%esp
+  802477:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  80247b:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  80247f:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  802483:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  802487:	89 c8                	mov    %ecx,%eax
+  802489:	89 f2                	mov    %esi,%edx
+  80248b:	89 f3                	mov    %esi,%ebx
+  80248d:	85 ed                	test   %ebp,%ebp
+  80248f:	0f 88 9d 00 00 00    	js     802532 <__moddi3+0xc2>
+  802495:	09 cb                	or     %ecx,%ebx
+  802497:	0f 84 8d 00 00 00    	je     80252a <__moddi3+0xba>
+  80249d:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  8024a1:	31 db                	xor    %ebx,%ebx
+  8024a3:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  8024a7:	89 ca                	mov    %ecx,%edx
+  8024a9:	89 f0                	mov    %esi,%eax
+  8024ab:	89 dd                	mov    %ebx,%ebp
+  8024ad:	f7 da                	neg    %edx
+  8024af:	83 d0 00             	adc    $0x0,%eax
+  8024b2:	f7 d8                	neg    %eax
+  8024b4:	0f 49 f0             	cmovns %eax,%esi
+  8024b7:	0f 49 ca             	cmovns %edx,%ecx
+  8024ba:	31 c0                	xor    %eax,%eax
+  8024bc:	31 d2                	xor    %edx,%edx
+  8024be:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8024c2:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  8024c6:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8024cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  8024cf:	90                   	nop
+  8024d0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8024d4:	01 c0                	add    %eax,%eax
+  8024d6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8024dd:	00 
+  8024de:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  8024e2:	89 c6                	mov    %eax,%esi
+  8024e4:	89 d7                	mov    %edx,%edi
+  8024e6:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8024ea:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8024ee:	0f ad d0             	shrd   %cl,%edx,%eax
+  8024f1:	d3 ea                	shr    %cl,%edx
+  8024f3:	f6 c1 20             	test   $0x20,%cl
+  8024f6:	0f 45 c2             	cmovne %edx,%eax
+  8024f9:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8024fd:	83 e0 01             	and    $0x1,%eax
+  802500:	09 fa                	or     %edi,%edx
+  802502:	89 04 24             	mov    %eax,(%esp)
+  802505:	8b 04 24             	mov    (%esp),%eax
+  802508:	89 d7                	mov    %edx,%edi
+  80250a:	09 f0                	or     %esi,%eax
+  80250c:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  802510:	39 d8                	cmp    %ebx,%eax
+  802512:	19 f7                	sbb    %esi,%edi
+  802514:	72 04                	jb     80251a <__moddi3+0xaa>
+  802516:	29 d8                	sub    %ebx,%eax
+  802518:	19 f2                	sbb    %esi,%edx
+  80251a:	83 e9 01             	sub    $0x1,%ecx
+  80251d:	73 b1                	jae    8024d0 <__moddi3+0x60>
+  80251f:	85 ed                	test   %ebp,%ebp
+  802521:	74 07                	je     80252a <__moddi3+0xba>
+  802523:	f7 d8                	neg    %eax
+  802525:	83 d2 00             	adc    $0x0,%edx
+  802528:	f7 da                	neg    %edx
+  80252a:	83 c4 1c             	add    $0x1c,%esp
+  80252d:	5b                   	pop    %ebx
+  80252e:	5e                   	pop    %esi
+  80252f:	5f                   	pop    %edi
+  802530:	5d                   	pop    %ebp
+  802531:	c3                   	ret
+  802532:	09 cb                	or     %ecx,%ebx
+  802534:	74 f4                	je     80252a <__moddi3+0xba>
+  802536:	f7 df                	neg    %edi
+  802538:	bb 01 00 00 00       	mov    $0x1,%ebx
+  80253d:	83 d5 00             	adc    $0x0,%ebp
+  802540:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802544:	f7 dd                	neg    %ebp
+  802546:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  80254a:	e9 58 ff ff ff       	jmp    8024a7 <__moddi3+0x37>
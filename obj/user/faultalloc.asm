@@ -0,0 +1,5434 @@
+
+obj/user/faultalloc.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 99 00 00 00       	call   8000ca <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <handler>:
+
+#include <inc/lib.h>
+
+void
+handler(struct UTrapframe *utf)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	void *addr = (void*)utf->utf_fault_va;
+  80003a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80003d:	8b 18                	mov    (%eax),%ebx
+
+	cprintf("fault %x\n", addr);
+  80003f:	53                   	push   %ebx
+  800040:	68 20 26 80 00       	push   $0x802620
+  800045:	e8 be 01 00 00       	call   800208 <cprintf>
+	if ((r = sys_page_alloc(0, ROUNDDOWN(addr, PGSIZE),
+  80004a:	83 c4 0c             	add    $0xc,%esp
+  80004d:	6a 07                	push   $0x7
+  80004f:	89 d8                	mov    %ebx,%eax
+  800051:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800056:	50                   	push   %eax
+  800057:	6a 00                	push   $0x0
+  800059:	e8 4f 0b 00 00       	call   800bad <sys_page_alloc>
+  80005e:	83 c4 10             	add    $0x10,%esp
+  800061:	85 c0                	test   %eax,%eax
+  800063:	78 16                	js     80007b <handler+0x48>
+				PTE_P|PTE_U|PTE_W)) < 0)
+		panic("allocating at %x in page fault handler: %e", addr, r);
+	snprintf((char*) addr, 100, "this string was faulted in at %x", addr);
+  800065:	53                   	push   %ebx
+  800066:	68 6c 26 80 00       	push   $0x80266c
+  80006b:	6a 64                	push   $0x64
+  80006d:	53                   	push   %ebx
+  80006e:	e8 f9 06 00 00       	call   80076c <snprintf>
+}
+  800073:	83 c4 10             	add    $0x10,%esp
+  800076:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800079:	c9                   	leave
+  80007a:	c3                   	ret
+		panic("allocating at %x in page fault handler: %e", addr, r);
+  80007b:	83 ec 0c             	sub    $0xc,%esp
+  80007e:	50                   	push   %eax
+  80007f:	53                   	push   %ebx
+  800080:	68 40 26 80 00       	push   $0x802640
+  800085:	6a 0e                	push   $0xe
+  800087:	68 2a 26 80 00       	push   $0x80262a
+  80008c:	e8 9c 00 00 00       	call   80012d <_panic>
+
+00800091 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800091:	55                   	push   %ebp
+  800092:	89 e5                	mov    %esp,%ebp
+  800094:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(handler);
+  800097:	68 33 00 80 00       	push   $0x800033
+  80009c:	e8 df 0d 00 00       	call   800e80 <set_pgfault_handler>
+	cprintf("%s\n", (char*)0xDeadBeef);
+  8000a1:	83 c4 08             	add    $0x8,%esp
+  8000a4:	68 ef be ad de       	push   $0xdeadbeef
+  8000a9:	68 3c 26 80 00       	push   $0x80263c
+  8000ae:	e8 55 01 00 00       	call   800208 <cprintf>
+	cprintf("%s\n", (char*)0xCafeBffe);
+  8000b3:	83 c4 08             	add    $0x8,%esp
+  8000b6:	68 fe bf fe ca       	push   $0xcafebffe
+  8000bb:	68 3c 26 80 00       	push   $0x80263c
+  8000c0:	e8 43 01 00 00       	call   800208 <cprintf>
+}
+  8000c5:	83 c4 10             	add    $0x10,%esp
+  8000c8:	c9                   	leave
+  8000c9:	c3                   	ret
+
+008000ca <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  8000ca:	55                   	push   %ebp
+  8000cb:	89 e5                	mov    %esp,%ebp
+  8000cd:	56                   	push   %esi
+  8000ce:	53                   	push   %ebx
+  8000cf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000d2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  8000d5:	e8 95 0a 00 00       	call   800b6f <sys_getenvid>
+  8000da:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000df:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8000e2:	c1 e0 04             	shl    $0x4,%eax
+  8000e5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000ea:	a3 08 40 80 00       	mov    %eax,0x804008
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8000ef:	85 db                	test   %ebx,%ebx
+  8000f1:	7e 07                	jle    8000fa <libmain+0x30>
+    binaryname = argv[0];
+  8000f3:	8b 06                	mov    (%esi),%eax
+  8000f5:	a3 00 30 80 00       	mov    %eax,0x803000
+
+  // call user main routine
+  umain(argc, argv);
+  8000fa:	83 ec 08             	sub    $0x8,%esp
+  8000fd:	56                   	push   %esi
+  8000fe:	53                   	push   %ebx
+  8000ff:	e8 8d ff ff ff       	call   800091 <umain>
+
+  // exit gracefully
+  exit();
+  800104:	e8 0a 00 00 00       	call   800113 <exit>
+}
+  800109:	83 c4 10             	add    $0x10,%esp
+  80010c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80010f:	5b                   	pop    %ebx
+  800110:	5e                   	pop    %esi
+  800111:	5d                   	pop    %ebp
+  800112:	c3                   	ret
+
+00800113 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800113:	55                   	push   %ebp
+  800114:	89 e5                	mov    %esp,%ebp
+  800116:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800119:	e8 c5 0f 00 00       	call   8010e3 <close_all>
+	sys_env_destroy(0);
+  80011e:	83 ec 0c             	sub    $0xc,%esp
+  800121:	6a 00                	push   $0x0
+  800123:	e8 06 0a 00 00       	call   800b2e <sys_env_destroy>
+}
+  800128:	83 c4 10             	add    $0x10,%esp
+  80012b:	c9                   	leave
+  80012c:	c3                   	ret
+
+0080012d <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80012d:	55                   	push   %ebp
+  80012e:	89 e5                	mov    %esp,%ebp
+  800130:	56                   	push   %esi
+  800131:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800132:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800135:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  80013b:	e8 2f 0a 00 00       	call   800b6f <sys_getenvid>
+  800140:	83 ec 0c             	sub    $0xc,%esp
+  800143:	ff 75 0c             	push   0xc(%ebp)
+  800146:	ff 75 08             	push   0x8(%ebp)
+  800149:	56                   	push   %esi
+  80014a:	50                   	push   %eax
+  80014b:	68 98 26 80 00       	push   $0x802698
+  800150:	e8 b3 00 00 00       	call   800208 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800155:	83 c4 18             	add    $0x18,%esp
+  800158:	53                   	push   %ebx
+  800159:	ff 75 10             	push   0x10(%ebp)
+  80015c:	e8 56 00 00 00       	call   8001b7 <vcprintf>
+	cprintf("\n");
+  800161:	c7 04 24 80 2b 80 00 	movl   $0x802b80,(%esp)
+  800168:	e8 9b 00 00 00       	call   800208 <cprintf>
+  80016d:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800170:	cc                   	int3
+	while (1)
+  800171:	eb fd                	jmp    800170 <_panic+0x43>
+
+00800173 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800173:	55                   	push   %ebp
+  800174:	89 e5                	mov    %esp,%ebp
+  800176:	53                   	push   %ebx
+  800177:	83 ec 04             	sub    $0x4,%esp
+  80017a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80017d:	8b 13                	mov    (%ebx),%edx
+  80017f:	8d 42 01             	lea    0x1(%edx),%eax
+  800182:	89 03                	mov    %eax,(%ebx)
+  800184:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800187:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80018b:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800190:	74 09                	je     80019b <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800192:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800196:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800199:	c9                   	leave
+  80019a:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80019b:	83 ec 08             	sub    $0x8,%esp
+  80019e:	68 ff 00 00 00       	push   $0xff
+  8001a3:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001a6:	50                   	push   %eax
+  8001a7:	e8 45 09 00 00       	call   800af1 <sys_cputs>
+		b->idx = 0;
+  8001ac:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001b2:	83 c4 10             	add    $0x10,%esp
+  8001b5:	eb db                	jmp    800192 <putch+0x1f>
+
+008001b7 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001b7:	55                   	push   %ebp
+  8001b8:	89 e5                	mov    %esp,%ebp
+  8001ba:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001c0:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001c7:	00 00 00 
+	b.cnt = 0;
+  8001ca:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001d1:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001d4:	ff 75 0c             	push   0xc(%ebp)
+  8001d7:	ff 75 08             	push   0x8(%ebp)
+  8001da:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001e0:	50                   	push   %eax
+  8001e1:	68 73 01 80 00       	push   $0x800173
+  8001e6:	e8 14 01 00 00       	call   8002ff <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8001eb:	83 c4 08             	add    $0x8,%esp
+  8001ee:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001f4:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001fa:	50                   	push   %eax
+  8001fb:	e8 f1 08 00 00       	call   800af1 <sys_cputs>
+
+	return b.cnt;
+}
+  800200:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800206:	c9                   	leave
+  800207:	c3                   	ret
+
+00800208 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800208:	55                   	push   %ebp
+  800209:	89 e5                	mov    %esp,%ebp
+  80020b:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80020e:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800211:	50                   	push   %eax
+  800212:	ff 75 08             	push   0x8(%ebp)
+  800215:	e8 9d ff ff ff       	call   8001b7 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80021a:	c9                   	leave
+  80021b:	c3                   	ret
+
+0080021c <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80021c:	55                   	push   %ebp
+  80021d:	89 e5                	mov    %esp,%ebp
+  80021f:	57                   	push   %edi
+  800220:	56                   	push   %esi
+  800221:	53                   	push   %ebx
+  800222:	83 ec 1c             	sub    $0x1c,%esp
+  800225:	89 c7                	mov    %eax,%edi
+  800227:	89 d6                	mov    %edx,%esi
+  800229:	8b 45 08             	mov    0x8(%ebp),%eax
+  80022c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80022f:	89 d1                	mov    %edx,%ecx
+  800231:	89 c2                	mov    %eax,%edx
+  800233:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800236:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800239:	8b 45 10             	mov    0x10(%ebp),%eax
+  80023c:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80023f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800242:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800249:	39 c2                	cmp    %eax,%edx
+  80024b:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80024e:	72 3e                	jb     80028e <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800250:	83 ec 0c             	sub    $0xc,%esp
+  800253:	ff 75 18             	push   0x18(%ebp)
+  800256:	83 eb 01             	sub    $0x1,%ebx
+  800259:	53                   	push   %ebx
+  80025a:	50                   	push   %eax
+  80025b:	83 ec 08             	sub    $0x8,%esp
+  80025e:	ff 75 e4             	push   -0x1c(%ebp)
+  800261:	ff 75 e0             	push   -0x20(%ebp)
+  800264:	ff 75 dc             	push   -0x24(%ebp)
+  800267:	ff 75 d8             	push   -0x28(%ebp)
+  80026a:	e8 11 20 00 00       	call   802280 <__udivdi3>
+  80026f:	83 c4 18             	add    $0x18,%esp
+  800272:	52                   	push   %edx
+  800273:	50                   	push   %eax
+  800274:	89 f2                	mov    %esi,%edx
+  800276:	89 f8                	mov    %edi,%eax
+  800278:	e8 9f ff ff ff       	call   80021c <printnum>
+  80027d:	83 c4 20             	add    $0x20,%esp
+  800280:	eb 13                	jmp    800295 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800282:	83 ec 08             	sub    $0x8,%esp
+  800285:	56                   	push   %esi
+  800286:	ff 75 18             	push   0x18(%ebp)
+  800289:	ff d7                	call   *%edi
+  80028b:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80028e:	83 eb 01             	sub    $0x1,%ebx
+  800291:	85 db                	test   %ebx,%ebx
+  800293:	7f ed                	jg     800282 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800295:	83 ec 08             	sub    $0x8,%esp
+  800298:	56                   	push   %esi
+  800299:	83 ec 04             	sub    $0x4,%esp
+  80029c:	ff 75 e4             	push   -0x1c(%ebp)
+  80029f:	ff 75 e0             	push   -0x20(%ebp)
+  8002a2:	ff 75 dc             	push   -0x24(%ebp)
+  8002a5:	ff 75 d8             	push   -0x28(%ebp)
+  8002a8:	e8 a3 20 00 00       	call   802350 <__umoddi3>
+  8002ad:	83 c4 14             	add    $0x14,%esp
+  8002b0:	0f be 80 bb 26 80 00 	movsbl 0x8026bb(%eax),%eax
+  8002b7:	50                   	push   %eax
+  8002b8:	ff d7                	call   *%edi
+}
+  8002ba:	83 c4 10             	add    $0x10,%esp
+  8002bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002c0:	5b                   	pop    %ebx
+  8002c1:	5e                   	pop    %esi
+  8002c2:	5f                   	pop    %edi
+  8002c3:	5d                   	pop    %ebp
+  8002c4:	c3                   	ret
+
+008002c5 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002c5:	55                   	push   %ebp
+  8002c6:	89 e5                	mov    %esp,%ebp
+  8002c8:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8002cb:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002cf:	8b 10                	mov    (%eax),%edx
+  8002d1:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002d4:	73 0a                	jae    8002e0 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8002d6:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002d9:	89 08                	mov    %ecx,(%eax)
+  8002db:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002de:	88 02                	mov    %al,(%edx)
+}
+  8002e0:	5d                   	pop    %ebp
+  8002e1:	c3                   	ret
+
+008002e2 <printfmt>:
+{
+  8002e2:	55                   	push   %ebp
+  8002e3:	89 e5                	mov    %esp,%ebp
+  8002e5:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8002e8:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8002eb:	50                   	push   %eax
+  8002ec:	ff 75 10             	push   0x10(%ebp)
+  8002ef:	ff 75 0c             	push   0xc(%ebp)
+  8002f2:	ff 75 08             	push   0x8(%ebp)
+  8002f5:	e8 05 00 00 00       	call   8002ff <vprintfmt>
+}
+  8002fa:	83 c4 10             	add    $0x10,%esp
+  8002fd:	c9                   	leave
+  8002fe:	c3                   	ret
+
+008002ff <vprintfmt>:
+{
+  8002ff:	55                   	push   %ebp
+  800300:	89 e5                	mov    %esp,%ebp
+  800302:	57                   	push   %edi
+  800303:	56                   	push   %esi
+  800304:	53                   	push   %ebx
+  800305:	83 ec 2c             	sub    $0x2c,%esp
+  800308:	8b 75 08             	mov    0x8(%ebp),%esi
+  80030b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80030e:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800311:	eb 0a                	jmp    80031d <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800313:	83 ec 08             	sub    $0x8,%esp
+  800316:	53                   	push   %ebx
+  800317:	50                   	push   %eax
+  800318:	ff d6                	call   *%esi
+  80031a:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80031d:	83 c7 01             	add    $0x1,%edi
+  800320:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800324:	83 f8 25             	cmp    $0x25,%eax
+  800327:	74 0c                	je     800335 <vprintfmt+0x36>
+			if (ch == '\0')
+  800329:	85 c0                	test   %eax,%eax
+  80032b:	75 e6                	jne    800313 <vprintfmt+0x14>
+}
+  80032d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800330:	5b                   	pop    %ebx
+  800331:	5e                   	pop    %esi
+  800332:	5f                   	pop    %edi
+  800333:	5d                   	pop    %ebp
+  800334:	c3                   	ret
+		padc = ' ';
+  800335:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800339:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800340:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800347:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80034e:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800353:	8d 47 01             	lea    0x1(%edi),%eax
+  800356:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800359:	0f b6 17             	movzbl (%edi),%edx
+  80035c:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80035f:	3c 55                	cmp    $0x55,%al
+  800361:	0f 87 9a 03 00 00    	ja     800701 <vprintfmt+0x402>
+  800367:	0f b6 c0             	movzbl %al,%eax
+  80036a:	ff 24 85 00 28 80 00 	jmp    *0x802800(,%eax,4)
+  800371:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800374:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800378:	eb d9                	jmp    800353 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80037a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80037d:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800381:	eb d0                	jmp    800353 <vprintfmt+0x54>
+  800383:	0f b6 d2             	movzbl %dl,%edx
+  800386:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800389:	b8 00 00 00 00       	mov    $0x0,%eax
+  80038e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800391:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800394:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800398:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80039b:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80039e:	83 f9 09             	cmp    $0x9,%ecx
+  8003a1:	77 55                	ja     8003f8 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8003a3:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8003a6:	eb e9                	jmp    800391 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8003a8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003ab:	8b 00                	mov    (%eax),%eax
+  8003ad:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003b3:	8d 40 04             	lea    0x4(%eax),%eax
+  8003b6:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003b9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8003bc:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003c0:	79 91                	jns    800353 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8003c2:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003c5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003c8:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003cf:	eb 82                	jmp    800353 <vprintfmt+0x54>
+			if (width < 0)
+  8003d1:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003d4:	85 d2                	test   %edx,%edx
+  8003d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003db:	0f 49 c2             	cmovns %edx,%eax
+  8003de:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003e1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003e4:	e9 6a ff ff ff       	jmp    800353 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003e9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8003ec:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8003f3:	e9 5b ff ff ff       	jmp    800353 <vprintfmt+0x54>
+  8003f8:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003fb:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003fe:	eb bc                	jmp    8003bc <vprintfmt+0xbd>
+			lflag++;
+  800400:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800403:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800406:	e9 48 ff ff ff       	jmp    800353 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80040b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80040e:	8d 78 04             	lea    0x4(%eax),%edi
+  800411:	83 ec 08             	sub    $0x8,%esp
+  800414:	53                   	push   %ebx
+  800415:	ff 30                	push   (%eax)
+  800417:	ff d6                	call   *%esi
+			break;
+  800419:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80041c:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80041f:	e9 7c 02 00 00       	jmp    8006a0 <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  800424:	8b 45 14             	mov    0x14(%ebp),%eax
+  800427:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80042a:	8b 10                	mov    (%eax),%edx
+  80042c:	89 d0                	mov    %edx,%eax
+  80042e:	f7 d8                	neg    %eax
+  800430:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800433:	83 f8 10             	cmp    $0x10,%eax
+  800436:	7f 23                	jg     80045b <vprintfmt+0x15c>
+  800438:	8b 14 85 60 29 80 00 	mov    0x802960(,%eax,4),%edx
+  80043f:	85 d2                	test   %edx,%edx
+  800441:	74 18                	je     80045b <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800443:	52                   	push   %edx
+  800444:	68 15 2b 80 00       	push   $0x802b15
+  800449:	53                   	push   %ebx
+  80044a:	56                   	push   %esi
+  80044b:	e8 92 fe ff ff       	call   8002e2 <printfmt>
+  800450:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800453:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800456:	e9 45 02 00 00       	jmp    8006a0 <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  80045b:	50                   	push   %eax
+  80045c:	68 d3 26 80 00       	push   $0x8026d3
+  800461:	53                   	push   %ebx
+  800462:	56                   	push   %esi
+  800463:	e8 7a fe ff ff       	call   8002e2 <printfmt>
+  800468:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80046b:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80046e:	e9 2d 02 00 00       	jmp    8006a0 <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800473:	8b 45 14             	mov    0x14(%ebp),%eax
+  800476:	83 c0 04             	add    $0x4,%eax
+  800479:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80047c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80047f:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800481:	85 c9                	test   %ecx,%ecx
+  800483:	b8 cc 26 80 00       	mov    $0x8026cc,%eax
+  800488:	0f 45 c1             	cmovne %ecx,%eax
+  80048b:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80048e:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800492:	7e 06                	jle    80049a <vprintfmt+0x19b>
+  800494:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800498:	75 0b                	jne    8004a5 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80049a:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80049d:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8004a0:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004a3:	eb 5c                	jmp    800501 <vprintfmt+0x202>
+  8004a5:	83 ec 08             	sub    $0x8,%esp
+  8004a8:	ff 75 d0             	push   -0x30(%ebp)
+  8004ab:	ff 75 cc             	push   -0x34(%ebp)
+  8004ae:	e8 eb 02 00 00       	call   80079e <strnlen>
+  8004b3:	89 c2                	mov    %eax,%edx
+  8004b5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004b8:	29 d0                	sub    %edx,%eax
+  8004ba:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8004bd:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004c1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004c4:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004c7:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004c9:	eb 0e                	jmp    8004d9 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8004cb:	83 ec 08             	sub    $0x8,%esp
+  8004ce:	53                   	push   %ebx
+  8004cf:	57                   	push   %edi
+  8004d0:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004d3:	83 ee 01             	sub    $0x1,%esi
+  8004d6:	83 c4 10             	add    $0x10,%esp
+  8004d9:	85 f6                	test   %esi,%esi
+  8004db:	7f ee                	jg     8004cb <vprintfmt+0x1cc>
+  8004dd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004e0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004e3:	85 c0                	test   %eax,%eax
+  8004e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004ea:	0f 49 d0             	cmovns %eax,%edx
+  8004ed:	29 d0                	sub    %edx,%eax
+  8004ef:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004f2:	eb a6                	jmp    80049a <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8004f4:	83 ec 08             	sub    $0x8,%esp
+  8004f7:	53                   	push   %ebx
+  8004f8:	52                   	push   %edx
+  8004f9:	ff 55 08             	call   *0x8(%ebp)
+  8004fc:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004ff:	89 f1                	mov    %esi,%ecx
+  800501:	8d 71 01             	lea    0x1(%ecx),%esi
+  800504:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800508:	0f be d0             	movsbl %al,%edx
+  80050b:	85 d2                	test   %edx,%edx
+  80050d:	74 28                	je     800537 <vprintfmt+0x238>
+  80050f:	85 ff                	test   %edi,%edi
+  800511:	78 05                	js     800518 <vprintfmt+0x219>
+  800513:	83 ef 01             	sub    $0x1,%edi
+  800516:	78 30                	js     800548 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800518:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80051c:	74 d6                	je     8004f4 <vprintfmt+0x1f5>
+  80051e:	0f be c0             	movsbl %al,%eax
+  800521:	83 e8 20             	sub    $0x20,%eax
+  800524:	83 f8 5e             	cmp    $0x5e,%eax
+  800527:	76 cb                	jbe    8004f4 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800529:	83 ec 08             	sub    $0x8,%esp
+  80052c:	53                   	push   %ebx
+  80052d:	6a 3f                	push   $0x3f
+  80052f:	ff 55 08             	call   *0x8(%ebp)
+  800532:	83 c4 10             	add    $0x10,%esp
+  800535:	eb c8                	jmp    8004ff <vprintfmt+0x200>
+  800537:	8b 75 08             	mov    0x8(%ebp),%esi
+  80053a:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80053d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800540:	01 d0                	add    %edx,%eax
+  800542:	29 c8                	sub    %ecx,%eax
+  800544:	89 c7                	mov    %eax,%edi
+  800546:	eb 13                	jmp    80055b <vprintfmt+0x25c>
+  800548:	8b 75 08             	mov    0x8(%ebp),%esi
+  80054b:	eb ed                	jmp    80053a <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80054d:	83 ec 08             	sub    $0x8,%esp
+  800550:	53                   	push   %ebx
+  800551:	6a 20                	push   $0x20
+  800553:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800555:	83 ef 01             	sub    $0x1,%edi
+  800558:	83 c4 10             	add    $0x10,%esp
+  80055b:	85 ff                	test   %edi,%edi
+  80055d:	7f ee                	jg     80054d <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80055f:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800562:	89 45 14             	mov    %eax,0x14(%ebp)
+  800565:	e9 36 01 00 00       	jmp    8006a0 <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  80056a:	83 f9 01             	cmp    $0x1,%ecx
+  80056d:	7f 1f                	jg     80058e <vprintfmt+0x28f>
+	else if (lflag)
+  80056f:	85 c9                	test   %ecx,%ecx
+  800571:	74 67                	je     8005da <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800573:	8b 45 14             	mov    0x14(%ebp),%eax
+  800576:	8b 00                	mov    (%eax),%eax
+  800578:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80057b:	89 c1                	mov    %eax,%ecx
+  80057d:	c1 f9 1f             	sar    $0x1f,%ecx
+  800580:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800583:	8b 45 14             	mov    0x14(%ebp),%eax
+  800586:	8d 40 04             	lea    0x4(%eax),%eax
+  800589:	89 45 14             	mov    %eax,0x14(%ebp)
+  80058c:	eb 17                	jmp    8005a5 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  80058e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800591:	8b 50 04             	mov    0x4(%eax),%edx
+  800594:	8b 00                	mov    (%eax),%eax
+  800596:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800599:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80059c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059f:	8d 40 08             	lea    0x8(%eax),%eax
+  8005a2:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8005a5:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005a8:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8005ab:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8005b0:	85 c9                	test   %ecx,%ecx
+  8005b2:	0f 89 ce 00 00 00    	jns    800686 <vprintfmt+0x387>
+				putch('-', putdat);
+  8005b8:	83 ec 08             	sub    $0x8,%esp
+  8005bb:	53                   	push   %ebx
+  8005bc:	6a 2d                	push   $0x2d
+  8005be:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8005c0:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005c3:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005c6:	f7 da                	neg    %edx
+  8005c8:	83 d1 00             	adc    $0x0,%ecx
+  8005cb:	f7 d9                	neg    %ecx
+  8005cd:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8005d0:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005d5:	e9 ac 00 00 00       	jmp    800686 <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  8005da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005dd:	8b 00                	mov    (%eax),%eax
+  8005df:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005e2:	89 c1                	mov    %eax,%ecx
+  8005e4:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005e7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005ea:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ed:	8d 40 04             	lea    0x4(%eax),%eax
+  8005f0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005f3:	eb b0                	jmp    8005a5 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8005f5:	83 f9 01             	cmp    $0x1,%ecx
+  8005f8:	7f 1b                	jg     800615 <vprintfmt+0x316>
+	else if (lflag)
+  8005fa:	85 c9                	test   %ecx,%ecx
+  8005fc:	74 2c                	je     80062a <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  8005fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800601:	8b 10                	mov    (%eax),%edx
+  800603:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800608:	8d 40 04             	lea    0x4(%eax),%eax
+  80060b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80060e:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800613:	eb 71                	jmp    800686 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  800615:	8b 45 14             	mov    0x14(%ebp),%eax
+  800618:	8b 10                	mov    (%eax),%edx
+  80061a:	8b 48 04             	mov    0x4(%eax),%ecx
+  80061d:	8d 40 08             	lea    0x8(%eax),%eax
+  800620:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800623:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800628:	eb 5c                	jmp    800686 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  80062a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062d:	8b 10                	mov    (%eax),%edx
+  80062f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800634:	8d 40 04             	lea    0x4(%eax),%eax
+  800637:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80063a:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80063f:	eb 45                	jmp    800686 <vprintfmt+0x387>
+			putch('X', putdat);
+  800641:	83 ec 08             	sub    $0x8,%esp
+  800644:	53                   	push   %ebx
+  800645:	6a 58                	push   $0x58
+  800647:	ff d6                	call   *%esi
+			putch('X', putdat);
+  800649:	83 c4 08             	add    $0x8,%esp
+  80064c:	53                   	push   %ebx
+  80064d:	6a 58                	push   $0x58
+  80064f:	ff d6                	call   *%esi
+			putch('X', putdat);
+  800651:	83 c4 08             	add    $0x8,%esp
+  800654:	53                   	push   %ebx
+  800655:	6a 58                	push   $0x58
+  800657:	ff d6                	call   *%esi
+			break;
+  800659:	83 c4 10             	add    $0x10,%esp
+  80065c:	eb 42                	jmp    8006a0 <vprintfmt+0x3a1>
+			putch('0', putdat);
+  80065e:	83 ec 08             	sub    $0x8,%esp
+  800661:	53                   	push   %ebx
+  800662:	6a 30                	push   $0x30
+  800664:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800666:	83 c4 08             	add    $0x8,%esp
+  800669:	53                   	push   %ebx
+  80066a:	6a 78                	push   $0x78
+  80066c:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  80066e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800671:	8b 10                	mov    (%eax),%edx
+  800673:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800678:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80067b:	8d 40 04             	lea    0x4(%eax),%eax
+  80067e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800681:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800686:	83 ec 0c             	sub    $0xc,%esp
+  800689:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80068d:	50                   	push   %eax
+  80068e:	ff 75 e0             	push   -0x20(%ebp)
+  800691:	57                   	push   %edi
+  800692:	51                   	push   %ecx
+  800693:	52                   	push   %edx
+  800694:	89 da                	mov    %ebx,%edx
+  800696:	89 f0                	mov    %esi,%eax
+  800698:	e8 7f fb ff ff       	call   80021c <printnum>
+			break;
+  80069d:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8006a0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8006a3:	e9 75 fc ff ff       	jmp    80031d <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8006a8:	83 f9 01             	cmp    $0x1,%ecx
+  8006ab:	7f 1b                	jg     8006c8 <vprintfmt+0x3c9>
+	else if (lflag)
+  8006ad:	85 c9                	test   %ecx,%ecx
+  8006af:	74 2c                	je     8006dd <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  8006b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b4:	8b 10                	mov    (%eax),%edx
+  8006b6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006bb:	8d 40 04             	lea    0x4(%eax),%eax
+  8006be:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006c1:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8006c6:	eb be                	jmp    800686 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  8006c8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006cb:	8b 10                	mov    (%eax),%edx
+  8006cd:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006d0:	8d 40 08             	lea    0x8(%eax),%eax
+  8006d3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006d6:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8006db:	eb a9                	jmp    800686 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  8006dd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e0:	8b 10                	mov    (%eax),%edx
+  8006e2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006e7:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ea:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006ed:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8006f2:	eb 92                	jmp    800686 <vprintfmt+0x387>
+			putch(ch, putdat);
+  8006f4:	83 ec 08             	sub    $0x8,%esp
+  8006f7:	53                   	push   %ebx
+  8006f8:	6a 25                	push   $0x25
+  8006fa:	ff d6                	call   *%esi
+			break;
+  8006fc:	83 c4 10             	add    $0x10,%esp
+  8006ff:	eb 9f                	jmp    8006a0 <vprintfmt+0x3a1>
+			putch('%', putdat);
+  800701:	83 ec 08             	sub    $0x8,%esp
+  800704:	53                   	push   %ebx
+  800705:	6a 25                	push   $0x25
+  800707:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800709:	83 c4 10             	add    $0x10,%esp
+  80070c:	89 f8                	mov    %edi,%eax
+  80070e:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800712:	74 05                	je     800719 <vprintfmt+0x41a>
+  800714:	83 e8 01             	sub    $0x1,%eax
+  800717:	eb f5                	jmp    80070e <vprintfmt+0x40f>
+  800719:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80071c:	eb 82                	jmp    8006a0 <vprintfmt+0x3a1>
+
+0080071e <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80071e:	55                   	push   %ebp
+  80071f:	89 e5                	mov    %esp,%ebp
+  800721:	83 ec 18             	sub    $0x18,%esp
+  800724:	8b 45 08             	mov    0x8(%ebp),%eax
+  800727:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80072a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80072d:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800731:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800734:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80073b:	85 c0                	test   %eax,%eax
+  80073d:	74 26                	je     800765 <vsnprintf+0x47>
+  80073f:	85 d2                	test   %edx,%edx
+  800741:	7e 22                	jle    800765 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800743:	ff 75 14             	push   0x14(%ebp)
+  800746:	ff 75 10             	push   0x10(%ebp)
+  800749:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80074c:	50                   	push   %eax
+  80074d:	68 c5 02 80 00       	push   $0x8002c5
+  800752:	e8 a8 fb ff ff       	call   8002ff <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800757:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80075a:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80075d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800760:	83 c4 10             	add    $0x10,%esp
+}
+  800763:	c9                   	leave
+  800764:	c3                   	ret
+		return -E_INVAL;
+  800765:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80076a:	eb f7                	jmp    800763 <vsnprintf+0x45>
+
+0080076c <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80076c:	55                   	push   %ebp
+  80076d:	89 e5                	mov    %esp,%ebp
+  80076f:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800772:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800775:	50                   	push   %eax
+  800776:	ff 75 10             	push   0x10(%ebp)
+  800779:	ff 75 0c             	push   0xc(%ebp)
+  80077c:	ff 75 08             	push   0x8(%ebp)
+  80077f:	e8 9a ff ff ff       	call   80071e <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800784:	c9                   	leave
+  800785:	c3                   	ret
+
+00800786 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800786:	55                   	push   %ebp
+  800787:	89 e5                	mov    %esp,%ebp
+  800789:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80078c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800791:	eb 03                	jmp    800796 <strlen+0x10>
+		n++;
+  800793:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800796:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80079a:	75 f7                	jne    800793 <strlen+0xd>
+	return n;
+}
+  80079c:	5d                   	pop    %ebp
+  80079d:	c3                   	ret
+
+0080079e <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80079e:	55                   	push   %ebp
+  80079f:	89 e5                	mov    %esp,%ebp
+  8007a1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007a4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ac:	eb 03                	jmp    8007b1 <strnlen+0x13>
+		n++;
+  8007ae:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007b1:	39 d0                	cmp    %edx,%eax
+  8007b3:	74 08                	je     8007bd <strnlen+0x1f>
+  8007b5:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8007b9:	75 f3                	jne    8007ae <strnlen+0x10>
+  8007bb:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8007bd:	89 d0                	mov    %edx,%eax
+  8007bf:	5d                   	pop    %ebp
+  8007c0:	c3                   	ret
+
+008007c1 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8007c1:	55                   	push   %ebp
+  8007c2:	89 e5                	mov    %esp,%ebp
+  8007c4:	53                   	push   %ebx
+  8007c5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007c8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8007cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007d0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8007d4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8007d7:	83 c0 01             	add    $0x1,%eax
+  8007da:	84 d2                	test   %dl,%dl
+  8007dc:	75 f2                	jne    8007d0 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8007de:	89 c8                	mov    %ecx,%eax
+  8007e0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007e3:	c9                   	leave
+  8007e4:	c3                   	ret
+
+008007e5 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8007e5:	55                   	push   %ebp
+  8007e6:	89 e5                	mov    %esp,%ebp
+  8007e8:	53                   	push   %ebx
+  8007e9:	83 ec 10             	sub    $0x10,%esp
+  8007ec:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8007ef:	53                   	push   %ebx
+  8007f0:	e8 91 ff ff ff       	call   800786 <strlen>
+  8007f5:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8007f8:	ff 75 0c             	push   0xc(%ebp)
+  8007fb:	01 d8                	add    %ebx,%eax
+  8007fd:	50                   	push   %eax
+  8007fe:	e8 be ff ff ff       	call   8007c1 <strcpy>
+	return dst;
+}
+  800803:	89 d8                	mov    %ebx,%eax
+  800805:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800808:	c9                   	leave
+  800809:	c3                   	ret
+
+0080080a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80080a:	55                   	push   %ebp
+  80080b:	89 e5                	mov    %esp,%ebp
+  80080d:	56                   	push   %esi
+  80080e:	53                   	push   %ebx
+  80080f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800812:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800815:	89 f3                	mov    %esi,%ebx
+  800817:	03 5d 10             	add    0x10(%ebp),%ebx
+  80081a:	89 f0                	mov    %esi,%eax
+  80081c:	eb 0f                	jmp    80082d <strncpy+0x23>
+		*dst++ = *src;
+  80081e:	83 c0 01             	add    $0x1,%eax
+  800821:	0f b6 0a             	movzbl (%edx),%ecx
+  800824:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800827:	80 f9 01             	cmp    $0x1,%cl
+  80082a:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80082d:	39 d8                	cmp    %ebx,%eax
+  80082f:	75 ed                	jne    80081e <strncpy+0x14>
+	}
+	return ret;
+}
+  800831:	89 f0                	mov    %esi,%eax
+  800833:	5b                   	pop    %ebx
+  800834:	5e                   	pop    %esi
+  800835:	5d                   	pop    %ebp
+  800836:	c3                   	ret
+
+00800837 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800837:	55                   	push   %ebp
+  800838:	89 e5                	mov    %esp,%ebp
+  80083a:	56                   	push   %esi
+  80083b:	53                   	push   %ebx
+  80083c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80083f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800842:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800845:	89 f0                	mov    %esi,%eax
+  800847:	85 d2                	test   %edx,%edx
+  800849:	74 21                	je     80086c <strlcpy+0x35>
+  80084b:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80084f:	89 f2                	mov    %esi,%edx
+  800851:	eb 09                	jmp    80085c <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800853:	83 c1 01             	add    $0x1,%ecx
+  800856:	83 c2 01             	add    $0x1,%edx
+  800859:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80085c:	39 c2                	cmp    %eax,%edx
+  80085e:	74 09                	je     800869 <strlcpy+0x32>
+  800860:	0f b6 19             	movzbl (%ecx),%ebx
+  800863:	84 db                	test   %bl,%bl
+  800865:	75 ec                	jne    800853 <strlcpy+0x1c>
+  800867:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800869:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80086c:	29 f0                	sub    %esi,%eax
+}
+  80086e:	5b                   	pop    %ebx
+  80086f:	5e                   	pop    %esi
+  800870:	5d                   	pop    %ebp
+  800871:	c3                   	ret
+
+00800872 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800872:	55                   	push   %ebp
+  800873:	89 e5                	mov    %esp,%ebp
+  800875:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800878:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80087b:	eb 06                	jmp    800883 <strcmp+0x11>
+		p++, q++;
+  80087d:	83 c1 01             	add    $0x1,%ecx
+  800880:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800883:	0f b6 01             	movzbl (%ecx),%eax
+  800886:	84 c0                	test   %al,%al
+  800888:	74 04                	je     80088e <strcmp+0x1c>
+  80088a:	3a 02                	cmp    (%edx),%al
+  80088c:	74 ef                	je     80087d <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80088e:	0f b6 c0             	movzbl %al,%eax
+  800891:	0f b6 12             	movzbl (%edx),%edx
+  800894:	29 d0                	sub    %edx,%eax
+}
+  800896:	5d                   	pop    %ebp
+  800897:	c3                   	ret
+
+00800898 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800898:	55                   	push   %ebp
+  800899:	89 e5                	mov    %esp,%ebp
+  80089b:	53                   	push   %ebx
+  80089c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80089f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008a2:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8008a5:	eb 09                	jmp    8008b0 <strncmp+0x18>
+		n--, p++, q++;
+  8008a7:	83 ea 01             	sub    $0x1,%edx
+  8008aa:	83 c0 01             	add    $0x1,%eax
+  8008ad:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8008b0:	85 d2                	test   %edx,%edx
+  8008b2:	74 18                	je     8008cc <strncmp+0x34>
+  8008b4:	0f b6 18             	movzbl (%eax),%ebx
+  8008b7:	84 db                	test   %bl,%bl
+  8008b9:	74 04                	je     8008bf <strncmp+0x27>
+  8008bb:	3a 19                	cmp    (%ecx),%bl
+  8008bd:	74 e8                	je     8008a7 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008bf:	0f b6 00             	movzbl (%eax),%eax
+  8008c2:	0f b6 11             	movzbl (%ecx),%edx
+  8008c5:	29 d0                	sub    %edx,%eax
+}
+  8008c7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008ca:	c9                   	leave
+  8008cb:	c3                   	ret
+		return 0;
+  8008cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d1:	eb f4                	jmp    8008c7 <strncmp+0x2f>
+
+008008d3 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8008d3:	55                   	push   %ebp
+  8008d4:	89 e5                	mov    %esp,%ebp
+  8008d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008d9:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008dd:	eb 03                	jmp    8008e2 <strchr+0xf>
+  8008df:	83 c0 01             	add    $0x1,%eax
+  8008e2:	0f b6 10             	movzbl (%eax),%edx
+  8008e5:	84 d2                	test   %dl,%dl
+  8008e7:	74 06                	je     8008ef <strchr+0x1c>
+		if (*s == c)
+  8008e9:	38 ca                	cmp    %cl,%dl
+  8008eb:	75 f2                	jne    8008df <strchr+0xc>
+  8008ed:	eb 05                	jmp    8008f4 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8008ef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008f4:	5d                   	pop    %ebp
+  8008f5:	c3                   	ret
+
+008008f6 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8008f6:	55                   	push   %ebp
+  8008f7:	89 e5                	mov    %esp,%ebp
+  8008f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008fc:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800900:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800903:	38 ca                	cmp    %cl,%dl
+  800905:	74 09                	je     800910 <strfind+0x1a>
+  800907:	84 d2                	test   %dl,%dl
+  800909:	74 05                	je     800910 <strfind+0x1a>
+	for (; *s; s++)
+  80090b:	83 c0 01             	add    $0x1,%eax
+  80090e:	eb f0                	jmp    800900 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800910:	5d                   	pop    %ebp
+  800911:	c3                   	ret
+
+00800912 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800912:	55                   	push   %ebp
+  800913:	89 e5                	mov    %esp,%ebp
+  800915:	57                   	push   %edi
+  800916:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800919:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  80091c:	85 c9                	test   %ecx,%ecx
+  80091e:	74 20                	je     800940 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800920:	89 f8                	mov    %edi,%eax
+  800922:	09 c8                	or     %ecx,%eax
+  800924:	a8 03                	test   $0x3,%al
+  800926:	75 12                	jne    80093a <memset+0x28>
+		c &= 0xFF;
+  800928:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80092c:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800932:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800935:	fc                   	cld
+  800936:	f3 ab                	rep stos %eax,%es:(%edi)
+  800938:	eb 06                	jmp    800940 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80093a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80093d:	fc                   	cld
+  80093e:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800940:	89 f8                	mov    %edi,%eax
+  800942:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800945:	c9                   	leave
+  800946:	c3                   	ret
+
+00800947 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800947:	55                   	push   %ebp
+  800948:	89 e5                	mov    %esp,%ebp
+  80094a:	57                   	push   %edi
+  80094b:	56                   	push   %esi
+  80094c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80094f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800952:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800955:	39 c6                	cmp    %eax,%esi
+  800957:	73 32                	jae    80098b <memmove+0x44>
+  800959:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80095c:	39 d0                	cmp    %edx,%eax
+  80095e:	73 2b                	jae    80098b <memmove+0x44>
+		s += n;
+		d += n;
+  800960:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800963:	89 d6                	mov    %edx,%esi
+  800965:	09 fe                	or     %edi,%esi
+  800967:	09 ce                	or     %ecx,%esi
+  800969:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  80096f:	75 0e                	jne    80097f <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800971:	83 ef 04             	sub    $0x4,%edi
+  800974:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800977:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  80097a:	fd                   	std
+  80097b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80097d:	eb 09                	jmp    800988 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  80097f:	83 ef 01             	sub    $0x1,%edi
+  800982:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800985:	fd                   	std
+  800986:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800988:	fc                   	cld
+  800989:	eb 1a                	jmp    8009a5 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80098b:	89 f2                	mov    %esi,%edx
+  80098d:	09 c2                	or     %eax,%edx
+  80098f:	09 ca                	or     %ecx,%edx
+  800991:	f6 c2 03             	test   $0x3,%dl
+  800994:	75 0a                	jne    8009a0 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800996:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800999:	89 c7                	mov    %eax,%edi
+  80099b:	fc                   	cld
+  80099c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80099e:	eb 05                	jmp    8009a5 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8009a0:	89 c7                	mov    %eax,%edi
+  8009a2:	fc                   	cld
+  8009a3:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8009a5:	5e                   	pop    %esi
+  8009a6:	5f                   	pop    %edi
+  8009a7:	5d                   	pop    %ebp
+  8009a8:	c3                   	ret
+
+008009a9 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8009a9:	55                   	push   %ebp
+  8009aa:	89 e5                	mov    %esp,%ebp
+  8009ac:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8009af:	ff 75 10             	push   0x10(%ebp)
+  8009b2:	ff 75 0c             	push   0xc(%ebp)
+  8009b5:	ff 75 08             	push   0x8(%ebp)
+  8009b8:	e8 8a ff ff ff       	call   800947 <memmove>
+}
+  8009bd:	c9                   	leave
+  8009be:	c3                   	ret
+
+008009bf <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8009bf:	55                   	push   %ebp
+  8009c0:	89 e5                	mov    %esp,%ebp
+  8009c2:	56                   	push   %esi
+  8009c3:	53                   	push   %ebx
+  8009c4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009c7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8009ca:	89 c6                	mov    %eax,%esi
+  8009cc:	03 75 10             	add    0x10(%ebp),%esi
+  8009cf:	eb 06                	jmp    8009d7 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8009d1:	83 c0 01             	add    $0x1,%eax
+  8009d4:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  8009d7:	39 f0                	cmp    %esi,%eax
+  8009d9:	74 14                	je     8009ef <memcmp+0x30>
+		if (*s1 != *s2)
+  8009db:	0f b6 08             	movzbl (%eax),%ecx
+  8009de:	0f b6 1a             	movzbl (%edx),%ebx
+  8009e1:	38 d9                	cmp    %bl,%cl
+  8009e3:	74 ec                	je     8009d1 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  8009e5:	0f b6 c1             	movzbl %cl,%eax
+  8009e8:	0f b6 db             	movzbl %bl,%ebx
+  8009eb:	29 d8                	sub    %ebx,%eax
+  8009ed:	eb 05                	jmp    8009f4 <memcmp+0x35>
+	}
+
+	return 0;
+  8009ef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009f4:	5b                   	pop    %ebx
+  8009f5:	5e                   	pop    %esi
+  8009f6:	5d                   	pop    %ebp
+  8009f7:	c3                   	ret
+
+008009f8 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8009f8:	55                   	push   %ebp
+  8009f9:	89 e5                	mov    %esp,%ebp
+  8009fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009fe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a01:	89 c2                	mov    %eax,%edx
+  800a03:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a06:	eb 03                	jmp    800a0b <memfind+0x13>
+  800a08:	83 c0 01             	add    $0x1,%eax
+  800a0b:	39 d0                	cmp    %edx,%eax
+  800a0d:	73 04                	jae    800a13 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a0f:	38 08                	cmp    %cl,(%eax)
+  800a11:	75 f5                	jne    800a08 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a13:	5d                   	pop    %ebp
+  800a14:	c3                   	ret
+
+00800a15 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a15:	55                   	push   %ebp
+  800a16:	89 e5                	mov    %esp,%ebp
+  800a18:	57                   	push   %edi
+  800a19:	56                   	push   %esi
+  800a1a:	53                   	push   %ebx
+  800a1b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a1e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a21:	eb 03                	jmp    800a26 <strtol+0x11>
+		s++;
+  800a23:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a26:	0f b6 02             	movzbl (%edx),%eax
+  800a29:	3c 20                	cmp    $0x20,%al
+  800a2b:	74 f6                	je     800a23 <strtol+0xe>
+  800a2d:	3c 09                	cmp    $0x9,%al
+  800a2f:	74 f2                	je     800a23 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a31:	3c 2b                	cmp    $0x2b,%al
+  800a33:	74 2a                	je     800a5f <strtol+0x4a>
+	int neg = 0;
+  800a35:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a3a:	3c 2d                	cmp    $0x2d,%al
+  800a3c:	74 2b                	je     800a69 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a3e:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a44:	75 0f                	jne    800a55 <strtol+0x40>
+  800a46:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a49:	74 28                	je     800a73 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a4b:	85 db                	test   %ebx,%ebx
+  800a4d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a52:	0f 44 d8             	cmove  %eax,%ebx
+  800a55:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a5a:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a5d:	eb 46                	jmp    800aa5 <strtol+0x90>
+		s++;
+  800a5f:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a62:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a67:	eb d5                	jmp    800a3e <strtol+0x29>
+		s++, neg = 1;
+  800a69:	83 c2 01             	add    $0x1,%edx
+  800a6c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a71:	eb cb                	jmp    800a3e <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a73:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a77:	74 0e                	je     800a87 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a79:	85 db                	test   %ebx,%ebx
+  800a7b:	75 d8                	jne    800a55 <strtol+0x40>
+		s++, base = 8;
+  800a7d:	83 c2 01             	add    $0x1,%edx
+  800a80:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a85:	eb ce                	jmp    800a55 <strtol+0x40>
+		s += 2, base = 16;
+  800a87:	83 c2 02             	add    $0x2,%edx
+  800a8a:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a8f:	eb c4                	jmp    800a55 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a91:	0f be c0             	movsbl %al,%eax
+  800a94:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a97:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a9a:	7d 3a                	jge    800ad6 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a9c:	83 c2 01             	add    $0x1,%edx
+  800a9f:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800aa3:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800aa5:	0f b6 02             	movzbl (%edx),%eax
+  800aa8:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800aab:	89 f3                	mov    %esi,%ebx
+  800aad:	80 fb 09             	cmp    $0x9,%bl
+  800ab0:	76 df                	jbe    800a91 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800ab2:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800ab5:	89 f3                	mov    %esi,%ebx
+  800ab7:	80 fb 19             	cmp    $0x19,%bl
+  800aba:	77 08                	ja     800ac4 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800abc:	0f be c0             	movsbl %al,%eax
+  800abf:	83 e8 57             	sub    $0x57,%eax
+  800ac2:	eb d3                	jmp    800a97 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800ac4:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800ac7:	89 f3                	mov    %esi,%ebx
+  800ac9:	80 fb 19             	cmp    $0x19,%bl
+  800acc:	77 08                	ja     800ad6 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800ace:	0f be c0             	movsbl %al,%eax
+  800ad1:	83 e8 37             	sub    $0x37,%eax
+  800ad4:	eb c1                	jmp    800a97 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800ad6:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800ada:	74 05                	je     800ae1 <strtol+0xcc>
+		*endptr = (char *) s;
+  800adc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800adf:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800ae1:	89 c8                	mov    %ecx,%eax
+  800ae3:	f7 d8                	neg    %eax
+  800ae5:	85 ff                	test   %edi,%edi
+  800ae7:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800aea:	89 c8                	mov    %ecx,%eax
+  800aec:	5b                   	pop    %ebx
+  800aed:	5e                   	pop    %esi
+  800aee:	5f                   	pop    %edi
+  800aef:	5d                   	pop    %ebp
+  800af0:	c3                   	ret
+
+00800af1 <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800af1:	55                   	push   %ebp
+  800af2:	89 e5                	mov    %esp,%ebp
+  800af4:	57                   	push   %edi
+  800af5:	56                   	push   %esi
+  800af6:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800af7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800afc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800aff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b02:	89 c3                	mov    %eax,%ebx
+  800b04:	89 c7                	mov    %eax,%edi
+  800b06:	89 c6                	mov    %eax,%esi
+  800b08:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  800b0a:	5b                   	pop    %ebx
+  800b0b:	5e                   	pop    %esi
+  800b0c:	5f                   	pop    %edi
+  800b0d:	5d                   	pop    %ebp
+  800b0e:	c3                   	ret
+
+00800b0f <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800b0f:	55                   	push   %ebp
+  800b10:	89 e5                	mov    %esp,%ebp
+  800b12:	57                   	push   %edi
+  800b13:	56                   	push   %esi
+  800b14:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800b15:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b1a:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b1f:	89 d1                	mov    %edx,%ecx
+  800b21:	89 d3                	mov    %edx,%ebx
+  800b23:	89 d7                	mov    %edx,%edi
+  800b25:	89 d6                	mov    %edx,%esi
+  800b27:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800b29:	5b                   	pop    %ebx
+  800b2a:	5e                   	pop    %esi
+  800b2b:	5f                   	pop    %edi
+  800b2c:	5d                   	pop    %ebp
+  800b2d:	c3                   	ret
+
+00800b2e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800b2e:	55                   	push   %ebp
+  800b2f:	89 e5                	mov    %esp,%ebp
+  800b31:	57                   	push   %edi
+  800b32:	56                   	push   %esi
+  800b33:	53                   	push   %ebx
+  800b34:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800b37:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b3c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b3f:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b44:	89 cb                	mov    %ecx,%ebx
+  800b46:	89 cf                	mov    %ecx,%edi
+  800b48:	89 ce                	mov    %ecx,%esi
+  800b4a:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800b4c:	85 c0                	test   %eax,%eax
+  800b4e:	7f 08                	jg     800b58 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800b50:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b53:	5b                   	pop    %ebx
+  800b54:	5e                   	pop    %esi
+  800b55:	5f                   	pop    %edi
+  800b56:	5d                   	pop    %ebp
+  800b57:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800b58:	83 ec 0c             	sub    $0xc,%esp
+  800b5b:	50                   	push   %eax
+  800b5c:	6a 03                	push   $0x3
+  800b5e:	68 c3 29 80 00       	push   $0x8029c3
+  800b63:	6a 3e                	push   $0x3e
+  800b65:	68 e0 29 80 00       	push   $0x8029e0
+  800b6a:	e8 be f5 ff ff       	call   80012d <_panic>
+
+00800b6f <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800b6f:	55                   	push   %ebp
+  800b70:	89 e5                	mov    %esp,%ebp
+  800b72:	57                   	push   %edi
+  800b73:	56                   	push   %esi
+  800b74:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800b75:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b7a:	b8 02 00 00 00       	mov    $0x2,%eax
+  800b7f:	89 d1                	mov    %edx,%ecx
+  800b81:	89 d3                	mov    %edx,%ebx
+  800b83:	89 d7                	mov    %edx,%edi
+  800b85:	89 d6                	mov    %edx,%esi
+  800b87:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800b89:	5b                   	pop    %ebx
+  800b8a:	5e                   	pop    %esi
+  800b8b:	5f                   	pop    %edi
+  800b8c:	5d                   	pop    %ebp
+  800b8d:	c3                   	ret
+
+00800b8e <sys_yield>:
+
+void
+sys_yield(void) {
+  800b8e:	55                   	push   %ebp
+  800b8f:	89 e5                	mov    %esp,%ebp
+  800b91:	57                   	push   %edi
+  800b92:	56                   	push   %esi
+  800b93:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800b94:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b99:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800b9e:	89 d1                	mov    %edx,%ecx
+  800ba0:	89 d3                	mov    %edx,%ebx
+  800ba2:	89 d7                	mov    %edx,%edi
+  800ba4:	89 d6                	mov    %edx,%esi
+  800ba6:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800ba8:	5b                   	pop    %ebx
+  800ba9:	5e                   	pop    %esi
+  800baa:	5f                   	pop    %edi
+  800bab:	5d                   	pop    %ebp
+  800bac:	c3                   	ret
+
+00800bad <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  800bad:	55                   	push   %ebp
+  800bae:	89 e5                	mov    %esp,%ebp
+  800bb0:	57                   	push   %edi
+  800bb1:	56                   	push   %esi
+  800bb2:	53                   	push   %ebx
+  800bb3:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800bb6:	be 00 00 00 00       	mov    $0x0,%esi
+  800bbb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bbe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bc1:	b8 04 00 00 00       	mov    $0x4,%eax
+  800bc6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bc9:	89 f7                	mov    %esi,%edi
+  800bcb:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800bcd:	85 c0                	test   %eax,%eax
+  800bcf:	7f 08                	jg     800bd9 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800bd1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bd4:	5b                   	pop    %ebx
+  800bd5:	5e                   	pop    %esi
+  800bd6:	5f                   	pop    %edi
+  800bd7:	5d                   	pop    %ebp
+  800bd8:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800bd9:	83 ec 0c             	sub    $0xc,%esp
+  800bdc:	50                   	push   %eax
+  800bdd:	6a 04                	push   $0x4
+  800bdf:	68 c3 29 80 00       	push   $0x8029c3
+  800be4:	6a 3e                	push   $0x3e
+  800be6:	68 e0 29 80 00       	push   $0x8029e0
+  800beb:	e8 3d f5 ff ff       	call   80012d <_panic>
+
+00800bf0 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  800bf0:	55                   	push   %ebp
+  800bf1:	89 e5                	mov    %esp,%ebp
+  800bf3:	57                   	push   %edi
+  800bf4:	56                   	push   %esi
+  800bf5:	53                   	push   %ebx
+  800bf6:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800bf9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bfc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bff:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c04:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c07:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c0a:	8b 75 18             	mov    0x18(%ebp),%esi
+  800c0d:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c0f:	85 c0                	test   %eax,%eax
+  800c11:	7f 08                	jg     800c1b <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800c13:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c16:	5b                   	pop    %ebx
+  800c17:	5e                   	pop    %esi
+  800c18:	5f                   	pop    %edi
+  800c19:	5d                   	pop    %ebp
+  800c1a:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c1b:	83 ec 0c             	sub    $0xc,%esp
+  800c1e:	50                   	push   %eax
+  800c1f:	6a 05                	push   $0x5
+  800c21:	68 c3 29 80 00       	push   $0x8029c3
+  800c26:	6a 3e                	push   $0x3e
+  800c28:	68 e0 29 80 00       	push   $0x8029e0
+  800c2d:	e8 fb f4 ff ff       	call   80012d <_panic>
+
+00800c32 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  800c32:	55                   	push   %ebp
+  800c33:	89 e5                	mov    %esp,%ebp
+  800c35:	57                   	push   %edi
+  800c36:	56                   	push   %esi
+  800c37:	53                   	push   %ebx
+  800c38:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c3b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c40:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c43:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c46:	b8 06 00 00 00       	mov    $0x6,%eax
+  800c4b:	89 df                	mov    %ebx,%edi
+  800c4d:	89 de                	mov    %ebx,%esi
+  800c4f:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c51:	85 c0                	test   %eax,%eax
+  800c53:	7f 08                	jg     800c5d <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800c55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c58:	5b                   	pop    %ebx
+  800c59:	5e                   	pop    %esi
+  800c5a:	5f                   	pop    %edi
+  800c5b:	5d                   	pop    %ebp
+  800c5c:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c5d:	83 ec 0c             	sub    $0xc,%esp
+  800c60:	50                   	push   %eax
+  800c61:	6a 06                	push   $0x6
+  800c63:	68 c3 29 80 00       	push   $0x8029c3
+  800c68:	6a 3e                	push   $0x3e
+  800c6a:	68 e0 29 80 00       	push   $0x8029e0
+  800c6f:	e8 b9 f4 ff ff       	call   80012d <_panic>
+
+00800c74 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800c74:	55                   	push   %ebp
+  800c75:	89 e5                	mov    %esp,%ebp
+  800c77:	57                   	push   %edi
+  800c78:	56                   	push   %esi
+  800c79:	53                   	push   %ebx
+  800c7a:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c7d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c82:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c85:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c88:	b8 08 00 00 00       	mov    $0x8,%eax
+  800c8d:	89 df                	mov    %ebx,%edi
+  800c8f:	89 de                	mov    %ebx,%esi
+  800c91:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c93:	85 c0                	test   %eax,%eax
+  800c95:	7f 08                	jg     800c9f <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800c97:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c9a:	5b                   	pop    %ebx
+  800c9b:	5e                   	pop    %esi
+  800c9c:	5f                   	pop    %edi
+  800c9d:	5d                   	pop    %ebp
+  800c9e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c9f:	83 ec 0c             	sub    $0xc,%esp
+  800ca2:	50                   	push   %eax
+  800ca3:	6a 08                	push   $0x8
+  800ca5:	68 c3 29 80 00       	push   $0x8029c3
+  800caa:	6a 3e                	push   $0x3e
+  800cac:	68 e0 29 80 00       	push   $0x8029e0
+  800cb1:	e8 77 f4 ff ff       	call   80012d <_panic>
+
+00800cb6 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800cb6:	55                   	push   %ebp
+  800cb7:	89 e5                	mov    %esp,%ebp
+  800cb9:	57                   	push   %edi
+  800cba:	56                   	push   %esi
+  800cbb:	53                   	push   %ebx
+  800cbc:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800cbf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cc4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cc7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cca:	b8 09 00 00 00       	mov    $0x9,%eax
+  800ccf:	89 df                	mov    %ebx,%edi
+  800cd1:	89 de                	mov    %ebx,%esi
+  800cd3:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800cd5:	85 c0                	test   %eax,%eax
+  800cd7:	7f 08                	jg     800ce1 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800cd9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cdc:	5b                   	pop    %ebx
+  800cdd:	5e                   	pop    %esi
+  800cde:	5f                   	pop    %edi
+  800cdf:	5d                   	pop    %ebp
+  800ce0:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ce1:	83 ec 0c             	sub    $0xc,%esp
+  800ce4:	50                   	push   %eax
+  800ce5:	6a 09                	push   $0x9
+  800ce7:	68 c3 29 80 00       	push   $0x8029c3
+  800cec:	6a 3e                	push   $0x3e
+  800cee:	68 e0 29 80 00       	push   $0x8029e0
+  800cf3:	e8 35 f4 ff ff       	call   80012d <_panic>
+
+00800cf8 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800cf8:	55                   	push   %ebp
+  800cf9:	89 e5                	mov    %esp,%ebp
+  800cfb:	57                   	push   %edi
+  800cfc:	56                   	push   %esi
+  800cfd:	53                   	push   %ebx
+  800cfe:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800d01:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d06:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d09:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d0c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d11:	89 df                	mov    %ebx,%edi
+  800d13:	89 de                	mov    %ebx,%esi
+  800d15:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d17:	85 c0                	test   %eax,%eax
+  800d19:	7f 08                	jg     800d23 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800d1b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d1e:	5b                   	pop    %ebx
+  800d1f:	5e                   	pop    %esi
+  800d20:	5f                   	pop    %edi
+  800d21:	5d                   	pop    %ebp
+  800d22:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d23:	83 ec 0c             	sub    $0xc,%esp
+  800d26:	50                   	push   %eax
+  800d27:	6a 0a                	push   $0xa
+  800d29:	68 c3 29 80 00       	push   $0x8029c3
+  800d2e:	6a 3e                	push   $0x3e
+  800d30:	68 e0 29 80 00       	push   $0x8029e0
+  800d35:	e8 f3 f3 ff ff       	call   80012d <_panic>
+
+00800d3a <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  800d3a:	55                   	push   %ebp
+  800d3b:	89 e5                	mov    %esp,%ebp
+  800d3d:	57                   	push   %edi
+  800d3e:	56                   	push   %esi
+  800d3f:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d40:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d43:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d46:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800d4b:	be 00 00 00 00       	mov    $0x0,%esi
+  800d50:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d53:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d56:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800d58:	5b                   	pop    %ebx
+  800d59:	5e                   	pop    %esi
+  800d5a:	5f                   	pop    %edi
+  800d5b:	5d                   	pop    %ebp
+  800d5c:	c3                   	ret
+
+00800d5d <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  800d5d:	55                   	push   %ebp
+  800d5e:	89 e5                	mov    %esp,%ebp
+  800d60:	57                   	push   %edi
+  800d61:	56                   	push   %esi
+  800d62:	53                   	push   %ebx
+  800d63:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800d66:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d6b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d6e:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800d73:	89 cb                	mov    %ecx,%ebx
+  800d75:	89 cf                	mov    %ecx,%edi
+  800d77:	89 ce                	mov    %ecx,%esi
+  800d79:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d7b:	85 c0                	test   %eax,%eax
+  800d7d:	7f 08                	jg     800d87 <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  800d7f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d82:	5b                   	pop    %ebx
+  800d83:	5e                   	pop    %esi
+  800d84:	5f                   	pop    %edi
+  800d85:	5d                   	pop    %ebp
+  800d86:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d87:	83 ec 0c             	sub    $0xc,%esp
+  800d8a:	50                   	push   %eax
+  800d8b:	6a 0d                	push   $0xd
+  800d8d:	68 c3 29 80 00       	push   $0x8029c3
+  800d92:	6a 3e                	push   $0x3e
+  800d94:	68 e0 29 80 00       	push   $0x8029e0
+  800d99:	e8 8f f3 ff ff       	call   80012d <_panic>
+
+00800d9e <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  800d9e:	55                   	push   %ebp
+  800d9f:	89 e5                	mov    %esp,%ebp
+  800da1:	57                   	push   %edi
+  800da2:	56                   	push   %esi
+  800da3:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800da4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800da9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800daf:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800db4:	89 df                	mov    %ebx,%edi
+  800db6:	89 de                	mov    %ebx,%esi
+  800db8:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  800dba:	5b                   	pop    %ebx
+  800dbb:	5e                   	pop    %esi
+  800dbc:	5f                   	pop    %edi
+  800dbd:	5d                   	pop    %ebp
+  800dbe:	c3                   	ret
+
+00800dbf <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  800dbf:	55                   	push   %ebp
+  800dc0:	89 e5                	mov    %esp,%ebp
+  800dc2:	57                   	push   %edi
+  800dc3:	56                   	push   %esi
+  800dc4:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800dc5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dca:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dcd:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800dd2:	89 cb                	mov    %ecx,%ebx
+  800dd4:	89 cf                	mov    %ecx,%edi
+  800dd6:	89 ce                	mov    %ecx,%esi
+  800dd8:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  800dda:	5b                   	pop    %ebx
+  800ddb:	5e                   	pop    %esi
+  800ddc:	5f                   	pop    %edi
+  800ddd:	5d                   	pop    %ebp
+  800dde:	c3                   	ret
+
+00800ddf <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  800ddf:	55                   	push   %ebp
+  800de0:	89 e5                	mov    %esp,%ebp
+  800de2:	57                   	push   %edi
+  800de3:	56                   	push   %esi
+  800de4:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800de5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dea:	b8 10 00 00 00       	mov    $0x10,%eax
+  800def:	89 d1                	mov    %edx,%ecx
+  800df1:	89 d3                	mov    %edx,%ebx
+  800df3:	89 d7                	mov    %edx,%edi
+  800df5:	89 d6                	mov    %edx,%esi
+  800df7:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800df9:	5b                   	pop    %ebx
+  800dfa:	5e                   	pop    %esi
+  800dfb:	5f                   	pop    %edi
+  800dfc:	5d                   	pop    %ebp
+  800dfd:	c3                   	ret
+
+00800dfe <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  800dfe:	55                   	push   %ebp
+  800dff:	89 e5                	mov    %esp,%ebp
+  800e01:	57                   	push   %edi
+  800e02:	56                   	push   %esi
+  800e03:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e04:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e09:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e0c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e0f:	b8 11 00 00 00       	mov    $0x11,%eax
+  800e14:	89 df                	mov    %ebx,%edi
+  800e16:	89 de                	mov    %ebx,%esi
+  800e18:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800e1a:	5b                   	pop    %ebx
+  800e1b:	5e                   	pop    %esi
+  800e1c:	5f                   	pop    %edi
+  800e1d:	5d                   	pop    %ebp
+  800e1e:	c3                   	ret
+
+00800e1f <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  800e1f:	55                   	push   %ebp
+  800e20:	89 e5                	mov    %esp,%ebp
+  800e22:	57                   	push   %edi
+  800e23:	56                   	push   %esi
+  800e24:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e25:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e2a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e2d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e30:	b8 12 00 00 00       	mov    $0x12,%eax
+  800e35:	89 df                	mov    %ebx,%edi
+  800e37:	89 de                	mov    %ebx,%esi
+  800e39:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800e3b:	5b                   	pop    %ebx
+  800e3c:	5e                   	pop    %esi
+  800e3d:	5f                   	pop    %edi
+  800e3e:	5d                   	pop    %ebp
+  800e3f:	c3                   	ret
+
+00800e40 <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  800e40:	55                   	push   %ebp
+  800e41:	89 e5                	mov    %esp,%ebp
+  800e43:	57                   	push   %edi
+  800e44:	56                   	push   %esi
+  800e45:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e46:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e4b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e4e:	b8 13 00 00 00       	mov    $0x13,%eax
+  800e53:	89 cb                	mov    %ecx,%ebx
+  800e55:	89 cf                	mov    %ecx,%edi
+  800e57:	89 ce                	mov    %ecx,%esi
+  800e59:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  800e5b:	5b                   	pop    %ebx
+  800e5c:	5e                   	pop    %esi
+  800e5d:	5f                   	pop    %edi
+  800e5e:	5d                   	pop    %ebp
+  800e5f:	c3                   	ret
+
+00800e60 <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  800e60:	55                   	push   %ebp
+  800e61:	89 e5                	mov    %esp,%ebp
+  800e63:	57                   	push   %edi
+  800e64:	56                   	push   %esi
+  800e65:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e66:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e6b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e6e:	b8 14 00 00 00       	mov    $0x14,%eax
+  800e73:	89 cb                	mov    %ecx,%ebx
+  800e75:	89 cf                	mov    %ecx,%edi
+  800e77:	89 ce                	mov    %ecx,%esi
+  800e79:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  800e7b:	5b                   	pop    %ebx
+  800e7c:	5e                   	pop    %esi
+  800e7d:	5f                   	pop    %edi
+  800e7e:	5d                   	pop    %ebp
+  800e7f:	c3                   	ret
+
+00800e80 <set_pgfault_handler>:
+// allocate an exception stack (one page of memory with its top
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf)) {
+  800e80:	55                   	push   %ebp
+  800e81:	89 e5                	mov    %esp,%ebp
+  800e83:	83 ec 08             	sub    $0x8,%esp
+  int r;
+
+  if (_pgfault_handler == 0) {
+  800e86:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  800e8d:	74 0a                	je     800e99 <set_pgfault_handler+0x19>
+    if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)))
+      panic(" set_pgfault_handler sys_env_set_pgfault_upcall panic: %e\n", r);
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  800e8f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e92:	a3 0c 40 80 00       	mov    %eax,0x80400c
+
+
+}
+  800e97:	c9                   	leave
+  800e98:	c3                   	ret
+    if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)))
+  800e99:	83 ec 04             	sub    $0x4,%esp
+  800e9c:	6a 07                	push   $0x7
+  800e9e:	68 00 f0 bf ee       	push   $0xeebff000
+  800ea3:	6a 00                	push   $0x0
+  800ea5:	e8 03 fd ff ff       	call   800bad <sys_page_alloc>
+  800eaa:	83 c4 10             	add    $0x10,%esp
+  800ead:	85 c0                	test   %eax,%eax
+  800eaf:	75 28                	jne    800ed9 <set_pgfault_handler+0x59>
+    if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)))
+  800eb1:	83 ec 08             	sub    $0x8,%esp
+  800eb4:	68 eb 0e 80 00       	push   $0x800eeb
+  800eb9:	6a 00                	push   $0x0
+  800ebb:	e8 38 fe ff ff       	call   800cf8 <sys_env_set_pgfault_upcall>
+  800ec0:	83 c4 10             	add    $0x10,%esp
+  800ec3:	85 c0                	test   %eax,%eax
+  800ec5:	74 c8                	je     800e8f <set_pgfault_handler+0xf>
+      panic(" set_pgfault_handler sys_env_set_pgfault_upcall panic: %e\n", r);
+  800ec7:	50                   	push   %eax
+  800ec8:	68 20 2a 80 00       	push   $0x802a20
+  800ecd:	6a 22                	push   $0x22
+  800ecf:	68 5b 2a 80 00       	push   $0x802a5b
+  800ed4:	e8 54 f2 ff ff       	call   80012d <_panic>
+      panic("set_pgfault_handler sys_page_alloc panic: %e\n", r);
+  800ed9:	50                   	push   %eax
+  800eda:	68 f0 29 80 00       	push   $0x8029f0
+  800edf:	6a 20                	push   $0x20
+  800ee1:	68 5b 2a 80 00       	push   $0x802a5b
+  800ee6:	e8 42 f2 ff ff       	call   80012d <_panic>
+
+00800eeb <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  800eeb:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  800eec:	a1 0c 40 80 00       	mov    0x80400c,%eax
+	call *%eax
+  800ef1:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  800ef3:	83 c4 04             	add    $0x4,%esp
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	// push the trap-time %eip onto the trap-time stack
+    subl $0x4, 0x30(%esp) # for push eip
+  800ef6:	83 6c 24 30 04       	subl   $0x4,0x30(%esp)
+    movl 0x30(%esp), %ebx #regular esp
+  800efb:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+    movl 0x28(%esp), %eax #eip
+  800eff:	8b 44 24 28          	mov    0x28(%esp),%eax
+    movl %eax, (%ebx)
+  800f03:	89 03                	mov    %eax,(%ebx)
+
+    // Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+    addl $8, %esp
+  800f05:	83 c4 08             	add    $0x8,%esp
+    popal
+  800f08:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  800f09:	83 c4 04             	add    $0x4,%esp
+	popfl
+  800f0c:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  800f0d:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  800f0e:	c3                   	ret
+
+00800f0f <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800f0f:	55                   	push   %ebp
+  800f10:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800f12:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f15:	05 00 00 00 30       	add    $0x30000000,%eax
+  800f1a:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800f1d:	5d                   	pop    %ebp
+  800f1e:	c3                   	ret
+
+00800f1f <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800f1f:	55                   	push   %ebp
+  800f20:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800f22:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f25:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800f2a:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800f2f:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800f34:	5d                   	pop    %ebp
+  800f35:	c3                   	ret
+
+00800f36 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800f36:	55                   	push   %ebp
+  800f37:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  800f39:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800f3e:	eb 02                	jmp    800f42 <fd_alloc+0xc>
+  800f40:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800f42:	89 c2                	mov    %eax,%edx
+  800f44:	c1 ea 16             	shr    $0x16,%edx
+  800f47:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800f4e:	f6 c2 01             	test   $0x1,%dl
+  800f51:	74 2b                	je     800f7e <fd_alloc+0x48>
+  800f53:	89 c2                	mov    %eax,%edx
+  800f55:	c1 ea 0c             	shr    $0xc,%edx
+  800f58:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  800f5f:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  800f65:	f6 c1 01             	test   $0x1,%cl
+  800f68:	74 14                	je     800f7e <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  800f6a:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  800f70:	75 ce                	jne    800f40 <fd_alloc+0xa>
+  800f72:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  800f77:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800f7c:	eb 05                	jmp    800f83 <fd_alloc+0x4d>
+			return 0;
+  800f7e:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  800f83:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f86:	89 02                	mov    %eax,(%edx)
+}
+  800f88:	89 c8                	mov    %ecx,%eax
+  800f8a:	5d                   	pop    %ebp
+  800f8b:	c3                   	ret
+
+00800f8c <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  800f8c:	55                   	push   %ebp
+  800f8d:	89 e5                	mov    %esp,%ebp
+  800f8f:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  800f92:	83 f8 1f             	cmp    $0x1f,%eax
+  800f95:	77 30                	ja     800fc7 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  800f97:	c1 e0 0c             	shl    $0xc,%eax
+  800f9a:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800f9f:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  800fa5:	f6 c2 01             	test   $0x1,%dl
+  800fa8:	74 24                	je     800fce <fd_lookup+0x42>
+  800faa:	89 c2                	mov    %eax,%edx
+  800fac:	c1 ea 0c             	shr    $0xc,%edx
+  800faf:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800fb6:	f6 c2 01             	test   $0x1,%dl
+  800fb9:	74 1a                	je     800fd5 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  800fbb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800fbe:	89 02                	mov    %eax,(%edx)
+	return 0;
+  800fc0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fc5:	5d                   	pop    %ebp
+  800fc6:	c3                   	ret
+		return -E_INVAL;
+  800fc7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800fcc:	eb f7                	jmp    800fc5 <fd_lookup+0x39>
+		return -E_INVAL;
+  800fce:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800fd3:	eb f0                	jmp    800fc5 <fd_lookup+0x39>
+  800fd5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800fda:	eb e9                	jmp    800fc5 <fd_lookup+0x39>
+
+00800fdc <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  800fdc:	55                   	push   %ebp
+  800fdd:	89 e5                	mov    %esp,%ebp
+  800fdf:	53                   	push   %ebx
+  800fe0:	83 ec 04             	sub    $0x4,%esp
+  800fe3:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  800fe6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800feb:	eb 03                	jmp    800ff0 <dev_lookup+0x14>
+  800fed:	83 c0 01             	add    $0x1,%eax
+  800ff0:	8b 1c 85 e8 2a 80 00 	mov    0x802ae8(,%eax,4),%ebx
+  800ff7:	85 db                	test   %ebx,%ebx
+  800ff9:	74 0b                	je     801006 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  800ffb:	39 13                	cmp    %edx,(%ebx)
+  800ffd:	75 ee                	jne    800fed <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  800fff:	b8 00 00 00 00       	mov    $0x0,%eax
+  801004:	eb 1f                	jmp    801025 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801006:	a1 08 40 80 00       	mov    0x804008,%eax
+  80100b:	8b 40 48             	mov    0x48(%eax),%eax
+  80100e:	83 ec 04             	sub    $0x4,%esp
+  801011:	52                   	push   %edx
+  801012:	50                   	push   %eax
+  801013:	68 6c 2a 80 00       	push   $0x802a6c
+  801018:	e8 eb f1 ff ff       	call   800208 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80101d:	83 c4 10             	add    $0x10,%esp
+  801020:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801025:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801028:	89 1a                	mov    %ebx,(%edx)
+}
+  80102a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80102d:	c9                   	leave
+  80102e:	c3                   	ret
+
+0080102f <fd_close>:
+{
+  80102f:	55                   	push   %ebp
+  801030:	89 e5                	mov    %esp,%ebp
+  801032:	57                   	push   %edi
+  801033:	56                   	push   %esi
+  801034:	53                   	push   %ebx
+  801035:	83 ec 24             	sub    $0x24,%esp
+  801038:	8b 75 08             	mov    0x8(%ebp),%esi
+  80103b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80103e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801041:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801042:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801048:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80104b:	50                   	push   %eax
+  80104c:	e8 3b ff ff ff       	call   800f8c <fd_lookup>
+  801051:	89 c3                	mov    %eax,%ebx
+  801053:	83 c4 10             	add    $0x10,%esp
+  801056:	85 c0                	test   %eax,%eax
+  801058:	78 05                	js     80105f <fd_close+0x30>
+	    || fd != fd2)
+  80105a:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80105d:	74 16                	je     801075 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80105f:	89 f8                	mov    %edi,%eax
+  801061:	84 c0                	test   %al,%al
+  801063:	b8 00 00 00 00       	mov    $0x0,%eax
+  801068:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80106b:	89 d8                	mov    %ebx,%eax
+  80106d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801070:	5b                   	pop    %ebx
+  801071:	5e                   	pop    %esi
+  801072:	5f                   	pop    %edi
+  801073:	5d                   	pop    %ebp
+  801074:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801075:	83 ec 08             	sub    $0x8,%esp
+  801078:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80107b:	50                   	push   %eax
+  80107c:	ff 36                	push   (%esi)
+  80107e:	e8 59 ff ff ff       	call   800fdc <dev_lookup>
+  801083:	89 c3                	mov    %eax,%ebx
+  801085:	83 c4 10             	add    $0x10,%esp
+  801088:	85 c0                	test   %eax,%eax
+  80108a:	78 1a                	js     8010a6 <fd_close+0x77>
+		if (dev->dev_close)
+  80108c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80108f:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801092:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801097:	85 c0                	test   %eax,%eax
+  801099:	74 0b                	je     8010a6 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80109b:	83 ec 0c             	sub    $0xc,%esp
+  80109e:	56                   	push   %esi
+  80109f:	ff d0                	call   *%eax
+  8010a1:	89 c3                	mov    %eax,%ebx
+  8010a3:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8010a6:	83 ec 08             	sub    $0x8,%esp
+  8010a9:	56                   	push   %esi
+  8010aa:	6a 00                	push   $0x0
+  8010ac:	e8 81 fb ff ff       	call   800c32 <sys_page_unmap>
+	return r;
+  8010b1:	83 c4 10             	add    $0x10,%esp
+  8010b4:	eb b5                	jmp    80106b <fd_close+0x3c>
+
+008010b6 <close>:
+
+int
+close(int fdnum)
+{
+  8010b6:	55                   	push   %ebp
+  8010b7:	89 e5                	mov    %esp,%ebp
+  8010b9:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8010bc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8010bf:	50                   	push   %eax
+  8010c0:	ff 75 08             	push   0x8(%ebp)
+  8010c3:	e8 c4 fe ff ff       	call   800f8c <fd_lookup>
+  8010c8:	83 c4 10             	add    $0x10,%esp
+  8010cb:	85 c0                	test   %eax,%eax
+  8010cd:	79 02                	jns    8010d1 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8010cf:	c9                   	leave
+  8010d0:	c3                   	ret
+		return fd_close(fd, 1);
+  8010d1:	83 ec 08             	sub    $0x8,%esp
+  8010d4:	6a 01                	push   $0x1
+  8010d6:	ff 75 f4             	push   -0xc(%ebp)
+  8010d9:	e8 51 ff ff ff       	call   80102f <fd_close>
+  8010de:	83 c4 10             	add    $0x10,%esp
+  8010e1:	eb ec                	jmp    8010cf <close+0x19>
+
+008010e3 <close_all>:
+
+void
+close_all(void)
+{
+  8010e3:	55                   	push   %ebp
+  8010e4:	89 e5                	mov    %esp,%ebp
+  8010e6:	53                   	push   %ebx
+  8010e7:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8010ea:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8010ef:	83 ec 0c             	sub    $0xc,%esp
+  8010f2:	53                   	push   %ebx
+  8010f3:	e8 be ff ff ff       	call   8010b6 <close>
+	for (i = 0; i < MAXFD; i++)
+  8010f8:	83 c3 01             	add    $0x1,%ebx
+  8010fb:	83 c4 10             	add    $0x10,%esp
+  8010fe:	83 fb 20             	cmp    $0x20,%ebx
+  801101:	75 ec                	jne    8010ef <close_all+0xc>
+}
+  801103:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801106:	c9                   	leave
+  801107:	c3                   	ret
+
+00801108 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801108:	55                   	push   %ebp
+  801109:	89 e5                	mov    %esp,%ebp
+  80110b:	57                   	push   %edi
+  80110c:	56                   	push   %esi
+  80110d:	53                   	push   %ebx
+  80110e:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801111:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801114:	50                   	push   %eax
+  801115:	ff 75 08             	push   0x8(%ebp)
+  801118:	e8 6f fe ff ff       	call   800f8c <fd_lookup>
+  80111d:	89 c3                	mov    %eax,%ebx
+  80111f:	83 c4 10             	add    $0x10,%esp
+  801122:	85 c0                	test   %eax,%eax
+  801124:	78 7f                	js     8011a5 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801126:	83 ec 0c             	sub    $0xc,%esp
+  801129:	ff 75 0c             	push   0xc(%ebp)
+  80112c:	e8 85 ff ff ff       	call   8010b6 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801131:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801134:	c1 e6 0c             	shl    $0xc,%esi
+  801137:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80113d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801140:	89 3c 24             	mov    %edi,(%esp)
+  801143:	e8 d7 fd ff ff       	call   800f1f <fd2data>
+  801148:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80114a:	89 34 24             	mov    %esi,(%esp)
+  80114d:	e8 cd fd ff ff       	call   800f1f <fd2data>
+  801152:	83 c4 10             	add    $0x10,%esp
+  801155:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801158:	89 d8                	mov    %ebx,%eax
+  80115a:	c1 e8 16             	shr    $0x16,%eax
+  80115d:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801164:	a8 01                	test   $0x1,%al
+  801166:	74 11                	je     801179 <dup+0x71>
+  801168:	89 d8                	mov    %ebx,%eax
+  80116a:	c1 e8 0c             	shr    $0xc,%eax
+  80116d:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801174:	f6 c2 01             	test   $0x1,%dl
+  801177:	75 36                	jne    8011af <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801179:	89 f8                	mov    %edi,%eax
+  80117b:	c1 e8 0c             	shr    $0xc,%eax
+  80117e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801185:	83 ec 0c             	sub    $0xc,%esp
+  801188:	25 07 0e 00 00       	and    $0xe07,%eax
+  80118d:	50                   	push   %eax
+  80118e:	56                   	push   %esi
+  80118f:	6a 00                	push   $0x0
+  801191:	57                   	push   %edi
+  801192:	6a 00                	push   $0x0
+  801194:	e8 57 fa ff ff       	call   800bf0 <sys_page_map>
+  801199:	89 c3                	mov    %eax,%ebx
+  80119b:	83 c4 20             	add    $0x20,%esp
+  80119e:	85 c0                	test   %eax,%eax
+  8011a0:	78 33                	js     8011d5 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8011a2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8011a5:	89 d8                	mov    %ebx,%eax
+  8011a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011aa:	5b                   	pop    %ebx
+  8011ab:	5e                   	pop    %esi
+  8011ac:	5f                   	pop    %edi
+  8011ad:	5d                   	pop    %ebp
+  8011ae:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8011af:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8011b6:	83 ec 0c             	sub    $0xc,%esp
+  8011b9:	25 07 0e 00 00       	and    $0xe07,%eax
+  8011be:	50                   	push   %eax
+  8011bf:	ff 75 d4             	push   -0x2c(%ebp)
+  8011c2:	6a 00                	push   $0x0
+  8011c4:	53                   	push   %ebx
+  8011c5:	6a 00                	push   $0x0
+  8011c7:	e8 24 fa ff ff       	call   800bf0 <sys_page_map>
+  8011cc:	89 c3                	mov    %eax,%ebx
+  8011ce:	83 c4 20             	add    $0x20,%esp
+  8011d1:	85 c0                	test   %eax,%eax
+  8011d3:	79 a4                	jns    801179 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8011d5:	83 ec 08             	sub    $0x8,%esp
+  8011d8:	56                   	push   %esi
+  8011d9:	6a 00                	push   $0x0
+  8011db:	e8 52 fa ff ff       	call   800c32 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8011e0:	83 c4 08             	add    $0x8,%esp
+  8011e3:	ff 75 d4             	push   -0x2c(%ebp)
+  8011e6:	6a 00                	push   $0x0
+  8011e8:	e8 45 fa ff ff       	call   800c32 <sys_page_unmap>
+	return r;
+  8011ed:	83 c4 10             	add    $0x10,%esp
+  8011f0:	eb b3                	jmp    8011a5 <dup+0x9d>
+
+008011f2 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8011f2:	55                   	push   %ebp
+  8011f3:	89 e5                	mov    %esp,%ebp
+  8011f5:	56                   	push   %esi
+  8011f6:	53                   	push   %ebx
+  8011f7:	83 ec 18             	sub    $0x18,%esp
+  8011fa:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8011fd:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801200:	50                   	push   %eax
+  801201:	56                   	push   %esi
+  801202:	e8 85 fd ff ff       	call   800f8c <fd_lookup>
+  801207:	83 c4 10             	add    $0x10,%esp
+  80120a:	85 c0                	test   %eax,%eax
+  80120c:	78 3c                	js     80124a <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80120e:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801211:	83 ec 08             	sub    $0x8,%esp
+  801214:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801217:	50                   	push   %eax
+  801218:	ff 33                	push   (%ebx)
+  80121a:	e8 bd fd ff ff       	call   800fdc <dev_lookup>
+  80121f:	83 c4 10             	add    $0x10,%esp
+  801222:	85 c0                	test   %eax,%eax
+  801224:	78 24                	js     80124a <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801226:	8b 43 08             	mov    0x8(%ebx),%eax
+  801229:	83 e0 03             	and    $0x3,%eax
+  80122c:	83 f8 01             	cmp    $0x1,%eax
+  80122f:	74 20                	je     801251 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801231:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801234:	8b 40 08             	mov    0x8(%eax),%eax
+  801237:	85 c0                	test   %eax,%eax
+  801239:	74 37                	je     801272 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80123b:	83 ec 04             	sub    $0x4,%esp
+  80123e:	ff 75 10             	push   0x10(%ebp)
+  801241:	ff 75 0c             	push   0xc(%ebp)
+  801244:	53                   	push   %ebx
+  801245:	ff d0                	call   *%eax
+  801247:	83 c4 10             	add    $0x10,%esp
+}
+  80124a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80124d:	5b                   	pop    %ebx
+  80124e:	5e                   	pop    %esi
+  80124f:	5d                   	pop    %ebp
+  801250:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801251:	a1 08 40 80 00       	mov    0x804008,%eax
+  801256:	8b 40 48             	mov    0x48(%eax),%eax
+  801259:	83 ec 04             	sub    $0x4,%esp
+  80125c:	56                   	push   %esi
+  80125d:	50                   	push   %eax
+  80125e:	68 ad 2a 80 00       	push   $0x802aad
+  801263:	e8 a0 ef ff ff       	call   800208 <cprintf>
+		return -E_INVAL;
+  801268:	83 c4 10             	add    $0x10,%esp
+  80126b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801270:	eb d8                	jmp    80124a <read+0x58>
+		return -E_NOT_SUPP;
+  801272:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801277:	eb d1                	jmp    80124a <read+0x58>
+
+00801279 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801279:	55                   	push   %ebp
+  80127a:	89 e5                	mov    %esp,%ebp
+  80127c:	57                   	push   %edi
+  80127d:	56                   	push   %esi
+  80127e:	53                   	push   %ebx
+  80127f:	83 ec 0c             	sub    $0xc,%esp
+  801282:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801285:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801288:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80128d:	eb 02                	jmp    801291 <readn+0x18>
+  80128f:	01 c3                	add    %eax,%ebx
+  801291:	39 f3                	cmp    %esi,%ebx
+  801293:	73 21                	jae    8012b6 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801295:	83 ec 04             	sub    $0x4,%esp
+  801298:	89 f0                	mov    %esi,%eax
+  80129a:	29 d8                	sub    %ebx,%eax
+  80129c:	50                   	push   %eax
+  80129d:	89 d8                	mov    %ebx,%eax
+  80129f:	03 45 0c             	add    0xc(%ebp),%eax
+  8012a2:	50                   	push   %eax
+  8012a3:	57                   	push   %edi
+  8012a4:	e8 49 ff ff ff       	call   8011f2 <read>
+		if (m < 0)
+  8012a9:	83 c4 10             	add    $0x10,%esp
+  8012ac:	85 c0                	test   %eax,%eax
+  8012ae:	78 04                	js     8012b4 <readn+0x3b>
+			return m;
+		if (m == 0)
+  8012b0:	75 dd                	jne    80128f <readn+0x16>
+  8012b2:	eb 02                	jmp    8012b6 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8012b4:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8012b6:	89 d8                	mov    %ebx,%eax
+  8012b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012bb:	5b                   	pop    %ebx
+  8012bc:	5e                   	pop    %esi
+  8012bd:	5f                   	pop    %edi
+  8012be:	5d                   	pop    %ebp
+  8012bf:	c3                   	ret
+
+008012c0 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8012c0:	55                   	push   %ebp
+  8012c1:	89 e5                	mov    %esp,%ebp
+  8012c3:	56                   	push   %esi
+  8012c4:	53                   	push   %ebx
+  8012c5:	83 ec 18             	sub    $0x18,%esp
+  8012c8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8012cb:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8012ce:	50                   	push   %eax
+  8012cf:	53                   	push   %ebx
+  8012d0:	e8 b7 fc ff ff       	call   800f8c <fd_lookup>
+  8012d5:	83 c4 10             	add    $0x10,%esp
+  8012d8:	85 c0                	test   %eax,%eax
+  8012da:	78 37                	js     801313 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8012dc:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8012df:	83 ec 08             	sub    $0x8,%esp
+  8012e2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8012e5:	50                   	push   %eax
+  8012e6:	ff 36                	push   (%esi)
+  8012e8:	e8 ef fc ff ff       	call   800fdc <dev_lookup>
+  8012ed:	83 c4 10             	add    $0x10,%esp
+  8012f0:	85 c0                	test   %eax,%eax
+  8012f2:	78 1f                	js     801313 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8012f4:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8012f8:	74 20                	je     80131a <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8012fa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8012fd:	8b 40 0c             	mov    0xc(%eax),%eax
+  801300:	85 c0                	test   %eax,%eax
+  801302:	74 37                	je     80133b <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801304:	83 ec 04             	sub    $0x4,%esp
+  801307:	ff 75 10             	push   0x10(%ebp)
+  80130a:	ff 75 0c             	push   0xc(%ebp)
+  80130d:	56                   	push   %esi
+  80130e:	ff d0                	call   *%eax
+  801310:	83 c4 10             	add    $0x10,%esp
+}
+  801313:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801316:	5b                   	pop    %ebx
+  801317:	5e                   	pop    %esi
+  801318:	5d                   	pop    %ebp
+  801319:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80131a:	a1 08 40 80 00       	mov    0x804008,%eax
+  80131f:	8b 40 48             	mov    0x48(%eax),%eax
+  801322:	83 ec 04             	sub    $0x4,%esp
+  801325:	53                   	push   %ebx
+  801326:	50                   	push   %eax
+  801327:	68 c9 2a 80 00       	push   $0x802ac9
+  80132c:	e8 d7 ee ff ff       	call   800208 <cprintf>
+		return -E_INVAL;
+  801331:	83 c4 10             	add    $0x10,%esp
+  801334:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801339:	eb d8                	jmp    801313 <write+0x53>
+		return -E_NOT_SUPP;
+  80133b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801340:	eb d1                	jmp    801313 <write+0x53>
+
+00801342 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801342:	55                   	push   %ebp
+  801343:	89 e5                	mov    %esp,%ebp
+  801345:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801348:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80134b:	50                   	push   %eax
+  80134c:	ff 75 08             	push   0x8(%ebp)
+  80134f:	e8 38 fc ff ff       	call   800f8c <fd_lookup>
+  801354:	83 c4 10             	add    $0x10,%esp
+  801357:	85 c0                	test   %eax,%eax
+  801359:	78 0e                	js     801369 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80135b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80135e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801361:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801364:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801369:	c9                   	leave
+  80136a:	c3                   	ret
+
+0080136b <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80136b:	55                   	push   %ebp
+  80136c:	89 e5                	mov    %esp,%ebp
+  80136e:	56                   	push   %esi
+  80136f:	53                   	push   %ebx
+  801370:	83 ec 18             	sub    $0x18,%esp
+  801373:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801376:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801379:	50                   	push   %eax
+  80137a:	53                   	push   %ebx
+  80137b:	e8 0c fc ff ff       	call   800f8c <fd_lookup>
+  801380:	83 c4 10             	add    $0x10,%esp
+  801383:	85 c0                	test   %eax,%eax
+  801385:	78 34                	js     8013bb <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801387:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80138a:	83 ec 08             	sub    $0x8,%esp
+  80138d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801390:	50                   	push   %eax
+  801391:	ff 36                	push   (%esi)
+  801393:	e8 44 fc ff ff       	call   800fdc <dev_lookup>
+  801398:	83 c4 10             	add    $0x10,%esp
+  80139b:	85 c0                	test   %eax,%eax
+  80139d:	78 1c                	js     8013bb <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80139f:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8013a3:	74 1d                	je     8013c2 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8013a5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013a8:	8b 40 18             	mov    0x18(%eax),%eax
+  8013ab:	85 c0                	test   %eax,%eax
+  8013ad:	74 34                	je     8013e3 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8013af:	83 ec 08             	sub    $0x8,%esp
+  8013b2:	ff 75 0c             	push   0xc(%ebp)
+  8013b5:	56                   	push   %esi
+  8013b6:	ff d0                	call   *%eax
+  8013b8:	83 c4 10             	add    $0x10,%esp
+}
+  8013bb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013be:	5b                   	pop    %ebx
+  8013bf:	5e                   	pop    %esi
+  8013c0:	5d                   	pop    %ebp
+  8013c1:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8013c2:	a1 08 40 80 00       	mov    0x804008,%eax
+  8013c7:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8013ca:	83 ec 04             	sub    $0x4,%esp
+  8013cd:	53                   	push   %ebx
+  8013ce:	50                   	push   %eax
+  8013cf:	68 8c 2a 80 00       	push   $0x802a8c
+  8013d4:	e8 2f ee ff ff       	call   800208 <cprintf>
+		return -E_INVAL;
+  8013d9:	83 c4 10             	add    $0x10,%esp
+  8013dc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013e1:	eb d8                	jmp    8013bb <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8013e3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8013e8:	eb d1                	jmp    8013bb <ftruncate+0x50>
+
+008013ea <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8013ea:	55                   	push   %ebp
+  8013eb:	89 e5                	mov    %esp,%ebp
+  8013ed:	56                   	push   %esi
+  8013ee:	53                   	push   %ebx
+  8013ef:	83 ec 18             	sub    $0x18,%esp
+  8013f2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8013f5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8013f8:	50                   	push   %eax
+  8013f9:	ff 75 08             	push   0x8(%ebp)
+  8013fc:	e8 8b fb ff ff       	call   800f8c <fd_lookup>
+  801401:	83 c4 10             	add    $0x10,%esp
+  801404:	85 c0                	test   %eax,%eax
+  801406:	78 49                	js     801451 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801408:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80140b:	83 ec 08             	sub    $0x8,%esp
+  80140e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801411:	50                   	push   %eax
+  801412:	ff 36                	push   (%esi)
+  801414:	e8 c3 fb ff ff       	call   800fdc <dev_lookup>
+  801419:	83 c4 10             	add    $0x10,%esp
+  80141c:	85 c0                	test   %eax,%eax
+  80141e:	78 31                	js     801451 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801420:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801423:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801427:	74 2f                	je     801458 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801429:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80142c:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801433:	00 00 00 
+	stat->st_isdir = 0;
+  801436:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80143d:	00 00 00 
+	stat->st_dev = dev;
+  801440:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801446:	83 ec 08             	sub    $0x8,%esp
+  801449:	53                   	push   %ebx
+  80144a:	56                   	push   %esi
+  80144b:	ff 50 14             	call   *0x14(%eax)
+  80144e:	83 c4 10             	add    $0x10,%esp
+}
+  801451:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801454:	5b                   	pop    %ebx
+  801455:	5e                   	pop    %esi
+  801456:	5d                   	pop    %ebp
+  801457:	c3                   	ret
+		return -E_NOT_SUPP;
+  801458:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80145d:	eb f2                	jmp    801451 <fstat+0x67>
+
+0080145f <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80145f:	55                   	push   %ebp
+  801460:	89 e5                	mov    %esp,%ebp
+  801462:	56                   	push   %esi
+  801463:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801464:	83 ec 08             	sub    $0x8,%esp
+  801467:	6a 00                	push   $0x0
+  801469:	ff 75 08             	push   0x8(%ebp)
+  80146c:	e8 e4 01 00 00       	call   801655 <open>
+  801471:	89 c3                	mov    %eax,%ebx
+  801473:	83 c4 10             	add    $0x10,%esp
+  801476:	85 c0                	test   %eax,%eax
+  801478:	78 1b                	js     801495 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80147a:	83 ec 08             	sub    $0x8,%esp
+  80147d:	ff 75 0c             	push   0xc(%ebp)
+  801480:	50                   	push   %eax
+  801481:	e8 64 ff ff ff       	call   8013ea <fstat>
+  801486:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801488:	89 1c 24             	mov    %ebx,(%esp)
+  80148b:	e8 26 fc ff ff       	call   8010b6 <close>
+	return r;
+  801490:	83 c4 10             	add    $0x10,%esp
+  801493:	89 f3                	mov    %esi,%ebx
+}
+  801495:	89 d8                	mov    %ebx,%eax
+  801497:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80149a:	5b                   	pop    %ebx
+  80149b:	5e                   	pop    %esi
+  80149c:	5d                   	pop    %ebp
+  80149d:	c3                   	ret
+
+0080149e <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  80149e:	55                   	push   %ebp
+  80149f:	89 e5                	mov    %esp,%ebp
+  8014a1:	56                   	push   %esi
+  8014a2:	53                   	push   %ebx
+  8014a3:	89 c6                	mov    %eax,%esi
+  8014a5:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  8014a7:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  8014ae:	74 27                	je     8014d7 <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8014b0:	6a 07                	push   $0x7
+  8014b2:	68 00 50 80 00       	push   $0x805000
+  8014b7:	56                   	push   %esi
+  8014b8:	ff 35 00 40 80 00    	push   0x804000
+  8014be:	e8 d1 0b 00 00       	call   802094 <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  8014c3:	83 c4 0c             	add    $0xc,%esp
+  8014c6:	6a 00                	push   $0x0
+  8014c8:	53                   	push   %ebx
+  8014c9:	6a 00                	push   $0x0
+  8014cb:	e8 50 0b 00 00       	call   802020 <ipc_recv>
+}
+  8014d0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014d3:	5b                   	pop    %ebx
+  8014d4:	5e                   	pop    %esi
+  8014d5:	5d                   	pop    %ebp
+  8014d6:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  8014d7:	83 ec 0c             	sub    $0xc,%esp
+  8014da:	6a 01                	push   $0x1
+  8014dc:	e8 07 0c 00 00       	call   8020e8 <ipc_find_env>
+  8014e1:	a3 00 40 80 00       	mov    %eax,0x804000
+  8014e6:	83 c4 10             	add    $0x10,%esp
+  8014e9:	eb c5                	jmp    8014b0 <fsipc+0x12>
+
+008014eb <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8014eb:	55                   	push   %ebp
+  8014ec:	89 e5                	mov    %esp,%ebp
+  8014ee:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8014f1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014f4:	8b 40 0c             	mov    0xc(%eax),%eax
+  8014f7:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.set_size.req_size = newsize;
+  8014fc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8014ff:	a3 04 50 80 00       	mov    %eax,0x805004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801504:	ba 00 00 00 00       	mov    $0x0,%edx
+  801509:	b8 02 00 00 00       	mov    $0x2,%eax
+  80150e:	e8 8b ff ff ff       	call   80149e <fsipc>
+}
+  801513:	c9                   	leave
+  801514:	c3                   	ret
+
+00801515 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801515:	55                   	push   %ebp
+  801516:	89 e5                	mov    %esp,%ebp
+  801518:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80151b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80151e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801521:	a3 00 50 80 00       	mov    %eax,0x805000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801526:	ba 00 00 00 00       	mov    $0x0,%edx
+  80152b:	b8 06 00 00 00       	mov    $0x6,%eax
+  801530:	e8 69 ff ff ff       	call   80149e <fsipc>
+}
+  801535:	c9                   	leave
+  801536:	c3                   	ret
+
+00801537 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801537:	55                   	push   %ebp
+  801538:	89 e5                	mov    %esp,%ebp
+  80153a:	53                   	push   %ebx
+  80153b:	83 ec 04             	sub    $0x4,%esp
+  80153e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801541:	8b 45 08             	mov    0x8(%ebp),%eax
+  801544:	8b 40 0c             	mov    0xc(%eax),%eax
+  801547:	a3 00 50 80 00       	mov    %eax,0x805000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80154c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801551:	b8 05 00 00 00       	mov    $0x5,%eax
+  801556:	e8 43 ff ff ff       	call   80149e <fsipc>
+  80155b:	85 c0                	test   %eax,%eax
+  80155d:	78 2c                	js     80158b <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80155f:	83 ec 08             	sub    $0x8,%esp
+  801562:	68 00 50 80 00       	push   $0x805000
+  801567:	53                   	push   %ebx
+  801568:	e8 54 f2 ff ff       	call   8007c1 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  80156d:	a1 80 50 80 00       	mov    0x805080,%eax
+  801572:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801578:	a1 84 50 80 00       	mov    0x805084,%eax
+  80157d:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801583:	83 c4 10             	add    $0x10,%esp
+  801586:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80158b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80158e:	c9                   	leave
+  80158f:	c3                   	ret
+
+00801590 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801590:	55                   	push   %ebp
+  801591:	89 e5                	mov    %esp,%ebp
+  801593:	83 ec 0c             	sub    $0xc,%esp
+  801596:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801599:	8b 55 08             	mov    0x8(%ebp),%edx
+  80159c:	8b 52 0c             	mov    0xc(%edx),%edx
+  80159f:	89 15 00 50 80 00    	mov    %edx,0x805000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8015a5:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8015aa:	39 d0                	cmp    %edx,%eax
+  8015ac:	0f 47 c2             	cmova  %edx,%eax
+  8015af:	a3 04 50 80 00       	mov    %eax,0x805004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  8015b4:	50                   	push   %eax
+  8015b5:	ff 75 0c             	push   0xc(%ebp)
+  8015b8:	68 08 50 80 00       	push   $0x805008
+  8015bd:	e8 85 f3 ff ff       	call   800947 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  8015c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015c7:	b8 04 00 00 00       	mov    $0x4,%eax
+  8015cc:	e8 cd fe ff ff       	call   80149e <fsipc>
+}
+  8015d1:	c9                   	leave
+  8015d2:	c3                   	ret
+
+008015d3 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8015d3:	55                   	push   %ebp
+  8015d4:	89 e5                	mov    %esp,%ebp
+  8015d6:	56                   	push   %esi
+  8015d7:	53                   	push   %ebx
+  8015d8:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8015db:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015de:	8b 40 0c             	mov    0xc(%eax),%eax
+  8015e1:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.read.req_n = n;
+  8015e6:	89 35 04 50 80 00    	mov    %esi,0x805004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8015ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015f1:	b8 03 00 00 00       	mov    $0x3,%eax
+  8015f6:	e8 a3 fe ff ff       	call   80149e <fsipc>
+  8015fb:	89 c3                	mov    %eax,%ebx
+  8015fd:	85 c0                	test   %eax,%eax
+  8015ff:	78 1f                	js     801620 <devfile_read+0x4d>
+  assert(r <= n);
+  801601:	39 c6                	cmp    %eax,%esi
+  801603:	72 24                	jb     801629 <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  801605:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80160a:	7f 33                	jg     80163f <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80160c:	83 ec 04             	sub    $0x4,%esp
+  80160f:	50                   	push   %eax
+  801610:	68 00 50 80 00       	push   $0x805000
+  801615:	ff 75 0c             	push   0xc(%ebp)
+  801618:	e8 2a f3 ff ff       	call   800947 <memmove>
+  return r;
+  80161d:	83 c4 10             	add    $0x10,%esp
+}
+  801620:	89 d8                	mov    %ebx,%eax
+  801622:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801625:	5b                   	pop    %ebx
+  801626:	5e                   	pop    %esi
+  801627:	5d                   	pop    %ebp
+  801628:	c3                   	ret
+  assert(r <= n);
+  801629:	68 fc 2a 80 00       	push   $0x802afc
+  80162e:	68 03 2b 80 00       	push   $0x802b03
+  801633:	6a 78                	push   $0x78
+  801635:	68 18 2b 80 00       	push   $0x802b18
+  80163a:	e8 ee ea ff ff       	call   80012d <_panic>
+  assert(r <= PGSIZE);
+  80163f:	68 23 2b 80 00       	push   $0x802b23
+  801644:	68 03 2b 80 00       	push   $0x802b03
+  801649:	6a 79                	push   $0x79
+  80164b:	68 18 2b 80 00       	push   $0x802b18
+  801650:	e8 d8 ea ff ff       	call   80012d <_panic>
+
+00801655 <open>:
+open(const char *path, int mode) {
+  801655:	55                   	push   %ebp
+  801656:	89 e5                	mov    %esp,%ebp
+  801658:	56                   	push   %esi
+  801659:	53                   	push   %ebx
+  80165a:	83 ec 1c             	sub    $0x1c,%esp
+  80165d:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801660:	56                   	push   %esi
+  801661:	e8 20 f1 ff ff       	call   800786 <strlen>
+  801666:	83 c4 10             	add    $0x10,%esp
+  801669:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80166e:	7f 6c                	jg     8016dc <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801670:	83 ec 0c             	sub    $0xc,%esp
+  801673:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801676:	50                   	push   %eax
+  801677:	e8 ba f8 ff ff       	call   800f36 <fd_alloc>
+  80167c:	89 c3                	mov    %eax,%ebx
+  80167e:	83 c4 10             	add    $0x10,%esp
+  801681:	85 c0                	test   %eax,%eax
+  801683:	78 3c                	js     8016c1 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801685:	83 ec 08             	sub    $0x8,%esp
+  801688:	56                   	push   %esi
+  801689:	68 00 50 80 00       	push   $0x805000
+  80168e:	e8 2e f1 ff ff       	call   8007c1 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801693:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801696:	a3 00 54 80 00       	mov    %eax,0x805400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80169b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80169e:	b8 01 00 00 00       	mov    $0x1,%eax
+  8016a3:	e8 f6 fd ff ff       	call   80149e <fsipc>
+  8016a8:	89 c3                	mov    %eax,%ebx
+  8016aa:	83 c4 10             	add    $0x10,%esp
+  8016ad:	85 c0                	test   %eax,%eax
+  8016af:	78 19                	js     8016ca <open+0x75>
+  return fd2num(fd);
+  8016b1:	83 ec 0c             	sub    $0xc,%esp
+  8016b4:	ff 75 f4             	push   -0xc(%ebp)
+  8016b7:	e8 53 f8 ff ff       	call   800f0f <fd2num>
+  8016bc:	89 c3                	mov    %eax,%ebx
+  8016be:	83 c4 10             	add    $0x10,%esp
+}
+  8016c1:	89 d8                	mov    %ebx,%eax
+  8016c3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016c6:	5b                   	pop    %ebx
+  8016c7:	5e                   	pop    %esi
+  8016c8:	5d                   	pop    %ebp
+  8016c9:	c3                   	ret
+    fd_close(fd, 0);
+  8016ca:	83 ec 08             	sub    $0x8,%esp
+  8016cd:	6a 00                	push   $0x0
+  8016cf:	ff 75 f4             	push   -0xc(%ebp)
+  8016d2:	e8 58 f9 ff ff       	call   80102f <fd_close>
+    return r;
+  8016d7:	83 c4 10             	add    $0x10,%esp
+  8016da:	eb e5                	jmp    8016c1 <open+0x6c>
+    return -E_BAD_PATH;
+  8016dc:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8016e1:	eb de                	jmp    8016c1 <open+0x6c>
+
+008016e3 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  8016e3:	55                   	push   %ebp
+  8016e4:	89 e5                	mov    %esp,%ebp
+  8016e6:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  8016e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016ee:	b8 08 00 00 00       	mov    $0x8,%eax
+  8016f3:	e8 a6 fd ff ff       	call   80149e <fsipc>
+}
+  8016f8:	c9                   	leave
+  8016f9:	c3                   	ret
+
+008016fa <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8016fa:	55                   	push   %ebp
+  8016fb:	89 e5                	mov    %esp,%ebp
+  8016fd:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801700:	68 2f 2b 80 00       	push   $0x802b2f
+  801705:	ff 75 0c             	push   0xc(%ebp)
+  801708:	e8 b4 f0 ff ff       	call   8007c1 <strcpy>
+	return 0;
+}
+  80170d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801712:	c9                   	leave
+  801713:	c3                   	ret
+
+00801714 <devsock_close>:
+{
+  801714:	55                   	push   %ebp
+  801715:	89 e5                	mov    %esp,%ebp
+  801717:	53                   	push   %ebx
+  801718:	83 ec 10             	sub    $0x10,%esp
+  80171b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  80171e:	53                   	push   %ebx
+  80171f:	e8 03 0a 00 00       	call   802127 <pageref>
+  801724:	89 c2                	mov    %eax,%edx
+  801726:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801729:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  80172e:	83 fa 01             	cmp    $0x1,%edx
+  801731:	74 05                	je     801738 <devsock_close+0x24>
+}
+  801733:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801736:	c9                   	leave
+  801737:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801738:	83 ec 0c             	sub    $0xc,%esp
+  80173b:	ff 73 0c             	push   0xc(%ebx)
+  80173e:	e8 b7 02 00 00       	call   8019fa <nsipc_close>
+  801743:	83 c4 10             	add    $0x10,%esp
+  801746:	eb eb                	jmp    801733 <devsock_close+0x1f>
+
+00801748 <devsock_write>:
+{
+  801748:	55                   	push   %ebp
+  801749:	89 e5                	mov    %esp,%ebp
+  80174b:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  80174e:	6a 00                	push   $0x0
+  801750:	ff 75 10             	push   0x10(%ebp)
+  801753:	ff 75 0c             	push   0xc(%ebp)
+  801756:	8b 45 08             	mov    0x8(%ebp),%eax
+  801759:	ff 70 0c             	push   0xc(%eax)
+  80175c:	e8 79 03 00 00       	call   801ada <nsipc_send>
+}
+  801761:	c9                   	leave
+  801762:	c3                   	ret
+
+00801763 <devsock_read>:
+{
+  801763:	55                   	push   %ebp
+  801764:	89 e5                	mov    %esp,%ebp
+  801766:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801769:	6a 00                	push   $0x0
+  80176b:	ff 75 10             	push   0x10(%ebp)
+  80176e:	ff 75 0c             	push   0xc(%ebp)
+  801771:	8b 45 08             	mov    0x8(%ebp),%eax
+  801774:	ff 70 0c             	push   0xc(%eax)
+  801777:	e8 ef 02 00 00       	call   801a6b <nsipc_recv>
+}
+  80177c:	c9                   	leave
+  80177d:	c3                   	ret
+
+0080177e <fd2sockid>:
+{
+  80177e:	55                   	push   %ebp
+  80177f:	89 e5                	mov    %esp,%ebp
+  801781:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801784:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801787:	52                   	push   %edx
+  801788:	50                   	push   %eax
+  801789:	e8 fe f7 ff ff       	call   800f8c <fd_lookup>
+  80178e:	83 c4 10             	add    $0x10,%esp
+  801791:	85 c0                	test   %eax,%eax
+  801793:	78 10                	js     8017a5 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801795:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801798:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  80179e:	39 08                	cmp    %ecx,(%eax)
+  8017a0:	75 05                	jne    8017a7 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8017a2:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8017a5:	c9                   	leave
+  8017a6:	c3                   	ret
+		return -E_NOT_SUPP;
+  8017a7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017ac:	eb f7                	jmp    8017a5 <fd2sockid+0x27>
+
+008017ae <alloc_sockfd>:
+{
+  8017ae:	55                   	push   %ebp
+  8017af:	89 e5                	mov    %esp,%ebp
+  8017b1:	56                   	push   %esi
+  8017b2:	53                   	push   %ebx
+  8017b3:	83 ec 1c             	sub    $0x1c,%esp
+  8017b6:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8017b8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017bb:	50                   	push   %eax
+  8017bc:	e8 75 f7 ff ff       	call   800f36 <fd_alloc>
+  8017c1:	89 c3                	mov    %eax,%ebx
+  8017c3:	83 c4 10             	add    $0x10,%esp
+  8017c6:	85 c0                	test   %eax,%eax
+  8017c8:	78 43                	js     80180d <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8017ca:	83 ec 04             	sub    $0x4,%esp
+  8017cd:	68 07 04 00 00       	push   $0x407
+  8017d2:	ff 75 f4             	push   -0xc(%ebp)
+  8017d5:	6a 00                	push   $0x0
+  8017d7:	e8 d1 f3 ff ff       	call   800bad <sys_page_alloc>
+  8017dc:	89 c3                	mov    %eax,%ebx
+  8017de:	83 c4 10             	add    $0x10,%esp
+  8017e1:	85 c0                	test   %eax,%eax
+  8017e3:	78 28                	js     80180d <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8017e5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017e8:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  8017ee:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8017f0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017f3:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8017fa:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8017fd:	83 ec 0c             	sub    $0xc,%esp
+  801800:	50                   	push   %eax
+  801801:	e8 09 f7 ff ff       	call   800f0f <fd2num>
+  801806:	89 c3                	mov    %eax,%ebx
+  801808:	83 c4 10             	add    $0x10,%esp
+  80180b:	eb 0c                	jmp    801819 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  80180d:	83 ec 0c             	sub    $0xc,%esp
+  801810:	56                   	push   %esi
+  801811:	e8 e4 01 00 00       	call   8019fa <nsipc_close>
+		return r;
+  801816:	83 c4 10             	add    $0x10,%esp
+}
+  801819:	89 d8                	mov    %ebx,%eax
+  80181b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80181e:	5b                   	pop    %ebx
+  80181f:	5e                   	pop    %esi
+  801820:	5d                   	pop    %ebp
+  801821:	c3                   	ret
+
+00801822 <accept>:
+{
+  801822:	55                   	push   %ebp
+  801823:	89 e5                	mov    %esp,%ebp
+  801825:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801828:	8b 45 08             	mov    0x8(%ebp),%eax
+  80182b:	e8 4e ff ff ff       	call   80177e <fd2sockid>
+  801830:	85 c0                	test   %eax,%eax
+  801832:	78 1b                	js     80184f <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801834:	83 ec 04             	sub    $0x4,%esp
+  801837:	ff 75 10             	push   0x10(%ebp)
+  80183a:	ff 75 0c             	push   0xc(%ebp)
+  80183d:	50                   	push   %eax
+  80183e:	e8 0e 01 00 00       	call   801951 <nsipc_accept>
+  801843:	83 c4 10             	add    $0x10,%esp
+  801846:	85 c0                	test   %eax,%eax
+  801848:	78 05                	js     80184f <accept+0x2d>
+	return alloc_sockfd(r);
+  80184a:	e8 5f ff ff ff       	call   8017ae <alloc_sockfd>
+}
+  80184f:	c9                   	leave
+  801850:	c3                   	ret
+
+00801851 <bind>:
+{
+  801851:	55                   	push   %ebp
+  801852:	89 e5                	mov    %esp,%ebp
+  801854:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801857:	8b 45 08             	mov    0x8(%ebp),%eax
+  80185a:	e8 1f ff ff ff       	call   80177e <fd2sockid>
+  80185f:	85 c0                	test   %eax,%eax
+  801861:	78 12                	js     801875 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801863:	83 ec 04             	sub    $0x4,%esp
+  801866:	ff 75 10             	push   0x10(%ebp)
+  801869:	ff 75 0c             	push   0xc(%ebp)
+  80186c:	50                   	push   %eax
+  80186d:	e8 31 01 00 00       	call   8019a3 <nsipc_bind>
+  801872:	83 c4 10             	add    $0x10,%esp
+}
+  801875:	c9                   	leave
+  801876:	c3                   	ret
+
+00801877 <shutdown>:
+{
+  801877:	55                   	push   %ebp
+  801878:	89 e5                	mov    %esp,%ebp
+  80187a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80187d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801880:	e8 f9 fe ff ff       	call   80177e <fd2sockid>
+  801885:	85 c0                	test   %eax,%eax
+  801887:	78 0f                	js     801898 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801889:	83 ec 08             	sub    $0x8,%esp
+  80188c:	ff 75 0c             	push   0xc(%ebp)
+  80188f:	50                   	push   %eax
+  801890:	e8 43 01 00 00       	call   8019d8 <nsipc_shutdown>
+  801895:	83 c4 10             	add    $0x10,%esp
+}
+  801898:	c9                   	leave
+  801899:	c3                   	ret
+
+0080189a <connect>:
+{
+  80189a:	55                   	push   %ebp
+  80189b:	89 e5                	mov    %esp,%ebp
+  80189d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8018a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018a3:	e8 d6 fe ff ff       	call   80177e <fd2sockid>
+  8018a8:	85 c0                	test   %eax,%eax
+  8018aa:	78 12                	js     8018be <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8018ac:	83 ec 04             	sub    $0x4,%esp
+  8018af:	ff 75 10             	push   0x10(%ebp)
+  8018b2:	ff 75 0c             	push   0xc(%ebp)
+  8018b5:	50                   	push   %eax
+  8018b6:	e8 59 01 00 00       	call   801a14 <nsipc_connect>
+  8018bb:	83 c4 10             	add    $0x10,%esp
+}
+  8018be:	c9                   	leave
+  8018bf:	c3                   	ret
+
+008018c0 <listen>:
+{
+  8018c0:	55                   	push   %ebp
+  8018c1:	89 e5                	mov    %esp,%ebp
+  8018c3:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8018c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018c9:	e8 b0 fe ff ff       	call   80177e <fd2sockid>
+  8018ce:	85 c0                	test   %eax,%eax
+  8018d0:	78 0f                	js     8018e1 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8018d2:	83 ec 08             	sub    $0x8,%esp
+  8018d5:	ff 75 0c             	push   0xc(%ebp)
+  8018d8:	50                   	push   %eax
+  8018d9:	e8 6b 01 00 00       	call   801a49 <nsipc_listen>
+  8018de:	83 c4 10             	add    $0x10,%esp
+}
+  8018e1:	c9                   	leave
+  8018e2:	c3                   	ret
+
+008018e3 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8018e3:	55                   	push   %ebp
+  8018e4:	89 e5                	mov    %esp,%ebp
+  8018e6:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8018e9:	ff 75 10             	push   0x10(%ebp)
+  8018ec:	ff 75 0c             	push   0xc(%ebp)
+  8018ef:	ff 75 08             	push   0x8(%ebp)
+  8018f2:	e8 41 02 00 00       	call   801b38 <nsipc_socket>
+  8018f7:	83 c4 10             	add    $0x10,%esp
+  8018fa:	85 c0                	test   %eax,%eax
+  8018fc:	78 05                	js     801903 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8018fe:	e8 ab fe ff ff       	call   8017ae <alloc_sockfd>
+}
+  801903:	c9                   	leave
+  801904:	c3                   	ret
+
+00801905 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801905:	55                   	push   %ebp
+  801906:	89 e5                	mov    %esp,%ebp
+  801908:	53                   	push   %ebx
+  801909:	83 ec 04             	sub    $0x4,%esp
+  80190c:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  80190e:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801915:	74 26                	je     80193d <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801917:	6a 07                	push   $0x7
+  801919:	68 00 60 80 00       	push   $0x806000
+  80191e:	53                   	push   %ebx
+  80191f:	ff 35 04 40 80 00    	push   0x804004
+  801925:	e8 6a 07 00 00       	call   802094 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  80192a:	83 c4 0c             	add    $0xc,%esp
+  80192d:	6a 00                	push   $0x0
+  80192f:	6a 00                	push   $0x0
+  801931:	6a 00                	push   $0x0
+  801933:	e8 e8 06 00 00       	call   802020 <ipc_recv>
+}
+  801938:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80193b:	c9                   	leave
+  80193c:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80193d:	83 ec 0c             	sub    $0xc,%esp
+  801940:	6a 02                	push   $0x2
+  801942:	e8 a1 07 00 00       	call   8020e8 <ipc_find_env>
+  801947:	a3 04 40 80 00       	mov    %eax,0x804004
+  80194c:	83 c4 10             	add    $0x10,%esp
+  80194f:	eb c6                	jmp    801917 <nsipc+0x12>
+
+00801951 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801951:	55                   	push   %ebp
+  801952:	89 e5                	mov    %esp,%ebp
+  801954:	56                   	push   %esi
+  801955:	53                   	push   %ebx
+  801956:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801959:	8b 45 08             	mov    0x8(%ebp),%eax
+  80195c:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801961:	8b 06                	mov    (%esi),%eax
+  801963:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801968:	b8 01 00 00 00       	mov    $0x1,%eax
+  80196d:	e8 93 ff ff ff       	call   801905 <nsipc>
+  801972:	89 c3                	mov    %eax,%ebx
+  801974:	85 c0                	test   %eax,%eax
+  801976:	79 09                	jns    801981 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801978:	89 d8                	mov    %ebx,%eax
+  80197a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80197d:	5b                   	pop    %ebx
+  80197e:	5e                   	pop    %esi
+  80197f:	5d                   	pop    %ebp
+  801980:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801981:	83 ec 04             	sub    $0x4,%esp
+  801984:	ff 35 10 60 80 00    	push   0x806010
+  80198a:	68 00 60 80 00       	push   $0x806000
+  80198f:	ff 75 0c             	push   0xc(%ebp)
+  801992:	e8 b0 ef ff ff       	call   800947 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801997:	a1 10 60 80 00       	mov    0x806010,%eax
+  80199c:	89 06                	mov    %eax,(%esi)
+  80199e:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8019a1:	eb d5                	jmp    801978 <nsipc_accept+0x27>
+
+008019a3 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8019a3:	55                   	push   %ebp
+  8019a4:	89 e5                	mov    %esp,%ebp
+  8019a6:	53                   	push   %ebx
+  8019a7:	83 ec 08             	sub    $0x8,%esp
+  8019aa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8019ad:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019b0:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8019b5:	53                   	push   %ebx
+  8019b6:	ff 75 0c             	push   0xc(%ebp)
+  8019b9:	68 04 60 80 00       	push   $0x806004
+  8019be:	e8 84 ef ff ff       	call   800947 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8019c3:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  8019c9:	b8 02 00 00 00       	mov    $0x2,%eax
+  8019ce:	e8 32 ff ff ff       	call   801905 <nsipc>
+}
+  8019d3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019d6:	c9                   	leave
+  8019d7:	c3                   	ret
+
+008019d8 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8019d8:	55                   	push   %ebp
+  8019d9:	89 e5                	mov    %esp,%ebp
+  8019db:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8019de:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019e1:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  8019e6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019e9:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  8019ee:	b8 03 00 00 00       	mov    $0x3,%eax
+  8019f3:	e8 0d ff ff ff       	call   801905 <nsipc>
+}
+  8019f8:	c9                   	leave
+  8019f9:	c3                   	ret
+
+008019fa <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8019fa:	55                   	push   %ebp
+  8019fb:	89 e5                	mov    %esp,%ebp
+  8019fd:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801a00:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a03:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  801a08:	b8 04 00 00 00       	mov    $0x4,%eax
+  801a0d:	e8 f3 fe ff ff       	call   801905 <nsipc>
+}
+  801a12:	c9                   	leave
+  801a13:	c3                   	ret
+
+00801a14 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801a14:	55                   	push   %ebp
+  801a15:	89 e5                	mov    %esp,%ebp
+  801a17:	53                   	push   %ebx
+  801a18:	83 ec 08             	sub    $0x8,%esp
+  801a1b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801a1e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a21:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801a26:	53                   	push   %ebx
+  801a27:	ff 75 0c             	push   0xc(%ebp)
+  801a2a:	68 04 60 80 00       	push   $0x806004
+  801a2f:	e8 13 ef ff ff       	call   800947 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801a34:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  801a3a:	b8 05 00 00 00       	mov    $0x5,%eax
+  801a3f:	e8 c1 fe ff ff       	call   801905 <nsipc>
+}
+  801a44:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a47:	c9                   	leave
+  801a48:	c3                   	ret
+
+00801a49 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801a49:	55                   	push   %ebp
+  801a4a:	89 e5                	mov    %esp,%ebp
+  801a4c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801a4f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a52:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  801a57:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a5a:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  801a5f:	b8 06 00 00 00       	mov    $0x6,%eax
+  801a64:	e8 9c fe ff ff       	call   801905 <nsipc>
+}
+  801a69:	c9                   	leave
+  801a6a:	c3                   	ret
+
+00801a6b <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801a6b:	55                   	push   %ebp
+  801a6c:	89 e5                	mov    %esp,%ebp
+  801a6e:	56                   	push   %esi
+  801a6f:	53                   	push   %ebx
+  801a70:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801a73:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a76:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  801a7b:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  801a81:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a84:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801a89:	b8 07 00 00 00       	mov    $0x7,%eax
+  801a8e:	e8 72 fe ff ff       	call   801905 <nsipc>
+  801a93:	89 c3                	mov    %eax,%ebx
+  801a95:	85 c0                	test   %eax,%eax
+  801a97:	78 22                	js     801abb <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801a99:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801a9e:	39 c6                	cmp    %eax,%esi
+  801aa0:	0f 4e c6             	cmovle %esi,%eax
+  801aa3:	39 c3                	cmp    %eax,%ebx
+  801aa5:	7f 1d                	jg     801ac4 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801aa7:	83 ec 04             	sub    $0x4,%esp
+  801aaa:	53                   	push   %ebx
+  801aab:	68 00 60 80 00       	push   $0x806000
+  801ab0:	ff 75 0c             	push   0xc(%ebp)
+  801ab3:	e8 8f ee ff ff       	call   800947 <memmove>
+  801ab8:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801abb:	89 d8                	mov    %ebx,%eax
+  801abd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ac0:	5b                   	pop    %ebx
+  801ac1:	5e                   	pop    %esi
+  801ac2:	5d                   	pop    %ebp
+  801ac3:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801ac4:	68 3b 2b 80 00       	push   $0x802b3b
+  801ac9:	68 03 2b 80 00       	push   $0x802b03
+  801ace:	6a 62                	push   $0x62
+  801ad0:	68 50 2b 80 00       	push   $0x802b50
+  801ad5:	e8 53 e6 ff ff       	call   80012d <_panic>
+
+00801ada <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801ada:	55                   	push   %ebp
+  801adb:	89 e5                	mov    %esp,%ebp
+  801add:	53                   	push   %ebx
+  801ade:	83 ec 04             	sub    $0x4,%esp
+  801ae1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801ae4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ae7:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  801aec:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801af2:	7f 2e                	jg     801b22 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801af4:	83 ec 04             	sub    $0x4,%esp
+  801af7:	53                   	push   %ebx
+  801af8:	ff 75 0c             	push   0xc(%ebp)
+  801afb:	68 0c 60 80 00       	push   $0x80600c
+  801b00:	e8 42 ee ff ff       	call   800947 <memmove>
+	nsipcbuf.send.req_size = size;
+  801b05:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  801b0b:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b0e:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  801b13:	b8 08 00 00 00       	mov    $0x8,%eax
+  801b18:	e8 e8 fd ff ff       	call   801905 <nsipc>
+}
+  801b1d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b20:	c9                   	leave
+  801b21:	c3                   	ret
+	assert(size < 1600);
+  801b22:	68 5c 2b 80 00       	push   $0x802b5c
+  801b27:	68 03 2b 80 00       	push   $0x802b03
+  801b2c:	6a 6d                	push   $0x6d
+  801b2e:	68 50 2b 80 00       	push   $0x802b50
+  801b33:	e8 f5 e5 ff ff       	call   80012d <_panic>
+
+00801b38 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801b38:	55                   	push   %ebp
+  801b39:	89 e5                	mov    %esp,%ebp
+  801b3b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801b3e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b41:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  801b46:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b49:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  801b4e:	8b 45 10             	mov    0x10(%ebp),%eax
+  801b51:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  801b56:	b8 09 00 00 00       	mov    $0x9,%eax
+  801b5b:	e8 a5 fd ff ff       	call   801905 <nsipc>
+}
+  801b60:	c9                   	leave
+  801b61:	c3                   	ret
+
+00801b62 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801b62:	55                   	push   %ebp
+  801b63:	89 e5                	mov    %esp,%ebp
+  801b65:	56                   	push   %esi
+  801b66:	53                   	push   %ebx
+  801b67:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801b6a:	83 ec 0c             	sub    $0xc,%esp
+  801b6d:	ff 75 08             	push   0x8(%ebp)
+  801b70:	e8 aa f3 ff ff       	call   800f1f <fd2data>
+  801b75:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801b77:	83 c4 08             	add    $0x8,%esp
+  801b7a:	68 68 2b 80 00       	push   $0x802b68
+  801b7f:	53                   	push   %ebx
+  801b80:	e8 3c ec ff ff       	call   8007c1 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801b85:	8b 46 04             	mov    0x4(%esi),%eax
+  801b88:	2b 06                	sub    (%esi),%eax
+  801b8a:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  801b90:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801b97:	00 00 00 
+	stat->st_dev = &devpipe;
+  801b9a:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  801ba1:	30 80 00 
+	return 0;
+}
+  801ba4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ba9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bac:	5b                   	pop    %ebx
+  801bad:	5e                   	pop    %esi
+  801bae:	5d                   	pop    %ebp
+  801baf:	c3                   	ret
+
+00801bb0 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801bb0:	55                   	push   %ebp
+  801bb1:	89 e5                	mov    %esp,%ebp
+  801bb3:	53                   	push   %ebx
+  801bb4:	83 ec 0c             	sub    $0xc,%esp
+  801bb7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801bba:	53                   	push   %ebx
+  801bbb:	6a 00                	push   $0x0
+  801bbd:	e8 70 f0 ff ff       	call   800c32 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801bc2:	89 1c 24             	mov    %ebx,(%esp)
+  801bc5:	e8 55 f3 ff ff       	call   800f1f <fd2data>
+  801bca:	83 c4 08             	add    $0x8,%esp
+  801bcd:	50                   	push   %eax
+  801bce:	6a 00                	push   $0x0
+  801bd0:	e8 5d f0 ff ff       	call   800c32 <sys_page_unmap>
+}
+  801bd5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bd8:	c9                   	leave
+  801bd9:	c3                   	ret
+
+00801bda <_pipeisclosed>:
+{
+  801bda:	55                   	push   %ebp
+  801bdb:	89 e5                	mov    %esp,%ebp
+  801bdd:	57                   	push   %edi
+  801bde:	56                   	push   %esi
+  801bdf:	53                   	push   %ebx
+  801be0:	83 ec 1c             	sub    $0x1c,%esp
+  801be3:	89 c7                	mov    %eax,%edi
+  801be5:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801be7:	a1 08 40 80 00       	mov    0x804008,%eax
+  801bec:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801bef:	83 ec 0c             	sub    $0xc,%esp
+  801bf2:	57                   	push   %edi
+  801bf3:	e8 2f 05 00 00       	call   802127 <pageref>
+  801bf8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801bfb:	89 34 24             	mov    %esi,(%esp)
+  801bfe:	e8 24 05 00 00       	call   802127 <pageref>
+		nn = thisenv->env_runs;
+  801c03:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801c09:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801c0c:	83 c4 10             	add    $0x10,%esp
+  801c0f:	39 cb                	cmp    %ecx,%ebx
+  801c11:	74 1b                	je     801c2e <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801c13:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801c16:	75 cf                	jne    801be7 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801c18:	8b 42 58             	mov    0x58(%edx),%eax
+  801c1b:	6a 01                	push   $0x1
+  801c1d:	50                   	push   %eax
+  801c1e:	53                   	push   %ebx
+  801c1f:	68 6f 2b 80 00       	push   $0x802b6f
+  801c24:	e8 df e5 ff ff       	call   800208 <cprintf>
+  801c29:	83 c4 10             	add    $0x10,%esp
+  801c2c:	eb b9                	jmp    801be7 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801c2e:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801c31:	0f 94 c0             	sete   %al
+  801c34:	0f b6 c0             	movzbl %al,%eax
+}
+  801c37:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c3a:	5b                   	pop    %ebx
+  801c3b:	5e                   	pop    %esi
+  801c3c:	5f                   	pop    %edi
+  801c3d:	5d                   	pop    %ebp
+  801c3e:	c3                   	ret
+
+00801c3f <devpipe_write>:
+{
+  801c3f:	55                   	push   %ebp
+  801c40:	89 e5                	mov    %esp,%ebp
+  801c42:	57                   	push   %edi
+  801c43:	56                   	push   %esi
+  801c44:	53                   	push   %ebx
+  801c45:	83 ec 28             	sub    $0x28,%esp
+  801c48:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801c4b:	56                   	push   %esi
+  801c4c:	e8 ce f2 ff ff       	call   800f1f <fd2data>
+  801c51:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801c53:	83 c4 10             	add    $0x10,%esp
+  801c56:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c5b:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801c5e:	75 09                	jne    801c69 <devpipe_write+0x2a>
+	return i;
+  801c60:	89 f8                	mov    %edi,%eax
+  801c62:	eb 23                	jmp    801c87 <devpipe_write+0x48>
+			sys_yield();
+  801c64:	e8 25 ef ff ff       	call   800b8e <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801c69:	8b 43 04             	mov    0x4(%ebx),%eax
+  801c6c:	8b 0b                	mov    (%ebx),%ecx
+  801c6e:	8d 51 20             	lea    0x20(%ecx),%edx
+  801c71:	39 d0                	cmp    %edx,%eax
+  801c73:	72 1a                	jb     801c8f <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  801c75:	89 da                	mov    %ebx,%edx
+  801c77:	89 f0                	mov    %esi,%eax
+  801c79:	e8 5c ff ff ff       	call   801bda <_pipeisclosed>
+  801c7e:	85 c0                	test   %eax,%eax
+  801c80:	74 e2                	je     801c64 <devpipe_write+0x25>
+				return 0;
+  801c82:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c87:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c8a:	5b                   	pop    %ebx
+  801c8b:	5e                   	pop    %esi
+  801c8c:	5f                   	pop    %edi
+  801c8d:	5d                   	pop    %ebp
+  801c8e:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801c8f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c92:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801c96:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801c99:	89 c2                	mov    %eax,%edx
+  801c9b:	c1 fa 1f             	sar    $0x1f,%edx
+  801c9e:	89 d1                	mov    %edx,%ecx
+  801ca0:	c1 e9 1b             	shr    $0x1b,%ecx
+  801ca3:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801ca6:	83 e2 1f             	and    $0x1f,%edx
+  801ca9:	29 ca                	sub    %ecx,%edx
+  801cab:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801caf:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  801cb3:	83 c0 01             	add    $0x1,%eax
+  801cb6:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  801cb9:	83 c7 01             	add    $0x1,%edi
+  801cbc:	eb 9d                	jmp    801c5b <devpipe_write+0x1c>
+
+00801cbe <devpipe_read>:
+{
+  801cbe:	55                   	push   %ebp
+  801cbf:	89 e5                	mov    %esp,%ebp
+  801cc1:	57                   	push   %edi
+  801cc2:	56                   	push   %esi
+  801cc3:	53                   	push   %ebx
+  801cc4:	83 ec 18             	sub    $0x18,%esp
+  801cc7:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  801cca:	57                   	push   %edi
+  801ccb:	e8 4f f2 ff ff       	call   800f1f <fd2data>
+  801cd0:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801cd2:	83 c4 10             	add    $0x10,%esp
+  801cd5:	be 00 00 00 00       	mov    $0x0,%esi
+  801cda:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801cdd:	75 13                	jne    801cf2 <devpipe_read+0x34>
+	return i;
+  801cdf:	89 f0                	mov    %esi,%eax
+  801ce1:	eb 02                	jmp    801ce5 <devpipe_read+0x27>
+				return i;
+  801ce3:	89 f0                	mov    %esi,%eax
+}
+  801ce5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ce8:	5b                   	pop    %ebx
+  801ce9:	5e                   	pop    %esi
+  801cea:	5f                   	pop    %edi
+  801ceb:	5d                   	pop    %ebp
+  801cec:	c3                   	ret
+			sys_yield();
+  801ced:	e8 9c ee ff ff       	call   800b8e <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  801cf2:	8b 03                	mov    (%ebx),%eax
+  801cf4:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801cf7:	75 18                	jne    801d11 <devpipe_read+0x53>
+			if (i > 0)
+  801cf9:	85 f6                	test   %esi,%esi
+  801cfb:	75 e6                	jne    801ce3 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  801cfd:	89 da                	mov    %ebx,%edx
+  801cff:	89 f8                	mov    %edi,%eax
+  801d01:	e8 d4 fe ff ff       	call   801bda <_pipeisclosed>
+  801d06:	85 c0                	test   %eax,%eax
+  801d08:	74 e3                	je     801ced <devpipe_read+0x2f>
+				return 0;
+  801d0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d0f:	eb d4                	jmp    801ce5 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801d11:	99                   	cltd
+  801d12:	c1 ea 1b             	shr    $0x1b,%edx
+  801d15:	01 d0                	add    %edx,%eax
+  801d17:	83 e0 1f             	and    $0x1f,%eax
+  801d1a:	29 d0                	sub    %edx,%eax
+  801d1c:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801d21:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d24:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  801d27:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  801d2a:	83 c6 01             	add    $0x1,%esi
+  801d2d:	eb ab                	jmp    801cda <devpipe_read+0x1c>
+
+00801d2f <pipe>:
+{
+  801d2f:	55                   	push   %ebp
+  801d30:	89 e5                	mov    %esp,%ebp
+  801d32:	56                   	push   %esi
+  801d33:	53                   	push   %ebx
+  801d34:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801d37:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d3a:	50                   	push   %eax
+  801d3b:	e8 f6 f1 ff ff       	call   800f36 <fd_alloc>
+  801d40:	89 c3                	mov    %eax,%ebx
+  801d42:	83 c4 10             	add    $0x10,%esp
+  801d45:	85 c0                	test   %eax,%eax
+  801d47:	0f 88 23 01 00 00    	js     801e70 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801d4d:	83 ec 04             	sub    $0x4,%esp
+  801d50:	68 07 04 00 00       	push   $0x407
+  801d55:	ff 75 f4             	push   -0xc(%ebp)
+  801d58:	6a 00                	push   $0x0
+  801d5a:	e8 4e ee ff ff       	call   800bad <sys_page_alloc>
+  801d5f:	89 c3                	mov    %eax,%ebx
+  801d61:	83 c4 10             	add    $0x10,%esp
+  801d64:	85 c0                	test   %eax,%eax
+  801d66:	0f 88 04 01 00 00    	js     801e70 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801d6c:	83 ec 0c             	sub    $0xc,%esp
+  801d6f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d72:	50                   	push   %eax
+  801d73:	e8 be f1 ff ff       	call   800f36 <fd_alloc>
+  801d78:	89 c3                	mov    %eax,%ebx
+  801d7a:	83 c4 10             	add    $0x10,%esp
+  801d7d:	85 c0                	test   %eax,%eax
+  801d7f:	0f 88 db 00 00 00    	js     801e60 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801d85:	83 ec 04             	sub    $0x4,%esp
+  801d88:	68 07 04 00 00       	push   $0x407
+  801d8d:	ff 75 f0             	push   -0x10(%ebp)
+  801d90:	6a 00                	push   $0x0
+  801d92:	e8 16 ee ff ff       	call   800bad <sys_page_alloc>
+  801d97:	89 c3                	mov    %eax,%ebx
+  801d99:	83 c4 10             	add    $0x10,%esp
+  801d9c:	85 c0                	test   %eax,%eax
+  801d9e:	0f 88 bc 00 00 00    	js     801e60 <pipe+0x131>
+	va = fd2data(fd0);
+  801da4:	83 ec 0c             	sub    $0xc,%esp
+  801da7:	ff 75 f4             	push   -0xc(%ebp)
+  801daa:	e8 70 f1 ff ff       	call   800f1f <fd2data>
+  801daf:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801db1:	83 c4 0c             	add    $0xc,%esp
+  801db4:	68 07 04 00 00       	push   $0x407
+  801db9:	50                   	push   %eax
+  801dba:	6a 00                	push   $0x0
+  801dbc:	e8 ec ed ff ff       	call   800bad <sys_page_alloc>
+  801dc1:	89 c3                	mov    %eax,%ebx
+  801dc3:	83 c4 10             	add    $0x10,%esp
+  801dc6:	85 c0                	test   %eax,%eax
+  801dc8:	0f 88 82 00 00 00    	js     801e50 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801dce:	83 ec 0c             	sub    $0xc,%esp
+  801dd1:	ff 75 f0             	push   -0x10(%ebp)
+  801dd4:	e8 46 f1 ff ff       	call   800f1f <fd2data>
+  801dd9:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801de0:	50                   	push   %eax
+  801de1:	6a 00                	push   $0x0
+  801de3:	56                   	push   %esi
+  801de4:	6a 00                	push   $0x0
+  801de6:	e8 05 ee ff ff       	call   800bf0 <sys_page_map>
+  801deb:	89 c3                	mov    %eax,%ebx
+  801ded:	83 c4 20             	add    $0x20,%esp
+  801df0:	85 c0                	test   %eax,%eax
+  801df2:	78 4e                	js     801e42 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  801df4:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  801df9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801dfc:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  801dfe:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801e01:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  801e08:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801e0b:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  801e0d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801e10:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  801e17:	83 ec 0c             	sub    $0xc,%esp
+  801e1a:	ff 75 f4             	push   -0xc(%ebp)
+  801e1d:	e8 ed f0 ff ff       	call   800f0f <fd2num>
+  801e22:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801e25:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  801e27:	83 c4 04             	add    $0x4,%esp
+  801e2a:	ff 75 f0             	push   -0x10(%ebp)
+  801e2d:	e8 dd f0 ff ff       	call   800f0f <fd2num>
+  801e32:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801e35:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  801e38:	83 c4 10             	add    $0x10,%esp
+  801e3b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e40:	eb 2e                	jmp    801e70 <pipe+0x141>
+	sys_page_unmap(0, va);
+  801e42:	83 ec 08             	sub    $0x8,%esp
+  801e45:	56                   	push   %esi
+  801e46:	6a 00                	push   $0x0
+  801e48:	e8 e5 ed ff ff       	call   800c32 <sys_page_unmap>
+  801e4d:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  801e50:	83 ec 08             	sub    $0x8,%esp
+  801e53:	ff 75 f0             	push   -0x10(%ebp)
+  801e56:	6a 00                	push   $0x0
+  801e58:	e8 d5 ed ff ff       	call   800c32 <sys_page_unmap>
+  801e5d:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  801e60:	83 ec 08             	sub    $0x8,%esp
+  801e63:	ff 75 f4             	push   -0xc(%ebp)
+  801e66:	6a 00                	push   $0x0
+  801e68:	e8 c5 ed ff ff       	call   800c32 <sys_page_unmap>
+  801e6d:	83 c4 10             	add    $0x10,%esp
+}
+  801e70:	89 d8                	mov    %ebx,%eax
+  801e72:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e75:	5b                   	pop    %ebx
+  801e76:	5e                   	pop    %esi
+  801e77:	5d                   	pop    %ebp
+  801e78:	c3                   	ret
+
+00801e79 <pipeisclosed>:
+{
+  801e79:	55                   	push   %ebp
+  801e7a:	89 e5                	mov    %esp,%ebp
+  801e7c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801e7f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e82:	50                   	push   %eax
+  801e83:	ff 75 08             	push   0x8(%ebp)
+  801e86:	e8 01 f1 ff ff       	call   800f8c <fd_lookup>
+  801e8b:	83 c4 10             	add    $0x10,%esp
+  801e8e:	85 c0                	test   %eax,%eax
+  801e90:	78 18                	js     801eaa <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  801e92:	83 ec 0c             	sub    $0xc,%esp
+  801e95:	ff 75 f4             	push   -0xc(%ebp)
+  801e98:	e8 82 f0 ff ff       	call   800f1f <fd2data>
+  801e9d:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  801e9f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ea2:	e8 33 fd ff ff       	call   801bda <_pipeisclosed>
+  801ea7:	83 c4 10             	add    $0x10,%esp
+}
+  801eaa:	c9                   	leave
+  801eab:	c3                   	ret
+
+00801eac <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  801eac:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eb1:	c3                   	ret
+
+00801eb2 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  801eb2:	55                   	push   %ebp
+  801eb3:	89 e5                	mov    %esp,%ebp
+  801eb5:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  801eb8:	68 87 2b 80 00       	push   $0x802b87
+  801ebd:	ff 75 0c             	push   0xc(%ebp)
+  801ec0:	e8 fc e8 ff ff       	call   8007c1 <strcpy>
+	return 0;
+}
+  801ec5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eca:	c9                   	leave
+  801ecb:	c3                   	ret
+
+00801ecc <devcons_write>:
+{
+  801ecc:	55                   	push   %ebp
+  801ecd:	89 e5                	mov    %esp,%ebp
+  801ecf:	57                   	push   %edi
+  801ed0:	56                   	push   %esi
+  801ed1:	53                   	push   %ebx
+  801ed2:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  801ed8:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  801edd:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  801ee3:	eb 2e                	jmp    801f13 <devcons_write+0x47>
+		m = n - tot;
+  801ee5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801ee8:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  801eea:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801eef:	39 c3                	cmp    %eax,%ebx
+  801ef1:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  801ef4:	83 ec 04             	sub    $0x4,%esp
+  801ef7:	53                   	push   %ebx
+  801ef8:	89 f0                	mov    %esi,%eax
+  801efa:	03 45 0c             	add    0xc(%ebp),%eax
+  801efd:	50                   	push   %eax
+  801efe:	57                   	push   %edi
+  801eff:	e8 43 ea ff ff       	call   800947 <memmove>
+		sys_cputs(buf, m);
+  801f04:	83 c4 08             	add    $0x8,%esp
+  801f07:	53                   	push   %ebx
+  801f08:	57                   	push   %edi
+  801f09:	e8 e3 eb ff ff       	call   800af1 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  801f0e:	01 de                	add    %ebx,%esi
+  801f10:	83 c4 10             	add    $0x10,%esp
+  801f13:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801f16:	72 cd                	jb     801ee5 <devcons_write+0x19>
+}
+  801f18:	89 f0                	mov    %esi,%eax
+  801f1a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f1d:	5b                   	pop    %ebx
+  801f1e:	5e                   	pop    %esi
+  801f1f:	5f                   	pop    %edi
+  801f20:	5d                   	pop    %ebp
+  801f21:	c3                   	ret
+
+00801f22 <devcons_read>:
+{
+  801f22:	55                   	push   %ebp
+  801f23:	89 e5                	mov    %esp,%ebp
+  801f25:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  801f28:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f2d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801f31:	75 07                	jne    801f3a <devcons_read+0x18>
+  801f33:	eb 1f                	jmp    801f54 <devcons_read+0x32>
+		sys_yield();
+  801f35:	e8 54 ec ff ff       	call   800b8e <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  801f3a:	e8 d0 eb ff ff       	call   800b0f <sys_cgetc>
+  801f3f:	85 c0                	test   %eax,%eax
+  801f41:	74 f2                	je     801f35 <devcons_read+0x13>
+	if (c < 0)
+  801f43:	78 0f                	js     801f54 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  801f45:	83 f8 04             	cmp    $0x4,%eax
+  801f48:	74 0c                	je     801f56 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  801f4a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801f4d:	88 02                	mov    %al,(%edx)
+	return 1;
+  801f4f:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  801f54:	c9                   	leave
+  801f55:	c3                   	ret
+		return 0;
+  801f56:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f5b:	eb f7                	jmp    801f54 <devcons_read+0x32>
+
+00801f5d <cputchar>:
+{
+  801f5d:	55                   	push   %ebp
+  801f5e:	89 e5                	mov    %esp,%ebp
+  801f60:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  801f63:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f66:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  801f69:	6a 01                	push   $0x1
+  801f6b:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801f6e:	50                   	push   %eax
+  801f6f:	e8 7d eb ff ff       	call   800af1 <sys_cputs>
+}
+  801f74:	83 c4 10             	add    $0x10,%esp
+  801f77:	c9                   	leave
+  801f78:	c3                   	ret
+
+00801f79 <getchar>:
+{
+  801f79:	55                   	push   %ebp
+  801f7a:	89 e5                	mov    %esp,%ebp
+  801f7c:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  801f7f:	6a 01                	push   $0x1
+  801f81:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801f84:	50                   	push   %eax
+  801f85:	6a 00                	push   $0x0
+  801f87:	e8 66 f2 ff ff       	call   8011f2 <read>
+	if (r < 0)
+  801f8c:	83 c4 10             	add    $0x10,%esp
+  801f8f:	85 c0                	test   %eax,%eax
+  801f91:	78 06                	js     801f99 <getchar+0x20>
+	if (r < 1)
+  801f93:	74 06                	je     801f9b <getchar+0x22>
+	return c;
+  801f95:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  801f99:	c9                   	leave
+  801f9a:	c3                   	ret
+		return -E_EOF;
+  801f9b:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  801fa0:	eb f7                	jmp    801f99 <getchar+0x20>
+
+00801fa2 <iscons>:
+{
+  801fa2:	55                   	push   %ebp
+  801fa3:	89 e5                	mov    %esp,%ebp
+  801fa5:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801fa8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fab:	50                   	push   %eax
+  801fac:	ff 75 08             	push   0x8(%ebp)
+  801faf:	e8 d8 ef ff ff       	call   800f8c <fd_lookup>
+  801fb4:	83 c4 10             	add    $0x10,%esp
+  801fb7:	85 c0                	test   %eax,%eax
+  801fb9:	78 11                	js     801fcc <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  801fbb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801fbe:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  801fc4:	39 10                	cmp    %edx,(%eax)
+  801fc6:	0f 94 c0             	sete   %al
+  801fc9:	0f b6 c0             	movzbl %al,%eax
+}
+  801fcc:	c9                   	leave
+  801fcd:	c3                   	ret
+
+00801fce <opencons>:
+{
+  801fce:	55                   	push   %ebp
+  801fcf:	89 e5                	mov    %esp,%ebp
+  801fd1:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  801fd4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fd7:	50                   	push   %eax
+  801fd8:	e8 59 ef ff ff       	call   800f36 <fd_alloc>
+  801fdd:	83 c4 10             	add    $0x10,%esp
+  801fe0:	85 c0                	test   %eax,%eax
+  801fe2:	78 3a                	js     80201e <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  801fe4:	83 ec 04             	sub    $0x4,%esp
+  801fe7:	68 07 04 00 00       	push   $0x407
+  801fec:	ff 75 f4             	push   -0xc(%ebp)
+  801fef:	6a 00                	push   $0x0
+  801ff1:	e8 b7 eb ff ff       	call   800bad <sys_page_alloc>
+  801ff6:	83 c4 10             	add    $0x10,%esp
+  801ff9:	85 c0                	test   %eax,%eax
+  801ffb:	78 21                	js     80201e <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  801ffd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802000:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  802006:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802008:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80200b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802012:	83 ec 0c             	sub    $0xc,%esp
+  802015:	50                   	push   %eax
+  802016:	e8 f4 ee ff ff       	call   800f0f <fd2num>
+  80201b:	83 c4 10             	add    $0x10,%esp
+}
+  80201e:	c9                   	leave
+  80201f:	c3                   	ret
+
+00802020 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  802020:	55                   	push   %ebp
+  802021:	89 e5                	mov    %esp,%ebp
+  802023:	56                   	push   %esi
+  802024:	53                   	push   %ebx
+  802025:	8b 75 08             	mov    0x8(%ebp),%esi
+  802028:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80202b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  80202e:	85 c0                	test   %eax,%eax
+  802030:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802035:	0f 44 c2             	cmove  %edx,%eax
+  802038:	83 ec 0c             	sub    $0xc,%esp
+  80203b:	50                   	push   %eax
+  80203c:	e8 1c ed ff ff       	call   800d5d <sys_ipc_recv>
+
+  if (from_env_store)
+  802041:	83 c4 10             	add    $0x10,%esp
+  802044:	85 f6                	test   %esi,%esi
+  802046:	74 17                	je     80205f <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  802048:	ba 00 00 00 00       	mov    $0x0,%edx
+  80204d:	85 c0                	test   %eax,%eax
+  80204f:	75 0c                	jne    80205d <ipc_recv+0x3d>
+  802051:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  802057:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  80205d:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  80205f:	85 db                	test   %ebx,%ebx
+  802061:	74 2b                	je     80208e <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  802063:	85 c0                	test   %eax,%eax
+  802065:	74 0d                	je     802074 <ipc_recv+0x54>
+  802067:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  80206d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802070:	5b                   	pop    %ebx
+  802071:	5e                   	pop    %esi
+  802072:	5d                   	pop    %ebp
+  802073:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  802074:	a1 08 40 80 00       	mov    0x804008,%eax
+  802079:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80207f:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  802081:	a1 08 40 80 00       	mov    0x804008,%eax
+  802086:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  80208c:	eb df                	jmp    80206d <ipc_recv+0x4d>
+  80208e:	85 c0                	test   %eax,%eax
+  802090:	75 db                	jne    80206d <ipc_recv+0x4d>
+  802092:	eb ed                	jmp    802081 <ipc_recv+0x61>
+
+00802094 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  802094:	55                   	push   %ebp
+  802095:	89 e5                	mov    %esp,%ebp
+  802097:	57                   	push   %edi
+  802098:	56                   	push   %esi
+  802099:	53                   	push   %ebx
+  80209a:	83 ec 0c             	sub    $0xc,%esp
+  80209d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8020a0:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8020a3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  8020a6:	85 db                	test   %ebx,%ebx
+  8020a8:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8020ad:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  8020b0:	ff 75 14             	push   0x14(%ebp)
+  8020b3:	53                   	push   %ebx
+  8020b4:	56                   	push   %esi
+  8020b5:	57                   	push   %edi
+  8020b6:	e8 7f ec ff ff       	call   800d3a <sys_ipc_try_send>
+  8020bb:	83 c4 10             	add    $0x10,%esp
+  8020be:	85 c0                	test   %eax,%eax
+  8020c0:	74 1e                	je     8020e0 <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  8020c2:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8020c5:	75 07                	jne    8020ce <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  8020c7:	e8 c2 ea ff ff       	call   800b8e <sys_yield>
+  8020cc:	eb e2                	jmp    8020b0 <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  8020ce:	50                   	push   %eax
+  8020cf:	68 93 2b 80 00       	push   $0x802b93
+  8020d4:	6a 3c                	push   $0x3c
+  8020d6:	68 a0 2b 80 00       	push   $0x802ba0
+  8020db:	e8 4d e0 ff ff       	call   80012d <_panic>
+  }
+
+#endif
+}
+  8020e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020e3:	5b                   	pop    %ebx
+  8020e4:	5e                   	pop    %esi
+  8020e5:	5f                   	pop    %edi
+  8020e6:	5d                   	pop    %ebp
+  8020e7:	c3                   	ret
+
+008020e8 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  8020e8:	55                   	push   %ebp
+  8020e9:	89 e5                	mov    %esp,%ebp
+  8020eb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  8020ee:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  8020f3:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8020f6:	c1 e0 04             	shl    $0x4,%eax
+  8020f9:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8020fe:	8b 40 50             	mov    0x50(%eax),%eax
+  802101:	39 c8                	cmp    %ecx,%eax
+  802103:	74 12                	je     802117 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  802105:	83 c2 01             	add    $0x1,%edx
+  802108:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  80210e:	75 e3                	jne    8020f3 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802110:	b8 00 00 00 00       	mov    $0x0,%eax
+  802115:	eb 0e                	jmp    802125 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  802117:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80211a:	c1 e0 04             	shl    $0x4,%eax
+  80211d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802122:	8b 40 48             	mov    0x48(%eax),%eax
+  802125:	5d                   	pop    %ebp
+  802126:	c3                   	ret
+
+00802127 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802127:	55                   	push   %ebp
+  802128:	89 e5                	mov    %esp,%ebp
+  80212a:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80212d:	89 c2                	mov    %eax,%edx
+  80212f:	c1 ea 16             	shr    $0x16,%edx
+  802132:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802139:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80213e:	f6 c1 01             	test   $0x1,%cl
+  802141:	74 1c                	je     80215f <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  802143:	c1 e8 0c             	shr    $0xc,%eax
+  802146:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80214d:	a8 01                	test   $0x1,%al
+  80214f:	74 0e                	je     80215f <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802151:	c1 e8 0c             	shr    $0xc,%eax
+  802154:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  80215b:	ef 
+  80215c:	0f b7 d2             	movzwl %dx,%edx
+}
+  80215f:	89 d0                	mov    %edx,%eax
+  802161:	5d                   	pop    %ebp
+  802162:	c3                   	ret
+  802163:	66 90                	xchg   %ax,%ax
+  802165:	66 90                	xchg   %ax,%ax
+  802167:	66 90                	xchg   %ax,%ax
+  802169:	66 90                	xchg   %ax,%ax
+  80216b:	66 90                	xchg   %ax,%ax
+  80216d:	66 90                	xchg   %ax,%ax
+  80216f:	90                   	nop
+
+00802170 <__udivmoddi4>:
+  802170:	55                   	push   %ebp
+  802171:	57                   	push   %edi
+  802172:	56                   	push   %esi
+  802173:	53                   	push   %ebx
+  802174:	83 ec 24             	sub    $0x24,%esp
+  802177:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80217b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80217f:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  802183:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802187:	8b 54 24 44          	mov    0x44(%esp),%edx
+  80218b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80218f:	8b 44 24 40          	mov    0x40(%esp),%eax
+  802193:	89 d3                	mov    %edx,%ebx
+  802195:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802199:	09 c3                	or     %eax,%ebx
+  80219b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80219f:	0f 84 9c 00 00 00    	je     802241 <__udivmoddi4+0xd1>
+  8021a5:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8021ac:	00 
+  8021ad:	31 c0                	xor    %eax,%eax
+  8021af:	31 d2                	xor    %edx,%edx
+  8021b1:	89 fb                	mov    %edi,%ebx
+  8021b3:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8021ba:	00 
+  8021bb:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8021c0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8021c4:	01 c0                	add    %eax,%eax
+  8021c6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8021cd:	00 
+  8021ce:	89 c6                	mov    %eax,%esi
+  8021d0:	89 d7                	mov    %edx,%edi
+  8021d2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8021d6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8021da:	0f ad d0             	shrd   %cl,%edx,%eax
+  8021dd:	d3 ea                	shr    %cl,%edx
+  8021df:	f6 c1 20             	test   $0x20,%cl
+  8021e2:	0f 45 c2             	cmovne %edx,%eax
+  8021e5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8021e9:	83 e0 01             	and    $0x1,%eax
+  8021ec:	09 fa                	or     %edi,%edx
+  8021ee:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8021f2:	89 04 24             	mov    %eax,(%esp)
+  8021f5:	8b 04 24             	mov    (%esp),%eax
+  8021f8:	89 d5                	mov    %edx,%ebp
+  8021fa:	09 f0                	or     %esi,%eax
+  8021fc:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802200:	39 f0                	cmp    %esi,%eax
+  802202:	19 fd                	sbb    %edi,%ebp
+  802204:	72 1d                	jb     802223 <__udivmoddi4+0xb3>
+  802206:	29 f0                	sub    %esi,%eax
+  802208:	19 fa                	sbb    %edi,%edx
+  80220a:	89 cf                	mov    %ecx,%edi
+  80220c:	c1 ef 05             	shr    $0x5,%edi
+  80220f:	83 e7 01             	and    $0x1,%edi
+  802212:	89 fe                	mov    %edi,%esi
+  802214:	d3 e7                	shl    %cl,%edi
+  802216:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80221a:	83 f6 01             	xor    $0x1,%esi
+  80221d:	d3 e6                	shl    %cl,%esi
+  80221f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802223:	83 e9 01             	sub    $0x1,%ecx
+  802226:	73 98                	jae    8021c0 <__udivmoddi4+0x50>
+  802228:	85 db                	test   %ebx,%ebx
+  80222a:	74 05                	je     802231 <__udivmoddi4+0xc1>
+  80222c:	89 03                	mov    %eax,(%ebx)
+  80222e:	89 53 04             	mov    %edx,0x4(%ebx)
+  802231:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802235:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802239:	83 c4 24             	add    $0x24,%esp
+  80223c:	5b                   	pop    %ebx
+  80223d:	5e                   	pop    %esi
+  80223e:	5f                   	pop    %edi
+  80223f:	5d                   	pop    %ebp
+  802240:	c3                   	ret
+  802241:	85 ff                	test   %edi,%edi
+  802243:	74 0d                	je     802252 <__udivmoddi4+0xe2>
+  802245:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  80224b:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  802252:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802256:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80225a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80225e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802262:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802266:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80226a:	83 c4 24             	add    $0x24,%esp
+  80226d:	5b                   	pop    %ebx
+  80226e:	5e                   	pop    %esi
+  80226f:	5f                   	pop    %edi
+  802270:	5d                   	pop    %ebp
+  802271:	c3                   	ret
+  802272:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802279:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00802280 <__udivdi3>:
+  802280:	57                   	push   %edi
+  802281:	56                   	push   %esi
+  802282:	53                   	push   %ebx
+  802283:	83 ec 20             	sub    $0x20,%esp
+  802286:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80228a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80228e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802292:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802296:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80229a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80229e:	89 d1                	mov    %edx,%ecx
+  8022a0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8022a4:	09 c1                	or     %eax,%ecx
+  8022a6:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8022aa:	89 44 24 18          	mov    %eax,0x18(%esp)
+  8022ae:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  8022b2:	0f 84 88 00 00 00    	je     802340 <__udivdi3+0xc0>
+  8022b8:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8022bf:	00 
+  8022c0:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8022c5:	31 c0                	xor    %eax,%eax
+  8022c7:	31 d2                	xor    %edx,%edx
+  8022c9:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8022d0:	00 
+  8022d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8022d8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8022dc:	01 c0                	add    %eax,%eax
+  8022de:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8022e5:	00 
+  8022e6:	89 c6                	mov    %eax,%esi
+  8022e8:	89 d7                	mov    %edx,%edi
+  8022ea:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8022ee:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8022f2:	0f ad d0             	shrd   %cl,%edx,%eax
+  8022f5:	d3 ea                	shr    %cl,%edx
+  8022f7:	f6 c1 20             	test   $0x20,%cl
+  8022fa:	0f 45 c2             	cmovne %edx,%eax
+  8022fd:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802301:	83 e0 01             	and    $0x1,%eax
+  802304:	09 fa                	or     %edi,%edx
+  802306:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80230a:	89 04 24             	mov    %eax,(%esp)
+  80230d:	8b 04 24             	mov    (%esp),%eax
+  802310:	89 d3                	mov    %edx,%ebx
+  802312:	09 f0                	or     %esi,%eax
+  802314:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802318:	39 f0                	cmp    %esi,%eax
+  80231a:	19 fb                	sbb    %edi,%ebx
+  80231c:	72 1d                	jb     80233b <__udivdi3+0xbb>
+  80231e:	29 f0                	sub    %esi,%eax
+  802320:	19 fa                	sbb    %edi,%edx
+  802322:	89 cf                	mov    %ecx,%edi
+  802324:	c1 ef 05             	shr    $0x5,%edi
+  802327:	83 e7 01             	and    $0x1,%edi
+  80232a:	89 fe                	mov    %edi,%esi
+  80232c:	d3 e7                	shl    %cl,%edi
+  80232e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802332:	83 f6 01             	xor    $0x1,%esi
+  802335:	d3 e6                	shl    %cl,%esi
+  802337:	09 74 24 18          	or     %esi,0x18(%esp)
+  80233b:	83 e9 01             	sub    $0x1,%ecx
+  80233e:	73 98                	jae    8022d8 <__udivdi3+0x58>
+  802340:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802344:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802348:	83 c4 20             	add    $0x20,%esp
+  80234b:	5b                   	pop    %ebx
+  80234c:	5e                   	pop    %esi
+  80234d:	5f                   	pop    %edi
+  80234e:	c3                   	ret
+  80234f:	90                   	nop
+
+00802350 <__umoddi3>:
+  802350:	57                   	push   %edi
+  802351:	56                   	push   %esi
+  802352:	53                   	push   %ebx
+  802353:	83 ec 18             	sub    $0x18,%esp
+  802356:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80235a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80235e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802362:	8b 54 24 34          	mov    0x34(%esp),%edx
+  802366:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80236a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80236e:	89 d1                	mov    %edx,%ecx
+  802370:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802374:	09 c1                	or     %eax,%ecx
+  802376:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80237a:	74 5b                	je     8023d7 <__umoddi3+0x87>
+  80237c:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802381:	31 c0                	xor    %eax,%eax
+  802383:	31 d2                	xor    %edx,%edx
+  802385:	8d 76 00             	lea    0x0(%esi),%esi
+  802388:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80238c:	01 c0                	add    %eax,%eax
+  80238e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802395:	00 
+  802396:	89 c6                	mov    %eax,%esi
+  802398:	89 d7                	mov    %edx,%edi
+  80239a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80239e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8023a2:	0f ad d0             	shrd   %cl,%edx,%eax
+  8023a5:	d3 ea                	shr    %cl,%edx
+  8023a7:	f6 c1 20             	test   $0x20,%cl
+  8023aa:	0f 45 c2             	cmovne %edx,%eax
+  8023ad:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8023b1:	83 e0 01             	and    $0x1,%eax
+  8023b4:	09 fa                	or     %edi,%edx
+  8023b6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8023ba:	89 04 24             	mov    %eax,(%esp)
+  8023bd:	8b 04 24             	mov    (%esp),%eax
+  8023c0:	89 d3                	mov    %edx,%ebx
+  8023c2:	09 f0                	or     %esi,%eax
+  8023c4:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8023c8:	39 f0                	cmp    %esi,%eax
+  8023ca:	19 fb                	sbb    %edi,%ebx
+  8023cc:	72 04                	jb     8023d2 <__umoddi3+0x82>
+  8023ce:	29 f0                	sub    %esi,%eax
+  8023d0:	19 fa                	sbb    %edi,%edx
+  8023d2:	83 e9 01             	sub    $0x1,%ecx
+  8023d5:	73 b1                	jae    802388 <__umoddi3+0x38>
+  8023d7:	83 c4 18             	add    $0x18,%esp
+  8023da:	5b                   	pop    %ebx
+  8023db:	5e                   	pop    %esi
+  8023dc:	5f                   	pop    %edi
+  8023dd:	c3                   	ret
+  8023de:	66 90                	xchg   %ax,%ax
+
+008023e0 <__divdi3>:
+  8023e0:	55                   	push   %ebp
+  8023e1:	57                   	push   %edi
+  8023e2:	56                   	push   %esi
+  8023e3:	53                   	push   %ebx
+  8023e4:	83 ec 24             	sub    $0x24,%esp
+  8023e7:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  8023eb:	8b 74 24 44          	mov    0x44(%esp),%esi
+  8023ef:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8023f3:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8023f7:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  8023fb:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8023ff:	85 d2                	test   %edx,%edx
+  802401:	0f 88 e0 00 00 00    	js     8024e7 <__divdi3+0x107>
+  802407:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  80240b:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  80240f:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802413:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802417:	85 f6                	test   %esi,%esi
+  802419:	78 16                	js     802431 <__divdi3+0x51>
+  80241b:	89 f1                	mov    %esi,%ecx
+  80241d:	31 c0                	xor    %eax,%eax
+  80241f:	31 d2                	xor    %edx,%edx
+  802421:	09 d9                	or     %ebx,%ecx
+  802423:	0f 85 f3 00 00 00    	jne    80251c <__divdi3+0x13c>
+  802429:	83 c4 24             	add    $0x24,%esp
+  80242c:	5b                   	pop    %ebx
+  80242d:	5e                   	pop    %esi
+  80242e:	5f                   	pop    %edi
+  80242f:	5d                   	pop    %ebp
+  802430:	c3                   	ret
+  802431:	bf 01 00 00 00       	mov    $0x1,%edi
+  802436:	f7 5c 24 08          	negl   0x8(%esp)
+  80243a:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  80243f:	f7 5c 24 0c          	negl   0xc(%esp)
+  802443:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80244a:	00 
+  80244b:	31 c0                	xor    %eax,%eax
+  80244d:	31 d2                	xor    %edx,%edx
+  80244f:	89 fb                	mov    %edi,%ebx
+  802451:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802458:	00 
+  802459:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80245e:	66 90                	xchg   %ax,%ax
+  802460:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802464:	01 c0                	add    %eax,%eax
+  802466:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80246d:	00 
+  80246e:	89 c6                	mov    %eax,%esi
+  802470:	89 d7                	mov    %edx,%edi
+  802472:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802476:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80247a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80247d:	d3 ea                	shr    %cl,%edx
+  80247f:	f6 c1 20             	test   $0x20,%cl
+  802482:	0f 45 c2             	cmovne %edx,%eax
+  802485:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802489:	83 e0 01             	and    $0x1,%eax
+  80248c:	09 fa                	or     %edi,%edx
+  80248e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802492:	89 04 24             	mov    %eax,(%esp)
+  802495:	8b 04 24             	mov    (%esp),%eax
+  802498:	89 d5                	mov    %edx,%ebp
+  80249a:	09 f0                	or     %esi,%eax
+  80249c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8024a0:	39 f0                	cmp    %esi,%eax
+  8024a2:	19 fd                	sbb    %edi,%ebp
+  8024a4:	72 1d                	jb     8024c3 <__divdi3+0xe3>
+  8024a6:	29 f0                	sub    %esi,%eax
+  8024a8:	19 fa                	sbb    %edi,%edx
+  8024aa:	89 cf                	mov    %ecx,%edi
+  8024ac:	c1 ef 05             	shr    $0x5,%edi
+  8024af:	83 e7 01             	and    $0x1,%edi
+  8024b2:	89 fe                	mov    %edi,%esi
+  8024b4:	d3 e7                	shl    %cl,%edi
+  8024b6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8024ba:	83 f6 01             	xor    $0x1,%esi
+  8024bd:	d3 e6                	shl    %cl,%esi
+  8024bf:	09 74 24 18          	or     %esi,0x18(%esp)
+  8024c3:	83 e9 01             	sub    $0x1,%ecx
+  8024c6:	73 98                	jae    802460 <__divdi3+0x80>
+  8024c8:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8024cc:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8024d0:	85 db                	test   %ebx,%ebx
+  8024d2:	0f 84 51 ff ff ff    	je     802429 <__divdi3+0x49>
+  8024d8:	f7 d8                	neg    %eax
+  8024da:	83 d2 00             	adc    $0x0,%edx
+  8024dd:	83 c4 24             	add    $0x24,%esp
+  8024e0:	5b                   	pop    %ebx
+  8024e1:	f7 da                	neg    %edx
+  8024e3:	5e                   	pop    %esi
+  8024e4:	5f                   	pop    %edi
+  8024e5:	5d                   	pop    %ebp
+  8024e6:	c3                   	ret
+  8024e7:	f7 d8                	neg    %eax
+  8024e9:	83 d2 00             	adc    $0x0,%edx
+  8024ec:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8024f0:	f7 da                	neg    %edx
+  8024f2:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8024f6:	85 f6                	test   %esi,%esi
+  8024f8:	78 1b                	js     802515 <__divdi3+0x135>
+  8024fa:	89 f1                	mov    %esi,%ecx
+  8024fc:	31 c0                	xor    %eax,%eax
+  8024fe:	31 d2                	xor    %edx,%edx
+  802500:	bf 01 00 00 00       	mov    $0x1,%edi
+  802505:	09 d9                	or     %ebx,%ecx
+  802507:	0f 85 36 ff ff ff    	jne    802443 <__divdi3+0x63>
+  80250d:	83 c4 24             	add    $0x24,%esp
+  802510:	5b                   	pop    %ebx
+  802511:	5e                   	pop    %esi
+  802512:	5f                   	pop    %edi
+  802513:	5d                   	pop    %ebp
+  802514:	c3                   	ret
+  802515:	31 ff                	xor    %edi,%edi
+  802517:	e9 1a ff ff ff       	jmp    802436 <__divdi3+0x56>
+  80251c:	31 ff                	xor    %edi,%edi
+  80251e:	e9 20 ff ff ff       	jmp    802443 <__divdi3+0x63>
+  802523:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80252a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00802530 <__moddi3>:
+  802530:	55                   	push   %ebp
+  802531:	57                   	push   %edi
+  802532:	56                   	push   %esi
+  802533:	53                   	push   %ebx
+  802534:	83 ec 1c             	sub    $0x1c,%esp
+  802537:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  80253b:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  80253f:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  802543:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  802547:	89 c8                	mov    %ecx,%eax
+  802549:	89 f2                	mov    %esi,%edx
+  80254b:	89 f3                	mov    %esi,%ebx
+  80254d:	85 ed                	test   %ebp,%ebp
+  80254f:	0f 88 9d 00 00 00    	js     8025f2 <__moddi3+0xc2>
+  802555:	09 cb                	or     %ecx,%ebx
+  802557:	0f 84 8d 00 00 00    	je     8025ea <__moddi3+0xba>
+  80255d:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802561:	31 db                	xor    %ebx,%ebx
+  802563:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802567:	89 ca                	mov    %ecx,%edx
+  802569:	89 f0                	mov    %esi,%eax
+  80256b:	89 dd                	mov    %ebx,%ebp
+  80256d:	f7 da                	neg    %edx
+  80256f:	83 d0 00             	adc    $0x0,%eax
+  802572:	f7 d8                	neg    %eax
+  802574:	0f 49 f0             	cmovns %eax,%esi
+  802577:	0f 49 ca             	cmovns %edx,%ecx
+  80257a:	31 c0                	xor    %eax,%eax
+  80257c:	31 d2                	xor    %edx,%edx
+  80257e:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802582:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802586:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80258b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80258f:	90                   	nop
+  802590:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802594:	01 c0                	add    %eax,%eax
+  802596:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80259d:	00 
+  80259e:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  8025a2:	89 c6                	mov    %eax,%esi
+  8025a4:	89 d7                	mov    %edx,%edi
+  8025a6:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8025aa:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8025ae:	0f ad d0             	shrd   %cl,%edx,%eax
+  8025b1:	d3 ea                	shr    %cl,%edx
+  8025b3:	f6 c1 20             	test   $0x20,%cl
+  8025b6:	0f 45 c2             	cmovne %edx,%eax
+  8025b9:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8025bd:	83 e0 01             	and    $0x1,%eax
+  8025c0:	09 fa                	or     %edi,%edx
+  8025c2:	89 04 24             	mov    %eax,(%esp)
+  8025c5:	8b 04 24             	mov    (%esp),%eax
+  8025c8:	89 d7                	mov    %edx,%edi
+  8025ca:	09 f0                	or     %esi,%eax
+  8025cc:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  8025d0:	39 d8                	cmp    %ebx,%eax
+  8025d2:	19 f7                	sbb    %esi,%edi
+  8025d4:	72 04                	jb     8025da <__moddi3+0xaa>
+  8025d6:	29 d8                	sub    %ebx,%eax
+  8025d8:	19 f2                	sbb    %esi,%edx
+  8025da:	83 e9 01             	sub    $0x1,%ecx
+  8025dd:	73 b1                	jae    802590 <__moddi3+0x60>
+  8025df:	85 ed                	test   %ebp,%ebp
+  8025e1:	74 07                	je     8025ea <__moddi3+0xba>
+  8025e3:	f7 d8                	neg    %eax
+  8025e5:	83 d2 00             	adc    $0x0,%edx
+  8025e8:	f7 da                	neg    %edx
+  8025ea:	83 c4 1c             	add    $0x1c,%esp
+  8025ed:	5b                   	pop    %ebx
+  8025ee:	5e                   	pop    %esi
+  8025ef:	5f                   	pop    %edi
+  8025f0:	5d                   	pop    %ebp
+  8025f1:	c3                   	ret
+  8025f2:	09 cb                	or     %ecx,%ebx
+  8025f4:	74 f4                	je     8025ea <__moddi3+0xba>
+  8025f6:	f7 df                	neg    %edi
+  8025f8:	bb 01 00 00 00       	mov    $0x1,%ebx
+  8025fd:	83 d5 00             	adc    $0x0,%ebp
+  802600:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802604:	f7 dd                	neg    %ebp
+  802606:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  80260a:	e9 58 ff ff ff       	jmp    802567 <__moddi3+0x37>
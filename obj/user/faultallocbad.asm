@@ -0,0 +1,5423 @@
+
+obj/user/faultallocbad.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 84 00 00 00       	call   8000b5 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <handler>:
+
+#include <inc/lib.h>
+
+void
+handler(struct UTrapframe *utf)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	void *addr = (void*)utf->utf_fault_va;
+  80003a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80003d:	8b 18                	mov    (%eax),%ebx
+
+	cprintf("fault %x\n", addr);
+  80003f:	53                   	push   %ebx
+  800040:	68 00 26 80 00       	push   $0x802600
+  800045:	e8 a9 01 00 00       	call   8001f3 <cprintf>
+	if ((r = sys_page_alloc(0, ROUNDDOWN(addr, PGSIZE),
+  80004a:	83 c4 0c             	add    $0xc,%esp
+  80004d:	6a 07                	push   $0x7
+  80004f:	89 d8                	mov    %ebx,%eax
+  800051:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800056:	50                   	push   %eax
+  800057:	6a 00                	push   $0x0
+  800059:	e8 3a 0b 00 00       	call   800b98 <sys_page_alloc>
+  80005e:	83 c4 10             	add    $0x10,%esp
+  800061:	85 c0                	test   %eax,%eax
+  800063:	78 16                	js     80007b <handler+0x48>
+				PTE_P|PTE_U|PTE_W)) < 0)
+		panic("allocating at %x in page fault handler: %e", addr, r);
+	snprintf((char*) addr, 100, "this string was faulted in at %x", addr);
+  800065:	53                   	push   %ebx
+  800066:	68 4c 26 80 00       	push   $0x80264c
+  80006b:	6a 64                	push   $0x64
+  80006d:	53                   	push   %ebx
+  80006e:	e8 e4 06 00 00       	call   800757 <snprintf>
+}
+  800073:	83 c4 10             	add    $0x10,%esp
+  800076:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800079:	c9                   	leave
+  80007a:	c3                   	ret
+		panic("allocating at %x in page fault handler: %e", addr, r);
+  80007b:	83 ec 0c             	sub    $0xc,%esp
+  80007e:	50                   	push   %eax
+  80007f:	53                   	push   %ebx
+  800080:	68 20 26 80 00       	push   $0x802620
+  800085:	6a 0f                	push   $0xf
+  800087:	68 0a 26 80 00       	push   $0x80260a
+  80008c:	e8 87 00 00 00       	call   800118 <_panic>
+
+00800091 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800091:	55                   	push   %ebp
+  800092:	89 e5                	mov    %esp,%ebp
+  800094:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(handler);
+  800097:	68 33 00 80 00       	push   $0x800033
+  80009c:	e8 ca 0d 00 00       	call   800e6b <set_pgfault_handler>
+	sys_cputs((char*)0xDEADBEEF, 4);
+  8000a1:	83 c4 08             	add    $0x8,%esp
+  8000a4:	6a 04                	push   $0x4
+  8000a6:	68 ef be ad de       	push   $0xdeadbeef
+  8000ab:	e8 2c 0a 00 00       	call   800adc <sys_cputs>
+}
+  8000b0:	83 c4 10             	add    $0x10,%esp
+  8000b3:	c9                   	leave
+  8000b4:	c3                   	ret
+
+008000b5 <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  8000b5:	55                   	push   %ebp
+  8000b6:	89 e5                	mov    %esp,%ebp
+  8000b8:	56                   	push   %esi
+  8000b9:	53                   	push   %ebx
+  8000ba:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000bd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  8000c0:	e8 95 0a 00 00       	call   800b5a <sys_getenvid>
+  8000c5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000ca:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8000cd:	c1 e0 04             	shl    $0x4,%eax
+  8000d0:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000d5:	a3 08 40 80 00       	mov    %eax,0x804008
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8000da:	85 db                	test   %ebx,%ebx
+  8000dc:	7e 07                	jle    8000e5 <libmain+0x30>
+    binaryname = argv[0];
+  8000de:	8b 06                	mov    (%esi),%eax
+  8000e0:	a3 00 30 80 00       	mov    %eax,0x803000
+
+  // call user main routine
+  umain(argc, argv);
+  8000e5:	83 ec 08             	sub    $0x8,%esp
+  8000e8:	56                   	push   %esi
+  8000e9:	53                   	push   %ebx
+  8000ea:	e8 a2 ff ff ff       	call   800091 <umain>
+
+  // exit gracefully
+  exit();
+  8000ef:	e8 0a 00 00 00       	call   8000fe <exit>
+}
+  8000f4:	83 c4 10             	add    $0x10,%esp
+  8000f7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000fa:	5b                   	pop    %ebx
+  8000fb:	5e                   	pop    %esi
+  8000fc:	5d                   	pop    %ebp
+  8000fd:	c3                   	ret
+
+008000fe <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000fe:	55                   	push   %ebp
+  8000ff:	89 e5                	mov    %esp,%ebp
+  800101:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800104:	e8 c5 0f 00 00       	call   8010ce <close_all>
+	sys_env_destroy(0);
+  800109:	83 ec 0c             	sub    $0xc,%esp
+  80010c:	6a 00                	push   $0x0
+  80010e:	e8 06 0a 00 00       	call   800b19 <sys_env_destroy>
+}
+  800113:	83 c4 10             	add    $0x10,%esp
+  800116:	c9                   	leave
+  800117:	c3                   	ret
+
+00800118 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800118:	55                   	push   %ebp
+  800119:	89 e5                	mov    %esp,%ebp
+  80011b:	56                   	push   %esi
+  80011c:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80011d:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800120:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  800126:	e8 2f 0a 00 00       	call   800b5a <sys_getenvid>
+  80012b:	83 ec 0c             	sub    $0xc,%esp
+  80012e:	ff 75 0c             	push   0xc(%ebp)
+  800131:	ff 75 08             	push   0x8(%ebp)
+  800134:	56                   	push   %esi
+  800135:	50                   	push   %eax
+  800136:	68 78 26 80 00       	push   $0x802678
+  80013b:	e8 b3 00 00 00       	call   8001f3 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800140:	83 c4 18             	add    $0x18,%esp
+  800143:	53                   	push   %ebx
+  800144:	ff 75 10             	push   0x10(%ebp)
+  800147:	e8 56 00 00 00       	call   8001a2 <vcprintf>
+	cprintf("\n");
+  80014c:	c7 04 24 60 2b 80 00 	movl   $0x802b60,(%esp)
+  800153:	e8 9b 00 00 00       	call   8001f3 <cprintf>
+  800158:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80015b:	cc                   	int3
+	while (1)
+  80015c:	eb fd                	jmp    80015b <_panic+0x43>
+
+0080015e <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80015e:	55                   	push   %ebp
+  80015f:	89 e5                	mov    %esp,%ebp
+  800161:	53                   	push   %ebx
+  800162:	83 ec 04             	sub    $0x4,%esp
+  800165:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800168:	8b 13                	mov    (%ebx),%edx
+  80016a:	8d 42 01             	lea    0x1(%edx),%eax
+  80016d:	89 03                	mov    %eax,(%ebx)
+  80016f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800172:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800176:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80017b:	74 09                	je     800186 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80017d:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800181:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800184:	c9                   	leave
+  800185:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800186:	83 ec 08             	sub    $0x8,%esp
+  800189:	68 ff 00 00 00       	push   $0xff
+  80018e:	8d 43 08             	lea    0x8(%ebx),%eax
+  800191:	50                   	push   %eax
+  800192:	e8 45 09 00 00       	call   800adc <sys_cputs>
+		b->idx = 0;
+  800197:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80019d:	83 c4 10             	add    $0x10,%esp
+  8001a0:	eb db                	jmp    80017d <putch+0x1f>
+
+008001a2 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001a2:	55                   	push   %ebp
+  8001a3:	89 e5                	mov    %esp,%ebp
+  8001a5:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001ab:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001b2:	00 00 00 
+	b.cnt = 0;
+  8001b5:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001bc:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001bf:	ff 75 0c             	push   0xc(%ebp)
+  8001c2:	ff 75 08             	push   0x8(%ebp)
+  8001c5:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001cb:	50                   	push   %eax
+  8001cc:	68 5e 01 80 00       	push   $0x80015e
+  8001d1:	e8 14 01 00 00       	call   8002ea <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8001d6:	83 c4 08             	add    $0x8,%esp
+  8001d9:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001df:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001e5:	50                   	push   %eax
+  8001e6:	e8 f1 08 00 00       	call   800adc <sys_cputs>
+
+	return b.cnt;
+}
+  8001eb:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001f1:	c9                   	leave
+  8001f2:	c3                   	ret
+
+008001f3 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001f3:	55                   	push   %ebp
+  8001f4:	89 e5                	mov    %esp,%ebp
+  8001f6:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8001f9:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8001fc:	50                   	push   %eax
+  8001fd:	ff 75 08             	push   0x8(%ebp)
+  800200:	e8 9d ff ff ff       	call   8001a2 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800205:	c9                   	leave
+  800206:	c3                   	ret
+
+00800207 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800207:	55                   	push   %ebp
+  800208:	89 e5                	mov    %esp,%ebp
+  80020a:	57                   	push   %edi
+  80020b:	56                   	push   %esi
+  80020c:	53                   	push   %ebx
+  80020d:	83 ec 1c             	sub    $0x1c,%esp
+  800210:	89 c7                	mov    %eax,%edi
+  800212:	89 d6                	mov    %edx,%esi
+  800214:	8b 45 08             	mov    0x8(%ebp),%eax
+  800217:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80021a:	89 d1                	mov    %edx,%ecx
+  80021c:	89 c2                	mov    %eax,%edx
+  80021e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800221:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800224:	8b 45 10             	mov    0x10(%ebp),%eax
+  800227:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80022a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80022d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800234:	39 c2                	cmp    %eax,%edx
+  800236:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800239:	72 3e                	jb     800279 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80023b:	83 ec 0c             	sub    $0xc,%esp
+  80023e:	ff 75 18             	push   0x18(%ebp)
+  800241:	83 eb 01             	sub    $0x1,%ebx
+  800244:	53                   	push   %ebx
+  800245:	50                   	push   %eax
+  800246:	83 ec 08             	sub    $0x8,%esp
+  800249:	ff 75 e4             	push   -0x1c(%ebp)
+  80024c:	ff 75 e0             	push   -0x20(%ebp)
+  80024f:	ff 75 dc             	push   -0x24(%ebp)
+  800252:	ff 75 d8             	push   -0x28(%ebp)
+  800255:	e8 06 20 00 00       	call   802260 <__udivdi3>
+  80025a:	83 c4 18             	add    $0x18,%esp
+  80025d:	52                   	push   %edx
+  80025e:	50                   	push   %eax
+  80025f:	89 f2                	mov    %esi,%edx
+  800261:	89 f8                	mov    %edi,%eax
+  800263:	e8 9f ff ff ff       	call   800207 <printnum>
+  800268:	83 c4 20             	add    $0x20,%esp
+  80026b:	eb 13                	jmp    800280 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80026d:	83 ec 08             	sub    $0x8,%esp
+  800270:	56                   	push   %esi
+  800271:	ff 75 18             	push   0x18(%ebp)
+  800274:	ff d7                	call   *%edi
+  800276:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800279:	83 eb 01             	sub    $0x1,%ebx
+  80027c:	85 db                	test   %ebx,%ebx
+  80027e:	7f ed                	jg     80026d <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800280:	83 ec 08             	sub    $0x8,%esp
+  800283:	56                   	push   %esi
+  800284:	83 ec 04             	sub    $0x4,%esp
+  800287:	ff 75 e4             	push   -0x1c(%ebp)
+  80028a:	ff 75 e0             	push   -0x20(%ebp)
+  80028d:	ff 75 dc             	push   -0x24(%ebp)
+  800290:	ff 75 d8             	push   -0x28(%ebp)
+  800293:	e8 98 20 00 00       	call   802330 <__umoddi3>
+  800298:	83 c4 14             	add    $0x14,%esp
+  80029b:	0f be 80 9b 26 80 00 	movsbl 0x80269b(%eax),%eax
+  8002a2:	50                   	push   %eax
+  8002a3:	ff d7                	call   *%edi
+}
+  8002a5:	83 c4 10             	add    $0x10,%esp
+  8002a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002ab:	5b                   	pop    %ebx
+  8002ac:	5e                   	pop    %esi
+  8002ad:	5f                   	pop    %edi
+  8002ae:	5d                   	pop    %ebp
+  8002af:	c3                   	ret
+
+008002b0 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002b0:	55                   	push   %ebp
+  8002b1:	89 e5                	mov    %esp,%ebp
+  8002b3:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8002b6:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002ba:	8b 10                	mov    (%eax),%edx
+  8002bc:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002bf:	73 0a                	jae    8002cb <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8002c1:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002c4:	89 08                	mov    %ecx,(%eax)
+  8002c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002c9:	88 02                	mov    %al,(%edx)
+}
+  8002cb:	5d                   	pop    %ebp
+  8002cc:	c3                   	ret
+
+008002cd <printfmt>:
+{
+  8002cd:	55                   	push   %ebp
+  8002ce:	89 e5                	mov    %esp,%ebp
+  8002d0:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8002d3:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8002d6:	50                   	push   %eax
+  8002d7:	ff 75 10             	push   0x10(%ebp)
+  8002da:	ff 75 0c             	push   0xc(%ebp)
+  8002dd:	ff 75 08             	push   0x8(%ebp)
+  8002e0:	e8 05 00 00 00       	call   8002ea <vprintfmt>
+}
+  8002e5:	83 c4 10             	add    $0x10,%esp
+  8002e8:	c9                   	leave
+  8002e9:	c3                   	ret
+
+008002ea <vprintfmt>:
+{
+  8002ea:	55                   	push   %ebp
+  8002eb:	89 e5                	mov    %esp,%ebp
+  8002ed:	57                   	push   %edi
+  8002ee:	56                   	push   %esi
+  8002ef:	53                   	push   %ebx
+  8002f0:	83 ec 2c             	sub    $0x2c,%esp
+  8002f3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8002f6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8002f9:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8002fc:	eb 0a                	jmp    800308 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8002fe:	83 ec 08             	sub    $0x8,%esp
+  800301:	53                   	push   %ebx
+  800302:	50                   	push   %eax
+  800303:	ff d6                	call   *%esi
+  800305:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800308:	83 c7 01             	add    $0x1,%edi
+  80030b:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80030f:	83 f8 25             	cmp    $0x25,%eax
+  800312:	74 0c                	je     800320 <vprintfmt+0x36>
+			if (ch == '\0')
+  800314:	85 c0                	test   %eax,%eax
+  800316:	75 e6                	jne    8002fe <vprintfmt+0x14>
+}
+  800318:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80031b:	5b                   	pop    %ebx
+  80031c:	5e                   	pop    %esi
+  80031d:	5f                   	pop    %edi
+  80031e:	5d                   	pop    %ebp
+  80031f:	c3                   	ret
+		padc = ' ';
+  800320:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800324:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80032b:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800332:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800339:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80033e:	8d 47 01             	lea    0x1(%edi),%eax
+  800341:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800344:	0f b6 17             	movzbl (%edi),%edx
+  800347:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80034a:	3c 55                	cmp    $0x55,%al
+  80034c:	0f 87 9a 03 00 00    	ja     8006ec <vprintfmt+0x402>
+  800352:	0f b6 c0             	movzbl %al,%eax
+  800355:	ff 24 85 e0 27 80 00 	jmp    *0x8027e0(,%eax,4)
+  80035c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  80035f:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800363:	eb d9                	jmp    80033e <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800365:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800368:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80036c:	eb d0                	jmp    80033e <vprintfmt+0x54>
+  80036e:	0f b6 d2             	movzbl %dl,%edx
+  800371:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800374:	b8 00 00 00 00       	mov    $0x0,%eax
+  800379:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80037c:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80037f:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800383:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800386:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800389:	83 f9 09             	cmp    $0x9,%ecx
+  80038c:	77 55                	ja     8003e3 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  80038e:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800391:	eb e9                	jmp    80037c <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800393:	8b 45 14             	mov    0x14(%ebp),%eax
+  800396:	8b 00                	mov    (%eax),%eax
+  800398:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80039b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80039e:	8d 40 04             	lea    0x4(%eax),%eax
+  8003a1:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003a4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8003a7:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003ab:	79 91                	jns    80033e <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8003ad:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003b0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003b3:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003ba:	eb 82                	jmp    80033e <vprintfmt+0x54>
+			if (width < 0)
+  8003bc:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003bf:	85 d2                	test   %edx,%edx
+  8003c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003c6:	0f 49 c2             	cmovns %edx,%eax
+  8003c9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003cc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003cf:	e9 6a ff ff ff       	jmp    80033e <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003d4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8003d7:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8003de:	e9 5b ff ff ff       	jmp    80033e <vprintfmt+0x54>
+  8003e3:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003e6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003e9:	eb bc                	jmp    8003a7 <vprintfmt+0xbd>
+			lflag++;
+  8003eb:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003ee:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003f1:	e9 48 ff ff ff       	jmp    80033e <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8003f6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003f9:	8d 78 04             	lea    0x4(%eax),%edi
+  8003fc:	83 ec 08             	sub    $0x8,%esp
+  8003ff:	53                   	push   %ebx
+  800400:	ff 30                	push   (%eax)
+  800402:	ff d6                	call   *%esi
+			break;
+  800404:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800407:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80040a:	e9 7c 02 00 00       	jmp    80068b <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  80040f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800412:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800415:	8b 10                	mov    (%eax),%edx
+  800417:	89 d0                	mov    %edx,%eax
+  800419:	f7 d8                	neg    %eax
+  80041b:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80041e:	83 f8 10             	cmp    $0x10,%eax
+  800421:	7f 23                	jg     800446 <vprintfmt+0x15c>
+  800423:	8b 14 85 40 29 80 00 	mov    0x802940(,%eax,4),%edx
+  80042a:	85 d2                	test   %edx,%edx
+  80042c:	74 18                	je     800446 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  80042e:	52                   	push   %edx
+  80042f:	68 f5 2a 80 00       	push   $0x802af5
+  800434:	53                   	push   %ebx
+  800435:	56                   	push   %esi
+  800436:	e8 92 fe ff ff       	call   8002cd <printfmt>
+  80043b:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80043e:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800441:	e9 45 02 00 00       	jmp    80068b <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  800446:	50                   	push   %eax
+  800447:	68 b3 26 80 00       	push   $0x8026b3
+  80044c:	53                   	push   %ebx
+  80044d:	56                   	push   %esi
+  80044e:	e8 7a fe ff ff       	call   8002cd <printfmt>
+  800453:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800456:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800459:	e9 2d 02 00 00       	jmp    80068b <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80045e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800461:	83 c0 04             	add    $0x4,%eax
+  800464:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800467:	8b 45 14             	mov    0x14(%ebp),%eax
+  80046a:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80046c:	85 c9                	test   %ecx,%ecx
+  80046e:	b8 ac 26 80 00       	mov    $0x8026ac,%eax
+  800473:	0f 45 c1             	cmovne %ecx,%eax
+  800476:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800479:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80047d:	7e 06                	jle    800485 <vprintfmt+0x19b>
+  80047f:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800483:	75 0b                	jne    800490 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800485:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800488:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80048b:	89 75 08             	mov    %esi,0x8(%ebp)
+  80048e:	eb 5c                	jmp    8004ec <vprintfmt+0x202>
+  800490:	83 ec 08             	sub    $0x8,%esp
+  800493:	ff 75 d0             	push   -0x30(%ebp)
+  800496:	ff 75 cc             	push   -0x34(%ebp)
+  800499:	e8 eb 02 00 00       	call   800789 <strnlen>
+  80049e:	89 c2                	mov    %eax,%edx
+  8004a0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004a3:	29 d0                	sub    %edx,%eax
+  8004a5:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8004a8:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004ac:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004af:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004b2:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004b4:	eb 0e                	jmp    8004c4 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8004b6:	83 ec 08             	sub    $0x8,%esp
+  8004b9:	53                   	push   %ebx
+  8004ba:	57                   	push   %edi
+  8004bb:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004be:	83 ee 01             	sub    $0x1,%esi
+  8004c1:	83 c4 10             	add    $0x10,%esp
+  8004c4:	85 f6                	test   %esi,%esi
+  8004c6:	7f ee                	jg     8004b6 <vprintfmt+0x1cc>
+  8004c8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004cb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004ce:	85 c0                	test   %eax,%eax
+  8004d0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004d5:	0f 49 d0             	cmovns %eax,%edx
+  8004d8:	29 d0                	sub    %edx,%eax
+  8004da:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004dd:	eb a6                	jmp    800485 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8004df:	83 ec 08             	sub    $0x8,%esp
+  8004e2:	53                   	push   %ebx
+  8004e3:	52                   	push   %edx
+  8004e4:	ff 55 08             	call   *0x8(%ebp)
+  8004e7:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004ea:	89 f1                	mov    %esi,%ecx
+  8004ec:	8d 71 01             	lea    0x1(%ecx),%esi
+  8004ef:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004f3:	0f be d0             	movsbl %al,%edx
+  8004f6:	85 d2                	test   %edx,%edx
+  8004f8:	74 28                	je     800522 <vprintfmt+0x238>
+  8004fa:	85 ff                	test   %edi,%edi
+  8004fc:	78 05                	js     800503 <vprintfmt+0x219>
+  8004fe:	83 ef 01             	sub    $0x1,%edi
+  800501:	78 30                	js     800533 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800503:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800507:	74 d6                	je     8004df <vprintfmt+0x1f5>
+  800509:	0f be c0             	movsbl %al,%eax
+  80050c:	83 e8 20             	sub    $0x20,%eax
+  80050f:	83 f8 5e             	cmp    $0x5e,%eax
+  800512:	76 cb                	jbe    8004df <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800514:	83 ec 08             	sub    $0x8,%esp
+  800517:	53                   	push   %ebx
+  800518:	6a 3f                	push   $0x3f
+  80051a:	ff 55 08             	call   *0x8(%ebp)
+  80051d:	83 c4 10             	add    $0x10,%esp
+  800520:	eb c8                	jmp    8004ea <vprintfmt+0x200>
+  800522:	8b 75 08             	mov    0x8(%ebp),%esi
+  800525:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800528:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80052b:	01 d0                	add    %edx,%eax
+  80052d:	29 c8                	sub    %ecx,%eax
+  80052f:	89 c7                	mov    %eax,%edi
+  800531:	eb 13                	jmp    800546 <vprintfmt+0x25c>
+  800533:	8b 75 08             	mov    0x8(%ebp),%esi
+  800536:	eb ed                	jmp    800525 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800538:	83 ec 08             	sub    $0x8,%esp
+  80053b:	53                   	push   %ebx
+  80053c:	6a 20                	push   $0x20
+  80053e:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800540:	83 ef 01             	sub    $0x1,%edi
+  800543:	83 c4 10             	add    $0x10,%esp
+  800546:	85 ff                	test   %edi,%edi
+  800548:	7f ee                	jg     800538 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80054a:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80054d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800550:	e9 36 01 00 00       	jmp    80068b <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  800555:	83 f9 01             	cmp    $0x1,%ecx
+  800558:	7f 1f                	jg     800579 <vprintfmt+0x28f>
+	else if (lflag)
+  80055a:	85 c9                	test   %ecx,%ecx
+  80055c:	74 67                	je     8005c5 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  80055e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800561:	8b 00                	mov    (%eax),%eax
+  800563:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800566:	89 c1                	mov    %eax,%ecx
+  800568:	c1 f9 1f             	sar    $0x1f,%ecx
+  80056b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80056e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800571:	8d 40 04             	lea    0x4(%eax),%eax
+  800574:	89 45 14             	mov    %eax,0x14(%ebp)
+  800577:	eb 17                	jmp    800590 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800579:	8b 45 14             	mov    0x14(%ebp),%eax
+  80057c:	8b 50 04             	mov    0x4(%eax),%edx
+  80057f:	8b 00                	mov    (%eax),%eax
+  800581:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800584:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800587:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058a:	8d 40 08             	lea    0x8(%eax),%eax
+  80058d:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800590:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800593:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800596:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80059b:	85 c9                	test   %ecx,%ecx
+  80059d:	0f 89 ce 00 00 00    	jns    800671 <vprintfmt+0x387>
+				putch('-', putdat);
+  8005a3:	83 ec 08             	sub    $0x8,%esp
+  8005a6:	53                   	push   %ebx
+  8005a7:	6a 2d                	push   $0x2d
+  8005a9:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8005ab:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005ae:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005b1:	f7 da                	neg    %edx
+  8005b3:	83 d1 00             	adc    $0x0,%ecx
+  8005b6:	f7 d9                	neg    %ecx
+  8005b8:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8005bb:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005c0:	e9 ac 00 00 00       	jmp    800671 <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  8005c5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c8:	8b 00                	mov    (%eax),%eax
+  8005ca:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005cd:	89 c1                	mov    %eax,%ecx
+  8005cf:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005d2:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005d5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d8:	8d 40 04             	lea    0x4(%eax),%eax
+  8005db:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005de:	eb b0                	jmp    800590 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8005e0:	83 f9 01             	cmp    $0x1,%ecx
+  8005e3:	7f 1b                	jg     800600 <vprintfmt+0x316>
+	else if (lflag)
+  8005e5:	85 c9                	test   %ecx,%ecx
+  8005e7:	74 2c                	je     800615 <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  8005e9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ec:	8b 10                	mov    (%eax),%edx
+  8005ee:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005f3:	8d 40 04             	lea    0x4(%eax),%eax
+  8005f6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005f9:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8005fe:	eb 71                	jmp    800671 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  800600:	8b 45 14             	mov    0x14(%ebp),%eax
+  800603:	8b 10                	mov    (%eax),%edx
+  800605:	8b 48 04             	mov    0x4(%eax),%ecx
+  800608:	8d 40 08             	lea    0x8(%eax),%eax
+  80060b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80060e:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800613:	eb 5c                	jmp    800671 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  800615:	8b 45 14             	mov    0x14(%ebp),%eax
+  800618:	8b 10                	mov    (%eax),%edx
+  80061a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80061f:	8d 40 04             	lea    0x4(%eax),%eax
+  800622:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800625:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80062a:	eb 45                	jmp    800671 <vprintfmt+0x387>
+			putch('X', putdat);
+  80062c:	83 ec 08             	sub    $0x8,%esp
+  80062f:	53                   	push   %ebx
+  800630:	6a 58                	push   $0x58
+  800632:	ff d6                	call   *%esi
+			putch('X', putdat);
+  800634:	83 c4 08             	add    $0x8,%esp
+  800637:	53                   	push   %ebx
+  800638:	6a 58                	push   $0x58
+  80063a:	ff d6                	call   *%esi
+			putch('X', putdat);
+  80063c:	83 c4 08             	add    $0x8,%esp
+  80063f:	53                   	push   %ebx
+  800640:	6a 58                	push   $0x58
+  800642:	ff d6                	call   *%esi
+			break;
+  800644:	83 c4 10             	add    $0x10,%esp
+  800647:	eb 42                	jmp    80068b <vprintfmt+0x3a1>
+			putch('0', putdat);
+  800649:	83 ec 08             	sub    $0x8,%esp
+  80064c:	53                   	push   %ebx
+  80064d:	6a 30                	push   $0x30
+  80064f:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800651:	83 c4 08             	add    $0x8,%esp
+  800654:	53                   	push   %ebx
+  800655:	6a 78                	push   $0x78
+  800657:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800659:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065c:	8b 10                	mov    (%eax),%edx
+  80065e:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800663:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800666:	8d 40 04             	lea    0x4(%eax),%eax
+  800669:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80066c:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800671:	83 ec 0c             	sub    $0xc,%esp
+  800674:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800678:	50                   	push   %eax
+  800679:	ff 75 e0             	push   -0x20(%ebp)
+  80067c:	57                   	push   %edi
+  80067d:	51                   	push   %ecx
+  80067e:	52                   	push   %edx
+  80067f:	89 da                	mov    %ebx,%edx
+  800681:	89 f0                	mov    %esi,%eax
+  800683:	e8 7f fb ff ff       	call   800207 <printnum>
+			break;
+  800688:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80068b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80068e:	e9 75 fc ff ff       	jmp    800308 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800693:	83 f9 01             	cmp    $0x1,%ecx
+  800696:	7f 1b                	jg     8006b3 <vprintfmt+0x3c9>
+	else if (lflag)
+  800698:	85 c9                	test   %ecx,%ecx
+  80069a:	74 2c                	je     8006c8 <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  80069c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069f:	8b 10                	mov    (%eax),%edx
+  8006a1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006a6:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006ac:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8006b1:	eb be                	jmp    800671 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  8006b3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b6:	8b 10                	mov    (%eax),%edx
+  8006b8:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006bb:	8d 40 08             	lea    0x8(%eax),%eax
+  8006be:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006c1:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8006c6:	eb a9                	jmp    800671 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  8006c8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006cb:	8b 10                	mov    (%eax),%edx
+  8006cd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006d2:	8d 40 04             	lea    0x4(%eax),%eax
+  8006d5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006d8:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8006dd:	eb 92                	jmp    800671 <vprintfmt+0x387>
+			putch(ch, putdat);
+  8006df:	83 ec 08             	sub    $0x8,%esp
+  8006e2:	53                   	push   %ebx
+  8006e3:	6a 25                	push   $0x25
+  8006e5:	ff d6                	call   *%esi
+			break;
+  8006e7:	83 c4 10             	add    $0x10,%esp
+  8006ea:	eb 9f                	jmp    80068b <vprintfmt+0x3a1>
+			putch('%', putdat);
+  8006ec:	83 ec 08             	sub    $0x8,%esp
+  8006ef:	53                   	push   %ebx
+  8006f0:	6a 25                	push   $0x25
+  8006f2:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8006f4:	83 c4 10             	add    $0x10,%esp
+  8006f7:	89 f8                	mov    %edi,%eax
+  8006f9:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8006fd:	74 05                	je     800704 <vprintfmt+0x41a>
+  8006ff:	83 e8 01             	sub    $0x1,%eax
+  800702:	eb f5                	jmp    8006f9 <vprintfmt+0x40f>
+  800704:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800707:	eb 82                	jmp    80068b <vprintfmt+0x3a1>
+
+00800709 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800709:	55                   	push   %ebp
+  80070a:	89 e5                	mov    %esp,%ebp
+  80070c:	83 ec 18             	sub    $0x18,%esp
+  80070f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800712:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800715:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800718:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80071c:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80071f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800726:	85 c0                	test   %eax,%eax
+  800728:	74 26                	je     800750 <vsnprintf+0x47>
+  80072a:	85 d2                	test   %edx,%edx
+  80072c:	7e 22                	jle    800750 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80072e:	ff 75 14             	push   0x14(%ebp)
+  800731:	ff 75 10             	push   0x10(%ebp)
+  800734:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800737:	50                   	push   %eax
+  800738:	68 b0 02 80 00       	push   $0x8002b0
+  80073d:	e8 a8 fb ff ff       	call   8002ea <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800742:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800745:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800748:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80074b:	83 c4 10             	add    $0x10,%esp
+}
+  80074e:	c9                   	leave
+  80074f:	c3                   	ret
+		return -E_INVAL;
+  800750:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800755:	eb f7                	jmp    80074e <vsnprintf+0x45>
+
+00800757 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800757:	55                   	push   %ebp
+  800758:	89 e5                	mov    %esp,%ebp
+  80075a:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80075d:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800760:	50                   	push   %eax
+  800761:	ff 75 10             	push   0x10(%ebp)
+  800764:	ff 75 0c             	push   0xc(%ebp)
+  800767:	ff 75 08             	push   0x8(%ebp)
+  80076a:	e8 9a ff ff ff       	call   800709 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80076f:	c9                   	leave
+  800770:	c3                   	ret
+
+00800771 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800771:	55                   	push   %ebp
+  800772:	89 e5                	mov    %esp,%ebp
+  800774:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800777:	b8 00 00 00 00       	mov    $0x0,%eax
+  80077c:	eb 03                	jmp    800781 <strlen+0x10>
+		n++;
+  80077e:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800781:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800785:	75 f7                	jne    80077e <strlen+0xd>
+	return n;
+}
+  800787:	5d                   	pop    %ebp
+  800788:	c3                   	ret
+
+00800789 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800789:	55                   	push   %ebp
+  80078a:	89 e5                	mov    %esp,%ebp
+  80078c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80078f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800792:	b8 00 00 00 00       	mov    $0x0,%eax
+  800797:	eb 03                	jmp    80079c <strnlen+0x13>
+		n++;
+  800799:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80079c:	39 d0                	cmp    %edx,%eax
+  80079e:	74 08                	je     8007a8 <strnlen+0x1f>
+  8007a0:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8007a4:	75 f3                	jne    800799 <strnlen+0x10>
+  8007a6:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8007a8:	89 d0                	mov    %edx,%eax
+  8007aa:	5d                   	pop    %ebp
+  8007ab:	c3                   	ret
+
+008007ac <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8007ac:	55                   	push   %ebp
+  8007ad:	89 e5                	mov    %esp,%ebp
+  8007af:	53                   	push   %ebx
+  8007b0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007b3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8007b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007bb:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8007bf:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8007c2:	83 c0 01             	add    $0x1,%eax
+  8007c5:	84 d2                	test   %dl,%dl
+  8007c7:	75 f2                	jne    8007bb <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8007c9:	89 c8                	mov    %ecx,%eax
+  8007cb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007ce:	c9                   	leave
+  8007cf:	c3                   	ret
+
+008007d0 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8007d0:	55                   	push   %ebp
+  8007d1:	89 e5                	mov    %esp,%ebp
+  8007d3:	53                   	push   %ebx
+  8007d4:	83 ec 10             	sub    $0x10,%esp
+  8007d7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8007da:	53                   	push   %ebx
+  8007db:	e8 91 ff ff ff       	call   800771 <strlen>
+  8007e0:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8007e3:	ff 75 0c             	push   0xc(%ebp)
+  8007e6:	01 d8                	add    %ebx,%eax
+  8007e8:	50                   	push   %eax
+  8007e9:	e8 be ff ff ff       	call   8007ac <strcpy>
+	return dst;
+}
+  8007ee:	89 d8                	mov    %ebx,%eax
+  8007f0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007f3:	c9                   	leave
+  8007f4:	c3                   	ret
+
+008007f5 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8007f5:	55                   	push   %ebp
+  8007f6:	89 e5                	mov    %esp,%ebp
+  8007f8:	56                   	push   %esi
+  8007f9:	53                   	push   %ebx
+  8007fa:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007fd:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800800:	89 f3                	mov    %esi,%ebx
+  800802:	03 5d 10             	add    0x10(%ebp),%ebx
+  800805:	89 f0                	mov    %esi,%eax
+  800807:	eb 0f                	jmp    800818 <strncpy+0x23>
+		*dst++ = *src;
+  800809:	83 c0 01             	add    $0x1,%eax
+  80080c:	0f b6 0a             	movzbl (%edx),%ecx
+  80080f:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800812:	80 f9 01             	cmp    $0x1,%cl
+  800815:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800818:	39 d8                	cmp    %ebx,%eax
+  80081a:	75 ed                	jne    800809 <strncpy+0x14>
+	}
+	return ret;
+}
+  80081c:	89 f0                	mov    %esi,%eax
+  80081e:	5b                   	pop    %ebx
+  80081f:	5e                   	pop    %esi
+  800820:	5d                   	pop    %ebp
+  800821:	c3                   	ret
+
+00800822 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800822:	55                   	push   %ebp
+  800823:	89 e5                	mov    %esp,%ebp
+  800825:	56                   	push   %esi
+  800826:	53                   	push   %ebx
+  800827:	8b 75 08             	mov    0x8(%ebp),%esi
+  80082a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80082d:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800830:	89 f0                	mov    %esi,%eax
+  800832:	85 d2                	test   %edx,%edx
+  800834:	74 21                	je     800857 <strlcpy+0x35>
+  800836:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80083a:	89 f2                	mov    %esi,%edx
+  80083c:	eb 09                	jmp    800847 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  80083e:	83 c1 01             	add    $0x1,%ecx
+  800841:	83 c2 01             	add    $0x1,%edx
+  800844:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800847:	39 c2                	cmp    %eax,%edx
+  800849:	74 09                	je     800854 <strlcpy+0x32>
+  80084b:	0f b6 19             	movzbl (%ecx),%ebx
+  80084e:	84 db                	test   %bl,%bl
+  800850:	75 ec                	jne    80083e <strlcpy+0x1c>
+  800852:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800854:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800857:	29 f0                	sub    %esi,%eax
+}
+  800859:	5b                   	pop    %ebx
+  80085a:	5e                   	pop    %esi
+  80085b:	5d                   	pop    %ebp
+  80085c:	c3                   	ret
+
+0080085d <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80085d:	55                   	push   %ebp
+  80085e:	89 e5                	mov    %esp,%ebp
+  800860:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800863:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800866:	eb 06                	jmp    80086e <strcmp+0x11>
+		p++, q++;
+  800868:	83 c1 01             	add    $0x1,%ecx
+  80086b:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  80086e:	0f b6 01             	movzbl (%ecx),%eax
+  800871:	84 c0                	test   %al,%al
+  800873:	74 04                	je     800879 <strcmp+0x1c>
+  800875:	3a 02                	cmp    (%edx),%al
+  800877:	74 ef                	je     800868 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800879:	0f b6 c0             	movzbl %al,%eax
+  80087c:	0f b6 12             	movzbl (%edx),%edx
+  80087f:	29 d0                	sub    %edx,%eax
+}
+  800881:	5d                   	pop    %ebp
+  800882:	c3                   	ret
+
+00800883 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800883:	55                   	push   %ebp
+  800884:	89 e5                	mov    %esp,%ebp
+  800886:	53                   	push   %ebx
+  800887:	8b 45 08             	mov    0x8(%ebp),%eax
+  80088a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80088d:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800890:	eb 09                	jmp    80089b <strncmp+0x18>
+		n--, p++, q++;
+  800892:	83 ea 01             	sub    $0x1,%edx
+  800895:	83 c0 01             	add    $0x1,%eax
+  800898:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80089b:	85 d2                	test   %edx,%edx
+  80089d:	74 18                	je     8008b7 <strncmp+0x34>
+  80089f:	0f b6 18             	movzbl (%eax),%ebx
+  8008a2:	84 db                	test   %bl,%bl
+  8008a4:	74 04                	je     8008aa <strncmp+0x27>
+  8008a6:	3a 19                	cmp    (%ecx),%bl
+  8008a8:	74 e8                	je     800892 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008aa:	0f b6 00             	movzbl (%eax),%eax
+  8008ad:	0f b6 11             	movzbl (%ecx),%edx
+  8008b0:	29 d0                	sub    %edx,%eax
+}
+  8008b2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008b5:	c9                   	leave
+  8008b6:	c3                   	ret
+		return 0;
+  8008b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008bc:	eb f4                	jmp    8008b2 <strncmp+0x2f>
+
+008008be <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8008be:	55                   	push   %ebp
+  8008bf:	89 e5                	mov    %esp,%ebp
+  8008c1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008c4:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008c8:	eb 03                	jmp    8008cd <strchr+0xf>
+  8008ca:	83 c0 01             	add    $0x1,%eax
+  8008cd:	0f b6 10             	movzbl (%eax),%edx
+  8008d0:	84 d2                	test   %dl,%dl
+  8008d2:	74 06                	je     8008da <strchr+0x1c>
+		if (*s == c)
+  8008d4:	38 ca                	cmp    %cl,%dl
+  8008d6:	75 f2                	jne    8008ca <strchr+0xc>
+  8008d8:	eb 05                	jmp    8008df <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8008da:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008df:	5d                   	pop    %ebp
+  8008e0:	c3                   	ret
+
+008008e1 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8008e1:	55                   	push   %ebp
+  8008e2:	89 e5                	mov    %esp,%ebp
+  8008e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008e7:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008eb:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8008ee:	38 ca                	cmp    %cl,%dl
+  8008f0:	74 09                	je     8008fb <strfind+0x1a>
+  8008f2:	84 d2                	test   %dl,%dl
+  8008f4:	74 05                	je     8008fb <strfind+0x1a>
+	for (; *s; s++)
+  8008f6:	83 c0 01             	add    $0x1,%eax
+  8008f9:	eb f0                	jmp    8008eb <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8008fb:	5d                   	pop    %ebp
+  8008fc:	c3                   	ret
+
+008008fd <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8008fd:	55                   	push   %ebp
+  8008fe:	89 e5                	mov    %esp,%ebp
+  800900:	57                   	push   %edi
+  800901:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800904:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800907:	85 c9                	test   %ecx,%ecx
+  800909:	74 20                	je     80092b <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  80090b:	89 f8                	mov    %edi,%eax
+  80090d:	09 c8                	or     %ecx,%eax
+  80090f:	a8 03                	test   $0x3,%al
+  800911:	75 12                	jne    800925 <memset+0x28>
+		c &= 0xFF;
+  800913:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800917:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  80091d:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800920:	fc                   	cld
+  800921:	f3 ab                	rep stos %eax,%es:(%edi)
+  800923:	eb 06                	jmp    80092b <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800925:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800928:	fc                   	cld
+  800929:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  80092b:	89 f8                	mov    %edi,%eax
+  80092d:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800930:	c9                   	leave
+  800931:	c3                   	ret
+
+00800932 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800932:	55                   	push   %ebp
+  800933:	89 e5                	mov    %esp,%ebp
+  800935:	57                   	push   %edi
+  800936:	56                   	push   %esi
+  800937:	8b 45 08             	mov    0x8(%ebp),%eax
+  80093a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80093d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800940:	39 c6                	cmp    %eax,%esi
+  800942:	73 32                	jae    800976 <memmove+0x44>
+  800944:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800947:	39 d0                	cmp    %edx,%eax
+  800949:	73 2b                	jae    800976 <memmove+0x44>
+		s += n;
+		d += n;
+  80094b:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80094e:	89 d6                	mov    %edx,%esi
+  800950:	09 fe                	or     %edi,%esi
+  800952:	09 ce                	or     %ecx,%esi
+  800954:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  80095a:	75 0e                	jne    80096a <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  80095c:	83 ef 04             	sub    $0x4,%edi
+  80095f:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800962:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800965:	fd                   	std
+  800966:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800968:	eb 09                	jmp    800973 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  80096a:	83 ef 01             	sub    $0x1,%edi
+  80096d:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800970:	fd                   	std
+  800971:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800973:	fc                   	cld
+  800974:	eb 1a                	jmp    800990 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800976:	89 f2                	mov    %esi,%edx
+  800978:	09 c2                	or     %eax,%edx
+  80097a:	09 ca                	or     %ecx,%edx
+  80097c:	f6 c2 03             	test   $0x3,%dl
+  80097f:	75 0a                	jne    80098b <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800981:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800984:	89 c7                	mov    %eax,%edi
+  800986:	fc                   	cld
+  800987:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800989:	eb 05                	jmp    800990 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  80098b:	89 c7                	mov    %eax,%edi
+  80098d:	fc                   	cld
+  80098e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800990:	5e                   	pop    %esi
+  800991:	5f                   	pop    %edi
+  800992:	5d                   	pop    %ebp
+  800993:	c3                   	ret
+
+00800994 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800994:	55                   	push   %ebp
+  800995:	89 e5                	mov    %esp,%ebp
+  800997:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  80099a:	ff 75 10             	push   0x10(%ebp)
+  80099d:	ff 75 0c             	push   0xc(%ebp)
+  8009a0:	ff 75 08             	push   0x8(%ebp)
+  8009a3:	e8 8a ff ff ff       	call   800932 <memmove>
+}
+  8009a8:	c9                   	leave
+  8009a9:	c3                   	ret
+
+008009aa <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8009aa:	55                   	push   %ebp
+  8009ab:	89 e5                	mov    %esp,%ebp
+  8009ad:	56                   	push   %esi
+  8009ae:	53                   	push   %ebx
+  8009af:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009b2:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8009b5:	89 c6                	mov    %eax,%esi
+  8009b7:	03 75 10             	add    0x10(%ebp),%esi
+  8009ba:	eb 06                	jmp    8009c2 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8009bc:	83 c0 01             	add    $0x1,%eax
+  8009bf:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  8009c2:	39 f0                	cmp    %esi,%eax
+  8009c4:	74 14                	je     8009da <memcmp+0x30>
+		if (*s1 != *s2)
+  8009c6:	0f b6 08             	movzbl (%eax),%ecx
+  8009c9:	0f b6 1a             	movzbl (%edx),%ebx
+  8009cc:	38 d9                	cmp    %bl,%cl
+  8009ce:	74 ec                	je     8009bc <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  8009d0:	0f b6 c1             	movzbl %cl,%eax
+  8009d3:	0f b6 db             	movzbl %bl,%ebx
+  8009d6:	29 d8                	sub    %ebx,%eax
+  8009d8:	eb 05                	jmp    8009df <memcmp+0x35>
+	}
+
+	return 0;
+  8009da:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009df:	5b                   	pop    %ebx
+  8009e0:	5e                   	pop    %esi
+  8009e1:	5d                   	pop    %ebp
+  8009e2:	c3                   	ret
+
+008009e3 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8009e3:	55                   	push   %ebp
+  8009e4:	89 e5                	mov    %esp,%ebp
+  8009e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8009ec:	89 c2                	mov    %eax,%edx
+  8009ee:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8009f1:	eb 03                	jmp    8009f6 <memfind+0x13>
+  8009f3:	83 c0 01             	add    $0x1,%eax
+  8009f6:	39 d0                	cmp    %edx,%eax
+  8009f8:	73 04                	jae    8009fe <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8009fa:	38 08                	cmp    %cl,(%eax)
+  8009fc:	75 f5                	jne    8009f3 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8009fe:	5d                   	pop    %ebp
+  8009ff:	c3                   	ret
+
+00800a00 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a00:	55                   	push   %ebp
+  800a01:	89 e5                	mov    %esp,%ebp
+  800a03:	57                   	push   %edi
+  800a04:	56                   	push   %esi
+  800a05:	53                   	push   %ebx
+  800a06:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a09:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a0c:	eb 03                	jmp    800a11 <strtol+0x11>
+		s++;
+  800a0e:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a11:	0f b6 02             	movzbl (%edx),%eax
+  800a14:	3c 20                	cmp    $0x20,%al
+  800a16:	74 f6                	je     800a0e <strtol+0xe>
+  800a18:	3c 09                	cmp    $0x9,%al
+  800a1a:	74 f2                	je     800a0e <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a1c:	3c 2b                	cmp    $0x2b,%al
+  800a1e:	74 2a                	je     800a4a <strtol+0x4a>
+	int neg = 0;
+  800a20:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a25:	3c 2d                	cmp    $0x2d,%al
+  800a27:	74 2b                	je     800a54 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a29:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a2f:	75 0f                	jne    800a40 <strtol+0x40>
+  800a31:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a34:	74 28                	je     800a5e <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a36:	85 db                	test   %ebx,%ebx
+  800a38:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a3d:	0f 44 d8             	cmove  %eax,%ebx
+  800a40:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a45:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a48:	eb 46                	jmp    800a90 <strtol+0x90>
+		s++;
+  800a4a:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a4d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a52:	eb d5                	jmp    800a29 <strtol+0x29>
+		s++, neg = 1;
+  800a54:	83 c2 01             	add    $0x1,%edx
+  800a57:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a5c:	eb cb                	jmp    800a29 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a5e:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a62:	74 0e                	je     800a72 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a64:	85 db                	test   %ebx,%ebx
+  800a66:	75 d8                	jne    800a40 <strtol+0x40>
+		s++, base = 8;
+  800a68:	83 c2 01             	add    $0x1,%edx
+  800a6b:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a70:	eb ce                	jmp    800a40 <strtol+0x40>
+		s += 2, base = 16;
+  800a72:	83 c2 02             	add    $0x2,%edx
+  800a75:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a7a:	eb c4                	jmp    800a40 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a7c:	0f be c0             	movsbl %al,%eax
+  800a7f:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a82:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a85:	7d 3a                	jge    800ac1 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a87:	83 c2 01             	add    $0x1,%edx
+  800a8a:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a8e:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a90:	0f b6 02             	movzbl (%edx),%eax
+  800a93:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a96:	89 f3                	mov    %esi,%ebx
+  800a98:	80 fb 09             	cmp    $0x9,%bl
+  800a9b:	76 df                	jbe    800a7c <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a9d:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800aa0:	89 f3                	mov    %esi,%ebx
+  800aa2:	80 fb 19             	cmp    $0x19,%bl
+  800aa5:	77 08                	ja     800aaf <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800aa7:	0f be c0             	movsbl %al,%eax
+  800aaa:	83 e8 57             	sub    $0x57,%eax
+  800aad:	eb d3                	jmp    800a82 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800aaf:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800ab2:	89 f3                	mov    %esi,%ebx
+  800ab4:	80 fb 19             	cmp    $0x19,%bl
+  800ab7:	77 08                	ja     800ac1 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800ab9:	0f be c0             	movsbl %al,%eax
+  800abc:	83 e8 37             	sub    $0x37,%eax
+  800abf:	eb c1                	jmp    800a82 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800ac1:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800ac5:	74 05                	je     800acc <strtol+0xcc>
+		*endptr = (char *) s;
+  800ac7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800aca:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800acc:	89 c8                	mov    %ecx,%eax
+  800ace:	f7 d8                	neg    %eax
+  800ad0:	85 ff                	test   %edi,%edi
+  800ad2:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800ad5:	89 c8                	mov    %ecx,%eax
+  800ad7:	5b                   	pop    %ebx
+  800ad8:	5e                   	pop    %esi
+  800ad9:	5f                   	pop    %edi
+  800ada:	5d                   	pop    %ebp
+  800adb:	c3                   	ret
+
+00800adc <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800adc:	55                   	push   %ebp
+  800add:	89 e5                	mov    %esp,%ebp
+  800adf:	57                   	push   %edi
+  800ae0:	56                   	push   %esi
+  800ae1:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800ae2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ae7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800aea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800aed:	89 c3                	mov    %eax,%ebx
+  800aef:	89 c7                	mov    %eax,%edi
+  800af1:	89 c6                	mov    %eax,%esi
+  800af3:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  800af5:	5b                   	pop    %ebx
+  800af6:	5e                   	pop    %esi
+  800af7:	5f                   	pop    %edi
+  800af8:	5d                   	pop    %ebp
+  800af9:	c3                   	ret
+
+00800afa <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800afa:	55                   	push   %ebp
+  800afb:	89 e5                	mov    %esp,%ebp
+  800afd:	57                   	push   %edi
+  800afe:	56                   	push   %esi
+  800aff:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800b00:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b05:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b0a:	89 d1                	mov    %edx,%ecx
+  800b0c:	89 d3                	mov    %edx,%ebx
+  800b0e:	89 d7                	mov    %edx,%edi
+  800b10:	89 d6                	mov    %edx,%esi
+  800b12:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800b14:	5b                   	pop    %ebx
+  800b15:	5e                   	pop    %esi
+  800b16:	5f                   	pop    %edi
+  800b17:	5d                   	pop    %ebp
+  800b18:	c3                   	ret
+
+00800b19 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800b19:	55                   	push   %ebp
+  800b1a:	89 e5                	mov    %esp,%ebp
+  800b1c:	57                   	push   %edi
+  800b1d:	56                   	push   %esi
+  800b1e:	53                   	push   %ebx
+  800b1f:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800b22:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b27:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b2a:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b2f:	89 cb                	mov    %ecx,%ebx
+  800b31:	89 cf                	mov    %ecx,%edi
+  800b33:	89 ce                	mov    %ecx,%esi
+  800b35:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800b37:	85 c0                	test   %eax,%eax
+  800b39:	7f 08                	jg     800b43 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800b3b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b3e:	5b                   	pop    %ebx
+  800b3f:	5e                   	pop    %esi
+  800b40:	5f                   	pop    %edi
+  800b41:	5d                   	pop    %ebp
+  800b42:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800b43:	83 ec 0c             	sub    $0xc,%esp
+  800b46:	50                   	push   %eax
+  800b47:	6a 03                	push   $0x3
+  800b49:	68 a3 29 80 00       	push   $0x8029a3
+  800b4e:	6a 3e                	push   $0x3e
+  800b50:	68 c0 29 80 00       	push   $0x8029c0
+  800b55:	e8 be f5 ff ff       	call   800118 <_panic>
+
+00800b5a <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800b5a:	55                   	push   %ebp
+  800b5b:	89 e5                	mov    %esp,%ebp
+  800b5d:	57                   	push   %edi
+  800b5e:	56                   	push   %esi
+  800b5f:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800b60:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b65:	b8 02 00 00 00       	mov    $0x2,%eax
+  800b6a:	89 d1                	mov    %edx,%ecx
+  800b6c:	89 d3                	mov    %edx,%ebx
+  800b6e:	89 d7                	mov    %edx,%edi
+  800b70:	89 d6                	mov    %edx,%esi
+  800b72:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800b74:	5b                   	pop    %ebx
+  800b75:	5e                   	pop    %esi
+  800b76:	5f                   	pop    %edi
+  800b77:	5d                   	pop    %ebp
+  800b78:	c3                   	ret
+
+00800b79 <sys_yield>:
+
+void
+sys_yield(void) {
+  800b79:	55                   	push   %ebp
+  800b7a:	89 e5                	mov    %esp,%ebp
+  800b7c:	57                   	push   %edi
+  800b7d:	56                   	push   %esi
+  800b7e:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800b7f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b84:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800b89:	89 d1                	mov    %edx,%ecx
+  800b8b:	89 d3                	mov    %edx,%ebx
+  800b8d:	89 d7                	mov    %edx,%edi
+  800b8f:	89 d6                	mov    %edx,%esi
+  800b91:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800b93:	5b                   	pop    %ebx
+  800b94:	5e                   	pop    %esi
+  800b95:	5f                   	pop    %edi
+  800b96:	5d                   	pop    %ebp
+  800b97:	c3                   	ret
+
+00800b98 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  800b98:	55                   	push   %ebp
+  800b99:	89 e5                	mov    %esp,%ebp
+  800b9b:	57                   	push   %edi
+  800b9c:	56                   	push   %esi
+  800b9d:	53                   	push   %ebx
+  800b9e:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800ba1:	be 00 00 00 00       	mov    $0x0,%esi
+  800ba6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ba9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bac:	b8 04 00 00 00       	mov    $0x4,%eax
+  800bb1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bb4:	89 f7                	mov    %esi,%edi
+  800bb6:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800bb8:	85 c0                	test   %eax,%eax
+  800bba:	7f 08                	jg     800bc4 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800bbc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bbf:	5b                   	pop    %ebx
+  800bc0:	5e                   	pop    %esi
+  800bc1:	5f                   	pop    %edi
+  800bc2:	5d                   	pop    %ebp
+  800bc3:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800bc4:	83 ec 0c             	sub    $0xc,%esp
+  800bc7:	50                   	push   %eax
+  800bc8:	6a 04                	push   $0x4
+  800bca:	68 a3 29 80 00       	push   $0x8029a3
+  800bcf:	6a 3e                	push   $0x3e
+  800bd1:	68 c0 29 80 00       	push   $0x8029c0
+  800bd6:	e8 3d f5 ff ff       	call   800118 <_panic>
+
+00800bdb <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  800bdb:	55                   	push   %ebp
+  800bdc:	89 e5                	mov    %esp,%ebp
+  800bde:	57                   	push   %edi
+  800bdf:	56                   	push   %esi
+  800be0:	53                   	push   %ebx
+  800be1:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800be4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800be7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bea:	b8 05 00 00 00       	mov    $0x5,%eax
+  800bef:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bf2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800bf5:	8b 75 18             	mov    0x18(%ebp),%esi
+  800bf8:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800bfa:	85 c0                	test   %eax,%eax
+  800bfc:	7f 08                	jg     800c06 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800bfe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c01:	5b                   	pop    %ebx
+  800c02:	5e                   	pop    %esi
+  800c03:	5f                   	pop    %edi
+  800c04:	5d                   	pop    %ebp
+  800c05:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c06:	83 ec 0c             	sub    $0xc,%esp
+  800c09:	50                   	push   %eax
+  800c0a:	6a 05                	push   $0x5
+  800c0c:	68 a3 29 80 00       	push   $0x8029a3
+  800c11:	6a 3e                	push   $0x3e
+  800c13:	68 c0 29 80 00       	push   $0x8029c0
+  800c18:	e8 fb f4 ff ff       	call   800118 <_panic>
+
+00800c1d <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  800c1d:	55                   	push   %ebp
+  800c1e:	89 e5                	mov    %esp,%ebp
+  800c20:	57                   	push   %edi
+  800c21:	56                   	push   %esi
+  800c22:	53                   	push   %ebx
+  800c23:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c26:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c2b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c2e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c31:	b8 06 00 00 00       	mov    $0x6,%eax
+  800c36:	89 df                	mov    %ebx,%edi
+  800c38:	89 de                	mov    %ebx,%esi
+  800c3a:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c3c:	85 c0                	test   %eax,%eax
+  800c3e:	7f 08                	jg     800c48 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800c40:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c43:	5b                   	pop    %ebx
+  800c44:	5e                   	pop    %esi
+  800c45:	5f                   	pop    %edi
+  800c46:	5d                   	pop    %ebp
+  800c47:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c48:	83 ec 0c             	sub    $0xc,%esp
+  800c4b:	50                   	push   %eax
+  800c4c:	6a 06                	push   $0x6
+  800c4e:	68 a3 29 80 00       	push   $0x8029a3
+  800c53:	6a 3e                	push   $0x3e
+  800c55:	68 c0 29 80 00       	push   $0x8029c0
+  800c5a:	e8 b9 f4 ff ff       	call   800118 <_panic>
+
+00800c5f <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800c5f:	55                   	push   %ebp
+  800c60:	89 e5                	mov    %esp,%ebp
+  800c62:	57                   	push   %edi
+  800c63:	56                   	push   %esi
+  800c64:	53                   	push   %ebx
+  800c65:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c68:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c6d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c70:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c73:	b8 08 00 00 00       	mov    $0x8,%eax
+  800c78:	89 df                	mov    %ebx,%edi
+  800c7a:	89 de                	mov    %ebx,%esi
+  800c7c:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c7e:	85 c0                	test   %eax,%eax
+  800c80:	7f 08                	jg     800c8a <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800c82:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c85:	5b                   	pop    %ebx
+  800c86:	5e                   	pop    %esi
+  800c87:	5f                   	pop    %edi
+  800c88:	5d                   	pop    %ebp
+  800c89:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c8a:	83 ec 0c             	sub    $0xc,%esp
+  800c8d:	50                   	push   %eax
+  800c8e:	6a 08                	push   $0x8
+  800c90:	68 a3 29 80 00       	push   $0x8029a3
+  800c95:	6a 3e                	push   $0x3e
+  800c97:	68 c0 29 80 00       	push   $0x8029c0
+  800c9c:	e8 77 f4 ff ff       	call   800118 <_panic>
+
+00800ca1 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800ca1:	55                   	push   %ebp
+  800ca2:	89 e5                	mov    %esp,%ebp
+  800ca4:	57                   	push   %edi
+  800ca5:	56                   	push   %esi
+  800ca6:	53                   	push   %ebx
+  800ca7:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800caa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800caf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cb2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cb5:	b8 09 00 00 00       	mov    $0x9,%eax
+  800cba:	89 df                	mov    %ebx,%edi
+  800cbc:	89 de                	mov    %ebx,%esi
+  800cbe:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800cc0:	85 c0                	test   %eax,%eax
+  800cc2:	7f 08                	jg     800ccc <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800cc4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cc7:	5b                   	pop    %ebx
+  800cc8:	5e                   	pop    %esi
+  800cc9:	5f                   	pop    %edi
+  800cca:	5d                   	pop    %ebp
+  800ccb:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ccc:	83 ec 0c             	sub    $0xc,%esp
+  800ccf:	50                   	push   %eax
+  800cd0:	6a 09                	push   $0x9
+  800cd2:	68 a3 29 80 00       	push   $0x8029a3
+  800cd7:	6a 3e                	push   $0x3e
+  800cd9:	68 c0 29 80 00       	push   $0x8029c0
+  800cde:	e8 35 f4 ff ff       	call   800118 <_panic>
+
+00800ce3 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800ce3:	55                   	push   %ebp
+  800ce4:	89 e5                	mov    %esp,%ebp
+  800ce6:	57                   	push   %edi
+  800ce7:	56                   	push   %esi
+  800ce8:	53                   	push   %ebx
+  800ce9:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800cec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cf1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cf4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cf7:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800cfc:	89 df                	mov    %ebx,%edi
+  800cfe:	89 de                	mov    %ebx,%esi
+  800d00:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d02:	85 c0                	test   %eax,%eax
+  800d04:	7f 08                	jg     800d0e <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800d06:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d09:	5b                   	pop    %ebx
+  800d0a:	5e                   	pop    %esi
+  800d0b:	5f                   	pop    %edi
+  800d0c:	5d                   	pop    %ebp
+  800d0d:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d0e:	83 ec 0c             	sub    $0xc,%esp
+  800d11:	50                   	push   %eax
+  800d12:	6a 0a                	push   $0xa
+  800d14:	68 a3 29 80 00       	push   $0x8029a3
+  800d19:	6a 3e                	push   $0x3e
+  800d1b:	68 c0 29 80 00       	push   $0x8029c0
+  800d20:	e8 f3 f3 ff ff       	call   800118 <_panic>
+
+00800d25 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  800d25:	55                   	push   %ebp
+  800d26:	89 e5                	mov    %esp,%ebp
+  800d28:	57                   	push   %edi
+  800d29:	56                   	push   %esi
+  800d2a:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d2b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d2e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d31:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800d36:	be 00 00 00 00       	mov    $0x0,%esi
+  800d3b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d3e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d41:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800d43:	5b                   	pop    %ebx
+  800d44:	5e                   	pop    %esi
+  800d45:	5f                   	pop    %edi
+  800d46:	5d                   	pop    %ebp
+  800d47:	c3                   	ret
+
+00800d48 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  800d48:	55                   	push   %ebp
+  800d49:	89 e5                	mov    %esp,%ebp
+  800d4b:	57                   	push   %edi
+  800d4c:	56                   	push   %esi
+  800d4d:	53                   	push   %ebx
+  800d4e:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800d51:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d56:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d59:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800d5e:	89 cb                	mov    %ecx,%ebx
+  800d60:	89 cf                	mov    %ecx,%edi
+  800d62:	89 ce                	mov    %ecx,%esi
+  800d64:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d66:	85 c0                	test   %eax,%eax
+  800d68:	7f 08                	jg     800d72 <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  800d6a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d6d:	5b                   	pop    %ebx
+  800d6e:	5e                   	pop    %esi
+  800d6f:	5f                   	pop    %edi
+  800d70:	5d                   	pop    %ebp
+  800d71:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d72:	83 ec 0c             	sub    $0xc,%esp
+  800d75:	50                   	push   %eax
+  800d76:	6a 0d                	push   $0xd
+  800d78:	68 a3 29 80 00       	push   $0x8029a3
+  800d7d:	6a 3e                	push   $0x3e
+  800d7f:	68 c0 29 80 00       	push   $0x8029c0
+  800d84:	e8 8f f3 ff ff       	call   800118 <_panic>
+
+00800d89 <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  800d89:	55                   	push   %ebp
+  800d8a:	89 e5                	mov    %esp,%ebp
+  800d8c:	57                   	push   %edi
+  800d8d:	56                   	push   %esi
+  800d8e:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d8f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d94:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d97:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d9a:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800d9f:	89 df                	mov    %ebx,%edi
+  800da1:	89 de                	mov    %ebx,%esi
+  800da3:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  800da5:	5b                   	pop    %ebx
+  800da6:	5e                   	pop    %esi
+  800da7:	5f                   	pop    %edi
+  800da8:	5d                   	pop    %ebp
+  800da9:	c3                   	ret
+
+00800daa <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  800daa:	55                   	push   %ebp
+  800dab:	89 e5                	mov    %esp,%ebp
+  800dad:	57                   	push   %edi
+  800dae:	56                   	push   %esi
+  800daf:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800db0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800db5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800db8:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800dbd:	89 cb                	mov    %ecx,%ebx
+  800dbf:	89 cf                	mov    %ecx,%edi
+  800dc1:	89 ce                	mov    %ecx,%esi
+  800dc3:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  800dc5:	5b                   	pop    %ebx
+  800dc6:	5e                   	pop    %esi
+  800dc7:	5f                   	pop    %edi
+  800dc8:	5d                   	pop    %ebp
+  800dc9:	c3                   	ret
+
+00800dca <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  800dca:	55                   	push   %ebp
+  800dcb:	89 e5                	mov    %esp,%ebp
+  800dcd:	57                   	push   %edi
+  800dce:	56                   	push   %esi
+  800dcf:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800dd0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dd5:	b8 10 00 00 00       	mov    $0x10,%eax
+  800dda:	89 d1                	mov    %edx,%ecx
+  800ddc:	89 d3                	mov    %edx,%ebx
+  800dde:	89 d7                	mov    %edx,%edi
+  800de0:	89 d6                	mov    %edx,%esi
+  800de2:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800de4:	5b                   	pop    %ebx
+  800de5:	5e                   	pop    %esi
+  800de6:	5f                   	pop    %edi
+  800de7:	5d                   	pop    %ebp
+  800de8:	c3                   	ret
+
+00800de9 <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  800de9:	55                   	push   %ebp
+  800dea:	89 e5                	mov    %esp,%ebp
+  800dec:	57                   	push   %edi
+  800ded:	56                   	push   %esi
+  800dee:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800def:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800df4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dfa:	b8 11 00 00 00       	mov    $0x11,%eax
+  800dff:	89 df                	mov    %ebx,%edi
+  800e01:	89 de                	mov    %ebx,%esi
+  800e03:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800e05:	5b                   	pop    %ebx
+  800e06:	5e                   	pop    %esi
+  800e07:	5f                   	pop    %edi
+  800e08:	5d                   	pop    %ebp
+  800e09:	c3                   	ret
+
+00800e0a <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  800e0a:	55                   	push   %ebp
+  800e0b:	89 e5                	mov    %esp,%ebp
+  800e0d:	57                   	push   %edi
+  800e0e:	56                   	push   %esi
+  800e0f:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e10:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e15:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e18:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e1b:	b8 12 00 00 00       	mov    $0x12,%eax
+  800e20:	89 df                	mov    %ebx,%edi
+  800e22:	89 de                	mov    %ebx,%esi
+  800e24:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800e26:	5b                   	pop    %ebx
+  800e27:	5e                   	pop    %esi
+  800e28:	5f                   	pop    %edi
+  800e29:	5d                   	pop    %ebp
+  800e2a:	c3                   	ret
+
+00800e2b <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  800e2b:	55                   	push   %ebp
+  800e2c:	89 e5                	mov    %esp,%ebp
+  800e2e:	57                   	push   %edi
+  800e2f:	56                   	push   %esi
+  800e30:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e31:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e36:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e39:	b8 13 00 00 00       	mov    $0x13,%eax
+  800e3e:	89 cb                	mov    %ecx,%ebx
+  800e40:	89 cf                	mov    %ecx,%edi
+  800e42:	89 ce                	mov    %ecx,%esi
+  800e44:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  800e46:	5b                   	pop    %ebx
+  800e47:	5e                   	pop    %esi
+  800e48:	5f                   	pop    %edi
+  800e49:	5d                   	pop    %ebp
+  800e4a:	c3                   	ret
+
+00800e4b <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  800e4b:	55                   	push   %ebp
+  800e4c:	89 e5                	mov    %esp,%ebp
+  800e4e:	57                   	push   %edi
+  800e4f:	56                   	push   %esi
+  800e50:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e51:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e56:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e59:	b8 14 00 00 00       	mov    $0x14,%eax
+  800e5e:	89 cb                	mov    %ecx,%ebx
+  800e60:	89 cf                	mov    %ecx,%edi
+  800e62:	89 ce                	mov    %ecx,%esi
+  800e64:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  800e66:	5b                   	pop    %ebx
+  800e67:	5e                   	pop    %esi
+  800e68:	5f                   	pop    %edi
+  800e69:	5d                   	pop    %ebp
+  800e6a:	c3                   	ret
+
+00800e6b <set_pgfault_handler>:
+// allocate an exception stack (one page of memory with its top
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf)) {
+  800e6b:	55                   	push   %ebp
+  800e6c:	89 e5                	mov    %esp,%ebp
+  800e6e:	83 ec 08             	sub    $0x8,%esp
+  int r;
+
+  if (_pgfault_handler == 0) {
+  800e71:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  800e78:	74 0a                	je     800e84 <set_pgfault_handler+0x19>
+    if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)))
+      panic(" set_pgfault_handler sys_env_set_pgfault_upcall panic: %e\n", r);
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  800e7a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e7d:	a3 0c 40 80 00       	mov    %eax,0x80400c
+
+
+}
+  800e82:	c9                   	leave
+  800e83:	c3                   	ret
+    if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)))
+  800e84:	83 ec 04             	sub    $0x4,%esp
+  800e87:	6a 07                	push   $0x7
+  800e89:	68 00 f0 bf ee       	push   $0xeebff000
+  800e8e:	6a 00                	push   $0x0
+  800e90:	e8 03 fd ff ff       	call   800b98 <sys_page_alloc>
+  800e95:	83 c4 10             	add    $0x10,%esp
+  800e98:	85 c0                	test   %eax,%eax
+  800e9a:	75 28                	jne    800ec4 <set_pgfault_handler+0x59>
+    if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)))
+  800e9c:	83 ec 08             	sub    $0x8,%esp
+  800e9f:	68 d6 0e 80 00       	push   $0x800ed6
+  800ea4:	6a 00                	push   $0x0
+  800ea6:	e8 38 fe ff ff       	call   800ce3 <sys_env_set_pgfault_upcall>
+  800eab:	83 c4 10             	add    $0x10,%esp
+  800eae:	85 c0                	test   %eax,%eax
+  800eb0:	74 c8                	je     800e7a <set_pgfault_handler+0xf>
+      panic(" set_pgfault_handler sys_env_set_pgfault_upcall panic: %e\n", r);
+  800eb2:	50                   	push   %eax
+  800eb3:	68 00 2a 80 00       	push   $0x802a00
+  800eb8:	6a 22                	push   $0x22
+  800eba:	68 3b 2a 80 00       	push   $0x802a3b
+  800ebf:	e8 54 f2 ff ff       	call   800118 <_panic>
+      panic("set_pgfault_handler sys_page_alloc panic: %e\n", r);
+  800ec4:	50                   	push   %eax
+  800ec5:	68 d0 29 80 00       	push   $0x8029d0
+  800eca:	6a 20                	push   $0x20
+  800ecc:	68 3b 2a 80 00       	push   $0x802a3b
+  800ed1:	e8 42 f2 ff ff       	call   800118 <_panic>
+
+00800ed6 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  800ed6:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  800ed7:	a1 0c 40 80 00       	mov    0x80400c,%eax
+	call *%eax
+  800edc:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  800ede:	83 c4 04             	add    $0x4,%esp
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	// push the trap-time %eip onto the trap-time stack
+    subl $0x4, 0x30(%esp) # for push eip
+  800ee1:	83 6c 24 30 04       	subl   $0x4,0x30(%esp)
+    movl 0x30(%esp), %ebx #regular esp
+  800ee6:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+    movl 0x28(%esp), %eax #eip
+  800eea:	8b 44 24 28          	mov    0x28(%esp),%eax
+    movl %eax, (%ebx)
+  800eee:	89 03                	mov    %eax,(%ebx)
+
+    // Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+    addl $8, %esp
+  800ef0:	83 c4 08             	add    $0x8,%esp
+    popal
+  800ef3:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  800ef4:	83 c4 04             	add    $0x4,%esp
+	popfl
+  800ef7:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  800ef8:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  800ef9:	c3                   	ret
+
+00800efa <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800efa:	55                   	push   %ebp
+  800efb:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800efd:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f00:	05 00 00 00 30       	add    $0x30000000,%eax
+  800f05:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800f08:	5d                   	pop    %ebp
+  800f09:	c3                   	ret
+
+00800f0a <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800f0a:	55                   	push   %ebp
+  800f0b:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800f0d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f10:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800f15:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800f1a:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800f1f:	5d                   	pop    %ebp
+  800f20:	c3                   	ret
+
+00800f21 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800f21:	55                   	push   %ebp
+  800f22:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  800f24:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800f29:	eb 02                	jmp    800f2d <fd_alloc+0xc>
+  800f2b:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800f2d:	89 c2                	mov    %eax,%edx
+  800f2f:	c1 ea 16             	shr    $0x16,%edx
+  800f32:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800f39:	f6 c2 01             	test   $0x1,%dl
+  800f3c:	74 2b                	je     800f69 <fd_alloc+0x48>
+  800f3e:	89 c2                	mov    %eax,%edx
+  800f40:	c1 ea 0c             	shr    $0xc,%edx
+  800f43:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  800f4a:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  800f50:	f6 c1 01             	test   $0x1,%cl
+  800f53:	74 14                	je     800f69 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  800f55:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  800f5b:	75 ce                	jne    800f2b <fd_alloc+0xa>
+  800f5d:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  800f62:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800f67:	eb 05                	jmp    800f6e <fd_alloc+0x4d>
+			return 0;
+  800f69:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  800f6e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f71:	89 02                	mov    %eax,(%edx)
+}
+  800f73:	89 c8                	mov    %ecx,%eax
+  800f75:	5d                   	pop    %ebp
+  800f76:	c3                   	ret
+
+00800f77 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  800f77:	55                   	push   %ebp
+  800f78:	89 e5                	mov    %esp,%ebp
+  800f7a:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  800f7d:	83 f8 1f             	cmp    $0x1f,%eax
+  800f80:	77 30                	ja     800fb2 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  800f82:	c1 e0 0c             	shl    $0xc,%eax
+  800f85:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800f8a:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  800f90:	f6 c2 01             	test   $0x1,%dl
+  800f93:	74 24                	je     800fb9 <fd_lookup+0x42>
+  800f95:	89 c2                	mov    %eax,%edx
+  800f97:	c1 ea 0c             	shr    $0xc,%edx
+  800f9a:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800fa1:	f6 c2 01             	test   $0x1,%dl
+  800fa4:	74 1a                	je     800fc0 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  800fa6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800fa9:	89 02                	mov    %eax,(%edx)
+	return 0;
+  800fab:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fb0:	5d                   	pop    %ebp
+  800fb1:	c3                   	ret
+		return -E_INVAL;
+  800fb2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800fb7:	eb f7                	jmp    800fb0 <fd_lookup+0x39>
+		return -E_INVAL;
+  800fb9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800fbe:	eb f0                	jmp    800fb0 <fd_lookup+0x39>
+  800fc0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800fc5:	eb e9                	jmp    800fb0 <fd_lookup+0x39>
+
+00800fc7 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  800fc7:	55                   	push   %ebp
+  800fc8:	89 e5                	mov    %esp,%ebp
+  800fca:	53                   	push   %ebx
+  800fcb:	83 ec 04             	sub    $0x4,%esp
+  800fce:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  800fd1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fd6:	eb 03                	jmp    800fdb <dev_lookup+0x14>
+  800fd8:	83 c0 01             	add    $0x1,%eax
+  800fdb:	8b 1c 85 c8 2a 80 00 	mov    0x802ac8(,%eax,4),%ebx
+  800fe2:	85 db                	test   %ebx,%ebx
+  800fe4:	74 0b                	je     800ff1 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  800fe6:	39 13                	cmp    %edx,(%ebx)
+  800fe8:	75 ee                	jne    800fd8 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  800fea:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fef:	eb 1f                	jmp    801010 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800ff1:	a1 08 40 80 00       	mov    0x804008,%eax
+  800ff6:	8b 40 48             	mov    0x48(%eax),%eax
+  800ff9:	83 ec 04             	sub    $0x4,%esp
+  800ffc:	52                   	push   %edx
+  800ffd:	50                   	push   %eax
+  800ffe:	68 4c 2a 80 00       	push   $0x802a4c
+  801003:	e8 eb f1 ff ff       	call   8001f3 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801008:	83 c4 10             	add    $0x10,%esp
+  80100b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801010:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801013:	89 1a                	mov    %ebx,(%edx)
+}
+  801015:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801018:	c9                   	leave
+  801019:	c3                   	ret
+
+0080101a <fd_close>:
+{
+  80101a:	55                   	push   %ebp
+  80101b:	89 e5                	mov    %esp,%ebp
+  80101d:	57                   	push   %edi
+  80101e:	56                   	push   %esi
+  80101f:	53                   	push   %ebx
+  801020:	83 ec 24             	sub    $0x24,%esp
+  801023:	8b 75 08             	mov    0x8(%ebp),%esi
+  801026:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801029:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80102c:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80102d:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801033:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801036:	50                   	push   %eax
+  801037:	e8 3b ff ff ff       	call   800f77 <fd_lookup>
+  80103c:	89 c3                	mov    %eax,%ebx
+  80103e:	83 c4 10             	add    $0x10,%esp
+  801041:	85 c0                	test   %eax,%eax
+  801043:	78 05                	js     80104a <fd_close+0x30>
+	    || fd != fd2)
+  801045:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801048:	74 16                	je     801060 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80104a:	89 f8                	mov    %edi,%eax
+  80104c:	84 c0                	test   %al,%al
+  80104e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801053:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801056:	89 d8                	mov    %ebx,%eax
+  801058:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80105b:	5b                   	pop    %ebx
+  80105c:	5e                   	pop    %esi
+  80105d:	5f                   	pop    %edi
+  80105e:	5d                   	pop    %ebp
+  80105f:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801060:	83 ec 08             	sub    $0x8,%esp
+  801063:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801066:	50                   	push   %eax
+  801067:	ff 36                	push   (%esi)
+  801069:	e8 59 ff ff ff       	call   800fc7 <dev_lookup>
+  80106e:	89 c3                	mov    %eax,%ebx
+  801070:	83 c4 10             	add    $0x10,%esp
+  801073:	85 c0                	test   %eax,%eax
+  801075:	78 1a                	js     801091 <fd_close+0x77>
+		if (dev->dev_close)
+  801077:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80107a:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80107d:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801082:	85 c0                	test   %eax,%eax
+  801084:	74 0b                	je     801091 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801086:	83 ec 0c             	sub    $0xc,%esp
+  801089:	56                   	push   %esi
+  80108a:	ff d0                	call   *%eax
+  80108c:	89 c3                	mov    %eax,%ebx
+  80108e:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801091:	83 ec 08             	sub    $0x8,%esp
+  801094:	56                   	push   %esi
+  801095:	6a 00                	push   $0x0
+  801097:	e8 81 fb ff ff       	call   800c1d <sys_page_unmap>
+	return r;
+  80109c:	83 c4 10             	add    $0x10,%esp
+  80109f:	eb b5                	jmp    801056 <fd_close+0x3c>
+
+008010a1 <close>:
+
+int
+close(int fdnum)
+{
+  8010a1:	55                   	push   %ebp
+  8010a2:	89 e5                	mov    %esp,%ebp
+  8010a4:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8010a7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8010aa:	50                   	push   %eax
+  8010ab:	ff 75 08             	push   0x8(%ebp)
+  8010ae:	e8 c4 fe ff ff       	call   800f77 <fd_lookup>
+  8010b3:	83 c4 10             	add    $0x10,%esp
+  8010b6:	85 c0                	test   %eax,%eax
+  8010b8:	79 02                	jns    8010bc <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8010ba:	c9                   	leave
+  8010bb:	c3                   	ret
+		return fd_close(fd, 1);
+  8010bc:	83 ec 08             	sub    $0x8,%esp
+  8010bf:	6a 01                	push   $0x1
+  8010c1:	ff 75 f4             	push   -0xc(%ebp)
+  8010c4:	e8 51 ff ff ff       	call   80101a <fd_close>
+  8010c9:	83 c4 10             	add    $0x10,%esp
+  8010cc:	eb ec                	jmp    8010ba <close+0x19>
+
+008010ce <close_all>:
+
+void
+close_all(void)
+{
+  8010ce:	55                   	push   %ebp
+  8010cf:	89 e5                	mov    %esp,%ebp
+  8010d1:	53                   	push   %ebx
+  8010d2:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8010d5:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8010da:	83 ec 0c             	sub    $0xc,%esp
+  8010dd:	53                   	push   %ebx
+  8010de:	e8 be ff ff ff       	call   8010a1 <close>
+	for (i = 0; i < MAXFD; i++)
+  8010e3:	83 c3 01             	add    $0x1,%ebx
+  8010e6:	83 c4 10             	add    $0x10,%esp
+  8010e9:	83 fb 20             	cmp    $0x20,%ebx
+  8010ec:	75 ec                	jne    8010da <close_all+0xc>
+}
+  8010ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010f1:	c9                   	leave
+  8010f2:	c3                   	ret
+
+008010f3 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8010f3:	55                   	push   %ebp
+  8010f4:	89 e5                	mov    %esp,%ebp
+  8010f6:	57                   	push   %edi
+  8010f7:	56                   	push   %esi
+  8010f8:	53                   	push   %ebx
+  8010f9:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8010fc:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8010ff:	50                   	push   %eax
+  801100:	ff 75 08             	push   0x8(%ebp)
+  801103:	e8 6f fe ff ff       	call   800f77 <fd_lookup>
+  801108:	89 c3                	mov    %eax,%ebx
+  80110a:	83 c4 10             	add    $0x10,%esp
+  80110d:	85 c0                	test   %eax,%eax
+  80110f:	78 7f                	js     801190 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801111:	83 ec 0c             	sub    $0xc,%esp
+  801114:	ff 75 0c             	push   0xc(%ebp)
+  801117:	e8 85 ff ff ff       	call   8010a1 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80111c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80111f:	c1 e6 0c             	shl    $0xc,%esi
+  801122:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801128:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80112b:	89 3c 24             	mov    %edi,(%esp)
+  80112e:	e8 d7 fd ff ff       	call   800f0a <fd2data>
+  801133:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801135:	89 34 24             	mov    %esi,(%esp)
+  801138:	e8 cd fd ff ff       	call   800f0a <fd2data>
+  80113d:	83 c4 10             	add    $0x10,%esp
+  801140:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801143:	89 d8                	mov    %ebx,%eax
+  801145:	c1 e8 16             	shr    $0x16,%eax
+  801148:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80114f:	a8 01                	test   $0x1,%al
+  801151:	74 11                	je     801164 <dup+0x71>
+  801153:	89 d8                	mov    %ebx,%eax
+  801155:	c1 e8 0c             	shr    $0xc,%eax
+  801158:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80115f:	f6 c2 01             	test   $0x1,%dl
+  801162:	75 36                	jne    80119a <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801164:	89 f8                	mov    %edi,%eax
+  801166:	c1 e8 0c             	shr    $0xc,%eax
+  801169:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801170:	83 ec 0c             	sub    $0xc,%esp
+  801173:	25 07 0e 00 00       	and    $0xe07,%eax
+  801178:	50                   	push   %eax
+  801179:	56                   	push   %esi
+  80117a:	6a 00                	push   $0x0
+  80117c:	57                   	push   %edi
+  80117d:	6a 00                	push   $0x0
+  80117f:	e8 57 fa ff ff       	call   800bdb <sys_page_map>
+  801184:	89 c3                	mov    %eax,%ebx
+  801186:	83 c4 20             	add    $0x20,%esp
+  801189:	85 c0                	test   %eax,%eax
+  80118b:	78 33                	js     8011c0 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80118d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801190:	89 d8                	mov    %ebx,%eax
+  801192:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801195:	5b                   	pop    %ebx
+  801196:	5e                   	pop    %esi
+  801197:	5f                   	pop    %edi
+  801198:	5d                   	pop    %ebp
+  801199:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80119a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8011a1:	83 ec 0c             	sub    $0xc,%esp
+  8011a4:	25 07 0e 00 00       	and    $0xe07,%eax
+  8011a9:	50                   	push   %eax
+  8011aa:	ff 75 d4             	push   -0x2c(%ebp)
+  8011ad:	6a 00                	push   $0x0
+  8011af:	53                   	push   %ebx
+  8011b0:	6a 00                	push   $0x0
+  8011b2:	e8 24 fa ff ff       	call   800bdb <sys_page_map>
+  8011b7:	89 c3                	mov    %eax,%ebx
+  8011b9:	83 c4 20             	add    $0x20,%esp
+  8011bc:	85 c0                	test   %eax,%eax
+  8011be:	79 a4                	jns    801164 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8011c0:	83 ec 08             	sub    $0x8,%esp
+  8011c3:	56                   	push   %esi
+  8011c4:	6a 00                	push   $0x0
+  8011c6:	e8 52 fa ff ff       	call   800c1d <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8011cb:	83 c4 08             	add    $0x8,%esp
+  8011ce:	ff 75 d4             	push   -0x2c(%ebp)
+  8011d1:	6a 00                	push   $0x0
+  8011d3:	e8 45 fa ff ff       	call   800c1d <sys_page_unmap>
+	return r;
+  8011d8:	83 c4 10             	add    $0x10,%esp
+  8011db:	eb b3                	jmp    801190 <dup+0x9d>
+
+008011dd <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8011dd:	55                   	push   %ebp
+  8011de:	89 e5                	mov    %esp,%ebp
+  8011e0:	56                   	push   %esi
+  8011e1:	53                   	push   %ebx
+  8011e2:	83 ec 18             	sub    $0x18,%esp
+  8011e5:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8011e8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8011eb:	50                   	push   %eax
+  8011ec:	56                   	push   %esi
+  8011ed:	e8 85 fd ff ff       	call   800f77 <fd_lookup>
+  8011f2:	83 c4 10             	add    $0x10,%esp
+  8011f5:	85 c0                	test   %eax,%eax
+  8011f7:	78 3c                	js     801235 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8011f9:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8011fc:	83 ec 08             	sub    $0x8,%esp
+  8011ff:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801202:	50                   	push   %eax
+  801203:	ff 33                	push   (%ebx)
+  801205:	e8 bd fd ff ff       	call   800fc7 <dev_lookup>
+  80120a:	83 c4 10             	add    $0x10,%esp
+  80120d:	85 c0                	test   %eax,%eax
+  80120f:	78 24                	js     801235 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801211:	8b 43 08             	mov    0x8(%ebx),%eax
+  801214:	83 e0 03             	and    $0x3,%eax
+  801217:	83 f8 01             	cmp    $0x1,%eax
+  80121a:	74 20                	je     80123c <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80121c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80121f:	8b 40 08             	mov    0x8(%eax),%eax
+  801222:	85 c0                	test   %eax,%eax
+  801224:	74 37                	je     80125d <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801226:	83 ec 04             	sub    $0x4,%esp
+  801229:	ff 75 10             	push   0x10(%ebp)
+  80122c:	ff 75 0c             	push   0xc(%ebp)
+  80122f:	53                   	push   %ebx
+  801230:	ff d0                	call   *%eax
+  801232:	83 c4 10             	add    $0x10,%esp
+}
+  801235:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801238:	5b                   	pop    %ebx
+  801239:	5e                   	pop    %esi
+  80123a:	5d                   	pop    %ebp
+  80123b:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80123c:	a1 08 40 80 00       	mov    0x804008,%eax
+  801241:	8b 40 48             	mov    0x48(%eax),%eax
+  801244:	83 ec 04             	sub    $0x4,%esp
+  801247:	56                   	push   %esi
+  801248:	50                   	push   %eax
+  801249:	68 8d 2a 80 00       	push   $0x802a8d
+  80124e:	e8 a0 ef ff ff       	call   8001f3 <cprintf>
+		return -E_INVAL;
+  801253:	83 c4 10             	add    $0x10,%esp
+  801256:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80125b:	eb d8                	jmp    801235 <read+0x58>
+		return -E_NOT_SUPP;
+  80125d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801262:	eb d1                	jmp    801235 <read+0x58>
+
+00801264 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801264:	55                   	push   %ebp
+  801265:	89 e5                	mov    %esp,%ebp
+  801267:	57                   	push   %edi
+  801268:	56                   	push   %esi
+  801269:	53                   	push   %ebx
+  80126a:	83 ec 0c             	sub    $0xc,%esp
+  80126d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801270:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801273:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801278:	eb 02                	jmp    80127c <readn+0x18>
+  80127a:	01 c3                	add    %eax,%ebx
+  80127c:	39 f3                	cmp    %esi,%ebx
+  80127e:	73 21                	jae    8012a1 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801280:	83 ec 04             	sub    $0x4,%esp
+  801283:	89 f0                	mov    %esi,%eax
+  801285:	29 d8                	sub    %ebx,%eax
+  801287:	50                   	push   %eax
+  801288:	89 d8                	mov    %ebx,%eax
+  80128a:	03 45 0c             	add    0xc(%ebp),%eax
+  80128d:	50                   	push   %eax
+  80128e:	57                   	push   %edi
+  80128f:	e8 49 ff ff ff       	call   8011dd <read>
+		if (m < 0)
+  801294:	83 c4 10             	add    $0x10,%esp
+  801297:	85 c0                	test   %eax,%eax
+  801299:	78 04                	js     80129f <readn+0x3b>
+			return m;
+		if (m == 0)
+  80129b:	75 dd                	jne    80127a <readn+0x16>
+  80129d:	eb 02                	jmp    8012a1 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80129f:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8012a1:	89 d8                	mov    %ebx,%eax
+  8012a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012a6:	5b                   	pop    %ebx
+  8012a7:	5e                   	pop    %esi
+  8012a8:	5f                   	pop    %edi
+  8012a9:	5d                   	pop    %ebp
+  8012aa:	c3                   	ret
+
+008012ab <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8012ab:	55                   	push   %ebp
+  8012ac:	89 e5                	mov    %esp,%ebp
+  8012ae:	56                   	push   %esi
+  8012af:	53                   	push   %ebx
+  8012b0:	83 ec 18             	sub    $0x18,%esp
+  8012b3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8012b6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8012b9:	50                   	push   %eax
+  8012ba:	53                   	push   %ebx
+  8012bb:	e8 b7 fc ff ff       	call   800f77 <fd_lookup>
+  8012c0:	83 c4 10             	add    $0x10,%esp
+  8012c3:	85 c0                	test   %eax,%eax
+  8012c5:	78 37                	js     8012fe <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8012c7:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8012ca:	83 ec 08             	sub    $0x8,%esp
+  8012cd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8012d0:	50                   	push   %eax
+  8012d1:	ff 36                	push   (%esi)
+  8012d3:	e8 ef fc ff ff       	call   800fc7 <dev_lookup>
+  8012d8:	83 c4 10             	add    $0x10,%esp
+  8012db:	85 c0                	test   %eax,%eax
+  8012dd:	78 1f                	js     8012fe <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8012df:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8012e3:	74 20                	je     801305 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8012e5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8012e8:	8b 40 0c             	mov    0xc(%eax),%eax
+  8012eb:	85 c0                	test   %eax,%eax
+  8012ed:	74 37                	je     801326 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8012ef:	83 ec 04             	sub    $0x4,%esp
+  8012f2:	ff 75 10             	push   0x10(%ebp)
+  8012f5:	ff 75 0c             	push   0xc(%ebp)
+  8012f8:	56                   	push   %esi
+  8012f9:	ff d0                	call   *%eax
+  8012fb:	83 c4 10             	add    $0x10,%esp
+}
+  8012fe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801301:	5b                   	pop    %ebx
+  801302:	5e                   	pop    %esi
+  801303:	5d                   	pop    %ebp
+  801304:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801305:	a1 08 40 80 00       	mov    0x804008,%eax
+  80130a:	8b 40 48             	mov    0x48(%eax),%eax
+  80130d:	83 ec 04             	sub    $0x4,%esp
+  801310:	53                   	push   %ebx
+  801311:	50                   	push   %eax
+  801312:	68 a9 2a 80 00       	push   $0x802aa9
+  801317:	e8 d7 ee ff ff       	call   8001f3 <cprintf>
+		return -E_INVAL;
+  80131c:	83 c4 10             	add    $0x10,%esp
+  80131f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801324:	eb d8                	jmp    8012fe <write+0x53>
+		return -E_NOT_SUPP;
+  801326:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80132b:	eb d1                	jmp    8012fe <write+0x53>
+
+0080132d <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80132d:	55                   	push   %ebp
+  80132e:	89 e5                	mov    %esp,%ebp
+  801330:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801333:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801336:	50                   	push   %eax
+  801337:	ff 75 08             	push   0x8(%ebp)
+  80133a:	e8 38 fc ff ff       	call   800f77 <fd_lookup>
+  80133f:	83 c4 10             	add    $0x10,%esp
+  801342:	85 c0                	test   %eax,%eax
+  801344:	78 0e                	js     801354 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801346:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801349:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80134c:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80134f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801354:	c9                   	leave
+  801355:	c3                   	ret
+
+00801356 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801356:	55                   	push   %ebp
+  801357:	89 e5                	mov    %esp,%ebp
+  801359:	56                   	push   %esi
+  80135a:	53                   	push   %ebx
+  80135b:	83 ec 18             	sub    $0x18,%esp
+  80135e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801361:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801364:	50                   	push   %eax
+  801365:	53                   	push   %ebx
+  801366:	e8 0c fc ff ff       	call   800f77 <fd_lookup>
+  80136b:	83 c4 10             	add    $0x10,%esp
+  80136e:	85 c0                	test   %eax,%eax
+  801370:	78 34                	js     8013a6 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801372:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801375:	83 ec 08             	sub    $0x8,%esp
+  801378:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80137b:	50                   	push   %eax
+  80137c:	ff 36                	push   (%esi)
+  80137e:	e8 44 fc ff ff       	call   800fc7 <dev_lookup>
+  801383:	83 c4 10             	add    $0x10,%esp
+  801386:	85 c0                	test   %eax,%eax
+  801388:	78 1c                	js     8013a6 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80138a:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80138e:	74 1d                	je     8013ad <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801390:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801393:	8b 40 18             	mov    0x18(%eax),%eax
+  801396:	85 c0                	test   %eax,%eax
+  801398:	74 34                	je     8013ce <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80139a:	83 ec 08             	sub    $0x8,%esp
+  80139d:	ff 75 0c             	push   0xc(%ebp)
+  8013a0:	56                   	push   %esi
+  8013a1:	ff d0                	call   *%eax
+  8013a3:	83 c4 10             	add    $0x10,%esp
+}
+  8013a6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013a9:	5b                   	pop    %ebx
+  8013aa:	5e                   	pop    %esi
+  8013ab:	5d                   	pop    %ebp
+  8013ac:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8013ad:	a1 08 40 80 00       	mov    0x804008,%eax
+  8013b2:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8013b5:	83 ec 04             	sub    $0x4,%esp
+  8013b8:	53                   	push   %ebx
+  8013b9:	50                   	push   %eax
+  8013ba:	68 6c 2a 80 00       	push   $0x802a6c
+  8013bf:	e8 2f ee ff ff       	call   8001f3 <cprintf>
+		return -E_INVAL;
+  8013c4:	83 c4 10             	add    $0x10,%esp
+  8013c7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013cc:	eb d8                	jmp    8013a6 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8013ce:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8013d3:	eb d1                	jmp    8013a6 <ftruncate+0x50>
+
+008013d5 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8013d5:	55                   	push   %ebp
+  8013d6:	89 e5                	mov    %esp,%ebp
+  8013d8:	56                   	push   %esi
+  8013d9:	53                   	push   %ebx
+  8013da:	83 ec 18             	sub    $0x18,%esp
+  8013dd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8013e0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8013e3:	50                   	push   %eax
+  8013e4:	ff 75 08             	push   0x8(%ebp)
+  8013e7:	e8 8b fb ff ff       	call   800f77 <fd_lookup>
+  8013ec:	83 c4 10             	add    $0x10,%esp
+  8013ef:	85 c0                	test   %eax,%eax
+  8013f1:	78 49                	js     80143c <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8013f3:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8013f6:	83 ec 08             	sub    $0x8,%esp
+  8013f9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013fc:	50                   	push   %eax
+  8013fd:	ff 36                	push   (%esi)
+  8013ff:	e8 c3 fb ff ff       	call   800fc7 <dev_lookup>
+  801404:	83 c4 10             	add    $0x10,%esp
+  801407:	85 c0                	test   %eax,%eax
+  801409:	78 31                	js     80143c <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  80140b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80140e:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801412:	74 2f                	je     801443 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801414:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801417:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80141e:	00 00 00 
+	stat->st_isdir = 0;
+  801421:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801428:	00 00 00 
+	stat->st_dev = dev;
+  80142b:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801431:	83 ec 08             	sub    $0x8,%esp
+  801434:	53                   	push   %ebx
+  801435:	56                   	push   %esi
+  801436:	ff 50 14             	call   *0x14(%eax)
+  801439:	83 c4 10             	add    $0x10,%esp
+}
+  80143c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80143f:	5b                   	pop    %ebx
+  801440:	5e                   	pop    %esi
+  801441:	5d                   	pop    %ebp
+  801442:	c3                   	ret
+		return -E_NOT_SUPP;
+  801443:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801448:	eb f2                	jmp    80143c <fstat+0x67>
+
+0080144a <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80144a:	55                   	push   %ebp
+  80144b:	89 e5                	mov    %esp,%ebp
+  80144d:	56                   	push   %esi
+  80144e:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80144f:	83 ec 08             	sub    $0x8,%esp
+  801452:	6a 00                	push   $0x0
+  801454:	ff 75 08             	push   0x8(%ebp)
+  801457:	e8 e4 01 00 00       	call   801640 <open>
+  80145c:	89 c3                	mov    %eax,%ebx
+  80145e:	83 c4 10             	add    $0x10,%esp
+  801461:	85 c0                	test   %eax,%eax
+  801463:	78 1b                	js     801480 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801465:	83 ec 08             	sub    $0x8,%esp
+  801468:	ff 75 0c             	push   0xc(%ebp)
+  80146b:	50                   	push   %eax
+  80146c:	e8 64 ff ff ff       	call   8013d5 <fstat>
+  801471:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801473:	89 1c 24             	mov    %ebx,(%esp)
+  801476:	e8 26 fc ff ff       	call   8010a1 <close>
+	return r;
+  80147b:	83 c4 10             	add    $0x10,%esp
+  80147e:	89 f3                	mov    %esi,%ebx
+}
+  801480:	89 d8                	mov    %ebx,%eax
+  801482:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801485:	5b                   	pop    %ebx
+  801486:	5e                   	pop    %esi
+  801487:	5d                   	pop    %ebp
+  801488:	c3                   	ret
+
+00801489 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  801489:	55                   	push   %ebp
+  80148a:	89 e5                	mov    %esp,%ebp
+  80148c:	56                   	push   %esi
+  80148d:	53                   	push   %ebx
+  80148e:	89 c6                	mov    %eax,%esi
+  801490:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  801492:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  801499:	74 27                	je     8014c2 <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80149b:	6a 07                	push   $0x7
+  80149d:	68 00 50 80 00       	push   $0x805000
+  8014a2:	56                   	push   %esi
+  8014a3:	ff 35 00 40 80 00    	push   0x804000
+  8014a9:	e8 d1 0b 00 00       	call   80207f <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  8014ae:	83 c4 0c             	add    $0xc,%esp
+  8014b1:	6a 00                	push   $0x0
+  8014b3:	53                   	push   %ebx
+  8014b4:	6a 00                	push   $0x0
+  8014b6:	e8 50 0b 00 00       	call   80200b <ipc_recv>
+}
+  8014bb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014be:	5b                   	pop    %ebx
+  8014bf:	5e                   	pop    %esi
+  8014c0:	5d                   	pop    %ebp
+  8014c1:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  8014c2:	83 ec 0c             	sub    $0xc,%esp
+  8014c5:	6a 01                	push   $0x1
+  8014c7:	e8 07 0c 00 00       	call   8020d3 <ipc_find_env>
+  8014cc:	a3 00 40 80 00       	mov    %eax,0x804000
+  8014d1:	83 c4 10             	add    $0x10,%esp
+  8014d4:	eb c5                	jmp    80149b <fsipc+0x12>
+
+008014d6 <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8014d6:	55                   	push   %ebp
+  8014d7:	89 e5                	mov    %esp,%ebp
+  8014d9:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8014dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014df:	8b 40 0c             	mov    0xc(%eax),%eax
+  8014e2:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.set_size.req_size = newsize;
+  8014e7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8014ea:	a3 04 50 80 00       	mov    %eax,0x805004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  8014ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014f4:	b8 02 00 00 00       	mov    $0x2,%eax
+  8014f9:	e8 8b ff ff ff       	call   801489 <fsipc>
+}
+  8014fe:	c9                   	leave
+  8014ff:	c3                   	ret
+
+00801500 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801500:	55                   	push   %ebp
+  801501:	89 e5                	mov    %esp,%ebp
+  801503:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801506:	8b 45 08             	mov    0x8(%ebp),%eax
+  801509:	8b 40 0c             	mov    0xc(%eax),%eax
+  80150c:	a3 00 50 80 00       	mov    %eax,0x805000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801511:	ba 00 00 00 00       	mov    $0x0,%edx
+  801516:	b8 06 00 00 00       	mov    $0x6,%eax
+  80151b:	e8 69 ff ff ff       	call   801489 <fsipc>
+}
+  801520:	c9                   	leave
+  801521:	c3                   	ret
+
+00801522 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801522:	55                   	push   %ebp
+  801523:	89 e5                	mov    %esp,%ebp
+  801525:	53                   	push   %ebx
+  801526:	83 ec 04             	sub    $0x4,%esp
+  801529:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80152c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80152f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801532:	a3 00 50 80 00       	mov    %eax,0x805000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801537:	ba 00 00 00 00       	mov    $0x0,%edx
+  80153c:	b8 05 00 00 00       	mov    $0x5,%eax
+  801541:	e8 43 ff ff ff       	call   801489 <fsipc>
+  801546:	85 c0                	test   %eax,%eax
+  801548:	78 2c                	js     801576 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80154a:	83 ec 08             	sub    $0x8,%esp
+  80154d:	68 00 50 80 00       	push   $0x805000
+  801552:	53                   	push   %ebx
+  801553:	e8 54 f2 ff ff       	call   8007ac <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801558:	a1 80 50 80 00       	mov    0x805080,%eax
+  80155d:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801563:	a1 84 50 80 00       	mov    0x805084,%eax
+  801568:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  80156e:	83 c4 10             	add    $0x10,%esp
+  801571:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801576:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801579:	c9                   	leave
+  80157a:	c3                   	ret
+
+0080157b <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80157b:	55                   	push   %ebp
+  80157c:	89 e5                	mov    %esp,%ebp
+  80157e:	83 ec 0c             	sub    $0xc,%esp
+  801581:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801584:	8b 55 08             	mov    0x8(%ebp),%edx
+  801587:	8b 52 0c             	mov    0xc(%edx),%edx
+  80158a:	89 15 00 50 80 00    	mov    %edx,0x805000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801590:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801595:	39 d0                	cmp    %edx,%eax
+  801597:	0f 47 c2             	cmova  %edx,%eax
+  80159a:	a3 04 50 80 00       	mov    %eax,0x805004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  80159f:	50                   	push   %eax
+  8015a0:	ff 75 0c             	push   0xc(%ebp)
+  8015a3:	68 08 50 80 00       	push   $0x805008
+  8015a8:	e8 85 f3 ff ff       	call   800932 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  8015ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015b2:	b8 04 00 00 00       	mov    $0x4,%eax
+  8015b7:	e8 cd fe ff ff       	call   801489 <fsipc>
+}
+  8015bc:	c9                   	leave
+  8015bd:	c3                   	ret
+
+008015be <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8015be:	55                   	push   %ebp
+  8015bf:	89 e5                	mov    %esp,%ebp
+  8015c1:	56                   	push   %esi
+  8015c2:	53                   	push   %ebx
+  8015c3:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8015c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015c9:	8b 40 0c             	mov    0xc(%eax),%eax
+  8015cc:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.read.req_n = n;
+  8015d1:	89 35 04 50 80 00    	mov    %esi,0x805004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8015d7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015dc:	b8 03 00 00 00       	mov    $0x3,%eax
+  8015e1:	e8 a3 fe ff ff       	call   801489 <fsipc>
+  8015e6:	89 c3                	mov    %eax,%ebx
+  8015e8:	85 c0                	test   %eax,%eax
+  8015ea:	78 1f                	js     80160b <devfile_read+0x4d>
+  assert(r <= n);
+  8015ec:	39 c6                	cmp    %eax,%esi
+  8015ee:	72 24                	jb     801614 <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  8015f0:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8015f5:	7f 33                	jg     80162a <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8015f7:	83 ec 04             	sub    $0x4,%esp
+  8015fa:	50                   	push   %eax
+  8015fb:	68 00 50 80 00       	push   $0x805000
+  801600:	ff 75 0c             	push   0xc(%ebp)
+  801603:	e8 2a f3 ff ff       	call   800932 <memmove>
+  return r;
+  801608:	83 c4 10             	add    $0x10,%esp
+}
+  80160b:	89 d8                	mov    %ebx,%eax
+  80160d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801610:	5b                   	pop    %ebx
+  801611:	5e                   	pop    %esi
+  801612:	5d                   	pop    %ebp
+  801613:	c3                   	ret
+  assert(r <= n);
+  801614:	68 dc 2a 80 00       	push   $0x802adc
+  801619:	68 e3 2a 80 00       	push   $0x802ae3
+  80161e:	6a 78                	push   $0x78
+  801620:	68 f8 2a 80 00       	push   $0x802af8
+  801625:	e8 ee ea ff ff       	call   800118 <_panic>
+  assert(r <= PGSIZE);
+  80162a:	68 03 2b 80 00       	push   $0x802b03
+  80162f:	68 e3 2a 80 00       	push   $0x802ae3
+  801634:	6a 79                	push   $0x79
+  801636:	68 f8 2a 80 00       	push   $0x802af8
+  80163b:	e8 d8 ea ff ff       	call   800118 <_panic>
+
+00801640 <open>:
+open(const char *path, int mode) {
+  801640:	55                   	push   %ebp
+  801641:	89 e5                	mov    %esp,%ebp
+  801643:	56                   	push   %esi
+  801644:	53                   	push   %ebx
+  801645:	83 ec 1c             	sub    $0x1c,%esp
+  801648:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  80164b:	56                   	push   %esi
+  80164c:	e8 20 f1 ff ff       	call   800771 <strlen>
+  801651:	83 c4 10             	add    $0x10,%esp
+  801654:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801659:	7f 6c                	jg     8016c7 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  80165b:	83 ec 0c             	sub    $0xc,%esp
+  80165e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801661:	50                   	push   %eax
+  801662:	e8 ba f8 ff ff       	call   800f21 <fd_alloc>
+  801667:	89 c3                	mov    %eax,%ebx
+  801669:	83 c4 10             	add    $0x10,%esp
+  80166c:	85 c0                	test   %eax,%eax
+  80166e:	78 3c                	js     8016ac <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801670:	83 ec 08             	sub    $0x8,%esp
+  801673:	56                   	push   %esi
+  801674:	68 00 50 80 00       	push   $0x805000
+  801679:	e8 2e f1 ff ff       	call   8007ac <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  80167e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801681:	a3 00 54 80 00       	mov    %eax,0x805400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801686:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801689:	b8 01 00 00 00       	mov    $0x1,%eax
+  80168e:	e8 f6 fd ff ff       	call   801489 <fsipc>
+  801693:	89 c3                	mov    %eax,%ebx
+  801695:	83 c4 10             	add    $0x10,%esp
+  801698:	85 c0                	test   %eax,%eax
+  80169a:	78 19                	js     8016b5 <open+0x75>
+  return fd2num(fd);
+  80169c:	83 ec 0c             	sub    $0xc,%esp
+  80169f:	ff 75 f4             	push   -0xc(%ebp)
+  8016a2:	e8 53 f8 ff ff       	call   800efa <fd2num>
+  8016a7:	89 c3                	mov    %eax,%ebx
+  8016a9:	83 c4 10             	add    $0x10,%esp
+}
+  8016ac:	89 d8                	mov    %ebx,%eax
+  8016ae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016b1:	5b                   	pop    %ebx
+  8016b2:	5e                   	pop    %esi
+  8016b3:	5d                   	pop    %ebp
+  8016b4:	c3                   	ret
+    fd_close(fd, 0);
+  8016b5:	83 ec 08             	sub    $0x8,%esp
+  8016b8:	6a 00                	push   $0x0
+  8016ba:	ff 75 f4             	push   -0xc(%ebp)
+  8016bd:	e8 58 f9 ff ff       	call   80101a <fd_close>
+    return r;
+  8016c2:	83 c4 10             	add    $0x10,%esp
+  8016c5:	eb e5                	jmp    8016ac <open+0x6c>
+    return -E_BAD_PATH;
+  8016c7:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8016cc:	eb de                	jmp    8016ac <open+0x6c>
+
+008016ce <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  8016ce:	55                   	push   %ebp
+  8016cf:	89 e5                	mov    %esp,%ebp
+  8016d1:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  8016d4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016d9:	b8 08 00 00 00       	mov    $0x8,%eax
+  8016de:	e8 a6 fd ff ff       	call   801489 <fsipc>
+}
+  8016e3:	c9                   	leave
+  8016e4:	c3                   	ret
+
+008016e5 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8016e5:	55                   	push   %ebp
+  8016e6:	89 e5                	mov    %esp,%ebp
+  8016e8:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8016eb:	68 0f 2b 80 00       	push   $0x802b0f
+  8016f0:	ff 75 0c             	push   0xc(%ebp)
+  8016f3:	e8 b4 f0 ff ff       	call   8007ac <strcpy>
+	return 0;
+}
+  8016f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016fd:	c9                   	leave
+  8016fe:	c3                   	ret
+
+008016ff <devsock_close>:
+{
+  8016ff:	55                   	push   %ebp
+  801700:	89 e5                	mov    %esp,%ebp
+  801702:	53                   	push   %ebx
+  801703:	83 ec 10             	sub    $0x10,%esp
+  801706:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801709:	53                   	push   %ebx
+  80170a:	e8 03 0a 00 00       	call   802112 <pageref>
+  80170f:	89 c2                	mov    %eax,%edx
+  801711:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801714:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801719:	83 fa 01             	cmp    $0x1,%edx
+  80171c:	74 05                	je     801723 <devsock_close+0x24>
+}
+  80171e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801721:	c9                   	leave
+  801722:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801723:	83 ec 0c             	sub    $0xc,%esp
+  801726:	ff 73 0c             	push   0xc(%ebx)
+  801729:	e8 b7 02 00 00       	call   8019e5 <nsipc_close>
+  80172e:	83 c4 10             	add    $0x10,%esp
+  801731:	eb eb                	jmp    80171e <devsock_close+0x1f>
+
+00801733 <devsock_write>:
+{
+  801733:	55                   	push   %ebp
+  801734:	89 e5                	mov    %esp,%ebp
+  801736:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801739:	6a 00                	push   $0x0
+  80173b:	ff 75 10             	push   0x10(%ebp)
+  80173e:	ff 75 0c             	push   0xc(%ebp)
+  801741:	8b 45 08             	mov    0x8(%ebp),%eax
+  801744:	ff 70 0c             	push   0xc(%eax)
+  801747:	e8 79 03 00 00       	call   801ac5 <nsipc_send>
+}
+  80174c:	c9                   	leave
+  80174d:	c3                   	ret
+
+0080174e <devsock_read>:
+{
+  80174e:	55                   	push   %ebp
+  80174f:	89 e5                	mov    %esp,%ebp
+  801751:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801754:	6a 00                	push   $0x0
+  801756:	ff 75 10             	push   0x10(%ebp)
+  801759:	ff 75 0c             	push   0xc(%ebp)
+  80175c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80175f:	ff 70 0c             	push   0xc(%eax)
+  801762:	e8 ef 02 00 00       	call   801a56 <nsipc_recv>
+}
+  801767:	c9                   	leave
+  801768:	c3                   	ret
+
+00801769 <fd2sockid>:
+{
+  801769:	55                   	push   %ebp
+  80176a:	89 e5                	mov    %esp,%ebp
+  80176c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  80176f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801772:	52                   	push   %edx
+  801773:	50                   	push   %eax
+  801774:	e8 fe f7 ff ff       	call   800f77 <fd_lookup>
+  801779:	83 c4 10             	add    $0x10,%esp
+  80177c:	85 c0                	test   %eax,%eax
+  80177e:	78 10                	js     801790 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801780:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801783:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  801789:	39 08                	cmp    %ecx,(%eax)
+  80178b:	75 05                	jne    801792 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  80178d:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801790:	c9                   	leave
+  801791:	c3                   	ret
+		return -E_NOT_SUPP;
+  801792:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801797:	eb f7                	jmp    801790 <fd2sockid+0x27>
+
+00801799 <alloc_sockfd>:
+{
+  801799:	55                   	push   %ebp
+  80179a:	89 e5                	mov    %esp,%ebp
+  80179c:	56                   	push   %esi
+  80179d:	53                   	push   %ebx
+  80179e:	83 ec 1c             	sub    $0x1c,%esp
+  8017a1:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8017a3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017a6:	50                   	push   %eax
+  8017a7:	e8 75 f7 ff ff       	call   800f21 <fd_alloc>
+  8017ac:	89 c3                	mov    %eax,%ebx
+  8017ae:	83 c4 10             	add    $0x10,%esp
+  8017b1:	85 c0                	test   %eax,%eax
+  8017b3:	78 43                	js     8017f8 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8017b5:	83 ec 04             	sub    $0x4,%esp
+  8017b8:	68 07 04 00 00       	push   $0x407
+  8017bd:	ff 75 f4             	push   -0xc(%ebp)
+  8017c0:	6a 00                	push   $0x0
+  8017c2:	e8 d1 f3 ff ff       	call   800b98 <sys_page_alloc>
+  8017c7:	89 c3                	mov    %eax,%ebx
+  8017c9:	83 c4 10             	add    $0x10,%esp
+  8017cc:	85 c0                	test   %eax,%eax
+  8017ce:	78 28                	js     8017f8 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8017d0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017d3:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  8017d9:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8017db:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017de:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8017e5:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8017e8:	83 ec 0c             	sub    $0xc,%esp
+  8017eb:	50                   	push   %eax
+  8017ec:	e8 09 f7 ff ff       	call   800efa <fd2num>
+  8017f1:	89 c3                	mov    %eax,%ebx
+  8017f3:	83 c4 10             	add    $0x10,%esp
+  8017f6:	eb 0c                	jmp    801804 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8017f8:	83 ec 0c             	sub    $0xc,%esp
+  8017fb:	56                   	push   %esi
+  8017fc:	e8 e4 01 00 00       	call   8019e5 <nsipc_close>
+		return r;
+  801801:	83 c4 10             	add    $0x10,%esp
+}
+  801804:	89 d8                	mov    %ebx,%eax
+  801806:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801809:	5b                   	pop    %ebx
+  80180a:	5e                   	pop    %esi
+  80180b:	5d                   	pop    %ebp
+  80180c:	c3                   	ret
+
+0080180d <accept>:
+{
+  80180d:	55                   	push   %ebp
+  80180e:	89 e5                	mov    %esp,%ebp
+  801810:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801813:	8b 45 08             	mov    0x8(%ebp),%eax
+  801816:	e8 4e ff ff ff       	call   801769 <fd2sockid>
+  80181b:	85 c0                	test   %eax,%eax
+  80181d:	78 1b                	js     80183a <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  80181f:	83 ec 04             	sub    $0x4,%esp
+  801822:	ff 75 10             	push   0x10(%ebp)
+  801825:	ff 75 0c             	push   0xc(%ebp)
+  801828:	50                   	push   %eax
+  801829:	e8 0e 01 00 00       	call   80193c <nsipc_accept>
+  80182e:	83 c4 10             	add    $0x10,%esp
+  801831:	85 c0                	test   %eax,%eax
+  801833:	78 05                	js     80183a <accept+0x2d>
+	return alloc_sockfd(r);
+  801835:	e8 5f ff ff ff       	call   801799 <alloc_sockfd>
+}
+  80183a:	c9                   	leave
+  80183b:	c3                   	ret
+
+0080183c <bind>:
+{
+  80183c:	55                   	push   %ebp
+  80183d:	89 e5                	mov    %esp,%ebp
+  80183f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801842:	8b 45 08             	mov    0x8(%ebp),%eax
+  801845:	e8 1f ff ff ff       	call   801769 <fd2sockid>
+  80184a:	85 c0                	test   %eax,%eax
+  80184c:	78 12                	js     801860 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  80184e:	83 ec 04             	sub    $0x4,%esp
+  801851:	ff 75 10             	push   0x10(%ebp)
+  801854:	ff 75 0c             	push   0xc(%ebp)
+  801857:	50                   	push   %eax
+  801858:	e8 31 01 00 00       	call   80198e <nsipc_bind>
+  80185d:	83 c4 10             	add    $0x10,%esp
+}
+  801860:	c9                   	leave
+  801861:	c3                   	ret
+
+00801862 <shutdown>:
+{
+  801862:	55                   	push   %ebp
+  801863:	89 e5                	mov    %esp,%ebp
+  801865:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801868:	8b 45 08             	mov    0x8(%ebp),%eax
+  80186b:	e8 f9 fe ff ff       	call   801769 <fd2sockid>
+  801870:	85 c0                	test   %eax,%eax
+  801872:	78 0f                	js     801883 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801874:	83 ec 08             	sub    $0x8,%esp
+  801877:	ff 75 0c             	push   0xc(%ebp)
+  80187a:	50                   	push   %eax
+  80187b:	e8 43 01 00 00       	call   8019c3 <nsipc_shutdown>
+  801880:	83 c4 10             	add    $0x10,%esp
+}
+  801883:	c9                   	leave
+  801884:	c3                   	ret
+
+00801885 <connect>:
+{
+  801885:	55                   	push   %ebp
+  801886:	89 e5                	mov    %esp,%ebp
+  801888:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80188b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80188e:	e8 d6 fe ff ff       	call   801769 <fd2sockid>
+  801893:	85 c0                	test   %eax,%eax
+  801895:	78 12                	js     8018a9 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801897:	83 ec 04             	sub    $0x4,%esp
+  80189a:	ff 75 10             	push   0x10(%ebp)
+  80189d:	ff 75 0c             	push   0xc(%ebp)
+  8018a0:	50                   	push   %eax
+  8018a1:	e8 59 01 00 00       	call   8019ff <nsipc_connect>
+  8018a6:	83 c4 10             	add    $0x10,%esp
+}
+  8018a9:	c9                   	leave
+  8018aa:	c3                   	ret
+
+008018ab <listen>:
+{
+  8018ab:	55                   	push   %ebp
+  8018ac:	89 e5                	mov    %esp,%ebp
+  8018ae:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8018b1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018b4:	e8 b0 fe ff ff       	call   801769 <fd2sockid>
+  8018b9:	85 c0                	test   %eax,%eax
+  8018bb:	78 0f                	js     8018cc <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8018bd:	83 ec 08             	sub    $0x8,%esp
+  8018c0:	ff 75 0c             	push   0xc(%ebp)
+  8018c3:	50                   	push   %eax
+  8018c4:	e8 6b 01 00 00       	call   801a34 <nsipc_listen>
+  8018c9:	83 c4 10             	add    $0x10,%esp
+}
+  8018cc:	c9                   	leave
+  8018cd:	c3                   	ret
+
+008018ce <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8018ce:	55                   	push   %ebp
+  8018cf:	89 e5                	mov    %esp,%ebp
+  8018d1:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8018d4:	ff 75 10             	push   0x10(%ebp)
+  8018d7:	ff 75 0c             	push   0xc(%ebp)
+  8018da:	ff 75 08             	push   0x8(%ebp)
+  8018dd:	e8 41 02 00 00       	call   801b23 <nsipc_socket>
+  8018e2:	83 c4 10             	add    $0x10,%esp
+  8018e5:	85 c0                	test   %eax,%eax
+  8018e7:	78 05                	js     8018ee <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8018e9:	e8 ab fe ff ff       	call   801799 <alloc_sockfd>
+}
+  8018ee:	c9                   	leave
+  8018ef:	c3                   	ret
+
+008018f0 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8018f0:	55                   	push   %ebp
+  8018f1:	89 e5                	mov    %esp,%ebp
+  8018f3:	53                   	push   %ebx
+  8018f4:	83 ec 04             	sub    $0x4,%esp
+  8018f7:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  8018f9:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801900:	74 26                	je     801928 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801902:	6a 07                	push   $0x7
+  801904:	68 00 60 80 00       	push   $0x806000
+  801909:	53                   	push   %ebx
+  80190a:	ff 35 04 40 80 00    	push   0x804004
+  801910:	e8 6a 07 00 00       	call   80207f <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801915:	83 c4 0c             	add    $0xc,%esp
+  801918:	6a 00                	push   $0x0
+  80191a:	6a 00                	push   $0x0
+  80191c:	6a 00                	push   $0x0
+  80191e:	e8 e8 06 00 00       	call   80200b <ipc_recv>
+}
+  801923:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801926:	c9                   	leave
+  801927:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801928:	83 ec 0c             	sub    $0xc,%esp
+  80192b:	6a 02                	push   $0x2
+  80192d:	e8 a1 07 00 00       	call   8020d3 <ipc_find_env>
+  801932:	a3 04 40 80 00       	mov    %eax,0x804004
+  801937:	83 c4 10             	add    $0x10,%esp
+  80193a:	eb c6                	jmp    801902 <nsipc+0x12>
+
+0080193c <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  80193c:	55                   	push   %ebp
+  80193d:	89 e5                	mov    %esp,%ebp
+  80193f:	56                   	push   %esi
+  801940:	53                   	push   %ebx
+  801941:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801944:	8b 45 08             	mov    0x8(%ebp),%eax
+  801947:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  80194c:	8b 06                	mov    (%esi),%eax
+  80194e:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801953:	b8 01 00 00 00       	mov    $0x1,%eax
+  801958:	e8 93 ff ff ff       	call   8018f0 <nsipc>
+  80195d:	89 c3                	mov    %eax,%ebx
+  80195f:	85 c0                	test   %eax,%eax
+  801961:	79 09                	jns    80196c <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801963:	89 d8                	mov    %ebx,%eax
+  801965:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801968:	5b                   	pop    %ebx
+  801969:	5e                   	pop    %esi
+  80196a:	5d                   	pop    %ebp
+  80196b:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  80196c:	83 ec 04             	sub    $0x4,%esp
+  80196f:	ff 35 10 60 80 00    	push   0x806010
+  801975:	68 00 60 80 00       	push   $0x806000
+  80197a:	ff 75 0c             	push   0xc(%ebp)
+  80197d:	e8 b0 ef ff ff       	call   800932 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801982:	a1 10 60 80 00       	mov    0x806010,%eax
+  801987:	89 06                	mov    %eax,(%esi)
+  801989:	83 c4 10             	add    $0x10,%esp
+	return r;
+  80198c:	eb d5                	jmp    801963 <nsipc_accept+0x27>
+
+0080198e <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80198e:	55                   	push   %ebp
+  80198f:	89 e5                	mov    %esp,%ebp
+  801991:	53                   	push   %ebx
+  801992:	83 ec 08             	sub    $0x8,%esp
+  801995:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801998:	8b 45 08             	mov    0x8(%ebp),%eax
+  80199b:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8019a0:	53                   	push   %ebx
+  8019a1:	ff 75 0c             	push   0xc(%ebp)
+  8019a4:	68 04 60 80 00       	push   $0x806004
+  8019a9:	e8 84 ef ff ff       	call   800932 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8019ae:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  8019b4:	b8 02 00 00 00       	mov    $0x2,%eax
+  8019b9:	e8 32 ff ff ff       	call   8018f0 <nsipc>
+}
+  8019be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019c1:	c9                   	leave
+  8019c2:	c3                   	ret
+
+008019c3 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8019c3:	55                   	push   %ebp
+  8019c4:	89 e5                	mov    %esp,%ebp
+  8019c6:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8019c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019cc:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  8019d1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019d4:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  8019d9:	b8 03 00 00 00       	mov    $0x3,%eax
+  8019de:	e8 0d ff ff ff       	call   8018f0 <nsipc>
+}
+  8019e3:	c9                   	leave
+  8019e4:	c3                   	ret
+
+008019e5 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8019e5:	55                   	push   %ebp
+  8019e6:	89 e5                	mov    %esp,%ebp
+  8019e8:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8019eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019ee:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  8019f3:	b8 04 00 00 00       	mov    $0x4,%eax
+  8019f8:	e8 f3 fe ff ff       	call   8018f0 <nsipc>
+}
+  8019fd:	c9                   	leave
+  8019fe:	c3                   	ret
+
+008019ff <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8019ff:	55                   	push   %ebp
+  801a00:	89 e5                	mov    %esp,%ebp
+  801a02:	53                   	push   %ebx
+  801a03:	83 ec 08             	sub    $0x8,%esp
+  801a06:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801a09:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a0c:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801a11:	53                   	push   %ebx
+  801a12:	ff 75 0c             	push   0xc(%ebp)
+  801a15:	68 04 60 80 00       	push   $0x806004
+  801a1a:	e8 13 ef ff ff       	call   800932 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801a1f:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  801a25:	b8 05 00 00 00       	mov    $0x5,%eax
+  801a2a:	e8 c1 fe ff ff       	call   8018f0 <nsipc>
+}
+  801a2f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a32:	c9                   	leave
+  801a33:	c3                   	ret
+
+00801a34 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801a34:	55                   	push   %ebp
+  801a35:	89 e5                	mov    %esp,%ebp
+  801a37:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801a3a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a3d:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  801a42:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a45:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  801a4a:	b8 06 00 00 00       	mov    $0x6,%eax
+  801a4f:	e8 9c fe ff ff       	call   8018f0 <nsipc>
+}
+  801a54:	c9                   	leave
+  801a55:	c3                   	ret
+
+00801a56 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801a56:	55                   	push   %ebp
+  801a57:	89 e5                	mov    %esp,%ebp
+  801a59:	56                   	push   %esi
+  801a5a:	53                   	push   %ebx
+  801a5b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801a5e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a61:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  801a66:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  801a6c:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a6f:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801a74:	b8 07 00 00 00       	mov    $0x7,%eax
+  801a79:	e8 72 fe ff ff       	call   8018f0 <nsipc>
+  801a7e:	89 c3                	mov    %eax,%ebx
+  801a80:	85 c0                	test   %eax,%eax
+  801a82:	78 22                	js     801aa6 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801a84:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801a89:	39 c6                	cmp    %eax,%esi
+  801a8b:	0f 4e c6             	cmovle %esi,%eax
+  801a8e:	39 c3                	cmp    %eax,%ebx
+  801a90:	7f 1d                	jg     801aaf <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801a92:	83 ec 04             	sub    $0x4,%esp
+  801a95:	53                   	push   %ebx
+  801a96:	68 00 60 80 00       	push   $0x806000
+  801a9b:	ff 75 0c             	push   0xc(%ebp)
+  801a9e:	e8 8f ee ff ff       	call   800932 <memmove>
+  801aa3:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801aa6:	89 d8                	mov    %ebx,%eax
+  801aa8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801aab:	5b                   	pop    %ebx
+  801aac:	5e                   	pop    %esi
+  801aad:	5d                   	pop    %ebp
+  801aae:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801aaf:	68 1b 2b 80 00       	push   $0x802b1b
+  801ab4:	68 e3 2a 80 00       	push   $0x802ae3
+  801ab9:	6a 62                	push   $0x62
+  801abb:	68 30 2b 80 00       	push   $0x802b30
+  801ac0:	e8 53 e6 ff ff       	call   800118 <_panic>
+
+00801ac5 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801ac5:	55                   	push   %ebp
+  801ac6:	89 e5                	mov    %esp,%ebp
+  801ac8:	53                   	push   %ebx
+  801ac9:	83 ec 04             	sub    $0x4,%esp
+  801acc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801acf:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ad2:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  801ad7:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801add:	7f 2e                	jg     801b0d <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801adf:	83 ec 04             	sub    $0x4,%esp
+  801ae2:	53                   	push   %ebx
+  801ae3:	ff 75 0c             	push   0xc(%ebp)
+  801ae6:	68 0c 60 80 00       	push   $0x80600c
+  801aeb:	e8 42 ee ff ff       	call   800932 <memmove>
+	nsipcbuf.send.req_size = size;
+  801af0:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  801af6:	8b 45 14             	mov    0x14(%ebp),%eax
+  801af9:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  801afe:	b8 08 00 00 00       	mov    $0x8,%eax
+  801b03:	e8 e8 fd ff ff       	call   8018f0 <nsipc>
+}
+  801b08:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b0b:	c9                   	leave
+  801b0c:	c3                   	ret
+	assert(size < 1600);
+  801b0d:	68 3c 2b 80 00       	push   $0x802b3c
+  801b12:	68 e3 2a 80 00       	push   $0x802ae3
+  801b17:	6a 6d                	push   $0x6d
+  801b19:	68 30 2b 80 00       	push   $0x802b30
+  801b1e:	e8 f5 e5 ff ff       	call   800118 <_panic>
+
+00801b23 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801b23:	55                   	push   %ebp
+  801b24:	89 e5                	mov    %esp,%ebp
+  801b26:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801b29:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b2c:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  801b31:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b34:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  801b39:	8b 45 10             	mov    0x10(%ebp),%eax
+  801b3c:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  801b41:	b8 09 00 00 00       	mov    $0x9,%eax
+  801b46:	e8 a5 fd ff ff       	call   8018f0 <nsipc>
+}
+  801b4b:	c9                   	leave
+  801b4c:	c3                   	ret
+
+00801b4d <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801b4d:	55                   	push   %ebp
+  801b4e:	89 e5                	mov    %esp,%ebp
+  801b50:	56                   	push   %esi
+  801b51:	53                   	push   %ebx
+  801b52:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801b55:	83 ec 0c             	sub    $0xc,%esp
+  801b58:	ff 75 08             	push   0x8(%ebp)
+  801b5b:	e8 aa f3 ff ff       	call   800f0a <fd2data>
+  801b60:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801b62:	83 c4 08             	add    $0x8,%esp
+  801b65:	68 48 2b 80 00       	push   $0x802b48
+  801b6a:	53                   	push   %ebx
+  801b6b:	e8 3c ec ff ff       	call   8007ac <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801b70:	8b 46 04             	mov    0x4(%esi),%eax
+  801b73:	2b 06                	sub    (%esi),%eax
+  801b75:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  801b7b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801b82:	00 00 00 
+	stat->st_dev = &devpipe;
+  801b85:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  801b8c:	30 80 00 
+	return 0;
+}
+  801b8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b94:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b97:	5b                   	pop    %ebx
+  801b98:	5e                   	pop    %esi
+  801b99:	5d                   	pop    %ebp
+  801b9a:	c3                   	ret
+
+00801b9b <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801b9b:	55                   	push   %ebp
+  801b9c:	89 e5                	mov    %esp,%ebp
+  801b9e:	53                   	push   %ebx
+  801b9f:	83 ec 0c             	sub    $0xc,%esp
+  801ba2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801ba5:	53                   	push   %ebx
+  801ba6:	6a 00                	push   $0x0
+  801ba8:	e8 70 f0 ff ff       	call   800c1d <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801bad:	89 1c 24             	mov    %ebx,(%esp)
+  801bb0:	e8 55 f3 ff ff       	call   800f0a <fd2data>
+  801bb5:	83 c4 08             	add    $0x8,%esp
+  801bb8:	50                   	push   %eax
+  801bb9:	6a 00                	push   $0x0
+  801bbb:	e8 5d f0 ff ff       	call   800c1d <sys_page_unmap>
+}
+  801bc0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bc3:	c9                   	leave
+  801bc4:	c3                   	ret
+
+00801bc5 <_pipeisclosed>:
+{
+  801bc5:	55                   	push   %ebp
+  801bc6:	89 e5                	mov    %esp,%ebp
+  801bc8:	57                   	push   %edi
+  801bc9:	56                   	push   %esi
+  801bca:	53                   	push   %ebx
+  801bcb:	83 ec 1c             	sub    $0x1c,%esp
+  801bce:	89 c7                	mov    %eax,%edi
+  801bd0:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801bd2:	a1 08 40 80 00       	mov    0x804008,%eax
+  801bd7:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801bda:	83 ec 0c             	sub    $0xc,%esp
+  801bdd:	57                   	push   %edi
+  801bde:	e8 2f 05 00 00       	call   802112 <pageref>
+  801be3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801be6:	89 34 24             	mov    %esi,(%esp)
+  801be9:	e8 24 05 00 00       	call   802112 <pageref>
+		nn = thisenv->env_runs;
+  801bee:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801bf4:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801bf7:	83 c4 10             	add    $0x10,%esp
+  801bfa:	39 cb                	cmp    %ecx,%ebx
+  801bfc:	74 1b                	je     801c19 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801bfe:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801c01:	75 cf                	jne    801bd2 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801c03:	8b 42 58             	mov    0x58(%edx),%eax
+  801c06:	6a 01                	push   $0x1
+  801c08:	50                   	push   %eax
+  801c09:	53                   	push   %ebx
+  801c0a:	68 4f 2b 80 00       	push   $0x802b4f
+  801c0f:	e8 df e5 ff ff       	call   8001f3 <cprintf>
+  801c14:	83 c4 10             	add    $0x10,%esp
+  801c17:	eb b9                	jmp    801bd2 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801c19:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801c1c:	0f 94 c0             	sete   %al
+  801c1f:	0f b6 c0             	movzbl %al,%eax
+}
+  801c22:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c25:	5b                   	pop    %ebx
+  801c26:	5e                   	pop    %esi
+  801c27:	5f                   	pop    %edi
+  801c28:	5d                   	pop    %ebp
+  801c29:	c3                   	ret
+
+00801c2a <devpipe_write>:
+{
+  801c2a:	55                   	push   %ebp
+  801c2b:	89 e5                	mov    %esp,%ebp
+  801c2d:	57                   	push   %edi
+  801c2e:	56                   	push   %esi
+  801c2f:	53                   	push   %ebx
+  801c30:	83 ec 28             	sub    $0x28,%esp
+  801c33:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801c36:	56                   	push   %esi
+  801c37:	e8 ce f2 ff ff       	call   800f0a <fd2data>
+  801c3c:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801c3e:	83 c4 10             	add    $0x10,%esp
+  801c41:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c46:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801c49:	75 09                	jne    801c54 <devpipe_write+0x2a>
+	return i;
+  801c4b:	89 f8                	mov    %edi,%eax
+  801c4d:	eb 23                	jmp    801c72 <devpipe_write+0x48>
+			sys_yield();
+  801c4f:	e8 25 ef ff ff       	call   800b79 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801c54:	8b 43 04             	mov    0x4(%ebx),%eax
+  801c57:	8b 0b                	mov    (%ebx),%ecx
+  801c59:	8d 51 20             	lea    0x20(%ecx),%edx
+  801c5c:	39 d0                	cmp    %edx,%eax
+  801c5e:	72 1a                	jb     801c7a <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  801c60:	89 da                	mov    %ebx,%edx
+  801c62:	89 f0                	mov    %esi,%eax
+  801c64:	e8 5c ff ff ff       	call   801bc5 <_pipeisclosed>
+  801c69:	85 c0                	test   %eax,%eax
+  801c6b:	74 e2                	je     801c4f <devpipe_write+0x25>
+				return 0;
+  801c6d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c72:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c75:	5b                   	pop    %ebx
+  801c76:	5e                   	pop    %esi
+  801c77:	5f                   	pop    %edi
+  801c78:	5d                   	pop    %ebp
+  801c79:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801c7a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c7d:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801c81:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801c84:	89 c2                	mov    %eax,%edx
+  801c86:	c1 fa 1f             	sar    $0x1f,%edx
+  801c89:	89 d1                	mov    %edx,%ecx
+  801c8b:	c1 e9 1b             	shr    $0x1b,%ecx
+  801c8e:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801c91:	83 e2 1f             	and    $0x1f,%edx
+  801c94:	29 ca                	sub    %ecx,%edx
+  801c96:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801c9a:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  801c9e:	83 c0 01             	add    $0x1,%eax
+  801ca1:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  801ca4:	83 c7 01             	add    $0x1,%edi
+  801ca7:	eb 9d                	jmp    801c46 <devpipe_write+0x1c>
+
+00801ca9 <devpipe_read>:
+{
+  801ca9:	55                   	push   %ebp
+  801caa:	89 e5                	mov    %esp,%ebp
+  801cac:	57                   	push   %edi
+  801cad:	56                   	push   %esi
+  801cae:	53                   	push   %ebx
+  801caf:	83 ec 18             	sub    $0x18,%esp
+  801cb2:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  801cb5:	57                   	push   %edi
+  801cb6:	e8 4f f2 ff ff       	call   800f0a <fd2data>
+  801cbb:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801cbd:	83 c4 10             	add    $0x10,%esp
+  801cc0:	be 00 00 00 00       	mov    $0x0,%esi
+  801cc5:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801cc8:	75 13                	jne    801cdd <devpipe_read+0x34>
+	return i;
+  801cca:	89 f0                	mov    %esi,%eax
+  801ccc:	eb 02                	jmp    801cd0 <devpipe_read+0x27>
+				return i;
+  801cce:	89 f0                	mov    %esi,%eax
+}
+  801cd0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cd3:	5b                   	pop    %ebx
+  801cd4:	5e                   	pop    %esi
+  801cd5:	5f                   	pop    %edi
+  801cd6:	5d                   	pop    %ebp
+  801cd7:	c3                   	ret
+			sys_yield();
+  801cd8:	e8 9c ee ff ff       	call   800b79 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  801cdd:	8b 03                	mov    (%ebx),%eax
+  801cdf:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801ce2:	75 18                	jne    801cfc <devpipe_read+0x53>
+			if (i > 0)
+  801ce4:	85 f6                	test   %esi,%esi
+  801ce6:	75 e6                	jne    801cce <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  801ce8:	89 da                	mov    %ebx,%edx
+  801cea:	89 f8                	mov    %edi,%eax
+  801cec:	e8 d4 fe ff ff       	call   801bc5 <_pipeisclosed>
+  801cf1:	85 c0                	test   %eax,%eax
+  801cf3:	74 e3                	je     801cd8 <devpipe_read+0x2f>
+				return 0;
+  801cf5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cfa:	eb d4                	jmp    801cd0 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801cfc:	99                   	cltd
+  801cfd:	c1 ea 1b             	shr    $0x1b,%edx
+  801d00:	01 d0                	add    %edx,%eax
+  801d02:	83 e0 1f             	and    $0x1f,%eax
+  801d05:	29 d0                	sub    %edx,%eax
+  801d07:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801d0c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d0f:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  801d12:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  801d15:	83 c6 01             	add    $0x1,%esi
+  801d18:	eb ab                	jmp    801cc5 <devpipe_read+0x1c>
+
+00801d1a <pipe>:
+{
+  801d1a:	55                   	push   %ebp
+  801d1b:	89 e5                	mov    %esp,%ebp
+  801d1d:	56                   	push   %esi
+  801d1e:	53                   	push   %ebx
+  801d1f:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801d22:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d25:	50                   	push   %eax
+  801d26:	e8 f6 f1 ff ff       	call   800f21 <fd_alloc>
+  801d2b:	89 c3                	mov    %eax,%ebx
+  801d2d:	83 c4 10             	add    $0x10,%esp
+  801d30:	85 c0                	test   %eax,%eax
+  801d32:	0f 88 23 01 00 00    	js     801e5b <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801d38:	83 ec 04             	sub    $0x4,%esp
+  801d3b:	68 07 04 00 00       	push   $0x407
+  801d40:	ff 75 f4             	push   -0xc(%ebp)
+  801d43:	6a 00                	push   $0x0
+  801d45:	e8 4e ee ff ff       	call   800b98 <sys_page_alloc>
+  801d4a:	89 c3                	mov    %eax,%ebx
+  801d4c:	83 c4 10             	add    $0x10,%esp
+  801d4f:	85 c0                	test   %eax,%eax
+  801d51:	0f 88 04 01 00 00    	js     801e5b <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801d57:	83 ec 0c             	sub    $0xc,%esp
+  801d5a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d5d:	50                   	push   %eax
+  801d5e:	e8 be f1 ff ff       	call   800f21 <fd_alloc>
+  801d63:	89 c3                	mov    %eax,%ebx
+  801d65:	83 c4 10             	add    $0x10,%esp
+  801d68:	85 c0                	test   %eax,%eax
+  801d6a:	0f 88 db 00 00 00    	js     801e4b <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801d70:	83 ec 04             	sub    $0x4,%esp
+  801d73:	68 07 04 00 00       	push   $0x407
+  801d78:	ff 75 f0             	push   -0x10(%ebp)
+  801d7b:	6a 00                	push   $0x0
+  801d7d:	e8 16 ee ff ff       	call   800b98 <sys_page_alloc>
+  801d82:	89 c3                	mov    %eax,%ebx
+  801d84:	83 c4 10             	add    $0x10,%esp
+  801d87:	85 c0                	test   %eax,%eax
+  801d89:	0f 88 bc 00 00 00    	js     801e4b <pipe+0x131>
+	va = fd2data(fd0);
+  801d8f:	83 ec 0c             	sub    $0xc,%esp
+  801d92:	ff 75 f4             	push   -0xc(%ebp)
+  801d95:	e8 70 f1 ff ff       	call   800f0a <fd2data>
+  801d9a:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801d9c:	83 c4 0c             	add    $0xc,%esp
+  801d9f:	68 07 04 00 00       	push   $0x407
+  801da4:	50                   	push   %eax
+  801da5:	6a 00                	push   $0x0
+  801da7:	e8 ec ed ff ff       	call   800b98 <sys_page_alloc>
+  801dac:	89 c3                	mov    %eax,%ebx
+  801dae:	83 c4 10             	add    $0x10,%esp
+  801db1:	85 c0                	test   %eax,%eax
+  801db3:	0f 88 82 00 00 00    	js     801e3b <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801db9:	83 ec 0c             	sub    $0xc,%esp
+  801dbc:	ff 75 f0             	push   -0x10(%ebp)
+  801dbf:	e8 46 f1 ff ff       	call   800f0a <fd2data>
+  801dc4:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801dcb:	50                   	push   %eax
+  801dcc:	6a 00                	push   $0x0
+  801dce:	56                   	push   %esi
+  801dcf:	6a 00                	push   $0x0
+  801dd1:	e8 05 ee ff ff       	call   800bdb <sys_page_map>
+  801dd6:	89 c3                	mov    %eax,%ebx
+  801dd8:	83 c4 20             	add    $0x20,%esp
+  801ddb:	85 c0                	test   %eax,%eax
+  801ddd:	78 4e                	js     801e2d <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  801ddf:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  801de4:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801de7:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  801de9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801dec:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  801df3:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801df6:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  801df8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801dfb:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  801e02:	83 ec 0c             	sub    $0xc,%esp
+  801e05:	ff 75 f4             	push   -0xc(%ebp)
+  801e08:	e8 ed f0 ff ff       	call   800efa <fd2num>
+  801e0d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801e10:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  801e12:	83 c4 04             	add    $0x4,%esp
+  801e15:	ff 75 f0             	push   -0x10(%ebp)
+  801e18:	e8 dd f0 ff ff       	call   800efa <fd2num>
+  801e1d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801e20:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  801e23:	83 c4 10             	add    $0x10,%esp
+  801e26:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e2b:	eb 2e                	jmp    801e5b <pipe+0x141>
+	sys_page_unmap(0, va);
+  801e2d:	83 ec 08             	sub    $0x8,%esp
+  801e30:	56                   	push   %esi
+  801e31:	6a 00                	push   $0x0
+  801e33:	e8 e5 ed ff ff       	call   800c1d <sys_page_unmap>
+  801e38:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  801e3b:	83 ec 08             	sub    $0x8,%esp
+  801e3e:	ff 75 f0             	push   -0x10(%ebp)
+  801e41:	6a 00                	push   $0x0
+  801e43:	e8 d5 ed ff ff       	call   800c1d <sys_page_unmap>
+  801e48:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  801e4b:	83 ec 08             	sub    $0x8,%esp
+  801e4e:	ff 75 f4             	push   -0xc(%ebp)
+  801e51:	6a 00                	push   $0x0
+  801e53:	e8 c5 ed ff ff       	call   800c1d <sys_page_unmap>
+  801e58:	83 c4 10             	add    $0x10,%esp
+}
+  801e5b:	89 d8                	mov    %ebx,%eax
+  801e5d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e60:	5b                   	pop    %ebx
+  801e61:	5e                   	pop    %esi
+  801e62:	5d                   	pop    %ebp
+  801e63:	c3                   	ret
+
+00801e64 <pipeisclosed>:
+{
+  801e64:	55                   	push   %ebp
+  801e65:	89 e5                	mov    %esp,%ebp
+  801e67:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801e6a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e6d:	50                   	push   %eax
+  801e6e:	ff 75 08             	push   0x8(%ebp)
+  801e71:	e8 01 f1 ff ff       	call   800f77 <fd_lookup>
+  801e76:	83 c4 10             	add    $0x10,%esp
+  801e79:	85 c0                	test   %eax,%eax
+  801e7b:	78 18                	js     801e95 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  801e7d:	83 ec 0c             	sub    $0xc,%esp
+  801e80:	ff 75 f4             	push   -0xc(%ebp)
+  801e83:	e8 82 f0 ff ff       	call   800f0a <fd2data>
+  801e88:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  801e8a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e8d:	e8 33 fd ff ff       	call   801bc5 <_pipeisclosed>
+  801e92:	83 c4 10             	add    $0x10,%esp
+}
+  801e95:	c9                   	leave
+  801e96:	c3                   	ret
+
+00801e97 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  801e97:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e9c:	c3                   	ret
+
+00801e9d <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  801e9d:	55                   	push   %ebp
+  801e9e:	89 e5                	mov    %esp,%ebp
+  801ea0:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  801ea3:	68 67 2b 80 00       	push   $0x802b67
+  801ea8:	ff 75 0c             	push   0xc(%ebp)
+  801eab:	e8 fc e8 ff ff       	call   8007ac <strcpy>
+	return 0;
+}
+  801eb0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eb5:	c9                   	leave
+  801eb6:	c3                   	ret
+
+00801eb7 <devcons_write>:
+{
+  801eb7:	55                   	push   %ebp
+  801eb8:	89 e5                	mov    %esp,%ebp
+  801eba:	57                   	push   %edi
+  801ebb:	56                   	push   %esi
+  801ebc:	53                   	push   %ebx
+  801ebd:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  801ec3:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  801ec8:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  801ece:	eb 2e                	jmp    801efe <devcons_write+0x47>
+		m = n - tot;
+  801ed0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801ed3:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  801ed5:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801eda:	39 c3                	cmp    %eax,%ebx
+  801edc:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  801edf:	83 ec 04             	sub    $0x4,%esp
+  801ee2:	53                   	push   %ebx
+  801ee3:	89 f0                	mov    %esi,%eax
+  801ee5:	03 45 0c             	add    0xc(%ebp),%eax
+  801ee8:	50                   	push   %eax
+  801ee9:	57                   	push   %edi
+  801eea:	e8 43 ea ff ff       	call   800932 <memmove>
+		sys_cputs(buf, m);
+  801eef:	83 c4 08             	add    $0x8,%esp
+  801ef2:	53                   	push   %ebx
+  801ef3:	57                   	push   %edi
+  801ef4:	e8 e3 eb ff ff       	call   800adc <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  801ef9:	01 de                	add    %ebx,%esi
+  801efb:	83 c4 10             	add    $0x10,%esp
+  801efe:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801f01:	72 cd                	jb     801ed0 <devcons_write+0x19>
+}
+  801f03:	89 f0                	mov    %esi,%eax
+  801f05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f08:	5b                   	pop    %ebx
+  801f09:	5e                   	pop    %esi
+  801f0a:	5f                   	pop    %edi
+  801f0b:	5d                   	pop    %ebp
+  801f0c:	c3                   	ret
+
+00801f0d <devcons_read>:
+{
+  801f0d:	55                   	push   %ebp
+  801f0e:	89 e5                	mov    %esp,%ebp
+  801f10:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  801f13:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f18:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801f1c:	75 07                	jne    801f25 <devcons_read+0x18>
+  801f1e:	eb 1f                	jmp    801f3f <devcons_read+0x32>
+		sys_yield();
+  801f20:	e8 54 ec ff ff       	call   800b79 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  801f25:	e8 d0 eb ff ff       	call   800afa <sys_cgetc>
+  801f2a:	85 c0                	test   %eax,%eax
+  801f2c:	74 f2                	je     801f20 <devcons_read+0x13>
+	if (c < 0)
+  801f2e:	78 0f                	js     801f3f <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  801f30:	83 f8 04             	cmp    $0x4,%eax
+  801f33:	74 0c                	je     801f41 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  801f35:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801f38:	88 02                	mov    %al,(%edx)
+	return 1;
+  801f3a:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  801f3f:	c9                   	leave
+  801f40:	c3                   	ret
+		return 0;
+  801f41:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f46:	eb f7                	jmp    801f3f <devcons_read+0x32>
+
+00801f48 <cputchar>:
+{
+  801f48:	55                   	push   %ebp
+  801f49:	89 e5                	mov    %esp,%ebp
+  801f4b:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  801f4e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f51:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  801f54:	6a 01                	push   $0x1
+  801f56:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801f59:	50                   	push   %eax
+  801f5a:	e8 7d eb ff ff       	call   800adc <sys_cputs>
+}
+  801f5f:	83 c4 10             	add    $0x10,%esp
+  801f62:	c9                   	leave
+  801f63:	c3                   	ret
+
+00801f64 <getchar>:
+{
+  801f64:	55                   	push   %ebp
+  801f65:	89 e5                	mov    %esp,%ebp
+  801f67:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  801f6a:	6a 01                	push   $0x1
+  801f6c:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801f6f:	50                   	push   %eax
+  801f70:	6a 00                	push   $0x0
+  801f72:	e8 66 f2 ff ff       	call   8011dd <read>
+	if (r < 0)
+  801f77:	83 c4 10             	add    $0x10,%esp
+  801f7a:	85 c0                	test   %eax,%eax
+  801f7c:	78 06                	js     801f84 <getchar+0x20>
+	if (r < 1)
+  801f7e:	74 06                	je     801f86 <getchar+0x22>
+	return c;
+  801f80:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  801f84:	c9                   	leave
+  801f85:	c3                   	ret
+		return -E_EOF;
+  801f86:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  801f8b:	eb f7                	jmp    801f84 <getchar+0x20>
+
+00801f8d <iscons>:
+{
+  801f8d:	55                   	push   %ebp
+  801f8e:	89 e5                	mov    %esp,%ebp
+  801f90:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801f93:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f96:	50                   	push   %eax
+  801f97:	ff 75 08             	push   0x8(%ebp)
+  801f9a:	e8 d8 ef ff ff       	call   800f77 <fd_lookup>
+  801f9f:	83 c4 10             	add    $0x10,%esp
+  801fa2:	85 c0                	test   %eax,%eax
+  801fa4:	78 11                	js     801fb7 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  801fa6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801fa9:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  801faf:	39 10                	cmp    %edx,(%eax)
+  801fb1:	0f 94 c0             	sete   %al
+  801fb4:	0f b6 c0             	movzbl %al,%eax
+}
+  801fb7:	c9                   	leave
+  801fb8:	c3                   	ret
+
+00801fb9 <opencons>:
+{
+  801fb9:	55                   	push   %ebp
+  801fba:	89 e5                	mov    %esp,%ebp
+  801fbc:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  801fbf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fc2:	50                   	push   %eax
+  801fc3:	e8 59 ef ff ff       	call   800f21 <fd_alloc>
+  801fc8:	83 c4 10             	add    $0x10,%esp
+  801fcb:	85 c0                	test   %eax,%eax
+  801fcd:	78 3a                	js     802009 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  801fcf:	83 ec 04             	sub    $0x4,%esp
+  801fd2:	68 07 04 00 00       	push   $0x407
+  801fd7:	ff 75 f4             	push   -0xc(%ebp)
+  801fda:	6a 00                	push   $0x0
+  801fdc:	e8 b7 eb ff ff       	call   800b98 <sys_page_alloc>
+  801fe1:	83 c4 10             	add    $0x10,%esp
+  801fe4:	85 c0                	test   %eax,%eax
+  801fe6:	78 21                	js     802009 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  801fe8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801feb:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  801ff1:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  801ff3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ff6:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  801ffd:	83 ec 0c             	sub    $0xc,%esp
+  802000:	50                   	push   %eax
+  802001:	e8 f4 ee ff ff       	call   800efa <fd2num>
+  802006:	83 c4 10             	add    $0x10,%esp
+}
+  802009:	c9                   	leave
+  80200a:	c3                   	ret
+
+0080200b <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  80200b:	55                   	push   %ebp
+  80200c:	89 e5                	mov    %esp,%ebp
+  80200e:	56                   	push   %esi
+  80200f:	53                   	push   %ebx
+  802010:	8b 75 08             	mov    0x8(%ebp),%esi
+  802013:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802016:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  802019:	85 c0                	test   %eax,%eax
+  80201b:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802020:	0f 44 c2             	cmove  %edx,%eax
+  802023:	83 ec 0c             	sub    $0xc,%esp
+  802026:	50                   	push   %eax
+  802027:	e8 1c ed ff ff       	call   800d48 <sys_ipc_recv>
+
+  if (from_env_store)
+  80202c:	83 c4 10             	add    $0x10,%esp
+  80202f:	85 f6                	test   %esi,%esi
+  802031:	74 17                	je     80204a <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  802033:	ba 00 00 00 00       	mov    $0x0,%edx
+  802038:	85 c0                	test   %eax,%eax
+  80203a:	75 0c                	jne    802048 <ipc_recv+0x3d>
+  80203c:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  802042:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  802048:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  80204a:	85 db                	test   %ebx,%ebx
+  80204c:	74 2b                	je     802079 <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  80204e:	85 c0                	test   %eax,%eax
+  802050:	74 0d                	je     80205f <ipc_recv+0x54>
+  802052:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  802058:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80205b:	5b                   	pop    %ebx
+  80205c:	5e                   	pop    %esi
+  80205d:	5d                   	pop    %ebp
+  80205e:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  80205f:	a1 08 40 80 00       	mov    0x804008,%eax
+  802064:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80206a:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  80206c:	a1 08 40 80 00       	mov    0x804008,%eax
+  802071:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  802077:	eb df                	jmp    802058 <ipc_recv+0x4d>
+  802079:	85 c0                	test   %eax,%eax
+  80207b:	75 db                	jne    802058 <ipc_recv+0x4d>
+  80207d:	eb ed                	jmp    80206c <ipc_recv+0x61>
+
+0080207f <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  80207f:	55                   	push   %ebp
+  802080:	89 e5                	mov    %esp,%ebp
+  802082:	57                   	push   %edi
+  802083:	56                   	push   %esi
+  802084:	53                   	push   %ebx
+  802085:	83 ec 0c             	sub    $0xc,%esp
+  802088:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80208b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80208e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  802091:	85 db                	test   %ebx,%ebx
+  802093:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802098:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  80209b:	ff 75 14             	push   0x14(%ebp)
+  80209e:	53                   	push   %ebx
+  80209f:	56                   	push   %esi
+  8020a0:	57                   	push   %edi
+  8020a1:	e8 7f ec ff ff       	call   800d25 <sys_ipc_try_send>
+  8020a6:	83 c4 10             	add    $0x10,%esp
+  8020a9:	85 c0                	test   %eax,%eax
+  8020ab:	74 1e                	je     8020cb <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  8020ad:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8020b0:	75 07                	jne    8020b9 <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  8020b2:	e8 c2 ea ff ff       	call   800b79 <sys_yield>
+  8020b7:	eb e2                	jmp    80209b <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  8020b9:	50                   	push   %eax
+  8020ba:	68 73 2b 80 00       	push   $0x802b73
+  8020bf:	6a 3c                	push   $0x3c
+  8020c1:	68 80 2b 80 00       	push   $0x802b80
+  8020c6:	e8 4d e0 ff ff       	call   800118 <_panic>
+  }
+
+#endif
+}
+  8020cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020ce:	5b                   	pop    %ebx
+  8020cf:	5e                   	pop    %esi
+  8020d0:	5f                   	pop    %edi
+  8020d1:	5d                   	pop    %ebp
+  8020d2:	c3                   	ret
+
+008020d3 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  8020d3:	55                   	push   %ebp
+  8020d4:	89 e5                	mov    %esp,%ebp
+  8020d6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  8020d9:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  8020de:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8020e1:	c1 e0 04             	shl    $0x4,%eax
+  8020e4:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8020e9:	8b 40 50             	mov    0x50(%eax),%eax
+  8020ec:	39 c8                	cmp    %ecx,%eax
+  8020ee:	74 12                	je     802102 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  8020f0:	83 c2 01             	add    $0x1,%edx
+  8020f3:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8020f9:	75 e3                	jne    8020de <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  8020fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802100:	eb 0e                	jmp    802110 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  802102:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802105:	c1 e0 04             	shl    $0x4,%eax
+  802108:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80210d:	8b 40 48             	mov    0x48(%eax),%eax
+  802110:	5d                   	pop    %ebp
+  802111:	c3                   	ret
+
+00802112 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802112:	55                   	push   %ebp
+  802113:	89 e5                	mov    %esp,%ebp
+  802115:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802118:	89 c2                	mov    %eax,%edx
+  80211a:	c1 ea 16             	shr    $0x16,%edx
+  80211d:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802124:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802129:	f6 c1 01             	test   $0x1,%cl
+  80212c:	74 1c                	je     80214a <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  80212e:	c1 e8 0c             	shr    $0xc,%eax
+  802131:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802138:	a8 01                	test   $0x1,%al
+  80213a:	74 0e                	je     80214a <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80213c:	c1 e8 0c             	shr    $0xc,%eax
+  80213f:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802146:	ef 
+  802147:	0f b7 d2             	movzwl %dx,%edx
+}
+  80214a:	89 d0                	mov    %edx,%eax
+  80214c:	5d                   	pop    %ebp
+  80214d:	c3                   	ret
+  80214e:	66 90                	xchg   %ax,%ax
+
+00802150 <__udivmoddi4>:
+  802150:	55                   	push   %ebp
+  802151:	57                   	push   %edi
+  802152:	56                   	push   %esi
+  802153:	53                   	push   %ebx
+  802154:	83 ec 24             	sub    $0x24,%esp
+  802157:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80215b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80215f:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  802163:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802167:	8b 54 24 44          	mov    0x44(%esp),%edx
+  80216b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80216f:	8b 44 24 40          	mov    0x40(%esp),%eax
+  802173:	89 d3                	mov    %edx,%ebx
+  802175:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802179:	09 c3                	or     %eax,%ebx
+  80217b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80217f:	0f 84 9c 00 00 00    	je     802221 <__udivmoddi4+0xd1>
+  802185:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80218c:	00 
+  80218d:	31 c0                	xor    %eax,%eax
+  80218f:	31 d2                	xor    %edx,%edx
+  802191:	89 fb                	mov    %edi,%ebx
+  802193:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80219a:	00 
+  80219b:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8021a0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8021a4:	01 c0                	add    %eax,%eax
+  8021a6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8021ad:	00 
+  8021ae:	89 c6                	mov    %eax,%esi
+  8021b0:	89 d7                	mov    %edx,%edi
+  8021b2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8021b6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8021ba:	0f ad d0             	shrd   %cl,%edx,%eax
+  8021bd:	d3 ea                	shr    %cl,%edx
+  8021bf:	f6 c1 20             	test   $0x20,%cl
+  8021c2:	0f 45 c2             	cmovne %edx,%eax
+  8021c5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8021c9:	83 e0 01             	and    $0x1,%eax
+  8021cc:	09 fa                	or     %edi,%edx
+  8021ce:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8021d2:	89 04 24             	mov    %eax,(%esp)
+  8021d5:	8b 04 24             	mov    (%esp),%eax
+  8021d8:	89 d5                	mov    %edx,%ebp
+  8021da:	09 f0                	or     %esi,%eax
+  8021dc:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8021e0:	39 f0                	cmp    %esi,%eax
+  8021e2:	19 fd                	sbb    %edi,%ebp
+  8021e4:	72 1d                	jb     802203 <__udivmoddi4+0xb3>
+  8021e6:	29 f0                	sub    %esi,%eax
+  8021e8:	19 fa                	sbb    %edi,%edx
+  8021ea:	89 cf                	mov    %ecx,%edi
+  8021ec:	c1 ef 05             	shr    $0x5,%edi
+  8021ef:	83 e7 01             	and    $0x1,%edi
+  8021f2:	89 fe                	mov    %edi,%esi
+  8021f4:	d3 e7                	shl    %cl,%edi
+  8021f6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8021fa:	83 f6 01             	xor    $0x1,%esi
+  8021fd:	d3 e6                	shl    %cl,%esi
+  8021ff:	09 74 24 18          	or     %esi,0x18(%esp)
+  802203:	83 e9 01             	sub    $0x1,%ecx
+  802206:	73 98                	jae    8021a0 <__udivmoddi4+0x50>
+  802208:	85 db                	test   %ebx,%ebx
+  80220a:	74 05                	je     802211 <__udivmoddi4+0xc1>
+  80220c:	89 03                	mov    %eax,(%ebx)
+  80220e:	89 53 04             	mov    %edx,0x4(%ebx)
+  802211:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802215:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802219:	83 c4 24             	add    $0x24,%esp
+  80221c:	5b                   	pop    %ebx
+  80221d:	5e                   	pop    %esi
+  80221e:	5f                   	pop    %edi
+  80221f:	5d                   	pop    %ebp
+  802220:	c3                   	ret
+  802221:	85 ff                	test   %edi,%edi
+  802223:	74 0d                	je     802232 <__udivmoddi4+0xe2>
+  802225:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  80222b:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  802232:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802236:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80223a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80223e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802242:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802246:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80224a:	83 c4 24             	add    $0x24,%esp
+  80224d:	5b                   	pop    %ebx
+  80224e:	5e                   	pop    %esi
+  80224f:	5f                   	pop    %edi
+  802250:	5d                   	pop    %ebp
+  802251:	c3                   	ret
+  802252:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802259:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00802260 <__udivdi3>:
+  802260:	57                   	push   %edi
+  802261:	56                   	push   %esi
+  802262:	53                   	push   %ebx
+  802263:	83 ec 20             	sub    $0x20,%esp
+  802266:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80226a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80226e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802272:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802276:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80227a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80227e:	89 d1                	mov    %edx,%ecx
+  802280:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802284:	09 c1                	or     %eax,%ecx
+  802286:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80228a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80228e:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802292:	0f 84 88 00 00 00    	je     802320 <__udivdi3+0xc0>
+  802298:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80229f:	00 
+  8022a0:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8022a5:	31 c0                	xor    %eax,%eax
+  8022a7:	31 d2                	xor    %edx,%edx
+  8022a9:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8022b0:	00 
+  8022b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8022b8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8022bc:	01 c0                	add    %eax,%eax
+  8022be:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8022c5:	00 
+  8022c6:	89 c6                	mov    %eax,%esi
+  8022c8:	89 d7                	mov    %edx,%edi
+  8022ca:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8022ce:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8022d2:	0f ad d0             	shrd   %cl,%edx,%eax
+  8022d5:	d3 ea                	shr    %cl,%edx
+  8022d7:	f6 c1 20             	test   $0x20,%cl
+  8022da:	0f 45 c2             	cmovne %edx,%eax
+  8022dd:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8022e1:	83 e0 01             	and    $0x1,%eax
+  8022e4:	09 fa                	or     %edi,%edx
+  8022e6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8022ea:	89 04 24             	mov    %eax,(%esp)
+  8022ed:	8b 04 24             	mov    (%esp),%eax
+  8022f0:	89 d3                	mov    %edx,%ebx
+  8022f2:	09 f0                	or     %esi,%eax
+  8022f4:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8022f8:	39 f0                	cmp    %esi,%eax
+  8022fa:	19 fb                	sbb    %edi,%ebx
+  8022fc:	72 1d                	jb     80231b <__udivdi3+0xbb>
+  8022fe:	29 f0                	sub    %esi,%eax
+  802300:	19 fa                	sbb    %edi,%edx
+  802302:	89 cf                	mov    %ecx,%edi
+  802304:	c1 ef 05             	shr    $0x5,%edi
+  802307:	83 e7 01             	and    $0x1,%edi
+  80230a:	89 fe                	mov    %edi,%esi
+  80230c:	d3 e7                	shl    %cl,%edi
+  80230e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802312:	83 f6 01             	xor    $0x1,%esi
+  802315:	d3 e6                	shl    %cl,%esi
+  802317:	09 74 24 18          	or     %esi,0x18(%esp)
+  80231b:	83 e9 01             	sub    $0x1,%ecx
+  80231e:	73 98                	jae    8022b8 <__udivdi3+0x58>
+  802320:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802324:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802328:	83 c4 20             	add    $0x20,%esp
+  80232b:	5b                   	pop    %ebx
+  80232c:	5e                   	pop    %esi
+  80232d:	5f                   	pop    %edi
+  80232e:	c3                   	ret
+  80232f:	90                   	nop
+
+00802330 <__umoddi3>:
+  802330:	57                   	push   %edi
+  802331:	56                   	push   %esi
+  802332:	53                   	push   %ebx
+  802333:	83 ec 18             	sub    $0x18,%esp
+  802336:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80233a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80233e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802342:	8b 54 24 34          	mov    0x34(%esp),%edx
+  802346:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80234a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80234e:	89 d1                	mov    %edx,%ecx
+  802350:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802354:	09 c1                	or     %eax,%ecx
+  802356:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80235a:	74 5b                	je     8023b7 <__umoddi3+0x87>
+  80235c:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802361:	31 c0                	xor    %eax,%eax
+  802363:	31 d2                	xor    %edx,%edx
+  802365:	8d 76 00             	lea    0x0(%esi),%esi
+  802368:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80236c:	01 c0                	add    %eax,%eax
+  80236e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802375:	00 
+  802376:	89 c6                	mov    %eax,%esi
+  802378:	89 d7                	mov    %edx,%edi
+  80237a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80237e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802382:	0f ad d0             	shrd   %cl,%edx,%eax
+  802385:	d3 ea                	shr    %cl,%edx
+  802387:	f6 c1 20             	test   $0x20,%cl
+  80238a:	0f 45 c2             	cmovne %edx,%eax
+  80238d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802391:	83 e0 01             	and    $0x1,%eax
+  802394:	09 fa                	or     %edi,%edx
+  802396:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80239a:	89 04 24             	mov    %eax,(%esp)
+  80239d:	8b 04 24             	mov    (%esp),%eax
+  8023a0:	89 d3                	mov    %edx,%ebx
+  8023a2:	09 f0                	or     %esi,%eax
+  8023a4:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8023a8:	39 f0                	cmp    %esi,%eax
+  8023aa:	19 fb                	sbb    %edi,%ebx
+  8023ac:	72 04                	jb     8023b2 <__umoddi3+0x82>
+  8023ae:	29 f0                	sub    %esi,%eax
+  8023b0:	19 fa                	sbb    %edi,%edx
+  8023b2:	83 e9 01             	sub    $0x1,%ecx
+  8023b5:	73 b1                	jae    802368 <__umoddi3+0x38>
+  8023b7:	83 c4 18             	add    $0x18,%esp
+  8023ba:	5b                   	pop    %ebx
+  8023bb:	5e                   	pop    %esi
+  8023bc:	5f                   	pop    %edi
+  8023bd:	c3                   	ret
+  8023be:	66 90                	xchg   %ax,%ax
+
+008023c0 <__divdi3>:
+  8023c0:	55                   	push   %ebp
+  8023c1:	57                   	push   %edi
+  8023c2:	56                   	push   %esi
+  8023c3:	53                   	push   %ebx
+  8023c4:	83 ec 24             	sub    $0x24,%esp
+  8023c7:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  8023cb:	8b 74 24 44          	mov    0x44(%esp),%esi
+  8023cf:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8023d3:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8023d7:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  8023db:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8023df:	85 d2                	test   %edx,%edx
+  8023e1:	0f 88 e0 00 00 00    	js     8024c7 <__divdi3+0x107>
+  8023e7:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  8023eb:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  8023ef:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8023f3:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8023f7:	85 f6                	test   %esi,%esi
+  8023f9:	78 16                	js     802411 <__divdi3+0x51>
+  8023fb:	89 f1                	mov    %esi,%ecx
+  8023fd:	31 c0                	xor    %eax,%eax
+  8023ff:	31 d2                	xor    %edx,%edx
+  802401:	09 d9                	or     %ebx,%ecx
+  802403:	0f 85 f3 00 00 00    	jne    8024fc <__divdi3+0x13c>
+  802409:	83 c4 24             	add    $0x24,%esp
+  80240c:	5b                   	pop    %ebx
+  80240d:	5e                   	pop    %esi
+  80240e:	5f                   	pop    %edi
+  80240f:	5d                   	pop    %ebp
+  802410:	c3                   	ret
+  802411:	bf 01 00 00 00       	mov    $0x1,%edi
+  802416:	f7 5c 24 08          	negl   0x8(%esp)
+  80241a:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  80241f:	f7 5c 24 0c          	negl   0xc(%esp)
+  802423:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80242a:	00 
+  80242b:	31 c0                	xor    %eax,%eax
+  80242d:	31 d2                	xor    %edx,%edx
+  80242f:	89 fb                	mov    %edi,%ebx
+  802431:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802438:	00 
+  802439:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80243e:	66 90                	xchg   %ax,%ax
+  802440:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802444:	01 c0                	add    %eax,%eax
+  802446:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80244d:	00 
+  80244e:	89 c6                	mov    %eax,%esi
+  802450:	89 d7                	mov    %edx,%edi
+  802452:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802456:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80245a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80245d:	d3 ea                	shr    %cl,%edx
+  80245f:	f6 c1 20             	test   $0x20,%cl
+  802462:	0f 45 c2             	cmovne %edx,%eax
+  802465:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802469:	83 e0 01             	and    $0x1,%eax
+  80246c:	09 fa                	or     %edi,%edx
+  80246e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802472:	89 04 24             	mov    %eax,(%esp)
+  802475:	8b 04 24             	mov    (%esp),%eax
+  802478:	89 d5                	mov    %edx,%ebp
+  80247a:	09 f0                	or     %esi,%eax
+  80247c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802480:	39 f0                	cmp    %esi,%eax
+  802482:	19 fd                	sbb    %edi,%ebp
+  802484:	72 1d                	jb     8024a3 <__divdi3+0xe3>
+  802486:	29 f0                	sub    %esi,%eax
+  802488:	19 fa                	sbb    %edi,%edx
+  80248a:	89 cf                	mov    %ecx,%edi
+  80248c:	c1 ef 05             	shr    $0x5,%edi
+  80248f:	83 e7 01             	and    $0x1,%edi
+  802492:	89 fe                	mov    %edi,%esi
+  802494:	d3 e7                	shl    %cl,%edi
+  802496:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80249a:	83 f6 01             	xor    $0x1,%esi
+  80249d:	d3 e6                	shl    %cl,%esi
+  80249f:	09 74 24 18          	or     %esi,0x18(%esp)
+  8024a3:	83 e9 01             	sub    $0x1,%ecx
+  8024a6:	73 98                	jae    802440 <__divdi3+0x80>
+  8024a8:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8024ac:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8024b0:	85 db                	test   %ebx,%ebx
+  8024b2:	0f 84 51 ff ff ff    	je     802409 <__divdi3+0x49>
+  8024b8:	f7 d8                	neg    %eax
+  8024ba:	83 d2 00             	adc    $0x0,%edx
+  8024bd:	83 c4 24             	add    $0x24,%esp
+  8024c0:	5b                   	pop    %ebx
+  8024c1:	f7 da                	neg    %edx
+  8024c3:	5e                   	pop    %esi
+  8024c4:	5f                   	pop    %edi
+  8024c5:	5d                   	pop    %ebp
+  8024c6:	c3                   	ret
+  8024c7:	f7 d8                	neg    %eax
+  8024c9:	83 d2 00             	adc    $0x0,%edx
+  8024cc:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8024d0:	f7 da                	neg    %edx
+  8024d2:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8024d6:	85 f6                	test   %esi,%esi
+  8024d8:	78 1b                	js     8024f5 <__divdi3+0x135>
+  8024da:	89 f1                	mov    %esi,%ecx
+  8024dc:	31 c0                	xor    %eax,%eax
+  8024de:	31 d2                	xor    %edx,%edx
+  8024e0:	bf 01 00 00 00       	mov    $0x1,%edi
+  8024e5:	09 d9                	or     %ebx,%ecx
+  8024e7:	0f 85 36 ff ff ff    	jne    802423 <__divdi3+0x63>
+  8024ed:	83 c4 24             	add    $0x24,%esp
+  8024f0:	5b                   	pop    %ebx
+  8024f1:	5e                   	pop    %esi
+  8024f2:	5f                   	pop    %edi
+  8024f3:	5d                   	pop    %ebp
+  8024f4:	c3                   	ret
+  8024f5:	31 ff                	xor    %edi,%edi
+  8024f7:	e9 1a ff ff ff       	jmp    802416 <__divdi3+0x56>
+  8024fc:	31 ff                	xor    %edi,%edi
+  8024fe:	e9 20 ff ff ff       	jmp    802423 <__divdi3+0x63>
+  802503:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80250a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00802510 <__moddi3>:
+  802510:	55                   	push   %ebp
+  802511:	57                   	push   %edi
+  802512:	56                   	push   %esi
+  802513:	53                   	push   %ebx
+  802514:	83 ec 1c             	sub    $0x1c,%esp
+  802517:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  80251b:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  80251f:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  802523:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  802527:	89 c8                	mov    %ecx,%eax
+  802529:	89 f2                	mov    %esi,%edx
+  80252b:	89 f3                	mov    %esi,%ebx
+  80252d:	85 ed                	test   %ebp,%ebp
+  80252f:	0f 88 9d 00 00 00    	js     8025d2 <__moddi3+0xc2>
+  802535:	09 cb                	or     %ecx,%ebx
+  802537:	0f 84 8d 00 00 00    	je     8025ca <__moddi3+0xba>
+  80253d:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802541:	31 db                	xor    %ebx,%ebx
+  802543:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802547:	89 ca                	mov    %ecx,%edx
+  802549:	89 f0                	mov    %esi,%eax
+  80254b:	89 dd                	mov    %ebx,%ebp
+  80254d:	f7 da                	neg    %edx
+  80254f:	83 d0 00             	adc    $0x0,%eax
+  802552:	f7 d8                	neg    %eax
+  802554:	0f 49 f0             	cmovns %eax,%esi
+  802557:	0f 49 ca             	cmovns %edx,%ecx
+  80255a:	31 c0                	xor    %eax,%eax
+  80255c:	31 d2                	xor    %edx,%edx
+  80255e:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802562:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802566:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80256b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80256f:	90                   	nop
+  802570:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802574:	01 c0                	add    %eax,%eax
+  802576:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80257d:	00 
+  80257e:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  802582:	89 c6                	mov    %eax,%esi
+  802584:	89 d7                	mov    %edx,%edi
+  802586:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80258a:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80258e:	0f ad d0             	shrd   %cl,%edx,%eax
+  802591:	d3 ea                	shr    %cl,%edx
+  802593:	f6 c1 20             	test   $0x20,%cl
+  802596:	0f 45 c2             	cmovne %edx,%eax
+  802599:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80259d:	83 e0 01             	and    $0x1,%eax
+  8025a0:	09 fa                	or     %edi,%edx
+  8025a2:	89 04 24             	mov    %eax,(%esp)
+  8025a5:	8b 04 24             	mov    (%esp),%eax
+  8025a8:	89 d7                	mov    %edx,%edi
+  8025aa:	09 f0                	or     %esi,%eax
+  8025ac:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  8025b0:	39 d8                	cmp    %ebx,%eax
+  8025b2:	19 f7                	sbb    %esi,%edi
+  8025b4:	72 04                	jb     8025ba <__moddi3+0xaa>
+  8025b6:	29 d8                	sub    %ebx,%eax
+  8025b8:	19 f2                	sbb    %esi,%edx
+  8025ba:	83 e9 01             	sub    $0x1,%ecx
+  8025bd:	73 b1                	jae    802570 <__moddi3+0x60>
+  8025bf:	85 ed                	test   %ebp,%ebp
+  8025c1:	74 07                	je     8025ca <__moddi3+0xba>
+  8025c3:	f7 d8                	neg    %eax
+  8025c5:	83 d2 00             	adc    $0x0,%edx
+  8025c8:	f7 da                	neg    %edx
+  8025ca:	83 c4 1c             	add    $0x1c,%esp
+  8025cd:	5b                   	pop    %ebx
+  8025ce:	5e                   	pop    %esi
+  8025cf:	5f                   	pop    %edi
+  8025d0:	5d                   	pop    %ebp
+  8025d1:	c3                   	ret
+  8025d2:	09 cb                	or     %ecx,%ebx
+  8025d4:	74 f4                	je     8025ca <__moddi3+0xba>
+  8025d6:	f7 df                	neg    %edi
+  8025d8:	bb 01 00 00 00       	mov    $0x1,%ebx
+  8025dd:	83 d5 00             	adc    $0x0,%ebp
+  8025e0:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  8025e4:	f7 dd                	neg    %ebp
+  8025e6:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  8025ea:	e9 58 ff ff ff       	jmp    802547 <__moddi3+0x37>
@@ -0,0 +1,5264 @@
+
+obj/user/faultbadhandler.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 34 00 00 00       	call   800065 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 0c             	sub    $0xc,%esp
+	sys_page_alloc(0, (void*) (UXSTACKTOP - PGSIZE), PTE_P|PTE_U|PTE_W);
+  800039:	6a 07                	push   $0x7
+  80003b:	68 00 f0 bf ee       	push   $0xeebff000
+  800040:	6a 00                	push   $0x0
+  800042:	e8 3d 01 00 00       	call   800184 <sys_page_alloc>
+	sys_env_set_pgfault_upcall(0, (void*) 0xDeadBeef);
+  800047:	83 c4 08             	add    $0x8,%esp
+  80004a:	68 ef be ad de       	push   $0xdeadbeef
+  80004f:	6a 00                	push   $0x0
+  800051:	e8 79 02 00 00       	call   8002cf <sys_env_set_pgfault_upcall>
+	*(int*)0 = 0;
+  800056:	c7 05 00 00 00 00 00 	movl   $0x0,0x0
+  80005d:	00 00 00 
+}
+  800060:	83 c4 10             	add    $0x10,%esp
+  800063:	c9                   	leave
+  800064:	c3                   	ret
+
+00800065 <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  800065:	55                   	push   %ebp
+  800066:	89 e5                	mov    %esp,%ebp
+  800068:	56                   	push   %esi
+  800069:	53                   	push   %ebx
+  80006a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80006d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  800070:	e8 d1 00 00 00       	call   800146 <sys_getenvid>
+  800075:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80007a:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80007d:	c1 e0 04             	shl    $0x4,%eax
+  800080:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800085:	a3 08 40 80 00       	mov    %eax,0x804008
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  80008a:	85 db                	test   %ebx,%ebx
+  80008c:	7e 07                	jle    800095 <libmain+0x30>
+    binaryname = argv[0];
+  80008e:	8b 06                	mov    (%esi),%eax
+  800090:	a3 00 30 80 00       	mov    %eax,0x803000
+
+  // call user main routine
+  umain(argc, argv);
+  800095:	83 ec 08             	sub    $0x8,%esp
+  800098:	56                   	push   %esi
+  800099:	53                   	push   %ebx
+  80009a:	e8 94 ff ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  80009f:	e8 0a 00 00 00       	call   8000ae <exit>
+}
+  8000a4:	83 c4 10             	add    $0x10,%esp
+  8000a7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000aa:	5b                   	pop    %ebx
+  8000ab:	5e                   	pop    %esi
+  8000ac:	5d                   	pop    %ebp
+  8000ad:	c3                   	ret
+
+008000ae <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000ae:	55                   	push   %ebp
+  8000af:	89 e5                	mov    %esp,%ebp
+  8000b1:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8000b4:	e8 72 05 00 00       	call   80062b <close_all>
+	sys_env_destroy(0);
+  8000b9:	83 ec 0c             	sub    $0xc,%esp
+  8000bc:	6a 00                	push   $0x0
+  8000be:	e8 42 00 00 00       	call   800105 <sys_env_destroy>
+}
+  8000c3:	83 c4 10             	add    $0x10,%esp
+  8000c6:	c9                   	leave
+  8000c7:	c3                   	ret
+
+008000c8 <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8000c8:	55                   	push   %ebp
+  8000c9:	89 e5                	mov    %esp,%ebp
+  8000cb:	57                   	push   %edi
+  8000cc:	56                   	push   %esi
+  8000cd:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8000ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000d6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000d9:	89 c3                	mov    %eax,%ebx
+  8000db:	89 c7                	mov    %eax,%edi
+  8000dd:	89 c6                	mov    %eax,%esi
+  8000df:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  8000e1:	5b                   	pop    %ebx
+  8000e2:	5e                   	pop    %esi
+  8000e3:	5f                   	pop    %edi
+  8000e4:	5d                   	pop    %ebp
+  8000e5:	c3                   	ret
+
+008000e6 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8000e6:	55                   	push   %ebp
+  8000e7:	89 e5                	mov    %esp,%ebp
+  8000e9:	57                   	push   %edi
+  8000ea:	56                   	push   %esi
+  8000eb:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8000ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000f1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000f6:	89 d1                	mov    %edx,%ecx
+  8000f8:	89 d3                	mov    %edx,%ebx
+  8000fa:	89 d7                	mov    %edx,%edi
+  8000fc:	89 d6                	mov    %edx,%esi
+  8000fe:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800100:	5b                   	pop    %ebx
+  800101:	5e                   	pop    %esi
+  800102:	5f                   	pop    %edi
+  800103:	5d                   	pop    %ebp
+  800104:	c3                   	ret
+
+00800105 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800105:	55                   	push   %ebp
+  800106:	89 e5                	mov    %esp,%ebp
+  800108:	57                   	push   %edi
+  800109:	56                   	push   %esi
+  80010a:	53                   	push   %ebx
+  80010b:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  80010e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800113:	8b 55 08             	mov    0x8(%ebp),%edx
+  800116:	b8 03 00 00 00       	mov    $0x3,%eax
+  80011b:	89 cb                	mov    %ecx,%ebx
+  80011d:	89 cf                	mov    %ecx,%edi
+  80011f:	89 ce                	mov    %ecx,%esi
+  800121:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800123:	85 c0                	test   %eax,%eax
+  800125:	7f 08                	jg     80012f <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800127:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80012a:	5b                   	pop    %ebx
+  80012b:	5e                   	pop    %esi
+  80012c:	5f                   	pop    %edi
+  80012d:	5d                   	pop    %ebp
+  80012e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80012f:	83 ec 0c             	sub    $0xc,%esp
+  800132:	50                   	push   %eax
+  800133:	6a 03                	push   $0x3
+  800135:	68 2a 25 80 00       	push   $0x80252a
+  80013a:	6a 3e                	push   $0x3e
+  80013c:	68 47 25 80 00       	push   $0x802547
+  800141:	e8 22 14 00 00       	call   801568 <_panic>
+
+00800146 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800146:	55                   	push   %ebp
+  800147:	89 e5                	mov    %esp,%ebp
+  800149:	57                   	push   %edi
+  80014a:	56                   	push   %esi
+  80014b:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80014c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800151:	b8 02 00 00 00       	mov    $0x2,%eax
+  800156:	89 d1                	mov    %edx,%ecx
+  800158:	89 d3                	mov    %edx,%ebx
+  80015a:	89 d7                	mov    %edx,%edi
+  80015c:	89 d6                	mov    %edx,%esi
+  80015e:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800160:	5b                   	pop    %ebx
+  800161:	5e                   	pop    %esi
+  800162:	5f                   	pop    %edi
+  800163:	5d                   	pop    %ebp
+  800164:	c3                   	ret
+
+00800165 <sys_yield>:
+
+void
+sys_yield(void) {
+  800165:	55                   	push   %ebp
+  800166:	89 e5                	mov    %esp,%ebp
+  800168:	57                   	push   %edi
+  800169:	56                   	push   %esi
+  80016a:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80016b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800170:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800175:	89 d1                	mov    %edx,%ecx
+  800177:	89 d3                	mov    %edx,%ebx
+  800179:	89 d7                	mov    %edx,%edi
+  80017b:	89 d6                	mov    %edx,%esi
+  80017d:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  80017f:	5b                   	pop    %ebx
+  800180:	5e                   	pop    %esi
+  800181:	5f                   	pop    %edi
+  800182:	5d                   	pop    %ebp
+  800183:	c3                   	ret
+
+00800184 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  800184:	55                   	push   %ebp
+  800185:	89 e5                	mov    %esp,%ebp
+  800187:	57                   	push   %edi
+  800188:	56                   	push   %esi
+  800189:	53                   	push   %ebx
+  80018a:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  80018d:	be 00 00 00 00       	mov    $0x0,%esi
+  800192:	8b 55 08             	mov    0x8(%ebp),%edx
+  800195:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800198:	b8 04 00 00 00       	mov    $0x4,%eax
+  80019d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001a0:	89 f7                	mov    %esi,%edi
+  8001a2:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8001a4:	85 c0                	test   %eax,%eax
+  8001a6:	7f 08                	jg     8001b0 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  8001a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001ab:	5b                   	pop    %ebx
+  8001ac:	5e                   	pop    %esi
+  8001ad:	5f                   	pop    %edi
+  8001ae:	5d                   	pop    %ebp
+  8001af:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8001b0:	83 ec 0c             	sub    $0xc,%esp
+  8001b3:	50                   	push   %eax
+  8001b4:	6a 04                	push   $0x4
+  8001b6:	68 2a 25 80 00       	push   $0x80252a
+  8001bb:	6a 3e                	push   $0x3e
+  8001bd:	68 47 25 80 00       	push   $0x802547
+  8001c2:	e8 a1 13 00 00       	call   801568 <_panic>
+
+008001c7 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  8001c7:	55                   	push   %ebp
+  8001c8:	89 e5                	mov    %esp,%ebp
+  8001ca:	57                   	push   %edi
+  8001cb:	56                   	push   %esi
+  8001cc:	53                   	push   %ebx
+  8001cd:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8001d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001d3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001d6:	b8 05 00 00 00       	mov    $0x5,%eax
+  8001db:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001de:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8001e1:	8b 75 18             	mov    0x18(%ebp),%esi
+  8001e4:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8001e6:	85 c0                	test   %eax,%eax
+  8001e8:	7f 08                	jg     8001f2 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  8001ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001ed:	5b                   	pop    %ebx
+  8001ee:	5e                   	pop    %esi
+  8001ef:	5f                   	pop    %edi
+  8001f0:	5d                   	pop    %ebp
+  8001f1:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8001f2:	83 ec 0c             	sub    $0xc,%esp
+  8001f5:	50                   	push   %eax
+  8001f6:	6a 05                	push   $0x5
+  8001f8:	68 2a 25 80 00       	push   $0x80252a
+  8001fd:	6a 3e                	push   $0x3e
+  8001ff:	68 47 25 80 00       	push   $0x802547
+  800204:	e8 5f 13 00 00       	call   801568 <_panic>
+
+00800209 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  800209:	55                   	push   %ebp
+  80020a:	89 e5                	mov    %esp,%ebp
+  80020c:	57                   	push   %edi
+  80020d:	56                   	push   %esi
+  80020e:	53                   	push   %ebx
+  80020f:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800212:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800217:	8b 55 08             	mov    0x8(%ebp),%edx
+  80021a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80021d:	b8 06 00 00 00       	mov    $0x6,%eax
+  800222:	89 df                	mov    %ebx,%edi
+  800224:	89 de                	mov    %ebx,%esi
+  800226:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800228:	85 c0                	test   %eax,%eax
+  80022a:	7f 08                	jg     800234 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  80022c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80022f:	5b                   	pop    %ebx
+  800230:	5e                   	pop    %esi
+  800231:	5f                   	pop    %edi
+  800232:	5d                   	pop    %ebp
+  800233:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800234:	83 ec 0c             	sub    $0xc,%esp
+  800237:	50                   	push   %eax
+  800238:	6a 06                	push   $0x6
+  80023a:	68 2a 25 80 00       	push   $0x80252a
+  80023f:	6a 3e                	push   $0x3e
+  800241:	68 47 25 80 00       	push   $0x802547
+  800246:	e8 1d 13 00 00       	call   801568 <_panic>
+
+0080024b <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80024b:	55                   	push   %ebp
+  80024c:	89 e5                	mov    %esp,%ebp
+  80024e:	57                   	push   %edi
+  80024f:	56                   	push   %esi
+  800250:	53                   	push   %ebx
+  800251:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800254:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800259:	8b 55 08             	mov    0x8(%ebp),%edx
+  80025c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80025f:	b8 08 00 00 00       	mov    $0x8,%eax
+  800264:	89 df                	mov    %ebx,%edi
+  800266:	89 de                	mov    %ebx,%esi
+  800268:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80026a:	85 c0                	test   %eax,%eax
+  80026c:	7f 08                	jg     800276 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  80026e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800271:	5b                   	pop    %ebx
+  800272:	5e                   	pop    %esi
+  800273:	5f                   	pop    %edi
+  800274:	5d                   	pop    %ebp
+  800275:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800276:	83 ec 0c             	sub    $0xc,%esp
+  800279:	50                   	push   %eax
+  80027a:	6a 08                	push   $0x8
+  80027c:	68 2a 25 80 00       	push   $0x80252a
+  800281:	6a 3e                	push   $0x3e
+  800283:	68 47 25 80 00       	push   $0x802547
+  800288:	e8 db 12 00 00       	call   801568 <_panic>
+
+0080028d <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80028d:	55                   	push   %ebp
+  80028e:	89 e5                	mov    %esp,%ebp
+  800290:	57                   	push   %edi
+  800291:	56                   	push   %esi
+  800292:	53                   	push   %ebx
+  800293:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800296:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80029b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80029e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002a1:	b8 09 00 00 00       	mov    $0x9,%eax
+  8002a6:	89 df                	mov    %ebx,%edi
+  8002a8:	89 de                	mov    %ebx,%esi
+  8002aa:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8002ac:	85 c0                	test   %eax,%eax
+  8002ae:	7f 08                	jg     8002b8 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8002b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002b3:	5b                   	pop    %ebx
+  8002b4:	5e                   	pop    %esi
+  8002b5:	5f                   	pop    %edi
+  8002b6:	5d                   	pop    %ebp
+  8002b7:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8002b8:	83 ec 0c             	sub    $0xc,%esp
+  8002bb:	50                   	push   %eax
+  8002bc:	6a 09                	push   $0x9
+  8002be:	68 2a 25 80 00       	push   $0x80252a
+  8002c3:	6a 3e                	push   $0x3e
+  8002c5:	68 47 25 80 00       	push   $0x802547
+  8002ca:	e8 99 12 00 00       	call   801568 <_panic>
+
+008002cf <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8002cf:	55                   	push   %ebp
+  8002d0:	89 e5                	mov    %esp,%ebp
+  8002d2:	57                   	push   %edi
+  8002d3:	56                   	push   %esi
+  8002d4:	53                   	push   %ebx
+  8002d5:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8002d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002dd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002e0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002e3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8002e8:	89 df                	mov    %ebx,%edi
+  8002ea:	89 de                	mov    %ebx,%esi
+  8002ec:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8002ee:	85 c0                	test   %eax,%eax
+  8002f0:	7f 08                	jg     8002fa <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8002f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002f5:	5b                   	pop    %ebx
+  8002f6:	5e                   	pop    %esi
+  8002f7:	5f                   	pop    %edi
+  8002f8:	5d                   	pop    %ebp
+  8002f9:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8002fa:	83 ec 0c             	sub    $0xc,%esp
+  8002fd:	50                   	push   %eax
+  8002fe:	6a 0a                	push   $0xa
+  800300:	68 2a 25 80 00       	push   $0x80252a
+  800305:	6a 3e                	push   $0x3e
+  800307:	68 47 25 80 00       	push   $0x802547
+  80030c:	e8 57 12 00 00       	call   801568 <_panic>
+
+00800311 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  800311:	55                   	push   %ebp
+  800312:	89 e5                	mov    %esp,%ebp
+  800314:	57                   	push   %edi
+  800315:	56                   	push   %esi
+  800316:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800317:	8b 55 08             	mov    0x8(%ebp),%edx
+  80031a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80031d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800322:	be 00 00 00 00       	mov    $0x0,%esi
+  800327:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80032a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80032d:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  80032f:	5b                   	pop    %ebx
+  800330:	5e                   	pop    %esi
+  800331:	5f                   	pop    %edi
+  800332:	5d                   	pop    %ebp
+  800333:	c3                   	ret
+
+00800334 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  800334:	55                   	push   %ebp
+  800335:	89 e5                	mov    %esp,%ebp
+  800337:	57                   	push   %edi
+  800338:	56                   	push   %esi
+  800339:	53                   	push   %ebx
+  80033a:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  80033d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800342:	8b 55 08             	mov    0x8(%ebp),%edx
+  800345:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80034a:	89 cb                	mov    %ecx,%ebx
+  80034c:	89 cf                	mov    %ecx,%edi
+  80034e:	89 ce                	mov    %ecx,%esi
+  800350:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800352:	85 c0                	test   %eax,%eax
+  800354:	7f 08                	jg     80035e <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  800356:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800359:	5b                   	pop    %ebx
+  80035a:	5e                   	pop    %esi
+  80035b:	5f                   	pop    %edi
+  80035c:	5d                   	pop    %ebp
+  80035d:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80035e:	83 ec 0c             	sub    $0xc,%esp
+  800361:	50                   	push   %eax
+  800362:	6a 0d                	push   $0xd
+  800364:	68 2a 25 80 00       	push   $0x80252a
+  800369:	6a 3e                	push   $0x3e
+  80036b:	68 47 25 80 00       	push   $0x802547
+  800370:	e8 f3 11 00 00       	call   801568 <_panic>
+
+00800375 <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  800375:	55                   	push   %ebp
+  800376:	89 e5                	mov    %esp,%ebp
+  800378:	57                   	push   %edi
+  800379:	56                   	push   %esi
+  80037a:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80037b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800380:	8b 55 08             	mov    0x8(%ebp),%edx
+  800383:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800386:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80038b:	89 df                	mov    %ebx,%edi
+  80038d:	89 de                	mov    %ebx,%esi
+  80038f:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  800391:	5b                   	pop    %ebx
+  800392:	5e                   	pop    %esi
+  800393:	5f                   	pop    %edi
+  800394:	5d                   	pop    %ebp
+  800395:	c3                   	ret
+
+00800396 <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  800396:	55                   	push   %ebp
+  800397:	89 e5                	mov    %esp,%ebp
+  800399:	57                   	push   %edi
+  80039a:	56                   	push   %esi
+  80039b:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80039c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8003a1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003a4:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8003a9:	89 cb                	mov    %ecx,%ebx
+  8003ab:	89 cf                	mov    %ecx,%edi
+  8003ad:	89 ce                	mov    %ecx,%esi
+  8003af:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  8003b1:	5b                   	pop    %ebx
+  8003b2:	5e                   	pop    %esi
+  8003b3:	5f                   	pop    %edi
+  8003b4:	5d                   	pop    %ebp
+  8003b5:	c3                   	ret
+
+008003b6 <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  8003b6:	55                   	push   %ebp
+  8003b7:	89 e5                	mov    %esp,%ebp
+  8003b9:	57                   	push   %edi
+  8003ba:	56                   	push   %esi
+  8003bb:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8003bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003c1:	b8 10 00 00 00       	mov    $0x10,%eax
+  8003c6:	89 d1                	mov    %edx,%ecx
+  8003c8:	89 d3                	mov    %edx,%ebx
+  8003ca:	89 d7                	mov    %edx,%edi
+  8003cc:	89 d6                	mov    %edx,%esi
+  8003ce:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8003d0:	5b                   	pop    %ebx
+  8003d1:	5e                   	pop    %esi
+  8003d2:	5f                   	pop    %edi
+  8003d3:	5d                   	pop    %ebp
+  8003d4:	c3                   	ret
+
+008003d5 <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  8003d5:	55                   	push   %ebp
+  8003d6:	89 e5                	mov    %esp,%ebp
+  8003d8:	57                   	push   %edi
+  8003d9:	56                   	push   %esi
+  8003da:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8003db:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003e0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003e3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003e6:	b8 11 00 00 00       	mov    $0x11,%eax
+  8003eb:	89 df                	mov    %ebx,%edi
+  8003ed:	89 de                	mov    %ebx,%esi
+  8003ef:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  8003f1:	5b                   	pop    %ebx
+  8003f2:	5e                   	pop    %esi
+  8003f3:	5f                   	pop    %edi
+  8003f4:	5d                   	pop    %ebp
+  8003f5:	c3                   	ret
+
+008003f6 <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  8003f6:	55                   	push   %ebp
+  8003f7:	89 e5                	mov    %esp,%ebp
+  8003f9:	57                   	push   %edi
+  8003fa:	56                   	push   %esi
+  8003fb:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8003fc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800401:	8b 55 08             	mov    0x8(%ebp),%edx
+  800404:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800407:	b8 12 00 00 00       	mov    $0x12,%eax
+  80040c:	89 df                	mov    %ebx,%edi
+  80040e:	89 de                	mov    %ebx,%esi
+  800410:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800412:	5b                   	pop    %ebx
+  800413:	5e                   	pop    %esi
+  800414:	5f                   	pop    %edi
+  800415:	5d                   	pop    %ebp
+  800416:	c3                   	ret
+
+00800417 <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  800417:	55                   	push   %ebp
+  800418:	89 e5                	mov    %esp,%ebp
+  80041a:	57                   	push   %edi
+  80041b:	56                   	push   %esi
+  80041c:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80041d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800422:	8b 55 08             	mov    0x8(%ebp),%edx
+  800425:	b8 13 00 00 00       	mov    $0x13,%eax
+  80042a:	89 cb                	mov    %ecx,%ebx
+  80042c:	89 cf                	mov    %ecx,%edi
+  80042e:	89 ce                	mov    %ecx,%esi
+  800430:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  800432:	5b                   	pop    %ebx
+  800433:	5e                   	pop    %esi
+  800434:	5f                   	pop    %edi
+  800435:	5d                   	pop    %ebp
+  800436:	c3                   	ret
+
+00800437 <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  800437:	55                   	push   %ebp
+  800438:	89 e5                	mov    %esp,%ebp
+  80043a:	57                   	push   %edi
+  80043b:	56                   	push   %esi
+  80043c:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80043d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800442:	8b 55 08             	mov    0x8(%ebp),%edx
+  800445:	b8 14 00 00 00       	mov    $0x14,%eax
+  80044a:	89 cb                	mov    %ecx,%ebx
+  80044c:	89 cf                	mov    %ecx,%edi
+  80044e:	89 ce                	mov    %ecx,%esi
+  800450:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  800452:	5b                   	pop    %ebx
+  800453:	5e                   	pop    %esi
+  800454:	5f                   	pop    %edi
+  800455:	5d                   	pop    %ebp
+  800456:	c3                   	ret
+
+00800457 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800457:	55                   	push   %ebp
+  800458:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80045a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80045d:	05 00 00 00 30       	add    $0x30000000,%eax
+  800462:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800465:	5d                   	pop    %ebp
+  800466:	c3                   	ret
+
+00800467 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800467:	55                   	push   %ebp
+  800468:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80046a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80046d:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800472:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800477:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80047c:	5d                   	pop    %ebp
+  80047d:	c3                   	ret
+
+0080047e <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80047e:	55                   	push   %ebp
+  80047f:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  800481:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800486:	eb 02                	jmp    80048a <fd_alloc+0xc>
+  800488:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80048a:	89 c2                	mov    %eax,%edx
+  80048c:	c1 ea 16             	shr    $0x16,%edx
+  80048f:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800496:	f6 c2 01             	test   $0x1,%dl
+  800499:	74 2b                	je     8004c6 <fd_alloc+0x48>
+  80049b:	89 c2                	mov    %eax,%edx
+  80049d:	c1 ea 0c             	shr    $0xc,%edx
+  8004a0:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8004a7:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8004ad:	f6 c1 01             	test   $0x1,%cl
+  8004b0:	74 14                	je     8004c6 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8004b2:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8004b8:	75 ce                	jne    800488 <fd_alloc+0xa>
+  8004ba:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8004bf:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8004c4:	eb 05                	jmp    8004cb <fd_alloc+0x4d>
+			return 0;
+  8004c6:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8004cb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004ce:	89 02                	mov    %eax,(%edx)
+}
+  8004d0:	89 c8                	mov    %ecx,%eax
+  8004d2:	5d                   	pop    %ebp
+  8004d3:	c3                   	ret
+
+008004d4 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8004d4:	55                   	push   %ebp
+  8004d5:	89 e5                	mov    %esp,%ebp
+  8004d7:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8004da:	83 f8 1f             	cmp    $0x1f,%eax
+  8004dd:	77 30                	ja     80050f <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8004df:	c1 e0 0c             	shl    $0xc,%eax
+  8004e2:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8004e7:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8004ed:	f6 c2 01             	test   $0x1,%dl
+  8004f0:	74 24                	je     800516 <fd_lookup+0x42>
+  8004f2:	89 c2                	mov    %eax,%edx
+  8004f4:	c1 ea 0c             	shr    $0xc,%edx
+  8004f7:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8004fe:	f6 c2 01             	test   $0x1,%dl
+  800501:	74 1a                	je     80051d <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  800503:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800506:	89 02                	mov    %eax,(%edx)
+	return 0;
+  800508:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80050d:	5d                   	pop    %ebp
+  80050e:	c3                   	ret
+		return -E_INVAL;
+  80050f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800514:	eb f7                	jmp    80050d <fd_lookup+0x39>
+		return -E_INVAL;
+  800516:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80051b:	eb f0                	jmp    80050d <fd_lookup+0x39>
+  80051d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800522:	eb e9                	jmp    80050d <fd_lookup+0x39>
+
+00800524 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  800524:	55                   	push   %ebp
+  800525:	89 e5                	mov    %esp,%ebp
+  800527:	53                   	push   %ebx
+  800528:	83 ec 04             	sub    $0x4,%esp
+  80052b:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80052e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800533:	eb 03                	jmp    800538 <dev_lookup+0x14>
+  800535:	83 c0 01             	add    $0x1,%eax
+  800538:	8b 1c 85 d4 25 80 00 	mov    0x8025d4(,%eax,4),%ebx
+  80053f:	85 db                	test   %ebx,%ebx
+  800541:	74 0b                	je     80054e <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  800543:	39 13                	cmp    %edx,(%ebx)
+  800545:	75 ee                	jne    800535 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  800547:	b8 00 00 00 00       	mov    $0x0,%eax
+  80054c:	eb 1f                	jmp    80056d <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80054e:	a1 08 40 80 00       	mov    0x804008,%eax
+  800553:	8b 40 48             	mov    0x48(%eax),%eax
+  800556:	83 ec 04             	sub    $0x4,%esp
+  800559:	52                   	push   %edx
+  80055a:	50                   	push   %eax
+  80055b:	68 58 25 80 00       	push   $0x802558
+  800560:	e8 de 10 00 00       	call   801643 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  800565:	83 c4 10             	add    $0x10,%esp
+  800568:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80056d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800570:	89 1a                	mov    %ebx,(%edx)
+}
+  800572:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800575:	c9                   	leave
+  800576:	c3                   	ret
+
+00800577 <fd_close>:
+{
+  800577:	55                   	push   %ebp
+  800578:	89 e5                	mov    %esp,%ebp
+  80057a:	57                   	push   %edi
+  80057b:	56                   	push   %esi
+  80057c:	53                   	push   %ebx
+  80057d:	83 ec 24             	sub    $0x24,%esp
+  800580:	8b 75 08             	mov    0x8(%ebp),%esi
+  800583:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800586:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800589:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80058a:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800590:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800593:	50                   	push   %eax
+  800594:	e8 3b ff ff ff       	call   8004d4 <fd_lookup>
+  800599:	89 c3                	mov    %eax,%ebx
+  80059b:	83 c4 10             	add    $0x10,%esp
+  80059e:	85 c0                	test   %eax,%eax
+  8005a0:	78 05                	js     8005a7 <fd_close+0x30>
+	    || fd != fd2)
+  8005a2:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8005a5:	74 16                	je     8005bd <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8005a7:	89 f8                	mov    %edi,%eax
+  8005a9:	84 c0                	test   %al,%al
+  8005ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005b0:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8005b3:	89 d8                	mov    %ebx,%eax
+  8005b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005b8:	5b                   	pop    %ebx
+  8005b9:	5e                   	pop    %esi
+  8005ba:	5f                   	pop    %edi
+  8005bb:	5d                   	pop    %ebp
+  8005bc:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8005bd:	83 ec 08             	sub    $0x8,%esp
+  8005c0:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8005c3:	50                   	push   %eax
+  8005c4:	ff 36                	push   (%esi)
+  8005c6:	e8 59 ff ff ff       	call   800524 <dev_lookup>
+  8005cb:	89 c3                	mov    %eax,%ebx
+  8005cd:	83 c4 10             	add    $0x10,%esp
+  8005d0:	85 c0                	test   %eax,%eax
+  8005d2:	78 1a                	js     8005ee <fd_close+0x77>
+		if (dev->dev_close)
+  8005d4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005d7:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8005da:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8005df:	85 c0                	test   %eax,%eax
+  8005e1:	74 0b                	je     8005ee <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8005e3:	83 ec 0c             	sub    $0xc,%esp
+  8005e6:	56                   	push   %esi
+  8005e7:	ff d0                	call   *%eax
+  8005e9:	89 c3                	mov    %eax,%ebx
+  8005eb:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8005ee:	83 ec 08             	sub    $0x8,%esp
+  8005f1:	56                   	push   %esi
+  8005f2:	6a 00                	push   $0x0
+  8005f4:	e8 10 fc ff ff       	call   800209 <sys_page_unmap>
+	return r;
+  8005f9:	83 c4 10             	add    $0x10,%esp
+  8005fc:	eb b5                	jmp    8005b3 <fd_close+0x3c>
+
+008005fe <close>:
+
+int
+close(int fdnum)
+{
+  8005fe:	55                   	push   %ebp
+  8005ff:	89 e5                	mov    %esp,%ebp
+  800601:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800604:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800607:	50                   	push   %eax
+  800608:	ff 75 08             	push   0x8(%ebp)
+  80060b:	e8 c4 fe ff ff       	call   8004d4 <fd_lookup>
+  800610:	83 c4 10             	add    $0x10,%esp
+  800613:	85 c0                	test   %eax,%eax
+  800615:	79 02                	jns    800619 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  800617:	c9                   	leave
+  800618:	c3                   	ret
+		return fd_close(fd, 1);
+  800619:	83 ec 08             	sub    $0x8,%esp
+  80061c:	6a 01                	push   $0x1
+  80061e:	ff 75 f4             	push   -0xc(%ebp)
+  800621:	e8 51 ff ff ff       	call   800577 <fd_close>
+  800626:	83 c4 10             	add    $0x10,%esp
+  800629:	eb ec                	jmp    800617 <close+0x19>
+
+0080062b <close_all>:
+
+void
+close_all(void)
+{
+  80062b:	55                   	push   %ebp
+  80062c:	89 e5                	mov    %esp,%ebp
+  80062e:	53                   	push   %ebx
+  80062f:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  800632:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  800637:	83 ec 0c             	sub    $0xc,%esp
+  80063a:	53                   	push   %ebx
+  80063b:	e8 be ff ff ff       	call   8005fe <close>
+	for (i = 0; i < MAXFD; i++)
+  800640:	83 c3 01             	add    $0x1,%ebx
+  800643:	83 c4 10             	add    $0x10,%esp
+  800646:	83 fb 20             	cmp    $0x20,%ebx
+  800649:	75 ec                	jne    800637 <close_all+0xc>
+}
+  80064b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80064e:	c9                   	leave
+  80064f:	c3                   	ret
+
+00800650 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  800650:	55                   	push   %ebp
+  800651:	89 e5                	mov    %esp,%ebp
+  800653:	57                   	push   %edi
+  800654:	56                   	push   %esi
+  800655:	53                   	push   %ebx
+  800656:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800659:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80065c:	50                   	push   %eax
+  80065d:	ff 75 08             	push   0x8(%ebp)
+  800660:	e8 6f fe ff ff       	call   8004d4 <fd_lookup>
+  800665:	89 c3                	mov    %eax,%ebx
+  800667:	83 c4 10             	add    $0x10,%esp
+  80066a:	85 c0                	test   %eax,%eax
+  80066c:	78 7f                	js     8006ed <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80066e:	83 ec 0c             	sub    $0xc,%esp
+  800671:	ff 75 0c             	push   0xc(%ebp)
+  800674:	e8 85 ff ff ff       	call   8005fe <close>
+
+	newfd = INDEX2FD(newfdnum);
+  800679:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80067c:	c1 e6 0c             	shl    $0xc,%esi
+  80067f:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  800685:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800688:	89 3c 24             	mov    %edi,(%esp)
+  80068b:	e8 d7 fd ff ff       	call   800467 <fd2data>
+  800690:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  800692:	89 34 24             	mov    %esi,(%esp)
+  800695:	e8 cd fd ff ff       	call   800467 <fd2data>
+  80069a:	83 c4 10             	add    $0x10,%esp
+  80069d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8006a0:	89 d8                	mov    %ebx,%eax
+  8006a2:	c1 e8 16             	shr    $0x16,%eax
+  8006a5:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8006ac:	a8 01                	test   $0x1,%al
+  8006ae:	74 11                	je     8006c1 <dup+0x71>
+  8006b0:	89 d8                	mov    %ebx,%eax
+  8006b2:	c1 e8 0c             	shr    $0xc,%eax
+  8006b5:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8006bc:	f6 c2 01             	test   $0x1,%dl
+  8006bf:	75 36                	jne    8006f7 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8006c1:	89 f8                	mov    %edi,%eax
+  8006c3:	c1 e8 0c             	shr    $0xc,%eax
+  8006c6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8006cd:	83 ec 0c             	sub    $0xc,%esp
+  8006d0:	25 07 0e 00 00       	and    $0xe07,%eax
+  8006d5:	50                   	push   %eax
+  8006d6:	56                   	push   %esi
+  8006d7:	6a 00                	push   $0x0
+  8006d9:	57                   	push   %edi
+  8006da:	6a 00                	push   $0x0
+  8006dc:	e8 e6 fa ff ff       	call   8001c7 <sys_page_map>
+  8006e1:	89 c3                	mov    %eax,%ebx
+  8006e3:	83 c4 20             	add    $0x20,%esp
+  8006e6:	85 c0                	test   %eax,%eax
+  8006e8:	78 33                	js     80071d <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8006ea:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8006ed:	89 d8                	mov    %ebx,%eax
+  8006ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006f2:	5b                   	pop    %ebx
+  8006f3:	5e                   	pop    %esi
+  8006f4:	5f                   	pop    %edi
+  8006f5:	5d                   	pop    %ebp
+  8006f6:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8006f7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8006fe:	83 ec 0c             	sub    $0xc,%esp
+  800701:	25 07 0e 00 00       	and    $0xe07,%eax
+  800706:	50                   	push   %eax
+  800707:	ff 75 d4             	push   -0x2c(%ebp)
+  80070a:	6a 00                	push   $0x0
+  80070c:	53                   	push   %ebx
+  80070d:	6a 00                	push   $0x0
+  80070f:	e8 b3 fa ff ff       	call   8001c7 <sys_page_map>
+  800714:	89 c3                	mov    %eax,%ebx
+  800716:	83 c4 20             	add    $0x20,%esp
+  800719:	85 c0                	test   %eax,%eax
+  80071b:	79 a4                	jns    8006c1 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80071d:	83 ec 08             	sub    $0x8,%esp
+  800720:	56                   	push   %esi
+  800721:	6a 00                	push   $0x0
+  800723:	e8 e1 fa ff ff       	call   800209 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  800728:	83 c4 08             	add    $0x8,%esp
+  80072b:	ff 75 d4             	push   -0x2c(%ebp)
+  80072e:	6a 00                	push   $0x0
+  800730:	e8 d4 fa ff ff       	call   800209 <sys_page_unmap>
+	return r;
+  800735:	83 c4 10             	add    $0x10,%esp
+  800738:	eb b3                	jmp    8006ed <dup+0x9d>
+
+0080073a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80073a:	55                   	push   %ebp
+  80073b:	89 e5                	mov    %esp,%ebp
+  80073d:	56                   	push   %esi
+  80073e:	53                   	push   %ebx
+  80073f:	83 ec 18             	sub    $0x18,%esp
+  800742:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800745:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800748:	50                   	push   %eax
+  800749:	56                   	push   %esi
+  80074a:	e8 85 fd ff ff       	call   8004d4 <fd_lookup>
+  80074f:	83 c4 10             	add    $0x10,%esp
+  800752:	85 c0                	test   %eax,%eax
+  800754:	78 3c                	js     800792 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800756:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  800759:	83 ec 08             	sub    $0x8,%esp
+  80075c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80075f:	50                   	push   %eax
+  800760:	ff 33                	push   (%ebx)
+  800762:	e8 bd fd ff ff       	call   800524 <dev_lookup>
+  800767:	83 c4 10             	add    $0x10,%esp
+  80076a:	85 c0                	test   %eax,%eax
+  80076c:	78 24                	js     800792 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80076e:	8b 43 08             	mov    0x8(%ebx),%eax
+  800771:	83 e0 03             	and    $0x3,%eax
+  800774:	83 f8 01             	cmp    $0x1,%eax
+  800777:	74 20                	je     800799 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  800779:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80077c:	8b 40 08             	mov    0x8(%eax),%eax
+  80077f:	85 c0                	test   %eax,%eax
+  800781:	74 37                	je     8007ba <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  800783:	83 ec 04             	sub    $0x4,%esp
+  800786:	ff 75 10             	push   0x10(%ebp)
+  800789:	ff 75 0c             	push   0xc(%ebp)
+  80078c:	53                   	push   %ebx
+  80078d:	ff d0                	call   *%eax
+  80078f:	83 c4 10             	add    $0x10,%esp
+}
+  800792:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800795:	5b                   	pop    %ebx
+  800796:	5e                   	pop    %esi
+  800797:	5d                   	pop    %ebp
+  800798:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800799:	a1 08 40 80 00       	mov    0x804008,%eax
+  80079e:	8b 40 48             	mov    0x48(%eax),%eax
+  8007a1:	83 ec 04             	sub    $0x4,%esp
+  8007a4:	56                   	push   %esi
+  8007a5:	50                   	push   %eax
+  8007a6:	68 99 25 80 00       	push   $0x802599
+  8007ab:	e8 93 0e 00 00       	call   801643 <cprintf>
+		return -E_INVAL;
+  8007b0:	83 c4 10             	add    $0x10,%esp
+  8007b3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007b8:	eb d8                	jmp    800792 <read+0x58>
+		return -E_NOT_SUPP;
+  8007ba:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8007bf:	eb d1                	jmp    800792 <read+0x58>
+
+008007c1 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8007c1:	55                   	push   %ebp
+  8007c2:	89 e5                	mov    %esp,%ebp
+  8007c4:	57                   	push   %edi
+  8007c5:	56                   	push   %esi
+  8007c6:	53                   	push   %ebx
+  8007c7:	83 ec 0c             	sub    $0xc,%esp
+  8007ca:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8007cd:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8007d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8007d5:	eb 02                	jmp    8007d9 <readn+0x18>
+  8007d7:	01 c3                	add    %eax,%ebx
+  8007d9:	39 f3                	cmp    %esi,%ebx
+  8007db:	73 21                	jae    8007fe <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8007dd:	83 ec 04             	sub    $0x4,%esp
+  8007e0:	89 f0                	mov    %esi,%eax
+  8007e2:	29 d8                	sub    %ebx,%eax
+  8007e4:	50                   	push   %eax
+  8007e5:	89 d8                	mov    %ebx,%eax
+  8007e7:	03 45 0c             	add    0xc(%ebp),%eax
+  8007ea:	50                   	push   %eax
+  8007eb:	57                   	push   %edi
+  8007ec:	e8 49 ff ff ff       	call   80073a <read>
+		if (m < 0)
+  8007f1:	83 c4 10             	add    $0x10,%esp
+  8007f4:	85 c0                	test   %eax,%eax
+  8007f6:	78 04                	js     8007fc <readn+0x3b>
+			return m;
+		if (m == 0)
+  8007f8:	75 dd                	jne    8007d7 <readn+0x16>
+  8007fa:	eb 02                	jmp    8007fe <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8007fc:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8007fe:	89 d8                	mov    %ebx,%eax
+  800800:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800803:	5b                   	pop    %ebx
+  800804:	5e                   	pop    %esi
+  800805:	5f                   	pop    %edi
+  800806:	5d                   	pop    %ebp
+  800807:	c3                   	ret
+
+00800808 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  800808:	55                   	push   %ebp
+  800809:	89 e5                	mov    %esp,%ebp
+  80080b:	56                   	push   %esi
+  80080c:	53                   	push   %ebx
+  80080d:	83 ec 18             	sub    $0x18,%esp
+  800810:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800813:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800816:	50                   	push   %eax
+  800817:	53                   	push   %ebx
+  800818:	e8 b7 fc ff ff       	call   8004d4 <fd_lookup>
+  80081d:	83 c4 10             	add    $0x10,%esp
+  800820:	85 c0                	test   %eax,%eax
+  800822:	78 37                	js     80085b <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800824:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800827:	83 ec 08             	sub    $0x8,%esp
+  80082a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80082d:	50                   	push   %eax
+  80082e:	ff 36                	push   (%esi)
+  800830:	e8 ef fc ff ff       	call   800524 <dev_lookup>
+  800835:	83 c4 10             	add    $0x10,%esp
+  800838:	85 c0                	test   %eax,%eax
+  80083a:	78 1f                	js     80085b <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80083c:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800840:	74 20                	je     800862 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  800842:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800845:	8b 40 0c             	mov    0xc(%eax),%eax
+  800848:	85 c0                	test   %eax,%eax
+  80084a:	74 37                	je     800883 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80084c:	83 ec 04             	sub    $0x4,%esp
+  80084f:	ff 75 10             	push   0x10(%ebp)
+  800852:	ff 75 0c             	push   0xc(%ebp)
+  800855:	56                   	push   %esi
+  800856:	ff d0                	call   *%eax
+  800858:	83 c4 10             	add    $0x10,%esp
+}
+  80085b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80085e:	5b                   	pop    %ebx
+  80085f:	5e                   	pop    %esi
+  800860:	5d                   	pop    %ebp
+  800861:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800862:	a1 08 40 80 00       	mov    0x804008,%eax
+  800867:	8b 40 48             	mov    0x48(%eax),%eax
+  80086a:	83 ec 04             	sub    $0x4,%esp
+  80086d:	53                   	push   %ebx
+  80086e:	50                   	push   %eax
+  80086f:	68 b5 25 80 00       	push   $0x8025b5
+  800874:	e8 ca 0d 00 00       	call   801643 <cprintf>
+		return -E_INVAL;
+  800879:	83 c4 10             	add    $0x10,%esp
+  80087c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800881:	eb d8                	jmp    80085b <write+0x53>
+		return -E_NOT_SUPP;
+  800883:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800888:	eb d1                	jmp    80085b <write+0x53>
+
+0080088a <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80088a:	55                   	push   %ebp
+  80088b:	89 e5                	mov    %esp,%ebp
+  80088d:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800890:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800893:	50                   	push   %eax
+  800894:	ff 75 08             	push   0x8(%ebp)
+  800897:	e8 38 fc ff ff       	call   8004d4 <fd_lookup>
+  80089c:	83 c4 10             	add    $0x10,%esp
+  80089f:	85 c0                	test   %eax,%eax
+  8008a1:	78 0e                	js     8008b1 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8008a3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008a6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008a9:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8008ac:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008b1:	c9                   	leave
+  8008b2:	c3                   	ret
+
+008008b3 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8008b3:	55                   	push   %ebp
+  8008b4:	89 e5                	mov    %esp,%ebp
+  8008b6:	56                   	push   %esi
+  8008b7:	53                   	push   %ebx
+  8008b8:	83 ec 18             	sub    $0x18,%esp
+  8008bb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8008be:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8008c1:	50                   	push   %eax
+  8008c2:	53                   	push   %ebx
+  8008c3:	e8 0c fc ff ff       	call   8004d4 <fd_lookup>
+  8008c8:	83 c4 10             	add    $0x10,%esp
+  8008cb:	85 c0                	test   %eax,%eax
+  8008cd:	78 34                	js     800903 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8008cf:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8008d2:	83 ec 08             	sub    $0x8,%esp
+  8008d5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8008d8:	50                   	push   %eax
+  8008d9:	ff 36                	push   (%esi)
+  8008db:	e8 44 fc ff ff       	call   800524 <dev_lookup>
+  8008e0:	83 c4 10             	add    $0x10,%esp
+  8008e3:	85 c0                	test   %eax,%eax
+  8008e5:	78 1c                	js     800903 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8008e7:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8008eb:	74 1d                	je     80090a <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8008ed:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008f0:	8b 40 18             	mov    0x18(%eax),%eax
+  8008f3:	85 c0                	test   %eax,%eax
+  8008f5:	74 34                	je     80092b <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8008f7:	83 ec 08             	sub    $0x8,%esp
+  8008fa:	ff 75 0c             	push   0xc(%ebp)
+  8008fd:	56                   	push   %esi
+  8008fe:	ff d0                	call   *%eax
+  800900:	83 c4 10             	add    $0x10,%esp
+}
+  800903:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800906:	5b                   	pop    %ebx
+  800907:	5e                   	pop    %esi
+  800908:	5d                   	pop    %ebp
+  800909:	c3                   	ret
+			thisenv->env_id, fdnum);
+  80090a:	a1 08 40 80 00       	mov    0x804008,%eax
+  80090f:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800912:	83 ec 04             	sub    $0x4,%esp
+  800915:	53                   	push   %ebx
+  800916:	50                   	push   %eax
+  800917:	68 78 25 80 00       	push   $0x802578
+  80091c:	e8 22 0d 00 00       	call   801643 <cprintf>
+		return -E_INVAL;
+  800921:	83 c4 10             	add    $0x10,%esp
+  800924:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800929:	eb d8                	jmp    800903 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  80092b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800930:	eb d1                	jmp    800903 <ftruncate+0x50>
+
+00800932 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800932:	55                   	push   %ebp
+  800933:	89 e5                	mov    %esp,%ebp
+  800935:	56                   	push   %esi
+  800936:	53                   	push   %ebx
+  800937:	83 ec 18             	sub    $0x18,%esp
+  80093a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80093d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800940:	50                   	push   %eax
+  800941:	ff 75 08             	push   0x8(%ebp)
+  800944:	e8 8b fb ff ff       	call   8004d4 <fd_lookup>
+  800949:	83 c4 10             	add    $0x10,%esp
+  80094c:	85 c0                	test   %eax,%eax
+  80094e:	78 49                	js     800999 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800950:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800953:	83 ec 08             	sub    $0x8,%esp
+  800956:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800959:	50                   	push   %eax
+  80095a:	ff 36                	push   (%esi)
+  80095c:	e8 c3 fb ff ff       	call   800524 <dev_lookup>
+  800961:	83 c4 10             	add    $0x10,%esp
+  800964:	85 c0                	test   %eax,%eax
+  800966:	78 31                	js     800999 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  800968:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80096b:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80096f:	74 2f                	je     8009a0 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  800971:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  800974:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80097b:	00 00 00 
+	stat->st_isdir = 0;
+  80097e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800985:	00 00 00 
+	stat->st_dev = dev;
+  800988:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80098e:	83 ec 08             	sub    $0x8,%esp
+  800991:	53                   	push   %ebx
+  800992:	56                   	push   %esi
+  800993:	ff 50 14             	call   *0x14(%eax)
+  800996:	83 c4 10             	add    $0x10,%esp
+}
+  800999:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80099c:	5b                   	pop    %ebx
+  80099d:	5e                   	pop    %esi
+  80099e:	5d                   	pop    %ebp
+  80099f:	c3                   	ret
+		return -E_NOT_SUPP;
+  8009a0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8009a5:	eb f2                	jmp    800999 <fstat+0x67>
+
+008009a7 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8009a7:	55                   	push   %ebp
+  8009a8:	89 e5                	mov    %esp,%ebp
+  8009aa:	56                   	push   %esi
+  8009ab:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8009ac:	83 ec 08             	sub    $0x8,%esp
+  8009af:	6a 00                	push   $0x0
+  8009b1:	ff 75 08             	push   0x8(%ebp)
+  8009b4:	e8 e4 01 00 00       	call   800b9d <open>
+  8009b9:	89 c3                	mov    %eax,%ebx
+  8009bb:	83 c4 10             	add    $0x10,%esp
+  8009be:	85 c0                	test   %eax,%eax
+  8009c0:	78 1b                	js     8009dd <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8009c2:	83 ec 08             	sub    $0x8,%esp
+  8009c5:	ff 75 0c             	push   0xc(%ebp)
+  8009c8:	50                   	push   %eax
+  8009c9:	e8 64 ff ff ff       	call   800932 <fstat>
+  8009ce:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8009d0:	89 1c 24             	mov    %ebx,(%esp)
+  8009d3:	e8 26 fc ff ff       	call   8005fe <close>
+	return r;
+  8009d8:	83 c4 10             	add    $0x10,%esp
+  8009db:	89 f3                	mov    %esi,%ebx
+}
+  8009dd:	89 d8                	mov    %ebx,%eax
+  8009df:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8009e2:	5b                   	pop    %ebx
+  8009e3:	5e                   	pop    %esi
+  8009e4:	5d                   	pop    %ebp
+  8009e5:	c3                   	ret
+
+008009e6 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  8009e6:	55                   	push   %ebp
+  8009e7:	89 e5                	mov    %esp,%ebp
+  8009e9:	56                   	push   %esi
+  8009ea:	53                   	push   %ebx
+  8009eb:	89 c6                	mov    %eax,%esi
+  8009ed:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  8009ef:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  8009f6:	74 27                	je     800a1f <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8009f8:	6a 07                	push   $0x7
+  8009fa:	68 00 50 80 00       	push   $0x805000
+  8009ff:	56                   	push   %esi
+  800a00:	ff 35 00 40 80 00    	push   0x804000
+  800a06:	e8 95 15 00 00       	call   801fa0 <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  800a0b:	83 c4 0c             	add    $0xc,%esp
+  800a0e:	6a 00                	push   $0x0
+  800a10:	53                   	push   %ebx
+  800a11:	6a 00                	push   $0x0
+  800a13:	e8 14 15 00 00       	call   801f2c <ipc_recv>
+}
+  800a18:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800a1b:	5b                   	pop    %ebx
+  800a1c:	5e                   	pop    %esi
+  800a1d:	5d                   	pop    %ebp
+  800a1e:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  800a1f:	83 ec 0c             	sub    $0xc,%esp
+  800a22:	6a 01                	push   $0x1
+  800a24:	e8 cb 15 00 00       	call   801ff4 <ipc_find_env>
+  800a29:	a3 00 40 80 00       	mov    %eax,0x804000
+  800a2e:	83 c4 10             	add    $0x10,%esp
+  800a31:	eb c5                	jmp    8009f8 <fsipc+0x12>
+
+00800a33 <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  800a33:	55                   	push   %ebp
+  800a34:	89 e5                	mov    %esp,%ebp
+  800a36:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800a39:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a3c:	8b 40 0c             	mov    0xc(%eax),%eax
+  800a3f:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.set_size.req_size = newsize;
+  800a44:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a47:	a3 04 50 80 00       	mov    %eax,0x805004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  800a4c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a51:	b8 02 00 00 00       	mov    $0x2,%eax
+  800a56:	e8 8b ff ff ff       	call   8009e6 <fsipc>
+}
+  800a5b:	c9                   	leave
+  800a5c:	c3                   	ret
+
+00800a5d <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  800a5d:	55                   	push   %ebp
+  800a5e:	89 e5                	mov    %esp,%ebp
+  800a60:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800a63:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a66:	8b 40 0c             	mov    0xc(%eax),%eax
+  800a69:	a3 00 50 80 00       	mov    %eax,0x805000
+  return fsipc(FSREQ_FLUSH, NULL);
+  800a6e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a73:	b8 06 00 00 00       	mov    $0x6,%eax
+  800a78:	e8 69 ff ff ff       	call   8009e6 <fsipc>
+}
+  800a7d:	c9                   	leave
+  800a7e:	c3                   	ret
+
+00800a7f <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  800a7f:	55                   	push   %ebp
+  800a80:	89 e5                	mov    %esp,%ebp
+  800a82:	53                   	push   %ebx
+  800a83:	83 ec 04             	sub    $0x4,%esp
+  800a86:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800a89:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a8c:	8b 40 0c             	mov    0xc(%eax),%eax
+  800a8f:	a3 00 50 80 00       	mov    %eax,0x805000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  800a94:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a99:	b8 05 00 00 00       	mov    $0x5,%eax
+  800a9e:	e8 43 ff ff ff       	call   8009e6 <fsipc>
+  800aa3:	85 c0                	test   %eax,%eax
+  800aa5:	78 2c                	js     800ad3 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800aa7:	83 ec 08             	sub    $0x8,%esp
+  800aaa:	68 00 50 80 00       	push   $0x805000
+  800aaf:	53                   	push   %ebx
+  800ab0:	e8 47 11 00 00       	call   801bfc <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  800ab5:	a1 80 50 80 00       	mov    0x805080,%eax
+  800aba:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800ac0:	a1 84 50 80 00       	mov    0x805084,%eax
+  800ac5:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  800acb:	83 c4 10             	add    $0x10,%esp
+  800ace:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ad3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ad6:	c9                   	leave
+  800ad7:	c3                   	ret
+
+00800ad8 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  800ad8:	55                   	push   %ebp
+  800ad9:	89 e5                	mov    %esp,%ebp
+  800adb:	83 ec 0c             	sub    $0xc,%esp
+  800ade:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800ae1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ae4:	8b 52 0c             	mov    0xc(%edx),%edx
+  800ae7:	89 15 00 50 80 00    	mov    %edx,0x805000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  800aed:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  800af2:	39 d0                	cmp    %edx,%eax
+  800af4:	0f 47 c2             	cmova  %edx,%eax
+  800af7:	a3 04 50 80 00       	mov    %eax,0x805004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  800afc:	50                   	push   %eax
+  800afd:	ff 75 0c             	push   0xc(%ebp)
+  800b00:	68 08 50 80 00       	push   $0x805008
+  800b05:	e8 78 12 00 00       	call   801d82 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  800b0a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b0f:	b8 04 00 00 00       	mov    $0x4,%eax
+  800b14:	e8 cd fe ff ff       	call   8009e6 <fsipc>
+}
+  800b19:	c9                   	leave
+  800b1a:	c3                   	ret
+
+00800b1b <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  800b1b:	55                   	push   %ebp
+  800b1c:	89 e5                	mov    %esp,%ebp
+  800b1e:	56                   	push   %esi
+  800b1f:	53                   	push   %ebx
+  800b20:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800b23:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b26:	8b 40 0c             	mov    0xc(%eax),%eax
+  800b29:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.read.req_n = n;
+  800b2e:	89 35 04 50 80 00    	mov    %esi,0x805004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  800b34:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b39:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b3e:	e8 a3 fe ff ff       	call   8009e6 <fsipc>
+  800b43:	89 c3                	mov    %eax,%ebx
+  800b45:	85 c0                	test   %eax,%eax
+  800b47:	78 1f                	js     800b68 <devfile_read+0x4d>
+  assert(r <= n);
+  800b49:	39 c6                	cmp    %eax,%esi
+  800b4b:	72 24                	jb     800b71 <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  800b4d:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800b52:	7f 33                	jg     800b87 <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  800b54:	83 ec 04             	sub    $0x4,%esp
+  800b57:	50                   	push   %eax
+  800b58:	68 00 50 80 00       	push   $0x805000
+  800b5d:	ff 75 0c             	push   0xc(%ebp)
+  800b60:	e8 1d 12 00 00       	call   801d82 <memmove>
+  return r;
+  800b65:	83 c4 10             	add    $0x10,%esp
+}
+  800b68:	89 d8                	mov    %ebx,%eax
+  800b6a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b6d:	5b                   	pop    %ebx
+  800b6e:	5e                   	pop    %esi
+  800b6f:	5d                   	pop    %ebp
+  800b70:	c3                   	ret
+  assert(r <= n);
+  800b71:	68 e8 25 80 00       	push   $0x8025e8
+  800b76:	68 ef 25 80 00       	push   $0x8025ef
+  800b7b:	6a 78                	push   $0x78
+  800b7d:	68 04 26 80 00       	push   $0x802604
+  800b82:	e8 e1 09 00 00       	call   801568 <_panic>
+  assert(r <= PGSIZE);
+  800b87:	68 0f 26 80 00       	push   $0x80260f
+  800b8c:	68 ef 25 80 00       	push   $0x8025ef
+  800b91:	6a 79                	push   $0x79
+  800b93:	68 04 26 80 00       	push   $0x802604
+  800b98:	e8 cb 09 00 00       	call   801568 <_panic>
+
+00800b9d <open>:
+open(const char *path, int mode) {
+  800b9d:	55                   	push   %ebp
+  800b9e:	89 e5                	mov    %esp,%ebp
+  800ba0:	56                   	push   %esi
+  800ba1:	53                   	push   %ebx
+  800ba2:	83 ec 1c             	sub    $0x1c,%esp
+  800ba5:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  800ba8:	56                   	push   %esi
+  800ba9:	e8 13 10 00 00       	call   801bc1 <strlen>
+  800bae:	83 c4 10             	add    $0x10,%esp
+  800bb1:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800bb6:	7f 6c                	jg     800c24 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  800bb8:	83 ec 0c             	sub    $0xc,%esp
+  800bbb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800bbe:	50                   	push   %eax
+  800bbf:	e8 ba f8 ff ff       	call   80047e <fd_alloc>
+  800bc4:	89 c3                	mov    %eax,%ebx
+  800bc6:	83 c4 10             	add    $0x10,%esp
+  800bc9:	85 c0                	test   %eax,%eax
+  800bcb:	78 3c                	js     800c09 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  800bcd:	83 ec 08             	sub    $0x8,%esp
+  800bd0:	56                   	push   %esi
+  800bd1:	68 00 50 80 00       	push   $0x805000
+  800bd6:	e8 21 10 00 00       	call   801bfc <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  800bdb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bde:	a3 00 54 80 00       	mov    %eax,0x805400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  800be3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  800be6:	b8 01 00 00 00       	mov    $0x1,%eax
+  800beb:	e8 f6 fd ff ff       	call   8009e6 <fsipc>
+  800bf0:	89 c3                	mov    %eax,%ebx
+  800bf2:	83 c4 10             	add    $0x10,%esp
+  800bf5:	85 c0                	test   %eax,%eax
+  800bf7:	78 19                	js     800c12 <open+0x75>
+  return fd2num(fd);
+  800bf9:	83 ec 0c             	sub    $0xc,%esp
+  800bfc:	ff 75 f4             	push   -0xc(%ebp)
+  800bff:	e8 53 f8 ff ff       	call   800457 <fd2num>
+  800c04:	89 c3                	mov    %eax,%ebx
+  800c06:	83 c4 10             	add    $0x10,%esp
+}
+  800c09:	89 d8                	mov    %ebx,%eax
+  800c0b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c0e:	5b                   	pop    %ebx
+  800c0f:	5e                   	pop    %esi
+  800c10:	5d                   	pop    %ebp
+  800c11:	c3                   	ret
+    fd_close(fd, 0);
+  800c12:	83 ec 08             	sub    $0x8,%esp
+  800c15:	6a 00                	push   $0x0
+  800c17:	ff 75 f4             	push   -0xc(%ebp)
+  800c1a:	e8 58 f9 ff ff       	call   800577 <fd_close>
+    return r;
+  800c1f:	83 c4 10             	add    $0x10,%esp
+  800c22:	eb e5                	jmp    800c09 <open+0x6c>
+    return -E_BAD_PATH;
+  800c24:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  800c29:	eb de                	jmp    800c09 <open+0x6c>
+
+00800c2b <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  800c2b:	55                   	push   %ebp
+  800c2c:	89 e5                	mov    %esp,%ebp
+  800c2e:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  800c31:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c36:	b8 08 00 00 00       	mov    $0x8,%eax
+  800c3b:	e8 a6 fd ff ff       	call   8009e6 <fsipc>
+}
+  800c40:	c9                   	leave
+  800c41:	c3                   	ret
+
+00800c42 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  800c42:	55                   	push   %ebp
+  800c43:	89 e5                	mov    %esp,%ebp
+  800c45:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  800c48:	68 1b 26 80 00       	push   $0x80261b
+  800c4d:	ff 75 0c             	push   0xc(%ebp)
+  800c50:	e8 a7 0f 00 00       	call   801bfc <strcpy>
+	return 0;
+}
+  800c55:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c5a:	c9                   	leave
+  800c5b:	c3                   	ret
+
+00800c5c <devsock_close>:
+{
+  800c5c:	55                   	push   %ebp
+  800c5d:	89 e5                	mov    %esp,%ebp
+  800c5f:	53                   	push   %ebx
+  800c60:	83 ec 10             	sub    $0x10,%esp
+  800c63:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  800c66:	53                   	push   %ebx
+  800c67:	e8 c7 13 00 00       	call   802033 <pageref>
+  800c6c:	89 c2                	mov    %eax,%edx
+  800c6e:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  800c71:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  800c76:	83 fa 01             	cmp    $0x1,%edx
+  800c79:	74 05                	je     800c80 <devsock_close+0x24>
+}
+  800c7b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c7e:	c9                   	leave
+  800c7f:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  800c80:	83 ec 0c             	sub    $0xc,%esp
+  800c83:	ff 73 0c             	push   0xc(%ebx)
+  800c86:	e8 b7 02 00 00       	call   800f42 <nsipc_close>
+  800c8b:	83 c4 10             	add    $0x10,%esp
+  800c8e:	eb eb                	jmp    800c7b <devsock_close+0x1f>
+
+00800c90 <devsock_write>:
+{
+  800c90:	55                   	push   %ebp
+  800c91:	89 e5                	mov    %esp,%ebp
+  800c93:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  800c96:	6a 00                	push   $0x0
+  800c98:	ff 75 10             	push   0x10(%ebp)
+  800c9b:	ff 75 0c             	push   0xc(%ebp)
+  800c9e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ca1:	ff 70 0c             	push   0xc(%eax)
+  800ca4:	e8 79 03 00 00       	call   801022 <nsipc_send>
+}
+  800ca9:	c9                   	leave
+  800caa:	c3                   	ret
+
+00800cab <devsock_read>:
+{
+  800cab:	55                   	push   %ebp
+  800cac:	89 e5                	mov    %esp,%ebp
+  800cae:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  800cb1:	6a 00                	push   $0x0
+  800cb3:	ff 75 10             	push   0x10(%ebp)
+  800cb6:	ff 75 0c             	push   0xc(%ebp)
+  800cb9:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cbc:	ff 70 0c             	push   0xc(%eax)
+  800cbf:	e8 ef 02 00 00       	call   800fb3 <nsipc_recv>
+}
+  800cc4:	c9                   	leave
+  800cc5:	c3                   	ret
+
+00800cc6 <fd2sockid>:
+{
+  800cc6:	55                   	push   %ebp
+  800cc7:	89 e5                	mov    %esp,%ebp
+  800cc9:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  800ccc:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  800ccf:	52                   	push   %edx
+  800cd0:	50                   	push   %eax
+  800cd1:	e8 fe f7 ff ff       	call   8004d4 <fd_lookup>
+  800cd6:	83 c4 10             	add    $0x10,%esp
+  800cd9:	85 c0                	test   %eax,%eax
+  800cdb:	78 10                	js     800ced <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  800cdd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ce0:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  800ce6:	39 08                	cmp    %ecx,(%eax)
+  800ce8:	75 05                	jne    800cef <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  800cea:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  800ced:	c9                   	leave
+  800cee:	c3                   	ret
+		return -E_NOT_SUPP;
+  800cef:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800cf4:	eb f7                	jmp    800ced <fd2sockid+0x27>
+
+00800cf6 <alloc_sockfd>:
+{
+  800cf6:	55                   	push   %ebp
+  800cf7:	89 e5                	mov    %esp,%ebp
+  800cf9:	56                   	push   %esi
+  800cfa:	53                   	push   %ebx
+  800cfb:	83 ec 1c             	sub    $0x1c,%esp
+  800cfe:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  800d00:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800d03:	50                   	push   %eax
+  800d04:	e8 75 f7 ff ff       	call   80047e <fd_alloc>
+  800d09:	89 c3                	mov    %eax,%ebx
+  800d0b:	83 c4 10             	add    $0x10,%esp
+  800d0e:	85 c0                	test   %eax,%eax
+  800d10:	78 43                	js     800d55 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  800d12:	83 ec 04             	sub    $0x4,%esp
+  800d15:	68 07 04 00 00       	push   $0x407
+  800d1a:	ff 75 f4             	push   -0xc(%ebp)
+  800d1d:	6a 00                	push   $0x0
+  800d1f:	e8 60 f4 ff ff       	call   800184 <sys_page_alloc>
+  800d24:	89 c3                	mov    %eax,%ebx
+  800d26:	83 c4 10             	add    $0x10,%esp
+  800d29:	85 c0                	test   %eax,%eax
+  800d2b:	78 28                	js     800d55 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  800d2d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800d30:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  800d36:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  800d38:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800d3b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  800d42:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  800d45:	83 ec 0c             	sub    $0xc,%esp
+  800d48:	50                   	push   %eax
+  800d49:	e8 09 f7 ff ff       	call   800457 <fd2num>
+  800d4e:	89 c3                	mov    %eax,%ebx
+  800d50:	83 c4 10             	add    $0x10,%esp
+  800d53:	eb 0c                	jmp    800d61 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  800d55:	83 ec 0c             	sub    $0xc,%esp
+  800d58:	56                   	push   %esi
+  800d59:	e8 e4 01 00 00       	call   800f42 <nsipc_close>
+		return r;
+  800d5e:	83 c4 10             	add    $0x10,%esp
+}
+  800d61:	89 d8                	mov    %ebx,%eax
+  800d63:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d66:	5b                   	pop    %ebx
+  800d67:	5e                   	pop    %esi
+  800d68:	5d                   	pop    %ebp
+  800d69:	c3                   	ret
+
+00800d6a <accept>:
+{
+  800d6a:	55                   	push   %ebp
+  800d6b:	89 e5                	mov    %esp,%ebp
+  800d6d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800d70:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d73:	e8 4e ff ff ff       	call   800cc6 <fd2sockid>
+  800d78:	85 c0                	test   %eax,%eax
+  800d7a:	78 1b                	js     800d97 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  800d7c:	83 ec 04             	sub    $0x4,%esp
+  800d7f:	ff 75 10             	push   0x10(%ebp)
+  800d82:	ff 75 0c             	push   0xc(%ebp)
+  800d85:	50                   	push   %eax
+  800d86:	e8 0e 01 00 00       	call   800e99 <nsipc_accept>
+  800d8b:	83 c4 10             	add    $0x10,%esp
+  800d8e:	85 c0                	test   %eax,%eax
+  800d90:	78 05                	js     800d97 <accept+0x2d>
+	return alloc_sockfd(r);
+  800d92:	e8 5f ff ff ff       	call   800cf6 <alloc_sockfd>
+}
+  800d97:	c9                   	leave
+  800d98:	c3                   	ret
+
+00800d99 <bind>:
+{
+  800d99:	55                   	push   %ebp
+  800d9a:	89 e5                	mov    %esp,%ebp
+  800d9c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800d9f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800da2:	e8 1f ff ff ff       	call   800cc6 <fd2sockid>
+  800da7:	85 c0                	test   %eax,%eax
+  800da9:	78 12                	js     800dbd <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  800dab:	83 ec 04             	sub    $0x4,%esp
+  800dae:	ff 75 10             	push   0x10(%ebp)
+  800db1:	ff 75 0c             	push   0xc(%ebp)
+  800db4:	50                   	push   %eax
+  800db5:	e8 31 01 00 00       	call   800eeb <nsipc_bind>
+  800dba:	83 c4 10             	add    $0x10,%esp
+}
+  800dbd:	c9                   	leave
+  800dbe:	c3                   	ret
+
+00800dbf <shutdown>:
+{
+  800dbf:	55                   	push   %ebp
+  800dc0:	89 e5                	mov    %esp,%ebp
+  800dc2:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800dc5:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dc8:	e8 f9 fe ff ff       	call   800cc6 <fd2sockid>
+  800dcd:	85 c0                	test   %eax,%eax
+  800dcf:	78 0f                	js     800de0 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  800dd1:	83 ec 08             	sub    $0x8,%esp
+  800dd4:	ff 75 0c             	push   0xc(%ebp)
+  800dd7:	50                   	push   %eax
+  800dd8:	e8 43 01 00 00       	call   800f20 <nsipc_shutdown>
+  800ddd:	83 c4 10             	add    $0x10,%esp
+}
+  800de0:	c9                   	leave
+  800de1:	c3                   	ret
+
+00800de2 <connect>:
+{
+  800de2:	55                   	push   %ebp
+  800de3:	89 e5                	mov    %esp,%ebp
+  800de5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800de8:	8b 45 08             	mov    0x8(%ebp),%eax
+  800deb:	e8 d6 fe ff ff       	call   800cc6 <fd2sockid>
+  800df0:	85 c0                	test   %eax,%eax
+  800df2:	78 12                	js     800e06 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  800df4:	83 ec 04             	sub    $0x4,%esp
+  800df7:	ff 75 10             	push   0x10(%ebp)
+  800dfa:	ff 75 0c             	push   0xc(%ebp)
+  800dfd:	50                   	push   %eax
+  800dfe:	e8 59 01 00 00       	call   800f5c <nsipc_connect>
+  800e03:	83 c4 10             	add    $0x10,%esp
+}
+  800e06:	c9                   	leave
+  800e07:	c3                   	ret
+
+00800e08 <listen>:
+{
+  800e08:	55                   	push   %ebp
+  800e09:	89 e5                	mov    %esp,%ebp
+  800e0b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800e0e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e11:	e8 b0 fe ff ff       	call   800cc6 <fd2sockid>
+  800e16:	85 c0                	test   %eax,%eax
+  800e18:	78 0f                	js     800e29 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  800e1a:	83 ec 08             	sub    $0x8,%esp
+  800e1d:	ff 75 0c             	push   0xc(%ebp)
+  800e20:	50                   	push   %eax
+  800e21:	e8 6b 01 00 00       	call   800f91 <nsipc_listen>
+  800e26:	83 c4 10             	add    $0x10,%esp
+}
+  800e29:	c9                   	leave
+  800e2a:	c3                   	ret
+
+00800e2b <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  800e2b:	55                   	push   %ebp
+  800e2c:	89 e5                	mov    %esp,%ebp
+  800e2e:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  800e31:	ff 75 10             	push   0x10(%ebp)
+  800e34:	ff 75 0c             	push   0xc(%ebp)
+  800e37:	ff 75 08             	push   0x8(%ebp)
+  800e3a:	e8 41 02 00 00       	call   801080 <nsipc_socket>
+  800e3f:	83 c4 10             	add    $0x10,%esp
+  800e42:	85 c0                	test   %eax,%eax
+  800e44:	78 05                	js     800e4b <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  800e46:	e8 ab fe ff ff       	call   800cf6 <alloc_sockfd>
+}
+  800e4b:	c9                   	leave
+  800e4c:	c3                   	ret
+
+00800e4d <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  800e4d:	55                   	push   %ebp
+  800e4e:	89 e5                	mov    %esp,%ebp
+  800e50:	53                   	push   %ebx
+  800e51:	83 ec 04             	sub    $0x4,%esp
+  800e54:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  800e56:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800e5d:	74 26                	je     800e85 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  800e5f:	6a 07                	push   $0x7
+  800e61:	68 00 60 80 00       	push   $0x806000
+  800e66:	53                   	push   %ebx
+  800e67:	ff 35 04 40 80 00    	push   0x804004
+  800e6d:	e8 2e 11 00 00       	call   801fa0 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  800e72:	83 c4 0c             	add    $0xc,%esp
+  800e75:	6a 00                	push   $0x0
+  800e77:	6a 00                	push   $0x0
+  800e79:	6a 00                	push   $0x0
+  800e7b:	e8 ac 10 00 00       	call   801f2c <ipc_recv>
+}
+  800e80:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e83:	c9                   	leave
+  800e84:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  800e85:	83 ec 0c             	sub    $0xc,%esp
+  800e88:	6a 02                	push   $0x2
+  800e8a:	e8 65 11 00 00       	call   801ff4 <ipc_find_env>
+  800e8f:	a3 04 40 80 00       	mov    %eax,0x804004
+  800e94:	83 c4 10             	add    $0x10,%esp
+  800e97:	eb c6                	jmp    800e5f <nsipc+0x12>
+
+00800e99 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  800e99:	55                   	push   %ebp
+  800e9a:	89 e5                	mov    %esp,%ebp
+  800e9c:	56                   	push   %esi
+  800e9d:	53                   	push   %ebx
+  800e9e:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  800ea1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ea4:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  800ea9:	8b 06                	mov    (%esi),%eax
+  800eab:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  800eb0:	b8 01 00 00 00       	mov    $0x1,%eax
+  800eb5:	e8 93 ff ff ff       	call   800e4d <nsipc>
+  800eba:	89 c3                	mov    %eax,%ebx
+  800ebc:	85 c0                	test   %eax,%eax
+  800ebe:	79 09                	jns    800ec9 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  800ec0:	89 d8                	mov    %ebx,%eax
+  800ec2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ec5:	5b                   	pop    %ebx
+  800ec6:	5e                   	pop    %esi
+  800ec7:	5d                   	pop    %ebp
+  800ec8:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  800ec9:	83 ec 04             	sub    $0x4,%esp
+  800ecc:	ff 35 10 60 80 00    	push   0x806010
+  800ed2:	68 00 60 80 00       	push   $0x806000
+  800ed7:	ff 75 0c             	push   0xc(%ebp)
+  800eda:	e8 a3 0e 00 00       	call   801d82 <memmove>
+		*addrlen = ret->ret_addrlen;
+  800edf:	a1 10 60 80 00       	mov    0x806010,%eax
+  800ee4:	89 06                	mov    %eax,(%esi)
+  800ee6:	83 c4 10             	add    $0x10,%esp
+	return r;
+  800ee9:	eb d5                	jmp    800ec0 <nsipc_accept+0x27>
+
+00800eeb <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  800eeb:	55                   	push   %ebp
+  800eec:	89 e5                	mov    %esp,%ebp
+  800eee:	53                   	push   %ebx
+  800eef:	83 ec 08             	sub    $0x8,%esp
+  800ef2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  800ef5:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ef8:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  800efd:	53                   	push   %ebx
+  800efe:	ff 75 0c             	push   0xc(%ebp)
+  800f01:	68 04 60 80 00       	push   $0x806004
+  800f06:	e8 77 0e 00 00       	call   801d82 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  800f0b:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  800f11:	b8 02 00 00 00       	mov    $0x2,%eax
+  800f16:	e8 32 ff ff ff       	call   800e4d <nsipc>
+}
+  800f1b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f1e:	c9                   	leave
+  800f1f:	c3                   	ret
+
+00800f20 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  800f20:	55                   	push   %ebp
+  800f21:	89 e5                	mov    %esp,%ebp
+  800f23:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  800f26:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f29:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  800f2e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f31:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  800f36:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f3b:	e8 0d ff ff ff       	call   800e4d <nsipc>
+}
+  800f40:	c9                   	leave
+  800f41:	c3                   	ret
+
+00800f42 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  800f42:	55                   	push   %ebp
+  800f43:	89 e5                	mov    %esp,%ebp
+  800f45:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  800f48:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f4b:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  800f50:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f55:	e8 f3 fe ff ff       	call   800e4d <nsipc>
+}
+  800f5a:	c9                   	leave
+  800f5b:	c3                   	ret
+
+00800f5c <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  800f5c:	55                   	push   %ebp
+  800f5d:	89 e5                	mov    %esp,%ebp
+  800f5f:	53                   	push   %ebx
+  800f60:	83 ec 08             	sub    $0x8,%esp
+  800f63:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  800f66:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f69:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  800f6e:	53                   	push   %ebx
+  800f6f:	ff 75 0c             	push   0xc(%ebp)
+  800f72:	68 04 60 80 00       	push   $0x806004
+  800f77:	e8 06 0e 00 00       	call   801d82 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  800f7c:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  800f82:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f87:	e8 c1 fe ff ff       	call   800e4d <nsipc>
+}
+  800f8c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f8f:	c9                   	leave
+  800f90:	c3                   	ret
+
+00800f91 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  800f91:	55                   	push   %ebp
+  800f92:	89 e5                	mov    %esp,%ebp
+  800f94:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  800f97:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f9a:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  800f9f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800fa2:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  800fa7:	b8 06 00 00 00       	mov    $0x6,%eax
+  800fac:	e8 9c fe ff ff       	call   800e4d <nsipc>
+}
+  800fb1:	c9                   	leave
+  800fb2:	c3                   	ret
+
+00800fb3 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  800fb3:	55                   	push   %ebp
+  800fb4:	89 e5                	mov    %esp,%ebp
+  800fb6:	56                   	push   %esi
+  800fb7:	53                   	push   %ebx
+  800fb8:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  800fbb:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fbe:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  800fc3:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  800fc9:	8b 45 14             	mov    0x14(%ebp),%eax
+  800fcc:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  800fd1:	b8 07 00 00 00       	mov    $0x7,%eax
+  800fd6:	e8 72 fe ff ff       	call   800e4d <nsipc>
+  800fdb:	89 c3                	mov    %eax,%ebx
+  800fdd:	85 c0                	test   %eax,%eax
+  800fdf:	78 22                	js     801003 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  800fe1:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  800fe6:	39 c6                	cmp    %eax,%esi
+  800fe8:	0f 4e c6             	cmovle %esi,%eax
+  800feb:	39 c3                	cmp    %eax,%ebx
+  800fed:	7f 1d                	jg     80100c <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  800fef:	83 ec 04             	sub    $0x4,%esp
+  800ff2:	53                   	push   %ebx
+  800ff3:	68 00 60 80 00       	push   $0x806000
+  800ff8:	ff 75 0c             	push   0xc(%ebp)
+  800ffb:	e8 82 0d 00 00       	call   801d82 <memmove>
+  801000:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801003:	89 d8                	mov    %ebx,%eax
+  801005:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801008:	5b                   	pop    %ebx
+  801009:	5e                   	pop    %esi
+  80100a:	5d                   	pop    %ebp
+  80100b:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  80100c:	68 27 26 80 00       	push   $0x802627
+  801011:	68 ef 25 80 00       	push   $0x8025ef
+  801016:	6a 62                	push   $0x62
+  801018:	68 3c 26 80 00       	push   $0x80263c
+  80101d:	e8 46 05 00 00       	call   801568 <_panic>
+
+00801022 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801022:	55                   	push   %ebp
+  801023:	89 e5                	mov    %esp,%ebp
+  801025:	53                   	push   %ebx
+  801026:	83 ec 04             	sub    $0x4,%esp
+  801029:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  80102c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80102f:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  801034:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80103a:	7f 2e                	jg     80106a <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  80103c:	83 ec 04             	sub    $0x4,%esp
+  80103f:	53                   	push   %ebx
+  801040:	ff 75 0c             	push   0xc(%ebp)
+  801043:	68 0c 60 80 00       	push   $0x80600c
+  801048:	e8 35 0d 00 00       	call   801d82 <memmove>
+	nsipcbuf.send.req_size = size;
+  80104d:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  801053:	8b 45 14             	mov    0x14(%ebp),%eax
+  801056:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  80105b:	b8 08 00 00 00       	mov    $0x8,%eax
+  801060:	e8 e8 fd ff ff       	call   800e4d <nsipc>
+}
+  801065:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801068:	c9                   	leave
+  801069:	c3                   	ret
+	assert(size < 1600);
+  80106a:	68 48 26 80 00       	push   $0x802648
+  80106f:	68 ef 25 80 00       	push   $0x8025ef
+  801074:	6a 6d                	push   $0x6d
+  801076:	68 3c 26 80 00       	push   $0x80263c
+  80107b:	e8 e8 04 00 00       	call   801568 <_panic>
+
+00801080 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801080:	55                   	push   %ebp
+  801081:	89 e5                	mov    %esp,%ebp
+  801083:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801086:	8b 45 08             	mov    0x8(%ebp),%eax
+  801089:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  80108e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801091:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  801096:	8b 45 10             	mov    0x10(%ebp),%eax
+  801099:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  80109e:	b8 09 00 00 00       	mov    $0x9,%eax
+  8010a3:	e8 a5 fd ff ff       	call   800e4d <nsipc>
+}
+  8010a8:	c9                   	leave
+  8010a9:	c3                   	ret
+
+008010aa <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8010aa:	55                   	push   %ebp
+  8010ab:	89 e5                	mov    %esp,%ebp
+  8010ad:	56                   	push   %esi
+  8010ae:	53                   	push   %ebx
+  8010af:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8010b2:	83 ec 0c             	sub    $0xc,%esp
+  8010b5:	ff 75 08             	push   0x8(%ebp)
+  8010b8:	e8 aa f3 ff ff       	call   800467 <fd2data>
+  8010bd:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8010bf:	83 c4 08             	add    $0x8,%esp
+  8010c2:	68 54 26 80 00       	push   $0x802654
+  8010c7:	53                   	push   %ebx
+  8010c8:	e8 2f 0b 00 00       	call   801bfc <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8010cd:	8b 46 04             	mov    0x4(%esi),%eax
+  8010d0:	2b 06                	sub    (%esi),%eax
+  8010d2:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8010d8:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8010df:	00 00 00 
+	stat->st_dev = &devpipe;
+  8010e2:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  8010e9:	30 80 00 
+	return 0;
+}
+  8010ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010f1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8010f4:	5b                   	pop    %ebx
+  8010f5:	5e                   	pop    %esi
+  8010f6:	5d                   	pop    %ebp
+  8010f7:	c3                   	ret
+
+008010f8 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8010f8:	55                   	push   %ebp
+  8010f9:	89 e5                	mov    %esp,%ebp
+  8010fb:	53                   	push   %ebx
+  8010fc:	83 ec 0c             	sub    $0xc,%esp
+  8010ff:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801102:	53                   	push   %ebx
+  801103:	6a 00                	push   $0x0
+  801105:	e8 ff f0 ff ff       	call   800209 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  80110a:	89 1c 24             	mov    %ebx,(%esp)
+  80110d:	e8 55 f3 ff ff       	call   800467 <fd2data>
+  801112:	83 c4 08             	add    $0x8,%esp
+  801115:	50                   	push   %eax
+  801116:	6a 00                	push   $0x0
+  801118:	e8 ec f0 ff ff       	call   800209 <sys_page_unmap>
+}
+  80111d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801120:	c9                   	leave
+  801121:	c3                   	ret
+
+00801122 <_pipeisclosed>:
+{
+  801122:	55                   	push   %ebp
+  801123:	89 e5                	mov    %esp,%ebp
+  801125:	57                   	push   %edi
+  801126:	56                   	push   %esi
+  801127:	53                   	push   %ebx
+  801128:	83 ec 1c             	sub    $0x1c,%esp
+  80112b:	89 c7                	mov    %eax,%edi
+  80112d:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  80112f:	a1 08 40 80 00       	mov    0x804008,%eax
+  801134:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801137:	83 ec 0c             	sub    $0xc,%esp
+  80113a:	57                   	push   %edi
+  80113b:	e8 f3 0e 00 00       	call   802033 <pageref>
+  801140:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801143:	89 34 24             	mov    %esi,(%esp)
+  801146:	e8 e8 0e 00 00       	call   802033 <pageref>
+		nn = thisenv->env_runs;
+  80114b:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801151:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801154:	83 c4 10             	add    $0x10,%esp
+  801157:	39 cb                	cmp    %ecx,%ebx
+  801159:	74 1b                	je     801176 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  80115b:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80115e:	75 cf                	jne    80112f <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801160:	8b 42 58             	mov    0x58(%edx),%eax
+  801163:	6a 01                	push   $0x1
+  801165:	50                   	push   %eax
+  801166:	53                   	push   %ebx
+  801167:	68 5b 26 80 00       	push   $0x80265b
+  80116c:	e8 d2 04 00 00       	call   801643 <cprintf>
+  801171:	83 c4 10             	add    $0x10,%esp
+  801174:	eb b9                	jmp    80112f <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801176:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801179:	0f 94 c0             	sete   %al
+  80117c:	0f b6 c0             	movzbl %al,%eax
+}
+  80117f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801182:	5b                   	pop    %ebx
+  801183:	5e                   	pop    %esi
+  801184:	5f                   	pop    %edi
+  801185:	5d                   	pop    %ebp
+  801186:	c3                   	ret
+
+00801187 <devpipe_write>:
+{
+  801187:	55                   	push   %ebp
+  801188:	89 e5                	mov    %esp,%ebp
+  80118a:	57                   	push   %edi
+  80118b:	56                   	push   %esi
+  80118c:	53                   	push   %ebx
+  80118d:	83 ec 28             	sub    $0x28,%esp
+  801190:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801193:	56                   	push   %esi
+  801194:	e8 ce f2 ff ff       	call   800467 <fd2data>
+  801199:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80119b:	83 c4 10             	add    $0x10,%esp
+  80119e:	bf 00 00 00 00       	mov    $0x0,%edi
+  8011a3:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8011a6:	75 09                	jne    8011b1 <devpipe_write+0x2a>
+	return i;
+  8011a8:	89 f8                	mov    %edi,%eax
+  8011aa:	eb 23                	jmp    8011cf <devpipe_write+0x48>
+			sys_yield();
+  8011ac:	e8 b4 ef ff ff       	call   800165 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8011b1:	8b 43 04             	mov    0x4(%ebx),%eax
+  8011b4:	8b 0b                	mov    (%ebx),%ecx
+  8011b6:	8d 51 20             	lea    0x20(%ecx),%edx
+  8011b9:	39 d0                	cmp    %edx,%eax
+  8011bb:	72 1a                	jb     8011d7 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8011bd:	89 da                	mov    %ebx,%edx
+  8011bf:	89 f0                	mov    %esi,%eax
+  8011c1:	e8 5c ff ff ff       	call   801122 <_pipeisclosed>
+  8011c6:	85 c0                	test   %eax,%eax
+  8011c8:	74 e2                	je     8011ac <devpipe_write+0x25>
+				return 0;
+  8011ca:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011d2:	5b                   	pop    %ebx
+  8011d3:	5e                   	pop    %esi
+  8011d4:	5f                   	pop    %edi
+  8011d5:	5d                   	pop    %ebp
+  8011d6:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8011d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011da:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8011de:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8011e1:	89 c2                	mov    %eax,%edx
+  8011e3:	c1 fa 1f             	sar    $0x1f,%edx
+  8011e6:	89 d1                	mov    %edx,%ecx
+  8011e8:	c1 e9 1b             	shr    $0x1b,%ecx
+  8011eb:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8011ee:	83 e2 1f             	and    $0x1f,%edx
+  8011f1:	29 ca                	sub    %ecx,%edx
+  8011f3:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8011f7:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8011fb:	83 c0 01             	add    $0x1,%eax
+  8011fe:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  801201:	83 c7 01             	add    $0x1,%edi
+  801204:	eb 9d                	jmp    8011a3 <devpipe_write+0x1c>
+
+00801206 <devpipe_read>:
+{
+  801206:	55                   	push   %ebp
+  801207:	89 e5                	mov    %esp,%ebp
+  801209:	57                   	push   %edi
+  80120a:	56                   	push   %esi
+  80120b:	53                   	push   %ebx
+  80120c:	83 ec 18             	sub    $0x18,%esp
+  80120f:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  801212:	57                   	push   %edi
+  801213:	e8 4f f2 ff ff       	call   800467 <fd2data>
+  801218:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80121a:	83 c4 10             	add    $0x10,%esp
+  80121d:	be 00 00 00 00       	mov    $0x0,%esi
+  801222:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801225:	75 13                	jne    80123a <devpipe_read+0x34>
+	return i;
+  801227:	89 f0                	mov    %esi,%eax
+  801229:	eb 02                	jmp    80122d <devpipe_read+0x27>
+				return i;
+  80122b:	89 f0                	mov    %esi,%eax
+}
+  80122d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801230:	5b                   	pop    %ebx
+  801231:	5e                   	pop    %esi
+  801232:	5f                   	pop    %edi
+  801233:	5d                   	pop    %ebp
+  801234:	c3                   	ret
+			sys_yield();
+  801235:	e8 2b ef ff ff       	call   800165 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  80123a:	8b 03                	mov    (%ebx),%eax
+  80123c:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80123f:	75 18                	jne    801259 <devpipe_read+0x53>
+			if (i > 0)
+  801241:	85 f6                	test   %esi,%esi
+  801243:	75 e6                	jne    80122b <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  801245:	89 da                	mov    %ebx,%edx
+  801247:	89 f8                	mov    %edi,%eax
+  801249:	e8 d4 fe ff ff       	call   801122 <_pipeisclosed>
+  80124e:	85 c0                	test   %eax,%eax
+  801250:	74 e3                	je     801235 <devpipe_read+0x2f>
+				return 0;
+  801252:	b8 00 00 00 00       	mov    $0x0,%eax
+  801257:	eb d4                	jmp    80122d <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801259:	99                   	cltd
+  80125a:	c1 ea 1b             	shr    $0x1b,%edx
+  80125d:	01 d0                	add    %edx,%eax
+  80125f:	83 e0 1f             	and    $0x1f,%eax
+  801262:	29 d0                	sub    %edx,%eax
+  801264:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801269:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80126c:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80126f:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  801272:	83 c6 01             	add    $0x1,%esi
+  801275:	eb ab                	jmp    801222 <devpipe_read+0x1c>
+
+00801277 <pipe>:
+{
+  801277:	55                   	push   %ebp
+  801278:	89 e5                	mov    %esp,%ebp
+  80127a:	56                   	push   %esi
+  80127b:	53                   	push   %ebx
+  80127c:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80127f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801282:	50                   	push   %eax
+  801283:	e8 f6 f1 ff ff       	call   80047e <fd_alloc>
+  801288:	89 c3                	mov    %eax,%ebx
+  80128a:	83 c4 10             	add    $0x10,%esp
+  80128d:	85 c0                	test   %eax,%eax
+  80128f:	0f 88 23 01 00 00    	js     8013b8 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801295:	83 ec 04             	sub    $0x4,%esp
+  801298:	68 07 04 00 00       	push   $0x407
+  80129d:	ff 75 f4             	push   -0xc(%ebp)
+  8012a0:	6a 00                	push   $0x0
+  8012a2:	e8 dd ee ff ff       	call   800184 <sys_page_alloc>
+  8012a7:	89 c3                	mov    %eax,%ebx
+  8012a9:	83 c4 10             	add    $0x10,%esp
+  8012ac:	85 c0                	test   %eax,%eax
+  8012ae:	0f 88 04 01 00 00    	js     8013b8 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8012b4:	83 ec 0c             	sub    $0xc,%esp
+  8012b7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8012ba:	50                   	push   %eax
+  8012bb:	e8 be f1 ff ff       	call   80047e <fd_alloc>
+  8012c0:	89 c3                	mov    %eax,%ebx
+  8012c2:	83 c4 10             	add    $0x10,%esp
+  8012c5:	85 c0                	test   %eax,%eax
+  8012c7:	0f 88 db 00 00 00    	js     8013a8 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8012cd:	83 ec 04             	sub    $0x4,%esp
+  8012d0:	68 07 04 00 00       	push   $0x407
+  8012d5:	ff 75 f0             	push   -0x10(%ebp)
+  8012d8:	6a 00                	push   $0x0
+  8012da:	e8 a5 ee ff ff       	call   800184 <sys_page_alloc>
+  8012df:	89 c3                	mov    %eax,%ebx
+  8012e1:	83 c4 10             	add    $0x10,%esp
+  8012e4:	85 c0                	test   %eax,%eax
+  8012e6:	0f 88 bc 00 00 00    	js     8013a8 <pipe+0x131>
+	va = fd2data(fd0);
+  8012ec:	83 ec 0c             	sub    $0xc,%esp
+  8012ef:	ff 75 f4             	push   -0xc(%ebp)
+  8012f2:	e8 70 f1 ff ff       	call   800467 <fd2data>
+  8012f7:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8012f9:	83 c4 0c             	add    $0xc,%esp
+  8012fc:	68 07 04 00 00       	push   $0x407
+  801301:	50                   	push   %eax
+  801302:	6a 00                	push   $0x0
+  801304:	e8 7b ee ff ff       	call   800184 <sys_page_alloc>
+  801309:	89 c3                	mov    %eax,%ebx
+  80130b:	83 c4 10             	add    $0x10,%esp
+  80130e:	85 c0                	test   %eax,%eax
+  801310:	0f 88 82 00 00 00    	js     801398 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801316:	83 ec 0c             	sub    $0xc,%esp
+  801319:	ff 75 f0             	push   -0x10(%ebp)
+  80131c:	e8 46 f1 ff ff       	call   800467 <fd2data>
+  801321:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801328:	50                   	push   %eax
+  801329:	6a 00                	push   $0x0
+  80132b:	56                   	push   %esi
+  80132c:	6a 00                	push   $0x0
+  80132e:	e8 94 ee ff ff       	call   8001c7 <sys_page_map>
+  801333:	89 c3                	mov    %eax,%ebx
+  801335:	83 c4 20             	add    $0x20,%esp
+  801338:	85 c0                	test   %eax,%eax
+  80133a:	78 4e                	js     80138a <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80133c:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  801341:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801344:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  801346:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801349:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  801350:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801353:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  801355:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801358:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80135f:	83 ec 0c             	sub    $0xc,%esp
+  801362:	ff 75 f4             	push   -0xc(%ebp)
+  801365:	e8 ed f0 ff ff       	call   800457 <fd2num>
+  80136a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80136d:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80136f:	83 c4 04             	add    $0x4,%esp
+  801372:	ff 75 f0             	push   -0x10(%ebp)
+  801375:	e8 dd f0 ff ff       	call   800457 <fd2num>
+  80137a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80137d:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  801380:	83 c4 10             	add    $0x10,%esp
+  801383:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801388:	eb 2e                	jmp    8013b8 <pipe+0x141>
+	sys_page_unmap(0, va);
+  80138a:	83 ec 08             	sub    $0x8,%esp
+  80138d:	56                   	push   %esi
+  80138e:	6a 00                	push   $0x0
+  801390:	e8 74 ee ff ff       	call   800209 <sys_page_unmap>
+  801395:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  801398:	83 ec 08             	sub    $0x8,%esp
+  80139b:	ff 75 f0             	push   -0x10(%ebp)
+  80139e:	6a 00                	push   $0x0
+  8013a0:	e8 64 ee ff ff       	call   800209 <sys_page_unmap>
+  8013a5:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8013a8:	83 ec 08             	sub    $0x8,%esp
+  8013ab:	ff 75 f4             	push   -0xc(%ebp)
+  8013ae:	6a 00                	push   $0x0
+  8013b0:	e8 54 ee ff ff       	call   800209 <sys_page_unmap>
+  8013b5:	83 c4 10             	add    $0x10,%esp
+}
+  8013b8:	89 d8                	mov    %ebx,%eax
+  8013ba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013bd:	5b                   	pop    %ebx
+  8013be:	5e                   	pop    %esi
+  8013bf:	5d                   	pop    %ebp
+  8013c0:	c3                   	ret
+
+008013c1 <pipeisclosed>:
+{
+  8013c1:	55                   	push   %ebp
+  8013c2:	89 e5                	mov    %esp,%ebp
+  8013c4:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8013c7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013ca:	50                   	push   %eax
+  8013cb:	ff 75 08             	push   0x8(%ebp)
+  8013ce:	e8 01 f1 ff ff       	call   8004d4 <fd_lookup>
+  8013d3:	83 c4 10             	add    $0x10,%esp
+  8013d6:	85 c0                	test   %eax,%eax
+  8013d8:	78 18                	js     8013f2 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8013da:	83 ec 0c             	sub    $0xc,%esp
+  8013dd:	ff 75 f4             	push   -0xc(%ebp)
+  8013e0:	e8 82 f0 ff ff       	call   800467 <fd2data>
+  8013e5:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8013e7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013ea:	e8 33 fd ff ff       	call   801122 <_pipeisclosed>
+  8013ef:	83 c4 10             	add    $0x10,%esp
+}
+  8013f2:	c9                   	leave
+  8013f3:	c3                   	ret
+
+008013f4 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8013f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013f9:	c3                   	ret
+
+008013fa <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8013fa:	55                   	push   %ebp
+  8013fb:	89 e5                	mov    %esp,%ebp
+  8013fd:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  801400:	68 73 26 80 00       	push   $0x802673
+  801405:	ff 75 0c             	push   0xc(%ebp)
+  801408:	e8 ef 07 00 00       	call   801bfc <strcpy>
+	return 0;
+}
+  80140d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801412:	c9                   	leave
+  801413:	c3                   	ret
+
+00801414 <devcons_write>:
+{
+  801414:	55                   	push   %ebp
+  801415:	89 e5                	mov    %esp,%ebp
+  801417:	57                   	push   %edi
+  801418:	56                   	push   %esi
+  801419:	53                   	push   %ebx
+  80141a:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  801420:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  801425:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80142b:	eb 2e                	jmp    80145b <devcons_write+0x47>
+		m = n - tot;
+  80142d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801430:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  801432:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801437:	39 c3                	cmp    %eax,%ebx
+  801439:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80143c:	83 ec 04             	sub    $0x4,%esp
+  80143f:	53                   	push   %ebx
+  801440:	89 f0                	mov    %esi,%eax
+  801442:	03 45 0c             	add    0xc(%ebp),%eax
+  801445:	50                   	push   %eax
+  801446:	57                   	push   %edi
+  801447:	e8 36 09 00 00       	call   801d82 <memmove>
+		sys_cputs(buf, m);
+  80144c:	83 c4 08             	add    $0x8,%esp
+  80144f:	53                   	push   %ebx
+  801450:	57                   	push   %edi
+  801451:	e8 72 ec ff ff       	call   8000c8 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  801456:	01 de                	add    %ebx,%esi
+  801458:	83 c4 10             	add    $0x10,%esp
+  80145b:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80145e:	72 cd                	jb     80142d <devcons_write+0x19>
+}
+  801460:	89 f0                	mov    %esi,%eax
+  801462:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801465:	5b                   	pop    %ebx
+  801466:	5e                   	pop    %esi
+  801467:	5f                   	pop    %edi
+  801468:	5d                   	pop    %ebp
+  801469:	c3                   	ret
+
+0080146a <devcons_read>:
+{
+  80146a:	55                   	push   %ebp
+  80146b:	89 e5                	mov    %esp,%ebp
+  80146d:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  801470:	b8 00 00 00 00       	mov    $0x0,%eax
+  801475:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801479:	75 07                	jne    801482 <devcons_read+0x18>
+  80147b:	eb 1f                	jmp    80149c <devcons_read+0x32>
+		sys_yield();
+  80147d:	e8 e3 ec ff ff       	call   800165 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  801482:	e8 5f ec ff ff       	call   8000e6 <sys_cgetc>
+  801487:	85 c0                	test   %eax,%eax
+  801489:	74 f2                	je     80147d <devcons_read+0x13>
+	if (c < 0)
+  80148b:	78 0f                	js     80149c <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80148d:	83 f8 04             	cmp    $0x4,%eax
+  801490:	74 0c                	je     80149e <devcons_read+0x34>
+	*(char*)vbuf = c;
+  801492:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801495:	88 02                	mov    %al,(%edx)
+	return 1;
+  801497:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80149c:	c9                   	leave
+  80149d:	c3                   	ret
+		return 0;
+  80149e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014a3:	eb f7                	jmp    80149c <devcons_read+0x32>
+
+008014a5 <cputchar>:
+{
+  8014a5:	55                   	push   %ebp
+  8014a6:	89 e5                	mov    %esp,%ebp
+  8014a8:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8014ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014ae:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8014b1:	6a 01                	push   $0x1
+  8014b3:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8014b6:	50                   	push   %eax
+  8014b7:	e8 0c ec ff ff       	call   8000c8 <sys_cputs>
+}
+  8014bc:	83 c4 10             	add    $0x10,%esp
+  8014bf:	c9                   	leave
+  8014c0:	c3                   	ret
+
+008014c1 <getchar>:
+{
+  8014c1:	55                   	push   %ebp
+  8014c2:	89 e5                	mov    %esp,%ebp
+  8014c4:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8014c7:	6a 01                	push   $0x1
+  8014c9:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8014cc:	50                   	push   %eax
+  8014cd:	6a 00                	push   $0x0
+  8014cf:	e8 66 f2 ff ff       	call   80073a <read>
+	if (r < 0)
+  8014d4:	83 c4 10             	add    $0x10,%esp
+  8014d7:	85 c0                	test   %eax,%eax
+  8014d9:	78 06                	js     8014e1 <getchar+0x20>
+	if (r < 1)
+  8014db:	74 06                	je     8014e3 <getchar+0x22>
+	return c;
+  8014dd:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8014e1:	c9                   	leave
+  8014e2:	c3                   	ret
+		return -E_EOF;
+  8014e3:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8014e8:	eb f7                	jmp    8014e1 <getchar+0x20>
+
+008014ea <iscons>:
+{
+  8014ea:	55                   	push   %ebp
+  8014eb:	89 e5                	mov    %esp,%ebp
+  8014ed:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8014f0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014f3:	50                   	push   %eax
+  8014f4:	ff 75 08             	push   0x8(%ebp)
+  8014f7:	e8 d8 ef ff ff       	call   8004d4 <fd_lookup>
+  8014fc:	83 c4 10             	add    $0x10,%esp
+  8014ff:	85 c0                	test   %eax,%eax
+  801501:	78 11                	js     801514 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  801503:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801506:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  80150c:	39 10                	cmp    %edx,(%eax)
+  80150e:	0f 94 c0             	sete   %al
+  801511:	0f b6 c0             	movzbl %al,%eax
+}
+  801514:	c9                   	leave
+  801515:	c3                   	ret
+
+00801516 <opencons>:
+{
+  801516:	55                   	push   %ebp
+  801517:	89 e5                	mov    %esp,%ebp
+  801519:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80151c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80151f:	50                   	push   %eax
+  801520:	e8 59 ef ff ff       	call   80047e <fd_alloc>
+  801525:	83 c4 10             	add    $0x10,%esp
+  801528:	85 c0                	test   %eax,%eax
+  80152a:	78 3a                	js     801566 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80152c:	83 ec 04             	sub    $0x4,%esp
+  80152f:	68 07 04 00 00       	push   $0x407
+  801534:	ff 75 f4             	push   -0xc(%ebp)
+  801537:	6a 00                	push   $0x0
+  801539:	e8 46 ec ff ff       	call   800184 <sys_page_alloc>
+  80153e:	83 c4 10             	add    $0x10,%esp
+  801541:	85 c0                	test   %eax,%eax
+  801543:	78 21                	js     801566 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  801545:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801548:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  80154e:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  801550:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801553:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80155a:	83 ec 0c             	sub    $0xc,%esp
+  80155d:	50                   	push   %eax
+  80155e:	e8 f4 ee ff ff       	call   800457 <fd2num>
+  801563:	83 c4 10             	add    $0x10,%esp
+}
+  801566:	c9                   	leave
+  801567:	c3                   	ret
+
+00801568 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  801568:	55                   	push   %ebp
+  801569:	89 e5                	mov    %esp,%ebp
+  80156b:	56                   	push   %esi
+  80156c:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80156d:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  801570:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  801576:	e8 cb eb ff ff       	call   800146 <sys_getenvid>
+  80157b:	83 ec 0c             	sub    $0xc,%esp
+  80157e:	ff 75 0c             	push   0xc(%ebp)
+  801581:	ff 75 08             	push   0x8(%ebp)
+  801584:	56                   	push   %esi
+  801585:	50                   	push   %eax
+  801586:	68 80 26 80 00       	push   $0x802680
+  80158b:	e8 b3 00 00 00       	call   801643 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  801590:	83 c4 18             	add    $0x18,%esp
+  801593:	53                   	push   %ebx
+  801594:	ff 75 10             	push   0x10(%ebp)
+  801597:	e8 56 00 00 00       	call   8015f2 <vcprintf>
+	cprintf("\n");
+  80159c:	c7 04 24 6c 26 80 00 	movl   $0x80266c,(%esp)
+  8015a3:	e8 9b 00 00 00       	call   801643 <cprintf>
+  8015a8:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8015ab:	cc                   	int3
+	while (1)
+  8015ac:	eb fd                	jmp    8015ab <_panic+0x43>
+
+008015ae <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8015ae:	55                   	push   %ebp
+  8015af:	89 e5                	mov    %esp,%ebp
+  8015b1:	53                   	push   %ebx
+  8015b2:	83 ec 04             	sub    $0x4,%esp
+  8015b5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8015b8:	8b 13                	mov    (%ebx),%edx
+  8015ba:	8d 42 01             	lea    0x1(%edx),%eax
+  8015bd:	89 03                	mov    %eax,(%ebx)
+  8015bf:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8015c2:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8015c6:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8015cb:	74 09                	je     8015d6 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8015cd:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8015d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015d4:	c9                   	leave
+  8015d5:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8015d6:	83 ec 08             	sub    $0x8,%esp
+  8015d9:	68 ff 00 00 00       	push   $0xff
+  8015de:	8d 43 08             	lea    0x8(%ebx),%eax
+  8015e1:	50                   	push   %eax
+  8015e2:	e8 e1 ea ff ff       	call   8000c8 <sys_cputs>
+		b->idx = 0;
+  8015e7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8015ed:	83 c4 10             	add    $0x10,%esp
+  8015f0:	eb db                	jmp    8015cd <putch+0x1f>
+
+008015f2 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8015f2:	55                   	push   %ebp
+  8015f3:	89 e5                	mov    %esp,%ebp
+  8015f5:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8015fb:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  801602:	00 00 00 
+	b.cnt = 0;
+  801605:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80160c:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80160f:	ff 75 0c             	push   0xc(%ebp)
+  801612:	ff 75 08             	push   0x8(%ebp)
+  801615:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80161b:	50                   	push   %eax
+  80161c:	68 ae 15 80 00       	push   $0x8015ae
+  801621:	e8 14 01 00 00       	call   80173a <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  801626:	83 c4 08             	add    $0x8,%esp
+  801629:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80162f:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  801635:	50                   	push   %eax
+  801636:	e8 8d ea ff ff       	call   8000c8 <sys_cputs>
+
+	return b.cnt;
+}
+  80163b:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  801641:	c9                   	leave
+  801642:	c3                   	ret
+
+00801643 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  801643:	55                   	push   %ebp
+  801644:	89 e5                	mov    %esp,%ebp
+  801646:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  801649:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80164c:	50                   	push   %eax
+  80164d:	ff 75 08             	push   0x8(%ebp)
+  801650:	e8 9d ff ff ff       	call   8015f2 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  801655:	c9                   	leave
+  801656:	c3                   	ret
+
+00801657 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  801657:	55                   	push   %ebp
+  801658:	89 e5                	mov    %esp,%ebp
+  80165a:	57                   	push   %edi
+  80165b:	56                   	push   %esi
+  80165c:	53                   	push   %ebx
+  80165d:	83 ec 1c             	sub    $0x1c,%esp
+  801660:	89 c7                	mov    %eax,%edi
+  801662:	89 d6                	mov    %edx,%esi
+  801664:	8b 45 08             	mov    0x8(%ebp),%eax
+  801667:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80166a:	89 d1                	mov    %edx,%ecx
+  80166c:	89 c2                	mov    %eax,%edx
+  80166e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801671:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801674:	8b 45 10             	mov    0x10(%ebp),%eax
+  801677:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80167a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80167d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801684:	39 c2                	cmp    %eax,%edx
+  801686:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  801689:	72 3e                	jb     8016c9 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80168b:	83 ec 0c             	sub    $0xc,%esp
+  80168e:	ff 75 18             	push   0x18(%ebp)
+  801691:	83 eb 01             	sub    $0x1,%ebx
+  801694:	53                   	push   %ebx
+  801695:	50                   	push   %eax
+  801696:	83 ec 08             	sub    $0x8,%esp
+  801699:	ff 75 e4             	push   -0x1c(%ebp)
+  80169c:	ff 75 e0             	push   -0x20(%ebp)
+  80169f:	ff 75 dc             	push   -0x24(%ebp)
+  8016a2:	ff 75 d8             	push   -0x28(%ebp)
+  8016a5:	e8 d6 0a 00 00       	call   802180 <__udivdi3>
+  8016aa:	83 c4 18             	add    $0x18,%esp
+  8016ad:	52                   	push   %edx
+  8016ae:	50                   	push   %eax
+  8016af:	89 f2                	mov    %esi,%edx
+  8016b1:	89 f8                	mov    %edi,%eax
+  8016b3:	e8 9f ff ff ff       	call   801657 <printnum>
+  8016b8:	83 c4 20             	add    $0x20,%esp
+  8016bb:	eb 13                	jmp    8016d0 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8016bd:	83 ec 08             	sub    $0x8,%esp
+  8016c0:	56                   	push   %esi
+  8016c1:	ff 75 18             	push   0x18(%ebp)
+  8016c4:	ff d7                	call   *%edi
+  8016c6:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8016c9:	83 eb 01             	sub    $0x1,%ebx
+  8016cc:	85 db                	test   %ebx,%ebx
+  8016ce:	7f ed                	jg     8016bd <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8016d0:	83 ec 08             	sub    $0x8,%esp
+  8016d3:	56                   	push   %esi
+  8016d4:	83 ec 04             	sub    $0x4,%esp
+  8016d7:	ff 75 e4             	push   -0x1c(%ebp)
+  8016da:	ff 75 e0             	push   -0x20(%ebp)
+  8016dd:	ff 75 dc             	push   -0x24(%ebp)
+  8016e0:	ff 75 d8             	push   -0x28(%ebp)
+  8016e3:	e8 68 0b 00 00       	call   802250 <__umoddi3>
+  8016e8:	83 c4 14             	add    $0x14,%esp
+  8016eb:	0f be 80 a3 26 80 00 	movsbl 0x8026a3(%eax),%eax
+  8016f2:	50                   	push   %eax
+  8016f3:	ff d7                	call   *%edi
+}
+  8016f5:	83 c4 10             	add    $0x10,%esp
+  8016f8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016fb:	5b                   	pop    %ebx
+  8016fc:	5e                   	pop    %esi
+  8016fd:	5f                   	pop    %edi
+  8016fe:	5d                   	pop    %ebp
+  8016ff:	c3                   	ret
+
+00801700 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  801700:	55                   	push   %ebp
+  801701:	89 e5                	mov    %esp,%ebp
+  801703:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  801706:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80170a:	8b 10                	mov    (%eax),%edx
+  80170c:	3b 50 04             	cmp    0x4(%eax),%edx
+  80170f:	73 0a                	jae    80171b <sprintputch+0x1b>
+		*b->buf++ = ch;
+  801711:	8d 4a 01             	lea    0x1(%edx),%ecx
+  801714:	89 08                	mov    %ecx,(%eax)
+  801716:	8b 45 08             	mov    0x8(%ebp),%eax
+  801719:	88 02                	mov    %al,(%edx)
+}
+  80171b:	5d                   	pop    %ebp
+  80171c:	c3                   	ret
+
+0080171d <printfmt>:
+{
+  80171d:	55                   	push   %ebp
+  80171e:	89 e5                	mov    %esp,%ebp
+  801720:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  801723:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  801726:	50                   	push   %eax
+  801727:	ff 75 10             	push   0x10(%ebp)
+  80172a:	ff 75 0c             	push   0xc(%ebp)
+  80172d:	ff 75 08             	push   0x8(%ebp)
+  801730:	e8 05 00 00 00       	call   80173a <vprintfmt>
+}
+  801735:	83 c4 10             	add    $0x10,%esp
+  801738:	c9                   	leave
+  801739:	c3                   	ret
+
+0080173a <vprintfmt>:
+{
+  80173a:	55                   	push   %ebp
+  80173b:	89 e5                	mov    %esp,%ebp
+  80173d:	57                   	push   %edi
+  80173e:	56                   	push   %esi
+  80173f:	53                   	push   %ebx
+  801740:	83 ec 2c             	sub    $0x2c,%esp
+  801743:	8b 75 08             	mov    0x8(%ebp),%esi
+  801746:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801749:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80174c:	eb 0a                	jmp    801758 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80174e:	83 ec 08             	sub    $0x8,%esp
+  801751:	53                   	push   %ebx
+  801752:	50                   	push   %eax
+  801753:	ff d6                	call   *%esi
+  801755:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801758:	83 c7 01             	add    $0x1,%edi
+  80175b:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80175f:	83 f8 25             	cmp    $0x25,%eax
+  801762:	74 0c                	je     801770 <vprintfmt+0x36>
+			if (ch == '\0')
+  801764:	85 c0                	test   %eax,%eax
+  801766:	75 e6                	jne    80174e <vprintfmt+0x14>
+}
+  801768:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80176b:	5b                   	pop    %ebx
+  80176c:	5e                   	pop    %esi
+  80176d:	5f                   	pop    %edi
+  80176e:	5d                   	pop    %ebp
+  80176f:	c3                   	ret
+		padc = ' ';
+  801770:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  801774:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80177b:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  801782:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  801789:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80178e:	8d 47 01             	lea    0x1(%edi),%eax
+  801791:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801794:	0f b6 17             	movzbl (%edi),%edx
+  801797:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80179a:	3c 55                	cmp    $0x55,%al
+  80179c:	0f 87 9a 03 00 00    	ja     801b3c <vprintfmt+0x402>
+  8017a2:	0f b6 c0             	movzbl %al,%eax
+  8017a5:	ff 24 85 e0 27 80 00 	jmp    *0x8027e0(,%eax,4)
+  8017ac:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8017af:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8017b3:	eb d9                	jmp    80178e <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8017b5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8017b8:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8017bc:	eb d0                	jmp    80178e <vprintfmt+0x54>
+  8017be:	0f b6 d2             	movzbl %dl,%edx
+  8017c1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8017c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017c9:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8017cc:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8017cf:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8017d3:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8017d6:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8017d9:	83 f9 09             	cmp    $0x9,%ecx
+  8017dc:	77 55                	ja     801833 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8017de:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8017e1:	eb e9                	jmp    8017cc <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8017e3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8017e6:	8b 00                	mov    (%eax),%eax
+  8017e8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8017eb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8017ee:	8d 40 04             	lea    0x4(%eax),%eax
+  8017f1:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8017f4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8017f7:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8017fb:	79 91                	jns    80178e <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8017fd:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801800:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801803:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80180a:	eb 82                	jmp    80178e <vprintfmt+0x54>
+			if (width < 0)
+  80180c:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80180f:	85 d2                	test   %edx,%edx
+  801811:	b8 00 00 00 00       	mov    $0x0,%eax
+  801816:	0f 49 c2             	cmovns %edx,%eax
+  801819:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80181c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80181f:	e9 6a ff ff ff       	jmp    80178e <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  801824:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  801827:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80182e:	e9 5b ff ff ff       	jmp    80178e <vprintfmt+0x54>
+  801833:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801836:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801839:	eb bc                	jmp    8017f7 <vprintfmt+0xbd>
+			lflag++;
+  80183b:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80183e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  801841:	e9 48 ff ff ff       	jmp    80178e <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  801846:	8b 45 14             	mov    0x14(%ebp),%eax
+  801849:	8d 78 04             	lea    0x4(%eax),%edi
+  80184c:	83 ec 08             	sub    $0x8,%esp
+  80184f:	53                   	push   %ebx
+  801850:	ff 30                	push   (%eax)
+  801852:	ff d6                	call   *%esi
+			break;
+  801854:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  801857:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80185a:	e9 7c 02 00 00       	jmp    801adb <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  80185f:	8b 45 14             	mov    0x14(%ebp),%eax
+  801862:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  801865:	8b 10                	mov    (%eax),%edx
+  801867:	89 d0                	mov    %edx,%eax
+  801869:	f7 d8                	neg    %eax
+  80186b:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80186e:	83 f8 10             	cmp    $0x10,%eax
+  801871:	7f 23                	jg     801896 <vprintfmt+0x15c>
+  801873:	8b 14 85 40 29 80 00 	mov    0x802940(,%eax,4),%edx
+  80187a:	85 d2                	test   %edx,%edx
+  80187c:	74 18                	je     801896 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  80187e:	52                   	push   %edx
+  80187f:	68 01 26 80 00       	push   $0x802601
+  801884:	53                   	push   %ebx
+  801885:	56                   	push   %esi
+  801886:	e8 92 fe ff ff       	call   80171d <printfmt>
+  80188b:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80188e:	89 7d 14             	mov    %edi,0x14(%ebp)
+  801891:	e9 45 02 00 00       	jmp    801adb <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  801896:	50                   	push   %eax
+  801897:	68 bb 26 80 00       	push   $0x8026bb
+  80189c:	53                   	push   %ebx
+  80189d:	56                   	push   %esi
+  80189e:	e8 7a fe ff ff       	call   80171d <printfmt>
+  8018a3:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8018a6:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8018a9:	e9 2d 02 00 00       	jmp    801adb <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8018ae:	8b 45 14             	mov    0x14(%ebp),%eax
+  8018b1:	83 c0 04             	add    $0x4,%eax
+  8018b4:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8018b7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8018ba:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8018bc:	85 c9                	test   %ecx,%ecx
+  8018be:	b8 b4 26 80 00       	mov    $0x8026b4,%eax
+  8018c3:	0f 45 c1             	cmovne %ecx,%eax
+  8018c6:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8018c9:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8018cd:	7e 06                	jle    8018d5 <vprintfmt+0x19b>
+  8018cf:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8018d3:	75 0b                	jne    8018e0 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8018d5:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8018d8:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8018db:	89 75 08             	mov    %esi,0x8(%ebp)
+  8018de:	eb 5c                	jmp    80193c <vprintfmt+0x202>
+  8018e0:	83 ec 08             	sub    $0x8,%esp
+  8018e3:	ff 75 d0             	push   -0x30(%ebp)
+  8018e6:	ff 75 cc             	push   -0x34(%ebp)
+  8018e9:	e8 eb 02 00 00       	call   801bd9 <strnlen>
+  8018ee:	89 c2                	mov    %eax,%edx
+  8018f0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8018f3:	29 d0                	sub    %edx,%eax
+  8018f5:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8018f8:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8018fc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8018ff:	89 75 08             	mov    %esi,0x8(%ebp)
+  801902:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801904:	eb 0e                	jmp    801914 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  801906:	83 ec 08             	sub    $0x8,%esp
+  801909:	53                   	push   %ebx
+  80190a:	57                   	push   %edi
+  80190b:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80190e:	83 ee 01             	sub    $0x1,%esi
+  801911:	83 c4 10             	add    $0x10,%esp
+  801914:	85 f6                	test   %esi,%esi
+  801916:	7f ee                	jg     801906 <vprintfmt+0x1cc>
+  801918:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80191b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80191e:	85 c0                	test   %eax,%eax
+  801920:	ba 00 00 00 00       	mov    $0x0,%edx
+  801925:	0f 49 d0             	cmovns %eax,%edx
+  801928:	29 d0                	sub    %edx,%eax
+  80192a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80192d:	eb a6                	jmp    8018d5 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  80192f:	83 ec 08             	sub    $0x8,%esp
+  801932:	53                   	push   %ebx
+  801933:	52                   	push   %edx
+  801934:	ff 55 08             	call   *0x8(%ebp)
+  801937:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80193a:	89 f1                	mov    %esi,%ecx
+  80193c:	8d 71 01             	lea    0x1(%ecx),%esi
+  80193f:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  801943:	0f be d0             	movsbl %al,%edx
+  801946:	85 d2                	test   %edx,%edx
+  801948:	74 28                	je     801972 <vprintfmt+0x238>
+  80194a:	85 ff                	test   %edi,%edi
+  80194c:	78 05                	js     801953 <vprintfmt+0x219>
+  80194e:	83 ef 01             	sub    $0x1,%edi
+  801951:	78 30                	js     801983 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  801953:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  801957:	74 d6                	je     80192f <vprintfmt+0x1f5>
+  801959:	0f be c0             	movsbl %al,%eax
+  80195c:	83 e8 20             	sub    $0x20,%eax
+  80195f:	83 f8 5e             	cmp    $0x5e,%eax
+  801962:	76 cb                	jbe    80192f <vprintfmt+0x1f5>
+					putch('?', putdat);
+  801964:	83 ec 08             	sub    $0x8,%esp
+  801967:	53                   	push   %ebx
+  801968:	6a 3f                	push   $0x3f
+  80196a:	ff 55 08             	call   *0x8(%ebp)
+  80196d:	83 c4 10             	add    $0x10,%esp
+  801970:	eb c8                	jmp    80193a <vprintfmt+0x200>
+  801972:	8b 75 08             	mov    0x8(%ebp),%esi
+  801975:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  801978:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80197b:	01 d0                	add    %edx,%eax
+  80197d:	29 c8                	sub    %ecx,%eax
+  80197f:	89 c7                	mov    %eax,%edi
+  801981:	eb 13                	jmp    801996 <vprintfmt+0x25c>
+  801983:	8b 75 08             	mov    0x8(%ebp),%esi
+  801986:	eb ed                	jmp    801975 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  801988:	83 ec 08             	sub    $0x8,%esp
+  80198b:	53                   	push   %ebx
+  80198c:	6a 20                	push   $0x20
+  80198e:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  801990:	83 ef 01             	sub    $0x1,%edi
+  801993:	83 c4 10             	add    $0x10,%esp
+  801996:	85 ff                	test   %edi,%edi
+  801998:	7f ee                	jg     801988 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80199a:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80199d:	89 45 14             	mov    %eax,0x14(%ebp)
+  8019a0:	e9 36 01 00 00       	jmp    801adb <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  8019a5:	83 f9 01             	cmp    $0x1,%ecx
+  8019a8:	7f 1f                	jg     8019c9 <vprintfmt+0x28f>
+	else if (lflag)
+  8019aa:	85 c9                	test   %ecx,%ecx
+  8019ac:	74 67                	je     801a15 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8019ae:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019b1:	8b 00                	mov    (%eax),%eax
+  8019b3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8019b6:	89 c1                	mov    %eax,%ecx
+  8019b8:	c1 f9 1f             	sar    $0x1f,%ecx
+  8019bb:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8019be:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019c1:	8d 40 04             	lea    0x4(%eax),%eax
+  8019c4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8019c7:	eb 17                	jmp    8019e0 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8019c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019cc:	8b 50 04             	mov    0x4(%eax),%edx
+  8019cf:	8b 00                	mov    (%eax),%eax
+  8019d1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8019d4:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8019d7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019da:	8d 40 08             	lea    0x8(%eax),%eax
+  8019dd:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8019e0:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8019e3:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8019e6:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8019eb:	85 c9                	test   %ecx,%ecx
+  8019ed:	0f 89 ce 00 00 00    	jns    801ac1 <vprintfmt+0x387>
+				putch('-', putdat);
+  8019f3:	83 ec 08             	sub    $0x8,%esp
+  8019f6:	53                   	push   %ebx
+  8019f7:	6a 2d                	push   $0x2d
+  8019f9:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8019fb:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8019fe:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801a01:	f7 da                	neg    %edx
+  801a03:	83 d1 00             	adc    $0x0,%ecx
+  801a06:	f7 d9                	neg    %ecx
+  801a08:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  801a0b:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801a10:	e9 ac 00 00 00       	jmp    801ac1 <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  801a15:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a18:	8b 00                	mov    (%eax),%eax
+  801a1a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801a1d:	89 c1                	mov    %eax,%ecx
+  801a1f:	c1 f9 1f             	sar    $0x1f,%ecx
+  801a22:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801a25:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a28:	8d 40 04             	lea    0x4(%eax),%eax
+  801a2b:	89 45 14             	mov    %eax,0x14(%ebp)
+  801a2e:	eb b0                	jmp    8019e0 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  801a30:	83 f9 01             	cmp    $0x1,%ecx
+  801a33:	7f 1b                	jg     801a50 <vprintfmt+0x316>
+	else if (lflag)
+  801a35:	85 c9                	test   %ecx,%ecx
+  801a37:	74 2c                	je     801a65 <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  801a39:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a3c:	8b 10                	mov    (%eax),%edx
+  801a3e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a43:	8d 40 04             	lea    0x4(%eax),%eax
+  801a46:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801a49:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  801a4e:	eb 71                	jmp    801ac1 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  801a50:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a53:	8b 10                	mov    (%eax),%edx
+  801a55:	8b 48 04             	mov    0x4(%eax),%ecx
+  801a58:	8d 40 08             	lea    0x8(%eax),%eax
+  801a5b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801a5e:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  801a63:	eb 5c                	jmp    801ac1 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  801a65:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a68:	8b 10                	mov    (%eax),%edx
+  801a6a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a6f:	8d 40 04             	lea    0x4(%eax),%eax
+  801a72:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801a75:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  801a7a:	eb 45                	jmp    801ac1 <vprintfmt+0x387>
+			putch('X', putdat);
+  801a7c:	83 ec 08             	sub    $0x8,%esp
+  801a7f:	53                   	push   %ebx
+  801a80:	6a 58                	push   $0x58
+  801a82:	ff d6                	call   *%esi
+			putch('X', putdat);
+  801a84:	83 c4 08             	add    $0x8,%esp
+  801a87:	53                   	push   %ebx
+  801a88:	6a 58                	push   $0x58
+  801a8a:	ff d6                	call   *%esi
+			putch('X', putdat);
+  801a8c:	83 c4 08             	add    $0x8,%esp
+  801a8f:	53                   	push   %ebx
+  801a90:	6a 58                	push   $0x58
+  801a92:	ff d6                	call   *%esi
+			break;
+  801a94:	83 c4 10             	add    $0x10,%esp
+  801a97:	eb 42                	jmp    801adb <vprintfmt+0x3a1>
+			putch('0', putdat);
+  801a99:	83 ec 08             	sub    $0x8,%esp
+  801a9c:	53                   	push   %ebx
+  801a9d:	6a 30                	push   $0x30
+  801a9f:	ff d6                	call   *%esi
+			putch('x', putdat);
+  801aa1:	83 c4 08             	add    $0x8,%esp
+  801aa4:	53                   	push   %ebx
+  801aa5:	6a 78                	push   $0x78
+  801aa7:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  801aa9:	8b 45 14             	mov    0x14(%ebp),%eax
+  801aac:	8b 10                	mov    (%eax),%edx
+  801aae:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  801ab3:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  801ab6:	8d 40 04             	lea    0x4(%eax),%eax
+  801ab9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801abc:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  801ac1:	83 ec 0c             	sub    $0xc,%esp
+  801ac4:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  801ac8:	50                   	push   %eax
+  801ac9:	ff 75 e0             	push   -0x20(%ebp)
+  801acc:	57                   	push   %edi
+  801acd:	51                   	push   %ecx
+  801ace:	52                   	push   %edx
+  801acf:	89 da                	mov    %ebx,%edx
+  801ad1:	89 f0                	mov    %esi,%eax
+  801ad3:	e8 7f fb ff ff       	call   801657 <printnum>
+			break;
+  801ad8:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  801adb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801ade:	e9 75 fc ff ff       	jmp    801758 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  801ae3:	83 f9 01             	cmp    $0x1,%ecx
+  801ae6:	7f 1b                	jg     801b03 <vprintfmt+0x3c9>
+	else if (lflag)
+  801ae8:	85 c9                	test   %ecx,%ecx
+  801aea:	74 2c                	je     801b18 <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  801aec:	8b 45 14             	mov    0x14(%ebp),%eax
+  801aef:	8b 10                	mov    (%eax),%edx
+  801af1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801af6:	8d 40 04             	lea    0x4(%eax),%eax
+  801af9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801afc:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  801b01:	eb be                	jmp    801ac1 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  801b03:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b06:	8b 10                	mov    (%eax),%edx
+  801b08:	8b 48 04             	mov    0x4(%eax),%ecx
+  801b0b:	8d 40 08             	lea    0x8(%eax),%eax
+  801b0e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801b11:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  801b16:	eb a9                	jmp    801ac1 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  801b18:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b1b:	8b 10                	mov    (%eax),%edx
+  801b1d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b22:	8d 40 04             	lea    0x4(%eax),%eax
+  801b25:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801b28:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  801b2d:	eb 92                	jmp    801ac1 <vprintfmt+0x387>
+			putch(ch, putdat);
+  801b2f:	83 ec 08             	sub    $0x8,%esp
+  801b32:	53                   	push   %ebx
+  801b33:	6a 25                	push   $0x25
+  801b35:	ff d6                	call   *%esi
+			break;
+  801b37:	83 c4 10             	add    $0x10,%esp
+  801b3a:	eb 9f                	jmp    801adb <vprintfmt+0x3a1>
+			putch('%', putdat);
+  801b3c:	83 ec 08             	sub    $0x8,%esp
+  801b3f:	53                   	push   %ebx
+  801b40:	6a 25                	push   $0x25
+  801b42:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801b44:	83 c4 10             	add    $0x10,%esp
+  801b47:	89 f8                	mov    %edi,%eax
+  801b49:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  801b4d:	74 05                	je     801b54 <vprintfmt+0x41a>
+  801b4f:	83 e8 01             	sub    $0x1,%eax
+  801b52:	eb f5                	jmp    801b49 <vprintfmt+0x40f>
+  801b54:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801b57:	eb 82                	jmp    801adb <vprintfmt+0x3a1>
+
+00801b59 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  801b59:	55                   	push   %ebp
+  801b5a:	89 e5                	mov    %esp,%ebp
+  801b5c:	83 ec 18             	sub    $0x18,%esp
+  801b5f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b62:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  801b65:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  801b68:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  801b6c:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  801b6f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  801b76:	85 c0                	test   %eax,%eax
+  801b78:	74 26                	je     801ba0 <vsnprintf+0x47>
+  801b7a:	85 d2                	test   %edx,%edx
+  801b7c:	7e 22                	jle    801ba0 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  801b7e:	ff 75 14             	push   0x14(%ebp)
+  801b81:	ff 75 10             	push   0x10(%ebp)
+  801b84:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  801b87:	50                   	push   %eax
+  801b88:	68 00 17 80 00       	push   $0x801700
+  801b8d:	e8 a8 fb ff ff       	call   80173a <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  801b92:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801b95:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  801b98:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b9b:	83 c4 10             	add    $0x10,%esp
+}
+  801b9e:	c9                   	leave
+  801b9f:	c3                   	ret
+		return -E_INVAL;
+  801ba0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ba5:	eb f7                	jmp    801b9e <vsnprintf+0x45>
+
+00801ba7 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801ba7:	55                   	push   %ebp
+  801ba8:	89 e5                	mov    %esp,%ebp
+  801baa:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  801bad:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  801bb0:	50                   	push   %eax
+  801bb1:	ff 75 10             	push   0x10(%ebp)
+  801bb4:	ff 75 0c             	push   0xc(%ebp)
+  801bb7:	ff 75 08             	push   0x8(%ebp)
+  801bba:	e8 9a ff ff ff       	call   801b59 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  801bbf:	c9                   	leave
+  801bc0:	c3                   	ret
+
+00801bc1 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  801bc1:	55                   	push   %ebp
+  801bc2:	89 e5                	mov    %esp,%ebp
+  801bc4:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  801bc7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bcc:	eb 03                	jmp    801bd1 <strlen+0x10>
+		n++;
+  801bce:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  801bd1:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  801bd5:	75 f7                	jne    801bce <strlen+0xd>
+	return n;
+}
+  801bd7:	5d                   	pop    %ebp
+  801bd8:	c3                   	ret
+
+00801bd9 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  801bd9:	55                   	push   %ebp
+  801bda:	89 e5                	mov    %esp,%ebp
+  801bdc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801bdf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801be2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801be7:	eb 03                	jmp    801bec <strnlen+0x13>
+		n++;
+  801be9:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801bec:	39 d0                	cmp    %edx,%eax
+  801bee:	74 08                	je     801bf8 <strnlen+0x1f>
+  801bf0:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  801bf4:	75 f3                	jne    801be9 <strnlen+0x10>
+  801bf6:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  801bf8:	89 d0                	mov    %edx,%eax
+  801bfa:	5d                   	pop    %ebp
+  801bfb:	c3                   	ret
+
+00801bfc <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801bfc:	55                   	push   %ebp
+  801bfd:	89 e5                	mov    %esp,%ebp
+  801bff:	53                   	push   %ebx
+  801c00:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801c03:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  801c06:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c0b:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  801c0f:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  801c12:	83 c0 01             	add    $0x1,%eax
+  801c15:	84 d2                	test   %dl,%dl
+  801c17:	75 f2                	jne    801c0b <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  801c19:	89 c8                	mov    %ecx,%eax
+  801c1b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c1e:	c9                   	leave
+  801c1f:	c3                   	ret
+
+00801c20 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801c20:	55                   	push   %ebp
+  801c21:	89 e5                	mov    %esp,%ebp
+  801c23:	53                   	push   %ebx
+  801c24:	83 ec 10             	sub    $0x10,%esp
+  801c27:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  801c2a:	53                   	push   %ebx
+  801c2b:	e8 91 ff ff ff       	call   801bc1 <strlen>
+  801c30:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  801c33:	ff 75 0c             	push   0xc(%ebp)
+  801c36:	01 d8                	add    %ebx,%eax
+  801c38:	50                   	push   %eax
+  801c39:	e8 be ff ff ff       	call   801bfc <strcpy>
+	return dst;
+}
+  801c3e:	89 d8                	mov    %ebx,%eax
+  801c40:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c43:	c9                   	leave
+  801c44:	c3                   	ret
+
+00801c45 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801c45:	55                   	push   %ebp
+  801c46:	89 e5                	mov    %esp,%ebp
+  801c48:	56                   	push   %esi
+  801c49:	53                   	push   %ebx
+  801c4a:	8b 75 08             	mov    0x8(%ebp),%esi
+  801c4d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  801c50:	89 f3                	mov    %esi,%ebx
+  801c52:	03 5d 10             	add    0x10(%ebp),%ebx
+  801c55:	89 f0                	mov    %esi,%eax
+  801c57:	eb 0f                	jmp    801c68 <strncpy+0x23>
+		*dst++ = *src;
+  801c59:	83 c0 01             	add    $0x1,%eax
+  801c5c:	0f b6 0a             	movzbl (%edx),%ecx
+  801c5f:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  801c62:	80 f9 01             	cmp    $0x1,%cl
+  801c65:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  801c68:	39 d8                	cmp    %ebx,%eax
+  801c6a:	75 ed                	jne    801c59 <strncpy+0x14>
+	}
+	return ret;
+}
+  801c6c:	89 f0                	mov    %esi,%eax
+  801c6e:	5b                   	pop    %ebx
+  801c6f:	5e                   	pop    %esi
+  801c70:	5d                   	pop    %ebp
+  801c71:	c3                   	ret
+
+00801c72 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801c72:	55                   	push   %ebp
+  801c73:	89 e5                	mov    %esp,%ebp
+  801c75:	56                   	push   %esi
+  801c76:	53                   	push   %ebx
+  801c77:	8b 75 08             	mov    0x8(%ebp),%esi
+  801c7a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c7d:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  801c80:	89 f0                	mov    %esi,%eax
+  801c82:	85 d2                	test   %edx,%edx
+  801c84:	74 21                	je     801ca7 <strlcpy+0x35>
+  801c86:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  801c8a:	89 f2                	mov    %esi,%edx
+  801c8c:	eb 09                	jmp    801c97 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  801c8e:	83 c1 01             	add    $0x1,%ecx
+  801c91:	83 c2 01             	add    $0x1,%edx
+  801c94:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  801c97:	39 c2                	cmp    %eax,%edx
+  801c99:	74 09                	je     801ca4 <strlcpy+0x32>
+  801c9b:	0f b6 19             	movzbl (%ecx),%ebx
+  801c9e:	84 db                	test   %bl,%bl
+  801ca0:	75 ec                	jne    801c8e <strlcpy+0x1c>
+  801ca2:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  801ca4:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  801ca7:	29 f0                	sub    %esi,%eax
+}
+  801ca9:	5b                   	pop    %ebx
+  801caa:	5e                   	pop    %esi
+  801cab:	5d                   	pop    %ebp
+  801cac:	c3                   	ret
+
+00801cad <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  801cad:	55                   	push   %ebp
+  801cae:	89 e5                	mov    %esp,%ebp
+  801cb0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801cb3:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  801cb6:	eb 06                	jmp    801cbe <strcmp+0x11>
+		p++, q++;
+  801cb8:	83 c1 01             	add    $0x1,%ecx
+  801cbb:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  801cbe:	0f b6 01             	movzbl (%ecx),%eax
+  801cc1:	84 c0                	test   %al,%al
+  801cc3:	74 04                	je     801cc9 <strcmp+0x1c>
+  801cc5:	3a 02                	cmp    (%edx),%al
+  801cc7:	74 ef                	je     801cb8 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801cc9:	0f b6 c0             	movzbl %al,%eax
+  801ccc:	0f b6 12             	movzbl (%edx),%edx
+  801ccf:	29 d0                	sub    %edx,%eax
+}
+  801cd1:	5d                   	pop    %ebp
+  801cd2:	c3                   	ret
+
+00801cd3 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801cd3:	55                   	push   %ebp
+  801cd4:	89 e5                	mov    %esp,%ebp
+  801cd6:	53                   	push   %ebx
+  801cd7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cda:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801cdd:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  801ce0:	eb 09                	jmp    801ceb <strncmp+0x18>
+		n--, p++, q++;
+  801ce2:	83 ea 01             	sub    $0x1,%edx
+  801ce5:	83 c0 01             	add    $0x1,%eax
+  801ce8:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  801ceb:	85 d2                	test   %edx,%edx
+  801ced:	74 18                	je     801d07 <strncmp+0x34>
+  801cef:	0f b6 18             	movzbl (%eax),%ebx
+  801cf2:	84 db                	test   %bl,%bl
+  801cf4:	74 04                	je     801cfa <strncmp+0x27>
+  801cf6:	3a 19                	cmp    (%ecx),%bl
+  801cf8:	74 e8                	je     801ce2 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801cfa:	0f b6 00             	movzbl (%eax),%eax
+  801cfd:	0f b6 11             	movzbl (%ecx),%edx
+  801d00:	29 d0                	sub    %edx,%eax
+}
+  801d02:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d05:	c9                   	leave
+  801d06:	c3                   	ret
+		return 0;
+  801d07:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d0c:	eb f4                	jmp    801d02 <strncmp+0x2f>
+
+00801d0e <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801d0e:	55                   	push   %ebp
+  801d0f:	89 e5                	mov    %esp,%ebp
+  801d11:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d14:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801d18:	eb 03                	jmp    801d1d <strchr+0xf>
+  801d1a:	83 c0 01             	add    $0x1,%eax
+  801d1d:	0f b6 10             	movzbl (%eax),%edx
+  801d20:	84 d2                	test   %dl,%dl
+  801d22:	74 06                	je     801d2a <strchr+0x1c>
+		if (*s == c)
+  801d24:	38 ca                	cmp    %cl,%dl
+  801d26:	75 f2                	jne    801d1a <strchr+0xc>
+  801d28:	eb 05                	jmp    801d2f <strchr+0x21>
+			return (char *) s;
+	return 0;
+  801d2a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d2f:	5d                   	pop    %ebp
+  801d30:	c3                   	ret
+
+00801d31 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801d31:	55                   	push   %ebp
+  801d32:	89 e5                	mov    %esp,%ebp
+  801d34:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d37:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801d3b:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  801d3e:	38 ca                	cmp    %cl,%dl
+  801d40:	74 09                	je     801d4b <strfind+0x1a>
+  801d42:	84 d2                	test   %dl,%dl
+  801d44:	74 05                	je     801d4b <strfind+0x1a>
+	for (; *s; s++)
+  801d46:	83 c0 01             	add    $0x1,%eax
+  801d49:	eb f0                	jmp    801d3b <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  801d4b:	5d                   	pop    %ebp
+  801d4c:	c3                   	ret
+
+00801d4d <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801d4d:	55                   	push   %ebp
+  801d4e:	89 e5                	mov    %esp,%ebp
+  801d50:	57                   	push   %edi
+  801d51:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801d54:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  801d57:	85 c9                	test   %ecx,%ecx
+  801d59:	74 20                	je     801d7b <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  801d5b:	89 f8                	mov    %edi,%eax
+  801d5d:	09 c8                	or     %ecx,%eax
+  801d5f:	a8 03                	test   $0x3,%al
+  801d61:	75 12                	jne    801d75 <memset+0x28>
+		c &= 0xFF;
+  801d63:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  801d67:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  801d6d:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  801d70:	fc                   	cld
+  801d71:	f3 ab                	rep stos %eax,%es:(%edi)
+  801d73:	eb 06                	jmp    801d7b <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801d75:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d78:	fc                   	cld
+  801d79:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  801d7b:	89 f8                	mov    %edi,%eax
+  801d7d:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  801d80:	c9                   	leave
+  801d81:	c3                   	ret
+
+00801d82 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801d82:	55                   	push   %ebp
+  801d83:	89 e5                	mov    %esp,%ebp
+  801d85:	57                   	push   %edi
+  801d86:	56                   	push   %esi
+  801d87:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d8a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801d8d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  801d90:	39 c6                	cmp    %eax,%esi
+  801d92:	73 32                	jae    801dc6 <memmove+0x44>
+  801d94:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  801d97:	39 d0                	cmp    %edx,%eax
+  801d99:	73 2b                	jae    801dc6 <memmove+0x44>
+		s += n;
+		d += n;
+  801d9b:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801d9e:	89 d6                	mov    %edx,%esi
+  801da0:	09 fe                	or     %edi,%esi
+  801da2:	09 ce                	or     %ecx,%esi
+  801da4:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  801daa:	75 0e                	jne    801dba <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801dac:	83 ef 04             	sub    $0x4,%edi
+  801daf:	8d 72 fc             	lea    -0x4(%edx),%esi
+  801db2:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  801db5:	fd                   	std
+  801db6:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801db8:	eb 09                	jmp    801dc3 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801dba:	83 ef 01             	sub    $0x1,%edi
+  801dbd:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  801dc0:	fd                   	std
+  801dc1:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801dc3:	fc                   	cld
+  801dc4:	eb 1a                	jmp    801de0 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801dc6:	89 f2                	mov    %esi,%edx
+  801dc8:	09 c2                	or     %eax,%edx
+  801dca:	09 ca                	or     %ecx,%edx
+  801dcc:	f6 c2 03             	test   $0x3,%dl
+  801dcf:	75 0a                	jne    801ddb <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801dd1:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  801dd4:	89 c7                	mov    %eax,%edi
+  801dd6:	fc                   	cld
+  801dd7:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801dd9:	eb 05                	jmp    801de0 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  801ddb:	89 c7                	mov    %eax,%edi
+  801ddd:	fc                   	cld
+  801dde:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  801de0:	5e                   	pop    %esi
+  801de1:	5f                   	pop    %edi
+  801de2:	5d                   	pop    %ebp
+  801de3:	c3                   	ret
+
+00801de4 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801de4:	55                   	push   %ebp
+  801de5:	89 e5                	mov    %esp,%ebp
+  801de7:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  801dea:	ff 75 10             	push   0x10(%ebp)
+  801ded:	ff 75 0c             	push   0xc(%ebp)
+  801df0:	ff 75 08             	push   0x8(%ebp)
+  801df3:	e8 8a ff ff ff       	call   801d82 <memmove>
+}
+  801df8:	c9                   	leave
+  801df9:	c3                   	ret
+
+00801dfa <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801dfa:	55                   	push   %ebp
+  801dfb:	89 e5                	mov    %esp,%ebp
+  801dfd:	56                   	push   %esi
+  801dfe:	53                   	push   %ebx
+  801dff:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e02:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  801e05:	89 c6                	mov    %eax,%esi
+  801e07:	03 75 10             	add    0x10(%ebp),%esi
+  801e0a:	eb 06                	jmp    801e12 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  801e0c:	83 c0 01             	add    $0x1,%eax
+  801e0f:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  801e12:	39 f0                	cmp    %esi,%eax
+  801e14:	74 14                	je     801e2a <memcmp+0x30>
+		if (*s1 != *s2)
+  801e16:	0f b6 08             	movzbl (%eax),%ecx
+  801e19:	0f b6 1a             	movzbl (%edx),%ebx
+  801e1c:	38 d9                	cmp    %bl,%cl
+  801e1e:	74 ec                	je     801e0c <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  801e20:	0f b6 c1             	movzbl %cl,%eax
+  801e23:	0f b6 db             	movzbl %bl,%ebx
+  801e26:	29 d8                	sub    %ebx,%eax
+  801e28:	eb 05                	jmp    801e2f <memcmp+0x35>
+	}
+
+	return 0;
+  801e2a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e2f:	5b                   	pop    %ebx
+  801e30:	5e                   	pop    %esi
+  801e31:	5d                   	pop    %ebp
+  801e32:	c3                   	ret
+
+00801e33 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801e33:	55                   	push   %ebp
+  801e34:	89 e5                	mov    %esp,%ebp
+  801e36:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e39:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  801e3c:	89 c2                	mov    %eax,%edx
+  801e3e:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  801e41:	eb 03                	jmp    801e46 <memfind+0x13>
+  801e43:	83 c0 01             	add    $0x1,%eax
+  801e46:	39 d0                	cmp    %edx,%eax
+  801e48:	73 04                	jae    801e4e <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801e4a:	38 08                	cmp    %cl,(%eax)
+  801e4c:	75 f5                	jne    801e43 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  801e4e:	5d                   	pop    %ebp
+  801e4f:	c3                   	ret
+
+00801e50 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  801e50:	55                   	push   %ebp
+  801e51:	89 e5                	mov    %esp,%ebp
+  801e53:	57                   	push   %edi
+  801e54:	56                   	push   %esi
+  801e55:	53                   	push   %ebx
+  801e56:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e59:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801e5c:	eb 03                	jmp    801e61 <strtol+0x11>
+		s++;
+  801e5e:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  801e61:	0f b6 02             	movzbl (%edx),%eax
+  801e64:	3c 20                	cmp    $0x20,%al
+  801e66:	74 f6                	je     801e5e <strtol+0xe>
+  801e68:	3c 09                	cmp    $0x9,%al
+  801e6a:	74 f2                	je     801e5e <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  801e6c:	3c 2b                	cmp    $0x2b,%al
+  801e6e:	74 2a                	je     801e9a <strtol+0x4a>
+	int neg = 0;
+  801e70:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  801e75:	3c 2d                	cmp    $0x2d,%al
+  801e77:	74 2b                	je     801ea4 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801e79:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  801e7f:	75 0f                	jne    801e90 <strtol+0x40>
+  801e81:	80 3a 30             	cmpb   $0x30,(%edx)
+  801e84:	74 28                	je     801eae <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  801e86:	85 db                	test   %ebx,%ebx
+  801e88:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801e8d:	0f 44 d8             	cmove  %eax,%ebx
+  801e90:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e95:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  801e98:	eb 46                	jmp    801ee0 <strtol+0x90>
+		s++;
+  801e9a:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  801e9d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ea2:	eb d5                	jmp    801e79 <strtol+0x29>
+		s++, neg = 1;
+  801ea4:	83 c2 01             	add    $0x1,%edx
+  801ea7:	bf 01 00 00 00       	mov    $0x1,%edi
+  801eac:	eb cb                	jmp    801e79 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801eae:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  801eb2:	74 0e                	je     801ec2 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  801eb4:	85 db                	test   %ebx,%ebx
+  801eb6:	75 d8                	jne    801e90 <strtol+0x40>
+		s++, base = 8;
+  801eb8:	83 c2 01             	add    $0x1,%edx
+  801ebb:	bb 08 00 00 00       	mov    $0x8,%ebx
+  801ec0:	eb ce                	jmp    801e90 <strtol+0x40>
+		s += 2, base = 16;
+  801ec2:	83 c2 02             	add    $0x2,%edx
+  801ec5:	bb 10 00 00 00       	mov    $0x10,%ebx
+  801eca:	eb c4                	jmp    801e90 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  801ecc:	0f be c0             	movsbl %al,%eax
+  801ecf:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  801ed2:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801ed5:	7d 3a                	jge    801f11 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  801ed7:	83 c2 01             	add    $0x1,%edx
+  801eda:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  801ede:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  801ee0:	0f b6 02             	movzbl (%edx),%eax
+  801ee3:	8d 70 d0             	lea    -0x30(%eax),%esi
+  801ee6:	89 f3                	mov    %esi,%ebx
+  801ee8:	80 fb 09             	cmp    $0x9,%bl
+  801eeb:	76 df                	jbe    801ecc <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  801eed:	8d 70 9f             	lea    -0x61(%eax),%esi
+  801ef0:	89 f3                	mov    %esi,%ebx
+  801ef2:	80 fb 19             	cmp    $0x19,%bl
+  801ef5:	77 08                	ja     801eff <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  801ef7:	0f be c0             	movsbl %al,%eax
+  801efa:	83 e8 57             	sub    $0x57,%eax
+  801efd:	eb d3                	jmp    801ed2 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  801eff:	8d 70 bf             	lea    -0x41(%eax),%esi
+  801f02:	89 f3                	mov    %esi,%ebx
+  801f04:	80 fb 19             	cmp    $0x19,%bl
+  801f07:	77 08                	ja     801f11 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  801f09:	0f be c0             	movsbl %al,%eax
+  801f0c:	83 e8 37             	sub    $0x37,%eax
+  801f0f:	eb c1                	jmp    801ed2 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801f11:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  801f15:	74 05                	je     801f1c <strtol+0xcc>
+		*endptr = (char *) s;
+  801f17:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f1a:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  801f1c:	89 c8                	mov    %ecx,%eax
+  801f1e:	f7 d8                	neg    %eax
+  801f20:	85 ff                	test   %edi,%edi
+  801f22:	0f 45 c8             	cmovne %eax,%ecx
+}
+  801f25:	89 c8                	mov    %ecx,%eax
+  801f27:	5b                   	pop    %ebx
+  801f28:	5e                   	pop    %esi
+  801f29:	5f                   	pop    %edi
+  801f2a:	5d                   	pop    %ebp
+  801f2b:	c3                   	ret
+
+00801f2c <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  801f2c:	55                   	push   %ebp
+  801f2d:	89 e5                	mov    %esp,%ebp
+  801f2f:	56                   	push   %esi
+  801f30:	53                   	push   %ebx
+  801f31:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f34:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f37:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  801f3a:	85 c0                	test   %eax,%eax
+  801f3c:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801f41:	0f 44 c2             	cmove  %edx,%eax
+  801f44:	83 ec 0c             	sub    $0xc,%esp
+  801f47:	50                   	push   %eax
+  801f48:	e8 e7 e3 ff ff       	call   800334 <sys_ipc_recv>
+
+  if (from_env_store)
+  801f4d:	83 c4 10             	add    $0x10,%esp
+  801f50:	85 f6                	test   %esi,%esi
+  801f52:	74 17                	je     801f6b <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  801f54:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f59:	85 c0                	test   %eax,%eax
+  801f5b:	75 0c                	jne    801f69 <ipc_recv+0x3d>
+  801f5d:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801f63:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  801f69:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  801f6b:	85 db                	test   %ebx,%ebx
+  801f6d:	74 2b                	je     801f9a <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  801f6f:	85 c0                	test   %eax,%eax
+  801f71:	74 0d                	je     801f80 <ipc_recv+0x54>
+  801f73:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  801f79:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f7c:	5b                   	pop    %ebx
+  801f7d:	5e                   	pop    %esi
+  801f7e:	5d                   	pop    %ebp
+  801f7f:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  801f80:	a1 08 40 80 00       	mov    0x804008,%eax
+  801f85:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  801f8b:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  801f8d:	a1 08 40 80 00       	mov    0x804008,%eax
+  801f92:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  801f98:	eb df                	jmp    801f79 <ipc_recv+0x4d>
+  801f9a:	85 c0                	test   %eax,%eax
+  801f9c:	75 db                	jne    801f79 <ipc_recv+0x4d>
+  801f9e:	eb ed                	jmp    801f8d <ipc_recv+0x61>
+
+00801fa0 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  801fa0:	55                   	push   %ebp
+  801fa1:	89 e5                	mov    %esp,%ebp
+  801fa3:	57                   	push   %edi
+  801fa4:	56                   	push   %esi
+  801fa5:	53                   	push   %ebx
+  801fa6:	83 ec 0c             	sub    $0xc,%esp
+  801fa9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801fac:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801faf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  801fb2:	85 db                	test   %ebx,%ebx
+  801fb4:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801fb9:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  801fbc:	ff 75 14             	push   0x14(%ebp)
+  801fbf:	53                   	push   %ebx
+  801fc0:	56                   	push   %esi
+  801fc1:	57                   	push   %edi
+  801fc2:	e8 4a e3 ff ff       	call   800311 <sys_ipc_try_send>
+  801fc7:	83 c4 10             	add    $0x10,%esp
+  801fca:	85 c0                	test   %eax,%eax
+  801fcc:	74 1e                	je     801fec <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  801fce:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801fd1:	75 07                	jne    801fda <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  801fd3:	e8 8d e1 ff ff       	call   800165 <sys_yield>
+  801fd8:	eb e2                	jmp    801fbc <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  801fda:	50                   	push   %eax
+  801fdb:	68 a3 29 80 00       	push   $0x8029a3
+  801fe0:	6a 3c                	push   $0x3c
+  801fe2:	68 b0 29 80 00       	push   $0x8029b0
+  801fe7:	e8 7c f5 ff ff       	call   801568 <_panic>
+  }
+
+#endif
+}
+  801fec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fef:	5b                   	pop    %ebx
+  801ff0:	5e                   	pop    %esi
+  801ff1:	5f                   	pop    %edi
+  801ff2:	5d                   	pop    %ebp
+  801ff3:	c3                   	ret
+
+00801ff4 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  801ff4:	55                   	push   %ebp
+  801ff5:	89 e5                	mov    %esp,%ebp
+  801ff7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  801ffa:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  801fff:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802002:	c1 e0 04             	shl    $0x4,%eax
+  802005:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80200a:	8b 40 50             	mov    0x50(%eax),%eax
+  80200d:	39 c8                	cmp    %ecx,%eax
+  80200f:	74 12                	je     802023 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  802011:	83 c2 01             	add    $0x1,%edx
+  802014:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  80201a:	75 e3                	jne    801fff <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  80201c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802021:	eb 0e                	jmp    802031 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  802023:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802026:	c1 e0 04             	shl    $0x4,%eax
+  802029:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80202e:	8b 40 48             	mov    0x48(%eax),%eax
+  802031:	5d                   	pop    %ebp
+  802032:	c3                   	ret
+
+00802033 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802033:	55                   	push   %ebp
+  802034:	89 e5                	mov    %esp,%ebp
+  802036:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802039:	89 c2                	mov    %eax,%edx
+  80203b:	c1 ea 16             	shr    $0x16,%edx
+  80203e:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802045:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80204a:	f6 c1 01             	test   $0x1,%cl
+  80204d:	74 1c                	je     80206b <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  80204f:	c1 e8 0c             	shr    $0xc,%eax
+  802052:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802059:	a8 01                	test   $0x1,%al
+  80205b:	74 0e                	je     80206b <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80205d:	c1 e8 0c             	shr    $0xc,%eax
+  802060:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802067:	ef 
+  802068:	0f b7 d2             	movzwl %dx,%edx
+}
+  80206b:	89 d0                	mov    %edx,%eax
+  80206d:	5d                   	pop    %ebp
+  80206e:	c3                   	ret
+  80206f:	90                   	nop
+
+00802070 <__udivmoddi4>:
+  802070:	55                   	push   %ebp
+  802071:	57                   	push   %edi
+  802072:	56                   	push   %esi
+  802073:	53                   	push   %ebx
+  802074:	83 ec 24             	sub    $0x24,%esp
+  802077:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80207b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80207f:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  802083:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802087:	8b 54 24 44          	mov    0x44(%esp),%edx
+  80208b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80208f:	8b 44 24 40          	mov    0x40(%esp),%eax
+  802093:	89 d3                	mov    %edx,%ebx
+  802095:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802099:	09 c3                	or     %eax,%ebx
+  80209b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80209f:	0f 84 9c 00 00 00    	je     802141 <__udivmoddi4+0xd1>
+  8020a5:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8020ac:	00 
+  8020ad:	31 c0                	xor    %eax,%eax
+  8020af:	31 d2                	xor    %edx,%edx
+  8020b1:	89 fb                	mov    %edi,%ebx
+  8020b3:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8020ba:	00 
+  8020bb:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8020c0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8020c4:	01 c0                	add    %eax,%eax
+  8020c6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8020cd:	00 
+  8020ce:	89 c6                	mov    %eax,%esi
+  8020d0:	89 d7                	mov    %edx,%edi
+  8020d2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8020d6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8020da:	0f ad d0             	shrd   %cl,%edx,%eax
+  8020dd:	d3 ea                	shr    %cl,%edx
+  8020df:	f6 c1 20             	test   $0x20,%cl
+  8020e2:	0f 45 c2             	cmovne %edx,%eax
+  8020e5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8020e9:	83 e0 01             	and    $0x1,%eax
+  8020ec:	09 fa                	or     %edi,%edx
+  8020ee:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8020f2:	89 04 24             	mov    %eax,(%esp)
+  8020f5:	8b 04 24             	mov    (%esp),%eax
+  8020f8:	89 d5                	mov    %edx,%ebp
+  8020fa:	09 f0                	or     %esi,%eax
+  8020fc:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802100:	39 f0                	cmp    %esi,%eax
+  802102:	19 fd                	sbb    %edi,%ebp
+  802104:	72 1d                	jb     802123 <__udivmoddi4+0xb3>
+  802106:	29 f0                	sub    %esi,%eax
+  802108:	19 fa                	sbb    %edi,%edx
+  80210a:	89 cf                	mov    %ecx,%edi
+  80210c:	c1 ef 05             	shr    $0x5,%edi
+  80210f:	83 e7 01             	and    $0x1,%edi
+  802112:	89 fe                	mov    %edi,%esi
+  802114:	d3 e7                	shl    %cl,%edi
+  802116:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80211a:	83 f6 01             	xor    $0x1,%esi
+  80211d:	d3 e6                	shl    %cl,%esi
+  80211f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802123:	83 e9 01             	sub    $0x1,%ecx
+  802126:	73 98                	jae    8020c0 <__udivmoddi4+0x50>
+  802128:	85 db                	test   %ebx,%ebx
+  80212a:	74 05                	je     802131 <__udivmoddi4+0xc1>
+  80212c:	89 03                	mov    %eax,(%ebx)
+  80212e:	89 53 04             	mov    %edx,0x4(%ebx)
+  802131:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802135:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802139:	83 c4 24             	add    $0x24,%esp
+  80213c:	5b                   	pop    %ebx
+  80213d:	5e                   	pop    %esi
+  80213e:	5f                   	pop    %edi
+  80213f:	5d                   	pop    %ebp
+  802140:	c3                   	ret
+  802141:	85 ff                	test   %edi,%edi
+  802143:	74 0d                	je     802152 <__udivmoddi4+0xe2>
+  802145:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  80214b:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  802152:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802156:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80215a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80215e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802162:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802166:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80216a:	83 c4 24             	add    $0x24,%esp
+  80216d:	5b                   	pop    %ebx
+  80216e:	5e                   	pop    %esi
+  80216f:	5f                   	pop    %edi
+  802170:	5d                   	pop    %ebp
+  802171:	c3                   	ret
+  802172:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802179:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00802180 <__udivdi3>:
+  802180:	57                   	push   %edi
+  802181:	56                   	push   %esi
+  802182:	53                   	push   %ebx
+  802183:	83 ec 20             	sub    $0x20,%esp
+  802186:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80218a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80218e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802192:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802196:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80219a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80219e:	89 d1                	mov    %edx,%ecx
+  8021a0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8021a4:	09 c1                	or     %eax,%ecx
+  8021a6:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8021aa:	89 44 24 18          	mov    %eax,0x18(%esp)
+  8021ae:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  8021b2:	0f 84 88 00 00 00    	je     802240 <__udivdi3+0xc0>
+  8021b8:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8021bf:	00 
+  8021c0:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8021c5:	31 c0                	xor    %eax,%eax
+  8021c7:	31 d2                	xor    %edx,%edx
+  8021c9:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8021d0:	00 
+  8021d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8021d8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8021dc:	01 c0                	add    %eax,%eax
+  8021de:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8021e5:	00 
+  8021e6:	89 c6                	mov    %eax,%esi
+  8021e8:	89 d7                	mov    %edx,%edi
+  8021ea:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8021ee:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8021f2:	0f ad d0             	shrd   %cl,%edx,%eax
+  8021f5:	d3 ea                	shr    %cl,%edx
+  8021f7:	f6 c1 20             	test   $0x20,%cl
+  8021fa:	0f 45 c2             	cmovne %edx,%eax
+  8021fd:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802201:	83 e0 01             	and    $0x1,%eax
+  802204:	09 fa                	or     %edi,%edx
+  802206:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80220a:	89 04 24             	mov    %eax,(%esp)
+  80220d:	8b 04 24             	mov    (%esp),%eax
+  802210:	89 d3                	mov    %edx,%ebx
+  802212:	09 f0                	or     %esi,%eax
+  802214:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802218:	39 f0                	cmp    %esi,%eax
+  80221a:	19 fb                	sbb    %edi,%ebx
+  80221c:	72 1d                	jb     80223b <__udivdi3+0xbb>
+  80221e:	29 f0                	sub    %esi,%eax
+  802220:	19 fa                	sbb    %edi,%edx
+  802222:	89 cf                	mov    %ecx,%edi
+  802224:	c1 ef 05             	shr    $0x5,%edi
+  802227:	83 e7 01             	and    $0x1,%edi
+  80222a:	89 fe                	mov    %edi,%esi
+  80222c:	d3 e7                	shl    %cl,%edi
+  80222e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802232:	83 f6 01             	xor    $0x1,%esi
+  802235:	d3 e6                	shl    %cl,%esi
+  802237:	09 74 24 18          	or     %esi,0x18(%esp)
+  80223b:	83 e9 01             	sub    $0x1,%ecx
+  80223e:	73 98                	jae    8021d8 <__udivdi3+0x58>
+  802240:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802244:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802248:	83 c4 20             	add    $0x20,%esp
+  80224b:	5b                   	pop    %ebx
+  80224c:	5e                   	pop    %esi
+  80224d:	5f                   	pop    %edi
+  80224e:	c3                   	ret
+  80224f:	90                   	nop
+
+00802250 <__umoddi3>:
+  802250:	57                   	push   %edi
+  802251:	56                   	push   %esi
+  802252:	53                   	push   %ebx
+  802253:	83 ec 18             	sub    $0x18,%esp
+  802256:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80225a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80225e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802262:	8b 54 24 34          	mov    0x34(%esp),%edx
+  802266:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80226a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80226e:	89 d1                	mov    %edx,%ecx
+  802270:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802274:	09 c1                	or     %eax,%ecx
+  802276:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80227a:	74 5b                	je     8022d7 <__umoddi3+0x87>
+  80227c:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802281:	31 c0                	xor    %eax,%eax
+  802283:	31 d2                	xor    %edx,%edx
+  802285:	8d 76 00             	lea    0x0(%esi),%esi
+  802288:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80228c:	01 c0                	add    %eax,%eax
+  80228e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802295:	00 
+  802296:	89 c6                	mov    %eax,%esi
+  802298:	89 d7                	mov    %edx,%edi
+  80229a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80229e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8022a2:	0f ad d0             	shrd   %cl,%edx,%eax
+  8022a5:	d3 ea                	shr    %cl,%edx
+  8022a7:	f6 c1 20             	test   $0x20,%cl
+  8022aa:	0f 45 c2             	cmovne %edx,%eax
+  8022ad:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8022b1:	83 e0 01             	and    $0x1,%eax
+  8022b4:	09 fa                	or     %edi,%edx
+  8022b6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8022ba:	89 04 24             	mov    %eax,(%esp)
+  8022bd:	8b 04 24             	mov    (%esp),%eax
+  8022c0:	89 d3                	mov    %edx,%ebx
+  8022c2:	09 f0                	or     %esi,%eax
+  8022c4:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8022c8:	39 f0                	cmp    %esi,%eax
+  8022ca:	19 fb                	sbb    %edi,%ebx
+  8022cc:	72 04                	jb     8022d2 <__umoddi3+0x82>
+  8022ce:	29 f0                	sub    %esi,%eax
+  8022d0:	19 fa                	sbb    %edi,%edx
+  8022d2:	83 e9 01             	sub    $0x1,%ecx
+  8022d5:	73 b1                	jae    802288 <__umoddi3+0x38>
+  8022d7:	83 c4 18             	add    $0x18,%esp
+  8022da:	5b                   	pop    %ebx
+  8022db:	5e                   	pop    %esi
+  8022dc:	5f                   	pop    %edi
+  8022dd:	c3                   	ret
+  8022de:	66 90                	xchg   %ax,%ax
+
+008022e0 <__divdi3>:
+  8022e0:	55                   	push   %ebp
+  8022e1:	57                   	push   %edi
+  8022e2:	56                   	push   %esi
+  8022e3:	53                   	push   %ebx
+  8022e4:	83 ec 24             	sub    $0x24,%esp
+  8022e7:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  8022eb:	8b 74 24 44          	mov    0x44(%esp),%esi
+  8022ef:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8022f3:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8022f7:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  8022fb:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8022ff:	85 d2                	test   %edx,%edx
+  802301:	0f 88 e0 00 00 00    	js     8023e7 <__divdi3+0x107>
+  802307:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  80230b:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  80230f:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802313:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802317:	85 f6                	test   %esi,%esi
+  802319:	78 16                	js     802331 <__divdi3+0x51>
+  80231b:	89 f1                	mov    %esi,%ecx
+  80231d:	31 c0                	xor    %eax,%eax
+  80231f:	31 d2                	xor    %edx,%edx
+  802321:	09 d9                	or     %ebx,%ecx
+  802323:	0f 85 f3 00 00 00    	jne    80241c <__divdi3+0x13c>
+  802329:	83 c4 24             	add    $0x24,%esp
+  80232c:	5b                   	pop    %ebx
+  80232d:	5e                   	pop    %esi
+  80232e:	5f                   	pop    %edi
+  80232f:	5d                   	pop    %ebp
+  802330:	c3                   	ret
+  802331:	bf 01 00 00 00       	mov    $0x1,%edi
+  802336:	f7 5c 24 08          	negl   0x8(%esp)
+  80233a:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  80233f:	f7 5c 24 0c          	negl   0xc(%esp)
+  802343:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80234a:	00 
+  80234b:	31 c0                	xor    %eax,%eax
+  80234d:	31 d2                	xor    %edx,%edx
+  80234f:	89 fb                	mov    %edi,%ebx
+  802351:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802358:	00 
+  802359:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80235e:	66 90                	xchg   %ax,%ax
+  802360:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802364:	01 c0                	add    %eax,%eax
+  802366:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80236d:	00 
+  80236e:	89 c6                	mov    %eax,%esi
+  802370:	89 d7                	mov    %edx,%edi
+  802372:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802376:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80237a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80237d:	d3 ea                	shr    %cl,%edx
+  80237f:	f6 c1 20             	test   $0x20,%cl
+  802382:	0f 45 c2             	cmovne %edx,%eax
+  802385:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802389:	83 e0 01             	and    $0x1,%eax
+  80238c:	09 fa                	or     %edi,%edx
+  80238e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802392:	89 04 24             	mov    %eax,(%esp)
+  802395:	8b 04 24             	mov    (%esp),%eax
+  802398:	89 d5                	mov    %edx,%ebp
+  80239a:	09 f0                	or     %esi,%eax
+  80239c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8023a0:	39 f0                	cmp    %esi,%eax
+  8023a2:	19 fd                	sbb    %edi,%ebp
+  8023a4:	72 1d                	jb     8023c3 <__divdi3+0xe3>
+  8023a6:	29 f0                	sub    %esi,%eax
+  8023a8:	19 fa                	sbb    %edi,%edx
+  8023aa:	89 cf                	mov    %ecx,%edi
+  8023ac:	c1 ef 05             	shr    $0x5,%edi
+  8023af:	83 e7 01             	and    $0x1,%edi
+  8023b2:	89 fe                	mov    %edi,%esi
+  8023b4:	d3 e7                	shl    %cl,%edi
+  8023b6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8023ba:	83 f6 01             	xor    $0x1,%esi
+  8023bd:	d3 e6                	shl    %cl,%esi
+  8023bf:	09 74 24 18          	or     %esi,0x18(%esp)
+  8023c3:	83 e9 01             	sub    $0x1,%ecx
+  8023c6:	73 98                	jae    802360 <__divdi3+0x80>
+  8023c8:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8023cc:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8023d0:	85 db                	test   %ebx,%ebx
+  8023d2:	0f 84 51 ff ff ff    	je     802329 <__divdi3+0x49>
+  8023d8:	f7 d8                	neg    %eax
+  8023da:	83 d2 00             	adc    $0x0,%edx
+  8023dd:	83 c4 24             	add    $0x24,%esp
+  8023e0:	5b                   	pop    %ebx
+  8023e1:	f7 da                	neg    %edx
+  8023e3:	5e                   	pop    %esi
+  8023e4:	5f                   	pop    %edi
+  8023e5:	5d                   	pop    %ebp
+  8023e6:	c3                   	ret
+  8023e7:	f7 d8                	neg    %eax
+  8023e9:	83 d2 00             	adc    $0x0,%edx
+  8023ec:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8023f0:	f7 da                	neg    %edx
+  8023f2:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8023f6:	85 f6                	test   %esi,%esi
+  8023f8:	78 1b                	js     802415 <__divdi3+0x135>
+  8023fa:	89 f1                	mov    %esi,%ecx
+  8023fc:	31 c0                	xor    %eax,%eax
+  8023fe:	31 d2                	xor    %edx,%edx
+  802400:	bf 01 00 00 00       	mov    $0x1,%edi
+  802405:	09 d9                	or     %ebx,%ecx
+  802407:	0f 85 36 ff ff ff    	jne    802343 <__divdi3+0x63>
+  80240d:	83 c4 24             	add    $0x24,%esp
+  802410:	5b                   	pop    %ebx
+  802411:	5e                   	pop    %esi
+  802412:	5f                   	pop    %edi
+  802413:	5d                   	pop    %ebp
+  802414:	c3                   	ret
+  802415:	31 ff                	xor    %edi,%edi
+  802417:	e9 1a ff ff ff       	jmp    802336 <__divdi3+0x56>
+  80241c:	31 ff                	xor    %edi,%edi
+  80241e:	e9 20 ff ff ff       	jmp    802343 <__divdi3+0x63>
+  802423:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80242a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00802430 <__moddi3>:
+  802430:	55                   	push   %ebp
+  802431:	57                   	push   %edi
+  802432:	56                   	push   %esi
+  802433:	53                   	push   %ebx
+  802434:	83 ec 1c             	sub    $0x1c,%esp
+  802437:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  80243b:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  80243f:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  802443:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  802447:	89 c8                	mov    %ecx,%eax
+  802449:	89 f2                	mov    %esi,%edx
+  80244b:	89 f3                	mov    %esi,%ebx
+  80244d:	85 ed                	test   %ebp,%ebp
+  80244f:	0f 88 9d 00 00 00    	js     8024f2 <__moddi3+0xc2>
+  802455:	09 cb                	or     %ecx,%ebx
+  802457:	0f 84 8d 00 00 00    	je     8024ea <__moddi3+0xba>
+  80245d:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802461:	31 db                	xor    %ebx,%ebx
+  802463:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802467:	89 ca                	mov    %ecx,%edx
+  802469:	89 f0                	mov    %esi,%eax
+  80246b:	89 dd                	mov    %ebx,%ebp
+  80246d:	f7 da                	neg    %edx
+  80246f:	83 d0 00             	adc    $0x0,%eax
+  802472:	f7 d8                	neg    %eax
+  802474:	0f 49 f0             	cmovns %eax,%esi
+  802477:	0f 49 ca             	cmovns %edx,%ecx
+  80247a:	31 c0                	xor    %eax,%eax
+  80247c:	31 d2                	xor    %edx,%edx
+  80247e:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802482:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802486:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80248b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80248f:	90                   	nop
+  802490:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802494:	01 c0                	add    %eax,%eax
+  802496:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80249d:	00 
+  80249e:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  8024a2:	89 c6                	mov    %eax,%esi
+  8024a4:	89 d7                	mov    %edx,%edi
+  8024a6:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8024aa:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8024ae:	0f ad d0             	shrd   %cl,%edx,%eax
+  8024b1:	d3 ea                	shr    %cl,%edx
+  8024b3:	f6 c1 20             	test   $0x20,%cl
+  8024b6:	0f 45 c2             	cmovne %edx,%eax
+  8024b9:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8024bd:	83 e0 01             	and    $0x1,%eax
+  8024c0:	09 fa                	or     %edi,%edx
+  8024c2:	89 04 24             	mov    %eax,(%esp)
+  8024c5:	8b 04 24             	mov    (%esp),%eax
+  8024c8:	89 d7                	mov    %edx,%edi
+  8024ca:	09 f0                	or     %esi,%eax
+  8024cc:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  8024d0:	39 d8                	cmp    %ebx,%eax
+  8024d2:	19 f7                	sbb    %esi,%edi
+  8024d4:	72 04                	jb     8024da <__moddi3+0xaa>
+  8024d6:	29 d8                	sub    %ebx,%eax
+  8024d8:	19 f2                	sbb    %esi,%edx
+  8024da:	83 e9 01             	sub    $0x1,%ecx
+  8024dd:	73 b1                	jae    802490 <__moddi3+0x60>
+  8024df:	85 ed                	test   %ebp,%ebp
+  8024e1:	74 07                	je     8024ea <__moddi3+0xba>
+  8024e3:	f7 d8                	neg    %eax
+  8024e5:	83 d2 00             	adc    $0x0,%edx
+  8024e8:	f7 da                	neg    %edx
+  8024ea:	83 c4 1c             	add    $0x1c,%esp
+  8024ed:	5b                   	pop    %ebx
+  8024ee:	5e                   	pop    %esi
+  8024ef:	5f                   	pop    %edi
+  8024f0:	5d                   	pop    %ebp
+  8024f1:	c3                   	ret
+  8024f2:	09 cb                	or     %ecx,%ebx
+  8024f4:	74 f4                	je     8024ea <__moddi3+0xba>
+  8024f6:	f7 df                	neg    %edi
+  8024f8:	bb 01 00 00 00       	mov    $0x1,%ebx
+  8024fd:	83 d5 00             	adc    $0x0,%ebp
+  802500:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802504:	f7 dd                	neg    %ebp
+  802506:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  80250a:	e9 58 ff ff ff       	jmp    802467 <__moddi3+0x37>
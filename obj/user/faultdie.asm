@@ -0,0 +1,5400 @@
+
+obj/user/faultdie.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 4f 00 00 00       	call   800080 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <handler>:
+
+#include <inc/lib.h>
+
+void
+handler(struct UTrapframe *utf)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 0c             	sub    $0xc,%esp
+  800039:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void*)utf->utf_fault_va;
+	uint32_t err = utf->utf_err;
+	cprintf("i faulted at va %x, err %x\n", addr, err & 7);
+  80003c:	8b 42 04             	mov    0x4(%edx),%eax
+  80003f:	83 e0 07             	and    $0x7,%eax
+  800042:	50                   	push   %eax
+  800043:	ff 32                	push   (%edx)
+  800045:	68 c0 25 80 00       	push   $0x8025c0
+  80004a:	e8 29 01 00 00       	call   800178 <cprintf>
+	sys_env_destroy(sys_getenvid());
+  80004f:	e8 8b 0a 00 00       	call   800adf <sys_getenvid>
+  800054:	89 04 24             	mov    %eax,(%esp)
+  800057:	e8 42 0a 00 00       	call   800a9e <sys_env_destroy>
+}
+  80005c:	83 c4 10             	add    $0x10,%esp
+  80005f:	c9                   	leave
+  800060:	c3                   	ret
+
+00800061 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800061:	55                   	push   %ebp
+  800062:	89 e5                	mov    %esp,%ebp
+  800064:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(handler);
+  800067:	68 33 00 80 00       	push   $0x800033
+  80006c:	e8 7f 0d 00 00       	call   800df0 <set_pgfault_handler>
+	*(int*)0xDeadBeef = 0;
+  800071:	c7 05 ef be ad de 00 	movl   $0x0,0xdeadbeef
+  800078:	00 00 00 
+}
+  80007b:	83 c4 10             	add    $0x10,%esp
+  80007e:	c9                   	leave
+  80007f:	c3                   	ret
+
+00800080 <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  800080:	55                   	push   %ebp
+  800081:	89 e5                	mov    %esp,%ebp
+  800083:	56                   	push   %esi
+  800084:	53                   	push   %ebx
+  800085:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800088:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  80008b:	e8 4f 0a 00 00       	call   800adf <sys_getenvid>
+  800090:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800095:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800098:	c1 e0 04             	shl    $0x4,%eax
+  80009b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000a0:	a3 08 40 80 00       	mov    %eax,0x804008
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8000a5:	85 db                	test   %ebx,%ebx
+  8000a7:	7e 07                	jle    8000b0 <libmain+0x30>
+    binaryname = argv[0];
+  8000a9:	8b 06                	mov    (%esi),%eax
+  8000ab:	a3 00 30 80 00       	mov    %eax,0x803000
+
+  // call user main routine
+  umain(argc, argv);
+  8000b0:	83 ec 08             	sub    $0x8,%esp
+  8000b3:	56                   	push   %esi
+  8000b4:	53                   	push   %ebx
+  8000b5:	e8 a7 ff ff ff       	call   800061 <umain>
+
+  // exit gracefully
+  exit();
+  8000ba:	e8 0a 00 00 00       	call   8000c9 <exit>
+}
+  8000bf:	83 c4 10             	add    $0x10,%esp
+  8000c2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000c5:	5b                   	pop    %ebx
+  8000c6:	5e                   	pop    %esi
+  8000c7:	5d                   	pop    %ebp
+  8000c8:	c3                   	ret
+
+008000c9 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000c9:	55                   	push   %ebp
+  8000ca:	89 e5                	mov    %esp,%ebp
+  8000cc:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8000cf:	e8 7f 0f 00 00       	call   801053 <close_all>
+	sys_env_destroy(0);
+  8000d4:	83 ec 0c             	sub    $0xc,%esp
+  8000d7:	6a 00                	push   $0x0
+  8000d9:	e8 c0 09 00 00       	call   800a9e <sys_env_destroy>
+}
+  8000de:	83 c4 10             	add    $0x10,%esp
+  8000e1:	c9                   	leave
+  8000e2:	c3                   	ret
+
+008000e3 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8000e3:	55                   	push   %ebp
+  8000e4:	89 e5                	mov    %esp,%ebp
+  8000e6:	53                   	push   %ebx
+  8000e7:	83 ec 04             	sub    $0x4,%esp
+  8000ea:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8000ed:	8b 13                	mov    (%ebx),%edx
+  8000ef:	8d 42 01             	lea    0x1(%edx),%eax
+  8000f2:	89 03                	mov    %eax,(%ebx)
+  8000f4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8000f7:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8000fb:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800100:	74 09                	je     80010b <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800102:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800106:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800109:	c9                   	leave
+  80010a:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80010b:	83 ec 08             	sub    $0x8,%esp
+  80010e:	68 ff 00 00 00       	push   $0xff
+  800113:	8d 43 08             	lea    0x8(%ebx),%eax
+  800116:	50                   	push   %eax
+  800117:	e8 45 09 00 00       	call   800a61 <sys_cputs>
+		b->idx = 0;
+  80011c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800122:	83 c4 10             	add    $0x10,%esp
+  800125:	eb db                	jmp    800102 <putch+0x1f>
+
+00800127 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800127:	55                   	push   %ebp
+  800128:	89 e5                	mov    %esp,%ebp
+  80012a:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800130:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800137:	00 00 00 
+	b.cnt = 0;
+  80013a:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800141:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800144:	ff 75 0c             	push   0xc(%ebp)
+  800147:	ff 75 08             	push   0x8(%ebp)
+  80014a:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800150:	50                   	push   %eax
+  800151:	68 e3 00 80 00       	push   $0x8000e3
+  800156:	e8 14 01 00 00       	call   80026f <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80015b:	83 c4 08             	add    $0x8,%esp
+  80015e:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800164:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80016a:	50                   	push   %eax
+  80016b:	e8 f1 08 00 00       	call   800a61 <sys_cputs>
+
+	return b.cnt;
+}
+  800170:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800176:	c9                   	leave
+  800177:	c3                   	ret
+
+00800178 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800178:	55                   	push   %ebp
+  800179:	89 e5                	mov    %esp,%ebp
+  80017b:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80017e:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800181:	50                   	push   %eax
+  800182:	ff 75 08             	push   0x8(%ebp)
+  800185:	e8 9d ff ff ff       	call   800127 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80018a:	c9                   	leave
+  80018b:	c3                   	ret
+
+0080018c <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80018c:	55                   	push   %ebp
+  80018d:	89 e5                	mov    %esp,%ebp
+  80018f:	57                   	push   %edi
+  800190:	56                   	push   %esi
+  800191:	53                   	push   %ebx
+  800192:	83 ec 1c             	sub    $0x1c,%esp
+  800195:	89 c7                	mov    %eax,%edi
+  800197:	89 d6                	mov    %edx,%esi
+  800199:	8b 45 08             	mov    0x8(%ebp),%eax
+  80019c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80019f:	89 d1                	mov    %edx,%ecx
+  8001a1:	89 c2                	mov    %eax,%edx
+  8001a3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001a6:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001a9:	8b 45 10             	mov    0x10(%ebp),%eax
+  8001ac:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8001af:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001b2:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8001b9:	39 c2                	cmp    %eax,%edx
+  8001bb:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8001be:	72 3e                	jb     8001fe <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8001c0:	83 ec 0c             	sub    $0xc,%esp
+  8001c3:	ff 75 18             	push   0x18(%ebp)
+  8001c6:	83 eb 01             	sub    $0x1,%ebx
+  8001c9:	53                   	push   %ebx
+  8001ca:	50                   	push   %eax
+  8001cb:	83 ec 08             	sub    $0x8,%esp
+  8001ce:	ff 75 e4             	push   -0x1c(%ebp)
+  8001d1:	ff 75 e0             	push   -0x20(%ebp)
+  8001d4:	ff 75 dc             	push   -0x24(%ebp)
+  8001d7:	ff 75 d8             	push   -0x28(%ebp)
+  8001da:	e8 51 20 00 00       	call   802230 <__udivdi3>
+  8001df:	83 c4 18             	add    $0x18,%esp
+  8001e2:	52                   	push   %edx
+  8001e3:	50                   	push   %eax
+  8001e4:	89 f2                	mov    %esi,%edx
+  8001e6:	89 f8                	mov    %edi,%eax
+  8001e8:	e8 9f ff ff ff       	call   80018c <printnum>
+  8001ed:	83 c4 20             	add    $0x20,%esp
+  8001f0:	eb 13                	jmp    800205 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8001f2:	83 ec 08             	sub    $0x8,%esp
+  8001f5:	56                   	push   %esi
+  8001f6:	ff 75 18             	push   0x18(%ebp)
+  8001f9:	ff d7                	call   *%edi
+  8001fb:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8001fe:	83 eb 01             	sub    $0x1,%ebx
+  800201:	85 db                	test   %ebx,%ebx
+  800203:	7f ed                	jg     8001f2 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800205:	83 ec 08             	sub    $0x8,%esp
+  800208:	56                   	push   %esi
+  800209:	83 ec 04             	sub    $0x4,%esp
+  80020c:	ff 75 e4             	push   -0x1c(%ebp)
+  80020f:	ff 75 e0             	push   -0x20(%ebp)
+  800212:	ff 75 dc             	push   -0x24(%ebp)
+  800215:	ff 75 d8             	push   -0x28(%ebp)
+  800218:	e8 e3 20 00 00       	call   802300 <__umoddi3>
+  80021d:	83 c4 14             	add    $0x14,%esp
+  800220:	0f be 80 e6 25 80 00 	movsbl 0x8025e6(%eax),%eax
+  800227:	50                   	push   %eax
+  800228:	ff d7                	call   *%edi
+}
+  80022a:	83 c4 10             	add    $0x10,%esp
+  80022d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800230:	5b                   	pop    %ebx
+  800231:	5e                   	pop    %esi
+  800232:	5f                   	pop    %edi
+  800233:	5d                   	pop    %ebp
+  800234:	c3                   	ret
+
+00800235 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800235:	55                   	push   %ebp
+  800236:	89 e5                	mov    %esp,%ebp
+  800238:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80023b:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80023f:	8b 10                	mov    (%eax),%edx
+  800241:	3b 50 04             	cmp    0x4(%eax),%edx
+  800244:	73 0a                	jae    800250 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800246:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800249:	89 08                	mov    %ecx,(%eax)
+  80024b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80024e:	88 02                	mov    %al,(%edx)
+}
+  800250:	5d                   	pop    %ebp
+  800251:	c3                   	ret
+
+00800252 <printfmt>:
+{
+  800252:	55                   	push   %ebp
+  800253:	89 e5                	mov    %esp,%ebp
+  800255:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800258:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80025b:	50                   	push   %eax
+  80025c:	ff 75 10             	push   0x10(%ebp)
+  80025f:	ff 75 0c             	push   0xc(%ebp)
+  800262:	ff 75 08             	push   0x8(%ebp)
+  800265:	e8 05 00 00 00       	call   80026f <vprintfmt>
+}
+  80026a:	83 c4 10             	add    $0x10,%esp
+  80026d:	c9                   	leave
+  80026e:	c3                   	ret
+
+0080026f <vprintfmt>:
+{
+  80026f:	55                   	push   %ebp
+  800270:	89 e5                	mov    %esp,%ebp
+  800272:	57                   	push   %edi
+  800273:	56                   	push   %esi
+  800274:	53                   	push   %ebx
+  800275:	83 ec 2c             	sub    $0x2c,%esp
+  800278:	8b 75 08             	mov    0x8(%ebp),%esi
+  80027b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80027e:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800281:	eb 0a                	jmp    80028d <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800283:	83 ec 08             	sub    $0x8,%esp
+  800286:	53                   	push   %ebx
+  800287:	50                   	push   %eax
+  800288:	ff d6                	call   *%esi
+  80028a:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80028d:	83 c7 01             	add    $0x1,%edi
+  800290:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800294:	83 f8 25             	cmp    $0x25,%eax
+  800297:	74 0c                	je     8002a5 <vprintfmt+0x36>
+			if (ch == '\0')
+  800299:	85 c0                	test   %eax,%eax
+  80029b:	75 e6                	jne    800283 <vprintfmt+0x14>
+}
+  80029d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002a0:	5b                   	pop    %ebx
+  8002a1:	5e                   	pop    %esi
+  8002a2:	5f                   	pop    %edi
+  8002a3:	5d                   	pop    %ebp
+  8002a4:	c3                   	ret
+		padc = ' ';
+  8002a5:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8002a9:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8002b0:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8002b7:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8002be:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8002c3:	8d 47 01             	lea    0x1(%edi),%eax
+  8002c6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8002c9:	0f b6 17             	movzbl (%edi),%edx
+  8002cc:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8002cf:	3c 55                	cmp    $0x55,%al
+  8002d1:	0f 87 9a 03 00 00    	ja     800671 <vprintfmt+0x402>
+  8002d7:	0f b6 c0             	movzbl %al,%eax
+  8002da:	ff 24 85 20 27 80 00 	jmp    *0x802720(,%eax,4)
+  8002e1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8002e4:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8002e8:	eb d9                	jmp    8002c3 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8002ea:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8002ed:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8002f1:	eb d0                	jmp    8002c3 <vprintfmt+0x54>
+  8002f3:	0f b6 d2             	movzbl %dl,%edx
+  8002f6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8002f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002fe:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800301:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800304:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800308:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80030b:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80030e:	83 f9 09             	cmp    $0x9,%ecx
+  800311:	77 55                	ja     800368 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800313:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800316:	eb e9                	jmp    800301 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800318:	8b 45 14             	mov    0x14(%ebp),%eax
+  80031b:	8b 00                	mov    (%eax),%eax
+  80031d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800320:	8b 45 14             	mov    0x14(%ebp),%eax
+  800323:	8d 40 04             	lea    0x4(%eax),%eax
+  800326:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800329:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80032c:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800330:	79 91                	jns    8002c3 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800332:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800335:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800338:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80033f:	eb 82                	jmp    8002c3 <vprintfmt+0x54>
+			if (width < 0)
+  800341:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800344:	85 d2                	test   %edx,%edx
+  800346:	b8 00 00 00 00       	mov    $0x0,%eax
+  80034b:	0f 49 c2             	cmovns %edx,%eax
+  80034e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800351:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800354:	e9 6a ff ff ff       	jmp    8002c3 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800359:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80035c:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800363:	e9 5b ff ff ff       	jmp    8002c3 <vprintfmt+0x54>
+  800368:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80036b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80036e:	eb bc                	jmp    80032c <vprintfmt+0xbd>
+			lflag++;
+  800370:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800373:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800376:	e9 48 ff ff ff       	jmp    8002c3 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80037b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80037e:	8d 78 04             	lea    0x4(%eax),%edi
+  800381:	83 ec 08             	sub    $0x8,%esp
+  800384:	53                   	push   %ebx
+  800385:	ff 30                	push   (%eax)
+  800387:	ff d6                	call   *%esi
+			break;
+  800389:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80038c:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80038f:	e9 7c 02 00 00       	jmp    800610 <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  800394:	8b 45 14             	mov    0x14(%ebp),%eax
+  800397:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80039a:	8b 10                	mov    (%eax),%edx
+  80039c:	89 d0                	mov    %edx,%eax
+  80039e:	f7 d8                	neg    %eax
+  8003a0:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8003a3:	83 f8 10             	cmp    $0x10,%eax
+  8003a6:	7f 23                	jg     8003cb <vprintfmt+0x15c>
+  8003a8:	8b 14 85 80 28 80 00 	mov    0x802880(,%eax,4),%edx
+  8003af:	85 d2                	test   %edx,%edx
+  8003b1:	74 18                	je     8003cb <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8003b3:	52                   	push   %edx
+  8003b4:	68 35 2a 80 00       	push   $0x802a35
+  8003b9:	53                   	push   %ebx
+  8003ba:	56                   	push   %esi
+  8003bb:	e8 92 fe ff ff       	call   800252 <printfmt>
+  8003c0:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003c3:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8003c6:	e9 45 02 00 00       	jmp    800610 <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  8003cb:	50                   	push   %eax
+  8003cc:	68 fe 25 80 00       	push   $0x8025fe
+  8003d1:	53                   	push   %ebx
+  8003d2:	56                   	push   %esi
+  8003d3:	e8 7a fe ff ff       	call   800252 <printfmt>
+  8003d8:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003db:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8003de:	e9 2d 02 00 00       	jmp    800610 <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8003e3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003e6:	83 c0 04             	add    $0x4,%eax
+  8003e9:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8003ec:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003ef:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8003f1:	85 c9                	test   %ecx,%ecx
+  8003f3:	b8 f7 25 80 00       	mov    $0x8025f7,%eax
+  8003f8:	0f 45 c1             	cmovne %ecx,%eax
+  8003fb:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8003fe:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800402:	7e 06                	jle    80040a <vprintfmt+0x19b>
+  800404:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800408:	75 0b                	jne    800415 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80040a:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80040d:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800410:	89 75 08             	mov    %esi,0x8(%ebp)
+  800413:	eb 5c                	jmp    800471 <vprintfmt+0x202>
+  800415:	83 ec 08             	sub    $0x8,%esp
+  800418:	ff 75 d0             	push   -0x30(%ebp)
+  80041b:	ff 75 cc             	push   -0x34(%ebp)
+  80041e:	e8 eb 02 00 00       	call   80070e <strnlen>
+  800423:	89 c2                	mov    %eax,%edx
+  800425:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800428:	29 d0                	sub    %edx,%eax
+  80042a:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80042d:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800431:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800434:	89 75 08             	mov    %esi,0x8(%ebp)
+  800437:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800439:	eb 0e                	jmp    800449 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  80043b:	83 ec 08             	sub    $0x8,%esp
+  80043e:	53                   	push   %ebx
+  80043f:	57                   	push   %edi
+  800440:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800443:	83 ee 01             	sub    $0x1,%esi
+  800446:	83 c4 10             	add    $0x10,%esp
+  800449:	85 f6                	test   %esi,%esi
+  80044b:	7f ee                	jg     80043b <vprintfmt+0x1cc>
+  80044d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800450:	8b 75 08             	mov    0x8(%ebp),%esi
+  800453:	85 c0                	test   %eax,%eax
+  800455:	ba 00 00 00 00       	mov    $0x0,%edx
+  80045a:	0f 49 d0             	cmovns %eax,%edx
+  80045d:	29 d0                	sub    %edx,%eax
+  80045f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800462:	eb a6                	jmp    80040a <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800464:	83 ec 08             	sub    $0x8,%esp
+  800467:	53                   	push   %ebx
+  800468:	52                   	push   %edx
+  800469:	ff 55 08             	call   *0x8(%ebp)
+  80046c:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80046f:	89 f1                	mov    %esi,%ecx
+  800471:	8d 71 01             	lea    0x1(%ecx),%esi
+  800474:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800478:	0f be d0             	movsbl %al,%edx
+  80047b:	85 d2                	test   %edx,%edx
+  80047d:	74 28                	je     8004a7 <vprintfmt+0x238>
+  80047f:	85 ff                	test   %edi,%edi
+  800481:	78 05                	js     800488 <vprintfmt+0x219>
+  800483:	83 ef 01             	sub    $0x1,%edi
+  800486:	78 30                	js     8004b8 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800488:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80048c:	74 d6                	je     800464 <vprintfmt+0x1f5>
+  80048e:	0f be c0             	movsbl %al,%eax
+  800491:	83 e8 20             	sub    $0x20,%eax
+  800494:	83 f8 5e             	cmp    $0x5e,%eax
+  800497:	76 cb                	jbe    800464 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800499:	83 ec 08             	sub    $0x8,%esp
+  80049c:	53                   	push   %ebx
+  80049d:	6a 3f                	push   $0x3f
+  80049f:	ff 55 08             	call   *0x8(%ebp)
+  8004a2:	83 c4 10             	add    $0x10,%esp
+  8004a5:	eb c8                	jmp    80046f <vprintfmt+0x200>
+  8004a7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004aa:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8004ad:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004b0:	01 d0                	add    %edx,%eax
+  8004b2:	29 c8                	sub    %ecx,%eax
+  8004b4:	89 c7                	mov    %eax,%edi
+  8004b6:	eb 13                	jmp    8004cb <vprintfmt+0x25c>
+  8004b8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004bb:	eb ed                	jmp    8004aa <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8004bd:	83 ec 08             	sub    $0x8,%esp
+  8004c0:	53                   	push   %ebx
+  8004c1:	6a 20                	push   $0x20
+  8004c3:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8004c5:	83 ef 01             	sub    $0x1,%edi
+  8004c8:	83 c4 10             	add    $0x10,%esp
+  8004cb:	85 ff                	test   %edi,%edi
+  8004cd:	7f ee                	jg     8004bd <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004cf:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8004d2:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004d5:	e9 36 01 00 00       	jmp    800610 <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  8004da:	83 f9 01             	cmp    $0x1,%ecx
+  8004dd:	7f 1f                	jg     8004fe <vprintfmt+0x28f>
+	else if (lflag)
+  8004df:	85 c9                	test   %ecx,%ecx
+  8004e1:	74 67                	je     80054a <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8004e3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004e6:	8b 00                	mov    (%eax),%eax
+  8004e8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004eb:	89 c1                	mov    %eax,%ecx
+  8004ed:	c1 f9 1f             	sar    $0x1f,%ecx
+  8004f0:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8004f3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004f6:	8d 40 04             	lea    0x4(%eax),%eax
+  8004f9:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004fc:	eb 17                	jmp    800515 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8004fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800501:	8b 50 04             	mov    0x4(%eax),%edx
+  800504:	8b 00                	mov    (%eax),%eax
+  800506:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800509:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80050c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80050f:	8d 40 08             	lea    0x8(%eax),%eax
+  800512:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800515:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800518:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80051b:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800520:	85 c9                	test   %ecx,%ecx
+  800522:	0f 89 ce 00 00 00    	jns    8005f6 <vprintfmt+0x387>
+				putch('-', putdat);
+  800528:	83 ec 08             	sub    $0x8,%esp
+  80052b:	53                   	push   %ebx
+  80052c:	6a 2d                	push   $0x2d
+  80052e:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800530:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800533:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800536:	f7 da                	neg    %edx
+  800538:	83 d1 00             	adc    $0x0,%ecx
+  80053b:	f7 d9                	neg    %ecx
+  80053d:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800540:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800545:	e9 ac 00 00 00       	jmp    8005f6 <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  80054a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80054d:	8b 00                	mov    (%eax),%eax
+  80054f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800552:	89 c1                	mov    %eax,%ecx
+  800554:	c1 f9 1f             	sar    $0x1f,%ecx
+  800557:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80055a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80055d:	8d 40 04             	lea    0x4(%eax),%eax
+  800560:	89 45 14             	mov    %eax,0x14(%ebp)
+  800563:	eb b0                	jmp    800515 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800565:	83 f9 01             	cmp    $0x1,%ecx
+  800568:	7f 1b                	jg     800585 <vprintfmt+0x316>
+	else if (lflag)
+  80056a:	85 c9                	test   %ecx,%ecx
+  80056c:	74 2c                	je     80059a <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  80056e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800571:	8b 10                	mov    (%eax),%edx
+  800573:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800578:	8d 40 04             	lea    0x4(%eax),%eax
+  80057b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80057e:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800583:	eb 71                	jmp    8005f6 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  800585:	8b 45 14             	mov    0x14(%ebp),%eax
+  800588:	8b 10                	mov    (%eax),%edx
+  80058a:	8b 48 04             	mov    0x4(%eax),%ecx
+  80058d:	8d 40 08             	lea    0x8(%eax),%eax
+  800590:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800593:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800598:	eb 5c                	jmp    8005f6 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  80059a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059d:	8b 10                	mov    (%eax),%edx
+  80059f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005a4:	8d 40 04             	lea    0x4(%eax),%eax
+  8005a7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005aa:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8005af:	eb 45                	jmp    8005f6 <vprintfmt+0x387>
+			putch('X', putdat);
+  8005b1:	83 ec 08             	sub    $0x8,%esp
+  8005b4:	53                   	push   %ebx
+  8005b5:	6a 58                	push   $0x58
+  8005b7:	ff d6                	call   *%esi
+			putch('X', putdat);
+  8005b9:	83 c4 08             	add    $0x8,%esp
+  8005bc:	53                   	push   %ebx
+  8005bd:	6a 58                	push   $0x58
+  8005bf:	ff d6                	call   *%esi
+			putch('X', putdat);
+  8005c1:	83 c4 08             	add    $0x8,%esp
+  8005c4:	53                   	push   %ebx
+  8005c5:	6a 58                	push   $0x58
+  8005c7:	ff d6                	call   *%esi
+			break;
+  8005c9:	83 c4 10             	add    $0x10,%esp
+  8005cc:	eb 42                	jmp    800610 <vprintfmt+0x3a1>
+			putch('0', putdat);
+  8005ce:	83 ec 08             	sub    $0x8,%esp
+  8005d1:	53                   	push   %ebx
+  8005d2:	6a 30                	push   $0x30
+  8005d4:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8005d6:	83 c4 08             	add    $0x8,%esp
+  8005d9:	53                   	push   %ebx
+  8005da:	6a 78                	push   $0x78
+  8005dc:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8005de:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e1:	8b 10                	mov    (%eax),%edx
+  8005e3:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8005e8:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8005eb:	8d 40 04             	lea    0x4(%eax),%eax
+  8005ee:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8005f1:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8005f6:	83 ec 0c             	sub    $0xc,%esp
+  8005f9:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8005fd:	50                   	push   %eax
+  8005fe:	ff 75 e0             	push   -0x20(%ebp)
+  800601:	57                   	push   %edi
+  800602:	51                   	push   %ecx
+  800603:	52                   	push   %edx
+  800604:	89 da                	mov    %ebx,%edx
+  800606:	89 f0                	mov    %esi,%eax
+  800608:	e8 7f fb ff ff       	call   80018c <printnum>
+			break;
+  80060d:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800610:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800613:	e9 75 fc ff ff       	jmp    80028d <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800618:	83 f9 01             	cmp    $0x1,%ecx
+  80061b:	7f 1b                	jg     800638 <vprintfmt+0x3c9>
+	else if (lflag)
+  80061d:	85 c9                	test   %ecx,%ecx
+  80061f:	74 2c                	je     80064d <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  800621:	8b 45 14             	mov    0x14(%ebp),%eax
+  800624:	8b 10                	mov    (%eax),%edx
+  800626:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80062b:	8d 40 04             	lea    0x4(%eax),%eax
+  80062e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800631:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800636:	eb be                	jmp    8005f6 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  800638:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063b:	8b 10                	mov    (%eax),%edx
+  80063d:	8b 48 04             	mov    0x4(%eax),%ecx
+  800640:	8d 40 08             	lea    0x8(%eax),%eax
+  800643:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800646:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80064b:	eb a9                	jmp    8005f6 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  80064d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800650:	8b 10                	mov    (%eax),%edx
+  800652:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800657:	8d 40 04             	lea    0x4(%eax),%eax
+  80065a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80065d:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800662:	eb 92                	jmp    8005f6 <vprintfmt+0x387>
+			putch(ch, putdat);
+  800664:	83 ec 08             	sub    $0x8,%esp
+  800667:	53                   	push   %ebx
+  800668:	6a 25                	push   $0x25
+  80066a:	ff d6                	call   *%esi
+			break;
+  80066c:	83 c4 10             	add    $0x10,%esp
+  80066f:	eb 9f                	jmp    800610 <vprintfmt+0x3a1>
+			putch('%', putdat);
+  800671:	83 ec 08             	sub    $0x8,%esp
+  800674:	53                   	push   %ebx
+  800675:	6a 25                	push   $0x25
+  800677:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800679:	83 c4 10             	add    $0x10,%esp
+  80067c:	89 f8                	mov    %edi,%eax
+  80067e:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800682:	74 05                	je     800689 <vprintfmt+0x41a>
+  800684:	83 e8 01             	sub    $0x1,%eax
+  800687:	eb f5                	jmp    80067e <vprintfmt+0x40f>
+  800689:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80068c:	eb 82                	jmp    800610 <vprintfmt+0x3a1>
+
+0080068e <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80068e:	55                   	push   %ebp
+  80068f:	89 e5                	mov    %esp,%ebp
+  800691:	83 ec 18             	sub    $0x18,%esp
+  800694:	8b 45 08             	mov    0x8(%ebp),%eax
+  800697:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80069a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80069d:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8006a1:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8006a4:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8006ab:	85 c0                	test   %eax,%eax
+  8006ad:	74 26                	je     8006d5 <vsnprintf+0x47>
+  8006af:	85 d2                	test   %edx,%edx
+  8006b1:	7e 22                	jle    8006d5 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8006b3:	ff 75 14             	push   0x14(%ebp)
+  8006b6:	ff 75 10             	push   0x10(%ebp)
+  8006b9:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8006bc:	50                   	push   %eax
+  8006bd:	68 35 02 80 00       	push   $0x800235
+  8006c2:	e8 a8 fb ff ff       	call   80026f <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8006c7:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8006ca:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8006cd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8006d0:	83 c4 10             	add    $0x10,%esp
+}
+  8006d3:	c9                   	leave
+  8006d4:	c3                   	ret
+		return -E_INVAL;
+  8006d5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006da:	eb f7                	jmp    8006d3 <vsnprintf+0x45>
+
+008006dc <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8006dc:	55                   	push   %ebp
+  8006dd:	89 e5                	mov    %esp,%ebp
+  8006df:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8006e2:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8006e5:	50                   	push   %eax
+  8006e6:	ff 75 10             	push   0x10(%ebp)
+  8006e9:	ff 75 0c             	push   0xc(%ebp)
+  8006ec:	ff 75 08             	push   0x8(%ebp)
+  8006ef:	e8 9a ff ff ff       	call   80068e <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8006f4:	c9                   	leave
+  8006f5:	c3                   	ret
+
+008006f6 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8006f6:	55                   	push   %ebp
+  8006f7:	89 e5                	mov    %esp,%ebp
+  8006f9:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8006fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800701:	eb 03                	jmp    800706 <strlen+0x10>
+		n++;
+  800703:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800706:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80070a:	75 f7                	jne    800703 <strlen+0xd>
+	return n;
+}
+  80070c:	5d                   	pop    %ebp
+  80070d:	c3                   	ret
+
+0080070e <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80070e:	55                   	push   %ebp
+  80070f:	89 e5                	mov    %esp,%ebp
+  800711:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800714:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800717:	b8 00 00 00 00       	mov    $0x0,%eax
+  80071c:	eb 03                	jmp    800721 <strnlen+0x13>
+		n++;
+  80071e:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800721:	39 d0                	cmp    %edx,%eax
+  800723:	74 08                	je     80072d <strnlen+0x1f>
+  800725:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800729:	75 f3                	jne    80071e <strnlen+0x10>
+  80072b:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80072d:	89 d0                	mov    %edx,%eax
+  80072f:	5d                   	pop    %ebp
+  800730:	c3                   	ret
+
+00800731 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800731:	55                   	push   %ebp
+  800732:	89 e5                	mov    %esp,%ebp
+  800734:	53                   	push   %ebx
+  800735:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800738:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80073b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800740:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800744:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800747:	83 c0 01             	add    $0x1,%eax
+  80074a:	84 d2                	test   %dl,%dl
+  80074c:	75 f2                	jne    800740 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80074e:	89 c8                	mov    %ecx,%eax
+  800750:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800753:	c9                   	leave
+  800754:	c3                   	ret
+
+00800755 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800755:	55                   	push   %ebp
+  800756:	89 e5                	mov    %esp,%ebp
+  800758:	53                   	push   %ebx
+  800759:	83 ec 10             	sub    $0x10,%esp
+  80075c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80075f:	53                   	push   %ebx
+  800760:	e8 91 ff ff ff       	call   8006f6 <strlen>
+  800765:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800768:	ff 75 0c             	push   0xc(%ebp)
+  80076b:	01 d8                	add    %ebx,%eax
+  80076d:	50                   	push   %eax
+  80076e:	e8 be ff ff ff       	call   800731 <strcpy>
+	return dst;
+}
+  800773:	89 d8                	mov    %ebx,%eax
+  800775:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800778:	c9                   	leave
+  800779:	c3                   	ret
+
+0080077a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80077a:	55                   	push   %ebp
+  80077b:	89 e5                	mov    %esp,%ebp
+  80077d:	56                   	push   %esi
+  80077e:	53                   	push   %ebx
+  80077f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800782:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800785:	89 f3                	mov    %esi,%ebx
+  800787:	03 5d 10             	add    0x10(%ebp),%ebx
+  80078a:	89 f0                	mov    %esi,%eax
+  80078c:	eb 0f                	jmp    80079d <strncpy+0x23>
+		*dst++ = *src;
+  80078e:	83 c0 01             	add    $0x1,%eax
+  800791:	0f b6 0a             	movzbl (%edx),%ecx
+  800794:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800797:	80 f9 01             	cmp    $0x1,%cl
+  80079a:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80079d:	39 d8                	cmp    %ebx,%eax
+  80079f:	75 ed                	jne    80078e <strncpy+0x14>
+	}
+	return ret;
+}
+  8007a1:	89 f0                	mov    %esi,%eax
+  8007a3:	5b                   	pop    %ebx
+  8007a4:	5e                   	pop    %esi
+  8007a5:	5d                   	pop    %ebp
+  8007a6:	c3                   	ret
+
+008007a7 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8007a7:	55                   	push   %ebp
+  8007a8:	89 e5                	mov    %esp,%ebp
+  8007aa:	56                   	push   %esi
+  8007ab:	53                   	push   %ebx
+  8007ac:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007af:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007b2:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8007b5:	89 f0                	mov    %esi,%eax
+  8007b7:	85 d2                	test   %edx,%edx
+  8007b9:	74 21                	je     8007dc <strlcpy+0x35>
+  8007bb:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8007bf:	89 f2                	mov    %esi,%edx
+  8007c1:	eb 09                	jmp    8007cc <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8007c3:	83 c1 01             	add    $0x1,%ecx
+  8007c6:	83 c2 01             	add    $0x1,%edx
+  8007c9:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8007cc:	39 c2                	cmp    %eax,%edx
+  8007ce:	74 09                	je     8007d9 <strlcpy+0x32>
+  8007d0:	0f b6 19             	movzbl (%ecx),%ebx
+  8007d3:	84 db                	test   %bl,%bl
+  8007d5:	75 ec                	jne    8007c3 <strlcpy+0x1c>
+  8007d7:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8007d9:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8007dc:	29 f0                	sub    %esi,%eax
+}
+  8007de:	5b                   	pop    %ebx
+  8007df:	5e                   	pop    %esi
+  8007e0:	5d                   	pop    %ebp
+  8007e1:	c3                   	ret
+
+008007e2 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8007e2:	55                   	push   %ebp
+  8007e3:	89 e5                	mov    %esp,%ebp
+  8007e5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007e8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8007eb:	eb 06                	jmp    8007f3 <strcmp+0x11>
+		p++, q++;
+  8007ed:	83 c1 01             	add    $0x1,%ecx
+  8007f0:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8007f3:	0f b6 01             	movzbl (%ecx),%eax
+  8007f6:	84 c0                	test   %al,%al
+  8007f8:	74 04                	je     8007fe <strcmp+0x1c>
+  8007fa:	3a 02                	cmp    (%edx),%al
+  8007fc:	74 ef                	je     8007ed <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8007fe:	0f b6 c0             	movzbl %al,%eax
+  800801:	0f b6 12             	movzbl (%edx),%edx
+  800804:	29 d0                	sub    %edx,%eax
+}
+  800806:	5d                   	pop    %ebp
+  800807:	c3                   	ret
+
+00800808 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800808:	55                   	push   %ebp
+  800809:	89 e5                	mov    %esp,%ebp
+  80080b:	53                   	push   %ebx
+  80080c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80080f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800812:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800815:	eb 09                	jmp    800820 <strncmp+0x18>
+		n--, p++, q++;
+  800817:	83 ea 01             	sub    $0x1,%edx
+  80081a:	83 c0 01             	add    $0x1,%eax
+  80081d:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800820:	85 d2                	test   %edx,%edx
+  800822:	74 18                	je     80083c <strncmp+0x34>
+  800824:	0f b6 18             	movzbl (%eax),%ebx
+  800827:	84 db                	test   %bl,%bl
+  800829:	74 04                	je     80082f <strncmp+0x27>
+  80082b:	3a 19                	cmp    (%ecx),%bl
+  80082d:	74 e8                	je     800817 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80082f:	0f b6 00             	movzbl (%eax),%eax
+  800832:	0f b6 11             	movzbl (%ecx),%edx
+  800835:	29 d0                	sub    %edx,%eax
+}
+  800837:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80083a:	c9                   	leave
+  80083b:	c3                   	ret
+		return 0;
+  80083c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800841:	eb f4                	jmp    800837 <strncmp+0x2f>
+
+00800843 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800843:	55                   	push   %ebp
+  800844:	89 e5                	mov    %esp,%ebp
+  800846:	8b 45 08             	mov    0x8(%ebp),%eax
+  800849:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80084d:	eb 03                	jmp    800852 <strchr+0xf>
+  80084f:	83 c0 01             	add    $0x1,%eax
+  800852:	0f b6 10             	movzbl (%eax),%edx
+  800855:	84 d2                	test   %dl,%dl
+  800857:	74 06                	je     80085f <strchr+0x1c>
+		if (*s == c)
+  800859:	38 ca                	cmp    %cl,%dl
+  80085b:	75 f2                	jne    80084f <strchr+0xc>
+  80085d:	eb 05                	jmp    800864 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  80085f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800864:	5d                   	pop    %ebp
+  800865:	c3                   	ret
+
+00800866 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800866:	55                   	push   %ebp
+  800867:	89 e5                	mov    %esp,%ebp
+  800869:	8b 45 08             	mov    0x8(%ebp),%eax
+  80086c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800870:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800873:	38 ca                	cmp    %cl,%dl
+  800875:	74 09                	je     800880 <strfind+0x1a>
+  800877:	84 d2                	test   %dl,%dl
+  800879:	74 05                	je     800880 <strfind+0x1a>
+	for (; *s; s++)
+  80087b:	83 c0 01             	add    $0x1,%eax
+  80087e:	eb f0                	jmp    800870 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800880:	5d                   	pop    %ebp
+  800881:	c3                   	ret
+
+00800882 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800882:	55                   	push   %ebp
+  800883:	89 e5                	mov    %esp,%ebp
+  800885:	57                   	push   %edi
+  800886:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800889:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  80088c:	85 c9                	test   %ecx,%ecx
+  80088e:	74 20                	je     8008b0 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800890:	89 f8                	mov    %edi,%eax
+  800892:	09 c8                	or     %ecx,%eax
+  800894:	a8 03                	test   $0x3,%al
+  800896:	75 12                	jne    8008aa <memset+0x28>
+		c &= 0xFF;
+  800898:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80089c:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8008a2:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8008a5:	fc                   	cld
+  8008a6:	f3 ab                	rep stos %eax,%es:(%edi)
+  8008a8:	eb 06                	jmp    8008b0 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8008aa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8008ad:	fc                   	cld
+  8008ae:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8008b0:	89 f8                	mov    %edi,%eax
+  8008b2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8008b5:	c9                   	leave
+  8008b6:	c3                   	ret
+
+008008b7 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8008b7:	55                   	push   %ebp
+  8008b8:	89 e5                	mov    %esp,%ebp
+  8008ba:	57                   	push   %edi
+  8008bb:	56                   	push   %esi
+  8008bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008bf:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8008c2:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8008c5:	39 c6                	cmp    %eax,%esi
+  8008c7:	73 32                	jae    8008fb <memmove+0x44>
+  8008c9:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8008cc:	39 d0                	cmp    %edx,%eax
+  8008ce:	73 2b                	jae    8008fb <memmove+0x44>
+		s += n;
+		d += n;
+  8008d0:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8008d3:	89 d6                	mov    %edx,%esi
+  8008d5:	09 fe                	or     %edi,%esi
+  8008d7:	09 ce                	or     %ecx,%esi
+  8008d9:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8008df:	75 0e                	jne    8008ef <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8008e1:	83 ef 04             	sub    $0x4,%edi
+  8008e4:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8008e7:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8008ea:	fd                   	std
+  8008eb:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8008ed:	eb 09                	jmp    8008f8 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8008ef:	83 ef 01             	sub    $0x1,%edi
+  8008f2:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8008f5:	fd                   	std
+  8008f6:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8008f8:	fc                   	cld
+  8008f9:	eb 1a                	jmp    800915 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8008fb:	89 f2                	mov    %esi,%edx
+  8008fd:	09 c2                	or     %eax,%edx
+  8008ff:	09 ca                	or     %ecx,%edx
+  800901:	f6 c2 03             	test   $0x3,%dl
+  800904:	75 0a                	jne    800910 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800906:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800909:	89 c7                	mov    %eax,%edi
+  80090b:	fc                   	cld
+  80090c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80090e:	eb 05                	jmp    800915 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800910:	89 c7                	mov    %eax,%edi
+  800912:	fc                   	cld
+  800913:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800915:	5e                   	pop    %esi
+  800916:	5f                   	pop    %edi
+  800917:	5d                   	pop    %ebp
+  800918:	c3                   	ret
+
+00800919 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800919:	55                   	push   %ebp
+  80091a:	89 e5                	mov    %esp,%ebp
+  80091c:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  80091f:	ff 75 10             	push   0x10(%ebp)
+  800922:	ff 75 0c             	push   0xc(%ebp)
+  800925:	ff 75 08             	push   0x8(%ebp)
+  800928:	e8 8a ff ff ff       	call   8008b7 <memmove>
+}
+  80092d:	c9                   	leave
+  80092e:	c3                   	ret
+
+0080092f <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  80092f:	55                   	push   %ebp
+  800930:	89 e5                	mov    %esp,%ebp
+  800932:	56                   	push   %esi
+  800933:	53                   	push   %ebx
+  800934:	8b 45 08             	mov    0x8(%ebp),%eax
+  800937:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  80093a:	89 c6                	mov    %eax,%esi
+  80093c:	03 75 10             	add    0x10(%ebp),%esi
+  80093f:	eb 06                	jmp    800947 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800941:	83 c0 01             	add    $0x1,%eax
+  800944:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800947:	39 f0                	cmp    %esi,%eax
+  800949:	74 14                	je     80095f <memcmp+0x30>
+		if (*s1 != *s2)
+  80094b:	0f b6 08             	movzbl (%eax),%ecx
+  80094e:	0f b6 1a             	movzbl (%edx),%ebx
+  800951:	38 d9                	cmp    %bl,%cl
+  800953:	74 ec                	je     800941 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800955:	0f b6 c1             	movzbl %cl,%eax
+  800958:	0f b6 db             	movzbl %bl,%ebx
+  80095b:	29 d8                	sub    %ebx,%eax
+  80095d:	eb 05                	jmp    800964 <memcmp+0x35>
+	}
+
+	return 0;
+  80095f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800964:	5b                   	pop    %ebx
+  800965:	5e                   	pop    %esi
+  800966:	5d                   	pop    %ebp
+  800967:	c3                   	ret
+
+00800968 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800968:	55                   	push   %ebp
+  800969:	89 e5                	mov    %esp,%ebp
+  80096b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80096e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800971:	89 c2                	mov    %eax,%edx
+  800973:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800976:	eb 03                	jmp    80097b <memfind+0x13>
+  800978:	83 c0 01             	add    $0x1,%eax
+  80097b:	39 d0                	cmp    %edx,%eax
+  80097d:	73 04                	jae    800983 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  80097f:	38 08                	cmp    %cl,(%eax)
+  800981:	75 f5                	jne    800978 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800983:	5d                   	pop    %ebp
+  800984:	c3                   	ret
+
+00800985 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800985:	55                   	push   %ebp
+  800986:	89 e5                	mov    %esp,%ebp
+  800988:	57                   	push   %edi
+  800989:	56                   	push   %esi
+  80098a:	53                   	push   %ebx
+  80098b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80098e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800991:	eb 03                	jmp    800996 <strtol+0x11>
+		s++;
+  800993:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800996:	0f b6 02             	movzbl (%edx),%eax
+  800999:	3c 20                	cmp    $0x20,%al
+  80099b:	74 f6                	je     800993 <strtol+0xe>
+  80099d:	3c 09                	cmp    $0x9,%al
+  80099f:	74 f2                	je     800993 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8009a1:	3c 2b                	cmp    $0x2b,%al
+  8009a3:	74 2a                	je     8009cf <strtol+0x4a>
+	int neg = 0;
+  8009a5:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8009aa:	3c 2d                	cmp    $0x2d,%al
+  8009ac:	74 2b                	je     8009d9 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009ae:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8009b4:	75 0f                	jne    8009c5 <strtol+0x40>
+  8009b6:	80 3a 30             	cmpb   $0x30,(%edx)
+  8009b9:	74 28                	je     8009e3 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8009bb:	85 db                	test   %ebx,%ebx
+  8009bd:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8009c2:	0f 44 d8             	cmove  %eax,%ebx
+  8009c5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009ca:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8009cd:	eb 46                	jmp    800a15 <strtol+0x90>
+		s++;
+  8009cf:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  8009d2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009d7:	eb d5                	jmp    8009ae <strtol+0x29>
+		s++, neg = 1;
+  8009d9:	83 c2 01             	add    $0x1,%edx
+  8009dc:	bf 01 00 00 00       	mov    $0x1,%edi
+  8009e1:	eb cb                	jmp    8009ae <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009e3:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8009e7:	74 0e                	je     8009f7 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  8009e9:	85 db                	test   %ebx,%ebx
+  8009eb:	75 d8                	jne    8009c5 <strtol+0x40>
+		s++, base = 8;
+  8009ed:	83 c2 01             	add    $0x1,%edx
+  8009f0:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8009f5:	eb ce                	jmp    8009c5 <strtol+0x40>
+		s += 2, base = 16;
+  8009f7:	83 c2 02             	add    $0x2,%edx
+  8009fa:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8009ff:	eb c4                	jmp    8009c5 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a01:	0f be c0             	movsbl %al,%eax
+  800a04:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a07:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a0a:	7d 3a                	jge    800a46 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a0c:	83 c2 01             	add    $0x1,%edx
+  800a0f:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a13:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a15:	0f b6 02             	movzbl (%edx),%eax
+  800a18:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a1b:	89 f3                	mov    %esi,%ebx
+  800a1d:	80 fb 09             	cmp    $0x9,%bl
+  800a20:	76 df                	jbe    800a01 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a22:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a25:	89 f3                	mov    %esi,%ebx
+  800a27:	80 fb 19             	cmp    $0x19,%bl
+  800a2a:	77 08                	ja     800a34 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800a2c:	0f be c0             	movsbl %al,%eax
+  800a2f:	83 e8 57             	sub    $0x57,%eax
+  800a32:	eb d3                	jmp    800a07 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800a34:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800a37:	89 f3                	mov    %esi,%ebx
+  800a39:	80 fb 19             	cmp    $0x19,%bl
+  800a3c:	77 08                	ja     800a46 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800a3e:	0f be c0             	movsbl %al,%eax
+  800a41:	83 e8 37             	sub    $0x37,%eax
+  800a44:	eb c1                	jmp    800a07 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800a46:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800a4a:	74 05                	je     800a51 <strtol+0xcc>
+		*endptr = (char *) s;
+  800a4c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a4f:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800a51:	89 c8                	mov    %ecx,%eax
+  800a53:	f7 d8                	neg    %eax
+  800a55:	85 ff                	test   %edi,%edi
+  800a57:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800a5a:	89 c8                	mov    %ecx,%eax
+  800a5c:	5b                   	pop    %ebx
+  800a5d:	5e                   	pop    %esi
+  800a5e:	5f                   	pop    %edi
+  800a5f:	5d                   	pop    %ebp
+  800a60:	c3                   	ret
+
+00800a61 <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800a61:	55                   	push   %ebp
+  800a62:	89 e5                	mov    %esp,%ebp
+  800a64:	57                   	push   %edi
+  800a65:	56                   	push   %esi
+  800a66:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800a67:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a6f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a72:	89 c3                	mov    %eax,%ebx
+  800a74:	89 c7                	mov    %eax,%edi
+  800a76:	89 c6                	mov    %eax,%esi
+  800a78:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  800a7a:	5b                   	pop    %ebx
+  800a7b:	5e                   	pop    %esi
+  800a7c:	5f                   	pop    %edi
+  800a7d:	5d                   	pop    %ebp
+  800a7e:	c3                   	ret
+
+00800a7f <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800a7f:	55                   	push   %ebp
+  800a80:	89 e5                	mov    %esp,%ebp
+  800a82:	57                   	push   %edi
+  800a83:	56                   	push   %esi
+  800a84:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800a85:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a8a:	b8 01 00 00 00       	mov    $0x1,%eax
+  800a8f:	89 d1                	mov    %edx,%ecx
+  800a91:	89 d3                	mov    %edx,%ebx
+  800a93:	89 d7                	mov    %edx,%edi
+  800a95:	89 d6                	mov    %edx,%esi
+  800a97:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800a99:	5b                   	pop    %ebx
+  800a9a:	5e                   	pop    %esi
+  800a9b:	5f                   	pop    %edi
+  800a9c:	5d                   	pop    %ebp
+  800a9d:	c3                   	ret
+
+00800a9e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800a9e:	55                   	push   %ebp
+  800a9f:	89 e5                	mov    %esp,%ebp
+  800aa1:	57                   	push   %edi
+  800aa2:	56                   	push   %esi
+  800aa3:	53                   	push   %ebx
+  800aa4:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800aa7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800aac:	8b 55 08             	mov    0x8(%ebp),%edx
+  800aaf:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ab4:	89 cb                	mov    %ecx,%ebx
+  800ab6:	89 cf                	mov    %ecx,%edi
+  800ab8:	89 ce                	mov    %ecx,%esi
+  800aba:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800abc:	85 c0                	test   %eax,%eax
+  800abe:	7f 08                	jg     800ac8 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800ac0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ac3:	5b                   	pop    %ebx
+  800ac4:	5e                   	pop    %esi
+  800ac5:	5f                   	pop    %edi
+  800ac6:	5d                   	pop    %ebp
+  800ac7:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ac8:	83 ec 0c             	sub    $0xc,%esp
+  800acb:	50                   	push   %eax
+  800acc:	6a 03                	push   $0x3
+  800ace:	68 e3 28 80 00       	push   $0x8028e3
+  800ad3:	6a 3e                	push   $0x3e
+  800ad5:	68 00 29 80 00       	push   $0x802900
+  800ada:	e8 b1 14 00 00       	call   801f90 <_panic>
+
+00800adf <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800adf:	55                   	push   %ebp
+  800ae0:	89 e5                	mov    %esp,%ebp
+  800ae2:	57                   	push   %edi
+  800ae3:	56                   	push   %esi
+  800ae4:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800ae5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800aea:	b8 02 00 00 00       	mov    $0x2,%eax
+  800aef:	89 d1                	mov    %edx,%ecx
+  800af1:	89 d3                	mov    %edx,%ebx
+  800af3:	89 d7                	mov    %edx,%edi
+  800af5:	89 d6                	mov    %edx,%esi
+  800af7:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800af9:	5b                   	pop    %ebx
+  800afa:	5e                   	pop    %esi
+  800afb:	5f                   	pop    %edi
+  800afc:	5d                   	pop    %ebp
+  800afd:	c3                   	ret
+
+00800afe <sys_yield>:
+
+void
+sys_yield(void) {
+  800afe:	55                   	push   %ebp
+  800aff:	89 e5                	mov    %esp,%ebp
+  800b01:	57                   	push   %edi
+  800b02:	56                   	push   %esi
+  800b03:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800b04:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b09:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800b0e:	89 d1                	mov    %edx,%ecx
+  800b10:	89 d3                	mov    %edx,%ebx
+  800b12:	89 d7                	mov    %edx,%edi
+  800b14:	89 d6                	mov    %edx,%esi
+  800b16:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800b18:	5b                   	pop    %ebx
+  800b19:	5e                   	pop    %esi
+  800b1a:	5f                   	pop    %edi
+  800b1b:	5d                   	pop    %ebp
+  800b1c:	c3                   	ret
+
+00800b1d <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  800b1d:	55                   	push   %ebp
+  800b1e:	89 e5                	mov    %esp,%ebp
+  800b20:	57                   	push   %edi
+  800b21:	56                   	push   %esi
+  800b22:	53                   	push   %ebx
+  800b23:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800b26:	be 00 00 00 00       	mov    $0x0,%esi
+  800b2b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b2e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b31:	b8 04 00 00 00       	mov    $0x4,%eax
+  800b36:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b39:	89 f7                	mov    %esi,%edi
+  800b3b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800b3d:	85 c0                	test   %eax,%eax
+  800b3f:	7f 08                	jg     800b49 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800b41:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b44:	5b                   	pop    %ebx
+  800b45:	5e                   	pop    %esi
+  800b46:	5f                   	pop    %edi
+  800b47:	5d                   	pop    %ebp
+  800b48:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800b49:	83 ec 0c             	sub    $0xc,%esp
+  800b4c:	50                   	push   %eax
+  800b4d:	6a 04                	push   $0x4
+  800b4f:	68 e3 28 80 00       	push   $0x8028e3
+  800b54:	6a 3e                	push   $0x3e
+  800b56:	68 00 29 80 00       	push   $0x802900
+  800b5b:	e8 30 14 00 00       	call   801f90 <_panic>
+
+00800b60 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  800b60:	55                   	push   %ebp
+  800b61:	89 e5                	mov    %esp,%ebp
+  800b63:	57                   	push   %edi
+  800b64:	56                   	push   %esi
+  800b65:	53                   	push   %ebx
+  800b66:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800b69:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b6c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b6f:	b8 05 00 00 00       	mov    $0x5,%eax
+  800b74:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b77:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800b7a:	8b 75 18             	mov    0x18(%ebp),%esi
+  800b7d:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800b7f:	85 c0                	test   %eax,%eax
+  800b81:	7f 08                	jg     800b8b <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800b83:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b86:	5b                   	pop    %ebx
+  800b87:	5e                   	pop    %esi
+  800b88:	5f                   	pop    %edi
+  800b89:	5d                   	pop    %ebp
+  800b8a:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800b8b:	83 ec 0c             	sub    $0xc,%esp
+  800b8e:	50                   	push   %eax
+  800b8f:	6a 05                	push   $0x5
+  800b91:	68 e3 28 80 00       	push   $0x8028e3
+  800b96:	6a 3e                	push   $0x3e
+  800b98:	68 00 29 80 00       	push   $0x802900
+  800b9d:	e8 ee 13 00 00       	call   801f90 <_panic>
+
+00800ba2 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  800ba2:	55                   	push   %ebp
+  800ba3:	89 e5                	mov    %esp,%ebp
+  800ba5:	57                   	push   %edi
+  800ba6:	56                   	push   %esi
+  800ba7:	53                   	push   %ebx
+  800ba8:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800bab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800bb0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bb3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bb6:	b8 06 00 00 00       	mov    $0x6,%eax
+  800bbb:	89 df                	mov    %ebx,%edi
+  800bbd:	89 de                	mov    %ebx,%esi
+  800bbf:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800bc1:	85 c0                	test   %eax,%eax
+  800bc3:	7f 08                	jg     800bcd <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800bc5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bc8:	5b                   	pop    %ebx
+  800bc9:	5e                   	pop    %esi
+  800bca:	5f                   	pop    %edi
+  800bcb:	5d                   	pop    %ebp
+  800bcc:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800bcd:	83 ec 0c             	sub    $0xc,%esp
+  800bd0:	50                   	push   %eax
+  800bd1:	6a 06                	push   $0x6
+  800bd3:	68 e3 28 80 00       	push   $0x8028e3
+  800bd8:	6a 3e                	push   $0x3e
+  800bda:	68 00 29 80 00       	push   $0x802900
+  800bdf:	e8 ac 13 00 00       	call   801f90 <_panic>
+
+00800be4 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800be4:	55                   	push   %ebp
+  800be5:	89 e5                	mov    %esp,%ebp
+  800be7:	57                   	push   %edi
+  800be8:	56                   	push   %esi
+  800be9:	53                   	push   %ebx
+  800bea:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800bed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800bf2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bf5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bf8:	b8 08 00 00 00       	mov    $0x8,%eax
+  800bfd:	89 df                	mov    %ebx,%edi
+  800bff:	89 de                	mov    %ebx,%esi
+  800c01:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c03:	85 c0                	test   %eax,%eax
+  800c05:	7f 08                	jg     800c0f <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800c07:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c0a:	5b                   	pop    %ebx
+  800c0b:	5e                   	pop    %esi
+  800c0c:	5f                   	pop    %edi
+  800c0d:	5d                   	pop    %ebp
+  800c0e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c0f:	83 ec 0c             	sub    $0xc,%esp
+  800c12:	50                   	push   %eax
+  800c13:	6a 08                	push   $0x8
+  800c15:	68 e3 28 80 00       	push   $0x8028e3
+  800c1a:	6a 3e                	push   $0x3e
+  800c1c:	68 00 29 80 00       	push   $0x802900
+  800c21:	e8 6a 13 00 00       	call   801f90 <_panic>
+
+00800c26 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800c26:	55                   	push   %ebp
+  800c27:	89 e5                	mov    %esp,%ebp
+  800c29:	57                   	push   %edi
+  800c2a:	56                   	push   %esi
+  800c2b:	53                   	push   %ebx
+  800c2c:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c2f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c34:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c37:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c3a:	b8 09 00 00 00       	mov    $0x9,%eax
+  800c3f:	89 df                	mov    %ebx,%edi
+  800c41:	89 de                	mov    %ebx,%esi
+  800c43:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c45:	85 c0                	test   %eax,%eax
+  800c47:	7f 08                	jg     800c51 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800c49:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c4c:	5b                   	pop    %ebx
+  800c4d:	5e                   	pop    %esi
+  800c4e:	5f                   	pop    %edi
+  800c4f:	5d                   	pop    %ebp
+  800c50:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c51:	83 ec 0c             	sub    $0xc,%esp
+  800c54:	50                   	push   %eax
+  800c55:	6a 09                	push   $0x9
+  800c57:	68 e3 28 80 00       	push   $0x8028e3
+  800c5c:	6a 3e                	push   $0x3e
+  800c5e:	68 00 29 80 00       	push   $0x802900
+  800c63:	e8 28 13 00 00       	call   801f90 <_panic>
+
+00800c68 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800c68:	55                   	push   %ebp
+  800c69:	89 e5                	mov    %esp,%ebp
+  800c6b:	57                   	push   %edi
+  800c6c:	56                   	push   %esi
+  800c6d:	53                   	push   %ebx
+  800c6e:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c71:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c76:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c79:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c7c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c81:	89 df                	mov    %ebx,%edi
+  800c83:	89 de                	mov    %ebx,%esi
+  800c85:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c87:	85 c0                	test   %eax,%eax
+  800c89:	7f 08                	jg     800c93 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800c8b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c8e:	5b                   	pop    %ebx
+  800c8f:	5e                   	pop    %esi
+  800c90:	5f                   	pop    %edi
+  800c91:	5d                   	pop    %ebp
+  800c92:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c93:	83 ec 0c             	sub    $0xc,%esp
+  800c96:	50                   	push   %eax
+  800c97:	6a 0a                	push   $0xa
+  800c99:	68 e3 28 80 00       	push   $0x8028e3
+  800c9e:	6a 3e                	push   $0x3e
+  800ca0:	68 00 29 80 00       	push   $0x802900
+  800ca5:	e8 e6 12 00 00       	call   801f90 <_panic>
+
+00800caa <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  800caa:	55                   	push   %ebp
+  800cab:	89 e5                	mov    %esp,%ebp
+  800cad:	57                   	push   %edi
+  800cae:	56                   	push   %esi
+  800caf:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800cb0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cb3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cb6:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800cbb:	be 00 00 00 00       	mov    $0x0,%esi
+  800cc0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cc3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800cc6:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800cc8:	5b                   	pop    %ebx
+  800cc9:	5e                   	pop    %esi
+  800cca:	5f                   	pop    %edi
+  800ccb:	5d                   	pop    %ebp
+  800ccc:	c3                   	ret
+
+00800ccd <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  800ccd:	55                   	push   %ebp
+  800cce:	89 e5                	mov    %esp,%ebp
+  800cd0:	57                   	push   %edi
+  800cd1:	56                   	push   %esi
+  800cd2:	53                   	push   %ebx
+  800cd3:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800cd6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cdb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cde:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800ce3:	89 cb                	mov    %ecx,%ebx
+  800ce5:	89 cf                	mov    %ecx,%edi
+  800ce7:	89 ce                	mov    %ecx,%esi
+  800ce9:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ceb:	85 c0                	test   %eax,%eax
+  800ced:	7f 08                	jg     800cf7 <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  800cef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cf2:	5b                   	pop    %ebx
+  800cf3:	5e                   	pop    %esi
+  800cf4:	5f                   	pop    %edi
+  800cf5:	5d                   	pop    %ebp
+  800cf6:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800cf7:	83 ec 0c             	sub    $0xc,%esp
+  800cfa:	50                   	push   %eax
+  800cfb:	6a 0d                	push   $0xd
+  800cfd:	68 e3 28 80 00       	push   $0x8028e3
+  800d02:	6a 3e                	push   $0x3e
+  800d04:	68 00 29 80 00       	push   $0x802900
+  800d09:	e8 82 12 00 00       	call   801f90 <_panic>
+
+00800d0e <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  800d0e:	55                   	push   %ebp
+  800d0f:	89 e5                	mov    %esp,%ebp
+  800d11:	57                   	push   %edi
+  800d12:	56                   	push   %esi
+  800d13:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d14:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d19:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d1c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d1f:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800d24:	89 df                	mov    %ebx,%edi
+  800d26:	89 de                	mov    %ebx,%esi
+  800d28:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  800d2a:	5b                   	pop    %ebx
+  800d2b:	5e                   	pop    %esi
+  800d2c:	5f                   	pop    %edi
+  800d2d:	5d                   	pop    %ebp
+  800d2e:	c3                   	ret
+
+00800d2f <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  800d2f:	55                   	push   %ebp
+  800d30:	89 e5                	mov    %esp,%ebp
+  800d32:	57                   	push   %edi
+  800d33:	56                   	push   %esi
+  800d34:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d35:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d3a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d3d:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800d42:	89 cb                	mov    %ecx,%ebx
+  800d44:	89 cf                	mov    %ecx,%edi
+  800d46:	89 ce                	mov    %ecx,%esi
+  800d48:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  800d4a:	5b                   	pop    %ebx
+  800d4b:	5e                   	pop    %esi
+  800d4c:	5f                   	pop    %edi
+  800d4d:	5d                   	pop    %ebp
+  800d4e:	c3                   	ret
+
+00800d4f <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  800d4f:	55                   	push   %ebp
+  800d50:	89 e5                	mov    %esp,%ebp
+  800d52:	57                   	push   %edi
+  800d53:	56                   	push   %esi
+  800d54:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d55:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d5a:	b8 10 00 00 00       	mov    $0x10,%eax
+  800d5f:	89 d1                	mov    %edx,%ecx
+  800d61:	89 d3                	mov    %edx,%ebx
+  800d63:	89 d7                	mov    %edx,%edi
+  800d65:	89 d6                	mov    %edx,%esi
+  800d67:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800d69:	5b                   	pop    %ebx
+  800d6a:	5e                   	pop    %esi
+  800d6b:	5f                   	pop    %edi
+  800d6c:	5d                   	pop    %ebp
+  800d6d:	c3                   	ret
+
+00800d6e <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  800d6e:	55                   	push   %ebp
+  800d6f:	89 e5                	mov    %esp,%ebp
+  800d71:	57                   	push   %edi
+  800d72:	56                   	push   %esi
+  800d73:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d74:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d79:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d7c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d7f:	b8 11 00 00 00       	mov    $0x11,%eax
+  800d84:	89 df                	mov    %ebx,%edi
+  800d86:	89 de                	mov    %ebx,%esi
+  800d88:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800d8a:	5b                   	pop    %ebx
+  800d8b:	5e                   	pop    %esi
+  800d8c:	5f                   	pop    %edi
+  800d8d:	5d                   	pop    %ebp
+  800d8e:	c3                   	ret
+
+00800d8f <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  800d8f:	55                   	push   %ebp
+  800d90:	89 e5                	mov    %esp,%ebp
+  800d92:	57                   	push   %edi
+  800d93:	56                   	push   %esi
+  800d94:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d95:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d9a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d9d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800da0:	b8 12 00 00 00       	mov    $0x12,%eax
+  800da5:	89 df                	mov    %ebx,%edi
+  800da7:	89 de                	mov    %ebx,%esi
+  800da9:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800dab:	5b                   	pop    %ebx
+  800dac:	5e                   	pop    %esi
+  800dad:	5f                   	pop    %edi
+  800dae:	5d                   	pop    %ebp
+  800daf:	c3                   	ret
+
+00800db0 <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  800db0:	55                   	push   %ebp
+  800db1:	89 e5                	mov    %esp,%ebp
+  800db3:	57                   	push   %edi
+  800db4:	56                   	push   %esi
+  800db5:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800db6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dbb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dbe:	b8 13 00 00 00       	mov    $0x13,%eax
+  800dc3:	89 cb                	mov    %ecx,%ebx
+  800dc5:	89 cf                	mov    %ecx,%edi
+  800dc7:	89 ce                	mov    %ecx,%esi
+  800dc9:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  800dcb:	5b                   	pop    %ebx
+  800dcc:	5e                   	pop    %esi
+  800dcd:	5f                   	pop    %edi
+  800dce:	5d                   	pop    %ebp
+  800dcf:	c3                   	ret
+
+00800dd0 <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  800dd0:	55                   	push   %ebp
+  800dd1:	89 e5                	mov    %esp,%ebp
+  800dd3:	57                   	push   %edi
+  800dd4:	56                   	push   %esi
+  800dd5:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800dd6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ddb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dde:	b8 14 00 00 00       	mov    $0x14,%eax
+  800de3:	89 cb                	mov    %ecx,%ebx
+  800de5:	89 cf                	mov    %ecx,%edi
+  800de7:	89 ce                	mov    %ecx,%esi
+  800de9:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  800deb:	5b                   	pop    %ebx
+  800dec:	5e                   	pop    %esi
+  800ded:	5f                   	pop    %edi
+  800dee:	5d                   	pop    %ebp
+  800def:	c3                   	ret
+
+00800df0 <set_pgfault_handler>:
+// allocate an exception stack (one page of memory with its top
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf)) {
+  800df0:	55                   	push   %ebp
+  800df1:	89 e5                	mov    %esp,%ebp
+  800df3:	83 ec 08             	sub    $0x8,%esp
+  int r;
+
+  if (_pgfault_handler == 0) {
+  800df6:	83 3d 0c 40 80 00 00 	cmpl   $0x0,0x80400c
+  800dfd:	74 0a                	je     800e09 <set_pgfault_handler+0x19>
+    if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)))
+      panic(" set_pgfault_handler sys_env_set_pgfault_upcall panic: %e\n", r);
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  800dff:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e02:	a3 0c 40 80 00       	mov    %eax,0x80400c
+
+
+}
+  800e07:	c9                   	leave
+  800e08:	c3                   	ret
+    if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)))
+  800e09:	83 ec 04             	sub    $0x4,%esp
+  800e0c:	6a 07                	push   $0x7
+  800e0e:	68 00 f0 bf ee       	push   $0xeebff000
+  800e13:	6a 00                	push   $0x0
+  800e15:	e8 03 fd ff ff       	call   800b1d <sys_page_alloc>
+  800e1a:	83 c4 10             	add    $0x10,%esp
+  800e1d:	85 c0                	test   %eax,%eax
+  800e1f:	75 28                	jne    800e49 <set_pgfault_handler+0x59>
+    if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)))
+  800e21:	83 ec 08             	sub    $0x8,%esp
+  800e24:	68 5b 0e 80 00       	push   $0x800e5b
+  800e29:	6a 00                	push   $0x0
+  800e2b:	e8 38 fe ff ff       	call   800c68 <sys_env_set_pgfault_upcall>
+  800e30:	83 c4 10             	add    $0x10,%esp
+  800e33:	85 c0                	test   %eax,%eax
+  800e35:	74 c8                	je     800dff <set_pgfault_handler+0xf>
+      panic(" set_pgfault_handler sys_env_set_pgfault_upcall panic: %e\n", r);
+  800e37:	50                   	push   %eax
+  800e38:	68 40 29 80 00       	push   $0x802940
+  800e3d:	6a 22                	push   $0x22
+  800e3f:	68 7b 29 80 00       	push   $0x80297b
+  800e44:	e8 47 11 00 00       	call   801f90 <_panic>
+      panic("set_pgfault_handler sys_page_alloc panic: %e\n", r);
+  800e49:	50                   	push   %eax
+  800e4a:	68 10 29 80 00       	push   $0x802910
+  800e4f:	6a 20                	push   $0x20
+  800e51:	68 7b 29 80 00       	push   $0x80297b
+  800e56:	e8 35 11 00 00       	call   801f90 <_panic>
+
+00800e5b <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  800e5b:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  800e5c:	a1 0c 40 80 00       	mov    0x80400c,%eax
+	call *%eax
+  800e61:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  800e63:	83 c4 04             	add    $0x4,%esp
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	// push the trap-time %eip onto the trap-time stack
+    subl $0x4, 0x30(%esp) # for push eip
+  800e66:	83 6c 24 30 04       	subl   $0x4,0x30(%esp)
+    movl 0x30(%esp), %ebx #regular esp
+  800e6b:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+    movl 0x28(%esp), %eax #eip
+  800e6f:	8b 44 24 28          	mov    0x28(%esp),%eax
+    movl %eax, (%ebx)
+  800e73:	89 03                	mov    %eax,(%ebx)
+
+    // Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+    addl $8, %esp
+  800e75:	83 c4 08             	add    $0x8,%esp
+    popal
+  800e78:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  800e79:	83 c4 04             	add    $0x4,%esp
+	popfl
+  800e7c:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  800e7d:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  800e7e:	c3                   	ret
+
+00800e7f <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800e7f:	55                   	push   %ebp
+  800e80:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800e82:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e85:	05 00 00 00 30       	add    $0x30000000,%eax
+  800e8a:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800e8d:	5d                   	pop    %ebp
+  800e8e:	c3                   	ret
+
+00800e8f <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800e8f:	55                   	push   %ebp
+  800e90:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800e92:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e95:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800e9a:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800e9f:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800ea4:	5d                   	pop    %ebp
+  800ea5:	c3                   	ret
+
+00800ea6 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800ea6:	55                   	push   %ebp
+  800ea7:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  800ea9:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800eae:	eb 02                	jmp    800eb2 <fd_alloc+0xc>
+  800eb0:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800eb2:	89 c2                	mov    %eax,%edx
+  800eb4:	c1 ea 16             	shr    $0x16,%edx
+  800eb7:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800ebe:	f6 c2 01             	test   $0x1,%dl
+  800ec1:	74 2b                	je     800eee <fd_alloc+0x48>
+  800ec3:	89 c2                	mov    %eax,%edx
+  800ec5:	c1 ea 0c             	shr    $0xc,%edx
+  800ec8:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  800ecf:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  800ed5:	f6 c1 01             	test   $0x1,%cl
+  800ed8:	74 14                	je     800eee <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  800eda:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  800ee0:	75 ce                	jne    800eb0 <fd_alloc+0xa>
+  800ee2:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  800ee7:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800eec:	eb 05                	jmp    800ef3 <fd_alloc+0x4d>
+			return 0;
+  800eee:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  800ef3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef6:	89 02                	mov    %eax,(%edx)
+}
+  800ef8:	89 c8                	mov    %ecx,%eax
+  800efa:	5d                   	pop    %ebp
+  800efb:	c3                   	ret
+
+00800efc <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  800efc:	55                   	push   %ebp
+  800efd:	89 e5                	mov    %esp,%ebp
+  800eff:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  800f02:	83 f8 1f             	cmp    $0x1f,%eax
+  800f05:	77 30                	ja     800f37 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  800f07:	c1 e0 0c             	shl    $0xc,%eax
+  800f0a:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800f0f:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  800f15:	f6 c2 01             	test   $0x1,%dl
+  800f18:	74 24                	je     800f3e <fd_lookup+0x42>
+  800f1a:	89 c2                	mov    %eax,%edx
+  800f1c:	c1 ea 0c             	shr    $0xc,%edx
+  800f1f:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800f26:	f6 c2 01             	test   $0x1,%dl
+  800f29:	74 1a                	je     800f45 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  800f2b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800f2e:	89 02                	mov    %eax,(%edx)
+	return 0;
+  800f30:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f35:	5d                   	pop    %ebp
+  800f36:	c3                   	ret
+		return -E_INVAL;
+  800f37:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f3c:	eb f7                	jmp    800f35 <fd_lookup+0x39>
+		return -E_INVAL;
+  800f3e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f43:	eb f0                	jmp    800f35 <fd_lookup+0x39>
+  800f45:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f4a:	eb e9                	jmp    800f35 <fd_lookup+0x39>
+
+00800f4c <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  800f4c:	55                   	push   %ebp
+  800f4d:	89 e5                	mov    %esp,%ebp
+  800f4f:	53                   	push   %ebx
+  800f50:	83 ec 04             	sub    $0x4,%esp
+  800f53:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  800f56:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f5b:	eb 03                	jmp    800f60 <dev_lookup+0x14>
+  800f5d:	83 c0 01             	add    $0x1,%eax
+  800f60:	8b 1c 85 08 2a 80 00 	mov    0x802a08(,%eax,4),%ebx
+  800f67:	85 db                	test   %ebx,%ebx
+  800f69:	74 0b                	je     800f76 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  800f6b:	39 13                	cmp    %edx,(%ebx)
+  800f6d:	75 ee                	jne    800f5d <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  800f6f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f74:	eb 1f                	jmp    800f95 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800f76:	a1 08 40 80 00       	mov    0x804008,%eax
+  800f7b:	8b 40 48             	mov    0x48(%eax),%eax
+  800f7e:	83 ec 04             	sub    $0x4,%esp
+  800f81:	52                   	push   %edx
+  800f82:	50                   	push   %eax
+  800f83:	68 8c 29 80 00       	push   $0x80298c
+  800f88:	e8 eb f1 ff ff       	call   800178 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  800f8d:	83 c4 10             	add    $0x10,%esp
+  800f90:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  800f95:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800f98:	89 1a                	mov    %ebx,(%edx)
+}
+  800f9a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f9d:	c9                   	leave
+  800f9e:	c3                   	ret
+
+00800f9f <fd_close>:
+{
+  800f9f:	55                   	push   %ebp
+  800fa0:	89 e5                	mov    %esp,%ebp
+  800fa2:	57                   	push   %edi
+  800fa3:	56                   	push   %esi
+  800fa4:	53                   	push   %ebx
+  800fa5:	83 ec 24             	sub    $0x24,%esp
+  800fa8:	8b 75 08             	mov    0x8(%ebp),%esi
+  800fab:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800fae:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800fb1:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800fb2:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800fb8:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800fbb:	50                   	push   %eax
+  800fbc:	e8 3b ff ff ff       	call   800efc <fd_lookup>
+  800fc1:	89 c3                	mov    %eax,%ebx
+  800fc3:	83 c4 10             	add    $0x10,%esp
+  800fc6:	85 c0                	test   %eax,%eax
+  800fc8:	78 05                	js     800fcf <fd_close+0x30>
+	    || fd != fd2)
+  800fca:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  800fcd:	74 16                	je     800fe5 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  800fcf:	89 f8                	mov    %edi,%eax
+  800fd1:	84 c0                	test   %al,%al
+  800fd3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fd8:	0f 44 d8             	cmove  %eax,%ebx
+}
+  800fdb:	89 d8                	mov    %ebx,%eax
+  800fdd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fe0:	5b                   	pop    %ebx
+  800fe1:	5e                   	pop    %esi
+  800fe2:	5f                   	pop    %edi
+  800fe3:	5d                   	pop    %ebp
+  800fe4:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800fe5:	83 ec 08             	sub    $0x8,%esp
+  800fe8:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800feb:	50                   	push   %eax
+  800fec:	ff 36                	push   (%esi)
+  800fee:	e8 59 ff ff ff       	call   800f4c <dev_lookup>
+  800ff3:	89 c3                	mov    %eax,%ebx
+  800ff5:	83 c4 10             	add    $0x10,%esp
+  800ff8:	85 c0                	test   %eax,%eax
+  800ffa:	78 1a                	js     801016 <fd_close+0x77>
+		if (dev->dev_close)
+  800ffc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800fff:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801002:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801007:	85 c0                	test   %eax,%eax
+  801009:	74 0b                	je     801016 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80100b:	83 ec 0c             	sub    $0xc,%esp
+  80100e:	56                   	push   %esi
+  80100f:	ff d0                	call   *%eax
+  801011:	89 c3                	mov    %eax,%ebx
+  801013:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801016:	83 ec 08             	sub    $0x8,%esp
+  801019:	56                   	push   %esi
+  80101a:	6a 00                	push   $0x0
+  80101c:	e8 81 fb ff ff       	call   800ba2 <sys_page_unmap>
+	return r;
+  801021:	83 c4 10             	add    $0x10,%esp
+  801024:	eb b5                	jmp    800fdb <fd_close+0x3c>
+
+00801026 <close>:
+
+int
+close(int fdnum)
+{
+  801026:	55                   	push   %ebp
+  801027:	89 e5                	mov    %esp,%ebp
+  801029:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80102c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80102f:	50                   	push   %eax
+  801030:	ff 75 08             	push   0x8(%ebp)
+  801033:	e8 c4 fe ff ff       	call   800efc <fd_lookup>
+  801038:	83 c4 10             	add    $0x10,%esp
+  80103b:	85 c0                	test   %eax,%eax
+  80103d:	79 02                	jns    801041 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80103f:	c9                   	leave
+  801040:	c3                   	ret
+		return fd_close(fd, 1);
+  801041:	83 ec 08             	sub    $0x8,%esp
+  801044:	6a 01                	push   $0x1
+  801046:	ff 75 f4             	push   -0xc(%ebp)
+  801049:	e8 51 ff ff ff       	call   800f9f <fd_close>
+  80104e:	83 c4 10             	add    $0x10,%esp
+  801051:	eb ec                	jmp    80103f <close+0x19>
+
+00801053 <close_all>:
+
+void
+close_all(void)
+{
+  801053:	55                   	push   %ebp
+  801054:	89 e5                	mov    %esp,%ebp
+  801056:	53                   	push   %ebx
+  801057:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80105a:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80105f:	83 ec 0c             	sub    $0xc,%esp
+  801062:	53                   	push   %ebx
+  801063:	e8 be ff ff ff       	call   801026 <close>
+	for (i = 0; i < MAXFD; i++)
+  801068:	83 c3 01             	add    $0x1,%ebx
+  80106b:	83 c4 10             	add    $0x10,%esp
+  80106e:	83 fb 20             	cmp    $0x20,%ebx
+  801071:	75 ec                	jne    80105f <close_all+0xc>
+}
+  801073:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801076:	c9                   	leave
+  801077:	c3                   	ret
+
+00801078 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801078:	55                   	push   %ebp
+  801079:	89 e5                	mov    %esp,%ebp
+  80107b:	57                   	push   %edi
+  80107c:	56                   	push   %esi
+  80107d:	53                   	push   %ebx
+  80107e:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801081:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801084:	50                   	push   %eax
+  801085:	ff 75 08             	push   0x8(%ebp)
+  801088:	e8 6f fe ff ff       	call   800efc <fd_lookup>
+  80108d:	89 c3                	mov    %eax,%ebx
+  80108f:	83 c4 10             	add    $0x10,%esp
+  801092:	85 c0                	test   %eax,%eax
+  801094:	78 7f                	js     801115 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801096:	83 ec 0c             	sub    $0xc,%esp
+  801099:	ff 75 0c             	push   0xc(%ebp)
+  80109c:	e8 85 ff ff ff       	call   801026 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8010a1:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8010a4:	c1 e6 0c             	shl    $0xc,%esi
+  8010a7:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8010ad:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8010b0:	89 3c 24             	mov    %edi,(%esp)
+  8010b3:	e8 d7 fd ff ff       	call   800e8f <fd2data>
+  8010b8:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8010ba:	89 34 24             	mov    %esi,(%esp)
+  8010bd:	e8 cd fd ff ff       	call   800e8f <fd2data>
+  8010c2:	83 c4 10             	add    $0x10,%esp
+  8010c5:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8010c8:	89 d8                	mov    %ebx,%eax
+  8010ca:	c1 e8 16             	shr    $0x16,%eax
+  8010cd:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8010d4:	a8 01                	test   $0x1,%al
+  8010d6:	74 11                	je     8010e9 <dup+0x71>
+  8010d8:	89 d8                	mov    %ebx,%eax
+  8010da:	c1 e8 0c             	shr    $0xc,%eax
+  8010dd:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8010e4:	f6 c2 01             	test   $0x1,%dl
+  8010e7:	75 36                	jne    80111f <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8010e9:	89 f8                	mov    %edi,%eax
+  8010eb:	c1 e8 0c             	shr    $0xc,%eax
+  8010ee:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8010f5:	83 ec 0c             	sub    $0xc,%esp
+  8010f8:	25 07 0e 00 00       	and    $0xe07,%eax
+  8010fd:	50                   	push   %eax
+  8010fe:	56                   	push   %esi
+  8010ff:	6a 00                	push   $0x0
+  801101:	57                   	push   %edi
+  801102:	6a 00                	push   $0x0
+  801104:	e8 57 fa ff ff       	call   800b60 <sys_page_map>
+  801109:	89 c3                	mov    %eax,%ebx
+  80110b:	83 c4 20             	add    $0x20,%esp
+  80110e:	85 c0                	test   %eax,%eax
+  801110:	78 33                	js     801145 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801112:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801115:	89 d8                	mov    %ebx,%eax
+  801117:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80111a:	5b                   	pop    %ebx
+  80111b:	5e                   	pop    %esi
+  80111c:	5f                   	pop    %edi
+  80111d:	5d                   	pop    %ebp
+  80111e:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80111f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801126:	83 ec 0c             	sub    $0xc,%esp
+  801129:	25 07 0e 00 00       	and    $0xe07,%eax
+  80112e:	50                   	push   %eax
+  80112f:	ff 75 d4             	push   -0x2c(%ebp)
+  801132:	6a 00                	push   $0x0
+  801134:	53                   	push   %ebx
+  801135:	6a 00                	push   $0x0
+  801137:	e8 24 fa ff ff       	call   800b60 <sys_page_map>
+  80113c:	89 c3                	mov    %eax,%ebx
+  80113e:	83 c4 20             	add    $0x20,%esp
+  801141:	85 c0                	test   %eax,%eax
+  801143:	79 a4                	jns    8010e9 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801145:	83 ec 08             	sub    $0x8,%esp
+  801148:	56                   	push   %esi
+  801149:	6a 00                	push   $0x0
+  80114b:	e8 52 fa ff ff       	call   800ba2 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801150:	83 c4 08             	add    $0x8,%esp
+  801153:	ff 75 d4             	push   -0x2c(%ebp)
+  801156:	6a 00                	push   $0x0
+  801158:	e8 45 fa ff ff       	call   800ba2 <sys_page_unmap>
+	return r;
+  80115d:	83 c4 10             	add    $0x10,%esp
+  801160:	eb b3                	jmp    801115 <dup+0x9d>
+
+00801162 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801162:	55                   	push   %ebp
+  801163:	89 e5                	mov    %esp,%ebp
+  801165:	56                   	push   %esi
+  801166:	53                   	push   %ebx
+  801167:	83 ec 18             	sub    $0x18,%esp
+  80116a:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80116d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801170:	50                   	push   %eax
+  801171:	56                   	push   %esi
+  801172:	e8 85 fd ff ff       	call   800efc <fd_lookup>
+  801177:	83 c4 10             	add    $0x10,%esp
+  80117a:	85 c0                	test   %eax,%eax
+  80117c:	78 3c                	js     8011ba <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80117e:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801181:	83 ec 08             	sub    $0x8,%esp
+  801184:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801187:	50                   	push   %eax
+  801188:	ff 33                	push   (%ebx)
+  80118a:	e8 bd fd ff ff       	call   800f4c <dev_lookup>
+  80118f:	83 c4 10             	add    $0x10,%esp
+  801192:	85 c0                	test   %eax,%eax
+  801194:	78 24                	js     8011ba <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801196:	8b 43 08             	mov    0x8(%ebx),%eax
+  801199:	83 e0 03             	and    $0x3,%eax
+  80119c:	83 f8 01             	cmp    $0x1,%eax
+  80119f:	74 20                	je     8011c1 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8011a1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8011a4:	8b 40 08             	mov    0x8(%eax),%eax
+  8011a7:	85 c0                	test   %eax,%eax
+  8011a9:	74 37                	je     8011e2 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8011ab:	83 ec 04             	sub    $0x4,%esp
+  8011ae:	ff 75 10             	push   0x10(%ebp)
+  8011b1:	ff 75 0c             	push   0xc(%ebp)
+  8011b4:	53                   	push   %ebx
+  8011b5:	ff d0                	call   *%eax
+  8011b7:	83 c4 10             	add    $0x10,%esp
+}
+  8011ba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8011bd:	5b                   	pop    %ebx
+  8011be:	5e                   	pop    %esi
+  8011bf:	5d                   	pop    %ebp
+  8011c0:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8011c1:	a1 08 40 80 00       	mov    0x804008,%eax
+  8011c6:	8b 40 48             	mov    0x48(%eax),%eax
+  8011c9:	83 ec 04             	sub    $0x4,%esp
+  8011cc:	56                   	push   %esi
+  8011cd:	50                   	push   %eax
+  8011ce:	68 cd 29 80 00       	push   $0x8029cd
+  8011d3:	e8 a0 ef ff ff       	call   800178 <cprintf>
+		return -E_INVAL;
+  8011d8:	83 c4 10             	add    $0x10,%esp
+  8011db:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011e0:	eb d8                	jmp    8011ba <read+0x58>
+		return -E_NOT_SUPP;
+  8011e2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8011e7:	eb d1                	jmp    8011ba <read+0x58>
+
+008011e9 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8011e9:	55                   	push   %ebp
+  8011ea:	89 e5                	mov    %esp,%ebp
+  8011ec:	57                   	push   %edi
+  8011ed:	56                   	push   %esi
+  8011ee:	53                   	push   %ebx
+  8011ef:	83 ec 0c             	sub    $0xc,%esp
+  8011f2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8011f5:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8011f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011fd:	eb 02                	jmp    801201 <readn+0x18>
+  8011ff:	01 c3                	add    %eax,%ebx
+  801201:	39 f3                	cmp    %esi,%ebx
+  801203:	73 21                	jae    801226 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801205:	83 ec 04             	sub    $0x4,%esp
+  801208:	89 f0                	mov    %esi,%eax
+  80120a:	29 d8                	sub    %ebx,%eax
+  80120c:	50                   	push   %eax
+  80120d:	89 d8                	mov    %ebx,%eax
+  80120f:	03 45 0c             	add    0xc(%ebp),%eax
+  801212:	50                   	push   %eax
+  801213:	57                   	push   %edi
+  801214:	e8 49 ff ff ff       	call   801162 <read>
+		if (m < 0)
+  801219:	83 c4 10             	add    $0x10,%esp
+  80121c:	85 c0                	test   %eax,%eax
+  80121e:	78 04                	js     801224 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801220:	75 dd                	jne    8011ff <readn+0x16>
+  801222:	eb 02                	jmp    801226 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801224:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801226:	89 d8                	mov    %ebx,%eax
+  801228:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80122b:	5b                   	pop    %ebx
+  80122c:	5e                   	pop    %esi
+  80122d:	5f                   	pop    %edi
+  80122e:	5d                   	pop    %ebp
+  80122f:	c3                   	ret
+
+00801230 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801230:	55                   	push   %ebp
+  801231:	89 e5                	mov    %esp,%ebp
+  801233:	56                   	push   %esi
+  801234:	53                   	push   %ebx
+  801235:	83 ec 18             	sub    $0x18,%esp
+  801238:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80123b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80123e:	50                   	push   %eax
+  80123f:	53                   	push   %ebx
+  801240:	e8 b7 fc ff ff       	call   800efc <fd_lookup>
+  801245:	83 c4 10             	add    $0x10,%esp
+  801248:	85 c0                	test   %eax,%eax
+  80124a:	78 37                	js     801283 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80124c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80124f:	83 ec 08             	sub    $0x8,%esp
+  801252:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801255:	50                   	push   %eax
+  801256:	ff 36                	push   (%esi)
+  801258:	e8 ef fc ff ff       	call   800f4c <dev_lookup>
+  80125d:	83 c4 10             	add    $0x10,%esp
+  801260:	85 c0                	test   %eax,%eax
+  801262:	78 1f                	js     801283 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801264:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801268:	74 20                	je     80128a <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80126a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80126d:	8b 40 0c             	mov    0xc(%eax),%eax
+  801270:	85 c0                	test   %eax,%eax
+  801272:	74 37                	je     8012ab <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801274:	83 ec 04             	sub    $0x4,%esp
+  801277:	ff 75 10             	push   0x10(%ebp)
+  80127a:	ff 75 0c             	push   0xc(%ebp)
+  80127d:	56                   	push   %esi
+  80127e:	ff d0                	call   *%eax
+  801280:	83 c4 10             	add    $0x10,%esp
+}
+  801283:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801286:	5b                   	pop    %ebx
+  801287:	5e                   	pop    %esi
+  801288:	5d                   	pop    %ebp
+  801289:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80128a:	a1 08 40 80 00       	mov    0x804008,%eax
+  80128f:	8b 40 48             	mov    0x48(%eax),%eax
+  801292:	83 ec 04             	sub    $0x4,%esp
+  801295:	53                   	push   %ebx
+  801296:	50                   	push   %eax
+  801297:	68 e9 29 80 00       	push   $0x8029e9
+  80129c:	e8 d7 ee ff ff       	call   800178 <cprintf>
+		return -E_INVAL;
+  8012a1:	83 c4 10             	add    $0x10,%esp
+  8012a4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012a9:	eb d8                	jmp    801283 <write+0x53>
+		return -E_NOT_SUPP;
+  8012ab:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8012b0:	eb d1                	jmp    801283 <write+0x53>
+
+008012b2 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8012b2:	55                   	push   %ebp
+  8012b3:	89 e5                	mov    %esp,%ebp
+  8012b5:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8012b8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8012bb:	50                   	push   %eax
+  8012bc:	ff 75 08             	push   0x8(%ebp)
+  8012bf:	e8 38 fc ff ff       	call   800efc <fd_lookup>
+  8012c4:	83 c4 10             	add    $0x10,%esp
+  8012c7:	85 c0                	test   %eax,%eax
+  8012c9:	78 0e                	js     8012d9 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8012cb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012ce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8012d1:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8012d4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8012d9:	c9                   	leave
+  8012da:	c3                   	ret
+
+008012db <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8012db:	55                   	push   %ebp
+  8012dc:	89 e5                	mov    %esp,%ebp
+  8012de:	56                   	push   %esi
+  8012df:	53                   	push   %ebx
+  8012e0:	83 ec 18             	sub    $0x18,%esp
+  8012e3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8012e6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8012e9:	50                   	push   %eax
+  8012ea:	53                   	push   %ebx
+  8012eb:	e8 0c fc ff ff       	call   800efc <fd_lookup>
+  8012f0:	83 c4 10             	add    $0x10,%esp
+  8012f3:	85 c0                	test   %eax,%eax
+  8012f5:	78 34                	js     80132b <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8012f7:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8012fa:	83 ec 08             	sub    $0x8,%esp
+  8012fd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801300:	50                   	push   %eax
+  801301:	ff 36                	push   (%esi)
+  801303:	e8 44 fc ff ff       	call   800f4c <dev_lookup>
+  801308:	83 c4 10             	add    $0x10,%esp
+  80130b:	85 c0                	test   %eax,%eax
+  80130d:	78 1c                	js     80132b <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80130f:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801313:	74 1d                	je     801332 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801315:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801318:	8b 40 18             	mov    0x18(%eax),%eax
+  80131b:	85 c0                	test   %eax,%eax
+  80131d:	74 34                	je     801353 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80131f:	83 ec 08             	sub    $0x8,%esp
+  801322:	ff 75 0c             	push   0xc(%ebp)
+  801325:	56                   	push   %esi
+  801326:	ff d0                	call   *%eax
+  801328:	83 c4 10             	add    $0x10,%esp
+}
+  80132b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80132e:	5b                   	pop    %ebx
+  80132f:	5e                   	pop    %esi
+  801330:	5d                   	pop    %ebp
+  801331:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801332:	a1 08 40 80 00       	mov    0x804008,%eax
+  801337:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80133a:	83 ec 04             	sub    $0x4,%esp
+  80133d:	53                   	push   %ebx
+  80133e:	50                   	push   %eax
+  80133f:	68 ac 29 80 00       	push   $0x8029ac
+  801344:	e8 2f ee ff ff       	call   800178 <cprintf>
+		return -E_INVAL;
+  801349:	83 c4 10             	add    $0x10,%esp
+  80134c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801351:	eb d8                	jmp    80132b <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801353:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801358:	eb d1                	jmp    80132b <ftruncate+0x50>
+
+0080135a <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80135a:	55                   	push   %ebp
+  80135b:	89 e5                	mov    %esp,%ebp
+  80135d:	56                   	push   %esi
+  80135e:	53                   	push   %ebx
+  80135f:	83 ec 18             	sub    $0x18,%esp
+  801362:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801365:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801368:	50                   	push   %eax
+  801369:	ff 75 08             	push   0x8(%ebp)
+  80136c:	e8 8b fb ff ff       	call   800efc <fd_lookup>
+  801371:	83 c4 10             	add    $0x10,%esp
+  801374:	85 c0                	test   %eax,%eax
+  801376:	78 49                	js     8013c1 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801378:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80137b:	83 ec 08             	sub    $0x8,%esp
+  80137e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801381:	50                   	push   %eax
+  801382:	ff 36                	push   (%esi)
+  801384:	e8 c3 fb ff ff       	call   800f4c <dev_lookup>
+  801389:	83 c4 10             	add    $0x10,%esp
+  80138c:	85 c0                	test   %eax,%eax
+  80138e:	78 31                	js     8013c1 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801390:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801393:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801397:	74 2f                	je     8013c8 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801399:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80139c:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8013a3:	00 00 00 
+	stat->st_isdir = 0;
+  8013a6:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8013ad:	00 00 00 
+	stat->st_dev = dev;
+  8013b0:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8013b6:	83 ec 08             	sub    $0x8,%esp
+  8013b9:	53                   	push   %ebx
+  8013ba:	56                   	push   %esi
+  8013bb:	ff 50 14             	call   *0x14(%eax)
+  8013be:	83 c4 10             	add    $0x10,%esp
+}
+  8013c1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013c4:	5b                   	pop    %ebx
+  8013c5:	5e                   	pop    %esi
+  8013c6:	5d                   	pop    %ebp
+  8013c7:	c3                   	ret
+		return -E_NOT_SUPP;
+  8013c8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8013cd:	eb f2                	jmp    8013c1 <fstat+0x67>
+
+008013cf <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8013cf:	55                   	push   %ebp
+  8013d0:	89 e5                	mov    %esp,%ebp
+  8013d2:	56                   	push   %esi
+  8013d3:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8013d4:	83 ec 08             	sub    $0x8,%esp
+  8013d7:	6a 00                	push   $0x0
+  8013d9:	ff 75 08             	push   0x8(%ebp)
+  8013dc:	e8 e4 01 00 00       	call   8015c5 <open>
+  8013e1:	89 c3                	mov    %eax,%ebx
+  8013e3:	83 c4 10             	add    $0x10,%esp
+  8013e6:	85 c0                	test   %eax,%eax
+  8013e8:	78 1b                	js     801405 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8013ea:	83 ec 08             	sub    $0x8,%esp
+  8013ed:	ff 75 0c             	push   0xc(%ebp)
+  8013f0:	50                   	push   %eax
+  8013f1:	e8 64 ff ff ff       	call   80135a <fstat>
+  8013f6:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8013f8:	89 1c 24             	mov    %ebx,(%esp)
+  8013fb:	e8 26 fc ff ff       	call   801026 <close>
+	return r;
+  801400:	83 c4 10             	add    $0x10,%esp
+  801403:	89 f3                	mov    %esi,%ebx
+}
+  801405:	89 d8                	mov    %ebx,%eax
+  801407:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80140a:	5b                   	pop    %ebx
+  80140b:	5e                   	pop    %esi
+  80140c:	5d                   	pop    %ebp
+  80140d:	c3                   	ret
+
+0080140e <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  80140e:	55                   	push   %ebp
+  80140f:	89 e5                	mov    %esp,%ebp
+  801411:	56                   	push   %esi
+  801412:	53                   	push   %ebx
+  801413:	89 c6                	mov    %eax,%esi
+  801415:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  801417:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  80141e:	74 27                	je     801447 <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801420:	6a 07                	push   $0x7
+  801422:	68 00 50 80 00       	push   $0x805000
+  801427:	56                   	push   %esi
+  801428:	ff 35 00 40 80 00    	push   0x804000
+  80142e:	e8 17 0c 00 00       	call   80204a <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  801433:	83 c4 0c             	add    $0xc,%esp
+  801436:	6a 00                	push   $0x0
+  801438:	53                   	push   %ebx
+  801439:	6a 00                	push   $0x0
+  80143b:	e8 96 0b 00 00       	call   801fd6 <ipc_recv>
+}
+  801440:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801443:	5b                   	pop    %ebx
+  801444:	5e                   	pop    %esi
+  801445:	5d                   	pop    %ebp
+  801446:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  801447:	83 ec 0c             	sub    $0xc,%esp
+  80144a:	6a 01                	push   $0x1
+  80144c:	e8 4d 0c 00 00       	call   80209e <ipc_find_env>
+  801451:	a3 00 40 80 00       	mov    %eax,0x804000
+  801456:	83 c4 10             	add    $0x10,%esp
+  801459:	eb c5                	jmp    801420 <fsipc+0x12>
+
+0080145b <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80145b:	55                   	push   %ebp
+  80145c:	89 e5                	mov    %esp,%ebp
+  80145e:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801461:	8b 45 08             	mov    0x8(%ebp),%eax
+  801464:	8b 40 0c             	mov    0xc(%eax),%eax
+  801467:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.set_size.req_size = newsize;
+  80146c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80146f:	a3 04 50 80 00       	mov    %eax,0x805004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801474:	ba 00 00 00 00       	mov    $0x0,%edx
+  801479:	b8 02 00 00 00       	mov    $0x2,%eax
+  80147e:	e8 8b ff ff ff       	call   80140e <fsipc>
+}
+  801483:	c9                   	leave
+  801484:	c3                   	ret
+
+00801485 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801485:	55                   	push   %ebp
+  801486:	89 e5                	mov    %esp,%ebp
+  801488:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80148b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80148e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801491:	a3 00 50 80 00       	mov    %eax,0x805000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801496:	ba 00 00 00 00       	mov    $0x0,%edx
+  80149b:	b8 06 00 00 00       	mov    $0x6,%eax
+  8014a0:	e8 69 ff ff ff       	call   80140e <fsipc>
+}
+  8014a5:	c9                   	leave
+  8014a6:	c3                   	ret
+
+008014a7 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8014a7:	55                   	push   %ebp
+  8014a8:	89 e5                	mov    %esp,%ebp
+  8014aa:	53                   	push   %ebx
+  8014ab:	83 ec 04             	sub    $0x4,%esp
+  8014ae:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8014b1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014b4:	8b 40 0c             	mov    0xc(%eax),%eax
+  8014b7:	a3 00 50 80 00       	mov    %eax,0x805000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8014bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014c1:	b8 05 00 00 00       	mov    $0x5,%eax
+  8014c6:	e8 43 ff ff ff       	call   80140e <fsipc>
+  8014cb:	85 c0                	test   %eax,%eax
+  8014cd:	78 2c                	js     8014fb <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8014cf:	83 ec 08             	sub    $0x8,%esp
+  8014d2:	68 00 50 80 00       	push   $0x805000
+  8014d7:	53                   	push   %ebx
+  8014d8:	e8 54 f2 ff ff       	call   800731 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  8014dd:	a1 80 50 80 00       	mov    0x805080,%eax
+  8014e2:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8014e8:	a1 84 50 80 00       	mov    0x805084,%eax
+  8014ed:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  8014f3:	83 c4 10             	add    $0x10,%esp
+  8014f6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8014fb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014fe:	c9                   	leave
+  8014ff:	c3                   	ret
+
+00801500 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801500:	55                   	push   %ebp
+  801501:	89 e5                	mov    %esp,%ebp
+  801503:	83 ec 0c             	sub    $0xc,%esp
+  801506:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801509:	8b 55 08             	mov    0x8(%ebp),%edx
+  80150c:	8b 52 0c             	mov    0xc(%edx),%edx
+  80150f:	89 15 00 50 80 00    	mov    %edx,0x805000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801515:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  80151a:	39 d0                	cmp    %edx,%eax
+  80151c:	0f 47 c2             	cmova  %edx,%eax
+  80151f:	a3 04 50 80 00       	mov    %eax,0x805004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  801524:	50                   	push   %eax
+  801525:	ff 75 0c             	push   0xc(%ebp)
+  801528:	68 08 50 80 00       	push   $0x805008
+  80152d:	e8 85 f3 ff ff       	call   8008b7 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801532:	ba 00 00 00 00       	mov    $0x0,%edx
+  801537:	b8 04 00 00 00       	mov    $0x4,%eax
+  80153c:	e8 cd fe ff ff       	call   80140e <fsipc>
+}
+  801541:	c9                   	leave
+  801542:	c3                   	ret
+
+00801543 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801543:	55                   	push   %ebp
+  801544:	89 e5                	mov    %esp,%ebp
+  801546:	56                   	push   %esi
+  801547:	53                   	push   %ebx
+  801548:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80154b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80154e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801551:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.read.req_n = n;
+  801556:	89 35 04 50 80 00    	mov    %esi,0x805004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  80155c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801561:	b8 03 00 00 00       	mov    $0x3,%eax
+  801566:	e8 a3 fe ff ff       	call   80140e <fsipc>
+  80156b:	89 c3                	mov    %eax,%ebx
+  80156d:	85 c0                	test   %eax,%eax
+  80156f:	78 1f                	js     801590 <devfile_read+0x4d>
+  assert(r <= n);
+  801571:	39 c6                	cmp    %eax,%esi
+  801573:	72 24                	jb     801599 <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  801575:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80157a:	7f 33                	jg     8015af <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80157c:	83 ec 04             	sub    $0x4,%esp
+  80157f:	50                   	push   %eax
+  801580:	68 00 50 80 00       	push   $0x805000
+  801585:	ff 75 0c             	push   0xc(%ebp)
+  801588:	e8 2a f3 ff ff       	call   8008b7 <memmove>
+  return r;
+  80158d:	83 c4 10             	add    $0x10,%esp
+}
+  801590:	89 d8                	mov    %ebx,%eax
+  801592:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801595:	5b                   	pop    %ebx
+  801596:	5e                   	pop    %esi
+  801597:	5d                   	pop    %ebp
+  801598:	c3                   	ret
+  assert(r <= n);
+  801599:	68 1c 2a 80 00       	push   $0x802a1c
+  80159e:	68 23 2a 80 00       	push   $0x802a23
+  8015a3:	6a 78                	push   $0x78
+  8015a5:	68 38 2a 80 00       	push   $0x802a38
+  8015aa:	e8 e1 09 00 00       	call   801f90 <_panic>
+  assert(r <= PGSIZE);
+  8015af:	68 43 2a 80 00       	push   $0x802a43
+  8015b4:	68 23 2a 80 00       	push   $0x802a23
+  8015b9:	6a 79                	push   $0x79
+  8015bb:	68 38 2a 80 00       	push   $0x802a38
+  8015c0:	e8 cb 09 00 00       	call   801f90 <_panic>
+
+008015c5 <open>:
+open(const char *path, int mode) {
+  8015c5:	55                   	push   %ebp
+  8015c6:	89 e5                	mov    %esp,%ebp
+  8015c8:	56                   	push   %esi
+  8015c9:	53                   	push   %ebx
+  8015ca:	83 ec 1c             	sub    $0x1c,%esp
+  8015cd:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  8015d0:	56                   	push   %esi
+  8015d1:	e8 20 f1 ff ff       	call   8006f6 <strlen>
+  8015d6:	83 c4 10             	add    $0x10,%esp
+  8015d9:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8015de:	7f 6c                	jg     80164c <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  8015e0:	83 ec 0c             	sub    $0xc,%esp
+  8015e3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015e6:	50                   	push   %eax
+  8015e7:	e8 ba f8 ff ff       	call   800ea6 <fd_alloc>
+  8015ec:	89 c3                	mov    %eax,%ebx
+  8015ee:	83 c4 10             	add    $0x10,%esp
+  8015f1:	85 c0                	test   %eax,%eax
+  8015f3:	78 3c                	js     801631 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  8015f5:	83 ec 08             	sub    $0x8,%esp
+  8015f8:	56                   	push   %esi
+  8015f9:	68 00 50 80 00       	push   $0x805000
+  8015fe:	e8 2e f1 ff ff       	call   800731 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801603:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801606:	a3 00 54 80 00       	mov    %eax,0x805400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80160b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80160e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801613:	e8 f6 fd ff ff       	call   80140e <fsipc>
+  801618:	89 c3                	mov    %eax,%ebx
+  80161a:	83 c4 10             	add    $0x10,%esp
+  80161d:	85 c0                	test   %eax,%eax
+  80161f:	78 19                	js     80163a <open+0x75>
+  return fd2num(fd);
+  801621:	83 ec 0c             	sub    $0xc,%esp
+  801624:	ff 75 f4             	push   -0xc(%ebp)
+  801627:	e8 53 f8 ff ff       	call   800e7f <fd2num>
+  80162c:	89 c3                	mov    %eax,%ebx
+  80162e:	83 c4 10             	add    $0x10,%esp
+}
+  801631:	89 d8                	mov    %ebx,%eax
+  801633:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801636:	5b                   	pop    %ebx
+  801637:	5e                   	pop    %esi
+  801638:	5d                   	pop    %ebp
+  801639:	c3                   	ret
+    fd_close(fd, 0);
+  80163a:	83 ec 08             	sub    $0x8,%esp
+  80163d:	6a 00                	push   $0x0
+  80163f:	ff 75 f4             	push   -0xc(%ebp)
+  801642:	e8 58 f9 ff ff       	call   800f9f <fd_close>
+    return r;
+  801647:	83 c4 10             	add    $0x10,%esp
+  80164a:	eb e5                	jmp    801631 <open+0x6c>
+    return -E_BAD_PATH;
+  80164c:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801651:	eb de                	jmp    801631 <open+0x6c>
+
+00801653 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  801653:	55                   	push   %ebp
+  801654:	89 e5                	mov    %esp,%ebp
+  801656:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801659:	ba 00 00 00 00       	mov    $0x0,%edx
+  80165e:	b8 08 00 00 00       	mov    $0x8,%eax
+  801663:	e8 a6 fd ff ff       	call   80140e <fsipc>
+}
+  801668:	c9                   	leave
+  801669:	c3                   	ret
+
+0080166a <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80166a:	55                   	push   %ebp
+  80166b:	89 e5                	mov    %esp,%ebp
+  80166d:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801670:	68 4f 2a 80 00       	push   $0x802a4f
+  801675:	ff 75 0c             	push   0xc(%ebp)
+  801678:	e8 b4 f0 ff ff       	call   800731 <strcpy>
+	return 0;
+}
+  80167d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801682:	c9                   	leave
+  801683:	c3                   	ret
+
+00801684 <devsock_close>:
+{
+  801684:	55                   	push   %ebp
+  801685:	89 e5                	mov    %esp,%ebp
+  801687:	53                   	push   %ebx
+  801688:	83 ec 10             	sub    $0x10,%esp
+  80168b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  80168e:	53                   	push   %ebx
+  80168f:	e8 49 0a 00 00       	call   8020dd <pageref>
+  801694:	89 c2                	mov    %eax,%edx
+  801696:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801699:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  80169e:	83 fa 01             	cmp    $0x1,%edx
+  8016a1:	74 05                	je     8016a8 <devsock_close+0x24>
+}
+  8016a3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016a6:	c9                   	leave
+  8016a7:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8016a8:	83 ec 0c             	sub    $0xc,%esp
+  8016ab:	ff 73 0c             	push   0xc(%ebx)
+  8016ae:	e8 b7 02 00 00       	call   80196a <nsipc_close>
+  8016b3:	83 c4 10             	add    $0x10,%esp
+  8016b6:	eb eb                	jmp    8016a3 <devsock_close+0x1f>
+
+008016b8 <devsock_write>:
+{
+  8016b8:	55                   	push   %ebp
+  8016b9:	89 e5                	mov    %esp,%ebp
+  8016bb:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8016be:	6a 00                	push   $0x0
+  8016c0:	ff 75 10             	push   0x10(%ebp)
+  8016c3:	ff 75 0c             	push   0xc(%ebp)
+  8016c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016c9:	ff 70 0c             	push   0xc(%eax)
+  8016cc:	e8 79 03 00 00       	call   801a4a <nsipc_send>
+}
+  8016d1:	c9                   	leave
+  8016d2:	c3                   	ret
+
+008016d3 <devsock_read>:
+{
+  8016d3:	55                   	push   %ebp
+  8016d4:	89 e5                	mov    %esp,%ebp
+  8016d6:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8016d9:	6a 00                	push   $0x0
+  8016db:	ff 75 10             	push   0x10(%ebp)
+  8016de:	ff 75 0c             	push   0xc(%ebp)
+  8016e1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016e4:	ff 70 0c             	push   0xc(%eax)
+  8016e7:	e8 ef 02 00 00       	call   8019db <nsipc_recv>
+}
+  8016ec:	c9                   	leave
+  8016ed:	c3                   	ret
+
+008016ee <fd2sockid>:
+{
+  8016ee:	55                   	push   %ebp
+  8016ef:	89 e5                	mov    %esp,%ebp
+  8016f1:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8016f4:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8016f7:	52                   	push   %edx
+  8016f8:	50                   	push   %eax
+  8016f9:	e8 fe f7 ff ff       	call   800efc <fd_lookup>
+  8016fe:	83 c4 10             	add    $0x10,%esp
+  801701:	85 c0                	test   %eax,%eax
+  801703:	78 10                	js     801715 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801705:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801708:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  80170e:	39 08                	cmp    %ecx,(%eax)
+  801710:	75 05                	jne    801717 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801712:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801715:	c9                   	leave
+  801716:	c3                   	ret
+		return -E_NOT_SUPP;
+  801717:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80171c:	eb f7                	jmp    801715 <fd2sockid+0x27>
+
+0080171e <alloc_sockfd>:
+{
+  80171e:	55                   	push   %ebp
+  80171f:	89 e5                	mov    %esp,%ebp
+  801721:	56                   	push   %esi
+  801722:	53                   	push   %ebx
+  801723:	83 ec 1c             	sub    $0x1c,%esp
+  801726:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801728:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80172b:	50                   	push   %eax
+  80172c:	e8 75 f7 ff ff       	call   800ea6 <fd_alloc>
+  801731:	89 c3                	mov    %eax,%ebx
+  801733:	83 c4 10             	add    $0x10,%esp
+  801736:	85 c0                	test   %eax,%eax
+  801738:	78 43                	js     80177d <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80173a:	83 ec 04             	sub    $0x4,%esp
+  80173d:	68 07 04 00 00       	push   $0x407
+  801742:	ff 75 f4             	push   -0xc(%ebp)
+  801745:	6a 00                	push   $0x0
+  801747:	e8 d1 f3 ff ff       	call   800b1d <sys_page_alloc>
+  80174c:	89 c3                	mov    %eax,%ebx
+  80174e:	83 c4 10             	add    $0x10,%esp
+  801751:	85 c0                	test   %eax,%eax
+  801753:	78 28                	js     80177d <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801755:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801758:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  80175e:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801760:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801763:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  80176a:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  80176d:	83 ec 0c             	sub    $0xc,%esp
+  801770:	50                   	push   %eax
+  801771:	e8 09 f7 ff ff       	call   800e7f <fd2num>
+  801776:	89 c3                	mov    %eax,%ebx
+  801778:	83 c4 10             	add    $0x10,%esp
+  80177b:	eb 0c                	jmp    801789 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  80177d:	83 ec 0c             	sub    $0xc,%esp
+  801780:	56                   	push   %esi
+  801781:	e8 e4 01 00 00       	call   80196a <nsipc_close>
+		return r;
+  801786:	83 c4 10             	add    $0x10,%esp
+}
+  801789:	89 d8                	mov    %ebx,%eax
+  80178b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80178e:	5b                   	pop    %ebx
+  80178f:	5e                   	pop    %esi
+  801790:	5d                   	pop    %ebp
+  801791:	c3                   	ret
+
+00801792 <accept>:
+{
+  801792:	55                   	push   %ebp
+  801793:	89 e5                	mov    %esp,%ebp
+  801795:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801798:	8b 45 08             	mov    0x8(%ebp),%eax
+  80179b:	e8 4e ff ff ff       	call   8016ee <fd2sockid>
+  8017a0:	85 c0                	test   %eax,%eax
+  8017a2:	78 1b                	js     8017bf <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8017a4:	83 ec 04             	sub    $0x4,%esp
+  8017a7:	ff 75 10             	push   0x10(%ebp)
+  8017aa:	ff 75 0c             	push   0xc(%ebp)
+  8017ad:	50                   	push   %eax
+  8017ae:	e8 0e 01 00 00       	call   8018c1 <nsipc_accept>
+  8017b3:	83 c4 10             	add    $0x10,%esp
+  8017b6:	85 c0                	test   %eax,%eax
+  8017b8:	78 05                	js     8017bf <accept+0x2d>
+	return alloc_sockfd(r);
+  8017ba:	e8 5f ff ff ff       	call   80171e <alloc_sockfd>
+}
+  8017bf:	c9                   	leave
+  8017c0:	c3                   	ret
+
+008017c1 <bind>:
+{
+  8017c1:	55                   	push   %ebp
+  8017c2:	89 e5                	mov    %esp,%ebp
+  8017c4:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8017c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017ca:	e8 1f ff ff ff       	call   8016ee <fd2sockid>
+  8017cf:	85 c0                	test   %eax,%eax
+  8017d1:	78 12                	js     8017e5 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8017d3:	83 ec 04             	sub    $0x4,%esp
+  8017d6:	ff 75 10             	push   0x10(%ebp)
+  8017d9:	ff 75 0c             	push   0xc(%ebp)
+  8017dc:	50                   	push   %eax
+  8017dd:	e8 31 01 00 00       	call   801913 <nsipc_bind>
+  8017e2:	83 c4 10             	add    $0x10,%esp
+}
+  8017e5:	c9                   	leave
+  8017e6:	c3                   	ret
+
+008017e7 <shutdown>:
+{
+  8017e7:	55                   	push   %ebp
+  8017e8:	89 e5                	mov    %esp,%ebp
+  8017ea:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8017ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017f0:	e8 f9 fe ff ff       	call   8016ee <fd2sockid>
+  8017f5:	85 c0                	test   %eax,%eax
+  8017f7:	78 0f                	js     801808 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8017f9:	83 ec 08             	sub    $0x8,%esp
+  8017fc:	ff 75 0c             	push   0xc(%ebp)
+  8017ff:	50                   	push   %eax
+  801800:	e8 43 01 00 00       	call   801948 <nsipc_shutdown>
+  801805:	83 c4 10             	add    $0x10,%esp
+}
+  801808:	c9                   	leave
+  801809:	c3                   	ret
+
+0080180a <connect>:
+{
+  80180a:	55                   	push   %ebp
+  80180b:	89 e5                	mov    %esp,%ebp
+  80180d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801810:	8b 45 08             	mov    0x8(%ebp),%eax
+  801813:	e8 d6 fe ff ff       	call   8016ee <fd2sockid>
+  801818:	85 c0                	test   %eax,%eax
+  80181a:	78 12                	js     80182e <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  80181c:	83 ec 04             	sub    $0x4,%esp
+  80181f:	ff 75 10             	push   0x10(%ebp)
+  801822:	ff 75 0c             	push   0xc(%ebp)
+  801825:	50                   	push   %eax
+  801826:	e8 59 01 00 00       	call   801984 <nsipc_connect>
+  80182b:	83 c4 10             	add    $0x10,%esp
+}
+  80182e:	c9                   	leave
+  80182f:	c3                   	ret
+
+00801830 <listen>:
+{
+  801830:	55                   	push   %ebp
+  801831:	89 e5                	mov    %esp,%ebp
+  801833:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801836:	8b 45 08             	mov    0x8(%ebp),%eax
+  801839:	e8 b0 fe ff ff       	call   8016ee <fd2sockid>
+  80183e:	85 c0                	test   %eax,%eax
+  801840:	78 0f                	js     801851 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801842:	83 ec 08             	sub    $0x8,%esp
+  801845:	ff 75 0c             	push   0xc(%ebp)
+  801848:	50                   	push   %eax
+  801849:	e8 6b 01 00 00       	call   8019b9 <nsipc_listen>
+  80184e:	83 c4 10             	add    $0x10,%esp
+}
+  801851:	c9                   	leave
+  801852:	c3                   	ret
+
+00801853 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801853:	55                   	push   %ebp
+  801854:	89 e5                	mov    %esp,%ebp
+  801856:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801859:	ff 75 10             	push   0x10(%ebp)
+  80185c:	ff 75 0c             	push   0xc(%ebp)
+  80185f:	ff 75 08             	push   0x8(%ebp)
+  801862:	e8 41 02 00 00       	call   801aa8 <nsipc_socket>
+  801867:	83 c4 10             	add    $0x10,%esp
+  80186a:	85 c0                	test   %eax,%eax
+  80186c:	78 05                	js     801873 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  80186e:	e8 ab fe ff ff       	call   80171e <alloc_sockfd>
+}
+  801873:	c9                   	leave
+  801874:	c3                   	ret
+
+00801875 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801875:	55                   	push   %ebp
+  801876:	89 e5                	mov    %esp,%ebp
+  801878:	53                   	push   %ebx
+  801879:	83 ec 04             	sub    $0x4,%esp
+  80187c:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  80187e:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801885:	74 26                	je     8018ad <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801887:	6a 07                	push   $0x7
+  801889:	68 00 60 80 00       	push   $0x806000
+  80188e:	53                   	push   %ebx
+  80188f:	ff 35 04 40 80 00    	push   0x804004
+  801895:	e8 b0 07 00 00       	call   80204a <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  80189a:	83 c4 0c             	add    $0xc,%esp
+  80189d:	6a 00                	push   $0x0
+  80189f:	6a 00                	push   $0x0
+  8018a1:	6a 00                	push   $0x0
+  8018a3:	e8 2e 07 00 00       	call   801fd6 <ipc_recv>
+}
+  8018a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018ab:	c9                   	leave
+  8018ac:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8018ad:	83 ec 0c             	sub    $0xc,%esp
+  8018b0:	6a 02                	push   $0x2
+  8018b2:	e8 e7 07 00 00       	call   80209e <ipc_find_env>
+  8018b7:	a3 04 40 80 00       	mov    %eax,0x804004
+  8018bc:	83 c4 10             	add    $0x10,%esp
+  8018bf:	eb c6                	jmp    801887 <nsipc+0x12>
+
+008018c1 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8018c1:	55                   	push   %ebp
+  8018c2:	89 e5                	mov    %esp,%ebp
+  8018c4:	56                   	push   %esi
+  8018c5:	53                   	push   %ebx
+  8018c6:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8018c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018cc:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  8018d1:	8b 06                	mov    (%esi),%eax
+  8018d3:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8018d8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8018dd:	e8 93 ff ff ff       	call   801875 <nsipc>
+  8018e2:	89 c3                	mov    %eax,%ebx
+  8018e4:	85 c0                	test   %eax,%eax
+  8018e6:	79 09                	jns    8018f1 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8018e8:	89 d8                	mov    %ebx,%eax
+  8018ea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018ed:	5b                   	pop    %ebx
+  8018ee:	5e                   	pop    %esi
+  8018ef:	5d                   	pop    %ebp
+  8018f0:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8018f1:	83 ec 04             	sub    $0x4,%esp
+  8018f4:	ff 35 10 60 80 00    	push   0x806010
+  8018fa:	68 00 60 80 00       	push   $0x806000
+  8018ff:	ff 75 0c             	push   0xc(%ebp)
+  801902:	e8 b0 ef ff ff       	call   8008b7 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801907:	a1 10 60 80 00       	mov    0x806010,%eax
+  80190c:	89 06                	mov    %eax,(%esi)
+  80190e:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801911:	eb d5                	jmp    8018e8 <nsipc_accept+0x27>
+
+00801913 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801913:	55                   	push   %ebp
+  801914:	89 e5                	mov    %esp,%ebp
+  801916:	53                   	push   %ebx
+  801917:	83 ec 08             	sub    $0x8,%esp
+  80191a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  80191d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801920:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801925:	53                   	push   %ebx
+  801926:	ff 75 0c             	push   0xc(%ebp)
+  801929:	68 04 60 80 00       	push   $0x806004
+  80192e:	e8 84 ef ff ff       	call   8008b7 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801933:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  801939:	b8 02 00 00 00       	mov    $0x2,%eax
+  80193e:	e8 32 ff ff ff       	call   801875 <nsipc>
+}
+  801943:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801946:	c9                   	leave
+  801947:	c3                   	ret
+
+00801948 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801948:	55                   	push   %ebp
+  801949:	89 e5                	mov    %esp,%ebp
+  80194b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  80194e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801951:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  801956:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801959:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  80195e:	b8 03 00 00 00       	mov    $0x3,%eax
+  801963:	e8 0d ff ff ff       	call   801875 <nsipc>
+}
+  801968:	c9                   	leave
+  801969:	c3                   	ret
+
+0080196a <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  80196a:	55                   	push   %ebp
+  80196b:	89 e5                	mov    %esp,%ebp
+  80196d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801970:	8b 45 08             	mov    0x8(%ebp),%eax
+  801973:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  801978:	b8 04 00 00 00       	mov    $0x4,%eax
+  80197d:	e8 f3 fe ff ff       	call   801875 <nsipc>
+}
+  801982:	c9                   	leave
+  801983:	c3                   	ret
+
+00801984 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801984:	55                   	push   %ebp
+  801985:	89 e5                	mov    %esp,%ebp
+  801987:	53                   	push   %ebx
+  801988:	83 ec 08             	sub    $0x8,%esp
+  80198b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  80198e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801991:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801996:	53                   	push   %ebx
+  801997:	ff 75 0c             	push   0xc(%ebp)
+  80199a:	68 04 60 80 00       	push   $0x806004
+  80199f:	e8 13 ef ff ff       	call   8008b7 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8019a4:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  8019aa:	b8 05 00 00 00       	mov    $0x5,%eax
+  8019af:	e8 c1 fe ff ff       	call   801875 <nsipc>
+}
+  8019b4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019b7:	c9                   	leave
+  8019b8:	c3                   	ret
+
+008019b9 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8019b9:	55                   	push   %ebp
+  8019ba:	89 e5                	mov    %esp,%ebp
+  8019bc:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8019bf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019c2:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  8019c7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019ca:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  8019cf:	b8 06 00 00 00       	mov    $0x6,%eax
+  8019d4:	e8 9c fe ff ff       	call   801875 <nsipc>
+}
+  8019d9:	c9                   	leave
+  8019da:	c3                   	ret
+
+008019db <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8019db:	55                   	push   %ebp
+  8019dc:	89 e5                	mov    %esp,%ebp
+  8019de:	56                   	push   %esi
+  8019df:	53                   	push   %ebx
+  8019e0:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8019e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019e6:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  8019eb:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  8019f1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019f4:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8019f9:	b8 07 00 00 00       	mov    $0x7,%eax
+  8019fe:	e8 72 fe ff ff       	call   801875 <nsipc>
+  801a03:	89 c3                	mov    %eax,%ebx
+  801a05:	85 c0                	test   %eax,%eax
+  801a07:	78 22                	js     801a2b <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801a09:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801a0e:	39 c6                	cmp    %eax,%esi
+  801a10:	0f 4e c6             	cmovle %esi,%eax
+  801a13:	39 c3                	cmp    %eax,%ebx
+  801a15:	7f 1d                	jg     801a34 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801a17:	83 ec 04             	sub    $0x4,%esp
+  801a1a:	53                   	push   %ebx
+  801a1b:	68 00 60 80 00       	push   $0x806000
+  801a20:	ff 75 0c             	push   0xc(%ebp)
+  801a23:	e8 8f ee ff ff       	call   8008b7 <memmove>
+  801a28:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801a2b:	89 d8                	mov    %ebx,%eax
+  801a2d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a30:	5b                   	pop    %ebx
+  801a31:	5e                   	pop    %esi
+  801a32:	5d                   	pop    %ebp
+  801a33:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801a34:	68 5b 2a 80 00       	push   $0x802a5b
+  801a39:	68 23 2a 80 00       	push   $0x802a23
+  801a3e:	6a 62                	push   $0x62
+  801a40:	68 70 2a 80 00       	push   $0x802a70
+  801a45:	e8 46 05 00 00       	call   801f90 <_panic>
+
+00801a4a <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801a4a:	55                   	push   %ebp
+  801a4b:	89 e5                	mov    %esp,%ebp
+  801a4d:	53                   	push   %ebx
+  801a4e:	83 ec 04             	sub    $0x4,%esp
+  801a51:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801a54:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a57:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  801a5c:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801a62:	7f 2e                	jg     801a92 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801a64:	83 ec 04             	sub    $0x4,%esp
+  801a67:	53                   	push   %ebx
+  801a68:	ff 75 0c             	push   0xc(%ebp)
+  801a6b:	68 0c 60 80 00       	push   $0x80600c
+  801a70:	e8 42 ee ff ff       	call   8008b7 <memmove>
+	nsipcbuf.send.req_size = size;
+  801a75:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  801a7b:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a7e:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  801a83:	b8 08 00 00 00       	mov    $0x8,%eax
+  801a88:	e8 e8 fd ff ff       	call   801875 <nsipc>
+}
+  801a8d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a90:	c9                   	leave
+  801a91:	c3                   	ret
+	assert(size < 1600);
+  801a92:	68 7c 2a 80 00       	push   $0x802a7c
+  801a97:	68 23 2a 80 00       	push   $0x802a23
+  801a9c:	6a 6d                	push   $0x6d
+  801a9e:	68 70 2a 80 00       	push   $0x802a70
+  801aa3:	e8 e8 04 00 00       	call   801f90 <_panic>
+
+00801aa8 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801aa8:	55                   	push   %ebp
+  801aa9:	89 e5                	mov    %esp,%ebp
+  801aab:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801aae:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ab1:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  801ab6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ab9:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  801abe:	8b 45 10             	mov    0x10(%ebp),%eax
+  801ac1:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  801ac6:	b8 09 00 00 00       	mov    $0x9,%eax
+  801acb:	e8 a5 fd ff ff       	call   801875 <nsipc>
+}
+  801ad0:	c9                   	leave
+  801ad1:	c3                   	ret
+
+00801ad2 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801ad2:	55                   	push   %ebp
+  801ad3:	89 e5                	mov    %esp,%ebp
+  801ad5:	56                   	push   %esi
+  801ad6:	53                   	push   %ebx
+  801ad7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801ada:	83 ec 0c             	sub    $0xc,%esp
+  801add:	ff 75 08             	push   0x8(%ebp)
+  801ae0:	e8 aa f3 ff ff       	call   800e8f <fd2data>
+  801ae5:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801ae7:	83 c4 08             	add    $0x8,%esp
+  801aea:	68 88 2a 80 00       	push   $0x802a88
+  801aef:	53                   	push   %ebx
+  801af0:	e8 3c ec ff ff       	call   800731 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801af5:	8b 46 04             	mov    0x4(%esi),%eax
+  801af8:	2b 06                	sub    (%esi),%eax
+  801afa:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  801b00:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801b07:	00 00 00 
+	stat->st_dev = &devpipe;
+  801b0a:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  801b11:	30 80 00 
+	return 0;
+}
+  801b14:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b19:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b1c:	5b                   	pop    %ebx
+  801b1d:	5e                   	pop    %esi
+  801b1e:	5d                   	pop    %ebp
+  801b1f:	c3                   	ret
+
+00801b20 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801b20:	55                   	push   %ebp
+  801b21:	89 e5                	mov    %esp,%ebp
+  801b23:	53                   	push   %ebx
+  801b24:	83 ec 0c             	sub    $0xc,%esp
+  801b27:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801b2a:	53                   	push   %ebx
+  801b2b:	6a 00                	push   $0x0
+  801b2d:	e8 70 f0 ff ff       	call   800ba2 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801b32:	89 1c 24             	mov    %ebx,(%esp)
+  801b35:	e8 55 f3 ff ff       	call   800e8f <fd2data>
+  801b3a:	83 c4 08             	add    $0x8,%esp
+  801b3d:	50                   	push   %eax
+  801b3e:	6a 00                	push   $0x0
+  801b40:	e8 5d f0 ff ff       	call   800ba2 <sys_page_unmap>
+}
+  801b45:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b48:	c9                   	leave
+  801b49:	c3                   	ret
+
+00801b4a <_pipeisclosed>:
+{
+  801b4a:	55                   	push   %ebp
+  801b4b:	89 e5                	mov    %esp,%ebp
+  801b4d:	57                   	push   %edi
+  801b4e:	56                   	push   %esi
+  801b4f:	53                   	push   %ebx
+  801b50:	83 ec 1c             	sub    $0x1c,%esp
+  801b53:	89 c7                	mov    %eax,%edi
+  801b55:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801b57:	a1 08 40 80 00       	mov    0x804008,%eax
+  801b5c:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801b5f:	83 ec 0c             	sub    $0xc,%esp
+  801b62:	57                   	push   %edi
+  801b63:	e8 75 05 00 00       	call   8020dd <pageref>
+  801b68:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801b6b:	89 34 24             	mov    %esi,(%esp)
+  801b6e:	e8 6a 05 00 00       	call   8020dd <pageref>
+		nn = thisenv->env_runs;
+  801b73:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801b79:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801b7c:	83 c4 10             	add    $0x10,%esp
+  801b7f:	39 cb                	cmp    %ecx,%ebx
+  801b81:	74 1b                	je     801b9e <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801b83:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801b86:	75 cf                	jne    801b57 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801b88:	8b 42 58             	mov    0x58(%edx),%eax
+  801b8b:	6a 01                	push   $0x1
+  801b8d:	50                   	push   %eax
+  801b8e:	53                   	push   %ebx
+  801b8f:	68 8f 2a 80 00       	push   $0x802a8f
+  801b94:	e8 df e5 ff ff       	call   800178 <cprintf>
+  801b99:	83 c4 10             	add    $0x10,%esp
+  801b9c:	eb b9                	jmp    801b57 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801b9e:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801ba1:	0f 94 c0             	sete   %al
+  801ba4:	0f b6 c0             	movzbl %al,%eax
+}
+  801ba7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801baa:	5b                   	pop    %ebx
+  801bab:	5e                   	pop    %esi
+  801bac:	5f                   	pop    %edi
+  801bad:	5d                   	pop    %ebp
+  801bae:	c3                   	ret
+
+00801baf <devpipe_write>:
+{
+  801baf:	55                   	push   %ebp
+  801bb0:	89 e5                	mov    %esp,%ebp
+  801bb2:	57                   	push   %edi
+  801bb3:	56                   	push   %esi
+  801bb4:	53                   	push   %ebx
+  801bb5:	83 ec 28             	sub    $0x28,%esp
+  801bb8:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801bbb:	56                   	push   %esi
+  801bbc:	e8 ce f2 ff ff       	call   800e8f <fd2data>
+  801bc1:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801bc3:	83 c4 10             	add    $0x10,%esp
+  801bc6:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bcb:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801bce:	75 09                	jne    801bd9 <devpipe_write+0x2a>
+	return i;
+  801bd0:	89 f8                	mov    %edi,%eax
+  801bd2:	eb 23                	jmp    801bf7 <devpipe_write+0x48>
+			sys_yield();
+  801bd4:	e8 25 ef ff ff       	call   800afe <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801bd9:	8b 43 04             	mov    0x4(%ebx),%eax
+  801bdc:	8b 0b                	mov    (%ebx),%ecx
+  801bde:	8d 51 20             	lea    0x20(%ecx),%edx
+  801be1:	39 d0                	cmp    %edx,%eax
+  801be3:	72 1a                	jb     801bff <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  801be5:	89 da                	mov    %ebx,%edx
+  801be7:	89 f0                	mov    %esi,%eax
+  801be9:	e8 5c ff ff ff       	call   801b4a <_pipeisclosed>
+  801bee:	85 c0                	test   %eax,%eax
+  801bf0:	74 e2                	je     801bd4 <devpipe_write+0x25>
+				return 0;
+  801bf2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801bf7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bfa:	5b                   	pop    %ebx
+  801bfb:	5e                   	pop    %esi
+  801bfc:	5f                   	pop    %edi
+  801bfd:	5d                   	pop    %ebp
+  801bfe:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801bff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c02:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801c06:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801c09:	89 c2                	mov    %eax,%edx
+  801c0b:	c1 fa 1f             	sar    $0x1f,%edx
+  801c0e:	89 d1                	mov    %edx,%ecx
+  801c10:	c1 e9 1b             	shr    $0x1b,%ecx
+  801c13:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801c16:	83 e2 1f             	and    $0x1f,%edx
+  801c19:	29 ca                	sub    %ecx,%edx
+  801c1b:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801c1f:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  801c23:	83 c0 01             	add    $0x1,%eax
+  801c26:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  801c29:	83 c7 01             	add    $0x1,%edi
+  801c2c:	eb 9d                	jmp    801bcb <devpipe_write+0x1c>
+
+00801c2e <devpipe_read>:
+{
+  801c2e:	55                   	push   %ebp
+  801c2f:	89 e5                	mov    %esp,%ebp
+  801c31:	57                   	push   %edi
+  801c32:	56                   	push   %esi
+  801c33:	53                   	push   %ebx
+  801c34:	83 ec 18             	sub    $0x18,%esp
+  801c37:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  801c3a:	57                   	push   %edi
+  801c3b:	e8 4f f2 ff ff       	call   800e8f <fd2data>
+  801c40:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801c42:	83 c4 10             	add    $0x10,%esp
+  801c45:	be 00 00 00 00       	mov    $0x0,%esi
+  801c4a:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801c4d:	75 13                	jne    801c62 <devpipe_read+0x34>
+	return i;
+  801c4f:	89 f0                	mov    %esi,%eax
+  801c51:	eb 02                	jmp    801c55 <devpipe_read+0x27>
+				return i;
+  801c53:	89 f0                	mov    %esi,%eax
+}
+  801c55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c58:	5b                   	pop    %ebx
+  801c59:	5e                   	pop    %esi
+  801c5a:	5f                   	pop    %edi
+  801c5b:	5d                   	pop    %ebp
+  801c5c:	c3                   	ret
+			sys_yield();
+  801c5d:	e8 9c ee ff ff       	call   800afe <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  801c62:	8b 03                	mov    (%ebx),%eax
+  801c64:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801c67:	75 18                	jne    801c81 <devpipe_read+0x53>
+			if (i > 0)
+  801c69:	85 f6                	test   %esi,%esi
+  801c6b:	75 e6                	jne    801c53 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  801c6d:	89 da                	mov    %ebx,%edx
+  801c6f:	89 f8                	mov    %edi,%eax
+  801c71:	e8 d4 fe ff ff       	call   801b4a <_pipeisclosed>
+  801c76:	85 c0                	test   %eax,%eax
+  801c78:	74 e3                	je     801c5d <devpipe_read+0x2f>
+				return 0;
+  801c7a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c7f:	eb d4                	jmp    801c55 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801c81:	99                   	cltd
+  801c82:	c1 ea 1b             	shr    $0x1b,%edx
+  801c85:	01 d0                	add    %edx,%eax
+  801c87:	83 e0 1f             	and    $0x1f,%eax
+  801c8a:	29 d0                	sub    %edx,%eax
+  801c8c:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801c91:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c94:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  801c97:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  801c9a:	83 c6 01             	add    $0x1,%esi
+  801c9d:	eb ab                	jmp    801c4a <devpipe_read+0x1c>
+
+00801c9f <pipe>:
+{
+  801c9f:	55                   	push   %ebp
+  801ca0:	89 e5                	mov    %esp,%ebp
+  801ca2:	56                   	push   %esi
+  801ca3:	53                   	push   %ebx
+  801ca4:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801ca7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801caa:	50                   	push   %eax
+  801cab:	e8 f6 f1 ff ff       	call   800ea6 <fd_alloc>
+  801cb0:	89 c3                	mov    %eax,%ebx
+  801cb2:	83 c4 10             	add    $0x10,%esp
+  801cb5:	85 c0                	test   %eax,%eax
+  801cb7:	0f 88 23 01 00 00    	js     801de0 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801cbd:	83 ec 04             	sub    $0x4,%esp
+  801cc0:	68 07 04 00 00       	push   $0x407
+  801cc5:	ff 75 f4             	push   -0xc(%ebp)
+  801cc8:	6a 00                	push   $0x0
+  801cca:	e8 4e ee ff ff       	call   800b1d <sys_page_alloc>
+  801ccf:	89 c3                	mov    %eax,%ebx
+  801cd1:	83 c4 10             	add    $0x10,%esp
+  801cd4:	85 c0                	test   %eax,%eax
+  801cd6:	0f 88 04 01 00 00    	js     801de0 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801cdc:	83 ec 0c             	sub    $0xc,%esp
+  801cdf:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ce2:	50                   	push   %eax
+  801ce3:	e8 be f1 ff ff       	call   800ea6 <fd_alloc>
+  801ce8:	89 c3                	mov    %eax,%ebx
+  801cea:	83 c4 10             	add    $0x10,%esp
+  801ced:	85 c0                	test   %eax,%eax
+  801cef:	0f 88 db 00 00 00    	js     801dd0 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801cf5:	83 ec 04             	sub    $0x4,%esp
+  801cf8:	68 07 04 00 00       	push   $0x407
+  801cfd:	ff 75 f0             	push   -0x10(%ebp)
+  801d00:	6a 00                	push   $0x0
+  801d02:	e8 16 ee ff ff       	call   800b1d <sys_page_alloc>
+  801d07:	89 c3                	mov    %eax,%ebx
+  801d09:	83 c4 10             	add    $0x10,%esp
+  801d0c:	85 c0                	test   %eax,%eax
+  801d0e:	0f 88 bc 00 00 00    	js     801dd0 <pipe+0x131>
+	va = fd2data(fd0);
+  801d14:	83 ec 0c             	sub    $0xc,%esp
+  801d17:	ff 75 f4             	push   -0xc(%ebp)
+  801d1a:	e8 70 f1 ff ff       	call   800e8f <fd2data>
+  801d1f:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801d21:	83 c4 0c             	add    $0xc,%esp
+  801d24:	68 07 04 00 00       	push   $0x407
+  801d29:	50                   	push   %eax
+  801d2a:	6a 00                	push   $0x0
+  801d2c:	e8 ec ed ff ff       	call   800b1d <sys_page_alloc>
+  801d31:	89 c3                	mov    %eax,%ebx
+  801d33:	83 c4 10             	add    $0x10,%esp
+  801d36:	85 c0                	test   %eax,%eax
+  801d38:	0f 88 82 00 00 00    	js     801dc0 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801d3e:	83 ec 0c             	sub    $0xc,%esp
+  801d41:	ff 75 f0             	push   -0x10(%ebp)
+  801d44:	e8 46 f1 ff ff       	call   800e8f <fd2data>
+  801d49:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801d50:	50                   	push   %eax
+  801d51:	6a 00                	push   $0x0
+  801d53:	56                   	push   %esi
+  801d54:	6a 00                	push   $0x0
+  801d56:	e8 05 ee ff ff       	call   800b60 <sys_page_map>
+  801d5b:	89 c3                	mov    %eax,%ebx
+  801d5d:	83 c4 20             	add    $0x20,%esp
+  801d60:	85 c0                	test   %eax,%eax
+  801d62:	78 4e                	js     801db2 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  801d64:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  801d69:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801d6c:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  801d6e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801d71:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  801d78:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801d7b:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  801d7d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801d80:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  801d87:	83 ec 0c             	sub    $0xc,%esp
+  801d8a:	ff 75 f4             	push   -0xc(%ebp)
+  801d8d:	e8 ed f0 ff ff       	call   800e7f <fd2num>
+  801d92:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801d95:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  801d97:	83 c4 04             	add    $0x4,%esp
+  801d9a:	ff 75 f0             	push   -0x10(%ebp)
+  801d9d:	e8 dd f0 ff ff       	call   800e7f <fd2num>
+  801da2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801da5:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  801da8:	83 c4 10             	add    $0x10,%esp
+  801dab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801db0:	eb 2e                	jmp    801de0 <pipe+0x141>
+	sys_page_unmap(0, va);
+  801db2:	83 ec 08             	sub    $0x8,%esp
+  801db5:	56                   	push   %esi
+  801db6:	6a 00                	push   $0x0
+  801db8:	e8 e5 ed ff ff       	call   800ba2 <sys_page_unmap>
+  801dbd:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  801dc0:	83 ec 08             	sub    $0x8,%esp
+  801dc3:	ff 75 f0             	push   -0x10(%ebp)
+  801dc6:	6a 00                	push   $0x0
+  801dc8:	e8 d5 ed ff ff       	call   800ba2 <sys_page_unmap>
+  801dcd:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  801dd0:	83 ec 08             	sub    $0x8,%esp
+  801dd3:	ff 75 f4             	push   -0xc(%ebp)
+  801dd6:	6a 00                	push   $0x0
+  801dd8:	e8 c5 ed ff ff       	call   800ba2 <sys_page_unmap>
+  801ddd:	83 c4 10             	add    $0x10,%esp
+}
+  801de0:	89 d8                	mov    %ebx,%eax
+  801de2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801de5:	5b                   	pop    %ebx
+  801de6:	5e                   	pop    %esi
+  801de7:	5d                   	pop    %ebp
+  801de8:	c3                   	ret
+
+00801de9 <pipeisclosed>:
+{
+  801de9:	55                   	push   %ebp
+  801dea:	89 e5                	mov    %esp,%ebp
+  801dec:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801def:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801df2:	50                   	push   %eax
+  801df3:	ff 75 08             	push   0x8(%ebp)
+  801df6:	e8 01 f1 ff ff       	call   800efc <fd_lookup>
+  801dfb:	83 c4 10             	add    $0x10,%esp
+  801dfe:	85 c0                	test   %eax,%eax
+  801e00:	78 18                	js     801e1a <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  801e02:	83 ec 0c             	sub    $0xc,%esp
+  801e05:	ff 75 f4             	push   -0xc(%ebp)
+  801e08:	e8 82 f0 ff ff       	call   800e8f <fd2data>
+  801e0d:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  801e0f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e12:	e8 33 fd ff ff       	call   801b4a <_pipeisclosed>
+  801e17:	83 c4 10             	add    $0x10,%esp
+}
+  801e1a:	c9                   	leave
+  801e1b:	c3                   	ret
+
+00801e1c <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  801e1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e21:	c3                   	ret
+
+00801e22 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  801e22:	55                   	push   %ebp
+  801e23:	89 e5                	mov    %esp,%ebp
+  801e25:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  801e28:	68 a7 2a 80 00       	push   $0x802aa7
+  801e2d:	ff 75 0c             	push   0xc(%ebp)
+  801e30:	e8 fc e8 ff ff       	call   800731 <strcpy>
+	return 0;
+}
+  801e35:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e3a:	c9                   	leave
+  801e3b:	c3                   	ret
+
+00801e3c <devcons_write>:
+{
+  801e3c:	55                   	push   %ebp
+  801e3d:	89 e5                	mov    %esp,%ebp
+  801e3f:	57                   	push   %edi
+  801e40:	56                   	push   %esi
+  801e41:	53                   	push   %ebx
+  801e42:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  801e48:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  801e4d:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  801e53:	eb 2e                	jmp    801e83 <devcons_write+0x47>
+		m = n - tot;
+  801e55:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801e58:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  801e5a:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801e5f:	39 c3                	cmp    %eax,%ebx
+  801e61:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  801e64:	83 ec 04             	sub    $0x4,%esp
+  801e67:	53                   	push   %ebx
+  801e68:	89 f0                	mov    %esi,%eax
+  801e6a:	03 45 0c             	add    0xc(%ebp),%eax
+  801e6d:	50                   	push   %eax
+  801e6e:	57                   	push   %edi
+  801e6f:	e8 43 ea ff ff       	call   8008b7 <memmove>
+		sys_cputs(buf, m);
+  801e74:	83 c4 08             	add    $0x8,%esp
+  801e77:	53                   	push   %ebx
+  801e78:	57                   	push   %edi
+  801e79:	e8 e3 eb ff ff       	call   800a61 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  801e7e:	01 de                	add    %ebx,%esi
+  801e80:	83 c4 10             	add    $0x10,%esp
+  801e83:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801e86:	72 cd                	jb     801e55 <devcons_write+0x19>
+}
+  801e88:	89 f0                	mov    %esi,%eax
+  801e8a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e8d:	5b                   	pop    %ebx
+  801e8e:	5e                   	pop    %esi
+  801e8f:	5f                   	pop    %edi
+  801e90:	5d                   	pop    %ebp
+  801e91:	c3                   	ret
+
+00801e92 <devcons_read>:
+{
+  801e92:	55                   	push   %ebp
+  801e93:	89 e5                	mov    %esp,%ebp
+  801e95:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  801e98:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e9d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801ea1:	75 07                	jne    801eaa <devcons_read+0x18>
+  801ea3:	eb 1f                	jmp    801ec4 <devcons_read+0x32>
+		sys_yield();
+  801ea5:	e8 54 ec ff ff       	call   800afe <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  801eaa:	e8 d0 eb ff ff       	call   800a7f <sys_cgetc>
+  801eaf:	85 c0                	test   %eax,%eax
+  801eb1:	74 f2                	je     801ea5 <devcons_read+0x13>
+	if (c < 0)
+  801eb3:	78 0f                	js     801ec4 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  801eb5:	83 f8 04             	cmp    $0x4,%eax
+  801eb8:	74 0c                	je     801ec6 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  801eba:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ebd:	88 02                	mov    %al,(%edx)
+	return 1;
+  801ebf:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  801ec4:	c9                   	leave
+  801ec5:	c3                   	ret
+		return 0;
+  801ec6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ecb:	eb f7                	jmp    801ec4 <devcons_read+0x32>
+
+00801ecd <cputchar>:
+{
+  801ecd:	55                   	push   %ebp
+  801ece:	89 e5                	mov    %esp,%ebp
+  801ed0:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  801ed3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ed6:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  801ed9:	6a 01                	push   $0x1
+  801edb:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801ede:	50                   	push   %eax
+  801edf:	e8 7d eb ff ff       	call   800a61 <sys_cputs>
+}
+  801ee4:	83 c4 10             	add    $0x10,%esp
+  801ee7:	c9                   	leave
+  801ee8:	c3                   	ret
+
+00801ee9 <getchar>:
+{
+  801ee9:	55                   	push   %ebp
+  801eea:	89 e5                	mov    %esp,%ebp
+  801eec:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  801eef:	6a 01                	push   $0x1
+  801ef1:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801ef4:	50                   	push   %eax
+  801ef5:	6a 00                	push   $0x0
+  801ef7:	e8 66 f2 ff ff       	call   801162 <read>
+	if (r < 0)
+  801efc:	83 c4 10             	add    $0x10,%esp
+  801eff:	85 c0                	test   %eax,%eax
+  801f01:	78 06                	js     801f09 <getchar+0x20>
+	if (r < 1)
+  801f03:	74 06                	je     801f0b <getchar+0x22>
+	return c;
+  801f05:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  801f09:	c9                   	leave
+  801f0a:	c3                   	ret
+		return -E_EOF;
+  801f0b:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  801f10:	eb f7                	jmp    801f09 <getchar+0x20>
+
+00801f12 <iscons>:
+{
+  801f12:	55                   	push   %ebp
+  801f13:	89 e5                	mov    %esp,%ebp
+  801f15:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801f18:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f1b:	50                   	push   %eax
+  801f1c:	ff 75 08             	push   0x8(%ebp)
+  801f1f:	e8 d8 ef ff ff       	call   800efc <fd_lookup>
+  801f24:	83 c4 10             	add    $0x10,%esp
+  801f27:	85 c0                	test   %eax,%eax
+  801f29:	78 11                	js     801f3c <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  801f2b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f2e:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  801f34:	39 10                	cmp    %edx,(%eax)
+  801f36:	0f 94 c0             	sete   %al
+  801f39:	0f b6 c0             	movzbl %al,%eax
+}
+  801f3c:	c9                   	leave
+  801f3d:	c3                   	ret
+
+00801f3e <opencons>:
+{
+  801f3e:	55                   	push   %ebp
+  801f3f:	89 e5                	mov    %esp,%ebp
+  801f41:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  801f44:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f47:	50                   	push   %eax
+  801f48:	e8 59 ef ff ff       	call   800ea6 <fd_alloc>
+  801f4d:	83 c4 10             	add    $0x10,%esp
+  801f50:	85 c0                	test   %eax,%eax
+  801f52:	78 3a                	js     801f8e <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  801f54:	83 ec 04             	sub    $0x4,%esp
+  801f57:	68 07 04 00 00       	push   $0x407
+  801f5c:	ff 75 f4             	push   -0xc(%ebp)
+  801f5f:	6a 00                	push   $0x0
+  801f61:	e8 b7 eb ff ff       	call   800b1d <sys_page_alloc>
+  801f66:	83 c4 10             	add    $0x10,%esp
+  801f69:	85 c0                	test   %eax,%eax
+  801f6b:	78 21                	js     801f8e <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  801f6d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f70:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  801f76:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  801f78:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f7b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  801f82:	83 ec 0c             	sub    $0xc,%esp
+  801f85:	50                   	push   %eax
+  801f86:	e8 f4 ee ff ff       	call   800e7f <fd2num>
+  801f8b:	83 c4 10             	add    $0x10,%esp
+}
+  801f8e:	c9                   	leave
+  801f8f:	c3                   	ret
+
+00801f90 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  801f90:	55                   	push   %ebp
+  801f91:	89 e5                	mov    %esp,%ebp
+  801f93:	56                   	push   %esi
+  801f94:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  801f95:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  801f98:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  801f9e:	e8 3c eb ff ff       	call   800adf <sys_getenvid>
+  801fa3:	83 ec 0c             	sub    $0xc,%esp
+  801fa6:	ff 75 0c             	push   0xc(%ebp)
+  801fa9:	ff 75 08             	push   0x8(%ebp)
+  801fac:	56                   	push   %esi
+  801fad:	50                   	push   %eax
+  801fae:	68 b4 2a 80 00       	push   $0x802ab4
+  801fb3:	e8 c0 e1 ff ff       	call   800178 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  801fb8:	83 c4 18             	add    $0x18,%esp
+  801fbb:	53                   	push   %ebx
+  801fbc:	ff 75 10             	push   0x10(%ebp)
+  801fbf:	e8 63 e1 ff ff       	call   800127 <vcprintf>
+	cprintf("\n");
+  801fc4:	c7 04 24 a0 2a 80 00 	movl   $0x802aa0,(%esp)
+  801fcb:	e8 a8 e1 ff ff       	call   800178 <cprintf>
+  801fd0:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  801fd3:	cc                   	int3
+	while (1)
+  801fd4:	eb fd                	jmp    801fd3 <_panic+0x43>
+
+00801fd6 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  801fd6:	55                   	push   %ebp
+  801fd7:	89 e5                	mov    %esp,%ebp
+  801fd9:	56                   	push   %esi
+  801fda:	53                   	push   %ebx
+  801fdb:	8b 75 08             	mov    0x8(%ebp),%esi
+  801fde:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fe1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  801fe4:	85 c0                	test   %eax,%eax
+  801fe6:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801feb:	0f 44 c2             	cmove  %edx,%eax
+  801fee:	83 ec 0c             	sub    $0xc,%esp
+  801ff1:	50                   	push   %eax
+  801ff2:	e8 d6 ec ff ff       	call   800ccd <sys_ipc_recv>
+
+  if (from_env_store)
+  801ff7:	83 c4 10             	add    $0x10,%esp
+  801ffa:	85 f6                	test   %esi,%esi
+  801ffc:	74 17                	je     802015 <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  801ffe:	ba 00 00 00 00       	mov    $0x0,%edx
+  802003:	85 c0                	test   %eax,%eax
+  802005:	75 0c                	jne    802013 <ipc_recv+0x3d>
+  802007:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  80200d:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  802013:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  802015:	85 db                	test   %ebx,%ebx
+  802017:	74 2b                	je     802044 <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  802019:	85 c0                	test   %eax,%eax
+  80201b:	74 0d                	je     80202a <ipc_recv+0x54>
+  80201d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  802023:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802026:	5b                   	pop    %ebx
+  802027:	5e                   	pop    %esi
+  802028:	5d                   	pop    %ebp
+  802029:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  80202a:	a1 08 40 80 00       	mov    0x804008,%eax
+  80202f:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  802035:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  802037:	a1 08 40 80 00       	mov    0x804008,%eax
+  80203c:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  802042:	eb df                	jmp    802023 <ipc_recv+0x4d>
+  802044:	85 c0                	test   %eax,%eax
+  802046:	75 db                	jne    802023 <ipc_recv+0x4d>
+  802048:	eb ed                	jmp    802037 <ipc_recv+0x61>
+
+0080204a <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  80204a:	55                   	push   %ebp
+  80204b:	89 e5                	mov    %esp,%ebp
+  80204d:	57                   	push   %edi
+  80204e:	56                   	push   %esi
+  80204f:	53                   	push   %ebx
+  802050:	83 ec 0c             	sub    $0xc,%esp
+  802053:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802056:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802059:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  80205c:	85 db                	test   %ebx,%ebx
+  80205e:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802063:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  802066:	ff 75 14             	push   0x14(%ebp)
+  802069:	53                   	push   %ebx
+  80206a:	56                   	push   %esi
+  80206b:	57                   	push   %edi
+  80206c:	e8 39 ec ff ff       	call   800caa <sys_ipc_try_send>
+  802071:	83 c4 10             	add    $0x10,%esp
+  802074:	85 c0                	test   %eax,%eax
+  802076:	74 1e                	je     802096 <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  802078:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80207b:	75 07                	jne    802084 <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  80207d:	e8 7c ea ff ff       	call   800afe <sys_yield>
+  802082:	eb e2                	jmp    802066 <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  802084:	50                   	push   %eax
+  802085:	68 d7 2a 80 00       	push   $0x802ad7
+  80208a:	6a 3c                	push   $0x3c
+  80208c:	68 e4 2a 80 00       	push   $0x802ae4
+  802091:	e8 fa fe ff ff       	call   801f90 <_panic>
+  }
+
+#endif
+}
+  802096:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802099:	5b                   	pop    %ebx
+  80209a:	5e                   	pop    %esi
+  80209b:	5f                   	pop    %edi
+  80209c:	5d                   	pop    %ebp
+  80209d:	c3                   	ret
+
+0080209e <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  80209e:	55                   	push   %ebp
+  80209f:	89 e5                	mov    %esp,%ebp
+  8020a1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  8020a4:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  8020a9:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8020ac:	c1 e0 04             	shl    $0x4,%eax
+  8020af:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8020b4:	8b 40 50             	mov    0x50(%eax),%eax
+  8020b7:	39 c8                	cmp    %ecx,%eax
+  8020b9:	74 12                	je     8020cd <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  8020bb:	83 c2 01             	add    $0x1,%edx
+  8020be:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8020c4:	75 e3                	jne    8020a9 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  8020c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020cb:	eb 0e                	jmp    8020db <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  8020cd:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8020d0:	c1 e0 04             	shl    $0x4,%eax
+  8020d3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8020d8:	8b 40 48             	mov    0x48(%eax),%eax
+  8020db:	5d                   	pop    %ebp
+  8020dc:	c3                   	ret
+
+008020dd <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8020dd:	55                   	push   %ebp
+  8020de:	89 e5                	mov    %esp,%ebp
+  8020e0:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8020e3:	89 c2                	mov    %eax,%edx
+  8020e5:	c1 ea 16             	shr    $0x16,%edx
+  8020e8:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8020ef:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8020f4:	f6 c1 01             	test   $0x1,%cl
+  8020f7:	74 1c                	je     802115 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  8020f9:	c1 e8 0c             	shr    $0xc,%eax
+  8020fc:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802103:	a8 01                	test   $0x1,%al
+  802105:	74 0e                	je     802115 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802107:	c1 e8 0c             	shr    $0xc,%eax
+  80210a:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802111:	ef 
+  802112:	0f b7 d2             	movzwl %dx,%edx
+}
+  802115:	89 d0                	mov    %edx,%eax
+  802117:	5d                   	pop    %ebp
+  802118:	c3                   	ret
+  802119:	66 90                	xchg   %ax,%ax
+  80211b:	66 90                	xchg   %ax,%ax
+  80211d:	66 90                	xchg   %ax,%ax
+  80211f:	90                   	nop
+
+00802120 <__udivmoddi4>:
+  802120:	55                   	push   %ebp
+  802121:	57                   	push   %edi
+  802122:	56                   	push   %esi
+  802123:	53                   	push   %ebx
+  802124:	83 ec 24             	sub    $0x24,%esp
+  802127:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80212b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80212f:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  802133:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802137:	8b 54 24 44          	mov    0x44(%esp),%edx
+  80213b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80213f:	8b 44 24 40          	mov    0x40(%esp),%eax
+  802143:	89 d3                	mov    %edx,%ebx
+  802145:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802149:	09 c3                	or     %eax,%ebx
+  80214b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80214f:	0f 84 9c 00 00 00    	je     8021f1 <__udivmoddi4+0xd1>
+  802155:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80215c:	00 
+  80215d:	31 c0                	xor    %eax,%eax
+  80215f:	31 d2                	xor    %edx,%edx
+  802161:	89 fb                	mov    %edi,%ebx
+  802163:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80216a:	00 
+  80216b:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802170:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802174:	01 c0                	add    %eax,%eax
+  802176:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80217d:	00 
+  80217e:	89 c6                	mov    %eax,%esi
+  802180:	89 d7                	mov    %edx,%edi
+  802182:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802186:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80218a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80218d:	d3 ea                	shr    %cl,%edx
+  80218f:	f6 c1 20             	test   $0x20,%cl
+  802192:	0f 45 c2             	cmovne %edx,%eax
+  802195:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802199:	83 e0 01             	and    $0x1,%eax
+  80219c:	09 fa                	or     %edi,%edx
+  80219e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8021a2:	89 04 24             	mov    %eax,(%esp)
+  8021a5:	8b 04 24             	mov    (%esp),%eax
+  8021a8:	89 d5                	mov    %edx,%ebp
+  8021aa:	09 f0                	or     %esi,%eax
+  8021ac:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8021b0:	39 f0                	cmp    %esi,%eax
+  8021b2:	19 fd                	sbb    %edi,%ebp
+  8021b4:	72 1d                	jb     8021d3 <__udivmoddi4+0xb3>
+  8021b6:	29 f0                	sub    %esi,%eax
+  8021b8:	19 fa                	sbb    %edi,%edx
+  8021ba:	89 cf                	mov    %ecx,%edi
+  8021bc:	c1 ef 05             	shr    $0x5,%edi
+  8021bf:	83 e7 01             	and    $0x1,%edi
+  8021c2:	89 fe                	mov    %edi,%esi
+  8021c4:	d3 e7                	shl    %cl,%edi
+  8021c6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8021ca:	83 f6 01             	xor    $0x1,%esi
+  8021cd:	d3 e6                	shl    %cl,%esi
+  8021cf:	09 74 24 18          	or     %esi,0x18(%esp)
+  8021d3:	83 e9 01             	sub    $0x1,%ecx
+  8021d6:	73 98                	jae    802170 <__udivmoddi4+0x50>
+  8021d8:	85 db                	test   %ebx,%ebx
+  8021da:	74 05                	je     8021e1 <__udivmoddi4+0xc1>
+  8021dc:	89 03                	mov    %eax,(%ebx)
+  8021de:	89 53 04             	mov    %edx,0x4(%ebx)
+  8021e1:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8021e5:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8021e9:	83 c4 24             	add    $0x24,%esp
+  8021ec:	5b                   	pop    %ebx
+  8021ed:	5e                   	pop    %esi
+  8021ee:	5f                   	pop    %edi
+  8021ef:	5d                   	pop    %ebp
+  8021f0:	c3                   	ret
+  8021f1:	85 ff                	test   %edi,%edi
+  8021f3:	74 0d                	je     802202 <__udivmoddi4+0xe2>
+  8021f5:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  8021fb:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  802202:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802206:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80220a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80220e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802212:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802216:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80221a:	83 c4 24             	add    $0x24,%esp
+  80221d:	5b                   	pop    %ebx
+  80221e:	5e                   	pop    %esi
+  80221f:	5f                   	pop    %edi
+  802220:	5d                   	pop    %ebp
+  802221:	c3                   	ret
+  802222:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802229:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00802230 <__udivdi3>:
+  802230:	57                   	push   %edi
+  802231:	56                   	push   %esi
+  802232:	53                   	push   %ebx
+  802233:	83 ec 20             	sub    $0x20,%esp
+  802236:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80223a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80223e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802242:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802246:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80224a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80224e:	89 d1                	mov    %edx,%ecx
+  802250:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802254:	09 c1                	or     %eax,%ecx
+  802256:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80225a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80225e:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802262:	0f 84 88 00 00 00    	je     8022f0 <__udivdi3+0xc0>
+  802268:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80226f:	00 
+  802270:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802275:	31 c0                	xor    %eax,%eax
+  802277:	31 d2                	xor    %edx,%edx
+  802279:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802280:	00 
+  802281:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802288:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80228c:	01 c0                	add    %eax,%eax
+  80228e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802295:	00 
+  802296:	89 c6                	mov    %eax,%esi
+  802298:	89 d7                	mov    %edx,%edi
+  80229a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80229e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8022a2:	0f ad d0             	shrd   %cl,%edx,%eax
+  8022a5:	d3 ea                	shr    %cl,%edx
+  8022a7:	f6 c1 20             	test   $0x20,%cl
+  8022aa:	0f 45 c2             	cmovne %edx,%eax
+  8022ad:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8022b1:	83 e0 01             	and    $0x1,%eax
+  8022b4:	09 fa                	or     %edi,%edx
+  8022b6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8022ba:	89 04 24             	mov    %eax,(%esp)
+  8022bd:	8b 04 24             	mov    (%esp),%eax
+  8022c0:	89 d3                	mov    %edx,%ebx
+  8022c2:	09 f0                	or     %esi,%eax
+  8022c4:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8022c8:	39 f0                	cmp    %esi,%eax
+  8022ca:	19 fb                	sbb    %edi,%ebx
+  8022cc:	72 1d                	jb     8022eb <__udivdi3+0xbb>
+  8022ce:	29 f0                	sub    %esi,%eax
+  8022d0:	19 fa                	sbb    %edi,%edx
+  8022d2:	89 cf                	mov    %ecx,%edi
+  8022d4:	c1 ef 05             	shr    $0x5,%edi
+  8022d7:	83 e7 01             	and    $0x1,%edi
+  8022da:	89 fe                	mov    %edi,%esi
+  8022dc:	d3 e7                	shl    %cl,%edi
+  8022de:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8022e2:	83 f6 01             	xor    $0x1,%esi
+  8022e5:	d3 e6                	shl    %cl,%esi
+  8022e7:	09 74 24 18          	or     %esi,0x18(%esp)
+  8022eb:	83 e9 01             	sub    $0x1,%ecx
+  8022ee:	73 98                	jae    802288 <__udivdi3+0x58>
+  8022f0:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8022f4:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8022f8:	83 c4 20             	add    $0x20,%esp
+  8022fb:	5b                   	pop    %ebx
+  8022fc:	5e                   	pop    %esi
+  8022fd:	5f                   	pop    %edi
+  8022fe:	c3                   	ret
+  8022ff:	90                   	nop
+
+00802300 <__umoddi3>:
+  802300:	57                   	push   %edi
+  802301:	56                   	push   %esi
+  802302:	53                   	push   %ebx
+  802303:	83 ec 18             	sub    $0x18,%esp
+  802306:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80230a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80230e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802312:	8b 54 24 34          	mov    0x34(%esp),%edx
+  802316:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80231a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80231e:	89 d1                	mov    %edx,%ecx
+  802320:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802324:	09 c1                	or     %eax,%ecx
+  802326:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80232a:	74 5b                	je     802387 <__umoddi3+0x87>
+  80232c:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802331:	31 c0                	xor    %eax,%eax
+  802333:	31 d2                	xor    %edx,%edx
+  802335:	8d 76 00             	lea    0x0(%esi),%esi
+  802338:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80233c:	01 c0                	add    %eax,%eax
+  80233e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802345:	00 
+  802346:	89 c6                	mov    %eax,%esi
+  802348:	89 d7                	mov    %edx,%edi
+  80234a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80234e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802352:	0f ad d0             	shrd   %cl,%edx,%eax
+  802355:	d3 ea                	shr    %cl,%edx
+  802357:	f6 c1 20             	test   $0x20,%cl
+  80235a:	0f 45 c2             	cmovne %edx,%eax
+  80235d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802361:	83 e0 01             	and    $0x1,%eax
+  802364:	09 fa                	or     %edi,%edx
+  802366:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80236a:	89 04 24             	mov    %eax,(%esp)
+  80236d:	8b 04 24             	mov    (%esp),%eax
+  802370:	89 d3                	mov    %edx,%ebx
+  802372:	09 f0                	or     %esi,%eax
+  802374:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802378:	39 f0                	cmp    %esi,%eax
+  80237a:	19 fb                	sbb    %edi,%ebx
+  80237c:	72 04                	jb     802382 <__umoddi3+0x82>
+  80237e:	29 f0                	sub    %esi,%eax
+  802380:	19 fa                	sbb    %edi,%edx
+  802382:	83 e9 01             	sub    $0x1,%ecx
+  802385:	73 b1                	jae    802338 <__umoddi3+0x38>
+  802387:	83 c4 18             	add    $0x18,%esp
+  80238a:	5b                   	pop    %ebx
+  80238b:	5e                   	pop    %esi
+  80238c:	5f                   	pop    %edi
+  80238d:	c3                   	ret
+  80238e:	66 90                	xchg   %ax,%ax
+
+00802390 <__divdi3>:
+  802390:	55                   	push   %ebp
+  802391:	57                   	push   %edi
+  802392:	56                   	push   %esi
+  802393:	53                   	push   %ebx
+  802394:	83 ec 24             	sub    $0x24,%esp
+  802397:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  80239b:	8b 74 24 44          	mov    0x44(%esp),%esi
+  80239f:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8023a3:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8023a7:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  8023ab:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8023af:	85 d2                	test   %edx,%edx
+  8023b1:	0f 88 e0 00 00 00    	js     802497 <__divdi3+0x107>
+  8023b7:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  8023bb:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  8023bf:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8023c3:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8023c7:	85 f6                	test   %esi,%esi
+  8023c9:	78 16                	js     8023e1 <__divdi3+0x51>
+  8023cb:	89 f1                	mov    %esi,%ecx
+  8023cd:	31 c0                	xor    %eax,%eax
+  8023cf:	31 d2                	xor    %edx,%edx
+  8023d1:	09 d9                	or     %ebx,%ecx
+  8023d3:	0f 85 f3 00 00 00    	jne    8024cc <__divdi3+0x13c>
+  8023d9:	83 c4 24             	add    $0x24,%esp
+  8023dc:	5b                   	pop    %ebx
+  8023dd:	5e                   	pop    %esi
+  8023de:	5f                   	pop    %edi
+  8023df:	5d                   	pop    %ebp
+  8023e0:	c3                   	ret
+  8023e1:	bf 01 00 00 00       	mov    $0x1,%edi
+  8023e6:	f7 5c 24 08          	negl   0x8(%esp)
+  8023ea:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  8023ef:	f7 5c 24 0c          	negl   0xc(%esp)
+  8023f3:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8023fa:	00 
+  8023fb:	31 c0                	xor    %eax,%eax
+  8023fd:	31 d2                	xor    %edx,%edx
+  8023ff:	89 fb                	mov    %edi,%ebx
+  802401:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802408:	00 
+  802409:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80240e:	66 90                	xchg   %ax,%ax
+  802410:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802414:	01 c0                	add    %eax,%eax
+  802416:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80241d:	00 
+  80241e:	89 c6                	mov    %eax,%esi
+  802420:	89 d7                	mov    %edx,%edi
+  802422:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802426:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80242a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80242d:	d3 ea                	shr    %cl,%edx
+  80242f:	f6 c1 20             	test   $0x20,%cl
+  802432:	0f 45 c2             	cmovne %edx,%eax
+  802435:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802439:	83 e0 01             	and    $0x1,%eax
+  80243c:	09 fa                	or     %edi,%edx
+  80243e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802442:	89 04 24             	mov    %eax,(%esp)
+  802445:	8b 04 24             	mov    (%esp),%eax
+  802448:	89 d5                	mov    %edx,%ebp
+  80244a:	09 f0                	or     %esi,%eax
+  80244c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802450:	39 f0                	cmp    %esi,%eax
+  802452:	19 fd                	sbb    %edi,%ebp
+  802454:	72 1d                	jb     802473 <__divdi3+0xe3>
+  802456:	29 f0                	sub    %esi,%eax
+  802458:	19 fa                	sbb    %edi,%edx
+  80245a:	89 cf                	mov    %ecx,%edi
+  80245c:	c1 ef 05             	shr    $0x5,%edi
+  80245f:	83 e7 01             	and    $0x1,%edi
+  802462:	89 fe                	mov    %edi,%esi
+  802464:	d3 e7                	shl    %cl,%edi
+  802466:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80246a:	83 f6 01             	xor    $0x1,%esi
+  80246d:	d3 e6                	shl    %cl,%esi
+  80246f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802473:	83 e9 01             	sub    $0x1,%ecx
+  802476:	73 98                	jae    802410 <__divdi3+0x80>
+  802478:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80247c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802480:	85 db                	test   %ebx,%ebx
+  802482:	0f 84 51 ff ff ff    	je     8023d9 <__divdi3+0x49>
+  802488:	f7 d8                	neg    %eax
+  80248a:	83 d2 00             	adc    $0x0,%edx
+  80248d:	83 c4 24             	add    $0x24,%esp
+  802490:	5b                   	pop    %ebx
+  802491:	f7 da                	neg    %edx
+  802493:	5e                   	pop    %esi
+  802494:	5f                   	pop    %edi
+  802495:	5d                   	pop    %ebp
+  802496:	c3                   	ret
+  802497:	f7 d8                	neg    %eax
+  802499:	83 d2 00             	adc    $0x0,%edx
+  80249c:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8024a0:	f7 da                	neg    %edx
+  8024a2:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8024a6:	85 f6                	test   %esi,%esi
+  8024a8:	78 1b                	js     8024c5 <__divdi3+0x135>
+  8024aa:	89 f1                	mov    %esi,%ecx
+  8024ac:	31 c0                	xor    %eax,%eax
+  8024ae:	31 d2                	xor    %edx,%edx
+  8024b0:	bf 01 00 00 00       	mov    $0x1,%edi
+  8024b5:	09 d9                	or     %ebx,%ecx
+  8024b7:	0f 85 36 ff ff ff    	jne    8023f3 <__divdi3+0x63>
+  8024bd:	83 c4 24             	add    $0x24,%esp
+  8024c0:	5b                   	pop    %ebx
+  8024c1:	5e                   	pop    %esi
+  8024c2:	5f                   	pop    %edi
+  8024c3:	5d                   	pop    %ebp
+  8024c4:	c3                   	ret
+  8024c5:	31 ff                	xor    %edi,%edi
+  8024c7:	e9 1a ff ff ff       	jmp    8023e6 <__divdi3+0x56>
+  8024cc:	31 ff                	xor    %edi,%edi
+  8024ce:	e9 20 ff ff ff       	jmp    8023f3 <__divdi3+0x63>
+  8024d3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8024da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+008024e0 <__moddi3>:
+  8024e0:	55                   	push   %ebp
+  8024e1:	57                   	push   %edi
+  8024e2:	56                   	push   %esi
+  8024e3:	53                   	push   %ebx
+  8024e4:	83 ec 1c             	sub    $0x1c,%esp
+  8024e7:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  8024eb:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  8024ef:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  8024f3:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  8024f7:	89 c8                	mov    %ecx,%eax
+  8024f9:	89 f2                	mov    %esi,%edx
+  8024fb:	89 f3                	mov    %esi,%ebx
+  8024fd:	85 ed                	test   %ebp,%ebp
+  8024ff:	0f 88 9d 00 00 00    	js     8025a2 <__moddi3+0xc2>
+  802505:	09 cb                	or     %ecx,%ebx
+  802507:	0f 84 8d 00 00 00    	je     80259a <__moddi3+0xba>
+  80250d:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802511:	31 db                	xor    %ebx,%ebx
+  802513:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802517:	89 ca                	mov    %ecx,%edx
+  802519:	89 f0                	mov    %esi,%eax
+  80251b:	89 dd                	mov    %ebx,%ebp
+  80251d:	f7 da                	neg    %edx
+  80251f:	83 d0 00             	adc    $0x0,%eax
+  802522:	f7 d8                	neg    %eax
+  802524:	0f 49 f0             	cmovns %eax,%esi
+  802527:	0f 49 ca             	cmovns %edx,%ecx
+  80252a:	31 c0                	xor    %eax,%eax
+  80252c:	31 d2                	xor    %edx,%edx
+  80252e:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802532:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802536:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80253b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80253f:	90                   	nop
+  802540:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802544:	01 c0                	add    %eax,%eax
+  802546:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80254d:	00 
+  80254e:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  802552:	89 c6                	mov    %eax,%esi
+  802554:	89 d7                	mov    %edx,%edi
+  802556:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80255a:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80255e:	0f ad d0             	shrd   %cl,%edx,%eax
+  802561:	d3 ea                	shr    %cl,%edx
+  802563:	f6 c1 20             	test   $0x20,%cl
+  802566:	0f 45 c2             	cmovne %edx,%eax
+  802569:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80256d:	83 e0 01             	and    $0x1,%eax
+  802570:	09 fa                	or     %edi,%edx
+  802572:	89 04 24             	mov    %eax,(%esp)
+  802575:	8b 04 24             	mov    (%esp),%eax
+  802578:	89 d7                	mov    %edx,%edi
+  80257a:	09 f0                	or     %esi,%eax
+  80257c:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  802580:	39 d8                	cmp    %ebx,%eax
+  802582:	19 f7                	sbb    %esi,%edi
+  802584:	72 04                	jb     80258a <__moddi3+0xaa>
+  802586:	29 d8                	sub    %ebx,%eax
+  802588:	19 f2                	sbb    %esi,%edx
+  80258a:	83 e9 01             	sub    $0x1,%ecx
+  80258d:	73 b1                	jae    802540 <__moddi3+0x60>
+  80258f:	85 ed                	test   %ebp,%ebp
+  802591:	74 07                	je     80259a <__moddi3+0xba>
+  802593:	f7 d8                	neg    %eax
+  802595:	83 d2 00             	adc    $0x0,%edx
+  802598:	f7 da                	neg    %edx
+  80259a:	83 c4 1c             	add    $0x1c,%esp
+  80259d:	5b                   	pop    %ebx
+  80259e:	5e                   	pop    %esi
+  80259f:	5f                   	pop    %edi
+  8025a0:	5d                   	pop    %ebp
+  8025a1:	c3                   	ret
+  8025a2:	09 cb                	or     %ecx,%ebx
+  8025a4:	74 f4                	je     80259a <__moddi3+0xba>
+  8025a6:	f7 df                	neg    %edi
+  8025a8:	bb 01 00 00 00       	mov    $0x1,%ebx
+  8025ad:	83 d5 00             	adc    $0x0,%ebp
+  8025b0:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  8025b4:	f7 dd                	neg    %ebp
+  8025b6:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  8025ba:	e9 58 ff ff ff       	jmp    802517 <__moddi3+0x37>
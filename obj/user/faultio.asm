@@ -0,0 +1,5289 @@
+
+obj/user/faultio.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 3e 00 00 00       	call   80006f <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 08             	sub    $0x8,%esp
+
+static inline uint32_t
+read_eflags(void)
+{
+	uint32_t eflags;
+	asm volatile("pushfl; popl %0" : "=r" (eflags));
+  800039:	9c                   	pushf
+  80003a:	58                   	pop    %eax
+        int x, r;
+	int nsecs = 1;
+	int secno = 0;
+	int diskno = 1;
+
+	if (read_eflags() & FL_IOPL_3)
+  80003b:	f6 c4 30             	test   $0x30,%ah
+  80003e:	75 1d                	jne    80005d <umain+0x2a>
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  800040:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  800045:	ba f6 01 00 00       	mov    $0x1f6,%edx
+  80004a:	ee                   	out    %al,(%dx)
+
+	// this outb to select disk 1 should result in a general protection
+	// fault, because user-level code shouldn't be able to use the io space.
+	outb(0x1F6, 0xE0 | (1<<4));
+
+        cprintf("%s: made it here --- bug\n");
+  80004b:	83 ec 0c             	sub    $0xc,%esp
+  80004e:	68 2e 25 80 00       	push   $0x80252e
+  800053:	e8 0f 01 00 00       	call   800167 <cprintf>
+}
+  800058:	83 c4 10             	add    $0x10,%esp
+  80005b:	c9                   	leave
+  80005c:	c3                   	ret
+		cprintf("eflags wrong\n");
+  80005d:	83 ec 0c             	sub    $0xc,%esp
+  800060:	68 20 25 80 00       	push   $0x802520
+  800065:	e8 fd 00 00 00       	call   800167 <cprintf>
+  80006a:	83 c4 10             	add    $0x10,%esp
+  80006d:	eb d1                	jmp    800040 <umain+0xd>
+
+0080006f <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  80006f:	55                   	push   %ebp
+  800070:	89 e5                	mov    %esp,%ebp
+  800072:	56                   	push   %esi
+  800073:	53                   	push   %ebx
+  800074:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800077:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  80007a:	e8 4f 0a 00 00       	call   800ace <sys_getenvid>
+  80007f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800084:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800087:	c1 e0 04             	shl    $0x4,%eax
+  80008a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80008f:	a3 08 40 80 00       	mov    %eax,0x804008
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800094:	85 db                	test   %ebx,%ebx
+  800096:	7e 07                	jle    80009f <libmain+0x30>
+    binaryname = argv[0];
+  800098:	8b 06                	mov    (%esi),%eax
+  80009a:	a3 00 30 80 00       	mov    %eax,0x803000
+
+  // call user main routine
+  umain(argc, argv);
+  80009f:	83 ec 08             	sub    $0x8,%esp
+  8000a2:	56                   	push   %esi
+  8000a3:	53                   	push   %ebx
+  8000a4:	e8 8a ff ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  8000a9:	e8 0a 00 00 00       	call   8000b8 <exit>
+}
+  8000ae:	83 c4 10             	add    $0x10,%esp
+  8000b1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000b4:	5b                   	pop    %ebx
+  8000b5:	5e                   	pop    %esi
+  8000b6:	5d                   	pop    %ebp
+  8000b7:	c3                   	ret
+
+008000b8 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000b8:	55                   	push   %ebp
+  8000b9:	89 e5                	mov    %esp,%ebp
+  8000bb:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8000be:	e8 f0 0e 00 00       	call   800fb3 <close_all>
+	sys_env_destroy(0);
+  8000c3:	83 ec 0c             	sub    $0xc,%esp
+  8000c6:	6a 00                	push   $0x0
+  8000c8:	e8 c0 09 00 00       	call   800a8d <sys_env_destroy>
+}
+  8000cd:	83 c4 10             	add    $0x10,%esp
+  8000d0:	c9                   	leave
+  8000d1:	c3                   	ret
+
+008000d2 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8000d2:	55                   	push   %ebp
+  8000d3:	89 e5                	mov    %esp,%ebp
+  8000d5:	53                   	push   %ebx
+  8000d6:	83 ec 04             	sub    $0x4,%esp
+  8000d9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8000dc:	8b 13                	mov    (%ebx),%edx
+  8000de:	8d 42 01             	lea    0x1(%edx),%eax
+  8000e1:	89 03                	mov    %eax,(%ebx)
+  8000e3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8000e6:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8000ea:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8000ef:	74 09                	je     8000fa <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8000f1:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8000f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000f8:	c9                   	leave
+  8000f9:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8000fa:	83 ec 08             	sub    $0x8,%esp
+  8000fd:	68 ff 00 00 00       	push   $0xff
+  800102:	8d 43 08             	lea    0x8(%ebx),%eax
+  800105:	50                   	push   %eax
+  800106:	e8 45 09 00 00       	call   800a50 <sys_cputs>
+		b->idx = 0;
+  80010b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800111:	83 c4 10             	add    $0x10,%esp
+  800114:	eb db                	jmp    8000f1 <putch+0x1f>
+
+00800116 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800116:	55                   	push   %ebp
+  800117:	89 e5                	mov    %esp,%ebp
+  800119:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80011f:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800126:	00 00 00 
+	b.cnt = 0;
+  800129:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800130:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800133:	ff 75 0c             	push   0xc(%ebp)
+  800136:	ff 75 08             	push   0x8(%ebp)
+  800139:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80013f:	50                   	push   %eax
+  800140:	68 d2 00 80 00       	push   $0x8000d2
+  800145:	e8 14 01 00 00       	call   80025e <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80014a:	83 c4 08             	add    $0x8,%esp
+  80014d:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800153:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800159:	50                   	push   %eax
+  80015a:	e8 f1 08 00 00       	call   800a50 <sys_cputs>
+
+	return b.cnt;
+}
+  80015f:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800165:	c9                   	leave
+  800166:	c3                   	ret
+
+00800167 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800167:	55                   	push   %ebp
+  800168:	89 e5                	mov    %esp,%ebp
+  80016a:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80016d:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800170:	50                   	push   %eax
+  800171:	ff 75 08             	push   0x8(%ebp)
+  800174:	e8 9d ff ff ff       	call   800116 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800179:	c9                   	leave
+  80017a:	c3                   	ret
+
+0080017b <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80017b:	55                   	push   %ebp
+  80017c:	89 e5                	mov    %esp,%ebp
+  80017e:	57                   	push   %edi
+  80017f:	56                   	push   %esi
+  800180:	53                   	push   %ebx
+  800181:	83 ec 1c             	sub    $0x1c,%esp
+  800184:	89 c7                	mov    %eax,%edi
+  800186:	89 d6                	mov    %edx,%esi
+  800188:	8b 45 08             	mov    0x8(%ebp),%eax
+  80018b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80018e:	89 d1                	mov    %edx,%ecx
+  800190:	89 c2                	mov    %eax,%edx
+  800192:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800195:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800198:	8b 45 10             	mov    0x10(%ebp),%eax
+  80019b:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80019e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001a1:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8001a8:	39 c2                	cmp    %eax,%edx
+  8001aa:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8001ad:	72 3e                	jb     8001ed <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8001af:	83 ec 0c             	sub    $0xc,%esp
+  8001b2:	ff 75 18             	push   0x18(%ebp)
+  8001b5:	83 eb 01             	sub    $0x1,%ebx
+  8001b8:	53                   	push   %ebx
+  8001b9:	50                   	push   %eax
+  8001ba:	83 ec 08             	sub    $0x8,%esp
+  8001bd:	ff 75 e4             	push   -0x1c(%ebp)
+  8001c0:	ff 75 e0             	push   -0x20(%ebp)
+  8001c3:	ff 75 dc             	push   -0x24(%ebp)
+  8001c6:	ff 75 d8             	push   -0x28(%ebp)
+  8001c9:	e8 c2 1f 00 00       	call   802190 <__udivdi3>
+  8001ce:	83 c4 18             	add    $0x18,%esp
+  8001d1:	52                   	push   %edx
+  8001d2:	50                   	push   %eax
+  8001d3:	89 f2                	mov    %esi,%edx
+  8001d5:	89 f8                	mov    %edi,%eax
+  8001d7:	e8 9f ff ff ff       	call   80017b <printnum>
+  8001dc:	83 c4 20             	add    $0x20,%esp
+  8001df:	eb 13                	jmp    8001f4 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8001e1:	83 ec 08             	sub    $0x8,%esp
+  8001e4:	56                   	push   %esi
+  8001e5:	ff 75 18             	push   0x18(%ebp)
+  8001e8:	ff d7                	call   *%edi
+  8001ea:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8001ed:	83 eb 01             	sub    $0x1,%ebx
+  8001f0:	85 db                	test   %ebx,%ebx
+  8001f2:	7f ed                	jg     8001e1 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8001f4:	83 ec 08             	sub    $0x8,%esp
+  8001f7:	56                   	push   %esi
+  8001f8:	83 ec 04             	sub    $0x4,%esp
+  8001fb:	ff 75 e4             	push   -0x1c(%ebp)
+  8001fe:	ff 75 e0             	push   -0x20(%ebp)
+  800201:	ff 75 dc             	push   -0x24(%ebp)
+  800204:	ff 75 d8             	push   -0x28(%ebp)
+  800207:	e8 54 20 00 00       	call   802260 <__umoddi3>
+  80020c:	83 c4 14             	add    $0x14,%esp
+  80020f:	0f be 80 52 25 80 00 	movsbl 0x802552(%eax),%eax
+  800216:	50                   	push   %eax
+  800217:	ff d7                	call   *%edi
+}
+  800219:	83 c4 10             	add    $0x10,%esp
+  80021c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80021f:	5b                   	pop    %ebx
+  800220:	5e                   	pop    %esi
+  800221:	5f                   	pop    %edi
+  800222:	5d                   	pop    %ebp
+  800223:	c3                   	ret
+
+00800224 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800224:	55                   	push   %ebp
+  800225:	89 e5                	mov    %esp,%ebp
+  800227:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80022a:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80022e:	8b 10                	mov    (%eax),%edx
+  800230:	3b 50 04             	cmp    0x4(%eax),%edx
+  800233:	73 0a                	jae    80023f <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800235:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800238:	89 08                	mov    %ecx,(%eax)
+  80023a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80023d:	88 02                	mov    %al,(%edx)
+}
+  80023f:	5d                   	pop    %ebp
+  800240:	c3                   	ret
+
+00800241 <printfmt>:
+{
+  800241:	55                   	push   %ebp
+  800242:	89 e5                	mov    %esp,%ebp
+  800244:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800247:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80024a:	50                   	push   %eax
+  80024b:	ff 75 10             	push   0x10(%ebp)
+  80024e:	ff 75 0c             	push   0xc(%ebp)
+  800251:	ff 75 08             	push   0x8(%ebp)
+  800254:	e8 05 00 00 00       	call   80025e <vprintfmt>
+}
+  800259:	83 c4 10             	add    $0x10,%esp
+  80025c:	c9                   	leave
+  80025d:	c3                   	ret
+
+0080025e <vprintfmt>:
+{
+  80025e:	55                   	push   %ebp
+  80025f:	89 e5                	mov    %esp,%ebp
+  800261:	57                   	push   %edi
+  800262:	56                   	push   %esi
+  800263:	53                   	push   %ebx
+  800264:	83 ec 2c             	sub    $0x2c,%esp
+  800267:	8b 75 08             	mov    0x8(%ebp),%esi
+  80026a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80026d:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800270:	eb 0a                	jmp    80027c <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800272:	83 ec 08             	sub    $0x8,%esp
+  800275:	53                   	push   %ebx
+  800276:	50                   	push   %eax
+  800277:	ff d6                	call   *%esi
+  800279:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80027c:	83 c7 01             	add    $0x1,%edi
+  80027f:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800283:	83 f8 25             	cmp    $0x25,%eax
+  800286:	74 0c                	je     800294 <vprintfmt+0x36>
+			if (ch == '\0')
+  800288:	85 c0                	test   %eax,%eax
+  80028a:	75 e6                	jne    800272 <vprintfmt+0x14>
+}
+  80028c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80028f:	5b                   	pop    %ebx
+  800290:	5e                   	pop    %esi
+  800291:	5f                   	pop    %edi
+  800292:	5d                   	pop    %ebp
+  800293:	c3                   	ret
+		padc = ' ';
+  800294:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800298:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80029f:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8002a6:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8002ad:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8002b2:	8d 47 01             	lea    0x1(%edi),%eax
+  8002b5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8002b8:	0f b6 17             	movzbl (%edi),%edx
+  8002bb:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8002be:	3c 55                	cmp    $0x55,%al
+  8002c0:	0f 87 9a 03 00 00    	ja     800660 <vprintfmt+0x402>
+  8002c6:	0f b6 c0             	movzbl %al,%eax
+  8002c9:	ff 24 85 a0 26 80 00 	jmp    *0x8026a0(,%eax,4)
+  8002d0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8002d3:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8002d7:	eb d9                	jmp    8002b2 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8002d9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8002dc:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8002e0:	eb d0                	jmp    8002b2 <vprintfmt+0x54>
+  8002e2:	0f b6 d2             	movzbl %dl,%edx
+  8002e5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8002e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002ed:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8002f0:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8002f3:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8002f7:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8002fa:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8002fd:	83 f9 09             	cmp    $0x9,%ecx
+  800300:	77 55                	ja     800357 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800302:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800305:	eb e9                	jmp    8002f0 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800307:	8b 45 14             	mov    0x14(%ebp),%eax
+  80030a:	8b 00                	mov    (%eax),%eax
+  80030c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80030f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800312:	8d 40 04             	lea    0x4(%eax),%eax
+  800315:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800318:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80031b:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80031f:	79 91                	jns    8002b2 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800321:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800324:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800327:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80032e:	eb 82                	jmp    8002b2 <vprintfmt+0x54>
+			if (width < 0)
+  800330:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800333:	85 d2                	test   %edx,%edx
+  800335:	b8 00 00 00 00       	mov    $0x0,%eax
+  80033a:	0f 49 c2             	cmovns %edx,%eax
+  80033d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800340:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800343:	e9 6a ff ff ff       	jmp    8002b2 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800348:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80034b:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800352:	e9 5b ff ff ff       	jmp    8002b2 <vprintfmt+0x54>
+  800357:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80035a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80035d:	eb bc                	jmp    80031b <vprintfmt+0xbd>
+			lflag++;
+  80035f:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800362:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800365:	e9 48 ff ff ff       	jmp    8002b2 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80036a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80036d:	8d 78 04             	lea    0x4(%eax),%edi
+  800370:	83 ec 08             	sub    $0x8,%esp
+  800373:	53                   	push   %ebx
+  800374:	ff 30                	push   (%eax)
+  800376:	ff d6                	call   *%esi
+			break;
+  800378:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80037b:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80037e:	e9 7c 02 00 00       	jmp    8005ff <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  800383:	8b 45 14             	mov    0x14(%ebp),%eax
+  800386:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800389:	8b 10                	mov    (%eax),%edx
+  80038b:	89 d0                	mov    %edx,%eax
+  80038d:	f7 d8                	neg    %eax
+  80038f:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800392:	83 f8 10             	cmp    $0x10,%eax
+  800395:	7f 23                	jg     8003ba <vprintfmt+0x15c>
+  800397:	8b 14 85 00 28 80 00 	mov    0x802800(,%eax,4),%edx
+  80039e:	85 d2                	test   %edx,%edx
+  8003a0:	74 18                	je     8003ba <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8003a2:	52                   	push   %edx
+  8003a3:	68 39 29 80 00       	push   $0x802939
+  8003a8:	53                   	push   %ebx
+  8003a9:	56                   	push   %esi
+  8003aa:	e8 92 fe ff ff       	call   800241 <printfmt>
+  8003af:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003b2:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8003b5:	e9 45 02 00 00       	jmp    8005ff <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  8003ba:	50                   	push   %eax
+  8003bb:	68 6a 25 80 00       	push   $0x80256a
+  8003c0:	53                   	push   %ebx
+  8003c1:	56                   	push   %esi
+  8003c2:	e8 7a fe ff ff       	call   800241 <printfmt>
+  8003c7:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003ca:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8003cd:	e9 2d 02 00 00       	jmp    8005ff <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8003d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003d5:	83 c0 04             	add    $0x4,%eax
+  8003d8:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8003db:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003de:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8003e0:	85 c9                	test   %ecx,%ecx
+  8003e2:	b8 63 25 80 00       	mov    $0x802563,%eax
+  8003e7:	0f 45 c1             	cmovne %ecx,%eax
+  8003ea:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8003ed:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003f1:	7e 06                	jle    8003f9 <vprintfmt+0x19b>
+  8003f3:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8003f7:	75 0b                	jne    800404 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8003f9:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8003fc:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8003ff:	89 75 08             	mov    %esi,0x8(%ebp)
+  800402:	eb 5c                	jmp    800460 <vprintfmt+0x202>
+  800404:	83 ec 08             	sub    $0x8,%esp
+  800407:	ff 75 d0             	push   -0x30(%ebp)
+  80040a:	ff 75 cc             	push   -0x34(%ebp)
+  80040d:	e8 eb 02 00 00       	call   8006fd <strnlen>
+  800412:	89 c2                	mov    %eax,%edx
+  800414:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800417:	29 d0                	sub    %edx,%eax
+  800419:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80041c:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800420:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800423:	89 75 08             	mov    %esi,0x8(%ebp)
+  800426:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800428:	eb 0e                	jmp    800438 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  80042a:	83 ec 08             	sub    $0x8,%esp
+  80042d:	53                   	push   %ebx
+  80042e:	57                   	push   %edi
+  80042f:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800432:	83 ee 01             	sub    $0x1,%esi
+  800435:	83 c4 10             	add    $0x10,%esp
+  800438:	85 f6                	test   %esi,%esi
+  80043a:	7f ee                	jg     80042a <vprintfmt+0x1cc>
+  80043c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80043f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800442:	85 c0                	test   %eax,%eax
+  800444:	ba 00 00 00 00       	mov    $0x0,%edx
+  800449:	0f 49 d0             	cmovns %eax,%edx
+  80044c:	29 d0                	sub    %edx,%eax
+  80044e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800451:	eb a6                	jmp    8003f9 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800453:	83 ec 08             	sub    $0x8,%esp
+  800456:	53                   	push   %ebx
+  800457:	52                   	push   %edx
+  800458:	ff 55 08             	call   *0x8(%ebp)
+  80045b:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80045e:	89 f1                	mov    %esi,%ecx
+  800460:	8d 71 01             	lea    0x1(%ecx),%esi
+  800463:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800467:	0f be d0             	movsbl %al,%edx
+  80046a:	85 d2                	test   %edx,%edx
+  80046c:	74 28                	je     800496 <vprintfmt+0x238>
+  80046e:	85 ff                	test   %edi,%edi
+  800470:	78 05                	js     800477 <vprintfmt+0x219>
+  800472:	83 ef 01             	sub    $0x1,%edi
+  800475:	78 30                	js     8004a7 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800477:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80047b:	74 d6                	je     800453 <vprintfmt+0x1f5>
+  80047d:	0f be c0             	movsbl %al,%eax
+  800480:	83 e8 20             	sub    $0x20,%eax
+  800483:	83 f8 5e             	cmp    $0x5e,%eax
+  800486:	76 cb                	jbe    800453 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800488:	83 ec 08             	sub    $0x8,%esp
+  80048b:	53                   	push   %ebx
+  80048c:	6a 3f                	push   $0x3f
+  80048e:	ff 55 08             	call   *0x8(%ebp)
+  800491:	83 c4 10             	add    $0x10,%esp
+  800494:	eb c8                	jmp    80045e <vprintfmt+0x200>
+  800496:	8b 75 08             	mov    0x8(%ebp),%esi
+  800499:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80049c:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80049f:	01 d0                	add    %edx,%eax
+  8004a1:	29 c8                	sub    %ecx,%eax
+  8004a3:	89 c7                	mov    %eax,%edi
+  8004a5:	eb 13                	jmp    8004ba <vprintfmt+0x25c>
+  8004a7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004aa:	eb ed                	jmp    800499 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8004ac:	83 ec 08             	sub    $0x8,%esp
+  8004af:	53                   	push   %ebx
+  8004b0:	6a 20                	push   $0x20
+  8004b2:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8004b4:	83 ef 01             	sub    $0x1,%edi
+  8004b7:	83 c4 10             	add    $0x10,%esp
+  8004ba:	85 ff                	test   %edi,%edi
+  8004bc:	7f ee                	jg     8004ac <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004be:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8004c1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004c4:	e9 36 01 00 00       	jmp    8005ff <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  8004c9:	83 f9 01             	cmp    $0x1,%ecx
+  8004cc:	7f 1f                	jg     8004ed <vprintfmt+0x28f>
+	else if (lflag)
+  8004ce:	85 c9                	test   %ecx,%ecx
+  8004d0:	74 67                	je     800539 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8004d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004d5:	8b 00                	mov    (%eax),%eax
+  8004d7:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004da:	89 c1                	mov    %eax,%ecx
+  8004dc:	c1 f9 1f             	sar    $0x1f,%ecx
+  8004df:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8004e2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004e5:	8d 40 04             	lea    0x4(%eax),%eax
+  8004e8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004eb:	eb 17                	jmp    800504 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8004ed:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004f0:	8b 50 04             	mov    0x4(%eax),%edx
+  8004f3:	8b 00                	mov    (%eax),%eax
+  8004f5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004f8:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8004fb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004fe:	8d 40 08             	lea    0x8(%eax),%eax
+  800501:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800504:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800507:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80050a:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80050f:	85 c9                	test   %ecx,%ecx
+  800511:	0f 89 ce 00 00 00    	jns    8005e5 <vprintfmt+0x387>
+				putch('-', putdat);
+  800517:	83 ec 08             	sub    $0x8,%esp
+  80051a:	53                   	push   %ebx
+  80051b:	6a 2d                	push   $0x2d
+  80051d:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80051f:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800522:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800525:	f7 da                	neg    %edx
+  800527:	83 d1 00             	adc    $0x0,%ecx
+  80052a:	f7 d9                	neg    %ecx
+  80052c:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80052f:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800534:	e9 ac 00 00 00       	jmp    8005e5 <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  800539:	8b 45 14             	mov    0x14(%ebp),%eax
+  80053c:	8b 00                	mov    (%eax),%eax
+  80053e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800541:	89 c1                	mov    %eax,%ecx
+  800543:	c1 f9 1f             	sar    $0x1f,%ecx
+  800546:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800549:	8b 45 14             	mov    0x14(%ebp),%eax
+  80054c:	8d 40 04             	lea    0x4(%eax),%eax
+  80054f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800552:	eb b0                	jmp    800504 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800554:	83 f9 01             	cmp    $0x1,%ecx
+  800557:	7f 1b                	jg     800574 <vprintfmt+0x316>
+	else if (lflag)
+  800559:	85 c9                	test   %ecx,%ecx
+  80055b:	74 2c                	je     800589 <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  80055d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800560:	8b 10                	mov    (%eax),%edx
+  800562:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800567:	8d 40 04             	lea    0x4(%eax),%eax
+  80056a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80056d:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800572:	eb 71                	jmp    8005e5 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  800574:	8b 45 14             	mov    0x14(%ebp),%eax
+  800577:	8b 10                	mov    (%eax),%edx
+  800579:	8b 48 04             	mov    0x4(%eax),%ecx
+  80057c:	8d 40 08             	lea    0x8(%eax),%eax
+  80057f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800582:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800587:	eb 5c                	jmp    8005e5 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  800589:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058c:	8b 10                	mov    (%eax),%edx
+  80058e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800593:	8d 40 04             	lea    0x4(%eax),%eax
+  800596:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800599:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80059e:	eb 45                	jmp    8005e5 <vprintfmt+0x387>
+			putch('X', putdat);
+  8005a0:	83 ec 08             	sub    $0x8,%esp
+  8005a3:	53                   	push   %ebx
+  8005a4:	6a 58                	push   $0x58
+  8005a6:	ff d6                	call   *%esi
+			putch('X', putdat);
+  8005a8:	83 c4 08             	add    $0x8,%esp
+  8005ab:	53                   	push   %ebx
+  8005ac:	6a 58                	push   $0x58
+  8005ae:	ff d6                	call   *%esi
+			putch('X', putdat);
+  8005b0:	83 c4 08             	add    $0x8,%esp
+  8005b3:	53                   	push   %ebx
+  8005b4:	6a 58                	push   $0x58
+  8005b6:	ff d6                	call   *%esi
+			break;
+  8005b8:	83 c4 10             	add    $0x10,%esp
+  8005bb:	eb 42                	jmp    8005ff <vprintfmt+0x3a1>
+			putch('0', putdat);
+  8005bd:	83 ec 08             	sub    $0x8,%esp
+  8005c0:	53                   	push   %ebx
+  8005c1:	6a 30                	push   $0x30
+  8005c3:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8005c5:	83 c4 08             	add    $0x8,%esp
+  8005c8:	53                   	push   %ebx
+  8005c9:	6a 78                	push   $0x78
+  8005cb:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8005cd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d0:	8b 10                	mov    (%eax),%edx
+  8005d2:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8005d7:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8005da:	8d 40 04             	lea    0x4(%eax),%eax
+  8005dd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8005e0:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8005e5:	83 ec 0c             	sub    $0xc,%esp
+  8005e8:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8005ec:	50                   	push   %eax
+  8005ed:	ff 75 e0             	push   -0x20(%ebp)
+  8005f0:	57                   	push   %edi
+  8005f1:	51                   	push   %ecx
+  8005f2:	52                   	push   %edx
+  8005f3:	89 da                	mov    %ebx,%edx
+  8005f5:	89 f0                	mov    %esi,%eax
+  8005f7:	e8 7f fb ff ff       	call   80017b <printnum>
+			break;
+  8005fc:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8005ff:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800602:	e9 75 fc ff ff       	jmp    80027c <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800607:	83 f9 01             	cmp    $0x1,%ecx
+  80060a:	7f 1b                	jg     800627 <vprintfmt+0x3c9>
+	else if (lflag)
+  80060c:	85 c9                	test   %ecx,%ecx
+  80060e:	74 2c                	je     80063c <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  800610:	8b 45 14             	mov    0x14(%ebp),%eax
+  800613:	8b 10                	mov    (%eax),%edx
+  800615:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80061a:	8d 40 04             	lea    0x4(%eax),%eax
+  80061d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800620:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800625:	eb be                	jmp    8005e5 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  800627:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062a:	8b 10                	mov    (%eax),%edx
+  80062c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80062f:	8d 40 08             	lea    0x8(%eax),%eax
+  800632:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800635:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80063a:	eb a9                	jmp    8005e5 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  80063c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063f:	8b 10                	mov    (%eax),%edx
+  800641:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800646:	8d 40 04             	lea    0x4(%eax),%eax
+  800649:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80064c:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800651:	eb 92                	jmp    8005e5 <vprintfmt+0x387>
+			putch(ch, putdat);
+  800653:	83 ec 08             	sub    $0x8,%esp
+  800656:	53                   	push   %ebx
+  800657:	6a 25                	push   $0x25
+  800659:	ff d6                	call   *%esi
+			break;
+  80065b:	83 c4 10             	add    $0x10,%esp
+  80065e:	eb 9f                	jmp    8005ff <vprintfmt+0x3a1>
+			putch('%', putdat);
+  800660:	83 ec 08             	sub    $0x8,%esp
+  800663:	53                   	push   %ebx
+  800664:	6a 25                	push   $0x25
+  800666:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800668:	83 c4 10             	add    $0x10,%esp
+  80066b:	89 f8                	mov    %edi,%eax
+  80066d:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800671:	74 05                	je     800678 <vprintfmt+0x41a>
+  800673:	83 e8 01             	sub    $0x1,%eax
+  800676:	eb f5                	jmp    80066d <vprintfmt+0x40f>
+  800678:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80067b:	eb 82                	jmp    8005ff <vprintfmt+0x3a1>
+
+0080067d <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80067d:	55                   	push   %ebp
+  80067e:	89 e5                	mov    %esp,%ebp
+  800680:	83 ec 18             	sub    $0x18,%esp
+  800683:	8b 45 08             	mov    0x8(%ebp),%eax
+  800686:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800689:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80068c:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800690:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800693:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80069a:	85 c0                	test   %eax,%eax
+  80069c:	74 26                	je     8006c4 <vsnprintf+0x47>
+  80069e:	85 d2                	test   %edx,%edx
+  8006a0:	7e 22                	jle    8006c4 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8006a2:	ff 75 14             	push   0x14(%ebp)
+  8006a5:	ff 75 10             	push   0x10(%ebp)
+  8006a8:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8006ab:	50                   	push   %eax
+  8006ac:	68 24 02 80 00       	push   $0x800224
+  8006b1:	e8 a8 fb ff ff       	call   80025e <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8006b6:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8006b9:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8006bc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8006bf:	83 c4 10             	add    $0x10,%esp
+}
+  8006c2:	c9                   	leave
+  8006c3:	c3                   	ret
+		return -E_INVAL;
+  8006c4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006c9:	eb f7                	jmp    8006c2 <vsnprintf+0x45>
+
+008006cb <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8006cb:	55                   	push   %ebp
+  8006cc:	89 e5                	mov    %esp,%ebp
+  8006ce:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8006d1:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8006d4:	50                   	push   %eax
+  8006d5:	ff 75 10             	push   0x10(%ebp)
+  8006d8:	ff 75 0c             	push   0xc(%ebp)
+  8006db:	ff 75 08             	push   0x8(%ebp)
+  8006de:	e8 9a ff ff ff       	call   80067d <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8006e3:	c9                   	leave
+  8006e4:	c3                   	ret
+
+008006e5 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8006e5:	55                   	push   %ebp
+  8006e6:	89 e5                	mov    %esp,%ebp
+  8006e8:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8006eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006f0:	eb 03                	jmp    8006f5 <strlen+0x10>
+		n++;
+  8006f2:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8006f5:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8006f9:	75 f7                	jne    8006f2 <strlen+0xd>
+	return n;
+}
+  8006fb:	5d                   	pop    %ebp
+  8006fc:	c3                   	ret
+
+008006fd <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8006fd:	55                   	push   %ebp
+  8006fe:	89 e5                	mov    %esp,%ebp
+  800700:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800703:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800706:	b8 00 00 00 00       	mov    $0x0,%eax
+  80070b:	eb 03                	jmp    800710 <strnlen+0x13>
+		n++;
+  80070d:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800710:	39 d0                	cmp    %edx,%eax
+  800712:	74 08                	je     80071c <strnlen+0x1f>
+  800714:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800718:	75 f3                	jne    80070d <strnlen+0x10>
+  80071a:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80071c:	89 d0                	mov    %edx,%eax
+  80071e:	5d                   	pop    %ebp
+  80071f:	c3                   	ret
+
+00800720 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800720:	55                   	push   %ebp
+  800721:	89 e5                	mov    %esp,%ebp
+  800723:	53                   	push   %ebx
+  800724:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800727:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80072a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80072f:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800733:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800736:	83 c0 01             	add    $0x1,%eax
+  800739:	84 d2                	test   %dl,%dl
+  80073b:	75 f2                	jne    80072f <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80073d:	89 c8                	mov    %ecx,%eax
+  80073f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800742:	c9                   	leave
+  800743:	c3                   	ret
+
+00800744 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800744:	55                   	push   %ebp
+  800745:	89 e5                	mov    %esp,%ebp
+  800747:	53                   	push   %ebx
+  800748:	83 ec 10             	sub    $0x10,%esp
+  80074b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80074e:	53                   	push   %ebx
+  80074f:	e8 91 ff ff ff       	call   8006e5 <strlen>
+  800754:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800757:	ff 75 0c             	push   0xc(%ebp)
+  80075a:	01 d8                	add    %ebx,%eax
+  80075c:	50                   	push   %eax
+  80075d:	e8 be ff ff ff       	call   800720 <strcpy>
+	return dst;
+}
+  800762:	89 d8                	mov    %ebx,%eax
+  800764:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800767:	c9                   	leave
+  800768:	c3                   	ret
+
+00800769 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800769:	55                   	push   %ebp
+  80076a:	89 e5                	mov    %esp,%ebp
+  80076c:	56                   	push   %esi
+  80076d:	53                   	push   %ebx
+  80076e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800771:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800774:	89 f3                	mov    %esi,%ebx
+  800776:	03 5d 10             	add    0x10(%ebp),%ebx
+  800779:	89 f0                	mov    %esi,%eax
+  80077b:	eb 0f                	jmp    80078c <strncpy+0x23>
+		*dst++ = *src;
+  80077d:	83 c0 01             	add    $0x1,%eax
+  800780:	0f b6 0a             	movzbl (%edx),%ecx
+  800783:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800786:	80 f9 01             	cmp    $0x1,%cl
+  800789:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80078c:	39 d8                	cmp    %ebx,%eax
+  80078e:	75 ed                	jne    80077d <strncpy+0x14>
+	}
+	return ret;
+}
+  800790:	89 f0                	mov    %esi,%eax
+  800792:	5b                   	pop    %ebx
+  800793:	5e                   	pop    %esi
+  800794:	5d                   	pop    %ebp
+  800795:	c3                   	ret
+
+00800796 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800796:	55                   	push   %ebp
+  800797:	89 e5                	mov    %esp,%ebp
+  800799:	56                   	push   %esi
+  80079a:	53                   	push   %ebx
+  80079b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80079e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007a1:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8007a4:	89 f0                	mov    %esi,%eax
+  8007a6:	85 d2                	test   %edx,%edx
+  8007a8:	74 21                	je     8007cb <strlcpy+0x35>
+  8007aa:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8007ae:	89 f2                	mov    %esi,%edx
+  8007b0:	eb 09                	jmp    8007bb <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8007b2:	83 c1 01             	add    $0x1,%ecx
+  8007b5:	83 c2 01             	add    $0x1,%edx
+  8007b8:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8007bb:	39 c2                	cmp    %eax,%edx
+  8007bd:	74 09                	je     8007c8 <strlcpy+0x32>
+  8007bf:	0f b6 19             	movzbl (%ecx),%ebx
+  8007c2:	84 db                	test   %bl,%bl
+  8007c4:	75 ec                	jne    8007b2 <strlcpy+0x1c>
+  8007c6:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8007c8:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8007cb:	29 f0                	sub    %esi,%eax
+}
+  8007cd:	5b                   	pop    %ebx
+  8007ce:	5e                   	pop    %esi
+  8007cf:	5d                   	pop    %ebp
+  8007d0:	c3                   	ret
+
+008007d1 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8007d1:	55                   	push   %ebp
+  8007d2:	89 e5                	mov    %esp,%ebp
+  8007d4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007d7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8007da:	eb 06                	jmp    8007e2 <strcmp+0x11>
+		p++, q++;
+  8007dc:	83 c1 01             	add    $0x1,%ecx
+  8007df:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8007e2:	0f b6 01             	movzbl (%ecx),%eax
+  8007e5:	84 c0                	test   %al,%al
+  8007e7:	74 04                	je     8007ed <strcmp+0x1c>
+  8007e9:	3a 02                	cmp    (%edx),%al
+  8007eb:	74 ef                	je     8007dc <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8007ed:	0f b6 c0             	movzbl %al,%eax
+  8007f0:	0f b6 12             	movzbl (%edx),%edx
+  8007f3:	29 d0                	sub    %edx,%eax
+}
+  8007f5:	5d                   	pop    %ebp
+  8007f6:	c3                   	ret
+
+008007f7 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8007f7:	55                   	push   %ebp
+  8007f8:	89 e5                	mov    %esp,%ebp
+  8007fa:	53                   	push   %ebx
+  8007fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007fe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800801:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800804:	eb 09                	jmp    80080f <strncmp+0x18>
+		n--, p++, q++;
+  800806:	83 ea 01             	sub    $0x1,%edx
+  800809:	83 c0 01             	add    $0x1,%eax
+  80080c:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80080f:	85 d2                	test   %edx,%edx
+  800811:	74 18                	je     80082b <strncmp+0x34>
+  800813:	0f b6 18             	movzbl (%eax),%ebx
+  800816:	84 db                	test   %bl,%bl
+  800818:	74 04                	je     80081e <strncmp+0x27>
+  80081a:	3a 19                	cmp    (%ecx),%bl
+  80081c:	74 e8                	je     800806 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80081e:	0f b6 00             	movzbl (%eax),%eax
+  800821:	0f b6 11             	movzbl (%ecx),%edx
+  800824:	29 d0                	sub    %edx,%eax
+}
+  800826:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800829:	c9                   	leave
+  80082a:	c3                   	ret
+		return 0;
+  80082b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800830:	eb f4                	jmp    800826 <strncmp+0x2f>
+
+00800832 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800832:	55                   	push   %ebp
+  800833:	89 e5                	mov    %esp,%ebp
+  800835:	8b 45 08             	mov    0x8(%ebp),%eax
+  800838:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80083c:	eb 03                	jmp    800841 <strchr+0xf>
+  80083e:	83 c0 01             	add    $0x1,%eax
+  800841:	0f b6 10             	movzbl (%eax),%edx
+  800844:	84 d2                	test   %dl,%dl
+  800846:	74 06                	je     80084e <strchr+0x1c>
+		if (*s == c)
+  800848:	38 ca                	cmp    %cl,%dl
+  80084a:	75 f2                	jne    80083e <strchr+0xc>
+  80084c:	eb 05                	jmp    800853 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  80084e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800853:	5d                   	pop    %ebp
+  800854:	c3                   	ret
+
+00800855 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800855:	55                   	push   %ebp
+  800856:	89 e5                	mov    %esp,%ebp
+  800858:	8b 45 08             	mov    0x8(%ebp),%eax
+  80085b:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80085f:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800862:	38 ca                	cmp    %cl,%dl
+  800864:	74 09                	je     80086f <strfind+0x1a>
+  800866:	84 d2                	test   %dl,%dl
+  800868:	74 05                	je     80086f <strfind+0x1a>
+	for (; *s; s++)
+  80086a:	83 c0 01             	add    $0x1,%eax
+  80086d:	eb f0                	jmp    80085f <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  80086f:	5d                   	pop    %ebp
+  800870:	c3                   	ret
+
+00800871 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800871:	55                   	push   %ebp
+  800872:	89 e5                	mov    %esp,%ebp
+  800874:	57                   	push   %edi
+  800875:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800878:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  80087b:	85 c9                	test   %ecx,%ecx
+  80087d:	74 20                	je     80089f <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  80087f:	89 f8                	mov    %edi,%eax
+  800881:	09 c8                	or     %ecx,%eax
+  800883:	a8 03                	test   $0x3,%al
+  800885:	75 12                	jne    800899 <memset+0x28>
+		c &= 0xFF;
+  800887:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80088b:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800891:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800894:	fc                   	cld
+  800895:	f3 ab                	rep stos %eax,%es:(%edi)
+  800897:	eb 06                	jmp    80089f <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800899:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80089c:	fc                   	cld
+  80089d:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  80089f:	89 f8                	mov    %edi,%eax
+  8008a1:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8008a4:	c9                   	leave
+  8008a5:	c3                   	ret
+
+008008a6 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8008a6:	55                   	push   %ebp
+  8008a7:	89 e5                	mov    %esp,%ebp
+  8008a9:	57                   	push   %edi
+  8008aa:	56                   	push   %esi
+  8008ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008ae:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8008b1:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8008b4:	39 c6                	cmp    %eax,%esi
+  8008b6:	73 32                	jae    8008ea <memmove+0x44>
+  8008b8:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8008bb:	39 d0                	cmp    %edx,%eax
+  8008bd:	73 2b                	jae    8008ea <memmove+0x44>
+		s += n;
+		d += n;
+  8008bf:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8008c2:	89 d6                	mov    %edx,%esi
+  8008c4:	09 fe                	or     %edi,%esi
+  8008c6:	09 ce                	or     %ecx,%esi
+  8008c8:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8008ce:	75 0e                	jne    8008de <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8008d0:	83 ef 04             	sub    $0x4,%edi
+  8008d3:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8008d6:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8008d9:	fd                   	std
+  8008da:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8008dc:	eb 09                	jmp    8008e7 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8008de:	83 ef 01             	sub    $0x1,%edi
+  8008e1:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8008e4:	fd                   	std
+  8008e5:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8008e7:	fc                   	cld
+  8008e8:	eb 1a                	jmp    800904 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8008ea:	89 f2                	mov    %esi,%edx
+  8008ec:	09 c2                	or     %eax,%edx
+  8008ee:	09 ca                	or     %ecx,%edx
+  8008f0:	f6 c2 03             	test   $0x3,%dl
+  8008f3:	75 0a                	jne    8008ff <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8008f5:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8008f8:	89 c7                	mov    %eax,%edi
+  8008fa:	fc                   	cld
+  8008fb:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8008fd:	eb 05                	jmp    800904 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8008ff:	89 c7                	mov    %eax,%edi
+  800901:	fc                   	cld
+  800902:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800904:	5e                   	pop    %esi
+  800905:	5f                   	pop    %edi
+  800906:	5d                   	pop    %ebp
+  800907:	c3                   	ret
+
+00800908 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800908:	55                   	push   %ebp
+  800909:	89 e5                	mov    %esp,%ebp
+  80090b:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  80090e:	ff 75 10             	push   0x10(%ebp)
+  800911:	ff 75 0c             	push   0xc(%ebp)
+  800914:	ff 75 08             	push   0x8(%ebp)
+  800917:	e8 8a ff ff ff       	call   8008a6 <memmove>
+}
+  80091c:	c9                   	leave
+  80091d:	c3                   	ret
+
+0080091e <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  80091e:	55                   	push   %ebp
+  80091f:	89 e5                	mov    %esp,%ebp
+  800921:	56                   	push   %esi
+  800922:	53                   	push   %ebx
+  800923:	8b 45 08             	mov    0x8(%ebp),%eax
+  800926:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800929:	89 c6                	mov    %eax,%esi
+  80092b:	03 75 10             	add    0x10(%ebp),%esi
+  80092e:	eb 06                	jmp    800936 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800930:	83 c0 01             	add    $0x1,%eax
+  800933:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800936:	39 f0                	cmp    %esi,%eax
+  800938:	74 14                	je     80094e <memcmp+0x30>
+		if (*s1 != *s2)
+  80093a:	0f b6 08             	movzbl (%eax),%ecx
+  80093d:	0f b6 1a             	movzbl (%edx),%ebx
+  800940:	38 d9                	cmp    %bl,%cl
+  800942:	74 ec                	je     800930 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800944:	0f b6 c1             	movzbl %cl,%eax
+  800947:	0f b6 db             	movzbl %bl,%ebx
+  80094a:	29 d8                	sub    %ebx,%eax
+  80094c:	eb 05                	jmp    800953 <memcmp+0x35>
+	}
+
+	return 0;
+  80094e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800953:	5b                   	pop    %ebx
+  800954:	5e                   	pop    %esi
+  800955:	5d                   	pop    %ebp
+  800956:	c3                   	ret
+
+00800957 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800957:	55                   	push   %ebp
+  800958:	89 e5                	mov    %esp,%ebp
+  80095a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80095d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800960:	89 c2                	mov    %eax,%edx
+  800962:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800965:	eb 03                	jmp    80096a <memfind+0x13>
+  800967:	83 c0 01             	add    $0x1,%eax
+  80096a:	39 d0                	cmp    %edx,%eax
+  80096c:	73 04                	jae    800972 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  80096e:	38 08                	cmp    %cl,(%eax)
+  800970:	75 f5                	jne    800967 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800972:	5d                   	pop    %ebp
+  800973:	c3                   	ret
+
+00800974 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800974:	55                   	push   %ebp
+  800975:	89 e5                	mov    %esp,%ebp
+  800977:	57                   	push   %edi
+  800978:	56                   	push   %esi
+  800979:	53                   	push   %ebx
+  80097a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80097d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800980:	eb 03                	jmp    800985 <strtol+0x11>
+		s++;
+  800982:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800985:	0f b6 02             	movzbl (%edx),%eax
+  800988:	3c 20                	cmp    $0x20,%al
+  80098a:	74 f6                	je     800982 <strtol+0xe>
+  80098c:	3c 09                	cmp    $0x9,%al
+  80098e:	74 f2                	je     800982 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800990:	3c 2b                	cmp    $0x2b,%al
+  800992:	74 2a                	je     8009be <strtol+0x4a>
+	int neg = 0;
+  800994:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800999:	3c 2d                	cmp    $0x2d,%al
+  80099b:	74 2b                	je     8009c8 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80099d:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8009a3:	75 0f                	jne    8009b4 <strtol+0x40>
+  8009a5:	80 3a 30             	cmpb   $0x30,(%edx)
+  8009a8:	74 28                	je     8009d2 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8009aa:	85 db                	test   %ebx,%ebx
+  8009ac:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8009b1:	0f 44 d8             	cmove  %eax,%ebx
+  8009b4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009b9:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8009bc:	eb 46                	jmp    800a04 <strtol+0x90>
+		s++;
+  8009be:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  8009c1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009c6:	eb d5                	jmp    80099d <strtol+0x29>
+		s++, neg = 1;
+  8009c8:	83 c2 01             	add    $0x1,%edx
+  8009cb:	bf 01 00 00 00       	mov    $0x1,%edi
+  8009d0:	eb cb                	jmp    80099d <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009d2:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8009d6:	74 0e                	je     8009e6 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  8009d8:	85 db                	test   %ebx,%ebx
+  8009da:	75 d8                	jne    8009b4 <strtol+0x40>
+		s++, base = 8;
+  8009dc:	83 c2 01             	add    $0x1,%edx
+  8009df:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8009e4:	eb ce                	jmp    8009b4 <strtol+0x40>
+		s += 2, base = 16;
+  8009e6:	83 c2 02             	add    $0x2,%edx
+  8009e9:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8009ee:	eb c4                	jmp    8009b4 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  8009f0:	0f be c0             	movsbl %al,%eax
+  8009f3:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  8009f6:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8009f9:	7d 3a                	jge    800a35 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  8009fb:	83 c2 01             	add    $0x1,%edx
+  8009fe:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a02:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a04:	0f b6 02             	movzbl (%edx),%eax
+  800a07:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a0a:	89 f3                	mov    %esi,%ebx
+  800a0c:	80 fb 09             	cmp    $0x9,%bl
+  800a0f:	76 df                	jbe    8009f0 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a11:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a14:	89 f3                	mov    %esi,%ebx
+  800a16:	80 fb 19             	cmp    $0x19,%bl
+  800a19:	77 08                	ja     800a23 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800a1b:	0f be c0             	movsbl %al,%eax
+  800a1e:	83 e8 57             	sub    $0x57,%eax
+  800a21:	eb d3                	jmp    8009f6 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800a23:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800a26:	89 f3                	mov    %esi,%ebx
+  800a28:	80 fb 19             	cmp    $0x19,%bl
+  800a2b:	77 08                	ja     800a35 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800a2d:	0f be c0             	movsbl %al,%eax
+  800a30:	83 e8 37             	sub    $0x37,%eax
+  800a33:	eb c1                	jmp    8009f6 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800a35:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800a39:	74 05                	je     800a40 <strtol+0xcc>
+		*endptr = (char *) s;
+  800a3b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a3e:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800a40:	89 c8                	mov    %ecx,%eax
+  800a42:	f7 d8                	neg    %eax
+  800a44:	85 ff                	test   %edi,%edi
+  800a46:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800a49:	89 c8                	mov    %ecx,%eax
+  800a4b:	5b                   	pop    %ebx
+  800a4c:	5e                   	pop    %esi
+  800a4d:	5f                   	pop    %edi
+  800a4e:	5d                   	pop    %ebp
+  800a4f:	c3                   	ret
+
+00800a50 <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800a50:	55                   	push   %ebp
+  800a51:	89 e5                	mov    %esp,%ebp
+  800a53:	57                   	push   %edi
+  800a54:	56                   	push   %esi
+  800a55:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800a56:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a5b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a5e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a61:	89 c3                	mov    %eax,%ebx
+  800a63:	89 c7                	mov    %eax,%edi
+  800a65:	89 c6                	mov    %eax,%esi
+  800a67:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  800a69:	5b                   	pop    %ebx
+  800a6a:	5e                   	pop    %esi
+  800a6b:	5f                   	pop    %edi
+  800a6c:	5d                   	pop    %ebp
+  800a6d:	c3                   	ret
+
+00800a6e <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800a6e:	55                   	push   %ebp
+  800a6f:	89 e5                	mov    %esp,%ebp
+  800a71:	57                   	push   %edi
+  800a72:	56                   	push   %esi
+  800a73:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800a74:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a79:	b8 01 00 00 00       	mov    $0x1,%eax
+  800a7e:	89 d1                	mov    %edx,%ecx
+  800a80:	89 d3                	mov    %edx,%ebx
+  800a82:	89 d7                	mov    %edx,%edi
+  800a84:	89 d6                	mov    %edx,%esi
+  800a86:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800a88:	5b                   	pop    %ebx
+  800a89:	5e                   	pop    %esi
+  800a8a:	5f                   	pop    %edi
+  800a8b:	5d                   	pop    %ebp
+  800a8c:	c3                   	ret
+
+00800a8d <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800a8d:	55                   	push   %ebp
+  800a8e:	89 e5                	mov    %esp,%ebp
+  800a90:	57                   	push   %edi
+  800a91:	56                   	push   %esi
+  800a92:	53                   	push   %ebx
+  800a93:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800a96:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a9b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a9e:	b8 03 00 00 00       	mov    $0x3,%eax
+  800aa3:	89 cb                	mov    %ecx,%ebx
+  800aa5:	89 cf                	mov    %ecx,%edi
+  800aa7:	89 ce                	mov    %ecx,%esi
+  800aa9:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800aab:	85 c0                	test   %eax,%eax
+  800aad:	7f 08                	jg     800ab7 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800aaf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ab2:	5b                   	pop    %ebx
+  800ab3:	5e                   	pop    %esi
+  800ab4:	5f                   	pop    %edi
+  800ab5:	5d                   	pop    %ebp
+  800ab6:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ab7:	83 ec 0c             	sub    $0xc,%esp
+  800aba:	50                   	push   %eax
+  800abb:	6a 03                	push   $0x3
+  800abd:	68 63 28 80 00       	push   $0x802863
+  800ac2:	6a 3e                	push   $0x3e
+  800ac4:	68 80 28 80 00       	push   $0x802880
+  800ac9:	e8 22 14 00 00       	call   801ef0 <_panic>
+
+00800ace <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800ace:	55                   	push   %ebp
+  800acf:	89 e5                	mov    %esp,%ebp
+  800ad1:	57                   	push   %edi
+  800ad2:	56                   	push   %esi
+  800ad3:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800ad4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ad9:	b8 02 00 00 00       	mov    $0x2,%eax
+  800ade:	89 d1                	mov    %edx,%ecx
+  800ae0:	89 d3                	mov    %edx,%ebx
+  800ae2:	89 d7                	mov    %edx,%edi
+  800ae4:	89 d6                	mov    %edx,%esi
+  800ae6:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800ae8:	5b                   	pop    %ebx
+  800ae9:	5e                   	pop    %esi
+  800aea:	5f                   	pop    %edi
+  800aeb:	5d                   	pop    %ebp
+  800aec:	c3                   	ret
+
+00800aed <sys_yield>:
+
+void
+sys_yield(void) {
+  800aed:	55                   	push   %ebp
+  800aee:	89 e5                	mov    %esp,%ebp
+  800af0:	57                   	push   %edi
+  800af1:	56                   	push   %esi
+  800af2:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800af3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800af8:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800afd:	89 d1                	mov    %edx,%ecx
+  800aff:	89 d3                	mov    %edx,%ebx
+  800b01:	89 d7                	mov    %edx,%edi
+  800b03:	89 d6                	mov    %edx,%esi
+  800b05:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800b07:	5b                   	pop    %ebx
+  800b08:	5e                   	pop    %esi
+  800b09:	5f                   	pop    %edi
+  800b0a:	5d                   	pop    %ebp
+  800b0b:	c3                   	ret
+
+00800b0c <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  800b0c:	55                   	push   %ebp
+  800b0d:	89 e5                	mov    %esp,%ebp
+  800b0f:	57                   	push   %edi
+  800b10:	56                   	push   %esi
+  800b11:	53                   	push   %ebx
+  800b12:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800b15:	be 00 00 00 00       	mov    $0x0,%esi
+  800b1a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b1d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b20:	b8 04 00 00 00       	mov    $0x4,%eax
+  800b25:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b28:	89 f7                	mov    %esi,%edi
+  800b2a:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800b2c:	85 c0                	test   %eax,%eax
+  800b2e:	7f 08                	jg     800b38 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800b30:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b33:	5b                   	pop    %ebx
+  800b34:	5e                   	pop    %esi
+  800b35:	5f                   	pop    %edi
+  800b36:	5d                   	pop    %ebp
+  800b37:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800b38:	83 ec 0c             	sub    $0xc,%esp
+  800b3b:	50                   	push   %eax
+  800b3c:	6a 04                	push   $0x4
+  800b3e:	68 63 28 80 00       	push   $0x802863
+  800b43:	6a 3e                	push   $0x3e
+  800b45:	68 80 28 80 00       	push   $0x802880
+  800b4a:	e8 a1 13 00 00       	call   801ef0 <_panic>
+
+00800b4f <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  800b4f:	55                   	push   %ebp
+  800b50:	89 e5                	mov    %esp,%ebp
+  800b52:	57                   	push   %edi
+  800b53:	56                   	push   %esi
+  800b54:	53                   	push   %ebx
+  800b55:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800b58:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b5b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b5e:	b8 05 00 00 00       	mov    $0x5,%eax
+  800b63:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b66:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800b69:	8b 75 18             	mov    0x18(%ebp),%esi
+  800b6c:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800b6e:	85 c0                	test   %eax,%eax
+  800b70:	7f 08                	jg     800b7a <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800b72:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b75:	5b                   	pop    %ebx
+  800b76:	5e                   	pop    %esi
+  800b77:	5f                   	pop    %edi
+  800b78:	5d                   	pop    %ebp
+  800b79:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800b7a:	83 ec 0c             	sub    $0xc,%esp
+  800b7d:	50                   	push   %eax
+  800b7e:	6a 05                	push   $0x5
+  800b80:	68 63 28 80 00       	push   $0x802863
+  800b85:	6a 3e                	push   $0x3e
+  800b87:	68 80 28 80 00       	push   $0x802880
+  800b8c:	e8 5f 13 00 00       	call   801ef0 <_panic>
+
+00800b91 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  800b91:	55                   	push   %ebp
+  800b92:	89 e5                	mov    %esp,%ebp
+  800b94:	57                   	push   %edi
+  800b95:	56                   	push   %esi
+  800b96:	53                   	push   %ebx
+  800b97:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800b9a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b9f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ba2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ba5:	b8 06 00 00 00       	mov    $0x6,%eax
+  800baa:	89 df                	mov    %ebx,%edi
+  800bac:	89 de                	mov    %ebx,%esi
+  800bae:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800bb0:	85 c0                	test   %eax,%eax
+  800bb2:	7f 08                	jg     800bbc <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800bb4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bb7:	5b                   	pop    %ebx
+  800bb8:	5e                   	pop    %esi
+  800bb9:	5f                   	pop    %edi
+  800bba:	5d                   	pop    %ebp
+  800bbb:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800bbc:	83 ec 0c             	sub    $0xc,%esp
+  800bbf:	50                   	push   %eax
+  800bc0:	6a 06                	push   $0x6
+  800bc2:	68 63 28 80 00       	push   $0x802863
+  800bc7:	6a 3e                	push   $0x3e
+  800bc9:	68 80 28 80 00       	push   $0x802880
+  800bce:	e8 1d 13 00 00       	call   801ef0 <_panic>
+
+00800bd3 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800bd3:	55                   	push   %ebp
+  800bd4:	89 e5                	mov    %esp,%ebp
+  800bd6:	57                   	push   %edi
+  800bd7:	56                   	push   %esi
+  800bd8:	53                   	push   %ebx
+  800bd9:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800bdc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800be1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800be4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800be7:	b8 08 00 00 00       	mov    $0x8,%eax
+  800bec:	89 df                	mov    %ebx,%edi
+  800bee:	89 de                	mov    %ebx,%esi
+  800bf0:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800bf2:	85 c0                	test   %eax,%eax
+  800bf4:	7f 08                	jg     800bfe <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800bf6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bf9:	5b                   	pop    %ebx
+  800bfa:	5e                   	pop    %esi
+  800bfb:	5f                   	pop    %edi
+  800bfc:	5d                   	pop    %ebp
+  800bfd:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800bfe:	83 ec 0c             	sub    $0xc,%esp
+  800c01:	50                   	push   %eax
+  800c02:	6a 08                	push   $0x8
+  800c04:	68 63 28 80 00       	push   $0x802863
+  800c09:	6a 3e                	push   $0x3e
+  800c0b:	68 80 28 80 00       	push   $0x802880
+  800c10:	e8 db 12 00 00       	call   801ef0 <_panic>
+
+00800c15 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800c15:	55                   	push   %ebp
+  800c16:	89 e5                	mov    %esp,%ebp
+  800c18:	57                   	push   %edi
+  800c19:	56                   	push   %esi
+  800c1a:	53                   	push   %ebx
+  800c1b:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c1e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c23:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c26:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c29:	b8 09 00 00 00       	mov    $0x9,%eax
+  800c2e:	89 df                	mov    %ebx,%edi
+  800c30:	89 de                	mov    %ebx,%esi
+  800c32:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c34:	85 c0                	test   %eax,%eax
+  800c36:	7f 08                	jg     800c40 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800c38:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c3b:	5b                   	pop    %ebx
+  800c3c:	5e                   	pop    %esi
+  800c3d:	5f                   	pop    %edi
+  800c3e:	5d                   	pop    %ebp
+  800c3f:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c40:	83 ec 0c             	sub    $0xc,%esp
+  800c43:	50                   	push   %eax
+  800c44:	6a 09                	push   $0x9
+  800c46:	68 63 28 80 00       	push   $0x802863
+  800c4b:	6a 3e                	push   $0x3e
+  800c4d:	68 80 28 80 00       	push   $0x802880
+  800c52:	e8 99 12 00 00       	call   801ef0 <_panic>
+
+00800c57 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800c57:	55                   	push   %ebp
+  800c58:	89 e5                	mov    %esp,%ebp
+  800c5a:	57                   	push   %edi
+  800c5b:	56                   	push   %esi
+  800c5c:	53                   	push   %ebx
+  800c5d:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c60:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c65:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c68:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c6b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c70:	89 df                	mov    %ebx,%edi
+  800c72:	89 de                	mov    %ebx,%esi
+  800c74:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c76:	85 c0                	test   %eax,%eax
+  800c78:	7f 08                	jg     800c82 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800c7a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c7d:	5b                   	pop    %ebx
+  800c7e:	5e                   	pop    %esi
+  800c7f:	5f                   	pop    %edi
+  800c80:	5d                   	pop    %ebp
+  800c81:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c82:	83 ec 0c             	sub    $0xc,%esp
+  800c85:	50                   	push   %eax
+  800c86:	6a 0a                	push   $0xa
+  800c88:	68 63 28 80 00       	push   $0x802863
+  800c8d:	6a 3e                	push   $0x3e
+  800c8f:	68 80 28 80 00       	push   $0x802880
+  800c94:	e8 57 12 00 00       	call   801ef0 <_panic>
+
+00800c99 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  800c99:	55                   	push   %ebp
+  800c9a:	89 e5                	mov    %esp,%ebp
+  800c9c:	57                   	push   %edi
+  800c9d:	56                   	push   %esi
+  800c9e:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800c9f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ca2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ca5:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800caa:	be 00 00 00 00       	mov    $0x0,%esi
+  800caf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cb2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800cb5:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800cb7:	5b                   	pop    %ebx
+  800cb8:	5e                   	pop    %esi
+  800cb9:	5f                   	pop    %edi
+  800cba:	5d                   	pop    %ebp
+  800cbb:	c3                   	ret
+
+00800cbc <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  800cbc:	55                   	push   %ebp
+  800cbd:	89 e5                	mov    %esp,%ebp
+  800cbf:	57                   	push   %edi
+  800cc0:	56                   	push   %esi
+  800cc1:	53                   	push   %ebx
+  800cc2:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800cc5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cca:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ccd:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800cd2:	89 cb                	mov    %ecx,%ebx
+  800cd4:	89 cf                	mov    %ecx,%edi
+  800cd6:	89 ce                	mov    %ecx,%esi
+  800cd8:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800cda:	85 c0                	test   %eax,%eax
+  800cdc:	7f 08                	jg     800ce6 <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  800cde:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ce1:	5b                   	pop    %ebx
+  800ce2:	5e                   	pop    %esi
+  800ce3:	5f                   	pop    %edi
+  800ce4:	5d                   	pop    %ebp
+  800ce5:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ce6:	83 ec 0c             	sub    $0xc,%esp
+  800ce9:	50                   	push   %eax
+  800cea:	6a 0d                	push   $0xd
+  800cec:	68 63 28 80 00       	push   $0x802863
+  800cf1:	6a 3e                	push   $0x3e
+  800cf3:	68 80 28 80 00       	push   $0x802880
+  800cf8:	e8 f3 11 00 00       	call   801ef0 <_panic>
+
+00800cfd <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  800cfd:	55                   	push   %ebp
+  800cfe:	89 e5                	mov    %esp,%ebp
+  800d00:	57                   	push   %edi
+  800d01:	56                   	push   %esi
+  800d02:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d03:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d08:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d0b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d0e:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800d13:	89 df                	mov    %ebx,%edi
+  800d15:	89 de                	mov    %ebx,%esi
+  800d17:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  800d19:	5b                   	pop    %ebx
+  800d1a:	5e                   	pop    %esi
+  800d1b:	5f                   	pop    %edi
+  800d1c:	5d                   	pop    %ebp
+  800d1d:	c3                   	ret
+
+00800d1e <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  800d1e:	55                   	push   %ebp
+  800d1f:	89 e5                	mov    %esp,%ebp
+  800d21:	57                   	push   %edi
+  800d22:	56                   	push   %esi
+  800d23:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d24:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d29:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d2c:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800d31:	89 cb                	mov    %ecx,%ebx
+  800d33:	89 cf                	mov    %ecx,%edi
+  800d35:	89 ce                	mov    %ecx,%esi
+  800d37:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  800d39:	5b                   	pop    %ebx
+  800d3a:	5e                   	pop    %esi
+  800d3b:	5f                   	pop    %edi
+  800d3c:	5d                   	pop    %ebp
+  800d3d:	c3                   	ret
+
+00800d3e <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  800d3e:	55                   	push   %ebp
+  800d3f:	89 e5                	mov    %esp,%ebp
+  800d41:	57                   	push   %edi
+  800d42:	56                   	push   %esi
+  800d43:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d44:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d49:	b8 10 00 00 00       	mov    $0x10,%eax
+  800d4e:	89 d1                	mov    %edx,%ecx
+  800d50:	89 d3                	mov    %edx,%ebx
+  800d52:	89 d7                	mov    %edx,%edi
+  800d54:	89 d6                	mov    %edx,%esi
+  800d56:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800d58:	5b                   	pop    %ebx
+  800d59:	5e                   	pop    %esi
+  800d5a:	5f                   	pop    %edi
+  800d5b:	5d                   	pop    %ebp
+  800d5c:	c3                   	ret
+
+00800d5d <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  800d5d:	55                   	push   %ebp
+  800d5e:	89 e5                	mov    %esp,%ebp
+  800d60:	57                   	push   %edi
+  800d61:	56                   	push   %esi
+  800d62:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d63:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d68:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d6b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d6e:	b8 11 00 00 00       	mov    $0x11,%eax
+  800d73:	89 df                	mov    %ebx,%edi
+  800d75:	89 de                	mov    %ebx,%esi
+  800d77:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800d79:	5b                   	pop    %ebx
+  800d7a:	5e                   	pop    %esi
+  800d7b:	5f                   	pop    %edi
+  800d7c:	5d                   	pop    %ebp
+  800d7d:	c3                   	ret
+
+00800d7e <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  800d7e:	55                   	push   %ebp
+  800d7f:	89 e5                	mov    %esp,%ebp
+  800d81:	57                   	push   %edi
+  800d82:	56                   	push   %esi
+  800d83:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d84:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d89:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d8c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d8f:	b8 12 00 00 00       	mov    $0x12,%eax
+  800d94:	89 df                	mov    %ebx,%edi
+  800d96:	89 de                	mov    %ebx,%esi
+  800d98:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800d9a:	5b                   	pop    %ebx
+  800d9b:	5e                   	pop    %esi
+  800d9c:	5f                   	pop    %edi
+  800d9d:	5d                   	pop    %ebp
+  800d9e:	c3                   	ret
+
+00800d9f <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  800d9f:	55                   	push   %ebp
+  800da0:	89 e5                	mov    %esp,%ebp
+  800da2:	57                   	push   %edi
+  800da3:	56                   	push   %esi
+  800da4:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800da5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800daa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dad:	b8 13 00 00 00       	mov    $0x13,%eax
+  800db2:	89 cb                	mov    %ecx,%ebx
+  800db4:	89 cf                	mov    %ecx,%edi
+  800db6:	89 ce                	mov    %ecx,%esi
+  800db8:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  800dba:	5b                   	pop    %ebx
+  800dbb:	5e                   	pop    %esi
+  800dbc:	5f                   	pop    %edi
+  800dbd:	5d                   	pop    %ebp
+  800dbe:	c3                   	ret
+
+00800dbf <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  800dbf:	55                   	push   %ebp
+  800dc0:	89 e5                	mov    %esp,%ebp
+  800dc2:	57                   	push   %edi
+  800dc3:	56                   	push   %esi
+  800dc4:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800dc5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dca:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dcd:	b8 14 00 00 00       	mov    $0x14,%eax
+  800dd2:	89 cb                	mov    %ecx,%ebx
+  800dd4:	89 cf                	mov    %ecx,%edi
+  800dd6:	89 ce                	mov    %ecx,%esi
+  800dd8:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  800dda:	5b                   	pop    %ebx
+  800ddb:	5e                   	pop    %esi
+  800ddc:	5f                   	pop    %edi
+  800ddd:	5d                   	pop    %ebp
+  800dde:	c3                   	ret
+
+00800ddf <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800ddf:	55                   	push   %ebp
+  800de0:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800de2:	8b 45 08             	mov    0x8(%ebp),%eax
+  800de5:	05 00 00 00 30       	add    $0x30000000,%eax
+  800dea:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800ded:	5d                   	pop    %ebp
+  800dee:	c3                   	ret
+
+00800def <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800def:	55                   	push   %ebp
+  800df0:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800df2:	8b 45 08             	mov    0x8(%ebp),%eax
+  800df5:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800dfa:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800dff:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800e04:	5d                   	pop    %ebp
+  800e05:	c3                   	ret
+
+00800e06 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800e06:	55                   	push   %ebp
+  800e07:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  800e09:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800e0e:	eb 02                	jmp    800e12 <fd_alloc+0xc>
+  800e10:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800e12:	89 c2                	mov    %eax,%edx
+  800e14:	c1 ea 16             	shr    $0x16,%edx
+  800e17:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800e1e:	f6 c2 01             	test   $0x1,%dl
+  800e21:	74 2b                	je     800e4e <fd_alloc+0x48>
+  800e23:	89 c2                	mov    %eax,%edx
+  800e25:	c1 ea 0c             	shr    $0xc,%edx
+  800e28:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  800e2f:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  800e35:	f6 c1 01             	test   $0x1,%cl
+  800e38:	74 14                	je     800e4e <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  800e3a:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  800e40:	75 ce                	jne    800e10 <fd_alloc+0xa>
+  800e42:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  800e47:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800e4c:	eb 05                	jmp    800e53 <fd_alloc+0x4d>
+			return 0;
+  800e4e:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  800e53:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e56:	89 02                	mov    %eax,(%edx)
+}
+  800e58:	89 c8                	mov    %ecx,%eax
+  800e5a:	5d                   	pop    %ebp
+  800e5b:	c3                   	ret
+
+00800e5c <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  800e5c:	55                   	push   %ebp
+  800e5d:	89 e5                	mov    %esp,%ebp
+  800e5f:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  800e62:	83 f8 1f             	cmp    $0x1f,%eax
+  800e65:	77 30                	ja     800e97 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  800e67:	c1 e0 0c             	shl    $0xc,%eax
+  800e6a:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800e6f:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  800e75:	f6 c2 01             	test   $0x1,%dl
+  800e78:	74 24                	je     800e9e <fd_lookup+0x42>
+  800e7a:	89 c2                	mov    %eax,%edx
+  800e7c:	c1 ea 0c             	shr    $0xc,%edx
+  800e7f:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800e86:	f6 c2 01             	test   $0x1,%dl
+  800e89:	74 1a                	je     800ea5 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  800e8b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800e8e:	89 02                	mov    %eax,(%edx)
+	return 0;
+  800e90:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e95:	5d                   	pop    %ebp
+  800e96:	c3                   	ret
+		return -E_INVAL;
+  800e97:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e9c:	eb f7                	jmp    800e95 <fd_lookup+0x39>
+		return -E_INVAL;
+  800e9e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ea3:	eb f0                	jmp    800e95 <fd_lookup+0x39>
+  800ea5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800eaa:	eb e9                	jmp    800e95 <fd_lookup+0x39>
+
+00800eac <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  800eac:	55                   	push   %ebp
+  800ead:	89 e5                	mov    %esp,%ebp
+  800eaf:	53                   	push   %ebx
+  800eb0:	83 ec 04             	sub    $0x4,%esp
+  800eb3:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  800eb6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ebb:	eb 03                	jmp    800ec0 <dev_lookup+0x14>
+  800ebd:	83 c0 01             	add    $0x1,%eax
+  800ec0:	8b 1c 85 0c 29 80 00 	mov    0x80290c(,%eax,4),%ebx
+  800ec7:	85 db                	test   %ebx,%ebx
+  800ec9:	74 0b                	je     800ed6 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  800ecb:	39 13                	cmp    %edx,(%ebx)
+  800ecd:	75 ee                	jne    800ebd <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  800ecf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ed4:	eb 1f                	jmp    800ef5 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800ed6:	a1 08 40 80 00       	mov    0x804008,%eax
+  800edb:	8b 40 48             	mov    0x48(%eax),%eax
+  800ede:	83 ec 04             	sub    $0x4,%esp
+  800ee1:	52                   	push   %edx
+  800ee2:	50                   	push   %eax
+  800ee3:	68 90 28 80 00       	push   $0x802890
+  800ee8:	e8 7a f2 ff ff       	call   800167 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  800eed:	83 c4 10             	add    $0x10,%esp
+  800ef0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  800ef5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ef8:	89 1a                	mov    %ebx,(%edx)
+}
+  800efa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800efd:	c9                   	leave
+  800efe:	c3                   	ret
+
+00800eff <fd_close>:
+{
+  800eff:	55                   	push   %ebp
+  800f00:	89 e5                	mov    %esp,%ebp
+  800f02:	57                   	push   %edi
+  800f03:	56                   	push   %esi
+  800f04:	53                   	push   %ebx
+  800f05:	83 ec 24             	sub    $0x24,%esp
+  800f08:	8b 75 08             	mov    0x8(%ebp),%esi
+  800f0b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800f0e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800f11:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800f12:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800f18:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800f1b:	50                   	push   %eax
+  800f1c:	e8 3b ff ff ff       	call   800e5c <fd_lookup>
+  800f21:	89 c3                	mov    %eax,%ebx
+  800f23:	83 c4 10             	add    $0x10,%esp
+  800f26:	85 c0                	test   %eax,%eax
+  800f28:	78 05                	js     800f2f <fd_close+0x30>
+	    || fd != fd2)
+  800f2a:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  800f2d:	74 16                	je     800f45 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  800f2f:	89 f8                	mov    %edi,%eax
+  800f31:	84 c0                	test   %al,%al
+  800f33:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f38:	0f 44 d8             	cmove  %eax,%ebx
+}
+  800f3b:	89 d8                	mov    %ebx,%eax
+  800f3d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f40:	5b                   	pop    %ebx
+  800f41:	5e                   	pop    %esi
+  800f42:	5f                   	pop    %edi
+  800f43:	5d                   	pop    %ebp
+  800f44:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800f45:	83 ec 08             	sub    $0x8,%esp
+  800f48:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800f4b:	50                   	push   %eax
+  800f4c:	ff 36                	push   (%esi)
+  800f4e:	e8 59 ff ff ff       	call   800eac <dev_lookup>
+  800f53:	89 c3                	mov    %eax,%ebx
+  800f55:	83 c4 10             	add    $0x10,%esp
+  800f58:	85 c0                	test   %eax,%eax
+  800f5a:	78 1a                	js     800f76 <fd_close+0x77>
+		if (dev->dev_close)
+  800f5c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800f5f:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  800f62:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  800f67:	85 c0                	test   %eax,%eax
+  800f69:	74 0b                	je     800f76 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  800f6b:	83 ec 0c             	sub    $0xc,%esp
+  800f6e:	56                   	push   %esi
+  800f6f:	ff d0                	call   *%eax
+  800f71:	89 c3                	mov    %eax,%ebx
+  800f73:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  800f76:	83 ec 08             	sub    $0x8,%esp
+  800f79:	56                   	push   %esi
+  800f7a:	6a 00                	push   $0x0
+  800f7c:	e8 10 fc ff ff       	call   800b91 <sys_page_unmap>
+	return r;
+  800f81:	83 c4 10             	add    $0x10,%esp
+  800f84:	eb b5                	jmp    800f3b <fd_close+0x3c>
+
+00800f86 <close>:
+
+int
+close(int fdnum)
+{
+  800f86:	55                   	push   %ebp
+  800f87:	89 e5                	mov    %esp,%ebp
+  800f89:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800f8c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800f8f:	50                   	push   %eax
+  800f90:	ff 75 08             	push   0x8(%ebp)
+  800f93:	e8 c4 fe ff ff       	call   800e5c <fd_lookup>
+  800f98:	83 c4 10             	add    $0x10,%esp
+  800f9b:	85 c0                	test   %eax,%eax
+  800f9d:	79 02                	jns    800fa1 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  800f9f:	c9                   	leave
+  800fa0:	c3                   	ret
+		return fd_close(fd, 1);
+  800fa1:	83 ec 08             	sub    $0x8,%esp
+  800fa4:	6a 01                	push   $0x1
+  800fa6:	ff 75 f4             	push   -0xc(%ebp)
+  800fa9:	e8 51 ff ff ff       	call   800eff <fd_close>
+  800fae:	83 c4 10             	add    $0x10,%esp
+  800fb1:	eb ec                	jmp    800f9f <close+0x19>
+
+00800fb3 <close_all>:
+
+void
+close_all(void)
+{
+  800fb3:	55                   	push   %ebp
+  800fb4:	89 e5                	mov    %esp,%ebp
+  800fb6:	53                   	push   %ebx
+  800fb7:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  800fba:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  800fbf:	83 ec 0c             	sub    $0xc,%esp
+  800fc2:	53                   	push   %ebx
+  800fc3:	e8 be ff ff ff       	call   800f86 <close>
+	for (i = 0; i < MAXFD; i++)
+  800fc8:	83 c3 01             	add    $0x1,%ebx
+  800fcb:	83 c4 10             	add    $0x10,%esp
+  800fce:	83 fb 20             	cmp    $0x20,%ebx
+  800fd1:	75 ec                	jne    800fbf <close_all+0xc>
+}
+  800fd3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800fd6:	c9                   	leave
+  800fd7:	c3                   	ret
+
+00800fd8 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  800fd8:	55                   	push   %ebp
+  800fd9:	89 e5                	mov    %esp,%ebp
+  800fdb:	57                   	push   %edi
+  800fdc:	56                   	push   %esi
+  800fdd:	53                   	push   %ebx
+  800fde:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800fe1:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800fe4:	50                   	push   %eax
+  800fe5:	ff 75 08             	push   0x8(%ebp)
+  800fe8:	e8 6f fe ff ff       	call   800e5c <fd_lookup>
+  800fed:	89 c3                	mov    %eax,%ebx
+  800fef:	83 c4 10             	add    $0x10,%esp
+  800ff2:	85 c0                	test   %eax,%eax
+  800ff4:	78 7f                	js     801075 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  800ff6:	83 ec 0c             	sub    $0xc,%esp
+  800ff9:	ff 75 0c             	push   0xc(%ebp)
+  800ffc:	e8 85 ff ff ff       	call   800f86 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801001:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801004:	c1 e6 0c             	shl    $0xc,%esi
+  801007:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80100d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801010:	89 3c 24             	mov    %edi,(%esp)
+  801013:	e8 d7 fd ff ff       	call   800def <fd2data>
+  801018:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80101a:	89 34 24             	mov    %esi,(%esp)
+  80101d:	e8 cd fd ff ff       	call   800def <fd2data>
+  801022:	83 c4 10             	add    $0x10,%esp
+  801025:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801028:	89 d8                	mov    %ebx,%eax
+  80102a:	c1 e8 16             	shr    $0x16,%eax
+  80102d:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801034:	a8 01                	test   $0x1,%al
+  801036:	74 11                	je     801049 <dup+0x71>
+  801038:	89 d8                	mov    %ebx,%eax
+  80103a:	c1 e8 0c             	shr    $0xc,%eax
+  80103d:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801044:	f6 c2 01             	test   $0x1,%dl
+  801047:	75 36                	jne    80107f <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801049:	89 f8                	mov    %edi,%eax
+  80104b:	c1 e8 0c             	shr    $0xc,%eax
+  80104e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801055:	83 ec 0c             	sub    $0xc,%esp
+  801058:	25 07 0e 00 00       	and    $0xe07,%eax
+  80105d:	50                   	push   %eax
+  80105e:	56                   	push   %esi
+  80105f:	6a 00                	push   $0x0
+  801061:	57                   	push   %edi
+  801062:	6a 00                	push   $0x0
+  801064:	e8 e6 fa ff ff       	call   800b4f <sys_page_map>
+  801069:	89 c3                	mov    %eax,%ebx
+  80106b:	83 c4 20             	add    $0x20,%esp
+  80106e:	85 c0                	test   %eax,%eax
+  801070:	78 33                	js     8010a5 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801072:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801075:	89 d8                	mov    %ebx,%eax
+  801077:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80107a:	5b                   	pop    %ebx
+  80107b:	5e                   	pop    %esi
+  80107c:	5f                   	pop    %edi
+  80107d:	5d                   	pop    %ebp
+  80107e:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80107f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801086:	83 ec 0c             	sub    $0xc,%esp
+  801089:	25 07 0e 00 00       	and    $0xe07,%eax
+  80108e:	50                   	push   %eax
+  80108f:	ff 75 d4             	push   -0x2c(%ebp)
+  801092:	6a 00                	push   $0x0
+  801094:	53                   	push   %ebx
+  801095:	6a 00                	push   $0x0
+  801097:	e8 b3 fa ff ff       	call   800b4f <sys_page_map>
+  80109c:	89 c3                	mov    %eax,%ebx
+  80109e:	83 c4 20             	add    $0x20,%esp
+  8010a1:	85 c0                	test   %eax,%eax
+  8010a3:	79 a4                	jns    801049 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8010a5:	83 ec 08             	sub    $0x8,%esp
+  8010a8:	56                   	push   %esi
+  8010a9:	6a 00                	push   $0x0
+  8010ab:	e8 e1 fa ff ff       	call   800b91 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8010b0:	83 c4 08             	add    $0x8,%esp
+  8010b3:	ff 75 d4             	push   -0x2c(%ebp)
+  8010b6:	6a 00                	push   $0x0
+  8010b8:	e8 d4 fa ff ff       	call   800b91 <sys_page_unmap>
+	return r;
+  8010bd:	83 c4 10             	add    $0x10,%esp
+  8010c0:	eb b3                	jmp    801075 <dup+0x9d>
+
+008010c2 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8010c2:	55                   	push   %ebp
+  8010c3:	89 e5                	mov    %esp,%ebp
+  8010c5:	56                   	push   %esi
+  8010c6:	53                   	push   %ebx
+  8010c7:	83 ec 18             	sub    $0x18,%esp
+  8010ca:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8010cd:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8010d0:	50                   	push   %eax
+  8010d1:	56                   	push   %esi
+  8010d2:	e8 85 fd ff ff       	call   800e5c <fd_lookup>
+  8010d7:	83 c4 10             	add    $0x10,%esp
+  8010da:	85 c0                	test   %eax,%eax
+  8010dc:	78 3c                	js     80111a <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8010de:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8010e1:	83 ec 08             	sub    $0x8,%esp
+  8010e4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8010e7:	50                   	push   %eax
+  8010e8:	ff 33                	push   (%ebx)
+  8010ea:	e8 bd fd ff ff       	call   800eac <dev_lookup>
+  8010ef:	83 c4 10             	add    $0x10,%esp
+  8010f2:	85 c0                	test   %eax,%eax
+  8010f4:	78 24                	js     80111a <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8010f6:	8b 43 08             	mov    0x8(%ebx),%eax
+  8010f9:	83 e0 03             	and    $0x3,%eax
+  8010fc:	83 f8 01             	cmp    $0x1,%eax
+  8010ff:	74 20                	je     801121 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801101:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801104:	8b 40 08             	mov    0x8(%eax),%eax
+  801107:	85 c0                	test   %eax,%eax
+  801109:	74 37                	je     801142 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80110b:	83 ec 04             	sub    $0x4,%esp
+  80110e:	ff 75 10             	push   0x10(%ebp)
+  801111:	ff 75 0c             	push   0xc(%ebp)
+  801114:	53                   	push   %ebx
+  801115:	ff d0                	call   *%eax
+  801117:	83 c4 10             	add    $0x10,%esp
+}
+  80111a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80111d:	5b                   	pop    %ebx
+  80111e:	5e                   	pop    %esi
+  80111f:	5d                   	pop    %ebp
+  801120:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801121:	a1 08 40 80 00       	mov    0x804008,%eax
+  801126:	8b 40 48             	mov    0x48(%eax),%eax
+  801129:	83 ec 04             	sub    $0x4,%esp
+  80112c:	56                   	push   %esi
+  80112d:	50                   	push   %eax
+  80112e:	68 d1 28 80 00       	push   $0x8028d1
+  801133:	e8 2f f0 ff ff       	call   800167 <cprintf>
+		return -E_INVAL;
+  801138:	83 c4 10             	add    $0x10,%esp
+  80113b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801140:	eb d8                	jmp    80111a <read+0x58>
+		return -E_NOT_SUPP;
+  801142:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801147:	eb d1                	jmp    80111a <read+0x58>
+
+00801149 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801149:	55                   	push   %ebp
+  80114a:	89 e5                	mov    %esp,%ebp
+  80114c:	57                   	push   %edi
+  80114d:	56                   	push   %esi
+  80114e:	53                   	push   %ebx
+  80114f:	83 ec 0c             	sub    $0xc,%esp
+  801152:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801155:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801158:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80115d:	eb 02                	jmp    801161 <readn+0x18>
+  80115f:	01 c3                	add    %eax,%ebx
+  801161:	39 f3                	cmp    %esi,%ebx
+  801163:	73 21                	jae    801186 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801165:	83 ec 04             	sub    $0x4,%esp
+  801168:	89 f0                	mov    %esi,%eax
+  80116a:	29 d8                	sub    %ebx,%eax
+  80116c:	50                   	push   %eax
+  80116d:	89 d8                	mov    %ebx,%eax
+  80116f:	03 45 0c             	add    0xc(%ebp),%eax
+  801172:	50                   	push   %eax
+  801173:	57                   	push   %edi
+  801174:	e8 49 ff ff ff       	call   8010c2 <read>
+		if (m < 0)
+  801179:	83 c4 10             	add    $0x10,%esp
+  80117c:	85 c0                	test   %eax,%eax
+  80117e:	78 04                	js     801184 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801180:	75 dd                	jne    80115f <readn+0x16>
+  801182:	eb 02                	jmp    801186 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801184:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801186:	89 d8                	mov    %ebx,%eax
+  801188:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80118b:	5b                   	pop    %ebx
+  80118c:	5e                   	pop    %esi
+  80118d:	5f                   	pop    %edi
+  80118e:	5d                   	pop    %ebp
+  80118f:	c3                   	ret
+
+00801190 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801190:	55                   	push   %ebp
+  801191:	89 e5                	mov    %esp,%ebp
+  801193:	56                   	push   %esi
+  801194:	53                   	push   %ebx
+  801195:	83 ec 18             	sub    $0x18,%esp
+  801198:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80119b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80119e:	50                   	push   %eax
+  80119f:	53                   	push   %ebx
+  8011a0:	e8 b7 fc ff ff       	call   800e5c <fd_lookup>
+  8011a5:	83 c4 10             	add    $0x10,%esp
+  8011a8:	85 c0                	test   %eax,%eax
+  8011aa:	78 37                	js     8011e3 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8011ac:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8011af:	83 ec 08             	sub    $0x8,%esp
+  8011b2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8011b5:	50                   	push   %eax
+  8011b6:	ff 36                	push   (%esi)
+  8011b8:	e8 ef fc ff ff       	call   800eac <dev_lookup>
+  8011bd:	83 c4 10             	add    $0x10,%esp
+  8011c0:	85 c0                	test   %eax,%eax
+  8011c2:	78 1f                	js     8011e3 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8011c4:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8011c8:	74 20                	je     8011ea <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8011ca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8011cd:	8b 40 0c             	mov    0xc(%eax),%eax
+  8011d0:	85 c0                	test   %eax,%eax
+  8011d2:	74 37                	je     80120b <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8011d4:	83 ec 04             	sub    $0x4,%esp
+  8011d7:	ff 75 10             	push   0x10(%ebp)
+  8011da:	ff 75 0c             	push   0xc(%ebp)
+  8011dd:	56                   	push   %esi
+  8011de:	ff d0                	call   *%eax
+  8011e0:	83 c4 10             	add    $0x10,%esp
+}
+  8011e3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8011e6:	5b                   	pop    %ebx
+  8011e7:	5e                   	pop    %esi
+  8011e8:	5d                   	pop    %ebp
+  8011e9:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8011ea:	a1 08 40 80 00       	mov    0x804008,%eax
+  8011ef:	8b 40 48             	mov    0x48(%eax),%eax
+  8011f2:	83 ec 04             	sub    $0x4,%esp
+  8011f5:	53                   	push   %ebx
+  8011f6:	50                   	push   %eax
+  8011f7:	68 ed 28 80 00       	push   $0x8028ed
+  8011fc:	e8 66 ef ff ff       	call   800167 <cprintf>
+		return -E_INVAL;
+  801201:	83 c4 10             	add    $0x10,%esp
+  801204:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801209:	eb d8                	jmp    8011e3 <write+0x53>
+		return -E_NOT_SUPP;
+  80120b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801210:	eb d1                	jmp    8011e3 <write+0x53>
+
+00801212 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801212:	55                   	push   %ebp
+  801213:	89 e5                	mov    %esp,%ebp
+  801215:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801218:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80121b:	50                   	push   %eax
+  80121c:	ff 75 08             	push   0x8(%ebp)
+  80121f:	e8 38 fc ff ff       	call   800e5c <fd_lookup>
+  801224:	83 c4 10             	add    $0x10,%esp
+  801227:	85 c0                	test   %eax,%eax
+  801229:	78 0e                	js     801239 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80122b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80122e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801231:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801234:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801239:	c9                   	leave
+  80123a:	c3                   	ret
+
+0080123b <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80123b:	55                   	push   %ebp
+  80123c:	89 e5                	mov    %esp,%ebp
+  80123e:	56                   	push   %esi
+  80123f:	53                   	push   %ebx
+  801240:	83 ec 18             	sub    $0x18,%esp
+  801243:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801246:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801249:	50                   	push   %eax
+  80124a:	53                   	push   %ebx
+  80124b:	e8 0c fc ff ff       	call   800e5c <fd_lookup>
+  801250:	83 c4 10             	add    $0x10,%esp
+  801253:	85 c0                	test   %eax,%eax
+  801255:	78 34                	js     80128b <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801257:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80125a:	83 ec 08             	sub    $0x8,%esp
+  80125d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801260:	50                   	push   %eax
+  801261:	ff 36                	push   (%esi)
+  801263:	e8 44 fc ff ff       	call   800eac <dev_lookup>
+  801268:	83 c4 10             	add    $0x10,%esp
+  80126b:	85 c0                	test   %eax,%eax
+  80126d:	78 1c                	js     80128b <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80126f:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801273:	74 1d                	je     801292 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801275:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801278:	8b 40 18             	mov    0x18(%eax),%eax
+  80127b:	85 c0                	test   %eax,%eax
+  80127d:	74 34                	je     8012b3 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80127f:	83 ec 08             	sub    $0x8,%esp
+  801282:	ff 75 0c             	push   0xc(%ebp)
+  801285:	56                   	push   %esi
+  801286:	ff d0                	call   *%eax
+  801288:	83 c4 10             	add    $0x10,%esp
+}
+  80128b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80128e:	5b                   	pop    %ebx
+  80128f:	5e                   	pop    %esi
+  801290:	5d                   	pop    %ebp
+  801291:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801292:	a1 08 40 80 00       	mov    0x804008,%eax
+  801297:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80129a:	83 ec 04             	sub    $0x4,%esp
+  80129d:	53                   	push   %ebx
+  80129e:	50                   	push   %eax
+  80129f:	68 b0 28 80 00       	push   $0x8028b0
+  8012a4:	e8 be ee ff ff       	call   800167 <cprintf>
+		return -E_INVAL;
+  8012a9:	83 c4 10             	add    $0x10,%esp
+  8012ac:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012b1:	eb d8                	jmp    80128b <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8012b3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8012b8:	eb d1                	jmp    80128b <ftruncate+0x50>
+
+008012ba <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8012ba:	55                   	push   %ebp
+  8012bb:	89 e5                	mov    %esp,%ebp
+  8012bd:	56                   	push   %esi
+  8012be:	53                   	push   %ebx
+  8012bf:	83 ec 18             	sub    $0x18,%esp
+  8012c2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8012c5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8012c8:	50                   	push   %eax
+  8012c9:	ff 75 08             	push   0x8(%ebp)
+  8012cc:	e8 8b fb ff ff       	call   800e5c <fd_lookup>
+  8012d1:	83 c4 10             	add    $0x10,%esp
+  8012d4:	85 c0                	test   %eax,%eax
+  8012d6:	78 49                	js     801321 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8012d8:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8012db:	83 ec 08             	sub    $0x8,%esp
+  8012de:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8012e1:	50                   	push   %eax
+  8012e2:	ff 36                	push   (%esi)
+  8012e4:	e8 c3 fb ff ff       	call   800eac <dev_lookup>
+  8012e9:	83 c4 10             	add    $0x10,%esp
+  8012ec:	85 c0                	test   %eax,%eax
+  8012ee:	78 31                	js     801321 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8012f0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8012f3:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8012f7:	74 2f                	je     801328 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8012f9:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8012fc:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801303:	00 00 00 
+	stat->st_isdir = 0;
+  801306:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80130d:	00 00 00 
+	stat->st_dev = dev;
+  801310:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801316:	83 ec 08             	sub    $0x8,%esp
+  801319:	53                   	push   %ebx
+  80131a:	56                   	push   %esi
+  80131b:	ff 50 14             	call   *0x14(%eax)
+  80131e:	83 c4 10             	add    $0x10,%esp
+}
+  801321:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801324:	5b                   	pop    %ebx
+  801325:	5e                   	pop    %esi
+  801326:	5d                   	pop    %ebp
+  801327:	c3                   	ret
+		return -E_NOT_SUPP;
+  801328:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80132d:	eb f2                	jmp    801321 <fstat+0x67>
+
+0080132f <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80132f:	55                   	push   %ebp
+  801330:	89 e5                	mov    %esp,%ebp
+  801332:	56                   	push   %esi
+  801333:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801334:	83 ec 08             	sub    $0x8,%esp
+  801337:	6a 00                	push   $0x0
+  801339:	ff 75 08             	push   0x8(%ebp)
+  80133c:	e8 e4 01 00 00       	call   801525 <open>
+  801341:	89 c3                	mov    %eax,%ebx
+  801343:	83 c4 10             	add    $0x10,%esp
+  801346:	85 c0                	test   %eax,%eax
+  801348:	78 1b                	js     801365 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80134a:	83 ec 08             	sub    $0x8,%esp
+  80134d:	ff 75 0c             	push   0xc(%ebp)
+  801350:	50                   	push   %eax
+  801351:	e8 64 ff ff ff       	call   8012ba <fstat>
+  801356:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801358:	89 1c 24             	mov    %ebx,(%esp)
+  80135b:	e8 26 fc ff ff       	call   800f86 <close>
+	return r;
+  801360:	83 c4 10             	add    $0x10,%esp
+  801363:	89 f3                	mov    %esi,%ebx
+}
+  801365:	89 d8                	mov    %ebx,%eax
+  801367:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80136a:	5b                   	pop    %ebx
+  80136b:	5e                   	pop    %esi
+  80136c:	5d                   	pop    %ebp
+  80136d:	c3                   	ret
+
+0080136e <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  80136e:	55                   	push   %ebp
+  80136f:	89 e5                	mov    %esp,%ebp
+  801371:	56                   	push   %esi
+  801372:	53                   	push   %ebx
+  801373:	89 c6                	mov    %eax,%esi
+  801375:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  801377:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  80137e:	74 27                	je     8013a7 <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801380:	6a 07                	push   $0x7
+  801382:	68 00 50 80 00       	push   $0x805000
+  801387:	56                   	push   %esi
+  801388:	ff 35 00 40 80 00    	push   0x804000
+  80138e:	e8 17 0c 00 00       	call   801faa <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  801393:	83 c4 0c             	add    $0xc,%esp
+  801396:	6a 00                	push   $0x0
+  801398:	53                   	push   %ebx
+  801399:	6a 00                	push   $0x0
+  80139b:	e8 96 0b 00 00       	call   801f36 <ipc_recv>
+}
+  8013a0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013a3:	5b                   	pop    %ebx
+  8013a4:	5e                   	pop    %esi
+  8013a5:	5d                   	pop    %ebp
+  8013a6:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  8013a7:	83 ec 0c             	sub    $0xc,%esp
+  8013aa:	6a 01                	push   $0x1
+  8013ac:	e8 4d 0c 00 00       	call   801ffe <ipc_find_env>
+  8013b1:	a3 00 40 80 00       	mov    %eax,0x804000
+  8013b6:	83 c4 10             	add    $0x10,%esp
+  8013b9:	eb c5                	jmp    801380 <fsipc+0x12>
+
+008013bb <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8013bb:	55                   	push   %ebp
+  8013bc:	89 e5                	mov    %esp,%ebp
+  8013be:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8013c1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013c4:	8b 40 0c             	mov    0xc(%eax),%eax
+  8013c7:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.set_size.req_size = newsize;
+  8013cc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8013cf:	a3 04 50 80 00       	mov    %eax,0x805004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  8013d4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013d9:	b8 02 00 00 00       	mov    $0x2,%eax
+  8013de:	e8 8b ff ff ff       	call   80136e <fsipc>
+}
+  8013e3:	c9                   	leave
+  8013e4:	c3                   	ret
+
+008013e5 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8013e5:	55                   	push   %ebp
+  8013e6:	89 e5                	mov    %esp,%ebp
+  8013e8:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8013eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013ee:	8b 40 0c             	mov    0xc(%eax),%eax
+  8013f1:	a3 00 50 80 00       	mov    %eax,0x805000
+  return fsipc(FSREQ_FLUSH, NULL);
+  8013f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013fb:	b8 06 00 00 00       	mov    $0x6,%eax
+  801400:	e8 69 ff ff ff       	call   80136e <fsipc>
+}
+  801405:	c9                   	leave
+  801406:	c3                   	ret
+
+00801407 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801407:	55                   	push   %ebp
+  801408:	89 e5                	mov    %esp,%ebp
+  80140a:	53                   	push   %ebx
+  80140b:	83 ec 04             	sub    $0x4,%esp
+  80140e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801411:	8b 45 08             	mov    0x8(%ebp),%eax
+  801414:	8b 40 0c             	mov    0xc(%eax),%eax
+  801417:	a3 00 50 80 00       	mov    %eax,0x805000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80141c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801421:	b8 05 00 00 00       	mov    $0x5,%eax
+  801426:	e8 43 ff ff ff       	call   80136e <fsipc>
+  80142b:	85 c0                	test   %eax,%eax
+  80142d:	78 2c                	js     80145b <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80142f:	83 ec 08             	sub    $0x8,%esp
+  801432:	68 00 50 80 00       	push   $0x805000
+  801437:	53                   	push   %ebx
+  801438:	e8 e3 f2 ff ff       	call   800720 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  80143d:	a1 80 50 80 00       	mov    0x805080,%eax
+  801442:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801448:	a1 84 50 80 00       	mov    0x805084,%eax
+  80144d:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801453:	83 c4 10             	add    $0x10,%esp
+  801456:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80145b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80145e:	c9                   	leave
+  80145f:	c3                   	ret
+
+00801460 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801460:	55                   	push   %ebp
+  801461:	89 e5                	mov    %esp,%ebp
+  801463:	83 ec 0c             	sub    $0xc,%esp
+  801466:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801469:	8b 55 08             	mov    0x8(%ebp),%edx
+  80146c:	8b 52 0c             	mov    0xc(%edx),%edx
+  80146f:	89 15 00 50 80 00    	mov    %edx,0x805000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801475:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  80147a:	39 d0                	cmp    %edx,%eax
+  80147c:	0f 47 c2             	cmova  %edx,%eax
+  80147f:	a3 04 50 80 00       	mov    %eax,0x805004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  801484:	50                   	push   %eax
+  801485:	ff 75 0c             	push   0xc(%ebp)
+  801488:	68 08 50 80 00       	push   $0x805008
+  80148d:	e8 14 f4 ff ff       	call   8008a6 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801492:	ba 00 00 00 00       	mov    $0x0,%edx
+  801497:	b8 04 00 00 00       	mov    $0x4,%eax
+  80149c:	e8 cd fe ff ff       	call   80136e <fsipc>
+}
+  8014a1:	c9                   	leave
+  8014a2:	c3                   	ret
+
+008014a3 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8014a3:	55                   	push   %ebp
+  8014a4:	89 e5                	mov    %esp,%ebp
+  8014a6:	56                   	push   %esi
+  8014a7:	53                   	push   %ebx
+  8014a8:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8014ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014ae:	8b 40 0c             	mov    0xc(%eax),%eax
+  8014b1:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.read.req_n = n;
+  8014b6:	89 35 04 50 80 00    	mov    %esi,0x805004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8014bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014c1:	b8 03 00 00 00       	mov    $0x3,%eax
+  8014c6:	e8 a3 fe ff ff       	call   80136e <fsipc>
+  8014cb:	89 c3                	mov    %eax,%ebx
+  8014cd:	85 c0                	test   %eax,%eax
+  8014cf:	78 1f                	js     8014f0 <devfile_read+0x4d>
+  assert(r <= n);
+  8014d1:	39 c6                	cmp    %eax,%esi
+  8014d3:	72 24                	jb     8014f9 <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  8014d5:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8014da:	7f 33                	jg     80150f <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8014dc:	83 ec 04             	sub    $0x4,%esp
+  8014df:	50                   	push   %eax
+  8014e0:	68 00 50 80 00       	push   $0x805000
+  8014e5:	ff 75 0c             	push   0xc(%ebp)
+  8014e8:	e8 b9 f3 ff ff       	call   8008a6 <memmove>
+  return r;
+  8014ed:	83 c4 10             	add    $0x10,%esp
+}
+  8014f0:	89 d8                	mov    %ebx,%eax
+  8014f2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014f5:	5b                   	pop    %ebx
+  8014f6:	5e                   	pop    %esi
+  8014f7:	5d                   	pop    %ebp
+  8014f8:	c3                   	ret
+  assert(r <= n);
+  8014f9:	68 20 29 80 00       	push   $0x802920
+  8014fe:	68 27 29 80 00       	push   $0x802927
+  801503:	6a 78                	push   $0x78
+  801505:	68 3c 29 80 00       	push   $0x80293c
+  80150a:	e8 e1 09 00 00       	call   801ef0 <_panic>
+  assert(r <= PGSIZE);
+  80150f:	68 47 29 80 00       	push   $0x802947
+  801514:	68 27 29 80 00       	push   $0x802927
+  801519:	6a 79                	push   $0x79
+  80151b:	68 3c 29 80 00       	push   $0x80293c
+  801520:	e8 cb 09 00 00       	call   801ef0 <_panic>
+
+00801525 <open>:
+open(const char *path, int mode) {
+  801525:	55                   	push   %ebp
+  801526:	89 e5                	mov    %esp,%ebp
+  801528:	56                   	push   %esi
+  801529:	53                   	push   %ebx
+  80152a:	83 ec 1c             	sub    $0x1c,%esp
+  80152d:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801530:	56                   	push   %esi
+  801531:	e8 af f1 ff ff       	call   8006e5 <strlen>
+  801536:	83 c4 10             	add    $0x10,%esp
+  801539:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80153e:	7f 6c                	jg     8015ac <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801540:	83 ec 0c             	sub    $0xc,%esp
+  801543:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801546:	50                   	push   %eax
+  801547:	e8 ba f8 ff ff       	call   800e06 <fd_alloc>
+  80154c:	89 c3                	mov    %eax,%ebx
+  80154e:	83 c4 10             	add    $0x10,%esp
+  801551:	85 c0                	test   %eax,%eax
+  801553:	78 3c                	js     801591 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801555:	83 ec 08             	sub    $0x8,%esp
+  801558:	56                   	push   %esi
+  801559:	68 00 50 80 00       	push   $0x805000
+  80155e:	e8 bd f1 ff ff       	call   800720 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801563:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801566:	a3 00 54 80 00       	mov    %eax,0x805400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80156b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80156e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801573:	e8 f6 fd ff ff       	call   80136e <fsipc>
+  801578:	89 c3                	mov    %eax,%ebx
+  80157a:	83 c4 10             	add    $0x10,%esp
+  80157d:	85 c0                	test   %eax,%eax
+  80157f:	78 19                	js     80159a <open+0x75>
+  return fd2num(fd);
+  801581:	83 ec 0c             	sub    $0xc,%esp
+  801584:	ff 75 f4             	push   -0xc(%ebp)
+  801587:	e8 53 f8 ff ff       	call   800ddf <fd2num>
+  80158c:	89 c3                	mov    %eax,%ebx
+  80158e:	83 c4 10             	add    $0x10,%esp
+}
+  801591:	89 d8                	mov    %ebx,%eax
+  801593:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801596:	5b                   	pop    %ebx
+  801597:	5e                   	pop    %esi
+  801598:	5d                   	pop    %ebp
+  801599:	c3                   	ret
+    fd_close(fd, 0);
+  80159a:	83 ec 08             	sub    $0x8,%esp
+  80159d:	6a 00                	push   $0x0
+  80159f:	ff 75 f4             	push   -0xc(%ebp)
+  8015a2:	e8 58 f9 ff ff       	call   800eff <fd_close>
+    return r;
+  8015a7:	83 c4 10             	add    $0x10,%esp
+  8015aa:	eb e5                	jmp    801591 <open+0x6c>
+    return -E_BAD_PATH;
+  8015ac:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8015b1:	eb de                	jmp    801591 <open+0x6c>
+
+008015b3 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  8015b3:	55                   	push   %ebp
+  8015b4:	89 e5                	mov    %esp,%ebp
+  8015b6:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  8015b9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015be:	b8 08 00 00 00       	mov    $0x8,%eax
+  8015c3:	e8 a6 fd ff ff       	call   80136e <fsipc>
+}
+  8015c8:	c9                   	leave
+  8015c9:	c3                   	ret
+
+008015ca <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8015ca:	55                   	push   %ebp
+  8015cb:	89 e5                	mov    %esp,%ebp
+  8015cd:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8015d0:	68 53 29 80 00       	push   $0x802953
+  8015d5:	ff 75 0c             	push   0xc(%ebp)
+  8015d8:	e8 43 f1 ff ff       	call   800720 <strcpy>
+	return 0;
+}
+  8015dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015e2:	c9                   	leave
+  8015e3:	c3                   	ret
+
+008015e4 <devsock_close>:
+{
+  8015e4:	55                   	push   %ebp
+  8015e5:	89 e5                	mov    %esp,%ebp
+  8015e7:	53                   	push   %ebx
+  8015e8:	83 ec 10             	sub    $0x10,%esp
+  8015eb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8015ee:	53                   	push   %ebx
+  8015ef:	e8 49 0a 00 00       	call   80203d <pageref>
+  8015f4:	89 c2                	mov    %eax,%edx
+  8015f6:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8015f9:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8015fe:	83 fa 01             	cmp    $0x1,%edx
+  801601:	74 05                	je     801608 <devsock_close+0x24>
+}
+  801603:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801606:	c9                   	leave
+  801607:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801608:	83 ec 0c             	sub    $0xc,%esp
+  80160b:	ff 73 0c             	push   0xc(%ebx)
+  80160e:	e8 b7 02 00 00       	call   8018ca <nsipc_close>
+  801613:	83 c4 10             	add    $0x10,%esp
+  801616:	eb eb                	jmp    801603 <devsock_close+0x1f>
+
+00801618 <devsock_write>:
+{
+  801618:	55                   	push   %ebp
+  801619:	89 e5                	mov    %esp,%ebp
+  80161b:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  80161e:	6a 00                	push   $0x0
+  801620:	ff 75 10             	push   0x10(%ebp)
+  801623:	ff 75 0c             	push   0xc(%ebp)
+  801626:	8b 45 08             	mov    0x8(%ebp),%eax
+  801629:	ff 70 0c             	push   0xc(%eax)
+  80162c:	e8 79 03 00 00       	call   8019aa <nsipc_send>
+}
+  801631:	c9                   	leave
+  801632:	c3                   	ret
+
+00801633 <devsock_read>:
+{
+  801633:	55                   	push   %ebp
+  801634:	89 e5                	mov    %esp,%ebp
+  801636:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801639:	6a 00                	push   $0x0
+  80163b:	ff 75 10             	push   0x10(%ebp)
+  80163e:	ff 75 0c             	push   0xc(%ebp)
+  801641:	8b 45 08             	mov    0x8(%ebp),%eax
+  801644:	ff 70 0c             	push   0xc(%eax)
+  801647:	e8 ef 02 00 00       	call   80193b <nsipc_recv>
+}
+  80164c:	c9                   	leave
+  80164d:	c3                   	ret
+
+0080164e <fd2sockid>:
+{
+  80164e:	55                   	push   %ebp
+  80164f:	89 e5                	mov    %esp,%ebp
+  801651:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801654:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801657:	52                   	push   %edx
+  801658:	50                   	push   %eax
+  801659:	e8 fe f7 ff ff       	call   800e5c <fd_lookup>
+  80165e:	83 c4 10             	add    $0x10,%esp
+  801661:	85 c0                	test   %eax,%eax
+  801663:	78 10                	js     801675 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801665:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801668:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  80166e:	39 08                	cmp    %ecx,(%eax)
+  801670:	75 05                	jne    801677 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801672:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801675:	c9                   	leave
+  801676:	c3                   	ret
+		return -E_NOT_SUPP;
+  801677:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80167c:	eb f7                	jmp    801675 <fd2sockid+0x27>
+
+0080167e <alloc_sockfd>:
+{
+  80167e:	55                   	push   %ebp
+  80167f:	89 e5                	mov    %esp,%ebp
+  801681:	56                   	push   %esi
+  801682:	53                   	push   %ebx
+  801683:	83 ec 1c             	sub    $0x1c,%esp
+  801686:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801688:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80168b:	50                   	push   %eax
+  80168c:	e8 75 f7 ff ff       	call   800e06 <fd_alloc>
+  801691:	89 c3                	mov    %eax,%ebx
+  801693:	83 c4 10             	add    $0x10,%esp
+  801696:	85 c0                	test   %eax,%eax
+  801698:	78 43                	js     8016dd <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80169a:	83 ec 04             	sub    $0x4,%esp
+  80169d:	68 07 04 00 00       	push   $0x407
+  8016a2:	ff 75 f4             	push   -0xc(%ebp)
+  8016a5:	6a 00                	push   $0x0
+  8016a7:	e8 60 f4 ff ff       	call   800b0c <sys_page_alloc>
+  8016ac:	89 c3                	mov    %eax,%ebx
+  8016ae:	83 c4 10             	add    $0x10,%esp
+  8016b1:	85 c0                	test   %eax,%eax
+  8016b3:	78 28                	js     8016dd <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8016b5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016b8:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  8016be:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8016c0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016c3:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8016ca:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8016cd:	83 ec 0c             	sub    $0xc,%esp
+  8016d0:	50                   	push   %eax
+  8016d1:	e8 09 f7 ff ff       	call   800ddf <fd2num>
+  8016d6:	89 c3                	mov    %eax,%ebx
+  8016d8:	83 c4 10             	add    $0x10,%esp
+  8016db:	eb 0c                	jmp    8016e9 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8016dd:	83 ec 0c             	sub    $0xc,%esp
+  8016e0:	56                   	push   %esi
+  8016e1:	e8 e4 01 00 00       	call   8018ca <nsipc_close>
+		return r;
+  8016e6:	83 c4 10             	add    $0x10,%esp
+}
+  8016e9:	89 d8                	mov    %ebx,%eax
+  8016eb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016ee:	5b                   	pop    %ebx
+  8016ef:	5e                   	pop    %esi
+  8016f0:	5d                   	pop    %ebp
+  8016f1:	c3                   	ret
+
+008016f2 <accept>:
+{
+  8016f2:	55                   	push   %ebp
+  8016f3:	89 e5                	mov    %esp,%ebp
+  8016f5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8016f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016fb:	e8 4e ff ff ff       	call   80164e <fd2sockid>
+  801700:	85 c0                	test   %eax,%eax
+  801702:	78 1b                	js     80171f <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801704:	83 ec 04             	sub    $0x4,%esp
+  801707:	ff 75 10             	push   0x10(%ebp)
+  80170a:	ff 75 0c             	push   0xc(%ebp)
+  80170d:	50                   	push   %eax
+  80170e:	e8 0e 01 00 00       	call   801821 <nsipc_accept>
+  801713:	83 c4 10             	add    $0x10,%esp
+  801716:	85 c0                	test   %eax,%eax
+  801718:	78 05                	js     80171f <accept+0x2d>
+	return alloc_sockfd(r);
+  80171a:	e8 5f ff ff ff       	call   80167e <alloc_sockfd>
+}
+  80171f:	c9                   	leave
+  801720:	c3                   	ret
+
+00801721 <bind>:
+{
+  801721:	55                   	push   %ebp
+  801722:	89 e5                	mov    %esp,%ebp
+  801724:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801727:	8b 45 08             	mov    0x8(%ebp),%eax
+  80172a:	e8 1f ff ff ff       	call   80164e <fd2sockid>
+  80172f:	85 c0                	test   %eax,%eax
+  801731:	78 12                	js     801745 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801733:	83 ec 04             	sub    $0x4,%esp
+  801736:	ff 75 10             	push   0x10(%ebp)
+  801739:	ff 75 0c             	push   0xc(%ebp)
+  80173c:	50                   	push   %eax
+  80173d:	e8 31 01 00 00       	call   801873 <nsipc_bind>
+  801742:	83 c4 10             	add    $0x10,%esp
+}
+  801745:	c9                   	leave
+  801746:	c3                   	ret
+
+00801747 <shutdown>:
+{
+  801747:	55                   	push   %ebp
+  801748:	89 e5                	mov    %esp,%ebp
+  80174a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80174d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801750:	e8 f9 fe ff ff       	call   80164e <fd2sockid>
+  801755:	85 c0                	test   %eax,%eax
+  801757:	78 0f                	js     801768 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801759:	83 ec 08             	sub    $0x8,%esp
+  80175c:	ff 75 0c             	push   0xc(%ebp)
+  80175f:	50                   	push   %eax
+  801760:	e8 43 01 00 00       	call   8018a8 <nsipc_shutdown>
+  801765:	83 c4 10             	add    $0x10,%esp
+}
+  801768:	c9                   	leave
+  801769:	c3                   	ret
+
+0080176a <connect>:
+{
+  80176a:	55                   	push   %ebp
+  80176b:	89 e5                	mov    %esp,%ebp
+  80176d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801770:	8b 45 08             	mov    0x8(%ebp),%eax
+  801773:	e8 d6 fe ff ff       	call   80164e <fd2sockid>
+  801778:	85 c0                	test   %eax,%eax
+  80177a:	78 12                	js     80178e <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  80177c:	83 ec 04             	sub    $0x4,%esp
+  80177f:	ff 75 10             	push   0x10(%ebp)
+  801782:	ff 75 0c             	push   0xc(%ebp)
+  801785:	50                   	push   %eax
+  801786:	e8 59 01 00 00       	call   8018e4 <nsipc_connect>
+  80178b:	83 c4 10             	add    $0x10,%esp
+}
+  80178e:	c9                   	leave
+  80178f:	c3                   	ret
+
+00801790 <listen>:
+{
+  801790:	55                   	push   %ebp
+  801791:	89 e5                	mov    %esp,%ebp
+  801793:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801796:	8b 45 08             	mov    0x8(%ebp),%eax
+  801799:	e8 b0 fe ff ff       	call   80164e <fd2sockid>
+  80179e:	85 c0                	test   %eax,%eax
+  8017a0:	78 0f                	js     8017b1 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8017a2:	83 ec 08             	sub    $0x8,%esp
+  8017a5:	ff 75 0c             	push   0xc(%ebp)
+  8017a8:	50                   	push   %eax
+  8017a9:	e8 6b 01 00 00       	call   801919 <nsipc_listen>
+  8017ae:	83 c4 10             	add    $0x10,%esp
+}
+  8017b1:	c9                   	leave
+  8017b2:	c3                   	ret
+
+008017b3 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8017b3:	55                   	push   %ebp
+  8017b4:	89 e5                	mov    %esp,%ebp
+  8017b6:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8017b9:	ff 75 10             	push   0x10(%ebp)
+  8017bc:	ff 75 0c             	push   0xc(%ebp)
+  8017bf:	ff 75 08             	push   0x8(%ebp)
+  8017c2:	e8 41 02 00 00       	call   801a08 <nsipc_socket>
+  8017c7:	83 c4 10             	add    $0x10,%esp
+  8017ca:	85 c0                	test   %eax,%eax
+  8017cc:	78 05                	js     8017d3 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8017ce:	e8 ab fe ff ff       	call   80167e <alloc_sockfd>
+}
+  8017d3:	c9                   	leave
+  8017d4:	c3                   	ret
+
+008017d5 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8017d5:	55                   	push   %ebp
+  8017d6:	89 e5                	mov    %esp,%ebp
+  8017d8:	53                   	push   %ebx
+  8017d9:	83 ec 04             	sub    $0x4,%esp
+  8017dc:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  8017de:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8017e5:	74 26                	je     80180d <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8017e7:	6a 07                	push   $0x7
+  8017e9:	68 00 60 80 00       	push   $0x806000
+  8017ee:	53                   	push   %ebx
+  8017ef:	ff 35 04 40 80 00    	push   0x804004
+  8017f5:	e8 b0 07 00 00       	call   801faa <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8017fa:	83 c4 0c             	add    $0xc,%esp
+  8017fd:	6a 00                	push   $0x0
+  8017ff:	6a 00                	push   $0x0
+  801801:	6a 00                	push   $0x0
+  801803:	e8 2e 07 00 00       	call   801f36 <ipc_recv>
+}
+  801808:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80180b:	c9                   	leave
+  80180c:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80180d:	83 ec 0c             	sub    $0xc,%esp
+  801810:	6a 02                	push   $0x2
+  801812:	e8 e7 07 00 00       	call   801ffe <ipc_find_env>
+  801817:	a3 04 40 80 00       	mov    %eax,0x804004
+  80181c:	83 c4 10             	add    $0x10,%esp
+  80181f:	eb c6                	jmp    8017e7 <nsipc+0x12>
+
+00801821 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801821:	55                   	push   %ebp
+  801822:	89 e5                	mov    %esp,%ebp
+  801824:	56                   	push   %esi
+  801825:	53                   	push   %ebx
+  801826:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801829:	8b 45 08             	mov    0x8(%ebp),%eax
+  80182c:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801831:	8b 06                	mov    (%esi),%eax
+  801833:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801838:	b8 01 00 00 00       	mov    $0x1,%eax
+  80183d:	e8 93 ff ff ff       	call   8017d5 <nsipc>
+  801842:	89 c3                	mov    %eax,%ebx
+  801844:	85 c0                	test   %eax,%eax
+  801846:	79 09                	jns    801851 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801848:	89 d8                	mov    %ebx,%eax
+  80184a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80184d:	5b                   	pop    %ebx
+  80184e:	5e                   	pop    %esi
+  80184f:	5d                   	pop    %ebp
+  801850:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801851:	83 ec 04             	sub    $0x4,%esp
+  801854:	ff 35 10 60 80 00    	push   0x806010
+  80185a:	68 00 60 80 00       	push   $0x806000
+  80185f:	ff 75 0c             	push   0xc(%ebp)
+  801862:	e8 3f f0 ff ff       	call   8008a6 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801867:	a1 10 60 80 00       	mov    0x806010,%eax
+  80186c:	89 06                	mov    %eax,(%esi)
+  80186e:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801871:	eb d5                	jmp    801848 <nsipc_accept+0x27>
+
+00801873 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801873:	55                   	push   %ebp
+  801874:	89 e5                	mov    %esp,%ebp
+  801876:	53                   	push   %ebx
+  801877:	83 ec 08             	sub    $0x8,%esp
+  80187a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  80187d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801880:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801885:	53                   	push   %ebx
+  801886:	ff 75 0c             	push   0xc(%ebp)
+  801889:	68 04 60 80 00       	push   $0x806004
+  80188e:	e8 13 f0 ff ff       	call   8008a6 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801893:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  801899:	b8 02 00 00 00       	mov    $0x2,%eax
+  80189e:	e8 32 ff ff ff       	call   8017d5 <nsipc>
+}
+  8018a3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018a6:	c9                   	leave
+  8018a7:	c3                   	ret
+
+008018a8 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8018a8:	55                   	push   %ebp
+  8018a9:	89 e5                	mov    %esp,%ebp
+  8018ab:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8018ae:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018b1:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  8018b6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8018b9:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  8018be:	b8 03 00 00 00       	mov    $0x3,%eax
+  8018c3:	e8 0d ff ff ff       	call   8017d5 <nsipc>
+}
+  8018c8:	c9                   	leave
+  8018c9:	c3                   	ret
+
+008018ca <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8018ca:	55                   	push   %ebp
+  8018cb:	89 e5                	mov    %esp,%ebp
+  8018cd:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8018d0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018d3:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  8018d8:	b8 04 00 00 00       	mov    $0x4,%eax
+  8018dd:	e8 f3 fe ff ff       	call   8017d5 <nsipc>
+}
+  8018e2:	c9                   	leave
+  8018e3:	c3                   	ret
+
+008018e4 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8018e4:	55                   	push   %ebp
+  8018e5:	89 e5                	mov    %esp,%ebp
+  8018e7:	53                   	push   %ebx
+  8018e8:	83 ec 08             	sub    $0x8,%esp
+  8018eb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8018ee:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018f1:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8018f6:	53                   	push   %ebx
+  8018f7:	ff 75 0c             	push   0xc(%ebp)
+  8018fa:	68 04 60 80 00       	push   $0x806004
+  8018ff:	e8 a2 ef ff ff       	call   8008a6 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801904:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  80190a:	b8 05 00 00 00       	mov    $0x5,%eax
+  80190f:	e8 c1 fe ff ff       	call   8017d5 <nsipc>
+}
+  801914:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801917:	c9                   	leave
+  801918:	c3                   	ret
+
+00801919 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801919:	55                   	push   %ebp
+  80191a:	89 e5                	mov    %esp,%ebp
+  80191c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  80191f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801922:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  801927:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80192a:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  80192f:	b8 06 00 00 00       	mov    $0x6,%eax
+  801934:	e8 9c fe ff ff       	call   8017d5 <nsipc>
+}
+  801939:	c9                   	leave
+  80193a:	c3                   	ret
+
+0080193b <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  80193b:	55                   	push   %ebp
+  80193c:	89 e5                	mov    %esp,%ebp
+  80193e:	56                   	push   %esi
+  80193f:	53                   	push   %ebx
+  801940:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801943:	8b 45 08             	mov    0x8(%ebp),%eax
+  801946:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  80194b:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  801951:	8b 45 14             	mov    0x14(%ebp),%eax
+  801954:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801959:	b8 07 00 00 00       	mov    $0x7,%eax
+  80195e:	e8 72 fe ff ff       	call   8017d5 <nsipc>
+  801963:	89 c3                	mov    %eax,%ebx
+  801965:	85 c0                	test   %eax,%eax
+  801967:	78 22                	js     80198b <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801969:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80196e:	39 c6                	cmp    %eax,%esi
+  801970:	0f 4e c6             	cmovle %esi,%eax
+  801973:	39 c3                	cmp    %eax,%ebx
+  801975:	7f 1d                	jg     801994 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801977:	83 ec 04             	sub    $0x4,%esp
+  80197a:	53                   	push   %ebx
+  80197b:	68 00 60 80 00       	push   $0x806000
+  801980:	ff 75 0c             	push   0xc(%ebp)
+  801983:	e8 1e ef ff ff       	call   8008a6 <memmove>
+  801988:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  80198b:	89 d8                	mov    %ebx,%eax
+  80198d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801990:	5b                   	pop    %ebx
+  801991:	5e                   	pop    %esi
+  801992:	5d                   	pop    %ebp
+  801993:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801994:	68 5f 29 80 00       	push   $0x80295f
+  801999:	68 27 29 80 00       	push   $0x802927
+  80199e:	6a 62                	push   $0x62
+  8019a0:	68 74 29 80 00       	push   $0x802974
+  8019a5:	e8 46 05 00 00       	call   801ef0 <_panic>
+
+008019aa <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8019aa:	55                   	push   %ebp
+  8019ab:	89 e5                	mov    %esp,%ebp
+  8019ad:	53                   	push   %ebx
+  8019ae:	83 ec 04             	sub    $0x4,%esp
+  8019b1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8019b4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019b7:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  8019bc:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8019c2:	7f 2e                	jg     8019f2 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8019c4:	83 ec 04             	sub    $0x4,%esp
+  8019c7:	53                   	push   %ebx
+  8019c8:	ff 75 0c             	push   0xc(%ebp)
+  8019cb:	68 0c 60 80 00       	push   $0x80600c
+  8019d0:	e8 d1 ee ff ff       	call   8008a6 <memmove>
+	nsipcbuf.send.req_size = size;
+  8019d5:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  8019db:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019de:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  8019e3:	b8 08 00 00 00       	mov    $0x8,%eax
+  8019e8:	e8 e8 fd ff ff       	call   8017d5 <nsipc>
+}
+  8019ed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019f0:	c9                   	leave
+  8019f1:	c3                   	ret
+	assert(size < 1600);
+  8019f2:	68 80 29 80 00       	push   $0x802980
+  8019f7:	68 27 29 80 00       	push   $0x802927
+  8019fc:	6a 6d                	push   $0x6d
+  8019fe:	68 74 29 80 00       	push   $0x802974
+  801a03:	e8 e8 04 00 00       	call   801ef0 <_panic>
+
+00801a08 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801a08:	55                   	push   %ebp
+  801a09:	89 e5                	mov    %esp,%ebp
+  801a0b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801a0e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a11:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  801a16:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a19:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  801a1e:	8b 45 10             	mov    0x10(%ebp),%eax
+  801a21:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  801a26:	b8 09 00 00 00       	mov    $0x9,%eax
+  801a2b:	e8 a5 fd ff ff       	call   8017d5 <nsipc>
+}
+  801a30:	c9                   	leave
+  801a31:	c3                   	ret
+
+00801a32 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801a32:	55                   	push   %ebp
+  801a33:	89 e5                	mov    %esp,%ebp
+  801a35:	56                   	push   %esi
+  801a36:	53                   	push   %ebx
+  801a37:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801a3a:	83 ec 0c             	sub    $0xc,%esp
+  801a3d:	ff 75 08             	push   0x8(%ebp)
+  801a40:	e8 aa f3 ff ff       	call   800def <fd2data>
+  801a45:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801a47:	83 c4 08             	add    $0x8,%esp
+  801a4a:	68 8c 29 80 00       	push   $0x80298c
+  801a4f:	53                   	push   %ebx
+  801a50:	e8 cb ec ff ff       	call   800720 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801a55:	8b 46 04             	mov    0x4(%esi),%eax
+  801a58:	2b 06                	sub    (%esi),%eax
+  801a5a:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  801a60:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801a67:	00 00 00 
+	stat->st_dev = &devpipe;
+  801a6a:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  801a71:	30 80 00 
+	return 0;
+}
+  801a74:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a79:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a7c:	5b                   	pop    %ebx
+  801a7d:	5e                   	pop    %esi
+  801a7e:	5d                   	pop    %ebp
+  801a7f:	c3                   	ret
+
+00801a80 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801a80:	55                   	push   %ebp
+  801a81:	89 e5                	mov    %esp,%ebp
+  801a83:	53                   	push   %ebx
+  801a84:	83 ec 0c             	sub    $0xc,%esp
+  801a87:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801a8a:	53                   	push   %ebx
+  801a8b:	6a 00                	push   $0x0
+  801a8d:	e8 ff f0 ff ff       	call   800b91 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801a92:	89 1c 24             	mov    %ebx,(%esp)
+  801a95:	e8 55 f3 ff ff       	call   800def <fd2data>
+  801a9a:	83 c4 08             	add    $0x8,%esp
+  801a9d:	50                   	push   %eax
+  801a9e:	6a 00                	push   $0x0
+  801aa0:	e8 ec f0 ff ff       	call   800b91 <sys_page_unmap>
+}
+  801aa5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801aa8:	c9                   	leave
+  801aa9:	c3                   	ret
+
+00801aaa <_pipeisclosed>:
+{
+  801aaa:	55                   	push   %ebp
+  801aab:	89 e5                	mov    %esp,%ebp
+  801aad:	57                   	push   %edi
+  801aae:	56                   	push   %esi
+  801aaf:	53                   	push   %ebx
+  801ab0:	83 ec 1c             	sub    $0x1c,%esp
+  801ab3:	89 c7                	mov    %eax,%edi
+  801ab5:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801ab7:	a1 08 40 80 00       	mov    0x804008,%eax
+  801abc:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801abf:	83 ec 0c             	sub    $0xc,%esp
+  801ac2:	57                   	push   %edi
+  801ac3:	e8 75 05 00 00       	call   80203d <pageref>
+  801ac8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801acb:	89 34 24             	mov    %esi,(%esp)
+  801ace:	e8 6a 05 00 00       	call   80203d <pageref>
+		nn = thisenv->env_runs;
+  801ad3:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801ad9:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801adc:	83 c4 10             	add    $0x10,%esp
+  801adf:	39 cb                	cmp    %ecx,%ebx
+  801ae1:	74 1b                	je     801afe <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801ae3:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801ae6:	75 cf                	jne    801ab7 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801ae8:	8b 42 58             	mov    0x58(%edx),%eax
+  801aeb:	6a 01                	push   $0x1
+  801aed:	50                   	push   %eax
+  801aee:	53                   	push   %ebx
+  801aef:	68 93 29 80 00       	push   $0x802993
+  801af4:	e8 6e e6 ff ff       	call   800167 <cprintf>
+  801af9:	83 c4 10             	add    $0x10,%esp
+  801afc:	eb b9                	jmp    801ab7 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801afe:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801b01:	0f 94 c0             	sete   %al
+  801b04:	0f b6 c0             	movzbl %al,%eax
+}
+  801b07:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b0a:	5b                   	pop    %ebx
+  801b0b:	5e                   	pop    %esi
+  801b0c:	5f                   	pop    %edi
+  801b0d:	5d                   	pop    %ebp
+  801b0e:	c3                   	ret
+
+00801b0f <devpipe_write>:
+{
+  801b0f:	55                   	push   %ebp
+  801b10:	89 e5                	mov    %esp,%ebp
+  801b12:	57                   	push   %edi
+  801b13:	56                   	push   %esi
+  801b14:	53                   	push   %ebx
+  801b15:	83 ec 28             	sub    $0x28,%esp
+  801b18:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801b1b:	56                   	push   %esi
+  801b1c:	e8 ce f2 ff ff       	call   800def <fd2data>
+  801b21:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801b23:	83 c4 10             	add    $0x10,%esp
+  801b26:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b2b:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801b2e:	75 09                	jne    801b39 <devpipe_write+0x2a>
+	return i;
+  801b30:	89 f8                	mov    %edi,%eax
+  801b32:	eb 23                	jmp    801b57 <devpipe_write+0x48>
+			sys_yield();
+  801b34:	e8 b4 ef ff ff       	call   800aed <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801b39:	8b 43 04             	mov    0x4(%ebx),%eax
+  801b3c:	8b 0b                	mov    (%ebx),%ecx
+  801b3e:	8d 51 20             	lea    0x20(%ecx),%edx
+  801b41:	39 d0                	cmp    %edx,%eax
+  801b43:	72 1a                	jb     801b5f <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  801b45:	89 da                	mov    %ebx,%edx
+  801b47:	89 f0                	mov    %esi,%eax
+  801b49:	e8 5c ff ff ff       	call   801aaa <_pipeisclosed>
+  801b4e:	85 c0                	test   %eax,%eax
+  801b50:	74 e2                	je     801b34 <devpipe_write+0x25>
+				return 0;
+  801b52:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b57:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b5a:	5b                   	pop    %ebx
+  801b5b:	5e                   	pop    %esi
+  801b5c:	5f                   	pop    %edi
+  801b5d:	5d                   	pop    %ebp
+  801b5e:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801b5f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b62:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801b66:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801b69:	89 c2                	mov    %eax,%edx
+  801b6b:	c1 fa 1f             	sar    $0x1f,%edx
+  801b6e:	89 d1                	mov    %edx,%ecx
+  801b70:	c1 e9 1b             	shr    $0x1b,%ecx
+  801b73:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801b76:	83 e2 1f             	and    $0x1f,%edx
+  801b79:	29 ca                	sub    %ecx,%edx
+  801b7b:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801b7f:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  801b83:	83 c0 01             	add    $0x1,%eax
+  801b86:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  801b89:	83 c7 01             	add    $0x1,%edi
+  801b8c:	eb 9d                	jmp    801b2b <devpipe_write+0x1c>
+
+00801b8e <devpipe_read>:
+{
+  801b8e:	55                   	push   %ebp
+  801b8f:	89 e5                	mov    %esp,%ebp
+  801b91:	57                   	push   %edi
+  801b92:	56                   	push   %esi
+  801b93:	53                   	push   %ebx
+  801b94:	83 ec 18             	sub    $0x18,%esp
+  801b97:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  801b9a:	57                   	push   %edi
+  801b9b:	e8 4f f2 ff ff       	call   800def <fd2data>
+  801ba0:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801ba2:	83 c4 10             	add    $0x10,%esp
+  801ba5:	be 00 00 00 00       	mov    $0x0,%esi
+  801baa:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801bad:	75 13                	jne    801bc2 <devpipe_read+0x34>
+	return i;
+  801baf:	89 f0                	mov    %esi,%eax
+  801bb1:	eb 02                	jmp    801bb5 <devpipe_read+0x27>
+				return i;
+  801bb3:	89 f0                	mov    %esi,%eax
+}
+  801bb5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bb8:	5b                   	pop    %ebx
+  801bb9:	5e                   	pop    %esi
+  801bba:	5f                   	pop    %edi
+  801bbb:	5d                   	pop    %ebp
+  801bbc:	c3                   	ret
+			sys_yield();
+  801bbd:	e8 2b ef ff ff       	call   800aed <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  801bc2:	8b 03                	mov    (%ebx),%eax
+  801bc4:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801bc7:	75 18                	jne    801be1 <devpipe_read+0x53>
+			if (i > 0)
+  801bc9:	85 f6                	test   %esi,%esi
+  801bcb:	75 e6                	jne    801bb3 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  801bcd:	89 da                	mov    %ebx,%edx
+  801bcf:	89 f8                	mov    %edi,%eax
+  801bd1:	e8 d4 fe ff ff       	call   801aaa <_pipeisclosed>
+  801bd6:	85 c0                	test   %eax,%eax
+  801bd8:	74 e3                	je     801bbd <devpipe_read+0x2f>
+				return 0;
+  801bda:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bdf:	eb d4                	jmp    801bb5 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801be1:	99                   	cltd
+  801be2:	c1 ea 1b             	shr    $0x1b,%edx
+  801be5:	01 d0                	add    %edx,%eax
+  801be7:	83 e0 1f             	and    $0x1f,%eax
+  801bea:	29 d0                	sub    %edx,%eax
+  801bec:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801bf1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801bf4:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  801bf7:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  801bfa:	83 c6 01             	add    $0x1,%esi
+  801bfd:	eb ab                	jmp    801baa <devpipe_read+0x1c>
+
+00801bff <pipe>:
+{
+  801bff:	55                   	push   %ebp
+  801c00:	89 e5                	mov    %esp,%ebp
+  801c02:	56                   	push   %esi
+  801c03:	53                   	push   %ebx
+  801c04:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801c07:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c0a:	50                   	push   %eax
+  801c0b:	e8 f6 f1 ff ff       	call   800e06 <fd_alloc>
+  801c10:	89 c3                	mov    %eax,%ebx
+  801c12:	83 c4 10             	add    $0x10,%esp
+  801c15:	85 c0                	test   %eax,%eax
+  801c17:	0f 88 23 01 00 00    	js     801d40 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801c1d:	83 ec 04             	sub    $0x4,%esp
+  801c20:	68 07 04 00 00       	push   $0x407
+  801c25:	ff 75 f4             	push   -0xc(%ebp)
+  801c28:	6a 00                	push   $0x0
+  801c2a:	e8 dd ee ff ff       	call   800b0c <sys_page_alloc>
+  801c2f:	89 c3                	mov    %eax,%ebx
+  801c31:	83 c4 10             	add    $0x10,%esp
+  801c34:	85 c0                	test   %eax,%eax
+  801c36:	0f 88 04 01 00 00    	js     801d40 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801c3c:	83 ec 0c             	sub    $0xc,%esp
+  801c3f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c42:	50                   	push   %eax
+  801c43:	e8 be f1 ff ff       	call   800e06 <fd_alloc>
+  801c48:	89 c3                	mov    %eax,%ebx
+  801c4a:	83 c4 10             	add    $0x10,%esp
+  801c4d:	85 c0                	test   %eax,%eax
+  801c4f:	0f 88 db 00 00 00    	js     801d30 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801c55:	83 ec 04             	sub    $0x4,%esp
+  801c58:	68 07 04 00 00       	push   $0x407
+  801c5d:	ff 75 f0             	push   -0x10(%ebp)
+  801c60:	6a 00                	push   $0x0
+  801c62:	e8 a5 ee ff ff       	call   800b0c <sys_page_alloc>
+  801c67:	89 c3                	mov    %eax,%ebx
+  801c69:	83 c4 10             	add    $0x10,%esp
+  801c6c:	85 c0                	test   %eax,%eax
+  801c6e:	0f 88 bc 00 00 00    	js     801d30 <pipe+0x131>
+	va = fd2data(fd0);
+  801c74:	83 ec 0c             	sub    $0xc,%esp
+  801c77:	ff 75 f4             	push   -0xc(%ebp)
+  801c7a:	e8 70 f1 ff ff       	call   800def <fd2data>
+  801c7f:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801c81:	83 c4 0c             	add    $0xc,%esp
+  801c84:	68 07 04 00 00       	push   $0x407
+  801c89:	50                   	push   %eax
+  801c8a:	6a 00                	push   $0x0
+  801c8c:	e8 7b ee ff ff       	call   800b0c <sys_page_alloc>
+  801c91:	89 c3                	mov    %eax,%ebx
+  801c93:	83 c4 10             	add    $0x10,%esp
+  801c96:	85 c0                	test   %eax,%eax
+  801c98:	0f 88 82 00 00 00    	js     801d20 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801c9e:	83 ec 0c             	sub    $0xc,%esp
+  801ca1:	ff 75 f0             	push   -0x10(%ebp)
+  801ca4:	e8 46 f1 ff ff       	call   800def <fd2data>
+  801ca9:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801cb0:	50                   	push   %eax
+  801cb1:	6a 00                	push   $0x0
+  801cb3:	56                   	push   %esi
+  801cb4:	6a 00                	push   $0x0
+  801cb6:	e8 94 ee ff ff       	call   800b4f <sys_page_map>
+  801cbb:	89 c3                	mov    %eax,%ebx
+  801cbd:	83 c4 20             	add    $0x20,%esp
+  801cc0:	85 c0                	test   %eax,%eax
+  801cc2:	78 4e                	js     801d12 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  801cc4:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  801cc9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801ccc:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  801cce:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801cd1:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  801cd8:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801cdb:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  801cdd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801ce0:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  801ce7:	83 ec 0c             	sub    $0xc,%esp
+  801cea:	ff 75 f4             	push   -0xc(%ebp)
+  801ced:	e8 ed f0 ff ff       	call   800ddf <fd2num>
+  801cf2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801cf5:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  801cf7:	83 c4 04             	add    $0x4,%esp
+  801cfa:	ff 75 f0             	push   -0x10(%ebp)
+  801cfd:	e8 dd f0 ff ff       	call   800ddf <fd2num>
+  801d02:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801d05:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  801d08:	83 c4 10             	add    $0x10,%esp
+  801d0b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d10:	eb 2e                	jmp    801d40 <pipe+0x141>
+	sys_page_unmap(0, va);
+  801d12:	83 ec 08             	sub    $0x8,%esp
+  801d15:	56                   	push   %esi
+  801d16:	6a 00                	push   $0x0
+  801d18:	e8 74 ee ff ff       	call   800b91 <sys_page_unmap>
+  801d1d:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  801d20:	83 ec 08             	sub    $0x8,%esp
+  801d23:	ff 75 f0             	push   -0x10(%ebp)
+  801d26:	6a 00                	push   $0x0
+  801d28:	e8 64 ee ff ff       	call   800b91 <sys_page_unmap>
+  801d2d:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  801d30:	83 ec 08             	sub    $0x8,%esp
+  801d33:	ff 75 f4             	push   -0xc(%ebp)
+  801d36:	6a 00                	push   $0x0
+  801d38:	e8 54 ee ff ff       	call   800b91 <sys_page_unmap>
+  801d3d:	83 c4 10             	add    $0x10,%esp
+}
+  801d40:	89 d8                	mov    %ebx,%eax
+  801d42:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d45:	5b                   	pop    %ebx
+  801d46:	5e                   	pop    %esi
+  801d47:	5d                   	pop    %ebp
+  801d48:	c3                   	ret
+
+00801d49 <pipeisclosed>:
+{
+  801d49:	55                   	push   %ebp
+  801d4a:	89 e5                	mov    %esp,%ebp
+  801d4c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d4f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d52:	50                   	push   %eax
+  801d53:	ff 75 08             	push   0x8(%ebp)
+  801d56:	e8 01 f1 ff ff       	call   800e5c <fd_lookup>
+  801d5b:	83 c4 10             	add    $0x10,%esp
+  801d5e:	85 c0                	test   %eax,%eax
+  801d60:	78 18                	js     801d7a <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  801d62:	83 ec 0c             	sub    $0xc,%esp
+  801d65:	ff 75 f4             	push   -0xc(%ebp)
+  801d68:	e8 82 f0 ff ff       	call   800def <fd2data>
+  801d6d:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  801d6f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d72:	e8 33 fd ff ff       	call   801aaa <_pipeisclosed>
+  801d77:	83 c4 10             	add    $0x10,%esp
+}
+  801d7a:	c9                   	leave
+  801d7b:	c3                   	ret
+
+00801d7c <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  801d7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d81:	c3                   	ret
+
+00801d82 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  801d82:	55                   	push   %ebp
+  801d83:	89 e5                	mov    %esp,%ebp
+  801d85:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  801d88:	68 ab 29 80 00       	push   $0x8029ab
+  801d8d:	ff 75 0c             	push   0xc(%ebp)
+  801d90:	e8 8b e9 ff ff       	call   800720 <strcpy>
+	return 0;
+}
+  801d95:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d9a:	c9                   	leave
+  801d9b:	c3                   	ret
+
+00801d9c <devcons_write>:
+{
+  801d9c:	55                   	push   %ebp
+  801d9d:	89 e5                	mov    %esp,%ebp
+  801d9f:	57                   	push   %edi
+  801da0:	56                   	push   %esi
+  801da1:	53                   	push   %ebx
+  801da2:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  801da8:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  801dad:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  801db3:	eb 2e                	jmp    801de3 <devcons_write+0x47>
+		m = n - tot;
+  801db5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801db8:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  801dba:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801dbf:	39 c3                	cmp    %eax,%ebx
+  801dc1:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  801dc4:	83 ec 04             	sub    $0x4,%esp
+  801dc7:	53                   	push   %ebx
+  801dc8:	89 f0                	mov    %esi,%eax
+  801dca:	03 45 0c             	add    0xc(%ebp),%eax
+  801dcd:	50                   	push   %eax
+  801dce:	57                   	push   %edi
+  801dcf:	e8 d2 ea ff ff       	call   8008a6 <memmove>
+		sys_cputs(buf, m);
+  801dd4:	83 c4 08             	add    $0x8,%esp
+  801dd7:	53                   	push   %ebx
+  801dd8:	57                   	push   %edi
+  801dd9:	e8 72 ec ff ff       	call   800a50 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  801dde:	01 de                	add    %ebx,%esi
+  801de0:	83 c4 10             	add    $0x10,%esp
+  801de3:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801de6:	72 cd                	jb     801db5 <devcons_write+0x19>
+}
+  801de8:	89 f0                	mov    %esi,%eax
+  801dea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ded:	5b                   	pop    %ebx
+  801dee:	5e                   	pop    %esi
+  801def:	5f                   	pop    %edi
+  801df0:	5d                   	pop    %ebp
+  801df1:	c3                   	ret
+
+00801df2 <devcons_read>:
+{
+  801df2:	55                   	push   %ebp
+  801df3:	89 e5                	mov    %esp,%ebp
+  801df5:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  801df8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dfd:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801e01:	75 07                	jne    801e0a <devcons_read+0x18>
+  801e03:	eb 1f                	jmp    801e24 <devcons_read+0x32>
+		sys_yield();
+  801e05:	e8 e3 ec ff ff       	call   800aed <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  801e0a:	e8 5f ec ff ff       	call   800a6e <sys_cgetc>
+  801e0f:	85 c0                	test   %eax,%eax
+  801e11:	74 f2                	je     801e05 <devcons_read+0x13>
+	if (c < 0)
+  801e13:	78 0f                	js     801e24 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  801e15:	83 f8 04             	cmp    $0x4,%eax
+  801e18:	74 0c                	je     801e26 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  801e1a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e1d:	88 02                	mov    %al,(%edx)
+	return 1;
+  801e1f:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  801e24:	c9                   	leave
+  801e25:	c3                   	ret
+		return 0;
+  801e26:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e2b:	eb f7                	jmp    801e24 <devcons_read+0x32>
+
+00801e2d <cputchar>:
+{
+  801e2d:	55                   	push   %ebp
+  801e2e:	89 e5                	mov    %esp,%ebp
+  801e30:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  801e33:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e36:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  801e39:	6a 01                	push   $0x1
+  801e3b:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801e3e:	50                   	push   %eax
+  801e3f:	e8 0c ec ff ff       	call   800a50 <sys_cputs>
+}
+  801e44:	83 c4 10             	add    $0x10,%esp
+  801e47:	c9                   	leave
+  801e48:	c3                   	ret
+
+00801e49 <getchar>:
+{
+  801e49:	55                   	push   %ebp
+  801e4a:	89 e5                	mov    %esp,%ebp
+  801e4c:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  801e4f:	6a 01                	push   $0x1
+  801e51:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801e54:	50                   	push   %eax
+  801e55:	6a 00                	push   $0x0
+  801e57:	e8 66 f2 ff ff       	call   8010c2 <read>
+	if (r < 0)
+  801e5c:	83 c4 10             	add    $0x10,%esp
+  801e5f:	85 c0                	test   %eax,%eax
+  801e61:	78 06                	js     801e69 <getchar+0x20>
+	if (r < 1)
+  801e63:	74 06                	je     801e6b <getchar+0x22>
+	return c;
+  801e65:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  801e69:	c9                   	leave
+  801e6a:	c3                   	ret
+		return -E_EOF;
+  801e6b:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  801e70:	eb f7                	jmp    801e69 <getchar+0x20>
+
+00801e72 <iscons>:
+{
+  801e72:	55                   	push   %ebp
+  801e73:	89 e5                	mov    %esp,%ebp
+  801e75:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801e78:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e7b:	50                   	push   %eax
+  801e7c:	ff 75 08             	push   0x8(%ebp)
+  801e7f:	e8 d8 ef ff ff       	call   800e5c <fd_lookup>
+  801e84:	83 c4 10             	add    $0x10,%esp
+  801e87:	85 c0                	test   %eax,%eax
+  801e89:	78 11                	js     801e9c <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  801e8b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e8e:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  801e94:	39 10                	cmp    %edx,(%eax)
+  801e96:	0f 94 c0             	sete   %al
+  801e99:	0f b6 c0             	movzbl %al,%eax
+}
+  801e9c:	c9                   	leave
+  801e9d:	c3                   	ret
+
+00801e9e <opencons>:
+{
+  801e9e:	55                   	push   %ebp
+  801e9f:	89 e5                	mov    %esp,%ebp
+  801ea1:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  801ea4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ea7:	50                   	push   %eax
+  801ea8:	e8 59 ef ff ff       	call   800e06 <fd_alloc>
+  801ead:	83 c4 10             	add    $0x10,%esp
+  801eb0:	85 c0                	test   %eax,%eax
+  801eb2:	78 3a                	js     801eee <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  801eb4:	83 ec 04             	sub    $0x4,%esp
+  801eb7:	68 07 04 00 00       	push   $0x407
+  801ebc:	ff 75 f4             	push   -0xc(%ebp)
+  801ebf:	6a 00                	push   $0x0
+  801ec1:	e8 46 ec ff ff       	call   800b0c <sys_page_alloc>
+  801ec6:	83 c4 10             	add    $0x10,%esp
+  801ec9:	85 c0                	test   %eax,%eax
+  801ecb:	78 21                	js     801eee <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  801ecd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ed0:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  801ed6:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  801ed8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801edb:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  801ee2:	83 ec 0c             	sub    $0xc,%esp
+  801ee5:	50                   	push   %eax
+  801ee6:	e8 f4 ee ff ff       	call   800ddf <fd2num>
+  801eeb:	83 c4 10             	add    $0x10,%esp
+}
+  801eee:	c9                   	leave
+  801eef:	c3                   	ret
+
+00801ef0 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  801ef0:	55                   	push   %ebp
+  801ef1:	89 e5                	mov    %esp,%ebp
+  801ef3:	56                   	push   %esi
+  801ef4:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  801ef5:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  801ef8:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  801efe:	e8 cb eb ff ff       	call   800ace <sys_getenvid>
+  801f03:	83 ec 0c             	sub    $0xc,%esp
+  801f06:	ff 75 0c             	push   0xc(%ebp)
+  801f09:	ff 75 08             	push   0x8(%ebp)
+  801f0c:	56                   	push   %esi
+  801f0d:	50                   	push   %eax
+  801f0e:	68 b8 29 80 00       	push   $0x8029b8
+  801f13:	e8 4f e2 ff ff       	call   800167 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  801f18:	83 c4 18             	add    $0x18,%esp
+  801f1b:	53                   	push   %ebx
+  801f1c:	ff 75 10             	push   0x10(%ebp)
+  801f1f:	e8 f2 e1 ff ff       	call   800116 <vcprintf>
+	cprintf("\n");
+  801f24:	c7 04 24 a4 29 80 00 	movl   $0x8029a4,(%esp)
+  801f2b:	e8 37 e2 ff ff       	call   800167 <cprintf>
+  801f30:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  801f33:	cc                   	int3
+	while (1)
+  801f34:	eb fd                	jmp    801f33 <_panic+0x43>
+
+00801f36 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  801f36:	55                   	push   %ebp
+  801f37:	89 e5                	mov    %esp,%ebp
+  801f39:	56                   	push   %esi
+  801f3a:	53                   	push   %ebx
+  801f3b:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f3e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f41:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  801f44:	85 c0                	test   %eax,%eax
+  801f46:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801f4b:	0f 44 c2             	cmove  %edx,%eax
+  801f4e:	83 ec 0c             	sub    $0xc,%esp
+  801f51:	50                   	push   %eax
+  801f52:	e8 65 ed ff ff       	call   800cbc <sys_ipc_recv>
+
+  if (from_env_store)
+  801f57:	83 c4 10             	add    $0x10,%esp
+  801f5a:	85 f6                	test   %esi,%esi
+  801f5c:	74 17                	je     801f75 <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  801f5e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f63:	85 c0                	test   %eax,%eax
+  801f65:	75 0c                	jne    801f73 <ipc_recv+0x3d>
+  801f67:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801f6d:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  801f73:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  801f75:	85 db                	test   %ebx,%ebx
+  801f77:	74 2b                	je     801fa4 <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  801f79:	85 c0                	test   %eax,%eax
+  801f7b:	74 0d                	je     801f8a <ipc_recv+0x54>
+  801f7d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  801f83:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f86:	5b                   	pop    %ebx
+  801f87:	5e                   	pop    %esi
+  801f88:	5d                   	pop    %ebp
+  801f89:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  801f8a:	a1 08 40 80 00       	mov    0x804008,%eax
+  801f8f:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  801f95:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  801f97:	a1 08 40 80 00       	mov    0x804008,%eax
+  801f9c:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  801fa2:	eb df                	jmp    801f83 <ipc_recv+0x4d>
+  801fa4:	85 c0                	test   %eax,%eax
+  801fa6:	75 db                	jne    801f83 <ipc_recv+0x4d>
+  801fa8:	eb ed                	jmp    801f97 <ipc_recv+0x61>
+
+00801faa <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  801faa:	55                   	push   %ebp
+  801fab:	89 e5                	mov    %esp,%ebp
+  801fad:	57                   	push   %edi
+  801fae:	56                   	push   %esi
+  801faf:	53                   	push   %ebx
+  801fb0:	83 ec 0c             	sub    $0xc,%esp
+  801fb3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801fb6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801fb9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  801fbc:	85 db                	test   %ebx,%ebx
+  801fbe:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801fc3:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  801fc6:	ff 75 14             	push   0x14(%ebp)
+  801fc9:	53                   	push   %ebx
+  801fca:	56                   	push   %esi
+  801fcb:	57                   	push   %edi
+  801fcc:	e8 c8 ec ff ff       	call   800c99 <sys_ipc_try_send>
+  801fd1:	83 c4 10             	add    $0x10,%esp
+  801fd4:	85 c0                	test   %eax,%eax
+  801fd6:	74 1e                	je     801ff6 <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  801fd8:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801fdb:	75 07                	jne    801fe4 <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  801fdd:	e8 0b eb ff ff       	call   800aed <sys_yield>
+  801fe2:	eb e2                	jmp    801fc6 <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  801fe4:	50                   	push   %eax
+  801fe5:	68 db 29 80 00       	push   $0x8029db
+  801fea:	6a 3c                	push   $0x3c
+  801fec:	68 e8 29 80 00       	push   $0x8029e8
+  801ff1:	e8 fa fe ff ff       	call   801ef0 <_panic>
+  }
+
+#endif
+}
+  801ff6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ff9:	5b                   	pop    %ebx
+  801ffa:	5e                   	pop    %esi
+  801ffb:	5f                   	pop    %edi
+  801ffc:	5d                   	pop    %ebp
+  801ffd:	c3                   	ret
+
+00801ffe <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  801ffe:	55                   	push   %ebp
+  801fff:	89 e5                	mov    %esp,%ebp
+  802001:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  802004:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  802009:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80200c:	c1 e0 04             	shl    $0x4,%eax
+  80200f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802014:	8b 40 50             	mov    0x50(%eax),%eax
+  802017:	39 c8                	cmp    %ecx,%eax
+  802019:	74 12                	je     80202d <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  80201b:	83 c2 01             	add    $0x1,%edx
+  80201e:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802024:	75 e3                	jne    802009 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802026:	b8 00 00 00 00       	mov    $0x0,%eax
+  80202b:	eb 0e                	jmp    80203b <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  80202d:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802030:	c1 e0 04             	shl    $0x4,%eax
+  802033:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802038:	8b 40 48             	mov    0x48(%eax),%eax
+  80203b:	5d                   	pop    %ebp
+  80203c:	c3                   	ret
+
+0080203d <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80203d:	55                   	push   %ebp
+  80203e:	89 e5                	mov    %esp,%ebp
+  802040:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802043:	89 c2                	mov    %eax,%edx
+  802045:	c1 ea 16             	shr    $0x16,%edx
+  802048:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80204f:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802054:	f6 c1 01             	test   $0x1,%cl
+  802057:	74 1c                	je     802075 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  802059:	c1 e8 0c             	shr    $0xc,%eax
+  80205c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802063:	a8 01                	test   $0x1,%al
+  802065:	74 0e                	je     802075 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802067:	c1 e8 0c             	shr    $0xc,%eax
+  80206a:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802071:	ef 
+  802072:	0f b7 d2             	movzwl %dx,%edx
+}
+  802075:	89 d0                	mov    %edx,%eax
+  802077:	5d                   	pop    %ebp
+  802078:	c3                   	ret
+  802079:	66 90                	xchg   %ax,%ax
+  80207b:	66 90                	xchg   %ax,%ax
+  80207d:	66 90                	xchg   %ax,%ax
+  80207f:	90                   	nop
+
+00802080 <__udivmoddi4>:
+  802080:	55                   	push   %ebp
+  802081:	57                   	push   %edi
+  802082:	56                   	push   %esi
+  802083:	53                   	push   %ebx
+  802084:	83 ec 24             	sub    $0x24,%esp
+  802087:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80208b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80208f:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  802093:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802097:	8b 54 24 44          	mov    0x44(%esp),%edx
+  80209b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80209f:	8b 44 24 40          	mov    0x40(%esp),%eax
+  8020a3:	89 d3                	mov    %edx,%ebx
+  8020a5:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8020a9:	09 c3                	or     %eax,%ebx
+  8020ab:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8020af:	0f 84 9c 00 00 00    	je     802151 <__udivmoddi4+0xd1>
+  8020b5:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8020bc:	00 
+  8020bd:	31 c0                	xor    %eax,%eax
+  8020bf:	31 d2                	xor    %edx,%edx
+  8020c1:	89 fb                	mov    %edi,%ebx
+  8020c3:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8020ca:	00 
+  8020cb:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8020d0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8020d4:	01 c0                	add    %eax,%eax
+  8020d6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8020dd:	00 
+  8020de:	89 c6                	mov    %eax,%esi
+  8020e0:	89 d7                	mov    %edx,%edi
+  8020e2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8020e6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8020ea:	0f ad d0             	shrd   %cl,%edx,%eax
+  8020ed:	d3 ea                	shr    %cl,%edx
+  8020ef:	f6 c1 20             	test   $0x20,%cl
+  8020f2:	0f 45 c2             	cmovne %edx,%eax
+  8020f5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8020f9:	83 e0 01             	and    $0x1,%eax
+  8020fc:	09 fa                	or     %edi,%edx
+  8020fe:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802102:	89 04 24             	mov    %eax,(%esp)
+  802105:	8b 04 24             	mov    (%esp),%eax
+  802108:	89 d5                	mov    %edx,%ebp
+  80210a:	09 f0                	or     %esi,%eax
+  80210c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802110:	39 f0                	cmp    %esi,%eax
+  802112:	19 fd                	sbb    %edi,%ebp
+  802114:	72 1d                	jb     802133 <__udivmoddi4+0xb3>
+  802116:	29 f0                	sub    %esi,%eax
+  802118:	19 fa                	sbb    %edi,%edx
+  80211a:	89 cf                	mov    %ecx,%edi
+  80211c:	c1 ef 05             	shr    $0x5,%edi
+  80211f:	83 e7 01             	and    $0x1,%edi
+  802122:	89 fe                	mov    %edi,%esi
+  802124:	d3 e7                	shl    %cl,%edi
+  802126:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80212a:	83 f6 01             	xor    $0x1,%esi
+  80212d:	d3 e6                	shl    %cl,%esi
+  80212f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802133:	83 e9 01             	sub    $0x1,%ecx
+  802136:	73 98                	jae    8020d0 <__udivmoddi4+0x50>
+  802138:	85 db                	test   %ebx,%ebx
+  80213a:	74 05                	je     802141 <__udivmoddi4+0xc1>
+  80213c:	89 03                	mov    %eax,(%ebx)
+  80213e:	89 53 04             	mov    %edx,0x4(%ebx)
+  802141:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802145:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802149:	83 c4 24             	add    $0x24,%esp
+  80214c:	5b                   	pop    %ebx
+  80214d:	5e                   	pop    %esi
+  80214e:	5f                   	pop    %edi
+  80214f:	5d                   	pop    %ebp
+  802150:	c3                   	ret
+  802151:	85 ff                	test   %edi,%edi
+  802153:	74 0d                	je     802162 <__udivmoddi4+0xe2>
+  802155:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  80215b:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  802162:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802166:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80216a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80216e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802172:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802176:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80217a:	83 c4 24             	add    $0x24,%esp
+  80217d:	5b                   	pop    %ebx
+  80217e:	5e                   	pop    %esi
+  80217f:	5f                   	pop    %edi
+  802180:	5d                   	pop    %ebp
+  802181:	c3                   	ret
+  802182:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802189:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00802190 <__udivdi3>:
+  802190:	57                   	push   %edi
+  802191:	56                   	push   %esi
+  802192:	53                   	push   %ebx
+  802193:	83 ec 20             	sub    $0x20,%esp
+  802196:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80219a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80219e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8021a2:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8021a6:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8021aa:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8021ae:	89 d1                	mov    %edx,%ecx
+  8021b0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8021b4:	09 c1                	or     %eax,%ecx
+  8021b6:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8021ba:	89 44 24 18          	mov    %eax,0x18(%esp)
+  8021be:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  8021c2:	0f 84 88 00 00 00    	je     802250 <__udivdi3+0xc0>
+  8021c8:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8021cf:	00 
+  8021d0:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8021d5:	31 c0                	xor    %eax,%eax
+  8021d7:	31 d2                	xor    %edx,%edx
+  8021d9:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8021e0:	00 
+  8021e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8021e8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8021ec:	01 c0                	add    %eax,%eax
+  8021ee:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8021f5:	00 
+  8021f6:	89 c6                	mov    %eax,%esi
+  8021f8:	89 d7                	mov    %edx,%edi
+  8021fa:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8021fe:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802202:	0f ad d0             	shrd   %cl,%edx,%eax
+  802205:	d3 ea                	shr    %cl,%edx
+  802207:	f6 c1 20             	test   $0x20,%cl
+  80220a:	0f 45 c2             	cmovne %edx,%eax
+  80220d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802211:	83 e0 01             	and    $0x1,%eax
+  802214:	09 fa                	or     %edi,%edx
+  802216:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80221a:	89 04 24             	mov    %eax,(%esp)
+  80221d:	8b 04 24             	mov    (%esp),%eax
+  802220:	89 d3                	mov    %edx,%ebx
+  802222:	09 f0                	or     %esi,%eax
+  802224:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802228:	39 f0                	cmp    %esi,%eax
+  80222a:	19 fb                	sbb    %edi,%ebx
+  80222c:	72 1d                	jb     80224b <__udivdi3+0xbb>
+  80222e:	29 f0                	sub    %esi,%eax
+  802230:	19 fa                	sbb    %edi,%edx
+  802232:	89 cf                	mov    %ecx,%edi
+  802234:	c1 ef 05             	shr    $0x5,%edi
+  802237:	83 e7 01             	and    $0x1,%edi
+  80223a:	89 fe                	mov    %edi,%esi
+  80223c:	d3 e7                	shl    %cl,%edi
+  80223e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802242:	83 f6 01             	xor    $0x1,%esi
+  802245:	d3 e6                	shl    %cl,%esi
+  802247:	09 74 24 18          	or     %esi,0x18(%esp)
+  80224b:	83 e9 01             	sub    $0x1,%ecx
+  80224e:	73 98                	jae    8021e8 <__udivdi3+0x58>
+  802250:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802254:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802258:	83 c4 20             	add    $0x20,%esp
+  80225b:	5b                   	pop    %ebx
+  80225c:	5e                   	pop    %esi
+  80225d:	5f                   	pop    %edi
+  80225e:	c3                   	ret
+  80225f:	90                   	nop
+
+00802260 <__umoddi3>:
+  802260:	57                   	push   %edi
+  802261:	56                   	push   %esi
+  802262:	53                   	push   %ebx
+  802263:	83 ec 18             	sub    $0x18,%esp
+  802266:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80226a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80226e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802272:	8b 54 24 34          	mov    0x34(%esp),%edx
+  802276:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80227a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80227e:	89 d1                	mov    %edx,%ecx
+  802280:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802284:	09 c1                	or     %eax,%ecx
+  802286:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80228a:	74 5b                	je     8022e7 <__umoddi3+0x87>
+  80228c:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802291:	31 c0                	xor    %eax,%eax
+  802293:	31 d2                	xor    %edx,%edx
+  802295:	8d 76 00             	lea    0x0(%esi),%esi
+  802298:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80229c:	01 c0                	add    %eax,%eax
+  80229e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8022a5:	00 
+  8022a6:	89 c6                	mov    %eax,%esi
+  8022a8:	89 d7                	mov    %edx,%edi
+  8022aa:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8022ae:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8022b2:	0f ad d0             	shrd   %cl,%edx,%eax
+  8022b5:	d3 ea                	shr    %cl,%edx
+  8022b7:	f6 c1 20             	test   $0x20,%cl
+  8022ba:	0f 45 c2             	cmovne %edx,%eax
+  8022bd:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8022c1:	83 e0 01             	and    $0x1,%eax
+  8022c4:	09 fa                	or     %edi,%edx
+  8022c6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8022ca:	89 04 24             	mov    %eax,(%esp)
+  8022cd:	8b 04 24             	mov    (%esp),%eax
+  8022d0:	89 d3                	mov    %edx,%ebx
+  8022d2:	09 f0                	or     %esi,%eax
+  8022d4:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8022d8:	39 f0                	cmp    %esi,%eax
+  8022da:	19 fb                	sbb    %edi,%ebx
+  8022dc:	72 04                	jb     8022e2 <__umoddi3+0x82>
+  8022de:	29 f0                	sub    %esi,%eax
+  8022e0:	19 fa                	sbb    %edi,%edx
+  8022e2:	83 e9 01             	sub    $0x1,%ecx
+  8022e5:	73 b1                	jae    802298 <__umoddi3+0x38>
+  8022e7:	83 c4 18             	add    $0x18,%esp
+  8022ea:	5b                   	pop    %ebx
+  8022eb:	5e                   	pop    %esi
+  8022ec:	5f                   	pop    %edi
+  8022ed:	c3                   	ret
+  8022ee:	66 90                	xchg   %ax,%ax
+
+008022f0 <__divdi3>:
+  8022f0:	55                   	push   %ebp
+  8022f1:	57                   	push   %edi
+  8022f2:	56                   	push   %esi
+  8022f3:	53                   	push   %ebx
+  8022f4:	83 ec 24             	sub    $0x24,%esp
+  8022f7:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  8022fb:	8b 74 24 44          	mov    0x44(%esp),%esi
+  8022ff:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802303:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802307:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  80230b:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  80230f:	85 d2                	test   %edx,%edx
+  802311:	0f 88 e0 00 00 00    	js     8023f7 <__divdi3+0x107>
+  802317:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  80231b:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  80231f:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802323:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802327:	85 f6                	test   %esi,%esi
+  802329:	78 16                	js     802341 <__divdi3+0x51>
+  80232b:	89 f1                	mov    %esi,%ecx
+  80232d:	31 c0                	xor    %eax,%eax
+  80232f:	31 d2                	xor    %edx,%edx
+  802331:	09 d9                	or     %ebx,%ecx
+  802333:	0f 85 f3 00 00 00    	jne    80242c <__divdi3+0x13c>
+  802339:	83 c4 24             	add    $0x24,%esp
+  80233c:	5b                   	pop    %ebx
+  80233d:	5e                   	pop    %esi
+  80233e:	5f                   	pop    %edi
+  80233f:	5d                   	pop    %ebp
+  802340:	c3                   	ret
+  802341:	bf 01 00 00 00       	mov    $0x1,%edi
+  802346:	f7 5c 24 08          	negl   0x8(%esp)
+  80234a:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  80234f:	f7 5c 24 0c          	negl   0xc(%esp)
+  802353:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80235a:	00 
+  80235b:	31 c0                	xor    %eax,%eax
+  80235d:	31 d2                	xor    %edx,%edx
+  80235f:	89 fb                	mov    %edi,%ebx
+  802361:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802368:	00 
+  802369:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80236e:	66 90                	xchg   %ax,%ax
+  802370:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802374:	01 c0                	add    %eax,%eax
+  802376:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80237d:	00 
+  80237e:	89 c6                	mov    %eax,%esi
+  802380:	89 d7                	mov    %edx,%edi
+  802382:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802386:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80238a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80238d:	d3 ea                	shr    %cl,%edx
+  80238f:	f6 c1 20             	test   $0x20,%cl
+  802392:	0f 45 c2             	cmovne %edx,%eax
+  802395:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802399:	83 e0 01             	and    $0x1,%eax
+  80239c:	09 fa                	or     %edi,%edx
+  80239e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8023a2:	89 04 24             	mov    %eax,(%esp)
+  8023a5:	8b 04 24             	mov    (%esp),%eax
+  8023a8:	89 d5                	mov    %edx,%ebp
+  8023aa:	09 f0                	or     %esi,%eax
+  8023ac:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8023b0:	39 f0                	cmp    %esi,%eax
+  8023b2:	19 fd                	sbb    %edi,%ebp
+  8023b4:	72 1d                	jb     8023d3 <__divdi3+0xe3>
+  8023b6:	29 f0                	sub    %esi,%eax
+  8023b8:	19 fa                	sbb    %edi,%edx
+  8023ba:	89 cf                	mov    %ecx,%edi
+  8023bc:	c1 ef 05             	shr    $0x5,%edi
+  8023bf:	83 e7 01             	and    $0x1,%edi
+  8023c2:	89 fe                	mov    %edi,%esi
+  8023c4:	d3 e7                	shl    %cl,%edi
+  8023c6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8023ca:	83 f6 01             	xor    $0x1,%esi
+  8023cd:	d3 e6                	shl    %cl,%esi
+  8023cf:	09 74 24 18          	or     %esi,0x18(%esp)
+  8023d3:	83 e9 01             	sub    $0x1,%ecx
+  8023d6:	73 98                	jae    802370 <__divdi3+0x80>
+  8023d8:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8023dc:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8023e0:	85 db                	test   %ebx,%ebx
+  8023e2:	0f 84 51 ff ff ff    	je     802339 <__divdi3+0x49>
+  8023e8:	f7 d8                	neg    %eax
+  8023ea:	83 d2 00             	adc    $0x0,%edx
+  8023ed:	83 c4 24             	add    $0x24,%esp
+  8023f0:	5b                   	pop    %ebx
+  8023f1:	f7 da                	neg    %edx
+  8023f3:	5e                   	pop    %esi
+  8023f4:	5f                   	pop    %edi
+  8023f5:	5d                   	pop    %ebp
+  8023f6:	c3                   	ret
+  8023f7:	f7 d8                	neg    %eax
+  8023f9:	83 d2 00             	adc    $0x0,%edx
+  8023fc:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802400:	f7 da                	neg    %edx
+  802402:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802406:	85 f6                	test   %esi,%esi
+  802408:	78 1b                	js     802425 <__divdi3+0x135>
+  80240a:	89 f1                	mov    %esi,%ecx
+  80240c:	31 c0                	xor    %eax,%eax
+  80240e:	31 d2                	xor    %edx,%edx
+  802410:	bf 01 00 00 00       	mov    $0x1,%edi
+  802415:	09 d9                	or     %ebx,%ecx
+  802417:	0f 85 36 ff ff ff    	jne    802353 <__divdi3+0x63>
+  80241d:	83 c4 24             	add    $0x24,%esp
+  802420:	5b                   	pop    %ebx
+  802421:	5e                   	pop    %esi
+  802422:	5f                   	pop    %edi
+  802423:	5d                   	pop    %ebp
+  802424:	c3                   	ret
+  802425:	31 ff                	xor    %edi,%edi
+  802427:	e9 1a ff ff ff       	jmp    802346 <__divdi3+0x56>
+  80242c:	31 ff                	xor    %edi,%edi
+  80242e:	e9 20 ff ff ff       	jmp    802353 <__divdi3+0x63>
+  802433:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80243a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00802440 <__moddi3>:
+  802440:	55                   	push   %ebp
+  802441:	57                   	push   %edi
+  802442:	56                   	push   %esi
+  802443:	53                   	push   %ebx
+  802444:	83 ec 1c             	sub    $0x1c,%esp
+  802447:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  80244b:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  80244f:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  802453:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  802457:	89 c8                	mov    %ecx,%eax
+  802459:	89 f2                	mov    %esi,%edx
+  80245b:	89 f3                	mov    %esi,%ebx
+  80245d:	85 ed                	test   %ebp,%ebp
+  80245f:	0f 88 9d 00 00 00    	js     802502 <__moddi3+0xc2>
+  802465:	09 cb                	or     %ecx,%ebx
+  802467:	0f 84 8d 00 00 00    	je     8024fa <__moddi3+0xba>
+  80246d:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802471:	31 db                	xor    %ebx,%ebx
+  802473:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802477:	89 ca                	mov    %ecx,%edx
+  802479:	89 f0                	mov    %esi,%eax
+  80247b:	89 dd                	mov    %ebx,%ebp
+  80247d:	f7 da                	neg    %edx
+  80247f:	83 d0 00             	adc    $0x0,%eax
+  802482:	f7 d8                	neg    %eax
+  802484:	0f 49 f0             	cmovns %eax,%esi
+  802487:	0f 49 ca             	cmovns %edx,%ecx
+  80248a:	31 c0                	xor    %eax,%eax
+  80248c:	31 d2                	xor    %edx,%edx
+  80248e:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802492:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802496:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80249b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80249f:	90                   	nop
+  8024a0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8024a4:	01 c0                	add    %eax,%eax
+  8024a6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8024ad:	00 
+  8024ae:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  8024b2:	89 c6                	mov    %eax,%esi
+  8024b4:	89 d7                	mov    %edx,%edi
+  8024b6:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8024ba:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8024be:	0f ad d0             	shrd   %cl,%edx,%eax
+  8024c1:	d3 ea                	shr    %cl,%edx
+  8024c3:	f6 c1 20             	test   $0x20,%cl
+  8024c6:	0f 45 c2             	cmovne %edx,%eax
+  8024c9:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8024cd:	83 e0 01             	and    $0x1,%eax
+  8024d0:	09 fa                	or     %edi,%edx
+  8024d2:	89 04 24             	mov    %eax,(%esp)
+  8024d5:	8b 04 24             	mov    (%esp),%eax
+  8024d8:	89 d7                	mov    %edx,%edi
+  8024da:	09 f0                	or     %esi,%eax
+  8024dc:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  8024e0:	39 d8                	cmp    %ebx,%eax
+  8024e2:	19 f7                	sbb    %esi,%edi
+  8024e4:	72 04                	jb     8024ea <__moddi3+0xaa>
+  8024e6:	29 d8                	sub    %ebx,%eax
+  8024e8:	19 f2                	sbb    %esi,%edx
+  8024ea:	83 e9 01             	sub    $0x1,%ecx
+  8024ed:	73 b1                	jae    8024a0 <__moddi3+0x60>
+  8024ef:	85 ed                	test   %ebp,%ebp
+  8024f1:	74 07                	je     8024fa <__moddi3+0xba>
+  8024f3:	f7 d8                	neg    %eax
+  8024f5:	83 d2 00             	adc    $0x0,%edx
+  8024f8:	f7 da                	neg    %edx
+  8024fa:	83 c4 1c             	add    $0x1c,%esp
+  8024fd:	5b                   	pop    %ebx
+  8024fe:	5e                   	pop    %esi
+  8024ff:	5f                   	pop    %edi
+  802500:	5d                   	pop    %ebp
+  802501:	c3                   	ret
+  802502:	09 cb                	or     %ecx,%ebx
+  802504:	74 f4                	je     8024fa <__moddi3+0xba>
+  802506:	f7 df                	neg    %edi
+  802508:	bb 01 00 00 00       	mov    $0x1,%ebx
+  80250d:	83 d5 00             	adc    $0x0,%ebp
+  802510:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802514:	f7 dd                	neg    %ebp
+  802516:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  80251a:	e9 58 ff ff ff       	jmp    802477 <__moddi3+0x37>
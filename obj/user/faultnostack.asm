@@ -0,0 +1,5372 @@
+
+obj/user/faultnostack.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 23 00 00 00       	call   800054 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+void _pgfault_upcall();
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	sys_env_set_pgfault_upcall(0, (void*) _pgfault_upcall);
+  800039:	68 46 04 80 00       	push   $0x800446
+  80003e:	6a 00                	push   $0x0
+  800040:	e8 79 02 00 00       	call   8002be <sys_env_set_pgfault_upcall>
+	*(int*)0 = 0;
+  800045:	c7 05 00 00 00 00 00 	movl   $0x0,0x0
+  80004c:	00 00 00 
+}
+  80004f:	83 c4 10             	add    $0x10,%esp
+  800052:	c9                   	leave
+  800053:	c3                   	ret
+
+00800054 <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  800054:	55                   	push   %ebp
+  800055:	89 e5                	mov    %esp,%ebp
+  800057:	56                   	push   %esi
+  800058:	53                   	push   %ebx
+  800059:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80005c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  80005f:	e8 d1 00 00 00       	call   800135 <sys_getenvid>
+  800064:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800069:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80006c:	c1 e0 04             	shl    $0x4,%eax
+  80006f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800074:	a3 08 40 80 00       	mov    %eax,0x804008
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800079:	85 db                	test   %ebx,%ebx
+  80007b:	7e 07                	jle    800084 <libmain+0x30>
+    binaryname = argv[0];
+  80007d:	8b 06                	mov    (%esi),%eax
+  80007f:	a3 00 30 80 00       	mov    %eax,0x803000
+
+  // call user main routine
+  umain(argc, argv);
+  800084:	83 ec 08             	sub    $0x8,%esp
+  800087:	56                   	push   %esi
+  800088:	53                   	push   %ebx
+  800089:	e8 a5 ff ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  80008e:	e8 0a 00 00 00       	call   80009d <exit>
+}
+  800093:	83 c4 10             	add    $0x10,%esp
+  800096:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800099:	5b                   	pop    %ebx
+  80009a:	5e                   	pop    %esi
+  80009b:	5d                   	pop    %ebp
+  80009c:	c3                   	ret
+
+0080009d <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80009d:	55                   	push   %ebp
+  80009e:	89 e5                	mov    %esp,%ebp
+  8000a0:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8000a3:	e8 96 05 00 00       	call   80063e <close_all>
+	sys_env_destroy(0);
+  8000a8:	83 ec 0c             	sub    $0xc,%esp
+  8000ab:	6a 00                	push   $0x0
+  8000ad:	e8 42 00 00 00       	call   8000f4 <sys_env_destroy>
+}
+  8000b2:	83 c4 10             	add    $0x10,%esp
+  8000b5:	c9                   	leave
+  8000b6:	c3                   	ret
+
+008000b7 <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8000b7:	55                   	push   %ebp
+  8000b8:	89 e5                	mov    %esp,%ebp
+  8000ba:	57                   	push   %edi
+  8000bb:	56                   	push   %esi
+  8000bc:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8000bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000c5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000c8:	89 c3                	mov    %eax,%ebx
+  8000ca:	89 c7                	mov    %eax,%edi
+  8000cc:	89 c6                	mov    %eax,%esi
+  8000ce:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  8000d0:	5b                   	pop    %ebx
+  8000d1:	5e                   	pop    %esi
+  8000d2:	5f                   	pop    %edi
+  8000d3:	5d                   	pop    %ebp
+  8000d4:	c3                   	ret
+
+008000d5 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8000d5:	55                   	push   %ebp
+  8000d6:	89 e5                	mov    %esp,%ebp
+  8000d8:	57                   	push   %edi
+  8000d9:	56                   	push   %esi
+  8000da:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8000db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000e0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000e5:	89 d1                	mov    %edx,%ecx
+  8000e7:	89 d3                	mov    %edx,%ebx
+  8000e9:	89 d7                	mov    %edx,%edi
+  8000eb:	89 d6                	mov    %edx,%esi
+  8000ed:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8000ef:	5b                   	pop    %ebx
+  8000f0:	5e                   	pop    %esi
+  8000f1:	5f                   	pop    %edi
+  8000f2:	5d                   	pop    %ebp
+  8000f3:	c3                   	ret
+
+008000f4 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8000f4:	55                   	push   %ebp
+  8000f5:	89 e5                	mov    %esp,%ebp
+  8000f7:	57                   	push   %edi
+  8000f8:	56                   	push   %esi
+  8000f9:	53                   	push   %ebx
+  8000fa:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8000fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800102:	8b 55 08             	mov    0x8(%ebp),%edx
+  800105:	b8 03 00 00 00       	mov    $0x3,%eax
+  80010a:	89 cb                	mov    %ecx,%ebx
+  80010c:	89 cf                	mov    %ecx,%edi
+  80010e:	89 ce                	mov    %ecx,%esi
+  800110:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800112:	85 c0                	test   %eax,%eax
+  800114:	7f 08                	jg     80011e <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800116:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800119:	5b                   	pop    %ebx
+  80011a:	5e                   	pop    %esi
+  80011b:	5f                   	pop    %edi
+  80011c:	5d                   	pop    %ebp
+  80011d:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80011e:	83 ec 0c             	sub    $0xc,%esp
+  800121:	50                   	push   %eax
+  800122:	6a 03                	push   $0x3
+  800124:	68 aa 25 80 00       	push   $0x8025aa
+  800129:	6a 3e                	push   $0x3e
+  80012b:	68 c7 25 80 00       	push   $0x8025c7
+  800130:	e8 46 14 00 00       	call   80157b <_panic>
+
+00800135 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800135:	55                   	push   %ebp
+  800136:	89 e5                	mov    %esp,%ebp
+  800138:	57                   	push   %edi
+  800139:	56                   	push   %esi
+  80013a:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80013b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800140:	b8 02 00 00 00       	mov    $0x2,%eax
+  800145:	89 d1                	mov    %edx,%ecx
+  800147:	89 d3                	mov    %edx,%ebx
+  800149:	89 d7                	mov    %edx,%edi
+  80014b:	89 d6                	mov    %edx,%esi
+  80014d:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  80014f:	5b                   	pop    %ebx
+  800150:	5e                   	pop    %esi
+  800151:	5f                   	pop    %edi
+  800152:	5d                   	pop    %ebp
+  800153:	c3                   	ret
+
+00800154 <sys_yield>:
+
+void
+sys_yield(void) {
+  800154:	55                   	push   %ebp
+  800155:	89 e5                	mov    %esp,%ebp
+  800157:	57                   	push   %edi
+  800158:	56                   	push   %esi
+  800159:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80015a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80015f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800164:	89 d1                	mov    %edx,%ecx
+  800166:	89 d3                	mov    %edx,%ebx
+  800168:	89 d7                	mov    %edx,%edi
+  80016a:	89 d6                	mov    %edx,%esi
+  80016c:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  80016e:	5b                   	pop    %ebx
+  80016f:	5e                   	pop    %esi
+  800170:	5f                   	pop    %edi
+  800171:	5d                   	pop    %ebp
+  800172:	c3                   	ret
+
+00800173 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  800173:	55                   	push   %ebp
+  800174:	89 e5                	mov    %esp,%ebp
+  800176:	57                   	push   %edi
+  800177:	56                   	push   %esi
+  800178:	53                   	push   %ebx
+  800179:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  80017c:	be 00 00 00 00       	mov    $0x0,%esi
+  800181:	8b 55 08             	mov    0x8(%ebp),%edx
+  800184:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800187:	b8 04 00 00 00       	mov    $0x4,%eax
+  80018c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80018f:	89 f7                	mov    %esi,%edi
+  800191:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800193:	85 c0                	test   %eax,%eax
+  800195:	7f 08                	jg     80019f <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800197:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80019a:	5b                   	pop    %ebx
+  80019b:	5e                   	pop    %esi
+  80019c:	5f                   	pop    %edi
+  80019d:	5d                   	pop    %ebp
+  80019e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80019f:	83 ec 0c             	sub    $0xc,%esp
+  8001a2:	50                   	push   %eax
+  8001a3:	6a 04                	push   $0x4
+  8001a5:	68 aa 25 80 00       	push   $0x8025aa
+  8001aa:	6a 3e                	push   $0x3e
+  8001ac:	68 c7 25 80 00       	push   $0x8025c7
+  8001b1:	e8 c5 13 00 00       	call   80157b <_panic>
+
+008001b6 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  8001b6:	55                   	push   %ebp
+  8001b7:	89 e5                	mov    %esp,%ebp
+  8001b9:	57                   	push   %edi
+  8001ba:	56                   	push   %esi
+  8001bb:	53                   	push   %ebx
+  8001bc:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8001bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001c2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001c5:	b8 05 00 00 00       	mov    $0x5,%eax
+  8001ca:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001cd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8001d0:	8b 75 18             	mov    0x18(%ebp),%esi
+  8001d3:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8001d5:	85 c0                	test   %eax,%eax
+  8001d7:	7f 08                	jg     8001e1 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  8001d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001dc:	5b                   	pop    %ebx
+  8001dd:	5e                   	pop    %esi
+  8001de:	5f                   	pop    %edi
+  8001df:	5d                   	pop    %ebp
+  8001e0:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8001e1:	83 ec 0c             	sub    $0xc,%esp
+  8001e4:	50                   	push   %eax
+  8001e5:	6a 05                	push   $0x5
+  8001e7:	68 aa 25 80 00       	push   $0x8025aa
+  8001ec:	6a 3e                	push   $0x3e
+  8001ee:	68 c7 25 80 00       	push   $0x8025c7
+  8001f3:	e8 83 13 00 00       	call   80157b <_panic>
+
+008001f8 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  8001f8:	55                   	push   %ebp
+  8001f9:	89 e5                	mov    %esp,%ebp
+  8001fb:	57                   	push   %edi
+  8001fc:	56                   	push   %esi
+  8001fd:	53                   	push   %ebx
+  8001fe:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800201:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800206:	8b 55 08             	mov    0x8(%ebp),%edx
+  800209:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80020c:	b8 06 00 00 00       	mov    $0x6,%eax
+  800211:	89 df                	mov    %ebx,%edi
+  800213:	89 de                	mov    %ebx,%esi
+  800215:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800217:	85 c0                	test   %eax,%eax
+  800219:	7f 08                	jg     800223 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  80021b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80021e:	5b                   	pop    %ebx
+  80021f:	5e                   	pop    %esi
+  800220:	5f                   	pop    %edi
+  800221:	5d                   	pop    %ebp
+  800222:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800223:	83 ec 0c             	sub    $0xc,%esp
+  800226:	50                   	push   %eax
+  800227:	6a 06                	push   $0x6
+  800229:	68 aa 25 80 00       	push   $0x8025aa
+  80022e:	6a 3e                	push   $0x3e
+  800230:	68 c7 25 80 00       	push   $0x8025c7
+  800235:	e8 41 13 00 00       	call   80157b <_panic>
+
+0080023a <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80023a:	55                   	push   %ebp
+  80023b:	89 e5                	mov    %esp,%ebp
+  80023d:	57                   	push   %edi
+  80023e:	56                   	push   %esi
+  80023f:	53                   	push   %ebx
+  800240:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800243:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800248:	8b 55 08             	mov    0x8(%ebp),%edx
+  80024b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80024e:	b8 08 00 00 00       	mov    $0x8,%eax
+  800253:	89 df                	mov    %ebx,%edi
+  800255:	89 de                	mov    %ebx,%esi
+  800257:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800259:	85 c0                	test   %eax,%eax
+  80025b:	7f 08                	jg     800265 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  80025d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800260:	5b                   	pop    %ebx
+  800261:	5e                   	pop    %esi
+  800262:	5f                   	pop    %edi
+  800263:	5d                   	pop    %ebp
+  800264:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800265:	83 ec 0c             	sub    $0xc,%esp
+  800268:	50                   	push   %eax
+  800269:	6a 08                	push   $0x8
+  80026b:	68 aa 25 80 00       	push   $0x8025aa
+  800270:	6a 3e                	push   $0x3e
+  800272:	68 c7 25 80 00       	push   $0x8025c7
+  800277:	e8 ff 12 00 00       	call   80157b <_panic>
+
+0080027c <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80027c:	55                   	push   %ebp
+  80027d:	89 e5                	mov    %esp,%ebp
+  80027f:	57                   	push   %edi
+  800280:	56                   	push   %esi
+  800281:	53                   	push   %ebx
+  800282:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800285:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80028a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80028d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800290:	b8 09 00 00 00       	mov    $0x9,%eax
+  800295:	89 df                	mov    %ebx,%edi
+  800297:	89 de                	mov    %ebx,%esi
+  800299:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80029b:	85 c0                	test   %eax,%eax
+  80029d:	7f 08                	jg     8002a7 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  80029f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002a2:	5b                   	pop    %ebx
+  8002a3:	5e                   	pop    %esi
+  8002a4:	5f                   	pop    %edi
+  8002a5:	5d                   	pop    %ebp
+  8002a6:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8002a7:	83 ec 0c             	sub    $0xc,%esp
+  8002aa:	50                   	push   %eax
+  8002ab:	6a 09                	push   $0x9
+  8002ad:	68 aa 25 80 00       	push   $0x8025aa
+  8002b2:	6a 3e                	push   $0x3e
+  8002b4:	68 c7 25 80 00       	push   $0x8025c7
+  8002b9:	e8 bd 12 00 00       	call   80157b <_panic>
+
+008002be <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8002be:	55                   	push   %ebp
+  8002bf:	89 e5                	mov    %esp,%ebp
+  8002c1:	57                   	push   %edi
+  8002c2:	56                   	push   %esi
+  8002c3:	53                   	push   %ebx
+  8002c4:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8002c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002cf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8002d7:	89 df                	mov    %ebx,%edi
+  8002d9:	89 de                	mov    %ebx,%esi
+  8002db:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8002dd:	85 c0                	test   %eax,%eax
+  8002df:	7f 08                	jg     8002e9 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8002e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002e4:	5b                   	pop    %ebx
+  8002e5:	5e                   	pop    %esi
+  8002e6:	5f                   	pop    %edi
+  8002e7:	5d                   	pop    %ebp
+  8002e8:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8002e9:	83 ec 0c             	sub    $0xc,%esp
+  8002ec:	50                   	push   %eax
+  8002ed:	6a 0a                	push   $0xa
+  8002ef:	68 aa 25 80 00       	push   $0x8025aa
+  8002f4:	6a 3e                	push   $0x3e
+  8002f6:	68 c7 25 80 00       	push   $0x8025c7
+  8002fb:	e8 7b 12 00 00       	call   80157b <_panic>
+
+00800300 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  800300:	55                   	push   %ebp
+  800301:	89 e5                	mov    %esp,%ebp
+  800303:	57                   	push   %edi
+  800304:	56                   	push   %esi
+  800305:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800306:	8b 55 08             	mov    0x8(%ebp),%edx
+  800309:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80030c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800311:	be 00 00 00 00       	mov    $0x0,%esi
+  800316:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800319:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80031c:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  80031e:	5b                   	pop    %ebx
+  80031f:	5e                   	pop    %esi
+  800320:	5f                   	pop    %edi
+  800321:	5d                   	pop    %ebp
+  800322:	c3                   	ret
+
+00800323 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  800323:	55                   	push   %ebp
+  800324:	89 e5                	mov    %esp,%ebp
+  800326:	57                   	push   %edi
+  800327:	56                   	push   %esi
+  800328:	53                   	push   %ebx
+  800329:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  80032c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800331:	8b 55 08             	mov    0x8(%ebp),%edx
+  800334:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800339:	89 cb                	mov    %ecx,%ebx
+  80033b:	89 cf                	mov    %ecx,%edi
+  80033d:	89 ce                	mov    %ecx,%esi
+  80033f:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800341:	85 c0                	test   %eax,%eax
+  800343:	7f 08                	jg     80034d <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  800345:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800348:	5b                   	pop    %ebx
+  800349:	5e                   	pop    %esi
+  80034a:	5f                   	pop    %edi
+  80034b:	5d                   	pop    %ebp
+  80034c:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80034d:	83 ec 0c             	sub    $0xc,%esp
+  800350:	50                   	push   %eax
+  800351:	6a 0d                	push   $0xd
+  800353:	68 aa 25 80 00       	push   $0x8025aa
+  800358:	6a 3e                	push   $0x3e
+  80035a:	68 c7 25 80 00       	push   $0x8025c7
+  80035f:	e8 17 12 00 00       	call   80157b <_panic>
+
+00800364 <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  800364:	55                   	push   %ebp
+  800365:	89 e5                	mov    %esp,%ebp
+  800367:	57                   	push   %edi
+  800368:	56                   	push   %esi
+  800369:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80036a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80036f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800372:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800375:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80037a:	89 df                	mov    %ebx,%edi
+  80037c:	89 de                	mov    %ebx,%esi
+  80037e:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  800380:	5b                   	pop    %ebx
+  800381:	5e                   	pop    %esi
+  800382:	5f                   	pop    %edi
+  800383:	5d                   	pop    %ebp
+  800384:	c3                   	ret
+
+00800385 <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  800385:	55                   	push   %ebp
+  800386:	89 e5                	mov    %esp,%ebp
+  800388:	57                   	push   %edi
+  800389:	56                   	push   %esi
+  80038a:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80038b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800390:	8b 55 08             	mov    0x8(%ebp),%edx
+  800393:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800398:	89 cb                	mov    %ecx,%ebx
+  80039a:	89 cf                	mov    %ecx,%edi
+  80039c:	89 ce                	mov    %ecx,%esi
+  80039e:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  8003a0:	5b                   	pop    %ebx
+  8003a1:	5e                   	pop    %esi
+  8003a2:	5f                   	pop    %edi
+  8003a3:	5d                   	pop    %ebp
+  8003a4:	c3                   	ret
+
+008003a5 <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  8003a5:	55                   	push   %ebp
+  8003a6:	89 e5                	mov    %esp,%ebp
+  8003a8:	57                   	push   %edi
+  8003a9:	56                   	push   %esi
+  8003aa:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8003ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003b0:	b8 10 00 00 00       	mov    $0x10,%eax
+  8003b5:	89 d1                	mov    %edx,%ecx
+  8003b7:	89 d3                	mov    %edx,%ebx
+  8003b9:	89 d7                	mov    %edx,%edi
+  8003bb:	89 d6                	mov    %edx,%esi
+  8003bd:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8003bf:	5b                   	pop    %ebx
+  8003c0:	5e                   	pop    %esi
+  8003c1:	5f                   	pop    %edi
+  8003c2:	5d                   	pop    %ebp
+  8003c3:	c3                   	ret
+
+008003c4 <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  8003c4:	55                   	push   %ebp
+  8003c5:	89 e5                	mov    %esp,%ebp
+  8003c7:	57                   	push   %edi
+  8003c8:	56                   	push   %esi
+  8003c9:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8003ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003cf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003d2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003d5:	b8 11 00 00 00       	mov    $0x11,%eax
+  8003da:	89 df                	mov    %ebx,%edi
+  8003dc:	89 de                	mov    %ebx,%esi
+  8003de:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  8003e0:	5b                   	pop    %ebx
+  8003e1:	5e                   	pop    %esi
+  8003e2:	5f                   	pop    %edi
+  8003e3:	5d                   	pop    %ebp
+  8003e4:	c3                   	ret
+
+008003e5 <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  8003e5:	55                   	push   %ebp
+  8003e6:	89 e5                	mov    %esp,%ebp
+  8003e8:	57                   	push   %edi
+  8003e9:	56                   	push   %esi
+  8003ea:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8003eb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003f0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003f3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003f6:	b8 12 00 00 00       	mov    $0x12,%eax
+  8003fb:	89 df                	mov    %ebx,%edi
+  8003fd:	89 de                	mov    %ebx,%esi
+  8003ff:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800401:	5b                   	pop    %ebx
+  800402:	5e                   	pop    %esi
+  800403:	5f                   	pop    %edi
+  800404:	5d                   	pop    %ebp
+  800405:	c3                   	ret
+
+00800406 <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  800406:	55                   	push   %ebp
+  800407:	89 e5                	mov    %esp,%ebp
+  800409:	57                   	push   %edi
+  80040a:	56                   	push   %esi
+  80040b:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80040c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800411:	8b 55 08             	mov    0x8(%ebp),%edx
+  800414:	b8 13 00 00 00       	mov    $0x13,%eax
+  800419:	89 cb                	mov    %ecx,%ebx
+  80041b:	89 cf                	mov    %ecx,%edi
+  80041d:	89 ce                	mov    %ecx,%esi
+  80041f:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  800421:	5b                   	pop    %ebx
+  800422:	5e                   	pop    %esi
+  800423:	5f                   	pop    %edi
+  800424:	5d                   	pop    %ebp
+  800425:	c3                   	ret
+
+00800426 <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  800426:	55                   	push   %ebp
+  800427:	89 e5                	mov    %esp,%ebp
+  800429:	57                   	push   %edi
+  80042a:	56                   	push   %esi
+  80042b:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80042c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800431:	8b 55 08             	mov    0x8(%ebp),%edx
+  800434:	b8 14 00 00 00       	mov    $0x14,%eax
+  800439:	89 cb                	mov    %ecx,%ebx
+  80043b:	89 cf                	mov    %ecx,%edi
+  80043d:	89 ce                	mov    %ecx,%esi
+  80043f:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  800441:	5b                   	pop    %ebx
+  800442:	5e                   	pop    %esi
+  800443:	5f                   	pop    %edi
+  800444:	5d                   	pop    %ebp
+  800445:	c3                   	ret
+
+00800446 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  800446:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  800447:	a1 00 70 80 00       	mov    0x807000,%eax
+	call *%eax
+  80044c:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80044e:	83 c4 04             	add    $0x4,%esp
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	// push the trap-time %eip onto the trap-time stack
+    subl $0x4, 0x30(%esp) # for push eip
+  800451:	83 6c 24 30 04       	subl   $0x4,0x30(%esp)
+    movl 0x30(%esp), %ebx #regular esp
+  800456:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+    movl 0x28(%esp), %eax #eip
+  80045a:	8b 44 24 28          	mov    0x28(%esp),%eax
+    movl %eax, (%ebx)
+  80045e:	89 03                	mov    %eax,(%ebx)
+
+    // Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+    addl $8, %esp
+  800460:	83 c4 08             	add    $0x8,%esp
+    popal
+  800463:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  800464:	83 c4 04             	add    $0x4,%esp
+	popfl
+  800467:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  800468:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  800469:	c3                   	ret
+
+0080046a <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80046a:	55                   	push   %ebp
+  80046b:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80046d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800470:	05 00 00 00 30       	add    $0x30000000,%eax
+  800475:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800478:	5d                   	pop    %ebp
+  800479:	c3                   	ret
+
+0080047a <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80047a:	55                   	push   %ebp
+  80047b:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80047d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800480:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800485:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80048a:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80048f:	5d                   	pop    %ebp
+  800490:	c3                   	ret
+
+00800491 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800491:	55                   	push   %ebp
+  800492:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  800494:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800499:	eb 02                	jmp    80049d <fd_alloc+0xc>
+  80049b:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80049d:	89 c2                	mov    %eax,%edx
+  80049f:	c1 ea 16             	shr    $0x16,%edx
+  8004a2:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8004a9:	f6 c2 01             	test   $0x1,%dl
+  8004ac:	74 2b                	je     8004d9 <fd_alloc+0x48>
+  8004ae:	89 c2                	mov    %eax,%edx
+  8004b0:	c1 ea 0c             	shr    $0xc,%edx
+  8004b3:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8004ba:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8004c0:	f6 c1 01             	test   $0x1,%cl
+  8004c3:	74 14                	je     8004d9 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8004c5:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8004cb:	75 ce                	jne    80049b <fd_alloc+0xa>
+  8004cd:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8004d2:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8004d7:	eb 05                	jmp    8004de <fd_alloc+0x4d>
+			return 0;
+  8004d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8004de:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004e1:	89 02                	mov    %eax,(%edx)
+}
+  8004e3:	89 c8                	mov    %ecx,%eax
+  8004e5:	5d                   	pop    %ebp
+  8004e6:	c3                   	ret
+
+008004e7 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8004e7:	55                   	push   %ebp
+  8004e8:	89 e5                	mov    %esp,%ebp
+  8004ea:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8004ed:	83 f8 1f             	cmp    $0x1f,%eax
+  8004f0:	77 30                	ja     800522 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8004f2:	c1 e0 0c             	shl    $0xc,%eax
+  8004f5:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8004fa:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  800500:	f6 c2 01             	test   $0x1,%dl
+  800503:	74 24                	je     800529 <fd_lookup+0x42>
+  800505:	89 c2                	mov    %eax,%edx
+  800507:	c1 ea 0c             	shr    $0xc,%edx
+  80050a:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800511:	f6 c2 01             	test   $0x1,%dl
+  800514:	74 1a                	je     800530 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  800516:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800519:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80051b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800520:	5d                   	pop    %ebp
+  800521:	c3                   	ret
+		return -E_INVAL;
+  800522:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800527:	eb f7                	jmp    800520 <fd_lookup+0x39>
+		return -E_INVAL;
+  800529:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80052e:	eb f0                	jmp    800520 <fd_lookup+0x39>
+  800530:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800535:	eb e9                	jmp    800520 <fd_lookup+0x39>
+
+00800537 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  800537:	55                   	push   %ebp
+  800538:	89 e5                	mov    %esp,%ebp
+  80053a:	53                   	push   %ebx
+  80053b:	83 ec 04             	sub    $0x4,%esp
+  80053e:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  800541:	b8 00 00 00 00       	mov    $0x0,%eax
+  800546:	eb 03                	jmp    80054b <dev_lookup+0x14>
+  800548:	83 c0 01             	add    $0x1,%eax
+  80054b:	8b 1c 85 54 26 80 00 	mov    0x802654(,%eax,4),%ebx
+  800552:	85 db                	test   %ebx,%ebx
+  800554:	74 0b                	je     800561 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  800556:	39 13                	cmp    %edx,(%ebx)
+  800558:	75 ee                	jne    800548 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  80055a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80055f:	eb 1f                	jmp    800580 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800561:	a1 08 40 80 00       	mov    0x804008,%eax
+  800566:	8b 40 48             	mov    0x48(%eax),%eax
+  800569:	83 ec 04             	sub    $0x4,%esp
+  80056c:	52                   	push   %edx
+  80056d:	50                   	push   %eax
+  80056e:	68 d8 25 80 00       	push   $0x8025d8
+  800573:	e8 de 10 00 00       	call   801656 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  800578:	83 c4 10             	add    $0x10,%esp
+  80057b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  800580:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800583:	89 1a                	mov    %ebx,(%edx)
+}
+  800585:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800588:	c9                   	leave
+  800589:	c3                   	ret
+
+0080058a <fd_close>:
+{
+  80058a:	55                   	push   %ebp
+  80058b:	89 e5                	mov    %esp,%ebp
+  80058d:	57                   	push   %edi
+  80058e:	56                   	push   %esi
+  80058f:	53                   	push   %ebx
+  800590:	83 ec 24             	sub    $0x24,%esp
+  800593:	8b 75 08             	mov    0x8(%ebp),%esi
+  800596:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800599:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80059c:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80059d:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8005a3:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8005a6:	50                   	push   %eax
+  8005a7:	e8 3b ff ff ff       	call   8004e7 <fd_lookup>
+  8005ac:	89 c3                	mov    %eax,%ebx
+  8005ae:	83 c4 10             	add    $0x10,%esp
+  8005b1:	85 c0                	test   %eax,%eax
+  8005b3:	78 05                	js     8005ba <fd_close+0x30>
+	    || fd != fd2)
+  8005b5:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8005b8:	74 16                	je     8005d0 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8005ba:	89 f8                	mov    %edi,%eax
+  8005bc:	84 c0                	test   %al,%al
+  8005be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005c3:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8005c6:	89 d8                	mov    %ebx,%eax
+  8005c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005cb:	5b                   	pop    %ebx
+  8005cc:	5e                   	pop    %esi
+  8005cd:	5f                   	pop    %edi
+  8005ce:	5d                   	pop    %ebp
+  8005cf:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8005d0:	83 ec 08             	sub    $0x8,%esp
+  8005d3:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8005d6:	50                   	push   %eax
+  8005d7:	ff 36                	push   (%esi)
+  8005d9:	e8 59 ff ff ff       	call   800537 <dev_lookup>
+  8005de:	89 c3                	mov    %eax,%ebx
+  8005e0:	83 c4 10             	add    $0x10,%esp
+  8005e3:	85 c0                	test   %eax,%eax
+  8005e5:	78 1a                	js     800601 <fd_close+0x77>
+		if (dev->dev_close)
+  8005e7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005ea:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8005ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8005f2:	85 c0                	test   %eax,%eax
+  8005f4:	74 0b                	je     800601 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8005f6:	83 ec 0c             	sub    $0xc,%esp
+  8005f9:	56                   	push   %esi
+  8005fa:	ff d0                	call   *%eax
+  8005fc:	89 c3                	mov    %eax,%ebx
+  8005fe:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  800601:	83 ec 08             	sub    $0x8,%esp
+  800604:	56                   	push   %esi
+  800605:	6a 00                	push   $0x0
+  800607:	e8 ec fb ff ff       	call   8001f8 <sys_page_unmap>
+	return r;
+  80060c:	83 c4 10             	add    $0x10,%esp
+  80060f:	eb b5                	jmp    8005c6 <fd_close+0x3c>
+
+00800611 <close>:
+
+int
+close(int fdnum)
+{
+  800611:	55                   	push   %ebp
+  800612:	89 e5                	mov    %esp,%ebp
+  800614:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800617:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80061a:	50                   	push   %eax
+  80061b:	ff 75 08             	push   0x8(%ebp)
+  80061e:	e8 c4 fe ff ff       	call   8004e7 <fd_lookup>
+  800623:	83 c4 10             	add    $0x10,%esp
+  800626:	85 c0                	test   %eax,%eax
+  800628:	79 02                	jns    80062c <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80062a:	c9                   	leave
+  80062b:	c3                   	ret
+		return fd_close(fd, 1);
+  80062c:	83 ec 08             	sub    $0x8,%esp
+  80062f:	6a 01                	push   $0x1
+  800631:	ff 75 f4             	push   -0xc(%ebp)
+  800634:	e8 51 ff ff ff       	call   80058a <fd_close>
+  800639:	83 c4 10             	add    $0x10,%esp
+  80063c:	eb ec                	jmp    80062a <close+0x19>
+
+0080063e <close_all>:
+
+void
+close_all(void)
+{
+  80063e:	55                   	push   %ebp
+  80063f:	89 e5                	mov    %esp,%ebp
+  800641:	53                   	push   %ebx
+  800642:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  800645:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80064a:	83 ec 0c             	sub    $0xc,%esp
+  80064d:	53                   	push   %ebx
+  80064e:	e8 be ff ff ff       	call   800611 <close>
+	for (i = 0; i < MAXFD; i++)
+  800653:	83 c3 01             	add    $0x1,%ebx
+  800656:	83 c4 10             	add    $0x10,%esp
+  800659:	83 fb 20             	cmp    $0x20,%ebx
+  80065c:	75 ec                	jne    80064a <close_all+0xc>
+}
+  80065e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800661:	c9                   	leave
+  800662:	c3                   	ret
+
+00800663 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  800663:	55                   	push   %ebp
+  800664:	89 e5                	mov    %esp,%ebp
+  800666:	57                   	push   %edi
+  800667:	56                   	push   %esi
+  800668:	53                   	push   %ebx
+  800669:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80066c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80066f:	50                   	push   %eax
+  800670:	ff 75 08             	push   0x8(%ebp)
+  800673:	e8 6f fe ff ff       	call   8004e7 <fd_lookup>
+  800678:	89 c3                	mov    %eax,%ebx
+  80067a:	83 c4 10             	add    $0x10,%esp
+  80067d:	85 c0                	test   %eax,%eax
+  80067f:	78 7f                	js     800700 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  800681:	83 ec 0c             	sub    $0xc,%esp
+  800684:	ff 75 0c             	push   0xc(%ebp)
+  800687:	e8 85 ff ff ff       	call   800611 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80068c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80068f:	c1 e6 0c             	shl    $0xc,%esi
+  800692:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  800698:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80069b:	89 3c 24             	mov    %edi,(%esp)
+  80069e:	e8 d7 fd ff ff       	call   80047a <fd2data>
+  8006a3:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8006a5:	89 34 24             	mov    %esi,(%esp)
+  8006a8:	e8 cd fd ff ff       	call   80047a <fd2data>
+  8006ad:	83 c4 10             	add    $0x10,%esp
+  8006b0:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8006b3:	89 d8                	mov    %ebx,%eax
+  8006b5:	c1 e8 16             	shr    $0x16,%eax
+  8006b8:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8006bf:	a8 01                	test   $0x1,%al
+  8006c1:	74 11                	je     8006d4 <dup+0x71>
+  8006c3:	89 d8                	mov    %ebx,%eax
+  8006c5:	c1 e8 0c             	shr    $0xc,%eax
+  8006c8:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8006cf:	f6 c2 01             	test   $0x1,%dl
+  8006d2:	75 36                	jne    80070a <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8006d4:	89 f8                	mov    %edi,%eax
+  8006d6:	c1 e8 0c             	shr    $0xc,%eax
+  8006d9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8006e0:	83 ec 0c             	sub    $0xc,%esp
+  8006e3:	25 07 0e 00 00       	and    $0xe07,%eax
+  8006e8:	50                   	push   %eax
+  8006e9:	56                   	push   %esi
+  8006ea:	6a 00                	push   $0x0
+  8006ec:	57                   	push   %edi
+  8006ed:	6a 00                	push   $0x0
+  8006ef:	e8 c2 fa ff ff       	call   8001b6 <sys_page_map>
+  8006f4:	89 c3                	mov    %eax,%ebx
+  8006f6:	83 c4 20             	add    $0x20,%esp
+  8006f9:	85 c0                	test   %eax,%eax
+  8006fb:	78 33                	js     800730 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8006fd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  800700:	89 d8                	mov    %ebx,%eax
+  800702:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800705:	5b                   	pop    %ebx
+  800706:	5e                   	pop    %esi
+  800707:	5f                   	pop    %edi
+  800708:	5d                   	pop    %ebp
+  800709:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80070a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800711:	83 ec 0c             	sub    $0xc,%esp
+  800714:	25 07 0e 00 00       	and    $0xe07,%eax
+  800719:	50                   	push   %eax
+  80071a:	ff 75 d4             	push   -0x2c(%ebp)
+  80071d:	6a 00                	push   $0x0
+  80071f:	53                   	push   %ebx
+  800720:	6a 00                	push   $0x0
+  800722:	e8 8f fa ff ff       	call   8001b6 <sys_page_map>
+  800727:	89 c3                	mov    %eax,%ebx
+  800729:	83 c4 20             	add    $0x20,%esp
+  80072c:	85 c0                	test   %eax,%eax
+  80072e:	79 a4                	jns    8006d4 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  800730:	83 ec 08             	sub    $0x8,%esp
+  800733:	56                   	push   %esi
+  800734:	6a 00                	push   $0x0
+  800736:	e8 bd fa ff ff       	call   8001f8 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  80073b:	83 c4 08             	add    $0x8,%esp
+  80073e:	ff 75 d4             	push   -0x2c(%ebp)
+  800741:	6a 00                	push   $0x0
+  800743:	e8 b0 fa ff ff       	call   8001f8 <sys_page_unmap>
+	return r;
+  800748:	83 c4 10             	add    $0x10,%esp
+  80074b:	eb b3                	jmp    800700 <dup+0x9d>
+
+0080074d <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80074d:	55                   	push   %ebp
+  80074e:	89 e5                	mov    %esp,%ebp
+  800750:	56                   	push   %esi
+  800751:	53                   	push   %ebx
+  800752:	83 ec 18             	sub    $0x18,%esp
+  800755:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800758:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80075b:	50                   	push   %eax
+  80075c:	56                   	push   %esi
+  80075d:	e8 85 fd ff ff       	call   8004e7 <fd_lookup>
+  800762:	83 c4 10             	add    $0x10,%esp
+  800765:	85 c0                	test   %eax,%eax
+  800767:	78 3c                	js     8007a5 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800769:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80076c:	83 ec 08             	sub    $0x8,%esp
+  80076f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800772:	50                   	push   %eax
+  800773:	ff 33                	push   (%ebx)
+  800775:	e8 bd fd ff ff       	call   800537 <dev_lookup>
+  80077a:	83 c4 10             	add    $0x10,%esp
+  80077d:	85 c0                	test   %eax,%eax
+  80077f:	78 24                	js     8007a5 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800781:	8b 43 08             	mov    0x8(%ebx),%eax
+  800784:	83 e0 03             	and    $0x3,%eax
+  800787:	83 f8 01             	cmp    $0x1,%eax
+  80078a:	74 20                	je     8007ac <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80078c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80078f:	8b 40 08             	mov    0x8(%eax),%eax
+  800792:	85 c0                	test   %eax,%eax
+  800794:	74 37                	je     8007cd <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  800796:	83 ec 04             	sub    $0x4,%esp
+  800799:	ff 75 10             	push   0x10(%ebp)
+  80079c:	ff 75 0c             	push   0xc(%ebp)
+  80079f:	53                   	push   %ebx
+  8007a0:	ff d0                	call   *%eax
+  8007a2:	83 c4 10             	add    $0x10,%esp
+}
+  8007a5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8007a8:	5b                   	pop    %ebx
+  8007a9:	5e                   	pop    %esi
+  8007aa:	5d                   	pop    %ebp
+  8007ab:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8007ac:	a1 08 40 80 00       	mov    0x804008,%eax
+  8007b1:	8b 40 48             	mov    0x48(%eax),%eax
+  8007b4:	83 ec 04             	sub    $0x4,%esp
+  8007b7:	56                   	push   %esi
+  8007b8:	50                   	push   %eax
+  8007b9:	68 19 26 80 00       	push   $0x802619
+  8007be:	e8 93 0e 00 00       	call   801656 <cprintf>
+		return -E_INVAL;
+  8007c3:	83 c4 10             	add    $0x10,%esp
+  8007c6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007cb:	eb d8                	jmp    8007a5 <read+0x58>
+		return -E_NOT_SUPP;
+  8007cd:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8007d2:	eb d1                	jmp    8007a5 <read+0x58>
+
+008007d4 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8007d4:	55                   	push   %ebp
+  8007d5:	89 e5                	mov    %esp,%ebp
+  8007d7:	57                   	push   %edi
+  8007d8:	56                   	push   %esi
+  8007d9:	53                   	push   %ebx
+  8007da:	83 ec 0c             	sub    $0xc,%esp
+  8007dd:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8007e0:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8007e3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8007e8:	eb 02                	jmp    8007ec <readn+0x18>
+  8007ea:	01 c3                	add    %eax,%ebx
+  8007ec:	39 f3                	cmp    %esi,%ebx
+  8007ee:	73 21                	jae    800811 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8007f0:	83 ec 04             	sub    $0x4,%esp
+  8007f3:	89 f0                	mov    %esi,%eax
+  8007f5:	29 d8                	sub    %ebx,%eax
+  8007f7:	50                   	push   %eax
+  8007f8:	89 d8                	mov    %ebx,%eax
+  8007fa:	03 45 0c             	add    0xc(%ebp),%eax
+  8007fd:	50                   	push   %eax
+  8007fe:	57                   	push   %edi
+  8007ff:	e8 49 ff ff ff       	call   80074d <read>
+		if (m < 0)
+  800804:	83 c4 10             	add    $0x10,%esp
+  800807:	85 c0                	test   %eax,%eax
+  800809:	78 04                	js     80080f <readn+0x3b>
+			return m;
+		if (m == 0)
+  80080b:	75 dd                	jne    8007ea <readn+0x16>
+  80080d:	eb 02                	jmp    800811 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80080f:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  800811:	89 d8                	mov    %ebx,%eax
+  800813:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800816:	5b                   	pop    %ebx
+  800817:	5e                   	pop    %esi
+  800818:	5f                   	pop    %edi
+  800819:	5d                   	pop    %ebp
+  80081a:	c3                   	ret
+
+0080081b <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80081b:	55                   	push   %ebp
+  80081c:	89 e5                	mov    %esp,%ebp
+  80081e:	56                   	push   %esi
+  80081f:	53                   	push   %ebx
+  800820:	83 ec 18             	sub    $0x18,%esp
+  800823:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800826:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800829:	50                   	push   %eax
+  80082a:	53                   	push   %ebx
+  80082b:	e8 b7 fc ff ff       	call   8004e7 <fd_lookup>
+  800830:	83 c4 10             	add    $0x10,%esp
+  800833:	85 c0                	test   %eax,%eax
+  800835:	78 37                	js     80086e <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800837:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80083a:	83 ec 08             	sub    $0x8,%esp
+  80083d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800840:	50                   	push   %eax
+  800841:	ff 36                	push   (%esi)
+  800843:	e8 ef fc ff ff       	call   800537 <dev_lookup>
+  800848:	83 c4 10             	add    $0x10,%esp
+  80084b:	85 c0                	test   %eax,%eax
+  80084d:	78 1f                	js     80086e <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80084f:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800853:	74 20                	je     800875 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  800855:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800858:	8b 40 0c             	mov    0xc(%eax),%eax
+  80085b:	85 c0                	test   %eax,%eax
+  80085d:	74 37                	je     800896 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80085f:	83 ec 04             	sub    $0x4,%esp
+  800862:	ff 75 10             	push   0x10(%ebp)
+  800865:	ff 75 0c             	push   0xc(%ebp)
+  800868:	56                   	push   %esi
+  800869:	ff d0                	call   *%eax
+  80086b:	83 c4 10             	add    $0x10,%esp
+}
+  80086e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800871:	5b                   	pop    %ebx
+  800872:	5e                   	pop    %esi
+  800873:	5d                   	pop    %ebp
+  800874:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800875:	a1 08 40 80 00       	mov    0x804008,%eax
+  80087a:	8b 40 48             	mov    0x48(%eax),%eax
+  80087d:	83 ec 04             	sub    $0x4,%esp
+  800880:	53                   	push   %ebx
+  800881:	50                   	push   %eax
+  800882:	68 35 26 80 00       	push   $0x802635
+  800887:	e8 ca 0d 00 00       	call   801656 <cprintf>
+		return -E_INVAL;
+  80088c:	83 c4 10             	add    $0x10,%esp
+  80088f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800894:	eb d8                	jmp    80086e <write+0x53>
+		return -E_NOT_SUPP;
+  800896:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80089b:	eb d1                	jmp    80086e <write+0x53>
+
+0080089d <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80089d:	55                   	push   %ebp
+  80089e:	89 e5                	mov    %esp,%ebp
+  8008a0:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8008a3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8008a6:	50                   	push   %eax
+  8008a7:	ff 75 08             	push   0x8(%ebp)
+  8008aa:	e8 38 fc ff ff       	call   8004e7 <fd_lookup>
+  8008af:	83 c4 10             	add    $0x10,%esp
+  8008b2:	85 c0                	test   %eax,%eax
+  8008b4:	78 0e                	js     8008c4 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8008b6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008b9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008bc:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8008bf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008c4:	c9                   	leave
+  8008c5:	c3                   	ret
+
+008008c6 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8008c6:	55                   	push   %ebp
+  8008c7:	89 e5                	mov    %esp,%ebp
+  8008c9:	56                   	push   %esi
+  8008ca:	53                   	push   %ebx
+  8008cb:	83 ec 18             	sub    $0x18,%esp
+  8008ce:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8008d1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8008d4:	50                   	push   %eax
+  8008d5:	53                   	push   %ebx
+  8008d6:	e8 0c fc ff ff       	call   8004e7 <fd_lookup>
+  8008db:	83 c4 10             	add    $0x10,%esp
+  8008de:	85 c0                	test   %eax,%eax
+  8008e0:	78 34                	js     800916 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8008e2:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8008e5:	83 ec 08             	sub    $0x8,%esp
+  8008e8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8008eb:	50                   	push   %eax
+  8008ec:	ff 36                	push   (%esi)
+  8008ee:	e8 44 fc ff ff       	call   800537 <dev_lookup>
+  8008f3:	83 c4 10             	add    $0x10,%esp
+  8008f6:	85 c0                	test   %eax,%eax
+  8008f8:	78 1c                	js     800916 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8008fa:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8008fe:	74 1d                	je     80091d <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  800900:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800903:	8b 40 18             	mov    0x18(%eax),%eax
+  800906:	85 c0                	test   %eax,%eax
+  800908:	74 34                	je     80093e <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80090a:	83 ec 08             	sub    $0x8,%esp
+  80090d:	ff 75 0c             	push   0xc(%ebp)
+  800910:	56                   	push   %esi
+  800911:	ff d0                	call   *%eax
+  800913:	83 c4 10             	add    $0x10,%esp
+}
+  800916:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800919:	5b                   	pop    %ebx
+  80091a:	5e                   	pop    %esi
+  80091b:	5d                   	pop    %ebp
+  80091c:	c3                   	ret
+			thisenv->env_id, fdnum);
+  80091d:	a1 08 40 80 00       	mov    0x804008,%eax
+  800922:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800925:	83 ec 04             	sub    $0x4,%esp
+  800928:	53                   	push   %ebx
+  800929:	50                   	push   %eax
+  80092a:	68 f8 25 80 00       	push   $0x8025f8
+  80092f:	e8 22 0d 00 00       	call   801656 <cprintf>
+		return -E_INVAL;
+  800934:	83 c4 10             	add    $0x10,%esp
+  800937:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80093c:	eb d8                	jmp    800916 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  80093e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800943:	eb d1                	jmp    800916 <ftruncate+0x50>
+
+00800945 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800945:	55                   	push   %ebp
+  800946:	89 e5                	mov    %esp,%ebp
+  800948:	56                   	push   %esi
+  800949:	53                   	push   %ebx
+  80094a:	83 ec 18             	sub    $0x18,%esp
+  80094d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800950:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800953:	50                   	push   %eax
+  800954:	ff 75 08             	push   0x8(%ebp)
+  800957:	e8 8b fb ff ff       	call   8004e7 <fd_lookup>
+  80095c:	83 c4 10             	add    $0x10,%esp
+  80095f:	85 c0                	test   %eax,%eax
+  800961:	78 49                	js     8009ac <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800963:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800966:	83 ec 08             	sub    $0x8,%esp
+  800969:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80096c:	50                   	push   %eax
+  80096d:	ff 36                	push   (%esi)
+  80096f:	e8 c3 fb ff ff       	call   800537 <dev_lookup>
+  800974:	83 c4 10             	add    $0x10,%esp
+  800977:	85 c0                	test   %eax,%eax
+  800979:	78 31                	js     8009ac <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  80097b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80097e:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800982:	74 2f                	je     8009b3 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  800984:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  800987:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80098e:	00 00 00 
+	stat->st_isdir = 0;
+  800991:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800998:	00 00 00 
+	stat->st_dev = dev;
+  80099b:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8009a1:	83 ec 08             	sub    $0x8,%esp
+  8009a4:	53                   	push   %ebx
+  8009a5:	56                   	push   %esi
+  8009a6:	ff 50 14             	call   *0x14(%eax)
+  8009a9:	83 c4 10             	add    $0x10,%esp
+}
+  8009ac:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8009af:	5b                   	pop    %ebx
+  8009b0:	5e                   	pop    %esi
+  8009b1:	5d                   	pop    %ebp
+  8009b2:	c3                   	ret
+		return -E_NOT_SUPP;
+  8009b3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8009b8:	eb f2                	jmp    8009ac <fstat+0x67>
+
+008009ba <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8009ba:	55                   	push   %ebp
+  8009bb:	89 e5                	mov    %esp,%ebp
+  8009bd:	56                   	push   %esi
+  8009be:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8009bf:	83 ec 08             	sub    $0x8,%esp
+  8009c2:	6a 00                	push   $0x0
+  8009c4:	ff 75 08             	push   0x8(%ebp)
+  8009c7:	e8 e4 01 00 00       	call   800bb0 <open>
+  8009cc:	89 c3                	mov    %eax,%ebx
+  8009ce:	83 c4 10             	add    $0x10,%esp
+  8009d1:	85 c0                	test   %eax,%eax
+  8009d3:	78 1b                	js     8009f0 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8009d5:	83 ec 08             	sub    $0x8,%esp
+  8009d8:	ff 75 0c             	push   0xc(%ebp)
+  8009db:	50                   	push   %eax
+  8009dc:	e8 64 ff ff ff       	call   800945 <fstat>
+  8009e1:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8009e3:	89 1c 24             	mov    %ebx,(%esp)
+  8009e6:	e8 26 fc ff ff       	call   800611 <close>
+	return r;
+  8009eb:	83 c4 10             	add    $0x10,%esp
+  8009ee:	89 f3                	mov    %esi,%ebx
+}
+  8009f0:	89 d8                	mov    %ebx,%eax
+  8009f2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8009f5:	5b                   	pop    %ebx
+  8009f6:	5e                   	pop    %esi
+  8009f7:	5d                   	pop    %ebp
+  8009f8:	c3                   	ret
+
+008009f9 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  8009f9:	55                   	push   %ebp
+  8009fa:	89 e5                	mov    %esp,%ebp
+  8009fc:	56                   	push   %esi
+  8009fd:	53                   	push   %ebx
+  8009fe:	89 c6                	mov    %eax,%esi
+  800a00:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  800a02:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  800a09:	74 27                	je     800a32 <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800a0b:	6a 07                	push   $0x7
+  800a0d:	68 00 50 80 00       	push   $0x805000
+  800a12:	56                   	push   %esi
+  800a13:	ff 35 00 40 80 00    	push   0x804000
+  800a19:	e8 00 16 00 00       	call   80201e <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  800a1e:	83 c4 0c             	add    $0xc,%esp
+  800a21:	6a 00                	push   $0x0
+  800a23:	53                   	push   %ebx
+  800a24:	6a 00                	push   $0x0
+  800a26:	e8 7f 15 00 00       	call   801faa <ipc_recv>
+}
+  800a2b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800a2e:	5b                   	pop    %ebx
+  800a2f:	5e                   	pop    %esi
+  800a30:	5d                   	pop    %ebp
+  800a31:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  800a32:	83 ec 0c             	sub    $0xc,%esp
+  800a35:	6a 01                	push   $0x1
+  800a37:	e8 36 16 00 00       	call   802072 <ipc_find_env>
+  800a3c:	a3 00 40 80 00       	mov    %eax,0x804000
+  800a41:	83 c4 10             	add    $0x10,%esp
+  800a44:	eb c5                	jmp    800a0b <fsipc+0x12>
+
+00800a46 <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  800a46:	55                   	push   %ebp
+  800a47:	89 e5                	mov    %esp,%ebp
+  800a49:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800a4c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a4f:	8b 40 0c             	mov    0xc(%eax),%eax
+  800a52:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.set_size.req_size = newsize;
+  800a57:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a5a:	a3 04 50 80 00       	mov    %eax,0x805004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  800a5f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a64:	b8 02 00 00 00       	mov    $0x2,%eax
+  800a69:	e8 8b ff ff ff       	call   8009f9 <fsipc>
+}
+  800a6e:	c9                   	leave
+  800a6f:	c3                   	ret
+
+00800a70 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  800a70:	55                   	push   %ebp
+  800a71:	89 e5                	mov    %esp,%ebp
+  800a73:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800a76:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a79:	8b 40 0c             	mov    0xc(%eax),%eax
+  800a7c:	a3 00 50 80 00       	mov    %eax,0x805000
+  return fsipc(FSREQ_FLUSH, NULL);
+  800a81:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a86:	b8 06 00 00 00       	mov    $0x6,%eax
+  800a8b:	e8 69 ff ff ff       	call   8009f9 <fsipc>
+}
+  800a90:	c9                   	leave
+  800a91:	c3                   	ret
+
+00800a92 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  800a92:	55                   	push   %ebp
+  800a93:	89 e5                	mov    %esp,%ebp
+  800a95:	53                   	push   %ebx
+  800a96:	83 ec 04             	sub    $0x4,%esp
+  800a99:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800a9c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a9f:	8b 40 0c             	mov    0xc(%eax),%eax
+  800aa2:	a3 00 50 80 00       	mov    %eax,0x805000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  800aa7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800aac:	b8 05 00 00 00       	mov    $0x5,%eax
+  800ab1:	e8 43 ff ff ff       	call   8009f9 <fsipc>
+  800ab6:	85 c0                	test   %eax,%eax
+  800ab8:	78 2c                	js     800ae6 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800aba:	83 ec 08             	sub    $0x8,%esp
+  800abd:	68 00 50 80 00       	push   $0x805000
+  800ac2:	53                   	push   %ebx
+  800ac3:	e8 47 11 00 00       	call   801c0f <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  800ac8:	a1 80 50 80 00       	mov    0x805080,%eax
+  800acd:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800ad3:	a1 84 50 80 00       	mov    0x805084,%eax
+  800ad8:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  800ade:	83 c4 10             	add    $0x10,%esp
+  800ae1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ae6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ae9:	c9                   	leave
+  800aea:	c3                   	ret
+
+00800aeb <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  800aeb:	55                   	push   %ebp
+  800aec:	89 e5                	mov    %esp,%ebp
+  800aee:	83 ec 0c             	sub    $0xc,%esp
+  800af1:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800af4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800af7:	8b 52 0c             	mov    0xc(%edx),%edx
+  800afa:	89 15 00 50 80 00    	mov    %edx,0x805000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  800b00:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  800b05:	39 d0                	cmp    %edx,%eax
+  800b07:	0f 47 c2             	cmova  %edx,%eax
+  800b0a:	a3 04 50 80 00       	mov    %eax,0x805004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  800b0f:	50                   	push   %eax
+  800b10:	ff 75 0c             	push   0xc(%ebp)
+  800b13:	68 08 50 80 00       	push   $0x805008
+  800b18:	e8 78 12 00 00       	call   801d95 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  800b1d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b22:	b8 04 00 00 00       	mov    $0x4,%eax
+  800b27:	e8 cd fe ff ff       	call   8009f9 <fsipc>
+}
+  800b2c:	c9                   	leave
+  800b2d:	c3                   	ret
+
+00800b2e <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  800b2e:	55                   	push   %ebp
+  800b2f:	89 e5                	mov    %esp,%ebp
+  800b31:	56                   	push   %esi
+  800b32:	53                   	push   %ebx
+  800b33:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800b36:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b39:	8b 40 0c             	mov    0xc(%eax),%eax
+  800b3c:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.read.req_n = n;
+  800b41:	89 35 04 50 80 00    	mov    %esi,0x805004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  800b47:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b4c:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b51:	e8 a3 fe ff ff       	call   8009f9 <fsipc>
+  800b56:	89 c3                	mov    %eax,%ebx
+  800b58:	85 c0                	test   %eax,%eax
+  800b5a:	78 1f                	js     800b7b <devfile_read+0x4d>
+  assert(r <= n);
+  800b5c:	39 c6                	cmp    %eax,%esi
+  800b5e:	72 24                	jb     800b84 <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  800b60:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800b65:	7f 33                	jg     800b9a <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  800b67:	83 ec 04             	sub    $0x4,%esp
+  800b6a:	50                   	push   %eax
+  800b6b:	68 00 50 80 00       	push   $0x805000
+  800b70:	ff 75 0c             	push   0xc(%ebp)
+  800b73:	e8 1d 12 00 00       	call   801d95 <memmove>
+  return r;
+  800b78:	83 c4 10             	add    $0x10,%esp
+}
+  800b7b:	89 d8                	mov    %ebx,%eax
+  800b7d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b80:	5b                   	pop    %ebx
+  800b81:	5e                   	pop    %esi
+  800b82:	5d                   	pop    %ebp
+  800b83:	c3                   	ret
+  assert(r <= n);
+  800b84:	68 68 26 80 00       	push   $0x802668
+  800b89:	68 6f 26 80 00       	push   $0x80266f
+  800b8e:	6a 78                	push   $0x78
+  800b90:	68 84 26 80 00       	push   $0x802684
+  800b95:	e8 e1 09 00 00       	call   80157b <_panic>
+  assert(r <= PGSIZE);
+  800b9a:	68 8f 26 80 00       	push   $0x80268f
+  800b9f:	68 6f 26 80 00       	push   $0x80266f
+  800ba4:	6a 79                	push   $0x79
+  800ba6:	68 84 26 80 00       	push   $0x802684
+  800bab:	e8 cb 09 00 00       	call   80157b <_panic>
+
+00800bb0 <open>:
+open(const char *path, int mode) {
+  800bb0:	55                   	push   %ebp
+  800bb1:	89 e5                	mov    %esp,%ebp
+  800bb3:	56                   	push   %esi
+  800bb4:	53                   	push   %ebx
+  800bb5:	83 ec 1c             	sub    $0x1c,%esp
+  800bb8:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  800bbb:	56                   	push   %esi
+  800bbc:	e8 13 10 00 00       	call   801bd4 <strlen>
+  800bc1:	83 c4 10             	add    $0x10,%esp
+  800bc4:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800bc9:	7f 6c                	jg     800c37 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  800bcb:	83 ec 0c             	sub    $0xc,%esp
+  800bce:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800bd1:	50                   	push   %eax
+  800bd2:	e8 ba f8 ff ff       	call   800491 <fd_alloc>
+  800bd7:	89 c3                	mov    %eax,%ebx
+  800bd9:	83 c4 10             	add    $0x10,%esp
+  800bdc:	85 c0                	test   %eax,%eax
+  800bde:	78 3c                	js     800c1c <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  800be0:	83 ec 08             	sub    $0x8,%esp
+  800be3:	56                   	push   %esi
+  800be4:	68 00 50 80 00       	push   $0x805000
+  800be9:	e8 21 10 00 00       	call   801c0f <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  800bee:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bf1:	a3 00 54 80 00       	mov    %eax,0x805400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  800bf6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  800bf9:	b8 01 00 00 00       	mov    $0x1,%eax
+  800bfe:	e8 f6 fd ff ff       	call   8009f9 <fsipc>
+  800c03:	89 c3                	mov    %eax,%ebx
+  800c05:	83 c4 10             	add    $0x10,%esp
+  800c08:	85 c0                	test   %eax,%eax
+  800c0a:	78 19                	js     800c25 <open+0x75>
+  return fd2num(fd);
+  800c0c:	83 ec 0c             	sub    $0xc,%esp
+  800c0f:	ff 75 f4             	push   -0xc(%ebp)
+  800c12:	e8 53 f8 ff ff       	call   80046a <fd2num>
+  800c17:	89 c3                	mov    %eax,%ebx
+  800c19:	83 c4 10             	add    $0x10,%esp
+}
+  800c1c:	89 d8                	mov    %ebx,%eax
+  800c1e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c21:	5b                   	pop    %ebx
+  800c22:	5e                   	pop    %esi
+  800c23:	5d                   	pop    %ebp
+  800c24:	c3                   	ret
+    fd_close(fd, 0);
+  800c25:	83 ec 08             	sub    $0x8,%esp
+  800c28:	6a 00                	push   $0x0
+  800c2a:	ff 75 f4             	push   -0xc(%ebp)
+  800c2d:	e8 58 f9 ff ff       	call   80058a <fd_close>
+    return r;
+  800c32:	83 c4 10             	add    $0x10,%esp
+  800c35:	eb e5                	jmp    800c1c <open+0x6c>
+    return -E_BAD_PATH;
+  800c37:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  800c3c:	eb de                	jmp    800c1c <open+0x6c>
+
+00800c3e <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  800c3e:	55                   	push   %ebp
+  800c3f:	89 e5                	mov    %esp,%ebp
+  800c41:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  800c44:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c49:	b8 08 00 00 00       	mov    $0x8,%eax
+  800c4e:	e8 a6 fd ff ff       	call   8009f9 <fsipc>
+}
+  800c53:	c9                   	leave
+  800c54:	c3                   	ret
+
+00800c55 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  800c55:	55                   	push   %ebp
+  800c56:	89 e5                	mov    %esp,%ebp
+  800c58:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  800c5b:	68 9b 26 80 00       	push   $0x80269b
+  800c60:	ff 75 0c             	push   0xc(%ebp)
+  800c63:	e8 a7 0f 00 00       	call   801c0f <strcpy>
+	return 0;
+}
+  800c68:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c6d:	c9                   	leave
+  800c6e:	c3                   	ret
+
+00800c6f <devsock_close>:
+{
+  800c6f:	55                   	push   %ebp
+  800c70:	89 e5                	mov    %esp,%ebp
+  800c72:	53                   	push   %ebx
+  800c73:	83 ec 10             	sub    $0x10,%esp
+  800c76:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  800c79:	53                   	push   %ebx
+  800c7a:	e8 32 14 00 00       	call   8020b1 <pageref>
+  800c7f:	89 c2                	mov    %eax,%edx
+  800c81:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  800c84:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  800c89:	83 fa 01             	cmp    $0x1,%edx
+  800c8c:	74 05                	je     800c93 <devsock_close+0x24>
+}
+  800c8e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c91:	c9                   	leave
+  800c92:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  800c93:	83 ec 0c             	sub    $0xc,%esp
+  800c96:	ff 73 0c             	push   0xc(%ebx)
+  800c99:	e8 b7 02 00 00       	call   800f55 <nsipc_close>
+  800c9e:	83 c4 10             	add    $0x10,%esp
+  800ca1:	eb eb                	jmp    800c8e <devsock_close+0x1f>
+
+00800ca3 <devsock_write>:
+{
+  800ca3:	55                   	push   %ebp
+  800ca4:	89 e5                	mov    %esp,%ebp
+  800ca6:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  800ca9:	6a 00                	push   $0x0
+  800cab:	ff 75 10             	push   0x10(%ebp)
+  800cae:	ff 75 0c             	push   0xc(%ebp)
+  800cb1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cb4:	ff 70 0c             	push   0xc(%eax)
+  800cb7:	e8 79 03 00 00       	call   801035 <nsipc_send>
+}
+  800cbc:	c9                   	leave
+  800cbd:	c3                   	ret
+
+00800cbe <devsock_read>:
+{
+  800cbe:	55                   	push   %ebp
+  800cbf:	89 e5                	mov    %esp,%ebp
+  800cc1:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  800cc4:	6a 00                	push   $0x0
+  800cc6:	ff 75 10             	push   0x10(%ebp)
+  800cc9:	ff 75 0c             	push   0xc(%ebp)
+  800ccc:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ccf:	ff 70 0c             	push   0xc(%eax)
+  800cd2:	e8 ef 02 00 00       	call   800fc6 <nsipc_recv>
+}
+  800cd7:	c9                   	leave
+  800cd8:	c3                   	ret
+
+00800cd9 <fd2sockid>:
+{
+  800cd9:	55                   	push   %ebp
+  800cda:	89 e5                	mov    %esp,%ebp
+  800cdc:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  800cdf:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  800ce2:	52                   	push   %edx
+  800ce3:	50                   	push   %eax
+  800ce4:	e8 fe f7 ff ff       	call   8004e7 <fd_lookup>
+  800ce9:	83 c4 10             	add    $0x10,%esp
+  800cec:	85 c0                	test   %eax,%eax
+  800cee:	78 10                	js     800d00 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  800cf0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800cf3:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  800cf9:	39 08                	cmp    %ecx,(%eax)
+  800cfb:	75 05                	jne    800d02 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  800cfd:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  800d00:	c9                   	leave
+  800d01:	c3                   	ret
+		return -E_NOT_SUPP;
+  800d02:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800d07:	eb f7                	jmp    800d00 <fd2sockid+0x27>
+
+00800d09 <alloc_sockfd>:
+{
+  800d09:	55                   	push   %ebp
+  800d0a:	89 e5                	mov    %esp,%ebp
+  800d0c:	56                   	push   %esi
+  800d0d:	53                   	push   %ebx
+  800d0e:	83 ec 1c             	sub    $0x1c,%esp
+  800d11:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  800d13:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800d16:	50                   	push   %eax
+  800d17:	e8 75 f7 ff ff       	call   800491 <fd_alloc>
+  800d1c:	89 c3                	mov    %eax,%ebx
+  800d1e:	83 c4 10             	add    $0x10,%esp
+  800d21:	85 c0                	test   %eax,%eax
+  800d23:	78 43                	js     800d68 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  800d25:	83 ec 04             	sub    $0x4,%esp
+  800d28:	68 07 04 00 00       	push   $0x407
+  800d2d:	ff 75 f4             	push   -0xc(%ebp)
+  800d30:	6a 00                	push   $0x0
+  800d32:	e8 3c f4 ff ff       	call   800173 <sys_page_alloc>
+  800d37:	89 c3                	mov    %eax,%ebx
+  800d39:	83 c4 10             	add    $0x10,%esp
+  800d3c:	85 c0                	test   %eax,%eax
+  800d3e:	78 28                	js     800d68 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  800d40:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800d43:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  800d49:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  800d4b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800d4e:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  800d55:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  800d58:	83 ec 0c             	sub    $0xc,%esp
+  800d5b:	50                   	push   %eax
+  800d5c:	e8 09 f7 ff ff       	call   80046a <fd2num>
+  800d61:	89 c3                	mov    %eax,%ebx
+  800d63:	83 c4 10             	add    $0x10,%esp
+  800d66:	eb 0c                	jmp    800d74 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  800d68:	83 ec 0c             	sub    $0xc,%esp
+  800d6b:	56                   	push   %esi
+  800d6c:	e8 e4 01 00 00       	call   800f55 <nsipc_close>
+		return r;
+  800d71:	83 c4 10             	add    $0x10,%esp
+}
+  800d74:	89 d8                	mov    %ebx,%eax
+  800d76:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d79:	5b                   	pop    %ebx
+  800d7a:	5e                   	pop    %esi
+  800d7b:	5d                   	pop    %ebp
+  800d7c:	c3                   	ret
+
+00800d7d <accept>:
+{
+  800d7d:	55                   	push   %ebp
+  800d7e:	89 e5                	mov    %esp,%ebp
+  800d80:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800d83:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d86:	e8 4e ff ff ff       	call   800cd9 <fd2sockid>
+  800d8b:	85 c0                	test   %eax,%eax
+  800d8d:	78 1b                	js     800daa <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  800d8f:	83 ec 04             	sub    $0x4,%esp
+  800d92:	ff 75 10             	push   0x10(%ebp)
+  800d95:	ff 75 0c             	push   0xc(%ebp)
+  800d98:	50                   	push   %eax
+  800d99:	e8 0e 01 00 00       	call   800eac <nsipc_accept>
+  800d9e:	83 c4 10             	add    $0x10,%esp
+  800da1:	85 c0                	test   %eax,%eax
+  800da3:	78 05                	js     800daa <accept+0x2d>
+	return alloc_sockfd(r);
+  800da5:	e8 5f ff ff ff       	call   800d09 <alloc_sockfd>
+}
+  800daa:	c9                   	leave
+  800dab:	c3                   	ret
+
+00800dac <bind>:
+{
+  800dac:	55                   	push   %ebp
+  800dad:	89 e5                	mov    %esp,%ebp
+  800daf:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800db2:	8b 45 08             	mov    0x8(%ebp),%eax
+  800db5:	e8 1f ff ff ff       	call   800cd9 <fd2sockid>
+  800dba:	85 c0                	test   %eax,%eax
+  800dbc:	78 12                	js     800dd0 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  800dbe:	83 ec 04             	sub    $0x4,%esp
+  800dc1:	ff 75 10             	push   0x10(%ebp)
+  800dc4:	ff 75 0c             	push   0xc(%ebp)
+  800dc7:	50                   	push   %eax
+  800dc8:	e8 31 01 00 00       	call   800efe <nsipc_bind>
+  800dcd:	83 c4 10             	add    $0x10,%esp
+}
+  800dd0:	c9                   	leave
+  800dd1:	c3                   	ret
+
+00800dd2 <shutdown>:
+{
+  800dd2:	55                   	push   %ebp
+  800dd3:	89 e5                	mov    %esp,%ebp
+  800dd5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800dd8:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ddb:	e8 f9 fe ff ff       	call   800cd9 <fd2sockid>
+  800de0:	85 c0                	test   %eax,%eax
+  800de2:	78 0f                	js     800df3 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  800de4:	83 ec 08             	sub    $0x8,%esp
+  800de7:	ff 75 0c             	push   0xc(%ebp)
+  800dea:	50                   	push   %eax
+  800deb:	e8 43 01 00 00       	call   800f33 <nsipc_shutdown>
+  800df0:	83 c4 10             	add    $0x10,%esp
+}
+  800df3:	c9                   	leave
+  800df4:	c3                   	ret
+
+00800df5 <connect>:
+{
+  800df5:	55                   	push   %ebp
+  800df6:	89 e5                	mov    %esp,%ebp
+  800df8:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800dfb:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dfe:	e8 d6 fe ff ff       	call   800cd9 <fd2sockid>
+  800e03:	85 c0                	test   %eax,%eax
+  800e05:	78 12                	js     800e19 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  800e07:	83 ec 04             	sub    $0x4,%esp
+  800e0a:	ff 75 10             	push   0x10(%ebp)
+  800e0d:	ff 75 0c             	push   0xc(%ebp)
+  800e10:	50                   	push   %eax
+  800e11:	e8 59 01 00 00       	call   800f6f <nsipc_connect>
+  800e16:	83 c4 10             	add    $0x10,%esp
+}
+  800e19:	c9                   	leave
+  800e1a:	c3                   	ret
+
+00800e1b <listen>:
+{
+  800e1b:	55                   	push   %ebp
+  800e1c:	89 e5                	mov    %esp,%ebp
+  800e1e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800e21:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e24:	e8 b0 fe ff ff       	call   800cd9 <fd2sockid>
+  800e29:	85 c0                	test   %eax,%eax
+  800e2b:	78 0f                	js     800e3c <listen+0x21>
+	return nsipc_listen(r, backlog);
+  800e2d:	83 ec 08             	sub    $0x8,%esp
+  800e30:	ff 75 0c             	push   0xc(%ebp)
+  800e33:	50                   	push   %eax
+  800e34:	e8 6b 01 00 00       	call   800fa4 <nsipc_listen>
+  800e39:	83 c4 10             	add    $0x10,%esp
+}
+  800e3c:	c9                   	leave
+  800e3d:	c3                   	ret
+
+00800e3e <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  800e3e:	55                   	push   %ebp
+  800e3f:	89 e5                	mov    %esp,%ebp
+  800e41:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  800e44:	ff 75 10             	push   0x10(%ebp)
+  800e47:	ff 75 0c             	push   0xc(%ebp)
+  800e4a:	ff 75 08             	push   0x8(%ebp)
+  800e4d:	e8 41 02 00 00       	call   801093 <nsipc_socket>
+  800e52:	83 c4 10             	add    $0x10,%esp
+  800e55:	85 c0                	test   %eax,%eax
+  800e57:	78 05                	js     800e5e <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  800e59:	e8 ab fe ff ff       	call   800d09 <alloc_sockfd>
+}
+  800e5e:	c9                   	leave
+  800e5f:	c3                   	ret
+
+00800e60 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  800e60:	55                   	push   %ebp
+  800e61:	89 e5                	mov    %esp,%ebp
+  800e63:	53                   	push   %ebx
+  800e64:	83 ec 04             	sub    $0x4,%esp
+  800e67:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  800e69:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800e70:	74 26                	je     800e98 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  800e72:	6a 07                	push   $0x7
+  800e74:	68 00 60 80 00       	push   $0x806000
+  800e79:	53                   	push   %ebx
+  800e7a:	ff 35 04 40 80 00    	push   0x804004
+  800e80:	e8 99 11 00 00       	call   80201e <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  800e85:	83 c4 0c             	add    $0xc,%esp
+  800e88:	6a 00                	push   $0x0
+  800e8a:	6a 00                	push   $0x0
+  800e8c:	6a 00                	push   $0x0
+  800e8e:	e8 17 11 00 00       	call   801faa <ipc_recv>
+}
+  800e93:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e96:	c9                   	leave
+  800e97:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  800e98:	83 ec 0c             	sub    $0xc,%esp
+  800e9b:	6a 02                	push   $0x2
+  800e9d:	e8 d0 11 00 00       	call   802072 <ipc_find_env>
+  800ea2:	a3 04 40 80 00       	mov    %eax,0x804004
+  800ea7:	83 c4 10             	add    $0x10,%esp
+  800eaa:	eb c6                	jmp    800e72 <nsipc+0x12>
+
+00800eac <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  800eac:	55                   	push   %ebp
+  800ead:	89 e5                	mov    %esp,%ebp
+  800eaf:	56                   	push   %esi
+  800eb0:	53                   	push   %ebx
+  800eb1:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  800eb4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800eb7:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  800ebc:	8b 06                	mov    (%esi),%eax
+  800ebe:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  800ec3:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ec8:	e8 93 ff ff ff       	call   800e60 <nsipc>
+  800ecd:	89 c3                	mov    %eax,%ebx
+  800ecf:	85 c0                	test   %eax,%eax
+  800ed1:	79 09                	jns    800edc <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  800ed3:	89 d8                	mov    %ebx,%eax
+  800ed5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ed8:	5b                   	pop    %ebx
+  800ed9:	5e                   	pop    %esi
+  800eda:	5d                   	pop    %ebp
+  800edb:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  800edc:	83 ec 04             	sub    $0x4,%esp
+  800edf:	ff 35 10 60 80 00    	push   0x806010
+  800ee5:	68 00 60 80 00       	push   $0x806000
+  800eea:	ff 75 0c             	push   0xc(%ebp)
+  800eed:	e8 a3 0e 00 00       	call   801d95 <memmove>
+		*addrlen = ret->ret_addrlen;
+  800ef2:	a1 10 60 80 00       	mov    0x806010,%eax
+  800ef7:	89 06                	mov    %eax,(%esi)
+  800ef9:	83 c4 10             	add    $0x10,%esp
+	return r;
+  800efc:	eb d5                	jmp    800ed3 <nsipc_accept+0x27>
+
+00800efe <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  800efe:	55                   	push   %ebp
+  800eff:	89 e5                	mov    %esp,%ebp
+  800f01:	53                   	push   %ebx
+  800f02:	83 ec 08             	sub    $0x8,%esp
+  800f05:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  800f08:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f0b:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  800f10:	53                   	push   %ebx
+  800f11:	ff 75 0c             	push   0xc(%ebp)
+  800f14:	68 04 60 80 00       	push   $0x806004
+  800f19:	e8 77 0e 00 00       	call   801d95 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  800f1e:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  800f24:	b8 02 00 00 00       	mov    $0x2,%eax
+  800f29:	e8 32 ff ff ff       	call   800e60 <nsipc>
+}
+  800f2e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f31:	c9                   	leave
+  800f32:	c3                   	ret
+
+00800f33 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  800f33:	55                   	push   %ebp
+  800f34:	89 e5                	mov    %esp,%ebp
+  800f36:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  800f39:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f3c:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  800f41:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f44:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  800f49:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f4e:	e8 0d ff ff ff       	call   800e60 <nsipc>
+}
+  800f53:	c9                   	leave
+  800f54:	c3                   	ret
+
+00800f55 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  800f55:	55                   	push   %ebp
+  800f56:	89 e5                	mov    %esp,%ebp
+  800f58:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  800f5b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f5e:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  800f63:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f68:	e8 f3 fe ff ff       	call   800e60 <nsipc>
+}
+  800f6d:	c9                   	leave
+  800f6e:	c3                   	ret
+
+00800f6f <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  800f6f:	55                   	push   %ebp
+  800f70:	89 e5                	mov    %esp,%ebp
+  800f72:	53                   	push   %ebx
+  800f73:	83 ec 08             	sub    $0x8,%esp
+  800f76:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  800f79:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f7c:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  800f81:	53                   	push   %ebx
+  800f82:	ff 75 0c             	push   0xc(%ebp)
+  800f85:	68 04 60 80 00       	push   $0x806004
+  800f8a:	e8 06 0e 00 00       	call   801d95 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  800f8f:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  800f95:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f9a:	e8 c1 fe ff ff       	call   800e60 <nsipc>
+}
+  800f9f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800fa2:	c9                   	leave
+  800fa3:	c3                   	ret
+
+00800fa4 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  800fa4:	55                   	push   %ebp
+  800fa5:	89 e5                	mov    %esp,%ebp
+  800fa7:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  800faa:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fad:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  800fb2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800fb5:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  800fba:	b8 06 00 00 00       	mov    $0x6,%eax
+  800fbf:	e8 9c fe ff ff       	call   800e60 <nsipc>
+}
+  800fc4:	c9                   	leave
+  800fc5:	c3                   	ret
+
+00800fc6 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  800fc6:	55                   	push   %ebp
+  800fc7:	89 e5                	mov    %esp,%ebp
+  800fc9:	56                   	push   %esi
+  800fca:	53                   	push   %ebx
+  800fcb:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  800fce:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fd1:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  800fd6:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  800fdc:	8b 45 14             	mov    0x14(%ebp),%eax
+  800fdf:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  800fe4:	b8 07 00 00 00       	mov    $0x7,%eax
+  800fe9:	e8 72 fe ff ff       	call   800e60 <nsipc>
+  800fee:	89 c3                	mov    %eax,%ebx
+  800ff0:	85 c0                	test   %eax,%eax
+  800ff2:	78 22                	js     801016 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  800ff4:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  800ff9:	39 c6                	cmp    %eax,%esi
+  800ffb:	0f 4e c6             	cmovle %esi,%eax
+  800ffe:	39 c3                	cmp    %eax,%ebx
+  801000:	7f 1d                	jg     80101f <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801002:	83 ec 04             	sub    $0x4,%esp
+  801005:	53                   	push   %ebx
+  801006:	68 00 60 80 00       	push   $0x806000
+  80100b:	ff 75 0c             	push   0xc(%ebp)
+  80100e:	e8 82 0d 00 00       	call   801d95 <memmove>
+  801013:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801016:	89 d8                	mov    %ebx,%eax
+  801018:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80101b:	5b                   	pop    %ebx
+  80101c:	5e                   	pop    %esi
+  80101d:	5d                   	pop    %ebp
+  80101e:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  80101f:	68 a7 26 80 00       	push   $0x8026a7
+  801024:	68 6f 26 80 00       	push   $0x80266f
+  801029:	6a 62                	push   $0x62
+  80102b:	68 bc 26 80 00       	push   $0x8026bc
+  801030:	e8 46 05 00 00       	call   80157b <_panic>
+
+00801035 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801035:	55                   	push   %ebp
+  801036:	89 e5                	mov    %esp,%ebp
+  801038:	53                   	push   %ebx
+  801039:	83 ec 04             	sub    $0x4,%esp
+  80103c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  80103f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801042:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  801047:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80104d:	7f 2e                	jg     80107d <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  80104f:	83 ec 04             	sub    $0x4,%esp
+  801052:	53                   	push   %ebx
+  801053:	ff 75 0c             	push   0xc(%ebp)
+  801056:	68 0c 60 80 00       	push   $0x80600c
+  80105b:	e8 35 0d 00 00       	call   801d95 <memmove>
+	nsipcbuf.send.req_size = size;
+  801060:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  801066:	8b 45 14             	mov    0x14(%ebp),%eax
+  801069:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  80106e:	b8 08 00 00 00       	mov    $0x8,%eax
+  801073:	e8 e8 fd ff ff       	call   800e60 <nsipc>
+}
+  801078:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80107b:	c9                   	leave
+  80107c:	c3                   	ret
+	assert(size < 1600);
+  80107d:	68 c8 26 80 00       	push   $0x8026c8
+  801082:	68 6f 26 80 00       	push   $0x80266f
+  801087:	6a 6d                	push   $0x6d
+  801089:	68 bc 26 80 00       	push   $0x8026bc
+  80108e:	e8 e8 04 00 00       	call   80157b <_panic>
+
+00801093 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801093:	55                   	push   %ebp
+  801094:	89 e5                	mov    %esp,%ebp
+  801096:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801099:	8b 45 08             	mov    0x8(%ebp),%eax
+  80109c:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  8010a1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8010a4:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  8010a9:	8b 45 10             	mov    0x10(%ebp),%eax
+  8010ac:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  8010b1:	b8 09 00 00 00       	mov    $0x9,%eax
+  8010b6:	e8 a5 fd ff ff       	call   800e60 <nsipc>
+}
+  8010bb:	c9                   	leave
+  8010bc:	c3                   	ret
+
+008010bd <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8010bd:	55                   	push   %ebp
+  8010be:	89 e5                	mov    %esp,%ebp
+  8010c0:	56                   	push   %esi
+  8010c1:	53                   	push   %ebx
+  8010c2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8010c5:	83 ec 0c             	sub    $0xc,%esp
+  8010c8:	ff 75 08             	push   0x8(%ebp)
+  8010cb:	e8 aa f3 ff ff       	call   80047a <fd2data>
+  8010d0:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8010d2:	83 c4 08             	add    $0x8,%esp
+  8010d5:	68 d4 26 80 00       	push   $0x8026d4
+  8010da:	53                   	push   %ebx
+  8010db:	e8 2f 0b 00 00       	call   801c0f <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8010e0:	8b 46 04             	mov    0x4(%esi),%eax
+  8010e3:	2b 06                	sub    (%esi),%eax
+  8010e5:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8010eb:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8010f2:	00 00 00 
+	stat->st_dev = &devpipe;
+  8010f5:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  8010fc:	30 80 00 
+	return 0;
+}
+  8010ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  801104:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801107:	5b                   	pop    %ebx
+  801108:	5e                   	pop    %esi
+  801109:	5d                   	pop    %ebp
+  80110a:	c3                   	ret
+
+0080110b <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80110b:	55                   	push   %ebp
+  80110c:	89 e5                	mov    %esp,%ebp
+  80110e:	53                   	push   %ebx
+  80110f:	83 ec 0c             	sub    $0xc,%esp
+  801112:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801115:	53                   	push   %ebx
+  801116:	6a 00                	push   $0x0
+  801118:	e8 db f0 ff ff       	call   8001f8 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  80111d:	89 1c 24             	mov    %ebx,(%esp)
+  801120:	e8 55 f3 ff ff       	call   80047a <fd2data>
+  801125:	83 c4 08             	add    $0x8,%esp
+  801128:	50                   	push   %eax
+  801129:	6a 00                	push   $0x0
+  80112b:	e8 c8 f0 ff ff       	call   8001f8 <sys_page_unmap>
+}
+  801130:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801133:	c9                   	leave
+  801134:	c3                   	ret
+
+00801135 <_pipeisclosed>:
+{
+  801135:	55                   	push   %ebp
+  801136:	89 e5                	mov    %esp,%ebp
+  801138:	57                   	push   %edi
+  801139:	56                   	push   %esi
+  80113a:	53                   	push   %ebx
+  80113b:	83 ec 1c             	sub    $0x1c,%esp
+  80113e:	89 c7                	mov    %eax,%edi
+  801140:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801142:	a1 08 40 80 00       	mov    0x804008,%eax
+  801147:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  80114a:	83 ec 0c             	sub    $0xc,%esp
+  80114d:	57                   	push   %edi
+  80114e:	e8 5e 0f 00 00       	call   8020b1 <pageref>
+  801153:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801156:	89 34 24             	mov    %esi,(%esp)
+  801159:	e8 53 0f 00 00       	call   8020b1 <pageref>
+		nn = thisenv->env_runs;
+  80115e:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801164:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801167:	83 c4 10             	add    $0x10,%esp
+  80116a:	39 cb                	cmp    %ecx,%ebx
+  80116c:	74 1b                	je     801189 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  80116e:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801171:	75 cf                	jne    801142 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801173:	8b 42 58             	mov    0x58(%edx),%eax
+  801176:	6a 01                	push   $0x1
+  801178:	50                   	push   %eax
+  801179:	53                   	push   %ebx
+  80117a:	68 db 26 80 00       	push   $0x8026db
+  80117f:	e8 d2 04 00 00       	call   801656 <cprintf>
+  801184:	83 c4 10             	add    $0x10,%esp
+  801187:	eb b9                	jmp    801142 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801189:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80118c:	0f 94 c0             	sete   %al
+  80118f:	0f b6 c0             	movzbl %al,%eax
+}
+  801192:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801195:	5b                   	pop    %ebx
+  801196:	5e                   	pop    %esi
+  801197:	5f                   	pop    %edi
+  801198:	5d                   	pop    %ebp
+  801199:	c3                   	ret
+
+0080119a <devpipe_write>:
+{
+  80119a:	55                   	push   %ebp
+  80119b:	89 e5                	mov    %esp,%ebp
+  80119d:	57                   	push   %edi
+  80119e:	56                   	push   %esi
+  80119f:	53                   	push   %ebx
+  8011a0:	83 ec 28             	sub    $0x28,%esp
+  8011a3:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  8011a6:	56                   	push   %esi
+  8011a7:	e8 ce f2 ff ff       	call   80047a <fd2data>
+  8011ac:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8011ae:	83 c4 10             	add    $0x10,%esp
+  8011b1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8011b6:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8011b9:	75 09                	jne    8011c4 <devpipe_write+0x2a>
+	return i;
+  8011bb:	89 f8                	mov    %edi,%eax
+  8011bd:	eb 23                	jmp    8011e2 <devpipe_write+0x48>
+			sys_yield();
+  8011bf:	e8 90 ef ff ff       	call   800154 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8011c4:	8b 43 04             	mov    0x4(%ebx),%eax
+  8011c7:	8b 0b                	mov    (%ebx),%ecx
+  8011c9:	8d 51 20             	lea    0x20(%ecx),%edx
+  8011cc:	39 d0                	cmp    %edx,%eax
+  8011ce:	72 1a                	jb     8011ea <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8011d0:	89 da                	mov    %ebx,%edx
+  8011d2:	89 f0                	mov    %esi,%eax
+  8011d4:	e8 5c ff ff ff       	call   801135 <_pipeisclosed>
+  8011d9:	85 c0                	test   %eax,%eax
+  8011db:	74 e2                	je     8011bf <devpipe_write+0x25>
+				return 0;
+  8011dd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011e2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011e5:	5b                   	pop    %ebx
+  8011e6:	5e                   	pop    %esi
+  8011e7:	5f                   	pop    %edi
+  8011e8:	5d                   	pop    %ebp
+  8011e9:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8011ea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ed:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8011f1:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8011f4:	89 c2                	mov    %eax,%edx
+  8011f6:	c1 fa 1f             	sar    $0x1f,%edx
+  8011f9:	89 d1                	mov    %edx,%ecx
+  8011fb:	c1 e9 1b             	shr    $0x1b,%ecx
+  8011fe:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801201:	83 e2 1f             	and    $0x1f,%edx
+  801204:	29 ca                	sub    %ecx,%edx
+  801206:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80120a:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  80120e:	83 c0 01             	add    $0x1,%eax
+  801211:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  801214:	83 c7 01             	add    $0x1,%edi
+  801217:	eb 9d                	jmp    8011b6 <devpipe_write+0x1c>
+
+00801219 <devpipe_read>:
+{
+  801219:	55                   	push   %ebp
+  80121a:	89 e5                	mov    %esp,%ebp
+  80121c:	57                   	push   %edi
+  80121d:	56                   	push   %esi
+  80121e:	53                   	push   %ebx
+  80121f:	83 ec 18             	sub    $0x18,%esp
+  801222:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  801225:	57                   	push   %edi
+  801226:	e8 4f f2 ff ff       	call   80047a <fd2data>
+  80122b:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80122d:	83 c4 10             	add    $0x10,%esp
+  801230:	be 00 00 00 00       	mov    $0x0,%esi
+  801235:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801238:	75 13                	jne    80124d <devpipe_read+0x34>
+	return i;
+  80123a:	89 f0                	mov    %esi,%eax
+  80123c:	eb 02                	jmp    801240 <devpipe_read+0x27>
+				return i;
+  80123e:	89 f0                	mov    %esi,%eax
+}
+  801240:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801243:	5b                   	pop    %ebx
+  801244:	5e                   	pop    %esi
+  801245:	5f                   	pop    %edi
+  801246:	5d                   	pop    %ebp
+  801247:	c3                   	ret
+			sys_yield();
+  801248:	e8 07 ef ff ff       	call   800154 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  80124d:	8b 03                	mov    (%ebx),%eax
+  80124f:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801252:	75 18                	jne    80126c <devpipe_read+0x53>
+			if (i > 0)
+  801254:	85 f6                	test   %esi,%esi
+  801256:	75 e6                	jne    80123e <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  801258:	89 da                	mov    %ebx,%edx
+  80125a:	89 f8                	mov    %edi,%eax
+  80125c:	e8 d4 fe ff ff       	call   801135 <_pipeisclosed>
+  801261:	85 c0                	test   %eax,%eax
+  801263:	74 e3                	je     801248 <devpipe_read+0x2f>
+				return 0;
+  801265:	b8 00 00 00 00       	mov    $0x0,%eax
+  80126a:	eb d4                	jmp    801240 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80126c:	99                   	cltd
+  80126d:	c1 ea 1b             	shr    $0x1b,%edx
+  801270:	01 d0                	add    %edx,%eax
+  801272:	83 e0 1f             	and    $0x1f,%eax
+  801275:	29 d0                	sub    %edx,%eax
+  801277:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  80127c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80127f:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  801282:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  801285:	83 c6 01             	add    $0x1,%esi
+  801288:	eb ab                	jmp    801235 <devpipe_read+0x1c>
+
+0080128a <pipe>:
+{
+  80128a:	55                   	push   %ebp
+  80128b:	89 e5                	mov    %esp,%ebp
+  80128d:	56                   	push   %esi
+  80128e:	53                   	push   %ebx
+  80128f:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801292:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801295:	50                   	push   %eax
+  801296:	e8 f6 f1 ff ff       	call   800491 <fd_alloc>
+  80129b:	89 c3                	mov    %eax,%ebx
+  80129d:	83 c4 10             	add    $0x10,%esp
+  8012a0:	85 c0                	test   %eax,%eax
+  8012a2:	0f 88 23 01 00 00    	js     8013cb <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8012a8:	83 ec 04             	sub    $0x4,%esp
+  8012ab:	68 07 04 00 00       	push   $0x407
+  8012b0:	ff 75 f4             	push   -0xc(%ebp)
+  8012b3:	6a 00                	push   $0x0
+  8012b5:	e8 b9 ee ff ff       	call   800173 <sys_page_alloc>
+  8012ba:	89 c3                	mov    %eax,%ebx
+  8012bc:	83 c4 10             	add    $0x10,%esp
+  8012bf:	85 c0                	test   %eax,%eax
+  8012c1:	0f 88 04 01 00 00    	js     8013cb <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8012c7:	83 ec 0c             	sub    $0xc,%esp
+  8012ca:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8012cd:	50                   	push   %eax
+  8012ce:	e8 be f1 ff ff       	call   800491 <fd_alloc>
+  8012d3:	89 c3                	mov    %eax,%ebx
+  8012d5:	83 c4 10             	add    $0x10,%esp
+  8012d8:	85 c0                	test   %eax,%eax
+  8012da:	0f 88 db 00 00 00    	js     8013bb <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8012e0:	83 ec 04             	sub    $0x4,%esp
+  8012e3:	68 07 04 00 00       	push   $0x407
+  8012e8:	ff 75 f0             	push   -0x10(%ebp)
+  8012eb:	6a 00                	push   $0x0
+  8012ed:	e8 81 ee ff ff       	call   800173 <sys_page_alloc>
+  8012f2:	89 c3                	mov    %eax,%ebx
+  8012f4:	83 c4 10             	add    $0x10,%esp
+  8012f7:	85 c0                	test   %eax,%eax
+  8012f9:	0f 88 bc 00 00 00    	js     8013bb <pipe+0x131>
+	va = fd2data(fd0);
+  8012ff:	83 ec 0c             	sub    $0xc,%esp
+  801302:	ff 75 f4             	push   -0xc(%ebp)
+  801305:	e8 70 f1 ff ff       	call   80047a <fd2data>
+  80130a:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80130c:	83 c4 0c             	add    $0xc,%esp
+  80130f:	68 07 04 00 00       	push   $0x407
+  801314:	50                   	push   %eax
+  801315:	6a 00                	push   $0x0
+  801317:	e8 57 ee ff ff       	call   800173 <sys_page_alloc>
+  80131c:	89 c3                	mov    %eax,%ebx
+  80131e:	83 c4 10             	add    $0x10,%esp
+  801321:	85 c0                	test   %eax,%eax
+  801323:	0f 88 82 00 00 00    	js     8013ab <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801329:	83 ec 0c             	sub    $0xc,%esp
+  80132c:	ff 75 f0             	push   -0x10(%ebp)
+  80132f:	e8 46 f1 ff ff       	call   80047a <fd2data>
+  801334:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80133b:	50                   	push   %eax
+  80133c:	6a 00                	push   $0x0
+  80133e:	56                   	push   %esi
+  80133f:	6a 00                	push   $0x0
+  801341:	e8 70 ee ff ff       	call   8001b6 <sys_page_map>
+  801346:	89 c3                	mov    %eax,%ebx
+  801348:	83 c4 20             	add    $0x20,%esp
+  80134b:	85 c0                	test   %eax,%eax
+  80134d:	78 4e                	js     80139d <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80134f:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  801354:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801357:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  801359:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80135c:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  801363:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801366:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  801368:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80136b:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  801372:	83 ec 0c             	sub    $0xc,%esp
+  801375:	ff 75 f4             	push   -0xc(%ebp)
+  801378:	e8 ed f0 ff ff       	call   80046a <fd2num>
+  80137d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801380:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  801382:	83 c4 04             	add    $0x4,%esp
+  801385:	ff 75 f0             	push   -0x10(%ebp)
+  801388:	e8 dd f0 ff ff       	call   80046a <fd2num>
+  80138d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801390:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  801393:	83 c4 10             	add    $0x10,%esp
+  801396:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80139b:	eb 2e                	jmp    8013cb <pipe+0x141>
+	sys_page_unmap(0, va);
+  80139d:	83 ec 08             	sub    $0x8,%esp
+  8013a0:	56                   	push   %esi
+  8013a1:	6a 00                	push   $0x0
+  8013a3:	e8 50 ee ff ff       	call   8001f8 <sys_page_unmap>
+  8013a8:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8013ab:	83 ec 08             	sub    $0x8,%esp
+  8013ae:	ff 75 f0             	push   -0x10(%ebp)
+  8013b1:	6a 00                	push   $0x0
+  8013b3:	e8 40 ee ff ff       	call   8001f8 <sys_page_unmap>
+  8013b8:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8013bb:	83 ec 08             	sub    $0x8,%esp
+  8013be:	ff 75 f4             	push   -0xc(%ebp)
+  8013c1:	6a 00                	push   $0x0
+  8013c3:	e8 30 ee ff ff       	call   8001f8 <sys_page_unmap>
+  8013c8:	83 c4 10             	add    $0x10,%esp
+}
+  8013cb:	89 d8                	mov    %ebx,%eax
+  8013cd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013d0:	5b                   	pop    %ebx
+  8013d1:	5e                   	pop    %esi
+  8013d2:	5d                   	pop    %ebp
+  8013d3:	c3                   	ret
+
+008013d4 <pipeisclosed>:
+{
+  8013d4:	55                   	push   %ebp
+  8013d5:	89 e5                	mov    %esp,%ebp
+  8013d7:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8013da:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013dd:	50                   	push   %eax
+  8013de:	ff 75 08             	push   0x8(%ebp)
+  8013e1:	e8 01 f1 ff ff       	call   8004e7 <fd_lookup>
+  8013e6:	83 c4 10             	add    $0x10,%esp
+  8013e9:	85 c0                	test   %eax,%eax
+  8013eb:	78 18                	js     801405 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8013ed:	83 ec 0c             	sub    $0xc,%esp
+  8013f0:	ff 75 f4             	push   -0xc(%ebp)
+  8013f3:	e8 82 f0 ff ff       	call   80047a <fd2data>
+  8013f8:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8013fa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013fd:	e8 33 fd ff ff       	call   801135 <_pipeisclosed>
+  801402:	83 c4 10             	add    $0x10,%esp
+}
+  801405:	c9                   	leave
+  801406:	c3                   	ret
+
+00801407 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  801407:	b8 00 00 00 00       	mov    $0x0,%eax
+  80140c:	c3                   	ret
+
+0080140d <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80140d:	55                   	push   %ebp
+  80140e:	89 e5                	mov    %esp,%ebp
+  801410:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  801413:	68 f3 26 80 00       	push   $0x8026f3
+  801418:	ff 75 0c             	push   0xc(%ebp)
+  80141b:	e8 ef 07 00 00       	call   801c0f <strcpy>
+	return 0;
+}
+  801420:	b8 00 00 00 00       	mov    $0x0,%eax
+  801425:	c9                   	leave
+  801426:	c3                   	ret
+
+00801427 <devcons_write>:
+{
+  801427:	55                   	push   %ebp
+  801428:	89 e5                	mov    %esp,%ebp
+  80142a:	57                   	push   %edi
+  80142b:	56                   	push   %esi
+  80142c:	53                   	push   %ebx
+  80142d:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  801433:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  801438:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80143e:	eb 2e                	jmp    80146e <devcons_write+0x47>
+		m = n - tot;
+  801440:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801443:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  801445:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80144a:	39 c3                	cmp    %eax,%ebx
+  80144c:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80144f:	83 ec 04             	sub    $0x4,%esp
+  801452:	53                   	push   %ebx
+  801453:	89 f0                	mov    %esi,%eax
+  801455:	03 45 0c             	add    0xc(%ebp),%eax
+  801458:	50                   	push   %eax
+  801459:	57                   	push   %edi
+  80145a:	e8 36 09 00 00       	call   801d95 <memmove>
+		sys_cputs(buf, m);
+  80145f:	83 c4 08             	add    $0x8,%esp
+  801462:	53                   	push   %ebx
+  801463:	57                   	push   %edi
+  801464:	e8 4e ec ff ff       	call   8000b7 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  801469:	01 de                	add    %ebx,%esi
+  80146b:	83 c4 10             	add    $0x10,%esp
+  80146e:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801471:	72 cd                	jb     801440 <devcons_write+0x19>
+}
+  801473:	89 f0                	mov    %esi,%eax
+  801475:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801478:	5b                   	pop    %ebx
+  801479:	5e                   	pop    %esi
+  80147a:	5f                   	pop    %edi
+  80147b:	5d                   	pop    %ebp
+  80147c:	c3                   	ret
+
+0080147d <devcons_read>:
+{
+  80147d:	55                   	push   %ebp
+  80147e:	89 e5                	mov    %esp,%ebp
+  801480:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  801483:	b8 00 00 00 00       	mov    $0x0,%eax
+  801488:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80148c:	75 07                	jne    801495 <devcons_read+0x18>
+  80148e:	eb 1f                	jmp    8014af <devcons_read+0x32>
+		sys_yield();
+  801490:	e8 bf ec ff ff       	call   800154 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  801495:	e8 3b ec ff ff       	call   8000d5 <sys_cgetc>
+  80149a:	85 c0                	test   %eax,%eax
+  80149c:	74 f2                	je     801490 <devcons_read+0x13>
+	if (c < 0)
+  80149e:	78 0f                	js     8014af <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8014a0:	83 f8 04             	cmp    $0x4,%eax
+  8014a3:	74 0c                	je     8014b1 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8014a5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8014a8:	88 02                	mov    %al,(%edx)
+	return 1;
+  8014aa:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8014af:	c9                   	leave
+  8014b0:	c3                   	ret
+		return 0;
+  8014b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014b6:	eb f7                	jmp    8014af <devcons_read+0x32>
+
+008014b8 <cputchar>:
+{
+  8014b8:	55                   	push   %ebp
+  8014b9:	89 e5                	mov    %esp,%ebp
+  8014bb:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8014be:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014c1:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8014c4:	6a 01                	push   $0x1
+  8014c6:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8014c9:	50                   	push   %eax
+  8014ca:	e8 e8 eb ff ff       	call   8000b7 <sys_cputs>
+}
+  8014cf:	83 c4 10             	add    $0x10,%esp
+  8014d2:	c9                   	leave
+  8014d3:	c3                   	ret
+
+008014d4 <getchar>:
+{
+  8014d4:	55                   	push   %ebp
+  8014d5:	89 e5                	mov    %esp,%ebp
+  8014d7:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8014da:	6a 01                	push   $0x1
+  8014dc:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8014df:	50                   	push   %eax
+  8014e0:	6a 00                	push   $0x0
+  8014e2:	e8 66 f2 ff ff       	call   80074d <read>
+	if (r < 0)
+  8014e7:	83 c4 10             	add    $0x10,%esp
+  8014ea:	85 c0                	test   %eax,%eax
+  8014ec:	78 06                	js     8014f4 <getchar+0x20>
+	if (r < 1)
+  8014ee:	74 06                	je     8014f6 <getchar+0x22>
+	return c;
+  8014f0:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8014f4:	c9                   	leave
+  8014f5:	c3                   	ret
+		return -E_EOF;
+  8014f6:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8014fb:	eb f7                	jmp    8014f4 <getchar+0x20>
+
+008014fd <iscons>:
+{
+  8014fd:	55                   	push   %ebp
+  8014fe:	89 e5                	mov    %esp,%ebp
+  801500:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801503:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801506:	50                   	push   %eax
+  801507:	ff 75 08             	push   0x8(%ebp)
+  80150a:	e8 d8 ef ff ff       	call   8004e7 <fd_lookup>
+  80150f:	83 c4 10             	add    $0x10,%esp
+  801512:	85 c0                	test   %eax,%eax
+  801514:	78 11                	js     801527 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  801516:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801519:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  80151f:	39 10                	cmp    %edx,(%eax)
+  801521:	0f 94 c0             	sete   %al
+  801524:	0f b6 c0             	movzbl %al,%eax
+}
+  801527:	c9                   	leave
+  801528:	c3                   	ret
+
+00801529 <opencons>:
+{
+  801529:	55                   	push   %ebp
+  80152a:	89 e5                	mov    %esp,%ebp
+  80152c:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80152f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801532:	50                   	push   %eax
+  801533:	e8 59 ef ff ff       	call   800491 <fd_alloc>
+  801538:	83 c4 10             	add    $0x10,%esp
+  80153b:	85 c0                	test   %eax,%eax
+  80153d:	78 3a                	js     801579 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80153f:	83 ec 04             	sub    $0x4,%esp
+  801542:	68 07 04 00 00       	push   $0x407
+  801547:	ff 75 f4             	push   -0xc(%ebp)
+  80154a:	6a 00                	push   $0x0
+  80154c:	e8 22 ec ff ff       	call   800173 <sys_page_alloc>
+  801551:	83 c4 10             	add    $0x10,%esp
+  801554:	85 c0                	test   %eax,%eax
+  801556:	78 21                	js     801579 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  801558:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80155b:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  801561:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  801563:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801566:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80156d:	83 ec 0c             	sub    $0xc,%esp
+  801570:	50                   	push   %eax
+  801571:	e8 f4 ee ff ff       	call   80046a <fd2num>
+  801576:	83 c4 10             	add    $0x10,%esp
+}
+  801579:	c9                   	leave
+  80157a:	c3                   	ret
+
+0080157b <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80157b:	55                   	push   %ebp
+  80157c:	89 e5                	mov    %esp,%ebp
+  80157e:	56                   	push   %esi
+  80157f:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  801580:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  801583:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  801589:	e8 a7 eb ff ff       	call   800135 <sys_getenvid>
+  80158e:	83 ec 0c             	sub    $0xc,%esp
+  801591:	ff 75 0c             	push   0xc(%ebp)
+  801594:	ff 75 08             	push   0x8(%ebp)
+  801597:	56                   	push   %esi
+  801598:	50                   	push   %eax
+  801599:	68 00 27 80 00       	push   $0x802700
+  80159e:	e8 b3 00 00 00       	call   801656 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8015a3:	83 c4 18             	add    $0x18,%esp
+  8015a6:	53                   	push   %ebx
+  8015a7:	ff 75 10             	push   0x10(%ebp)
+  8015aa:	e8 56 00 00 00       	call   801605 <vcprintf>
+	cprintf("\n");
+  8015af:	c7 04 24 ec 26 80 00 	movl   $0x8026ec,(%esp)
+  8015b6:	e8 9b 00 00 00       	call   801656 <cprintf>
+  8015bb:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8015be:	cc                   	int3
+	while (1)
+  8015bf:	eb fd                	jmp    8015be <_panic+0x43>
+
+008015c1 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8015c1:	55                   	push   %ebp
+  8015c2:	89 e5                	mov    %esp,%ebp
+  8015c4:	53                   	push   %ebx
+  8015c5:	83 ec 04             	sub    $0x4,%esp
+  8015c8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8015cb:	8b 13                	mov    (%ebx),%edx
+  8015cd:	8d 42 01             	lea    0x1(%edx),%eax
+  8015d0:	89 03                	mov    %eax,(%ebx)
+  8015d2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8015d5:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8015d9:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8015de:	74 09                	je     8015e9 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8015e0:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8015e4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015e7:	c9                   	leave
+  8015e8:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8015e9:	83 ec 08             	sub    $0x8,%esp
+  8015ec:	68 ff 00 00 00       	push   $0xff
+  8015f1:	8d 43 08             	lea    0x8(%ebx),%eax
+  8015f4:	50                   	push   %eax
+  8015f5:	e8 bd ea ff ff       	call   8000b7 <sys_cputs>
+		b->idx = 0;
+  8015fa:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  801600:	83 c4 10             	add    $0x10,%esp
+  801603:	eb db                	jmp    8015e0 <putch+0x1f>
+
+00801605 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  801605:	55                   	push   %ebp
+  801606:	89 e5                	mov    %esp,%ebp
+  801608:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80160e:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  801615:	00 00 00 
+	b.cnt = 0;
+  801618:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80161f:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  801622:	ff 75 0c             	push   0xc(%ebp)
+  801625:	ff 75 08             	push   0x8(%ebp)
+  801628:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80162e:	50                   	push   %eax
+  80162f:	68 c1 15 80 00       	push   $0x8015c1
+  801634:	e8 14 01 00 00       	call   80174d <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  801639:	83 c4 08             	add    $0x8,%esp
+  80163c:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  801642:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  801648:	50                   	push   %eax
+  801649:	e8 69 ea ff ff       	call   8000b7 <sys_cputs>
+
+	return b.cnt;
+}
+  80164e:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  801654:	c9                   	leave
+  801655:	c3                   	ret
+
+00801656 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  801656:	55                   	push   %ebp
+  801657:	89 e5                	mov    %esp,%ebp
+  801659:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80165c:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80165f:	50                   	push   %eax
+  801660:	ff 75 08             	push   0x8(%ebp)
+  801663:	e8 9d ff ff ff       	call   801605 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  801668:	c9                   	leave
+  801669:	c3                   	ret
+
+0080166a <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80166a:	55                   	push   %ebp
+  80166b:	89 e5                	mov    %esp,%ebp
+  80166d:	57                   	push   %edi
+  80166e:	56                   	push   %esi
+  80166f:	53                   	push   %ebx
+  801670:	83 ec 1c             	sub    $0x1c,%esp
+  801673:	89 c7                	mov    %eax,%edi
+  801675:	89 d6                	mov    %edx,%esi
+  801677:	8b 45 08             	mov    0x8(%ebp),%eax
+  80167a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80167d:	89 d1                	mov    %edx,%ecx
+  80167f:	89 c2                	mov    %eax,%edx
+  801681:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801684:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801687:	8b 45 10             	mov    0x10(%ebp),%eax
+  80168a:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80168d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801690:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801697:	39 c2                	cmp    %eax,%edx
+  801699:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80169c:	72 3e                	jb     8016dc <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80169e:	83 ec 0c             	sub    $0xc,%esp
+  8016a1:	ff 75 18             	push   0x18(%ebp)
+  8016a4:	83 eb 01             	sub    $0x1,%ebx
+  8016a7:	53                   	push   %ebx
+  8016a8:	50                   	push   %eax
+  8016a9:	83 ec 08             	sub    $0x8,%esp
+  8016ac:	ff 75 e4             	push   -0x1c(%ebp)
+  8016af:	ff 75 e0             	push   -0x20(%ebp)
+  8016b2:	ff 75 dc             	push   -0x24(%ebp)
+  8016b5:	ff 75 d8             	push   -0x28(%ebp)
+  8016b8:	e8 43 0b 00 00       	call   802200 <__udivdi3>
+  8016bd:	83 c4 18             	add    $0x18,%esp
+  8016c0:	52                   	push   %edx
+  8016c1:	50                   	push   %eax
+  8016c2:	89 f2                	mov    %esi,%edx
+  8016c4:	89 f8                	mov    %edi,%eax
+  8016c6:	e8 9f ff ff ff       	call   80166a <printnum>
+  8016cb:	83 c4 20             	add    $0x20,%esp
+  8016ce:	eb 13                	jmp    8016e3 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8016d0:	83 ec 08             	sub    $0x8,%esp
+  8016d3:	56                   	push   %esi
+  8016d4:	ff 75 18             	push   0x18(%ebp)
+  8016d7:	ff d7                	call   *%edi
+  8016d9:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8016dc:	83 eb 01             	sub    $0x1,%ebx
+  8016df:	85 db                	test   %ebx,%ebx
+  8016e1:	7f ed                	jg     8016d0 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8016e3:	83 ec 08             	sub    $0x8,%esp
+  8016e6:	56                   	push   %esi
+  8016e7:	83 ec 04             	sub    $0x4,%esp
+  8016ea:	ff 75 e4             	push   -0x1c(%ebp)
+  8016ed:	ff 75 e0             	push   -0x20(%ebp)
+  8016f0:	ff 75 dc             	push   -0x24(%ebp)
+  8016f3:	ff 75 d8             	push   -0x28(%ebp)
+  8016f6:	e8 d5 0b 00 00       	call   8022d0 <__umoddi3>
+  8016fb:	83 c4 14             	add    $0x14,%esp
+  8016fe:	0f be 80 23 27 80 00 	movsbl 0x802723(%eax),%eax
+  801705:	50                   	push   %eax
+  801706:	ff d7                	call   *%edi
+}
+  801708:	83 c4 10             	add    $0x10,%esp
+  80170b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80170e:	5b                   	pop    %ebx
+  80170f:	5e                   	pop    %esi
+  801710:	5f                   	pop    %edi
+  801711:	5d                   	pop    %ebp
+  801712:	c3                   	ret
+
+00801713 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  801713:	55                   	push   %ebp
+  801714:	89 e5                	mov    %esp,%ebp
+  801716:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  801719:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80171d:	8b 10                	mov    (%eax),%edx
+  80171f:	3b 50 04             	cmp    0x4(%eax),%edx
+  801722:	73 0a                	jae    80172e <sprintputch+0x1b>
+		*b->buf++ = ch;
+  801724:	8d 4a 01             	lea    0x1(%edx),%ecx
+  801727:	89 08                	mov    %ecx,(%eax)
+  801729:	8b 45 08             	mov    0x8(%ebp),%eax
+  80172c:	88 02                	mov    %al,(%edx)
+}
+  80172e:	5d                   	pop    %ebp
+  80172f:	c3                   	ret
+
+00801730 <printfmt>:
+{
+  801730:	55                   	push   %ebp
+  801731:	89 e5                	mov    %esp,%ebp
+  801733:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  801736:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  801739:	50                   	push   %eax
+  80173a:	ff 75 10             	push   0x10(%ebp)
+  80173d:	ff 75 0c             	push   0xc(%ebp)
+  801740:	ff 75 08             	push   0x8(%ebp)
+  801743:	e8 05 00 00 00       	call   80174d <vprintfmt>
+}
+  801748:	83 c4 10             	add    $0x10,%esp
+  80174b:	c9                   	leave
+  80174c:	c3                   	ret
+
+0080174d <vprintfmt>:
+{
+  80174d:	55                   	push   %ebp
+  80174e:	89 e5                	mov    %esp,%ebp
+  801750:	57                   	push   %edi
+  801751:	56                   	push   %esi
+  801752:	53                   	push   %ebx
+  801753:	83 ec 2c             	sub    $0x2c,%esp
+  801756:	8b 75 08             	mov    0x8(%ebp),%esi
+  801759:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80175c:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80175f:	eb 0a                	jmp    80176b <vprintfmt+0x1e>
+			putch(ch, putdat);
+  801761:	83 ec 08             	sub    $0x8,%esp
+  801764:	53                   	push   %ebx
+  801765:	50                   	push   %eax
+  801766:	ff d6                	call   *%esi
+  801768:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80176b:	83 c7 01             	add    $0x1,%edi
+  80176e:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  801772:	83 f8 25             	cmp    $0x25,%eax
+  801775:	74 0c                	je     801783 <vprintfmt+0x36>
+			if (ch == '\0')
+  801777:	85 c0                	test   %eax,%eax
+  801779:	75 e6                	jne    801761 <vprintfmt+0x14>
+}
+  80177b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80177e:	5b                   	pop    %ebx
+  80177f:	5e                   	pop    %esi
+  801780:	5f                   	pop    %edi
+  801781:	5d                   	pop    %ebp
+  801782:	c3                   	ret
+		padc = ' ';
+  801783:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  801787:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80178e:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  801795:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80179c:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8017a1:	8d 47 01             	lea    0x1(%edi),%eax
+  8017a4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8017a7:	0f b6 17             	movzbl (%edi),%edx
+  8017aa:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8017ad:	3c 55                	cmp    $0x55,%al
+  8017af:	0f 87 9a 03 00 00    	ja     801b4f <vprintfmt+0x402>
+  8017b5:	0f b6 c0             	movzbl %al,%eax
+  8017b8:	ff 24 85 60 28 80 00 	jmp    *0x802860(,%eax,4)
+  8017bf:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8017c2:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8017c6:	eb d9                	jmp    8017a1 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8017c8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8017cb:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8017cf:	eb d0                	jmp    8017a1 <vprintfmt+0x54>
+  8017d1:	0f b6 d2             	movzbl %dl,%edx
+  8017d4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8017d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017dc:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8017df:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8017e2:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8017e6:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8017e9:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8017ec:	83 f9 09             	cmp    $0x9,%ecx
+  8017ef:	77 55                	ja     801846 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8017f1:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8017f4:	eb e9                	jmp    8017df <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8017f6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8017f9:	8b 00                	mov    (%eax),%eax
+  8017fb:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8017fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  801801:	8d 40 04             	lea    0x4(%eax),%eax
+  801804:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  801807:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80180a:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80180e:	79 91                	jns    8017a1 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  801810:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801813:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801816:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80181d:	eb 82                	jmp    8017a1 <vprintfmt+0x54>
+			if (width < 0)
+  80181f:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801822:	85 d2                	test   %edx,%edx
+  801824:	b8 00 00 00 00       	mov    $0x0,%eax
+  801829:	0f 49 c2             	cmovns %edx,%eax
+  80182c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80182f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  801832:	e9 6a ff ff ff       	jmp    8017a1 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  801837:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80183a:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  801841:	e9 5b ff ff ff       	jmp    8017a1 <vprintfmt+0x54>
+  801846:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801849:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80184c:	eb bc                	jmp    80180a <vprintfmt+0xbd>
+			lflag++;
+  80184e:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801851:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  801854:	e9 48 ff ff ff       	jmp    8017a1 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  801859:	8b 45 14             	mov    0x14(%ebp),%eax
+  80185c:	8d 78 04             	lea    0x4(%eax),%edi
+  80185f:	83 ec 08             	sub    $0x8,%esp
+  801862:	53                   	push   %ebx
+  801863:	ff 30                	push   (%eax)
+  801865:	ff d6                	call   *%esi
+			break;
+  801867:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80186a:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80186d:	e9 7c 02 00 00       	jmp    801aee <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  801872:	8b 45 14             	mov    0x14(%ebp),%eax
+  801875:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  801878:	8b 10                	mov    (%eax),%edx
+  80187a:	89 d0                	mov    %edx,%eax
+  80187c:	f7 d8                	neg    %eax
+  80187e:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  801881:	83 f8 10             	cmp    $0x10,%eax
+  801884:	7f 23                	jg     8018a9 <vprintfmt+0x15c>
+  801886:	8b 14 85 c0 29 80 00 	mov    0x8029c0(,%eax,4),%edx
+  80188d:	85 d2                	test   %edx,%edx
+  80188f:	74 18                	je     8018a9 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  801891:	52                   	push   %edx
+  801892:	68 81 26 80 00       	push   $0x802681
+  801897:	53                   	push   %ebx
+  801898:	56                   	push   %esi
+  801899:	e8 92 fe ff ff       	call   801730 <printfmt>
+  80189e:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8018a1:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8018a4:	e9 45 02 00 00       	jmp    801aee <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  8018a9:	50                   	push   %eax
+  8018aa:	68 3b 27 80 00       	push   $0x80273b
+  8018af:	53                   	push   %ebx
+  8018b0:	56                   	push   %esi
+  8018b1:	e8 7a fe ff ff       	call   801730 <printfmt>
+  8018b6:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8018b9:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8018bc:	e9 2d 02 00 00       	jmp    801aee <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8018c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8018c4:	83 c0 04             	add    $0x4,%eax
+  8018c7:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8018ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8018cd:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8018cf:	85 c9                	test   %ecx,%ecx
+  8018d1:	b8 34 27 80 00       	mov    $0x802734,%eax
+  8018d6:	0f 45 c1             	cmovne %ecx,%eax
+  8018d9:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8018dc:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8018e0:	7e 06                	jle    8018e8 <vprintfmt+0x19b>
+  8018e2:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8018e6:	75 0b                	jne    8018f3 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8018e8:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8018eb:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8018ee:	89 75 08             	mov    %esi,0x8(%ebp)
+  8018f1:	eb 5c                	jmp    80194f <vprintfmt+0x202>
+  8018f3:	83 ec 08             	sub    $0x8,%esp
+  8018f6:	ff 75 d0             	push   -0x30(%ebp)
+  8018f9:	ff 75 cc             	push   -0x34(%ebp)
+  8018fc:	e8 eb 02 00 00       	call   801bec <strnlen>
+  801901:	89 c2                	mov    %eax,%edx
+  801903:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801906:	29 d0                	sub    %edx,%eax
+  801908:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80190b:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80190f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801912:	89 75 08             	mov    %esi,0x8(%ebp)
+  801915:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801917:	eb 0e                	jmp    801927 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  801919:	83 ec 08             	sub    $0x8,%esp
+  80191c:	53                   	push   %ebx
+  80191d:	57                   	push   %edi
+  80191e:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801921:	83 ee 01             	sub    $0x1,%esi
+  801924:	83 c4 10             	add    $0x10,%esp
+  801927:	85 f6                	test   %esi,%esi
+  801929:	7f ee                	jg     801919 <vprintfmt+0x1cc>
+  80192b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80192e:	8b 75 08             	mov    0x8(%ebp),%esi
+  801931:	85 c0                	test   %eax,%eax
+  801933:	ba 00 00 00 00       	mov    $0x0,%edx
+  801938:	0f 49 d0             	cmovns %eax,%edx
+  80193b:	29 d0                	sub    %edx,%eax
+  80193d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801940:	eb a6                	jmp    8018e8 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  801942:	83 ec 08             	sub    $0x8,%esp
+  801945:	53                   	push   %ebx
+  801946:	52                   	push   %edx
+  801947:	ff 55 08             	call   *0x8(%ebp)
+  80194a:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80194d:	89 f1                	mov    %esi,%ecx
+  80194f:	8d 71 01             	lea    0x1(%ecx),%esi
+  801952:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  801956:	0f be d0             	movsbl %al,%edx
+  801959:	85 d2                	test   %edx,%edx
+  80195b:	74 28                	je     801985 <vprintfmt+0x238>
+  80195d:	85 ff                	test   %edi,%edi
+  80195f:	78 05                	js     801966 <vprintfmt+0x219>
+  801961:	83 ef 01             	sub    $0x1,%edi
+  801964:	78 30                	js     801996 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  801966:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80196a:	74 d6                	je     801942 <vprintfmt+0x1f5>
+  80196c:	0f be c0             	movsbl %al,%eax
+  80196f:	83 e8 20             	sub    $0x20,%eax
+  801972:	83 f8 5e             	cmp    $0x5e,%eax
+  801975:	76 cb                	jbe    801942 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  801977:	83 ec 08             	sub    $0x8,%esp
+  80197a:	53                   	push   %ebx
+  80197b:	6a 3f                	push   $0x3f
+  80197d:	ff 55 08             	call   *0x8(%ebp)
+  801980:	83 c4 10             	add    $0x10,%esp
+  801983:	eb c8                	jmp    80194d <vprintfmt+0x200>
+  801985:	8b 75 08             	mov    0x8(%ebp),%esi
+  801988:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80198b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80198e:	01 d0                	add    %edx,%eax
+  801990:	29 c8                	sub    %ecx,%eax
+  801992:	89 c7                	mov    %eax,%edi
+  801994:	eb 13                	jmp    8019a9 <vprintfmt+0x25c>
+  801996:	8b 75 08             	mov    0x8(%ebp),%esi
+  801999:	eb ed                	jmp    801988 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80199b:	83 ec 08             	sub    $0x8,%esp
+  80199e:	53                   	push   %ebx
+  80199f:	6a 20                	push   $0x20
+  8019a1:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8019a3:	83 ef 01             	sub    $0x1,%edi
+  8019a6:	83 c4 10             	add    $0x10,%esp
+  8019a9:	85 ff                	test   %edi,%edi
+  8019ab:	7f ee                	jg     80199b <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8019ad:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8019b0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8019b3:	e9 36 01 00 00       	jmp    801aee <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  8019b8:	83 f9 01             	cmp    $0x1,%ecx
+  8019bb:	7f 1f                	jg     8019dc <vprintfmt+0x28f>
+	else if (lflag)
+  8019bd:	85 c9                	test   %ecx,%ecx
+  8019bf:	74 67                	je     801a28 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8019c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019c4:	8b 00                	mov    (%eax),%eax
+  8019c6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8019c9:	89 c1                	mov    %eax,%ecx
+  8019cb:	c1 f9 1f             	sar    $0x1f,%ecx
+  8019ce:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8019d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019d4:	8d 40 04             	lea    0x4(%eax),%eax
+  8019d7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8019da:	eb 17                	jmp    8019f3 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8019dc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019df:	8b 50 04             	mov    0x4(%eax),%edx
+  8019e2:	8b 00                	mov    (%eax),%eax
+  8019e4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8019e7:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8019ea:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019ed:	8d 40 08             	lea    0x8(%eax),%eax
+  8019f0:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8019f3:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8019f6:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8019f9:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8019fe:	85 c9                	test   %ecx,%ecx
+  801a00:	0f 89 ce 00 00 00    	jns    801ad4 <vprintfmt+0x387>
+				putch('-', putdat);
+  801a06:	83 ec 08             	sub    $0x8,%esp
+  801a09:	53                   	push   %ebx
+  801a0a:	6a 2d                	push   $0x2d
+  801a0c:	ff d6                	call   *%esi
+				num = -(long long) num;
+  801a0e:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801a11:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801a14:	f7 da                	neg    %edx
+  801a16:	83 d1 00             	adc    $0x0,%ecx
+  801a19:	f7 d9                	neg    %ecx
+  801a1b:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  801a1e:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801a23:	e9 ac 00 00 00       	jmp    801ad4 <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  801a28:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a2b:	8b 00                	mov    (%eax),%eax
+  801a2d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801a30:	89 c1                	mov    %eax,%ecx
+  801a32:	c1 f9 1f             	sar    $0x1f,%ecx
+  801a35:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801a38:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a3b:	8d 40 04             	lea    0x4(%eax),%eax
+  801a3e:	89 45 14             	mov    %eax,0x14(%ebp)
+  801a41:	eb b0                	jmp    8019f3 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  801a43:	83 f9 01             	cmp    $0x1,%ecx
+  801a46:	7f 1b                	jg     801a63 <vprintfmt+0x316>
+	else if (lflag)
+  801a48:	85 c9                	test   %ecx,%ecx
+  801a4a:	74 2c                	je     801a78 <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  801a4c:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a4f:	8b 10                	mov    (%eax),%edx
+  801a51:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a56:	8d 40 04             	lea    0x4(%eax),%eax
+  801a59:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801a5c:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  801a61:	eb 71                	jmp    801ad4 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  801a63:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a66:	8b 10                	mov    (%eax),%edx
+  801a68:	8b 48 04             	mov    0x4(%eax),%ecx
+  801a6b:	8d 40 08             	lea    0x8(%eax),%eax
+  801a6e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801a71:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  801a76:	eb 5c                	jmp    801ad4 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  801a78:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a7b:	8b 10                	mov    (%eax),%edx
+  801a7d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a82:	8d 40 04             	lea    0x4(%eax),%eax
+  801a85:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801a88:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  801a8d:	eb 45                	jmp    801ad4 <vprintfmt+0x387>
+			putch('X', putdat);
+  801a8f:	83 ec 08             	sub    $0x8,%esp
+  801a92:	53                   	push   %ebx
+  801a93:	6a 58                	push   $0x58
+  801a95:	ff d6                	call   *%esi
+			putch('X', putdat);
+  801a97:	83 c4 08             	add    $0x8,%esp
+  801a9a:	53                   	push   %ebx
+  801a9b:	6a 58                	push   $0x58
+  801a9d:	ff d6                	call   *%esi
+			putch('X', putdat);
+  801a9f:	83 c4 08             	add    $0x8,%esp
+  801aa2:	53                   	push   %ebx
+  801aa3:	6a 58                	push   $0x58
+  801aa5:	ff d6                	call   *%esi
+			break;
+  801aa7:	83 c4 10             	add    $0x10,%esp
+  801aaa:	eb 42                	jmp    801aee <vprintfmt+0x3a1>
+			putch('0', putdat);
+  801aac:	83 ec 08             	sub    $0x8,%esp
+  801aaf:	53                   	push   %ebx
+  801ab0:	6a 30                	push   $0x30
+  801ab2:	ff d6                	call   *%esi
+			putch('x', putdat);
+  801ab4:	83 c4 08             	add    $0x8,%esp
+  801ab7:	53                   	push   %ebx
+  801ab8:	6a 78                	push   $0x78
+  801aba:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  801abc:	8b 45 14             	mov    0x14(%ebp),%eax
+  801abf:	8b 10                	mov    (%eax),%edx
+  801ac1:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  801ac6:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  801ac9:	8d 40 04             	lea    0x4(%eax),%eax
+  801acc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801acf:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  801ad4:	83 ec 0c             	sub    $0xc,%esp
+  801ad7:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  801adb:	50                   	push   %eax
+  801adc:	ff 75 e0             	push   -0x20(%ebp)
+  801adf:	57                   	push   %edi
+  801ae0:	51                   	push   %ecx
+  801ae1:	52                   	push   %edx
+  801ae2:	89 da                	mov    %ebx,%edx
+  801ae4:	89 f0                	mov    %esi,%eax
+  801ae6:	e8 7f fb ff ff       	call   80166a <printnum>
+			break;
+  801aeb:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  801aee:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801af1:	e9 75 fc ff ff       	jmp    80176b <vprintfmt+0x1e>
+	if (lflag >= 2)
+  801af6:	83 f9 01             	cmp    $0x1,%ecx
+  801af9:	7f 1b                	jg     801b16 <vprintfmt+0x3c9>
+	else if (lflag)
+  801afb:	85 c9                	test   %ecx,%ecx
+  801afd:	74 2c                	je     801b2b <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  801aff:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b02:	8b 10                	mov    (%eax),%edx
+  801b04:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b09:	8d 40 04             	lea    0x4(%eax),%eax
+  801b0c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801b0f:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  801b14:	eb be                	jmp    801ad4 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  801b16:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b19:	8b 10                	mov    (%eax),%edx
+  801b1b:	8b 48 04             	mov    0x4(%eax),%ecx
+  801b1e:	8d 40 08             	lea    0x8(%eax),%eax
+  801b21:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801b24:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  801b29:	eb a9                	jmp    801ad4 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  801b2b:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b2e:	8b 10                	mov    (%eax),%edx
+  801b30:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b35:	8d 40 04             	lea    0x4(%eax),%eax
+  801b38:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801b3b:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  801b40:	eb 92                	jmp    801ad4 <vprintfmt+0x387>
+			putch(ch, putdat);
+  801b42:	83 ec 08             	sub    $0x8,%esp
+  801b45:	53                   	push   %ebx
+  801b46:	6a 25                	push   $0x25
+  801b48:	ff d6                	call   *%esi
+			break;
+  801b4a:	83 c4 10             	add    $0x10,%esp
+  801b4d:	eb 9f                	jmp    801aee <vprintfmt+0x3a1>
+			putch('%', putdat);
+  801b4f:	83 ec 08             	sub    $0x8,%esp
+  801b52:	53                   	push   %ebx
+  801b53:	6a 25                	push   $0x25
+  801b55:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801b57:	83 c4 10             	add    $0x10,%esp
+  801b5a:	89 f8                	mov    %edi,%eax
+  801b5c:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  801b60:	74 05                	je     801b67 <vprintfmt+0x41a>
+  801b62:	83 e8 01             	sub    $0x1,%eax
+  801b65:	eb f5                	jmp    801b5c <vprintfmt+0x40f>
+  801b67:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801b6a:	eb 82                	jmp    801aee <vprintfmt+0x3a1>
+
+00801b6c <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  801b6c:	55                   	push   %ebp
+  801b6d:	89 e5                	mov    %esp,%ebp
+  801b6f:	83 ec 18             	sub    $0x18,%esp
+  801b72:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b75:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  801b78:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  801b7b:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  801b7f:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  801b82:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  801b89:	85 c0                	test   %eax,%eax
+  801b8b:	74 26                	je     801bb3 <vsnprintf+0x47>
+  801b8d:	85 d2                	test   %edx,%edx
+  801b8f:	7e 22                	jle    801bb3 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  801b91:	ff 75 14             	push   0x14(%ebp)
+  801b94:	ff 75 10             	push   0x10(%ebp)
+  801b97:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  801b9a:	50                   	push   %eax
+  801b9b:	68 13 17 80 00       	push   $0x801713
+  801ba0:	e8 a8 fb ff ff       	call   80174d <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  801ba5:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801ba8:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  801bab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bae:	83 c4 10             	add    $0x10,%esp
+}
+  801bb1:	c9                   	leave
+  801bb2:	c3                   	ret
+		return -E_INVAL;
+  801bb3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801bb8:	eb f7                	jmp    801bb1 <vsnprintf+0x45>
+
+00801bba <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801bba:	55                   	push   %ebp
+  801bbb:	89 e5                	mov    %esp,%ebp
+  801bbd:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  801bc0:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  801bc3:	50                   	push   %eax
+  801bc4:	ff 75 10             	push   0x10(%ebp)
+  801bc7:	ff 75 0c             	push   0xc(%ebp)
+  801bca:	ff 75 08             	push   0x8(%ebp)
+  801bcd:	e8 9a ff ff ff       	call   801b6c <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  801bd2:	c9                   	leave
+  801bd3:	c3                   	ret
+
+00801bd4 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  801bd4:	55                   	push   %ebp
+  801bd5:	89 e5                	mov    %esp,%ebp
+  801bd7:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  801bda:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bdf:	eb 03                	jmp    801be4 <strlen+0x10>
+		n++;
+  801be1:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  801be4:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  801be8:	75 f7                	jne    801be1 <strlen+0xd>
+	return n;
+}
+  801bea:	5d                   	pop    %ebp
+  801beb:	c3                   	ret
+
+00801bec <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  801bec:	55                   	push   %ebp
+  801bed:	89 e5                	mov    %esp,%ebp
+  801bef:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801bf2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801bf5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bfa:	eb 03                	jmp    801bff <strnlen+0x13>
+		n++;
+  801bfc:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801bff:	39 d0                	cmp    %edx,%eax
+  801c01:	74 08                	je     801c0b <strnlen+0x1f>
+  801c03:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  801c07:	75 f3                	jne    801bfc <strnlen+0x10>
+  801c09:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  801c0b:	89 d0                	mov    %edx,%eax
+  801c0d:	5d                   	pop    %ebp
+  801c0e:	c3                   	ret
+
+00801c0f <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801c0f:	55                   	push   %ebp
+  801c10:	89 e5                	mov    %esp,%ebp
+  801c12:	53                   	push   %ebx
+  801c13:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801c16:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  801c19:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c1e:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  801c22:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  801c25:	83 c0 01             	add    $0x1,%eax
+  801c28:	84 d2                	test   %dl,%dl
+  801c2a:	75 f2                	jne    801c1e <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  801c2c:	89 c8                	mov    %ecx,%eax
+  801c2e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c31:	c9                   	leave
+  801c32:	c3                   	ret
+
+00801c33 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801c33:	55                   	push   %ebp
+  801c34:	89 e5                	mov    %esp,%ebp
+  801c36:	53                   	push   %ebx
+  801c37:	83 ec 10             	sub    $0x10,%esp
+  801c3a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  801c3d:	53                   	push   %ebx
+  801c3e:	e8 91 ff ff ff       	call   801bd4 <strlen>
+  801c43:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  801c46:	ff 75 0c             	push   0xc(%ebp)
+  801c49:	01 d8                	add    %ebx,%eax
+  801c4b:	50                   	push   %eax
+  801c4c:	e8 be ff ff ff       	call   801c0f <strcpy>
+	return dst;
+}
+  801c51:	89 d8                	mov    %ebx,%eax
+  801c53:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c56:	c9                   	leave
+  801c57:	c3                   	ret
+
+00801c58 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801c58:	55                   	push   %ebp
+  801c59:	89 e5                	mov    %esp,%ebp
+  801c5b:	56                   	push   %esi
+  801c5c:	53                   	push   %ebx
+  801c5d:	8b 75 08             	mov    0x8(%ebp),%esi
+  801c60:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  801c63:	89 f3                	mov    %esi,%ebx
+  801c65:	03 5d 10             	add    0x10(%ebp),%ebx
+  801c68:	89 f0                	mov    %esi,%eax
+  801c6a:	eb 0f                	jmp    801c7b <strncpy+0x23>
+		*dst++ = *src;
+  801c6c:	83 c0 01             	add    $0x1,%eax
+  801c6f:	0f b6 0a             	movzbl (%edx),%ecx
+  801c72:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  801c75:	80 f9 01             	cmp    $0x1,%cl
+  801c78:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  801c7b:	39 d8                	cmp    %ebx,%eax
+  801c7d:	75 ed                	jne    801c6c <strncpy+0x14>
+	}
+	return ret;
+}
+  801c7f:	89 f0                	mov    %esi,%eax
+  801c81:	5b                   	pop    %ebx
+  801c82:	5e                   	pop    %esi
+  801c83:	5d                   	pop    %ebp
+  801c84:	c3                   	ret
+
+00801c85 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801c85:	55                   	push   %ebp
+  801c86:	89 e5                	mov    %esp,%ebp
+  801c88:	56                   	push   %esi
+  801c89:	53                   	push   %ebx
+  801c8a:	8b 75 08             	mov    0x8(%ebp),%esi
+  801c8d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c90:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  801c93:	89 f0                	mov    %esi,%eax
+  801c95:	85 d2                	test   %edx,%edx
+  801c97:	74 21                	je     801cba <strlcpy+0x35>
+  801c99:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  801c9d:	89 f2                	mov    %esi,%edx
+  801c9f:	eb 09                	jmp    801caa <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  801ca1:	83 c1 01             	add    $0x1,%ecx
+  801ca4:	83 c2 01             	add    $0x1,%edx
+  801ca7:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  801caa:	39 c2                	cmp    %eax,%edx
+  801cac:	74 09                	je     801cb7 <strlcpy+0x32>
+  801cae:	0f b6 19             	movzbl (%ecx),%ebx
+  801cb1:	84 db                	test   %bl,%bl
+  801cb3:	75 ec                	jne    801ca1 <strlcpy+0x1c>
+  801cb5:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  801cb7:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  801cba:	29 f0                	sub    %esi,%eax
+}
+  801cbc:	5b                   	pop    %ebx
+  801cbd:	5e                   	pop    %esi
+  801cbe:	5d                   	pop    %ebp
+  801cbf:	c3                   	ret
+
+00801cc0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  801cc0:	55                   	push   %ebp
+  801cc1:	89 e5                	mov    %esp,%ebp
+  801cc3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801cc6:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  801cc9:	eb 06                	jmp    801cd1 <strcmp+0x11>
+		p++, q++;
+  801ccb:	83 c1 01             	add    $0x1,%ecx
+  801cce:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  801cd1:	0f b6 01             	movzbl (%ecx),%eax
+  801cd4:	84 c0                	test   %al,%al
+  801cd6:	74 04                	je     801cdc <strcmp+0x1c>
+  801cd8:	3a 02                	cmp    (%edx),%al
+  801cda:	74 ef                	je     801ccb <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801cdc:	0f b6 c0             	movzbl %al,%eax
+  801cdf:	0f b6 12             	movzbl (%edx),%edx
+  801ce2:	29 d0                	sub    %edx,%eax
+}
+  801ce4:	5d                   	pop    %ebp
+  801ce5:	c3                   	ret
+
+00801ce6 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801ce6:	55                   	push   %ebp
+  801ce7:	89 e5                	mov    %esp,%ebp
+  801ce9:	53                   	push   %ebx
+  801cea:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ced:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801cf0:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  801cf3:	eb 09                	jmp    801cfe <strncmp+0x18>
+		n--, p++, q++;
+  801cf5:	83 ea 01             	sub    $0x1,%edx
+  801cf8:	83 c0 01             	add    $0x1,%eax
+  801cfb:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  801cfe:	85 d2                	test   %edx,%edx
+  801d00:	74 18                	je     801d1a <strncmp+0x34>
+  801d02:	0f b6 18             	movzbl (%eax),%ebx
+  801d05:	84 db                	test   %bl,%bl
+  801d07:	74 04                	je     801d0d <strncmp+0x27>
+  801d09:	3a 19                	cmp    (%ecx),%bl
+  801d0b:	74 e8                	je     801cf5 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801d0d:	0f b6 00             	movzbl (%eax),%eax
+  801d10:	0f b6 11             	movzbl (%ecx),%edx
+  801d13:	29 d0                	sub    %edx,%eax
+}
+  801d15:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d18:	c9                   	leave
+  801d19:	c3                   	ret
+		return 0;
+  801d1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d1f:	eb f4                	jmp    801d15 <strncmp+0x2f>
+
+00801d21 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801d21:	55                   	push   %ebp
+  801d22:	89 e5                	mov    %esp,%ebp
+  801d24:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d27:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801d2b:	eb 03                	jmp    801d30 <strchr+0xf>
+  801d2d:	83 c0 01             	add    $0x1,%eax
+  801d30:	0f b6 10             	movzbl (%eax),%edx
+  801d33:	84 d2                	test   %dl,%dl
+  801d35:	74 06                	je     801d3d <strchr+0x1c>
+		if (*s == c)
+  801d37:	38 ca                	cmp    %cl,%dl
+  801d39:	75 f2                	jne    801d2d <strchr+0xc>
+  801d3b:	eb 05                	jmp    801d42 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  801d3d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d42:	5d                   	pop    %ebp
+  801d43:	c3                   	ret
+
+00801d44 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801d44:	55                   	push   %ebp
+  801d45:	89 e5                	mov    %esp,%ebp
+  801d47:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d4a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801d4e:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  801d51:	38 ca                	cmp    %cl,%dl
+  801d53:	74 09                	je     801d5e <strfind+0x1a>
+  801d55:	84 d2                	test   %dl,%dl
+  801d57:	74 05                	je     801d5e <strfind+0x1a>
+	for (; *s; s++)
+  801d59:	83 c0 01             	add    $0x1,%eax
+  801d5c:	eb f0                	jmp    801d4e <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  801d5e:	5d                   	pop    %ebp
+  801d5f:	c3                   	ret
+
+00801d60 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801d60:	55                   	push   %ebp
+  801d61:	89 e5                	mov    %esp,%ebp
+  801d63:	57                   	push   %edi
+  801d64:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801d67:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  801d6a:	85 c9                	test   %ecx,%ecx
+  801d6c:	74 20                	je     801d8e <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  801d6e:	89 f8                	mov    %edi,%eax
+  801d70:	09 c8                	or     %ecx,%eax
+  801d72:	a8 03                	test   $0x3,%al
+  801d74:	75 12                	jne    801d88 <memset+0x28>
+		c &= 0xFF;
+  801d76:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  801d7a:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  801d80:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  801d83:	fc                   	cld
+  801d84:	f3 ab                	rep stos %eax,%es:(%edi)
+  801d86:	eb 06                	jmp    801d8e <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801d88:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d8b:	fc                   	cld
+  801d8c:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  801d8e:	89 f8                	mov    %edi,%eax
+  801d90:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  801d93:	c9                   	leave
+  801d94:	c3                   	ret
+
+00801d95 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801d95:	55                   	push   %ebp
+  801d96:	89 e5                	mov    %esp,%ebp
+  801d98:	57                   	push   %edi
+  801d99:	56                   	push   %esi
+  801d9a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d9d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801da0:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  801da3:	39 c6                	cmp    %eax,%esi
+  801da5:	73 32                	jae    801dd9 <memmove+0x44>
+  801da7:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  801daa:	39 d0                	cmp    %edx,%eax
+  801dac:	73 2b                	jae    801dd9 <memmove+0x44>
+		s += n;
+		d += n;
+  801dae:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801db1:	89 d6                	mov    %edx,%esi
+  801db3:	09 fe                	or     %edi,%esi
+  801db5:	09 ce                	or     %ecx,%esi
+  801db7:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  801dbd:	75 0e                	jne    801dcd <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801dbf:	83 ef 04             	sub    $0x4,%edi
+  801dc2:	8d 72 fc             	lea    -0x4(%edx),%esi
+  801dc5:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  801dc8:	fd                   	std
+  801dc9:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801dcb:	eb 09                	jmp    801dd6 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801dcd:	83 ef 01             	sub    $0x1,%edi
+  801dd0:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  801dd3:	fd                   	std
+  801dd4:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801dd6:	fc                   	cld
+  801dd7:	eb 1a                	jmp    801df3 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801dd9:	89 f2                	mov    %esi,%edx
+  801ddb:	09 c2                	or     %eax,%edx
+  801ddd:	09 ca                	or     %ecx,%edx
+  801ddf:	f6 c2 03             	test   $0x3,%dl
+  801de2:	75 0a                	jne    801dee <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801de4:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  801de7:	89 c7                	mov    %eax,%edi
+  801de9:	fc                   	cld
+  801dea:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801dec:	eb 05                	jmp    801df3 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  801dee:	89 c7                	mov    %eax,%edi
+  801df0:	fc                   	cld
+  801df1:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  801df3:	5e                   	pop    %esi
+  801df4:	5f                   	pop    %edi
+  801df5:	5d                   	pop    %ebp
+  801df6:	c3                   	ret
+
+00801df7 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801df7:	55                   	push   %ebp
+  801df8:	89 e5                	mov    %esp,%ebp
+  801dfa:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  801dfd:	ff 75 10             	push   0x10(%ebp)
+  801e00:	ff 75 0c             	push   0xc(%ebp)
+  801e03:	ff 75 08             	push   0x8(%ebp)
+  801e06:	e8 8a ff ff ff       	call   801d95 <memmove>
+}
+  801e0b:	c9                   	leave
+  801e0c:	c3                   	ret
+
+00801e0d <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801e0d:	55                   	push   %ebp
+  801e0e:	89 e5                	mov    %esp,%ebp
+  801e10:	56                   	push   %esi
+  801e11:	53                   	push   %ebx
+  801e12:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e15:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  801e18:	89 c6                	mov    %eax,%esi
+  801e1a:	03 75 10             	add    0x10(%ebp),%esi
+  801e1d:	eb 06                	jmp    801e25 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  801e1f:	83 c0 01             	add    $0x1,%eax
+  801e22:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  801e25:	39 f0                	cmp    %esi,%eax
+  801e27:	74 14                	je     801e3d <memcmp+0x30>
+		if (*s1 != *s2)
+  801e29:	0f b6 08             	movzbl (%eax),%ecx
+  801e2c:	0f b6 1a             	movzbl (%edx),%ebx
+  801e2f:	38 d9                	cmp    %bl,%cl
+  801e31:	74 ec                	je     801e1f <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  801e33:	0f b6 c1             	movzbl %cl,%eax
+  801e36:	0f b6 db             	movzbl %bl,%ebx
+  801e39:	29 d8                	sub    %ebx,%eax
+  801e3b:	eb 05                	jmp    801e42 <memcmp+0x35>
+	}
+
+	return 0;
+  801e3d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e42:	5b                   	pop    %ebx
+  801e43:	5e                   	pop    %esi
+  801e44:	5d                   	pop    %ebp
+  801e45:	c3                   	ret
+
+00801e46 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801e46:	55                   	push   %ebp
+  801e47:	89 e5                	mov    %esp,%ebp
+  801e49:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e4c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  801e4f:	89 c2                	mov    %eax,%edx
+  801e51:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  801e54:	eb 03                	jmp    801e59 <memfind+0x13>
+  801e56:	83 c0 01             	add    $0x1,%eax
+  801e59:	39 d0                	cmp    %edx,%eax
+  801e5b:	73 04                	jae    801e61 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801e5d:	38 08                	cmp    %cl,(%eax)
+  801e5f:	75 f5                	jne    801e56 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  801e61:	5d                   	pop    %ebp
+  801e62:	c3                   	ret
+
+00801e63 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  801e63:	55                   	push   %ebp
+  801e64:	89 e5                	mov    %esp,%ebp
+  801e66:	57                   	push   %edi
+  801e67:	56                   	push   %esi
+  801e68:	53                   	push   %ebx
+  801e69:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e6c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801e6f:	eb 03                	jmp    801e74 <strtol+0x11>
+		s++;
+  801e71:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  801e74:	0f b6 02             	movzbl (%edx),%eax
+  801e77:	3c 20                	cmp    $0x20,%al
+  801e79:	74 f6                	je     801e71 <strtol+0xe>
+  801e7b:	3c 09                	cmp    $0x9,%al
+  801e7d:	74 f2                	je     801e71 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  801e7f:	3c 2b                	cmp    $0x2b,%al
+  801e81:	74 2a                	je     801ead <strtol+0x4a>
+	int neg = 0;
+  801e83:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  801e88:	3c 2d                	cmp    $0x2d,%al
+  801e8a:	74 2b                	je     801eb7 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801e8c:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  801e92:	75 0f                	jne    801ea3 <strtol+0x40>
+  801e94:	80 3a 30             	cmpb   $0x30,(%edx)
+  801e97:	74 28                	je     801ec1 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  801e99:	85 db                	test   %ebx,%ebx
+  801e9b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801ea0:	0f 44 d8             	cmove  %eax,%ebx
+  801ea3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ea8:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  801eab:	eb 46                	jmp    801ef3 <strtol+0x90>
+		s++;
+  801ead:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  801eb0:	bf 00 00 00 00       	mov    $0x0,%edi
+  801eb5:	eb d5                	jmp    801e8c <strtol+0x29>
+		s++, neg = 1;
+  801eb7:	83 c2 01             	add    $0x1,%edx
+  801eba:	bf 01 00 00 00       	mov    $0x1,%edi
+  801ebf:	eb cb                	jmp    801e8c <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801ec1:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  801ec5:	74 0e                	je     801ed5 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  801ec7:	85 db                	test   %ebx,%ebx
+  801ec9:	75 d8                	jne    801ea3 <strtol+0x40>
+		s++, base = 8;
+  801ecb:	83 c2 01             	add    $0x1,%edx
+  801ece:	bb 08 00 00 00       	mov    $0x8,%ebx
+  801ed3:	eb ce                	jmp    801ea3 <strtol+0x40>
+		s += 2, base = 16;
+  801ed5:	83 c2 02             	add    $0x2,%edx
+  801ed8:	bb 10 00 00 00       	mov    $0x10,%ebx
+  801edd:	eb c4                	jmp    801ea3 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  801edf:	0f be c0             	movsbl %al,%eax
+  801ee2:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  801ee5:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801ee8:	7d 3a                	jge    801f24 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  801eea:	83 c2 01             	add    $0x1,%edx
+  801eed:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  801ef1:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  801ef3:	0f b6 02             	movzbl (%edx),%eax
+  801ef6:	8d 70 d0             	lea    -0x30(%eax),%esi
+  801ef9:	89 f3                	mov    %esi,%ebx
+  801efb:	80 fb 09             	cmp    $0x9,%bl
+  801efe:	76 df                	jbe    801edf <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  801f00:	8d 70 9f             	lea    -0x61(%eax),%esi
+  801f03:	89 f3                	mov    %esi,%ebx
+  801f05:	80 fb 19             	cmp    $0x19,%bl
+  801f08:	77 08                	ja     801f12 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  801f0a:	0f be c0             	movsbl %al,%eax
+  801f0d:	83 e8 57             	sub    $0x57,%eax
+  801f10:	eb d3                	jmp    801ee5 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  801f12:	8d 70 bf             	lea    -0x41(%eax),%esi
+  801f15:	89 f3                	mov    %esi,%ebx
+  801f17:	80 fb 19             	cmp    $0x19,%bl
+  801f1a:	77 08                	ja     801f24 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  801f1c:	0f be c0             	movsbl %al,%eax
+  801f1f:	83 e8 37             	sub    $0x37,%eax
+  801f22:	eb c1                	jmp    801ee5 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801f24:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  801f28:	74 05                	je     801f2f <strtol+0xcc>
+		*endptr = (char *) s;
+  801f2a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f2d:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  801f2f:	89 c8                	mov    %ecx,%eax
+  801f31:	f7 d8                	neg    %eax
+  801f33:	85 ff                	test   %edi,%edi
+  801f35:	0f 45 c8             	cmovne %eax,%ecx
+}
+  801f38:	89 c8                	mov    %ecx,%eax
+  801f3a:	5b                   	pop    %ebx
+  801f3b:	5e                   	pop    %esi
+  801f3c:	5f                   	pop    %edi
+  801f3d:	5d                   	pop    %ebp
+  801f3e:	c3                   	ret
+
+00801f3f <set_pgfault_handler>:
+// allocate an exception stack (one page of memory with its top
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf)) {
+  801f3f:	55                   	push   %ebp
+  801f40:	89 e5                	mov    %esp,%ebp
+  801f42:	83 ec 08             	sub    $0x8,%esp
+  int r;
+
+  if (_pgfault_handler == 0) {
+  801f45:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  801f4c:	74 0a                	je     801f58 <set_pgfault_handler+0x19>
+    if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)))
+      panic(" set_pgfault_handler sys_env_set_pgfault_upcall panic: %e\n", r);
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  801f4e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f51:	a3 00 70 80 00       	mov    %eax,0x807000
+
+
+}
+  801f56:	c9                   	leave
+  801f57:	c3                   	ret
+    if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)))
+  801f58:	83 ec 04             	sub    $0x4,%esp
+  801f5b:	6a 07                	push   $0x7
+  801f5d:	68 00 f0 bf ee       	push   $0xeebff000
+  801f62:	6a 00                	push   $0x0
+  801f64:	e8 0a e2 ff ff       	call   800173 <sys_page_alloc>
+  801f69:	83 c4 10             	add    $0x10,%esp
+  801f6c:	85 c0                	test   %eax,%eax
+  801f6e:	75 28                	jne    801f98 <set_pgfault_handler+0x59>
+    if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)))
+  801f70:	83 ec 08             	sub    $0x8,%esp
+  801f73:	68 46 04 80 00       	push   $0x800446
+  801f78:	6a 00                	push   $0x0
+  801f7a:	e8 3f e3 ff ff       	call   8002be <sys_env_set_pgfault_upcall>
+  801f7f:	83 c4 10             	add    $0x10,%esp
+  801f82:	85 c0                	test   %eax,%eax
+  801f84:	74 c8                	je     801f4e <set_pgfault_handler+0xf>
+      panic(" set_pgfault_handler sys_env_set_pgfault_upcall panic: %e\n", r);
+  801f86:	50                   	push   %eax
+  801f87:	68 54 2a 80 00       	push   $0x802a54
+  801f8c:	6a 22                	push   $0x22
+  801f8e:	68 8f 2a 80 00       	push   $0x802a8f
+  801f93:	e8 e3 f5 ff ff       	call   80157b <_panic>
+      panic("set_pgfault_handler sys_page_alloc panic: %e\n", r);
+  801f98:	50                   	push   %eax
+  801f99:	68 24 2a 80 00       	push   $0x802a24
+  801f9e:	6a 20                	push   $0x20
+  801fa0:	68 8f 2a 80 00       	push   $0x802a8f
+  801fa5:	e8 d1 f5 ff ff       	call   80157b <_panic>
+
+00801faa <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  801faa:	55                   	push   %ebp
+  801fab:	89 e5                	mov    %esp,%ebp
+  801fad:	56                   	push   %esi
+  801fae:	53                   	push   %ebx
+  801faf:	8b 75 08             	mov    0x8(%ebp),%esi
+  801fb2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fb5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  801fb8:	85 c0                	test   %eax,%eax
+  801fba:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801fbf:	0f 44 c2             	cmove  %edx,%eax
+  801fc2:	83 ec 0c             	sub    $0xc,%esp
+  801fc5:	50                   	push   %eax
+  801fc6:	e8 58 e3 ff ff       	call   800323 <sys_ipc_recv>
+
+  if (from_env_store)
+  801fcb:	83 c4 10             	add    $0x10,%esp
+  801fce:	85 f6                	test   %esi,%esi
+  801fd0:	74 17                	je     801fe9 <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  801fd2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fd7:	85 c0                	test   %eax,%eax
+  801fd9:	75 0c                	jne    801fe7 <ipc_recv+0x3d>
+  801fdb:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801fe1:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  801fe7:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  801fe9:	85 db                	test   %ebx,%ebx
+  801feb:	74 2b                	je     802018 <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  801fed:	85 c0                	test   %eax,%eax
+  801fef:	74 0d                	je     801ffe <ipc_recv+0x54>
+  801ff1:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  801ff7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ffa:	5b                   	pop    %ebx
+  801ffb:	5e                   	pop    %esi
+  801ffc:	5d                   	pop    %ebp
+  801ffd:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  801ffe:	a1 08 40 80 00       	mov    0x804008,%eax
+  802003:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  802009:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  80200b:	a1 08 40 80 00       	mov    0x804008,%eax
+  802010:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  802016:	eb df                	jmp    801ff7 <ipc_recv+0x4d>
+  802018:	85 c0                	test   %eax,%eax
+  80201a:	75 db                	jne    801ff7 <ipc_recv+0x4d>
+  80201c:	eb ed                	jmp    80200b <ipc_recv+0x61>
+
+0080201e <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  80201e:	55                   	push   %ebp
+  80201f:	89 e5                	mov    %esp,%ebp
+  802021:	57                   	push   %edi
+  802022:	56                   	push   %esi
+  802023:	53                   	push   %ebx
+  802024:	83 ec 0c             	sub    $0xc,%esp
+  802027:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80202a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80202d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  802030:	85 db                	test   %ebx,%ebx
+  802032:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802037:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  80203a:	ff 75 14             	push   0x14(%ebp)
+  80203d:	53                   	push   %ebx
+  80203e:	56                   	push   %esi
+  80203f:	57                   	push   %edi
+  802040:	e8 bb e2 ff ff       	call   800300 <sys_ipc_try_send>
+  802045:	83 c4 10             	add    $0x10,%esp
+  802048:	85 c0                	test   %eax,%eax
+  80204a:	74 1e                	je     80206a <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  80204c:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80204f:	75 07                	jne    802058 <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  802051:	e8 fe e0 ff ff       	call   800154 <sys_yield>
+  802056:	eb e2                	jmp    80203a <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  802058:	50                   	push   %eax
+  802059:	68 9d 2a 80 00       	push   $0x802a9d
+  80205e:	6a 3c                	push   $0x3c
+  802060:	68 aa 2a 80 00       	push   $0x802aaa
+  802065:	e8 11 f5 ff ff       	call   80157b <_panic>
+  }
+
+#endif
+}
+  80206a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80206d:	5b                   	pop    %ebx
+  80206e:	5e                   	pop    %esi
+  80206f:	5f                   	pop    %edi
+  802070:	5d                   	pop    %ebp
+  802071:	c3                   	ret
+
+00802072 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  802072:	55                   	push   %ebp
+  802073:	89 e5                	mov    %esp,%ebp
+  802075:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  802078:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  80207d:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802080:	c1 e0 04             	shl    $0x4,%eax
+  802083:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802088:	8b 40 50             	mov    0x50(%eax),%eax
+  80208b:	39 c8                	cmp    %ecx,%eax
+  80208d:	74 12                	je     8020a1 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  80208f:	83 c2 01             	add    $0x1,%edx
+  802092:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802098:	75 e3                	jne    80207d <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  80209a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80209f:	eb 0e                	jmp    8020af <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  8020a1:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8020a4:	c1 e0 04             	shl    $0x4,%eax
+  8020a7:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8020ac:	8b 40 48             	mov    0x48(%eax),%eax
+  8020af:	5d                   	pop    %ebp
+  8020b0:	c3                   	ret
+
+008020b1 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8020b1:	55                   	push   %ebp
+  8020b2:	89 e5                	mov    %esp,%ebp
+  8020b4:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8020b7:	89 c2                	mov    %eax,%edx
+  8020b9:	c1 ea 16             	shr    $0x16,%edx
+  8020bc:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8020c3:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8020c8:	f6 c1 01             	test   $0x1,%cl
+  8020cb:	74 1c                	je     8020e9 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  8020cd:	c1 e8 0c             	shr    $0xc,%eax
+  8020d0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8020d7:	a8 01                	test   $0x1,%al
+  8020d9:	74 0e                	je     8020e9 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8020db:	c1 e8 0c             	shr    $0xc,%eax
+  8020de:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  8020e5:	ef 
+  8020e6:	0f b7 d2             	movzwl %dx,%edx
+}
+  8020e9:	89 d0                	mov    %edx,%eax
+  8020eb:	5d                   	pop    %ebp
+  8020ec:	c3                   	ret
+  8020ed:	66 90                	xchg   %ax,%ax
+  8020ef:	90                   	nop
+
+008020f0 <__udivmoddi4>:
+  8020f0:	55                   	push   %ebp
+  8020f1:	57                   	push   %edi
+  8020f2:	56                   	push   %esi
+  8020f3:	53                   	push   %ebx
+  8020f4:	83 ec 24             	sub    $0x24,%esp
+  8020f7:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8020fb:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8020ff:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  802103:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802107:	8b 54 24 44          	mov    0x44(%esp),%edx
+  80210b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80210f:	8b 44 24 40          	mov    0x40(%esp),%eax
+  802113:	89 d3                	mov    %edx,%ebx
+  802115:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802119:	09 c3                	or     %eax,%ebx
+  80211b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80211f:	0f 84 9c 00 00 00    	je     8021c1 <__udivmoddi4+0xd1>
+  802125:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80212c:	00 
+  80212d:	31 c0                	xor    %eax,%eax
+  80212f:	31 d2                	xor    %edx,%edx
+  802131:	89 fb                	mov    %edi,%ebx
+  802133:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80213a:	00 
+  80213b:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802140:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802144:	01 c0                	add    %eax,%eax
+  802146:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80214d:	00 
+  80214e:	89 c6                	mov    %eax,%esi
+  802150:	89 d7                	mov    %edx,%edi
+  802152:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802156:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80215a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80215d:	d3 ea                	shr    %cl,%edx
+  80215f:	f6 c1 20             	test   $0x20,%cl
+  802162:	0f 45 c2             	cmovne %edx,%eax
+  802165:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802169:	83 e0 01             	and    $0x1,%eax
+  80216c:	09 fa                	or     %edi,%edx
+  80216e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802172:	89 04 24             	mov    %eax,(%esp)
+  802175:	8b 04 24             	mov    (%esp),%eax
+  802178:	89 d5                	mov    %edx,%ebp
+  80217a:	09 f0                	or     %esi,%eax
+  80217c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802180:	39 f0                	cmp    %esi,%eax
+  802182:	19 fd                	sbb    %edi,%ebp
+  802184:	72 1d                	jb     8021a3 <__udivmoddi4+0xb3>
+  802186:	29 f0                	sub    %esi,%eax
+  802188:	19 fa                	sbb    %edi,%edx
+  80218a:	89 cf                	mov    %ecx,%edi
+  80218c:	c1 ef 05             	shr    $0x5,%edi
+  80218f:	83 e7 01             	and    $0x1,%edi
+  802192:	89 fe                	mov    %edi,%esi
+  802194:	d3 e7                	shl    %cl,%edi
+  802196:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80219a:	83 f6 01             	xor    $0x1,%esi
+  80219d:	d3 e6                	shl    %cl,%esi
+  80219f:	09 74 24 18          	or     %esi,0x18(%esp)
+  8021a3:	83 e9 01             	sub    $0x1,%ecx
+  8021a6:	73 98                	jae    802140 <__udivmoddi4+0x50>
+  8021a8:	85 db                	test   %ebx,%ebx
+  8021aa:	74 05                	je     8021b1 <__udivmoddi4+0xc1>
+  8021ac:	89 03                	mov    %eax,(%ebx)
+  8021ae:	89 53 04             	mov    %edx,0x4(%ebx)
+  8021b1:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8021b5:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8021b9:	83 c4 24             	add    $0x24,%esp
+  8021bc:	5b                   	pop    %ebx
+  8021bd:	5e                   	pop    %esi
+  8021be:	5f                   	pop    %edi
+  8021bf:	5d                   	pop    %ebp
+  8021c0:	c3                   	ret
+  8021c1:	85 ff                	test   %edi,%edi
+  8021c3:	74 0d                	je     8021d2 <__udivmoddi4+0xe2>
+  8021c5:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  8021cb:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  8021d2:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8021d6:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8021da:	89 44 24 18          	mov    %eax,0x18(%esp)
+  8021de:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8021e2:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  8021e6:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8021ea:	83 c4 24             	add    $0x24,%esp
+  8021ed:	5b                   	pop    %ebx
+  8021ee:	5e                   	pop    %esi
+  8021ef:	5f                   	pop    %edi
+  8021f0:	5d                   	pop    %ebp
+  8021f1:	c3                   	ret
+  8021f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8021f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00802200 <__udivdi3>:
+  802200:	57                   	push   %edi
+  802201:	56                   	push   %esi
+  802202:	53                   	push   %ebx
+  802203:	83 ec 20             	sub    $0x20,%esp
+  802206:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80220a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80220e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802212:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802216:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80221a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80221e:	89 d1                	mov    %edx,%ecx
+  802220:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802224:	09 c1                	or     %eax,%ecx
+  802226:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80222a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80222e:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802232:	0f 84 88 00 00 00    	je     8022c0 <__udivdi3+0xc0>
+  802238:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80223f:	00 
+  802240:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802245:	31 c0                	xor    %eax,%eax
+  802247:	31 d2                	xor    %edx,%edx
+  802249:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802250:	00 
+  802251:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802258:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80225c:	01 c0                	add    %eax,%eax
+  80225e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802265:	00 
+  802266:	89 c6                	mov    %eax,%esi
+  802268:	89 d7                	mov    %edx,%edi
+  80226a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80226e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802272:	0f ad d0             	shrd   %cl,%edx,%eax
+  802275:	d3 ea                	shr    %cl,%edx
+  802277:	f6 c1 20             	test   $0x20,%cl
+  80227a:	0f 45 c2             	cmovne %edx,%eax
+  80227d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802281:	83 e0 01             	and    $0x1,%eax
+  802284:	09 fa                	or     %edi,%edx
+  802286:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80228a:	89 04 24             	mov    %eax,(%esp)
+  80228d:	8b 04 24             	mov    (%esp),%eax
+  802290:	89 d3                	mov    %edx,%ebx
+  802292:	09 f0                	or     %esi,%eax
+  802294:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802298:	39 f0                	cmp    %esi,%eax
+  80229a:	19 fb                	sbb    %edi,%ebx
+  80229c:	72 1d                	jb     8022bb <__udivdi3+0xbb>
+  80229e:	29 f0                	sub    %esi,%eax
+  8022a0:	19 fa                	sbb    %edi,%edx
+  8022a2:	89 cf                	mov    %ecx,%edi
+  8022a4:	c1 ef 05             	shr    $0x5,%edi
+  8022a7:	83 e7 01             	and    $0x1,%edi
+  8022aa:	89 fe                	mov    %edi,%esi
+  8022ac:	d3 e7                	shl    %cl,%edi
+  8022ae:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8022b2:	83 f6 01             	xor    $0x1,%esi
+  8022b5:	d3 e6                	shl    %cl,%esi
+  8022b7:	09 74 24 18          	or     %esi,0x18(%esp)
+  8022bb:	83 e9 01             	sub    $0x1,%ecx
+  8022be:	73 98                	jae    802258 <__udivdi3+0x58>
+  8022c0:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8022c4:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8022c8:	83 c4 20             	add    $0x20,%esp
+  8022cb:	5b                   	pop    %ebx
+  8022cc:	5e                   	pop    %esi
+  8022cd:	5f                   	pop    %edi
+  8022ce:	c3                   	ret
+  8022cf:	90                   	nop
+
+008022d0 <__umoddi3>:
+  8022d0:	57                   	push   %edi
+  8022d1:	56                   	push   %esi
+  8022d2:	53                   	push   %ebx
+  8022d3:	83 ec 18             	sub    $0x18,%esp
+  8022d6:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8022da:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8022de:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8022e2:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8022e6:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8022ea:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8022ee:	89 d1                	mov    %edx,%ecx
+  8022f0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8022f4:	09 c1                	or     %eax,%ecx
+  8022f6:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8022fa:	74 5b                	je     802357 <__umoddi3+0x87>
+  8022fc:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802301:	31 c0                	xor    %eax,%eax
+  802303:	31 d2                	xor    %edx,%edx
+  802305:	8d 76 00             	lea    0x0(%esi),%esi
+  802308:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80230c:	01 c0                	add    %eax,%eax
+  80230e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802315:	00 
+  802316:	89 c6                	mov    %eax,%esi
+  802318:	89 d7                	mov    %edx,%edi
+  80231a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80231e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802322:	0f ad d0             	shrd   %cl,%edx,%eax
+  802325:	d3 ea                	shr    %cl,%edx
+  802327:	f6 c1 20             	test   $0x20,%cl
+  80232a:	0f 45 c2             	cmovne %edx,%eax
+  80232d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802331:	83 e0 01             	and    $0x1,%eax
+  802334:	09 fa                	or     %edi,%edx
+  802336:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80233a:	89 04 24             	mov    %eax,(%esp)
+  80233d:	8b 04 24             	mov    (%esp),%eax
+  802340:	89 d3                	mov    %edx,%ebx
+  802342:	09 f0                	or     %esi,%eax
+  802344:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802348:	39 f0                	cmp    %esi,%eax
+  80234a:	19 fb                	sbb    %edi,%ebx
+  80234c:	72 04                	jb     802352 <__umoddi3+0x82>
+  80234e:	29 f0                	sub    %esi,%eax
+  802350:	19 fa                	sbb    %edi,%edx
+  802352:	83 e9 01             	sub    $0x1,%ecx
+  802355:	73 b1                	jae    802308 <__umoddi3+0x38>
+  802357:	83 c4 18             	add    $0x18,%esp
+  80235a:	5b                   	pop    %ebx
+  80235b:	5e                   	pop    %esi
+  80235c:	5f                   	pop    %edi
+  80235d:	c3                   	ret
+  80235e:	66 90                	xchg   %ax,%ax
+
+00802360 <__divdi3>:
+  802360:	55                   	push   %ebp
+  802361:	57                   	push   %edi
+  802362:	56                   	push   %esi
+  802363:	53                   	push   %ebx
+  802364:	83 ec 24             	sub    $0x24,%esp
+  802367:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  80236b:	8b 74 24 44          	mov    0x44(%esp),%esi
+  80236f:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802373:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802377:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  80237b:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  80237f:	85 d2                	test   %edx,%edx
+  802381:	0f 88 e0 00 00 00    	js     802467 <__divdi3+0x107>
+  802387:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  80238b:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  80238f:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802393:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802397:	85 f6                	test   %esi,%esi
+  802399:	78 16                	js     8023b1 <__divdi3+0x51>
+  80239b:	89 f1                	mov    %esi,%ecx
+  80239d:	31 c0                	xor    %eax,%eax
+  80239f:	31 d2                	xor    %edx,%edx
+  8023a1:	09 d9                	or     %ebx,%ecx
+  8023a3:	0f 85 f3 00 00 00    	jne    80249c <__divdi3+0x13c>
+  8023a9:	83 c4 24             	add    $0x24,%esp
+  8023ac:	5b                   	pop    %ebx
+  8023ad:	5e                   	pop    %esi
+  8023ae:	5f                   	pop    %edi
+  8023af:	5d                   	pop    %ebp
+  8023b0:	c3                   	ret
+  8023b1:	bf 01 00 00 00       	mov    $0x1,%edi
+  8023b6:	f7 5c 24 08          	negl   0x8(%esp)
+  8023ba:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  8023bf:	f7 5c 24 0c          	negl   0xc(%esp)
+  8023c3:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8023ca:	00 
+  8023cb:	31 c0                	xor    %eax,%eax
+  8023cd:	31 d2                	xor    %edx,%edx
+  8023cf:	89 fb                	mov    %edi,%ebx
+  8023d1:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8023d8:	00 
+  8023d9:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8023de:	66 90                	xchg   %ax,%ax
+  8023e0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8023e4:	01 c0                	add    %eax,%eax
+  8023e6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8023ed:	00 
+  8023ee:	89 c6                	mov    %eax,%esi
+  8023f0:	89 d7                	mov    %edx,%edi
+  8023f2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8023f6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8023fa:	0f ad d0             	shrd   %cl,%edx,%eax
+  8023fd:	d3 ea                	shr    %cl,%edx
+  8023ff:	f6 c1 20             	test   $0x20,%cl
+  802402:	0f 45 c2             	cmovne %edx,%eax
+  802405:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802409:	83 e0 01             	and    $0x1,%eax
+  80240c:	09 fa                	or     %edi,%edx
+  80240e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802412:	89 04 24             	mov    %eax,(%esp)
+  802415:	8b 04 24             	mov    (%esp),%eax
+  802418:	89 d5                	mov    %edx,%ebp
+  80241a:	09 f0                	or     %esi,%eax
+  80241c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802420:	39 f0                	cmp    %esi,%eax
+  802422:	19 fd                	sbb    %edi,%ebp
+  802424:	72 1d                	jb     802443 <__divdi3+0xe3>
+  802426:	29 f0                	sub    %esi,%eax
+  802428:	19 fa                	sbb    %edi,%edx
+  80242a:	89 cf                	mov    %ecx,%edi
+  80242c:	c1 ef 05             	shr    $0x5,%edi
+  80242f:	83 e7 01             	and    $0x1,%edi
+  802432:	89 fe                	mov    %edi,%esi
+  802434:	d3 e7                	shl    %cl,%edi
+  802436:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80243a:	83 f6 01             	xor    $0x1,%esi
+  80243d:	d3 e6                	shl    %cl,%esi
+  80243f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802443:	83 e9 01             	sub    $0x1,%ecx
+  802446:	73 98                	jae    8023e0 <__divdi3+0x80>
+  802448:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80244c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802450:	85 db                	test   %ebx,%ebx
+  802452:	0f 84 51 ff ff ff    	je     8023a9 <__divdi3+0x49>
+  802458:	f7 d8                	neg    %eax
+  80245a:	83 d2 00             	adc    $0x0,%edx
+  80245d:	83 c4 24             	add    $0x24,%esp
+  802460:	5b                   	pop    %ebx
+  802461:	f7 da                	neg    %edx
+  802463:	5e                   	pop    %esi
+  802464:	5f                   	pop    %edi
+  802465:	5d                   	pop    %ebp
+  802466:	c3                   	ret
+  802467:	f7 d8                	neg    %eax
+  802469:	83 d2 00             	adc    $0x0,%edx
+  80246c:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802470:	f7 da                	neg    %edx
+  802472:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802476:	85 f6                	test   %esi,%esi
+  802478:	78 1b                	js     802495 <__divdi3+0x135>
+  80247a:	89 f1                	mov    %esi,%ecx
+  80247c:	31 c0                	xor    %eax,%eax
+  80247e:	31 d2                	xor    %edx,%edx
+  802480:	bf 01 00 00 00       	mov    $0x1,%edi
+  802485:	09 d9                	or     %ebx,%ecx
+  802487:	0f 85 36 ff ff ff    	jne    8023c3 <__divdi3+0x63>
+  80248d:	83 c4 24             	add    $0x24,%esp
+  802490:	5b                   	pop    %ebx
+  802491:	5e                   	pop    %esi
+  802492:	5f                   	pop    %edi
+  802493:	5d                   	pop    %ebp
+  802494:	c3                   	ret
+  802495:	31 ff                	xor    %edi,%edi
+  802497:	e9 1a ff ff ff       	jmp    8023b6 <__divdi3+0x56>
+  80249c:	31 ff                	xor    %edi,%edi
+  80249e:	e9 20 ff ff ff       	jmp    8023c3 <__divdi3+0x63>
+  8024a3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8024aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+008024b0 <__moddi3>:
+  8024b0:	55                   	push   %ebp
+  8024b1:	57                   	push   %edi
+  8024b2:	56                   	push   %esi
+  8024b3:	53                   	push   %ebx
+  8024b4:	83 ec 1c             	sub    $0x1c,%esp
+  8024b7:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  8024bb:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  8024bf:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  8024c3:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  8024c7:	89 c8                	mov    %ecx,%eax
+  8024c9:	89 f2                	mov    %esi,%edx
+  8024cb:	89 f3                	mov    %esi,%ebx
+  8024cd:	85 ed                	test   %ebp,%ebp
+  8024cf:	0f 88 9d 00 00 00    	js     802572 <__moddi3+0xc2>
+  8024d5:	09 cb                	or     %ecx,%ebx
+  8024d7:	0f 84 8d 00 00 00    	je     80256a <__moddi3+0xba>
+  8024dd:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  8024e1:	31 db                	xor    %ebx,%ebx
+  8024e3:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  8024e7:	89 ca                	mov    %ecx,%edx
+  8024e9:	89 f0                	mov    %esi,%eax
+  8024eb:	89 dd                	mov    %ebx,%ebp
+  8024ed:	f7 da                	neg    %edx
+  8024ef:	83 d0 00             	adc    $0x0,%eax
+  8024f2:	f7 d8                	neg    %eax
+  8024f4:	0f 49 f0             	cmovns %eax,%esi
+  8024f7:	0f 49 ca             	cmovns %edx,%ecx
+  8024fa:	31 c0                	xor    %eax,%eax
+  8024fc:	31 d2                	xor    %edx,%edx
+  8024fe:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802502:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802506:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80250b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80250f:	90                   	nop
+  802510:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802514:	01 c0                	add    %eax,%eax
+  802516:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80251d:	00 
+  80251e:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  802522:	89 c6                	mov    %eax,%esi
+  802524:	89 d7                	mov    %edx,%edi
+  802526:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80252a:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80252e:	0f ad d0             	shrd   %cl,%edx,%eax
+  802531:	d3 ea                	shr    %cl,%edx
+  802533:	f6 c1 20             	test   $0x20,%cl
+  802536:	0f 45 c2             	cmovne %edx,%eax
+  802539:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80253d:	83 e0 01             	and    $0x1,%eax
+  802540:	09 fa                	or     %edi,%edx
+  802542:	89 04 24             	mov    %eax,(%esp)
+  802545:	8b 04 24             	mov    (%esp),%eax
+  802548:	89 d7                	mov    %edx,%edi
+  80254a:	09 f0                	or     %esi,%eax
+  80254c:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  802550:	39 d8                	cmp    %ebx,%eax
+  802552:	19 f7                	sbb    %esi,%edi
+  802554:	72 04                	jb     80255a <__moddi3+0xaa>
+  802556:	29 d8                	sub    %ebx,%eax
+  802558:	19 f2                	sbb    %esi,%edx
+  80255a:	83 e9 01             	sub    $0x1,%ecx
+  80255d:	73 b1                	jae    802510 <__moddi3+0x60>
+  80255f:	85 ed                	test   %ebp,%ebp
+  802561:	74 07                	je     80256a <__moddi3+0xba>
+  802563:	f7 d8                	neg    %eax
+  802565:	83 d2 00             	adc    $0x0,%edx
+  802568:	f7 da                	neg    %edx
+  80256a:	83 c4 1c             	add    $0x1c,%esp
+  80256d:	5b                   	pop    %ebx
+  80256e:	5e                   	pop    %esi
+  80256f:	5f                   	pop    %edi
+  802570:	5d                   	pop    %ebp
+  802571:	c3                   	ret
+  802572:	09 cb                	or     %ecx,%ebx
+  802574:	74 f4                	je     80256a <__moddi3+0xba>
+  802576:	f7 df                	neg    %edi
+  802578:	bb 01 00 00 00       	mov    $0x1,%ebx
+  80257d:	83 d5 00             	adc    $0x0,%ebp
+  802580:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802584:	f7 dd                	neg    %ebp
+  802586:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  80258a:	e9 58 ff ff ff       	jmp    8024e7 <__moddi3+0x37>
@@ -0,0 +1,5258 @@
+
+obj/user/faultread.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 1d 00 00 00       	call   80004e <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	cprintf("I read %08x from location 0!\n", *(unsigned*)0);
+  800039:	ff 35 00 00 00 00    	push   0x0
+  80003f:	68 00 25 80 00       	push   $0x802500
+  800044:	e8 fd 00 00 00       	call   800146 <cprintf>
+}
+  800049:	83 c4 10             	add    $0x10,%esp
+  80004c:	c9                   	leave
+  80004d:	c3                   	ret
+
+0080004e <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  80004e:	55                   	push   %ebp
+  80004f:	89 e5                	mov    %esp,%ebp
+  800051:	56                   	push   %esi
+  800052:	53                   	push   %ebx
+  800053:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800056:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  800059:	e8 4f 0a 00 00       	call   800aad <sys_getenvid>
+  80005e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800063:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800066:	c1 e0 04             	shl    $0x4,%eax
+  800069:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80006e:	a3 08 40 80 00       	mov    %eax,0x804008
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800073:	85 db                	test   %ebx,%ebx
+  800075:	7e 07                	jle    80007e <libmain+0x30>
+    binaryname = argv[0];
+  800077:	8b 06                	mov    (%esi),%eax
+  800079:	a3 00 30 80 00       	mov    %eax,0x803000
+
+  // call user main routine
+  umain(argc, argv);
+  80007e:	83 ec 08             	sub    $0x8,%esp
+  800081:	56                   	push   %esi
+  800082:	53                   	push   %ebx
+  800083:	e8 ab ff ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  800088:	e8 0a 00 00 00       	call   800097 <exit>
+}
+  80008d:	83 c4 10             	add    $0x10,%esp
+  800090:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800093:	5b                   	pop    %ebx
+  800094:	5e                   	pop    %esi
+  800095:	5d                   	pop    %ebp
+  800096:	c3                   	ret
+
+00800097 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800097:	55                   	push   %ebp
+  800098:	89 e5                	mov    %esp,%ebp
+  80009a:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80009d:	e8 f0 0e 00 00       	call   800f92 <close_all>
+	sys_env_destroy(0);
+  8000a2:	83 ec 0c             	sub    $0xc,%esp
+  8000a5:	6a 00                	push   $0x0
+  8000a7:	e8 c0 09 00 00       	call   800a6c <sys_env_destroy>
+}
+  8000ac:	83 c4 10             	add    $0x10,%esp
+  8000af:	c9                   	leave
+  8000b0:	c3                   	ret
+
+008000b1 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8000b1:	55                   	push   %ebp
+  8000b2:	89 e5                	mov    %esp,%ebp
+  8000b4:	53                   	push   %ebx
+  8000b5:	83 ec 04             	sub    $0x4,%esp
+  8000b8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8000bb:	8b 13                	mov    (%ebx),%edx
+  8000bd:	8d 42 01             	lea    0x1(%edx),%eax
+  8000c0:	89 03                	mov    %eax,(%ebx)
+  8000c2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8000c5:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8000c9:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8000ce:	74 09                	je     8000d9 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8000d0:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8000d4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000d7:	c9                   	leave
+  8000d8:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8000d9:	83 ec 08             	sub    $0x8,%esp
+  8000dc:	68 ff 00 00 00       	push   $0xff
+  8000e1:	8d 43 08             	lea    0x8(%ebx),%eax
+  8000e4:	50                   	push   %eax
+  8000e5:	e8 45 09 00 00       	call   800a2f <sys_cputs>
+		b->idx = 0;
+  8000ea:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8000f0:	83 c4 10             	add    $0x10,%esp
+  8000f3:	eb db                	jmp    8000d0 <putch+0x1f>
+
+008000f5 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8000f5:	55                   	push   %ebp
+  8000f6:	89 e5                	mov    %esp,%ebp
+  8000f8:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8000fe:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800105:	00 00 00 
+	b.cnt = 0;
+  800108:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80010f:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800112:	ff 75 0c             	push   0xc(%ebp)
+  800115:	ff 75 08             	push   0x8(%ebp)
+  800118:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80011e:	50                   	push   %eax
+  80011f:	68 b1 00 80 00       	push   $0x8000b1
+  800124:	e8 14 01 00 00       	call   80023d <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800129:	83 c4 08             	add    $0x8,%esp
+  80012c:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800132:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800138:	50                   	push   %eax
+  800139:	e8 f1 08 00 00       	call   800a2f <sys_cputs>
+
+	return b.cnt;
+}
+  80013e:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800144:	c9                   	leave
+  800145:	c3                   	ret
+
+00800146 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800146:	55                   	push   %ebp
+  800147:	89 e5                	mov    %esp,%ebp
+  800149:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80014c:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80014f:	50                   	push   %eax
+  800150:	ff 75 08             	push   0x8(%ebp)
+  800153:	e8 9d ff ff ff       	call   8000f5 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800158:	c9                   	leave
+  800159:	c3                   	ret
+
+0080015a <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80015a:	55                   	push   %ebp
+  80015b:	89 e5                	mov    %esp,%ebp
+  80015d:	57                   	push   %edi
+  80015e:	56                   	push   %esi
+  80015f:	53                   	push   %ebx
+  800160:	83 ec 1c             	sub    $0x1c,%esp
+  800163:	89 c7                	mov    %eax,%edi
+  800165:	89 d6                	mov    %edx,%esi
+  800167:	8b 45 08             	mov    0x8(%ebp),%eax
+  80016a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80016d:	89 d1                	mov    %edx,%ecx
+  80016f:	89 c2                	mov    %eax,%edx
+  800171:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800174:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800177:	8b 45 10             	mov    0x10(%ebp),%eax
+  80017a:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80017d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800180:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800187:	39 c2                	cmp    %eax,%edx
+  800189:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80018c:	72 3e                	jb     8001cc <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80018e:	83 ec 0c             	sub    $0xc,%esp
+  800191:	ff 75 18             	push   0x18(%ebp)
+  800194:	83 eb 01             	sub    $0x1,%ebx
+  800197:	53                   	push   %ebx
+  800198:	50                   	push   %eax
+  800199:	83 ec 08             	sub    $0x8,%esp
+  80019c:	ff 75 e4             	push   -0x1c(%ebp)
+  80019f:	ff 75 e0             	push   -0x20(%ebp)
+  8001a2:	ff 75 dc             	push   -0x24(%ebp)
+  8001a5:	ff 75 d8             	push   -0x28(%ebp)
+  8001a8:	e8 c3 1f 00 00       	call   802170 <__udivdi3>
+  8001ad:	83 c4 18             	add    $0x18,%esp
+  8001b0:	52                   	push   %edx
+  8001b1:	50                   	push   %eax
+  8001b2:	89 f2                	mov    %esi,%edx
+  8001b4:	89 f8                	mov    %edi,%eax
+  8001b6:	e8 9f ff ff ff       	call   80015a <printnum>
+  8001bb:	83 c4 20             	add    $0x20,%esp
+  8001be:	eb 13                	jmp    8001d3 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8001c0:	83 ec 08             	sub    $0x8,%esp
+  8001c3:	56                   	push   %esi
+  8001c4:	ff 75 18             	push   0x18(%ebp)
+  8001c7:	ff d7                	call   *%edi
+  8001c9:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8001cc:	83 eb 01             	sub    $0x1,%ebx
+  8001cf:	85 db                	test   %ebx,%ebx
+  8001d1:	7f ed                	jg     8001c0 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8001d3:	83 ec 08             	sub    $0x8,%esp
+  8001d6:	56                   	push   %esi
+  8001d7:	83 ec 04             	sub    $0x4,%esp
+  8001da:	ff 75 e4             	push   -0x1c(%ebp)
+  8001dd:	ff 75 e0             	push   -0x20(%ebp)
+  8001e0:	ff 75 dc             	push   -0x24(%ebp)
+  8001e3:	ff 75 d8             	push   -0x28(%ebp)
+  8001e6:	e8 55 20 00 00       	call   802240 <__umoddi3>
+  8001eb:	83 c4 14             	add    $0x14,%esp
+  8001ee:	0f be 80 28 25 80 00 	movsbl 0x802528(%eax),%eax
+  8001f5:	50                   	push   %eax
+  8001f6:	ff d7                	call   *%edi
+}
+  8001f8:	83 c4 10             	add    $0x10,%esp
+  8001fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001fe:	5b                   	pop    %ebx
+  8001ff:	5e                   	pop    %esi
+  800200:	5f                   	pop    %edi
+  800201:	5d                   	pop    %ebp
+  800202:	c3                   	ret
+
+00800203 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800203:	55                   	push   %ebp
+  800204:	89 e5                	mov    %esp,%ebp
+  800206:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800209:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80020d:	8b 10                	mov    (%eax),%edx
+  80020f:	3b 50 04             	cmp    0x4(%eax),%edx
+  800212:	73 0a                	jae    80021e <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800214:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800217:	89 08                	mov    %ecx,(%eax)
+  800219:	8b 45 08             	mov    0x8(%ebp),%eax
+  80021c:	88 02                	mov    %al,(%edx)
+}
+  80021e:	5d                   	pop    %ebp
+  80021f:	c3                   	ret
+
+00800220 <printfmt>:
+{
+  800220:	55                   	push   %ebp
+  800221:	89 e5                	mov    %esp,%ebp
+  800223:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800226:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800229:	50                   	push   %eax
+  80022a:	ff 75 10             	push   0x10(%ebp)
+  80022d:	ff 75 0c             	push   0xc(%ebp)
+  800230:	ff 75 08             	push   0x8(%ebp)
+  800233:	e8 05 00 00 00       	call   80023d <vprintfmt>
+}
+  800238:	83 c4 10             	add    $0x10,%esp
+  80023b:	c9                   	leave
+  80023c:	c3                   	ret
+
+0080023d <vprintfmt>:
+{
+  80023d:	55                   	push   %ebp
+  80023e:	89 e5                	mov    %esp,%ebp
+  800240:	57                   	push   %edi
+  800241:	56                   	push   %esi
+  800242:	53                   	push   %ebx
+  800243:	83 ec 2c             	sub    $0x2c,%esp
+  800246:	8b 75 08             	mov    0x8(%ebp),%esi
+  800249:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80024c:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80024f:	eb 0a                	jmp    80025b <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800251:	83 ec 08             	sub    $0x8,%esp
+  800254:	53                   	push   %ebx
+  800255:	50                   	push   %eax
+  800256:	ff d6                	call   *%esi
+  800258:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80025b:	83 c7 01             	add    $0x1,%edi
+  80025e:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800262:	83 f8 25             	cmp    $0x25,%eax
+  800265:	74 0c                	je     800273 <vprintfmt+0x36>
+			if (ch == '\0')
+  800267:	85 c0                	test   %eax,%eax
+  800269:	75 e6                	jne    800251 <vprintfmt+0x14>
+}
+  80026b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80026e:	5b                   	pop    %ebx
+  80026f:	5e                   	pop    %esi
+  800270:	5f                   	pop    %edi
+  800271:	5d                   	pop    %ebp
+  800272:	c3                   	ret
+		padc = ' ';
+  800273:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800277:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80027e:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800285:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80028c:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800291:	8d 47 01             	lea    0x1(%edi),%eax
+  800294:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800297:	0f b6 17             	movzbl (%edi),%edx
+  80029a:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80029d:	3c 55                	cmp    $0x55,%al
+  80029f:	0f 87 9a 03 00 00    	ja     80063f <vprintfmt+0x402>
+  8002a5:	0f b6 c0             	movzbl %al,%eax
+  8002a8:	ff 24 85 60 26 80 00 	jmp    *0x802660(,%eax,4)
+  8002af:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8002b2:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8002b6:	eb d9                	jmp    800291 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8002b8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8002bb:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8002bf:	eb d0                	jmp    800291 <vprintfmt+0x54>
+  8002c1:	0f b6 d2             	movzbl %dl,%edx
+  8002c4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8002c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002cc:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8002cf:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8002d2:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8002d6:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8002d9:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8002dc:	83 f9 09             	cmp    $0x9,%ecx
+  8002df:	77 55                	ja     800336 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8002e1:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8002e4:	eb e9                	jmp    8002cf <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8002e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8002e9:	8b 00                	mov    (%eax),%eax
+  8002eb:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8002ee:	8b 45 14             	mov    0x14(%ebp),%eax
+  8002f1:	8d 40 04             	lea    0x4(%eax),%eax
+  8002f4:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8002f7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8002fa:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8002fe:	79 91                	jns    800291 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800300:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800303:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800306:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80030d:	eb 82                	jmp    800291 <vprintfmt+0x54>
+			if (width < 0)
+  80030f:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800312:	85 d2                	test   %edx,%edx
+  800314:	b8 00 00 00 00       	mov    $0x0,%eax
+  800319:	0f 49 c2             	cmovns %edx,%eax
+  80031c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80031f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800322:	e9 6a ff ff ff       	jmp    800291 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800327:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80032a:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800331:	e9 5b ff ff ff       	jmp    800291 <vprintfmt+0x54>
+  800336:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800339:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80033c:	eb bc                	jmp    8002fa <vprintfmt+0xbd>
+			lflag++;
+  80033e:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800341:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800344:	e9 48 ff ff ff       	jmp    800291 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800349:	8b 45 14             	mov    0x14(%ebp),%eax
+  80034c:	8d 78 04             	lea    0x4(%eax),%edi
+  80034f:	83 ec 08             	sub    $0x8,%esp
+  800352:	53                   	push   %ebx
+  800353:	ff 30                	push   (%eax)
+  800355:	ff d6                	call   *%esi
+			break;
+  800357:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80035a:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80035d:	e9 7c 02 00 00       	jmp    8005de <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  800362:	8b 45 14             	mov    0x14(%ebp),%eax
+  800365:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800368:	8b 10                	mov    (%eax),%edx
+  80036a:	89 d0                	mov    %edx,%eax
+  80036c:	f7 d8                	neg    %eax
+  80036e:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800371:	83 f8 10             	cmp    $0x10,%eax
+  800374:	7f 23                	jg     800399 <vprintfmt+0x15c>
+  800376:	8b 14 85 c0 27 80 00 	mov    0x8027c0(,%eax,4),%edx
+  80037d:	85 d2                	test   %edx,%edx
+  80037f:	74 18                	je     800399 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800381:	52                   	push   %edx
+  800382:	68 f9 28 80 00       	push   $0x8028f9
+  800387:	53                   	push   %ebx
+  800388:	56                   	push   %esi
+  800389:	e8 92 fe ff ff       	call   800220 <printfmt>
+  80038e:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800391:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800394:	e9 45 02 00 00       	jmp    8005de <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  800399:	50                   	push   %eax
+  80039a:	68 40 25 80 00       	push   $0x802540
+  80039f:	53                   	push   %ebx
+  8003a0:	56                   	push   %esi
+  8003a1:	e8 7a fe ff ff       	call   800220 <printfmt>
+  8003a6:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003a9:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8003ac:	e9 2d 02 00 00       	jmp    8005de <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8003b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003b4:	83 c0 04             	add    $0x4,%eax
+  8003b7:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8003ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003bd:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8003bf:	85 c9                	test   %ecx,%ecx
+  8003c1:	b8 39 25 80 00       	mov    $0x802539,%eax
+  8003c6:	0f 45 c1             	cmovne %ecx,%eax
+  8003c9:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8003cc:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003d0:	7e 06                	jle    8003d8 <vprintfmt+0x19b>
+  8003d2:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8003d6:	75 0b                	jne    8003e3 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8003d8:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8003db:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8003de:	89 75 08             	mov    %esi,0x8(%ebp)
+  8003e1:	eb 5c                	jmp    80043f <vprintfmt+0x202>
+  8003e3:	83 ec 08             	sub    $0x8,%esp
+  8003e6:	ff 75 d0             	push   -0x30(%ebp)
+  8003e9:	ff 75 cc             	push   -0x34(%ebp)
+  8003ec:	e8 eb 02 00 00       	call   8006dc <strnlen>
+  8003f1:	89 c2                	mov    %eax,%edx
+  8003f3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8003f6:	29 d0                	sub    %edx,%eax
+  8003f8:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8003fb:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8003ff:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800402:	89 75 08             	mov    %esi,0x8(%ebp)
+  800405:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800407:	eb 0e                	jmp    800417 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800409:	83 ec 08             	sub    $0x8,%esp
+  80040c:	53                   	push   %ebx
+  80040d:	57                   	push   %edi
+  80040e:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800411:	83 ee 01             	sub    $0x1,%esi
+  800414:	83 c4 10             	add    $0x10,%esp
+  800417:	85 f6                	test   %esi,%esi
+  800419:	7f ee                	jg     800409 <vprintfmt+0x1cc>
+  80041b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80041e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800421:	85 c0                	test   %eax,%eax
+  800423:	ba 00 00 00 00       	mov    $0x0,%edx
+  800428:	0f 49 d0             	cmovns %eax,%edx
+  80042b:	29 d0                	sub    %edx,%eax
+  80042d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800430:	eb a6                	jmp    8003d8 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800432:	83 ec 08             	sub    $0x8,%esp
+  800435:	53                   	push   %ebx
+  800436:	52                   	push   %edx
+  800437:	ff 55 08             	call   *0x8(%ebp)
+  80043a:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80043d:	89 f1                	mov    %esi,%ecx
+  80043f:	8d 71 01             	lea    0x1(%ecx),%esi
+  800442:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800446:	0f be d0             	movsbl %al,%edx
+  800449:	85 d2                	test   %edx,%edx
+  80044b:	74 28                	je     800475 <vprintfmt+0x238>
+  80044d:	85 ff                	test   %edi,%edi
+  80044f:	78 05                	js     800456 <vprintfmt+0x219>
+  800451:	83 ef 01             	sub    $0x1,%edi
+  800454:	78 30                	js     800486 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800456:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80045a:	74 d6                	je     800432 <vprintfmt+0x1f5>
+  80045c:	0f be c0             	movsbl %al,%eax
+  80045f:	83 e8 20             	sub    $0x20,%eax
+  800462:	83 f8 5e             	cmp    $0x5e,%eax
+  800465:	76 cb                	jbe    800432 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800467:	83 ec 08             	sub    $0x8,%esp
+  80046a:	53                   	push   %ebx
+  80046b:	6a 3f                	push   $0x3f
+  80046d:	ff 55 08             	call   *0x8(%ebp)
+  800470:	83 c4 10             	add    $0x10,%esp
+  800473:	eb c8                	jmp    80043d <vprintfmt+0x200>
+  800475:	8b 75 08             	mov    0x8(%ebp),%esi
+  800478:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80047b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80047e:	01 d0                	add    %edx,%eax
+  800480:	29 c8                	sub    %ecx,%eax
+  800482:	89 c7                	mov    %eax,%edi
+  800484:	eb 13                	jmp    800499 <vprintfmt+0x25c>
+  800486:	8b 75 08             	mov    0x8(%ebp),%esi
+  800489:	eb ed                	jmp    800478 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80048b:	83 ec 08             	sub    $0x8,%esp
+  80048e:	53                   	push   %ebx
+  80048f:	6a 20                	push   $0x20
+  800491:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800493:	83 ef 01             	sub    $0x1,%edi
+  800496:	83 c4 10             	add    $0x10,%esp
+  800499:	85 ff                	test   %edi,%edi
+  80049b:	7f ee                	jg     80048b <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80049d:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8004a0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004a3:	e9 36 01 00 00       	jmp    8005de <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  8004a8:	83 f9 01             	cmp    $0x1,%ecx
+  8004ab:	7f 1f                	jg     8004cc <vprintfmt+0x28f>
+	else if (lflag)
+  8004ad:	85 c9                	test   %ecx,%ecx
+  8004af:	74 67                	je     800518 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8004b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004b4:	8b 00                	mov    (%eax),%eax
+  8004b6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004b9:	89 c1                	mov    %eax,%ecx
+  8004bb:	c1 f9 1f             	sar    $0x1f,%ecx
+  8004be:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8004c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004c4:	8d 40 04             	lea    0x4(%eax),%eax
+  8004c7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004ca:	eb 17                	jmp    8004e3 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8004cc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004cf:	8b 50 04             	mov    0x4(%eax),%edx
+  8004d2:	8b 00                	mov    (%eax),%eax
+  8004d4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004d7:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8004da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004dd:	8d 40 08             	lea    0x8(%eax),%eax
+  8004e0:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8004e3:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8004e6:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8004e9:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8004ee:	85 c9                	test   %ecx,%ecx
+  8004f0:	0f 89 ce 00 00 00    	jns    8005c4 <vprintfmt+0x387>
+				putch('-', putdat);
+  8004f6:	83 ec 08             	sub    $0x8,%esp
+  8004f9:	53                   	push   %ebx
+  8004fa:	6a 2d                	push   $0x2d
+  8004fc:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8004fe:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800501:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800504:	f7 da                	neg    %edx
+  800506:	83 d1 00             	adc    $0x0,%ecx
+  800509:	f7 d9                	neg    %ecx
+  80050b:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80050e:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800513:	e9 ac 00 00 00       	jmp    8005c4 <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  800518:	8b 45 14             	mov    0x14(%ebp),%eax
+  80051b:	8b 00                	mov    (%eax),%eax
+  80051d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800520:	89 c1                	mov    %eax,%ecx
+  800522:	c1 f9 1f             	sar    $0x1f,%ecx
+  800525:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800528:	8b 45 14             	mov    0x14(%ebp),%eax
+  80052b:	8d 40 04             	lea    0x4(%eax),%eax
+  80052e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800531:	eb b0                	jmp    8004e3 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800533:	83 f9 01             	cmp    $0x1,%ecx
+  800536:	7f 1b                	jg     800553 <vprintfmt+0x316>
+	else if (lflag)
+  800538:	85 c9                	test   %ecx,%ecx
+  80053a:	74 2c                	je     800568 <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  80053c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80053f:	8b 10                	mov    (%eax),%edx
+  800541:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800546:	8d 40 04             	lea    0x4(%eax),%eax
+  800549:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80054c:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800551:	eb 71                	jmp    8005c4 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  800553:	8b 45 14             	mov    0x14(%ebp),%eax
+  800556:	8b 10                	mov    (%eax),%edx
+  800558:	8b 48 04             	mov    0x4(%eax),%ecx
+  80055b:	8d 40 08             	lea    0x8(%eax),%eax
+  80055e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800561:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800566:	eb 5c                	jmp    8005c4 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  800568:	8b 45 14             	mov    0x14(%ebp),%eax
+  80056b:	8b 10                	mov    (%eax),%edx
+  80056d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800572:	8d 40 04             	lea    0x4(%eax),%eax
+  800575:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800578:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80057d:	eb 45                	jmp    8005c4 <vprintfmt+0x387>
+			putch('X', putdat);
+  80057f:	83 ec 08             	sub    $0x8,%esp
+  800582:	53                   	push   %ebx
+  800583:	6a 58                	push   $0x58
+  800585:	ff d6                	call   *%esi
+			putch('X', putdat);
+  800587:	83 c4 08             	add    $0x8,%esp
+  80058a:	53                   	push   %ebx
+  80058b:	6a 58                	push   $0x58
+  80058d:	ff d6                	call   *%esi
+			putch('X', putdat);
+  80058f:	83 c4 08             	add    $0x8,%esp
+  800592:	53                   	push   %ebx
+  800593:	6a 58                	push   $0x58
+  800595:	ff d6                	call   *%esi
+			break;
+  800597:	83 c4 10             	add    $0x10,%esp
+  80059a:	eb 42                	jmp    8005de <vprintfmt+0x3a1>
+			putch('0', putdat);
+  80059c:	83 ec 08             	sub    $0x8,%esp
+  80059f:	53                   	push   %ebx
+  8005a0:	6a 30                	push   $0x30
+  8005a2:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8005a4:	83 c4 08             	add    $0x8,%esp
+  8005a7:	53                   	push   %ebx
+  8005a8:	6a 78                	push   $0x78
+  8005aa:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8005ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005af:	8b 10                	mov    (%eax),%edx
+  8005b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8005b6:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8005b9:	8d 40 04             	lea    0x4(%eax),%eax
+  8005bc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8005bf:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8005c4:	83 ec 0c             	sub    $0xc,%esp
+  8005c7:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8005cb:	50                   	push   %eax
+  8005cc:	ff 75 e0             	push   -0x20(%ebp)
+  8005cf:	57                   	push   %edi
+  8005d0:	51                   	push   %ecx
+  8005d1:	52                   	push   %edx
+  8005d2:	89 da                	mov    %ebx,%edx
+  8005d4:	89 f0                	mov    %esi,%eax
+  8005d6:	e8 7f fb ff ff       	call   80015a <printnum>
+			break;
+  8005db:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8005de:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8005e1:	e9 75 fc ff ff       	jmp    80025b <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8005e6:	83 f9 01             	cmp    $0x1,%ecx
+  8005e9:	7f 1b                	jg     800606 <vprintfmt+0x3c9>
+	else if (lflag)
+  8005eb:	85 c9                	test   %ecx,%ecx
+  8005ed:	74 2c                	je     80061b <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  8005ef:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f2:	8b 10                	mov    (%eax),%edx
+  8005f4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005f9:	8d 40 04             	lea    0x4(%eax),%eax
+  8005fc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8005ff:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800604:	eb be                	jmp    8005c4 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  800606:	8b 45 14             	mov    0x14(%ebp),%eax
+  800609:	8b 10                	mov    (%eax),%edx
+  80060b:	8b 48 04             	mov    0x4(%eax),%ecx
+  80060e:	8d 40 08             	lea    0x8(%eax),%eax
+  800611:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800614:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800619:	eb a9                	jmp    8005c4 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  80061b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80061e:	8b 10                	mov    (%eax),%edx
+  800620:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800625:	8d 40 04             	lea    0x4(%eax),%eax
+  800628:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80062b:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800630:	eb 92                	jmp    8005c4 <vprintfmt+0x387>
+			putch(ch, putdat);
+  800632:	83 ec 08             	sub    $0x8,%esp
+  800635:	53                   	push   %ebx
+  800636:	6a 25                	push   $0x25
+  800638:	ff d6                	call   *%esi
+			break;
+  80063a:	83 c4 10             	add    $0x10,%esp
+  80063d:	eb 9f                	jmp    8005de <vprintfmt+0x3a1>
+			putch('%', putdat);
+  80063f:	83 ec 08             	sub    $0x8,%esp
+  800642:	53                   	push   %ebx
+  800643:	6a 25                	push   $0x25
+  800645:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800647:	83 c4 10             	add    $0x10,%esp
+  80064a:	89 f8                	mov    %edi,%eax
+  80064c:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800650:	74 05                	je     800657 <vprintfmt+0x41a>
+  800652:	83 e8 01             	sub    $0x1,%eax
+  800655:	eb f5                	jmp    80064c <vprintfmt+0x40f>
+  800657:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80065a:	eb 82                	jmp    8005de <vprintfmt+0x3a1>
+
+0080065c <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80065c:	55                   	push   %ebp
+  80065d:	89 e5                	mov    %esp,%ebp
+  80065f:	83 ec 18             	sub    $0x18,%esp
+  800662:	8b 45 08             	mov    0x8(%ebp),%eax
+  800665:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800668:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80066b:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80066f:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800672:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800679:	85 c0                	test   %eax,%eax
+  80067b:	74 26                	je     8006a3 <vsnprintf+0x47>
+  80067d:	85 d2                	test   %edx,%edx
+  80067f:	7e 22                	jle    8006a3 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800681:	ff 75 14             	push   0x14(%ebp)
+  800684:	ff 75 10             	push   0x10(%ebp)
+  800687:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80068a:	50                   	push   %eax
+  80068b:	68 03 02 80 00       	push   $0x800203
+  800690:	e8 a8 fb ff ff       	call   80023d <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800695:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800698:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80069b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80069e:	83 c4 10             	add    $0x10,%esp
+}
+  8006a1:	c9                   	leave
+  8006a2:	c3                   	ret
+		return -E_INVAL;
+  8006a3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006a8:	eb f7                	jmp    8006a1 <vsnprintf+0x45>
+
+008006aa <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8006aa:	55                   	push   %ebp
+  8006ab:	89 e5                	mov    %esp,%ebp
+  8006ad:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8006b0:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8006b3:	50                   	push   %eax
+  8006b4:	ff 75 10             	push   0x10(%ebp)
+  8006b7:	ff 75 0c             	push   0xc(%ebp)
+  8006ba:	ff 75 08             	push   0x8(%ebp)
+  8006bd:	e8 9a ff ff ff       	call   80065c <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8006c2:	c9                   	leave
+  8006c3:	c3                   	ret
+
+008006c4 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8006c4:	55                   	push   %ebp
+  8006c5:	89 e5                	mov    %esp,%ebp
+  8006c7:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8006ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006cf:	eb 03                	jmp    8006d4 <strlen+0x10>
+		n++;
+  8006d1:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8006d4:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8006d8:	75 f7                	jne    8006d1 <strlen+0xd>
+	return n;
+}
+  8006da:	5d                   	pop    %ebp
+  8006db:	c3                   	ret
+
+008006dc <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8006dc:	55                   	push   %ebp
+  8006dd:	89 e5                	mov    %esp,%ebp
+  8006df:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8006e2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8006e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006ea:	eb 03                	jmp    8006ef <strnlen+0x13>
+		n++;
+  8006ec:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8006ef:	39 d0                	cmp    %edx,%eax
+  8006f1:	74 08                	je     8006fb <strnlen+0x1f>
+  8006f3:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8006f7:	75 f3                	jne    8006ec <strnlen+0x10>
+  8006f9:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8006fb:	89 d0                	mov    %edx,%eax
+  8006fd:	5d                   	pop    %ebp
+  8006fe:	c3                   	ret
+
+008006ff <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8006ff:	55                   	push   %ebp
+  800700:	89 e5                	mov    %esp,%ebp
+  800702:	53                   	push   %ebx
+  800703:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800706:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800709:	b8 00 00 00 00       	mov    $0x0,%eax
+  80070e:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800712:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800715:	83 c0 01             	add    $0x1,%eax
+  800718:	84 d2                	test   %dl,%dl
+  80071a:	75 f2                	jne    80070e <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80071c:	89 c8                	mov    %ecx,%eax
+  80071e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800721:	c9                   	leave
+  800722:	c3                   	ret
+
+00800723 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800723:	55                   	push   %ebp
+  800724:	89 e5                	mov    %esp,%ebp
+  800726:	53                   	push   %ebx
+  800727:	83 ec 10             	sub    $0x10,%esp
+  80072a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80072d:	53                   	push   %ebx
+  80072e:	e8 91 ff ff ff       	call   8006c4 <strlen>
+  800733:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800736:	ff 75 0c             	push   0xc(%ebp)
+  800739:	01 d8                	add    %ebx,%eax
+  80073b:	50                   	push   %eax
+  80073c:	e8 be ff ff ff       	call   8006ff <strcpy>
+	return dst;
+}
+  800741:	89 d8                	mov    %ebx,%eax
+  800743:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800746:	c9                   	leave
+  800747:	c3                   	ret
+
+00800748 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800748:	55                   	push   %ebp
+  800749:	89 e5                	mov    %esp,%ebp
+  80074b:	56                   	push   %esi
+  80074c:	53                   	push   %ebx
+  80074d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800750:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800753:	89 f3                	mov    %esi,%ebx
+  800755:	03 5d 10             	add    0x10(%ebp),%ebx
+  800758:	89 f0                	mov    %esi,%eax
+  80075a:	eb 0f                	jmp    80076b <strncpy+0x23>
+		*dst++ = *src;
+  80075c:	83 c0 01             	add    $0x1,%eax
+  80075f:	0f b6 0a             	movzbl (%edx),%ecx
+  800762:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800765:	80 f9 01             	cmp    $0x1,%cl
+  800768:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80076b:	39 d8                	cmp    %ebx,%eax
+  80076d:	75 ed                	jne    80075c <strncpy+0x14>
+	}
+	return ret;
+}
+  80076f:	89 f0                	mov    %esi,%eax
+  800771:	5b                   	pop    %ebx
+  800772:	5e                   	pop    %esi
+  800773:	5d                   	pop    %ebp
+  800774:	c3                   	ret
+
+00800775 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800775:	55                   	push   %ebp
+  800776:	89 e5                	mov    %esp,%ebp
+  800778:	56                   	push   %esi
+  800779:	53                   	push   %ebx
+  80077a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80077d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800780:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800783:	89 f0                	mov    %esi,%eax
+  800785:	85 d2                	test   %edx,%edx
+  800787:	74 21                	je     8007aa <strlcpy+0x35>
+  800789:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80078d:	89 f2                	mov    %esi,%edx
+  80078f:	eb 09                	jmp    80079a <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800791:	83 c1 01             	add    $0x1,%ecx
+  800794:	83 c2 01             	add    $0x1,%edx
+  800797:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80079a:	39 c2                	cmp    %eax,%edx
+  80079c:	74 09                	je     8007a7 <strlcpy+0x32>
+  80079e:	0f b6 19             	movzbl (%ecx),%ebx
+  8007a1:	84 db                	test   %bl,%bl
+  8007a3:	75 ec                	jne    800791 <strlcpy+0x1c>
+  8007a5:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8007a7:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8007aa:	29 f0                	sub    %esi,%eax
+}
+  8007ac:	5b                   	pop    %ebx
+  8007ad:	5e                   	pop    %esi
+  8007ae:	5d                   	pop    %ebp
+  8007af:	c3                   	ret
+
+008007b0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8007b0:	55                   	push   %ebp
+  8007b1:	89 e5                	mov    %esp,%ebp
+  8007b3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007b6:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8007b9:	eb 06                	jmp    8007c1 <strcmp+0x11>
+		p++, q++;
+  8007bb:	83 c1 01             	add    $0x1,%ecx
+  8007be:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8007c1:	0f b6 01             	movzbl (%ecx),%eax
+  8007c4:	84 c0                	test   %al,%al
+  8007c6:	74 04                	je     8007cc <strcmp+0x1c>
+  8007c8:	3a 02                	cmp    (%edx),%al
+  8007ca:	74 ef                	je     8007bb <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8007cc:	0f b6 c0             	movzbl %al,%eax
+  8007cf:	0f b6 12             	movzbl (%edx),%edx
+  8007d2:	29 d0                	sub    %edx,%eax
+}
+  8007d4:	5d                   	pop    %ebp
+  8007d5:	c3                   	ret
+
+008007d6 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8007d6:	55                   	push   %ebp
+  8007d7:	89 e5                	mov    %esp,%ebp
+  8007d9:	53                   	push   %ebx
+  8007da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007dd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007e0:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8007e3:	eb 09                	jmp    8007ee <strncmp+0x18>
+		n--, p++, q++;
+  8007e5:	83 ea 01             	sub    $0x1,%edx
+  8007e8:	83 c0 01             	add    $0x1,%eax
+  8007eb:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8007ee:	85 d2                	test   %edx,%edx
+  8007f0:	74 18                	je     80080a <strncmp+0x34>
+  8007f2:	0f b6 18             	movzbl (%eax),%ebx
+  8007f5:	84 db                	test   %bl,%bl
+  8007f7:	74 04                	je     8007fd <strncmp+0x27>
+  8007f9:	3a 19                	cmp    (%ecx),%bl
+  8007fb:	74 e8                	je     8007e5 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8007fd:	0f b6 00             	movzbl (%eax),%eax
+  800800:	0f b6 11             	movzbl (%ecx),%edx
+  800803:	29 d0                	sub    %edx,%eax
+}
+  800805:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800808:	c9                   	leave
+  800809:	c3                   	ret
+		return 0;
+  80080a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80080f:	eb f4                	jmp    800805 <strncmp+0x2f>
+
+00800811 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800811:	55                   	push   %ebp
+  800812:	89 e5                	mov    %esp,%ebp
+  800814:	8b 45 08             	mov    0x8(%ebp),%eax
+  800817:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80081b:	eb 03                	jmp    800820 <strchr+0xf>
+  80081d:	83 c0 01             	add    $0x1,%eax
+  800820:	0f b6 10             	movzbl (%eax),%edx
+  800823:	84 d2                	test   %dl,%dl
+  800825:	74 06                	je     80082d <strchr+0x1c>
+		if (*s == c)
+  800827:	38 ca                	cmp    %cl,%dl
+  800829:	75 f2                	jne    80081d <strchr+0xc>
+  80082b:	eb 05                	jmp    800832 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  80082d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800832:	5d                   	pop    %ebp
+  800833:	c3                   	ret
+
+00800834 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800834:	55                   	push   %ebp
+  800835:	89 e5                	mov    %esp,%ebp
+  800837:	8b 45 08             	mov    0x8(%ebp),%eax
+  80083a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80083e:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800841:	38 ca                	cmp    %cl,%dl
+  800843:	74 09                	je     80084e <strfind+0x1a>
+  800845:	84 d2                	test   %dl,%dl
+  800847:	74 05                	je     80084e <strfind+0x1a>
+	for (; *s; s++)
+  800849:	83 c0 01             	add    $0x1,%eax
+  80084c:	eb f0                	jmp    80083e <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  80084e:	5d                   	pop    %ebp
+  80084f:	c3                   	ret
+
+00800850 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800850:	55                   	push   %ebp
+  800851:	89 e5                	mov    %esp,%ebp
+  800853:	57                   	push   %edi
+  800854:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800857:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  80085a:	85 c9                	test   %ecx,%ecx
+  80085c:	74 20                	je     80087e <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  80085e:	89 f8                	mov    %edi,%eax
+  800860:	09 c8                	or     %ecx,%eax
+  800862:	a8 03                	test   $0x3,%al
+  800864:	75 12                	jne    800878 <memset+0x28>
+		c &= 0xFF;
+  800866:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80086a:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800870:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800873:	fc                   	cld
+  800874:	f3 ab                	rep stos %eax,%es:(%edi)
+  800876:	eb 06                	jmp    80087e <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800878:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80087b:	fc                   	cld
+  80087c:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  80087e:	89 f8                	mov    %edi,%eax
+  800880:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800883:	c9                   	leave
+  800884:	c3                   	ret
+
+00800885 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800885:	55                   	push   %ebp
+  800886:	89 e5                	mov    %esp,%ebp
+  800888:	57                   	push   %edi
+  800889:	56                   	push   %esi
+  80088a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80088d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800890:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800893:	39 c6                	cmp    %eax,%esi
+  800895:	73 32                	jae    8008c9 <memmove+0x44>
+  800897:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80089a:	39 d0                	cmp    %edx,%eax
+  80089c:	73 2b                	jae    8008c9 <memmove+0x44>
+		s += n;
+		d += n;
+  80089e:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8008a1:	89 d6                	mov    %edx,%esi
+  8008a3:	09 fe                	or     %edi,%esi
+  8008a5:	09 ce                	or     %ecx,%esi
+  8008a7:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8008ad:	75 0e                	jne    8008bd <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8008af:	83 ef 04             	sub    $0x4,%edi
+  8008b2:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8008b5:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8008b8:	fd                   	std
+  8008b9:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8008bb:	eb 09                	jmp    8008c6 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8008bd:	83 ef 01             	sub    $0x1,%edi
+  8008c0:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8008c3:	fd                   	std
+  8008c4:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8008c6:	fc                   	cld
+  8008c7:	eb 1a                	jmp    8008e3 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8008c9:	89 f2                	mov    %esi,%edx
+  8008cb:	09 c2                	or     %eax,%edx
+  8008cd:	09 ca                	or     %ecx,%edx
+  8008cf:	f6 c2 03             	test   $0x3,%dl
+  8008d2:	75 0a                	jne    8008de <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8008d4:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8008d7:	89 c7                	mov    %eax,%edi
+  8008d9:	fc                   	cld
+  8008da:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8008dc:	eb 05                	jmp    8008e3 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8008de:	89 c7                	mov    %eax,%edi
+  8008e0:	fc                   	cld
+  8008e1:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8008e3:	5e                   	pop    %esi
+  8008e4:	5f                   	pop    %edi
+  8008e5:	5d                   	pop    %ebp
+  8008e6:	c3                   	ret
+
+008008e7 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8008e7:	55                   	push   %ebp
+  8008e8:	89 e5                	mov    %esp,%ebp
+  8008ea:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8008ed:	ff 75 10             	push   0x10(%ebp)
+  8008f0:	ff 75 0c             	push   0xc(%ebp)
+  8008f3:	ff 75 08             	push   0x8(%ebp)
+  8008f6:	e8 8a ff ff ff       	call   800885 <memmove>
+}
+  8008fb:	c9                   	leave
+  8008fc:	c3                   	ret
+
+008008fd <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8008fd:	55                   	push   %ebp
+  8008fe:	89 e5                	mov    %esp,%ebp
+  800900:	56                   	push   %esi
+  800901:	53                   	push   %ebx
+  800902:	8b 45 08             	mov    0x8(%ebp),%eax
+  800905:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800908:	89 c6                	mov    %eax,%esi
+  80090a:	03 75 10             	add    0x10(%ebp),%esi
+  80090d:	eb 06                	jmp    800915 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  80090f:	83 c0 01             	add    $0x1,%eax
+  800912:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800915:	39 f0                	cmp    %esi,%eax
+  800917:	74 14                	je     80092d <memcmp+0x30>
+		if (*s1 != *s2)
+  800919:	0f b6 08             	movzbl (%eax),%ecx
+  80091c:	0f b6 1a             	movzbl (%edx),%ebx
+  80091f:	38 d9                	cmp    %bl,%cl
+  800921:	74 ec                	je     80090f <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800923:	0f b6 c1             	movzbl %cl,%eax
+  800926:	0f b6 db             	movzbl %bl,%ebx
+  800929:	29 d8                	sub    %ebx,%eax
+  80092b:	eb 05                	jmp    800932 <memcmp+0x35>
+	}
+
+	return 0;
+  80092d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800932:	5b                   	pop    %ebx
+  800933:	5e                   	pop    %esi
+  800934:	5d                   	pop    %ebp
+  800935:	c3                   	ret
+
+00800936 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800936:	55                   	push   %ebp
+  800937:	89 e5                	mov    %esp,%ebp
+  800939:	8b 45 08             	mov    0x8(%ebp),%eax
+  80093c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  80093f:	89 c2                	mov    %eax,%edx
+  800941:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800944:	eb 03                	jmp    800949 <memfind+0x13>
+  800946:	83 c0 01             	add    $0x1,%eax
+  800949:	39 d0                	cmp    %edx,%eax
+  80094b:	73 04                	jae    800951 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  80094d:	38 08                	cmp    %cl,(%eax)
+  80094f:	75 f5                	jne    800946 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800951:	5d                   	pop    %ebp
+  800952:	c3                   	ret
+
+00800953 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800953:	55                   	push   %ebp
+  800954:	89 e5                	mov    %esp,%ebp
+  800956:	57                   	push   %edi
+  800957:	56                   	push   %esi
+  800958:	53                   	push   %ebx
+  800959:	8b 55 08             	mov    0x8(%ebp),%edx
+  80095c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  80095f:	eb 03                	jmp    800964 <strtol+0x11>
+		s++;
+  800961:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800964:	0f b6 02             	movzbl (%edx),%eax
+  800967:	3c 20                	cmp    $0x20,%al
+  800969:	74 f6                	je     800961 <strtol+0xe>
+  80096b:	3c 09                	cmp    $0x9,%al
+  80096d:	74 f2                	je     800961 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  80096f:	3c 2b                	cmp    $0x2b,%al
+  800971:	74 2a                	je     80099d <strtol+0x4a>
+	int neg = 0;
+  800973:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800978:	3c 2d                	cmp    $0x2d,%al
+  80097a:	74 2b                	je     8009a7 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80097c:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800982:	75 0f                	jne    800993 <strtol+0x40>
+  800984:	80 3a 30             	cmpb   $0x30,(%edx)
+  800987:	74 28                	je     8009b1 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800989:	85 db                	test   %ebx,%ebx
+  80098b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800990:	0f 44 d8             	cmove  %eax,%ebx
+  800993:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800998:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  80099b:	eb 46                	jmp    8009e3 <strtol+0x90>
+		s++;
+  80099d:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  8009a0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009a5:	eb d5                	jmp    80097c <strtol+0x29>
+		s++, neg = 1;
+  8009a7:	83 c2 01             	add    $0x1,%edx
+  8009aa:	bf 01 00 00 00       	mov    $0x1,%edi
+  8009af:	eb cb                	jmp    80097c <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009b1:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8009b5:	74 0e                	je     8009c5 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  8009b7:	85 db                	test   %ebx,%ebx
+  8009b9:	75 d8                	jne    800993 <strtol+0x40>
+		s++, base = 8;
+  8009bb:	83 c2 01             	add    $0x1,%edx
+  8009be:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8009c3:	eb ce                	jmp    800993 <strtol+0x40>
+		s += 2, base = 16;
+  8009c5:	83 c2 02             	add    $0x2,%edx
+  8009c8:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8009cd:	eb c4                	jmp    800993 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  8009cf:	0f be c0             	movsbl %al,%eax
+  8009d2:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  8009d5:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8009d8:	7d 3a                	jge    800a14 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  8009da:	83 c2 01             	add    $0x1,%edx
+  8009dd:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  8009e1:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  8009e3:	0f b6 02             	movzbl (%edx),%eax
+  8009e6:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8009e9:	89 f3                	mov    %esi,%ebx
+  8009eb:	80 fb 09             	cmp    $0x9,%bl
+  8009ee:	76 df                	jbe    8009cf <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  8009f0:	8d 70 9f             	lea    -0x61(%eax),%esi
+  8009f3:	89 f3                	mov    %esi,%ebx
+  8009f5:	80 fb 19             	cmp    $0x19,%bl
+  8009f8:	77 08                	ja     800a02 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  8009fa:	0f be c0             	movsbl %al,%eax
+  8009fd:	83 e8 57             	sub    $0x57,%eax
+  800a00:	eb d3                	jmp    8009d5 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800a02:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800a05:	89 f3                	mov    %esi,%ebx
+  800a07:	80 fb 19             	cmp    $0x19,%bl
+  800a0a:	77 08                	ja     800a14 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800a0c:	0f be c0             	movsbl %al,%eax
+  800a0f:	83 e8 37             	sub    $0x37,%eax
+  800a12:	eb c1                	jmp    8009d5 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800a14:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800a18:	74 05                	je     800a1f <strtol+0xcc>
+		*endptr = (char *) s;
+  800a1a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a1d:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800a1f:	89 c8                	mov    %ecx,%eax
+  800a21:	f7 d8                	neg    %eax
+  800a23:	85 ff                	test   %edi,%edi
+  800a25:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800a28:	89 c8                	mov    %ecx,%eax
+  800a2a:	5b                   	pop    %ebx
+  800a2b:	5e                   	pop    %esi
+  800a2c:	5f                   	pop    %edi
+  800a2d:	5d                   	pop    %ebp
+  800a2e:	c3                   	ret
+
+00800a2f <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800a2f:	55                   	push   %ebp
+  800a30:	89 e5                	mov    %esp,%ebp
+  800a32:	57                   	push   %edi
+  800a33:	56                   	push   %esi
+  800a34:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800a35:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a3a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a3d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a40:	89 c3                	mov    %eax,%ebx
+  800a42:	89 c7                	mov    %eax,%edi
+  800a44:	89 c6                	mov    %eax,%esi
+  800a46:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  800a48:	5b                   	pop    %ebx
+  800a49:	5e                   	pop    %esi
+  800a4a:	5f                   	pop    %edi
+  800a4b:	5d                   	pop    %ebp
+  800a4c:	c3                   	ret
+
+00800a4d <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800a4d:	55                   	push   %ebp
+  800a4e:	89 e5                	mov    %esp,%ebp
+  800a50:	57                   	push   %edi
+  800a51:	56                   	push   %esi
+  800a52:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800a53:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a58:	b8 01 00 00 00       	mov    $0x1,%eax
+  800a5d:	89 d1                	mov    %edx,%ecx
+  800a5f:	89 d3                	mov    %edx,%ebx
+  800a61:	89 d7                	mov    %edx,%edi
+  800a63:	89 d6                	mov    %edx,%esi
+  800a65:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800a67:	5b                   	pop    %ebx
+  800a68:	5e                   	pop    %esi
+  800a69:	5f                   	pop    %edi
+  800a6a:	5d                   	pop    %ebp
+  800a6b:	c3                   	ret
+
+00800a6c <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800a6c:	55                   	push   %ebp
+  800a6d:	89 e5                	mov    %esp,%ebp
+  800a6f:	57                   	push   %edi
+  800a70:	56                   	push   %esi
+  800a71:	53                   	push   %ebx
+  800a72:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800a75:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a7a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a7d:	b8 03 00 00 00       	mov    $0x3,%eax
+  800a82:	89 cb                	mov    %ecx,%ebx
+  800a84:	89 cf                	mov    %ecx,%edi
+  800a86:	89 ce                	mov    %ecx,%esi
+  800a88:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800a8a:	85 c0                	test   %eax,%eax
+  800a8c:	7f 08                	jg     800a96 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800a8e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a91:	5b                   	pop    %ebx
+  800a92:	5e                   	pop    %esi
+  800a93:	5f                   	pop    %edi
+  800a94:	5d                   	pop    %ebp
+  800a95:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800a96:	83 ec 0c             	sub    $0xc,%esp
+  800a99:	50                   	push   %eax
+  800a9a:	6a 03                	push   $0x3
+  800a9c:	68 23 28 80 00       	push   $0x802823
+  800aa1:	6a 3e                	push   $0x3e
+  800aa3:	68 40 28 80 00       	push   $0x802840
+  800aa8:	e8 22 14 00 00       	call   801ecf <_panic>
+
+00800aad <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800aad:	55                   	push   %ebp
+  800aae:	89 e5                	mov    %esp,%ebp
+  800ab0:	57                   	push   %edi
+  800ab1:	56                   	push   %esi
+  800ab2:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800ab3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ab8:	b8 02 00 00 00       	mov    $0x2,%eax
+  800abd:	89 d1                	mov    %edx,%ecx
+  800abf:	89 d3                	mov    %edx,%ebx
+  800ac1:	89 d7                	mov    %edx,%edi
+  800ac3:	89 d6                	mov    %edx,%esi
+  800ac5:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800ac7:	5b                   	pop    %ebx
+  800ac8:	5e                   	pop    %esi
+  800ac9:	5f                   	pop    %edi
+  800aca:	5d                   	pop    %ebp
+  800acb:	c3                   	ret
+
+00800acc <sys_yield>:
+
+void
+sys_yield(void) {
+  800acc:	55                   	push   %ebp
+  800acd:	89 e5                	mov    %esp,%ebp
+  800acf:	57                   	push   %edi
+  800ad0:	56                   	push   %esi
+  800ad1:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800ad2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ad7:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800adc:	89 d1                	mov    %edx,%ecx
+  800ade:	89 d3                	mov    %edx,%ebx
+  800ae0:	89 d7                	mov    %edx,%edi
+  800ae2:	89 d6                	mov    %edx,%esi
+  800ae4:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800ae6:	5b                   	pop    %ebx
+  800ae7:	5e                   	pop    %esi
+  800ae8:	5f                   	pop    %edi
+  800ae9:	5d                   	pop    %ebp
+  800aea:	c3                   	ret
+
+00800aeb <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  800aeb:	55                   	push   %ebp
+  800aec:	89 e5                	mov    %esp,%ebp
+  800aee:	57                   	push   %edi
+  800aef:	56                   	push   %esi
+  800af0:	53                   	push   %ebx
+  800af1:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800af4:	be 00 00 00 00       	mov    $0x0,%esi
+  800af9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800afc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800aff:	b8 04 00 00 00       	mov    $0x4,%eax
+  800b04:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b07:	89 f7                	mov    %esi,%edi
+  800b09:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800b0b:	85 c0                	test   %eax,%eax
+  800b0d:	7f 08                	jg     800b17 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800b0f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b12:	5b                   	pop    %ebx
+  800b13:	5e                   	pop    %esi
+  800b14:	5f                   	pop    %edi
+  800b15:	5d                   	pop    %ebp
+  800b16:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800b17:	83 ec 0c             	sub    $0xc,%esp
+  800b1a:	50                   	push   %eax
+  800b1b:	6a 04                	push   $0x4
+  800b1d:	68 23 28 80 00       	push   $0x802823
+  800b22:	6a 3e                	push   $0x3e
+  800b24:	68 40 28 80 00       	push   $0x802840
+  800b29:	e8 a1 13 00 00       	call   801ecf <_panic>
+
+00800b2e <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  800b2e:	55                   	push   %ebp
+  800b2f:	89 e5                	mov    %esp,%ebp
+  800b31:	57                   	push   %edi
+  800b32:	56                   	push   %esi
+  800b33:	53                   	push   %ebx
+  800b34:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800b37:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b3a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b3d:	b8 05 00 00 00       	mov    $0x5,%eax
+  800b42:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b45:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800b48:	8b 75 18             	mov    0x18(%ebp),%esi
+  800b4b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800b4d:	85 c0                	test   %eax,%eax
+  800b4f:	7f 08                	jg     800b59 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800b51:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b54:	5b                   	pop    %ebx
+  800b55:	5e                   	pop    %esi
+  800b56:	5f                   	pop    %edi
+  800b57:	5d                   	pop    %ebp
+  800b58:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800b59:	83 ec 0c             	sub    $0xc,%esp
+  800b5c:	50                   	push   %eax
+  800b5d:	6a 05                	push   $0x5
+  800b5f:	68 23 28 80 00       	push   $0x802823
+  800b64:	6a 3e                	push   $0x3e
+  800b66:	68 40 28 80 00       	push   $0x802840
+  800b6b:	e8 5f 13 00 00       	call   801ecf <_panic>
+
+00800b70 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  800b70:	55                   	push   %ebp
+  800b71:	89 e5                	mov    %esp,%ebp
+  800b73:	57                   	push   %edi
+  800b74:	56                   	push   %esi
+  800b75:	53                   	push   %ebx
+  800b76:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800b79:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b7e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b81:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b84:	b8 06 00 00 00       	mov    $0x6,%eax
+  800b89:	89 df                	mov    %ebx,%edi
+  800b8b:	89 de                	mov    %ebx,%esi
+  800b8d:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800b8f:	85 c0                	test   %eax,%eax
+  800b91:	7f 08                	jg     800b9b <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800b93:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b96:	5b                   	pop    %ebx
+  800b97:	5e                   	pop    %esi
+  800b98:	5f                   	pop    %edi
+  800b99:	5d                   	pop    %ebp
+  800b9a:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800b9b:	83 ec 0c             	sub    $0xc,%esp
+  800b9e:	50                   	push   %eax
+  800b9f:	6a 06                	push   $0x6
+  800ba1:	68 23 28 80 00       	push   $0x802823
+  800ba6:	6a 3e                	push   $0x3e
+  800ba8:	68 40 28 80 00       	push   $0x802840
+  800bad:	e8 1d 13 00 00       	call   801ecf <_panic>
+
+00800bb2 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800bb2:	55                   	push   %ebp
+  800bb3:	89 e5                	mov    %esp,%ebp
+  800bb5:	57                   	push   %edi
+  800bb6:	56                   	push   %esi
+  800bb7:	53                   	push   %ebx
+  800bb8:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800bbb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800bc0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bc3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bc6:	b8 08 00 00 00       	mov    $0x8,%eax
+  800bcb:	89 df                	mov    %ebx,%edi
+  800bcd:	89 de                	mov    %ebx,%esi
+  800bcf:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800bd1:	85 c0                	test   %eax,%eax
+  800bd3:	7f 08                	jg     800bdd <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800bd5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bd8:	5b                   	pop    %ebx
+  800bd9:	5e                   	pop    %esi
+  800bda:	5f                   	pop    %edi
+  800bdb:	5d                   	pop    %ebp
+  800bdc:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800bdd:	83 ec 0c             	sub    $0xc,%esp
+  800be0:	50                   	push   %eax
+  800be1:	6a 08                	push   $0x8
+  800be3:	68 23 28 80 00       	push   $0x802823
+  800be8:	6a 3e                	push   $0x3e
+  800bea:	68 40 28 80 00       	push   $0x802840
+  800bef:	e8 db 12 00 00       	call   801ecf <_panic>
+
+00800bf4 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800bf4:	55                   	push   %ebp
+  800bf5:	89 e5                	mov    %esp,%ebp
+  800bf7:	57                   	push   %edi
+  800bf8:	56                   	push   %esi
+  800bf9:	53                   	push   %ebx
+  800bfa:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800bfd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c02:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c05:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c08:	b8 09 00 00 00       	mov    $0x9,%eax
+  800c0d:	89 df                	mov    %ebx,%edi
+  800c0f:	89 de                	mov    %ebx,%esi
+  800c11:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c13:	85 c0                	test   %eax,%eax
+  800c15:	7f 08                	jg     800c1f <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800c17:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c1a:	5b                   	pop    %ebx
+  800c1b:	5e                   	pop    %esi
+  800c1c:	5f                   	pop    %edi
+  800c1d:	5d                   	pop    %ebp
+  800c1e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c1f:	83 ec 0c             	sub    $0xc,%esp
+  800c22:	50                   	push   %eax
+  800c23:	6a 09                	push   $0x9
+  800c25:	68 23 28 80 00       	push   $0x802823
+  800c2a:	6a 3e                	push   $0x3e
+  800c2c:	68 40 28 80 00       	push   $0x802840
+  800c31:	e8 99 12 00 00       	call   801ecf <_panic>
+
+00800c36 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800c36:	55                   	push   %ebp
+  800c37:	89 e5                	mov    %esp,%ebp
+  800c39:	57                   	push   %edi
+  800c3a:	56                   	push   %esi
+  800c3b:	53                   	push   %ebx
+  800c3c:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c3f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c44:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c47:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c4a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c4f:	89 df                	mov    %ebx,%edi
+  800c51:	89 de                	mov    %ebx,%esi
+  800c53:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c55:	85 c0                	test   %eax,%eax
+  800c57:	7f 08                	jg     800c61 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800c59:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c5c:	5b                   	pop    %ebx
+  800c5d:	5e                   	pop    %esi
+  800c5e:	5f                   	pop    %edi
+  800c5f:	5d                   	pop    %ebp
+  800c60:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c61:	83 ec 0c             	sub    $0xc,%esp
+  800c64:	50                   	push   %eax
+  800c65:	6a 0a                	push   $0xa
+  800c67:	68 23 28 80 00       	push   $0x802823
+  800c6c:	6a 3e                	push   $0x3e
+  800c6e:	68 40 28 80 00       	push   $0x802840
+  800c73:	e8 57 12 00 00       	call   801ecf <_panic>
+
+00800c78 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  800c78:	55                   	push   %ebp
+  800c79:	89 e5                	mov    %esp,%ebp
+  800c7b:	57                   	push   %edi
+  800c7c:	56                   	push   %esi
+  800c7d:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800c7e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c81:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c84:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800c89:	be 00 00 00 00       	mov    $0x0,%esi
+  800c8e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c91:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c94:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800c96:	5b                   	pop    %ebx
+  800c97:	5e                   	pop    %esi
+  800c98:	5f                   	pop    %edi
+  800c99:	5d                   	pop    %ebp
+  800c9a:	c3                   	ret
+
+00800c9b <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  800c9b:	55                   	push   %ebp
+  800c9c:	89 e5                	mov    %esp,%ebp
+  800c9e:	57                   	push   %edi
+  800c9f:	56                   	push   %esi
+  800ca0:	53                   	push   %ebx
+  800ca1:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800ca4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ca9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cac:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800cb1:	89 cb                	mov    %ecx,%ebx
+  800cb3:	89 cf                	mov    %ecx,%edi
+  800cb5:	89 ce                	mov    %ecx,%esi
+  800cb7:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800cb9:	85 c0                	test   %eax,%eax
+  800cbb:	7f 08                	jg     800cc5 <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  800cbd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cc0:	5b                   	pop    %ebx
+  800cc1:	5e                   	pop    %esi
+  800cc2:	5f                   	pop    %edi
+  800cc3:	5d                   	pop    %ebp
+  800cc4:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800cc5:	83 ec 0c             	sub    $0xc,%esp
+  800cc8:	50                   	push   %eax
+  800cc9:	6a 0d                	push   $0xd
+  800ccb:	68 23 28 80 00       	push   $0x802823
+  800cd0:	6a 3e                	push   $0x3e
+  800cd2:	68 40 28 80 00       	push   $0x802840
+  800cd7:	e8 f3 11 00 00       	call   801ecf <_panic>
+
+00800cdc <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  800cdc:	55                   	push   %ebp
+  800cdd:	89 e5                	mov    %esp,%ebp
+  800cdf:	57                   	push   %edi
+  800ce0:	56                   	push   %esi
+  800ce1:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800ce2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ce7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ced:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800cf2:	89 df                	mov    %ebx,%edi
+  800cf4:	89 de                	mov    %ebx,%esi
+  800cf6:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  800cf8:	5b                   	pop    %ebx
+  800cf9:	5e                   	pop    %esi
+  800cfa:	5f                   	pop    %edi
+  800cfb:	5d                   	pop    %ebp
+  800cfc:	c3                   	ret
+
+00800cfd <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  800cfd:	55                   	push   %ebp
+  800cfe:	89 e5                	mov    %esp,%ebp
+  800d00:	57                   	push   %edi
+  800d01:	56                   	push   %esi
+  800d02:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d03:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d08:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d0b:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800d10:	89 cb                	mov    %ecx,%ebx
+  800d12:	89 cf                	mov    %ecx,%edi
+  800d14:	89 ce                	mov    %ecx,%esi
+  800d16:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  800d18:	5b                   	pop    %ebx
+  800d19:	5e                   	pop    %esi
+  800d1a:	5f                   	pop    %edi
+  800d1b:	5d                   	pop    %ebp
+  800d1c:	c3                   	ret
+
+00800d1d <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  800d1d:	55                   	push   %ebp
+  800d1e:	89 e5                	mov    %esp,%ebp
+  800d20:	57                   	push   %edi
+  800d21:	56                   	push   %esi
+  800d22:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d23:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d28:	b8 10 00 00 00       	mov    $0x10,%eax
+  800d2d:	89 d1                	mov    %edx,%ecx
+  800d2f:	89 d3                	mov    %edx,%ebx
+  800d31:	89 d7                	mov    %edx,%edi
+  800d33:	89 d6                	mov    %edx,%esi
+  800d35:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800d37:	5b                   	pop    %ebx
+  800d38:	5e                   	pop    %esi
+  800d39:	5f                   	pop    %edi
+  800d3a:	5d                   	pop    %ebp
+  800d3b:	c3                   	ret
+
+00800d3c <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  800d3c:	55                   	push   %ebp
+  800d3d:	89 e5                	mov    %esp,%ebp
+  800d3f:	57                   	push   %edi
+  800d40:	56                   	push   %esi
+  800d41:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d42:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d47:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d4a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d4d:	b8 11 00 00 00       	mov    $0x11,%eax
+  800d52:	89 df                	mov    %ebx,%edi
+  800d54:	89 de                	mov    %ebx,%esi
+  800d56:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800d58:	5b                   	pop    %ebx
+  800d59:	5e                   	pop    %esi
+  800d5a:	5f                   	pop    %edi
+  800d5b:	5d                   	pop    %ebp
+  800d5c:	c3                   	ret
+
+00800d5d <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  800d5d:	55                   	push   %ebp
+  800d5e:	89 e5                	mov    %esp,%ebp
+  800d60:	57                   	push   %edi
+  800d61:	56                   	push   %esi
+  800d62:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d63:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d68:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d6b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d6e:	b8 12 00 00 00       	mov    $0x12,%eax
+  800d73:	89 df                	mov    %ebx,%edi
+  800d75:	89 de                	mov    %ebx,%esi
+  800d77:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800d79:	5b                   	pop    %ebx
+  800d7a:	5e                   	pop    %esi
+  800d7b:	5f                   	pop    %edi
+  800d7c:	5d                   	pop    %ebp
+  800d7d:	c3                   	ret
+
+00800d7e <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  800d7e:	55                   	push   %ebp
+  800d7f:	89 e5                	mov    %esp,%ebp
+  800d81:	57                   	push   %edi
+  800d82:	56                   	push   %esi
+  800d83:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d84:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d89:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d8c:	b8 13 00 00 00       	mov    $0x13,%eax
+  800d91:	89 cb                	mov    %ecx,%ebx
+  800d93:	89 cf                	mov    %ecx,%edi
+  800d95:	89 ce                	mov    %ecx,%esi
+  800d97:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  800d99:	5b                   	pop    %ebx
+  800d9a:	5e                   	pop    %esi
+  800d9b:	5f                   	pop    %edi
+  800d9c:	5d                   	pop    %ebp
+  800d9d:	c3                   	ret
+
+00800d9e <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  800d9e:	55                   	push   %ebp
+  800d9f:	89 e5                	mov    %esp,%ebp
+  800da1:	57                   	push   %edi
+  800da2:	56                   	push   %esi
+  800da3:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800da4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800da9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dac:	b8 14 00 00 00       	mov    $0x14,%eax
+  800db1:	89 cb                	mov    %ecx,%ebx
+  800db3:	89 cf                	mov    %ecx,%edi
+  800db5:	89 ce                	mov    %ecx,%esi
+  800db7:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  800db9:	5b                   	pop    %ebx
+  800dba:	5e                   	pop    %esi
+  800dbb:	5f                   	pop    %edi
+  800dbc:	5d                   	pop    %ebp
+  800dbd:	c3                   	ret
+
+00800dbe <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800dbe:	55                   	push   %ebp
+  800dbf:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800dc1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dc4:	05 00 00 00 30       	add    $0x30000000,%eax
+  800dc9:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800dcc:	5d                   	pop    %ebp
+  800dcd:	c3                   	ret
+
+00800dce <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800dce:	55                   	push   %ebp
+  800dcf:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800dd1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dd4:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800dd9:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800dde:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800de3:	5d                   	pop    %ebp
+  800de4:	c3                   	ret
+
+00800de5 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800de5:	55                   	push   %ebp
+  800de6:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  800de8:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800ded:	eb 02                	jmp    800df1 <fd_alloc+0xc>
+  800def:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800df1:	89 c2                	mov    %eax,%edx
+  800df3:	c1 ea 16             	shr    $0x16,%edx
+  800df6:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800dfd:	f6 c2 01             	test   $0x1,%dl
+  800e00:	74 2b                	je     800e2d <fd_alloc+0x48>
+  800e02:	89 c2                	mov    %eax,%edx
+  800e04:	c1 ea 0c             	shr    $0xc,%edx
+  800e07:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  800e0e:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  800e14:	f6 c1 01             	test   $0x1,%cl
+  800e17:	74 14                	je     800e2d <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  800e19:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  800e1f:	75 ce                	jne    800def <fd_alloc+0xa>
+  800e21:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  800e26:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800e2b:	eb 05                	jmp    800e32 <fd_alloc+0x4d>
+			return 0;
+  800e2d:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  800e32:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e35:	89 02                	mov    %eax,(%edx)
+}
+  800e37:	89 c8                	mov    %ecx,%eax
+  800e39:	5d                   	pop    %ebp
+  800e3a:	c3                   	ret
+
+00800e3b <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  800e3b:	55                   	push   %ebp
+  800e3c:	89 e5                	mov    %esp,%ebp
+  800e3e:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  800e41:	83 f8 1f             	cmp    $0x1f,%eax
+  800e44:	77 30                	ja     800e76 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  800e46:	c1 e0 0c             	shl    $0xc,%eax
+  800e49:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800e4e:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  800e54:	f6 c2 01             	test   $0x1,%dl
+  800e57:	74 24                	je     800e7d <fd_lookup+0x42>
+  800e59:	89 c2                	mov    %eax,%edx
+  800e5b:	c1 ea 0c             	shr    $0xc,%edx
+  800e5e:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800e65:	f6 c2 01             	test   $0x1,%dl
+  800e68:	74 1a                	je     800e84 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  800e6a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800e6d:	89 02                	mov    %eax,(%edx)
+	return 0;
+  800e6f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e74:	5d                   	pop    %ebp
+  800e75:	c3                   	ret
+		return -E_INVAL;
+  800e76:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e7b:	eb f7                	jmp    800e74 <fd_lookup+0x39>
+		return -E_INVAL;
+  800e7d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e82:	eb f0                	jmp    800e74 <fd_lookup+0x39>
+  800e84:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e89:	eb e9                	jmp    800e74 <fd_lookup+0x39>
+
+00800e8b <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  800e8b:	55                   	push   %ebp
+  800e8c:	89 e5                	mov    %esp,%ebp
+  800e8e:	53                   	push   %ebx
+  800e8f:	83 ec 04             	sub    $0x4,%esp
+  800e92:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  800e95:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e9a:	eb 03                	jmp    800e9f <dev_lookup+0x14>
+  800e9c:	83 c0 01             	add    $0x1,%eax
+  800e9f:	8b 1c 85 cc 28 80 00 	mov    0x8028cc(,%eax,4),%ebx
+  800ea6:	85 db                	test   %ebx,%ebx
+  800ea8:	74 0b                	je     800eb5 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  800eaa:	39 13                	cmp    %edx,(%ebx)
+  800eac:	75 ee                	jne    800e9c <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  800eae:	b8 00 00 00 00       	mov    $0x0,%eax
+  800eb3:	eb 1f                	jmp    800ed4 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800eb5:	a1 08 40 80 00       	mov    0x804008,%eax
+  800eba:	8b 40 48             	mov    0x48(%eax),%eax
+  800ebd:	83 ec 04             	sub    $0x4,%esp
+  800ec0:	52                   	push   %edx
+  800ec1:	50                   	push   %eax
+  800ec2:	68 50 28 80 00       	push   $0x802850
+  800ec7:	e8 7a f2 ff ff       	call   800146 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  800ecc:	83 c4 10             	add    $0x10,%esp
+  800ecf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  800ed4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ed7:	89 1a                	mov    %ebx,(%edx)
+}
+  800ed9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800edc:	c9                   	leave
+  800edd:	c3                   	ret
+
+00800ede <fd_close>:
+{
+  800ede:	55                   	push   %ebp
+  800edf:	89 e5                	mov    %esp,%ebp
+  800ee1:	57                   	push   %edi
+  800ee2:	56                   	push   %esi
+  800ee3:	53                   	push   %ebx
+  800ee4:	83 ec 24             	sub    $0x24,%esp
+  800ee7:	8b 75 08             	mov    0x8(%ebp),%esi
+  800eea:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800eed:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800ef0:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800ef1:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800ef7:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800efa:	50                   	push   %eax
+  800efb:	e8 3b ff ff ff       	call   800e3b <fd_lookup>
+  800f00:	89 c3                	mov    %eax,%ebx
+  800f02:	83 c4 10             	add    $0x10,%esp
+  800f05:	85 c0                	test   %eax,%eax
+  800f07:	78 05                	js     800f0e <fd_close+0x30>
+	    || fd != fd2)
+  800f09:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  800f0c:	74 16                	je     800f24 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  800f0e:	89 f8                	mov    %edi,%eax
+  800f10:	84 c0                	test   %al,%al
+  800f12:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f17:	0f 44 d8             	cmove  %eax,%ebx
+}
+  800f1a:	89 d8                	mov    %ebx,%eax
+  800f1c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f1f:	5b                   	pop    %ebx
+  800f20:	5e                   	pop    %esi
+  800f21:	5f                   	pop    %edi
+  800f22:	5d                   	pop    %ebp
+  800f23:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800f24:	83 ec 08             	sub    $0x8,%esp
+  800f27:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800f2a:	50                   	push   %eax
+  800f2b:	ff 36                	push   (%esi)
+  800f2d:	e8 59 ff ff ff       	call   800e8b <dev_lookup>
+  800f32:	89 c3                	mov    %eax,%ebx
+  800f34:	83 c4 10             	add    $0x10,%esp
+  800f37:	85 c0                	test   %eax,%eax
+  800f39:	78 1a                	js     800f55 <fd_close+0x77>
+		if (dev->dev_close)
+  800f3b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800f3e:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  800f41:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  800f46:	85 c0                	test   %eax,%eax
+  800f48:	74 0b                	je     800f55 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  800f4a:	83 ec 0c             	sub    $0xc,%esp
+  800f4d:	56                   	push   %esi
+  800f4e:	ff d0                	call   *%eax
+  800f50:	89 c3                	mov    %eax,%ebx
+  800f52:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  800f55:	83 ec 08             	sub    $0x8,%esp
+  800f58:	56                   	push   %esi
+  800f59:	6a 00                	push   $0x0
+  800f5b:	e8 10 fc ff ff       	call   800b70 <sys_page_unmap>
+	return r;
+  800f60:	83 c4 10             	add    $0x10,%esp
+  800f63:	eb b5                	jmp    800f1a <fd_close+0x3c>
+
+00800f65 <close>:
+
+int
+close(int fdnum)
+{
+  800f65:	55                   	push   %ebp
+  800f66:	89 e5                	mov    %esp,%ebp
+  800f68:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800f6b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800f6e:	50                   	push   %eax
+  800f6f:	ff 75 08             	push   0x8(%ebp)
+  800f72:	e8 c4 fe ff ff       	call   800e3b <fd_lookup>
+  800f77:	83 c4 10             	add    $0x10,%esp
+  800f7a:	85 c0                	test   %eax,%eax
+  800f7c:	79 02                	jns    800f80 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  800f7e:	c9                   	leave
+  800f7f:	c3                   	ret
+		return fd_close(fd, 1);
+  800f80:	83 ec 08             	sub    $0x8,%esp
+  800f83:	6a 01                	push   $0x1
+  800f85:	ff 75 f4             	push   -0xc(%ebp)
+  800f88:	e8 51 ff ff ff       	call   800ede <fd_close>
+  800f8d:	83 c4 10             	add    $0x10,%esp
+  800f90:	eb ec                	jmp    800f7e <close+0x19>
+
+00800f92 <close_all>:
+
+void
+close_all(void)
+{
+  800f92:	55                   	push   %ebp
+  800f93:	89 e5                	mov    %esp,%ebp
+  800f95:	53                   	push   %ebx
+  800f96:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  800f99:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  800f9e:	83 ec 0c             	sub    $0xc,%esp
+  800fa1:	53                   	push   %ebx
+  800fa2:	e8 be ff ff ff       	call   800f65 <close>
+	for (i = 0; i < MAXFD; i++)
+  800fa7:	83 c3 01             	add    $0x1,%ebx
+  800faa:	83 c4 10             	add    $0x10,%esp
+  800fad:	83 fb 20             	cmp    $0x20,%ebx
+  800fb0:	75 ec                	jne    800f9e <close_all+0xc>
+}
+  800fb2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800fb5:	c9                   	leave
+  800fb6:	c3                   	ret
+
+00800fb7 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  800fb7:	55                   	push   %ebp
+  800fb8:	89 e5                	mov    %esp,%ebp
+  800fba:	57                   	push   %edi
+  800fbb:	56                   	push   %esi
+  800fbc:	53                   	push   %ebx
+  800fbd:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800fc0:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800fc3:	50                   	push   %eax
+  800fc4:	ff 75 08             	push   0x8(%ebp)
+  800fc7:	e8 6f fe ff ff       	call   800e3b <fd_lookup>
+  800fcc:	89 c3                	mov    %eax,%ebx
+  800fce:	83 c4 10             	add    $0x10,%esp
+  800fd1:	85 c0                	test   %eax,%eax
+  800fd3:	78 7f                	js     801054 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  800fd5:	83 ec 0c             	sub    $0xc,%esp
+  800fd8:	ff 75 0c             	push   0xc(%ebp)
+  800fdb:	e8 85 ff ff ff       	call   800f65 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  800fe0:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800fe3:	c1 e6 0c             	shl    $0xc,%esi
+  800fe6:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  800fec:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800fef:	89 3c 24             	mov    %edi,(%esp)
+  800ff2:	e8 d7 fd ff ff       	call   800dce <fd2data>
+  800ff7:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  800ff9:	89 34 24             	mov    %esi,(%esp)
+  800ffc:	e8 cd fd ff ff       	call   800dce <fd2data>
+  801001:	83 c4 10             	add    $0x10,%esp
+  801004:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801007:	89 d8                	mov    %ebx,%eax
+  801009:	c1 e8 16             	shr    $0x16,%eax
+  80100c:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801013:	a8 01                	test   $0x1,%al
+  801015:	74 11                	je     801028 <dup+0x71>
+  801017:	89 d8                	mov    %ebx,%eax
+  801019:	c1 e8 0c             	shr    $0xc,%eax
+  80101c:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801023:	f6 c2 01             	test   $0x1,%dl
+  801026:	75 36                	jne    80105e <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801028:	89 f8                	mov    %edi,%eax
+  80102a:	c1 e8 0c             	shr    $0xc,%eax
+  80102d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801034:	83 ec 0c             	sub    $0xc,%esp
+  801037:	25 07 0e 00 00       	and    $0xe07,%eax
+  80103c:	50                   	push   %eax
+  80103d:	56                   	push   %esi
+  80103e:	6a 00                	push   $0x0
+  801040:	57                   	push   %edi
+  801041:	6a 00                	push   $0x0
+  801043:	e8 e6 fa ff ff       	call   800b2e <sys_page_map>
+  801048:	89 c3                	mov    %eax,%ebx
+  80104a:	83 c4 20             	add    $0x20,%esp
+  80104d:	85 c0                	test   %eax,%eax
+  80104f:	78 33                	js     801084 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801051:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801054:	89 d8                	mov    %ebx,%eax
+  801056:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801059:	5b                   	pop    %ebx
+  80105a:	5e                   	pop    %esi
+  80105b:	5f                   	pop    %edi
+  80105c:	5d                   	pop    %ebp
+  80105d:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80105e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801065:	83 ec 0c             	sub    $0xc,%esp
+  801068:	25 07 0e 00 00       	and    $0xe07,%eax
+  80106d:	50                   	push   %eax
+  80106e:	ff 75 d4             	push   -0x2c(%ebp)
+  801071:	6a 00                	push   $0x0
+  801073:	53                   	push   %ebx
+  801074:	6a 00                	push   $0x0
+  801076:	e8 b3 fa ff ff       	call   800b2e <sys_page_map>
+  80107b:	89 c3                	mov    %eax,%ebx
+  80107d:	83 c4 20             	add    $0x20,%esp
+  801080:	85 c0                	test   %eax,%eax
+  801082:	79 a4                	jns    801028 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801084:	83 ec 08             	sub    $0x8,%esp
+  801087:	56                   	push   %esi
+  801088:	6a 00                	push   $0x0
+  80108a:	e8 e1 fa ff ff       	call   800b70 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  80108f:	83 c4 08             	add    $0x8,%esp
+  801092:	ff 75 d4             	push   -0x2c(%ebp)
+  801095:	6a 00                	push   $0x0
+  801097:	e8 d4 fa ff ff       	call   800b70 <sys_page_unmap>
+	return r;
+  80109c:	83 c4 10             	add    $0x10,%esp
+  80109f:	eb b3                	jmp    801054 <dup+0x9d>
+
+008010a1 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8010a1:	55                   	push   %ebp
+  8010a2:	89 e5                	mov    %esp,%ebp
+  8010a4:	56                   	push   %esi
+  8010a5:	53                   	push   %ebx
+  8010a6:	83 ec 18             	sub    $0x18,%esp
+  8010a9:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8010ac:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8010af:	50                   	push   %eax
+  8010b0:	56                   	push   %esi
+  8010b1:	e8 85 fd ff ff       	call   800e3b <fd_lookup>
+  8010b6:	83 c4 10             	add    $0x10,%esp
+  8010b9:	85 c0                	test   %eax,%eax
+  8010bb:	78 3c                	js     8010f9 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8010bd:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8010c0:	83 ec 08             	sub    $0x8,%esp
+  8010c3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8010c6:	50                   	push   %eax
+  8010c7:	ff 33                	push   (%ebx)
+  8010c9:	e8 bd fd ff ff       	call   800e8b <dev_lookup>
+  8010ce:	83 c4 10             	add    $0x10,%esp
+  8010d1:	85 c0                	test   %eax,%eax
+  8010d3:	78 24                	js     8010f9 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8010d5:	8b 43 08             	mov    0x8(%ebx),%eax
+  8010d8:	83 e0 03             	and    $0x3,%eax
+  8010db:	83 f8 01             	cmp    $0x1,%eax
+  8010de:	74 20                	je     801100 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8010e0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8010e3:	8b 40 08             	mov    0x8(%eax),%eax
+  8010e6:	85 c0                	test   %eax,%eax
+  8010e8:	74 37                	je     801121 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8010ea:	83 ec 04             	sub    $0x4,%esp
+  8010ed:	ff 75 10             	push   0x10(%ebp)
+  8010f0:	ff 75 0c             	push   0xc(%ebp)
+  8010f3:	53                   	push   %ebx
+  8010f4:	ff d0                	call   *%eax
+  8010f6:	83 c4 10             	add    $0x10,%esp
+}
+  8010f9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8010fc:	5b                   	pop    %ebx
+  8010fd:	5e                   	pop    %esi
+  8010fe:	5d                   	pop    %ebp
+  8010ff:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801100:	a1 08 40 80 00       	mov    0x804008,%eax
+  801105:	8b 40 48             	mov    0x48(%eax),%eax
+  801108:	83 ec 04             	sub    $0x4,%esp
+  80110b:	56                   	push   %esi
+  80110c:	50                   	push   %eax
+  80110d:	68 91 28 80 00       	push   $0x802891
+  801112:	e8 2f f0 ff ff       	call   800146 <cprintf>
+		return -E_INVAL;
+  801117:	83 c4 10             	add    $0x10,%esp
+  80111a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80111f:	eb d8                	jmp    8010f9 <read+0x58>
+		return -E_NOT_SUPP;
+  801121:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801126:	eb d1                	jmp    8010f9 <read+0x58>
+
+00801128 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801128:	55                   	push   %ebp
+  801129:	89 e5                	mov    %esp,%ebp
+  80112b:	57                   	push   %edi
+  80112c:	56                   	push   %esi
+  80112d:	53                   	push   %ebx
+  80112e:	83 ec 0c             	sub    $0xc,%esp
+  801131:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801134:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801137:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80113c:	eb 02                	jmp    801140 <readn+0x18>
+  80113e:	01 c3                	add    %eax,%ebx
+  801140:	39 f3                	cmp    %esi,%ebx
+  801142:	73 21                	jae    801165 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801144:	83 ec 04             	sub    $0x4,%esp
+  801147:	89 f0                	mov    %esi,%eax
+  801149:	29 d8                	sub    %ebx,%eax
+  80114b:	50                   	push   %eax
+  80114c:	89 d8                	mov    %ebx,%eax
+  80114e:	03 45 0c             	add    0xc(%ebp),%eax
+  801151:	50                   	push   %eax
+  801152:	57                   	push   %edi
+  801153:	e8 49 ff ff ff       	call   8010a1 <read>
+		if (m < 0)
+  801158:	83 c4 10             	add    $0x10,%esp
+  80115b:	85 c0                	test   %eax,%eax
+  80115d:	78 04                	js     801163 <readn+0x3b>
+			return m;
+		if (m == 0)
+  80115f:	75 dd                	jne    80113e <readn+0x16>
+  801161:	eb 02                	jmp    801165 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801163:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801165:	89 d8                	mov    %ebx,%eax
+  801167:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80116a:	5b                   	pop    %ebx
+  80116b:	5e                   	pop    %esi
+  80116c:	5f                   	pop    %edi
+  80116d:	5d                   	pop    %ebp
+  80116e:	c3                   	ret
+
+0080116f <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80116f:	55                   	push   %ebp
+  801170:	89 e5                	mov    %esp,%ebp
+  801172:	56                   	push   %esi
+  801173:	53                   	push   %ebx
+  801174:	83 ec 18             	sub    $0x18,%esp
+  801177:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80117a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80117d:	50                   	push   %eax
+  80117e:	53                   	push   %ebx
+  80117f:	e8 b7 fc ff ff       	call   800e3b <fd_lookup>
+  801184:	83 c4 10             	add    $0x10,%esp
+  801187:	85 c0                	test   %eax,%eax
+  801189:	78 37                	js     8011c2 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80118b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80118e:	83 ec 08             	sub    $0x8,%esp
+  801191:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801194:	50                   	push   %eax
+  801195:	ff 36                	push   (%esi)
+  801197:	e8 ef fc ff ff       	call   800e8b <dev_lookup>
+  80119c:	83 c4 10             	add    $0x10,%esp
+  80119f:	85 c0                	test   %eax,%eax
+  8011a1:	78 1f                	js     8011c2 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8011a3:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8011a7:	74 20                	je     8011c9 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8011a9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8011ac:	8b 40 0c             	mov    0xc(%eax),%eax
+  8011af:	85 c0                	test   %eax,%eax
+  8011b1:	74 37                	je     8011ea <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8011b3:	83 ec 04             	sub    $0x4,%esp
+  8011b6:	ff 75 10             	push   0x10(%ebp)
+  8011b9:	ff 75 0c             	push   0xc(%ebp)
+  8011bc:	56                   	push   %esi
+  8011bd:	ff d0                	call   *%eax
+  8011bf:	83 c4 10             	add    $0x10,%esp
+}
+  8011c2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8011c5:	5b                   	pop    %ebx
+  8011c6:	5e                   	pop    %esi
+  8011c7:	5d                   	pop    %ebp
+  8011c8:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8011c9:	a1 08 40 80 00       	mov    0x804008,%eax
+  8011ce:	8b 40 48             	mov    0x48(%eax),%eax
+  8011d1:	83 ec 04             	sub    $0x4,%esp
+  8011d4:	53                   	push   %ebx
+  8011d5:	50                   	push   %eax
+  8011d6:	68 ad 28 80 00       	push   $0x8028ad
+  8011db:	e8 66 ef ff ff       	call   800146 <cprintf>
+		return -E_INVAL;
+  8011e0:	83 c4 10             	add    $0x10,%esp
+  8011e3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011e8:	eb d8                	jmp    8011c2 <write+0x53>
+		return -E_NOT_SUPP;
+  8011ea:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8011ef:	eb d1                	jmp    8011c2 <write+0x53>
+
+008011f1 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8011f1:	55                   	push   %ebp
+  8011f2:	89 e5                	mov    %esp,%ebp
+  8011f4:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8011f7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8011fa:	50                   	push   %eax
+  8011fb:	ff 75 08             	push   0x8(%ebp)
+  8011fe:	e8 38 fc ff ff       	call   800e3b <fd_lookup>
+  801203:	83 c4 10             	add    $0x10,%esp
+  801206:	85 c0                	test   %eax,%eax
+  801208:	78 0e                	js     801218 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80120a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80120d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801210:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801213:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801218:	c9                   	leave
+  801219:	c3                   	ret
+
+0080121a <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80121a:	55                   	push   %ebp
+  80121b:	89 e5                	mov    %esp,%ebp
+  80121d:	56                   	push   %esi
+  80121e:	53                   	push   %ebx
+  80121f:	83 ec 18             	sub    $0x18,%esp
+  801222:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801225:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801228:	50                   	push   %eax
+  801229:	53                   	push   %ebx
+  80122a:	e8 0c fc ff ff       	call   800e3b <fd_lookup>
+  80122f:	83 c4 10             	add    $0x10,%esp
+  801232:	85 c0                	test   %eax,%eax
+  801234:	78 34                	js     80126a <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801236:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801239:	83 ec 08             	sub    $0x8,%esp
+  80123c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80123f:	50                   	push   %eax
+  801240:	ff 36                	push   (%esi)
+  801242:	e8 44 fc ff ff       	call   800e8b <dev_lookup>
+  801247:	83 c4 10             	add    $0x10,%esp
+  80124a:	85 c0                	test   %eax,%eax
+  80124c:	78 1c                	js     80126a <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80124e:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801252:	74 1d                	je     801271 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801254:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801257:	8b 40 18             	mov    0x18(%eax),%eax
+  80125a:	85 c0                	test   %eax,%eax
+  80125c:	74 34                	je     801292 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80125e:	83 ec 08             	sub    $0x8,%esp
+  801261:	ff 75 0c             	push   0xc(%ebp)
+  801264:	56                   	push   %esi
+  801265:	ff d0                	call   *%eax
+  801267:	83 c4 10             	add    $0x10,%esp
+}
+  80126a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80126d:	5b                   	pop    %ebx
+  80126e:	5e                   	pop    %esi
+  80126f:	5d                   	pop    %ebp
+  801270:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801271:	a1 08 40 80 00       	mov    0x804008,%eax
+  801276:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801279:	83 ec 04             	sub    $0x4,%esp
+  80127c:	53                   	push   %ebx
+  80127d:	50                   	push   %eax
+  80127e:	68 70 28 80 00       	push   $0x802870
+  801283:	e8 be ee ff ff       	call   800146 <cprintf>
+		return -E_INVAL;
+  801288:	83 c4 10             	add    $0x10,%esp
+  80128b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801290:	eb d8                	jmp    80126a <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801292:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801297:	eb d1                	jmp    80126a <ftruncate+0x50>
+
+00801299 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801299:	55                   	push   %ebp
+  80129a:	89 e5                	mov    %esp,%ebp
+  80129c:	56                   	push   %esi
+  80129d:	53                   	push   %ebx
+  80129e:	83 ec 18             	sub    $0x18,%esp
+  8012a1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8012a4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8012a7:	50                   	push   %eax
+  8012a8:	ff 75 08             	push   0x8(%ebp)
+  8012ab:	e8 8b fb ff ff       	call   800e3b <fd_lookup>
+  8012b0:	83 c4 10             	add    $0x10,%esp
+  8012b3:	85 c0                	test   %eax,%eax
+  8012b5:	78 49                	js     801300 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8012b7:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8012ba:	83 ec 08             	sub    $0x8,%esp
+  8012bd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8012c0:	50                   	push   %eax
+  8012c1:	ff 36                	push   (%esi)
+  8012c3:	e8 c3 fb ff ff       	call   800e8b <dev_lookup>
+  8012c8:	83 c4 10             	add    $0x10,%esp
+  8012cb:	85 c0                	test   %eax,%eax
+  8012cd:	78 31                	js     801300 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8012cf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8012d2:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8012d6:	74 2f                	je     801307 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8012d8:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8012db:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8012e2:	00 00 00 
+	stat->st_isdir = 0;
+  8012e5:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8012ec:	00 00 00 
+	stat->st_dev = dev;
+  8012ef:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8012f5:	83 ec 08             	sub    $0x8,%esp
+  8012f8:	53                   	push   %ebx
+  8012f9:	56                   	push   %esi
+  8012fa:	ff 50 14             	call   *0x14(%eax)
+  8012fd:	83 c4 10             	add    $0x10,%esp
+}
+  801300:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801303:	5b                   	pop    %ebx
+  801304:	5e                   	pop    %esi
+  801305:	5d                   	pop    %ebp
+  801306:	c3                   	ret
+		return -E_NOT_SUPP;
+  801307:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80130c:	eb f2                	jmp    801300 <fstat+0x67>
+
+0080130e <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80130e:	55                   	push   %ebp
+  80130f:	89 e5                	mov    %esp,%ebp
+  801311:	56                   	push   %esi
+  801312:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801313:	83 ec 08             	sub    $0x8,%esp
+  801316:	6a 00                	push   $0x0
+  801318:	ff 75 08             	push   0x8(%ebp)
+  80131b:	e8 e4 01 00 00       	call   801504 <open>
+  801320:	89 c3                	mov    %eax,%ebx
+  801322:	83 c4 10             	add    $0x10,%esp
+  801325:	85 c0                	test   %eax,%eax
+  801327:	78 1b                	js     801344 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801329:	83 ec 08             	sub    $0x8,%esp
+  80132c:	ff 75 0c             	push   0xc(%ebp)
+  80132f:	50                   	push   %eax
+  801330:	e8 64 ff ff ff       	call   801299 <fstat>
+  801335:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801337:	89 1c 24             	mov    %ebx,(%esp)
+  80133a:	e8 26 fc ff ff       	call   800f65 <close>
+	return r;
+  80133f:	83 c4 10             	add    $0x10,%esp
+  801342:	89 f3                	mov    %esi,%ebx
+}
+  801344:	89 d8                	mov    %ebx,%eax
+  801346:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801349:	5b                   	pop    %ebx
+  80134a:	5e                   	pop    %esi
+  80134b:	5d                   	pop    %ebp
+  80134c:	c3                   	ret
+
+0080134d <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  80134d:	55                   	push   %ebp
+  80134e:	89 e5                	mov    %esp,%ebp
+  801350:	56                   	push   %esi
+  801351:	53                   	push   %ebx
+  801352:	89 c6                	mov    %eax,%esi
+  801354:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  801356:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  80135d:	74 27                	je     801386 <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80135f:	6a 07                	push   $0x7
+  801361:	68 00 50 80 00       	push   $0x805000
+  801366:	56                   	push   %esi
+  801367:	ff 35 00 40 80 00    	push   0x804000
+  80136d:	e8 17 0c 00 00       	call   801f89 <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  801372:	83 c4 0c             	add    $0xc,%esp
+  801375:	6a 00                	push   $0x0
+  801377:	53                   	push   %ebx
+  801378:	6a 00                	push   $0x0
+  80137a:	e8 96 0b 00 00       	call   801f15 <ipc_recv>
+}
+  80137f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801382:	5b                   	pop    %ebx
+  801383:	5e                   	pop    %esi
+  801384:	5d                   	pop    %ebp
+  801385:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  801386:	83 ec 0c             	sub    $0xc,%esp
+  801389:	6a 01                	push   $0x1
+  80138b:	e8 4d 0c 00 00       	call   801fdd <ipc_find_env>
+  801390:	a3 00 40 80 00       	mov    %eax,0x804000
+  801395:	83 c4 10             	add    $0x10,%esp
+  801398:	eb c5                	jmp    80135f <fsipc+0x12>
+
+0080139a <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80139a:	55                   	push   %ebp
+  80139b:	89 e5                	mov    %esp,%ebp
+  80139d:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8013a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013a3:	8b 40 0c             	mov    0xc(%eax),%eax
+  8013a6:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.set_size.req_size = newsize;
+  8013ab:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8013ae:	a3 04 50 80 00       	mov    %eax,0x805004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  8013b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013b8:	b8 02 00 00 00       	mov    $0x2,%eax
+  8013bd:	e8 8b ff ff ff       	call   80134d <fsipc>
+}
+  8013c2:	c9                   	leave
+  8013c3:	c3                   	ret
+
+008013c4 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8013c4:	55                   	push   %ebp
+  8013c5:	89 e5                	mov    %esp,%ebp
+  8013c7:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8013ca:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013cd:	8b 40 0c             	mov    0xc(%eax),%eax
+  8013d0:	a3 00 50 80 00       	mov    %eax,0x805000
+  return fsipc(FSREQ_FLUSH, NULL);
+  8013d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013da:	b8 06 00 00 00       	mov    $0x6,%eax
+  8013df:	e8 69 ff ff ff       	call   80134d <fsipc>
+}
+  8013e4:	c9                   	leave
+  8013e5:	c3                   	ret
+
+008013e6 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8013e6:	55                   	push   %ebp
+  8013e7:	89 e5                	mov    %esp,%ebp
+  8013e9:	53                   	push   %ebx
+  8013ea:	83 ec 04             	sub    $0x4,%esp
+  8013ed:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8013f0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013f3:	8b 40 0c             	mov    0xc(%eax),%eax
+  8013f6:	a3 00 50 80 00       	mov    %eax,0x805000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8013fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801400:	b8 05 00 00 00       	mov    $0x5,%eax
+  801405:	e8 43 ff ff ff       	call   80134d <fsipc>
+  80140a:	85 c0                	test   %eax,%eax
+  80140c:	78 2c                	js     80143a <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80140e:	83 ec 08             	sub    $0x8,%esp
+  801411:	68 00 50 80 00       	push   $0x805000
+  801416:	53                   	push   %ebx
+  801417:	e8 e3 f2 ff ff       	call   8006ff <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  80141c:	a1 80 50 80 00       	mov    0x805080,%eax
+  801421:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801427:	a1 84 50 80 00       	mov    0x805084,%eax
+  80142c:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801432:	83 c4 10             	add    $0x10,%esp
+  801435:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80143a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80143d:	c9                   	leave
+  80143e:	c3                   	ret
+
+0080143f <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80143f:	55                   	push   %ebp
+  801440:	89 e5                	mov    %esp,%ebp
+  801442:	83 ec 0c             	sub    $0xc,%esp
+  801445:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801448:	8b 55 08             	mov    0x8(%ebp),%edx
+  80144b:	8b 52 0c             	mov    0xc(%edx),%edx
+  80144e:	89 15 00 50 80 00    	mov    %edx,0x805000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801454:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801459:	39 d0                	cmp    %edx,%eax
+  80145b:	0f 47 c2             	cmova  %edx,%eax
+  80145e:	a3 04 50 80 00       	mov    %eax,0x805004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  801463:	50                   	push   %eax
+  801464:	ff 75 0c             	push   0xc(%ebp)
+  801467:	68 08 50 80 00       	push   $0x805008
+  80146c:	e8 14 f4 ff ff       	call   800885 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801471:	ba 00 00 00 00       	mov    $0x0,%edx
+  801476:	b8 04 00 00 00       	mov    $0x4,%eax
+  80147b:	e8 cd fe ff ff       	call   80134d <fsipc>
+}
+  801480:	c9                   	leave
+  801481:	c3                   	ret
+
+00801482 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801482:	55                   	push   %ebp
+  801483:	89 e5                	mov    %esp,%ebp
+  801485:	56                   	push   %esi
+  801486:	53                   	push   %ebx
+  801487:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80148a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80148d:	8b 40 0c             	mov    0xc(%eax),%eax
+  801490:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.read.req_n = n;
+  801495:	89 35 04 50 80 00    	mov    %esi,0x805004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  80149b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014a0:	b8 03 00 00 00       	mov    $0x3,%eax
+  8014a5:	e8 a3 fe ff ff       	call   80134d <fsipc>
+  8014aa:	89 c3                	mov    %eax,%ebx
+  8014ac:	85 c0                	test   %eax,%eax
+  8014ae:	78 1f                	js     8014cf <devfile_read+0x4d>
+  assert(r <= n);
+  8014b0:	39 c6                	cmp    %eax,%esi
+  8014b2:	72 24                	jb     8014d8 <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  8014b4:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8014b9:	7f 33                	jg     8014ee <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8014bb:	83 ec 04             	sub    $0x4,%esp
+  8014be:	50                   	push   %eax
+  8014bf:	68 00 50 80 00       	push   $0x805000
+  8014c4:	ff 75 0c             	push   0xc(%ebp)
+  8014c7:	e8 b9 f3 ff ff       	call   800885 <memmove>
+  return r;
+  8014cc:	83 c4 10             	add    $0x10,%esp
+}
+  8014cf:	89 d8                	mov    %ebx,%eax
+  8014d1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014d4:	5b                   	pop    %ebx
+  8014d5:	5e                   	pop    %esi
+  8014d6:	5d                   	pop    %ebp
+  8014d7:	c3                   	ret
+  assert(r <= n);
+  8014d8:	68 e0 28 80 00       	push   $0x8028e0
+  8014dd:	68 e7 28 80 00       	push   $0x8028e7
+  8014e2:	6a 78                	push   $0x78
+  8014e4:	68 fc 28 80 00       	push   $0x8028fc
+  8014e9:	e8 e1 09 00 00       	call   801ecf <_panic>
+  assert(r <= PGSIZE);
+  8014ee:	68 07 29 80 00       	push   $0x802907
+  8014f3:	68 e7 28 80 00       	push   $0x8028e7
+  8014f8:	6a 79                	push   $0x79
+  8014fa:	68 fc 28 80 00       	push   $0x8028fc
+  8014ff:	e8 cb 09 00 00       	call   801ecf <_panic>
+
+00801504 <open>:
+open(const char *path, int mode) {
+  801504:	55                   	push   %ebp
+  801505:	89 e5                	mov    %esp,%ebp
+  801507:	56                   	push   %esi
+  801508:	53                   	push   %ebx
+  801509:	83 ec 1c             	sub    $0x1c,%esp
+  80150c:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  80150f:	56                   	push   %esi
+  801510:	e8 af f1 ff ff       	call   8006c4 <strlen>
+  801515:	83 c4 10             	add    $0x10,%esp
+  801518:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80151d:	7f 6c                	jg     80158b <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  80151f:	83 ec 0c             	sub    $0xc,%esp
+  801522:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801525:	50                   	push   %eax
+  801526:	e8 ba f8 ff ff       	call   800de5 <fd_alloc>
+  80152b:	89 c3                	mov    %eax,%ebx
+  80152d:	83 c4 10             	add    $0x10,%esp
+  801530:	85 c0                	test   %eax,%eax
+  801532:	78 3c                	js     801570 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801534:	83 ec 08             	sub    $0x8,%esp
+  801537:	56                   	push   %esi
+  801538:	68 00 50 80 00       	push   $0x805000
+  80153d:	e8 bd f1 ff ff       	call   8006ff <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801542:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801545:	a3 00 54 80 00       	mov    %eax,0x805400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80154a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80154d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801552:	e8 f6 fd ff ff       	call   80134d <fsipc>
+  801557:	89 c3                	mov    %eax,%ebx
+  801559:	83 c4 10             	add    $0x10,%esp
+  80155c:	85 c0                	test   %eax,%eax
+  80155e:	78 19                	js     801579 <open+0x75>
+  return fd2num(fd);
+  801560:	83 ec 0c             	sub    $0xc,%esp
+  801563:	ff 75 f4             	push   -0xc(%ebp)
+  801566:	e8 53 f8 ff ff       	call   800dbe <fd2num>
+  80156b:	89 c3                	mov    %eax,%ebx
+  80156d:	83 c4 10             	add    $0x10,%esp
+}
+  801570:	89 d8                	mov    %ebx,%eax
+  801572:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801575:	5b                   	pop    %ebx
+  801576:	5e                   	pop    %esi
+  801577:	5d                   	pop    %ebp
+  801578:	c3                   	ret
+    fd_close(fd, 0);
+  801579:	83 ec 08             	sub    $0x8,%esp
+  80157c:	6a 00                	push   $0x0
+  80157e:	ff 75 f4             	push   -0xc(%ebp)
+  801581:	e8 58 f9 ff ff       	call   800ede <fd_close>
+    return r;
+  801586:	83 c4 10             	add    $0x10,%esp
+  801589:	eb e5                	jmp    801570 <open+0x6c>
+    return -E_BAD_PATH;
+  80158b:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801590:	eb de                	jmp    801570 <open+0x6c>
+
+00801592 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  801592:	55                   	push   %ebp
+  801593:	89 e5                	mov    %esp,%ebp
+  801595:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801598:	ba 00 00 00 00       	mov    $0x0,%edx
+  80159d:	b8 08 00 00 00       	mov    $0x8,%eax
+  8015a2:	e8 a6 fd ff ff       	call   80134d <fsipc>
+}
+  8015a7:	c9                   	leave
+  8015a8:	c3                   	ret
+
+008015a9 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8015a9:	55                   	push   %ebp
+  8015aa:	89 e5                	mov    %esp,%ebp
+  8015ac:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8015af:	68 13 29 80 00       	push   $0x802913
+  8015b4:	ff 75 0c             	push   0xc(%ebp)
+  8015b7:	e8 43 f1 ff ff       	call   8006ff <strcpy>
+	return 0;
+}
+  8015bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015c1:	c9                   	leave
+  8015c2:	c3                   	ret
+
+008015c3 <devsock_close>:
+{
+  8015c3:	55                   	push   %ebp
+  8015c4:	89 e5                	mov    %esp,%ebp
+  8015c6:	53                   	push   %ebx
+  8015c7:	83 ec 10             	sub    $0x10,%esp
+  8015ca:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8015cd:	53                   	push   %ebx
+  8015ce:	e8 49 0a 00 00       	call   80201c <pageref>
+  8015d3:	89 c2                	mov    %eax,%edx
+  8015d5:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8015d8:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8015dd:	83 fa 01             	cmp    $0x1,%edx
+  8015e0:	74 05                	je     8015e7 <devsock_close+0x24>
+}
+  8015e2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015e5:	c9                   	leave
+  8015e6:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8015e7:	83 ec 0c             	sub    $0xc,%esp
+  8015ea:	ff 73 0c             	push   0xc(%ebx)
+  8015ed:	e8 b7 02 00 00       	call   8018a9 <nsipc_close>
+  8015f2:	83 c4 10             	add    $0x10,%esp
+  8015f5:	eb eb                	jmp    8015e2 <devsock_close+0x1f>
+
+008015f7 <devsock_write>:
+{
+  8015f7:	55                   	push   %ebp
+  8015f8:	89 e5                	mov    %esp,%ebp
+  8015fa:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8015fd:	6a 00                	push   $0x0
+  8015ff:	ff 75 10             	push   0x10(%ebp)
+  801602:	ff 75 0c             	push   0xc(%ebp)
+  801605:	8b 45 08             	mov    0x8(%ebp),%eax
+  801608:	ff 70 0c             	push   0xc(%eax)
+  80160b:	e8 79 03 00 00       	call   801989 <nsipc_send>
+}
+  801610:	c9                   	leave
+  801611:	c3                   	ret
+
+00801612 <devsock_read>:
+{
+  801612:	55                   	push   %ebp
+  801613:	89 e5                	mov    %esp,%ebp
+  801615:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801618:	6a 00                	push   $0x0
+  80161a:	ff 75 10             	push   0x10(%ebp)
+  80161d:	ff 75 0c             	push   0xc(%ebp)
+  801620:	8b 45 08             	mov    0x8(%ebp),%eax
+  801623:	ff 70 0c             	push   0xc(%eax)
+  801626:	e8 ef 02 00 00       	call   80191a <nsipc_recv>
+}
+  80162b:	c9                   	leave
+  80162c:	c3                   	ret
+
+0080162d <fd2sockid>:
+{
+  80162d:	55                   	push   %ebp
+  80162e:	89 e5                	mov    %esp,%ebp
+  801630:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801633:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801636:	52                   	push   %edx
+  801637:	50                   	push   %eax
+  801638:	e8 fe f7 ff ff       	call   800e3b <fd_lookup>
+  80163d:	83 c4 10             	add    $0x10,%esp
+  801640:	85 c0                	test   %eax,%eax
+  801642:	78 10                	js     801654 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801644:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801647:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  80164d:	39 08                	cmp    %ecx,(%eax)
+  80164f:	75 05                	jne    801656 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801651:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801654:	c9                   	leave
+  801655:	c3                   	ret
+		return -E_NOT_SUPP;
+  801656:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80165b:	eb f7                	jmp    801654 <fd2sockid+0x27>
+
+0080165d <alloc_sockfd>:
+{
+  80165d:	55                   	push   %ebp
+  80165e:	89 e5                	mov    %esp,%ebp
+  801660:	56                   	push   %esi
+  801661:	53                   	push   %ebx
+  801662:	83 ec 1c             	sub    $0x1c,%esp
+  801665:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801667:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80166a:	50                   	push   %eax
+  80166b:	e8 75 f7 ff ff       	call   800de5 <fd_alloc>
+  801670:	89 c3                	mov    %eax,%ebx
+  801672:	83 c4 10             	add    $0x10,%esp
+  801675:	85 c0                	test   %eax,%eax
+  801677:	78 43                	js     8016bc <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801679:	83 ec 04             	sub    $0x4,%esp
+  80167c:	68 07 04 00 00       	push   $0x407
+  801681:	ff 75 f4             	push   -0xc(%ebp)
+  801684:	6a 00                	push   $0x0
+  801686:	e8 60 f4 ff ff       	call   800aeb <sys_page_alloc>
+  80168b:	89 c3                	mov    %eax,%ebx
+  80168d:	83 c4 10             	add    $0x10,%esp
+  801690:	85 c0                	test   %eax,%eax
+  801692:	78 28                	js     8016bc <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801694:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801697:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  80169d:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  80169f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016a2:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8016a9:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8016ac:	83 ec 0c             	sub    $0xc,%esp
+  8016af:	50                   	push   %eax
+  8016b0:	e8 09 f7 ff ff       	call   800dbe <fd2num>
+  8016b5:	89 c3                	mov    %eax,%ebx
+  8016b7:	83 c4 10             	add    $0x10,%esp
+  8016ba:	eb 0c                	jmp    8016c8 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8016bc:	83 ec 0c             	sub    $0xc,%esp
+  8016bf:	56                   	push   %esi
+  8016c0:	e8 e4 01 00 00       	call   8018a9 <nsipc_close>
+		return r;
+  8016c5:	83 c4 10             	add    $0x10,%esp
+}
+  8016c8:	89 d8                	mov    %ebx,%eax
+  8016ca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016cd:	5b                   	pop    %ebx
+  8016ce:	5e                   	pop    %esi
+  8016cf:	5d                   	pop    %ebp
+  8016d0:	c3                   	ret
+
+008016d1 <accept>:
+{
+  8016d1:	55                   	push   %ebp
+  8016d2:	89 e5                	mov    %esp,%ebp
+  8016d4:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8016d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016da:	e8 4e ff ff ff       	call   80162d <fd2sockid>
+  8016df:	85 c0                	test   %eax,%eax
+  8016e1:	78 1b                	js     8016fe <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8016e3:	83 ec 04             	sub    $0x4,%esp
+  8016e6:	ff 75 10             	push   0x10(%ebp)
+  8016e9:	ff 75 0c             	push   0xc(%ebp)
+  8016ec:	50                   	push   %eax
+  8016ed:	e8 0e 01 00 00       	call   801800 <nsipc_accept>
+  8016f2:	83 c4 10             	add    $0x10,%esp
+  8016f5:	85 c0                	test   %eax,%eax
+  8016f7:	78 05                	js     8016fe <accept+0x2d>
+	return alloc_sockfd(r);
+  8016f9:	e8 5f ff ff ff       	call   80165d <alloc_sockfd>
+}
+  8016fe:	c9                   	leave
+  8016ff:	c3                   	ret
+
+00801700 <bind>:
+{
+  801700:	55                   	push   %ebp
+  801701:	89 e5                	mov    %esp,%ebp
+  801703:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801706:	8b 45 08             	mov    0x8(%ebp),%eax
+  801709:	e8 1f ff ff ff       	call   80162d <fd2sockid>
+  80170e:	85 c0                	test   %eax,%eax
+  801710:	78 12                	js     801724 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801712:	83 ec 04             	sub    $0x4,%esp
+  801715:	ff 75 10             	push   0x10(%ebp)
+  801718:	ff 75 0c             	push   0xc(%ebp)
+  80171b:	50                   	push   %eax
+  80171c:	e8 31 01 00 00       	call   801852 <nsipc_bind>
+  801721:	83 c4 10             	add    $0x10,%esp
+}
+  801724:	c9                   	leave
+  801725:	c3                   	ret
+
+00801726 <shutdown>:
+{
+  801726:	55                   	push   %ebp
+  801727:	89 e5                	mov    %esp,%ebp
+  801729:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80172c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80172f:	e8 f9 fe ff ff       	call   80162d <fd2sockid>
+  801734:	85 c0                	test   %eax,%eax
+  801736:	78 0f                	js     801747 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801738:	83 ec 08             	sub    $0x8,%esp
+  80173b:	ff 75 0c             	push   0xc(%ebp)
+  80173e:	50                   	push   %eax
+  80173f:	e8 43 01 00 00       	call   801887 <nsipc_shutdown>
+  801744:	83 c4 10             	add    $0x10,%esp
+}
+  801747:	c9                   	leave
+  801748:	c3                   	ret
+
+00801749 <connect>:
+{
+  801749:	55                   	push   %ebp
+  80174a:	89 e5                	mov    %esp,%ebp
+  80174c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80174f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801752:	e8 d6 fe ff ff       	call   80162d <fd2sockid>
+  801757:	85 c0                	test   %eax,%eax
+  801759:	78 12                	js     80176d <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  80175b:	83 ec 04             	sub    $0x4,%esp
+  80175e:	ff 75 10             	push   0x10(%ebp)
+  801761:	ff 75 0c             	push   0xc(%ebp)
+  801764:	50                   	push   %eax
+  801765:	e8 59 01 00 00       	call   8018c3 <nsipc_connect>
+  80176a:	83 c4 10             	add    $0x10,%esp
+}
+  80176d:	c9                   	leave
+  80176e:	c3                   	ret
+
+0080176f <listen>:
+{
+  80176f:	55                   	push   %ebp
+  801770:	89 e5                	mov    %esp,%ebp
+  801772:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801775:	8b 45 08             	mov    0x8(%ebp),%eax
+  801778:	e8 b0 fe ff ff       	call   80162d <fd2sockid>
+  80177d:	85 c0                	test   %eax,%eax
+  80177f:	78 0f                	js     801790 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801781:	83 ec 08             	sub    $0x8,%esp
+  801784:	ff 75 0c             	push   0xc(%ebp)
+  801787:	50                   	push   %eax
+  801788:	e8 6b 01 00 00       	call   8018f8 <nsipc_listen>
+  80178d:	83 c4 10             	add    $0x10,%esp
+}
+  801790:	c9                   	leave
+  801791:	c3                   	ret
+
+00801792 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801792:	55                   	push   %ebp
+  801793:	89 e5                	mov    %esp,%ebp
+  801795:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801798:	ff 75 10             	push   0x10(%ebp)
+  80179b:	ff 75 0c             	push   0xc(%ebp)
+  80179e:	ff 75 08             	push   0x8(%ebp)
+  8017a1:	e8 41 02 00 00       	call   8019e7 <nsipc_socket>
+  8017a6:	83 c4 10             	add    $0x10,%esp
+  8017a9:	85 c0                	test   %eax,%eax
+  8017ab:	78 05                	js     8017b2 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8017ad:	e8 ab fe ff ff       	call   80165d <alloc_sockfd>
+}
+  8017b2:	c9                   	leave
+  8017b3:	c3                   	ret
+
+008017b4 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8017b4:	55                   	push   %ebp
+  8017b5:	89 e5                	mov    %esp,%ebp
+  8017b7:	53                   	push   %ebx
+  8017b8:	83 ec 04             	sub    $0x4,%esp
+  8017bb:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  8017bd:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8017c4:	74 26                	je     8017ec <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8017c6:	6a 07                	push   $0x7
+  8017c8:	68 00 60 80 00       	push   $0x806000
+  8017cd:	53                   	push   %ebx
+  8017ce:	ff 35 04 40 80 00    	push   0x804004
+  8017d4:	e8 b0 07 00 00       	call   801f89 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8017d9:	83 c4 0c             	add    $0xc,%esp
+  8017dc:	6a 00                	push   $0x0
+  8017de:	6a 00                	push   $0x0
+  8017e0:	6a 00                	push   $0x0
+  8017e2:	e8 2e 07 00 00       	call   801f15 <ipc_recv>
+}
+  8017e7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017ea:	c9                   	leave
+  8017eb:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8017ec:	83 ec 0c             	sub    $0xc,%esp
+  8017ef:	6a 02                	push   $0x2
+  8017f1:	e8 e7 07 00 00       	call   801fdd <ipc_find_env>
+  8017f6:	a3 04 40 80 00       	mov    %eax,0x804004
+  8017fb:	83 c4 10             	add    $0x10,%esp
+  8017fe:	eb c6                	jmp    8017c6 <nsipc+0x12>
+
+00801800 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801800:	55                   	push   %ebp
+  801801:	89 e5                	mov    %esp,%ebp
+  801803:	56                   	push   %esi
+  801804:	53                   	push   %ebx
+  801805:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801808:	8b 45 08             	mov    0x8(%ebp),%eax
+  80180b:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801810:	8b 06                	mov    (%esi),%eax
+  801812:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801817:	b8 01 00 00 00       	mov    $0x1,%eax
+  80181c:	e8 93 ff ff ff       	call   8017b4 <nsipc>
+  801821:	89 c3                	mov    %eax,%ebx
+  801823:	85 c0                	test   %eax,%eax
+  801825:	79 09                	jns    801830 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801827:	89 d8                	mov    %ebx,%eax
+  801829:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80182c:	5b                   	pop    %ebx
+  80182d:	5e                   	pop    %esi
+  80182e:	5d                   	pop    %ebp
+  80182f:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801830:	83 ec 04             	sub    $0x4,%esp
+  801833:	ff 35 10 60 80 00    	push   0x806010
+  801839:	68 00 60 80 00       	push   $0x806000
+  80183e:	ff 75 0c             	push   0xc(%ebp)
+  801841:	e8 3f f0 ff ff       	call   800885 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801846:	a1 10 60 80 00       	mov    0x806010,%eax
+  80184b:	89 06                	mov    %eax,(%esi)
+  80184d:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801850:	eb d5                	jmp    801827 <nsipc_accept+0x27>
+
+00801852 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801852:	55                   	push   %ebp
+  801853:	89 e5                	mov    %esp,%ebp
+  801855:	53                   	push   %ebx
+  801856:	83 ec 08             	sub    $0x8,%esp
+  801859:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  80185c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80185f:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801864:	53                   	push   %ebx
+  801865:	ff 75 0c             	push   0xc(%ebp)
+  801868:	68 04 60 80 00       	push   $0x806004
+  80186d:	e8 13 f0 ff ff       	call   800885 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801872:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  801878:	b8 02 00 00 00       	mov    $0x2,%eax
+  80187d:	e8 32 ff ff ff       	call   8017b4 <nsipc>
+}
+  801882:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801885:	c9                   	leave
+  801886:	c3                   	ret
+
+00801887 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801887:	55                   	push   %ebp
+  801888:	89 e5                	mov    %esp,%ebp
+  80188a:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  80188d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801890:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  801895:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801898:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  80189d:	b8 03 00 00 00       	mov    $0x3,%eax
+  8018a2:	e8 0d ff ff ff       	call   8017b4 <nsipc>
+}
+  8018a7:	c9                   	leave
+  8018a8:	c3                   	ret
+
+008018a9 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8018a9:	55                   	push   %ebp
+  8018aa:	89 e5                	mov    %esp,%ebp
+  8018ac:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8018af:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018b2:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  8018b7:	b8 04 00 00 00       	mov    $0x4,%eax
+  8018bc:	e8 f3 fe ff ff       	call   8017b4 <nsipc>
+}
+  8018c1:	c9                   	leave
+  8018c2:	c3                   	ret
+
+008018c3 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8018c3:	55                   	push   %ebp
+  8018c4:	89 e5                	mov    %esp,%ebp
+  8018c6:	53                   	push   %ebx
+  8018c7:	83 ec 08             	sub    $0x8,%esp
+  8018ca:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8018cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018d0:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8018d5:	53                   	push   %ebx
+  8018d6:	ff 75 0c             	push   0xc(%ebp)
+  8018d9:	68 04 60 80 00       	push   $0x806004
+  8018de:	e8 a2 ef ff ff       	call   800885 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8018e3:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  8018e9:	b8 05 00 00 00       	mov    $0x5,%eax
+  8018ee:	e8 c1 fe ff ff       	call   8017b4 <nsipc>
+}
+  8018f3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018f6:	c9                   	leave
+  8018f7:	c3                   	ret
+
+008018f8 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8018f8:	55                   	push   %ebp
+  8018f9:	89 e5                	mov    %esp,%ebp
+  8018fb:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8018fe:	8b 45 08             	mov    0x8(%ebp),%eax
+  801901:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  801906:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801909:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  80190e:	b8 06 00 00 00       	mov    $0x6,%eax
+  801913:	e8 9c fe ff ff       	call   8017b4 <nsipc>
+}
+  801918:	c9                   	leave
+  801919:	c3                   	ret
+
+0080191a <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  80191a:	55                   	push   %ebp
+  80191b:	89 e5                	mov    %esp,%ebp
+  80191d:	56                   	push   %esi
+  80191e:	53                   	push   %ebx
+  80191f:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801922:	8b 45 08             	mov    0x8(%ebp),%eax
+  801925:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  80192a:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  801930:	8b 45 14             	mov    0x14(%ebp),%eax
+  801933:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801938:	b8 07 00 00 00       	mov    $0x7,%eax
+  80193d:	e8 72 fe ff ff       	call   8017b4 <nsipc>
+  801942:	89 c3                	mov    %eax,%ebx
+  801944:	85 c0                	test   %eax,%eax
+  801946:	78 22                	js     80196a <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801948:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80194d:	39 c6                	cmp    %eax,%esi
+  80194f:	0f 4e c6             	cmovle %esi,%eax
+  801952:	39 c3                	cmp    %eax,%ebx
+  801954:	7f 1d                	jg     801973 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801956:	83 ec 04             	sub    $0x4,%esp
+  801959:	53                   	push   %ebx
+  80195a:	68 00 60 80 00       	push   $0x806000
+  80195f:	ff 75 0c             	push   0xc(%ebp)
+  801962:	e8 1e ef ff ff       	call   800885 <memmove>
+  801967:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  80196a:	89 d8                	mov    %ebx,%eax
+  80196c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80196f:	5b                   	pop    %ebx
+  801970:	5e                   	pop    %esi
+  801971:	5d                   	pop    %ebp
+  801972:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801973:	68 1f 29 80 00       	push   $0x80291f
+  801978:	68 e7 28 80 00       	push   $0x8028e7
+  80197d:	6a 62                	push   $0x62
+  80197f:	68 34 29 80 00       	push   $0x802934
+  801984:	e8 46 05 00 00       	call   801ecf <_panic>
+
+00801989 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801989:	55                   	push   %ebp
+  80198a:	89 e5                	mov    %esp,%ebp
+  80198c:	53                   	push   %ebx
+  80198d:	83 ec 04             	sub    $0x4,%esp
+  801990:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801993:	8b 45 08             	mov    0x8(%ebp),%eax
+  801996:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  80199b:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8019a1:	7f 2e                	jg     8019d1 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8019a3:	83 ec 04             	sub    $0x4,%esp
+  8019a6:	53                   	push   %ebx
+  8019a7:	ff 75 0c             	push   0xc(%ebp)
+  8019aa:	68 0c 60 80 00       	push   $0x80600c
+  8019af:	e8 d1 ee ff ff       	call   800885 <memmove>
+	nsipcbuf.send.req_size = size;
+  8019b4:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  8019ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019bd:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  8019c2:	b8 08 00 00 00       	mov    $0x8,%eax
+  8019c7:	e8 e8 fd ff ff       	call   8017b4 <nsipc>
+}
+  8019cc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019cf:	c9                   	leave
+  8019d0:	c3                   	ret
+	assert(size < 1600);
+  8019d1:	68 40 29 80 00       	push   $0x802940
+  8019d6:	68 e7 28 80 00       	push   $0x8028e7
+  8019db:	6a 6d                	push   $0x6d
+  8019dd:	68 34 29 80 00       	push   $0x802934
+  8019e2:	e8 e8 04 00 00       	call   801ecf <_panic>
+
+008019e7 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8019e7:	55                   	push   %ebp
+  8019e8:	89 e5                	mov    %esp,%ebp
+  8019ea:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8019ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019f0:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  8019f5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019f8:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  8019fd:	8b 45 10             	mov    0x10(%ebp),%eax
+  801a00:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  801a05:	b8 09 00 00 00       	mov    $0x9,%eax
+  801a0a:	e8 a5 fd ff ff       	call   8017b4 <nsipc>
+}
+  801a0f:	c9                   	leave
+  801a10:	c3                   	ret
+
+00801a11 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801a11:	55                   	push   %ebp
+  801a12:	89 e5                	mov    %esp,%ebp
+  801a14:	56                   	push   %esi
+  801a15:	53                   	push   %ebx
+  801a16:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801a19:	83 ec 0c             	sub    $0xc,%esp
+  801a1c:	ff 75 08             	push   0x8(%ebp)
+  801a1f:	e8 aa f3 ff ff       	call   800dce <fd2data>
+  801a24:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801a26:	83 c4 08             	add    $0x8,%esp
+  801a29:	68 4c 29 80 00       	push   $0x80294c
+  801a2e:	53                   	push   %ebx
+  801a2f:	e8 cb ec ff ff       	call   8006ff <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801a34:	8b 46 04             	mov    0x4(%esi),%eax
+  801a37:	2b 06                	sub    (%esi),%eax
+  801a39:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  801a3f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801a46:	00 00 00 
+	stat->st_dev = &devpipe;
+  801a49:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  801a50:	30 80 00 
+	return 0;
+}
+  801a53:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a58:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a5b:	5b                   	pop    %ebx
+  801a5c:	5e                   	pop    %esi
+  801a5d:	5d                   	pop    %ebp
+  801a5e:	c3                   	ret
+
+00801a5f <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801a5f:	55                   	push   %ebp
+  801a60:	89 e5                	mov    %esp,%ebp
+  801a62:	53                   	push   %ebx
+  801a63:	83 ec 0c             	sub    $0xc,%esp
+  801a66:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801a69:	53                   	push   %ebx
+  801a6a:	6a 00                	push   $0x0
+  801a6c:	e8 ff f0 ff ff       	call   800b70 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801a71:	89 1c 24             	mov    %ebx,(%esp)
+  801a74:	e8 55 f3 ff ff       	call   800dce <fd2data>
+  801a79:	83 c4 08             	add    $0x8,%esp
+  801a7c:	50                   	push   %eax
+  801a7d:	6a 00                	push   $0x0
+  801a7f:	e8 ec f0 ff ff       	call   800b70 <sys_page_unmap>
+}
+  801a84:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a87:	c9                   	leave
+  801a88:	c3                   	ret
+
+00801a89 <_pipeisclosed>:
+{
+  801a89:	55                   	push   %ebp
+  801a8a:	89 e5                	mov    %esp,%ebp
+  801a8c:	57                   	push   %edi
+  801a8d:	56                   	push   %esi
+  801a8e:	53                   	push   %ebx
+  801a8f:	83 ec 1c             	sub    $0x1c,%esp
+  801a92:	89 c7                	mov    %eax,%edi
+  801a94:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801a96:	a1 08 40 80 00       	mov    0x804008,%eax
+  801a9b:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801a9e:	83 ec 0c             	sub    $0xc,%esp
+  801aa1:	57                   	push   %edi
+  801aa2:	e8 75 05 00 00       	call   80201c <pageref>
+  801aa7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801aaa:	89 34 24             	mov    %esi,(%esp)
+  801aad:	e8 6a 05 00 00       	call   80201c <pageref>
+		nn = thisenv->env_runs;
+  801ab2:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801ab8:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801abb:	83 c4 10             	add    $0x10,%esp
+  801abe:	39 cb                	cmp    %ecx,%ebx
+  801ac0:	74 1b                	je     801add <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801ac2:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801ac5:	75 cf                	jne    801a96 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801ac7:	8b 42 58             	mov    0x58(%edx),%eax
+  801aca:	6a 01                	push   $0x1
+  801acc:	50                   	push   %eax
+  801acd:	53                   	push   %ebx
+  801ace:	68 53 29 80 00       	push   $0x802953
+  801ad3:	e8 6e e6 ff ff       	call   800146 <cprintf>
+  801ad8:	83 c4 10             	add    $0x10,%esp
+  801adb:	eb b9                	jmp    801a96 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801add:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801ae0:	0f 94 c0             	sete   %al
+  801ae3:	0f b6 c0             	movzbl %al,%eax
+}
+  801ae6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ae9:	5b                   	pop    %ebx
+  801aea:	5e                   	pop    %esi
+  801aeb:	5f                   	pop    %edi
+  801aec:	5d                   	pop    %ebp
+  801aed:	c3                   	ret
+
+00801aee <devpipe_write>:
+{
+  801aee:	55                   	push   %ebp
+  801aef:	89 e5                	mov    %esp,%ebp
+  801af1:	57                   	push   %edi
+  801af2:	56                   	push   %esi
+  801af3:	53                   	push   %ebx
+  801af4:	83 ec 28             	sub    $0x28,%esp
+  801af7:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801afa:	56                   	push   %esi
+  801afb:	e8 ce f2 ff ff       	call   800dce <fd2data>
+  801b00:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801b02:	83 c4 10             	add    $0x10,%esp
+  801b05:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b0a:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801b0d:	75 09                	jne    801b18 <devpipe_write+0x2a>
+	return i;
+  801b0f:	89 f8                	mov    %edi,%eax
+  801b11:	eb 23                	jmp    801b36 <devpipe_write+0x48>
+			sys_yield();
+  801b13:	e8 b4 ef ff ff       	call   800acc <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801b18:	8b 43 04             	mov    0x4(%ebx),%eax
+  801b1b:	8b 0b                	mov    (%ebx),%ecx
+  801b1d:	8d 51 20             	lea    0x20(%ecx),%edx
+  801b20:	39 d0                	cmp    %edx,%eax
+  801b22:	72 1a                	jb     801b3e <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  801b24:	89 da                	mov    %ebx,%edx
+  801b26:	89 f0                	mov    %esi,%eax
+  801b28:	e8 5c ff ff ff       	call   801a89 <_pipeisclosed>
+  801b2d:	85 c0                	test   %eax,%eax
+  801b2f:	74 e2                	je     801b13 <devpipe_write+0x25>
+				return 0;
+  801b31:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b36:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b39:	5b                   	pop    %ebx
+  801b3a:	5e                   	pop    %esi
+  801b3b:	5f                   	pop    %edi
+  801b3c:	5d                   	pop    %ebp
+  801b3d:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801b3e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b41:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801b45:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801b48:	89 c2                	mov    %eax,%edx
+  801b4a:	c1 fa 1f             	sar    $0x1f,%edx
+  801b4d:	89 d1                	mov    %edx,%ecx
+  801b4f:	c1 e9 1b             	shr    $0x1b,%ecx
+  801b52:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801b55:	83 e2 1f             	and    $0x1f,%edx
+  801b58:	29 ca                	sub    %ecx,%edx
+  801b5a:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801b5e:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  801b62:	83 c0 01             	add    $0x1,%eax
+  801b65:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  801b68:	83 c7 01             	add    $0x1,%edi
+  801b6b:	eb 9d                	jmp    801b0a <devpipe_write+0x1c>
+
+00801b6d <devpipe_read>:
+{
+  801b6d:	55                   	push   %ebp
+  801b6e:	89 e5                	mov    %esp,%ebp
+  801b70:	57                   	push   %edi
+  801b71:	56                   	push   %esi
+  801b72:	53                   	push   %ebx
+  801b73:	83 ec 18             	sub    $0x18,%esp
+  801b76:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  801b79:	57                   	push   %edi
+  801b7a:	e8 4f f2 ff ff       	call   800dce <fd2data>
+  801b7f:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801b81:	83 c4 10             	add    $0x10,%esp
+  801b84:	be 00 00 00 00       	mov    $0x0,%esi
+  801b89:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801b8c:	75 13                	jne    801ba1 <devpipe_read+0x34>
+	return i;
+  801b8e:	89 f0                	mov    %esi,%eax
+  801b90:	eb 02                	jmp    801b94 <devpipe_read+0x27>
+				return i;
+  801b92:	89 f0                	mov    %esi,%eax
+}
+  801b94:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b97:	5b                   	pop    %ebx
+  801b98:	5e                   	pop    %esi
+  801b99:	5f                   	pop    %edi
+  801b9a:	5d                   	pop    %ebp
+  801b9b:	c3                   	ret
+			sys_yield();
+  801b9c:	e8 2b ef ff ff       	call   800acc <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  801ba1:	8b 03                	mov    (%ebx),%eax
+  801ba3:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801ba6:	75 18                	jne    801bc0 <devpipe_read+0x53>
+			if (i > 0)
+  801ba8:	85 f6                	test   %esi,%esi
+  801baa:	75 e6                	jne    801b92 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  801bac:	89 da                	mov    %ebx,%edx
+  801bae:	89 f8                	mov    %edi,%eax
+  801bb0:	e8 d4 fe ff ff       	call   801a89 <_pipeisclosed>
+  801bb5:	85 c0                	test   %eax,%eax
+  801bb7:	74 e3                	je     801b9c <devpipe_read+0x2f>
+				return 0;
+  801bb9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bbe:	eb d4                	jmp    801b94 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801bc0:	99                   	cltd
+  801bc1:	c1 ea 1b             	shr    $0x1b,%edx
+  801bc4:	01 d0                	add    %edx,%eax
+  801bc6:	83 e0 1f             	and    $0x1f,%eax
+  801bc9:	29 d0                	sub    %edx,%eax
+  801bcb:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801bd0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801bd3:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  801bd6:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  801bd9:	83 c6 01             	add    $0x1,%esi
+  801bdc:	eb ab                	jmp    801b89 <devpipe_read+0x1c>
+
+00801bde <pipe>:
+{
+  801bde:	55                   	push   %ebp
+  801bdf:	89 e5                	mov    %esp,%ebp
+  801be1:	56                   	push   %esi
+  801be2:	53                   	push   %ebx
+  801be3:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801be6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801be9:	50                   	push   %eax
+  801bea:	e8 f6 f1 ff ff       	call   800de5 <fd_alloc>
+  801bef:	89 c3                	mov    %eax,%ebx
+  801bf1:	83 c4 10             	add    $0x10,%esp
+  801bf4:	85 c0                	test   %eax,%eax
+  801bf6:	0f 88 23 01 00 00    	js     801d1f <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801bfc:	83 ec 04             	sub    $0x4,%esp
+  801bff:	68 07 04 00 00       	push   $0x407
+  801c04:	ff 75 f4             	push   -0xc(%ebp)
+  801c07:	6a 00                	push   $0x0
+  801c09:	e8 dd ee ff ff       	call   800aeb <sys_page_alloc>
+  801c0e:	89 c3                	mov    %eax,%ebx
+  801c10:	83 c4 10             	add    $0x10,%esp
+  801c13:	85 c0                	test   %eax,%eax
+  801c15:	0f 88 04 01 00 00    	js     801d1f <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801c1b:	83 ec 0c             	sub    $0xc,%esp
+  801c1e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c21:	50                   	push   %eax
+  801c22:	e8 be f1 ff ff       	call   800de5 <fd_alloc>
+  801c27:	89 c3                	mov    %eax,%ebx
+  801c29:	83 c4 10             	add    $0x10,%esp
+  801c2c:	85 c0                	test   %eax,%eax
+  801c2e:	0f 88 db 00 00 00    	js     801d0f <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801c34:	83 ec 04             	sub    $0x4,%esp
+  801c37:	68 07 04 00 00       	push   $0x407
+  801c3c:	ff 75 f0             	push   -0x10(%ebp)
+  801c3f:	6a 00                	push   $0x0
+  801c41:	e8 a5 ee ff ff       	call   800aeb <sys_page_alloc>
+  801c46:	89 c3                	mov    %eax,%ebx
+  801c48:	83 c4 10             	add    $0x10,%esp
+  801c4b:	85 c0                	test   %eax,%eax
+  801c4d:	0f 88 bc 00 00 00    	js     801d0f <pipe+0x131>
+	va = fd2data(fd0);
+  801c53:	83 ec 0c             	sub    $0xc,%esp
+  801c56:	ff 75 f4             	push   -0xc(%ebp)
+  801c59:	e8 70 f1 ff ff       	call   800dce <fd2data>
+  801c5e:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801c60:	83 c4 0c             	add    $0xc,%esp
+  801c63:	68 07 04 00 00       	push   $0x407
+  801c68:	50                   	push   %eax
+  801c69:	6a 00                	push   $0x0
+  801c6b:	e8 7b ee ff ff       	call   800aeb <sys_page_alloc>
+  801c70:	89 c3                	mov    %eax,%ebx
+  801c72:	83 c4 10             	add    $0x10,%esp
+  801c75:	85 c0                	test   %eax,%eax
+  801c77:	0f 88 82 00 00 00    	js     801cff <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801c7d:	83 ec 0c             	sub    $0xc,%esp
+  801c80:	ff 75 f0             	push   -0x10(%ebp)
+  801c83:	e8 46 f1 ff ff       	call   800dce <fd2data>
+  801c88:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801c8f:	50                   	push   %eax
+  801c90:	6a 00                	push   $0x0
+  801c92:	56                   	push   %esi
+  801c93:	6a 00                	push   $0x0
+  801c95:	e8 94 ee ff ff       	call   800b2e <sys_page_map>
+  801c9a:	89 c3                	mov    %eax,%ebx
+  801c9c:	83 c4 20             	add    $0x20,%esp
+  801c9f:	85 c0                	test   %eax,%eax
+  801ca1:	78 4e                	js     801cf1 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  801ca3:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  801ca8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801cab:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  801cad:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801cb0:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  801cb7:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801cba:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  801cbc:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801cbf:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  801cc6:	83 ec 0c             	sub    $0xc,%esp
+  801cc9:	ff 75 f4             	push   -0xc(%ebp)
+  801ccc:	e8 ed f0 ff ff       	call   800dbe <fd2num>
+  801cd1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801cd4:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  801cd6:	83 c4 04             	add    $0x4,%esp
+  801cd9:	ff 75 f0             	push   -0x10(%ebp)
+  801cdc:	e8 dd f0 ff ff       	call   800dbe <fd2num>
+  801ce1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801ce4:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  801ce7:	83 c4 10             	add    $0x10,%esp
+  801cea:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cef:	eb 2e                	jmp    801d1f <pipe+0x141>
+	sys_page_unmap(0, va);
+  801cf1:	83 ec 08             	sub    $0x8,%esp
+  801cf4:	56                   	push   %esi
+  801cf5:	6a 00                	push   $0x0
+  801cf7:	e8 74 ee ff ff       	call   800b70 <sys_page_unmap>
+  801cfc:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  801cff:	83 ec 08             	sub    $0x8,%esp
+  801d02:	ff 75 f0             	push   -0x10(%ebp)
+  801d05:	6a 00                	push   $0x0
+  801d07:	e8 64 ee ff ff       	call   800b70 <sys_page_unmap>
+  801d0c:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  801d0f:	83 ec 08             	sub    $0x8,%esp
+  801d12:	ff 75 f4             	push   -0xc(%ebp)
+  801d15:	6a 00                	push   $0x0
+  801d17:	e8 54 ee ff ff       	call   800b70 <sys_page_unmap>
+  801d1c:	83 c4 10             	add    $0x10,%esp
+}
+  801d1f:	89 d8                	mov    %ebx,%eax
+  801d21:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d24:	5b                   	pop    %ebx
+  801d25:	5e                   	pop    %esi
+  801d26:	5d                   	pop    %ebp
+  801d27:	c3                   	ret
+
+00801d28 <pipeisclosed>:
+{
+  801d28:	55                   	push   %ebp
+  801d29:	89 e5                	mov    %esp,%ebp
+  801d2b:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d2e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d31:	50                   	push   %eax
+  801d32:	ff 75 08             	push   0x8(%ebp)
+  801d35:	e8 01 f1 ff ff       	call   800e3b <fd_lookup>
+  801d3a:	83 c4 10             	add    $0x10,%esp
+  801d3d:	85 c0                	test   %eax,%eax
+  801d3f:	78 18                	js     801d59 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  801d41:	83 ec 0c             	sub    $0xc,%esp
+  801d44:	ff 75 f4             	push   -0xc(%ebp)
+  801d47:	e8 82 f0 ff ff       	call   800dce <fd2data>
+  801d4c:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  801d4e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d51:	e8 33 fd ff ff       	call   801a89 <_pipeisclosed>
+  801d56:	83 c4 10             	add    $0x10,%esp
+}
+  801d59:	c9                   	leave
+  801d5a:	c3                   	ret
+
+00801d5b <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  801d5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d60:	c3                   	ret
+
+00801d61 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  801d61:	55                   	push   %ebp
+  801d62:	89 e5                	mov    %esp,%ebp
+  801d64:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  801d67:	68 6b 29 80 00       	push   $0x80296b
+  801d6c:	ff 75 0c             	push   0xc(%ebp)
+  801d6f:	e8 8b e9 ff ff       	call   8006ff <strcpy>
+	return 0;
+}
+  801d74:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d79:	c9                   	leave
+  801d7a:	c3                   	ret
+
+00801d7b <devcons_write>:
+{
+  801d7b:	55                   	push   %ebp
+  801d7c:	89 e5                	mov    %esp,%ebp
+  801d7e:	57                   	push   %edi
+  801d7f:	56                   	push   %esi
+  801d80:	53                   	push   %ebx
+  801d81:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  801d87:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  801d8c:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  801d92:	eb 2e                	jmp    801dc2 <devcons_write+0x47>
+		m = n - tot;
+  801d94:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801d97:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  801d99:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801d9e:	39 c3                	cmp    %eax,%ebx
+  801da0:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  801da3:	83 ec 04             	sub    $0x4,%esp
+  801da6:	53                   	push   %ebx
+  801da7:	89 f0                	mov    %esi,%eax
+  801da9:	03 45 0c             	add    0xc(%ebp),%eax
+  801dac:	50                   	push   %eax
+  801dad:	57                   	push   %edi
+  801dae:	e8 d2 ea ff ff       	call   800885 <memmove>
+		sys_cputs(buf, m);
+  801db3:	83 c4 08             	add    $0x8,%esp
+  801db6:	53                   	push   %ebx
+  801db7:	57                   	push   %edi
+  801db8:	e8 72 ec ff ff       	call   800a2f <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  801dbd:	01 de                	add    %ebx,%esi
+  801dbf:	83 c4 10             	add    $0x10,%esp
+  801dc2:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801dc5:	72 cd                	jb     801d94 <devcons_write+0x19>
+}
+  801dc7:	89 f0                	mov    %esi,%eax
+  801dc9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801dcc:	5b                   	pop    %ebx
+  801dcd:	5e                   	pop    %esi
+  801dce:	5f                   	pop    %edi
+  801dcf:	5d                   	pop    %ebp
+  801dd0:	c3                   	ret
+
+00801dd1 <devcons_read>:
+{
+  801dd1:	55                   	push   %ebp
+  801dd2:	89 e5                	mov    %esp,%ebp
+  801dd4:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  801dd7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ddc:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801de0:	75 07                	jne    801de9 <devcons_read+0x18>
+  801de2:	eb 1f                	jmp    801e03 <devcons_read+0x32>
+		sys_yield();
+  801de4:	e8 e3 ec ff ff       	call   800acc <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  801de9:	e8 5f ec ff ff       	call   800a4d <sys_cgetc>
+  801dee:	85 c0                	test   %eax,%eax
+  801df0:	74 f2                	je     801de4 <devcons_read+0x13>
+	if (c < 0)
+  801df2:	78 0f                	js     801e03 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  801df4:	83 f8 04             	cmp    $0x4,%eax
+  801df7:	74 0c                	je     801e05 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  801df9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801dfc:	88 02                	mov    %al,(%edx)
+	return 1;
+  801dfe:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  801e03:	c9                   	leave
+  801e04:	c3                   	ret
+		return 0;
+  801e05:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e0a:	eb f7                	jmp    801e03 <devcons_read+0x32>
+
+00801e0c <cputchar>:
+{
+  801e0c:	55                   	push   %ebp
+  801e0d:	89 e5                	mov    %esp,%ebp
+  801e0f:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  801e12:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e15:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  801e18:	6a 01                	push   $0x1
+  801e1a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801e1d:	50                   	push   %eax
+  801e1e:	e8 0c ec ff ff       	call   800a2f <sys_cputs>
+}
+  801e23:	83 c4 10             	add    $0x10,%esp
+  801e26:	c9                   	leave
+  801e27:	c3                   	ret
+
+00801e28 <getchar>:
+{
+  801e28:	55                   	push   %ebp
+  801e29:	89 e5                	mov    %esp,%ebp
+  801e2b:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  801e2e:	6a 01                	push   $0x1
+  801e30:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801e33:	50                   	push   %eax
+  801e34:	6a 00                	push   $0x0
+  801e36:	e8 66 f2 ff ff       	call   8010a1 <read>
+	if (r < 0)
+  801e3b:	83 c4 10             	add    $0x10,%esp
+  801e3e:	85 c0                	test   %eax,%eax
+  801e40:	78 06                	js     801e48 <getchar+0x20>
+	if (r < 1)
+  801e42:	74 06                	je     801e4a <getchar+0x22>
+	return c;
+  801e44:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  801e48:	c9                   	leave
+  801e49:	c3                   	ret
+		return -E_EOF;
+  801e4a:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  801e4f:	eb f7                	jmp    801e48 <getchar+0x20>
+
+00801e51 <iscons>:
+{
+  801e51:	55                   	push   %ebp
+  801e52:	89 e5                	mov    %esp,%ebp
+  801e54:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801e57:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e5a:	50                   	push   %eax
+  801e5b:	ff 75 08             	push   0x8(%ebp)
+  801e5e:	e8 d8 ef ff ff       	call   800e3b <fd_lookup>
+  801e63:	83 c4 10             	add    $0x10,%esp
+  801e66:	85 c0                	test   %eax,%eax
+  801e68:	78 11                	js     801e7b <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  801e6a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e6d:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  801e73:	39 10                	cmp    %edx,(%eax)
+  801e75:	0f 94 c0             	sete   %al
+  801e78:	0f b6 c0             	movzbl %al,%eax
+}
+  801e7b:	c9                   	leave
+  801e7c:	c3                   	ret
+
+00801e7d <opencons>:
+{
+  801e7d:	55                   	push   %ebp
+  801e7e:	89 e5                	mov    %esp,%ebp
+  801e80:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  801e83:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e86:	50                   	push   %eax
+  801e87:	e8 59 ef ff ff       	call   800de5 <fd_alloc>
+  801e8c:	83 c4 10             	add    $0x10,%esp
+  801e8f:	85 c0                	test   %eax,%eax
+  801e91:	78 3a                	js     801ecd <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  801e93:	83 ec 04             	sub    $0x4,%esp
+  801e96:	68 07 04 00 00       	push   $0x407
+  801e9b:	ff 75 f4             	push   -0xc(%ebp)
+  801e9e:	6a 00                	push   $0x0
+  801ea0:	e8 46 ec ff ff       	call   800aeb <sys_page_alloc>
+  801ea5:	83 c4 10             	add    $0x10,%esp
+  801ea8:	85 c0                	test   %eax,%eax
+  801eaa:	78 21                	js     801ecd <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  801eac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801eaf:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  801eb5:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  801eb7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801eba:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  801ec1:	83 ec 0c             	sub    $0xc,%esp
+  801ec4:	50                   	push   %eax
+  801ec5:	e8 f4 ee ff ff       	call   800dbe <fd2num>
+  801eca:	83 c4 10             	add    $0x10,%esp
+}
+  801ecd:	c9                   	leave
+  801ece:	c3                   	ret
+
+00801ecf <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  801ecf:	55                   	push   %ebp
+  801ed0:	89 e5                	mov    %esp,%ebp
+  801ed2:	56                   	push   %esi
+  801ed3:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  801ed4:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  801ed7:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  801edd:	e8 cb eb ff ff       	call   800aad <sys_getenvid>
+  801ee2:	83 ec 0c             	sub    $0xc,%esp
+  801ee5:	ff 75 0c             	push   0xc(%ebp)
+  801ee8:	ff 75 08             	push   0x8(%ebp)
+  801eeb:	56                   	push   %esi
+  801eec:	50                   	push   %eax
+  801eed:	68 78 29 80 00       	push   $0x802978
+  801ef2:	e8 4f e2 ff ff       	call   800146 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  801ef7:	83 c4 18             	add    $0x18,%esp
+  801efa:	53                   	push   %ebx
+  801efb:	ff 75 10             	push   0x10(%ebp)
+  801efe:	e8 f2 e1 ff ff       	call   8000f5 <vcprintf>
+	cprintf("\n");
+  801f03:	c7 04 24 1c 25 80 00 	movl   $0x80251c,(%esp)
+  801f0a:	e8 37 e2 ff ff       	call   800146 <cprintf>
+  801f0f:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  801f12:	cc                   	int3
+	while (1)
+  801f13:	eb fd                	jmp    801f12 <_panic+0x43>
+
+00801f15 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  801f15:	55                   	push   %ebp
+  801f16:	89 e5                	mov    %esp,%ebp
+  801f18:	56                   	push   %esi
+  801f19:	53                   	push   %ebx
+  801f1a:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f1d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f20:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  801f23:	85 c0                	test   %eax,%eax
+  801f25:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801f2a:	0f 44 c2             	cmove  %edx,%eax
+  801f2d:	83 ec 0c             	sub    $0xc,%esp
+  801f30:	50                   	push   %eax
+  801f31:	e8 65 ed ff ff       	call   800c9b <sys_ipc_recv>
+
+  if (from_env_store)
+  801f36:	83 c4 10             	add    $0x10,%esp
+  801f39:	85 f6                	test   %esi,%esi
+  801f3b:	74 17                	je     801f54 <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  801f3d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f42:	85 c0                	test   %eax,%eax
+  801f44:	75 0c                	jne    801f52 <ipc_recv+0x3d>
+  801f46:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801f4c:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  801f52:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  801f54:	85 db                	test   %ebx,%ebx
+  801f56:	74 2b                	je     801f83 <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  801f58:	85 c0                	test   %eax,%eax
+  801f5a:	74 0d                	je     801f69 <ipc_recv+0x54>
+  801f5c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  801f62:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f65:	5b                   	pop    %ebx
+  801f66:	5e                   	pop    %esi
+  801f67:	5d                   	pop    %ebp
+  801f68:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  801f69:	a1 08 40 80 00       	mov    0x804008,%eax
+  801f6e:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  801f74:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  801f76:	a1 08 40 80 00       	mov    0x804008,%eax
+  801f7b:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  801f81:	eb df                	jmp    801f62 <ipc_recv+0x4d>
+  801f83:	85 c0                	test   %eax,%eax
+  801f85:	75 db                	jne    801f62 <ipc_recv+0x4d>
+  801f87:	eb ed                	jmp    801f76 <ipc_recv+0x61>
+
+00801f89 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  801f89:	55                   	push   %ebp
+  801f8a:	89 e5                	mov    %esp,%ebp
+  801f8c:	57                   	push   %edi
+  801f8d:	56                   	push   %esi
+  801f8e:	53                   	push   %ebx
+  801f8f:	83 ec 0c             	sub    $0xc,%esp
+  801f92:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801f95:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801f98:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  801f9b:	85 db                	test   %ebx,%ebx
+  801f9d:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801fa2:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  801fa5:	ff 75 14             	push   0x14(%ebp)
+  801fa8:	53                   	push   %ebx
+  801fa9:	56                   	push   %esi
+  801faa:	57                   	push   %edi
+  801fab:	e8 c8 ec ff ff       	call   800c78 <sys_ipc_try_send>
+  801fb0:	83 c4 10             	add    $0x10,%esp
+  801fb3:	85 c0                	test   %eax,%eax
+  801fb5:	74 1e                	je     801fd5 <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  801fb7:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801fba:	75 07                	jne    801fc3 <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  801fbc:	e8 0b eb ff ff       	call   800acc <sys_yield>
+  801fc1:	eb e2                	jmp    801fa5 <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  801fc3:	50                   	push   %eax
+  801fc4:	68 9b 29 80 00       	push   $0x80299b
+  801fc9:	6a 3c                	push   $0x3c
+  801fcb:	68 a8 29 80 00       	push   $0x8029a8
+  801fd0:	e8 fa fe ff ff       	call   801ecf <_panic>
+  }
+
+#endif
+}
+  801fd5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fd8:	5b                   	pop    %ebx
+  801fd9:	5e                   	pop    %esi
+  801fda:	5f                   	pop    %edi
+  801fdb:	5d                   	pop    %ebp
+  801fdc:	c3                   	ret
+
+00801fdd <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  801fdd:	55                   	push   %ebp
+  801fde:	89 e5                	mov    %esp,%ebp
+  801fe0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  801fe3:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  801fe8:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  801feb:	c1 e0 04             	shl    $0x4,%eax
+  801fee:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801ff3:	8b 40 50             	mov    0x50(%eax),%eax
+  801ff6:	39 c8                	cmp    %ecx,%eax
+  801ff8:	74 12                	je     80200c <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  801ffa:	83 c2 01             	add    $0x1,%edx
+  801ffd:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802003:	75 e3                	jne    801fe8 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802005:	b8 00 00 00 00       	mov    $0x0,%eax
+  80200a:	eb 0e                	jmp    80201a <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  80200c:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80200f:	c1 e0 04             	shl    $0x4,%eax
+  802012:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802017:	8b 40 48             	mov    0x48(%eax),%eax
+  80201a:	5d                   	pop    %ebp
+  80201b:	c3                   	ret
+
+0080201c <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80201c:	55                   	push   %ebp
+  80201d:	89 e5                	mov    %esp,%ebp
+  80201f:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802022:	89 c2                	mov    %eax,%edx
+  802024:	c1 ea 16             	shr    $0x16,%edx
+  802027:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80202e:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802033:	f6 c1 01             	test   $0x1,%cl
+  802036:	74 1c                	je     802054 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  802038:	c1 e8 0c             	shr    $0xc,%eax
+  80203b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802042:	a8 01                	test   $0x1,%al
+  802044:	74 0e                	je     802054 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802046:	c1 e8 0c             	shr    $0xc,%eax
+  802049:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802050:	ef 
+  802051:	0f b7 d2             	movzwl %dx,%edx
+}
+  802054:	89 d0                	mov    %edx,%eax
+  802056:	5d                   	pop    %ebp
+  802057:	c3                   	ret
+  802058:	66 90                	xchg   %ax,%ax
+  80205a:	66 90                	xchg   %ax,%ax
+  80205c:	66 90                	xchg   %ax,%ax
+  80205e:	66 90                	xchg   %ax,%ax
+
+00802060 <__udivmoddi4>:
+  802060:	55                   	push   %ebp
+  802061:	57                   	push   %edi
+  802062:	56                   	push   %esi
+  802063:	53                   	push   %ebx
+  802064:	83 ec 24             	sub    $0x24,%esp
+  802067:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80206b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80206f:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  802073:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802077:	8b 54 24 44          	mov    0x44(%esp),%edx
+  80207b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80207f:	8b 44 24 40          	mov    0x40(%esp),%eax
+  802083:	89 d3                	mov    %edx,%ebx
+  802085:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802089:	09 c3                	or     %eax,%ebx
+  80208b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80208f:	0f 84 9c 00 00 00    	je     802131 <__udivmoddi4+0xd1>
+  802095:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80209c:	00 
+  80209d:	31 c0                	xor    %eax,%eax
+  80209f:	31 d2                	xor    %edx,%edx
+  8020a1:	89 fb                	mov    %edi,%ebx
+  8020a3:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8020aa:	00 
+  8020ab:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8020b0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8020b4:	01 c0                	add    %eax,%eax
+  8020b6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8020bd:	00 
+  8020be:	89 c6                	mov    %eax,%esi
+  8020c0:	89 d7                	mov    %edx,%edi
+  8020c2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8020c6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8020ca:	0f ad d0             	shrd   %cl,%edx,%eax
+  8020cd:	d3 ea                	shr    %cl,%edx
+  8020cf:	f6 c1 20             	test   $0x20,%cl
+  8020d2:	0f 45 c2             	cmovne %edx,%eax
+  8020d5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8020d9:	83 e0 01             	and    $0x1,%eax
+  8020dc:	09 fa                	or     %edi,%edx
+  8020de:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8020e2:	89 04 24             	mov    %eax,(%esp)
+  8020e5:	8b 04 24             	mov    (%esp),%eax
+  8020e8:	89 d5                	mov    %edx,%ebp
+  8020ea:	09 f0                	or     %esi,%eax
+  8020ec:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8020f0:	39 f0                	cmp    %esi,%eax
+  8020f2:	19 fd                	sbb    %edi,%ebp
+  8020f4:	72 1d                	jb     802113 <__udivmoddi4+0xb3>
+  8020f6:	29 f0                	sub    %esi,%eax
+  8020f8:	19 fa                	sbb    %edi,%edx
+  8020fa:	89 cf                	mov    %ecx,%edi
+  8020fc:	c1 ef 05             	shr    $0x5,%edi
+  8020ff:	83 e7 01             	and    $0x1,%edi
+  802102:	89 fe                	mov    %edi,%esi
+  802104:	d3 e7                	shl    %cl,%edi
+  802106:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80210a:	83 f6 01             	xor    $0x1,%esi
+  80210d:	d3 e6                	shl    %cl,%esi
+  80210f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802113:	83 e9 01             	sub    $0x1,%ecx
+  802116:	73 98                	jae    8020b0 <__udivmoddi4+0x50>
+  802118:	85 db                	test   %ebx,%ebx
+  80211a:	74 05                	je     802121 <__udivmoddi4+0xc1>
+  80211c:	89 03                	mov    %eax,(%ebx)
+  80211e:	89 53 04             	mov    %edx,0x4(%ebx)
+  802121:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802125:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802129:	83 c4 24             	add    $0x24,%esp
+  80212c:	5b                   	pop    %ebx
+  80212d:	5e                   	pop    %esi
+  80212e:	5f                   	pop    %edi
+  80212f:	5d                   	pop    %ebp
+  802130:	c3                   	ret
+  802131:	85 ff                	test   %edi,%edi
+  802133:	74 0d                	je     802142 <__udivmoddi4+0xe2>
+  802135:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  80213b:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  802142:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802146:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80214a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80214e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802152:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802156:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80215a:	83 c4 24             	add    $0x24,%esp
+  80215d:	5b                   	pop    %ebx
+  80215e:	5e                   	pop    %esi
+  80215f:	5f                   	pop    %edi
+  802160:	5d                   	pop    %ebp
+  802161:	c3                   	ret
+  802162:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802169:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00802170 <__udivdi3>:
+  802170:	57                   	push   %edi
+  802171:	56                   	push   %esi
+  802172:	53                   	push   %ebx
+  802173:	83 ec 20             	sub    $0x20,%esp
+  802176:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80217a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80217e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802182:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802186:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80218a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80218e:	89 d1                	mov    %edx,%ecx
+  802190:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802194:	09 c1                	or     %eax,%ecx
+  802196:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80219a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80219e:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  8021a2:	0f 84 88 00 00 00    	je     802230 <__udivdi3+0xc0>
+  8021a8:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8021af:	00 
+  8021b0:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8021b5:	31 c0                	xor    %eax,%eax
+  8021b7:	31 d2                	xor    %edx,%edx
+  8021b9:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8021c0:	00 
+  8021c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8021c8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8021cc:	01 c0                	add    %eax,%eax
+  8021ce:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8021d5:	00 
+  8021d6:	89 c6                	mov    %eax,%esi
+  8021d8:	89 d7                	mov    %edx,%edi
+  8021da:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8021de:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8021e2:	0f ad d0             	shrd   %cl,%edx,%eax
+  8021e5:	d3 ea                	shr    %cl,%edx
+  8021e7:	f6 c1 20             	test   $0x20,%cl
+  8021ea:	0f 45 c2             	cmovne %edx,%eax
+  8021ed:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8021f1:	83 e0 01             	and    $0x1,%eax
+  8021f4:	09 fa                	or     %edi,%edx
+  8021f6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8021fa:	89 04 24             	mov    %eax,(%esp)
+  8021fd:	8b 04 24             	mov    (%esp),%eax
+  802200:	89 d3                	mov    %edx,%ebx
+  802202:	09 f0                	or     %esi,%eax
+  802204:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802208:	39 f0                	cmp    %esi,%eax
+  80220a:	19 fb                	sbb    %edi,%ebx
+  80220c:	72 1d                	jb     80222b <__udivdi3+0xbb>
+  80220e:	29 f0                	sub    %esi,%eax
+  802210:	19 fa                	sbb    %edi,%edx
+  802212:	89 cf                	mov    %ecx,%edi
+  802214:	c1 ef 05             	shr    $0x5,%edi
+  802217:	83 e7 01             	and    $0x1,%edi
+  80221a:	89 fe                	mov    %edi,%esi
+  80221c:	d3 e7                	shl    %cl,%edi
+  80221e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802222:	83 f6 01             	xor    $0x1,%esi
+  802225:	d3 e6                	shl    %cl,%esi
+  802227:	09 74 24 18          	or     %esi,0x18(%esp)
+  80222b:	83 e9 01             	sub    $0x1,%ecx
+  80222e:	73 98                	jae    8021c8 <__udivdi3+0x58>
+  802230:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802234:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802238:	83 c4 20             	add    $0x20,%esp
+  80223b:	5b                   	pop    %ebx
+  80223c:	5e                   	pop    %esi
+  80223d:	5f                   	pop    %edi
+  80223e:	c3                   	ret
+  80223f:	90                   	nop
+
+00802240 <__umoddi3>:
+  802240:	57                   	push   %edi
+  802241:	56                   	push   %esi
+  802242:	53                   	push   %ebx
+  802243:	83 ec 18             	sub    $0x18,%esp
+  802246:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80224a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80224e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802252:	8b 54 24 34          	mov    0x34(%esp),%edx
+  802256:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80225a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80225e:	89 d1                	mov    %edx,%ecx
+  802260:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802264:	09 c1                	or     %eax,%ecx
+  802266:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80226a:	74 5b                	je     8022c7 <__umoddi3+0x87>
+  80226c:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802271:	31 c0                	xor    %eax,%eax
+  802273:	31 d2                	xor    %edx,%edx
+  802275:	8d 76 00             	lea    0x0(%esi),%esi
+  802278:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80227c:	01 c0                	add    %eax,%eax
+  80227e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802285:	00 
+  802286:	89 c6                	mov    %eax,%esi
+  802288:	89 d7                	mov    %edx,%edi
+  80228a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80228e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802292:	0f ad d0             	shrd   %cl,%edx,%eax
+  802295:	d3 ea                	shr    %cl,%edx
+  802297:	f6 c1 20             	test   $0x20,%cl
+  80229a:	0f 45 c2             	cmovne %edx,%eax
+  80229d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8022a1:	83 e0 01             	and    $0x1,%eax
+  8022a4:	09 fa                	or     %edi,%edx
+  8022a6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8022aa:	89 04 24             	mov    %eax,(%esp)
+  8022ad:	8b 04 24             	mov    (%esp),%eax
+  8022b0:	89 d3                	mov    %edx,%ebx
+  8022b2:	09 f0                	or     %esi,%eax
+  8022b4:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8022b8:	39 f0                	cmp    %esi,%eax
+  8022ba:	19 fb                	sbb    %edi,%ebx
+  8022bc:	72 04                	jb     8022c2 <__umoddi3+0x82>
+  8022be:	29 f0                	sub    %esi,%eax
+  8022c0:	19 fa                	sbb    %edi,%edx
+  8022c2:	83 e9 01             	sub    $0x1,%ecx
+  8022c5:	73 b1                	jae    802278 <__umoddi3+0x38>
+  8022c7:	83 c4 18             	add    $0x18,%esp
+  8022ca:	5b                   	pop    %ebx
+  8022cb:	5e                   	pop    %esi
+  8022cc:	5f                   	pop    %edi
+  8022cd:	c3                   	ret
+  8022ce:	66 90                	xchg   %ax,%ax
+
+008022d0 <__divdi3>:
+  8022d0:	55                   	push   %ebp
+  8022d1:	57                   	push   %edi
+  8022d2:	56                   	push   %esi
+  8022d3:	53                   	push   %ebx
+  8022d4:	83 ec 24             	sub    $0x24,%esp
+  8022d7:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  8022db:	8b 74 24 44          	mov    0x44(%esp),%esi
+  8022df:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8022e3:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8022e7:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  8022eb:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8022ef:	85 d2                	test   %edx,%edx
+  8022f1:	0f 88 e0 00 00 00    	js     8023d7 <__divdi3+0x107>
+  8022f7:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  8022fb:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  8022ff:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802303:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802307:	85 f6                	test   %esi,%esi
+  802309:	78 16                	js     802321 <__divdi3+0x51>
+  80230b:	89 f1                	mov    %esi,%ecx
+  80230d:	31 c0                	xor    %eax,%eax
+  80230f:	31 d2                	xor    %edx,%edx
+  802311:	09 d9                	or     %ebx,%ecx
+  802313:	0f 85 f3 00 00 00    	jne    80240c <__divdi3+0x13c>
+  802319:	83 c4 24             	add    $0x24,%esp
+  80231c:	5b                   	pop    %ebx
+  80231d:	5e                   	pop    %esi
+  80231e:	5f                   	pop    %edi
+  80231f:	5d                   	pop    %ebp
+  802320:	c3                   	ret
+  802321:	bf 01 00 00 00       	mov    $0x1,%edi
+  802326:	f7 5c 24 08          	negl   0x8(%esp)
+  80232a:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  80232f:	f7 5c 24 0c          	negl   0xc(%esp)
+  802333:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80233a:	00 
+  80233b:	31 c0                	xor    %eax,%eax
+  80233d:	31 d2                	xor    %edx,%edx
+  80233f:	89 fb                	mov    %edi,%ebx
+  802341:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802348:	00 
+  802349:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80234e:	66 90                	xchg   %ax,%ax
+  802350:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802354:	01 c0                	add    %eax,%eax
+  802356:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80235d:	00 
+  80235e:	89 c6                	mov    %eax,%esi
+  802360:	89 d7                	mov    %edx,%edi
+  802362:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802366:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80236a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80236d:	d3 ea                	shr    %cl,%edx
+  80236f:	f6 c1 20             	test   $0x20,%cl
+  802372:	0f 45 c2             	cmovne %edx,%eax
+  802375:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802379:	83 e0 01             	and    $0x1,%eax
+  80237c:	09 fa                	or     %edi,%edx
+  80237e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802382:	89 04 24             	mov    %eax,(%esp)
+  802385:	8b 04 24             	mov    (%esp),%eax
+  802388:	89 d5                	mov    %edx,%ebp
+  80238a:	09 f0                	or     %esi,%eax
+  80238c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802390:	39 f0                	cmp    %esi,%eax
+  802392:	19 fd                	sbb    %edi,%ebp
+  802394:	72 1d                	jb     8023b3 <__divdi3+0xe3>
+  802396:	29 f0                	sub    %esi,%eax
+  802398:	19 fa                	sbb    %edi,%edx
+  80239a:	89 cf                	mov    %ecx,%edi
+  80239c:	c1 ef 05             	shr    $0x5,%edi
+  80239f:	83 e7 01             	and    $0x1,%edi
+  8023a2:	89 fe                	mov    %edi,%esi
+  8023a4:	d3 e7                	shl    %cl,%edi
+  8023a6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8023aa:	83 f6 01             	xor    $0x1,%esi
+  8023ad:	d3 e6                	shl    %cl,%esi
+  8023af:	09 74 24 18          	or     %esi,0x18(%esp)
+  8023b3:	83 e9 01             	sub    $0x1,%ecx
+  8023b6:	73 98                	jae    802350 <__divdi3+0x80>
+  8023b8:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8023bc:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8023c0:	85 db                	test   %ebx,%ebx
+  8023c2:	0f 84 51 ff ff ff    	je     802319 <__divdi3+0x49>
+  8023c8:	f7 d8                	neg    %eax
+  8023ca:	83 d2 00             	adc    $0x0,%edx
+  8023cd:	83 c4 24             	add    $0x24,%esp
+  8023d0:	5b                   	pop    %ebx
+  8023d1:	f7 da                	neg    %edx
+  8023d3:	5e                   	pop    %esi
+  8023d4:	5f                   	pop    %edi
+  8023d5:	5d                   	pop    %ebp
+  8023d6:	c3                   	ret
+  8023d7:	f7 d8                	neg    %eax
+  8023d9:	83 d2 00             	adc    $0x0,%edx
+  8023dc:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8023e0:	f7 da                	neg    %edx
+  8023e2:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8023e6:	85 f6                	test   %esi,%esi
+  8023e8:	78 1b                	js     802405 <__divdi3+0x135>
+  8023ea:	89 f1                	mov    %esi,%ecx
+  8023ec:	31 c0                	xor    %eax,%eax
+  8023ee:	31 d2                	xor    %edx,%edx
+  8023f0:	bf 01 00 00 00       	mov    $0x1,%edi
+  8023f5:	09 d9                	or     %ebx,%ecx
+  8023f7:	0f 85 36 ff ff ff    	jne    802333 <__divdi3+0x63>
+  8023fd:	83 c4 24             	add    $0x24,%esp
+  802400:	5b                   	pop    %ebx
+  802401:	5e                   	pop    %esi
+  802402:	5f                   	pop    %edi
+  802403:	5d                   	pop    %ebp
+  802404:	c3                   	ret
+  802405:	31 ff                	xor    %edi,%edi
+  802407:	e9 1a ff ff ff       	jmp    802326 <__divdi3+0x56>
+  80240c:	31 ff                	xor    %edi,%edi
+  80240e:	e9 20 ff ff ff       	jmp    802333 <__divdi3+0x63>
+  802413:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80241a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00802420 <__moddi3>:
+  802420:	55                   	push   %ebp
+  802421:	57                   	push   %edi
+  802422:	56                   	push   %esi
+  802423:	53                   	push   %ebx
+  802424:	83 ec 1c             	sub    $0x1c,%esp
+  802427:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  80242b:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  80242f:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  802433:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  802437:	89 c8                	mov    %ecx,%eax
+  802439:	89 f2                	mov    %esi,%edx
+  80243b:	89 f3                	mov    %esi,%ebx
+  80243d:	85 ed                	test   %ebp,%ebp
+  80243f:	0f 88 9d 00 00 00    	js     8024e2 <__moddi3+0xc2>
+  802445:	09 cb                	or     %ecx,%ebx
+  802447:	0f 84 8d 00 00 00    	je     8024da <__moddi3+0xba>
+  80244d:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802451:	31 db                	xor    %ebx,%ebx
+  802453:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802457:	89 ca                	mov    %ecx,%edx
+  802459:	89 f0                	mov    %esi,%eax
+  80245b:	89 dd                	mov    %ebx,%ebp
+  80245d:	f7 da                	neg    %edx
+  80245f:	83 d0 00             	adc    $0x0,%eax
+  802462:	f7 d8                	neg    %eax
+  802464:	0f 49 f0             	cmovns %eax,%esi
+  802467:	0f 49 ca             	cmovns %edx,%ecx
+  80246a:	31 c0                	xor    %eax,%eax
+  80246c:	31 d2                	xor    %edx,%edx
+  80246e:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802472:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802476:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80247b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80247f:	90                   	nop
+  802480:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802484:	01 c0                	add    %eax,%eax
+  802486:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80248d:	00 
+  80248e:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  802492:	89 c6                	mov    %eax,%esi
+  802494:	89 d7                	mov    %edx,%edi
+  802496:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80249a:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80249e:	0f ad d0             	shrd   %cl,%edx,%eax
+  8024a1:	d3 ea                	shr    %cl,%edx
+  8024a3:	f6 c1 20             	test   $0x20,%cl
+  8024a6:	0f 45 c2             	cmovne %edx,%eax
+  8024a9:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8024ad:	83 e0 01             	and    $0x1,%eax
+  8024b0:	09 fa                	or     %edi,%edx
+  8024b2:	89 04 24             	mov    %eax,(%esp)
+  8024b5:	8b 04 24             	mov    (%esp),%eax
+  8024b8:	89 d7                	mov    %edx,%edi
+  8024ba:	09 f0                	or     %esi,%eax
+  8024bc:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  8024c0:	39 d8                	cmp    %ebx,%eax
+  8024c2:	19 f7                	sbb    %esi,%edi
+  8024c4:	72 04                	jb     8024ca <__moddi3+0xaa>
+  8024c6:	29 d8                	sub    %ebx,%eax
+  8024c8:	19 f2                	sbb    %esi,%edx
+  8024ca:	83 e9 01             	sub    $0x1,%ecx
+  8024cd:	73 b1                	jae    802480 <__moddi3+0x60>
+  8024cf:	85 ed                	test   %ebp,%ebp
+  8024d1:	74 07                	je     8024da <__moddi3+0xba>
+  8024d3:	f7 d8                	neg    %eax
+  8024d5:	83 d2 00             	adc    $0x0,%edx
+  8024d8:	f7 da                	neg    %edx
+  8024da:	83 c4 1c             	add    $0x1c,%esp
+  8024dd:	5b                   	pop    %ebx
+  8024de:	5e                   	pop    %esi
+  8024df:	5f                   	pop    %edi
+  8024e0:	5d                   	pop    %ebp
+  8024e1:	c3                   	ret
+  8024e2:	09 cb                	or     %ecx,%ebx
+  8024e4:	74 f4                	je     8024da <__moddi3+0xba>
+  8024e6:	f7 df                	neg    %edi
+  8024e8:	bb 01 00 00 00       	mov    $0x1,%ebx
+  8024ed:	83 d5 00             	adc    $0x0,%ebp
+  8024f0:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  8024f4:	f7 dd                	neg    %ebp
+  8024f6:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  8024fa:	e9 58 ff ff ff       	jmp    802457 <__moddi3+0x37>
@@ -0,0 +1,5815 @@
+
+obj/user/faultregs.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 b0 05 00 00       	call   8005e1 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <check_regs>:
+static struct regs before, during, after;
+
+static void
+check_regs(struct regs* a, const char *an, struct regs* b, const char *bn,
+	   const char *testname)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 0c             	sub    $0xc,%esp
+  80003c:	89 c6                	mov    %eax,%esi
+  80003e:	89 cb                	mov    %ecx,%ebx
+	int mismatch = 0;
+
+	cprintf("%-6s %-8s %-8s\n", "", an, bn);
+  800040:	ff 75 08             	push   0x8(%ebp)
+  800043:	52                   	push   %edx
+  800044:	68 51 2b 80 00       	push   $0x802b51
+  800049:	68 20 2b 80 00       	push   $0x802b20
+  80004e:	e8 cc 06 00 00       	call   80071f <cprintf>
+			cprintf("MISMATCH\n");				\
+			mismatch = 1;					\
+		}							\
+	} while (0)
+
+	CHECK(edi, regs.reg_edi);
+  800053:	ff 33                	push   (%ebx)
+  800055:	ff 36                	push   (%esi)
+  800057:	68 30 2b 80 00       	push   $0x802b30
+  80005c:	68 34 2b 80 00       	push   $0x802b34
+  800061:	e8 b9 06 00 00       	call   80071f <cprintf>
+  800066:	83 c4 20             	add    $0x20,%esp
+  800069:	8b 03                	mov    (%ebx),%eax
+  80006b:	39 06                	cmp    %eax,(%esi)
+  80006d:	0f 84 2e 02 00 00    	je     8002a1 <check_regs+0x26e>
+  800073:	83 ec 0c             	sub    $0xc,%esp
+  800076:	68 48 2b 80 00       	push   $0x802b48
+  80007b:	e8 9f 06 00 00       	call   80071f <cprintf>
+  800080:	83 c4 10             	add    $0x10,%esp
+  800083:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(esi, regs.reg_esi);
+  800088:	ff 73 04             	push   0x4(%ebx)
+  80008b:	ff 76 04             	push   0x4(%esi)
+  80008e:	68 52 2b 80 00       	push   $0x802b52
+  800093:	68 34 2b 80 00       	push   $0x802b34
+  800098:	e8 82 06 00 00       	call   80071f <cprintf>
+  80009d:	83 c4 10             	add    $0x10,%esp
+  8000a0:	8b 43 04             	mov    0x4(%ebx),%eax
+  8000a3:	39 46 04             	cmp    %eax,0x4(%esi)
+  8000a6:	0f 84 0f 02 00 00    	je     8002bb <check_regs+0x288>
+  8000ac:	83 ec 0c             	sub    $0xc,%esp
+  8000af:	68 48 2b 80 00       	push   $0x802b48
+  8000b4:	e8 66 06 00 00       	call   80071f <cprintf>
+  8000b9:	83 c4 10             	add    $0x10,%esp
+  8000bc:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(ebp, regs.reg_ebp);
+  8000c1:	ff 73 08             	push   0x8(%ebx)
+  8000c4:	ff 76 08             	push   0x8(%esi)
+  8000c7:	68 56 2b 80 00       	push   $0x802b56
+  8000cc:	68 34 2b 80 00       	push   $0x802b34
+  8000d1:	e8 49 06 00 00       	call   80071f <cprintf>
+  8000d6:	83 c4 10             	add    $0x10,%esp
+  8000d9:	8b 43 08             	mov    0x8(%ebx),%eax
+  8000dc:	39 46 08             	cmp    %eax,0x8(%esi)
+  8000df:	0f 84 eb 01 00 00    	je     8002d0 <check_regs+0x29d>
+  8000e5:	83 ec 0c             	sub    $0xc,%esp
+  8000e8:	68 48 2b 80 00       	push   $0x802b48
+  8000ed:	e8 2d 06 00 00       	call   80071f <cprintf>
+  8000f2:	83 c4 10             	add    $0x10,%esp
+  8000f5:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(ebx, regs.reg_ebx);
+  8000fa:	ff 73 10             	push   0x10(%ebx)
+  8000fd:	ff 76 10             	push   0x10(%esi)
+  800100:	68 5a 2b 80 00       	push   $0x802b5a
+  800105:	68 34 2b 80 00       	push   $0x802b34
+  80010a:	e8 10 06 00 00       	call   80071f <cprintf>
+  80010f:	83 c4 10             	add    $0x10,%esp
+  800112:	8b 43 10             	mov    0x10(%ebx),%eax
+  800115:	39 46 10             	cmp    %eax,0x10(%esi)
+  800118:	0f 84 c7 01 00 00    	je     8002e5 <check_regs+0x2b2>
+  80011e:	83 ec 0c             	sub    $0xc,%esp
+  800121:	68 48 2b 80 00       	push   $0x802b48
+  800126:	e8 f4 05 00 00       	call   80071f <cprintf>
+  80012b:	83 c4 10             	add    $0x10,%esp
+  80012e:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(edx, regs.reg_edx);
+  800133:	ff 73 14             	push   0x14(%ebx)
+  800136:	ff 76 14             	push   0x14(%esi)
+  800139:	68 5e 2b 80 00       	push   $0x802b5e
+  80013e:	68 34 2b 80 00       	push   $0x802b34
+  800143:	e8 d7 05 00 00       	call   80071f <cprintf>
+  800148:	83 c4 10             	add    $0x10,%esp
+  80014b:	8b 43 14             	mov    0x14(%ebx),%eax
+  80014e:	39 46 14             	cmp    %eax,0x14(%esi)
+  800151:	0f 84 a3 01 00 00    	je     8002fa <check_regs+0x2c7>
+  800157:	83 ec 0c             	sub    $0xc,%esp
+  80015a:	68 48 2b 80 00       	push   $0x802b48
+  80015f:	e8 bb 05 00 00       	call   80071f <cprintf>
+  800164:	83 c4 10             	add    $0x10,%esp
+  800167:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(ecx, regs.reg_ecx);
+  80016c:	ff 73 18             	push   0x18(%ebx)
+  80016f:	ff 76 18             	push   0x18(%esi)
+  800172:	68 62 2b 80 00       	push   $0x802b62
+  800177:	68 34 2b 80 00       	push   $0x802b34
+  80017c:	e8 9e 05 00 00       	call   80071f <cprintf>
+  800181:	83 c4 10             	add    $0x10,%esp
+  800184:	8b 43 18             	mov    0x18(%ebx),%eax
+  800187:	39 46 18             	cmp    %eax,0x18(%esi)
+  80018a:	0f 84 7f 01 00 00    	je     80030f <check_regs+0x2dc>
+  800190:	83 ec 0c             	sub    $0xc,%esp
+  800193:	68 48 2b 80 00       	push   $0x802b48
+  800198:	e8 82 05 00 00       	call   80071f <cprintf>
+  80019d:	83 c4 10             	add    $0x10,%esp
+  8001a0:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(eax, regs.reg_eax);
+  8001a5:	ff 73 1c             	push   0x1c(%ebx)
+  8001a8:	ff 76 1c             	push   0x1c(%esi)
+  8001ab:	68 66 2b 80 00       	push   $0x802b66
+  8001b0:	68 34 2b 80 00       	push   $0x802b34
+  8001b5:	e8 65 05 00 00       	call   80071f <cprintf>
+  8001ba:	83 c4 10             	add    $0x10,%esp
+  8001bd:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8001c0:	39 46 1c             	cmp    %eax,0x1c(%esi)
+  8001c3:	0f 84 5b 01 00 00    	je     800324 <check_regs+0x2f1>
+  8001c9:	83 ec 0c             	sub    $0xc,%esp
+  8001cc:	68 48 2b 80 00       	push   $0x802b48
+  8001d1:	e8 49 05 00 00       	call   80071f <cprintf>
+  8001d6:	83 c4 10             	add    $0x10,%esp
+  8001d9:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(eip, eip);
+  8001de:	ff 73 20             	push   0x20(%ebx)
+  8001e1:	ff 76 20             	push   0x20(%esi)
+  8001e4:	68 6a 2b 80 00       	push   $0x802b6a
+  8001e9:	68 34 2b 80 00       	push   $0x802b34
+  8001ee:	e8 2c 05 00 00       	call   80071f <cprintf>
+  8001f3:	83 c4 10             	add    $0x10,%esp
+  8001f6:	8b 43 20             	mov    0x20(%ebx),%eax
+  8001f9:	39 46 20             	cmp    %eax,0x20(%esi)
+  8001fc:	0f 84 37 01 00 00    	je     800339 <check_regs+0x306>
+  800202:	83 ec 0c             	sub    $0xc,%esp
+  800205:	68 48 2b 80 00       	push   $0x802b48
+  80020a:	e8 10 05 00 00       	call   80071f <cprintf>
+  80020f:	83 c4 10             	add    $0x10,%esp
+  800212:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(eflags, eflags);
+  800217:	ff 73 24             	push   0x24(%ebx)
+  80021a:	ff 76 24             	push   0x24(%esi)
+  80021d:	68 6e 2b 80 00       	push   $0x802b6e
+  800222:	68 34 2b 80 00       	push   $0x802b34
+  800227:	e8 f3 04 00 00       	call   80071f <cprintf>
+  80022c:	83 c4 10             	add    $0x10,%esp
+  80022f:	8b 43 24             	mov    0x24(%ebx),%eax
+  800232:	39 46 24             	cmp    %eax,0x24(%esi)
+  800235:	0f 84 13 01 00 00    	je     80034e <check_regs+0x31b>
+  80023b:	83 ec 0c             	sub    $0xc,%esp
+  80023e:	68 48 2b 80 00       	push   $0x802b48
+  800243:	e8 d7 04 00 00       	call   80071f <cprintf>
+	CHECK(esp, esp);
+  800248:	ff 73 28             	push   0x28(%ebx)
+  80024b:	ff 76 28             	push   0x28(%esi)
+  80024e:	68 75 2b 80 00       	push   $0x802b75
+  800253:	68 34 2b 80 00       	push   $0x802b34
+  800258:	e8 c2 04 00 00       	call   80071f <cprintf>
+  80025d:	83 c4 20             	add    $0x20,%esp
+  800260:	8b 43 28             	mov    0x28(%ebx),%eax
+  800263:	39 46 28             	cmp    %eax,0x28(%esi)
+  800266:	0f 84 53 01 00 00    	je     8003bf <check_regs+0x38c>
+  80026c:	83 ec 0c             	sub    $0xc,%esp
+  80026f:	68 48 2b 80 00       	push   $0x802b48
+  800274:	e8 a6 04 00 00       	call   80071f <cprintf>
+
+#undef CHECK
+
+	cprintf("Registers %s ", testname);
+  800279:	83 c4 08             	add    $0x8,%esp
+  80027c:	ff 75 0c             	push   0xc(%ebp)
+  80027f:	68 79 2b 80 00       	push   $0x802b79
+  800284:	e8 96 04 00 00       	call   80071f <cprintf>
+  800289:	83 c4 10             	add    $0x10,%esp
+	if (!mismatch)
+		cprintf("OK\n");
+	else
+		cprintf("MISMATCH\n");
+  80028c:	83 ec 0c             	sub    $0xc,%esp
+  80028f:	68 48 2b 80 00       	push   $0x802b48
+  800294:	e8 86 04 00 00       	call   80071f <cprintf>
+  800299:	83 c4 10             	add    $0x10,%esp
+}
+  80029c:	e9 16 01 00 00       	jmp    8003b7 <check_regs+0x384>
+	CHECK(edi, regs.reg_edi);
+  8002a1:	83 ec 0c             	sub    $0xc,%esp
+  8002a4:	68 44 2b 80 00       	push   $0x802b44
+  8002a9:	e8 71 04 00 00       	call   80071f <cprintf>
+  8002ae:	83 c4 10             	add    $0x10,%esp
+	int mismatch = 0;
+  8002b1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002b6:	e9 cd fd ff ff       	jmp    800088 <check_regs+0x55>
+	CHECK(esi, regs.reg_esi);
+  8002bb:	83 ec 0c             	sub    $0xc,%esp
+  8002be:	68 44 2b 80 00       	push   $0x802b44
+  8002c3:	e8 57 04 00 00       	call   80071f <cprintf>
+  8002c8:	83 c4 10             	add    $0x10,%esp
+  8002cb:	e9 f1 fd ff ff       	jmp    8000c1 <check_regs+0x8e>
+	CHECK(ebp, regs.reg_ebp);
+  8002d0:	83 ec 0c             	sub    $0xc,%esp
+  8002d3:	68 44 2b 80 00       	push   $0x802b44
+  8002d8:	e8 42 04 00 00       	call   80071f <cprintf>
+  8002dd:	83 c4 10             	add    $0x10,%esp
+  8002e0:	e9 15 fe ff ff       	jmp    8000fa <check_regs+0xc7>
+	CHECK(ebx, regs.reg_ebx);
+  8002e5:	83 ec 0c             	sub    $0xc,%esp
+  8002e8:	68 44 2b 80 00       	push   $0x802b44
+  8002ed:	e8 2d 04 00 00       	call   80071f <cprintf>
+  8002f2:	83 c4 10             	add    $0x10,%esp
+  8002f5:	e9 39 fe ff ff       	jmp    800133 <check_regs+0x100>
+	CHECK(edx, regs.reg_edx);
+  8002fa:	83 ec 0c             	sub    $0xc,%esp
+  8002fd:	68 44 2b 80 00       	push   $0x802b44
+  800302:	e8 18 04 00 00       	call   80071f <cprintf>
+  800307:	83 c4 10             	add    $0x10,%esp
+  80030a:	e9 5d fe ff ff       	jmp    80016c <check_regs+0x139>
+	CHECK(ecx, regs.reg_ecx);
+  80030f:	83 ec 0c             	sub    $0xc,%esp
+  800312:	68 44 2b 80 00       	push   $0x802b44
+  800317:	e8 03 04 00 00       	call   80071f <cprintf>
+  80031c:	83 c4 10             	add    $0x10,%esp
+  80031f:	e9 81 fe ff ff       	jmp    8001a5 <check_regs+0x172>
+	CHECK(eax, regs.reg_eax);
+  800324:	83 ec 0c             	sub    $0xc,%esp
+  800327:	68 44 2b 80 00       	push   $0x802b44
+  80032c:	e8 ee 03 00 00       	call   80071f <cprintf>
+  800331:	83 c4 10             	add    $0x10,%esp
+  800334:	e9 a5 fe ff ff       	jmp    8001de <check_regs+0x1ab>
+	CHECK(eip, eip);
+  800339:	83 ec 0c             	sub    $0xc,%esp
+  80033c:	68 44 2b 80 00       	push   $0x802b44
+  800341:	e8 d9 03 00 00       	call   80071f <cprintf>
+  800346:	83 c4 10             	add    $0x10,%esp
+  800349:	e9 c9 fe ff ff       	jmp    800217 <check_regs+0x1e4>
+	CHECK(eflags, eflags);
+  80034e:	83 ec 0c             	sub    $0xc,%esp
+  800351:	68 44 2b 80 00       	push   $0x802b44
+  800356:	e8 c4 03 00 00       	call   80071f <cprintf>
+	CHECK(esp, esp);
+  80035b:	ff 73 28             	push   0x28(%ebx)
+  80035e:	ff 76 28             	push   0x28(%esi)
+  800361:	68 75 2b 80 00       	push   $0x802b75
+  800366:	68 34 2b 80 00       	push   $0x802b34
+  80036b:	e8 af 03 00 00       	call   80071f <cprintf>
+  800370:	83 c4 20             	add    $0x20,%esp
+  800373:	8b 43 28             	mov    0x28(%ebx),%eax
+  800376:	39 46 28             	cmp    %eax,0x28(%esi)
+  800379:	0f 85 ed fe ff ff    	jne    80026c <check_regs+0x239>
+  80037f:	83 ec 0c             	sub    $0xc,%esp
+  800382:	68 44 2b 80 00       	push   $0x802b44
+  800387:	e8 93 03 00 00       	call   80071f <cprintf>
+	cprintf("Registers %s ", testname);
+  80038c:	83 c4 08             	add    $0x8,%esp
+  80038f:	ff 75 0c             	push   0xc(%ebp)
+  800392:	68 79 2b 80 00       	push   $0x802b79
+  800397:	e8 83 03 00 00       	call   80071f <cprintf>
+	if (!mismatch)
+  80039c:	83 c4 10             	add    $0x10,%esp
+  80039f:	85 ff                	test   %edi,%edi
+  8003a1:	0f 85 e5 fe ff ff    	jne    80028c <check_regs+0x259>
+		cprintf("OK\n");
+  8003a7:	83 ec 0c             	sub    $0xc,%esp
+  8003aa:	68 44 2b 80 00       	push   $0x802b44
+  8003af:	e8 6b 03 00 00       	call   80071f <cprintf>
+  8003b4:	83 c4 10             	add    $0x10,%esp
+}
+  8003b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003ba:	5b                   	pop    %ebx
+  8003bb:	5e                   	pop    %esi
+  8003bc:	5f                   	pop    %edi
+  8003bd:	5d                   	pop    %ebp
+  8003be:	c3                   	ret
+	CHECK(esp, esp);
+  8003bf:	83 ec 0c             	sub    $0xc,%esp
+  8003c2:	68 44 2b 80 00       	push   $0x802b44
+  8003c7:	e8 53 03 00 00       	call   80071f <cprintf>
+	cprintf("Registers %s ", testname);
+  8003cc:	83 c4 08             	add    $0x8,%esp
+  8003cf:	ff 75 0c             	push   0xc(%ebp)
+  8003d2:	68 79 2b 80 00       	push   $0x802b79
+  8003d7:	e8 43 03 00 00       	call   80071f <cprintf>
+  8003dc:	83 c4 10             	add    $0x10,%esp
+  8003df:	e9 a8 fe ff ff       	jmp    80028c <check_regs+0x259>
+
+008003e4 <pgfault>:
+
+static void
+pgfault(struct UTrapframe *utf)
+{
+  8003e4:	55                   	push   %ebp
+  8003e5:	89 e5                	mov    %esp,%ebp
+  8003e7:	83 ec 08             	sub    $0x8,%esp
+  8003ea:	8b 45 08             	mov    0x8(%ebp),%eax
+	int r;
+
+	if (utf->utf_fault_va != (uint32_t)UTEMP)
+  8003ed:	8b 10                	mov    (%eax),%edx
+  8003ef:	81 fa 00 00 40 00    	cmp    $0x400000,%edx
+  8003f5:	0f 85 a3 00 00 00    	jne    80049e <pgfault+0xba>
+		panic("pgfault expected at UTEMP, got 0x%08x (eip %08x)",
+		      utf->utf_fault_va, utf->utf_eip);
+
+	// Check registers in UTrapframe
+	during.regs = utf->utf_regs;
+  8003fb:	8b 50 08             	mov    0x8(%eax),%edx
+  8003fe:	89 15 40 50 80 00    	mov    %edx,0x805040
+  800404:	8b 50 0c             	mov    0xc(%eax),%edx
+  800407:	89 15 44 50 80 00    	mov    %edx,0x805044
+  80040d:	8b 50 10             	mov    0x10(%eax),%edx
+  800410:	89 15 48 50 80 00    	mov    %edx,0x805048
+  800416:	8b 50 14             	mov    0x14(%eax),%edx
+  800419:	89 15 4c 50 80 00    	mov    %edx,0x80504c
+  80041f:	8b 50 18             	mov    0x18(%eax),%edx
+  800422:	89 15 50 50 80 00    	mov    %edx,0x805050
+  800428:	8b 50 1c             	mov    0x1c(%eax),%edx
+  80042b:	89 15 54 50 80 00    	mov    %edx,0x805054
+  800431:	8b 50 20             	mov    0x20(%eax),%edx
+  800434:	89 15 58 50 80 00    	mov    %edx,0x805058
+  80043a:	8b 50 24             	mov    0x24(%eax),%edx
+  80043d:	89 15 5c 50 80 00    	mov    %edx,0x80505c
+	during.eip = utf->utf_eip;
+  800443:	8b 50 28             	mov    0x28(%eax),%edx
+  800446:	89 15 60 50 80 00    	mov    %edx,0x805060
+	during.eflags = utf->utf_eflags & ~FL_RF;
+  80044c:	8b 50 2c             	mov    0x2c(%eax),%edx
+  80044f:	81 e2 ff ff fe ff    	and    $0xfffeffff,%edx
+  800455:	89 15 64 50 80 00    	mov    %edx,0x805064
+	during.esp = utf->utf_esp;
+  80045b:	8b 40 30             	mov    0x30(%eax),%eax
+  80045e:	a3 68 50 80 00       	mov    %eax,0x805068
+	check_regs(&before, "before", &during, "during", "in UTrapframe");
+  800463:	83 ec 08             	sub    $0x8,%esp
+  800466:	68 9f 2b 80 00       	push   $0x802b9f
+  80046b:	68 ad 2b 80 00       	push   $0x802bad
+  800470:	b9 40 50 80 00       	mov    $0x805040,%ecx
+  800475:	ba 98 2b 80 00       	mov    $0x802b98,%edx
+  80047a:	b8 80 50 80 00       	mov    $0x805080,%eax
+  80047f:	e8 af fb ff ff       	call   800033 <check_regs>
+
+	// Map UTEMP so the write succeeds
+	if ((r = sys_page_alloc(0, UTEMP, PTE_U|PTE_P|PTE_W)) < 0)
+  800484:	83 c4 0c             	add    $0xc,%esp
+  800487:	6a 07                	push   $0x7
+  800489:	68 00 00 40 00       	push   $0x400000
+  80048e:	6a 00                	push   $0x0
+  800490:	e8 2f 0c 00 00       	call   8010c4 <sys_page_alloc>
+  800495:	83 c4 10             	add    $0x10,%esp
+  800498:	85 c0                	test   %eax,%eax
+  80049a:	78 1a                	js     8004b6 <pgfault+0xd2>
+		panic("sys_page_alloc: %e", r);
+}
+  80049c:	c9                   	leave
+  80049d:	c3                   	ret
+		panic("pgfault expected at UTEMP, got 0x%08x (eip %08x)",
+  80049e:	83 ec 0c             	sub    $0xc,%esp
+  8004a1:	ff 70 28             	push   0x28(%eax)
+  8004a4:	52                   	push   %edx
+  8004a5:	68 e0 2b 80 00       	push   $0x802be0
+  8004aa:	6a 50                	push   $0x50
+  8004ac:	68 87 2b 80 00       	push   $0x802b87
+  8004b1:	e8 8e 01 00 00       	call   800644 <_panic>
+		panic("sys_page_alloc: %e", r);
+  8004b6:	50                   	push   %eax
+  8004b7:	68 b4 2b 80 00       	push   $0x802bb4
+  8004bc:	6a 5c                	push   $0x5c
+  8004be:	68 87 2b 80 00       	push   $0x802b87
+  8004c3:	e8 7c 01 00 00       	call   800644 <_panic>
+
+008004c8 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8004c8:	55                   	push   %ebp
+  8004c9:	89 e5                	mov    %esp,%ebp
+  8004cb:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  8004ce:	68 e4 03 80 00       	push   $0x8003e4
+  8004d3:	e8 bf 0e 00 00       	call   801397 <set_pgfault_handler>
+
+	asm volatile(
+  8004d8:	50                   	push   %eax
+  8004d9:	9c                   	pushf
+  8004da:	58                   	pop    %eax
+  8004db:	0d d5 08 00 00       	or     $0x8d5,%eax
+  8004e0:	50                   	push   %eax
+  8004e1:	9d                   	popf
+  8004e2:	a3 a4 50 80 00       	mov    %eax,0x8050a4
+  8004e7:	8d 05 22 05 80 00    	lea    0x800522,%eax
+  8004ed:	a3 a0 50 80 00       	mov    %eax,0x8050a0
+  8004f2:	58                   	pop    %eax
+  8004f3:	89 3d 80 50 80 00    	mov    %edi,0x805080
+  8004f9:	89 35 84 50 80 00    	mov    %esi,0x805084
+  8004ff:	89 2d 88 50 80 00    	mov    %ebp,0x805088
+  800505:	89 1d 90 50 80 00    	mov    %ebx,0x805090
+  80050b:	89 15 94 50 80 00    	mov    %edx,0x805094
+  800511:	89 0d 98 50 80 00    	mov    %ecx,0x805098
+  800517:	a3 9c 50 80 00       	mov    %eax,0x80509c
+  80051c:	89 25 a8 50 80 00    	mov    %esp,0x8050a8
+  800522:	c7 05 00 00 40 00 2a 	movl   $0x2a,0x400000
+  800529:	00 00 00 
+  80052c:	89 3d 00 50 80 00    	mov    %edi,0x805000
+  800532:	89 35 04 50 80 00    	mov    %esi,0x805004
+  800538:	89 2d 08 50 80 00    	mov    %ebp,0x805008
+  80053e:	89 1d 10 50 80 00    	mov    %ebx,0x805010
+  800544:	89 15 14 50 80 00    	mov    %edx,0x805014
+  80054a:	89 0d 18 50 80 00    	mov    %ecx,0x805018
+  800550:	a3 1c 50 80 00       	mov    %eax,0x80501c
+  800555:	89 25 28 50 80 00    	mov    %esp,0x805028
+  80055b:	8b 3d 80 50 80 00    	mov    0x805080,%edi
+  800561:	8b 35 84 50 80 00    	mov    0x805084,%esi
+  800567:	8b 2d 88 50 80 00    	mov    0x805088,%ebp
+  80056d:	8b 1d 90 50 80 00    	mov    0x805090,%ebx
+  800573:	8b 15 94 50 80 00    	mov    0x805094,%edx
+  800579:	8b 0d 98 50 80 00    	mov    0x805098,%ecx
+  80057f:	a1 9c 50 80 00       	mov    0x80509c,%eax
+  800584:	8b 25 a8 50 80 00    	mov    0x8050a8,%esp
+  80058a:	50                   	push   %eax
+  80058b:	9c                   	pushf
+  80058c:	58                   	pop    %eax
+  80058d:	a3 24 50 80 00       	mov    %eax,0x805024
+  800592:	58                   	pop    %eax
+		: : "m" (before), "m" (after) : "memory", "cc");
+
+	// Check UTEMP to roughly determine that EIP was restored
+	// correctly (of course, we probably wouldn't get this far if
+	// it weren't)
+	if (*(int*)UTEMP != 42)
+  800593:	83 c4 10             	add    $0x10,%esp
+  800596:	83 3d 00 00 40 00 2a 	cmpl   $0x2a,0x400000
+  80059d:	75 30                	jne    8005cf <umain+0x107>
+		cprintf("EIP after page-fault MISMATCH\n");
+	after.eip = before.eip;
+  80059f:	a1 a0 50 80 00       	mov    0x8050a0,%eax
+  8005a4:	a3 20 50 80 00       	mov    %eax,0x805020
+
+	check_regs(&before, "before", &after, "after", "after page-fault");
+  8005a9:	83 ec 08             	sub    $0x8,%esp
+  8005ac:	68 c7 2b 80 00       	push   $0x802bc7
+  8005b1:	68 d8 2b 80 00       	push   $0x802bd8
+  8005b6:	b9 00 50 80 00       	mov    $0x805000,%ecx
+  8005bb:	ba 98 2b 80 00       	mov    $0x802b98,%edx
+  8005c0:	b8 80 50 80 00       	mov    $0x805080,%eax
+  8005c5:	e8 69 fa ff ff       	call   800033 <check_regs>
+}
+  8005ca:	83 c4 10             	add    $0x10,%esp
+  8005cd:	c9                   	leave
+  8005ce:	c3                   	ret
+		cprintf("EIP after page-fault MISMATCH\n");
+  8005cf:	83 ec 0c             	sub    $0xc,%esp
+  8005d2:	68 14 2c 80 00       	push   $0x802c14
+  8005d7:	e8 43 01 00 00       	call   80071f <cprintf>
+  8005dc:	83 c4 10             	add    $0x10,%esp
+  8005df:	eb be                	jmp    80059f <umain+0xd7>
+
+008005e1 <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  8005e1:	55                   	push   %ebp
+  8005e2:	89 e5                	mov    %esp,%ebp
+  8005e4:	56                   	push   %esi
+  8005e5:	53                   	push   %ebx
+  8005e6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8005e9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  8005ec:	e8 95 0a 00 00       	call   801086 <sys_getenvid>
+  8005f1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8005f6:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8005f9:	c1 e0 04             	shl    $0x4,%eax
+  8005fc:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800601:	a3 b4 50 80 00       	mov    %eax,0x8050b4
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800606:	85 db                	test   %ebx,%ebx
+  800608:	7e 07                	jle    800611 <libmain+0x30>
+    binaryname = argv[0];
+  80060a:	8b 06                	mov    (%esi),%eax
+  80060c:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  800611:	83 ec 08             	sub    $0x8,%esp
+  800614:	56                   	push   %esi
+  800615:	53                   	push   %ebx
+  800616:	e8 ad fe ff ff       	call   8004c8 <umain>
+
+  // exit gracefully
+  exit();
+  80061b:	e8 0a 00 00 00       	call   80062a <exit>
+}
+  800620:	83 c4 10             	add    $0x10,%esp
+  800623:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800626:	5b                   	pop    %ebx
+  800627:	5e                   	pop    %esi
+  800628:	5d                   	pop    %ebp
+  800629:	c3                   	ret
+
+0080062a <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80062a:	55                   	push   %ebp
+  80062b:	89 e5                	mov    %esp,%ebp
+  80062d:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800630:	e8 c5 0f 00 00       	call   8015fa <close_all>
+	sys_env_destroy(0);
+  800635:	83 ec 0c             	sub    $0xc,%esp
+  800638:	6a 00                	push   $0x0
+  80063a:	e8 06 0a 00 00       	call   801045 <sys_env_destroy>
+}
+  80063f:	83 c4 10             	add    $0x10,%esp
+  800642:	c9                   	leave
+  800643:	c3                   	ret
+
+00800644 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800644:	55                   	push   %ebp
+  800645:	89 e5                	mov    %esp,%ebp
+  800647:	56                   	push   %esi
+  800648:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800649:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80064c:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800652:	e8 2f 0a 00 00       	call   801086 <sys_getenvid>
+  800657:	83 ec 0c             	sub    $0xc,%esp
+  80065a:	ff 75 0c             	push   0xc(%ebp)
+  80065d:	ff 75 08             	push   0x8(%ebp)
+  800660:	56                   	push   %esi
+  800661:	50                   	push   %eax
+  800662:	68 40 2c 80 00       	push   $0x802c40
+  800667:	e8 b3 00 00 00       	call   80071f <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80066c:	83 c4 18             	add    $0x18,%esp
+  80066f:	53                   	push   %ebx
+  800670:	ff 75 10             	push   0x10(%ebp)
+  800673:	e8 56 00 00 00       	call   8006ce <vcprintf>
+	cprintf("\n");
+  800678:	c7 04 24 50 2b 80 00 	movl   $0x802b50,(%esp)
+  80067f:	e8 9b 00 00 00       	call   80071f <cprintf>
+  800684:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800687:	cc                   	int3
+	while (1)
+  800688:	eb fd                	jmp    800687 <_panic+0x43>
+
+0080068a <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80068a:	55                   	push   %ebp
+  80068b:	89 e5                	mov    %esp,%ebp
+  80068d:	53                   	push   %ebx
+  80068e:	83 ec 04             	sub    $0x4,%esp
+  800691:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800694:	8b 13                	mov    (%ebx),%edx
+  800696:	8d 42 01             	lea    0x1(%edx),%eax
+  800699:	89 03                	mov    %eax,(%ebx)
+  80069b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80069e:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8006a2:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8006a7:	74 09                	je     8006b2 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8006a9:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8006ad:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8006b0:	c9                   	leave
+  8006b1:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8006b2:	83 ec 08             	sub    $0x8,%esp
+  8006b5:	68 ff 00 00 00       	push   $0xff
+  8006ba:	8d 43 08             	lea    0x8(%ebx),%eax
+  8006bd:	50                   	push   %eax
+  8006be:	e8 45 09 00 00       	call   801008 <sys_cputs>
+		b->idx = 0;
+  8006c3:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8006c9:	83 c4 10             	add    $0x10,%esp
+  8006cc:	eb db                	jmp    8006a9 <putch+0x1f>
+
+008006ce <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8006ce:	55                   	push   %ebp
+  8006cf:	89 e5                	mov    %esp,%ebp
+  8006d1:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8006d7:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8006de:	00 00 00 
+	b.cnt = 0;
+  8006e1:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8006e8:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8006eb:	ff 75 0c             	push   0xc(%ebp)
+  8006ee:	ff 75 08             	push   0x8(%ebp)
+  8006f1:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8006f7:	50                   	push   %eax
+  8006f8:	68 8a 06 80 00       	push   $0x80068a
+  8006fd:	e8 14 01 00 00       	call   800816 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800702:	83 c4 08             	add    $0x8,%esp
+  800705:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80070b:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800711:	50                   	push   %eax
+  800712:	e8 f1 08 00 00       	call   801008 <sys_cputs>
+
+	return b.cnt;
+}
+  800717:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80071d:	c9                   	leave
+  80071e:	c3                   	ret
+
+0080071f <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80071f:	55                   	push   %ebp
+  800720:	89 e5                	mov    %esp,%ebp
+  800722:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800725:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800728:	50                   	push   %eax
+  800729:	ff 75 08             	push   0x8(%ebp)
+  80072c:	e8 9d ff ff ff       	call   8006ce <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800731:	c9                   	leave
+  800732:	c3                   	ret
+
+00800733 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800733:	55                   	push   %ebp
+  800734:	89 e5                	mov    %esp,%ebp
+  800736:	57                   	push   %edi
+  800737:	56                   	push   %esi
+  800738:	53                   	push   %ebx
+  800739:	83 ec 1c             	sub    $0x1c,%esp
+  80073c:	89 c7                	mov    %eax,%edi
+  80073e:	89 d6                	mov    %edx,%esi
+  800740:	8b 45 08             	mov    0x8(%ebp),%eax
+  800743:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800746:	89 d1                	mov    %edx,%ecx
+  800748:	89 c2                	mov    %eax,%edx
+  80074a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80074d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800750:	8b 45 10             	mov    0x10(%ebp),%eax
+  800753:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800756:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800759:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800760:	39 c2                	cmp    %eax,%edx
+  800762:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800765:	72 3e                	jb     8007a5 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800767:	83 ec 0c             	sub    $0xc,%esp
+  80076a:	ff 75 18             	push   0x18(%ebp)
+  80076d:	83 eb 01             	sub    $0x1,%ebx
+  800770:	53                   	push   %ebx
+  800771:	50                   	push   %eax
+  800772:	83 ec 08             	sub    $0x8,%esp
+  800775:	ff 75 e4             	push   -0x1c(%ebp)
+  800778:	ff 75 e0             	push   -0x20(%ebp)
+  80077b:	ff 75 dc             	push   -0x24(%ebp)
+  80077e:	ff 75 d8             	push   -0x28(%ebp)
+  800781:	e8 0a 20 00 00       	call   802790 <__udivdi3>
+  800786:	83 c4 18             	add    $0x18,%esp
+  800789:	52                   	push   %edx
+  80078a:	50                   	push   %eax
+  80078b:	89 f2                	mov    %esi,%edx
+  80078d:	89 f8                	mov    %edi,%eax
+  80078f:	e8 9f ff ff ff       	call   800733 <printnum>
+  800794:	83 c4 20             	add    $0x20,%esp
+  800797:	eb 13                	jmp    8007ac <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800799:	83 ec 08             	sub    $0x8,%esp
+  80079c:	56                   	push   %esi
+  80079d:	ff 75 18             	push   0x18(%ebp)
+  8007a0:	ff d7                	call   *%edi
+  8007a2:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8007a5:	83 eb 01             	sub    $0x1,%ebx
+  8007a8:	85 db                	test   %ebx,%ebx
+  8007aa:	7f ed                	jg     800799 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8007ac:	83 ec 08             	sub    $0x8,%esp
+  8007af:	56                   	push   %esi
+  8007b0:	83 ec 04             	sub    $0x4,%esp
+  8007b3:	ff 75 e4             	push   -0x1c(%ebp)
+  8007b6:	ff 75 e0             	push   -0x20(%ebp)
+  8007b9:	ff 75 dc             	push   -0x24(%ebp)
+  8007bc:	ff 75 d8             	push   -0x28(%ebp)
+  8007bf:	e8 9c 20 00 00       	call   802860 <__umoddi3>
+  8007c4:	83 c4 14             	add    $0x14,%esp
+  8007c7:	0f be 80 63 2c 80 00 	movsbl 0x802c63(%eax),%eax
+  8007ce:	50                   	push   %eax
+  8007cf:	ff d7                	call   *%edi
+}
+  8007d1:	83 c4 10             	add    $0x10,%esp
+  8007d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007d7:	5b                   	pop    %ebx
+  8007d8:	5e                   	pop    %esi
+  8007d9:	5f                   	pop    %edi
+  8007da:	5d                   	pop    %ebp
+  8007db:	c3                   	ret
+
+008007dc <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8007dc:	55                   	push   %ebp
+  8007dd:	89 e5                	mov    %esp,%ebp
+  8007df:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8007e2:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8007e6:	8b 10                	mov    (%eax),%edx
+  8007e8:	3b 50 04             	cmp    0x4(%eax),%edx
+  8007eb:	73 0a                	jae    8007f7 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8007ed:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8007f0:	89 08                	mov    %ecx,(%eax)
+  8007f2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007f5:	88 02                	mov    %al,(%edx)
+}
+  8007f7:	5d                   	pop    %ebp
+  8007f8:	c3                   	ret
+
+008007f9 <printfmt>:
+{
+  8007f9:	55                   	push   %ebp
+  8007fa:	89 e5                	mov    %esp,%ebp
+  8007fc:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8007ff:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800802:	50                   	push   %eax
+  800803:	ff 75 10             	push   0x10(%ebp)
+  800806:	ff 75 0c             	push   0xc(%ebp)
+  800809:	ff 75 08             	push   0x8(%ebp)
+  80080c:	e8 05 00 00 00       	call   800816 <vprintfmt>
+}
+  800811:	83 c4 10             	add    $0x10,%esp
+  800814:	c9                   	leave
+  800815:	c3                   	ret
+
+00800816 <vprintfmt>:
+{
+  800816:	55                   	push   %ebp
+  800817:	89 e5                	mov    %esp,%ebp
+  800819:	57                   	push   %edi
+  80081a:	56                   	push   %esi
+  80081b:	53                   	push   %ebx
+  80081c:	83 ec 2c             	sub    $0x2c,%esp
+  80081f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800822:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800825:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800828:	eb 0a                	jmp    800834 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80082a:	83 ec 08             	sub    $0x8,%esp
+  80082d:	53                   	push   %ebx
+  80082e:	50                   	push   %eax
+  80082f:	ff d6                	call   *%esi
+  800831:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800834:	83 c7 01             	add    $0x1,%edi
+  800837:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80083b:	83 f8 25             	cmp    $0x25,%eax
+  80083e:	74 0c                	je     80084c <vprintfmt+0x36>
+			if (ch == '\0')
+  800840:	85 c0                	test   %eax,%eax
+  800842:	75 e6                	jne    80082a <vprintfmt+0x14>
+}
+  800844:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800847:	5b                   	pop    %ebx
+  800848:	5e                   	pop    %esi
+  800849:	5f                   	pop    %edi
+  80084a:	5d                   	pop    %ebp
+  80084b:	c3                   	ret
+		padc = ' ';
+  80084c:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800850:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800857:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80085e:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800865:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80086a:	8d 47 01             	lea    0x1(%edi),%eax
+  80086d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800870:	0f b6 17             	movzbl (%edi),%edx
+  800873:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800876:	3c 55                	cmp    $0x55,%al
+  800878:	0f 87 9a 03 00 00    	ja     800c18 <vprintfmt+0x402>
+  80087e:	0f b6 c0             	movzbl %al,%eax
+  800881:	ff 24 85 a0 2d 80 00 	jmp    *0x802da0(,%eax,4)
+  800888:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  80088b:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80088f:	eb d9                	jmp    80086a <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800891:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800894:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800898:	eb d0                	jmp    80086a <vprintfmt+0x54>
+  80089a:	0f b6 d2             	movzbl %dl,%edx
+  80089d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8008a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008a5:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8008a8:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8008ab:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8008af:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8008b2:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8008b5:	83 f9 09             	cmp    $0x9,%ecx
+  8008b8:	77 55                	ja     80090f <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8008ba:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8008bd:	eb e9                	jmp    8008a8 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8008bf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008c2:	8b 00                	mov    (%eax),%eax
+  8008c4:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8008c7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ca:	8d 40 04             	lea    0x4(%eax),%eax
+  8008cd:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8008d0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8008d3:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8008d7:	79 91                	jns    80086a <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8008d9:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8008dc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8008df:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8008e6:	eb 82                	jmp    80086a <vprintfmt+0x54>
+			if (width < 0)
+  8008e8:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8008eb:	85 d2                	test   %edx,%edx
+  8008ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008f2:	0f 49 c2             	cmovns %edx,%eax
+  8008f5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8008f8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8008fb:	e9 6a ff ff ff       	jmp    80086a <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800900:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800903:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80090a:	e9 5b ff ff ff       	jmp    80086a <vprintfmt+0x54>
+  80090f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800912:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800915:	eb bc                	jmp    8008d3 <vprintfmt+0xbd>
+			lflag++;
+  800917:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80091a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80091d:	e9 48 ff ff ff       	jmp    80086a <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800922:	8b 45 14             	mov    0x14(%ebp),%eax
+  800925:	8d 78 04             	lea    0x4(%eax),%edi
+  800928:	83 ec 08             	sub    $0x8,%esp
+  80092b:	53                   	push   %ebx
+  80092c:	ff 30                	push   (%eax)
+  80092e:	ff d6                	call   *%esi
+			break;
+  800930:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800933:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800936:	e9 7c 02 00 00       	jmp    800bb7 <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  80093b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80093e:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800941:	8b 10                	mov    (%eax),%edx
+  800943:	89 d0                	mov    %edx,%eax
+  800945:	f7 d8                	neg    %eax
+  800947:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80094a:	83 f8 10             	cmp    $0x10,%eax
+  80094d:	7f 23                	jg     800972 <vprintfmt+0x15c>
+  80094f:	8b 14 85 00 2f 80 00 	mov    0x802f00(,%eax,4),%edx
+  800956:	85 d2                	test   %edx,%edx
+  800958:	74 18                	je     800972 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  80095a:	52                   	push   %edx
+  80095b:	68 b5 30 80 00       	push   $0x8030b5
+  800960:	53                   	push   %ebx
+  800961:	56                   	push   %esi
+  800962:	e8 92 fe ff ff       	call   8007f9 <printfmt>
+  800967:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80096a:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80096d:	e9 45 02 00 00       	jmp    800bb7 <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  800972:	50                   	push   %eax
+  800973:	68 7b 2c 80 00       	push   $0x802c7b
+  800978:	53                   	push   %ebx
+  800979:	56                   	push   %esi
+  80097a:	e8 7a fe ff ff       	call   8007f9 <printfmt>
+  80097f:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800982:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800985:	e9 2d 02 00 00       	jmp    800bb7 <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80098a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80098d:	83 c0 04             	add    $0x4,%eax
+  800990:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800993:	8b 45 14             	mov    0x14(%ebp),%eax
+  800996:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800998:	85 c9                	test   %ecx,%ecx
+  80099a:	b8 74 2c 80 00       	mov    $0x802c74,%eax
+  80099f:	0f 45 c1             	cmovne %ecx,%eax
+  8009a2:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8009a5:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8009a9:	7e 06                	jle    8009b1 <vprintfmt+0x19b>
+  8009ab:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8009af:	75 0b                	jne    8009bc <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8009b1:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8009b4:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8009b7:	89 75 08             	mov    %esi,0x8(%ebp)
+  8009ba:	eb 5c                	jmp    800a18 <vprintfmt+0x202>
+  8009bc:	83 ec 08             	sub    $0x8,%esp
+  8009bf:	ff 75 d0             	push   -0x30(%ebp)
+  8009c2:	ff 75 cc             	push   -0x34(%ebp)
+  8009c5:	e8 eb 02 00 00       	call   800cb5 <strnlen>
+  8009ca:	89 c2                	mov    %eax,%edx
+  8009cc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8009cf:	29 d0                	sub    %edx,%eax
+  8009d1:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8009d4:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8009d8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8009db:	89 75 08             	mov    %esi,0x8(%ebp)
+  8009de:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8009e0:	eb 0e                	jmp    8009f0 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8009e2:	83 ec 08             	sub    $0x8,%esp
+  8009e5:	53                   	push   %ebx
+  8009e6:	57                   	push   %edi
+  8009e7:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8009ea:	83 ee 01             	sub    $0x1,%esi
+  8009ed:	83 c4 10             	add    $0x10,%esp
+  8009f0:	85 f6                	test   %esi,%esi
+  8009f2:	7f ee                	jg     8009e2 <vprintfmt+0x1cc>
+  8009f4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8009f7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009fa:	85 c0                	test   %eax,%eax
+  8009fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a01:	0f 49 d0             	cmovns %eax,%edx
+  800a04:	29 d0                	sub    %edx,%eax
+  800a06:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800a09:	eb a6                	jmp    8009b1 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800a0b:	83 ec 08             	sub    $0x8,%esp
+  800a0e:	53                   	push   %ebx
+  800a0f:	52                   	push   %edx
+  800a10:	ff 55 08             	call   *0x8(%ebp)
+  800a13:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800a16:	89 f1                	mov    %esi,%ecx
+  800a18:	8d 71 01             	lea    0x1(%ecx),%esi
+  800a1b:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800a1f:	0f be d0             	movsbl %al,%edx
+  800a22:	85 d2                	test   %edx,%edx
+  800a24:	74 28                	je     800a4e <vprintfmt+0x238>
+  800a26:	85 ff                	test   %edi,%edi
+  800a28:	78 05                	js     800a2f <vprintfmt+0x219>
+  800a2a:	83 ef 01             	sub    $0x1,%edi
+  800a2d:	78 30                	js     800a5f <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800a2f:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800a33:	74 d6                	je     800a0b <vprintfmt+0x1f5>
+  800a35:	0f be c0             	movsbl %al,%eax
+  800a38:	83 e8 20             	sub    $0x20,%eax
+  800a3b:	83 f8 5e             	cmp    $0x5e,%eax
+  800a3e:	76 cb                	jbe    800a0b <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800a40:	83 ec 08             	sub    $0x8,%esp
+  800a43:	53                   	push   %ebx
+  800a44:	6a 3f                	push   $0x3f
+  800a46:	ff 55 08             	call   *0x8(%ebp)
+  800a49:	83 c4 10             	add    $0x10,%esp
+  800a4c:	eb c8                	jmp    800a16 <vprintfmt+0x200>
+  800a4e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a51:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800a54:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800a57:	01 d0                	add    %edx,%eax
+  800a59:	29 c8                	sub    %ecx,%eax
+  800a5b:	89 c7                	mov    %eax,%edi
+  800a5d:	eb 13                	jmp    800a72 <vprintfmt+0x25c>
+  800a5f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a62:	eb ed                	jmp    800a51 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800a64:	83 ec 08             	sub    $0x8,%esp
+  800a67:	53                   	push   %ebx
+  800a68:	6a 20                	push   $0x20
+  800a6a:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800a6c:	83 ef 01             	sub    $0x1,%edi
+  800a6f:	83 c4 10             	add    $0x10,%esp
+  800a72:	85 ff                	test   %edi,%edi
+  800a74:	7f ee                	jg     800a64 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800a76:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800a79:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a7c:	e9 36 01 00 00       	jmp    800bb7 <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  800a81:	83 f9 01             	cmp    $0x1,%ecx
+  800a84:	7f 1f                	jg     800aa5 <vprintfmt+0x28f>
+	else if (lflag)
+  800a86:	85 c9                	test   %ecx,%ecx
+  800a88:	74 67                	je     800af1 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800a8a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a8d:	8b 00                	mov    (%eax),%eax
+  800a8f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800a92:	89 c1                	mov    %eax,%ecx
+  800a94:	c1 f9 1f             	sar    $0x1f,%ecx
+  800a97:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800a9a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a9d:	8d 40 04             	lea    0x4(%eax),%eax
+  800aa0:	89 45 14             	mov    %eax,0x14(%ebp)
+  800aa3:	eb 17                	jmp    800abc <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800aa5:	8b 45 14             	mov    0x14(%ebp),%eax
+  800aa8:	8b 50 04             	mov    0x4(%eax),%edx
+  800aab:	8b 00                	mov    (%eax),%eax
+  800aad:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800ab0:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800ab3:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ab6:	8d 40 08             	lea    0x8(%eax),%eax
+  800ab9:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800abc:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800abf:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800ac2:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800ac7:	85 c9                	test   %ecx,%ecx
+  800ac9:	0f 89 ce 00 00 00    	jns    800b9d <vprintfmt+0x387>
+				putch('-', putdat);
+  800acf:	83 ec 08             	sub    $0x8,%esp
+  800ad2:	53                   	push   %ebx
+  800ad3:	6a 2d                	push   $0x2d
+  800ad5:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800ad7:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800ada:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800add:	f7 da                	neg    %edx
+  800adf:	83 d1 00             	adc    $0x0,%ecx
+  800ae2:	f7 d9                	neg    %ecx
+  800ae4:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800ae7:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800aec:	e9 ac 00 00 00       	jmp    800b9d <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  800af1:	8b 45 14             	mov    0x14(%ebp),%eax
+  800af4:	8b 00                	mov    (%eax),%eax
+  800af6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800af9:	89 c1                	mov    %eax,%ecx
+  800afb:	c1 f9 1f             	sar    $0x1f,%ecx
+  800afe:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800b01:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b04:	8d 40 04             	lea    0x4(%eax),%eax
+  800b07:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b0a:	eb b0                	jmp    800abc <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800b0c:	83 f9 01             	cmp    $0x1,%ecx
+  800b0f:	7f 1b                	jg     800b2c <vprintfmt+0x316>
+	else if (lflag)
+  800b11:	85 c9                	test   %ecx,%ecx
+  800b13:	74 2c                	je     800b41 <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  800b15:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b18:	8b 10                	mov    (%eax),%edx
+  800b1a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b1f:	8d 40 04             	lea    0x4(%eax),%eax
+  800b22:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800b25:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800b2a:	eb 71                	jmp    800b9d <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  800b2c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b2f:	8b 10                	mov    (%eax),%edx
+  800b31:	8b 48 04             	mov    0x4(%eax),%ecx
+  800b34:	8d 40 08             	lea    0x8(%eax),%eax
+  800b37:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800b3a:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800b3f:	eb 5c                	jmp    800b9d <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  800b41:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b44:	8b 10                	mov    (%eax),%edx
+  800b46:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b4b:	8d 40 04             	lea    0x4(%eax),%eax
+  800b4e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800b51:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800b56:	eb 45                	jmp    800b9d <vprintfmt+0x387>
+			putch('X', putdat);
+  800b58:	83 ec 08             	sub    $0x8,%esp
+  800b5b:	53                   	push   %ebx
+  800b5c:	6a 58                	push   $0x58
+  800b5e:	ff d6                	call   *%esi
+			putch('X', putdat);
+  800b60:	83 c4 08             	add    $0x8,%esp
+  800b63:	53                   	push   %ebx
+  800b64:	6a 58                	push   $0x58
+  800b66:	ff d6                	call   *%esi
+			putch('X', putdat);
+  800b68:	83 c4 08             	add    $0x8,%esp
+  800b6b:	53                   	push   %ebx
+  800b6c:	6a 58                	push   $0x58
+  800b6e:	ff d6                	call   *%esi
+			break;
+  800b70:	83 c4 10             	add    $0x10,%esp
+  800b73:	eb 42                	jmp    800bb7 <vprintfmt+0x3a1>
+			putch('0', putdat);
+  800b75:	83 ec 08             	sub    $0x8,%esp
+  800b78:	53                   	push   %ebx
+  800b79:	6a 30                	push   $0x30
+  800b7b:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800b7d:	83 c4 08             	add    $0x8,%esp
+  800b80:	53                   	push   %ebx
+  800b81:	6a 78                	push   $0x78
+  800b83:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800b85:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b88:	8b 10                	mov    (%eax),%edx
+  800b8a:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800b8f:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800b92:	8d 40 04             	lea    0x4(%eax),%eax
+  800b95:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800b98:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800b9d:	83 ec 0c             	sub    $0xc,%esp
+  800ba0:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800ba4:	50                   	push   %eax
+  800ba5:	ff 75 e0             	push   -0x20(%ebp)
+  800ba8:	57                   	push   %edi
+  800ba9:	51                   	push   %ecx
+  800baa:	52                   	push   %edx
+  800bab:	89 da                	mov    %ebx,%edx
+  800bad:	89 f0                	mov    %esi,%eax
+  800baf:	e8 7f fb ff ff       	call   800733 <printnum>
+			break;
+  800bb4:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800bb7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800bba:	e9 75 fc ff ff       	jmp    800834 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800bbf:	83 f9 01             	cmp    $0x1,%ecx
+  800bc2:	7f 1b                	jg     800bdf <vprintfmt+0x3c9>
+	else if (lflag)
+  800bc4:	85 c9                	test   %ecx,%ecx
+  800bc6:	74 2c                	je     800bf4 <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  800bc8:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bcb:	8b 10                	mov    (%eax),%edx
+  800bcd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bd2:	8d 40 04             	lea    0x4(%eax),%eax
+  800bd5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800bd8:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800bdd:	eb be                	jmp    800b9d <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  800bdf:	8b 45 14             	mov    0x14(%ebp),%eax
+  800be2:	8b 10                	mov    (%eax),%edx
+  800be4:	8b 48 04             	mov    0x4(%eax),%ecx
+  800be7:	8d 40 08             	lea    0x8(%eax),%eax
+  800bea:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800bed:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800bf2:	eb a9                	jmp    800b9d <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  800bf4:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bf7:	8b 10                	mov    (%eax),%edx
+  800bf9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bfe:	8d 40 04             	lea    0x4(%eax),%eax
+  800c01:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800c04:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800c09:	eb 92                	jmp    800b9d <vprintfmt+0x387>
+			putch(ch, putdat);
+  800c0b:	83 ec 08             	sub    $0x8,%esp
+  800c0e:	53                   	push   %ebx
+  800c0f:	6a 25                	push   $0x25
+  800c11:	ff d6                	call   *%esi
+			break;
+  800c13:	83 c4 10             	add    $0x10,%esp
+  800c16:	eb 9f                	jmp    800bb7 <vprintfmt+0x3a1>
+			putch('%', putdat);
+  800c18:	83 ec 08             	sub    $0x8,%esp
+  800c1b:	53                   	push   %ebx
+  800c1c:	6a 25                	push   $0x25
+  800c1e:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800c20:	83 c4 10             	add    $0x10,%esp
+  800c23:	89 f8                	mov    %edi,%eax
+  800c25:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800c29:	74 05                	je     800c30 <vprintfmt+0x41a>
+  800c2b:	83 e8 01             	sub    $0x1,%eax
+  800c2e:	eb f5                	jmp    800c25 <vprintfmt+0x40f>
+  800c30:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800c33:	eb 82                	jmp    800bb7 <vprintfmt+0x3a1>
+
+00800c35 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800c35:	55                   	push   %ebp
+  800c36:	89 e5                	mov    %esp,%ebp
+  800c38:	83 ec 18             	sub    $0x18,%esp
+  800c3b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c3e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800c41:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800c44:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800c48:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800c4b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800c52:	85 c0                	test   %eax,%eax
+  800c54:	74 26                	je     800c7c <vsnprintf+0x47>
+  800c56:	85 d2                	test   %edx,%edx
+  800c58:	7e 22                	jle    800c7c <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800c5a:	ff 75 14             	push   0x14(%ebp)
+  800c5d:	ff 75 10             	push   0x10(%ebp)
+  800c60:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800c63:	50                   	push   %eax
+  800c64:	68 dc 07 80 00       	push   $0x8007dc
+  800c69:	e8 a8 fb ff ff       	call   800816 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800c6e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800c71:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800c74:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800c77:	83 c4 10             	add    $0x10,%esp
+}
+  800c7a:	c9                   	leave
+  800c7b:	c3                   	ret
+		return -E_INVAL;
+  800c7c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c81:	eb f7                	jmp    800c7a <vsnprintf+0x45>
+
+00800c83 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800c83:	55                   	push   %ebp
+  800c84:	89 e5                	mov    %esp,%ebp
+  800c86:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800c89:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800c8c:	50                   	push   %eax
+  800c8d:	ff 75 10             	push   0x10(%ebp)
+  800c90:	ff 75 0c             	push   0xc(%ebp)
+  800c93:	ff 75 08             	push   0x8(%ebp)
+  800c96:	e8 9a ff ff ff       	call   800c35 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800c9b:	c9                   	leave
+  800c9c:	c3                   	ret
+
+00800c9d <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800c9d:	55                   	push   %ebp
+  800c9e:	89 e5                	mov    %esp,%ebp
+  800ca0:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800ca3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ca8:	eb 03                	jmp    800cad <strlen+0x10>
+		n++;
+  800caa:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800cad:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800cb1:	75 f7                	jne    800caa <strlen+0xd>
+	return n;
+}
+  800cb3:	5d                   	pop    %ebp
+  800cb4:	c3                   	ret
+
+00800cb5 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800cb5:	55                   	push   %ebp
+  800cb6:	89 e5                	mov    %esp,%ebp
+  800cb8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800cbb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800cbe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cc3:	eb 03                	jmp    800cc8 <strnlen+0x13>
+		n++;
+  800cc5:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800cc8:	39 d0                	cmp    %edx,%eax
+  800cca:	74 08                	je     800cd4 <strnlen+0x1f>
+  800ccc:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800cd0:	75 f3                	jne    800cc5 <strnlen+0x10>
+  800cd2:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800cd4:	89 d0                	mov    %edx,%eax
+  800cd6:	5d                   	pop    %ebp
+  800cd7:	c3                   	ret
+
+00800cd8 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800cd8:	55                   	push   %ebp
+  800cd9:	89 e5                	mov    %esp,%ebp
+  800cdb:	53                   	push   %ebx
+  800cdc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800cdf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800ce2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ce7:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800ceb:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800cee:	83 c0 01             	add    $0x1,%eax
+  800cf1:	84 d2                	test   %dl,%dl
+  800cf3:	75 f2                	jne    800ce7 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800cf5:	89 c8                	mov    %ecx,%eax
+  800cf7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800cfa:	c9                   	leave
+  800cfb:	c3                   	ret
+
+00800cfc <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800cfc:	55                   	push   %ebp
+  800cfd:	89 e5                	mov    %esp,%ebp
+  800cff:	53                   	push   %ebx
+  800d00:	83 ec 10             	sub    $0x10,%esp
+  800d03:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800d06:	53                   	push   %ebx
+  800d07:	e8 91 ff ff ff       	call   800c9d <strlen>
+  800d0c:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800d0f:	ff 75 0c             	push   0xc(%ebp)
+  800d12:	01 d8                	add    %ebx,%eax
+  800d14:	50                   	push   %eax
+  800d15:	e8 be ff ff ff       	call   800cd8 <strcpy>
+	return dst;
+}
+  800d1a:	89 d8                	mov    %ebx,%eax
+  800d1c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d1f:	c9                   	leave
+  800d20:	c3                   	ret
+
+00800d21 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800d21:	55                   	push   %ebp
+  800d22:	89 e5                	mov    %esp,%ebp
+  800d24:	56                   	push   %esi
+  800d25:	53                   	push   %ebx
+  800d26:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d29:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800d2c:	89 f3                	mov    %esi,%ebx
+  800d2e:	03 5d 10             	add    0x10(%ebp),%ebx
+  800d31:	89 f0                	mov    %esi,%eax
+  800d33:	eb 0f                	jmp    800d44 <strncpy+0x23>
+		*dst++ = *src;
+  800d35:	83 c0 01             	add    $0x1,%eax
+  800d38:	0f b6 0a             	movzbl (%edx),%ecx
+  800d3b:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800d3e:	80 f9 01             	cmp    $0x1,%cl
+  800d41:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800d44:	39 d8                	cmp    %ebx,%eax
+  800d46:	75 ed                	jne    800d35 <strncpy+0x14>
+	}
+	return ret;
+}
+  800d48:	89 f0                	mov    %esi,%eax
+  800d4a:	5b                   	pop    %ebx
+  800d4b:	5e                   	pop    %esi
+  800d4c:	5d                   	pop    %ebp
+  800d4d:	c3                   	ret
+
+00800d4e <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800d4e:	55                   	push   %ebp
+  800d4f:	89 e5                	mov    %esp,%ebp
+  800d51:	56                   	push   %esi
+  800d52:	53                   	push   %ebx
+  800d53:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d56:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d59:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800d5c:	89 f0                	mov    %esi,%eax
+  800d5e:	85 d2                	test   %edx,%edx
+  800d60:	74 21                	je     800d83 <strlcpy+0x35>
+  800d62:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800d66:	89 f2                	mov    %esi,%edx
+  800d68:	eb 09                	jmp    800d73 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800d6a:	83 c1 01             	add    $0x1,%ecx
+  800d6d:	83 c2 01             	add    $0x1,%edx
+  800d70:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800d73:	39 c2                	cmp    %eax,%edx
+  800d75:	74 09                	je     800d80 <strlcpy+0x32>
+  800d77:	0f b6 19             	movzbl (%ecx),%ebx
+  800d7a:	84 db                	test   %bl,%bl
+  800d7c:	75 ec                	jne    800d6a <strlcpy+0x1c>
+  800d7e:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800d80:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800d83:	29 f0                	sub    %esi,%eax
+}
+  800d85:	5b                   	pop    %ebx
+  800d86:	5e                   	pop    %esi
+  800d87:	5d                   	pop    %ebp
+  800d88:	c3                   	ret
+
+00800d89 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800d89:	55                   	push   %ebp
+  800d8a:	89 e5                	mov    %esp,%ebp
+  800d8c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800d8f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800d92:	eb 06                	jmp    800d9a <strcmp+0x11>
+		p++, q++;
+  800d94:	83 c1 01             	add    $0x1,%ecx
+  800d97:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800d9a:	0f b6 01             	movzbl (%ecx),%eax
+  800d9d:	84 c0                	test   %al,%al
+  800d9f:	74 04                	je     800da5 <strcmp+0x1c>
+  800da1:	3a 02                	cmp    (%edx),%al
+  800da3:	74 ef                	je     800d94 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800da5:	0f b6 c0             	movzbl %al,%eax
+  800da8:	0f b6 12             	movzbl (%edx),%edx
+  800dab:	29 d0                	sub    %edx,%eax
+}
+  800dad:	5d                   	pop    %ebp
+  800dae:	c3                   	ret
+
+00800daf <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800daf:	55                   	push   %ebp
+  800db0:	89 e5                	mov    %esp,%ebp
+  800db2:	53                   	push   %ebx
+  800db3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800db6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800db9:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800dbc:	eb 09                	jmp    800dc7 <strncmp+0x18>
+		n--, p++, q++;
+  800dbe:	83 ea 01             	sub    $0x1,%edx
+  800dc1:	83 c0 01             	add    $0x1,%eax
+  800dc4:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800dc7:	85 d2                	test   %edx,%edx
+  800dc9:	74 18                	je     800de3 <strncmp+0x34>
+  800dcb:	0f b6 18             	movzbl (%eax),%ebx
+  800dce:	84 db                	test   %bl,%bl
+  800dd0:	74 04                	je     800dd6 <strncmp+0x27>
+  800dd2:	3a 19                	cmp    (%ecx),%bl
+  800dd4:	74 e8                	je     800dbe <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800dd6:	0f b6 00             	movzbl (%eax),%eax
+  800dd9:	0f b6 11             	movzbl (%ecx),%edx
+  800ddc:	29 d0                	sub    %edx,%eax
+}
+  800dde:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800de1:	c9                   	leave
+  800de2:	c3                   	ret
+		return 0;
+  800de3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800de8:	eb f4                	jmp    800dde <strncmp+0x2f>
+
+00800dea <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800dea:	55                   	push   %ebp
+  800deb:	89 e5                	mov    %esp,%ebp
+  800ded:	8b 45 08             	mov    0x8(%ebp),%eax
+  800df0:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800df4:	eb 03                	jmp    800df9 <strchr+0xf>
+  800df6:	83 c0 01             	add    $0x1,%eax
+  800df9:	0f b6 10             	movzbl (%eax),%edx
+  800dfc:	84 d2                	test   %dl,%dl
+  800dfe:	74 06                	je     800e06 <strchr+0x1c>
+		if (*s == c)
+  800e00:	38 ca                	cmp    %cl,%dl
+  800e02:	75 f2                	jne    800df6 <strchr+0xc>
+  800e04:	eb 05                	jmp    800e0b <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800e06:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e0b:	5d                   	pop    %ebp
+  800e0c:	c3                   	ret
+
+00800e0d <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800e0d:	55                   	push   %ebp
+  800e0e:	89 e5                	mov    %esp,%ebp
+  800e10:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e13:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800e17:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800e1a:	38 ca                	cmp    %cl,%dl
+  800e1c:	74 09                	je     800e27 <strfind+0x1a>
+  800e1e:	84 d2                	test   %dl,%dl
+  800e20:	74 05                	je     800e27 <strfind+0x1a>
+	for (; *s; s++)
+  800e22:	83 c0 01             	add    $0x1,%eax
+  800e25:	eb f0                	jmp    800e17 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800e27:	5d                   	pop    %ebp
+  800e28:	c3                   	ret
+
+00800e29 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800e29:	55                   	push   %ebp
+  800e2a:	89 e5                	mov    %esp,%ebp
+  800e2c:	57                   	push   %edi
+  800e2d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800e30:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800e33:	85 c9                	test   %ecx,%ecx
+  800e35:	74 20                	je     800e57 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800e37:	89 f8                	mov    %edi,%eax
+  800e39:	09 c8                	or     %ecx,%eax
+  800e3b:	a8 03                	test   $0x3,%al
+  800e3d:	75 12                	jne    800e51 <memset+0x28>
+		c &= 0xFF;
+  800e3f:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800e43:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800e49:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800e4c:	fc                   	cld
+  800e4d:	f3 ab                	rep stos %eax,%es:(%edi)
+  800e4f:	eb 06                	jmp    800e57 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800e51:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e54:	fc                   	cld
+  800e55:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800e57:	89 f8                	mov    %edi,%eax
+  800e59:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800e5c:	c9                   	leave
+  800e5d:	c3                   	ret
+
+00800e5e <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800e5e:	55                   	push   %ebp
+  800e5f:	89 e5                	mov    %esp,%ebp
+  800e61:	57                   	push   %edi
+  800e62:	56                   	push   %esi
+  800e63:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e66:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800e69:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800e6c:	39 c6                	cmp    %eax,%esi
+  800e6e:	73 32                	jae    800ea2 <memmove+0x44>
+  800e70:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800e73:	39 d0                	cmp    %edx,%eax
+  800e75:	73 2b                	jae    800ea2 <memmove+0x44>
+		s += n;
+		d += n;
+  800e77:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800e7a:	89 d6                	mov    %edx,%esi
+  800e7c:	09 fe                	or     %edi,%esi
+  800e7e:	09 ce                	or     %ecx,%esi
+  800e80:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800e86:	75 0e                	jne    800e96 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800e88:	83 ef 04             	sub    $0x4,%edi
+  800e8b:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800e8e:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800e91:	fd                   	std
+  800e92:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800e94:	eb 09                	jmp    800e9f <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800e96:	83 ef 01             	sub    $0x1,%edi
+  800e99:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800e9c:	fd                   	std
+  800e9d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800e9f:	fc                   	cld
+  800ea0:	eb 1a                	jmp    800ebc <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ea2:	89 f2                	mov    %esi,%edx
+  800ea4:	09 c2                	or     %eax,%edx
+  800ea6:	09 ca                	or     %ecx,%edx
+  800ea8:	f6 c2 03             	test   $0x3,%dl
+  800eab:	75 0a                	jne    800eb7 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800ead:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800eb0:	89 c7                	mov    %eax,%edi
+  800eb2:	fc                   	cld
+  800eb3:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800eb5:	eb 05                	jmp    800ebc <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800eb7:	89 c7                	mov    %eax,%edi
+  800eb9:	fc                   	cld
+  800eba:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800ebc:	5e                   	pop    %esi
+  800ebd:	5f                   	pop    %edi
+  800ebe:	5d                   	pop    %ebp
+  800ebf:	c3                   	ret
+
+00800ec0 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800ec0:	55                   	push   %ebp
+  800ec1:	89 e5                	mov    %esp,%ebp
+  800ec3:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800ec6:	ff 75 10             	push   0x10(%ebp)
+  800ec9:	ff 75 0c             	push   0xc(%ebp)
+  800ecc:	ff 75 08             	push   0x8(%ebp)
+  800ecf:	e8 8a ff ff ff       	call   800e5e <memmove>
+}
+  800ed4:	c9                   	leave
+  800ed5:	c3                   	ret
+
+00800ed6 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800ed6:	55                   	push   %ebp
+  800ed7:	89 e5                	mov    %esp,%ebp
+  800ed9:	56                   	push   %esi
+  800eda:	53                   	push   %ebx
+  800edb:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ede:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800ee1:	89 c6                	mov    %eax,%esi
+  800ee3:	03 75 10             	add    0x10(%ebp),%esi
+  800ee6:	eb 06                	jmp    800eee <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800ee8:	83 c0 01             	add    $0x1,%eax
+  800eeb:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800eee:	39 f0                	cmp    %esi,%eax
+  800ef0:	74 14                	je     800f06 <memcmp+0x30>
+		if (*s1 != *s2)
+  800ef2:	0f b6 08             	movzbl (%eax),%ecx
+  800ef5:	0f b6 1a             	movzbl (%edx),%ebx
+  800ef8:	38 d9                	cmp    %bl,%cl
+  800efa:	74 ec                	je     800ee8 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800efc:	0f b6 c1             	movzbl %cl,%eax
+  800eff:	0f b6 db             	movzbl %bl,%ebx
+  800f02:	29 d8                	sub    %ebx,%eax
+  800f04:	eb 05                	jmp    800f0b <memcmp+0x35>
+	}
+
+	return 0;
+  800f06:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f0b:	5b                   	pop    %ebx
+  800f0c:	5e                   	pop    %esi
+  800f0d:	5d                   	pop    %ebp
+  800f0e:	c3                   	ret
+
+00800f0f <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800f0f:	55                   	push   %ebp
+  800f10:	89 e5                	mov    %esp,%ebp
+  800f12:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f15:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800f18:	89 c2                	mov    %eax,%edx
+  800f1a:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800f1d:	eb 03                	jmp    800f22 <memfind+0x13>
+  800f1f:	83 c0 01             	add    $0x1,%eax
+  800f22:	39 d0                	cmp    %edx,%eax
+  800f24:	73 04                	jae    800f2a <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800f26:	38 08                	cmp    %cl,(%eax)
+  800f28:	75 f5                	jne    800f1f <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800f2a:	5d                   	pop    %ebp
+  800f2b:	c3                   	ret
+
+00800f2c <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800f2c:	55                   	push   %ebp
+  800f2d:	89 e5                	mov    %esp,%ebp
+  800f2f:	57                   	push   %edi
+  800f30:	56                   	push   %esi
+  800f31:	53                   	push   %ebx
+  800f32:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f35:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800f38:	eb 03                	jmp    800f3d <strtol+0x11>
+		s++;
+  800f3a:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800f3d:	0f b6 02             	movzbl (%edx),%eax
+  800f40:	3c 20                	cmp    $0x20,%al
+  800f42:	74 f6                	je     800f3a <strtol+0xe>
+  800f44:	3c 09                	cmp    $0x9,%al
+  800f46:	74 f2                	je     800f3a <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800f48:	3c 2b                	cmp    $0x2b,%al
+  800f4a:	74 2a                	je     800f76 <strtol+0x4a>
+	int neg = 0;
+  800f4c:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800f51:	3c 2d                	cmp    $0x2d,%al
+  800f53:	74 2b                	je     800f80 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800f55:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800f5b:	75 0f                	jne    800f6c <strtol+0x40>
+  800f5d:	80 3a 30             	cmpb   $0x30,(%edx)
+  800f60:	74 28                	je     800f8a <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800f62:	85 db                	test   %ebx,%ebx
+  800f64:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f69:	0f 44 d8             	cmove  %eax,%ebx
+  800f6c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f71:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800f74:	eb 46                	jmp    800fbc <strtol+0x90>
+		s++;
+  800f76:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800f79:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f7e:	eb d5                	jmp    800f55 <strtol+0x29>
+		s++, neg = 1;
+  800f80:	83 c2 01             	add    $0x1,%edx
+  800f83:	bf 01 00 00 00       	mov    $0x1,%edi
+  800f88:	eb cb                	jmp    800f55 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800f8a:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800f8e:	74 0e                	je     800f9e <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800f90:	85 db                	test   %ebx,%ebx
+  800f92:	75 d8                	jne    800f6c <strtol+0x40>
+		s++, base = 8;
+  800f94:	83 c2 01             	add    $0x1,%edx
+  800f97:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800f9c:	eb ce                	jmp    800f6c <strtol+0x40>
+		s += 2, base = 16;
+  800f9e:	83 c2 02             	add    $0x2,%edx
+  800fa1:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800fa6:	eb c4                	jmp    800f6c <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800fa8:	0f be c0             	movsbl %al,%eax
+  800fab:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800fae:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800fb1:	7d 3a                	jge    800fed <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800fb3:	83 c2 01             	add    $0x1,%edx
+  800fb6:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800fba:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800fbc:	0f b6 02             	movzbl (%edx),%eax
+  800fbf:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800fc2:	89 f3                	mov    %esi,%ebx
+  800fc4:	80 fb 09             	cmp    $0x9,%bl
+  800fc7:	76 df                	jbe    800fa8 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800fc9:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800fcc:	89 f3                	mov    %esi,%ebx
+  800fce:	80 fb 19             	cmp    $0x19,%bl
+  800fd1:	77 08                	ja     800fdb <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800fd3:	0f be c0             	movsbl %al,%eax
+  800fd6:	83 e8 57             	sub    $0x57,%eax
+  800fd9:	eb d3                	jmp    800fae <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800fdb:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800fde:	89 f3                	mov    %esi,%ebx
+  800fe0:	80 fb 19             	cmp    $0x19,%bl
+  800fe3:	77 08                	ja     800fed <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800fe5:	0f be c0             	movsbl %al,%eax
+  800fe8:	83 e8 37             	sub    $0x37,%eax
+  800feb:	eb c1                	jmp    800fae <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800fed:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800ff1:	74 05                	je     800ff8 <strtol+0xcc>
+		*endptr = (char *) s;
+  800ff3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ff6:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800ff8:	89 c8                	mov    %ecx,%eax
+  800ffa:	f7 d8                	neg    %eax
+  800ffc:	85 ff                	test   %edi,%edi
+  800ffe:	0f 45 c8             	cmovne %eax,%ecx
+}
+  801001:	89 c8                	mov    %ecx,%eax
+  801003:	5b                   	pop    %ebx
+  801004:	5e                   	pop    %esi
+  801005:	5f                   	pop    %edi
+  801006:	5d                   	pop    %ebp
+  801007:	c3                   	ret
+
+00801008 <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801008:	55                   	push   %ebp
+  801009:	89 e5                	mov    %esp,%ebp
+  80100b:	57                   	push   %edi
+  80100c:	56                   	push   %esi
+  80100d:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80100e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801013:	8b 55 08             	mov    0x8(%ebp),%edx
+  801016:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801019:	89 c3                	mov    %eax,%ebx
+  80101b:	89 c7                	mov    %eax,%edi
+  80101d:	89 c6                	mov    %eax,%esi
+  80101f:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  801021:	5b                   	pop    %ebx
+  801022:	5e                   	pop    %esi
+  801023:	5f                   	pop    %edi
+  801024:	5d                   	pop    %ebp
+  801025:	c3                   	ret
+
+00801026 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801026:	55                   	push   %ebp
+  801027:	89 e5                	mov    %esp,%ebp
+  801029:	57                   	push   %edi
+  80102a:	56                   	push   %esi
+  80102b:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80102c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801031:	b8 01 00 00 00       	mov    $0x1,%eax
+  801036:	89 d1                	mov    %edx,%ecx
+  801038:	89 d3                	mov    %edx,%ebx
+  80103a:	89 d7                	mov    %edx,%edi
+  80103c:	89 d6                	mov    %edx,%esi
+  80103e:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  801040:	5b                   	pop    %ebx
+  801041:	5e                   	pop    %esi
+  801042:	5f                   	pop    %edi
+  801043:	5d                   	pop    %ebp
+  801044:	c3                   	ret
+
+00801045 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801045:	55                   	push   %ebp
+  801046:	89 e5                	mov    %esp,%ebp
+  801048:	57                   	push   %edi
+  801049:	56                   	push   %esi
+  80104a:	53                   	push   %ebx
+  80104b:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  80104e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801053:	8b 55 08             	mov    0x8(%ebp),%edx
+  801056:	b8 03 00 00 00       	mov    $0x3,%eax
+  80105b:	89 cb                	mov    %ecx,%ebx
+  80105d:	89 cf                	mov    %ecx,%edi
+  80105f:	89 ce                	mov    %ecx,%esi
+  801061:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801063:	85 c0                	test   %eax,%eax
+  801065:	7f 08                	jg     80106f <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  801067:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80106a:	5b                   	pop    %ebx
+  80106b:	5e                   	pop    %esi
+  80106c:	5f                   	pop    %edi
+  80106d:	5d                   	pop    %ebp
+  80106e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80106f:	83 ec 0c             	sub    $0xc,%esp
+  801072:	50                   	push   %eax
+  801073:	6a 03                	push   $0x3
+  801075:	68 63 2f 80 00       	push   $0x802f63
+  80107a:	6a 3e                	push   $0x3e
+  80107c:	68 80 2f 80 00       	push   $0x802f80
+  801081:	e8 be f5 ff ff       	call   800644 <_panic>
+
+00801086 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801086:	55                   	push   %ebp
+  801087:	89 e5                	mov    %esp,%ebp
+  801089:	57                   	push   %edi
+  80108a:	56                   	push   %esi
+  80108b:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80108c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801091:	b8 02 00 00 00       	mov    $0x2,%eax
+  801096:	89 d1                	mov    %edx,%ecx
+  801098:	89 d3                	mov    %edx,%ebx
+  80109a:	89 d7                	mov    %edx,%edi
+  80109c:	89 d6                	mov    %edx,%esi
+  80109e:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  8010a0:	5b                   	pop    %ebx
+  8010a1:	5e                   	pop    %esi
+  8010a2:	5f                   	pop    %edi
+  8010a3:	5d                   	pop    %ebp
+  8010a4:	c3                   	ret
+
+008010a5 <sys_yield>:
+
+void
+sys_yield(void) {
+  8010a5:	55                   	push   %ebp
+  8010a6:	89 e5                	mov    %esp,%ebp
+  8010a8:	57                   	push   %edi
+  8010a9:	56                   	push   %esi
+  8010aa:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8010ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010b0:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8010b5:	89 d1                	mov    %edx,%ecx
+  8010b7:	89 d3                	mov    %edx,%ebx
+  8010b9:	89 d7                	mov    %edx,%edi
+  8010bb:	89 d6                	mov    %edx,%esi
+  8010bd:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  8010bf:	5b                   	pop    %ebx
+  8010c0:	5e                   	pop    %esi
+  8010c1:	5f                   	pop    %edi
+  8010c2:	5d                   	pop    %ebp
+  8010c3:	c3                   	ret
+
+008010c4 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  8010c4:	55                   	push   %ebp
+  8010c5:	89 e5                	mov    %esp,%ebp
+  8010c7:	57                   	push   %edi
+  8010c8:	56                   	push   %esi
+  8010c9:	53                   	push   %ebx
+  8010ca:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8010cd:	be 00 00 00 00       	mov    $0x0,%esi
+  8010d2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010d8:	b8 04 00 00 00       	mov    $0x4,%eax
+  8010dd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010e0:	89 f7                	mov    %esi,%edi
+  8010e2:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8010e4:	85 c0                	test   %eax,%eax
+  8010e6:	7f 08                	jg     8010f0 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  8010e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010eb:	5b                   	pop    %ebx
+  8010ec:	5e                   	pop    %esi
+  8010ed:	5f                   	pop    %edi
+  8010ee:	5d                   	pop    %ebp
+  8010ef:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8010f0:	83 ec 0c             	sub    $0xc,%esp
+  8010f3:	50                   	push   %eax
+  8010f4:	6a 04                	push   $0x4
+  8010f6:	68 63 2f 80 00       	push   $0x802f63
+  8010fb:	6a 3e                	push   $0x3e
+  8010fd:	68 80 2f 80 00       	push   $0x802f80
+  801102:	e8 3d f5 ff ff       	call   800644 <_panic>
+
+00801107 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  801107:	55                   	push   %ebp
+  801108:	89 e5                	mov    %esp,%ebp
+  80110a:	57                   	push   %edi
+  80110b:	56                   	push   %esi
+  80110c:	53                   	push   %ebx
+  80110d:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  801110:	8b 55 08             	mov    0x8(%ebp),%edx
+  801113:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801116:	b8 05 00 00 00       	mov    $0x5,%eax
+  80111b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80111e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801121:	8b 75 18             	mov    0x18(%ebp),%esi
+  801124:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801126:	85 c0                	test   %eax,%eax
+  801128:	7f 08                	jg     801132 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  80112a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80112d:	5b                   	pop    %ebx
+  80112e:	5e                   	pop    %esi
+  80112f:	5f                   	pop    %edi
+  801130:	5d                   	pop    %ebp
+  801131:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801132:	83 ec 0c             	sub    $0xc,%esp
+  801135:	50                   	push   %eax
+  801136:	6a 05                	push   $0x5
+  801138:	68 63 2f 80 00       	push   $0x802f63
+  80113d:	6a 3e                	push   $0x3e
+  80113f:	68 80 2f 80 00       	push   $0x802f80
+  801144:	e8 fb f4 ff ff       	call   800644 <_panic>
+
+00801149 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  801149:	55                   	push   %ebp
+  80114a:	89 e5                	mov    %esp,%ebp
+  80114c:	57                   	push   %edi
+  80114d:	56                   	push   %esi
+  80114e:	53                   	push   %ebx
+  80114f:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  801152:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801157:	8b 55 08             	mov    0x8(%ebp),%edx
+  80115a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80115d:	b8 06 00 00 00       	mov    $0x6,%eax
+  801162:	89 df                	mov    %ebx,%edi
+  801164:	89 de                	mov    %ebx,%esi
+  801166:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801168:	85 c0                	test   %eax,%eax
+  80116a:	7f 08                	jg     801174 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  80116c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80116f:	5b                   	pop    %ebx
+  801170:	5e                   	pop    %esi
+  801171:	5f                   	pop    %edi
+  801172:	5d                   	pop    %ebp
+  801173:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801174:	83 ec 0c             	sub    $0xc,%esp
+  801177:	50                   	push   %eax
+  801178:	6a 06                	push   $0x6
+  80117a:	68 63 2f 80 00       	push   $0x802f63
+  80117f:	6a 3e                	push   $0x3e
+  801181:	68 80 2f 80 00       	push   $0x802f80
+  801186:	e8 b9 f4 ff ff       	call   800644 <_panic>
+
+0080118b <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80118b:	55                   	push   %ebp
+  80118c:	89 e5                	mov    %esp,%ebp
+  80118e:	57                   	push   %edi
+  80118f:	56                   	push   %esi
+  801190:	53                   	push   %ebx
+  801191:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  801194:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801199:	8b 55 08             	mov    0x8(%ebp),%edx
+  80119c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80119f:	b8 08 00 00 00       	mov    $0x8,%eax
+  8011a4:	89 df                	mov    %ebx,%edi
+  8011a6:	89 de                	mov    %ebx,%esi
+  8011a8:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8011aa:	85 c0                	test   %eax,%eax
+  8011ac:	7f 08                	jg     8011b6 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8011ae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011b1:	5b                   	pop    %ebx
+  8011b2:	5e                   	pop    %esi
+  8011b3:	5f                   	pop    %edi
+  8011b4:	5d                   	pop    %ebp
+  8011b5:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8011b6:	83 ec 0c             	sub    $0xc,%esp
+  8011b9:	50                   	push   %eax
+  8011ba:	6a 08                	push   $0x8
+  8011bc:	68 63 2f 80 00       	push   $0x802f63
+  8011c1:	6a 3e                	push   $0x3e
+  8011c3:	68 80 2f 80 00       	push   $0x802f80
+  8011c8:	e8 77 f4 ff ff       	call   800644 <_panic>
+
+008011cd <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8011cd:	55                   	push   %ebp
+  8011ce:	89 e5                	mov    %esp,%ebp
+  8011d0:	57                   	push   %edi
+  8011d1:	56                   	push   %esi
+  8011d2:	53                   	push   %ebx
+  8011d3:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8011d6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011db:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011de:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011e1:	b8 09 00 00 00       	mov    $0x9,%eax
+  8011e6:	89 df                	mov    %ebx,%edi
+  8011e8:	89 de                	mov    %ebx,%esi
+  8011ea:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8011ec:	85 c0                	test   %eax,%eax
+  8011ee:	7f 08                	jg     8011f8 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8011f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011f3:	5b                   	pop    %ebx
+  8011f4:	5e                   	pop    %esi
+  8011f5:	5f                   	pop    %edi
+  8011f6:	5d                   	pop    %ebp
+  8011f7:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8011f8:	83 ec 0c             	sub    $0xc,%esp
+  8011fb:	50                   	push   %eax
+  8011fc:	6a 09                	push   $0x9
+  8011fe:	68 63 2f 80 00       	push   $0x802f63
+  801203:	6a 3e                	push   $0x3e
+  801205:	68 80 2f 80 00       	push   $0x802f80
+  80120a:	e8 35 f4 ff ff       	call   800644 <_panic>
+
+0080120f <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80120f:	55                   	push   %ebp
+  801210:	89 e5                	mov    %esp,%ebp
+  801212:	57                   	push   %edi
+  801213:	56                   	push   %esi
+  801214:	53                   	push   %ebx
+  801215:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  801218:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80121d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801220:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801223:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801228:	89 df                	mov    %ebx,%edi
+  80122a:	89 de                	mov    %ebx,%esi
+  80122c:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80122e:	85 c0                	test   %eax,%eax
+  801230:	7f 08                	jg     80123a <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801232:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801235:	5b                   	pop    %ebx
+  801236:	5e                   	pop    %esi
+  801237:	5f                   	pop    %edi
+  801238:	5d                   	pop    %ebp
+  801239:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80123a:	83 ec 0c             	sub    $0xc,%esp
+  80123d:	50                   	push   %eax
+  80123e:	6a 0a                	push   $0xa
+  801240:	68 63 2f 80 00       	push   $0x802f63
+  801245:	6a 3e                	push   $0x3e
+  801247:	68 80 2f 80 00       	push   $0x802f80
+  80124c:	e8 f3 f3 ff ff       	call   800644 <_panic>
+
+00801251 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  801251:	55                   	push   %ebp
+  801252:	89 e5                	mov    %esp,%ebp
+  801254:	57                   	push   %edi
+  801255:	56                   	push   %esi
+  801256:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  801257:	8b 55 08             	mov    0x8(%ebp),%edx
+  80125a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80125d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801262:	be 00 00 00 00       	mov    $0x0,%esi
+  801267:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80126a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80126d:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  80126f:	5b                   	pop    %ebx
+  801270:	5e                   	pop    %esi
+  801271:	5f                   	pop    %edi
+  801272:	5d                   	pop    %ebp
+  801273:	c3                   	ret
+
+00801274 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  801274:	55                   	push   %ebp
+  801275:	89 e5                	mov    %esp,%ebp
+  801277:	57                   	push   %edi
+  801278:	56                   	push   %esi
+  801279:	53                   	push   %ebx
+  80127a:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  80127d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801282:	8b 55 08             	mov    0x8(%ebp),%edx
+  801285:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80128a:	89 cb                	mov    %ecx,%ebx
+  80128c:	89 cf                	mov    %ecx,%edi
+  80128e:	89 ce                	mov    %ecx,%esi
+  801290:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801292:	85 c0                	test   %eax,%eax
+  801294:	7f 08                	jg     80129e <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  801296:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801299:	5b                   	pop    %ebx
+  80129a:	5e                   	pop    %esi
+  80129b:	5f                   	pop    %edi
+  80129c:	5d                   	pop    %ebp
+  80129d:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80129e:	83 ec 0c             	sub    $0xc,%esp
+  8012a1:	50                   	push   %eax
+  8012a2:	6a 0d                	push   $0xd
+  8012a4:	68 63 2f 80 00       	push   $0x802f63
+  8012a9:	6a 3e                	push   $0x3e
+  8012ab:	68 80 2f 80 00       	push   $0x802f80
+  8012b0:	e8 8f f3 ff ff       	call   800644 <_panic>
+
+008012b5 <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  8012b5:	55                   	push   %ebp
+  8012b6:	89 e5                	mov    %esp,%ebp
+  8012b8:	57                   	push   %edi
+  8012b9:	56                   	push   %esi
+  8012ba:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8012bb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012c3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012c6:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8012cb:	89 df                	mov    %ebx,%edi
+  8012cd:	89 de                	mov    %ebx,%esi
+  8012cf:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  8012d1:	5b                   	pop    %ebx
+  8012d2:	5e                   	pop    %esi
+  8012d3:	5f                   	pop    %edi
+  8012d4:	5d                   	pop    %ebp
+  8012d5:	c3                   	ret
+
+008012d6 <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  8012d6:	55                   	push   %ebp
+  8012d7:	89 e5                	mov    %esp,%ebp
+  8012d9:	57                   	push   %edi
+  8012da:	56                   	push   %esi
+  8012db:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8012dc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012e1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012e4:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8012e9:	89 cb                	mov    %ecx,%ebx
+  8012eb:	89 cf                	mov    %ecx,%edi
+  8012ed:	89 ce                	mov    %ecx,%esi
+  8012ef:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  8012f1:	5b                   	pop    %ebx
+  8012f2:	5e                   	pop    %esi
+  8012f3:	5f                   	pop    %edi
+  8012f4:	5d                   	pop    %ebp
+  8012f5:	c3                   	ret
+
+008012f6 <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  8012f6:	55                   	push   %ebp
+  8012f7:	89 e5                	mov    %esp,%ebp
+  8012f9:	57                   	push   %edi
+  8012fa:	56                   	push   %esi
+  8012fb:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8012fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801301:	b8 10 00 00 00       	mov    $0x10,%eax
+  801306:	89 d1                	mov    %edx,%ecx
+  801308:	89 d3                	mov    %edx,%ebx
+  80130a:	89 d7                	mov    %edx,%edi
+  80130c:	89 d6                	mov    %edx,%esi
+  80130e:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801310:	5b                   	pop    %ebx
+  801311:	5e                   	pop    %esi
+  801312:	5f                   	pop    %edi
+  801313:	5d                   	pop    %ebp
+  801314:	c3                   	ret
+
+00801315 <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  801315:	55                   	push   %ebp
+  801316:	89 e5                	mov    %esp,%ebp
+  801318:	57                   	push   %edi
+  801319:	56                   	push   %esi
+  80131a:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80131b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801320:	8b 55 08             	mov    0x8(%ebp),%edx
+  801323:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801326:	b8 11 00 00 00       	mov    $0x11,%eax
+  80132b:	89 df                	mov    %ebx,%edi
+  80132d:	89 de                	mov    %ebx,%esi
+  80132f:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  801331:	5b                   	pop    %ebx
+  801332:	5e                   	pop    %esi
+  801333:	5f                   	pop    %edi
+  801334:	5d                   	pop    %ebp
+  801335:	c3                   	ret
+
+00801336 <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  801336:	55                   	push   %ebp
+  801337:	89 e5                	mov    %esp,%ebp
+  801339:	57                   	push   %edi
+  80133a:	56                   	push   %esi
+  80133b:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80133c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801341:	8b 55 08             	mov    0x8(%ebp),%edx
+  801344:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801347:	b8 12 00 00 00       	mov    $0x12,%eax
+  80134c:	89 df                	mov    %ebx,%edi
+  80134e:	89 de                	mov    %ebx,%esi
+  801350:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  801352:	5b                   	pop    %ebx
+  801353:	5e                   	pop    %esi
+  801354:	5f                   	pop    %edi
+  801355:	5d                   	pop    %ebp
+  801356:	c3                   	ret
+
+00801357 <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  801357:	55                   	push   %ebp
+  801358:	89 e5                	mov    %esp,%ebp
+  80135a:	57                   	push   %edi
+  80135b:	56                   	push   %esi
+  80135c:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80135d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801362:	8b 55 08             	mov    0x8(%ebp),%edx
+  801365:	b8 13 00 00 00       	mov    $0x13,%eax
+  80136a:	89 cb                	mov    %ecx,%ebx
+  80136c:	89 cf                	mov    %ecx,%edi
+  80136e:	89 ce                	mov    %ecx,%esi
+  801370:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  801372:	5b                   	pop    %ebx
+  801373:	5e                   	pop    %esi
+  801374:	5f                   	pop    %edi
+  801375:	5d                   	pop    %ebp
+  801376:	c3                   	ret
+
+00801377 <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  801377:	55                   	push   %ebp
+  801378:	89 e5                	mov    %esp,%ebp
+  80137a:	57                   	push   %edi
+  80137b:	56                   	push   %esi
+  80137c:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80137d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801382:	8b 55 08             	mov    0x8(%ebp),%edx
+  801385:	b8 14 00 00 00       	mov    $0x14,%eax
+  80138a:	89 cb                	mov    %ecx,%ebx
+  80138c:	89 cf                	mov    %ecx,%edi
+  80138e:	89 ce                	mov    %ecx,%esi
+  801390:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  801392:	5b                   	pop    %ebx
+  801393:	5e                   	pop    %esi
+  801394:	5f                   	pop    %edi
+  801395:	5d                   	pop    %ebp
+  801396:	c3                   	ret
+
+00801397 <set_pgfault_handler>:
+// allocate an exception stack (one page of memory with its top
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf)) {
+  801397:	55                   	push   %ebp
+  801398:	89 e5                	mov    %esp,%ebp
+  80139a:	83 ec 08             	sub    $0x8,%esp
+  int r;
+
+  if (_pgfault_handler == 0) {
+  80139d:	83 3d b8 50 80 00 00 	cmpl   $0x0,0x8050b8
+  8013a4:	74 0a                	je     8013b0 <set_pgfault_handler+0x19>
+    if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)))
+      panic(" set_pgfault_handler sys_env_set_pgfault_upcall panic: %e\n", r);
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  8013a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013a9:	a3 b8 50 80 00       	mov    %eax,0x8050b8
+
+
+}
+  8013ae:	c9                   	leave
+  8013af:	c3                   	ret
+    if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)))
+  8013b0:	83 ec 04             	sub    $0x4,%esp
+  8013b3:	6a 07                	push   $0x7
+  8013b5:	68 00 f0 bf ee       	push   $0xeebff000
+  8013ba:	6a 00                	push   $0x0
+  8013bc:	e8 03 fd ff ff       	call   8010c4 <sys_page_alloc>
+  8013c1:	83 c4 10             	add    $0x10,%esp
+  8013c4:	85 c0                	test   %eax,%eax
+  8013c6:	75 28                	jne    8013f0 <set_pgfault_handler+0x59>
+    if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)))
+  8013c8:	83 ec 08             	sub    $0x8,%esp
+  8013cb:	68 02 14 80 00       	push   $0x801402
+  8013d0:	6a 00                	push   $0x0
+  8013d2:	e8 38 fe ff ff       	call   80120f <sys_env_set_pgfault_upcall>
+  8013d7:	83 c4 10             	add    $0x10,%esp
+  8013da:	85 c0                	test   %eax,%eax
+  8013dc:	74 c8                	je     8013a6 <set_pgfault_handler+0xf>
+      panic(" set_pgfault_handler sys_env_set_pgfault_upcall panic: %e\n", r);
+  8013de:	50                   	push   %eax
+  8013df:	68 c0 2f 80 00       	push   $0x802fc0
+  8013e4:	6a 22                	push   $0x22
+  8013e6:	68 fb 2f 80 00       	push   $0x802ffb
+  8013eb:	e8 54 f2 ff ff       	call   800644 <_panic>
+      panic("set_pgfault_handler sys_page_alloc panic: %e\n", r);
+  8013f0:	50                   	push   %eax
+  8013f1:	68 90 2f 80 00       	push   $0x802f90
+  8013f6:	6a 20                	push   $0x20
+  8013f8:	68 fb 2f 80 00       	push   $0x802ffb
+  8013fd:	e8 42 f2 ff ff       	call   800644 <_panic>
+
+00801402 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  801402:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  801403:	a1 b8 50 80 00       	mov    0x8050b8,%eax
+	call *%eax
+  801408:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80140a:	83 c4 04             	add    $0x4,%esp
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	// push the trap-time %eip onto the trap-time stack
+    subl $0x4, 0x30(%esp) # for push eip
+  80140d:	83 6c 24 30 04       	subl   $0x4,0x30(%esp)
+    movl 0x30(%esp), %ebx #regular esp
+  801412:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+    movl 0x28(%esp), %eax #eip
+  801416:	8b 44 24 28          	mov    0x28(%esp),%eax
+    movl %eax, (%ebx)
+  80141a:	89 03                	mov    %eax,(%ebx)
+
+    // Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+    addl $8, %esp
+  80141c:	83 c4 08             	add    $0x8,%esp
+    popal
+  80141f:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  801420:	83 c4 04             	add    $0x4,%esp
+	popfl
+  801423:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  801424:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  801425:	c3                   	ret
+
+00801426 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801426:	55                   	push   %ebp
+  801427:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801429:	8b 45 08             	mov    0x8(%ebp),%eax
+  80142c:	05 00 00 00 30       	add    $0x30000000,%eax
+  801431:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801434:	5d                   	pop    %ebp
+  801435:	c3                   	ret
+
+00801436 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801436:	55                   	push   %ebp
+  801437:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801439:	8b 45 08             	mov    0x8(%ebp),%eax
+  80143c:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801441:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801446:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80144b:	5d                   	pop    %ebp
+  80144c:	c3                   	ret
+
+0080144d <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80144d:	55                   	push   %ebp
+  80144e:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801450:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801455:	eb 02                	jmp    801459 <fd_alloc+0xc>
+  801457:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801459:	89 c2                	mov    %eax,%edx
+  80145b:	c1 ea 16             	shr    $0x16,%edx
+  80145e:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801465:	f6 c2 01             	test   $0x1,%dl
+  801468:	74 2b                	je     801495 <fd_alloc+0x48>
+  80146a:	89 c2                	mov    %eax,%edx
+  80146c:	c1 ea 0c             	shr    $0xc,%edx
+  80146f:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801476:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80147c:	f6 c1 01             	test   $0x1,%cl
+  80147f:	74 14                	je     801495 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801481:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801487:	75 ce                	jne    801457 <fd_alloc+0xa>
+  801489:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80148e:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801493:	eb 05                	jmp    80149a <fd_alloc+0x4d>
+			return 0;
+  801495:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80149a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80149d:	89 02                	mov    %eax,(%edx)
+}
+  80149f:	89 c8                	mov    %ecx,%eax
+  8014a1:	5d                   	pop    %ebp
+  8014a2:	c3                   	ret
+
+008014a3 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8014a3:	55                   	push   %ebp
+  8014a4:	89 e5                	mov    %esp,%ebp
+  8014a6:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8014a9:	83 f8 1f             	cmp    $0x1f,%eax
+  8014ac:	77 30                	ja     8014de <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8014ae:	c1 e0 0c             	shl    $0xc,%eax
+  8014b1:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8014b6:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8014bc:	f6 c2 01             	test   $0x1,%dl
+  8014bf:	74 24                	je     8014e5 <fd_lookup+0x42>
+  8014c1:	89 c2                	mov    %eax,%edx
+  8014c3:	c1 ea 0c             	shr    $0xc,%edx
+  8014c6:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8014cd:	f6 c2 01             	test   $0x1,%dl
+  8014d0:	74 1a                	je     8014ec <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8014d2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8014d5:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8014d7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8014dc:	5d                   	pop    %ebp
+  8014dd:	c3                   	ret
+		return -E_INVAL;
+  8014de:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014e3:	eb f7                	jmp    8014dc <fd_lookup+0x39>
+		return -E_INVAL;
+  8014e5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014ea:	eb f0                	jmp    8014dc <fd_lookup+0x39>
+  8014ec:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014f1:	eb e9                	jmp    8014dc <fd_lookup+0x39>
+
+008014f3 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8014f3:	55                   	push   %ebp
+  8014f4:	89 e5                	mov    %esp,%ebp
+  8014f6:	53                   	push   %ebx
+  8014f7:	83 ec 04             	sub    $0x4,%esp
+  8014fa:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8014fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801502:	eb 03                	jmp    801507 <dev_lookup+0x14>
+  801504:	83 c0 01             	add    $0x1,%eax
+  801507:	8b 1c 85 88 30 80 00 	mov    0x803088(,%eax,4),%ebx
+  80150e:	85 db                	test   %ebx,%ebx
+  801510:	74 0b                	je     80151d <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801512:	39 13                	cmp    %edx,(%ebx)
+  801514:	75 ee                	jne    801504 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801516:	b8 00 00 00 00       	mov    $0x0,%eax
+  80151b:	eb 1f                	jmp    80153c <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80151d:	a1 b4 50 80 00       	mov    0x8050b4,%eax
+  801522:	8b 40 48             	mov    0x48(%eax),%eax
+  801525:	83 ec 04             	sub    $0x4,%esp
+  801528:	52                   	push   %edx
+  801529:	50                   	push   %eax
+  80152a:	68 0c 30 80 00       	push   $0x80300c
+  80152f:	e8 eb f1 ff ff       	call   80071f <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801534:	83 c4 10             	add    $0x10,%esp
+  801537:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80153c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80153f:	89 1a                	mov    %ebx,(%edx)
+}
+  801541:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801544:	c9                   	leave
+  801545:	c3                   	ret
+
+00801546 <fd_close>:
+{
+  801546:	55                   	push   %ebp
+  801547:	89 e5                	mov    %esp,%ebp
+  801549:	57                   	push   %edi
+  80154a:	56                   	push   %esi
+  80154b:	53                   	push   %ebx
+  80154c:	83 ec 24             	sub    $0x24,%esp
+  80154f:	8b 75 08             	mov    0x8(%ebp),%esi
+  801552:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801555:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801558:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801559:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80155f:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801562:	50                   	push   %eax
+  801563:	e8 3b ff ff ff       	call   8014a3 <fd_lookup>
+  801568:	89 c3                	mov    %eax,%ebx
+  80156a:	83 c4 10             	add    $0x10,%esp
+  80156d:	85 c0                	test   %eax,%eax
+  80156f:	78 05                	js     801576 <fd_close+0x30>
+	    || fd != fd2)
+  801571:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801574:	74 16                	je     80158c <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801576:	89 f8                	mov    %edi,%eax
+  801578:	84 c0                	test   %al,%al
+  80157a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80157f:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801582:	89 d8                	mov    %ebx,%eax
+  801584:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801587:	5b                   	pop    %ebx
+  801588:	5e                   	pop    %esi
+  801589:	5f                   	pop    %edi
+  80158a:	5d                   	pop    %ebp
+  80158b:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80158c:	83 ec 08             	sub    $0x8,%esp
+  80158f:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801592:	50                   	push   %eax
+  801593:	ff 36                	push   (%esi)
+  801595:	e8 59 ff ff ff       	call   8014f3 <dev_lookup>
+  80159a:	89 c3                	mov    %eax,%ebx
+  80159c:	83 c4 10             	add    $0x10,%esp
+  80159f:	85 c0                	test   %eax,%eax
+  8015a1:	78 1a                	js     8015bd <fd_close+0x77>
+		if (dev->dev_close)
+  8015a3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8015a6:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8015a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8015ae:	85 c0                	test   %eax,%eax
+  8015b0:	74 0b                	je     8015bd <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8015b2:	83 ec 0c             	sub    $0xc,%esp
+  8015b5:	56                   	push   %esi
+  8015b6:	ff d0                	call   *%eax
+  8015b8:	89 c3                	mov    %eax,%ebx
+  8015ba:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8015bd:	83 ec 08             	sub    $0x8,%esp
+  8015c0:	56                   	push   %esi
+  8015c1:	6a 00                	push   $0x0
+  8015c3:	e8 81 fb ff ff       	call   801149 <sys_page_unmap>
+	return r;
+  8015c8:	83 c4 10             	add    $0x10,%esp
+  8015cb:	eb b5                	jmp    801582 <fd_close+0x3c>
+
+008015cd <close>:
+
+int
+close(int fdnum)
+{
+  8015cd:	55                   	push   %ebp
+  8015ce:	89 e5                	mov    %esp,%ebp
+  8015d0:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8015d3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015d6:	50                   	push   %eax
+  8015d7:	ff 75 08             	push   0x8(%ebp)
+  8015da:	e8 c4 fe ff ff       	call   8014a3 <fd_lookup>
+  8015df:	83 c4 10             	add    $0x10,%esp
+  8015e2:	85 c0                	test   %eax,%eax
+  8015e4:	79 02                	jns    8015e8 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8015e6:	c9                   	leave
+  8015e7:	c3                   	ret
+		return fd_close(fd, 1);
+  8015e8:	83 ec 08             	sub    $0x8,%esp
+  8015eb:	6a 01                	push   $0x1
+  8015ed:	ff 75 f4             	push   -0xc(%ebp)
+  8015f0:	e8 51 ff ff ff       	call   801546 <fd_close>
+  8015f5:	83 c4 10             	add    $0x10,%esp
+  8015f8:	eb ec                	jmp    8015e6 <close+0x19>
+
+008015fa <close_all>:
+
+void
+close_all(void)
+{
+  8015fa:	55                   	push   %ebp
+  8015fb:	89 e5                	mov    %esp,%ebp
+  8015fd:	53                   	push   %ebx
+  8015fe:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801601:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801606:	83 ec 0c             	sub    $0xc,%esp
+  801609:	53                   	push   %ebx
+  80160a:	e8 be ff ff ff       	call   8015cd <close>
+	for (i = 0; i < MAXFD; i++)
+  80160f:	83 c3 01             	add    $0x1,%ebx
+  801612:	83 c4 10             	add    $0x10,%esp
+  801615:	83 fb 20             	cmp    $0x20,%ebx
+  801618:	75 ec                	jne    801606 <close_all+0xc>
+}
+  80161a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80161d:	c9                   	leave
+  80161e:	c3                   	ret
+
+0080161f <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80161f:	55                   	push   %ebp
+  801620:	89 e5                	mov    %esp,%ebp
+  801622:	57                   	push   %edi
+  801623:	56                   	push   %esi
+  801624:	53                   	push   %ebx
+  801625:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801628:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80162b:	50                   	push   %eax
+  80162c:	ff 75 08             	push   0x8(%ebp)
+  80162f:	e8 6f fe ff ff       	call   8014a3 <fd_lookup>
+  801634:	89 c3                	mov    %eax,%ebx
+  801636:	83 c4 10             	add    $0x10,%esp
+  801639:	85 c0                	test   %eax,%eax
+  80163b:	78 7f                	js     8016bc <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80163d:	83 ec 0c             	sub    $0xc,%esp
+  801640:	ff 75 0c             	push   0xc(%ebp)
+  801643:	e8 85 ff ff ff       	call   8015cd <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801648:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80164b:	c1 e6 0c             	shl    $0xc,%esi
+  80164e:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801654:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801657:	89 3c 24             	mov    %edi,(%esp)
+  80165a:	e8 d7 fd ff ff       	call   801436 <fd2data>
+  80165f:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801661:	89 34 24             	mov    %esi,(%esp)
+  801664:	e8 cd fd ff ff       	call   801436 <fd2data>
+  801669:	83 c4 10             	add    $0x10,%esp
+  80166c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80166f:	89 d8                	mov    %ebx,%eax
+  801671:	c1 e8 16             	shr    $0x16,%eax
+  801674:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80167b:	a8 01                	test   $0x1,%al
+  80167d:	74 11                	je     801690 <dup+0x71>
+  80167f:	89 d8                	mov    %ebx,%eax
+  801681:	c1 e8 0c             	shr    $0xc,%eax
+  801684:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80168b:	f6 c2 01             	test   $0x1,%dl
+  80168e:	75 36                	jne    8016c6 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801690:	89 f8                	mov    %edi,%eax
+  801692:	c1 e8 0c             	shr    $0xc,%eax
+  801695:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80169c:	83 ec 0c             	sub    $0xc,%esp
+  80169f:	25 07 0e 00 00       	and    $0xe07,%eax
+  8016a4:	50                   	push   %eax
+  8016a5:	56                   	push   %esi
+  8016a6:	6a 00                	push   $0x0
+  8016a8:	57                   	push   %edi
+  8016a9:	6a 00                	push   $0x0
+  8016ab:	e8 57 fa ff ff       	call   801107 <sys_page_map>
+  8016b0:	89 c3                	mov    %eax,%ebx
+  8016b2:	83 c4 20             	add    $0x20,%esp
+  8016b5:	85 c0                	test   %eax,%eax
+  8016b7:	78 33                	js     8016ec <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8016b9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8016bc:	89 d8                	mov    %ebx,%eax
+  8016be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016c1:	5b                   	pop    %ebx
+  8016c2:	5e                   	pop    %esi
+  8016c3:	5f                   	pop    %edi
+  8016c4:	5d                   	pop    %ebp
+  8016c5:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8016c6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8016cd:	83 ec 0c             	sub    $0xc,%esp
+  8016d0:	25 07 0e 00 00       	and    $0xe07,%eax
+  8016d5:	50                   	push   %eax
+  8016d6:	ff 75 d4             	push   -0x2c(%ebp)
+  8016d9:	6a 00                	push   $0x0
+  8016db:	53                   	push   %ebx
+  8016dc:	6a 00                	push   $0x0
+  8016de:	e8 24 fa ff ff       	call   801107 <sys_page_map>
+  8016e3:	89 c3                	mov    %eax,%ebx
+  8016e5:	83 c4 20             	add    $0x20,%esp
+  8016e8:	85 c0                	test   %eax,%eax
+  8016ea:	79 a4                	jns    801690 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8016ec:	83 ec 08             	sub    $0x8,%esp
+  8016ef:	56                   	push   %esi
+  8016f0:	6a 00                	push   $0x0
+  8016f2:	e8 52 fa ff ff       	call   801149 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8016f7:	83 c4 08             	add    $0x8,%esp
+  8016fa:	ff 75 d4             	push   -0x2c(%ebp)
+  8016fd:	6a 00                	push   $0x0
+  8016ff:	e8 45 fa ff ff       	call   801149 <sys_page_unmap>
+	return r;
+  801704:	83 c4 10             	add    $0x10,%esp
+  801707:	eb b3                	jmp    8016bc <dup+0x9d>
+
+00801709 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801709:	55                   	push   %ebp
+  80170a:	89 e5                	mov    %esp,%ebp
+  80170c:	56                   	push   %esi
+  80170d:	53                   	push   %ebx
+  80170e:	83 ec 18             	sub    $0x18,%esp
+  801711:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801714:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801717:	50                   	push   %eax
+  801718:	56                   	push   %esi
+  801719:	e8 85 fd ff ff       	call   8014a3 <fd_lookup>
+  80171e:	83 c4 10             	add    $0x10,%esp
+  801721:	85 c0                	test   %eax,%eax
+  801723:	78 3c                	js     801761 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801725:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801728:	83 ec 08             	sub    $0x8,%esp
+  80172b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80172e:	50                   	push   %eax
+  80172f:	ff 33                	push   (%ebx)
+  801731:	e8 bd fd ff ff       	call   8014f3 <dev_lookup>
+  801736:	83 c4 10             	add    $0x10,%esp
+  801739:	85 c0                	test   %eax,%eax
+  80173b:	78 24                	js     801761 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80173d:	8b 43 08             	mov    0x8(%ebx),%eax
+  801740:	83 e0 03             	and    $0x3,%eax
+  801743:	83 f8 01             	cmp    $0x1,%eax
+  801746:	74 20                	je     801768 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801748:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80174b:	8b 40 08             	mov    0x8(%eax),%eax
+  80174e:	85 c0                	test   %eax,%eax
+  801750:	74 37                	je     801789 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801752:	83 ec 04             	sub    $0x4,%esp
+  801755:	ff 75 10             	push   0x10(%ebp)
+  801758:	ff 75 0c             	push   0xc(%ebp)
+  80175b:	53                   	push   %ebx
+  80175c:	ff d0                	call   *%eax
+  80175e:	83 c4 10             	add    $0x10,%esp
+}
+  801761:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801764:	5b                   	pop    %ebx
+  801765:	5e                   	pop    %esi
+  801766:	5d                   	pop    %ebp
+  801767:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801768:	a1 b4 50 80 00       	mov    0x8050b4,%eax
+  80176d:	8b 40 48             	mov    0x48(%eax),%eax
+  801770:	83 ec 04             	sub    $0x4,%esp
+  801773:	56                   	push   %esi
+  801774:	50                   	push   %eax
+  801775:	68 4d 30 80 00       	push   $0x80304d
+  80177a:	e8 a0 ef ff ff       	call   80071f <cprintf>
+		return -E_INVAL;
+  80177f:	83 c4 10             	add    $0x10,%esp
+  801782:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801787:	eb d8                	jmp    801761 <read+0x58>
+		return -E_NOT_SUPP;
+  801789:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80178e:	eb d1                	jmp    801761 <read+0x58>
+
+00801790 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801790:	55                   	push   %ebp
+  801791:	89 e5                	mov    %esp,%ebp
+  801793:	57                   	push   %edi
+  801794:	56                   	push   %esi
+  801795:	53                   	push   %ebx
+  801796:	83 ec 0c             	sub    $0xc,%esp
+  801799:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80179c:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80179f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017a4:	eb 02                	jmp    8017a8 <readn+0x18>
+  8017a6:	01 c3                	add    %eax,%ebx
+  8017a8:	39 f3                	cmp    %esi,%ebx
+  8017aa:	73 21                	jae    8017cd <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8017ac:	83 ec 04             	sub    $0x4,%esp
+  8017af:	89 f0                	mov    %esi,%eax
+  8017b1:	29 d8                	sub    %ebx,%eax
+  8017b3:	50                   	push   %eax
+  8017b4:	89 d8                	mov    %ebx,%eax
+  8017b6:	03 45 0c             	add    0xc(%ebp),%eax
+  8017b9:	50                   	push   %eax
+  8017ba:	57                   	push   %edi
+  8017bb:	e8 49 ff ff ff       	call   801709 <read>
+		if (m < 0)
+  8017c0:	83 c4 10             	add    $0x10,%esp
+  8017c3:	85 c0                	test   %eax,%eax
+  8017c5:	78 04                	js     8017cb <readn+0x3b>
+			return m;
+		if (m == 0)
+  8017c7:	75 dd                	jne    8017a6 <readn+0x16>
+  8017c9:	eb 02                	jmp    8017cd <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8017cb:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8017cd:	89 d8                	mov    %ebx,%eax
+  8017cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017d2:	5b                   	pop    %ebx
+  8017d3:	5e                   	pop    %esi
+  8017d4:	5f                   	pop    %edi
+  8017d5:	5d                   	pop    %ebp
+  8017d6:	c3                   	ret
+
+008017d7 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8017d7:	55                   	push   %ebp
+  8017d8:	89 e5                	mov    %esp,%ebp
+  8017da:	56                   	push   %esi
+  8017db:	53                   	push   %ebx
+  8017dc:	83 ec 18             	sub    $0x18,%esp
+  8017df:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017e2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017e5:	50                   	push   %eax
+  8017e6:	53                   	push   %ebx
+  8017e7:	e8 b7 fc ff ff       	call   8014a3 <fd_lookup>
+  8017ec:	83 c4 10             	add    $0x10,%esp
+  8017ef:	85 c0                	test   %eax,%eax
+  8017f1:	78 37                	js     80182a <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017f3:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8017f6:	83 ec 08             	sub    $0x8,%esp
+  8017f9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017fc:	50                   	push   %eax
+  8017fd:	ff 36                	push   (%esi)
+  8017ff:	e8 ef fc ff ff       	call   8014f3 <dev_lookup>
+  801804:	83 c4 10             	add    $0x10,%esp
+  801807:	85 c0                	test   %eax,%eax
+  801809:	78 1f                	js     80182a <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80180b:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80180f:	74 20                	je     801831 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801811:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801814:	8b 40 0c             	mov    0xc(%eax),%eax
+  801817:	85 c0                	test   %eax,%eax
+  801819:	74 37                	je     801852 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80181b:	83 ec 04             	sub    $0x4,%esp
+  80181e:	ff 75 10             	push   0x10(%ebp)
+  801821:	ff 75 0c             	push   0xc(%ebp)
+  801824:	56                   	push   %esi
+  801825:	ff d0                	call   *%eax
+  801827:	83 c4 10             	add    $0x10,%esp
+}
+  80182a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80182d:	5b                   	pop    %ebx
+  80182e:	5e                   	pop    %esi
+  80182f:	5d                   	pop    %ebp
+  801830:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801831:	a1 b4 50 80 00       	mov    0x8050b4,%eax
+  801836:	8b 40 48             	mov    0x48(%eax),%eax
+  801839:	83 ec 04             	sub    $0x4,%esp
+  80183c:	53                   	push   %ebx
+  80183d:	50                   	push   %eax
+  80183e:	68 69 30 80 00       	push   $0x803069
+  801843:	e8 d7 ee ff ff       	call   80071f <cprintf>
+		return -E_INVAL;
+  801848:	83 c4 10             	add    $0x10,%esp
+  80184b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801850:	eb d8                	jmp    80182a <write+0x53>
+		return -E_NOT_SUPP;
+  801852:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801857:	eb d1                	jmp    80182a <write+0x53>
+
+00801859 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801859:	55                   	push   %ebp
+  80185a:	89 e5                	mov    %esp,%ebp
+  80185c:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80185f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801862:	50                   	push   %eax
+  801863:	ff 75 08             	push   0x8(%ebp)
+  801866:	e8 38 fc ff ff       	call   8014a3 <fd_lookup>
+  80186b:	83 c4 10             	add    $0x10,%esp
+  80186e:	85 c0                	test   %eax,%eax
+  801870:	78 0e                	js     801880 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801872:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801875:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801878:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80187b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801880:	c9                   	leave
+  801881:	c3                   	ret
+
+00801882 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801882:	55                   	push   %ebp
+  801883:	89 e5                	mov    %esp,%ebp
+  801885:	56                   	push   %esi
+  801886:	53                   	push   %ebx
+  801887:	83 ec 18             	sub    $0x18,%esp
+  80188a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80188d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801890:	50                   	push   %eax
+  801891:	53                   	push   %ebx
+  801892:	e8 0c fc ff ff       	call   8014a3 <fd_lookup>
+  801897:	83 c4 10             	add    $0x10,%esp
+  80189a:	85 c0                	test   %eax,%eax
+  80189c:	78 34                	js     8018d2 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80189e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8018a1:	83 ec 08             	sub    $0x8,%esp
+  8018a4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018a7:	50                   	push   %eax
+  8018a8:	ff 36                	push   (%esi)
+  8018aa:	e8 44 fc ff ff       	call   8014f3 <dev_lookup>
+  8018af:	83 c4 10             	add    $0x10,%esp
+  8018b2:	85 c0                	test   %eax,%eax
+  8018b4:	78 1c                	js     8018d2 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8018b6:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8018ba:	74 1d                	je     8018d9 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8018bc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018bf:	8b 40 18             	mov    0x18(%eax),%eax
+  8018c2:	85 c0                	test   %eax,%eax
+  8018c4:	74 34                	je     8018fa <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8018c6:	83 ec 08             	sub    $0x8,%esp
+  8018c9:	ff 75 0c             	push   0xc(%ebp)
+  8018cc:	56                   	push   %esi
+  8018cd:	ff d0                	call   *%eax
+  8018cf:	83 c4 10             	add    $0x10,%esp
+}
+  8018d2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018d5:	5b                   	pop    %ebx
+  8018d6:	5e                   	pop    %esi
+  8018d7:	5d                   	pop    %ebp
+  8018d8:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8018d9:	a1 b4 50 80 00       	mov    0x8050b4,%eax
+  8018de:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8018e1:	83 ec 04             	sub    $0x4,%esp
+  8018e4:	53                   	push   %ebx
+  8018e5:	50                   	push   %eax
+  8018e6:	68 2c 30 80 00       	push   $0x80302c
+  8018eb:	e8 2f ee ff ff       	call   80071f <cprintf>
+		return -E_INVAL;
+  8018f0:	83 c4 10             	add    $0x10,%esp
+  8018f3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018f8:	eb d8                	jmp    8018d2 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8018fa:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8018ff:	eb d1                	jmp    8018d2 <ftruncate+0x50>
+
+00801901 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801901:	55                   	push   %ebp
+  801902:	89 e5                	mov    %esp,%ebp
+  801904:	56                   	push   %esi
+  801905:	53                   	push   %ebx
+  801906:	83 ec 18             	sub    $0x18,%esp
+  801909:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80190c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80190f:	50                   	push   %eax
+  801910:	ff 75 08             	push   0x8(%ebp)
+  801913:	e8 8b fb ff ff       	call   8014a3 <fd_lookup>
+  801918:	83 c4 10             	add    $0x10,%esp
+  80191b:	85 c0                	test   %eax,%eax
+  80191d:	78 49                	js     801968 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80191f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801922:	83 ec 08             	sub    $0x8,%esp
+  801925:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801928:	50                   	push   %eax
+  801929:	ff 36                	push   (%esi)
+  80192b:	e8 c3 fb ff ff       	call   8014f3 <dev_lookup>
+  801930:	83 c4 10             	add    $0x10,%esp
+  801933:	85 c0                	test   %eax,%eax
+  801935:	78 31                	js     801968 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801937:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80193a:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80193e:	74 2f                	je     80196f <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801940:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801943:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80194a:	00 00 00 
+	stat->st_isdir = 0;
+  80194d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801954:	00 00 00 
+	stat->st_dev = dev;
+  801957:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80195d:	83 ec 08             	sub    $0x8,%esp
+  801960:	53                   	push   %ebx
+  801961:	56                   	push   %esi
+  801962:	ff 50 14             	call   *0x14(%eax)
+  801965:	83 c4 10             	add    $0x10,%esp
+}
+  801968:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80196b:	5b                   	pop    %ebx
+  80196c:	5e                   	pop    %esi
+  80196d:	5d                   	pop    %ebp
+  80196e:	c3                   	ret
+		return -E_NOT_SUPP;
+  80196f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801974:	eb f2                	jmp    801968 <fstat+0x67>
+
+00801976 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801976:	55                   	push   %ebp
+  801977:	89 e5                	mov    %esp,%ebp
+  801979:	56                   	push   %esi
+  80197a:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80197b:	83 ec 08             	sub    $0x8,%esp
+  80197e:	6a 00                	push   $0x0
+  801980:	ff 75 08             	push   0x8(%ebp)
+  801983:	e8 e4 01 00 00       	call   801b6c <open>
+  801988:	89 c3                	mov    %eax,%ebx
+  80198a:	83 c4 10             	add    $0x10,%esp
+  80198d:	85 c0                	test   %eax,%eax
+  80198f:	78 1b                	js     8019ac <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801991:	83 ec 08             	sub    $0x8,%esp
+  801994:	ff 75 0c             	push   0xc(%ebp)
+  801997:	50                   	push   %eax
+  801998:	e8 64 ff ff ff       	call   801901 <fstat>
+  80199d:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80199f:	89 1c 24             	mov    %ebx,(%esp)
+  8019a2:	e8 26 fc ff ff       	call   8015cd <close>
+	return r;
+  8019a7:	83 c4 10             	add    $0x10,%esp
+  8019aa:	89 f3                	mov    %esi,%ebx
+}
+  8019ac:	89 d8                	mov    %ebx,%eax
+  8019ae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019b1:	5b                   	pop    %ebx
+  8019b2:	5e                   	pop    %esi
+  8019b3:	5d                   	pop    %ebp
+  8019b4:	c3                   	ret
+
+008019b5 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  8019b5:	55                   	push   %ebp
+  8019b6:	89 e5                	mov    %esp,%ebp
+  8019b8:	56                   	push   %esi
+  8019b9:	53                   	push   %ebx
+  8019ba:	89 c6                	mov    %eax,%esi
+  8019bc:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  8019be:	83 3d ac 50 80 00 00 	cmpl   $0x0,0x8050ac
+  8019c5:	74 27                	je     8019ee <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8019c7:	6a 07                	push   $0x7
+  8019c9:	68 00 60 80 00       	push   $0x806000
+  8019ce:	56                   	push   %esi
+  8019cf:	ff 35 ac 50 80 00    	push   0x8050ac
+  8019d5:	e8 d1 0b 00 00       	call   8025ab <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  8019da:	83 c4 0c             	add    $0xc,%esp
+  8019dd:	6a 00                	push   $0x0
+  8019df:	53                   	push   %ebx
+  8019e0:	6a 00                	push   $0x0
+  8019e2:	e8 50 0b 00 00       	call   802537 <ipc_recv>
+}
+  8019e7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019ea:	5b                   	pop    %ebx
+  8019eb:	5e                   	pop    %esi
+  8019ec:	5d                   	pop    %ebp
+  8019ed:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  8019ee:	83 ec 0c             	sub    $0xc,%esp
+  8019f1:	6a 01                	push   $0x1
+  8019f3:	e8 07 0c 00 00       	call   8025ff <ipc_find_env>
+  8019f8:	a3 ac 50 80 00       	mov    %eax,0x8050ac
+  8019fd:	83 c4 10             	add    $0x10,%esp
+  801a00:	eb c5                	jmp    8019c7 <fsipc+0x12>
+
+00801a02 <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801a02:	55                   	push   %ebp
+  801a03:	89 e5                	mov    %esp,%ebp
+  801a05:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801a08:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a0b:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a0e:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.set_size.req_size = newsize;
+  801a13:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a16:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801a1b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a20:	b8 02 00 00 00       	mov    $0x2,%eax
+  801a25:	e8 8b ff ff ff       	call   8019b5 <fsipc>
+}
+  801a2a:	c9                   	leave
+  801a2b:	c3                   	ret
+
+00801a2c <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801a2c:	55                   	push   %ebp
+  801a2d:	89 e5                	mov    %esp,%ebp
+  801a2f:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801a32:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a35:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a38:	a3 00 60 80 00       	mov    %eax,0x806000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801a3d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a42:	b8 06 00 00 00       	mov    $0x6,%eax
+  801a47:	e8 69 ff ff ff       	call   8019b5 <fsipc>
+}
+  801a4c:	c9                   	leave
+  801a4d:	c3                   	ret
+
+00801a4e <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801a4e:	55                   	push   %ebp
+  801a4f:	89 e5                	mov    %esp,%ebp
+  801a51:	53                   	push   %ebx
+  801a52:	83 ec 04             	sub    $0x4,%esp
+  801a55:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801a58:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a5b:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a5e:	a3 00 60 80 00       	mov    %eax,0x806000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801a63:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a68:	b8 05 00 00 00       	mov    $0x5,%eax
+  801a6d:	e8 43 ff ff ff       	call   8019b5 <fsipc>
+  801a72:	85 c0                	test   %eax,%eax
+  801a74:	78 2c                	js     801aa2 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801a76:	83 ec 08             	sub    $0x8,%esp
+  801a79:	68 00 60 80 00       	push   $0x806000
+  801a7e:	53                   	push   %ebx
+  801a7f:	e8 54 f2 ff ff       	call   800cd8 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801a84:	a1 80 60 80 00       	mov    0x806080,%eax
+  801a89:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801a8f:	a1 84 60 80 00       	mov    0x806084,%eax
+  801a94:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801a9a:	83 c4 10             	add    $0x10,%esp
+  801a9d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801aa2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801aa5:	c9                   	leave
+  801aa6:	c3                   	ret
+
+00801aa7 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801aa7:	55                   	push   %ebp
+  801aa8:	89 e5                	mov    %esp,%ebp
+  801aaa:	83 ec 0c             	sub    $0xc,%esp
+  801aad:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801ab0:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ab3:	8b 52 0c             	mov    0xc(%edx),%edx
+  801ab6:	89 15 00 60 80 00    	mov    %edx,0x806000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801abc:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801ac1:	39 d0                	cmp    %edx,%eax
+  801ac3:	0f 47 c2             	cmova  %edx,%eax
+  801ac6:	a3 04 60 80 00       	mov    %eax,0x806004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  801acb:	50                   	push   %eax
+  801acc:	ff 75 0c             	push   0xc(%ebp)
+  801acf:	68 08 60 80 00       	push   $0x806008
+  801ad4:	e8 85 f3 ff ff       	call   800e5e <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801ad9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ade:	b8 04 00 00 00       	mov    $0x4,%eax
+  801ae3:	e8 cd fe ff ff       	call   8019b5 <fsipc>
+}
+  801ae8:	c9                   	leave
+  801ae9:	c3                   	ret
+
+00801aea <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801aea:	55                   	push   %ebp
+  801aeb:	89 e5                	mov    %esp,%ebp
+  801aed:	56                   	push   %esi
+  801aee:	53                   	push   %ebx
+  801aef:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801af2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801af5:	8b 40 0c             	mov    0xc(%eax),%eax
+  801af8:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read.req_n = n;
+  801afd:	89 35 04 60 80 00    	mov    %esi,0x806004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801b03:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b08:	b8 03 00 00 00       	mov    $0x3,%eax
+  801b0d:	e8 a3 fe ff ff       	call   8019b5 <fsipc>
+  801b12:	89 c3                	mov    %eax,%ebx
+  801b14:	85 c0                	test   %eax,%eax
+  801b16:	78 1f                	js     801b37 <devfile_read+0x4d>
+  assert(r <= n);
+  801b18:	39 c6                	cmp    %eax,%esi
+  801b1a:	72 24                	jb     801b40 <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  801b1c:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801b21:	7f 33                	jg     801b56 <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801b23:	83 ec 04             	sub    $0x4,%esp
+  801b26:	50                   	push   %eax
+  801b27:	68 00 60 80 00       	push   $0x806000
+  801b2c:	ff 75 0c             	push   0xc(%ebp)
+  801b2f:	e8 2a f3 ff ff       	call   800e5e <memmove>
+  return r;
+  801b34:	83 c4 10             	add    $0x10,%esp
+}
+  801b37:	89 d8                	mov    %ebx,%eax
+  801b39:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b3c:	5b                   	pop    %ebx
+  801b3d:	5e                   	pop    %esi
+  801b3e:	5d                   	pop    %ebp
+  801b3f:	c3                   	ret
+  assert(r <= n);
+  801b40:	68 9c 30 80 00       	push   $0x80309c
+  801b45:	68 a3 30 80 00       	push   $0x8030a3
+  801b4a:	6a 78                	push   $0x78
+  801b4c:	68 b8 30 80 00       	push   $0x8030b8
+  801b51:	e8 ee ea ff ff       	call   800644 <_panic>
+  assert(r <= PGSIZE);
+  801b56:	68 c3 30 80 00       	push   $0x8030c3
+  801b5b:	68 a3 30 80 00       	push   $0x8030a3
+  801b60:	6a 79                	push   $0x79
+  801b62:	68 b8 30 80 00       	push   $0x8030b8
+  801b67:	e8 d8 ea ff ff       	call   800644 <_panic>
+
+00801b6c <open>:
+open(const char *path, int mode) {
+  801b6c:	55                   	push   %ebp
+  801b6d:	89 e5                	mov    %esp,%ebp
+  801b6f:	56                   	push   %esi
+  801b70:	53                   	push   %ebx
+  801b71:	83 ec 1c             	sub    $0x1c,%esp
+  801b74:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801b77:	56                   	push   %esi
+  801b78:	e8 20 f1 ff ff       	call   800c9d <strlen>
+  801b7d:	83 c4 10             	add    $0x10,%esp
+  801b80:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801b85:	7f 6c                	jg     801bf3 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801b87:	83 ec 0c             	sub    $0xc,%esp
+  801b8a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b8d:	50                   	push   %eax
+  801b8e:	e8 ba f8 ff ff       	call   80144d <fd_alloc>
+  801b93:	89 c3                	mov    %eax,%ebx
+  801b95:	83 c4 10             	add    $0x10,%esp
+  801b98:	85 c0                	test   %eax,%eax
+  801b9a:	78 3c                	js     801bd8 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801b9c:	83 ec 08             	sub    $0x8,%esp
+  801b9f:	56                   	push   %esi
+  801ba0:	68 00 60 80 00       	push   $0x806000
+  801ba5:	e8 2e f1 ff ff       	call   800cd8 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801baa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801bad:	a3 00 64 80 00       	mov    %eax,0x806400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801bb2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801bb5:	b8 01 00 00 00       	mov    $0x1,%eax
+  801bba:	e8 f6 fd ff ff       	call   8019b5 <fsipc>
+  801bbf:	89 c3                	mov    %eax,%ebx
+  801bc1:	83 c4 10             	add    $0x10,%esp
+  801bc4:	85 c0                	test   %eax,%eax
+  801bc6:	78 19                	js     801be1 <open+0x75>
+  return fd2num(fd);
+  801bc8:	83 ec 0c             	sub    $0xc,%esp
+  801bcb:	ff 75 f4             	push   -0xc(%ebp)
+  801bce:	e8 53 f8 ff ff       	call   801426 <fd2num>
+  801bd3:	89 c3                	mov    %eax,%ebx
+  801bd5:	83 c4 10             	add    $0x10,%esp
+}
+  801bd8:	89 d8                	mov    %ebx,%eax
+  801bda:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bdd:	5b                   	pop    %ebx
+  801bde:	5e                   	pop    %esi
+  801bdf:	5d                   	pop    %ebp
+  801be0:	c3                   	ret
+    fd_close(fd, 0);
+  801be1:	83 ec 08             	sub    $0x8,%esp
+  801be4:	6a 00                	push   $0x0
+  801be6:	ff 75 f4             	push   -0xc(%ebp)
+  801be9:	e8 58 f9 ff ff       	call   801546 <fd_close>
+    return r;
+  801bee:	83 c4 10             	add    $0x10,%esp
+  801bf1:	eb e5                	jmp    801bd8 <open+0x6c>
+    return -E_BAD_PATH;
+  801bf3:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801bf8:	eb de                	jmp    801bd8 <open+0x6c>
+
+00801bfa <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  801bfa:	55                   	push   %ebp
+  801bfb:	89 e5                	mov    %esp,%ebp
+  801bfd:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801c00:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c05:	b8 08 00 00 00       	mov    $0x8,%eax
+  801c0a:	e8 a6 fd ff ff       	call   8019b5 <fsipc>
+}
+  801c0f:	c9                   	leave
+  801c10:	c3                   	ret
+
+00801c11 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801c11:	55                   	push   %ebp
+  801c12:	89 e5                	mov    %esp,%ebp
+  801c14:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801c17:	68 cf 30 80 00       	push   $0x8030cf
+  801c1c:	ff 75 0c             	push   0xc(%ebp)
+  801c1f:	e8 b4 f0 ff ff       	call   800cd8 <strcpy>
+	return 0;
+}
+  801c24:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c29:	c9                   	leave
+  801c2a:	c3                   	ret
+
+00801c2b <devsock_close>:
+{
+  801c2b:	55                   	push   %ebp
+  801c2c:	89 e5                	mov    %esp,%ebp
+  801c2e:	53                   	push   %ebx
+  801c2f:	83 ec 10             	sub    $0x10,%esp
+  801c32:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801c35:	53                   	push   %ebx
+  801c36:	e8 03 0a 00 00       	call   80263e <pageref>
+  801c3b:	89 c2                	mov    %eax,%edx
+  801c3d:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801c40:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801c45:	83 fa 01             	cmp    $0x1,%edx
+  801c48:	74 05                	je     801c4f <devsock_close+0x24>
+}
+  801c4a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c4d:	c9                   	leave
+  801c4e:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801c4f:	83 ec 0c             	sub    $0xc,%esp
+  801c52:	ff 73 0c             	push   0xc(%ebx)
+  801c55:	e8 b7 02 00 00       	call   801f11 <nsipc_close>
+  801c5a:	83 c4 10             	add    $0x10,%esp
+  801c5d:	eb eb                	jmp    801c4a <devsock_close+0x1f>
+
+00801c5f <devsock_write>:
+{
+  801c5f:	55                   	push   %ebp
+  801c60:	89 e5                	mov    %esp,%ebp
+  801c62:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801c65:	6a 00                	push   $0x0
+  801c67:	ff 75 10             	push   0x10(%ebp)
+  801c6a:	ff 75 0c             	push   0xc(%ebp)
+  801c6d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c70:	ff 70 0c             	push   0xc(%eax)
+  801c73:	e8 79 03 00 00       	call   801ff1 <nsipc_send>
+}
+  801c78:	c9                   	leave
+  801c79:	c3                   	ret
+
+00801c7a <devsock_read>:
+{
+  801c7a:	55                   	push   %ebp
+  801c7b:	89 e5                	mov    %esp,%ebp
+  801c7d:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801c80:	6a 00                	push   $0x0
+  801c82:	ff 75 10             	push   0x10(%ebp)
+  801c85:	ff 75 0c             	push   0xc(%ebp)
+  801c88:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c8b:	ff 70 0c             	push   0xc(%eax)
+  801c8e:	e8 ef 02 00 00       	call   801f82 <nsipc_recv>
+}
+  801c93:	c9                   	leave
+  801c94:	c3                   	ret
+
+00801c95 <fd2sockid>:
+{
+  801c95:	55                   	push   %ebp
+  801c96:	89 e5                	mov    %esp,%ebp
+  801c98:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801c9b:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801c9e:	52                   	push   %edx
+  801c9f:	50                   	push   %eax
+  801ca0:	e8 fe f7 ff ff       	call   8014a3 <fd_lookup>
+  801ca5:	83 c4 10             	add    $0x10,%esp
+  801ca8:	85 c0                	test   %eax,%eax
+  801caa:	78 10                	js     801cbc <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801cac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801caf:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  801cb5:	39 08                	cmp    %ecx,(%eax)
+  801cb7:	75 05                	jne    801cbe <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801cb9:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801cbc:	c9                   	leave
+  801cbd:	c3                   	ret
+		return -E_NOT_SUPP;
+  801cbe:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801cc3:	eb f7                	jmp    801cbc <fd2sockid+0x27>
+
+00801cc5 <alloc_sockfd>:
+{
+  801cc5:	55                   	push   %ebp
+  801cc6:	89 e5                	mov    %esp,%ebp
+  801cc8:	56                   	push   %esi
+  801cc9:	53                   	push   %ebx
+  801cca:	83 ec 1c             	sub    $0x1c,%esp
+  801ccd:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801ccf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cd2:	50                   	push   %eax
+  801cd3:	e8 75 f7 ff ff       	call   80144d <fd_alloc>
+  801cd8:	89 c3                	mov    %eax,%ebx
+  801cda:	83 c4 10             	add    $0x10,%esp
+  801cdd:	85 c0                	test   %eax,%eax
+  801cdf:	78 43                	js     801d24 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801ce1:	83 ec 04             	sub    $0x4,%esp
+  801ce4:	68 07 04 00 00       	push   $0x407
+  801ce9:	ff 75 f4             	push   -0xc(%ebp)
+  801cec:	6a 00                	push   $0x0
+  801cee:	e8 d1 f3 ff ff       	call   8010c4 <sys_page_alloc>
+  801cf3:	89 c3                	mov    %eax,%ebx
+  801cf5:	83 c4 10             	add    $0x10,%esp
+  801cf8:	85 c0                	test   %eax,%eax
+  801cfa:	78 28                	js     801d24 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801cfc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cff:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801d05:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801d07:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d0a:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801d11:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801d14:	83 ec 0c             	sub    $0xc,%esp
+  801d17:	50                   	push   %eax
+  801d18:	e8 09 f7 ff ff       	call   801426 <fd2num>
+  801d1d:	89 c3                	mov    %eax,%ebx
+  801d1f:	83 c4 10             	add    $0x10,%esp
+  801d22:	eb 0c                	jmp    801d30 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801d24:	83 ec 0c             	sub    $0xc,%esp
+  801d27:	56                   	push   %esi
+  801d28:	e8 e4 01 00 00       	call   801f11 <nsipc_close>
+		return r;
+  801d2d:	83 c4 10             	add    $0x10,%esp
+}
+  801d30:	89 d8                	mov    %ebx,%eax
+  801d32:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d35:	5b                   	pop    %ebx
+  801d36:	5e                   	pop    %esi
+  801d37:	5d                   	pop    %ebp
+  801d38:	c3                   	ret
+
+00801d39 <accept>:
+{
+  801d39:	55                   	push   %ebp
+  801d3a:	89 e5                	mov    %esp,%ebp
+  801d3c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d3f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d42:	e8 4e ff ff ff       	call   801c95 <fd2sockid>
+  801d47:	85 c0                	test   %eax,%eax
+  801d49:	78 1b                	js     801d66 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801d4b:	83 ec 04             	sub    $0x4,%esp
+  801d4e:	ff 75 10             	push   0x10(%ebp)
+  801d51:	ff 75 0c             	push   0xc(%ebp)
+  801d54:	50                   	push   %eax
+  801d55:	e8 0e 01 00 00       	call   801e68 <nsipc_accept>
+  801d5a:	83 c4 10             	add    $0x10,%esp
+  801d5d:	85 c0                	test   %eax,%eax
+  801d5f:	78 05                	js     801d66 <accept+0x2d>
+	return alloc_sockfd(r);
+  801d61:	e8 5f ff ff ff       	call   801cc5 <alloc_sockfd>
+}
+  801d66:	c9                   	leave
+  801d67:	c3                   	ret
+
+00801d68 <bind>:
+{
+  801d68:	55                   	push   %ebp
+  801d69:	89 e5                	mov    %esp,%ebp
+  801d6b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d6e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d71:	e8 1f ff ff ff       	call   801c95 <fd2sockid>
+  801d76:	85 c0                	test   %eax,%eax
+  801d78:	78 12                	js     801d8c <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801d7a:	83 ec 04             	sub    $0x4,%esp
+  801d7d:	ff 75 10             	push   0x10(%ebp)
+  801d80:	ff 75 0c             	push   0xc(%ebp)
+  801d83:	50                   	push   %eax
+  801d84:	e8 31 01 00 00       	call   801eba <nsipc_bind>
+  801d89:	83 c4 10             	add    $0x10,%esp
+}
+  801d8c:	c9                   	leave
+  801d8d:	c3                   	ret
+
+00801d8e <shutdown>:
+{
+  801d8e:	55                   	push   %ebp
+  801d8f:	89 e5                	mov    %esp,%ebp
+  801d91:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d94:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d97:	e8 f9 fe ff ff       	call   801c95 <fd2sockid>
+  801d9c:	85 c0                	test   %eax,%eax
+  801d9e:	78 0f                	js     801daf <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801da0:	83 ec 08             	sub    $0x8,%esp
+  801da3:	ff 75 0c             	push   0xc(%ebp)
+  801da6:	50                   	push   %eax
+  801da7:	e8 43 01 00 00       	call   801eef <nsipc_shutdown>
+  801dac:	83 c4 10             	add    $0x10,%esp
+}
+  801daf:	c9                   	leave
+  801db0:	c3                   	ret
+
+00801db1 <connect>:
+{
+  801db1:	55                   	push   %ebp
+  801db2:	89 e5                	mov    %esp,%ebp
+  801db4:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801db7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dba:	e8 d6 fe ff ff       	call   801c95 <fd2sockid>
+  801dbf:	85 c0                	test   %eax,%eax
+  801dc1:	78 12                	js     801dd5 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801dc3:	83 ec 04             	sub    $0x4,%esp
+  801dc6:	ff 75 10             	push   0x10(%ebp)
+  801dc9:	ff 75 0c             	push   0xc(%ebp)
+  801dcc:	50                   	push   %eax
+  801dcd:	e8 59 01 00 00       	call   801f2b <nsipc_connect>
+  801dd2:	83 c4 10             	add    $0x10,%esp
+}
+  801dd5:	c9                   	leave
+  801dd6:	c3                   	ret
+
+00801dd7 <listen>:
+{
+  801dd7:	55                   	push   %ebp
+  801dd8:	89 e5                	mov    %esp,%ebp
+  801dda:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801ddd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801de0:	e8 b0 fe ff ff       	call   801c95 <fd2sockid>
+  801de5:	85 c0                	test   %eax,%eax
+  801de7:	78 0f                	js     801df8 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801de9:	83 ec 08             	sub    $0x8,%esp
+  801dec:	ff 75 0c             	push   0xc(%ebp)
+  801def:	50                   	push   %eax
+  801df0:	e8 6b 01 00 00       	call   801f60 <nsipc_listen>
+  801df5:	83 c4 10             	add    $0x10,%esp
+}
+  801df8:	c9                   	leave
+  801df9:	c3                   	ret
+
+00801dfa <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801dfa:	55                   	push   %ebp
+  801dfb:	89 e5                	mov    %esp,%ebp
+  801dfd:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801e00:	ff 75 10             	push   0x10(%ebp)
+  801e03:	ff 75 0c             	push   0xc(%ebp)
+  801e06:	ff 75 08             	push   0x8(%ebp)
+  801e09:	e8 41 02 00 00       	call   80204f <nsipc_socket>
+  801e0e:	83 c4 10             	add    $0x10,%esp
+  801e11:	85 c0                	test   %eax,%eax
+  801e13:	78 05                	js     801e1a <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801e15:	e8 ab fe ff ff       	call   801cc5 <alloc_sockfd>
+}
+  801e1a:	c9                   	leave
+  801e1b:	c3                   	ret
+
+00801e1c <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801e1c:	55                   	push   %ebp
+  801e1d:	89 e5                	mov    %esp,%ebp
+  801e1f:	53                   	push   %ebx
+  801e20:	83 ec 04             	sub    $0x4,%esp
+  801e23:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801e25:	83 3d b0 50 80 00 00 	cmpl   $0x0,0x8050b0
+  801e2c:	74 26                	je     801e54 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801e2e:	6a 07                	push   $0x7
+  801e30:	68 00 70 80 00       	push   $0x807000
+  801e35:	53                   	push   %ebx
+  801e36:	ff 35 b0 50 80 00    	push   0x8050b0
+  801e3c:	e8 6a 07 00 00       	call   8025ab <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801e41:	83 c4 0c             	add    $0xc,%esp
+  801e44:	6a 00                	push   $0x0
+  801e46:	6a 00                	push   $0x0
+  801e48:	6a 00                	push   $0x0
+  801e4a:	e8 e8 06 00 00       	call   802537 <ipc_recv>
+}
+  801e4f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e52:	c9                   	leave
+  801e53:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801e54:	83 ec 0c             	sub    $0xc,%esp
+  801e57:	6a 02                	push   $0x2
+  801e59:	e8 a1 07 00 00       	call   8025ff <ipc_find_env>
+  801e5e:	a3 b0 50 80 00       	mov    %eax,0x8050b0
+  801e63:	83 c4 10             	add    $0x10,%esp
+  801e66:	eb c6                	jmp    801e2e <nsipc+0x12>
+
+00801e68 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801e68:	55                   	push   %ebp
+  801e69:	89 e5                	mov    %esp,%ebp
+  801e6b:	56                   	push   %esi
+  801e6c:	53                   	push   %ebx
+  801e6d:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801e70:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e73:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801e78:	8b 06                	mov    (%esi),%eax
+  801e7a:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801e7f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e84:	e8 93 ff ff ff       	call   801e1c <nsipc>
+  801e89:	89 c3                	mov    %eax,%ebx
+  801e8b:	85 c0                	test   %eax,%eax
+  801e8d:	79 09                	jns    801e98 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801e8f:	89 d8                	mov    %ebx,%eax
+  801e91:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e94:	5b                   	pop    %ebx
+  801e95:	5e                   	pop    %esi
+  801e96:	5d                   	pop    %ebp
+  801e97:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801e98:	83 ec 04             	sub    $0x4,%esp
+  801e9b:	ff 35 10 70 80 00    	push   0x807010
+  801ea1:	68 00 70 80 00       	push   $0x807000
+  801ea6:	ff 75 0c             	push   0xc(%ebp)
+  801ea9:	e8 b0 ef ff ff       	call   800e5e <memmove>
+		*addrlen = ret->ret_addrlen;
+  801eae:	a1 10 70 80 00       	mov    0x807010,%eax
+  801eb3:	89 06                	mov    %eax,(%esi)
+  801eb5:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801eb8:	eb d5                	jmp    801e8f <nsipc_accept+0x27>
+
+00801eba <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801eba:	55                   	push   %ebp
+  801ebb:	89 e5                	mov    %esp,%ebp
+  801ebd:	53                   	push   %ebx
+  801ebe:	83 ec 08             	sub    $0x8,%esp
+  801ec1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801ec4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ec7:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801ecc:	53                   	push   %ebx
+  801ecd:	ff 75 0c             	push   0xc(%ebp)
+  801ed0:	68 04 70 80 00       	push   $0x807004
+  801ed5:	e8 84 ef ff ff       	call   800e5e <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801eda:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  801ee0:	b8 02 00 00 00       	mov    $0x2,%eax
+  801ee5:	e8 32 ff ff ff       	call   801e1c <nsipc>
+}
+  801eea:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801eed:	c9                   	leave
+  801eee:	c3                   	ret
+
+00801eef <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801eef:	55                   	push   %ebp
+  801ef0:	89 e5                	mov    %esp,%ebp
+  801ef2:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801ef5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ef8:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  801efd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f00:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  801f05:	b8 03 00 00 00       	mov    $0x3,%eax
+  801f0a:	e8 0d ff ff ff       	call   801e1c <nsipc>
+}
+  801f0f:	c9                   	leave
+  801f10:	c3                   	ret
+
+00801f11 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801f11:	55                   	push   %ebp
+  801f12:	89 e5                	mov    %esp,%ebp
+  801f14:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801f17:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f1a:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  801f1f:	b8 04 00 00 00       	mov    $0x4,%eax
+  801f24:	e8 f3 fe ff ff       	call   801e1c <nsipc>
+}
+  801f29:	c9                   	leave
+  801f2a:	c3                   	ret
+
+00801f2b <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801f2b:	55                   	push   %ebp
+  801f2c:	89 e5                	mov    %esp,%ebp
+  801f2e:	53                   	push   %ebx
+  801f2f:	83 ec 08             	sub    $0x8,%esp
+  801f32:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801f35:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f38:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801f3d:	53                   	push   %ebx
+  801f3e:	ff 75 0c             	push   0xc(%ebp)
+  801f41:	68 04 70 80 00       	push   $0x807004
+  801f46:	e8 13 ef ff ff       	call   800e5e <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801f4b:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  801f51:	b8 05 00 00 00       	mov    $0x5,%eax
+  801f56:	e8 c1 fe ff ff       	call   801e1c <nsipc>
+}
+  801f5b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f5e:	c9                   	leave
+  801f5f:	c3                   	ret
+
+00801f60 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801f60:	55                   	push   %ebp
+  801f61:	89 e5                	mov    %esp,%ebp
+  801f63:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801f66:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f69:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  801f6e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f71:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  801f76:	b8 06 00 00 00       	mov    $0x6,%eax
+  801f7b:	e8 9c fe ff ff       	call   801e1c <nsipc>
+}
+  801f80:	c9                   	leave
+  801f81:	c3                   	ret
+
+00801f82 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801f82:	55                   	push   %ebp
+  801f83:	89 e5                	mov    %esp,%ebp
+  801f85:	56                   	push   %esi
+  801f86:	53                   	push   %ebx
+  801f87:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801f8a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f8d:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  801f92:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  801f98:	8b 45 14             	mov    0x14(%ebp),%eax
+  801f9b:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801fa0:	b8 07 00 00 00       	mov    $0x7,%eax
+  801fa5:	e8 72 fe ff ff       	call   801e1c <nsipc>
+  801faa:	89 c3                	mov    %eax,%ebx
+  801fac:	85 c0                	test   %eax,%eax
+  801fae:	78 22                	js     801fd2 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801fb0:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801fb5:	39 c6                	cmp    %eax,%esi
+  801fb7:	0f 4e c6             	cmovle %esi,%eax
+  801fba:	39 c3                	cmp    %eax,%ebx
+  801fbc:	7f 1d                	jg     801fdb <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801fbe:	83 ec 04             	sub    $0x4,%esp
+  801fc1:	53                   	push   %ebx
+  801fc2:	68 00 70 80 00       	push   $0x807000
+  801fc7:	ff 75 0c             	push   0xc(%ebp)
+  801fca:	e8 8f ee ff ff       	call   800e5e <memmove>
+  801fcf:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801fd2:	89 d8                	mov    %ebx,%eax
+  801fd4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fd7:	5b                   	pop    %ebx
+  801fd8:	5e                   	pop    %esi
+  801fd9:	5d                   	pop    %ebp
+  801fda:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801fdb:	68 db 30 80 00       	push   $0x8030db
+  801fe0:	68 a3 30 80 00       	push   $0x8030a3
+  801fe5:	6a 62                	push   $0x62
+  801fe7:	68 f0 30 80 00       	push   $0x8030f0
+  801fec:	e8 53 e6 ff ff       	call   800644 <_panic>
+
+00801ff1 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801ff1:	55                   	push   %ebp
+  801ff2:	89 e5                	mov    %esp,%ebp
+  801ff4:	53                   	push   %ebx
+  801ff5:	83 ec 04             	sub    $0x4,%esp
+  801ff8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801ffb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ffe:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  802003:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802009:	7f 2e                	jg     802039 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  80200b:	83 ec 04             	sub    $0x4,%esp
+  80200e:	53                   	push   %ebx
+  80200f:	ff 75 0c             	push   0xc(%ebp)
+  802012:	68 0c 70 80 00       	push   $0x80700c
+  802017:	e8 42 ee ff ff       	call   800e5e <memmove>
+	nsipcbuf.send.req_size = size;
+  80201c:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  802022:	8b 45 14             	mov    0x14(%ebp),%eax
+  802025:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  80202a:	b8 08 00 00 00       	mov    $0x8,%eax
+  80202f:	e8 e8 fd ff ff       	call   801e1c <nsipc>
+}
+  802034:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802037:	c9                   	leave
+  802038:	c3                   	ret
+	assert(size < 1600);
+  802039:	68 fc 30 80 00       	push   $0x8030fc
+  80203e:	68 a3 30 80 00       	push   $0x8030a3
+  802043:	6a 6d                	push   $0x6d
+  802045:	68 f0 30 80 00       	push   $0x8030f0
+  80204a:	e8 f5 e5 ff ff       	call   800644 <_panic>
+
+0080204f <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80204f:	55                   	push   %ebp
+  802050:	89 e5                	mov    %esp,%ebp
+  802052:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802055:	8b 45 08             	mov    0x8(%ebp),%eax
+  802058:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  80205d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802060:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  802065:	8b 45 10             	mov    0x10(%ebp),%eax
+  802068:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  80206d:	b8 09 00 00 00       	mov    $0x9,%eax
+  802072:	e8 a5 fd ff ff       	call   801e1c <nsipc>
+}
+  802077:	c9                   	leave
+  802078:	c3                   	ret
+
+00802079 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802079:	55                   	push   %ebp
+  80207a:	89 e5                	mov    %esp,%ebp
+  80207c:	56                   	push   %esi
+  80207d:	53                   	push   %ebx
+  80207e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802081:	83 ec 0c             	sub    $0xc,%esp
+  802084:	ff 75 08             	push   0x8(%ebp)
+  802087:	e8 aa f3 ff ff       	call   801436 <fd2data>
+  80208c:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80208e:	83 c4 08             	add    $0x8,%esp
+  802091:	68 08 31 80 00       	push   $0x803108
+  802096:	53                   	push   %ebx
+  802097:	e8 3c ec ff ff       	call   800cd8 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  80209c:	8b 46 04             	mov    0x4(%esi),%eax
+  80209f:	2b 06                	sub    (%esi),%eax
+  8020a1:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8020a7:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8020ae:	00 00 00 
+	stat->st_dev = &devpipe;
+  8020b1:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  8020b8:	40 80 00 
+	return 0;
+}
+  8020bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020c0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020c3:	5b                   	pop    %ebx
+  8020c4:	5e                   	pop    %esi
+  8020c5:	5d                   	pop    %ebp
+  8020c6:	c3                   	ret
+
+008020c7 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8020c7:	55                   	push   %ebp
+  8020c8:	89 e5                	mov    %esp,%ebp
+  8020ca:	53                   	push   %ebx
+  8020cb:	83 ec 0c             	sub    $0xc,%esp
+  8020ce:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8020d1:	53                   	push   %ebx
+  8020d2:	6a 00                	push   $0x0
+  8020d4:	e8 70 f0 ff ff       	call   801149 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8020d9:	89 1c 24             	mov    %ebx,(%esp)
+  8020dc:	e8 55 f3 ff ff       	call   801436 <fd2data>
+  8020e1:	83 c4 08             	add    $0x8,%esp
+  8020e4:	50                   	push   %eax
+  8020e5:	6a 00                	push   $0x0
+  8020e7:	e8 5d f0 ff ff       	call   801149 <sys_page_unmap>
+}
+  8020ec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020ef:	c9                   	leave
+  8020f0:	c3                   	ret
+
+008020f1 <_pipeisclosed>:
+{
+  8020f1:	55                   	push   %ebp
+  8020f2:	89 e5                	mov    %esp,%ebp
+  8020f4:	57                   	push   %edi
+  8020f5:	56                   	push   %esi
+  8020f6:	53                   	push   %ebx
+  8020f7:	83 ec 1c             	sub    $0x1c,%esp
+  8020fa:	89 c7                	mov    %eax,%edi
+  8020fc:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  8020fe:	a1 b4 50 80 00       	mov    0x8050b4,%eax
+  802103:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802106:	83 ec 0c             	sub    $0xc,%esp
+  802109:	57                   	push   %edi
+  80210a:	e8 2f 05 00 00       	call   80263e <pageref>
+  80210f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802112:	89 34 24             	mov    %esi,(%esp)
+  802115:	e8 24 05 00 00       	call   80263e <pageref>
+		nn = thisenv->env_runs;
+  80211a:	8b 15 b4 50 80 00    	mov    0x8050b4,%edx
+  802120:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  802123:	83 c4 10             	add    $0x10,%esp
+  802126:	39 cb                	cmp    %ecx,%ebx
+  802128:	74 1b                	je     802145 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  80212a:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80212d:	75 cf                	jne    8020fe <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80212f:	8b 42 58             	mov    0x58(%edx),%eax
+  802132:	6a 01                	push   $0x1
+  802134:	50                   	push   %eax
+  802135:	53                   	push   %ebx
+  802136:	68 0f 31 80 00       	push   $0x80310f
+  80213b:	e8 df e5 ff ff       	call   80071f <cprintf>
+  802140:	83 c4 10             	add    $0x10,%esp
+  802143:	eb b9                	jmp    8020fe <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802145:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802148:	0f 94 c0             	sete   %al
+  80214b:	0f b6 c0             	movzbl %al,%eax
+}
+  80214e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802151:	5b                   	pop    %ebx
+  802152:	5e                   	pop    %esi
+  802153:	5f                   	pop    %edi
+  802154:	5d                   	pop    %ebp
+  802155:	c3                   	ret
+
+00802156 <devpipe_write>:
+{
+  802156:	55                   	push   %ebp
+  802157:	89 e5                	mov    %esp,%ebp
+  802159:	57                   	push   %edi
+  80215a:	56                   	push   %esi
+  80215b:	53                   	push   %ebx
+  80215c:	83 ec 28             	sub    $0x28,%esp
+  80215f:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802162:	56                   	push   %esi
+  802163:	e8 ce f2 ff ff       	call   801436 <fd2data>
+  802168:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80216a:	83 c4 10             	add    $0x10,%esp
+  80216d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802172:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802175:	75 09                	jne    802180 <devpipe_write+0x2a>
+	return i;
+  802177:	89 f8                	mov    %edi,%eax
+  802179:	eb 23                	jmp    80219e <devpipe_write+0x48>
+			sys_yield();
+  80217b:	e8 25 ef ff ff       	call   8010a5 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802180:	8b 43 04             	mov    0x4(%ebx),%eax
+  802183:	8b 0b                	mov    (%ebx),%ecx
+  802185:	8d 51 20             	lea    0x20(%ecx),%edx
+  802188:	39 d0                	cmp    %edx,%eax
+  80218a:	72 1a                	jb     8021a6 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  80218c:	89 da                	mov    %ebx,%edx
+  80218e:	89 f0                	mov    %esi,%eax
+  802190:	e8 5c ff ff ff       	call   8020f1 <_pipeisclosed>
+  802195:	85 c0                	test   %eax,%eax
+  802197:	74 e2                	je     80217b <devpipe_write+0x25>
+				return 0;
+  802199:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80219e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021a1:	5b                   	pop    %ebx
+  8021a2:	5e                   	pop    %esi
+  8021a3:	5f                   	pop    %edi
+  8021a4:	5d                   	pop    %ebp
+  8021a5:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8021a6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8021a9:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8021ad:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8021b0:	89 c2                	mov    %eax,%edx
+  8021b2:	c1 fa 1f             	sar    $0x1f,%edx
+  8021b5:	89 d1                	mov    %edx,%ecx
+  8021b7:	c1 e9 1b             	shr    $0x1b,%ecx
+  8021ba:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8021bd:	83 e2 1f             	and    $0x1f,%edx
+  8021c0:	29 ca                	sub    %ecx,%edx
+  8021c2:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8021c6:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8021ca:	83 c0 01             	add    $0x1,%eax
+  8021cd:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8021d0:	83 c7 01             	add    $0x1,%edi
+  8021d3:	eb 9d                	jmp    802172 <devpipe_write+0x1c>
+
+008021d5 <devpipe_read>:
+{
+  8021d5:	55                   	push   %ebp
+  8021d6:	89 e5                	mov    %esp,%ebp
+  8021d8:	57                   	push   %edi
+  8021d9:	56                   	push   %esi
+  8021da:	53                   	push   %ebx
+  8021db:	83 ec 18             	sub    $0x18,%esp
+  8021de:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8021e1:	57                   	push   %edi
+  8021e2:	e8 4f f2 ff ff       	call   801436 <fd2data>
+  8021e7:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8021e9:	83 c4 10             	add    $0x10,%esp
+  8021ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8021f1:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8021f4:	75 13                	jne    802209 <devpipe_read+0x34>
+	return i;
+  8021f6:	89 f0                	mov    %esi,%eax
+  8021f8:	eb 02                	jmp    8021fc <devpipe_read+0x27>
+				return i;
+  8021fa:	89 f0                	mov    %esi,%eax
+}
+  8021fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021ff:	5b                   	pop    %ebx
+  802200:	5e                   	pop    %esi
+  802201:	5f                   	pop    %edi
+  802202:	5d                   	pop    %ebp
+  802203:	c3                   	ret
+			sys_yield();
+  802204:	e8 9c ee ff ff       	call   8010a5 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802209:	8b 03                	mov    (%ebx),%eax
+  80220b:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80220e:	75 18                	jne    802228 <devpipe_read+0x53>
+			if (i > 0)
+  802210:	85 f6                	test   %esi,%esi
+  802212:	75 e6                	jne    8021fa <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802214:	89 da                	mov    %ebx,%edx
+  802216:	89 f8                	mov    %edi,%eax
+  802218:	e8 d4 fe ff ff       	call   8020f1 <_pipeisclosed>
+  80221d:	85 c0                	test   %eax,%eax
+  80221f:	74 e3                	je     802204 <devpipe_read+0x2f>
+				return 0;
+  802221:	b8 00 00 00 00       	mov    $0x0,%eax
+  802226:	eb d4                	jmp    8021fc <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802228:	99                   	cltd
+  802229:	c1 ea 1b             	shr    $0x1b,%edx
+  80222c:	01 d0                	add    %edx,%eax
+  80222e:	83 e0 1f             	and    $0x1f,%eax
+  802231:	29 d0                	sub    %edx,%eax
+  802233:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802238:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80223b:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80223e:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802241:	83 c6 01             	add    $0x1,%esi
+  802244:	eb ab                	jmp    8021f1 <devpipe_read+0x1c>
+
+00802246 <pipe>:
+{
+  802246:	55                   	push   %ebp
+  802247:	89 e5                	mov    %esp,%ebp
+  802249:	56                   	push   %esi
+  80224a:	53                   	push   %ebx
+  80224b:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80224e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802251:	50                   	push   %eax
+  802252:	e8 f6 f1 ff ff       	call   80144d <fd_alloc>
+  802257:	89 c3                	mov    %eax,%ebx
+  802259:	83 c4 10             	add    $0x10,%esp
+  80225c:	85 c0                	test   %eax,%eax
+  80225e:	0f 88 23 01 00 00    	js     802387 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802264:	83 ec 04             	sub    $0x4,%esp
+  802267:	68 07 04 00 00       	push   $0x407
+  80226c:	ff 75 f4             	push   -0xc(%ebp)
+  80226f:	6a 00                	push   $0x0
+  802271:	e8 4e ee ff ff       	call   8010c4 <sys_page_alloc>
+  802276:	89 c3                	mov    %eax,%ebx
+  802278:	83 c4 10             	add    $0x10,%esp
+  80227b:	85 c0                	test   %eax,%eax
+  80227d:	0f 88 04 01 00 00    	js     802387 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802283:	83 ec 0c             	sub    $0xc,%esp
+  802286:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802289:	50                   	push   %eax
+  80228a:	e8 be f1 ff ff       	call   80144d <fd_alloc>
+  80228f:	89 c3                	mov    %eax,%ebx
+  802291:	83 c4 10             	add    $0x10,%esp
+  802294:	85 c0                	test   %eax,%eax
+  802296:	0f 88 db 00 00 00    	js     802377 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80229c:	83 ec 04             	sub    $0x4,%esp
+  80229f:	68 07 04 00 00       	push   $0x407
+  8022a4:	ff 75 f0             	push   -0x10(%ebp)
+  8022a7:	6a 00                	push   $0x0
+  8022a9:	e8 16 ee ff ff       	call   8010c4 <sys_page_alloc>
+  8022ae:	89 c3                	mov    %eax,%ebx
+  8022b0:	83 c4 10             	add    $0x10,%esp
+  8022b3:	85 c0                	test   %eax,%eax
+  8022b5:	0f 88 bc 00 00 00    	js     802377 <pipe+0x131>
+	va = fd2data(fd0);
+  8022bb:	83 ec 0c             	sub    $0xc,%esp
+  8022be:	ff 75 f4             	push   -0xc(%ebp)
+  8022c1:	e8 70 f1 ff ff       	call   801436 <fd2data>
+  8022c6:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8022c8:	83 c4 0c             	add    $0xc,%esp
+  8022cb:	68 07 04 00 00       	push   $0x407
+  8022d0:	50                   	push   %eax
+  8022d1:	6a 00                	push   $0x0
+  8022d3:	e8 ec ed ff ff       	call   8010c4 <sys_page_alloc>
+  8022d8:	89 c3                	mov    %eax,%ebx
+  8022da:	83 c4 10             	add    $0x10,%esp
+  8022dd:	85 c0                	test   %eax,%eax
+  8022df:	0f 88 82 00 00 00    	js     802367 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8022e5:	83 ec 0c             	sub    $0xc,%esp
+  8022e8:	ff 75 f0             	push   -0x10(%ebp)
+  8022eb:	e8 46 f1 ff ff       	call   801436 <fd2data>
+  8022f0:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8022f7:	50                   	push   %eax
+  8022f8:	6a 00                	push   $0x0
+  8022fa:	56                   	push   %esi
+  8022fb:	6a 00                	push   $0x0
+  8022fd:	e8 05 ee ff ff       	call   801107 <sys_page_map>
+  802302:	89 c3                	mov    %eax,%ebx
+  802304:	83 c4 20             	add    $0x20,%esp
+  802307:	85 c0                	test   %eax,%eax
+  802309:	78 4e                	js     802359 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80230b:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  802310:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802313:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802315:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802318:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80231f:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802322:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802324:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802327:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80232e:	83 ec 0c             	sub    $0xc,%esp
+  802331:	ff 75 f4             	push   -0xc(%ebp)
+  802334:	e8 ed f0 ff ff       	call   801426 <fd2num>
+  802339:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80233c:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80233e:	83 c4 04             	add    $0x4,%esp
+  802341:	ff 75 f0             	push   -0x10(%ebp)
+  802344:	e8 dd f0 ff ff       	call   801426 <fd2num>
+  802349:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80234c:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80234f:	83 c4 10             	add    $0x10,%esp
+  802352:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802357:	eb 2e                	jmp    802387 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802359:	83 ec 08             	sub    $0x8,%esp
+  80235c:	56                   	push   %esi
+  80235d:	6a 00                	push   $0x0
+  80235f:	e8 e5 ed ff ff       	call   801149 <sys_page_unmap>
+  802364:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802367:	83 ec 08             	sub    $0x8,%esp
+  80236a:	ff 75 f0             	push   -0x10(%ebp)
+  80236d:	6a 00                	push   $0x0
+  80236f:	e8 d5 ed ff ff       	call   801149 <sys_page_unmap>
+  802374:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802377:	83 ec 08             	sub    $0x8,%esp
+  80237a:	ff 75 f4             	push   -0xc(%ebp)
+  80237d:	6a 00                	push   $0x0
+  80237f:	e8 c5 ed ff ff       	call   801149 <sys_page_unmap>
+  802384:	83 c4 10             	add    $0x10,%esp
+}
+  802387:	89 d8                	mov    %ebx,%eax
+  802389:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80238c:	5b                   	pop    %ebx
+  80238d:	5e                   	pop    %esi
+  80238e:	5d                   	pop    %ebp
+  80238f:	c3                   	ret
+
+00802390 <pipeisclosed>:
+{
+  802390:	55                   	push   %ebp
+  802391:	89 e5                	mov    %esp,%ebp
+  802393:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802396:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802399:	50                   	push   %eax
+  80239a:	ff 75 08             	push   0x8(%ebp)
+  80239d:	e8 01 f1 ff ff       	call   8014a3 <fd_lookup>
+  8023a2:	83 c4 10             	add    $0x10,%esp
+  8023a5:	85 c0                	test   %eax,%eax
+  8023a7:	78 18                	js     8023c1 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8023a9:	83 ec 0c             	sub    $0xc,%esp
+  8023ac:	ff 75 f4             	push   -0xc(%ebp)
+  8023af:	e8 82 f0 ff ff       	call   801436 <fd2data>
+  8023b4:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8023b6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023b9:	e8 33 fd ff ff       	call   8020f1 <_pipeisclosed>
+  8023be:	83 c4 10             	add    $0x10,%esp
+}
+  8023c1:	c9                   	leave
+  8023c2:	c3                   	ret
+
+008023c3 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8023c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023c8:	c3                   	ret
+
+008023c9 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8023c9:	55                   	push   %ebp
+  8023ca:	89 e5                	mov    %esp,%ebp
+  8023cc:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8023cf:	68 27 31 80 00       	push   $0x803127
+  8023d4:	ff 75 0c             	push   0xc(%ebp)
+  8023d7:	e8 fc e8 ff ff       	call   800cd8 <strcpy>
+	return 0;
+}
+  8023dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023e1:	c9                   	leave
+  8023e2:	c3                   	ret
+
+008023e3 <devcons_write>:
+{
+  8023e3:	55                   	push   %ebp
+  8023e4:	89 e5                	mov    %esp,%ebp
+  8023e6:	57                   	push   %edi
+  8023e7:	56                   	push   %esi
+  8023e8:	53                   	push   %ebx
+  8023e9:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8023ef:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8023f4:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8023fa:	eb 2e                	jmp    80242a <devcons_write+0x47>
+		m = n - tot;
+  8023fc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8023ff:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802401:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802406:	39 c3                	cmp    %eax,%ebx
+  802408:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80240b:	83 ec 04             	sub    $0x4,%esp
+  80240e:	53                   	push   %ebx
+  80240f:	89 f0                	mov    %esi,%eax
+  802411:	03 45 0c             	add    0xc(%ebp),%eax
+  802414:	50                   	push   %eax
+  802415:	57                   	push   %edi
+  802416:	e8 43 ea ff ff       	call   800e5e <memmove>
+		sys_cputs(buf, m);
+  80241b:	83 c4 08             	add    $0x8,%esp
+  80241e:	53                   	push   %ebx
+  80241f:	57                   	push   %edi
+  802420:	e8 e3 eb ff ff       	call   801008 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802425:	01 de                	add    %ebx,%esi
+  802427:	83 c4 10             	add    $0x10,%esp
+  80242a:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80242d:	72 cd                	jb     8023fc <devcons_write+0x19>
+}
+  80242f:	89 f0                	mov    %esi,%eax
+  802431:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802434:	5b                   	pop    %ebx
+  802435:	5e                   	pop    %esi
+  802436:	5f                   	pop    %edi
+  802437:	5d                   	pop    %ebp
+  802438:	c3                   	ret
+
+00802439 <devcons_read>:
+{
+  802439:	55                   	push   %ebp
+  80243a:	89 e5                	mov    %esp,%ebp
+  80243c:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80243f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802444:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802448:	75 07                	jne    802451 <devcons_read+0x18>
+  80244a:	eb 1f                	jmp    80246b <devcons_read+0x32>
+		sys_yield();
+  80244c:	e8 54 ec ff ff       	call   8010a5 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802451:	e8 d0 eb ff ff       	call   801026 <sys_cgetc>
+  802456:	85 c0                	test   %eax,%eax
+  802458:	74 f2                	je     80244c <devcons_read+0x13>
+	if (c < 0)
+  80245a:	78 0f                	js     80246b <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80245c:	83 f8 04             	cmp    $0x4,%eax
+  80245f:	74 0c                	je     80246d <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802461:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802464:	88 02                	mov    %al,(%edx)
+	return 1;
+  802466:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80246b:	c9                   	leave
+  80246c:	c3                   	ret
+		return 0;
+  80246d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802472:	eb f7                	jmp    80246b <devcons_read+0x32>
+
+00802474 <cputchar>:
+{
+  802474:	55                   	push   %ebp
+  802475:	89 e5                	mov    %esp,%ebp
+  802477:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80247a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80247d:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802480:	6a 01                	push   $0x1
+  802482:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802485:	50                   	push   %eax
+  802486:	e8 7d eb ff ff       	call   801008 <sys_cputs>
+}
+  80248b:	83 c4 10             	add    $0x10,%esp
+  80248e:	c9                   	leave
+  80248f:	c3                   	ret
+
+00802490 <getchar>:
+{
+  802490:	55                   	push   %ebp
+  802491:	89 e5                	mov    %esp,%ebp
+  802493:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802496:	6a 01                	push   $0x1
+  802498:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80249b:	50                   	push   %eax
+  80249c:	6a 00                	push   $0x0
+  80249e:	e8 66 f2 ff ff       	call   801709 <read>
+	if (r < 0)
+  8024a3:	83 c4 10             	add    $0x10,%esp
+  8024a6:	85 c0                	test   %eax,%eax
+  8024a8:	78 06                	js     8024b0 <getchar+0x20>
+	if (r < 1)
+  8024aa:	74 06                	je     8024b2 <getchar+0x22>
+	return c;
+  8024ac:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8024b0:	c9                   	leave
+  8024b1:	c3                   	ret
+		return -E_EOF;
+  8024b2:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8024b7:	eb f7                	jmp    8024b0 <getchar+0x20>
+
+008024b9 <iscons>:
+{
+  8024b9:	55                   	push   %ebp
+  8024ba:	89 e5                	mov    %esp,%ebp
+  8024bc:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8024bf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024c2:	50                   	push   %eax
+  8024c3:	ff 75 08             	push   0x8(%ebp)
+  8024c6:	e8 d8 ef ff ff       	call   8014a3 <fd_lookup>
+  8024cb:	83 c4 10             	add    $0x10,%esp
+  8024ce:	85 c0                	test   %eax,%eax
+  8024d0:	78 11                	js     8024e3 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8024d2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024d5:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  8024db:	39 10                	cmp    %edx,(%eax)
+  8024dd:	0f 94 c0             	sete   %al
+  8024e0:	0f b6 c0             	movzbl %al,%eax
+}
+  8024e3:	c9                   	leave
+  8024e4:	c3                   	ret
+
+008024e5 <opencons>:
+{
+  8024e5:	55                   	push   %ebp
+  8024e6:	89 e5                	mov    %esp,%ebp
+  8024e8:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8024eb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024ee:	50                   	push   %eax
+  8024ef:	e8 59 ef ff ff       	call   80144d <fd_alloc>
+  8024f4:	83 c4 10             	add    $0x10,%esp
+  8024f7:	85 c0                	test   %eax,%eax
+  8024f9:	78 3a                	js     802535 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8024fb:	83 ec 04             	sub    $0x4,%esp
+  8024fe:	68 07 04 00 00       	push   $0x407
+  802503:	ff 75 f4             	push   -0xc(%ebp)
+  802506:	6a 00                	push   $0x0
+  802508:	e8 b7 eb ff ff       	call   8010c4 <sys_page_alloc>
+  80250d:	83 c4 10             	add    $0x10,%esp
+  802510:	85 c0                	test   %eax,%eax
+  802512:	78 21                	js     802535 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802514:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802517:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  80251d:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80251f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802522:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802529:	83 ec 0c             	sub    $0xc,%esp
+  80252c:	50                   	push   %eax
+  80252d:	e8 f4 ee ff ff       	call   801426 <fd2num>
+  802532:	83 c4 10             	add    $0x10,%esp
+}
+  802535:	c9                   	leave
+  802536:	c3                   	ret
+
+00802537 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  802537:	55                   	push   %ebp
+  802538:	89 e5                	mov    %esp,%ebp
+  80253a:	56                   	push   %esi
+  80253b:	53                   	push   %ebx
+  80253c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80253f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802542:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  802545:	85 c0                	test   %eax,%eax
+  802547:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80254c:	0f 44 c2             	cmove  %edx,%eax
+  80254f:	83 ec 0c             	sub    $0xc,%esp
+  802552:	50                   	push   %eax
+  802553:	e8 1c ed ff ff       	call   801274 <sys_ipc_recv>
+
+  if (from_env_store)
+  802558:	83 c4 10             	add    $0x10,%esp
+  80255b:	85 f6                	test   %esi,%esi
+  80255d:	74 17                	je     802576 <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  80255f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802564:	85 c0                	test   %eax,%eax
+  802566:	75 0c                	jne    802574 <ipc_recv+0x3d>
+  802568:	8b 15 b4 50 80 00    	mov    0x8050b4,%edx
+  80256e:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  802574:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  802576:	85 db                	test   %ebx,%ebx
+  802578:	74 2b                	je     8025a5 <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  80257a:	85 c0                	test   %eax,%eax
+  80257c:	74 0d                	je     80258b <ipc_recv+0x54>
+  80257e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  802584:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802587:	5b                   	pop    %ebx
+  802588:	5e                   	pop    %esi
+  802589:	5d                   	pop    %ebp
+  80258a:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  80258b:	a1 b4 50 80 00       	mov    0x8050b4,%eax
+  802590:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  802596:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  802598:	a1 b4 50 80 00       	mov    0x8050b4,%eax
+  80259d:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  8025a3:	eb df                	jmp    802584 <ipc_recv+0x4d>
+  8025a5:	85 c0                	test   %eax,%eax
+  8025a7:	75 db                	jne    802584 <ipc_recv+0x4d>
+  8025a9:	eb ed                	jmp    802598 <ipc_recv+0x61>
+
+008025ab <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  8025ab:	55                   	push   %ebp
+  8025ac:	89 e5                	mov    %esp,%ebp
+  8025ae:	57                   	push   %edi
+  8025af:	56                   	push   %esi
+  8025b0:	53                   	push   %ebx
+  8025b1:	83 ec 0c             	sub    $0xc,%esp
+  8025b4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8025b7:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8025ba:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  8025bd:	85 db                	test   %ebx,%ebx
+  8025bf:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8025c4:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  8025c7:	ff 75 14             	push   0x14(%ebp)
+  8025ca:	53                   	push   %ebx
+  8025cb:	56                   	push   %esi
+  8025cc:	57                   	push   %edi
+  8025cd:	e8 7f ec ff ff       	call   801251 <sys_ipc_try_send>
+  8025d2:	83 c4 10             	add    $0x10,%esp
+  8025d5:	85 c0                	test   %eax,%eax
+  8025d7:	74 1e                	je     8025f7 <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  8025d9:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8025dc:	75 07                	jne    8025e5 <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  8025de:	e8 c2 ea ff ff       	call   8010a5 <sys_yield>
+  8025e3:	eb e2                	jmp    8025c7 <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  8025e5:	50                   	push   %eax
+  8025e6:	68 33 31 80 00       	push   $0x803133
+  8025eb:	6a 3c                	push   $0x3c
+  8025ed:	68 40 31 80 00       	push   $0x803140
+  8025f2:	e8 4d e0 ff ff       	call   800644 <_panic>
+  }
+
+#endif
+}
+  8025f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025fa:	5b                   	pop    %ebx
+  8025fb:	5e                   	pop    %esi
+  8025fc:	5f                   	pop    %edi
+  8025fd:	5d                   	pop    %ebp
+  8025fe:	c3                   	ret
+
+008025ff <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  8025ff:	55                   	push   %ebp
+  802600:	89 e5                	mov    %esp,%ebp
+  802602:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  802605:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  80260a:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80260d:	c1 e0 04             	shl    $0x4,%eax
+  802610:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802615:	8b 40 50             	mov    0x50(%eax),%eax
+  802618:	39 c8                	cmp    %ecx,%eax
+  80261a:	74 12                	je     80262e <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  80261c:	83 c2 01             	add    $0x1,%edx
+  80261f:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802625:	75 e3                	jne    80260a <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802627:	b8 00 00 00 00       	mov    $0x0,%eax
+  80262c:	eb 0e                	jmp    80263c <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  80262e:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802631:	c1 e0 04             	shl    $0x4,%eax
+  802634:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802639:	8b 40 48             	mov    0x48(%eax),%eax
+  80263c:	5d                   	pop    %ebp
+  80263d:	c3                   	ret
+
+0080263e <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80263e:	55                   	push   %ebp
+  80263f:	89 e5                	mov    %esp,%ebp
+  802641:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802644:	89 c2                	mov    %eax,%edx
+  802646:	c1 ea 16             	shr    $0x16,%edx
+  802649:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802650:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802655:	f6 c1 01             	test   $0x1,%cl
+  802658:	74 1c                	je     802676 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  80265a:	c1 e8 0c             	shr    $0xc,%eax
+  80265d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802664:	a8 01                	test   $0x1,%al
+  802666:	74 0e                	je     802676 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802668:	c1 e8 0c             	shr    $0xc,%eax
+  80266b:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802672:	ef 
+  802673:	0f b7 d2             	movzwl %dx,%edx
+}
+  802676:	89 d0                	mov    %edx,%eax
+  802678:	5d                   	pop    %ebp
+  802679:	c3                   	ret
+  80267a:	66 90                	xchg   %ax,%ax
+  80267c:	66 90                	xchg   %ax,%ax
+  80267e:	66 90                	xchg   %ax,%ax
+
+00802680 <__udivmoddi4>:
+  802680:	55                   	push   %ebp
+  802681:	57                   	push   %edi
+  802682:	56                   	push   %esi
+  802683:	53                   	push   %ebx
+  802684:	83 ec 24             	sub    $0x24,%esp
+  802687:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80268b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80268f:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  802693:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802697:	8b 54 24 44          	mov    0x44(%esp),%edx
+  80269b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80269f:	8b 44 24 40          	mov    0x40(%esp),%eax
+  8026a3:	89 d3                	mov    %edx,%ebx
+  8026a5:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8026a9:	09 c3                	or     %eax,%ebx
+  8026ab:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8026af:	0f 84 9c 00 00 00    	je     802751 <__udivmoddi4+0xd1>
+  8026b5:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8026bc:	00 
+  8026bd:	31 c0                	xor    %eax,%eax
+  8026bf:	31 d2                	xor    %edx,%edx
+  8026c1:	89 fb                	mov    %edi,%ebx
+  8026c3:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8026ca:	00 
+  8026cb:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8026d0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8026d4:	01 c0                	add    %eax,%eax
+  8026d6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8026dd:	00 
+  8026de:	89 c6                	mov    %eax,%esi
+  8026e0:	89 d7                	mov    %edx,%edi
+  8026e2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8026e6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8026ea:	0f ad d0             	shrd   %cl,%edx,%eax
+  8026ed:	d3 ea                	shr    %cl,%edx
+  8026ef:	f6 c1 20             	test   $0x20,%cl
+  8026f2:	0f 45 c2             	cmovne %edx,%eax
+  8026f5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8026f9:	83 e0 01             	and    $0x1,%eax
+  8026fc:	09 fa                	or     %edi,%edx
+  8026fe:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802702:	89 04 24             	mov    %eax,(%esp)
+  802705:	8b 04 24             	mov    (%esp),%eax
+  802708:	89 d5                	mov    %edx,%ebp
+  80270a:	09 f0                	or     %esi,%eax
+  80270c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802710:	39 f0                	cmp    %esi,%eax
+  802712:	19 fd                	sbb    %edi,%ebp
+  802714:	72 1d                	jb     802733 <__udivmoddi4+0xb3>
+  802716:	29 f0                	sub    %esi,%eax
+  802718:	19 fa                	sbb    %edi,%edx
+  80271a:	89 cf                	mov    %ecx,%edi
+  80271c:	c1 ef 05             	shr    $0x5,%edi
+  80271f:	83 e7 01             	and    $0x1,%edi
+  802722:	89 fe                	mov    %edi,%esi
+  802724:	d3 e7                	shl    %cl,%edi
+  802726:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80272a:	83 f6 01             	xor    $0x1,%esi
+  80272d:	d3 e6                	shl    %cl,%esi
+  80272f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802733:	83 e9 01             	sub    $0x1,%ecx
+  802736:	73 98                	jae    8026d0 <__udivmoddi4+0x50>
+  802738:	85 db                	test   %ebx,%ebx
+  80273a:	74 05                	je     802741 <__udivmoddi4+0xc1>
+  80273c:	89 03                	mov    %eax,(%ebx)
+  80273e:	89 53 04             	mov    %edx,0x4(%ebx)
+  802741:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802745:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802749:	83 c4 24             	add    $0x24,%esp
+  80274c:	5b                   	pop    %ebx
+  80274d:	5e                   	pop    %esi
+  80274e:	5f                   	pop    %edi
+  80274f:	5d                   	pop    %ebp
+  802750:	c3                   	ret
+  802751:	85 ff                	test   %edi,%edi
+  802753:	74 0d                	je     802762 <__udivmoddi4+0xe2>
+  802755:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  80275b:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  802762:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802766:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80276a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80276e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802772:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802776:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80277a:	83 c4 24             	add    $0x24,%esp
+  80277d:	5b                   	pop    %ebx
+  80277e:	5e                   	pop    %esi
+  80277f:	5f                   	pop    %edi
+  802780:	5d                   	pop    %ebp
+  802781:	c3                   	ret
+  802782:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802789:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00802790 <__udivdi3>:
+  802790:	57                   	push   %edi
+  802791:	56                   	push   %esi
+  802792:	53                   	push   %ebx
+  802793:	83 ec 20             	sub    $0x20,%esp
+  802796:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80279a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80279e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8027a2:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8027a6:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8027aa:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8027ae:	89 d1                	mov    %edx,%ecx
+  8027b0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8027b4:	09 c1                	or     %eax,%ecx
+  8027b6:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8027ba:	89 44 24 18          	mov    %eax,0x18(%esp)
+  8027be:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  8027c2:	0f 84 88 00 00 00    	je     802850 <__udivdi3+0xc0>
+  8027c8:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8027cf:	00 
+  8027d0:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8027d5:	31 c0                	xor    %eax,%eax
+  8027d7:	31 d2                	xor    %edx,%edx
+  8027d9:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8027e0:	00 
+  8027e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8027e8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8027ec:	01 c0                	add    %eax,%eax
+  8027ee:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8027f5:	00 
+  8027f6:	89 c6                	mov    %eax,%esi
+  8027f8:	89 d7                	mov    %edx,%edi
+  8027fa:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8027fe:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802802:	0f ad d0             	shrd   %cl,%edx,%eax
+  802805:	d3 ea                	shr    %cl,%edx
+  802807:	f6 c1 20             	test   $0x20,%cl
+  80280a:	0f 45 c2             	cmovne %edx,%eax
+  80280d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802811:	83 e0 01             	and    $0x1,%eax
+  802814:	09 fa                	or     %edi,%edx
+  802816:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80281a:	89 04 24             	mov    %eax,(%esp)
+  80281d:	8b 04 24             	mov    (%esp),%eax
+  802820:	89 d3                	mov    %edx,%ebx
+  802822:	09 f0                	or     %esi,%eax
+  802824:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802828:	39 f0                	cmp    %esi,%eax
+  80282a:	19 fb                	sbb    %edi,%ebx
+  80282c:	72 1d                	jb     80284b <__udivdi3+0xbb>
+  80282e:	29 f0                	sub    %esi,%eax
+  802830:	19 fa                	sbb    %edi,%edx
+  802832:	89 cf                	mov    %ecx,%edi
+  802834:	c1 ef 05             	shr    $0x5,%edi
+  802837:	83 e7 01             	and    $0x1,%edi
+  80283a:	89 fe                	mov    %edi,%esi
+  80283c:	d3 e7                	shl    %cl,%edi
+  80283e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802842:	83 f6 01             	xor    $0x1,%esi
+  802845:	d3 e6                	shl    %cl,%esi
+  802847:	09 74 24 18          	or     %esi,0x18(%esp)
+  80284b:	83 e9 01             	sub    $0x1,%ecx
+  80284e:	73 98                	jae    8027e8 <__udivdi3+0x58>
+  802850:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802854:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802858:	83 c4 20             	add    $0x20,%esp
+  80285b:	5b                   	pop    %ebx
+  80285c:	5e                   	pop    %esi
+  80285d:	5f                   	pop    %edi
+  80285e:	c3                   	ret
+  80285f:	90                   	nop
+
+00802860 <__umoddi3>:
+  802860:	57                   	push   %edi
+  802861:	56                   	push   %esi
+  802862:	53                   	push   %ebx
+  802863:	83 ec 18             	sub    $0x18,%esp
+  802866:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80286a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80286e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802872:	8b 54 24 34          	mov    0x34(%esp),%edx
+  802876:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80287a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80287e:	89 d1                	mov    %edx,%ecx
+  802880:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802884:	09 c1                	or     %eax,%ecx
+  802886:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80288a:	74 5b                	je     8028e7 <__umoddi3+0x87>
+  80288c:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802891:	31 c0                	xor    %eax,%eax
+  802893:	31 d2                	xor    %edx,%edx
+  802895:	8d 76 00             	lea    0x0(%esi),%esi
+  802898:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80289c:	01 c0                	add    %eax,%eax
+  80289e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8028a5:	00 
+  8028a6:	89 c6                	mov    %eax,%esi
+  8028a8:	89 d7                	mov    %edx,%edi
+  8028aa:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8028ae:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8028b2:	0f ad d0             	shrd   %cl,%edx,%eax
+  8028b5:	d3 ea                	shr    %cl,%edx
+  8028b7:	f6 c1 20             	test   $0x20,%cl
+  8028ba:	0f 45 c2             	cmovne %edx,%eax
+  8028bd:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8028c1:	83 e0 01             	and    $0x1,%eax
+  8028c4:	09 fa                	or     %edi,%edx
+  8028c6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8028ca:	89 04 24             	mov    %eax,(%esp)
+  8028cd:	8b 04 24             	mov    (%esp),%eax
+  8028d0:	89 d3                	mov    %edx,%ebx
+  8028d2:	09 f0                	or     %esi,%eax
+  8028d4:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8028d8:	39 f0                	cmp    %esi,%eax
+  8028da:	19 fb                	sbb    %edi,%ebx
+  8028dc:	72 04                	jb     8028e2 <__umoddi3+0x82>
+  8028de:	29 f0                	sub    %esi,%eax
+  8028e0:	19 fa                	sbb    %edi,%edx
+  8028e2:	83 e9 01             	sub    $0x1,%ecx
+  8028e5:	73 b1                	jae    802898 <__umoddi3+0x38>
+  8028e7:	83 c4 18             	add    $0x18,%esp
+  8028ea:	5b                   	pop    %ebx
+  8028eb:	5e                   	pop    %esi
+  8028ec:	5f                   	pop    %edi
+  8028ed:	c3                   	ret
+  8028ee:	66 90                	xchg   %ax,%ax
+
+008028f0 <__divdi3>:
+  8028f0:	55                   	push   %ebp
+  8028f1:	57                   	push   %edi
+  8028f2:	56                   	push   %esi
+  8028f3:	53                   	push   %ebx
+  8028f4:	83 ec 24             	sub    $0x24,%esp
+  8028f7:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  8028fb:	8b 74 24 44          	mov    0x44(%esp),%esi
+  8028ff:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802903:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802907:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  80290b:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  80290f:	85 d2                	test   %edx,%edx
+  802911:	0f 88 e0 00 00 00    	js     8029f7 <__divdi3+0x107>
+  802917:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  80291b:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  80291f:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802923:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802927:	85 f6                	test   %esi,%esi
+  802929:	78 16                	js     802941 <__divdi3+0x51>
+  80292b:	89 f1                	mov    %esi,%ecx
+  80292d:	31 c0                	xor    %eax,%eax
+  80292f:	31 d2                	xor    %edx,%edx
+  802931:	09 d9                	or     %ebx,%ecx
+  802933:	0f 85 f3 00 00 00    	jne    802a2c <__divdi3+0x13c>
+  802939:	83 c4 24             	add    $0x24,%esp
+  80293c:	5b                   	pop    %ebx
+  80293d:	5e                   	pop    %esi
+  80293e:	5f                   	pop    %edi
+  80293f:	5d                   	pop    %ebp
+  802940:	c3                   	ret
+  802941:	bf 01 00 00 00       	mov    $0x1,%edi
+  802946:	f7 5c 24 08          	negl   0x8(%esp)
+  80294a:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  80294f:	f7 5c 24 0c          	negl   0xc(%esp)
+  802953:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80295a:	00 
+  80295b:	31 c0                	xor    %eax,%eax
+  80295d:	31 d2                	xor    %edx,%edx
+  80295f:	89 fb                	mov    %edi,%ebx
+  802961:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802968:	00 
+  802969:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80296e:	66 90                	xchg   %ax,%ax
+  802970:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802974:	01 c0                	add    %eax,%eax
+  802976:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80297d:	00 
+  80297e:	89 c6                	mov    %eax,%esi
+  802980:	89 d7                	mov    %edx,%edi
+  802982:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802986:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80298a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80298d:	d3 ea                	shr    %cl,%edx
+  80298f:	f6 c1 20             	test   $0x20,%cl
+  802992:	0f 45 c2             	cmovne %edx,%eax
+  802995:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802999:	83 e0 01             	and    $0x1,%eax
+  80299c:	09 fa                	or     %edi,%edx
+  80299e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8029a2:	89 04 24             	mov    %eax,(%esp)
+  8029a5:	8b 04 24             	mov    (%esp),%eax
+  8029a8:	89 d5                	mov    %edx,%ebp
+  8029aa:	09 f0                	or     %esi,%eax
+  8029ac:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8029b0:	39 f0                	cmp    %esi,%eax
+  8029b2:	19 fd                	sbb    %edi,%ebp
+  8029b4:	72 1d                	jb     8029d3 <__divdi3+0xe3>
+  8029b6:	29 f0                	sub    %esi,%eax
+  8029b8:	19 fa                	sbb    %edi,%edx
+  8029ba:	89 cf                	mov    %ecx,%edi
+  8029bc:	c1 ef 05             	shr    $0x5,%edi
+  8029bf:	83 e7 01             	and    $0x1,%edi
+  8029c2:	89 fe                	mov    %edi,%esi
+  8029c4:	d3 e7                	shl    %cl,%edi
+  8029c6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8029ca:	83 f6 01             	xor    $0x1,%esi
+  8029cd:	d3 e6                	shl    %cl,%esi
+  8029cf:	09 74 24 18          	or     %esi,0x18(%esp)
+  8029d3:	83 e9 01             	sub    $0x1,%ecx
+  8029d6:	73 98                	jae    802970 <__divdi3+0x80>
+  8029d8:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8029dc:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8029e0:	85 db                	test   %ebx,%ebx
+  8029e2:	0f 84 51 ff ff ff    	je     802939 <__divdi3+0x49>
+  8029e8:	f7 d8                	neg    %eax
+  8029ea:	83 d2 00             	adc    $0x0,%edx
+  8029ed:	83 c4 24             	add    $0x24,%esp
+  8029f0:	5b                   	pop    %ebx
+  8029f1:	f7 da                	neg    %edx
+  8029f3:	5e                   	pop    %esi
+  8029f4:	5f                   	pop    %edi
+  8029f5:	5d                   	pop    %ebp
+  8029f6:	c3                   	ret
+  8029f7:	f7 d8                	neg    %eax
+  8029f9:	83 d2 00             	adc    $0x0,%edx
+  8029fc:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802a00:	f7 da                	neg    %edx
+  802a02:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802a06:	85 f6                	test   %esi,%esi
+  802a08:	78 1b                	js     802a25 <__divdi3+0x135>
+  802a0a:	89 f1                	mov    %esi,%ecx
+  802a0c:	31 c0                	xor    %eax,%eax
+  802a0e:	31 d2                	xor    %edx,%edx
+  802a10:	bf 01 00 00 00       	mov    $0x1,%edi
+  802a15:	09 d9                	or     %ebx,%ecx
+  802a17:	0f 85 36 ff ff ff    	jne    802953 <__divdi3+0x63>
+  802a1d:	83 c4 24             	add    $0x24,%esp
+  802a20:	5b                   	pop    %ebx
+  802a21:	5e                   	pop    %esi
+  802a22:	5f                   	pop    %edi
+  802a23:	5d                   	pop    %ebp
+  802a24:	c3                   	ret
+  802a25:	31 ff                	xor    %edi,%edi
+  802a27:	e9 1a ff ff ff       	jmp    802946 <__divdi3+0x56>
+  802a2c:	31 ff                	xor    %edi,%edi
+  802a2e:	e9 20 ff ff ff       	jmp    802953 <__divdi3+0x63>
+  802a33:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802a3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00802a40 <__moddi3>:
+  802a40:	55                   	push   %ebp
+  802a41:	57                   	push   %edi
+  802a42:	56                   	push   %esi
+  802a43:	53                   	push   %ebx
+  802a44:	83 ec 1c             	sub    $0x1c,%esp
+  802a47:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  802a4b:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  802a4f:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  802a53:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  802a57:	89 c8                	mov    %ecx,%eax
+  802a59:	89 f2                	mov    %esi,%edx
+  802a5b:	89 f3                	mov    %esi,%ebx
+  802a5d:	85 ed                	test   %ebp,%ebp
+  802a5f:	0f 88 9d 00 00 00    	js     802b02 <__moddi3+0xc2>
+  802a65:	09 cb                	or     %ecx,%ebx
+  802a67:	0f 84 8d 00 00 00    	je     802afa <__moddi3+0xba>
+  802a6d:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802a71:	31 db                	xor    %ebx,%ebx
+  802a73:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802a77:	89 ca                	mov    %ecx,%edx
+  802a79:	89 f0                	mov    %esi,%eax
+  802a7b:	89 dd                	mov    %ebx,%ebp
+  802a7d:	f7 da                	neg    %edx
+  802a7f:	83 d0 00             	adc    $0x0,%eax
+  802a82:	f7 d8                	neg    %eax
+  802a84:	0f 49 f0             	cmovns %eax,%esi
+  802a87:	0f 49 ca             	cmovns %edx,%ecx
+  802a8a:	31 c0                	xor    %eax,%eax
+  802a8c:	31 d2                	xor    %edx,%edx
+  802a8e:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802a92:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802a96:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802a9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  802a9f:	90                   	nop
+  802aa0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802aa4:	01 c0                	add    %eax,%eax
+  802aa6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802aad:	00 
+  802aae:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  802ab2:	89 c6                	mov    %eax,%esi
+  802ab4:	89 d7                	mov    %edx,%edi
+  802ab6:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802aba:	8b 54 24 14          	mov    0x14(%esp),%edx
+  802abe:	0f ad d0             	shrd   %cl,%edx,%eax
+  802ac1:	d3 ea                	shr    %cl,%edx
+  802ac3:	f6 c1 20             	test   $0x20,%cl
+  802ac6:	0f 45 c2             	cmovne %edx,%eax
+  802ac9:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802acd:	83 e0 01             	and    $0x1,%eax
+  802ad0:	09 fa                	or     %edi,%edx
+  802ad2:	89 04 24             	mov    %eax,(%esp)
+  802ad5:	8b 04 24             	mov    (%esp),%eax
+  802ad8:	89 d7                	mov    %edx,%edi
+  802ada:	09 f0                	or     %esi,%eax
+  802adc:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  802ae0:	39 d8                	cmp    %ebx,%eax
+  802ae2:	19 f7                	sbb    %esi,%edi
+  802ae4:	72 04                	jb     802aea <__moddi3+0xaa>
+  802ae6:	29 d8                	sub    %ebx,%eax
+  802ae8:	19 f2                	sbb    %esi,%edx
+  802aea:	83 e9 01             	sub    $0x1,%ecx
+  802aed:	73 b1                	jae    802aa0 <__moddi3+0x60>
+  802aef:	85 ed                	test   %ebp,%ebp
+  802af1:	74 07                	je     802afa <__moddi3+0xba>
+  802af3:	f7 d8                	neg    %eax
+  802af5:	83 d2 00             	adc    $0x0,%edx
+  802af8:	f7 da                	neg    %edx
+  802afa:	83 c4 1c             	add    $0x1c,%esp
+  802afd:	5b                   	pop    %ebx
+  802afe:	5e                   	pop    %esi
+  802aff:	5f                   	pop    %edi
+  802b00:	5d                   	pop    %ebp
+  802b01:	c3                   	ret
+  802b02:	09 cb                	or     %ecx,%ebx
+  802b04:	74 f4                	je     802afa <__moddi3+0xba>
+  802b06:	f7 df                	neg    %edi
+  802b08:	bb 01 00 00 00       	mov    $0x1,%ebx
+  802b0d:	83 d5 00             	adc    $0x0,%ebp
+  802b10:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802b14:	f7 dd                	neg    %ebp
+  802b16:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802b1a:	e9 58 ff ff ff       	jmp    802a77 <__moddi3+0x37>
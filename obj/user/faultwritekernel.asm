@@ -0,0 +1,5251 @@
+
+obj/user/faultwritekernel.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 0d 00 00 00       	call   80003e <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+	*(unsigned*)0xf0100000 = 0;
+  800033:	c7 05 00 00 10 f0 00 	movl   $0x0,0xf0100000
+  80003a:	00 00 00 
+}
+  80003d:	c3                   	ret
+
+0080003e <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  80003e:	55                   	push   %ebp
+  80003f:	89 e5                	mov    %esp,%ebp
+  800041:	56                   	push   %esi
+  800042:	53                   	push   %ebx
+  800043:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800046:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  800049:	e8 d1 00 00 00       	call   80011f <sys_getenvid>
+  80004e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800053:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800056:	c1 e0 04             	shl    $0x4,%eax
+  800059:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80005e:	a3 08 40 80 00       	mov    %eax,0x804008
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800063:	85 db                	test   %ebx,%ebx
+  800065:	7e 07                	jle    80006e <libmain+0x30>
+    binaryname = argv[0];
+  800067:	8b 06                	mov    (%esi),%eax
+  800069:	a3 00 30 80 00       	mov    %eax,0x803000
+
+  // call user main routine
+  umain(argc, argv);
+  80006e:	83 ec 08             	sub    $0x8,%esp
+  800071:	56                   	push   %esi
+  800072:	53                   	push   %ebx
+  800073:	e8 bb ff ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  800078:	e8 0a 00 00 00       	call   800087 <exit>
+}
+  80007d:	83 c4 10             	add    $0x10,%esp
+  800080:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800083:	5b                   	pop    %ebx
+  800084:	5e                   	pop    %esi
+  800085:	5d                   	pop    %ebp
+  800086:	c3                   	ret
+
+00800087 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800087:	55                   	push   %ebp
+  800088:	89 e5                	mov    %esp,%ebp
+  80008a:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80008d:	e8 72 05 00 00       	call   800604 <close_all>
+	sys_env_destroy(0);
+  800092:	83 ec 0c             	sub    $0xc,%esp
+  800095:	6a 00                	push   $0x0
+  800097:	e8 42 00 00 00       	call   8000de <sys_env_destroy>
+}
+  80009c:	83 c4 10             	add    $0x10,%esp
+  80009f:	c9                   	leave
+  8000a0:	c3                   	ret
+
+008000a1 <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8000a1:	55                   	push   %ebp
+  8000a2:	89 e5                	mov    %esp,%ebp
+  8000a4:	57                   	push   %edi
+  8000a5:	56                   	push   %esi
+  8000a6:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8000a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000af:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000b2:	89 c3                	mov    %eax,%ebx
+  8000b4:	89 c7                	mov    %eax,%edi
+  8000b6:	89 c6                	mov    %eax,%esi
+  8000b8:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  8000ba:	5b                   	pop    %ebx
+  8000bb:	5e                   	pop    %esi
+  8000bc:	5f                   	pop    %edi
+  8000bd:	5d                   	pop    %ebp
+  8000be:	c3                   	ret
+
+008000bf <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8000bf:	55                   	push   %ebp
+  8000c0:	89 e5                	mov    %esp,%ebp
+  8000c2:	57                   	push   %edi
+  8000c3:	56                   	push   %esi
+  8000c4:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8000c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000ca:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000cf:	89 d1                	mov    %edx,%ecx
+  8000d1:	89 d3                	mov    %edx,%ebx
+  8000d3:	89 d7                	mov    %edx,%edi
+  8000d5:	89 d6                	mov    %edx,%esi
+  8000d7:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8000d9:	5b                   	pop    %ebx
+  8000da:	5e                   	pop    %esi
+  8000db:	5f                   	pop    %edi
+  8000dc:	5d                   	pop    %ebp
+  8000dd:	c3                   	ret
+
+008000de <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8000de:	55                   	push   %ebp
+  8000df:	89 e5                	mov    %esp,%ebp
+  8000e1:	57                   	push   %edi
+  8000e2:	56                   	push   %esi
+  8000e3:	53                   	push   %ebx
+  8000e4:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8000e7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000ef:	b8 03 00 00 00       	mov    $0x3,%eax
+  8000f4:	89 cb                	mov    %ecx,%ebx
+  8000f6:	89 cf                	mov    %ecx,%edi
+  8000f8:	89 ce                	mov    %ecx,%esi
+  8000fa:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8000fc:	85 c0                	test   %eax,%eax
+  8000fe:	7f 08                	jg     800108 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800100:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800103:	5b                   	pop    %ebx
+  800104:	5e                   	pop    %esi
+  800105:	5f                   	pop    %edi
+  800106:	5d                   	pop    %ebp
+  800107:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800108:	83 ec 0c             	sub    $0xc,%esp
+  80010b:	50                   	push   %eax
+  80010c:	6a 03                	push   $0x3
+  80010e:	68 0a 25 80 00       	push   $0x80250a
+  800113:	6a 3e                	push   $0x3e
+  800115:	68 27 25 80 00       	push   $0x802527
+  80011a:	e8 22 14 00 00       	call   801541 <_panic>
+
+0080011f <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80011f:	55                   	push   %ebp
+  800120:	89 e5                	mov    %esp,%ebp
+  800122:	57                   	push   %edi
+  800123:	56                   	push   %esi
+  800124:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800125:	ba 00 00 00 00       	mov    $0x0,%edx
+  80012a:	b8 02 00 00 00       	mov    $0x2,%eax
+  80012f:	89 d1                	mov    %edx,%ecx
+  800131:	89 d3                	mov    %edx,%ebx
+  800133:	89 d7                	mov    %edx,%edi
+  800135:	89 d6                	mov    %edx,%esi
+  800137:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800139:	5b                   	pop    %ebx
+  80013a:	5e                   	pop    %esi
+  80013b:	5f                   	pop    %edi
+  80013c:	5d                   	pop    %ebp
+  80013d:	c3                   	ret
+
+0080013e <sys_yield>:
+
+void
+sys_yield(void) {
+  80013e:	55                   	push   %ebp
+  80013f:	89 e5                	mov    %esp,%ebp
+  800141:	57                   	push   %edi
+  800142:	56                   	push   %esi
+  800143:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800144:	ba 00 00 00 00       	mov    $0x0,%edx
+  800149:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80014e:	89 d1                	mov    %edx,%ecx
+  800150:	89 d3                	mov    %edx,%ebx
+  800152:	89 d7                	mov    %edx,%edi
+  800154:	89 d6                	mov    %edx,%esi
+  800156:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800158:	5b                   	pop    %ebx
+  800159:	5e                   	pop    %esi
+  80015a:	5f                   	pop    %edi
+  80015b:	5d                   	pop    %ebp
+  80015c:	c3                   	ret
+
+0080015d <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  80015d:	55                   	push   %ebp
+  80015e:	89 e5                	mov    %esp,%ebp
+  800160:	57                   	push   %edi
+  800161:	56                   	push   %esi
+  800162:	53                   	push   %ebx
+  800163:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800166:	be 00 00 00 00       	mov    $0x0,%esi
+  80016b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80016e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800171:	b8 04 00 00 00       	mov    $0x4,%eax
+  800176:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800179:	89 f7                	mov    %esi,%edi
+  80017b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80017d:	85 c0                	test   %eax,%eax
+  80017f:	7f 08                	jg     800189 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800181:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800184:	5b                   	pop    %ebx
+  800185:	5e                   	pop    %esi
+  800186:	5f                   	pop    %edi
+  800187:	5d                   	pop    %ebp
+  800188:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800189:	83 ec 0c             	sub    $0xc,%esp
+  80018c:	50                   	push   %eax
+  80018d:	6a 04                	push   $0x4
+  80018f:	68 0a 25 80 00       	push   $0x80250a
+  800194:	6a 3e                	push   $0x3e
+  800196:	68 27 25 80 00       	push   $0x802527
+  80019b:	e8 a1 13 00 00       	call   801541 <_panic>
+
+008001a0 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  8001a0:	55                   	push   %ebp
+  8001a1:	89 e5                	mov    %esp,%ebp
+  8001a3:	57                   	push   %edi
+  8001a4:	56                   	push   %esi
+  8001a5:	53                   	push   %ebx
+  8001a6:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8001a9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001ac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001af:	b8 05 00 00 00       	mov    $0x5,%eax
+  8001b4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001b7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8001ba:	8b 75 18             	mov    0x18(%ebp),%esi
+  8001bd:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8001bf:	85 c0                	test   %eax,%eax
+  8001c1:	7f 08                	jg     8001cb <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  8001c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001c6:	5b                   	pop    %ebx
+  8001c7:	5e                   	pop    %esi
+  8001c8:	5f                   	pop    %edi
+  8001c9:	5d                   	pop    %ebp
+  8001ca:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8001cb:	83 ec 0c             	sub    $0xc,%esp
+  8001ce:	50                   	push   %eax
+  8001cf:	6a 05                	push   $0x5
+  8001d1:	68 0a 25 80 00       	push   $0x80250a
+  8001d6:	6a 3e                	push   $0x3e
+  8001d8:	68 27 25 80 00       	push   $0x802527
+  8001dd:	e8 5f 13 00 00       	call   801541 <_panic>
+
+008001e2 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  8001e2:	55                   	push   %ebp
+  8001e3:	89 e5                	mov    %esp,%ebp
+  8001e5:	57                   	push   %edi
+  8001e6:	56                   	push   %esi
+  8001e7:	53                   	push   %ebx
+  8001e8:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8001eb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001f0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001f3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001f6:	b8 06 00 00 00       	mov    $0x6,%eax
+  8001fb:	89 df                	mov    %ebx,%edi
+  8001fd:	89 de                	mov    %ebx,%esi
+  8001ff:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800201:	85 c0                	test   %eax,%eax
+  800203:	7f 08                	jg     80020d <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800205:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800208:	5b                   	pop    %ebx
+  800209:	5e                   	pop    %esi
+  80020a:	5f                   	pop    %edi
+  80020b:	5d                   	pop    %ebp
+  80020c:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80020d:	83 ec 0c             	sub    $0xc,%esp
+  800210:	50                   	push   %eax
+  800211:	6a 06                	push   $0x6
+  800213:	68 0a 25 80 00       	push   $0x80250a
+  800218:	6a 3e                	push   $0x3e
+  80021a:	68 27 25 80 00       	push   $0x802527
+  80021f:	e8 1d 13 00 00       	call   801541 <_panic>
+
+00800224 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800224:	55                   	push   %ebp
+  800225:	89 e5                	mov    %esp,%ebp
+  800227:	57                   	push   %edi
+  800228:	56                   	push   %esi
+  800229:	53                   	push   %ebx
+  80022a:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  80022d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800232:	8b 55 08             	mov    0x8(%ebp),%edx
+  800235:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800238:	b8 08 00 00 00       	mov    $0x8,%eax
+  80023d:	89 df                	mov    %ebx,%edi
+  80023f:	89 de                	mov    %ebx,%esi
+  800241:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800243:	85 c0                	test   %eax,%eax
+  800245:	7f 08                	jg     80024f <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800247:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80024a:	5b                   	pop    %ebx
+  80024b:	5e                   	pop    %esi
+  80024c:	5f                   	pop    %edi
+  80024d:	5d                   	pop    %ebp
+  80024e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80024f:	83 ec 0c             	sub    $0xc,%esp
+  800252:	50                   	push   %eax
+  800253:	6a 08                	push   $0x8
+  800255:	68 0a 25 80 00       	push   $0x80250a
+  80025a:	6a 3e                	push   $0x3e
+  80025c:	68 27 25 80 00       	push   $0x802527
+  800261:	e8 db 12 00 00       	call   801541 <_panic>
+
+00800266 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800266:	55                   	push   %ebp
+  800267:	89 e5                	mov    %esp,%ebp
+  800269:	57                   	push   %edi
+  80026a:	56                   	push   %esi
+  80026b:	53                   	push   %ebx
+  80026c:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  80026f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800274:	8b 55 08             	mov    0x8(%ebp),%edx
+  800277:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80027a:	b8 09 00 00 00       	mov    $0x9,%eax
+  80027f:	89 df                	mov    %ebx,%edi
+  800281:	89 de                	mov    %ebx,%esi
+  800283:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800285:	85 c0                	test   %eax,%eax
+  800287:	7f 08                	jg     800291 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800289:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80028c:	5b                   	pop    %ebx
+  80028d:	5e                   	pop    %esi
+  80028e:	5f                   	pop    %edi
+  80028f:	5d                   	pop    %ebp
+  800290:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800291:	83 ec 0c             	sub    $0xc,%esp
+  800294:	50                   	push   %eax
+  800295:	6a 09                	push   $0x9
+  800297:	68 0a 25 80 00       	push   $0x80250a
+  80029c:	6a 3e                	push   $0x3e
+  80029e:	68 27 25 80 00       	push   $0x802527
+  8002a3:	e8 99 12 00 00       	call   801541 <_panic>
+
+008002a8 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8002a8:	55                   	push   %ebp
+  8002a9:	89 e5                	mov    %esp,%ebp
+  8002ab:	57                   	push   %edi
+  8002ac:	56                   	push   %esi
+  8002ad:	53                   	push   %ebx
+  8002ae:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8002b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002b6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002b9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002bc:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8002c1:	89 df                	mov    %ebx,%edi
+  8002c3:	89 de                	mov    %ebx,%esi
+  8002c5:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8002c7:	85 c0                	test   %eax,%eax
+  8002c9:	7f 08                	jg     8002d3 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8002cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002ce:	5b                   	pop    %ebx
+  8002cf:	5e                   	pop    %esi
+  8002d0:	5f                   	pop    %edi
+  8002d1:	5d                   	pop    %ebp
+  8002d2:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8002d3:	83 ec 0c             	sub    $0xc,%esp
+  8002d6:	50                   	push   %eax
+  8002d7:	6a 0a                	push   $0xa
+  8002d9:	68 0a 25 80 00       	push   $0x80250a
+  8002de:	6a 3e                	push   $0x3e
+  8002e0:	68 27 25 80 00       	push   $0x802527
+  8002e5:	e8 57 12 00 00       	call   801541 <_panic>
+
+008002ea <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  8002ea:	55                   	push   %ebp
+  8002eb:	89 e5                	mov    %esp,%ebp
+  8002ed:	57                   	push   %edi
+  8002ee:	56                   	push   %esi
+  8002ef:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8002f0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002f3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002f6:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8002fb:	be 00 00 00 00       	mov    $0x0,%esi
+  800300:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800303:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800306:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800308:	5b                   	pop    %ebx
+  800309:	5e                   	pop    %esi
+  80030a:	5f                   	pop    %edi
+  80030b:	5d                   	pop    %ebp
+  80030c:	c3                   	ret
+
+0080030d <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  80030d:	55                   	push   %ebp
+  80030e:	89 e5                	mov    %esp,%ebp
+  800310:	57                   	push   %edi
+  800311:	56                   	push   %esi
+  800312:	53                   	push   %ebx
+  800313:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800316:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80031b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80031e:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800323:	89 cb                	mov    %ecx,%ebx
+  800325:	89 cf                	mov    %ecx,%edi
+  800327:	89 ce                	mov    %ecx,%esi
+  800329:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80032b:	85 c0                	test   %eax,%eax
+  80032d:	7f 08                	jg     800337 <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  80032f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800332:	5b                   	pop    %ebx
+  800333:	5e                   	pop    %esi
+  800334:	5f                   	pop    %edi
+  800335:	5d                   	pop    %ebp
+  800336:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800337:	83 ec 0c             	sub    $0xc,%esp
+  80033a:	50                   	push   %eax
+  80033b:	6a 0d                	push   $0xd
+  80033d:	68 0a 25 80 00       	push   $0x80250a
+  800342:	6a 3e                	push   $0x3e
+  800344:	68 27 25 80 00       	push   $0x802527
+  800349:	e8 f3 11 00 00       	call   801541 <_panic>
+
+0080034e <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  80034e:	55                   	push   %ebp
+  80034f:	89 e5                	mov    %esp,%ebp
+  800351:	57                   	push   %edi
+  800352:	56                   	push   %esi
+  800353:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800354:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800359:	8b 55 08             	mov    0x8(%ebp),%edx
+  80035c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80035f:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800364:	89 df                	mov    %ebx,%edi
+  800366:	89 de                	mov    %ebx,%esi
+  800368:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  80036a:	5b                   	pop    %ebx
+  80036b:	5e                   	pop    %esi
+  80036c:	5f                   	pop    %edi
+  80036d:	5d                   	pop    %ebp
+  80036e:	c3                   	ret
+
+0080036f <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  80036f:	55                   	push   %ebp
+  800370:	89 e5                	mov    %esp,%ebp
+  800372:	57                   	push   %edi
+  800373:	56                   	push   %esi
+  800374:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800375:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80037a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80037d:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800382:	89 cb                	mov    %ecx,%ebx
+  800384:	89 cf                	mov    %ecx,%edi
+  800386:	89 ce                	mov    %ecx,%esi
+  800388:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  80038a:	5b                   	pop    %ebx
+  80038b:	5e                   	pop    %esi
+  80038c:	5f                   	pop    %edi
+  80038d:	5d                   	pop    %ebp
+  80038e:	c3                   	ret
+
+0080038f <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  80038f:	55                   	push   %ebp
+  800390:	89 e5                	mov    %esp,%ebp
+  800392:	57                   	push   %edi
+  800393:	56                   	push   %esi
+  800394:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800395:	ba 00 00 00 00       	mov    $0x0,%edx
+  80039a:	b8 10 00 00 00       	mov    $0x10,%eax
+  80039f:	89 d1                	mov    %edx,%ecx
+  8003a1:	89 d3                	mov    %edx,%ebx
+  8003a3:	89 d7                	mov    %edx,%edi
+  8003a5:	89 d6                	mov    %edx,%esi
+  8003a7:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8003a9:	5b                   	pop    %ebx
+  8003aa:	5e                   	pop    %esi
+  8003ab:	5f                   	pop    %edi
+  8003ac:	5d                   	pop    %ebp
+  8003ad:	c3                   	ret
+
+008003ae <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  8003ae:	55                   	push   %ebp
+  8003af:	89 e5                	mov    %esp,%ebp
+  8003b1:	57                   	push   %edi
+  8003b2:	56                   	push   %esi
+  8003b3:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8003b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003b9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003bc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003bf:	b8 11 00 00 00       	mov    $0x11,%eax
+  8003c4:	89 df                	mov    %ebx,%edi
+  8003c6:	89 de                	mov    %ebx,%esi
+  8003c8:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  8003ca:	5b                   	pop    %ebx
+  8003cb:	5e                   	pop    %esi
+  8003cc:	5f                   	pop    %edi
+  8003cd:	5d                   	pop    %ebp
+  8003ce:	c3                   	ret
+
+008003cf <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  8003cf:	55                   	push   %ebp
+  8003d0:	89 e5                	mov    %esp,%ebp
+  8003d2:	57                   	push   %edi
+  8003d3:	56                   	push   %esi
+  8003d4:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8003d5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003da:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003dd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003e0:	b8 12 00 00 00       	mov    $0x12,%eax
+  8003e5:	89 df                	mov    %ebx,%edi
+  8003e7:	89 de                	mov    %ebx,%esi
+  8003e9:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  8003eb:	5b                   	pop    %ebx
+  8003ec:	5e                   	pop    %esi
+  8003ed:	5f                   	pop    %edi
+  8003ee:	5d                   	pop    %ebp
+  8003ef:	c3                   	ret
+
+008003f0 <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  8003f0:	55                   	push   %ebp
+  8003f1:	89 e5                	mov    %esp,%ebp
+  8003f3:	57                   	push   %edi
+  8003f4:	56                   	push   %esi
+  8003f5:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8003f6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8003fb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003fe:	b8 13 00 00 00       	mov    $0x13,%eax
+  800403:	89 cb                	mov    %ecx,%ebx
+  800405:	89 cf                	mov    %ecx,%edi
+  800407:	89 ce                	mov    %ecx,%esi
+  800409:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  80040b:	5b                   	pop    %ebx
+  80040c:	5e                   	pop    %esi
+  80040d:	5f                   	pop    %edi
+  80040e:	5d                   	pop    %ebp
+  80040f:	c3                   	ret
+
+00800410 <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  800410:	55                   	push   %ebp
+  800411:	89 e5                	mov    %esp,%ebp
+  800413:	57                   	push   %edi
+  800414:	56                   	push   %esi
+  800415:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800416:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80041b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80041e:	b8 14 00 00 00       	mov    $0x14,%eax
+  800423:	89 cb                	mov    %ecx,%ebx
+  800425:	89 cf                	mov    %ecx,%edi
+  800427:	89 ce                	mov    %ecx,%esi
+  800429:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  80042b:	5b                   	pop    %ebx
+  80042c:	5e                   	pop    %esi
+  80042d:	5f                   	pop    %edi
+  80042e:	5d                   	pop    %ebp
+  80042f:	c3                   	ret
+
+00800430 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800430:	55                   	push   %ebp
+  800431:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800433:	8b 45 08             	mov    0x8(%ebp),%eax
+  800436:	05 00 00 00 30       	add    $0x30000000,%eax
+  80043b:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80043e:	5d                   	pop    %ebp
+  80043f:	c3                   	ret
+
+00800440 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800440:	55                   	push   %ebp
+  800441:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800443:	8b 45 08             	mov    0x8(%ebp),%eax
+  800446:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80044b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800450:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800455:	5d                   	pop    %ebp
+  800456:	c3                   	ret
+
+00800457 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800457:	55                   	push   %ebp
+  800458:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80045a:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80045f:	eb 02                	jmp    800463 <fd_alloc+0xc>
+  800461:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800463:	89 c2                	mov    %eax,%edx
+  800465:	c1 ea 16             	shr    $0x16,%edx
+  800468:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80046f:	f6 c2 01             	test   $0x1,%dl
+  800472:	74 2b                	je     80049f <fd_alloc+0x48>
+  800474:	89 c2                	mov    %eax,%edx
+  800476:	c1 ea 0c             	shr    $0xc,%edx
+  800479:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  800480:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  800486:	f6 c1 01             	test   $0x1,%cl
+  800489:	74 14                	je     80049f <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80048b:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  800491:	75 ce                	jne    800461 <fd_alloc+0xa>
+  800493:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  800498:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80049d:	eb 05                	jmp    8004a4 <fd_alloc+0x4d>
+			return 0;
+  80049f:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8004a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004a7:	89 02                	mov    %eax,(%edx)
+}
+  8004a9:	89 c8                	mov    %ecx,%eax
+  8004ab:	5d                   	pop    %ebp
+  8004ac:	c3                   	ret
+
+008004ad <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8004ad:	55                   	push   %ebp
+  8004ae:	89 e5                	mov    %esp,%ebp
+  8004b0:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8004b3:	83 f8 1f             	cmp    $0x1f,%eax
+  8004b6:	77 30                	ja     8004e8 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8004b8:	c1 e0 0c             	shl    $0xc,%eax
+  8004bb:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8004c0:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8004c6:	f6 c2 01             	test   $0x1,%dl
+  8004c9:	74 24                	je     8004ef <fd_lookup+0x42>
+  8004cb:	89 c2                	mov    %eax,%edx
+  8004cd:	c1 ea 0c             	shr    $0xc,%edx
+  8004d0:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8004d7:	f6 c2 01             	test   $0x1,%dl
+  8004da:	74 1a                	je     8004f6 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8004dc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8004df:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8004e1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8004e6:	5d                   	pop    %ebp
+  8004e7:	c3                   	ret
+		return -E_INVAL;
+  8004e8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8004ed:	eb f7                	jmp    8004e6 <fd_lookup+0x39>
+		return -E_INVAL;
+  8004ef:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8004f4:	eb f0                	jmp    8004e6 <fd_lookup+0x39>
+  8004f6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8004fb:	eb e9                	jmp    8004e6 <fd_lookup+0x39>
+
+008004fd <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8004fd:	55                   	push   %ebp
+  8004fe:	89 e5                	mov    %esp,%ebp
+  800500:	53                   	push   %ebx
+  800501:	83 ec 04             	sub    $0x4,%esp
+  800504:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  800507:	b8 00 00 00 00       	mov    $0x0,%eax
+  80050c:	eb 03                	jmp    800511 <dev_lookup+0x14>
+  80050e:	83 c0 01             	add    $0x1,%eax
+  800511:	8b 1c 85 b4 25 80 00 	mov    0x8025b4(,%eax,4),%ebx
+  800518:	85 db                	test   %ebx,%ebx
+  80051a:	74 0b                	je     800527 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  80051c:	39 13                	cmp    %edx,(%ebx)
+  80051e:	75 ee                	jne    80050e <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  800520:	b8 00 00 00 00       	mov    $0x0,%eax
+  800525:	eb 1f                	jmp    800546 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800527:	a1 08 40 80 00       	mov    0x804008,%eax
+  80052c:	8b 40 48             	mov    0x48(%eax),%eax
+  80052f:	83 ec 04             	sub    $0x4,%esp
+  800532:	52                   	push   %edx
+  800533:	50                   	push   %eax
+  800534:	68 38 25 80 00       	push   $0x802538
+  800539:	e8 de 10 00 00       	call   80161c <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80053e:	83 c4 10             	add    $0x10,%esp
+  800541:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  800546:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800549:	89 1a                	mov    %ebx,(%edx)
+}
+  80054b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80054e:	c9                   	leave
+  80054f:	c3                   	ret
+
+00800550 <fd_close>:
+{
+  800550:	55                   	push   %ebp
+  800551:	89 e5                	mov    %esp,%ebp
+  800553:	57                   	push   %edi
+  800554:	56                   	push   %esi
+  800555:	53                   	push   %ebx
+  800556:	83 ec 24             	sub    $0x24,%esp
+  800559:	8b 75 08             	mov    0x8(%ebp),%esi
+  80055c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80055f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800562:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800563:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800569:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80056c:	50                   	push   %eax
+  80056d:	e8 3b ff ff ff       	call   8004ad <fd_lookup>
+  800572:	89 c3                	mov    %eax,%ebx
+  800574:	83 c4 10             	add    $0x10,%esp
+  800577:	85 c0                	test   %eax,%eax
+  800579:	78 05                	js     800580 <fd_close+0x30>
+	    || fd != fd2)
+  80057b:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80057e:	74 16                	je     800596 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  800580:	89 f8                	mov    %edi,%eax
+  800582:	84 c0                	test   %al,%al
+  800584:	b8 00 00 00 00       	mov    $0x0,%eax
+  800589:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80058c:	89 d8                	mov    %ebx,%eax
+  80058e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800591:	5b                   	pop    %ebx
+  800592:	5e                   	pop    %esi
+  800593:	5f                   	pop    %edi
+  800594:	5d                   	pop    %ebp
+  800595:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800596:	83 ec 08             	sub    $0x8,%esp
+  800599:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80059c:	50                   	push   %eax
+  80059d:	ff 36                	push   (%esi)
+  80059f:	e8 59 ff ff ff       	call   8004fd <dev_lookup>
+  8005a4:	89 c3                	mov    %eax,%ebx
+  8005a6:	83 c4 10             	add    $0x10,%esp
+  8005a9:	85 c0                	test   %eax,%eax
+  8005ab:	78 1a                	js     8005c7 <fd_close+0x77>
+		if (dev->dev_close)
+  8005ad:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005b0:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8005b3:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8005b8:	85 c0                	test   %eax,%eax
+  8005ba:	74 0b                	je     8005c7 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8005bc:	83 ec 0c             	sub    $0xc,%esp
+  8005bf:	56                   	push   %esi
+  8005c0:	ff d0                	call   *%eax
+  8005c2:	89 c3                	mov    %eax,%ebx
+  8005c4:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8005c7:	83 ec 08             	sub    $0x8,%esp
+  8005ca:	56                   	push   %esi
+  8005cb:	6a 00                	push   $0x0
+  8005cd:	e8 10 fc ff ff       	call   8001e2 <sys_page_unmap>
+	return r;
+  8005d2:	83 c4 10             	add    $0x10,%esp
+  8005d5:	eb b5                	jmp    80058c <fd_close+0x3c>
+
+008005d7 <close>:
+
+int
+close(int fdnum)
+{
+  8005d7:	55                   	push   %ebp
+  8005d8:	89 e5                	mov    %esp,%ebp
+  8005da:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8005dd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8005e0:	50                   	push   %eax
+  8005e1:	ff 75 08             	push   0x8(%ebp)
+  8005e4:	e8 c4 fe ff ff       	call   8004ad <fd_lookup>
+  8005e9:	83 c4 10             	add    $0x10,%esp
+  8005ec:	85 c0                	test   %eax,%eax
+  8005ee:	79 02                	jns    8005f2 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8005f0:	c9                   	leave
+  8005f1:	c3                   	ret
+		return fd_close(fd, 1);
+  8005f2:	83 ec 08             	sub    $0x8,%esp
+  8005f5:	6a 01                	push   $0x1
+  8005f7:	ff 75 f4             	push   -0xc(%ebp)
+  8005fa:	e8 51 ff ff ff       	call   800550 <fd_close>
+  8005ff:	83 c4 10             	add    $0x10,%esp
+  800602:	eb ec                	jmp    8005f0 <close+0x19>
+
+00800604 <close_all>:
+
+void
+close_all(void)
+{
+  800604:	55                   	push   %ebp
+  800605:	89 e5                	mov    %esp,%ebp
+  800607:	53                   	push   %ebx
+  800608:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80060b:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  800610:	83 ec 0c             	sub    $0xc,%esp
+  800613:	53                   	push   %ebx
+  800614:	e8 be ff ff ff       	call   8005d7 <close>
+	for (i = 0; i < MAXFD; i++)
+  800619:	83 c3 01             	add    $0x1,%ebx
+  80061c:	83 c4 10             	add    $0x10,%esp
+  80061f:	83 fb 20             	cmp    $0x20,%ebx
+  800622:	75 ec                	jne    800610 <close_all+0xc>
+}
+  800624:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800627:	c9                   	leave
+  800628:	c3                   	ret
+
+00800629 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  800629:	55                   	push   %ebp
+  80062a:	89 e5                	mov    %esp,%ebp
+  80062c:	57                   	push   %edi
+  80062d:	56                   	push   %esi
+  80062e:	53                   	push   %ebx
+  80062f:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800632:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800635:	50                   	push   %eax
+  800636:	ff 75 08             	push   0x8(%ebp)
+  800639:	e8 6f fe ff ff       	call   8004ad <fd_lookup>
+  80063e:	89 c3                	mov    %eax,%ebx
+  800640:	83 c4 10             	add    $0x10,%esp
+  800643:	85 c0                	test   %eax,%eax
+  800645:	78 7f                	js     8006c6 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  800647:	83 ec 0c             	sub    $0xc,%esp
+  80064a:	ff 75 0c             	push   0xc(%ebp)
+  80064d:	e8 85 ff ff ff       	call   8005d7 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  800652:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800655:	c1 e6 0c             	shl    $0xc,%esi
+  800658:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80065e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800661:	89 3c 24             	mov    %edi,(%esp)
+  800664:	e8 d7 fd ff ff       	call   800440 <fd2data>
+  800669:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80066b:	89 34 24             	mov    %esi,(%esp)
+  80066e:	e8 cd fd ff ff       	call   800440 <fd2data>
+  800673:	83 c4 10             	add    $0x10,%esp
+  800676:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  800679:	89 d8                	mov    %ebx,%eax
+  80067b:	c1 e8 16             	shr    $0x16,%eax
+  80067e:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  800685:	a8 01                	test   $0x1,%al
+  800687:	74 11                	je     80069a <dup+0x71>
+  800689:	89 d8                	mov    %ebx,%eax
+  80068b:	c1 e8 0c             	shr    $0xc,%eax
+  80068e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  800695:	f6 c2 01             	test   $0x1,%dl
+  800698:	75 36                	jne    8006d0 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80069a:	89 f8                	mov    %edi,%eax
+  80069c:	c1 e8 0c             	shr    $0xc,%eax
+  80069f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8006a6:	83 ec 0c             	sub    $0xc,%esp
+  8006a9:	25 07 0e 00 00       	and    $0xe07,%eax
+  8006ae:	50                   	push   %eax
+  8006af:	56                   	push   %esi
+  8006b0:	6a 00                	push   $0x0
+  8006b2:	57                   	push   %edi
+  8006b3:	6a 00                	push   $0x0
+  8006b5:	e8 e6 fa ff ff       	call   8001a0 <sys_page_map>
+  8006ba:	89 c3                	mov    %eax,%ebx
+  8006bc:	83 c4 20             	add    $0x20,%esp
+  8006bf:	85 c0                	test   %eax,%eax
+  8006c1:	78 33                	js     8006f6 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8006c3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8006c6:	89 d8                	mov    %ebx,%eax
+  8006c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006cb:	5b                   	pop    %ebx
+  8006cc:	5e                   	pop    %esi
+  8006cd:	5f                   	pop    %edi
+  8006ce:	5d                   	pop    %ebp
+  8006cf:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8006d0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8006d7:	83 ec 0c             	sub    $0xc,%esp
+  8006da:	25 07 0e 00 00       	and    $0xe07,%eax
+  8006df:	50                   	push   %eax
+  8006e0:	ff 75 d4             	push   -0x2c(%ebp)
+  8006e3:	6a 00                	push   $0x0
+  8006e5:	53                   	push   %ebx
+  8006e6:	6a 00                	push   $0x0
+  8006e8:	e8 b3 fa ff ff       	call   8001a0 <sys_page_map>
+  8006ed:	89 c3                	mov    %eax,%ebx
+  8006ef:	83 c4 20             	add    $0x20,%esp
+  8006f2:	85 c0                	test   %eax,%eax
+  8006f4:	79 a4                	jns    80069a <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8006f6:	83 ec 08             	sub    $0x8,%esp
+  8006f9:	56                   	push   %esi
+  8006fa:	6a 00                	push   $0x0
+  8006fc:	e8 e1 fa ff ff       	call   8001e2 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  800701:	83 c4 08             	add    $0x8,%esp
+  800704:	ff 75 d4             	push   -0x2c(%ebp)
+  800707:	6a 00                	push   $0x0
+  800709:	e8 d4 fa ff ff       	call   8001e2 <sys_page_unmap>
+	return r;
+  80070e:	83 c4 10             	add    $0x10,%esp
+  800711:	eb b3                	jmp    8006c6 <dup+0x9d>
+
+00800713 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  800713:	55                   	push   %ebp
+  800714:	89 e5                	mov    %esp,%ebp
+  800716:	56                   	push   %esi
+  800717:	53                   	push   %ebx
+  800718:	83 ec 18             	sub    $0x18,%esp
+  80071b:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80071e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800721:	50                   	push   %eax
+  800722:	56                   	push   %esi
+  800723:	e8 85 fd ff ff       	call   8004ad <fd_lookup>
+  800728:	83 c4 10             	add    $0x10,%esp
+  80072b:	85 c0                	test   %eax,%eax
+  80072d:	78 3c                	js     80076b <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80072f:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  800732:	83 ec 08             	sub    $0x8,%esp
+  800735:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800738:	50                   	push   %eax
+  800739:	ff 33                	push   (%ebx)
+  80073b:	e8 bd fd ff ff       	call   8004fd <dev_lookup>
+  800740:	83 c4 10             	add    $0x10,%esp
+  800743:	85 c0                	test   %eax,%eax
+  800745:	78 24                	js     80076b <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800747:	8b 43 08             	mov    0x8(%ebx),%eax
+  80074a:	83 e0 03             	and    $0x3,%eax
+  80074d:	83 f8 01             	cmp    $0x1,%eax
+  800750:	74 20                	je     800772 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  800752:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800755:	8b 40 08             	mov    0x8(%eax),%eax
+  800758:	85 c0                	test   %eax,%eax
+  80075a:	74 37                	je     800793 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80075c:	83 ec 04             	sub    $0x4,%esp
+  80075f:	ff 75 10             	push   0x10(%ebp)
+  800762:	ff 75 0c             	push   0xc(%ebp)
+  800765:	53                   	push   %ebx
+  800766:	ff d0                	call   *%eax
+  800768:	83 c4 10             	add    $0x10,%esp
+}
+  80076b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80076e:	5b                   	pop    %ebx
+  80076f:	5e                   	pop    %esi
+  800770:	5d                   	pop    %ebp
+  800771:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800772:	a1 08 40 80 00       	mov    0x804008,%eax
+  800777:	8b 40 48             	mov    0x48(%eax),%eax
+  80077a:	83 ec 04             	sub    $0x4,%esp
+  80077d:	56                   	push   %esi
+  80077e:	50                   	push   %eax
+  80077f:	68 79 25 80 00       	push   $0x802579
+  800784:	e8 93 0e 00 00       	call   80161c <cprintf>
+		return -E_INVAL;
+  800789:	83 c4 10             	add    $0x10,%esp
+  80078c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800791:	eb d8                	jmp    80076b <read+0x58>
+		return -E_NOT_SUPP;
+  800793:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800798:	eb d1                	jmp    80076b <read+0x58>
+
+0080079a <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80079a:	55                   	push   %ebp
+  80079b:	89 e5                	mov    %esp,%ebp
+  80079d:	57                   	push   %edi
+  80079e:	56                   	push   %esi
+  80079f:	53                   	push   %ebx
+  8007a0:	83 ec 0c             	sub    $0xc,%esp
+  8007a3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8007a6:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8007a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8007ae:	eb 02                	jmp    8007b2 <readn+0x18>
+  8007b0:	01 c3                	add    %eax,%ebx
+  8007b2:	39 f3                	cmp    %esi,%ebx
+  8007b4:	73 21                	jae    8007d7 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8007b6:	83 ec 04             	sub    $0x4,%esp
+  8007b9:	89 f0                	mov    %esi,%eax
+  8007bb:	29 d8                	sub    %ebx,%eax
+  8007bd:	50                   	push   %eax
+  8007be:	89 d8                	mov    %ebx,%eax
+  8007c0:	03 45 0c             	add    0xc(%ebp),%eax
+  8007c3:	50                   	push   %eax
+  8007c4:	57                   	push   %edi
+  8007c5:	e8 49 ff ff ff       	call   800713 <read>
+		if (m < 0)
+  8007ca:	83 c4 10             	add    $0x10,%esp
+  8007cd:	85 c0                	test   %eax,%eax
+  8007cf:	78 04                	js     8007d5 <readn+0x3b>
+			return m;
+		if (m == 0)
+  8007d1:	75 dd                	jne    8007b0 <readn+0x16>
+  8007d3:	eb 02                	jmp    8007d7 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8007d5:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8007d7:	89 d8                	mov    %ebx,%eax
+  8007d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007dc:	5b                   	pop    %ebx
+  8007dd:	5e                   	pop    %esi
+  8007de:	5f                   	pop    %edi
+  8007df:	5d                   	pop    %ebp
+  8007e0:	c3                   	ret
+
+008007e1 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8007e1:	55                   	push   %ebp
+  8007e2:	89 e5                	mov    %esp,%ebp
+  8007e4:	56                   	push   %esi
+  8007e5:	53                   	push   %ebx
+  8007e6:	83 ec 18             	sub    $0x18,%esp
+  8007e9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8007ec:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8007ef:	50                   	push   %eax
+  8007f0:	53                   	push   %ebx
+  8007f1:	e8 b7 fc ff ff       	call   8004ad <fd_lookup>
+  8007f6:	83 c4 10             	add    $0x10,%esp
+  8007f9:	85 c0                	test   %eax,%eax
+  8007fb:	78 37                	js     800834 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8007fd:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800800:	83 ec 08             	sub    $0x8,%esp
+  800803:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800806:	50                   	push   %eax
+  800807:	ff 36                	push   (%esi)
+  800809:	e8 ef fc ff ff       	call   8004fd <dev_lookup>
+  80080e:	83 c4 10             	add    $0x10,%esp
+  800811:	85 c0                	test   %eax,%eax
+  800813:	78 1f                	js     800834 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800815:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800819:	74 20                	je     80083b <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80081b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80081e:	8b 40 0c             	mov    0xc(%eax),%eax
+  800821:	85 c0                	test   %eax,%eax
+  800823:	74 37                	je     80085c <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  800825:	83 ec 04             	sub    $0x4,%esp
+  800828:	ff 75 10             	push   0x10(%ebp)
+  80082b:	ff 75 0c             	push   0xc(%ebp)
+  80082e:	56                   	push   %esi
+  80082f:	ff d0                	call   *%eax
+  800831:	83 c4 10             	add    $0x10,%esp
+}
+  800834:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800837:	5b                   	pop    %ebx
+  800838:	5e                   	pop    %esi
+  800839:	5d                   	pop    %ebp
+  80083a:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80083b:	a1 08 40 80 00       	mov    0x804008,%eax
+  800840:	8b 40 48             	mov    0x48(%eax),%eax
+  800843:	83 ec 04             	sub    $0x4,%esp
+  800846:	53                   	push   %ebx
+  800847:	50                   	push   %eax
+  800848:	68 95 25 80 00       	push   $0x802595
+  80084d:	e8 ca 0d 00 00       	call   80161c <cprintf>
+		return -E_INVAL;
+  800852:	83 c4 10             	add    $0x10,%esp
+  800855:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80085a:	eb d8                	jmp    800834 <write+0x53>
+		return -E_NOT_SUPP;
+  80085c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800861:	eb d1                	jmp    800834 <write+0x53>
+
+00800863 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  800863:	55                   	push   %ebp
+  800864:	89 e5                	mov    %esp,%ebp
+  800866:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800869:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80086c:	50                   	push   %eax
+  80086d:	ff 75 08             	push   0x8(%ebp)
+  800870:	e8 38 fc ff ff       	call   8004ad <fd_lookup>
+  800875:	83 c4 10             	add    $0x10,%esp
+  800878:	85 c0                	test   %eax,%eax
+  80087a:	78 0e                	js     80088a <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80087c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80087f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800882:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  800885:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80088a:	c9                   	leave
+  80088b:	c3                   	ret
+
+0080088c <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80088c:	55                   	push   %ebp
+  80088d:	89 e5                	mov    %esp,%ebp
+  80088f:	56                   	push   %esi
+  800890:	53                   	push   %ebx
+  800891:	83 ec 18             	sub    $0x18,%esp
+  800894:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800897:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80089a:	50                   	push   %eax
+  80089b:	53                   	push   %ebx
+  80089c:	e8 0c fc ff ff       	call   8004ad <fd_lookup>
+  8008a1:	83 c4 10             	add    $0x10,%esp
+  8008a4:	85 c0                	test   %eax,%eax
+  8008a6:	78 34                	js     8008dc <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8008a8:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8008ab:	83 ec 08             	sub    $0x8,%esp
+  8008ae:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8008b1:	50                   	push   %eax
+  8008b2:	ff 36                	push   (%esi)
+  8008b4:	e8 44 fc ff ff       	call   8004fd <dev_lookup>
+  8008b9:	83 c4 10             	add    $0x10,%esp
+  8008bc:	85 c0                	test   %eax,%eax
+  8008be:	78 1c                	js     8008dc <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8008c0:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8008c4:	74 1d                	je     8008e3 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8008c6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008c9:	8b 40 18             	mov    0x18(%eax),%eax
+  8008cc:	85 c0                	test   %eax,%eax
+  8008ce:	74 34                	je     800904 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8008d0:	83 ec 08             	sub    $0x8,%esp
+  8008d3:	ff 75 0c             	push   0xc(%ebp)
+  8008d6:	56                   	push   %esi
+  8008d7:	ff d0                	call   *%eax
+  8008d9:	83 c4 10             	add    $0x10,%esp
+}
+  8008dc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8008df:	5b                   	pop    %ebx
+  8008e0:	5e                   	pop    %esi
+  8008e1:	5d                   	pop    %ebp
+  8008e2:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8008e3:	a1 08 40 80 00       	mov    0x804008,%eax
+  8008e8:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8008eb:	83 ec 04             	sub    $0x4,%esp
+  8008ee:	53                   	push   %ebx
+  8008ef:	50                   	push   %eax
+  8008f0:	68 58 25 80 00       	push   $0x802558
+  8008f5:	e8 22 0d 00 00       	call   80161c <cprintf>
+		return -E_INVAL;
+  8008fa:	83 c4 10             	add    $0x10,%esp
+  8008fd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800902:	eb d8                	jmp    8008dc <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  800904:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800909:	eb d1                	jmp    8008dc <ftruncate+0x50>
+
+0080090b <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80090b:	55                   	push   %ebp
+  80090c:	89 e5                	mov    %esp,%ebp
+  80090e:	56                   	push   %esi
+  80090f:	53                   	push   %ebx
+  800910:	83 ec 18             	sub    $0x18,%esp
+  800913:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800916:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800919:	50                   	push   %eax
+  80091a:	ff 75 08             	push   0x8(%ebp)
+  80091d:	e8 8b fb ff ff       	call   8004ad <fd_lookup>
+  800922:	83 c4 10             	add    $0x10,%esp
+  800925:	85 c0                	test   %eax,%eax
+  800927:	78 49                	js     800972 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800929:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80092c:	83 ec 08             	sub    $0x8,%esp
+  80092f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800932:	50                   	push   %eax
+  800933:	ff 36                	push   (%esi)
+  800935:	e8 c3 fb ff ff       	call   8004fd <dev_lookup>
+  80093a:	83 c4 10             	add    $0x10,%esp
+  80093d:	85 c0                	test   %eax,%eax
+  80093f:	78 31                	js     800972 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  800941:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800944:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800948:	74 2f                	je     800979 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80094a:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80094d:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800954:	00 00 00 
+	stat->st_isdir = 0;
+  800957:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80095e:	00 00 00 
+	stat->st_dev = dev;
+  800961:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  800967:	83 ec 08             	sub    $0x8,%esp
+  80096a:	53                   	push   %ebx
+  80096b:	56                   	push   %esi
+  80096c:	ff 50 14             	call   *0x14(%eax)
+  80096f:	83 c4 10             	add    $0x10,%esp
+}
+  800972:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800975:	5b                   	pop    %ebx
+  800976:	5e                   	pop    %esi
+  800977:	5d                   	pop    %ebp
+  800978:	c3                   	ret
+		return -E_NOT_SUPP;
+  800979:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80097e:	eb f2                	jmp    800972 <fstat+0x67>
+
+00800980 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  800980:	55                   	push   %ebp
+  800981:	89 e5                	mov    %esp,%ebp
+  800983:	56                   	push   %esi
+  800984:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  800985:	83 ec 08             	sub    $0x8,%esp
+  800988:	6a 00                	push   $0x0
+  80098a:	ff 75 08             	push   0x8(%ebp)
+  80098d:	e8 e4 01 00 00       	call   800b76 <open>
+  800992:	89 c3                	mov    %eax,%ebx
+  800994:	83 c4 10             	add    $0x10,%esp
+  800997:	85 c0                	test   %eax,%eax
+  800999:	78 1b                	js     8009b6 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80099b:	83 ec 08             	sub    $0x8,%esp
+  80099e:	ff 75 0c             	push   0xc(%ebp)
+  8009a1:	50                   	push   %eax
+  8009a2:	e8 64 ff ff ff       	call   80090b <fstat>
+  8009a7:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8009a9:	89 1c 24             	mov    %ebx,(%esp)
+  8009ac:	e8 26 fc ff ff       	call   8005d7 <close>
+	return r;
+  8009b1:	83 c4 10             	add    $0x10,%esp
+  8009b4:	89 f3                	mov    %esi,%ebx
+}
+  8009b6:	89 d8                	mov    %ebx,%eax
+  8009b8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8009bb:	5b                   	pop    %ebx
+  8009bc:	5e                   	pop    %esi
+  8009bd:	5d                   	pop    %ebp
+  8009be:	c3                   	ret
+
+008009bf <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  8009bf:	55                   	push   %ebp
+  8009c0:	89 e5                	mov    %esp,%ebp
+  8009c2:	56                   	push   %esi
+  8009c3:	53                   	push   %ebx
+  8009c4:	89 c6                	mov    %eax,%esi
+  8009c6:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  8009c8:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  8009cf:	74 27                	je     8009f8 <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8009d1:	6a 07                	push   $0x7
+  8009d3:	68 00 50 80 00       	push   $0x805000
+  8009d8:	56                   	push   %esi
+  8009d9:	ff 35 00 40 80 00    	push   0x804000
+  8009df:	e8 95 15 00 00       	call   801f79 <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  8009e4:	83 c4 0c             	add    $0xc,%esp
+  8009e7:	6a 00                	push   $0x0
+  8009e9:	53                   	push   %ebx
+  8009ea:	6a 00                	push   $0x0
+  8009ec:	e8 14 15 00 00       	call   801f05 <ipc_recv>
+}
+  8009f1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8009f4:	5b                   	pop    %ebx
+  8009f5:	5e                   	pop    %esi
+  8009f6:	5d                   	pop    %ebp
+  8009f7:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  8009f8:	83 ec 0c             	sub    $0xc,%esp
+  8009fb:	6a 01                	push   $0x1
+  8009fd:	e8 cb 15 00 00       	call   801fcd <ipc_find_env>
+  800a02:	a3 00 40 80 00       	mov    %eax,0x804000
+  800a07:	83 c4 10             	add    $0x10,%esp
+  800a0a:	eb c5                	jmp    8009d1 <fsipc+0x12>
+
+00800a0c <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  800a0c:	55                   	push   %ebp
+  800a0d:	89 e5                	mov    %esp,%ebp
+  800a0f:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800a12:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a15:	8b 40 0c             	mov    0xc(%eax),%eax
+  800a18:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.set_size.req_size = newsize;
+  800a1d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a20:	a3 04 50 80 00       	mov    %eax,0x805004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  800a25:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a2a:	b8 02 00 00 00       	mov    $0x2,%eax
+  800a2f:	e8 8b ff ff ff       	call   8009bf <fsipc>
+}
+  800a34:	c9                   	leave
+  800a35:	c3                   	ret
+
+00800a36 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  800a36:	55                   	push   %ebp
+  800a37:	89 e5                	mov    %esp,%ebp
+  800a39:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800a3c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a3f:	8b 40 0c             	mov    0xc(%eax),%eax
+  800a42:	a3 00 50 80 00       	mov    %eax,0x805000
+  return fsipc(FSREQ_FLUSH, NULL);
+  800a47:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a4c:	b8 06 00 00 00       	mov    $0x6,%eax
+  800a51:	e8 69 ff ff ff       	call   8009bf <fsipc>
+}
+  800a56:	c9                   	leave
+  800a57:	c3                   	ret
+
+00800a58 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  800a58:	55                   	push   %ebp
+  800a59:	89 e5                	mov    %esp,%ebp
+  800a5b:	53                   	push   %ebx
+  800a5c:	83 ec 04             	sub    $0x4,%esp
+  800a5f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800a62:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a65:	8b 40 0c             	mov    0xc(%eax),%eax
+  800a68:	a3 00 50 80 00       	mov    %eax,0x805000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  800a6d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a72:	b8 05 00 00 00       	mov    $0x5,%eax
+  800a77:	e8 43 ff ff ff       	call   8009bf <fsipc>
+  800a7c:	85 c0                	test   %eax,%eax
+  800a7e:	78 2c                	js     800aac <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800a80:	83 ec 08             	sub    $0x8,%esp
+  800a83:	68 00 50 80 00       	push   $0x805000
+  800a88:	53                   	push   %ebx
+  800a89:	e8 47 11 00 00       	call   801bd5 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  800a8e:	a1 80 50 80 00       	mov    0x805080,%eax
+  800a93:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800a99:	a1 84 50 80 00       	mov    0x805084,%eax
+  800a9e:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  800aa4:	83 c4 10             	add    $0x10,%esp
+  800aa7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800aac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800aaf:	c9                   	leave
+  800ab0:	c3                   	ret
+
+00800ab1 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  800ab1:	55                   	push   %ebp
+  800ab2:	89 e5                	mov    %esp,%ebp
+  800ab4:	83 ec 0c             	sub    $0xc,%esp
+  800ab7:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800aba:	8b 55 08             	mov    0x8(%ebp),%edx
+  800abd:	8b 52 0c             	mov    0xc(%edx),%edx
+  800ac0:	89 15 00 50 80 00    	mov    %edx,0x805000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  800ac6:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  800acb:	39 d0                	cmp    %edx,%eax
+  800acd:	0f 47 c2             	cmova  %edx,%eax
+  800ad0:	a3 04 50 80 00       	mov    %eax,0x805004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  800ad5:	50                   	push   %eax
+  800ad6:	ff 75 0c             	push   0xc(%ebp)
+  800ad9:	68 08 50 80 00       	push   $0x805008
+  800ade:	e8 78 12 00 00       	call   801d5b <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  800ae3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ae8:	b8 04 00 00 00       	mov    $0x4,%eax
+  800aed:	e8 cd fe ff ff       	call   8009bf <fsipc>
+}
+  800af2:	c9                   	leave
+  800af3:	c3                   	ret
+
+00800af4 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  800af4:	55                   	push   %ebp
+  800af5:	89 e5                	mov    %esp,%ebp
+  800af7:	56                   	push   %esi
+  800af8:	53                   	push   %ebx
+  800af9:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800afc:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aff:	8b 40 0c             	mov    0xc(%eax),%eax
+  800b02:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.read.req_n = n;
+  800b07:	89 35 04 50 80 00    	mov    %esi,0x805004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  800b0d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b12:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b17:	e8 a3 fe ff ff       	call   8009bf <fsipc>
+  800b1c:	89 c3                	mov    %eax,%ebx
+  800b1e:	85 c0                	test   %eax,%eax
+  800b20:	78 1f                	js     800b41 <devfile_read+0x4d>
+  assert(r <= n);
+  800b22:	39 c6                	cmp    %eax,%esi
+  800b24:	72 24                	jb     800b4a <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  800b26:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800b2b:	7f 33                	jg     800b60 <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  800b2d:	83 ec 04             	sub    $0x4,%esp
+  800b30:	50                   	push   %eax
+  800b31:	68 00 50 80 00       	push   $0x805000
+  800b36:	ff 75 0c             	push   0xc(%ebp)
+  800b39:	e8 1d 12 00 00       	call   801d5b <memmove>
+  return r;
+  800b3e:	83 c4 10             	add    $0x10,%esp
+}
+  800b41:	89 d8                	mov    %ebx,%eax
+  800b43:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b46:	5b                   	pop    %ebx
+  800b47:	5e                   	pop    %esi
+  800b48:	5d                   	pop    %ebp
+  800b49:	c3                   	ret
+  assert(r <= n);
+  800b4a:	68 c8 25 80 00       	push   $0x8025c8
+  800b4f:	68 cf 25 80 00       	push   $0x8025cf
+  800b54:	6a 78                	push   $0x78
+  800b56:	68 e4 25 80 00       	push   $0x8025e4
+  800b5b:	e8 e1 09 00 00       	call   801541 <_panic>
+  assert(r <= PGSIZE);
+  800b60:	68 ef 25 80 00       	push   $0x8025ef
+  800b65:	68 cf 25 80 00       	push   $0x8025cf
+  800b6a:	6a 79                	push   $0x79
+  800b6c:	68 e4 25 80 00       	push   $0x8025e4
+  800b71:	e8 cb 09 00 00       	call   801541 <_panic>
+
+00800b76 <open>:
+open(const char *path, int mode) {
+  800b76:	55                   	push   %ebp
+  800b77:	89 e5                	mov    %esp,%ebp
+  800b79:	56                   	push   %esi
+  800b7a:	53                   	push   %ebx
+  800b7b:	83 ec 1c             	sub    $0x1c,%esp
+  800b7e:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  800b81:	56                   	push   %esi
+  800b82:	e8 13 10 00 00       	call   801b9a <strlen>
+  800b87:	83 c4 10             	add    $0x10,%esp
+  800b8a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800b8f:	7f 6c                	jg     800bfd <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  800b91:	83 ec 0c             	sub    $0xc,%esp
+  800b94:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b97:	50                   	push   %eax
+  800b98:	e8 ba f8 ff ff       	call   800457 <fd_alloc>
+  800b9d:	89 c3                	mov    %eax,%ebx
+  800b9f:	83 c4 10             	add    $0x10,%esp
+  800ba2:	85 c0                	test   %eax,%eax
+  800ba4:	78 3c                	js     800be2 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  800ba6:	83 ec 08             	sub    $0x8,%esp
+  800ba9:	56                   	push   %esi
+  800baa:	68 00 50 80 00       	push   $0x805000
+  800baf:	e8 21 10 00 00       	call   801bd5 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  800bb4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bb7:	a3 00 54 80 00       	mov    %eax,0x805400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  800bbc:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  800bbf:	b8 01 00 00 00       	mov    $0x1,%eax
+  800bc4:	e8 f6 fd ff ff       	call   8009bf <fsipc>
+  800bc9:	89 c3                	mov    %eax,%ebx
+  800bcb:	83 c4 10             	add    $0x10,%esp
+  800bce:	85 c0                	test   %eax,%eax
+  800bd0:	78 19                	js     800beb <open+0x75>
+  return fd2num(fd);
+  800bd2:	83 ec 0c             	sub    $0xc,%esp
+  800bd5:	ff 75 f4             	push   -0xc(%ebp)
+  800bd8:	e8 53 f8 ff ff       	call   800430 <fd2num>
+  800bdd:	89 c3                	mov    %eax,%ebx
+  800bdf:	83 c4 10             	add    $0x10,%esp
+}
+  800be2:	89 d8                	mov    %ebx,%eax
+  800be4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800be7:	5b                   	pop    %ebx
+  800be8:	5e                   	pop    %esi
+  800be9:	5d                   	pop    %ebp
+  800bea:	c3                   	ret
+    fd_close(fd, 0);
+  800beb:	83 ec 08             	sub    $0x8,%esp
+  800bee:	6a 00                	push   $0x0
+  800bf0:	ff 75 f4             	push   -0xc(%ebp)
+  800bf3:	e8 58 f9 ff ff       	call   800550 <fd_close>
+    return r;
+  800bf8:	83 c4 10             	add    $0x10,%esp
+  800bfb:	eb e5                	jmp    800be2 <open+0x6c>
+    return -E_BAD_PATH;
+  800bfd:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  800c02:	eb de                	jmp    800be2 <open+0x6c>
+
+00800c04 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  800c04:	55                   	push   %ebp
+  800c05:	89 e5                	mov    %esp,%ebp
+  800c07:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  800c0a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c0f:	b8 08 00 00 00       	mov    $0x8,%eax
+  800c14:	e8 a6 fd ff ff       	call   8009bf <fsipc>
+}
+  800c19:	c9                   	leave
+  800c1a:	c3                   	ret
+
+00800c1b <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  800c1b:	55                   	push   %ebp
+  800c1c:	89 e5                	mov    %esp,%ebp
+  800c1e:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  800c21:	68 fb 25 80 00       	push   $0x8025fb
+  800c26:	ff 75 0c             	push   0xc(%ebp)
+  800c29:	e8 a7 0f 00 00       	call   801bd5 <strcpy>
+	return 0;
+}
+  800c2e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c33:	c9                   	leave
+  800c34:	c3                   	ret
+
+00800c35 <devsock_close>:
+{
+  800c35:	55                   	push   %ebp
+  800c36:	89 e5                	mov    %esp,%ebp
+  800c38:	53                   	push   %ebx
+  800c39:	83 ec 10             	sub    $0x10,%esp
+  800c3c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  800c3f:	53                   	push   %ebx
+  800c40:	e8 c7 13 00 00       	call   80200c <pageref>
+  800c45:	89 c2                	mov    %eax,%edx
+  800c47:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  800c4a:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  800c4f:	83 fa 01             	cmp    $0x1,%edx
+  800c52:	74 05                	je     800c59 <devsock_close+0x24>
+}
+  800c54:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c57:	c9                   	leave
+  800c58:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  800c59:	83 ec 0c             	sub    $0xc,%esp
+  800c5c:	ff 73 0c             	push   0xc(%ebx)
+  800c5f:	e8 b7 02 00 00       	call   800f1b <nsipc_close>
+  800c64:	83 c4 10             	add    $0x10,%esp
+  800c67:	eb eb                	jmp    800c54 <devsock_close+0x1f>
+
+00800c69 <devsock_write>:
+{
+  800c69:	55                   	push   %ebp
+  800c6a:	89 e5                	mov    %esp,%ebp
+  800c6c:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  800c6f:	6a 00                	push   $0x0
+  800c71:	ff 75 10             	push   0x10(%ebp)
+  800c74:	ff 75 0c             	push   0xc(%ebp)
+  800c77:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c7a:	ff 70 0c             	push   0xc(%eax)
+  800c7d:	e8 79 03 00 00       	call   800ffb <nsipc_send>
+}
+  800c82:	c9                   	leave
+  800c83:	c3                   	ret
+
+00800c84 <devsock_read>:
+{
+  800c84:	55                   	push   %ebp
+  800c85:	89 e5                	mov    %esp,%ebp
+  800c87:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  800c8a:	6a 00                	push   $0x0
+  800c8c:	ff 75 10             	push   0x10(%ebp)
+  800c8f:	ff 75 0c             	push   0xc(%ebp)
+  800c92:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c95:	ff 70 0c             	push   0xc(%eax)
+  800c98:	e8 ef 02 00 00       	call   800f8c <nsipc_recv>
+}
+  800c9d:	c9                   	leave
+  800c9e:	c3                   	ret
+
+00800c9f <fd2sockid>:
+{
+  800c9f:	55                   	push   %ebp
+  800ca0:	89 e5                	mov    %esp,%ebp
+  800ca2:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  800ca5:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  800ca8:	52                   	push   %edx
+  800ca9:	50                   	push   %eax
+  800caa:	e8 fe f7 ff ff       	call   8004ad <fd_lookup>
+  800caf:	83 c4 10             	add    $0x10,%esp
+  800cb2:	85 c0                	test   %eax,%eax
+  800cb4:	78 10                	js     800cc6 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  800cb6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800cb9:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  800cbf:	39 08                	cmp    %ecx,(%eax)
+  800cc1:	75 05                	jne    800cc8 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  800cc3:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  800cc6:	c9                   	leave
+  800cc7:	c3                   	ret
+		return -E_NOT_SUPP;
+  800cc8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800ccd:	eb f7                	jmp    800cc6 <fd2sockid+0x27>
+
+00800ccf <alloc_sockfd>:
+{
+  800ccf:	55                   	push   %ebp
+  800cd0:	89 e5                	mov    %esp,%ebp
+  800cd2:	56                   	push   %esi
+  800cd3:	53                   	push   %ebx
+  800cd4:	83 ec 1c             	sub    $0x1c,%esp
+  800cd7:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  800cd9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800cdc:	50                   	push   %eax
+  800cdd:	e8 75 f7 ff ff       	call   800457 <fd_alloc>
+  800ce2:	89 c3                	mov    %eax,%ebx
+  800ce4:	83 c4 10             	add    $0x10,%esp
+  800ce7:	85 c0                	test   %eax,%eax
+  800ce9:	78 43                	js     800d2e <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  800ceb:	83 ec 04             	sub    $0x4,%esp
+  800cee:	68 07 04 00 00       	push   $0x407
+  800cf3:	ff 75 f4             	push   -0xc(%ebp)
+  800cf6:	6a 00                	push   $0x0
+  800cf8:	e8 60 f4 ff ff       	call   80015d <sys_page_alloc>
+  800cfd:	89 c3                	mov    %eax,%ebx
+  800cff:	83 c4 10             	add    $0x10,%esp
+  800d02:	85 c0                	test   %eax,%eax
+  800d04:	78 28                	js     800d2e <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  800d06:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800d09:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  800d0f:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  800d11:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800d14:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  800d1b:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  800d1e:	83 ec 0c             	sub    $0xc,%esp
+  800d21:	50                   	push   %eax
+  800d22:	e8 09 f7 ff ff       	call   800430 <fd2num>
+  800d27:	89 c3                	mov    %eax,%ebx
+  800d29:	83 c4 10             	add    $0x10,%esp
+  800d2c:	eb 0c                	jmp    800d3a <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  800d2e:	83 ec 0c             	sub    $0xc,%esp
+  800d31:	56                   	push   %esi
+  800d32:	e8 e4 01 00 00       	call   800f1b <nsipc_close>
+		return r;
+  800d37:	83 c4 10             	add    $0x10,%esp
+}
+  800d3a:	89 d8                	mov    %ebx,%eax
+  800d3c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d3f:	5b                   	pop    %ebx
+  800d40:	5e                   	pop    %esi
+  800d41:	5d                   	pop    %ebp
+  800d42:	c3                   	ret
+
+00800d43 <accept>:
+{
+  800d43:	55                   	push   %ebp
+  800d44:	89 e5                	mov    %esp,%ebp
+  800d46:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800d49:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d4c:	e8 4e ff ff ff       	call   800c9f <fd2sockid>
+  800d51:	85 c0                	test   %eax,%eax
+  800d53:	78 1b                	js     800d70 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  800d55:	83 ec 04             	sub    $0x4,%esp
+  800d58:	ff 75 10             	push   0x10(%ebp)
+  800d5b:	ff 75 0c             	push   0xc(%ebp)
+  800d5e:	50                   	push   %eax
+  800d5f:	e8 0e 01 00 00       	call   800e72 <nsipc_accept>
+  800d64:	83 c4 10             	add    $0x10,%esp
+  800d67:	85 c0                	test   %eax,%eax
+  800d69:	78 05                	js     800d70 <accept+0x2d>
+	return alloc_sockfd(r);
+  800d6b:	e8 5f ff ff ff       	call   800ccf <alloc_sockfd>
+}
+  800d70:	c9                   	leave
+  800d71:	c3                   	ret
+
+00800d72 <bind>:
+{
+  800d72:	55                   	push   %ebp
+  800d73:	89 e5                	mov    %esp,%ebp
+  800d75:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800d78:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d7b:	e8 1f ff ff ff       	call   800c9f <fd2sockid>
+  800d80:	85 c0                	test   %eax,%eax
+  800d82:	78 12                	js     800d96 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  800d84:	83 ec 04             	sub    $0x4,%esp
+  800d87:	ff 75 10             	push   0x10(%ebp)
+  800d8a:	ff 75 0c             	push   0xc(%ebp)
+  800d8d:	50                   	push   %eax
+  800d8e:	e8 31 01 00 00       	call   800ec4 <nsipc_bind>
+  800d93:	83 c4 10             	add    $0x10,%esp
+}
+  800d96:	c9                   	leave
+  800d97:	c3                   	ret
+
+00800d98 <shutdown>:
+{
+  800d98:	55                   	push   %ebp
+  800d99:	89 e5                	mov    %esp,%ebp
+  800d9b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800d9e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800da1:	e8 f9 fe ff ff       	call   800c9f <fd2sockid>
+  800da6:	85 c0                	test   %eax,%eax
+  800da8:	78 0f                	js     800db9 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  800daa:	83 ec 08             	sub    $0x8,%esp
+  800dad:	ff 75 0c             	push   0xc(%ebp)
+  800db0:	50                   	push   %eax
+  800db1:	e8 43 01 00 00       	call   800ef9 <nsipc_shutdown>
+  800db6:	83 c4 10             	add    $0x10,%esp
+}
+  800db9:	c9                   	leave
+  800dba:	c3                   	ret
+
+00800dbb <connect>:
+{
+  800dbb:	55                   	push   %ebp
+  800dbc:	89 e5                	mov    %esp,%ebp
+  800dbe:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800dc1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dc4:	e8 d6 fe ff ff       	call   800c9f <fd2sockid>
+  800dc9:	85 c0                	test   %eax,%eax
+  800dcb:	78 12                	js     800ddf <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  800dcd:	83 ec 04             	sub    $0x4,%esp
+  800dd0:	ff 75 10             	push   0x10(%ebp)
+  800dd3:	ff 75 0c             	push   0xc(%ebp)
+  800dd6:	50                   	push   %eax
+  800dd7:	e8 59 01 00 00       	call   800f35 <nsipc_connect>
+  800ddc:	83 c4 10             	add    $0x10,%esp
+}
+  800ddf:	c9                   	leave
+  800de0:	c3                   	ret
+
+00800de1 <listen>:
+{
+  800de1:	55                   	push   %ebp
+  800de2:	89 e5                	mov    %esp,%ebp
+  800de4:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800de7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dea:	e8 b0 fe ff ff       	call   800c9f <fd2sockid>
+  800def:	85 c0                	test   %eax,%eax
+  800df1:	78 0f                	js     800e02 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  800df3:	83 ec 08             	sub    $0x8,%esp
+  800df6:	ff 75 0c             	push   0xc(%ebp)
+  800df9:	50                   	push   %eax
+  800dfa:	e8 6b 01 00 00       	call   800f6a <nsipc_listen>
+  800dff:	83 c4 10             	add    $0x10,%esp
+}
+  800e02:	c9                   	leave
+  800e03:	c3                   	ret
+
+00800e04 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  800e04:	55                   	push   %ebp
+  800e05:	89 e5                	mov    %esp,%ebp
+  800e07:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  800e0a:	ff 75 10             	push   0x10(%ebp)
+  800e0d:	ff 75 0c             	push   0xc(%ebp)
+  800e10:	ff 75 08             	push   0x8(%ebp)
+  800e13:	e8 41 02 00 00       	call   801059 <nsipc_socket>
+  800e18:	83 c4 10             	add    $0x10,%esp
+  800e1b:	85 c0                	test   %eax,%eax
+  800e1d:	78 05                	js     800e24 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  800e1f:	e8 ab fe ff ff       	call   800ccf <alloc_sockfd>
+}
+  800e24:	c9                   	leave
+  800e25:	c3                   	ret
+
+00800e26 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  800e26:	55                   	push   %ebp
+  800e27:	89 e5                	mov    %esp,%ebp
+  800e29:	53                   	push   %ebx
+  800e2a:	83 ec 04             	sub    $0x4,%esp
+  800e2d:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  800e2f:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800e36:	74 26                	je     800e5e <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  800e38:	6a 07                	push   $0x7
+  800e3a:	68 00 60 80 00       	push   $0x806000
+  800e3f:	53                   	push   %ebx
+  800e40:	ff 35 04 40 80 00    	push   0x804004
+  800e46:	e8 2e 11 00 00       	call   801f79 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  800e4b:	83 c4 0c             	add    $0xc,%esp
+  800e4e:	6a 00                	push   $0x0
+  800e50:	6a 00                	push   $0x0
+  800e52:	6a 00                	push   $0x0
+  800e54:	e8 ac 10 00 00       	call   801f05 <ipc_recv>
+}
+  800e59:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e5c:	c9                   	leave
+  800e5d:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  800e5e:	83 ec 0c             	sub    $0xc,%esp
+  800e61:	6a 02                	push   $0x2
+  800e63:	e8 65 11 00 00       	call   801fcd <ipc_find_env>
+  800e68:	a3 04 40 80 00       	mov    %eax,0x804004
+  800e6d:	83 c4 10             	add    $0x10,%esp
+  800e70:	eb c6                	jmp    800e38 <nsipc+0x12>
+
+00800e72 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  800e72:	55                   	push   %ebp
+  800e73:	89 e5                	mov    %esp,%ebp
+  800e75:	56                   	push   %esi
+  800e76:	53                   	push   %ebx
+  800e77:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  800e7a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e7d:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  800e82:	8b 06                	mov    (%esi),%eax
+  800e84:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  800e89:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e8e:	e8 93 ff ff ff       	call   800e26 <nsipc>
+  800e93:	89 c3                	mov    %eax,%ebx
+  800e95:	85 c0                	test   %eax,%eax
+  800e97:	79 09                	jns    800ea2 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  800e99:	89 d8                	mov    %ebx,%eax
+  800e9b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e9e:	5b                   	pop    %ebx
+  800e9f:	5e                   	pop    %esi
+  800ea0:	5d                   	pop    %ebp
+  800ea1:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  800ea2:	83 ec 04             	sub    $0x4,%esp
+  800ea5:	ff 35 10 60 80 00    	push   0x806010
+  800eab:	68 00 60 80 00       	push   $0x806000
+  800eb0:	ff 75 0c             	push   0xc(%ebp)
+  800eb3:	e8 a3 0e 00 00       	call   801d5b <memmove>
+		*addrlen = ret->ret_addrlen;
+  800eb8:	a1 10 60 80 00       	mov    0x806010,%eax
+  800ebd:	89 06                	mov    %eax,(%esi)
+  800ebf:	83 c4 10             	add    $0x10,%esp
+	return r;
+  800ec2:	eb d5                	jmp    800e99 <nsipc_accept+0x27>
+
+00800ec4 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  800ec4:	55                   	push   %ebp
+  800ec5:	89 e5                	mov    %esp,%ebp
+  800ec7:	53                   	push   %ebx
+  800ec8:	83 ec 08             	sub    $0x8,%esp
+  800ecb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  800ece:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ed1:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  800ed6:	53                   	push   %ebx
+  800ed7:	ff 75 0c             	push   0xc(%ebp)
+  800eda:	68 04 60 80 00       	push   $0x806004
+  800edf:	e8 77 0e 00 00       	call   801d5b <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  800ee4:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  800eea:	b8 02 00 00 00       	mov    $0x2,%eax
+  800eef:	e8 32 ff ff ff       	call   800e26 <nsipc>
+}
+  800ef4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ef7:	c9                   	leave
+  800ef8:	c3                   	ret
+
+00800ef9 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  800ef9:	55                   	push   %ebp
+  800efa:	89 e5                	mov    %esp,%ebp
+  800efc:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  800eff:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f02:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  800f07:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f0a:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  800f0f:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f14:	e8 0d ff ff ff       	call   800e26 <nsipc>
+}
+  800f19:	c9                   	leave
+  800f1a:	c3                   	ret
+
+00800f1b <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  800f1b:	55                   	push   %ebp
+  800f1c:	89 e5                	mov    %esp,%ebp
+  800f1e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  800f21:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f24:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  800f29:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f2e:	e8 f3 fe ff ff       	call   800e26 <nsipc>
+}
+  800f33:	c9                   	leave
+  800f34:	c3                   	ret
+
+00800f35 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  800f35:	55                   	push   %ebp
+  800f36:	89 e5                	mov    %esp,%ebp
+  800f38:	53                   	push   %ebx
+  800f39:	83 ec 08             	sub    $0x8,%esp
+  800f3c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  800f3f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f42:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  800f47:	53                   	push   %ebx
+  800f48:	ff 75 0c             	push   0xc(%ebp)
+  800f4b:	68 04 60 80 00       	push   $0x806004
+  800f50:	e8 06 0e 00 00       	call   801d5b <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  800f55:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  800f5b:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f60:	e8 c1 fe ff ff       	call   800e26 <nsipc>
+}
+  800f65:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f68:	c9                   	leave
+  800f69:	c3                   	ret
+
+00800f6a <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  800f6a:	55                   	push   %ebp
+  800f6b:	89 e5                	mov    %esp,%ebp
+  800f6d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  800f70:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f73:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  800f78:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f7b:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  800f80:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f85:	e8 9c fe ff ff       	call   800e26 <nsipc>
+}
+  800f8a:	c9                   	leave
+  800f8b:	c3                   	ret
+
+00800f8c <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  800f8c:	55                   	push   %ebp
+  800f8d:	89 e5                	mov    %esp,%ebp
+  800f8f:	56                   	push   %esi
+  800f90:	53                   	push   %ebx
+  800f91:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  800f94:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f97:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  800f9c:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  800fa2:	8b 45 14             	mov    0x14(%ebp),%eax
+  800fa5:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  800faa:	b8 07 00 00 00       	mov    $0x7,%eax
+  800faf:	e8 72 fe ff ff       	call   800e26 <nsipc>
+  800fb4:	89 c3                	mov    %eax,%ebx
+  800fb6:	85 c0                	test   %eax,%eax
+  800fb8:	78 22                	js     800fdc <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  800fba:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  800fbf:	39 c6                	cmp    %eax,%esi
+  800fc1:	0f 4e c6             	cmovle %esi,%eax
+  800fc4:	39 c3                	cmp    %eax,%ebx
+  800fc6:	7f 1d                	jg     800fe5 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  800fc8:	83 ec 04             	sub    $0x4,%esp
+  800fcb:	53                   	push   %ebx
+  800fcc:	68 00 60 80 00       	push   $0x806000
+  800fd1:	ff 75 0c             	push   0xc(%ebp)
+  800fd4:	e8 82 0d 00 00       	call   801d5b <memmove>
+  800fd9:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  800fdc:	89 d8                	mov    %ebx,%eax
+  800fde:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fe1:	5b                   	pop    %ebx
+  800fe2:	5e                   	pop    %esi
+  800fe3:	5d                   	pop    %ebp
+  800fe4:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  800fe5:	68 07 26 80 00       	push   $0x802607
+  800fea:	68 cf 25 80 00       	push   $0x8025cf
+  800fef:	6a 62                	push   $0x62
+  800ff1:	68 1c 26 80 00       	push   $0x80261c
+  800ff6:	e8 46 05 00 00       	call   801541 <_panic>
+
+00800ffb <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  800ffb:	55                   	push   %ebp
+  800ffc:	89 e5                	mov    %esp,%ebp
+  800ffe:	53                   	push   %ebx
+  800fff:	83 ec 04             	sub    $0x4,%esp
+  801002:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801005:	8b 45 08             	mov    0x8(%ebp),%eax
+  801008:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  80100d:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801013:	7f 2e                	jg     801043 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801015:	83 ec 04             	sub    $0x4,%esp
+  801018:	53                   	push   %ebx
+  801019:	ff 75 0c             	push   0xc(%ebp)
+  80101c:	68 0c 60 80 00       	push   $0x80600c
+  801021:	e8 35 0d 00 00       	call   801d5b <memmove>
+	nsipcbuf.send.req_size = size;
+  801026:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  80102c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80102f:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  801034:	b8 08 00 00 00       	mov    $0x8,%eax
+  801039:	e8 e8 fd ff ff       	call   800e26 <nsipc>
+}
+  80103e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801041:	c9                   	leave
+  801042:	c3                   	ret
+	assert(size < 1600);
+  801043:	68 28 26 80 00       	push   $0x802628
+  801048:	68 cf 25 80 00       	push   $0x8025cf
+  80104d:	6a 6d                	push   $0x6d
+  80104f:	68 1c 26 80 00       	push   $0x80261c
+  801054:	e8 e8 04 00 00       	call   801541 <_panic>
+
+00801059 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801059:	55                   	push   %ebp
+  80105a:	89 e5                	mov    %esp,%ebp
+  80105c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  80105f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801062:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  801067:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80106a:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  80106f:	8b 45 10             	mov    0x10(%ebp),%eax
+  801072:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  801077:	b8 09 00 00 00       	mov    $0x9,%eax
+  80107c:	e8 a5 fd ff ff       	call   800e26 <nsipc>
+}
+  801081:	c9                   	leave
+  801082:	c3                   	ret
+
+00801083 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801083:	55                   	push   %ebp
+  801084:	89 e5                	mov    %esp,%ebp
+  801086:	56                   	push   %esi
+  801087:	53                   	push   %ebx
+  801088:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80108b:	83 ec 0c             	sub    $0xc,%esp
+  80108e:	ff 75 08             	push   0x8(%ebp)
+  801091:	e8 aa f3 ff ff       	call   800440 <fd2data>
+  801096:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801098:	83 c4 08             	add    $0x8,%esp
+  80109b:	68 34 26 80 00       	push   $0x802634
+  8010a0:	53                   	push   %ebx
+  8010a1:	e8 2f 0b 00 00       	call   801bd5 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8010a6:	8b 46 04             	mov    0x4(%esi),%eax
+  8010a9:	2b 06                	sub    (%esi),%eax
+  8010ab:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8010b1:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8010b8:	00 00 00 
+	stat->st_dev = &devpipe;
+  8010bb:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  8010c2:	30 80 00 
+	return 0;
+}
+  8010c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010ca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8010cd:	5b                   	pop    %ebx
+  8010ce:	5e                   	pop    %esi
+  8010cf:	5d                   	pop    %ebp
+  8010d0:	c3                   	ret
+
+008010d1 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8010d1:	55                   	push   %ebp
+  8010d2:	89 e5                	mov    %esp,%ebp
+  8010d4:	53                   	push   %ebx
+  8010d5:	83 ec 0c             	sub    $0xc,%esp
+  8010d8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8010db:	53                   	push   %ebx
+  8010dc:	6a 00                	push   $0x0
+  8010de:	e8 ff f0 ff ff       	call   8001e2 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8010e3:	89 1c 24             	mov    %ebx,(%esp)
+  8010e6:	e8 55 f3 ff ff       	call   800440 <fd2data>
+  8010eb:	83 c4 08             	add    $0x8,%esp
+  8010ee:	50                   	push   %eax
+  8010ef:	6a 00                	push   $0x0
+  8010f1:	e8 ec f0 ff ff       	call   8001e2 <sys_page_unmap>
+}
+  8010f6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010f9:	c9                   	leave
+  8010fa:	c3                   	ret
+
+008010fb <_pipeisclosed>:
+{
+  8010fb:	55                   	push   %ebp
+  8010fc:	89 e5                	mov    %esp,%ebp
+  8010fe:	57                   	push   %edi
+  8010ff:	56                   	push   %esi
+  801100:	53                   	push   %ebx
+  801101:	83 ec 1c             	sub    $0x1c,%esp
+  801104:	89 c7                	mov    %eax,%edi
+  801106:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801108:	a1 08 40 80 00       	mov    0x804008,%eax
+  80110d:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801110:	83 ec 0c             	sub    $0xc,%esp
+  801113:	57                   	push   %edi
+  801114:	e8 f3 0e 00 00       	call   80200c <pageref>
+  801119:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80111c:	89 34 24             	mov    %esi,(%esp)
+  80111f:	e8 e8 0e 00 00       	call   80200c <pageref>
+		nn = thisenv->env_runs;
+  801124:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  80112a:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  80112d:	83 c4 10             	add    $0x10,%esp
+  801130:	39 cb                	cmp    %ecx,%ebx
+  801132:	74 1b                	je     80114f <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801134:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801137:	75 cf                	jne    801108 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801139:	8b 42 58             	mov    0x58(%edx),%eax
+  80113c:	6a 01                	push   $0x1
+  80113e:	50                   	push   %eax
+  80113f:	53                   	push   %ebx
+  801140:	68 3b 26 80 00       	push   $0x80263b
+  801145:	e8 d2 04 00 00       	call   80161c <cprintf>
+  80114a:	83 c4 10             	add    $0x10,%esp
+  80114d:	eb b9                	jmp    801108 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  80114f:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801152:	0f 94 c0             	sete   %al
+  801155:	0f b6 c0             	movzbl %al,%eax
+}
+  801158:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80115b:	5b                   	pop    %ebx
+  80115c:	5e                   	pop    %esi
+  80115d:	5f                   	pop    %edi
+  80115e:	5d                   	pop    %ebp
+  80115f:	c3                   	ret
+
+00801160 <devpipe_write>:
+{
+  801160:	55                   	push   %ebp
+  801161:	89 e5                	mov    %esp,%ebp
+  801163:	57                   	push   %edi
+  801164:	56                   	push   %esi
+  801165:	53                   	push   %ebx
+  801166:	83 ec 28             	sub    $0x28,%esp
+  801169:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  80116c:	56                   	push   %esi
+  80116d:	e8 ce f2 ff ff       	call   800440 <fd2data>
+  801172:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801174:	83 c4 10             	add    $0x10,%esp
+  801177:	bf 00 00 00 00       	mov    $0x0,%edi
+  80117c:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  80117f:	75 09                	jne    80118a <devpipe_write+0x2a>
+	return i;
+  801181:	89 f8                	mov    %edi,%eax
+  801183:	eb 23                	jmp    8011a8 <devpipe_write+0x48>
+			sys_yield();
+  801185:	e8 b4 ef ff ff       	call   80013e <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80118a:	8b 43 04             	mov    0x4(%ebx),%eax
+  80118d:	8b 0b                	mov    (%ebx),%ecx
+  80118f:	8d 51 20             	lea    0x20(%ecx),%edx
+  801192:	39 d0                	cmp    %edx,%eax
+  801194:	72 1a                	jb     8011b0 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  801196:	89 da                	mov    %ebx,%edx
+  801198:	89 f0                	mov    %esi,%eax
+  80119a:	e8 5c ff ff ff       	call   8010fb <_pipeisclosed>
+  80119f:	85 c0                	test   %eax,%eax
+  8011a1:	74 e2                	je     801185 <devpipe_write+0x25>
+				return 0;
+  8011a3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011ab:	5b                   	pop    %ebx
+  8011ac:	5e                   	pop    %esi
+  8011ad:	5f                   	pop    %edi
+  8011ae:	5d                   	pop    %ebp
+  8011af:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8011b0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011b3:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8011b7:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8011ba:	89 c2                	mov    %eax,%edx
+  8011bc:	c1 fa 1f             	sar    $0x1f,%edx
+  8011bf:	89 d1                	mov    %edx,%ecx
+  8011c1:	c1 e9 1b             	shr    $0x1b,%ecx
+  8011c4:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8011c7:	83 e2 1f             	and    $0x1f,%edx
+  8011ca:	29 ca                	sub    %ecx,%edx
+  8011cc:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8011d0:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8011d4:	83 c0 01             	add    $0x1,%eax
+  8011d7:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8011da:	83 c7 01             	add    $0x1,%edi
+  8011dd:	eb 9d                	jmp    80117c <devpipe_write+0x1c>
+
+008011df <devpipe_read>:
+{
+  8011df:	55                   	push   %ebp
+  8011e0:	89 e5                	mov    %esp,%ebp
+  8011e2:	57                   	push   %edi
+  8011e3:	56                   	push   %esi
+  8011e4:	53                   	push   %ebx
+  8011e5:	83 ec 18             	sub    $0x18,%esp
+  8011e8:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8011eb:	57                   	push   %edi
+  8011ec:	e8 4f f2 ff ff       	call   800440 <fd2data>
+  8011f1:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8011f3:	83 c4 10             	add    $0x10,%esp
+  8011f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8011fb:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8011fe:	75 13                	jne    801213 <devpipe_read+0x34>
+	return i;
+  801200:	89 f0                	mov    %esi,%eax
+  801202:	eb 02                	jmp    801206 <devpipe_read+0x27>
+				return i;
+  801204:	89 f0                	mov    %esi,%eax
+}
+  801206:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801209:	5b                   	pop    %ebx
+  80120a:	5e                   	pop    %esi
+  80120b:	5f                   	pop    %edi
+  80120c:	5d                   	pop    %ebp
+  80120d:	c3                   	ret
+			sys_yield();
+  80120e:	e8 2b ef ff ff       	call   80013e <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  801213:	8b 03                	mov    (%ebx),%eax
+  801215:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801218:	75 18                	jne    801232 <devpipe_read+0x53>
+			if (i > 0)
+  80121a:	85 f6                	test   %esi,%esi
+  80121c:	75 e6                	jne    801204 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  80121e:	89 da                	mov    %ebx,%edx
+  801220:	89 f8                	mov    %edi,%eax
+  801222:	e8 d4 fe ff ff       	call   8010fb <_pipeisclosed>
+  801227:	85 c0                	test   %eax,%eax
+  801229:	74 e3                	je     80120e <devpipe_read+0x2f>
+				return 0;
+  80122b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801230:	eb d4                	jmp    801206 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801232:	99                   	cltd
+  801233:	c1 ea 1b             	shr    $0x1b,%edx
+  801236:	01 d0                	add    %edx,%eax
+  801238:	83 e0 1f             	and    $0x1f,%eax
+  80123b:	29 d0                	sub    %edx,%eax
+  80123d:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801242:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801245:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  801248:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80124b:	83 c6 01             	add    $0x1,%esi
+  80124e:	eb ab                	jmp    8011fb <devpipe_read+0x1c>
+
+00801250 <pipe>:
+{
+  801250:	55                   	push   %ebp
+  801251:	89 e5                	mov    %esp,%ebp
+  801253:	56                   	push   %esi
+  801254:	53                   	push   %ebx
+  801255:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801258:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80125b:	50                   	push   %eax
+  80125c:	e8 f6 f1 ff ff       	call   800457 <fd_alloc>
+  801261:	89 c3                	mov    %eax,%ebx
+  801263:	83 c4 10             	add    $0x10,%esp
+  801266:	85 c0                	test   %eax,%eax
+  801268:	0f 88 23 01 00 00    	js     801391 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80126e:	83 ec 04             	sub    $0x4,%esp
+  801271:	68 07 04 00 00       	push   $0x407
+  801276:	ff 75 f4             	push   -0xc(%ebp)
+  801279:	6a 00                	push   $0x0
+  80127b:	e8 dd ee ff ff       	call   80015d <sys_page_alloc>
+  801280:	89 c3                	mov    %eax,%ebx
+  801282:	83 c4 10             	add    $0x10,%esp
+  801285:	85 c0                	test   %eax,%eax
+  801287:	0f 88 04 01 00 00    	js     801391 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80128d:	83 ec 0c             	sub    $0xc,%esp
+  801290:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801293:	50                   	push   %eax
+  801294:	e8 be f1 ff ff       	call   800457 <fd_alloc>
+  801299:	89 c3                	mov    %eax,%ebx
+  80129b:	83 c4 10             	add    $0x10,%esp
+  80129e:	85 c0                	test   %eax,%eax
+  8012a0:	0f 88 db 00 00 00    	js     801381 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8012a6:	83 ec 04             	sub    $0x4,%esp
+  8012a9:	68 07 04 00 00       	push   $0x407
+  8012ae:	ff 75 f0             	push   -0x10(%ebp)
+  8012b1:	6a 00                	push   $0x0
+  8012b3:	e8 a5 ee ff ff       	call   80015d <sys_page_alloc>
+  8012b8:	89 c3                	mov    %eax,%ebx
+  8012ba:	83 c4 10             	add    $0x10,%esp
+  8012bd:	85 c0                	test   %eax,%eax
+  8012bf:	0f 88 bc 00 00 00    	js     801381 <pipe+0x131>
+	va = fd2data(fd0);
+  8012c5:	83 ec 0c             	sub    $0xc,%esp
+  8012c8:	ff 75 f4             	push   -0xc(%ebp)
+  8012cb:	e8 70 f1 ff ff       	call   800440 <fd2data>
+  8012d0:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8012d2:	83 c4 0c             	add    $0xc,%esp
+  8012d5:	68 07 04 00 00       	push   $0x407
+  8012da:	50                   	push   %eax
+  8012db:	6a 00                	push   $0x0
+  8012dd:	e8 7b ee ff ff       	call   80015d <sys_page_alloc>
+  8012e2:	89 c3                	mov    %eax,%ebx
+  8012e4:	83 c4 10             	add    $0x10,%esp
+  8012e7:	85 c0                	test   %eax,%eax
+  8012e9:	0f 88 82 00 00 00    	js     801371 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8012ef:	83 ec 0c             	sub    $0xc,%esp
+  8012f2:	ff 75 f0             	push   -0x10(%ebp)
+  8012f5:	e8 46 f1 ff ff       	call   800440 <fd2data>
+  8012fa:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801301:	50                   	push   %eax
+  801302:	6a 00                	push   $0x0
+  801304:	56                   	push   %esi
+  801305:	6a 00                	push   $0x0
+  801307:	e8 94 ee ff ff       	call   8001a0 <sys_page_map>
+  80130c:	89 c3                	mov    %eax,%ebx
+  80130e:	83 c4 20             	add    $0x20,%esp
+  801311:	85 c0                	test   %eax,%eax
+  801313:	78 4e                	js     801363 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  801315:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  80131a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80131d:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80131f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801322:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  801329:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80132c:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80132e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801331:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  801338:	83 ec 0c             	sub    $0xc,%esp
+  80133b:	ff 75 f4             	push   -0xc(%ebp)
+  80133e:	e8 ed f0 ff ff       	call   800430 <fd2num>
+  801343:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801346:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  801348:	83 c4 04             	add    $0x4,%esp
+  80134b:	ff 75 f0             	push   -0x10(%ebp)
+  80134e:	e8 dd f0 ff ff       	call   800430 <fd2num>
+  801353:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801356:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  801359:	83 c4 10             	add    $0x10,%esp
+  80135c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801361:	eb 2e                	jmp    801391 <pipe+0x141>
+	sys_page_unmap(0, va);
+  801363:	83 ec 08             	sub    $0x8,%esp
+  801366:	56                   	push   %esi
+  801367:	6a 00                	push   $0x0
+  801369:	e8 74 ee ff ff       	call   8001e2 <sys_page_unmap>
+  80136e:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  801371:	83 ec 08             	sub    $0x8,%esp
+  801374:	ff 75 f0             	push   -0x10(%ebp)
+  801377:	6a 00                	push   $0x0
+  801379:	e8 64 ee ff ff       	call   8001e2 <sys_page_unmap>
+  80137e:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  801381:	83 ec 08             	sub    $0x8,%esp
+  801384:	ff 75 f4             	push   -0xc(%ebp)
+  801387:	6a 00                	push   $0x0
+  801389:	e8 54 ee ff ff       	call   8001e2 <sys_page_unmap>
+  80138e:	83 c4 10             	add    $0x10,%esp
+}
+  801391:	89 d8                	mov    %ebx,%eax
+  801393:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801396:	5b                   	pop    %ebx
+  801397:	5e                   	pop    %esi
+  801398:	5d                   	pop    %ebp
+  801399:	c3                   	ret
+
+0080139a <pipeisclosed>:
+{
+  80139a:	55                   	push   %ebp
+  80139b:	89 e5                	mov    %esp,%ebp
+  80139d:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8013a0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013a3:	50                   	push   %eax
+  8013a4:	ff 75 08             	push   0x8(%ebp)
+  8013a7:	e8 01 f1 ff ff       	call   8004ad <fd_lookup>
+  8013ac:	83 c4 10             	add    $0x10,%esp
+  8013af:	85 c0                	test   %eax,%eax
+  8013b1:	78 18                	js     8013cb <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8013b3:	83 ec 0c             	sub    $0xc,%esp
+  8013b6:	ff 75 f4             	push   -0xc(%ebp)
+  8013b9:	e8 82 f0 ff ff       	call   800440 <fd2data>
+  8013be:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8013c0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013c3:	e8 33 fd ff ff       	call   8010fb <_pipeisclosed>
+  8013c8:	83 c4 10             	add    $0x10,%esp
+}
+  8013cb:	c9                   	leave
+  8013cc:	c3                   	ret
+
+008013cd <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8013cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013d2:	c3                   	ret
+
+008013d3 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8013d3:	55                   	push   %ebp
+  8013d4:	89 e5                	mov    %esp,%ebp
+  8013d6:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8013d9:	68 53 26 80 00       	push   $0x802653
+  8013de:	ff 75 0c             	push   0xc(%ebp)
+  8013e1:	e8 ef 07 00 00       	call   801bd5 <strcpy>
+	return 0;
+}
+  8013e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013eb:	c9                   	leave
+  8013ec:	c3                   	ret
+
+008013ed <devcons_write>:
+{
+  8013ed:	55                   	push   %ebp
+  8013ee:	89 e5                	mov    %esp,%ebp
+  8013f0:	57                   	push   %edi
+  8013f1:	56                   	push   %esi
+  8013f2:	53                   	push   %ebx
+  8013f3:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8013f9:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8013fe:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  801404:	eb 2e                	jmp    801434 <devcons_write+0x47>
+		m = n - tot;
+  801406:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801409:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80140b:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801410:	39 c3                	cmp    %eax,%ebx
+  801412:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  801415:	83 ec 04             	sub    $0x4,%esp
+  801418:	53                   	push   %ebx
+  801419:	89 f0                	mov    %esi,%eax
+  80141b:	03 45 0c             	add    0xc(%ebp),%eax
+  80141e:	50                   	push   %eax
+  80141f:	57                   	push   %edi
+  801420:	e8 36 09 00 00       	call   801d5b <memmove>
+		sys_cputs(buf, m);
+  801425:	83 c4 08             	add    $0x8,%esp
+  801428:	53                   	push   %ebx
+  801429:	57                   	push   %edi
+  80142a:	e8 72 ec ff ff       	call   8000a1 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80142f:	01 de                	add    %ebx,%esi
+  801431:	83 c4 10             	add    $0x10,%esp
+  801434:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801437:	72 cd                	jb     801406 <devcons_write+0x19>
+}
+  801439:	89 f0                	mov    %esi,%eax
+  80143b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80143e:	5b                   	pop    %ebx
+  80143f:	5e                   	pop    %esi
+  801440:	5f                   	pop    %edi
+  801441:	5d                   	pop    %ebp
+  801442:	c3                   	ret
+
+00801443 <devcons_read>:
+{
+  801443:	55                   	push   %ebp
+  801444:	89 e5                	mov    %esp,%ebp
+  801446:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  801449:	b8 00 00 00 00       	mov    $0x0,%eax
+  80144e:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801452:	75 07                	jne    80145b <devcons_read+0x18>
+  801454:	eb 1f                	jmp    801475 <devcons_read+0x32>
+		sys_yield();
+  801456:	e8 e3 ec ff ff       	call   80013e <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80145b:	e8 5f ec ff ff       	call   8000bf <sys_cgetc>
+  801460:	85 c0                	test   %eax,%eax
+  801462:	74 f2                	je     801456 <devcons_read+0x13>
+	if (c < 0)
+  801464:	78 0f                	js     801475 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  801466:	83 f8 04             	cmp    $0x4,%eax
+  801469:	74 0c                	je     801477 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80146b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80146e:	88 02                	mov    %al,(%edx)
+	return 1;
+  801470:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  801475:	c9                   	leave
+  801476:	c3                   	ret
+		return 0;
+  801477:	b8 00 00 00 00       	mov    $0x0,%eax
+  80147c:	eb f7                	jmp    801475 <devcons_read+0x32>
+
+0080147e <cputchar>:
+{
+  80147e:	55                   	push   %ebp
+  80147f:	89 e5                	mov    %esp,%ebp
+  801481:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  801484:	8b 45 08             	mov    0x8(%ebp),%eax
+  801487:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80148a:	6a 01                	push   $0x1
+  80148c:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80148f:	50                   	push   %eax
+  801490:	e8 0c ec ff ff       	call   8000a1 <sys_cputs>
+}
+  801495:	83 c4 10             	add    $0x10,%esp
+  801498:	c9                   	leave
+  801499:	c3                   	ret
+
+0080149a <getchar>:
+{
+  80149a:	55                   	push   %ebp
+  80149b:	89 e5                	mov    %esp,%ebp
+  80149d:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8014a0:	6a 01                	push   $0x1
+  8014a2:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8014a5:	50                   	push   %eax
+  8014a6:	6a 00                	push   $0x0
+  8014a8:	e8 66 f2 ff ff       	call   800713 <read>
+	if (r < 0)
+  8014ad:	83 c4 10             	add    $0x10,%esp
+  8014b0:	85 c0                	test   %eax,%eax
+  8014b2:	78 06                	js     8014ba <getchar+0x20>
+	if (r < 1)
+  8014b4:	74 06                	je     8014bc <getchar+0x22>
+	return c;
+  8014b6:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8014ba:	c9                   	leave
+  8014bb:	c3                   	ret
+		return -E_EOF;
+  8014bc:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8014c1:	eb f7                	jmp    8014ba <getchar+0x20>
+
+008014c3 <iscons>:
+{
+  8014c3:	55                   	push   %ebp
+  8014c4:	89 e5                	mov    %esp,%ebp
+  8014c6:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8014c9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014cc:	50                   	push   %eax
+  8014cd:	ff 75 08             	push   0x8(%ebp)
+  8014d0:	e8 d8 ef ff ff       	call   8004ad <fd_lookup>
+  8014d5:	83 c4 10             	add    $0x10,%esp
+  8014d8:	85 c0                	test   %eax,%eax
+  8014da:	78 11                	js     8014ed <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8014dc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014df:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  8014e5:	39 10                	cmp    %edx,(%eax)
+  8014e7:	0f 94 c0             	sete   %al
+  8014ea:	0f b6 c0             	movzbl %al,%eax
+}
+  8014ed:	c9                   	leave
+  8014ee:	c3                   	ret
+
+008014ef <opencons>:
+{
+  8014ef:	55                   	push   %ebp
+  8014f0:	89 e5                	mov    %esp,%ebp
+  8014f2:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8014f5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014f8:	50                   	push   %eax
+  8014f9:	e8 59 ef ff ff       	call   800457 <fd_alloc>
+  8014fe:	83 c4 10             	add    $0x10,%esp
+  801501:	85 c0                	test   %eax,%eax
+  801503:	78 3a                	js     80153f <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  801505:	83 ec 04             	sub    $0x4,%esp
+  801508:	68 07 04 00 00       	push   $0x407
+  80150d:	ff 75 f4             	push   -0xc(%ebp)
+  801510:	6a 00                	push   $0x0
+  801512:	e8 46 ec ff ff       	call   80015d <sys_page_alloc>
+  801517:	83 c4 10             	add    $0x10,%esp
+  80151a:	85 c0                	test   %eax,%eax
+  80151c:	78 21                	js     80153f <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80151e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801521:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  801527:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  801529:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80152c:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  801533:	83 ec 0c             	sub    $0xc,%esp
+  801536:	50                   	push   %eax
+  801537:	e8 f4 ee ff ff       	call   800430 <fd2num>
+  80153c:	83 c4 10             	add    $0x10,%esp
+}
+  80153f:	c9                   	leave
+  801540:	c3                   	ret
+
+00801541 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  801541:	55                   	push   %ebp
+  801542:	89 e5                	mov    %esp,%ebp
+  801544:	56                   	push   %esi
+  801545:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  801546:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  801549:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  80154f:	e8 cb eb ff ff       	call   80011f <sys_getenvid>
+  801554:	83 ec 0c             	sub    $0xc,%esp
+  801557:	ff 75 0c             	push   0xc(%ebp)
+  80155a:	ff 75 08             	push   0x8(%ebp)
+  80155d:	56                   	push   %esi
+  80155e:	50                   	push   %eax
+  80155f:	68 60 26 80 00       	push   $0x802660
+  801564:	e8 b3 00 00 00       	call   80161c <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  801569:	83 c4 18             	add    $0x18,%esp
+  80156c:	53                   	push   %ebx
+  80156d:	ff 75 10             	push   0x10(%ebp)
+  801570:	e8 56 00 00 00       	call   8015cb <vcprintf>
+	cprintf("\n");
+  801575:	c7 04 24 4c 26 80 00 	movl   $0x80264c,(%esp)
+  80157c:	e8 9b 00 00 00       	call   80161c <cprintf>
+  801581:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  801584:	cc                   	int3
+	while (1)
+  801585:	eb fd                	jmp    801584 <_panic+0x43>
+
+00801587 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  801587:	55                   	push   %ebp
+  801588:	89 e5                	mov    %esp,%ebp
+  80158a:	53                   	push   %ebx
+  80158b:	83 ec 04             	sub    $0x4,%esp
+  80158e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  801591:	8b 13                	mov    (%ebx),%edx
+  801593:	8d 42 01             	lea    0x1(%edx),%eax
+  801596:	89 03                	mov    %eax,(%ebx)
+  801598:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80159b:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80159f:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8015a4:	74 09                	je     8015af <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8015a6:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8015aa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015ad:	c9                   	leave
+  8015ae:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8015af:	83 ec 08             	sub    $0x8,%esp
+  8015b2:	68 ff 00 00 00       	push   $0xff
+  8015b7:	8d 43 08             	lea    0x8(%ebx),%eax
+  8015ba:	50                   	push   %eax
+  8015bb:	e8 e1 ea ff ff       	call   8000a1 <sys_cputs>
+		b->idx = 0;
+  8015c0:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8015c6:	83 c4 10             	add    $0x10,%esp
+  8015c9:	eb db                	jmp    8015a6 <putch+0x1f>
+
+008015cb <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8015cb:	55                   	push   %ebp
+  8015cc:	89 e5                	mov    %esp,%ebp
+  8015ce:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8015d4:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8015db:	00 00 00 
+	b.cnt = 0;
+  8015de:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8015e5:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8015e8:	ff 75 0c             	push   0xc(%ebp)
+  8015eb:	ff 75 08             	push   0x8(%ebp)
+  8015ee:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8015f4:	50                   	push   %eax
+  8015f5:	68 87 15 80 00       	push   $0x801587
+  8015fa:	e8 14 01 00 00       	call   801713 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8015ff:	83 c4 08             	add    $0x8,%esp
+  801602:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  801608:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80160e:	50                   	push   %eax
+  80160f:	e8 8d ea ff ff       	call   8000a1 <sys_cputs>
+
+	return b.cnt;
+}
+  801614:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80161a:	c9                   	leave
+  80161b:	c3                   	ret
+
+0080161c <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80161c:	55                   	push   %ebp
+  80161d:	89 e5                	mov    %esp,%ebp
+  80161f:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  801622:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  801625:	50                   	push   %eax
+  801626:	ff 75 08             	push   0x8(%ebp)
+  801629:	e8 9d ff ff ff       	call   8015cb <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80162e:	c9                   	leave
+  80162f:	c3                   	ret
+
+00801630 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  801630:	55                   	push   %ebp
+  801631:	89 e5                	mov    %esp,%ebp
+  801633:	57                   	push   %edi
+  801634:	56                   	push   %esi
+  801635:	53                   	push   %ebx
+  801636:	83 ec 1c             	sub    $0x1c,%esp
+  801639:	89 c7                	mov    %eax,%edi
+  80163b:	89 d6                	mov    %edx,%esi
+  80163d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801640:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801643:	89 d1                	mov    %edx,%ecx
+  801645:	89 c2                	mov    %eax,%edx
+  801647:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80164a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80164d:	8b 45 10             	mov    0x10(%ebp),%eax
+  801650:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  801653:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801656:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80165d:	39 c2                	cmp    %eax,%edx
+  80165f:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  801662:	72 3e                	jb     8016a2 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  801664:	83 ec 0c             	sub    $0xc,%esp
+  801667:	ff 75 18             	push   0x18(%ebp)
+  80166a:	83 eb 01             	sub    $0x1,%ebx
+  80166d:	53                   	push   %ebx
+  80166e:	50                   	push   %eax
+  80166f:	83 ec 08             	sub    $0x8,%esp
+  801672:	ff 75 e4             	push   -0x1c(%ebp)
+  801675:	ff 75 e0             	push   -0x20(%ebp)
+  801678:	ff 75 dc             	push   -0x24(%ebp)
+  80167b:	ff 75 d8             	push   -0x28(%ebp)
+  80167e:	e8 dd 0a 00 00       	call   802160 <__udivdi3>
+  801683:	83 c4 18             	add    $0x18,%esp
+  801686:	52                   	push   %edx
+  801687:	50                   	push   %eax
+  801688:	89 f2                	mov    %esi,%edx
+  80168a:	89 f8                	mov    %edi,%eax
+  80168c:	e8 9f ff ff ff       	call   801630 <printnum>
+  801691:	83 c4 20             	add    $0x20,%esp
+  801694:	eb 13                	jmp    8016a9 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  801696:	83 ec 08             	sub    $0x8,%esp
+  801699:	56                   	push   %esi
+  80169a:	ff 75 18             	push   0x18(%ebp)
+  80169d:	ff d7                	call   *%edi
+  80169f:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8016a2:	83 eb 01             	sub    $0x1,%ebx
+  8016a5:	85 db                	test   %ebx,%ebx
+  8016a7:	7f ed                	jg     801696 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8016a9:	83 ec 08             	sub    $0x8,%esp
+  8016ac:	56                   	push   %esi
+  8016ad:	83 ec 04             	sub    $0x4,%esp
+  8016b0:	ff 75 e4             	push   -0x1c(%ebp)
+  8016b3:	ff 75 e0             	push   -0x20(%ebp)
+  8016b6:	ff 75 dc             	push   -0x24(%ebp)
+  8016b9:	ff 75 d8             	push   -0x28(%ebp)
+  8016bc:	e8 6f 0b 00 00       	call   802230 <__umoddi3>
+  8016c1:	83 c4 14             	add    $0x14,%esp
+  8016c4:	0f be 80 83 26 80 00 	movsbl 0x802683(%eax),%eax
+  8016cb:	50                   	push   %eax
+  8016cc:	ff d7                	call   *%edi
+}
+  8016ce:	83 c4 10             	add    $0x10,%esp
+  8016d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016d4:	5b                   	pop    %ebx
+  8016d5:	5e                   	pop    %esi
+  8016d6:	5f                   	pop    %edi
+  8016d7:	5d                   	pop    %ebp
+  8016d8:	c3                   	ret
+
+008016d9 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8016d9:	55                   	push   %ebp
+  8016da:	89 e5                	mov    %esp,%ebp
+  8016dc:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8016df:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8016e3:	8b 10                	mov    (%eax),%edx
+  8016e5:	3b 50 04             	cmp    0x4(%eax),%edx
+  8016e8:	73 0a                	jae    8016f4 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8016ea:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8016ed:	89 08                	mov    %ecx,(%eax)
+  8016ef:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016f2:	88 02                	mov    %al,(%edx)
+}
+  8016f4:	5d                   	pop    %ebp
+  8016f5:	c3                   	ret
+
+008016f6 <printfmt>:
+{
+  8016f6:	55                   	push   %ebp
+  8016f7:	89 e5                	mov    %esp,%ebp
+  8016f9:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8016fc:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8016ff:	50                   	push   %eax
+  801700:	ff 75 10             	push   0x10(%ebp)
+  801703:	ff 75 0c             	push   0xc(%ebp)
+  801706:	ff 75 08             	push   0x8(%ebp)
+  801709:	e8 05 00 00 00       	call   801713 <vprintfmt>
+}
+  80170e:	83 c4 10             	add    $0x10,%esp
+  801711:	c9                   	leave
+  801712:	c3                   	ret
+
+00801713 <vprintfmt>:
+{
+  801713:	55                   	push   %ebp
+  801714:	89 e5                	mov    %esp,%ebp
+  801716:	57                   	push   %edi
+  801717:	56                   	push   %esi
+  801718:	53                   	push   %ebx
+  801719:	83 ec 2c             	sub    $0x2c,%esp
+  80171c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80171f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801722:	8b 7d 10             	mov    0x10(%ebp),%edi
+  801725:	eb 0a                	jmp    801731 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  801727:	83 ec 08             	sub    $0x8,%esp
+  80172a:	53                   	push   %ebx
+  80172b:	50                   	push   %eax
+  80172c:	ff d6                	call   *%esi
+  80172e:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801731:	83 c7 01             	add    $0x1,%edi
+  801734:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  801738:	83 f8 25             	cmp    $0x25,%eax
+  80173b:	74 0c                	je     801749 <vprintfmt+0x36>
+			if (ch == '\0')
+  80173d:	85 c0                	test   %eax,%eax
+  80173f:	75 e6                	jne    801727 <vprintfmt+0x14>
+}
+  801741:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801744:	5b                   	pop    %ebx
+  801745:	5e                   	pop    %esi
+  801746:	5f                   	pop    %edi
+  801747:	5d                   	pop    %ebp
+  801748:	c3                   	ret
+		padc = ' ';
+  801749:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80174d:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  801754:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80175b:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  801762:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801767:	8d 47 01             	lea    0x1(%edi),%eax
+  80176a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80176d:	0f b6 17             	movzbl (%edi),%edx
+  801770:	8d 42 dd             	lea    -0x23(%edx),%eax
+  801773:	3c 55                	cmp    $0x55,%al
+  801775:	0f 87 9a 03 00 00    	ja     801b15 <vprintfmt+0x402>
+  80177b:	0f b6 c0             	movzbl %al,%eax
+  80177e:	ff 24 85 c0 27 80 00 	jmp    *0x8027c0(,%eax,4)
+  801785:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  801788:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80178c:	eb d9                	jmp    801767 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80178e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801791:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  801795:	eb d0                	jmp    801767 <vprintfmt+0x54>
+  801797:	0f b6 d2             	movzbl %dl,%edx
+  80179a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80179d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017a2:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8017a5:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8017a8:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8017ac:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8017af:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8017b2:	83 f9 09             	cmp    $0x9,%ecx
+  8017b5:	77 55                	ja     80180c <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8017b7:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8017ba:	eb e9                	jmp    8017a5 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8017bc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8017bf:	8b 00                	mov    (%eax),%eax
+  8017c1:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8017c4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8017c7:	8d 40 04             	lea    0x4(%eax),%eax
+  8017ca:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8017cd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8017d0:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8017d4:	79 91                	jns    801767 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8017d6:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8017d9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8017dc:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8017e3:	eb 82                	jmp    801767 <vprintfmt+0x54>
+			if (width < 0)
+  8017e5:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8017e8:	85 d2                	test   %edx,%edx
+  8017ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017ef:	0f 49 c2             	cmovns %edx,%eax
+  8017f2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8017f5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8017f8:	e9 6a ff ff ff       	jmp    801767 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8017fd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  801800:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  801807:	e9 5b ff ff ff       	jmp    801767 <vprintfmt+0x54>
+  80180c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80180f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801812:	eb bc                	jmp    8017d0 <vprintfmt+0xbd>
+			lflag++;
+  801814:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801817:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80181a:	e9 48 ff ff ff       	jmp    801767 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80181f:	8b 45 14             	mov    0x14(%ebp),%eax
+  801822:	8d 78 04             	lea    0x4(%eax),%edi
+  801825:	83 ec 08             	sub    $0x8,%esp
+  801828:	53                   	push   %ebx
+  801829:	ff 30                	push   (%eax)
+  80182b:	ff d6                	call   *%esi
+			break;
+  80182d:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  801830:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  801833:	e9 7c 02 00 00       	jmp    801ab4 <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  801838:	8b 45 14             	mov    0x14(%ebp),%eax
+  80183b:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80183e:	8b 10                	mov    (%eax),%edx
+  801840:	89 d0                	mov    %edx,%eax
+  801842:	f7 d8                	neg    %eax
+  801844:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  801847:	83 f8 10             	cmp    $0x10,%eax
+  80184a:	7f 23                	jg     80186f <vprintfmt+0x15c>
+  80184c:	8b 14 85 20 29 80 00 	mov    0x802920(,%eax,4),%edx
+  801853:	85 d2                	test   %edx,%edx
+  801855:	74 18                	je     80186f <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  801857:	52                   	push   %edx
+  801858:	68 e1 25 80 00       	push   $0x8025e1
+  80185d:	53                   	push   %ebx
+  80185e:	56                   	push   %esi
+  80185f:	e8 92 fe ff ff       	call   8016f6 <printfmt>
+  801864:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801867:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80186a:	e9 45 02 00 00       	jmp    801ab4 <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  80186f:	50                   	push   %eax
+  801870:	68 9b 26 80 00       	push   $0x80269b
+  801875:	53                   	push   %ebx
+  801876:	56                   	push   %esi
+  801877:	e8 7a fe ff ff       	call   8016f6 <printfmt>
+  80187c:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80187f:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  801882:	e9 2d 02 00 00       	jmp    801ab4 <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801887:	8b 45 14             	mov    0x14(%ebp),%eax
+  80188a:	83 c0 04             	add    $0x4,%eax
+  80188d:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  801890:	8b 45 14             	mov    0x14(%ebp),%eax
+  801893:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  801895:	85 c9                	test   %ecx,%ecx
+  801897:	b8 94 26 80 00       	mov    $0x802694,%eax
+  80189c:	0f 45 c1             	cmovne %ecx,%eax
+  80189f:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8018a2:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8018a6:	7e 06                	jle    8018ae <vprintfmt+0x19b>
+  8018a8:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8018ac:	75 0b                	jne    8018b9 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8018ae:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8018b1:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8018b4:	89 75 08             	mov    %esi,0x8(%ebp)
+  8018b7:	eb 5c                	jmp    801915 <vprintfmt+0x202>
+  8018b9:	83 ec 08             	sub    $0x8,%esp
+  8018bc:	ff 75 d0             	push   -0x30(%ebp)
+  8018bf:	ff 75 cc             	push   -0x34(%ebp)
+  8018c2:	e8 eb 02 00 00       	call   801bb2 <strnlen>
+  8018c7:	89 c2                	mov    %eax,%edx
+  8018c9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8018cc:	29 d0                	sub    %edx,%eax
+  8018ce:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8018d1:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8018d5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8018d8:	89 75 08             	mov    %esi,0x8(%ebp)
+  8018db:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8018dd:	eb 0e                	jmp    8018ed <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8018df:	83 ec 08             	sub    $0x8,%esp
+  8018e2:	53                   	push   %ebx
+  8018e3:	57                   	push   %edi
+  8018e4:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8018e7:	83 ee 01             	sub    $0x1,%esi
+  8018ea:	83 c4 10             	add    $0x10,%esp
+  8018ed:	85 f6                	test   %esi,%esi
+  8018ef:	7f ee                	jg     8018df <vprintfmt+0x1cc>
+  8018f1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8018f4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8018f7:	85 c0                	test   %eax,%eax
+  8018f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018fe:	0f 49 d0             	cmovns %eax,%edx
+  801901:	29 d0                	sub    %edx,%eax
+  801903:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801906:	eb a6                	jmp    8018ae <vprintfmt+0x19b>
+					putch(ch, putdat);
+  801908:	83 ec 08             	sub    $0x8,%esp
+  80190b:	53                   	push   %ebx
+  80190c:	52                   	push   %edx
+  80190d:	ff 55 08             	call   *0x8(%ebp)
+  801910:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801913:	89 f1                	mov    %esi,%ecx
+  801915:	8d 71 01             	lea    0x1(%ecx),%esi
+  801918:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80191c:	0f be d0             	movsbl %al,%edx
+  80191f:	85 d2                	test   %edx,%edx
+  801921:	74 28                	je     80194b <vprintfmt+0x238>
+  801923:	85 ff                	test   %edi,%edi
+  801925:	78 05                	js     80192c <vprintfmt+0x219>
+  801927:	83 ef 01             	sub    $0x1,%edi
+  80192a:	78 30                	js     80195c <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80192c:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  801930:	74 d6                	je     801908 <vprintfmt+0x1f5>
+  801932:	0f be c0             	movsbl %al,%eax
+  801935:	83 e8 20             	sub    $0x20,%eax
+  801938:	83 f8 5e             	cmp    $0x5e,%eax
+  80193b:	76 cb                	jbe    801908 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80193d:	83 ec 08             	sub    $0x8,%esp
+  801940:	53                   	push   %ebx
+  801941:	6a 3f                	push   $0x3f
+  801943:	ff 55 08             	call   *0x8(%ebp)
+  801946:	83 c4 10             	add    $0x10,%esp
+  801949:	eb c8                	jmp    801913 <vprintfmt+0x200>
+  80194b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80194e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  801951:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801954:	01 d0                	add    %edx,%eax
+  801956:	29 c8                	sub    %ecx,%eax
+  801958:	89 c7                	mov    %eax,%edi
+  80195a:	eb 13                	jmp    80196f <vprintfmt+0x25c>
+  80195c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80195f:	eb ed                	jmp    80194e <vprintfmt+0x23b>
+				putch(' ', putdat);
+  801961:	83 ec 08             	sub    $0x8,%esp
+  801964:	53                   	push   %ebx
+  801965:	6a 20                	push   $0x20
+  801967:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  801969:	83 ef 01             	sub    $0x1,%edi
+  80196c:	83 c4 10             	add    $0x10,%esp
+  80196f:	85 ff                	test   %edi,%edi
+  801971:	7f ee                	jg     801961 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801973:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  801976:	89 45 14             	mov    %eax,0x14(%ebp)
+  801979:	e9 36 01 00 00       	jmp    801ab4 <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  80197e:	83 f9 01             	cmp    $0x1,%ecx
+  801981:	7f 1f                	jg     8019a2 <vprintfmt+0x28f>
+	else if (lflag)
+  801983:	85 c9                	test   %ecx,%ecx
+  801985:	74 67                	je     8019ee <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  801987:	8b 45 14             	mov    0x14(%ebp),%eax
+  80198a:	8b 00                	mov    (%eax),%eax
+  80198c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80198f:	89 c1                	mov    %eax,%ecx
+  801991:	c1 f9 1f             	sar    $0x1f,%ecx
+  801994:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801997:	8b 45 14             	mov    0x14(%ebp),%eax
+  80199a:	8d 40 04             	lea    0x4(%eax),%eax
+  80199d:	89 45 14             	mov    %eax,0x14(%ebp)
+  8019a0:	eb 17                	jmp    8019b9 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8019a2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019a5:	8b 50 04             	mov    0x4(%eax),%edx
+  8019a8:	8b 00                	mov    (%eax),%eax
+  8019aa:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8019ad:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8019b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019b3:	8d 40 08             	lea    0x8(%eax),%eax
+  8019b6:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8019b9:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8019bc:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8019bf:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8019c4:	85 c9                	test   %ecx,%ecx
+  8019c6:	0f 89 ce 00 00 00    	jns    801a9a <vprintfmt+0x387>
+				putch('-', putdat);
+  8019cc:	83 ec 08             	sub    $0x8,%esp
+  8019cf:	53                   	push   %ebx
+  8019d0:	6a 2d                	push   $0x2d
+  8019d2:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8019d4:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8019d7:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8019da:	f7 da                	neg    %edx
+  8019dc:	83 d1 00             	adc    $0x0,%ecx
+  8019df:	f7 d9                	neg    %ecx
+  8019e1:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8019e4:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8019e9:	e9 ac 00 00 00       	jmp    801a9a <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  8019ee:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019f1:	8b 00                	mov    (%eax),%eax
+  8019f3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8019f6:	89 c1                	mov    %eax,%ecx
+  8019f8:	c1 f9 1f             	sar    $0x1f,%ecx
+  8019fb:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8019fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a01:	8d 40 04             	lea    0x4(%eax),%eax
+  801a04:	89 45 14             	mov    %eax,0x14(%ebp)
+  801a07:	eb b0                	jmp    8019b9 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  801a09:	83 f9 01             	cmp    $0x1,%ecx
+  801a0c:	7f 1b                	jg     801a29 <vprintfmt+0x316>
+	else if (lflag)
+  801a0e:	85 c9                	test   %ecx,%ecx
+  801a10:	74 2c                	je     801a3e <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  801a12:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a15:	8b 10                	mov    (%eax),%edx
+  801a17:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a1c:	8d 40 04             	lea    0x4(%eax),%eax
+  801a1f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801a22:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  801a27:	eb 71                	jmp    801a9a <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  801a29:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a2c:	8b 10                	mov    (%eax),%edx
+  801a2e:	8b 48 04             	mov    0x4(%eax),%ecx
+  801a31:	8d 40 08             	lea    0x8(%eax),%eax
+  801a34:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801a37:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  801a3c:	eb 5c                	jmp    801a9a <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  801a3e:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a41:	8b 10                	mov    (%eax),%edx
+  801a43:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a48:	8d 40 04             	lea    0x4(%eax),%eax
+  801a4b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801a4e:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  801a53:	eb 45                	jmp    801a9a <vprintfmt+0x387>
+			putch('X', putdat);
+  801a55:	83 ec 08             	sub    $0x8,%esp
+  801a58:	53                   	push   %ebx
+  801a59:	6a 58                	push   $0x58
+  801a5b:	ff d6                	call   *%esi
+			putch('X', putdat);
+  801a5d:	83 c4 08             	add    $0x8,%esp
+  801a60:	53                   	push   %ebx
+  801a61:	6a 58                	push   $0x58
+  801a63:	ff d6                	call   *%esi
+			putch('X', putdat);
+  801a65:	83 c4 08             	add    $0x8,%esp
+  801a68:	53                   	push   %ebx
+  801a69:	6a 58                	push   $0x58
+  801a6b:	ff d6                	call   *%esi
+			break;
+  801a6d:	83 c4 10             	add    $0x10,%esp
+  801a70:	eb 42                	jmp    801ab4 <vprintfmt+0x3a1>
+			putch('0', putdat);
+  801a72:	83 ec 08             	sub    $0x8,%esp
+  801a75:	53                   	push   %ebx
+  801a76:	6a 30                	push   $0x30
+  801a78:	ff d6                	call   *%esi
+			putch('x', putdat);
+  801a7a:	83 c4 08             	add    $0x8,%esp
+  801a7d:	53                   	push   %ebx
+  801a7e:	6a 78                	push   $0x78
+  801a80:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  801a82:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a85:	8b 10                	mov    (%eax),%edx
+  801a87:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  801a8c:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  801a8f:	8d 40 04             	lea    0x4(%eax),%eax
+  801a92:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801a95:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  801a9a:	83 ec 0c             	sub    $0xc,%esp
+  801a9d:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  801aa1:	50                   	push   %eax
+  801aa2:	ff 75 e0             	push   -0x20(%ebp)
+  801aa5:	57                   	push   %edi
+  801aa6:	51                   	push   %ecx
+  801aa7:	52                   	push   %edx
+  801aa8:	89 da                	mov    %ebx,%edx
+  801aaa:	89 f0                	mov    %esi,%eax
+  801aac:	e8 7f fb ff ff       	call   801630 <printnum>
+			break;
+  801ab1:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  801ab4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801ab7:	e9 75 fc ff ff       	jmp    801731 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  801abc:	83 f9 01             	cmp    $0x1,%ecx
+  801abf:	7f 1b                	jg     801adc <vprintfmt+0x3c9>
+	else if (lflag)
+  801ac1:	85 c9                	test   %ecx,%ecx
+  801ac3:	74 2c                	je     801af1 <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  801ac5:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ac8:	8b 10                	mov    (%eax),%edx
+  801aca:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801acf:	8d 40 04             	lea    0x4(%eax),%eax
+  801ad2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801ad5:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  801ada:	eb be                	jmp    801a9a <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  801adc:	8b 45 14             	mov    0x14(%ebp),%eax
+  801adf:	8b 10                	mov    (%eax),%edx
+  801ae1:	8b 48 04             	mov    0x4(%eax),%ecx
+  801ae4:	8d 40 08             	lea    0x8(%eax),%eax
+  801ae7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801aea:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  801aef:	eb a9                	jmp    801a9a <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  801af1:	8b 45 14             	mov    0x14(%ebp),%eax
+  801af4:	8b 10                	mov    (%eax),%edx
+  801af6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801afb:	8d 40 04             	lea    0x4(%eax),%eax
+  801afe:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801b01:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  801b06:	eb 92                	jmp    801a9a <vprintfmt+0x387>
+			putch(ch, putdat);
+  801b08:	83 ec 08             	sub    $0x8,%esp
+  801b0b:	53                   	push   %ebx
+  801b0c:	6a 25                	push   $0x25
+  801b0e:	ff d6                	call   *%esi
+			break;
+  801b10:	83 c4 10             	add    $0x10,%esp
+  801b13:	eb 9f                	jmp    801ab4 <vprintfmt+0x3a1>
+			putch('%', putdat);
+  801b15:	83 ec 08             	sub    $0x8,%esp
+  801b18:	53                   	push   %ebx
+  801b19:	6a 25                	push   $0x25
+  801b1b:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801b1d:	83 c4 10             	add    $0x10,%esp
+  801b20:	89 f8                	mov    %edi,%eax
+  801b22:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  801b26:	74 05                	je     801b2d <vprintfmt+0x41a>
+  801b28:	83 e8 01             	sub    $0x1,%eax
+  801b2b:	eb f5                	jmp    801b22 <vprintfmt+0x40f>
+  801b2d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801b30:	eb 82                	jmp    801ab4 <vprintfmt+0x3a1>
+
+00801b32 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  801b32:	55                   	push   %ebp
+  801b33:	89 e5                	mov    %esp,%ebp
+  801b35:	83 ec 18             	sub    $0x18,%esp
+  801b38:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b3b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  801b3e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  801b41:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  801b45:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  801b48:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  801b4f:	85 c0                	test   %eax,%eax
+  801b51:	74 26                	je     801b79 <vsnprintf+0x47>
+  801b53:	85 d2                	test   %edx,%edx
+  801b55:	7e 22                	jle    801b79 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  801b57:	ff 75 14             	push   0x14(%ebp)
+  801b5a:	ff 75 10             	push   0x10(%ebp)
+  801b5d:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  801b60:	50                   	push   %eax
+  801b61:	68 d9 16 80 00       	push   $0x8016d9
+  801b66:	e8 a8 fb ff ff       	call   801713 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  801b6b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801b6e:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  801b71:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b74:	83 c4 10             	add    $0x10,%esp
+}
+  801b77:	c9                   	leave
+  801b78:	c3                   	ret
+		return -E_INVAL;
+  801b79:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b7e:	eb f7                	jmp    801b77 <vsnprintf+0x45>
+
+00801b80 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801b80:	55                   	push   %ebp
+  801b81:	89 e5                	mov    %esp,%ebp
+  801b83:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  801b86:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  801b89:	50                   	push   %eax
+  801b8a:	ff 75 10             	push   0x10(%ebp)
+  801b8d:	ff 75 0c             	push   0xc(%ebp)
+  801b90:	ff 75 08             	push   0x8(%ebp)
+  801b93:	e8 9a ff ff ff       	call   801b32 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  801b98:	c9                   	leave
+  801b99:	c3                   	ret
+
+00801b9a <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  801b9a:	55                   	push   %ebp
+  801b9b:	89 e5                	mov    %esp,%ebp
+  801b9d:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  801ba0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ba5:	eb 03                	jmp    801baa <strlen+0x10>
+		n++;
+  801ba7:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  801baa:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  801bae:	75 f7                	jne    801ba7 <strlen+0xd>
+	return n;
+}
+  801bb0:	5d                   	pop    %ebp
+  801bb1:	c3                   	ret
+
+00801bb2 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  801bb2:	55                   	push   %ebp
+  801bb3:	89 e5                	mov    %esp,%ebp
+  801bb5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801bb8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801bbb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bc0:	eb 03                	jmp    801bc5 <strnlen+0x13>
+		n++;
+  801bc2:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801bc5:	39 d0                	cmp    %edx,%eax
+  801bc7:	74 08                	je     801bd1 <strnlen+0x1f>
+  801bc9:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  801bcd:	75 f3                	jne    801bc2 <strnlen+0x10>
+  801bcf:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  801bd1:	89 d0                	mov    %edx,%eax
+  801bd3:	5d                   	pop    %ebp
+  801bd4:	c3                   	ret
+
+00801bd5 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801bd5:	55                   	push   %ebp
+  801bd6:	89 e5                	mov    %esp,%ebp
+  801bd8:	53                   	push   %ebx
+  801bd9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801bdc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  801bdf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801be4:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  801be8:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  801beb:	83 c0 01             	add    $0x1,%eax
+  801bee:	84 d2                	test   %dl,%dl
+  801bf0:	75 f2                	jne    801be4 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  801bf2:	89 c8                	mov    %ecx,%eax
+  801bf4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bf7:	c9                   	leave
+  801bf8:	c3                   	ret
+
+00801bf9 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801bf9:	55                   	push   %ebp
+  801bfa:	89 e5                	mov    %esp,%ebp
+  801bfc:	53                   	push   %ebx
+  801bfd:	83 ec 10             	sub    $0x10,%esp
+  801c00:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  801c03:	53                   	push   %ebx
+  801c04:	e8 91 ff ff ff       	call   801b9a <strlen>
+  801c09:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  801c0c:	ff 75 0c             	push   0xc(%ebp)
+  801c0f:	01 d8                	add    %ebx,%eax
+  801c11:	50                   	push   %eax
+  801c12:	e8 be ff ff ff       	call   801bd5 <strcpy>
+	return dst;
+}
+  801c17:	89 d8                	mov    %ebx,%eax
+  801c19:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c1c:	c9                   	leave
+  801c1d:	c3                   	ret
+
+00801c1e <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801c1e:	55                   	push   %ebp
+  801c1f:	89 e5                	mov    %esp,%ebp
+  801c21:	56                   	push   %esi
+  801c22:	53                   	push   %ebx
+  801c23:	8b 75 08             	mov    0x8(%ebp),%esi
+  801c26:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  801c29:	89 f3                	mov    %esi,%ebx
+  801c2b:	03 5d 10             	add    0x10(%ebp),%ebx
+  801c2e:	89 f0                	mov    %esi,%eax
+  801c30:	eb 0f                	jmp    801c41 <strncpy+0x23>
+		*dst++ = *src;
+  801c32:	83 c0 01             	add    $0x1,%eax
+  801c35:	0f b6 0a             	movzbl (%edx),%ecx
+  801c38:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  801c3b:	80 f9 01             	cmp    $0x1,%cl
+  801c3e:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  801c41:	39 d8                	cmp    %ebx,%eax
+  801c43:	75 ed                	jne    801c32 <strncpy+0x14>
+	}
+	return ret;
+}
+  801c45:	89 f0                	mov    %esi,%eax
+  801c47:	5b                   	pop    %ebx
+  801c48:	5e                   	pop    %esi
+  801c49:	5d                   	pop    %ebp
+  801c4a:	c3                   	ret
+
+00801c4b <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801c4b:	55                   	push   %ebp
+  801c4c:	89 e5                	mov    %esp,%ebp
+  801c4e:	56                   	push   %esi
+  801c4f:	53                   	push   %ebx
+  801c50:	8b 75 08             	mov    0x8(%ebp),%esi
+  801c53:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c56:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  801c59:	89 f0                	mov    %esi,%eax
+  801c5b:	85 d2                	test   %edx,%edx
+  801c5d:	74 21                	je     801c80 <strlcpy+0x35>
+  801c5f:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  801c63:	89 f2                	mov    %esi,%edx
+  801c65:	eb 09                	jmp    801c70 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  801c67:	83 c1 01             	add    $0x1,%ecx
+  801c6a:	83 c2 01             	add    $0x1,%edx
+  801c6d:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  801c70:	39 c2                	cmp    %eax,%edx
+  801c72:	74 09                	je     801c7d <strlcpy+0x32>
+  801c74:	0f b6 19             	movzbl (%ecx),%ebx
+  801c77:	84 db                	test   %bl,%bl
+  801c79:	75 ec                	jne    801c67 <strlcpy+0x1c>
+  801c7b:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  801c7d:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  801c80:	29 f0                	sub    %esi,%eax
+}
+  801c82:	5b                   	pop    %ebx
+  801c83:	5e                   	pop    %esi
+  801c84:	5d                   	pop    %ebp
+  801c85:	c3                   	ret
+
+00801c86 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  801c86:	55                   	push   %ebp
+  801c87:	89 e5                	mov    %esp,%ebp
+  801c89:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801c8c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  801c8f:	eb 06                	jmp    801c97 <strcmp+0x11>
+		p++, q++;
+  801c91:	83 c1 01             	add    $0x1,%ecx
+  801c94:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  801c97:	0f b6 01             	movzbl (%ecx),%eax
+  801c9a:	84 c0                	test   %al,%al
+  801c9c:	74 04                	je     801ca2 <strcmp+0x1c>
+  801c9e:	3a 02                	cmp    (%edx),%al
+  801ca0:	74 ef                	je     801c91 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801ca2:	0f b6 c0             	movzbl %al,%eax
+  801ca5:	0f b6 12             	movzbl (%edx),%edx
+  801ca8:	29 d0                	sub    %edx,%eax
+}
+  801caa:	5d                   	pop    %ebp
+  801cab:	c3                   	ret
+
+00801cac <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801cac:	55                   	push   %ebp
+  801cad:	89 e5                	mov    %esp,%ebp
+  801caf:	53                   	push   %ebx
+  801cb0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cb3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801cb6:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  801cb9:	eb 09                	jmp    801cc4 <strncmp+0x18>
+		n--, p++, q++;
+  801cbb:	83 ea 01             	sub    $0x1,%edx
+  801cbe:	83 c0 01             	add    $0x1,%eax
+  801cc1:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  801cc4:	85 d2                	test   %edx,%edx
+  801cc6:	74 18                	je     801ce0 <strncmp+0x34>
+  801cc8:	0f b6 18             	movzbl (%eax),%ebx
+  801ccb:	84 db                	test   %bl,%bl
+  801ccd:	74 04                	je     801cd3 <strncmp+0x27>
+  801ccf:	3a 19                	cmp    (%ecx),%bl
+  801cd1:	74 e8                	je     801cbb <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801cd3:	0f b6 00             	movzbl (%eax),%eax
+  801cd6:	0f b6 11             	movzbl (%ecx),%edx
+  801cd9:	29 d0                	sub    %edx,%eax
+}
+  801cdb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cde:	c9                   	leave
+  801cdf:	c3                   	ret
+		return 0;
+  801ce0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ce5:	eb f4                	jmp    801cdb <strncmp+0x2f>
+
+00801ce7 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801ce7:	55                   	push   %ebp
+  801ce8:	89 e5                	mov    %esp,%ebp
+  801cea:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ced:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801cf1:	eb 03                	jmp    801cf6 <strchr+0xf>
+  801cf3:	83 c0 01             	add    $0x1,%eax
+  801cf6:	0f b6 10             	movzbl (%eax),%edx
+  801cf9:	84 d2                	test   %dl,%dl
+  801cfb:	74 06                	je     801d03 <strchr+0x1c>
+		if (*s == c)
+  801cfd:	38 ca                	cmp    %cl,%dl
+  801cff:	75 f2                	jne    801cf3 <strchr+0xc>
+  801d01:	eb 05                	jmp    801d08 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  801d03:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d08:	5d                   	pop    %ebp
+  801d09:	c3                   	ret
+
+00801d0a <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801d0a:	55                   	push   %ebp
+  801d0b:	89 e5                	mov    %esp,%ebp
+  801d0d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d10:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801d14:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  801d17:	38 ca                	cmp    %cl,%dl
+  801d19:	74 09                	je     801d24 <strfind+0x1a>
+  801d1b:	84 d2                	test   %dl,%dl
+  801d1d:	74 05                	je     801d24 <strfind+0x1a>
+	for (; *s; s++)
+  801d1f:	83 c0 01             	add    $0x1,%eax
+  801d22:	eb f0                	jmp    801d14 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  801d24:	5d                   	pop    %ebp
+  801d25:	c3                   	ret
+
+00801d26 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801d26:	55                   	push   %ebp
+  801d27:	89 e5                	mov    %esp,%ebp
+  801d29:	57                   	push   %edi
+  801d2a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801d2d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  801d30:	85 c9                	test   %ecx,%ecx
+  801d32:	74 20                	je     801d54 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  801d34:	89 f8                	mov    %edi,%eax
+  801d36:	09 c8                	or     %ecx,%eax
+  801d38:	a8 03                	test   $0x3,%al
+  801d3a:	75 12                	jne    801d4e <memset+0x28>
+		c &= 0xFF;
+  801d3c:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  801d40:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  801d46:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  801d49:	fc                   	cld
+  801d4a:	f3 ab                	rep stos %eax,%es:(%edi)
+  801d4c:	eb 06                	jmp    801d54 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801d4e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d51:	fc                   	cld
+  801d52:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  801d54:	89 f8                	mov    %edi,%eax
+  801d56:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  801d59:	c9                   	leave
+  801d5a:	c3                   	ret
+
+00801d5b <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801d5b:	55                   	push   %ebp
+  801d5c:	89 e5                	mov    %esp,%ebp
+  801d5e:	57                   	push   %edi
+  801d5f:	56                   	push   %esi
+  801d60:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d63:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801d66:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  801d69:	39 c6                	cmp    %eax,%esi
+  801d6b:	73 32                	jae    801d9f <memmove+0x44>
+  801d6d:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  801d70:	39 d0                	cmp    %edx,%eax
+  801d72:	73 2b                	jae    801d9f <memmove+0x44>
+		s += n;
+		d += n;
+  801d74:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801d77:	89 d6                	mov    %edx,%esi
+  801d79:	09 fe                	or     %edi,%esi
+  801d7b:	09 ce                	or     %ecx,%esi
+  801d7d:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  801d83:	75 0e                	jne    801d93 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801d85:	83 ef 04             	sub    $0x4,%edi
+  801d88:	8d 72 fc             	lea    -0x4(%edx),%esi
+  801d8b:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  801d8e:	fd                   	std
+  801d8f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801d91:	eb 09                	jmp    801d9c <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801d93:	83 ef 01             	sub    $0x1,%edi
+  801d96:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  801d99:	fd                   	std
+  801d9a:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801d9c:	fc                   	cld
+  801d9d:	eb 1a                	jmp    801db9 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801d9f:	89 f2                	mov    %esi,%edx
+  801da1:	09 c2                	or     %eax,%edx
+  801da3:	09 ca                	or     %ecx,%edx
+  801da5:	f6 c2 03             	test   $0x3,%dl
+  801da8:	75 0a                	jne    801db4 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801daa:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  801dad:	89 c7                	mov    %eax,%edi
+  801daf:	fc                   	cld
+  801db0:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801db2:	eb 05                	jmp    801db9 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  801db4:	89 c7                	mov    %eax,%edi
+  801db6:	fc                   	cld
+  801db7:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  801db9:	5e                   	pop    %esi
+  801dba:	5f                   	pop    %edi
+  801dbb:	5d                   	pop    %ebp
+  801dbc:	c3                   	ret
+
+00801dbd <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801dbd:	55                   	push   %ebp
+  801dbe:	89 e5                	mov    %esp,%ebp
+  801dc0:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  801dc3:	ff 75 10             	push   0x10(%ebp)
+  801dc6:	ff 75 0c             	push   0xc(%ebp)
+  801dc9:	ff 75 08             	push   0x8(%ebp)
+  801dcc:	e8 8a ff ff ff       	call   801d5b <memmove>
+}
+  801dd1:	c9                   	leave
+  801dd2:	c3                   	ret
+
+00801dd3 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801dd3:	55                   	push   %ebp
+  801dd4:	89 e5                	mov    %esp,%ebp
+  801dd6:	56                   	push   %esi
+  801dd7:	53                   	push   %ebx
+  801dd8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ddb:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  801dde:	89 c6                	mov    %eax,%esi
+  801de0:	03 75 10             	add    0x10(%ebp),%esi
+  801de3:	eb 06                	jmp    801deb <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  801de5:	83 c0 01             	add    $0x1,%eax
+  801de8:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  801deb:	39 f0                	cmp    %esi,%eax
+  801ded:	74 14                	je     801e03 <memcmp+0x30>
+		if (*s1 != *s2)
+  801def:	0f b6 08             	movzbl (%eax),%ecx
+  801df2:	0f b6 1a             	movzbl (%edx),%ebx
+  801df5:	38 d9                	cmp    %bl,%cl
+  801df7:	74 ec                	je     801de5 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  801df9:	0f b6 c1             	movzbl %cl,%eax
+  801dfc:	0f b6 db             	movzbl %bl,%ebx
+  801dff:	29 d8                	sub    %ebx,%eax
+  801e01:	eb 05                	jmp    801e08 <memcmp+0x35>
+	}
+
+	return 0;
+  801e03:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e08:	5b                   	pop    %ebx
+  801e09:	5e                   	pop    %esi
+  801e0a:	5d                   	pop    %ebp
+  801e0b:	c3                   	ret
+
+00801e0c <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801e0c:	55                   	push   %ebp
+  801e0d:	89 e5                	mov    %esp,%ebp
+  801e0f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e12:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  801e15:	89 c2                	mov    %eax,%edx
+  801e17:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  801e1a:	eb 03                	jmp    801e1f <memfind+0x13>
+  801e1c:	83 c0 01             	add    $0x1,%eax
+  801e1f:	39 d0                	cmp    %edx,%eax
+  801e21:	73 04                	jae    801e27 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801e23:	38 08                	cmp    %cl,(%eax)
+  801e25:	75 f5                	jne    801e1c <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  801e27:	5d                   	pop    %ebp
+  801e28:	c3                   	ret
+
+00801e29 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  801e29:	55                   	push   %ebp
+  801e2a:	89 e5                	mov    %esp,%ebp
+  801e2c:	57                   	push   %edi
+  801e2d:	56                   	push   %esi
+  801e2e:	53                   	push   %ebx
+  801e2f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e32:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801e35:	eb 03                	jmp    801e3a <strtol+0x11>
+		s++;
+  801e37:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  801e3a:	0f b6 02             	movzbl (%edx),%eax
+  801e3d:	3c 20                	cmp    $0x20,%al
+  801e3f:	74 f6                	je     801e37 <strtol+0xe>
+  801e41:	3c 09                	cmp    $0x9,%al
+  801e43:	74 f2                	je     801e37 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  801e45:	3c 2b                	cmp    $0x2b,%al
+  801e47:	74 2a                	je     801e73 <strtol+0x4a>
+	int neg = 0;
+  801e49:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  801e4e:	3c 2d                	cmp    $0x2d,%al
+  801e50:	74 2b                	je     801e7d <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801e52:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  801e58:	75 0f                	jne    801e69 <strtol+0x40>
+  801e5a:	80 3a 30             	cmpb   $0x30,(%edx)
+  801e5d:	74 28                	je     801e87 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  801e5f:	85 db                	test   %ebx,%ebx
+  801e61:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801e66:	0f 44 d8             	cmove  %eax,%ebx
+  801e69:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e6e:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  801e71:	eb 46                	jmp    801eb9 <strtol+0x90>
+		s++;
+  801e73:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  801e76:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e7b:	eb d5                	jmp    801e52 <strtol+0x29>
+		s++, neg = 1;
+  801e7d:	83 c2 01             	add    $0x1,%edx
+  801e80:	bf 01 00 00 00       	mov    $0x1,%edi
+  801e85:	eb cb                	jmp    801e52 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801e87:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  801e8b:	74 0e                	je     801e9b <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  801e8d:	85 db                	test   %ebx,%ebx
+  801e8f:	75 d8                	jne    801e69 <strtol+0x40>
+		s++, base = 8;
+  801e91:	83 c2 01             	add    $0x1,%edx
+  801e94:	bb 08 00 00 00       	mov    $0x8,%ebx
+  801e99:	eb ce                	jmp    801e69 <strtol+0x40>
+		s += 2, base = 16;
+  801e9b:	83 c2 02             	add    $0x2,%edx
+  801e9e:	bb 10 00 00 00       	mov    $0x10,%ebx
+  801ea3:	eb c4                	jmp    801e69 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  801ea5:	0f be c0             	movsbl %al,%eax
+  801ea8:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  801eab:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801eae:	7d 3a                	jge    801eea <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  801eb0:	83 c2 01             	add    $0x1,%edx
+  801eb3:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  801eb7:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  801eb9:	0f b6 02             	movzbl (%edx),%eax
+  801ebc:	8d 70 d0             	lea    -0x30(%eax),%esi
+  801ebf:	89 f3                	mov    %esi,%ebx
+  801ec1:	80 fb 09             	cmp    $0x9,%bl
+  801ec4:	76 df                	jbe    801ea5 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  801ec6:	8d 70 9f             	lea    -0x61(%eax),%esi
+  801ec9:	89 f3                	mov    %esi,%ebx
+  801ecb:	80 fb 19             	cmp    $0x19,%bl
+  801ece:	77 08                	ja     801ed8 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  801ed0:	0f be c0             	movsbl %al,%eax
+  801ed3:	83 e8 57             	sub    $0x57,%eax
+  801ed6:	eb d3                	jmp    801eab <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  801ed8:	8d 70 bf             	lea    -0x41(%eax),%esi
+  801edb:	89 f3                	mov    %esi,%ebx
+  801edd:	80 fb 19             	cmp    $0x19,%bl
+  801ee0:	77 08                	ja     801eea <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  801ee2:	0f be c0             	movsbl %al,%eax
+  801ee5:	83 e8 37             	sub    $0x37,%eax
+  801ee8:	eb c1                	jmp    801eab <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801eea:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  801eee:	74 05                	je     801ef5 <strtol+0xcc>
+		*endptr = (char *) s;
+  801ef0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ef3:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  801ef5:	89 c8                	mov    %ecx,%eax
+  801ef7:	f7 d8                	neg    %eax
+  801ef9:	85 ff                	test   %edi,%edi
+  801efb:	0f 45 c8             	cmovne %eax,%ecx
+}
+  801efe:	89 c8                	mov    %ecx,%eax
+  801f00:	5b                   	pop    %ebx
+  801f01:	5e                   	pop    %esi
+  801f02:	5f                   	pop    %edi
+  801f03:	5d                   	pop    %ebp
+  801f04:	c3                   	ret
+
+00801f05 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  801f05:	55                   	push   %ebp
+  801f06:	89 e5                	mov    %esp,%ebp
+  801f08:	56                   	push   %esi
+  801f09:	53                   	push   %ebx
+  801f0a:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f0d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f10:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  801f13:	85 c0                	test   %eax,%eax
+  801f15:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801f1a:	0f 44 c2             	cmove  %edx,%eax
+  801f1d:	83 ec 0c             	sub    $0xc,%esp
+  801f20:	50                   	push   %eax
+  801f21:	e8 e7 e3 ff ff       	call   80030d <sys_ipc_recv>
+
+  if (from_env_store)
+  801f26:	83 c4 10             	add    $0x10,%esp
+  801f29:	85 f6                	test   %esi,%esi
+  801f2b:	74 17                	je     801f44 <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  801f2d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f32:	85 c0                	test   %eax,%eax
+  801f34:	75 0c                	jne    801f42 <ipc_recv+0x3d>
+  801f36:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801f3c:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  801f42:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  801f44:	85 db                	test   %ebx,%ebx
+  801f46:	74 2b                	je     801f73 <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  801f48:	85 c0                	test   %eax,%eax
+  801f4a:	74 0d                	je     801f59 <ipc_recv+0x54>
+  801f4c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  801f52:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f55:	5b                   	pop    %ebx
+  801f56:	5e                   	pop    %esi
+  801f57:	5d                   	pop    %ebp
+  801f58:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  801f59:	a1 08 40 80 00       	mov    0x804008,%eax
+  801f5e:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  801f64:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  801f66:	a1 08 40 80 00       	mov    0x804008,%eax
+  801f6b:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  801f71:	eb df                	jmp    801f52 <ipc_recv+0x4d>
+  801f73:	85 c0                	test   %eax,%eax
+  801f75:	75 db                	jne    801f52 <ipc_recv+0x4d>
+  801f77:	eb ed                	jmp    801f66 <ipc_recv+0x61>
+
+00801f79 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  801f79:	55                   	push   %ebp
+  801f7a:	89 e5                	mov    %esp,%ebp
+  801f7c:	57                   	push   %edi
+  801f7d:	56                   	push   %esi
+  801f7e:	53                   	push   %ebx
+  801f7f:	83 ec 0c             	sub    $0xc,%esp
+  801f82:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801f85:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801f88:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  801f8b:	85 db                	test   %ebx,%ebx
+  801f8d:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801f92:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  801f95:	ff 75 14             	push   0x14(%ebp)
+  801f98:	53                   	push   %ebx
+  801f99:	56                   	push   %esi
+  801f9a:	57                   	push   %edi
+  801f9b:	e8 4a e3 ff ff       	call   8002ea <sys_ipc_try_send>
+  801fa0:	83 c4 10             	add    $0x10,%esp
+  801fa3:	85 c0                	test   %eax,%eax
+  801fa5:	74 1e                	je     801fc5 <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  801fa7:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801faa:	75 07                	jne    801fb3 <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  801fac:	e8 8d e1 ff ff       	call   80013e <sys_yield>
+  801fb1:	eb e2                	jmp    801f95 <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  801fb3:	50                   	push   %eax
+  801fb4:	68 83 29 80 00       	push   $0x802983
+  801fb9:	6a 3c                	push   $0x3c
+  801fbb:	68 90 29 80 00       	push   $0x802990
+  801fc0:	e8 7c f5 ff ff       	call   801541 <_panic>
+  }
+
+#endif
+}
+  801fc5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fc8:	5b                   	pop    %ebx
+  801fc9:	5e                   	pop    %esi
+  801fca:	5f                   	pop    %edi
+  801fcb:	5d                   	pop    %ebp
+  801fcc:	c3                   	ret
+
+00801fcd <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  801fcd:	55                   	push   %ebp
+  801fce:	89 e5                	mov    %esp,%ebp
+  801fd0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  801fd3:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  801fd8:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  801fdb:	c1 e0 04             	shl    $0x4,%eax
+  801fde:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801fe3:	8b 40 50             	mov    0x50(%eax),%eax
+  801fe6:	39 c8                	cmp    %ecx,%eax
+  801fe8:	74 12                	je     801ffc <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  801fea:	83 c2 01             	add    $0x1,%edx
+  801fed:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  801ff3:	75 e3                	jne    801fd8 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  801ff5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ffa:	eb 0e                	jmp    80200a <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  801ffc:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  801fff:	c1 e0 04             	shl    $0x4,%eax
+  802002:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802007:	8b 40 48             	mov    0x48(%eax),%eax
+  80200a:	5d                   	pop    %ebp
+  80200b:	c3                   	ret
+
+0080200c <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80200c:	55                   	push   %ebp
+  80200d:	89 e5                	mov    %esp,%ebp
+  80200f:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802012:	89 c2                	mov    %eax,%edx
+  802014:	c1 ea 16             	shr    $0x16,%edx
+  802017:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80201e:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802023:	f6 c1 01             	test   $0x1,%cl
+  802026:	74 1c                	je     802044 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  802028:	c1 e8 0c             	shr    $0xc,%eax
+  80202b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802032:	a8 01                	test   $0x1,%al
+  802034:	74 0e                	je     802044 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802036:	c1 e8 0c             	shr    $0xc,%eax
+  802039:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802040:	ef 
+  802041:	0f b7 d2             	movzwl %dx,%edx
+}
+  802044:	89 d0                	mov    %edx,%eax
+  802046:	5d                   	pop    %ebp
+  802047:	c3                   	ret
+  802048:	66 90                	xchg   %ax,%ax
+  80204a:	66 90                	xchg   %ax,%ax
+  80204c:	66 90                	xchg   %ax,%ax
+  80204e:	66 90                	xchg   %ax,%ax
+
+00802050 <__udivmoddi4>:
+  802050:	55                   	push   %ebp
+  802051:	57                   	push   %edi
+  802052:	56                   	push   %esi
+  802053:	53                   	push   %ebx
+  802054:	83 ec 24             	sub    $0x24,%esp
+  802057:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80205b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80205f:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  802063:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802067:	8b 54 24 44          	mov    0x44(%esp),%edx
+  80206b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80206f:	8b 44 24 40          	mov    0x40(%esp),%eax
+  802073:	89 d3                	mov    %edx,%ebx
+  802075:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802079:	09 c3                	or     %eax,%ebx
+  80207b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80207f:	0f 84 9c 00 00 00    	je     802121 <__udivmoddi4+0xd1>
+  802085:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80208c:	00 
+  80208d:	31 c0                	xor    %eax,%eax
+  80208f:	31 d2                	xor    %edx,%edx
+  802091:	89 fb                	mov    %edi,%ebx
+  802093:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80209a:	00 
+  80209b:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8020a0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8020a4:	01 c0                	add    %eax,%eax
+  8020a6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8020ad:	00 
+  8020ae:	89 c6                	mov    %eax,%esi
+  8020b0:	89 d7                	mov    %edx,%edi
+  8020b2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8020b6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8020ba:	0f ad d0             	shrd   %cl,%edx,%eax
+  8020bd:	d3 ea                	shr    %cl,%edx
+  8020bf:	f6 c1 20             	test   $0x20,%cl
+  8020c2:	0f 45 c2             	cmovne %edx,%eax
+  8020c5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8020c9:	83 e0 01             	and    $0x1,%eax
+  8020cc:	09 fa                	or     %edi,%edx
+  8020ce:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8020d2:	89 04 24             	mov    %eax,(%esp)
+  8020d5:	8b 04 24             	mov    (%esp),%eax
+  8020d8:	89 d5                	mov    %edx,%ebp
+  8020da:	09 f0                	or     %esi,%eax
+  8020dc:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8020e0:	39 f0                	cmp    %esi,%eax
+  8020e2:	19 fd                	sbb    %edi,%ebp
+  8020e4:	72 1d                	jb     802103 <__udivmoddi4+0xb3>
+  8020e6:	29 f0                	sub    %esi,%eax
+  8020e8:	19 fa                	sbb    %edi,%edx
+  8020ea:	89 cf                	mov    %ecx,%edi
+  8020ec:	c1 ef 05             	shr    $0x5,%edi
+  8020ef:	83 e7 01             	and    $0x1,%edi
+  8020f2:	89 fe                	mov    %edi,%esi
+  8020f4:	d3 e7                	shl    %cl,%edi
+  8020f6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8020fa:	83 f6 01             	xor    $0x1,%esi
+  8020fd:	d3 e6                	shl    %cl,%esi
+  8020ff:	09 74 24 18          	or     %esi,0x18(%esp)
+  802103:	83 e9 01             	sub    $0x1,%ecx
+  802106:	73 98                	jae    8020a0 <__udivmoddi4+0x50>
+  802108:	85 db                	test   %ebx,%ebx
+  80210a:	74 05                	je     802111 <__udivmoddi4+0xc1>
+  80210c:	89 03                	mov    %eax,(%ebx)
+  80210e:	89 53 04             	mov    %edx,0x4(%ebx)
+  802111:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802115:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802119:	83 c4 24             	add    $0x24,%esp
+  80211c:	5b                   	pop    %ebx
+  80211d:	5e                   	pop    %esi
+  80211e:	5f                   	pop    %edi
+  80211f:	5d                   	pop    %ebp
+  802120:	c3                   	ret
+  802121:	85 ff                	test   %edi,%edi
+  802123:	74 0d                	je     802132 <__udivmoddi4+0xe2>
+  802125:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  80212b:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  802132:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802136:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80213a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80213e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802142:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802146:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80214a:	83 c4 24             	add    $0x24,%esp
+  80214d:	5b                   	pop    %ebx
+  80214e:	5e                   	pop    %esi
+  80214f:	5f                   	pop    %edi
+  802150:	5d                   	pop    %ebp
+  802151:	c3                   	ret
+  802152:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802159:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00802160 <__udivdi3>:
+  802160:	57                   	push   %edi
+  802161:	56                   	push   %esi
+  802162:	53                   	push   %ebx
+  802163:	83 ec 20             	sub    $0x20,%esp
+  802166:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80216a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80216e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802172:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802176:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80217a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80217e:	89 d1                	mov    %edx,%ecx
+  802180:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802184:	09 c1                	or     %eax,%ecx
+  802186:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80218a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80218e:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802192:	0f 84 88 00 00 00    	je     802220 <__udivdi3+0xc0>
+  802198:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80219f:	00 
+  8021a0:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8021a5:	31 c0                	xor    %eax,%eax
+  8021a7:	31 d2                	xor    %edx,%edx
+  8021a9:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8021b0:	00 
+  8021b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8021b8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8021bc:	01 c0                	add    %eax,%eax
+  8021be:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8021c5:	00 
+  8021c6:	89 c6                	mov    %eax,%esi
+  8021c8:	89 d7                	mov    %edx,%edi
+  8021ca:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8021ce:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8021d2:	0f ad d0             	shrd   %cl,%edx,%eax
+  8021d5:	d3 ea                	shr    %cl,%edx
+  8021d7:	f6 c1 20             	test   $0x20,%cl
+  8021da:	0f 45 c2             	cmovne %edx,%eax
+  8021dd:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8021e1:	83 e0 01             	and    $0x1,%eax
+  8021e4:	09 fa                	or     %edi,%edx
+  8021e6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8021ea:	89 04 24             	mov    %eax,(%esp)
+  8021ed:	8b 04 24             	mov    (%esp),%eax
+  8021f0:	89 d3                	mov    %edx,%ebx
+  8021f2:	09 f0                	or     %esi,%eax
+  8021f4:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8021f8:	39 f0                	cmp    %esi,%eax
+  8021fa:	19 fb                	sbb    %edi,%ebx
+  8021fc:	72 1d                	jb     80221b <__udivdi3+0xbb>
+  8021fe:	29 f0                	sub    %esi,%eax
+  802200:	19 fa                	sbb    %edi,%edx
+  802202:	89 cf                	mov    %ecx,%edi
+  802204:	c1 ef 05             	shr    $0x5,%edi
+  802207:	83 e7 01             	and    $0x1,%edi
+  80220a:	89 fe                	mov    %edi,%esi
+  80220c:	d3 e7                	shl    %cl,%edi
+  80220e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802212:	83 f6 01             	xor    $0x1,%esi
+  802215:	d3 e6                	shl    %cl,%esi
+  802217:	09 74 24 18          	or     %esi,0x18(%esp)
+  80221b:	83 e9 01             	sub    $0x1,%ecx
+  80221e:	73 98                	jae    8021b8 <__udivdi3+0x58>
+  802220:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802224:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802228:	83 c4 20             	add    $0x20,%esp
+  80222b:	5b                   	pop    %ebx
+  80222c:	5e                   	pop    %esi
+  80222d:	5f                   	pop    %edi
+  80222e:	c3                   	ret
+  80222f:	90                   	nop
+
+00802230 <__umoddi3>:
+  802230:	57                   	push   %edi
+  802231:	56                   	push   %esi
+  802232:	53                   	push   %ebx
+  802233:	83 ec 18             	sub    $0x18,%esp
+  802236:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80223a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80223e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802242:	8b 54 24 34          	mov    0x34(%esp),%edx
+  802246:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80224a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80224e:	89 d1                	mov    %edx,%ecx
+  802250:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802254:	09 c1                	or     %eax,%ecx
+  802256:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80225a:	74 5b                	je     8022b7 <__umoddi3+0x87>
+  80225c:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802261:	31 c0                	xor    %eax,%eax
+  802263:	31 d2                	xor    %edx,%edx
+  802265:	8d 76 00             	lea    0x0(%esi),%esi
+  802268:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80226c:	01 c0                	add    %eax,%eax
+  80226e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802275:	00 
+  802276:	89 c6                	mov    %eax,%esi
+  802278:	89 d7                	mov    %edx,%edi
+  80227a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80227e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802282:	0f ad d0             	shrd   %cl,%edx,%eax
+  802285:	d3 ea                	shr    %cl,%edx
+  802287:	f6 c1 20             	test   $0x20,%cl
+  80228a:	0f 45 c2             	cmovne %edx,%eax
+  80228d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802291:	83 e0 01             	and    $0x1,%eax
+  802294:	09 fa                	or     %edi,%edx
+  802296:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80229a:	89 04 24             	mov    %eax,(%esp)
+  80229d:	8b 04 24             	mov    (%esp),%eax
+  8022a0:	89 d3                	mov    %edx,%ebx
+  8022a2:	09 f0                	or     %esi,%eax
+  8022a4:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8022a8:	39 f0                	cmp    %esi,%eax
+  8022aa:	19 fb                	sbb    %edi,%ebx
+  8022ac:	72 04                	jb     8022b2 <__umoddi3+0x82>
+  8022ae:	29 f0                	sub    %esi,%eax
+  8022b0:	19 fa                	sbb    %edi,%edx
+  8022b2:	83 e9 01             	sub    $0x1,%ecx
+  8022b5:	73 b1                	jae    802268 <__umoddi3+0x38>
+  8022b7:	83 c4 18             	add    $0x18,%esp
+  8022ba:	5b                   	pop    %ebx
+  8022bb:	5e                   	pop    %esi
+  8022bc:	5f                   	pop    %edi
+  8022bd:	c3                   	ret
+  8022be:	66 90                	xchg   %ax,%ax
+
+008022c0 <__divdi3>:
+  8022c0:	55                   	push   %ebp
+  8022c1:	57                   	push   %edi
+  8022c2:	56                   	push   %esi
+  8022c3:	53                   	push   %ebx
+  8022c4:	83 ec 24             	sub    $0x24,%esp
+  8022c7:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  8022cb:	8b 74 24 44          	mov    0x44(%esp),%esi
+  8022cf:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8022d3:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8022d7:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  8022db:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8022df:	85 d2                	test   %edx,%edx
+  8022e1:	0f 88 e0 00 00 00    	js     8023c7 <__divdi3+0x107>
+  8022e7:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  8022eb:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  8022ef:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8022f3:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8022f7:	85 f6                	test   %esi,%esi
+  8022f9:	78 16                	js     802311 <__divdi3+0x51>
+  8022fb:	89 f1                	mov    %esi,%ecx
+  8022fd:	31 c0                	xor    %eax,%eax
+  8022ff:	31 d2                	xor    %edx,%edx
+  802301:	09 d9                	or     %ebx,%ecx
+  802303:	0f 85 f3 00 00 00    	jne    8023fc <__divdi3+0x13c>
+  802309:	83 c4 24             	add    $0x24,%esp
+  80230c:	5b                   	pop    %ebx
+  80230d:	5e                   	pop    %esi
+  80230e:	5f                   	pop    %edi
+  80230f:	5d                   	pop    %ebp
+  802310:	c3                   	ret
+  802311:	bf 01 00 00 00       	mov    $0x1,%edi
+  802316:	f7 5c 24 08          	negl   0x8(%esp)
+  80231a:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  80231f:	f7 5c 24 0c          	negl   0xc(%esp)
+  802323:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80232a:	00 
+  80232b:	31 c0                	xor    %eax,%eax
+  80232d:	31 d2                	xor    %edx,%edx
+  80232f:	89 fb                	mov    %edi,%ebx
+  802331:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802338:	00 
+  802339:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80233e:	66 90                	xchg   %ax,%ax
+  802340:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802344:	01 c0                	add    %eax,%eax
+  802346:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80234d:	00 
+  80234e:	89 c6                	mov    %eax,%esi
+  802350:	89 d7                	mov    %edx,%edi
+  802352:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802356:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80235a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80235d:	d3 ea                	shr    %cl,%edx
+  80235f:	f6 c1 20             	test   $0x20,%cl
+  802362:	0f 45 c2             	cmovne %edx,%eax
+  802365:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802369:	83 e0 01             	and    $0x1,%eax
+  80236c:	09 fa                	or     %edi,%edx
+  80236e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802372:	89 04 24             	mov    %eax,(%esp)
+  802375:	8b 04 24             	mov    (%esp),%eax
+  802378:	89 d5                	mov    %edx,%ebp
+  80237a:	09 f0                	or     %esi,%eax
+  80237c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802380:	39 f0                	cmp    %esi,%eax
+  802382:	19 fd                	sbb    %edi,%ebp
+  802384:	72 1d                	jb     8023a3 <__divdi3+0xe3>
+  802386:	29 f0                	sub    %esi,%eax
+  802388:	19 fa                	sbb    %edi,%edx
+  80238a:	89 cf                	mov    %ecx,%edi
+  80238c:	c1 ef 05             	shr    $0x5,%edi
+  80238f:	83 e7 01             	and    $0x1,%edi
+  802392:	89 fe                	mov    %edi,%esi
+  802394:	d3 e7                	shl    %cl,%edi
+  802396:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80239a:	83 f6 01             	xor    $0x1,%esi
+  80239d:	d3 e6                	shl    %cl,%esi
+  80239f:	09 74 24 18          	or     %esi,0x18(%esp)
+  8023a3:	83 e9 01             	sub    $0x1,%ecx
+  8023a6:	73 98                	jae    802340 <__divdi3+0x80>
+  8023a8:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8023ac:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8023b0:	85 db                	test   %ebx,%ebx
+  8023b2:	0f 84 51 ff ff ff    	je     802309 <__divdi3+0x49>
+  8023b8:	f7 d8                	neg    %eax
+  8023ba:	83 d2 00             	adc    $0x0,%edx
+  8023bd:	83 c4 24             	add    $0x24,%esp
+  8023c0:	5b                   	pop    %ebx
+  8023c1:	f7 da                	neg    %edx
+  8023c3:	5e                   	pop    %esi
+  8023c4:	5f                   	pop    %edi
+  8023c5:	5d                   	pop    %ebp
+  8023c6:	c3                   	ret
+  8023c7:	f7 d8                	neg    %eax
+  8023c9:	83 d2 00             	adc    $0x0,%edx
+  8023cc:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8023d0:	f7 da                	neg    %edx
+  8023d2:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8023d6:	85 f6                	test   %esi,%esi
+  8023d8:	78 1b                	js     8023f5 <__divdi3+0x135>
+  8023da:	89 f1                	mov    %esi,%ecx
+  8023dc:	31 c0                	xor    %eax,%eax
+  8023de:	31 d2                	xor    %edx,%edx
+  8023e0:	bf 01 00 00 00       	mov    $0x1,%edi
+  8023e5:	09 d9                	or     %ebx,%ecx
+  8023e7:	0f 85 36 ff ff ff    	jne    802323 <__divdi3+0x63>
+  8023ed:	83 c4 24             	add    $0x24,%esp
+  8023f0:	5b                   	pop    %ebx
+  8023f1:	5e                   	pop    %esi
+  8023f2:	5f                   	pop    %edi
+  8023f3:	5d                   	pop    %ebp
+  8023f4:	c3                   	ret
+  8023f5:	31 ff                	xor    %edi,%edi
+  8023f7:	e9 1a ff ff ff       	jmp    802316 <__divdi3+0x56>
+  8023fc:	31 ff                	xor    %edi,%edi
+  8023fe:	e9 20 ff ff ff       	jmp    802323 <__divdi3+0x63>
+  802403:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80240a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00802410 <__moddi3>:
+  802410:	55                   	push   %ebp
+  802411:	57                   	push   %edi
+  802412:	56                   	push   %esi
+  802413:	53                   	push   %ebx
+  802414:	83 ec 1c             	sub    $0x1c,%esp
+  802417:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  80241b:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  80241f:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  802423:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  802427:	89 c8                	mov    %ecx,%eax
+  802429:	89 f2                	mov    %esi,%edx
+  80242b:	89 f3                	mov    %esi,%ebx
+  80242d:	85 ed                	test   %ebp,%ebp
+  80242f:	0f 88 9d 00 00 00    	js     8024d2 <__moddi3+0xc2>
+  802435:	09 cb                	or     %ecx,%ebx
+  802437:	0f 84 8d 00 00 00    	je     8024ca <__moddi3+0xba>
+  80243d:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802441:	31 db                	xor    %ebx,%ebx
+  802443:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802447:	89 ca                	mov    %ecx,%edx
+  802449:	89 f0                	mov    %esi,%eax
+  80244b:	89 dd                	mov    %ebx,%ebp
+  80244d:	f7 da                	neg    %edx
+  80244f:	83 d0 00             	adc    $0x0,%eax
+  802452:	f7 d8                	neg    %eax
+  802454:	0f 49 f0             	cmovns %eax,%esi
+  802457:	0f 49 ca             	cmovns %edx,%ecx
+  80245a:	31 c0                	xor    %eax,%eax
+  80245c:	31 d2                	xor    %edx,%edx
+  80245e:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802462:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802466:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80246b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80246f:	90                   	nop
+  802470:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802474:	01 c0                	add    %eax,%eax
+  802476:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80247d:	00 
+  80247e:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  802482:	89 c6                	mov    %eax,%esi
+  802484:	89 d7                	mov    %edx,%edi
+  802486:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80248a:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80248e:	0f ad d0             	shrd   %cl,%edx,%eax
+  802491:	d3 ea                	shr    %cl,%edx
+  802493:	f6 c1 20             	test   $0x20,%cl
+  802496:	0f 45 c2             	cmovne %edx,%eax
+  802499:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80249d:	83 e0 01             	and    $0x1,%eax
+  8024a0:	09 fa                	or     %edi,%edx
+  8024a2:	89 04 24             	mov    %eax,(%esp)
+  8024a5:	8b 04 24             	mov    (%esp),%eax
+  8024a8:	89 d7                	mov    %edx,%edi
+  8024aa:	09 f0                	or     %esi,%eax
+  8024ac:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  8024b0:	39 d8                	cmp    %ebx,%eax
+  8024b2:	19 f7                	sbb    %esi,%edi
+  8024b4:	72 04                	jb     8024ba <__moddi3+0xaa>
+  8024b6:	29 d8                	sub    %ebx,%eax
+  8024b8:	19 f2                	sbb    %esi,%edx
+  8024ba:	83 e9 01             	sub    $0x1,%ecx
+  8024bd:	73 b1                	jae    802470 <__moddi3+0x60>
+  8024bf:	85 ed                	test   %ebp,%ebp
+  8024c1:	74 07                	je     8024ca <__moddi3+0xba>
+  8024c3:	f7 d8                	neg    %eax
+  8024c5:	83 d2 00             	adc    $0x0,%edx
+  8024c8:	f7 da                	neg    %edx
+  8024ca:	83 c4 1c             	add    $0x1c,%esp
+  8024cd:	5b                   	pop    %ebx
+  8024ce:	5e                   	pop    %esi
+  8024cf:	5f                   	pop    %edi
+  8024d0:	5d                   	pop    %ebp
+  8024d1:	c3                   	ret
+  8024d2:	09 cb                	or     %ecx,%ebx
+  8024d4:	74 f4                	je     8024ca <__moddi3+0xba>
+  8024d6:	f7 df                	neg    %edi
+  8024d8:	bb 01 00 00 00       	mov    $0x1,%ebx
+  8024dd:	83 d5 00             	adc    $0x0,%ebp
+  8024e0:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  8024e4:	f7 dd                	neg    %ebp
+  8024e6:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  8024ea:	e9 58 ff ff ff       	jmp    802447 <__moddi3+0x37>
@@ -0,0 +1,5793 @@
+
+obj/user/forktree.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 b2 00 00 00       	call   8000e3 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <forktree>:
+	}
+}
+
+void
+forktree(const char *cur)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 04             	sub    $0x4,%esp
+  80003a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("%04x: I am '%s'\n", sys_getenvid(), cur);
+  80003d:	e8 00 0b 00 00       	call   800b42 <sys_getenvid>
+  800042:	83 ec 04             	sub    $0x4,%esp
+  800045:	53                   	push   %ebx
+  800046:	50                   	push   %eax
+  800047:	68 40 29 80 00       	push   $0x802940
+  80004c:	e8 8a 01 00 00       	call   8001db <cprintf>
+
+	forkchild(cur, '0');
+  800051:	83 c4 08             	add    $0x8,%esp
+  800054:	6a 30                	push   $0x30
+  800056:	53                   	push   %ebx
+  800057:	e8 13 00 00 00       	call   80006f <forkchild>
+	forkchild(cur, '1');
+  80005c:	83 c4 08             	add    $0x8,%esp
+  80005f:	6a 31                	push   $0x31
+  800061:	53                   	push   %ebx
+  800062:	e8 08 00 00 00       	call   80006f <forkchild>
+}
+  800067:	83 c4 10             	add    $0x10,%esp
+  80006a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80006d:	c9                   	leave
+  80006e:	c3                   	ret
+
+0080006f <forkchild>:
+{
+  80006f:	55                   	push   %ebp
+  800070:	89 e5                	mov    %esp,%ebp
+  800072:	56                   	push   %esi
+  800073:	53                   	push   %ebx
+  800074:	83 ec 1c             	sub    $0x1c,%esp
+  800077:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80007a:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if (strlen(cur) >= DEPTH)
+  80007d:	53                   	push   %ebx
+  80007e:	e8 d6 06 00 00       	call   800759 <strlen>
+  800083:	83 c4 10             	add    $0x10,%esp
+  800086:	83 f8 02             	cmp    $0x2,%eax
+  800089:	7e 07                	jle    800092 <forkchild+0x23>
+}
+  80008b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80008e:	5b                   	pop    %ebx
+  80008f:	5e                   	pop    %esi
+  800090:	5d                   	pop    %ebp
+  800091:	c3                   	ret
+	snprintf(nxt, DEPTH+1, "%s%c", cur, branch);
+  800092:	83 ec 0c             	sub    $0xc,%esp
+  800095:	89 f0                	mov    %esi,%eax
+  800097:	0f be f0             	movsbl %al,%esi
+  80009a:	56                   	push   %esi
+  80009b:	53                   	push   %ebx
+  80009c:	68 51 29 80 00       	push   $0x802951
+  8000a1:	6a 04                	push   $0x4
+  8000a3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8000a6:	50                   	push   %eax
+  8000a7:	e8 93 06 00 00       	call   80073f <snprintf>
+	if (fork() == 0) {
+  8000ac:	83 c4 20             	add    $0x20,%esp
+  8000af:	e8 9a 0e 00 00       	call   800f4e <fork>
+  8000b4:	85 c0                	test   %eax,%eax
+  8000b6:	75 d3                	jne    80008b <forkchild+0x1c>
+		forktree(nxt);
+  8000b8:	83 ec 0c             	sub    $0xc,%esp
+  8000bb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8000be:	50                   	push   %eax
+  8000bf:	e8 6f ff ff ff       	call   800033 <forktree>
+		exit();
+  8000c4:	e8 63 00 00 00       	call   80012c <exit>
+  8000c9:	83 c4 10             	add    $0x10,%esp
+  8000cc:	eb bd                	jmp    80008b <forkchild+0x1c>
+
+008000ce <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8000ce:	55                   	push   %ebp
+  8000cf:	89 e5                	mov    %esp,%ebp
+  8000d1:	83 ec 14             	sub    $0x14,%esp
+	forktree("");
+  8000d4:	68 50 29 80 00       	push   $0x802950
+  8000d9:	e8 55 ff ff ff       	call   800033 <forktree>
+}
+  8000de:	83 c4 10             	add    $0x10,%esp
+  8000e1:	c9                   	leave
+  8000e2:	c3                   	ret
+
+008000e3 <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  8000e3:	55                   	push   %ebp
+  8000e4:	89 e5                	mov    %esp,%ebp
+  8000e6:	56                   	push   %esi
+  8000e7:	53                   	push   %ebx
+  8000e8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000eb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  8000ee:	e8 4f 0a 00 00       	call   800b42 <sys_getenvid>
+  8000f3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000f8:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8000fb:	c1 e0 04             	shl    $0x4,%eax
+  8000fe:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800103:	a3 08 40 80 00       	mov    %eax,0x804008
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800108:	85 db                	test   %ebx,%ebx
+  80010a:	7e 07                	jle    800113 <libmain+0x30>
+    binaryname = argv[0];
+  80010c:	8b 06                	mov    (%esi),%eax
+  80010e:	a3 00 30 80 00       	mov    %eax,0x803000
+
+  // call user main routine
+  umain(argc, argv);
+  800113:	83 ec 08             	sub    $0x8,%esp
+  800116:	56                   	push   %esi
+  800117:	53                   	push   %ebx
+  800118:	e8 b1 ff ff ff       	call   8000ce <umain>
+
+  // exit gracefully
+  exit();
+  80011d:	e8 0a 00 00 00       	call   80012c <exit>
+}
+  800122:	83 c4 10             	add    $0x10,%esp
+  800125:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800128:	5b                   	pop    %ebx
+  800129:	5e                   	pop    %esi
+  80012a:	5d                   	pop    %ebp
+  80012b:	c3                   	ret
+
+0080012c <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80012c:	55                   	push   %ebp
+  80012d:	89 e5                	mov    %esp,%ebp
+  80012f:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800132:	e8 07 12 00 00       	call   80133e <close_all>
+	sys_env_destroy(0);
+  800137:	83 ec 0c             	sub    $0xc,%esp
+  80013a:	6a 00                	push   $0x0
+  80013c:	e8 c0 09 00 00       	call   800b01 <sys_env_destroy>
+}
+  800141:	83 c4 10             	add    $0x10,%esp
+  800144:	c9                   	leave
+  800145:	c3                   	ret
+
+00800146 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800146:	55                   	push   %ebp
+  800147:	89 e5                	mov    %esp,%ebp
+  800149:	53                   	push   %ebx
+  80014a:	83 ec 04             	sub    $0x4,%esp
+  80014d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800150:	8b 13                	mov    (%ebx),%edx
+  800152:	8d 42 01             	lea    0x1(%edx),%eax
+  800155:	89 03                	mov    %eax,(%ebx)
+  800157:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80015a:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80015e:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800163:	74 09                	je     80016e <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800165:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800169:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80016c:	c9                   	leave
+  80016d:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80016e:	83 ec 08             	sub    $0x8,%esp
+  800171:	68 ff 00 00 00       	push   $0xff
+  800176:	8d 43 08             	lea    0x8(%ebx),%eax
+  800179:	50                   	push   %eax
+  80017a:	e8 45 09 00 00       	call   800ac4 <sys_cputs>
+		b->idx = 0;
+  80017f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800185:	83 c4 10             	add    $0x10,%esp
+  800188:	eb db                	jmp    800165 <putch+0x1f>
+
+0080018a <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80018a:	55                   	push   %ebp
+  80018b:	89 e5                	mov    %esp,%ebp
+  80018d:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800193:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80019a:	00 00 00 
+	b.cnt = 0;
+  80019d:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001a4:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001a7:	ff 75 0c             	push   0xc(%ebp)
+  8001aa:	ff 75 08             	push   0x8(%ebp)
+  8001ad:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001b3:	50                   	push   %eax
+  8001b4:	68 46 01 80 00       	push   $0x800146
+  8001b9:	e8 14 01 00 00       	call   8002d2 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8001be:	83 c4 08             	add    $0x8,%esp
+  8001c1:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001c7:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001cd:	50                   	push   %eax
+  8001ce:	e8 f1 08 00 00       	call   800ac4 <sys_cputs>
+
+	return b.cnt;
+}
+  8001d3:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001d9:	c9                   	leave
+  8001da:	c3                   	ret
+
+008001db <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001db:	55                   	push   %ebp
+  8001dc:	89 e5                	mov    %esp,%ebp
+  8001de:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8001e1:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8001e4:	50                   	push   %eax
+  8001e5:	ff 75 08             	push   0x8(%ebp)
+  8001e8:	e8 9d ff ff ff       	call   80018a <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8001ed:	c9                   	leave
+  8001ee:	c3                   	ret
+
+008001ef <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8001ef:	55                   	push   %ebp
+  8001f0:	89 e5                	mov    %esp,%ebp
+  8001f2:	57                   	push   %edi
+  8001f3:	56                   	push   %esi
+  8001f4:	53                   	push   %ebx
+  8001f5:	83 ec 1c             	sub    $0x1c,%esp
+  8001f8:	89 c7                	mov    %eax,%edi
+  8001fa:	89 d6                	mov    %edx,%esi
+  8001fc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001ff:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800202:	89 d1                	mov    %edx,%ecx
+  800204:	89 c2                	mov    %eax,%edx
+  800206:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800209:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80020c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80020f:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800212:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800215:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80021c:	39 c2                	cmp    %eax,%edx
+  80021e:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800221:	72 3e                	jb     800261 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800223:	83 ec 0c             	sub    $0xc,%esp
+  800226:	ff 75 18             	push   0x18(%ebp)
+  800229:	83 eb 01             	sub    $0x1,%ebx
+  80022c:	53                   	push   %ebx
+  80022d:	50                   	push   %eax
+  80022e:	83 ec 08             	sub    $0x8,%esp
+  800231:	ff 75 e4             	push   -0x1c(%ebp)
+  800234:	ff 75 e0             	push   -0x20(%ebp)
+  800237:	ff 75 dc             	push   -0x24(%ebp)
+  80023a:	ff 75 d8             	push   -0x28(%ebp)
+  80023d:	e8 6e 23 00 00       	call   8025b0 <__udivdi3>
+  800242:	83 c4 18             	add    $0x18,%esp
+  800245:	52                   	push   %edx
+  800246:	50                   	push   %eax
+  800247:	89 f2                	mov    %esi,%edx
+  800249:	89 f8                	mov    %edi,%eax
+  80024b:	e8 9f ff ff ff       	call   8001ef <printnum>
+  800250:	83 c4 20             	add    $0x20,%esp
+  800253:	eb 13                	jmp    800268 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800255:	83 ec 08             	sub    $0x8,%esp
+  800258:	56                   	push   %esi
+  800259:	ff 75 18             	push   0x18(%ebp)
+  80025c:	ff d7                	call   *%edi
+  80025e:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800261:	83 eb 01             	sub    $0x1,%ebx
+  800264:	85 db                	test   %ebx,%ebx
+  800266:	7f ed                	jg     800255 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800268:	83 ec 08             	sub    $0x8,%esp
+  80026b:	56                   	push   %esi
+  80026c:	83 ec 04             	sub    $0x4,%esp
+  80026f:	ff 75 e4             	push   -0x1c(%ebp)
+  800272:	ff 75 e0             	push   -0x20(%ebp)
+  800275:	ff 75 dc             	push   -0x24(%ebp)
+  800278:	ff 75 d8             	push   -0x28(%ebp)
+  80027b:	e8 00 24 00 00       	call   802680 <__umoddi3>
+  800280:	83 c4 14             	add    $0x14,%esp
+  800283:	0f be 80 60 29 80 00 	movsbl 0x802960(%eax),%eax
+  80028a:	50                   	push   %eax
+  80028b:	ff d7                	call   *%edi
+}
+  80028d:	83 c4 10             	add    $0x10,%esp
+  800290:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800293:	5b                   	pop    %ebx
+  800294:	5e                   	pop    %esi
+  800295:	5f                   	pop    %edi
+  800296:	5d                   	pop    %ebp
+  800297:	c3                   	ret
+
+00800298 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800298:	55                   	push   %ebp
+  800299:	89 e5                	mov    %esp,%ebp
+  80029b:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80029e:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002a2:	8b 10                	mov    (%eax),%edx
+  8002a4:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002a7:	73 0a                	jae    8002b3 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8002a9:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002ac:	89 08                	mov    %ecx,(%eax)
+  8002ae:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002b1:	88 02                	mov    %al,(%edx)
+}
+  8002b3:	5d                   	pop    %ebp
+  8002b4:	c3                   	ret
+
+008002b5 <printfmt>:
+{
+  8002b5:	55                   	push   %ebp
+  8002b6:	89 e5                	mov    %esp,%ebp
+  8002b8:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8002bb:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8002be:	50                   	push   %eax
+  8002bf:	ff 75 10             	push   0x10(%ebp)
+  8002c2:	ff 75 0c             	push   0xc(%ebp)
+  8002c5:	ff 75 08             	push   0x8(%ebp)
+  8002c8:	e8 05 00 00 00       	call   8002d2 <vprintfmt>
+}
+  8002cd:	83 c4 10             	add    $0x10,%esp
+  8002d0:	c9                   	leave
+  8002d1:	c3                   	ret
+
+008002d2 <vprintfmt>:
+{
+  8002d2:	55                   	push   %ebp
+  8002d3:	89 e5                	mov    %esp,%ebp
+  8002d5:	57                   	push   %edi
+  8002d6:	56                   	push   %esi
+  8002d7:	53                   	push   %ebx
+  8002d8:	83 ec 2c             	sub    $0x2c,%esp
+  8002db:	8b 75 08             	mov    0x8(%ebp),%esi
+  8002de:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8002e1:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8002e4:	eb 0a                	jmp    8002f0 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8002e6:	83 ec 08             	sub    $0x8,%esp
+  8002e9:	53                   	push   %ebx
+  8002ea:	50                   	push   %eax
+  8002eb:	ff d6                	call   *%esi
+  8002ed:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8002f0:	83 c7 01             	add    $0x1,%edi
+  8002f3:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8002f7:	83 f8 25             	cmp    $0x25,%eax
+  8002fa:	74 0c                	je     800308 <vprintfmt+0x36>
+			if (ch == '\0')
+  8002fc:	85 c0                	test   %eax,%eax
+  8002fe:	75 e6                	jne    8002e6 <vprintfmt+0x14>
+}
+  800300:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800303:	5b                   	pop    %ebx
+  800304:	5e                   	pop    %esi
+  800305:	5f                   	pop    %edi
+  800306:	5d                   	pop    %ebp
+  800307:	c3                   	ret
+		padc = ' ';
+  800308:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80030c:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800313:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80031a:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800321:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800326:	8d 47 01             	lea    0x1(%edi),%eax
+  800329:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80032c:	0f b6 17             	movzbl (%edi),%edx
+  80032f:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800332:	3c 55                	cmp    $0x55,%al
+  800334:	0f 87 9a 03 00 00    	ja     8006d4 <vprintfmt+0x402>
+  80033a:	0f b6 c0             	movzbl %al,%eax
+  80033d:	ff 24 85 a0 2a 80 00 	jmp    *0x802aa0(,%eax,4)
+  800344:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800347:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80034b:	eb d9                	jmp    800326 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80034d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800350:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800354:	eb d0                	jmp    800326 <vprintfmt+0x54>
+  800356:	0f b6 d2             	movzbl %dl,%edx
+  800359:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80035c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800361:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800364:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800367:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80036b:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80036e:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800371:	83 f9 09             	cmp    $0x9,%ecx
+  800374:	77 55                	ja     8003cb <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800376:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800379:	eb e9                	jmp    800364 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  80037b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80037e:	8b 00                	mov    (%eax),%eax
+  800380:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800383:	8b 45 14             	mov    0x14(%ebp),%eax
+  800386:	8d 40 04             	lea    0x4(%eax),%eax
+  800389:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80038c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80038f:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800393:	79 91                	jns    800326 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800395:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800398:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80039b:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003a2:	eb 82                	jmp    800326 <vprintfmt+0x54>
+			if (width < 0)
+  8003a4:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003a7:	85 d2                	test   %edx,%edx
+  8003a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ae:	0f 49 c2             	cmovns %edx,%eax
+  8003b1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003b4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003b7:	e9 6a ff ff ff       	jmp    800326 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003bc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8003bf:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8003c6:	e9 5b ff ff ff       	jmp    800326 <vprintfmt+0x54>
+  8003cb:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003ce:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003d1:	eb bc                	jmp    80038f <vprintfmt+0xbd>
+			lflag++;
+  8003d3:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003d6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003d9:	e9 48 ff ff ff       	jmp    800326 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8003de:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003e1:	8d 78 04             	lea    0x4(%eax),%edi
+  8003e4:	83 ec 08             	sub    $0x8,%esp
+  8003e7:	53                   	push   %ebx
+  8003e8:	ff 30                	push   (%eax)
+  8003ea:	ff d6                	call   *%esi
+			break;
+  8003ec:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8003ef:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8003f2:	e9 7c 02 00 00       	jmp    800673 <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  8003f7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003fa:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8003fd:	8b 10                	mov    (%eax),%edx
+  8003ff:	89 d0                	mov    %edx,%eax
+  800401:	f7 d8                	neg    %eax
+  800403:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800406:	83 f8 10             	cmp    $0x10,%eax
+  800409:	7f 23                	jg     80042e <vprintfmt+0x15c>
+  80040b:	8b 14 85 00 2c 80 00 	mov    0x802c00(,%eax,4),%edx
+  800412:	85 d2                	test   %edx,%edx
+  800414:	74 18                	je     80042e <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800416:	52                   	push   %edx
+  800417:	68 45 2e 80 00       	push   $0x802e45
+  80041c:	53                   	push   %ebx
+  80041d:	56                   	push   %esi
+  80041e:	e8 92 fe ff ff       	call   8002b5 <printfmt>
+  800423:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800426:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800429:	e9 45 02 00 00       	jmp    800673 <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  80042e:	50                   	push   %eax
+  80042f:	68 78 29 80 00       	push   $0x802978
+  800434:	53                   	push   %ebx
+  800435:	56                   	push   %esi
+  800436:	e8 7a fe ff ff       	call   8002b5 <printfmt>
+  80043b:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80043e:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800441:	e9 2d 02 00 00       	jmp    800673 <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800446:	8b 45 14             	mov    0x14(%ebp),%eax
+  800449:	83 c0 04             	add    $0x4,%eax
+  80044c:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80044f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800452:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800454:	85 c9                	test   %ecx,%ecx
+  800456:	b8 71 29 80 00       	mov    $0x802971,%eax
+  80045b:	0f 45 c1             	cmovne %ecx,%eax
+  80045e:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800461:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800465:	7e 06                	jle    80046d <vprintfmt+0x19b>
+  800467:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80046b:	75 0b                	jne    800478 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80046d:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800470:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800473:	89 75 08             	mov    %esi,0x8(%ebp)
+  800476:	eb 5c                	jmp    8004d4 <vprintfmt+0x202>
+  800478:	83 ec 08             	sub    $0x8,%esp
+  80047b:	ff 75 d0             	push   -0x30(%ebp)
+  80047e:	ff 75 cc             	push   -0x34(%ebp)
+  800481:	e8 eb 02 00 00       	call   800771 <strnlen>
+  800486:	89 c2                	mov    %eax,%edx
+  800488:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80048b:	29 d0                	sub    %edx,%eax
+  80048d:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800490:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800494:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800497:	89 75 08             	mov    %esi,0x8(%ebp)
+  80049a:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80049c:	eb 0e                	jmp    8004ac <vprintfmt+0x1da>
+					putch(padc, putdat);
+  80049e:	83 ec 08             	sub    $0x8,%esp
+  8004a1:	53                   	push   %ebx
+  8004a2:	57                   	push   %edi
+  8004a3:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004a6:	83 ee 01             	sub    $0x1,%esi
+  8004a9:	83 c4 10             	add    $0x10,%esp
+  8004ac:	85 f6                	test   %esi,%esi
+  8004ae:	7f ee                	jg     80049e <vprintfmt+0x1cc>
+  8004b0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004b3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004b6:	85 c0                	test   %eax,%eax
+  8004b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004bd:	0f 49 d0             	cmovns %eax,%edx
+  8004c0:	29 d0                	sub    %edx,%eax
+  8004c2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004c5:	eb a6                	jmp    80046d <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8004c7:	83 ec 08             	sub    $0x8,%esp
+  8004ca:	53                   	push   %ebx
+  8004cb:	52                   	push   %edx
+  8004cc:	ff 55 08             	call   *0x8(%ebp)
+  8004cf:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004d2:	89 f1                	mov    %esi,%ecx
+  8004d4:	8d 71 01             	lea    0x1(%ecx),%esi
+  8004d7:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004db:	0f be d0             	movsbl %al,%edx
+  8004de:	85 d2                	test   %edx,%edx
+  8004e0:	74 28                	je     80050a <vprintfmt+0x238>
+  8004e2:	85 ff                	test   %edi,%edi
+  8004e4:	78 05                	js     8004eb <vprintfmt+0x219>
+  8004e6:	83 ef 01             	sub    $0x1,%edi
+  8004e9:	78 30                	js     80051b <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8004eb:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8004ef:	74 d6                	je     8004c7 <vprintfmt+0x1f5>
+  8004f1:	0f be c0             	movsbl %al,%eax
+  8004f4:	83 e8 20             	sub    $0x20,%eax
+  8004f7:	83 f8 5e             	cmp    $0x5e,%eax
+  8004fa:	76 cb                	jbe    8004c7 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8004fc:	83 ec 08             	sub    $0x8,%esp
+  8004ff:	53                   	push   %ebx
+  800500:	6a 3f                	push   $0x3f
+  800502:	ff 55 08             	call   *0x8(%ebp)
+  800505:	83 c4 10             	add    $0x10,%esp
+  800508:	eb c8                	jmp    8004d2 <vprintfmt+0x200>
+  80050a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80050d:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800510:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800513:	01 d0                	add    %edx,%eax
+  800515:	29 c8                	sub    %ecx,%eax
+  800517:	89 c7                	mov    %eax,%edi
+  800519:	eb 13                	jmp    80052e <vprintfmt+0x25c>
+  80051b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80051e:	eb ed                	jmp    80050d <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800520:	83 ec 08             	sub    $0x8,%esp
+  800523:	53                   	push   %ebx
+  800524:	6a 20                	push   $0x20
+  800526:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800528:	83 ef 01             	sub    $0x1,%edi
+  80052b:	83 c4 10             	add    $0x10,%esp
+  80052e:	85 ff                	test   %edi,%edi
+  800530:	7f ee                	jg     800520 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800532:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800535:	89 45 14             	mov    %eax,0x14(%ebp)
+  800538:	e9 36 01 00 00       	jmp    800673 <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  80053d:	83 f9 01             	cmp    $0x1,%ecx
+  800540:	7f 1f                	jg     800561 <vprintfmt+0x28f>
+	else if (lflag)
+  800542:	85 c9                	test   %ecx,%ecx
+  800544:	74 67                	je     8005ad <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800546:	8b 45 14             	mov    0x14(%ebp),%eax
+  800549:	8b 00                	mov    (%eax),%eax
+  80054b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80054e:	89 c1                	mov    %eax,%ecx
+  800550:	c1 f9 1f             	sar    $0x1f,%ecx
+  800553:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800556:	8b 45 14             	mov    0x14(%ebp),%eax
+  800559:	8d 40 04             	lea    0x4(%eax),%eax
+  80055c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80055f:	eb 17                	jmp    800578 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800561:	8b 45 14             	mov    0x14(%ebp),%eax
+  800564:	8b 50 04             	mov    0x4(%eax),%edx
+  800567:	8b 00                	mov    (%eax),%eax
+  800569:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80056c:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80056f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800572:	8d 40 08             	lea    0x8(%eax),%eax
+  800575:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800578:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80057b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80057e:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800583:	85 c9                	test   %ecx,%ecx
+  800585:	0f 89 ce 00 00 00    	jns    800659 <vprintfmt+0x387>
+				putch('-', putdat);
+  80058b:	83 ec 08             	sub    $0x8,%esp
+  80058e:	53                   	push   %ebx
+  80058f:	6a 2d                	push   $0x2d
+  800591:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800593:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800596:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800599:	f7 da                	neg    %edx
+  80059b:	83 d1 00             	adc    $0x0,%ecx
+  80059e:	f7 d9                	neg    %ecx
+  8005a0:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8005a3:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005a8:	e9 ac 00 00 00       	jmp    800659 <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  8005ad:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b0:	8b 00                	mov    (%eax),%eax
+  8005b2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005b5:	89 c1                	mov    %eax,%ecx
+  8005b7:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005ba:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c0:	8d 40 04             	lea    0x4(%eax),%eax
+  8005c3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005c6:	eb b0                	jmp    800578 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8005c8:	83 f9 01             	cmp    $0x1,%ecx
+  8005cb:	7f 1b                	jg     8005e8 <vprintfmt+0x316>
+	else if (lflag)
+  8005cd:	85 c9                	test   %ecx,%ecx
+  8005cf:	74 2c                	je     8005fd <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  8005d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d4:	8b 10                	mov    (%eax),%edx
+  8005d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005db:	8d 40 04             	lea    0x4(%eax),%eax
+  8005de:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005e1:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8005e6:	eb 71                	jmp    800659 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  8005e8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005eb:	8b 10                	mov    (%eax),%edx
+  8005ed:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005f0:	8d 40 08             	lea    0x8(%eax),%eax
+  8005f3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005f6:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8005fb:	eb 5c                	jmp    800659 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  8005fd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800600:	8b 10                	mov    (%eax),%edx
+  800602:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800607:	8d 40 04             	lea    0x4(%eax),%eax
+  80060a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80060d:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800612:	eb 45                	jmp    800659 <vprintfmt+0x387>
+			putch('X', putdat);
+  800614:	83 ec 08             	sub    $0x8,%esp
+  800617:	53                   	push   %ebx
+  800618:	6a 58                	push   $0x58
+  80061a:	ff d6                	call   *%esi
+			putch('X', putdat);
+  80061c:	83 c4 08             	add    $0x8,%esp
+  80061f:	53                   	push   %ebx
+  800620:	6a 58                	push   $0x58
+  800622:	ff d6                	call   *%esi
+			putch('X', putdat);
+  800624:	83 c4 08             	add    $0x8,%esp
+  800627:	53                   	push   %ebx
+  800628:	6a 58                	push   $0x58
+  80062a:	ff d6                	call   *%esi
+			break;
+  80062c:	83 c4 10             	add    $0x10,%esp
+  80062f:	eb 42                	jmp    800673 <vprintfmt+0x3a1>
+			putch('0', putdat);
+  800631:	83 ec 08             	sub    $0x8,%esp
+  800634:	53                   	push   %ebx
+  800635:	6a 30                	push   $0x30
+  800637:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800639:	83 c4 08             	add    $0x8,%esp
+  80063c:	53                   	push   %ebx
+  80063d:	6a 78                	push   $0x78
+  80063f:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800641:	8b 45 14             	mov    0x14(%ebp),%eax
+  800644:	8b 10                	mov    (%eax),%edx
+  800646:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80064b:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80064e:	8d 40 04             	lea    0x4(%eax),%eax
+  800651:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800654:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800659:	83 ec 0c             	sub    $0xc,%esp
+  80065c:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800660:	50                   	push   %eax
+  800661:	ff 75 e0             	push   -0x20(%ebp)
+  800664:	57                   	push   %edi
+  800665:	51                   	push   %ecx
+  800666:	52                   	push   %edx
+  800667:	89 da                	mov    %ebx,%edx
+  800669:	89 f0                	mov    %esi,%eax
+  80066b:	e8 7f fb ff ff       	call   8001ef <printnum>
+			break;
+  800670:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800673:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800676:	e9 75 fc ff ff       	jmp    8002f0 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  80067b:	83 f9 01             	cmp    $0x1,%ecx
+  80067e:	7f 1b                	jg     80069b <vprintfmt+0x3c9>
+	else if (lflag)
+  800680:	85 c9                	test   %ecx,%ecx
+  800682:	74 2c                	je     8006b0 <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  800684:	8b 45 14             	mov    0x14(%ebp),%eax
+  800687:	8b 10                	mov    (%eax),%edx
+  800689:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80068e:	8d 40 04             	lea    0x4(%eax),%eax
+  800691:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800694:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800699:	eb be                	jmp    800659 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  80069b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069e:	8b 10                	mov    (%eax),%edx
+  8006a0:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006a3:	8d 40 08             	lea    0x8(%eax),%eax
+  8006a6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006a9:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8006ae:	eb a9                	jmp    800659 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  8006b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b3:	8b 10                	mov    (%eax),%edx
+  8006b5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006ba:	8d 40 04             	lea    0x4(%eax),%eax
+  8006bd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006c0:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8006c5:	eb 92                	jmp    800659 <vprintfmt+0x387>
+			putch(ch, putdat);
+  8006c7:	83 ec 08             	sub    $0x8,%esp
+  8006ca:	53                   	push   %ebx
+  8006cb:	6a 25                	push   $0x25
+  8006cd:	ff d6                	call   *%esi
+			break;
+  8006cf:	83 c4 10             	add    $0x10,%esp
+  8006d2:	eb 9f                	jmp    800673 <vprintfmt+0x3a1>
+			putch('%', putdat);
+  8006d4:	83 ec 08             	sub    $0x8,%esp
+  8006d7:	53                   	push   %ebx
+  8006d8:	6a 25                	push   $0x25
+  8006da:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8006dc:	83 c4 10             	add    $0x10,%esp
+  8006df:	89 f8                	mov    %edi,%eax
+  8006e1:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8006e5:	74 05                	je     8006ec <vprintfmt+0x41a>
+  8006e7:	83 e8 01             	sub    $0x1,%eax
+  8006ea:	eb f5                	jmp    8006e1 <vprintfmt+0x40f>
+  8006ec:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8006ef:	eb 82                	jmp    800673 <vprintfmt+0x3a1>
+
+008006f1 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8006f1:	55                   	push   %ebp
+  8006f2:	89 e5                	mov    %esp,%ebp
+  8006f4:	83 ec 18             	sub    $0x18,%esp
+  8006f7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006fa:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8006fd:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800700:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800704:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800707:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80070e:	85 c0                	test   %eax,%eax
+  800710:	74 26                	je     800738 <vsnprintf+0x47>
+  800712:	85 d2                	test   %edx,%edx
+  800714:	7e 22                	jle    800738 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800716:	ff 75 14             	push   0x14(%ebp)
+  800719:	ff 75 10             	push   0x10(%ebp)
+  80071c:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80071f:	50                   	push   %eax
+  800720:	68 98 02 80 00       	push   $0x800298
+  800725:	e8 a8 fb ff ff       	call   8002d2 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80072a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80072d:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800730:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800733:	83 c4 10             	add    $0x10,%esp
+}
+  800736:	c9                   	leave
+  800737:	c3                   	ret
+		return -E_INVAL;
+  800738:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80073d:	eb f7                	jmp    800736 <vsnprintf+0x45>
+
+0080073f <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80073f:	55                   	push   %ebp
+  800740:	89 e5                	mov    %esp,%ebp
+  800742:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800745:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800748:	50                   	push   %eax
+  800749:	ff 75 10             	push   0x10(%ebp)
+  80074c:	ff 75 0c             	push   0xc(%ebp)
+  80074f:	ff 75 08             	push   0x8(%ebp)
+  800752:	e8 9a ff ff ff       	call   8006f1 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800757:	c9                   	leave
+  800758:	c3                   	ret
+
+00800759 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800759:	55                   	push   %ebp
+  80075a:	89 e5                	mov    %esp,%ebp
+  80075c:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80075f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800764:	eb 03                	jmp    800769 <strlen+0x10>
+		n++;
+  800766:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800769:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80076d:	75 f7                	jne    800766 <strlen+0xd>
+	return n;
+}
+  80076f:	5d                   	pop    %ebp
+  800770:	c3                   	ret
+
+00800771 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800771:	55                   	push   %ebp
+  800772:	89 e5                	mov    %esp,%ebp
+  800774:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800777:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80077a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80077f:	eb 03                	jmp    800784 <strnlen+0x13>
+		n++;
+  800781:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800784:	39 d0                	cmp    %edx,%eax
+  800786:	74 08                	je     800790 <strnlen+0x1f>
+  800788:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80078c:	75 f3                	jne    800781 <strnlen+0x10>
+  80078e:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800790:	89 d0                	mov    %edx,%eax
+  800792:	5d                   	pop    %ebp
+  800793:	c3                   	ret
+
+00800794 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800794:	55                   	push   %ebp
+  800795:	89 e5                	mov    %esp,%ebp
+  800797:	53                   	push   %ebx
+  800798:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80079b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80079e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007a3:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8007a7:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8007aa:	83 c0 01             	add    $0x1,%eax
+  8007ad:	84 d2                	test   %dl,%dl
+  8007af:	75 f2                	jne    8007a3 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8007b1:	89 c8                	mov    %ecx,%eax
+  8007b3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007b6:	c9                   	leave
+  8007b7:	c3                   	ret
+
+008007b8 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8007b8:	55                   	push   %ebp
+  8007b9:	89 e5                	mov    %esp,%ebp
+  8007bb:	53                   	push   %ebx
+  8007bc:	83 ec 10             	sub    $0x10,%esp
+  8007bf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8007c2:	53                   	push   %ebx
+  8007c3:	e8 91 ff ff ff       	call   800759 <strlen>
+  8007c8:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8007cb:	ff 75 0c             	push   0xc(%ebp)
+  8007ce:	01 d8                	add    %ebx,%eax
+  8007d0:	50                   	push   %eax
+  8007d1:	e8 be ff ff ff       	call   800794 <strcpy>
+	return dst;
+}
+  8007d6:	89 d8                	mov    %ebx,%eax
+  8007d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007db:	c9                   	leave
+  8007dc:	c3                   	ret
+
+008007dd <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8007dd:	55                   	push   %ebp
+  8007de:	89 e5                	mov    %esp,%ebp
+  8007e0:	56                   	push   %esi
+  8007e1:	53                   	push   %ebx
+  8007e2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007e5:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8007e8:	89 f3                	mov    %esi,%ebx
+  8007ea:	03 5d 10             	add    0x10(%ebp),%ebx
+  8007ed:	89 f0                	mov    %esi,%eax
+  8007ef:	eb 0f                	jmp    800800 <strncpy+0x23>
+		*dst++ = *src;
+  8007f1:	83 c0 01             	add    $0x1,%eax
+  8007f4:	0f b6 0a             	movzbl (%edx),%ecx
+  8007f7:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8007fa:	80 f9 01             	cmp    $0x1,%cl
+  8007fd:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800800:	39 d8                	cmp    %ebx,%eax
+  800802:	75 ed                	jne    8007f1 <strncpy+0x14>
+	}
+	return ret;
+}
+  800804:	89 f0                	mov    %esi,%eax
+  800806:	5b                   	pop    %ebx
+  800807:	5e                   	pop    %esi
+  800808:	5d                   	pop    %ebp
+  800809:	c3                   	ret
+
+0080080a <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80080a:	55                   	push   %ebp
+  80080b:	89 e5                	mov    %esp,%ebp
+  80080d:	56                   	push   %esi
+  80080e:	53                   	push   %ebx
+  80080f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800812:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800815:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800818:	89 f0                	mov    %esi,%eax
+  80081a:	85 d2                	test   %edx,%edx
+  80081c:	74 21                	je     80083f <strlcpy+0x35>
+  80081e:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800822:	89 f2                	mov    %esi,%edx
+  800824:	eb 09                	jmp    80082f <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800826:	83 c1 01             	add    $0x1,%ecx
+  800829:	83 c2 01             	add    $0x1,%edx
+  80082c:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80082f:	39 c2                	cmp    %eax,%edx
+  800831:	74 09                	je     80083c <strlcpy+0x32>
+  800833:	0f b6 19             	movzbl (%ecx),%ebx
+  800836:	84 db                	test   %bl,%bl
+  800838:	75 ec                	jne    800826 <strlcpy+0x1c>
+  80083a:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80083c:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80083f:	29 f0                	sub    %esi,%eax
+}
+  800841:	5b                   	pop    %ebx
+  800842:	5e                   	pop    %esi
+  800843:	5d                   	pop    %ebp
+  800844:	c3                   	ret
+
+00800845 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800845:	55                   	push   %ebp
+  800846:	89 e5                	mov    %esp,%ebp
+  800848:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80084b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80084e:	eb 06                	jmp    800856 <strcmp+0x11>
+		p++, q++;
+  800850:	83 c1 01             	add    $0x1,%ecx
+  800853:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800856:	0f b6 01             	movzbl (%ecx),%eax
+  800859:	84 c0                	test   %al,%al
+  80085b:	74 04                	je     800861 <strcmp+0x1c>
+  80085d:	3a 02                	cmp    (%edx),%al
+  80085f:	74 ef                	je     800850 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800861:	0f b6 c0             	movzbl %al,%eax
+  800864:	0f b6 12             	movzbl (%edx),%edx
+  800867:	29 d0                	sub    %edx,%eax
+}
+  800869:	5d                   	pop    %ebp
+  80086a:	c3                   	ret
+
+0080086b <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80086b:	55                   	push   %ebp
+  80086c:	89 e5                	mov    %esp,%ebp
+  80086e:	53                   	push   %ebx
+  80086f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800872:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800875:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800878:	eb 09                	jmp    800883 <strncmp+0x18>
+		n--, p++, q++;
+  80087a:	83 ea 01             	sub    $0x1,%edx
+  80087d:	83 c0 01             	add    $0x1,%eax
+  800880:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800883:	85 d2                	test   %edx,%edx
+  800885:	74 18                	je     80089f <strncmp+0x34>
+  800887:	0f b6 18             	movzbl (%eax),%ebx
+  80088a:	84 db                	test   %bl,%bl
+  80088c:	74 04                	je     800892 <strncmp+0x27>
+  80088e:	3a 19                	cmp    (%ecx),%bl
+  800890:	74 e8                	je     80087a <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800892:	0f b6 00             	movzbl (%eax),%eax
+  800895:	0f b6 11             	movzbl (%ecx),%edx
+  800898:	29 d0                	sub    %edx,%eax
+}
+  80089a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80089d:	c9                   	leave
+  80089e:	c3                   	ret
+		return 0;
+  80089f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008a4:	eb f4                	jmp    80089a <strncmp+0x2f>
+
+008008a6 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8008a6:	55                   	push   %ebp
+  8008a7:	89 e5                	mov    %esp,%ebp
+  8008a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008ac:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008b0:	eb 03                	jmp    8008b5 <strchr+0xf>
+  8008b2:	83 c0 01             	add    $0x1,%eax
+  8008b5:	0f b6 10             	movzbl (%eax),%edx
+  8008b8:	84 d2                	test   %dl,%dl
+  8008ba:	74 06                	je     8008c2 <strchr+0x1c>
+		if (*s == c)
+  8008bc:	38 ca                	cmp    %cl,%dl
+  8008be:	75 f2                	jne    8008b2 <strchr+0xc>
+  8008c0:	eb 05                	jmp    8008c7 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8008c2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008c7:	5d                   	pop    %ebp
+  8008c8:	c3                   	ret
+
+008008c9 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8008c9:	55                   	push   %ebp
+  8008ca:	89 e5                	mov    %esp,%ebp
+  8008cc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008cf:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008d3:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8008d6:	38 ca                	cmp    %cl,%dl
+  8008d8:	74 09                	je     8008e3 <strfind+0x1a>
+  8008da:	84 d2                	test   %dl,%dl
+  8008dc:	74 05                	je     8008e3 <strfind+0x1a>
+	for (; *s; s++)
+  8008de:	83 c0 01             	add    $0x1,%eax
+  8008e1:	eb f0                	jmp    8008d3 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8008e3:	5d                   	pop    %ebp
+  8008e4:	c3                   	ret
+
+008008e5 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8008e5:	55                   	push   %ebp
+  8008e6:	89 e5                	mov    %esp,%ebp
+  8008e8:	57                   	push   %edi
+  8008e9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8008ec:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8008ef:	85 c9                	test   %ecx,%ecx
+  8008f1:	74 20                	je     800913 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8008f3:	89 f8                	mov    %edi,%eax
+  8008f5:	09 c8                	or     %ecx,%eax
+  8008f7:	a8 03                	test   $0x3,%al
+  8008f9:	75 12                	jne    80090d <memset+0x28>
+		c &= 0xFF;
+  8008fb:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8008ff:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800905:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800908:	fc                   	cld
+  800909:	f3 ab                	rep stos %eax,%es:(%edi)
+  80090b:	eb 06                	jmp    800913 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80090d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800910:	fc                   	cld
+  800911:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800913:	89 f8                	mov    %edi,%eax
+  800915:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800918:	c9                   	leave
+  800919:	c3                   	ret
+
+0080091a <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  80091a:	55                   	push   %ebp
+  80091b:	89 e5                	mov    %esp,%ebp
+  80091d:	57                   	push   %edi
+  80091e:	56                   	push   %esi
+  80091f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800922:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800925:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800928:	39 c6                	cmp    %eax,%esi
+  80092a:	73 32                	jae    80095e <memmove+0x44>
+  80092c:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80092f:	39 d0                	cmp    %edx,%eax
+  800931:	73 2b                	jae    80095e <memmove+0x44>
+		s += n;
+		d += n;
+  800933:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800936:	89 d6                	mov    %edx,%esi
+  800938:	09 fe                	or     %edi,%esi
+  80093a:	09 ce                	or     %ecx,%esi
+  80093c:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800942:	75 0e                	jne    800952 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800944:	83 ef 04             	sub    $0x4,%edi
+  800947:	8d 72 fc             	lea    -0x4(%edx),%esi
+  80094a:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  80094d:	fd                   	std
+  80094e:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800950:	eb 09                	jmp    80095b <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800952:	83 ef 01             	sub    $0x1,%edi
+  800955:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800958:	fd                   	std
+  800959:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  80095b:	fc                   	cld
+  80095c:	eb 1a                	jmp    800978 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80095e:	89 f2                	mov    %esi,%edx
+  800960:	09 c2                	or     %eax,%edx
+  800962:	09 ca                	or     %ecx,%edx
+  800964:	f6 c2 03             	test   $0x3,%dl
+  800967:	75 0a                	jne    800973 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800969:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  80096c:	89 c7                	mov    %eax,%edi
+  80096e:	fc                   	cld
+  80096f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800971:	eb 05                	jmp    800978 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800973:	89 c7                	mov    %eax,%edi
+  800975:	fc                   	cld
+  800976:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800978:	5e                   	pop    %esi
+  800979:	5f                   	pop    %edi
+  80097a:	5d                   	pop    %ebp
+  80097b:	c3                   	ret
+
+0080097c <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  80097c:	55                   	push   %ebp
+  80097d:	89 e5                	mov    %esp,%ebp
+  80097f:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800982:	ff 75 10             	push   0x10(%ebp)
+  800985:	ff 75 0c             	push   0xc(%ebp)
+  800988:	ff 75 08             	push   0x8(%ebp)
+  80098b:	e8 8a ff ff ff       	call   80091a <memmove>
+}
+  800990:	c9                   	leave
+  800991:	c3                   	ret
+
+00800992 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800992:	55                   	push   %ebp
+  800993:	89 e5                	mov    %esp,%ebp
+  800995:	56                   	push   %esi
+  800996:	53                   	push   %ebx
+  800997:	8b 45 08             	mov    0x8(%ebp),%eax
+  80099a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  80099d:	89 c6                	mov    %eax,%esi
+  80099f:	03 75 10             	add    0x10(%ebp),%esi
+  8009a2:	eb 06                	jmp    8009aa <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8009a4:	83 c0 01             	add    $0x1,%eax
+  8009a7:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  8009aa:	39 f0                	cmp    %esi,%eax
+  8009ac:	74 14                	je     8009c2 <memcmp+0x30>
+		if (*s1 != *s2)
+  8009ae:	0f b6 08             	movzbl (%eax),%ecx
+  8009b1:	0f b6 1a             	movzbl (%edx),%ebx
+  8009b4:	38 d9                	cmp    %bl,%cl
+  8009b6:	74 ec                	je     8009a4 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  8009b8:	0f b6 c1             	movzbl %cl,%eax
+  8009bb:	0f b6 db             	movzbl %bl,%ebx
+  8009be:	29 d8                	sub    %ebx,%eax
+  8009c0:	eb 05                	jmp    8009c7 <memcmp+0x35>
+	}
+
+	return 0;
+  8009c2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009c7:	5b                   	pop    %ebx
+  8009c8:	5e                   	pop    %esi
+  8009c9:	5d                   	pop    %ebp
+  8009ca:	c3                   	ret
+
+008009cb <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8009cb:	55                   	push   %ebp
+  8009cc:	89 e5                	mov    %esp,%ebp
+  8009ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009d1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8009d4:	89 c2                	mov    %eax,%edx
+  8009d6:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8009d9:	eb 03                	jmp    8009de <memfind+0x13>
+  8009db:	83 c0 01             	add    $0x1,%eax
+  8009de:	39 d0                	cmp    %edx,%eax
+  8009e0:	73 04                	jae    8009e6 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8009e2:	38 08                	cmp    %cl,(%eax)
+  8009e4:	75 f5                	jne    8009db <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8009e6:	5d                   	pop    %ebp
+  8009e7:	c3                   	ret
+
+008009e8 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8009e8:	55                   	push   %ebp
+  8009e9:	89 e5                	mov    %esp,%ebp
+  8009eb:	57                   	push   %edi
+  8009ec:	56                   	push   %esi
+  8009ed:	53                   	push   %ebx
+  8009ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009f1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8009f4:	eb 03                	jmp    8009f9 <strtol+0x11>
+		s++;
+  8009f6:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  8009f9:	0f b6 02             	movzbl (%edx),%eax
+  8009fc:	3c 20                	cmp    $0x20,%al
+  8009fe:	74 f6                	je     8009f6 <strtol+0xe>
+  800a00:	3c 09                	cmp    $0x9,%al
+  800a02:	74 f2                	je     8009f6 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a04:	3c 2b                	cmp    $0x2b,%al
+  800a06:	74 2a                	je     800a32 <strtol+0x4a>
+	int neg = 0;
+  800a08:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a0d:	3c 2d                	cmp    $0x2d,%al
+  800a0f:	74 2b                	je     800a3c <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a11:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a17:	75 0f                	jne    800a28 <strtol+0x40>
+  800a19:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a1c:	74 28                	je     800a46 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a1e:	85 db                	test   %ebx,%ebx
+  800a20:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a25:	0f 44 d8             	cmove  %eax,%ebx
+  800a28:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a2d:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a30:	eb 46                	jmp    800a78 <strtol+0x90>
+		s++;
+  800a32:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a35:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a3a:	eb d5                	jmp    800a11 <strtol+0x29>
+		s++, neg = 1;
+  800a3c:	83 c2 01             	add    $0x1,%edx
+  800a3f:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a44:	eb cb                	jmp    800a11 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a46:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a4a:	74 0e                	je     800a5a <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a4c:	85 db                	test   %ebx,%ebx
+  800a4e:	75 d8                	jne    800a28 <strtol+0x40>
+		s++, base = 8;
+  800a50:	83 c2 01             	add    $0x1,%edx
+  800a53:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a58:	eb ce                	jmp    800a28 <strtol+0x40>
+		s += 2, base = 16;
+  800a5a:	83 c2 02             	add    $0x2,%edx
+  800a5d:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a62:	eb c4                	jmp    800a28 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a64:	0f be c0             	movsbl %al,%eax
+  800a67:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a6a:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a6d:	7d 3a                	jge    800aa9 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a6f:	83 c2 01             	add    $0x1,%edx
+  800a72:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a76:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a78:	0f b6 02             	movzbl (%edx),%eax
+  800a7b:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a7e:	89 f3                	mov    %esi,%ebx
+  800a80:	80 fb 09             	cmp    $0x9,%bl
+  800a83:	76 df                	jbe    800a64 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a85:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a88:	89 f3                	mov    %esi,%ebx
+  800a8a:	80 fb 19             	cmp    $0x19,%bl
+  800a8d:	77 08                	ja     800a97 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800a8f:	0f be c0             	movsbl %al,%eax
+  800a92:	83 e8 57             	sub    $0x57,%eax
+  800a95:	eb d3                	jmp    800a6a <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800a97:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800a9a:	89 f3                	mov    %esi,%ebx
+  800a9c:	80 fb 19             	cmp    $0x19,%bl
+  800a9f:	77 08                	ja     800aa9 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800aa1:	0f be c0             	movsbl %al,%eax
+  800aa4:	83 e8 37             	sub    $0x37,%eax
+  800aa7:	eb c1                	jmp    800a6a <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800aa9:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800aad:	74 05                	je     800ab4 <strtol+0xcc>
+		*endptr = (char *) s;
+  800aaf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ab2:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800ab4:	89 c8                	mov    %ecx,%eax
+  800ab6:	f7 d8                	neg    %eax
+  800ab8:	85 ff                	test   %edi,%edi
+  800aba:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800abd:	89 c8                	mov    %ecx,%eax
+  800abf:	5b                   	pop    %ebx
+  800ac0:	5e                   	pop    %esi
+  800ac1:	5f                   	pop    %edi
+  800ac2:	5d                   	pop    %ebp
+  800ac3:	c3                   	ret
+
+00800ac4 <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800ac4:	55                   	push   %ebp
+  800ac5:	89 e5                	mov    %esp,%ebp
+  800ac7:	57                   	push   %edi
+  800ac8:	56                   	push   %esi
+  800ac9:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800aca:	b8 00 00 00 00       	mov    $0x0,%eax
+  800acf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ad2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ad5:	89 c3                	mov    %eax,%ebx
+  800ad7:	89 c7                	mov    %eax,%edi
+  800ad9:	89 c6                	mov    %eax,%esi
+  800adb:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  800add:	5b                   	pop    %ebx
+  800ade:	5e                   	pop    %esi
+  800adf:	5f                   	pop    %edi
+  800ae0:	5d                   	pop    %ebp
+  800ae1:	c3                   	ret
+
+00800ae2 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800ae2:	55                   	push   %ebp
+  800ae3:	89 e5                	mov    %esp,%ebp
+  800ae5:	57                   	push   %edi
+  800ae6:	56                   	push   %esi
+  800ae7:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800ae8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800aed:	b8 01 00 00 00       	mov    $0x1,%eax
+  800af2:	89 d1                	mov    %edx,%ecx
+  800af4:	89 d3                	mov    %edx,%ebx
+  800af6:	89 d7                	mov    %edx,%edi
+  800af8:	89 d6                	mov    %edx,%esi
+  800afa:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800afc:	5b                   	pop    %ebx
+  800afd:	5e                   	pop    %esi
+  800afe:	5f                   	pop    %edi
+  800aff:	5d                   	pop    %ebp
+  800b00:	c3                   	ret
+
+00800b01 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800b01:	55                   	push   %ebp
+  800b02:	89 e5                	mov    %esp,%ebp
+  800b04:	57                   	push   %edi
+  800b05:	56                   	push   %esi
+  800b06:	53                   	push   %ebx
+  800b07:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800b0a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b0f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b12:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b17:	89 cb                	mov    %ecx,%ebx
+  800b19:	89 cf                	mov    %ecx,%edi
+  800b1b:	89 ce                	mov    %ecx,%esi
+  800b1d:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800b1f:	85 c0                	test   %eax,%eax
+  800b21:	7f 08                	jg     800b2b <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800b23:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b26:	5b                   	pop    %ebx
+  800b27:	5e                   	pop    %esi
+  800b28:	5f                   	pop    %edi
+  800b29:	5d                   	pop    %ebp
+  800b2a:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800b2b:	83 ec 0c             	sub    $0xc,%esp
+  800b2e:	50                   	push   %eax
+  800b2f:	6a 03                	push   $0x3
+  800b31:	68 63 2c 80 00       	push   $0x802c63
+  800b36:	6a 3e                	push   $0x3e
+  800b38:	68 80 2c 80 00       	push   $0x802c80
+  800b3d:	e8 39 17 00 00       	call   80227b <_panic>
+
+00800b42 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800b42:	55                   	push   %ebp
+  800b43:	89 e5                	mov    %esp,%ebp
+  800b45:	57                   	push   %edi
+  800b46:	56                   	push   %esi
+  800b47:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800b48:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b4d:	b8 02 00 00 00       	mov    $0x2,%eax
+  800b52:	89 d1                	mov    %edx,%ecx
+  800b54:	89 d3                	mov    %edx,%ebx
+  800b56:	89 d7                	mov    %edx,%edi
+  800b58:	89 d6                	mov    %edx,%esi
+  800b5a:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800b5c:	5b                   	pop    %ebx
+  800b5d:	5e                   	pop    %esi
+  800b5e:	5f                   	pop    %edi
+  800b5f:	5d                   	pop    %ebp
+  800b60:	c3                   	ret
+
+00800b61 <sys_yield>:
+
+void
+sys_yield(void) {
+  800b61:	55                   	push   %ebp
+  800b62:	89 e5                	mov    %esp,%ebp
+  800b64:	57                   	push   %edi
+  800b65:	56                   	push   %esi
+  800b66:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800b67:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b6c:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800b71:	89 d1                	mov    %edx,%ecx
+  800b73:	89 d3                	mov    %edx,%ebx
+  800b75:	89 d7                	mov    %edx,%edi
+  800b77:	89 d6                	mov    %edx,%esi
+  800b79:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800b7b:	5b                   	pop    %ebx
+  800b7c:	5e                   	pop    %esi
+  800b7d:	5f                   	pop    %edi
+  800b7e:	5d                   	pop    %ebp
+  800b7f:	c3                   	ret
+
+00800b80 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  800b80:	55                   	push   %ebp
+  800b81:	89 e5                	mov    %esp,%ebp
+  800b83:	57                   	push   %edi
+  800b84:	56                   	push   %esi
+  800b85:	53                   	push   %ebx
+  800b86:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800b89:	be 00 00 00 00       	mov    $0x0,%esi
+  800b8e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b91:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b94:	b8 04 00 00 00       	mov    $0x4,%eax
+  800b99:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b9c:	89 f7                	mov    %esi,%edi
+  800b9e:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ba0:	85 c0                	test   %eax,%eax
+  800ba2:	7f 08                	jg     800bac <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800ba4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ba7:	5b                   	pop    %ebx
+  800ba8:	5e                   	pop    %esi
+  800ba9:	5f                   	pop    %edi
+  800baa:	5d                   	pop    %ebp
+  800bab:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800bac:	83 ec 0c             	sub    $0xc,%esp
+  800baf:	50                   	push   %eax
+  800bb0:	6a 04                	push   $0x4
+  800bb2:	68 63 2c 80 00       	push   $0x802c63
+  800bb7:	6a 3e                	push   $0x3e
+  800bb9:	68 80 2c 80 00       	push   $0x802c80
+  800bbe:	e8 b8 16 00 00       	call   80227b <_panic>
+
+00800bc3 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  800bc3:	55                   	push   %ebp
+  800bc4:	89 e5                	mov    %esp,%ebp
+  800bc6:	57                   	push   %edi
+  800bc7:	56                   	push   %esi
+  800bc8:	53                   	push   %ebx
+  800bc9:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800bcc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bcf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bd2:	b8 05 00 00 00       	mov    $0x5,%eax
+  800bd7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bda:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800bdd:	8b 75 18             	mov    0x18(%ebp),%esi
+  800be0:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800be2:	85 c0                	test   %eax,%eax
+  800be4:	7f 08                	jg     800bee <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800be6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800be9:	5b                   	pop    %ebx
+  800bea:	5e                   	pop    %esi
+  800beb:	5f                   	pop    %edi
+  800bec:	5d                   	pop    %ebp
+  800bed:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800bee:	83 ec 0c             	sub    $0xc,%esp
+  800bf1:	50                   	push   %eax
+  800bf2:	6a 05                	push   $0x5
+  800bf4:	68 63 2c 80 00       	push   $0x802c63
+  800bf9:	6a 3e                	push   $0x3e
+  800bfb:	68 80 2c 80 00       	push   $0x802c80
+  800c00:	e8 76 16 00 00       	call   80227b <_panic>
+
+00800c05 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  800c05:	55                   	push   %ebp
+  800c06:	89 e5                	mov    %esp,%ebp
+  800c08:	57                   	push   %edi
+  800c09:	56                   	push   %esi
+  800c0a:	53                   	push   %ebx
+  800c0b:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c0e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c13:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c16:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c19:	b8 06 00 00 00       	mov    $0x6,%eax
+  800c1e:	89 df                	mov    %ebx,%edi
+  800c20:	89 de                	mov    %ebx,%esi
+  800c22:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c24:	85 c0                	test   %eax,%eax
+  800c26:	7f 08                	jg     800c30 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800c28:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c2b:	5b                   	pop    %ebx
+  800c2c:	5e                   	pop    %esi
+  800c2d:	5f                   	pop    %edi
+  800c2e:	5d                   	pop    %ebp
+  800c2f:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c30:	83 ec 0c             	sub    $0xc,%esp
+  800c33:	50                   	push   %eax
+  800c34:	6a 06                	push   $0x6
+  800c36:	68 63 2c 80 00       	push   $0x802c63
+  800c3b:	6a 3e                	push   $0x3e
+  800c3d:	68 80 2c 80 00       	push   $0x802c80
+  800c42:	e8 34 16 00 00       	call   80227b <_panic>
+
+00800c47 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800c47:	55                   	push   %ebp
+  800c48:	89 e5                	mov    %esp,%ebp
+  800c4a:	57                   	push   %edi
+  800c4b:	56                   	push   %esi
+  800c4c:	53                   	push   %ebx
+  800c4d:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c50:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c55:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c58:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c5b:	b8 08 00 00 00       	mov    $0x8,%eax
+  800c60:	89 df                	mov    %ebx,%edi
+  800c62:	89 de                	mov    %ebx,%esi
+  800c64:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c66:	85 c0                	test   %eax,%eax
+  800c68:	7f 08                	jg     800c72 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800c6a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c6d:	5b                   	pop    %ebx
+  800c6e:	5e                   	pop    %esi
+  800c6f:	5f                   	pop    %edi
+  800c70:	5d                   	pop    %ebp
+  800c71:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c72:	83 ec 0c             	sub    $0xc,%esp
+  800c75:	50                   	push   %eax
+  800c76:	6a 08                	push   $0x8
+  800c78:	68 63 2c 80 00       	push   $0x802c63
+  800c7d:	6a 3e                	push   $0x3e
+  800c7f:	68 80 2c 80 00       	push   $0x802c80
+  800c84:	e8 f2 15 00 00       	call   80227b <_panic>
+
+00800c89 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800c89:	55                   	push   %ebp
+  800c8a:	89 e5                	mov    %esp,%ebp
+  800c8c:	57                   	push   %edi
+  800c8d:	56                   	push   %esi
+  800c8e:	53                   	push   %ebx
+  800c8f:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c92:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c97:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c9a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c9d:	b8 09 00 00 00       	mov    $0x9,%eax
+  800ca2:	89 df                	mov    %ebx,%edi
+  800ca4:	89 de                	mov    %ebx,%esi
+  800ca6:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ca8:	85 c0                	test   %eax,%eax
+  800caa:	7f 08                	jg     800cb4 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800cac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800caf:	5b                   	pop    %ebx
+  800cb0:	5e                   	pop    %esi
+  800cb1:	5f                   	pop    %edi
+  800cb2:	5d                   	pop    %ebp
+  800cb3:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800cb4:	83 ec 0c             	sub    $0xc,%esp
+  800cb7:	50                   	push   %eax
+  800cb8:	6a 09                	push   $0x9
+  800cba:	68 63 2c 80 00       	push   $0x802c63
+  800cbf:	6a 3e                	push   $0x3e
+  800cc1:	68 80 2c 80 00       	push   $0x802c80
+  800cc6:	e8 b0 15 00 00       	call   80227b <_panic>
+
+00800ccb <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800ccb:	55                   	push   %ebp
+  800ccc:	89 e5                	mov    %esp,%ebp
+  800cce:	57                   	push   %edi
+  800ccf:	56                   	push   %esi
+  800cd0:	53                   	push   %ebx
+  800cd1:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800cd4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cd9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cdc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cdf:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ce4:	89 df                	mov    %ebx,%edi
+  800ce6:	89 de                	mov    %ebx,%esi
+  800ce8:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800cea:	85 c0                	test   %eax,%eax
+  800cec:	7f 08                	jg     800cf6 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800cee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cf1:	5b                   	pop    %ebx
+  800cf2:	5e                   	pop    %esi
+  800cf3:	5f                   	pop    %edi
+  800cf4:	5d                   	pop    %ebp
+  800cf5:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800cf6:	83 ec 0c             	sub    $0xc,%esp
+  800cf9:	50                   	push   %eax
+  800cfa:	6a 0a                	push   $0xa
+  800cfc:	68 63 2c 80 00       	push   $0x802c63
+  800d01:	6a 3e                	push   $0x3e
+  800d03:	68 80 2c 80 00       	push   $0x802c80
+  800d08:	e8 6e 15 00 00       	call   80227b <_panic>
+
+00800d0d <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  800d0d:	55                   	push   %ebp
+  800d0e:	89 e5                	mov    %esp,%ebp
+  800d10:	57                   	push   %edi
+  800d11:	56                   	push   %esi
+  800d12:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d13:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d16:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d19:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800d1e:	be 00 00 00 00       	mov    $0x0,%esi
+  800d23:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d26:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d29:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800d2b:	5b                   	pop    %ebx
+  800d2c:	5e                   	pop    %esi
+  800d2d:	5f                   	pop    %edi
+  800d2e:	5d                   	pop    %ebp
+  800d2f:	c3                   	ret
+
+00800d30 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  800d30:	55                   	push   %ebp
+  800d31:	89 e5                	mov    %esp,%ebp
+  800d33:	57                   	push   %edi
+  800d34:	56                   	push   %esi
+  800d35:	53                   	push   %ebx
+  800d36:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800d39:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d3e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d41:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800d46:	89 cb                	mov    %ecx,%ebx
+  800d48:	89 cf                	mov    %ecx,%edi
+  800d4a:	89 ce                	mov    %ecx,%esi
+  800d4c:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d4e:	85 c0                	test   %eax,%eax
+  800d50:	7f 08                	jg     800d5a <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  800d52:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d55:	5b                   	pop    %ebx
+  800d56:	5e                   	pop    %esi
+  800d57:	5f                   	pop    %edi
+  800d58:	5d                   	pop    %ebp
+  800d59:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d5a:	83 ec 0c             	sub    $0xc,%esp
+  800d5d:	50                   	push   %eax
+  800d5e:	6a 0d                	push   $0xd
+  800d60:	68 63 2c 80 00       	push   $0x802c63
+  800d65:	6a 3e                	push   $0x3e
+  800d67:	68 80 2c 80 00       	push   $0x802c80
+  800d6c:	e8 0a 15 00 00       	call   80227b <_panic>
+
+00800d71 <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  800d71:	55                   	push   %ebp
+  800d72:	89 e5                	mov    %esp,%ebp
+  800d74:	57                   	push   %edi
+  800d75:	56                   	push   %esi
+  800d76:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d77:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d7c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d7f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d82:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800d87:	89 df                	mov    %ebx,%edi
+  800d89:	89 de                	mov    %ebx,%esi
+  800d8b:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  800d8d:	5b                   	pop    %ebx
+  800d8e:	5e                   	pop    %esi
+  800d8f:	5f                   	pop    %edi
+  800d90:	5d                   	pop    %ebp
+  800d91:	c3                   	ret
+
+00800d92 <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  800d92:	55                   	push   %ebp
+  800d93:	89 e5                	mov    %esp,%ebp
+  800d95:	57                   	push   %edi
+  800d96:	56                   	push   %esi
+  800d97:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d98:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d9d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800da0:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800da5:	89 cb                	mov    %ecx,%ebx
+  800da7:	89 cf                	mov    %ecx,%edi
+  800da9:	89 ce                	mov    %ecx,%esi
+  800dab:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  800dad:	5b                   	pop    %ebx
+  800dae:	5e                   	pop    %esi
+  800daf:	5f                   	pop    %edi
+  800db0:	5d                   	pop    %ebp
+  800db1:	c3                   	ret
+
+00800db2 <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  800db2:	55                   	push   %ebp
+  800db3:	89 e5                	mov    %esp,%ebp
+  800db5:	57                   	push   %edi
+  800db6:	56                   	push   %esi
+  800db7:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800db8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dbd:	b8 10 00 00 00       	mov    $0x10,%eax
+  800dc2:	89 d1                	mov    %edx,%ecx
+  800dc4:	89 d3                	mov    %edx,%ebx
+  800dc6:	89 d7                	mov    %edx,%edi
+  800dc8:	89 d6                	mov    %edx,%esi
+  800dca:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800dcc:	5b                   	pop    %ebx
+  800dcd:	5e                   	pop    %esi
+  800dce:	5f                   	pop    %edi
+  800dcf:	5d                   	pop    %ebp
+  800dd0:	c3                   	ret
+
+00800dd1 <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  800dd1:	55                   	push   %ebp
+  800dd2:	89 e5                	mov    %esp,%ebp
+  800dd4:	57                   	push   %edi
+  800dd5:	56                   	push   %esi
+  800dd6:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800dd7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ddc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ddf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800de2:	b8 11 00 00 00       	mov    $0x11,%eax
+  800de7:	89 df                	mov    %ebx,%edi
+  800de9:	89 de                	mov    %ebx,%esi
+  800deb:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800ded:	5b                   	pop    %ebx
+  800dee:	5e                   	pop    %esi
+  800def:	5f                   	pop    %edi
+  800df0:	5d                   	pop    %ebp
+  800df1:	c3                   	ret
+
+00800df2 <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  800df2:	55                   	push   %ebp
+  800df3:	89 e5                	mov    %esp,%ebp
+  800df5:	57                   	push   %edi
+  800df6:	56                   	push   %esi
+  800df7:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800df8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dfd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e00:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e03:	b8 12 00 00 00       	mov    $0x12,%eax
+  800e08:	89 df                	mov    %ebx,%edi
+  800e0a:	89 de                	mov    %ebx,%esi
+  800e0c:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800e0e:	5b                   	pop    %ebx
+  800e0f:	5e                   	pop    %esi
+  800e10:	5f                   	pop    %edi
+  800e11:	5d                   	pop    %ebp
+  800e12:	c3                   	ret
+
+00800e13 <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  800e13:	55                   	push   %ebp
+  800e14:	89 e5                	mov    %esp,%ebp
+  800e16:	57                   	push   %edi
+  800e17:	56                   	push   %esi
+  800e18:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e19:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e1e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e21:	b8 13 00 00 00       	mov    $0x13,%eax
+  800e26:	89 cb                	mov    %ecx,%ebx
+  800e28:	89 cf                	mov    %ecx,%edi
+  800e2a:	89 ce                	mov    %ecx,%esi
+  800e2c:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  800e2e:	5b                   	pop    %ebx
+  800e2f:	5e                   	pop    %esi
+  800e30:	5f                   	pop    %edi
+  800e31:	5d                   	pop    %ebp
+  800e32:	c3                   	ret
+
+00800e33 <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  800e33:	55                   	push   %ebp
+  800e34:	89 e5                	mov    %esp,%ebp
+  800e36:	57                   	push   %edi
+  800e37:	56                   	push   %esi
+  800e38:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e39:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e3e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e41:	b8 14 00 00 00       	mov    $0x14,%eax
+  800e46:	89 cb                	mov    %ecx,%ebx
+  800e48:	89 cf                	mov    %ecx,%edi
+  800e4a:	89 ce                	mov    %ecx,%esi
+  800e4c:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  800e4e:	5b                   	pop    %ebx
+  800e4f:	5e                   	pop    %esi
+  800e50:	5f                   	pop    %edi
+  800e51:	5d                   	pop    %ebp
+  800e52:	c3                   	ret
+
+00800e53 <pgfault>:
+//
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf) {
+  800e53:	55                   	push   %ebp
+  800e54:	89 e5                	mov    %esp,%ebp
+  800e56:	53                   	push   %ebx
+  800e57:	83 ec 04             	sub    $0x4,%esp
+  800e5a:	8b 45 08             	mov    0x8(%ebp),%eax
+    void *addr = (void *) utf->utf_fault_va;
+  800e5d:	8b 18                	mov    (%eax),%ebx
+    // Hint:
+    //   Use the read-only page table mappings at uvpt
+    //   (see <inc/memlayout.h>).
+
+    // LAB 4: Your code here.
+    if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P) ||
+  800e5f:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  800e63:	0f 84 95 00 00 00    	je     800efe <pgfault+0xab>
+  800e69:	89 d8                	mov    %ebx,%eax
+  800e6b:	c1 e8 16             	shr    $0x16,%eax
+  800e6e:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  800e75:	a8 01                	test   $0x1,%al
+  800e77:	0f 84 81 00 00 00    	je     800efe <pgfault+0xab>
+        (uvpt[PGNUM(addr)] & (PTE_P | PTE_COW)) != (PTE_P | PTE_COW)) {
+  800e7d:	89 d8                	mov    %ebx,%eax
+  800e7f:	c1 e8 0c             	shr    $0xc,%eax
+  800e82:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800e89:	25 01 08 00 00       	and    $0x801,%eax
+    if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P) ||
+  800e8e:	3d 01 08 00 00       	cmp    $0x801,%eax
+  800e93:	75 69                	jne    800efe <pgfault+0xab>
+    // Hint:
+    //   You should make three system calls.
+
+    // LAB 4: Your code here.
+
+    if (sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W))
+  800e95:	83 ec 04             	sub    $0x4,%esp
+  800e98:	6a 07                	push   $0x7
+  800e9a:	68 00 f0 7f 00       	push   $0x7ff000
+  800e9f:	6a 00                	push   $0x0
+  800ea1:	e8 da fc ff ff       	call   800b80 <sys_page_alloc>
+  800ea6:	83 c4 10             	add    $0x10,%esp
+  800ea9:	85 c0                	test   %eax,%eax
+  800eab:	75 65                	jne    800f12 <pgfault+0xbf>
+        panic("sys_page_alloc failed");
+
+    addr = ROUNDDOWN(addr, PGSIZE);
+  800ead:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+    memmove(PFTEMP, addr, PGSIZE);
+  800eb3:	83 ec 04             	sub    $0x4,%esp
+  800eb6:	68 00 10 00 00       	push   $0x1000
+  800ebb:	53                   	push   %ebx
+  800ebc:	68 00 f0 7f 00       	push   $0x7ff000
+  800ec1:	e8 54 fa ff ff       	call   80091a <memmove>
+
+    if (sys_page_map(0, PFTEMP, 0, addr, PTE_P | PTE_U | PTE_W))
+  800ec6:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  800ecd:	53                   	push   %ebx
+  800ece:	6a 00                	push   $0x0
+  800ed0:	68 00 f0 7f 00       	push   $0x7ff000
+  800ed5:	6a 00                	push   $0x0
+  800ed7:	e8 e7 fc ff ff       	call   800bc3 <sys_page_map>
+  800edc:	83 c4 20             	add    $0x20,%esp
+  800edf:	85 c0                	test   %eax,%eax
+  800ee1:	75 43                	jne    800f26 <pgfault+0xd3>
+        panic("sys_page_map failed");
+    if (sys_page_unmap(0, PFTEMP))
+  800ee3:	83 ec 08             	sub    $0x8,%esp
+  800ee6:	68 00 f0 7f 00       	push   $0x7ff000
+  800eeb:	6a 00                	push   $0x0
+  800eed:	e8 13 fd ff ff       	call   800c05 <sys_page_unmap>
+  800ef2:	83 c4 10             	add    $0x10,%esp
+  800ef5:	85 c0                	test   %eax,%eax
+  800ef7:	75 41                	jne    800f3a <pgfault+0xe7>
+        panic("sys_page_unmap failed");
+
+}
+  800ef9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800efc:	c9                   	leave
+  800efd:	c3                   	ret
+        panic("pgfault: faulting access invalid");
+  800efe:	83 ec 04             	sub    $0x4,%esp
+  800f01:	68 90 2c 80 00       	push   $0x802c90
+  800f06:	6a 1e                	push   $0x1e
+  800f08:	68 fc 2c 80 00       	push   $0x802cfc
+  800f0d:	e8 69 13 00 00       	call   80227b <_panic>
+        panic("sys_page_alloc failed");
+  800f12:	83 ec 04             	sub    $0x4,%esp
+  800f15:	68 6f 2d 80 00       	push   $0x802d6f
+  800f1a:	6a 2a                	push   $0x2a
+  800f1c:	68 fc 2c 80 00       	push   $0x802cfc
+  800f21:	e8 55 13 00 00       	call   80227b <_panic>
+        panic("sys_page_map failed");
+  800f26:	83 ec 04             	sub    $0x4,%esp
+  800f29:	68 07 2d 80 00       	push   $0x802d07
+  800f2e:	6a 30                	push   $0x30
+  800f30:	68 fc 2c 80 00       	push   $0x802cfc
+  800f35:	e8 41 13 00 00       	call   80227b <_panic>
+        panic("sys_page_unmap failed");
+  800f3a:	83 ec 04             	sub    $0x4,%esp
+  800f3d:	68 1b 2d 80 00       	push   $0x802d1b
+  800f42:	6a 32                	push   $0x32
+  800f44:	68 fc 2c 80 00       	push   $0x802cfc
+  800f49:	e8 2d 13 00 00       	call   80227b <_panic>
+
+00800f4e <fork>:
+//   Remember to fix "thisenv" in the child process.
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void) {
+  800f4e:	55                   	push   %ebp
+  800f4f:	89 e5                	mov    %esp,%ebp
+  800f51:	57                   	push   %edi
+  800f52:	56                   	push   %esi
+  800f53:	53                   	push   %ebx
+  800f54:	83 ec 18             	sub    $0x18,%esp
+    // LAB 4: Your code here.
+    set_pgfault_handler(pgfault);
+  800f57:	68 53 0e 80 00       	push   $0x800e53
+  800f5c:	e8 60 13 00 00       	call   8022c1 <set_pgfault_handler>
+
+// This must be inlined.  Exercise for reader: why?
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+  envid_t ret;
+  asm volatile("int %2"
+  800f61:	b8 07 00 00 00       	mov    $0x7,%eax
+  800f66:	cd 30                	int    $0x30
+  800f68:	89 c6                	mov    %eax,%esi
+
+    envid_t envid = sys_exofork();
+    if (envid < 0)
+  800f6a:	83 c4 10             	add    $0x10,%esp
+  800f6d:	85 c0                	test   %eax,%eax
+  800f6f:	78 2a                	js     800f9b <fork+0x4d>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+
+    uintptr_t addr;
+    for (addr = 0; addr < UTOP; addr += PGSIZE) {
+  800f71:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (envid == 0) {
+  800f76:	0f 85 a2 00 00 00    	jne    80101e <fork+0xd0>
+        thisenv = &envs[ENVX(sys_getenvid())];
+  800f7c:	e8 c1 fb ff ff       	call   800b42 <sys_getenvid>
+  800f81:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800f86:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800f89:	c1 e0 04             	shl    $0x4,%eax
+  800f8c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800f91:	a3 08 40 80 00       	mov    %eax,0x804008
+        return 0;
+  800f96:	e9 6c 01 00 00       	jmp    801107 <fork+0x1b9>
+        panic("fork: sys_exofork error: %e", envid);
+  800f9b:	50                   	push   %eax
+  800f9c:	68 31 2d 80 00       	push   $0x802d31
+  800fa1:	6a 6f                	push   $0x6f
+  800fa3:	68 fc 2c 80 00       	push   $0x802cfc
+  800fa8:	e8 ce 12 00 00       	call   80227b <_panic>
+        if ((r = sys_page_map(0, vptr, envid, vptr, uvpt[pn] & PTE_SYSCALL)) < 0)
+  800fad:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800fb4:	83 ec 0c             	sub    $0xc,%esp
+  800fb7:	25 07 0e 00 00       	and    $0xe07,%eax
+  800fbc:	50                   	push   %eax
+  800fbd:	57                   	push   %edi
+  800fbe:	56                   	push   %esi
+  800fbf:	57                   	push   %edi
+  800fc0:	6a 00                	push   $0x0
+  800fc2:	e8 fc fb ff ff       	call   800bc3 <sys_page_map>
+  800fc7:	83 c4 20             	add    $0x20,%esp
+  800fca:	85 c0                	test   %eax,%eax
+  800fcc:	79 3e                	jns    80100c <fork+0xbe>
+            panic("duppage :in sys_page_map %e", r);
+  800fce:	50                   	push   %eax
+  800fcf:	68 4d 2d 80 00       	push   $0x802d4d
+  800fd4:	6a 49                	push   $0x49
+  800fd6:	68 fc 2c 80 00       	push   $0x802cfc
+  800fdb:	e8 9b 12 00 00       	call   80227b <_panic>
+            panic("duppage :in sys_page_map %e", r);
+  800fe0:	50                   	push   %eax
+  800fe1:	68 4d 2d 80 00       	push   $0x802d4d
+  800fe6:	6a 4e                	push   $0x4e
+  800fe8:	68 fc 2c 80 00       	push   $0x802cfc
+  800fed:	e8 89 12 00 00       	call   80227b <_panic>
+    } else if ((r = sys_page_map(0, vptr, envid, vptr, PTE_P | PTE_U)) < 0)
+  800ff2:	83 ec 0c             	sub    $0xc,%esp
+  800ff5:	6a 05                	push   $0x5
+  800ff7:	57                   	push   %edi
+  800ff8:	56                   	push   %esi
+  800ff9:	57                   	push   %edi
+  800ffa:	6a 00                	push   $0x0
+  800ffc:	e8 c2 fb ff ff       	call   800bc3 <sys_page_map>
+  801001:	83 c4 20             	add    $0x20,%esp
+  801004:	85 c0                	test   %eax,%eax
+  801006:	0f 88 ab 00 00 00    	js     8010b7 <fork+0x169>
+    for (addr = 0; addr < UTOP; addr += PGSIZE) {
+  80100c:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801012:	81 fb 00 00 c0 ee    	cmp    $0xeec00000,%ebx
+  801018:	0f 84 ab 00 00 00    	je     8010c9 <fork+0x17b>
+        if (uvpd[PDX(addr)] & PTE_P && uvpt[PGNUM(addr)] & PTE_P && addr != UXSTACKTOP - PGSIZE) {
+  80101e:	89 d8                	mov    %ebx,%eax
+  801020:	c1 e8 16             	shr    $0x16,%eax
+  801023:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80102a:	a8 01                	test   $0x1,%al
+  80102c:	74 de                	je     80100c <fork+0xbe>
+  80102e:	89 d8                	mov    %ebx,%eax
+  801030:	c1 e8 0c             	shr    $0xc,%eax
+  801033:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80103a:	f6 c2 01             	test   $0x1,%dl
+  80103d:	74 cd                	je     80100c <fork+0xbe>
+  80103f:	81 fb 00 f0 bf ee    	cmp    $0xeebff000,%ebx
+  801045:	74 c5                	je     80100c <fork+0xbe>
+    void *vptr = (void *) (pn * PGSIZE);
+  801047:	89 c7                	mov    %eax,%edi
+  801049:	c1 e7 0c             	shl    $0xc,%edi
+    if (uvpt[pn] & PTE_SHARE) {
+  80104c:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801053:	f6 c6 04             	test   $0x4,%dh
+  801056:	0f 85 51 ff ff ff    	jne    800fad <fork+0x5f>
+    } else if (uvpt[pn] & (PTE_W | PTE_COW)) {
+  80105c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801063:	a9 02 08 00 00       	test   $0x802,%eax
+  801068:	74 88                	je     800ff2 <fork+0xa4>
+        if ((r = sys_page_map(0, vptr, envid, vptr, PTE_P | PTE_U | PTE_COW)) < 0)
+  80106a:	83 ec 0c             	sub    $0xc,%esp
+  80106d:	68 05 08 00 00       	push   $0x805
+  801072:	57                   	push   %edi
+  801073:	56                   	push   %esi
+  801074:	57                   	push   %edi
+  801075:	6a 00                	push   $0x0
+  801077:	e8 47 fb ff ff       	call   800bc3 <sys_page_map>
+  80107c:	83 c4 20             	add    $0x20,%esp
+  80107f:	85 c0                	test   %eax,%eax
+  801081:	0f 88 59 ff ff ff    	js     800fe0 <fork+0x92>
+        if ((r = sys_page_map(0, vptr, 0, vptr, PTE_P | PTE_U | PTE_COW)) < 0)
+  801087:	83 ec 0c             	sub    $0xc,%esp
+  80108a:	68 05 08 00 00       	push   $0x805
+  80108f:	57                   	push   %edi
+  801090:	6a 00                	push   $0x0
+  801092:	57                   	push   %edi
+  801093:	6a 00                	push   $0x0
+  801095:	e8 29 fb ff ff       	call   800bc3 <sys_page_map>
+  80109a:	83 c4 20             	add    $0x20,%esp
+  80109d:	85 c0                	test   %eax,%eax
+  80109f:	0f 89 67 ff ff ff    	jns    80100c <fork+0xbe>
+            panic("duppage :in sys_page_map %e", r);
+  8010a5:	50                   	push   %eax
+  8010a6:	68 4d 2d 80 00       	push   $0x802d4d
+  8010ab:	6a 50                	push   $0x50
+  8010ad:	68 fc 2c 80 00       	push   $0x802cfc
+  8010b2:	e8 c4 11 00 00       	call   80227b <_panic>
+        panic("duppage :in sys_page_map %e", r);
+  8010b7:	50                   	push   %eax
+  8010b8:	68 4d 2d 80 00       	push   $0x802d4d
+  8010bd:	6a 53                	push   $0x53
+  8010bf:	68 fc 2c 80 00       	push   $0x802cfc
+  8010c4:	e8 b2 11 00 00       	call   80227b <_panic>
+            duppage(envid, PGNUM(addr));
+        }
+    }
+    if (sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W))
+  8010c9:	83 ec 04             	sub    $0x4,%esp
+  8010cc:	6a 07                	push   $0x7
+  8010ce:	68 00 f0 bf ee       	push   $0xeebff000
+  8010d3:	56                   	push   %esi
+  8010d4:	e8 a7 fa ff ff       	call   800b80 <sys_page_alloc>
+  8010d9:	83 c4 10             	add    $0x10,%esp
+  8010dc:	85 c0                	test   %eax,%eax
+  8010de:	75 31                	jne    801111 <fork+0x1c3>
+        panic("fork: sys_page_alloc failed");
+    if (sys_env_set_pgfault_upcall(envid, _pgfault_upcall))
+  8010e0:	83 ec 08             	sub    $0x8,%esp
+  8010e3:	68 2c 23 80 00       	push   $0x80232c
+  8010e8:	56                   	push   %esi
+  8010e9:	e8 dd fb ff ff       	call   800ccb <sys_env_set_pgfault_upcall>
+  8010ee:	83 c4 10             	add    $0x10,%esp
+  8010f1:	85 c0                	test   %eax,%eax
+  8010f3:	75 30                	jne    801125 <fork+0x1d7>
+        panic("fork: sys_env_set_pgfault_upcall failed");
+    if (sys_env_set_status(envid, ENV_RUNNABLE))
+  8010f5:	83 ec 08             	sub    $0x8,%esp
+  8010f8:	6a 02                	push   $0x2
+  8010fa:	56                   	push   %esi
+  8010fb:	e8 47 fb ff ff       	call   800c47 <sys_env_set_status>
+  801100:	83 c4 10             	add    $0x10,%esp
+  801103:	85 c0                	test   %eax,%eax
+  801105:	75 32                	jne    801139 <fork+0x1eb>
+        panic("fork: sys_env_set_status failed");
+
+    return envid;
+
+}
+  801107:	89 f0                	mov    %esi,%eax
+  801109:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80110c:	5b                   	pop    %ebx
+  80110d:	5e                   	pop    %esi
+  80110e:	5f                   	pop    %edi
+  80110f:	5d                   	pop    %ebp
+  801110:	c3                   	ret
+        panic("fork: sys_page_alloc failed");
+  801111:	83 ec 04             	sub    $0x4,%esp
+  801114:	68 69 2d 80 00       	push   $0x802d69
+  801119:	6a 7d                	push   $0x7d
+  80111b:	68 fc 2c 80 00       	push   $0x802cfc
+  801120:	e8 56 11 00 00       	call   80227b <_panic>
+        panic("fork: sys_env_set_pgfault_upcall failed");
+  801125:	83 ec 04             	sub    $0x4,%esp
+  801128:	68 b4 2c 80 00       	push   $0x802cb4
+  80112d:	6a 7f                	push   $0x7f
+  80112f:	68 fc 2c 80 00       	push   $0x802cfc
+  801134:	e8 42 11 00 00       	call   80227b <_panic>
+        panic("fork: sys_env_set_status failed");
+  801139:	83 ec 04             	sub    $0x4,%esp
+  80113c:	68 dc 2c 80 00       	push   $0x802cdc
+  801141:	68 81 00 00 00       	push   $0x81
+  801146:	68 fc 2c 80 00       	push   $0x802cfc
+  80114b:	e8 2b 11 00 00       	call   80227b <_panic>
+
+00801150 <sfork>:
+
+// Challenge!
+int
+sfork(void) {
+  801150:	55                   	push   %ebp
+  801151:	89 e5                	mov    %esp,%ebp
+  801153:	83 ec 0c             	sub    $0xc,%esp
+    panic("sfork not implemented");
+  801156:	68 85 2d 80 00       	push   $0x802d85
+  80115b:	68 8a 00 00 00       	push   $0x8a
+  801160:	68 fc 2c 80 00       	push   $0x802cfc
+  801165:	e8 11 11 00 00       	call   80227b <_panic>
+
+0080116a <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80116a:	55                   	push   %ebp
+  80116b:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80116d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801170:	05 00 00 00 30       	add    $0x30000000,%eax
+  801175:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801178:	5d                   	pop    %ebp
+  801179:	c3                   	ret
+
+0080117a <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80117a:	55                   	push   %ebp
+  80117b:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80117d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801180:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801185:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80118a:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80118f:	5d                   	pop    %ebp
+  801190:	c3                   	ret
+
+00801191 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801191:	55                   	push   %ebp
+  801192:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801194:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801199:	eb 02                	jmp    80119d <fd_alloc+0xc>
+  80119b:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80119d:	89 c2                	mov    %eax,%edx
+  80119f:	c1 ea 16             	shr    $0x16,%edx
+  8011a2:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8011a9:	f6 c2 01             	test   $0x1,%dl
+  8011ac:	74 2b                	je     8011d9 <fd_alloc+0x48>
+  8011ae:	89 c2                	mov    %eax,%edx
+  8011b0:	c1 ea 0c             	shr    $0xc,%edx
+  8011b3:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8011ba:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8011c0:	f6 c1 01             	test   $0x1,%cl
+  8011c3:	74 14                	je     8011d9 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8011c5:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8011cb:	75 ce                	jne    80119b <fd_alloc+0xa>
+  8011cd:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8011d2:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8011d7:	eb 05                	jmp    8011de <fd_alloc+0x4d>
+			return 0;
+  8011d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8011de:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011e1:	89 02                	mov    %eax,(%edx)
+}
+  8011e3:	89 c8                	mov    %ecx,%eax
+  8011e5:	5d                   	pop    %ebp
+  8011e6:	c3                   	ret
+
+008011e7 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8011e7:	55                   	push   %ebp
+  8011e8:	89 e5                	mov    %esp,%ebp
+  8011ea:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8011ed:	83 f8 1f             	cmp    $0x1f,%eax
+  8011f0:	77 30                	ja     801222 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8011f2:	c1 e0 0c             	shl    $0xc,%eax
+  8011f5:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8011fa:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801200:	f6 c2 01             	test   $0x1,%dl
+  801203:	74 24                	je     801229 <fd_lookup+0x42>
+  801205:	89 c2                	mov    %eax,%edx
+  801207:	c1 ea 0c             	shr    $0xc,%edx
+  80120a:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801211:	f6 c2 01             	test   $0x1,%dl
+  801214:	74 1a                	je     801230 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801216:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801219:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80121b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801220:	5d                   	pop    %ebp
+  801221:	c3                   	ret
+		return -E_INVAL;
+  801222:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801227:	eb f7                	jmp    801220 <fd_lookup+0x39>
+		return -E_INVAL;
+  801229:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80122e:	eb f0                	jmp    801220 <fd_lookup+0x39>
+  801230:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801235:	eb e9                	jmp    801220 <fd_lookup+0x39>
+
+00801237 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801237:	55                   	push   %ebp
+  801238:	89 e5                	mov    %esp,%ebp
+  80123a:	53                   	push   %ebx
+  80123b:	83 ec 04             	sub    $0x4,%esp
+  80123e:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801241:	b8 00 00 00 00       	mov    $0x0,%eax
+  801246:	eb 03                	jmp    80124b <dev_lookup+0x14>
+  801248:	83 c0 01             	add    $0x1,%eax
+  80124b:	8b 1c 85 18 2e 80 00 	mov    0x802e18(,%eax,4),%ebx
+  801252:	85 db                	test   %ebx,%ebx
+  801254:	74 0b                	je     801261 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801256:	39 13                	cmp    %edx,(%ebx)
+  801258:	75 ee                	jne    801248 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  80125a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80125f:	eb 1f                	jmp    801280 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801261:	a1 08 40 80 00       	mov    0x804008,%eax
+  801266:	8b 40 48             	mov    0x48(%eax),%eax
+  801269:	83 ec 04             	sub    $0x4,%esp
+  80126c:	52                   	push   %edx
+  80126d:	50                   	push   %eax
+  80126e:	68 9c 2d 80 00       	push   $0x802d9c
+  801273:	e8 63 ef ff ff       	call   8001db <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801278:	83 c4 10             	add    $0x10,%esp
+  80127b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801280:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801283:	89 1a                	mov    %ebx,(%edx)
+}
+  801285:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801288:	c9                   	leave
+  801289:	c3                   	ret
+
+0080128a <fd_close>:
+{
+  80128a:	55                   	push   %ebp
+  80128b:	89 e5                	mov    %esp,%ebp
+  80128d:	57                   	push   %edi
+  80128e:	56                   	push   %esi
+  80128f:	53                   	push   %ebx
+  801290:	83 ec 24             	sub    $0x24,%esp
+  801293:	8b 75 08             	mov    0x8(%ebp),%esi
+  801296:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801299:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80129c:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80129d:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8012a3:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8012a6:	50                   	push   %eax
+  8012a7:	e8 3b ff ff ff       	call   8011e7 <fd_lookup>
+  8012ac:	89 c3                	mov    %eax,%ebx
+  8012ae:	83 c4 10             	add    $0x10,%esp
+  8012b1:	85 c0                	test   %eax,%eax
+  8012b3:	78 05                	js     8012ba <fd_close+0x30>
+	    || fd != fd2)
+  8012b5:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8012b8:	74 16                	je     8012d0 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8012ba:	89 f8                	mov    %edi,%eax
+  8012bc:	84 c0                	test   %al,%al
+  8012be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012c3:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8012c6:	89 d8                	mov    %ebx,%eax
+  8012c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012cb:	5b                   	pop    %ebx
+  8012cc:	5e                   	pop    %esi
+  8012cd:	5f                   	pop    %edi
+  8012ce:	5d                   	pop    %ebp
+  8012cf:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8012d0:	83 ec 08             	sub    $0x8,%esp
+  8012d3:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8012d6:	50                   	push   %eax
+  8012d7:	ff 36                	push   (%esi)
+  8012d9:	e8 59 ff ff ff       	call   801237 <dev_lookup>
+  8012de:	89 c3                	mov    %eax,%ebx
+  8012e0:	83 c4 10             	add    $0x10,%esp
+  8012e3:	85 c0                	test   %eax,%eax
+  8012e5:	78 1a                	js     801301 <fd_close+0x77>
+		if (dev->dev_close)
+  8012e7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8012ea:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8012ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8012f2:	85 c0                	test   %eax,%eax
+  8012f4:	74 0b                	je     801301 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8012f6:	83 ec 0c             	sub    $0xc,%esp
+  8012f9:	56                   	push   %esi
+  8012fa:	ff d0                	call   *%eax
+  8012fc:	89 c3                	mov    %eax,%ebx
+  8012fe:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801301:	83 ec 08             	sub    $0x8,%esp
+  801304:	56                   	push   %esi
+  801305:	6a 00                	push   $0x0
+  801307:	e8 f9 f8 ff ff       	call   800c05 <sys_page_unmap>
+	return r;
+  80130c:	83 c4 10             	add    $0x10,%esp
+  80130f:	eb b5                	jmp    8012c6 <fd_close+0x3c>
+
+00801311 <close>:
+
+int
+close(int fdnum)
+{
+  801311:	55                   	push   %ebp
+  801312:	89 e5                	mov    %esp,%ebp
+  801314:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801317:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80131a:	50                   	push   %eax
+  80131b:	ff 75 08             	push   0x8(%ebp)
+  80131e:	e8 c4 fe ff ff       	call   8011e7 <fd_lookup>
+  801323:	83 c4 10             	add    $0x10,%esp
+  801326:	85 c0                	test   %eax,%eax
+  801328:	79 02                	jns    80132c <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80132a:	c9                   	leave
+  80132b:	c3                   	ret
+		return fd_close(fd, 1);
+  80132c:	83 ec 08             	sub    $0x8,%esp
+  80132f:	6a 01                	push   $0x1
+  801331:	ff 75 f4             	push   -0xc(%ebp)
+  801334:	e8 51 ff ff ff       	call   80128a <fd_close>
+  801339:	83 c4 10             	add    $0x10,%esp
+  80133c:	eb ec                	jmp    80132a <close+0x19>
+
+0080133e <close_all>:
+
+void
+close_all(void)
+{
+  80133e:	55                   	push   %ebp
+  80133f:	89 e5                	mov    %esp,%ebp
+  801341:	53                   	push   %ebx
+  801342:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801345:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80134a:	83 ec 0c             	sub    $0xc,%esp
+  80134d:	53                   	push   %ebx
+  80134e:	e8 be ff ff ff       	call   801311 <close>
+	for (i = 0; i < MAXFD; i++)
+  801353:	83 c3 01             	add    $0x1,%ebx
+  801356:	83 c4 10             	add    $0x10,%esp
+  801359:	83 fb 20             	cmp    $0x20,%ebx
+  80135c:	75 ec                	jne    80134a <close_all+0xc>
+}
+  80135e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801361:	c9                   	leave
+  801362:	c3                   	ret
+
+00801363 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801363:	55                   	push   %ebp
+  801364:	89 e5                	mov    %esp,%ebp
+  801366:	57                   	push   %edi
+  801367:	56                   	push   %esi
+  801368:	53                   	push   %ebx
+  801369:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80136c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80136f:	50                   	push   %eax
+  801370:	ff 75 08             	push   0x8(%ebp)
+  801373:	e8 6f fe ff ff       	call   8011e7 <fd_lookup>
+  801378:	89 c3                	mov    %eax,%ebx
+  80137a:	83 c4 10             	add    $0x10,%esp
+  80137d:	85 c0                	test   %eax,%eax
+  80137f:	78 7f                	js     801400 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801381:	83 ec 0c             	sub    $0xc,%esp
+  801384:	ff 75 0c             	push   0xc(%ebp)
+  801387:	e8 85 ff ff ff       	call   801311 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80138c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80138f:	c1 e6 0c             	shl    $0xc,%esi
+  801392:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801398:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80139b:	89 3c 24             	mov    %edi,(%esp)
+  80139e:	e8 d7 fd ff ff       	call   80117a <fd2data>
+  8013a3:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8013a5:	89 34 24             	mov    %esi,(%esp)
+  8013a8:	e8 cd fd ff ff       	call   80117a <fd2data>
+  8013ad:	83 c4 10             	add    $0x10,%esp
+  8013b0:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8013b3:	89 d8                	mov    %ebx,%eax
+  8013b5:	c1 e8 16             	shr    $0x16,%eax
+  8013b8:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8013bf:	a8 01                	test   $0x1,%al
+  8013c1:	74 11                	je     8013d4 <dup+0x71>
+  8013c3:	89 d8                	mov    %ebx,%eax
+  8013c5:	c1 e8 0c             	shr    $0xc,%eax
+  8013c8:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8013cf:	f6 c2 01             	test   $0x1,%dl
+  8013d2:	75 36                	jne    80140a <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8013d4:	89 f8                	mov    %edi,%eax
+  8013d6:	c1 e8 0c             	shr    $0xc,%eax
+  8013d9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8013e0:	83 ec 0c             	sub    $0xc,%esp
+  8013e3:	25 07 0e 00 00       	and    $0xe07,%eax
+  8013e8:	50                   	push   %eax
+  8013e9:	56                   	push   %esi
+  8013ea:	6a 00                	push   $0x0
+  8013ec:	57                   	push   %edi
+  8013ed:	6a 00                	push   $0x0
+  8013ef:	e8 cf f7 ff ff       	call   800bc3 <sys_page_map>
+  8013f4:	89 c3                	mov    %eax,%ebx
+  8013f6:	83 c4 20             	add    $0x20,%esp
+  8013f9:	85 c0                	test   %eax,%eax
+  8013fb:	78 33                	js     801430 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8013fd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801400:	89 d8                	mov    %ebx,%eax
+  801402:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801405:	5b                   	pop    %ebx
+  801406:	5e                   	pop    %esi
+  801407:	5f                   	pop    %edi
+  801408:	5d                   	pop    %ebp
+  801409:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80140a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801411:	83 ec 0c             	sub    $0xc,%esp
+  801414:	25 07 0e 00 00       	and    $0xe07,%eax
+  801419:	50                   	push   %eax
+  80141a:	ff 75 d4             	push   -0x2c(%ebp)
+  80141d:	6a 00                	push   $0x0
+  80141f:	53                   	push   %ebx
+  801420:	6a 00                	push   $0x0
+  801422:	e8 9c f7 ff ff       	call   800bc3 <sys_page_map>
+  801427:	89 c3                	mov    %eax,%ebx
+  801429:	83 c4 20             	add    $0x20,%esp
+  80142c:	85 c0                	test   %eax,%eax
+  80142e:	79 a4                	jns    8013d4 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801430:	83 ec 08             	sub    $0x8,%esp
+  801433:	56                   	push   %esi
+  801434:	6a 00                	push   $0x0
+  801436:	e8 ca f7 ff ff       	call   800c05 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  80143b:	83 c4 08             	add    $0x8,%esp
+  80143e:	ff 75 d4             	push   -0x2c(%ebp)
+  801441:	6a 00                	push   $0x0
+  801443:	e8 bd f7 ff ff       	call   800c05 <sys_page_unmap>
+	return r;
+  801448:	83 c4 10             	add    $0x10,%esp
+  80144b:	eb b3                	jmp    801400 <dup+0x9d>
+
+0080144d <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80144d:	55                   	push   %ebp
+  80144e:	89 e5                	mov    %esp,%ebp
+  801450:	56                   	push   %esi
+  801451:	53                   	push   %ebx
+  801452:	83 ec 18             	sub    $0x18,%esp
+  801455:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801458:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80145b:	50                   	push   %eax
+  80145c:	56                   	push   %esi
+  80145d:	e8 85 fd ff ff       	call   8011e7 <fd_lookup>
+  801462:	83 c4 10             	add    $0x10,%esp
+  801465:	85 c0                	test   %eax,%eax
+  801467:	78 3c                	js     8014a5 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801469:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80146c:	83 ec 08             	sub    $0x8,%esp
+  80146f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801472:	50                   	push   %eax
+  801473:	ff 33                	push   (%ebx)
+  801475:	e8 bd fd ff ff       	call   801237 <dev_lookup>
+  80147a:	83 c4 10             	add    $0x10,%esp
+  80147d:	85 c0                	test   %eax,%eax
+  80147f:	78 24                	js     8014a5 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801481:	8b 43 08             	mov    0x8(%ebx),%eax
+  801484:	83 e0 03             	and    $0x3,%eax
+  801487:	83 f8 01             	cmp    $0x1,%eax
+  80148a:	74 20                	je     8014ac <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80148c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80148f:	8b 40 08             	mov    0x8(%eax),%eax
+  801492:	85 c0                	test   %eax,%eax
+  801494:	74 37                	je     8014cd <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801496:	83 ec 04             	sub    $0x4,%esp
+  801499:	ff 75 10             	push   0x10(%ebp)
+  80149c:	ff 75 0c             	push   0xc(%ebp)
+  80149f:	53                   	push   %ebx
+  8014a0:	ff d0                	call   *%eax
+  8014a2:	83 c4 10             	add    $0x10,%esp
+}
+  8014a5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014a8:	5b                   	pop    %ebx
+  8014a9:	5e                   	pop    %esi
+  8014aa:	5d                   	pop    %ebp
+  8014ab:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8014ac:	a1 08 40 80 00       	mov    0x804008,%eax
+  8014b1:	8b 40 48             	mov    0x48(%eax),%eax
+  8014b4:	83 ec 04             	sub    $0x4,%esp
+  8014b7:	56                   	push   %esi
+  8014b8:	50                   	push   %eax
+  8014b9:	68 dd 2d 80 00       	push   $0x802ddd
+  8014be:	e8 18 ed ff ff       	call   8001db <cprintf>
+		return -E_INVAL;
+  8014c3:	83 c4 10             	add    $0x10,%esp
+  8014c6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014cb:	eb d8                	jmp    8014a5 <read+0x58>
+		return -E_NOT_SUPP;
+  8014cd:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8014d2:	eb d1                	jmp    8014a5 <read+0x58>
+
+008014d4 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8014d4:	55                   	push   %ebp
+  8014d5:	89 e5                	mov    %esp,%ebp
+  8014d7:	57                   	push   %edi
+  8014d8:	56                   	push   %esi
+  8014d9:	53                   	push   %ebx
+  8014da:	83 ec 0c             	sub    $0xc,%esp
+  8014dd:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8014e0:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8014e3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014e8:	eb 02                	jmp    8014ec <readn+0x18>
+  8014ea:	01 c3                	add    %eax,%ebx
+  8014ec:	39 f3                	cmp    %esi,%ebx
+  8014ee:	73 21                	jae    801511 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8014f0:	83 ec 04             	sub    $0x4,%esp
+  8014f3:	89 f0                	mov    %esi,%eax
+  8014f5:	29 d8                	sub    %ebx,%eax
+  8014f7:	50                   	push   %eax
+  8014f8:	89 d8                	mov    %ebx,%eax
+  8014fa:	03 45 0c             	add    0xc(%ebp),%eax
+  8014fd:	50                   	push   %eax
+  8014fe:	57                   	push   %edi
+  8014ff:	e8 49 ff ff ff       	call   80144d <read>
+		if (m < 0)
+  801504:	83 c4 10             	add    $0x10,%esp
+  801507:	85 c0                	test   %eax,%eax
+  801509:	78 04                	js     80150f <readn+0x3b>
+			return m;
+		if (m == 0)
+  80150b:	75 dd                	jne    8014ea <readn+0x16>
+  80150d:	eb 02                	jmp    801511 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80150f:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801511:	89 d8                	mov    %ebx,%eax
+  801513:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801516:	5b                   	pop    %ebx
+  801517:	5e                   	pop    %esi
+  801518:	5f                   	pop    %edi
+  801519:	5d                   	pop    %ebp
+  80151a:	c3                   	ret
+
+0080151b <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80151b:	55                   	push   %ebp
+  80151c:	89 e5                	mov    %esp,%ebp
+  80151e:	56                   	push   %esi
+  80151f:	53                   	push   %ebx
+  801520:	83 ec 18             	sub    $0x18,%esp
+  801523:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801526:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801529:	50                   	push   %eax
+  80152a:	53                   	push   %ebx
+  80152b:	e8 b7 fc ff ff       	call   8011e7 <fd_lookup>
+  801530:	83 c4 10             	add    $0x10,%esp
+  801533:	85 c0                	test   %eax,%eax
+  801535:	78 37                	js     80156e <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801537:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80153a:	83 ec 08             	sub    $0x8,%esp
+  80153d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801540:	50                   	push   %eax
+  801541:	ff 36                	push   (%esi)
+  801543:	e8 ef fc ff ff       	call   801237 <dev_lookup>
+  801548:	83 c4 10             	add    $0x10,%esp
+  80154b:	85 c0                	test   %eax,%eax
+  80154d:	78 1f                	js     80156e <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80154f:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801553:	74 20                	je     801575 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801555:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801558:	8b 40 0c             	mov    0xc(%eax),%eax
+  80155b:	85 c0                	test   %eax,%eax
+  80155d:	74 37                	je     801596 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80155f:	83 ec 04             	sub    $0x4,%esp
+  801562:	ff 75 10             	push   0x10(%ebp)
+  801565:	ff 75 0c             	push   0xc(%ebp)
+  801568:	56                   	push   %esi
+  801569:	ff d0                	call   *%eax
+  80156b:	83 c4 10             	add    $0x10,%esp
+}
+  80156e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801571:	5b                   	pop    %ebx
+  801572:	5e                   	pop    %esi
+  801573:	5d                   	pop    %ebp
+  801574:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801575:	a1 08 40 80 00       	mov    0x804008,%eax
+  80157a:	8b 40 48             	mov    0x48(%eax),%eax
+  80157d:	83 ec 04             	sub    $0x4,%esp
+  801580:	53                   	push   %ebx
+  801581:	50                   	push   %eax
+  801582:	68 f9 2d 80 00       	push   $0x802df9
+  801587:	e8 4f ec ff ff       	call   8001db <cprintf>
+		return -E_INVAL;
+  80158c:	83 c4 10             	add    $0x10,%esp
+  80158f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801594:	eb d8                	jmp    80156e <write+0x53>
+		return -E_NOT_SUPP;
+  801596:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80159b:	eb d1                	jmp    80156e <write+0x53>
+
+0080159d <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80159d:	55                   	push   %ebp
+  80159e:	89 e5                	mov    %esp,%ebp
+  8015a0:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8015a3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015a6:	50                   	push   %eax
+  8015a7:	ff 75 08             	push   0x8(%ebp)
+  8015aa:	e8 38 fc ff ff       	call   8011e7 <fd_lookup>
+  8015af:	83 c4 10             	add    $0x10,%esp
+  8015b2:	85 c0                	test   %eax,%eax
+  8015b4:	78 0e                	js     8015c4 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8015b6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8015b9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015bc:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8015bf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015c4:	c9                   	leave
+  8015c5:	c3                   	ret
+
+008015c6 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8015c6:	55                   	push   %ebp
+  8015c7:	89 e5                	mov    %esp,%ebp
+  8015c9:	56                   	push   %esi
+  8015ca:	53                   	push   %ebx
+  8015cb:	83 ec 18             	sub    $0x18,%esp
+  8015ce:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015d1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8015d4:	50                   	push   %eax
+  8015d5:	53                   	push   %ebx
+  8015d6:	e8 0c fc ff ff       	call   8011e7 <fd_lookup>
+  8015db:	83 c4 10             	add    $0x10,%esp
+  8015de:	85 c0                	test   %eax,%eax
+  8015e0:	78 34                	js     801616 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8015e2:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8015e5:	83 ec 08             	sub    $0x8,%esp
+  8015e8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015eb:	50                   	push   %eax
+  8015ec:	ff 36                	push   (%esi)
+  8015ee:	e8 44 fc ff ff       	call   801237 <dev_lookup>
+  8015f3:	83 c4 10             	add    $0x10,%esp
+  8015f6:	85 c0                	test   %eax,%eax
+  8015f8:	78 1c                	js     801616 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8015fa:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8015fe:	74 1d                	je     80161d <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801600:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801603:	8b 40 18             	mov    0x18(%eax),%eax
+  801606:	85 c0                	test   %eax,%eax
+  801608:	74 34                	je     80163e <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80160a:	83 ec 08             	sub    $0x8,%esp
+  80160d:	ff 75 0c             	push   0xc(%ebp)
+  801610:	56                   	push   %esi
+  801611:	ff d0                	call   *%eax
+  801613:	83 c4 10             	add    $0x10,%esp
+}
+  801616:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801619:	5b                   	pop    %ebx
+  80161a:	5e                   	pop    %esi
+  80161b:	5d                   	pop    %ebp
+  80161c:	c3                   	ret
+			thisenv->env_id, fdnum);
+  80161d:	a1 08 40 80 00       	mov    0x804008,%eax
+  801622:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801625:	83 ec 04             	sub    $0x4,%esp
+  801628:	53                   	push   %ebx
+  801629:	50                   	push   %eax
+  80162a:	68 bc 2d 80 00       	push   $0x802dbc
+  80162f:	e8 a7 eb ff ff       	call   8001db <cprintf>
+		return -E_INVAL;
+  801634:	83 c4 10             	add    $0x10,%esp
+  801637:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80163c:	eb d8                	jmp    801616 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  80163e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801643:	eb d1                	jmp    801616 <ftruncate+0x50>
+
+00801645 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801645:	55                   	push   %ebp
+  801646:	89 e5                	mov    %esp,%ebp
+  801648:	56                   	push   %esi
+  801649:	53                   	push   %ebx
+  80164a:	83 ec 18             	sub    $0x18,%esp
+  80164d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801650:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801653:	50                   	push   %eax
+  801654:	ff 75 08             	push   0x8(%ebp)
+  801657:	e8 8b fb ff ff       	call   8011e7 <fd_lookup>
+  80165c:	83 c4 10             	add    $0x10,%esp
+  80165f:	85 c0                	test   %eax,%eax
+  801661:	78 49                	js     8016ac <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801663:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801666:	83 ec 08             	sub    $0x8,%esp
+  801669:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80166c:	50                   	push   %eax
+  80166d:	ff 36                	push   (%esi)
+  80166f:	e8 c3 fb ff ff       	call   801237 <dev_lookup>
+  801674:	83 c4 10             	add    $0x10,%esp
+  801677:	85 c0                	test   %eax,%eax
+  801679:	78 31                	js     8016ac <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  80167b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80167e:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801682:	74 2f                	je     8016b3 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801684:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801687:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80168e:	00 00 00 
+	stat->st_isdir = 0;
+  801691:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801698:	00 00 00 
+	stat->st_dev = dev;
+  80169b:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8016a1:	83 ec 08             	sub    $0x8,%esp
+  8016a4:	53                   	push   %ebx
+  8016a5:	56                   	push   %esi
+  8016a6:	ff 50 14             	call   *0x14(%eax)
+  8016a9:	83 c4 10             	add    $0x10,%esp
+}
+  8016ac:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016af:	5b                   	pop    %ebx
+  8016b0:	5e                   	pop    %esi
+  8016b1:	5d                   	pop    %ebp
+  8016b2:	c3                   	ret
+		return -E_NOT_SUPP;
+  8016b3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016b8:	eb f2                	jmp    8016ac <fstat+0x67>
+
+008016ba <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8016ba:	55                   	push   %ebp
+  8016bb:	89 e5                	mov    %esp,%ebp
+  8016bd:	56                   	push   %esi
+  8016be:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8016bf:	83 ec 08             	sub    $0x8,%esp
+  8016c2:	6a 00                	push   $0x0
+  8016c4:	ff 75 08             	push   0x8(%ebp)
+  8016c7:	e8 e4 01 00 00       	call   8018b0 <open>
+  8016cc:	89 c3                	mov    %eax,%ebx
+  8016ce:	83 c4 10             	add    $0x10,%esp
+  8016d1:	85 c0                	test   %eax,%eax
+  8016d3:	78 1b                	js     8016f0 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8016d5:	83 ec 08             	sub    $0x8,%esp
+  8016d8:	ff 75 0c             	push   0xc(%ebp)
+  8016db:	50                   	push   %eax
+  8016dc:	e8 64 ff ff ff       	call   801645 <fstat>
+  8016e1:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8016e3:	89 1c 24             	mov    %ebx,(%esp)
+  8016e6:	e8 26 fc ff ff       	call   801311 <close>
+	return r;
+  8016eb:	83 c4 10             	add    $0x10,%esp
+  8016ee:	89 f3                	mov    %esi,%ebx
+}
+  8016f0:	89 d8                	mov    %ebx,%eax
+  8016f2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016f5:	5b                   	pop    %ebx
+  8016f6:	5e                   	pop    %esi
+  8016f7:	5d                   	pop    %ebp
+  8016f8:	c3                   	ret
+
+008016f9 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  8016f9:	55                   	push   %ebp
+  8016fa:	89 e5                	mov    %esp,%ebp
+  8016fc:	56                   	push   %esi
+  8016fd:	53                   	push   %ebx
+  8016fe:	89 c6                	mov    %eax,%esi
+  801700:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  801702:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  801709:	74 27                	je     801732 <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80170b:	6a 07                	push   $0x7
+  80170d:	68 00 50 80 00       	push   $0x805000
+  801712:	56                   	push   %esi
+  801713:	ff 35 00 40 80 00    	push   0x804000
+  801719:	e8 a6 0c 00 00       	call   8023c4 <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  80171e:	83 c4 0c             	add    $0xc,%esp
+  801721:	6a 00                	push   $0x0
+  801723:	53                   	push   %ebx
+  801724:	6a 00                	push   $0x0
+  801726:	e8 25 0c 00 00       	call   802350 <ipc_recv>
+}
+  80172b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80172e:	5b                   	pop    %ebx
+  80172f:	5e                   	pop    %esi
+  801730:	5d                   	pop    %ebp
+  801731:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  801732:	83 ec 0c             	sub    $0xc,%esp
+  801735:	6a 01                	push   $0x1
+  801737:	e8 dc 0c 00 00       	call   802418 <ipc_find_env>
+  80173c:	a3 00 40 80 00       	mov    %eax,0x804000
+  801741:	83 c4 10             	add    $0x10,%esp
+  801744:	eb c5                	jmp    80170b <fsipc+0x12>
+
+00801746 <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801746:	55                   	push   %ebp
+  801747:	89 e5                	mov    %esp,%ebp
+  801749:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80174c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80174f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801752:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.set_size.req_size = newsize;
+  801757:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80175a:	a3 04 50 80 00       	mov    %eax,0x805004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  80175f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801764:	b8 02 00 00 00       	mov    $0x2,%eax
+  801769:	e8 8b ff ff ff       	call   8016f9 <fsipc>
+}
+  80176e:	c9                   	leave
+  80176f:	c3                   	ret
+
+00801770 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801770:	55                   	push   %ebp
+  801771:	89 e5                	mov    %esp,%ebp
+  801773:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801776:	8b 45 08             	mov    0x8(%ebp),%eax
+  801779:	8b 40 0c             	mov    0xc(%eax),%eax
+  80177c:	a3 00 50 80 00       	mov    %eax,0x805000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801781:	ba 00 00 00 00       	mov    $0x0,%edx
+  801786:	b8 06 00 00 00       	mov    $0x6,%eax
+  80178b:	e8 69 ff ff ff       	call   8016f9 <fsipc>
+}
+  801790:	c9                   	leave
+  801791:	c3                   	ret
+
+00801792 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801792:	55                   	push   %ebp
+  801793:	89 e5                	mov    %esp,%ebp
+  801795:	53                   	push   %ebx
+  801796:	83 ec 04             	sub    $0x4,%esp
+  801799:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80179c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80179f:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017a2:	a3 00 50 80 00       	mov    %eax,0x805000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8017a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017ac:	b8 05 00 00 00       	mov    $0x5,%eax
+  8017b1:	e8 43 ff ff ff       	call   8016f9 <fsipc>
+  8017b6:	85 c0                	test   %eax,%eax
+  8017b8:	78 2c                	js     8017e6 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8017ba:	83 ec 08             	sub    $0x8,%esp
+  8017bd:	68 00 50 80 00       	push   $0x805000
+  8017c2:	53                   	push   %ebx
+  8017c3:	e8 cc ef ff ff       	call   800794 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  8017c8:	a1 80 50 80 00       	mov    0x805080,%eax
+  8017cd:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8017d3:	a1 84 50 80 00       	mov    0x805084,%eax
+  8017d8:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  8017de:	83 c4 10             	add    $0x10,%esp
+  8017e1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017e6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017e9:	c9                   	leave
+  8017ea:	c3                   	ret
+
+008017eb <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8017eb:	55                   	push   %ebp
+  8017ec:	89 e5                	mov    %esp,%ebp
+  8017ee:	83 ec 0c             	sub    $0xc,%esp
+  8017f1:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8017f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017f7:	8b 52 0c             	mov    0xc(%edx),%edx
+  8017fa:	89 15 00 50 80 00    	mov    %edx,0x805000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801800:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801805:	39 d0                	cmp    %edx,%eax
+  801807:	0f 47 c2             	cmova  %edx,%eax
+  80180a:	a3 04 50 80 00       	mov    %eax,0x805004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  80180f:	50                   	push   %eax
+  801810:	ff 75 0c             	push   0xc(%ebp)
+  801813:	68 08 50 80 00       	push   $0x805008
+  801818:	e8 fd f0 ff ff       	call   80091a <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  80181d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801822:	b8 04 00 00 00       	mov    $0x4,%eax
+  801827:	e8 cd fe ff ff       	call   8016f9 <fsipc>
+}
+  80182c:	c9                   	leave
+  80182d:	c3                   	ret
+
+0080182e <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80182e:	55                   	push   %ebp
+  80182f:	89 e5                	mov    %esp,%ebp
+  801831:	56                   	push   %esi
+  801832:	53                   	push   %ebx
+  801833:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801836:	8b 45 08             	mov    0x8(%ebp),%eax
+  801839:	8b 40 0c             	mov    0xc(%eax),%eax
+  80183c:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.read.req_n = n;
+  801841:	89 35 04 50 80 00    	mov    %esi,0x805004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801847:	ba 00 00 00 00       	mov    $0x0,%edx
+  80184c:	b8 03 00 00 00       	mov    $0x3,%eax
+  801851:	e8 a3 fe ff ff       	call   8016f9 <fsipc>
+  801856:	89 c3                	mov    %eax,%ebx
+  801858:	85 c0                	test   %eax,%eax
+  80185a:	78 1f                	js     80187b <devfile_read+0x4d>
+  assert(r <= n);
+  80185c:	39 c6                	cmp    %eax,%esi
+  80185e:	72 24                	jb     801884 <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  801860:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801865:	7f 33                	jg     80189a <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801867:	83 ec 04             	sub    $0x4,%esp
+  80186a:	50                   	push   %eax
+  80186b:	68 00 50 80 00       	push   $0x805000
+  801870:	ff 75 0c             	push   0xc(%ebp)
+  801873:	e8 a2 f0 ff ff       	call   80091a <memmove>
+  return r;
+  801878:	83 c4 10             	add    $0x10,%esp
+}
+  80187b:	89 d8                	mov    %ebx,%eax
+  80187d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801880:	5b                   	pop    %ebx
+  801881:	5e                   	pop    %esi
+  801882:	5d                   	pop    %ebp
+  801883:	c3                   	ret
+  assert(r <= n);
+  801884:	68 2c 2e 80 00       	push   $0x802e2c
+  801889:	68 33 2e 80 00       	push   $0x802e33
+  80188e:	6a 78                	push   $0x78
+  801890:	68 48 2e 80 00       	push   $0x802e48
+  801895:	e8 e1 09 00 00       	call   80227b <_panic>
+  assert(r <= PGSIZE);
+  80189a:	68 53 2e 80 00       	push   $0x802e53
+  80189f:	68 33 2e 80 00       	push   $0x802e33
+  8018a4:	6a 79                	push   $0x79
+  8018a6:	68 48 2e 80 00       	push   $0x802e48
+  8018ab:	e8 cb 09 00 00       	call   80227b <_panic>
+
+008018b0 <open>:
+open(const char *path, int mode) {
+  8018b0:	55                   	push   %ebp
+  8018b1:	89 e5                	mov    %esp,%ebp
+  8018b3:	56                   	push   %esi
+  8018b4:	53                   	push   %ebx
+  8018b5:	83 ec 1c             	sub    $0x1c,%esp
+  8018b8:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  8018bb:	56                   	push   %esi
+  8018bc:	e8 98 ee ff ff       	call   800759 <strlen>
+  8018c1:	83 c4 10             	add    $0x10,%esp
+  8018c4:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8018c9:	7f 6c                	jg     801937 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  8018cb:	83 ec 0c             	sub    $0xc,%esp
+  8018ce:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018d1:	50                   	push   %eax
+  8018d2:	e8 ba f8 ff ff       	call   801191 <fd_alloc>
+  8018d7:	89 c3                	mov    %eax,%ebx
+  8018d9:	83 c4 10             	add    $0x10,%esp
+  8018dc:	85 c0                	test   %eax,%eax
+  8018de:	78 3c                	js     80191c <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  8018e0:	83 ec 08             	sub    $0x8,%esp
+  8018e3:	56                   	push   %esi
+  8018e4:	68 00 50 80 00       	push   $0x805000
+  8018e9:	e8 a6 ee ff ff       	call   800794 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  8018ee:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8018f1:	a3 00 54 80 00       	mov    %eax,0x805400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8018f6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8018f9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8018fe:	e8 f6 fd ff ff       	call   8016f9 <fsipc>
+  801903:	89 c3                	mov    %eax,%ebx
+  801905:	83 c4 10             	add    $0x10,%esp
+  801908:	85 c0                	test   %eax,%eax
+  80190a:	78 19                	js     801925 <open+0x75>
+  return fd2num(fd);
+  80190c:	83 ec 0c             	sub    $0xc,%esp
+  80190f:	ff 75 f4             	push   -0xc(%ebp)
+  801912:	e8 53 f8 ff ff       	call   80116a <fd2num>
+  801917:	89 c3                	mov    %eax,%ebx
+  801919:	83 c4 10             	add    $0x10,%esp
+}
+  80191c:	89 d8                	mov    %ebx,%eax
+  80191e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801921:	5b                   	pop    %ebx
+  801922:	5e                   	pop    %esi
+  801923:	5d                   	pop    %ebp
+  801924:	c3                   	ret
+    fd_close(fd, 0);
+  801925:	83 ec 08             	sub    $0x8,%esp
+  801928:	6a 00                	push   $0x0
+  80192a:	ff 75 f4             	push   -0xc(%ebp)
+  80192d:	e8 58 f9 ff ff       	call   80128a <fd_close>
+    return r;
+  801932:	83 c4 10             	add    $0x10,%esp
+  801935:	eb e5                	jmp    80191c <open+0x6c>
+    return -E_BAD_PATH;
+  801937:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80193c:	eb de                	jmp    80191c <open+0x6c>
+
+0080193e <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  80193e:	55                   	push   %ebp
+  80193f:	89 e5                	mov    %esp,%ebp
+  801941:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801944:	ba 00 00 00 00       	mov    $0x0,%edx
+  801949:	b8 08 00 00 00       	mov    $0x8,%eax
+  80194e:	e8 a6 fd ff ff       	call   8016f9 <fsipc>
+}
+  801953:	c9                   	leave
+  801954:	c3                   	ret
+
+00801955 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801955:	55                   	push   %ebp
+  801956:	89 e5                	mov    %esp,%ebp
+  801958:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  80195b:	68 5f 2e 80 00       	push   $0x802e5f
+  801960:	ff 75 0c             	push   0xc(%ebp)
+  801963:	e8 2c ee ff ff       	call   800794 <strcpy>
+	return 0;
+}
+  801968:	b8 00 00 00 00       	mov    $0x0,%eax
+  80196d:	c9                   	leave
+  80196e:	c3                   	ret
+
+0080196f <devsock_close>:
+{
+  80196f:	55                   	push   %ebp
+  801970:	89 e5                	mov    %esp,%ebp
+  801972:	53                   	push   %ebx
+  801973:	83 ec 10             	sub    $0x10,%esp
+  801976:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801979:	53                   	push   %ebx
+  80197a:	e8 d8 0a 00 00       	call   802457 <pageref>
+  80197f:	89 c2                	mov    %eax,%edx
+  801981:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801984:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801989:	83 fa 01             	cmp    $0x1,%edx
+  80198c:	74 05                	je     801993 <devsock_close+0x24>
+}
+  80198e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801991:	c9                   	leave
+  801992:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801993:	83 ec 0c             	sub    $0xc,%esp
+  801996:	ff 73 0c             	push   0xc(%ebx)
+  801999:	e8 b7 02 00 00       	call   801c55 <nsipc_close>
+  80199e:	83 c4 10             	add    $0x10,%esp
+  8019a1:	eb eb                	jmp    80198e <devsock_close+0x1f>
+
+008019a3 <devsock_write>:
+{
+  8019a3:	55                   	push   %ebp
+  8019a4:	89 e5                	mov    %esp,%ebp
+  8019a6:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8019a9:	6a 00                	push   $0x0
+  8019ab:	ff 75 10             	push   0x10(%ebp)
+  8019ae:	ff 75 0c             	push   0xc(%ebp)
+  8019b1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019b4:	ff 70 0c             	push   0xc(%eax)
+  8019b7:	e8 79 03 00 00       	call   801d35 <nsipc_send>
+}
+  8019bc:	c9                   	leave
+  8019bd:	c3                   	ret
+
+008019be <devsock_read>:
+{
+  8019be:	55                   	push   %ebp
+  8019bf:	89 e5                	mov    %esp,%ebp
+  8019c1:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8019c4:	6a 00                	push   $0x0
+  8019c6:	ff 75 10             	push   0x10(%ebp)
+  8019c9:	ff 75 0c             	push   0xc(%ebp)
+  8019cc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019cf:	ff 70 0c             	push   0xc(%eax)
+  8019d2:	e8 ef 02 00 00       	call   801cc6 <nsipc_recv>
+}
+  8019d7:	c9                   	leave
+  8019d8:	c3                   	ret
+
+008019d9 <fd2sockid>:
+{
+  8019d9:	55                   	push   %ebp
+  8019da:	89 e5                	mov    %esp,%ebp
+  8019dc:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8019df:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8019e2:	52                   	push   %edx
+  8019e3:	50                   	push   %eax
+  8019e4:	e8 fe f7 ff ff       	call   8011e7 <fd_lookup>
+  8019e9:	83 c4 10             	add    $0x10,%esp
+  8019ec:	85 c0                	test   %eax,%eax
+  8019ee:	78 10                	js     801a00 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8019f0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019f3:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  8019f9:	39 08                	cmp    %ecx,(%eax)
+  8019fb:	75 05                	jne    801a02 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8019fd:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801a00:	c9                   	leave
+  801a01:	c3                   	ret
+		return -E_NOT_SUPP;
+  801a02:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a07:	eb f7                	jmp    801a00 <fd2sockid+0x27>
+
+00801a09 <alloc_sockfd>:
+{
+  801a09:	55                   	push   %ebp
+  801a0a:	89 e5                	mov    %esp,%ebp
+  801a0c:	56                   	push   %esi
+  801a0d:	53                   	push   %ebx
+  801a0e:	83 ec 1c             	sub    $0x1c,%esp
+  801a11:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801a13:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a16:	50                   	push   %eax
+  801a17:	e8 75 f7 ff ff       	call   801191 <fd_alloc>
+  801a1c:	89 c3                	mov    %eax,%ebx
+  801a1e:	83 c4 10             	add    $0x10,%esp
+  801a21:	85 c0                	test   %eax,%eax
+  801a23:	78 43                	js     801a68 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801a25:	83 ec 04             	sub    $0x4,%esp
+  801a28:	68 07 04 00 00       	push   $0x407
+  801a2d:	ff 75 f4             	push   -0xc(%ebp)
+  801a30:	6a 00                	push   $0x0
+  801a32:	e8 49 f1 ff ff       	call   800b80 <sys_page_alloc>
+  801a37:	89 c3                	mov    %eax,%ebx
+  801a39:	83 c4 10             	add    $0x10,%esp
+  801a3c:	85 c0                	test   %eax,%eax
+  801a3e:	78 28                	js     801a68 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801a40:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a43:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  801a49:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801a4b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a4e:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801a55:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801a58:	83 ec 0c             	sub    $0xc,%esp
+  801a5b:	50                   	push   %eax
+  801a5c:	e8 09 f7 ff ff       	call   80116a <fd2num>
+  801a61:	89 c3                	mov    %eax,%ebx
+  801a63:	83 c4 10             	add    $0x10,%esp
+  801a66:	eb 0c                	jmp    801a74 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801a68:	83 ec 0c             	sub    $0xc,%esp
+  801a6b:	56                   	push   %esi
+  801a6c:	e8 e4 01 00 00       	call   801c55 <nsipc_close>
+		return r;
+  801a71:	83 c4 10             	add    $0x10,%esp
+}
+  801a74:	89 d8                	mov    %ebx,%eax
+  801a76:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a79:	5b                   	pop    %ebx
+  801a7a:	5e                   	pop    %esi
+  801a7b:	5d                   	pop    %ebp
+  801a7c:	c3                   	ret
+
+00801a7d <accept>:
+{
+  801a7d:	55                   	push   %ebp
+  801a7e:	89 e5                	mov    %esp,%ebp
+  801a80:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801a83:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a86:	e8 4e ff ff ff       	call   8019d9 <fd2sockid>
+  801a8b:	85 c0                	test   %eax,%eax
+  801a8d:	78 1b                	js     801aaa <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801a8f:	83 ec 04             	sub    $0x4,%esp
+  801a92:	ff 75 10             	push   0x10(%ebp)
+  801a95:	ff 75 0c             	push   0xc(%ebp)
+  801a98:	50                   	push   %eax
+  801a99:	e8 0e 01 00 00       	call   801bac <nsipc_accept>
+  801a9e:	83 c4 10             	add    $0x10,%esp
+  801aa1:	85 c0                	test   %eax,%eax
+  801aa3:	78 05                	js     801aaa <accept+0x2d>
+	return alloc_sockfd(r);
+  801aa5:	e8 5f ff ff ff       	call   801a09 <alloc_sockfd>
+}
+  801aaa:	c9                   	leave
+  801aab:	c3                   	ret
+
+00801aac <bind>:
+{
+  801aac:	55                   	push   %ebp
+  801aad:	89 e5                	mov    %esp,%ebp
+  801aaf:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801ab2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ab5:	e8 1f ff ff ff       	call   8019d9 <fd2sockid>
+  801aba:	85 c0                	test   %eax,%eax
+  801abc:	78 12                	js     801ad0 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801abe:	83 ec 04             	sub    $0x4,%esp
+  801ac1:	ff 75 10             	push   0x10(%ebp)
+  801ac4:	ff 75 0c             	push   0xc(%ebp)
+  801ac7:	50                   	push   %eax
+  801ac8:	e8 31 01 00 00       	call   801bfe <nsipc_bind>
+  801acd:	83 c4 10             	add    $0x10,%esp
+}
+  801ad0:	c9                   	leave
+  801ad1:	c3                   	ret
+
+00801ad2 <shutdown>:
+{
+  801ad2:	55                   	push   %ebp
+  801ad3:	89 e5                	mov    %esp,%ebp
+  801ad5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801ad8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801adb:	e8 f9 fe ff ff       	call   8019d9 <fd2sockid>
+  801ae0:	85 c0                	test   %eax,%eax
+  801ae2:	78 0f                	js     801af3 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801ae4:	83 ec 08             	sub    $0x8,%esp
+  801ae7:	ff 75 0c             	push   0xc(%ebp)
+  801aea:	50                   	push   %eax
+  801aeb:	e8 43 01 00 00       	call   801c33 <nsipc_shutdown>
+  801af0:	83 c4 10             	add    $0x10,%esp
+}
+  801af3:	c9                   	leave
+  801af4:	c3                   	ret
+
+00801af5 <connect>:
+{
+  801af5:	55                   	push   %ebp
+  801af6:	89 e5                	mov    %esp,%ebp
+  801af8:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801afb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801afe:	e8 d6 fe ff ff       	call   8019d9 <fd2sockid>
+  801b03:	85 c0                	test   %eax,%eax
+  801b05:	78 12                	js     801b19 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801b07:	83 ec 04             	sub    $0x4,%esp
+  801b0a:	ff 75 10             	push   0x10(%ebp)
+  801b0d:	ff 75 0c             	push   0xc(%ebp)
+  801b10:	50                   	push   %eax
+  801b11:	e8 59 01 00 00       	call   801c6f <nsipc_connect>
+  801b16:	83 c4 10             	add    $0x10,%esp
+}
+  801b19:	c9                   	leave
+  801b1a:	c3                   	ret
+
+00801b1b <listen>:
+{
+  801b1b:	55                   	push   %ebp
+  801b1c:	89 e5                	mov    %esp,%ebp
+  801b1e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801b21:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b24:	e8 b0 fe ff ff       	call   8019d9 <fd2sockid>
+  801b29:	85 c0                	test   %eax,%eax
+  801b2b:	78 0f                	js     801b3c <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801b2d:	83 ec 08             	sub    $0x8,%esp
+  801b30:	ff 75 0c             	push   0xc(%ebp)
+  801b33:	50                   	push   %eax
+  801b34:	e8 6b 01 00 00       	call   801ca4 <nsipc_listen>
+  801b39:	83 c4 10             	add    $0x10,%esp
+}
+  801b3c:	c9                   	leave
+  801b3d:	c3                   	ret
+
+00801b3e <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801b3e:	55                   	push   %ebp
+  801b3f:	89 e5                	mov    %esp,%ebp
+  801b41:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801b44:	ff 75 10             	push   0x10(%ebp)
+  801b47:	ff 75 0c             	push   0xc(%ebp)
+  801b4a:	ff 75 08             	push   0x8(%ebp)
+  801b4d:	e8 41 02 00 00       	call   801d93 <nsipc_socket>
+  801b52:	83 c4 10             	add    $0x10,%esp
+  801b55:	85 c0                	test   %eax,%eax
+  801b57:	78 05                	js     801b5e <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801b59:	e8 ab fe ff ff       	call   801a09 <alloc_sockfd>
+}
+  801b5e:	c9                   	leave
+  801b5f:	c3                   	ret
+
+00801b60 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801b60:	55                   	push   %ebp
+  801b61:	89 e5                	mov    %esp,%ebp
+  801b63:	53                   	push   %ebx
+  801b64:	83 ec 04             	sub    $0x4,%esp
+  801b67:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801b69:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801b70:	74 26                	je     801b98 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801b72:	6a 07                	push   $0x7
+  801b74:	68 00 60 80 00       	push   $0x806000
+  801b79:	53                   	push   %ebx
+  801b7a:	ff 35 04 40 80 00    	push   0x804004
+  801b80:	e8 3f 08 00 00       	call   8023c4 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801b85:	83 c4 0c             	add    $0xc,%esp
+  801b88:	6a 00                	push   $0x0
+  801b8a:	6a 00                	push   $0x0
+  801b8c:	6a 00                	push   $0x0
+  801b8e:	e8 bd 07 00 00       	call   802350 <ipc_recv>
+}
+  801b93:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b96:	c9                   	leave
+  801b97:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801b98:	83 ec 0c             	sub    $0xc,%esp
+  801b9b:	6a 02                	push   $0x2
+  801b9d:	e8 76 08 00 00       	call   802418 <ipc_find_env>
+  801ba2:	a3 04 40 80 00       	mov    %eax,0x804004
+  801ba7:	83 c4 10             	add    $0x10,%esp
+  801baa:	eb c6                	jmp    801b72 <nsipc+0x12>
+
+00801bac <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801bac:	55                   	push   %ebp
+  801bad:	89 e5                	mov    %esp,%ebp
+  801baf:	56                   	push   %esi
+  801bb0:	53                   	push   %ebx
+  801bb1:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801bb4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bb7:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801bbc:	8b 06                	mov    (%esi),%eax
+  801bbe:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801bc3:	b8 01 00 00 00       	mov    $0x1,%eax
+  801bc8:	e8 93 ff ff ff       	call   801b60 <nsipc>
+  801bcd:	89 c3                	mov    %eax,%ebx
+  801bcf:	85 c0                	test   %eax,%eax
+  801bd1:	79 09                	jns    801bdc <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801bd3:	89 d8                	mov    %ebx,%eax
+  801bd5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bd8:	5b                   	pop    %ebx
+  801bd9:	5e                   	pop    %esi
+  801bda:	5d                   	pop    %ebp
+  801bdb:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801bdc:	83 ec 04             	sub    $0x4,%esp
+  801bdf:	ff 35 10 60 80 00    	push   0x806010
+  801be5:	68 00 60 80 00       	push   $0x806000
+  801bea:	ff 75 0c             	push   0xc(%ebp)
+  801bed:	e8 28 ed ff ff       	call   80091a <memmove>
+		*addrlen = ret->ret_addrlen;
+  801bf2:	a1 10 60 80 00       	mov    0x806010,%eax
+  801bf7:	89 06                	mov    %eax,(%esi)
+  801bf9:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801bfc:	eb d5                	jmp    801bd3 <nsipc_accept+0x27>
+
+00801bfe <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801bfe:	55                   	push   %ebp
+  801bff:	89 e5                	mov    %esp,%ebp
+  801c01:	53                   	push   %ebx
+  801c02:	83 ec 08             	sub    $0x8,%esp
+  801c05:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801c08:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c0b:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801c10:	53                   	push   %ebx
+  801c11:	ff 75 0c             	push   0xc(%ebp)
+  801c14:	68 04 60 80 00       	push   $0x806004
+  801c19:	e8 fc ec ff ff       	call   80091a <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801c1e:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  801c24:	b8 02 00 00 00       	mov    $0x2,%eax
+  801c29:	e8 32 ff ff ff       	call   801b60 <nsipc>
+}
+  801c2e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c31:	c9                   	leave
+  801c32:	c3                   	ret
+
+00801c33 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801c33:	55                   	push   %ebp
+  801c34:	89 e5                	mov    %esp,%ebp
+  801c36:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801c39:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c3c:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  801c41:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c44:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  801c49:	b8 03 00 00 00       	mov    $0x3,%eax
+  801c4e:	e8 0d ff ff ff       	call   801b60 <nsipc>
+}
+  801c53:	c9                   	leave
+  801c54:	c3                   	ret
+
+00801c55 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801c55:	55                   	push   %ebp
+  801c56:	89 e5                	mov    %esp,%ebp
+  801c58:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801c5b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c5e:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  801c63:	b8 04 00 00 00       	mov    $0x4,%eax
+  801c68:	e8 f3 fe ff ff       	call   801b60 <nsipc>
+}
+  801c6d:	c9                   	leave
+  801c6e:	c3                   	ret
+
+00801c6f <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801c6f:	55                   	push   %ebp
+  801c70:	89 e5                	mov    %esp,%ebp
+  801c72:	53                   	push   %ebx
+  801c73:	83 ec 08             	sub    $0x8,%esp
+  801c76:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801c79:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c7c:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801c81:	53                   	push   %ebx
+  801c82:	ff 75 0c             	push   0xc(%ebp)
+  801c85:	68 04 60 80 00       	push   $0x806004
+  801c8a:	e8 8b ec ff ff       	call   80091a <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801c8f:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  801c95:	b8 05 00 00 00       	mov    $0x5,%eax
+  801c9a:	e8 c1 fe ff ff       	call   801b60 <nsipc>
+}
+  801c9f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ca2:	c9                   	leave
+  801ca3:	c3                   	ret
+
+00801ca4 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801ca4:	55                   	push   %ebp
+  801ca5:	89 e5                	mov    %esp,%ebp
+  801ca7:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801caa:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cad:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  801cb2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801cb5:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  801cba:	b8 06 00 00 00       	mov    $0x6,%eax
+  801cbf:	e8 9c fe ff ff       	call   801b60 <nsipc>
+}
+  801cc4:	c9                   	leave
+  801cc5:	c3                   	ret
+
+00801cc6 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801cc6:	55                   	push   %ebp
+  801cc7:	89 e5                	mov    %esp,%ebp
+  801cc9:	56                   	push   %esi
+  801cca:	53                   	push   %ebx
+  801ccb:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801cce:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cd1:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  801cd6:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  801cdc:	8b 45 14             	mov    0x14(%ebp),%eax
+  801cdf:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801ce4:	b8 07 00 00 00       	mov    $0x7,%eax
+  801ce9:	e8 72 fe ff ff       	call   801b60 <nsipc>
+  801cee:	89 c3                	mov    %eax,%ebx
+  801cf0:	85 c0                	test   %eax,%eax
+  801cf2:	78 22                	js     801d16 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801cf4:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801cf9:	39 c6                	cmp    %eax,%esi
+  801cfb:	0f 4e c6             	cmovle %esi,%eax
+  801cfe:	39 c3                	cmp    %eax,%ebx
+  801d00:	7f 1d                	jg     801d1f <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801d02:	83 ec 04             	sub    $0x4,%esp
+  801d05:	53                   	push   %ebx
+  801d06:	68 00 60 80 00       	push   $0x806000
+  801d0b:	ff 75 0c             	push   0xc(%ebp)
+  801d0e:	e8 07 ec ff ff       	call   80091a <memmove>
+  801d13:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801d16:	89 d8                	mov    %ebx,%eax
+  801d18:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d1b:	5b                   	pop    %ebx
+  801d1c:	5e                   	pop    %esi
+  801d1d:	5d                   	pop    %ebp
+  801d1e:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801d1f:	68 6b 2e 80 00       	push   $0x802e6b
+  801d24:	68 33 2e 80 00       	push   $0x802e33
+  801d29:	6a 62                	push   $0x62
+  801d2b:	68 80 2e 80 00       	push   $0x802e80
+  801d30:	e8 46 05 00 00       	call   80227b <_panic>
+
+00801d35 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801d35:	55                   	push   %ebp
+  801d36:	89 e5                	mov    %esp,%ebp
+  801d38:	53                   	push   %ebx
+  801d39:	83 ec 04             	sub    $0x4,%esp
+  801d3c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801d3f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d42:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  801d47:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801d4d:	7f 2e                	jg     801d7d <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801d4f:	83 ec 04             	sub    $0x4,%esp
+  801d52:	53                   	push   %ebx
+  801d53:	ff 75 0c             	push   0xc(%ebp)
+  801d56:	68 0c 60 80 00       	push   $0x80600c
+  801d5b:	e8 ba eb ff ff       	call   80091a <memmove>
+	nsipcbuf.send.req_size = size;
+  801d60:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  801d66:	8b 45 14             	mov    0x14(%ebp),%eax
+  801d69:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  801d6e:	b8 08 00 00 00       	mov    $0x8,%eax
+  801d73:	e8 e8 fd ff ff       	call   801b60 <nsipc>
+}
+  801d78:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d7b:	c9                   	leave
+  801d7c:	c3                   	ret
+	assert(size < 1600);
+  801d7d:	68 8c 2e 80 00       	push   $0x802e8c
+  801d82:	68 33 2e 80 00       	push   $0x802e33
+  801d87:	6a 6d                	push   $0x6d
+  801d89:	68 80 2e 80 00       	push   $0x802e80
+  801d8e:	e8 e8 04 00 00       	call   80227b <_panic>
+
+00801d93 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801d93:	55                   	push   %ebp
+  801d94:	89 e5                	mov    %esp,%ebp
+  801d96:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801d99:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d9c:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  801da1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801da4:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  801da9:	8b 45 10             	mov    0x10(%ebp),%eax
+  801dac:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  801db1:	b8 09 00 00 00       	mov    $0x9,%eax
+  801db6:	e8 a5 fd ff ff       	call   801b60 <nsipc>
+}
+  801dbb:	c9                   	leave
+  801dbc:	c3                   	ret
+
+00801dbd <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801dbd:	55                   	push   %ebp
+  801dbe:	89 e5                	mov    %esp,%ebp
+  801dc0:	56                   	push   %esi
+  801dc1:	53                   	push   %ebx
+  801dc2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801dc5:	83 ec 0c             	sub    $0xc,%esp
+  801dc8:	ff 75 08             	push   0x8(%ebp)
+  801dcb:	e8 aa f3 ff ff       	call   80117a <fd2data>
+  801dd0:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801dd2:	83 c4 08             	add    $0x8,%esp
+  801dd5:	68 98 2e 80 00       	push   $0x802e98
+  801dda:	53                   	push   %ebx
+  801ddb:	e8 b4 e9 ff ff       	call   800794 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801de0:	8b 46 04             	mov    0x4(%esi),%eax
+  801de3:	2b 06                	sub    (%esi),%eax
+  801de5:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  801deb:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801df2:	00 00 00 
+	stat->st_dev = &devpipe;
+  801df5:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  801dfc:	30 80 00 
+	return 0;
+}
+  801dff:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e04:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e07:	5b                   	pop    %ebx
+  801e08:	5e                   	pop    %esi
+  801e09:	5d                   	pop    %ebp
+  801e0a:	c3                   	ret
+
+00801e0b <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801e0b:	55                   	push   %ebp
+  801e0c:	89 e5                	mov    %esp,%ebp
+  801e0e:	53                   	push   %ebx
+  801e0f:	83 ec 0c             	sub    $0xc,%esp
+  801e12:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801e15:	53                   	push   %ebx
+  801e16:	6a 00                	push   $0x0
+  801e18:	e8 e8 ed ff ff       	call   800c05 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801e1d:	89 1c 24             	mov    %ebx,(%esp)
+  801e20:	e8 55 f3 ff ff       	call   80117a <fd2data>
+  801e25:	83 c4 08             	add    $0x8,%esp
+  801e28:	50                   	push   %eax
+  801e29:	6a 00                	push   $0x0
+  801e2b:	e8 d5 ed ff ff       	call   800c05 <sys_page_unmap>
+}
+  801e30:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e33:	c9                   	leave
+  801e34:	c3                   	ret
+
+00801e35 <_pipeisclosed>:
+{
+  801e35:	55                   	push   %ebp
+  801e36:	89 e5                	mov    %esp,%ebp
+  801e38:	57                   	push   %edi
+  801e39:	56                   	push   %esi
+  801e3a:	53                   	push   %ebx
+  801e3b:	83 ec 1c             	sub    $0x1c,%esp
+  801e3e:	89 c7                	mov    %eax,%edi
+  801e40:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801e42:	a1 08 40 80 00       	mov    0x804008,%eax
+  801e47:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801e4a:	83 ec 0c             	sub    $0xc,%esp
+  801e4d:	57                   	push   %edi
+  801e4e:	e8 04 06 00 00       	call   802457 <pageref>
+  801e53:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801e56:	89 34 24             	mov    %esi,(%esp)
+  801e59:	e8 f9 05 00 00       	call   802457 <pageref>
+		nn = thisenv->env_runs;
+  801e5e:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801e64:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801e67:	83 c4 10             	add    $0x10,%esp
+  801e6a:	39 cb                	cmp    %ecx,%ebx
+  801e6c:	74 1b                	je     801e89 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801e6e:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801e71:	75 cf                	jne    801e42 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801e73:	8b 42 58             	mov    0x58(%edx),%eax
+  801e76:	6a 01                	push   $0x1
+  801e78:	50                   	push   %eax
+  801e79:	53                   	push   %ebx
+  801e7a:	68 9f 2e 80 00       	push   $0x802e9f
+  801e7f:	e8 57 e3 ff ff       	call   8001db <cprintf>
+  801e84:	83 c4 10             	add    $0x10,%esp
+  801e87:	eb b9                	jmp    801e42 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801e89:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801e8c:	0f 94 c0             	sete   %al
+  801e8f:	0f b6 c0             	movzbl %al,%eax
+}
+  801e92:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e95:	5b                   	pop    %ebx
+  801e96:	5e                   	pop    %esi
+  801e97:	5f                   	pop    %edi
+  801e98:	5d                   	pop    %ebp
+  801e99:	c3                   	ret
+
+00801e9a <devpipe_write>:
+{
+  801e9a:	55                   	push   %ebp
+  801e9b:	89 e5                	mov    %esp,%ebp
+  801e9d:	57                   	push   %edi
+  801e9e:	56                   	push   %esi
+  801e9f:	53                   	push   %ebx
+  801ea0:	83 ec 28             	sub    $0x28,%esp
+  801ea3:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801ea6:	56                   	push   %esi
+  801ea7:	e8 ce f2 ff ff       	call   80117a <fd2data>
+  801eac:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801eae:	83 c4 10             	add    $0x10,%esp
+  801eb1:	bf 00 00 00 00       	mov    $0x0,%edi
+  801eb6:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801eb9:	75 09                	jne    801ec4 <devpipe_write+0x2a>
+	return i;
+  801ebb:	89 f8                	mov    %edi,%eax
+  801ebd:	eb 23                	jmp    801ee2 <devpipe_write+0x48>
+			sys_yield();
+  801ebf:	e8 9d ec ff ff       	call   800b61 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801ec4:	8b 43 04             	mov    0x4(%ebx),%eax
+  801ec7:	8b 0b                	mov    (%ebx),%ecx
+  801ec9:	8d 51 20             	lea    0x20(%ecx),%edx
+  801ecc:	39 d0                	cmp    %edx,%eax
+  801ece:	72 1a                	jb     801eea <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  801ed0:	89 da                	mov    %ebx,%edx
+  801ed2:	89 f0                	mov    %esi,%eax
+  801ed4:	e8 5c ff ff ff       	call   801e35 <_pipeisclosed>
+  801ed9:	85 c0                	test   %eax,%eax
+  801edb:	74 e2                	je     801ebf <devpipe_write+0x25>
+				return 0;
+  801edd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ee2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ee5:	5b                   	pop    %ebx
+  801ee6:	5e                   	pop    %esi
+  801ee7:	5f                   	pop    %edi
+  801ee8:	5d                   	pop    %ebp
+  801ee9:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801eea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801eed:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801ef1:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801ef4:	89 c2                	mov    %eax,%edx
+  801ef6:	c1 fa 1f             	sar    $0x1f,%edx
+  801ef9:	89 d1                	mov    %edx,%ecx
+  801efb:	c1 e9 1b             	shr    $0x1b,%ecx
+  801efe:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801f01:	83 e2 1f             	and    $0x1f,%edx
+  801f04:	29 ca                	sub    %ecx,%edx
+  801f06:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801f0a:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  801f0e:	83 c0 01             	add    $0x1,%eax
+  801f11:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  801f14:	83 c7 01             	add    $0x1,%edi
+  801f17:	eb 9d                	jmp    801eb6 <devpipe_write+0x1c>
+
+00801f19 <devpipe_read>:
+{
+  801f19:	55                   	push   %ebp
+  801f1a:	89 e5                	mov    %esp,%ebp
+  801f1c:	57                   	push   %edi
+  801f1d:	56                   	push   %esi
+  801f1e:	53                   	push   %ebx
+  801f1f:	83 ec 18             	sub    $0x18,%esp
+  801f22:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  801f25:	57                   	push   %edi
+  801f26:	e8 4f f2 ff ff       	call   80117a <fd2data>
+  801f2b:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801f2d:	83 c4 10             	add    $0x10,%esp
+  801f30:	be 00 00 00 00       	mov    $0x0,%esi
+  801f35:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801f38:	75 13                	jne    801f4d <devpipe_read+0x34>
+	return i;
+  801f3a:	89 f0                	mov    %esi,%eax
+  801f3c:	eb 02                	jmp    801f40 <devpipe_read+0x27>
+				return i;
+  801f3e:	89 f0                	mov    %esi,%eax
+}
+  801f40:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f43:	5b                   	pop    %ebx
+  801f44:	5e                   	pop    %esi
+  801f45:	5f                   	pop    %edi
+  801f46:	5d                   	pop    %ebp
+  801f47:	c3                   	ret
+			sys_yield();
+  801f48:	e8 14 ec ff ff       	call   800b61 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  801f4d:	8b 03                	mov    (%ebx),%eax
+  801f4f:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801f52:	75 18                	jne    801f6c <devpipe_read+0x53>
+			if (i > 0)
+  801f54:	85 f6                	test   %esi,%esi
+  801f56:	75 e6                	jne    801f3e <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  801f58:	89 da                	mov    %ebx,%edx
+  801f5a:	89 f8                	mov    %edi,%eax
+  801f5c:	e8 d4 fe ff ff       	call   801e35 <_pipeisclosed>
+  801f61:	85 c0                	test   %eax,%eax
+  801f63:	74 e3                	je     801f48 <devpipe_read+0x2f>
+				return 0;
+  801f65:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f6a:	eb d4                	jmp    801f40 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801f6c:	99                   	cltd
+  801f6d:	c1 ea 1b             	shr    $0x1b,%edx
+  801f70:	01 d0                	add    %edx,%eax
+  801f72:	83 e0 1f             	and    $0x1f,%eax
+  801f75:	29 d0                	sub    %edx,%eax
+  801f77:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801f7c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f7f:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  801f82:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  801f85:	83 c6 01             	add    $0x1,%esi
+  801f88:	eb ab                	jmp    801f35 <devpipe_read+0x1c>
+
+00801f8a <pipe>:
+{
+  801f8a:	55                   	push   %ebp
+  801f8b:	89 e5                	mov    %esp,%ebp
+  801f8d:	56                   	push   %esi
+  801f8e:	53                   	push   %ebx
+  801f8f:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801f92:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f95:	50                   	push   %eax
+  801f96:	e8 f6 f1 ff ff       	call   801191 <fd_alloc>
+  801f9b:	89 c3                	mov    %eax,%ebx
+  801f9d:	83 c4 10             	add    $0x10,%esp
+  801fa0:	85 c0                	test   %eax,%eax
+  801fa2:	0f 88 23 01 00 00    	js     8020cb <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801fa8:	83 ec 04             	sub    $0x4,%esp
+  801fab:	68 07 04 00 00       	push   $0x407
+  801fb0:	ff 75 f4             	push   -0xc(%ebp)
+  801fb3:	6a 00                	push   $0x0
+  801fb5:	e8 c6 eb ff ff       	call   800b80 <sys_page_alloc>
+  801fba:	89 c3                	mov    %eax,%ebx
+  801fbc:	83 c4 10             	add    $0x10,%esp
+  801fbf:	85 c0                	test   %eax,%eax
+  801fc1:	0f 88 04 01 00 00    	js     8020cb <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801fc7:	83 ec 0c             	sub    $0xc,%esp
+  801fca:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801fcd:	50                   	push   %eax
+  801fce:	e8 be f1 ff ff       	call   801191 <fd_alloc>
+  801fd3:	89 c3                	mov    %eax,%ebx
+  801fd5:	83 c4 10             	add    $0x10,%esp
+  801fd8:	85 c0                	test   %eax,%eax
+  801fda:	0f 88 db 00 00 00    	js     8020bb <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801fe0:	83 ec 04             	sub    $0x4,%esp
+  801fe3:	68 07 04 00 00       	push   $0x407
+  801fe8:	ff 75 f0             	push   -0x10(%ebp)
+  801feb:	6a 00                	push   $0x0
+  801fed:	e8 8e eb ff ff       	call   800b80 <sys_page_alloc>
+  801ff2:	89 c3                	mov    %eax,%ebx
+  801ff4:	83 c4 10             	add    $0x10,%esp
+  801ff7:	85 c0                	test   %eax,%eax
+  801ff9:	0f 88 bc 00 00 00    	js     8020bb <pipe+0x131>
+	va = fd2data(fd0);
+  801fff:	83 ec 0c             	sub    $0xc,%esp
+  802002:	ff 75 f4             	push   -0xc(%ebp)
+  802005:	e8 70 f1 ff ff       	call   80117a <fd2data>
+  80200a:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80200c:	83 c4 0c             	add    $0xc,%esp
+  80200f:	68 07 04 00 00       	push   $0x407
+  802014:	50                   	push   %eax
+  802015:	6a 00                	push   $0x0
+  802017:	e8 64 eb ff ff       	call   800b80 <sys_page_alloc>
+  80201c:	89 c3                	mov    %eax,%ebx
+  80201e:	83 c4 10             	add    $0x10,%esp
+  802021:	85 c0                	test   %eax,%eax
+  802023:	0f 88 82 00 00 00    	js     8020ab <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802029:	83 ec 0c             	sub    $0xc,%esp
+  80202c:	ff 75 f0             	push   -0x10(%ebp)
+  80202f:	e8 46 f1 ff ff       	call   80117a <fd2data>
+  802034:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80203b:	50                   	push   %eax
+  80203c:	6a 00                	push   $0x0
+  80203e:	56                   	push   %esi
+  80203f:	6a 00                	push   $0x0
+  802041:	e8 7d eb ff ff       	call   800bc3 <sys_page_map>
+  802046:	89 c3                	mov    %eax,%ebx
+  802048:	83 c4 20             	add    $0x20,%esp
+  80204b:	85 c0                	test   %eax,%eax
+  80204d:	78 4e                	js     80209d <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80204f:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  802054:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802057:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802059:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80205c:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802063:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802066:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802068:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80206b:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802072:	83 ec 0c             	sub    $0xc,%esp
+  802075:	ff 75 f4             	push   -0xc(%ebp)
+  802078:	e8 ed f0 ff ff       	call   80116a <fd2num>
+  80207d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802080:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802082:	83 c4 04             	add    $0x4,%esp
+  802085:	ff 75 f0             	push   -0x10(%ebp)
+  802088:	e8 dd f0 ff ff       	call   80116a <fd2num>
+  80208d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802090:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802093:	83 c4 10             	add    $0x10,%esp
+  802096:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80209b:	eb 2e                	jmp    8020cb <pipe+0x141>
+	sys_page_unmap(0, va);
+  80209d:	83 ec 08             	sub    $0x8,%esp
+  8020a0:	56                   	push   %esi
+  8020a1:	6a 00                	push   $0x0
+  8020a3:	e8 5d eb ff ff       	call   800c05 <sys_page_unmap>
+  8020a8:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8020ab:	83 ec 08             	sub    $0x8,%esp
+  8020ae:	ff 75 f0             	push   -0x10(%ebp)
+  8020b1:	6a 00                	push   $0x0
+  8020b3:	e8 4d eb ff ff       	call   800c05 <sys_page_unmap>
+  8020b8:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8020bb:	83 ec 08             	sub    $0x8,%esp
+  8020be:	ff 75 f4             	push   -0xc(%ebp)
+  8020c1:	6a 00                	push   $0x0
+  8020c3:	e8 3d eb ff ff       	call   800c05 <sys_page_unmap>
+  8020c8:	83 c4 10             	add    $0x10,%esp
+}
+  8020cb:	89 d8                	mov    %ebx,%eax
+  8020cd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020d0:	5b                   	pop    %ebx
+  8020d1:	5e                   	pop    %esi
+  8020d2:	5d                   	pop    %ebp
+  8020d3:	c3                   	ret
+
+008020d4 <pipeisclosed>:
+{
+  8020d4:	55                   	push   %ebp
+  8020d5:	89 e5                	mov    %esp,%ebp
+  8020d7:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8020da:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020dd:	50                   	push   %eax
+  8020de:	ff 75 08             	push   0x8(%ebp)
+  8020e1:	e8 01 f1 ff ff       	call   8011e7 <fd_lookup>
+  8020e6:	83 c4 10             	add    $0x10,%esp
+  8020e9:	85 c0                	test   %eax,%eax
+  8020eb:	78 18                	js     802105 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8020ed:	83 ec 0c             	sub    $0xc,%esp
+  8020f0:	ff 75 f4             	push   -0xc(%ebp)
+  8020f3:	e8 82 f0 ff ff       	call   80117a <fd2data>
+  8020f8:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8020fa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020fd:	e8 33 fd ff ff       	call   801e35 <_pipeisclosed>
+  802102:	83 c4 10             	add    $0x10,%esp
+}
+  802105:	c9                   	leave
+  802106:	c3                   	ret
+
+00802107 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802107:	b8 00 00 00 00       	mov    $0x0,%eax
+  80210c:	c3                   	ret
+
+0080210d <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80210d:	55                   	push   %ebp
+  80210e:	89 e5                	mov    %esp,%ebp
+  802110:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802113:	68 b7 2e 80 00       	push   $0x802eb7
+  802118:	ff 75 0c             	push   0xc(%ebp)
+  80211b:	e8 74 e6 ff ff       	call   800794 <strcpy>
+	return 0;
+}
+  802120:	b8 00 00 00 00       	mov    $0x0,%eax
+  802125:	c9                   	leave
+  802126:	c3                   	ret
+
+00802127 <devcons_write>:
+{
+  802127:	55                   	push   %ebp
+  802128:	89 e5                	mov    %esp,%ebp
+  80212a:	57                   	push   %edi
+  80212b:	56                   	push   %esi
+  80212c:	53                   	push   %ebx
+  80212d:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802133:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802138:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80213e:	eb 2e                	jmp    80216e <devcons_write+0x47>
+		m = n - tot;
+  802140:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802143:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802145:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80214a:	39 c3                	cmp    %eax,%ebx
+  80214c:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80214f:	83 ec 04             	sub    $0x4,%esp
+  802152:	53                   	push   %ebx
+  802153:	89 f0                	mov    %esi,%eax
+  802155:	03 45 0c             	add    0xc(%ebp),%eax
+  802158:	50                   	push   %eax
+  802159:	57                   	push   %edi
+  80215a:	e8 bb e7 ff ff       	call   80091a <memmove>
+		sys_cputs(buf, m);
+  80215f:	83 c4 08             	add    $0x8,%esp
+  802162:	53                   	push   %ebx
+  802163:	57                   	push   %edi
+  802164:	e8 5b e9 ff ff       	call   800ac4 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802169:	01 de                	add    %ebx,%esi
+  80216b:	83 c4 10             	add    $0x10,%esp
+  80216e:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802171:	72 cd                	jb     802140 <devcons_write+0x19>
+}
+  802173:	89 f0                	mov    %esi,%eax
+  802175:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802178:	5b                   	pop    %ebx
+  802179:	5e                   	pop    %esi
+  80217a:	5f                   	pop    %edi
+  80217b:	5d                   	pop    %ebp
+  80217c:	c3                   	ret
+
+0080217d <devcons_read>:
+{
+  80217d:	55                   	push   %ebp
+  80217e:	89 e5                	mov    %esp,%ebp
+  802180:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802183:	b8 00 00 00 00       	mov    $0x0,%eax
+  802188:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80218c:	75 07                	jne    802195 <devcons_read+0x18>
+  80218e:	eb 1f                	jmp    8021af <devcons_read+0x32>
+		sys_yield();
+  802190:	e8 cc e9 ff ff       	call   800b61 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802195:	e8 48 e9 ff ff       	call   800ae2 <sys_cgetc>
+  80219a:	85 c0                	test   %eax,%eax
+  80219c:	74 f2                	je     802190 <devcons_read+0x13>
+	if (c < 0)
+  80219e:	78 0f                	js     8021af <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8021a0:	83 f8 04             	cmp    $0x4,%eax
+  8021a3:	74 0c                	je     8021b1 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8021a5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8021a8:	88 02                	mov    %al,(%edx)
+	return 1;
+  8021aa:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8021af:	c9                   	leave
+  8021b0:	c3                   	ret
+		return 0;
+  8021b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021b6:	eb f7                	jmp    8021af <devcons_read+0x32>
+
+008021b8 <cputchar>:
+{
+  8021b8:	55                   	push   %ebp
+  8021b9:	89 e5                	mov    %esp,%ebp
+  8021bb:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8021be:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021c1:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8021c4:	6a 01                	push   $0x1
+  8021c6:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8021c9:	50                   	push   %eax
+  8021ca:	e8 f5 e8 ff ff       	call   800ac4 <sys_cputs>
+}
+  8021cf:	83 c4 10             	add    $0x10,%esp
+  8021d2:	c9                   	leave
+  8021d3:	c3                   	ret
+
+008021d4 <getchar>:
+{
+  8021d4:	55                   	push   %ebp
+  8021d5:	89 e5                	mov    %esp,%ebp
+  8021d7:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8021da:	6a 01                	push   $0x1
+  8021dc:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8021df:	50                   	push   %eax
+  8021e0:	6a 00                	push   $0x0
+  8021e2:	e8 66 f2 ff ff       	call   80144d <read>
+	if (r < 0)
+  8021e7:	83 c4 10             	add    $0x10,%esp
+  8021ea:	85 c0                	test   %eax,%eax
+  8021ec:	78 06                	js     8021f4 <getchar+0x20>
+	if (r < 1)
+  8021ee:	74 06                	je     8021f6 <getchar+0x22>
+	return c;
+  8021f0:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8021f4:	c9                   	leave
+  8021f5:	c3                   	ret
+		return -E_EOF;
+  8021f6:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8021fb:	eb f7                	jmp    8021f4 <getchar+0x20>
+
+008021fd <iscons>:
+{
+  8021fd:	55                   	push   %ebp
+  8021fe:	89 e5                	mov    %esp,%ebp
+  802200:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802203:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802206:	50                   	push   %eax
+  802207:	ff 75 08             	push   0x8(%ebp)
+  80220a:	e8 d8 ef ff ff       	call   8011e7 <fd_lookup>
+  80220f:	83 c4 10             	add    $0x10,%esp
+  802212:	85 c0                	test   %eax,%eax
+  802214:	78 11                	js     802227 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802216:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802219:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  80221f:	39 10                	cmp    %edx,(%eax)
+  802221:	0f 94 c0             	sete   %al
+  802224:	0f b6 c0             	movzbl %al,%eax
+}
+  802227:	c9                   	leave
+  802228:	c3                   	ret
+
+00802229 <opencons>:
+{
+  802229:	55                   	push   %ebp
+  80222a:	89 e5                	mov    %esp,%ebp
+  80222c:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80222f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802232:	50                   	push   %eax
+  802233:	e8 59 ef ff ff       	call   801191 <fd_alloc>
+  802238:	83 c4 10             	add    $0x10,%esp
+  80223b:	85 c0                	test   %eax,%eax
+  80223d:	78 3a                	js     802279 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80223f:	83 ec 04             	sub    $0x4,%esp
+  802242:	68 07 04 00 00       	push   $0x407
+  802247:	ff 75 f4             	push   -0xc(%ebp)
+  80224a:	6a 00                	push   $0x0
+  80224c:	e8 2f e9 ff ff       	call   800b80 <sys_page_alloc>
+  802251:	83 c4 10             	add    $0x10,%esp
+  802254:	85 c0                	test   %eax,%eax
+  802256:	78 21                	js     802279 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802258:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80225b:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  802261:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802263:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802266:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80226d:	83 ec 0c             	sub    $0xc,%esp
+  802270:	50                   	push   %eax
+  802271:	e8 f4 ee ff ff       	call   80116a <fd2num>
+  802276:	83 c4 10             	add    $0x10,%esp
+}
+  802279:	c9                   	leave
+  80227a:	c3                   	ret
+
+0080227b <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80227b:	55                   	push   %ebp
+  80227c:	89 e5                	mov    %esp,%ebp
+  80227e:	56                   	push   %esi
+  80227f:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  802280:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  802283:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  802289:	e8 b4 e8 ff ff       	call   800b42 <sys_getenvid>
+  80228e:	83 ec 0c             	sub    $0xc,%esp
+  802291:	ff 75 0c             	push   0xc(%ebp)
+  802294:	ff 75 08             	push   0x8(%ebp)
+  802297:	56                   	push   %esi
+  802298:	50                   	push   %eax
+  802299:	68 c4 2e 80 00       	push   $0x802ec4
+  80229e:	e8 38 df ff ff       	call   8001db <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8022a3:	83 c4 18             	add    $0x18,%esp
+  8022a6:	53                   	push   %ebx
+  8022a7:	ff 75 10             	push   0x10(%ebp)
+  8022aa:	e8 db de ff ff       	call   80018a <vcprintf>
+	cprintf("\n");
+  8022af:	c7 04 24 4f 29 80 00 	movl   $0x80294f,(%esp)
+  8022b6:	e8 20 df ff ff       	call   8001db <cprintf>
+  8022bb:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8022be:	cc                   	int3
+	while (1)
+  8022bf:	eb fd                	jmp    8022be <_panic+0x43>
+
+008022c1 <set_pgfault_handler>:
+// allocate an exception stack (one page of memory with its top
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf)) {
+  8022c1:	55                   	push   %ebp
+  8022c2:	89 e5                	mov    %esp,%ebp
+  8022c4:	83 ec 08             	sub    $0x8,%esp
+  int r;
+
+  if (_pgfault_handler == 0) {
+  8022c7:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  8022ce:	74 0a                	je     8022da <set_pgfault_handler+0x19>
+    if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)))
+      panic(" set_pgfault_handler sys_env_set_pgfault_upcall panic: %e\n", r);
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  8022d0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022d3:	a3 00 70 80 00       	mov    %eax,0x807000
+
+
+}
+  8022d8:	c9                   	leave
+  8022d9:	c3                   	ret
+    if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)))
+  8022da:	83 ec 04             	sub    $0x4,%esp
+  8022dd:	6a 07                	push   $0x7
+  8022df:	68 00 f0 bf ee       	push   $0xeebff000
+  8022e4:	6a 00                	push   $0x0
+  8022e6:	e8 95 e8 ff ff       	call   800b80 <sys_page_alloc>
+  8022eb:	83 c4 10             	add    $0x10,%esp
+  8022ee:	85 c0                	test   %eax,%eax
+  8022f0:	75 28                	jne    80231a <set_pgfault_handler+0x59>
+    if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)))
+  8022f2:	83 ec 08             	sub    $0x8,%esp
+  8022f5:	68 2c 23 80 00       	push   $0x80232c
+  8022fa:	6a 00                	push   $0x0
+  8022fc:	e8 ca e9 ff ff       	call   800ccb <sys_env_set_pgfault_upcall>
+  802301:	83 c4 10             	add    $0x10,%esp
+  802304:	85 c0                	test   %eax,%eax
+  802306:	74 c8                	je     8022d0 <set_pgfault_handler+0xf>
+      panic(" set_pgfault_handler sys_env_set_pgfault_upcall panic: %e\n", r);
+  802308:	50                   	push   %eax
+  802309:	68 18 2f 80 00       	push   $0x802f18
+  80230e:	6a 22                	push   $0x22
+  802310:	68 53 2f 80 00       	push   $0x802f53
+  802315:	e8 61 ff ff ff       	call   80227b <_panic>
+      panic("set_pgfault_handler sys_page_alloc panic: %e\n", r);
+  80231a:	50                   	push   %eax
+  80231b:	68 e8 2e 80 00       	push   $0x802ee8
+  802320:	6a 20                	push   $0x20
+  802322:	68 53 2f 80 00       	push   $0x802f53
+  802327:	e8 4f ff ff ff       	call   80227b <_panic>
+
+0080232c <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80232c:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80232d:	a1 00 70 80 00       	mov    0x807000,%eax
+	call *%eax
+  802332:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  802334:	83 c4 04             	add    $0x4,%esp
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	// push the trap-time %eip onto the trap-time stack
+    subl $0x4, 0x30(%esp) # for push eip
+  802337:	83 6c 24 30 04       	subl   $0x4,0x30(%esp)
+    movl 0x30(%esp), %ebx #regular esp
+  80233c:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+    movl 0x28(%esp), %eax #eip
+  802340:	8b 44 24 28          	mov    0x28(%esp),%eax
+    movl %eax, (%ebx)
+  802344:	89 03                	mov    %eax,(%ebx)
+
+    // Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+    addl $8, %esp
+  802346:	83 c4 08             	add    $0x8,%esp
+    popal
+  802349:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  80234a:	83 c4 04             	add    $0x4,%esp
+	popfl
+  80234d:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  80234e:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  80234f:	c3                   	ret
+
+00802350 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  802350:	55                   	push   %ebp
+  802351:	89 e5                	mov    %esp,%ebp
+  802353:	56                   	push   %esi
+  802354:	53                   	push   %ebx
+  802355:	8b 75 08             	mov    0x8(%ebp),%esi
+  802358:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80235b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  80235e:	85 c0                	test   %eax,%eax
+  802360:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802365:	0f 44 c2             	cmove  %edx,%eax
+  802368:	83 ec 0c             	sub    $0xc,%esp
+  80236b:	50                   	push   %eax
+  80236c:	e8 bf e9 ff ff       	call   800d30 <sys_ipc_recv>
+
+  if (from_env_store)
+  802371:	83 c4 10             	add    $0x10,%esp
+  802374:	85 f6                	test   %esi,%esi
+  802376:	74 17                	je     80238f <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  802378:	ba 00 00 00 00       	mov    $0x0,%edx
+  80237d:	85 c0                	test   %eax,%eax
+  80237f:	75 0c                	jne    80238d <ipc_recv+0x3d>
+  802381:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  802387:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  80238d:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  80238f:	85 db                	test   %ebx,%ebx
+  802391:	74 2b                	je     8023be <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  802393:	85 c0                	test   %eax,%eax
+  802395:	74 0d                	je     8023a4 <ipc_recv+0x54>
+  802397:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  80239d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023a0:	5b                   	pop    %ebx
+  8023a1:	5e                   	pop    %esi
+  8023a2:	5d                   	pop    %ebp
+  8023a3:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  8023a4:	a1 08 40 80 00       	mov    0x804008,%eax
+  8023a9:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8023af:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  8023b1:	a1 08 40 80 00       	mov    0x804008,%eax
+  8023b6:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  8023bc:	eb df                	jmp    80239d <ipc_recv+0x4d>
+  8023be:	85 c0                	test   %eax,%eax
+  8023c0:	75 db                	jne    80239d <ipc_recv+0x4d>
+  8023c2:	eb ed                	jmp    8023b1 <ipc_recv+0x61>
+
+008023c4 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  8023c4:	55                   	push   %ebp
+  8023c5:	89 e5                	mov    %esp,%ebp
+  8023c7:	57                   	push   %edi
+  8023c8:	56                   	push   %esi
+  8023c9:	53                   	push   %ebx
+  8023ca:	83 ec 0c             	sub    $0xc,%esp
+  8023cd:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8023d0:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8023d3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  8023d6:	85 db                	test   %ebx,%ebx
+  8023d8:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8023dd:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  8023e0:	ff 75 14             	push   0x14(%ebp)
+  8023e3:	53                   	push   %ebx
+  8023e4:	56                   	push   %esi
+  8023e5:	57                   	push   %edi
+  8023e6:	e8 22 e9 ff ff       	call   800d0d <sys_ipc_try_send>
+  8023eb:	83 c4 10             	add    $0x10,%esp
+  8023ee:	85 c0                	test   %eax,%eax
+  8023f0:	74 1e                	je     802410 <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  8023f2:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8023f5:	75 07                	jne    8023fe <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  8023f7:	e8 65 e7 ff ff       	call   800b61 <sys_yield>
+  8023fc:	eb e2                	jmp    8023e0 <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  8023fe:	50                   	push   %eax
+  8023ff:	68 61 2f 80 00       	push   $0x802f61
+  802404:	6a 3c                	push   $0x3c
+  802406:	68 6e 2f 80 00       	push   $0x802f6e
+  80240b:	e8 6b fe ff ff       	call   80227b <_panic>
+  }
+
+#endif
+}
+  802410:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802413:	5b                   	pop    %ebx
+  802414:	5e                   	pop    %esi
+  802415:	5f                   	pop    %edi
+  802416:	5d                   	pop    %ebp
+  802417:	c3                   	ret
+
+00802418 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  802418:	55                   	push   %ebp
+  802419:	89 e5                	mov    %esp,%ebp
+  80241b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  80241e:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  802423:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802426:	c1 e0 04             	shl    $0x4,%eax
+  802429:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80242e:	8b 40 50             	mov    0x50(%eax),%eax
+  802431:	39 c8                	cmp    %ecx,%eax
+  802433:	74 12                	je     802447 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  802435:	83 c2 01             	add    $0x1,%edx
+  802438:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  80243e:	75 e3                	jne    802423 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802440:	b8 00 00 00 00       	mov    $0x0,%eax
+  802445:	eb 0e                	jmp    802455 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  802447:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80244a:	c1 e0 04             	shl    $0x4,%eax
+  80244d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802452:	8b 40 48             	mov    0x48(%eax),%eax
+  802455:	5d                   	pop    %ebp
+  802456:	c3                   	ret
+
+00802457 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802457:	55                   	push   %ebp
+  802458:	89 e5                	mov    %esp,%ebp
+  80245a:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80245d:	89 c2                	mov    %eax,%edx
+  80245f:	c1 ea 16             	shr    $0x16,%edx
+  802462:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802469:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80246e:	f6 c1 01             	test   $0x1,%cl
+  802471:	74 1c                	je     80248f <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  802473:	c1 e8 0c             	shr    $0xc,%eax
+  802476:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80247d:	a8 01                	test   $0x1,%al
+  80247f:	74 0e                	je     80248f <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802481:	c1 e8 0c             	shr    $0xc,%eax
+  802484:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  80248b:	ef 
+  80248c:	0f b7 d2             	movzwl %dx,%edx
+}
+  80248f:	89 d0                	mov    %edx,%eax
+  802491:	5d                   	pop    %ebp
+  802492:	c3                   	ret
+  802493:	66 90                	xchg   %ax,%ax
+  802495:	66 90                	xchg   %ax,%ax
+  802497:	66 90                	xchg   %ax,%ax
+  802499:	66 90                	xchg   %ax,%ax
+  80249b:	66 90                	xchg   %ax,%ax
+  80249d:	66 90                	xchg   %ax,%ax
+  80249f:	90                   	nop
+
+008024a0 <__udivmoddi4>:
+  8024a0:	55                   	push   %ebp
+  8024a1:	57                   	push   %edi
+  8024a2:	56                   	push   %esi
+  8024a3:	53                   	push   %ebx
+  8024a4:	83 ec 24             	sub    $0x24,%esp
+  8024a7:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8024ab:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8024af:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  8024b3:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8024b7:	8b 54 24 44          	mov    0x44(%esp),%edx
+  8024bb:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8024bf:	8b 44 24 40          	mov    0x40(%esp),%eax
+  8024c3:	89 d3                	mov    %edx,%ebx
+  8024c5:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8024c9:	09 c3                	or     %eax,%ebx
+  8024cb:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8024cf:	0f 84 9c 00 00 00    	je     802571 <__udivmoddi4+0xd1>
+  8024d5:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8024dc:	00 
+  8024dd:	31 c0                	xor    %eax,%eax
+  8024df:	31 d2                	xor    %edx,%edx
+  8024e1:	89 fb                	mov    %edi,%ebx
+  8024e3:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8024ea:	00 
+  8024eb:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8024f0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8024f4:	01 c0                	add    %eax,%eax
+  8024f6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8024fd:	00 
+  8024fe:	89 c6                	mov    %eax,%esi
+  802500:	89 d7                	mov    %edx,%edi
+  802502:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802506:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80250a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80250d:	d3 ea                	shr    %cl,%edx
+  80250f:	f6 c1 20             	test   $0x20,%cl
+  802512:	0f 45 c2             	cmovne %edx,%eax
+  802515:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802519:	83 e0 01             	and    $0x1,%eax
+  80251c:	09 fa                	or     %edi,%edx
+  80251e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802522:	89 04 24             	mov    %eax,(%esp)
+  802525:	8b 04 24             	mov    (%esp),%eax
+  802528:	89 d5                	mov    %edx,%ebp
+  80252a:	09 f0                	or     %esi,%eax
+  80252c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802530:	39 f0                	cmp    %esi,%eax
+  802532:	19 fd                	sbb    %edi,%ebp
+  802534:	72 1d                	jb     802553 <__udivmoddi4+0xb3>
+  802536:	29 f0                	sub    %esi,%eax
+  802538:	19 fa                	sbb    %edi,%edx
+  80253a:	89 cf                	mov    %ecx,%edi
+  80253c:	c1 ef 05             	shr    $0x5,%edi
+  80253f:	83 e7 01             	and    $0x1,%edi
+  802542:	89 fe                	mov    %edi,%esi
+  802544:	d3 e7                	shl    %cl,%edi
+  802546:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80254a:	83 f6 01             	xor    $0x1,%esi
+  80254d:	d3 e6                	shl    %cl,%esi
+  80254f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802553:	83 e9 01             	sub    $0x1,%ecx
+  802556:	73 98                	jae    8024f0 <__udivmoddi4+0x50>
+  802558:	85 db                	test   %ebx,%ebx
+  80255a:	74 05                	je     802561 <__udivmoddi4+0xc1>
+  80255c:	89 03                	mov    %eax,(%ebx)
+  80255e:	89 53 04             	mov    %edx,0x4(%ebx)
+  802561:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802565:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802569:	83 c4 24             	add    $0x24,%esp
+  80256c:	5b                   	pop    %ebx
+  80256d:	5e                   	pop    %esi
+  80256e:	5f                   	pop    %edi
+  80256f:	5d                   	pop    %ebp
+  802570:	c3                   	ret
+  802571:	85 ff                	test   %edi,%edi
+  802573:	74 0d                	je     802582 <__udivmoddi4+0xe2>
+  802575:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  80257b:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  802582:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802586:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80258a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80258e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802592:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802596:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80259a:	83 c4 24             	add    $0x24,%esp
+  80259d:	5b                   	pop    %ebx
+  80259e:	5e                   	pop    %esi
+  80259f:	5f                   	pop    %edi
+  8025a0:	5d                   	pop    %ebp
+  8025a1:	c3                   	ret
+  8025a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8025a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+008025b0 <__udivdi3>:
+  8025b0:	57                   	push   %edi
+  8025b1:	56                   	push   %esi
+  8025b2:	53                   	push   %ebx
+  8025b3:	83 ec 20             	sub    $0x20,%esp
+  8025b6:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8025ba:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8025be:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8025c2:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8025c6:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8025ca:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8025ce:	89 d1                	mov    %edx,%ecx
+  8025d0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8025d4:	09 c1                	or     %eax,%ecx
+  8025d6:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8025da:	89 44 24 18          	mov    %eax,0x18(%esp)
+  8025de:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  8025e2:	0f 84 88 00 00 00    	je     802670 <__udivdi3+0xc0>
+  8025e8:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8025ef:	00 
+  8025f0:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8025f5:	31 c0                	xor    %eax,%eax
+  8025f7:	31 d2                	xor    %edx,%edx
+  8025f9:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802600:	00 
+  802601:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802608:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80260c:	01 c0                	add    %eax,%eax
+  80260e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802615:	00 
+  802616:	89 c6                	mov    %eax,%esi
+  802618:	89 d7                	mov    %edx,%edi
+  80261a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80261e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802622:	0f ad d0             	shrd   %cl,%edx,%eax
+  802625:	d3 ea                	shr    %cl,%edx
+  802627:	f6 c1 20             	test   $0x20,%cl
+  80262a:	0f 45 c2             	cmovne %edx,%eax
+  80262d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802631:	83 e0 01             	and    $0x1,%eax
+  802634:	09 fa                	or     %edi,%edx
+  802636:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80263a:	89 04 24             	mov    %eax,(%esp)
+  80263d:	8b 04 24             	mov    (%esp),%eax
+  802640:	89 d3                	mov    %edx,%ebx
+  802642:	09 f0                	or     %esi,%eax
+  802644:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802648:	39 f0                	cmp    %esi,%eax
+  80264a:	19 fb                	sbb    %edi,%ebx
+  80264c:	72 1d                	jb     80266b <__udivdi3+0xbb>
+  80264e:	29 f0                	sub    %esi,%eax
+  802650:	19 fa                	sbb    %edi,%edx
+  802652:	89 cf                	mov    %ecx,%edi
+  802654:	c1 ef 05             	shr    $0x5,%edi
+  802657:	83 e7 01             	and    $0x1,%edi
+  80265a:	89 fe                	mov    %edi,%esi
+  80265c:	d3 e7                	shl    %cl,%edi
+  80265e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802662:	83 f6 01             	xor    $0x1,%esi
+  802665:	d3 e6                	shl    %cl,%esi
+  802667:	09 74 24 18          	or     %esi,0x18(%esp)
+  80266b:	83 e9 01             	sub    $0x1,%ecx
+  80266e:	73 98                	jae    802608 <__udivdi3+0x58>
+  802670:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802674:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802678:	83 c4 20             	add    $0x20,%esp
+  80267b:	5b                   	pop    %ebx
+  80267c:	5e                   	pop    %esi
+  80267d:	5f                   	pop    %edi
+  80267e:	c3                   	ret
+  80267f:	90                   	nop
+
+00802680 <__umoddi3>:
+  802680:	57                   	push   %edi
+  802681:	56                   	push   %esi
+  802682:	53                   	push   %ebx
+  802683:	83 ec 18             	sub    $0x18,%esp
+  802686:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80268a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80268e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802692:	8b 54 24 34          	mov    0x34(%esp),%edx
+  802696:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80269a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80269e:	89 d1                	mov    %edx,%ecx
+  8026a0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8026a4:	09 c1                	or     %eax,%ecx
+  8026a6:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8026aa:	74 5b                	je     802707 <__umoddi3+0x87>
+  8026ac:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8026b1:	31 c0                	xor    %eax,%eax
+  8026b3:	31 d2                	xor    %edx,%edx
+  8026b5:	8d 76 00             	lea    0x0(%esi),%esi
+  8026b8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8026bc:	01 c0                	add    %eax,%eax
+  8026be:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8026c5:	00 
+  8026c6:	89 c6                	mov    %eax,%esi
+  8026c8:	89 d7                	mov    %edx,%edi
+  8026ca:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8026ce:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8026d2:	0f ad d0             	shrd   %cl,%edx,%eax
+  8026d5:	d3 ea                	shr    %cl,%edx
+  8026d7:	f6 c1 20             	test   $0x20,%cl
+  8026da:	0f 45 c2             	cmovne %edx,%eax
+  8026dd:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8026e1:	83 e0 01             	and    $0x1,%eax
+  8026e4:	09 fa                	or     %edi,%edx
+  8026e6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8026ea:	89 04 24             	mov    %eax,(%esp)
+  8026ed:	8b 04 24             	mov    (%esp),%eax
+  8026f0:	89 d3                	mov    %edx,%ebx
+  8026f2:	09 f0                	or     %esi,%eax
+  8026f4:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8026f8:	39 f0                	cmp    %esi,%eax
+  8026fa:	19 fb                	sbb    %edi,%ebx
+  8026fc:	72 04                	jb     802702 <__umoddi3+0x82>
+  8026fe:	29 f0                	sub    %esi,%eax
+  802700:	19 fa                	sbb    %edi,%edx
+  802702:	83 e9 01             	sub    $0x1,%ecx
+  802705:	73 b1                	jae    8026b8 <__umoddi3+0x38>
+  802707:	83 c4 18             	add    $0x18,%esp
+  80270a:	5b                   	pop    %ebx
+  80270b:	5e                   	pop    %esi
+  80270c:	5f                   	pop    %edi
+  80270d:	c3                   	ret
+  80270e:	66 90                	xchg   %ax,%ax
+
+00802710 <__divdi3>:
+  802710:	55                   	push   %ebp
+  802711:	57                   	push   %edi
+  802712:	56                   	push   %esi
+  802713:	53                   	push   %ebx
+  802714:	83 ec 24             	sub    $0x24,%esp
+  802717:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  80271b:	8b 74 24 44          	mov    0x44(%esp),%esi
+  80271f:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802723:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802727:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  80272b:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  80272f:	85 d2                	test   %edx,%edx
+  802731:	0f 88 e0 00 00 00    	js     802817 <__divdi3+0x107>
+  802737:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  80273b:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  80273f:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802743:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802747:	85 f6                	test   %esi,%esi
+  802749:	78 16                	js     802761 <__divdi3+0x51>
+  80274b:	89 f1                	mov    %esi,%ecx
+  80274d:	31 c0                	xor    %eax,%eax
+  80274f:	31 d2                	xor    %edx,%edx
+  802751:	09 d9                	or     %ebx,%ecx
+  802753:	0f 85 f3 00 00 00    	jne    80284c <__divdi3+0x13c>
+  802759:	83 c4 24             	add    $0x24,%esp
+  80275c:	5b                   	pop    %ebx
+  80275d:	5e                   	pop    %esi
+  80275e:	5f                   	pop    %edi
+  80275f:	5d                   	pop    %ebp
+  802760:	c3                   	ret
+  802761:	bf 01 00 00 00       	mov    $0x1,%edi
+  802766:	f7 5c 24 08          	negl   0x8(%esp)
+  80276a:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  80276f:	f7 5c 24 0c          	negl   0xc(%esp)
+  802773:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80277a:	00 
+  80277b:	31 c0                	xor    %eax,%eax
+  80277d:	31 d2                	xor    %edx,%edx
+  80277f:	89 fb                	mov    %edi,%ebx
+  802781:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802788:	00 
+  802789:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80278e:	66 90                	xchg   %ax,%ax
+  802790:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802794:	01 c0                	add    %eax,%eax
+  802796:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80279d:	00 
+  80279e:	89 c6                	mov    %eax,%esi
+  8027a0:	89 d7                	mov    %edx,%edi
+  8027a2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8027a6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8027aa:	0f ad d0             	shrd   %cl,%edx,%eax
+  8027ad:	d3 ea                	shr    %cl,%edx
+  8027af:	f6 c1 20             	test   $0x20,%cl
+  8027b2:	0f 45 c2             	cmovne %edx,%eax
+  8027b5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8027b9:	83 e0 01             	and    $0x1,%eax
+  8027bc:	09 fa                	or     %edi,%edx
+  8027be:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8027c2:	89 04 24             	mov    %eax,(%esp)
+  8027c5:	8b 04 24             	mov    (%esp),%eax
+  8027c8:	89 d5                	mov    %edx,%ebp
+  8027ca:	09 f0                	or     %esi,%eax
+  8027cc:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8027d0:	39 f0                	cmp    %esi,%eax
+  8027d2:	19 fd                	sbb    %edi,%ebp
+  8027d4:	72 1d                	jb     8027f3 <__divdi3+0xe3>
+  8027d6:	29 f0                	sub    %esi,%eax
+  8027d8:	19 fa                	sbb    %edi,%edx
+  8027da:	89 cf                	mov    %ecx,%edi
+  8027dc:	c1 ef 05             	shr    $0x5,%edi
+  8027df:	83 e7 01             	and    $0x1,%edi
+  8027e2:	89 fe                	mov    %edi,%esi
+  8027e4:	d3 e7                	shl    %cl,%edi
+  8027e6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8027ea:	83 f6 01             	xor    $0x1,%esi
+  8027ed:	d3 e6                	shl    %cl,%esi
+  8027ef:	09 74 24 18          	or     %esi,0x18(%esp)
+  8027f3:	83 e9 01             	sub    $0x1,%ecx
+  8027f6:	73 98                	jae    802790 <__divdi3+0x80>
+  8027f8:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8027fc:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802800:	85 db                	test   %ebx,%ebx
+  802802:	0f 84 51 ff ff ff    	je     802759 <__divdi3+0x49>
+  802808:	f7 d8                	neg    %eax
+  80280a:	83 d2 00             	adc    $0x0,%edx
+  80280d:	83 c4 24             	add    $0x24,%esp
+  802810:	5b                   	pop    %ebx
+  802811:	f7 da                	neg    %edx
+  802813:	5e                   	pop    %esi
+  802814:	5f                   	pop    %edi
+  802815:	5d                   	pop    %ebp
+  802816:	c3                   	ret
+  802817:	f7 d8                	neg    %eax
+  802819:	83 d2 00             	adc    $0x0,%edx
+  80281c:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802820:	f7 da                	neg    %edx
+  802822:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802826:	85 f6                	test   %esi,%esi
+  802828:	78 1b                	js     802845 <__divdi3+0x135>
+  80282a:	89 f1                	mov    %esi,%ecx
+  80282c:	31 c0                	xor    %eax,%eax
+  80282e:	31 d2                	xor    %edx,%edx
+  802830:	bf 01 00 00 00       	mov    $0x1,%edi
+  802835:	09 d9                	or     %ebx,%ecx
+  802837:	0f 85 36 ff ff ff    	jne    802773 <__divdi3+0x63>
+  80283d:	83 c4 24             	add    $0x24,%esp
+  802840:	5b                   	pop    %ebx
+  802841:	5e                   	pop    %esi
+  802842:	5f                   	pop    %edi
+  802843:	5d                   	pop    %ebp
+  802844:	c3                   	ret
+  802845:	31 ff                	xor    %edi,%edi
+  802847:	e9 1a ff ff ff       	jmp    802766 <__divdi3+0x56>
+  80284c:	31 ff                	xor    %edi,%edi
+  80284e:	e9 20 ff ff ff       	jmp    802773 <__divdi3+0x63>
+  802853:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80285a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00802860 <__moddi3>:
+  802860:	55                   	push   %ebp
+  802861:	57                   	push   %edi
+  802862:	56                   	push   %esi
+  802863:	53                   	push   %ebx
+  802864:	83 ec 1c             	sub    $0x1c,%esp
+  802867:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  80286b:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  80286f:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  802873:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  802877:	89 c8                	mov    %ecx,%eax
+  802879:	89 f2                	mov    %esi,%edx
+  80287b:	89 f3                	mov    %esi,%ebx
+  80287d:	85 ed                	test   %ebp,%ebp
+  80287f:	0f 88 9d 00 00 00    	js     802922 <__moddi3+0xc2>
+  802885:	09 cb                	or     %ecx,%ebx
+  802887:	0f 84 8d 00 00 00    	je     80291a <__moddi3+0xba>
+  80288d:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802891:	31 db                	xor    %ebx,%ebx
+  802893:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802897:	89 ca                	mov    %ecx,%edx
+  802899:	89 f0                	mov    %esi,%eax
+  80289b:	89 dd                	mov    %ebx,%ebp
+  80289d:	f7 da                	neg    %edx
+  80289f:	83 d0 00             	adc    $0x0,%eax
+  8028a2:	f7 d8                	neg    %eax
+  8028a4:	0f 49 f0             	cmovns %eax,%esi
+  8028a7:	0f 49 ca             	cmovns %edx,%ecx
+  8028aa:	31 c0                	xor    %eax,%eax
+  8028ac:	31 d2                	xor    %edx,%edx
+  8028ae:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8028b2:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  8028b6:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8028bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  8028bf:	90                   	nop
+  8028c0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8028c4:	01 c0                	add    %eax,%eax
+  8028c6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8028cd:	00 
+  8028ce:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  8028d2:	89 c6                	mov    %eax,%esi
+  8028d4:	89 d7                	mov    %edx,%edi
+  8028d6:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8028da:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8028de:	0f ad d0             	shrd   %cl,%edx,%eax
+  8028e1:	d3 ea                	shr    %cl,%edx
+  8028e3:	f6 c1 20             	test   $0x20,%cl
+  8028e6:	0f 45 c2             	cmovne %edx,%eax
+  8028e9:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8028ed:	83 e0 01             	and    $0x1,%eax
+  8028f0:	09 fa                	or     %edi,%edx
+  8028f2:	89 04 24             	mov    %eax,(%esp)
+  8028f5:	8b 04 24             	mov    (%esp),%eax
+  8028f8:	89 d7                	mov    %edx,%edi
+  8028fa:	09 f0                	or     %esi,%eax
+  8028fc:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  802900:	39 d8                	cmp    %ebx,%eax
+  802902:	19 f7                	sbb    %esi,%edi
+  802904:	72 04                	jb     80290a <__moddi3+0xaa>
+  802906:	29 d8                	sub    %ebx,%eax
+  802908:	19 f2                	sbb    %esi,%edx
+  80290a:	83 e9 01             	sub    $0x1,%ecx
+  80290d:	73 b1                	jae    8028c0 <__moddi3+0x60>
+  80290f:	85 ed                	test   %ebp,%ebp
+  802911:	74 07                	je     80291a <__moddi3+0xba>
+  802913:	f7 d8                	neg    %eax
+  802915:	83 d2 00             	adc    $0x0,%edx
+  802918:	f7 da                	neg    %edx
+  80291a:	83 c4 1c             	add    $0x1c,%esp
+  80291d:	5b                   	pop    %ebx
+  80291e:	5e                   	pop    %esi
+  80291f:	5f                   	pop    %edi
+  802920:	5d                   	pop    %ebp
+  802921:	c3                   	ret
+  802922:	09 cb                	or     %ecx,%ebx
+  802924:	74 f4                	je     80291a <__moddi3+0xba>
+  802926:	f7 df                	neg    %edi
+  802928:	bb 01 00 00 00       	mov    $0x1,%ebx
+  80292d:	83 d5 00             	adc    $0x0,%ebp
+  802930:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802934:	f7 dd                	neg    %ebp
+  802936:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  80293a:	e9 58 ff ff ff       	jmp    802897 <__moddi3+0x37>
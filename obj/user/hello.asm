@@ -0,0 +1,5264 @@
+
+obj/user/hello.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 2d 00 00 00       	call   80005e <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+// hello, world
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 14             	sub    $0x14,%esp
+	cprintf("hello, world\n");
+  800039:	68 20 25 80 00       	push   $0x802520
+  80003e:	e8 13 01 00 00       	call   800156 <cprintf>
+	cprintf("i am environment %08x\n", thisenv->env_id);
+  800043:	a1 08 40 80 00       	mov    0x804008,%eax
+  800048:	8b 40 48             	mov    0x48(%eax),%eax
+  80004b:	83 c4 08             	add    $0x8,%esp
+  80004e:	50                   	push   %eax
+  80004f:	68 2e 25 80 00       	push   $0x80252e
+  800054:	e8 fd 00 00 00       	call   800156 <cprintf>
+}
+  800059:	83 c4 10             	add    $0x10,%esp
+  80005c:	c9                   	leave
+  80005d:	c3                   	ret
+
+0080005e <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  80005e:	55                   	push   %ebp
+  80005f:	89 e5                	mov    %esp,%ebp
+  800061:	56                   	push   %esi
+  800062:	53                   	push   %ebx
+  800063:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800066:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  800069:	e8 4f 0a 00 00       	call   800abd <sys_getenvid>
+  80006e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800073:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800076:	c1 e0 04             	shl    $0x4,%eax
+  800079:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80007e:	a3 08 40 80 00       	mov    %eax,0x804008
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800083:	85 db                	test   %ebx,%ebx
+  800085:	7e 07                	jle    80008e <libmain+0x30>
+    binaryname = argv[0];
+  800087:	8b 06                	mov    (%esi),%eax
+  800089:	a3 00 30 80 00       	mov    %eax,0x803000
+
+  // call user main routine
+  umain(argc, argv);
+  80008e:	83 ec 08             	sub    $0x8,%esp
+  800091:	56                   	push   %esi
+  800092:	53                   	push   %ebx
+  800093:	e8 9b ff ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  800098:	e8 0a 00 00 00       	call   8000a7 <exit>
+}
+  80009d:	83 c4 10             	add    $0x10,%esp
+  8000a0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000a3:	5b                   	pop    %ebx
+  8000a4:	5e                   	pop    %esi
+  8000a5:	5d                   	pop    %ebp
+  8000a6:	c3                   	ret
+
+008000a7 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000a7:	55                   	push   %ebp
+  8000a8:	89 e5                	mov    %esp,%ebp
+  8000aa:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8000ad:	e8 f0 0e 00 00       	call   800fa2 <close_all>
+	sys_env_destroy(0);
+  8000b2:	83 ec 0c             	sub    $0xc,%esp
+  8000b5:	6a 00                	push   $0x0
+  8000b7:	e8 c0 09 00 00       	call   800a7c <sys_env_destroy>
+}
+  8000bc:	83 c4 10             	add    $0x10,%esp
+  8000bf:	c9                   	leave
+  8000c0:	c3                   	ret
+
+008000c1 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8000c1:	55                   	push   %ebp
+  8000c2:	89 e5                	mov    %esp,%ebp
+  8000c4:	53                   	push   %ebx
+  8000c5:	83 ec 04             	sub    $0x4,%esp
+  8000c8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8000cb:	8b 13                	mov    (%ebx),%edx
+  8000cd:	8d 42 01             	lea    0x1(%edx),%eax
+  8000d0:	89 03                	mov    %eax,(%ebx)
+  8000d2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8000d5:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8000d9:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8000de:	74 09                	je     8000e9 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8000e0:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8000e4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000e7:	c9                   	leave
+  8000e8:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8000e9:	83 ec 08             	sub    $0x8,%esp
+  8000ec:	68 ff 00 00 00       	push   $0xff
+  8000f1:	8d 43 08             	lea    0x8(%ebx),%eax
+  8000f4:	50                   	push   %eax
+  8000f5:	e8 45 09 00 00       	call   800a3f <sys_cputs>
+		b->idx = 0;
+  8000fa:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800100:	83 c4 10             	add    $0x10,%esp
+  800103:	eb db                	jmp    8000e0 <putch+0x1f>
+
+00800105 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800105:	55                   	push   %ebp
+  800106:	89 e5                	mov    %esp,%ebp
+  800108:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80010e:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800115:	00 00 00 
+	b.cnt = 0;
+  800118:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80011f:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800122:	ff 75 0c             	push   0xc(%ebp)
+  800125:	ff 75 08             	push   0x8(%ebp)
+  800128:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80012e:	50                   	push   %eax
+  80012f:	68 c1 00 80 00       	push   $0x8000c1
+  800134:	e8 14 01 00 00       	call   80024d <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800139:	83 c4 08             	add    $0x8,%esp
+  80013c:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800142:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800148:	50                   	push   %eax
+  800149:	e8 f1 08 00 00       	call   800a3f <sys_cputs>
+
+	return b.cnt;
+}
+  80014e:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800154:	c9                   	leave
+  800155:	c3                   	ret
+
+00800156 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800156:	55                   	push   %ebp
+  800157:	89 e5                	mov    %esp,%ebp
+  800159:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80015c:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80015f:	50                   	push   %eax
+  800160:	ff 75 08             	push   0x8(%ebp)
+  800163:	e8 9d ff ff ff       	call   800105 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800168:	c9                   	leave
+  800169:	c3                   	ret
+
+0080016a <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80016a:	55                   	push   %ebp
+  80016b:	89 e5                	mov    %esp,%ebp
+  80016d:	57                   	push   %edi
+  80016e:	56                   	push   %esi
+  80016f:	53                   	push   %ebx
+  800170:	83 ec 1c             	sub    $0x1c,%esp
+  800173:	89 c7                	mov    %eax,%edi
+  800175:	89 d6                	mov    %edx,%esi
+  800177:	8b 45 08             	mov    0x8(%ebp),%eax
+  80017a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80017d:	89 d1                	mov    %edx,%ecx
+  80017f:	89 c2                	mov    %eax,%edx
+  800181:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800184:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800187:	8b 45 10             	mov    0x10(%ebp),%eax
+  80018a:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80018d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800190:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800197:	39 c2                	cmp    %eax,%edx
+  800199:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80019c:	72 3e                	jb     8001dc <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80019e:	83 ec 0c             	sub    $0xc,%esp
+  8001a1:	ff 75 18             	push   0x18(%ebp)
+  8001a4:	83 eb 01             	sub    $0x1,%ebx
+  8001a7:	53                   	push   %ebx
+  8001a8:	50                   	push   %eax
+  8001a9:	83 ec 08             	sub    $0x8,%esp
+  8001ac:	ff 75 e4             	push   -0x1c(%ebp)
+  8001af:	ff 75 e0             	push   -0x20(%ebp)
+  8001b2:	ff 75 dc             	push   -0x24(%ebp)
+  8001b5:	ff 75 d8             	push   -0x28(%ebp)
+  8001b8:	e8 c3 1f 00 00       	call   802180 <__udivdi3>
+  8001bd:	83 c4 18             	add    $0x18,%esp
+  8001c0:	52                   	push   %edx
+  8001c1:	50                   	push   %eax
+  8001c2:	89 f2                	mov    %esi,%edx
+  8001c4:	89 f8                	mov    %edi,%eax
+  8001c6:	e8 9f ff ff ff       	call   80016a <printnum>
+  8001cb:	83 c4 20             	add    $0x20,%esp
+  8001ce:	eb 13                	jmp    8001e3 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8001d0:	83 ec 08             	sub    $0x8,%esp
+  8001d3:	56                   	push   %esi
+  8001d4:	ff 75 18             	push   0x18(%ebp)
+  8001d7:	ff d7                	call   *%edi
+  8001d9:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8001dc:	83 eb 01             	sub    $0x1,%ebx
+  8001df:	85 db                	test   %ebx,%ebx
+  8001e1:	7f ed                	jg     8001d0 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8001e3:	83 ec 08             	sub    $0x8,%esp
+  8001e6:	56                   	push   %esi
+  8001e7:	83 ec 04             	sub    $0x4,%esp
+  8001ea:	ff 75 e4             	push   -0x1c(%ebp)
+  8001ed:	ff 75 e0             	push   -0x20(%ebp)
+  8001f0:	ff 75 dc             	push   -0x24(%ebp)
+  8001f3:	ff 75 d8             	push   -0x28(%ebp)
+  8001f6:	e8 55 20 00 00       	call   802250 <__umoddi3>
+  8001fb:	83 c4 14             	add    $0x14,%esp
+  8001fe:	0f be 80 4f 25 80 00 	movsbl 0x80254f(%eax),%eax
+  800205:	50                   	push   %eax
+  800206:	ff d7                	call   *%edi
+}
+  800208:	83 c4 10             	add    $0x10,%esp
+  80020b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80020e:	5b                   	pop    %ebx
+  80020f:	5e                   	pop    %esi
+  800210:	5f                   	pop    %edi
+  800211:	5d                   	pop    %ebp
+  800212:	c3                   	ret
+
+00800213 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800213:	55                   	push   %ebp
+  800214:	89 e5                	mov    %esp,%ebp
+  800216:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800219:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80021d:	8b 10                	mov    (%eax),%edx
+  80021f:	3b 50 04             	cmp    0x4(%eax),%edx
+  800222:	73 0a                	jae    80022e <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800224:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800227:	89 08                	mov    %ecx,(%eax)
+  800229:	8b 45 08             	mov    0x8(%ebp),%eax
+  80022c:	88 02                	mov    %al,(%edx)
+}
+  80022e:	5d                   	pop    %ebp
+  80022f:	c3                   	ret
+
+00800230 <printfmt>:
+{
+  800230:	55                   	push   %ebp
+  800231:	89 e5                	mov    %esp,%ebp
+  800233:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800236:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800239:	50                   	push   %eax
+  80023a:	ff 75 10             	push   0x10(%ebp)
+  80023d:	ff 75 0c             	push   0xc(%ebp)
+  800240:	ff 75 08             	push   0x8(%ebp)
+  800243:	e8 05 00 00 00       	call   80024d <vprintfmt>
+}
+  800248:	83 c4 10             	add    $0x10,%esp
+  80024b:	c9                   	leave
+  80024c:	c3                   	ret
+
+0080024d <vprintfmt>:
+{
+  80024d:	55                   	push   %ebp
+  80024e:	89 e5                	mov    %esp,%ebp
+  800250:	57                   	push   %edi
+  800251:	56                   	push   %esi
+  800252:	53                   	push   %ebx
+  800253:	83 ec 2c             	sub    $0x2c,%esp
+  800256:	8b 75 08             	mov    0x8(%ebp),%esi
+  800259:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80025c:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80025f:	eb 0a                	jmp    80026b <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800261:	83 ec 08             	sub    $0x8,%esp
+  800264:	53                   	push   %ebx
+  800265:	50                   	push   %eax
+  800266:	ff d6                	call   *%esi
+  800268:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80026b:	83 c7 01             	add    $0x1,%edi
+  80026e:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800272:	83 f8 25             	cmp    $0x25,%eax
+  800275:	74 0c                	je     800283 <vprintfmt+0x36>
+			if (ch == '\0')
+  800277:	85 c0                	test   %eax,%eax
+  800279:	75 e6                	jne    800261 <vprintfmt+0x14>
+}
+  80027b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80027e:	5b                   	pop    %ebx
+  80027f:	5e                   	pop    %esi
+  800280:	5f                   	pop    %edi
+  800281:	5d                   	pop    %ebp
+  800282:	c3                   	ret
+		padc = ' ';
+  800283:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800287:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80028e:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800295:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80029c:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8002a1:	8d 47 01             	lea    0x1(%edi),%eax
+  8002a4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8002a7:	0f b6 17             	movzbl (%edi),%edx
+  8002aa:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8002ad:	3c 55                	cmp    $0x55,%al
+  8002af:	0f 87 9a 03 00 00    	ja     80064f <vprintfmt+0x402>
+  8002b5:	0f b6 c0             	movzbl %al,%eax
+  8002b8:	ff 24 85 a0 26 80 00 	jmp    *0x8026a0(,%eax,4)
+  8002bf:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8002c2:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8002c6:	eb d9                	jmp    8002a1 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8002c8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8002cb:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8002cf:	eb d0                	jmp    8002a1 <vprintfmt+0x54>
+  8002d1:	0f b6 d2             	movzbl %dl,%edx
+  8002d4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8002d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002dc:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8002df:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8002e2:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8002e6:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8002e9:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8002ec:	83 f9 09             	cmp    $0x9,%ecx
+  8002ef:	77 55                	ja     800346 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8002f1:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8002f4:	eb e9                	jmp    8002df <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8002f6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8002f9:	8b 00                	mov    (%eax),%eax
+  8002fb:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8002fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800301:	8d 40 04             	lea    0x4(%eax),%eax
+  800304:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800307:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80030a:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80030e:	79 91                	jns    8002a1 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800310:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800313:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800316:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80031d:	eb 82                	jmp    8002a1 <vprintfmt+0x54>
+			if (width < 0)
+  80031f:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800322:	85 d2                	test   %edx,%edx
+  800324:	b8 00 00 00 00       	mov    $0x0,%eax
+  800329:	0f 49 c2             	cmovns %edx,%eax
+  80032c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80032f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800332:	e9 6a ff ff ff       	jmp    8002a1 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800337:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80033a:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800341:	e9 5b ff ff ff       	jmp    8002a1 <vprintfmt+0x54>
+  800346:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800349:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80034c:	eb bc                	jmp    80030a <vprintfmt+0xbd>
+			lflag++;
+  80034e:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800351:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800354:	e9 48 ff ff ff       	jmp    8002a1 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800359:	8b 45 14             	mov    0x14(%ebp),%eax
+  80035c:	8d 78 04             	lea    0x4(%eax),%edi
+  80035f:	83 ec 08             	sub    $0x8,%esp
+  800362:	53                   	push   %ebx
+  800363:	ff 30                	push   (%eax)
+  800365:	ff d6                	call   *%esi
+			break;
+  800367:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80036a:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80036d:	e9 7c 02 00 00       	jmp    8005ee <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  800372:	8b 45 14             	mov    0x14(%ebp),%eax
+  800375:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800378:	8b 10                	mov    (%eax),%edx
+  80037a:	89 d0                	mov    %edx,%eax
+  80037c:	f7 d8                	neg    %eax
+  80037e:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800381:	83 f8 10             	cmp    $0x10,%eax
+  800384:	7f 23                	jg     8003a9 <vprintfmt+0x15c>
+  800386:	8b 14 85 00 28 80 00 	mov    0x802800(,%eax,4),%edx
+  80038d:	85 d2                	test   %edx,%edx
+  80038f:	74 18                	je     8003a9 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800391:	52                   	push   %edx
+  800392:	68 39 29 80 00       	push   $0x802939
+  800397:	53                   	push   %ebx
+  800398:	56                   	push   %esi
+  800399:	e8 92 fe ff ff       	call   800230 <printfmt>
+  80039e:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003a1:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8003a4:	e9 45 02 00 00       	jmp    8005ee <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  8003a9:	50                   	push   %eax
+  8003aa:	68 67 25 80 00       	push   $0x802567
+  8003af:	53                   	push   %ebx
+  8003b0:	56                   	push   %esi
+  8003b1:	e8 7a fe ff ff       	call   800230 <printfmt>
+  8003b6:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003b9:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8003bc:	e9 2d 02 00 00       	jmp    8005ee <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8003c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003c4:	83 c0 04             	add    $0x4,%eax
+  8003c7:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8003ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003cd:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8003cf:	85 c9                	test   %ecx,%ecx
+  8003d1:	b8 60 25 80 00       	mov    $0x802560,%eax
+  8003d6:	0f 45 c1             	cmovne %ecx,%eax
+  8003d9:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8003dc:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003e0:	7e 06                	jle    8003e8 <vprintfmt+0x19b>
+  8003e2:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8003e6:	75 0b                	jne    8003f3 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8003e8:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8003eb:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8003ee:	89 75 08             	mov    %esi,0x8(%ebp)
+  8003f1:	eb 5c                	jmp    80044f <vprintfmt+0x202>
+  8003f3:	83 ec 08             	sub    $0x8,%esp
+  8003f6:	ff 75 d0             	push   -0x30(%ebp)
+  8003f9:	ff 75 cc             	push   -0x34(%ebp)
+  8003fc:	e8 eb 02 00 00       	call   8006ec <strnlen>
+  800401:	89 c2                	mov    %eax,%edx
+  800403:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800406:	29 d0                	sub    %edx,%eax
+  800408:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80040b:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80040f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800412:	89 75 08             	mov    %esi,0x8(%ebp)
+  800415:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800417:	eb 0e                	jmp    800427 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800419:	83 ec 08             	sub    $0x8,%esp
+  80041c:	53                   	push   %ebx
+  80041d:	57                   	push   %edi
+  80041e:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800421:	83 ee 01             	sub    $0x1,%esi
+  800424:	83 c4 10             	add    $0x10,%esp
+  800427:	85 f6                	test   %esi,%esi
+  800429:	7f ee                	jg     800419 <vprintfmt+0x1cc>
+  80042b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80042e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800431:	85 c0                	test   %eax,%eax
+  800433:	ba 00 00 00 00       	mov    $0x0,%edx
+  800438:	0f 49 d0             	cmovns %eax,%edx
+  80043b:	29 d0                	sub    %edx,%eax
+  80043d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800440:	eb a6                	jmp    8003e8 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800442:	83 ec 08             	sub    $0x8,%esp
+  800445:	53                   	push   %ebx
+  800446:	52                   	push   %edx
+  800447:	ff 55 08             	call   *0x8(%ebp)
+  80044a:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80044d:	89 f1                	mov    %esi,%ecx
+  80044f:	8d 71 01             	lea    0x1(%ecx),%esi
+  800452:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800456:	0f be d0             	movsbl %al,%edx
+  800459:	85 d2                	test   %edx,%edx
+  80045b:	74 28                	je     800485 <vprintfmt+0x238>
+  80045d:	85 ff                	test   %edi,%edi
+  80045f:	78 05                	js     800466 <vprintfmt+0x219>
+  800461:	83 ef 01             	sub    $0x1,%edi
+  800464:	78 30                	js     800496 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800466:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80046a:	74 d6                	je     800442 <vprintfmt+0x1f5>
+  80046c:	0f be c0             	movsbl %al,%eax
+  80046f:	83 e8 20             	sub    $0x20,%eax
+  800472:	83 f8 5e             	cmp    $0x5e,%eax
+  800475:	76 cb                	jbe    800442 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800477:	83 ec 08             	sub    $0x8,%esp
+  80047a:	53                   	push   %ebx
+  80047b:	6a 3f                	push   $0x3f
+  80047d:	ff 55 08             	call   *0x8(%ebp)
+  800480:	83 c4 10             	add    $0x10,%esp
+  800483:	eb c8                	jmp    80044d <vprintfmt+0x200>
+  800485:	8b 75 08             	mov    0x8(%ebp),%esi
+  800488:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80048b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80048e:	01 d0                	add    %edx,%eax
+  800490:	29 c8                	sub    %ecx,%eax
+  800492:	89 c7                	mov    %eax,%edi
+  800494:	eb 13                	jmp    8004a9 <vprintfmt+0x25c>
+  800496:	8b 75 08             	mov    0x8(%ebp),%esi
+  800499:	eb ed                	jmp    800488 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80049b:	83 ec 08             	sub    $0x8,%esp
+  80049e:	53                   	push   %ebx
+  80049f:	6a 20                	push   $0x20
+  8004a1:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8004a3:	83 ef 01             	sub    $0x1,%edi
+  8004a6:	83 c4 10             	add    $0x10,%esp
+  8004a9:	85 ff                	test   %edi,%edi
+  8004ab:	7f ee                	jg     80049b <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004ad:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8004b0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004b3:	e9 36 01 00 00       	jmp    8005ee <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  8004b8:	83 f9 01             	cmp    $0x1,%ecx
+  8004bb:	7f 1f                	jg     8004dc <vprintfmt+0x28f>
+	else if (lflag)
+  8004bd:	85 c9                	test   %ecx,%ecx
+  8004bf:	74 67                	je     800528 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8004c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004c4:	8b 00                	mov    (%eax),%eax
+  8004c6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004c9:	89 c1                	mov    %eax,%ecx
+  8004cb:	c1 f9 1f             	sar    $0x1f,%ecx
+  8004ce:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8004d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004d4:	8d 40 04             	lea    0x4(%eax),%eax
+  8004d7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004da:	eb 17                	jmp    8004f3 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8004dc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004df:	8b 50 04             	mov    0x4(%eax),%edx
+  8004e2:	8b 00                	mov    (%eax),%eax
+  8004e4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004e7:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8004ea:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004ed:	8d 40 08             	lea    0x8(%eax),%eax
+  8004f0:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8004f3:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8004f6:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8004f9:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8004fe:	85 c9                	test   %ecx,%ecx
+  800500:	0f 89 ce 00 00 00    	jns    8005d4 <vprintfmt+0x387>
+				putch('-', putdat);
+  800506:	83 ec 08             	sub    $0x8,%esp
+  800509:	53                   	push   %ebx
+  80050a:	6a 2d                	push   $0x2d
+  80050c:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80050e:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800511:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800514:	f7 da                	neg    %edx
+  800516:	83 d1 00             	adc    $0x0,%ecx
+  800519:	f7 d9                	neg    %ecx
+  80051b:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80051e:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800523:	e9 ac 00 00 00       	jmp    8005d4 <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  800528:	8b 45 14             	mov    0x14(%ebp),%eax
+  80052b:	8b 00                	mov    (%eax),%eax
+  80052d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800530:	89 c1                	mov    %eax,%ecx
+  800532:	c1 f9 1f             	sar    $0x1f,%ecx
+  800535:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800538:	8b 45 14             	mov    0x14(%ebp),%eax
+  80053b:	8d 40 04             	lea    0x4(%eax),%eax
+  80053e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800541:	eb b0                	jmp    8004f3 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800543:	83 f9 01             	cmp    $0x1,%ecx
+  800546:	7f 1b                	jg     800563 <vprintfmt+0x316>
+	else if (lflag)
+  800548:	85 c9                	test   %ecx,%ecx
+  80054a:	74 2c                	je     800578 <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  80054c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80054f:	8b 10                	mov    (%eax),%edx
+  800551:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800556:	8d 40 04             	lea    0x4(%eax),%eax
+  800559:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80055c:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800561:	eb 71                	jmp    8005d4 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  800563:	8b 45 14             	mov    0x14(%ebp),%eax
+  800566:	8b 10                	mov    (%eax),%edx
+  800568:	8b 48 04             	mov    0x4(%eax),%ecx
+  80056b:	8d 40 08             	lea    0x8(%eax),%eax
+  80056e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800571:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800576:	eb 5c                	jmp    8005d4 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  800578:	8b 45 14             	mov    0x14(%ebp),%eax
+  80057b:	8b 10                	mov    (%eax),%edx
+  80057d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800582:	8d 40 04             	lea    0x4(%eax),%eax
+  800585:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800588:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80058d:	eb 45                	jmp    8005d4 <vprintfmt+0x387>
+			putch('X', putdat);
+  80058f:	83 ec 08             	sub    $0x8,%esp
+  800592:	53                   	push   %ebx
+  800593:	6a 58                	push   $0x58
+  800595:	ff d6                	call   *%esi
+			putch('X', putdat);
+  800597:	83 c4 08             	add    $0x8,%esp
+  80059a:	53                   	push   %ebx
+  80059b:	6a 58                	push   $0x58
+  80059d:	ff d6                	call   *%esi
+			putch('X', putdat);
+  80059f:	83 c4 08             	add    $0x8,%esp
+  8005a2:	53                   	push   %ebx
+  8005a3:	6a 58                	push   $0x58
+  8005a5:	ff d6                	call   *%esi
+			break;
+  8005a7:	83 c4 10             	add    $0x10,%esp
+  8005aa:	eb 42                	jmp    8005ee <vprintfmt+0x3a1>
+			putch('0', putdat);
+  8005ac:	83 ec 08             	sub    $0x8,%esp
+  8005af:	53                   	push   %ebx
+  8005b0:	6a 30                	push   $0x30
+  8005b2:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8005b4:	83 c4 08             	add    $0x8,%esp
+  8005b7:	53                   	push   %ebx
+  8005b8:	6a 78                	push   $0x78
+  8005ba:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8005bc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005bf:	8b 10                	mov    (%eax),%edx
+  8005c1:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8005c6:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8005c9:	8d 40 04             	lea    0x4(%eax),%eax
+  8005cc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8005cf:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8005d4:	83 ec 0c             	sub    $0xc,%esp
+  8005d7:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8005db:	50                   	push   %eax
+  8005dc:	ff 75 e0             	push   -0x20(%ebp)
+  8005df:	57                   	push   %edi
+  8005e0:	51                   	push   %ecx
+  8005e1:	52                   	push   %edx
+  8005e2:	89 da                	mov    %ebx,%edx
+  8005e4:	89 f0                	mov    %esi,%eax
+  8005e6:	e8 7f fb ff ff       	call   80016a <printnum>
+			break;
+  8005eb:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8005ee:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8005f1:	e9 75 fc ff ff       	jmp    80026b <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8005f6:	83 f9 01             	cmp    $0x1,%ecx
+  8005f9:	7f 1b                	jg     800616 <vprintfmt+0x3c9>
+	else if (lflag)
+  8005fb:	85 c9                	test   %ecx,%ecx
+  8005fd:	74 2c                	je     80062b <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  8005ff:	8b 45 14             	mov    0x14(%ebp),%eax
+  800602:	8b 10                	mov    (%eax),%edx
+  800604:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800609:	8d 40 04             	lea    0x4(%eax),%eax
+  80060c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80060f:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800614:	eb be                	jmp    8005d4 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  800616:	8b 45 14             	mov    0x14(%ebp),%eax
+  800619:	8b 10                	mov    (%eax),%edx
+  80061b:	8b 48 04             	mov    0x4(%eax),%ecx
+  80061e:	8d 40 08             	lea    0x8(%eax),%eax
+  800621:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800624:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800629:	eb a9                	jmp    8005d4 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  80062b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062e:	8b 10                	mov    (%eax),%edx
+  800630:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800635:	8d 40 04             	lea    0x4(%eax),%eax
+  800638:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80063b:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800640:	eb 92                	jmp    8005d4 <vprintfmt+0x387>
+			putch(ch, putdat);
+  800642:	83 ec 08             	sub    $0x8,%esp
+  800645:	53                   	push   %ebx
+  800646:	6a 25                	push   $0x25
+  800648:	ff d6                	call   *%esi
+			break;
+  80064a:	83 c4 10             	add    $0x10,%esp
+  80064d:	eb 9f                	jmp    8005ee <vprintfmt+0x3a1>
+			putch('%', putdat);
+  80064f:	83 ec 08             	sub    $0x8,%esp
+  800652:	53                   	push   %ebx
+  800653:	6a 25                	push   $0x25
+  800655:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800657:	83 c4 10             	add    $0x10,%esp
+  80065a:	89 f8                	mov    %edi,%eax
+  80065c:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800660:	74 05                	je     800667 <vprintfmt+0x41a>
+  800662:	83 e8 01             	sub    $0x1,%eax
+  800665:	eb f5                	jmp    80065c <vprintfmt+0x40f>
+  800667:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80066a:	eb 82                	jmp    8005ee <vprintfmt+0x3a1>
+
+0080066c <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80066c:	55                   	push   %ebp
+  80066d:	89 e5                	mov    %esp,%ebp
+  80066f:	83 ec 18             	sub    $0x18,%esp
+  800672:	8b 45 08             	mov    0x8(%ebp),%eax
+  800675:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800678:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80067b:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80067f:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800682:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800689:	85 c0                	test   %eax,%eax
+  80068b:	74 26                	je     8006b3 <vsnprintf+0x47>
+  80068d:	85 d2                	test   %edx,%edx
+  80068f:	7e 22                	jle    8006b3 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800691:	ff 75 14             	push   0x14(%ebp)
+  800694:	ff 75 10             	push   0x10(%ebp)
+  800697:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80069a:	50                   	push   %eax
+  80069b:	68 13 02 80 00       	push   $0x800213
+  8006a0:	e8 a8 fb ff ff       	call   80024d <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8006a5:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8006a8:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8006ab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8006ae:	83 c4 10             	add    $0x10,%esp
+}
+  8006b1:	c9                   	leave
+  8006b2:	c3                   	ret
+		return -E_INVAL;
+  8006b3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006b8:	eb f7                	jmp    8006b1 <vsnprintf+0x45>
+
+008006ba <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8006ba:	55                   	push   %ebp
+  8006bb:	89 e5                	mov    %esp,%ebp
+  8006bd:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8006c0:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8006c3:	50                   	push   %eax
+  8006c4:	ff 75 10             	push   0x10(%ebp)
+  8006c7:	ff 75 0c             	push   0xc(%ebp)
+  8006ca:	ff 75 08             	push   0x8(%ebp)
+  8006cd:	e8 9a ff ff ff       	call   80066c <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8006d2:	c9                   	leave
+  8006d3:	c3                   	ret
+
+008006d4 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8006d4:	55                   	push   %ebp
+  8006d5:	89 e5                	mov    %esp,%ebp
+  8006d7:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8006da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006df:	eb 03                	jmp    8006e4 <strlen+0x10>
+		n++;
+  8006e1:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8006e4:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8006e8:	75 f7                	jne    8006e1 <strlen+0xd>
+	return n;
+}
+  8006ea:	5d                   	pop    %ebp
+  8006eb:	c3                   	ret
+
+008006ec <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8006ec:	55                   	push   %ebp
+  8006ed:	89 e5                	mov    %esp,%ebp
+  8006ef:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8006f2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8006f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006fa:	eb 03                	jmp    8006ff <strnlen+0x13>
+		n++;
+  8006fc:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8006ff:	39 d0                	cmp    %edx,%eax
+  800701:	74 08                	je     80070b <strnlen+0x1f>
+  800703:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800707:	75 f3                	jne    8006fc <strnlen+0x10>
+  800709:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80070b:	89 d0                	mov    %edx,%eax
+  80070d:	5d                   	pop    %ebp
+  80070e:	c3                   	ret
+
+0080070f <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80070f:	55                   	push   %ebp
+  800710:	89 e5                	mov    %esp,%ebp
+  800712:	53                   	push   %ebx
+  800713:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800716:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800719:	b8 00 00 00 00       	mov    $0x0,%eax
+  80071e:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800722:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800725:	83 c0 01             	add    $0x1,%eax
+  800728:	84 d2                	test   %dl,%dl
+  80072a:	75 f2                	jne    80071e <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80072c:	89 c8                	mov    %ecx,%eax
+  80072e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800731:	c9                   	leave
+  800732:	c3                   	ret
+
+00800733 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800733:	55                   	push   %ebp
+  800734:	89 e5                	mov    %esp,%ebp
+  800736:	53                   	push   %ebx
+  800737:	83 ec 10             	sub    $0x10,%esp
+  80073a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80073d:	53                   	push   %ebx
+  80073e:	e8 91 ff ff ff       	call   8006d4 <strlen>
+  800743:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800746:	ff 75 0c             	push   0xc(%ebp)
+  800749:	01 d8                	add    %ebx,%eax
+  80074b:	50                   	push   %eax
+  80074c:	e8 be ff ff ff       	call   80070f <strcpy>
+	return dst;
+}
+  800751:	89 d8                	mov    %ebx,%eax
+  800753:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800756:	c9                   	leave
+  800757:	c3                   	ret
+
+00800758 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800758:	55                   	push   %ebp
+  800759:	89 e5                	mov    %esp,%ebp
+  80075b:	56                   	push   %esi
+  80075c:	53                   	push   %ebx
+  80075d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800760:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800763:	89 f3                	mov    %esi,%ebx
+  800765:	03 5d 10             	add    0x10(%ebp),%ebx
+  800768:	89 f0                	mov    %esi,%eax
+  80076a:	eb 0f                	jmp    80077b <strncpy+0x23>
+		*dst++ = *src;
+  80076c:	83 c0 01             	add    $0x1,%eax
+  80076f:	0f b6 0a             	movzbl (%edx),%ecx
+  800772:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800775:	80 f9 01             	cmp    $0x1,%cl
+  800778:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80077b:	39 d8                	cmp    %ebx,%eax
+  80077d:	75 ed                	jne    80076c <strncpy+0x14>
+	}
+	return ret;
+}
+  80077f:	89 f0                	mov    %esi,%eax
+  800781:	5b                   	pop    %ebx
+  800782:	5e                   	pop    %esi
+  800783:	5d                   	pop    %ebp
+  800784:	c3                   	ret
+
+00800785 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800785:	55                   	push   %ebp
+  800786:	89 e5                	mov    %esp,%ebp
+  800788:	56                   	push   %esi
+  800789:	53                   	push   %ebx
+  80078a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80078d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800790:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800793:	89 f0                	mov    %esi,%eax
+  800795:	85 d2                	test   %edx,%edx
+  800797:	74 21                	je     8007ba <strlcpy+0x35>
+  800799:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80079d:	89 f2                	mov    %esi,%edx
+  80079f:	eb 09                	jmp    8007aa <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8007a1:	83 c1 01             	add    $0x1,%ecx
+  8007a4:	83 c2 01             	add    $0x1,%edx
+  8007a7:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8007aa:	39 c2                	cmp    %eax,%edx
+  8007ac:	74 09                	je     8007b7 <strlcpy+0x32>
+  8007ae:	0f b6 19             	movzbl (%ecx),%ebx
+  8007b1:	84 db                	test   %bl,%bl
+  8007b3:	75 ec                	jne    8007a1 <strlcpy+0x1c>
+  8007b5:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8007b7:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8007ba:	29 f0                	sub    %esi,%eax
+}
+  8007bc:	5b                   	pop    %ebx
+  8007bd:	5e                   	pop    %esi
+  8007be:	5d                   	pop    %ebp
+  8007bf:	c3                   	ret
+
+008007c0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8007c0:	55                   	push   %ebp
+  8007c1:	89 e5                	mov    %esp,%ebp
+  8007c3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007c6:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8007c9:	eb 06                	jmp    8007d1 <strcmp+0x11>
+		p++, q++;
+  8007cb:	83 c1 01             	add    $0x1,%ecx
+  8007ce:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8007d1:	0f b6 01             	movzbl (%ecx),%eax
+  8007d4:	84 c0                	test   %al,%al
+  8007d6:	74 04                	je     8007dc <strcmp+0x1c>
+  8007d8:	3a 02                	cmp    (%edx),%al
+  8007da:	74 ef                	je     8007cb <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8007dc:	0f b6 c0             	movzbl %al,%eax
+  8007df:	0f b6 12             	movzbl (%edx),%edx
+  8007e2:	29 d0                	sub    %edx,%eax
+}
+  8007e4:	5d                   	pop    %ebp
+  8007e5:	c3                   	ret
+
+008007e6 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8007e6:	55                   	push   %ebp
+  8007e7:	89 e5                	mov    %esp,%ebp
+  8007e9:	53                   	push   %ebx
+  8007ea:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007ed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007f0:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8007f3:	eb 09                	jmp    8007fe <strncmp+0x18>
+		n--, p++, q++;
+  8007f5:	83 ea 01             	sub    $0x1,%edx
+  8007f8:	83 c0 01             	add    $0x1,%eax
+  8007fb:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8007fe:	85 d2                	test   %edx,%edx
+  800800:	74 18                	je     80081a <strncmp+0x34>
+  800802:	0f b6 18             	movzbl (%eax),%ebx
+  800805:	84 db                	test   %bl,%bl
+  800807:	74 04                	je     80080d <strncmp+0x27>
+  800809:	3a 19                	cmp    (%ecx),%bl
+  80080b:	74 e8                	je     8007f5 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80080d:	0f b6 00             	movzbl (%eax),%eax
+  800810:	0f b6 11             	movzbl (%ecx),%edx
+  800813:	29 d0                	sub    %edx,%eax
+}
+  800815:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800818:	c9                   	leave
+  800819:	c3                   	ret
+		return 0;
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	eb f4                	jmp    800815 <strncmp+0x2f>
+
+00800821 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800821:	55                   	push   %ebp
+  800822:	89 e5                	mov    %esp,%ebp
+  800824:	8b 45 08             	mov    0x8(%ebp),%eax
+  800827:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80082b:	eb 03                	jmp    800830 <strchr+0xf>
+  80082d:	83 c0 01             	add    $0x1,%eax
+  800830:	0f b6 10             	movzbl (%eax),%edx
+  800833:	84 d2                	test   %dl,%dl
+  800835:	74 06                	je     80083d <strchr+0x1c>
+		if (*s == c)
+  800837:	38 ca                	cmp    %cl,%dl
+  800839:	75 f2                	jne    80082d <strchr+0xc>
+  80083b:	eb 05                	jmp    800842 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  80083d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800842:	5d                   	pop    %ebp
+  800843:	c3                   	ret
+
+00800844 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800844:	55                   	push   %ebp
+  800845:	89 e5                	mov    %esp,%ebp
+  800847:	8b 45 08             	mov    0x8(%ebp),%eax
+  80084a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80084e:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800851:	38 ca                	cmp    %cl,%dl
+  800853:	74 09                	je     80085e <strfind+0x1a>
+  800855:	84 d2                	test   %dl,%dl
+  800857:	74 05                	je     80085e <strfind+0x1a>
+	for (; *s; s++)
+  800859:	83 c0 01             	add    $0x1,%eax
+  80085c:	eb f0                	jmp    80084e <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  80085e:	5d                   	pop    %ebp
+  80085f:	c3                   	ret
+
+00800860 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800860:	55                   	push   %ebp
+  800861:	89 e5                	mov    %esp,%ebp
+  800863:	57                   	push   %edi
+  800864:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800867:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  80086a:	85 c9                	test   %ecx,%ecx
+  80086c:	74 20                	je     80088e <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  80086e:	89 f8                	mov    %edi,%eax
+  800870:	09 c8                	or     %ecx,%eax
+  800872:	a8 03                	test   $0x3,%al
+  800874:	75 12                	jne    800888 <memset+0x28>
+		c &= 0xFF;
+  800876:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80087a:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800880:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800883:	fc                   	cld
+  800884:	f3 ab                	rep stos %eax,%es:(%edi)
+  800886:	eb 06                	jmp    80088e <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800888:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80088b:	fc                   	cld
+  80088c:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  80088e:	89 f8                	mov    %edi,%eax
+  800890:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800893:	c9                   	leave
+  800894:	c3                   	ret
+
+00800895 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800895:	55                   	push   %ebp
+  800896:	89 e5                	mov    %esp,%ebp
+  800898:	57                   	push   %edi
+  800899:	56                   	push   %esi
+  80089a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80089d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8008a0:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8008a3:	39 c6                	cmp    %eax,%esi
+  8008a5:	73 32                	jae    8008d9 <memmove+0x44>
+  8008a7:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8008aa:	39 d0                	cmp    %edx,%eax
+  8008ac:	73 2b                	jae    8008d9 <memmove+0x44>
+		s += n;
+		d += n;
+  8008ae:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8008b1:	89 d6                	mov    %edx,%esi
+  8008b3:	09 fe                	or     %edi,%esi
+  8008b5:	09 ce                	or     %ecx,%esi
+  8008b7:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8008bd:	75 0e                	jne    8008cd <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8008bf:	83 ef 04             	sub    $0x4,%edi
+  8008c2:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8008c5:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8008c8:	fd                   	std
+  8008c9:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8008cb:	eb 09                	jmp    8008d6 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8008cd:	83 ef 01             	sub    $0x1,%edi
+  8008d0:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8008d3:	fd                   	std
+  8008d4:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8008d6:	fc                   	cld
+  8008d7:	eb 1a                	jmp    8008f3 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8008d9:	89 f2                	mov    %esi,%edx
+  8008db:	09 c2                	or     %eax,%edx
+  8008dd:	09 ca                	or     %ecx,%edx
+  8008df:	f6 c2 03             	test   $0x3,%dl
+  8008e2:	75 0a                	jne    8008ee <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8008e4:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8008e7:	89 c7                	mov    %eax,%edi
+  8008e9:	fc                   	cld
+  8008ea:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8008ec:	eb 05                	jmp    8008f3 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8008ee:	89 c7                	mov    %eax,%edi
+  8008f0:	fc                   	cld
+  8008f1:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8008f3:	5e                   	pop    %esi
+  8008f4:	5f                   	pop    %edi
+  8008f5:	5d                   	pop    %ebp
+  8008f6:	c3                   	ret
+
+008008f7 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8008f7:	55                   	push   %ebp
+  8008f8:	89 e5                	mov    %esp,%ebp
+  8008fa:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8008fd:	ff 75 10             	push   0x10(%ebp)
+  800900:	ff 75 0c             	push   0xc(%ebp)
+  800903:	ff 75 08             	push   0x8(%ebp)
+  800906:	e8 8a ff ff ff       	call   800895 <memmove>
+}
+  80090b:	c9                   	leave
+  80090c:	c3                   	ret
+
+0080090d <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  80090d:	55                   	push   %ebp
+  80090e:	89 e5                	mov    %esp,%ebp
+  800910:	56                   	push   %esi
+  800911:	53                   	push   %ebx
+  800912:	8b 45 08             	mov    0x8(%ebp),%eax
+  800915:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800918:	89 c6                	mov    %eax,%esi
+  80091a:	03 75 10             	add    0x10(%ebp),%esi
+  80091d:	eb 06                	jmp    800925 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  80091f:	83 c0 01             	add    $0x1,%eax
+  800922:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800925:	39 f0                	cmp    %esi,%eax
+  800927:	74 14                	je     80093d <memcmp+0x30>
+		if (*s1 != *s2)
+  800929:	0f b6 08             	movzbl (%eax),%ecx
+  80092c:	0f b6 1a             	movzbl (%edx),%ebx
+  80092f:	38 d9                	cmp    %bl,%cl
+  800931:	74 ec                	je     80091f <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800933:	0f b6 c1             	movzbl %cl,%eax
+  800936:	0f b6 db             	movzbl %bl,%ebx
+  800939:	29 d8                	sub    %ebx,%eax
+  80093b:	eb 05                	jmp    800942 <memcmp+0x35>
+	}
+
+	return 0;
+  80093d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800942:	5b                   	pop    %ebx
+  800943:	5e                   	pop    %esi
+  800944:	5d                   	pop    %ebp
+  800945:	c3                   	ret
+
+00800946 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800946:	55                   	push   %ebp
+  800947:	89 e5                	mov    %esp,%ebp
+  800949:	8b 45 08             	mov    0x8(%ebp),%eax
+  80094c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  80094f:	89 c2                	mov    %eax,%edx
+  800951:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800954:	eb 03                	jmp    800959 <memfind+0x13>
+  800956:	83 c0 01             	add    $0x1,%eax
+  800959:	39 d0                	cmp    %edx,%eax
+  80095b:	73 04                	jae    800961 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  80095d:	38 08                	cmp    %cl,(%eax)
+  80095f:	75 f5                	jne    800956 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800961:	5d                   	pop    %ebp
+  800962:	c3                   	ret
+
+00800963 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800963:	55                   	push   %ebp
+  800964:	89 e5                	mov    %esp,%ebp
+  800966:	57                   	push   %edi
+  800967:	56                   	push   %esi
+  800968:	53                   	push   %ebx
+  800969:	8b 55 08             	mov    0x8(%ebp),%edx
+  80096c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  80096f:	eb 03                	jmp    800974 <strtol+0x11>
+		s++;
+  800971:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800974:	0f b6 02             	movzbl (%edx),%eax
+  800977:	3c 20                	cmp    $0x20,%al
+  800979:	74 f6                	je     800971 <strtol+0xe>
+  80097b:	3c 09                	cmp    $0x9,%al
+  80097d:	74 f2                	je     800971 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  80097f:	3c 2b                	cmp    $0x2b,%al
+  800981:	74 2a                	je     8009ad <strtol+0x4a>
+	int neg = 0;
+  800983:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800988:	3c 2d                	cmp    $0x2d,%al
+  80098a:	74 2b                	je     8009b7 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80098c:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800992:	75 0f                	jne    8009a3 <strtol+0x40>
+  800994:	80 3a 30             	cmpb   $0x30,(%edx)
+  800997:	74 28                	je     8009c1 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800999:	85 db                	test   %ebx,%ebx
+  80099b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8009a0:	0f 44 d8             	cmove  %eax,%ebx
+  8009a3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009a8:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8009ab:	eb 46                	jmp    8009f3 <strtol+0x90>
+		s++;
+  8009ad:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  8009b0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009b5:	eb d5                	jmp    80098c <strtol+0x29>
+		s++, neg = 1;
+  8009b7:	83 c2 01             	add    $0x1,%edx
+  8009ba:	bf 01 00 00 00       	mov    $0x1,%edi
+  8009bf:	eb cb                	jmp    80098c <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009c1:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8009c5:	74 0e                	je     8009d5 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  8009c7:	85 db                	test   %ebx,%ebx
+  8009c9:	75 d8                	jne    8009a3 <strtol+0x40>
+		s++, base = 8;
+  8009cb:	83 c2 01             	add    $0x1,%edx
+  8009ce:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8009d3:	eb ce                	jmp    8009a3 <strtol+0x40>
+		s += 2, base = 16;
+  8009d5:	83 c2 02             	add    $0x2,%edx
+  8009d8:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8009dd:	eb c4                	jmp    8009a3 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  8009df:	0f be c0             	movsbl %al,%eax
+  8009e2:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  8009e5:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8009e8:	7d 3a                	jge    800a24 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  8009ea:	83 c2 01             	add    $0x1,%edx
+  8009ed:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  8009f1:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  8009f3:	0f b6 02             	movzbl (%edx),%eax
+  8009f6:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8009f9:	89 f3                	mov    %esi,%ebx
+  8009fb:	80 fb 09             	cmp    $0x9,%bl
+  8009fe:	76 df                	jbe    8009df <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a00:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a03:	89 f3                	mov    %esi,%ebx
+  800a05:	80 fb 19             	cmp    $0x19,%bl
+  800a08:	77 08                	ja     800a12 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800a0a:	0f be c0             	movsbl %al,%eax
+  800a0d:	83 e8 57             	sub    $0x57,%eax
+  800a10:	eb d3                	jmp    8009e5 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800a12:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800a15:	89 f3                	mov    %esi,%ebx
+  800a17:	80 fb 19             	cmp    $0x19,%bl
+  800a1a:	77 08                	ja     800a24 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800a1c:	0f be c0             	movsbl %al,%eax
+  800a1f:	83 e8 37             	sub    $0x37,%eax
+  800a22:	eb c1                	jmp    8009e5 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800a24:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800a28:	74 05                	je     800a2f <strtol+0xcc>
+		*endptr = (char *) s;
+  800a2a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a2d:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800a2f:	89 c8                	mov    %ecx,%eax
+  800a31:	f7 d8                	neg    %eax
+  800a33:	85 ff                	test   %edi,%edi
+  800a35:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800a38:	89 c8                	mov    %ecx,%eax
+  800a3a:	5b                   	pop    %ebx
+  800a3b:	5e                   	pop    %esi
+  800a3c:	5f                   	pop    %edi
+  800a3d:	5d                   	pop    %ebp
+  800a3e:	c3                   	ret
+
+00800a3f <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800a3f:	55                   	push   %ebp
+  800a40:	89 e5                	mov    %esp,%ebp
+  800a42:	57                   	push   %edi
+  800a43:	56                   	push   %esi
+  800a44:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800a45:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a4a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a4d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a50:	89 c3                	mov    %eax,%ebx
+  800a52:	89 c7                	mov    %eax,%edi
+  800a54:	89 c6                	mov    %eax,%esi
+  800a56:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  800a58:	5b                   	pop    %ebx
+  800a59:	5e                   	pop    %esi
+  800a5a:	5f                   	pop    %edi
+  800a5b:	5d                   	pop    %ebp
+  800a5c:	c3                   	ret
+
+00800a5d <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800a5d:	55                   	push   %ebp
+  800a5e:	89 e5                	mov    %esp,%ebp
+  800a60:	57                   	push   %edi
+  800a61:	56                   	push   %esi
+  800a62:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800a63:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a68:	b8 01 00 00 00       	mov    $0x1,%eax
+  800a6d:	89 d1                	mov    %edx,%ecx
+  800a6f:	89 d3                	mov    %edx,%ebx
+  800a71:	89 d7                	mov    %edx,%edi
+  800a73:	89 d6                	mov    %edx,%esi
+  800a75:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800a77:	5b                   	pop    %ebx
+  800a78:	5e                   	pop    %esi
+  800a79:	5f                   	pop    %edi
+  800a7a:	5d                   	pop    %ebp
+  800a7b:	c3                   	ret
+
+00800a7c <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800a7c:	55                   	push   %ebp
+  800a7d:	89 e5                	mov    %esp,%ebp
+  800a7f:	57                   	push   %edi
+  800a80:	56                   	push   %esi
+  800a81:	53                   	push   %ebx
+  800a82:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800a85:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a8a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a8d:	b8 03 00 00 00       	mov    $0x3,%eax
+  800a92:	89 cb                	mov    %ecx,%ebx
+  800a94:	89 cf                	mov    %ecx,%edi
+  800a96:	89 ce                	mov    %ecx,%esi
+  800a98:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800a9a:	85 c0                	test   %eax,%eax
+  800a9c:	7f 08                	jg     800aa6 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800a9e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800aa1:	5b                   	pop    %ebx
+  800aa2:	5e                   	pop    %esi
+  800aa3:	5f                   	pop    %edi
+  800aa4:	5d                   	pop    %ebp
+  800aa5:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800aa6:	83 ec 0c             	sub    $0xc,%esp
+  800aa9:	50                   	push   %eax
+  800aaa:	6a 03                	push   $0x3
+  800aac:	68 63 28 80 00       	push   $0x802863
+  800ab1:	6a 3e                	push   $0x3e
+  800ab3:	68 80 28 80 00       	push   $0x802880
+  800ab8:	e8 22 14 00 00       	call   801edf <_panic>
+
+00800abd <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800abd:	55                   	push   %ebp
+  800abe:	89 e5                	mov    %esp,%ebp
+  800ac0:	57                   	push   %edi
+  800ac1:	56                   	push   %esi
+  800ac2:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800ac3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ac8:	b8 02 00 00 00       	mov    $0x2,%eax
+  800acd:	89 d1                	mov    %edx,%ecx
+  800acf:	89 d3                	mov    %edx,%ebx
+  800ad1:	89 d7                	mov    %edx,%edi
+  800ad3:	89 d6                	mov    %edx,%esi
+  800ad5:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800ad7:	5b                   	pop    %ebx
+  800ad8:	5e                   	pop    %esi
+  800ad9:	5f                   	pop    %edi
+  800ada:	5d                   	pop    %ebp
+  800adb:	c3                   	ret
+
+00800adc <sys_yield>:
+
+void
+sys_yield(void) {
+  800adc:	55                   	push   %ebp
+  800add:	89 e5                	mov    %esp,%ebp
+  800adf:	57                   	push   %edi
+  800ae0:	56                   	push   %esi
+  800ae1:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800ae2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ae7:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800aec:	89 d1                	mov    %edx,%ecx
+  800aee:	89 d3                	mov    %edx,%ebx
+  800af0:	89 d7                	mov    %edx,%edi
+  800af2:	89 d6                	mov    %edx,%esi
+  800af4:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800af6:	5b                   	pop    %ebx
+  800af7:	5e                   	pop    %esi
+  800af8:	5f                   	pop    %edi
+  800af9:	5d                   	pop    %ebp
+  800afa:	c3                   	ret
+
+00800afb <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  800afb:	55                   	push   %ebp
+  800afc:	89 e5                	mov    %esp,%ebp
+  800afe:	57                   	push   %edi
+  800aff:	56                   	push   %esi
+  800b00:	53                   	push   %ebx
+  800b01:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800b04:	be 00 00 00 00       	mov    $0x0,%esi
+  800b09:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b0c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b0f:	b8 04 00 00 00       	mov    $0x4,%eax
+  800b14:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b17:	89 f7                	mov    %esi,%edi
+  800b19:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800b1b:	85 c0                	test   %eax,%eax
+  800b1d:	7f 08                	jg     800b27 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800b1f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b22:	5b                   	pop    %ebx
+  800b23:	5e                   	pop    %esi
+  800b24:	5f                   	pop    %edi
+  800b25:	5d                   	pop    %ebp
+  800b26:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800b27:	83 ec 0c             	sub    $0xc,%esp
+  800b2a:	50                   	push   %eax
+  800b2b:	6a 04                	push   $0x4
+  800b2d:	68 63 28 80 00       	push   $0x802863
+  800b32:	6a 3e                	push   $0x3e
+  800b34:	68 80 28 80 00       	push   $0x802880
+  800b39:	e8 a1 13 00 00       	call   801edf <_panic>
+
+00800b3e <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  800b3e:	55                   	push   %ebp
+  800b3f:	89 e5                	mov    %esp,%ebp
+  800b41:	57                   	push   %edi
+  800b42:	56                   	push   %esi
+  800b43:	53                   	push   %ebx
+  800b44:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800b47:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b4a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b4d:	b8 05 00 00 00       	mov    $0x5,%eax
+  800b52:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b55:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800b58:	8b 75 18             	mov    0x18(%ebp),%esi
+  800b5b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800b5d:	85 c0                	test   %eax,%eax
+  800b5f:	7f 08                	jg     800b69 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800b61:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b64:	5b                   	pop    %ebx
+  800b65:	5e                   	pop    %esi
+  800b66:	5f                   	pop    %edi
+  800b67:	5d                   	pop    %ebp
+  800b68:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800b69:	83 ec 0c             	sub    $0xc,%esp
+  800b6c:	50                   	push   %eax
+  800b6d:	6a 05                	push   $0x5
+  800b6f:	68 63 28 80 00       	push   $0x802863
+  800b74:	6a 3e                	push   $0x3e
+  800b76:	68 80 28 80 00       	push   $0x802880
+  800b7b:	e8 5f 13 00 00       	call   801edf <_panic>
+
+00800b80 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  800b80:	55                   	push   %ebp
+  800b81:	89 e5                	mov    %esp,%ebp
+  800b83:	57                   	push   %edi
+  800b84:	56                   	push   %esi
+  800b85:	53                   	push   %ebx
+  800b86:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800b89:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b8e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b91:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b94:	b8 06 00 00 00       	mov    $0x6,%eax
+  800b99:	89 df                	mov    %ebx,%edi
+  800b9b:	89 de                	mov    %ebx,%esi
+  800b9d:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800b9f:	85 c0                	test   %eax,%eax
+  800ba1:	7f 08                	jg     800bab <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800ba3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ba6:	5b                   	pop    %ebx
+  800ba7:	5e                   	pop    %esi
+  800ba8:	5f                   	pop    %edi
+  800ba9:	5d                   	pop    %ebp
+  800baa:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800bab:	83 ec 0c             	sub    $0xc,%esp
+  800bae:	50                   	push   %eax
+  800baf:	6a 06                	push   $0x6
+  800bb1:	68 63 28 80 00       	push   $0x802863
+  800bb6:	6a 3e                	push   $0x3e
+  800bb8:	68 80 28 80 00       	push   $0x802880
+  800bbd:	e8 1d 13 00 00       	call   801edf <_panic>
+
+00800bc2 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800bc2:	55                   	push   %ebp
+  800bc3:	89 e5                	mov    %esp,%ebp
+  800bc5:	57                   	push   %edi
+  800bc6:	56                   	push   %esi
+  800bc7:	53                   	push   %ebx
+  800bc8:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800bcb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800bd0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bd3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bd6:	b8 08 00 00 00       	mov    $0x8,%eax
+  800bdb:	89 df                	mov    %ebx,%edi
+  800bdd:	89 de                	mov    %ebx,%esi
+  800bdf:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800be1:	85 c0                	test   %eax,%eax
+  800be3:	7f 08                	jg     800bed <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800be5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800be8:	5b                   	pop    %ebx
+  800be9:	5e                   	pop    %esi
+  800bea:	5f                   	pop    %edi
+  800beb:	5d                   	pop    %ebp
+  800bec:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800bed:	83 ec 0c             	sub    $0xc,%esp
+  800bf0:	50                   	push   %eax
+  800bf1:	6a 08                	push   $0x8
+  800bf3:	68 63 28 80 00       	push   $0x802863
+  800bf8:	6a 3e                	push   $0x3e
+  800bfa:	68 80 28 80 00       	push   $0x802880
+  800bff:	e8 db 12 00 00       	call   801edf <_panic>
+
+00800c04 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800c04:	55                   	push   %ebp
+  800c05:	89 e5                	mov    %esp,%ebp
+  800c07:	57                   	push   %edi
+  800c08:	56                   	push   %esi
+  800c09:	53                   	push   %ebx
+  800c0a:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c0d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c12:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c15:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c18:	b8 09 00 00 00       	mov    $0x9,%eax
+  800c1d:	89 df                	mov    %ebx,%edi
+  800c1f:	89 de                	mov    %ebx,%esi
+  800c21:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c23:	85 c0                	test   %eax,%eax
+  800c25:	7f 08                	jg     800c2f <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800c27:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c2a:	5b                   	pop    %ebx
+  800c2b:	5e                   	pop    %esi
+  800c2c:	5f                   	pop    %edi
+  800c2d:	5d                   	pop    %ebp
+  800c2e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c2f:	83 ec 0c             	sub    $0xc,%esp
+  800c32:	50                   	push   %eax
+  800c33:	6a 09                	push   $0x9
+  800c35:	68 63 28 80 00       	push   $0x802863
+  800c3a:	6a 3e                	push   $0x3e
+  800c3c:	68 80 28 80 00       	push   $0x802880
+  800c41:	e8 99 12 00 00       	call   801edf <_panic>
+
+00800c46 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800c46:	55                   	push   %ebp
+  800c47:	89 e5                	mov    %esp,%ebp
+  800c49:	57                   	push   %edi
+  800c4a:	56                   	push   %esi
+  800c4b:	53                   	push   %ebx
+  800c4c:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c4f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c54:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c57:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c5a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c5f:	89 df                	mov    %ebx,%edi
+  800c61:	89 de                	mov    %ebx,%esi
+  800c63:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c65:	85 c0                	test   %eax,%eax
+  800c67:	7f 08                	jg     800c71 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800c69:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c6c:	5b                   	pop    %ebx
+  800c6d:	5e                   	pop    %esi
+  800c6e:	5f                   	pop    %edi
+  800c6f:	5d                   	pop    %ebp
+  800c70:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c71:	83 ec 0c             	sub    $0xc,%esp
+  800c74:	50                   	push   %eax
+  800c75:	6a 0a                	push   $0xa
+  800c77:	68 63 28 80 00       	push   $0x802863
+  800c7c:	6a 3e                	push   $0x3e
+  800c7e:	68 80 28 80 00       	push   $0x802880
+  800c83:	e8 57 12 00 00       	call   801edf <_panic>
+
+00800c88 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  800c88:	55                   	push   %ebp
+  800c89:	89 e5                	mov    %esp,%ebp
+  800c8b:	57                   	push   %edi
+  800c8c:	56                   	push   %esi
+  800c8d:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800c8e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c91:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c94:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800c99:	be 00 00 00 00       	mov    $0x0,%esi
+  800c9e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ca1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ca4:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800ca6:	5b                   	pop    %ebx
+  800ca7:	5e                   	pop    %esi
+  800ca8:	5f                   	pop    %edi
+  800ca9:	5d                   	pop    %ebp
+  800caa:	c3                   	ret
+
+00800cab <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  800cab:	55                   	push   %ebp
+  800cac:	89 e5                	mov    %esp,%ebp
+  800cae:	57                   	push   %edi
+  800caf:	56                   	push   %esi
+  800cb0:	53                   	push   %ebx
+  800cb1:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800cb4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cb9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cbc:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800cc1:	89 cb                	mov    %ecx,%ebx
+  800cc3:	89 cf                	mov    %ecx,%edi
+  800cc5:	89 ce                	mov    %ecx,%esi
+  800cc7:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800cc9:	85 c0                	test   %eax,%eax
+  800ccb:	7f 08                	jg     800cd5 <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  800ccd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cd0:	5b                   	pop    %ebx
+  800cd1:	5e                   	pop    %esi
+  800cd2:	5f                   	pop    %edi
+  800cd3:	5d                   	pop    %ebp
+  800cd4:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800cd5:	83 ec 0c             	sub    $0xc,%esp
+  800cd8:	50                   	push   %eax
+  800cd9:	6a 0d                	push   $0xd
+  800cdb:	68 63 28 80 00       	push   $0x802863
+  800ce0:	6a 3e                	push   $0x3e
+  800ce2:	68 80 28 80 00       	push   $0x802880
+  800ce7:	e8 f3 11 00 00       	call   801edf <_panic>
+
+00800cec <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  800cec:	55                   	push   %ebp
+  800ced:	89 e5                	mov    %esp,%ebp
+  800cef:	57                   	push   %edi
+  800cf0:	56                   	push   %esi
+  800cf1:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800cf2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cf7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cfa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cfd:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800d02:	89 df                	mov    %ebx,%edi
+  800d04:	89 de                	mov    %ebx,%esi
+  800d06:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  800d08:	5b                   	pop    %ebx
+  800d09:	5e                   	pop    %esi
+  800d0a:	5f                   	pop    %edi
+  800d0b:	5d                   	pop    %ebp
+  800d0c:	c3                   	ret
+
+00800d0d <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  800d0d:	55                   	push   %ebp
+  800d0e:	89 e5                	mov    %esp,%ebp
+  800d10:	57                   	push   %edi
+  800d11:	56                   	push   %esi
+  800d12:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d13:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d18:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d1b:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800d20:	89 cb                	mov    %ecx,%ebx
+  800d22:	89 cf                	mov    %ecx,%edi
+  800d24:	89 ce                	mov    %ecx,%esi
+  800d26:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  800d28:	5b                   	pop    %ebx
+  800d29:	5e                   	pop    %esi
+  800d2a:	5f                   	pop    %edi
+  800d2b:	5d                   	pop    %ebp
+  800d2c:	c3                   	ret
+
+00800d2d <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  800d2d:	55                   	push   %ebp
+  800d2e:	89 e5                	mov    %esp,%ebp
+  800d30:	57                   	push   %edi
+  800d31:	56                   	push   %esi
+  800d32:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d33:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d38:	b8 10 00 00 00       	mov    $0x10,%eax
+  800d3d:	89 d1                	mov    %edx,%ecx
+  800d3f:	89 d3                	mov    %edx,%ebx
+  800d41:	89 d7                	mov    %edx,%edi
+  800d43:	89 d6                	mov    %edx,%esi
+  800d45:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800d47:	5b                   	pop    %ebx
+  800d48:	5e                   	pop    %esi
+  800d49:	5f                   	pop    %edi
+  800d4a:	5d                   	pop    %ebp
+  800d4b:	c3                   	ret
+
+00800d4c <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  800d4c:	55                   	push   %ebp
+  800d4d:	89 e5                	mov    %esp,%ebp
+  800d4f:	57                   	push   %edi
+  800d50:	56                   	push   %esi
+  800d51:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d52:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d57:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d5a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d5d:	b8 11 00 00 00       	mov    $0x11,%eax
+  800d62:	89 df                	mov    %ebx,%edi
+  800d64:	89 de                	mov    %ebx,%esi
+  800d66:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800d68:	5b                   	pop    %ebx
+  800d69:	5e                   	pop    %esi
+  800d6a:	5f                   	pop    %edi
+  800d6b:	5d                   	pop    %ebp
+  800d6c:	c3                   	ret
+
+00800d6d <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  800d6d:	55                   	push   %ebp
+  800d6e:	89 e5                	mov    %esp,%ebp
+  800d70:	57                   	push   %edi
+  800d71:	56                   	push   %esi
+  800d72:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d73:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d78:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d7b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d7e:	b8 12 00 00 00       	mov    $0x12,%eax
+  800d83:	89 df                	mov    %ebx,%edi
+  800d85:	89 de                	mov    %ebx,%esi
+  800d87:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800d89:	5b                   	pop    %ebx
+  800d8a:	5e                   	pop    %esi
+  800d8b:	5f                   	pop    %edi
+  800d8c:	5d                   	pop    %ebp
+  800d8d:	c3                   	ret
+
+00800d8e <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  800d8e:	55                   	push   %ebp
+  800d8f:	89 e5                	mov    %esp,%ebp
+  800d91:	57                   	push   %edi
+  800d92:	56                   	push   %esi
+  800d93:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d94:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d99:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d9c:	b8 13 00 00 00       	mov    $0x13,%eax
+  800da1:	89 cb                	mov    %ecx,%ebx
+  800da3:	89 cf                	mov    %ecx,%edi
+  800da5:	89 ce                	mov    %ecx,%esi
+  800da7:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  800da9:	5b                   	pop    %ebx
+  800daa:	5e                   	pop    %esi
+  800dab:	5f                   	pop    %edi
+  800dac:	5d                   	pop    %ebp
+  800dad:	c3                   	ret
+
+00800dae <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  800dae:	55                   	push   %ebp
+  800daf:	89 e5                	mov    %esp,%ebp
+  800db1:	57                   	push   %edi
+  800db2:	56                   	push   %esi
+  800db3:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800db4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800db9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dbc:	b8 14 00 00 00       	mov    $0x14,%eax
+  800dc1:	89 cb                	mov    %ecx,%ebx
+  800dc3:	89 cf                	mov    %ecx,%edi
+  800dc5:	89 ce                	mov    %ecx,%esi
+  800dc7:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  800dc9:	5b                   	pop    %ebx
+  800dca:	5e                   	pop    %esi
+  800dcb:	5f                   	pop    %edi
+  800dcc:	5d                   	pop    %ebp
+  800dcd:	c3                   	ret
+
+00800dce <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800dce:	55                   	push   %ebp
+  800dcf:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800dd1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dd4:	05 00 00 00 30       	add    $0x30000000,%eax
+  800dd9:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800ddc:	5d                   	pop    %ebp
+  800ddd:	c3                   	ret
+
+00800dde <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800dde:	55                   	push   %ebp
+  800ddf:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800de1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800de4:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800de9:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800dee:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800df3:	5d                   	pop    %ebp
+  800df4:	c3                   	ret
+
+00800df5 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800df5:	55                   	push   %ebp
+  800df6:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  800df8:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800dfd:	eb 02                	jmp    800e01 <fd_alloc+0xc>
+  800dff:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800e01:	89 c2                	mov    %eax,%edx
+  800e03:	c1 ea 16             	shr    $0x16,%edx
+  800e06:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800e0d:	f6 c2 01             	test   $0x1,%dl
+  800e10:	74 2b                	je     800e3d <fd_alloc+0x48>
+  800e12:	89 c2                	mov    %eax,%edx
+  800e14:	c1 ea 0c             	shr    $0xc,%edx
+  800e17:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  800e1e:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  800e24:	f6 c1 01             	test   $0x1,%cl
+  800e27:	74 14                	je     800e3d <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  800e29:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  800e2f:	75 ce                	jne    800dff <fd_alloc+0xa>
+  800e31:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  800e36:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800e3b:	eb 05                	jmp    800e42 <fd_alloc+0x4d>
+			return 0;
+  800e3d:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  800e42:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e45:	89 02                	mov    %eax,(%edx)
+}
+  800e47:	89 c8                	mov    %ecx,%eax
+  800e49:	5d                   	pop    %ebp
+  800e4a:	c3                   	ret
+
+00800e4b <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  800e4b:	55                   	push   %ebp
+  800e4c:	89 e5                	mov    %esp,%ebp
+  800e4e:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  800e51:	83 f8 1f             	cmp    $0x1f,%eax
+  800e54:	77 30                	ja     800e86 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  800e56:	c1 e0 0c             	shl    $0xc,%eax
+  800e59:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800e5e:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  800e64:	f6 c2 01             	test   $0x1,%dl
+  800e67:	74 24                	je     800e8d <fd_lookup+0x42>
+  800e69:	89 c2                	mov    %eax,%edx
+  800e6b:	c1 ea 0c             	shr    $0xc,%edx
+  800e6e:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800e75:	f6 c2 01             	test   $0x1,%dl
+  800e78:	74 1a                	je     800e94 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  800e7a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800e7d:	89 02                	mov    %eax,(%edx)
+	return 0;
+  800e7f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e84:	5d                   	pop    %ebp
+  800e85:	c3                   	ret
+		return -E_INVAL;
+  800e86:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e8b:	eb f7                	jmp    800e84 <fd_lookup+0x39>
+		return -E_INVAL;
+  800e8d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e92:	eb f0                	jmp    800e84 <fd_lookup+0x39>
+  800e94:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e99:	eb e9                	jmp    800e84 <fd_lookup+0x39>
+
+00800e9b <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  800e9b:	55                   	push   %ebp
+  800e9c:	89 e5                	mov    %esp,%ebp
+  800e9e:	53                   	push   %ebx
+  800e9f:	83 ec 04             	sub    $0x4,%esp
+  800ea2:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  800ea5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800eaa:	eb 03                	jmp    800eaf <dev_lookup+0x14>
+  800eac:	83 c0 01             	add    $0x1,%eax
+  800eaf:	8b 1c 85 0c 29 80 00 	mov    0x80290c(,%eax,4),%ebx
+  800eb6:	85 db                	test   %ebx,%ebx
+  800eb8:	74 0b                	je     800ec5 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  800eba:	39 13                	cmp    %edx,(%ebx)
+  800ebc:	75 ee                	jne    800eac <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  800ebe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ec3:	eb 1f                	jmp    800ee4 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800ec5:	a1 08 40 80 00       	mov    0x804008,%eax
+  800eca:	8b 40 48             	mov    0x48(%eax),%eax
+  800ecd:	83 ec 04             	sub    $0x4,%esp
+  800ed0:	52                   	push   %edx
+  800ed1:	50                   	push   %eax
+  800ed2:	68 90 28 80 00       	push   $0x802890
+  800ed7:	e8 7a f2 ff ff       	call   800156 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  800edc:	83 c4 10             	add    $0x10,%esp
+  800edf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  800ee4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ee7:	89 1a                	mov    %ebx,(%edx)
+}
+  800ee9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800eec:	c9                   	leave
+  800eed:	c3                   	ret
+
+00800eee <fd_close>:
+{
+  800eee:	55                   	push   %ebp
+  800eef:	89 e5                	mov    %esp,%ebp
+  800ef1:	57                   	push   %edi
+  800ef2:	56                   	push   %esi
+  800ef3:	53                   	push   %ebx
+  800ef4:	83 ec 24             	sub    $0x24,%esp
+  800ef7:	8b 75 08             	mov    0x8(%ebp),%esi
+  800efa:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800efd:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800f00:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800f01:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800f07:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800f0a:	50                   	push   %eax
+  800f0b:	e8 3b ff ff ff       	call   800e4b <fd_lookup>
+  800f10:	89 c3                	mov    %eax,%ebx
+  800f12:	83 c4 10             	add    $0x10,%esp
+  800f15:	85 c0                	test   %eax,%eax
+  800f17:	78 05                	js     800f1e <fd_close+0x30>
+	    || fd != fd2)
+  800f19:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  800f1c:	74 16                	je     800f34 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  800f1e:	89 f8                	mov    %edi,%eax
+  800f20:	84 c0                	test   %al,%al
+  800f22:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f27:	0f 44 d8             	cmove  %eax,%ebx
+}
+  800f2a:	89 d8                	mov    %ebx,%eax
+  800f2c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f2f:	5b                   	pop    %ebx
+  800f30:	5e                   	pop    %esi
+  800f31:	5f                   	pop    %edi
+  800f32:	5d                   	pop    %ebp
+  800f33:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800f34:	83 ec 08             	sub    $0x8,%esp
+  800f37:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800f3a:	50                   	push   %eax
+  800f3b:	ff 36                	push   (%esi)
+  800f3d:	e8 59 ff ff ff       	call   800e9b <dev_lookup>
+  800f42:	89 c3                	mov    %eax,%ebx
+  800f44:	83 c4 10             	add    $0x10,%esp
+  800f47:	85 c0                	test   %eax,%eax
+  800f49:	78 1a                	js     800f65 <fd_close+0x77>
+		if (dev->dev_close)
+  800f4b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800f4e:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  800f51:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  800f56:	85 c0                	test   %eax,%eax
+  800f58:	74 0b                	je     800f65 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  800f5a:	83 ec 0c             	sub    $0xc,%esp
+  800f5d:	56                   	push   %esi
+  800f5e:	ff d0                	call   *%eax
+  800f60:	89 c3                	mov    %eax,%ebx
+  800f62:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  800f65:	83 ec 08             	sub    $0x8,%esp
+  800f68:	56                   	push   %esi
+  800f69:	6a 00                	push   $0x0
+  800f6b:	e8 10 fc ff ff       	call   800b80 <sys_page_unmap>
+	return r;
+  800f70:	83 c4 10             	add    $0x10,%esp
+  800f73:	eb b5                	jmp    800f2a <fd_close+0x3c>
+
+00800f75 <close>:
+
+int
+close(int fdnum)
+{
+  800f75:	55                   	push   %ebp
+  800f76:	89 e5                	mov    %esp,%ebp
+  800f78:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800f7b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800f7e:	50                   	push   %eax
+  800f7f:	ff 75 08             	push   0x8(%ebp)
+  800f82:	e8 c4 fe ff ff       	call   800e4b <fd_lookup>
+  800f87:	83 c4 10             	add    $0x10,%esp
+  800f8a:	85 c0                	test   %eax,%eax
+  800f8c:	79 02                	jns    800f90 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  800f8e:	c9                   	leave
+  800f8f:	c3                   	ret
+		return fd_close(fd, 1);
+  800f90:	83 ec 08             	sub    $0x8,%esp
+  800f93:	6a 01                	push   $0x1
+  800f95:	ff 75 f4             	push   -0xc(%ebp)
+  800f98:	e8 51 ff ff ff       	call   800eee <fd_close>
+  800f9d:	83 c4 10             	add    $0x10,%esp
+  800fa0:	eb ec                	jmp    800f8e <close+0x19>
+
+00800fa2 <close_all>:
+
+void
+close_all(void)
+{
+  800fa2:	55                   	push   %ebp
+  800fa3:	89 e5                	mov    %esp,%ebp
+  800fa5:	53                   	push   %ebx
+  800fa6:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  800fa9:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  800fae:	83 ec 0c             	sub    $0xc,%esp
+  800fb1:	53                   	push   %ebx
+  800fb2:	e8 be ff ff ff       	call   800f75 <close>
+	for (i = 0; i < MAXFD; i++)
+  800fb7:	83 c3 01             	add    $0x1,%ebx
+  800fba:	83 c4 10             	add    $0x10,%esp
+  800fbd:	83 fb 20             	cmp    $0x20,%ebx
+  800fc0:	75 ec                	jne    800fae <close_all+0xc>
+}
+  800fc2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800fc5:	c9                   	leave
+  800fc6:	c3                   	ret
+
+00800fc7 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  800fc7:	55                   	push   %ebp
+  800fc8:	89 e5                	mov    %esp,%ebp
+  800fca:	57                   	push   %edi
+  800fcb:	56                   	push   %esi
+  800fcc:	53                   	push   %ebx
+  800fcd:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800fd0:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800fd3:	50                   	push   %eax
+  800fd4:	ff 75 08             	push   0x8(%ebp)
+  800fd7:	e8 6f fe ff ff       	call   800e4b <fd_lookup>
+  800fdc:	89 c3                	mov    %eax,%ebx
+  800fde:	83 c4 10             	add    $0x10,%esp
+  800fe1:	85 c0                	test   %eax,%eax
+  800fe3:	78 7f                	js     801064 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  800fe5:	83 ec 0c             	sub    $0xc,%esp
+  800fe8:	ff 75 0c             	push   0xc(%ebp)
+  800feb:	e8 85 ff ff ff       	call   800f75 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  800ff0:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800ff3:	c1 e6 0c             	shl    $0xc,%esi
+  800ff6:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  800ffc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800fff:	89 3c 24             	mov    %edi,(%esp)
+  801002:	e8 d7 fd ff ff       	call   800dde <fd2data>
+  801007:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801009:	89 34 24             	mov    %esi,(%esp)
+  80100c:	e8 cd fd ff ff       	call   800dde <fd2data>
+  801011:	83 c4 10             	add    $0x10,%esp
+  801014:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801017:	89 d8                	mov    %ebx,%eax
+  801019:	c1 e8 16             	shr    $0x16,%eax
+  80101c:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801023:	a8 01                	test   $0x1,%al
+  801025:	74 11                	je     801038 <dup+0x71>
+  801027:	89 d8                	mov    %ebx,%eax
+  801029:	c1 e8 0c             	shr    $0xc,%eax
+  80102c:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801033:	f6 c2 01             	test   $0x1,%dl
+  801036:	75 36                	jne    80106e <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801038:	89 f8                	mov    %edi,%eax
+  80103a:	c1 e8 0c             	shr    $0xc,%eax
+  80103d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801044:	83 ec 0c             	sub    $0xc,%esp
+  801047:	25 07 0e 00 00       	and    $0xe07,%eax
+  80104c:	50                   	push   %eax
+  80104d:	56                   	push   %esi
+  80104e:	6a 00                	push   $0x0
+  801050:	57                   	push   %edi
+  801051:	6a 00                	push   $0x0
+  801053:	e8 e6 fa ff ff       	call   800b3e <sys_page_map>
+  801058:	89 c3                	mov    %eax,%ebx
+  80105a:	83 c4 20             	add    $0x20,%esp
+  80105d:	85 c0                	test   %eax,%eax
+  80105f:	78 33                	js     801094 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801061:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801064:	89 d8                	mov    %ebx,%eax
+  801066:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801069:	5b                   	pop    %ebx
+  80106a:	5e                   	pop    %esi
+  80106b:	5f                   	pop    %edi
+  80106c:	5d                   	pop    %ebp
+  80106d:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80106e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801075:	83 ec 0c             	sub    $0xc,%esp
+  801078:	25 07 0e 00 00       	and    $0xe07,%eax
+  80107d:	50                   	push   %eax
+  80107e:	ff 75 d4             	push   -0x2c(%ebp)
+  801081:	6a 00                	push   $0x0
+  801083:	53                   	push   %ebx
+  801084:	6a 00                	push   $0x0
+  801086:	e8 b3 fa ff ff       	call   800b3e <sys_page_map>
+  80108b:	89 c3                	mov    %eax,%ebx
+  80108d:	83 c4 20             	add    $0x20,%esp
+  801090:	85 c0                	test   %eax,%eax
+  801092:	79 a4                	jns    801038 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801094:	83 ec 08             	sub    $0x8,%esp
+  801097:	56                   	push   %esi
+  801098:	6a 00                	push   $0x0
+  80109a:	e8 e1 fa ff ff       	call   800b80 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  80109f:	83 c4 08             	add    $0x8,%esp
+  8010a2:	ff 75 d4             	push   -0x2c(%ebp)
+  8010a5:	6a 00                	push   $0x0
+  8010a7:	e8 d4 fa ff ff       	call   800b80 <sys_page_unmap>
+	return r;
+  8010ac:	83 c4 10             	add    $0x10,%esp
+  8010af:	eb b3                	jmp    801064 <dup+0x9d>
+
+008010b1 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8010b1:	55                   	push   %ebp
+  8010b2:	89 e5                	mov    %esp,%ebp
+  8010b4:	56                   	push   %esi
+  8010b5:	53                   	push   %ebx
+  8010b6:	83 ec 18             	sub    $0x18,%esp
+  8010b9:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8010bc:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8010bf:	50                   	push   %eax
+  8010c0:	56                   	push   %esi
+  8010c1:	e8 85 fd ff ff       	call   800e4b <fd_lookup>
+  8010c6:	83 c4 10             	add    $0x10,%esp
+  8010c9:	85 c0                	test   %eax,%eax
+  8010cb:	78 3c                	js     801109 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8010cd:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8010d0:	83 ec 08             	sub    $0x8,%esp
+  8010d3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8010d6:	50                   	push   %eax
+  8010d7:	ff 33                	push   (%ebx)
+  8010d9:	e8 bd fd ff ff       	call   800e9b <dev_lookup>
+  8010de:	83 c4 10             	add    $0x10,%esp
+  8010e1:	85 c0                	test   %eax,%eax
+  8010e3:	78 24                	js     801109 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8010e5:	8b 43 08             	mov    0x8(%ebx),%eax
+  8010e8:	83 e0 03             	and    $0x3,%eax
+  8010eb:	83 f8 01             	cmp    $0x1,%eax
+  8010ee:	74 20                	je     801110 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8010f0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8010f3:	8b 40 08             	mov    0x8(%eax),%eax
+  8010f6:	85 c0                	test   %eax,%eax
+  8010f8:	74 37                	je     801131 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8010fa:	83 ec 04             	sub    $0x4,%esp
+  8010fd:	ff 75 10             	push   0x10(%ebp)
+  801100:	ff 75 0c             	push   0xc(%ebp)
+  801103:	53                   	push   %ebx
+  801104:	ff d0                	call   *%eax
+  801106:	83 c4 10             	add    $0x10,%esp
+}
+  801109:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80110c:	5b                   	pop    %ebx
+  80110d:	5e                   	pop    %esi
+  80110e:	5d                   	pop    %ebp
+  80110f:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801110:	a1 08 40 80 00       	mov    0x804008,%eax
+  801115:	8b 40 48             	mov    0x48(%eax),%eax
+  801118:	83 ec 04             	sub    $0x4,%esp
+  80111b:	56                   	push   %esi
+  80111c:	50                   	push   %eax
+  80111d:	68 d1 28 80 00       	push   $0x8028d1
+  801122:	e8 2f f0 ff ff       	call   800156 <cprintf>
+		return -E_INVAL;
+  801127:	83 c4 10             	add    $0x10,%esp
+  80112a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80112f:	eb d8                	jmp    801109 <read+0x58>
+		return -E_NOT_SUPP;
+  801131:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801136:	eb d1                	jmp    801109 <read+0x58>
+
+00801138 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801138:	55                   	push   %ebp
+  801139:	89 e5                	mov    %esp,%ebp
+  80113b:	57                   	push   %edi
+  80113c:	56                   	push   %esi
+  80113d:	53                   	push   %ebx
+  80113e:	83 ec 0c             	sub    $0xc,%esp
+  801141:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801144:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801147:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80114c:	eb 02                	jmp    801150 <readn+0x18>
+  80114e:	01 c3                	add    %eax,%ebx
+  801150:	39 f3                	cmp    %esi,%ebx
+  801152:	73 21                	jae    801175 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801154:	83 ec 04             	sub    $0x4,%esp
+  801157:	89 f0                	mov    %esi,%eax
+  801159:	29 d8                	sub    %ebx,%eax
+  80115b:	50                   	push   %eax
+  80115c:	89 d8                	mov    %ebx,%eax
+  80115e:	03 45 0c             	add    0xc(%ebp),%eax
+  801161:	50                   	push   %eax
+  801162:	57                   	push   %edi
+  801163:	e8 49 ff ff ff       	call   8010b1 <read>
+		if (m < 0)
+  801168:	83 c4 10             	add    $0x10,%esp
+  80116b:	85 c0                	test   %eax,%eax
+  80116d:	78 04                	js     801173 <readn+0x3b>
+			return m;
+		if (m == 0)
+  80116f:	75 dd                	jne    80114e <readn+0x16>
+  801171:	eb 02                	jmp    801175 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801173:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801175:	89 d8                	mov    %ebx,%eax
+  801177:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80117a:	5b                   	pop    %ebx
+  80117b:	5e                   	pop    %esi
+  80117c:	5f                   	pop    %edi
+  80117d:	5d                   	pop    %ebp
+  80117e:	c3                   	ret
+
+0080117f <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80117f:	55                   	push   %ebp
+  801180:	89 e5                	mov    %esp,%ebp
+  801182:	56                   	push   %esi
+  801183:	53                   	push   %ebx
+  801184:	83 ec 18             	sub    $0x18,%esp
+  801187:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80118a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80118d:	50                   	push   %eax
+  80118e:	53                   	push   %ebx
+  80118f:	e8 b7 fc ff ff       	call   800e4b <fd_lookup>
+  801194:	83 c4 10             	add    $0x10,%esp
+  801197:	85 c0                	test   %eax,%eax
+  801199:	78 37                	js     8011d2 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80119b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80119e:	83 ec 08             	sub    $0x8,%esp
+  8011a1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8011a4:	50                   	push   %eax
+  8011a5:	ff 36                	push   (%esi)
+  8011a7:	e8 ef fc ff ff       	call   800e9b <dev_lookup>
+  8011ac:	83 c4 10             	add    $0x10,%esp
+  8011af:	85 c0                	test   %eax,%eax
+  8011b1:	78 1f                	js     8011d2 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8011b3:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8011b7:	74 20                	je     8011d9 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8011b9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8011bc:	8b 40 0c             	mov    0xc(%eax),%eax
+  8011bf:	85 c0                	test   %eax,%eax
+  8011c1:	74 37                	je     8011fa <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8011c3:	83 ec 04             	sub    $0x4,%esp
+  8011c6:	ff 75 10             	push   0x10(%ebp)
+  8011c9:	ff 75 0c             	push   0xc(%ebp)
+  8011cc:	56                   	push   %esi
+  8011cd:	ff d0                	call   *%eax
+  8011cf:	83 c4 10             	add    $0x10,%esp
+}
+  8011d2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8011d5:	5b                   	pop    %ebx
+  8011d6:	5e                   	pop    %esi
+  8011d7:	5d                   	pop    %ebp
+  8011d8:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8011d9:	a1 08 40 80 00       	mov    0x804008,%eax
+  8011de:	8b 40 48             	mov    0x48(%eax),%eax
+  8011e1:	83 ec 04             	sub    $0x4,%esp
+  8011e4:	53                   	push   %ebx
+  8011e5:	50                   	push   %eax
+  8011e6:	68 ed 28 80 00       	push   $0x8028ed
+  8011eb:	e8 66 ef ff ff       	call   800156 <cprintf>
+		return -E_INVAL;
+  8011f0:	83 c4 10             	add    $0x10,%esp
+  8011f3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011f8:	eb d8                	jmp    8011d2 <write+0x53>
+		return -E_NOT_SUPP;
+  8011fa:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8011ff:	eb d1                	jmp    8011d2 <write+0x53>
+
+00801201 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801201:	55                   	push   %ebp
+  801202:	89 e5                	mov    %esp,%ebp
+  801204:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801207:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80120a:	50                   	push   %eax
+  80120b:	ff 75 08             	push   0x8(%ebp)
+  80120e:	e8 38 fc ff ff       	call   800e4b <fd_lookup>
+  801213:	83 c4 10             	add    $0x10,%esp
+  801216:	85 c0                	test   %eax,%eax
+  801218:	78 0e                	js     801228 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80121a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80121d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801220:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801223:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801228:	c9                   	leave
+  801229:	c3                   	ret
+
+0080122a <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80122a:	55                   	push   %ebp
+  80122b:	89 e5                	mov    %esp,%ebp
+  80122d:	56                   	push   %esi
+  80122e:	53                   	push   %ebx
+  80122f:	83 ec 18             	sub    $0x18,%esp
+  801232:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801235:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801238:	50                   	push   %eax
+  801239:	53                   	push   %ebx
+  80123a:	e8 0c fc ff ff       	call   800e4b <fd_lookup>
+  80123f:	83 c4 10             	add    $0x10,%esp
+  801242:	85 c0                	test   %eax,%eax
+  801244:	78 34                	js     80127a <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801246:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801249:	83 ec 08             	sub    $0x8,%esp
+  80124c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80124f:	50                   	push   %eax
+  801250:	ff 36                	push   (%esi)
+  801252:	e8 44 fc ff ff       	call   800e9b <dev_lookup>
+  801257:	83 c4 10             	add    $0x10,%esp
+  80125a:	85 c0                	test   %eax,%eax
+  80125c:	78 1c                	js     80127a <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80125e:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801262:	74 1d                	je     801281 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801264:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801267:	8b 40 18             	mov    0x18(%eax),%eax
+  80126a:	85 c0                	test   %eax,%eax
+  80126c:	74 34                	je     8012a2 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80126e:	83 ec 08             	sub    $0x8,%esp
+  801271:	ff 75 0c             	push   0xc(%ebp)
+  801274:	56                   	push   %esi
+  801275:	ff d0                	call   *%eax
+  801277:	83 c4 10             	add    $0x10,%esp
+}
+  80127a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80127d:	5b                   	pop    %ebx
+  80127e:	5e                   	pop    %esi
+  80127f:	5d                   	pop    %ebp
+  801280:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801281:	a1 08 40 80 00       	mov    0x804008,%eax
+  801286:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801289:	83 ec 04             	sub    $0x4,%esp
+  80128c:	53                   	push   %ebx
+  80128d:	50                   	push   %eax
+  80128e:	68 b0 28 80 00       	push   $0x8028b0
+  801293:	e8 be ee ff ff       	call   800156 <cprintf>
+		return -E_INVAL;
+  801298:	83 c4 10             	add    $0x10,%esp
+  80129b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012a0:	eb d8                	jmp    80127a <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8012a2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8012a7:	eb d1                	jmp    80127a <ftruncate+0x50>
+
+008012a9 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8012a9:	55                   	push   %ebp
+  8012aa:	89 e5                	mov    %esp,%ebp
+  8012ac:	56                   	push   %esi
+  8012ad:	53                   	push   %ebx
+  8012ae:	83 ec 18             	sub    $0x18,%esp
+  8012b1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8012b4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8012b7:	50                   	push   %eax
+  8012b8:	ff 75 08             	push   0x8(%ebp)
+  8012bb:	e8 8b fb ff ff       	call   800e4b <fd_lookup>
+  8012c0:	83 c4 10             	add    $0x10,%esp
+  8012c3:	85 c0                	test   %eax,%eax
+  8012c5:	78 49                	js     801310 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8012c7:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8012ca:	83 ec 08             	sub    $0x8,%esp
+  8012cd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8012d0:	50                   	push   %eax
+  8012d1:	ff 36                	push   (%esi)
+  8012d3:	e8 c3 fb ff ff       	call   800e9b <dev_lookup>
+  8012d8:	83 c4 10             	add    $0x10,%esp
+  8012db:	85 c0                	test   %eax,%eax
+  8012dd:	78 31                	js     801310 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8012df:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8012e2:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8012e6:	74 2f                	je     801317 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8012e8:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8012eb:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8012f2:	00 00 00 
+	stat->st_isdir = 0;
+  8012f5:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8012fc:	00 00 00 
+	stat->st_dev = dev;
+  8012ff:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801305:	83 ec 08             	sub    $0x8,%esp
+  801308:	53                   	push   %ebx
+  801309:	56                   	push   %esi
+  80130a:	ff 50 14             	call   *0x14(%eax)
+  80130d:	83 c4 10             	add    $0x10,%esp
+}
+  801310:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801313:	5b                   	pop    %ebx
+  801314:	5e                   	pop    %esi
+  801315:	5d                   	pop    %ebp
+  801316:	c3                   	ret
+		return -E_NOT_SUPP;
+  801317:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80131c:	eb f2                	jmp    801310 <fstat+0x67>
+
+0080131e <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80131e:	55                   	push   %ebp
+  80131f:	89 e5                	mov    %esp,%ebp
+  801321:	56                   	push   %esi
+  801322:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801323:	83 ec 08             	sub    $0x8,%esp
+  801326:	6a 00                	push   $0x0
+  801328:	ff 75 08             	push   0x8(%ebp)
+  80132b:	e8 e4 01 00 00       	call   801514 <open>
+  801330:	89 c3                	mov    %eax,%ebx
+  801332:	83 c4 10             	add    $0x10,%esp
+  801335:	85 c0                	test   %eax,%eax
+  801337:	78 1b                	js     801354 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801339:	83 ec 08             	sub    $0x8,%esp
+  80133c:	ff 75 0c             	push   0xc(%ebp)
+  80133f:	50                   	push   %eax
+  801340:	e8 64 ff ff ff       	call   8012a9 <fstat>
+  801345:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801347:	89 1c 24             	mov    %ebx,(%esp)
+  80134a:	e8 26 fc ff ff       	call   800f75 <close>
+	return r;
+  80134f:	83 c4 10             	add    $0x10,%esp
+  801352:	89 f3                	mov    %esi,%ebx
+}
+  801354:	89 d8                	mov    %ebx,%eax
+  801356:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801359:	5b                   	pop    %ebx
+  80135a:	5e                   	pop    %esi
+  80135b:	5d                   	pop    %ebp
+  80135c:	c3                   	ret
+
+0080135d <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  80135d:	55                   	push   %ebp
+  80135e:	89 e5                	mov    %esp,%ebp
+  801360:	56                   	push   %esi
+  801361:	53                   	push   %ebx
+  801362:	89 c6                	mov    %eax,%esi
+  801364:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  801366:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  80136d:	74 27                	je     801396 <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80136f:	6a 07                	push   $0x7
+  801371:	68 00 50 80 00       	push   $0x805000
+  801376:	56                   	push   %esi
+  801377:	ff 35 00 40 80 00    	push   0x804000
+  80137d:	e8 17 0c 00 00       	call   801f99 <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  801382:	83 c4 0c             	add    $0xc,%esp
+  801385:	6a 00                	push   $0x0
+  801387:	53                   	push   %ebx
+  801388:	6a 00                	push   $0x0
+  80138a:	e8 96 0b 00 00       	call   801f25 <ipc_recv>
+}
+  80138f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801392:	5b                   	pop    %ebx
+  801393:	5e                   	pop    %esi
+  801394:	5d                   	pop    %ebp
+  801395:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  801396:	83 ec 0c             	sub    $0xc,%esp
+  801399:	6a 01                	push   $0x1
+  80139b:	e8 4d 0c 00 00       	call   801fed <ipc_find_env>
+  8013a0:	a3 00 40 80 00       	mov    %eax,0x804000
+  8013a5:	83 c4 10             	add    $0x10,%esp
+  8013a8:	eb c5                	jmp    80136f <fsipc+0x12>
+
+008013aa <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8013aa:	55                   	push   %ebp
+  8013ab:	89 e5                	mov    %esp,%ebp
+  8013ad:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8013b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013b3:	8b 40 0c             	mov    0xc(%eax),%eax
+  8013b6:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.set_size.req_size = newsize;
+  8013bb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8013be:	a3 04 50 80 00       	mov    %eax,0x805004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  8013c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013c8:	b8 02 00 00 00       	mov    $0x2,%eax
+  8013cd:	e8 8b ff ff ff       	call   80135d <fsipc>
+}
+  8013d2:	c9                   	leave
+  8013d3:	c3                   	ret
+
+008013d4 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8013d4:	55                   	push   %ebp
+  8013d5:	89 e5                	mov    %esp,%ebp
+  8013d7:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8013da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013dd:	8b 40 0c             	mov    0xc(%eax),%eax
+  8013e0:	a3 00 50 80 00       	mov    %eax,0x805000
+  return fsipc(FSREQ_FLUSH, NULL);
+  8013e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013ea:	b8 06 00 00 00       	mov    $0x6,%eax
+  8013ef:	e8 69 ff ff ff       	call   80135d <fsipc>
+}
+  8013f4:	c9                   	leave
+  8013f5:	c3                   	ret
+
+008013f6 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8013f6:	55                   	push   %ebp
+  8013f7:	89 e5                	mov    %esp,%ebp
+  8013f9:	53                   	push   %ebx
+  8013fa:	83 ec 04             	sub    $0x4,%esp
+  8013fd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801400:	8b 45 08             	mov    0x8(%ebp),%eax
+  801403:	8b 40 0c             	mov    0xc(%eax),%eax
+  801406:	a3 00 50 80 00       	mov    %eax,0x805000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80140b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801410:	b8 05 00 00 00       	mov    $0x5,%eax
+  801415:	e8 43 ff ff ff       	call   80135d <fsipc>
+  80141a:	85 c0                	test   %eax,%eax
+  80141c:	78 2c                	js     80144a <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80141e:	83 ec 08             	sub    $0x8,%esp
+  801421:	68 00 50 80 00       	push   $0x805000
+  801426:	53                   	push   %ebx
+  801427:	e8 e3 f2 ff ff       	call   80070f <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  80142c:	a1 80 50 80 00       	mov    0x805080,%eax
+  801431:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801437:	a1 84 50 80 00       	mov    0x805084,%eax
+  80143c:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801442:	83 c4 10             	add    $0x10,%esp
+  801445:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80144a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80144d:	c9                   	leave
+  80144e:	c3                   	ret
+
+0080144f <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80144f:	55                   	push   %ebp
+  801450:	89 e5                	mov    %esp,%ebp
+  801452:	83 ec 0c             	sub    $0xc,%esp
+  801455:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801458:	8b 55 08             	mov    0x8(%ebp),%edx
+  80145b:	8b 52 0c             	mov    0xc(%edx),%edx
+  80145e:	89 15 00 50 80 00    	mov    %edx,0x805000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801464:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801469:	39 d0                	cmp    %edx,%eax
+  80146b:	0f 47 c2             	cmova  %edx,%eax
+  80146e:	a3 04 50 80 00       	mov    %eax,0x805004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  801473:	50                   	push   %eax
+  801474:	ff 75 0c             	push   0xc(%ebp)
+  801477:	68 08 50 80 00       	push   $0x805008
+  80147c:	e8 14 f4 ff ff       	call   800895 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801481:	ba 00 00 00 00       	mov    $0x0,%edx
+  801486:	b8 04 00 00 00       	mov    $0x4,%eax
+  80148b:	e8 cd fe ff ff       	call   80135d <fsipc>
+}
+  801490:	c9                   	leave
+  801491:	c3                   	ret
+
+00801492 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801492:	55                   	push   %ebp
+  801493:	89 e5                	mov    %esp,%ebp
+  801495:	56                   	push   %esi
+  801496:	53                   	push   %ebx
+  801497:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80149a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80149d:	8b 40 0c             	mov    0xc(%eax),%eax
+  8014a0:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.read.req_n = n;
+  8014a5:	89 35 04 50 80 00    	mov    %esi,0x805004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8014ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014b0:	b8 03 00 00 00       	mov    $0x3,%eax
+  8014b5:	e8 a3 fe ff ff       	call   80135d <fsipc>
+  8014ba:	89 c3                	mov    %eax,%ebx
+  8014bc:	85 c0                	test   %eax,%eax
+  8014be:	78 1f                	js     8014df <devfile_read+0x4d>
+  assert(r <= n);
+  8014c0:	39 c6                	cmp    %eax,%esi
+  8014c2:	72 24                	jb     8014e8 <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  8014c4:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8014c9:	7f 33                	jg     8014fe <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8014cb:	83 ec 04             	sub    $0x4,%esp
+  8014ce:	50                   	push   %eax
+  8014cf:	68 00 50 80 00       	push   $0x805000
+  8014d4:	ff 75 0c             	push   0xc(%ebp)
+  8014d7:	e8 b9 f3 ff ff       	call   800895 <memmove>
+  return r;
+  8014dc:	83 c4 10             	add    $0x10,%esp
+}
+  8014df:	89 d8                	mov    %ebx,%eax
+  8014e1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014e4:	5b                   	pop    %ebx
+  8014e5:	5e                   	pop    %esi
+  8014e6:	5d                   	pop    %ebp
+  8014e7:	c3                   	ret
+  assert(r <= n);
+  8014e8:	68 20 29 80 00       	push   $0x802920
+  8014ed:	68 27 29 80 00       	push   $0x802927
+  8014f2:	6a 78                	push   $0x78
+  8014f4:	68 3c 29 80 00       	push   $0x80293c
+  8014f9:	e8 e1 09 00 00       	call   801edf <_panic>
+  assert(r <= PGSIZE);
+  8014fe:	68 47 29 80 00       	push   $0x802947
+  801503:	68 27 29 80 00       	push   $0x802927
+  801508:	6a 79                	push   $0x79
+  80150a:	68 3c 29 80 00       	push   $0x80293c
+  80150f:	e8 cb 09 00 00       	call   801edf <_panic>
+
+00801514 <open>:
+open(const char *path, int mode) {
+  801514:	55                   	push   %ebp
+  801515:	89 e5                	mov    %esp,%ebp
+  801517:	56                   	push   %esi
+  801518:	53                   	push   %ebx
+  801519:	83 ec 1c             	sub    $0x1c,%esp
+  80151c:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  80151f:	56                   	push   %esi
+  801520:	e8 af f1 ff ff       	call   8006d4 <strlen>
+  801525:	83 c4 10             	add    $0x10,%esp
+  801528:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80152d:	7f 6c                	jg     80159b <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  80152f:	83 ec 0c             	sub    $0xc,%esp
+  801532:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801535:	50                   	push   %eax
+  801536:	e8 ba f8 ff ff       	call   800df5 <fd_alloc>
+  80153b:	89 c3                	mov    %eax,%ebx
+  80153d:	83 c4 10             	add    $0x10,%esp
+  801540:	85 c0                	test   %eax,%eax
+  801542:	78 3c                	js     801580 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801544:	83 ec 08             	sub    $0x8,%esp
+  801547:	56                   	push   %esi
+  801548:	68 00 50 80 00       	push   $0x805000
+  80154d:	e8 bd f1 ff ff       	call   80070f <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801552:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801555:	a3 00 54 80 00       	mov    %eax,0x805400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80155a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80155d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801562:	e8 f6 fd ff ff       	call   80135d <fsipc>
+  801567:	89 c3                	mov    %eax,%ebx
+  801569:	83 c4 10             	add    $0x10,%esp
+  80156c:	85 c0                	test   %eax,%eax
+  80156e:	78 19                	js     801589 <open+0x75>
+  return fd2num(fd);
+  801570:	83 ec 0c             	sub    $0xc,%esp
+  801573:	ff 75 f4             	push   -0xc(%ebp)
+  801576:	e8 53 f8 ff ff       	call   800dce <fd2num>
+  80157b:	89 c3                	mov    %eax,%ebx
+  80157d:	83 c4 10             	add    $0x10,%esp
+}
+  801580:	89 d8                	mov    %ebx,%eax
+  801582:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801585:	5b                   	pop    %ebx
+  801586:	5e                   	pop    %esi
+  801587:	5d                   	pop    %ebp
+  801588:	c3                   	ret
+    fd_close(fd, 0);
+  801589:	83 ec 08             	sub    $0x8,%esp
+  80158c:	6a 00                	push   $0x0
+  80158e:	ff 75 f4             	push   -0xc(%ebp)
+  801591:	e8 58 f9 ff ff       	call   800eee <fd_close>
+    return r;
+  801596:	83 c4 10             	add    $0x10,%esp
+  801599:	eb e5                	jmp    801580 <open+0x6c>
+    return -E_BAD_PATH;
+  80159b:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8015a0:	eb de                	jmp    801580 <open+0x6c>
+
+008015a2 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  8015a2:	55                   	push   %ebp
+  8015a3:	89 e5                	mov    %esp,%ebp
+  8015a5:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  8015a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015ad:	b8 08 00 00 00       	mov    $0x8,%eax
+  8015b2:	e8 a6 fd ff ff       	call   80135d <fsipc>
+}
+  8015b7:	c9                   	leave
+  8015b8:	c3                   	ret
+
+008015b9 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8015b9:	55                   	push   %ebp
+  8015ba:	89 e5                	mov    %esp,%ebp
+  8015bc:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8015bf:	68 53 29 80 00       	push   $0x802953
+  8015c4:	ff 75 0c             	push   0xc(%ebp)
+  8015c7:	e8 43 f1 ff ff       	call   80070f <strcpy>
+	return 0;
+}
+  8015cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015d1:	c9                   	leave
+  8015d2:	c3                   	ret
+
+008015d3 <devsock_close>:
+{
+  8015d3:	55                   	push   %ebp
+  8015d4:	89 e5                	mov    %esp,%ebp
+  8015d6:	53                   	push   %ebx
+  8015d7:	83 ec 10             	sub    $0x10,%esp
+  8015da:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8015dd:	53                   	push   %ebx
+  8015de:	e8 49 0a 00 00       	call   80202c <pageref>
+  8015e3:	89 c2                	mov    %eax,%edx
+  8015e5:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8015e8:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8015ed:	83 fa 01             	cmp    $0x1,%edx
+  8015f0:	74 05                	je     8015f7 <devsock_close+0x24>
+}
+  8015f2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015f5:	c9                   	leave
+  8015f6:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8015f7:	83 ec 0c             	sub    $0xc,%esp
+  8015fa:	ff 73 0c             	push   0xc(%ebx)
+  8015fd:	e8 b7 02 00 00       	call   8018b9 <nsipc_close>
+  801602:	83 c4 10             	add    $0x10,%esp
+  801605:	eb eb                	jmp    8015f2 <devsock_close+0x1f>
+
+00801607 <devsock_write>:
+{
+  801607:	55                   	push   %ebp
+  801608:	89 e5                	mov    %esp,%ebp
+  80160a:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  80160d:	6a 00                	push   $0x0
+  80160f:	ff 75 10             	push   0x10(%ebp)
+  801612:	ff 75 0c             	push   0xc(%ebp)
+  801615:	8b 45 08             	mov    0x8(%ebp),%eax
+  801618:	ff 70 0c             	push   0xc(%eax)
+  80161b:	e8 79 03 00 00       	call   801999 <nsipc_send>
+}
+  801620:	c9                   	leave
+  801621:	c3                   	ret
+
+00801622 <devsock_read>:
+{
+  801622:	55                   	push   %ebp
+  801623:	89 e5                	mov    %esp,%ebp
+  801625:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801628:	6a 00                	push   $0x0
+  80162a:	ff 75 10             	push   0x10(%ebp)
+  80162d:	ff 75 0c             	push   0xc(%ebp)
+  801630:	8b 45 08             	mov    0x8(%ebp),%eax
+  801633:	ff 70 0c             	push   0xc(%eax)
+  801636:	e8 ef 02 00 00       	call   80192a <nsipc_recv>
+}
+  80163b:	c9                   	leave
+  80163c:	c3                   	ret
+
+0080163d <fd2sockid>:
+{
+  80163d:	55                   	push   %ebp
+  80163e:	89 e5                	mov    %esp,%ebp
+  801640:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801643:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801646:	52                   	push   %edx
+  801647:	50                   	push   %eax
+  801648:	e8 fe f7 ff ff       	call   800e4b <fd_lookup>
+  80164d:	83 c4 10             	add    $0x10,%esp
+  801650:	85 c0                	test   %eax,%eax
+  801652:	78 10                	js     801664 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801654:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801657:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  80165d:	39 08                	cmp    %ecx,(%eax)
+  80165f:	75 05                	jne    801666 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801661:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801664:	c9                   	leave
+  801665:	c3                   	ret
+		return -E_NOT_SUPP;
+  801666:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80166b:	eb f7                	jmp    801664 <fd2sockid+0x27>
+
+0080166d <alloc_sockfd>:
+{
+  80166d:	55                   	push   %ebp
+  80166e:	89 e5                	mov    %esp,%ebp
+  801670:	56                   	push   %esi
+  801671:	53                   	push   %ebx
+  801672:	83 ec 1c             	sub    $0x1c,%esp
+  801675:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801677:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80167a:	50                   	push   %eax
+  80167b:	e8 75 f7 ff ff       	call   800df5 <fd_alloc>
+  801680:	89 c3                	mov    %eax,%ebx
+  801682:	83 c4 10             	add    $0x10,%esp
+  801685:	85 c0                	test   %eax,%eax
+  801687:	78 43                	js     8016cc <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801689:	83 ec 04             	sub    $0x4,%esp
+  80168c:	68 07 04 00 00       	push   $0x407
+  801691:	ff 75 f4             	push   -0xc(%ebp)
+  801694:	6a 00                	push   $0x0
+  801696:	e8 60 f4 ff ff       	call   800afb <sys_page_alloc>
+  80169b:	89 c3                	mov    %eax,%ebx
+  80169d:	83 c4 10             	add    $0x10,%esp
+  8016a0:	85 c0                	test   %eax,%eax
+  8016a2:	78 28                	js     8016cc <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8016a4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016a7:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  8016ad:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8016af:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016b2:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8016b9:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8016bc:	83 ec 0c             	sub    $0xc,%esp
+  8016bf:	50                   	push   %eax
+  8016c0:	e8 09 f7 ff ff       	call   800dce <fd2num>
+  8016c5:	89 c3                	mov    %eax,%ebx
+  8016c7:	83 c4 10             	add    $0x10,%esp
+  8016ca:	eb 0c                	jmp    8016d8 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8016cc:	83 ec 0c             	sub    $0xc,%esp
+  8016cf:	56                   	push   %esi
+  8016d0:	e8 e4 01 00 00       	call   8018b9 <nsipc_close>
+		return r;
+  8016d5:	83 c4 10             	add    $0x10,%esp
+}
+  8016d8:	89 d8                	mov    %ebx,%eax
+  8016da:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016dd:	5b                   	pop    %ebx
+  8016de:	5e                   	pop    %esi
+  8016df:	5d                   	pop    %ebp
+  8016e0:	c3                   	ret
+
+008016e1 <accept>:
+{
+  8016e1:	55                   	push   %ebp
+  8016e2:	89 e5                	mov    %esp,%ebp
+  8016e4:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8016e7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016ea:	e8 4e ff ff ff       	call   80163d <fd2sockid>
+  8016ef:	85 c0                	test   %eax,%eax
+  8016f1:	78 1b                	js     80170e <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8016f3:	83 ec 04             	sub    $0x4,%esp
+  8016f6:	ff 75 10             	push   0x10(%ebp)
+  8016f9:	ff 75 0c             	push   0xc(%ebp)
+  8016fc:	50                   	push   %eax
+  8016fd:	e8 0e 01 00 00       	call   801810 <nsipc_accept>
+  801702:	83 c4 10             	add    $0x10,%esp
+  801705:	85 c0                	test   %eax,%eax
+  801707:	78 05                	js     80170e <accept+0x2d>
+	return alloc_sockfd(r);
+  801709:	e8 5f ff ff ff       	call   80166d <alloc_sockfd>
+}
+  80170e:	c9                   	leave
+  80170f:	c3                   	ret
+
+00801710 <bind>:
+{
+  801710:	55                   	push   %ebp
+  801711:	89 e5                	mov    %esp,%ebp
+  801713:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801716:	8b 45 08             	mov    0x8(%ebp),%eax
+  801719:	e8 1f ff ff ff       	call   80163d <fd2sockid>
+  80171e:	85 c0                	test   %eax,%eax
+  801720:	78 12                	js     801734 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801722:	83 ec 04             	sub    $0x4,%esp
+  801725:	ff 75 10             	push   0x10(%ebp)
+  801728:	ff 75 0c             	push   0xc(%ebp)
+  80172b:	50                   	push   %eax
+  80172c:	e8 31 01 00 00       	call   801862 <nsipc_bind>
+  801731:	83 c4 10             	add    $0x10,%esp
+}
+  801734:	c9                   	leave
+  801735:	c3                   	ret
+
+00801736 <shutdown>:
+{
+  801736:	55                   	push   %ebp
+  801737:	89 e5                	mov    %esp,%ebp
+  801739:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80173c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80173f:	e8 f9 fe ff ff       	call   80163d <fd2sockid>
+  801744:	85 c0                	test   %eax,%eax
+  801746:	78 0f                	js     801757 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801748:	83 ec 08             	sub    $0x8,%esp
+  80174b:	ff 75 0c             	push   0xc(%ebp)
+  80174e:	50                   	push   %eax
+  80174f:	e8 43 01 00 00       	call   801897 <nsipc_shutdown>
+  801754:	83 c4 10             	add    $0x10,%esp
+}
+  801757:	c9                   	leave
+  801758:	c3                   	ret
+
+00801759 <connect>:
+{
+  801759:	55                   	push   %ebp
+  80175a:	89 e5                	mov    %esp,%ebp
+  80175c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80175f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801762:	e8 d6 fe ff ff       	call   80163d <fd2sockid>
+  801767:	85 c0                	test   %eax,%eax
+  801769:	78 12                	js     80177d <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  80176b:	83 ec 04             	sub    $0x4,%esp
+  80176e:	ff 75 10             	push   0x10(%ebp)
+  801771:	ff 75 0c             	push   0xc(%ebp)
+  801774:	50                   	push   %eax
+  801775:	e8 59 01 00 00       	call   8018d3 <nsipc_connect>
+  80177a:	83 c4 10             	add    $0x10,%esp
+}
+  80177d:	c9                   	leave
+  80177e:	c3                   	ret
+
+0080177f <listen>:
+{
+  80177f:	55                   	push   %ebp
+  801780:	89 e5                	mov    %esp,%ebp
+  801782:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801785:	8b 45 08             	mov    0x8(%ebp),%eax
+  801788:	e8 b0 fe ff ff       	call   80163d <fd2sockid>
+  80178d:	85 c0                	test   %eax,%eax
+  80178f:	78 0f                	js     8017a0 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801791:	83 ec 08             	sub    $0x8,%esp
+  801794:	ff 75 0c             	push   0xc(%ebp)
+  801797:	50                   	push   %eax
+  801798:	e8 6b 01 00 00       	call   801908 <nsipc_listen>
+  80179d:	83 c4 10             	add    $0x10,%esp
+}
+  8017a0:	c9                   	leave
+  8017a1:	c3                   	ret
+
+008017a2 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8017a2:	55                   	push   %ebp
+  8017a3:	89 e5                	mov    %esp,%ebp
+  8017a5:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8017a8:	ff 75 10             	push   0x10(%ebp)
+  8017ab:	ff 75 0c             	push   0xc(%ebp)
+  8017ae:	ff 75 08             	push   0x8(%ebp)
+  8017b1:	e8 41 02 00 00       	call   8019f7 <nsipc_socket>
+  8017b6:	83 c4 10             	add    $0x10,%esp
+  8017b9:	85 c0                	test   %eax,%eax
+  8017bb:	78 05                	js     8017c2 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8017bd:	e8 ab fe ff ff       	call   80166d <alloc_sockfd>
+}
+  8017c2:	c9                   	leave
+  8017c3:	c3                   	ret
+
+008017c4 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8017c4:	55                   	push   %ebp
+  8017c5:	89 e5                	mov    %esp,%ebp
+  8017c7:	53                   	push   %ebx
+  8017c8:	83 ec 04             	sub    $0x4,%esp
+  8017cb:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  8017cd:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8017d4:	74 26                	je     8017fc <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8017d6:	6a 07                	push   $0x7
+  8017d8:	68 00 60 80 00       	push   $0x806000
+  8017dd:	53                   	push   %ebx
+  8017de:	ff 35 04 40 80 00    	push   0x804004
+  8017e4:	e8 b0 07 00 00       	call   801f99 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8017e9:	83 c4 0c             	add    $0xc,%esp
+  8017ec:	6a 00                	push   $0x0
+  8017ee:	6a 00                	push   $0x0
+  8017f0:	6a 00                	push   $0x0
+  8017f2:	e8 2e 07 00 00       	call   801f25 <ipc_recv>
+}
+  8017f7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017fa:	c9                   	leave
+  8017fb:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8017fc:	83 ec 0c             	sub    $0xc,%esp
+  8017ff:	6a 02                	push   $0x2
+  801801:	e8 e7 07 00 00       	call   801fed <ipc_find_env>
+  801806:	a3 04 40 80 00       	mov    %eax,0x804004
+  80180b:	83 c4 10             	add    $0x10,%esp
+  80180e:	eb c6                	jmp    8017d6 <nsipc+0x12>
+
+00801810 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801810:	55                   	push   %ebp
+  801811:	89 e5                	mov    %esp,%ebp
+  801813:	56                   	push   %esi
+  801814:	53                   	push   %ebx
+  801815:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801818:	8b 45 08             	mov    0x8(%ebp),%eax
+  80181b:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801820:	8b 06                	mov    (%esi),%eax
+  801822:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801827:	b8 01 00 00 00       	mov    $0x1,%eax
+  80182c:	e8 93 ff ff ff       	call   8017c4 <nsipc>
+  801831:	89 c3                	mov    %eax,%ebx
+  801833:	85 c0                	test   %eax,%eax
+  801835:	79 09                	jns    801840 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801837:	89 d8                	mov    %ebx,%eax
+  801839:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80183c:	5b                   	pop    %ebx
+  80183d:	5e                   	pop    %esi
+  80183e:	5d                   	pop    %ebp
+  80183f:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801840:	83 ec 04             	sub    $0x4,%esp
+  801843:	ff 35 10 60 80 00    	push   0x806010
+  801849:	68 00 60 80 00       	push   $0x806000
+  80184e:	ff 75 0c             	push   0xc(%ebp)
+  801851:	e8 3f f0 ff ff       	call   800895 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801856:	a1 10 60 80 00       	mov    0x806010,%eax
+  80185b:	89 06                	mov    %eax,(%esi)
+  80185d:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801860:	eb d5                	jmp    801837 <nsipc_accept+0x27>
+
+00801862 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801862:	55                   	push   %ebp
+  801863:	89 e5                	mov    %esp,%ebp
+  801865:	53                   	push   %ebx
+  801866:	83 ec 08             	sub    $0x8,%esp
+  801869:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  80186c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80186f:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801874:	53                   	push   %ebx
+  801875:	ff 75 0c             	push   0xc(%ebp)
+  801878:	68 04 60 80 00       	push   $0x806004
+  80187d:	e8 13 f0 ff ff       	call   800895 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801882:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  801888:	b8 02 00 00 00       	mov    $0x2,%eax
+  80188d:	e8 32 ff ff ff       	call   8017c4 <nsipc>
+}
+  801892:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801895:	c9                   	leave
+  801896:	c3                   	ret
+
+00801897 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801897:	55                   	push   %ebp
+  801898:	89 e5                	mov    %esp,%ebp
+  80189a:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  80189d:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018a0:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  8018a5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8018a8:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  8018ad:	b8 03 00 00 00       	mov    $0x3,%eax
+  8018b2:	e8 0d ff ff ff       	call   8017c4 <nsipc>
+}
+  8018b7:	c9                   	leave
+  8018b8:	c3                   	ret
+
+008018b9 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8018b9:	55                   	push   %ebp
+  8018ba:	89 e5                	mov    %esp,%ebp
+  8018bc:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8018bf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018c2:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  8018c7:	b8 04 00 00 00       	mov    $0x4,%eax
+  8018cc:	e8 f3 fe ff ff       	call   8017c4 <nsipc>
+}
+  8018d1:	c9                   	leave
+  8018d2:	c3                   	ret
+
+008018d3 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8018d3:	55                   	push   %ebp
+  8018d4:	89 e5                	mov    %esp,%ebp
+  8018d6:	53                   	push   %ebx
+  8018d7:	83 ec 08             	sub    $0x8,%esp
+  8018da:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8018dd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018e0:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8018e5:	53                   	push   %ebx
+  8018e6:	ff 75 0c             	push   0xc(%ebp)
+  8018e9:	68 04 60 80 00       	push   $0x806004
+  8018ee:	e8 a2 ef ff ff       	call   800895 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8018f3:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  8018f9:	b8 05 00 00 00       	mov    $0x5,%eax
+  8018fe:	e8 c1 fe ff ff       	call   8017c4 <nsipc>
+}
+  801903:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801906:	c9                   	leave
+  801907:	c3                   	ret
+
+00801908 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801908:	55                   	push   %ebp
+  801909:	89 e5                	mov    %esp,%ebp
+  80190b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  80190e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801911:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  801916:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801919:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  80191e:	b8 06 00 00 00       	mov    $0x6,%eax
+  801923:	e8 9c fe ff ff       	call   8017c4 <nsipc>
+}
+  801928:	c9                   	leave
+  801929:	c3                   	ret
+
+0080192a <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  80192a:	55                   	push   %ebp
+  80192b:	89 e5                	mov    %esp,%ebp
+  80192d:	56                   	push   %esi
+  80192e:	53                   	push   %ebx
+  80192f:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801932:	8b 45 08             	mov    0x8(%ebp),%eax
+  801935:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  80193a:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  801940:	8b 45 14             	mov    0x14(%ebp),%eax
+  801943:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801948:	b8 07 00 00 00       	mov    $0x7,%eax
+  80194d:	e8 72 fe ff ff       	call   8017c4 <nsipc>
+  801952:	89 c3                	mov    %eax,%ebx
+  801954:	85 c0                	test   %eax,%eax
+  801956:	78 22                	js     80197a <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801958:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80195d:	39 c6                	cmp    %eax,%esi
+  80195f:	0f 4e c6             	cmovle %esi,%eax
+  801962:	39 c3                	cmp    %eax,%ebx
+  801964:	7f 1d                	jg     801983 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801966:	83 ec 04             	sub    $0x4,%esp
+  801969:	53                   	push   %ebx
+  80196a:	68 00 60 80 00       	push   $0x806000
+  80196f:	ff 75 0c             	push   0xc(%ebp)
+  801972:	e8 1e ef ff ff       	call   800895 <memmove>
+  801977:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  80197a:	89 d8                	mov    %ebx,%eax
+  80197c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80197f:	5b                   	pop    %ebx
+  801980:	5e                   	pop    %esi
+  801981:	5d                   	pop    %ebp
+  801982:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801983:	68 5f 29 80 00       	push   $0x80295f
+  801988:	68 27 29 80 00       	push   $0x802927
+  80198d:	6a 62                	push   $0x62
+  80198f:	68 74 29 80 00       	push   $0x802974
+  801994:	e8 46 05 00 00       	call   801edf <_panic>
+
+00801999 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801999:	55                   	push   %ebp
+  80199a:	89 e5                	mov    %esp,%ebp
+  80199c:	53                   	push   %ebx
+  80199d:	83 ec 04             	sub    $0x4,%esp
+  8019a0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8019a3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019a6:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  8019ab:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8019b1:	7f 2e                	jg     8019e1 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8019b3:	83 ec 04             	sub    $0x4,%esp
+  8019b6:	53                   	push   %ebx
+  8019b7:	ff 75 0c             	push   0xc(%ebp)
+  8019ba:	68 0c 60 80 00       	push   $0x80600c
+  8019bf:	e8 d1 ee ff ff       	call   800895 <memmove>
+	nsipcbuf.send.req_size = size;
+  8019c4:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  8019ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019cd:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  8019d2:	b8 08 00 00 00       	mov    $0x8,%eax
+  8019d7:	e8 e8 fd ff ff       	call   8017c4 <nsipc>
+}
+  8019dc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019df:	c9                   	leave
+  8019e0:	c3                   	ret
+	assert(size < 1600);
+  8019e1:	68 80 29 80 00       	push   $0x802980
+  8019e6:	68 27 29 80 00       	push   $0x802927
+  8019eb:	6a 6d                	push   $0x6d
+  8019ed:	68 74 29 80 00       	push   $0x802974
+  8019f2:	e8 e8 04 00 00       	call   801edf <_panic>
+
+008019f7 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8019f7:	55                   	push   %ebp
+  8019f8:	89 e5                	mov    %esp,%ebp
+  8019fa:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8019fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a00:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  801a05:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a08:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  801a0d:	8b 45 10             	mov    0x10(%ebp),%eax
+  801a10:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  801a15:	b8 09 00 00 00       	mov    $0x9,%eax
+  801a1a:	e8 a5 fd ff ff       	call   8017c4 <nsipc>
+}
+  801a1f:	c9                   	leave
+  801a20:	c3                   	ret
+
+00801a21 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801a21:	55                   	push   %ebp
+  801a22:	89 e5                	mov    %esp,%ebp
+  801a24:	56                   	push   %esi
+  801a25:	53                   	push   %ebx
+  801a26:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801a29:	83 ec 0c             	sub    $0xc,%esp
+  801a2c:	ff 75 08             	push   0x8(%ebp)
+  801a2f:	e8 aa f3 ff ff       	call   800dde <fd2data>
+  801a34:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801a36:	83 c4 08             	add    $0x8,%esp
+  801a39:	68 8c 29 80 00       	push   $0x80298c
+  801a3e:	53                   	push   %ebx
+  801a3f:	e8 cb ec ff ff       	call   80070f <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801a44:	8b 46 04             	mov    0x4(%esi),%eax
+  801a47:	2b 06                	sub    (%esi),%eax
+  801a49:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  801a4f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801a56:	00 00 00 
+	stat->st_dev = &devpipe;
+  801a59:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  801a60:	30 80 00 
+	return 0;
+}
+  801a63:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a68:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a6b:	5b                   	pop    %ebx
+  801a6c:	5e                   	pop    %esi
+  801a6d:	5d                   	pop    %ebp
+  801a6e:	c3                   	ret
+
+00801a6f <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801a6f:	55                   	push   %ebp
+  801a70:	89 e5                	mov    %esp,%ebp
+  801a72:	53                   	push   %ebx
+  801a73:	83 ec 0c             	sub    $0xc,%esp
+  801a76:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801a79:	53                   	push   %ebx
+  801a7a:	6a 00                	push   $0x0
+  801a7c:	e8 ff f0 ff ff       	call   800b80 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801a81:	89 1c 24             	mov    %ebx,(%esp)
+  801a84:	e8 55 f3 ff ff       	call   800dde <fd2data>
+  801a89:	83 c4 08             	add    $0x8,%esp
+  801a8c:	50                   	push   %eax
+  801a8d:	6a 00                	push   $0x0
+  801a8f:	e8 ec f0 ff ff       	call   800b80 <sys_page_unmap>
+}
+  801a94:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a97:	c9                   	leave
+  801a98:	c3                   	ret
+
+00801a99 <_pipeisclosed>:
+{
+  801a99:	55                   	push   %ebp
+  801a9a:	89 e5                	mov    %esp,%ebp
+  801a9c:	57                   	push   %edi
+  801a9d:	56                   	push   %esi
+  801a9e:	53                   	push   %ebx
+  801a9f:	83 ec 1c             	sub    $0x1c,%esp
+  801aa2:	89 c7                	mov    %eax,%edi
+  801aa4:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801aa6:	a1 08 40 80 00       	mov    0x804008,%eax
+  801aab:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801aae:	83 ec 0c             	sub    $0xc,%esp
+  801ab1:	57                   	push   %edi
+  801ab2:	e8 75 05 00 00       	call   80202c <pageref>
+  801ab7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801aba:	89 34 24             	mov    %esi,(%esp)
+  801abd:	e8 6a 05 00 00       	call   80202c <pageref>
+		nn = thisenv->env_runs;
+  801ac2:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801ac8:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801acb:	83 c4 10             	add    $0x10,%esp
+  801ace:	39 cb                	cmp    %ecx,%ebx
+  801ad0:	74 1b                	je     801aed <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801ad2:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801ad5:	75 cf                	jne    801aa6 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801ad7:	8b 42 58             	mov    0x58(%edx),%eax
+  801ada:	6a 01                	push   $0x1
+  801adc:	50                   	push   %eax
+  801add:	53                   	push   %ebx
+  801ade:	68 93 29 80 00       	push   $0x802993
+  801ae3:	e8 6e e6 ff ff       	call   800156 <cprintf>
+  801ae8:	83 c4 10             	add    $0x10,%esp
+  801aeb:	eb b9                	jmp    801aa6 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801aed:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801af0:	0f 94 c0             	sete   %al
+  801af3:	0f b6 c0             	movzbl %al,%eax
+}
+  801af6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801af9:	5b                   	pop    %ebx
+  801afa:	5e                   	pop    %esi
+  801afb:	5f                   	pop    %edi
+  801afc:	5d                   	pop    %ebp
+  801afd:	c3                   	ret
+
+00801afe <devpipe_write>:
+{
+  801afe:	55                   	push   %ebp
+  801aff:	89 e5                	mov    %esp,%ebp
+  801b01:	57                   	push   %edi
+  801b02:	56                   	push   %esi
+  801b03:	53                   	push   %ebx
+  801b04:	83 ec 28             	sub    $0x28,%esp
+  801b07:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801b0a:	56                   	push   %esi
+  801b0b:	e8 ce f2 ff ff       	call   800dde <fd2data>
+  801b10:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801b12:	83 c4 10             	add    $0x10,%esp
+  801b15:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b1a:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801b1d:	75 09                	jne    801b28 <devpipe_write+0x2a>
+	return i;
+  801b1f:	89 f8                	mov    %edi,%eax
+  801b21:	eb 23                	jmp    801b46 <devpipe_write+0x48>
+			sys_yield();
+  801b23:	e8 b4 ef ff ff       	call   800adc <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801b28:	8b 43 04             	mov    0x4(%ebx),%eax
+  801b2b:	8b 0b                	mov    (%ebx),%ecx
+  801b2d:	8d 51 20             	lea    0x20(%ecx),%edx
+  801b30:	39 d0                	cmp    %edx,%eax
+  801b32:	72 1a                	jb     801b4e <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  801b34:	89 da                	mov    %ebx,%edx
+  801b36:	89 f0                	mov    %esi,%eax
+  801b38:	e8 5c ff ff ff       	call   801a99 <_pipeisclosed>
+  801b3d:	85 c0                	test   %eax,%eax
+  801b3f:	74 e2                	je     801b23 <devpipe_write+0x25>
+				return 0;
+  801b41:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b46:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b49:	5b                   	pop    %ebx
+  801b4a:	5e                   	pop    %esi
+  801b4b:	5f                   	pop    %edi
+  801b4c:	5d                   	pop    %ebp
+  801b4d:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801b4e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b51:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801b55:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801b58:	89 c2                	mov    %eax,%edx
+  801b5a:	c1 fa 1f             	sar    $0x1f,%edx
+  801b5d:	89 d1                	mov    %edx,%ecx
+  801b5f:	c1 e9 1b             	shr    $0x1b,%ecx
+  801b62:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801b65:	83 e2 1f             	and    $0x1f,%edx
+  801b68:	29 ca                	sub    %ecx,%edx
+  801b6a:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801b6e:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  801b72:	83 c0 01             	add    $0x1,%eax
+  801b75:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  801b78:	83 c7 01             	add    $0x1,%edi
+  801b7b:	eb 9d                	jmp    801b1a <devpipe_write+0x1c>
+
+00801b7d <devpipe_read>:
+{
+  801b7d:	55                   	push   %ebp
+  801b7e:	89 e5                	mov    %esp,%ebp
+  801b80:	57                   	push   %edi
+  801b81:	56                   	push   %esi
+  801b82:	53                   	push   %ebx
+  801b83:	83 ec 18             	sub    $0x18,%esp
+  801b86:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  801b89:	57                   	push   %edi
+  801b8a:	e8 4f f2 ff ff       	call   800dde <fd2data>
+  801b8f:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801b91:	83 c4 10             	add    $0x10,%esp
+  801b94:	be 00 00 00 00       	mov    $0x0,%esi
+  801b99:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801b9c:	75 13                	jne    801bb1 <devpipe_read+0x34>
+	return i;
+  801b9e:	89 f0                	mov    %esi,%eax
+  801ba0:	eb 02                	jmp    801ba4 <devpipe_read+0x27>
+				return i;
+  801ba2:	89 f0                	mov    %esi,%eax
+}
+  801ba4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ba7:	5b                   	pop    %ebx
+  801ba8:	5e                   	pop    %esi
+  801ba9:	5f                   	pop    %edi
+  801baa:	5d                   	pop    %ebp
+  801bab:	c3                   	ret
+			sys_yield();
+  801bac:	e8 2b ef ff ff       	call   800adc <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  801bb1:	8b 03                	mov    (%ebx),%eax
+  801bb3:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801bb6:	75 18                	jne    801bd0 <devpipe_read+0x53>
+			if (i > 0)
+  801bb8:	85 f6                	test   %esi,%esi
+  801bba:	75 e6                	jne    801ba2 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  801bbc:	89 da                	mov    %ebx,%edx
+  801bbe:	89 f8                	mov    %edi,%eax
+  801bc0:	e8 d4 fe ff ff       	call   801a99 <_pipeisclosed>
+  801bc5:	85 c0                	test   %eax,%eax
+  801bc7:	74 e3                	je     801bac <devpipe_read+0x2f>
+				return 0;
+  801bc9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bce:	eb d4                	jmp    801ba4 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801bd0:	99                   	cltd
+  801bd1:	c1 ea 1b             	shr    $0x1b,%edx
+  801bd4:	01 d0                	add    %edx,%eax
+  801bd6:	83 e0 1f             	and    $0x1f,%eax
+  801bd9:	29 d0                	sub    %edx,%eax
+  801bdb:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801be0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801be3:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  801be6:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  801be9:	83 c6 01             	add    $0x1,%esi
+  801bec:	eb ab                	jmp    801b99 <devpipe_read+0x1c>
+
+00801bee <pipe>:
+{
+  801bee:	55                   	push   %ebp
+  801bef:	89 e5                	mov    %esp,%ebp
+  801bf1:	56                   	push   %esi
+  801bf2:	53                   	push   %ebx
+  801bf3:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801bf6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bf9:	50                   	push   %eax
+  801bfa:	e8 f6 f1 ff ff       	call   800df5 <fd_alloc>
+  801bff:	89 c3                	mov    %eax,%ebx
+  801c01:	83 c4 10             	add    $0x10,%esp
+  801c04:	85 c0                	test   %eax,%eax
+  801c06:	0f 88 23 01 00 00    	js     801d2f <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801c0c:	83 ec 04             	sub    $0x4,%esp
+  801c0f:	68 07 04 00 00       	push   $0x407
+  801c14:	ff 75 f4             	push   -0xc(%ebp)
+  801c17:	6a 00                	push   $0x0
+  801c19:	e8 dd ee ff ff       	call   800afb <sys_page_alloc>
+  801c1e:	89 c3                	mov    %eax,%ebx
+  801c20:	83 c4 10             	add    $0x10,%esp
+  801c23:	85 c0                	test   %eax,%eax
+  801c25:	0f 88 04 01 00 00    	js     801d2f <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801c2b:	83 ec 0c             	sub    $0xc,%esp
+  801c2e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c31:	50                   	push   %eax
+  801c32:	e8 be f1 ff ff       	call   800df5 <fd_alloc>
+  801c37:	89 c3                	mov    %eax,%ebx
+  801c39:	83 c4 10             	add    $0x10,%esp
+  801c3c:	85 c0                	test   %eax,%eax
+  801c3e:	0f 88 db 00 00 00    	js     801d1f <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801c44:	83 ec 04             	sub    $0x4,%esp
+  801c47:	68 07 04 00 00       	push   $0x407
+  801c4c:	ff 75 f0             	push   -0x10(%ebp)
+  801c4f:	6a 00                	push   $0x0
+  801c51:	e8 a5 ee ff ff       	call   800afb <sys_page_alloc>
+  801c56:	89 c3                	mov    %eax,%ebx
+  801c58:	83 c4 10             	add    $0x10,%esp
+  801c5b:	85 c0                	test   %eax,%eax
+  801c5d:	0f 88 bc 00 00 00    	js     801d1f <pipe+0x131>
+	va = fd2data(fd0);
+  801c63:	83 ec 0c             	sub    $0xc,%esp
+  801c66:	ff 75 f4             	push   -0xc(%ebp)
+  801c69:	e8 70 f1 ff ff       	call   800dde <fd2data>
+  801c6e:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801c70:	83 c4 0c             	add    $0xc,%esp
+  801c73:	68 07 04 00 00       	push   $0x407
+  801c78:	50                   	push   %eax
+  801c79:	6a 00                	push   $0x0
+  801c7b:	e8 7b ee ff ff       	call   800afb <sys_page_alloc>
+  801c80:	89 c3                	mov    %eax,%ebx
+  801c82:	83 c4 10             	add    $0x10,%esp
+  801c85:	85 c0                	test   %eax,%eax
+  801c87:	0f 88 82 00 00 00    	js     801d0f <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801c8d:	83 ec 0c             	sub    $0xc,%esp
+  801c90:	ff 75 f0             	push   -0x10(%ebp)
+  801c93:	e8 46 f1 ff ff       	call   800dde <fd2data>
+  801c98:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801c9f:	50                   	push   %eax
+  801ca0:	6a 00                	push   $0x0
+  801ca2:	56                   	push   %esi
+  801ca3:	6a 00                	push   $0x0
+  801ca5:	e8 94 ee ff ff       	call   800b3e <sys_page_map>
+  801caa:	89 c3                	mov    %eax,%ebx
+  801cac:	83 c4 20             	add    $0x20,%esp
+  801caf:	85 c0                	test   %eax,%eax
+  801cb1:	78 4e                	js     801d01 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  801cb3:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  801cb8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801cbb:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  801cbd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801cc0:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  801cc7:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801cca:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  801ccc:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801ccf:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  801cd6:	83 ec 0c             	sub    $0xc,%esp
+  801cd9:	ff 75 f4             	push   -0xc(%ebp)
+  801cdc:	e8 ed f0 ff ff       	call   800dce <fd2num>
+  801ce1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801ce4:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  801ce6:	83 c4 04             	add    $0x4,%esp
+  801ce9:	ff 75 f0             	push   -0x10(%ebp)
+  801cec:	e8 dd f0 ff ff       	call   800dce <fd2num>
+  801cf1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801cf4:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  801cf7:	83 c4 10             	add    $0x10,%esp
+  801cfa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cff:	eb 2e                	jmp    801d2f <pipe+0x141>
+	sys_page_unmap(0, va);
+  801d01:	83 ec 08             	sub    $0x8,%esp
+  801d04:	56                   	push   %esi
+  801d05:	6a 00                	push   $0x0
+  801d07:	e8 74 ee ff ff       	call   800b80 <sys_page_unmap>
+  801d0c:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  801d0f:	83 ec 08             	sub    $0x8,%esp
+  801d12:	ff 75 f0             	push   -0x10(%ebp)
+  801d15:	6a 00                	push   $0x0
+  801d17:	e8 64 ee ff ff       	call   800b80 <sys_page_unmap>
+  801d1c:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  801d1f:	83 ec 08             	sub    $0x8,%esp
+  801d22:	ff 75 f4             	push   -0xc(%ebp)
+  801d25:	6a 00                	push   $0x0
+  801d27:	e8 54 ee ff ff       	call   800b80 <sys_page_unmap>
+  801d2c:	83 c4 10             	add    $0x10,%esp
+}
+  801d2f:	89 d8                	mov    %ebx,%eax
+  801d31:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d34:	5b                   	pop    %ebx
+  801d35:	5e                   	pop    %esi
+  801d36:	5d                   	pop    %ebp
+  801d37:	c3                   	ret
+
+00801d38 <pipeisclosed>:
+{
+  801d38:	55                   	push   %ebp
+  801d39:	89 e5                	mov    %esp,%ebp
+  801d3b:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d3e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d41:	50                   	push   %eax
+  801d42:	ff 75 08             	push   0x8(%ebp)
+  801d45:	e8 01 f1 ff ff       	call   800e4b <fd_lookup>
+  801d4a:	83 c4 10             	add    $0x10,%esp
+  801d4d:	85 c0                	test   %eax,%eax
+  801d4f:	78 18                	js     801d69 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  801d51:	83 ec 0c             	sub    $0xc,%esp
+  801d54:	ff 75 f4             	push   -0xc(%ebp)
+  801d57:	e8 82 f0 ff ff       	call   800dde <fd2data>
+  801d5c:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  801d5e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d61:	e8 33 fd ff ff       	call   801a99 <_pipeisclosed>
+  801d66:	83 c4 10             	add    $0x10,%esp
+}
+  801d69:	c9                   	leave
+  801d6a:	c3                   	ret
+
+00801d6b <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  801d6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d70:	c3                   	ret
+
+00801d71 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  801d71:	55                   	push   %ebp
+  801d72:	89 e5                	mov    %esp,%ebp
+  801d74:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  801d77:	68 ab 29 80 00       	push   $0x8029ab
+  801d7c:	ff 75 0c             	push   0xc(%ebp)
+  801d7f:	e8 8b e9 ff ff       	call   80070f <strcpy>
+	return 0;
+}
+  801d84:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d89:	c9                   	leave
+  801d8a:	c3                   	ret
+
+00801d8b <devcons_write>:
+{
+  801d8b:	55                   	push   %ebp
+  801d8c:	89 e5                	mov    %esp,%ebp
+  801d8e:	57                   	push   %edi
+  801d8f:	56                   	push   %esi
+  801d90:	53                   	push   %ebx
+  801d91:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  801d97:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  801d9c:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  801da2:	eb 2e                	jmp    801dd2 <devcons_write+0x47>
+		m = n - tot;
+  801da4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801da7:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  801da9:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801dae:	39 c3                	cmp    %eax,%ebx
+  801db0:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  801db3:	83 ec 04             	sub    $0x4,%esp
+  801db6:	53                   	push   %ebx
+  801db7:	89 f0                	mov    %esi,%eax
+  801db9:	03 45 0c             	add    0xc(%ebp),%eax
+  801dbc:	50                   	push   %eax
+  801dbd:	57                   	push   %edi
+  801dbe:	e8 d2 ea ff ff       	call   800895 <memmove>
+		sys_cputs(buf, m);
+  801dc3:	83 c4 08             	add    $0x8,%esp
+  801dc6:	53                   	push   %ebx
+  801dc7:	57                   	push   %edi
+  801dc8:	e8 72 ec ff ff       	call   800a3f <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  801dcd:	01 de                	add    %ebx,%esi
+  801dcf:	83 c4 10             	add    $0x10,%esp
+  801dd2:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801dd5:	72 cd                	jb     801da4 <devcons_write+0x19>
+}
+  801dd7:	89 f0                	mov    %esi,%eax
+  801dd9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ddc:	5b                   	pop    %ebx
+  801ddd:	5e                   	pop    %esi
+  801dde:	5f                   	pop    %edi
+  801ddf:	5d                   	pop    %ebp
+  801de0:	c3                   	ret
+
+00801de1 <devcons_read>:
+{
+  801de1:	55                   	push   %ebp
+  801de2:	89 e5                	mov    %esp,%ebp
+  801de4:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  801de7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dec:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801df0:	75 07                	jne    801df9 <devcons_read+0x18>
+  801df2:	eb 1f                	jmp    801e13 <devcons_read+0x32>
+		sys_yield();
+  801df4:	e8 e3 ec ff ff       	call   800adc <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  801df9:	e8 5f ec ff ff       	call   800a5d <sys_cgetc>
+  801dfe:	85 c0                	test   %eax,%eax
+  801e00:	74 f2                	je     801df4 <devcons_read+0x13>
+	if (c < 0)
+  801e02:	78 0f                	js     801e13 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  801e04:	83 f8 04             	cmp    $0x4,%eax
+  801e07:	74 0c                	je     801e15 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  801e09:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e0c:	88 02                	mov    %al,(%edx)
+	return 1;
+  801e0e:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  801e13:	c9                   	leave
+  801e14:	c3                   	ret
+		return 0;
+  801e15:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e1a:	eb f7                	jmp    801e13 <devcons_read+0x32>
+
+00801e1c <cputchar>:
+{
+  801e1c:	55                   	push   %ebp
+  801e1d:	89 e5                	mov    %esp,%ebp
+  801e1f:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  801e22:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e25:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  801e28:	6a 01                	push   $0x1
+  801e2a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801e2d:	50                   	push   %eax
+  801e2e:	e8 0c ec ff ff       	call   800a3f <sys_cputs>
+}
+  801e33:	83 c4 10             	add    $0x10,%esp
+  801e36:	c9                   	leave
+  801e37:	c3                   	ret
+
+00801e38 <getchar>:
+{
+  801e38:	55                   	push   %ebp
+  801e39:	89 e5                	mov    %esp,%ebp
+  801e3b:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  801e3e:	6a 01                	push   $0x1
+  801e40:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801e43:	50                   	push   %eax
+  801e44:	6a 00                	push   $0x0
+  801e46:	e8 66 f2 ff ff       	call   8010b1 <read>
+	if (r < 0)
+  801e4b:	83 c4 10             	add    $0x10,%esp
+  801e4e:	85 c0                	test   %eax,%eax
+  801e50:	78 06                	js     801e58 <getchar+0x20>
+	if (r < 1)
+  801e52:	74 06                	je     801e5a <getchar+0x22>
+	return c;
+  801e54:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  801e58:	c9                   	leave
+  801e59:	c3                   	ret
+		return -E_EOF;
+  801e5a:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  801e5f:	eb f7                	jmp    801e58 <getchar+0x20>
+
+00801e61 <iscons>:
+{
+  801e61:	55                   	push   %ebp
+  801e62:	89 e5                	mov    %esp,%ebp
+  801e64:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801e67:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e6a:	50                   	push   %eax
+  801e6b:	ff 75 08             	push   0x8(%ebp)
+  801e6e:	e8 d8 ef ff ff       	call   800e4b <fd_lookup>
+  801e73:	83 c4 10             	add    $0x10,%esp
+  801e76:	85 c0                	test   %eax,%eax
+  801e78:	78 11                	js     801e8b <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  801e7a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e7d:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  801e83:	39 10                	cmp    %edx,(%eax)
+  801e85:	0f 94 c0             	sete   %al
+  801e88:	0f b6 c0             	movzbl %al,%eax
+}
+  801e8b:	c9                   	leave
+  801e8c:	c3                   	ret
+
+00801e8d <opencons>:
+{
+  801e8d:	55                   	push   %ebp
+  801e8e:	89 e5                	mov    %esp,%ebp
+  801e90:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  801e93:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e96:	50                   	push   %eax
+  801e97:	e8 59 ef ff ff       	call   800df5 <fd_alloc>
+  801e9c:	83 c4 10             	add    $0x10,%esp
+  801e9f:	85 c0                	test   %eax,%eax
+  801ea1:	78 3a                	js     801edd <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  801ea3:	83 ec 04             	sub    $0x4,%esp
+  801ea6:	68 07 04 00 00       	push   $0x407
+  801eab:	ff 75 f4             	push   -0xc(%ebp)
+  801eae:	6a 00                	push   $0x0
+  801eb0:	e8 46 ec ff ff       	call   800afb <sys_page_alloc>
+  801eb5:	83 c4 10             	add    $0x10,%esp
+  801eb8:	85 c0                	test   %eax,%eax
+  801eba:	78 21                	js     801edd <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  801ebc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ebf:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  801ec5:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  801ec7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801eca:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  801ed1:	83 ec 0c             	sub    $0xc,%esp
+  801ed4:	50                   	push   %eax
+  801ed5:	e8 f4 ee ff ff       	call   800dce <fd2num>
+  801eda:	83 c4 10             	add    $0x10,%esp
+}
+  801edd:	c9                   	leave
+  801ede:	c3                   	ret
+
+00801edf <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  801edf:	55                   	push   %ebp
+  801ee0:	89 e5                	mov    %esp,%ebp
+  801ee2:	56                   	push   %esi
+  801ee3:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  801ee4:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  801ee7:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  801eed:	e8 cb eb ff ff       	call   800abd <sys_getenvid>
+  801ef2:	83 ec 0c             	sub    $0xc,%esp
+  801ef5:	ff 75 0c             	push   0xc(%ebp)
+  801ef8:	ff 75 08             	push   0x8(%ebp)
+  801efb:	56                   	push   %esi
+  801efc:	50                   	push   %eax
+  801efd:	68 b8 29 80 00       	push   $0x8029b8
+  801f02:	e8 4f e2 ff ff       	call   800156 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  801f07:	83 c4 18             	add    $0x18,%esp
+  801f0a:	53                   	push   %ebx
+  801f0b:	ff 75 10             	push   0x10(%ebp)
+  801f0e:	e8 f2 e1 ff ff       	call   800105 <vcprintf>
+	cprintf("\n");
+  801f13:	c7 04 24 a4 29 80 00 	movl   $0x8029a4,(%esp)
+  801f1a:	e8 37 e2 ff ff       	call   800156 <cprintf>
+  801f1f:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  801f22:	cc                   	int3
+	while (1)
+  801f23:	eb fd                	jmp    801f22 <_panic+0x43>
+
+00801f25 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  801f25:	55                   	push   %ebp
+  801f26:	89 e5                	mov    %esp,%ebp
+  801f28:	56                   	push   %esi
+  801f29:	53                   	push   %ebx
+  801f2a:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f2d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f30:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  801f33:	85 c0                	test   %eax,%eax
+  801f35:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801f3a:	0f 44 c2             	cmove  %edx,%eax
+  801f3d:	83 ec 0c             	sub    $0xc,%esp
+  801f40:	50                   	push   %eax
+  801f41:	e8 65 ed ff ff       	call   800cab <sys_ipc_recv>
+
+  if (from_env_store)
+  801f46:	83 c4 10             	add    $0x10,%esp
+  801f49:	85 f6                	test   %esi,%esi
+  801f4b:	74 17                	je     801f64 <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  801f4d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f52:	85 c0                	test   %eax,%eax
+  801f54:	75 0c                	jne    801f62 <ipc_recv+0x3d>
+  801f56:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801f5c:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  801f62:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  801f64:	85 db                	test   %ebx,%ebx
+  801f66:	74 2b                	je     801f93 <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  801f68:	85 c0                	test   %eax,%eax
+  801f6a:	74 0d                	je     801f79 <ipc_recv+0x54>
+  801f6c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  801f72:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f75:	5b                   	pop    %ebx
+  801f76:	5e                   	pop    %esi
+  801f77:	5d                   	pop    %ebp
+  801f78:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  801f79:	a1 08 40 80 00       	mov    0x804008,%eax
+  801f7e:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  801f84:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  801f86:	a1 08 40 80 00       	mov    0x804008,%eax
+  801f8b:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  801f91:	eb df                	jmp    801f72 <ipc_recv+0x4d>
+  801f93:	85 c0                	test   %eax,%eax
+  801f95:	75 db                	jne    801f72 <ipc_recv+0x4d>
+  801f97:	eb ed                	jmp    801f86 <ipc_recv+0x61>
+
+00801f99 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  801f99:	55                   	push   %ebp
+  801f9a:	89 e5                	mov    %esp,%ebp
+  801f9c:	57                   	push   %edi
+  801f9d:	56                   	push   %esi
+  801f9e:	53                   	push   %ebx
+  801f9f:	83 ec 0c             	sub    $0xc,%esp
+  801fa2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801fa5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801fa8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  801fab:	85 db                	test   %ebx,%ebx
+  801fad:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801fb2:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  801fb5:	ff 75 14             	push   0x14(%ebp)
+  801fb8:	53                   	push   %ebx
+  801fb9:	56                   	push   %esi
+  801fba:	57                   	push   %edi
+  801fbb:	e8 c8 ec ff ff       	call   800c88 <sys_ipc_try_send>
+  801fc0:	83 c4 10             	add    $0x10,%esp
+  801fc3:	85 c0                	test   %eax,%eax
+  801fc5:	74 1e                	je     801fe5 <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  801fc7:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801fca:	75 07                	jne    801fd3 <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  801fcc:	e8 0b eb ff ff       	call   800adc <sys_yield>
+  801fd1:	eb e2                	jmp    801fb5 <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  801fd3:	50                   	push   %eax
+  801fd4:	68 db 29 80 00       	push   $0x8029db
+  801fd9:	6a 3c                	push   $0x3c
+  801fdb:	68 e8 29 80 00       	push   $0x8029e8
+  801fe0:	e8 fa fe ff ff       	call   801edf <_panic>
+  }
+
+#endif
+}
+  801fe5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fe8:	5b                   	pop    %ebx
+  801fe9:	5e                   	pop    %esi
+  801fea:	5f                   	pop    %edi
+  801feb:	5d                   	pop    %ebp
+  801fec:	c3                   	ret
+
+00801fed <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  801fed:	55                   	push   %ebp
+  801fee:	89 e5                	mov    %esp,%ebp
+  801ff0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  801ff3:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  801ff8:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  801ffb:	c1 e0 04             	shl    $0x4,%eax
+  801ffe:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802003:	8b 40 50             	mov    0x50(%eax),%eax
+  802006:	39 c8                	cmp    %ecx,%eax
+  802008:	74 12                	je     80201c <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  80200a:	83 c2 01             	add    $0x1,%edx
+  80200d:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802013:	75 e3                	jne    801ff8 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802015:	b8 00 00 00 00       	mov    $0x0,%eax
+  80201a:	eb 0e                	jmp    80202a <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  80201c:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80201f:	c1 e0 04             	shl    $0x4,%eax
+  802022:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802027:	8b 40 48             	mov    0x48(%eax),%eax
+  80202a:	5d                   	pop    %ebp
+  80202b:	c3                   	ret
+
+0080202c <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80202c:	55                   	push   %ebp
+  80202d:	89 e5                	mov    %esp,%ebp
+  80202f:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802032:	89 c2                	mov    %eax,%edx
+  802034:	c1 ea 16             	shr    $0x16,%edx
+  802037:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80203e:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802043:	f6 c1 01             	test   $0x1,%cl
+  802046:	74 1c                	je     802064 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  802048:	c1 e8 0c             	shr    $0xc,%eax
+  80204b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802052:	a8 01                	test   $0x1,%al
+  802054:	74 0e                	je     802064 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802056:	c1 e8 0c             	shr    $0xc,%eax
+  802059:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802060:	ef 
+  802061:	0f b7 d2             	movzwl %dx,%edx
+}
+  802064:	89 d0                	mov    %edx,%eax
+  802066:	5d                   	pop    %ebp
+  802067:	c3                   	ret
+  802068:	66 90                	xchg   %ax,%ax
+  80206a:	66 90                	xchg   %ax,%ax
+  80206c:	66 90                	xchg   %ax,%ax
+  80206e:	66 90                	xchg   %ax,%ax
+
+00802070 <__udivmoddi4>:
+  802070:	55                   	push   %ebp
+  802071:	57                   	push   %edi
+  802072:	56                   	push   %esi
+  802073:	53                   	push   %ebx
+  802074:	83 ec 24             	sub    $0x24,%esp
+  802077:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80207b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80207f:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  802083:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802087:	8b 54 24 44          	mov    0x44(%esp),%edx
+  80208b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80208f:	8b 44 24 40          	mov    0x40(%esp),%eax
+  802093:	89 d3                	mov    %edx,%ebx
+  802095:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802099:	09 c3                	or     %eax,%ebx
+  80209b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80209f:	0f 84 9c 00 00 00    	je     802141 <__udivmoddi4+0xd1>
+  8020a5:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8020ac:	00 
+  8020ad:	31 c0                	xor    %eax,%eax
+  8020af:	31 d2                	xor    %edx,%edx
+  8020b1:	89 fb                	mov    %edi,%ebx
+  8020b3:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8020ba:	00 
+  8020bb:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8020c0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8020c4:	01 c0                	add    %eax,%eax
+  8020c6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8020cd:	00 
+  8020ce:	89 c6                	mov    %eax,%esi
+  8020d0:	89 d7                	mov    %edx,%edi
+  8020d2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8020d6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8020da:	0f ad d0             	shrd   %cl,%edx,%eax
+  8020dd:	d3 ea                	shr    %cl,%edx
+  8020df:	f6 c1 20             	test   $0x20,%cl
+  8020e2:	0f 45 c2             	cmovne %edx,%eax
+  8020e5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8020e9:	83 e0 01             	and    $0x1,%eax
+  8020ec:	09 fa                	or     %edi,%edx
+  8020ee:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8020f2:	89 04 24             	mov    %eax,(%esp)
+  8020f5:	8b 04 24             	mov    (%esp),%eax
+  8020f8:	89 d5                	mov    %edx,%ebp
+  8020fa:	09 f0                	or     %esi,%eax
+  8020fc:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802100:	39 f0                	cmp    %esi,%eax
+  802102:	19 fd                	sbb    %edi,%ebp
+  802104:	72 1d                	jb     802123 <__udivmoddi4+0xb3>
+  802106:	29 f0                	sub    %esi,%eax
+  802108:	19 fa                	sbb    %edi,%edx
+  80210a:	89 cf                	mov    %ecx,%edi
+  80210c:	c1 ef 05             	shr    $0x5,%edi
+  80210f:	83 e7 01             	and    $0x1,%edi
+  802112:	89 fe                	mov    %edi,%esi
+  802114:	d3 e7                	shl    %cl,%edi
+  802116:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80211a:	83 f6 01             	xor    $0x1,%esi
+  80211d:	d3 e6                	shl    %cl,%esi
+  80211f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802123:	83 e9 01             	sub    $0x1,%ecx
+  802126:	73 98                	jae    8020c0 <__udivmoddi4+0x50>
+  802128:	85 db                	test   %ebx,%ebx
+  80212a:	74 05                	je     802131 <__udivmoddi4+0xc1>
+  80212c:	89 03                	mov    %eax,(%ebx)
+  80212e:	89 53 04             	mov    %edx,0x4(%ebx)
+  802131:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802135:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802139:	83 c4 24             	add    $0x24,%esp
+  80213c:	5b                   	pop    %ebx
+  80213d:	5e                   	pop    %esi
+  80213e:	5f                   	pop    %edi
+  80213f:	5d                   	pop    %ebp
+  802140:	c3                   	ret
+  802141:	85 ff                	test   %edi,%edi
+  802143:	74 0d                	je     802152 <__udivmoddi4+0xe2>
+  802145:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  80214b:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  802152:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802156:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80215a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80215e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802162:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802166:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80216a:	83 c4 24             	add    $0x24,%esp
+  80216d:	5b                   	pop    %ebx
+  80216e:	5e                   	pop    %esi
+  80216f:	5f                   	pop    %edi
+  802170:	5d                   	pop    %ebp
+  802171:	c3                   	ret
+  802172:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802179:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00802180 <__udivdi3>:
+  802180:	57                   	push   %edi
+  802181:	56                   	push   %esi
+  802182:	53                   	push   %ebx
+  802183:	83 ec 20             	sub    $0x20,%esp
+  802186:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80218a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80218e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802192:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802196:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80219a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80219e:	89 d1                	mov    %edx,%ecx
+  8021a0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8021a4:	09 c1                	or     %eax,%ecx
+  8021a6:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8021aa:	89 44 24 18          	mov    %eax,0x18(%esp)
+  8021ae:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  8021b2:	0f 84 88 00 00 00    	je     802240 <__udivdi3+0xc0>
+  8021b8:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8021bf:	00 
+  8021c0:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8021c5:	31 c0                	xor    %eax,%eax
+  8021c7:	31 d2                	xor    %edx,%edx
+  8021c9:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8021d0:	00 
+  8021d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8021d8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8021dc:	01 c0                	add    %eax,%eax
+  8021de:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8021e5:	00 
+  8021e6:	89 c6                	mov    %eax,%esi
+  8021e8:	89 d7                	mov    %edx,%edi
+  8021ea:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8021ee:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8021f2:	0f ad d0             	shrd   %cl,%edx,%eax
+  8021f5:	d3 ea                	shr    %cl,%edx
+  8021f7:	f6 c1 20             	test   $0x20,%cl
+  8021fa:	0f 45 c2             	cmovne %edx,%eax
+  8021fd:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802201:	83 e0 01             	and    $0x1,%eax
+  802204:	09 fa                	or     %edi,%edx
+  802206:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80220a:	89 04 24             	mov    %eax,(%esp)
+  80220d:	8b 04 24             	mov    (%esp),%eax
+  802210:	89 d3                	mov    %edx,%ebx
+  802212:	09 f0                	or     %esi,%eax
+  802214:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802218:	39 f0                	cmp    %esi,%eax
+  80221a:	19 fb                	sbb    %edi,%ebx
+  80221c:	72 1d                	jb     80223b <__udivdi3+0xbb>
+  80221e:	29 f0                	sub    %esi,%eax
+  802220:	19 fa                	sbb    %edi,%edx
+  802222:	89 cf                	mov    %ecx,%edi
+  802224:	c1 ef 05             	shr    $0x5,%edi
+  802227:	83 e7 01             	and    $0x1,%edi
+  80222a:	89 fe                	mov    %edi,%esi
+  80222c:	d3 e7                	shl    %cl,%edi
+  80222e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802232:	83 f6 01             	xor    $0x1,%esi
+  802235:	d3 e6                	shl    %cl,%esi
+  802237:	09 74 24 18          	or     %esi,0x18(%esp)
+  80223b:	83 e9 01             	sub    $0x1,%ecx
+  80223e:	73 98                	jae    8021d8 <__udivdi3+0x58>
+  802240:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802244:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802248:	83 c4 20             	add    $0x20,%esp
+  80224b:	5b                   	pop    %ebx
+  80224c:	5e                   	pop    %esi
+  80224d:	5f                   	pop    %edi
+  80224e:	c3                   	ret
+  80224f:	90                   	nop
+
+00802250 <__umoddi3>:
+  802250:	57                   	push   %edi
+  802251:	56                   	push   %esi
+  802252:	53                   	push   %ebx
+  802253:	83 ec 18             	sub    $0x18,%esp
+  802256:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80225a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80225e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802262:	8b 54 24 34          	mov    0x34(%esp),%edx
+  802266:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80226a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80226e:	89 d1                	mov    %edx,%ecx
+  802270:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802274:	09 c1                	or     %eax,%ecx
+  802276:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80227a:	74 5b                	je     8022d7 <__umoddi3+0x87>
+  80227c:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802281:	31 c0                	xor    %eax,%eax
+  802283:	31 d2                	xor    %edx,%edx
+  802285:	8d 76 00             	lea    0x0(%esi),%esi
+  802288:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80228c:	01 c0                	add    %eax,%eax
+  80228e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802295:	00 
+  802296:	89 c6                	mov    %eax,%esi
+  802298:	89 d7                	mov    %edx,%edi
+  80229a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80229e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8022a2:	0f ad d0             	shrd   %cl,%edx,%eax
+  8022a5:	d3 ea                	shr    %cl,%edx
+  8022a7:	f6 c1 20             	test   $0x20,%cl
+  8022aa:	0f 45 c2             	cmovne %edx,%eax
+  8022ad:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8022b1:	83 e0 01             	and    $0x1,%eax
+  8022b4:	09 fa                	or     %edi,%edx
+  8022b6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8022ba:	89 04 24             	mov    %eax,(%esp)
+  8022bd:	8b 04 24             	mov    (%esp),%eax
+  8022c0:	89 d3                	mov    %edx,%ebx
+  8022c2:	09 f0                	or     %esi,%eax
+  8022c4:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8022c8:	39 f0                	cmp    %esi,%eax
+  8022ca:	19 fb                	sbb    %edi,%ebx
+  8022cc:	72 04                	jb     8022d2 <__umoddi3+0x82>
+  8022ce:	29 f0                	sub    %esi,%eax
+  8022d0:	19 fa                	sbb    %edi,%edx
+  8022d2:	83 e9 01             	sub    $0x1,%ecx
+  8022d5:	73 b1                	jae    802288 <__umoddi3+0x38>
+  8022d7:	83 c4 18             	add    $0x18,%esp
+  8022da:	5b                   	pop    %ebx
+  8022db:	5e                   	pop    %esi
+  8022dc:	5f                   	pop    %edi
+  8022dd:	c3                   	ret
+  8022de:	66 90                	xchg   %ax,%ax
+
+008022e0 <__divdi3>:
+  8022e0:	55                   	push   %ebp
+  8022e1:	57                   	push   %edi
+  8022e2:	56                   	push   %esi
+  8022e3:	53                   	push   %ebx
+  8022e4:	83 ec 24             	sub    $0x24,%esp
+  8022e7:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  8022eb:	8b 74 24 44          	mov    0x44(%esp),%esi
+  8022ef:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8022f3:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8022f7:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  8022fb:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8022ff:	85 d2                	test   %edx,%edx
+  802301:	0f 88 e0 00 00 00    	js     8023e7 <__divdi3+0x107>
+  802307:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  80230b:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  80230f:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802313:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802317:	85 f6                	test   %esi,%esi
+  802319:	78 16                	js     802331 <__divdi3+0x51>
+  80231b:	89 f1                	mov    %esi,%ecx
+  80231d:	31 c0                	xor    %eax,%eax
+  80231f:	31 d2                	xor    %edx,%edx
+  802321:	09 d9                	or     %ebx,%ecx
+  802323:	0f 85 f3 00 00 00    	jne    80241c <__divdi3+0x13c>
+  802329:	83 c4 24             	add    $0x24,%esp
+  80232c:	5b                   	pop    %ebx
+  80232d:	5e                   	pop    %esi
+  80232e:	5f                   	pop    %edi
+  80232f:	5d                   	pop    %ebp
+  802330:	c3                   	ret
+  802331:	bf 01 00 00 00       	mov    $0x1,%edi
+  802336:	f7 5c 24 08          	negl   0x8(%esp)
+  80233a:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  80233f:	f7 5c 24 0c          	negl   0xc(%esp)
+  802343:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80234a:	00 
+  80234b:	31 c0                	xor    %eax,%eax
+  80234d:	31 d2                	xor    %edx,%edx
+  80234f:	89 fb                	mov    %edi,%ebx
+  802351:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802358:	00 
+  802359:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80235e:	66 90                	xchg   %ax,%ax
+  802360:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802364:	01 c0                	add    %eax,%eax
+  802366:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80236d:	00 
+  80236e:	89 c6                	mov    %eax,%esi
+  802370:	89 d7                	mov    %edx,%edi
+  802372:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802376:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80237a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80237d:	d3 ea                	shr    %cl,%edx
+  80237f:	f6 c1 20             	test   $0x20,%cl
+  802382:	0f 45 c2             	cmovne %edx,%eax
+  802385:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802389:	83 e0 01             	and    $0x1,%eax
+  80238c:	09 fa                	or     %edi,%edx
+  80238e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802392:	89 04 24             	mov    %eax,(%esp)
+  802395:	8b 04 24             	mov    (%esp),%eax
+  802398:	89 d5                	mov    %edx,%ebp
+  80239a:	09 f0                	or     %esi,%eax
+  80239c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8023a0:	39 f0                	cmp    %esi,%eax
+  8023a2:	19 fd                	sbb    %edi,%ebp
+  8023a4:	72 1d                	jb     8023c3 <__divdi3+0xe3>
+  8023a6:	29 f0                	sub    %esi,%eax
+  8023a8:	19 fa                	sbb    %edi,%edx
+  8023aa:	89 cf                	mov    %ecx,%edi
+  8023ac:	c1 ef 05             	shr    $0x5,%edi
+  8023af:	83 e7 01             	and    $0x1,%edi
+  8023b2:	89 fe                	mov    %edi,%esi
+  8023b4:	d3 e7                	shl    %cl,%edi
+  8023b6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8023ba:	83 f6 01             	xor    $0x1,%esi
+  8023bd:	d3 e6                	shl    %cl,%esi
+  8023bf:	09 74 24 18          	or     %esi,0x18(%esp)
+  8023c3:	83 e9 01             	sub    $0x1,%ecx
+  8023c6:	73 98                	jae    802360 <__divdi3+0x80>
+  8023c8:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8023cc:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8023d0:	85 db                	test   %ebx,%ebx
+  8023d2:	0f 84 51 ff ff ff    	je     802329 <__divdi3+0x49>
+  8023d8:	f7 d8                	neg    %eax
+  8023da:	83 d2 00             	adc    $0x0,%edx
+  8023dd:	83 c4 24             	add    $0x24,%esp
+  8023e0:	5b                   	pop    %ebx
+  8023e1:	f7 da                	neg    %edx
+  8023e3:	5e                   	pop    %esi
+  8023e4:	5f                   	pop    %edi
+  8023e5:	5d                   	pop    %ebp
+  8023e6:	c3                   	ret
+  8023e7:	f7 d8                	neg    %eax
+  8023e9:	83 d2 00             	adc    $0x0,%edx
+  8023ec:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8023f0:	f7 da                	neg    %edx
+  8023f2:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8023f6:	85 f6                	test   %esi,%esi
+  8023f8:	78 1b                	js     802415 <__divdi3+0x135>
+  8023fa:	89 f1                	mov    %esi,%ecx
+  8023fc:	31 c0                	xor    %eax,%eax
+  8023fe:	31 d2                	xor    %edx,%edx
+  802400:	bf 01 00 00 00       	mov    $0x1,%edi
+  802405:	09 d9                	or     %ebx,%ecx
+  802407:	0f 85 36 ff ff ff    	jne    802343 <__divdi3+0x63>
+  80240d:	83 c4 24             	add    $0x24,%esp
+  802410:	5b                   	pop    %ebx
+  802411:	5e                   	pop    %esi
+  802412:	5f                   	pop    %edi
+  802413:	5d                   	pop    %ebp
+  802414:	c3                   	ret
+  802415:	31 ff                	xor    %edi,%edi
+  802417:	e9 1a ff ff ff       	jmp    802336 <__divdi3+0x56>
+  80241c:	31 ff                	xor    %edi,%edi
+  80241e:	e9 20 ff ff ff       	jmp    802343 <__divdi3+0x63>
+  802423:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80242a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00802430 <__moddi3>:
+  802430:	55                   	push   %ebp
+  802431:	57                   	push   %edi
+  802432:	56                   	push   %esi
+  802433:	53                   	push   %ebx
+  802434:	83 ec 1c             	sub    $0x1c,%esp
+  802437:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  80243b:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  80243f:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  802443:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  802447:	89 c8                	mov    %ecx,%eax
+  802449:	89 f2                	mov    %esi,%edx
+  80244b:	89 f3                	mov    %esi,%ebx
+  80244d:	85 ed                	test   %ebp,%ebp
+  80244f:	0f 88 9d 00 00 00    	js     8024f2 <__moddi3+0xc2>
+  802455:	09 cb                	or     %ecx,%ebx
+  802457:	0f 84 8d 00 00 00    	je     8024ea <__moddi3+0xba>
+  80245d:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802461:	31 db                	xor    %ebx,%ebx
+  802463:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802467:	89 ca                	mov    %ecx,%edx
+  802469:	89 f0                	mov    %esi,%eax
+  80246b:	89 dd                	mov    %ebx,%ebp
+  80246d:	f7 da                	neg    %edx
+  80246f:	83 d0 00             	adc    $0x0,%eax
+  802472:	f7 d8                	neg    %eax
+  802474:	0f 49 f0             	cmovns %eax,%esi
+  802477:	0f 49 ca             	cmovns %edx,%ecx
+  80247a:	31 c0                	xor    %eax,%eax
+  80247c:	31 d2                	xor    %edx,%edx
+  80247e:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802482:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802486:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80248b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80248f:	90                   	nop
+  802490:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802494:	01 c0                	add    %eax,%eax
+  802496:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80249d:	00 
+  80249e:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  8024a2:	89 c6                	mov    %eax,%esi
+  8024a4:	89 d7                	mov    %edx,%edi
+  8024a6:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8024aa:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8024ae:	0f ad d0             	shrd   %cl,%edx,%eax
+  8024b1:	d3 ea                	shr    %cl,%edx
+  8024b3:	f6 c1 20             	test   $0x20,%cl
+  8024b6:	0f 45 c2             	cmovne %edx,%eax
+  8024b9:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8024bd:	83 e0 01             	and    $0x1,%eax
+  8024c0:	09 fa                	or     %edi,%edx
+  8024c2:	89 04 24             	mov    %eax,(%esp)
+  8024c5:	8b 04 24             	mov    (%esp),%eax
+  8024c8:	89 d7                	mov    %edx,%edi
+  8024ca:	09 f0                	or     %esi,%eax
+  8024cc:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  8024d0:	39 d8                	cmp    %ebx,%eax
+  8024d2:	19 f7                	sbb    %esi,%edi
+  8024d4:	72 04                	jb     8024da <__moddi3+0xaa>
+  8024d6:	29 d8                	sub    %ebx,%eax
+  8024d8:	19 f2                	sbb    %esi,%edx
+  8024da:	83 e9 01             	sub    $0x1,%ecx
+  8024dd:	73 b1                	jae    802490 <__moddi3+0x60>
+  8024df:	85 ed                	test   %ebp,%ebp
+  8024e1:	74 07                	je     8024ea <__moddi3+0xba>
+  8024e3:	f7 d8                	neg    %eax
+  8024e5:	83 d2 00             	adc    $0x0,%edx
+  8024e8:	f7 da                	neg    %edx
+  8024ea:	83 c4 1c             	add    $0x1c,%esp
+  8024ed:	5b                   	pop    %ebx
+  8024ee:	5e                   	pop    %esi
+  8024ef:	5f                   	pop    %edi
+  8024f0:	5d                   	pop    %ebp
+  8024f1:	c3                   	ret
+  8024f2:	09 cb                	or     %ecx,%ebx
+  8024f4:	74 f4                	je     8024ea <__moddi3+0xba>
+  8024f6:	f7 df                	neg    %edi
+  8024f8:	bb 01 00 00 00       	mov    $0x1,%ebx
+  8024fd:	83 d5 00             	adc    $0x0,%ebp
+  802500:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802504:	f7 dd                	neg    %ebp
+  802506:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  80250a:	e9 58 ff ff ff       	jmp    802467 <__moddi3+0x37>
@@ -0,0 +1,6480 @@
+
+obj/user/httpd.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 ee 07 00 00       	call   80081f <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <die>:
+  {400, "Bad Request"},
+  {404, "Not Found"},
+};
+
+static void
+die(char *m) {
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+  cprintf("%s\n", m);
+  800039:	50                   	push   %eax
+  80003a:	68 60 2f 80 00       	push   $0x802f60
+  80003f:	e8 19 09 00 00       	call   80095d <cprintf>
+  exit();
+  800044:	e8 1f 08 00 00       	call   800868 <exit>
+}
+  800049:	83 c4 10             	add    $0x10,%esp
+  80004c:	c9                   	leave
+  80004d:	c3                   	ret
+
+0080004e <send_error>:
+
+  return 0;
+}
+
+static int
+send_error(struct http_request *req, int code) {
+  80004e:	55                   	push   %ebp
+  80004f:	89 e5                	mov    %esp,%ebp
+  800051:	57                   	push   %edi
+  800052:	56                   	push   %esi
+  800053:	53                   	push   %ebx
+  800054:	81 ec 0c 02 00 00    	sub    $0x20c,%esp
+  80005a:	89 c3                	mov    %eax,%ebx
+  char buf[512];
+  int r;
+
+  struct error_messages *e = errors;
+  80005c:	b8 00 40 80 00       	mov    $0x804000,%eax
+  while (e->code != 0 && e->msg != 0) {
+  800061:	8b 08                	mov    (%eax),%ecx
+  800063:	85 c9                	test   %ecx,%ecx
+  800065:	74 0f                	je     800076 <send_error+0x28>
+    if (e->code == code)
+  800067:	83 78 04 00          	cmpl   $0x0,0x4(%eax)
+  80006b:	74 10                	je     80007d <send_error+0x2f>
+  80006d:	39 d1                	cmp    %edx,%ecx
+  80006f:	74 0c                	je     80007d <send_error+0x2f>
+      break;
+    e++;
+  800071:	83 c0 08             	add    $0x8,%eax
+  800074:	eb eb                	jmp    800061 <send_error+0x13>
+  }
+
+  if (e->code == 0)
+    return -1;
+  800076:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80007b:	eb 3b                	jmp    8000b8 <send_error+0x6a>
+
+  r = snprintf(buf, 512, "HTTP/" HTTP_VERSION" %d %s\r\n"
+  80007d:	8b 40 04             	mov    0x4(%eax),%eax
+  800080:	83 ec 04             	sub    $0x4,%esp
+  800083:	50                   	push   %eax
+  800084:	51                   	push   %ecx
+  800085:	50                   	push   %eax
+  800086:	51                   	push   %ecx
+  800087:	68 30 30 80 00       	push   $0x803030
+  80008c:	68 00 02 00 00       	push   $0x200
+  800091:	8d bd e8 fd ff ff    	lea    -0x218(%ebp),%edi
+  800097:	57                   	push   %edi
+  800098:	e8 24 0e 00 00       	call   800ec1 <snprintf>
+  80009d:	89 c6                	mov    %eax,%esi
+                         "Content-type: text/html\r\n"
+                         "\r\n"
+                         "<html><body><p>%d - %s</p></body></html>\r\n",
+               e->code, e->msg, e->code, e->msg);
+
+  if (write(req->sock, buf, r) != r)
+  80009f:	83 c4 1c             	add    $0x1c,%esp
+  8000a2:	50                   	push   %eax
+  8000a3:	57                   	push   %edi
+  8000a4:	ff 33                	push   (%ebx)
+  8000a6:	e8 db 18 00 00       	call   801986 <write>
+  8000ab:	83 c4 10             	add    $0x10,%esp
+  8000ae:	39 f0                	cmp    %esi,%eax
+  8000b0:	0f 95 c0             	setne  %al
+  8000b3:	0f b6 c0             	movzbl %al,%eax
+  8000b6:	f7 d8                	neg    %eax
+    return -1;
+
+  return 0;
+}
+  8000b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000bb:	5b                   	pop    %ebx
+  8000bc:	5e                   	pop    %esi
+  8000bd:	5f                   	pop    %edi
+  8000be:	5d                   	pop    %ebp
+  8000bf:	c3                   	ret
+
+008000c0 <handle_client>:
+  close(fd);
+  return r;
+}
+
+static void
+handle_client(int sock) {
+  8000c0:	55                   	push   %ebp
+  8000c1:	89 e5                	mov    %esp,%ebp
+  8000c3:	57                   	push   %edi
+  8000c4:	56                   	push   %esi
+  8000c5:	53                   	push   %ebx
+  8000c6:	81 ec 50 03 00 00    	sub    $0x350,%esp
+  8000cc:	89 c6                	mov    %eax,%esi
+  int received = -1;
+  struct http_request *req = &con_d;
+
+  while (1) {
+    // Receive message
+    if ((received = read(sock, buffer, BUFFSIZE)) < 0)
+  8000ce:	68 00 02 00 00       	push   $0x200
+  8000d3:	8d 85 dc fd ff ff    	lea    -0x224(%ebp),%eax
+  8000d9:	50                   	push   %eax
+  8000da:	56                   	push   %esi
+  8000db:	e8 d8 17 00 00       	call   8018b8 <read>
+  8000e0:	83 c4 10             	add    $0x10,%esp
+  8000e3:	85 c0                	test   %eax,%eax
+  8000e5:	78 3c                	js     800123 <handle_client+0x63>
+      panic("failed to read");
+
+    memset(req, 0, sizeof(*req));
+  8000e7:	83 ec 04             	sub    $0x4,%esp
+  8000ea:	6a 0c                	push   $0xc
+  8000ec:	6a 00                	push   $0x0
+  8000ee:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  8000f1:	50                   	push   %eax
+  8000f2:	e8 70 0f 00 00       	call   801067 <memset>
+
+    req->sock = sock;
+  8000f7:	89 75 dc             	mov    %esi,-0x24(%ebp)
+  if (strncmp(request, "GET ", 4) != 0)
+  8000fa:	83 c4 0c             	add    $0xc,%esp
+  8000fd:	6a 04                	push   $0x4
+  8000ff:	68 80 2f 80 00       	push   $0x802f80
+  800104:	8d 85 dc fd ff ff    	lea    -0x224(%ebp),%eax
+  80010a:	50                   	push   %eax
+  80010b:	e8 dd 0e 00 00       	call   800fed <strncmp>
+  800110:	83 c4 10             	add    $0x10,%esp
+  800113:	85 c0                	test   %eax,%eax
+  800115:	0f 85 aa 01 00 00    	jne    8002c5 <handle_client+0x205>
+  request += 4;
+  80011b:	8d 9d e0 fd ff ff    	lea    -0x220(%ebp),%ebx
+  800121:	eb 1a                	jmp    80013d <handle_client+0x7d>
+      panic("failed to read");
+  800123:	83 ec 04             	sub    $0x4,%esp
+  800126:	68 64 2f 80 00       	push   $0x802f64
+  80012b:	68 0f 01 00 00       	push   $0x10f
+  800130:	68 73 2f 80 00       	push   $0x802f73
+  800135:	e8 48 07 00 00       	call   800882 <_panic>
+    request++;
+  80013a:	83 c3 01             	add    $0x1,%ebx
+  while (*request && *request != ' ')
+  80013d:	f6 03 df             	testb  $0xdf,(%ebx)
+  800140:	75 f8                	jne    80013a <handle_client+0x7a>
+  url_len = request - url;
+  800142:	89 df                	mov    %ebx,%edi
+  800144:	8d 85 e0 fd ff ff    	lea    -0x220(%ebp),%eax
+  80014a:	29 c7                	sub    %eax,%edi
+  req->url = malloc(url_len + 1);
+  80014c:	83 ec 0c             	sub    $0xc,%esp
+  80014f:	8d 47 01             	lea    0x1(%edi),%eax
+  800152:	50                   	push   %eax
+  800153:	e8 7c 21 00 00       	call   8022d4 <malloc>
+  800158:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  memmove(req->url, url, url_len);
+  80015b:	83 c4 0c             	add    $0xc,%esp
+  80015e:	57                   	push   %edi
+  80015f:	8d 8d e0 fd ff ff    	lea    -0x220(%ebp),%ecx
+  800165:	51                   	push   %ecx
+  800166:	50                   	push   %eax
+  800167:	e8 30 0f 00 00       	call   80109c <memmove>
+  req->url[url_len] = '\0';
+  80016c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80016f:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+  request++;
+  800173:	83 c3 01             	add    $0x1,%ebx
+  while (*request && *request != '\n')
+  800176:	83 c4 10             	add    $0x10,%esp
+  request++;
+  800179:	89 d8                	mov    %ebx,%eax
+  while (*request && *request != '\n')
+  80017b:	eb 03                	jmp    800180 <handle_client+0xc0>
+    request++;
+  80017d:	83 c0 01             	add    $0x1,%eax
+  while (*request && *request != '\n')
+  800180:	0f b6 10             	movzbl (%eax),%edx
+  800183:	84 d2                	test   %dl,%dl
+  800185:	74 05                	je     80018c <handle_client+0xcc>
+  800187:	80 fa 0a             	cmp    $0xa,%dl
+  80018a:	75 f1                	jne    80017d <handle_client+0xbd>
+  version_len = request - version;
+  80018c:	29 d8                	sub    %ebx,%eax
+  80018e:	89 c7                	mov    %eax,%edi
+  req->version = malloc(version_len + 1);
+  800190:	83 ec 0c             	sub    $0xc,%esp
+  800193:	8d 40 01             	lea    0x1(%eax),%eax
+  800196:	50                   	push   %eax
+  800197:	e8 38 21 00 00       	call   8022d4 <malloc>
+  80019c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  memmove(req->version, version, version_len);
+  80019f:	83 c4 0c             	add    $0xc,%esp
+  8001a2:	57                   	push   %edi
+  8001a3:	53                   	push   %ebx
+  8001a4:	50                   	push   %eax
+  8001a5:	e8 f2 0e 00 00       	call   80109c <memmove>
+  req->version[version_len] = '\0';
+  8001aa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8001ad:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+  if ((fd = open(req->url, O_RDONLY)) < 0) {
+  8001b1:	83 c4 08             	add    $0x8,%esp
+  8001b4:	6a 00                	push   $0x0
+  8001b6:	ff 75 e0             	push   -0x20(%ebp)
+  8001b9:	e8 5d 1b 00 00       	call   801d1b <open>
+  8001be:	89 c7                	mov    %eax,%edi
+  8001c0:	83 c4 10             	add    $0x10,%esp
+  8001c3:	85 c0                	test   %eax,%eax
+  8001c5:	78 51                	js     800218 <handle_client+0x158>
+  if ((r = fstat(fd, &stat)) < 0)
+  8001c7:	83 ec 08             	sub    $0x8,%esp
+  8001ca:	8d 85 c4 fc ff ff    	lea    -0x33c(%ebp),%eax
+  8001d0:	50                   	push   %eax
+  8001d1:	57                   	push   %edi
+  8001d2:	e8 d9 18 00 00       	call   801ab0 <fstat>
+  8001d7:	83 c4 10             	add    $0x10,%esp
+  8001da:	85 c0                	test   %eax,%eax
+  8001dc:	78 47                	js     800225 <handle_client+0x165>
+  if (stat.st_isdir) {
+  8001de:	83 bd 48 fd ff ff 00 	cmpl   $0x0,-0x2b8(%ebp)
+  8001e5:	75 70                	jne    800257 <handle_client+0x197>
+  file_size = stat.st_size;
+  8001e7:	8b 85 44 fd ff ff    	mov    -0x2bc(%ebp),%eax
+  8001ed:	89 85 b0 fc ff ff    	mov    %eax,-0x350(%ebp)
+  struct responce_header *h = headers;
+  8001f3:	bb 10 40 80 00       	mov    $0x804010,%ebx
+  while (h->code != 0 && h->header != 0) {
+  8001f8:	8b 03                	mov    (%ebx),%eax
+  8001fa:	85 c0                	test   %eax,%eax
+  8001fc:	74 27                	je     800225 <handle_client+0x165>
+    if (h->code == code)
+  8001fe:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  800202:	0f 84 cf 00 00 00    	je     8002d7 <handle_client+0x217>
+  800208:	3d c8 00 00 00       	cmp    $0xc8,%eax
+  80020d:	0f 84 c4 00 00 00    	je     8002d7 <handle_client+0x217>
+    h++;
+  800213:	83 c3 08             	add    $0x8,%ebx
+  800216:	eb e0                	jmp    8001f8 <handle_client+0x138>
+    send_error(req, 404);
+  800218:	ba 94 01 00 00       	mov    $0x194,%edx
+  80021d:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  800220:	e8 29 fe ff ff       	call   80004e <send_error>
+  close(fd);
+  800225:	83 ec 0c             	sub    $0xc,%esp
+  800228:	57                   	push   %edi
+  800229:	e8 4e 15 00 00       	call   80177c <close>
+  return r;
+  80022e:	83 c4 10             	add    $0x10,%esp
+  free(req->url);
+  800231:	83 ec 0c             	sub    $0xc,%esp
+  800234:	ff 75 e0             	push   -0x20(%ebp)
+  800237:	e8 ec 1f 00 00       	call   802228 <free>
+  free(req->version);
+  80023c:	83 c4 04             	add    $0x4,%esp
+  80023f:	ff 75 e4             	push   -0x1c(%ebp)
+  800242:	e8 e1 1f 00 00       	call   802228 <free>
+
+    // no keep alive
+    break;
+  }
+
+  close(sock);
+  800247:	89 34 24             	mov    %esi,(%esp)
+  80024a:	e8 2d 15 00 00       	call   80177c <close>
+}
+  80024f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800252:	5b                   	pop    %ebx
+  800253:	5e                   	pop    %esi
+  800254:	5f                   	pop    %edi
+  800255:	5d                   	pop    %ebp
+  800256:	c3                   	ret
+    send_error(req, 404);
+  800257:	ba 94 01 00 00       	mov    $0x194,%edx
+  80025c:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  80025f:	e8 ea fd ff ff       	call   80004e <send_error>
+    goto end;
+  800264:	eb bf                	jmp    800225 <handle_client+0x165>
+    die("Failed to send bytes to client");
+  800266:	b8 ac 30 80 00       	mov    $0x8030ac,%eax
+  80026b:	e8 c3 fd ff ff       	call   800033 <die>
+  800270:	e9 91 00 00 00       	jmp    800306 <handle_client+0x246>
+    panic("buffer too small!");
+  800275:	83 ec 04             	sub    $0x4,%esp
+  800278:	68 85 2f 80 00       	push   $0x802f85
+  80027d:	6a 61                	push   $0x61
+  80027f:	68 73 2f 80 00       	push   $0x802f73
+  800284:	e8 f9 05 00 00       	call   800882 <_panic>
+    panic("buffer too small!");
+  800289:	83 ec 04             	sub    $0x4,%esp
+  80028c:	68 85 2f 80 00       	push   $0x802f85
+  800291:	6a 7b                	push   $0x7b
+  800293:	68 73 2f 80 00       	push   $0x802f73
+  800298:	e8 e5 05 00 00       	call   800882 <_panic>
+    panic("send_data: readn failed");
+  80029d:	83 ec 04             	sub    $0x4,%esp
+  8002a0:	68 b4 2f 80 00       	push   $0x802fb4
+  8002a5:	6a 53                	push   $0x53
+  8002a7:	68 73 2f 80 00       	push   $0x802f73
+  8002ac:	e8 d1 05 00 00       	call   800882 <_panic>
+    panic("send_data: write failed");
+  8002b1:	83 ec 04             	sub    $0x4,%esp
+  8002b4:	68 cc 2f 80 00       	push   $0x802fcc
+  8002b9:	6a 55                	push   $0x55
+  8002bb:	68 73 2f 80 00       	push   $0x802f73
+  8002c0:	e8 bd 05 00 00       	call   800882 <_panic>
+      send_error(req, 400);
+  8002c5:	ba 90 01 00 00       	mov    $0x190,%edx
+  8002ca:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  8002cd:	e8 7c fd ff ff       	call   80004e <send_error>
+  8002d2:	e9 5a ff ff ff       	jmp    800231 <handle_client+0x171>
+  int len = strlen(h->header);
+  8002d7:	83 ec 0c             	sub    $0xc,%esp
+  8002da:	ff 73 04             	push   0x4(%ebx)
+  8002dd:	e8 f9 0b 00 00       	call   800edb <strlen>
+  if (write(req->sock, h->header, len) != len) {
+  8002e2:	83 c4 0c             	add    $0xc,%esp
+  8002e5:	89 85 b4 fc ff ff    	mov    %eax,-0x34c(%ebp)
+  8002eb:	50                   	push   %eax
+  8002ec:	ff 73 04             	push   0x4(%ebx)
+  8002ef:	ff 75 dc             	push   -0x24(%ebp)
+  8002f2:	e8 8f 16 00 00       	call   801986 <write>
+  8002f7:	83 c4 10             	add    $0x10,%esp
+  8002fa:	39 85 b4 fc ff ff    	cmp    %eax,-0x34c(%ebp)
+  800300:	0f 85 60 ff ff ff    	jne    800266 <handle_client+0x1a6>
+  r = snprintf(buf, 64, "Content-Length: %ld\r\n", (long) size);
+  800306:	ff b5 b0 fc ff ff    	push   -0x350(%ebp)
+  80030c:	68 e4 2f 80 00       	push   $0x802fe4
+  800311:	6a 40                	push   $0x40
+  800313:	8d 85 50 fd ff ff    	lea    -0x2b0(%ebp),%eax
+  800319:	50                   	push   %eax
+  80031a:	e8 a2 0b 00 00       	call   800ec1 <snprintf>
+  80031f:	89 c3                	mov    %eax,%ebx
+  if (r > 63)
+  800321:	83 c4 10             	add    $0x10,%esp
+  800324:	83 f8 3f             	cmp    $0x3f,%eax
+  800327:	0f 8f 48 ff ff ff    	jg     800275 <handle_client+0x1b5>
+  if (write(req->sock, buf, r) != r)
+  80032d:	83 ec 04             	sub    $0x4,%esp
+  800330:	53                   	push   %ebx
+  800331:	8d 85 50 fd ff ff    	lea    -0x2b0(%ebp),%eax
+  800337:	50                   	push   %eax
+  800338:	ff 75 dc             	push   -0x24(%ebp)
+  80033b:	e8 46 16 00 00       	call   801986 <write>
+  if ((r = send_size(req, file_size)) < 0)
+  800340:	83 c4 10             	add    $0x10,%esp
+  800343:	39 c3                	cmp    %eax,%ebx
+  800345:	0f 85 da fe ff ff    	jne    800225 <handle_client+0x165>
+  r = snprintf(buf, 128, "Content-Type: %s\r\n", type);
+  80034b:	68 97 2f 80 00       	push   $0x802f97
+  800350:	68 a1 2f 80 00       	push   $0x802fa1
+  800355:	68 80 00 00 00       	push   $0x80
+  80035a:	8d 85 50 fd ff ff    	lea    -0x2b0(%ebp),%eax
+  800360:	50                   	push   %eax
+  800361:	e8 5b 0b 00 00       	call   800ec1 <snprintf>
+  800366:	89 c3                	mov    %eax,%ebx
+  if (r > 127)
+  800368:	83 c4 10             	add    $0x10,%esp
+  80036b:	83 f8 7f             	cmp    $0x7f,%eax
+  80036e:	0f 8f 15 ff ff ff    	jg     800289 <handle_client+0x1c9>
+  if (write(req->sock, buf, r) != r)
+  800374:	83 ec 04             	sub    $0x4,%esp
+  800377:	50                   	push   %eax
+  800378:	8d 85 50 fd ff ff    	lea    -0x2b0(%ebp),%eax
+  80037e:	50                   	push   %eax
+  80037f:	ff 75 dc             	push   -0x24(%ebp)
+  800382:	e8 ff 15 00 00       	call   801986 <write>
+  if ((r = send_content_type(req)) < 0)
+  800387:	83 c4 10             	add    $0x10,%esp
+  80038a:	39 c3                	cmp    %eax,%ebx
+  80038c:	0f 85 93 fe ff ff    	jne    800225 <handle_client+0x165>
+  int fin_len = strlen(fin);
+  800392:	83 ec 0c             	sub    $0xc,%esp
+  800395:	68 f7 2f 80 00       	push   $0x802ff7
+  80039a:	e8 3c 0b 00 00       	call   800edb <strlen>
+  80039f:	89 c3                	mov    %eax,%ebx
+  if (write(req->sock, fin, fin_len) != fin_len)
+  8003a1:	83 c4 0c             	add    $0xc,%esp
+  8003a4:	50                   	push   %eax
+  8003a5:	68 f7 2f 80 00       	push   $0x802ff7
+  8003aa:	ff 75 dc             	push   -0x24(%ebp)
+  8003ad:	e8 d4 15 00 00       	call   801986 <write>
+  if ((r = send_header_fin(req)) < 0)
+  8003b2:	83 c4 10             	add    $0x10,%esp
+  8003b5:	39 c3                	cmp    %eax,%ebx
+  8003b7:	0f 85 68 fe ff ff    	jne    800225 <handle_client+0x165>
+  if ((r = fstat(fd, &st)) < 0)
+  8003bd:	83 ec 08             	sub    $0x8,%esp
+  8003c0:	8d 85 50 fd ff ff    	lea    -0x2b0(%ebp),%eax
+  8003c6:	50                   	push   %eax
+  8003c7:	57                   	push   %edi
+  8003c8:	e8 e3 16 00 00       	call   801ab0 <fstat>
+  8003cd:	83 c4 10             	add    $0x10,%esp
+  8003d0:	85 c0                	test   %eax,%eax
+  8003d2:	0f 88 4d fe ff ff    	js     800225 <handle_client+0x165>
+  size_t n = st.st_size;
+  8003d8:	8b 9d d0 fd ff ff    	mov    -0x230(%ebp),%ebx
+  void *buf = malloc(n);
+  8003de:	83 ec 0c             	sub    $0xc,%esp
+  8003e1:	53                   	push   %ebx
+  8003e2:	e8 ed 1e 00 00       	call   8022d4 <malloc>
+  8003e7:	89 85 b4 fc ff ff    	mov    %eax,-0x34c(%ebp)
+  if (readn(fd, buf, n) != n)
+  8003ed:	83 c4 0c             	add    $0xc,%esp
+  8003f0:	53                   	push   %ebx
+  8003f1:	50                   	push   %eax
+  8003f2:	57                   	push   %edi
+  8003f3:	e8 47 15 00 00       	call   80193f <readn>
+  8003f8:	83 c4 10             	add    $0x10,%esp
+  8003fb:	39 c3                	cmp    %eax,%ebx
+  8003fd:	0f 85 9a fe ff ff    	jne    80029d <handle_client+0x1dd>
+  if (write(req->sock, buf, n) != n)
+  800403:	83 ec 04             	sub    $0x4,%esp
+  800406:	53                   	push   %ebx
+  800407:	ff b5 b4 fc ff ff    	push   -0x34c(%ebp)
+  80040d:	ff 75 dc             	push   -0x24(%ebp)
+  800410:	e8 71 15 00 00       	call   801986 <write>
+  800415:	83 c4 10             	add    $0x10,%esp
+  800418:	39 c3                	cmp    %eax,%ebx
+  80041a:	0f 85 91 fe ff ff    	jne    8002b1 <handle_client+0x1f1>
+  free(buf);
+  800420:	83 ec 0c             	sub    $0xc,%esp
+  800423:	ff b5 b4 fc ff ff    	push   -0x34c(%ebp)
+  800429:	e8 fa 1d 00 00       	call   802228 <free>
+  return 0;
+  80042e:	83 c4 10             	add    $0x10,%esp
+  800431:	e9 ef fd ff ff       	jmp    800225 <handle_client+0x165>
+
+00800436 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800436:	55                   	push   %ebp
+  800437:	89 e5                	mov    %esp,%ebp
+  800439:	57                   	push   %edi
+  80043a:	56                   	push   %esi
+  80043b:	53                   	push   %ebx
+  80043c:	83 ec 40             	sub    $0x40,%esp
+  int serversock, clientsock;
+  struct sockaddr_in server, client;
+
+  binaryname = "jhttpd";
+  80043f:	c7 05 20 40 80 00 fa 	movl   $0x802ffa,0x804020
+  800446:	2f 80 00 
+
+  // Create the TCP socket
+  if ((serversock = socket(PF_INET, SOCK_STREAM, IPPROTO_TCP)) < 0)
+  800449:	6a 06                	push   $0x6
+  80044b:	6a 01                	push   $0x1
+  80044d:	6a 02                	push   $0x2
+  80044f:	e8 55 1b 00 00       	call   801fa9 <socket>
+  800454:	89 c6                	mov    %eax,%esi
+  800456:	83 c4 10             	add    $0x10,%esp
+  800459:	85 c0                	test   %eax,%eax
+  80045b:	78 6d                	js     8004ca <umain+0x94>
+    die("Failed to create socket");
+
+  // Construct the server sockaddr_in structure
+  memset(&server, 0, sizeof(server));    // Clear struct
+  80045d:	83 ec 04             	sub    $0x4,%esp
+  800460:	6a 10                	push   $0x10
+  800462:	6a 00                	push   $0x0
+  800464:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+  800467:	53                   	push   %ebx
+  800468:	e8 fa 0b 00 00       	call   801067 <memset>
+  server.sin_family = AF_INET;      // Internet/IP
+  80046d:	c6 45 d9 02          	movb   $0x2,-0x27(%ebp)
+  server.sin_addr.s_addr = htonl(INADDR_ANY);  // IP address
+  800471:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800478:	e8 64 01 00 00       	call   8005e1 <htonl>
+  80047d:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  server.sin_port = htons(PORT);      // server port
+  800480:	c7 04 24 50 00 00 00 	movl   $0x50,(%esp)
+  800487:	e8 3b 01 00 00       	call   8005c7 <htons>
+  80048c:	66 89 45 da          	mov    %ax,-0x26(%ebp)
+
+  // Bind the server socket
+  if (bind(serversock, (struct sockaddr *) &server,
+  800490:	83 c4 0c             	add    $0xc,%esp
+  800493:	6a 10                	push   $0x10
+  800495:	53                   	push   %ebx
+  800496:	56                   	push   %esi
+  800497:	e8 7b 1a 00 00       	call   801f17 <bind>
+  80049c:	83 c4 10             	add    $0x10,%esp
+  80049f:	85 c0                	test   %eax,%eax
+  8004a1:	78 33                	js     8004d6 <umain+0xa0>
+           sizeof(server)) < 0) {
+    die("Failed to bind the server socket");
+  }
+
+  // Listen on the server socket
+  if (listen(serversock, MAXPENDING) < 0)
+  8004a3:	83 ec 08             	sub    $0x8,%esp
+  8004a6:	6a 05                	push   $0x5
+  8004a8:	56                   	push   %esi
+  8004a9:	e8 d8 1a 00 00       	call   801f86 <listen>
+  8004ae:	83 c4 10             	add    $0x10,%esp
+  8004b1:	85 c0                	test   %eax,%eax
+  8004b3:	78 2d                	js     8004e2 <umain+0xac>
+    die("Failed to listen on server socket");
+
+  cprintf("Waiting for http connections...\n");
+  8004b5:	83 ec 0c             	sub    $0xc,%esp
+  8004b8:	68 14 31 80 00       	push   $0x803114
+  8004bd:	e8 9b 04 00 00       	call   80095d <cprintf>
+  8004c2:	83 c4 10             	add    $0x10,%esp
+
+  while (1) {
+    unsigned int clientlen = sizeof(client);
+    // Wait for client connection
+    if ((clientsock = accept(serversock,
+  8004c5:	8d 7d c4             	lea    -0x3c(%ebp),%edi
+  8004c8:	eb 35                	jmp    8004ff <umain+0xc9>
+    die("Failed to create socket");
+  8004ca:	b8 01 30 80 00       	mov    $0x803001,%eax
+  8004cf:	e8 5f fb ff ff       	call   800033 <die>
+  8004d4:	eb 87                	jmp    80045d <umain+0x27>
+    die("Failed to bind the server socket");
+  8004d6:	b8 cc 30 80 00       	mov    $0x8030cc,%eax
+  8004db:	e8 53 fb ff ff       	call   800033 <die>
+  8004e0:	eb c1                	jmp    8004a3 <umain+0x6d>
+    die("Failed to listen on server socket");
+  8004e2:	b8 f0 30 80 00       	mov    $0x8030f0,%eax
+  8004e7:	e8 47 fb ff ff       	call   800033 <die>
+  8004ec:	eb c7                	jmp    8004b5 <umain+0x7f>
+                             (struct sockaddr *) &client,
+                             &clientlen)) < 0) {
+      die("Failed to accept client connection");
+  8004ee:	b8 38 31 80 00       	mov    $0x803138,%eax
+  8004f3:	e8 3b fb ff ff       	call   800033 <die>
+    }
+    handle_client(clientsock);
+  8004f8:	89 d8                	mov    %ebx,%eax
+  8004fa:	e8 c1 fb ff ff       	call   8000c0 <handle_client>
+    unsigned int clientlen = sizeof(client);
+  8004ff:	c7 45 c4 10 00 00 00 	movl   $0x10,-0x3c(%ebp)
+    if ((clientsock = accept(serversock,
+  800506:	83 ec 04             	sub    $0x4,%esp
+  800509:	57                   	push   %edi
+  80050a:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  80050d:	50                   	push   %eax
+  80050e:	56                   	push   %esi
+  80050f:	e8 d4 19 00 00       	call   801ee8 <accept>
+  800514:	89 c3                	mov    %eax,%ebx
+  800516:	83 c4 10             	add    $0x10,%esp
+  800519:	85 c0                	test   %eax,%eax
+  80051b:	78 d1                	js     8004ee <umain+0xb8>
+  80051d:	eb d9                	jmp    8004f8 <umain+0xc2>
+
+0080051f <inet_ntoa>:
+ * @return pointer to a global static (!) buffer that holds the ASCII
+ *         represenation of addr
+ */
+char *
+inet_ntoa(struct in_addr addr)
+{
+  80051f:	55                   	push   %ebp
+  800520:	89 e5                	mov    %esp,%ebp
+  800522:	57                   	push   %edi
+  800523:	56                   	push   %esi
+  800524:	53                   	push   %ebx
+  800525:	83 ec 1c             	sub    $0x1c,%esp
+  static char str[16];
+  u32_t s_addr = addr.s_addr;
+  800528:	8b 45 08             	mov    0x8(%ebp),%eax
+  80052b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  u8_t rem;
+  u8_t n;
+  u8_t i;
+
+  rp = str;
+  ap = (u8_t *)&s_addr;
+  80052e:	8d 7d f0             	lea    -0x10(%ebp),%edi
+  rp = str;
+  800531:	b9 00 50 80 00       	mov    $0x805000,%ecx
+  for(n = 0; n < 4; n++) {
+    i = 0;
+    do {
+      rem = *ap % (u8_t)10;
+  800536:	be cd ff ff ff       	mov    $0xffffffcd,%esi
+  80053b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80053e:	eb 31                	jmp    800571 <inet_ntoa+0x52>
+      *ap /= (u8_t)10;
+      inv[i++] = '0' + rem;
+    } while(*ap);
+    while(i--)
+      *rp++ = inv[i];
+  800540:	0f b6 c8             	movzbl %al,%ecx
+  800543:	0f b6 4c 0d ed       	movzbl -0x13(%ebp,%ecx,1),%ecx
+  800548:	88 0a                	mov    %cl,(%edx)
+  80054a:	83 c2 01             	add    $0x1,%edx
+    while(i--)
+  80054d:	83 e8 01             	sub    $0x1,%eax
+  800550:	3c ff                	cmp    $0xff,%al
+  800552:	75 ec                	jne    800540 <inet_ntoa+0x21>
+  800554:	0f b6 db             	movzbl %bl,%ebx
+  800557:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80055a:	01 d8                	add    %ebx,%eax
+  80055c:	89 c3                	mov    %eax,%ebx
+    *rp++ = '.';
+  80055e:	8d 40 01             	lea    0x1(%eax),%eax
+  800561:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800564:	c6 03 2e             	movb   $0x2e,(%ebx)
+    ap++;
+  800567:	83 c7 01             	add    $0x1,%edi
+  for(n = 0; n < 4; n++) {
+  80056a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80056d:	39 c7                	cmp    %eax,%edi
+  80056f:	74 46                	je     8005b7 <inet_ntoa+0x98>
+  800571:	0f b6 17             	movzbl (%edi),%edx
+    i = 0;
+  800574:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800579:	89 7d d8             	mov    %edi,-0x28(%ebp)
+      rem = *ap % (u8_t)10;
+  80057c:	89 f0                	mov    %esi,%eax
+  80057e:	f6 e2                	mul    %dl
+  800580:	66 c1 e8 0b          	shr    $0xb,%ax
+  800584:	88 45 e3             	mov    %al,-0x1d(%ebp)
+  800587:	8d 0c 80             	lea    (%eax,%eax,4),%ecx
+  80058a:	01 c9                	add    %ecx,%ecx
+  80058c:	89 d0                	mov    %edx,%eax
+  80058e:	29 c8                	sub    %ecx,%eax
+      *ap /= (u8_t)10;
+  800590:	89 d7                	mov    %edx,%edi
+  800592:	0f b6 55 e3          	movzbl -0x1d(%ebp),%edx
+      inv[i++] = '0' + rem;
+  800596:	89 d9                	mov    %ebx,%ecx
+  800598:	83 c3 01             	add    $0x1,%ebx
+  80059b:	0f b6 c9             	movzbl %cl,%ecx
+  80059e:	83 c0 30             	add    $0x30,%eax
+  8005a1:	88 44 0d ed          	mov    %al,-0x13(%ebp,%ecx,1)
+    } while(*ap);
+  8005a5:	89 f8                	mov    %edi,%eax
+  8005a7:	3c 09                	cmp    $0x9,%al
+  8005a9:	77 d1                	ja     80057c <inet_ntoa+0x5d>
+  8005ab:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  8005ae:	88 17                	mov    %dl,(%edi)
+  8005b0:	8b 55 dc             	mov    -0x24(%ebp),%edx
+      inv[i++] = '0' + rem;
+  8005b3:	89 d8                	mov    %ebx,%eax
+  8005b5:	eb 96                	jmp    80054d <inet_ntoa+0x2e>
+  }
+  *--rp = 0;
+  8005b7:	c6 03 00             	movb   $0x0,(%ebx)
+  return str;
+}
+  8005ba:	b8 00 50 80 00       	mov    $0x805000,%eax
+  8005bf:	83 c4 1c             	add    $0x1c,%esp
+  8005c2:	5b                   	pop    %ebx
+  8005c3:	5e                   	pop    %esi
+  8005c4:	5f                   	pop    %edi
+  8005c5:	5d                   	pop    %ebp
+  8005c6:	c3                   	ret
+
+008005c7 <htons>:
+ * @param n u16_t in host byte order
+ * @return n in network byte order
+ */
+u16_t
+htons(u16_t n)
+{
+  8005c7:	55                   	push   %ebp
+  8005c8:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  8005ca:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  8005ce:	66 c1 c0 08          	rol    $0x8,%ax
+}
+  8005d2:	5d                   	pop    %ebp
+  8005d3:	c3                   	ret
+
+008005d4 <ntohs>:
+ * @param n u16_t in network byte order
+ * @return n in host byte order
+ */
+u16_t
+ntohs(u16_t n)
+{
+  8005d4:	55                   	push   %ebp
+  8005d5:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  8005d7:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  8005db:	66 c1 c0 08          	rol    $0x8,%ax
+  return htons(n);
+}
+  8005df:	5d                   	pop    %ebp
+  8005e0:	c3                   	ret
+
+008005e1 <htonl>:
+ * @param n u32_t in host byte order
+ * @return n in network byte order
+ */
+u32_t
+htonl(u32_t n)
+{
+  8005e1:	55                   	push   %ebp
+  8005e2:	89 e5                	mov    %esp,%ebp
+  8005e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  return ((n & 0xff) << 24) |
+  8005e7:	89 d0                	mov    %edx,%eax
+  8005e9:	c1 e0 18             	shl    $0x18,%eax
+    ((n & 0xff00) << 8) |
+    ((n & 0xff0000UL) >> 8) |
+    ((n & 0xff000000UL) >> 24);
+  8005ec:	89 d1                	mov    %edx,%ecx
+  8005ee:	c1 e9 18             	shr    $0x18,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  8005f1:	09 c8                	or     %ecx,%eax
+    ((n & 0xff00) << 8) |
+  8005f3:	89 d1                	mov    %edx,%ecx
+  8005f5:	c1 e1 08             	shl    $0x8,%ecx
+  8005f8:	81 e1 00 00 ff 00    	and    $0xff0000,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  8005fe:	09 c8                	or     %ecx,%eax
+  800600:	c1 ea 08             	shr    $0x8,%edx
+  800603:	81 e2 00 ff 00 00    	and    $0xff00,%edx
+  800609:	09 d0                	or     %edx,%eax
+}
+  80060b:	5d                   	pop    %ebp
+  80060c:	c3                   	ret
+
+0080060d <inet_aton>:
+{
+  80060d:	55                   	push   %ebp
+  80060e:	89 e5                	mov    %esp,%ebp
+  800610:	57                   	push   %edi
+  800611:	56                   	push   %esi
+  800612:	53                   	push   %ebx
+  800613:	83 ec 2c             	sub    $0x2c,%esp
+  800616:	8b 55 08             	mov    0x8(%ebp),%edx
+  c = *cp;
+  800619:	0f be 02             	movsbl (%edx),%eax
+  u32_t *pp = parts;
+  80061c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+      if (pp >= parts + 3)
+  80061f:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  800622:	e9 9b 00 00 00       	jmp    8006c2 <inet_aton+0xb5>
+      c = *++cp;
+  800627:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+      if (c == 'x' || c == 'X') {
+  80062b:	89 c1                	mov    %eax,%ecx
+  80062d:	83 e1 df             	and    $0xffffffdf,%ecx
+  800630:	80 f9 58             	cmp    $0x58,%cl
+  800633:	74 10                	je     800645 <inet_aton+0x38>
+      c = *++cp;
+  800635:	83 c2 01             	add    $0x1,%edx
+  800638:	0f be c0             	movsbl %al,%eax
+        base = 8;
+  80063b:	bf 08 00 00 00       	mov    $0x8,%edi
+  800640:	e9 97 00 00 00       	jmp    8006dc <inet_aton+0xcf>
+        c = *++cp;
+  800645:	0f be 42 02          	movsbl 0x2(%edx),%eax
+  800649:	8d 52 02             	lea    0x2(%edx),%edx
+        base = 16;
+  80064c:	bf 10 00 00 00       	mov    $0x10,%edi
+  800651:	e9 86 00 00 00       	jmp    8006dc <inet_aton+0xcf>
+        val = (val * base) + (int)(c - '0');
+  800656:	0f af d7             	imul   %edi,%edx
+  800659:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+        c = *++cp;
+  80065d:	0f be 01             	movsbl (%ecx),%eax
+  800660:	83 c1 01             	add    $0x1,%ecx
+      if (isdigit(c)) {
+  800663:	88 45 d7             	mov    %al,-0x29(%ebp)
+  800666:	8d 58 d0             	lea    -0x30(%eax),%ebx
+  800669:	80 fb 09             	cmp    $0x9,%bl
+  80066c:	76 e8                	jbe    800656 <inet_aton+0x49>
+      } else if (base == 16 && isxdigit(c)) {
+  80066e:	83 ff 10             	cmp    $0x10,%edi
+  800671:	75 2e                	jne    8006a1 <inet_aton+0x94>
+  800673:	0f b6 5d d7          	movzbl -0x29(%ebp),%ebx
+  800677:	8d 73 9f             	lea    -0x61(%ebx),%esi
+  80067a:	83 e3 df             	and    $0xffffffdf,%ebx
+  80067d:	83 eb 41             	sub    $0x41,%ebx
+  800680:	80 fb 05             	cmp    $0x5,%bl
+  800683:	77 1c                	ja     8006a1 <inet_aton+0x94>
+        val = (val << 4) | (int)(c + 10 - (islower(c) ? 'a' : 'A'));
+  800685:	c1 e2 04             	shl    $0x4,%edx
+  800688:	83 c0 0a             	add    $0xa,%eax
+  80068b:	89 f3                	mov    %esi,%ebx
+  80068d:	80 fb 1a             	cmp    $0x1a,%bl
+  800690:	19 db                	sbb    %ebx,%ebx
+  800692:	83 e3 20             	and    $0x20,%ebx
+  800695:	83 c3 41             	add    $0x41,%ebx
+  800698:	29 d8                	sub    %ebx,%eax
+  80069a:	09 c2                	or     %eax,%edx
+        c = *++cp;
+  80069c:	0f be 01             	movsbl (%ecx),%eax
+  80069f:	eb bf                	jmp    800660 <inet_aton+0x53>
+    if (c == '.') {
+  8006a1:	83 f8 2e             	cmp    $0x2e,%eax
+  8006a4:	75 43                	jne    8006e9 <inet_aton+0xdc>
+      if (pp >= parts + 3)
+  8006a6:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8006a9:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  8006ac:	39 f0                	cmp    %esi,%eax
+  8006ae:	0f 84 22 01 00 00    	je     8007d6 <inet_aton+0x1c9>
+      *pp++ = val;
+  8006b4:	83 c0 04             	add    $0x4,%eax
+  8006b7:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8006ba:	89 50 fc             	mov    %edx,-0x4(%eax)
+      c = *++cp;
+  8006bd:	89 ca                	mov    %ecx,%edx
+  8006bf:	0f be 01             	movsbl (%ecx),%eax
+    if (!isdigit(c))
+  8006c2:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8006c5:	80 f9 09             	cmp    $0x9,%cl
+  8006c8:	0f 87 01 01 00 00    	ja     8007cf <inet_aton+0x1c2>
+    base = 10;
+  8006ce:	bf 0a 00 00 00       	mov    $0xa,%edi
+    if (c == '0') {
+  8006d3:	83 f8 30             	cmp    $0x30,%eax
+  8006d6:	0f 84 4b ff ff ff    	je     800627 <inet_aton+0x1a>
+  8006dc:	8d 4a 01             	lea    0x1(%edx),%ecx
+        base = 8;
+  8006df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006e4:	e9 7a ff ff ff       	jmp    800663 <inet_aton+0x56>
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  8006e9:	0f b6 7d d7          	movzbl -0x29(%ebp),%edi
+  8006ed:	89 d6                	mov    %edx,%esi
+  8006ef:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8006f2:	85 c0                	test   %eax,%eax
+  8006f4:	74 2e                	je     800724 <inet_aton+0x117>
+    return (0);
+  8006f6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  8006fb:	89 fa                	mov    %edi,%edx
+  8006fd:	80 fa 1f             	cmp    $0x1f,%dl
+  800700:	0f 86 d5 00 00 00    	jbe    8007db <inet_aton+0x1ce>
+  800706:	84 c0                	test   %al,%al
+  800708:	0f 88 cd 00 00 00    	js     8007db <inet_aton+0x1ce>
+  80070e:	8d 48 f7             	lea    -0x9(%eax),%ecx
+  800711:	83 f9 04             	cmp    $0x4,%ecx
+  800714:	76 0e                	jbe    800724 <inet_aton+0x117>
+    return (0);
+  800716:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  80071b:	83 f8 20             	cmp    $0x20,%eax
+  80071e:	0f 85 b7 00 00 00    	jne    8007db <inet_aton+0x1ce>
+  n = pp - parts + 1;
+  800724:	8d 4d d8             	lea    -0x28(%ebp),%ecx
+  800727:	89 d8                	mov    %ebx,%eax
+  800729:	29 c8                	sub    %ecx,%eax
+  80072b:	c1 f8 02             	sar    $0x2,%eax
+  80072e:	8d 48 01             	lea    0x1(%eax),%ecx
+  switch (n) {
+  800731:	83 f8 02             	cmp    $0x2,%eax
+  800734:	74 7a                	je     8007b0 <inet_aton+0x1a3>
+  800736:	83 f9 03             	cmp    $0x3,%ecx
+  800739:	7f 49                	jg     800784 <inet_aton+0x177>
+  80073b:	85 c9                	test   %ecx,%ecx
+  80073d:	0f 84 98 00 00 00    	je     8007db <inet_aton+0x1ce>
+  800743:	83 f9 02             	cmp    $0x2,%ecx
+  800746:	75 19                	jne    800761 <inet_aton+0x154>
+      return (0);
+  800748:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffffffUL)
+  80074d:	81 fe ff ff ff 00    	cmp    $0xffffff,%esi
+  800753:	0f 87 82 00 00 00    	ja     8007db <inet_aton+0x1ce>
+    val |= parts[0] << 24;
+  800759:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80075c:	c1 e0 18             	shl    $0x18,%eax
+  80075f:	09 c6                	or     %eax,%esi
+  return (1);
+  800761:	b9 01 00 00 00       	mov    $0x1,%ecx
+  if (addr)
+  800766:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80076a:	74 6f                	je     8007db <inet_aton+0x1ce>
+    addr->s_addr = htonl(val);
+  80076c:	83 ec 0c             	sub    $0xc,%esp
+  80076f:	56                   	push   %esi
+  800770:	e8 6c fe ff ff       	call   8005e1 <htonl>
+  800775:	83 c4 10             	add    $0x10,%esp
+  800778:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80077b:	89 06                	mov    %eax,(%esi)
+  return (1);
+  80077d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800782:	eb 57                	jmp    8007db <inet_aton+0x1ce>
+  switch (n) {
+  800784:	83 f9 04             	cmp    $0x4,%ecx
+  800787:	75 d8                	jne    800761 <inet_aton+0x154>
+      return (0);
+  800789:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xff)
+  80078e:	81 fe ff 00 00 00    	cmp    $0xff,%esi
+  800794:	77 45                	ja     8007db <inet_aton+0x1ce>
+    val |= (parts[0] << 24) | (parts[1] << 16) | (parts[2] << 8);
+  800796:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  800799:	c1 e0 18             	shl    $0x18,%eax
+  80079c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80079f:	c1 e1 10             	shl    $0x10,%ecx
+  8007a2:	09 c8                	or     %ecx,%eax
+  8007a4:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8007a7:	c1 e1 08             	shl    $0x8,%ecx
+  8007aa:	09 c8                	or     %ecx,%eax
+  8007ac:	09 c6                	or     %eax,%esi
+    break;
+  8007ae:	eb b1                	jmp    800761 <inet_aton+0x154>
+      return (0);
+  8007b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffff)
+  8007b5:	81 fe ff ff 00 00    	cmp    $0xffff,%esi
+  8007bb:	77 1e                	ja     8007db <inet_aton+0x1ce>
+    val |= (parts[0] << 24) | (parts[1] << 16);
+  8007bd:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8007c0:	c1 e0 18             	shl    $0x18,%eax
+  8007c3:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8007c6:	c1 e1 10             	shl    $0x10,%ecx
+  8007c9:	09 c8                	or     %ecx,%eax
+  8007cb:	09 c6                	or     %eax,%esi
+    break;
+  8007cd:	eb 92                	jmp    800761 <inet_aton+0x154>
+      return (0);
+  8007cf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007d4:	eb 05                	jmp    8007db <inet_aton+0x1ce>
+        return (0);
+  8007d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+}
+  8007db:	89 c8                	mov    %ecx,%eax
+  8007dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007e0:	5b                   	pop    %ebx
+  8007e1:	5e                   	pop    %esi
+  8007e2:	5f                   	pop    %edi
+  8007e3:	5d                   	pop    %ebp
+  8007e4:	c3                   	ret
+
+008007e5 <inet_addr>:
+{
+  8007e5:	55                   	push   %ebp
+  8007e6:	89 e5                	mov    %esp,%ebp
+  8007e8:	83 ec 20             	sub    $0x20,%esp
+  if (inet_aton(cp, &val)) {
+  8007eb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8007ee:	50                   	push   %eax
+  8007ef:	ff 75 08             	push   0x8(%ebp)
+  8007f2:	e8 16 fe ff ff       	call   80060d <inet_aton>
+  8007f7:	89 c2                	mov    %eax,%edx
+  8007f9:	83 c4 10             	add    $0x10,%esp
+  return (INADDR_NONE);
+  8007fc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  if (inet_aton(cp, &val)) {
+  800801:	85 d2                	test   %edx,%edx
+  800803:	75 02                	jne    800807 <inet_addr+0x22>
+}
+  800805:	c9                   	leave
+  800806:	c3                   	ret
+    return (val.s_addr);
+  800807:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80080a:	eb f9                	jmp    800805 <inet_addr+0x20>
+
+0080080c <ntohl>:
+ * @param n u32_t in network byte order
+ * @return n in host byte order
+ */
+u32_t
+ntohl(u32_t n)
+{
+  80080c:	55                   	push   %ebp
+  80080d:	89 e5                	mov    %esp,%ebp
+  80080f:	83 ec 14             	sub    $0x14,%esp
+  return htonl(n);
+  800812:	ff 75 08             	push   0x8(%ebp)
+  800815:	e8 c7 fd ff ff       	call   8005e1 <htonl>
+  80081a:	83 c4 10             	add    $0x10,%esp
+}
+  80081d:	c9                   	leave
+  80081e:	c3                   	ret
+
+0080081f <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  80081f:	55                   	push   %ebp
+  800820:	89 e5                	mov    %esp,%ebp
+  800822:	56                   	push   %esi
+  800823:	53                   	push   %ebx
+  800824:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800827:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  80082a:	e8 95 0a 00 00       	call   8012c4 <sys_getenvid>
+  80082f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800834:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800837:	c1 e0 04             	shl    $0x4,%eax
+  80083a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80083f:	a3 1c 50 80 00       	mov    %eax,0x80501c
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800844:	85 db                	test   %ebx,%ebx
+  800846:	7e 07                	jle    80084f <libmain+0x30>
+    binaryname = argv[0];
+  800848:	8b 06                	mov    (%esi),%eax
+  80084a:	a3 20 40 80 00       	mov    %eax,0x804020
+
+  // call user main routine
+  umain(argc, argv);
+  80084f:	83 ec 08             	sub    $0x8,%esp
+  800852:	56                   	push   %esi
+  800853:	53                   	push   %ebx
+  800854:	e8 dd fb ff ff       	call   800436 <umain>
+
+  // exit gracefully
+  exit();
+  800859:	e8 0a 00 00 00       	call   800868 <exit>
+}
+  80085e:	83 c4 10             	add    $0x10,%esp
+  800861:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800864:	5b                   	pop    %ebx
+  800865:	5e                   	pop    %esi
+  800866:	5d                   	pop    %ebp
+  800867:	c3                   	ret
+
+00800868 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800868:	55                   	push   %ebp
+  800869:	89 e5                	mov    %esp,%ebp
+  80086b:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80086e:	e8 36 0f 00 00       	call   8017a9 <close_all>
+	sys_env_destroy(0);
+  800873:	83 ec 0c             	sub    $0xc,%esp
+  800876:	6a 00                	push   $0x0
+  800878:	e8 06 0a 00 00       	call   801283 <sys_env_destroy>
+}
+  80087d:	83 c4 10             	add    $0x10,%esp
+  800880:	c9                   	leave
+  800881:	c3                   	ret
+
+00800882 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800882:	55                   	push   %ebp
+  800883:	89 e5                	mov    %esp,%ebp
+  800885:	56                   	push   %esi
+  800886:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800887:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80088a:	8b 35 20 40 80 00    	mov    0x804020,%esi
+  800890:	e8 2f 0a 00 00       	call   8012c4 <sys_getenvid>
+  800895:	83 ec 0c             	sub    $0xc,%esp
+  800898:	ff 75 0c             	push   0xc(%ebp)
+  80089b:	ff 75 08             	push   0x8(%ebp)
+  80089e:	56                   	push   %esi
+  80089f:	50                   	push   %eax
+  8008a0:	68 8c 31 80 00       	push   $0x80318c
+  8008a5:	e8 b3 00 00 00       	call   80095d <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8008aa:	83 c4 18             	add    $0x18,%esp
+  8008ad:	53                   	push   %ebx
+  8008ae:	ff 75 10             	push   0x10(%ebp)
+  8008b1:	e8 56 00 00 00       	call   80090c <vcprintf>
+	cprintf("\n");
+  8008b6:	c7 04 24 f8 2f 80 00 	movl   $0x802ff8,(%esp)
+  8008bd:	e8 9b 00 00 00       	call   80095d <cprintf>
+  8008c2:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8008c5:	cc                   	int3
+	while (1)
+  8008c6:	eb fd                	jmp    8008c5 <_panic+0x43>
+
+008008c8 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8008c8:	55                   	push   %ebp
+  8008c9:	89 e5                	mov    %esp,%ebp
+  8008cb:	53                   	push   %ebx
+  8008cc:	83 ec 04             	sub    $0x4,%esp
+  8008cf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8008d2:	8b 13                	mov    (%ebx),%edx
+  8008d4:	8d 42 01             	lea    0x1(%edx),%eax
+  8008d7:	89 03                	mov    %eax,(%ebx)
+  8008d9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008dc:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8008e0:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8008e5:	74 09                	je     8008f0 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8008e7:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8008eb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008ee:	c9                   	leave
+  8008ef:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8008f0:	83 ec 08             	sub    $0x8,%esp
+  8008f3:	68 ff 00 00 00       	push   $0xff
+  8008f8:	8d 43 08             	lea    0x8(%ebx),%eax
+  8008fb:	50                   	push   %eax
+  8008fc:	e8 45 09 00 00       	call   801246 <sys_cputs>
+		b->idx = 0;
+  800901:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800907:	83 c4 10             	add    $0x10,%esp
+  80090a:	eb db                	jmp    8008e7 <putch+0x1f>
+
+0080090c <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80090c:	55                   	push   %ebp
+  80090d:	89 e5                	mov    %esp,%ebp
+  80090f:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800915:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80091c:	00 00 00 
+	b.cnt = 0;
+  80091f:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800926:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800929:	ff 75 0c             	push   0xc(%ebp)
+  80092c:	ff 75 08             	push   0x8(%ebp)
+  80092f:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800935:	50                   	push   %eax
+  800936:	68 c8 08 80 00       	push   $0x8008c8
+  80093b:	e8 14 01 00 00       	call   800a54 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800940:	83 c4 08             	add    $0x8,%esp
+  800943:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800949:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80094f:	50                   	push   %eax
+  800950:	e8 f1 08 00 00       	call   801246 <sys_cputs>
+
+	return b.cnt;
+}
+  800955:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80095b:	c9                   	leave
+  80095c:	c3                   	ret
+
+0080095d <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80095d:	55                   	push   %ebp
+  80095e:	89 e5                	mov    %esp,%ebp
+  800960:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800963:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800966:	50                   	push   %eax
+  800967:	ff 75 08             	push   0x8(%ebp)
+  80096a:	e8 9d ff ff ff       	call   80090c <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80096f:	c9                   	leave
+  800970:	c3                   	ret
+
+00800971 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800971:	55                   	push   %ebp
+  800972:	89 e5                	mov    %esp,%ebp
+  800974:	57                   	push   %edi
+  800975:	56                   	push   %esi
+  800976:	53                   	push   %ebx
+  800977:	83 ec 1c             	sub    $0x1c,%esp
+  80097a:	89 c7                	mov    %eax,%edi
+  80097c:	89 d6                	mov    %edx,%esi
+  80097e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800981:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800984:	89 d1                	mov    %edx,%ecx
+  800986:	89 c2                	mov    %eax,%edx
+  800988:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80098b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80098e:	8b 45 10             	mov    0x10(%ebp),%eax
+  800991:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800994:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800997:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80099e:	39 c2                	cmp    %eax,%edx
+  8009a0:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8009a3:	72 3e                	jb     8009e3 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8009a5:	83 ec 0c             	sub    $0xc,%esp
+  8009a8:	ff 75 18             	push   0x18(%ebp)
+  8009ab:	83 eb 01             	sub    $0x1,%ebx
+  8009ae:	53                   	push   %ebx
+  8009af:	50                   	push   %eax
+  8009b0:	83 ec 08             	sub    $0x8,%esp
+  8009b3:	ff 75 e4             	push   -0x1c(%ebp)
+  8009b6:	ff 75 e0             	push   -0x20(%ebp)
+  8009b9:	ff 75 dc             	push   -0x24(%ebp)
+  8009bc:	ff 75 d8             	push   -0x28(%ebp)
+  8009bf:	e8 fc 21 00 00       	call   802bc0 <__udivdi3>
+  8009c4:	83 c4 18             	add    $0x18,%esp
+  8009c7:	52                   	push   %edx
+  8009c8:	50                   	push   %eax
+  8009c9:	89 f2                	mov    %esi,%edx
+  8009cb:	89 f8                	mov    %edi,%eax
+  8009cd:	e8 9f ff ff ff       	call   800971 <printnum>
+  8009d2:	83 c4 20             	add    $0x20,%esp
+  8009d5:	eb 13                	jmp    8009ea <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8009d7:	83 ec 08             	sub    $0x8,%esp
+  8009da:	56                   	push   %esi
+  8009db:	ff 75 18             	push   0x18(%ebp)
+  8009de:	ff d7                	call   *%edi
+  8009e0:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8009e3:	83 eb 01             	sub    $0x1,%ebx
+  8009e6:	85 db                	test   %ebx,%ebx
+  8009e8:	7f ed                	jg     8009d7 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8009ea:	83 ec 08             	sub    $0x8,%esp
+  8009ed:	56                   	push   %esi
+  8009ee:	83 ec 04             	sub    $0x4,%esp
+  8009f1:	ff 75 e4             	push   -0x1c(%ebp)
+  8009f4:	ff 75 e0             	push   -0x20(%ebp)
+  8009f7:	ff 75 dc             	push   -0x24(%ebp)
+  8009fa:	ff 75 d8             	push   -0x28(%ebp)
+  8009fd:	e8 8e 22 00 00       	call   802c90 <__umoddi3>
+  800a02:	83 c4 14             	add    $0x14,%esp
+  800a05:	0f be 80 af 31 80 00 	movsbl 0x8031af(%eax),%eax
+  800a0c:	50                   	push   %eax
+  800a0d:	ff d7                	call   *%edi
+}
+  800a0f:	83 c4 10             	add    $0x10,%esp
+  800a12:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a15:	5b                   	pop    %ebx
+  800a16:	5e                   	pop    %esi
+  800a17:	5f                   	pop    %edi
+  800a18:	5d                   	pop    %ebp
+  800a19:	c3                   	ret
+
+00800a1a <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800a1a:	55                   	push   %ebp
+  800a1b:	89 e5                	mov    %esp,%ebp
+  800a1d:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800a20:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800a24:	8b 10                	mov    (%eax),%edx
+  800a26:	3b 50 04             	cmp    0x4(%eax),%edx
+  800a29:	73 0a                	jae    800a35 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800a2b:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800a2e:	89 08                	mov    %ecx,(%eax)
+  800a30:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a33:	88 02                	mov    %al,(%edx)
+}
+  800a35:	5d                   	pop    %ebp
+  800a36:	c3                   	ret
+
+00800a37 <printfmt>:
+{
+  800a37:	55                   	push   %ebp
+  800a38:	89 e5                	mov    %esp,%ebp
+  800a3a:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800a3d:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800a40:	50                   	push   %eax
+  800a41:	ff 75 10             	push   0x10(%ebp)
+  800a44:	ff 75 0c             	push   0xc(%ebp)
+  800a47:	ff 75 08             	push   0x8(%ebp)
+  800a4a:	e8 05 00 00 00       	call   800a54 <vprintfmt>
+}
+  800a4f:	83 c4 10             	add    $0x10,%esp
+  800a52:	c9                   	leave
+  800a53:	c3                   	ret
+
+00800a54 <vprintfmt>:
+{
+  800a54:	55                   	push   %ebp
+  800a55:	89 e5                	mov    %esp,%ebp
+  800a57:	57                   	push   %edi
+  800a58:	56                   	push   %esi
+  800a59:	53                   	push   %ebx
+  800a5a:	83 ec 2c             	sub    $0x2c,%esp
+  800a5d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a60:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800a63:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800a66:	eb 0a                	jmp    800a72 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800a68:	83 ec 08             	sub    $0x8,%esp
+  800a6b:	53                   	push   %ebx
+  800a6c:	50                   	push   %eax
+  800a6d:	ff d6                	call   *%esi
+  800a6f:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800a72:	83 c7 01             	add    $0x1,%edi
+  800a75:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800a79:	83 f8 25             	cmp    $0x25,%eax
+  800a7c:	74 0c                	je     800a8a <vprintfmt+0x36>
+			if (ch == '\0')
+  800a7e:	85 c0                	test   %eax,%eax
+  800a80:	75 e6                	jne    800a68 <vprintfmt+0x14>
+}
+  800a82:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a85:	5b                   	pop    %ebx
+  800a86:	5e                   	pop    %esi
+  800a87:	5f                   	pop    %edi
+  800a88:	5d                   	pop    %ebp
+  800a89:	c3                   	ret
+		padc = ' ';
+  800a8a:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800a8e:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800a95:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800a9c:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800aa3:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800aa8:	8d 47 01             	lea    0x1(%edi),%eax
+  800aab:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800aae:	0f b6 17             	movzbl (%edi),%edx
+  800ab1:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800ab4:	3c 55                	cmp    $0x55,%al
+  800ab6:	0f 87 9a 03 00 00    	ja     800e56 <vprintfmt+0x402>
+  800abc:	0f b6 c0             	movzbl %al,%eax
+  800abf:	ff 24 85 00 33 80 00 	jmp    *0x803300(,%eax,4)
+  800ac6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800ac9:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800acd:	eb d9                	jmp    800aa8 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800acf:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800ad2:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800ad6:	eb d0                	jmp    800aa8 <vprintfmt+0x54>
+  800ad8:	0f b6 d2             	movzbl %dl,%edx
+  800adb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800ade:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ae3:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800ae6:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800ae9:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800aed:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800af0:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800af3:	83 f9 09             	cmp    $0x9,%ecx
+  800af6:	77 55                	ja     800b4d <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800af8:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800afb:	eb e9                	jmp    800ae6 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800afd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b00:	8b 00                	mov    (%eax),%eax
+  800b02:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800b05:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b08:	8d 40 04             	lea    0x4(%eax),%eax
+  800b0b:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800b0e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800b11:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800b15:	79 91                	jns    800aa8 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800b17:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800b1a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800b1d:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800b24:	eb 82                	jmp    800aa8 <vprintfmt+0x54>
+			if (width < 0)
+  800b26:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800b29:	85 d2                	test   %edx,%edx
+  800b2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b30:	0f 49 c2             	cmovns %edx,%eax
+  800b33:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800b36:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800b39:	e9 6a ff ff ff       	jmp    800aa8 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800b3e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800b41:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800b48:	e9 5b ff ff ff       	jmp    800aa8 <vprintfmt+0x54>
+  800b4d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800b50:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800b53:	eb bc                	jmp    800b11 <vprintfmt+0xbd>
+			lflag++;
+  800b55:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800b58:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800b5b:	e9 48 ff ff ff       	jmp    800aa8 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800b60:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b63:	8d 78 04             	lea    0x4(%eax),%edi
+  800b66:	83 ec 08             	sub    $0x8,%esp
+  800b69:	53                   	push   %ebx
+  800b6a:	ff 30                	push   (%eax)
+  800b6c:	ff d6                	call   *%esi
+			break;
+  800b6e:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800b71:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800b74:	e9 7c 02 00 00       	jmp    800df5 <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  800b79:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b7c:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800b7f:	8b 10                	mov    (%eax),%edx
+  800b81:	89 d0                	mov    %edx,%eax
+  800b83:	f7 d8                	neg    %eax
+  800b85:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800b88:	83 f8 10             	cmp    $0x10,%eax
+  800b8b:	7f 23                	jg     800bb0 <vprintfmt+0x15c>
+  800b8d:	8b 14 85 60 34 80 00 	mov    0x803460(,%eax,4),%edx
+  800b94:	85 d2                	test   %edx,%edx
+  800b96:	74 18                	je     800bb0 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800b98:	52                   	push   %edx
+  800b99:	68 99 35 80 00       	push   $0x803599
+  800b9e:	53                   	push   %ebx
+  800b9f:	56                   	push   %esi
+  800ba0:	e8 92 fe ff ff       	call   800a37 <printfmt>
+  800ba5:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800ba8:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800bab:	e9 45 02 00 00       	jmp    800df5 <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  800bb0:	50                   	push   %eax
+  800bb1:	68 c7 31 80 00       	push   $0x8031c7
+  800bb6:	53                   	push   %ebx
+  800bb7:	56                   	push   %esi
+  800bb8:	e8 7a fe ff ff       	call   800a37 <printfmt>
+  800bbd:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800bc0:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800bc3:	e9 2d 02 00 00       	jmp    800df5 <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800bc8:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bcb:	83 c0 04             	add    $0x4,%eax
+  800bce:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800bd1:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bd4:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800bd6:	85 c9                	test   %ecx,%ecx
+  800bd8:	b8 c0 31 80 00       	mov    $0x8031c0,%eax
+  800bdd:	0f 45 c1             	cmovne %ecx,%eax
+  800be0:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800be3:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800be7:	7e 06                	jle    800bef <vprintfmt+0x19b>
+  800be9:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800bed:	75 0b                	jne    800bfa <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800bef:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800bf2:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800bf5:	89 75 08             	mov    %esi,0x8(%ebp)
+  800bf8:	eb 5c                	jmp    800c56 <vprintfmt+0x202>
+  800bfa:	83 ec 08             	sub    $0x8,%esp
+  800bfd:	ff 75 d0             	push   -0x30(%ebp)
+  800c00:	ff 75 cc             	push   -0x34(%ebp)
+  800c03:	e8 eb 02 00 00       	call   800ef3 <strnlen>
+  800c08:	89 c2                	mov    %eax,%edx
+  800c0a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800c0d:	29 d0                	sub    %edx,%eax
+  800c0f:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800c12:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800c16:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800c19:	89 75 08             	mov    %esi,0x8(%ebp)
+  800c1c:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800c1e:	eb 0e                	jmp    800c2e <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800c20:	83 ec 08             	sub    $0x8,%esp
+  800c23:	53                   	push   %ebx
+  800c24:	57                   	push   %edi
+  800c25:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800c28:	83 ee 01             	sub    $0x1,%esi
+  800c2b:	83 c4 10             	add    $0x10,%esp
+  800c2e:	85 f6                	test   %esi,%esi
+  800c30:	7f ee                	jg     800c20 <vprintfmt+0x1cc>
+  800c32:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800c35:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c38:	85 c0                	test   %eax,%eax
+  800c3a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c3f:	0f 49 d0             	cmovns %eax,%edx
+  800c42:	29 d0                	sub    %edx,%eax
+  800c44:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800c47:	eb a6                	jmp    800bef <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800c49:	83 ec 08             	sub    $0x8,%esp
+  800c4c:	53                   	push   %ebx
+  800c4d:	52                   	push   %edx
+  800c4e:	ff 55 08             	call   *0x8(%ebp)
+  800c51:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800c54:	89 f1                	mov    %esi,%ecx
+  800c56:	8d 71 01             	lea    0x1(%ecx),%esi
+  800c59:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800c5d:	0f be d0             	movsbl %al,%edx
+  800c60:	85 d2                	test   %edx,%edx
+  800c62:	74 28                	je     800c8c <vprintfmt+0x238>
+  800c64:	85 ff                	test   %edi,%edi
+  800c66:	78 05                	js     800c6d <vprintfmt+0x219>
+  800c68:	83 ef 01             	sub    $0x1,%edi
+  800c6b:	78 30                	js     800c9d <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800c6d:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800c71:	74 d6                	je     800c49 <vprintfmt+0x1f5>
+  800c73:	0f be c0             	movsbl %al,%eax
+  800c76:	83 e8 20             	sub    $0x20,%eax
+  800c79:	83 f8 5e             	cmp    $0x5e,%eax
+  800c7c:	76 cb                	jbe    800c49 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800c7e:	83 ec 08             	sub    $0x8,%esp
+  800c81:	53                   	push   %ebx
+  800c82:	6a 3f                	push   $0x3f
+  800c84:	ff 55 08             	call   *0x8(%ebp)
+  800c87:	83 c4 10             	add    $0x10,%esp
+  800c8a:	eb c8                	jmp    800c54 <vprintfmt+0x200>
+  800c8c:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c8f:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800c92:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800c95:	01 d0                	add    %edx,%eax
+  800c97:	29 c8                	sub    %ecx,%eax
+  800c99:	89 c7                	mov    %eax,%edi
+  800c9b:	eb 13                	jmp    800cb0 <vprintfmt+0x25c>
+  800c9d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ca0:	eb ed                	jmp    800c8f <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800ca2:	83 ec 08             	sub    $0x8,%esp
+  800ca5:	53                   	push   %ebx
+  800ca6:	6a 20                	push   $0x20
+  800ca8:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800caa:	83 ef 01             	sub    $0x1,%edi
+  800cad:	83 c4 10             	add    $0x10,%esp
+  800cb0:	85 ff                	test   %edi,%edi
+  800cb2:	7f ee                	jg     800ca2 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800cb4:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800cb7:	89 45 14             	mov    %eax,0x14(%ebp)
+  800cba:	e9 36 01 00 00       	jmp    800df5 <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  800cbf:	83 f9 01             	cmp    $0x1,%ecx
+  800cc2:	7f 1f                	jg     800ce3 <vprintfmt+0x28f>
+	else if (lflag)
+  800cc4:	85 c9                	test   %ecx,%ecx
+  800cc6:	74 67                	je     800d2f <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800cc8:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ccb:	8b 00                	mov    (%eax),%eax
+  800ccd:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800cd0:	89 c1                	mov    %eax,%ecx
+  800cd2:	c1 f9 1f             	sar    $0x1f,%ecx
+  800cd5:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800cd8:	8b 45 14             	mov    0x14(%ebp),%eax
+  800cdb:	8d 40 04             	lea    0x4(%eax),%eax
+  800cde:	89 45 14             	mov    %eax,0x14(%ebp)
+  800ce1:	eb 17                	jmp    800cfa <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800ce3:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ce6:	8b 50 04             	mov    0x4(%eax),%edx
+  800ce9:	8b 00                	mov    (%eax),%eax
+  800ceb:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800cee:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800cf1:	8b 45 14             	mov    0x14(%ebp),%eax
+  800cf4:	8d 40 08             	lea    0x8(%eax),%eax
+  800cf7:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800cfa:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800cfd:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800d00:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800d05:	85 c9                	test   %ecx,%ecx
+  800d07:	0f 89 ce 00 00 00    	jns    800ddb <vprintfmt+0x387>
+				putch('-', putdat);
+  800d0d:	83 ec 08             	sub    $0x8,%esp
+  800d10:	53                   	push   %ebx
+  800d11:	6a 2d                	push   $0x2d
+  800d13:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800d15:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800d18:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800d1b:	f7 da                	neg    %edx
+  800d1d:	83 d1 00             	adc    $0x0,%ecx
+  800d20:	f7 d9                	neg    %ecx
+  800d22:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800d25:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800d2a:	e9 ac 00 00 00       	jmp    800ddb <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  800d2f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d32:	8b 00                	mov    (%eax),%eax
+  800d34:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800d37:	89 c1                	mov    %eax,%ecx
+  800d39:	c1 f9 1f             	sar    $0x1f,%ecx
+  800d3c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800d3f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d42:	8d 40 04             	lea    0x4(%eax),%eax
+  800d45:	89 45 14             	mov    %eax,0x14(%ebp)
+  800d48:	eb b0                	jmp    800cfa <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800d4a:	83 f9 01             	cmp    $0x1,%ecx
+  800d4d:	7f 1b                	jg     800d6a <vprintfmt+0x316>
+	else if (lflag)
+  800d4f:	85 c9                	test   %ecx,%ecx
+  800d51:	74 2c                	je     800d7f <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  800d53:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d56:	8b 10                	mov    (%eax),%edx
+  800d58:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d5d:	8d 40 04             	lea    0x4(%eax),%eax
+  800d60:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800d63:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800d68:	eb 71                	jmp    800ddb <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  800d6a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d6d:	8b 10                	mov    (%eax),%edx
+  800d6f:	8b 48 04             	mov    0x4(%eax),%ecx
+  800d72:	8d 40 08             	lea    0x8(%eax),%eax
+  800d75:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800d78:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800d7d:	eb 5c                	jmp    800ddb <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  800d7f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d82:	8b 10                	mov    (%eax),%edx
+  800d84:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d89:	8d 40 04             	lea    0x4(%eax),%eax
+  800d8c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800d8f:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800d94:	eb 45                	jmp    800ddb <vprintfmt+0x387>
+			putch('X', putdat);
+  800d96:	83 ec 08             	sub    $0x8,%esp
+  800d99:	53                   	push   %ebx
+  800d9a:	6a 58                	push   $0x58
+  800d9c:	ff d6                	call   *%esi
+			putch('X', putdat);
+  800d9e:	83 c4 08             	add    $0x8,%esp
+  800da1:	53                   	push   %ebx
+  800da2:	6a 58                	push   $0x58
+  800da4:	ff d6                	call   *%esi
+			putch('X', putdat);
+  800da6:	83 c4 08             	add    $0x8,%esp
+  800da9:	53                   	push   %ebx
+  800daa:	6a 58                	push   $0x58
+  800dac:	ff d6                	call   *%esi
+			break;
+  800dae:	83 c4 10             	add    $0x10,%esp
+  800db1:	eb 42                	jmp    800df5 <vprintfmt+0x3a1>
+			putch('0', putdat);
+  800db3:	83 ec 08             	sub    $0x8,%esp
+  800db6:	53                   	push   %ebx
+  800db7:	6a 30                	push   $0x30
+  800db9:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800dbb:	83 c4 08             	add    $0x8,%esp
+  800dbe:	53                   	push   %ebx
+  800dbf:	6a 78                	push   $0x78
+  800dc1:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800dc3:	8b 45 14             	mov    0x14(%ebp),%eax
+  800dc6:	8b 10                	mov    (%eax),%edx
+  800dc8:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800dcd:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800dd0:	8d 40 04             	lea    0x4(%eax),%eax
+  800dd3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800dd6:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800ddb:	83 ec 0c             	sub    $0xc,%esp
+  800dde:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800de2:	50                   	push   %eax
+  800de3:	ff 75 e0             	push   -0x20(%ebp)
+  800de6:	57                   	push   %edi
+  800de7:	51                   	push   %ecx
+  800de8:	52                   	push   %edx
+  800de9:	89 da                	mov    %ebx,%edx
+  800deb:	89 f0                	mov    %esi,%eax
+  800ded:	e8 7f fb ff ff       	call   800971 <printnum>
+			break;
+  800df2:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800df5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800df8:	e9 75 fc ff ff       	jmp    800a72 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800dfd:	83 f9 01             	cmp    $0x1,%ecx
+  800e00:	7f 1b                	jg     800e1d <vprintfmt+0x3c9>
+	else if (lflag)
+  800e02:	85 c9                	test   %ecx,%ecx
+  800e04:	74 2c                	je     800e32 <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  800e06:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e09:	8b 10                	mov    (%eax),%edx
+  800e0b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e10:	8d 40 04             	lea    0x4(%eax),%eax
+  800e13:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800e16:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800e1b:	eb be                	jmp    800ddb <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  800e1d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e20:	8b 10                	mov    (%eax),%edx
+  800e22:	8b 48 04             	mov    0x4(%eax),%ecx
+  800e25:	8d 40 08             	lea    0x8(%eax),%eax
+  800e28:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800e2b:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800e30:	eb a9                	jmp    800ddb <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  800e32:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e35:	8b 10                	mov    (%eax),%edx
+  800e37:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e3c:	8d 40 04             	lea    0x4(%eax),%eax
+  800e3f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800e42:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800e47:	eb 92                	jmp    800ddb <vprintfmt+0x387>
+			putch(ch, putdat);
+  800e49:	83 ec 08             	sub    $0x8,%esp
+  800e4c:	53                   	push   %ebx
+  800e4d:	6a 25                	push   $0x25
+  800e4f:	ff d6                	call   *%esi
+			break;
+  800e51:	83 c4 10             	add    $0x10,%esp
+  800e54:	eb 9f                	jmp    800df5 <vprintfmt+0x3a1>
+			putch('%', putdat);
+  800e56:	83 ec 08             	sub    $0x8,%esp
+  800e59:	53                   	push   %ebx
+  800e5a:	6a 25                	push   $0x25
+  800e5c:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800e5e:	83 c4 10             	add    $0x10,%esp
+  800e61:	89 f8                	mov    %edi,%eax
+  800e63:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800e67:	74 05                	je     800e6e <vprintfmt+0x41a>
+  800e69:	83 e8 01             	sub    $0x1,%eax
+  800e6c:	eb f5                	jmp    800e63 <vprintfmt+0x40f>
+  800e6e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800e71:	eb 82                	jmp    800df5 <vprintfmt+0x3a1>
+
+00800e73 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800e73:	55                   	push   %ebp
+  800e74:	89 e5                	mov    %esp,%ebp
+  800e76:	83 ec 18             	sub    $0x18,%esp
+  800e79:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e7c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800e7f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800e82:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800e86:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800e89:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800e90:	85 c0                	test   %eax,%eax
+  800e92:	74 26                	je     800eba <vsnprintf+0x47>
+  800e94:	85 d2                	test   %edx,%edx
+  800e96:	7e 22                	jle    800eba <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800e98:	ff 75 14             	push   0x14(%ebp)
+  800e9b:	ff 75 10             	push   0x10(%ebp)
+  800e9e:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800ea1:	50                   	push   %eax
+  800ea2:	68 1a 0a 80 00       	push   $0x800a1a
+  800ea7:	e8 a8 fb ff ff       	call   800a54 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800eac:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800eaf:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800eb2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800eb5:	83 c4 10             	add    $0x10,%esp
+}
+  800eb8:	c9                   	leave
+  800eb9:	c3                   	ret
+		return -E_INVAL;
+  800eba:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ebf:	eb f7                	jmp    800eb8 <vsnprintf+0x45>
+
+00800ec1 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800ec1:	55                   	push   %ebp
+  800ec2:	89 e5                	mov    %esp,%ebp
+  800ec4:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800ec7:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800eca:	50                   	push   %eax
+  800ecb:	ff 75 10             	push   0x10(%ebp)
+  800ece:	ff 75 0c             	push   0xc(%ebp)
+  800ed1:	ff 75 08             	push   0x8(%ebp)
+  800ed4:	e8 9a ff ff ff       	call   800e73 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800ed9:	c9                   	leave
+  800eda:	c3                   	ret
+
+00800edb <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800edb:	55                   	push   %ebp
+  800edc:	89 e5                	mov    %esp,%ebp
+  800ede:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800ee1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ee6:	eb 03                	jmp    800eeb <strlen+0x10>
+		n++;
+  800ee8:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800eeb:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800eef:	75 f7                	jne    800ee8 <strlen+0xd>
+	return n;
+}
+  800ef1:	5d                   	pop    %ebp
+  800ef2:	c3                   	ret
+
+00800ef3 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800ef3:	55                   	push   %ebp
+  800ef4:	89 e5                	mov    %esp,%ebp
+  800ef6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800ef9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800efc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f01:	eb 03                	jmp    800f06 <strnlen+0x13>
+		n++;
+  800f03:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800f06:	39 d0                	cmp    %edx,%eax
+  800f08:	74 08                	je     800f12 <strnlen+0x1f>
+  800f0a:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800f0e:	75 f3                	jne    800f03 <strnlen+0x10>
+  800f10:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800f12:	89 d0                	mov    %edx,%eax
+  800f14:	5d                   	pop    %ebp
+  800f15:	c3                   	ret
+
+00800f16 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800f16:	55                   	push   %ebp
+  800f17:	89 e5                	mov    %esp,%ebp
+  800f19:	53                   	push   %ebx
+  800f1a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800f1d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800f20:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f25:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800f29:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800f2c:	83 c0 01             	add    $0x1,%eax
+  800f2f:	84 d2                	test   %dl,%dl
+  800f31:	75 f2                	jne    800f25 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800f33:	89 c8                	mov    %ecx,%eax
+  800f35:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f38:	c9                   	leave
+  800f39:	c3                   	ret
+
+00800f3a <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800f3a:	55                   	push   %ebp
+  800f3b:	89 e5                	mov    %esp,%ebp
+  800f3d:	53                   	push   %ebx
+  800f3e:	83 ec 10             	sub    $0x10,%esp
+  800f41:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800f44:	53                   	push   %ebx
+  800f45:	e8 91 ff ff ff       	call   800edb <strlen>
+  800f4a:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800f4d:	ff 75 0c             	push   0xc(%ebp)
+  800f50:	01 d8                	add    %ebx,%eax
+  800f52:	50                   	push   %eax
+  800f53:	e8 be ff ff ff       	call   800f16 <strcpy>
+	return dst;
+}
+  800f58:	89 d8                	mov    %ebx,%eax
+  800f5a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f5d:	c9                   	leave
+  800f5e:	c3                   	ret
+
+00800f5f <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800f5f:	55                   	push   %ebp
+  800f60:	89 e5                	mov    %esp,%ebp
+  800f62:	56                   	push   %esi
+  800f63:	53                   	push   %ebx
+  800f64:	8b 75 08             	mov    0x8(%ebp),%esi
+  800f67:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800f6a:	89 f3                	mov    %esi,%ebx
+  800f6c:	03 5d 10             	add    0x10(%ebp),%ebx
+  800f6f:	89 f0                	mov    %esi,%eax
+  800f71:	eb 0f                	jmp    800f82 <strncpy+0x23>
+		*dst++ = *src;
+  800f73:	83 c0 01             	add    $0x1,%eax
+  800f76:	0f b6 0a             	movzbl (%edx),%ecx
+  800f79:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800f7c:	80 f9 01             	cmp    $0x1,%cl
+  800f7f:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800f82:	39 d8                	cmp    %ebx,%eax
+  800f84:	75 ed                	jne    800f73 <strncpy+0x14>
+	}
+	return ret;
+}
+  800f86:	89 f0                	mov    %esi,%eax
+  800f88:	5b                   	pop    %ebx
+  800f89:	5e                   	pop    %esi
+  800f8a:	5d                   	pop    %ebp
+  800f8b:	c3                   	ret
+
+00800f8c <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800f8c:	55                   	push   %ebp
+  800f8d:	89 e5                	mov    %esp,%ebp
+  800f8f:	56                   	push   %esi
+  800f90:	53                   	push   %ebx
+  800f91:	8b 75 08             	mov    0x8(%ebp),%esi
+  800f94:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f97:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800f9a:	89 f0                	mov    %esi,%eax
+  800f9c:	85 d2                	test   %edx,%edx
+  800f9e:	74 21                	je     800fc1 <strlcpy+0x35>
+  800fa0:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800fa4:	89 f2                	mov    %esi,%edx
+  800fa6:	eb 09                	jmp    800fb1 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800fa8:	83 c1 01             	add    $0x1,%ecx
+  800fab:	83 c2 01             	add    $0x1,%edx
+  800fae:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800fb1:	39 c2                	cmp    %eax,%edx
+  800fb3:	74 09                	je     800fbe <strlcpy+0x32>
+  800fb5:	0f b6 19             	movzbl (%ecx),%ebx
+  800fb8:	84 db                	test   %bl,%bl
+  800fba:	75 ec                	jne    800fa8 <strlcpy+0x1c>
+  800fbc:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800fbe:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800fc1:	29 f0                	sub    %esi,%eax
+}
+  800fc3:	5b                   	pop    %ebx
+  800fc4:	5e                   	pop    %esi
+  800fc5:	5d                   	pop    %ebp
+  800fc6:	c3                   	ret
+
+00800fc7 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800fc7:	55                   	push   %ebp
+  800fc8:	89 e5                	mov    %esp,%ebp
+  800fca:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800fcd:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800fd0:	eb 06                	jmp    800fd8 <strcmp+0x11>
+		p++, q++;
+  800fd2:	83 c1 01             	add    $0x1,%ecx
+  800fd5:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800fd8:	0f b6 01             	movzbl (%ecx),%eax
+  800fdb:	84 c0                	test   %al,%al
+  800fdd:	74 04                	je     800fe3 <strcmp+0x1c>
+  800fdf:	3a 02                	cmp    (%edx),%al
+  800fe1:	74 ef                	je     800fd2 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800fe3:	0f b6 c0             	movzbl %al,%eax
+  800fe6:	0f b6 12             	movzbl (%edx),%edx
+  800fe9:	29 d0                	sub    %edx,%eax
+}
+  800feb:	5d                   	pop    %ebp
+  800fec:	c3                   	ret
+
+00800fed <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800fed:	55                   	push   %ebp
+  800fee:	89 e5                	mov    %esp,%ebp
+  800ff0:	53                   	push   %ebx
+  800ff1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ff4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ff7:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800ffa:	eb 09                	jmp    801005 <strncmp+0x18>
+		n--, p++, q++;
+  800ffc:	83 ea 01             	sub    $0x1,%edx
+  800fff:	83 c0 01             	add    $0x1,%eax
+  801002:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  801005:	85 d2                	test   %edx,%edx
+  801007:	74 18                	je     801021 <strncmp+0x34>
+  801009:	0f b6 18             	movzbl (%eax),%ebx
+  80100c:	84 db                	test   %bl,%bl
+  80100e:	74 04                	je     801014 <strncmp+0x27>
+  801010:	3a 19                	cmp    (%ecx),%bl
+  801012:	74 e8                	je     800ffc <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801014:	0f b6 00             	movzbl (%eax),%eax
+  801017:	0f b6 11             	movzbl (%ecx),%edx
+  80101a:	29 d0                	sub    %edx,%eax
+}
+  80101c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80101f:	c9                   	leave
+  801020:	c3                   	ret
+		return 0;
+  801021:	b8 00 00 00 00       	mov    $0x0,%eax
+  801026:	eb f4                	jmp    80101c <strncmp+0x2f>
+
+00801028 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801028:	55                   	push   %ebp
+  801029:	89 e5                	mov    %esp,%ebp
+  80102b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80102e:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801032:	eb 03                	jmp    801037 <strchr+0xf>
+  801034:	83 c0 01             	add    $0x1,%eax
+  801037:	0f b6 10             	movzbl (%eax),%edx
+  80103a:	84 d2                	test   %dl,%dl
+  80103c:	74 06                	je     801044 <strchr+0x1c>
+		if (*s == c)
+  80103e:	38 ca                	cmp    %cl,%dl
+  801040:	75 f2                	jne    801034 <strchr+0xc>
+  801042:	eb 05                	jmp    801049 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  801044:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801049:	5d                   	pop    %ebp
+  80104a:	c3                   	ret
+
+0080104b <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80104b:	55                   	push   %ebp
+  80104c:	89 e5                	mov    %esp,%ebp
+  80104e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801051:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801055:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  801058:	38 ca                	cmp    %cl,%dl
+  80105a:	74 09                	je     801065 <strfind+0x1a>
+  80105c:	84 d2                	test   %dl,%dl
+  80105e:	74 05                	je     801065 <strfind+0x1a>
+	for (; *s; s++)
+  801060:	83 c0 01             	add    $0x1,%eax
+  801063:	eb f0                	jmp    801055 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  801065:	5d                   	pop    %ebp
+  801066:	c3                   	ret
+
+00801067 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801067:	55                   	push   %ebp
+  801068:	89 e5                	mov    %esp,%ebp
+  80106a:	57                   	push   %edi
+  80106b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80106e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  801071:	85 c9                	test   %ecx,%ecx
+  801073:	74 20                	je     801095 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  801075:	89 f8                	mov    %edi,%eax
+  801077:	09 c8                	or     %ecx,%eax
+  801079:	a8 03                	test   $0x3,%al
+  80107b:	75 12                	jne    80108f <memset+0x28>
+		c &= 0xFF;
+  80107d:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  801081:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  801087:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  80108a:	fc                   	cld
+  80108b:	f3 ab                	rep stos %eax,%es:(%edi)
+  80108d:	eb 06                	jmp    801095 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80108f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801092:	fc                   	cld
+  801093:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  801095:	89 f8                	mov    %edi,%eax
+  801097:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  80109a:	c9                   	leave
+  80109b:	c3                   	ret
+
+0080109c <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  80109c:	55                   	push   %ebp
+  80109d:	89 e5                	mov    %esp,%ebp
+  80109f:	57                   	push   %edi
+  8010a0:	56                   	push   %esi
+  8010a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010a4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8010a7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8010aa:	39 c6                	cmp    %eax,%esi
+  8010ac:	73 32                	jae    8010e0 <memmove+0x44>
+  8010ae:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8010b1:	39 d0                	cmp    %edx,%eax
+  8010b3:	73 2b                	jae    8010e0 <memmove+0x44>
+		s += n;
+		d += n;
+  8010b5:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8010b8:	89 d6                	mov    %edx,%esi
+  8010ba:	09 fe                	or     %edi,%esi
+  8010bc:	09 ce                	or     %ecx,%esi
+  8010be:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8010c4:	75 0e                	jne    8010d4 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8010c6:	83 ef 04             	sub    $0x4,%edi
+  8010c9:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8010cc:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8010cf:	fd                   	std
+  8010d0:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8010d2:	eb 09                	jmp    8010dd <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8010d4:	83 ef 01             	sub    $0x1,%edi
+  8010d7:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8010da:	fd                   	std
+  8010db:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8010dd:	fc                   	cld
+  8010de:	eb 1a                	jmp    8010fa <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8010e0:	89 f2                	mov    %esi,%edx
+  8010e2:	09 c2                	or     %eax,%edx
+  8010e4:	09 ca                	or     %ecx,%edx
+  8010e6:	f6 c2 03             	test   $0x3,%dl
+  8010e9:	75 0a                	jne    8010f5 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8010eb:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8010ee:	89 c7                	mov    %eax,%edi
+  8010f0:	fc                   	cld
+  8010f1:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8010f3:	eb 05                	jmp    8010fa <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8010f5:	89 c7                	mov    %eax,%edi
+  8010f7:	fc                   	cld
+  8010f8:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8010fa:	5e                   	pop    %esi
+  8010fb:	5f                   	pop    %edi
+  8010fc:	5d                   	pop    %ebp
+  8010fd:	c3                   	ret
+
+008010fe <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8010fe:	55                   	push   %ebp
+  8010ff:	89 e5                	mov    %esp,%ebp
+  801101:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  801104:	ff 75 10             	push   0x10(%ebp)
+  801107:	ff 75 0c             	push   0xc(%ebp)
+  80110a:	ff 75 08             	push   0x8(%ebp)
+  80110d:	e8 8a ff ff ff       	call   80109c <memmove>
+}
+  801112:	c9                   	leave
+  801113:	c3                   	ret
+
+00801114 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801114:	55                   	push   %ebp
+  801115:	89 e5                	mov    %esp,%ebp
+  801117:	56                   	push   %esi
+  801118:	53                   	push   %ebx
+  801119:	8b 45 08             	mov    0x8(%ebp),%eax
+  80111c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  80111f:	89 c6                	mov    %eax,%esi
+  801121:	03 75 10             	add    0x10(%ebp),%esi
+  801124:	eb 06                	jmp    80112c <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  801126:	83 c0 01             	add    $0x1,%eax
+  801129:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  80112c:	39 f0                	cmp    %esi,%eax
+  80112e:	74 14                	je     801144 <memcmp+0x30>
+		if (*s1 != *s2)
+  801130:	0f b6 08             	movzbl (%eax),%ecx
+  801133:	0f b6 1a             	movzbl (%edx),%ebx
+  801136:	38 d9                	cmp    %bl,%cl
+  801138:	74 ec                	je     801126 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  80113a:	0f b6 c1             	movzbl %cl,%eax
+  80113d:	0f b6 db             	movzbl %bl,%ebx
+  801140:	29 d8                	sub    %ebx,%eax
+  801142:	eb 05                	jmp    801149 <memcmp+0x35>
+	}
+
+	return 0;
+  801144:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801149:	5b                   	pop    %ebx
+  80114a:	5e                   	pop    %esi
+  80114b:	5d                   	pop    %ebp
+  80114c:	c3                   	ret
+
+0080114d <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  80114d:	55                   	push   %ebp
+  80114e:	89 e5                	mov    %esp,%ebp
+  801150:	8b 45 08             	mov    0x8(%ebp),%eax
+  801153:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  801156:	89 c2                	mov    %eax,%edx
+  801158:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  80115b:	eb 03                	jmp    801160 <memfind+0x13>
+  80115d:	83 c0 01             	add    $0x1,%eax
+  801160:	39 d0                	cmp    %edx,%eax
+  801162:	73 04                	jae    801168 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801164:	38 08                	cmp    %cl,(%eax)
+  801166:	75 f5                	jne    80115d <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  801168:	5d                   	pop    %ebp
+  801169:	c3                   	ret
+
+0080116a <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  80116a:	55                   	push   %ebp
+  80116b:	89 e5                	mov    %esp,%ebp
+  80116d:	57                   	push   %edi
+  80116e:	56                   	push   %esi
+  80116f:	53                   	push   %ebx
+  801170:	8b 55 08             	mov    0x8(%ebp),%edx
+  801173:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801176:	eb 03                	jmp    80117b <strtol+0x11>
+		s++;
+  801178:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  80117b:	0f b6 02             	movzbl (%edx),%eax
+  80117e:	3c 20                	cmp    $0x20,%al
+  801180:	74 f6                	je     801178 <strtol+0xe>
+  801182:	3c 09                	cmp    $0x9,%al
+  801184:	74 f2                	je     801178 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  801186:	3c 2b                	cmp    $0x2b,%al
+  801188:	74 2a                	je     8011b4 <strtol+0x4a>
+	int neg = 0;
+  80118a:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  80118f:	3c 2d                	cmp    $0x2d,%al
+  801191:	74 2b                	je     8011be <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801193:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  801199:	75 0f                	jne    8011aa <strtol+0x40>
+  80119b:	80 3a 30             	cmpb   $0x30,(%edx)
+  80119e:	74 28                	je     8011c8 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8011a0:	85 db                	test   %ebx,%ebx
+  8011a2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8011a7:	0f 44 d8             	cmove  %eax,%ebx
+  8011aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011af:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8011b2:	eb 46                	jmp    8011fa <strtol+0x90>
+		s++;
+  8011b4:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  8011b7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8011bc:	eb d5                	jmp    801193 <strtol+0x29>
+		s++, neg = 1;
+  8011be:	83 c2 01             	add    $0x1,%edx
+  8011c1:	bf 01 00 00 00       	mov    $0x1,%edi
+  8011c6:	eb cb                	jmp    801193 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8011c8:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8011cc:	74 0e                	je     8011dc <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  8011ce:	85 db                	test   %ebx,%ebx
+  8011d0:	75 d8                	jne    8011aa <strtol+0x40>
+		s++, base = 8;
+  8011d2:	83 c2 01             	add    $0x1,%edx
+  8011d5:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8011da:	eb ce                	jmp    8011aa <strtol+0x40>
+		s += 2, base = 16;
+  8011dc:	83 c2 02             	add    $0x2,%edx
+  8011df:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8011e4:	eb c4                	jmp    8011aa <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  8011e6:	0f be c0             	movsbl %al,%eax
+  8011e9:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  8011ec:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8011ef:	7d 3a                	jge    80122b <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  8011f1:	83 c2 01             	add    $0x1,%edx
+  8011f4:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  8011f8:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  8011fa:	0f b6 02             	movzbl (%edx),%eax
+  8011fd:	8d 70 d0             	lea    -0x30(%eax),%esi
+  801200:	89 f3                	mov    %esi,%ebx
+  801202:	80 fb 09             	cmp    $0x9,%bl
+  801205:	76 df                	jbe    8011e6 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  801207:	8d 70 9f             	lea    -0x61(%eax),%esi
+  80120a:	89 f3                	mov    %esi,%ebx
+  80120c:	80 fb 19             	cmp    $0x19,%bl
+  80120f:	77 08                	ja     801219 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  801211:	0f be c0             	movsbl %al,%eax
+  801214:	83 e8 57             	sub    $0x57,%eax
+  801217:	eb d3                	jmp    8011ec <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  801219:	8d 70 bf             	lea    -0x41(%eax),%esi
+  80121c:	89 f3                	mov    %esi,%ebx
+  80121e:	80 fb 19             	cmp    $0x19,%bl
+  801221:	77 08                	ja     80122b <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  801223:	0f be c0             	movsbl %al,%eax
+  801226:	83 e8 37             	sub    $0x37,%eax
+  801229:	eb c1                	jmp    8011ec <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  80122b:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80122f:	74 05                	je     801236 <strtol+0xcc>
+		*endptr = (char *) s;
+  801231:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801234:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  801236:	89 c8                	mov    %ecx,%eax
+  801238:	f7 d8                	neg    %eax
+  80123a:	85 ff                	test   %edi,%edi
+  80123c:	0f 45 c8             	cmovne %eax,%ecx
+}
+  80123f:	89 c8                	mov    %ecx,%eax
+  801241:	5b                   	pop    %ebx
+  801242:	5e                   	pop    %esi
+  801243:	5f                   	pop    %edi
+  801244:	5d                   	pop    %ebp
+  801245:	c3                   	ret
+
+00801246 <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801246:	55                   	push   %ebp
+  801247:	89 e5                	mov    %esp,%ebp
+  801249:	57                   	push   %edi
+  80124a:	56                   	push   %esi
+  80124b:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80124c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801251:	8b 55 08             	mov    0x8(%ebp),%edx
+  801254:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801257:	89 c3                	mov    %eax,%ebx
+  801259:	89 c7                	mov    %eax,%edi
+  80125b:	89 c6                	mov    %eax,%esi
+  80125d:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  80125f:	5b                   	pop    %ebx
+  801260:	5e                   	pop    %esi
+  801261:	5f                   	pop    %edi
+  801262:	5d                   	pop    %ebp
+  801263:	c3                   	ret
+
+00801264 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801264:	55                   	push   %ebp
+  801265:	89 e5                	mov    %esp,%ebp
+  801267:	57                   	push   %edi
+  801268:	56                   	push   %esi
+  801269:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80126a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80126f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801274:	89 d1                	mov    %edx,%ecx
+  801276:	89 d3                	mov    %edx,%ebx
+  801278:	89 d7                	mov    %edx,%edi
+  80127a:	89 d6                	mov    %edx,%esi
+  80127c:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  80127e:	5b                   	pop    %ebx
+  80127f:	5e                   	pop    %esi
+  801280:	5f                   	pop    %edi
+  801281:	5d                   	pop    %ebp
+  801282:	c3                   	ret
+
+00801283 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801283:	55                   	push   %ebp
+  801284:	89 e5                	mov    %esp,%ebp
+  801286:	57                   	push   %edi
+  801287:	56                   	push   %esi
+  801288:	53                   	push   %ebx
+  801289:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  80128c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801291:	8b 55 08             	mov    0x8(%ebp),%edx
+  801294:	b8 03 00 00 00       	mov    $0x3,%eax
+  801299:	89 cb                	mov    %ecx,%ebx
+  80129b:	89 cf                	mov    %ecx,%edi
+  80129d:	89 ce                	mov    %ecx,%esi
+  80129f:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8012a1:	85 c0                	test   %eax,%eax
+  8012a3:	7f 08                	jg     8012ad <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  8012a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012a8:	5b                   	pop    %ebx
+  8012a9:	5e                   	pop    %esi
+  8012aa:	5f                   	pop    %edi
+  8012ab:	5d                   	pop    %ebp
+  8012ac:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8012ad:	83 ec 0c             	sub    $0xc,%esp
+  8012b0:	50                   	push   %eax
+  8012b1:	6a 03                	push   $0x3
+  8012b3:	68 c3 34 80 00       	push   $0x8034c3
+  8012b8:	6a 3e                	push   $0x3e
+  8012ba:	68 e0 34 80 00       	push   $0x8034e0
+  8012bf:	e8 be f5 ff ff       	call   800882 <_panic>
+
+008012c4 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8012c4:	55                   	push   %ebp
+  8012c5:	89 e5                	mov    %esp,%ebp
+  8012c7:	57                   	push   %edi
+  8012c8:	56                   	push   %esi
+  8012c9:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8012ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012cf:	b8 02 00 00 00       	mov    $0x2,%eax
+  8012d4:	89 d1                	mov    %edx,%ecx
+  8012d6:	89 d3                	mov    %edx,%ebx
+  8012d8:	89 d7                	mov    %edx,%edi
+  8012da:	89 d6                	mov    %edx,%esi
+  8012dc:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  8012de:	5b                   	pop    %ebx
+  8012df:	5e                   	pop    %esi
+  8012e0:	5f                   	pop    %edi
+  8012e1:	5d                   	pop    %ebp
+  8012e2:	c3                   	ret
+
+008012e3 <sys_yield>:
+
+void
+sys_yield(void) {
+  8012e3:	55                   	push   %ebp
+  8012e4:	89 e5                	mov    %esp,%ebp
+  8012e6:	57                   	push   %edi
+  8012e7:	56                   	push   %esi
+  8012e8:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8012e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012ee:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8012f3:	89 d1                	mov    %edx,%ecx
+  8012f5:	89 d3                	mov    %edx,%ebx
+  8012f7:	89 d7                	mov    %edx,%edi
+  8012f9:	89 d6                	mov    %edx,%esi
+  8012fb:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  8012fd:	5b                   	pop    %ebx
+  8012fe:	5e                   	pop    %esi
+  8012ff:	5f                   	pop    %edi
+  801300:	5d                   	pop    %ebp
+  801301:	c3                   	ret
+
+00801302 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  801302:	55                   	push   %ebp
+  801303:	89 e5                	mov    %esp,%ebp
+  801305:	57                   	push   %edi
+  801306:	56                   	push   %esi
+  801307:	53                   	push   %ebx
+  801308:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  80130b:	be 00 00 00 00       	mov    $0x0,%esi
+  801310:	8b 55 08             	mov    0x8(%ebp),%edx
+  801313:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801316:	b8 04 00 00 00       	mov    $0x4,%eax
+  80131b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80131e:	89 f7                	mov    %esi,%edi
+  801320:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801322:	85 c0                	test   %eax,%eax
+  801324:	7f 08                	jg     80132e <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  801326:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801329:	5b                   	pop    %ebx
+  80132a:	5e                   	pop    %esi
+  80132b:	5f                   	pop    %edi
+  80132c:	5d                   	pop    %ebp
+  80132d:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80132e:	83 ec 0c             	sub    $0xc,%esp
+  801331:	50                   	push   %eax
+  801332:	6a 04                	push   $0x4
+  801334:	68 c3 34 80 00       	push   $0x8034c3
+  801339:	6a 3e                	push   $0x3e
+  80133b:	68 e0 34 80 00       	push   $0x8034e0
+  801340:	e8 3d f5 ff ff       	call   800882 <_panic>
+
+00801345 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  801345:	55                   	push   %ebp
+  801346:	89 e5                	mov    %esp,%ebp
+  801348:	57                   	push   %edi
+  801349:	56                   	push   %esi
+  80134a:	53                   	push   %ebx
+  80134b:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  80134e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801351:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801354:	b8 05 00 00 00       	mov    $0x5,%eax
+  801359:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80135c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80135f:	8b 75 18             	mov    0x18(%ebp),%esi
+  801362:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801364:	85 c0                	test   %eax,%eax
+  801366:	7f 08                	jg     801370 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  801368:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80136b:	5b                   	pop    %ebx
+  80136c:	5e                   	pop    %esi
+  80136d:	5f                   	pop    %edi
+  80136e:	5d                   	pop    %ebp
+  80136f:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801370:	83 ec 0c             	sub    $0xc,%esp
+  801373:	50                   	push   %eax
+  801374:	6a 05                	push   $0x5
+  801376:	68 c3 34 80 00       	push   $0x8034c3
+  80137b:	6a 3e                	push   $0x3e
+  80137d:	68 e0 34 80 00       	push   $0x8034e0
+  801382:	e8 fb f4 ff ff       	call   800882 <_panic>
+
+00801387 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  801387:	55                   	push   %ebp
+  801388:	89 e5                	mov    %esp,%ebp
+  80138a:	57                   	push   %edi
+  80138b:	56                   	push   %esi
+  80138c:	53                   	push   %ebx
+  80138d:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  801390:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801395:	8b 55 08             	mov    0x8(%ebp),%edx
+  801398:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80139b:	b8 06 00 00 00       	mov    $0x6,%eax
+  8013a0:	89 df                	mov    %ebx,%edi
+  8013a2:	89 de                	mov    %ebx,%esi
+  8013a4:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8013a6:	85 c0                	test   %eax,%eax
+  8013a8:	7f 08                	jg     8013b2 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  8013aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013ad:	5b                   	pop    %ebx
+  8013ae:	5e                   	pop    %esi
+  8013af:	5f                   	pop    %edi
+  8013b0:	5d                   	pop    %ebp
+  8013b1:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8013b2:	83 ec 0c             	sub    $0xc,%esp
+  8013b5:	50                   	push   %eax
+  8013b6:	6a 06                	push   $0x6
+  8013b8:	68 c3 34 80 00       	push   $0x8034c3
+  8013bd:	6a 3e                	push   $0x3e
+  8013bf:	68 e0 34 80 00       	push   $0x8034e0
+  8013c4:	e8 b9 f4 ff ff       	call   800882 <_panic>
+
+008013c9 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8013c9:	55                   	push   %ebp
+  8013ca:	89 e5                	mov    %esp,%ebp
+  8013cc:	57                   	push   %edi
+  8013cd:	56                   	push   %esi
+  8013ce:	53                   	push   %ebx
+  8013cf:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8013d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013da:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013dd:	b8 08 00 00 00       	mov    $0x8,%eax
+  8013e2:	89 df                	mov    %ebx,%edi
+  8013e4:	89 de                	mov    %ebx,%esi
+  8013e6:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8013e8:	85 c0                	test   %eax,%eax
+  8013ea:	7f 08                	jg     8013f4 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8013ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013ef:	5b                   	pop    %ebx
+  8013f0:	5e                   	pop    %esi
+  8013f1:	5f                   	pop    %edi
+  8013f2:	5d                   	pop    %ebp
+  8013f3:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8013f4:	83 ec 0c             	sub    $0xc,%esp
+  8013f7:	50                   	push   %eax
+  8013f8:	6a 08                	push   $0x8
+  8013fa:	68 c3 34 80 00       	push   $0x8034c3
+  8013ff:	6a 3e                	push   $0x3e
+  801401:	68 e0 34 80 00       	push   $0x8034e0
+  801406:	e8 77 f4 ff ff       	call   800882 <_panic>
+
+0080140b <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80140b:	55                   	push   %ebp
+  80140c:	89 e5                	mov    %esp,%ebp
+  80140e:	57                   	push   %edi
+  80140f:	56                   	push   %esi
+  801410:	53                   	push   %ebx
+  801411:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  801414:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801419:	8b 55 08             	mov    0x8(%ebp),%edx
+  80141c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80141f:	b8 09 00 00 00       	mov    $0x9,%eax
+  801424:	89 df                	mov    %ebx,%edi
+  801426:	89 de                	mov    %ebx,%esi
+  801428:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80142a:	85 c0                	test   %eax,%eax
+  80142c:	7f 08                	jg     801436 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  80142e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801431:	5b                   	pop    %ebx
+  801432:	5e                   	pop    %esi
+  801433:	5f                   	pop    %edi
+  801434:	5d                   	pop    %ebp
+  801435:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801436:	83 ec 0c             	sub    $0xc,%esp
+  801439:	50                   	push   %eax
+  80143a:	6a 09                	push   $0x9
+  80143c:	68 c3 34 80 00       	push   $0x8034c3
+  801441:	6a 3e                	push   $0x3e
+  801443:	68 e0 34 80 00       	push   $0x8034e0
+  801448:	e8 35 f4 ff ff       	call   800882 <_panic>
+
+0080144d <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80144d:	55                   	push   %ebp
+  80144e:	89 e5                	mov    %esp,%ebp
+  801450:	57                   	push   %edi
+  801451:	56                   	push   %esi
+  801452:	53                   	push   %ebx
+  801453:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  801456:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80145b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80145e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801461:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801466:	89 df                	mov    %ebx,%edi
+  801468:	89 de                	mov    %ebx,%esi
+  80146a:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80146c:	85 c0                	test   %eax,%eax
+  80146e:	7f 08                	jg     801478 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801470:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801473:	5b                   	pop    %ebx
+  801474:	5e                   	pop    %esi
+  801475:	5f                   	pop    %edi
+  801476:	5d                   	pop    %ebp
+  801477:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801478:	83 ec 0c             	sub    $0xc,%esp
+  80147b:	50                   	push   %eax
+  80147c:	6a 0a                	push   $0xa
+  80147e:	68 c3 34 80 00       	push   $0x8034c3
+  801483:	6a 3e                	push   $0x3e
+  801485:	68 e0 34 80 00       	push   $0x8034e0
+  80148a:	e8 f3 f3 ff ff       	call   800882 <_panic>
+
+0080148f <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  80148f:	55                   	push   %ebp
+  801490:	89 e5                	mov    %esp,%ebp
+  801492:	57                   	push   %edi
+  801493:	56                   	push   %esi
+  801494:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  801495:	8b 55 08             	mov    0x8(%ebp),%edx
+  801498:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80149b:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8014a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8014a5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014a8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8014ab:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8014ad:	5b                   	pop    %ebx
+  8014ae:	5e                   	pop    %esi
+  8014af:	5f                   	pop    %edi
+  8014b0:	5d                   	pop    %ebp
+  8014b1:	c3                   	ret
+
+008014b2 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  8014b2:	55                   	push   %ebp
+  8014b3:	89 e5                	mov    %esp,%ebp
+  8014b5:	57                   	push   %edi
+  8014b6:	56                   	push   %esi
+  8014b7:	53                   	push   %ebx
+  8014b8:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8014bb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014c3:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8014c8:	89 cb                	mov    %ecx,%ebx
+  8014ca:	89 cf                	mov    %ecx,%edi
+  8014cc:	89 ce                	mov    %ecx,%esi
+  8014ce:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8014d0:	85 c0                	test   %eax,%eax
+  8014d2:	7f 08                	jg     8014dc <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  8014d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014d7:	5b                   	pop    %ebx
+  8014d8:	5e                   	pop    %esi
+  8014d9:	5f                   	pop    %edi
+  8014da:	5d                   	pop    %ebp
+  8014db:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8014dc:	83 ec 0c             	sub    $0xc,%esp
+  8014df:	50                   	push   %eax
+  8014e0:	6a 0d                	push   $0xd
+  8014e2:	68 c3 34 80 00       	push   $0x8034c3
+  8014e7:	6a 3e                	push   $0x3e
+  8014e9:	68 e0 34 80 00       	push   $0x8034e0
+  8014ee:	e8 8f f3 ff ff       	call   800882 <_panic>
+
+008014f3 <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  8014f3:	55                   	push   %ebp
+  8014f4:	89 e5                	mov    %esp,%ebp
+  8014f6:	57                   	push   %edi
+  8014f7:	56                   	push   %esi
+  8014f8:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8014f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014fe:	8b 55 08             	mov    0x8(%ebp),%edx
+  801501:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801504:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801509:	89 df                	mov    %ebx,%edi
+  80150b:	89 de                	mov    %ebx,%esi
+  80150d:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  80150f:	5b                   	pop    %ebx
+  801510:	5e                   	pop    %esi
+  801511:	5f                   	pop    %edi
+  801512:	5d                   	pop    %ebp
+  801513:	c3                   	ret
+
+00801514 <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  801514:	55                   	push   %ebp
+  801515:	89 e5                	mov    %esp,%ebp
+  801517:	57                   	push   %edi
+  801518:	56                   	push   %esi
+  801519:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80151a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80151f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801522:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801527:	89 cb                	mov    %ecx,%ebx
+  801529:	89 cf                	mov    %ecx,%edi
+  80152b:	89 ce                	mov    %ecx,%esi
+  80152d:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  80152f:	5b                   	pop    %ebx
+  801530:	5e                   	pop    %esi
+  801531:	5f                   	pop    %edi
+  801532:	5d                   	pop    %ebp
+  801533:	c3                   	ret
+
+00801534 <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  801534:	55                   	push   %ebp
+  801535:	89 e5                	mov    %esp,%ebp
+  801537:	57                   	push   %edi
+  801538:	56                   	push   %esi
+  801539:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80153a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80153f:	b8 10 00 00 00       	mov    $0x10,%eax
+  801544:	89 d1                	mov    %edx,%ecx
+  801546:	89 d3                	mov    %edx,%ebx
+  801548:	89 d7                	mov    %edx,%edi
+  80154a:	89 d6                	mov    %edx,%esi
+  80154c:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80154e:	5b                   	pop    %ebx
+  80154f:	5e                   	pop    %esi
+  801550:	5f                   	pop    %edi
+  801551:	5d                   	pop    %ebp
+  801552:	c3                   	ret
+
+00801553 <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  801553:	55                   	push   %ebp
+  801554:	89 e5                	mov    %esp,%ebp
+  801556:	57                   	push   %edi
+  801557:	56                   	push   %esi
+  801558:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  801559:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80155e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801561:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801564:	b8 11 00 00 00       	mov    $0x11,%eax
+  801569:	89 df                	mov    %ebx,%edi
+  80156b:	89 de                	mov    %ebx,%esi
+  80156d:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  80156f:	5b                   	pop    %ebx
+  801570:	5e                   	pop    %esi
+  801571:	5f                   	pop    %edi
+  801572:	5d                   	pop    %ebp
+  801573:	c3                   	ret
+
+00801574 <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  801574:	55                   	push   %ebp
+  801575:	89 e5                	mov    %esp,%ebp
+  801577:	57                   	push   %edi
+  801578:	56                   	push   %esi
+  801579:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80157a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80157f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801582:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801585:	b8 12 00 00 00       	mov    $0x12,%eax
+  80158a:	89 df                	mov    %ebx,%edi
+  80158c:	89 de                	mov    %ebx,%esi
+  80158e:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  801590:	5b                   	pop    %ebx
+  801591:	5e                   	pop    %esi
+  801592:	5f                   	pop    %edi
+  801593:	5d                   	pop    %ebp
+  801594:	c3                   	ret
+
+00801595 <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  801595:	55                   	push   %ebp
+  801596:	89 e5                	mov    %esp,%ebp
+  801598:	57                   	push   %edi
+  801599:	56                   	push   %esi
+  80159a:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80159b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015a0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015a3:	b8 13 00 00 00       	mov    $0x13,%eax
+  8015a8:	89 cb                	mov    %ecx,%ebx
+  8015aa:	89 cf                	mov    %ecx,%edi
+  8015ac:	89 ce                	mov    %ecx,%esi
+  8015ae:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  8015b0:	5b                   	pop    %ebx
+  8015b1:	5e                   	pop    %esi
+  8015b2:	5f                   	pop    %edi
+  8015b3:	5d                   	pop    %ebp
+  8015b4:	c3                   	ret
+
+008015b5 <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  8015b5:	55                   	push   %ebp
+  8015b6:	89 e5                	mov    %esp,%ebp
+  8015b8:	57                   	push   %edi
+  8015b9:	56                   	push   %esi
+  8015ba:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8015bb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015c3:	b8 14 00 00 00       	mov    $0x14,%eax
+  8015c8:	89 cb                	mov    %ecx,%ebx
+  8015ca:	89 cf                	mov    %ecx,%edi
+  8015cc:	89 ce                	mov    %ecx,%esi
+  8015ce:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  8015d0:	5b                   	pop    %ebx
+  8015d1:	5e                   	pop    %esi
+  8015d2:	5f                   	pop    %edi
+  8015d3:	5d                   	pop    %ebp
+  8015d4:	c3                   	ret
+
+008015d5 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8015d5:	55                   	push   %ebp
+  8015d6:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8015d8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015db:	05 00 00 00 30       	add    $0x30000000,%eax
+  8015e0:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8015e3:	5d                   	pop    %ebp
+  8015e4:	c3                   	ret
+
+008015e5 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8015e5:	55                   	push   %ebp
+  8015e6:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8015e8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015eb:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8015f0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8015f5:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8015fa:	5d                   	pop    %ebp
+  8015fb:	c3                   	ret
+
+008015fc <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8015fc:	55                   	push   %ebp
+  8015fd:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8015ff:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801604:	eb 02                	jmp    801608 <fd_alloc+0xc>
+  801606:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801608:	89 c2                	mov    %eax,%edx
+  80160a:	c1 ea 16             	shr    $0x16,%edx
+  80160d:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801614:	f6 c2 01             	test   $0x1,%dl
+  801617:	74 2b                	je     801644 <fd_alloc+0x48>
+  801619:	89 c2                	mov    %eax,%edx
+  80161b:	c1 ea 0c             	shr    $0xc,%edx
+  80161e:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801625:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80162b:	f6 c1 01             	test   $0x1,%cl
+  80162e:	74 14                	je     801644 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801630:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801636:	75 ce                	jne    801606 <fd_alloc+0xa>
+  801638:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80163d:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801642:	eb 05                	jmp    801649 <fd_alloc+0x4d>
+			return 0;
+  801644:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801649:	8b 55 08             	mov    0x8(%ebp),%edx
+  80164c:	89 02                	mov    %eax,(%edx)
+}
+  80164e:	89 c8                	mov    %ecx,%eax
+  801650:	5d                   	pop    %ebp
+  801651:	c3                   	ret
+
+00801652 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801652:	55                   	push   %ebp
+  801653:	89 e5                	mov    %esp,%ebp
+  801655:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801658:	83 f8 1f             	cmp    $0x1f,%eax
+  80165b:	77 30                	ja     80168d <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80165d:	c1 e0 0c             	shl    $0xc,%eax
+  801660:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801665:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80166b:	f6 c2 01             	test   $0x1,%dl
+  80166e:	74 24                	je     801694 <fd_lookup+0x42>
+  801670:	89 c2                	mov    %eax,%edx
+  801672:	c1 ea 0c             	shr    $0xc,%edx
+  801675:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80167c:	f6 c2 01             	test   $0x1,%dl
+  80167f:	74 1a                	je     80169b <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801681:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801684:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801686:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80168b:	5d                   	pop    %ebp
+  80168c:	c3                   	ret
+		return -E_INVAL;
+  80168d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801692:	eb f7                	jmp    80168b <fd_lookup+0x39>
+		return -E_INVAL;
+  801694:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801699:	eb f0                	jmp    80168b <fd_lookup+0x39>
+  80169b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016a0:	eb e9                	jmp    80168b <fd_lookup+0x39>
+
+008016a2 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8016a2:	55                   	push   %ebp
+  8016a3:	89 e5                	mov    %esp,%ebp
+  8016a5:	53                   	push   %ebx
+  8016a6:	83 ec 04             	sub    $0x4,%esp
+  8016a9:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8016ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016b1:	eb 03                	jmp    8016b6 <dev_lookup+0x14>
+  8016b3:	83 c0 01             	add    $0x1,%eax
+  8016b6:	8b 1c 85 6c 35 80 00 	mov    0x80356c(,%eax,4),%ebx
+  8016bd:	85 db                	test   %ebx,%ebx
+  8016bf:	74 0b                	je     8016cc <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8016c1:	39 13                	cmp    %edx,(%ebx)
+  8016c3:	75 ee                	jne    8016b3 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8016c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016ca:	eb 1f                	jmp    8016eb <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8016cc:	a1 1c 50 80 00       	mov    0x80501c,%eax
+  8016d1:	8b 40 48             	mov    0x48(%eax),%eax
+  8016d4:	83 ec 04             	sub    $0x4,%esp
+  8016d7:	52                   	push   %edx
+  8016d8:	50                   	push   %eax
+  8016d9:	68 f0 34 80 00       	push   $0x8034f0
+  8016de:	e8 7a f2 ff ff       	call   80095d <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8016e3:	83 c4 10             	add    $0x10,%esp
+  8016e6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8016eb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8016ee:	89 1a                	mov    %ebx,(%edx)
+}
+  8016f0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016f3:	c9                   	leave
+  8016f4:	c3                   	ret
+
+008016f5 <fd_close>:
+{
+  8016f5:	55                   	push   %ebp
+  8016f6:	89 e5                	mov    %esp,%ebp
+  8016f8:	57                   	push   %edi
+  8016f9:	56                   	push   %esi
+  8016fa:	53                   	push   %ebx
+  8016fb:	83 ec 24             	sub    $0x24,%esp
+  8016fe:	8b 75 08             	mov    0x8(%ebp),%esi
+  801701:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801704:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801707:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801708:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80170e:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801711:	50                   	push   %eax
+  801712:	e8 3b ff ff ff       	call   801652 <fd_lookup>
+  801717:	89 c3                	mov    %eax,%ebx
+  801719:	83 c4 10             	add    $0x10,%esp
+  80171c:	85 c0                	test   %eax,%eax
+  80171e:	78 05                	js     801725 <fd_close+0x30>
+	    || fd != fd2)
+  801720:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801723:	74 16                	je     80173b <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801725:	89 f8                	mov    %edi,%eax
+  801727:	84 c0                	test   %al,%al
+  801729:	b8 00 00 00 00       	mov    $0x0,%eax
+  80172e:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801731:	89 d8                	mov    %ebx,%eax
+  801733:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801736:	5b                   	pop    %ebx
+  801737:	5e                   	pop    %esi
+  801738:	5f                   	pop    %edi
+  801739:	5d                   	pop    %ebp
+  80173a:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80173b:	83 ec 08             	sub    $0x8,%esp
+  80173e:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801741:	50                   	push   %eax
+  801742:	ff 36                	push   (%esi)
+  801744:	e8 59 ff ff ff       	call   8016a2 <dev_lookup>
+  801749:	89 c3                	mov    %eax,%ebx
+  80174b:	83 c4 10             	add    $0x10,%esp
+  80174e:	85 c0                	test   %eax,%eax
+  801750:	78 1a                	js     80176c <fd_close+0x77>
+		if (dev->dev_close)
+  801752:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801755:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801758:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80175d:	85 c0                	test   %eax,%eax
+  80175f:	74 0b                	je     80176c <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801761:	83 ec 0c             	sub    $0xc,%esp
+  801764:	56                   	push   %esi
+  801765:	ff d0                	call   *%eax
+  801767:	89 c3                	mov    %eax,%ebx
+  801769:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80176c:	83 ec 08             	sub    $0x8,%esp
+  80176f:	56                   	push   %esi
+  801770:	6a 00                	push   $0x0
+  801772:	e8 10 fc ff ff       	call   801387 <sys_page_unmap>
+	return r;
+  801777:	83 c4 10             	add    $0x10,%esp
+  80177a:	eb b5                	jmp    801731 <fd_close+0x3c>
+
+0080177c <close>:
+
+int
+close(int fdnum)
+{
+  80177c:	55                   	push   %ebp
+  80177d:	89 e5                	mov    %esp,%ebp
+  80177f:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801782:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801785:	50                   	push   %eax
+  801786:	ff 75 08             	push   0x8(%ebp)
+  801789:	e8 c4 fe ff ff       	call   801652 <fd_lookup>
+  80178e:	83 c4 10             	add    $0x10,%esp
+  801791:	85 c0                	test   %eax,%eax
+  801793:	79 02                	jns    801797 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801795:	c9                   	leave
+  801796:	c3                   	ret
+		return fd_close(fd, 1);
+  801797:	83 ec 08             	sub    $0x8,%esp
+  80179a:	6a 01                	push   $0x1
+  80179c:	ff 75 f4             	push   -0xc(%ebp)
+  80179f:	e8 51 ff ff ff       	call   8016f5 <fd_close>
+  8017a4:	83 c4 10             	add    $0x10,%esp
+  8017a7:	eb ec                	jmp    801795 <close+0x19>
+
+008017a9 <close_all>:
+
+void
+close_all(void)
+{
+  8017a9:	55                   	push   %ebp
+  8017aa:	89 e5                	mov    %esp,%ebp
+  8017ac:	53                   	push   %ebx
+  8017ad:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8017b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8017b5:	83 ec 0c             	sub    $0xc,%esp
+  8017b8:	53                   	push   %ebx
+  8017b9:	e8 be ff ff ff       	call   80177c <close>
+	for (i = 0; i < MAXFD; i++)
+  8017be:	83 c3 01             	add    $0x1,%ebx
+  8017c1:	83 c4 10             	add    $0x10,%esp
+  8017c4:	83 fb 20             	cmp    $0x20,%ebx
+  8017c7:	75 ec                	jne    8017b5 <close_all+0xc>
+}
+  8017c9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017cc:	c9                   	leave
+  8017cd:	c3                   	ret
+
+008017ce <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8017ce:	55                   	push   %ebp
+  8017cf:	89 e5                	mov    %esp,%ebp
+  8017d1:	57                   	push   %edi
+  8017d2:	56                   	push   %esi
+  8017d3:	53                   	push   %ebx
+  8017d4:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8017d7:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8017da:	50                   	push   %eax
+  8017db:	ff 75 08             	push   0x8(%ebp)
+  8017de:	e8 6f fe ff ff       	call   801652 <fd_lookup>
+  8017e3:	89 c3                	mov    %eax,%ebx
+  8017e5:	83 c4 10             	add    $0x10,%esp
+  8017e8:	85 c0                	test   %eax,%eax
+  8017ea:	78 7f                	js     80186b <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8017ec:	83 ec 0c             	sub    $0xc,%esp
+  8017ef:	ff 75 0c             	push   0xc(%ebp)
+  8017f2:	e8 85 ff ff ff       	call   80177c <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8017f7:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8017fa:	c1 e6 0c             	shl    $0xc,%esi
+  8017fd:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801803:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801806:	89 3c 24             	mov    %edi,(%esp)
+  801809:	e8 d7 fd ff ff       	call   8015e5 <fd2data>
+  80180e:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801810:	89 34 24             	mov    %esi,(%esp)
+  801813:	e8 cd fd ff ff       	call   8015e5 <fd2data>
+  801818:	83 c4 10             	add    $0x10,%esp
+  80181b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80181e:	89 d8                	mov    %ebx,%eax
+  801820:	c1 e8 16             	shr    $0x16,%eax
+  801823:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80182a:	a8 01                	test   $0x1,%al
+  80182c:	74 11                	je     80183f <dup+0x71>
+  80182e:	89 d8                	mov    %ebx,%eax
+  801830:	c1 e8 0c             	shr    $0xc,%eax
+  801833:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80183a:	f6 c2 01             	test   $0x1,%dl
+  80183d:	75 36                	jne    801875 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80183f:	89 f8                	mov    %edi,%eax
+  801841:	c1 e8 0c             	shr    $0xc,%eax
+  801844:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80184b:	83 ec 0c             	sub    $0xc,%esp
+  80184e:	25 07 0e 00 00       	and    $0xe07,%eax
+  801853:	50                   	push   %eax
+  801854:	56                   	push   %esi
+  801855:	6a 00                	push   $0x0
+  801857:	57                   	push   %edi
+  801858:	6a 00                	push   $0x0
+  80185a:	e8 e6 fa ff ff       	call   801345 <sys_page_map>
+  80185f:	89 c3                	mov    %eax,%ebx
+  801861:	83 c4 20             	add    $0x20,%esp
+  801864:	85 c0                	test   %eax,%eax
+  801866:	78 33                	js     80189b <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801868:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80186b:	89 d8                	mov    %ebx,%eax
+  80186d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801870:	5b                   	pop    %ebx
+  801871:	5e                   	pop    %esi
+  801872:	5f                   	pop    %edi
+  801873:	5d                   	pop    %ebp
+  801874:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801875:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80187c:	83 ec 0c             	sub    $0xc,%esp
+  80187f:	25 07 0e 00 00       	and    $0xe07,%eax
+  801884:	50                   	push   %eax
+  801885:	ff 75 d4             	push   -0x2c(%ebp)
+  801888:	6a 00                	push   $0x0
+  80188a:	53                   	push   %ebx
+  80188b:	6a 00                	push   $0x0
+  80188d:	e8 b3 fa ff ff       	call   801345 <sys_page_map>
+  801892:	89 c3                	mov    %eax,%ebx
+  801894:	83 c4 20             	add    $0x20,%esp
+  801897:	85 c0                	test   %eax,%eax
+  801899:	79 a4                	jns    80183f <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80189b:	83 ec 08             	sub    $0x8,%esp
+  80189e:	56                   	push   %esi
+  80189f:	6a 00                	push   $0x0
+  8018a1:	e8 e1 fa ff ff       	call   801387 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8018a6:	83 c4 08             	add    $0x8,%esp
+  8018a9:	ff 75 d4             	push   -0x2c(%ebp)
+  8018ac:	6a 00                	push   $0x0
+  8018ae:	e8 d4 fa ff ff       	call   801387 <sys_page_unmap>
+	return r;
+  8018b3:	83 c4 10             	add    $0x10,%esp
+  8018b6:	eb b3                	jmp    80186b <dup+0x9d>
+
+008018b8 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8018b8:	55                   	push   %ebp
+  8018b9:	89 e5                	mov    %esp,%ebp
+  8018bb:	56                   	push   %esi
+  8018bc:	53                   	push   %ebx
+  8018bd:	83 ec 18             	sub    $0x18,%esp
+  8018c0:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018c3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018c6:	50                   	push   %eax
+  8018c7:	56                   	push   %esi
+  8018c8:	e8 85 fd ff ff       	call   801652 <fd_lookup>
+  8018cd:	83 c4 10             	add    $0x10,%esp
+  8018d0:	85 c0                	test   %eax,%eax
+  8018d2:	78 3c                	js     801910 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8018d4:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8018d7:	83 ec 08             	sub    $0x8,%esp
+  8018da:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018dd:	50                   	push   %eax
+  8018de:	ff 33                	push   (%ebx)
+  8018e0:	e8 bd fd ff ff       	call   8016a2 <dev_lookup>
+  8018e5:	83 c4 10             	add    $0x10,%esp
+  8018e8:	85 c0                	test   %eax,%eax
+  8018ea:	78 24                	js     801910 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8018ec:	8b 43 08             	mov    0x8(%ebx),%eax
+  8018ef:	83 e0 03             	and    $0x3,%eax
+  8018f2:	83 f8 01             	cmp    $0x1,%eax
+  8018f5:	74 20                	je     801917 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8018f7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018fa:	8b 40 08             	mov    0x8(%eax),%eax
+  8018fd:	85 c0                	test   %eax,%eax
+  8018ff:	74 37                	je     801938 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801901:	83 ec 04             	sub    $0x4,%esp
+  801904:	ff 75 10             	push   0x10(%ebp)
+  801907:	ff 75 0c             	push   0xc(%ebp)
+  80190a:	53                   	push   %ebx
+  80190b:	ff d0                	call   *%eax
+  80190d:	83 c4 10             	add    $0x10,%esp
+}
+  801910:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801913:	5b                   	pop    %ebx
+  801914:	5e                   	pop    %esi
+  801915:	5d                   	pop    %ebp
+  801916:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801917:	a1 1c 50 80 00       	mov    0x80501c,%eax
+  80191c:	8b 40 48             	mov    0x48(%eax),%eax
+  80191f:	83 ec 04             	sub    $0x4,%esp
+  801922:	56                   	push   %esi
+  801923:	50                   	push   %eax
+  801924:	68 31 35 80 00       	push   $0x803531
+  801929:	e8 2f f0 ff ff       	call   80095d <cprintf>
+		return -E_INVAL;
+  80192e:	83 c4 10             	add    $0x10,%esp
+  801931:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801936:	eb d8                	jmp    801910 <read+0x58>
+		return -E_NOT_SUPP;
+  801938:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80193d:	eb d1                	jmp    801910 <read+0x58>
+
+0080193f <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80193f:	55                   	push   %ebp
+  801940:	89 e5                	mov    %esp,%ebp
+  801942:	57                   	push   %edi
+  801943:	56                   	push   %esi
+  801944:	53                   	push   %ebx
+  801945:	83 ec 0c             	sub    $0xc,%esp
+  801948:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80194b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80194e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801953:	eb 02                	jmp    801957 <readn+0x18>
+  801955:	01 c3                	add    %eax,%ebx
+  801957:	39 f3                	cmp    %esi,%ebx
+  801959:	73 21                	jae    80197c <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80195b:	83 ec 04             	sub    $0x4,%esp
+  80195e:	89 f0                	mov    %esi,%eax
+  801960:	29 d8                	sub    %ebx,%eax
+  801962:	50                   	push   %eax
+  801963:	89 d8                	mov    %ebx,%eax
+  801965:	03 45 0c             	add    0xc(%ebp),%eax
+  801968:	50                   	push   %eax
+  801969:	57                   	push   %edi
+  80196a:	e8 49 ff ff ff       	call   8018b8 <read>
+		if (m < 0)
+  80196f:	83 c4 10             	add    $0x10,%esp
+  801972:	85 c0                	test   %eax,%eax
+  801974:	78 04                	js     80197a <readn+0x3b>
+			return m;
+		if (m == 0)
+  801976:	75 dd                	jne    801955 <readn+0x16>
+  801978:	eb 02                	jmp    80197c <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80197a:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80197c:	89 d8                	mov    %ebx,%eax
+  80197e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801981:	5b                   	pop    %ebx
+  801982:	5e                   	pop    %esi
+  801983:	5f                   	pop    %edi
+  801984:	5d                   	pop    %ebp
+  801985:	c3                   	ret
+
+00801986 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801986:	55                   	push   %ebp
+  801987:	89 e5                	mov    %esp,%ebp
+  801989:	56                   	push   %esi
+  80198a:	53                   	push   %ebx
+  80198b:	83 ec 18             	sub    $0x18,%esp
+  80198e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801991:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801994:	50                   	push   %eax
+  801995:	53                   	push   %ebx
+  801996:	e8 b7 fc ff ff       	call   801652 <fd_lookup>
+  80199b:	83 c4 10             	add    $0x10,%esp
+  80199e:	85 c0                	test   %eax,%eax
+  8019a0:	78 37                	js     8019d9 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8019a2:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8019a5:	83 ec 08             	sub    $0x8,%esp
+  8019a8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019ab:	50                   	push   %eax
+  8019ac:	ff 36                	push   (%esi)
+  8019ae:	e8 ef fc ff ff       	call   8016a2 <dev_lookup>
+  8019b3:	83 c4 10             	add    $0x10,%esp
+  8019b6:	85 c0                	test   %eax,%eax
+  8019b8:	78 1f                	js     8019d9 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8019ba:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8019be:	74 20                	je     8019e0 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8019c0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019c3:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019c6:	85 c0                	test   %eax,%eax
+  8019c8:	74 37                	je     801a01 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8019ca:	83 ec 04             	sub    $0x4,%esp
+  8019cd:	ff 75 10             	push   0x10(%ebp)
+  8019d0:	ff 75 0c             	push   0xc(%ebp)
+  8019d3:	56                   	push   %esi
+  8019d4:	ff d0                	call   *%eax
+  8019d6:	83 c4 10             	add    $0x10,%esp
+}
+  8019d9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019dc:	5b                   	pop    %ebx
+  8019dd:	5e                   	pop    %esi
+  8019de:	5d                   	pop    %ebp
+  8019df:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8019e0:	a1 1c 50 80 00       	mov    0x80501c,%eax
+  8019e5:	8b 40 48             	mov    0x48(%eax),%eax
+  8019e8:	83 ec 04             	sub    $0x4,%esp
+  8019eb:	53                   	push   %ebx
+  8019ec:	50                   	push   %eax
+  8019ed:	68 4d 35 80 00       	push   $0x80354d
+  8019f2:	e8 66 ef ff ff       	call   80095d <cprintf>
+		return -E_INVAL;
+  8019f7:	83 c4 10             	add    $0x10,%esp
+  8019fa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019ff:	eb d8                	jmp    8019d9 <write+0x53>
+		return -E_NOT_SUPP;
+  801a01:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a06:	eb d1                	jmp    8019d9 <write+0x53>
+
+00801a08 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801a08:	55                   	push   %ebp
+  801a09:	89 e5                	mov    %esp,%ebp
+  801a0b:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801a0e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a11:	50                   	push   %eax
+  801a12:	ff 75 08             	push   0x8(%ebp)
+  801a15:	e8 38 fc ff ff       	call   801652 <fd_lookup>
+  801a1a:	83 c4 10             	add    $0x10,%esp
+  801a1d:	85 c0                	test   %eax,%eax
+  801a1f:	78 0e                	js     801a2f <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801a21:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a24:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a27:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801a2a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a2f:	c9                   	leave
+  801a30:	c3                   	ret
+
+00801a31 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801a31:	55                   	push   %ebp
+  801a32:	89 e5                	mov    %esp,%ebp
+  801a34:	56                   	push   %esi
+  801a35:	53                   	push   %ebx
+  801a36:	83 ec 18             	sub    $0x18,%esp
+  801a39:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a3c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a3f:	50                   	push   %eax
+  801a40:	53                   	push   %ebx
+  801a41:	e8 0c fc ff ff       	call   801652 <fd_lookup>
+  801a46:	83 c4 10             	add    $0x10,%esp
+  801a49:	85 c0                	test   %eax,%eax
+  801a4b:	78 34                	js     801a81 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801a4d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a50:	83 ec 08             	sub    $0x8,%esp
+  801a53:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a56:	50                   	push   %eax
+  801a57:	ff 36                	push   (%esi)
+  801a59:	e8 44 fc ff ff       	call   8016a2 <dev_lookup>
+  801a5e:	83 c4 10             	add    $0x10,%esp
+  801a61:	85 c0                	test   %eax,%eax
+  801a63:	78 1c                	js     801a81 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801a65:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801a69:	74 1d                	je     801a88 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801a6b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a6e:	8b 40 18             	mov    0x18(%eax),%eax
+  801a71:	85 c0                	test   %eax,%eax
+  801a73:	74 34                	je     801aa9 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801a75:	83 ec 08             	sub    $0x8,%esp
+  801a78:	ff 75 0c             	push   0xc(%ebp)
+  801a7b:	56                   	push   %esi
+  801a7c:	ff d0                	call   *%eax
+  801a7e:	83 c4 10             	add    $0x10,%esp
+}
+  801a81:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a84:	5b                   	pop    %ebx
+  801a85:	5e                   	pop    %esi
+  801a86:	5d                   	pop    %ebp
+  801a87:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801a88:	a1 1c 50 80 00       	mov    0x80501c,%eax
+  801a8d:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801a90:	83 ec 04             	sub    $0x4,%esp
+  801a93:	53                   	push   %ebx
+  801a94:	50                   	push   %eax
+  801a95:	68 10 35 80 00       	push   $0x803510
+  801a9a:	e8 be ee ff ff       	call   80095d <cprintf>
+		return -E_INVAL;
+  801a9f:	83 c4 10             	add    $0x10,%esp
+  801aa2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801aa7:	eb d8                	jmp    801a81 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801aa9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801aae:	eb d1                	jmp    801a81 <ftruncate+0x50>
+
+00801ab0 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801ab0:	55                   	push   %ebp
+  801ab1:	89 e5                	mov    %esp,%ebp
+  801ab3:	56                   	push   %esi
+  801ab4:	53                   	push   %ebx
+  801ab5:	83 ec 18             	sub    $0x18,%esp
+  801ab8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801abb:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801abe:	50                   	push   %eax
+  801abf:	ff 75 08             	push   0x8(%ebp)
+  801ac2:	e8 8b fb ff ff       	call   801652 <fd_lookup>
+  801ac7:	83 c4 10             	add    $0x10,%esp
+  801aca:	85 c0                	test   %eax,%eax
+  801acc:	78 49                	js     801b17 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801ace:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801ad1:	83 ec 08             	sub    $0x8,%esp
+  801ad4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ad7:	50                   	push   %eax
+  801ad8:	ff 36                	push   (%esi)
+  801ada:	e8 c3 fb ff ff       	call   8016a2 <dev_lookup>
+  801adf:	83 c4 10             	add    $0x10,%esp
+  801ae2:	85 c0                	test   %eax,%eax
+  801ae4:	78 31                	js     801b17 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801ae6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ae9:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801aed:	74 2f                	je     801b1e <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801aef:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801af2:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801af9:	00 00 00 
+	stat->st_isdir = 0;
+  801afc:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801b03:	00 00 00 
+	stat->st_dev = dev;
+  801b06:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801b0c:	83 ec 08             	sub    $0x8,%esp
+  801b0f:	53                   	push   %ebx
+  801b10:	56                   	push   %esi
+  801b11:	ff 50 14             	call   *0x14(%eax)
+  801b14:	83 c4 10             	add    $0x10,%esp
+}
+  801b17:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b1a:	5b                   	pop    %ebx
+  801b1b:	5e                   	pop    %esi
+  801b1c:	5d                   	pop    %ebp
+  801b1d:	c3                   	ret
+		return -E_NOT_SUPP;
+  801b1e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b23:	eb f2                	jmp    801b17 <fstat+0x67>
+
+00801b25 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801b25:	55                   	push   %ebp
+  801b26:	89 e5                	mov    %esp,%ebp
+  801b28:	56                   	push   %esi
+  801b29:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801b2a:	83 ec 08             	sub    $0x8,%esp
+  801b2d:	6a 00                	push   $0x0
+  801b2f:	ff 75 08             	push   0x8(%ebp)
+  801b32:	e8 e4 01 00 00       	call   801d1b <open>
+  801b37:	89 c3                	mov    %eax,%ebx
+  801b39:	83 c4 10             	add    $0x10,%esp
+  801b3c:	85 c0                	test   %eax,%eax
+  801b3e:	78 1b                	js     801b5b <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801b40:	83 ec 08             	sub    $0x8,%esp
+  801b43:	ff 75 0c             	push   0xc(%ebp)
+  801b46:	50                   	push   %eax
+  801b47:	e8 64 ff ff ff       	call   801ab0 <fstat>
+  801b4c:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801b4e:	89 1c 24             	mov    %ebx,(%esp)
+  801b51:	e8 26 fc ff ff       	call   80177c <close>
+	return r;
+  801b56:	83 c4 10             	add    $0x10,%esp
+  801b59:	89 f3                	mov    %esi,%ebx
+}
+  801b5b:	89 d8                	mov    %ebx,%eax
+  801b5d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b60:	5b                   	pop    %ebx
+  801b61:	5e                   	pop    %esi
+  801b62:	5d                   	pop    %ebp
+  801b63:	c3                   	ret
+
+00801b64 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  801b64:	55                   	push   %ebp
+  801b65:	89 e5                	mov    %esp,%ebp
+  801b67:	56                   	push   %esi
+  801b68:	53                   	push   %ebx
+  801b69:	89 c6                	mov    %eax,%esi
+  801b6b:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  801b6d:	83 3d 10 50 80 00 00 	cmpl   $0x0,0x805010
+  801b74:	74 27                	je     801b9d <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801b76:	6a 07                	push   $0x7
+  801b78:	68 00 60 80 00       	push   $0x806000
+  801b7d:	56                   	push   %esi
+  801b7e:	ff 35 10 50 80 00    	push   0x805010
+  801b84:	e8 4d 0e 00 00       	call   8029d6 <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  801b89:	83 c4 0c             	add    $0xc,%esp
+  801b8c:	6a 00                	push   $0x0
+  801b8e:	53                   	push   %ebx
+  801b8f:	6a 00                	push   $0x0
+  801b91:	e8 cc 0d 00 00       	call   802962 <ipc_recv>
+}
+  801b96:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b99:	5b                   	pop    %ebx
+  801b9a:	5e                   	pop    %esi
+  801b9b:	5d                   	pop    %ebp
+  801b9c:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  801b9d:	83 ec 0c             	sub    $0xc,%esp
+  801ba0:	6a 01                	push   $0x1
+  801ba2:	e8 83 0e 00 00       	call   802a2a <ipc_find_env>
+  801ba7:	a3 10 50 80 00       	mov    %eax,0x805010
+  801bac:	83 c4 10             	add    $0x10,%esp
+  801baf:	eb c5                	jmp    801b76 <fsipc+0x12>
+
+00801bb1 <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801bb1:	55                   	push   %ebp
+  801bb2:	89 e5                	mov    %esp,%ebp
+  801bb4:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801bb7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bba:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bbd:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.set_size.req_size = newsize;
+  801bc2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801bc5:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801bca:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bcf:	b8 02 00 00 00       	mov    $0x2,%eax
+  801bd4:	e8 8b ff ff ff       	call   801b64 <fsipc>
+}
+  801bd9:	c9                   	leave
+  801bda:	c3                   	ret
+
+00801bdb <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801bdb:	55                   	push   %ebp
+  801bdc:	89 e5                	mov    %esp,%ebp
+  801bde:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801be1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801be4:	8b 40 0c             	mov    0xc(%eax),%eax
+  801be7:	a3 00 60 80 00       	mov    %eax,0x806000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801bec:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bf1:	b8 06 00 00 00       	mov    $0x6,%eax
+  801bf6:	e8 69 ff ff ff       	call   801b64 <fsipc>
+}
+  801bfb:	c9                   	leave
+  801bfc:	c3                   	ret
+
+00801bfd <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801bfd:	55                   	push   %ebp
+  801bfe:	89 e5                	mov    %esp,%ebp
+  801c00:	53                   	push   %ebx
+  801c01:	83 ec 04             	sub    $0x4,%esp
+  801c04:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801c07:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c0a:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c0d:	a3 00 60 80 00       	mov    %eax,0x806000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801c12:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c17:	b8 05 00 00 00       	mov    $0x5,%eax
+  801c1c:	e8 43 ff ff ff       	call   801b64 <fsipc>
+  801c21:	85 c0                	test   %eax,%eax
+  801c23:	78 2c                	js     801c51 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801c25:	83 ec 08             	sub    $0x8,%esp
+  801c28:	68 00 60 80 00       	push   $0x806000
+  801c2d:	53                   	push   %ebx
+  801c2e:	e8 e3 f2 ff ff       	call   800f16 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801c33:	a1 80 60 80 00       	mov    0x806080,%eax
+  801c38:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801c3e:	a1 84 60 80 00       	mov    0x806084,%eax
+  801c43:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801c49:	83 c4 10             	add    $0x10,%esp
+  801c4c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c51:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c54:	c9                   	leave
+  801c55:	c3                   	ret
+
+00801c56 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801c56:	55                   	push   %ebp
+  801c57:	89 e5                	mov    %esp,%ebp
+  801c59:	83 ec 0c             	sub    $0xc,%esp
+  801c5c:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801c5f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c62:	8b 52 0c             	mov    0xc(%edx),%edx
+  801c65:	89 15 00 60 80 00    	mov    %edx,0x806000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801c6b:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801c70:	39 d0                	cmp    %edx,%eax
+  801c72:	0f 47 c2             	cmova  %edx,%eax
+  801c75:	a3 04 60 80 00       	mov    %eax,0x806004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  801c7a:	50                   	push   %eax
+  801c7b:	ff 75 0c             	push   0xc(%ebp)
+  801c7e:	68 08 60 80 00       	push   $0x806008
+  801c83:	e8 14 f4 ff ff       	call   80109c <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801c88:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c8d:	b8 04 00 00 00       	mov    $0x4,%eax
+  801c92:	e8 cd fe ff ff       	call   801b64 <fsipc>
+}
+  801c97:	c9                   	leave
+  801c98:	c3                   	ret
+
+00801c99 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801c99:	55                   	push   %ebp
+  801c9a:	89 e5                	mov    %esp,%ebp
+  801c9c:	56                   	push   %esi
+  801c9d:	53                   	push   %ebx
+  801c9e:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801ca1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ca4:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ca7:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read.req_n = n;
+  801cac:	89 35 04 60 80 00    	mov    %esi,0x806004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801cb2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cb7:	b8 03 00 00 00       	mov    $0x3,%eax
+  801cbc:	e8 a3 fe ff ff       	call   801b64 <fsipc>
+  801cc1:	89 c3                	mov    %eax,%ebx
+  801cc3:	85 c0                	test   %eax,%eax
+  801cc5:	78 1f                	js     801ce6 <devfile_read+0x4d>
+  assert(r <= n);
+  801cc7:	39 c6                	cmp    %eax,%esi
+  801cc9:	72 24                	jb     801cef <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  801ccb:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801cd0:	7f 33                	jg     801d05 <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801cd2:	83 ec 04             	sub    $0x4,%esp
+  801cd5:	50                   	push   %eax
+  801cd6:	68 00 60 80 00       	push   $0x806000
+  801cdb:	ff 75 0c             	push   0xc(%ebp)
+  801cde:	e8 b9 f3 ff ff       	call   80109c <memmove>
+  return r;
+  801ce3:	83 c4 10             	add    $0x10,%esp
+}
+  801ce6:	89 d8                	mov    %ebx,%eax
+  801ce8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ceb:	5b                   	pop    %ebx
+  801cec:	5e                   	pop    %esi
+  801ced:	5d                   	pop    %ebp
+  801cee:	c3                   	ret
+  assert(r <= n);
+  801cef:	68 80 35 80 00       	push   $0x803580
+  801cf4:	68 87 35 80 00       	push   $0x803587
+  801cf9:	6a 78                	push   $0x78
+  801cfb:	68 9c 35 80 00       	push   $0x80359c
+  801d00:	e8 7d eb ff ff       	call   800882 <_panic>
+  assert(r <= PGSIZE);
+  801d05:	68 a7 35 80 00       	push   $0x8035a7
+  801d0a:	68 87 35 80 00       	push   $0x803587
+  801d0f:	6a 79                	push   $0x79
+  801d11:	68 9c 35 80 00       	push   $0x80359c
+  801d16:	e8 67 eb ff ff       	call   800882 <_panic>
+
+00801d1b <open>:
+open(const char *path, int mode) {
+  801d1b:	55                   	push   %ebp
+  801d1c:	89 e5                	mov    %esp,%ebp
+  801d1e:	56                   	push   %esi
+  801d1f:	53                   	push   %ebx
+  801d20:	83 ec 1c             	sub    $0x1c,%esp
+  801d23:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801d26:	56                   	push   %esi
+  801d27:	e8 af f1 ff ff       	call   800edb <strlen>
+  801d2c:	83 c4 10             	add    $0x10,%esp
+  801d2f:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801d34:	7f 6c                	jg     801da2 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801d36:	83 ec 0c             	sub    $0xc,%esp
+  801d39:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d3c:	50                   	push   %eax
+  801d3d:	e8 ba f8 ff ff       	call   8015fc <fd_alloc>
+  801d42:	89 c3                	mov    %eax,%ebx
+  801d44:	83 c4 10             	add    $0x10,%esp
+  801d47:	85 c0                	test   %eax,%eax
+  801d49:	78 3c                	js     801d87 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801d4b:	83 ec 08             	sub    $0x8,%esp
+  801d4e:	56                   	push   %esi
+  801d4f:	68 00 60 80 00       	push   $0x806000
+  801d54:	e8 bd f1 ff ff       	call   800f16 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801d59:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d5c:	a3 00 64 80 00       	mov    %eax,0x806400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801d61:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801d64:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d69:	e8 f6 fd ff ff       	call   801b64 <fsipc>
+  801d6e:	89 c3                	mov    %eax,%ebx
+  801d70:	83 c4 10             	add    $0x10,%esp
+  801d73:	85 c0                	test   %eax,%eax
+  801d75:	78 19                	js     801d90 <open+0x75>
+  return fd2num(fd);
+  801d77:	83 ec 0c             	sub    $0xc,%esp
+  801d7a:	ff 75 f4             	push   -0xc(%ebp)
+  801d7d:	e8 53 f8 ff ff       	call   8015d5 <fd2num>
+  801d82:	89 c3                	mov    %eax,%ebx
+  801d84:	83 c4 10             	add    $0x10,%esp
+}
+  801d87:	89 d8                	mov    %ebx,%eax
+  801d89:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d8c:	5b                   	pop    %ebx
+  801d8d:	5e                   	pop    %esi
+  801d8e:	5d                   	pop    %ebp
+  801d8f:	c3                   	ret
+    fd_close(fd, 0);
+  801d90:	83 ec 08             	sub    $0x8,%esp
+  801d93:	6a 00                	push   $0x0
+  801d95:	ff 75 f4             	push   -0xc(%ebp)
+  801d98:	e8 58 f9 ff ff       	call   8016f5 <fd_close>
+    return r;
+  801d9d:	83 c4 10             	add    $0x10,%esp
+  801da0:	eb e5                	jmp    801d87 <open+0x6c>
+    return -E_BAD_PATH;
+  801da2:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801da7:	eb de                	jmp    801d87 <open+0x6c>
+
+00801da9 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  801da9:	55                   	push   %ebp
+  801daa:	89 e5                	mov    %esp,%ebp
+  801dac:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801daf:	ba 00 00 00 00       	mov    $0x0,%edx
+  801db4:	b8 08 00 00 00       	mov    $0x8,%eax
+  801db9:	e8 a6 fd ff ff       	call   801b64 <fsipc>
+}
+  801dbe:	c9                   	leave
+  801dbf:	c3                   	ret
+
+00801dc0 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801dc0:	55                   	push   %ebp
+  801dc1:	89 e5                	mov    %esp,%ebp
+  801dc3:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801dc6:	68 b3 35 80 00       	push   $0x8035b3
+  801dcb:	ff 75 0c             	push   0xc(%ebp)
+  801dce:	e8 43 f1 ff ff       	call   800f16 <strcpy>
+	return 0;
+}
+  801dd3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dd8:	c9                   	leave
+  801dd9:	c3                   	ret
+
+00801dda <devsock_close>:
+{
+  801dda:	55                   	push   %ebp
+  801ddb:	89 e5                	mov    %esp,%ebp
+  801ddd:	53                   	push   %ebx
+  801dde:	83 ec 10             	sub    $0x10,%esp
+  801de1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801de4:	53                   	push   %ebx
+  801de5:	e8 7f 0c 00 00       	call   802a69 <pageref>
+  801dea:	89 c2                	mov    %eax,%edx
+  801dec:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801def:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801df4:	83 fa 01             	cmp    $0x1,%edx
+  801df7:	74 05                	je     801dfe <devsock_close+0x24>
+}
+  801df9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801dfc:	c9                   	leave
+  801dfd:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801dfe:	83 ec 0c             	sub    $0xc,%esp
+  801e01:	ff 73 0c             	push   0xc(%ebx)
+  801e04:	e8 b7 02 00 00       	call   8020c0 <nsipc_close>
+  801e09:	83 c4 10             	add    $0x10,%esp
+  801e0c:	eb eb                	jmp    801df9 <devsock_close+0x1f>
+
+00801e0e <devsock_write>:
+{
+  801e0e:	55                   	push   %ebp
+  801e0f:	89 e5                	mov    %esp,%ebp
+  801e11:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801e14:	6a 00                	push   $0x0
+  801e16:	ff 75 10             	push   0x10(%ebp)
+  801e19:	ff 75 0c             	push   0xc(%ebp)
+  801e1c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e1f:	ff 70 0c             	push   0xc(%eax)
+  801e22:	e8 79 03 00 00       	call   8021a0 <nsipc_send>
+}
+  801e27:	c9                   	leave
+  801e28:	c3                   	ret
+
+00801e29 <devsock_read>:
+{
+  801e29:	55                   	push   %ebp
+  801e2a:	89 e5                	mov    %esp,%ebp
+  801e2c:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801e2f:	6a 00                	push   $0x0
+  801e31:	ff 75 10             	push   0x10(%ebp)
+  801e34:	ff 75 0c             	push   0xc(%ebp)
+  801e37:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e3a:	ff 70 0c             	push   0xc(%eax)
+  801e3d:	e8 ef 02 00 00       	call   802131 <nsipc_recv>
+}
+  801e42:	c9                   	leave
+  801e43:	c3                   	ret
+
+00801e44 <fd2sockid>:
+{
+  801e44:	55                   	push   %ebp
+  801e45:	89 e5                	mov    %esp,%ebp
+  801e47:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801e4a:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801e4d:	52                   	push   %edx
+  801e4e:	50                   	push   %eax
+  801e4f:	e8 fe f7 ff ff       	call   801652 <fd_lookup>
+  801e54:	83 c4 10             	add    $0x10,%esp
+  801e57:	85 c0                	test   %eax,%eax
+  801e59:	78 10                	js     801e6b <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801e5b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e5e:	8b 0d 40 40 80 00    	mov    0x804040,%ecx
+  801e64:	39 08                	cmp    %ecx,(%eax)
+  801e66:	75 05                	jne    801e6d <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801e68:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801e6b:	c9                   	leave
+  801e6c:	c3                   	ret
+		return -E_NOT_SUPP;
+  801e6d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e72:	eb f7                	jmp    801e6b <fd2sockid+0x27>
+
+00801e74 <alloc_sockfd>:
+{
+  801e74:	55                   	push   %ebp
+  801e75:	89 e5                	mov    %esp,%ebp
+  801e77:	56                   	push   %esi
+  801e78:	53                   	push   %ebx
+  801e79:	83 ec 1c             	sub    $0x1c,%esp
+  801e7c:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801e7e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e81:	50                   	push   %eax
+  801e82:	e8 75 f7 ff ff       	call   8015fc <fd_alloc>
+  801e87:	89 c3                	mov    %eax,%ebx
+  801e89:	83 c4 10             	add    $0x10,%esp
+  801e8c:	85 c0                	test   %eax,%eax
+  801e8e:	78 43                	js     801ed3 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801e90:	83 ec 04             	sub    $0x4,%esp
+  801e93:	68 07 04 00 00       	push   $0x407
+  801e98:	ff 75 f4             	push   -0xc(%ebp)
+  801e9b:	6a 00                	push   $0x0
+  801e9d:	e8 60 f4 ff ff       	call   801302 <sys_page_alloc>
+  801ea2:	89 c3                	mov    %eax,%ebx
+  801ea4:	83 c4 10             	add    $0x10,%esp
+  801ea7:	85 c0                	test   %eax,%eax
+  801ea9:	78 28                	js     801ed3 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801eab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801eae:	8b 15 40 40 80 00    	mov    0x804040,%edx
+  801eb4:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801eb6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801eb9:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801ec0:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801ec3:	83 ec 0c             	sub    $0xc,%esp
+  801ec6:	50                   	push   %eax
+  801ec7:	e8 09 f7 ff ff       	call   8015d5 <fd2num>
+  801ecc:	89 c3                	mov    %eax,%ebx
+  801ece:	83 c4 10             	add    $0x10,%esp
+  801ed1:	eb 0c                	jmp    801edf <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801ed3:	83 ec 0c             	sub    $0xc,%esp
+  801ed6:	56                   	push   %esi
+  801ed7:	e8 e4 01 00 00       	call   8020c0 <nsipc_close>
+		return r;
+  801edc:	83 c4 10             	add    $0x10,%esp
+}
+  801edf:	89 d8                	mov    %ebx,%eax
+  801ee1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ee4:	5b                   	pop    %ebx
+  801ee5:	5e                   	pop    %esi
+  801ee6:	5d                   	pop    %ebp
+  801ee7:	c3                   	ret
+
+00801ee8 <accept>:
+{
+  801ee8:	55                   	push   %ebp
+  801ee9:	89 e5                	mov    %esp,%ebp
+  801eeb:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801eee:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ef1:	e8 4e ff ff ff       	call   801e44 <fd2sockid>
+  801ef6:	85 c0                	test   %eax,%eax
+  801ef8:	78 1b                	js     801f15 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801efa:	83 ec 04             	sub    $0x4,%esp
+  801efd:	ff 75 10             	push   0x10(%ebp)
+  801f00:	ff 75 0c             	push   0xc(%ebp)
+  801f03:	50                   	push   %eax
+  801f04:	e8 0e 01 00 00       	call   802017 <nsipc_accept>
+  801f09:	83 c4 10             	add    $0x10,%esp
+  801f0c:	85 c0                	test   %eax,%eax
+  801f0e:	78 05                	js     801f15 <accept+0x2d>
+	return alloc_sockfd(r);
+  801f10:	e8 5f ff ff ff       	call   801e74 <alloc_sockfd>
+}
+  801f15:	c9                   	leave
+  801f16:	c3                   	ret
+
+00801f17 <bind>:
+{
+  801f17:	55                   	push   %ebp
+  801f18:	89 e5                	mov    %esp,%ebp
+  801f1a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801f1d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f20:	e8 1f ff ff ff       	call   801e44 <fd2sockid>
+  801f25:	85 c0                	test   %eax,%eax
+  801f27:	78 12                	js     801f3b <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801f29:	83 ec 04             	sub    $0x4,%esp
+  801f2c:	ff 75 10             	push   0x10(%ebp)
+  801f2f:	ff 75 0c             	push   0xc(%ebp)
+  801f32:	50                   	push   %eax
+  801f33:	e8 31 01 00 00       	call   802069 <nsipc_bind>
+  801f38:	83 c4 10             	add    $0x10,%esp
+}
+  801f3b:	c9                   	leave
+  801f3c:	c3                   	ret
+
+00801f3d <shutdown>:
+{
+  801f3d:	55                   	push   %ebp
+  801f3e:	89 e5                	mov    %esp,%ebp
+  801f40:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801f43:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f46:	e8 f9 fe ff ff       	call   801e44 <fd2sockid>
+  801f4b:	85 c0                	test   %eax,%eax
+  801f4d:	78 0f                	js     801f5e <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801f4f:	83 ec 08             	sub    $0x8,%esp
+  801f52:	ff 75 0c             	push   0xc(%ebp)
+  801f55:	50                   	push   %eax
+  801f56:	e8 43 01 00 00       	call   80209e <nsipc_shutdown>
+  801f5b:	83 c4 10             	add    $0x10,%esp
+}
+  801f5e:	c9                   	leave
+  801f5f:	c3                   	ret
+
+00801f60 <connect>:
+{
+  801f60:	55                   	push   %ebp
+  801f61:	89 e5                	mov    %esp,%ebp
+  801f63:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801f66:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f69:	e8 d6 fe ff ff       	call   801e44 <fd2sockid>
+  801f6e:	85 c0                	test   %eax,%eax
+  801f70:	78 12                	js     801f84 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801f72:	83 ec 04             	sub    $0x4,%esp
+  801f75:	ff 75 10             	push   0x10(%ebp)
+  801f78:	ff 75 0c             	push   0xc(%ebp)
+  801f7b:	50                   	push   %eax
+  801f7c:	e8 59 01 00 00       	call   8020da <nsipc_connect>
+  801f81:	83 c4 10             	add    $0x10,%esp
+}
+  801f84:	c9                   	leave
+  801f85:	c3                   	ret
+
+00801f86 <listen>:
+{
+  801f86:	55                   	push   %ebp
+  801f87:	89 e5                	mov    %esp,%ebp
+  801f89:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801f8c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f8f:	e8 b0 fe ff ff       	call   801e44 <fd2sockid>
+  801f94:	85 c0                	test   %eax,%eax
+  801f96:	78 0f                	js     801fa7 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801f98:	83 ec 08             	sub    $0x8,%esp
+  801f9b:	ff 75 0c             	push   0xc(%ebp)
+  801f9e:	50                   	push   %eax
+  801f9f:	e8 6b 01 00 00       	call   80210f <nsipc_listen>
+  801fa4:	83 c4 10             	add    $0x10,%esp
+}
+  801fa7:	c9                   	leave
+  801fa8:	c3                   	ret
+
+00801fa9 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801fa9:	55                   	push   %ebp
+  801faa:	89 e5                	mov    %esp,%ebp
+  801fac:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801faf:	ff 75 10             	push   0x10(%ebp)
+  801fb2:	ff 75 0c             	push   0xc(%ebp)
+  801fb5:	ff 75 08             	push   0x8(%ebp)
+  801fb8:	e8 41 02 00 00       	call   8021fe <nsipc_socket>
+  801fbd:	83 c4 10             	add    $0x10,%esp
+  801fc0:	85 c0                	test   %eax,%eax
+  801fc2:	78 05                	js     801fc9 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801fc4:	e8 ab fe ff ff       	call   801e74 <alloc_sockfd>
+}
+  801fc9:	c9                   	leave
+  801fca:	c3                   	ret
+
+00801fcb <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801fcb:	55                   	push   %ebp
+  801fcc:	89 e5                	mov    %esp,%ebp
+  801fce:	53                   	push   %ebx
+  801fcf:	83 ec 04             	sub    $0x4,%esp
+  801fd2:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801fd4:	83 3d 14 50 80 00 00 	cmpl   $0x0,0x805014
+  801fdb:	74 26                	je     802003 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801fdd:	6a 07                	push   $0x7
+  801fdf:	68 00 70 80 00       	push   $0x807000
+  801fe4:	53                   	push   %ebx
+  801fe5:	ff 35 14 50 80 00    	push   0x805014
+  801feb:	e8 e6 09 00 00       	call   8029d6 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801ff0:	83 c4 0c             	add    $0xc,%esp
+  801ff3:	6a 00                	push   $0x0
+  801ff5:	6a 00                	push   $0x0
+  801ff7:	6a 00                	push   $0x0
+  801ff9:	e8 64 09 00 00       	call   802962 <ipc_recv>
+}
+  801ffe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802001:	c9                   	leave
+  802002:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802003:	83 ec 0c             	sub    $0xc,%esp
+  802006:	6a 02                	push   $0x2
+  802008:	e8 1d 0a 00 00       	call   802a2a <ipc_find_env>
+  80200d:	a3 14 50 80 00       	mov    %eax,0x805014
+  802012:	83 c4 10             	add    $0x10,%esp
+  802015:	eb c6                	jmp    801fdd <nsipc+0x12>
+
+00802017 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802017:	55                   	push   %ebp
+  802018:	89 e5                	mov    %esp,%ebp
+  80201a:	56                   	push   %esi
+  80201b:	53                   	push   %ebx
+  80201c:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  80201f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802022:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802027:	8b 06                	mov    (%esi),%eax
+  802029:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  80202e:	b8 01 00 00 00       	mov    $0x1,%eax
+  802033:	e8 93 ff ff ff       	call   801fcb <nsipc>
+  802038:	89 c3                	mov    %eax,%ebx
+  80203a:	85 c0                	test   %eax,%eax
+  80203c:	79 09                	jns    802047 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  80203e:	89 d8                	mov    %ebx,%eax
+  802040:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802043:	5b                   	pop    %ebx
+  802044:	5e                   	pop    %esi
+  802045:	5d                   	pop    %ebp
+  802046:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802047:	83 ec 04             	sub    $0x4,%esp
+  80204a:	ff 35 10 70 80 00    	push   0x807010
+  802050:	68 00 70 80 00       	push   $0x807000
+  802055:	ff 75 0c             	push   0xc(%ebp)
+  802058:	e8 3f f0 ff ff       	call   80109c <memmove>
+		*addrlen = ret->ret_addrlen;
+  80205d:	a1 10 70 80 00       	mov    0x807010,%eax
+  802062:	89 06                	mov    %eax,(%esi)
+  802064:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802067:	eb d5                	jmp    80203e <nsipc_accept+0x27>
+
+00802069 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802069:	55                   	push   %ebp
+  80206a:	89 e5                	mov    %esp,%ebp
+  80206c:	53                   	push   %ebx
+  80206d:	83 ec 08             	sub    $0x8,%esp
+  802070:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802073:	8b 45 08             	mov    0x8(%ebp),%eax
+  802076:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  80207b:	53                   	push   %ebx
+  80207c:	ff 75 0c             	push   0xc(%ebp)
+  80207f:	68 04 70 80 00       	push   $0x807004
+  802084:	e8 13 f0 ff ff       	call   80109c <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802089:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  80208f:	b8 02 00 00 00       	mov    $0x2,%eax
+  802094:	e8 32 ff ff ff       	call   801fcb <nsipc>
+}
+  802099:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80209c:	c9                   	leave
+  80209d:	c3                   	ret
+
+0080209e <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  80209e:	55                   	push   %ebp
+  80209f:	89 e5                	mov    %esp,%ebp
+  8020a1:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8020a4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020a7:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  8020ac:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020af:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  8020b4:	b8 03 00 00 00       	mov    $0x3,%eax
+  8020b9:	e8 0d ff ff ff       	call   801fcb <nsipc>
+}
+  8020be:	c9                   	leave
+  8020bf:	c3                   	ret
+
+008020c0 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8020c0:	55                   	push   %ebp
+  8020c1:	89 e5                	mov    %esp,%ebp
+  8020c3:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8020c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020c9:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  8020ce:	b8 04 00 00 00       	mov    $0x4,%eax
+  8020d3:	e8 f3 fe ff ff       	call   801fcb <nsipc>
+}
+  8020d8:	c9                   	leave
+  8020d9:	c3                   	ret
+
+008020da <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8020da:	55                   	push   %ebp
+  8020db:	89 e5                	mov    %esp,%ebp
+  8020dd:	53                   	push   %ebx
+  8020de:	83 ec 08             	sub    $0x8,%esp
+  8020e1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8020e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020e7:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8020ec:	53                   	push   %ebx
+  8020ed:	ff 75 0c             	push   0xc(%ebp)
+  8020f0:	68 04 70 80 00       	push   $0x807004
+  8020f5:	e8 a2 ef ff ff       	call   80109c <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8020fa:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  802100:	b8 05 00 00 00       	mov    $0x5,%eax
+  802105:	e8 c1 fe ff ff       	call   801fcb <nsipc>
+}
+  80210a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80210d:	c9                   	leave
+  80210e:	c3                   	ret
+
+0080210f <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  80210f:	55                   	push   %ebp
+  802110:	89 e5                	mov    %esp,%ebp
+  802112:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802115:	8b 45 08             	mov    0x8(%ebp),%eax
+  802118:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  80211d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802120:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  802125:	b8 06 00 00 00       	mov    $0x6,%eax
+  80212a:	e8 9c fe ff ff       	call   801fcb <nsipc>
+}
+  80212f:	c9                   	leave
+  802130:	c3                   	ret
+
+00802131 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802131:	55                   	push   %ebp
+  802132:	89 e5                	mov    %esp,%ebp
+  802134:	56                   	push   %esi
+  802135:	53                   	push   %ebx
+  802136:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802139:	8b 45 08             	mov    0x8(%ebp),%eax
+  80213c:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  802141:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  802147:	8b 45 14             	mov    0x14(%ebp),%eax
+  80214a:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  80214f:	b8 07 00 00 00       	mov    $0x7,%eax
+  802154:	e8 72 fe ff ff       	call   801fcb <nsipc>
+  802159:	89 c3                	mov    %eax,%ebx
+  80215b:	85 c0                	test   %eax,%eax
+  80215d:	78 22                	js     802181 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  80215f:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802164:	39 c6                	cmp    %eax,%esi
+  802166:	0f 4e c6             	cmovle %esi,%eax
+  802169:	39 c3                	cmp    %eax,%ebx
+  80216b:	7f 1d                	jg     80218a <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  80216d:	83 ec 04             	sub    $0x4,%esp
+  802170:	53                   	push   %ebx
+  802171:	68 00 70 80 00       	push   $0x807000
+  802176:	ff 75 0c             	push   0xc(%ebp)
+  802179:	e8 1e ef ff ff       	call   80109c <memmove>
+  80217e:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802181:	89 d8                	mov    %ebx,%eax
+  802183:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802186:	5b                   	pop    %ebx
+  802187:	5e                   	pop    %esi
+  802188:	5d                   	pop    %ebp
+  802189:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  80218a:	68 bf 35 80 00       	push   $0x8035bf
+  80218f:	68 87 35 80 00       	push   $0x803587
+  802194:	6a 62                	push   $0x62
+  802196:	68 d4 35 80 00       	push   $0x8035d4
+  80219b:	e8 e2 e6 ff ff       	call   800882 <_panic>
+
+008021a0 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8021a0:	55                   	push   %ebp
+  8021a1:	89 e5                	mov    %esp,%ebp
+  8021a3:	53                   	push   %ebx
+  8021a4:	83 ec 04             	sub    $0x4,%esp
+  8021a7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8021aa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021ad:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  8021b2:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8021b8:	7f 2e                	jg     8021e8 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8021ba:	83 ec 04             	sub    $0x4,%esp
+  8021bd:	53                   	push   %ebx
+  8021be:	ff 75 0c             	push   0xc(%ebp)
+  8021c1:	68 0c 70 80 00       	push   $0x80700c
+  8021c6:	e8 d1 ee ff ff       	call   80109c <memmove>
+	nsipcbuf.send.req_size = size;
+  8021cb:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  8021d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8021d4:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  8021d9:	b8 08 00 00 00       	mov    $0x8,%eax
+  8021de:	e8 e8 fd ff ff       	call   801fcb <nsipc>
+}
+  8021e3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021e6:	c9                   	leave
+  8021e7:	c3                   	ret
+	assert(size < 1600);
+  8021e8:	68 e0 35 80 00       	push   $0x8035e0
+  8021ed:	68 87 35 80 00       	push   $0x803587
+  8021f2:	6a 6d                	push   $0x6d
+  8021f4:	68 d4 35 80 00       	push   $0x8035d4
+  8021f9:	e8 84 e6 ff ff       	call   800882 <_panic>
+
+008021fe <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8021fe:	55                   	push   %ebp
+  8021ff:	89 e5                	mov    %esp,%ebp
+  802201:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802204:	8b 45 08             	mov    0x8(%ebp),%eax
+  802207:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  80220c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80220f:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  802214:	8b 45 10             	mov    0x10(%ebp),%eax
+  802217:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  80221c:	b8 09 00 00 00       	mov    $0x9,%eax
+  802221:	e8 a5 fd ff ff       	call   801fcb <nsipc>
+}
+  802226:	c9                   	leave
+  802227:	c3                   	ret
+
+00802228 <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  802228:	55                   	push   %ebp
+  802229:	89 e5                	mov    %esp,%ebp
+  80222b:	53                   	push   %ebx
+  80222c:	83 ec 04             	sub    $0x4,%esp
+  80222f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint8_t *c;
+	uint32_t *ref;
+
+	if (v == 0)
+  802232:	85 db                	test   %ebx,%ebx
+  802234:	0f 84 85 00 00 00    	je     8022bf <free+0x97>
+		return;
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  80223a:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802240:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802245:	77 51                	ja     802298 <free+0x70>
+
+	c = ROUNDDOWN(v, PGSIZE);
+  802247:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  80224d:	89 d8                	mov    %ebx,%eax
+  80224f:	c1 e8 0c             	shr    $0xc,%eax
+  802252:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802259:	f6 c4 02             	test   $0x2,%ah
+  80225c:	74 50                	je     8022ae <free+0x86>
+		sys_page_unmap(0, c);
+  80225e:	83 ec 08             	sub    $0x8,%esp
+  802261:	53                   	push   %ebx
+  802262:	6a 00                	push   $0x0
+  802264:	e8 1e f1 ff ff       	call   801387 <sys_page_unmap>
+		c += PGSIZE;
+  802269:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  80226f:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802275:	83 c4 10             	add    $0x10,%esp
+  802278:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  80227d:	76 ce                	jbe    80224d <free+0x25>
+  80227f:	68 27 36 80 00       	push   $0x803627
+  802284:	68 87 35 80 00       	push   $0x803587
+  802289:	68 81 00 00 00       	push   $0x81
+  80228e:	68 1a 36 80 00       	push   $0x80361a
+  802293:	e8 ea e5 ff ff       	call   800882 <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802298:	68 ec 35 80 00       	push   $0x8035ec
+  80229d:	68 87 35 80 00       	push   $0x803587
+  8022a2:	6a 7a                	push   $0x7a
+  8022a4:	68 1a 36 80 00       	push   $0x80361a
+  8022a9:	e8 d4 e5 ff ff       	call   800882 <_panic>
+	/*
+	 * c is just a piece of this page, so dec the ref count
+	 * and maybe free the page.
+	 */
+	ref = (uint32_t*) (c + PGSIZE - 4);
+	if (--(*ref) == 0)
+  8022ae:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  8022b4:	83 e8 01             	sub    $0x1,%eax
+  8022b7:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  8022bd:	74 05                	je     8022c4 <free+0x9c>
+		sys_page_unmap(0, c);
+}
+  8022bf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022c2:	c9                   	leave
+  8022c3:	c3                   	ret
+		sys_page_unmap(0, c);
+  8022c4:	83 ec 08             	sub    $0x8,%esp
+  8022c7:	53                   	push   %ebx
+  8022c8:	6a 00                	push   $0x0
+  8022ca:	e8 b8 f0 ff ff       	call   801387 <sys_page_unmap>
+  8022cf:	83 c4 10             	add    $0x10,%esp
+  8022d2:	eb eb                	jmp    8022bf <free+0x97>
+
+008022d4 <malloc>:
+{
+  8022d4:	55                   	push   %ebp
+  8022d5:	89 e5                	mov    %esp,%ebp
+  8022d7:	57                   	push   %edi
+  8022d8:	56                   	push   %esi
+  8022d9:	53                   	push   %ebx
+  8022da:	83 ec 1c             	sub    $0x1c,%esp
+	if (mptr == 0)
+  8022dd:	a1 18 50 80 00       	mov    0x805018,%eax
+  8022e2:	85 c0                	test   %eax,%eax
+  8022e4:	74 6c                	je     802352 <malloc+0x7e>
+	n = ROUNDUP(n, 4);
+  8022e6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8022e9:	8d 57 03             	lea    0x3(%edi),%edx
+  8022ec:	89 d6                	mov    %edx,%esi
+  8022ee:	83 e6 fc             	and    $0xfffffffc,%esi
+	if (n >= MAXMALLOC)
+  8022f1:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  8022f7:	0f 87 55 01 00 00    	ja     802452 <malloc+0x17e>
+	if ((uintptr_t) mptr % PGSIZE){
+  8022fd:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  802302:	74 30                	je     802334 <malloc+0x60>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  802304:	89 c3                	mov    %eax,%ebx
+  802306:	c1 eb 0c             	shr    $0xc,%ebx
+  802309:	8d 54 30 03          	lea    0x3(%eax,%esi,1),%edx
+  80230d:	c1 ea 0c             	shr    $0xc,%edx
+  802310:	39 d3                	cmp    %edx,%ebx
+  802312:	74 60                	je     802374 <malloc+0xa0>
+		free(mptr);	/* drop reference to this page */
+  802314:	83 ec 0c             	sub    $0xc,%esp
+  802317:	50                   	push   %eax
+  802318:	e8 0b ff ff ff       	call   802228 <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  80231d:	a1 18 50 80 00       	mov    0x805018,%eax
+  802322:	05 00 10 00 00       	add    $0x1000,%eax
+  802327:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80232c:	a3 18 50 80 00       	mov    %eax,0x805018
+  802331:	83 c4 10             	add    $0x10,%esp
+  802334:	8b 0d 18 50 80 00    	mov    0x805018,%ecx
+{
+  80233a:	ba 02 00 00 00       	mov    $0x2,%edx
+  80233f:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  802343:	8d 7e 04             	lea    0x4(%esi),%edi
+  802346:	89 cb                	mov    %ecx,%ebx
+  802348:	01 f9                	add    %edi,%ecx
+  80234a:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  80234d:	e9 8e 00 00 00       	jmp    8023e0 <malloc+0x10c>
+		mptr = mbegin;
+  802352:	c7 05 18 50 80 00 00 	movl   $0x8000000,0x805018
+  802359:	00 00 08 
+	n = ROUNDUP(n, 4);
+  80235c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80235f:	8d 57 03             	lea    0x3(%edi),%edx
+  802362:	89 d6                	mov    %edx,%esi
+  802364:	83 e6 fc             	and    $0xfffffffc,%esi
+	if (n >= MAXMALLOC)
+  802367:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  80236d:	76 c5                	jbe    802334 <malloc+0x60>
+  80236f:	e9 d6 00 00 00       	jmp    80244a <malloc+0x176>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  802374:	8d 90 ff 0f 00 00    	lea    0xfff(%eax),%edx
+  80237a:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+			(*ref)++;
+  802380:	83 42 fc 01          	addl   $0x1,-0x4(%edx)
+			mptr += n;
+  802384:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  802387:	89 15 18 50 80 00    	mov    %edx,0x805018
+			return v;
+  80238d:	e9 b8 00 00 00       	jmp    80244a <malloc+0x176>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  802392:	05 00 10 00 00       	add    $0x1000,%eax
+  802397:	39 c8                	cmp    %ecx,%eax
+  802399:	0f 83 ba 00 00 00    	jae    802459 <malloc+0x185>
+		if (va >= (uintptr_t) mend
+  80239f:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  8023a4:	77 22                	ja     8023c8 <malloc+0xf4>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  8023a6:	89 c2                	mov    %eax,%edx
+  8023a8:	c1 ea 16             	shr    $0x16,%edx
+  8023ab:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8023b2:	f6 c2 01             	test   $0x1,%dl
+  8023b5:	74 db                	je     802392 <malloc+0xbe>
+  8023b7:	89 c2                	mov    %eax,%edx
+  8023b9:	c1 ea 0c             	shr    $0xc,%edx
+  8023bc:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8023c3:	f6 c2 01             	test   $0x1,%dl
+  8023c6:	74 ca                	je     802392 <malloc+0xbe>
+		if (mptr == mend) {
+  8023c8:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8023ce:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  8023d4:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  8023d8:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  8023de:	74 04                	je     8023e4 <malloc+0x110>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  8023e0:	89 d8                	mov    %ebx,%eax
+  8023e2:	eb b3                	jmp    802397 <malloc+0xc3>
+  8023e4:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  8023e7:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  8023ec:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  8023f0:	83 ea 01             	sub    $0x1,%edx
+  8023f3:	0f 85 4d ff ff ff    	jne    802346 <malloc+0x72>
+  8023f9:	c7 05 18 50 80 00 00 	movl   $0x8000000,0x805018
+  802400:	00 00 08 
+				return 0;	/* out of address space */
+  802403:	b8 00 00 00 00       	mov    $0x0,%eax
+  802408:	eb 40                	jmp    80244a <malloc+0x176>
+				sys_page_unmap(0, mptr + i);
+  80240a:	83 ec 08             	sub    $0x8,%esp
+  80240d:	89 d8                	mov    %ebx,%eax
+  80240f:	03 05 18 50 80 00    	add    0x805018,%eax
+  802415:	50                   	push   %eax
+  802416:	6a 00                	push   $0x0
+  802418:	e8 6a ef ff ff       	call   801387 <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  80241d:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  802423:	83 c4 10             	add    $0x10,%esp
+  802426:	85 db                	test   %ebx,%ebx
+  802428:	79 e0                	jns    80240a <malloc+0x136>
+			return 0;	/* out of physical memory */
+  80242a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80242f:	eb 19                	jmp    80244a <malloc+0x176>
+	ref = (uint32_t*) (mptr + i - 4);
+  802431:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802434:	a1 18 50 80 00       	mov    0x805018,%eax
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  802439:	c7 44 18 fc 02 00 00 	movl   $0x2,-0x4(%eax,%ebx,1)
+  802440:	00 
+	mptr += n;
+  802441:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  802444:	89 15 18 50 80 00    	mov    %edx,0x805018
+}
+  80244a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80244d:	5b                   	pop    %ebx
+  80244e:	5e                   	pop    %esi
+  80244f:	5f                   	pop    %edi
+  802450:	5d                   	pop    %ebp
+  802451:	c3                   	ret
+		return 0;
+  802452:	b8 00 00 00 00       	mov    $0x0,%eax
+  802457:	eb f1                	jmp    80244a <malloc+0x176>
+  802459:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  80245d:	74 06                	je     802465 <malloc+0x191>
+  80245f:	89 1d 18 50 80 00    	mov    %ebx,0x805018
+	for (i = 0; i < n + 4; i += PGSIZE){
+  802465:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80246a:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  80246d:	39 fb                	cmp    %edi,%ebx
+  80246f:	73 c0                	jae    802431 <malloc+0x15d>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  802471:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  802477:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  80247a:	39 fe                	cmp    %edi,%esi
+  80247c:	0f 92 c0             	setb   %al
+  80247f:	0f b6 c0             	movzbl %al,%eax
+  802482:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  802485:	83 c8 07             	or     $0x7,%eax
+  802488:	50                   	push   %eax
+  802489:	89 d8                	mov    %ebx,%eax
+  80248b:	03 05 18 50 80 00    	add    0x805018,%eax
+  802491:	50                   	push   %eax
+  802492:	6a 00                	push   $0x0
+  802494:	e8 69 ee ff ff       	call   801302 <sys_page_alloc>
+  802499:	83 c4 10             	add    $0x10,%esp
+  80249c:	85 c0                	test   %eax,%eax
+  80249e:	78 86                	js     802426 <malloc+0x152>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  8024a0:	89 f3                	mov    %esi,%ebx
+  8024a2:	eb c9                	jmp    80246d <malloc+0x199>
+
+008024a4 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8024a4:	55                   	push   %ebp
+  8024a5:	89 e5                	mov    %esp,%ebp
+  8024a7:	56                   	push   %esi
+  8024a8:	53                   	push   %ebx
+  8024a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8024ac:	83 ec 0c             	sub    $0xc,%esp
+  8024af:	ff 75 08             	push   0x8(%ebp)
+  8024b2:	e8 2e f1 ff ff       	call   8015e5 <fd2data>
+  8024b7:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8024b9:	83 c4 08             	add    $0x8,%esp
+  8024bc:	68 3f 36 80 00       	push   $0x80363f
+  8024c1:	53                   	push   %ebx
+  8024c2:	e8 4f ea ff ff       	call   800f16 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8024c7:	8b 46 04             	mov    0x4(%esi),%eax
+  8024ca:	2b 06                	sub    (%esi),%eax
+  8024cc:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8024d2:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8024d9:	00 00 00 
+	stat->st_dev = &devpipe;
+  8024dc:	c7 83 88 00 00 00 5c 	movl   $0x80405c,0x88(%ebx)
+  8024e3:	40 80 00 
+	return 0;
+}
+  8024e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024eb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024ee:	5b                   	pop    %ebx
+  8024ef:	5e                   	pop    %esi
+  8024f0:	5d                   	pop    %ebp
+  8024f1:	c3                   	ret
+
+008024f2 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8024f2:	55                   	push   %ebp
+  8024f3:	89 e5                	mov    %esp,%ebp
+  8024f5:	53                   	push   %ebx
+  8024f6:	83 ec 0c             	sub    $0xc,%esp
+  8024f9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8024fc:	53                   	push   %ebx
+  8024fd:	6a 00                	push   $0x0
+  8024ff:	e8 83 ee ff ff       	call   801387 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802504:	89 1c 24             	mov    %ebx,(%esp)
+  802507:	e8 d9 f0 ff ff       	call   8015e5 <fd2data>
+  80250c:	83 c4 08             	add    $0x8,%esp
+  80250f:	50                   	push   %eax
+  802510:	6a 00                	push   $0x0
+  802512:	e8 70 ee ff ff       	call   801387 <sys_page_unmap>
+}
+  802517:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80251a:	c9                   	leave
+  80251b:	c3                   	ret
+
+0080251c <_pipeisclosed>:
+{
+  80251c:	55                   	push   %ebp
+  80251d:	89 e5                	mov    %esp,%ebp
+  80251f:	57                   	push   %edi
+  802520:	56                   	push   %esi
+  802521:	53                   	push   %ebx
+  802522:	83 ec 1c             	sub    $0x1c,%esp
+  802525:	89 c7                	mov    %eax,%edi
+  802527:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  802529:	a1 1c 50 80 00       	mov    0x80501c,%eax
+  80252e:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802531:	83 ec 0c             	sub    $0xc,%esp
+  802534:	57                   	push   %edi
+  802535:	e8 2f 05 00 00       	call   802a69 <pageref>
+  80253a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80253d:	89 34 24             	mov    %esi,(%esp)
+  802540:	e8 24 05 00 00       	call   802a69 <pageref>
+		nn = thisenv->env_runs;
+  802545:	8b 15 1c 50 80 00    	mov    0x80501c,%edx
+  80254b:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  80254e:	83 c4 10             	add    $0x10,%esp
+  802551:	39 cb                	cmp    %ecx,%ebx
+  802553:	74 1b                	je     802570 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802555:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802558:	75 cf                	jne    802529 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80255a:	8b 42 58             	mov    0x58(%edx),%eax
+  80255d:	6a 01                	push   $0x1
+  80255f:	50                   	push   %eax
+  802560:	53                   	push   %ebx
+  802561:	68 46 36 80 00       	push   $0x803646
+  802566:	e8 f2 e3 ff ff       	call   80095d <cprintf>
+  80256b:	83 c4 10             	add    $0x10,%esp
+  80256e:	eb b9                	jmp    802529 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802570:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802573:	0f 94 c0             	sete   %al
+  802576:	0f b6 c0             	movzbl %al,%eax
+}
+  802579:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80257c:	5b                   	pop    %ebx
+  80257d:	5e                   	pop    %esi
+  80257e:	5f                   	pop    %edi
+  80257f:	5d                   	pop    %ebp
+  802580:	c3                   	ret
+
+00802581 <devpipe_write>:
+{
+  802581:	55                   	push   %ebp
+  802582:	89 e5                	mov    %esp,%ebp
+  802584:	57                   	push   %edi
+  802585:	56                   	push   %esi
+  802586:	53                   	push   %ebx
+  802587:	83 ec 28             	sub    $0x28,%esp
+  80258a:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  80258d:	56                   	push   %esi
+  80258e:	e8 52 f0 ff ff       	call   8015e5 <fd2data>
+  802593:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802595:	83 c4 10             	add    $0x10,%esp
+  802598:	bf 00 00 00 00       	mov    $0x0,%edi
+  80259d:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8025a0:	75 09                	jne    8025ab <devpipe_write+0x2a>
+	return i;
+  8025a2:	89 f8                	mov    %edi,%eax
+  8025a4:	eb 23                	jmp    8025c9 <devpipe_write+0x48>
+			sys_yield();
+  8025a6:	e8 38 ed ff ff       	call   8012e3 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8025ab:	8b 43 04             	mov    0x4(%ebx),%eax
+  8025ae:	8b 0b                	mov    (%ebx),%ecx
+  8025b0:	8d 51 20             	lea    0x20(%ecx),%edx
+  8025b3:	39 d0                	cmp    %edx,%eax
+  8025b5:	72 1a                	jb     8025d1 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8025b7:	89 da                	mov    %ebx,%edx
+  8025b9:	89 f0                	mov    %esi,%eax
+  8025bb:	e8 5c ff ff ff       	call   80251c <_pipeisclosed>
+  8025c0:	85 c0                	test   %eax,%eax
+  8025c2:	74 e2                	je     8025a6 <devpipe_write+0x25>
+				return 0;
+  8025c4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025cc:	5b                   	pop    %ebx
+  8025cd:	5e                   	pop    %esi
+  8025ce:	5f                   	pop    %edi
+  8025cf:	5d                   	pop    %ebp
+  8025d0:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8025d1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8025d4:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8025d8:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8025db:	89 c2                	mov    %eax,%edx
+  8025dd:	c1 fa 1f             	sar    $0x1f,%edx
+  8025e0:	89 d1                	mov    %edx,%ecx
+  8025e2:	c1 e9 1b             	shr    $0x1b,%ecx
+  8025e5:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8025e8:	83 e2 1f             	and    $0x1f,%edx
+  8025eb:	29 ca                	sub    %ecx,%edx
+  8025ed:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8025f1:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8025f5:	83 c0 01             	add    $0x1,%eax
+  8025f8:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8025fb:	83 c7 01             	add    $0x1,%edi
+  8025fe:	eb 9d                	jmp    80259d <devpipe_write+0x1c>
+
+00802600 <devpipe_read>:
+{
+  802600:	55                   	push   %ebp
+  802601:	89 e5                	mov    %esp,%ebp
+  802603:	57                   	push   %edi
+  802604:	56                   	push   %esi
+  802605:	53                   	push   %ebx
+  802606:	83 ec 18             	sub    $0x18,%esp
+  802609:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  80260c:	57                   	push   %edi
+  80260d:	e8 d3 ef ff ff       	call   8015e5 <fd2data>
+  802612:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802614:	83 c4 10             	add    $0x10,%esp
+  802617:	be 00 00 00 00       	mov    $0x0,%esi
+  80261c:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80261f:	75 13                	jne    802634 <devpipe_read+0x34>
+	return i;
+  802621:	89 f0                	mov    %esi,%eax
+  802623:	eb 02                	jmp    802627 <devpipe_read+0x27>
+				return i;
+  802625:	89 f0                	mov    %esi,%eax
+}
+  802627:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80262a:	5b                   	pop    %ebx
+  80262b:	5e                   	pop    %esi
+  80262c:	5f                   	pop    %edi
+  80262d:	5d                   	pop    %ebp
+  80262e:	c3                   	ret
+			sys_yield();
+  80262f:	e8 af ec ff ff       	call   8012e3 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802634:	8b 03                	mov    (%ebx),%eax
+  802636:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802639:	75 18                	jne    802653 <devpipe_read+0x53>
+			if (i > 0)
+  80263b:	85 f6                	test   %esi,%esi
+  80263d:	75 e6                	jne    802625 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  80263f:	89 da                	mov    %ebx,%edx
+  802641:	89 f8                	mov    %edi,%eax
+  802643:	e8 d4 fe ff ff       	call   80251c <_pipeisclosed>
+  802648:	85 c0                	test   %eax,%eax
+  80264a:	74 e3                	je     80262f <devpipe_read+0x2f>
+				return 0;
+  80264c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802651:	eb d4                	jmp    802627 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802653:	99                   	cltd
+  802654:	c1 ea 1b             	shr    $0x1b,%edx
+  802657:	01 d0                	add    %edx,%eax
+  802659:	83 e0 1f             	and    $0x1f,%eax
+  80265c:	29 d0                	sub    %edx,%eax
+  80265e:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802663:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802666:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802669:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80266c:	83 c6 01             	add    $0x1,%esi
+  80266f:	eb ab                	jmp    80261c <devpipe_read+0x1c>
+
+00802671 <pipe>:
+{
+  802671:	55                   	push   %ebp
+  802672:	89 e5                	mov    %esp,%ebp
+  802674:	56                   	push   %esi
+  802675:	53                   	push   %ebx
+  802676:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802679:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80267c:	50                   	push   %eax
+  80267d:	e8 7a ef ff ff       	call   8015fc <fd_alloc>
+  802682:	89 c3                	mov    %eax,%ebx
+  802684:	83 c4 10             	add    $0x10,%esp
+  802687:	85 c0                	test   %eax,%eax
+  802689:	0f 88 23 01 00 00    	js     8027b2 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80268f:	83 ec 04             	sub    $0x4,%esp
+  802692:	68 07 04 00 00       	push   $0x407
+  802697:	ff 75 f4             	push   -0xc(%ebp)
+  80269a:	6a 00                	push   $0x0
+  80269c:	e8 61 ec ff ff       	call   801302 <sys_page_alloc>
+  8026a1:	89 c3                	mov    %eax,%ebx
+  8026a3:	83 c4 10             	add    $0x10,%esp
+  8026a6:	85 c0                	test   %eax,%eax
+  8026a8:	0f 88 04 01 00 00    	js     8027b2 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8026ae:	83 ec 0c             	sub    $0xc,%esp
+  8026b1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8026b4:	50                   	push   %eax
+  8026b5:	e8 42 ef ff ff       	call   8015fc <fd_alloc>
+  8026ba:	89 c3                	mov    %eax,%ebx
+  8026bc:	83 c4 10             	add    $0x10,%esp
+  8026bf:	85 c0                	test   %eax,%eax
+  8026c1:	0f 88 db 00 00 00    	js     8027a2 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8026c7:	83 ec 04             	sub    $0x4,%esp
+  8026ca:	68 07 04 00 00       	push   $0x407
+  8026cf:	ff 75 f0             	push   -0x10(%ebp)
+  8026d2:	6a 00                	push   $0x0
+  8026d4:	e8 29 ec ff ff       	call   801302 <sys_page_alloc>
+  8026d9:	89 c3                	mov    %eax,%ebx
+  8026db:	83 c4 10             	add    $0x10,%esp
+  8026de:	85 c0                	test   %eax,%eax
+  8026e0:	0f 88 bc 00 00 00    	js     8027a2 <pipe+0x131>
+	va = fd2data(fd0);
+  8026e6:	83 ec 0c             	sub    $0xc,%esp
+  8026e9:	ff 75 f4             	push   -0xc(%ebp)
+  8026ec:	e8 f4 ee ff ff       	call   8015e5 <fd2data>
+  8026f1:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8026f3:	83 c4 0c             	add    $0xc,%esp
+  8026f6:	68 07 04 00 00       	push   $0x407
+  8026fb:	50                   	push   %eax
+  8026fc:	6a 00                	push   $0x0
+  8026fe:	e8 ff eb ff ff       	call   801302 <sys_page_alloc>
+  802703:	89 c3                	mov    %eax,%ebx
+  802705:	83 c4 10             	add    $0x10,%esp
+  802708:	85 c0                	test   %eax,%eax
+  80270a:	0f 88 82 00 00 00    	js     802792 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802710:	83 ec 0c             	sub    $0xc,%esp
+  802713:	ff 75 f0             	push   -0x10(%ebp)
+  802716:	e8 ca ee ff ff       	call   8015e5 <fd2data>
+  80271b:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802722:	50                   	push   %eax
+  802723:	6a 00                	push   $0x0
+  802725:	56                   	push   %esi
+  802726:	6a 00                	push   $0x0
+  802728:	e8 18 ec ff ff       	call   801345 <sys_page_map>
+  80272d:	89 c3                	mov    %eax,%ebx
+  80272f:	83 c4 20             	add    $0x20,%esp
+  802732:	85 c0                	test   %eax,%eax
+  802734:	78 4e                	js     802784 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802736:	a1 5c 40 80 00       	mov    0x80405c,%eax
+  80273b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80273e:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802740:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802743:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80274a:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80274d:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80274f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802752:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802759:	83 ec 0c             	sub    $0xc,%esp
+  80275c:	ff 75 f4             	push   -0xc(%ebp)
+  80275f:	e8 71 ee ff ff       	call   8015d5 <fd2num>
+  802764:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802767:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802769:	83 c4 04             	add    $0x4,%esp
+  80276c:	ff 75 f0             	push   -0x10(%ebp)
+  80276f:	e8 61 ee ff ff       	call   8015d5 <fd2num>
+  802774:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802777:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80277a:	83 c4 10             	add    $0x10,%esp
+  80277d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802782:	eb 2e                	jmp    8027b2 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802784:	83 ec 08             	sub    $0x8,%esp
+  802787:	56                   	push   %esi
+  802788:	6a 00                	push   $0x0
+  80278a:	e8 f8 eb ff ff       	call   801387 <sys_page_unmap>
+  80278f:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802792:	83 ec 08             	sub    $0x8,%esp
+  802795:	ff 75 f0             	push   -0x10(%ebp)
+  802798:	6a 00                	push   $0x0
+  80279a:	e8 e8 eb ff ff       	call   801387 <sys_page_unmap>
+  80279f:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8027a2:	83 ec 08             	sub    $0x8,%esp
+  8027a5:	ff 75 f4             	push   -0xc(%ebp)
+  8027a8:	6a 00                	push   $0x0
+  8027aa:	e8 d8 eb ff ff       	call   801387 <sys_page_unmap>
+  8027af:	83 c4 10             	add    $0x10,%esp
+}
+  8027b2:	89 d8                	mov    %ebx,%eax
+  8027b4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027b7:	5b                   	pop    %ebx
+  8027b8:	5e                   	pop    %esi
+  8027b9:	5d                   	pop    %ebp
+  8027ba:	c3                   	ret
+
+008027bb <pipeisclosed>:
+{
+  8027bb:	55                   	push   %ebp
+  8027bc:	89 e5                	mov    %esp,%ebp
+  8027be:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8027c1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8027c4:	50                   	push   %eax
+  8027c5:	ff 75 08             	push   0x8(%ebp)
+  8027c8:	e8 85 ee ff ff       	call   801652 <fd_lookup>
+  8027cd:	83 c4 10             	add    $0x10,%esp
+  8027d0:	85 c0                	test   %eax,%eax
+  8027d2:	78 18                	js     8027ec <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8027d4:	83 ec 0c             	sub    $0xc,%esp
+  8027d7:	ff 75 f4             	push   -0xc(%ebp)
+  8027da:	e8 06 ee ff ff       	call   8015e5 <fd2data>
+  8027df:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8027e1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027e4:	e8 33 fd ff ff       	call   80251c <_pipeisclosed>
+  8027e9:	83 c4 10             	add    $0x10,%esp
+}
+  8027ec:	c9                   	leave
+  8027ed:	c3                   	ret
+
+008027ee <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8027ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027f3:	c3                   	ret
+
+008027f4 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8027f4:	55                   	push   %ebp
+  8027f5:	89 e5                	mov    %esp,%ebp
+  8027f7:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8027fa:	68 5e 36 80 00       	push   $0x80365e
+  8027ff:	ff 75 0c             	push   0xc(%ebp)
+  802802:	e8 0f e7 ff ff       	call   800f16 <strcpy>
+	return 0;
+}
+  802807:	b8 00 00 00 00       	mov    $0x0,%eax
+  80280c:	c9                   	leave
+  80280d:	c3                   	ret
+
+0080280e <devcons_write>:
+{
+  80280e:	55                   	push   %ebp
+  80280f:	89 e5                	mov    %esp,%ebp
+  802811:	57                   	push   %edi
+  802812:	56                   	push   %esi
+  802813:	53                   	push   %ebx
+  802814:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80281a:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80281f:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802825:	eb 2e                	jmp    802855 <devcons_write+0x47>
+		m = n - tot;
+  802827:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80282a:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80282c:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802831:	39 c3                	cmp    %eax,%ebx
+  802833:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802836:	83 ec 04             	sub    $0x4,%esp
+  802839:	53                   	push   %ebx
+  80283a:	89 f0                	mov    %esi,%eax
+  80283c:	03 45 0c             	add    0xc(%ebp),%eax
+  80283f:	50                   	push   %eax
+  802840:	57                   	push   %edi
+  802841:	e8 56 e8 ff ff       	call   80109c <memmove>
+		sys_cputs(buf, m);
+  802846:	83 c4 08             	add    $0x8,%esp
+  802849:	53                   	push   %ebx
+  80284a:	57                   	push   %edi
+  80284b:	e8 f6 e9 ff ff       	call   801246 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802850:	01 de                	add    %ebx,%esi
+  802852:	83 c4 10             	add    $0x10,%esp
+  802855:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802858:	72 cd                	jb     802827 <devcons_write+0x19>
+}
+  80285a:	89 f0                	mov    %esi,%eax
+  80285c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80285f:	5b                   	pop    %ebx
+  802860:	5e                   	pop    %esi
+  802861:	5f                   	pop    %edi
+  802862:	5d                   	pop    %ebp
+  802863:	c3                   	ret
+
+00802864 <devcons_read>:
+{
+  802864:	55                   	push   %ebp
+  802865:	89 e5                	mov    %esp,%ebp
+  802867:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80286a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80286f:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802873:	75 07                	jne    80287c <devcons_read+0x18>
+  802875:	eb 1f                	jmp    802896 <devcons_read+0x32>
+		sys_yield();
+  802877:	e8 67 ea ff ff       	call   8012e3 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80287c:	e8 e3 e9 ff ff       	call   801264 <sys_cgetc>
+  802881:	85 c0                	test   %eax,%eax
+  802883:	74 f2                	je     802877 <devcons_read+0x13>
+	if (c < 0)
+  802885:	78 0f                	js     802896 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802887:	83 f8 04             	cmp    $0x4,%eax
+  80288a:	74 0c                	je     802898 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80288c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80288f:	88 02                	mov    %al,(%edx)
+	return 1;
+  802891:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802896:	c9                   	leave
+  802897:	c3                   	ret
+		return 0;
+  802898:	b8 00 00 00 00       	mov    $0x0,%eax
+  80289d:	eb f7                	jmp    802896 <devcons_read+0x32>
+
+0080289f <cputchar>:
+{
+  80289f:	55                   	push   %ebp
+  8028a0:	89 e5                	mov    %esp,%ebp
+  8028a2:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8028a5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028a8:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8028ab:	6a 01                	push   $0x1
+  8028ad:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8028b0:	50                   	push   %eax
+  8028b1:	e8 90 e9 ff ff       	call   801246 <sys_cputs>
+}
+  8028b6:	83 c4 10             	add    $0x10,%esp
+  8028b9:	c9                   	leave
+  8028ba:	c3                   	ret
+
+008028bb <getchar>:
+{
+  8028bb:	55                   	push   %ebp
+  8028bc:	89 e5                	mov    %esp,%ebp
+  8028be:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8028c1:	6a 01                	push   $0x1
+  8028c3:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8028c6:	50                   	push   %eax
+  8028c7:	6a 00                	push   $0x0
+  8028c9:	e8 ea ef ff ff       	call   8018b8 <read>
+	if (r < 0)
+  8028ce:	83 c4 10             	add    $0x10,%esp
+  8028d1:	85 c0                	test   %eax,%eax
+  8028d3:	78 06                	js     8028db <getchar+0x20>
+	if (r < 1)
+  8028d5:	74 06                	je     8028dd <getchar+0x22>
+	return c;
+  8028d7:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8028db:	c9                   	leave
+  8028dc:	c3                   	ret
+		return -E_EOF;
+  8028dd:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8028e2:	eb f7                	jmp    8028db <getchar+0x20>
+
+008028e4 <iscons>:
+{
+  8028e4:	55                   	push   %ebp
+  8028e5:	89 e5                	mov    %esp,%ebp
+  8028e7:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8028ea:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8028ed:	50                   	push   %eax
+  8028ee:	ff 75 08             	push   0x8(%ebp)
+  8028f1:	e8 5c ed ff ff       	call   801652 <fd_lookup>
+  8028f6:	83 c4 10             	add    $0x10,%esp
+  8028f9:	85 c0                	test   %eax,%eax
+  8028fb:	78 11                	js     80290e <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8028fd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802900:	8b 15 78 40 80 00    	mov    0x804078,%edx
+  802906:	39 10                	cmp    %edx,(%eax)
+  802908:	0f 94 c0             	sete   %al
+  80290b:	0f b6 c0             	movzbl %al,%eax
+}
+  80290e:	c9                   	leave
+  80290f:	c3                   	ret
+
+00802910 <opencons>:
+{
+  802910:	55                   	push   %ebp
+  802911:	89 e5                	mov    %esp,%ebp
+  802913:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802916:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802919:	50                   	push   %eax
+  80291a:	e8 dd ec ff ff       	call   8015fc <fd_alloc>
+  80291f:	83 c4 10             	add    $0x10,%esp
+  802922:	85 c0                	test   %eax,%eax
+  802924:	78 3a                	js     802960 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802926:	83 ec 04             	sub    $0x4,%esp
+  802929:	68 07 04 00 00       	push   $0x407
+  80292e:	ff 75 f4             	push   -0xc(%ebp)
+  802931:	6a 00                	push   $0x0
+  802933:	e8 ca e9 ff ff       	call   801302 <sys_page_alloc>
+  802938:	83 c4 10             	add    $0x10,%esp
+  80293b:	85 c0                	test   %eax,%eax
+  80293d:	78 21                	js     802960 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80293f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802942:	8b 15 78 40 80 00    	mov    0x804078,%edx
+  802948:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80294a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80294d:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802954:	83 ec 0c             	sub    $0xc,%esp
+  802957:	50                   	push   %eax
+  802958:	e8 78 ec ff ff       	call   8015d5 <fd2num>
+  80295d:	83 c4 10             	add    $0x10,%esp
+}
+  802960:	c9                   	leave
+  802961:	c3                   	ret
+
+00802962 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  802962:	55                   	push   %ebp
+  802963:	89 e5                	mov    %esp,%ebp
+  802965:	56                   	push   %esi
+  802966:	53                   	push   %ebx
+  802967:	8b 75 08             	mov    0x8(%ebp),%esi
+  80296a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80296d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  802970:	85 c0                	test   %eax,%eax
+  802972:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802977:	0f 44 c2             	cmove  %edx,%eax
+  80297a:	83 ec 0c             	sub    $0xc,%esp
+  80297d:	50                   	push   %eax
+  80297e:	e8 2f eb ff ff       	call   8014b2 <sys_ipc_recv>
+
+  if (from_env_store)
+  802983:	83 c4 10             	add    $0x10,%esp
+  802986:	85 f6                	test   %esi,%esi
+  802988:	74 17                	je     8029a1 <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  80298a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80298f:	85 c0                	test   %eax,%eax
+  802991:	75 0c                	jne    80299f <ipc_recv+0x3d>
+  802993:	8b 15 1c 50 80 00    	mov    0x80501c,%edx
+  802999:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  80299f:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  8029a1:	85 db                	test   %ebx,%ebx
+  8029a3:	74 2b                	je     8029d0 <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  8029a5:	85 c0                	test   %eax,%eax
+  8029a7:	74 0d                	je     8029b6 <ipc_recv+0x54>
+  8029a9:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  8029af:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8029b2:	5b                   	pop    %ebx
+  8029b3:	5e                   	pop    %esi
+  8029b4:	5d                   	pop    %ebp
+  8029b5:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  8029b6:	a1 1c 50 80 00       	mov    0x80501c,%eax
+  8029bb:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8029c1:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  8029c3:	a1 1c 50 80 00       	mov    0x80501c,%eax
+  8029c8:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  8029ce:	eb df                	jmp    8029af <ipc_recv+0x4d>
+  8029d0:	85 c0                	test   %eax,%eax
+  8029d2:	75 db                	jne    8029af <ipc_recv+0x4d>
+  8029d4:	eb ed                	jmp    8029c3 <ipc_recv+0x61>
+
+008029d6 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  8029d6:	55                   	push   %ebp
+  8029d7:	89 e5                	mov    %esp,%ebp
+  8029d9:	57                   	push   %edi
+  8029da:	56                   	push   %esi
+  8029db:	53                   	push   %ebx
+  8029dc:	83 ec 0c             	sub    $0xc,%esp
+  8029df:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8029e2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8029e5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  8029e8:	85 db                	test   %ebx,%ebx
+  8029ea:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8029ef:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  8029f2:	ff 75 14             	push   0x14(%ebp)
+  8029f5:	53                   	push   %ebx
+  8029f6:	56                   	push   %esi
+  8029f7:	57                   	push   %edi
+  8029f8:	e8 92 ea ff ff       	call   80148f <sys_ipc_try_send>
+  8029fd:	83 c4 10             	add    $0x10,%esp
+  802a00:	85 c0                	test   %eax,%eax
+  802a02:	74 1e                	je     802a22 <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  802a04:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802a07:	75 07                	jne    802a10 <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  802a09:	e8 d5 e8 ff ff       	call   8012e3 <sys_yield>
+  802a0e:	eb e2                	jmp    8029f2 <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  802a10:	50                   	push   %eax
+  802a11:	68 6a 36 80 00       	push   $0x80366a
+  802a16:	6a 3c                	push   $0x3c
+  802a18:	68 77 36 80 00       	push   $0x803677
+  802a1d:	e8 60 de ff ff       	call   800882 <_panic>
+  }
+
+#endif
+}
+  802a22:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a25:	5b                   	pop    %ebx
+  802a26:	5e                   	pop    %esi
+  802a27:	5f                   	pop    %edi
+  802a28:	5d                   	pop    %ebp
+  802a29:	c3                   	ret
+
+00802a2a <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  802a2a:	55                   	push   %ebp
+  802a2b:	89 e5                	mov    %esp,%ebp
+  802a2d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  802a30:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  802a35:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802a38:	c1 e0 04             	shl    $0x4,%eax
+  802a3b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802a40:	8b 40 50             	mov    0x50(%eax),%eax
+  802a43:	39 c8                	cmp    %ecx,%eax
+  802a45:	74 12                	je     802a59 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  802a47:	83 c2 01             	add    $0x1,%edx
+  802a4a:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802a50:	75 e3                	jne    802a35 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802a52:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a57:	eb 0e                	jmp    802a67 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  802a59:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802a5c:	c1 e0 04             	shl    $0x4,%eax
+  802a5f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802a64:	8b 40 48             	mov    0x48(%eax),%eax
+  802a67:	5d                   	pop    %ebp
+  802a68:	c3                   	ret
+
+00802a69 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802a69:	55                   	push   %ebp
+  802a6a:	89 e5                	mov    %esp,%ebp
+  802a6c:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802a6f:	89 c2                	mov    %eax,%edx
+  802a71:	c1 ea 16             	shr    $0x16,%edx
+  802a74:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802a7b:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802a80:	f6 c1 01             	test   $0x1,%cl
+  802a83:	74 1c                	je     802aa1 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  802a85:	c1 e8 0c             	shr    $0xc,%eax
+  802a88:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802a8f:	a8 01                	test   $0x1,%al
+  802a91:	74 0e                	je     802aa1 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802a93:	c1 e8 0c             	shr    $0xc,%eax
+  802a96:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802a9d:	ef 
+  802a9e:	0f b7 d2             	movzwl %dx,%edx
+}
+  802aa1:	89 d0                	mov    %edx,%eax
+  802aa3:	5d                   	pop    %ebp
+  802aa4:	c3                   	ret
+  802aa5:	66 90                	xchg   %ax,%ax
+  802aa7:	66 90                	xchg   %ax,%ax
+  802aa9:	66 90                	xchg   %ax,%ax
+  802aab:	66 90                	xchg   %ax,%ax
+  802aad:	66 90                	xchg   %ax,%ax
+  802aaf:	90                   	nop
+
+00802ab0 <__udivmoddi4>:
+  802ab0:	55                   	push   %ebp
+  802ab1:	57                   	push   %edi
+  802ab2:	56                   	push   %esi
+  802ab3:	53                   	push   %ebx
+  802ab4:	83 ec 24             	sub    $0x24,%esp
+  802ab7:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802abb:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802abf:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  802ac3:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802ac7:	8b 54 24 44          	mov    0x44(%esp),%edx
+  802acb:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802acf:	8b 44 24 40          	mov    0x40(%esp),%eax
+  802ad3:	89 d3                	mov    %edx,%ebx
+  802ad5:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802ad9:	09 c3                	or     %eax,%ebx
+  802adb:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802adf:	0f 84 9c 00 00 00    	je     802b81 <__udivmoddi4+0xd1>
+  802ae5:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802aec:	00 
+  802aed:	31 c0                	xor    %eax,%eax
+  802aef:	31 d2                	xor    %edx,%edx
+  802af1:	89 fb                	mov    %edi,%ebx
+  802af3:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802afa:	00 
+  802afb:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802b00:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802b04:	01 c0                	add    %eax,%eax
+  802b06:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802b0d:	00 
+  802b0e:	89 c6                	mov    %eax,%esi
+  802b10:	89 d7                	mov    %edx,%edi
+  802b12:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802b16:	8b 54 24 14          	mov    0x14(%esp),%edx
+  802b1a:	0f ad d0             	shrd   %cl,%edx,%eax
+  802b1d:	d3 ea                	shr    %cl,%edx
+  802b1f:	f6 c1 20             	test   $0x20,%cl
+  802b22:	0f 45 c2             	cmovne %edx,%eax
+  802b25:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802b29:	83 e0 01             	and    $0x1,%eax
+  802b2c:	09 fa                	or     %edi,%edx
+  802b2e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802b32:	89 04 24             	mov    %eax,(%esp)
+  802b35:	8b 04 24             	mov    (%esp),%eax
+  802b38:	89 d5                	mov    %edx,%ebp
+  802b3a:	09 f0                	or     %esi,%eax
+  802b3c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802b40:	39 f0                	cmp    %esi,%eax
+  802b42:	19 fd                	sbb    %edi,%ebp
+  802b44:	72 1d                	jb     802b63 <__udivmoddi4+0xb3>
+  802b46:	29 f0                	sub    %esi,%eax
+  802b48:	19 fa                	sbb    %edi,%edx
+  802b4a:	89 cf                	mov    %ecx,%edi
+  802b4c:	c1 ef 05             	shr    $0x5,%edi
+  802b4f:	83 e7 01             	and    $0x1,%edi
+  802b52:	89 fe                	mov    %edi,%esi
+  802b54:	d3 e7                	shl    %cl,%edi
+  802b56:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802b5a:	83 f6 01             	xor    $0x1,%esi
+  802b5d:	d3 e6                	shl    %cl,%esi
+  802b5f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802b63:	83 e9 01             	sub    $0x1,%ecx
+  802b66:	73 98                	jae    802b00 <__udivmoddi4+0x50>
+  802b68:	85 db                	test   %ebx,%ebx
+  802b6a:	74 05                	je     802b71 <__udivmoddi4+0xc1>
+  802b6c:	89 03                	mov    %eax,(%ebx)
+  802b6e:	89 53 04             	mov    %edx,0x4(%ebx)
+  802b71:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802b75:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802b79:	83 c4 24             	add    $0x24,%esp
+  802b7c:	5b                   	pop    %ebx
+  802b7d:	5e                   	pop    %esi
+  802b7e:	5f                   	pop    %edi
+  802b7f:	5d                   	pop    %ebp
+  802b80:	c3                   	ret
+  802b81:	85 ff                	test   %edi,%edi
+  802b83:	74 0d                	je     802b92 <__udivmoddi4+0xe2>
+  802b85:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  802b8b:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  802b92:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802b96:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802b9a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  802b9e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802ba2:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802ba6:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802baa:	83 c4 24             	add    $0x24,%esp
+  802bad:	5b                   	pop    %ebx
+  802bae:	5e                   	pop    %esi
+  802baf:	5f                   	pop    %edi
+  802bb0:	5d                   	pop    %ebp
+  802bb1:	c3                   	ret
+  802bb2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802bb9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00802bc0 <__udivdi3>:
+  802bc0:	57                   	push   %edi
+  802bc1:	56                   	push   %esi
+  802bc2:	53                   	push   %ebx
+  802bc3:	83 ec 20             	sub    $0x20,%esp
+  802bc6:	8b 54 24 34          	mov    0x34(%esp),%edx
+  802bca:	8b 44 24 30          	mov    0x30(%esp),%eax
+  802bce:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802bd2:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802bd6:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802bda:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802bde:	89 d1                	mov    %edx,%ecx
+  802be0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802be4:	09 c1                	or     %eax,%ecx
+  802be6:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802bea:	89 44 24 18          	mov    %eax,0x18(%esp)
+  802bee:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802bf2:	0f 84 88 00 00 00    	je     802c80 <__udivdi3+0xc0>
+  802bf8:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802bff:	00 
+  802c00:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802c05:	31 c0                	xor    %eax,%eax
+  802c07:	31 d2                	xor    %edx,%edx
+  802c09:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802c10:	00 
+  802c11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802c18:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802c1c:	01 c0                	add    %eax,%eax
+  802c1e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802c25:	00 
+  802c26:	89 c6                	mov    %eax,%esi
+  802c28:	89 d7                	mov    %edx,%edi
+  802c2a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802c2e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802c32:	0f ad d0             	shrd   %cl,%edx,%eax
+  802c35:	d3 ea                	shr    %cl,%edx
+  802c37:	f6 c1 20             	test   $0x20,%cl
+  802c3a:	0f 45 c2             	cmovne %edx,%eax
+  802c3d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802c41:	83 e0 01             	and    $0x1,%eax
+  802c44:	09 fa                	or     %edi,%edx
+  802c46:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802c4a:	89 04 24             	mov    %eax,(%esp)
+  802c4d:	8b 04 24             	mov    (%esp),%eax
+  802c50:	89 d3                	mov    %edx,%ebx
+  802c52:	09 f0                	or     %esi,%eax
+  802c54:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802c58:	39 f0                	cmp    %esi,%eax
+  802c5a:	19 fb                	sbb    %edi,%ebx
+  802c5c:	72 1d                	jb     802c7b <__udivdi3+0xbb>
+  802c5e:	29 f0                	sub    %esi,%eax
+  802c60:	19 fa                	sbb    %edi,%edx
+  802c62:	89 cf                	mov    %ecx,%edi
+  802c64:	c1 ef 05             	shr    $0x5,%edi
+  802c67:	83 e7 01             	and    $0x1,%edi
+  802c6a:	89 fe                	mov    %edi,%esi
+  802c6c:	d3 e7                	shl    %cl,%edi
+  802c6e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802c72:	83 f6 01             	xor    $0x1,%esi
+  802c75:	d3 e6                	shl    %cl,%esi
+  802c77:	09 74 24 18          	or     %esi,0x18(%esp)
+  802c7b:	83 e9 01             	sub    $0x1,%ecx
+  802c7e:	73 98                	jae    802c18 <__udivdi3+0x58>
+  802c80:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802c84:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802c88:	83 c4 20             	add    $0x20,%esp
+  802c8b:	5b                   	pop    %ebx
+  802c8c:	5e                   	pop    %esi
+  802c8d:	5f                   	pop    %edi
+  802c8e:	c3                   	ret
+  802c8f:	90                   	nop
+
+00802c90 <__umoddi3>:
+  802c90:	57                   	push   %edi
+  802c91:	56                   	push   %esi
+  802c92:	53                   	push   %ebx
+  802c93:	83 ec 18             	sub    $0x18,%esp
+  802c96:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802c9a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802c9e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802ca2:	8b 54 24 34          	mov    0x34(%esp),%edx
+  802ca6:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802caa:	8b 44 24 30          	mov    0x30(%esp),%eax
+  802cae:	89 d1                	mov    %edx,%ecx
+  802cb0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802cb4:	09 c1                	or     %eax,%ecx
+  802cb6:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802cba:	74 5b                	je     802d17 <__umoddi3+0x87>
+  802cbc:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802cc1:	31 c0                	xor    %eax,%eax
+  802cc3:	31 d2                	xor    %edx,%edx
+  802cc5:	8d 76 00             	lea    0x0(%esi),%esi
+  802cc8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802ccc:	01 c0                	add    %eax,%eax
+  802cce:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802cd5:	00 
+  802cd6:	89 c6                	mov    %eax,%esi
+  802cd8:	89 d7                	mov    %edx,%edi
+  802cda:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802cde:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802ce2:	0f ad d0             	shrd   %cl,%edx,%eax
+  802ce5:	d3 ea                	shr    %cl,%edx
+  802ce7:	f6 c1 20             	test   $0x20,%cl
+  802cea:	0f 45 c2             	cmovne %edx,%eax
+  802ced:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802cf1:	83 e0 01             	and    $0x1,%eax
+  802cf4:	09 fa                	or     %edi,%edx
+  802cf6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802cfa:	89 04 24             	mov    %eax,(%esp)
+  802cfd:	8b 04 24             	mov    (%esp),%eax
+  802d00:	89 d3                	mov    %edx,%ebx
+  802d02:	09 f0                	or     %esi,%eax
+  802d04:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802d08:	39 f0                	cmp    %esi,%eax
+  802d0a:	19 fb                	sbb    %edi,%ebx
+  802d0c:	72 04                	jb     802d12 <__umoddi3+0x82>
+  802d0e:	29 f0                	sub    %esi,%eax
+  802d10:	19 fa                	sbb    %edi,%edx
+  802d12:	83 e9 01             	sub    $0x1,%ecx
+  802d15:	73 b1                	jae    802cc8 <__umoddi3+0x38>
+  802d17:	83 c4 18             	add    $0x18,%esp
+  802d1a:	5b                   	pop    %ebx
+  802d1b:	5e                   	pop    %esi
+  802d1c:	5f                   	pop    %edi
+  802d1d:	c3                   	ret
+  802d1e:	66 90                	xchg   %ax,%ax
+
+00802d20 <__divdi3>:
+  802d20:	55                   	push   %ebp
+  802d21:	57                   	push   %edi
+  802d22:	56                   	push   %esi
+  802d23:	53                   	push   %ebx
+  802d24:	83 ec 24             	sub    $0x24,%esp
+  802d27:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  802d2b:	8b 74 24 44          	mov    0x44(%esp),%esi
+  802d2f:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802d33:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802d37:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  802d3b:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802d3f:	85 d2                	test   %edx,%edx
+  802d41:	0f 88 e0 00 00 00    	js     802e27 <__divdi3+0x107>
+  802d47:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  802d4b:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  802d4f:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802d53:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802d57:	85 f6                	test   %esi,%esi
+  802d59:	78 16                	js     802d71 <__divdi3+0x51>
+  802d5b:	89 f1                	mov    %esi,%ecx
+  802d5d:	31 c0                	xor    %eax,%eax
+  802d5f:	31 d2                	xor    %edx,%edx
+  802d61:	09 d9                	or     %ebx,%ecx
+  802d63:	0f 85 f3 00 00 00    	jne    802e5c <__divdi3+0x13c>
+  802d69:	83 c4 24             	add    $0x24,%esp
+  802d6c:	5b                   	pop    %ebx
+  802d6d:	5e                   	pop    %esi
+  802d6e:	5f                   	pop    %edi
+  802d6f:	5d                   	pop    %ebp
+  802d70:	c3                   	ret
+  802d71:	bf 01 00 00 00       	mov    $0x1,%edi
+  802d76:	f7 5c 24 08          	negl   0x8(%esp)
+  802d7a:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  802d7f:	f7 5c 24 0c          	negl   0xc(%esp)
+  802d83:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802d8a:	00 
+  802d8b:	31 c0                	xor    %eax,%eax
+  802d8d:	31 d2                	xor    %edx,%edx
+  802d8f:	89 fb                	mov    %edi,%ebx
+  802d91:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802d98:	00 
+  802d99:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802d9e:	66 90                	xchg   %ax,%ax
+  802da0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802da4:	01 c0                	add    %eax,%eax
+  802da6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802dad:	00 
+  802dae:	89 c6                	mov    %eax,%esi
+  802db0:	89 d7                	mov    %edx,%edi
+  802db2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802db6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  802dba:	0f ad d0             	shrd   %cl,%edx,%eax
+  802dbd:	d3 ea                	shr    %cl,%edx
+  802dbf:	f6 c1 20             	test   $0x20,%cl
+  802dc2:	0f 45 c2             	cmovne %edx,%eax
+  802dc5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802dc9:	83 e0 01             	and    $0x1,%eax
+  802dcc:	09 fa                	or     %edi,%edx
+  802dce:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802dd2:	89 04 24             	mov    %eax,(%esp)
+  802dd5:	8b 04 24             	mov    (%esp),%eax
+  802dd8:	89 d5                	mov    %edx,%ebp
+  802dda:	09 f0                	or     %esi,%eax
+  802ddc:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802de0:	39 f0                	cmp    %esi,%eax
+  802de2:	19 fd                	sbb    %edi,%ebp
+  802de4:	72 1d                	jb     802e03 <__divdi3+0xe3>
+  802de6:	29 f0                	sub    %esi,%eax
+  802de8:	19 fa                	sbb    %edi,%edx
+  802dea:	89 cf                	mov    %ecx,%edi
+  802dec:	c1 ef 05             	shr    $0x5,%edi
+  802def:	83 e7 01             	and    $0x1,%edi
+  802df2:	89 fe                	mov    %edi,%esi
+  802df4:	d3 e7                	shl    %cl,%edi
+  802df6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802dfa:	83 f6 01             	xor    $0x1,%esi
+  802dfd:	d3 e6                	shl    %cl,%esi
+  802dff:	09 74 24 18          	or     %esi,0x18(%esp)
+  802e03:	83 e9 01             	sub    $0x1,%ecx
+  802e06:	73 98                	jae    802da0 <__divdi3+0x80>
+  802e08:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802e0c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802e10:	85 db                	test   %ebx,%ebx
+  802e12:	0f 84 51 ff ff ff    	je     802d69 <__divdi3+0x49>
+  802e18:	f7 d8                	neg    %eax
+  802e1a:	83 d2 00             	adc    $0x0,%edx
+  802e1d:	83 c4 24             	add    $0x24,%esp
+  802e20:	5b                   	pop    %ebx
+  802e21:	f7 da                	neg    %edx
+  802e23:	5e                   	pop    %esi
+  802e24:	5f                   	pop    %edi
+  802e25:	5d                   	pop    %ebp
+  802e26:	c3                   	ret
+  802e27:	f7 d8                	neg    %eax
+  802e29:	83 d2 00             	adc    $0x0,%edx
+  802e2c:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802e30:	f7 da                	neg    %edx
+  802e32:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802e36:	85 f6                	test   %esi,%esi
+  802e38:	78 1b                	js     802e55 <__divdi3+0x135>
+  802e3a:	89 f1                	mov    %esi,%ecx
+  802e3c:	31 c0                	xor    %eax,%eax
+  802e3e:	31 d2                	xor    %edx,%edx
+  802e40:	bf 01 00 00 00       	mov    $0x1,%edi
+  802e45:	09 d9                	or     %ebx,%ecx
+  802e47:	0f 85 36 ff ff ff    	jne    802d83 <__divdi3+0x63>
+  802e4d:	83 c4 24             	add    $0x24,%esp
+  802e50:	5b                   	pop    %ebx
+  802e51:	5e                   	pop    %esi
+  802e52:	5f                   	pop    %edi
+  802e53:	5d                   	pop    %ebp
+  802e54:	c3                   	ret
+  802e55:	31 ff                	xor    %edi,%edi
+  802e57:	e9 1a ff ff ff       	jmp    802d76 <__divdi3+0x56>
+  802e5c:	31 ff                	xor    %edi,%edi
+  802e5e:	e9 20 ff ff ff       	jmp    802d83 <__divdi3+0x63>
+  802e63:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802e6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00802e70 <__moddi3>:
+  802e70:	55                   	push   %ebp
+  802e71:	57                   	push   %edi
+  802e72:	56                   	push   %esi
+  802e73:	53                   	push   %ebx
+  802e74:	83 ec 1c             	sub    $0x1c,%esp
+  802e77:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  802e7b:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  802e7f:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  802e83:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  802e87:	89 c8                	mov    %ecx,%eax
+  802e89:	89 f2                	mov    %esi,%edx
+  802e8b:	89 f3                	mov    %esi,%ebx
+  802e8d:	85 ed                	test   %ebp,%ebp
+  802e8f:	0f 88 9d 00 00 00    	js     802f32 <__moddi3+0xc2>
+  802e95:	09 cb                	or     %ecx,%ebx
+  802e97:	0f 84 8d 00 00 00    	je     802f2a <__moddi3+0xba>
+  802e9d:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802ea1:	31 db                	xor    %ebx,%ebx
+  802ea3:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802ea7:	89 ca                	mov    %ecx,%edx
+  802ea9:	89 f0                	mov    %esi,%eax
+  802eab:	89 dd                	mov    %ebx,%ebp
+  802ead:	f7 da                	neg    %edx
+  802eaf:	83 d0 00             	adc    $0x0,%eax
+  802eb2:	f7 d8                	neg    %eax
+  802eb4:	0f 49 f0             	cmovns %eax,%esi
+  802eb7:	0f 49 ca             	cmovns %edx,%ecx
+  802eba:	31 c0                	xor    %eax,%eax
+  802ebc:	31 d2                	xor    %edx,%edx
+  802ebe:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802ec2:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802ec6:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802ecb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  802ecf:	90                   	nop
+  802ed0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802ed4:	01 c0                	add    %eax,%eax
+  802ed6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802edd:	00 
+  802ede:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  802ee2:	89 c6                	mov    %eax,%esi
+  802ee4:	89 d7                	mov    %edx,%edi
+  802ee6:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802eea:	8b 54 24 14          	mov    0x14(%esp),%edx
+  802eee:	0f ad d0             	shrd   %cl,%edx,%eax
+  802ef1:	d3 ea                	shr    %cl,%edx
+  802ef3:	f6 c1 20             	test   $0x20,%cl
+  802ef6:	0f 45 c2             	cmovne %edx,%eax
+  802ef9:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802efd:	83 e0 01             	and    $0x1,%eax
+  802f00:	09 fa                	or     %edi,%edx
+  802f02:	89 04 24             	mov    %eax,(%esp)
+  802f05:	8b 04 24             	mov    (%esp),%eax
+  802f08:	89 d7                	mov    %edx,%edi
+  802f0a:	09 f0                	or     %esi,%eax
+  802f0c:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  802f10:	39 d8                	cmp    %ebx,%eax
+  802f12:	19 f7                	sbb    %esi,%edi
+  802f14:	72 04                	jb     802f1a <__moddi3+0xaa>
+  802f16:	29 d8                	sub    %ebx,%eax
+  802f18:	19 f2                	sbb    %esi,%edx
+  802f1a:	83 e9 01             	sub    $0x1,%ecx
+  802f1d:	73 b1                	jae    802ed0 <__moddi3+0x60>
+  802f1f:	85 ed                	test   %ebp,%ebp
+  802f21:	74 07                	je     802f2a <__moddi3+0xba>
+  802f23:	f7 d8                	neg    %eax
+  802f25:	83 d2 00             	adc    $0x0,%edx
+  802f28:	f7 da                	neg    %edx
+  802f2a:	83 c4 1c             	add    $0x1c,%esp
+  802f2d:	5b                   	pop    %ebx
+  802f2e:	5e                   	pop    %esi
+  802f2f:	5f                   	pop    %edi
+  802f30:	5d                   	pop    %ebp
+  802f31:	c3                   	ret
+  802f32:	09 cb                	or     %ecx,%ebx
+  802f34:	74 f4                	je     802f2a <__moddi3+0xba>
+  802f36:	f7 df                	neg    %edi
+  802f38:	bb 01 00 00 00       	mov    $0x1,%ebx
+  802f3d:	83 d5 00             	adc    $0x0,%ebp
+  802f40:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802f44:	f7 dd                	neg    %ebp
+  802f46:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802f4a:	e9 58 ff ff ff       	jmp    802ea7 <__moddi3+0x37>
@@ -0,0 +1,5908 @@
+
+obj/user/icode.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 03 01 00 00       	call   800134 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	81 ec 1c 02 00 00    	sub    $0x21c,%esp
+	int fd, n, r;
+	char buf[512+1];
+
+	binaryname = "icode";
+  80003e:	c7 05 00 40 80 00 c0 	movl   $0x802bc0,0x804000
+  800045:	2b 80 00 
+
+	cprintf("icode startup\n");
+  800048:	68 c6 2b 80 00       	push   $0x802bc6
+  80004d:	e8 20 02 00 00       	call   800272 <cprintf>
+
+	cprintf("icode: open /motd\n");
+  800052:	c7 04 24 d5 2b 80 00 	movl   $0x802bd5,(%esp)
+  800059:	e8 14 02 00 00       	call   800272 <cprintf>
+	if ((fd = open("/motd", O_RDONLY)) < 0)
+  80005e:	83 c4 08             	add    $0x8,%esp
+  800061:	6a 00                	push   $0x0
+  800063:	68 e8 2b 80 00       	push   $0x802be8
+  800068:	e8 c3 15 00 00       	call   801630 <open>
+  80006d:	89 c6                	mov    %eax,%esi
+  80006f:	83 c4 10             	add    $0x10,%esp
+  800072:	85 c0                	test   %eax,%eax
+  800074:	78 18                	js     80008e <umain+0x5b>
+		panic("icode: open /motd: %e", fd);
+
+	cprintf("icode: read /motd\n");
+  800076:	83 ec 0c             	sub    $0xc,%esp
+  800079:	68 11 2c 80 00       	push   $0x802c11
+  80007e:	e8 ef 01 00 00       	call   800272 <cprintf>
+	while ((n = read(fd, buf, sizeof buf-1)) > 0)
+  800083:	83 c4 10             	add    $0x10,%esp
+  800086:	8d 9d f7 fd ff ff    	lea    -0x209(%ebp),%ebx
+  80008c:	eb 1f                	jmp    8000ad <umain+0x7a>
+		panic("icode: open /motd: %e", fd);
+  80008e:	50                   	push   %eax
+  80008f:	68 ee 2b 80 00       	push   $0x802bee
+  800094:	6a 0f                	push   $0xf
+  800096:	68 04 2c 80 00       	push   $0x802c04
+  80009b:	e8 f7 00 00 00       	call   800197 <_panic>
+		sys_cputs(buf, n);
+  8000a0:	83 ec 08             	sub    $0x8,%esp
+  8000a3:	50                   	push   %eax
+  8000a4:	53                   	push   %ebx
+  8000a5:	e8 b1 0a 00 00       	call   800b5b <sys_cputs>
+  8000aa:	83 c4 10             	add    $0x10,%esp
+	while ((n = read(fd, buf, sizeof buf-1)) > 0)
+  8000ad:	83 ec 04             	sub    $0x4,%esp
+  8000b0:	68 00 02 00 00       	push   $0x200
+  8000b5:	53                   	push   %ebx
+  8000b6:	56                   	push   %esi
+  8000b7:	e8 11 11 00 00       	call   8011cd <read>
+  8000bc:	83 c4 10             	add    $0x10,%esp
+  8000bf:	85 c0                	test   %eax,%eax
+  8000c1:	7f dd                	jg     8000a0 <umain+0x6d>
+
+	cprintf("icode: close /motd\n");
+  8000c3:	83 ec 0c             	sub    $0xc,%esp
+  8000c6:	68 24 2c 80 00       	push   $0x802c24
+  8000cb:	e8 a2 01 00 00       	call   800272 <cprintf>
+	close(fd);
+  8000d0:	89 34 24             	mov    %esi,(%esp)
+  8000d3:	e8 b9 0f 00 00       	call   801091 <close>
+
+	cprintf("icode: spawn /init\n");
+  8000d8:	c7 04 24 38 2c 80 00 	movl   $0x802c38,(%esp)
+  8000df:	e8 8e 01 00 00       	call   800272 <cprintf>
+	if ((r = spawnl("/init", "init", "initarg1", "initarg2", (char*)0)) < 0)
+  8000e4:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8000eb:	68 4c 2c 80 00       	push   $0x802c4c
+  8000f0:	68 55 2c 80 00       	push   $0x802c55
+  8000f5:	68 5f 2c 80 00       	push   $0x802c5f
+  8000fa:	68 5e 2c 80 00       	push   $0x802c5e
+  8000ff:	e8 3a 1b 00 00       	call   801c3e <spawnl>
+  800104:	83 c4 20             	add    $0x20,%esp
+  800107:	85 c0                	test   %eax,%eax
+  800109:	78 17                	js     800122 <umain+0xef>
+		panic("icode: spawn /init: %e", r);
+
+	cprintf("icode: exiting\n");
+  80010b:	83 ec 0c             	sub    $0xc,%esp
+  80010e:	68 7b 2c 80 00       	push   $0x802c7b
+  800113:	e8 5a 01 00 00       	call   800272 <cprintf>
+}
+  800118:	83 c4 10             	add    $0x10,%esp
+  80011b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80011e:	5b                   	pop    %ebx
+  80011f:	5e                   	pop    %esi
+  800120:	5d                   	pop    %ebp
+  800121:	c3                   	ret
+		panic("icode: spawn /init: %e", r);
+  800122:	50                   	push   %eax
+  800123:	68 64 2c 80 00       	push   $0x802c64
+  800128:	6a 1a                	push   $0x1a
+  80012a:	68 04 2c 80 00       	push   $0x802c04
+  80012f:	e8 63 00 00 00       	call   800197 <_panic>
+
+00800134 <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  800134:	55                   	push   %ebp
+  800135:	89 e5                	mov    %esp,%ebp
+  800137:	56                   	push   %esi
+  800138:	53                   	push   %ebx
+  800139:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80013c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  80013f:	e8 95 0a 00 00       	call   800bd9 <sys_getenvid>
+  800144:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800149:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80014c:	c1 e0 04             	shl    $0x4,%eax
+  80014f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800154:	a3 08 50 80 00       	mov    %eax,0x805008
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800159:	85 db                	test   %ebx,%ebx
+  80015b:	7e 07                	jle    800164 <libmain+0x30>
+    binaryname = argv[0];
+  80015d:	8b 06                	mov    (%esi),%eax
+  80015f:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  800164:	83 ec 08             	sub    $0x8,%esp
+  800167:	56                   	push   %esi
+  800168:	53                   	push   %ebx
+  800169:	e8 c5 fe ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  80016e:	e8 0a 00 00 00       	call   80017d <exit>
+}
+  800173:	83 c4 10             	add    $0x10,%esp
+  800176:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800179:	5b                   	pop    %ebx
+  80017a:	5e                   	pop    %esi
+  80017b:	5d                   	pop    %ebp
+  80017c:	c3                   	ret
+
+0080017d <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80017d:	55                   	push   %ebp
+  80017e:	89 e5                	mov    %esp,%ebp
+  800180:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800183:	e8 36 0f 00 00       	call   8010be <close_all>
+	sys_env_destroy(0);
+  800188:	83 ec 0c             	sub    $0xc,%esp
+  80018b:	6a 00                	push   $0x0
+  80018d:	e8 06 0a 00 00       	call   800b98 <sys_env_destroy>
+}
+  800192:	83 c4 10             	add    $0x10,%esp
+  800195:	c9                   	leave
+  800196:	c3                   	ret
+
+00800197 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800197:	55                   	push   %ebp
+  800198:	89 e5                	mov    %esp,%ebp
+  80019a:	56                   	push   %esi
+  80019b:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80019c:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80019f:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  8001a5:	e8 2f 0a 00 00       	call   800bd9 <sys_getenvid>
+  8001aa:	83 ec 0c             	sub    $0xc,%esp
+  8001ad:	ff 75 0c             	push   0xc(%ebp)
+  8001b0:	ff 75 08             	push   0x8(%ebp)
+  8001b3:	56                   	push   %esi
+  8001b4:	50                   	push   %eax
+  8001b5:	68 98 2c 80 00       	push   $0x802c98
+  8001ba:	e8 b3 00 00 00       	call   800272 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8001bf:	83 c4 18             	add    $0x18,%esp
+  8001c2:	53                   	push   %ebx
+  8001c3:	ff 75 10             	push   0x10(%ebp)
+  8001c6:	e8 56 00 00 00       	call   800221 <vcprintf>
+	cprintf("\n");
+  8001cb:	c7 04 24 c7 31 80 00 	movl   $0x8031c7,(%esp)
+  8001d2:	e8 9b 00 00 00       	call   800272 <cprintf>
+  8001d7:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8001da:	cc                   	int3
+	while (1)
+  8001db:	eb fd                	jmp    8001da <_panic+0x43>
+
+008001dd <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8001dd:	55                   	push   %ebp
+  8001de:	89 e5                	mov    %esp,%ebp
+  8001e0:	53                   	push   %ebx
+  8001e1:	83 ec 04             	sub    $0x4,%esp
+  8001e4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8001e7:	8b 13                	mov    (%ebx),%edx
+  8001e9:	8d 42 01             	lea    0x1(%edx),%eax
+  8001ec:	89 03                	mov    %eax,(%ebx)
+  8001ee:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001f1:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8001f5:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001fa:	74 09                	je     800205 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001fc:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800200:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800203:	c9                   	leave
+  800204:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800205:	83 ec 08             	sub    $0x8,%esp
+  800208:	68 ff 00 00 00       	push   $0xff
+  80020d:	8d 43 08             	lea    0x8(%ebx),%eax
+  800210:	50                   	push   %eax
+  800211:	e8 45 09 00 00       	call   800b5b <sys_cputs>
+		b->idx = 0;
+  800216:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80021c:	83 c4 10             	add    $0x10,%esp
+  80021f:	eb db                	jmp    8001fc <putch+0x1f>
+
+00800221 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800221:	55                   	push   %ebp
+  800222:	89 e5                	mov    %esp,%ebp
+  800224:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80022a:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800231:	00 00 00 
+	b.cnt = 0;
+  800234:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80023b:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80023e:	ff 75 0c             	push   0xc(%ebp)
+  800241:	ff 75 08             	push   0x8(%ebp)
+  800244:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80024a:	50                   	push   %eax
+  80024b:	68 dd 01 80 00       	push   $0x8001dd
+  800250:	e8 14 01 00 00       	call   800369 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800255:	83 c4 08             	add    $0x8,%esp
+  800258:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80025e:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800264:	50                   	push   %eax
+  800265:	e8 f1 08 00 00       	call   800b5b <sys_cputs>
+
+	return b.cnt;
+}
+  80026a:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800270:	c9                   	leave
+  800271:	c3                   	ret
+
+00800272 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800272:	55                   	push   %ebp
+  800273:	89 e5                	mov    %esp,%ebp
+  800275:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800278:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80027b:	50                   	push   %eax
+  80027c:	ff 75 08             	push   0x8(%ebp)
+  80027f:	e8 9d ff ff ff       	call   800221 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800284:	c9                   	leave
+  800285:	c3                   	ret
+
+00800286 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800286:	55                   	push   %ebp
+  800287:	89 e5                	mov    %esp,%ebp
+  800289:	57                   	push   %edi
+  80028a:	56                   	push   %esi
+  80028b:	53                   	push   %ebx
+  80028c:	83 ec 1c             	sub    $0x1c,%esp
+  80028f:	89 c7                	mov    %eax,%edi
+  800291:	89 d6                	mov    %edx,%esi
+  800293:	8b 45 08             	mov    0x8(%ebp),%eax
+  800296:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800299:	89 d1                	mov    %edx,%ecx
+  80029b:	89 c2                	mov    %eax,%edx
+  80029d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8002a0:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8002a3:	8b 45 10             	mov    0x10(%ebp),%eax
+  8002a6:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8002a9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8002ac:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8002b3:	39 c2                	cmp    %eax,%edx
+  8002b5:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8002b8:	72 3e                	jb     8002f8 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8002ba:	83 ec 0c             	sub    $0xc,%esp
+  8002bd:	ff 75 18             	push   0x18(%ebp)
+  8002c0:	83 eb 01             	sub    $0x1,%ebx
+  8002c3:	53                   	push   %ebx
+  8002c4:	50                   	push   %eax
+  8002c5:	83 ec 08             	sub    $0x8,%esp
+  8002c8:	ff 75 e4             	push   -0x1c(%ebp)
+  8002cb:	ff 75 e0             	push   -0x20(%ebp)
+  8002ce:	ff 75 dc             	push   -0x24(%ebp)
+  8002d1:	ff 75 d8             	push   -0x28(%ebp)
+  8002d4:	e8 57 25 00 00       	call   802830 <__udivdi3>
+  8002d9:	83 c4 18             	add    $0x18,%esp
+  8002dc:	52                   	push   %edx
+  8002dd:	50                   	push   %eax
+  8002de:	89 f2                	mov    %esi,%edx
+  8002e0:	89 f8                	mov    %edi,%eax
+  8002e2:	e8 9f ff ff ff       	call   800286 <printnum>
+  8002e7:	83 c4 20             	add    $0x20,%esp
+  8002ea:	eb 13                	jmp    8002ff <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8002ec:	83 ec 08             	sub    $0x8,%esp
+  8002ef:	56                   	push   %esi
+  8002f0:	ff 75 18             	push   0x18(%ebp)
+  8002f3:	ff d7                	call   *%edi
+  8002f5:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8002f8:	83 eb 01             	sub    $0x1,%ebx
+  8002fb:	85 db                	test   %ebx,%ebx
+  8002fd:	7f ed                	jg     8002ec <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8002ff:	83 ec 08             	sub    $0x8,%esp
+  800302:	56                   	push   %esi
+  800303:	83 ec 04             	sub    $0x4,%esp
+  800306:	ff 75 e4             	push   -0x1c(%ebp)
+  800309:	ff 75 e0             	push   -0x20(%ebp)
+  80030c:	ff 75 dc             	push   -0x24(%ebp)
+  80030f:	ff 75 d8             	push   -0x28(%ebp)
+  800312:	e8 e9 25 00 00       	call   802900 <__umoddi3>
+  800317:	83 c4 14             	add    $0x14,%esp
+  80031a:	0f be 80 bb 2c 80 00 	movsbl 0x802cbb(%eax),%eax
+  800321:	50                   	push   %eax
+  800322:	ff d7                	call   *%edi
+}
+  800324:	83 c4 10             	add    $0x10,%esp
+  800327:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80032a:	5b                   	pop    %ebx
+  80032b:	5e                   	pop    %esi
+  80032c:	5f                   	pop    %edi
+  80032d:	5d                   	pop    %ebp
+  80032e:	c3                   	ret
+
+0080032f <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80032f:	55                   	push   %ebp
+  800330:	89 e5                	mov    %esp,%ebp
+  800332:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800335:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800339:	8b 10                	mov    (%eax),%edx
+  80033b:	3b 50 04             	cmp    0x4(%eax),%edx
+  80033e:	73 0a                	jae    80034a <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800340:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800343:	89 08                	mov    %ecx,(%eax)
+  800345:	8b 45 08             	mov    0x8(%ebp),%eax
+  800348:	88 02                	mov    %al,(%edx)
+}
+  80034a:	5d                   	pop    %ebp
+  80034b:	c3                   	ret
+
+0080034c <printfmt>:
+{
+  80034c:	55                   	push   %ebp
+  80034d:	89 e5                	mov    %esp,%ebp
+  80034f:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800352:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800355:	50                   	push   %eax
+  800356:	ff 75 10             	push   0x10(%ebp)
+  800359:	ff 75 0c             	push   0xc(%ebp)
+  80035c:	ff 75 08             	push   0x8(%ebp)
+  80035f:	e8 05 00 00 00       	call   800369 <vprintfmt>
+}
+  800364:	83 c4 10             	add    $0x10,%esp
+  800367:	c9                   	leave
+  800368:	c3                   	ret
+
+00800369 <vprintfmt>:
+{
+  800369:	55                   	push   %ebp
+  80036a:	89 e5                	mov    %esp,%ebp
+  80036c:	57                   	push   %edi
+  80036d:	56                   	push   %esi
+  80036e:	53                   	push   %ebx
+  80036f:	83 ec 2c             	sub    $0x2c,%esp
+  800372:	8b 75 08             	mov    0x8(%ebp),%esi
+  800375:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800378:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80037b:	eb 0a                	jmp    800387 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80037d:	83 ec 08             	sub    $0x8,%esp
+  800380:	53                   	push   %ebx
+  800381:	50                   	push   %eax
+  800382:	ff d6                	call   *%esi
+  800384:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800387:	83 c7 01             	add    $0x1,%edi
+  80038a:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80038e:	83 f8 25             	cmp    $0x25,%eax
+  800391:	74 0c                	je     80039f <vprintfmt+0x36>
+			if (ch == '\0')
+  800393:	85 c0                	test   %eax,%eax
+  800395:	75 e6                	jne    80037d <vprintfmt+0x14>
+}
+  800397:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80039a:	5b                   	pop    %ebx
+  80039b:	5e                   	pop    %esi
+  80039c:	5f                   	pop    %edi
+  80039d:	5d                   	pop    %ebp
+  80039e:	c3                   	ret
+		padc = ' ';
+  80039f:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8003a3:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8003aa:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8003b1:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8003b8:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003bd:	8d 47 01             	lea    0x1(%edi),%eax
+  8003c0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003c3:	0f b6 17             	movzbl (%edi),%edx
+  8003c6:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8003c9:	3c 55                	cmp    $0x55,%al
+  8003cb:	0f 87 9a 03 00 00    	ja     80076b <vprintfmt+0x402>
+  8003d1:	0f b6 c0             	movzbl %al,%eax
+  8003d4:	ff 24 85 00 2e 80 00 	jmp    *0x802e00(,%eax,4)
+  8003db:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8003de:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8003e2:	eb d9                	jmp    8003bd <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003e4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003e7:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8003eb:	eb d0                	jmp    8003bd <vprintfmt+0x54>
+  8003ed:	0f b6 d2             	movzbl %dl,%edx
+  8003f0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8003f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003f8:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8003fb:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003fe:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800402:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800405:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800408:	83 f9 09             	cmp    $0x9,%ecx
+  80040b:	77 55                	ja     800462 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  80040d:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800410:	eb e9                	jmp    8003fb <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800412:	8b 45 14             	mov    0x14(%ebp),%eax
+  800415:	8b 00                	mov    (%eax),%eax
+  800417:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80041a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80041d:	8d 40 04             	lea    0x4(%eax),%eax
+  800420:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800423:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800426:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80042a:	79 91                	jns    8003bd <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80042c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80042f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800432:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800439:	eb 82                	jmp    8003bd <vprintfmt+0x54>
+			if (width < 0)
+  80043b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80043e:	85 d2                	test   %edx,%edx
+  800440:	b8 00 00 00 00       	mov    $0x0,%eax
+  800445:	0f 49 c2             	cmovns %edx,%eax
+  800448:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80044b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80044e:	e9 6a ff ff ff       	jmp    8003bd <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800453:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800456:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80045d:	e9 5b ff ff ff       	jmp    8003bd <vprintfmt+0x54>
+  800462:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800465:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800468:	eb bc                	jmp    800426 <vprintfmt+0xbd>
+			lflag++;
+  80046a:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80046d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800470:	e9 48 ff ff ff       	jmp    8003bd <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800475:	8b 45 14             	mov    0x14(%ebp),%eax
+  800478:	8d 78 04             	lea    0x4(%eax),%edi
+  80047b:	83 ec 08             	sub    $0x8,%esp
+  80047e:	53                   	push   %ebx
+  80047f:	ff 30                	push   (%eax)
+  800481:	ff d6                	call   *%esi
+			break;
+  800483:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800486:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800489:	e9 7c 02 00 00       	jmp    80070a <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  80048e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800491:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800494:	8b 10                	mov    (%eax),%edx
+  800496:	89 d0                	mov    %edx,%eax
+  800498:	f7 d8                	neg    %eax
+  80049a:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80049d:	83 f8 10             	cmp    $0x10,%eax
+  8004a0:	7f 23                	jg     8004c5 <vprintfmt+0x15c>
+  8004a2:	8b 14 85 60 2f 80 00 	mov    0x802f60(,%eax,4),%edx
+  8004a9:	85 d2                	test   %edx,%edx
+  8004ab:	74 18                	je     8004c5 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8004ad:	52                   	push   %edx
+  8004ae:	68 99 30 80 00       	push   $0x803099
+  8004b3:	53                   	push   %ebx
+  8004b4:	56                   	push   %esi
+  8004b5:	e8 92 fe ff ff       	call   80034c <printfmt>
+  8004ba:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004bd:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8004c0:	e9 45 02 00 00       	jmp    80070a <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  8004c5:	50                   	push   %eax
+  8004c6:	68 d3 2c 80 00       	push   $0x802cd3
+  8004cb:	53                   	push   %ebx
+  8004cc:	56                   	push   %esi
+  8004cd:	e8 7a fe ff ff       	call   80034c <printfmt>
+  8004d2:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004d5:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8004d8:	e9 2d 02 00 00       	jmp    80070a <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004dd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004e0:	83 c0 04             	add    $0x4,%eax
+  8004e3:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8004e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004e9:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8004eb:	85 c9                	test   %ecx,%ecx
+  8004ed:	b8 cc 2c 80 00       	mov    $0x802ccc,%eax
+  8004f2:	0f 45 c1             	cmovne %ecx,%eax
+  8004f5:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8004f8:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004fc:	7e 06                	jle    800504 <vprintfmt+0x19b>
+  8004fe:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800502:	75 0b                	jne    80050f <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800504:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800507:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80050a:	89 75 08             	mov    %esi,0x8(%ebp)
+  80050d:	eb 5c                	jmp    80056b <vprintfmt+0x202>
+  80050f:	83 ec 08             	sub    $0x8,%esp
+  800512:	ff 75 d0             	push   -0x30(%ebp)
+  800515:	ff 75 cc             	push   -0x34(%ebp)
+  800518:	e8 eb 02 00 00       	call   800808 <strnlen>
+  80051d:	89 c2                	mov    %eax,%edx
+  80051f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800522:	29 d0                	sub    %edx,%eax
+  800524:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800527:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80052b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80052e:	89 75 08             	mov    %esi,0x8(%ebp)
+  800531:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800533:	eb 0e                	jmp    800543 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800535:	83 ec 08             	sub    $0x8,%esp
+  800538:	53                   	push   %ebx
+  800539:	57                   	push   %edi
+  80053a:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80053d:	83 ee 01             	sub    $0x1,%esi
+  800540:	83 c4 10             	add    $0x10,%esp
+  800543:	85 f6                	test   %esi,%esi
+  800545:	7f ee                	jg     800535 <vprintfmt+0x1cc>
+  800547:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80054a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80054d:	85 c0                	test   %eax,%eax
+  80054f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800554:	0f 49 d0             	cmovns %eax,%edx
+  800557:	29 d0                	sub    %edx,%eax
+  800559:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80055c:	eb a6                	jmp    800504 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  80055e:	83 ec 08             	sub    $0x8,%esp
+  800561:	53                   	push   %ebx
+  800562:	52                   	push   %edx
+  800563:	ff 55 08             	call   *0x8(%ebp)
+  800566:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800569:	89 f1                	mov    %esi,%ecx
+  80056b:	8d 71 01             	lea    0x1(%ecx),%esi
+  80056e:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800572:	0f be d0             	movsbl %al,%edx
+  800575:	85 d2                	test   %edx,%edx
+  800577:	74 28                	je     8005a1 <vprintfmt+0x238>
+  800579:	85 ff                	test   %edi,%edi
+  80057b:	78 05                	js     800582 <vprintfmt+0x219>
+  80057d:	83 ef 01             	sub    $0x1,%edi
+  800580:	78 30                	js     8005b2 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800582:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800586:	74 d6                	je     80055e <vprintfmt+0x1f5>
+  800588:	0f be c0             	movsbl %al,%eax
+  80058b:	83 e8 20             	sub    $0x20,%eax
+  80058e:	83 f8 5e             	cmp    $0x5e,%eax
+  800591:	76 cb                	jbe    80055e <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800593:	83 ec 08             	sub    $0x8,%esp
+  800596:	53                   	push   %ebx
+  800597:	6a 3f                	push   $0x3f
+  800599:	ff 55 08             	call   *0x8(%ebp)
+  80059c:	83 c4 10             	add    $0x10,%esp
+  80059f:	eb c8                	jmp    800569 <vprintfmt+0x200>
+  8005a1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005a4:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005a7:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8005aa:	01 d0                	add    %edx,%eax
+  8005ac:	29 c8                	sub    %ecx,%eax
+  8005ae:	89 c7                	mov    %eax,%edi
+  8005b0:	eb 13                	jmp    8005c5 <vprintfmt+0x25c>
+  8005b2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005b5:	eb ed                	jmp    8005a4 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8005b7:	83 ec 08             	sub    $0x8,%esp
+  8005ba:	53                   	push   %ebx
+  8005bb:	6a 20                	push   $0x20
+  8005bd:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8005bf:	83 ef 01             	sub    $0x1,%edi
+  8005c2:	83 c4 10             	add    $0x10,%esp
+  8005c5:	85 ff                	test   %edi,%edi
+  8005c7:	7f ee                	jg     8005b7 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005c9:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8005cc:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005cf:	e9 36 01 00 00       	jmp    80070a <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  8005d4:	83 f9 01             	cmp    $0x1,%ecx
+  8005d7:	7f 1f                	jg     8005f8 <vprintfmt+0x28f>
+	else if (lflag)
+  8005d9:	85 c9                	test   %ecx,%ecx
+  8005db:	74 67                	je     800644 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8005dd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e0:	8b 00                	mov    (%eax),%eax
+  8005e2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005e5:	89 c1                	mov    %eax,%ecx
+  8005e7:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005ea:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005ed:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f0:	8d 40 04             	lea    0x4(%eax),%eax
+  8005f3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005f6:	eb 17                	jmp    80060f <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8005f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005fb:	8b 50 04             	mov    0x4(%eax),%edx
+  8005fe:	8b 00                	mov    (%eax),%eax
+  800600:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800603:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800606:	8b 45 14             	mov    0x14(%ebp),%eax
+  800609:	8d 40 08             	lea    0x8(%eax),%eax
+  80060c:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80060f:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800612:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800615:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80061a:	85 c9                	test   %ecx,%ecx
+  80061c:	0f 89 ce 00 00 00    	jns    8006f0 <vprintfmt+0x387>
+				putch('-', putdat);
+  800622:	83 ec 08             	sub    $0x8,%esp
+  800625:	53                   	push   %ebx
+  800626:	6a 2d                	push   $0x2d
+  800628:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80062a:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80062d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800630:	f7 da                	neg    %edx
+  800632:	83 d1 00             	adc    $0x0,%ecx
+  800635:	f7 d9                	neg    %ecx
+  800637:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80063a:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80063f:	e9 ac 00 00 00       	jmp    8006f0 <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  800644:	8b 45 14             	mov    0x14(%ebp),%eax
+  800647:	8b 00                	mov    (%eax),%eax
+  800649:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80064c:	89 c1                	mov    %eax,%ecx
+  80064e:	c1 f9 1f             	sar    $0x1f,%ecx
+  800651:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800654:	8b 45 14             	mov    0x14(%ebp),%eax
+  800657:	8d 40 04             	lea    0x4(%eax),%eax
+  80065a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80065d:	eb b0                	jmp    80060f <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  80065f:	83 f9 01             	cmp    $0x1,%ecx
+  800662:	7f 1b                	jg     80067f <vprintfmt+0x316>
+	else if (lflag)
+  800664:	85 c9                	test   %ecx,%ecx
+  800666:	74 2c                	je     800694 <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  800668:	8b 45 14             	mov    0x14(%ebp),%eax
+  80066b:	8b 10                	mov    (%eax),%edx
+  80066d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800672:	8d 40 04             	lea    0x4(%eax),%eax
+  800675:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800678:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80067d:	eb 71                	jmp    8006f0 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  80067f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800682:	8b 10                	mov    (%eax),%edx
+  800684:	8b 48 04             	mov    0x4(%eax),%ecx
+  800687:	8d 40 08             	lea    0x8(%eax),%eax
+  80068a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80068d:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800692:	eb 5c                	jmp    8006f0 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  800694:	8b 45 14             	mov    0x14(%ebp),%eax
+  800697:	8b 10                	mov    (%eax),%edx
+  800699:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80069e:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006a4:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8006a9:	eb 45                	jmp    8006f0 <vprintfmt+0x387>
+			putch('X', putdat);
+  8006ab:	83 ec 08             	sub    $0x8,%esp
+  8006ae:	53                   	push   %ebx
+  8006af:	6a 58                	push   $0x58
+  8006b1:	ff d6                	call   *%esi
+			putch('X', putdat);
+  8006b3:	83 c4 08             	add    $0x8,%esp
+  8006b6:	53                   	push   %ebx
+  8006b7:	6a 58                	push   $0x58
+  8006b9:	ff d6                	call   *%esi
+			putch('X', putdat);
+  8006bb:	83 c4 08             	add    $0x8,%esp
+  8006be:	53                   	push   %ebx
+  8006bf:	6a 58                	push   $0x58
+  8006c1:	ff d6                	call   *%esi
+			break;
+  8006c3:	83 c4 10             	add    $0x10,%esp
+  8006c6:	eb 42                	jmp    80070a <vprintfmt+0x3a1>
+			putch('0', putdat);
+  8006c8:	83 ec 08             	sub    $0x8,%esp
+  8006cb:	53                   	push   %ebx
+  8006cc:	6a 30                	push   $0x30
+  8006ce:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8006d0:	83 c4 08             	add    $0x8,%esp
+  8006d3:	53                   	push   %ebx
+  8006d4:	6a 78                	push   $0x78
+  8006d6:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8006d8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006db:	8b 10                	mov    (%eax),%edx
+  8006dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8006e2:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8006e5:	8d 40 04             	lea    0x4(%eax),%eax
+  8006e8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006eb:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8006f0:	83 ec 0c             	sub    $0xc,%esp
+  8006f3:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8006f7:	50                   	push   %eax
+  8006f8:	ff 75 e0             	push   -0x20(%ebp)
+  8006fb:	57                   	push   %edi
+  8006fc:	51                   	push   %ecx
+  8006fd:	52                   	push   %edx
+  8006fe:	89 da                	mov    %ebx,%edx
+  800700:	89 f0                	mov    %esi,%eax
+  800702:	e8 7f fb ff ff       	call   800286 <printnum>
+			break;
+  800707:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80070a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80070d:	e9 75 fc ff ff       	jmp    800387 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800712:	83 f9 01             	cmp    $0x1,%ecx
+  800715:	7f 1b                	jg     800732 <vprintfmt+0x3c9>
+	else if (lflag)
+  800717:	85 c9                	test   %ecx,%ecx
+  800719:	74 2c                	je     800747 <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  80071b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071e:	8b 10                	mov    (%eax),%edx
+  800720:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800725:	8d 40 04             	lea    0x4(%eax),%eax
+  800728:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80072b:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800730:	eb be                	jmp    8006f0 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  800732:	8b 45 14             	mov    0x14(%ebp),%eax
+  800735:	8b 10                	mov    (%eax),%edx
+  800737:	8b 48 04             	mov    0x4(%eax),%ecx
+  80073a:	8d 40 08             	lea    0x8(%eax),%eax
+  80073d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800740:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800745:	eb a9                	jmp    8006f0 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  800747:	8b 45 14             	mov    0x14(%ebp),%eax
+  80074a:	8b 10                	mov    (%eax),%edx
+  80074c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800751:	8d 40 04             	lea    0x4(%eax),%eax
+  800754:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800757:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80075c:	eb 92                	jmp    8006f0 <vprintfmt+0x387>
+			putch(ch, putdat);
+  80075e:	83 ec 08             	sub    $0x8,%esp
+  800761:	53                   	push   %ebx
+  800762:	6a 25                	push   $0x25
+  800764:	ff d6                	call   *%esi
+			break;
+  800766:	83 c4 10             	add    $0x10,%esp
+  800769:	eb 9f                	jmp    80070a <vprintfmt+0x3a1>
+			putch('%', putdat);
+  80076b:	83 ec 08             	sub    $0x8,%esp
+  80076e:	53                   	push   %ebx
+  80076f:	6a 25                	push   $0x25
+  800771:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800773:	83 c4 10             	add    $0x10,%esp
+  800776:	89 f8                	mov    %edi,%eax
+  800778:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80077c:	74 05                	je     800783 <vprintfmt+0x41a>
+  80077e:	83 e8 01             	sub    $0x1,%eax
+  800781:	eb f5                	jmp    800778 <vprintfmt+0x40f>
+  800783:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800786:	eb 82                	jmp    80070a <vprintfmt+0x3a1>
+
+00800788 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800788:	55                   	push   %ebp
+  800789:	89 e5                	mov    %esp,%ebp
+  80078b:	83 ec 18             	sub    $0x18,%esp
+  80078e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800791:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800794:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800797:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80079b:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80079e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8007a5:	85 c0                	test   %eax,%eax
+  8007a7:	74 26                	je     8007cf <vsnprintf+0x47>
+  8007a9:	85 d2                	test   %edx,%edx
+  8007ab:	7e 22                	jle    8007cf <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8007ad:	ff 75 14             	push   0x14(%ebp)
+  8007b0:	ff 75 10             	push   0x10(%ebp)
+  8007b3:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8007b6:	50                   	push   %eax
+  8007b7:	68 2f 03 80 00       	push   $0x80032f
+  8007bc:	e8 a8 fb ff ff       	call   800369 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8007c1:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8007c4:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8007c7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007ca:	83 c4 10             	add    $0x10,%esp
+}
+  8007cd:	c9                   	leave
+  8007ce:	c3                   	ret
+		return -E_INVAL;
+  8007cf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007d4:	eb f7                	jmp    8007cd <vsnprintf+0x45>
+
+008007d6 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8007d6:	55                   	push   %ebp
+  8007d7:	89 e5                	mov    %esp,%ebp
+  8007d9:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8007dc:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8007df:	50                   	push   %eax
+  8007e0:	ff 75 10             	push   0x10(%ebp)
+  8007e3:	ff 75 0c             	push   0xc(%ebp)
+  8007e6:	ff 75 08             	push   0x8(%ebp)
+  8007e9:	e8 9a ff ff ff       	call   800788 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8007ee:	c9                   	leave
+  8007ef:	c3                   	ret
+
+008007f0 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007f0:	55                   	push   %ebp
+  8007f1:	89 e5                	mov    %esp,%ebp
+  8007f3:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8007f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fb:	eb 03                	jmp    800800 <strlen+0x10>
+		n++;
+  8007fd:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800800:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800804:	75 f7                	jne    8007fd <strlen+0xd>
+	return n;
+}
+  800806:	5d                   	pop    %ebp
+  800807:	c3                   	ret
+
+00800808 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800808:	55                   	push   %ebp
+  800809:	89 e5                	mov    %esp,%ebp
+  80080b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80080e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800811:	b8 00 00 00 00       	mov    $0x0,%eax
+  800816:	eb 03                	jmp    80081b <strnlen+0x13>
+		n++;
+  800818:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80081b:	39 d0                	cmp    %edx,%eax
+  80081d:	74 08                	je     800827 <strnlen+0x1f>
+  80081f:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800823:	75 f3                	jne    800818 <strnlen+0x10>
+  800825:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800827:	89 d0                	mov    %edx,%eax
+  800829:	5d                   	pop    %ebp
+  80082a:	c3                   	ret
+
+0080082b <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80082b:	55                   	push   %ebp
+  80082c:	89 e5                	mov    %esp,%ebp
+  80082e:	53                   	push   %ebx
+  80082f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800832:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800835:	b8 00 00 00 00       	mov    $0x0,%eax
+  80083a:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80083e:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800841:	83 c0 01             	add    $0x1,%eax
+  800844:	84 d2                	test   %dl,%dl
+  800846:	75 f2                	jne    80083a <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800848:	89 c8                	mov    %ecx,%eax
+  80084a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80084d:	c9                   	leave
+  80084e:	c3                   	ret
+
+0080084f <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80084f:	55                   	push   %ebp
+  800850:	89 e5                	mov    %esp,%ebp
+  800852:	53                   	push   %ebx
+  800853:	83 ec 10             	sub    $0x10,%esp
+  800856:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800859:	53                   	push   %ebx
+  80085a:	e8 91 ff ff ff       	call   8007f0 <strlen>
+  80085f:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800862:	ff 75 0c             	push   0xc(%ebp)
+  800865:	01 d8                	add    %ebx,%eax
+  800867:	50                   	push   %eax
+  800868:	e8 be ff ff ff       	call   80082b <strcpy>
+	return dst;
+}
+  80086d:	89 d8                	mov    %ebx,%eax
+  80086f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800872:	c9                   	leave
+  800873:	c3                   	ret
+
+00800874 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800874:	55                   	push   %ebp
+  800875:	89 e5                	mov    %esp,%ebp
+  800877:	56                   	push   %esi
+  800878:	53                   	push   %ebx
+  800879:	8b 75 08             	mov    0x8(%ebp),%esi
+  80087c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80087f:	89 f3                	mov    %esi,%ebx
+  800881:	03 5d 10             	add    0x10(%ebp),%ebx
+  800884:	89 f0                	mov    %esi,%eax
+  800886:	eb 0f                	jmp    800897 <strncpy+0x23>
+		*dst++ = *src;
+  800888:	83 c0 01             	add    $0x1,%eax
+  80088b:	0f b6 0a             	movzbl (%edx),%ecx
+  80088e:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800891:	80 f9 01             	cmp    $0x1,%cl
+  800894:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800897:	39 d8                	cmp    %ebx,%eax
+  800899:	75 ed                	jne    800888 <strncpy+0x14>
+	}
+	return ret;
+}
+  80089b:	89 f0                	mov    %esi,%eax
+  80089d:	5b                   	pop    %ebx
+  80089e:	5e                   	pop    %esi
+  80089f:	5d                   	pop    %ebp
+  8008a0:	c3                   	ret
+
+008008a1 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8008a1:	55                   	push   %ebp
+  8008a2:	89 e5                	mov    %esp,%ebp
+  8008a4:	56                   	push   %esi
+  8008a5:	53                   	push   %ebx
+  8008a6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008a9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008ac:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8008af:	89 f0                	mov    %esi,%eax
+  8008b1:	85 d2                	test   %edx,%edx
+  8008b3:	74 21                	je     8008d6 <strlcpy+0x35>
+  8008b5:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8008b9:	89 f2                	mov    %esi,%edx
+  8008bb:	eb 09                	jmp    8008c6 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8008bd:	83 c1 01             	add    $0x1,%ecx
+  8008c0:	83 c2 01             	add    $0x1,%edx
+  8008c3:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8008c6:	39 c2                	cmp    %eax,%edx
+  8008c8:	74 09                	je     8008d3 <strlcpy+0x32>
+  8008ca:	0f b6 19             	movzbl (%ecx),%ebx
+  8008cd:	84 db                	test   %bl,%bl
+  8008cf:	75 ec                	jne    8008bd <strlcpy+0x1c>
+  8008d1:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8008d3:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8008d6:	29 f0                	sub    %esi,%eax
+}
+  8008d8:	5b                   	pop    %ebx
+  8008d9:	5e                   	pop    %esi
+  8008da:	5d                   	pop    %ebp
+  8008db:	c3                   	ret
+
+008008dc <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8008dc:	55                   	push   %ebp
+  8008dd:	89 e5                	mov    %esp,%ebp
+  8008df:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008e2:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8008e5:	eb 06                	jmp    8008ed <strcmp+0x11>
+		p++, q++;
+  8008e7:	83 c1 01             	add    $0x1,%ecx
+  8008ea:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8008ed:	0f b6 01             	movzbl (%ecx),%eax
+  8008f0:	84 c0                	test   %al,%al
+  8008f2:	74 04                	je     8008f8 <strcmp+0x1c>
+  8008f4:	3a 02                	cmp    (%edx),%al
+  8008f6:	74 ef                	je     8008e7 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008f8:	0f b6 c0             	movzbl %al,%eax
+  8008fb:	0f b6 12             	movzbl (%edx),%edx
+  8008fe:	29 d0                	sub    %edx,%eax
+}
+  800900:	5d                   	pop    %ebp
+  800901:	c3                   	ret
+
+00800902 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800902:	55                   	push   %ebp
+  800903:	89 e5                	mov    %esp,%ebp
+  800905:	53                   	push   %ebx
+  800906:	8b 45 08             	mov    0x8(%ebp),%eax
+  800909:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80090c:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80090f:	eb 09                	jmp    80091a <strncmp+0x18>
+		n--, p++, q++;
+  800911:	83 ea 01             	sub    $0x1,%edx
+  800914:	83 c0 01             	add    $0x1,%eax
+  800917:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80091a:	85 d2                	test   %edx,%edx
+  80091c:	74 18                	je     800936 <strncmp+0x34>
+  80091e:	0f b6 18             	movzbl (%eax),%ebx
+  800921:	84 db                	test   %bl,%bl
+  800923:	74 04                	je     800929 <strncmp+0x27>
+  800925:	3a 19                	cmp    (%ecx),%bl
+  800927:	74 e8                	je     800911 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800929:	0f b6 00             	movzbl (%eax),%eax
+  80092c:	0f b6 11             	movzbl (%ecx),%edx
+  80092f:	29 d0                	sub    %edx,%eax
+}
+  800931:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800934:	c9                   	leave
+  800935:	c3                   	ret
+		return 0;
+  800936:	b8 00 00 00 00       	mov    $0x0,%eax
+  80093b:	eb f4                	jmp    800931 <strncmp+0x2f>
+
+0080093d <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80093d:	55                   	push   %ebp
+  80093e:	89 e5                	mov    %esp,%ebp
+  800940:	8b 45 08             	mov    0x8(%ebp),%eax
+  800943:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800947:	eb 03                	jmp    80094c <strchr+0xf>
+  800949:	83 c0 01             	add    $0x1,%eax
+  80094c:	0f b6 10             	movzbl (%eax),%edx
+  80094f:	84 d2                	test   %dl,%dl
+  800951:	74 06                	je     800959 <strchr+0x1c>
+		if (*s == c)
+  800953:	38 ca                	cmp    %cl,%dl
+  800955:	75 f2                	jne    800949 <strchr+0xc>
+  800957:	eb 05                	jmp    80095e <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800959:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80095e:	5d                   	pop    %ebp
+  80095f:	c3                   	ret
+
+00800960 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800960:	55                   	push   %ebp
+  800961:	89 e5                	mov    %esp,%ebp
+  800963:	8b 45 08             	mov    0x8(%ebp),%eax
+  800966:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80096a:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  80096d:	38 ca                	cmp    %cl,%dl
+  80096f:	74 09                	je     80097a <strfind+0x1a>
+  800971:	84 d2                	test   %dl,%dl
+  800973:	74 05                	je     80097a <strfind+0x1a>
+	for (; *s; s++)
+  800975:	83 c0 01             	add    $0x1,%eax
+  800978:	eb f0                	jmp    80096a <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  80097a:	5d                   	pop    %ebp
+  80097b:	c3                   	ret
+
+0080097c <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  80097c:	55                   	push   %ebp
+  80097d:	89 e5                	mov    %esp,%ebp
+  80097f:	57                   	push   %edi
+  800980:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800983:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800986:	85 c9                	test   %ecx,%ecx
+  800988:	74 20                	je     8009aa <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  80098a:	89 f8                	mov    %edi,%eax
+  80098c:	09 c8                	or     %ecx,%eax
+  80098e:	a8 03                	test   $0x3,%al
+  800990:	75 12                	jne    8009a4 <memset+0x28>
+		c &= 0xFF;
+  800992:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800996:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  80099c:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  80099f:	fc                   	cld
+  8009a0:	f3 ab                	rep stos %eax,%es:(%edi)
+  8009a2:	eb 06                	jmp    8009aa <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8009a4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8009a7:	fc                   	cld
+  8009a8:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8009aa:	89 f8                	mov    %edi,%eax
+  8009ac:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8009af:	c9                   	leave
+  8009b0:	c3                   	ret
+
+008009b1 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8009b1:	55                   	push   %ebp
+  8009b2:	89 e5                	mov    %esp,%ebp
+  8009b4:	57                   	push   %edi
+  8009b5:	56                   	push   %esi
+  8009b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009b9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8009bc:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8009bf:	39 c6                	cmp    %eax,%esi
+  8009c1:	73 32                	jae    8009f5 <memmove+0x44>
+  8009c3:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8009c6:	39 d0                	cmp    %edx,%eax
+  8009c8:	73 2b                	jae    8009f5 <memmove+0x44>
+		s += n;
+		d += n;
+  8009ca:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009cd:	89 d6                	mov    %edx,%esi
+  8009cf:	09 fe                	or     %edi,%esi
+  8009d1:	09 ce                	or     %ecx,%esi
+  8009d3:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8009d9:	75 0e                	jne    8009e9 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8009db:	83 ef 04             	sub    $0x4,%edi
+  8009de:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8009e1:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8009e4:	fd                   	std
+  8009e5:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009e7:	eb 09                	jmp    8009f2 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8009e9:	83 ef 01             	sub    $0x1,%edi
+  8009ec:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8009ef:	fd                   	std
+  8009f0:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8009f2:	fc                   	cld
+  8009f3:	eb 1a                	jmp    800a0f <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009f5:	89 f2                	mov    %esi,%edx
+  8009f7:	09 c2                	or     %eax,%edx
+  8009f9:	09 ca                	or     %ecx,%edx
+  8009fb:	f6 c2 03             	test   $0x3,%dl
+  8009fe:	75 0a                	jne    800a0a <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a00:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a03:	89 c7                	mov    %eax,%edi
+  800a05:	fc                   	cld
+  800a06:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a08:	eb 05                	jmp    800a0f <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a0a:	89 c7                	mov    %eax,%edi
+  800a0c:	fc                   	cld
+  800a0d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a0f:	5e                   	pop    %esi
+  800a10:	5f                   	pop    %edi
+  800a11:	5d                   	pop    %ebp
+  800a12:	c3                   	ret
+
+00800a13 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a13:	55                   	push   %ebp
+  800a14:	89 e5                	mov    %esp,%ebp
+  800a16:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a19:	ff 75 10             	push   0x10(%ebp)
+  800a1c:	ff 75 0c             	push   0xc(%ebp)
+  800a1f:	ff 75 08             	push   0x8(%ebp)
+  800a22:	e8 8a ff ff ff       	call   8009b1 <memmove>
+}
+  800a27:	c9                   	leave
+  800a28:	c3                   	ret
+
+00800a29 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a29:	55                   	push   %ebp
+  800a2a:	89 e5                	mov    %esp,%ebp
+  800a2c:	56                   	push   %esi
+  800a2d:	53                   	push   %ebx
+  800a2e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a31:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a34:	89 c6                	mov    %eax,%esi
+  800a36:	03 75 10             	add    0x10(%ebp),%esi
+  800a39:	eb 06                	jmp    800a41 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a3b:	83 c0 01             	add    $0x1,%eax
+  800a3e:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a41:	39 f0                	cmp    %esi,%eax
+  800a43:	74 14                	je     800a59 <memcmp+0x30>
+		if (*s1 != *s2)
+  800a45:	0f b6 08             	movzbl (%eax),%ecx
+  800a48:	0f b6 1a             	movzbl (%edx),%ebx
+  800a4b:	38 d9                	cmp    %bl,%cl
+  800a4d:	74 ec                	je     800a3b <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a4f:	0f b6 c1             	movzbl %cl,%eax
+  800a52:	0f b6 db             	movzbl %bl,%ebx
+  800a55:	29 d8                	sub    %ebx,%eax
+  800a57:	eb 05                	jmp    800a5e <memcmp+0x35>
+	}
+
+	return 0;
+  800a59:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a5e:	5b                   	pop    %ebx
+  800a5f:	5e                   	pop    %esi
+  800a60:	5d                   	pop    %ebp
+  800a61:	c3                   	ret
+
+00800a62 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a62:	55                   	push   %ebp
+  800a63:	89 e5                	mov    %esp,%ebp
+  800a65:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a68:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a6b:	89 c2                	mov    %eax,%edx
+  800a6d:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a70:	eb 03                	jmp    800a75 <memfind+0x13>
+  800a72:	83 c0 01             	add    $0x1,%eax
+  800a75:	39 d0                	cmp    %edx,%eax
+  800a77:	73 04                	jae    800a7d <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a79:	38 08                	cmp    %cl,(%eax)
+  800a7b:	75 f5                	jne    800a72 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a7d:	5d                   	pop    %ebp
+  800a7e:	c3                   	ret
+
+00800a7f <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a7f:	55                   	push   %ebp
+  800a80:	89 e5                	mov    %esp,%ebp
+  800a82:	57                   	push   %edi
+  800a83:	56                   	push   %esi
+  800a84:	53                   	push   %ebx
+  800a85:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a88:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a8b:	eb 03                	jmp    800a90 <strtol+0x11>
+		s++;
+  800a8d:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a90:	0f b6 02             	movzbl (%edx),%eax
+  800a93:	3c 20                	cmp    $0x20,%al
+  800a95:	74 f6                	je     800a8d <strtol+0xe>
+  800a97:	3c 09                	cmp    $0x9,%al
+  800a99:	74 f2                	je     800a8d <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a9b:	3c 2b                	cmp    $0x2b,%al
+  800a9d:	74 2a                	je     800ac9 <strtol+0x4a>
+	int neg = 0;
+  800a9f:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800aa4:	3c 2d                	cmp    $0x2d,%al
+  800aa6:	74 2b                	je     800ad3 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800aa8:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800aae:	75 0f                	jne    800abf <strtol+0x40>
+  800ab0:	80 3a 30             	cmpb   $0x30,(%edx)
+  800ab3:	74 28                	je     800add <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800ab5:	85 db                	test   %ebx,%ebx
+  800ab7:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800abc:	0f 44 d8             	cmove  %eax,%ebx
+  800abf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ac4:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800ac7:	eb 46                	jmp    800b0f <strtol+0x90>
+		s++;
+  800ac9:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800acc:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ad1:	eb d5                	jmp    800aa8 <strtol+0x29>
+		s++, neg = 1;
+  800ad3:	83 c2 01             	add    $0x1,%edx
+  800ad6:	bf 01 00 00 00       	mov    $0x1,%edi
+  800adb:	eb cb                	jmp    800aa8 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800add:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800ae1:	74 0e                	je     800af1 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800ae3:	85 db                	test   %ebx,%ebx
+  800ae5:	75 d8                	jne    800abf <strtol+0x40>
+		s++, base = 8;
+  800ae7:	83 c2 01             	add    $0x1,%edx
+  800aea:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800aef:	eb ce                	jmp    800abf <strtol+0x40>
+		s += 2, base = 16;
+  800af1:	83 c2 02             	add    $0x2,%edx
+  800af4:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800af9:	eb c4                	jmp    800abf <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800afb:	0f be c0             	movsbl %al,%eax
+  800afe:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800b01:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b04:	7d 3a                	jge    800b40 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800b06:	83 c2 01             	add    $0x1,%edx
+  800b09:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800b0d:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800b0f:	0f b6 02             	movzbl (%edx),%eax
+  800b12:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b15:	89 f3                	mov    %esi,%ebx
+  800b17:	80 fb 09             	cmp    $0x9,%bl
+  800b1a:	76 df                	jbe    800afb <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800b1c:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b1f:	89 f3                	mov    %esi,%ebx
+  800b21:	80 fb 19             	cmp    $0x19,%bl
+  800b24:	77 08                	ja     800b2e <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800b26:	0f be c0             	movsbl %al,%eax
+  800b29:	83 e8 57             	sub    $0x57,%eax
+  800b2c:	eb d3                	jmp    800b01 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b2e:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b31:	89 f3                	mov    %esi,%ebx
+  800b33:	80 fb 19             	cmp    $0x19,%bl
+  800b36:	77 08                	ja     800b40 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800b38:	0f be c0             	movsbl %al,%eax
+  800b3b:	83 e8 37             	sub    $0x37,%eax
+  800b3e:	eb c1                	jmp    800b01 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b40:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b44:	74 05                	je     800b4b <strtol+0xcc>
+		*endptr = (char *) s;
+  800b46:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b49:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800b4b:	89 c8                	mov    %ecx,%eax
+  800b4d:	f7 d8                	neg    %eax
+  800b4f:	85 ff                	test   %edi,%edi
+  800b51:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b54:	89 c8                	mov    %ecx,%eax
+  800b56:	5b                   	pop    %ebx
+  800b57:	5e                   	pop    %esi
+  800b58:	5f                   	pop    %edi
+  800b59:	5d                   	pop    %ebp
+  800b5a:	c3                   	ret
+
+00800b5b <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800b5b:	55                   	push   %ebp
+  800b5c:	89 e5                	mov    %esp,%ebp
+  800b5e:	57                   	push   %edi
+  800b5f:	56                   	push   %esi
+  800b60:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800b61:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b66:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b69:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b6c:	89 c3                	mov    %eax,%ebx
+  800b6e:	89 c7                	mov    %eax,%edi
+  800b70:	89 c6                	mov    %eax,%esi
+  800b72:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  800b74:	5b                   	pop    %ebx
+  800b75:	5e                   	pop    %esi
+  800b76:	5f                   	pop    %edi
+  800b77:	5d                   	pop    %ebp
+  800b78:	c3                   	ret
+
+00800b79 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800b79:	55                   	push   %ebp
+  800b7a:	89 e5                	mov    %esp,%ebp
+  800b7c:	57                   	push   %edi
+  800b7d:	56                   	push   %esi
+  800b7e:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800b7f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b84:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b89:	89 d1                	mov    %edx,%ecx
+  800b8b:	89 d3                	mov    %edx,%ebx
+  800b8d:	89 d7                	mov    %edx,%edi
+  800b8f:	89 d6                	mov    %edx,%esi
+  800b91:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800b93:	5b                   	pop    %ebx
+  800b94:	5e                   	pop    %esi
+  800b95:	5f                   	pop    %edi
+  800b96:	5d                   	pop    %ebp
+  800b97:	c3                   	ret
+
+00800b98 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800b98:	55                   	push   %ebp
+  800b99:	89 e5                	mov    %esp,%ebp
+  800b9b:	57                   	push   %edi
+  800b9c:	56                   	push   %esi
+  800b9d:	53                   	push   %ebx
+  800b9e:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800ba1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ba6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ba9:	b8 03 00 00 00       	mov    $0x3,%eax
+  800bae:	89 cb                	mov    %ecx,%ebx
+  800bb0:	89 cf                	mov    %ecx,%edi
+  800bb2:	89 ce                	mov    %ecx,%esi
+  800bb4:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800bb6:	85 c0                	test   %eax,%eax
+  800bb8:	7f 08                	jg     800bc2 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800bba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bbd:	5b                   	pop    %ebx
+  800bbe:	5e                   	pop    %esi
+  800bbf:	5f                   	pop    %edi
+  800bc0:	5d                   	pop    %ebp
+  800bc1:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800bc2:	83 ec 0c             	sub    $0xc,%esp
+  800bc5:	50                   	push   %eax
+  800bc6:	6a 03                	push   $0x3
+  800bc8:	68 c3 2f 80 00       	push   $0x802fc3
+  800bcd:	6a 3e                	push   $0x3e
+  800bcf:	68 e0 2f 80 00       	push   $0x802fe0
+  800bd4:	e8 be f5 ff ff       	call   800197 <_panic>
+
+00800bd9 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800bd9:	55                   	push   %ebp
+  800bda:	89 e5                	mov    %esp,%ebp
+  800bdc:	57                   	push   %edi
+  800bdd:	56                   	push   %esi
+  800bde:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800bdf:	ba 00 00 00 00       	mov    $0x0,%edx
+  800be4:	b8 02 00 00 00       	mov    $0x2,%eax
+  800be9:	89 d1                	mov    %edx,%ecx
+  800beb:	89 d3                	mov    %edx,%ebx
+  800bed:	89 d7                	mov    %edx,%edi
+  800bef:	89 d6                	mov    %edx,%esi
+  800bf1:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800bf3:	5b                   	pop    %ebx
+  800bf4:	5e                   	pop    %esi
+  800bf5:	5f                   	pop    %edi
+  800bf6:	5d                   	pop    %ebp
+  800bf7:	c3                   	ret
+
+00800bf8 <sys_yield>:
+
+void
+sys_yield(void) {
+  800bf8:	55                   	push   %ebp
+  800bf9:	89 e5                	mov    %esp,%ebp
+  800bfb:	57                   	push   %edi
+  800bfc:	56                   	push   %esi
+  800bfd:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800bfe:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c03:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800c08:	89 d1                	mov    %edx,%ecx
+  800c0a:	89 d3                	mov    %edx,%ebx
+  800c0c:	89 d7                	mov    %edx,%edi
+  800c0e:	89 d6                	mov    %edx,%esi
+  800c10:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800c12:	5b                   	pop    %ebx
+  800c13:	5e                   	pop    %esi
+  800c14:	5f                   	pop    %edi
+  800c15:	5d                   	pop    %ebp
+  800c16:	c3                   	ret
+
+00800c17 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  800c17:	55                   	push   %ebp
+  800c18:	89 e5                	mov    %esp,%ebp
+  800c1a:	57                   	push   %edi
+  800c1b:	56                   	push   %esi
+  800c1c:	53                   	push   %ebx
+  800c1d:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c20:	be 00 00 00 00       	mov    $0x0,%esi
+  800c25:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c28:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c2b:	b8 04 00 00 00       	mov    $0x4,%eax
+  800c30:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c33:	89 f7                	mov    %esi,%edi
+  800c35:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c37:	85 c0                	test   %eax,%eax
+  800c39:	7f 08                	jg     800c43 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800c3b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c3e:	5b                   	pop    %ebx
+  800c3f:	5e                   	pop    %esi
+  800c40:	5f                   	pop    %edi
+  800c41:	5d                   	pop    %ebp
+  800c42:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c43:	83 ec 0c             	sub    $0xc,%esp
+  800c46:	50                   	push   %eax
+  800c47:	6a 04                	push   $0x4
+  800c49:	68 c3 2f 80 00       	push   $0x802fc3
+  800c4e:	6a 3e                	push   $0x3e
+  800c50:	68 e0 2f 80 00       	push   $0x802fe0
+  800c55:	e8 3d f5 ff ff       	call   800197 <_panic>
+
+00800c5a <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  800c5a:	55                   	push   %ebp
+  800c5b:	89 e5                	mov    %esp,%ebp
+  800c5d:	57                   	push   %edi
+  800c5e:	56                   	push   %esi
+  800c5f:	53                   	push   %ebx
+  800c60:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c63:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c66:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c69:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c6e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c71:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c74:	8b 75 18             	mov    0x18(%ebp),%esi
+  800c77:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c79:	85 c0                	test   %eax,%eax
+  800c7b:	7f 08                	jg     800c85 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800c7d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c80:	5b                   	pop    %ebx
+  800c81:	5e                   	pop    %esi
+  800c82:	5f                   	pop    %edi
+  800c83:	5d                   	pop    %ebp
+  800c84:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c85:	83 ec 0c             	sub    $0xc,%esp
+  800c88:	50                   	push   %eax
+  800c89:	6a 05                	push   $0x5
+  800c8b:	68 c3 2f 80 00       	push   $0x802fc3
+  800c90:	6a 3e                	push   $0x3e
+  800c92:	68 e0 2f 80 00       	push   $0x802fe0
+  800c97:	e8 fb f4 ff ff       	call   800197 <_panic>
+
+00800c9c <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  800c9c:	55                   	push   %ebp
+  800c9d:	89 e5                	mov    %esp,%ebp
+  800c9f:	57                   	push   %edi
+  800ca0:	56                   	push   %esi
+  800ca1:	53                   	push   %ebx
+  800ca2:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800ca5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800caa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cb0:	b8 06 00 00 00       	mov    $0x6,%eax
+  800cb5:	89 df                	mov    %ebx,%edi
+  800cb7:	89 de                	mov    %ebx,%esi
+  800cb9:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800cbb:	85 c0                	test   %eax,%eax
+  800cbd:	7f 08                	jg     800cc7 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800cbf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cc2:	5b                   	pop    %ebx
+  800cc3:	5e                   	pop    %esi
+  800cc4:	5f                   	pop    %edi
+  800cc5:	5d                   	pop    %ebp
+  800cc6:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800cc7:	83 ec 0c             	sub    $0xc,%esp
+  800cca:	50                   	push   %eax
+  800ccb:	6a 06                	push   $0x6
+  800ccd:	68 c3 2f 80 00       	push   $0x802fc3
+  800cd2:	6a 3e                	push   $0x3e
+  800cd4:	68 e0 2f 80 00       	push   $0x802fe0
+  800cd9:	e8 b9 f4 ff ff       	call   800197 <_panic>
+
+00800cde <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800cde:	55                   	push   %ebp
+  800cdf:	89 e5                	mov    %esp,%ebp
+  800ce1:	57                   	push   %edi
+  800ce2:	56                   	push   %esi
+  800ce3:	53                   	push   %ebx
+  800ce4:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800ce7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cec:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cf2:	b8 08 00 00 00       	mov    $0x8,%eax
+  800cf7:	89 df                	mov    %ebx,%edi
+  800cf9:	89 de                	mov    %ebx,%esi
+  800cfb:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800cfd:	85 c0                	test   %eax,%eax
+  800cff:	7f 08                	jg     800d09 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800d01:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d04:	5b                   	pop    %ebx
+  800d05:	5e                   	pop    %esi
+  800d06:	5f                   	pop    %edi
+  800d07:	5d                   	pop    %ebp
+  800d08:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d09:	83 ec 0c             	sub    $0xc,%esp
+  800d0c:	50                   	push   %eax
+  800d0d:	6a 08                	push   $0x8
+  800d0f:	68 c3 2f 80 00       	push   $0x802fc3
+  800d14:	6a 3e                	push   $0x3e
+  800d16:	68 e0 2f 80 00       	push   $0x802fe0
+  800d1b:	e8 77 f4 ff ff       	call   800197 <_panic>
+
+00800d20 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800d20:	55                   	push   %ebp
+  800d21:	89 e5                	mov    %esp,%ebp
+  800d23:	57                   	push   %edi
+  800d24:	56                   	push   %esi
+  800d25:	53                   	push   %ebx
+  800d26:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800d29:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d2e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d31:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d34:	b8 09 00 00 00       	mov    $0x9,%eax
+  800d39:	89 df                	mov    %ebx,%edi
+  800d3b:	89 de                	mov    %ebx,%esi
+  800d3d:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d3f:	85 c0                	test   %eax,%eax
+  800d41:	7f 08                	jg     800d4b <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800d43:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d46:	5b                   	pop    %ebx
+  800d47:	5e                   	pop    %esi
+  800d48:	5f                   	pop    %edi
+  800d49:	5d                   	pop    %ebp
+  800d4a:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d4b:	83 ec 0c             	sub    $0xc,%esp
+  800d4e:	50                   	push   %eax
+  800d4f:	6a 09                	push   $0x9
+  800d51:	68 c3 2f 80 00       	push   $0x802fc3
+  800d56:	6a 3e                	push   $0x3e
+  800d58:	68 e0 2f 80 00       	push   $0x802fe0
+  800d5d:	e8 35 f4 ff ff       	call   800197 <_panic>
+
+00800d62 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800d62:	55                   	push   %ebp
+  800d63:	89 e5                	mov    %esp,%ebp
+  800d65:	57                   	push   %edi
+  800d66:	56                   	push   %esi
+  800d67:	53                   	push   %ebx
+  800d68:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800d6b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d70:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d73:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d76:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d7b:	89 df                	mov    %ebx,%edi
+  800d7d:	89 de                	mov    %ebx,%esi
+  800d7f:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d81:	85 c0                	test   %eax,%eax
+  800d83:	7f 08                	jg     800d8d <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800d85:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d88:	5b                   	pop    %ebx
+  800d89:	5e                   	pop    %esi
+  800d8a:	5f                   	pop    %edi
+  800d8b:	5d                   	pop    %ebp
+  800d8c:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d8d:	83 ec 0c             	sub    $0xc,%esp
+  800d90:	50                   	push   %eax
+  800d91:	6a 0a                	push   $0xa
+  800d93:	68 c3 2f 80 00       	push   $0x802fc3
+  800d98:	6a 3e                	push   $0x3e
+  800d9a:	68 e0 2f 80 00       	push   $0x802fe0
+  800d9f:	e8 f3 f3 ff ff       	call   800197 <_panic>
+
+00800da4 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  800da4:	55                   	push   %ebp
+  800da5:	89 e5                	mov    %esp,%ebp
+  800da7:	57                   	push   %edi
+  800da8:	56                   	push   %esi
+  800da9:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800daa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800db0:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800db5:	be 00 00 00 00       	mov    $0x0,%esi
+  800dba:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dbd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dc0:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800dc2:	5b                   	pop    %ebx
+  800dc3:	5e                   	pop    %esi
+  800dc4:	5f                   	pop    %edi
+  800dc5:	5d                   	pop    %ebp
+  800dc6:	c3                   	ret
+
+00800dc7 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  800dc7:	55                   	push   %ebp
+  800dc8:	89 e5                	mov    %esp,%ebp
+  800dca:	57                   	push   %edi
+  800dcb:	56                   	push   %esi
+  800dcc:	53                   	push   %ebx
+  800dcd:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800dd0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dd5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd8:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800ddd:	89 cb                	mov    %ecx,%ebx
+  800ddf:	89 cf                	mov    %ecx,%edi
+  800de1:	89 ce                	mov    %ecx,%esi
+  800de3:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800de5:	85 c0                	test   %eax,%eax
+  800de7:	7f 08                	jg     800df1 <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  800de9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dec:	5b                   	pop    %ebx
+  800ded:	5e                   	pop    %esi
+  800dee:	5f                   	pop    %edi
+  800def:	5d                   	pop    %ebp
+  800df0:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800df1:	83 ec 0c             	sub    $0xc,%esp
+  800df4:	50                   	push   %eax
+  800df5:	6a 0d                	push   $0xd
+  800df7:	68 c3 2f 80 00       	push   $0x802fc3
+  800dfc:	6a 3e                	push   $0x3e
+  800dfe:	68 e0 2f 80 00       	push   $0x802fe0
+  800e03:	e8 8f f3 ff ff       	call   800197 <_panic>
+
+00800e08 <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  800e08:	55                   	push   %ebp
+  800e09:	89 e5                	mov    %esp,%ebp
+  800e0b:	57                   	push   %edi
+  800e0c:	56                   	push   %esi
+  800e0d:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e0e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e13:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e16:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e19:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800e1e:	89 df                	mov    %ebx,%edi
+  800e20:	89 de                	mov    %ebx,%esi
+  800e22:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  800e24:	5b                   	pop    %ebx
+  800e25:	5e                   	pop    %esi
+  800e26:	5f                   	pop    %edi
+  800e27:	5d                   	pop    %ebp
+  800e28:	c3                   	ret
+
+00800e29 <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  800e29:	55                   	push   %ebp
+  800e2a:	89 e5                	mov    %esp,%ebp
+  800e2c:	57                   	push   %edi
+  800e2d:	56                   	push   %esi
+  800e2e:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e2f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e34:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e37:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800e3c:	89 cb                	mov    %ecx,%ebx
+  800e3e:	89 cf                	mov    %ecx,%edi
+  800e40:	89 ce                	mov    %ecx,%esi
+  800e42:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  800e44:	5b                   	pop    %ebx
+  800e45:	5e                   	pop    %esi
+  800e46:	5f                   	pop    %edi
+  800e47:	5d                   	pop    %ebp
+  800e48:	c3                   	ret
+
+00800e49 <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  800e49:	55                   	push   %ebp
+  800e4a:	89 e5                	mov    %esp,%ebp
+  800e4c:	57                   	push   %edi
+  800e4d:	56                   	push   %esi
+  800e4e:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e4f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e54:	b8 10 00 00 00       	mov    $0x10,%eax
+  800e59:	89 d1                	mov    %edx,%ecx
+  800e5b:	89 d3                	mov    %edx,%ebx
+  800e5d:	89 d7                	mov    %edx,%edi
+  800e5f:	89 d6                	mov    %edx,%esi
+  800e61:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800e63:	5b                   	pop    %ebx
+  800e64:	5e                   	pop    %esi
+  800e65:	5f                   	pop    %edi
+  800e66:	5d                   	pop    %ebp
+  800e67:	c3                   	ret
+
+00800e68 <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  800e68:	55                   	push   %ebp
+  800e69:	89 e5                	mov    %esp,%ebp
+  800e6b:	57                   	push   %edi
+  800e6c:	56                   	push   %esi
+  800e6d:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e6e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e73:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e76:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e79:	b8 11 00 00 00       	mov    $0x11,%eax
+  800e7e:	89 df                	mov    %ebx,%edi
+  800e80:	89 de                	mov    %ebx,%esi
+  800e82:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800e84:	5b                   	pop    %ebx
+  800e85:	5e                   	pop    %esi
+  800e86:	5f                   	pop    %edi
+  800e87:	5d                   	pop    %ebp
+  800e88:	c3                   	ret
+
+00800e89 <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  800e89:	55                   	push   %ebp
+  800e8a:	89 e5                	mov    %esp,%ebp
+  800e8c:	57                   	push   %edi
+  800e8d:	56                   	push   %esi
+  800e8e:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e8f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e94:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e97:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e9a:	b8 12 00 00 00       	mov    $0x12,%eax
+  800e9f:	89 df                	mov    %ebx,%edi
+  800ea1:	89 de                	mov    %ebx,%esi
+  800ea3:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800ea5:	5b                   	pop    %ebx
+  800ea6:	5e                   	pop    %esi
+  800ea7:	5f                   	pop    %edi
+  800ea8:	5d                   	pop    %ebp
+  800ea9:	c3                   	ret
+
+00800eaa <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  800eaa:	55                   	push   %ebp
+  800eab:	89 e5                	mov    %esp,%ebp
+  800ead:	57                   	push   %edi
+  800eae:	56                   	push   %esi
+  800eaf:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800eb0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800eb5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb8:	b8 13 00 00 00       	mov    $0x13,%eax
+  800ebd:	89 cb                	mov    %ecx,%ebx
+  800ebf:	89 cf                	mov    %ecx,%edi
+  800ec1:	89 ce                	mov    %ecx,%esi
+  800ec3:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  800ec5:	5b                   	pop    %ebx
+  800ec6:	5e                   	pop    %esi
+  800ec7:	5f                   	pop    %edi
+  800ec8:	5d                   	pop    %ebp
+  800ec9:	c3                   	ret
+
+00800eca <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  800eca:	55                   	push   %ebp
+  800ecb:	89 e5                	mov    %esp,%ebp
+  800ecd:	57                   	push   %edi
+  800ece:	56                   	push   %esi
+  800ecf:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800ed0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ed5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed8:	b8 14 00 00 00       	mov    $0x14,%eax
+  800edd:	89 cb                	mov    %ecx,%ebx
+  800edf:	89 cf                	mov    %ecx,%edi
+  800ee1:	89 ce                	mov    %ecx,%esi
+  800ee3:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  800ee5:	5b                   	pop    %ebx
+  800ee6:	5e                   	pop    %esi
+  800ee7:	5f                   	pop    %edi
+  800ee8:	5d                   	pop    %ebp
+  800ee9:	c3                   	ret
+
+00800eea <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800eea:	55                   	push   %ebp
+  800eeb:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800eed:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ef0:	05 00 00 00 30       	add    $0x30000000,%eax
+  800ef5:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800ef8:	5d                   	pop    %ebp
+  800ef9:	c3                   	ret
+
+00800efa <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800efa:	55                   	push   %ebp
+  800efb:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800efd:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f00:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800f05:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800f0a:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800f0f:	5d                   	pop    %ebp
+  800f10:	c3                   	ret
+
+00800f11 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800f11:	55                   	push   %ebp
+  800f12:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  800f14:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800f19:	eb 02                	jmp    800f1d <fd_alloc+0xc>
+  800f1b:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800f1d:	89 c2                	mov    %eax,%edx
+  800f1f:	c1 ea 16             	shr    $0x16,%edx
+  800f22:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800f29:	f6 c2 01             	test   $0x1,%dl
+  800f2c:	74 2b                	je     800f59 <fd_alloc+0x48>
+  800f2e:	89 c2                	mov    %eax,%edx
+  800f30:	c1 ea 0c             	shr    $0xc,%edx
+  800f33:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  800f3a:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  800f40:	f6 c1 01             	test   $0x1,%cl
+  800f43:	74 14                	je     800f59 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  800f45:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  800f4b:	75 ce                	jne    800f1b <fd_alloc+0xa>
+  800f4d:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  800f52:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800f57:	eb 05                	jmp    800f5e <fd_alloc+0x4d>
+			return 0;
+  800f59:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  800f5e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f61:	89 02                	mov    %eax,(%edx)
+}
+  800f63:	89 c8                	mov    %ecx,%eax
+  800f65:	5d                   	pop    %ebp
+  800f66:	c3                   	ret
+
+00800f67 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  800f67:	55                   	push   %ebp
+  800f68:	89 e5                	mov    %esp,%ebp
+  800f6a:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  800f6d:	83 f8 1f             	cmp    $0x1f,%eax
+  800f70:	77 30                	ja     800fa2 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  800f72:	c1 e0 0c             	shl    $0xc,%eax
+  800f75:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800f7a:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  800f80:	f6 c2 01             	test   $0x1,%dl
+  800f83:	74 24                	je     800fa9 <fd_lookup+0x42>
+  800f85:	89 c2                	mov    %eax,%edx
+  800f87:	c1 ea 0c             	shr    $0xc,%edx
+  800f8a:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800f91:	f6 c2 01             	test   $0x1,%dl
+  800f94:	74 1a                	je     800fb0 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  800f96:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800f99:	89 02                	mov    %eax,(%edx)
+	return 0;
+  800f9b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fa0:	5d                   	pop    %ebp
+  800fa1:	c3                   	ret
+		return -E_INVAL;
+  800fa2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800fa7:	eb f7                	jmp    800fa0 <fd_lookup+0x39>
+		return -E_INVAL;
+  800fa9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800fae:	eb f0                	jmp    800fa0 <fd_lookup+0x39>
+  800fb0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800fb5:	eb e9                	jmp    800fa0 <fd_lookup+0x39>
+
+00800fb7 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  800fb7:	55                   	push   %ebp
+  800fb8:	89 e5                	mov    %esp,%ebp
+  800fba:	53                   	push   %ebx
+  800fbb:	83 ec 04             	sub    $0x4,%esp
+  800fbe:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  800fc1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fc6:	eb 03                	jmp    800fcb <dev_lookup+0x14>
+  800fc8:	83 c0 01             	add    $0x1,%eax
+  800fcb:	8b 1c 85 6c 30 80 00 	mov    0x80306c(,%eax,4),%ebx
+  800fd2:	85 db                	test   %ebx,%ebx
+  800fd4:	74 0b                	je     800fe1 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  800fd6:	39 13                	cmp    %edx,(%ebx)
+  800fd8:	75 ee                	jne    800fc8 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  800fda:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fdf:	eb 1f                	jmp    801000 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800fe1:	a1 08 50 80 00       	mov    0x805008,%eax
+  800fe6:	8b 40 48             	mov    0x48(%eax),%eax
+  800fe9:	83 ec 04             	sub    $0x4,%esp
+  800fec:	52                   	push   %edx
+  800fed:	50                   	push   %eax
+  800fee:	68 f0 2f 80 00       	push   $0x802ff0
+  800ff3:	e8 7a f2 ff ff       	call   800272 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  800ff8:	83 c4 10             	add    $0x10,%esp
+  800ffb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801000:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801003:	89 1a                	mov    %ebx,(%edx)
+}
+  801005:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801008:	c9                   	leave
+  801009:	c3                   	ret
+
+0080100a <fd_close>:
+{
+  80100a:	55                   	push   %ebp
+  80100b:	89 e5                	mov    %esp,%ebp
+  80100d:	57                   	push   %edi
+  80100e:	56                   	push   %esi
+  80100f:	53                   	push   %ebx
+  801010:	83 ec 24             	sub    $0x24,%esp
+  801013:	8b 75 08             	mov    0x8(%ebp),%esi
+  801016:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801019:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80101c:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80101d:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801023:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801026:	50                   	push   %eax
+  801027:	e8 3b ff ff ff       	call   800f67 <fd_lookup>
+  80102c:	89 c3                	mov    %eax,%ebx
+  80102e:	83 c4 10             	add    $0x10,%esp
+  801031:	85 c0                	test   %eax,%eax
+  801033:	78 05                	js     80103a <fd_close+0x30>
+	    || fd != fd2)
+  801035:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801038:	74 16                	je     801050 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80103a:	89 f8                	mov    %edi,%eax
+  80103c:	84 c0                	test   %al,%al
+  80103e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801043:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801046:	89 d8                	mov    %ebx,%eax
+  801048:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80104b:	5b                   	pop    %ebx
+  80104c:	5e                   	pop    %esi
+  80104d:	5f                   	pop    %edi
+  80104e:	5d                   	pop    %ebp
+  80104f:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801050:	83 ec 08             	sub    $0x8,%esp
+  801053:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801056:	50                   	push   %eax
+  801057:	ff 36                	push   (%esi)
+  801059:	e8 59 ff ff ff       	call   800fb7 <dev_lookup>
+  80105e:	89 c3                	mov    %eax,%ebx
+  801060:	83 c4 10             	add    $0x10,%esp
+  801063:	85 c0                	test   %eax,%eax
+  801065:	78 1a                	js     801081 <fd_close+0x77>
+		if (dev->dev_close)
+  801067:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80106a:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80106d:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801072:	85 c0                	test   %eax,%eax
+  801074:	74 0b                	je     801081 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801076:	83 ec 0c             	sub    $0xc,%esp
+  801079:	56                   	push   %esi
+  80107a:	ff d0                	call   *%eax
+  80107c:	89 c3                	mov    %eax,%ebx
+  80107e:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801081:	83 ec 08             	sub    $0x8,%esp
+  801084:	56                   	push   %esi
+  801085:	6a 00                	push   $0x0
+  801087:	e8 10 fc ff ff       	call   800c9c <sys_page_unmap>
+	return r;
+  80108c:	83 c4 10             	add    $0x10,%esp
+  80108f:	eb b5                	jmp    801046 <fd_close+0x3c>
+
+00801091 <close>:
+
+int
+close(int fdnum)
+{
+  801091:	55                   	push   %ebp
+  801092:	89 e5                	mov    %esp,%ebp
+  801094:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801097:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80109a:	50                   	push   %eax
+  80109b:	ff 75 08             	push   0x8(%ebp)
+  80109e:	e8 c4 fe ff ff       	call   800f67 <fd_lookup>
+  8010a3:	83 c4 10             	add    $0x10,%esp
+  8010a6:	85 c0                	test   %eax,%eax
+  8010a8:	79 02                	jns    8010ac <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8010aa:	c9                   	leave
+  8010ab:	c3                   	ret
+		return fd_close(fd, 1);
+  8010ac:	83 ec 08             	sub    $0x8,%esp
+  8010af:	6a 01                	push   $0x1
+  8010b1:	ff 75 f4             	push   -0xc(%ebp)
+  8010b4:	e8 51 ff ff ff       	call   80100a <fd_close>
+  8010b9:	83 c4 10             	add    $0x10,%esp
+  8010bc:	eb ec                	jmp    8010aa <close+0x19>
+
+008010be <close_all>:
+
+void
+close_all(void)
+{
+  8010be:	55                   	push   %ebp
+  8010bf:	89 e5                	mov    %esp,%ebp
+  8010c1:	53                   	push   %ebx
+  8010c2:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8010c5:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8010ca:	83 ec 0c             	sub    $0xc,%esp
+  8010cd:	53                   	push   %ebx
+  8010ce:	e8 be ff ff ff       	call   801091 <close>
+	for (i = 0; i < MAXFD; i++)
+  8010d3:	83 c3 01             	add    $0x1,%ebx
+  8010d6:	83 c4 10             	add    $0x10,%esp
+  8010d9:	83 fb 20             	cmp    $0x20,%ebx
+  8010dc:	75 ec                	jne    8010ca <close_all+0xc>
+}
+  8010de:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010e1:	c9                   	leave
+  8010e2:	c3                   	ret
+
+008010e3 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8010e3:	55                   	push   %ebp
+  8010e4:	89 e5                	mov    %esp,%ebp
+  8010e6:	57                   	push   %edi
+  8010e7:	56                   	push   %esi
+  8010e8:	53                   	push   %ebx
+  8010e9:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8010ec:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8010ef:	50                   	push   %eax
+  8010f0:	ff 75 08             	push   0x8(%ebp)
+  8010f3:	e8 6f fe ff ff       	call   800f67 <fd_lookup>
+  8010f8:	89 c3                	mov    %eax,%ebx
+  8010fa:	83 c4 10             	add    $0x10,%esp
+  8010fd:	85 c0                	test   %eax,%eax
+  8010ff:	78 7f                	js     801180 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801101:	83 ec 0c             	sub    $0xc,%esp
+  801104:	ff 75 0c             	push   0xc(%ebp)
+  801107:	e8 85 ff ff ff       	call   801091 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80110c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80110f:	c1 e6 0c             	shl    $0xc,%esi
+  801112:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801118:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80111b:	89 3c 24             	mov    %edi,(%esp)
+  80111e:	e8 d7 fd ff ff       	call   800efa <fd2data>
+  801123:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801125:	89 34 24             	mov    %esi,(%esp)
+  801128:	e8 cd fd ff ff       	call   800efa <fd2data>
+  80112d:	83 c4 10             	add    $0x10,%esp
+  801130:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801133:	89 d8                	mov    %ebx,%eax
+  801135:	c1 e8 16             	shr    $0x16,%eax
+  801138:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80113f:	a8 01                	test   $0x1,%al
+  801141:	74 11                	je     801154 <dup+0x71>
+  801143:	89 d8                	mov    %ebx,%eax
+  801145:	c1 e8 0c             	shr    $0xc,%eax
+  801148:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80114f:	f6 c2 01             	test   $0x1,%dl
+  801152:	75 36                	jne    80118a <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801154:	89 f8                	mov    %edi,%eax
+  801156:	c1 e8 0c             	shr    $0xc,%eax
+  801159:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801160:	83 ec 0c             	sub    $0xc,%esp
+  801163:	25 07 0e 00 00       	and    $0xe07,%eax
+  801168:	50                   	push   %eax
+  801169:	56                   	push   %esi
+  80116a:	6a 00                	push   $0x0
+  80116c:	57                   	push   %edi
+  80116d:	6a 00                	push   $0x0
+  80116f:	e8 e6 fa ff ff       	call   800c5a <sys_page_map>
+  801174:	89 c3                	mov    %eax,%ebx
+  801176:	83 c4 20             	add    $0x20,%esp
+  801179:	85 c0                	test   %eax,%eax
+  80117b:	78 33                	js     8011b0 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80117d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801180:	89 d8                	mov    %ebx,%eax
+  801182:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801185:	5b                   	pop    %ebx
+  801186:	5e                   	pop    %esi
+  801187:	5f                   	pop    %edi
+  801188:	5d                   	pop    %ebp
+  801189:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80118a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801191:	83 ec 0c             	sub    $0xc,%esp
+  801194:	25 07 0e 00 00       	and    $0xe07,%eax
+  801199:	50                   	push   %eax
+  80119a:	ff 75 d4             	push   -0x2c(%ebp)
+  80119d:	6a 00                	push   $0x0
+  80119f:	53                   	push   %ebx
+  8011a0:	6a 00                	push   $0x0
+  8011a2:	e8 b3 fa ff ff       	call   800c5a <sys_page_map>
+  8011a7:	89 c3                	mov    %eax,%ebx
+  8011a9:	83 c4 20             	add    $0x20,%esp
+  8011ac:	85 c0                	test   %eax,%eax
+  8011ae:	79 a4                	jns    801154 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8011b0:	83 ec 08             	sub    $0x8,%esp
+  8011b3:	56                   	push   %esi
+  8011b4:	6a 00                	push   $0x0
+  8011b6:	e8 e1 fa ff ff       	call   800c9c <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8011bb:	83 c4 08             	add    $0x8,%esp
+  8011be:	ff 75 d4             	push   -0x2c(%ebp)
+  8011c1:	6a 00                	push   $0x0
+  8011c3:	e8 d4 fa ff ff       	call   800c9c <sys_page_unmap>
+	return r;
+  8011c8:	83 c4 10             	add    $0x10,%esp
+  8011cb:	eb b3                	jmp    801180 <dup+0x9d>
+
+008011cd <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8011cd:	55                   	push   %ebp
+  8011ce:	89 e5                	mov    %esp,%ebp
+  8011d0:	56                   	push   %esi
+  8011d1:	53                   	push   %ebx
+  8011d2:	83 ec 18             	sub    $0x18,%esp
+  8011d5:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8011d8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8011db:	50                   	push   %eax
+  8011dc:	56                   	push   %esi
+  8011dd:	e8 85 fd ff ff       	call   800f67 <fd_lookup>
+  8011e2:	83 c4 10             	add    $0x10,%esp
+  8011e5:	85 c0                	test   %eax,%eax
+  8011e7:	78 3c                	js     801225 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8011e9:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8011ec:	83 ec 08             	sub    $0x8,%esp
+  8011ef:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8011f2:	50                   	push   %eax
+  8011f3:	ff 33                	push   (%ebx)
+  8011f5:	e8 bd fd ff ff       	call   800fb7 <dev_lookup>
+  8011fa:	83 c4 10             	add    $0x10,%esp
+  8011fd:	85 c0                	test   %eax,%eax
+  8011ff:	78 24                	js     801225 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801201:	8b 43 08             	mov    0x8(%ebx),%eax
+  801204:	83 e0 03             	and    $0x3,%eax
+  801207:	83 f8 01             	cmp    $0x1,%eax
+  80120a:	74 20                	je     80122c <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80120c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80120f:	8b 40 08             	mov    0x8(%eax),%eax
+  801212:	85 c0                	test   %eax,%eax
+  801214:	74 37                	je     80124d <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801216:	83 ec 04             	sub    $0x4,%esp
+  801219:	ff 75 10             	push   0x10(%ebp)
+  80121c:	ff 75 0c             	push   0xc(%ebp)
+  80121f:	53                   	push   %ebx
+  801220:	ff d0                	call   *%eax
+  801222:	83 c4 10             	add    $0x10,%esp
+}
+  801225:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801228:	5b                   	pop    %ebx
+  801229:	5e                   	pop    %esi
+  80122a:	5d                   	pop    %ebp
+  80122b:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80122c:	a1 08 50 80 00       	mov    0x805008,%eax
+  801231:	8b 40 48             	mov    0x48(%eax),%eax
+  801234:	83 ec 04             	sub    $0x4,%esp
+  801237:	56                   	push   %esi
+  801238:	50                   	push   %eax
+  801239:	68 31 30 80 00       	push   $0x803031
+  80123e:	e8 2f f0 ff ff       	call   800272 <cprintf>
+		return -E_INVAL;
+  801243:	83 c4 10             	add    $0x10,%esp
+  801246:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80124b:	eb d8                	jmp    801225 <read+0x58>
+		return -E_NOT_SUPP;
+  80124d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801252:	eb d1                	jmp    801225 <read+0x58>
+
+00801254 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801254:	55                   	push   %ebp
+  801255:	89 e5                	mov    %esp,%ebp
+  801257:	57                   	push   %edi
+  801258:	56                   	push   %esi
+  801259:	53                   	push   %ebx
+  80125a:	83 ec 0c             	sub    $0xc,%esp
+  80125d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801260:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801263:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801268:	eb 02                	jmp    80126c <readn+0x18>
+  80126a:	01 c3                	add    %eax,%ebx
+  80126c:	39 f3                	cmp    %esi,%ebx
+  80126e:	73 21                	jae    801291 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801270:	83 ec 04             	sub    $0x4,%esp
+  801273:	89 f0                	mov    %esi,%eax
+  801275:	29 d8                	sub    %ebx,%eax
+  801277:	50                   	push   %eax
+  801278:	89 d8                	mov    %ebx,%eax
+  80127a:	03 45 0c             	add    0xc(%ebp),%eax
+  80127d:	50                   	push   %eax
+  80127e:	57                   	push   %edi
+  80127f:	e8 49 ff ff ff       	call   8011cd <read>
+		if (m < 0)
+  801284:	83 c4 10             	add    $0x10,%esp
+  801287:	85 c0                	test   %eax,%eax
+  801289:	78 04                	js     80128f <readn+0x3b>
+			return m;
+		if (m == 0)
+  80128b:	75 dd                	jne    80126a <readn+0x16>
+  80128d:	eb 02                	jmp    801291 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80128f:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801291:	89 d8                	mov    %ebx,%eax
+  801293:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801296:	5b                   	pop    %ebx
+  801297:	5e                   	pop    %esi
+  801298:	5f                   	pop    %edi
+  801299:	5d                   	pop    %ebp
+  80129a:	c3                   	ret
+
+0080129b <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80129b:	55                   	push   %ebp
+  80129c:	89 e5                	mov    %esp,%ebp
+  80129e:	56                   	push   %esi
+  80129f:	53                   	push   %ebx
+  8012a0:	83 ec 18             	sub    $0x18,%esp
+  8012a3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8012a6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8012a9:	50                   	push   %eax
+  8012aa:	53                   	push   %ebx
+  8012ab:	e8 b7 fc ff ff       	call   800f67 <fd_lookup>
+  8012b0:	83 c4 10             	add    $0x10,%esp
+  8012b3:	85 c0                	test   %eax,%eax
+  8012b5:	78 37                	js     8012ee <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8012b7:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8012ba:	83 ec 08             	sub    $0x8,%esp
+  8012bd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8012c0:	50                   	push   %eax
+  8012c1:	ff 36                	push   (%esi)
+  8012c3:	e8 ef fc ff ff       	call   800fb7 <dev_lookup>
+  8012c8:	83 c4 10             	add    $0x10,%esp
+  8012cb:	85 c0                	test   %eax,%eax
+  8012cd:	78 1f                	js     8012ee <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8012cf:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8012d3:	74 20                	je     8012f5 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8012d5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8012d8:	8b 40 0c             	mov    0xc(%eax),%eax
+  8012db:	85 c0                	test   %eax,%eax
+  8012dd:	74 37                	je     801316 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8012df:	83 ec 04             	sub    $0x4,%esp
+  8012e2:	ff 75 10             	push   0x10(%ebp)
+  8012e5:	ff 75 0c             	push   0xc(%ebp)
+  8012e8:	56                   	push   %esi
+  8012e9:	ff d0                	call   *%eax
+  8012eb:	83 c4 10             	add    $0x10,%esp
+}
+  8012ee:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8012f1:	5b                   	pop    %ebx
+  8012f2:	5e                   	pop    %esi
+  8012f3:	5d                   	pop    %ebp
+  8012f4:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8012f5:	a1 08 50 80 00       	mov    0x805008,%eax
+  8012fa:	8b 40 48             	mov    0x48(%eax),%eax
+  8012fd:	83 ec 04             	sub    $0x4,%esp
+  801300:	53                   	push   %ebx
+  801301:	50                   	push   %eax
+  801302:	68 4d 30 80 00       	push   $0x80304d
+  801307:	e8 66 ef ff ff       	call   800272 <cprintf>
+		return -E_INVAL;
+  80130c:	83 c4 10             	add    $0x10,%esp
+  80130f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801314:	eb d8                	jmp    8012ee <write+0x53>
+		return -E_NOT_SUPP;
+  801316:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80131b:	eb d1                	jmp    8012ee <write+0x53>
+
+0080131d <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80131d:	55                   	push   %ebp
+  80131e:	89 e5                	mov    %esp,%ebp
+  801320:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801323:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801326:	50                   	push   %eax
+  801327:	ff 75 08             	push   0x8(%ebp)
+  80132a:	e8 38 fc ff ff       	call   800f67 <fd_lookup>
+  80132f:	83 c4 10             	add    $0x10,%esp
+  801332:	85 c0                	test   %eax,%eax
+  801334:	78 0e                	js     801344 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801336:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801339:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80133c:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80133f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801344:	c9                   	leave
+  801345:	c3                   	ret
+
+00801346 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801346:	55                   	push   %ebp
+  801347:	89 e5                	mov    %esp,%ebp
+  801349:	56                   	push   %esi
+  80134a:	53                   	push   %ebx
+  80134b:	83 ec 18             	sub    $0x18,%esp
+  80134e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801351:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801354:	50                   	push   %eax
+  801355:	53                   	push   %ebx
+  801356:	e8 0c fc ff ff       	call   800f67 <fd_lookup>
+  80135b:	83 c4 10             	add    $0x10,%esp
+  80135e:	85 c0                	test   %eax,%eax
+  801360:	78 34                	js     801396 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801362:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801365:	83 ec 08             	sub    $0x8,%esp
+  801368:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80136b:	50                   	push   %eax
+  80136c:	ff 36                	push   (%esi)
+  80136e:	e8 44 fc ff ff       	call   800fb7 <dev_lookup>
+  801373:	83 c4 10             	add    $0x10,%esp
+  801376:	85 c0                	test   %eax,%eax
+  801378:	78 1c                	js     801396 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80137a:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80137e:	74 1d                	je     80139d <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801380:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801383:	8b 40 18             	mov    0x18(%eax),%eax
+  801386:	85 c0                	test   %eax,%eax
+  801388:	74 34                	je     8013be <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80138a:	83 ec 08             	sub    $0x8,%esp
+  80138d:	ff 75 0c             	push   0xc(%ebp)
+  801390:	56                   	push   %esi
+  801391:	ff d0                	call   *%eax
+  801393:	83 c4 10             	add    $0x10,%esp
+}
+  801396:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801399:	5b                   	pop    %ebx
+  80139a:	5e                   	pop    %esi
+  80139b:	5d                   	pop    %ebp
+  80139c:	c3                   	ret
+			thisenv->env_id, fdnum);
+  80139d:	a1 08 50 80 00       	mov    0x805008,%eax
+  8013a2:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8013a5:	83 ec 04             	sub    $0x4,%esp
+  8013a8:	53                   	push   %ebx
+  8013a9:	50                   	push   %eax
+  8013aa:	68 10 30 80 00       	push   $0x803010
+  8013af:	e8 be ee ff ff       	call   800272 <cprintf>
+		return -E_INVAL;
+  8013b4:	83 c4 10             	add    $0x10,%esp
+  8013b7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013bc:	eb d8                	jmp    801396 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8013be:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8013c3:	eb d1                	jmp    801396 <ftruncate+0x50>
+
+008013c5 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8013c5:	55                   	push   %ebp
+  8013c6:	89 e5                	mov    %esp,%ebp
+  8013c8:	56                   	push   %esi
+  8013c9:	53                   	push   %ebx
+  8013ca:	83 ec 18             	sub    $0x18,%esp
+  8013cd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8013d0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8013d3:	50                   	push   %eax
+  8013d4:	ff 75 08             	push   0x8(%ebp)
+  8013d7:	e8 8b fb ff ff       	call   800f67 <fd_lookup>
+  8013dc:	83 c4 10             	add    $0x10,%esp
+  8013df:	85 c0                	test   %eax,%eax
+  8013e1:	78 49                	js     80142c <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8013e3:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8013e6:	83 ec 08             	sub    $0x8,%esp
+  8013e9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013ec:	50                   	push   %eax
+  8013ed:	ff 36                	push   (%esi)
+  8013ef:	e8 c3 fb ff ff       	call   800fb7 <dev_lookup>
+  8013f4:	83 c4 10             	add    $0x10,%esp
+  8013f7:	85 c0                	test   %eax,%eax
+  8013f9:	78 31                	js     80142c <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8013fb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013fe:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801402:	74 2f                	je     801433 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801404:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801407:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80140e:	00 00 00 
+	stat->st_isdir = 0;
+  801411:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801418:	00 00 00 
+	stat->st_dev = dev;
+  80141b:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801421:	83 ec 08             	sub    $0x8,%esp
+  801424:	53                   	push   %ebx
+  801425:	56                   	push   %esi
+  801426:	ff 50 14             	call   *0x14(%eax)
+  801429:	83 c4 10             	add    $0x10,%esp
+}
+  80142c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80142f:	5b                   	pop    %ebx
+  801430:	5e                   	pop    %esi
+  801431:	5d                   	pop    %ebp
+  801432:	c3                   	ret
+		return -E_NOT_SUPP;
+  801433:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801438:	eb f2                	jmp    80142c <fstat+0x67>
+
+0080143a <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80143a:	55                   	push   %ebp
+  80143b:	89 e5                	mov    %esp,%ebp
+  80143d:	56                   	push   %esi
+  80143e:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80143f:	83 ec 08             	sub    $0x8,%esp
+  801442:	6a 00                	push   $0x0
+  801444:	ff 75 08             	push   0x8(%ebp)
+  801447:	e8 e4 01 00 00       	call   801630 <open>
+  80144c:	89 c3                	mov    %eax,%ebx
+  80144e:	83 c4 10             	add    $0x10,%esp
+  801451:	85 c0                	test   %eax,%eax
+  801453:	78 1b                	js     801470 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801455:	83 ec 08             	sub    $0x8,%esp
+  801458:	ff 75 0c             	push   0xc(%ebp)
+  80145b:	50                   	push   %eax
+  80145c:	e8 64 ff ff ff       	call   8013c5 <fstat>
+  801461:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801463:	89 1c 24             	mov    %ebx,(%esp)
+  801466:	e8 26 fc ff ff       	call   801091 <close>
+	return r;
+  80146b:	83 c4 10             	add    $0x10,%esp
+  80146e:	89 f3                	mov    %esi,%ebx
+}
+  801470:	89 d8                	mov    %ebx,%eax
+  801472:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801475:	5b                   	pop    %ebx
+  801476:	5e                   	pop    %esi
+  801477:	5d                   	pop    %ebp
+  801478:	c3                   	ret
+
+00801479 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  801479:	55                   	push   %ebp
+  80147a:	89 e5                	mov    %esp,%ebp
+  80147c:	56                   	push   %esi
+  80147d:	53                   	push   %ebx
+  80147e:	89 c6                	mov    %eax,%esi
+  801480:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  801482:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  801489:	74 27                	je     8014b2 <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80148b:	6a 07                	push   $0x7
+  80148d:	68 00 60 80 00       	push   $0x806000
+  801492:	56                   	push   %esi
+  801493:	ff 35 00 50 80 00    	push   0x805000
+  801499:	e8 ae 11 00 00       	call   80264c <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  80149e:	83 c4 0c             	add    $0xc,%esp
+  8014a1:	6a 00                	push   $0x0
+  8014a3:	53                   	push   %ebx
+  8014a4:	6a 00                	push   $0x0
+  8014a6:	e8 2d 11 00 00       	call   8025d8 <ipc_recv>
+}
+  8014ab:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014ae:	5b                   	pop    %ebx
+  8014af:	5e                   	pop    %esi
+  8014b0:	5d                   	pop    %ebp
+  8014b1:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  8014b2:	83 ec 0c             	sub    $0xc,%esp
+  8014b5:	6a 01                	push   $0x1
+  8014b7:	e8 e4 11 00 00       	call   8026a0 <ipc_find_env>
+  8014bc:	a3 00 50 80 00       	mov    %eax,0x805000
+  8014c1:	83 c4 10             	add    $0x10,%esp
+  8014c4:	eb c5                	jmp    80148b <fsipc+0x12>
+
+008014c6 <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8014c6:	55                   	push   %ebp
+  8014c7:	89 e5                	mov    %esp,%ebp
+  8014c9:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8014cc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014cf:	8b 40 0c             	mov    0xc(%eax),%eax
+  8014d2:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.set_size.req_size = newsize;
+  8014d7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8014da:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  8014df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014e4:	b8 02 00 00 00       	mov    $0x2,%eax
+  8014e9:	e8 8b ff ff ff       	call   801479 <fsipc>
+}
+  8014ee:	c9                   	leave
+  8014ef:	c3                   	ret
+
+008014f0 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8014f0:	55                   	push   %ebp
+  8014f1:	89 e5                	mov    %esp,%ebp
+  8014f3:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8014f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014f9:	8b 40 0c             	mov    0xc(%eax),%eax
+  8014fc:	a3 00 60 80 00       	mov    %eax,0x806000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801501:	ba 00 00 00 00       	mov    $0x0,%edx
+  801506:	b8 06 00 00 00       	mov    $0x6,%eax
+  80150b:	e8 69 ff ff ff       	call   801479 <fsipc>
+}
+  801510:	c9                   	leave
+  801511:	c3                   	ret
+
+00801512 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801512:	55                   	push   %ebp
+  801513:	89 e5                	mov    %esp,%ebp
+  801515:	53                   	push   %ebx
+  801516:	83 ec 04             	sub    $0x4,%esp
+  801519:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80151c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80151f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801522:	a3 00 60 80 00       	mov    %eax,0x806000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801527:	ba 00 00 00 00       	mov    $0x0,%edx
+  80152c:	b8 05 00 00 00       	mov    $0x5,%eax
+  801531:	e8 43 ff ff ff       	call   801479 <fsipc>
+  801536:	85 c0                	test   %eax,%eax
+  801538:	78 2c                	js     801566 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80153a:	83 ec 08             	sub    $0x8,%esp
+  80153d:	68 00 60 80 00       	push   $0x806000
+  801542:	53                   	push   %ebx
+  801543:	e8 e3 f2 ff ff       	call   80082b <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801548:	a1 80 60 80 00       	mov    0x806080,%eax
+  80154d:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801553:	a1 84 60 80 00       	mov    0x806084,%eax
+  801558:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  80155e:	83 c4 10             	add    $0x10,%esp
+  801561:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801566:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801569:	c9                   	leave
+  80156a:	c3                   	ret
+
+0080156b <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80156b:	55                   	push   %ebp
+  80156c:	89 e5                	mov    %esp,%ebp
+  80156e:	83 ec 0c             	sub    $0xc,%esp
+  801571:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801574:	8b 55 08             	mov    0x8(%ebp),%edx
+  801577:	8b 52 0c             	mov    0xc(%edx),%edx
+  80157a:	89 15 00 60 80 00    	mov    %edx,0x806000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801580:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801585:	39 d0                	cmp    %edx,%eax
+  801587:	0f 47 c2             	cmova  %edx,%eax
+  80158a:	a3 04 60 80 00       	mov    %eax,0x806004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  80158f:	50                   	push   %eax
+  801590:	ff 75 0c             	push   0xc(%ebp)
+  801593:	68 08 60 80 00       	push   $0x806008
+  801598:	e8 14 f4 ff ff       	call   8009b1 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  80159d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015a2:	b8 04 00 00 00       	mov    $0x4,%eax
+  8015a7:	e8 cd fe ff ff       	call   801479 <fsipc>
+}
+  8015ac:	c9                   	leave
+  8015ad:	c3                   	ret
+
+008015ae <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8015ae:	55                   	push   %ebp
+  8015af:	89 e5                	mov    %esp,%ebp
+  8015b1:	56                   	push   %esi
+  8015b2:	53                   	push   %ebx
+  8015b3:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8015b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015b9:	8b 40 0c             	mov    0xc(%eax),%eax
+  8015bc:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read.req_n = n;
+  8015c1:	89 35 04 60 80 00    	mov    %esi,0x806004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8015c7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015cc:	b8 03 00 00 00       	mov    $0x3,%eax
+  8015d1:	e8 a3 fe ff ff       	call   801479 <fsipc>
+  8015d6:	89 c3                	mov    %eax,%ebx
+  8015d8:	85 c0                	test   %eax,%eax
+  8015da:	78 1f                	js     8015fb <devfile_read+0x4d>
+  assert(r <= n);
+  8015dc:	39 c6                	cmp    %eax,%esi
+  8015de:	72 24                	jb     801604 <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  8015e0:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8015e5:	7f 33                	jg     80161a <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8015e7:	83 ec 04             	sub    $0x4,%esp
+  8015ea:	50                   	push   %eax
+  8015eb:	68 00 60 80 00       	push   $0x806000
+  8015f0:	ff 75 0c             	push   0xc(%ebp)
+  8015f3:	e8 b9 f3 ff ff       	call   8009b1 <memmove>
+  return r;
+  8015f8:	83 c4 10             	add    $0x10,%esp
+}
+  8015fb:	89 d8                	mov    %ebx,%eax
+  8015fd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801600:	5b                   	pop    %ebx
+  801601:	5e                   	pop    %esi
+  801602:	5d                   	pop    %ebp
+  801603:	c3                   	ret
+  assert(r <= n);
+  801604:	68 80 30 80 00       	push   $0x803080
+  801609:	68 87 30 80 00       	push   $0x803087
+  80160e:	6a 78                	push   $0x78
+  801610:	68 9c 30 80 00       	push   $0x80309c
+  801615:	e8 7d eb ff ff       	call   800197 <_panic>
+  assert(r <= PGSIZE);
+  80161a:	68 a7 30 80 00       	push   $0x8030a7
+  80161f:	68 87 30 80 00       	push   $0x803087
+  801624:	6a 79                	push   $0x79
+  801626:	68 9c 30 80 00       	push   $0x80309c
+  80162b:	e8 67 eb ff ff       	call   800197 <_panic>
+
+00801630 <open>:
+open(const char *path, int mode) {
+  801630:	55                   	push   %ebp
+  801631:	89 e5                	mov    %esp,%ebp
+  801633:	56                   	push   %esi
+  801634:	53                   	push   %ebx
+  801635:	83 ec 1c             	sub    $0x1c,%esp
+  801638:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  80163b:	56                   	push   %esi
+  80163c:	e8 af f1 ff ff       	call   8007f0 <strlen>
+  801641:	83 c4 10             	add    $0x10,%esp
+  801644:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801649:	7f 6c                	jg     8016b7 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  80164b:	83 ec 0c             	sub    $0xc,%esp
+  80164e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801651:	50                   	push   %eax
+  801652:	e8 ba f8 ff ff       	call   800f11 <fd_alloc>
+  801657:	89 c3                	mov    %eax,%ebx
+  801659:	83 c4 10             	add    $0x10,%esp
+  80165c:	85 c0                	test   %eax,%eax
+  80165e:	78 3c                	js     80169c <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801660:	83 ec 08             	sub    $0x8,%esp
+  801663:	56                   	push   %esi
+  801664:	68 00 60 80 00       	push   $0x806000
+  801669:	e8 bd f1 ff ff       	call   80082b <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  80166e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801671:	a3 00 64 80 00       	mov    %eax,0x806400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801676:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801679:	b8 01 00 00 00       	mov    $0x1,%eax
+  80167e:	e8 f6 fd ff ff       	call   801479 <fsipc>
+  801683:	89 c3                	mov    %eax,%ebx
+  801685:	83 c4 10             	add    $0x10,%esp
+  801688:	85 c0                	test   %eax,%eax
+  80168a:	78 19                	js     8016a5 <open+0x75>
+  return fd2num(fd);
+  80168c:	83 ec 0c             	sub    $0xc,%esp
+  80168f:	ff 75 f4             	push   -0xc(%ebp)
+  801692:	e8 53 f8 ff ff       	call   800eea <fd2num>
+  801697:	89 c3                	mov    %eax,%ebx
+  801699:	83 c4 10             	add    $0x10,%esp
+}
+  80169c:	89 d8                	mov    %ebx,%eax
+  80169e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016a1:	5b                   	pop    %ebx
+  8016a2:	5e                   	pop    %esi
+  8016a3:	5d                   	pop    %ebp
+  8016a4:	c3                   	ret
+    fd_close(fd, 0);
+  8016a5:	83 ec 08             	sub    $0x8,%esp
+  8016a8:	6a 00                	push   $0x0
+  8016aa:	ff 75 f4             	push   -0xc(%ebp)
+  8016ad:	e8 58 f9 ff ff       	call   80100a <fd_close>
+    return r;
+  8016b2:	83 c4 10             	add    $0x10,%esp
+  8016b5:	eb e5                	jmp    80169c <open+0x6c>
+    return -E_BAD_PATH;
+  8016b7:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8016bc:	eb de                	jmp    80169c <open+0x6c>
+
+008016be <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  8016be:	55                   	push   %ebp
+  8016bf:	89 e5                	mov    %esp,%ebp
+  8016c1:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  8016c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016c9:	b8 08 00 00 00       	mov    $0x8,%eax
+  8016ce:	e8 a6 fd ff ff       	call   801479 <fsipc>
+}
+  8016d3:	c9                   	leave
+  8016d4:	c3                   	ret
+
+008016d5 <spawn>:
+// prog: the pathname of the program to run.
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv) {
+  8016d5:	55                   	push   %ebp
+  8016d6:	89 e5                	mov    %esp,%ebp
+  8016d8:	57                   	push   %edi
+  8016d9:	56                   	push   %esi
+  8016da:	53                   	push   %ebx
+  8016db:	81 ec 84 02 00 00    	sub    $0x284,%esp
+  //   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+  //     correct initial eip and esp values in the child.
+  //
+  //   - Start the child process running with sys_env_set_status().
+
+  if ((r = open(prog, O_RDONLY)) < 0)
+  8016e1:	6a 00                	push   $0x0
+  8016e3:	ff 75 08             	push   0x8(%ebp)
+  8016e6:	e8 45 ff ff ff       	call   801630 <open>
+  8016eb:	89 85 8c fd ff ff    	mov    %eax,-0x274(%ebp)
+  8016f1:	83 c4 10             	add    $0x10,%esp
+  8016f4:	85 c0                	test   %eax,%eax
+  8016f6:	0f 88 f8 04 00 00    	js     801bf4 <spawn+0x51f>
+  8016fc:	89 c1                	mov    %eax,%ecx
+    return r;
+  fd = r;
+
+  // Read elf header
+  elf = (struct Elf *) elf_buf;
+  if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf)
+  8016fe:	83 ec 04             	sub    $0x4,%esp
+  801701:	68 00 02 00 00       	push   $0x200
+  801706:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  80170c:	50                   	push   %eax
+  80170d:	51                   	push   %ecx
+  80170e:	e8 41 fb ff ff       	call   801254 <readn>
+  801713:	83 c4 10             	add    $0x10,%esp
+  801716:	3d 00 02 00 00       	cmp    $0x200,%eax
+  80171b:	75 5a                	jne    801777 <spawn+0xa2>
+      || elf->e_magic != ELF_MAGIC) {
+  80171d:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  801724:	45 4c 46 
+  801727:	75 4e                	jne    801777 <spawn+0xa2>
+
+// This must be inlined.  Exercise for reader: why?
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+  envid_t ret;
+  asm volatile("int %2"
+  801729:	b8 07 00 00 00       	mov    $0x7,%eax
+  80172e:	cd 30                	int    $0x30
+  801730:	89 85 88 fd ff ff    	mov    %eax,-0x278(%ebp)
+    cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+    return -E_NOT_EXEC;
+  }
+
+  // Create new child environment
+  if ((r = sys_exofork()) < 0)
+  801736:	85 c0                	test   %eax,%eax
+  801738:	0f 88 aa 04 00 00    	js     801be8 <spawn+0x513>
+    return r;
+  child = r;
+
+  // Set up trap frame, including initial stack.
+  child_tf = envs[ENVX(child)].env_tf;
+  80173e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801743:	8d 34 c0             	lea    (%eax,%eax,8),%esi
+  801746:	c1 e6 04             	shl    $0x4,%esi
+  801749:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  80174f:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  801755:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80175a:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  child_tf.tf_eip = elf->e_entry;
+  80175c:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  801762:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  uintptr_t *argv_store;
+
+  // Count the number of arguments (argc)
+  // and the total amount of space needed for strings (string_size).
+  string_size = 0;
+  for (argc = 0; argv[argc] != 0; argc++)
+  801768:	bb 00 00 00 00       	mov    $0x0,%ebx
+  string_size = 0;
+  80176d:	be 00 00 00 00       	mov    $0x0,%esi
+  801772:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  for (argc = 0; argv[argc] != 0; argc++)
+  801775:	eb 4b                	jmp    8017c2 <spawn+0xed>
+    close(fd);
+  801777:	83 ec 0c             	sub    $0xc,%esp
+  80177a:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  801780:	e8 0c f9 ff ff       	call   801091 <close>
+    cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  801785:	83 c4 0c             	add    $0xc,%esp
+  801788:	68 7f 45 4c 46       	push   $0x464c457f
+  80178d:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  801793:	68 b3 30 80 00       	push   $0x8030b3
+  801798:	e8 d5 ea ff ff       	call   800272 <cprintf>
+    return -E_NOT_EXEC;
+  80179d:	83 c4 10             	add    $0x10,%esp
+  8017a0:	c7 85 8c fd ff ff f2 	movl   $0xfffffff2,-0x274(%ebp)
+  8017a7:	ff ff ff 
+  8017aa:	e9 45 04 00 00       	jmp    801bf4 <spawn+0x51f>
+    string_size += strlen(argv[argc]) + 1;
+  8017af:	83 ec 0c             	sub    $0xc,%esp
+  8017b2:	50                   	push   %eax
+  8017b3:	e8 38 f0 ff ff       	call   8007f0 <strlen>
+  8017b8:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+  for (argc = 0; argv[argc] != 0; argc++)
+  8017bc:	83 c3 01             	add    $0x1,%ebx
+  8017bf:	83 c4 10             	add    $0x10,%esp
+  8017c2:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  8017c5:	85 c0                	test   %eax,%eax
+  8017c7:	75 e6                	jne    8017af <spawn+0xda>
+  // Determine where to place the strings and the argv array.
+  // Set up pointers into the temporary page 'UTEMP'; we'll map a page
+  // there later, then remap that page into the child environment
+  // at (USTACKTOP - PGSIZE).
+  // strings is the topmost thing on the stack.
+  string_store = (char *) UTEMP + PGSIZE - string_size;
+  8017c9:	89 9d 84 fd ff ff    	mov    %ebx,-0x27c(%ebp)
+  8017cf:	bf 00 10 40 00       	mov    $0x401000,%edi
+  8017d4:	29 f7                	sub    %esi,%edi
+  // argv is below that.  There's one argument pointer per argument, plus
+  // a null pointer.
+  argv_store = (uintptr_t *) (ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  8017d6:	89 fa                	mov    %edi,%edx
+  8017d8:	83 e2 fc             	and    $0xfffffffc,%edx
+  8017db:	8d 04 9d 04 00 00 00 	lea    0x4(,%ebx,4),%eax
+  8017e2:	29 c2                	sub    %eax,%edx
+  8017e4:	89 95 94 fd ff ff    	mov    %edx,-0x26c(%ebp)
+
+  // Make sure that argv, strings, and the 2 words that hold 'argc'
+  // and 'argv' themselves will all fit in a single stack page.
+  if ((void *) (argv_store - 2) < (void *) UTEMP)
+  8017ea:	8d 42 f8             	lea    -0x8(%edx),%eax
+  8017ed:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  8017f2:	0f 86 1f 04 00 00    	jbe    801c17 <spawn+0x542>
+    return -E_NO_MEM;
+
+  // Allocate the single stack page at UTEMP.
+  if ((r = sys_page_alloc(0, (void *) UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  8017f8:	83 ec 04             	sub    $0x4,%esp
+  8017fb:	6a 07                	push   $0x7
+  8017fd:	68 00 00 40 00       	push   $0x400000
+  801802:	6a 00                	push   $0x0
+  801804:	e8 0e f4 ff ff       	call   800c17 <sys_page_alloc>
+  801809:	83 c4 10             	add    $0x10,%esp
+  80180c:	85 c0                	test   %eax,%eax
+  80180e:	0f 88 08 04 00 00    	js     801c1c <spawn+0x547>
+  //	  (Again, argv should use an address valid in the child's
+  //	  environment.)
+  //
+  //	* Set *init_esp to the initial stack pointer for the child,
+  //	  (Again, use an address valid in the child's environment.)
+  for (i = 0; i < argc; i++) {
+  801814:	be 00 00 00 00       	mov    $0x0,%esi
+  801819:	89 9d 90 fd ff ff    	mov    %ebx,-0x270(%ebp)
+  80181f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801822:	39 b5 90 fd ff ff    	cmp    %esi,-0x270(%ebp)
+  801828:	7e 32                	jle    80185c <spawn+0x187>
+    argv_store[i] = UTEMP2USTACK(string_store);
+  80182a:	8d 87 00 d0 7f ee    	lea    -0x11803000(%edi),%eax
+  801830:	8b 8d 94 fd ff ff    	mov    -0x26c(%ebp),%ecx
+  801836:	89 04 b1             	mov    %eax,(%ecx,%esi,4)
+    strcpy(string_store, argv[i]);
+  801839:	83 ec 08             	sub    $0x8,%esp
+  80183c:	ff 34 b3             	push   (%ebx,%esi,4)
+  80183f:	57                   	push   %edi
+  801840:	e8 e6 ef ff ff       	call   80082b <strcpy>
+    string_store += strlen(argv[i]) + 1;
+  801845:	83 c4 04             	add    $0x4,%esp
+  801848:	ff 34 b3             	push   (%ebx,%esi,4)
+  80184b:	e8 a0 ef ff ff       	call   8007f0 <strlen>
+  801850:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+  for (i = 0; i < argc; i++) {
+  801854:	83 c6 01             	add    $0x1,%esi
+  801857:	83 c4 10             	add    $0x10,%esp
+  80185a:	eb c6                	jmp    801822 <spawn+0x14d>
+  }
+  argv_store[argc] = 0;
+  80185c:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  801862:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  801868:	c7 04 88 00 00 00 00 	movl   $0x0,(%eax,%ecx,4)
+  assert(string_store == (char *) UTEMP + PGSIZE);
+  80186f:	81 ff 00 10 40 00    	cmp    $0x401000,%edi
+  801875:	0f 85 87 00 00 00    	jne    801902 <spawn+0x22d>
+
+  argv_store[-1] = UTEMP2USTACK(argv_store);
+  80187b:	8b 8d 94 fd ff ff    	mov    -0x26c(%ebp),%ecx
+  801881:	8d 81 00 d0 7f ee    	lea    -0x11803000(%ecx),%eax
+  801887:	89 41 fc             	mov    %eax,-0x4(%ecx)
+  argv_store[-2] = argc;
+  80188a:	89 c8                	mov    %ecx,%eax
+  80188c:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  801892:	89 48 f8             	mov    %ecx,-0x8(%eax)
+
+  *init_esp = UTEMP2USTACK(&argv_store[-2]);
+  801895:	2d 08 30 80 11       	sub    $0x11803008,%eax
+  80189a:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+
+  // After completing the stack, map it into the child's address space
+  // and unmap it from ours!
+  if ((r = sys_page_map(0, UTEMP, child, (void *) (USTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  8018a0:	83 ec 0c             	sub    $0xc,%esp
+  8018a3:	6a 07                	push   $0x7
+  8018a5:	68 00 d0 bf ee       	push   $0xeebfd000
+  8018aa:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  8018b0:	68 00 00 40 00       	push   $0x400000
+  8018b5:	6a 00                	push   $0x0
+  8018b7:	e8 9e f3 ff ff       	call   800c5a <sys_page_map>
+  8018bc:	89 c3                	mov    %eax,%ebx
+  8018be:	83 c4 20             	add    $0x20,%esp
+  8018c1:	85 c0                	test   %eax,%eax
+  8018c3:	0f 88 5b 03 00 00    	js     801c24 <spawn+0x54f>
+    goto error;
+  if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  8018c9:	83 ec 08             	sub    $0x8,%esp
+  8018cc:	68 00 00 40 00       	push   $0x400000
+  8018d1:	6a 00                	push   $0x0
+  8018d3:	e8 c4 f3 ff ff       	call   800c9c <sys_page_unmap>
+  8018d8:	89 c3                	mov    %eax,%ebx
+  8018da:	83 c4 10             	add    $0x10,%esp
+  8018dd:	85 c0                	test   %eax,%eax
+  8018df:	0f 88 3f 03 00 00    	js     801c24 <spawn+0x54f>
+  ph = (struct Proghdr *) (elf_buf + elf->e_phoff);
+  8018e5:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  8018eb:	8d 8c 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%ecx
+  for (i = 0; i < elf->e_phnum; i++, ph++) {
+  8018f2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018f7:	89 c8                	mov    %ecx,%eax
+  8018f9:	89 d1                	mov    %edx,%ecx
+  8018fb:	89 c2                	mov    %eax,%edx
+  8018fd:	e9 5a 01 00 00       	jmp    801a5c <spawn+0x387>
+  assert(string_store == (char *) UTEMP + PGSIZE);
+  801902:	68 28 31 80 00       	push   $0x803128
+  801907:	68 87 30 80 00       	push   $0x803087
+  80190c:	68 52 01 00 00       	push   $0x152
+  801911:	68 cd 30 80 00       	push   $0x8030cd
+  801916:	e8 7c e8 ff ff       	call   800197 <_panic>
+      // allocate a blank page
+      if ((r = sys_page_alloc(child, (void *) (va + i), perm)) < 0)
+        return r;
+    } else {
+      // from file
+      if ((r = sys_page_alloc(0, UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  80191b:	83 ec 04             	sub    $0x4,%esp
+  80191e:	6a 07                	push   $0x7
+  801920:	68 00 00 40 00       	push   $0x400000
+  801925:	6a 00                	push   $0x0
+  801927:	e8 eb f2 ff ff       	call   800c17 <sys_page_alloc>
+  80192c:	83 c4 10             	add    $0x10,%esp
+  80192f:	85 c0                	test   %eax,%eax
+  801931:	0f 88 cb 02 00 00    	js     801c02 <spawn+0x52d>
+        return r;
+      if ((r = seek(fd, fileoffset + i)) < 0)
+  801937:	83 ec 08             	sub    $0x8,%esp
+  80193a:	8b 95 80 fd ff ff    	mov    -0x280(%ebp),%edx
+  801940:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  801946:	01 d0                	add    %edx,%eax
+  801948:	50                   	push   %eax
+  801949:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  80194f:	e8 c9 f9 ff ff       	call   80131d <seek>
+  801954:	83 c4 10             	add    $0x10,%esp
+  801957:	85 c0                	test   %eax,%eax
+  801959:	0f 88 aa 02 00 00    	js     801c09 <spawn+0x534>
+        return r;
+      if ((r = readn(fd, UTEMP, MIN(PGSIZE, filesz - i))) < 0)
+  80195f:	83 ec 04             	sub    $0x4,%esp
+  801962:	89 fa                	mov    %edi,%edx
+  801964:	8b 8d 94 fd ff ff    	mov    -0x26c(%ebp),%ecx
+  80196a:	29 ca                	sub    %ecx,%edx
+  80196c:	89 d0                	mov    %edx,%eax
+  80196e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801973:	39 d0                	cmp    %edx,%eax
+  801975:	0f 47 c2             	cmova  %edx,%eax
+  801978:	50                   	push   %eax
+  801979:	68 00 00 40 00       	push   $0x400000
+  80197e:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  801984:	e8 cb f8 ff ff       	call   801254 <readn>
+  801989:	83 c4 10             	add    $0x10,%esp
+  80198c:	85 c0                	test   %eax,%eax
+  80198e:	0f 88 7c 02 00 00    	js     801c10 <spawn+0x53b>
+        return r;
+      if ((r = sys_page_map(0, UTEMP, child, (void *) (va + i), perm)) < 0)
+  801994:	83 ec 0c             	sub    $0xc,%esp
+  801997:	ff b5 84 fd ff ff    	push   -0x27c(%ebp)
+  80199d:	56                   	push   %esi
+  80199e:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  8019a4:	68 00 00 40 00       	push   $0x400000
+  8019a9:	6a 00                	push   $0x0
+  8019ab:	e8 aa f2 ff ff       	call   800c5a <sys_page_map>
+  8019b0:	83 c4 20             	add    $0x20,%esp
+  8019b3:	85 c0                	test   %eax,%eax
+  8019b5:	78 7e                	js     801a35 <spawn+0x360>
+        panic("spawn: sys_page_map data: %e", r);
+      sys_page_unmap(0, UTEMP);
+  8019b7:	83 ec 08             	sub    $0x8,%esp
+  8019ba:	68 00 00 40 00       	push   $0x400000
+  8019bf:	6a 00                	push   $0x0
+  8019c1:	e8 d6 f2 ff ff       	call   800c9c <sys_page_unmap>
+  8019c6:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < memsz; i += PGSIZE) {
+  8019c9:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8019cf:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8019d5:	89 9d 94 fd ff ff    	mov    %ebx,-0x26c(%ebp)
+  8019db:	8b 85 90 fd ff ff    	mov    -0x270(%ebp),%eax
+  8019e1:	39 c3                	cmp    %eax,%ebx
+  8019e3:	73 65                	jae    801a4a <spawn+0x375>
+    if (i >= filesz) {
+  8019e5:	39 fb                	cmp    %edi,%ebx
+  8019e7:	0f 82 2e ff ff ff    	jb     80191b <spawn+0x246>
+      if ((r = sys_page_alloc(child, (void *) (va + i), perm)) < 0)
+  8019ed:	83 ec 04             	sub    $0x4,%esp
+  8019f0:	ff b5 84 fd ff ff    	push   -0x27c(%ebp)
+  8019f6:	56                   	push   %esi
+  8019f7:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  8019fd:	e8 15 f2 ff ff       	call   800c17 <sys_page_alloc>
+  801a02:	83 c4 10             	add    $0x10,%esp
+  801a05:	85 c0                	test   %eax,%eax
+  801a07:	79 c0                	jns    8019c9 <spawn+0x2f4>
+  801a09:	89 c7                	mov    %eax,%edi
+  sys_env_destroy(child);
+  801a0b:	83 ec 0c             	sub    $0xc,%esp
+  801a0e:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  801a14:	e8 7f f1 ff ff       	call   800b98 <sys_env_destroy>
+  close(fd);
+  801a19:	83 c4 04             	add    $0x4,%esp
+  801a1c:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  801a22:	e8 6a f6 ff ff       	call   801091 <close>
+  return r;
+  801a27:	83 c4 10             	add    $0x10,%esp
+  801a2a:	89 bd 8c fd ff ff    	mov    %edi,-0x274(%ebp)
+  801a30:	e9 bf 01 00 00       	jmp    801bf4 <spawn+0x51f>
+        panic("spawn: sys_page_map data: %e", r);
+  801a35:	50                   	push   %eax
+  801a36:	68 d9 30 80 00       	push   $0x8030d9
+  801a3b:	68 84 01 00 00       	push   $0x184
+  801a40:	68 cd 30 80 00       	push   $0x8030cd
+  801a45:	e8 4d e7 ff ff       	call   800197 <_panic>
+  801a4a:	8b 8d 7c fd ff ff    	mov    -0x284(%ebp),%ecx
+  801a50:	8b 95 78 fd ff ff    	mov    -0x288(%ebp),%edx
+  for (i = 0; i < elf->e_phnum; i++, ph++) {
+  801a56:	83 c1 01             	add    $0x1,%ecx
+  801a59:	83 c2 20             	add    $0x20,%edx
+  801a5c:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  801a63:	39 c8                	cmp    %ecx,%eax
+  801a65:	0f 8e 88 00 00 00    	jle    801af3 <spawn+0x41e>
+    if (ph->p_type != ELF_PROG_LOAD)
+  801a6b:	83 3a 01             	cmpl   $0x1,(%edx)
+  801a6e:	75 e6                	jne    801a56 <spawn+0x381>
+    if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  801a70:	8b 42 18             	mov    0x18(%edx),%eax
+  801a73:	83 e0 02             	and    $0x2,%eax
+    perm = PTE_P | PTE_U;
+  801a76:	83 f8 01             	cmp    $0x1,%eax
+  801a79:	19 c0                	sbb    %eax,%eax
+  801a7b:	83 e0 fe             	and    $0xfffffffe,%eax
+  801a7e:	83 c0 07             	add    $0x7,%eax
+    if ((r = map_segment(child, ph->p_va, ph->p_memsz, fd, ph->p_filesz, ph->p_offset, perm)) < 0)
+  801a81:	8b 72 04             	mov    0x4(%edx),%esi
+  801a84:	89 b5 80 fd ff ff    	mov    %esi,-0x280(%ebp)
+  801a8a:	8b 7a 10             	mov    0x10(%edx),%edi
+  801a8d:	89 bd 94 fd ff ff    	mov    %edi,-0x26c(%ebp)
+  801a93:	8b 5a 14             	mov    0x14(%edx),%ebx
+  801a96:	89 9d 90 fd ff ff    	mov    %ebx,-0x270(%ebp)
+  801a9c:	8b 7a 08             	mov    0x8(%edx),%edi
+  801a9f:	89 bd 84 fd ff ff    	mov    %edi,-0x27c(%ebp)
+  if ((i = PGOFF(va))) {
+  801aa5:	89 fb                	mov    %edi,%ebx
+  801aa7:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  801aad:	74 1c                	je     801acb <spawn+0x3f6>
+    va -= i;
+  801aaf:	29 df                	sub    %ebx,%edi
+  801ab1:	89 bd 84 fd ff ff    	mov    %edi,-0x27c(%ebp)
+    memsz += i;
+  801ab7:	01 9d 90 fd ff ff    	add    %ebx,-0x270(%ebp)
+    filesz += i;
+  801abd:	01 9d 94 fd ff ff    	add    %ebx,-0x26c(%ebp)
+    fileoffset -= i;
+  801ac3:	29 de                	sub    %ebx,%esi
+  801ac5:	89 b5 80 fd ff ff    	mov    %esi,-0x280(%ebp)
+  for (i = 0; i < memsz; i += PGSIZE) {
+  801acb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ad0:	8b bd 94 fd ff ff    	mov    -0x26c(%ebp),%edi
+  801ad6:	8b b5 84 fd ff ff    	mov    -0x27c(%ebp),%esi
+  801adc:	89 8d 7c fd ff ff    	mov    %ecx,-0x284(%ebp)
+  801ae2:	89 95 78 fd ff ff    	mov    %edx,-0x288(%ebp)
+  801ae8:	89 85 84 fd ff ff    	mov    %eax,-0x27c(%ebp)
+  801aee:	e9 e2 fe ff ff       	jmp    8019d5 <spawn+0x300>
+  close(fd);
+  801af3:	83 ec 0c             	sub    $0xc,%esp
+  801af6:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  801afc:	e8 90 f5 ff ff       	call   801091 <close>
+  801b01:	83 c4 10             	add    $0x10,%esp
+  // LAB 5: Your code here.
+  int r;
+  unsigned perm = PTE_P | PTE_U | PTE_SHARE;
+
+  uintptr_t addr;
+  for (addr = 0; addr < UTOP; addr += PGSIZE)
+  801b04:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b09:	8b b5 88 fd ff ff    	mov    -0x278(%ebp),%esi
+  801b0f:	eb 0e                	jmp    801b1f <spawn+0x44a>
+  801b11:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801b17:	81 fb 00 00 c0 ee    	cmp    $0xeec00000,%ebx
+  801b1d:	74 5e                	je     801b7d <spawn+0x4a8>
+    if ((uvpd[PDX(addr)] & PTE_P) && (uvpt[PGNUM(addr)] & perm) == perm) {
+  801b1f:	89 d8                	mov    %ebx,%eax
+  801b21:	c1 e8 16             	shr    $0x16,%eax
+  801b24:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801b2b:	a8 01                	test   $0x1,%al
+  801b2d:	74 e2                	je     801b11 <spawn+0x43c>
+  801b2f:	89 da                	mov    %ebx,%edx
+  801b31:	c1 ea 0c             	shr    $0xc,%edx
+  801b34:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  801b3b:	25 05 04 00 00       	and    $0x405,%eax
+  801b40:	3d 05 04 00 00       	cmp    $0x405,%eax
+  801b45:	75 ca                	jne    801b11 <spawn+0x43c>
+      if ((r = sys_page_map(0, (void *) addr, child, (void *) addr, uvpt[PGNUM(addr)] & PTE_SYSCALL)) < 0) {
+  801b47:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  801b4e:	83 ec 0c             	sub    $0xc,%esp
+  801b51:	25 07 0e 00 00       	and    $0xe07,%eax
+  801b56:	50                   	push   %eax
+  801b57:	53                   	push   %ebx
+  801b58:	56                   	push   %esi
+  801b59:	53                   	push   %ebx
+  801b5a:	6a 00                	push   $0x0
+  801b5c:	e8 f9 f0 ff ff       	call   800c5a <sys_page_map>
+  801b61:	83 c4 20             	add    $0x20,%esp
+  801b64:	85 c0                	test   %eax,%eax
+  801b66:	79 a9                	jns    801b11 <spawn+0x43c>
+        panic("copy_shared_pages : sys_page_map: %e\n", r);
+  801b68:	50                   	push   %eax
+  801b69:	68 50 31 80 00       	push   $0x803150
+  801b6e:	68 96 01 00 00       	push   $0x196
+  801b73:	68 cd 30 80 00       	push   $0x8030cd
+  801b78:	e8 1a e6 ff ff       	call   800197 <_panic>
+  if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  801b7d:	83 ec 08             	sub    $0x8,%esp
+  801b80:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  801b86:	50                   	push   %eax
+  801b87:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  801b8d:	e8 8e f1 ff ff       	call   800d20 <sys_env_set_trapframe>
+  801b92:	83 c4 10             	add    $0x10,%esp
+  801b95:	85 c0                	test   %eax,%eax
+  801b97:	78 25                	js     801bbe <spawn+0x4e9>
+  if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  801b99:	83 ec 08             	sub    $0x8,%esp
+  801b9c:	6a 02                	push   $0x2
+  801b9e:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  801ba4:	e8 35 f1 ff ff       	call   800cde <sys_env_set_status>
+  801ba9:	83 c4 10             	add    $0x10,%esp
+  801bac:	85 c0                	test   %eax,%eax
+  801bae:	78 23                	js     801bd3 <spawn+0x4fe>
+  return child;
+  801bb0:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  801bb6:	89 85 8c fd ff ff    	mov    %eax,-0x274(%ebp)
+  801bbc:	eb 36                	jmp    801bf4 <spawn+0x51f>
+    panic("sys_env_set_trapframe: %e", r);
+  801bbe:	50                   	push   %eax
+  801bbf:	68 f6 30 80 00       	push   $0x8030f6
+  801bc4:	68 86 00 00 00       	push   $0x86
+  801bc9:	68 cd 30 80 00       	push   $0x8030cd
+  801bce:	e8 c4 e5 ff ff       	call   800197 <_panic>
+    panic("sys_env_set_status: %e", r);
+  801bd3:	50                   	push   %eax
+  801bd4:	68 10 31 80 00       	push   $0x803110
+  801bd9:	68 89 00 00 00       	push   $0x89
+  801bde:	68 cd 30 80 00       	push   $0x8030cd
+  801be3:	e8 af e5 ff ff       	call   800197 <_panic>
+    return r;
+  801be8:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  801bee:	89 85 8c fd ff ff    	mov    %eax,-0x274(%ebp)
+}
+  801bf4:	8b 85 8c fd ff ff    	mov    -0x274(%ebp),%eax
+  801bfa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bfd:	5b                   	pop    %ebx
+  801bfe:	5e                   	pop    %esi
+  801bff:	5f                   	pop    %edi
+  801c00:	5d                   	pop    %ebp
+  801c01:	c3                   	ret
+  801c02:	89 c7                	mov    %eax,%edi
+  801c04:	e9 02 fe ff ff       	jmp    801a0b <spawn+0x336>
+  801c09:	89 c7                	mov    %eax,%edi
+  801c0b:	e9 fb fd ff ff       	jmp    801a0b <spawn+0x336>
+  801c10:	89 c7                	mov    %eax,%edi
+  801c12:	e9 f4 fd ff ff       	jmp    801a0b <spawn+0x336>
+    return -E_NO_MEM;
+  801c17:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  return r;
+  801c1c:	89 85 8c fd ff ff    	mov    %eax,-0x274(%ebp)
+  801c22:	eb d0                	jmp    801bf4 <spawn+0x51f>
+  sys_page_unmap(0, UTEMP);
+  801c24:	83 ec 08             	sub    $0x8,%esp
+  801c27:	68 00 00 40 00       	push   $0x400000
+  801c2c:	6a 00                	push   $0x0
+  801c2e:	e8 69 f0 ff ff       	call   800c9c <sys_page_unmap>
+  801c33:	83 c4 10             	add    $0x10,%esp
+  801c36:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+  801c3c:	eb b6                	jmp    801bf4 <spawn+0x51f>
+
+00801c3e <spawnl>:
+spawnl(const char *prog, const char *arg0, ...) {
+  801c3e:	55                   	push   %ebp
+  801c3f:	89 e5                	mov    %esp,%ebp
+  801c41:	56                   	push   %esi
+  801c42:	53                   	push   %ebx
+  va_start(vl, arg0);
+  801c43:	8d 55 10             	lea    0x10(%ebp),%edx
+  int argc = 0;
+  801c46:	b8 00 00 00 00       	mov    $0x0,%eax
+  while (va_arg(vl, void *) != NULL)
+  801c4b:	eb 05                	jmp    801c52 <spawnl+0x14>
+    argc++;
+  801c4d:	83 c0 01             	add    $0x1,%eax
+  while (va_arg(vl, void *) != NULL)
+  801c50:	89 ca                	mov    %ecx,%edx
+  801c52:	8d 4a 04             	lea    0x4(%edx),%ecx
+  801c55:	83 3a 00             	cmpl   $0x0,(%edx)
+  801c58:	75 f3                	jne    801c4d <spawnl+0xf>
+  const char *argv[argc + 2];
+  801c5a:	8d 14 85 17 00 00 00 	lea    0x17(,%eax,4),%edx
+  801c61:	83 e2 f0             	and    $0xfffffff0,%edx
+  801c64:	29 d4                	sub    %edx,%esp
+  801c66:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  801c6a:	89 da                	mov    %ebx,%edx
+  801c6c:	c1 ea 02             	shr    $0x2,%edx
+  801c6f:	83 e3 fc             	and    $0xfffffffc,%ebx
+  argv[0] = arg0;
+  801c72:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c75:	89 0c 95 00 00 00 00 	mov    %ecx,0x0(,%edx,4)
+  argv[argc + 1] = NULL;
+  801c7c:	c7 44 83 04 00 00 00 	movl   $0x0,0x4(%ebx,%eax,4)
+  801c83:	00 
+  va_start(vl, arg0);
+  801c84:	8d 4d 10             	lea    0x10(%ebp),%ecx
+  for (i = 0; i < argc; i++)
+  801c87:	89 c2                	mov    %eax,%edx
+  801c89:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c8e:	eb 0b                	jmp    801c9b <spawnl+0x5d>
+    argv[i + 1] = va_arg(vl, const char *);
+  801c90:	83 c0 01             	add    $0x1,%eax
+  801c93:	8b 31                	mov    (%ecx),%esi
+  801c95:	89 34 83             	mov    %esi,(%ebx,%eax,4)
+  801c98:	8d 49 04             	lea    0x4(%ecx),%ecx
+  for (i = 0; i < argc; i++)
+  801c9b:	39 d0                	cmp    %edx,%eax
+  801c9d:	75 f1                	jne    801c90 <spawnl+0x52>
+  return spawn(prog, argv);
+  801c9f:	83 ec 08             	sub    $0x8,%esp
+  801ca2:	53                   	push   %ebx
+  801ca3:	ff 75 08             	push   0x8(%ebp)
+  801ca6:	e8 2a fa ff ff       	call   8016d5 <spawn>
+}
+  801cab:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cae:	5b                   	pop    %ebx
+  801caf:	5e                   	pop    %esi
+  801cb0:	5d                   	pop    %ebp
+  801cb1:	c3                   	ret
+
+00801cb2 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801cb2:	55                   	push   %ebp
+  801cb3:	89 e5                	mov    %esp,%ebp
+  801cb5:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801cb8:	68 76 31 80 00       	push   $0x803176
+  801cbd:	ff 75 0c             	push   0xc(%ebp)
+  801cc0:	e8 66 eb ff ff       	call   80082b <strcpy>
+	return 0;
+}
+  801cc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cca:	c9                   	leave
+  801ccb:	c3                   	ret
+
+00801ccc <devsock_close>:
+{
+  801ccc:	55                   	push   %ebp
+  801ccd:	89 e5                	mov    %esp,%ebp
+  801ccf:	53                   	push   %ebx
+  801cd0:	83 ec 10             	sub    $0x10,%esp
+  801cd3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801cd6:	53                   	push   %ebx
+  801cd7:	e8 03 0a 00 00       	call   8026df <pageref>
+  801cdc:	89 c2                	mov    %eax,%edx
+  801cde:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801ce1:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801ce6:	83 fa 01             	cmp    $0x1,%edx
+  801ce9:	74 05                	je     801cf0 <devsock_close+0x24>
+}
+  801ceb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cee:	c9                   	leave
+  801cef:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801cf0:	83 ec 0c             	sub    $0xc,%esp
+  801cf3:	ff 73 0c             	push   0xc(%ebx)
+  801cf6:	e8 b7 02 00 00       	call   801fb2 <nsipc_close>
+  801cfb:	83 c4 10             	add    $0x10,%esp
+  801cfe:	eb eb                	jmp    801ceb <devsock_close+0x1f>
+
+00801d00 <devsock_write>:
+{
+  801d00:	55                   	push   %ebp
+  801d01:	89 e5                	mov    %esp,%ebp
+  801d03:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801d06:	6a 00                	push   $0x0
+  801d08:	ff 75 10             	push   0x10(%ebp)
+  801d0b:	ff 75 0c             	push   0xc(%ebp)
+  801d0e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d11:	ff 70 0c             	push   0xc(%eax)
+  801d14:	e8 79 03 00 00       	call   802092 <nsipc_send>
+}
+  801d19:	c9                   	leave
+  801d1a:	c3                   	ret
+
+00801d1b <devsock_read>:
+{
+  801d1b:	55                   	push   %ebp
+  801d1c:	89 e5                	mov    %esp,%ebp
+  801d1e:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801d21:	6a 00                	push   $0x0
+  801d23:	ff 75 10             	push   0x10(%ebp)
+  801d26:	ff 75 0c             	push   0xc(%ebp)
+  801d29:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d2c:	ff 70 0c             	push   0xc(%eax)
+  801d2f:	e8 ef 02 00 00       	call   802023 <nsipc_recv>
+}
+  801d34:	c9                   	leave
+  801d35:	c3                   	ret
+
+00801d36 <fd2sockid>:
+{
+  801d36:	55                   	push   %ebp
+  801d37:	89 e5                	mov    %esp,%ebp
+  801d39:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801d3c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801d3f:	52                   	push   %edx
+  801d40:	50                   	push   %eax
+  801d41:	e8 21 f2 ff ff       	call   800f67 <fd_lookup>
+  801d46:	83 c4 10             	add    $0x10,%esp
+  801d49:	85 c0                	test   %eax,%eax
+  801d4b:	78 10                	js     801d5d <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801d4d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d50:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  801d56:	39 08                	cmp    %ecx,(%eax)
+  801d58:	75 05                	jne    801d5f <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801d5a:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801d5d:	c9                   	leave
+  801d5e:	c3                   	ret
+		return -E_NOT_SUPP;
+  801d5f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d64:	eb f7                	jmp    801d5d <fd2sockid+0x27>
+
+00801d66 <alloc_sockfd>:
+{
+  801d66:	55                   	push   %ebp
+  801d67:	89 e5                	mov    %esp,%ebp
+  801d69:	56                   	push   %esi
+  801d6a:	53                   	push   %ebx
+  801d6b:	83 ec 1c             	sub    $0x1c,%esp
+  801d6e:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801d70:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d73:	50                   	push   %eax
+  801d74:	e8 98 f1 ff ff       	call   800f11 <fd_alloc>
+  801d79:	89 c3                	mov    %eax,%ebx
+  801d7b:	83 c4 10             	add    $0x10,%esp
+  801d7e:	85 c0                	test   %eax,%eax
+  801d80:	78 43                	js     801dc5 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801d82:	83 ec 04             	sub    $0x4,%esp
+  801d85:	68 07 04 00 00       	push   $0x407
+  801d8a:	ff 75 f4             	push   -0xc(%ebp)
+  801d8d:	6a 00                	push   $0x0
+  801d8f:	e8 83 ee ff ff       	call   800c17 <sys_page_alloc>
+  801d94:	89 c3                	mov    %eax,%ebx
+  801d96:	83 c4 10             	add    $0x10,%esp
+  801d99:	85 c0                	test   %eax,%eax
+  801d9b:	78 28                	js     801dc5 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801d9d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801da0:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801da6:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801da8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dab:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801db2:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801db5:	83 ec 0c             	sub    $0xc,%esp
+  801db8:	50                   	push   %eax
+  801db9:	e8 2c f1 ff ff       	call   800eea <fd2num>
+  801dbe:	89 c3                	mov    %eax,%ebx
+  801dc0:	83 c4 10             	add    $0x10,%esp
+  801dc3:	eb 0c                	jmp    801dd1 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801dc5:	83 ec 0c             	sub    $0xc,%esp
+  801dc8:	56                   	push   %esi
+  801dc9:	e8 e4 01 00 00       	call   801fb2 <nsipc_close>
+		return r;
+  801dce:	83 c4 10             	add    $0x10,%esp
+}
+  801dd1:	89 d8                	mov    %ebx,%eax
+  801dd3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dd6:	5b                   	pop    %ebx
+  801dd7:	5e                   	pop    %esi
+  801dd8:	5d                   	pop    %ebp
+  801dd9:	c3                   	ret
+
+00801dda <accept>:
+{
+  801dda:	55                   	push   %ebp
+  801ddb:	89 e5                	mov    %esp,%ebp
+  801ddd:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801de0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801de3:	e8 4e ff ff ff       	call   801d36 <fd2sockid>
+  801de8:	85 c0                	test   %eax,%eax
+  801dea:	78 1b                	js     801e07 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801dec:	83 ec 04             	sub    $0x4,%esp
+  801def:	ff 75 10             	push   0x10(%ebp)
+  801df2:	ff 75 0c             	push   0xc(%ebp)
+  801df5:	50                   	push   %eax
+  801df6:	e8 0e 01 00 00       	call   801f09 <nsipc_accept>
+  801dfb:	83 c4 10             	add    $0x10,%esp
+  801dfe:	85 c0                	test   %eax,%eax
+  801e00:	78 05                	js     801e07 <accept+0x2d>
+	return alloc_sockfd(r);
+  801e02:	e8 5f ff ff ff       	call   801d66 <alloc_sockfd>
+}
+  801e07:	c9                   	leave
+  801e08:	c3                   	ret
+
+00801e09 <bind>:
+{
+  801e09:	55                   	push   %ebp
+  801e0a:	89 e5                	mov    %esp,%ebp
+  801e0c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e0f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e12:	e8 1f ff ff ff       	call   801d36 <fd2sockid>
+  801e17:	85 c0                	test   %eax,%eax
+  801e19:	78 12                	js     801e2d <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801e1b:	83 ec 04             	sub    $0x4,%esp
+  801e1e:	ff 75 10             	push   0x10(%ebp)
+  801e21:	ff 75 0c             	push   0xc(%ebp)
+  801e24:	50                   	push   %eax
+  801e25:	e8 31 01 00 00       	call   801f5b <nsipc_bind>
+  801e2a:	83 c4 10             	add    $0x10,%esp
+}
+  801e2d:	c9                   	leave
+  801e2e:	c3                   	ret
+
+00801e2f <shutdown>:
+{
+  801e2f:	55                   	push   %ebp
+  801e30:	89 e5                	mov    %esp,%ebp
+  801e32:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e35:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e38:	e8 f9 fe ff ff       	call   801d36 <fd2sockid>
+  801e3d:	85 c0                	test   %eax,%eax
+  801e3f:	78 0f                	js     801e50 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801e41:	83 ec 08             	sub    $0x8,%esp
+  801e44:	ff 75 0c             	push   0xc(%ebp)
+  801e47:	50                   	push   %eax
+  801e48:	e8 43 01 00 00       	call   801f90 <nsipc_shutdown>
+  801e4d:	83 c4 10             	add    $0x10,%esp
+}
+  801e50:	c9                   	leave
+  801e51:	c3                   	ret
+
+00801e52 <connect>:
+{
+  801e52:	55                   	push   %ebp
+  801e53:	89 e5                	mov    %esp,%ebp
+  801e55:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e58:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e5b:	e8 d6 fe ff ff       	call   801d36 <fd2sockid>
+  801e60:	85 c0                	test   %eax,%eax
+  801e62:	78 12                	js     801e76 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801e64:	83 ec 04             	sub    $0x4,%esp
+  801e67:	ff 75 10             	push   0x10(%ebp)
+  801e6a:	ff 75 0c             	push   0xc(%ebp)
+  801e6d:	50                   	push   %eax
+  801e6e:	e8 59 01 00 00       	call   801fcc <nsipc_connect>
+  801e73:	83 c4 10             	add    $0x10,%esp
+}
+  801e76:	c9                   	leave
+  801e77:	c3                   	ret
+
+00801e78 <listen>:
+{
+  801e78:	55                   	push   %ebp
+  801e79:	89 e5                	mov    %esp,%ebp
+  801e7b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e7e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e81:	e8 b0 fe ff ff       	call   801d36 <fd2sockid>
+  801e86:	85 c0                	test   %eax,%eax
+  801e88:	78 0f                	js     801e99 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801e8a:	83 ec 08             	sub    $0x8,%esp
+  801e8d:	ff 75 0c             	push   0xc(%ebp)
+  801e90:	50                   	push   %eax
+  801e91:	e8 6b 01 00 00       	call   802001 <nsipc_listen>
+  801e96:	83 c4 10             	add    $0x10,%esp
+}
+  801e99:	c9                   	leave
+  801e9a:	c3                   	ret
+
+00801e9b <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801e9b:	55                   	push   %ebp
+  801e9c:	89 e5                	mov    %esp,%ebp
+  801e9e:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801ea1:	ff 75 10             	push   0x10(%ebp)
+  801ea4:	ff 75 0c             	push   0xc(%ebp)
+  801ea7:	ff 75 08             	push   0x8(%ebp)
+  801eaa:	e8 41 02 00 00       	call   8020f0 <nsipc_socket>
+  801eaf:	83 c4 10             	add    $0x10,%esp
+  801eb2:	85 c0                	test   %eax,%eax
+  801eb4:	78 05                	js     801ebb <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801eb6:	e8 ab fe ff ff       	call   801d66 <alloc_sockfd>
+}
+  801ebb:	c9                   	leave
+  801ebc:	c3                   	ret
+
+00801ebd <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801ebd:	55                   	push   %ebp
+  801ebe:	89 e5                	mov    %esp,%ebp
+  801ec0:	53                   	push   %ebx
+  801ec1:	83 ec 04             	sub    $0x4,%esp
+  801ec4:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801ec6:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  801ecd:	74 26                	je     801ef5 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801ecf:	6a 07                	push   $0x7
+  801ed1:	68 00 70 80 00       	push   $0x807000
+  801ed6:	53                   	push   %ebx
+  801ed7:	ff 35 04 50 80 00    	push   0x805004
+  801edd:	e8 6a 07 00 00       	call   80264c <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801ee2:	83 c4 0c             	add    $0xc,%esp
+  801ee5:	6a 00                	push   $0x0
+  801ee7:	6a 00                	push   $0x0
+  801ee9:	6a 00                	push   $0x0
+  801eeb:	e8 e8 06 00 00       	call   8025d8 <ipc_recv>
+}
+  801ef0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ef3:	c9                   	leave
+  801ef4:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801ef5:	83 ec 0c             	sub    $0xc,%esp
+  801ef8:	6a 02                	push   $0x2
+  801efa:	e8 a1 07 00 00       	call   8026a0 <ipc_find_env>
+  801eff:	a3 04 50 80 00       	mov    %eax,0x805004
+  801f04:	83 c4 10             	add    $0x10,%esp
+  801f07:	eb c6                	jmp    801ecf <nsipc+0x12>
+
+00801f09 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801f09:	55                   	push   %ebp
+  801f0a:	89 e5                	mov    %esp,%ebp
+  801f0c:	56                   	push   %esi
+  801f0d:	53                   	push   %ebx
+  801f0e:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801f11:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f14:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801f19:	8b 06                	mov    (%esi),%eax
+  801f1b:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801f20:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f25:	e8 93 ff ff ff       	call   801ebd <nsipc>
+  801f2a:	89 c3                	mov    %eax,%ebx
+  801f2c:	85 c0                	test   %eax,%eax
+  801f2e:	79 09                	jns    801f39 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801f30:	89 d8                	mov    %ebx,%eax
+  801f32:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f35:	5b                   	pop    %ebx
+  801f36:	5e                   	pop    %esi
+  801f37:	5d                   	pop    %ebp
+  801f38:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801f39:	83 ec 04             	sub    $0x4,%esp
+  801f3c:	ff 35 10 70 80 00    	push   0x807010
+  801f42:	68 00 70 80 00       	push   $0x807000
+  801f47:	ff 75 0c             	push   0xc(%ebp)
+  801f4a:	e8 62 ea ff ff       	call   8009b1 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801f4f:	a1 10 70 80 00       	mov    0x807010,%eax
+  801f54:	89 06                	mov    %eax,(%esi)
+  801f56:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801f59:	eb d5                	jmp    801f30 <nsipc_accept+0x27>
+
+00801f5b <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801f5b:	55                   	push   %ebp
+  801f5c:	89 e5                	mov    %esp,%ebp
+  801f5e:	53                   	push   %ebx
+  801f5f:	83 ec 08             	sub    $0x8,%esp
+  801f62:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801f65:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f68:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801f6d:	53                   	push   %ebx
+  801f6e:	ff 75 0c             	push   0xc(%ebp)
+  801f71:	68 04 70 80 00       	push   $0x807004
+  801f76:	e8 36 ea ff ff       	call   8009b1 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801f7b:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  801f81:	b8 02 00 00 00       	mov    $0x2,%eax
+  801f86:	e8 32 ff ff ff       	call   801ebd <nsipc>
+}
+  801f8b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f8e:	c9                   	leave
+  801f8f:	c3                   	ret
+
+00801f90 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801f90:	55                   	push   %ebp
+  801f91:	89 e5                	mov    %esp,%ebp
+  801f93:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801f96:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f99:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  801f9e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fa1:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  801fa6:	b8 03 00 00 00       	mov    $0x3,%eax
+  801fab:	e8 0d ff ff ff       	call   801ebd <nsipc>
+}
+  801fb0:	c9                   	leave
+  801fb1:	c3                   	ret
+
+00801fb2 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801fb2:	55                   	push   %ebp
+  801fb3:	89 e5                	mov    %esp,%ebp
+  801fb5:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801fb8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fbb:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  801fc0:	b8 04 00 00 00       	mov    $0x4,%eax
+  801fc5:	e8 f3 fe ff ff       	call   801ebd <nsipc>
+}
+  801fca:	c9                   	leave
+  801fcb:	c3                   	ret
+
+00801fcc <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801fcc:	55                   	push   %ebp
+  801fcd:	89 e5                	mov    %esp,%ebp
+  801fcf:	53                   	push   %ebx
+  801fd0:	83 ec 08             	sub    $0x8,%esp
+  801fd3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801fd6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fd9:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801fde:	53                   	push   %ebx
+  801fdf:	ff 75 0c             	push   0xc(%ebp)
+  801fe2:	68 04 70 80 00       	push   $0x807004
+  801fe7:	e8 c5 e9 ff ff       	call   8009b1 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801fec:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  801ff2:	b8 05 00 00 00       	mov    $0x5,%eax
+  801ff7:	e8 c1 fe ff ff       	call   801ebd <nsipc>
+}
+  801ffc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fff:	c9                   	leave
+  802000:	c3                   	ret
+
+00802001 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802001:	55                   	push   %ebp
+  802002:	89 e5                	mov    %esp,%ebp
+  802004:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802007:	8b 45 08             	mov    0x8(%ebp),%eax
+  80200a:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  80200f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802012:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  802017:	b8 06 00 00 00       	mov    $0x6,%eax
+  80201c:	e8 9c fe ff ff       	call   801ebd <nsipc>
+}
+  802021:	c9                   	leave
+  802022:	c3                   	ret
+
+00802023 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802023:	55                   	push   %ebp
+  802024:	89 e5                	mov    %esp,%ebp
+  802026:	56                   	push   %esi
+  802027:	53                   	push   %ebx
+  802028:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80202b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80202e:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  802033:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  802039:	8b 45 14             	mov    0x14(%ebp),%eax
+  80203c:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802041:	b8 07 00 00 00       	mov    $0x7,%eax
+  802046:	e8 72 fe ff ff       	call   801ebd <nsipc>
+  80204b:	89 c3                	mov    %eax,%ebx
+  80204d:	85 c0                	test   %eax,%eax
+  80204f:	78 22                	js     802073 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802051:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802056:	39 c6                	cmp    %eax,%esi
+  802058:	0f 4e c6             	cmovle %esi,%eax
+  80205b:	39 c3                	cmp    %eax,%ebx
+  80205d:	7f 1d                	jg     80207c <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  80205f:	83 ec 04             	sub    $0x4,%esp
+  802062:	53                   	push   %ebx
+  802063:	68 00 70 80 00       	push   $0x807000
+  802068:	ff 75 0c             	push   0xc(%ebp)
+  80206b:	e8 41 e9 ff ff       	call   8009b1 <memmove>
+  802070:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802073:	89 d8                	mov    %ebx,%eax
+  802075:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802078:	5b                   	pop    %ebx
+  802079:	5e                   	pop    %esi
+  80207a:	5d                   	pop    %ebp
+  80207b:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  80207c:	68 82 31 80 00       	push   $0x803182
+  802081:	68 87 30 80 00       	push   $0x803087
+  802086:	6a 62                	push   $0x62
+  802088:	68 97 31 80 00       	push   $0x803197
+  80208d:	e8 05 e1 ff ff       	call   800197 <_panic>
+
+00802092 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802092:	55                   	push   %ebp
+  802093:	89 e5                	mov    %esp,%ebp
+  802095:	53                   	push   %ebx
+  802096:	83 ec 04             	sub    $0x4,%esp
+  802099:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  80209c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80209f:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  8020a4:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8020aa:	7f 2e                	jg     8020da <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8020ac:	83 ec 04             	sub    $0x4,%esp
+  8020af:	53                   	push   %ebx
+  8020b0:	ff 75 0c             	push   0xc(%ebp)
+  8020b3:	68 0c 70 80 00       	push   $0x80700c
+  8020b8:	e8 f4 e8 ff ff       	call   8009b1 <memmove>
+	nsipcbuf.send.req_size = size;
+  8020bd:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  8020c3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020c6:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  8020cb:	b8 08 00 00 00       	mov    $0x8,%eax
+  8020d0:	e8 e8 fd ff ff       	call   801ebd <nsipc>
+}
+  8020d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020d8:	c9                   	leave
+  8020d9:	c3                   	ret
+	assert(size < 1600);
+  8020da:	68 a3 31 80 00       	push   $0x8031a3
+  8020df:	68 87 30 80 00       	push   $0x803087
+  8020e4:	6a 6d                	push   $0x6d
+  8020e6:	68 97 31 80 00       	push   $0x803197
+  8020eb:	e8 a7 e0 ff ff       	call   800197 <_panic>
+
+008020f0 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8020f0:	55                   	push   %ebp
+  8020f1:	89 e5                	mov    %esp,%ebp
+  8020f3:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8020f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020f9:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  8020fe:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802101:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  802106:	8b 45 10             	mov    0x10(%ebp),%eax
+  802109:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  80210e:	b8 09 00 00 00       	mov    $0x9,%eax
+  802113:	e8 a5 fd ff ff       	call   801ebd <nsipc>
+}
+  802118:	c9                   	leave
+  802119:	c3                   	ret
+
+0080211a <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80211a:	55                   	push   %ebp
+  80211b:	89 e5                	mov    %esp,%ebp
+  80211d:	56                   	push   %esi
+  80211e:	53                   	push   %ebx
+  80211f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802122:	83 ec 0c             	sub    $0xc,%esp
+  802125:	ff 75 08             	push   0x8(%ebp)
+  802128:	e8 cd ed ff ff       	call   800efa <fd2data>
+  80212d:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80212f:	83 c4 08             	add    $0x8,%esp
+  802132:	68 af 31 80 00       	push   $0x8031af
+  802137:	53                   	push   %ebx
+  802138:	e8 ee e6 ff ff       	call   80082b <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  80213d:	8b 46 04             	mov    0x4(%esi),%eax
+  802140:	2b 06                	sub    (%esi),%eax
+  802142:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802148:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80214f:	00 00 00 
+	stat->st_dev = &devpipe;
+  802152:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  802159:	40 80 00 
+	return 0;
+}
+  80215c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802161:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802164:	5b                   	pop    %ebx
+  802165:	5e                   	pop    %esi
+  802166:	5d                   	pop    %ebp
+  802167:	c3                   	ret
+
+00802168 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802168:	55                   	push   %ebp
+  802169:	89 e5                	mov    %esp,%ebp
+  80216b:	53                   	push   %ebx
+  80216c:	83 ec 0c             	sub    $0xc,%esp
+  80216f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802172:	53                   	push   %ebx
+  802173:	6a 00                	push   $0x0
+  802175:	e8 22 eb ff ff       	call   800c9c <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  80217a:	89 1c 24             	mov    %ebx,(%esp)
+  80217d:	e8 78 ed ff ff       	call   800efa <fd2data>
+  802182:	83 c4 08             	add    $0x8,%esp
+  802185:	50                   	push   %eax
+  802186:	6a 00                	push   $0x0
+  802188:	e8 0f eb ff ff       	call   800c9c <sys_page_unmap>
+}
+  80218d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802190:	c9                   	leave
+  802191:	c3                   	ret
+
+00802192 <_pipeisclosed>:
+{
+  802192:	55                   	push   %ebp
+  802193:	89 e5                	mov    %esp,%ebp
+  802195:	57                   	push   %edi
+  802196:	56                   	push   %esi
+  802197:	53                   	push   %ebx
+  802198:	83 ec 1c             	sub    $0x1c,%esp
+  80219b:	89 c7                	mov    %eax,%edi
+  80219d:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  80219f:	a1 08 50 80 00       	mov    0x805008,%eax
+  8021a4:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8021a7:	83 ec 0c             	sub    $0xc,%esp
+  8021aa:	57                   	push   %edi
+  8021ab:	e8 2f 05 00 00       	call   8026df <pageref>
+  8021b0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8021b3:	89 34 24             	mov    %esi,(%esp)
+  8021b6:	e8 24 05 00 00       	call   8026df <pageref>
+		nn = thisenv->env_runs;
+  8021bb:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  8021c1:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  8021c4:	83 c4 10             	add    $0x10,%esp
+  8021c7:	39 cb                	cmp    %ecx,%ebx
+  8021c9:	74 1b                	je     8021e6 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  8021cb:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8021ce:	75 cf                	jne    80219f <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8021d0:	8b 42 58             	mov    0x58(%edx),%eax
+  8021d3:	6a 01                	push   $0x1
+  8021d5:	50                   	push   %eax
+  8021d6:	53                   	push   %ebx
+  8021d7:	68 b6 31 80 00       	push   $0x8031b6
+  8021dc:	e8 91 e0 ff ff       	call   800272 <cprintf>
+  8021e1:	83 c4 10             	add    $0x10,%esp
+  8021e4:	eb b9                	jmp    80219f <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  8021e6:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8021e9:	0f 94 c0             	sete   %al
+  8021ec:	0f b6 c0             	movzbl %al,%eax
+}
+  8021ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021f2:	5b                   	pop    %ebx
+  8021f3:	5e                   	pop    %esi
+  8021f4:	5f                   	pop    %edi
+  8021f5:	5d                   	pop    %ebp
+  8021f6:	c3                   	ret
+
+008021f7 <devpipe_write>:
+{
+  8021f7:	55                   	push   %ebp
+  8021f8:	89 e5                	mov    %esp,%ebp
+  8021fa:	57                   	push   %edi
+  8021fb:	56                   	push   %esi
+  8021fc:	53                   	push   %ebx
+  8021fd:	83 ec 28             	sub    $0x28,%esp
+  802200:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802203:	56                   	push   %esi
+  802204:	e8 f1 ec ff ff       	call   800efa <fd2data>
+  802209:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80220b:	83 c4 10             	add    $0x10,%esp
+  80220e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802213:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802216:	75 09                	jne    802221 <devpipe_write+0x2a>
+	return i;
+  802218:	89 f8                	mov    %edi,%eax
+  80221a:	eb 23                	jmp    80223f <devpipe_write+0x48>
+			sys_yield();
+  80221c:	e8 d7 e9 ff ff       	call   800bf8 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802221:	8b 43 04             	mov    0x4(%ebx),%eax
+  802224:	8b 0b                	mov    (%ebx),%ecx
+  802226:	8d 51 20             	lea    0x20(%ecx),%edx
+  802229:	39 d0                	cmp    %edx,%eax
+  80222b:	72 1a                	jb     802247 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  80222d:	89 da                	mov    %ebx,%edx
+  80222f:	89 f0                	mov    %esi,%eax
+  802231:	e8 5c ff ff ff       	call   802192 <_pipeisclosed>
+  802236:	85 c0                	test   %eax,%eax
+  802238:	74 e2                	je     80221c <devpipe_write+0x25>
+				return 0;
+  80223a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80223f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802242:	5b                   	pop    %ebx
+  802243:	5e                   	pop    %esi
+  802244:	5f                   	pop    %edi
+  802245:	5d                   	pop    %ebp
+  802246:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802247:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80224a:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  80224e:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802251:	89 c2                	mov    %eax,%edx
+  802253:	c1 fa 1f             	sar    $0x1f,%edx
+  802256:	89 d1                	mov    %edx,%ecx
+  802258:	c1 e9 1b             	shr    $0x1b,%ecx
+  80225b:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80225e:	83 e2 1f             	and    $0x1f,%edx
+  802261:	29 ca                	sub    %ecx,%edx
+  802263:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802267:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  80226b:	83 c0 01             	add    $0x1,%eax
+  80226e:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802271:	83 c7 01             	add    $0x1,%edi
+  802274:	eb 9d                	jmp    802213 <devpipe_write+0x1c>
+
+00802276 <devpipe_read>:
+{
+  802276:	55                   	push   %ebp
+  802277:	89 e5                	mov    %esp,%ebp
+  802279:	57                   	push   %edi
+  80227a:	56                   	push   %esi
+  80227b:	53                   	push   %ebx
+  80227c:	83 ec 18             	sub    $0x18,%esp
+  80227f:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802282:	57                   	push   %edi
+  802283:	e8 72 ec ff ff       	call   800efa <fd2data>
+  802288:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80228a:	83 c4 10             	add    $0x10,%esp
+  80228d:	be 00 00 00 00       	mov    $0x0,%esi
+  802292:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802295:	75 13                	jne    8022aa <devpipe_read+0x34>
+	return i;
+  802297:	89 f0                	mov    %esi,%eax
+  802299:	eb 02                	jmp    80229d <devpipe_read+0x27>
+				return i;
+  80229b:	89 f0                	mov    %esi,%eax
+}
+  80229d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022a0:	5b                   	pop    %ebx
+  8022a1:	5e                   	pop    %esi
+  8022a2:	5f                   	pop    %edi
+  8022a3:	5d                   	pop    %ebp
+  8022a4:	c3                   	ret
+			sys_yield();
+  8022a5:	e8 4e e9 ff ff       	call   800bf8 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  8022aa:	8b 03                	mov    (%ebx),%eax
+  8022ac:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8022af:	75 18                	jne    8022c9 <devpipe_read+0x53>
+			if (i > 0)
+  8022b1:	85 f6                	test   %esi,%esi
+  8022b3:	75 e6                	jne    80229b <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  8022b5:	89 da                	mov    %ebx,%edx
+  8022b7:	89 f8                	mov    %edi,%eax
+  8022b9:	e8 d4 fe ff ff       	call   802192 <_pipeisclosed>
+  8022be:	85 c0                	test   %eax,%eax
+  8022c0:	74 e3                	je     8022a5 <devpipe_read+0x2f>
+				return 0;
+  8022c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022c7:	eb d4                	jmp    80229d <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8022c9:	99                   	cltd
+  8022ca:	c1 ea 1b             	shr    $0x1b,%edx
+  8022cd:	01 d0                	add    %edx,%eax
+  8022cf:	83 e0 1f             	and    $0x1f,%eax
+  8022d2:	29 d0                	sub    %edx,%eax
+  8022d4:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8022d9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8022dc:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8022df:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8022e2:	83 c6 01             	add    $0x1,%esi
+  8022e5:	eb ab                	jmp    802292 <devpipe_read+0x1c>
+
+008022e7 <pipe>:
+{
+  8022e7:	55                   	push   %ebp
+  8022e8:	89 e5                	mov    %esp,%ebp
+  8022ea:	56                   	push   %esi
+  8022eb:	53                   	push   %ebx
+  8022ec:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8022ef:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022f2:	50                   	push   %eax
+  8022f3:	e8 19 ec ff ff       	call   800f11 <fd_alloc>
+  8022f8:	89 c3                	mov    %eax,%ebx
+  8022fa:	83 c4 10             	add    $0x10,%esp
+  8022fd:	85 c0                	test   %eax,%eax
+  8022ff:	0f 88 23 01 00 00    	js     802428 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802305:	83 ec 04             	sub    $0x4,%esp
+  802308:	68 07 04 00 00       	push   $0x407
+  80230d:	ff 75 f4             	push   -0xc(%ebp)
+  802310:	6a 00                	push   $0x0
+  802312:	e8 00 e9 ff ff       	call   800c17 <sys_page_alloc>
+  802317:	89 c3                	mov    %eax,%ebx
+  802319:	83 c4 10             	add    $0x10,%esp
+  80231c:	85 c0                	test   %eax,%eax
+  80231e:	0f 88 04 01 00 00    	js     802428 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802324:	83 ec 0c             	sub    $0xc,%esp
+  802327:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80232a:	50                   	push   %eax
+  80232b:	e8 e1 eb ff ff       	call   800f11 <fd_alloc>
+  802330:	89 c3                	mov    %eax,%ebx
+  802332:	83 c4 10             	add    $0x10,%esp
+  802335:	85 c0                	test   %eax,%eax
+  802337:	0f 88 db 00 00 00    	js     802418 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80233d:	83 ec 04             	sub    $0x4,%esp
+  802340:	68 07 04 00 00       	push   $0x407
+  802345:	ff 75 f0             	push   -0x10(%ebp)
+  802348:	6a 00                	push   $0x0
+  80234a:	e8 c8 e8 ff ff       	call   800c17 <sys_page_alloc>
+  80234f:	89 c3                	mov    %eax,%ebx
+  802351:	83 c4 10             	add    $0x10,%esp
+  802354:	85 c0                	test   %eax,%eax
+  802356:	0f 88 bc 00 00 00    	js     802418 <pipe+0x131>
+	va = fd2data(fd0);
+  80235c:	83 ec 0c             	sub    $0xc,%esp
+  80235f:	ff 75 f4             	push   -0xc(%ebp)
+  802362:	e8 93 eb ff ff       	call   800efa <fd2data>
+  802367:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802369:	83 c4 0c             	add    $0xc,%esp
+  80236c:	68 07 04 00 00       	push   $0x407
+  802371:	50                   	push   %eax
+  802372:	6a 00                	push   $0x0
+  802374:	e8 9e e8 ff ff       	call   800c17 <sys_page_alloc>
+  802379:	89 c3                	mov    %eax,%ebx
+  80237b:	83 c4 10             	add    $0x10,%esp
+  80237e:	85 c0                	test   %eax,%eax
+  802380:	0f 88 82 00 00 00    	js     802408 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802386:	83 ec 0c             	sub    $0xc,%esp
+  802389:	ff 75 f0             	push   -0x10(%ebp)
+  80238c:	e8 69 eb ff ff       	call   800efa <fd2data>
+  802391:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802398:	50                   	push   %eax
+  802399:	6a 00                	push   $0x0
+  80239b:	56                   	push   %esi
+  80239c:	6a 00                	push   $0x0
+  80239e:	e8 b7 e8 ff ff       	call   800c5a <sys_page_map>
+  8023a3:	89 c3                	mov    %eax,%ebx
+  8023a5:	83 c4 20             	add    $0x20,%esp
+  8023a8:	85 c0                	test   %eax,%eax
+  8023aa:	78 4e                	js     8023fa <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8023ac:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  8023b1:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8023b4:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8023b6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8023b9:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8023c0:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8023c3:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8023c5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8023c8:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8023cf:	83 ec 0c             	sub    $0xc,%esp
+  8023d2:	ff 75 f4             	push   -0xc(%ebp)
+  8023d5:	e8 10 eb ff ff       	call   800eea <fd2num>
+  8023da:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8023dd:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8023df:	83 c4 04             	add    $0x4,%esp
+  8023e2:	ff 75 f0             	push   -0x10(%ebp)
+  8023e5:	e8 00 eb ff ff       	call   800eea <fd2num>
+  8023ea:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8023ed:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8023f0:	83 c4 10             	add    $0x10,%esp
+  8023f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8023f8:	eb 2e                	jmp    802428 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8023fa:	83 ec 08             	sub    $0x8,%esp
+  8023fd:	56                   	push   %esi
+  8023fe:	6a 00                	push   $0x0
+  802400:	e8 97 e8 ff ff       	call   800c9c <sys_page_unmap>
+  802405:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802408:	83 ec 08             	sub    $0x8,%esp
+  80240b:	ff 75 f0             	push   -0x10(%ebp)
+  80240e:	6a 00                	push   $0x0
+  802410:	e8 87 e8 ff ff       	call   800c9c <sys_page_unmap>
+  802415:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802418:	83 ec 08             	sub    $0x8,%esp
+  80241b:	ff 75 f4             	push   -0xc(%ebp)
+  80241e:	6a 00                	push   $0x0
+  802420:	e8 77 e8 ff ff       	call   800c9c <sys_page_unmap>
+  802425:	83 c4 10             	add    $0x10,%esp
+}
+  802428:	89 d8                	mov    %ebx,%eax
+  80242a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80242d:	5b                   	pop    %ebx
+  80242e:	5e                   	pop    %esi
+  80242f:	5d                   	pop    %ebp
+  802430:	c3                   	ret
+
+00802431 <pipeisclosed>:
+{
+  802431:	55                   	push   %ebp
+  802432:	89 e5                	mov    %esp,%ebp
+  802434:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802437:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80243a:	50                   	push   %eax
+  80243b:	ff 75 08             	push   0x8(%ebp)
+  80243e:	e8 24 eb ff ff       	call   800f67 <fd_lookup>
+  802443:	83 c4 10             	add    $0x10,%esp
+  802446:	85 c0                	test   %eax,%eax
+  802448:	78 18                	js     802462 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80244a:	83 ec 0c             	sub    $0xc,%esp
+  80244d:	ff 75 f4             	push   -0xc(%ebp)
+  802450:	e8 a5 ea ff ff       	call   800efa <fd2data>
+  802455:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802457:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80245a:	e8 33 fd ff ff       	call   802192 <_pipeisclosed>
+  80245f:	83 c4 10             	add    $0x10,%esp
+}
+  802462:	c9                   	leave
+  802463:	c3                   	ret
+
+00802464 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802464:	b8 00 00 00 00       	mov    $0x0,%eax
+  802469:	c3                   	ret
+
+0080246a <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80246a:	55                   	push   %ebp
+  80246b:	89 e5                	mov    %esp,%ebp
+  80246d:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802470:	68 ce 31 80 00       	push   $0x8031ce
+  802475:	ff 75 0c             	push   0xc(%ebp)
+  802478:	e8 ae e3 ff ff       	call   80082b <strcpy>
+	return 0;
+}
+  80247d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802482:	c9                   	leave
+  802483:	c3                   	ret
+
+00802484 <devcons_write>:
+{
+  802484:	55                   	push   %ebp
+  802485:	89 e5                	mov    %esp,%ebp
+  802487:	57                   	push   %edi
+  802488:	56                   	push   %esi
+  802489:	53                   	push   %ebx
+  80248a:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802490:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802495:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80249b:	eb 2e                	jmp    8024cb <devcons_write+0x47>
+		m = n - tot;
+  80249d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8024a0:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8024a2:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8024a7:	39 c3                	cmp    %eax,%ebx
+  8024a9:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8024ac:	83 ec 04             	sub    $0x4,%esp
+  8024af:	53                   	push   %ebx
+  8024b0:	89 f0                	mov    %esi,%eax
+  8024b2:	03 45 0c             	add    0xc(%ebp),%eax
+  8024b5:	50                   	push   %eax
+  8024b6:	57                   	push   %edi
+  8024b7:	e8 f5 e4 ff ff       	call   8009b1 <memmove>
+		sys_cputs(buf, m);
+  8024bc:	83 c4 08             	add    $0x8,%esp
+  8024bf:	53                   	push   %ebx
+  8024c0:	57                   	push   %edi
+  8024c1:	e8 95 e6 ff ff       	call   800b5b <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8024c6:	01 de                	add    %ebx,%esi
+  8024c8:	83 c4 10             	add    $0x10,%esp
+  8024cb:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8024ce:	72 cd                	jb     80249d <devcons_write+0x19>
+}
+  8024d0:	89 f0                	mov    %esi,%eax
+  8024d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024d5:	5b                   	pop    %ebx
+  8024d6:	5e                   	pop    %esi
+  8024d7:	5f                   	pop    %edi
+  8024d8:	5d                   	pop    %ebp
+  8024d9:	c3                   	ret
+
+008024da <devcons_read>:
+{
+  8024da:	55                   	push   %ebp
+  8024db:	89 e5                	mov    %esp,%ebp
+  8024dd:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8024e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024e5:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8024e9:	75 07                	jne    8024f2 <devcons_read+0x18>
+  8024eb:	eb 1f                	jmp    80250c <devcons_read+0x32>
+		sys_yield();
+  8024ed:	e8 06 e7 ff ff       	call   800bf8 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8024f2:	e8 82 e6 ff ff       	call   800b79 <sys_cgetc>
+  8024f7:	85 c0                	test   %eax,%eax
+  8024f9:	74 f2                	je     8024ed <devcons_read+0x13>
+	if (c < 0)
+  8024fb:	78 0f                	js     80250c <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8024fd:	83 f8 04             	cmp    $0x4,%eax
+  802500:	74 0c                	je     80250e <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802502:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802505:	88 02                	mov    %al,(%edx)
+	return 1;
+  802507:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80250c:	c9                   	leave
+  80250d:	c3                   	ret
+		return 0;
+  80250e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802513:	eb f7                	jmp    80250c <devcons_read+0x32>
+
+00802515 <cputchar>:
+{
+  802515:	55                   	push   %ebp
+  802516:	89 e5                	mov    %esp,%ebp
+  802518:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80251b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80251e:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802521:	6a 01                	push   $0x1
+  802523:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802526:	50                   	push   %eax
+  802527:	e8 2f e6 ff ff       	call   800b5b <sys_cputs>
+}
+  80252c:	83 c4 10             	add    $0x10,%esp
+  80252f:	c9                   	leave
+  802530:	c3                   	ret
+
+00802531 <getchar>:
+{
+  802531:	55                   	push   %ebp
+  802532:	89 e5                	mov    %esp,%ebp
+  802534:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802537:	6a 01                	push   $0x1
+  802539:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80253c:	50                   	push   %eax
+  80253d:	6a 00                	push   $0x0
+  80253f:	e8 89 ec ff ff       	call   8011cd <read>
+	if (r < 0)
+  802544:	83 c4 10             	add    $0x10,%esp
+  802547:	85 c0                	test   %eax,%eax
+  802549:	78 06                	js     802551 <getchar+0x20>
+	if (r < 1)
+  80254b:	74 06                	je     802553 <getchar+0x22>
+	return c;
+  80254d:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802551:	c9                   	leave
+  802552:	c3                   	ret
+		return -E_EOF;
+  802553:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802558:	eb f7                	jmp    802551 <getchar+0x20>
+
+0080255a <iscons>:
+{
+  80255a:	55                   	push   %ebp
+  80255b:	89 e5                	mov    %esp,%ebp
+  80255d:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802560:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802563:	50                   	push   %eax
+  802564:	ff 75 08             	push   0x8(%ebp)
+  802567:	e8 fb e9 ff ff       	call   800f67 <fd_lookup>
+  80256c:	83 c4 10             	add    $0x10,%esp
+  80256f:	85 c0                	test   %eax,%eax
+  802571:	78 11                	js     802584 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802573:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802576:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  80257c:	39 10                	cmp    %edx,(%eax)
+  80257e:	0f 94 c0             	sete   %al
+  802581:	0f b6 c0             	movzbl %al,%eax
+}
+  802584:	c9                   	leave
+  802585:	c3                   	ret
+
+00802586 <opencons>:
+{
+  802586:	55                   	push   %ebp
+  802587:	89 e5                	mov    %esp,%ebp
+  802589:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80258c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80258f:	50                   	push   %eax
+  802590:	e8 7c e9 ff ff       	call   800f11 <fd_alloc>
+  802595:	83 c4 10             	add    $0x10,%esp
+  802598:	85 c0                	test   %eax,%eax
+  80259a:	78 3a                	js     8025d6 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80259c:	83 ec 04             	sub    $0x4,%esp
+  80259f:	68 07 04 00 00       	push   $0x407
+  8025a4:	ff 75 f4             	push   -0xc(%ebp)
+  8025a7:	6a 00                	push   $0x0
+  8025a9:	e8 69 e6 ff ff       	call   800c17 <sys_page_alloc>
+  8025ae:	83 c4 10             	add    $0x10,%esp
+  8025b1:	85 c0                	test   %eax,%eax
+  8025b3:	78 21                	js     8025d6 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8025b5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025b8:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  8025be:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8025c0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025c3:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8025ca:	83 ec 0c             	sub    $0xc,%esp
+  8025cd:	50                   	push   %eax
+  8025ce:	e8 17 e9 ff ff       	call   800eea <fd2num>
+  8025d3:	83 c4 10             	add    $0x10,%esp
+}
+  8025d6:	c9                   	leave
+  8025d7:	c3                   	ret
+
+008025d8 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  8025d8:	55                   	push   %ebp
+  8025d9:	89 e5                	mov    %esp,%ebp
+  8025db:	56                   	push   %esi
+  8025dc:	53                   	push   %ebx
+  8025dd:	8b 75 08             	mov    0x8(%ebp),%esi
+  8025e0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025e3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  8025e6:	85 c0                	test   %eax,%eax
+  8025e8:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8025ed:	0f 44 c2             	cmove  %edx,%eax
+  8025f0:	83 ec 0c             	sub    $0xc,%esp
+  8025f3:	50                   	push   %eax
+  8025f4:	e8 ce e7 ff ff       	call   800dc7 <sys_ipc_recv>
+
+  if (from_env_store)
+  8025f9:	83 c4 10             	add    $0x10,%esp
+  8025fc:	85 f6                	test   %esi,%esi
+  8025fe:	74 17                	je     802617 <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  802600:	ba 00 00 00 00       	mov    $0x0,%edx
+  802605:	85 c0                	test   %eax,%eax
+  802607:	75 0c                	jne    802615 <ipc_recv+0x3d>
+  802609:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  80260f:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  802615:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  802617:	85 db                	test   %ebx,%ebx
+  802619:	74 2b                	je     802646 <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  80261b:	85 c0                	test   %eax,%eax
+  80261d:	74 0d                	je     80262c <ipc_recv+0x54>
+  80261f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  802625:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802628:	5b                   	pop    %ebx
+  802629:	5e                   	pop    %esi
+  80262a:	5d                   	pop    %ebp
+  80262b:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  80262c:	a1 08 50 80 00       	mov    0x805008,%eax
+  802631:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  802637:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  802639:	a1 08 50 80 00       	mov    0x805008,%eax
+  80263e:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  802644:	eb df                	jmp    802625 <ipc_recv+0x4d>
+  802646:	85 c0                	test   %eax,%eax
+  802648:	75 db                	jne    802625 <ipc_recv+0x4d>
+  80264a:	eb ed                	jmp    802639 <ipc_recv+0x61>
+
+0080264c <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  80264c:	55                   	push   %ebp
+  80264d:	89 e5                	mov    %esp,%ebp
+  80264f:	57                   	push   %edi
+  802650:	56                   	push   %esi
+  802651:	53                   	push   %ebx
+  802652:	83 ec 0c             	sub    $0xc,%esp
+  802655:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802658:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80265b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  80265e:	85 db                	test   %ebx,%ebx
+  802660:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802665:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  802668:	ff 75 14             	push   0x14(%ebp)
+  80266b:	53                   	push   %ebx
+  80266c:	56                   	push   %esi
+  80266d:	57                   	push   %edi
+  80266e:	e8 31 e7 ff ff       	call   800da4 <sys_ipc_try_send>
+  802673:	83 c4 10             	add    $0x10,%esp
+  802676:	85 c0                	test   %eax,%eax
+  802678:	74 1e                	je     802698 <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  80267a:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80267d:	75 07                	jne    802686 <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  80267f:	e8 74 e5 ff ff       	call   800bf8 <sys_yield>
+  802684:	eb e2                	jmp    802668 <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  802686:	50                   	push   %eax
+  802687:	68 da 31 80 00       	push   $0x8031da
+  80268c:	6a 3c                	push   $0x3c
+  80268e:	68 e7 31 80 00       	push   $0x8031e7
+  802693:	e8 ff da ff ff       	call   800197 <_panic>
+  }
+
+#endif
+}
+  802698:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80269b:	5b                   	pop    %ebx
+  80269c:	5e                   	pop    %esi
+  80269d:	5f                   	pop    %edi
+  80269e:	5d                   	pop    %ebp
+  80269f:	c3                   	ret
+
+008026a0 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  8026a0:	55                   	push   %ebp
+  8026a1:	89 e5                	mov    %esp,%ebp
+  8026a3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  8026a6:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  8026ab:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8026ae:	c1 e0 04             	shl    $0x4,%eax
+  8026b1:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8026b6:	8b 40 50             	mov    0x50(%eax),%eax
+  8026b9:	39 c8                	cmp    %ecx,%eax
+  8026bb:	74 12                	je     8026cf <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  8026bd:	83 c2 01             	add    $0x1,%edx
+  8026c0:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8026c6:	75 e3                	jne    8026ab <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  8026c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026cd:	eb 0e                	jmp    8026dd <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  8026cf:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8026d2:	c1 e0 04             	shl    $0x4,%eax
+  8026d5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8026da:	8b 40 48             	mov    0x48(%eax),%eax
+  8026dd:	5d                   	pop    %ebp
+  8026de:	c3                   	ret
+
+008026df <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8026df:	55                   	push   %ebp
+  8026e0:	89 e5                	mov    %esp,%ebp
+  8026e2:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8026e5:	89 c2                	mov    %eax,%edx
+  8026e7:	c1 ea 16             	shr    $0x16,%edx
+  8026ea:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8026f1:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8026f6:	f6 c1 01             	test   $0x1,%cl
+  8026f9:	74 1c                	je     802717 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  8026fb:	c1 e8 0c             	shr    $0xc,%eax
+  8026fe:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802705:	a8 01                	test   $0x1,%al
+  802707:	74 0e                	je     802717 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802709:	c1 e8 0c             	shr    $0xc,%eax
+  80270c:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802713:	ef 
+  802714:	0f b7 d2             	movzwl %dx,%edx
+}
+  802717:	89 d0                	mov    %edx,%eax
+  802719:	5d                   	pop    %ebp
+  80271a:	c3                   	ret
+  80271b:	66 90                	xchg   %ax,%ax
+  80271d:	66 90                	xchg   %ax,%ax
+  80271f:	90                   	nop
+
+00802720 <__udivmoddi4>:
+  802720:	55                   	push   %ebp
+  802721:	57                   	push   %edi
+  802722:	56                   	push   %esi
+  802723:	53                   	push   %ebx
+  802724:	83 ec 24             	sub    $0x24,%esp
+  802727:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80272b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80272f:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  802733:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802737:	8b 54 24 44          	mov    0x44(%esp),%edx
+  80273b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80273f:	8b 44 24 40          	mov    0x40(%esp),%eax
+  802743:	89 d3                	mov    %edx,%ebx
+  802745:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802749:	09 c3                	or     %eax,%ebx
+  80274b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80274f:	0f 84 9c 00 00 00    	je     8027f1 <__udivmoddi4+0xd1>
+  802755:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80275c:	00 
+  80275d:	31 c0                	xor    %eax,%eax
+  80275f:	31 d2                	xor    %edx,%edx
+  802761:	89 fb                	mov    %edi,%ebx
+  802763:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80276a:	00 
+  80276b:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802770:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802774:	01 c0                	add    %eax,%eax
+  802776:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80277d:	00 
+  80277e:	89 c6                	mov    %eax,%esi
+  802780:	89 d7                	mov    %edx,%edi
+  802782:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802786:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80278a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80278d:	d3 ea                	shr    %cl,%edx
+  80278f:	f6 c1 20             	test   $0x20,%cl
+  802792:	0f 45 c2             	cmovne %edx,%eax
+  802795:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802799:	83 e0 01             	and    $0x1,%eax
+  80279c:	09 fa                	or     %edi,%edx
+  80279e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8027a2:	89 04 24             	mov    %eax,(%esp)
+  8027a5:	8b 04 24             	mov    (%esp),%eax
+  8027a8:	89 d5                	mov    %edx,%ebp
+  8027aa:	09 f0                	or     %esi,%eax
+  8027ac:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8027b0:	39 f0                	cmp    %esi,%eax
+  8027b2:	19 fd                	sbb    %edi,%ebp
+  8027b4:	72 1d                	jb     8027d3 <__udivmoddi4+0xb3>
+  8027b6:	29 f0                	sub    %esi,%eax
+  8027b8:	19 fa                	sbb    %edi,%edx
+  8027ba:	89 cf                	mov    %ecx,%edi
+  8027bc:	c1 ef 05             	shr    $0x5,%edi
+  8027bf:	83 e7 01             	and    $0x1,%edi
+  8027c2:	89 fe                	mov    %edi,%esi
+  8027c4:	d3 e7                	shl    %cl,%edi
+  8027c6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8027ca:	83 f6 01             	xor    $0x1,%esi
+  8027cd:	d3 e6                	shl    %cl,%esi
+  8027cf:	09 74 24 18          	or     %esi,0x18(%esp)
+  8027d3:	83 e9 01             	sub    $0x1,%ecx
+  8027d6:	73 98                	jae    802770 <__udivmoddi4+0x50>
+  8027d8:	85 db                	test   %ebx,%ebx
+  8027da:	74 05                	je     8027e1 <__udivmoddi4+0xc1>
+  8027dc:	89 03                	mov    %eax,(%ebx)
+  8027de:	89 53 04             	mov    %edx,0x4(%ebx)
+  8027e1:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8027e5:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8027e9:	83 c4 24             	add    $0x24,%esp
+  8027ec:	5b                   	pop    %ebx
+  8027ed:	5e                   	pop    %esi
+  8027ee:	5f                   	pop    %edi
+  8027ef:	5d                   	pop    %ebp
+  8027f0:	c3                   	ret
+  8027f1:	85 ff                	test   %edi,%edi
+  8027f3:	74 0d                	je     802802 <__udivmoddi4+0xe2>
+  8027f5:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  8027fb:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  802802:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802806:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80280a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80280e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802812:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802816:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80281a:	83 c4 24             	add    $0x24,%esp
+  80281d:	5b                   	pop    %ebx
+  80281e:	5e                   	pop    %esi
+  80281f:	5f                   	pop    %edi
+  802820:	5d                   	pop    %ebp
+  802821:	c3                   	ret
+  802822:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802829:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00802830 <__udivdi3>:
+  802830:	57                   	push   %edi
+  802831:	56                   	push   %esi
+  802832:	53                   	push   %ebx
+  802833:	83 ec 20             	sub    $0x20,%esp
+  802836:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80283a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80283e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802842:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802846:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80284a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80284e:	89 d1                	mov    %edx,%ecx
+  802850:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802854:	09 c1                	or     %eax,%ecx
+  802856:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80285a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80285e:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802862:	0f 84 88 00 00 00    	je     8028f0 <__udivdi3+0xc0>
+  802868:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80286f:	00 
+  802870:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802875:	31 c0                	xor    %eax,%eax
+  802877:	31 d2                	xor    %edx,%edx
+  802879:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802880:	00 
+  802881:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802888:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80288c:	01 c0                	add    %eax,%eax
+  80288e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802895:	00 
+  802896:	89 c6                	mov    %eax,%esi
+  802898:	89 d7                	mov    %edx,%edi
+  80289a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80289e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8028a2:	0f ad d0             	shrd   %cl,%edx,%eax
+  8028a5:	d3 ea                	shr    %cl,%edx
+  8028a7:	f6 c1 20             	test   $0x20,%cl
+  8028aa:	0f 45 c2             	cmovne %edx,%eax
+  8028ad:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8028b1:	83 e0 01             	and    $0x1,%eax
+  8028b4:	09 fa                	or     %edi,%edx
+  8028b6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8028ba:	89 04 24             	mov    %eax,(%esp)
+  8028bd:	8b 04 24             	mov    (%esp),%eax
+  8028c0:	89 d3                	mov    %edx,%ebx
+  8028c2:	09 f0                	or     %esi,%eax
+  8028c4:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8028c8:	39 f0                	cmp    %esi,%eax
+  8028ca:	19 fb                	sbb    %edi,%ebx
+  8028cc:	72 1d                	jb     8028eb <__udivdi3+0xbb>
+  8028ce:	29 f0                	sub    %esi,%eax
+  8028d0:	19 fa                	sbb    %edi,%edx
+  8028d2:	89 cf                	mov    %ecx,%edi
+  8028d4:	c1 ef 05             	shr    $0x5,%edi
+  8028d7:	83 e7 01             	and    $0x1,%edi
+  8028da:	89 fe                	mov    %edi,%esi
+  8028dc:	d3 e7                	shl    %cl,%edi
+  8028de:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8028e2:	83 f6 01             	xor    $0x1,%esi
+  8028e5:	d3 e6                	shl    %cl,%esi
+  8028e7:	09 74 24 18          	or     %esi,0x18(%esp)
+  8028eb:	83 e9 01             	sub    $0x1,%ecx
+  8028ee:	73 98                	jae    802888 <__udivdi3+0x58>
+  8028f0:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8028f4:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8028f8:	83 c4 20             	add    $0x20,%esp
+  8028fb:	5b                   	pop    %ebx
+  8028fc:	5e                   	pop    %esi
+  8028fd:	5f                   	pop    %edi
+  8028fe:	c3                   	ret
+  8028ff:	90                   	nop
+
+00802900 <__umoddi3>:
+  802900:	57                   	push   %edi
+  802901:	56                   	push   %esi
+  802902:	53                   	push   %ebx
+  802903:	83 ec 18             	sub    $0x18,%esp
+  802906:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80290a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80290e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802912:	8b 54 24 34          	mov    0x34(%esp),%edx
+  802916:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80291a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80291e:	89 d1                	mov    %edx,%ecx
+  802920:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802924:	09 c1                	or     %eax,%ecx
+  802926:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80292a:	74 5b                	je     802987 <__umoddi3+0x87>
+  80292c:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802931:	31 c0                	xor    %eax,%eax
+  802933:	31 d2                	xor    %edx,%edx
+  802935:	8d 76 00             	lea    0x0(%esi),%esi
+  802938:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80293c:	01 c0                	add    %eax,%eax
+  80293e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802945:	00 
+  802946:	89 c6                	mov    %eax,%esi
+  802948:	89 d7                	mov    %edx,%edi
+  80294a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80294e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802952:	0f ad d0             	shrd   %cl,%edx,%eax
+  802955:	d3 ea                	shr    %cl,%edx
+  802957:	f6 c1 20             	test   $0x20,%cl
+  80295a:	0f 45 c2             	cmovne %edx,%eax
+  80295d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802961:	83 e0 01             	and    $0x1,%eax
+  802964:	09 fa                	or     %edi,%edx
+  802966:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80296a:	89 04 24             	mov    %eax,(%esp)
+  80296d:	8b 04 24             	mov    (%esp),%eax
+  802970:	89 d3                	mov    %edx,%ebx
+  802972:	09 f0                	or     %esi,%eax
+  802974:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802978:	39 f0                	cmp    %esi,%eax
+  80297a:	19 fb                	sbb    %edi,%ebx
+  80297c:	72 04                	jb     802982 <__umoddi3+0x82>
+  80297e:	29 f0                	sub    %esi,%eax
+  802980:	19 fa                	sbb    %edi,%edx
+  802982:	83 e9 01             	sub    $0x1,%ecx
+  802985:	73 b1                	jae    802938 <__umoddi3+0x38>
+  802987:	83 c4 18             	add    $0x18,%esp
+  80298a:	5b                   	pop    %ebx
+  80298b:	5e                   	pop    %esi
+  80298c:	5f                   	pop    %edi
+  80298d:	c3                   	ret
+  80298e:	66 90                	xchg   %ax,%ax
+
+00802990 <__divdi3>:
+  802990:	55                   	push   %ebp
+  802991:	57                   	push   %edi
+  802992:	56                   	push   %esi
+  802993:	53                   	push   %ebx
+  802994:	83 ec 24             	sub    $0x24,%esp
+  802997:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  80299b:	8b 74 24 44          	mov    0x44(%esp),%esi
+  80299f:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8029a3:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8029a7:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  8029ab:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8029af:	85 d2                	test   %edx,%edx
+  8029b1:	0f 88 e0 00 00 00    	js     802a97 <__divdi3+0x107>
+  8029b7:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  8029bb:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  8029bf:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8029c3:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8029c7:	85 f6                	test   %esi,%esi
+  8029c9:	78 16                	js     8029e1 <__divdi3+0x51>
+  8029cb:	89 f1                	mov    %esi,%ecx
+  8029cd:	31 c0                	xor    %eax,%eax
+  8029cf:	31 d2                	xor    %edx,%edx
+  8029d1:	09 d9                	or     %ebx,%ecx
+  8029d3:	0f 85 f3 00 00 00    	jne    802acc <__divdi3+0x13c>
+  8029d9:	83 c4 24             	add    $0x24,%esp
+  8029dc:	5b                   	pop    %ebx
+  8029dd:	5e                   	pop    %esi
+  8029de:	5f                   	pop    %edi
+  8029df:	5d                   	pop    %ebp
+  8029e0:	c3                   	ret
+  8029e1:	bf 01 00 00 00       	mov    $0x1,%edi
+  8029e6:	f7 5c 24 08          	negl   0x8(%esp)
+  8029ea:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  8029ef:	f7 5c 24 0c          	negl   0xc(%esp)
+  8029f3:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8029fa:	00 
+  8029fb:	31 c0                	xor    %eax,%eax
+  8029fd:	31 d2                	xor    %edx,%edx
+  8029ff:	89 fb                	mov    %edi,%ebx
+  802a01:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802a08:	00 
+  802a09:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802a0e:	66 90                	xchg   %ax,%ax
+  802a10:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802a14:	01 c0                	add    %eax,%eax
+  802a16:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802a1d:	00 
+  802a1e:	89 c6                	mov    %eax,%esi
+  802a20:	89 d7                	mov    %edx,%edi
+  802a22:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802a26:	8b 54 24 14          	mov    0x14(%esp),%edx
+  802a2a:	0f ad d0             	shrd   %cl,%edx,%eax
+  802a2d:	d3 ea                	shr    %cl,%edx
+  802a2f:	f6 c1 20             	test   $0x20,%cl
+  802a32:	0f 45 c2             	cmovne %edx,%eax
+  802a35:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802a39:	83 e0 01             	and    $0x1,%eax
+  802a3c:	09 fa                	or     %edi,%edx
+  802a3e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802a42:	89 04 24             	mov    %eax,(%esp)
+  802a45:	8b 04 24             	mov    (%esp),%eax
+  802a48:	89 d5                	mov    %edx,%ebp
+  802a4a:	09 f0                	or     %esi,%eax
+  802a4c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802a50:	39 f0                	cmp    %esi,%eax
+  802a52:	19 fd                	sbb    %edi,%ebp
+  802a54:	72 1d                	jb     802a73 <__divdi3+0xe3>
+  802a56:	29 f0                	sub    %esi,%eax
+  802a58:	19 fa                	sbb    %edi,%edx
+  802a5a:	89 cf                	mov    %ecx,%edi
+  802a5c:	c1 ef 05             	shr    $0x5,%edi
+  802a5f:	83 e7 01             	and    $0x1,%edi
+  802a62:	89 fe                	mov    %edi,%esi
+  802a64:	d3 e7                	shl    %cl,%edi
+  802a66:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802a6a:	83 f6 01             	xor    $0x1,%esi
+  802a6d:	d3 e6                	shl    %cl,%esi
+  802a6f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802a73:	83 e9 01             	sub    $0x1,%ecx
+  802a76:	73 98                	jae    802a10 <__divdi3+0x80>
+  802a78:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802a7c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802a80:	85 db                	test   %ebx,%ebx
+  802a82:	0f 84 51 ff ff ff    	je     8029d9 <__divdi3+0x49>
+  802a88:	f7 d8                	neg    %eax
+  802a8a:	83 d2 00             	adc    $0x0,%edx
+  802a8d:	83 c4 24             	add    $0x24,%esp
+  802a90:	5b                   	pop    %ebx
+  802a91:	f7 da                	neg    %edx
+  802a93:	5e                   	pop    %esi
+  802a94:	5f                   	pop    %edi
+  802a95:	5d                   	pop    %ebp
+  802a96:	c3                   	ret
+  802a97:	f7 d8                	neg    %eax
+  802a99:	83 d2 00             	adc    $0x0,%edx
+  802a9c:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802aa0:	f7 da                	neg    %edx
+  802aa2:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802aa6:	85 f6                	test   %esi,%esi
+  802aa8:	78 1b                	js     802ac5 <__divdi3+0x135>
+  802aaa:	89 f1                	mov    %esi,%ecx
+  802aac:	31 c0                	xor    %eax,%eax
+  802aae:	31 d2                	xor    %edx,%edx
+  802ab0:	bf 01 00 00 00       	mov    $0x1,%edi
+  802ab5:	09 d9                	or     %ebx,%ecx
+  802ab7:	0f 85 36 ff ff ff    	jne    8029f3 <__divdi3+0x63>
+  802abd:	83 c4 24             	add    $0x24,%esp
+  802ac0:	5b                   	pop    %ebx
+  802ac1:	5e                   	pop    %esi
+  802ac2:	5f                   	pop    %edi
+  802ac3:	5d                   	pop    %ebp
+  802ac4:	c3                   	ret
+  802ac5:	31 ff                	xor    %edi,%edi
+  802ac7:	e9 1a ff ff ff       	jmp    8029e6 <__divdi3+0x56>
+  802acc:	31 ff                	xor    %edi,%edi
+  802ace:	e9 20 ff ff ff       	jmp    8029f3 <__divdi3+0x63>
+  802ad3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802ada:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00802ae0 <__moddi3>:
+  802ae0:	55                   	push   %ebp
+  802ae1:	57                   	push   %edi
+  802ae2:	56                   	push   %esi
+  802ae3:	53                   	push   %ebx
+  802ae4:	83 ec 1c             	sub    $0x1c,%esp
+  802ae7:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  802aeb:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  802aef:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  802af3:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  802af7:	89 c8                	mov    %ecx,%eax
+  802af9:	89 f2                	mov    %esi,%edx
+  802afb:	89 f3                	mov    %esi,%ebx
+  802afd:	85 ed                	test   %ebp,%ebp
+  802aff:	0f 88 9d 00 00 00    	js     802ba2 <__moddi3+0xc2>
+  802b05:	09 cb                	or     %ecx,%ebx
+  802b07:	0f 84 8d 00 00 00    	je     802b9a <__moddi3+0xba>
+  802b0d:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802b11:	31 db                	xor    %ebx,%ebx
+  802b13:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802b17:	89 ca                	mov    %ecx,%edx
+  802b19:	89 f0                	mov    %esi,%eax
+  802b1b:	89 dd                	mov    %ebx,%ebp
+  802b1d:	f7 da                	neg    %edx
+  802b1f:	83 d0 00             	adc    $0x0,%eax
+  802b22:	f7 d8                	neg    %eax
+  802b24:	0f 49 f0             	cmovns %eax,%esi
+  802b27:	0f 49 ca             	cmovns %edx,%ecx
+  802b2a:	31 c0                	xor    %eax,%eax
+  802b2c:	31 d2                	xor    %edx,%edx
+  802b2e:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802b32:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802b36:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802b3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  802b3f:	90                   	nop
+  802b40:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802b44:	01 c0                	add    %eax,%eax
+  802b46:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802b4d:	00 
+  802b4e:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  802b52:	89 c6                	mov    %eax,%esi
+  802b54:	89 d7                	mov    %edx,%edi
+  802b56:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802b5a:	8b 54 24 14          	mov    0x14(%esp),%edx
+  802b5e:	0f ad d0             	shrd   %cl,%edx,%eax
+  802b61:	d3 ea                	shr    %cl,%edx
+  802b63:	f6 c1 20             	test   $0x20,%cl
+  802b66:	0f 45 c2             	cmovne %edx,%eax
+  802b69:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802b6d:	83 e0 01             	and    $0x1,%eax
+  802b70:	09 fa                	or     %edi,%edx
+  802b72:	89 04 24             	mov    %eax,(%esp)
+  802b75:	8b 04 24             	mov    (%esp),%eax
+  802b78:	89 d7                	mov    %edx,%edi
+  802b7a:	09 f0                	or     %esi,%eax
+  802b7c:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  802b80:	39 d8                	cmp    %ebx,%eax
+  802b82:	19 f7                	sbb    %esi,%edi
+  802b84:	72 04                	jb     802b8a <__moddi3+0xaa>
+  802b86:	29 d8                	sub    %ebx,%eax
+  802b88:	19 f2                	sbb    %esi,%edx
+  802b8a:	83 e9 01             	sub    $0x1,%ecx
+  802b8d:	73 b1                	jae    802b40 <__moddi3+0x60>
+  802b8f:	85 ed                	test   %ebp,%ebp
+  802b91:	74 07                	je     802b9a <__moddi3+0xba>
+  802b93:	f7 d8                	neg    %eax
+  802b95:	83 d2 00             	adc    $0x0,%edx
+  802b98:	f7 da                	neg    %edx
+  802b9a:	83 c4 1c             	add    $0x1c,%esp
+  802b9d:	5b                   	pop    %ebx
+  802b9e:	5e                   	pop    %esi
+  802b9f:	5f                   	pop    %edi
+  802ba0:	5d                   	pop    %ebp
+  802ba1:	c3                   	ret
+  802ba2:	09 cb                	or     %ecx,%ebx
+  802ba4:	74 f4                	je     802b9a <__moddi3+0xba>
+  802ba6:	f7 df                	neg    %edi
+  802ba8:	bb 01 00 00 00       	mov    $0x1,%ebx
+  802bad:	83 d5 00             	adc    $0x0,%ebp
+  802bb0:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802bb4:	f7 dd                	neg    %ebp
+  802bb6:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802bba:	e9 58 ff ff ff       	jmp    802b17 <__moddi3+0x37>
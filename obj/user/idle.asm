@@ -0,0 +1,5264 @@
+
+obj/user/idle.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 19 00 00 00       	call   80004a <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/x86.h>
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 08             	sub    $0x8,%esp
+	binaryname = "idle";
+  800039:	c7 05 00 30 80 00 00 	movl   $0x802500,0x803000
+  800040:	25 80 00 
+	// Instead of busy-waiting like this,
+	// a better way would be to use the processor's HLT instruction
+	// to cause the processor to stop executing until the next interrupt -
+	// doing so allows the processor to conserve power more effectively.
+	while (1) {
+		sys_yield();
+  800043:	e8 02 01 00 00       	call   80014a <sys_yield>
+	while (1) {
+  800048:	eb f9                	jmp    800043 <umain+0x10>
+
+0080004a <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  80004a:	55                   	push   %ebp
+  80004b:	89 e5                	mov    %esp,%ebp
+  80004d:	56                   	push   %esi
+  80004e:	53                   	push   %ebx
+  80004f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800052:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  800055:	e8 d1 00 00 00       	call   80012b <sys_getenvid>
+  80005a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80005f:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800062:	c1 e0 04             	shl    $0x4,%eax
+  800065:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80006a:	a3 08 40 80 00       	mov    %eax,0x804008
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  80006f:	85 db                	test   %ebx,%ebx
+  800071:	7e 07                	jle    80007a <libmain+0x30>
+    binaryname = argv[0];
+  800073:	8b 06                	mov    (%esi),%eax
+  800075:	a3 00 30 80 00       	mov    %eax,0x803000
+
+  // call user main routine
+  umain(argc, argv);
+  80007a:	83 ec 08             	sub    $0x8,%esp
+  80007d:	56                   	push   %esi
+  80007e:	53                   	push   %ebx
+  80007f:	e8 af ff ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  800084:	e8 0a 00 00 00       	call   800093 <exit>
+}
+  800089:	83 c4 10             	add    $0x10,%esp
+  80008c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80008f:	5b                   	pop    %ebx
+  800090:	5e                   	pop    %esi
+  800091:	5d                   	pop    %ebp
+  800092:	c3                   	ret
+
+00800093 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800093:	55                   	push   %ebp
+  800094:	89 e5                	mov    %esp,%ebp
+  800096:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800099:	e8 72 05 00 00       	call   800610 <close_all>
+	sys_env_destroy(0);
+  80009e:	83 ec 0c             	sub    $0xc,%esp
+  8000a1:	6a 00                	push   $0x0
+  8000a3:	e8 42 00 00 00       	call   8000ea <sys_env_destroy>
+}
+  8000a8:	83 c4 10             	add    $0x10,%esp
+  8000ab:	c9                   	leave
+  8000ac:	c3                   	ret
+
+008000ad <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8000ad:	55                   	push   %ebp
+  8000ae:	89 e5                	mov    %esp,%ebp
+  8000b0:	57                   	push   %edi
+  8000b1:	56                   	push   %esi
+  8000b2:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8000b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000bb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000be:	89 c3                	mov    %eax,%ebx
+  8000c0:	89 c7                	mov    %eax,%edi
+  8000c2:	89 c6                	mov    %eax,%esi
+  8000c4:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  8000c6:	5b                   	pop    %ebx
+  8000c7:	5e                   	pop    %esi
+  8000c8:	5f                   	pop    %edi
+  8000c9:	5d                   	pop    %ebp
+  8000ca:	c3                   	ret
+
+008000cb <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8000cb:	55                   	push   %ebp
+  8000cc:	89 e5                	mov    %esp,%ebp
+  8000ce:	57                   	push   %edi
+  8000cf:	56                   	push   %esi
+  8000d0:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8000d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000d6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000db:	89 d1                	mov    %edx,%ecx
+  8000dd:	89 d3                	mov    %edx,%ebx
+  8000df:	89 d7                	mov    %edx,%edi
+  8000e1:	89 d6                	mov    %edx,%esi
+  8000e3:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8000e5:	5b                   	pop    %ebx
+  8000e6:	5e                   	pop    %esi
+  8000e7:	5f                   	pop    %edi
+  8000e8:	5d                   	pop    %ebp
+  8000e9:	c3                   	ret
+
+008000ea <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8000ea:	55                   	push   %ebp
+  8000eb:	89 e5                	mov    %esp,%ebp
+  8000ed:	57                   	push   %edi
+  8000ee:	56                   	push   %esi
+  8000ef:	53                   	push   %ebx
+  8000f0:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8000f3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000f8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000fb:	b8 03 00 00 00       	mov    $0x3,%eax
+  800100:	89 cb                	mov    %ecx,%ebx
+  800102:	89 cf                	mov    %ecx,%edi
+  800104:	89 ce                	mov    %ecx,%esi
+  800106:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800108:	85 c0                	test   %eax,%eax
+  80010a:	7f 08                	jg     800114 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  80010c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80010f:	5b                   	pop    %ebx
+  800110:	5e                   	pop    %esi
+  800111:	5f                   	pop    %edi
+  800112:	5d                   	pop    %ebp
+  800113:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800114:	83 ec 0c             	sub    $0xc,%esp
+  800117:	50                   	push   %eax
+  800118:	6a 03                	push   $0x3
+  80011a:	68 0f 25 80 00       	push   $0x80250f
+  80011f:	6a 3e                	push   $0x3e
+  800121:	68 2c 25 80 00       	push   $0x80252c
+  800126:	e8 22 14 00 00       	call   80154d <_panic>
+
+0080012b <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80012b:	55                   	push   %ebp
+  80012c:	89 e5                	mov    %esp,%ebp
+  80012e:	57                   	push   %edi
+  80012f:	56                   	push   %esi
+  800130:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800131:	ba 00 00 00 00       	mov    $0x0,%edx
+  800136:	b8 02 00 00 00       	mov    $0x2,%eax
+  80013b:	89 d1                	mov    %edx,%ecx
+  80013d:	89 d3                	mov    %edx,%ebx
+  80013f:	89 d7                	mov    %edx,%edi
+  800141:	89 d6                	mov    %edx,%esi
+  800143:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800145:	5b                   	pop    %ebx
+  800146:	5e                   	pop    %esi
+  800147:	5f                   	pop    %edi
+  800148:	5d                   	pop    %ebp
+  800149:	c3                   	ret
+
+0080014a <sys_yield>:
+
+void
+sys_yield(void) {
+  80014a:	55                   	push   %ebp
+  80014b:	89 e5                	mov    %esp,%ebp
+  80014d:	57                   	push   %edi
+  80014e:	56                   	push   %esi
+  80014f:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800150:	ba 00 00 00 00       	mov    $0x0,%edx
+  800155:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80015a:	89 d1                	mov    %edx,%ecx
+  80015c:	89 d3                	mov    %edx,%ebx
+  80015e:	89 d7                	mov    %edx,%edi
+  800160:	89 d6                	mov    %edx,%esi
+  800162:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800164:	5b                   	pop    %ebx
+  800165:	5e                   	pop    %esi
+  800166:	5f                   	pop    %edi
+  800167:	5d                   	pop    %ebp
+  800168:	c3                   	ret
+
+00800169 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  800169:	55                   	push   %ebp
+  80016a:	89 e5                	mov    %esp,%ebp
+  80016c:	57                   	push   %edi
+  80016d:	56                   	push   %esi
+  80016e:	53                   	push   %ebx
+  80016f:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800172:	be 00 00 00 00       	mov    $0x0,%esi
+  800177:	8b 55 08             	mov    0x8(%ebp),%edx
+  80017a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80017d:	b8 04 00 00 00       	mov    $0x4,%eax
+  800182:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800185:	89 f7                	mov    %esi,%edi
+  800187:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800189:	85 c0                	test   %eax,%eax
+  80018b:	7f 08                	jg     800195 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  80018d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800190:	5b                   	pop    %ebx
+  800191:	5e                   	pop    %esi
+  800192:	5f                   	pop    %edi
+  800193:	5d                   	pop    %ebp
+  800194:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800195:	83 ec 0c             	sub    $0xc,%esp
+  800198:	50                   	push   %eax
+  800199:	6a 04                	push   $0x4
+  80019b:	68 0f 25 80 00       	push   $0x80250f
+  8001a0:	6a 3e                	push   $0x3e
+  8001a2:	68 2c 25 80 00       	push   $0x80252c
+  8001a7:	e8 a1 13 00 00       	call   80154d <_panic>
+
+008001ac <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  8001ac:	55                   	push   %ebp
+  8001ad:	89 e5                	mov    %esp,%ebp
+  8001af:	57                   	push   %edi
+  8001b0:	56                   	push   %esi
+  8001b1:	53                   	push   %ebx
+  8001b2:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8001b5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001b8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001bb:	b8 05 00 00 00       	mov    $0x5,%eax
+  8001c0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001c3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8001c6:	8b 75 18             	mov    0x18(%ebp),%esi
+  8001c9:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8001cb:	85 c0                	test   %eax,%eax
+  8001cd:	7f 08                	jg     8001d7 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  8001cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001d2:	5b                   	pop    %ebx
+  8001d3:	5e                   	pop    %esi
+  8001d4:	5f                   	pop    %edi
+  8001d5:	5d                   	pop    %ebp
+  8001d6:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8001d7:	83 ec 0c             	sub    $0xc,%esp
+  8001da:	50                   	push   %eax
+  8001db:	6a 05                	push   $0x5
+  8001dd:	68 0f 25 80 00       	push   $0x80250f
+  8001e2:	6a 3e                	push   $0x3e
+  8001e4:	68 2c 25 80 00       	push   $0x80252c
+  8001e9:	e8 5f 13 00 00       	call   80154d <_panic>
+
+008001ee <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  8001ee:	55                   	push   %ebp
+  8001ef:	89 e5                	mov    %esp,%ebp
+  8001f1:	57                   	push   %edi
+  8001f2:	56                   	push   %esi
+  8001f3:	53                   	push   %ebx
+  8001f4:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8001f7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001fc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001ff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800202:	b8 06 00 00 00       	mov    $0x6,%eax
+  800207:	89 df                	mov    %ebx,%edi
+  800209:	89 de                	mov    %ebx,%esi
+  80020b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80020d:	85 c0                	test   %eax,%eax
+  80020f:	7f 08                	jg     800219 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800211:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800214:	5b                   	pop    %ebx
+  800215:	5e                   	pop    %esi
+  800216:	5f                   	pop    %edi
+  800217:	5d                   	pop    %ebp
+  800218:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800219:	83 ec 0c             	sub    $0xc,%esp
+  80021c:	50                   	push   %eax
+  80021d:	6a 06                	push   $0x6
+  80021f:	68 0f 25 80 00       	push   $0x80250f
+  800224:	6a 3e                	push   $0x3e
+  800226:	68 2c 25 80 00       	push   $0x80252c
+  80022b:	e8 1d 13 00 00       	call   80154d <_panic>
+
+00800230 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800230:	55                   	push   %ebp
+  800231:	89 e5                	mov    %esp,%ebp
+  800233:	57                   	push   %edi
+  800234:	56                   	push   %esi
+  800235:	53                   	push   %ebx
+  800236:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800239:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80023e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800241:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800244:	b8 08 00 00 00       	mov    $0x8,%eax
+  800249:	89 df                	mov    %ebx,%edi
+  80024b:	89 de                	mov    %ebx,%esi
+  80024d:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80024f:	85 c0                	test   %eax,%eax
+  800251:	7f 08                	jg     80025b <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800253:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800256:	5b                   	pop    %ebx
+  800257:	5e                   	pop    %esi
+  800258:	5f                   	pop    %edi
+  800259:	5d                   	pop    %ebp
+  80025a:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80025b:	83 ec 0c             	sub    $0xc,%esp
+  80025e:	50                   	push   %eax
+  80025f:	6a 08                	push   $0x8
+  800261:	68 0f 25 80 00       	push   $0x80250f
+  800266:	6a 3e                	push   $0x3e
+  800268:	68 2c 25 80 00       	push   $0x80252c
+  80026d:	e8 db 12 00 00       	call   80154d <_panic>
+
+00800272 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800272:	55                   	push   %ebp
+  800273:	89 e5                	mov    %esp,%ebp
+  800275:	57                   	push   %edi
+  800276:	56                   	push   %esi
+  800277:	53                   	push   %ebx
+  800278:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  80027b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800280:	8b 55 08             	mov    0x8(%ebp),%edx
+  800283:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800286:	b8 09 00 00 00       	mov    $0x9,%eax
+  80028b:	89 df                	mov    %ebx,%edi
+  80028d:	89 de                	mov    %ebx,%esi
+  80028f:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800291:	85 c0                	test   %eax,%eax
+  800293:	7f 08                	jg     80029d <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800295:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800298:	5b                   	pop    %ebx
+  800299:	5e                   	pop    %esi
+  80029a:	5f                   	pop    %edi
+  80029b:	5d                   	pop    %ebp
+  80029c:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80029d:	83 ec 0c             	sub    $0xc,%esp
+  8002a0:	50                   	push   %eax
+  8002a1:	6a 09                	push   $0x9
+  8002a3:	68 0f 25 80 00       	push   $0x80250f
+  8002a8:	6a 3e                	push   $0x3e
+  8002aa:	68 2c 25 80 00       	push   $0x80252c
+  8002af:	e8 99 12 00 00       	call   80154d <_panic>
+
+008002b4 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8002b4:	55                   	push   %ebp
+  8002b5:	89 e5                	mov    %esp,%ebp
+  8002b7:	57                   	push   %edi
+  8002b8:	56                   	push   %esi
+  8002b9:	53                   	push   %ebx
+  8002ba:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8002bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002c5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002c8:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8002cd:	89 df                	mov    %ebx,%edi
+  8002cf:	89 de                	mov    %ebx,%esi
+  8002d1:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8002d3:	85 c0                	test   %eax,%eax
+  8002d5:	7f 08                	jg     8002df <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8002d7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002da:	5b                   	pop    %ebx
+  8002db:	5e                   	pop    %esi
+  8002dc:	5f                   	pop    %edi
+  8002dd:	5d                   	pop    %ebp
+  8002de:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8002df:	83 ec 0c             	sub    $0xc,%esp
+  8002e2:	50                   	push   %eax
+  8002e3:	6a 0a                	push   $0xa
+  8002e5:	68 0f 25 80 00       	push   $0x80250f
+  8002ea:	6a 3e                	push   $0x3e
+  8002ec:	68 2c 25 80 00       	push   $0x80252c
+  8002f1:	e8 57 12 00 00       	call   80154d <_panic>
+
+008002f6 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  8002f6:	55                   	push   %ebp
+  8002f7:	89 e5                	mov    %esp,%ebp
+  8002f9:	57                   	push   %edi
+  8002fa:	56                   	push   %esi
+  8002fb:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8002fc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002ff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800302:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800307:	be 00 00 00 00       	mov    $0x0,%esi
+  80030c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80030f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800312:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800314:	5b                   	pop    %ebx
+  800315:	5e                   	pop    %esi
+  800316:	5f                   	pop    %edi
+  800317:	5d                   	pop    %ebp
+  800318:	c3                   	ret
+
+00800319 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  800319:	55                   	push   %ebp
+  80031a:	89 e5                	mov    %esp,%ebp
+  80031c:	57                   	push   %edi
+  80031d:	56                   	push   %esi
+  80031e:	53                   	push   %ebx
+  80031f:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800322:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800327:	8b 55 08             	mov    0x8(%ebp),%edx
+  80032a:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80032f:	89 cb                	mov    %ecx,%ebx
+  800331:	89 cf                	mov    %ecx,%edi
+  800333:	89 ce                	mov    %ecx,%esi
+  800335:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800337:	85 c0                	test   %eax,%eax
+  800339:	7f 08                	jg     800343 <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  80033b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80033e:	5b                   	pop    %ebx
+  80033f:	5e                   	pop    %esi
+  800340:	5f                   	pop    %edi
+  800341:	5d                   	pop    %ebp
+  800342:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800343:	83 ec 0c             	sub    $0xc,%esp
+  800346:	50                   	push   %eax
+  800347:	6a 0d                	push   $0xd
+  800349:	68 0f 25 80 00       	push   $0x80250f
+  80034e:	6a 3e                	push   $0x3e
+  800350:	68 2c 25 80 00       	push   $0x80252c
+  800355:	e8 f3 11 00 00       	call   80154d <_panic>
+
+0080035a <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  80035a:	55                   	push   %ebp
+  80035b:	89 e5                	mov    %esp,%ebp
+  80035d:	57                   	push   %edi
+  80035e:	56                   	push   %esi
+  80035f:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800360:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800365:	8b 55 08             	mov    0x8(%ebp),%edx
+  800368:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80036b:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800370:	89 df                	mov    %ebx,%edi
+  800372:	89 de                	mov    %ebx,%esi
+  800374:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  800376:	5b                   	pop    %ebx
+  800377:	5e                   	pop    %esi
+  800378:	5f                   	pop    %edi
+  800379:	5d                   	pop    %ebp
+  80037a:	c3                   	ret
+
+0080037b <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  80037b:	55                   	push   %ebp
+  80037c:	89 e5                	mov    %esp,%ebp
+  80037e:	57                   	push   %edi
+  80037f:	56                   	push   %esi
+  800380:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800381:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800386:	8b 55 08             	mov    0x8(%ebp),%edx
+  800389:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80038e:	89 cb                	mov    %ecx,%ebx
+  800390:	89 cf                	mov    %ecx,%edi
+  800392:	89 ce                	mov    %ecx,%esi
+  800394:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  800396:	5b                   	pop    %ebx
+  800397:	5e                   	pop    %esi
+  800398:	5f                   	pop    %edi
+  800399:	5d                   	pop    %ebp
+  80039a:	c3                   	ret
+
+0080039b <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  80039b:	55                   	push   %ebp
+  80039c:	89 e5                	mov    %esp,%ebp
+  80039e:	57                   	push   %edi
+  80039f:	56                   	push   %esi
+  8003a0:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8003a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003a6:	b8 10 00 00 00       	mov    $0x10,%eax
+  8003ab:	89 d1                	mov    %edx,%ecx
+  8003ad:	89 d3                	mov    %edx,%ebx
+  8003af:	89 d7                	mov    %edx,%edi
+  8003b1:	89 d6                	mov    %edx,%esi
+  8003b3:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8003b5:	5b                   	pop    %ebx
+  8003b6:	5e                   	pop    %esi
+  8003b7:	5f                   	pop    %edi
+  8003b8:	5d                   	pop    %ebp
+  8003b9:	c3                   	ret
+
+008003ba <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  8003ba:	55                   	push   %ebp
+  8003bb:	89 e5                	mov    %esp,%ebp
+  8003bd:	57                   	push   %edi
+  8003be:	56                   	push   %esi
+  8003bf:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8003c0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003c8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003cb:	b8 11 00 00 00       	mov    $0x11,%eax
+  8003d0:	89 df                	mov    %ebx,%edi
+  8003d2:	89 de                	mov    %ebx,%esi
+  8003d4:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  8003d6:	5b                   	pop    %ebx
+  8003d7:	5e                   	pop    %esi
+  8003d8:	5f                   	pop    %edi
+  8003d9:	5d                   	pop    %ebp
+  8003da:	c3                   	ret
+
+008003db <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  8003db:	55                   	push   %ebp
+  8003dc:	89 e5                	mov    %esp,%ebp
+  8003de:	57                   	push   %edi
+  8003df:	56                   	push   %esi
+  8003e0:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8003e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003ec:	b8 12 00 00 00       	mov    $0x12,%eax
+  8003f1:	89 df                	mov    %ebx,%edi
+  8003f3:	89 de                	mov    %ebx,%esi
+  8003f5:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  8003f7:	5b                   	pop    %ebx
+  8003f8:	5e                   	pop    %esi
+  8003f9:	5f                   	pop    %edi
+  8003fa:	5d                   	pop    %ebp
+  8003fb:	c3                   	ret
+
+008003fc <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  8003fc:	55                   	push   %ebp
+  8003fd:	89 e5                	mov    %esp,%ebp
+  8003ff:	57                   	push   %edi
+  800400:	56                   	push   %esi
+  800401:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800402:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800407:	8b 55 08             	mov    0x8(%ebp),%edx
+  80040a:	b8 13 00 00 00       	mov    $0x13,%eax
+  80040f:	89 cb                	mov    %ecx,%ebx
+  800411:	89 cf                	mov    %ecx,%edi
+  800413:	89 ce                	mov    %ecx,%esi
+  800415:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  800417:	5b                   	pop    %ebx
+  800418:	5e                   	pop    %esi
+  800419:	5f                   	pop    %edi
+  80041a:	5d                   	pop    %ebp
+  80041b:	c3                   	ret
+
+0080041c <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  80041c:	55                   	push   %ebp
+  80041d:	89 e5                	mov    %esp,%ebp
+  80041f:	57                   	push   %edi
+  800420:	56                   	push   %esi
+  800421:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800422:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800427:	8b 55 08             	mov    0x8(%ebp),%edx
+  80042a:	b8 14 00 00 00       	mov    $0x14,%eax
+  80042f:	89 cb                	mov    %ecx,%ebx
+  800431:	89 cf                	mov    %ecx,%edi
+  800433:	89 ce                	mov    %ecx,%esi
+  800435:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  800437:	5b                   	pop    %ebx
+  800438:	5e                   	pop    %esi
+  800439:	5f                   	pop    %edi
+  80043a:	5d                   	pop    %ebp
+  80043b:	c3                   	ret
+
+0080043c <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80043c:	55                   	push   %ebp
+  80043d:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80043f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800442:	05 00 00 00 30       	add    $0x30000000,%eax
+  800447:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80044a:	5d                   	pop    %ebp
+  80044b:	c3                   	ret
+
+0080044c <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80044c:	55                   	push   %ebp
+  80044d:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80044f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800452:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800457:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80045c:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800461:	5d                   	pop    %ebp
+  800462:	c3                   	ret
+
+00800463 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800463:	55                   	push   %ebp
+  800464:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  800466:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80046b:	eb 02                	jmp    80046f <fd_alloc+0xc>
+  80046d:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80046f:	89 c2                	mov    %eax,%edx
+  800471:	c1 ea 16             	shr    $0x16,%edx
+  800474:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80047b:	f6 c2 01             	test   $0x1,%dl
+  80047e:	74 2b                	je     8004ab <fd_alloc+0x48>
+  800480:	89 c2                	mov    %eax,%edx
+  800482:	c1 ea 0c             	shr    $0xc,%edx
+  800485:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80048c:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  800492:	f6 c1 01             	test   $0x1,%cl
+  800495:	74 14                	je     8004ab <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  800497:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80049d:	75 ce                	jne    80046d <fd_alloc+0xa>
+  80049f:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8004a4:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8004a9:	eb 05                	jmp    8004b0 <fd_alloc+0x4d>
+			return 0;
+  8004ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8004b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004b3:	89 02                	mov    %eax,(%edx)
+}
+  8004b5:	89 c8                	mov    %ecx,%eax
+  8004b7:	5d                   	pop    %ebp
+  8004b8:	c3                   	ret
+
+008004b9 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8004b9:	55                   	push   %ebp
+  8004ba:	89 e5                	mov    %esp,%ebp
+  8004bc:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8004bf:	83 f8 1f             	cmp    $0x1f,%eax
+  8004c2:	77 30                	ja     8004f4 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8004c4:	c1 e0 0c             	shl    $0xc,%eax
+  8004c7:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8004cc:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8004d2:	f6 c2 01             	test   $0x1,%dl
+  8004d5:	74 24                	je     8004fb <fd_lookup+0x42>
+  8004d7:	89 c2                	mov    %eax,%edx
+  8004d9:	c1 ea 0c             	shr    $0xc,%edx
+  8004dc:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8004e3:	f6 c2 01             	test   $0x1,%dl
+  8004e6:	74 1a                	je     800502 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8004e8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8004eb:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8004ed:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8004f2:	5d                   	pop    %ebp
+  8004f3:	c3                   	ret
+		return -E_INVAL;
+  8004f4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8004f9:	eb f7                	jmp    8004f2 <fd_lookup+0x39>
+		return -E_INVAL;
+  8004fb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800500:	eb f0                	jmp    8004f2 <fd_lookup+0x39>
+  800502:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800507:	eb e9                	jmp    8004f2 <fd_lookup+0x39>
+
+00800509 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  800509:	55                   	push   %ebp
+  80050a:	89 e5                	mov    %esp,%ebp
+  80050c:	53                   	push   %ebx
+  80050d:	83 ec 04             	sub    $0x4,%esp
+  800510:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  800513:	b8 00 00 00 00       	mov    $0x0,%eax
+  800518:	eb 03                	jmp    80051d <dev_lookup+0x14>
+  80051a:	83 c0 01             	add    $0x1,%eax
+  80051d:	8b 1c 85 b8 25 80 00 	mov    0x8025b8(,%eax,4),%ebx
+  800524:	85 db                	test   %ebx,%ebx
+  800526:	74 0b                	je     800533 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  800528:	39 13                	cmp    %edx,(%ebx)
+  80052a:	75 ee                	jne    80051a <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  80052c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800531:	eb 1f                	jmp    800552 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800533:	a1 08 40 80 00       	mov    0x804008,%eax
+  800538:	8b 40 48             	mov    0x48(%eax),%eax
+  80053b:	83 ec 04             	sub    $0x4,%esp
+  80053e:	52                   	push   %edx
+  80053f:	50                   	push   %eax
+  800540:	68 3c 25 80 00       	push   $0x80253c
+  800545:	e8 de 10 00 00       	call   801628 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80054a:	83 c4 10             	add    $0x10,%esp
+  80054d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  800552:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800555:	89 1a                	mov    %ebx,(%edx)
+}
+  800557:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80055a:	c9                   	leave
+  80055b:	c3                   	ret
+
+0080055c <fd_close>:
+{
+  80055c:	55                   	push   %ebp
+  80055d:	89 e5                	mov    %esp,%ebp
+  80055f:	57                   	push   %edi
+  800560:	56                   	push   %esi
+  800561:	53                   	push   %ebx
+  800562:	83 ec 24             	sub    $0x24,%esp
+  800565:	8b 75 08             	mov    0x8(%ebp),%esi
+  800568:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80056b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80056e:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80056f:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800575:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800578:	50                   	push   %eax
+  800579:	e8 3b ff ff ff       	call   8004b9 <fd_lookup>
+  80057e:	89 c3                	mov    %eax,%ebx
+  800580:	83 c4 10             	add    $0x10,%esp
+  800583:	85 c0                	test   %eax,%eax
+  800585:	78 05                	js     80058c <fd_close+0x30>
+	    || fd != fd2)
+  800587:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80058a:	74 16                	je     8005a2 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80058c:	89 f8                	mov    %edi,%eax
+  80058e:	84 c0                	test   %al,%al
+  800590:	b8 00 00 00 00       	mov    $0x0,%eax
+  800595:	0f 44 d8             	cmove  %eax,%ebx
+}
+  800598:	89 d8                	mov    %ebx,%eax
+  80059a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80059d:	5b                   	pop    %ebx
+  80059e:	5e                   	pop    %esi
+  80059f:	5f                   	pop    %edi
+  8005a0:	5d                   	pop    %ebp
+  8005a1:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8005a2:	83 ec 08             	sub    $0x8,%esp
+  8005a5:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8005a8:	50                   	push   %eax
+  8005a9:	ff 36                	push   (%esi)
+  8005ab:	e8 59 ff ff ff       	call   800509 <dev_lookup>
+  8005b0:	89 c3                	mov    %eax,%ebx
+  8005b2:	83 c4 10             	add    $0x10,%esp
+  8005b5:	85 c0                	test   %eax,%eax
+  8005b7:	78 1a                	js     8005d3 <fd_close+0x77>
+		if (dev->dev_close)
+  8005b9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005bc:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8005bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8005c4:	85 c0                	test   %eax,%eax
+  8005c6:	74 0b                	je     8005d3 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8005c8:	83 ec 0c             	sub    $0xc,%esp
+  8005cb:	56                   	push   %esi
+  8005cc:	ff d0                	call   *%eax
+  8005ce:	89 c3                	mov    %eax,%ebx
+  8005d0:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8005d3:	83 ec 08             	sub    $0x8,%esp
+  8005d6:	56                   	push   %esi
+  8005d7:	6a 00                	push   $0x0
+  8005d9:	e8 10 fc ff ff       	call   8001ee <sys_page_unmap>
+	return r;
+  8005de:	83 c4 10             	add    $0x10,%esp
+  8005e1:	eb b5                	jmp    800598 <fd_close+0x3c>
+
+008005e3 <close>:
+
+int
+close(int fdnum)
+{
+  8005e3:	55                   	push   %ebp
+  8005e4:	89 e5                	mov    %esp,%ebp
+  8005e6:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8005e9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8005ec:	50                   	push   %eax
+  8005ed:	ff 75 08             	push   0x8(%ebp)
+  8005f0:	e8 c4 fe ff ff       	call   8004b9 <fd_lookup>
+  8005f5:	83 c4 10             	add    $0x10,%esp
+  8005f8:	85 c0                	test   %eax,%eax
+  8005fa:	79 02                	jns    8005fe <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8005fc:	c9                   	leave
+  8005fd:	c3                   	ret
+		return fd_close(fd, 1);
+  8005fe:	83 ec 08             	sub    $0x8,%esp
+  800601:	6a 01                	push   $0x1
+  800603:	ff 75 f4             	push   -0xc(%ebp)
+  800606:	e8 51 ff ff ff       	call   80055c <fd_close>
+  80060b:	83 c4 10             	add    $0x10,%esp
+  80060e:	eb ec                	jmp    8005fc <close+0x19>
+
+00800610 <close_all>:
+
+void
+close_all(void)
+{
+  800610:	55                   	push   %ebp
+  800611:	89 e5                	mov    %esp,%ebp
+  800613:	53                   	push   %ebx
+  800614:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  800617:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80061c:	83 ec 0c             	sub    $0xc,%esp
+  80061f:	53                   	push   %ebx
+  800620:	e8 be ff ff ff       	call   8005e3 <close>
+	for (i = 0; i < MAXFD; i++)
+  800625:	83 c3 01             	add    $0x1,%ebx
+  800628:	83 c4 10             	add    $0x10,%esp
+  80062b:	83 fb 20             	cmp    $0x20,%ebx
+  80062e:	75 ec                	jne    80061c <close_all+0xc>
+}
+  800630:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800633:	c9                   	leave
+  800634:	c3                   	ret
+
+00800635 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  800635:	55                   	push   %ebp
+  800636:	89 e5                	mov    %esp,%ebp
+  800638:	57                   	push   %edi
+  800639:	56                   	push   %esi
+  80063a:	53                   	push   %ebx
+  80063b:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80063e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800641:	50                   	push   %eax
+  800642:	ff 75 08             	push   0x8(%ebp)
+  800645:	e8 6f fe ff ff       	call   8004b9 <fd_lookup>
+  80064a:	89 c3                	mov    %eax,%ebx
+  80064c:	83 c4 10             	add    $0x10,%esp
+  80064f:	85 c0                	test   %eax,%eax
+  800651:	78 7f                	js     8006d2 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  800653:	83 ec 0c             	sub    $0xc,%esp
+  800656:	ff 75 0c             	push   0xc(%ebp)
+  800659:	e8 85 ff ff ff       	call   8005e3 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80065e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800661:	c1 e6 0c             	shl    $0xc,%esi
+  800664:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80066a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80066d:	89 3c 24             	mov    %edi,(%esp)
+  800670:	e8 d7 fd ff ff       	call   80044c <fd2data>
+  800675:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  800677:	89 34 24             	mov    %esi,(%esp)
+  80067a:	e8 cd fd ff ff       	call   80044c <fd2data>
+  80067f:	83 c4 10             	add    $0x10,%esp
+  800682:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  800685:	89 d8                	mov    %ebx,%eax
+  800687:	c1 e8 16             	shr    $0x16,%eax
+  80068a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  800691:	a8 01                	test   $0x1,%al
+  800693:	74 11                	je     8006a6 <dup+0x71>
+  800695:	89 d8                	mov    %ebx,%eax
+  800697:	c1 e8 0c             	shr    $0xc,%eax
+  80069a:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8006a1:	f6 c2 01             	test   $0x1,%dl
+  8006a4:	75 36                	jne    8006dc <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8006a6:	89 f8                	mov    %edi,%eax
+  8006a8:	c1 e8 0c             	shr    $0xc,%eax
+  8006ab:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8006b2:	83 ec 0c             	sub    $0xc,%esp
+  8006b5:	25 07 0e 00 00       	and    $0xe07,%eax
+  8006ba:	50                   	push   %eax
+  8006bb:	56                   	push   %esi
+  8006bc:	6a 00                	push   $0x0
+  8006be:	57                   	push   %edi
+  8006bf:	6a 00                	push   $0x0
+  8006c1:	e8 e6 fa ff ff       	call   8001ac <sys_page_map>
+  8006c6:	89 c3                	mov    %eax,%ebx
+  8006c8:	83 c4 20             	add    $0x20,%esp
+  8006cb:	85 c0                	test   %eax,%eax
+  8006cd:	78 33                	js     800702 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8006cf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8006d2:	89 d8                	mov    %ebx,%eax
+  8006d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006d7:	5b                   	pop    %ebx
+  8006d8:	5e                   	pop    %esi
+  8006d9:	5f                   	pop    %edi
+  8006da:	5d                   	pop    %ebp
+  8006db:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8006dc:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8006e3:	83 ec 0c             	sub    $0xc,%esp
+  8006e6:	25 07 0e 00 00       	and    $0xe07,%eax
+  8006eb:	50                   	push   %eax
+  8006ec:	ff 75 d4             	push   -0x2c(%ebp)
+  8006ef:	6a 00                	push   $0x0
+  8006f1:	53                   	push   %ebx
+  8006f2:	6a 00                	push   $0x0
+  8006f4:	e8 b3 fa ff ff       	call   8001ac <sys_page_map>
+  8006f9:	89 c3                	mov    %eax,%ebx
+  8006fb:	83 c4 20             	add    $0x20,%esp
+  8006fe:	85 c0                	test   %eax,%eax
+  800700:	79 a4                	jns    8006a6 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  800702:	83 ec 08             	sub    $0x8,%esp
+  800705:	56                   	push   %esi
+  800706:	6a 00                	push   $0x0
+  800708:	e8 e1 fa ff ff       	call   8001ee <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  80070d:	83 c4 08             	add    $0x8,%esp
+  800710:	ff 75 d4             	push   -0x2c(%ebp)
+  800713:	6a 00                	push   $0x0
+  800715:	e8 d4 fa ff ff       	call   8001ee <sys_page_unmap>
+	return r;
+  80071a:	83 c4 10             	add    $0x10,%esp
+  80071d:	eb b3                	jmp    8006d2 <dup+0x9d>
+
+0080071f <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80071f:	55                   	push   %ebp
+  800720:	89 e5                	mov    %esp,%ebp
+  800722:	56                   	push   %esi
+  800723:	53                   	push   %ebx
+  800724:	83 ec 18             	sub    $0x18,%esp
+  800727:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80072a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80072d:	50                   	push   %eax
+  80072e:	56                   	push   %esi
+  80072f:	e8 85 fd ff ff       	call   8004b9 <fd_lookup>
+  800734:	83 c4 10             	add    $0x10,%esp
+  800737:	85 c0                	test   %eax,%eax
+  800739:	78 3c                	js     800777 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80073b:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80073e:	83 ec 08             	sub    $0x8,%esp
+  800741:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800744:	50                   	push   %eax
+  800745:	ff 33                	push   (%ebx)
+  800747:	e8 bd fd ff ff       	call   800509 <dev_lookup>
+  80074c:	83 c4 10             	add    $0x10,%esp
+  80074f:	85 c0                	test   %eax,%eax
+  800751:	78 24                	js     800777 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800753:	8b 43 08             	mov    0x8(%ebx),%eax
+  800756:	83 e0 03             	and    $0x3,%eax
+  800759:	83 f8 01             	cmp    $0x1,%eax
+  80075c:	74 20                	je     80077e <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80075e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800761:	8b 40 08             	mov    0x8(%eax),%eax
+  800764:	85 c0                	test   %eax,%eax
+  800766:	74 37                	je     80079f <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  800768:	83 ec 04             	sub    $0x4,%esp
+  80076b:	ff 75 10             	push   0x10(%ebp)
+  80076e:	ff 75 0c             	push   0xc(%ebp)
+  800771:	53                   	push   %ebx
+  800772:	ff d0                	call   *%eax
+  800774:	83 c4 10             	add    $0x10,%esp
+}
+  800777:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80077a:	5b                   	pop    %ebx
+  80077b:	5e                   	pop    %esi
+  80077c:	5d                   	pop    %ebp
+  80077d:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80077e:	a1 08 40 80 00       	mov    0x804008,%eax
+  800783:	8b 40 48             	mov    0x48(%eax),%eax
+  800786:	83 ec 04             	sub    $0x4,%esp
+  800789:	56                   	push   %esi
+  80078a:	50                   	push   %eax
+  80078b:	68 7d 25 80 00       	push   $0x80257d
+  800790:	e8 93 0e 00 00       	call   801628 <cprintf>
+		return -E_INVAL;
+  800795:	83 c4 10             	add    $0x10,%esp
+  800798:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80079d:	eb d8                	jmp    800777 <read+0x58>
+		return -E_NOT_SUPP;
+  80079f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8007a4:	eb d1                	jmp    800777 <read+0x58>
+
+008007a6 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8007a6:	55                   	push   %ebp
+  8007a7:	89 e5                	mov    %esp,%ebp
+  8007a9:	57                   	push   %edi
+  8007aa:	56                   	push   %esi
+  8007ab:	53                   	push   %ebx
+  8007ac:	83 ec 0c             	sub    $0xc,%esp
+  8007af:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8007b2:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8007b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8007ba:	eb 02                	jmp    8007be <readn+0x18>
+  8007bc:	01 c3                	add    %eax,%ebx
+  8007be:	39 f3                	cmp    %esi,%ebx
+  8007c0:	73 21                	jae    8007e3 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8007c2:	83 ec 04             	sub    $0x4,%esp
+  8007c5:	89 f0                	mov    %esi,%eax
+  8007c7:	29 d8                	sub    %ebx,%eax
+  8007c9:	50                   	push   %eax
+  8007ca:	89 d8                	mov    %ebx,%eax
+  8007cc:	03 45 0c             	add    0xc(%ebp),%eax
+  8007cf:	50                   	push   %eax
+  8007d0:	57                   	push   %edi
+  8007d1:	e8 49 ff ff ff       	call   80071f <read>
+		if (m < 0)
+  8007d6:	83 c4 10             	add    $0x10,%esp
+  8007d9:	85 c0                	test   %eax,%eax
+  8007db:	78 04                	js     8007e1 <readn+0x3b>
+			return m;
+		if (m == 0)
+  8007dd:	75 dd                	jne    8007bc <readn+0x16>
+  8007df:	eb 02                	jmp    8007e3 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8007e1:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8007e3:	89 d8                	mov    %ebx,%eax
+  8007e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007e8:	5b                   	pop    %ebx
+  8007e9:	5e                   	pop    %esi
+  8007ea:	5f                   	pop    %edi
+  8007eb:	5d                   	pop    %ebp
+  8007ec:	c3                   	ret
+
+008007ed <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8007ed:	55                   	push   %ebp
+  8007ee:	89 e5                	mov    %esp,%ebp
+  8007f0:	56                   	push   %esi
+  8007f1:	53                   	push   %ebx
+  8007f2:	83 ec 18             	sub    $0x18,%esp
+  8007f5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8007f8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8007fb:	50                   	push   %eax
+  8007fc:	53                   	push   %ebx
+  8007fd:	e8 b7 fc ff ff       	call   8004b9 <fd_lookup>
+  800802:	83 c4 10             	add    $0x10,%esp
+  800805:	85 c0                	test   %eax,%eax
+  800807:	78 37                	js     800840 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800809:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80080c:	83 ec 08             	sub    $0x8,%esp
+  80080f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800812:	50                   	push   %eax
+  800813:	ff 36                	push   (%esi)
+  800815:	e8 ef fc ff ff       	call   800509 <dev_lookup>
+  80081a:	83 c4 10             	add    $0x10,%esp
+  80081d:	85 c0                	test   %eax,%eax
+  80081f:	78 1f                	js     800840 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800821:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800825:	74 20                	je     800847 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  800827:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80082a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80082d:	85 c0                	test   %eax,%eax
+  80082f:	74 37                	je     800868 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  800831:	83 ec 04             	sub    $0x4,%esp
+  800834:	ff 75 10             	push   0x10(%ebp)
+  800837:	ff 75 0c             	push   0xc(%ebp)
+  80083a:	56                   	push   %esi
+  80083b:	ff d0                	call   *%eax
+  80083d:	83 c4 10             	add    $0x10,%esp
+}
+  800840:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800843:	5b                   	pop    %ebx
+  800844:	5e                   	pop    %esi
+  800845:	5d                   	pop    %ebp
+  800846:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800847:	a1 08 40 80 00       	mov    0x804008,%eax
+  80084c:	8b 40 48             	mov    0x48(%eax),%eax
+  80084f:	83 ec 04             	sub    $0x4,%esp
+  800852:	53                   	push   %ebx
+  800853:	50                   	push   %eax
+  800854:	68 99 25 80 00       	push   $0x802599
+  800859:	e8 ca 0d 00 00       	call   801628 <cprintf>
+		return -E_INVAL;
+  80085e:	83 c4 10             	add    $0x10,%esp
+  800861:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800866:	eb d8                	jmp    800840 <write+0x53>
+		return -E_NOT_SUPP;
+  800868:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80086d:	eb d1                	jmp    800840 <write+0x53>
+
+0080086f <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80086f:	55                   	push   %ebp
+  800870:	89 e5                	mov    %esp,%ebp
+  800872:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800875:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800878:	50                   	push   %eax
+  800879:	ff 75 08             	push   0x8(%ebp)
+  80087c:	e8 38 fc ff ff       	call   8004b9 <fd_lookup>
+  800881:	83 c4 10             	add    $0x10,%esp
+  800884:	85 c0                	test   %eax,%eax
+  800886:	78 0e                	js     800896 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  800888:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80088b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80088e:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  800891:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800896:	c9                   	leave
+  800897:	c3                   	ret
+
+00800898 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800898:	55                   	push   %ebp
+  800899:	89 e5                	mov    %esp,%ebp
+  80089b:	56                   	push   %esi
+  80089c:	53                   	push   %ebx
+  80089d:	83 ec 18             	sub    $0x18,%esp
+  8008a0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8008a3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8008a6:	50                   	push   %eax
+  8008a7:	53                   	push   %ebx
+  8008a8:	e8 0c fc ff ff       	call   8004b9 <fd_lookup>
+  8008ad:	83 c4 10             	add    $0x10,%esp
+  8008b0:	85 c0                	test   %eax,%eax
+  8008b2:	78 34                	js     8008e8 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8008b4:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8008b7:	83 ec 08             	sub    $0x8,%esp
+  8008ba:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8008bd:	50                   	push   %eax
+  8008be:	ff 36                	push   (%esi)
+  8008c0:	e8 44 fc ff ff       	call   800509 <dev_lookup>
+  8008c5:	83 c4 10             	add    $0x10,%esp
+  8008c8:	85 c0                	test   %eax,%eax
+  8008ca:	78 1c                	js     8008e8 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8008cc:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8008d0:	74 1d                	je     8008ef <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8008d2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008d5:	8b 40 18             	mov    0x18(%eax),%eax
+  8008d8:	85 c0                	test   %eax,%eax
+  8008da:	74 34                	je     800910 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8008dc:	83 ec 08             	sub    $0x8,%esp
+  8008df:	ff 75 0c             	push   0xc(%ebp)
+  8008e2:	56                   	push   %esi
+  8008e3:	ff d0                	call   *%eax
+  8008e5:	83 c4 10             	add    $0x10,%esp
+}
+  8008e8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8008eb:	5b                   	pop    %ebx
+  8008ec:	5e                   	pop    %esi
+  8008ed:	5d                   	pop    %ebp
+  8008ee:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8008ef:	a1 08 40 80 00       	mov    0x804008,%eax
+  8008f4:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8008f7:	83 ec 04             	sub    $0x4,%esp
+  8008fa:	53                   	push   %ebx
+  8008fb:	50                   	push   %eax
+  8008fc:	68 5c 25 80 00       	push   $0x80255c
+  800901:	e8 22 0d 00 00       	call   801628 <cprintf>
+		return -E_INVAL;
+  800906:	83 c4 10             	add    $0x10,%esp
+  800909:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80090e:	eb d8                	jmp    8008e8 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  800910:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800915:	eb d1                	jmp    8008e8 <ftruncate+0x50>
+
+00800917 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800917:	55                   	push   %ebp
+  800918:	89 e5                	mov    %esp,%ebp
+  80091a:	56                   	push   %esi
+  80091b:	53                   	push   %ebx
+  80091c:	83 ec 18             	sub    $0x18,%esp
+  80091f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800922:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800925:	50                   	push   %eax
+  800926:	ff 75 08             	push   0x8(%ebp)
+  800929:	e8 8b fb ff ff       	call   8004b9 <fd_lookup>
+  80092e:	83 c4 10             	add    $0x10,%esp
+  800931:	85 c0                	test   %eax,%eax
+  800933:	78 49                	js     80097e <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800935:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800938:	83 ec 08             	sub    $0x8,%esp
+  80093b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80093e:	50                   	push   %eax
+  80093f:	ff 36                	push   (%esi)
+  800941:	e8 c3 fb ff ff       	call   800509 <dev_lookup>
+  800946:	83 c4 10             	add    $0x10,%esp
+  800949:	85 c0                	test   %eax,%eax
+  80094b:	78 31                	js     80097e <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  80094d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800950:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800954:	74 2f                	je     800985 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  800956:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  800959:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800960:	00 00 00 
+	stat->st_isdir = 0;
+  800963:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80096a:	00 00 00 
+	stat->st_dev = dev;
+  80096d:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  800973:	83 ec 08             	sub    $0x8,%esp
+  800976:	53                   	push   %ebx
+  800977:	56                   	push   %esi
+  800978:	ff 50 14             	call   *0x14(%eax)
+  80097b:	83 c4 10             	add    $0x10,%esp
+}
+  80097e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800981:	5b                   	pop    %ebx
+  800982:	5e                   	pop    %esi
+  800983:	5d                   	pop    %ebp
+  800984:	c3                   	ret
+		return -E_NOT_SUPP;
+  800985:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80098a:	eb f2                	jmp    80097e <fstat+0x67>
+
+0080098c <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80098c:	55                   	push   %ebp
+  80098d:	89 e5                	mov    %esp,%ebp
+  80098f:	56                   	push   %esi
+  800990:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  800991:	83 ec 08             	sub    $0x8,%esp
+  800994:	6a 00                	push   $0x0
+  800996:	ff 75 08             	push   0x8(%ebp)
+  800999:	e8 e4 01 00 00       	call   800b82 <open>
+  80099e:	89 c3                	mov    %eax,%ebx
+  8009a0:	83 c4 10             	add    $0x10,%esp
+  8009a3:	85 c0                	test   %eax,%eax
+  8009a5:	78 1b                	js     8009c2 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8009a7:	83 ec 08             	sub    $0x8,%esp
+  8009aa:	ff 75 0c             	push   0xc(%ebp)
+  8009ad:	50                   	push   %eax
+  8009ae:	e8 64 ff ff ff       	call   800917 <fstat>
+  8009b3:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8009b5:	89 1c 24             	mov    %ebx,(%esp)
+  8009b8:	e8 26 fc ff ff       	call   8005e3 <close>
+	return r;
+  8009bd:	83 c4 10             	add    $0x10,%esp
+  8009c0:	89 f3                	mov    %esi,%ebx
+}
+  8009c2:	89 d8                	mov    %ebx,%eax
+  8009c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8009c7:	5b                   	pop    %ebx
+  8009c8:	5e                   	pop    %esi
+  8009c9:	5d                   	pop    %ebp
+  8009ca:	c3                   	ret
+
+008009cb <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  8009cb:	55                   	push   %ebp
+  8009cc:	89 e5                	mov    %esp,%ebp
+  8009ce:	56                   	push   %esi
+  8009cf:	53                   	push   %ebx
+  8009d0:	89 c6                	mov    %eax,%esi
+  8009d2:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  8009d4:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  8009db:	74 27                	je     800a04 <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8009dd:	6a 07                	push   $0x7
+  8009df:	68 00 50 80 00       	push   $0x805000
+  8009e4:	56                   	push   %esi
+  8009e5:	ff 35 00 40 80 00    	push   0x804000
+  8009eb:	e8 95 15 00 00       	call   801f85 <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  8009f0:	83 c4 0c             	add    $0xc,%esp
+  8009f3:	6a 00                	push   $0x0
+  8009f5:	53                   	push   %ebx
+  8009f6:	6a 00                	push   $0x0
+  8009f8:	e8 14 15 00 00       	call   801f11 <ipc_recv>
+}
+  8009fd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800a00:	5b                   	pop    %ebx
+  800a01:	5e                   	pop    %esi
+  800a02:	5d                   	pop    %ebp
+  800a03:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  800a04:	83 ec 0c             	sub    $0xc,%esp
+  800a07:	6a 01                	push   $0x1
+  800a09:	e8 cb 15 00 00       	call   801fd9 <ipc_find_env>
+  800a0e:	a3 00 40 80 00       	mov    %eax,0x804000
+  800a13:	83 c4 10             	add    $0x10,%esp
+  800a16:	eb c5                	jmp    8009dd <fsipc+0x12>
+
+00800a18 <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  800a18:	55                   	push   %ebp
+  800a19:	89 e5                	mov    %esp,%ebp
+  800a1b:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800a1e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a21:	8b 40 0c             	mov    0xc(%eax),%eax
+  800a24:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.set_size.req_size = newsize;
+  800a29:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a2c:	a3 04 50 80 00       	mov    %eax,0x805004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  800a31:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a36:	b8 02 00 00 00       	mov    $0x2,%eax
+  800a3b:	e8 8b ff ff ff       	call   8009cb <fsipc>
+}
+  800a40:	c9                   	leave
+  800a41:	c3                   	ret
+
+00800a42 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  800a42:	55                   	push   %ebp
+  800a43:	89 e5                	mov    %esp,%ebp
+  800a45:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800a48:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a4b:	8b 40 0c             	mov    0xc(%eax),%eax
+  800a4e:	a3 00 50 80 00       	mov    %eax,0x805000
+  return fsipc(FSREQ_FLUSH, NULL);
+  800a53:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a58:	b8 06 00 00 00       	mov    $0x6,%eax
+  800a5d:	e8 69 ff ff ff       	call   8009cb <fsipc>
+}
+  800a62:	c9                   	leave
+  800a63:	c3                   	ret
+
+00800a64 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  800a64:	55                   	push   %ebp
+  800a65:	89 e5                	mov    %esp,%ebp
+  800a67:	53                   	push   %ebx
+  800a68:	83 ec 04             	sub    $0x4,%esp
+  800a6b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800a6e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a71:	8b 40 0c             	mov    0xc(%eax),%eax
+  800a74:	a3 00 50 80 00       	mov    %eax,0x805000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  800a79:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a7e:	b8 05 00 00 00       	mov    $0x5,%eax
+  800a83:	e8 43 ff ff ff       	call   8009cb <fsipc>
+  800a88:	85 c0                	test   %eax,%eax
+  800a8a:	78 2c                	js     800ab8 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800a8c:	83 ec 08             	sub    $0x8,%esp
+  800a8f:	68 00 50 80 00       	push   $0x805000
+  800a94:	53                   	push   %ebx
+  800a95:	e8 47 11 00 00       	call   801be1 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  800a9a:	a1 80 50 80 00       	mov    0x805080,%eax
+  800a9f:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800aa5:	a1 84 50 80 00       	mov    0x805084,%eax
+  800aaa:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  800ab0:	83 c4 10             	add    $0x10,%esp
+  800ab3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ab8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800abb:	c9                   	leave
+  800abc:	c3                   	ret
+
+00800abd <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  800abd:	55                   	push   %ebp
+  800abe:	89 e5                	mov    %esp,%ebp
+  800ac0:	83 ec 0c             	sub    $0xc,%esp
+  800ac3:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800ac6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ac9:	8b 52 0c             	mov    0xc(%edx),%edx
+  800acc:	89 15 00 50 80 00    	mov    %edx,0x805000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  800ad2:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  800ad7:	39 d0                	cmp    %edx,%eax
+  800ad9:	0f 47 c2             	cmova  %edx,%eax
+  800adc:	a3 04 50 80 00       	mov    %eax,0x805004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  800ae1:	50                   	push   %eax
+  800ae2:	ff 75 0c             	push   0xc(%ebp)
+  800ae5:	68 08 50 80 00       	push   $0x805008
+  800aea:	e8 78 12 00 00       	call   801d67 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  800aef:	ba 00 00 00 00       	mov    $0x0,%edx
+  800af4:	b8 04 00 00 00       	mov    $0x4,%eax
+  800af9:	e8 cd fe ff ff       	call   8009cb <fsipc>
+}
+  800afe:	c9                   	leave
+  800aff:	c3                   	ret
+
+00800b00 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  800b00:	55                   	push   %ebp
+  800b01:	89 e5                	mov    %esp,%ebp
+  800b03:	56                   	push   %esi
+  800b04:	53                   	push   %ebx
+  800b05:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800b08:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b0b:	8b 40 0c             	mov    0xc(%eax),%eax
+  800b0e:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.read.req_n = n;
+  800b13:	89 35 04 50 80 00    	mov    %esi,0x805004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  800b19:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b1e:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b23:	e8 a3 fe ff ff       	call   8009cb <fsipc>
+  800b28:	89 c3                	mov    %eax,%ebx
+  800b2a:	85 c0                	test   %eax,%eax
+  800b2c:	78 1f                	js     800b4d <devfile_read+0x4d>
+  assert(r <= n);
+  800b2e:	39 c6                	cmp    %eax,%esi
+  800b30:	72 24                	jb     800b56 <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  800b32:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800b37:	7f 33                	jg     800b6c <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  800b39:	83 ec 04             	sub    $0x4,%esp
+  800b3c:	50                   	push   %eax
+  800b3d:	68 00 50 80 00       	push   $0x805000
+  800b42:	ff 75 0c             	push   0xc(%ebp)
+  800b45:	e8 1d 12 00 00       	call   801d67 <memmove>
+  return r;
+  800b4a:	83 c4 10             	add    $0x10,%esp
+}
+  800b4d:	89 d8                	mov    %ebx,%eax
+  800b4f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b52:	5b                   	pop    %ebx
+  800b53:	5e                   	pop    %esi
+  800b54:	5d                   	pop    %ebp
+  800b55:	c3                   	ret
+  assert(r <= n);
+  800b56:	68 cc 25 80 00       	push   $0x8025cc
+  800b5b:	68 d3 25 80 00       	push   $0x8025d3
+  800b60:	6a 78                	push   $0x78
+  800b62:	68 e8 25 80 00       	push   $0x8025e8
+  800b67:	e8 e1 09 00 00       	call   80154d <_panic>
+  assert(r <= PGSIZE);
+  800b6c:	68 f3 25 80 00       	push   $0x8025f3
+  800b71:	68 d3 25 80 00       	push   $0x8025d3
+  800b76:	6a 79                	push   $0x79
+  800b78:	68 e8 25 80 00       	push   $0x8025e8
+  800b7d:	e8 cb 09 00 00       	call   80154d <_panic>
+
+00800b82 <open>:
+open(const char *path, int mode) {
+  800b82:	55                   	push   %ebp
+  800b83:	89 e5                	mov    %esp,%ebp
+  800b85:	56                   	push   %esi
+  800b86:	53                   	push   %ebx
+  800b87:	83 ec 1c             	sub    $0x1c,%esp
+  800b8a:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  800b8d:	56                   	push   %esi
+  800b8e:	e8 13 10 00 00       	call   801ba6 <strlen>
+  800b93:	83 c4 10             	add    $0x10,%esp
+  800b96:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800b9b:	7f 6c                	jg     800c09 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  800b9d:	83 ec 0c             	sub    $0xc,%esp
+  800ba0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800ba3:	50                   	push   %eax
+  800ba4:	e8 ba f8 ff ff       	call   800463 <fd_alloc>
+  800ba9:	89 c3                	mov    %eax,%ebx
+  800bab:	83 c4 10             	add    $0x10,%esp
+  800bae:	85 c0                	test   %eax,%eax
+  800bb0:	78 3c                	js     800bee <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  800bb2:	83 ec 08             	sub    $0x8,%esp
+  800bb5:	56                   	push   %esi
+  800bb6:	68 00 50 80 00       	push   $0x805000
+  800bbb:	e8 21 10 00 00       	call   801be1 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  800bc0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bc3:	a3 00 54 80 00       	mov    %eax,0x805400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  800bc8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  800bcb:	b8 01 00 00 00       	mov    $0x1,%eax
+  800bd0:	e8 f6 fd ff ff       	call   8009cb <fsipc>
+  800bd5:	89 c3                	mov    %eax,%ebx
+  800bd7:	83 c4 10             	add    $0x10,%esp
+  800bda:	85 c0                	test   %eax,%eax
+  800bdc:	78 19                	js     800bf7 <open+0x75>
+  return fd2num(fd);
+  800bde:	83 ec 0c             	sub    $0xc,%esp
+  800be1:	ff 75 f4             	push   -0xc(%ebp)
+  800be4:	e8 53 f8 ff ff       	call   80043c <fd2num>
+  800be9:	89 c3                	mov    %eax,%ebx
+  800beb:	83 c4 10             	add    $0x10,%esp
+}
+  800bee:	89 d8                	mov    %ebx,%eax
+  800bf0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800bf3:	5b                   	pop    %ebx
+  800bf4:	5e                   	pop    %esi
+  800bf5:	5d                   	pop    %ebp
+  800bf6:	c3                   	ret
+    fd_close(fd, 0);
+  800bf7:	83 ec 08             	sub    $0x8,%esp
+  800bfa:	6a 00                	push   $0x0
+  800bfc:	ff 75 f4             	push   -0xc(%ebp)
+  800bff:	e8 58 f9 ff ff       	call   80055c <fd_close>
+    return r;
+  800c04:	83 c4 10             	add    $0x10,%esp
+  800c07:	eb e5                	jmp    800bee <open+0x6c>
+    return -E_BAD_PATH;
+  800c09:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  800c0e:	eb de                	jmp    800bee <open+0x6c>
+
+00800c10 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  800c10:	55                   	push   %ebp
+  800c11:	89 e5                	mov    %esp,%ebp
+  800c13:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  800c16:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c1b:	b8 08 00 00 00       	mov    $0x8,%eax
+  800c20:	e8 a6 fd ff ff       	call   8009cb <fsipc>
+}
+  800c25:	c9                   	leave
+  800c26:	c3                   	ret
+
+00800c27 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  800c27:	55                   	push   %ebp
+  800c28:	89 e5                	mov    %esp,%ebp
+  800c2a:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  800c2d:	68 ff 25 80 00       	push   $0x8025ff
+  800c32:	ff 75 0c             	push   0xc(%ebp)
+  800c35:	e8 a7 0f 00 00       	call   801be1 <strcpy>
+	return 0;
+}
+  800c3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c3f:	c9                   	leave
+  800c40:	c3                   	ret
+
+00800c41 <devsock_close>:
+{
+  800c41:	55                   	push   %ebp
+  800c42:	89 e5                	mov    %esp,%ebp
+  800c44:	53                   	push   %ebx
+  800c45:	83 ec 10             	sub    $0x10,%esp
+  800c48:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  800c4b:	53                   	push   %ebx
+  800c4c:	e8 c7 13 00 00       	call   802018 <pageref>
+  800c51:	89 c2                	mov    %eax,%edx
+  800c53:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  800c56:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  800c5b:	83 fa 01             	cmp    $0x1,%edx
+  800c5e:	74 05                	je     800c65 <devsock_close+0x24>
+}
+  800c60:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c63:	c9                   	leave
+  800c64:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  800c65:	83 ec 0c             	sub    $0xc,%esp
+  800c68:	ff 73 0c             	push   0xc(%ebx)
+  800c6b:	e8 b7 02 00 00       	call   800f27 <nsipc_close>
+  800c70:	83 c4 10             	add    $0x10,%esp
+  800c73:	eb eb                	jmp    800c60 <devsock_close+0x1f>
+
+00800c75 <devsock_write>:
+{
+  800c75:	55                   	push   %ebp
+  800c76:	89 e5                	mov    %esp,%ebp
+  800c78:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  800c7b:	6a 00                	push   $0x0
+  800c7d:	ff 75 10             	push   0x10(%ebp)
+  800c80:	ff 75 0c             	push   0xc(%ebp)
+  800c83:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c86:	ff 70 0c             	push   0xc(%eax)
+  800c89:	e8 79 03 00 00       	call   801007 <nsipc_send>
+}
+  800c8e:	c9                   	leave
+  800c8f:	c3                   	ret
+
+00800c90 <devsock_read>:
+{
+  800c90:	55                   	push   %ebp
+  800c91:	89 e5                	mov    %esp,%ebp
+  800c93:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  800c96:	6a 00                	push   $0x0
+  800c98:	ff 75 10             	push   0x10(%ebp)
+  800c9b:	ff 75 0c             	push   0xc(%ebp)
+  800c9e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ca1:	ff 70 0c             	push   0xc(%eax)
+  800ca4:	e8 ef 02 00 00       	call   800f98 <nsipc_recv>
+}
+  800ca9:	c9                   	leave
+  800caa:	c3                   	ret
+
+00800cab <fd2sockid>:
+{
+  800cab:	55                   	push   %ebp
+  800cac:	89 e5                	mov    %esp,%ebp
+  800cae:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  800cb1:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  800cb4:	52                   	push   %edx
+  800cb5:	50                   	push   %eax
+  800cb6:	e8 fe f7 ff ff       	call   8004b9 <fd_lookup>
+  800cbb:	83 c4 10             	add    $0x10,%esp
+  800cbe:	85 c0                	test   %eax,%eax
+  800cc0:	78 10                	js     800cd2 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  800cc2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800cc5:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  800ccb:	39 08                	cmp    %ecx,(%eax)
+  800ccd:	75 05                	jne    800cd4 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  800ccf:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  800cd2:	c9                   	leave
+  800cd3:	c3                   	ret
+		return -E_NOT_SUPP;
+  800cd4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800cd9:	eb f7                	jmp    800cd2 <fd2sockid+0x27>
+
+00800cdb <alloc_sockfd>:
+{
+  800cdb:	55                   	push   %ebp
+  800cdc:	89 e5                	mov    %esp,%ebp
+  800cde:	56                   	push   %esi
+  800cdf:	53                   	push   %ebx
+  800ce0:	83 ec 1c             	sub    $0x1c,%esp
+  800ce3:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  800ce5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800ce8:	50                   	push   %eax
+  800ce9:	e8 75 f7 ff ff       	call   800463 <fd_alloc>
+  800cee:	89 c3                	mov    %eax,%ebx
+  800cf0:	83 c4 10             	add    $0x10,%esp
+  800cf3:	85 c0                	test   %eax,%eax
+  800cf5:	78 43                	js     800d3a <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  800cf7:	83 ec 04             	sub    $0x4,%esp
+  800cfa:	68 07 04 00 00       	push   $0x407
+  800cff:	ff 75 f4             	push   -0xc(%ebp)
+  800d02:	6a 00                	push   $0x0
+  800d04:	e8 60 f4 ff ff       	call   800169 <sys_page_alloc>
+  800d09:	89 c3                	mov    %eax,%ebx
+  800d0b:	83 c4 10             	add    $0x10,%esp
+  800d0e:	85 c0                	test   %eax,%eax
+  800d10:	78 28                	js     800d3a <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  800d12:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800d15:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  800d1b:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  800d1d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800d20:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  800d27:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  800d2a:	83 ec 0c             	sub    $0xc,%esp
+  800d2d:	50                   	push   %eax
+  800d2e:	e8 09 f7 ff ff       	call   80043c <fd2num>
+  800d33:	89 c3                	mov    %eax,%ebx
+  800d35:	83 c4 10             	add    $0x10,%esp
+  800d38:	eb 0c                	jmp    800d46 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  800d3a:	83 ec 0c             	sub    $0xc,%esp
+  800d3d:	56                   	push   %esi
+  800d3e:	e8 e4 01 00 00       	call   800f27 <nsipc_close>
+		return r;
+  800d43:	83 c4 10             	add    $0x10,%esp
+}
+  800d46:	89 d8                	mov    %ebx,%eax
+  800d48:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d4b:	5b                   	pop    %ebx
+  800d4c:	5e                   	pop    %esi
+  800d4d:	5d                   	pop    %ebp
+  800d4e:	c3                   	ret
+
+00800d4f <accept>:
+{
+  800d4f:	55                   	push   %ebp
+  800d50:	89 e5                	mov    %esp,%ebp
+  800d52:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800d55:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d58:	e8 4e ff ff ff       	call   800cab <fd2sockid>
+  800d5d:	85 c0                	test   %eax,%eax
+  800d5f:	78 1b                	js     800d7c <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  800d61:	83 ec 04             	sub    $0x4,%esp
+  800d64:	ff 75 10             	push   0x10(%ebp)
+  800d67:	ff 75 0c             	push   0xc(%ebp)
+  800d6a:	50                   	push   %eax
+  800d6b:	e8 0e 01 00 00       	call   800e7e <nsipc_accept>
+  800d70:	83 c4 10             	add    $0x10,%esp
+  800d73:	85 c0                	test   %eax,%eax
+  800d75:	78 05                	js     800d7c <accept+0x2d>
+	return alloc_sockfd(r);
+  800d77:	e8 5f ff ff ff       	call   800cdb <alloc_sockfd>
+}
+  800d7c:	c9                   	leave
+  800d7d:	c3                   	ret
+
+00800d7e <bind>:
+{
+  800d7e:	55                   	push   %ebp
+  800d7f:	89 e5                	mov    %esp,%ebp
+  800d81:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800d84:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d87:	e8 1f ff ff ff       	call   800cab <fd2sockid>
+  800d8c:	85 c0                	test   %eax,%eax
+  800d8e:	78 12                	js     800da2 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  800d90:	83 ec 04             	sub    $0x4,%esp
+  800d93:	ff 75 10             	push   0x10(%ebp)
+  800d96:	ff 75 0c             	push   0xc(%ebp)
+  800d99:	50                   	push   %eax
+  800d9a:	e8 31 01 00 00       	call   800ed0 <nsipc_bind>
+  800d9f:	83 c4 10             	add    $0x10,%esp
+}
+  800da2:	c9                   	leave
+  800da3:	c3                   	ret
+
+00800da4 <shutdown>:
+{
+  800da4:	55                   	push   %ebp
+  800da5:	89 e5                	mov    %esp,%ebp
+  800da7:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800daa:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dad:	e8 f9 fe ff ff       	call   800cab <fd2sockid>
+  800db2:	85 c0                	test   %eax,%eax
+  800db4:	78 0f                	js     800dc5 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  800db6:	83 ec 08             	sub    $0x8,%esp
+  800db9:	ff 75 0c             	push   0xc(%ebp)
+  800dbc:	50                   	push   %eax
+  800dbd:	e8 43 01 00 00       	call   800f05 <nsipc_shutdown>
+  800dc2:	83 c4 10             	add    $0x10,%esp
+}
+  800dc5:	c9                   	leave
+  800dc6:	c3                   	ret
+
+00800dc7 <connect>:
+{
+  800dc7:	55                   	push   %ebp
+  800dc8:	89 e5                	mov    %esp,%ebp
+  800dca:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800dcd:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dd0:	e8 d6 fe ff ff       	call   800cab <fd2sockid>
+  800dd5:	85 c0                	test   %eax,%eax
+  800dd7:	78 12                	js     800deb <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  800dd9:	83 ec 04             	sub    $0x4,%esp
+  800ddc:	ff 75 10             	push   0x10(%ebp)
+  800ddf:	ff 75 0c             	push   0xc(%ebp)
+  800de2:	50                   	push   %eax
+  800de3:	e8 59 01 00 00       	call   800f41 <nsipc_connect>
+  800de8:	83 c4 10             	add    $0x10,%esp
+}
+  800deb:	c9                   	leave
+  800dec:	c3                   	ret
+
+00800ded <listen>:
+{
+  800ded:	55                   	push   %ebp
+  800dee:	89 e5                	mov    %esp,%ebp
+  800df0:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800df3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800df6:	e8 b0 fe ff ff       	call   800cab <fd2sockid>
+  800dfb:	85 c0                	test   %eax,%eax
+  800dfd:	78 0f                	js     800e0e <listen+0x21>
+	return nsipc_listen(r, backlog);
+  800dff:	83 ec 08             	sub    $0x8,%esp
+  800e02:	ff 75 0c             	push   0xc(%ebp)
+  800e05:	50                   	push   %eax
+  800e06:	e8 6b 01 00 00       	call   800f76 <nsipc_listen>
+  800e0b:	83 c4 10             	add    $0x10,%esp
+}
+  800e0e:	c9                   	leave
+  800e0f:	c3                   	ret
+
+00800e10 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  800e10:	55                   	push   %ebp
+  800e11:	89 e5                	mov    %esp,%ebp
+  800e13:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  800e16:	ff 75 10             	push   0x10(%ebp)
+  800e19:	ff 75 0c             	push   0xc(%ebp)
+  800e1c:	ff 75 08             	push   0x8(%ebp)
+  800e1f:	e8 41 02 00 00       	call   801065 <nsipc_socket>
+  800e24:	83 c4 10             	add    $0x10,%esp
+  800e27:	85 c0                	test   %eax,%eax
+  800e29:	78 05                	js     800e30 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  800e2b:	e8 ab fe ff ff       	call   800cdb <alloc_sockfd>
+}
+  800e30:	c9                   	leave
+  800e31:	c3                   	ret
+
+00800e32 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  800e32:	55                   	push   %ebp
+  800e33:	89 e5                	mov    %esp,%ebp
+  800e35:	53                   	push   %ebx
+  800e36:	83 ec 04             	sub    $0x4,%esp
+  800e39:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  800e3b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800e42:	74 26                	je     800e6a <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  800e44:	6a 07                	push   $0x7
+  800e46:	68 00 60 80 00       	push   $0x806000
+  800e4b:	53                   	push   %ebx
+  800e4c:	ff 35 04 40 80 00    	push   0x804004
+  800e52:	e8 2e 11 00 00       	call   801f85 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  800e57:	83 c4 0c             	add    $0xc,%esp
+  800e5a:	6a 00                	push   $0x0
+  800e5c:	6a 00                	push   $0x0
+  800e5e:	6a 00                	push   $0x0
+  800e60:	e8 ac 10 00 00       	call   801f11 <ipc_recv>
+}
+  800e65:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e68:	c9                   	leave
+  800e69:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  800e6a:	83 ec 0c             	sub    $0xc,%esp
+  800e6d:	6a 02                	push   $0x2
+  800e6f:	e8 65 11 00 00       	call   801fd9 <ipc_find_env>
+  800e74:	a3 04 40 80 00       	mov    %eax,0x804004
+  800e79:	83 c4 10             	add    $0x10,%esp
+  800e7c:	eb c6                	jmp    800e44 <nsipc+0x12>
+
+00800e7e <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  800e7e:	55                   	push   %ebp
+  800e7f:	89 e5                	mov    %esp,%ebp
+  800e81:	56                   	push   %esi
+  800e82:	53                   	push   %ebx
+  800e83:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  800e86:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e89:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  800e8e:	8b 06                	mov    (%esi),%eax
+  800e90:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  800e95:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e9a:	e8 93 ff ff ff       	call   800e32 <nsipc>
+  800e9f:	89 c3                	mov    %eax,%ebx
+  800ea1:	85 c0                	test   %eax,%eax
+  800ea3:	79 09                	jns    800eae <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  800ea5:	89 d8                	mov    %ebx,%eax
+  800ea7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800eaa:	5b                   	pop    %ebx
+  800eab:	5e                   	pop    %esi
+  800eac:	5d                   	pop    %ebp
+  800ead:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  800eae:	83 ec 04             	sub    $0x4,%esp
+  800eb1:	ff 35 10 60 80 00    	push   0x806010
+  800eb7:	68 00 60 80 00       	push   $0x806000
+  800ebc:	ff 75 0c             	push   0xc(%ebp)
+  800ebf:	e8 a3 0e 00 00       	call   801d67 <memmove>
+		*addrlen = ret->ret_addrlen;
+  800ec4:	a1 10 60 80 00       	mov    0x806010,%eax
+  800ec9:	89 06                	mov    %eax,(%esi)
+  800ecb:	83 c4 10             	add    $0x10,%esp
+	return r;
+  800ece:	eb d5                	jmp    800ea5 <nsipc_accept+0x27>
+
+00800ed0 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  800ed0:	55                   	push   %ebp
+  800ed1:	89 e5                	mov    %esp,%ebp
+  800ed3:	53                   	push   %ebx
+  800ed4:	83 ec 08             	sub    $0x8,%esp
+  800ed7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  800eda:	8b 45 08             	mov    0x8(%ebp),%eax
+  800edd:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  800ee2:	53                   	push   %ebx
+  800ee3:	ff 75 0c             	push   0xc(%ebp)
+  800ee6:	68 04 60 80 00       	push   $0x806004
+  800eeb:	e8 77 0e 00 00       	call   801d67 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  800ef0:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  800ef6:	b8 02 00 00 00       	mov    $0x2,%eax
+  800efb:	e8 32 ff ff ff       	call   800e32 <nsipc>
+}
+  800f00:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f03:	c9                   	leave
+  800f04:	c3                   	ret
+
+00800f05 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  800f05:	55                   	push   %ebp
+  800f06:	89 e5                	mov    %esp,%ebp
+  800f08:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  800f0b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f0e:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  800f13:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f16:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  800f1b:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f20:	e8 0d ff ff ff       	call   800e32 <nsipc>
+}
+  800f25:	c9                   	leave
+  800f26:	c3                   	ret
+
+00800f27 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  800f27:	55                   	push   %ebp
+  800f28:	89 e5                	mov    %esp,%ebp
+  800f2a:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  800f2d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f30:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  800f35:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f3a:	e8 f3 fe ff ff       	call   800e32 <nsipc>
+}
+  800f3f:	c9                   	leave
+  800f40:	c3                   	ret
+
+00800f41 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  800f41:	55                   	push   %ebp
+  800f42:	89 e5                	mov    %esp,%ebp
+  800f44:	53                   	push   %ebx
+  800f45:	83 ec 08             	sub    $0x8,%esp
+  800f48:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  800f4b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f4e:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  800f53:	53                   	push   %ebx
+  800f54:	ff 75 0c             	push   0xc(%ebp)
+  800f57:	68 04 60 80 00       	push   $0x806004
+  800f5c:	e8 06 0e 00 00       	call   801d67 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  800f61:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  800f67:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f6c:	e8 c1 fe ff ff       	call   800e32 <nsipc>
+}
+  800f71:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f74:	c9                   	leave
+  800f75:	c3                   	ret
+
+00800f76 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  800f76:	55                   	push   %ebp
+  800f77:	89 e5                	mov    %esp,%ebp
+  800f79:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  800f7c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f7f:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  800f84:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f87:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  800f8c:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f91:	e8 9c fe ff ff       	call   800e32 <nsipc>
+}
+  800f96:	c9                   	leave
+  800f97:	c3                   	ret
+
+00800f98 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  800f98:	55                   	push   %ebp
+  800f99:	89 e5                	mov    %esp,%ebp
+  800f9b:	56                   	push   %esi
+  800f9c:	53                   	push   %ebx
+  800f9d:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  800fa0:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fa3:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  800fa8:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  800fae:	8b 45 14             	mov    0x14(%ebp),%eax
+  800fb1:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  800fb6:	b8 07 00 00 00       	mov    $0x7,%eax
+  800fbb:	e8 72 fe ff ff       	call   800e32 <nsipc>
+  800fc0:	89 c3                	mov    %eax,%ebx
+  800fc2:	85 c0                	test   %eax,%eax
+  800fc4:	78 22                	js     800fe8 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  800fc6:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  800fcb:	39 c6                	cmp    %eax,%esi
+  800fcd:	0f 4e c6             	cmovle %esi,%eax
+  800fd0:	39 c3                	cmp    %eax,%ebx
+  800fd2:	7f 1d                	jg     800ff1 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  800fd4:	83 ec 04             	sub    $0x4,%esp
+  800fd7:	53                   	push   %ebx
+  800fd8:	68 00 60 80 00       	push   $0x806000
+  800fdd:	ff 75 0c             	push   0xc(%ebp)
+  800fe0:	e8 82 0d 00 00       	call   801d67 <memmove>
+  800fe5:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  800fe8:	89 d8                	mov    %ebx,%eax
+  800fea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fed:	5b                   	pop    %ebx
+  800fee:	5e                   	pop    %esi
+  800fef:	5d                   	pop    %ebp
+  800ff0:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  800ff1:	68 0b 26 80 00       	push   $0x80260b
+  800ff6:	68 d3 25 80 00       	push   $0x8025d3
+  800ffb:	6a 62                	push   $0x62
+  800ffd:	68 20 26 80 00       	push   $0x802620
+  801002:	e8 46 05 00 00       	call   80154d <_panic>
+
+00801007 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801007:	55                   	push   %ebp
+  801008:	89 e5                	mov    %esp,%ebp
+  80100a:	53                   	push   %ebx
+  80100b:	83 ec 04             	sub    $0x4,%esp
+  80100e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801011:	8b 45 08             	mov    0x8(%ebp),%eax
+  801014:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  801019:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80101f:	7f 2e                	jg     80104f <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801021:	83 ec 04             	sub    $0x4,%esp
+  801024:	53                   	push   %ebx
+  801025:	ff 75 0c             	push   0xc(%ebp)
+  801028:	68 0c 60 80 00       	push   $0x80600c
+  80102d:	e8 35 0d 00 00       	call   801d67 <memmove>
+	nsipcbuf.send.req_size = size;
+  801032:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  801038:	8b 45 14             	mov    0x14(%ebp),%eax
+  80103b:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  801040:	b8 08 00 00 00       	mov    $0x8,%eax
+  801045:	e8 e8 fd ff ff       	call   800e32 <nsipc>
+}
+  80104a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80104d:	c9                   	leave
+  80104e:	c3                   	ret
+	assert(size < 1600);
+  80104f:	68 2c 26 80 00       	push   $0x80262c
+  801054:	68 d3 25 80 00       	push   $0x8025d3
+  801059:	6a 6d                	push   $0x6d
+  80105b:	68 20 26 80 00       	push   $0x802620
+  801060:	e8 e8 04 00 00       	call   80154d <_panic>
+
+00801065 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801065:	55                   	push   %ebp
+  801066:	89 e5                	mov    %esp,%ebp
+  801068:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  80106b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80106e:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  801073:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801076:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  80107b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80107e:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  801083:	b8 09 00 00 00       	mov    $0x9,%eax
+  801088:	e8 a5 fd ff ff       	call   800e32 <nsipc>
+}
+  80108d:	c9                   	leave
+  80108e:	c3                   	ret
+
+0080108f <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80108f:	55                   	push   %ebp
+  801090:	89 e5                	mov    %esp,%ebp
+  801092:	56                   	push   %esi
+  801093:	53                   	push   %ebx
+  801094:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801097:	83 ec 0c             	sub    $0xc,%esp
+  80109a:	ff 75 08             	push   0x8(%ebp)
+  80109d:	e8 aa f3 ff ff       	call   80044c <fd2data>
+  8010a2:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8010a4:	83 c4 08             	add    $0x8,%esp
+  8010a7:	68 38 26 80 00       	push   $0x802638
+  8010ac:	53                   	push   %ebx
+  8010ad:	e8 2f 0b 00 00       	call   801be1 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8010b2:	8b 46 04             	mov    0x4(%esi),%eax
+  8010b5:	2b 06                	sub    (%esi),%eax
+  8010b7:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8010bd:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8010c4:	00 00 00 
+	stat->st_dev = &devpipe;
+  8010c7:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  8010ce:	30 80 00 
+	return 0;
+}
+  8010d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010d6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8010d9:	5b                   	pop    %ebx
+  8010da:	5e                   	pop    %esi
+  8010db:	5d                   	pop    %ebp
+  8010dc:	c3                   	ret
+
+008010dd <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8010dd:	55                   	push   %ebp
+  8010de:	89 e5                	mov    %esp,%ebp
+  8010e0:	53                   	push   %ebx
+  8010e1:	83 ec 0c             	sub    $0xc,%esp
+  8010e4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8010e7:	53                   	push   %ebx
+  8010e8:	6a 00                	push   $0x0
+  8010ea:	e8 ff f0 ff ff       	call   8001ee <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8010ef:	89 1c 24             	mov    %ebx,(%esp)
+  8010f2:	e8 55 f3 ff ff       	call   80044c <fd2data>
+  8010f7:	83 c4 08             	add    $0x8,%esp
+  8010fa:	50                   	push   %eax
+  8010fb:	6a 00                	push   $0x0
+  8010fd:	e8 ec f0 ff ff       	call   8001ee <sys_page_unmap>
+}
+  801102:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801105:	c9                   	leave
+  801106:	c3                   	ret
+
+00801107 <_pipeisclosed>:
+{
+  801107:	55                   	push   %ebp
+  801108:	89 e5                	mov    %esp,%ebp
+  80110a:	57                   	push   %edi
+  80110b:	56                   	push   %esi
+  80110c:	53                   	push   %ebx
+  80110d:	83 ec 1c             	sub    $0x1c,%esp
+  801110:	89 c7                	mov    %eax,%edi
+  801112:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801114:	a1 08 40 80 00       	mov    0x804008,%eax
+  801119:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  80111c:	83 ec 0c             	sub    $0xc,%esp
+  80111f:	57                   	push   %edi
+  801120:	e8 f3 0e 00 00       	call   802018 <pageref>
+  801125:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801128:	89 34 24             	mov    %esi,(%esp)
+  80112b:	e8 e8 0e 00 00       	call   802018 <pageref>
+		nn = thisenv->env_runs;
+  801130:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801136:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801139:	83 c4 10             	add    $0x10,%esp
+  80113c:	39 cb                	cmp    %ecx,%ebx
+  80113e:	74 1b                	je     80115b <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801140:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801143:	75 cf                	jne    801114 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801145:	8b 42 58             	mov    0x58(%edx),%eax
+  801148:	6a 01                	push   $0x1
+  80114a:	50                   	push   %eax
+  80114b:	53                   	push   %ebx
+  80114c:	68 3f 26 80 00       	push   $0x80263f
+  801151:	e8 d2 04 00 00       	call   801628 <cprintf>
+  801156:	83 c4 10             	add    $0x10,%esp
+  801159:	eb b9                	jmp    801114 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  80115b:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80115e:	0f 94 c0             	sete   %al
+  801161:	0f b6 c0             	movzbl %al,%eax
+}
+  801164:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801167:	5b                   	pop    %ebx
+  801168:	5e                   	pop    %esi
+  801169:	5f                   	pop    %edi
+  80116a:	5d                   	pop    %ebp
+  80116b:	c3                   	ret
+
+0080116c <devpipe_write>:
+{
+  80116c:	55                   	push   %ebp
+  80116d:	89 e5                	mov    %esp,%ebp
+  80116f:	57                   	push   %edi
+  801170:	56                   	push   %esi
+  801171:	53                   	push   %ebx
+  801172:	83 ec 28             	sub    $0x28,%esp
+  801175:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801178:	56                   	push   %esi
+  801179:	e8 ce f2 ff ff       	call   80044c <fd2data>
+  80117e:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801180:	83 c4 10             	add    $0x10,%esp
+  801183:	bf 00 00 00 00       	mov    $0x0,%edi
+  801188:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  80118b:	75 09                	jne    801196 <devpipe_write+0x2a>
+	return i;
+  80118d:	89 f8                	mov    %edi,%eax
+  80118f:	eb 23                	jmp    8011b4 <devpipe_write+0x48>
+			sys_yield();
+  801191:	e8 b4 ef ff ff       	call   80014a <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801196:	8b 43 04             	mov    0x4(%ebx),%eax
+  801199:	8b 0b                	mov    (%ebx),%ecx
+  80119b:	8d 51 20             	lea    0x20(%ecx),%edx
+  80119e:	39 d0                	cmp    %edx,%eax
+  8011a0:	72 1a                	jb     8011bc <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8011a2:	89 da                	mov    %ebx,%edx
+  8011a4:	89 f0                	mov    %esi,%eax
+  8011a6:	e8 5c ff ff ff       	call   801107 <_pipeisclosed>
+  8011ab:	85 c0                	test   %eax,%eax
+  8011ad:	74 e2                	je     801191 <devpipe_write+0x25>
+				return 0;
+  8011af:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011b7:	5b                   	pop    %ebx
+  8011b8:	5e                   	pop    %esi
+  8011b9:	5f                   	pop    %edi
+  8011ba:	5d                   	pop    %ebp
+  8011bb:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8011bc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011bf:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8011c3:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8011c6:	89 c2                	mov    %eax,%edx
+  8011c8:	c1 fa 1f             	sar    $0x1f,%edx
+  8011cb:	89 d1                	mov    %edx,%ecx
+  8011cd:	c1 e9 1b             	shr    $0x1b,%ecx
+  8011d0:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8011d3:	83 e2 1f             	and    $0x1f,%edx
+  8011d6:	29 ca                	sub    %ecx,%edx
+  8011d8:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8011dc:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8011e0:	83 c0 01             	add    $0x1,%eax
+  8011e3:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8011e6:	83 c7 01             	add    $0x1,%edi
+  8011e9:	eb 9d                	jmp    801188 <devpipe_write+0x1c>
+
+008011eb <devpipe_read>:
+{
+  8011eb:	55                   	push   %ebp
+  8011ec:	89 e5                	mov    %esp,%ebp
+  8011ee:	57                   	push   %edi
+  8011ef:	56                   	push   %esi
+  8011f0:	53                   	push   %ebx
+  8011f1:	83 ec 18             	sub    $0x18,%esp
+  8011f4:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8011f7:	57                   	push   %edi
+  8011f8:	e8 4f f2 ff ff       	call   80044c <fd2data>
+  8011fd:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8011ff:	83 c4 10             	add    $0x10,%esp
+  801202:	be 00 00 00 00       	mov    $0x0,%esi
+  801207:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80120a:	75 13                	jne    80121f <devpipe_read+0x34>
+	return i;
+  80120c:	89 f0                	mov    %esi,%eax
+  80120e:	eb 02                	jmp    801212 <devpipe_read+0x27>
+				return i;
+  801210:	89 f0                	mov    %esi,%eax
+}
+  801212:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801215:	5b                   	pop    %ebx
+  801216:	5e                   	pop    %esi
+  801217:	5f                   	pop    %edi
+  801218:	5d                   	pop    %ebp
+  801219:	c3                   	ret
+			sys_yield();
+  80121a:	e8 2b ef ff ff       	call   80014a <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  80121f:	8b 03                	mov    (%ebx),%eax
+  801221:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801224:	75 18                	jne    80123e <devpipe_read+0x53>
+			if (i > 0)
+  801226:	85 f6                	test   %esi,%esi
+  801228:	75 e6                	jne    801210 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  80122a:	89 da                	mov    %ebx,%edx
+  80122c:	89 f8                	mov    %edi,%eax
+  80122e:	e8 d4 fe ff ff       	call   801107 <_pipeisclosed>
+  801233:	85 c0                	test   %eax,%eax
+  801235:	74 e3                	je     80121a <devpipe_read+0x2f>
+				return 0;
+  801237:	b8 00 00 00 00       	mov    $0x0,%eax
+  80123c:	eb d4                	jmp    801212 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80123e:	99                   	cltd
+  80123f:	c1 ea 1b             	shr    $0x1b,%edx
+  801242:	01 d0                	add    %edx,%eax
+  801244:	83 e0 1f             	and    $0x1f,%eax
+  801247:	29 d0                	sub    %edx,%eax
+  801249:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  80124e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801251:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  801254:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  801257:	83 c6 01             	add    $0x1,%esi
+  80125a:	eb ab                	jmp    801207 <devpipe_read+0x1c>
+
+0080125c <pipe>:
+{
+  80125c:	55                   	push   %ebp
+  80125d:	89 e5                	mov    %esp,%ebp
+  80125f:	56                   	push   %esi
+  801260:	53                   	push   %ebx
+  801261:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801264:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801267:	50                   	push   %eax
+  801268:	e8 f6 f1 ff ff       	call   800463 <fd_alloc>
+  80126d:	89 c3                	mov    %eax,%ebx
+  80126f:	83 c4 10             	add    $0x10,%esp
+  801272:	85 c0                	test   %eax,%eax
+  801274:	0f 88 23 01 00 00    	js     80139d <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80127a:	83 ec 04             	sub    $0x4,%esp
+  80127d:	68 07 04 00 00       	push   $0x407
+  801282:	ff 75 f4             	push   -0xc(%ebp)
+  801285:	6a 00                	push   $0x0
+  801287:	e8 dd ee ff ff       	call   800169 <sys_page_alloc>
+  80128c:	89 c3                	mov    %eax,%ebx
+  80128e:	83 c4 10             	add    $0x10,%esp
+  801291:	85 c0                	test   %eax,%eax
+  801293:	0f 88 04 01 00 00    	js     80139d <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801299:	83 ec 0c             	sub    $0xc,%esp
+  80129c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80129f:	50                   	push   %eax
+  8012a0:	e8 be f1 ff ff       	call   800463 <fd_alloc>
+  8012a5:	89 c3                	mov    %eax,%ebx
+  8012a7:	83 c4 10             	add    $0x10,%esp
+  8012aa:	85 c0                	test   %eax,%eax
+  8012ac:	0f 88 db 00 00 00    	js     80138d <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8012b2:	83 ec 04             	sub    $0x4,%esp
+  8012b5:	68 07 04 00 00       	push   $0x407
+  8012ba:	ff 75 f0             	push   -0x10(%ebp)
+  8012bd:	6a 00                	push   $0x0
+  8012bf:	e8 a5 ee ff ff       	call   800169 <sys_page_alloc>
+  8012c4:	89 c3                	mov    %eax,%ebx
+  8012c6:	83 c4 10             	add    $0x10,%esp
+  8012c9:	85 c0                	test   %eax,%eax
+  8012cb:	0f 88 bc 00 00 00    	js     80138d <pipe+0x131>
+	va = fd2data(fd0);
+  8012d1:	83 ec 0c             	sub    $0xc,%esp
+  8012d4:	ff 75 f4             	push   -0xc(%ebp)
+  8012d7:	e8 70 f1 ff ff       	call   80044c <fd2data>
+  8012dc:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8012de:	83 c4 0c             	add    $0xc,%esp
+  8012e1:	68 07 04 00 00       	push   $0x407
+  8012e6:	50                   	push   %eax
+  8012e7:	6a 00                	push   $0x0
+  8012e9:	e8 7b ee ff ff       	call   800169 <sys_page_alloc>
+  8012ee:	89 c3                	mov    %eax,%ebx
+  8012f0:	83 c4 10             	add    $0x10,%esp
+  8012f3:	85 c0                	test   %eax,%eax
+  8012f5:	0f 88 82 00 00 00    	js     80137d <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8012fb:	83 ec 0c             	sub    $0xc,%esp
+  8012fe:	ff 75 f0             	push   -0x10(%ebp)
+  801301:	e8 46 f1 ff ff       	call   80044c <fd2data>
+  801306:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80130d:	50                   	push   %eax
+  80130e:	6a 00                	push   $0x0
+  801310:	56                   	push   %esi
+  801311:	6a 00                	push   $0x0
+  801313:	e8 94 ee ff ff       	call   8001ac <sys_page_map>
+  801318:	89 c3                	mov    %eax,%ebx
+  80131a:	83 c4 20             	add    $0x20,%esp
+  80131d:	85 c0                	test   %eax,%eax
+  80131f:	78 4e                	js     80136f <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  801321:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  801326:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801329:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80132b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80132e:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  801335:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801338:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80133a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80133d:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  801344:	83 ec 0c             	sub    $0xc,%esp
+  801347:	ff 75 f4             	push   -0xc(%ebp)
+  80134a:	e8 ed f0 ff ff       	call   80043c <fd2num>
+  80134f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801352:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  801354:	83 c4 04             	add    $0x4,%esp
+  801357:	ff 75 f0             	push   -0x10(%ebp)
+  80135a:	e8 dd f0 ff ff       	call   80043c <fd2num>
+  80135f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801362:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  801365:	83 c4 10             	add    $0x10,%esp
+  801368:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80136d:	eb 2e                	jmp    80139d <pipe+0x141>
+	sys_page_unmap(0, va);
+  80136f:	83 ec 08             	sub    $0x8,%esp
+  801372:	56                   	push   %esi
+  801373:	6a 00                	push   $0x0
+  801375:	e8 74 ee ff ff       	call   8001ee <sys_page_unmap>
+  80137a:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80137d:	83 ec 08             	sub    $0x8,%esp
+  801380:	ff 75 f0             	push   -0x10(%ebp)
+  801383:	6a 00                	push   $0x0
+  801385:	e8 64 ee ff ff       	call   8001ee <sys_page_unmap>
+  80138a:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80138d:	83 ec 08             	sub    $0x8,%esp
+  801390:	ff 75 f4             	push   -0xc(%ebp)
+  801393:	6a 00                	push   $0x0
+  801395:	e8 54 ee ff ff       	call   8001ee <sys_page_unmap>
+  80139a:	83 c4 10             	add    $0x10,%esp
+}
+  80139d:	89 d8                	mov    %ebx,%eax
+  80139f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013a2:	5b                   	pop    %ebx
+  8013a3:	5e                   	pop    %esi
+  8013a4:	5d                   	pop    %ebp
+  8013a5:	c3                   	ret
+
+008013a6 <pipeisclosed>:
+{
+  8013a6:	55                   	push   %ebp
+  8013a7:	89 e5                	mov    %esp,%ebp
+  8013a9:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8013ac:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013af:	50                   	push   %eax
+  8013b0:	ff 75 08             	push   0x8(%ebp)
+  8013b3:	e8 01 f1 ff ff       	call   8004b9 <fd_lookup>
+  8013b8:	83 c4 10             	add    $0x10,%esp
+  8013bb:	85 c0                	test   %eax,%eax
+  8013bd:	78 18                	js     8013d7 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8013bf:	83 ec 0c             	sub    $0xc,%esp
+  8013c2:	ff 75 f4             	push   -0xc(%ebp)
+  8013c5:	e8 82 f0 ff ff       	call   80044c <fd2data>
+  8013ca:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8013cc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013cf:	e8 33 fd ff ff       	call   801107 <_pipeisclosed>
+  8013d4:	83 c4 10             	add    $0x10,%esp
+}
+  8013d7:	c9                   	leave
+  8013d8:	c3                   	ret
+
+008013d9 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8013d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013de:	c3                   	ret
+
+008013df <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8013df:	55                   	push   %ebp
+  8013e0:	89 e5                	mov    %esp,%ebp
+  8013e2:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8013e5:	68 57 26 80 00       	push   $0x802657
+  8013ea:	ff 75 0c             	push   0xc(%ebp)
+  8013ed:	e8 ef 07 00 00       	call   801be1 <strcpy>
+	return 0;
+}
+  8013f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013f7:	c9                   	leave
+  8013f8:	c3                   	ret
+
+008013f9 <devcons_write>:
+{
+  8013f9:	55                   	push   %ebp
+  8013fa:	89 e5                	mov    %esp,%ebp
+  8013fc:	57                   	push   %edi
+  8013fd:	56                   	push   %esi
+  8013fe:	53                   	push   %ebx
+  8013ff:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  801405:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80140a:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  801410:	eb 2e                	jmp    801440 <devcons_write+0x47>
+		m = n - tot;
+  801412:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801415:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  801417:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80141c:	39 c3                	cmp    %eax,%ebx
+  80141e:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  801421:	83 ec 04             	sub    $0x4,%esp
+  801424:	53                   	push   %ebx
+  801425:	89 f0                	mov    %esi,%eax
+  801427:	03 45 0c             	add    0xc(%ebp),%eax
+  80142a:	50                   	push   %eax
+  80142b:	57                   	push   %edi
+  80142c:	e8 36 09 00 00       	call   801d67 <memmove>
+		sys_cputs(buf, m);
+  801431:	83 c4 08             	add    $0x8,%esp
+  801434:	53                   	push   %ebx
+  801435:	57                   	push   %edi
+  801436:	e8 72 ec ff ff       	call   8000ad <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80143b:	01 de                	add    %ebx,%esi
+  80143d:	83 c4 10             	add    $0x10,%esp
+  801440:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801443:	72 cd                	jb     801412 <devcons_write+0x19>
+}
+  801445:	89 f0                	mov    %esi,%eax
+  801447:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80144a:	5b                   	pop    %ebx
+  80144b:	5e                   	pop    %esi
+  80144c:	5f                   	pop    %edi
+  80144d:	5d                   	pop    %ebp
+  80144e:	c3                   	ret
+
+0080144f <devcons_read>:
+{
+  80144f:	55                   	push   %ebp
+  801450:	89 e5                	mov    %esp,%ebp
+  801452:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  801455:	b8 00 00 00 00       	mov    $0x0,%eax
+  80145a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80145e:	75 07                	jne    801467 <devcons_read+0x18>
+  801460:	eb 1f                	jmp    801481 <devcons_read+0x32>
+		sys_yield();
+  801462:	e8 e3 ec ff ff       	call   80014a <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  801467:	e8 5f ec ff ff       	call   8000cb <sys_cgetc>
+  80146c:	85 c0                	test   %eax,%eax
+  80146e:	74 f2                	je     801462 <devcons_read+0x13>
+	if (c < 0)
+  801470:	78 0f                	js     801481 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  801472:	83 f8 04             	cmp    $0x4,%eax
+  801475:	74 0c                	je     801483 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  801477:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80147a:	88 02                	mov    %al,(%edx)
+	return 1;
+  80147c:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  801481:	c9                   	leave
+  801482:	c3                   	ret
+		return 0;
+  801483:	b8 00 00 00 00       	mov    $0x0,%eax
+  801488:	eb f7                	jmp    801481 <devcons_read+0x32>
+
+0080148a <cputchar>:
+{
+  80148a:	55                   	push   %ebp
+  80148b:	89 e5                	mov    %esp,%ebp
+  80148d:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  801490:	8b 45 08             	mov    0x8(%ebp),%eax
+  801493:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  801496:	6a 01                	push   $0x1
+  801498:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80149b:	50                   	push   %eax
+  80149c:	e8 0c ec ff ff       	call   8000ad <sys_cputs>
+}
+  8014a1:	83 c4 10             	add    $0x10,%esp
+  8014a4:	c9                   	leave
+  8014a5:	c3                   	ret
+
+008014a6 <getchar>:
+{
+  8014a6:	55                   	push   %ebp
+  8014a7:	89 e5                	mov    %esp,%ebp
+  8014a9:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8014ac:	6a 01                	push   $0x1
+  8014ae:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8014b1:	50                   	push   %eax
+  8014b2:	6a 00                	push   $0x0
+  8014b4:	e8 66 f2 ff ff       	call   80071f <read>
+	if (r < 0)
+  8014b9:	83 c4 10             	add    $0x10,%esp
+  8014bc:	85 c0                	test   %eax,%eax
+  8014be:	78 06                	js     8014c6 <getchar+0x20>
+	if (r < 1)
+  8014c0:	74 06                	je     8014c8 <getchar+0x22>
+	return c;
+  8014c2:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8014c6:	c9                   	leave
+  8014c7:	c3                   	ret
+		return -E_EOF;
+  8014c8:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8014cd:	eb f7                	jmp    8014c6 <getchar+0x20>
+
+008014cf <iscons>:
+{
+  8014cf:	55                   	push   %ebp
+  8014d0:	89 e5                	mov    %esp,%ebp
+  8014d2:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8014d5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014d8:	50                   	push   %eax
+  8014d9:	ff 75 08             	push   0x8(%ebp)
+  8014dc:	e8 d8 ef ff ff       	call   8004b9 <fd_lookup>
+  8014e1:	83 c4 10             	add    $0x10,%esp
+  8014e4:	85 c0                	test   %eax,%eax
+  8014e6:	78 11                	js     8014f9 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8014e8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014eb:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  8014f1:	39 10                	cmp    %edx,(%eax)
+  8014f3:	0f 94 c0             	sete   %al
+  8014f6:	0f b6 c0             	movzbl %al,%eax
+}
+  8014f9:	c9                   	leave
+  8014fa:	c3                   	ret
+
+008014fb <opencons>:
+{
+  8014fb:	55                   	push   %ebp
+  8014fc:	89 e5                	mov    %esp,%ebp
+  8014fe:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  801501:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801504:	50                   	push   %eax
+  801505:	e8 59 ef ff ff       	call   800463 <fd_alloc>
+  80150a:	83 c4 10             	add    $0x10,%esp
+  80150d:	85 c0                	test   %eax,%eax
+  80150f:	78 3a                	js     80154b <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  801511:	83 ec 04             	sub    $0x4,%esp
+  801514:	68 07 04 00 00       	push   $0x407
+  801519:	ff 75 f4             	push   -0xc(%ebp)
+  80151c:	6a 00                	push   $0x0
+  80151e:	e8 46 ec ff ff       	call   800169 <sys_page_alloc>
+  801523:	83 c4 10             	add    $0x10,%esp
+  801526:	85 c0                	test   %eax,%eax
+  801528:	78 21                	js     80154b <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80152a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80152d:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  801533:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  801535:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801538:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80153f:	83 ec 0c             	sub    $0xc,%esp
+  801542:	50                   	push   %eax
+  801543:	e8 f4 ee ff ff       	call   80043c <fd2num>
+  801548:	83 c4 10             	add    $0x10,%esp
+}
+  80154b:	c9                   	leave
+  80154c:	c3                   	ret
+
+0080154d <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80154d:	55                   	push   %ebp
+  80154e:	89 e5                	mov    %esp,%ebp
+  801550:	56                   	push   %esi
+  801551:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  801552:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  801555:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  80155b:	e8 cb eb ff ff       	call   80012b <sys_getenvid>
+  801560:	83 ec 0c             	sub    $0xc,%esp
+  801563:	ff 75 0c             	push   0xc(%ebp)
+  801566:	ff 75 08             	push   0x8(%ebp)
+  801569:	56                   	push   %esi
+  80156a:	50                   	push   %eax
+  80156b:	68 64 26 80 00       	push   $0x802664
+  801570:	e8 b3 00 00 00       	call   801628 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  801575:	83 c4 18             	add    $0x18,%esp
+  801578:	53                   	push   %ebx
+  801579:	ff 75 10             	push   0x10(%ebp)
+  80157c:	e8 56 00 00 00       	call   8015d7 <vcprintf>
+	cprintf("\n");
+  801581:	c7 04 24 50 26 80 00 	movl   $0x802650,(%esp)
+  801588:	e8 9b 00 00 00       	call   801628 <cprintf>
+  80158d:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  801590:	cc                   	int3
+	while (1)
+  801591:	eb fd                	jmp    801590 <_panic+0x43>
+
+00801593 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  801593:	55                   	push   %ebp
+  801594:	89 e5                	mov    %esp,%ebp
+  801596:	53                   	push   %ebx
+  801597:	83 ec 04             	sub    $0x4,%esp
+  80159a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80159d:	8b 13                	mov    (%ebx),%edx
+  80159f:	8d 42 01             	lea    0x1(%edx),%eax
+  8015a2:	89 03                	mov    %eax,(%ebx)
+  8015a4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8015a7:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8015ab:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8015b0:	74 09                	je     8015bb <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8015b2:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8015b6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015b9:	c9                   	leave
+  8015ba:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8015bb:	83 ec 08             	sub    $0x8,%esp
+  8015be:	68 ff 00 00 00       	push   $0xff
+  8015c3:	8d 43 08             	lea    0x8(%ebx),%eax
+  8015c6:	50                   	push   %eax
+  8015c7:	e8 e1 ea ff ff       	call   8000ad <sys_cputs>
+		b->idx = 0;
+  8015cc:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8015d2:	83 c4 10             	add    $0x10,%esp
+  8015d5:	eb db                	jmp    8015b2 <putch+0x1f>
+
+008015d7 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8015d7:	55                   	push   %ebp
+  8015d8:	89 e5                	mov    %esp,%ebp
+  8015da:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8015e0:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8015e7:	00 00 00 
+	b.cnt = 0;
+  8015ea:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8015f1:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8015f4:	ff 75 0c             	push   0xc(%ebp)
+  8015f7:	ff 75 08             	push   0x8(%ebp)
+  8015fa:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  801600:	50                   	push   %eax
+  801601:	68 93 15 80 00       	push   $0x801593
+  801606:	e8 14 01 00 00       	call   80171f <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80160b:	83 c4 08             	add    $0x8,%esp
+  80160e:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  801614:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80161a:	50                   	push   %eax
+  80161b:	e8 8d ea ff ff       	call   8000ad <sys_cputs>
+
+	return b.cnt;
+}
+  801620:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  801626:	c9                   	leave
+  801627:	c3                   	ret
+
+00801628 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  801628:	55                   	push   %ebp
+  801629:	89 e5                	mov    %esp,%ebp
+  80162b:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80162e:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  801631:	50                   	push   %eax
+  801632:	ff 75 08             	push   0x8(%ebp)
+  801635:	e8 9d ff ff ff       	call   8015d7 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80163a:	c9                   	leave
+  80163b:	c3                   	ret
+
+0080163c <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80163c:	55                   	push   %ebp
+  80163d:	89 e5                	mov    %esp,%ebp
+  80163f:	57                   	push   %edi
+  801640:	56                   	push   %esi
+  801641:	53                   	push   %ebx
+  801642:	83 ec 1c             	sub    $0x1c,%esp
+  801645:	89 c7                	mov    %eax,%edi
+  801647:	89 d6                	mov    %edx,%esi
+  801649:	8b 45 08             	mov    0x8(%ebp),%eax
+  80164c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80164f:	89 d1                	mov    %edx,%ecx
+  801651:	89 c2                	mov    %eax,%edx
+  801653:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801656:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801659:	8b 45 10             	mov    0x10(%ebp),%eax
+  80165c:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80165f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801662:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801669:	39 c2                	cmp    %eax,%edx
+  80166b:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80166e:	72 3e                	jb     8016ae <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  801670:	83 ec 0c             	sub    $0xc,%esp
+  801673:	ff 75 18             	push   0x18(%ebp)
+  801676:	83 eb 01             	sub    $0x1,%ebx
+  801679:	53                   	push   %ebx
+  80167a:	50                   	push   %eax
+  80167b:	83 ec 08             	sub    $0x8,%esp
+  80167e:	ff 75 e4             	push   -0x1c(%ebp)
+  801681:	ff 75 e0             	push   -0x20(%ebp)
+  801684:	ff 75 dc             	push   -0x24(%ebp)
+  801687:	ff 75 d8             	push   -0x28(%ebp)
+  80168a:	e8 e1 0a 00 00       	call   802170 <__udivdi3>
+  80168f:	83 c4 18             	add    $0x18,%esp
+  801692:	52                   	push   %edx
+  801693:	50                   	push   %eax
+  801694:	89 f2                	mov    %esi,%edx
+  801696:	89 f8                	mov    %edi,%eax
+  801698:	e8 9f ff ff ff       	call   80163c <printnum>
+  80169d:	83 c4 20             	add    $0x20,%esp
+  8016a0:	eb 13                	jmp    8016b5 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8016a2:	83 ec 08             	sub    $0x8,%esp
+  8016a5:	56                   	push   %esi
+  8016a6:	ff 75 18             	push   0x18(%ebp)
+  8016a9:	ff d7                	call   *%edi
+  8016ab:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8016ae:	83 eb 01             	sub    $0x1,%ebx
+  8016b1:	85 db                	test   %ebx,%ebx
+  8016b3:	7f ed                	jg     8016a2 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8016b5:	83 ec 08             	sub    $0x8,%esp
+  8016b8:	56                   	push   %esi
+  8016b9:	83 ec 04             	sub    $0x4,%esp
+  8016bc:	ff 75 e4             	push   -0x1c(%ebp)
+  8016bf:	ff 75 e0             	push   -0x20(%ebp)
+  8016c2:	ff 75 dc             	push   -0x24(%ebp)
+  8016c5:	ff 75 d8             	push   -0x28(%ebp)
+  8016c8:	e8 73 0b 00 00       	call   802240 <__umoddi3>
+  8016cd:	83 c4 14             	add    $0x14,%esp
+  8016d0:	0f be 80 87 26 80 00 	movsbl 0x802687(%eax),%eax
+  8016d7:	50                   	push   %eax
+  8016d8:	ff d7                	call   *%edi
+}
+  8016da:	83 c4 10             	add    $0x10,%esp
+  8016dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016e0:	5b                   	pop    %ebx
+  8016e1:	5e                   	pop    %esi
+  8016e2:	5f                   	pop    %edi
+  8016e3:	5d                   	pop    %ebp
+  8016e4:	c3                   	ret
+
+008016e5 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8016e5:	55                   	push   %ebp
+  8016e6:	89 e5                	mov    %esp,%ebp
+  8016e8:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8016eb:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8016ef:	8b 10                	mov    (%eax),%edx
+  8016f1:	3b 50 04             	cmp    0x4(%eax),%edx
+  8016f4:	73 0a                	jae    801700 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8016f6:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8016f9:	89 08                	mov    %ecx,(%eax)
+  8016fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016fe:	88 02                	mov    %al,(%edx)
+}
+  801700:	5d                   	pop    %ebp
+  801701:	c3                   	ret
+
+00801702 <printfmt>:
+{
+  801702:	55                   	push   %ebp
+  801703:	89 e5                	mov    %esp,%ebp
+  801705:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  801708:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80170b:	50                   	push   %eax
+  80170c:	ff 75 10             	push   0x10(%ebp)
+  80170f:	ff 75 0c             	push   0xc(%ebp)
+  801712:	ff 75 08             	push   0x8(%ebp)
+  801715:	e8 05 00 00 00       	call   80171f <vprintfmt>
+}
+  80171a:	83 c4 10             	add    $0x10,%esp
+  80171d:	c9                   	leave
+  80171e:	c3                   	ret
+
+0080171f <vprintfmt>:
+{
+  80171f:	55                   	push   %ebp
+  801720:	89 e5                	mov    %esp,%ebp
+  801722:	57                   	push   %edi
+  801723:	56                   	push   %esi
+  801724:	53                   	push   %ebx
+  801725:	83 ec 2c             	sub    $0x2c,%esp
+  801728:	8b 75 08             	mov    0x8(%ebp),%esi
+  80172b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80172e:	8b 7d 10             	mov    0x10(%ebp),%edi
+  801731:	eb 0a                	jmp    80173d <vprintfmt+0x1e>
+			putch(ch, putdat);
+  801733:	83 ec 08             	sub    $0x8,%esp
+  801736:	53                   	push   %ebx
+  801737:	50                   	push   %eax
+  801738:	ff d6                	call   *%esi
+  80173a:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80173d:	83 c7 01             	add    $0x1,%edi
+  801740:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  801744:	83 f8 25             	cmp    $0x25,%eax
+  801747:	74 0c                	je     801755 <vprintfmt+0x36>
+			if (ch == '\0')
+  801749:	85 c0                	test   %eax,%eax
+  80174b:	75 e6                	jne    801733 <vprintfmt+0x14>
+}
+  80174d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801750:	5b                   	pop    %ebx
+  801751:	5e                   	pop    %esi
+  801752:	5f                   	pop    %edi
+  801753:	5d                   	pop    %ebp
+  801754:	c3                   	ret
+		padc = ' ';
+  801755:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  801759:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  801760:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  801767:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80176e:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801773:	8d 47 01             	lea    0x1(%edi),%eax
+  801776:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801779:	0f b6 17             	movzbl (%edi),%edx
+  80177c:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80177f:	3c 55                	cmp    $0x55,%al
+  801781:	0f 87 9a 03 00 00    	ja     801b21 <vprintfmt+0x402>
+  801787:	0f b6 c0             	movzbl %al,%eax
+  80178a:	ff 24 85 c0 27 80 00 	jmp    *0x8027c0(,%eax,4)
+  801791:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  801794:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  801798:	eb d9                	jmp    801773 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80179a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80179d:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8017a1:	eb d0                	jmp    801773 <vprintfmt+0x54>
+  8017a3:	0f b6 d2             	movzbl %dl,%edx
+  8017a6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8017a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017ae:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8017b1:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8017b4:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8017b8:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8017bb:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8017be:	83 f9 09             	cmp    $0x9,%ecx
+  8017c1:	77 55                	ja     801818 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8017c3:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8017c6:	eb e9                	jmp    8017b1 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8017c8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8017cb:	8b 00                	mov    (%eax),%eax
+  8017cd:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8017d0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8017d3:	8d 40 04             	lea    0x4(%eax),%eax
+  8017d6:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8017d9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8017dc:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8017e0:	79 91                	jns    801773 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8017e2:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8017e5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8017e8:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8017ef:	eb 82                	jmp    801773 <vprintfmt+0x54>
+			if (width < 0)
+  8017f1:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8017f4:	85 d2                	test   %edx,%edx
+  8017f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017fb:	0f 49 c2             	cmovns %edx,%eax
+  8017fe:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  801801:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  801804:	e9 6a ff ff ff       	jmp    801773 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  801809:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80180c:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  801813:	e9 5b ff ff ff       	jmp    801773 <vprintfmt+0x54>
+  801818:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80181b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80181e:	eb bc                	jmp    8017dc <vprintfmt+0xbd>
+			lflag++;
+  801820:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801823:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  801826:	e9 48 ff ff ff       	jmp    801773 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80182b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80182e:	8d 78 04             	lea    0x4(%eax),%edi
+  801831:	83 ec 08             	sub    $0x8,%esp
+  801834:	53                   	push   %ebx
+  801835:	ff 30                	push   (%eax)
+  801837:	ff d6                	call   *%esi
+			break;
+  801839:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80183c:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80183f:	e9 7c 02 00 00       	jmp    801ac0 <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  801844:	8b 45 14             	mov    0x14(%ebp),%eax
+  801847:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80184a:	8b 10                	mov    (%eax),%edx
+  80184c:	89 d0                	mov    %edx,%eax
+  80184e:	f7 d8                	neg    %eax
+  801850:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  801853:	83 f8 10             	cmp    $0x10,%eax
+  801856:	7f 23                	jg     80187b <vprintfmt+0x15c>
+  801858:	8b 14 85 20 29 80 00 	mov    0x802920(,%eax,4),%edx
+  80185f:	85 d2                	test   %edx,%edx
+  801861:	74 18                	je     80187b <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  801863:	52                   	push   %edx
+  801864:	68 e5 25 80 00       	push   $0x8025e5
+  801869:	53                   	push   %ebx
+  80186a:	56                   	push   %esi
+  80186b:	e8 92 fe ff ff       	call   801702 <printfmt>
+  801870:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801873:	89 7d 14             	mov    %edi,0x14(%ebp)
+  801876:	e9 45 02 00 00       	jmp    801ac0 <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  80187b:	50                   	push   %eax
+  80187c:	68 9f 26 80 00       	push   $0x80269f
+  801881:	53                   	push   %ebx
+  801882:	56                   	push   %esi
+  801883:	e8 7a fe ff ff       	call   801702 <printfmt>
+  801888:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80188b:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80188e:	e9 2d 02 00 00       	jmp    801ac0 <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801893:	8b 45 14             	mov    0x14(%ebp),%eax
+  801896:	83 c0 04             	add    $0x4,%eax
+  801899:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80189c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80189f:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8018a1:	85 c9                	test   %ecx,%ecx
+  8018a3:	b8 98 26 80 00       	mov    $0x802698,%eax
+  8018a8:	0f 45 c1             	cmovne %ecx,%eax
+  8018ab:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8018ae:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8018b2:	7e 06                	jle    8018ba <vprintfmt+0x19b>
+  8018b4:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8018b8:	75 0b                	jne    8018c5 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8018ba:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8018bd:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8018c0:	89 75 08             	mov    %esi,0x8(%ebp)
+  8018c3:	eb 5c                	jmp    801921 <vprintfmt+0x202>
+  8018c5:	83 ec 08             	sub    $0x8,%esp
+  8018c8:	ff 75 d0             	push   -0x30(%ebp)
+  8018cb:	ff 75 cc             	push   -0x34(%ebp)
+  8018ce:	e8 eb 02 00 00       	call   801bbe <strnlen>
+  8018d3:	89 c2                	mov    %eax,%edx
+  8018d5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8018d8:	29 d0                	sub    %edx,%eax
+  8018da:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8018dd:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8018e1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8018e4:	89 75 08             	mov    %esi,0x8(%ebp)
+  8018e7:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8018e9:	eb 0e                	jmp    8018f9 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8018eb:	83 ec 08             	sub    $0x8,%esp
+  8018ee:	53                   	push   %ebx
+  8018ef:	57                   	push   %edi
+  8018f0:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8018f3:	83 ee 01             	sub    $0x1,%esi
+  8018f6:	83 c4 10             	add    $0x10,%esp
+  8018f9:	85 f6                	test   %esi,%esi
+  8018fb:	7f ee                	jg     8018eb <vprintfmt+0x1cc>
+  8018fd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801900:	8b 75 08             	mov    0x8(%ebp),%esi
+  801903:	85 c0                	test   %eax,%eax
+  801905:	ba 00 00 00 00       	mov    $0x0,%edx
+  80190a:	0f 49 d0             	cmovns %eax,%edx
+  80190d:	29 d0                	sub    %edx,%eax
+  80190f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801912:	eb a6                	jmp    8018ba <vprintfmt+0x19b>
+					putch(ch, putdat);
+  801914:	83 ec 08             	sub    $0x8,%esp
+  801917:	53                   	push   %ebx
+  801918:	52                   	push   %edx
+  801919:	ff 55 08             	call   *0x8(%ebp)
+  80191c:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80191f:	89 f1                	mov    %esi,%ecx
+  801921:	8d 71 01             	lea    0x1(%ecx),%esi
+  801924:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  801928:	0f be d0             	movsbl %al,%edx
+  80192b:	85 d2                	test   %edx,%edx
+  80192d:	74 28                	je     801957 <vprintfmt+0x238>
+  80192f:	85 ff                	test   %edi,%edi
+  801931:	78 05                	js     801938 <vprintfmt+0x219>
+  801933:	83 ef 01             	sub    $0x1,%edi
+  801936:	78 30                	js     801968 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  801938:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80193c:	74 d6                	je     801914 <vprintfmt+0x1f5>
+  80193e:	0f be c0             	movsbl %al,%eax
+  801941:	83 e8 20             	sub    $0x20,%eax
+  801944:	83 f8 5e             	cmp    $0x5e,%eax
+  801947:	76 cb                	jbe    801914 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  801949:	83 ec 08             	sub    $0x8,%esp
+  80194c:	53                   	push   %ebx
+  80194d:	6a 3f                	push   $0x3f
+  80194f:	ff 55 08             	call   *0x8(%ebp)
+  801952:	83 c4 10             	add    $0x10,%esp
+  801955:	eb c8                	jmp    80191f <vprintfmt+0x200>
+  801957:	8b 75 08             	mov    0x8(%ebp),%esi
+  80195a:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80195d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801960:	01 d0                	add    %edx,%eax
+  801962:	29 c8                	sub    %ecx,%eax
+  801964:	89 c7                	mov    %eax,%edi
+  801966:	eb 13                	jmp    80197b <vprintfmt+0x25c>
+  801968:	8b 75 08             	mov    0x8(%ebp),%esi
+  80196b:	eb ed                	jmp    80195a <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80196d:	83 ec 08             	sub    $0x8,%esp
+  801970:	53                   	push   %ebx
+  801971:	6a 20                	push   $0x20
+  801973:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  801975:	83 ef 01             	sub    $0x1,%edi
+  801978:	83 c4 10             	add    $0x10,%esp
+  80197b:	85 ff                	test   %edi,%edi
+  80197d:	7f ee                	jg     80196d <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80197f:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  801982:	89 45 14             	mov    %eax,0x14(%ebp)
+  801985:	e9 36 01 00 00       	jmp    801ac0 <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  80198a:	83 f9 01             	cmp    $0x1,%ecx
+  80198d:	7f 1f                	jg     8019ae <vprintfmt+0x28f>
+	else if (lflag)
+  80198f:	85 c9                	test   %ecx,%ecx
+  801991:	74 67                	je     8019fa <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  801993:	8b 45 14             	mov    0x14(%ebp),%eax
+  801996:	8b 00                	mov    (%eax),%eax
+  801998:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80199b:	89 c1                	mov    %eax,%ecx
+  80199d:	c1 f9 1f             	sar    $0x1f,%ecx
+  8019a0:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8019a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019a6:	8d 40 04             	lea    0x4(%eax),%eax
+  8019a9:	89 45 14             	mov    %eax,0x14(%ebp)
+  8019ac:	eb 17                	jmp    8019c5 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8019ae:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019b1:	8b 50 04             	mov    0x4(%eax),%edx
+  8019b4:	8b 00                	mov    (%eax),%eax
+  8019b6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8019b9:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8019bc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019bf:	8d 40 08             	lea    0x8(%eax),%eax
+  8019c2:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8019c5:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8019c8:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8019cb:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8019d0:	85 c9                	test   %ecx,%ecx
+  8019d2:	0f 89 ce 00 00 00    	jns    801aa6 <vprintfmt+0x387>
+				putch('-', putdat);
+  8019d8:	83 ec 08             	sub    $0x8,%esp
+  8019db:	53                   	push   %ebx
+  8019dc:	6a 2d                	push   $0x2d
+  8019de:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8019e0:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8019e3:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8019e6:	f7 da                	neg    %edx
+  8019e8:	83 d1 00             	adc    $0x0,%ecx
+  8019eb:	f7 d9                	neg    %ecx
+  8019ed:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8019f0:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8019f5:	e9 ac 00 00 00       	jmp    801aa6 <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  8019fa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019fd:	8b 00                	mov    (%eax),%eax
+  8019ff:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801a02:	89 c1                	mov    %eax,%ecx
+  801a04:	c1 f9 1f             	sar    $0x1f,%ecx
+  801a07:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801a0a:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a0d:	8d 40 04             	lea    0x4(%eax),%eax
+  801a10:	89 45 14             	mov    %eax,0x14(%ebp)
+  801a13:	eb b0                	jmp    8019c5 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  801a15:	83 f9 01             	cmp    $0x1,%ecx
+  801a18:	7f 1b                	jg     801a35 <vprintfmt+0x316>
+	else if (lflag)
+  801a1a:	85 c9                	test   %ecx,%ecx
+  801a1c:	74 2c                	je     801a4a <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  801a1e:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a21:	8b 10                	mov    (%eax),%edx
+  801a23:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a28:	8d 40 04             	lea    0x4(%eax),%eax
+  801a2b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801a2e:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  801a33:	eb 71                	jmp    801aa6 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  801a35:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a38:	8b 10                	mov    (%eax),%edx
+  801a3a:	8b 48 04             	mov    0x4(%eax),%ecx
+  801a3d:	8d 40 08             	lea    0x8(%eax),%eax
+  801a40:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801a43:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  801a48:	eb 5c                	jmp    801aa6 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  801a4a:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a4d:	8b 10                	mov    (%eax),%edx
+  801a4f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a54:	8d 40 04             	lea    0x4(%eax),%eax
+  801a57:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801a5a:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  801a5f:	eb 45                	jmp    801aa6 <vprintfmt+0x387>
+			putch('X', putdat);
+  801a61:	83 ec 08             	sub    $0x8,%esp
+  801a64:	53                   	push   %ebx
+  801a65:	6a 58                	push   $0x58
+  801a67:	ff d6                	call   *%esi
+			putch('X', putdat);
+  801a69:	83 c4 08             	add    $0x8,%esp
+  801a6c:	53                   	push   %ebx
+  801a6d:	6a 58                	push   $0x58
+  801a6f:	ff d6                	call   *%esi
+			putch('X', putdat);
+  801a71:	83 c4 08             	add    $0x8,%esp
+  801a74:	53                   	push   %ebx
+  801a75:	6a 58                	push   $0x58
+  801a77:	ff d6                	call   *%esi
+			break;
+  801a79:	83 c4 10             	add    $0x10,%esp
+  801a7c:	eb 42                	jmp    801ac0 <vprintfmt+0x3a1>
+			putch('0', putdat);
+  801a7e:	83 ec 08             	sub    $0x8,%esp
+  801a81:	53                   	push   %ebx
+  801a82:	6a 30                	push   $0x30
+  801a84:	ff d6                	call   *%esi
+			putch('x', putdat);
+  801a86:	83 c4 08             	add    $0x8,%esp
+  801a89:	53                   	push   %ebx
+  801a8a:	6a 78                	push   $0x78
+  801a8c:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  801a8e:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a91:	8b 10                	mov    (%eax),%edx
+  801a93:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  801a98:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  801a9b:	8d 40 04             	lea    0x4(%eax),%eax
+  801a9e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801aa1:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  801aa6:	83 ec 0c             	sub    $0xc,%esp
+  801aa9:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  801aad:	50                   	push   %eax
+  801aae:	ff 75 e0             	push   -0x20(%ebp)
+  801ab1:	57                   	push   %edi
+  801ab2:	51                   	push   %ecx
+  801ab3:	52                   	push   %edx
+  801ab4:	89 da                	mov    %ebx,%edx
+  801ab6:	89 f0                	mov    %esi,%eax
+  801ab8:	e8 7f fb ff ff       	call   80163c <printnum>
+			break;
+  801abd:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  801ac0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801ac3:	e9 75 fc ff ff       	jmp    80173d <vprintfmt+0x1e>
+	if (lflag >= 2)
+  801ac8:	83 f9 01             	cmp    $0x1,%ecx
+  801acb:	7f 1b                	jg     801ae8 <vprintfmt+0x3c9>
+	else if (lflag)
+  801acd:	85 c9                	test   %ecx,%ecx
+  801acf:	74 2c                	je     801afd <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  801ad1:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ad4:	8b 10                	mov    (%eax),%edx
+  801ad6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801adb:	8d 40 04             	lea    0x4(%eax),%eax
+  801ade:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801ae1:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  801ae6:	eb be                	jmp    801aa6 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  801ae8:	8b 45 14             	mov    0x14(%ebp),%eax
+  801aeb:	8b 10                	mov    (%eax),%edx
+  801aed:	8b 48 04             	mov    0x4(%eax),%ecx
+  801af0:	8d 40 08             	lea    0x8(%eax),%eax
+  801af3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801af6:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  801afb:	eb a9                	jmp    801aa6 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  801afd:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b00:	8b 10                	mov    (%eax),%edx
+  801b02:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b07:	8d 40 04             	lea    0x4(%eax),%eax
+  801b0a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801b0d:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  801b12:	eb 92                	jmp    801aa6 <vprintfmt+0x387>
+			putch(ch, putdat);
+  801b14:	83 ec 08             	sub    $0x8,%esp
+  801b17:	53                   	push   %ebx
+  801b18:	6a 25                	push   $0x25
+  801b1a:	ff d6                	call   *%esi
+			break;
+  801b1c:	83 c4 10             	add    $0x10,%esp
+  801b1f:	eb 9f                	jmp    801ac0 <vprintfmt+0x3a1>
+			putch('%', putdat);
+  801b21:	83 ec 08             	sub    $0x8,%esp
+  801b24:	53                   	push   %ebx
+  801b25:	6a 25                	push   $0x25
+  801b27:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801b29:	83 c4 10             	add    $0x10,%esp
+  801b2c:	89 f8                	mov    %edi,%eax
+  801b2e:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  801b32:	74 05                	je     801b39 <vprintfmt+0x41a>
+  801b34:	83 e8 01             	sub    $0x1,%eax
+  801b37:	eb f5                	jmp    801b2e <vprintfmt+0x40f>
+  801b39:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801b3c:	eb 82                	jmp    801ac0 <vprintfmt+0x3a1>
+
+00801b3e <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  801b3e:	55                   	push   %ebp
+  801b3f:	89 e5                	mov    %esp,%ebp
+  801b41:	83 ec 18             	sub    $0x18,%esp
+  801b44:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b47:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  801b4a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  801b4d:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  801b51:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  801b54:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  801b5b:	85 c0                	test   %eax,%eax
+  801b5d:	74 26                	je     801b85 <vsnprintf+0x47>
+  801b5f:	85 d2                	test   %edx,%edx
+  801b61:	7e 22                	jle    801b85 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  801b63:	ff 75 14             	push   0x14(%ebp)
+  801b66:	ff 75 10             	push   0x10(%ebp)
+  801b69:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  801b6c:	50                   	push   %eax
+  801b6d:	68 e5 16 80 00       	push   $0x8016e5
+  801b72:	e8 a8 fb ff ff       	call   80171f <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  801b77:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801b7a:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  801b7d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b80:	83 c4 10             	add    $0x10,%esp
+}
+  801b83:	c9                   	leave
+  801b84:	c3                   	ret
+		return -E_INVAL;
+  801b85:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b8a:	eb f7                	jmp    801b83 <vsnprintf+0x45>
+
+00801b8c <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801b8c:	55                   	push   %ebp
+  801b8d:	89 e5                	mov    %esp,%ebp
+  801b8f:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  801b92:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  801b95:	50                   	push   %eax
+  801b96:	ff 75 10             	push   0x10(%ebp)
+  801b99:	ff 75 0c             	push   0xc(%ebp)
+  801b9c:	ff 75 08             	push   0x8(%ebp)
+  801b9f:	e8 9a ff ff ff       	call   801b3e <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  801ba4:	c9                   	leave
+  801ba5:	c3                   	ret
+
+00801ba6 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  801ba6:	55                   	push   %ebp
+  801ba7:	89 e5                	mov    %esp,%ebp
+  801ba9:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  801bac:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bb1:	eb 03                	jmp    801bb6 <strlen+0x10>
+		n++;
+  801bb3:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  801bb6:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  801bba:	75 f7                	jne    801bb3 <strlen+0xd>
+	return n;
+}
+  801bbc:	5d                   	pop    %ebp
+  801bbd:	c3                   	ret
+
+00801bbe <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  801bbe:	55                   	push   %ebp
+  801bbf:	89 e5                	mov    %esp,%ebp
+  801bc1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801bc4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801bc7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bcc:	eb 03                	jmp    801bd1 <strnlen+0x13>
+		n++;
+  801bce:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801bd1:	39 d0                	cmp    %edx,%eax
+  801bd3:	74 08                	je     801bdd <strnlen+0x1f>
+  801bd5:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  801bd9:	75 f3                	jne    801bce <strnlen+0x10>
+  801bdb:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  801bdd:	89 d0                	mov    %edx,%eax
+  801bdf:	5d                   	pop    %ebp
+  801be0:	c3                   	ret
+
+00801be1 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801be1:	55                   	push   %ebp
+  801be2:	89 e5                	mov    %esp,%ebp
+  801be4:	53                   	push   %ebx
+  801be5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801be8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  801beb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bf0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  801bf4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  801bf7:	83 c0 01             	add    $0x1,%eax
+  801bfa:	84 d2                	test   %dl,%dl
+  801bfc:	75 f2                	jne    801bf0 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  801bfe:	89 c8                	mov    %ecx,%eax
+  801c00:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c03:	c9                   	leave
+  801c04:	c3                   	ret
+
+00801c05 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801c05:	55                   	push   %ebp
+  801c06:	89 e5                	mov    %esp,%ebp
+  801c08:	53                   	push   %ebx
+  801c09:	83 ec 10             	sub    $0x10,%esp
+  801c0c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  801c0f:	53                   	push   %ebx
+  801c10:	e8 91 ff ff ff       	call   801ba6 <strlen>
+  801c15:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  801c18:	ff 75 0c             	push   0xc(%ebp)
+  801c1b:	01 d8                	add    %ebx,%eax
+  801c1d:	50                   	push   %eax
+  801c1e:	e8 be ff ff ff       	call   801be1 <strcpy>
+	return dst;
+}
+  801c23:	89 d8                	mov    %ebx,%eax
+  801c25:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c28:	c9                   	leave
+  801c29:	c3                   	ret
+
+00801c2a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801c2a:	55                   	push   %ebp
+  801c2b:	89 e5                	mov    %esp,%ebp
+  801c2d:	56                   	push   %esi
+  801c2e:	53                   	push   %ebx
+  801c2f:	8b 75 08             	mov    0x8(%ebp),%esi
+  801c32:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  801c35:	89 f3                	mov    %esi,%ebx
+  801c37:	03 5d 10             	add    0x10(%ebp),%ebx
+  801c3a:	89 f0                	mov    %esi,%eax
+  801c3c:	eb 0f                	jmp    801c4d <strncpy+0x23>
+		*dst++ = *src;
+  801c3e:	83 c0 01             	add    $0x1,%eax
+  801c41:	0f b6 0a             	movzbl (%edx),%ecx
+  801c44:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  801c47:	80 f9 01             	cmp    $0x1,%cl
+  801c4a:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  801c4d:	39 d8                	cmp    %ebx,%eax
+  801c4f:	75 ed                	jne    801c3e <strncpy+0x14>
+	}
+	return ret;
+}
+  801c51:	89 f0                	mov    %esi,%eax
+  801c53:	5b                   	pop    %ebx
+  801c54:	5e                   	pop    %esi
+  801c55:	5d                   	pop    %ebp
+  801c56:	c3                   	ret
+
+00801c57 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801c57:	55                   	push   %ebp
+  801c58:	89 e5                	mov    %esp,%ebp
+  801c5a:	56                   	push   %esi
+  801c5b:	53                   	push   %ebx
+  801c5c:	8b 75 08             	mov    0x8(%ebp),%esi
+  801c5f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c62:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  801c65:	89 f0                	mov    %esi,%eax
+  801c67:	85 d2                	test   %edx,%edx
+  801c69:	74 21                	je     801c8c <strlcpy+0x35>
+  801c6b:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  801c6f:	89 f2                	mov    %esi,%edx
+  801c71:	eb 09                	jmp    801c7c <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  801c73:	83 c1 01             	add    $0x1,%ecx
+  801c76:	83 c2 01             	add    $0x1,%edx
+  801c79:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  801c7c:	39 c2                	cmp    %eax,%edx
+  801c7e:	74 09                	je     801c89 <strlcpy+0x32>
+  801c80:	0f b6 19             	movzbl (%ecx),%ebx
+  801c83:	84 db                	test   %bl,%bl
+  801c85:	75 ec                	jne    801c73 <strlcpy+0x1c>
+  801c87:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  801c89:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  801c8c:	29 f0                	sub    %esi,%eax
+}
+  801c8e:	5b                   	pop    %ebx
+  801c8f:	5e                   	pop    %esi
+  801c90:	5d                   	pop    %ebp
+  801c91:	c3                   	ret
+
+00801c92 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  801c92:	55                   	push   %ebp
+  801c93:	89 e5                	mov    %esp,%ebp
+  801c95:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801c98:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  801c9b:	eb 06                	jmp    801ca3 <strcmp+0x11>
+		p++, q++;
+  801c9d:	83 c1 01             	add    $0x1,%ecx
+  801ca0:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  801ca3:	0f b6 01             	movzbl (%ecx),%eax
+  801ca6:	84 c0                	test   %al,%al
+  801ca8:	74 04                	je     801cae <strcmp+0x1c>
+  801caa:	3a 02                	cmp    (%edx),%al
+  801cac:	74 ef                	je     801c9d <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801cae:	0f b6 c0             	movzbl %al,%eax
+  801cb1:	0f b6 12             	movzbl (%edx),%edx
+  801cb4:	29 d0                	sub    %edx,%eax
+}
+  801cb6:	5d                   	pop    %ebp
+  801cb7:	c3                   	ret
+
+00801cb8 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801cb8:	55                   	push   %ebp
+  801cb9:	89 e5                	mov    %esp,%ebp
+  801cbb:	53                   	push   %ebx
+  801cbc:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cbf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801cc2:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  801cc5:	eb 09                	jmp    801cd0 <strncmp+0x18>
+		n--, p++, q++;
+  801cc7:	83 ea 01             	sub    $0x1,%edx
+  801cca:	83 c0 01             	add    $0x1,%eax
+  801ccd:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  801cd0:	85 d2                	test   %edx,%edx
+  801cd2:	74 18                	je     801cec <strncmp+0x34>
+  801cd4:	0f b6 18             	movzbl (%eax),%ebx
+  801cd7:	84 db                	test   %bl,%bl
+  801cd9:	74 04                	je     801cdf <strncmp+0x27>
+  801cdb:	3a 19                	cmp    (%ecx),%bl
+  801cdd:	74 e8                	je     801cc7 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801cdf:	0f b6 00             	movzbl (%eax),%eax
+  801ce2:	0f b6 11             	movzbl (%ecx),%edx
+  801ce5:	29 d0                	sub    %edx,%eax
+}
+  801ce7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cea:	c9                   	leave
+  801ceb:	c3                   	ret
+		return 0;
+  801cec:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cf1:	eb f4                	jmp    801ce7 <strncmp+0x2f>
+
+00801cf3 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801cf3:	55                   	push   %ebp
+  801cf4:	89 e5                	mov    %esp,%ebp
+  801cf6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cf9:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801cfd:	eb 03                	jmp    801d02 <strchr+0xf>
+  801cff:	83 c0 01             	add    $0x1,%eax
+  801d02:	0f b6 10             	movzbl (%eax),%edx
+  801d05:	84 d2                	test   %dl,%dl
+  801d07:	74 06                	je     801d0f <strchr+0x1c>
+		if (*s == c)
+  801d09:	38 ca                	cmp    %cl,%dl
+  801d0b:	75 f2                	jne    801cff <strchr+0xc>
+  801d0d:	eb 05                	jmp    801d14 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  801d0f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d14:	5d                   	pop    %ebp
+  801d15:	c3                   	ret
+
+00801d16 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801d16:	55                   	push   %ebp
+  801d17:	89 e5                	mov    %esp,%ebp
+  801d19:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d1c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801d20:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  801d23:	38 ca                	cmp    %cl,%dl
+  801d25:	74 09                	je     801d30 <strfind+0x1a>
+  801d27:	84 d2                	test   %dl,%dl
+  801d29:	74 05                	je     801d30 <strfind+0x1a>
+	for (; *s; s++)
+  801d2b:	83 c0 01             	add    $0x1,%eax
+  801d2e:	eb f0                	jmp    801d20 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  801d30:	5d                   	pop    %ebp
+  801d31:	c3                   	ret
+
+00801d32 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801d32:	55                   	push   %ebp
+  801d33:	89 e5                	mov    %esp,%ebp
+  801d35:	57                   	push   %edi
+  801d36:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801d39:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  801d3c:	85 c9                	test   %ecx,%ecx
+  801d3e:	74 20                	je     801d60 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  801d40:	89 f8                	mov    %edi,%eax
+  801d42:	09 c8                	or     %ecx,%eax
+  801d44:	a8 03                	test   $0x3,%al
+  801d46:	75 12                	jne    801d5a <memset+0x28>
+		c &= 0xFF;
+  801d48:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  801d4c:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  801d52:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  801d55:	fc                   	cld
+  801d56:	f3 ab                	rep stos %eax,%es:(%edi)
+  801d58:	eb 06                	jmp    801d60 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801d5a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d5d:	fc                   	cld
+  801d5e:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  801d60:	89 f8                	mov    %edi,%eax
+  801d62:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  801d65:	c9                   	leave
+  801d66:	c3                   	ret
+
+00801d67 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801d67:	55                   	push   %ebp
+  801d68:	89 e5                	mov    %esp,%ebp
+  801d6a:	57                   	push   %edi
+  801d6b:	56                   	push   %esi
+  801d6c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d6f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801d72:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  801d75:	39 c6                	cmp    %eax,%esi
+  801d77:	73 32                	jae    801dab <memmove+0x44>
+  801d79:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  801d7c:	39 d0                	cmp    %edx,%eax
+  801d7e:	73 2b                	jae    801dab <memmove+0x44>
+		s += n;
+		d += n;
+  801d80:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801d83:	89 d6                	mov    %edx,%esi
+  801d85:	09 fe                	or     %edi,%esi
+  801d87:	09 ce                	or     %ecx,%esi
+  801d89:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  801d8f:	75 0e                	jne    801d9f <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801d91:	83 ef 04             	sub    $0x4,%edi
+  801d94:	8d 72 fc             	lea    -0x4(%edx),%esi
+  801d97:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  801d9a:	fd                   	std
+  801d9b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801d9d:	eb 09                	jmp    801da8 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801d9f:	83 ef 01             	sub    $0x1,%edi
+  801da2:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  801da5:	fd                   	std
+  801da6:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801da8:	fc                   	cld
+  801da9:	eb 1a                	jmp    801dc5 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801dab:	89 f2                	mov    %esi,%edx
+  801dad:	09 c2                	or     %eax,%edx
+  801daf:	09 ca                	or     %ecx,%edx
+  801db1:	f6 c2 03             	test   $0x3,%dl
+  801db4:	75 0a                	jne    801dc0 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801db6:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  801db9:	89 c7                	mov    %eax,%edi
+  801dbb:	fc                   	cld
+  801dbc:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801dbe:	eb 05                	jmp    801dc5 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  801dc0:	89 c7                	mov    %eax,%edi
+  801dc2:	fc                   	cld
+  801dc3:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  801dc5:	5e                   	pop    %esi
+  801dc6:	5f                   	pop    %edi
+  801dc7:	5d                   	pop    %ebp
+  801dc8:	c3                   	ret
+
+00801dc9 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801dc9:	55                   	push   %ebp
+  801dca:	89 e5                	mov    %esp,%ebp
+  801dcc:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  801dcf:	ff 75 10             	push   0x10(%ebp)
+  801dd2:	ff 75 0c             	push   0xc(%ebp)
+  801dd5:	ff 75 08             	push   0x8(%ebp)
+  801dd8:	e8 8a ff ff ff       	call   801d67 <memmove>
+}
+  801ddd:	c9                   	leave
+  801dde:	c3                   	ret
+
+00801ddf <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801ddf:	55                   	push   %ebp
+  801de0:	89 e5                	mov    %esp,%ebp
+  801de2:	56                   	push   %esi
+  801de3:	53                   	push   %ebx
+  801de4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801de7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  801dea:	89 c6                	mov    %eax,%esi
+  801dec:	03 75 10             	add    0x10(%ebp),%esi
+  801def:	eb 06                	jmp    801df7 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  801df1:	83 c0 01             	add    $0x1,%eax
+  801df4:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  801df7:	39 f0                	cmp    %esi,%eax
+  801df9:	74 14                	je     801e0f <memcmp+0x30>
+		if (*s1 != *s2)
+  801dfb:	0f b6 08             	movzbl (%eax),%ecx
+  801dfe:	0f b6 1a             	movzbl (%edx),%ebx
+  801e01:	38 d9                	cmp    %bl,%cl
+  801e03:	74 ec                	je     801df1 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  801e05:	0f b6 c1             	movzbl %cl,%eax
+  801e08:	0f b6 db             	movzbl %bl,%ebx
+  801e0b:	29 d8                	sub    %ebx,%eax
+  801e0d:	eb 05                	jmp    801e14 <memcmp+0x35>
+	}
+
+	return 0;
+  801e0f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e14:	5b                   	pop    %ebx
+  801e15:	5e                   	pop    %esi
+  801e16:	5d                   	pop    %ebp
+  801e17:	c3                   	ret
+
+00801e18 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801e18:	55                   	push   %ebp
+  801e19:	89 e5                	mov    %esp,%ebp
+  801e1b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e1e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  801e21:	89 c2                	mov    %eax,%edx
+  801e23:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  801e26:	eb 03                	jmp    801e2b <memfind+0x13>
+  801e28:	83 c0 01             	add    $0x1,%eax
+  801e2b:	39 d0                	cmp    %edx,%eax
+  801e2d:	73 04                	jae    801e33 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801e2f:	38 08                	cmp    %cl,(%eax)
+  801e31:	75 f5                	jne    801e28 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  801e33:	5d                   	pop    %ebp
+  801e34:	c3                   	ret
+
+00801e35 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  801e35:	55                   	push   %ebp
+  801e36:	89 e5                	mov    %esp,%ebp
+  801e38:	57                   	push   %edi
+  801e39:	56                   	push   %esi
+  801e3a:	53                   	push   %ebx
+  801e3b:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e3e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801e41:	eb 03                	jmp    801e46 <strtol+0x11>
+		s++;
+  801e43:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  801e46:	0f b6 02             	movzbl (%edx),%eax
+  801e49:	3c 20                	cmp    $0x20,%al
+  801e4b:	74 f6                	je     801e43 <strtol+0xe>
+  801e4d:	3c 09                	cmp    $0x9,%al
+  801e4f:	74 f2                	je     801e43 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  801e51:	3c 2b                	cmp    $0x2b,%al
+  801e53:	74 2a                	je     801e7f <strtol+0x4a>
+	int neg = 0;
+  801e55:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  801e5a:	3c 2d                	cmp    $0x2d,%al
+  801e5c:	74 2b                	je     801e89 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801e5e:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  801e64:	75 0f                	jne    801e75 <strtol+0x40>
+  801e66:	80 3a 30             	cmpb   $0x30,(%edx)
+  801e69:	74 28                	je     801e93 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  801e6b:	85 db                	test   %ebx,%ebx
+  801e6d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801e72:	0f 44 d8             	cmove  %eax,%ebx
+  801e75:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e7a:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  801e7d:	eb 46                	jmp    801ec5 <strtol+0x90>
+		s++;
+  801e7f:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  801e82:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e87:	eb d5                	jmp    801e5e <strtol+0x29>
+		s++, neg = 1;
+  801e89:	83 c2 01             	add    $0x1,%edx
+  801e8c:	bf 01 00 00 00       	mov    $0x1,%edi
+  801e91:	eb cb                	jmp    801e5e <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801e93:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  801e97:	74 0e                	je     801ea7 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  801e99:	85 db                	test   %ebx,%ebx
+  801e9b:	75 d8                	jne    801e75 <strtol+0x40>
+		s++, base = 8;
+  801e9d:	83 c2 01             	add    $0x1,%edx
+  801ea0:	bb 08 00 00 00       	mov    $0x8,%ebx
+  801ea5:	eb ce                	jmp    801e75 <strtol+0x40>
+		s += 2, base = 16;
+  801ea7:	83 c2 02             	add    $0x2,%edx
+  801eaa:	bb 10 00 00 00       	mov    $0x10,%ebx
+  801eaf:	eb c4                	jmp    801e75 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  801eb1:	0f be c0             	movsbl %al,%eax
+  801eb4:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  801eb7:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801eba:	7d 3a                	jge    801ef6 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  801ebc:	83 c2 01             	add    $0x1,%edx
+  801ebf:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  801ec3:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  801ec5:	0f b6 02             	movzbl (%edx),%eax
+  801ec8:	8d 70 d0             	lea    -0x30(%eax),%esi
+  801ecb:	89 f3                	mov    %esi,%ebx
+  801ecd:	80 fb 09             	cmp    $0x9,%bl
+  801ed0:	76 df                	jbe    801eb1 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  801ed2:	8d 70 9f             	lea    -0x61(%eax),%esi
+  801ed5:	89 f3                	mov    %esi,%ebx
+  801ed7:	80 fb 19             	cmp    $0x19,%bl
+  801eda:	77 08                	ja     801ee4 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  801edc:	0f be c0             	movsbl %al,%eax
+  801edf:	83 e8 57             	sub    $0x57,%eax
+  801ee2:	eb d3                	jmp    801eb7 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  801ee4:	8d 70 bf             	lea    -0x41(%eax),%esi
+  801ee7:	89 f3                	mov    %esi,%ebx
+  801ee9:	80 fb 19             	cmp    $0x19,%bl
+  801eec:	77 08                	ja     801ef6 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  801eee:	0f be c0             	movsbl %al,%eax
+  801ef1:	83 e8 37             	sub    $0x37,%eax
+  801ef4:	eb c1                	jmp    801eb7 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801ef6:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  801efa:	74 05                	je     801f01 <strtol+0xcc>
+		*endptr = (char *) s;
+  801efc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801eff:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  801f01:	89 c8                	mov    %ecx,%eax
+  801f03:	f7 d8                	neg    %eax
+  801f05:	85 ff                	test   %edi,%edi
+  801f07:	0f 45 c8             	cmovne %eax,%ecx
+}
+  801f0a:	89 c8                	mov    %ecx,%eax
+  801f0c:	5b                   	pop    %ebx
+  801f0d:	5e                   	pop    %esi
+  801f0e:	5f                   	pop    %edi
+  801f0f:	5d                   	pop    %ebp
+  801f10:	c3                   	ret
+
+00801f11 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  801f11:	55                   	push   %ebp
+  801f12:	89 e5                	mov    %esp,%ebp
+  801f14:	56                   	push   %esi
+  801f15:	53                   	push   %ebx
+  801f16:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f19:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f1c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  801f1f:	85 c0                	test   %eax,%eax
+  801f21:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801f26:	0f 44 c2             	cmove  %edx,%eax
+  801f29:	83 ec 0c             	sub    $0xc,%esp
+  801f2c:	50                   	push   %eax
+  801f2d:	e8 e7 e3 ff ff       	call   800319 <sys_ipc_recv>
+
+  if (from_env_store)
+  801f32:	83 c4 10             	add    $0x10,%esp
+  801f35:	85 f6                	test   %esi,%esi
+  801f37:	74 17                	je     801f50 <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  801f39:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f3e:	85 c0                	test   %eax,%eax
+  801f40:	75 0c                	jne    801f4e <ipc_recv+0x3d>
+  801f42:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801f48:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  801f4e:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  801f50:	85 db                	test   %ebx,%ebx
+  801f52:	74 2b                	je     801f7f <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  801f54:	85 c0                	test   %eax,%eax
+  801f56:	74 0d                	je     801f65 <ipc_recv+0x54>
+  801f58:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  801f5e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f61:	5b                   	pop    %ebx
+  801f62:	5e                   	pop    %esi
+  801f63:	5d                   	pop    %ebp
+  801f64:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  801f65:	a1 08 40 80 00       	mov    0x804008,%eax
+  801f6a:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  801f70:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  801f72:	a1 08 40 80 00       	mov    0x804008,%eax
+  801f77:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  801f7d:	eb df                	jmp    801f5e <ipc_recv+0x4d>
+  801f7f:	85 c0                	test   %eax,%eax
+  801f81:	75 db                	jne    801f5e <ipc_recv+0x4d>
+  801f83:	eb ed                	jmp    801f72 <ipc_recv+0x61>
+
+00801f85 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  801f85:	55                   	push   %ebp
+  801f86:	89 e5                	mov    %esp,%ebp
+  801f88:	57                   	push   %edi
+  801f89:	56                   	push   %esi
+  801f8a:	53                   	push   %ebx
+  801f8b:	83 ec 0c             	sub    $0xc,%esp
+  801f8e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801f91:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801f94:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  801f97:	85 db                	test   %ebx,%ebx
+  801f99:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801f9e:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  801fa1:	ff 75 14             	push   0x14(%ebp)
+  801fa4:	53                   	push   %ebx
+  801fa5:	56                   	push   %esi
+  801fa6:	57                   	push   %edi
+  801fa7:	e8 4a e3 ff ff       	call   8002f6 <sys_ipc_try_send>
+  801fac:	83 c4 10             	add    $0x10,%esp
+  801faf:	85 c0                	test   %eax,%eax
+  801fb1:	74 1e                	je     801fd1 <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  801fb3:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801fb6:	75 07                	jne    801fbf <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  801fb8:	e8 8d e1 ff ff       	call   80014a <sys_yield>
+  801fbd:	eb e2                	jmp    801fa1 <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  801fbf:	50                   	push   %eax
+  801fc0:	68 83 29 80 00       	push   $0x802983
+  801fc5:	6a 3c                	push   $0x3c
+  801fc7:	68 90 29 80 00       	push   $0x802990
+  801fcc:	e8 7c f5 ff ff       	call   80154d <_panic>
+  }
+
+#endif
+}
+  801fd1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fd4:	5b                   	pop    %ebx
+  801fd5:	5e                   	pop    %esi
+  801fd6:	5f                   	pop    %edi
+  801fd7:	5d                   	pop    %ebp
+  801fd8:	c3                   	ret
+
+00801fd9 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  801fd9:	55                   	push   %ebp
+  801fda:	89 e5                	mov    %esp,%ebp
+  801fdc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  801fdf:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  801fe4:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  801fe7:	c1 e0 04             	shl    $0x4,%eax
+  801fea:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801fef:	8b 40 50             	mov    0x50(%eax),%eax
+  801ff2:	39 c8                	cmp    %ecx,%eax
+  801ff4:	74 12                	je     802008 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  801ff6:	83 c2 01             	add    $0x1,%edx
+  801ff9:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  801fff:	75 e3                	jne    801fe4 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802001:	b8 00 00 00 00       	mov    $0x0,%eax
+  802006:	eb 0e                	jmp    802016 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  802008:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80200b:	c1 e0 04             	shl    $0x4,%eax
+  80200e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802013:	8b 40 48             	mov    0x48(%eax),%eax
+  802016:	5d                   	pop    %ebp
+  802017:	c3                   	ret
+
+00802018 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802018:	55                   	push   %ebp
+  802019:	89 e5                	mov    %esp,%ebp
+  80201b:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80201e:	89 c2                	mov    %eax,%edx
+  802020:	c1 ea 16             	shr    $0x16,%edx
+  802023:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80202a:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80202f:	f6 c1 01             	test   $0x1,%cl
+  802032:	74 1c                	je     802050 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  802034:	c1 e8 0c             	shr    $0xc,%eax
+  802037:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80203e:	a8 01                	test   $0x1,%al
+  802040:	74 0e                	je     802050 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802042:	c1 e8 0c             	shr    $0xc,%eax
+  802045:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  80204c:	ef 
+  80204d:	0f b7 d2             	movzwl %dx,%edx
+}
+  802050:	89 d0                	mov    %edx,%eax
+  802052:	5d                   	pop    %ebp
+  802053:	c3                   	ret
+  802054:	66 90                	xchg   %ax,%ax
+  802056:	66 90                	xchg   %ax,%ax
+  802058:	66 90                	xchg   %ax,%ax
+  80205a:	66 90                	xchg   %ax,%ax
+  80205c:	66 90                	xchg   %ax,%ax
+  80205e:	66 90                	xchg   %ax,%ax
+
+00802060 <__udivmoddi4>:
+  802060:	55                   	push   %ebp
+  802061:	57                   	push   %edi
+  802062:	56                   	push   %esi
+  802063:	53                   	push   %ebx
+  802064:	83 ec 24             	sub    $0x24,%esp
+  802067:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80206b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80206f:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  802073:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802077:	8b 54 24 44          	mov    0x44(%esp),%edx
+  80207b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80207f:	8b 44 24 40          	mov    0x40(%esp),%eax
+  802083:	89 d3                	mov    %edx,%ebx
+  802085:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802089:	09 c3                	or     %eax,%ebx
+  80208b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80208f:	0f 84 9c 00 00 00    	je     802131 <__udivmoddi4+0xd1>
+  802095:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80209c:	00 
+  80209d:	31 c0                	xor    %eax,%eax
+  80209f:	31 d2                	xor    %edx,%edx
+  8020a1:	89 fb                	mov    %edi,%ebx
+  8020a3:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8020aa:	00 
+  8020ab:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8020b0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8020b4:	01 c0                	add    %eax,%eax
+  8020b6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8020bd:	00 
+  8020be:	89 c6                	mov    %eax,%esi
+  8020c0:	89 d7                	mov    %edx,%edi
+  8020c2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8020c6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8020ca:	0f ad d0             	shrd   %cl,%edx,%eax
+  8020cd:	d3 ea                	shr    %cl,%edx
+  8020cf:	f6 c1 20             	test   $0x20,%cl
+  8020d2:	0f 45 c2             	cmovne %edx,%eax
+  8020d5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8020d9:	83 e0 01             	and    $0x1,%eax
+  8020dc:	09 fa                	or     %edi,%edx
+  8020de:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8020e2:	89 04 24             	mov    %eax,(%esp)
+  8020e5:	8b 04 24             	mov    (%esp),%eax
+  8020e8:	89 d5                	mov    %edx,%ebp
+  8020ea:	09 f0                	or     %esi,%eax
+  8020ec:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8020f0:	39 f0                	cmp    %esi,%eax
+  8020f2:	19 fd                	sbb    %edi,%ebp
+  8020f4:	72 1d                	jb     802113 <__udivmoddi4+0xb3>
+  8020f6:	29 f0                	sub    %esi,%eax
+  8020f8:	19 fa                	sbb    %edi,%edx
+  8020fa:	89 cf                	mov    %ecx,%edi
+  8020fc:	c1 ef 05             	shr    $0x5,%edi
+  8020ff:	83 e7 01             	and    $0x1,%edi
+  802102:	89 fe                	mov    %edi,%esi
+  802104:	d3 e7                	shl    %cl,%edi
+  802106:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80210a:	83 f6 01             	xor    $0x1,%esi
+  80210d:	d3 e6                	shl    %cl,%esi
+  80210f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802113:	83 e9 01             	sub    $0x1,%ecx
+  802116:	73 98                	jae    8020b0 <__udivmoddi4+0x50>
+  802118:	85 db                	test   %ebx,%ebx
+  80211a:	74 05                	je     802121 <__udivmoddi4+0xc1>
+  80211c:	89 03                	mov    %eax,(%ebx)
+  80211e:	89 53 04             	mov    %edx,0x4(%ebx)
+  802121:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802125:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802129:	83 c4 24             	add    $0x24,%esp
+  80212c:	5b                   	pop    %ebx
+  80212d:	5e                   	pop    %esi
+  80212e:	5f                   	pop    %edi
+  80212f:	5d                   	pop    %ebp
+  802130:	c3                   	ret
+  802131:	85 ff                	test   %edi,%edi
+  802133:	74 0d                	je     802142 <__udivmoddi4+0xe2>
+  802135:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  80213b:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  802142:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802146:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80214a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80214e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802152:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802156:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80215a:	83 c4 24             	add    $0x24,%esp
+  80215d:	5b                   	pop    %ebx
+  80215e:	5e                   	pop    %esi
+  80215f:	5f                   	pop    %edi
+  802160:	5d                   	pop    %ebp
+  802161:	c3                   	ret
+  802162:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802169:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00802170 <__udivdi3>:
+  802170:	57                   	push   %edi
+  802171:	56                   	push   %esi
+  802172:	53                   	push   %ebx
+  802173:	83 ec 20             	sub    $0x20,%esp
+  802176:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80217a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80217e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802182:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802186:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80218a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80218e:	89 d1                	mov    %edx,%ecx
+  802190:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802194:	09 c1                	or     %eax,%ecx
+  802196:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80219a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80219e:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  8021a2:	0f 84 88 00 00 00    	je     802230 <__udivdi3+0xc0>
+  8021a8:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8021af:	00 
+  8021b0:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8021b5:	31 c0                	xor    %eax,%eax
+  8021b7:	31 d2                	xor    %edx,%edx
+  8021b9:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8021c0:	00 
+  8021c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8021c8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8021cc:	01 c0                	add    %eax,%eax
+  8021ce:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8021d5:	00 
+  8021d6:	89 c6                	mov    %eax,%esi
+  8021d8:	89 d7                	mov    %edx,%edi
+  8021da:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8021de:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8021e2:	0f ad d0             	shrd   %cl,%edx,%eax
+  8021e5:	d3 ea                	shr    %cl,%edx
+  8021e7:	f6 c1 20             	test   $0x20,%cl
+  8021ea:	0f 45 c2             	cmovne %edx,%eax
+  8021ed:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8021f1:	83 e0 01             	and    $0x1,%eax
+  8021f4:	09 fa                	or     %edi,%edx
+  8021f6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8021fa:	89 04 24             	mov    %eax,(%esp)
+  8021fd:	8b 04 24             	mov    (%esp),%eax
+  802200:	89 d3                	mov    %edx,%ebx
+  802202:	09 f0                	or     %esi,%eax
+  802204:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802208:	39 f0                	cmp    %esi,%eax
+  80220a:	19 fb                	sbb    %edi,%ebx
+  80220c:	72 1d                	jb     80222b <__udivdi3+0xbb>
+  80220e:	29 f0                	sub    %esi,%eax
+  802210:	19 fa                	sbb    %edi,%edx
+  802212:	89 cf                	mov    %ecx,%edi
+  802214:	c1 ef 05             	shr    $0x5,%edi
+  802217:	83 e7 01             	and    $0x1,%edi
+  80221a:	89 fe                	mov    %edi,%esi
+  80221c:	d3 e7                	shl    %cl,%edi
+  80221e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802222:	83 f6 01             	xor    $0x1,%esi
+  802225:	d3 e6                	shl    %cl,%esi
+  802227:	09 74 24 18          	or     %esi,0x18(%esp)
+  80222b:	83 e9 01             	sub    $0x1,%ecx
+  80222e:	73 98                	jae    8021c8 <__udivdi3+0x58>
+  802230:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802234:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802238:	83 c4 20             	add    $0x20,%esp
+  80223b:	5b                   	pop    %ebx
+  80223c:	5e                   	pop    %esi
+  80223d:	5f                   	pop    %edi
+  80223e:	c3                   	ret
+  80223f:	90                   	nop
+
+00802240 <__umoddi3>:
+  802240:	57                   	push   %edi
+  802241:	56                   	push   %esi
+  802242:	53                   	push   %ebx
+  802243:	83 ec 18             	sub    $0x18,%esp
+  802246:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80224a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80224e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802252:	8b 54 24 34          	mov    0x34(%esp),%edx
+  802256:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80225a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80225e:	89 d1                	mov    %edx,%ecx
+  802260:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802264:	09 c1                	or     %eax,%ecx
+  802266:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80226a:	74 5b                	je     8022c7 <__umoddi3+0x87>
+  80226c:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802271:	31 c0                	xor    %eax,%eax
+  802273:	31 d2                	xor    %edx,%edx
+  802275:	8d 76 00             	lea    0x0(%esi),%esi
+  802278:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80227c:	01 c0                	add    %eax,%eax
+  80227e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802285:	00 
+  802286:	89 c6                	mov    %eax,%esi
+  802288:	89 d7                	mov    %edx,%edi
+  80228a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80228e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802292:	0f ad d0             	shrd   %cl,%edx,%eax
+  802295:	d3 ea                	shr    %cl,%edx
+  802297:	f6 c1 20             	test   $0x20,%cl
+  80229a:	0f 45 c2             	cmovne %edx,%eax
+  80229d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8022a1:	83 e0 01             	and    $0x1,%eax
+  8022a4:	09 fa                	or     %edi,%edx
+  8022a6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8022aa:	89 04 24             	mov    %eax,(%esp)
+  8022ad:	8b 04 24             	mov    (%esp),%eax
+  8022b0:	89 d3                	mov    %edx,%ebx
+  8022b2:	09 f0                	or     %esi,%eax
+  8022b4:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8022b8:	39 f0                	cmp    %esi,%eax
+  8022ba:	19 fb                	sbb    %edi,%ebx
+  8022bc:	72 04                	jb     8022c2 <__umoddi3+0x82>
+  8022be:	29 f0                	sub    %esi,%eax
+  8022c0:	19 fa                	sbb    %edi,%edx
+  8022c2:	83 e9 01             	sub    $0x1,%ecx
+  8022c5:	73 b1                	jae    802278 <__umoddi3+0x38>
+  8022c7:	83 c4 18             	add    $0x18,%esp
+  8022ca:	5b                   	pop    %ebx
+  8022cb:	5e                   	pop    %esi
+  8022cc:	5f                   	pop    %edi
+  8022cd:	c3                   	ret
+  8022ce:	66 90                	xchg   %ax,%ax
+
+008022d0 <__divdi3>:
+  8022d0:	55                   	push   %ebp
+  8022d1:	57                   	push   %edi
+  8022d2:	56                   	push   %esi
+  8022d3:	53                   	push   %ebx
+  8022d4:	83 ec 24             	sub    $0x24,%esp
+  8022d7:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  8022db:	8b 74 24 44          	mov    0x44(%esp),%esi
+  8022df:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8022e3:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8022e7:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  8022eb:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8022ef:	85 d2                	test   %edx,%edx
+  8022f1:	0f 88 e0 00 00 00    	js     8023d7 <__divdi3+0x107>
+  8022f7:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  8022fb:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  8022ff:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802303:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802307:	85 f6                	test   %esi,%esi
+  802309:	78 16                	js     802321 <__divdi3+0x51>
+  80230b:	89 f1                	mov    %esi,%ecx
+  80230d:	31 c0                	xor    %eax,%eax
+  80230f:	31 d2                	xor    %edx,%edx
+  802311:	09 d9                	or     %ebx,%ecx
+  802313:	0f 85 f3 00 00 00    	jne    80240c <__divdi3+0x13c>
+  802319:	83 c4 24             	add    $0x24,%esp
+  80231c:	5b                   	pop    %ebx
+  80231d:	5e                   	pop    %esi
+  80231e:	5f                   	pop    %edi
+  80231f:	5d                   	pop    %ebp
+  802320:	c3                   	ret
+  802321:	bf 01 00 00 00       	mov    $0x1,%edi
+  802326:	f7 5c 24 08          	negl   0x8(%esp)
+  80232a:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  80232f:	f7 5c 24 0c          	negl   0xc(%esp)
+  802333:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80233a:	00 
+  80233b:	31 c0                	xor    %eax,%eax
+  80233d:	31 d2                	xor    %edx,%edx
+  80233f:	89 fb                	mov    %edi,%ebx
+  802341:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802348:	00 
+  802349:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80234e:	66 90                	xchg   %ax,%ax
+  802350:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802354:	01 c0                	add    %eax,%eax
+  802356:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80235d:	00 
+  80235e:	89 c6                	mov    %eax,%esi
+  802360:	89 d7                	mov    %edx,%edi
+  802362:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802366:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80236a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80236d:	d3 ea                	shr    %cl,%edx
+  80236f:	f6 c1 20             	test   $0x20,%cl
+  802372:	0f 45 c2             	cmovne %edx,%eax
+  802375:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802379:	83 e0 01             	and    $0x1,%eax
+  80237c:	09 fa                	or     %edi,%edx
+  80237e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802382:	89 04 24             	mov    %eax,(%esp)
+  802385:	8b 04 24             	mov    (%esp),%eax
+  802388:	89 d5                	mov    %edx,%ebp
+  80238a:	09 f0                	or     %esi,%eax
+  80238c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802390:	39 f0                	cmp    %esi,%eax
+  802392:	19 fd                	sbb    %edi,%ebp
+  802394:	72 1d                	jb     8023b3 <__divdi3+0xe3>
+  802396:	29 f0                	sub    %esi,%eax
+  802398:	19 fa                	sbb    %edi,%edx
+  80239a:	89 cf                	mov    %ecx,%edi
+  80239c:	c1 ef 05             	shr    $0x5,%edi
+  80239f:	83 e7 01             	and    $0x1,%edi
+  8023a2:	89 fe                	mov    %edi,%esi
+  8023a4:	d3 e7                	shl    %cl,%edi
+  8023a6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8023aa:	83 f6 01             	xor    $0x1,%esi
+  8023ad:	d3 e6                	shl    %cl,%esi
+  8023af:	09 74 24 18          	or     %esi,0x18(%esp)
+  8023b3:	83 e9 01             	sub    $0x1,%ecx
+  8023b6:	73 98                	jae    802350 <__divdi3+0x80>
+  8023b8:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8023bc:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8023c0:	85 db                	test   %ebx,%ebx
+  8023c2:	0f 84 51 ff ff ff    	je     802319 <__divdi3+0x49>
+  8023c8:	f7 d8                	neg    %eax
+  8023ca:	83 d2 00             	adc    $0x0,%edx
+  8023cd:	83 c4 24             	add    $0x24,%esp
+  8023d0:	5b                   	pop    %ebx
+  8023d1:	f7 da                	neg    %edx
+  8023d3:	5e                   	pop    %esi
+  8023d4:	5f                   	pop    %edi
+  8023d5:	5d                   	pop    %ebp
+  8023d6:	c3                   	ret
+  8023d7:	f7 d8                	neg    %eax
+  8023d9:	83 d2 00             	adc    $0x0,%edx
+  8023dc:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8023e0:	f7 da                	neg    %edx
+  8023e2:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8023e6:	85 f6                	test   %esi,%esi
+  8023e8:	78 1b                	js     802405 <__divdi3+0x135>
+  8023ea:	89 f1                	mov    %esi,%ecx
+  8023ec:	31 c0                	xor    %eax,%eax
+  8023ee:	31 d2                	xor    %edx,%edx
+  8023f0:	bf 01 00 00 00       	mov    $0x1,%edi
+  8023f5:	09 d9                	or     %ebx,%ecx
+  8023f7:	0f 85 36 ff ff ff    	jne    802333 <__divdi3+0x63>
+  8023fd:	83 c4 24             	add    $0x24,%esp
+  802400:	5b                   	pop    %ebx
+  802401:	5e                   	pop    %esi
+  802402:	5f                   	pop    %edi
+  802403:	5d                   	pop    %ebp
+  802404:	c3                   	ret
+  802405:	31 ff                	xor    %edi,%edi
+  802407:	e9 1a ff ff ff       	jmp    802326 <__divdi3+0x56>
+  80240c:	31 ff                	xor    %edi,%edi
+  80240e:	e9 20 ff ff ff       	jmp    802333 <__divdi3+0x63>
+  802413:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80241a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00802420 <__moddi3>:
+  802420:	55                   	push   %ebp
+  802421:	57                   	push   %edi
+  802422:	56                   	push   %esi
+  802423:	53                   	push   %ebx
+  802424:	83 ec 1c             	sub    $0x1c,%esp
+  802427:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  80242b:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  80242f:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  802433:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  802437:	89 c8                	mov    %ecx,%eax
+  802439:	89 f2                	mov    %esi,%edx
+  80243b:	89 f3                	mov    %esi,%ebx
+  80243d:	85 ed                	test   %ebp,%ebp
+  80243f:	0f 88 9d 00 00 00    	js     8024e2 <__moddi3+0xc2>
+  802445:	09 cb                	or     %ecx,%ebx
+  802447:	0f 84 8d 00 00 00    	je     8024da <__moddi3+0xba>
+  80244d:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802451:	31 db                	xor    %ebx,%ebx
+  802453:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802457:	89 ca                	mov    %ecx,%edx
+  802459:	89 f0                	mov    %esi,%eax
+  80245b:	89 dd                	mov    %ebx,%ebp
+  80245d:	f7 da                	neg    %edx
+  80245f:	83 d0 00             	adc    $0x0,%eax
+  802462:	f7 d8                	neg    %eax
+  802464:	0f 49 f0             	cmovns %eax,%esi
+  802467:	0f 49 ca             	cmovns %edx,%ecx
+  80246a:	31 c0                	xor    %eax,%eax
+  80246c:	31 d2                	xor    %edx,%edx
+  80246e:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802472:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802476:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80247b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80247f:	90                   	nop
+  802480:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802484:	01 c0                	add    %eax,%eax
+  802486:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80248d:	00 
+  80248e:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  802492:	89 c6                	mov    %eax,%esi
+  802494:	89 d7                	mov    %edx,%edi
+  802496:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80249a:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80249e:	0f ad d0             	shrd   %cl,%edx,%eax
+  8024a1:	d3 ea                	shr    %cl,%edx
+  8024a3:	f6 c1 20             	test   $0x20,%cl
+  8024a6:	0f 45 c2             	cmovne %edx,%eax
+  8024a9:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8024ad:	83 e0 01             	and    $0x1,%eax
+  8024b0:	09 fa                	or     %edi,%edx
+  8024b2:	89 04 24             	mov    %eax,(%esp)
+  8024b5:	8b 04 24             	mov    (%esp),%eax
+  8024b8:	89 d7                	mov    %edx,%edi
+  8024ba:	09 f0                	or     %esi,%eax
+  8024bc:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  8024c0:	39 d8                	cmp    %ebx,%eax
+  8024c2:	19 f7                	sbb    %esi,%edi
+  8024c4:	72 04                	jb     8024ca <__moddi3+0xaa>
+  8024c6:	29 d8                	sub    %ebx,%eax
+  8024c8:	19 f2                	sbb    %esi,%edx
+  8024ca:	83 e9 01             	sub    $0x1,%ecx
+  8024cd:	73 b1                	jae    802480 <__moddi3+0x60>
+  8024cf:	85 ed                	test   %ebp,%ebp
+  8024d1:	74 07                	je     8024da <__moddi3+0xba>
+  8024d3:	f7 d8                	neg    %eax
+  8024d5:	83 d2 00             	adc    $0x0,%edx
+  8024d8:	f7 da                	neg    %edx
+  8024da:	83 c4 1c             	add    $0x1c,%esp
+  8024dd:	5b                   	pop    %ebx
+  8024de:	5e                   	pop    %esi
+  8024df:	5f                   	pop    %edi
+  8024e0:	5d                   	pop    %ebp
+  8024e1:	c3                   	ret
+  8024e2:	09 cb                	or     %ecx,%ebx
+  8024e4:	74 f4                	je     8024da <__moddi3+0xba>
+  8024e6:	f7 df                	neg    %edi
+  8024e8:	bb 01 00 00 00       	mov    $0x1,%ebx
+  8024ed:	83 d5 00             	adc    $0x0,%ebp
+  8024f0:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  8024f4:	f7 dd                	neg    %ebp
+  8024f6:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  8024fa:	e9 58 ff ff ff       	jmp    802457 <__moddi3+0x37>
@@ -0,0 +1,6072 @@
+
+obj/user/init.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 5f 03 00 00       	call   800390 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <sum>:
+
+char bss[6000];
+
+int
+sum(const char *s, int n)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	8b 75 08             	mov    0x8(%ebp),%esi
+  80003b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int i, tot = 0;
+  80003e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	for (i = 0; i < n; i++)
+  800043:	b8 00 00 00 00       	mov    $0x0,%eax
+  800048:	eb 0c                	jmp    800056 <sum+0x23>
+		tot ^= i * s[i];
+  80004a:	0f be 14 06          	movsbl (%esi,%eax,1),%edx
+  80004e:	0f af d0             	imul   %eax,%edx
+  800051:	31 d1                	xor    %edx,%ecx
+	for (i = 0; i < n; i++)
+  800053:	83 c0 01             	add    $0x1,%eax
+  800056:	39 d8                	cmp    %ebx,%eax
+  800058:	7c f0                	jl     80004a <sum+0x17>
+	return tot;
+}
+  80005a:	89 c8                	mov    %ecx,%eax
+  80005c:	5b                   	pop    %ebx
+  80005d:	5e                   	pop    %esi
+  80005e:	5d                   	pop    %ebp
+  80005f:	c3                   	ret
+
+00800060 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800060:	55                   	push   %ebp
+  800061:	89 e5                	mov    %esp,%ebp
+  800063:	57                   	push   %edi
+  800064:	56                   	push   %esi
+  800065:	53                   	push   %ebx
+  800066:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  80006c:	8b 7d 08             	mov    0x8(%ebp),%edi
+	int i, r, x, want;
+	char args[256];
+
+	cprintf("init: running\n");
+  80006f:	68 00 2d 80 00       	push   $0x802d00
+  800074:	e8 55 04 00 00       	call   8004ce <cprintf>
+
+	want = 0xf989e;
+	if ((x = sum((char*)&data, sizeof data)) != want)
+  800079:	83 c4 08             	add    $0x8,%esp
+  80007c:	68 70 17 00 00       	push   $0x1770
+  800081:	68 00 40 80 00       	push   $0x804000
+  800086:	e8 a8 ff ff ff       	call   800033 <sum>
+  80008b:	83 c4 10             	add    $0x10,%esp
+  80008e:	3d 9e 98 0f 00       	cmp    $0xf989e,%eax
+  800093:	74 64                	je     8000f9 <umain+0x99>
+		cprintf("init: data is not initialized: got sum %08x wanted %08x\n",
+  800095:	83 ec 04             	sub    $0x4,%esp
+  800098:	68 9e 98 0f 00       	push   $0xf989e
+  80009d:	50                   	push   %eax
+  80009e:	68 c8 2d 80 00       	push   $0x802dc8
+  8000a3:	e8 26 04 00 00       	call   8004ce <cprintf>
+  8000a8:	83 c4 10             	add    $0x10,%esp
+			x, want);
+	else
+		cprintf("init: data seems okay\n");
+	if ((x = sum(bss, sizeof bss)) != 0)
+  8000ab:	83 ec 08             	sub    $0x8,%esp
+  8000ae:	68 70 17 00 00       	push   $0x1770
+  8000b3:	68 20 60 80 00       	push   $0x806020
+  8000b8:	e8 76 ff ff ff       	call   800033 <sum>
+  8000bd:	83 c4 10             	add    $0x10,%esp
+  8000c0:	85 c0                	test   %eax,%eax
+  8000c2:	74 47                	je     80010b <umain+0xab>
+		cprintf("bss is not initialized: wanted sum 0 got %08x\n", x);
+  8000c4:	83 ec 08             	sub    $0x8,%esp
+  8000c7:	50                   	push   %eax
+  8000c8:	68 04 2e 80 00       	push   $0x802e04
+  8000cd:	e8 fc 03 00 00       	call   8004ce <cprintf>
+  8000d2:	83 c4 10             	add    $0x10,%esp
+	else
+		cprintf("init: bss seems okay\n");
+
+	// output in one syscall per line to avoid output interleaving 
+	strcat(args, "init: args:");
+  8000d5:	83 ec 08             	sub    $0x8,%esp
+  8000d8:	68 3c 2d 80 00       	push   $0x802d3c
+  8000dd:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  8000e3:	50                   	push   %eax
+  8000e4:	e8 c2 09 00 00       	call   800aab <strcat>
+	for (i = 0; i < argc; i++) {
+  8000e9:	83 c4 10             	add    $0x10,%esp
+  8000ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+		strcat(args, " '");
+  8000f1:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+	for (i = 0; i < argc; i++) {
+  8000f7:	eb 55                	jmp    80014e <umain+0xee>
+		cprintf("init: data seems okay\n");
+  8000f9:	83 ec 0c             	sub    $0xc,%esp
+  8000fc:	68 0f 2d 80 00       	push   $0x802d0f
+  800101:	e8 c8 03 00 00       	call   8004ce <cprintf>
+  800106:	83 c4 10             	add    $0x10,%esp
+  800109:	eb a0                	jmp    8000ab <umain+0x4b>
+		cprintf("init: bss seems okay\n");
+  80010b:	83 ec 0c             	sub    $0xc,%esp
+  80010e:	68 26 2d 80 00       	push   $0x802d26
+  800113:	e8 b6 03 00 00       	call   8004ce <cprintf>
+  800118:	83 c4 10             	add    $0x10,%esp
+  80011b:	eb b8                	jmp    8000d5 <umain+0x75>
+		strcat(args, " '");
+  80011d:	83 ec 08             	sub    $0x8,%esp
+  800120:	68 48 2d 80 00       	push   $0x802d48
+  800125:	56                   	push   %esi
+  800126:	e8 80 09 00 00       	call   800aab <strcat>
+		strcat(args, argv[i]);
+  80012b:	83 c4 08             	add    $0x8,%esp
+  80012e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800131:	ff 34 98             	push   (%eax,%ebx,4)
+  800134:	56                   	push   %esi
+  800135:	e8 71 09 00 00       	call   800aab <strcat>
+		strcat(args, "'");
+  80013a:	83 c4 08             	add    $0x8,%esp
+  80013d:	68 49 2d 80 00       	push   $0x802d49
+  800142:	56                   	push   %esi
+  800143:	e8 63 09 00 00       	call   800aab <strcat>
+	for (i = 0; i < argc; i++) {
+  800148:	83 c3 01             	add    $0x1,%ebx
+  80014b:	83 c4 10             	add    $0x10,%esp
+  80014e:	39 fb                	cmp    %edi,%ebx
+  800150:	7c cb                	jl     80011d <umain+0xbd>
+	}
+	cprintf("%s\n", args);
+  800152:	83 ec 08             	sub    $0x8,%esp
+  800155:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  80015b:	50                   	push   %eax
+  80015c:	68 4b 2d 80 00       	push   $0x802d4b
+  800161:	e8 68 03 00 00       	call   8004ce <cprintf>
+
+	cprintf("init: running sh\n");
+  800166:	c7 04 24 4f 2d 80 00 	movl   $0x802d4f,(%esp)
+  80016d:	e8 5c 03 00 00       	call   8004ce <cprintf>
+
+	// being run directly from kernel, so no file descriptors open yet
+	close(0);
+  800172:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800179:	e8 6f 11 00 00       	call   8012ed <close>
+	if ((r = opencons()) < 0)
+  80017e:	e8 bb 01 00 00       	call   80033e <opencons>
+  800183:	83 c4 10             	add    $0x10,%esp
+  800186:	85 c0                	test   %eax,%eax
+  800188:	78 14                	js     80019e <umain+0x13e>
+		panic("opencons: %e", r);
+	if (r != 0)
+  80018a:	74 24                	je     8001b0 <umain+0x150>
+		panic("first opencons used fd %d", r);
+  80018c:	50                   	push   %eax
+  80018d:	68 7a 2d 80 00       	push   $0x802d7a
+  800192:	6a 39                	push   $0x39
+  800194:	68 6e 2d 80 00       	push   $0x802d6e
+  800199:	e8 55 02 00 00       	call   8003f3 <_panic>
+		panic("opencons: %e", r);
+  80019e:	50                   	push   %eax
+  80019f:	68 61 2d 80 00       	push   $0x802d61
+  8001a4:	6a 37                	push   $0x37
+  8001a6:	68 6e 2d 80 00       	push   $0x802d6e
+  8001ab:	e8 43 02 00 00       	call   8003f3 <_panic>
+	if ((r = dup(0, 1)) < 0)
+  8001b0:	83 ec 08             	sub    $0x8,%esp
+  8001b3:	6a 01                	push   $0x1
+  8001b5:	6a 00                	push   $0x0
+  8001b7:	e8 83 11 00 00       	call   80133f <dup>
+  8001bc:	83 c4 10             	add    $0x10,%esp
+  8001bf:	85 c0                	test   %eax,%eax
+  8001c1:	79 23                	jns    8001e6 <umain+0x186>
+		panic("dup: %e", r);
+  8001c3:	50                   	push   %eax
+  8001c4:	68 94 2d 80 00       	push   $0x802d94
+  8001c9:	6a 3b                	push   $0x3b
+  8001cb:	68 6e 2d 80 00       	push   $0x802d6e
+  8001d0:	e8 1e 02 00 00       	call   8003f3 <_panic>
+	while (1) {
+		cprintf("init: starting sh\n");
+		r = spawnl("/sh", "sh", (char*)0);
+		if (r < 0) {
+			cprintf("init: spawn sh: %e\n", r);
+  8001d5:	83 ec 08             	sub    $0x8,%esp
+  8001d8:	50                   	push   %eax
+  8001d9:	68 b3 2d 80 00       	push   $0x802db3
+  8001de:	e8 eb 02 00 00       	call   8004ce <cprintf>
+			continue;
+  8001e3:	83 c4 10             	add    $0x10,%esp
+		cprintf("init: starting sh\n");
+  8001e6:	83 ec 0c             	sub    $0xc,%esp
+  8001e9:	68 9c 2d 80 00       	push   $0x802d9c
+  8001ee:	e8 db 02 00 00       	call   8004ce <cprintf>
+		r = spawnl("/sh", "sh", (char*)0);
+  8001f3:	83 c4 0c             	add    $0xc,%esp
+  8001f6:	6a 00                	push   $0x0
+  8001f8:	68 b0 2d 80 00       	push   $0x802db0
+  8001fd:	68 af 2d 80 00       	push   $0x802daf
+  800202:	e8 93 1c 00 00       	call   801e9a <spawnl>
+		if (r < 0) {
+  800207:	83 c4 10             	add    $0x10,%esp
+  80020a:	85 c0                	test   %eax,%eax
+  80020c:	78 c7                	js     8001d5 <umain+0x175>
+		}
+		wait(r);
+  80020e:	83 ec 0c             	sub    $0xc,%esp
+  800211:	50                   	push   %eax
+  800212:	e8 a9 24 00 00       	call   8026c0 <wait>
+  800217:	83 c4 10             	add    $0x10,%esp
+  80021a:	eb ca                	jmp    8001e6 <umain+0x186>
+
+0080021c <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80021c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800221:	c3                   	ret
+
+00800222 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  800222:	55                   	push   %ebp
+  800223:	89 e5                	mov    %esp,%ebp
+  800225:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  800228:	68 33 2e 80 00       	push   $0x802e33
+  80022d:	ff 75 0c             	push   0xc(%ebp)
+  800230:	e8 52 08 00 00       	call   800a87 <strcpy>
+	return 0;
+}
+  800235:	b8 00 00 00 00       	mov    $0x0,%eax
+  80023a:	c9                   	leave
+  80023b:	c3                   	ret
+
+0080023c <devcons_write>:
+{
+  80023c:	55                   	push   %ebp
+  80023d:	89 e5                	mov    %esp,%ebp
+  80023f:	57                   	push   %edi
+  800240:	56                   	push   %esi
+  800241:	53                   	push   %ebx
+  800242:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  800248:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80024d:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  800253:	eb 2e                	jmp    800283 <devcons_write+0x47>
+		m = n - tot;
+  800255:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800258:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80025a:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80025f:	39 c3                	cmp    %eax,%ebx
+  800261:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  800264:	83 ec 04             	sub    $0x4,%esp
+  800267:	53                   	push   %ebx
+  800268:	89 f0                	mov    %esi,%eax
+  80026a:	03 45 0c             	add    0xc(%ebp),%eax
+  80026d:	50                   	push   %eax
+  80026e:	57                   	push   %edi
+  80026f:	e8 99 09 00 00       	call   800c0d <memmove>
+		sys_cputs(buf, m);
+  800274:	83 c4 08             	add    $0x8,%esp
+  800277:	53                   	push   %ebx
+  800278:	57                   	push   %edi
+  800279:	e8 39 0b 00 00       	call   800db7 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80027e:	01 de                	add    %ebx,%esi
+  800280:	83 c4 10             	add    $0x10,%esp
+  800283:	3b 75 10             	cmp    0x10(%ebp),%esi
+  800286:	72 cd                	jb     800255 <devcons_write+0x19>
+}
+  800288:	89 f0                	mov    %esi,%eax
+  80028a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80028d:	5b                   	pop    %ebx
+  80028e:	5e                   	pop    %esi
+  80028f:	5f                   	pop    %edi
+  800290:	5d                   	pop    %ebp
+  800291:	c3                   	ret
+
+00800292 <devcons_read>:
+{
+  800292:	55                   	push   %ebp
+  800293:	89 e5                	mov    %esp,%ebp
+  800295:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  800298:	b8 00 00 00 00       	mov    $0x0,%eax
+  80029d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8002a1:	75 07                	jne    8002aa <devcons_read+0x18>
+  8002a3:	eb 1f                	jmp    8002c4 <devcons_read+0x32>
+		sys_yield();
+  8002a5:	e8 aa 0b 00 00       	call   800e54 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8002aa:	e8 26 0b 00 00       	call   800dd5 <sys_cgetc>
+  8002af:	85 c0                	test   %eax,%eax
+  8002b1:	74 f2                	je     8002a5 <devcons_read+0x13>
+	if (c < 0)
+  8002b3:	78 0f                	js     8002c4 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8002b5:	83 f8 04             	cmp    $0x4,%eax
+  8002b8:	74 0c                	je     8002c6 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8002ba:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8002bd:	88 02                	mov    %al,(%edx)
+	return 1;
+  8002bf:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8002c4:	c9                   	leave
+  8002c5:	c3                   	ret
+		return 0;
+  8002c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002cb:	eb f7                	jmp    8002c4 <devcons_read+0x32>
+
+008002cd <cputchar>:
+{
+  8002cd:	55                   	push   %ebp
+  8002ce:	89 e5                	mov    %esp,%ebp
+  8002d0:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8002d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002d6:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8002d9:	6a 01                	push   $0x1
+  8002db:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8002de:	50                   	push   %eax
+  8002df:	e8 d3 0a 00 00       	call   800db7 <sys_cputs>
+}
+  8002e4:	83 c4 10             	add    $0x10,%esp
+  8002e7:	c9                   	leave
+  8002e8:	c3                   	ret
+
+008002e9 <getchar>:
+{
+  8002e9:	55                   	push   %ebp
+  8002ea:	89 e5                	mov    %esp,%ebp
+  8002ec:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8002ef:	6a 01                	push   $0x1
+  8002f1:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8002f4:	50                   	push   %eax
+  8002f5:	6a 00                	push   $0x0
+  8002f7:	e8 2d 11 00 00       	call   801429 <read>
+	if (r < 0)
+  8002fc:	83 c4 10             	add    $0x10,%esp
+  8002ff:	85 c0                	test   %eax,%eax
+  800301:	78 06                	js     800309 <getchar+0x20>
+	if (r < 1)
+  800303:	74 06                	je     80030b <getchar+0x22>
+	return c;
+  800305:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  800309:	c9                   	leave
+  80030a:	c3                   	ret
+		return -E_EOF;
+  80030b:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  800310:	eb f7                	jmp    800309 <getchar+0x20>
+
+00800312 <iscons>:
+{
+  800312:	55                   	push   %ebp
+  800313:	89 e5                	mov    %esp,%ebp
+  800315:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800318:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80031b:	50                   	push   %eax
+  80031c:	ff 75 08             	push   0x8(%ebp)
+  80031f:	e8 9f 0e 00 00       	call   8011c3 <fd_lookup>
+  800324:	83 c4 10             	add    $0x10,%esp
+  800327:	85 c0                	test   %eax,%eax
+  800329:	78 11                	js     80033c <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80032b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80032e:	8b 15 70 57 80 00    	mov    0x805770,%edx
+  800334:	39 10                	cmp    %edx,(%eax)
+  800336:	0f 94 c0             	sete   %al
+  800339:	0f b6 c0             	movzbl %al,%eax
+}
+  80033c:	c9                   	leave
+  80033d:	c3                   	ret
+
+0080033e <opencons>:
+{
+  80033e:	55                   	push   %ebp
+  80033f:	89 e5                	mov    %esp,%ebp
+  800341:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  800344:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800347:	50                   	push   %eax
+  800348:	e8 20 0e 00 00       	call   80116d <fd_alloc>
+  80034d:	83 c4 10             	add    $0x10,%esp
+  800350:	85 c0                	test   %eax,%eax
+  800352:	78 3a                	js     80038e <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  800354:	83 ec 04             	sub    $0x4,%esp
+  800357:	68 07 04 00 00       	push   $0x407
+  80035c:	ff 75 f4             	push   -0xc(%ebp)
+  80035f:	6a 00                	push   $0x0
+  800361:	e8 0d 0b 00 00       	call   800e73 <sys_page_alloc>
+  800366:	83 c4 10             	add    $0x10,%esp
+  800369:	85 c0                	test   %eax,%eax
+  80036b:	78 21                	js     80038e <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80036d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800370:	8b 15 70 57 80 00    	mov    0x805770,%edx
+  800376:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  800378:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80037b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  800382:	83 ec 0c             	sub    $0xc,%esp
+  800385:	50                   	push   %eax
+  800386:	e8 bb 0d 00 00       	call   801146 <fd2num>
+  80038b:	83 c4 10             	add    $0x10,%esp
+}
+  80038e:	c9                   	leave
+  80038f:	c3                   	ret
+
+00800390 <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  800390:	55                   	push   %ebp
+  800391:	89 e5                	mov    %esp,%ebp
+  800393:	56                   	push   %esi
+  800394:	53                   	push   %ebx
+  800395:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800398:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  80039b:	e8 95 0a 00 00       	call   800e35 <sys_getenvid>
+  8003a0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8003a5:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8003a8:	c1 e0 04             	shl    $0x4,%eax
+  8003ab:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8003b0:	a3 90 77 80 00       	mov    %eax,0x807790
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8003b5:	85 db                	test   %ebx,%ebx
+  8003b7:	7e 07                	jle    8003c0 <libmain+0x30>
+    binaryname = argv[0];
+  8003b9:	8b 06                	mov    (%esi),%eax
+  8003bb:	a3 8c 57 80 00       	mov    %eax,0x80578c
+
+  // call user main routine
+  umain(argc, argv);
+  8003c0:	83 ec 08             	sub    $0x8,%esp
+  8003c3:	56                   	push   %esi
+  8003c4:	53                   	push   %ebx
+  8003c5:	e8 96 fc ff ff       	call   800060 <umain>
+
+  // exit gracefully
+  exit();
+  8003ca:	e8 0a 00 00 00       	call   8003d9 <exit>
+}
+  8003cf:	83 c4 10             	add    $0x10,%esp
+  8003d2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8003d5:	5b                   	pop    %ebx
+  8003d6:	5e                   	pop    %esi
+  8003d7:	5d                   	pop    %ebp
+  8003d8:	c3                   	ret
+
+008003d9 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8003d9:	55                   	push   %ebp
+  8003da:	89 e5                	mov    %esp,%ebp
+  8003dc:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8003df:	e8 36 0f 00 00       	call   80131a <close_all>
+	sys_env_destroy(0);
+  8003e4:	83 ec 0c             	sub    $0xc,%esp
+  8003e7:	6a 00                	push   $0x0
+  8003e9:	e8 06 0a 00 00       	call   800df4 <sys_env_destroy>
+}
+  8003ee:	83 c4 10             	add    $0x10,%esp
+  8003f1:	c9                   	leave
+  8003f2:	c3                   	ret
+
+008003f3 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8003f3:	55                   	push   %ebp
+  8003f4:	89 e5                	mov    %esp,%ebp
+  8003f6:	56                   	push   %esi
+  8003f7:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8003f8:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8003fb:	8b 35 8c 57 80 00    	mov    0x80578c,%esi
+  800401:	e8 2f 0a 00 00       	call   800e35 <sys_getenvid>
+  800406:	83 ec 0c             	sub    $0xc,%esp
+  800409:	ff 75 0c             	push   0xc(%ebp)
+  80040c:	ff 75 08             	push   0x8(%ebp)
+  80040f:	56                   	push   %esi
+  800410:	50                   	push   %eax
+  800411:	68 4c 2e 80 00       	push   $0x802e4c
+  800416:	e8 b3 00 00 00       	call   8004ce <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80041b:	83 c4 18             	add    $0x18,%esp
+  80041e:	53                   	push   %ebx
+  80041f:	ff 75 10             	push   0x10(%ebp)
+  800422:	e8 56 00 00 00       	call   80047d <vcprintf>
+	cprintf("\n");
+  800427:	c7 04 24 87 33 80 00 	movl   $0x803387,(%esp)
+  80042e:	e8 9b 00 00 00       	call   8004ce <cprintf>
+  800433:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800436:	cc                   	int3
+	while (1)
+  800437:	eb fd                	jmp    800436 <_panic+0x43>
+
+00800439 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800439:	55                   	push   %ebp
+  80043a:	89 e5                	mov    %esp,%ebp
+  80043c:	53                   	push   %ebx
+  80043d:	83 ec 04             	sub    $0x4,%esp
+  800440:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800443:	8b 13                	mov    (%ebx),%edx
+  800445:	8d 42 01             	lea    0x1(%edx),%eax
+  800448:	89 03                	mov    %eax,(%ebx)
+  80044a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80044d:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800451:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800456:	74 09                	je     800461 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800458:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80045c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80045f:	c9                   	leave
+  800460:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800461:	83 ec 08             	sub    $0x8,%esp
+  800464:	68 ff 00 00 00       	push   $0xff
+  800469:	8d 43 08             	lea    0x8(%ebx),%eax
+  80046c:	50                   	push   %eax
+  80046d:	e8 45 09 00 00       	call   800db7 <sys_cputs>
+		b->idx = 0;
+  800472:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800478:	83 c4 10             	add    $0x10,%esp
+  80047b:	eb db                	jmp    800458 <putch+0x1f>
+
+0080047d <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80047d:	55                   	push   %ebp
+  80047e:	89 e5                	mov    %esp,%ebp
+  800480:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800486:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80048d:	00 00 00 
+	b.cnt = 0;
+  800490:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800497:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80049a:	ff 75 0c             	push   0xc(%ebp)
+  80049d:	ff 75 08             	push   0x8(%ebp)
+  8004a0:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8004a6:	50                   	push   %eax
+  8004a7:	68 39 04 80 00       	push   $0x800439
+  8004ac:	e8 14 01 00 00       	call   8005c5 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8004b1:	83 c4 08             	add    $0x8,%esp
+  8004b4:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8004ba:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8004c0:	50                   	push   %eax
+  8004c1:	e8 f1 08 00 00       	call   800db7 <sys_cputs>
+
+	return b.cnt;
+}
+  8004c6:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8004cc:	c9                   	leave
+  8004cd:	c3                   	ret
+
+008004ce <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8004ce:	55                   	push   %ebp
+  8004cf:	89 e5                	mov    %esp,%ebp
+  8004d1:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8004d4:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8004d7:	50                   	push   %eax
+  8004d8:	ff 75 08             	push   0x8(%ebp)
+  8004db:	e8 9d ff ff ff       	call   80047d <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8004e0:	c9                   	leave
+  8004e1:	c3                   	ret
+
+008004e2 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8004e2:	55                   	push   %ebp
+  8004e3:	89 e5                	mov    %esp,%ebp
+  8004e5:	57                   	push   %edi
+  8004e6:	56                   	push   %esi
+  8004e7:	53                   	push   %ebx
+  8004e8:	83 ec 1c             	sub    $0x1c,%esp
+  8004eb:	89 c7                	mov    %eax,%edi
+  8004ed:	89 d6                	mov    %edx,%esi
+  8004ef:	8b 45 08             	mov    0x8(%ebp),%eax
+  8004f2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8004f5:	89 d1                	mov    %edx,%ecx
+  8004f7:	89 c2                	mov    %eax,%edx
+  8004f9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004fc:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8004ff:	8b 45 10             	mov    0x10(%ebp),%eax
+  800502:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800505:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800508:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80050f:	39 c2                	cmp    %eax,%edx
+  800511:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800514:	72 3e                	jb     800554 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800516:	83 ec 0c             	sub    $0xc,%esp
+  800519:	ff 75 18             	push   0x18(%ebp)
+  80051c:	83 eb 01             	sub    $0x1,%ebx
+  80051f:	53                   	push   %ebx
+  800520:	50                   	push   %eax
+  800521:	83 ec 08             	sub    $0x8,%esp
+  800524:	ff 75 e4             	push   -0x1c(%ebp)
+  800527:	ff 75 e0             	push   -0x20(%ebp)
+  80052a:	ff 75 dc             	push   -0x24(%ebp)
+  80052d:	ff 75 d8             	push   -0x28(%ebp)
+  800530:	e8 3b 24 00 00       	call   802970 <__udivdi3>
+  800535:	83 c4 18             	add    $0x18,%esp
+  800538:	52                   	push   %edx
+  800539:	50                   	push   %eax
+  80053a:	89 f2                	mov    %esi,%edx
+  80053c:	89 f8                	mov    %edi,%eax
+  80053e:	e8 9f ff ff ff       	call   8004e2 <printnum>
+  800543:	83 c4 20             	add    $0x20,%esp
+  800546:	eb 13                	jmp    80055b <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800548:	83 ec 08             	sub    $0x8,%esp
+  80054b:	56                   	push   %esi
+  80054c:	ff 75 18             	push   0x18(%ebp)
+  80054f:	ff d7                	call   *%edi
+  800551:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800554:	83 eb 01             	sub    $0x1,%ebx
+  800557:	85 db                	test   %ebx,%ebx
+  800559:	7f ed                	jg     800548 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80055b:	83 ec 08             	sub    $0x8,%esp
+  80055e:	56                   	push   %esi
+  80055f:	83 ec 04             	sub    $0x4,%esp
+  800562:	ff 75 e4             	push   -0x1c(%ebp)
+  800565:	ff 75 e0             	push   -0x20(%ebp)
+  800568:	ff 75 dc             	push   -0x24(%ebp)
+  80056b:	ff 75 d8             	push   -0x28(%ebp)
+  80056e:	e8 cd 24 00 00       	call   802a40 <__umoddi3>
+  800573:	83 c4 14             	add    $0x14,%esp
+  800576:	0f be 80 6f 2e 80 00 	movsbl 0x802e6f(%eax),%eax
+  80057d:	50                   	push   %eax
+  80057e:	ff d7                	call   *%edi
+}
+  800580:	83 c4 10             	add    $0x10,%esp
+  800583:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800586:	5b                   	pop    %ebx
+  800587:	5e                   	pop    %esi
+  800588:	5f                   	pop    %edi
+  800589:	5d                   	pop    %ebp
+  80058a:	c3                   	ret
+
+0080058b <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80058b:	55                   	push   %ebp
+  80058c:	89 e5                	mov    %esp,%ebp
+  80058e:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800591:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800595:	8b 10                	mov    (%eax),%edx
+  800597:	3b 50 04             	cmp    0x4(%eax),%edx
+  80059a:	73 0a                	jae    8005a6 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80059c:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80059f:	89 08                	mov    %ecx,(%eax)
+  8005a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8005a4:	88 02                	mov    %al,(%edx)
+}
+  8005a6:	5d                   	pop    %ebp
+  8005a7:	c3                   	ret
+
+008005a8 <printfmt>:
+{
+  8005a8:	55                   	push   %ebp
+  8005a9:	89 e5                	mov    %esp,%ebp
+  8005ab:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8005ae:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8005b1:	50                   	push   %eax
+  8005b2:	ff 75 10             	push   0x10(%ebp)
+  8005b5:	ff 75 0c             	push   0xc(%ebp)
+  8005b8:	ff 75 08             	push   0x8(%ebp)
+  8005bb:	e8 05 00 00 00       	call   8005c5 <vprintfmt>
+}
+  8005c0:	83 c4 10             	add    $0x10,%esp
+  8005c3:	c9                   	leave
+  8005c4:	c3                   	ret
+
+008005c5 <vprintfmt>:
+{
+  8005c5:	55                   	push   %ebp
+  8005c6:	89 e5                	mov    %esp,%ebp
+  8005c8:	57                   	push   %edi
+  8005c9:	56                   	push   %esi
+  8005ca:	53                   	push   %ebx
+  8005cb:	83 ec 2c             	sub    $0x2c,%esp
+  8005ce:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005d1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8005d4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8005d7:	eb 0a                	jmp    8005e3 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8005d9:	83 ec 08             	sub    $0x8,%esp
+  8005dc:	53                   	push   %ebx
+  8005dd:	50                   	push   %eax
+  8005de:	ff d6                	call   *%esi
+  8005e0:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8005e3:	83 c7 01             	add    $0x1,%edi
+  8005e6:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8005ea:	83 f8 25             	cmp    $0x25,%eax
+  8005ed:	74 0c                	je     8005fb <vprintfmt+0x36>
+			if (ch == '\0')
+  8005ef:	85 c0                	test   %eax,%eax
+  8005f1:	75 e6                	jne    8005d9 <vprintfmt+0x14>
+}
+  8005f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005f6:	5b                   	pop    %ebx
+  8005f7:	5e                   	pop    %esi
+  8005f8:	5f                   	pop    %edi
+  8005f9:	5d                   	pop    %ebp
+  8005fa:	c3                   	ret
+		padc = ' ';
+  8005fb:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8005ff:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800606:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80060d:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800614:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800619:	8d 47 01             	lea    0x1(%edi),%eax
+  80061c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80061f:	0f b6 17             	movzbl (%edi),%edx
+  800622:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800625:	3c 55                	cmp    $0x55,%al
+  800627:	0f 87 9a 03 00 00    	ja     8009c7 <vprintfmt+0x402>
+  80062d:	0f b6 c0             	movzbl %al,%eax
+  800630:	ff 24 85 c0 2f 80 00 	jmp    *0x802fc0(,%eax,4)
+  800637:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  80063a:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80063e:	eb d9                	jmp    800619 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800640:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800643:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800647:	eb d0                	jmp    800619 <vprintfmt+0x54>
+  800649:	0f b6 d2             	movzbl %dl,%edx
+  80064c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80064f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800654:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800657:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80065a:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80065e:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800661:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800664:	83 f9 09             	cmp    $0x9,%ecx
+  800667:	77 55                	ja     8006be <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800669:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  80066c:	eb e9                	jmp    800657 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  80066e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800671:	8b 00                	mov    (%eax),%eax
+  800673:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800676:	8b 45 14             	mov    0x14(%ebp),%eax
+  800679:	8d 40 04             	lea    0x4(%eax),%eax
+  80067c:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80067f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800682:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800686:	79 91                	jns    800619 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800688:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80068b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80068e:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800695:	eb 82                	jmp    800619 <vprintfmt+0x54>
+			if (width < 0)
+  800697:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80069a:	85 d2                	test   %edx,%edx
+  80069c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006a1:	0f 49 c2             	cmovns %edx,%eax
+  8006a4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8006a7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8006aa:	e9 6a ff ff ff       	jmp    800619 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8006af:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8006b2:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8006b9:	e9 5b ff ff ff       	jmp    800619 <vprintfmt+0x54>
+  8006be:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8006c1:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8006c4:	eb bc                	jmp    800682 <vprintfmt+0xbd>
+			lflag++;
+  8006c6:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8006c9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8006cc:	e9 48 ff ff ff       	jmp    800619 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8006d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d4:	8d 78 04             	lea    0x4(%eax),%edi
+  8006d7:	83 ec 08             	sub    $0x8,%esp
+  8006da:	53                   	push   %ebx
+  8006db:	ff 30                	push   (%eax)
+  8006dd:	ff d6                	call   *%esi
+			break;
+  8006df:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8006e2:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8006e5:	e9 7c 02 00 00       	jmp    800966 <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  8006ea:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ed:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8006f0:	8b 10                	mov    (%eax),%edx
+  8006f2:	89 d0                	mov    %edx,%eax
+  8006f4:	f7 d8                	neg    %eax
+  8006f6:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8006f9:	83 f8 10             	cmp    $0x10,%eax
+  8006fc:	7f 23                	jg     800721 <vprintfmt+0x15c>
+  8006fe:	8b 14 85 20 31 80 00 	mov    0x803120(,%eax,4),%edx
+  800705:	85 d2                	test   %edx,%edx
+  800707:	74 18                	je     800721 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800709:	52                   	push   %edx
+  80070a:	68 59 32 80 00       	push   $0x803259
+  80070f:	53                   	push   %ebx
+  800710:	56                   	push   %esi
+  800711:	e8 92 fe ff ff       	call   8005a8 <printfmt>
+  800716:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800719:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80071c:	e9 45 02 00 00       	jmp    800966 <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  800721:	50                   	push   %eax
+  800722:	68 87 2e 80 00       	push   $0x802e87
+  800727:	53                   	push   %ebx
+  800728:	56                   	push   %esi
+  800729:	e8 7a fe ff ff       	call   8005a8 <printfmt>
+  80072e:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800731:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800734:	e9 2d 02 00 00       	jmp    800966 <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800739:	8b 45 14             	mov    0x14(%ebp),%eax
+  80073c:	83 c0 04             	add    $0x4,%eax
+  80073f:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800742:	8b 45 14             	mov    0x14(%ebp),%eax
+  800745:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800747:	85 c9                	test   %ecx,%ecx
+  800749:	b8 80 2e 80 00       	mov    $0x802e80,%eax
+  80074e:	0f 45 c1             	cmovne %ecx,%eax
+  800751:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800754:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800758:	7e 06                	jle    800760 <vprintfmt+0x19b>
+  80075a:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80075e:	75 0b                	jne    80076b <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800760:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800763:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800766:	89 75 08             	mov    %esi,0x8(%ebp)
+  800769:	eb 5c                	jmp    8007c7 <vprintfmt+0x202>
+  80076b:	83 ec 08             	sub    $0x8,%esp
+  80076e:	ff 75 d0             	push   -0x30(%ebp)
+  800771:	ff 75 cc             	push   -0x34(%ebp)
+  800774:	e8 eb 02 00 00       	call   800a64 <strnlen>
+  800779:	89 c2                	mov    %eax,%edx
+  80077b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80077e:	29 d0                	sub    %edx,%eax
+  800780:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800783:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800787:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80078a:	89 75 08             	mov    %esi,0x8(%ebp)
+  80078d:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80078f:	eb 0e                	jmp    80079f <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800791:	83 ec 08             	sub    $0x8,%esp
+  800794:	53                   	push   %ebx
+  800795:	57                   	push   %edi
+  800796:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800799:	83 ee 01             	sub    $0x1,%esi
+  80079c:	83 c4 10             	add    $0x10,%esp
+  80079f:	85 f6                	test   %esi,%esi
+  8007a1:	7f ee                	jg     800791 <vprintfmt+0x1cc>
+  8007a3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8007a6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007a9:	85 c0                	test   %eax,%eax
+  8007ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8007b0:	0f 49 d0             	cmovns %eax,%edx
+  8007b3:	29 d0                	sub    %edx,%eax
+  8007b5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8007b8:	eb a6                	jmp    800760 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8007ba:	83 ec 08             	sub    $0x8,%esp
+  8007bd:	53                   	push   %ebx
+  8007be:	52                   	push   %edx
+  8007bf:	ff 55 08             	call   *0x8(%ebp)
+  8007c2:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8007c5:	89 f1                	mov    %esi,%ecx
+  8007c7:	8d 71 01             	lea    0x1(%ecx),%esi
+  8007ca:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8007ce:	0f be d0             	movsbl %al,%edx
+  8007d1:	85 d2                	test   %edx,%edx
+  8007d3:	74 28                	je     8007fd <vprintfmt+0x238>
+  8007d5:	85 ff                	test   %edi,%edi
+  8007d7:	78 05                	js     8007de <vprintfmt+0x219>
+  8007d9:	83 ef 01             	sub    $0x1,%edi
+  8007dc:	78 30                	js     80080e <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8007de:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8007e2:	74 d6                	je     8007ba <vprintfmt+0x1f5>
+  8007e4:	0f be c0             	movsbl %al,%eax
+  8007e7:	83 e8 20             	sub    $0x20,%eax
+  8007ea:	83 f8 5e             	cmp    $0x5e,%eax
+  8007ed:	76 cb                	jbe    8007ba <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8007ef:	83 ec 08             	sub    $0x8,%esp
+  8007f2:	53                   	push   %ebx
+  8007f3:	6a 3f                	push   $0x3f
+  8007f5:	ff 55 08             	call   *0x8(%ebp)
+  8007f8:	83 c4 10             	add    $0x10,%esp
+  8007fb:	eb c8                	jmp    8007c5 <vprintfmt+0x200>
+  8007fd:	8b 75 08             	mov    0x8(%ebp),%esi
+  800800:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800803:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800806:	01 d0                	add    %edx,%eax
+  800808:	29 c8                	sub    %ecx,%eax
+  80080a:	89 c7                	mov    %eax,%edi
+  80080c:	eb 13                	jmp    800821 <vprintfmt+0x25c>
+  80080e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800811:	eb ed                	jmp    800800 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800813:	83 ec 08             	sub    $0x8,%esp
+  800816:	53                   	push   %ebx
+  800817:	6a 20                	push   $0x20
+  800819:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80081b:	83 ef 01             	sub    $0x1,%edi
+  80081e:	83 c4 10             	add    $0x10,%esp
+  800821:	85 ff                	test   %edi,%edi
+  800823:	7f ee                	jg     800813 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800825:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800828:	89 45 14             	mov    %eax,0x14(%ebp)
+  80082b:	e9 36 01 00 00       	jmp    800966 <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  800830:	83 f9 01             	cmp    $0x1,%ecx
+  800833:	7f 1f                	jg     800854 <vprintfmt+0x28f>
+	else if (lflag)
+  800835:	85 c9                	test   %ecx,%ecx
+  800837:	74 67                	je     8008a0 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800839:	8b 45 14             	mov    0x14(%ebp),%eax
+  80083c:	8b 00                	mov    (%eax),%eax
+  80083e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800841:	89 c1                	mov    %eax,%ecx
+  800843:	c1 f9 1f             	sar    $0x1f,%ecx
+  800846:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800849:	8b 45 14             	mov    0x14(%ebp),%eax
+  80084c:	8d 40 04             	lea    0x4(%eax),%eax
+  80084f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800852:	eb 17                	jmp    80086b <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800854:	8b 45 14             	mov    0x14(%ebp),%eax
+  800857:	8b 50 04             	mov    0x4(%eax),%edx
+  80085a:	8b 00                	mov    (%eax),%eax
+  80085c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80085f:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800862:	8b 45 14             	mov    0x14(%ebp),%eax
+  800865:	8d 40 08             	lea    0x8(%eax),%eax
+  800868:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80086b:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80086e:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800871:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800876:	85 c9                	test   %ecx,%ecx
+  800878:	0f 89 ce 00 00 00    	jns    80094c <vprintfmt+0x387>
+				putch('-', putdat);
+  80087e:	83 ec 08             	sub    $0x8,%esp
+  800881:	53                   	push   %ebx
+  800882:	6a 2d                	push   $0x2d
+  800884:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800886:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800889:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80088c:	f7 da                	neg    %edx
+  80088e:	83 d1 00             	adc    $0x0,%ecx
+  800891:	f7 d9                	neg    %ecx
+  800893:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800896:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80089b:	e9 ac 00 00 00       	jmp    80094c <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  8008a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008a3:	8b 00                	mov    (%eax),%eax
+  8008a5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8008a8:	89 c1                	mov    %eax,%ecx
+  8008aa:	c1 f9 1f             	sar    $0x1f,%ecx
+  8008ad:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8008b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008b3:	8d 40 04             	lea    0x4(%eax),%eax
+  8008b6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008b9:	eb b0                	jmp    80086b <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8008bb:	83 f9 01             	cmp    $0x1,%ecx
+  8008be:	7f 1b                	jg     8008db <vprintfmt+0x316>
+	else if (lflag)
+  8008c0:	85 c9                	test   %ecx,%ecx
+  8008c2:	74 2c                	je     8008f0 <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  8008c4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008c7:	8b 10                	mov    (%eax),%edx
+  8008c9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008ce:	8d 40 04             	lea    0x4(%eax),%eax
+  8008d1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8008d4:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8008d9:	eb 71                	jmp    80094c <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  8008db:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008de:	8b 10                	mov    (%eax),%edx
+  8008e0:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008e3:	8d 40 08             	lea    0x8(%eax),%eax
+  8008e6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8008e9:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8008ee:	eb 5c                	jmp    80094c <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  8008f0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008f3:	8b 10                	mov    (%eax),%edx
+  8008f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008fa:	8d 40 04             	lea    0x4(%eax),%eax
+  8008fd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800900:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800905:	eb 45                	jmp    80094c <vprintfmt+0x387>
+			putch('X', putdat);
+  800907:	83 ec 08             	sub    $0x8,%esp
+  80090a:	53                   	push   %ebx
+  80090b:	6a 58                	push   $0x58
+  80090d:	ff d6                	call   *%esi
+			putch('X', putdat);
+  80090f:	83 c4 08             	add    $0x8,%esp
+  800912:	53                   	push   %ebx
+  800913:	6a 58                	push   $0x58
+  800915:	ff d6                	call   *%esi
+			putch('X', putdat);
+  800917:	83 c4 08             	add    $0x8,%esp
+  80091a:	53                   	push   %ebx
+  80091b:	6a 58                	push   $0x58
+  80091d:	ff d6                	call   *%esi
+			break;
+  80091f:	83 c4 10             	add    $0x10,%esp
+  800922:	eb 42                	jmp    800966 <vprintfmt+0x3a1>
+			putch('0', putdat);
+  800924:	83 ec 08             	sub    $0x8,%esp
+  800927:	53                   	push   %ebx
+  800928:	6a 30                	push   $0x30
+  80092a:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80092c:	83 c4 08             	add    $0x8,%esp
+  80092f:	53                   	push   %ebx
+  800930:	6a 78                	push   $0x78
+  800932:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800934:	8b 45 14             	mov    0x14(%ebp),%eax
+  800937:	8b 10                	mov    (%eax),%edx
+  800939:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80093e:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800941:	8d 40 04             	lea    0x4(%eax),%eax
+  800944:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800947:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80094c:	83 ec 0c             	sub    $0xc,%esp
+  80094f:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800953:	50                   	push   %eax
+  800954:	ff 75 e0             	push   -0x20(%ebp)
+  800957:	57                   	push   %edi
+  800958:	51                   	push   %ecx
+  800959:	52                   	push   %edx
+  80095a:	89 da                	mov    %ebx,%edx
+  80095c:	89 f0                	mov    %esi,%eax
+  80095e:	e8 7f fb ff ff       	call   8004e2 <printnum>
+			break;
+  800963:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800966:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800969:	e9 75 fc ff ff       	jmp    8005e3 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  80096e:	83 f9 01             	cmp    $0x1,%ecx
+  800971:	7f 1b                	jg     80098e <vprintfmt+0x3c9>
+	else if (lflag)
+  800973:	85 c9                	test   %ecx,%ecx
+  800975:	74 2c                	je     8009a3 <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  800977:	8b 45 14             	mov    0x14(%ebp),%eax
+  80097a:	8b 10                	mov    (%eax),%edx
+  80097c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800981:	8d 40 04             	lea    0x4(%eax),%eax
+  800984:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800987:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  80098c:	eb be                	jmp    80094c <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  80098e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800991:	8b 10                	mov    (%eax),%edx
+  800993:	8b 48 04             	mov    0x4(%eax),%ecx
+  800996:	8d 40 08             	lea    0x8(%eax),%eax
+  800999:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80099c:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8009a1:	eb a9                	jmp    80094c <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  8009a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009a6:	8b 10                	mov    (%eax),%edx
+  8009a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009ad:	8d 40 04             	lea    0x4(%eax),%eax
+  8009b0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009b3:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8009b8:	eb 92                	jmp    80094c <vprintfmt+0x387>
+			putch(ch, putdat);
+  8009ba:	83 ec 08             	sub    $0x8,%esp
+  8009bd:	53                   	push   %ebx
+  8009be:	6a 25                	push   $0x25
+  8009c0:	ff d6                	call   *%esi
+			break;
+  8009c2:	83 c4 10             	add    $0x10,%esp
+  8009c5:	eb 9f                	jmp    800966 <vprintfmt+0x3a1>
+			putch('%', putdat);
+  8009c7:	83 ec 08             	sub    $0x8,%esp
+  8009ca:	53                   	push   %ebx
+  8009cb:	6a 25                	push   $0x25
+  8009cd:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8009cf:	83 c4 10             	add    $0x10,%esp
+  8009d2:	89 f8                	mov    %edi,%eax
+  8009d4:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8009d8:	74 05                	je     8009df <vprintfmt+0x41a>
+  8009da:	83 e8 01             	sub    $0x1,%eax
+  8009dd:	eb f5                	jmp    8009d4 <vprintfmt+0x40f>
+  8009df:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8009e2:	eb 82                	jmp    800966 <vprintfmt+0x3a1>
+
+008009e4 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8009e4:	55                   	push   %ebp
+  8009e5:	89 e5                	mov    %esp,%ebp
+  8009e7:	83 ec 18             	sub    $0x18,%esp
+  8009ea:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009ed:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8009f0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8009f3:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8009f7:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8009fa:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800a01:	85 c0                	test   %eax,%eax
+  800a03:	74 26                	je     800a2b <vsnprintf+0x47>
+  800a05:	85 d2                	test   %edx,%edx
+  800a07:	7e 22                	jle    800a2b <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800a09:	ff 75 14             	push   0x14(%ebp)
+  800a0c:	ff 75 10             	push   0x10(%ebp)
+  800a0f:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800a12:	50                   	push   %eax
+  800a13:	68 8b 05 80 00       	push   $0x80058b
+  800a18:	e8 a8 fb ff ff       	call   8005c5 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800a1d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800a20:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800a23:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a26:	83 c4 10             	add    $0x10,%esp
+}
+  800a29:	c9                   	leave
+  800a2a:	c3                   	ret
+		return -E_INVAL;
+  800a2b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a30:	eb f7                	jmp    800a29 <vsnprintf+0x45>
+
+00800a32 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800a32:	55                   	push   %ebp
+  800a33:	89 e5                	mov    %esp,%ebp
+  800a35:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800a38:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800a3b:	50                   	push   %eax
+  800a3c:	ff 75 10             	push   0x10(%ebp)
+  800a3f:	ff 75 0c             	push   0xc(%ebp)
+  800a42:	ff 75 08             	push   0x8(%ebp)
+  800a45:	e8 9a ff ff ff       	call   8009e4 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800a4a:	c9                   	leave
+  800a4b:	c3                   	ret
+
+00800a4c <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800a4c:	55                   	push   %ebp
+  800a4d:	89 e5                	mov    %esp,%ebp
+  800a4f:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800a52:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a57:	eb 03                	jmp    800a5c <strlen+0x10>
+		n++;
+  800a59:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800a5c:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800a60:	75 f7                	jne    800a59 <strlen+0xd>
+	return n;
+}
+  800a62:	5d                   	pop    %ebp
+  800a63:	c3                   	ret
+
+00800a64 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800a64:	55                   	push   %ebp
+  800a65:	89 e5                	mov    %esp,%ebp
+  800a67:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a6a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a72:	eb 03                	jmp    800a77 <strnlen+0x13>
+		n++;
+  800a74:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a77:	39 d0                	cmp    %edx,%eax
+  800a79:	74 08                	je     800a83 <strnlen+0x1f>
+  800a7b:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800a7f:	75 f3                	jne    800a74 <strnlen+0x10>
+  800a81:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800a83:	89 d0                	mov    %edx,%eax
+  800a85:	5d                   	pop    %ebp
+  800a86:	c3                   	ret
+
+00800a87 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800a87:	55                   	push   %ebp
+  800a88:	89 e5                	mov    %esp,%ebp
+  800a8a:	53                   	push   %ebx
+  800a8b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a8e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800a91:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a96:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800a9a:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800a9d:	83 c0 01             	add    $0x1,%eax
+  800aa0:	84 d2                	test   %dl,%dl
+  800aa2:	75 f2                	jne    800a96 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800aa4:	89 c8                	mov    %ecx,%eax
+  800aa6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800aa9:	c9                   	leave
+  800aaa:	c3                   	ret
+
+00800aab <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800aab:	55                   	push   %ebp
+  800aac:	89 e5                	mov    %esp,%ebp
+  800aae:	53                   	push   %ebx
+  800aaf:	83 ec 10             	sub    $0x10,%esp
+  800ab2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800ab5:	53                   	push   %ebx
+  800ab6:	e8 91 ff ff ff       	call   800a4c <strlen>
+  800abb:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800abe:	ff 75 0c             	push   0xc(%ebp)
+  800ac1:	01 d8                	add    %ebx,%eax
+  800ac3:	50                   	push   %eax
+  800ac4:	e8 be ff ff ff       	call   800a87 <strcpy>
+	return dst;
+}
+  800ac9:	89 d8                	mov    %ebx,%eax
+  800acb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ace:	c9                   	leave
+  800acf:	c3                   	ret
+
+00800ad0 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800ad0:	55                   	push   %ebp
+  800ad1:	89 e5                	mov    %esp,%ebp
+  800ad3:	56                   	push   %esi
+  800ad4:	53                   	push   %ebx
+  800ad5:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ad8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800adb:	89 f3                	mov    %esi,%ebx
+  800add:	03 5d 10             	add    0x10(%ebp),%ebx
+  800ae0:	89 f0                	mov    %esi,%eax
+  800ae2:	eb 0f                	jmp    800af3 <strncpy+0x23>
+		*dst++ = *src;
+  800ae4:	83 c0 01             	add    $0x1,%eax
+  800ae7:	0f b6 0a             	movzbl (%edx),%ecx
+  800aea:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800aed:	80 f9 01             	cmp    $0x1,%cl
+  800af0:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800af3:	39 d8                	cmp    %ebx,%eax
+  800af5:	75 ed                	jne    800ae4 <strncpy+0x14>
+	}
+	return ret;
+}
+  800af7:	89 f0                	mov    %esi,%eax
+  800af9:	5b                   	pop    %ebx
+  800afa:	5e                   	pop    %esi
+  800afb:	5d                   	pop    %ebp
+  800afc:	c3                   	ret
+
+00800afd <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800afd:	55                   	push   %ebp
+  800afe:	89 e5                	mov    %esp,%ebp
+  800b00:	56                   	push   %esi
+  800b01:	53                   	push   %ebx
+  800b02:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b05:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b08:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800b0b:	89 f0                	mov    %esi,%eax
+  800b0d:	85 d2                	test   %edx,%edx
+  800b0f:	74 21                	je     800b32 <strlcpy+0x35>
+  800b11:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800b15:	89 f2                	mov    %esi,%edx
+  800b17:	eb 09                	jmp    800b22 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800b19:	83 c1 01             	add    $0x1,%ecx
+  800b1c:	83 c2 01             	add    $0x1,%edx
+  800b1f:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800b22:	39 c2                	cmp    %eax,%edx
+  800b24:	74 09                	je     800b2f <strlcpy+0x32>
+  800b26:	0f b6 19             	movzbl (%ecx),%ebx
+  800b29:	84 db                	test   %bl,%bl
+  800b2b:	75 ec                	jne    800b19 <strlcpy+0x1c>
+  800b2d:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800b2f:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800b32:	29 f0                	sub    %esi,%eax
+}
+  800b34:	5b                   	pop    %ebx
+  800b35:	5e                   	pop    %esi
+  800b36:	5d                   	pop    %ebp
+  800b37:	c3                   	ret
+
+00800b38 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800b38:	55                   	push   %ebp
+  800b39:	89 e5                	mov    %esp,%ebp
+  800b3b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b3e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800b41:	eb 06                	jmp    800b49 <strcmp+0x11>
+		p++, q++;
+  800b43:	83 c1 01             	add    $0x1,%ecx
+  800b46:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800b49:	0f b6 01             	movzbl (%ecx),%eax
+  800b4c:	84 c0                	test   %al,%al
+  800b4e:	74 04                	je     800b54 <strcmp+0x1c>
+  800b50:	3a 02                	cmp    (%edx),%al
+  800b52:	74 ef                	je     800b43 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b54:	0f b6 c0             	movzbl %al,%eax
+  800b57:	0f b6 12             	movzbl (%edx),%edx
+  800b5a:	29 d0                	sub    %edx,%eax
+}
+  800b5c:	5d                   	pop    %ebp
+  800b5d:	c3                   	ret
+
+00800b5e <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800b5e:	55                   	push   %ebp
+  800b5f:	89 e5                	mov    %esp,%ebp
+  800b61:	53                   	push   %ebx
+  800b62:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b65:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b68:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800b6b:	eb 09                	jmp    800b76 <strncmp+0x18>
+		n--, p++, q++;
+  800b6d:	83 ea 01             	sub    $0x1,%edx
+  800b70:	83 c0 01             	add    $0x1,%eax
+  800b73:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800b76:	85 d2                	test   %edx,%edx
+  800b78:	74 18                	je     800b92 <strncmp+0x34>
+  800b7a:	0f b6 18             	movzbl (%eax),%ebx
+  800b7d:	84 db                	test   %bl,%bl
+  800b7f:	74 04                	je     800b85 <strncmp+0x27>
+  800b81:	3a 19                	cmp    (%ecx),%bl
+  800b83:	74 e8                	je     800b6d <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b85:	0f b6 00             	movzbl (%eax),%eax
+  800b88:	0f b6 11             	movzbl (%ecx),%edx
+  800b8b:	29 d0                	sub    %edx,%eax
+}
+  800b8d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b90:	c9                   	leave
+  800b91:	c3                   	ret
+		return 0;
+  800b92:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b97:	eb f4                	jmp    800b8d <strncmp+0x2f>
+
+00800b99 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800b99:	55                   	push   %ebp
+  800b9a:	89 e5                	mov    %esp,%ebp
+  800b9c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b9f:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800ba3:	eb 03                	jmp    800ba8 <strchr+0xf>
+  800ba5:	83 c0 01             	add    $0x1,%eax
+  800ba8:	0f b6 10             	movzbl (%eax),%edx
+  800bab:	84 d2                	test   %dl,%dl
+  800bad:	74 06                	je     800bb5 <strchr+0x1c>
+		if (*s == c)
+  800baf:	38 ca                	cmp    %cl,%dl
+  800bb1:	75 f2                	jne    800ba5 <strchr+0xc>
+  800bb3:	eb 05                	jmp    800bba <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800bb5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800bba:	5d                   	pop    %ebp
+  800bbb:	c3                   	ret
+
+00800bbc <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800bbc:	55                   	push   %ebp
+  800bbd:	89 e5                	mov    %esp,%ebp
+  800bbf:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bc2:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800bc6:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800bc9:	38 ca                	cmp    %cl,%dl
+  800bcb:	74 09                	je     800bd6 <strfind+0x1a>
+  800bcd:	84 d2                	test   %dl,%dl
+  800bcf:	74 05                	je     800bd6 <strfind+0x1a>
+	for (; *s; s++)
+  800bd1:	83 c0 01             	add    $0x1,%eax
+  800bd4:	eb f0                	jmp    800bc6 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800bd6:	5d                   	pop    %ebp
+  800bd7:	c3                   	ret
+
+00800bd8 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800bd8:	55                   	push   %ebp
+  800bd9:	89 e5                	mov    %esp,%ebp
+  800bdb:	57                   	push   %edi
+  800bdc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800bdf:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800be2:	85 c9                	test   %ecx,%ecx
+  800be4:	74 20                	je     800c06 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800be6:	89 f8                	mov    %edi,%eax
+  800be8:	09 c8                	or     %ecx,%eax
+  800bea:	a8 03                	test   $0x3,%al
+  800bec:	75 12                	jne    800c00 <memset+0x28>
+		c &= 0xFF;
+  800bee:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800bf2:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800bf8:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800bfb:	fc                   	cld
+  800bfc:	f3 ab                	rep stos %eax,%es:(%edi)
+  800bfe:	eb 06                	jmp    800c06 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800c00:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c03:	fc                   	cld
+  800c04:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800c06:	89 f8                	mov    %edi,%eax
+  800c08:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800c0b:	c9                   	leave
+  800c0c:	c3                   	ret
+
+00800c0d <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800c0d:	55                   	push   %ebp
+  800c0e:	89 e5                	mov    %esp,%ebp
+  800c10:	57                   	push   %edi
+  800c11:	56                   	push   %esi
+  800c12:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c15:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c18:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800c1b:	39 c6                	cmp    %eax,%esi
+  800c1d:	73 32                	jae    800c51 <memmove+0x44>
+  800c1f:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800c22:	39 d0                	cmp    %edx,%eax
+  800c24:	73 2b                	jae    800c51 <memmove+0x44>
+		s += n;
+		d += n;
+  800c26:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c29:	89 d6                	mov    %edx,%esi
+  800c2b:	09 fe                	or     %edi,%esi
+  800c2d:	09 ce                	or     %ecx,%esi
+  800c2f:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800c35:	75 0e                	jne    800c45 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800c37:	83 ef 04             	sub    $0x4,%edi
+  800c3a:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800c3d:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800c40:	fd                   	std
+  800c41:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c43:	eb 09                	jmp    800c4e <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800c45:	83 ef 01             	sub    $0x1,%edi
+  800c48:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800c4b:	fd                   	std
+  800c4c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800c4e:	fc                   	cld
+  800c4f:	eb 1a                	jmp    800c6b <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c51:	89 f2                	mov    %esi,%edx
+  800c53:	09 c2                	or     %eax,%edx
+  800c55:	09 ca                	or     %ecx,%edx
+  800c57:	f6 c2 03             	test   $0x3,%dl
+  800c5a:	75 0a                	jne    800c66 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800c5c:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800c5f:	89 c7                	mov    %eax,%edi
+  800c61:	fc                   	cld
+  800c62:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c64:	eb 05                	jmp    800c6b <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800c66:	89 c7                	mov    %eax,%edi
+  800c68:	fc                   	cld
+  800c69:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800c6b:	5e                   	pop    %esi
+  800c6c:	5f                   	pop    %edi
+  800c6d:	5d                   	pop    %ebp
+  800c6e:	c3                   	ret
+
+00800c6f <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800c6f:	55                   	push   %ebp
+  800c70:	89 e5                	mov    %esp,%ebp
+  800c72:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800c75:	ff 75 10             	push   0x10(%ebp)
+  800c78:	ff 75 0c             	push   0xc(%ebp)
+  800c7b:	ff 75 08             	push   0x8(%ebp)
+  800c7e:	e8 8a ff ff ff       	call   800c0d <memmove>
+}
+  800c83:	c9                   	leave
+  800c84:	c3                   	ret
+
+00800c85 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800c85:	55                   	push   %ebp
+  800c86:	89 e5                	mov    %esp,%ebp
+  800c88:	56                   	push   %esi
+  800c89:	53                   	push   %ebx
+  800c8a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c8d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800c90:	89 c6                	mov    %eax,%esi
+  800c92:	03 75 10             	add    0x10(%ebp),%esi
+  800c95:	eb 06                	jmp    800c9d <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800c97:	83 c0 01             	add    $0x1,%eax
+  800c9a:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800c9d:	39 f0                	cmp    %esi,%eax
+  800c9f:	74 14                	je     800cb5 <memcmp+0x30>
+		if (*s1 != *s2)
+  800ca1:	0f b6 08             	movzbl (%eax),%ecx
+  800ca4:	0f b6 1a             	movzbl (%edx),%ebx
+  800ca7:	38 d9                	cmp    %bl,%cl
+  800ca9:	74 ec                	je     800c97 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800cab:	0f b6 c1             	movzbl %cl,%eax
+  800cae:	0f b6 db             	movzbl %bl,%ebx
+  800cb1:	29 d8                	sub    %ebx,%eax
+  800cb3:	eb 05                	jmp    800cba <memcmp+0x35>
+	}
+
+	return 0;
+  800cb5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800cba:	5b                   	pop    %ebx
+  800cbb:	5e                   	pop    %esi
+  800cbc:	5d                   	pop    %ebp
+  800cbd:	c3                   	ret
+
+00800cbe <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800cbe:	55                   	push   %ebp
+  800cbf:	89 e5                	mov    %esp,%ebp
+  800cc1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cc4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800cc7:	89 c2                	mov    %eax,%edx
+  800cc9:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800ccc:	eb 03                	jmp    800cd1 <memfind+0x13>
+  800cce:	83 c0 01             	add    $0x1,%eax
+  800cd1:	39 d0                	cmp    %edx,%eax
+  800cd3:	73 04                	jae    800cd9 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800cd5:	38 08                	cmp    %cl,(%eax)
+  800cd7:	75 f5                	jne    800cce <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800cd9:	5d                   	pop    %ebp
+  800cda:	c3                   	ret
+
+00800cdb <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800cdb:	55                   	push   %ebp
+  800cdc:	89 e5                	mov    %esp,%ebp
+  800cde:	57                   	push   %edi
+  800cdf:	56                   	push   %esi
+  800ce0:	53                   	push   %ebx
+  800ce1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ce4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800ce7:	eb 03                	jmp    800cec <strtol+0x11>
+		s++;
+  800ce9:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800cec:	0f b6 02             	movzbl (%edx),%eax
+  800cef:	3c 20                	cmp    $0x20,%al
+  800cf1:	74 f6                	je     800ce9 <strtol+0xe>
+  800cf3:	3c 09                	cmp    $0x9,%al
+  800cf5:	74 f2                	je     800ce9 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800cf7:	3c 2b                	cmp    $0x2b,%al
+  800cf9:	74 2a                	je     800d25 <strtol+0x4a>
+	int neg = 0;
+  800cfb:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800d00:	3c 2d                	cmp    $0x2d,%al
+  800d02:	74 2b                	je     800d2f <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d04:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800d0a:	75 0f                	jne    800d1b <strtol+0x40>
+  800d0c:	80 3a 30             	cmpb   $0x30,(%edx)
+  800d0f:	74 28                	je     800d39 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800d11:	85 db                	test   %ebx,%ebx
+  800d13:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d18:	0f 44 d8             	cmove  %eax,%ebx
+  800d1b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d20:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800d23:	eb 46                	jmp    800d6b <strtol+0x90>
+		s++;
+  800d25:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800d28:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d2d:	eb d5                	jmp    800d04 <strtol+0x29>
+		s++, neg = 1;
+  800d2f:	83 c2 01             	add    $0x1,%edx
+  800d32:	bf 01 00 00 00       	mov    $0x1,%edi
+  800d37:	eb cb                	jmp    800d04 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d39:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800d3d:	74 0e                	je     800d4d <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800d3f:	85 db                	test   %ebx,%ebx
+  800d41:	75 d8                	jne    800d1b <strtol+0x40>
+		s++, base = 8;
+  800d43:	83 c2 01             	add    $0x1,%edx
+  800d46:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800d4b:	eb ce                	jmp    800d1b <strtol+0x40>
+		s += 2, base = 16;
+  800d4d:	83 c2 02             	add    $0x2,%edx
+  800d50:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800d55:	eb c4                	jmp    800d1b <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800d57:	0f be c0             	movsbl %al,%eax
+  800d5a:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800d5d:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800d60:	7d 3a                	jge    800d9c <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800d62:	83 c2 01             	add    $0x1,%edx
+  800d65:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800d69:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800d6b:	0f b6 02             	movzbl (%edx),%eax
+  800d6e:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800d71:	89 f3                	mov    %esi,%ebx
+  800d73:	80 fb 09             	cmp    $0x9,%bl
+  800d76:	76 df                	jbe    800d57 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800d78:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800d7b:	89 f3                	mov    %esi,%ebx
+  800d7d:	80 fb 19             	cmp    $0x19,%bl
+  800d80:	77 08                	ja     800d8a <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800d82:	0f be c0             	movsbl %al,%eax
+  800d85:	83 e8 57             	sub    $0x57,%eax
+  800d88:	eb d3                	jmp    800d5d <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800d8a:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800d8d:	89 f3                	mov    %esi,%ebx
+  800d8f:	80 fb 19             	cmp    $0x19,%bl
+  800d92:	77 08                	ja     800d9c <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800d94:	0f be c0             	movsbl %al,%eax
+  800d97:	83 e8 37             	sub    $0x37,%eax
+  800d9a:	eb c1                	jmp    800d5d <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800d9c:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800da0:	74 05                	je     800da7 <strtol+0xcc>
+		*endptr = (char *) s;
+  800da2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800da5:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800da7:	89 c8                	mov    %ecx,%eax
+  800da9:	f7 d8                	neg    %eax
+  800dab:	85 ff                	test   %edi,%edi
+  800dad:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800db0:	89 c8                	mov    %ecx,%eax
+  800db2:	5b                   	pop    %ebx
+  800db3:	5e                   	pop    %esi
+  800db4:	5f                   	pop    %edi
+  800db5:	5d                   	pop    %ebp
+  800db6:	c3                   	ret
+
+00800db7 <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800db7:	55                   	push   %ebp
+  800db8:	89 e5                	mov    %esp,%ebp
+  800dba:	57                   	push   %edi
+  800dbb:	56                   	push   %esi
+  800dbc:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800dbd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dc2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dc8:	89 c3                	mov    %eax,%ebx
+  800dca:	89 c7                	mov    %eax,%edi
+  800dcc:	89 c6                	mov    %eax,%esi
+  800dce:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  800dd0:	5b                   	pop    %ebx
+  800dd1:	5e                   	pop    %esi
+  800dd2:	5f                   	pop    %edi
+  800dd3:	5d                   	pop    %ebp
+  800dd4:	c3                   	ret
+
+00800dd5 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800dd5:	55                   	push   %ebp
+  800dd6:	89 e5                	mov    %esp,%ebp
+  800dd8:	57                   	push   %edi
+  800dd9:	56                   	push   %esi
+  800dda:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800ddb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800de0:	b8 01 00 00 00       	mov    $0x1,%eax
+  800de5:	89 d1                	mov    %edx,%ecx
+  800de7:	89 d3                	mov    %edx,%ebx
+  800de9:	89 d7                	mov    %edx,%edi
+  800deb:	89 d6                	mov    %edx,%esi
+  800ded:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800def:	5b                   	pop    %ebx
+  800df0:	5e                   	pop    %esi
+  800df1:	5f                   	pop    %edi
+  800df2:	5d                   	pop    %ebp
+  800df3:	c3                   	ret
+
+00800df4 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800df4:	55                   	push   %ebp
+  800df5:	89 e5                	mov    %esp,%ebp
+  800df7:	57                   	push   %edi
+  800df8:	56                   	push   %esi
+  800df9:	53                   	push   %ebx
+  800dfa:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800dfd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e02:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e05:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e0a:	89 cb                	mov    %ecx,%ebx
+  800e0c:	89 cf                	mov    %ecx,%edi
+  800e0e:	89 ce                	mov    %ecx,%esi
+  800e10:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e12:	85 c0                	test   %eax,%eax
+  800e14:	7f 08                	jg     800e1e <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800e16:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e19:	5b                   	pop    %ebx
+  800e1a:	5e                   	pop    %esi
+  800e1b:	5f                   	pop    %edi
+  800e1c:	5d                   	pop    %ebp
+  800e1d:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e1e:	83 ec 0c             	sub    $0xc,%esp
+  800e21:	50                   	push   %eax
+  800e22:	6a 03                	push   $0x3
+  800e24:	68 83 31 80 00       	push   $0x803183
+  800e29:	6a 3e                	push   $0x3e
+  800e2b:	68 a0 31 80 00       	push   $0x8031a0
+  800e30:	e8 be f5 ff ff       	call   8003f3 <_panic>
+
+00800e35 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800e35:	55                   	push   %ebp
+  800e36:	89 e5                	mov    %esp,%ebp
+  800e38:	57                   	push   %edi
+  800e39:	56                   	push   %esi
+  800e3a:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e3b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e40:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e45:	89 d1                	mov    %edx,%ecx
+  800e47:	89 d3                	mov    %edx,%ebx
+  800e49:	89 d7                	mov    %edx,%edi
+  800e4b:	89 d6                	mov    %edx,%esi
+  800e4d:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800e4f:	5b                   	pop    %ebx
+  800e50:	5e                   	pop    %esi
+  800e51:	5f                   	pop    %edi
+  800e52:	5d                   	pop    %ebp
+  800e53:	c3                   	ret
+
+00800e54 <sys_yield>:
+
+void
+sys_yield(void) {
+  800e54:	55                   	push   %ebp
+  800e55:	89 e5                	mov    %esp,%ebp
+  800e57:	57                   	push   %edi
+  800e58:	56                   	push   %esi
+  800e59:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e5a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e5f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e64:	89 d1                	mov    %edx,%ecx
+  800e66:	89 d3                	mov    %edx,%ebx
+  800e68:	89 d7                	mov    %edx,%edi
+  800e6a:	89 d6                	mov    %edx,%esi
+  800e6c:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800e6e:	5b                   	pop    %ebx
+  800e6f:	5e                   	pop    %esi
+  800e70:	5f                   	pop    %edi
+  800e71:	5d                   	pop    %ebp
+  800e72:	c3                   	ret
+
+00800e73 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  800e73:	55                   	push   %ebp
+  800e74:	89 e5                	mov    %esp,%ebp
+  800e76:	57                   	push   %edi
+  800e77:	56                   	push   %esi
+  800e78:	53                   	push   %ebx
+  800e79:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800e7c:	be 00 00 00 00       	mov    $0x0,%esi
+  800e81:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e84:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e87:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e8c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e8f:	89 f7                	mov    %esi,%edi
+  800e91:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e93:	85 c0                	test   %eax,%eax
+  800e95:	7f 08                	jg     800e9f <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800e97:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e9a:	5b                   	pop    %ebx
+  800e9b:	5e                   	pop    %esi
+  800e9c:	5f                   	pop    %edi
+  800e9d:	5d                   	pop    %ebp
+  800e9e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e9f:	83 ec 0c             	sub    $0xc,%esp
+  800ea2:	50                   	push   %eax
+  800ea3:	6a 04                	push   $0x4
+  800ea5:	68 83 31 80 00       	push   $0x803183
+  800eaa:	6a 3e                	push   $0x3e
+  800eac:	68 a0 31 80 00       	push   $0x8031a0
+  800eb1:	e8 3d f5 ff ff       	call   8003f3 <_panic>
+
+00800eb6 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  800eb6:	55                   	push   %ebp
+  800eb7:	89 e5                	mov    %esp,%ebp
+  800eb9:	57                   	push   %edi
+  800eba:	56                   	push   %esi
+  800ebb:	53                   	push   %ebx
+  800ebc:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800ebf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec5:	b8 05 00 00 00       	mov    $0x5,%eax
+  800eca:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ecd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ed0:	8b 75 18             	mov    0x18(%ebp),%esi
+  800ed3:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ed5:	85 c0                	test   %eax,%eax
+  800ed7:	7f 08                	jg     800ee1 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800ed9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800edc:	5b                   	pop    %ebx
+  800edd:	5e                   	pop    %esi
+  800ede:	5f                   	pop    %edi
+  800edf:	5d                   	pop    %ebp
+  800ee0:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ee1:	83 ec 0c             	sub    $0xc,%esp
+  800ee4:	50                   	push   %eax
+  800ee5:	6a 05                	push   $0x5
+  800ee7:	68 83 31 80 00       	push   $0x803183
+  800eec:	6a 3e                	push   $0x3e
+  800eee:	68 a0 31 80 00       	push   $0x8031a0
+  800ef3:	e8 fb f4 ff ff       	call   8003f3 <_panic>
+
+00800ef8 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  800ef8:	55                   	push   %ebp
+  800ef9:	89 e5                	mov    %esp,%ebp
+  800efb:	57                   	push   %edi
+  800efc:	56                   	push   %esi
+  800efd:	53                   	push   %ebx
+  800efe:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800f01:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f06:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f09:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f0c:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f11:	89 df                	mov    %ebx,%edi
+  800f13:	89 de                	mov    %ebx,%esi
+  800f15:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f17:	85 c0                	test   %eax,%eax
+  800f19:	7f 08                	jg     800f23 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800f1b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f1e:	5b                   	pop    %ebx
+  800f1f:	5e                   	pop    %esi
+  800f20:	5f                   	pop    %edi
+  800f21:	5d                   	pop    %ebp
+  800f22:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f23:	83 ec 0c             	sub    $0xc,%esp
+  800f26:	50                   	push   %eax
+  800f27:	6a 06                	push   $0x6
+  800f29:	68 83 31 80 00       	push   $0x803183
+  800f2e:	6a 3e                	push   $0x3e
+  800f30:	68 a0 31 80 00       	push   $0x8031a0
+  800f35:	e8 b9 f4 ff ff       	call   8003f3 <_panic>
+
+00800f3a <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800f3a:	55                   	push   %ebp
+  800f3b:	89 e5                	mov    %esp,%ebp
+  800f3d:	57                   	push   %edi
+  800f3e:	56                   	push   %esi
+  800f3f:	53                   	push   %ebx
+  800f40:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800f43:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f48:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f4b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f4e:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f53:	89 df                	mov    %ebx,%edi
+  800f55:	89 de                	mov    %ebx,%esi
+  800f57:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f59:	85 c0                	test   %eax,%eax
+  800f5b:	7f 08                	jg     800f65 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800f5d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f60:	5b                   	pop    %ebx
+  800f61:	5e                   	pop    %esi
+  800f62:	5f                   	pop    %edi
+  800f63:	5d                   	pop    %ebp
+  800f64:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f65:	83 ec 0c             	sub    $0xc,%esp
+  800f68:	50                   	push   %eax
+  800f69:	6a 08                	push   $0x8
+  800f6b:	68 83 31 80 00       	push   $0x803183
+  800f70:	6a 3e                	push   $0x3e
+  800f72:	68 a0 31 80 00       	push   $0x8031a0
+  800f77:	e8 77 f4 ff ff       	call   8003f3 <_panic>
+
+00800f7c <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800f7c:	55                   	push   %ebp
+  800f7d:	89 e5                	mov    %esp,%ebp
+  800f7f:	57                   	push   %edi
+  800f80:	56                   	push   %esi
+  800f81:	53                   	push   %ebx
+  800f82:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800f85:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f8a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f8d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f90:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f95:	89 df                	mov    %ebx,%edi
+  800f97:	89 de                	mov    %ebx,%esi
+  800f99:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f9b:	85 c0                	test   %eax,%eax
+  800f9d:	7f 08                	jg     800fa7 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800f9f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fa2:	5b                   	pop    %ebx
+  800fa3:	5e                   	pop    %esi
+  800fa4:	5f                   	pop    %edi
+  800fa5:	5d                   	pop    %ebp
+  800fa6:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800fa7:	83 ec 0c             	sub    $0xc,%esp
+  800faa:	50                   	push   %eax
+  800fab:	6a 09                	push   $0x9
+  800fad:	68 83 31 80 00       	push   $0x803183
+  800fb2:	6a 3e                	push   $0x3e
+  800fb4:	68 a0 31 80 00       	push   $0x8031a0
+  800fb9:	e8 35 f4 ff ff       	call   8003f3 <_panic>
+
+00800fbe <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800fbe:	55                   	push   %ebp
+  800fbf:	89 e5                	mov    %esp,%ebp
+  800fc1:	57                   	push   %edi
+  800fc2:	56                   	push   %esi
+  800fc3:	53                   	push   %ebx
+  800fc4:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800fc7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fcc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fcf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fd2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fd7:	89 df                	mov    %ebx,%edi
+  800fd9:	89 de                	mov    %ebx,%esi
+  800fdb:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800fdd:	85 c0                	test   %eax,%eax
+  800fdf:	7f 08                	jg     800fe9 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800fe1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fe4:	5b                   	pop    %ebx
+  800fe5:	5e                   	pop    %esi
+  800fe6:	5f                   	pop    %edi
+  800fe7:	5d                   	pop    %ebp
+  800fe8:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800fe9:	83 ec 0c             	sub    $0xc,%esp
+  800fec:	50                   	push   %eax
+  800fed:	6a 0a                	push   $0xa
+  800fef:	68 83 31 80 00       	push   $0x803183
+  800ff4:	6a 3e                	push   $0x3e
+  800ff6:	68 a0 31 80 00       	push   $0x8031a0
+  800ffb:	e8 f3 f3 ff ff       	call   8003f3 <_panic>
+
+00801000 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  801000:	55                   	push   %ebp
+  801001:	89 e5                	mov    %esp,%ebp
+  801003:	57                   	push   %edi
+  801004:	56                   	push   %esi
+  801005:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  801006:	8b 55 08             	mov    0x8(%ebp),%edx
+  801009:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80100c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801011:	be 00 00 00 00       	mov    $0x0,%esi
+  801016:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801019:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80101c:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  80101e:	5b                   	pop    %ebx
+  80101f:	5e                   	pop    %esi
+  801020:	5f                   	pop    %edi
+  801021:	5d                   	pop    %ebp
+  801022:	c3                   	ret
+
+00801023 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  801023:	55                   	push   %ebp
+  801024:	89 e5                	mov    %esp,%ebp
+  801026:	57                   	push   %edi
+  801027:	56                   	push   %esi
+  801028:	53                   	push   %ebx
+  801029:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  80102c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801031:	8b 55 08             	mov    0x8(%ebp),%edx
+  801034:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801039:	89 cb                	mov    %ecx,%ebx
+  80103b:	89 cf                	mov    %ecx,%edi
+  80103d:	89 ce                	mov    %ecx,%esi
+  80103f:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801041:	85 c0                	test   %eax,%eax
+  801043:	7f 08                	jg     80104d <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  801045:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801048:	5b                   	pop    %ebx
+  801049:	5e                   	pop    %esi
+  80104a:	5f                   	pop    %edi
+  80104b:	5d                   	pop    %ebp
+  80104c:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80104d:	83 ec 0c             	sub    $0xc,%esp
+  801050:	50                   	push   %eax
+  801051:	6a 0d                	push   $0xd
+  801053:	68 83 31 80 00       	push   $0x803183
+  801058:	6a 3e                	push   $0x3e
+  80105a:	68 a0 31 80 00       	push   $0x8031a0
+  80105f:	e8 8f f3 ff ff       	call   8003f3 <_panic>
+
+00801064 <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  801064:	55                   	push   %ebp
+  801065:	89 e5                	mov    %esp,%ebp
+  801067:	57                   	push   %edi
+  801068:	56                   	push   %esi
+  801069:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80106a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80106f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801072:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801075:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80107a:	89 df                	mov    %ebx,%edi
+  80107c:	89 de                	mov    %ebx,%esi
+  80107e:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  801080:	5b                   	pop    %ebx
+  801081:	5e                   	pop    %esi
+  801082:	5f                   	pop    %edi
+  801083:	5d                   	pop    %ebp
+  801084:	c3                   	ret
+
+00801085 <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  801085:	55                   	push   %ebp
+  801086:	89 e5                	mov    %esp,%ebp
+  801088:	57                   	push   %edi
+  801089:	56                   	push   %esi
+  80108a:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80108b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801090:	8b 55 08             	mov    0x8(%ebp),%edx
+  801093:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801098:	89 cb                	mov    %ecx,%ebx
+  80109a:	89 cf                	mov    %ecx,%edi
+  80109c:	89 ce                	mov    %ecx,%esi
+  80109e:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  8010a0:	5b                   	pop    %ebx
+  8010a1:	5e                   	pop    %esi
+  8010a2:	5f                   	pop    %edi
+  8010a3:	5d                   	pop    %ebp
+  8010a4:	c3                   	ret
+
+008010a5 <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  8010a5:	55                   	push   %ebp
+  8010a6:	89 e5                	mov    %esp,%ebp
+  8010a8:	57                   	push   %edi
+  8010a9:	56                   	push   %esi
+  8010aa:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8010ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010b0:	b8 10 00 00 00       	mov    $0x10,%eax
+  8010b5:	89 d1                	mov    %edx,%ecx
+  8010b7:	89 d3                	mov    %edx,%ebx
+  8010b9:	89 d7                	mov    %edx,%edi
+  8010bb:	89 d6                	mov    %edx,%esi
+  8010bd:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8010bf:	5b                   	pop    %ebx
+  8010c0:	5e                   	pop    %esi
+  8010c1:	5f                   	pop    %edi
+  8010c2:	5d                   	pop    %ebp
+  8010c3:	c3                   	ret
+
+008010c4 <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  8010c4:	55                   	push   %ebp
+  8010c5:	89 e5                	mov    %esp,%ebp
+  8010c7:	57                   	push   %edi
+  8010c8:	56                   	push   %esi
+  8010c9:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8010ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010cf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010d5:	b8 11 00 00 00       	mov    $0x11,%eax
+  8010da:	89 df                	mov    %ebx,%edi
+  8010dc:	89 de                	mov    %ebx,%esi
+  8010de:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  8010e0:	5b                   	pop    %ebx
+  8010e1:	5e                   	pop    %esi
+  8010e2:	5f                   	pop    %edi
+  8010e3:	5d                   	pop    %ebp
+  8010e4:	c3                   	ret
+
+008010e5 <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  8010e5:	55                   	push   %ebp
+  8010e6:	89 e5                	mov    %esp,%ebp
+  8010e8:	57                   	push   %edi
+  8010e9:	56                   	push   %esi
+  8010ea:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8010eb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010f0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f6:	b8 12 00 00 00       	mov    $0x12,%eax
+  8010fb:	89 df                	mov    %ebx,%edi
+  8010fd:	89 de                	mov    %ebx,%esi
+  8010ff:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  801101:	5b                   	pop    %ebx
+  801102:	5e                   	pop    %esi
+  801103:	5f                   	pop    %edi
+  801104:	5d                   	pop    %ebp
+  801105:	c3                   	ret
+
+00801106 <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  801106:	55                   	push   %ebp
+  801107:	89 e5                	mov    %esp,%ebp
+  801109:	57                   	push   %edi
+  80110a:	56                   	push   %esi
+  80110b:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80110c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801111:	8b 55 08             	mov    0x8(%ebp),%edx
+  801114:	b8 13 00 00 00       	mov    $0x13,%eax
+  801119:	89 cb                	mov    %ecx,%ebx
+  80111b:	89 cf                	mov    %ecx,%edi
+  80111d:	89 ce                	mov    %ecx,%esi
+  80111f:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  801121:	5b                   	pop    %ebx
+  801122:	5e                   	pop    %esi
+  801123:	5f                   	pop    %edi
+  801124:	5d                   	pop    %ebp
+  801125:	c3                   	ret
+
+00801126 <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  801126:	55                   	push   %ebp
+  801127:	89 e5                	mov    %esp,%ebp
+  801129:	57                   	push   %edi
+  80112a:	56                   	push   %esi
+  80112b:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80112c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801131:	8b 55 08             	mov    0x8(%ebp),%edx
+  801134:	b8 14 00 00 00       	mov    $0x14,%eax
+  801139:	89 cb                	mov    %ecx,%ebx
+  80113b:	89 cf                	mov    %ecx,%edi
+  80113d:	89 ce                	mov    %ecx,%esi
+  80113f:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  801141:	5b                   	pop    %ebx
+  801142:	5e                   	pop    %esi
+  801143:	5f                   	pop    %edi
+  801144:	5d                   	pop    %ebp
+  801145:	c3                   	ret
+
+00801146 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801146:	55                   	push   %ebp
+  801147:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801149:	8b 45 08             	mov    0x8(%ebp),%eax
+  80114c:	05 00 00 00 30       	add    $0x30000000,%eax
+  801151:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801154:	5d                   	pop    %ebp
+  801155:	c3                   	ret
+
+00801156 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801156:	55                   	push   %ebp
+  801157:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801159:	8b 45 08             	mov    0x8(%ebp),%eax
+  80115c:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801161:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801166:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80116b:	5d                   	pop    %ebp
+  80116c:	c3                   	ret
+
+0080116d <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80116d:	55                   	push   %ebp
+  80116e:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801170:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801175:	eb 02                	jmp    801179 <fd_alloc+0xc>
+  801177:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801179:	89 c2                	mov    %eax,%edx
+  80117b:	c1 ea 16             	shr    $0x16,%edx
+  80117e:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801185:	f6 c2 01             	test   $0x1,%dl
+  801188:	74 2b                	je     8011b5 <fd_alloc+0x48>
+  80118a:	89 c2                	mov    %eax,%edx
+  80118c:	c1 ea 0c             	shr    $0xc,%edx
+  80118f:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801196:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80119c:	f6 c1 01             	test   $0x1,%cl
+  80119f:	74 14                	je     8011b5 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8011a1:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8011a7:	75 ce                	jne    801177 <fd_alloc+0xa>
+  8011a9:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8011ae:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8011b3:	eb 05                	jmp    8011ba <fd_alloc+0x4d>
+			return 0;
+  8011b5:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8011ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011bd:	89 02                	mov    %eax,(%edx)
+}
+  8011bf:	89 c8                	mov    %ecx,%eax
+  8011c1:	5d                   	pop    %ebp
+  8011c2:	c3                   	ret
+
+008011c3 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8011c3:	55                   	push   %ebp
+  8011c4:	89 e5                	mov    %esp,%ebp
+  8011c6:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8011c9:	83 f8 1f             	cmp    $0x1f,%eax
+  8011cc:	77 30                	ja     8011fe <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8011ce:	c1 e0 0c             	shl    $0xc,%eax
+  8011d1:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8011d6:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8011dc:	f6 c2 01             	test   $0x1,%dl
+  8011df:	74 24                	je     801205 <fd_lookup+0x42>
+  8011e1:	89 c2                	mov    %eax,%edx
+  8011e3:	c1 ea 0c             	shr    $0xc,%edx
+  8011e6:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8011ed:	f6 c2 01             	test   $0x1,%dl
+  8011f0:	74 1a                	je     80120c <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8011f2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8011f5:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8011f7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011fc:	5d                   	pop    %ebp
+  8011fd:	c3                   	ret
+		return -E_INVAL;
+  8011fe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801203:	eb f7                	jmp    8011fc <fd_lookup+0x39>
+		return -E_INVAL;
+  801205:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80120a:	eb f0                	jmp    8011fc <fd_lookup+0x39>
+  80120c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801211:	eb e9                	jmp    8011fc <fd_lookup+0x39>
+
+00801213 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801213:	55                   	push   %ebp
+  801214:	89 e5                	mov    %esp,%ebp
+  801216:	53                   	push   %ebx
+  801217:	83 ec 04             	sub    $0x4,%esp
+  80121a:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80121d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801222:	eb 03                	jmp    801227 <dev_lookup+0x14>
+  801224:	83 c0 01             	add    $0x1,%eax
+  801227:	8b 1c 85 2c 32 80 00 	mov    0x80322c(,%eax,4),%ebx
+  80122e:	85 db                	test   %ebx,%ebx
+  801230:	74 0b                	je     80123d <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801232:	39 13                	cmp    %edx,(%ebx)
+  801234:	75 ee                	jne    801224 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801236:	b8 00 00 00 00       	mov    $0x0,%eax
+  80123b:	eb 1f                	jmp    80125c <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80123d:	a1 90 77 80 00       	mov    0x807790,%eax
+  801242:	8b 40 48             	mov    0x48(%eax),%eax
+  801245:	83 ec 04             	sub    $0x4,%esp
+  801248:	52                   	push   %edx
+  801249:	50                   	push   %eax
+  80124a:	68 b0 31 80 00       	push   $0x8031b0
+  80124f:	e8 7a f2 ff ff       	call   8004ce <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801254:	83 c4 10             	add    $0x10,%esp
+  801257:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80125c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80125f:	89 1a                	mov    %ebx,(%edx)
+}
+  801261:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801264:	c9                   	leave
+  801265:	c3                   	ret
+
+00801266 <fd_close>:
+{
+  801266:	55                   	push   %ebp
+  801267:	89 e5                	mov    %esp,%ebp
+  801269:	57                   	push   %edi
+  80126a:	56                   	push   %esi
+  80126b:	53                   	push   %ebx
+  80126c:	83 ec 24             	sub    $0x24,%esp
+  80126f:	8b 75 08             	mov    0x8(%ebp),%esi
+  801272:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801275:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801278:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801279:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80127f:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801282:	50                   	push   %eax
+  801283:	e8 3b ff ff ff       	call   8011c3 <fd_lookup>
+  801288:	89 c3                	mov    %eax,%ebx
+  80128a:	83 c4 10             	add    $0x10,%esp
+  80128d:	85 c0                	test   %eax,%eax
+  80128f:	78 05                	js     801296 <fd_close+0x30>
+	    || fd != fd2)
+  801291:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801294:	74 16                	je     8012ac <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801296:	89 f8                	mov    %edi,%eax
+  801298:	84 c0                	test   %al,%al
+  80129a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80129f:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8012a2:	89 d8                	mov    %ebx,%eax
+  8012a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012a7:	5b                   	pop    %ebx
+  8012a8:	5e                   	pop    %esi
+  8012a9:	5f                   	pop    %edi
+  8012aa:	5d                   	pop    %ebp
+  8012ab:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8012ac:	83 ec 08             	sub    $0x8,%esp
+  8012af:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8012b2:	50                   	push   %eax
+  8012b3:	ff 36                	push   (%esi)
+  8012b5:	e8 59 ff ff ff       	call   801213 <dev_lookup>
+  8012ba:	89 c3                	mov    %eax,%ebx
+  8012bc:	83 c4 10             	add    $0x10,%esp
+  8012bf:	85 c0                	test   %eax,%eax
+  8012c1:	78 1a                	js     8012dd <fd_close+0x77>
+		if (dev->dev_close)
+  8012c3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8012c6:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8012c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8012ce:	85 c0                	test   %eax,%eax
+  8012d0:	74 0b                	je     8012dd <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8012d2:	83 ec 0c             	sub    $0xc,%esp
+  8012d5:	56                   	push   %esi
+  8012d6:	ff d0                	call   *%eax
+  8012d8:	89 c3                	mov    %eax,%ebx
+  8012da:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8012dd:	83 ec 08             	sub    $0x8,%esp
+  8012e0:	56                   	push   %esi
+  8012e1:	6a 00                	push   $0x0
+  8012e3:	e8 10 fc ff ff       	call   800ef8 <sys_page_unmap>
+	return r;
+  8012e8:	83 c4 10             	add    $0x10,%esp
+  8012eb:	eb b5                	jmp    8012a2 <fd_close+0x3c>
+
+008012ed <close>:
+
+int
+close(int fdnum)
+{
+  8012ed:	55                   	push   %ebp
+  8012ee:	89 e5                	mov    %esp,%ebp
+  8012f0:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8012f3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8012f6:	50                   	push   %eax
+  8012f7:	ff 75 08             	push   0x8(%ebp)
+  8012fa:	e8 c4 fe ff ff       	call   8011c3 <fd_lookup>
+  8012ff:	83 c4 10             	add    $0x10,%esp
+  801302:	85 c0                	test   %eax,%eax
+  801304:	79 02                	jns    801308 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801306:	c9                   	leave
+  801307:	c3                   	ret
+		return fd_close(fd, 1);
+  801308:	83 ec 08             	sub    $0x8,%esp
+  80130b:	6a 01                	push   $0x1
+  80130d:	ff 75 f4             	push   -0xc(%ebp)
+  801310:	e8 51 ff ff ff       	call   801266 <fd_close>
+  801315:	83 c4 10             	add    $0x10,%esp
+  801318:	eb ec                	jmp    801306 <close+0x19>
+
+0080131a <close_all>:
+
+void
+close_all(void)
+{
+  80131a:	55                   	push   %ebp
+  80131b:	89 e5                	mov    %esp,%ebp
+  80131d:	53                   	push   %ebx
+  80131e:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801321:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801326:	83 ec 0c             	sub    $0xc,%esp
+  801329:	53                   	push   %ebx
+  80132a:	e8 be ff ff ff       	call   8012ed <close>
+	for (i = 0; i < MAXFD; i++)
+  80132f:	83 c3 01             	add    $0x1,%ebx
+  801332:	83 c4 10             	add    $0x10,%esp
+  801335:	83 fb 20             	cmp    $0x20,%ebx
+  801338:	75 ec                	jne    801326 <close_all+0xc>
+}
+  80133a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80133d:	c9                   	leave
+  80133e:	c3                   	ret
+
+0080133f <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80133f:	55                   	push   %ebp
+  801340:	89 e5                	mov    %esp,%ebp
+  801342:	57                   	push   %edi
+  801343:	56                   	push   %esi
+  801344:	53                   	push   %ebx
+  801345:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801348:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80134b:	50                   	push   %eax
+  80134c:	ff 75 08             	push   0x8(%ebp)
+  80134f:	e8 6f fe ff ff       	call   8011c3 <fd_lookup>
+  801354:	89 c3                	mov    %eax,%ebx
+  801356:	83 c4 10             	add    $0x10,%esp
+  801359:	85 c0                	test   %eax,%eax
+  80135b:	78 7f                	js     8013dc <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80135d:	83 ec 0c             	sub    $0xc,%esp
+  801360:	ff 75 0c             	push   0xc(%ebp)
+  801363:	e8 85 ff ff ff       	call   8012ed <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801368:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80136b:	c1 e6 0c             	shl    $0xc,%esi
+  80136e:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801374:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801377:	89 3c 24             	mov    %edi,(%esp)
+  80137a:	e8 d7 fd ff ff       	call   801156 <fd2data>
+  80137f:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801381:	89 34 24             	mov    %esi,(%esp)
+  801384:	e8 cd fd ff ff       	call   801156 <fd2data>
+  801389:	83 c4 10             	add    $0x10,%esp
+  80138c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80138f:	89 d8                	mov    %ebx,%eax
+  801391:	c1 e8 16             	shr    $0x16,%eax
+  801394:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80139b:	a8 01                	test   $0x1,%al
+  80139d:	74 11                	je     8013b0 <dup+0x71>
+  80139f:	89 d8                	mov    %ebx,%eax
+  8013a1:	c1 e8 0c             	shr    $0xc,%eax
+  8013a4:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8013ab:	f6 c2 01             	test   $0x1,%dl
+  8013ae:	75 36                	jne    8013e6 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8013b0:	89 f8                	mov    %edi,%eax
+  8013b2:	c1 e8 0c             	shr    $0xc,%eax
+  8013b5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8013bc:	83 ec 0c             	sub    $0xc,%esp
+  8013bf:	25 07 0e 00 00       	and    $0xe07,%eax
+  8013c4:	50                   	push   %eax
+  8013c5:	56                   	push   %esi
+  8013c6:	6a 00                	push   $0x0
+  8013c8:	57                   	push   %edi
+  8013c9:	6a 00                	push   $0x0
+  8013cb:	e8 e6 fa ff ff       	call   800eb6 <sys_page_map>
+  8013d0:	89 c3                	mov    %eax,%ebx
+  8013d2:	83 c4 20             	add    $0x20,%esp
+  8013d5:	85 c0                	test   %eax,%eax
+  8013d7:	78 33                	js     80140c <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8013d9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8013dc:	89 d8                	mov    %ebx,%eax
+  8013de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013e1:	5b                   	pop    %ebx
+  8013e2:	5e                   	pop    %esi
+  8013e3:	5f                   	pop    %edi
+  8013e4:	5d                   	pop    %ebp
+  8013e5:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8013e6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8013ed:	83 ec 0c             	sub    $0xc,%esp
+  8013f0:	25 07 0e 00 00       	and    $0xe07,%eax
+  8013f5:	50                   	push   %eax
+  8013f6:	ff 75 d4             	push   -0x2c(%ebp)
+  8013f9:	6a 00                	push   $0x0
+  8013fb:	53                   	push   %ebx
+  8013fc:	6a 00                	push   $0x0
+  8013fe:	e8 b3 fa ff ff       	call   800eb6 <sys_page_map>
+  801403:	89 c3                	mov    %eax,%ebx
+  801405:	83 c4 20             	add    $0x20,%esp
+  801408:	85 c0                	test   %eax,%eax
+  80140a:	79 a4                	jns    8013b0 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80140c:	83 ec 08             	sub    $0x8,%esp
+  80140f:	56                   	push   %esi
+  801410:	6a 00                	push   $0x0
+  801412:	e8 e1 fa ff ff       	call   800ef8 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801417:	83 c4 08             	add    $0x8,%esp
+  80141a:	ff 75 d4             	push   -0x2c(%ebp)
+  80141d:	6a 00                	push   $0x0
+  80141f:	e8 d4 fa ff ff       	call   800ef8 <sys_page_unmap>
+	return r;
+  801424:	83 c4 10             	add    $0x10,%esp
+  801427:	eb b3                	jmp    8013dc <dup+0x9d>
+
+00801429 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801429:	55                   	push   %ebp
+  80142a:	89 e5                	mov    %esp,%ebp
+  80142c:	56                   	push   %esi
+  80142d:	53                   	push   %ebx
+  80142e:	83 ec 18             	sub    $0x18,%esp
+  801431:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801434:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801437:	50                   	push   %eax
+  801438:	56                   	push   %esi
+  801439:	e8 85 fd ff ff       	call   8011c3 <fd_lookup>
+  80143e:	83 c4 10             	add    $0x10,%esp
+  801441:	85 c0                	test   %eax,%eax
+  801443:	78 3c                	js     801481 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801445:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801448:	83 ec 08             	sub    $0x8,%esp
+  80144b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80144e:	50                   	push   %eax
+  80144f:	ff 33                	push   (%ebx)
+  801451:	e8 bd fd ff ff       	call   801213 <dev_lookup>
+  801456:	83 c4 10             	add    $0x10,%esp
+  801459:	85 c0                	test   %eax,%eax
+  80145b:	78 24                	js     801481 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80145d:	8b 43 08             	mov    0x8(%ebx),%eax
+  801460:	83 e0 03             	and    $0x3,%eax
+  801463:	83 f8 01             	cmp    $0x1,%eax
+  801466:	74 20                	je     801488 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801468:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80146b:	8b 40 08             	mov    0x8(%eax),%eax
+  80146e:	85 c0                	test   %eax,%eax
+  801470:	74 37                	je     8014a9 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801472:	83 ec 04             	sub    $0x4,%esp
+  801475:	ff 75 10             	push   0x10(%ebp)
+  801478:	ff 75 0c             	push   0xc(%ebp)
+  80147b:	53                   	push   %ebx
+  80147c:	ff d0                	call   *%eax
+  80147e:	83 c4 10             	add    $0x10,%esp
+}
+  801481:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801484:	5b                   	pop    %ebx
+  801485:	5e                   	pop    %esi
+  801486:	5d                   	pop    %ebp
+  801487:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801488:	a1 90 77 80 00       	mov    0x807790,%eax
+  80148d:	8b 40 48             	mov    0x48(%eax),%eax
+  801490:	83 ec 04             	sub    $0x4,%esp
+  801493:	56                   	push   %esi
+  801494:	50                   	push   %eax
+  801495:	68 f1 31 80 00       	push   $0x8031f1
+  80149a:	e8 2f f0 ff ff       	call   8004ce <cprintf>
+		return -E_INVAL;
+  80149f:	83 c4 10             	add    $0x10,%esp
+  8014a2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014a7:	eb d8                	jmp    801481 <read+0x58>
+		return -E_NOT_SUPP;
+  8014a9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8014ae:	eb d1                	jmp    801481 <read+0x58>
+
+008014b0 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8014b0:	55                   	push   %ebp
+  8014b1:	89 e5                	mov    %esp,%ebp
+  8014b3:	57                   	push   %edi
+  8014b4:	56                   	push   %esi
+  8014b5:	53                   	push   %ebx
+  8014b6:	83 ec 0c             	sub    $0xc,%esp
+  8014b9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8014bc:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8014bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014c4:	eb 02                	jmp    8014c8 <readn+0x18>
+  8014c6:	01 c3                	add    %eax,%ebx
+  8014c8:	39 f3                	cmp    %esi,%ebx
+  8014ca:	73 21                	jae    8014ed <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8014cc:	83 ec 04             	sub    $0x4,%esp
+  8014cf:	89 f0                	mov    %esi,%eax
+  8014d1:	29 d8                	sub    %ebx,%eax
+  8014d3:	50                   	push   %eax
+  8014d4:	89 d8                	mov    %ebx,%eax
+  8014d6:	03 45 0c             	add    0xc(%ebp),%eax
+  8014d9:	50                   	push   %eax
+  8014da:	57                   	push   %edi
+  8014db:	e8 49 ff ff ff       	call   801429 <read>
+		if (m < 0)
+  8014e0:	83 c4 10             	add    $0x10,%esp
+  8014e3:	85 c0                	test   %eax,%eax
+  8014e5:	78 04                	js     8014eb <readn+0x3b>
+			return m;
+		if (m == 0)
+  8014e7:	75 dd                	jne    8014c6 <readn+0x16>
+  8014e9:	eb 02                	jmp    8014ed <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8014eb:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8014ed:	89 d8                	mov    %ebx,%eax
+  8014ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014f2:	5b                   	pop    %ebx
+  8014f3:	5e                   	pop    %esi
+  8014f4:	5f                   	pop    %edi
+  8014f5:	5d                   	pop    %ebp
+  8014f6:	c3                   	ret
+
+008014f7 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8014f7:	55                   	push   %ebp
+  8014f8:	89 e5                	mov    %esp,%ebp
+  8014fa:	56                   	push   %esi
+  8014fb:	53                   	push   %ebx
+  8014fc:	83 ec 18             	sub    $0x18,%esp
+  8014ff:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801502:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801505:	50                   	push   %eax
+  801506:	53                   	push   %ebx
+  801507:	e8 b7 fc ff ff       	call   8011c3 <fd_lookup>
+  80150c:	83 c4 10             	add    $0x10,%esp
+  80150f:	85 c0                	test   %eax,%eax
+  801511:	78 37                	js     80154a <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801513:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801516:	83 ec 08             	sub    $0x8,%esp
+  801519:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80151c:	50                   	push   %eax
+  80151d:	ff 36                	push   (%esi)
+  80151f:	e8 ef fc ff ff       	call   801213 <dev_lookup>
+  801524:	83 c4 10             	add    $0x10,%esp
+  801527:	85 c0                	test   %eax,%eax
+  801529:	78 1f                	js     80154a <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80152b:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80152f:	74 20                	je     801551 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801531:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801534:	8b 40 0c             	mov    0xc(%eax),%eax
+  801537:	85 c0                	test   %eax,%eax
+  801539:	74 37                	je     801572 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80153b:	83 ec 04             	sub    $0x4,%esp
+  80153e:	ff 75 10             	push   0x10(%ebp)
+  801541:	ff 75 0c             	push   0xc(%ebp)
+  801544:	56                   	push   %esi
+  801545:	ff d0                	call   *%eax
+  801547:	83 c4 10             	add    $0x10,%esp
+}
+  80154a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80154d:	5b                   	pop    %ebx
+  80154e:	5e                   	pop    %esi
+  80154f:	5d                   	pop    %ebp
+  801550:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801551:	a1 90 77 80 00       	mov    0x807790,%eax
+  801556:	8b 40 48             	mov    0x48(%eax),%eax
+  801559:	83 ec 04             	sub    $0x4,%esp
+  80155c:	53                   	push   %ebx
+  80155d:	50                   	push   %eax
+  80155e:	68 0d 32 80 00       	push   $0x80320d
+  801563:	e8 66 ef ff ff       	call   8004ce <cprintf>
+		return -E_INVAL;
+  801568:	83 c4 10             	add    $0x10,%esp
+  80156b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801570:	eb d8                	jmp    80154a <write+0x53>
+		return -E_NOT_SUPP;
+  801572:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801577:	eb d1                	jmp    80154a <write+0x53>
+
+00801579 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801579:	55                   	push   %ebp
+  80157a:	89 e5                	mov    %esp,%ebp
+  80157c:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80157f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801582:	50                   	push   %eax
+  801583:	ff 75 08             	push   0x8(%ebp)
+  801586:	e8 38 fc ff ff       	call   8011c3 <fd_lookup>
+  80158b:	83 c4 10             	add    $0x10,%esp
+  80158e:	85 c0                	test   %eax,%eax
+  801590:	78 0e                	js     8015a0 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801592:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801595:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801598:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80159b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015a0:	c9                   	leave
+  8015a1:	c3                   	ret
+
+008015a2 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8015a2:	55                   	push   %ebp
+  8015a3:	89 e5                	mov    %esp,%ebp
+  8015a5:	56                   	push   %esi
+  8015a6:	53                   	push   %ebx
+  8015a7:	83 ec 18             	sub    $0x18,%esp
+  8015aa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015ad:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8015b0:	50                   	push   %eax
+  8015b1:	53                   	push   %ebx
+  8015b2:	e8 0c fc ff ff       	call   8011c3 <fd_lookup>
+  8015b7:	83 c4 10             	add    $0x10,%esp
+  8015ba:	85 c0                	test   %eax,%eax
+  8015bc:	78 34                	js     8015f2 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8015be:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8015c1:	83 ec 08             	sub    $0x8,%esp
+  8015c4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015c7:	50                   	push   %eax
+  8015c8:	ff 36                	push   (%esi)
+  8015ca:	e8 44 fc ff ff       	call   801213 <dev_lookup>
+  8015cf:	83 c4 10             	add    $0x10,%esp
+  8015d2:	85 c0                	test   %eax,%eax
+  8015d4:	78 1c                	js     8015f2 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8015d6:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8015da:	74 1d                	je     8015f9 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8015dc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015df:	8b 40 18             	mov    0x18(%eax),%eax
+  8015e2:	85 c0                	test   %eax,%eax
+  8015e4:	74 34                	je     80161a <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8015e6:	83 ec 08             	sub    $0x8,%esp
+  8015e9:	ff 75 0c             	push   0xc(%ebp)
+  8015ec:	56                   	push   %esi
+  8015ed:	ff d0                	call   *%eax
+  8015ef:	83 c4 10             	add    $0x10,%esp
+}
+  8015f2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015f5:	5b                   	pop    %ebx
+  8015f6:	5e                   	pop    %esi
+  8015f7:	5d                   	pop    %ebp
+  8015f8:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8015f9:	a1 90 77 80 00       	mov    0x807790,%eax
+  8015fe:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801601:	83 ec 04             	sub    $0x4,%esp
+  801604:	53                   	push   %ebx
+  801605:	50                   	push   %eax
+  801606:	68 d0 31 80 00       	push   $0x8031d0
+  80160b:	e8 be ee ff ff       	call   8004ce <cprintf>
+		return -E_INVAL;
+  801610:	83 c4 10             	add    $0x10,%esp
+  801613:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801618:	eb d8                	jmp    8015f2 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  80161a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80161f:	eb d1                	jmp    8015f2 <ftruncate+0x50>
+
+00801621 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801621:	55                   	push   %ebp
+  801622:	89 e5                	mov    %esp,%ebp
+  801624:	56                   	push   %esi
+  801625:	53                   	push   %ebx
+  801626:	83 ec 18             	sub    $0x18,%esp
+  801629:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80162c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80162f:	50                   	push   %eax
+  801630:	ff 75 08             	push   0x8(%ebp)
+  801633:	e8 8b fb ff ff       	call   8011c3 <fd_lookup>
+  801638:	83 c4 10             	add    $0x10,%esp
+  80163b:	85 c0                	test   %eax,%eax
+  80163d:	78 49                	js     801688 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80163f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801642:	83 ec 08             	sub    $0x8,%esp
+  801645:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801648:	50                   	push   %eax
+  801649:	ff 36                	push   (%esi)
+  80164b:	e8 c3 fb ff ff       	call   801213 <dev_lookup>
+  801650:	83 c4 10             	add    $0x10,%esp
+  801653:	85 c0                	test   %eax,%eax
+  801655:	78 31                	js     801688 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801657:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80165a:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80165e:	74 2f                	je     80168f <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801660:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801663:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80166a:	00 00 00 
+	stat->st_isdir = 0;
+  80166d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801674:	00 00 00 
+	stat->st_dev = dev;
+  801677:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80167d:	83 ec 08             	sub    $0x8,%esp
+  801680:	53                   	push   %ebx
+  801681:	56                   	push   %esi
+  801682:	ff 50 14             	call   *0x14(%eax)
+  801685:	83 c4 10             	add    $0x10,%esp
+}
+  801688:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80168b:	5b                   	pop    %ebx
+  80168c:	5e                   	pop    %esi
+  80168d:	5d                   	pop    %ebp
+  80168e:	c3                   	ret
+		return -E_NOT_SUPP;
+  80168f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801694:	eb f2                	jmp    801688 <fstat+0x67>
+
+00801696 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801696:	55                   	push   %ebp
+  801697:	89 e5                	mov    %esp,%ebp
+  801699:	56                   	push   %esi
+  80169a:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80169b:	83 ec 08             	sub    $0x8,%esp
+  80169e:	6a 00                	push   $0x0
+  8016a0:	ff 75 08             	push   0x8(%ebp)
+  8016a3:	e8 e4 01 00 00       	call   80188c <open>
+  8016a8:	89 c3                	mov    %eax,%ebx
+  8016aa:	83 c4 10             	add    $0x10,%esp
+  8016ad:	85 c0                	test   %eax,%eax
+  8016af:	78 1b                	js     8016cc <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8016b1:	83 ec 08             	sub    $0x8,%esp
+  8016b4:	ff 75 0c             	push   0xc(%ebp)
+  8016b7:	50                   	push   %eax
+  8016b8:	e8 64 ff ff ff       	call   801621 <fstat>
+  8016bd:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8016bf:	89 1c 24             	mov    %ebx,(%esp)
+  8016c2:	e8 26 fc ff ff       	call   8012ed <close>
+	return r;
+  8016c7:	83 c4 10             	add    $0x10,%esp
+  8016ca:	89 f3                	mov    %esi,%ebx
+}
+  8016cc:	89 d8                	mov    %ebx,%eax
+  8016ce:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016d1:	5b                   	pop    %ebx
+  8016d2:	5e                   	pop    %esi
+  8016d3:	5d                   	pop    %ebp
+  8016d4:	c3                   	ret
+
+008016d5 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  8016d5:	55                   	push   %ebp
+  8016d6:	89 e5                	mov    %esp,%ebp
+  8016d8:	56                   	push   %esi
+  8016d9:	53                   	push   %ebx
+  8016da:	89 c6                	mov    %eax,%esi
+  8016dc:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  8016de:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  8016e5:	74 27                	je     80170e <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8016e7:	6a 07                	push   $0x7
+  8016e9:	68 00 80 80 00       	push   $0x808000
+  8016ee:	56                   	push   %esi
+  8016ef:	ff 35 00 60 80 00    	push   0x806000
+  8016f5:	e8 8b 10 00 00       	call   802785 <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  8016fa:	83 c4 0c             	add    $0xc,%esp
+  8016fd:	6a 00                	push   $0x0
+  8016ff:	53                   	push   %ebx
+  801700:	6a 00                	push   $0x0
+  801702:	e8 0a 10 00 00       	call   802711 <ipc_recv>
+}
+  801707:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80170a:	5b                   	pop    %ebx
+  80170b:	5e                   	pop    %esi
+  80170c:	5d                   	pop    %ebp
+  80170d:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  80170e:	83 ec 0c             	sub    $0xc,%esp
+  801711:	6a 01                	push   $0x1
+  801713:	e8 c1 10 00 00       	call   8027d9 <ipc_find_env>
+  801718:	a3 00 60 80 00       	mov    %eax,0x806000
+  80171d:	83 c4 10             	add    $0x10,%esp
+  801720:	eb c5                	jmp    8016e7 <fsipc+0x12>
+
+00801722 <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801722:	55                   	push   %ebp
+  801723:	89 e5                	mov    %esp,%ebp
+  801725:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801728:	8b 45 08             	mov    0x8(%ebp),%eax
+  80172b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80172e:	a3 00 80 80 00       	mov    %eax,0x808000
+  fsipcbuf.set_size.req_size = newsize;
+  801733:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801736:	a3 04 80 80 00       	mov    %eax,0x808004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  80173b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801740:	b8 02 00 00 00       	mov    $0x2,%eax
+  801745:	e8 8b ff ff ff       	call   8016d5 <fsipc>
+}
+  80174a:	c9                   	leave
+  80174b:	c3                   	ret
+
+0080174c <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80174c:	55                   	push   %ebp
+  80174d:	89 e5                	mov    %esp,%ebp
+  80174f:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801752:	8b 45 08             	mov    0x8(%ebp),%eax
+  801755:	8b 40 0c             	mov    0xc(%eax),%eax
+  801758:	a3 00 80 80 00       	mov    %eax,0x808000
+  return fsipc(FSREQ_FLUSH, NULL);
+  80175d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801762:	b8 06 00 00 00       	mov    $0x6,%eax
+  801767:	e8 69 ff ff ff       	call   8016d5 <fsipc>
+}
+  80176c:	c9                   	leave
+  80176d:	c3                   	ret
+
+0080176e <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80176e:	55                   	push   %ebp
+  80176f:	89 e5                	mov    %esp,%ebp
+  801771:	53                   	push   %ebx
+  801772:	83 ec 04             	sub    $0x4,%esp
+  801775:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801778:	8b 45 08             	mov    0x8(%ebp),%eax
+  80177b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80177e:	a3 00 80 80 00       	mov    %eax,0x808000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801783:	ba 00 00 00 00       	mov    $0x0,%edx
+  801788:	b8 05 00 00 00       	mov    $0x5,%eax
+  80178d:	e8 43 ff ff ff       	call   8016d5 <fsipc>
+  801792:	85 c0                	test   %eax,%eax
+  801794:	78 2c                	js     8017c2 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801796:	83 ec 08             	sub    $0x8,%esp
+  801799:	68 00 80 80 00       	push   $0x808000
+  80179e:	53                   	push   %ebx
+  80179f:	e8 e3 f2 ff ff       	call   800a87 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  8017a4:	a1 80 80 80 00       	mov    0x808080,%eax
+  8017a9:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8017af:	a1 84 80 80 00       	mov    0x808084,%eax
+  8017b4:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  8017ba:	83 c4 10             	add    $0x10,%esp
+  8017bd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017c2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017c5:	c9                   	leave
+  8017c6:	c3                   	ret
+
+008017c7 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8017c7:	55                   	push   %ebp
+  8017c8:	89 e5                	mov    %esp,%ebp
+  8017ca:	83 ec 0c             	sub    $0xc,%esp
+  8017cd:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8017d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017d3:	8b 52 0c             	mov    0xc(%edx),%edx
+  8017d6:	89 15 00 80 80 00    	mov    %edx,0x808000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8017dc:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8017e1:	39 d0                	cmp    %edx,%eax
+  8017e3:	0f 47 c2             	cmova  %edx,%eax
+  8017e6:	a3 04 80 80 00       	mov    %eax,0x808004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  8017eb:	50                   	push   %eax
+  8017ec:	ff 75 0c             	push   0xc(%ebp)
+  8017ef:	68 08 80 80 00       	push   $0x808008
+  8017f4:	e8 14 f4 ff ff       	call   800c0d <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  8017f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017fe:	b8 04 00 00 00       	mov    $0x4,%eax
+  801803:	e8 cd fe ff ff       	call   8016d5 <fsipc>
+}
+  801808:	c9                   	leave
+  801809:	c3                   	ret
+
+0080180a <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80180a:	55                   	push   %ebp
+  80180b:	89 e5                	mov    %esp,%ebp
+  80180d:	56                   	push   %esi
+  80180e:	53                   	push   %ebx
+  80180f:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801812:	8b 45 08             	mov    0x8(%ebp),%eax
+  801815:	8b 40 0c             	mov    0xc(%eax),%eax
+  801818:	a3 00 80 80 00       	mov    %eax,0x808000
+  fsipcbuf.read.req_n = n;
+  80181d:	89 35 04 80 80 00    	mov    %esi,0x808004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801823:	ba 00 00 00 00       	mov    $0x0,%edx
+  801828:	b8 03 00 00 00       	mov    $0x3,%eax
+  80182d:	e8 a3 fe ff ff       	call   8016d5 <fsipc>
+  801832:	89 c3                	mov    %eax,%ebx
+  801834:	85 c0                	test   %eax,%eax
+  801836:	78 1f                	js     801857 <devfile_read+0x4d>
+  assert(r <= n);
+  801838:	39 c6                	cmp    %eax,%esi
+  80183a:	72 24                	jb     801860 <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  80183c:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801841:	7f 33                	jg     801876 <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801843:	83 ec 04             	sub    $0x4,%esp
+  801846:	50                   	push   %eax
+  801847:	68 00 80 80 00       	push   $0x808000
+  80184c:	ff 75 0c             	push   0xc(%ebp)
+  80184f:	e8 b9 f3 ff ff       	call   800c0d <memmove>
+  return r;
+  801854:	83 c4 10             	add    $0x10,%esp
+}
+  801857:	89 d8                	mov    %ebx,%eax
+  801859:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80185c:	5b                   	pop    %ebx
+  80185d:	5e                   	pop    %esi
+  80185e:	5d                   	pop    %ebp
+  80185f:	c3                   	ret
+  assert(r <= n);
+  801860:	68 40 32 80 00       	push   $0x803240
+  801865:	68 47 32 80 00       	push   $0x803247
+  80186a:	6a 78                	push   $0x78
+  80186c:	68 5c 32 80 00       	push   $0x80325c
+  801871:	e8 7d eb ff ff       	call   8003f3 <_panic>
+  assert(r <= PGSIZE);
+  801876:	68 67 32 80 00       	push   $0x803267
+  80187b:	68 47 32 80 00       	push   $0x803247
+  801880:	6a 79                	push   $0x79
+  801882:	68 5c 32 80 00       	push   $0x80325c
+  801887:	e8 67 eb ff ff       	call   8003f3 <_panic>
+
+0080188c <open>:
+open(const char *path, int mode) {
+  80188c:	55                   	push   %ebp
+  80188d:	89 e5                	mov    %esp,%ebp
+  80188f:	56                   	push   %esi
+  801890:	53                   	push   %ebx
+  801891:	83 ec 1c             	sub    $0x1c,%esp
+  801894:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801897:	56                   	push   %esi
+  801898:	e8 af f1 ff ff       	call   800a4c <strlen>
+  80189d:	83 c4 10             	add    $0x10,%esp
+  8018a0:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8018a5:	7f 6c                	jg     801913 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  8018a7:	83 ec 0c             	sub    $0xc,%esp
+  8018aa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018ad:	50                   	push   %eax
+  8018ae:	e8 ba f8 ff ff       	call   80116d <fd_alloc>
+  8018b3:	89 c3                	mov    %eax,%ebx
+  8018b5:	83 c4 10             	add    $0x10,%esp
+  8018b8:	85 c0                	test   %eax,%eax
+  8018ba:	78 3c                	js     8018f8 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  8018bc:	83 ec 08             	sub    $0x8,%esp
+  8018bf:	56                   	push   %esi
+  8018c0:	68 00 80 80 00       	push   $0x808000
+  8018c5:	e8 bd f1 ff ff       	call   800a87 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  8018ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8018cd:	a3 00 84 80 00       	mov    %eax,0x808400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8018d2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8018d5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8018da:	e8 f6 fd ff ff       	call   8016d5 <fsipc>
+  8018df:	89 c3                	mov    %eax,%ebx
+  8018e1:	83 c4 10             	add    $0x10,%esp
+  8018e4:	85 c0                	test   %eax,%eax
+  8018e6:	78 19                	js     801901 <open+0x75>
+  return fd2num(fd);
+  8018e8:	83 ec 0c             	sub    $0xc,%esp
+  8018eb:	ff 75 f4             	push   -0xc(%ebp)
+  8018ee:	e8 53 f8 ff ff       	call   801146 <fd2num>
+  8018f3:	89 c3                	mov    %eax,%ebx
+  8018f5:	83 c4 10             	add    $0x10,%esp
+}
+  8018f8:	89 d8                	mov    %ebx,%eax
+  8018fa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018fd:	5b                   	pop    %ebx
+  8018fe:	5e                   	pop    %esi
+  8018ff:	5d                   	pop    %ebp
+  801900:	c3                   	ret
+    fd_close(fd, 0);
+  801901:	83 ec 08             	sub    $0x8,%esp
+  801904:	6a 00                	push   $0x0
+  801906:	ff 75 f4             	push   -0xc(%ebp)
+  801909:	e8 58 f9 ff ff       	call   801266 <fd_close>
+    return r;
+  80190e:	83 c4 10             	add    $0x10,%esp
+  801911:	eb e5                	jmp    8018f8 <open+0x6c>
+    return -E_BAD_PATH;
+  801913:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801918:	eb de                	jmp    8018f8 <open+0x6c>
+
+0080191a <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  80191a:	55                   	push   %ebp
+  80191b:	89 e5                	mov    %esp,%ebp
+  80191d:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801920:	ba 00 00 00 00       	mov    $0x0,%edx
+  801925:	b8 08 00 00 00       	mov    $0x8,%eax
+  80192a:	e8 a6 fd ff ff       	call   8016d5 <fsipc>
+}
+  80192f:	c9                   	leave
+  801930:	c3                   	ret
+
+00801931 <spawn>:
+// prog: the pathname of the program to run.
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv) {
+  801931:	55                   	push   %ebp
+  801932:	89 e5                	mov    %esp,%ebp
+  801934:	57                   	push   %edi
+  801935:	56                   	push   %esi
+  801936:	53                   	push   %ebx
+  801937:	81 ec 84 02 00 00    	sub    $0x284,%esp
+  //   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+  //     correct initial eip and esp values in the child.
+  //
+  //   - Start the child process running with sys_env_set_status().
+
+  if ((r = open(prog, O_RDONLY)) < 0)
+  80193d:	6a 00                	push   $0x0
+  80193f:	ff 75 08             	push   0x8(%ebp)
+  801942:	e8 45 ff ff ff       	call   80188c <open>
+  801947:	89 85 8c fd ff ff    	mov    %eax,-0x274(%ebp)
+  80194d:	83 c4 10             	add    $0x10,%esp
+  801950:	85 c0                	test   %eax,%eax
+  801952:	0f 88 f8 04 00 00    	js     801e50 <spawn+0x51f>
+  801958:	89 c1                	mov    %eax,%ecx
+    return r;
+  fd = r;
+
+  // Read elf header
+  elf = (struct Elf *) elf_buf;
+  if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf)
+  80195a:	83 ec 04             	sub    $0x4,%esp
+  80195d:	68 00 02 00 00       	push   $0x200
+  801962:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  801968:	50                   	push   %eax
+  801969:	51                   	push   %ecx
+  80196a:	e8 41 fb ff ff       	call   8014b0 <readn>
+  80196f:	83 c4 10             	add    $0x10,%esp
+  801972:	3d 00 02 00 00       	cmp    $0x200,%eax
+  801977:	75 5a                	jne    8019d3 <spawn+0xa2>
+      || elf->e_magic != ELF_MAGIC) {
+  801979:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  801980:	45 4c 46 
+  801983:	75 4e                	jne    8019d3 <spawn+0xa2>
+
+// This must be inlined.  Exercise for reader: why?
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+  envid_t ret;
+  asm volatile("int %2"
+  801985:	b8 07 00 00 00       	mov    $0x7,%eax
+  80198a:	cd 30                	int    $0x30
+  80198c:	89 85 88 fd ff ff    	mov    %eax,-0x278(%ebp)
+    cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+    return -E_NOT_EXEC;
+  }
+
+  // Create new child environment
+  if ((r = sys_exofork()) < 0)
+  801992:	85 c0                	test   %eax,%eax
+  801994:	0f 88 aa 04 00 00    	js     801e44 <spawn+0x513>
+    return r;
+  child = r;
+
+  // Set up trap frame, including initial stack.
+  child_tf = envs[ENVX(child)].env_tf;
+  80199a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80199f:	8d 34 c0             	lea    (%eax,%eax,8),%esi
+  8019a2:	c1 e6 04             	shl    $0x4,%esi
+  8019a5:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  8019ab:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  8019b1:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8019b6:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  child_tf.tf_eip = elf->e_entry;
+  8019b8:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  8019be:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  uintptr_t *argv_store;
+
+  // Count the number of arguments (argc)
+  // and the total amount of space needed for strings (string_size).
+  string_size = 0;
+  for (argc = 0; argv[argc] != 0; argc++)
+  8019c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  string_size = 0;
+  8019c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8019ce:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  for (argc = 0; argv[argc] != 0; argc++)
+  8019d1:	eb 4b                	jmp    801a1e <spawn+0xed>
+    close(fd);
+  8019d3:	83 ec 0c             	sub    $0xc,%esp
+  8019d6:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  8019dc:	e8 0c f9 ff ff       	call   8012ed <close>
+    cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  8019e1:	83 c4 0c             	add    $0xc,%esp
+  8019e4:	68 7f 45 4c 46       	push   $0x464c457f
+  8019e9:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  8019ef:	68 73 32 80 00       	push   $0x803273
+  8019f4:	e8 d5 ea ff ff       	call   8004ce <cprintf>
+    return -E_NOT_EXEC;
+  8019f9:	83 c4 10             	add    $0x10,%esp
+  8019fc:	c7 85 8c fd ff ff f2 	movl   $0xfffffff2,-0x274(%ebp)
+  801a03:	ff ff ff 
+  801a06:	e9 45 04 00 00       	jmp    801e50 <spawn+0x51f>
+    string_size += strlen(argv[argc]) + 1;
+  801a0b:	83 ec 0c             	sub    $0xc,%esp
+  801a0e:	50                   	push   %eax
+  801a0f:	e8 38 f0 ff ff       	call   800a4c <strlen>
+  801a14:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+  for (argc = 0; argv[argc] != 0; argc++)
+  801a18:	83 c3 01             	add    $0x1,%ebx
+  801a1b:	83 c4 10             	add    $0x10,%esp
+  801a1e:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  801a21:	85 c0                	test   %eax,%eax
+  801a23:	75 e6                	jne    801a0b <spawn+0xda>
+  // Determine where to place the strings and the argv array.
+  // Set up pointers into the temporary page 'UTEMP'; we'll map a page
+  // there later, then remap that page into the child environment
+  // at (USTACKTOP - PGSIZE).
+  // strings is the topmost thing on the stack.
+  string_store = (char *) UTEMP + PGSIZE - string_size;
+  801a25:	89 9d 84 fd ff ff    	mov    %ebx,-0x27c(%ebp)
+  801a2b:	bf 00 10 40 00       	mov    $0x401000,%edi
+  801a30:	29 f7                	sub    %esi,%edi
+  // argv is below that.  There's one argument pointer per argument, plus
+  // a null pointer.
+  argv_store = (uintptr_t *) (ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  801a32:	89 fa                	mov    %edi,%edx
+  801a34:	83 e2 fc             	and    $0xfffffffc,%edx
+  801a37:	8d 04 9d 04 00 00 00 	lea    0x4(,%ebx,4),%eax
+  801a3e:	29 c2                	sub    %eax,%edx
+  801a40:	89 95 94 fd ff ff    	mov    %edx,-0x26c(%ebp)
+
+  // Make sure that argv, strings, and the 2 words that hold 'argc'
+  // and 'argv' themselves will all fit in a single stack page.
+  if ((void *) (argv_store - 2) < (void *) UTEMP)
+  801a46:	8d 42 f8             	lea    -0x8(%edx),%eax
+  801a49:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  801a4e:	0f 86 1f 04 00 00    	jbe    801e73 <spawn+0x542>
+    return -E_NO_MEM;
+
+  // Allocate the single stack page at UTEMP.
+  if ((r = sys_page_alloc(0, (void *) UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  801a54:	83 ec 04             	sub    $0x4,%esp
+  801a57:	6a 07                	push   $0x7
+  801a59:	68 00 00 40 00       	push   $0x400000
+  801a5e:	6a 00                	push   $0x0
+  801a60:	e8 0e f4 ff ff       	call   800e73 <sys_page_alloc>
+  801a65:	83 c4 10             	add    $0x10,%esp
+  801a68:	85 c0                	test   %eax,%eax
+  801a6a:	0f 88 08 04 00 00    	js     801e78 <spawn+0x547>
+  //	  (Again, argv should use an address valid in the child's
+  //	  environment.)
+  //
+  //	* Set *init_esp to the initial stack pointer for the child,
+  //	  (Again, use an address valid in the child's environment.)
+  for (i = 0; i < argc; i++) {
+  801a70:	be 00 00 00 00       	mov    $0x0,%esi
+  801a75:	89 9d 90 fd ff ff    	mov    %ebx,-0x270(%ebp)
+  801a7b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801a7e:	39 b5 90 fd ff ff    	cmp    %esi,-0x270(%ebp)
+  801a84:	7e 32                	jle    801ab8 <spawn+0x187>
+    argv_store[i] = UTEMP2USTACK(string_store);
+  801a86:	8d 87 00 d0 7f ee    	lea    -0x11803000(%edi),%eax
+  801a8c:	8b 8d 94 fd ff ff    	mov    -0x26c(%ebp),%ecx
+  801a92:	89 04 b1             	mov    %eax,(%ecx,%esi,4)
+    strcpy(string_store, argv[i]);
+  801a95:	83 ec 08             	sub    $0x8,%esp
+  801a98:	ff 34 b3             	push   (%ebx,%esi,4)
+  801a9b:	57                   	push   %edi
+  801a9c:	e8 e6 ef ff ff       	call   800a87 <strcpy>
+    string_store += strlen(argv[i]) + 1;
+  801aa1:	83 c4 04             	add    $0x4,%esp
+  801aa4:	ff 34 b3             	push   (%ebx,%esi,4)
+  801aa7:	e8 a0 ef ff ff       	call   800a4c <strlen>
+  801aac:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+  for (i = 0; i < argc; i++) {
+  801ab0:	83 c6 01             	add    $0x1,%esi
+  801ab3:	83 c4 10             	add    $0x10,%esp
+  801ab6:	eb c6                	jmp    801a7e <spawn+0x14d>
+  }
+  argv_store[argc] = 0;
+  801ab8:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  801abe:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  801ac4:	c7 04 88 00 00 00 00 	movl   $0x0,(%eax,%ecx,4)
+  assert(string_store == (char *) UTEMP + PGSIZE);
+  801acb:	81 ff 00 10 40 00    	cmp    $0x401000,%edi
+  801ad1:	0f 85 87 00 00 00    	jne    801b5e <spawn+0x22d>
+
+  argv_store[-1] = UTEMP2USTACK(argv_store);
+  801ad7:	8b 8d 94 fd ff ff    	mov    -0x26c(%ebp),%ecx
+  801add:	8d 81 00 d0 7f ee    	lea    -0x11803000(%ecx),%eax
+  801ae3:	89 41 fc             	mov    %eax,-0x4(%ecx)
+  argv_store[-2] = argc;
+  801ae6:	89 c8                	mov    %ecx,%eax
+  801ae8:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  801aee:	89 48 f8             	mov    %ecx,-0x8(%eax)
+
+  *init_esp = UTEMP2USTACK(&argv_store[-2]);
+  801af1:	2d 08 30 80 11       	sub    $0x11803008,%eax
+  801af6:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+
+  // After completing the stack, map it into the child's address space
+  // and unmap it from ours!
+  if ((r = sys_page_map(0, UTEMP, child, (void *) (USTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  801afc:	83 ec 0c             	sub    $0xc,%esp
+  801aff:	6a 07                	push   $0x7
+  801b01:	68 00 d0 bf ee       	push   $0xeebfd000
+  801b06:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  801b0c:	68 00 00 40 00       	push   $0x400000
+  801b11:	6a 00                	push   $0x0
+  801b13:	e8 9e f3 ff ff       	call   800eb6 <sys_page_map>
+  801b18:	89 c3                	mov    %eax,%ebx
+  801b1a:	83 c4 20             	add    $0x20,%esp
+  801b1d:	85 c0                	test   %eax,%eax
+  801b1f:	0f 88 5b 03 00 00    	js     801e80 <spawn+0x54f>
+    goto error;
+  if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  801b25:	83 ec 08             	sub    $0x8,%esp
+  801b28:	68 00 00 40 00       	push   $0x400000
+  801b2d:	6a 00                	push   $0x0
+  801b2f:	e8 c4 f3 ff ff       	call   800ef8 <sys_page_unmap>
+  801b34:	89 c3                	mov    %eax,%ebx
+  801b36:	83 c4 10             	add    $0x10,%esp
+  801b39:	85 c0                	test   %eax,%eax
+  801b3b:	0f 88 3f 03 00 00    	js     801e80 <spawn+0x54f>
+  ph = (struct Proghdr *) (elf_buf + elf->e_phoff);
+  801b41:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  801b47:	8d 8c 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%ecx
+  for (i = 0; i < elf->e_phnum; i++, ph++) {
+  801b4e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b53:	89 c8                	mov    %ecx,%eax
+  801b55:	89 d1                	mov    %edx,%ecx
+  801b57:	89 c2                	mov    %eax,%edx
+  801b59:	e9 5a 01 00 00       	jmp    801cb8 <spawn+0x387>
+  assert(string_store == (char *) UTEMP + PGSIZE);
+  801b5e:	68 e8 32 80 00       	push   $0x8032e8
+  801b63:	68 47 32 80 00       	push   $0x803247
+  801b68:	68 52 01 00 00       	push   $0x152
+  801b6d:	68 8d 32 80 00       	push   $0x80328d
+  801b72:	e8 7c e8 ff ff       	call   8003f3 <_panic>
+      // allocate a blank page
+      if ((r = sys_page_alloc(child, (void *) (va + i), perm)) < 0)
+        return r;
+    } else {
+      // from file
+      if ((r = sys_page_alloc(0, UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  801b77:	83 ec 04             	sub    $0x4,%esp
+  801b7a:	6a 07                	push   $0x7
+  801b7c:	68 00 00 40 00       	push   $0x400000
+  801b81:	6a 00                	push   $0x0
+  801b83:	e8 eb f2 ff ff       	call   800e73 <sys_page_alloc>
+  801b88:	83 c4 10             	add    $0x10,%esp
+  801b8b:	85 c0                	test   %eax,%eax
+  801b8d:	0f 88 cb 02 00 00    	js     801e5e <spawn+0x52d>
+        return r;
+      if ((r = seek(fd, fileoffset + i)) < 0)
+  801b93:	83 ec 08             	sub    $0x8,%esp
+  801b96:	8b 95 80 fd ff ff    	mov    -0x280(%ebp),%edx
+  801b9c:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  801ba2:	01 d0                	add    %edx,%eax
+  801ba4:	50                   	push   %eax
+  801ba5:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  801bab:	e8 c9 f9 ff ff       	call   801579 <seek>
+  801bb0:	83 c4 10             	add    $0x10,%esp
+  801bb3:	85 c0                	test   %eax,%eax
+  801bb5:	0f 88 aa 02 00 00    	js     801e65 <spawn+0x534>
+        return r;
+      if ((r = readn(fd, UTEMP, MIN(PGSIZE, filesz - i))) < 0)
+  801bbb:	83 ec 04             	sub    $0x4,%esp
+  801bbe:	89 fa                	mov    %edi,%edx
+  801bc0:	8b 8d 94 fd ff ff    	mov    -0x26c(%ebp),%ecx
+  801bc6:	29 ca                	sub    %ecx,%edx
+  801bc8:	89 d0                	mov    %edx,%eax
+  801bca:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801bcf:	39 d0                	cmp    %edx,%eax
+  801bd1:	0f 47 c2             	cmova  %edx,%eax
+  801bd4:	50                   	push   %eax
+  801bd5:	68 00 00 40 00       	push   $0x400000
+  801bda:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  801be0:	e8 cb f8 ff ff       	call   8014b0 <readn>
+  801be5:	83 c4 10             	add    $0x10,%esp
+  801be8:	85 c0                	test   %eax,%eax
+  801bea:	0f 88 7c 02 00 00    	js     801e6c <spawn+0x53b>
+        return r;
+      if ((r = sys_page_map(0, UTEMP, child, (void *) (va + i), perm)) < 0)
+  801bf0:	83 ec 0c             	sub    $0xc,%esp
+  801bf3:	ff b5 84 fd ff ff    	push   -0x27c(%ebp)
+  801bf9:	56                   	push   %esi
+  801bfa:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  801c00:	68 00 00 40 00       	push   $0x400000
+  801c05:	6a 00                	push   $0x0
+  801c07:	e8 aa f2 ff ff       	call   800eb6 <sys_page_map>
+  801c0c:	83 c4 20             	add    $0x20,%esp
+  801c0f:	85 c0                	test   %eax,%eax
+  801c11:	78 7e                	js     801c91 <spawn+0x360>
+        panic("spawn: sys_page_map data: %e", r);
+      sys_page_unmap(0, UTEMP);
+  801c13:	83 ec 08             	sub    $0x8,%esp
+  801c16:	68 00 00 40 00       	push   $0x400000
+  801c1b:	6a 00                	push   $0x0
+  801c1d:	e8 d6 f2 ff ff       	call   800ef8 <sys_page_unmap>
+  801c22:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < memsz; i += PGSIZE) {
+  801c25:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801c2b:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801c31:	89 9d 94 fd ff ff    	mov    %ebx,-0x26c(%ebp)
+  801c37:	8b 85 90 fd ff ff    	mov    -0x270(%ebp),%eax
+  801c3d:	39 c3                	cmp    %eax,%ebx
+  801c3f:	73 65                	jae    801ca6 <spawn+0x375>
+    if (i >= filesz) {
+  801c41:	39 fb                	cmp    %edi,%ebx
+  801c43:	0f 82 2e ff ff ff    	jb     801b77 <spawn+0x246>
+      if ((r = sys_page_alloc(child, (void *) (va + i), perm)) < 0)
+  801c49:	83 ec 04             	sub    $0x4,%esp
+  801c4c:	ff b5 84 fd ff ff    	push   -0x27c(%ebp)
+  801c52:	56                   	push   %esi
+  801c53:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  801c59:	e8 15 f2 ff ff       	call   800e73 <sys_page_alloc>
+  801c5e:	83 c4 10             	add    $0x10,%esp
+  801c61:	85 c0                	test   %eax,%eax
+  801c63:	79 c0                	jns    801c25 <spawn+0x2f4>
+  801c65:	89 c7                	mov    %eax,%edi
+  sys_env_destroy(child);
+  801c67:	83 ec 0c             	sub    $0xc,%esp
+  801c6a:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  801c70:	e8 7f f1 ff ff       	call   800df4 <sys_env_destroy>
+  close(fd);
+  801c75:	83 c4 04             	add    $0x4,%esp
+  801c78:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  801c7e:	e8 6a f6 ff ff       	call   8012ed <close>
+  return r;
+  801c83:	83 c4 10             	add    $0x10,%esp
+  801c86:	89 bd 8c fd ff ff    	mov    %edi,-0x274(%ebp)
+  801c8c:	e9 bf 01 00 00       	jmp    801e50 <spawn+0x51f>
+        panic("spawn: sys_page_map data: %e", r);
+  801c91:	50                   	push   %eax
+  801c92:	68 99 32 80 00       	push   $0x803299
+  801c97:	68 84 01 00 00       	push   $0x184
+  801c9c:	68 8d 32 80 00       	push   $0x80328d
+  801ca1:	e8 4d e7 ff ff       	call   8003f3 <_panic>
+  801ca6:	8b 8d 7c fd ff ff    	mov    -0x284(%ebp),%ecx
+  801cac:	8b 95 78 fd ff ff    	mov    -0x288(%ebp),%edx
+  for (i = 0; i < elf->e_phnum; i++, ph++) {
+  801cb2:	83 c1 01             	add    $0x1,%ecx
+  801cb5:	83 c2 20             	add    $0x20,%edx
+  801cb8:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  801cbf:	39 c8                	cmp    %ecx,%eax
+  801cc1:	0f 8e 88 00 00 00    	jle    801d4f <spawn+0x41e>
+    if (ph->p_type != ELF_PROG_LOAD)
+  801cc7:	83 3a 01             	cmpl   $0x1,(%edx)
+  801cca:	75 e6                	jne    801cb2 <spawn+0x381>
+    if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  801ccc:	8b 42 18             	mov    0x18(%edx),%eax
+  801ccf:	83 e0 02             	and    $0x2,%eax
+    perm = PTE_P | PTE_U;
+  801cd2:	83 f8 01             	cmp    $0x1,%eax
+  801cd5:	19 c0                	sbb    %eax,%eax
+  801cd7:	83 e0 fe             	and    $0xfffffffe,%eax
+  801cda:	83 c0 07             	add    $0x7,%eax
+    if ((r = map_segment(child, ph->p_va, ph->p_memsz, fd, ph->p_filesz, ph->p_offset, perm)) < 0)
+  801cdd:	8b 72 04             	mov    0x4(%edx),%esi
+  801ce0:	89 b5 80 fd ff ff    	mov    %esi,-0x280(%ebp)
+  801ce6:	8b 7a 10             	mov    0x10(%edx),%edi
+  801ce9:	89 bd 94 fd ff ff    	mov    %edi,-0x26c(%ebp)
+  801cef:	8b 5a 14             	mov    0x14(%edx),%ebx
+  801cf2:	89 9d 90 fd ff ff    	mov    %ebx,-0x270(%ebp)
+  801cf8:	8b 7a 08             	mov    0x8(%edx),%edi
+  801cfb:	89 bd 84 fd ff ff    	mov    %edi,-0x27c(%ebp)
+  if ((i = PGOFF(va))) {
+  801d01:	89 fb                	mov    %edi,%ebx
+  801d03:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  801d09:	74 1c                	je     801d27 <spawn+0x3f6>
+    va -= i;
+  801d0b:	29 df                	sub    %ebx,%edi
+  801d0d:	89 bd 84 fd ff ff    	mov    %edi,-0x27c(%ebp)
+    memsz += i;
+  801d13:	01 9d 90 fd ff ff    	add    %ebx,-0x270(%ebp)
+    filesz += i;
+  801d19:	01 9d 94 fd ff ff    	add    %ebx,-0x26c(%ebp)
+    fileoffset -= i;
+  801d1f:	29 de                	sub    %ebx,%esi
+  801d21:	89 b5 80 fd ff ff    	mov    %esi,-0x280(%ebp)
+  for (i = 0; i < memsz; i += PGSIZE) {
+  801d27:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d2c:	8b bd 94 fd ff ff    	mov    -0x26c(%ebp),%edi
+  801d32:	8b b5 84 fd ff ff    	mov    -0x27c(%ebp),%esi
+  801d38:	89 8d 7c fd ff ff    	mov    %ecx,-0x284(%ebp)
+  801d3e:	89 95 78 fd ff ff    	mov    %edx,-0x288(%ebp)
+  801d44:	89 85 84 fd ff ff    	mov    %eax,-0x27c(%ebp)
+  801d4a:	e9 e2 fe ff ff       	jmp    801c31 <spawn+0x300>
+  close(fd);
+  801d4f:	83 ec 0c             	sub    $0xc,%esp
+  801d52:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  801d58:	e8 90 f5 ff ff       	call   8012ed <close>
+  801d5d:	83 c4 10             	add    $0x10,%esp
+  // LAB 5: Your code here.
+  int r;
+  unsigned perm = PTE_P | PTE_U | PTE_SHARE;
+
+  uintptr_t addr;
+  for (addr = 0; addr < UTOP; addr += PGSIZE)
+  801d60:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d65:	8b b5 88 fd ff ff    	mov    -0x278(%ebp),%esi
+  801d6b:	eb 0e                	jmp    801d7b <spawn+0x44a>
+  801d6d:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801d73:	81 fb 00 00 c0 ee    	cmp    $0xeec00000,%ebx
+  801d79:	74 5e                	je     801dd9 <spawn+0x4a8>
+    if ((uvpd[PDX(addr)] & PTE_P) && (uvpt[PGNUM(addr)] & perm) == perm) {
+  801d7b:	89 d8                	mov    %ebx,%eax
+  801d7d:	c1 e8 16             	shr    $0x16,%eax
+  801d80:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801d87:	a8 01                	test   $0x1,%al
+  801d89:	74 e2                	je     801d6d <spawn+0x43c>
+  801d8b:	89 da                	mov    %ebx,%edx
+  801d8d:	c1 ea 0c             	shr    $0xc,%edx
+  801d90:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  801d97:	25 05 04 00 00       	and    $0x405,%eax
+  801d9c:	3d 05 04 00 00       	cmp    $0x405,%eax
+  801da1:	75 ca                	jne    801d6d <spawn+0x43c>
+      if ((r = sys_page_map(0, (void *) addr, child, (void *) addr, uvpt[PGNUM(addr)] & PTE_SYSCALL)) < 0) {
+  801da3:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  801daa:	83 ec 0c             	sub    $0xc,%esp
+  801dad:	25 07 0e 00 00       	and    $0xe07,%eax
+  801db2:	50                   	push   %eax
+  801db3:	53                   	push   %ebx
+  801db4:	56                   	push   %esi
+  801db5:	53                   	push   %ebx
+  801db6:	6a 00                	push   $0x0
+  801db8:	e8 f9 f0 ff ff       	call   800eb6 <sys_page_map>
+  801dbd:	83 c4 20             	add    $0x20,%esp
+  801dc0:	85 c0                	test   %eax,%eax
+  801dc2:	79 a9                	jns    801d6d <spawn+0x43c>
+        panic("copy_shared_pages : sys_page_map: %e\n", r);
+  801dc4:	50                   	push   %eax
+  801dc5:	68 10 33 80 00       	push   $0x803310
+  801dca:	68 96 01 00 00       	push   $0x196
+  801dcf:	68 8d 32 80 00       	push   $0x80328d
+  801dd4:	e8 1a e6 ff ff       	call   8003f3 <_panic>
+  if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  801dd9:	83 ec 08             	sub    $0x8,%esp
+  801ddc:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  801de2:	50                   	push   %eax
+  801de3:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  801de9:	e8 8e f1 ff ff       	call   800f7c <sys_env_set_trapframe>
+  801dee:	83 c4 10             	add    $0x10,%esp
+  801df1:	85 c0                	test   %eax,%eax
+  801df3:	78 25                	js     801e1a <spawn+0x4e9>
+  if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  801df5:	83 ec 08             	sub    $0x8,%esp
+  801df8:	6a 02                	push   $0x2
+  801dfa:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  801e00:	e8 35 f1 ff ff       	call   800f3a <sys_env_set_status>
+  801e05:	83 c4 10             	add    $0x10,%esp
+  801e08:	85 c0                	test   %eax,%eax
+  801e0a:	78 23                	js     801e2f <spawn+0x4fe>
+  return child;
+  801e0c:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  801e12:	89 85 8c fd ff ff    	mov    %eax,-0x274(%ebp)
+  801e18:	eb 36                	jmp    801e50 <spawn+0x51f>
+    panic("sys_env_set_trapframe: %e", r);
+  801e1a:	50                   	push   %eax
+  801e1b:	68 b6 32 80 00       	push   $0x8032b6
+  801e20:	68 86 00 00 00       	push   $0x86
+  801e25:	68 8d 32 80 00       	push   $0x80328d
+  801e2a:	e8 c4 e5 ff ff       	call   8003f3 <_panic>
+    panic("sys_env_set_status: %e", r);
+  801e2f:	50                   	push   %eax
+  801e30:	68 d0 32 80 00       	push   $0x8032d0
+  801e35:	68 89 00 00 00       	push   $0x89
+  801e3a:	68 8d 32 80 00       	push   $0x80328d
+  801e3f:	e8 af e5 ff ff       	call   8003f3 <_panic>
+    return r;
+  801e44:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  801e4a:	89 85 8c fd ff ff    	mov    %eax,-0x274(%ebp)
+}
+  801e50:	8b 85 8c fd ff ff    	mov    -0x274(%ebp),%eax
+  801e56:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e59:	5b                   	pop    %ebx
+  801e5a:	5e                   	pop    %esi
+  801e5b:	5f                   	pop    %edi
+  801e5c:	5d                   	pop    %ebp
+  801e5d:	c3                   	ret
+  801e5e:	89 c7                	mov    %eax,%edi
+  801e60:	e9 02 fe ff ff       	jmp    801c67 <spawn+0x336>
+  801e65:	89 c7                	mov    %eax,%edi
+  801e67:	e9 fb fd ff ff       	jmp    801c67 <spawn+0x336>
+  801e6c:	89 c7                	mov    %eax,%edi
+  801e6e:	e9 f4 fd ff ff       	jmp    801c67 <spawn+0x336>
+    return -E_NO_MEM;
+  801e73:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  return r;
+  801e78:	89 85 8c fd ff ff    	mov    %eax,-0x274(%ebp)
+  801e7e:	eb d0                	jmp    801e50 <spawn+0x51f>
+  sys_page_unmap(0, UTEMP);
+  801e80:	83 ec 08             	sub    $0x8,%esp
+  801e83:	68 00 00 40 00       	push   $0x400000
+  801e88:	6a 00                	push   $0x0
+  801e8a:	e8 69 f0 ff ff       	call   800ef8 <sys_page_unmap>
+  801e8f:	83 c4 10             	add    $0x10,%esp
+  801e92:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+  801e98:	eb b6                	jmp    801e50 <spawn+0x51f>
+
+00801e9a <spawnl>:
+spawnl(const char *prog, const char *arg0, ...) {
+  801e9a:	55                   	push   %ebp
+  801e9b:	89 e5                	mov    %esp,%ebp
+  801e9d:	56                   	push   %esi
+  801e9e:	53                   	push   %ebx
+  va_start(vl, arg0);
+  801e9f:	8d 55 10             	lea    0x10(%ebp),%edx
+  int argc = 0;
+  801ea2:	b8 00 00 00 00       	mov    $0x0,%eax
+  while (va_arg(vl, void *) != NULL)
+  801ea7:	eb 05                	jmp    801eae <spawnl+0x14>
+    argc++;
+  801ea9:	83 c0 01             	add    $0x1,%eax
+  while (va_arg(vl, void *) != NULL)
+  801eac:	89 ca                	mov    %ecx,%edx
+  801eae:	8d 4a 04             	lea    0x4(%edx),%ecx
+  801eb1:	83 3a 00             	cmpl   $0x0,(%edx)
+  801eb4:	75 f3                	jne    801ea9 <spawnl+0xf>
+  const char *argv[argc + 2];
+  801eb6:	8d 14 85 17 00 00 00 	lea    0x17(,%eax,4),%edx
+  801ebd:	83 e2 f0             	and    $0xfffffff0,%edx
+  801ec0:	29 d4                	sub    %edx,%esp
+  801ec2:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  801ec6:	89 da                	mov    %ebx,%edx
+  801ec8:	c1 ea 02             	shr    $0x2,%edx
+  801ecb:	83 e3 fc             	and    $0xfffffffc,%ebx
+  argv[0] = arg0;
+  801ece:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ed1:	89 0c 95 00 00 00 00 	mov    %ecx,0x0(,%edx,4)
+  argv[argc + 1] = NULL;
+  801ed8:	c7 44 83 04 00 00 00 	movl   $0x0,0x4(%ebx,%eax,4)
+  801edf:	00 
+  va_start(vl, arg0);
+  801ee0:	8d 4d 10             	lea    0x10(%ebp),%ecx
+  for (i = 0; i < argc; i++)
+  801ee3:	89 c2                	mov    %eax,%edx
+  801ee5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eea:	eb 0b                	jmp    801ef7 <spawnl+0x5d>
+    argv[i + 1] = va_arg(vl, const char *);
+  801eec:	83 c0 01             	add    $0x1,%eax
+  801eef:	8b 31                	mov    (%ecx),%esi
+  801ef1:	89 34 83             	mov    %esi,(%ebx,%eax,4)
+  801ef4:	8d 49 04             	lea    0x4(%ecx),%ecx
+  for (i = 0; i < argc; i++)
+  801ef7:	39 d0                	cmp    %edx,%eax
+  801ef9:	75 f1                	jne    801eec <spawnl+0x52>
+  return spawn(prog, argv);
+  801efb:	83 ec 08             	sub    $0x8,%esp
+  801efe:	53                   	push   %ebx
+  801eff:	ff 75 08             	push   0x8(%ebp)
+  801f02:	e8 2a fa ff ff       	call   801931 <spawn>
+}
+  801f07:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f0a:	5b                   	pop    %ebx
+  801f0b:	5e                   	pop    %esi
+  801f0c:	5d                   	pop    %ebp
+  801f0d:	c3                   	ret
+
+00801f0e <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801f0e:	55                   	push   %ebp
+  801f0f:	89 e5                	mov    %esp,%ebp
+  801f11:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801f14:	68 36 33 80 00       	push   $0x803336
+  801f19:	ff 75 0c             	push   0xc(%ebp)
+  801f1c:	e8 66 eb ff ff       	call   800a87 <strcpy>
+	return 0;
+}
+  801f21:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f26:	c9                   	leave
+  801f27:	c3                   	ret
+
+00801f28 <devsock_close>:
+{
+  801f28:	55                   	push   %ebp
+  801f29:	89 e5                	mov    %esp,%ebp
+  801f2b:	53                   	push   %ebx
+  801f2c:	83 ec 10             	sub    $0x10,%esp
+  801f2f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801f32:	53                   	push   %ebx
+  801f33:	e8 e0 08 00 00       	call   802818 <pageref>
+  801f38:	89 c2                	mov    %eax,%edx
+  801f3a:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801f3d:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801f42:	83 fa 01             	cmp    $0x1,%edx
+  801f45:	74 05                	je     801f4c <devsock_close+0x24>
+}
+  801f47:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f4a:	c9                   	leave
+  801f4b:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801f4c:	83 ec 0c             	sub    $0xc,%esp
+  801f4f:	ff 73 0c             	push   0xc(%ebx)
+  801f52:	e8 b7 02 00 00       	call   80220e <nsipc_close>
+  801f57:	83 c4 10             	add    $0x10,%esp
+  801f5a:	eb eb                	jmp    801f47 <devsock_close+0x1f>
+
+00801f5c <devsock_write>:
+{
+  801f5c:	55                   	push   %ebp
+  801f5d:	89 e5                	mov    %esp,%ebp
+  801f5f:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801f62:	6a 00                	push   $0x0
+  801f64:	ff 75 10             	push   0x10(%ebp)
+  801f67:	ff 75 0c             	push   0xc(%ebp)
+  801f6a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f6d:	ff 70 0c             	push   0xc(%eax)
+  801f70:	e8 79 03 00 00       	call   8022ee <nsipc_send>
+}
+  801f75:	c9                   	leave
+  801f76:	c3                   	ret
+
+00801f77 <devsock_read>:
+{
+  801f77:	55                   	push   %ebp
+  801f78:	89 e5                	mov    %esp,%ebp
+  801f7a:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801f7d:	6a 00                	push   $0x0
+  801f7f:	ff 75 10             	push   0x10(%ebp)
+  801f82:	ff 75 0c             	push   0xc(%ebp)
+  801f85:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f88:	ff 70 0c             	push   0xc(%eax)
+  801f8b:	e8 ef 02 00 00       	call   80227f <nsipc_recv>
+}
+  801f90:	c9                   	leave
+  801f91:	c3                   	ret
+
+00801f92 <fd2sockid>:
+{
+  801f92:	55                   	push   %ebp
+  801f93:	89 e5                	mov    %esp,%ebp
+  801f95:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801f98:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801f9b:	52                   	push   %edx
+  801f9c:	50                   	push   %eax
+  801f9d:	e8 21 f2 ff ff       	call   8011c3 <fd_lookup>
+  801fa2:	83 c4 10             	add    $0x10,%esp
+  801fa5:	85 c0                	test   %eax,%eax
+  801fa7:	78 10                	js     801fb9 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801fa9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801fac:	8b 0d ac 57 80 00    	mov    0x8057ac,%ecx
+  801fb2:	39 08                	cmp    %ecx,(%eax)
+  801fb4:	75 05                	jne    801fbb <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801fb6:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801fb9:	c9                   	leave
+  801fba:	c3                   	ret
+		return -E_NOT_SUPP;
+  801fbb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801fc0:	eb f7                	jmp    801fb9 <fd2sockid+0x27>
+
+00801fc2 <alloc_sockfd>:
+{
+  801fc2:	55                   	push   %ebp
+  801fc3:	89 e5                	mov    %esp,%ebp
+  801fc5:	56                   	push   %esi
+  801fc6:	53                   	push   %ebx
+  801fc7:	83 ec 1c             	sub    $0x1c,%esp
+  801fca:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801fcc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fcf:	50                   	push   %eax
+  801fd0:	e8 98 f1 ff ff       	call   80116d <fd_alloc>
+  801fd5:	89 c3                	mov    %eax,%ebx
+  801fd7:	83 c4 10             	add    $0x10,%esp
+  801fda:	85 c0                	test   %eax,%eax
+  801fdc:	78 43                	js     802021 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801fde:	83 ec 04             	sub    $0x4,%esp
+  801fe1:	68 07 04 00 00       	push   $0x407
+  801fe6:	ff 75 f4             	push   -0xc(%ebp)
+  801fe9:	6a 00                	push   $0x0
+  801feb:	e8 83 ee ff ff       	call   800e73 <sys_page_alloc>
+  801ff0:	89 c3                	mov    %eax,%ebx
+  801ff2:	83 c4 10             	add    $0x10,%esp
+  801ff5:	85 c0                	test   %eax,%eax
+  801ff7:	78 28                	js     802021 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801ff9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ffc:	8b 15 ac 57 80 00    	mov    0x8057ac,%edx
+  802002:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802004:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802007:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  80200e:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802011:	83 ec 0c             	sub    $0xc,%esp
+  802014:	50                   	push   %eax
+  802015:	e8 2c f1 ff ff       	call   801146 <fd2num>
+  80201a:	89 c3                	mov    %eax,%ebx
+  80201c:	83 c4 10             	add    $0x10,%esp
+  80201f:	eb 0c                	jmp    80202d <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802021:	83 ec 0c             	sub    $0xc,%esp
+  802024:	56                   	push   %esi
+  802025:	e8 e4 01 00 00       	call   80220e <nsipc_close>
+		return r;
+  80202a:	83 c4 10             	add    $0x10,%esp
+}
+  80202d:	89 d8                	mov    %ebx,%eax
+  80202f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802032:	5b                   	pop    %ebx
+  802033:	5e                   	pop    %esi
+  802034:	5d                   	pop    %ebp
+  802035:	c3                   	ret
+
+00802036 <accept>:
+{
+  802036:	55                   	push   %ebp
+  802037:	89 e5                	mov    %esp,%ebp
+  802039:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80203c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80203f:	e8 4e ff ff ff       	call   801f92 <fd2sockid>
+  802044:	85 c0                	test   %eax,%eax
+  802046:	78 1b                	js     802063 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802048:	83 ec 04             	sub    $0x4,%esp
+  80204b:	ff 75 10             	push   0x10(%ebp)
+  80204e:	ff 75 0c             	push   0xc(%ebp)
+  802051:	50                   	push   %eax
+  802052:	e8 0e 01 00 00       	call   802165 <nsipc_accept>
+  802057:	83 c4 10             	add    $0x10,%esp
+  80205a:	85 c0                	test   %eax,%eax
+  80205c:	78 05                	js     802063 <accept+0x2d>
+	return alloc_sockfd(r);
+  80205e:	e8 5f ff ff ff       	call   801fc2 <alloc_sockfd>
+}
+  802063:	c9                   	leave
+  802064:	c3                   	ret
+
+00802065 <bind>:
+{
+  802065:	55                   	push   %ebp
+  802066:	89 e5                	mov    %esp,%ebp
+  802068:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80206b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80206e:	e8 1f ff ff ff       	call   801f92 <fd2sockid>
+  802073:	85 c0                	test   %eax,%eax
+  802075:	78 12                	js     802089 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802077:	83 ec 04             	sub    $0x4,%esp
+  80207a:	ff 75 10             	push   0x10(%ebp)
+  80207d:	ff 75 0c             	push   0xc(%ebp)
+  802080:	50                   	push   %eax
+  802081:	e8 31 01 00 00       	call   8021b7 <nsipc_bind>
+  802086:	83 c4 10             	add    $0x10,%esp
+}
+  802089:	c9                   	leave
+  80208a:	c3                   	ret
+
+0080208b <shutdown>:
+{
+  80208b:	55                   	push   %ebp
+  80208c:	89 e5                	mov    %esp,%ebp
+  80208e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802091:	8b 45 08             	mov    0x8(%ebp),%eax
+  802094:	e8 f9 fe ff ff       	call   801f92 <fd2sockid>
+  802099:	85 c0                	test   %eax,%eax
+  80209b:	78 0f                	js     8020ac <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  80209d:	83 ec 08             	sub    $0x8,%esp
+  8020a0:	ff 75 0c             	push   0xc(%ebp)
+  8020a3:	50                   	push   %eax
+  8020a4:	e8 43 01 00 00       	call   8021ec <nsipc_shutdown>
+  8020a9:	83 c4 10             	add    $0x10,%esp
+}
+  8020ac:	c9                   	leave
+  8020ad:	c3                   	ret
+
+008020ae <connect>:
+{
+  8020ae:	55                   	push   %ebp
+  8020af:	89 e5                	mov    %esp,%ebp
+  8020b1:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8020b4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020b7:	e8 d6 fe ff ff       	call   801f92 <fd2sockid>
+  8020bc:	85 c0                	test   %eax,%eax
+  8020be:	78 12                	js     8020d2 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8020c0:	83 ec 04             	sub    $0x4,%esp
+  8020c3:	ff 75 10             	push   0x10(%ebp)
+  8020c6:	ff 75 0c             	push   0xc(%ebp)
+  8020c9:	50                   	push   %eax
+  8020ca:	e8 59 01 00 00       	call   802228 <nsipc_connect>
+  8020cf:	83 c4 10             	add    $0x10,%esp
+}
+  8020d2:	c9                   	leave
+  8020d3:	c3                   	ret
+
+008020d4 <listen>:
+{
+  8020d4:	55                   	push   %ebp
+  8020d5:	89 e5                	mov    %esp,%ebp
+  8020d7:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8020da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020dd:	e8 b0 fe ff ff       	call   801f92 <fd2sockid>
+  8020e2:	85 c0                	test   %eax,%eax
+  8020e4:	78 0f                	js     8020f5 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8020e6:	83 ec 08             	sub    $0x8,%esp
+  8020e9:	ff 75 0c             	push   0xc(%ebp)
+  8020ec:	50                   	push   %eax
+  8020ed:	e8 6b 01 00 00       	call   80225d <nsipc_listen>
+  8020f2:	83 c4 10             	add    $0x10,%esp
+}
+  8020f5:	c9                   	leave
+  8020f6:	c3                   	ret
+
+008020f7 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8020f7:	55                   	push   %ebp
+  8020f8:	89 e5                	mov    %esp,%ebp
+  8020fa:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8020fd:	ff 75 10             	push   0x10(%ebp)
+  802100:	ff 75 0c             	push   0xc(%ebp)
+  802103:	ff 75 08             	push   0x8(%ebp)
+  802106:	e8 41 02 00 00       	call   80234c <nsipc_socket>
+  80210b:	83 c4 10             	add    $0x10,%esp
+  80210e:	85 c0                	test   %eax,%eax
+  802110:	78 05                	js     802117 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802112:	e8 ab fe ff ff       	call   801fc2 <alloc_sockfd>
+}
+  802117:	c9                   	leave
+  802118:	c3                   	ret
+
+00802119 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802119:	55                   	push   %ebp
+  80211a:	89 e5                	mov    %esp,%ebp
+  80211c:	53                   	push   %ebx
+  80211d:	83 ec 04             	sub    $0x4,%esp
+  802120:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802122:	83 3d 04 60 80 00 00 	cmpl   $0x0,0x806004
+  802129:	74 26                	je     802151 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  80212b:	6a 07                	push   $0x7
+  80212d:	68 00 90 80 00       	push   $0x809000
+  802132:	53                   	push   %ebx
+  802133:	ff 35 04 60 80 00    	push   0x806004
+  802139:	e8 47 06 00 00       	call   802785 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  80213e:	83 c4 0c             	add    $0xc,%esp
+  802141:	6a 00                	push   $0x0
+  802143:	6a 00                	push   $0x0
+  802145:	6a 00                	push   $0x0
+  802147:	e8 c5 05 00 00       	call   802711 <ipc_recv>
+}
+  80214c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80214f:	c9                   	leave
+  802150:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802151:	83 ec 0c             	sub    $0xc,%esp
+  802154:	6a 02                	push   $0x2
+  802156:	e8 7e 06 00 00       	call   8027d9 <ipc_find_env>
+  80215b:	a3 04 60 80 00       	mov    %eax,0x806004
+  802160:	83 c4 10             	add    $0x10,%esp
+  802163:	eb c6                	jmp    80212b <nsipc+0x12>
+
+00802165 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802165:	55                   	push   %ebp
+  802166:	89 e5                	mov    %esp,%ebp
+  802168:	56                   	push   %esi
+  802169:	53                   	push   %ebx
+  80216a:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  80216d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802170:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802175:	8b 06                	mov    (%esi),%eax
+  802177:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  80217c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802181:	e8 93 ff ff ff       	call   802119 <nsipc>
+  802186:	89 c3                	mov    %eax,%ebx
+  802188:	85 c0                	test   %eax,%eax
+  80218a:	79 09                	jns    802195 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  80218c:	89 d8                	mov    %ebx,%eax
+  80218e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802191:	5b                   	pop    %ebx
+  802192:	5e                   	pop    %esi
+  802193:	5d                   	pop    %ebp
+  802194:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802195:	83 ec 04             	sub    $0x4,%esp
+  802198:	ff 35 10 90 80 00    	push   0x809010
+  80219e:	68 00 90 80 00       	push   $0x809000
+  8021a3:	ff 75 0c             	push   0xc(%ebp)
+  8021a6:	e8 62 ea ff ff       	call   800c0d <memmove>
+		*addrlen = ret->ret_addrlen;
+  8021ab:	a1 10 90 80 00       	mov    0x809010,%eax
+  8021b0:	89 06                	mov    %eax,(%esi)
+  8021b2:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8021b5:	eb d5                	jmp    80218c <nsipc_accept+0x27>
+
+008021b7 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8021b7:	55                   	push   %ebp
+  8021b8:	89 e5                	mov    %esp,%ebp
+  8021ba:	53                   	push   %ebx
+  8021bb:	83 ec 08             	sub    $0x8,%esp
+  8021be:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8021c1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021c4:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8021c9:	53                   	push   %ebx
+  8021ca:	ff 75 0c             	push   0xc(%ebp)
+  8021cd:	68 04 90 80 00       	push   $0x809004
+  8021d2:	e8 36 ea ff ff       	call   800c0d <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8021d7:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_BIND);
+  8021dd:	b8 02 00 00 00       	mov    $0x2,%eax
+  8021e2:	e8 32 ff ff ff       	call   802119 <nsipc>
+}
+  8021e7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021ea:	c9                   	leave
+  8021eb:	c3                   	ret
+
+008021ec <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8021ec:	55                   	push   %ebp
+  8021ed:	89 e5                	mov    %esp,%ebp
+  8021ef:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8021f2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021f5:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.shutdown.req_how = how;
+  8021fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021fd:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_SHUTDOWN);
+  802202:	b8 03 00 00 00       	mov    $0x3,%eax
+  802207:	e8 0d ff ff ff       	call   802119 <nsipc>
+}
+  80220c:	c9                   	leave
+  80220d:	c3                   	ret
+
+0080220e <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  80220e:	55                   	push   %ebp
+  80220f:	89 e5                	mov    %esp,%ebp
+  802211:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802214:	8b 45 08             	mov    0x8(%ebp),%eax
+  802217:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_CLOSE);
+  80221c:	b8 04 00 00 00       	mov    $0x4,%eax
+  802221:	e8 f3 fe ff ff       	call   802119 <nsipc>
+}
+  802226:	c9                   	leave
+  802227:	c3                   	ret
+
+00802228 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802228:	55                   	push   %ebp
+  802229:	89 e5                	mov    %esp,%ebp
+  80222b:	53                   	push   %ebx
+  80222c:	83 ec 08             	sub    $0x8,%esp
+  80222f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802232:	8b 45 08             	mov    0x8(%ebp),%eax
+  802235:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  80223a:	53                   	push   %ebx
+  80223b:	ff 75 0c             	push   0xc(%ebp)
+  80223e:	68 04 90 80 00       	push   $0x809004
+  802243:	e8 c5 e9 ff ff       	call   800c0d <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802248:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_CONNECT);
+  80224e:	b8 05 00 00 00       	mov    $0x5,%eax
+  802253:	e8 c1 fe ff ff       	call   802119 <nsipc>
+}
+  802258:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80225b:	c9                   	leave
+  80225c:	c3                   	ret
+
+0080225d <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  80225d:	55                   	push   %ebp
+  80225e:	89 e5                	mov    %esp,%ebp
+  802260:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802263:	8b 45 08             	mov    0x8(%ebp),%eax
+  802266:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.listen.req_backlog = backlog;
+  80226b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80226e:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_LISTEN);
+  802273:	b8 06 00 00 00       	mov    $0x6,%eax
+  802278:	e8 9c fe ff ff       	call   802119 <nsipc>
+}
+  80227d:	c9                   	leave
+  80227e:	c3                   	ret
+
+0080227f <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  80227f:	55                   	push   %ebp
+  802280:	89 e5                	mov    %esp,%ebp
+  802282:	56                   	push   %esi
+  802283:	53                   	push   %ebx
+  802284:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802287:	8b 45 08             	mov    0x8(%ebp),%eax
+  80228a:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.recv.req_len = len;
+  80228f:	89 35 04 90 80 00    	mov    %esi,0x809004
+	nsipcbuf.recv.req_flags = flags;
+  802295:	8b 45 14             	mov    0x14(%ebp),%eax
+  802298:	a3 08 90 80 00       	mov    %eax,0x809008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  80229d:	b8 07 00 00 00       	mov    $0x7,%eax
+  8022a2:	e8 72 fe ff ff       	call   802119 <nsipc>
+  8022a7:	89 c3                	mov    %eax,%ebx
+  8022a9:	85 c0                	test   %eax,%eax
+  8022ab:	78 22                	js     8022cf <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8022ad:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8022b2:	39 c6                	cmp    %eax,%esi
+  8022b4:	0f 4e c6             	cmovle %esi,%eax
+  8022b7:	39 c3                	cmp    %eax,%ebx
+  8022b9:	7f 1d                	jg     8022d8 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8022bb:	83 ec 04             	sub    $0x4,%esp
+  8022be:	53                   	push   %ebx
+  8022bf:	68 00 90 80 00       	push   $0x809000
+  8022c4:	ff 75 0c             	push   0xc(%ebp)
+  8022c7:	e8 41 e9 ff ff       	call   800c0d <memmove>
+  8022cc:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8022cf:	89 d8                	mov    %ebx,%eax
+  8022d1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022d4:	5b                   	pop    %ebx
+  8022d5:	5e                   	pop    %esi
+  8022d6:	5d                   	pop    %ebp
+  8022d7:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8022d8:	68 42 33 80 00       	push   $0x803342
+  8022dd:	68 47 32 80 00       	push   $0x803247
+  8022e2:	6a 62                	push   $0x62
+  8022e4:	68 57 33 80 00       	push   $0x803357
+  8022e9:	e8 05 e1 ff ff       	call   8003f3 <_panic>
+
+008022ee <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8022ee:	55                   	push   %ebp
+  8022ef:	89 e5                	mov    %esp,%ebp
+  8022f1:	53                   	push   %ebx
+  8022f2:	83 ec 04             	sub    $0x4,%esp
+  8022f5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8022f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022fb:	a3 00 90 80 00       	mov    %eax,0x809000
+	assert(size < 1600);
+  802300:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802306:	7f 2e                	jg     802336 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802308:	83 ec 04             	sub    $0x4,%esp
+  80230b:	53                   	push   %ebx
+  80230c:	ff 75 0c             	push   0xc(%ebp)
+  80230f:	68 0c 90 80 00       	push   $0x80900c
+  802314:	e8 f4 e8 ff ff       	call   800c0d <memmove>
+	nsipcbuf.send.req_size = size;
+  802319:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	nsipcbuf.send.req_flags = flags;
+  80231f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802322:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SEND);
+  802327:	b8 08 00 00 00       	mov    $0x8,%eax
+  80232c:	e8 e8 fd ff ff       	call   802119 <nsipc>
+}
+  802331:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802334:	c9                   	leave
+  802335:	c3                   	ret
+	assert(size < 1600);
+  802336:	68 63 33 80 00       	push   $0x803363
+  80233b:	68 47 32 80 00       	push   $0x803247
+  802340:	6a 6d                	push   $0x6d
+  802342:	68 57 33 80 00       	push   $0x803357
+  802347:	e8 a7 e0 ff ff       	call   8003f3 <_panic>
+
+0080234c <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80234c:	55                   	push   %ebp
+  80234d:	89 e5                	mov    %esp,%ebp
+  80234f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802352:	8b 45 08             	mov    0x8(%ebp),%eax
+  802355:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.socket.req_type = type;
+  80235a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80235d:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.socket.req_protocol = protocol;
+  802362:	8b 45 10             	mov    0x10(%ebp),%eax
+  802365:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SOCKET);
+  80236a:	b8 09 00 00 00       	mov    $0x9,%eax
+  80236f:	e8 a5 fd ff ff       	call   802119 <nsipc>
+}
+  802374:	c9                   	leave
+  802375:	c3                   	ret
+
+00802376 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802376:	55                   	push   %ebp
+  802377:	89 e5                	mov    %esp,%ebp
+  802379:	56                   	push   %esi
+  80237a:	53                   	push   %ebx
+  80237b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80237e:	83 ec 0c             	sub    $0xc,%esp
+  802381:	ff 75 08             	push   0x8(%ebp)
+  802384:	e8 cd ed ff ff       	call   801156 <fd2data>
+  802389:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80238b:	83 c4 08             	add    $0x8,%esp
+  80238e:	68 6f 33 80 00       	push   $0x80336f
+  802393:	53                   	push   %ebx
+  802394:	e8 ee e6 ff ff       	call   800a87 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802399:	8b 46 04             	mov    0x4(%esi),%eax
+  80239c:	2b 06                	sub    (%esi),%eax
+  80239e:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8023a4:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8023ab:	00 00 00 
+	stat->st_dev = &devpipe;
+  8023ae:	c7 83 88 00 00 00 c8 	movl   $0x8057c8,0x88(%ebx)
+  8023b5:	57 80 00 
+	return 0;
+}
+  8023b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023bd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023c0:	5b                   	pop    %ebx
+  8023c1:	5e                   	pop    %esi
+  8023c2:	5d                   	pop    %ebp
+  8023c3:	c3                   	ret
+
+008023c4 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8023c4:	55                   	push   %ebp
+  8023c5:	89 e5                	mov    %esp,%ebp
+  8023c7:	53                   	push   %ebx
+  8023c8:	83 ec 0c             	sub    $0xc,%esp
+  8023cb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8023ce:	53                   	push   %ebx
+  8023cf:	6a 00                	push   $0x0
+  8023d1:	e8 22 eb ff ff       	call   800ef8 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8023d6:	89 1c 24             	mov    %ebx,(%esp)
+  8023d9:	e8 78 ed ff ff       	call   801156 <fd2data>
+  8023de:	83 c4 08             	add    $0x8,%esp
+  8023e1:	50                   	push   %eax
+  8023e2:	6a 00                	push   $0x0
+  8023e4:	e8 0f eb ff ff       	call   800ef8 <sys_page_unmap>
+}
+  8023e9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023ec:	c9                   	leave
+  8023ed:	c3                   	ret
+
+008023ee <_pipeisclosed>:
+{
+  8023ee:	55                   	push   %ebp
+  8023ef:	89 e5                	mov    %esp,%ebp
+  8023f1:	57                   	push   %edi
+  8023f2:	56                   	push   %esi
+  8023f3:	53                   	push   %ebx
+  8023f4:	83 ec 1c             	sub    $0x1c,%esp
+  8023f7:	89 c7                	mov    %eax,%edi
+  8023f9:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  8023fb:	a1 90 77 80 00       	mov    0x807790,%eax
+  802400:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802403:	83 ec 0c             	sub    $0xc,%esp
+  802406:	57                   	push   %edi
+  802407:	e8 0c 04 00 00       	call   802818 <pageref>
+  80240c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80240f:	89 34 24             	mov    %esi,(%esp)
+  802412:	e8 01 04 00 00       	call   802818 <pageref>
+		nn = thisenv->env_runs;
+  802417:	8b 15 90 77 80 00    	mov    0x807790,%edx
+  80241d:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  802420:	83 c4 10             	add    $0x10,%esp
+  802423:	39 cb                	cmp    %ecx,%ebx
+  802425:	74 1b                	je     802442 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802427:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80242a:	75 cf                	jne    8023fb <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80242c:	8b 42 58             	mov    0x58(%edx),%eax
+  80242f:	6a 01                	push   $0x1
+  802431:	50                   	push   %eax
+  802432:	53                   	push   %ebx
+  802433:	68 76 33 80 00       	push   $0x803376
+  802438:	e8 91 e0 ff ff       	call   8004ce <cprintf>
+  80243d:	83 c4 10             	add    $0x10,%esp
+  802440:	eb b9                	jmp    8023fb <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802442:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802445:	0f 94 c0             	sete   %al
+  802448:	0f b6 c0             	movzbl %al,%eax
+}
+  80244b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80244e:	5b                   	pop    %ebx
+  80244f:	5e                   	pop    %esi
+  802450:	5f                   	pop    %edi
+  802451:	5d                   	pop    %ebp
+  802452:	c3                   	ret
+
+00802453 <devpipe_write>:
+{
+  802453:	55                   	push   %ebp
+  802454:	89 e5                	mov    %esp,%ebp
+  802456:	57                   	push   %edi
+  802457:	56                   	push   %esi
+  802458:	53                   	push   %ebx
+  802459:	83 ec 28             	sub    $0x28,%esp
+  80245c:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  80245f:	56                   	push   %esi
+  802460:	e8 f1 ec ff ff       	call   801156 <fd2data>
+  802465:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802467:	83 c4 10             	add    $0x10,%esp
+  80246a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80246f:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802472:	75 09                	jne    80247d <devpipe_write+0x2a>
+	return i;
+  802474:	89 f8                	mov    %edi,%eax
+  802476:	eb 23                	jmp    80249b <devpipe_write+0x48>
+			sys_yield();
+  802478:	e8 d7 e9 ff ff       	call   800e54 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80247d:	8b 43 04             	mov    0x4(%ebx),%eax
+  802480:	8b 0b                	mov    (%ebx),%ecx
+  802482:	8d 51 20             	lea    0x20(%ecx),%edx
+  802485:	39 d0                	cmp    %edx,%eax
+  802487:	72 1a                	jb     8024a3 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802489:	89 da                	mov    %ebx,%edx
+  80248b:	89 f0                	mov    %esi,%eax
+  80248d:	e8 5c ff ff ff       	call   8023ee <_pipeisclosed>
+  802492:	85 c0                	test   %eax,%eax
+  802494:	74 e2                	je     802478 <devpipe_write+0x25>
+				return 0;
+  802496:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80249b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80249e:	5b                   	pop    %ebx
+  80249f:	5e                   	pop    %esi
+  8024a0:	5f                   	pop    %edi
+  8024a1:	5d                   	pop    %ebp
+  8024a2:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8024a3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8024a6:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8024aa:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8024ad:	89 c2                	mov    %eax,%edx
+  8024af:	c1 fa 1f             	sar    $0x1f,%edx
+  8024b2:	89 d1                	mov    %edx,%ecx
+  8024b4:	c1 e9 1b             	shr    $0x1b,%ecx
+  8024b7:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8024ba:	83 e2 1f             	and    $0x1f,%edx
+  8024bd:	29 ca                	sub    %ecx,%edx
+  8024bf:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8024c3:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8024c7:	83 c0 01             	add    $0x1,%eax
+  8024ca:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8024cd:	83 c7 01             	add    $0x1,%edi
+  8024d0:	eb 9d                	jmp    80246f <devpipe_write+0x1c>
+
+008024d2 <devpipe_read>:
+{
+  8024d2:	55                   	push   %ebp
+  8024d3:	89 e5                	mov    %esp,%ebp
+  8024d5:	57                   	push   %edi
+  8024d6:	56                   	push   %esi
+  8024d7:	53                   	push   %ebx
+  8024d8:	83 ec 18             	sub    $0x18,%esp
+  8024db:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8024de:	57                   	push   %edi
+  8024df:	e8 72 ec ff ff       	call   801156 <fd2data>
+  8024e4:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8024e6:	83 c4 10             	add    $0x10,%esp
+  8024e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8024ee:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8024f1:	75 13                	jne    802506 <devpipe_read+0x34>
+	return i;
+  8024f3:	89 f0                	mov    %esi,%eax
+  8024f5:	eb 02                	jmp    8024f9 <devpipe_read+0x27>
+				return i;
+  8024f7:	89 f0                	mov    %esi,%eax
+}
+  8024f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024fc:	5b                   	pop    %ebx
+  8024fd:	5e                   	pop    %esi
+  8024fe:	5f                   	pop    %edi
+  8024ff:	5d                   	pop    %ebp
+  802500:	c3                   	ret
+			sys_yield();
+  802501:	e8 4e e9 ff ff       	call   800e54 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802506:	8b 03                	mov    (%ebx),%eax
+  802508:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80250b:	75 18                	jne    802525 <devpipe_read+0x53>
+			if (i > 0)
+  80250d:	85 f6                	test   %esi,%esi
+  80250f:	75 e6                	jne    8024f7 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802511:	89 da                	mov    %ebx,%edx
+  802513:	89 f8                	mov    %edi,%eax
+  802515:	e8 d4 fe ff ff       	call   8023ee <_pipeisclosed>
+  80251a:	85 c0                	test   %eax,%eax
+  80251c:	74 e3                	je     802501 <devpipe_read+0x2f>
+				return 0;
+  80251e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802523:	eb d4                	jmp    8024f9 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802525:	99                   	cltd
+  802526:	c1 ea 1b             	shr    $0x1b,%edx
+  802529:	01 d0                	add    %edx,%eax
+  80252b:	83 e0 1f             	and    $0x1f,%eax
+  80252e:	29 d0                	sub    %edx,%eax
+  802530:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802535:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802538:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80253b:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80253e:	83 c6 01             	add    $0x1,%esi
+  802541:	eb ab                	jmp    8024ee <devpipe_read+0x1c>
+
+00802543 <pipe>:
+{
+  802543:	55                   	push   %ebp
+  802544:	89 e5                	mov    %esp,%ebp
+  802546:	56                   	push   %esi
+  802547:	53                   	push   %ebx
+  802548:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80254b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80254e:	50                   	push   %eax
+  80254f:	e8 19 ec ff ff       	call   80116d <fd_alloc>
+  802554:	89 c3                	mov    %eax,%ebx
+  802556:	83 c4 10             	add    $0x10,%esp
+  802559:	85 c0                	test   %eax,%eax
+  80255b:	0f 88 23 01 00 00    	js     802684 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802561:	83 ec 04             	sub    $0x4,%esp
+  802564:	68 07 04 00 00       	push   $0x407
+  802569:	ff 75 f4             	push   -0xc(%ebp)
+  80256c:	6a 00                	push   $0x0
+  80256e:	e8 00 e9 ff ff       	call   800e73 <sys_page_alloc>
+  802573:	89 c3                	mov    %eax,%ebx
+  802575:	83 c4 10             	add    $0x10,%esp
+  802578:	85 c0                	test   %eax,%eax
+  80257a:	0f 88 04 01 00 00    	js     802684 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802580:	83 ec 0c             	sub    $0xc,%esp
+  802583:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802586:	50                   	push   %eax
+  802587:	e8 e1 eb ff ff       	call   80116d <fd_alloc>
+  80258c:	89 c3                	mov    %eax,%ebx
+  80258e:	83 c4 10             	add    $0x10,%esp
+  802591:	85 c0                	test   %eax,%eax
+  802593:	0f 88 db 00 00 00    	js     802674 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802599:	83 ec 04             	sub    $0x4,%esp
+  80259c:	68 07 04 00 00       	push   $0x407
+  8025a1:	ff 75 f0             	push   -0x10(%ebp)
+  8025a4:	6a 00                	push   $0x0
+  8025a6:	e8 c8 e8 ff ff       	call   800e73 <sys_page_alloc>
+  8025ab:	89 c3                	mov    %eax,%ebx
+  8025ad:	83 c4 10             	add    $0x10,%esp
+  8025b0:	85 c0                	test   %eax,%eax
+  8025b2:	0f 88 bc 00 00 00    	js     802674 <pipe+0x131>
+	va = fd2data(fd0);
+  8025b8:	83 ec 0c             	sub    $0xc,%esp
+  8025bb:	ff 75 f4             	push   -0xc(%ebp)
+  8025be:	e8 93 eb ff ff       	call   801156 <fd2data>
+  8025c3:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8025c5:	83 c4 0c             	add    $0xc,%esp
+  8025c8:	68 07 04 00 00       	push   $0x407
+  8025cd:	50                   	push   %eax
+  8025ce:	6a 00                	push   $0x0
+  8025d0:	e8 9e e8 ff ff       	call   800e73 <sys_page_alloc>
+  8025d5:	89 c3                	mov    %eax,%ebx
+  8025d7:	83 c4 10             	add    $0x10,%esp
+  8025da:	85 c0                	test   %eax,%eax
+  8025dc:	0f 88 82 00 00 00    	js     802664 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8025e2:	83 ec 0c             	sub    $0xc,%esp
+  8025e5:	ff 75 f0             	push   -0x10(%ebp)
+  8025e8:	e8 69 eb ff ff       	call   801156 <fd2data>
+  8025ed:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8025f4:	50                   	push   %eax
+  8025f5:	6a 00                	push   $0x0
+  8025f7:	56                   	push   %esi
+  8025f8:	6a 00                	push   $0x0
+  8025fa:	e8 b7 e8 ff ff       	call   800eb6 <sys_page_map>
+  8025ff:	89 c3                	mov    %eax,%ebx
+  802601:	83 c4 20             	add    $0x20,%esp
+  802604:	85 c0                	test   %eax,%eax
+  802606:	78 4e                	js     802656 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802608:	a1 c8 57 80 00       	mov    0x8057c8,%eax
+  80260d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802610:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802612:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802615:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80261c:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80261f:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802621:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802624:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80262b:	83 ec 0c             	sub    $0xc,%esp
+  80262e:	ff 75 f4             	push   -0xc(%ebp)
+  802631:	e8 10 eb ff ff       	call   801146 <fd2num>
+  802636:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802639:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80263b:	83 c4 04             	add    $0x4,%esp
+  80263e:	ff 75 f0             	push   -0x10(%ebp)
+  802641:	e8 00 eb ff ff       	call   801146 <fd2num>
+  802646:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802649:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80264c:	83 c4 10             	add    $0x10,%esp
+  80264f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802654:	eb 2e                	jmp    802684 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802656:	83 ec 08             	sub    $0x8,%esp
+  802659:	56                   	push   %esi
+  80265a:	6a 00                	push   $0x0
+  80265c:	e8 97 e8 ff ff       	call   800ef8 <sys_page_unmap>
+  802661:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802664:	83 ec 08             	sub    $0x8,%esp
+  802667:	ff 75 f0             	push   -0x10(%ebp)
+  80266a:	6a 00                	push   $0x0
+  80266c:	e8 87 e8 ff ff       	call   800ef8 <sys_page_unmap>
+  802671:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802674:	83 ec 08             	sub    $0x8,%esp
+  802677:	ff 75 f4             	push   -0xc(%ebp)
+  80267a:	6a 00                	push   $0x0
+  80267c:	e8 77 e8 ff ff       	call   800ef8 <sys_page_unmap>
+  802681:	83 c4 10             	add    $0x10,%esp
+}
+  802684:	89 d8                	mov    %ebx,%eax
+  802686:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802689:	5b                   	pop    %ebx
+  80268a:	5e                   	pop    %esi
+  80268b:	5d                   	pop    %ebp
+  80268c:	c3                   	ret
+
+0080268d <pipeisclosed>:
+{
+  80268d:	55                   	push   %ebp
+  80268e:	89 e5                	mov    %esp,%ebp
+  802690:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802693:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802696:	50                   	push   %eax
+  802697:	ff 75 08             	push   0x8(%ebp)
+  80269a:	e8 24 eb ff ff       	call   8011c3 <fd_lookup>
+  80269f:	83 c4 10             	add    $0x10,%esp
+  8026a2:	85 c0                	test   %eax,%eax
+  8026a4:	78 18                	js     8026be <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8026a6:	83 ec 0c             	sub    $0xc,%esp
+  8026a9:	ff 75 f4             	push   -0xc(%ebp)
+  8026ac:	e8 a5 ea ff ff       	call   801156 <fd2data>
+  8026b1:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8026b3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026b6:	e8 33 fd ff ff       	call   8023ee <_pipeisclosed>
+  8026bb:	83 c4 10             	add    $0x10,%esp
+}
+  8026be:	c9                   	leave
+  8026bf:	c3                   	ret
+
+008026c0 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  8026c0:	55                   	push   %ebp
+  8026c1:	89 e5                	mov    %esp,%ebp
+  8026c3:	56                   	push   %esi
+  8026c4:	53                   	push   %ebx
+  8026c5:	8b 75 08             	mov    0x8(%ebp),%esi
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  8026c8:	85 f6                	test   %esi,%esi
+  8026ca:	74 15                	je     8026e1 <wait+0x21>
+	e = &envs[ENVX(envid)];
+  8026cc:	89 f0                	mov    %esi,%eax
+  8026ce:	25 ff 03 00 00       	and    $0x3ff,%eax
+
+    while (e->env_id == envid && e->env_status != ENV_FREE) {
+  8026d3:	8d 1c c0             	lea    (%eax,%eax,8),%ebx
+  8026d6:	c1 e3 04             	shl    $0x4,%ebx
+  8026d9:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  8026df:	eb 1b                	jmp    8026fc <wait+0x3c>
+	assert(envid != 0);
+  8026e1:	68 8e 33 80 00       	push   $0x80338e
+  8026e6:	68 47 32 80 00       	push   $0x803247
+  8026eb:	6a 09                	push   $0x9
+  8026ed:	68 99 33 80 00       	push   $0x803399
+  8026f2:	e8 fc dc ff ff       	call   8003f3 <_panic>
+        sys_yield();
+  8026f7:	e8 58 e7 ff ff       	call   800e54 <sys_yield>
+    while (e->env_id == envid && e->env_status != ENV_FREE) {
+  8026fc:	8b 43 48             	mov    0x48(%ebx),%eax
+  8026ff:	39 f0                	cmp    %esi,%eax
+  802701:	75 07                	jne    80270a <wait+0x4a>
+  802703:	8b 43 54             	mov    0x54(%ebx),%eax
+  802706:	85 c0                	test   %eax,%eax
+  802708:	75 ed                	jne    8026f7 <wait+0x37>
+    }
+}
+  80270a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80270d:	5b                   	pop    %ebx
+  80270e:	5e                   	pop    %esi
+  80270f:	5d                   	pop    %ebp
+  802710:	c3                   	ret
+
+00802711 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  802711:	55                   	push   %ebp
+  802712:	89 e5                	mov    %esp,%ebp
+  802714:	56                   	push   %esi
+  802715:	53                   	push   %ebx
+  802716:	8b 75 08             	mov    0x8(%ebp),%esi
+  802719:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80271c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  80271f:	85 c0                	test   %eax,%eax
+  802721:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802726:	0f 44 c2             	cmove  %edx,%eax
+  802729:	83 ec 0c             	sub    $0xc,%esp
+  80272c:	50                   	push   %eax
+  80272d:	e8 f1 e8 ff ff       	call   801023 <sys_ipc_recv>
+
+  if (from_env_store)
+  802732:	83 c4 10             	add    $0x10,%esp
+  802735:	85 f6                	test   %esi,%esi
+  802737:	74 17                	je     802750 <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  802739:	ba 00 00 00 00       	mov    $0x0,%edx
+  80273e:	85 c0                	test   %eax,%eax
+  802740:	75 0c                	jne    80274e <ipc_recv+0x3d>
+  802742:	8b 15 90 77 80 00    	mov    0x807790,%edx
+  802748:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  80274e:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  802750:	85 db                	test   %ebx,%ebx
+  802752:	74 2b                	je     80277f <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  802754:	85 c0                	test   %eax,%eax
+  802756:	74 0d                	je     802765 <ipc_recv+0x54>
+  802758:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  80275e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802761:	5b                   	pop    %ebx
+  802762:	5e                   	pop    %esi
+  802763:	5d                   	pop    %ebp
+  802764:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  802765:	a1 90 77 80 00       	mov    0x807790,%eax
+  80276a:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  802770:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  802772:	a1 90 77 80 00       	mov    0x807790,%eax
+  802777:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  80277d:	eb df                	jmp    80275e <ipc_recv+0x4d>
+  80277f:	85 c0                	test   %eax,%eax
+  802781:	75 db                	jne    80275e <ipc_recv+0x4d>
+  802783:	eb ed                	jmp    802772 <ipc_recv+0x61>
+
+00802785 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  802785:	55                   	push   %ebp
+  802786:	89 e5                	mov    %esp,%ebp
+  802788:	57                   	push   %edi
+  802789:	56                   	push   %esi
+  80278a:	53                   	push   %ebx
+  80278b:	83 ec 0c             	sub    $0xc,%esp
+  80278e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802791:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802794:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  802797:	85 db                	test   %ebx,%ebx
+  802799:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80279e:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  8027a1:	ff 75 14             	push   0x14(%ebp)
+  8027a4:	53                   	push   %ebx
+  8027a5:	56                   	push   %esi
+  8027a6:	57                   	push   %edi
+  8027a7:	e8 54 e8 ff ff       	call   801000 <sys_ipc_try_send>
+  8027ac:	83 c4 10             	add    $0x10,%esp
+  8027af:	85 c0                	test   %eax,%eax
+  8027b1:	74 1e                	je     8027d1 <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  8027b3:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8027b6:	75 07                	jne    8027bf <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  8027b8:	e8 97 e6 ff ff       	call   800e54 <sys_yield>
+  8027bd:	eb e2                	jmp    8027a1 <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  8027bf:	50                   	push   %eax
+  8027c0:	68 a4 33 80 00       	push   $0x8033a4
+  8027c5:	6a 3c                	push   $0x3c
+  8027c7:	68 b1 33 80 00       	push   $0x8033b1
+  8027cc:	e8 22 dc ff ff       	call   8003f3 <_panic>
+  }
+
+#endif
+}
+  8027d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027d4:	5b                   	pop    %ebx
+  8027d5:	5e                   	pop    %esi
+  8027d6:	5f                   	pop    %edi
+  8027d7:	5d                   	pop    %ebp
+  8027d8:	c3                   	ret
+
+008027d9 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  8027d9:	55                   	push   %ebp
+  8027da:	89 e5                	mov    %esp,%ebp
+  8027dc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  8027df:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  8027e4:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8027e7:	c1 e0 04             	shl    $0x4,%eax
+  8027ea:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8027ef:	8b 40 50             	mov    0x50(%eax),%eax
+  8027f2:	39 c8                	cmp    %ecx,%eax
+  8027f4:	74 12                	je     802808 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  8027f6:	83 c2 01             	add    $0x1,%edx
+  8027f9:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8027ff:	75 e3                	jne    8027e4 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802801:	b8 00 00 00 00       	mov    $0x0,%eax
+  802806:	eb 0e                	jmp    802816 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  802808:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80280b:	c1 e0 04             	shl    $0x4,%eax
+  80280e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802813:	8b 40 48             	mov    0x48(%eax),%eax
+  802816:	5d                   	pop    %ebp
+  802817:	c3                   	ret
+
+00802818 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802818:	55                   	push   %ebp
+  802819:	89 e5                	mov    %esp,%ebp
+  80281b:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80281e:	89 c2                	mov    %eax,%edx
+  802820:	c1 ea 16             	shr    $0x16,%edx
+  802823:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80282a:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80282f:	f6 c1 01             	test   $0x1,%cl
+  802832:	74 1c                	je     802850 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  802834:	c1 e8 0c             	shr    $0xc,%eax
+  802837:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80283e:	a8 01                	test   $0x1,%al
+  802840:	74 0e                	je     802850 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802842:	c1 e8 0c             	shr    $0xc,%eax
+  802845:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  80284c:	ef 
+  80284d:	0f b7 d2             	movzwl %dx,%edx
+}
+  802850:	89 d0                	mov    %edx,%eax
+  802852:	5d                   	pop    %ebp
+  802853:	c3                   	ret
+  802854:	66 90                	xchg   %ax,%ax
+  802856:	66 90                	xchg   %ax,%ax
+  802858:	66 90                	xchg   %ax,%ax
+  80285a:	66 90                	xchg   %ax,%ax
+  80285c:	66 90                	xchg   %ax,%ax
+  80285e:	66 90                	xchg   %ax,%ax
+
+00802860 <__udivmoddi4>:
+  802860:	55                   	push   %ebp
+  802861:	57                   	push   %edi
+  802862:	56                   	push   %esi
+  802863:	53                   	push   %ebx
+  802864:	83 ec 24             	sub    $0x24,%esp
+  802867:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80286b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80286f:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  802873:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802877:	8b 54 24 44          	mov    0x44(%esp),%edx
+  80287b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80287f:	8b 44 24 40          	mov    0x40(%esp),%eax
+  802883:	89 d3                	mov    %edx,%ebx
+  802885:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802889:	09 c3                	or     %eax,%ebx
+  80288b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80288f:	0f 84 9c 00 00 00    	je     802931 <__udivmoddi4+0xd1>
+  802895:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80289c:	00 
+  80289d:	31 c0                	xor    %eax,%eax
+  80289f:	31 d2                	xor    %edx,%edx
+  8028a1:	89 fb                	mov    %edi,%ebx
+  8028a3:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8028aa:	00 
+  8028ab:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8028b0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8028b4:	01 c0                	add    %eax,%eax
+  8028b6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8028bd:	00 
+  8028be:	89 c6                	mov    %eax,%esi
+  8028c0:	89 d7                	mov    %edx,%edi
+  8028c2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8028c6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8028ca:	0f ad d0             	shrd   %cl,%edx,%eax
+  8028cd:	d3 ea                	shr    %cl,%edx
+  8028cf:	f6 c1 20             	test   $0x20,%cl
+  8028d2:	0f 45 c2             	cmovne %edx,%eax
+  8028d5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8028d9:	83 e0 01             	and    $0x1,%eax
+  8028dc:	09 fa                	or     %edi,%edx
+  8028de:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8028e2:	89 04 24             	mov    %eax,(%esp)
+  8028e5:	8b 04 24             	mov    (%esp),%eax
+  8028e8:	89 d5                	mov    %edx,%ebp
+  8028ea:	09 f0                	or     %esi,%eax
+  8028ec:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8028f0:	39 f0                	cmp    %esi,%eax
+  8028f2:	19 fd                	sbb    %edi,%ebp
+  8028f4:	72 1d                	jb     802913 <__udivmoddi4+0xb3>
+  8028f6:	29 f0                	sub    %esi,%eax
+  8028f8:	19 fa                	sbb    %edi,%edx
+  8028fa:	89 cf                	mov    %ecx,%edi
+  8028fc:	c1 ef 05             	shr    $0x5,%edi
+  8028ff:	83 e7 01             	and    $0x1,%edi
+  802902:	89 fe                	mov    %edi,%esi
+  802904:	d3 e7                	shl    %cl,%edi
+  802906:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80290a:	83 f6 01             	xor    $0x1,%esi
+  80290d:	d3 e6                	shl    %cl,%esi
+  80290f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802913:	83 e9 01             	sub    $0x1,%ecx
+  802916:	73 98                	jae    8028b0 <__udivmoddi4+0x50>
+  802918:	85 db                	test   %ebx,%ebx
+  80291a:	74 05                	je     802921 <__udivmoddi4+0xc1>
+  80291c:	89 03                	mov    %eax,(%ebx)
+  80291e:	89 53 04             	mov    %edx,0x4(%ebx)
+  802921:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802925:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802929:	83 c4 24             	add    $0x24,%esp
+  80292c:	5b                   	pop    %ebx
+  80292d:	5e                   	pop    %esi
+  80292e:	5f                   	pop    %edi
+  80292f:	5d                   	pop    %ebp
+  802930:	c3                   	ret
+  802931:	85 ff                	test   %edi,%edi
+  802933:	74 0d                	je     802942 <__udivmoddi4+0xe2>
+  802935:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  80293b:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  802942:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802946:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80294a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80294e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802952:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802956:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80295a:	83 c4 24             	add    $0x24,%esp
+  80295d:	5b                   	pop    %ebx
+  80295e:	5e                   	pop    %esi
+  80295f:	5f                   	pop    %edi
+  802960:	5d                   	pop    %ebp
+  802961:	c3                   	ret
+  802962:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802969:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00802970 <__udivdi3>:
+  802970:	57                   	push   %edi
+  802971:	56                   	push   %esi
+  802972:	53                   	push   %ebx
+  802973:	83 ec 20             	sub    $0x20,%esp
+  802976:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80297a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80297e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802982:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802986:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80298a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80298e:	89 d1                	mov    %edx,%ecx
+  802990:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802994:	09 c1                	or     %eax,%ecx
+  802996:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80299a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80299e:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  8029a2:	0f 84 88 00 00 00    	je     802a30 <__udivdi3+0xc0>
+  8029a8:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8029af:	00 
+  8029b0:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8029b5:	31 c0                	xor    %eax,%eax
+  8029b7:	31 d2                	xor    %edx,%edx
+  8029b9:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8029c0:	00 
+  8029c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8029c8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8029cc:	01 c0                	add    %eax,%eax
+  8029ce:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8029d5:	00 
+  8029d6:	89 c6                	mov    %eax,%esi
+  8029d8:	89 d7                	mov    %edx,%edi
+  8029da:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8029de:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8029e2:	0f ad d0             	shrd   %cl,%edx,%eax
+  8029e5:	d3 ea                	shr    %cl,%edx
+  8029e7:	f6 c1 20             	test   $0x20,%cl
+  8029ea:	0f 45 c2             	cmovne %edx,%eax
+  8029ed:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8029f1:	83 e0 01             	and    $0x1,%eax
+  8029f4:	09 fa                	or     %edi,%edx
+  8029f6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8029fa:	89 04 24             	mov    %eax,(%esp)
+  8029fd:	8b 04 24             	mov    (%esp),%eax
+  802a00:	89 d3                	mov    %edx,%ebx
+  802a02:	09 f0                	or     %esi,%eax
+  802a04:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802a08:	39 f0                	cmp    %esi,%eax
+  802a0a:	19 fb                	sbb    %edi,%ebx
+  802a0c:	72 1d                	jb     802a2b <__udivdi3+0xbb>
+  802a0e:	29 f0                	sub    %esi,%eax
+  802a10:	19 fa                	sbb    %edi,%edx
+  802a12:	89 cf                	mov    %ecx,%edi
+  802a14:	c1 ef 05             	shr    $0x5,%edi
+  802a17:	83 e7 01             	and    $0x1,%edi
+  802a1a:	89 fe                	mov    %edi,%esi
+  802a1c:	d3 e7                	shl    %cl,%edi
+  802a1e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802a22:	83 f6 01             	xor    $0x1,%esi
+  802a25:	d3 e6                	shl    %cl,%esi
+  802a27:	09 74 24 18          	or     %esi,0x18(%esp)
+  802a2b:	83 e9 01             	sub    $0x1,%ecx
+  802a2e:	73 98                	jae    8029c8 <__udivdi3+0x58>
+  802a30:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802a34:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802a38:	83 c4 20             	add    $0x20,%esp
+  802a3b:	5b                   	pop    %ebx
+  802a3c:	5e                   	pop    %esi
+  802a3d:	5f                   	pop    %edi
+  802a3e:	c3                   	ret
+  802a3f:	90                   	nop
+
+00802a40 <__umoddi3>:
+  802a40:	57                   	push   %edi
+  802a41:	56                   	push   %esi
+  802a42:	53                   	push   %ebx
+  802a43:	83 ec 18             	sub    $0x18,%esp
+  802a46:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802a4a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802a4e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802a52:	8b 54 24 34          	mov    0x34(%esp),%edx
+  802a56:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802a5a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  802a5e:	89 d1                	mov    %edx,%ecx
+  802a60:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802a64:	09 c1                	or     %eax,%ecx
+  802a66:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802a6a:	74 5b                	je     802ac7 <__umoddi3+0x87>
+  802a6c:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802a71:	31 c0                	xor    %eax,%eax
+  802a73:	31 d2                	xor    %edx,%edx
+  802a75:	8d 76 00             	lea    0x0(%esi),%esi
+  802a78:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802a7c:	01 c0                	add    %eax,%eax
+  802a7e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802a85:	00 
+  802a86:	89 c6                	mov    %eax,%esi
+  802a88:	89 d7                	mov    %edx,%edi
+  802a8a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802a8e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802a92:	0f ad d0             	shrd   %cl,%edx,%eax
+  802a95:	d3 ea                	shr    %cl,%edx
+  802a97:	f6 c1 20             	test   $0x20,%cl
+  802a9a:	0f 45 c2             	cmovne %edx,%eax
+  802a9d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802aa1:	83 e0 01             	and    $0x1,%eax
+  802aa4:	09 fa                	or     %edi,%edx
+  802aa6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802aaa:	89 04 24             	mov    %eax,(%esp)
+  802aad:	8b 04 24             	mov    (%esp),%eax
+  802ab0:	89 d3                	mov    %edx,%ebx
+  802ab2:	09 f0                	or     %esi,%eax
+  802ab4:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802ab8:	39 f0                	cmp    %esi,%eax
+  802aba:	19 fb                	sbb    %edi,%ebx
+  802abc:	72 04                	jb     802ac2 <__umoddi3+0x82>
+  802abe:	29 f0                	sub    %esi,%eax
+  802ac0:	19 fa                	sbb    %edi,%edx
+  802ac2:	83 e9 01             	sub    $0x1,%ecx
+  802ac5:	73 b1                	jae    802a78 <__umoddi3+0x38>
+  802ac7:	83 c4 18             	add    $0x18,%esp
+  802aca:	5b                   	pop    %ebx
+  802acb:	5e                   	pop    %esi
+  802acc:	5f                   	pop    %edi
+  802acd:	c3                   	ret
+  802ace:	66 90                	xchg   %ax,%ax
+
+00802ad0 <__divdi3>:
+  802ad0:	55                   	push   %ebp
+  802ad1:	57                   	push   %edi
+  802ad2:	56                   	push   %esi
+  802ad3:	53                   	push   %ebx
+  802ad4:	83 ec 24             	sub    $0x24,%esp
+  802ad7:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  802adb:	8b 74 24 44          	mov    0x44(%esp),%esi
+  802adf:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802ae3:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802ae7:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  802aeb:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802aef:	85 d2                	test   %edx,%edx
+  802af1:	0f 88 e0 00 00 00    	js     802bd7 <__divdi3+0x107>
+  802af7:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  802afb:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  802aff:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802b03:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802b07:	85 f6                	test   %esi,%esi
+  802b09:	78 16                	js     802b21 <__divdi3+0x51>
+  802b0b:	89 f1                	mov    %esi,%ecx
+  802b0d:	31 c0                	xor    %eax,%eax
+  802b0f:	31 d2                	xor    %edx,%edx
+  802b11:	09 d9                	or     %ebx,%ecx
+  802b13:	0f 85 f3 00 00 00    	jne    802c0c <__divdi3+0x13c>
+  802b19:	83 c4 24             	add    $0x24,%esp
+  802b1c:	5b                   	pop    %ebx
+  802b1d:	5e                   	pop    %esi
+  802b1e:	5f                   	pop    %edi
+  802b1f:	5d                   	pop    %ebp
+  802b20:	c3                   	ret
+  802b21:	bf 01 00 00 00       	mov    $0x1,%edi
+  802b26:	f7 5c 24 08          	negl   0x8(%esp)
+  802b2a:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  802b2f:	f7 5c 24 0c          	negl   0xc(%esp)
+  802b33:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802b3a:	00 
+  802b3b:	31 c0                	xor    %eax,%eax
+  802b3d:	31 d2                	xor    %edx,%edx
+  802b3f:	89 fb                	mov    %edi,%ebx
+  802b41:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802b48:	00 
+  802b49:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802b4e:	66 90                	xchg   %ax,%ax
+  802b50:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802b54:	01 c0                	add    %eax,%eax
+  802b56:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802b5d:	00 
+  802b5e:	89 c6                	mov    %eax,%esi
+  802b60:	89 d7                	mov    %edx,%edi
+  802b62:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802b66:	8b 54 24 14          	mov    0x14(%esp),%edx
+  802b6a:	0f ad d0             	shrd   %cl,%edx,%eax
+  802b6d:	d3 ea                	shr    %cl,%edx
+  802b6f:	f6 c1 20             	test   $0x20,%cl
+  802b72:	0f 45 c2             	cmovne %edx,%eax
+  802b75:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802b79:	83 e0 01             	and    $0x1,%eax
+  802b7c:	09 fa                	or     %edi,%edx
+  802b7e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802b82:	89 04 24             	mov    %eax,(%esp)
+  802b85:	8b 04 24             	mov    (%esp),%eax
+  802b88:	89 d5                	mov    %edx,%ebp
+  802b8a:	09 f0                	or     %esi,%eax
+  802b8c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802b90:	39 f0                	cmp    %esi,%eax
+  802b92:	19 fd                	sbb    %edi,%ebp
+  802b94:	72 1d                	jb     802bb3 <__divdi3+0xe3>
+  802b96:	29 f0                	sub    %esi,%eax
+  802b98:	19 fa                	sbb    %edi,%edx
+  802b9a:	89 cf                	mov    %ecx,%edi
+  802b9c:	c1 ef 05             	shr    $0x5,%edi
+  802b9f:	83 e7 01             	and    $0x1,%edi
+  802ba2:	89 fe                	mov    %edi,%esi
+  802ba4:	d3 e7                	shl    %cl,%edi
+  802ba6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802baa:	83 f6 01             	xor    $0x1,%esi
+  802bad:	d3 e6                	shl    %cl,%esi
+  802baf:	09 74 24 18          	or     %esi,0x18(%esp)
+  802bb3:	83 e9 01             	sub    $0x1,%ecx
+  802bb6:	73 98                	jae    802b50 <__divdi3+0x80>
+  802bb8:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802bbc:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802bc0:	85 db                	test   %ebx,%ebx
+  802bc2:	0f 84 51 ff ff ff    	je     802b19 <__divdi3+0x49>
+  802bc8:	f7 d8                	neg    %eax
+  802bca:	83 d2 00             	adc    $0x0,%edx
+  802bcd:	83 c4 24             	add    $0x24,%esp
+  802bd0:	5b                   	pop    %ebx
+  802bd1:	f7 da                	neg    %edx
+  802bd3:	5e                   	pop    %esi
+  802bd4:	5f                   	pop    %edi
+  802bd5:	5d                   	pop    %ebp
+  802bd6:	c3                   	ret
+  802bd7:	f7 d8                	neg    %eax
+  802bd9:	83 d2 00             	adc    $0x0,%edx
+  802bdc:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802be0:	f7 da                	neg    %edx
+  802be2:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802be6:	85 f6                	test   %esi,%esi
+  802be8:	78 1b                	js     802c05 <__divdi3+0x135>
+  802bea:	89 f1                	mov    %esi,%ecx
+  802bec:	31 c0                	xor    %eax,%eax
+  802bee:	31 d2                	xor    %edx,%edx
+  802bf0:	bf 01 00 00 00       	mov    $0x1,%edi
+  802bf5:	09 d9                	or     %ebx,%ecx
+  802bf7:	0f 85 36 ff ff ff    	jne    802b33 <__divdi3+0x63>
+  802bfd:	83 c4 24             	add    $0x24,%esp
+  802c00:	5b                   	pop    %ebx
+  802c01:	5e                   	pop    %esi
+  802c02:	5f                   	pop    %edi
+  802c03:	5d                   	pop    %ebp
+  802c04:	c3                   	ret
+  802c05:	31 ff                	xor    %edi,%edi
+  802c07:	e9 1a ff ff ff       	jmp    802b26 <__divdi3+0x56>
+  802c0c:	31 ff                	xor    %edi,%edi
+  802c0e:	e9 20 ff ff ff       	jmp    802b33 <__divdi3+0x63>
+  802c13:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802c1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00802c20 <__moddi3>:
+  802c20:	55                   	push   %ebp
+  802c21:	57                   	push   %edi
+  802c22:	56                   	push   %esi
+  802c23:	53                   	push   %ebx
+  802c24:	83 ec 1c             	sub    $0x1c,%esp
+  802c27:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  802c2b:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  802c2f:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  802c33:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  802c37:	89 c8                	mov    %ecx,%eax
+  802c39:	89 f2                	mov    %esi,%edx
+  802c3b:	89 f3                	mov    %esi,%ebx
+  802c3d:	85 ed                	test   %ebp,%ebp
+  802c3f:	0f 88 9d 00 00 00    	js     802ce2 <__moddi3+0xc2>
+  802c45:	09 cb                	or     %ecx,%ebx
+  802c47:	0f 84 8d 00 00 00    	je     802cda <__moddi3+0xba>
+  802c4d:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802c51:	31 db                	xor    %ebx,%ebx
+  802c53:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802c57:	89 ca                	mov    %ecx,%edx
+  802c59:	89 f0                	mov    %esi,%eax
+  802c5b:	89 dd                	mov    %ebx,%ebp
+  802c5d:	f7 da                	neg    %edx
+  802c5f:	83 d0 00             	adc    $0x0,%eax
+  802c62:	f7 d8                	neg    %eax
+  802c64:	0f 49 f0             	cmovns %eax,%esi
+  802c67:	0f 49 ca             	cmovns %edx,%ecx
+  802c6a:	31 c0                	xor    %eax,%eax
+  802c6c:	31 d2                	xor    %edx,%edx
+  802c6e:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802c72:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802c76:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802c7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  802c7f:	90                   	nop
+  802c80:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802c84:	01 c0                	add    %eax,%eax
+  802c86:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802c8d:	00 
+  802c8e:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  802c92:	89 c6                	mov    %eax,%esi
+  802c94:	89 d7                	mov    %edx,%edi
+  802c96:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802c9a:	8b 54 24 14          	mov    0x14(%esp),%edx
+  802c9e:	0f ad d0             	shrd   %cl,%edx,%eax
+  802ca1:	d3 ea                	shr    %cl,%edx
+  802ca3:	f6 c1 20             	test   $0x20,%cl
+  802ca6:	0f 45 c2             	cmovne %edx,%eax
+  802ca9:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802cad:	83 e0 01             	and    $0x1,%eax
+  802cb0:	09 fa                	or     %edi,%edx
+  802cb2:	89 04 24             	mov    %eax,(%esp)
+  802cb5:	8b 04 24             	mov    (%esp),%eax
+  802cb8:	89 d7                	mov    %edx,%edi
+  802cba:	09 f0                	or     %esi,%eax
+  802cbc:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  802cc0:	39 d8                	cmp    %ebx,%eax
+  802cc2:	19 f7                	sbb    %esi,%edi
+  802cc4:	72 04                	jb     802cca <__moddi3+0xaa>
+  802cc6:	29 d8                	sub    %ebx,%eax
+  802cc8:	19 f2                	sbb    %esi,%edx
+  802cca:	83 e9 01             	sub    $0x1,%ecx
+  802ccd:	73 b1                	jae    802c80 <__moddi3+0x60>
+  802ccf:	85 ed                	test   %ebp,%ebp
+  802cd1:	74 07                	je     802cda <__moddi3+0xba>
+  802cd3:	f7 d8                	neg    %eax
+  802cd5:	83 d2 00             	adc    $0x0,%edx
+  802cd8:	f7 da                	neg    %edx
+  802cda:	83 c4 1c             	add    $0x1c,%esp
+  802cdd:	5b                   	pop    %ebx
+  802cde:	5e                   	pop    %esi
+  802cdf:	5f                   	pop    %edi
+  802ce0:	5d                   	pop    %ebp
+  802ce1:	c3                   	ret
+  802ce2:	09 cb                	or     %ecx,%ebx
+  802ce4:	74 f4                	je     802cda <__moddi3+0xba>
+  802ce6:	f7 df                	neg    %edi
+  802ce8:	bb 01 00 00 00       	mov    $0x1,%ebx
+  802ced:	83 d5 00             	adc    $0x0,%ebp
+  802cf0:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802cf4:	f7 dd                	neg    %ebp
+  802cf6:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802cfa:	e9 58 ff ff ff       	jmp    802c57 <__moddi3+0x37>
@@ -0,0 +1,6119 @@
+
+obj/user/kpti.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 ff 03 00 00       	call   800430 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+        wait(child);
+    }
+}
+
+void
+umain(int argc, char **argv) {
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 1c             	sub    $0x1c,%esp
+    envid_t child;
+    child = fork();
+  80003c:	e8 a0 12 00 00       	call   8012e1 <fork>
+
+    if (child == 0) {
+  800041:	85 c0                	test   %eax,%eax
+  800043:	0f 84 6c 01 00 00    	je     8001b5 <s_in_text+0x155>
+        sys_env_set_pgfault_upcall(0, NULL);
+        cprintf("%x\n", *(volatile uint8_t *) 0xf0000000);
+        return;
+    }
+    wait(child);
+  800049:	83 ec 0c             	sub    $0xc,%esp
+  80004c:	50                   	push   %eax
+  80004d:	e8 4f 25 00 00       	call   8025a1 <wait>
+
+    cprintf("kernel space isolated\n");
+  800052:	c7 04 24 e4 2c 80 00 	movl   $0x802ce4,(%esp)
+  800059:	e8 10 05 00 00       	call   80056e <cprintf>
+    asm volatile(
+  80005e:	eb 10                	jmp    800070 <s_in_text+0x10>
+
+00800060 <s_in_text>:
+  800060:	73 74                	jae    8000d6 <s_in_text+0x76>
+  800062:	72 69                	jb     8000cd <s_in_text+0x6d>
+  800064:	6e                   	outsb  %ds:(%esi),(%dx)
+  800065:	67 20 69 6e          	and    %ch,0x6e(%bx,%di)
+  800069:	20 2e                	and    %ch,(%esi)
+  80006b:	74 65                	je     8000d2 <s_in_text+0x72>
+  80006d:	78 74                	js     8000e3 <s_in_text+0x83>
+  80006f:	00 83 c4 08 68 60    	add    %al,0x606808c4(%ebx)
+    cprintf("%s\n", s_in_text);
+  800075:	00 80 00 68 fb 2c    	add    %al,0x2cfb6800(%eax)
+  80007b:	80 00 e8             	addb   $0xe8,(%eax)
+  80007e:	ec                   	in     (%dx),%al
+  80007f:	04 00                	add    $0x0,%al
+  800081:	00 83 c4 08 68 ff    	add    %al,-0x97f73c(%ebx)
+    cprintf("%s\n", "string in .rodata");
+  800087:	2c 80                	sub    $0x80,%al
+  800089:	00 68 fb             	add    %ch,-0x5(%eax)
+  80008c:	2c 80                	sub    $0x80,%al
+  80008e:	00 e8                	add    %ch,%al
+  800090:	da 04 00             	fiaddl (%eax,%eax,1)
+  800093:	00 83 c4 08 68 18    	add    %al,0x186808c4(%ebx)
+    cprintf("%s\n", s_in_data);
+  800099:	50                   	push   %eax
+  80009a:	80 00 68             	addb   $0x68,(%eax)
+  80009d:	fb                   	sti
+  80009e:	2c 80                	sub    $0x80,%al
+  8000a0:	00 e8                	add    %ch,%al
+  8000a2:	c8 04 00 00          	enter  $0x4,$0x0
+    assert(sys_page_alloc(0, UTEMP, PTE_W | PTE_P | PTE_U) == 0);
+  8000a6:	83 c4 0c             	add    $0xc,%esp
+  8000a9:	6a 07                	push   $0x7
+  8000ab:	68 00 00 40 00       	push   $0x400000
+  8000b0:	6a 00                	push   $0x0
+  8000b2:	e8 5c 0e 00 00       	call   800f13 <sys_page_alloc>
+  8000b7:	83 c4 10             	add    $0x10,%esp
+  8000ba:	85 c0                	test   %eax,%eax
+  8000bc:	0f 85 1f 01 00 00    	jne    8001e1 <s_in_text+0x181>
+    strcpy(s_in_page_alloc, "string in page alloc");
+  8000c2:	83 ec 08             	sub    $0x8,%esp
+  8000c5:	68 32 2d 80 00       	push   $0x802d32
+  8000ca:	68 00 00 40 00       	push   $0x400000
+  8000cf:	e8 53 0a 00 00       	call   800b27 <strcpy>
+    cprintf("%s\n", s_in_page_alloc);
+  8000d4:	83 c4 08             	add    $0x8,%esp
+  8000d7:	68 00 00 40 00       	push   $0x400000
+  8000dc:	68 fb 2c 80 00       	push   $0x802cfb
+  8000e1:	e8 88 04 00 00       	call   80056e <cprintf>
+    assert(sys_page_unmap(0, UTEMP) == 0);
+  8000e6:	83 c4 08             	add    $0x8,%esp
+  8000e9:	68 00 00 40 00       	push   $0x400000
+  8000ee:	6a 00                	push   $0x0
+  8000f0:	e8 a3 0e 00 00       	call   800f98 <sys_page_unmap>
+  8000f5:	83 c4 10             	add    $0x10,%esp
+  8000f8:	85 c0                	test   %eax,%eax
+  8000fa:	0f 85 f7 00 00 00    	jne    8001f7 <s_in_text+0x197>
+    assert(sys_page_map(0, s_in_page_map, 0, UTEMP, PTE_U | PTE_P) == 0);
+  800100:	83 ec 0c             	sub    $0xc,%esp
+  800103:	6a 05                	push   $0x5
+  800105:	68 00 00 40 00       	push   $0x400000
+  80010a:	6a 00                	push   $0x0
+  80010c:	68 00 50 80 00       	push   $0x805000
+  800111:	6a 00                	push   $0x0
+  800113:	e8 3e 0e 00 00       	call   800f56 <sys_page_map>
+  800118:	83 c4 20             	add    $0x20,%esp
+  80011b:	85 c0                	test   %eax,%eax
+  80011d:	0f 85 ea 00 00 00    	jne    80020d <s_in_text+0x1ad>
+    cprintf("%s\n", UTEMP);
+  800123:	83 ec 08             	sub    $0x8,%esp
+  800126:	68 00 00 40 00       	push   $0x400000
+  80012b:	68 fb 2c 80 00       	push   $0x802cfb
+  800130:	e8 39 04 00 00       	call   80056e <cprintf>
+    child = fork();
+  800135:	e8 a7 11 00 00       	call   8012e1 <fork>
+  80013a:	89 c3                	mov    %eax,%ebx
+    assert(child >= 0);
+  80013c:	83 c4 10             	add    $0x10,%esp
+  80013f:	85 c0                	test   %eax,%eax
+  800141:	0f 88 dc 00 00 00    	js     800223 <s_in_text+0x1c3>
+    if (child == 0) {
+  800147:	75 39                	jne    800182 <s_in_text+0x122>
+        assert(ipc_recv(NULL, UTEMP, NULL) == 1234);
+  800149:	83 ec 04             	sub    $0x4,%esp
+  80014c:	6a 00                	push   $0x0
+  80014e:	68 00 00 40 00       	push   $0x400000
+  800153:	6a 00                	push   $0x0
+  800155:	e8 a3 13 00 00       	call   8014fd <ipc_recv>
+  80015a:	83 c4 10             	add    $0x10,%esp
+  80015d:	3d d2 04 00 00       	cmp    $0x4d2,%eax
+  800162:	0f 85 d1 00 00 00    	jne    800239 <s_in_text+0x1d9>
+        cprintf("%s\n", UTEMP);
+  800168:	83 ec 08             	sub    $0x8,%esp
+  80016b:	68 00 00 40 00       	push   $0x400000
+  800170:	68 fb 2c 80 00       	push   $0x802cfb
+  800175:	e8 f4 03 00 00       	call   80056e <cprintf>
+        exit();
+  80017a:	e8 fa 02 00 00       	call   800479 <exit>
+  80017f:	83 c4 10             	add    $0x10,%esp
+    ipc_send(child, 1234, s_in_ipc_recv, PTE_U | PTE_P);
+  800182:	6a 05                	push   $0x5
+  800184:	68 00 40 80 00       	push   $0x804000
+  800189:	68 d2 04 00 00       	push   $0x4d2
+  80018e:	53                   	push   %ebx
+  80018f:	e8 dd 13 00 00       	call   801571 <ipc_send>
+    wait(child);
+  800194:	89 1c 24             	mov    %ebx,(%esp)
+  800197:	e8 05 24 00 00       	call   8025a1 <wait>
+    check_consistent();
+    cprintf("consistent env_kern_pgdir\n");
+  80019c:	c7 04 24 70 2d 80 00 	movl   $0x802d70,(%esp)
+  8001a3:	e8 c6 03 00 00       	call   80056e <cprintf>
+  8001a8:	83 c4 10             	add    $0x10,%esp
+    for (uintptr_t va = PTSIZE * 4;; va += PGSIZE) {
+  8001ab:	be 00 00 00 01       	mov    $0x1000000,%esi
+  8001b0:	e9 a0 00 00 00       	jmp    800255 <s_in_text+0x1f5>
+        sys_env_set_pgfault_upcall(0, NULL);
+  8001b5:	83 ec 08             	sub    $0x8,%esp
+  8001b8:	6a 00                	push   $0x0
+  8001ba:	6a 00                	push   $0x0
+  8001bc:	e8 9d 0e 00 00       	call   80105e <sys_env_set_pgfault_upcall>
+        cprintf("%x\n", *(volatile uint8_t *) 0xf0000000);
+  8001c1:	0f b6 05 00 00 00 f0 	movzbl 0xf0000000,%eax
+  8001c8:	83 c4 08             	add    $0x8,%esp
+  8001cb:	0f b6 c0             	movzbl %al,%eax
+  8001ce:	50                   	push   %eax
+  8001cf:	68 e0 2c 80 00       	push   $0x802ce0
+  8001d4:	e8 95 03 00 00       	call   80056e <cprintf>
+        return;
+  8001d9:	83 c4 10             	add    $0x10,%esp
+  8001dc:	e9 47 02 00 00       	jmp    800428 <s_in_text+0x3c8>
+    assert(sys_page_alloc(0, UTEMP, PTE_W | PTE_P | PTE_U) == 0);
+  8001e1:	68 9c 2d 80 00       	push   $0x802d9c
+  8001e6:	68 11 2d 80 00       	push   $0x802d11
+  8001eb:	6a 23                	push   $0x23
+  8001ed:	68 26 2d 80 00       	push   $0x802d26
+  8001f2:	e8 9c 02 00 00       	call   800493 <_panic>
+    assert(sys_page_unmap(0, UTEMP) == 0);
+  8001f7:	68 47 2d 80 00       	push   $0x802d47
+  8001fc:	68 11 2d 80 00       	push   $0x802d11
+  800201:	6a 27                	push   $0x27
+  800203:	68 26 2d 80 00       	push   $0x802d26
+  800208:	e8 86 02 00 00       	call   800493 <_panic>
+    assert(sys_page_map(0, s_in_page_map, 0, UTEMP, PTE_U | PTE_P) == 0);
+  80020d:	68 d4 2d 80 00       	push   $0x802dd4
+  800212:	68 11 2d 80 00       	push   $0x802d11
+  800217:	6a 28                	push   $0x28
+  800219:	68 26 2d 80 00       	push   $0x802d26
+  80021e:	e8 70 02 00 00       	call   800493 <_panic>
+    assert(child >= 0);
+  800223:	68 65 2d 80 00       	push   $0x802d65
+  800228:	68 11 2d 80 00       	push   $0x802d11
+  80022d:	6a 2c                	push   $0x2c
+  80022f:	68 26 2d 80 00       	push   $0x802d26
+  800234:	e8 5a 02 00 00       	call   800493 <_panic>
+        assert(ipc_recv(NULL, UTEMP, NULL) == 1234);
+  800239:	68 14 2e 80 00       	push   $0x802e14
+  80023e:	68 11 2d 80 00       	push   $0x802d11
+  800243:	6a 2e                	push   $0x2e
+  800245:	68 26 2d 80 00       	push   $0x802d26
+  80024a:	e8 44 02 00 00       	call   800493 <_panic>
+    for (uintptr_t va = PTSIZE * 4;; va += PGSIZE) {
+  80024f:	81 c6 00 10 00 00    	add    $0x1000,%esi
+        if (sys_page_alloc(0, (void *) va, PTE_U | PTE_P) == -E_NO_MEM) {
+  800255:	83 ec 04             	sub    $0x4,%esp
+  800258:	6a 05                	push   $0x5
+  80025a:	56                   	push   %esi
+  80025b:	6a 00                	push   $0x0
+  80025d:	e8 b1 0c 00 00       	call   800f13 <sys_page_alloc>
+  800262:	83 c4 10             	add    $0x10,%esp
+  800265:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  800268:	75 e5                	jne    80024f <s_in_text+0x1ef>
+    for (uintptr_t va = PTSIZE * 4; va < PTSIZE * 4 + 10 * PGSIZE; va += PGSIZE)
+  80026a:	bb 00 00 00 01       	mov    $0x1000000,%ebx
+        assert(sys_page_unmap(0, (void *) va) == 0);
+  80026f:	83 ec 08             	sub    $0x8,%esp
+  800272:	53                   	push   %ebx
+  800273:	6a 00                	push   $0x0
+  800275:	e8 1e 0d 00 00       	call   800f98 <sys_page_unmap>
+  80027a:	83 c4 10             	add    $0x10,%esp
+  80027d:	85 c0                	test   %eax,%eax
+  80027f:	75 46                	jne    8002c7 <s_in_text+0x267>
+    for (uintptr_t va = PTSIZE * 4; va < PTSIZE * 4 + 10 * PGSIZE; va += PGSIZE)
+  800281:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  800287:	81 fb 00 a0 00 01    	cmp    $0x100a000,%ebx
+  80028d:	75 e0                	jne    80026f <s_in_text+0x20f>
+  80028f:	bb e9 03 00 00       	mov    $0x3e9,%ebx
+    for (int i = 0; i < 1000; i++)
+  800294:	83 eb 01             	sub    $0x1,%ebx
+  800297:	74 44                	je     8002dd <s_in_text+0x27d>
+        assert(sys_page_alloc(0, (void *) (PTSIZE * 4), PTE_U | PTE_P) == 0);
+  800299:	83 ec 04             	sub    $0x4,%esp
+  80029c:	6a 05                	push   $0x5
+  80029e:	68 00 00 00 01       	push   $0x1000000
+  8002a3:	6a 00                	push   $0x0
+  8002a5:	e8 69 0c 00 00       	call   800f13 <sys_page_alloc>
+  8002aa:	83 c4 10             	add    $0x10,%esp
+  8002ad:	85 c0                	test   %eax,%eax
+  8002af:	74 e3                	je     800294 <s_in_text+0x234>
+  8002b1:	68 5c 2e 80 00       	push   $0x802e5c
+  8002b6:	68 11 2d 80 00       	push   $0x802d11
+  8002bb:	6a 42                	push   $0x42
+  8002bd:	68 26 2d 80 00       	push   $0x802d26
+  8002c2:	e8 cc 01 00 00       	call   800493 <_panic>
+        assert(sys_page_unmap(0, (void *) va) == 0);
+  8002c7:	68 38 2e 80 00       	push   $0x802e38
+  8002cc:	68 11 2d 80 00       	push   $0x802d11
+  8002d1:	6a 40                	push   $0x40
+  8002d3:	68 26 2d 80 00       	push   $0x802d26
+  8002d8:	e8 b6 01 00 00       	call   800493 <_panic>
+    for (uintptr_t va = PTSIZE * 4; va < end; va += PGSIZE)
+  8002dd:	bb 00 00 00 01       	mov    $0x1000000,%ebx
+  8002e2:	eb 06                	jmp    8002ea <s_in_text+0x28a>
+  8002e4:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8002ea:	39 f3                	cmp    %esi,%ebx
+  8002ec:	73 28                	jae    800316 <s_in_text+0x2b6>
+        assert(sys_page_unmap(0, (void *) va) == 0);
+  8002ee:	83 ec 08             	sub    $0x8,%esp
+  8002f1:	53                   	push   %ebx
+  8002f2:	6a 00                	push   $0x0
+  8002f4:	e8 9f 0c 00 00       	call   800f98 <sys_page_unmap>
+  8002f9:	83 c4 10             	add    $0x10,%esp
+  8002fc:	85 c0                	test   %eax,%eax
+  8002fe:	74 e4                	je     8002e4 <s_in_text+0x284>
+  800300:	68 38 2e 80 00       	push   $0x802e38
+  800305:	68 11 2d 80 00       	push   $0x802d11
+  80030a:	6a 44                	push   $0x44
+  80030c:	68 26 2d 80 00       	push   $0x802d26
+  800311:	e8 7d 01 00 00       	call   800493 <_panic>
+    for (uintptr_t va = PTSIZE * 4;; va += PGSIZE) {
+  800316:	be 00 00 00 01       	mov    $0x1000000,%esi
+  80031b:	eb 06                	jmp    800323 <s_in_text+0x2c3>
+  80031d:	81 c6 00 10 00 00    	add    $0x1000,%esi
+        if (sys_page_alloc(0, (void *) va, PTE_U | PTE_P) == -E_NO_MEM) {
+  800323:	83 ec 04             	sub    $0x4,%esp
+  800326:	6a 05                	push   $0x5
+  800328:	56                   	push   %esi
+  800329:	6a 00                	push   $0x0
+  80032b:	e8 e3 0b 00 00       	call   800f13 <sys_page_alloc>
+  800330:	83 c4 10             	add    $0x10,%esp
+  800333:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  800336:	75 e5                	jne    80031d <s_in_text+0x2bd>
+    assert(end - PTSIZE * 4 > PGSIZE * 20);
+  800338:	8d 86 00 00 00 ff    	lea    -0x1000000(%esi),%eax
+  80033e:	3d 00 40 01 00       	cmp    $0x14000,%eax
+  800343:	76 23                	jbe    800368 <s_in_text+0x308>
+    for (uintptr_t va = PTSIZE * 4; va < end; va += PGSIZE)
+  800345:	bb 00 00 00 01       	mov    $0x1000000,%ebx
+  80034a:	39 f3                	cmp    %esi,%ebx
+  80034c:	73 46                	jae    800394 <s_in_text+0x334>
+        assert(sys_page_unmap(0, (void *) va) == 0);
+  80034e:	83 ec 08             	sub    $0x8,%esp
+  800351:	53                   	push   %ebx
+  800352:	6a 00                	push   $0x0
+  800354:	e8 3f 0c 00 00       	call   800f98 <sys_page_unmap>
+  800359:	83 c4 10             	add    $0x10,%esp
+  80035c:	85 c0                	test   %eax,%eax
+  80035e:	75 1e                	jne    80037e <s_in_text+0x31e>
+    for (uintptr_t va = PTSIZE * 4; va < end; va += PGSIZE)
+  800360:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  800366:	eb e2                	jmp    80034a <s_in_text+0x2ea>
+    assert(end - PTSIZE * 4 > PGSIZE * 20);
+  800368:	68 9c 2e 80 00       	push   $0x802e9c
+  80036d:	68 11 2d 80 00       	push   $0x802d11
+  800372:	6a 50                	push   $0x50
+  800374:	68 26 2d 80 00       	push   $0x802d26
+  800379:	e8 15 01 00 00       	call   800493 <_panic>
+        assert(sys_page_unmap(0, (void *) va) == 0);
+  80037e:	68 38 2e 80 00       	push   $0x802e38
+  800383:	68 11 2d 80 00       	push   $0x802d11
+  800388:	6a 52                	push   $0x52
+  80038a:	68 26 2d 80 00       	push   $0x802d26
+  80038f:	e8 ff 00 00 00       	call   800493 <_panic>
+    end -= PGSIZE * 20;
+  800394:	81 ee 00 40 01 00    	sub    $0x14000,%esi
+    for (int i = 0; i < 20; i++) {
+  80039a:	c7 45 e4 15 00 00 00 	movl   $0x15,-0x1c(%ebp)
+  8003a1:	eb 3d                	jmp    8003e0 <s_in_text+0x380>
+        assert(child >= 0);
+  8003a3:	68 65 2d 80 00       	push   $0x802d65
+  8003a8:	68 11 2d 80 00       	push   $0x802d11
+  8003ad:	6a 57                	push   $0x57
+  8003af:	68 26 2d 80 00       	push   $0x802d26
+  8003b4:	e8 da 00 00 00       	call   800493 <_panic>
+                assert(sys_page_alloc(0, (void *) va, PTE_U | PTE_P) == 0);
+  8003b9:	68 bc 2e 80 00       	push   $0x802ebc
+  8003be:	68 11 2d 80 00       	push   $0x802d11
+  8003c3:	6a 5a                	push   $0x5a
+  8003c5:	68 26 2d 80 00       	push   $0x802d26
+  8003ca:	e8 c4 00 00 00       	call   800493 <_panic>
+            exit();
+  8003cf:	e8 a5 00 00 00       	call   800479 <exit>
+        wait(child);
+  8003d4:	83 ec 0c             	sub    $0xc,%esp
+  8003d7:	57                   	push   %edi
+  8003d8:	e8 c4 21 00 00       	call   8025a1 <wait>
+  8003dd:	83 c4 10             	add    $0x10,%esp
+    for (int i = 0; i < 20; i++) {
+  8003e0:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  8003e4:	74 32                	je     800418 <s_in_text+0x3b8>
+        child = fork();
+  8003e6:	e8 f6 0e 00 00       	call   8012e1 <fork>
+  8003eb:	89 c7                	mov    %eax,%edi
+        assert(child >= 0);
+  8003ed:	85 c0                	test   %eax,%eax
+  8003ef:	78 b2                	js     8003a3 <s_in_text+0x343>
+        if (child == 0) {
+  8003f1:	75 e1                	jne    8003d4 <s_in_text+0x374>
+            for (uintptr_t va = PTSIZE * 4; va < end; va += PGSIZE)
+  8003f3:	bb 00 00 00 01       	mov    $0x1000000,%ebx
+  8003f8:	39 f3                	cmp    %esi,%ebx
+  8003fa:	73 d3                	jae    8003cf <s_in_text+0x36f>
+                assert(sys_page_alloc(0, (void *) va, PTE_U | PTE_P) == 0);
+  8003fc:	83 ec 04             	sub    $0x4,%esp
+  8003ff:	6a 05                	push   $0x5
+  800401:	53                   	push   %ebx
+  800402:	6a 00                	push   $0x0
+  800404:	e8 0a 0b 00 00       	call   800f13 <sys_page_alloc>
+  800409:	83 c4 10             	add    $0x10,%esp
+  80040c:	85 c0                	test   %eax,%eax
+  80040e:	75 a9                	jne    8003b9 <s_in_text+0x359>
+            for (uintptr_t va = PTSIZE * 4; va < end; va += PGSIZE)
+  800410:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  800416:	eb e0                	jmp    8003f8 <s_in_text+0x398>
+    check_memory_leak();
+    check_memory_leak2();
+    cprintf("no memory leak\n");
+  800418:	83 ec 0c             	sub    $0xc,%esp
+  80041b:	68 8b 2d 80 00       	push   $0x802d8b
+  800420:	e8 49 01 00 00       	call   80056e <cprintf>
+  800425:	83 c4 10             	add    $0x10,%esp
+
+
+}
+  800428:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80042b:	5b                   	pop    %ebx
+  80042c:	5e                   	pop    %esi
+  80042d:	5f                   	pop    %edi
+  80042e:	5d                   	pop    %ebp
+  80042f:	c3                   	ret
+
+00800430 <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  800430:	55                   	push   %ebp
+  800431:	89 e5                	mov    %esp,%ebp
+  800433:	56                   	push   %esi
+  800434:	53                   	push   %ebx
+  800435:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800438:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  80043b:	e8 95 0a 00 00       	call   800ed5 <sys_getenvid>
+  800440:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800445:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800448:	c1 e0 04             	shl    $0x4,%eax
+  80044b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800450:	a3 08 60 80 00       	mov    %eax,0x806008
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800455:	85 db                	test   %ebx,%ebx
+  800457:	7e 07                	jle    800460 <libmain+0x30>
+    binaryname = argv[0];
+  800459:	8b 06                	mov    (%esi),%eax
+  80045b:	a3 28 50 80 00       	mov    %eax,0x805028
+
+  // call user main routine
+  umain(argc, argv);
+  800460:	83 ec 08             	sub    $0x8,%esp
+  800463:	56                   	push   %esi
+  800464:	53                   	push   %ebx
+  800465:	e8 c9 fb ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  80046a:	e8 0a 00 00 00       	call   800479 <exit>
+}
+  80046f:	83 c4 10             	add    $0x10,%esp
+  800472:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800475:	5b                   	pop    %ebx
+  800476:	5e                   	pop    %esi
+  800477:	5d                   	pop    %ebp
+  800478:	c3                   	ret
+
+00800479 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800479:	55                   	push   %ebp
+  80047a:	89 e5                	mov    %esp,%ebp
+  80047c:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80047f:	e8 54 13 00 00       	call   8017d8 <close_all>
+	sys_env_destroy(0);
+  800484:	83 ec 0c             	sub    $0xc,%esp
+  800487:	6a 00                	push   $0x0
+  800489:	e8 06 0a 00 00       	call   800e94 <sys_env_destroy>
+}
+  80048e:	83 c4 10             	add    $0x10,%esp
+  800491:	c9                   	leave
+  800492:	c3                   	ret
+
+00800493 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800493:	55                   	push   %ebp
+  800494:	89 e5                	mov    %esp,%ebp
+  800496:	56                   	push   %esi
+  800497:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800498:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80049b:	8b 35 28 50 80 00    	mov    0x805028,%esi
+  8004a1:	e8 2f 0a 00 00       	call   800ed5 <sys_getenvid>
+  8004a6:	83 ec 0c             	sub    $0xc,%esp
+  8004a9:	ff 75 0c             	push   0xc(%ebp)
+  8004ac:	ff 75 08             	push   0x8(%ebp)
+  8004af:	56                   	push   %esi
+  8004b0:	50                   	push   %eax
+  8004b1:	68 fc 2e 80 00       	push   $0x802efc
+  8004b6:	e8 b3 00 00 00       	call   80056e <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8004bb:	83 c4 18             	add    $0x18,%esp
+  8004be:	53                   	push   %ebx
+  8004bf:	ff 75 10             	push   0x10(%ebp)
+  8004c2:	e8 56 00 00 00       	call   80051d <vcprintf>
+	cprintf("\n");
+  8004c7:	c7 04 24 73 34 80 00 	movl   $0x803473,(%esp)
+  8004ce:	e8 9b 00 00 00       	call   80056e <cprintf>
+  8004d3:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8004d6:	cc                   	int3
+	while (1)
+  8004d7:	eb fd                	jmp    8004d6 <_panic+0x43>
+
+008004d9 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8004d9:	55                   	push   %ebp
+  8004da:	89 e5                	mov    %esp,%ebp
+  8004dc:	53                   	push   %ebx
+  8004dd:	83 ec 04             	sub    $0x4,%esp
+  8004e0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8004e3:	8b 13                	mov    (%ebx),%edx
+  8004e5:	8d 42 01             	lea    0x1(%edx),%eax
+  8004e8:	89 03                	mov    %eax,(%ebx)
+  8004ea:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8004ed:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8004f1:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8004f6:	74 09                	je     800501 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8004f8:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8004fc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8004ff:	c9                   	leave
+  800500:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800501:	83 ec 08             	sub    $0x8,%esp
+  800504:	68 ff 00 00 00       	push   $0xff
+  800509:	8d 43 08             	lea    0x8(%ebx),%eax
+  80050c:	50                   	push   %eax
+  80050d:	e8 45 09 00 00       	call   800e57 <sys_cputs>
+		b->idx = 0;
+  800512:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800518:	83 c4 10             	add    $0x10,%esp
+  80051b:	eb db                	jmp    8004f8 <putch+0x1f>
+
+0080051d <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80051d:	55                   	push   %ebp
+  80051e:	89 e5                	mov    %esp,%ebp
+  800520:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800526:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80052d:	00 00 00 
+	b.cnt = 0;
+  800530:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800537:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80053a:	ff 75 0c             	push   0xc(%ebp)
+  80053d:	ff 75 08             	push   0x8(%ebp)
+  800540:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800546:	50                   	push   %eax
+  800547:	68 d9 04 80 00       	push   $0x8004d9
+  80054c:	e8 14 01 00 00       	call   800665 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800551:	83 c4 08             	add    $0x8,%esp
+  800554:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80055a:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800560:	50                   	push   %eax
+  800561:	e8 f1 08 00 00       	call   800e57 <sys_cputs>
+
+	return b.cnt;
+}
+  800566:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80056c:	c9                   	leave
+  80056d:	c3                   	ret
+
+0080056e <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80056e:	55                   	push   %ebp
+  80056f:	89 e5                	mov    %esp,%ebp
+  800571:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800574:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800577:	50                   	push   %eax
+  800578:	ff 75 08             	push   0x8(%ebp)
+  80057b:	e8 9d ff ff ff       	call   80051d <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800580:	c9                   	leave
+  800581:	c3                   	ret
+
+00800582 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800582:	55                   	push   %ebp
+  800583:	89 e5                	mov    %esp,%ebp
+  800585:	57                   	push   %edi
+  800586:	56                   	push   %esi
+  800587:	53                   	push   %ebx
+  800588:	83 ec 1c             	sub    $0x1c,%esp
+  80058b:	89 c7                	mov    %eax,%edi
+  80058d:	89 d6                	mov    %edx,%esi
+  80058f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800592:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800595:	89 d1                	mov    %edx,%ecx
+  800597:	89 c2                	mov    %eax,%edx
+  800599:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80059c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80059f:	8b 45 10             	mov    0x10(%ebp),%eax
+  8005a2:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8005a5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005a8:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8005af:	39 c2                	cmp    %eax,%edx
+  8005b1:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8005b4:	72 3e                	jb     8005f4 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8005b6:	83 ec 0c             	sub    $0xc,%esp
+  8005b9:	ff 75 18             	push   0x18(%ebp)
+  8005bc:	83 eb 01             	sub    $0x1,%ebx
+  8005bf:	53                   	push   %ebx
+  8005c0:	50                   	push   %eax
+  8005c1:	83 ec 08             	sub    $0x8,%esp
+  8005c4:	ff 75 e4             	push   -0x1c(%ebp)
+  8005c7:	ff 75 e0             	push   -0x20(%ebp)
+  8005ca:	ff 75 dc             	push   -0x24(%ebp)
+  8005cd:	ff 75 d8             	push   -0x28(%ebp)
+  8005d0:	e8 7b 23 00 00       	call   802950 <__udivdi3>
+  8005d5:	83 c4 18             	add    $0x18,%esp
+  8005d8:	52                   	push   %edx
+  8005d9:	50                   	push   %eax
+  8005da:	89 f2                	mov    %esi,%edx
+  8005dc:	89 f8                	mov    %edi,%eax
+  8005de:	e8 9f ff ff ff       	call   800582 <printnum>
+  8005e3:	83 c4 20             	add    $0x20,%esp
+  8005e6:	eb 13                	jmp    8005fb <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8005e8:	83 ec 08             	sub    $0x8,%esp
+  8005eb:	56                   	push   %esi
+  8005ec:	ff 75 18             	push   0x18(%ebp)
+  8005ef:	ff d7                	call   *%edi
+  8005f1:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8005f4:	83 eb 01             	sub    $0x1,%ebx
+  8005f7:	85 db                	test   %ebx,%ebx
+  8005f9:	7f ed                	jg     8005e8 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8005fb:	83 ec 08             	sub    $0x8,%esp
+  8005fe:	56                   	push   %esi
+  8005ff:	83 ec 04             	sub    $0x4,%esp
+  800602:	ff 75 e4             	push   -0x1c(%ebp)
+  800605:	ff 75 e0             	push   -0x20(%ebp)
+  800608:	ff 75 dc             	push   -0x24(%ebp)
+  80060b:	ff 75 d8             	push   -0x28(%ebp)
+  80060e:	e8 0d 24 00 00       	call   802a20 <__umoddi3>
+  800613:	83 c4 14             	add    $0x14,%esp
+  800616:	0f be 80 1f 2f 80 00 	movsbl 0x802f1f(%eax),%eax
+  80061d:	50                   	push   %eax
+  80061e:	ff d7                	call   *%edi
+}
+  800620:	83 c4 10             	add    $0x10,%esp
+  800623:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800626:	5b                   	pop    %ebx
+  800627:	5e                   	pop    %esi
+  800628:	5f                   	pop    %edi
+  800629:	5d                   	pop    %ebp
+  80062a:	c3                   	ret
+
+0080062b <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80062b:	55                   	push   %ebp
+  80062c:	89 e5                	mov    %esp,%ebp
+  80062e:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800631:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800635:	8b 10                	mov    (%eax),%edx
+  800637:	3b 50 04             	cmp    0x4(%eax),%edx
+  80063a:	73 0a                	jae    800646 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80063c:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80063f:	89 08                	mov    %ecx,(%eax)
+  800641:	8b 45 08             	mov    0x8(%ebp),%eax
+  800644:	88 02                	mov    %al,(%edx)
+}
+  800646:	5d                   	pop    %ebp
+  800647:	c3                   	ret
+
+00800648 <printfmt>:
+{
+  800648:	55                   	push   %ebp
+  800649:	89 e5                	mov    %esp,%ebp
+  80064b:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80064e:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800651:	50                   	push   %eax
+  800652:	ff 75 10             	push   0x10(%ebp)
+  800655:	ff 75 0c             	push   0xc(%ebp)
+  800658:	ff 75 08             	push   0x8(%ebp)
+  80065b:	e8 05 00 00 00       	call   800665 <vprintfmt>
+}
+  800660:	83 c4 10             	add    $0x10,%esp
+  800663:	c9                   	leave
+  800664:	c3                   	ret
+
+00800665 <vprintfmt>:
+{
+  800665:	55                   	push   %ebp
+  800666:	89 e5                	mov    %esp,%ebp
+  800668:	57                   	push   %edi
+  800669:	56                   	push   %esi
+  80066a:	53                   	push   %ebx
+  80066b:	83 ec 2c             	sub    $0x2c,%esp
+  80066e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800671:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800674:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800677:	eb 0a                	jmp    800683 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800679:	83 ec 08             	sub    $0x8,%esp
+  80067c:	53                   	push   %ebx
+  80067d:	50                   	push   %eax
+  80067e:	ff d6                	call   *%esi
+  800680:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800683:	83 c7 01             	add    $0x1,%edi
+  800686:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80068a:	83 f8 25             	cmp    $0x25,%eax
+  80068d:	74 0c                	je     80069b <vprintfmt+0x36>
+			if (ch == '\0')
+  80068f:	85 c0                	test   %eax,%eax
+  800691:	75 e6                	jne    800679 <vprintfmt+0x14>
+}
+  800693:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800696:	5b                   	pop    %ebx
+  800697:	5e                   	pop    %esi
+  800698:	5f                   	pop    %edi
+  800699:	5d                   	pop    %ebp
+  80069a:	c3                   	ret
+		padc = ' ';
+  80069b:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80069f:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8006a6:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8006ad:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8006b4:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8006b9:	8d 47 01             	lea    0x1(%edi),%eax
+  8006bc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8006bf:	0f b6 17             	movzbl (%edi),%edx
+  8006c2:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8006c5:	3c 55                	cmp    $0x55,%al
+  8006c7:	0f 87 9a 03 00 00    	ja     800a67 <vprintfmt+0x402>
+  8006cd:	0f b6 c0             	movzbl %al,%eax
+  8006d0:	ff 24 85 60 30 80 00 	jmp    *0x803060(,%eax,4)
+  8006d7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8006da:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8006de:	eb d9                	jmp    8006b9 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8006e0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8006e3:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8006e7:	eb d0                	jmp    8006b9 <vprintfmt+0x54>
+  8006e9:	0f b6 d2             	movzbl %dl,%edx
+  8006ec:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8006ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006f4:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8006f7:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8006fa:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8006fe:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800701:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800704:	83 f9 09             	cmp    $0x9,%ecx
+  800707:	77 55                	ja     80075e <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800709:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  80070c:	eb e9                	jmp    8006f7 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  80070e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800711:	8b 00                	mov    (%eax),%eax
+  800713:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800716:	8b 45 14             	mov    0x14(%ebp),%eax
+  800719:	8d 40 04             	lea    0x4(%eax),%eax
+  80071c:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80071f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800722:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800726:	79 91                	jns    8006b9 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800728:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80072b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80072e:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800735:	eb 82                	jmp    8006b9 <vprintfmt+0x54>
+			if (width < 0)
+  800737:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80073a:	85 d2                	test   %edx,%edx
+  80073c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800741:	0f 49 c2             	cmovns %edx,%eax
+  800744:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800747:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80074a:	e9 6a ff ff ff       	jmp    8006b9 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80074f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800752:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800759:	e9 5b ff ff ff       	jmp    8006b9 <vprintfmt+0x54>
+  80075e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800761:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800764:	eb bc                	jmp    800722 <vprintfmt+0xbd>
+			lflag++;
+  800766:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800769:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80076c:	e9 48 ff ff ff       	jmp    8006b9 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800771:	8b 45 14             	mov    0x14(%ebp),%eax
+  800774:	8d 78 04             	lea    0x4(%eax),%edi
+  800777:	83 ec 08             	sub    $0x8,%esp
+  80077a:	53                   	push   %ebx
+  80077b:	ff 30                	push   (%eax)
+  80077d:	ff d6                	call   *%esi
+			break;
+  80077f:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800782:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800785:	e9 7c 02 00 00       	jmp    800a06 <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  80078a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80078d:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800790:	8b 10                	mov    (%eax),%edx
+  800792:	89 d0                	mov    %edx,%eax
+  800794:	f7 d8                	neg    %eax
+  800796:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800799:	83 f8 10             	cmp    $0x10,%eax
+  80079c:	7f 23                	jg     8007c1 <vprintfmt+0x15c>
+  80079e:	8b 14 85 c0 31 80 00 	mov    0x8031c0(,%eax,4),%edx
+  8007a5:	85 d2                	test   %edx,%edx
+  8007a7:	74 18                	je     8007c1 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8007a9:	52                   	push   %edx
+  8007aa:	68 23 2d 80 00       	push   $0x802d23
+  8007af:	53                   	push   %ebx
+  8007b0:	56                   	push   %esi
+  8007b1:	e8 92 fe ff ff       	call   800648 <printfmt>
+  8007b6:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8007b9:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8007bc:	e9 45 02 00 00       	jmp    800a06 <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  8007c1:	50                   	push   %eax
+  8007c2:	68 37 2f 80 00       	push   $0x802f37
+  8007c7:	53                   	push   %ebx
+  8007c8:	56                   	push   %esi
+  8007c9:	e8 7a fe ff ff       	call   800648 <printfmt>
+  8007ce:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8007d1:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8007d4:	e9 2d 02 00 00       	jmp    800a06 <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8007d9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007dc:	83 c0 04             	add    $0x4,%eax
+  8007df:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8007e2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e5:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8007e7:	85 c9                	test   %ecx,%ecx
+  8007e9:	b8 30 2f 80 00       	mov    $0x802f30,%eax
+  8007ee:	0f 45 c1             	cmovne %ecx,%eax
+  8007f1:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8007f4:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8007f8:	7e 06                	jle    800800 <vprintfmt+0x19b>
+  8007fa:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8007fe:	75 0b                	jne    80080b <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800800:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800803:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800806:	89 75 08             	mov    %esi,0x8(%ebp)
+  800809:	eb 5c                	jmp    800867 <vprintfmt+0x202>
+  80080b:	83 ec 08             	sub    $0x8,%esp
+  80080e:	ff 75 d0             	push   -0x30(%ebp)
+  800811:	ff 75 cc             	push   -0x34(%ebp)
+  800814:	e8 eb 02 00 00       	call   800b04 <strnlen>
+  800819:	89 c2                	mov    %eax,%edx
+  80081b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80081e:	29 d0                	sub    %edx,%eax
+  800820:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800823:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800827:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80082a:	89 75 08             	mov    %esi,0x8(%ebp)
+  80082d:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80082f:	eb 0e                	jmp    80083f <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800831:	83 ec 08             	sub    $0x8,%esp
+  800834:	53                   	push   %ebx
+  800835:	57                   	push   %edi
+  800836:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800839:	83 ee 01             	sub    $0x1,%esi
+  80083c:	83 c4 10             	add    $0x10,%esp
+  80083f:	85 f6                	test   %esi,%esi
+  800841:	7f ee                	jg     800831 <vprintfmt+0x1cc>
+  800843:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800846:	8b 75 08             	mov    0x8(%ebp),%esi
+  800849:	85 c0                	test   %eax,%eax
+  80084b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800850:	0f 49 d0             	cmovns %eax,%edx
+  800853:	29 d0                	sub    %edx,%eax
+  800855:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800858:	eb a6                	jmp    800800 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  80085a:	83 ec 08             	sub    $0x8,%esp
+  80085d:	53                   	push   %ebx
+  80085e:	52                   	push   %edx
+  80085f:	ff 55 08             	call   *0x8(%ebp)
+  800862:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800865:	89 f1                	mov    %esi,%ecx
+  800867:	8d 71 01             	lea    0x1(%ecx),%esi
+  80086a:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80086e:	0f be d0             	movsbl %al,%edx
+  800871:	85 d2                	test   %edx,%edx
+  800873:	74 28                	je     80089d <vprintfmt+0x238>
+  800875:	85 ff                	test   %edi,%edi
+  800877:	78 05                	js     80087e <vprintfmt+0x219>
+  800879:	83 ef 01             	sub    $0x1,%edi
+  80087c:	78 30                	js     8008ae <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80087e:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800882:	74 d6                	je     80085a <vprintfmt+0x1f5>
+  800884:	0f be c0             	movsbl %al,%eax
+  800887:	83 e8 20             	sub    $0x20,%eax
+  80088a:	83 f8 5e             	cmp    $0x5e,%eax
+  80088d:	76 cb                	jbe    80085a <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80088f:	83 ec 08             	sub    $0x8,%esp
+  800892:	53                   	push   %ebx
+  800893:	6a 3f                	push   $0x3f
+  800895:	ff 55 08             	call   *0x8(%ebp)
+  800898:	83 c4 10             	add    $0x10,%esp
+  80089b:	eb c8                	jmp    800865 <vprintfmt+0x200>
+  80089d:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008a0:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8008a3:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8008a6:	01 d0                	add    %edx,%eax
+  8008a8:	29 c8                	sub    %ecx,%eax
+  8008aa:	89 c7                	mov    %eax,%edi
+  8008ac:	eb 13                	jmp    8008c1 <vprintfmt+0x25c>
+  8008ae:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008b1:	eb ed                	jmp    8008a0 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8008b3:	83 ec 08             	sub    $0x8,%esp
+  8008b6:	53                   	push   %ebx
+  8008b7:	6a 20                	push   $0x20
+  8008b9:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8008bb:	83 ef 01             	sub    $0x1,%edi
+  8008be:	83 c4 10             	add    $0x10,%esp
+  8008c1:	85 ff                	test   %edi,%edi
+  8008c3:	7f ee                	jg     8008b3 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8008c5:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8008c8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008cb:	e9 36 01 00 00       	jmp    800a06 <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  8008d0:	83 f9 01             	cmp    $0x1,%ecx
+  8008d3:	7f 1f                	jg     8008f4 <vprintfmt+0x28f>
+	else if (lflag)
+  8008d5:	85 c9                	test   %ecx,%ecx
+  8008d7:	74 67                	je     800940 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8008d9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008dc:	8b 00                	mov    (%eax),%eax
+  8008de:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8008e1:	89 c1                	mov    %eax,%ecx
+  8008e3:	c1 f9 1f             	sar    $0x1f,%ecx
+  8008e6:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8008e9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ec:	8d 40 04             	lea    0x4(%eax),%eax
+  8008ef:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008f2:	eb 17                	jmp    80090b <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8008f4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008f7:	8b 50 04             	mov    0x4(%eax),%edx
+  8008fa:	8b 00                	mov    (%eax),%eax
+  8008fc:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8008ff:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800902:	8b 45 14             	mov    0x14(%ebp),%eax
+  800905:	8d 40 08             	lea    0x8(%eax),%eax
+  800908:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80090b:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80090e:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800911:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800916:	85 c9                	test   %ecx,%ecx
+  800918:	0f 89 ce 00 00 00    	jns    8009ec <vprintfmt+0x387>
+				putch('-', putdat);
+  80091e:	83 ec 08             	sub    $0x8,%esp
+  800921:	53                   	push   %ebx
+  800922:	6a 2d                	push   $0x2d
+  800924:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800926:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800929:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80092c:	f7 da                	neg    %edx
+  80092e:	83 d1 00             	adc    $0x0,%ecx
+  800931:	f7 d9                	neg    %ecx
+  800933:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800936:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80093b:	e9 ac 00 00 00       	jmp    8009ec <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  800940:	8b 45 14             	mov    0x14(%ebp),%eax
+  800943:	8b 00                	mov    (%eax),%eax
+  800945:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800948:	89 c1                	mov    %eax,%ecx
+  80094a:	c1 f9 1f             	sar    $0x1f,%ecx
+  80094d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800950:	8b 45 14             	mov    0x14(%ebp),%eax
+  800953:	8d 40 04             	lea    0x4(%eax),%eax
+  800956:	89 45 14             	mov    %eax,0x14(%ebp)
+  800959:	eb b0                	jmp    80090b <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  80095b:	83 f9 01             	cmp    $0x1,%ecx
+  80095e:	7f 1b                	jg     80097b <vprintfmt+0x316>
+	else if (lflag)
+  800960:	85 c9                	test   %ecx,%ecx
+  800962:	74 2c                	je     800990 <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  800964:	8b 45 14             	mov    0x14(%ebp),%eax
+  800967:	8b 10                	mov    (%eax),%edx
+  800969:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80096e:	8d 40 04             	lea    0x4(%eax),%eax
+  800971:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800974:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800979:	eb 71                	jmp    8009ec <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  80097b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80097e:	8b 10                	mov    (%eax),%edx
+  800980:	8b 48 04             	mov    0x4(%eax),%ecx
+  800983:	8d 40 08             	lea    0x8(%eax),%eax
+  800986:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800989:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80098e:	eb 5c                	jmp    8009ec <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  800990:	8b 45 14             	mov    0x14(%ebp),%eax
+  800993:	8b 10                	mov    (%eax),%edx
+  800995:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80099a:	8d 40 04             	lea    0x4(%eax),%eax
+  80099d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8009a0:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8009a5:	eb 45                	jmp    8009ec <vprintfmt+0x387>
+			putch('X', putdat);
+  8009a7:	83 ec 08             	sub    $0x8,%esp
+  8009aa:	53                   	push   %ebx
+  8009ab:	6a 58                	push   $0x58
+  8009ad:	ff d6                	call   *%esi
+			putch('X', putdat);
+  8009af:	83 c4 08             	add    $0x8,%esp
+  8009b2:	53                   	push   %ebx
+  8009b3:	6a 58                	push   $0x58
+  8009b5:	ff d6                	call   *%esi
+			putch('X', putdat);
+  8009b7:	83 c4 08             	add    $0x8,%esp
+  8009ba:	53                   	push   %ebx
+  8009bb:	6a 58                	push   $0x58
+  8009bd:	ff d6                	call   *%esi
+			break;
+  8009bf:	83 c4 10             	add    $0x10,%esp
+  8009c2:	eb 42                	jmp    800a06 <vprintfmt+0x3a1>
+			putch('0', putdat);
+  8009c4:	83 ec 08             	sub    $0x8,%esp
+  8009c7:	53                   	push   %ebx
+  8009c8:	6a 30                	push   $0x30
+  8009ca:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8009cc:	83 c4 08             	add    $0x8,%esp
+  8009cf:	53                   	push   %ebx
+  8009d0:	6a 78                	push   $0x78
+  8009d2:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8009d4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009d7:	8b 10                	mov    (%eax),%edx
+  8009d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8009de:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8009e1:	8d 40 04             	lea    0x4(%eax),%eax
+  8009e4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009e7:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8009ec:	83 ec 0c             	sub    $0xc,%esp
+  8009ef:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8009f3:	50                   	push   %eax
+  8009f4:	ff 75 e0             	push   -0x20(%ebp)
+  8009f7:	57                   	push   %edi
+  8009f8:	51                   	push   %ecx
+  8009f9:	52                   	push   %edx
+  8009fa:	89 da                	mov    %ebx,%edx
+  8009fc:	89 f0                	mov    %esi,%eax
+  8009fe:	e8 7f fb ff ff       	call   800582 <printnum>
+			break;
+  800a03:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800a06:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800a09:	e9 75 fc ff ff       	jmp    800683 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800a0e:	83 f9 01             	cmp    $0x1,%ecx
+  800a11:	7f 1b                	jg     800a2e <vprintfmt+0x3c9>
+	else if (lflag)
+  800a13:	85 c9                	test   %ecx,%ecx
+  800a15:	74 2c                	je     800a43 <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  800a17:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a1a:	8b 10                	mov    (%eax),%edx
+  800a1c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a21:	8d 40 04             	lea    0x4(%eax),%eax
+  800a24:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a27:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800a2c:	eb be                	jmp    8009ec <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  800a2e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a31:	8b 10                	mov    (%eax),%edx
+  800a33:	8b 48 04             	mov    0x4(%eax),%ecx
+  800a36:	8d 40 08             	lea    0x8(%eax),%eax
+  800a39:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a3c:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800a41:	eb a9                	jmp    8009ec <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  800a43:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a46:	8b 10                	mov    (%eax),%edx
+  800a48:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a4d:	8d 40 04             	lea    0x4(%eax),%eax
+  800a50:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a53:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800a58:	eb 92                	jmp    8009ec <vprintfmt+0x387>
+			putch(ch, putdat);
+  800a5a:	83 ec 08             	sub    $0x8,%esp
+  800a5d:	53                   	push   %ebx
+  800a5e:	6a 25                	push   $0x25
+  800a60:	ff d6                	call   *%esi
+			break;
+  800a62:	83 c4 10             	add    $0x10,%esp
+  800a65:	eb 9f                	jmp    800a06 <vprintfmt+0x3a1>
+			putch('%', putdat);
+  800a67:	83 ec 08             	sub    $0x8,%esp
+  800a6a:	53                   	push   %ebx
+  800a6b:	6a 25                	push   $0x25
+  800a6d:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800a6f:	83 c4 10             	add    $0x10,%esp
+  800a72:	89 f8                	mov    %edi,%eax
+  800a74:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800a78:	74 05                	je     800a7f <vprintfmt+0x41a>
+  800a7a:	83 e8 01             	sub    $0x1,%eax
+  800a7d:	eb f5                	jmp    800a74 <vprintfmt+0x40f>
+  800a7f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800a82:	eb 82                	jmp    800a06 <vprintfmt+0x3a1>
+
+00800a84 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800a84:	55                   	push   %ebp
+  800a85:	89 e5                	mov    %esp,%ebp
+  800a87:	83 ec 18             	sub    $0x18,%esp
+  800a8a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a8d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800a90:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800a93:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800a97:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800a9a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800aa1:	85 c0                	test   %eax,%eax
+  800aa3:	74 26                	je     800acb <vsnprintf+0x47>
+  800aa5:	85 d2                	test   %edx,%edx
+  800aa7:	7e 22                	jle    800acb <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800aa9:	ff 75 14             	push   0x14(%ebp)
+  800aac:	ff 75 10             	push   0x10(%ebp)
+  800aaf:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800ab2:	50                   	push   %eax
+  800ab3:	68 2b 06 80 00       	push   $0x80062b
+  800ab8:	e8 a8 fb ff ff       	call   800665 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800abd:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800ac0:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800ac3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ac6:	83 c4 10             	add    $0x10,%esp
+}
+  800ac9:	c9                   	leave
+  800aca:	c3                   	ret
+		return -E_INVAL;
+  800acb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ad0:	eb f7                	jmp    800ac9 <vsnprintf+0x45>
+
+00800ad2 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800ad2:	55                   	push   %ebp
+  800ad3:	89 e5                	mov    %esp,%ebp
+  800ad5:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800ad8:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800adb:	50                   	push   %eax
+  800adc:	ff 75 10             	push   0x10(%ebp)
+  800adf:	ff 75 0c             	push   0xc(%ebp)
+  800ae2:	ff 75 08             	push   0x8(%ebp)
+  800ae5:	e8 9a ff ff ff       	call   800a84 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800aea:	c9                   	leave
+  800aeb:	c3                   	ret
+
+00800aec <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800aec:	55                   	push   %ebp
+  800aed:	89 e5                	mov    %esp,%ebp
+  800aef:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800af2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800af7:	eb 03                	jmp    800afc <strlen+0x10>
+		n++;
+  800af9:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800afc:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800b00:	75 f7                	jne    800af9 <strlen+0xd>
+	return n;
+}
+  800b02:	5d                   	pop    %ebp
+  800b03:	c3                   	ret
+
+00800b04 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800b04:	55                   	push   %ebp
+  800b05:	89 e5                	mov    %esp,%ebp
+  800b07:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b0a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b0d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b12:	eb 03                	jmp    800b17 <strnlen+0x13>
+		n++;
+  800b14:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b17:	39 d0                	cmp    %edx,%eax
+  800b19:	74 08                	je     800b23 <strnlen+0x1f>
+  800b1b:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800b1f:	75 f3                	jne    800b14 <strnlen+0x10>
+  800b21:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800b23:	89 d0                	mov    %edx,%eax
+  800b25:	5d                   	pop    %ebp
+  800b26:	c3                   	ret
+
+00800b27 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800b27:	55                   	push   %ebp
+  800b28:	89 e5                	mov    %esp,%ebp
+  800b2a:	53                   	push   %ebx
+  800b2b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b2e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800b31:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b36:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800b3a:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800b3d:	83 c0 01             	add    $0x1,%eax
+  800b40:	84 d2                	test   %dl,%dl
+  800b42:	75 f2                	jne    800b36 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800b44:	89 c8                	mov    %ecx,%eax
+  800b46:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b49:	c9                   	leave
+  800b4a:	c3                   	ret
+
+00800b4b <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800b4b:	55                   	push   %ebp
+  800b4c:	89 e5                	mov    %esp,%ebp
+  800b4e:	53                   	push   %ebx
+  800b4f:	83 ec 10             	sub    $0x10,%esp
+  800b52:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800b55:	53                   	push   %ebx
+  800b56:	e8 91 ff ff ff       	call   800aec <strlen>
+  800b5b:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800b5e:	ff 75 0c             	push   0xc(%ebp)
+  800b61:	01 d8                	add    %ebx,%eax
+  800b63:	50                   	push   %eax
+  800b64:	e8 be ff ff ff       	call   800b27 <strcpy>
+	return dst;
+}
+  800b69:	89 d8                	mov    %ebx,%eax
+  800b6b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b6e:	c9                   	leave
+  800b6f:	c3                   	ret
+
+00800b70 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b70:	55                   	push   %ebp
+  800b71:	89 e5                	mov    %esp,%ebp
+  800b73:	56                   	push   %esi
+  800b74:	53                   	push   %ebx
+  800b75:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b78:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800b7b:	89 f3                	mov    %esi,%ebx
+  800b7d:	03 5d 10             	add    0x10(%ebp),%ebx
+  800b80:	89 f0                	mov    %esi,%eax
+  800b82:	eb 0f                	jmp    800b93 <strncpy+0x23>
+		*dst++ = *src;
+  800b84:	83 c0 01             	add    $0x1,%eax
+  800b87:	0f b6 0a             	movzbl (%edx),%ecx
+  800b8a:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800b8d:	80 f9 01             	cmp    $0x1,%cl
+  800b90:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800b93:	39 d8                	cmp    %ebx,%eax
+  800b95:	75 ed                	jne    800b84 <strncpy+0x14>
+	}
+	return ret;
+}
+  800b97:	89 f0                	mov    %esi,%eax
+  800b99:	5b                   	pop    %ebx
+  800b9a:	5e                   	pop    %esi
+  800b9b:	5d                   	pop    %ebp
+  800b9c:	c3                   	ret
+
+00800b9d <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800b9d:	55                   	push   %ebp
+  800b9e:	89 e5                	mov    %esp,%ebp
+  800ba0:	56                   	push   %esi
+  800ba1:	53                   	push   %ebx
+  800ba2:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ba5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ba8:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800bab:	89 f0                	mov    %esi,%eax
+  800bad:	85 d2                	test   %edx,%edx
+  800baf:	74 21                	je     800bd2 <strlcpy+0x35>
+  800bb1:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800bb5:	89 f2                	mov    %esi,%edx
+  800bb7:	eb 09                	jmp    800bc2 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800bb9:	83 c1 01             	add    $0x1,%ecx
+  800bbc:	83 c2 01             	add    $0x1,%edx
+  800bbf:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800bc2:	39 c2                	cmp    %eax,%edx
+  800bc4:	74 09                	je     800bcf <strlcpy+0x32>
+  800bc6:	0f b6 19             	movzbl (%ecx),%ebx
+  800bc9:	84 db                	test   %bl,%bl
+  800bcb:	75 ec                	jne    800bb9 <strlcpy+0x1c>
+  800bcd:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800bcf:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800bd2:	29 f0                	sub    %esi,%eax
+}
+  800bd4:	5b                   	pop    %ebx
+  800bd5:	5e                   	pop    %esi
+  800bd6:	5d                   	pop    %ebp
+  800bd7:	c3                   	ret
+
+00800bd8 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800bd8:	55                   	push   %ebp
+  800bd9:	89 e5                	mov    %esp,%ebp
+  800bdb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800bde:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800be1:	eb 06                	jmp    800be9 <strcmp+0x11>
+		p++, q++;
+  800be3:	83 c1 01             	add    $0x1,%ecx
+  800be6:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800be9:	0f b6 01             	movzbl (%ecx),%eax
+  800bec:	84 c0                	test   %al,%al
+  800bee:	74 04                	je     800bf4 <strcmp+0x1c>
+  800bf0:	3a 02                	cmp    (%edx),%al
+  800bf2:	74 ef                	je     800be3 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800bf4:	0f b6 c0             	movzbl %al,%eax
+  800bf7:	0f b6 12             	movzbl (%edx),%edx
+  800bfa:	29 d0                	sub    %edx,%eax
+}
+  800bfc:	5d                   	pop    %ebp
+  800bfd:	c3                   	ret
+
+00800bfe <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800bfe:	55                   	push   %ebp
+  800bff:	89 e5                	mov    %esp,%ebp
+  800c01:	53                   	push   %ebx
+  800c02:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c05:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c08:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800c0b:	eb 09                	jmp    800c16 <strncmp+0x18>
+		n--, p++, q++;
+  800c0d:	83 ea 01             	sub    $0x1,%edx
+  800c10:	83 c0 01             	add    $0x1,%eax
+  800c13:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800c16:	85 d2                	test   %edx,%edx
+  800c18:	74 18                	je     800c32 <strncmp+0x34>
+  800c1a:	0f b6 18             	movzbl (%eax),%ebx
+  800c1d:	84 db                	test   %bl,%bl
+  800c1f:	74 04                	je     800c25 <strncmp+0x27>
+  800c21:	3a 19                	cmp    (%ecx),%bl
+  800c23:	74 e8                	je     800c0d <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800c25:	0f b6 00             	movzbl (%eax),%eax
+  800c28:	0f b6 11             	movzbl (%ecx),%edx
+  800c2b:	29 d0                	sub    %edx,%eax
+}
+  800c2d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c30:	c9                   	leave
+  800c31:	c3                   	ret
+		return 0;
+  800c32:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c37:	eb f4                	jmp    800c2d <strncmp+0x2f>
+
+00800c39 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800c39:	55                   	push   %ebp
+  800c3a:	89 e5                	mov    %esp,%ebp
+  800c3c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c3f:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800c43:	eb 03                	jmp    800c48 <strchr+0xf>
+  800c45:	83 c0 01             	add    $0x1,%eax
+  800c48:	0f b6 10             	movzbl (%eax),%edx
+  800c4b:	84 d2                	test   %dl,%dl
+  800c4d:	74 06                	je     800c55 <strchr+0x1c>
+		if (*s == c)
+  800c4f:	38 ca                	cmp    %cl,%dl
+  800c51:	75 f2                	jne    800c45 <strchr+0xc>
+  800c53:	eb 05                	jmp    800c5a <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800c55:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c5a:	5d                   	pop    %ebp
+  800c5b:	c3                   	ret
+
+00800c5c <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800c5c:	55                   	push   %ebp
+  800c5d:	89 e5                	mov    %esp,%ebp
+  800c5f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c62:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800c66:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800c69:	38 ca                	cmp    %cl,%dl
+  800c6b:	74 09                	je     800c76 <strfind+0x1a>
+  800c6d:	84 d2                	test   %dl,%dl
+  800c6f:	74 05                	je     800c76 <strfind+0x1a>
+	for (; *s; s++)
+  800c71:	83 c0 01             	add    $0x1,%eax
+  800c74:	eb f0                	jmp    800c66 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800c76:	5d                   	pop    %ebp
+  800c77:	c3                   	ret
+
+00800c78 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800c78:	55                   	push   %ebp
+  800c79:	89 e5                	mov    %esp,%ebp
+  800c7b:	57                   	push   %edi
+  800c7c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800c7f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800c82:	85 c9                	test   %ecx,%ecx
+  800c84:	74 20                	je     800ca6 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800c86:	89 f8                	mov    %edi,%eax
+  800c88:	09 c8                	or     %ecx,%eax
+  800c8a:	a8 03                	test   $0x3,%al
+  800c8c:	75 12                	jne    800ca0 <memset+0x28>
+		c &= 0xFF;
+  800c8e:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800c92:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800c98:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800c9b:	fc                   	cld
+  800c9c:	f3 ab                	rep stos %eax,%es:(%edi)
+  800c9e:	eb 06                	jmp    800ca6 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800ca0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ca3:	fc                   	cld
+  800ca4:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800ca6:	89 f8                	mov    %edi,%eax
+  800ca8:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800cab:	c9                   	leave
+  800cac:	c3                   	ret
+
+00800cad <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800cad:	55                   	push   %ebp
+  800cae:	89 e5                	mov    %esp,%ebp
+  800cb0:	57                   	push   %edi
+  800cb1:	56                   	push   %esi
+  800cb2:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cb5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800cb8:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800cbb:	39 c6                	cmp    %eax,%esi
+  800cbd:	73 32                	jae    800cf1 <memmove+0x44>
+  800cbf:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800cc2:	39 d0                	cmp    %edx,%eax
+  800cc4:	73 2b                	jae    800cf1 <memmove+0x44>
+		s += n;
+		d += n;
+  800cc6:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800cc9:	89 d6                	mov    %edx,%esi
+  800ccb:	09 fe                	or     %edi,%esi
+  800ccd:	09 ce                	or     %ecx,%esi
+  800ccf:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800cd5:	75 0e                	jne    800ce5 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800cd7:	83 ef 04             	sub    $0x4,%edi
+  800cda:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800cdd:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800ce0:	fd                   	std
+  800ce1:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ce3:	eb 09                	jmp    800cee <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800ce5:	83 ef 01             	sub    $0x1,%edi
+  800ce8:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800ceb:	fd                   	std
+  800cec:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800cee:	fc                   	cld
+  800cef:	eb 1a                	jmp    800d0b <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800cf1:	89 f2                	mov    %esi,%edx
+  800cf3:	09 c2                	or     %eax,%edx
+  800cf5:	09 ca                	or     %ecx,%edx
+  800cf7:	f6 c2 03             	test   $0x3,%dl
+  800cfa:	75 0a                	jne    800d06 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800cfc:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800cff:	89 c7                	mov    %eax,%edi
+  800d01:	fc                   	cld
+  800d02:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d04:	eb 05                	jmp    800d0b <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800d06:	89 c7                	mov    %eax,%edi
+  800d08:	fc                   	cld
+  800d09:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800d0b:	5e                   	pop    %esi
+  800d0c:	5f                   	pop    %edi
+  800d0d:	5d                   	pop    %ebp
+  800d0e:	c3                   	ret
+
+00800d0f <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800d0f:	55                   	push   %ebp
+  800d10:	89 e5                	mov    %esp,%ebp
+  800d12:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800d15:	ff 75 10             	push   0x10(%ebp)
+  800d18:	ff 75 0c             	push   0xc(%ebp)
+  800d1b:	ff 75 08             	push   0x8(%ebp)
+  800d1e:	e8 8a ff ff ff       	call   800cad <memmove>
+}
+  800d23:	c9                   	leave
+  800d24:	c3                   	ret
+
+00800d25 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800d25:	55                   	push   %ebp
+  800d26:	89 e5                	mov    %esp,%ebp
+  800d28:	56                   	push   %esi
+  800d29:	53                   	push   %ebx
+  800d2a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d2d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800d30:	89 c6                	mov    %eax,%esi
+  800d32:	03 75 10             	add    0x10(%ebp),%esi
+  800d35:	eb 06                	jmp    800d3d <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800d37:	83 c0 01             	add    $0x1,%eax
+  800d3a:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800d3d:	39 f0                	cmp    %esi,%eax
+  800d3f:	74 14                	je     800d55 <memcmp+0x30>
+		if (*s1 != *s2)
+  800d41:	0f b6 08             	movzbl (%eax),%ecx
+  800d44:	0f b6 1a             	movzbl (%edx),%ebx
+  800d47:	38 d9                	cmp    %bl,%cl
+  800d49:	74 ec                	je     800d37 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800d4b:	0f b6 c1             	movzbl %cl,%eax
+  800d4e:	0f b6 db             	movzbl %bl,%ebx
+  800d51:	29 d8                	sub    %ebx,%eax
+  800d53:	eb 05                	jmp    800d5a <memcmp+0x35>
+	}
+
+	return 0;
+  800d55:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d5a:	5b                   	pop    %ebx
+  800d5b:	5e                   	pop    %esi
+  800d5c:	5d                   	pop    %ebp
+  800d5d:	c3                   	ret
+
+00800d5e <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800d5e:	55                   	push   %ebp
+  800d5f:	89 e5                	mov    %esp,%ebp
+  800d61:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d64:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800d67:	89 c2                	mov    %eax,%edx
+  800d69:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800d6c:	eb 03                	jmp    800d71 <memfind+0x13>
+  800d6e:	83 c0 01             	add    $0x1,%eax
+  800d71:	39 d0                	cmp    %edx,%eax
+  800d73:	73 04                	jae    800d79 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800d75:	38 08                	cmp    %cl,(%eax)
+  800d77:	75 f5                	jne    800d6e <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800d79:	5d                   	pop    %ebp
+  800d7a:	c3                   	ret
+
+00800d7b <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800d7b:	55                   	push   %ebp
+  800d7c:	89 e5                	mov    %esp,%ebp
+  800d7e:	57                   	push   %edi
+  800d7f:	56                   	push   %esi
+  800d80:	53                   	push   %ebx
+  800d81:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d84:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800d87:	eb 03                	jmp    800d8c <strtol+0x11>
+		s++;
+  800d89:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800d8c:	0f b6 02             	movzbl (%edx),%eax
+  800d8f:	3c 20                	cmp    $0x20,%al
+  800d91:	74 f6                	je     800d89 <strtol+0xe>
+  800d93:	3c 09                	cmp    $0x9,%al
+  800d95:	74 f2                	je     800d89 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800d97:	3c 2b                	cmp    $0x2b,%al
+  800d99:	74 2a                	je     800dc5 <strtol+0x4a>
+	int neg = 0;
+  800d9b:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800da0:	3c 2d                	cmp    $0x2d,%al
+  800da2:	74 2b                	je     800dcf <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800da4:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800daa:	75 0f                	jne    800dbb <strtol+0x40>
+  800dac:	80 3a 30             	cmpb   $0x30,(%edx)
+  800daf:	74 28                	je     800dd9 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800db1:	85 db                	test   %ebx,%ebx
+  800db3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800db8:	0f 44 d8             	cmove  %eax,%ebx
+  800dbb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dc0:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800dc3:	eb 46                	jmp    800e0b <strtol+0x90>
+		s++;
+  800dc5:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800dc8:	bf 00 00 00 00       	mov    $0x0,%edi
+  800dcd:	eb d5                	jmp    800da4 <strtol+0x29>
+		s++, neg = 1;
+  800dcf:	83 c2 01             	add    $0x1,%edx
+  800dd2:	bf 01 00 00 00       	mov    $0x1,%edi
+  800dd7:	eb cb                	jmp    800da4 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800dd9:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800ddd:	74 0e                	je     800ded <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800ddf:	85 db                	test   %ebx,%ebx
+  800de1:	75 d8                	jne    800dbb <strtol+0x40>
+		s++, base = 8;
+  800de3:	83 c2 01             	add    $0x1,%edx
+  800de6:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800deb:	eb ce                	jmp    800dbb <strtol+0x40>
+		s += 2, base = 16;
+  800ded:	83 c2 02             	add    $0x2,%edx
+  800df0:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800df5:	eb c4                	jmp    800dbb <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800df7:	0f be c0             	movsbl %al,%eax
+  800dfa:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800dfd:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800e00:	7d 3a                	jge    800e3c <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800e02:	83 c2 01             	add    $0x1,%edx
+  800e05:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800e09:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800e0b:	0f b6 02             	movzbl (%edx),%eax
+  800e0e:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800e11:	89 f3                	mov    %esi,%ebx
+  800e13:	80 fb 09             	cmp    $0x9,%bl
+  800e16:	76 df                	jbe    800df7 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800e18:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800e1b:	89 f3                	mov    %esi,%ebx
+  800e1d:	80 fb 19             	cmp    $0x19,%bl
+  800e20:	77 08                	ja     800e2a <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800e22:	0f be c0             	movsbl %al,%eax
+  800e25:	83 e8 57             	sub    $0x57,%eax
+  800e28:	eb d3                	jmp    800dfd <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800e2a:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800e2d:	89 f3                	mov    %esi,%ebx
+  800e2f:	80 fb 19             	cmp    $0x19,%bl
+  800e32:	77 08                	ja     800e3c <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800e34:	0f be c0             	movsbl %al,%eax
+  800e37:	83 e8 37             	sub    $0x37,%eax
+  800e3a:	eb c1                	jmp    800dfd <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800e3c:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800e40:	74 05                	je     800e47 <strtol+0xcc>
+		*endptr = (char *) s;
+  800e42:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e45:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800e47:	89 c8                	mov    %ecx,%eax
+  800e49:	f7 d8                	neg    %eax
+  800e4b:	85 ff                	test   %edi,%edi
+  800e4d:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800e50:	89 c8                	mov    %ecx,%eax
+  800e52:	5b                   	pop    %ebx
+  800e53:	5e                   	pop    %esi
+  800e54:	5f                   	pop    %edi
+  800e55:	5d                   	pop    %ebp
+  800e56:	c3                   	ret
+
+00800e57 <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800e57:	55                   	push   %ebp
+  800e58:	89 e5                	mov    %esp,%ebp
+  800e5a:	57                   	push   %edi
+  800e5b:	56                   	push   %esi
+  800e5c:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e62:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e65:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e68:	89 c3                	mov    %eax,%ebx
+  800e6a:	89 c7                	mov    %eax,%edi
+  800e6c:	89 c6                	mov    %eax,%esi
+  800e6e:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  800e70:	5b                   	pop    %ebx
+  800e71:	5e                   	pop    %esi
+  800e72:	5f                   	pop    %edi
+  800e73:	5d                   	pop    %ebp
+  800e74:	c3                   	ret
+
+00800e75 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800e75:	55                   	push   %ebp
+  800e76:	89 e5                	mov    %esp,%ebp
+  800e78:	57                   	push   %edi
+  800e79:	56                   	push   %esi
+  800e7a:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e7b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e80:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e85:	89 d1                	mov    %edx,%ecx
+  800e87:	89 d3                	mov    %edx,%ebx
+  800e89:	89 d7                	mov    %edx,%edi
+  800e8b:	89 d6                	mov    %edx,%esi
+  800e8d:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800e8f:	5b                   	pop    %ebx
+  800e90:	5e                   	pop    %esi
+  800e91:	5f                   	pop    %edi
+  800e92:	5d                   	pop    %ebp
+  800e93:	c3                   	ret
+
+00800e94 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800e94:	55                   	push   %ebp
+  800e95:	89 e5                	mov    %esp,%ebp
+  800e97:	57                   	push   %edi
+  800e98:	56                   	push   %esi
+  800e99:	53                   	push   %ebx
+  800e9a:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800e9d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ea2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ea5:	b8 03 00 00 00       	mov    $0x3,%eax
+  800eaa:	89 cb                	mov    %ecx,%ebx
+  800eac:	89 cf                	mov    %ecx,%edi
+  800eae:	89 ce                	mov    %ecx,%esi
+  800eb0:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800eb2:	85 c0                	test   %eax,%eax
+  800eb4:	7f 08                	jg     800ebe <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800eb6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eb9:	5b                   	pop    %ebx
+  800eba:	5e                   	pop    %esi
+  800ebb:	5f                   	pop    %edi
+  800ebc:	5d                   	pop    %ebp
+  800ebd:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ebe:	83 ec 0c             	sub    $0xc,%esp
+  800ec1:	50                   	push   %eax
+  800ec2:	6a 03                	push   $0x3
+  800ec4:	68 23 32 80 00       	push   $0x803223
+  800ec9:	6a 3e                	push   $0x3e
+  800ecb:	68 40 32 80 00       	push   $0x803240
+  800ed0:	e8 be f5 ff ff       	call   800493 <_panic>
+
+00800ed5 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800ed5:	55                   	push   %ebp
+  800ed6:	89 e5                	mov    %esp,%ebp
+  800ed8:	57                   	push   %edi
+  800ed9:	56                   	push   %esi
+  800eda:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800edb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ee0:	b8 02 00 00 00       	mov    $0x2,%eax
+  800ee5:	89 d1                	mov    %edx,%ecx
+  800ee7:	89 d3                	mov    %edx,%ebx
+  800ee9:	89 d7                	mov    %edx,%edi
+  800eeb:	89 d6                	mov    %edx,%esi
+  800eed:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800eef:	5b                   	pop    %ebx
+  800ef0:	5e                   	pop    %esi
+  800ef1:	5f                   	pop    %edi
+  800ef2:	5d                   	pop    %ebp
+  800ef3:	c3                   	ret
+
+00800ef4 <sys_yield>:
+
+void
+sys_yield(void) {
+  800ef4:	55                   	push   %ebp
+  800ef5:	89 e5                	mov    %esp,%ebp
+  800ef7:	57                   	push   %edi
+  800ef8:	56                   	push   %esi
+  800ef9:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800efa:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eff:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800f04:	89 d1                	mov    %edx,%ecx
+  800f06:	89 d3                	mov    %edx,%ebx
+  800f08:	89 d7                	mov    %edx,%edi
+  800f0a:	89 d6                	mov    %edx,%esi
+  800f0c:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800f0e:	5b                   	pop    %ebx
+  800f0f:	5e                   	pop    %esi
+  800f10:	5f                   	pop    %edi
+  800f11:	5d                   	pop    %ebp
+  800f12:	c3                   	ret
+
+00800f13 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  800f13:	55                   	push   %ebp
+  800f14:	89 e5                	mov    %esp,%ebp
+  800f16:	57                   	push   %edi
+  800f17:	56                   	push   %esi
+  800f18:	53                   	push   %ebx
+  800f19:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800f1c:	be 00 00 00 00       	mov    $0x0,%esi
+  800f21:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f24:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f27:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f2c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f2f:	89 f7                	mov    %esi,%edi
+  800f31:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f33:	85 c0                	test   %eax,%eax
+  800f35:	7f 08                	jg     800f3f <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800f37:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f3a:	5b                   	pop    %ebx
+  800f3b:	5e                   	pop    %esi
+  800f3c:	5f                   	pop    %edi
+  800f3d:	5d                   	pop    %ebp
+  800f3e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f3f:	83 ec 0c             	sub    $0xc,%esp
+  800f42:	50                   	push   %eax
+  800f43:	6a 04                	push   $0x4
+  800f45:	68 23 32 80 00       	push   $0x803223
+  800f4a:	6a 3e                	push   $0x3e
+  800f4c:	68 40 32 80 00       	push   $0x803240
+  800f51:	e8 3d f5 ff ff       	call   800493 <_panic>
+
+00800f56 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  800f56:	55                   	push   %ebp
+  800f57:	89 e5                	mov    %esp,%ebp
+  800f59:	57                   	push   %edi
+  800f5a:	56                   	push   %esi
+  800f5b:	53                   	push   %ebx
+  800f5c:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800f5f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f62:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f65:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f6a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f6d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f70:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f73:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f75:	85 c0                	test   %eax,%eax
+  800f77:	7f 08                	jg     800f81 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800f79:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f7c:	5b                   	pop    %ebx
+  800f7d:	5e                   	pop    %esi
+  800f7e:	5f                   	pop    %edi
+  800f7f:	5d                   	pop    %ebp
+  800f80:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f81:	83 ec 0c             	sub    $0xc,%esp
+  800f84:	50                   	push   %eax
+  800f85:	6a 05                	push   $0x5
+  800f87:	68 23 32 80 00       	push   $0x803223
+  800f8c:	6a 3e                	push   $0x3e
+  800f8e:	68 40 32 80 00       	push   $0x803240
+  800f93:	e8 fb f4 ff ff       	call   800493 <_panic>
+
+00800f98 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  800f98:	55                   	push   %ebp
+  800f99:	89 e5                	mov    %esp,%ebp
+  800f9b:	57                   	push   %edi
+  800f9c:	56                   	push   %esi
+  800f9d:	53                   	push   %ebx
+  800f9e:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800fa1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fa6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fac:	b8 06 00 00 00       	mov    $0x6,%eax
+  800fb1:	89 df                	mov    %ebx,%edi
+  800fb3:	89 de                	mov    %ebx,%esi
+  800fb5:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800fb7:	85 c0                	test   %eax,%eax
+  800fb9:	7f 08                	jg     800fc3 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800fbb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fbe:	5b                   	pop    %ebx
+  800fbf:	5e                   	pop    %esi
+  800fc0:	5f                   	pop    %edi
+  800fc1:	5d                   	pop    %ebp
+  800fc2:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800fc3:	83 ec 0c             	sub    $0xc,%esp
+  800fc6:	50                   	push   %eax
+  800fc7:	6a 06                	push   $0x6
+  800fc9:	68 23 32 80 00       	push   $0x803223
+  800fce:	6a 3e                	push   $0x3e
+  800fd0:	68 40 32 80 00       	push   $0x803240
+  800fd5:	e8 b9 f4 ff ff       	call   800493 <_panic>
+
+00800fda <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800fda:	55                   	push   %ebp
+  800fdb:	89 e5                	mov    %esp,%ebp
+  800fdd:	57                   	push   %edi
+  800fde:	56                   	push   %esi
+  800fdf:	53                   	push   %ebx
+  800fe0:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800fe3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fe8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800feb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fee:	b8 08 00 00 00       	mov    $0x8,%eax
+  800ff3:	89 df                	mov    %ebx,%edi
+  800ff5:	89 de                	mov    %ebx,%esi
+  800ff7:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ff9:	85 c0                	test   %eax,%eax
+  800ffb:	7f 08                	jg     801005 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800ffd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801000:	5b                   	pop    %ebx
+  801001:	5e                   	pop    %esi
+  801002:	5f                   	pop    %edi
+  801003:	5d                   	pop    %ebp
+  801004:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801005:	83 ec 0c             	sub    $0xc,%esp
+  801008:	50                   	push   %eax
+  801009:	6a 08                	push   $0x8
+  80100b:	68 23 32 80 00       	push   $0x803223
+  801010:	6a 3e                	push   $0x3e
+  801012:	68 40 32 80 00       	push   $0x803240
+  801017:	e8 77 f4 ff ff       	call   800493 <_panic>
+
+0080101c <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80101c:	55                   	push   %ebp
+  80101d:	89 e5                	mov    %esp,%ebp
+  80101f:	57                   	push   %edi
+  801020:	56                   	push   %esi
+  801021:	53                   	push   %ebx
+  801022:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  801025:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80102a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80102d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801030:	b8 09 00 00 00       	mov    $0x9,%eax
+  801035:	89 df                	mov    %ebx,%edi
+  801037:	89 de                	mov    %ebx,%esi
+  801039:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80103b:	85 c0                	test   %eax,%eax
+  80103d:	7f 08                	jg     801047 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  80103f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801042:	5b                   	pop    %ebx
+  801043:	5e                   	pop    %esi
+  801044:	5f                   	pop    %edi
+  801045:	5d                   	pop    %ebp
+  801046:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801047:	83 ec 0c             	sub    $0xc,%esp
+  80104a:	50                   	push   %eax
+  80104b:	6a 09                	push   $0x9
+  80104d:	68 23 32 80 00       	push   $0x803223
+  801052:	6a 3e                	push   $0x3e
+  801054:	68 40 32 80 00       	push   $0x803240
+  801059:	e8 35 f4 ff ff       	call   800493 <_panic>
+
+0080105e <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80105e:	55                   	push   %ebp
+  80105f:	89 e5                	mov    %esp,%ebp
+  801061:	57                   	push   %edi
+  801062:	56                   	push   %esi
+  801063:	53                   	push   %ebx
+  801064:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  801067:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80106c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80106f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801072:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801077:	89 df                	mov    %ebx,%edi
+  801079:	89 de                	mov    %ebx,%esi
+  80107b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80107d:	85 c0                	test   %eax,%eax
+  80107f:	7f 08                	jg     801089 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801081:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801084:	5b                   	pop    %ebx
+  801085:	5e                   	pop    %esi
+  801086:	5f                   	pop    %edi
+  801087:	5d                   	pop    %ebp
+  801088:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801089:	83 ec 0c             	sub    $0xc,%esp
+  80108c:	50                   	push   %eax
+  80108d:	6a 0a                	push   $0xa
+  80108f:	68 23 32 80 00       	push   $0x803223
+  801094:	6a 3e                	push   $0x3e
+  801096:	68 40 32 80 00       	push   $0x803240
+  80109b:	e8 f3 f3 ff ff       	call   800493 <_panic>
+
+008010a0 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  8010a0:	55                   	push   %ebp
+  8010a1:	89 e5                	mov    %esp,%ebp
+  8010a3:	57                   	push   %edi
+  8010a4:	56                   	push   %esi
+  8010a5:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8010a6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ac:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8010b6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010b9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010bc:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8010be:	5b                   	pop    %ebx
+  8010bf:	5e                   	pop    %esi
+  8010c0:	5f                   	pop    %edi
+  8010c1:	5d                   	pop    %ebp
+  8010c2:	c3                   	ret
+
+008010c3 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  8010c3:	55                   	push   %ebp
+  8010c4:	89 e5                	mov    %esp,%ebp
+  8010c6:	57                   	push   %edi
+  8010c7:	56                   	push   %esi
+  8010c8:	53                   	push   %ebx
+  8010c9:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8010cc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010d1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d4:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8010d9:	89 cb                	mov    %ecx,%ebx
+  8010db:	89 cf                	mov    %ecx,%edi
+  8010dd:	89 ce                	mov    %ecx,%esi
+  8010df:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8010e1:	85 c0                	test   %eax,%eax
+  8010e3:	7f 08                	jg     8010ed <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  8010e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010e8:	5b                   	pop    %ebx
+  8010e9:	5e                   	pop    %esi
+  8010ea:	5f                   	pop    %edi
+  8010eb:	5d                   	pop    %ebp
+  8010ec:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8010ed:	83 ec 0c             	sub    $0xc,%esp
+  8010f0:	50                   	push   %eax
+  8010f1:	6a 0d                	push   $0xd
+  8010f3:	68 23 32 80 00       	push   $0x803223
+  8010f8:	6a 3e                	push   $0x3e
+  8010fa:	68 40 32 80 00       	push   $0x803240
+  8010ff:	e8 8f f3 ff ff       	call   800493 <_panic>
+
+00801104 <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  801104:	55                   	push   %ebp
+  801105:	89 e5                	mov    %esp,%ebp
+  801107:	57                   	push   %edi
+  801108:	56                   	push   %esi
+  801109:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80110a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80110f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801112:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801115:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80111a:	89 df                	mov    %ebx,%edi
+  80111c:	89 de                	mov    %ebx,%esi
+  80111e:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  801120:	5b                   	pop    %ebx
+  801121:	5e                   	pop    %esi
+  801122:	5f                   	pop    %edi
+  801123:	5d                   	pop    %ebp
+  801124:	c3                   	ret
+
+00801125 <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  801125:	55                   	push   %ebp
+  801126:	89 e5                	mov    %esp,%ebp
+  801128:	57                   	push   %edi
+  801129:	56                   	push   %esi
+  80112a:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80112b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801130:	8b 55 08             	mov    0x8(%ebp),%edx
+  801133:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801138:	89 cb                	mov    %ecx,%ebx
+  80113a:	89 cf                	mov    %ecx,%edi
+  80113c:	89 ce                	mov    %ecx,%esi
+  80113e:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  801140:	5b                   	pop    %ebx
+  801141:	5e                   	pop    %esi
+  801142:	5f                   	pop    %edi
+  801143:	5d                   	pop    %ebp
+  801144:	c3                   	ret
+
+00801145 <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  801145:	55                   	push   %ebp
+  801146:	89 e5                	mov    %esp,%ebp
+  801148:	57                   	push   %edi
+  801149:	56                   	push   %esi
+  80114a:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80114b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801150:	b8 10 00 00 00       	mov    $0x10,%eax
+  801155:	89 d1                	mov    %edx,%ecx
+  801157:	89 d3                	mov    %edx,%ebx
+  801159:	89 d7                	mov    %edx,%edi
+  80115b:	89 d6                	mov    %edx,%esi
+  80115d:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80115f:	5b                   	pop    %ebx
+  801160:	5e                   	pop    %esi
+  801161:	5f                   	pop    %edi
+  801162:	5d                   	pop    %ebp
+  801163:	c3                   	ret
+
+00801164 <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  801164:	55                   	push   %ebp
+  801165:	89 e5                	mov    %esp,%ebp
+  801167:	57                   	push   %edi
+  801168:	56                   	push   %esi
+  801169:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80116a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80116f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801172:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801175:	b8 11 00 00 00       	mov    $0x11,%eax
+  80117a:	89 df                	mov    %ebx,%edi
+  80117c:	89 de                	mov    %ebx,%esi
+  80117e:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  801180:	5b                   	pop    %ebx
+  801181:	5e                   	pop    %esi
+  801182:	5f                   	pop    %edi
+  801183:	5d                   	pop    %ebp
+  801184:	c3                   	ret
+
+00801185 <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  801185:	55                   	push   %ebp
+  801186:	89 e5                	mov    %esp,%ebp
+  801188:	57                   	push   %edi
+  801189:	56                   	push   %esi
+  80118a:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80118b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801190:	8b 55 08             	mov    0x8(%ebp),%edx
+  801193:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801196:	b8 12 00 00 00       	mov    $0x12,%eax
+  80119b:	89 df                	mov    %ebx,%edi
+  80119d:	89 de                	mov    %ebx,%esi
+  80119f:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  8011a1:	5b                   	pop    %ebx
+  8011a2:	5e                   	pop    %esi
+  8011a3:	5f                   	pop    %edi
+  8011a4:	5d                   	pop    %ebp
+  8011a5:	c3                   	ret
+
+008011a6 <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  8011a6:	55                   	push   %ebp
+  8011a7:	89 e5                	mov    %esp,%ebp
+  8011a9:	57                   	push   %edi
+  8011aa:	56                   	push   %esi
+  8011ab:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8011ac:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011b1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011b4:	b8 13 00 00 00       	mov    $0x13,%eax
+  8011b9:	89 cb                	mov    %ecx,%ebx
+  8011bb:	89 cf                	mov    %ecx,%edi
+  8011bd:	89 ce                	mov    %ecx,%esi
+  8011bf:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  8011c1:	5b                   	pop    %ebx
+  8011c2:	5e                   	pop    %esi
+  8011c3:	5f                   	pop    %edi
+  8011c4:	5d                   	pop    %ebp
+  8011c5:	c3                   	ret
+
+008011c6 <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  8011c6:	55                   	push   %ebp
+  8011c7:	89 e5                	mov    %esp,%ebp
+  8011c9:	57                   	push   %edi
+  8011ca:	56                   	push   %esi
+  8011cb:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8011cc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011d1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d4:	b8 14 00 00 00       	mov    $0x14,%eax
+  8011d9:	89 cb                	mov    %ecx,%ebx
+  8011db:	89 cf                	mov    %ecx,%edi
+  8011dd:	89 ce                	mov    %ecx,%esi
+  8011df:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  8011e1:	5b                   	pop    %ebx
+  8011e2:	5e                   	pop    %esi
+  8011e3:	5f                   	pop    %edi
+  8011e4:	5d                   	pop    %ebp
+  8011e5:	c3                   	ret
+
+008011e6 <pgfault>:
+//
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf) {
+  8011e6:	55                   	push   %ebp
+  8011e7:	89 e5                	mov    %esp,%ebp
+  8011e9:	53                   	push   %ebx
+  8011ea:	83 ec 04             	sub    $0x4,%esp
+  8011ed:	8b 45 08             	mov    0x8(%ebp),%eax
+    void *addr = (void *) utf->utf_fault_va;
+  8011f0:	8b 18                	mov    (%eax),%ebx
+    // Hint:
+    //   Use the read-only page table mappings at uvpt
+    //   (see <inc/memlayout.h>).
+
+    // LAB 4: Your code here.
+    if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P) ||
+  8011f2:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  8011f6:	0f 84 95 00 00 00    	je     801291 <pgfault+0xab>
+  8011fc:	89 d8                	mov    %ebx,%eax
+  8011fe:	c1 e8 16             	shr    $0x16,%eax
+  801201:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801208:	a8 01                	test   $0x1,%al
+  80120a:	0f 84 81 00 00 00    	je     801291 <pgfault+0xab>
+        (uvpt[PGNUM(addr)] & (PTE_P | PTE_COW)) != (PTE_P | PTE_COW)) {
+  801210:	89 d8                	mov    %ebx,%eax
+  801212:	c1 e8 0c             	shr    $0xc,%eax
+  801215:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80121c:	25 01 08 00 00       	and    $0x801,%eax
+    if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P) ||
+  801221:	3d 01 08 00 00       	cmp    $0x801,%eax
+  801226:	75 69                	jne    801291 <pgfault+0xab>
+    // Hint:
+    //   You should make three system calls.
+
+    // LAB 4: Your code here.
+
+    if (sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W))
+  801228:	83 ec 04             	sub    $0x4,%esp
+  80122b:	6a 07                	push   $0x7
+  80122d:	68 00 f0 7f 00       	push   $0x7ff000
+  801232:	6a 00                	push   $0x0
+  801234:	e8 da fc ff ff       	call   800f13 <sys_page_alloc>
+  801239:	83 c4 10             	add    $0x10,%esp
+  80123c:	85 c0                	test   %eax,%eax
+  80123e:	75 65                	jne    8012a5 <pgfault+0xbf>
+        panic("sys_page_alloc failed");
+
+    addr = ROUNDDOWN(addr, PGSIZE);
+  801240:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+    memmove(PFTEMP, addr, PGSIZE);
+  801246:	83 ec 04             	sub    $0x4,%esp
+  801249:	68 00 10 00 00       	push   $0x1000
+  80124e:	53                   	push   %ebx
+  80124f:	68 00 f0 7f 00       	push   $0x7ff000
+  801254:	e8 54 fa ff ff       	call   800cad <memmove>
+
+    if (sys_page_map(0, PFTEMP, 0, addr, PTE_P | PTE_U | PTE_W))
+  801259:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801260:	53                   	push   %ebx
+  801261:	6a 00                	push   $0x0
+  801263:	68 00 f0 7f 00       	push   $0x7ff000
+  801268:	6a 00                	push   $0x0
+  80126a:	e8 e7 fc ff ff       	call   800f56 <sys_page_map>
+  80126f:	83 c4 20             	add    $0x20,%esp
+  801272:	85 c0                	test   %eax,%eax
+  801274:	75 43                	jne    8012b9 <pgfault+0xd3>
+        panic("sys_page_map failed");
+    if (sys_page_unmap(0, PFTEMP))
+  801276:	83 ec 08             	sub    $0x8,%esp
+  801279:	68 00 f0 7f 00       	push   $0x7ff000
+  80127e:	6a 00                	push   $0x0
+  801280:	e8 13 fd ff ff       	call   800f98 <sys_page_unmap>
+  801285:	83 c4 10             	add    $0x10,%esp
+  801288:	85 c0                	test   %eax,%eax
+  80128a:	75 41                	jne    8012cd <pgfault+0xe7>
+        panic("sys_page_unmap failed");
+
+}
+  80128c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80128f:	c9                   	leave
+  801290:	c3                   	ret
+        panic("pgfault: faulting access invalid");
+  801291:	83 ec 04             	sub    $0x4,%esp
+  801294:	68 50 32 80 00       	push   $0x803250
+  801299:	6a 1e                	push   $0x1e
+  80129b:	68 bc 32 80 00       	push   $0x8032bc
+  8012a0:	e8 ee f1 ff ff       	call   800493 <_panic>
+        panic("sys_page_alloc failed");
+  8012a5:	83 ec 04             	sub    $0x4,%esp
+  8012a8:	68 2f 33 80 00       	push   $0x80332f
+  8012ad:	6a 2a                	push   $0x2a
+  8012af:	68 bc 32 80 00       	push   $0x8032bc
+  8012b4:	e8 da f1 ff ff       	call   800493 <_panic>
+        panic("sys_page_map failed");
+  8012b9:	83 ec 04             	sub    $0x4,%esp
+  8012bc:	68 c7 32 80 00       	push   $0x8032c7
+  8012c1:	6a 30                	push   $0x30
+  8012c3:	68 bc 32 80 00       	push   $0x8032bc
+  8012c8:	e8 c6 f1 ff ff       	call   800493 <_panic>
+        panic("sys_page_unmap failed");
+  8012cd:	83 ec 04             	sub    $0x4,%esp
+  8012d0:	68 db 32 80 00       	push   $0x8032db
+  8012d5:	6a 32                	push   $0x32
+  8012d7:	68 bc 32 80 00       	push   $0x8032bc
+  8012dc:	e8 b2 f1 ff ff       	call   800493 <_panic>
+
+008012e1 <fork>:
+//   Remember to fix "thisenv" in the child process.
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void) {
+  8012e1:	55                   	push   %ebp
+  8012e2:	89 e5                	mov    %esp,%ebp
+  8012e4:	57                   	push   %edi
+  8012e5:	56                   	push   %esi
+  8012e6:	53                   	push   %ebx
+  8012e7:	83 ec 18             	sub    $0x18,%esp
+    // LAB 4: Your code here.
+    set_pgfault_handler(pgfault);
+  8012ea:	68 e6 11 80 00       	push   $0x8011e6
+  8012ef:	e8 72 14 00 00       	call   802766 <set_pgfault_handler>
+
+// This must be inlined.  Exercise for reader: why?
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+  envid_t ret;
+  asm volatile("int %2"
+  8012f4:	b8 07 00 00 00       	mov    $0x7,%eax
+  8012f9:	cd 30                	int    $0x30
+  8012fb:	89 c6                	mov    %eax,%esi
+
+    envid_t envid = sys_exofork();
+    if (envid < 0)
+  8012fd:	83 c4 10             	add    $0x10,%esp
+  801300:	85 c0                	test   %eax,%eax
+  801302:	78 2a                	js     80132e <fork+0x4d>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+
+    uintptr_t addr;
+    for (addr = 0; addr < UTOP; addr += PGSIZE) {
+  801304:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (envid == 0) {
+  801309:	0f 85 a2 00 00 00    	jne    8013b1 <fork+0xd0>
+        thisenv = &envs[ENVX(sys_getenvid())];
+  80130f:	e8 c1 fb ff ff       	call   800ed5 <sys_getenvid>
+  801314:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801319:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80131c:	c1 e0 04             	shl    $0x4,%eax
+  80131f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801324:	a3 08 60 80 00       	mov    %eax,0x806008
+        return 0;
+  801329:	e9 6c 01 00 00       	jmp    80149a <fork+0x1b9>
+        panic("fork: sys_exofork error: %e", envid);
+  80132e:	50                   	push   %eax
+  80132f:	68 f1 32 80 00       	push   $0x8032f1
+  801334:	6a 6f                	push   $0x6f
+  801336:	68 bc 32 80 00       	push   $0x8032bc
+  80133b:	e8 53 f1 ff ff       	call   800493 <_panic>
+        if ((r = sys_page_map(0, vptr, envid, vptr, uvpt[pn] & PTE_SYSCALL)) < 0)
+  801340:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801347:	83 ec 0c             	sub    $0xc,%esp
+  80134a:	25 07 0e 00 00       	and    $0xe07,%eax
+  80134f:	50                   	push   %eax
+  801350:	57                   	push   %edi
+  801351:	56                   	push   %esi
+  801352:	57                   	push   %edi
+  801353:	6a 00                	push   $0x0
+  801355:	e8 fc fb ff ff       	call   800f56 <sys_page_map>
+  80135a:	83 c4 20             	add    $0x20,%esp
+  80135d:	85 c0                	test   %eax,%eax
+  80135f:	79 3e                	jns    80139f <fork+0xbe>
+            panic("duppage :in sys_page_map %e", r);
+  801361:	50                   	push   %eax
+  801362:	68 0d 33 80 00       	push   $0x80330d
+  801367:	6a 49                	push   $0x49
+  801369:	68 bc 32 80 00       	push   $0x8032bc
+  80136e:	e8 20 f1 ff ff       	call   800493 <_panic>
+            panic("duppage :in sys_page_map %e", r);
+  801373:	50                   	push   %eax
+  801374:	68 0d 33 80 00       	push   $0x80330d
+  801379:	6a 4e                	push   $0x4e
+  80137b:	68 bc 32 80 00       	push   $0x8032bc
+  801380:	e8 0e f1 ff ff       	call   800493 <_panic>
+    } else if ((r = sys_page_map(0, vptr, envid, vptr, PTE_P | PTE_U)) < 0)
+  801385:	83 ec 0c             	sub    $0xc,%esp
+  801388:	6a 05                	push   $0x5
+  80138a:	57                   	push   %edi
+  80138b:	56                   	push   %esi
+  80138c:	57                   	push   %edi
+  80138d:	6a 00                	push   $0x0
+  80138f:	e8 c2 fb ff ff       	call   800f56 <sys_page_map>
+  801394:	83 c4 20             	add    $0x20,%esp
+  801397:	85 c0                	test   %eax,%eax
+  801399:	0f 88 ab 00 00 00    	js     80144a <fork+0x169>
+    for (addr = 0; addr < UTOP; addr += PGSIZE) {
+  80139f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8013a5:	81 fb 00 00 c0 ee    	cmp    $0xeec00000,%ebx
+  8013ab:	0f 84 ab 00 00 00    	je     80145c <fork+0x17b>
+        if (uvpd[PDX(addr)] & PTE_P && uvpt[PGNUM(addr)] & PTE_P && addr != UXSTACKTOP - PGSIZE) {
+  8013b1:	89 d8                	mov    %ebx,%eax
+  8013b3:	c1 e8 16             	shr    $0x16,%eax
+  8013b6:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8013bd:	a8 01                	test   $0x1,%al
+  8013bf:	74 de                	je     80139f <fork+0xbe>
+  8013c1:	89 d8                	mov    %ebx,%eax
+  8013c3:	c1 e8 0c             	shr    $0xc,%eax
+  8013c6:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8013cd:	f6 c2 01             	test   $0x1,%dl
+  8013d0:	74 cd                	je     80139f <fork+0xbe>
+  8013d2:	81 fb 00 f0 bf ee    	cmp    $0xeebff000,%ebx
+  8013d8:	74 c5                	je     80139f <fork+0xbe>
+    void *vptr = (void *) (pn * PGSIZE);
+  8013da:	89 c7                	mov    %eax,%edi
+  8013dc:	c1 e7 0c             	shl    $0xc,%edi
+    if (uvpt[pn] & PTE_SHARE) {
+  8013df:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8013e6:	f6 c6 04             	test   $0x4,%dh
+  8013e9:	0f 85 51 ff ff ff    	jne    801340 <fork+0x5f>
+    } else if (uvpt[pn] & (PTE_W | PTE_COW)) {
+  8013ef:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8013f6:	a9 02 08 00 00       	test   $0x802,%eax
+  8013fb:	74 88                	je     801385 <fork+0xa4>
+        if ((r = sys_page_map(0, vptr, envid, vptr, PTE_P | PTE_U | PTE_COW)) < 0)
+  8013fd:	83 ec 0c             	sub    $0xc,%esp
+  801400:	68 05 08 00 00       	push   $0x805
+  801405:	57                   	push   %edi
+  801406:	56                   	push   %esi
+  801407:	57                   	push   %edi
+  801408:	6a 00                	push   $0x0
+  80140a:	e8 47 fb ff ff       	call   800f56 <sys_page_map>
+  80140f:	83 c4 20             	add    $0x20,%esp
+  801412:	85 c0                	test   %eax,%eax
+  801414:	0f 88 59 ff ff ff    	js     801373 <fork+0x92>
+        if ((r = sys_page_map(0, vptr, 0, vptr, PTE_P | PTE_U | PTE_COW)) < 0)
+  80141a:	83 ec 0c             	sub    $0xc,%esp
+  80141d:	68 05 08 00 00       	push   $0x805
+  801422:	57                   	push   %edi
+  801423:	6a 00                	push   $0x0
+  801425:	57                   	push   %edi
+  801426:	6a 00                	push   $0x0
+  801428:	e8 29 fb ff ff       	call   800f56 <sys_page_map>
+  80142d:	83 c4 20             	add    $0x20,%esp
+  801430:	85 c0                	test   %eax,%eax
+  801432:	0f 89 67 ff ff ff    	jns    80139f <fork+0xbe>
+            panic("duppage :in sys_page_map %e", r);
+  801438:	50                   	push   %eax
+  801439:	68 0d 33 80 00       	push   $0x80330d
+  80143e:	6a 50                	push   $0x50
+  801440:	68 bc 32 80 00       	push   $0x8032bc
+  801445:	e8 49 f0 ff ff       	call   800493 <_panic>
+        panic("duppage :in sys_page_map %e", r);
+  80144a:	50                   	push   %eax
+  80144b:	68 0d 33 80 00       	push   $0x80330d
+  801450:	6a 53                	push   $0x53
+  801452:	68 bc 32 80 00       	push   $0x8032bc
+  801457:	e8 37 f0 ff ff       	call   800493 <_panic>
+            duppage(envid, PGNUM(addr));
+        }
+    }
+    if (sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W))
+  80145c:	83 ec 04             	sub    $0x4,%esp
+  80145f:	6a 07                	push   $0x7
+  801461:	68 00 f0 bf ee       	push   $0xeebff000
+  801466:	56                   	push   %esi
+  801467:	e8 a7 fa ff ff       	call   800f13 <sys_page_alloc>
+  80146c:	83 c4 10             	add    $0x10,%esp
+  80146f:	85 c0                	test   %eax,%eax
+  801471:	75 31                	jne    8014a4 <fork+0x1c3>
+        panic("fork: sys_page_alloc failed");
+    if (sys_env_set_pgfault_upcall(envid, _pgfault_upcall))
+  801473:	83 ec 08             	sub    $0x8,%esp
+  801476:	68 d1 27 80 00       	push   $0x8027d1
+  80147b:	56                   	push   %esi
+  80147c:	e8 dd fb ff ff       	call   80105e <sys_env_set_pgfault_upcall>
+  801481:	83 c4 10             	add    $0x10,%esp
+  801484:	85 c0                	test   %eax,%eax
+  801486:	75 30                	jne    8014b8 <fork+0x1d7>
+        panic("fork: sys_env_set_pgfault_upcall failed");
+    if (sys_env_set_status(envid, ENV_RUNNABLE))
+  801488:	83 ec 08             	sub    $0x8,%esp
+  80148b:	6a 02                	push   $0x2
+  80148d:	56                   	push   %esi
+  80148e:	e8 47 fb ff ff       	call   800fda <sys_env_set_status>
+  801493:	83 c4 10             	add    $0x10,%esp
+  801496:	85 c0                	test   %eax,%eax
+  801498:	75 32                	jne    8014cc <fork+0x1eb>
+        panic("fork: sys_env_set_status failed");
+
+    return envid;
+
+}
+  80149a:	89 f0                	mov    %esi,%eax
+  80149c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80149f:	5b                   	pop    %ebx
+  8014a0:	5e                   	pop    %esi
+  8014a1:	5f                   	pop    %edi
+  8014a2:	5d                   	pop    %ebp
+  8014a3:	c3                   	ret
+        panic("fork: sys_page_alloc failed");
+  8014a4:	83 ec 04             	sub    $0x4,%esp
+  8014a7:	68 29 33 80 00       	push   $0x803329
+  8014ac:	6a 7d                	push   $0x7d
+  8014ae:	68 bc 32 80 00       	push   $0x8032bc
+  8014b3:	e8 db ef ff ff       	call   800493 <_panic>
+        panic("fork: sys_env_set_pgfault_upcall failed");
+  8014b8:	83 ec 04             	sub    $0x4,%esp
+  8014bb:	68 74 32 80 00       	push   $0x803274
+  8014c0:	6a 7f                	push   $0x7f
+  8014c2:	68 bc 32 80 00       	push   $0x8032bc
+  8014c7:	e8 c7 ef ff ff       	call   800493 <_panic>
+        panic("fork: sys_env_set_status failed");
+  8014cc:	83 ec 04             	sub    $0x4,%esp
+  8014cf:	68 9c 32 80 00       	push   $0x80329c
+  8014d4:	68 81 00 00 00       	push   $0x81
+  8014d9:	68 bc 32 80 00       	push   $0x8032bc
+  8014de:	e8 b0 ef ff ff       	call   800493 <_panic>
+
+008014e3 <sfork>:
+
+// Challenge!
+int
+sfork(void) {
+  8014e3:	55                   	push   %ebp
+  8014e4:	89 e5                	mov    %esp,%ebp
+  8014e6:	83 ec 0c             	sub    $0xc,%esp
+    panic("sfork not implemented");
+  8014e9:	68 45 33 80 00       	push   $0x803345
+  8014ee:	68 8a 00 00 00       	push   $0x8a
+  8014f3:	68 bc 32 80 00       	push   $0x8032bc
+  8014f8:	e8 96 ef ff ff       	call   800493 <_panic>
+
+008014fd <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  8014fd:	55                   	push   %ebp
+  8014fe:	89 e5                	mov    %esp,%ebp
+  801500:	56                   	push   %esi
+  801501:	53                   	push   %ebx
+  801502:	8b 75 08             	mov    0x8(%ebp),%esi
+  801505:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801508:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  80150b:	85 c0                	test   %eax,%eax
+  80150d:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801512:	0f 44 c2             	cmove  %edx,%eax
+  801515:	83 ec 0c             	sub    $0xc,%esp
+  801518:	50                   	push   %eax
+  801519:	e8 a5 fb ff ff       	call   8010c3 <sys_ipc_recv>
+
+  if (from_env_store)
+  80151e:	83 c4 10             	add    $0x10,%esp
+  801521:	85 f6                	test   %esi,%esi
+  801523:	74 17                	je     80153c <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  801525:	ba 00 00 00 00       	mov    $0x0,%edx
+  80152a:	85 c0                	test   %eax,%eax
+  80152c:	75 0c                	jne    80153a <ipc_recv+0x3d>
+  80152e:	8b 15 08 60 80 00    	mov    0x806008,%edx
+  801534:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  80153a:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  80153c:	85 db                	test   %ebx,%ebx
+  80153e:	74 2b                	je     80156b <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  801540:	85 c0                	test   %eax,%eax
+  801542:	74 0d                	je     801551 <ipc_recv+0x54>
+  801544:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  80154a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80154d:	5b                   	pop    %ebx
+  80154e:	5e                   	pop    %esi
+  80154f:	5d                   	pop    %ebp
+  801550:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  801551:	a1 08 60 80 00       	mov    0x806008,%eax
+  801556:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80155c:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  80155e:	a1 08 60 80 00       	mov    0x806008,%eax
+  801563:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  801569:	eb df                	jmp    80154a <ipc_recv+0x4d>
+  80156b:	85 c0                	test   %eax,%eax
+  80156d:	75 db                	jne    80154a <ipc_recv+0x4d>
+  80156f:	eb ed                	jmp    80155e <ipc_recv+0x61>
+
+00801571 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  801571:	55                   	push   %ebp
+  801572:	89 e5                	mov    %esp,%ebp
+  801574:	57                   	push   %edi
+  801575:	56                   	push   %esi
+  801576:	53                   	push   %ebx
+  801577:	83 ec 0c             	sub    $0xc,%esp
+  80157a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80157d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801580:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  801583:	85 db                	test   %ebx,%ebx
+  801585:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80158a:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  80158d:	ff 75 14             	push   0x14(%ebp)
+  801590:	53                   	push   %ebx
+  801591:	56                   	push   %esi
+  801592:	57                   	push   %edi
+  801593:	e8 08 fb ff ff       	call   8010a0 <sys_ipc_try_send>
+  801598:	83 c4 10             	add    $0x10,%esp
+  80159b:	85 c0                	test   %eax,%eax
+  80159d:	74 1e                	je     8015bd <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  80159f:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8015a2:	75 07                	jne    8015ab <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  8015a4:	e8 4b f9 ff ff       	call   800ef4 <sys_yield>
+  8015a9:	eb e2                	jmp    80158d <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  8015ab:	50                   	push   %eax
+  8015ac:	68 5b 33 80 00       	push   $0x80335b
+  8015b1:	6a 3c                	push   $0x3c
+  8015b3:	68 68 33 80 00       	push   $0x803368
+  8015b8:	e8 d6 ee ff ff       	call   800493 <_panic>
+  }
+
+#endif
+}
+  8015bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015c0:	5b                   	pop    %ebx
+  8015c1:	5e                   	pop    %esi
+  8015c2:	5f                   	pop    %edi
+  8015c3:	5d                   	pop    %ebp
+  8015c4:	c3                   	ret
+
+008015c5 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  8015c5:	55                   	push   %ebp
+  8015c6:	89 e5                	mov    %esp,%ebp
+  8015c8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  8015cb:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  8015d0:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8015d3:	c1 e0 04             	shl    $0x4,%eax
+  8015d6:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8015db:	8b 40 50             	mov    0x50(%eax),%eax
+  8015de:	39 c8                	cmp    %ecx,%eax
+  8015e0:	74 12                	je     8015f4 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  8015e2:	83 c2 01             	add    $0x1,%edx
+  8015e5:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8015eb:	75 e3                	jne    8015d0 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  8015ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015f2:	eb 0e                	jmp    801602 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  8015f4:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8015f7:	c1 e0 04             	shl    $0x4,%eax
+  8015fa:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8015ff:	8b 40 48             	mov    0x48(%eax),%eax
+  801602:	5d                   	pop    %ebp
+  801603:	c3                   	ret
+
+00801604 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801604:	55                   	push   %ebp
+  801605:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801607:	8b 45 08             	mov    0x8(%ebp),%eax
+  80160a:	05 00 00 00 30       	add    $0x30000000,%eax
+  80160f:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801612:	5d                   	pop    %ebp
+  801613:	c3                   	ret
+
+00801614 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801614:	55                   	push   %ebp
+  801615:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801617:	8b 45 08             	mov    0x8(%ebp),%eax
+  80161a:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80161f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801624:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801629:	5d                   	pop    %ebp
+  80162a:	c3                   	ret
+
+0080162b <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80162b:	55                   	push   %ebp
+  80162c:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80162e:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801633:	eb 02                	jmp    801637 <fd_alloc+0xc>
+  801635:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801637:	89 c2                	mov    %eax,%edx
+  801639:	c1 ea 16             	shr    $0x16,%edx
+  80163c:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801643:	f6 c2 01             	test   $0x1,%dl
+  801646:	74 2b                	je     801673 <fd_alloc+0x48>
+  801648:	89 c2                	mov    %eax,%edx
+  80164a:	c1 ea 0c             	shr    $0xc,%edx
+  80164d:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801654:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80165a:	f6 c1 01             	test   $0x1,%cl
+  80165d:	74 14                	je     801673 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80165f:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801665:	75 ce                	jne    801635 <fd_alloc+0xa>
+  801667:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80166c:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801671:	eb 05                	jmp    801678 <fd_alloc+0x4d>
+			return 0;
+  801673:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801678:	8b 55 08             	mov    0x8(%ebp),%edx
+  80167b:	89 02                	mov    %eax,(%edx)
+}
+  80167d:	89 c8                	mov    %ecx,%eax
+  80167f:	5d                   	pop    %ebp
+  801680:	c3                   	ret
+
+00801681 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801681:	55                   	push   %ebp
+  801682:	89 e5                	mov    %esp,%ebp
+  801684:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801687:	83 f8 1f             	cmp    $0x1f,%eax
+  80168a:	77 30                	ja     8016bc <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80168c:	c1 e0 0c             	shl    $0xc,%eax
+  80168f:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801694:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80169a:	f6 c2 01             	test   $0x1,%dl
+  80169d:	74 24                	je     8016c3 <fd_lookup+0x42>
+  80169f:	89 c2                	mov    %eax,%edx
+  8016a1:	c1 ea 0c             	shr    $0xc,%edx
+  8016a4:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8016ab:	f6 c2 01             	test   $0x1,%dl
+  8016ae:	74 1a                	je     8016ca <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8016b0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8016b3:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8016b5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8016ba:	5d                   	pop    %ebp
+  8016bb:	c3                   	ret
+		return -E_INVAL;
+  8016bc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016c1:	eb f7                	jmp    8016ba <fd_lookup+0x39>
+		return -E_INVAL;
+  8016c3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016c8:	eb f0                	jmp    8016ba <fd_lookup+0x39>
+  8016ca:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016cf:	eb e9                	jmp    8016ba <fd_lookup+0x39>
+
+008016d1 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8016d1:	55                   	push   %ebp
+  8016d2:	89 e5                	mov    %esp,%ebp
+  8016d4:	53                   	push   %ebx
+  8016d5:	83 ec 04             	sub    $0x4,%esp
+  8016d8:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8016db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016e0:	eb 03                	jmp    8016e5 <dev_lookup+0x14>
+  8016e2:	83 c0 01             	add    $0x1,%eax
+  8016e5:	8b 1c 85 f0 33 80 00 	mov    0x8033f0(,%eax,4),%ebx
+  8016ec:	85 db                	test   %ebx,%ebx
+  8016ee:	74 0b                	je     8016fb <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8016f0:	39 13                	cmp    %edx,(%ebx)
+  8016f2:	75 ee                	jne    8016e2 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8016f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016f9:	eb 1f                	jmp    80171a <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8016fb:	a1 08 60 80 00       	mov    0x806008,%eax
+  801700:	8b 40 48             	mov    0x48(%eax),%eax
+  801703:	83 ec 04             	sub    $0x4,%esp
+  801706:	52                   	push   %edx
+  801707:	50                   	push   %eax
+  801708:	68 74 33 80 00       	push   $0x803374
+  80170d:	e8 5c ee ff ff       	call   80056e <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801712:	83 c4 10             	add    $0x10,%esp
+  801715:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80171a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80171d:	89 1a                	mov    %ebx,(%edx)
+}
+  80171f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801722:	c9                   	leave
+  801723:	c3                   	ret
+
+00801724 <fd_close>:
+{
+  801724:	55                   	push   %ebp
+  801725:	89 e5                	mov    %esp,%ebp
+  801727:	57                   	push   %edi
+  801728:	56                   	push   %esi
+  801729:	53                   	push   %ebx
+  80172a:	83 ec 24             	sub    $0x24,%esp
+  80172d:	8b 75 08             	mov    0x8(%ebp),%esi
+  801730:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801733:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801736:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801737:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80173d:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801740:	50                   	push   %eax
+  801741:	e8 3b ff ff ff       	call   801681 <fd_lookup>
+  801746:	89 c3                	mov    %eax,%ebx
+  801748:	83 c4 10             	add    $0x10,%esp
+  80174b:	85 c0                	test   %eax,%eax
+  80174d:	78 05                	js     801754 <fd_close+0x30>
+	    || fd != fd2)
+  80174f:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801752:	74 16                	je     80176a <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801754:	89 f8                	mov    %edi,%eax
+  801756:	84 c0                	test   %al,%al
+  801758:	b8 00 00 00 00       	mov    $0x0,%eax
+  80175d:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801760:	89 d8                	mov    %ebx,%eax
+  801762:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801765:	5b                   	pop    %ebx
+  801766:	5e                   	pop    %esi
+  801767:	5f                   	pop    %edi
+  801768:	5d                   	pop    %ebp
+  801769:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80176a:	83 ec 08             	sub    $0x8,%esp
+  80176d:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801770:	50                   	push   %eax
+  801771:	ff 36                	push   (%esi)
+  801773:	e8 59 ff ff ff       	call   8016d1 <dev_lookup>
+  801778:	89 c3                	mov    %eax,%ebx
+  80177a:	83 c4 10             	add    $0x10,%esp
+  80177d:	85 c0                	test   %eax,%eax
+  80177f:	78 1a                	js     80179b <fd_close+0x77>
+		if (dev->dev_close)
+  801781:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801784:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801787:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80178c:	85 c0                	test   %eax,%eax
+  80178e:	74 0b                	je     80179b <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801790:	83 ec 0c             	sub    $0xc,%esp
+  801793:	56                   	push   %esi
+  801794:	ff d0                	call   *%eax
+  801796:	89 c3                	mov    %eax,%ebx
+  801798:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80179b:	83 ec 08             	sub    $0x8,%esp
+  80179e:	56                   	push   %esi
+  80179f:	6a 00                	push   $0x0
+  8017a1:	e8 f2 f7 ff ff       	call   800f98 <sys_page_unmap>
+	return r;
+  8017a6:	83 c4 10             	add    $0x10,%esp
+  8017a9:	eb b5                	jmp    801760 <fd_close+0x3c>
+
+008017ab <close>:
+
+int
+close(int fdnum)
+{
+  8017ab:	55                   	push   %ebp
+  8017ac:	89 e5                	mov    %esp,%ebp
+  8017ae:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8017b1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017b4:	50                   	push   %eax
+  8017b5:	ff 75 08             	push   0x8(%ebp)
+  8017b8:	e8 c4 fe ff ff       	call   801681 <fd_lookup>
+  8017bd:	83 c4 10             	add    $0x10,%esp
+  8017c0:	85 c0                	test   %eax,%eax
+  8017c2:	79 02                	jns    8017c6 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8017c4:	c9                   	leave
+  8017c5:	c3                   	ret
+		return fd_close(fd, 1);
+  8017c6:	83 ec 08             	sub    $0x8,%esp
+  8017c9:	6a 01                	push   $0x1
+  8017cb:	ff 75 f4             	push   -0xc(%ebp)
+  8017ce:	e8 51 ff ff ff       	call   801724 <fd_close>
+  8017d3:	83 c4 10             	add    $0x10,%esp
+  8017d6:	eb ec                	jmp    8017c4 <close+0x19>
+
+008017d8 <close_all>:
+
+void
+close_all(void)
+{
+  8017d8:	55                   	push   %ebp
+  8017d9:	89 e5                	mov    %esp,%ebp
+  8017db:	53                   	push   %ebx
+  8017dc:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8017df:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8017e4:	83 ec 0c             	sub    $0xc,%esp
+  8017e7:	53                   	push   %ebx
+  8017e8:	e8 be ff ff ff       	call   8017ab <close>
+	for (i = 0; i < MAXFD; i++)
+  8017ed:	83 c3 01             	add    $0x1,%ebx
+  8017f0:	83 c4 10             	add    $0x10,%esp
+  8017f3:	83 fb 20             	cmp    $0x20,%ebx
+  8017f6:	75 ec                	jne    8017e4 <close_all+0xc>
+}
+  8017f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017fb:	c9                   	leave
+  8017fc:	c3                   	ret
+
+008017fd <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8017fd:	55                   	push   %ebp
+  8017fe:	89 e5                	mov    %esp,%ebp
+  801800:	57                   	push   %edi
+  801801:	56                   	push   %esi
+  801802:	53                   	push   %ebx
+  801803:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801806:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801809:	50                   	push   %eax
+  80180a:	ff 75 08             	push   0x8(%ebp)
+  80180d:	e8 6f fe ff ff       	call   801681 <fd_lookup>
+  801812:	89 c3                	mov    %eax,%ebx
+  801814:	83 c4 10             	add    $0x10,%esp
+  801817:	85 c0                	test   %eax,%eax
+  801819:	78 7f                	js     80189a <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80181b:	83 ec 0c             	sub    $0xc,%esp
+  80181e:	ff 75 0c             	push   0xc(%ebp)
+  801821:	e8 85 ff ff ff       	call   8017ab <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801826:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801829:	c1 e6 0c             	shl    $0xc,%esi
+  80182c:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801832:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801835:	89 3c 24             	mov    %edi,(%esp)
+  801838:	e8 d7 fd ff ff       	call   801614 <fd2data>
+  80183d:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80183f:	89 34 24             	mov    %esi,(%esp)
+  801842:	e8 cd fd ff ff       	call   801614 <fd2data>
+  801847:	83 c4 10             	add    $0x10,%esp
+  80184a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80184d:	89 d8                	mov    %ebx,%eax
+  80184f:	c1 e8 16             	shr    $0x16,%eax
+  801852:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801859:	a8 01                	test   $0x1,%al
+  80185b:	74 11                	je     80186e <dup+0x71>
+  80185d:	89 d8                	mov    %ebx,%eax
+  80185f:	c1 e8 0c             	shr    $0xc,%eax
+  801862:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801869:	f6 c2 01             	test   $0x1,%dl
+  80186c:	75 36                	jne    8018a4 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80186e:	89 f8                	mov    %edi,%eax
+  801870:	c1 e8 0c             	shr    $0xc,%eax
+  801873:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80187a:	83 ec 0c             	sub    $0xc,%esp
+  80187d:	25 07 0e 00 00       	and    $0xe07,%eax
+  801882:	50                   	push   %eax
+  801883:	56                   	push   %esi
+  801884:	6a 00                	push   $0x0
+  801886:	57                   	push   %edi
+  801887:	6a 00                	push   $0x0
+  801889:	e8 c8 f6 ff ff       	call   800f56 <sys_page_map>
+  80188e:	89 c3                	mov    %eax,%ebx
+  801890:	83 c4 20             	add    $0x20,%esp
+  801893:	85 c0                	test   %eax,%eax
+  801895:	78 33                	js     8018ca <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801897:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80189a:	89 d8                	mov    %ebx,%eax
+  80189c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80189f:	5b                   	pop    %ebx
+  8018a0:	5e                   	pop    %esi
+  8018a1:	5f                   	pop    %edi
+  8018a2:	5d                   	pop    %ebp
+  8018a3:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8018a4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8018ab:	83 ec 0c             	sub    $0xc,%esp
+  8018ae:	25 07 0e 00 00       	and    $0xe07,%eax
+  8018b3:	50                   	push   %eax
+  8018b4:	ff 75 d4             	push   -0x2c(%ebp)
+  8018b7:	6a 00                	push   $0x0
+  8018b9:	53                   	push   %ebx
+  8018ba:	6a 00                	push   $0x0
+  8018bc:	e8 95 f6 ff ff       	call   800f56 <sys_page_map>
+  8018c1:	89 c3                	mov    %eax,%ebx
+  8018c3:	83 c4 20             	add    $0x20,%esp
+  8018c6:	85 c0                	test   %eax,%eax
+  8018c8:	79 a4                	jns    80186e <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8018ca:	83 ec 08             	sub    $0x8,%esp
+  8018cd:	56                   	push   %esi
+  8018ce:	6a 00                	push   $0x0
+  8018d0:	e8 c3 f6 ff ff       	call   800f98 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8018d5:	83 c4 08             	add    $0x8,%esp
+  8018d8:	ff 75 d4             	push   -0x2c(%ebp)
+  8018db:	6a 00                	push   $0x0
+  8018dd:	e8 b6 f6 ff ff       	call   800f98 <sys_page_unmap>
+	return r;
+  8018e2:	83 c4 10             	add    $0x10,%esp
+  8018e5:	eb b3                	jmp    80189a <dup+0x9d>
+
+008018e7 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8018e7:	55                   	push   %ebp
+  8018e8:	89 e5                	mov    %esp,%ebp
+  8018ea:	56                   	push   %esi
+  8018eb:	53                   	push   %ebx
+  8018ec:	83 ec 18             	sub    $0x18,%esp
+  8018ef:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018f2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018f5:	50                   	push   %eax
+  8018f6:	56                   	push   %esi
+  8018f7:	e8 85 fd ff ff       	call   801681 <fd_lookup>
+  8018fc:	83 c4 10             	add    $0x10,%esp
+  8018ff:	85 c0                	test   %eax,%eax
+  801901:	78 3c                	js     80193f <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801903:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801906:	83 ec 08             	sub    $0x8,%esp
+  801909:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80190c:	50                   	push   %eax
+  80190d:	ff 33                	push   (%ebx)
+  80190f:	e8 bd fd ff ff       	call   8016d1 <dev_lookup>
+  801914:	83 c4 10             	add    $0x10,%esp
+  801917:	85 c0                	test   %eax,%eax
+  801919:	78 24                	js     80193f <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80191b:	8b 43 08             	mov    0x8(%ebx),%eax
+  80191e:	83 e0 03             	and    $0x3,%eax
+  801921:	83 f8 01             	cmp    $0x1,%eax
+  801924:	74 20                	je     801946 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801926:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801929:	8b 40 08             	mov    0x8(%eax),%eax
+  80192c:	85 c0                	test   %eax,%eax
+  80192e:	74 37                	je     801967 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801930:	83 ec 04             	sub    $0x4,%esp
+  801933:	ff 75 10             	push   0x10(%ebp)
+  801936:	ff 75 0c             	push   0xc(%ebp)
+  801939:	53                   	push   %ebx
+  80193a:	ff d0                	call   *%eax
+  80193c:	83 c4 10             	add    $0x10,%esp
+}
+  80193f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801942:	5b                   	pop    %ebx
+  801943:	5e                   	pop    %esi
+  801944:	5d                   	pop    %ebp
+  801945:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801946:	a1 08 60 80 00       	mov    0x806008,%eax
+  80194b:	8b 40 48             	mov    0x48(%eax),%eax
+  80194e:	83 ec 04             	sub    $0x4,%esp
+  801951:	56                   	push   %esi
+  801952:	50                   	push   %eax
+  801953:	68 b5 33 80 00       	push   $0x8033b5
+  801958:	e8 11 ec ff ff       	call   80056e <cprintf>
+		return -E_INVAL;
+  80195d:	83 c4 10             	add    $0x10,%esp
+  801960:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801965:	eb d8                	jmp    80193f <read+0x58>
+		return -E_NOT_SUPP;
+  801967:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80196c:	eb d1                	jmp    80193f <read+0x58>
+
+0080196e <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80196e:	55                   	push   %ebp
+  80196f:	89 e5                	mov    %esp,%ebp
+  801971:	57                   	push   %edi
+  801972:	56                   	push   %esi
+  801973:	53                   	push   %ebx
+  801974:	83 ec 0c             	sub    $0xc,%esp
+  801977:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80197a:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80197d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801982:	eb 02                	jmp    801986 <readn+0x18>
+  801984:	01 c3                	add    %eax,%ebx
+  801986:	39 f3                	cmp    %esi,%ebx
+  801988:	73 21                	jae    8019ab <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80198a:	83 ec 04             	sub    $0x4,%esp
+  80198d:	89 f0                	mov    %esi,%eax
+  80198f:	29 d8                	sub    %ebx,%eax
+  801991:	50                   	push   %eax
+  801992:	89 d8                	mov    %ebx,%eax
+  801994:	03 45 0c             	add    0xc(%ebp),%eax
+  801997:	50                   	push   %eax
+  801998:	57                   	push   %edi
+  801999:	e8 49 ff ff ff       	call   8018e7 <read>
+		if (m < 0)
+  80199e:	83 c4 10             	add    $0x10,%esp
+  8019a1:	85 c0                	test   %eax,%eax
+  8019a3:	78 04                	js     8019a9 <readn+0x3b>
+			return m;
+		if (m == 0)
+  8019a5:	75 dd                	jne    801984 <readn+0x16>
+  8019a7:	eb 02                	jmp    8019ab <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8019a9:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8019ab:	89 d8                	mov    %ebx,%eax
+  8019ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019b0:	5b                   	pop    %ebx
+  8019b1:	5e                   	pop    %esi
+  8019b2:	5f                   	pop    %edi
+  8019b3:	5d                   	pop    %ebp
+  8019b4:	c3                   	ret
+
+008019b5 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8019b5:	55                   	push   %ebp
+  8019b6:	89 e5                	mov    %esp,%ebp
+  8019b8:	56                   	push   %esi
+  8019b9:	53                   	push   %ebx
+  8019ba:	83 ec 18             	sub    $0x18,%esp
+  8019bd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8019c0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8019c3:	50                   	push   %eax
+  8019c4:	53                   	push   %ebx
+  8019c5:	e8 b7 fc ff ff       	call   801681 <fd_lookup>
+  8019ca:	83 c4 10             	add    $0x10,%esp
+  8019cd:	85 c0                	test   %eax,%eax
+  8019cf:	78 37                	js     801a08 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8019d1:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8019d4:	83 ec 08             	sub    $0x8,%esp
+  8019d7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019da:	50                   	push   %eax
+  8019db:	ff 36                	push   (%esi)
+  8019dd:	e8 ef fc ff ff       	call   8016d1 <dev_lookup>
+  8019e2:	83 c4 10             	add    $0x10,%esp
+  8019e5:	85 c0                	test   %eax,%eax
+  8019e7:	78 1f                	js     801a08 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8019e9:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8019ed:	74 20                	je     801a0f <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8019ef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019f2:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019f5:	85 c0                	test   %eax,%eax
+  8019f7:	74 37                	je     801a30 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8019f9:	83 ec 04             	sub    $0x4,%esp
+  8019fc:	ff 75 10             	push   0x10(%ebp)
+  8019ff:	ff 75 0c             	push   0xc(%ebp)
+  801a02:	56                   	push   %esi
+  801a03:	ff d0                	call   *%eax
+  801a05:	83 c4 10             	add    $0x10,%esp
+}
+  801a08:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a0b:	5b                   	pop    %ebx
+  801a0c:	5e                   	pop    %esi
+  801a0d:	5d                   	pop    %ebp
+  801a0e:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801a0f:	a1 08 60 80 00       	mov    0x806008,%eax
+  801a14:	8b 40 48             	mov    0x48(%eax),%eax
+  801a17:	83 ec 04             	sub    $0x4,%esp
+  801a1a:	53                   	push   %ebx
+  801a1b:	50                   	push   %eax
+  801a1c:	68 d1 33 80 00       	push   $0x8033d1
+  801a21:	e8 48 eb ff ff       	call   80056e <cprintf>
+		return -E_INVAL;
+  801a26:	83 c4 10             	add    $0x10,%esp
+  801a29:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a2e:	eb d8                	jmp    801a08 <write+0x53>
+		return -E_NOT_SUPP;
+  801a30:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a35:	eb d1                	jmp    801a08 <write+0x53>
+
+00801a37 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801a37:	55                   	push   %ebp
+  801a38:	89 e5                	mov    %esp,%ebp
+  801a3a:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801a3d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a40:	50                   	push   %eax
+  801a41:	ff 75 08             	push   0x8(%ebp)
+  801a44:	e8 38 fc ff ff       	call   801681 <fd_lookup>
+  801a49:	83 c4 10             	add    $0x10,%esp
+  801a4c:	85 c0                	test   %eax,%eax
+  801a4e:	78 0e                	js     801a5e <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801a50:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a53:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a56:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801a59:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a5e:	c9                   	leave
+  801a5f:	c3                   	ret
+
+00801a60 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801a60:	55                   	push   %ebp
+  801a61:	89 e5                	mov    %esp,%ebp
+  801a63:	56                   	push   %esi
+  801a64:	53                   	push   %ebx
+  801a65:	83 ec 18             	sub    $0x18,%esp
+  801a68:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a6b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a6e:	50                   	push   %eax
+  801a6f:	53                   	push   %ebx
+  801a70:	e8 0c fc ff ff       	call   801681 <fd_lookup>
+  801a75:	83 c4 10             	add    $0x10,%esp
+  801a78:	85 c0                	test   %eax,%eax
+  801a7a:	78 34                	js     801ab0 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801a7c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a7f:	83 ec 08             	sub    $0x8,%esp
+  801a82:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a85:	50                   	push   %eax
+  801a86:	ff 36                	push   (%esi)
+  801a88:	e8 44 fc ff ff       	call   8016d1 <dev_lookup>
+  801a8d:	83 c4 10             	add    $0x10,%esp
+  801a90:	85 c0                	test   %eax,%eax
+  801a92:	78 1c                	js     801ab0 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801a94:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801a98:	74 1d                	je     801ab7 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801a9a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a9d:	8b 40 18             	mov    0x18(%eax),%eax
+  801aa0:	85 c0                	test   %eax,%eax
+  801aa2:	74 34                	je     801ad8 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801aa4:	83 ec 08             	sub    $0x8,%esp
+  801aa7:	ff 75 0c             	push   0xc(%ebp)
+  801aaa:	56                   	push   %esi
+  801aab:	ff d0                	call   *%eax
+  801aad:	83 c4 10             	add    $0x10,%esp
+}
+  801ab0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ab3:	5b                   	pop    %ebx
+  801ab4:	5e                   	pop    %esi
+  801ab5:	5d                   	pop    %ebp
+  801ab6:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801ab7:	a1 08 60 80 00       	mov    0x806008,%eax
+  801abc:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801abf:	83 ec 04             	sub    $0x4,%esp
+  801ac2:	53                   	push   %ebx
+  801ac3:	50                   	push   %eax
+  801ac4:	68 94 33 80 00       	push   $0x803394
+  801ac9:	e8 a0 ea ff ff       	call   80056e <cprintf>
+		return -E_INVAL;
+  801ace:	83 c4 10             	add    $0x10,%esp
+  801ad1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ad6:	eb d8                	jmp    801ab0 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801ad8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801add:	eb d1                	jmp    801ab0 <ftruncate+0x50>
+
+00801adf <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801adf:	55                   	push   %ebp
+  801ae0:	89 e5                	mov    %esp,%ebp
+  801ae2:	56                   	push   %esi
+  801ae3:	53                   	push   %ebx
+  801ae4:	83 ec 18             	sub    $0x18,%esp
+  801ae7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801aea:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801aed:	50                   	push   %eax
+  801aee:	ff 75 08             	push   0x8(%ebp)
+  801af1:	e8 8b fb ff ff       	call   801681 <fd_lookup>
+  801af6:	83 c4 10             	add    $0x10,%esp
+  801af9:	85 c0                	test   %eax,%eax
+  801afb:	78 49                	js     801b46 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801afd:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b00:	83 ec 08             	sub    $0x8,%esp
+  801b03:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b06:	50                   	push   %eax
+  801b07:	ff 36                	push   (%esi)
+  801b09:	e8 c3 fb ff ff       	call   8016d1 <dev_lookup>
+  801b0e:	83 c4 10             	add    $0x10,%esp
+  801b11:	85 c0                	test   %eax,%eax
+  801b13:	78 31                	js     801b46 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801b15:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b18:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801b1c:	74 2f                	je     801b4d <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801b1e:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801b21:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801b28:	00 00 00 
+	stat->st_isdir = 0;
+  801b2b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801b32:	00 00 00 
+	stat->st_dev = dev;
+  801b35:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801b3b:	83 ec 08             	sub    $0x8,%esp
+  801b3e:	53                   	push   %ebx
+  801b3f:	56                   	push   %esi
+  801b40:	ff 50 14             	call   *0x14(%eax)
+  801b43:	83 c4 10             	add    $0x10,%esp
+}
+  801b46:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b49:	5b                   	pop    %ebx
+  801b4a:	5e                   	pop    %esi
+  801b4b:	5d                   	pop    %ebp
+  801b4c:	c3                   	ret
+		return -E_NOT_SUPP;
+  801b4d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b52:	eb f2                	jmp    801b46 <fstat+0x67>
+
+00801b54 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801b54:	55                   	push   %ebp
+  801b55:	89 e5                	mov    %esp,%ebp
+  801b57:	56                   	push   %esi
+  801b58:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801b59:	83 ec 08             	sub    $0x8,%esp
+  801b5c:	6a 00                	push   $0x0
+  801b5e:	ff 75 08             	push   0x8(%ebp)
+  801b61:	e8 e4 01 00 00       	call   801d4a <open>
+  801b66:	89 c3                	mov    %eax,%ebx
+  801b68:	83 c4 10             	add    $0x10,%esp
+  801b6b:	85 c0                	test   %eax,%eax
+  801b6d:	78 1b                	js     801b8a <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801b6f:	83 ec 08             	sub    $0x8,%esp
+  801b72:	ff 75 0c             	push   0xc(%ebp)
+  801b75:	50                   	push   %eax
+  801b76:	e8 64 ff ff ff       	call   801adf <fstat>
+  801b7b:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801b7d:	89 1c 24             	mov    %ebx,(%esp)
+  801b80:	e8 26 fc ff ff       	call   8017ab <close>
+	return r;
+  801b85:	83 c4 10             	add    $0x10,%esp
+  801b88:	89 f3                	mov    %esi,%ebx
+}
+  801b8a:	89 d8                	mov    %ebx,%eax
+  801b8c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b8f:	5b                   	pop    %ebx
+  801b90:	5e                   	pop    %esi
+  801b91:	5d                   	pop    %ebp
+  801b92:	c3                   	ret
+
+00801b93 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  801b93:	55                   	push   %ebp
+  801b94:	89 e5                	mov    %esp,%ebp
+  801b96:	56                   	push   %esi
+  801b97:	53                   	push   %ebx
+  801b98:	89 c6                	mov    %eax,%esi
+  801b9a:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  801b9c:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  801ba3:	74 27                	je     801bcc <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801ba5:	6a 07                	push   $0x7
+  801ba7:	68 00 70 80 00       	push   $0x807000
+  801bac:	56                   	push   %esi
+  801bad:	ff 35 00 60 80 00    	push   0x806000
+  801bb3:	e8 b9 f9 ff ff       	call   801571 <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  801bb8:	83 c4 0c             	add    $0xc,%esp
+  801bbb:	6a 00                	push   $0x0
+  801bbd:	53                   	push   %ebx
+  801bbe:	6a 00                	push   $0x0
+  801bc0:	e8 38 f9 ff ff       	call   8014fd <ipc_recv>
+}
+  801bc5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bc8:	5b                   	pop    %ebx
+  801bc9:	5e                   	pop    %esi
+  801bca:	5d                   	pop    %ebp
+  801bcb:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  801bcc:	83 ec 0c             	sub    $0xc,%esp
+  801bcf:	6a 01                	push   $0x1
+  801bd1:	e8 ef f9 ff ff       	call   8015c5 <ipc_find_env>
+  801bd6:	a3 00 60 80 00       	mov    %eax,0x806000
+  801bdb:	83 c4 10             	add    $0x10,%esp
+  801bde:	eb c5                	jmp    801ba5 <fsipc+0x12>
+
+00801be0 <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801be0:	55                   	push   %ebp
+  801be1:	89 e5                	mov    %esp,%ebp
+  801be3:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801be6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801be9:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bec:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.set_size.req_size = newsize;
+  801bf1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801bf4:	a3 04 70 80 00       	mov    %eax,0x807004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801bf9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bfe:	b8 02 00 00 00       	mov    $0x2,%eax
+  801c03:	e8 8b ff ff ff       	call   801b93 <fsipc>
+}
+  801c08:	c9                   	leave
+  801c09:	c3                   	ret
+
+00801c0a <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801c0a:	55                   	push   %ebp
+  801c0b:	89 e5                	mov    %esp,%ebp
+  801c0d:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801c10:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c13:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c16:	a3 00 70 80 00       	mov    %eax,0x807000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801c1b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c20:	b8 06 00 00 00       	mov    $0x6,%eax
+  801c25:	e8 69 ff ff ff       	call   801b93 <fsipc>
+}
+  801c2a:	c9                   	leave
+  801c2b:	c3                   	ret
+
+00801c2c <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801c2c:	55                   	push   %ebp
+  801c2d:	89 e5                	mov    %esp,%ebp
+  801c2f:	53                   	push   %ebx
+  801c30:	83 ec 04             	sub    $0x4,%esp
+  801c33:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801c36:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c39:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c3c:	a3 00 70 80 00       	mov    %eax,0x807000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801c41:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c46:	b8 05 00 00 00       	mov    $0x5,%eax
+  801c4b:	e8 43 ff ff ff       	call   801b93 <fsipc>
+  801c50:	85 c0                	test   %eax,%eax
+  801c52:	78 2c                	js     801c80 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801c54:	83 ec 08             	sub    $0x8,%esp
+  801c57:	68 00 70 80 00       	push   $0x807000
+  801c5c:	53                   	push   %ebx
+  801c5d:	e8 c5 ee ff ff       	call   800b27 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801c62:	a1 80 70 80 00       	mov    0x807080,%eax
+  801c67:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801c6d:	a1 84 70 80 00       	mov    0x807084,%eax
+  801c72:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801c78:	83 c4 10             	add    $0x10,%esp
+  801c7b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c80:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c83:	c9                   	leave
+  801c84:	c3                   	ret
+
+00801c85 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801c85:	55                   	push   %ebp
+  801c86:	89 e5                	mov    %esp,%ebp
+  801c88:	83 ec 0c             	sub    $0xc,%esp
+  801c8b:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801c8e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c91:	8b 52 0c             	mov    0xc(%edx),%edx
+  801c94:	89 15 00 70 80 00    	mov    %edx,0x807000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801c9a:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801c9f:	39 d0                	cmp    %edx,%eax
+  801ca1:	0f 47 c2             	cmova  %edx,%eax
+  801ca4:	a3 04 70 80 00       	mov    %eax,0x807004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  801ca9:	50                   	push   %eax
+  801caa:	ff 75 0c             	push   0xc(%ebp)
+  801cad:	68 08 70 80 00       	push   $0x807008
+  801cb2:	e8 f6 ef ff ff       	call   800cad <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801cb7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cbc:	b8 04 00 00 00       	mov    $0x4,%eax
+  801cc1:	e8 cd fe ff ff       	call   801b93 <fsipc>
+}
+  801cc6:	c9                   	leave
+  801cc7:	c3                   	ret
+
+00801cc8 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801cc8:	55                   	push   %ebp
+  801cc9:	89 e5                	mov    %esp,%ebp
+  801ccb:	56                   	push   %esi
+  801ccc:	53                   	push   %ebx
+  801ccd:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801cd0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cd3:	8b 40 0c             	mov    0xc(%eax),%eax
+  801cd6:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.read.req_n = n;
+  801cdb:	89 35 04 70 80 00    	mov    %esi,0x807004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801ce1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ce6:	b8 03 00 00 00       	mov    $0x3,%eax
+  801ceb:	e8 a3 fe ff ff       	call   801b93 <fsipc>
+  801cf0:	89 c3                	mov    %eax,%ebx
+  801cf2:	85 c0                	test   %eax,%eax
+  801cf4:	78 1f                	js     801d15 <devfile_read+0x4d>
+  assert(r <= n);
+  801cf6:	39 c6                	cmp    %eax,%esi
+  801cf8:	72 24                	jb     801d1e <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  801cfa:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801cff:	7f 33                	jg     801d34 <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801d01:	83 ec 04             	sub    $0x4,%esp
+  801d04:	50                   	push   %eax
+  801d05:	68 00 70 80 00       	push   $0x807000
+  801d0a:	ff 75 0c             	push   0xc(%ebp)
+  801d0d:	e8 9b ef ff ff       	call   800cad <memmove>
+  return r;
+  801d12:	83 c4 10             	add    $0x10,%esp
+}
+  801d15:	89 d8                	mov    %ebx,%eax
+  801d17:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d1a:	5b                   	pop    %ebx
+  801d1b:	5e                   	pop    %esi
+  801d1c:	5d                   	pop    %ebp
+  801d1d:	c3                   	ret
+  assert(r <= n);
+  801d1e:	68 04 34 80 00       	push   $0x803404
+  801d23:	68 11 2d 80 00       	push   $0x802d11
+  801d28:	6a 78                	push   $0x78
+  801d2a:	68 0b 34 80 00       	push   $0x80340b
+  801d2f:	e8 5f e7 ff ff       	call   800493 <_panic>
+  assert(r <= PGSIZE);
+  801d34:	68 16 34 80 00       	push   $0x803416
+  801d39:	68 11 2d 80 00       	push   $0x802d11
+  801d3e:	6a 79                	push   $0x79
+  801d40:	68 0b 34 80 00       	push   $0x80340b
+  801d45:	e8 49 e7 ff ff       	call   800493 <_panic>
+
+00801d4a <open>:
+open(const char *path, int mode) {
+  801d4a:	55                   	push   %ebp
+  801d4b:	89 e5                	mov    %esp,%ebp
+  801d4d:	56                   	push   %esi
+  801d4e:	53                   	push   %ebx
+  801d4f:	83 ec 1c             	sub    $0x1c,%esp
+  801d52:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801d55:	56                   	push   %esi
+  801d56:	e8 91 ed ff ff       	call   800aec <strlen>
+  801d5b:	83 c4 10             	add    $0x10,%esp
+  801d5e:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801d63:	7f 6c                	jg     801dd1 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801d65:	83 ec 0c             	sub    $0xc,%esp
+  801d68:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d6b:	50                   	push   %eax
+  801d6c:	e8 ba f8 ff ff       	call   80162b <fd_alloc>
+  801d71:	89 c3                	mov    %eax,%ebx
+  801d73:	83 c4 10             	add    $0x10,%esp
+  801d76:	85 c0                	test   %eax,%eax
+  801d78:	78 3c                	js     801db6 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801d7a:	83 ec 08             	sub    $0x8,%esp
+  801d7d:	56                   	push   %esi
+  801d7e:	68 00 70 80 00       	push   $0x807000
+  801d83:	e8 9f ed ff ff       	call   800b27 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801d88:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d8b:	a3 00 74 80 00       	mov    %eax,0x807400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801d90:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801d93:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d98:	e8 f6 fd ff ff       	call   801b93 <fsipc>
+  801d9d:	89 c3                	mov    %eax,%ebx
+  801d9f:	83 c4 10             	add    $0x10,%esp
+  801da2:	85 c0                	test   %eax,%eax
+  801da4:	78 19                	js     801dbf <open+0x75>
+  return fd2num(fd);
+  801da6:	83 ec 0c             	sub    $0xc,%esp
+  801da9:	ff 75 f4             	push   -0xc(%ebp)
+  801dac:	e8 53 f8 ff ff       	call   801604 <fd2num>
+  801db1:	89 c3                	mov    %eax,%ebx
+  801db3:	83 c4 10             	add    $0x10,%esp
+}
+  801db6:	89 d8                	mov    %ebx,%eax
+  801db8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dbb:	5b                   	pop    %ebx
+  801dbc:	5e                   	pop    %esi
+  801dbd:	5d                   	pop    %ebp
+  801dbe:	c3                   	ret
+    fd_close(fd, 0);
+  801dbf:	83 ec 08             	sub    $0x8,%esp
+  801dc2:	6a 00                	push   $0x0
+  801dc4:	ff 75 f4             	push   -0xc(%ebp)
+  801dc7:	e8 58 f9 ff ff       	call   801724 <fd_close>
+    return r;
+  801dcc:	83 c4 10             	add    $0x10,%esp
+  801dcf:	eb e5                	jmp    801db6 <open+0x6c>
+    return -E_BAD_PATH;
+  801dd1:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801dd6:	eb de                	jmp    801db6 <open+0x6c>
+
+00801dd8 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  801dd8:	55                   	push   %ebp
+  801dd9:	89 e5                	mov    %esp,%ebp
+  801ddb:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801dde:	ba 00 00 00 00       	mov    $0x0,%edx
+  801de3:	b8 08 00 00 00       	mov    $0x8,%eax
+  801de8:	e8 a6 fd ff ff       	call   801b93 <fsipc>
+}
+  801ded:	c9                   	leave
+  801dee:	c3                   	ret
+
+00801def <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801def:	55                   	push   %ebp
+  801df0:	89 e5                	mov    %esp,%ebp
+  801df2:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801df5:	68 22 34 80 00       	push   $0x803422
+  801dfa:	ff 75 0c             	push   0xc(%ebp)
+  801dfd:	e8 25 ed ff ff       	call   800b27 <strcpy>
+	return 0;
+}
+  801e02:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e07:	c9                   	leave
+  801e08:	c3                   	ret
+
+00801e09 <devsock_close>:
+{
+  801e09:	55                   	push   %ebp
+  801e0a:	89 e5                	mov    %esp,%ebp
+  801e0c:	53                   	push   %ebx
+  801e0d:	83 ec 10             	sub    $0x10,%esp
+  801e10:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801e13:	53                   	push   %ebx
+  801e14:	e8 dc 09 00 00       	call   8027f5 <pageref>
+  801e19:	89 c2                	mov    %eax,%edx
+  801e1b:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801e1e:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801e23:	83 fa 01             	cmp    $0x1,%edx
+  801e26:	74 05                	je     801e2d <devsock_close+0x24>
+}
+  801e28:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e2b:	c9                   	leave
+  801e2c:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801e2d:	83 ec 0c             	sub    $0xc,%esp
+  801e30:	ff 73 0c             	push   0xc(%ebx)
+  801e33:	e8 b7 02 00 00       	call   8020ef <nsipc_close>
+  801e38:	83 c4 10             	add    $0x10,%esp
+  801e3b:	eb eb                	jmp    801e28 <devsock_close+0x1f>
+
+00801e3d <devsock_write>:
+{
+  801e3d:	55                   	push   %ebp
+  801e3e:	89 e5                	mov    %esp,%ebp
+  801e40:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801e43:	6a 00                	push   $0x0
+  801e45:	ff 75 10             	push   0x10(%ebp)
+  801e48:	ff 75 0c             	push   0xc(%ebp)
+  801e4b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e4e:	ff 70 0c             	push   0xc(%eax)
+  801e51:	e8 79 03 00 00       	call   8021cf <nsipc_send>
+}
+  801e56:	c9                   	leave
+  801e57:	c3                   	ret
+
+00801e58 <devsock_read>:
+{
+  801e58:	55                   	push   %ebp
+  801e59:	89 e5                	mov    %esp,%ebp
+  801e5b:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801e5e:	6a 00                	push   $0x0
+  801e60:	ff 75 10             	push   0x10(%ebp)
+  801e63:	ff 75 0c             	push   0xc(%ebp)
+  801e66:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e69:	ff 70 0c             	push   0xc(%eax)
+  801e6c:	e8 ef 02 00 00       	call   802160 <nsipc_recv>
+}
+  801e71:	c9                   	leave
+  801e72:	c3                   	ret
+
+00801e73 <fd2sockid>:
+{
+  801e73:	55                   	push   %ebp
+  801e74:	89 e5                	mov    %esp,%ebp
+  801e76:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801e79:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801e7c:	52                   	push   %edx
+  801e7d:	50                   	push   %eax
+  801e7e:	e8 fe f7 ff ff       	call   801681 <fd_lookup>
+  801e83:	83 c4 10             	add    $0x10,%esp
+  801e86:	85 c0                	test   %eax,%eax
+  801e88:	78 10                	js     801e9a <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801e8a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e8d:	8b 0d 48 50 80 00    	mov    0x805048,%ecx
+  801e93:	39 08                	cmp    %ecx,(%eax)
+  801e95:	75 05                	jne    801e9c <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801e97:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801e9a:	c9                   	leave
+  801e9b:	c3                   	ret
+		return -E_NOT_SUPP;
+  801e9c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ea1:	eb f7                	jmp    801e9a <fd2sockid+0x27>
+
+00801ea3 <alloc_sockfd>:
+{
+  801ea3:	55                   	push   %ebp
+  801ea4:	89 e5                	mov    %esp,%ebp
+  801ea6:	56                   	push   %esi
+  801ea7:	53                   	push   %ebx
+  801ea8:	83 ec 1c             	sub    $0x1c,%esp
+  801eab:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801ead:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801eb0:	50                   	push   %eax
+  801eb1:	e8 75 f7 ff ff       	call   80162b <fd_alloc>
+  801eb6:	89 c3                	mov    %eax,%ebx
+  801eb8:	83 c4 10             	add    $0x10,%esp
+  801ebb:	85 c0                	test   %eax,%eax
+  801ebd:	78 43                	js     801f02 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801ebf:	83 ec 04             	sub    $0x4,%esp
+  801ec2:	68 07 04 00 00       	push   $0x407
+  801ec7:	ff 75 f4             	push   -0xc(%ebp)
+  801eca:	6a 00                	push   $0x0
+  801ecc:	e8 42 f0 ff ff       	call   800f13 <sys_page_alloc>
+  801ed1:	89 c3                	mov    %eax,%ebx
+  801ed3:	83 c4 10             	add    $0x10,%esp
+  801ed6:	85 c0                	test   %eax,%eax
+  801ed8:	78 28                	js     801f02 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801eda:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801edd:	8b 15 48 50 80 00    	mov    0x805048,%edx
+  801ee3:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801ee5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ee8:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801eef:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801ef2:	83 ec 0c             	sub    $0xc,%esp
+  801ef5:	50                   	push   %eax
+  801ef6:	e8 09 f7 ff ff       	call   801604 <fd2num>
+  801efb:	89 c3                	mov    %eax,%ebx
+  801efd:	83 c4 10             	add    $0x10,%esp
+  801f00:	eb 0c                	jmp    801f0e <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801f02:	83 ec 0c             	sub    $0xc,%esp
+  801f05:	56                   	push   %esi
+  801f06:	e8 e4 01 00 00       	call   8020ef <nsipc_close>
+		return r;
+  801f0b:	83 c4 10             	add    $0x10,%esp
+}
+  801f0e:	89 d8                	mov    %ebx,%eax
+  801f10:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f13:	5b                   	pop    %ebx
+  801f14:	5e                   	pop    %esi
+  801f15:	5d                   	pop    %ebp
+  801f16:	c3                   	ret
+
+00801f17 <accept>:
+{
+  801f17:	55                   	push   %ebp
+  801f18:	89 e5                	mov    %esp,%ebp
+  801f1a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801f1d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f20:	e8 4e ff ff ff       	call   801e73 <fd2sockid>
+  801f25:	85 c0                	test   %eax,%eax
+  801f27:	78 1b                	js     801f44 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801f29:	83 ec 04             	sub    $0x4,%esp
+  801f2c:	ff 75 10             	push   0x10(%ebp)
+  801f2f:	ff 75 0c             	push   0xc(%ebp)
+  801f32:	50                   	push   %eax
+  801f33:	e8 0e 01 00 00       	call   802046 <nsipc_accept>
+  801f38:	83 c4 10             	add    $0x10,%esp
+  801f3b:	85 c0                	test   %eax,%eax
+  801f3d:	78 05                	js     801f44 <accept+0x2d>
+	return alloc_sockfd(r);
+  801f3f:	e8 5f ff ff ff       	call   801ea3 <alloc_sockfd>
+}
+  801f44:	c9                   	leave
+  801f45:	c3                   	ret
+
+00801f46 <bind>:
+{
+  801f46:	55                   	push   %ebp
+  801f47:	89 e5                	mov    %esp,%ebp
+  801f49:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801f4c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f4f:	e8 1f ff ff ff       	call   801e73 <fd2sockid>
+  801f54:	85 c0                	test   %eax,%eax
+  801f56:	78 12                	js     801f6a <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801f58:	83 ec 04             	sub    $0x4,%esp
+  801f5b:	ff 75 10             	push   0x10(%ebp)
+  801f5e:	ff 75 0c             	push   0xc(%ebp)
+  801f61:	50                   	push   %eax
+  801f62:	e8 31 01 00 00       	call   802098 <nsipc_bind>
+  801f67:	83 c4 10             	add    $0x10,%esp
+}
+  801f6a:	c9                   	leave
+  801f6b:	c3                   	ret
+
+00801f6c <shutdown>:
+{
+  801f6c:	55                   	push   %ebp
+  801f6d:	89 e5                	mov    %esp,%ebp
+  801f6f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801f72:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f75:	e8 f9 fe ff ff       	call   801e73 <fd2sockid>
+  801f7a:	85 c0                	test   %eax,%eax
+  801f7c:	78 0f                	js     801f8d <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801f7e:	83 ec 08             	sub    $0x8,%esp
+  801f81:	ff 75 0c             	push   0xc(%ebp)
+  801f84:	50                   	push   %eax
+  801f85:	e8 43 01 00 00       	call   8020cd <nsipc_shutdown>
+  801f8a:	83 c4 10             	add    $0x10,%esp
+}
+  801f8d:	c9                   	leave
+  801f8e:	c3                   	ret
+
+00801f8f <connect>:
+{
+  801f8f:	55                   	push   %ebp
+  801f90:	89 e5                	mov    %esp,%ebp
+  801f92:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801f95:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f98:	e8 d6 fe ff ff       	call   801e73 <fd2sockid>
+  801f9d:	85 c0                	test   %eax,%eax
+  801f9f:	78 12                	js     801fb3 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801fa1:	83 ec 04             	sub    $0x4,%esp
+  801fa4:	ff 75 10             	push   0x10(%ebp)
+  801fa7:	ff 75 0c             	push   0xc(%ebp)
+  801faa:	50                   	push   %eax
+  801fab:	e8 59 01 00 00       	call   802109 <nsipc_connect>
+  801fb0:	83 c4 10             	add    $0x10,%esp
+}
+  801fb3:	c9                   	leave
+  801fb4:	c3                   	ret
+
+00801fb5 <listen>:
+{
+  801fb5:	55                   	push   %ebp
+  801fb6:	89 e5                	mov    %esp,%ebp
+  801fb8:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801fbb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fbe:	e8 b0 fe ff ff       	call   801e73 <fd2sockid>
+  801fc3:	85 c0                	test   %eax,%eax
+  801fc5:	78 0f                	js     801fd6 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801fc7:	83 ec 08             	sub    $0x8,%esp
+  801fca:	ff 75 0c             	push   0xc(%ebp)
+  801fcd:	50                   	push   %eax
+  801fce:	e8 6b 01 00 00       	call   80213e <nsipc_listen>
+  801fd3:	83 c4 10             	add    $0x10,%esp
+}
+  801fd6:	c9                   	leave
+  801fd7:	c3                   	ret
+
+00801fd8 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801fd8:	55                   	push   %ebp
+  801fd9:	89 e5                	mov    %esp,%ebp
+  801fdb:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801fde:	ff 75 10             	push   0x10(%ebp)
+  801fe1:	ff 75 0c             	push   0xc(%ebp)
+  801fe4:	ff 75 08             	push   0x8(%ebp)
+  801fe7:	e8 41 02 00 00       	call   80222d <nsipc_socket>
+  801fec:	83 c4 10             	add    $0x10,%esp
+  801fef:	85 c0                	test   %eax,%eax
+  801ff1:	78 05                	js     801ff8 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801ff3:	e8 ab fe ff ff       	call   801ea3 <alloc_sockfd>
+}
+  801ff8:	c9                   	leave
+  801ff9:	c3                   	ret
+
+00801ffa <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801ffa:	55                   	push   %ebp
+  801ffb:	89 e5                	mov    %esp,%ebp
+  801ffd:	53                   	push   %ebx
+  801ffe:	83 ec 04             	sub    $0x4,%esp
+  802001:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802003:	83 3d 04 60 80 00 00 	cmpl   $0x0,0x806004
+  80200a:	74 26                	je     802032 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  80200c:	6a 07                	push   $0x7
+  80200e:	68 00 80 80 00       	push   $0x808000
+  802013:	53                   	push   %ebx
+  802014:	ff 35 04 60 80 00    	push   0x806004
+  80201a:	e8 52 f5 ff ff       	call   801571 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  80201f:	83 c4 0c             	add    $0xc,%esp
+  802022:	6a 00                	push   $0x0
+  802024:	6a 00                	push   $0x0
+  802026:	6a 00                	push   $0x0
+  802028:	e8 d0 f4 ff ff       	call   8014fd <ipc_recv>
+}
+  80202d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802030:	c9                   	leave
+  802031:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802032:	83 ec 0c             	sub    $0xc,%esp
+  802035:	6a 02                	push   $0x2
+  802037:	e8 89 f5 ff ff       	call   8015c5 <ipc_find_env>
+  80203c:	a3 04 60 80 00       	mov    %eax,0x806004
+  802041:	83 c4 10             	add    $0x10,%esp
+  802044:	eb c6                	jmp    80200c <nsipc+0x12>
+
+00802046 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802046:	55                   	push   %ebp
+  802047:	89 e5                	mov    %esp,%ebp
+  802049:	56                   	push   %esi
+  80204a:	53                   	push   %ebx
+  80204b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  80204e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802051:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802056:	8b 06                	mov    (%esi),%eax
+  802058:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  80205d:	b8 01 00 00 00       	mov    $0x1,%eax
+  802062:	e8 93 ff ff ff       	call   801ffa <nsipc>
+  802067:	89 c3                	mov    %eax,%ebx
+  802069:	85 c0                	test   %eax,%eax
+  80206b:	79 09                	jns    802076 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  80206d:	89 d8                	mov    %ebx,%eax
+  80206f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802072:	5b                   	pop    %ebx
+  802073:	5e                   	pop    %esi
+  802074:	5d                   	pop    %ebp
+  802075:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802076:	83 ec 04             	sub    $0x4,%esp
+  802079:	ff 35 10 80 80 00    	push   0x808010
+  80207f:	68 00 80 80 00       	push   $0x808000
+  802084:	ff 75 0c             	push   0xc(%ebp)
+  802087:	e8 21 ec ff ff       	call   800cad <memmove>
+		*addrlen = ret->ret_addrlen;
+  80208c:	a1 10 80 80 00       	mov    0x808010,%eax
+  802091:	89 06                	mov    %eax,(%esi)
+  802093:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802096:	eb d5                	jmp    80206d <nsipc_accept+0x27>
+
+00802098 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802098:	55                   	push   %ebp
+  802099:	89 e5                	mov    %esp,%ebp
+  80209b:	53                   	push   %ebx
+  80209c:	83 ec 08             	sub    $0x8,%esp
+  80209f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8020a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020a5:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8020aa:	53                   	push   %ebx
+  8020ab:	ff 75 0c             	push   0xc(%ebp)
+  8020ae:	68 04 80 80 00       	push   $0x808004
+  8020b3:	e8 f5 eb ff ff       	call   800cad <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8020b8:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  8020be:	b8 02 00 00 00       	mov    $0x2,%eax
+  8020c3:	e8 32 ff ff ff       	call   801ffa <nsipc>
+}
+  8020c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020cb:	c9                   	leave
+  8020cc:	c3                   	ret
+
+008020cd <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8020cd:	55                   	push   %ebp
+  8020ce:	89 e5                	mov    %esp,%ebp
+  8020d0:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8020d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020d6:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  8020db:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020de:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  8020e3:	b8 03 00 00 00       	mov    $0x3,%eax
+  8020e8:	e8 0d ff ff ff       	call   801ffa <nsipc>
+}
+  8020ed:	c9                   	leave
+  8020ee:	c3                   	ret
+
+008020ef <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8020ef:	55                   	push   %ebp
+  8020f0:	89 e5                	mov    %esp,%ebp
+  8020f2:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8020f5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020f8:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  8020fd:	b8 04 00 00 00       	mov    $0x4,%eax
+  802102:	e8 f3 fe ff ff       	call   801ffa <nsipc>
+}
+  802107:	c9                   	leave
+  802108:	c3                   	ret
+
+00802109 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802109:	55                   	push   %ebp
+  80210a:	89 e5                	mov    %esp,%ebp
+  80210c:	53                   	push   %ebx
+  80210d:	83 ec 08             	sub    $0x8,%esp
+  802110:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802113:	8b 45 08             	mov    0x8(%ebp),%eax
+  802116:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  80211b:	53                   	push   %ebx
+  80211c:	ff 75 0c             	push   0xc(%ebp)
+  80211f:	68 04 80 80 00       	push   $0x808004
+  802124:	e8 84 eb ff ff       	call   800cad <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802129:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  80212f:	b8 05 00 00 00       	mov    $0x5,%eax
+  802134:	e8 c1 fe ff ff       	call   801ffa <nsipc>
+}
+  802139:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80213c:	c9                   	leave
+  80213d:	c3                   	ret
+
+0080213e <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  80213e:	55                   	push   %ebp
+  80213f:	89 e5                	mov    %esp,%ebp
+  802141:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802144:	8b 45 08             	mov    0x8(%ebp),%eax
+  802147:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  80214c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80214f:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  802154:	b8 06 00 00 00       	mov    $0x6,%eax
+  802159:	e8 9c fe ff ff       	call   801ffa <nsipc>
+}
+  80215e:	c9                   	leave
+  80215f:	c3                   	ret
+
+00802160 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802160:	55                   	push   %ebp
+  802161:	89 e5                	mov    %esp,%ebp
+  802163:	56                   	push   %esi
+  802164:	53                   	push   %ebx
+  802165:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802168:	8b 45 08             	mov    0x8(%ebp),%eax
+  80216b:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  802170:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  802176:	8b 45 14             	mov    0x14(%ebp),%eax
+  802179:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  80217e:	b8 07 00 00 00       	mov    $0x7,%eax
+  802183:	e8 72 fe ff ff       	call   801ffa <nsipc>
+  802188:	89 c3                	mov    %eax,%ebx
+  80218a:	85 c0                	test   %eax,%eax
+  80218c:	78 22                	js     8021b0 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  80218e:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802193:	39 c6                	cmp    %eax,%esi
+  802195:	0f 4e c6             	cmovle %esi,%eax
+  802198:	39 c3                	cmp    %eax,%ebx
+  80219a:	7f 1d                	jg     8021b9 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  80219c:	83 ec 04             	sub    $0x4,%esp
+  80219f:	53                   	push   %ebx
+  8021a0:	68 00 80 80 00       	push   $0x808000
+  8021a5:	ff 75 0c             	push   0xc(%ebp)
+  8021a8:	e8 00 eb ff ff       	call   800cad <memmove>
+  8021ad:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8021b0:	89 d8                	mov    %ebx,%eax
+  8021b2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021b5:	5b                   	pop    %ebx
+  8021b6:	5e                   	pop    %esi
+  8021b7:	5d                   	pop    %ebp
+  8021b8:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8021b9:	68 2e 34 80 00       	push   $0x80342e
+  8021be:	68 11 2d 80 00       	push   $0x802d11
+  8021c3:	6a 62                	push   $0x62
+  8021c5:	68 43 34 80 00       	push   $0x803443
+  8021ca:	e8 c4 e2 ff ff       	call   800493 <_panic>
+
+008021cf <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8021cf:	55                   	push   %ebp
+  8021d0:	89 e5                	mov    %esp,%ebp
+  8021d2:	53                   	push   %ebx
+  8021d3:	83 ec 04             	sub    $0x4,%esp
+  8021d6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8021d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021dc:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  8021e1:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8021e7:	7f 2e                	jg     802217 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8021e9:	83 ec 04             	sub    $0x4,%esp
+  8021ec:	53                   	push   %ebx
+  8021ed:	ff 75 0c             	push   0xc(%ebp)
+  8021f0:	68 0c 80 80 00       	push   $0x80800c
+  8021f5:	e8 b3 ea ff ff       	call   800cad <memmove>
+	nsipcbuf.send.req_size = size;
+  8021fa:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802200:	8b 45 14             	mov    0x14(%ebp),%eax
+  802203:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802208:	b8 08 00 00 00       	mov    $0x8,%eax
+  80220d:	e8 e8 fd ff ff       	call   801ffa <nsipc>
+}
+  802212:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802215:	c9                   	leave
+  802216:	c3                   	ret
+	assert(size < 1600);
+  802217:	68 4f 34 80 00       	push   $0x80344f
+  80221c:	68 11 2d 80 00       	push   $0x802d11
+  802221:	6a 6d                	push   $0x6d
+  802223:	68 43 34 80 00       	push   $0x803443
+  802228:	e8 66 e2 ff ff       	call   800493 <_panic>
+
+0080222d <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80222d:	55                   	push   %ebp
+  80222e:	89 e5                	mov    %esp,%ebp
+  802230:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802233:	8b 45 08             	mov    0x8(%ebp),%eax
+  802236:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  80223b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80223e:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  802243:	8b 45 10             	mov    0x10(%ebp),%eax
+  802246:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  80224b:	b8 09 00 00 00       	mov    $0x9,%eax
+  802250:	e8 a5 fd ff ff       	call   801ffa <nsipc>
+}
+  802255:	c9                   	leave
+  802256:	c3                   	ret
+
+00802257 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802257:	55                   	push   %ebp
+  802258:	89 e5                	mov    %esp,%ebp
+  80225a:	56                   	push   %esi
+  80225b:	53                   	push   %ebx
+  80225c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80225f:	83 ec 0c             	sub    $0xc,%esp
+  802262:	ff 75 08             	push   0x8(%ebp)
+  802265:	e8 aa f3 ff ff       	call   801614 <fd2data>
+  80226a:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80226c:	83 c4 08             	add    $0x8,%esp
+  80226f:	68 5b 34 80 00       	push   $0x80345b
+  802274:	53                   	push   %ebx
+  802275:	e8 ad e8 ff ff       	call   800b27 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  80227a:	8b 46 04             	mov    0x4(%esi),%eax
+  80227d:	2b 06                	sub    (%esi),%eax
+  80227f:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802285:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80228c:	00 00 00 
+	stat->st_dev = &devpipe;
+  80228f:	c7 83 88 00 00 00 64 	movl   $0x805064,0x88(%ebx)
+  802296:	50 80 00 
+	return 0;
+}
+  802299:	b8 00 00 00 00       	mov    $0x0,%eax
+  80229e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022a1:	5b                   	pop    %ebx
+  8022a2:	5e                   	pop    %esi
+  8022a3:	5d                   	pop    %ebp
+  8022a4:	c3                   	ret
+
+008022a5 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8022a5:	55                   	push   %ebp
+  8022a6:	89 e5                	mov    %esp,%ebp
+  8022a8:	53                   	push   %ebx
+  8022a9:	83 ec 0c             	sub    $0xc,%esp
+  8022ac:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8022af:	53                   	push   %ebx
+  8022b0:	6a 00                	push   $0x0
+  8022b2:	e8 e1 ec ff ff       	call   800f98 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8022b7:	89 1c 24             	mov    %ebx,(%esp)
+  8022ba:	e8 55 f3 ff ff       	call   801614 <fd2data>
+  8022bf:	83 c4 08             	add    $0x8,%esp
+  8022c2:	50                   	push   %eax
+  8022c3:	6a 00                	push   $0x0
+  8022c5:	e8 ce ec ff ff       	call   800f98 <sys_page_unmap>
+}
+  8022ca:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022cd:	c9                   	leave
+  8022ce:	c3                   	ret
+
+008022cf <_pipeisclosed>:
+{
+  8022cf:	55                   	push   %ebp
+  8022d0:	89 e5                	mov    %esp,%ebp
+  8022d2:	57                   	push   %edi
+  8022d3:	56                   	push   %esi
+  8022d4:	53                   	push   %ebx
+  8022d5:	83 ec 1c             	sub    $0x1c,%esp
+  8022d8:	89 c7                	mov    %eax,%edi
+  8022da:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  8022dc:	a1 08 60 80 00       	mov    0x806008,%eax
+  8022e1:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8022e4:	83 ec 0c             	sub    $0xc,%esp
+  8022e7:	57                   	push   %edi
+  8022e8:	e8 08 05 00 00       	call   8027f5 <pageref>
+  8022ed:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8022f0:	89 34 24             	mov    %esi,(%esp)
+  8022f3:	e8 fd 04 00 00       	call   8027f5 <pageref>
+		nn = thisenv->env_runs;
+  8022f8:	8b 15 08 60 80 00    	mov    0x806008,%edx
+  8022fe:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  802301:	83 c4 10             	add    $0x10,%esp
+  802304:	39 cb                	cmp    %ecx,%ebx
+  802306:	74 1b                	je     802323 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802308:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80230b:	75 cf                	jne    8022dc <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80230d:	8b 42 58             	mov    0x58(%edx),%eax
+  802310:	6a 01                	push   $0x1
+  802312:	50                   	push   %eax
+  802313:	53                   	push   %ebx
+  802314:	68 62 34 80 00       	push   $0x803462
+  802319:	e8 50 e2 ff ff       	call   80056e <cprintf>
+  80231e:	83 c4 10             	add    $0x10,%esp
+  802321:	eb b9                	jmp    8022dc <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802323:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802326:	0f 94 c0             	sete   %al
+  802329:	0f b6 c0             	movzbl %al,%eax
+}
+  80232c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80232f:	5b                   	pop    %ebx
+  802330:	5e                   	pop    %esi
+  802331:	5f                   	pop    %edi
+  802332:	5d                   	pop    %ebp
+  802333:	c3                   	ret
+
+00802334 <devpipe_write>:
+{
+  802334:	55                   	push   %ebp
+  802335:	89 e5                	mov    %esp,%ebp
+  802337:	57                   	push   %edi
+  802338:	56                   	push   %esi
+  802339:	53                   	push   %ebx
+  80233a:	83 ec 28             	sub    $0x28,%esp
+  80233d:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802340:	56                   	push   %esi
+  802341:	e8 ce f2 ff ff       	call   801614 <fd2data>
+  802346:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802348:	83 c4 10             	add    $0x10,%esp
+  80234b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802350:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802353:	75 09                	jne    80235e <devpipe_write+0x2a>
+	return i;
+  802355:	89 f8                	mov    %edi,%eax
+  802357:	eb 23                	jmp    80237c <devpipe_write+0x48>
+			sys_yield();
+  802359:	e8 96 eb ff ff       	call   800ef4 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80235e:	8b 43 04             	mov    0x4(%ebx),%eax
+  802361:	8b 0b                	mov    (%ebx),%ecx
+  802363:	8d 51 20             	lea    0x20(%ecx),%edx
+  802366:	39 d0                	cmp    %edx,%eax
+  802368:	72 1a                	jb     802384 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  80236a:	89 da                	mov    %ebx,%edx
+  80236c:	89 f0                	mov    %esi,%eax
+  80236e:	e8 5c ff ff ff       	call   8022cf <_pipeisclosed>
+  802373:	85 c0                	test   %eax,%eax
+  802375:	74 e2                	je     802359 <devpipe_write+0x25>
+				return 0;
+  802377:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80237c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80237f:	5b                   	pop    %ebx
+  802380:	5e                   	pop    %esi
+  802381:	5f                   	pop    %edi
+  802382:	5d                   	pop    %ebp
+  802383:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802384:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802387:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  80238b:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  80238e:	89 c2                	mov    %eax,%edx
+  802390:	c1 fa 1f             	sar    $0x1f,%edx
+  802393:	89 d1                	mov    %edx,%ecx
+  802395:	c1 e9 1b             	shr    $0x1b,%ecx
+  802398:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80239b:	83 e2 1f             	and    $0x1f,%edx
+  80239e:	29 ca                	sub    %ecx,%edx
+  8023a0:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8023a4:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8023a8:	83 c0 01             	add    $0x1,%eax
+  8023ab:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8023ae:	83 c7 01             	add    $0x1,%edi
+  8023b1:	eb 9d                	jmp    802350 <devpipe_write+0x1c>
+
+008023b3 <devpipe_read>:
+{
+  8023b3:	55                   	push   %ebp
+  8023b4:	89 e5                	mov    %esp,%ebp
+  8023b6:	57                   	push   %edi
+  8023b7:	56                   	push   %esi
+  8023b8:	53                   	push   %ebx
+  8023b9:	83 ec 18             	sub    $0x18,%esp
+  8023bc:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8023bf:	57                   	push   %edi
+  8023c0:	e8 4f f2 ff ff       	call   801614 <fd2data>
+  8023c5:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8023c7:	83 c4 10             	add    $0x10,%esp
+  8023ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8023cf:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8023d2:	75 13                	jne    8023e7 <devpipe_read+0x34>
+	return i;
+  8023d4:	89 f0                	mov    %esi,%eax
+  8023d6:	eb 02                	jmp    8023da <devpipe_read+0x27>
+				return i;
+  8023d8:	89 f0                	mov    %esi,%eax
+}
+  8023da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023dd:	5b                   	pop    %ebx
+  8023de:	5e                   	pop    %esi
+  8023df:	5f                   	pop    %edi
+  8023e0:	5d                   	pop    %ebp
+  8023e1:	c3                   	ret
+			sys_yield();
+  8023e2:	e8 0d eb ff ff       	call   800ef4 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  8023e7:	8b 03                	mov    (%ebx),%eax
+  8023e9:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8023ec:	75 18                	jne    802406 <devpipe_read+0x53>
+			if (i > 0)
+  8023ee:	85 f6                	test   %esi,%esi
+  8023f0:	75 e6                	jne    8023d8 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  8023f2:	89 da                	mov    %ebx,%edx
+  8023f4:	89 f8                	mov    %edi,%eax
+  8023f6:	e8 d4 fe ff ff       	call   8022cf <_pipeisclosed>
+  8023fb:	85 c0                	test   %eax,%eax
+  8023fd:	74 e3                	je     8023e2 <devpipe_read+0x2f>
+				return 0;
+  8023ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  802404:	eb d4                	jmp    8023da <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802406:	99                   	cltd
+  802407:	c1 ea 1b             	shr    $0x1b,%edx
+  80240a:	01 d0                	add    %edx,%eax
+  80240c:	83 e0 1f             	and    $0x1f,%eax
+  80240f:	29 d0                	sub    %edx,%eax
+  802411:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802416:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802419:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80241c:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80241f:	83 c6 01             	add    $0x1,%esi
+  802422:	eb ab                	jmp    8023cf <devpipe_read+0x1c>
+
+00802424 <pipe>:
+{
+  802424:	55                   	push   %ebp
+  802425:	89 e5                	mov    %esp,%ebp
+  802427:	56                   	push   %esi
+  802428:	53                   	push   %ebx
+  802429:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80242c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80242f:	50                   	push   %eax
+  802430:	e8 f6 f1 ff ff       	call   80162b <fd_alloc>
+  802435:	89 c3                	mov    %eax,%ebx
+  802437:	83 c4 10             	add    $0x10,%esp
+  80243a:	85 c0                	test   %eax,%eax
+  80243c:	0f 88 23 01 00 00    	js     802565 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802442:	83 ec 04             	sub    $0x4,%esp
+  802445:	68 07 04 00 00       	push   $0x407
+  80244a:	ff 75 f4             	push   -0xc(%ebp)
+  80244d:	6a 00                	push   $0x0
+  80244f:	e8 bf ea ff ff       	call   800f13 <sys_page_alloc>
+  802454:	89 c3                	mov    %eax,%ebx
+  802456:	83 c4 10             	add    $0x10,%esp
+  802459:	85 c0                	test   %eax,%eax
+  80245b:	0f 88 04 01 00 00    	js     802565 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802461:	83 ec 0c             	sub    $0xc,%esp
+  802464:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802467:	50                   	push   %eax
+  802468:	e8 be f1 ff ff       	call   80162b <fd_alloc>
+  80246d:	89 c3                	mov    %eax,%ebx
+  80246f:	83 c4 10             	add    $0x10,%esp
+  802472:	85 c0                	test   %eax,%eax
+  802474:	0f 88 db 00 00 00    	js     802555 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80247a:	83 ec 04             	sub    $0x4,%esp
+  80247d:	68 07 04 00 00       	push   $0x407
+  802482:	ff 75 f0             	push   -0x10(%ebp)
+  802485:	6a 00                	push   $0x0
+  802487:	e8 87 ea ff ff       	call   800f13 <sys_page_alloc>
+  80248c:	89 c3                	mov    %eax,%ebx
+  80248e:	83 c4 10             	add    $0x10,%esp
+  802491:	85 c0                	test   %eax,%eax
+  802493:	0f 88 bc 00 00 00    	js     802555 <pipe+0x131>
+	va = fd2data(fd0);
+  802499:	83 ec 0c             	sub    $0xc,%esp
+  80249c:	ff 75 f4             	push   -0xc(%ebp)
+  80249f:	e8 70 f1 ff ff       	call   801614 <fd2data>
+  8024a4:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8024a6:	83 c4 0c             	add    $0xc,%esp
+  8024a9:	68 07 04 00 00       	push   $0x407
+  8024ae:	50                   	push   %eax
+  8024af:	6a 00                	push   $0x0
+  8024b1:	e8 5d ea ff ff       	call   800f13 <sys_page_alloc>
+  8024b6:	89 c3                	mov    %eax,%ebx
+  8024b8:	83 c4 10             	add    $0x10,%esp
+  8024bb:	85 c0                	test   %eax,%eax
+  8024bd:	0f 88 82 00 00 00    	js     802545 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8024c3:	83 ec 0c             	sub    $0xc,%esp
+  8024c6:	ff 75 f0             	push   -0x10(%ebp)
+  8024c9:	e8 46 f1 ff ff       	call   801614 <fd2data>
+  8024ce:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8024d5:	50                   	push   %eax
+  8024d6:	6a 00                	push   $0x0
+  8024d8:	56                   	push   %esi
+  8024d9:	6a 00                	push   $0x0
+  8024db:	e8 76 ea ff ff       	call   800f56 <sys_page_map>
+  8024e0:	89 c3                	mov    %eax,%ebx
+  8024e2:	83 c4 20             	add    $0x20,%esp
+  8024e5:	85 c0                	test   %eax,%eax
+  8024e7:	78 4e                	js     802537 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8024e9:	a1 64 50 80 00       	mov    0x805064,%eax
+  8024ee:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8024f1:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8024f3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8024f6:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8024fd:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802500:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802502:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802505:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80250c:	83 ec 0c             	sub    $0xc,%esp
+  80250f:	ff 75 f4             	push   -0xc(%ebp)
+  802512:	e8 ed f0 ff ff       	call   801604 <fd2num>
+  802517:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80251a:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80251c:	83 c4 04             	add    $0x4,%esp
+  80251f:	ff 75 f0             	push   -0x10(%ebp)
+  802522:	e8 dd f0 ff ff       	call   801604 <fd2num>
+  802527:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80252a:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80252d:	83 c4 10             	add    $0x10,%esp
+  802530:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802535:	eb 2e                	jmp    802565 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802537:	83 ec 08             	sub    $0x8,%esp
+  80253a:	56                   	push   %esi
+  80253b:	6a 00                	push   $0x0
+  80253d:	e8 56 ea ff ff       	call   800f98 <sys_page_unmap>
+  802542:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802545:	83 ec 08             	sub    $0x8,%esp
+  802548:	ff 75 f0             	push   -0x10(%ebp)
+  80254b:	6a 00                	push   $0x0
+  80254d:	e8 46 ea ff ff       	call   800f98 <sys_page_unmap>
+  802552:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802555:	83 ec 08             	sub    $0x8,%esp
+  802558:	ff 75 f4             	push   -0xc(%ebp)
+  80255b:	6a 00                	push   $0x0
+  80255d:	e8 36 ea ff ff       	call   800f98 <sys_page_unmap>
+  802562:	83 c4 10             	add    $0x10,%esp
+}
+  802565:	89 d8                	mov    %ebx,%eax
+  802567:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80256a:	5b                   	pop    %ebx
+  80256b:	5e                   	pop    %esi
+  80256c:	5d                   	pop    %ebp
+  80256d:	c3                   	ret
+
+0080256e <pipeisclosed>:
+{
+  80256e:	55                   	push   %ebp
+  80256f:	89 e5                	mov    %esp,%ebp
+  802571:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802574:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802577:	50                   	push   %eax
+  802578:	ff 75 08             	push   0x8(%ebp)
+  80257b:	e8 01 f1 ff ff       	call   801681 <fd_lookup>
+  802580:	83 c4 10             	add    $0x10,%esp
+  802583:	85 c0                	test   %eax,%eax
+  802585:	78 18                	js     80259f <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802587:	83 ec 0c             	sub    $0xc,%esp
+  80258a:	ff 75 f4             	push   -0xc(%ebp)
+  80258d:	e8 82 f0 ff ff       	call   801614 <fd2data>
+  802592:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802594:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802597:	e8 33 fd ff ff       	call   8022cf <_pipeisclosed>
+  80259c:	83 c4 10             	add    $0x10,%esp
+}
+  80259f:	c9                   	leave
+  8025a0:	c3                   	ret
+
+008025a1 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  8025a1:	55                   	push   %ebp
+  8025a2:	89 e5                	mov    %esp,%ebp
+  8025a4:	56                   	push   %esi
+  8025a5:	53                   	push   %ebx
+  8025a6:	8b 75 08             	mov    0x8(%ebp),%esi
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  8025a9:	85 f6                	test   %esi,%esi
+  8025ab:	74 15                	je     8025c2 <wait+0x21>
+	e = &envs[ENVX(envid)];
+  8025ad:	89 f0                	mov    %esi,%eax
+  8025af:	25 ff 03 00 00       	and    $0x3ff,%eax
+
+    while (e->env_id == envid && e->env_status != ENV_FREE) {
+  8025b4:	8d 1c c0             	lea    (%eax,%eax,8),%ebx
+  8025b7:	c1 e3 04             	shl    $0x4,%ebx
+  8025ba:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  8025c0:	eb 1b                	jmp    8025dd <wait+0x3c>
+	assert(envid != 0);
+  8025c2:	68 7a 34 80 00       	push   $0x80347a
+  8025c7:	68 11 2d 80 00       	push   $0x802d11
+  8025cc:	6a 09                	push   $0x9
+  8025ce:	68 85 34 80 00       	push   $0x803485
+  8025d3:	e8 bb de ff ff       	call   800493 <_panic>
+        sys_yield();
+  8025d8:	e8 17 e9 ff ff       	call   800ef4 <sys_yield>
+    while (e->env_id == envid && e->env_status != ENV_FREE) {
+  8025dd:	8b 43 48             	mov    0x48(%ebx),%eax
+  8025e0:	39 f0                	cmp    %esi,%eax
+  8025e2:	75 07                	jne    8025eb <wait+0x4a>
+  8025e4:	8b 43 54             	mov    0x54(%ebx),%eax
+  8025e7:	85 c0                	test   %eax,%eax
+  8025e9:	75 ed                	jne    8025d8 <wait+0x37>
+    }
+}
+  8025eb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025ee:	5b                   	pop    %ebx
+  8025ef:	5e                   	pop    %esi
+  8025f0:	5d                   	pop    %ebp
+  8025f1:	c3                   	ret
+
+008025f2 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8025f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025f7:	c3                   	ret
+
+008025f8 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8025f8:	55                   	push   %ebp
+  8025f9:	89 e5                	mov    %esp,%ebp
+  8025fb:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8025fe:	68 90 34 80 00       	push   $0x803490
+  802603:	ff 75 0c             	push   0xc(%ebp)
+  802606:	e8 1c e5 ff ff       	call   800b27 <strcpy>
+	return 0;
+}
+  80260b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802610:	c9                   	leave
+  802611:	c3                   	ret
+
+00802612 <devcons_write>:
+{
+  802612:	55                   	push   %ebp
+  802613:	89 e5                	mov    %esp,%ebp
+  802615:	57                   	push   %edi
+  802616:	56                   	push   %esi
+  802617:	53                   	push   %ebx
+  802618:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80261e:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802623:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802629:	eb 2e                	jmp    802659 <devcons_write+0x47>
+		m = n - tot;
+  80262b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80262e:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802630:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802635:	39 c3                	cmp    %eax,%ebx
+  802637:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80263a:	83 ec 04             	sub    $0x4,%esp
+  80263d:	53                   	push   %ebx
+  80263e:	89 f0                	mov    %esi,%eax
+  802640:	03 45 0c             	add    0xc(%ebp),%eax
+  802643:	50                   	push   %eax
+  802644:	57                   	push   %edi
+  802645:	e8 63 e6 ff ff       	call   800cad <memmove>
+		sys_cputs(buf, m);
+  80264a:	83 c4 08             	add    $0x8,%esp
+  80264d:	53                   	push   %ebx
+  80264e:	57                   	push   %edi
+  80264f:	e8 03 e8 ff ff       	call   800e57 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802654:	01 de                	add    %ebx,%esi
+  802656:	83 c4 10             	add    $0x10,%esp
+  802659:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80265c:	72 cd                	jb     80262b <devcons_write+0x19>
+}
+  80265e:	89 f0                	mov    %esi,%eax
+  802660:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802663:	5b                   	pop    %ebx
+  802664:	5e                   	pop    %esi
+  802665:	5f                   	pop    %edi
+  802666:	5d                   	pop    %ebp
+  802667:	c3                   	ret
+
+00802668 <devcons_read>:
+{
+  802668:	55                   	push   %ebp
+  802669:	89 e5                	mov    %esp,%ebp
+  80266b:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80266e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802673:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802677:	75 07                	jne    802680 <devcons_read+0x18>
+  802679:	eb 1f                	jmp    80269a <devcons_read+0x32>
+		sys_yield();
+  80267b:	e8 74 e8 ff ff       	call   800ef4 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802680:	e8 f0 e7 ff ff       	call   800e75 <sys_cgetc>
+  802685:	85 c0                	test   %eax,%eax
+  802687:	74 f2                	je     80267b <devcons_read+0x13>
+	if (c < 0)
+  802689:	78 0f                	js     80269a <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80268b:	83 f8 04             	cmp    $0x4,%eax
+  80268e:	74 0c                	je     80269c <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802690:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802693:	88 02                	mov    %al,(%edx)
+	return 1;
+  802695:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80269a:	c9                   	leave
+  80269b:	c3                   	ret
+		return 0;
+  80269c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026a1:	eb f7                	jmp    80269a <devcons_read+0x32>
+
+008026a3 <cputchar>:
+{
+  8026a3:	55                   	push   %ebp
+  8026a4:	89 e5                	mov    %esp,%ebp
+  8026a6:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8026a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026ac:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8026af:	6a 01                	push   $0x1
+  8026b1:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8026b4:	50                   	push   %eax
+  8026b5:	e8 9d e7 ff ff       	call   800e57 <sys_cputs>
+}
+  8026ba:	83 c4 10             	add    $0x10,%esp
+  8026bd:	c9                   	leave
+  8026be:	c3                   	ret
+
+008026bf <getchar>:
+{
+  8026bf:	55                   	push   %ebp
+  8026c0:	89 e5                	mov    %esp,%ebp
+  8026c2:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8026c5:	6a 01                	push   $0x1
+  8026c7:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8026ca:	50                   	push   %eax
+  8026cb:	6a 00                	push   $0x0
+  8026cd:	e8 15 f2 ff ff       	call   8018e7 <read>
+	if (r < 0)
+  8026d2:	83 c4 10             	add    $0x10,%esp
+  8026d5:	85 c0                	test   %eax,%eax
+  8026d7:	78 06                	js     8026df <getchar+0x20>
+	if (r < 1)
+  8026d9:	74 06                	je     8026e1 <getchar+0x22>
+	return c;
+  8026db:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8026df:	c9                   	leave
+  8026e0:	c3                   	ret
+		return -E_EOF;
+  8026e1:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8026e6:	eb f7                	jmp    8026df <getchar+0x20>
+
+008026e8 <iscons>:
+{
+  8026e8:	55                   	push   %ebp
+  8026e9:	89 e5                	mov    %esp,%ebp
+  8026eb:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8026ee:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026f1:	50                   	push   %eax
+  8026f2:	ff 75 08             	push   0x8(%ebp)
+  8026f5:	e8 87 ef ff ff       	call   801681 <fd_lookup>
+  8026fa:	83 c4 10             	add    $0x10,%esp
+  8026fd:	85 c0                	test   %eax,%eax
+  8026ff:	78 11                	js     802712 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802701:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802704:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  80270a:	39 10                	cmp    %edx,(%eax)
+  80270c:	0f 94 c0             	sete   %al
+  80270f:	0f b6 c0             	movzbl %al,%eax
+}
+  802712:	c9                   	leave
+  802713:	c3                   	ret
+
+00802714 <opencons>:
+{
+  802714:	55                   	push   %ebp
+  802715:	89 e5                	mov    %esp,%ebp
+  802717:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80271a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80271d:	50                   	push   %eax
+  80271e:	e8 08 ef ff ff       	call   80162b <fd_alloc>
+  802723:	83 c4 10             	add    $0x10,%esp
+  802726:	85 c0                	test   %eax,%eax
+  802728:	78 3a                	js     802764 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80272a:	83 ec 04             	sub    $0x4,%esp
+  80272d:	68 07 04 00 00       	push   $0x407
+  802732:	ff 75 f4             	push   -0xc(%ebp)
+  802735:	6a 00                	push   $0x0
+  802737:	e8 d7 e7 ff ff       	call   800f13 <sys_page_alloc>
+  80273c:	83 c4 10             	add    $0x10,%esp
+  80273f:	85 c0                	test   %eax,%eax
+  802741:	78 21                	js     802764 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802743:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802746:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  80274c:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80274e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802751:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802758:	83 ec 0c             	sub    $0xc,%esp
+  80275b:	50                   	push   %eax
+  80275c:	e8 a3 ee ff ff       	call   801604 <fd2num>
+  802761:	83 c4 10             	add    $0x10,%esp
+}
+  802764:	c9                   	leave
+  802765:	c3                   	ret
+
+00802766 <set_pgfault_handler>:
+// allocate an exception stack (one page of memory with its top
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf)) {
+  802766:	55                   	push   %ebp
+  802767:	89 e5                	mov    %esp,%ebp
+  802769:	83 ec 08             	sub    $0x8,%esp
+  int r;
+
+  if (_pgfault_handler == 0) {
+  80276c:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  802773:	74 0a                	je     80277f <set_pgfault_handler+0x19>
+    if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)))
+      panic(" set_pgfault_handler sys_env_set_pgfault_upcall panic: %e\n", r);
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  802775:	8b 45 08             	mov    0x8(%ebp),%eax
+  802778:	a3 00 90 80 00       	mov    %eax,0x809000
+
+
+}
+  80277d:	c9                   	leave
+  80277e:	c3                   	ret
+    if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)))
+  80277f:	83 ec 04             	sub    $0x4,%esp
+  802782:	6a 07                	push   $0x7
+  802784:	68 00 f0 bf ee       	push   $0xeebff000
+  802789:	6a 00                	push   $0x0
+  80278b:	e8 83 e7 ff ff       	call   800f13 <sys_page_alloc>
+  802790:	83 c4 10             	add    $0x10,%esp
+  802793:	85 c0                	test   %eax,%eax
+  802795:	75 28                	jne    8027bf <set_pgfault_handler+0x59>
+    if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)))
+  802797:	83 ec 08             	sub    $0x8,%esp
+  80279a:	68 d1 27 80 00       	push   $0x8027d1
+  80279f:	6a 00                	push   $0x0
+  8027a1:	e8 b8 e8 ff ff       	call   80105e <sys_env_set_pgfault_upcall>
+  8027a6:	83 c4 10             	add    $0x10,%esp
+  8027a9:	85 c0                	test   %eax,%eax
+  8027ab:	74 c8                	je     802775 <set_pgfault_handler+0xf>
+      panic(" set_pgfault_handler sys_env_set_pgfault_upcall panic: %e\n", r);
+  8027ad:	50                   	push   %eax
+  8027ae:	68 cc 34 80 00       	push   $0x8034cc
+  8027b3:	6a 22                	push   $0x22
+  8027b5:	68 07 35 80 00       	push   $0x803507
+  8027ba:	e8 d4 dc ff ff       	call   800493 <_panic>
+      panic("set_pgfault_handler sys_page_alloc panic: %e\n", r);
+  8027bf:	50                   	push   %eax
+  8027c0:	68 9c 34 80 00       	push   $0x80349c
+  8027c5:	6a 20                	push   $0x20
+  8027c7:	68 07 35 80 00       	push   $0x803507
+  8027cc:	e8 c2 dc ff ff       	call   800493 <_panic>
+
+008027d1 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8027d1:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8027d2:	a1 00 90 80 00       	mov    0x809000,%eax
+	call *%eax
+  8027d7:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8027d9:	83 c4 04             	add    $0x4,%esp
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	// push the trap-time %eip onto the trap-time stack
+    subl $0x4, 0x30(%esp) # for push eip
+  8027dc:	83 6c 24 30 04       	subl   $0x4,0x30(%esp)
+    movl 0x30(%esp), %ebx #regular esp
+  8027e1:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+    movl 0x28(%esp), %eax #eip
+  8027e5:	8b 44 24 28          	mov    0x28(%esp),%eax
+    movl %eax, (%ebx)
+  8027e9:	89 03                	mov    %eax,(%ebx)
+
+    // Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+    addl $8, %esp
+  8027eb:	83 c4 08             	add    $0x8,%esp
+    popal
+  8027ee:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  8027ef:	83 c4 04             	add    $0x4,%esp
+	popfl
+  8027f2:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  8027f3:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  8027f4:	c3                   	ret
+
+008027f5 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8027f5:	55                   	push   %ebp
+  8027f6:	89 e5                	mov    %esp,%ebp
+  8027f8:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8027fb:	89 c2                	mov    %eax,%edx
+  8027fd:	c1 ea 16             	shr    $0x16,%edx
+  802800:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802807:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80280c:	f6 c1 01             	test   $0x1,%cl
+  80280f:	74 1c                	je     80282d <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  802811:	c1 e8 0c             	shr    $0xc,%eax
+  802814:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80281b:	a8 01                	test   $0x1,%al
+  80281d:	74 0e                	je     80282d <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80281f:	c1 e8 0c             	shr    $0xc,%eax
+  802822:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802829:	ef 
+  80282a:	0f b7 d2             	movzwl %dx,%edx
+}
+  80282d:	89 d0                	mov    %edx,%eax
+  80282f:	5d                   	pop    %ebp
+  802830:	c3                   	ret
+  802831:	66 90                	xchg   %ax,%ax
+  802833:	66 90                	xchg   %ax,%ax
+  802835:	66 90                	xchg   %ax,%ax
+  802837:	66 90                	xchg   %ax,%ax
+  802839:	66 90                	xchg   %ax,%ax
+  80283b:	66 90                	xchg   %ax,%ax
+  80283d:	66 90                	xchg   %ax,%ax
+  80283f:	90                   	nop
+
+00802840 <__udivmoddi4>:
+  802840:	55                   	push   %ebp
+  802841:	57                   	push   %edi
+  802842:	56                   	push   %esi
+  802843:	53                   	push   %ebx
+  802844:	83 ec 24             	sub    $0x24,%esp
+  802847:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80284b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80284f:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  802853:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802857:	8b 54 24 44          	mov    0x44(%esp),%edx
+  80285b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80285f:	8b 44 24 40          	mov    0x40(%esp),%eax
+  802863:	89 d3                	mov    %edx,%ebx
+  802865:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802869:	09 c3                	or     %eax,%ebx
+  80286b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80286f:	0f 84 9c 00 00 00    	je     802911 <__udivmoddi4+0xd1>
+  802875:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80287c:	00 
+  80287d:	31 c0                	xor    %eax,%eax
+  80287f:	31 d2                	xor    %edx,%edx
+  802881:	89 fb                	mov    %edi,%ebx
+  802883:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80288a:	00 
+  80288b:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802890:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802894:	01 c0                	add    %eax,%eax
+  802896:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80289d:	00 
+  80289e:	89 c6                	mov    %eax,%esi
+  8028a0:	89 d7                	mov    %edx,%edi
+  8028a2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8028a6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8028aa:	0f ad d0             	shrd   %cl,%edx,%eax
+  8028ad:	d3 ea                	shr    %cl,%edx
+  8028af:	f6 c1 20             	test   $0x20,%cl
+  8028b2:	0f 45 c2             	cmovne %edx,%eax
+  8028b5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8028b9:	83 e0 01             	and    $0x1,%eax
+  8028bc:	09 fa                	or     %edi,%edx
+  8028be:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8028c2:	89 04 24             	mov    %eax,(%esp)
+  8028c5:	8b 04 24             	mov    (%esp),%eax
+  8028c8:	89 d5                	mov    %edx,%ebp
+  8028ca:	09 f0                	or     %esi,%eax
+  8028cc:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8028d0:	39 f0                	cmp    %esi,%eax
+  8028d2:	19 fd                	sbb    %edi,%ebp
+  8028d4:	72 1d                	jb     8028f3 <__udivmoddi4+0xb3>
+  8028d6:	29 f0                	sub    %esi,%eax
+  8028d8:	19 fa                	sbb    %edi,%edx
+  8028da:	89 cf                	mov    %ecx,%edi
+  8028dc:	c1 ef 05             	shr    $0x5,%edi
+  8028df:	83 e7 01             	and    $0x1,%edi
+  8028e2:	89 fe                	mov    %edi,%esi
+  8028e4:	d3 e7                	shl    %cl,%edi
+  8028e6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8028ea:	83 f6 01             	xor    $0x1,%esi
+  8028ed:	d3 e6                	shl    %cl,%esi
+  8028ef:	09 74 24 18          	or     %esi,0x18(%esp)
+  8028f3:	83 e9 01             	sub    $0x1,%ecx
+  8028f6:	73 98                	jae    802890 <__udivmoddi4+0x50>
+  8028f8:	85 db                	test   %ebx,%ebx
+  8028fa:	74 05                	je     802901 <__udivmoddi4+0xc1>
+  8028fc:	89 03                	mov    %eax,(%ebx)
+  8028fe:	89 53 04             	mov    %edx,0x4(%ebx)
+  802901:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802905:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802909:	83 c4 24             	add    $0x24,%esp
+  80290c:	5b                   	pop    %ebx
+  80290d:	5e                   	pop    %esi
+  80290e:	5f                   	pop    %edi
+  80290f:	5d                   	pop    %ebp
+  802910:	c3                   	ret
+  802911:	85 ff                	test   %edi,%edi
+  802913:	74 0d                	je     802922 <__udivmoddi4+0xe2>
+  802915:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  80291b:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  802922:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802926:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80292a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80292e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802932:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802936:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80293a:	83 c4 24             	add    $0x24,%esp
+  80293d:	5b                   	pop    %ebx
+  80293e:	5e                   	pop    %esi
+  80293f:	5f                   	pop    %edi
+  802940:	5d                   	pop    %ebp
+  802941:	c3                   	ret
+  802942:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802949:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00802950 <__udivdi3>:
+  802950:	57                   	push   %edi
+  802951:	56                   	push   %esi
+  802952:	53                   	push   %ebx
+  802953:	83 ec 20             	sub    $0x20,%esp
+  802956:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80295a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80295e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802962:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802966:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80296a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80296e:	89 d1                	mov    %edx,%ecx
+  802970:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802974:	09 c1                	or     %eax,%ecx
+  802976:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80297a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80297e:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802982:	0f 84 88 00 00 00    	je     802a10 <__udivdi3+0xc0>
+  802988:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80298f:	00 
+  802990:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802995:	31 c0                	xor    %eax,%eax
+  802997:	31 d2                	xor    %edx,%edx
+  802999:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8029a0:	00 
+  8029a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8029a8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8029ac:	01 c0                	add    %eax,%eax
+  8029ae:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8029b5:	00 
+  8029b6:	89 c6                	mov    %eax,%esi
+  8029b8:	89 d7                	mov    %edx,%edi
+  8029ba:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8029be:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8029c2:	0f ad d0             	shrd   %cl,%edx,%eax
+  8029c5:	d3 ea                	shr    %cl,%edx
+  8029c7:	f6 c1 20             	test   $0x20,%cl
+  8029ca:	0f 45 c2             	cmovne %edx,%eax
+  8029cd:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8029d1:	83 e0 01             	and    $0x1,%eax
+  8029d4:	09 fa                	or     %edi,%edx
+  8029d6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8029da:	89 04 24             	mov    %eax,(%esp)
+  8029dd:	8b 04 24             	mov    (%esp),%eax
+  8029e0:	89 d3                	mov    %edx,%ebx
+  8029e2:	09 f0                	or     %esi,%eax
+  8029e4:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8029e8:	39 f0                	cmp    %esi,%eax
+  8029ea:	19 fb                	sbb    %edi,%ebx
+  8029ec:	72 1d                	jb     802a0b <__udivdi3+0xbb>
+  8029ee:	29 f0                	sub    %esi,%eax
+  8029f0:	19 fa                	sbb    %edi,%edx
+  8029f2:	89 cf                	mov    %ecx,%edi
+  8029f4:	c1 ef 05             	shr    $0x5,%edi
+  8029f7:	83 e7 01             	and    $0x1,%edi
+  8029fa:	89 fe                	mov    %edi,%esi
+  8029fc:	d3 e7                	shl    %cl,%edi
+  8029fe:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802a02:	83 f6 01             	xor    $0x1,%esi
+  802a05:	d3 e6                	shl    %cl,%esi
+  802a07:	09 74 24 18          	or     %esi,0x18(%esp)
+  802a0b:	83 e9 01             	sub    $0x1,%ecx
+  802a0e:	73 98                	jae    8029a8 <__udivdi3+0x58>
+  802a10:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802a14:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802a18:	83 c4 20             	add    $0x20,%esp
+  802a1b:	5b                   	pop    %ebx
+  802a1c:	5e                   	pop    %esi
+  802a1d:	5f                   	pop    %edi
+  802a1e:	c3                   	ret
+  802a1f:	90                   	nop
+
+00802a20 <__umoddi3>:
+  802a20:	57                   	push   %edi
+  802a21:	56                   	push   %esi
+  802a22:	53                   	push   %ebx
+  802a23:	83 ec 18             	sub    $0x18,%esp
+  802a26:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802a2a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802a2e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802a32:	8b 54 24 34          	mov    0x34(%esp),%edx
+  802a36:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802a3a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  802a3e:	89 d1                	mov    %edx,%ecx
+  802a40:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802a44:	09 c1                	or     %eax,%ecx
+  802a46:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802a4a:	74 5b                	je     802aa7 <__umoddi3+0x87>
+  802a4c:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802a51:	31 c0                	xor    %eax,%eax
+  802a53:	31 d2                	xor    %edx,%edx
+  802a55:	8d 76 00             	lea    0x0(%esi),%esi
+  802a58:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802a5c:	01 c0                	add    %eax,%eax
+  802a5e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802a65:	00 
+  802a66:	89 c6                	mov    %eax,%esi
+  802a68:	89 d7                	mov    %edx,%edi
+  802a6a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802a6e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802a72:	0f ad d0             	shrd   %cl,%edx,%eax
+  802a75:	d3 ea                	shr    %cl,%edx
+  802a77:	f6 c1 20             	test   $0x20,%cl
+  802a7a:	0f 45 c2             	cmovne %edx,%eax
+  802a7d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802a81:	83 e0 01             	and    $0x1,%eax
+  802a84:	09 fa                	or     %edi,%edx
+  802a86:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802a8a:	89 04 24             	mov    %eax,(%esp)
+  802a8d:	8b 04 24             	mov    (%esp),%eax
+  802a90:	89 d3                	mov    %edx,%ebx
+  802a92:	09 f0                	or     %esi,%eax
+  802a94:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802a98:	39 f0                	cmp    %esi,%eax
+  802a9a:	19 fb                	sbb    %edi,%ebx
+  802a9c:	72 04                	jb     802aa2 <__umoddi3+0x82>
+  802a9e:	29 f0                	sub    %esi,%eax
+  802aa0:	19 fa                	sbb    %edi,%edx
+  802aa2:	83 e9 01             	sub    $0x1,%ecx
+  802aa5:	73 b1                	jae    802a58 <__umoddi3+0x38>
+  802aa7:	83 c4 18             	add    $0x18,%esp
+  802aaa:	5b                   	pop    %ebx
+  802aab:	5e                   	pop    %esi
+  802aac:	5f                   	pop    %edi
+  802aad:	c3                   	ret
+  802aae:	66 90                	xchg   %ax,%ax
+
+00802ab0 <__divdi3>:
+  802ab0:	55                   	push   %ebp
+  802ab1:	57                   	push   %edi
+  802ab2:	56                   	push   %esi
+  802ab3:	53                   	push   %ebx
+  802ab4:	83 ec 24             	sub    $0x24,%esp
+  802ab7:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  802abb:	8b 74 24 44          	mov    0x44(%esp),%esi
+  802abf:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802ac3:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802ac7:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  802acb:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802acf:	85 d2                	test   %edx,%edx
+  802ad1:	0f 88 e0 00 00 00    	js     802bb7 <__divdi3+0x107>
+  802ad7:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  802adb:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  802adf:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802ae3:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802ae7:	85 f6                	test   %esi,%esi
+  802ae9:	78 16                	js     802b01 <__divdi3+0x51>
+  802aeb:	89 f1                	mov    %esi,%ecx
+  802aed:	31 c0                	xor    %eax,%eax
+  802aef:	31 d2                	xor    %edx,%edx
+  802af1:	09 d9                	or     %ebx,%ecx
+  802af3:	0f 85 f3 00 00 00    	jne    802bec <__divdi3+0x13c>
+  802af9:	83 c4 24             	add    $0x24,%esp
+  802afc:	5b                   	pop    %ebx
+  802afd:	5e                   	pop    %esi
+  802afe:	5f                   	pop    %edi
+  802aff:	5d                   	pop    %ebp
+  802b00:	c3                   	ret
+  802b01:	bf 01 00 00 00       	mov    $0x1,%edi
+  802b06:	f7 5c 24 08          	negl   0x8(%esp)
+  802b0a:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  802b0f:	f7 5c 24 0c          	negl   0xc(%esp)
+  802b13:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802b1a:	00 
+  802b1b:	31 c0                	xor    %eax,%eax
+  802b1d:	31 d2                	xor    %edx,%edx
+  802b1f:	89 fb                	mov    %edi,%ebx
+  802b21:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802b28:	00 
+  802b29:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802b2e:	66 90                	xchg   %ax,%ax
+  802b30:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802b34:	01 c0                	add    %eax,%eax
+  802b36:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802b3d:	00 
+  802b3e:	89 c6                	mov    %eax,%esi
+  802b40:	89 d7                	mov    %edx,%edi
+  802b42:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802b46:	8b 54 24 14          	mov    0x14(%esp),%edx
+  802b4a:	0f ad d0             	shrd   %cl,%edx,%eax
+  802b4d:	d3 ea                	shr    %cl,%edx
+  802b4f:	f6 c1 20             	test   $0x20,%cl
+  802b52:	0f 45 c2             	cmovne %edx,%eax
+  802b55:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802b59:	83 e0 01             	and    $0x1,%eax
+  802b5c:	09 fa                	or     %edi,%edx
+  802b5e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802b62:	89 04 24             	mov    %eax,(%esp)
+  802b65:	8b 04 24             	mov    (%esp),%eax
+  802b68:	89 d5                	mov    %edx,%ebp
+  802b6a:	09 f0                	or     %esi,%eax
+  802b6c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802b70:	39 f0                	cmp    %esi,%eax
+  802b72:	19 fd                	sbb    %edi,%ebp
+  802b74:	72 1d                	jb     802b93 <__divdi3+0xe3>
+  802b76:	29 f0                	sub    %esi,%eax
+  802b78:	19 fa                	sbb    %edi,%edx
+  802b7a:	89 cf                	mov    %ecx,%edi
+  802b7c:	c1 ef 05             	shr    $0x5,%edi
+  802b7f:	83 e7 01             	and    $0x1,%edi
+  802b82:	89 fe                	mov    %edi,%esi
+  802b84:	d3 e7                	shl    %cl,%edi
+  802b86:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802b8a:	83 f6 01             	xor    $0x1,%esi
+  802b8d:	d3 e6                	shl    %cl,%esi
+  802b8f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802b93:	83 e9 01             	sub    $0x1,%ecx
+  802b96:	73 98                	jae    802b30 <__divdi3+0x80>
+  802b98:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802b9c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802ba0:	85 db                	test   %ebx,%ebx
+  802ba2:	0f 84 51 ff ff ff    	je     802af9 <__divdi3+0x49>
+  802ba8:	f7 d8                	neg    %eax
+  802baa:	83 d2 00             	adc    $0x0,%edx
+  802bad:	83 c4 24             	add    $0x24,%esp
+  802bb0:	5b                   	pop    %ebx
+  802bb1:	f7 da                	neg    %edx
+  802bb3:	5e                   	pop    %esi
+  802bb4:	5f                   	pop    %edi
+  802bb5:	5d                   	pop    %ebp
+  802bb6:	c3                   	ret
+  802bb7:	f7 d8                	neg    %eax
+  802bb9:	83 d2 00             	adc    $0x0,%edx
+  802bbc:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802bc0:	f7 da                	neg    %edx
+  802bc2:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802bc6:	85 f6                	test   %esi,%esi
+  802bc8:	78 1b                	js     802be5 <__divdi3+0x135>
+  802bca:	89 f1                	mov    %esi,%ecx
+  802bcc:	31 c0                	xor    %eax,%eax
+  802bce:	31 d2                	xor    %edx,%edx
+  802bd0:	bf 01 00 00 00       	mov    $0x1,%edi
+  802bd5:	09 d9                	or     %ebx,%ecx
+  802bd7:	0f 85 36 ff ff ff    	jne    802b13 <__divdi3+0x63>
+  802bdd:	83 c4 24             	add    $0x24,%esp
+  802be0:	5b                   	pop    %ebx
+  802be1:	5e                   	pop    %esi
+  802be2:	5f                   	pop    %edi
+  802be3:	5d                   	pop    %ebp
+  802be4:	c3                   	ret
+  802be5:	31 ff                	xor    %edi,%edi
+  802be7:	e9 1a ff ff ff       	jmp    802b06 <__divdi3+0x56>
+  802bec:	31 ff                	xor    %edi,%edi
+  802bee:	e9 20 ff ff ff       	jmp    802b13 <__divdi3+0x63>
+  802bf3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802bfa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00802c00 <__moddi3>:
+  802c00:	55                   	push   %ebp
+  802c01:	57                   	push   %edi
+  802c02:	56                   	push   %esi
+  802c03:	53                   	push   %ebx
+  802c04:	83 ec 1c             	sub    $0x1c,%esp
+  802c07:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  802c0b:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  802c0f:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  802c13:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  802c17:	89 c8                	mov    %ecx,%eax
+  802c19:	89 f2                	mov    %esi,%edx
+  802c1b:	89 f3                	mov    %esi,%ebx
+  802c1d:	85 ed                	test   %ebp,%ebp
+  802c1f:	0f 88 9d 00 00 00    	js     802cc2 <__moddi3+0xc2>
+  802c25:	09 cb                	or     %ecx,%ebx
+  802c27:	0f 84 8d 00 00 00    	je     802cba <__moddi3+0xba>
+  802c2d:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802c31:	31 db                	xor    %ebx,%ebx
+  802c33:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802c37:	89 ca                	mov    %ecx,%edx
+  802c39:	89 f0                	mov    %esi,%eax
+  802c3b:	89 dd                	mov    %ebx,%ebp
+  802c3d:	f7 da                	neg    %edx
+  802c3f:	83 d0 00             	adc    $0x0,%eax
+  802c42:	f7 d8                	neg    %eax
+  802c44:	0f 49 f0             	cmovns %eax,%esi
+  802c47:	0f 49 ca             	cmovns %edx,%ecx
+  802c4a:	31 c0                	xor    %eax,%eax
+  802c4c:	31 d2                	xor    %edx,%edx
+  802c4e:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802c52:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802c56:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802c5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  802c5f:	90                   	nop
+  802c60:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802c64:	01 c0                	add    %eax,%eax
+  802c66:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802c6d:	00 
+  802c6e:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  802c72:	89 c6                	mov    %eax,%esi
+  802c74:	89 d7                	mov    %edx,%edi
+  802c76:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802c7a:	8b 54 24 14          	mov    0x14(%esp),%edx
+  802c7e:	0f ad d0             	shrd   %cl,%edx,%eax
+  802c81:	d3 ea                	shr    %cl,%edx
+  802c83:	f6 c1 20             	test   $0x20,%cl
+  802c86:	0f 45 c2             	cmovne %edx,%eax
+  802c89:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802c8d:	83 e0 01             	and    $0x1,%eax
+  802c90:	09 fa                	or     %edi,%edx
+  802c92:	89 04 24             	mov    %eax,(%esp)
+  802c95:	8b 04 24             	mov    (%esp),%eax
+  802c98:	89 d7                	mov    %edx,%edi
+  802c9a:	09 f0                	or     %esi,%eax
+  802c9c:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  802ca0:	39 d8                	cmp    %ebx,%eax
+  802ca2:	19 f7                	sbb    %esi,%edi
+  802ca4:	72 04                	jb     802caa <__moddi3+0xaa>
+  802ca6:	29 d8                	sub    %ebx,%eax
+  802ca8:	19 f2                	sbb    %esi,%edx
+  802caa:	83 e9 01             	sub    $0x1,%ecx
+  802cad:	73 b1                	jae    802c60 <__moddi3+0x60>
+  802caf:	85 ed                	test   %ebp,%ebp
+  802cb1:	74 07                	je     802cba <__moddi3+0xba>
+  802cb3:	f7 d8                	neg    %eax
+  802cb5:	83 d2 00             	adc    $0x0,%edx
+  802cb8:	f7 da                	neg    %edx
+  802cba:	83 c4 1c             	add    $0x1c,%esp
+  802cbd:	5b                   	pop    %ebx
+  802cbe:	5e                   	pop    %esi
+  802cbf:	5f                   	pop    %edi
+  802cc0:	5d                   	pop    %ebp
+  802cc1:	c3                   	ret
+  802cc2:	09 cb                	or     %ecx,%ebx
+  802cc4:	74 f4                	je     802cba <__moddi3+0xba>
+  802cc6:	f7 df                	neg    %edi
+  802cc8:	bb 01 00 00 00       	mov    $0x1,%ebx
+  802ccd:	83 d5 00             	adc    $0x0,%ebp
+  802cd0:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802cd4:	f7 dd                	neg    %ebp
+  802cd6:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802cda:	e9 58 ff ff ff       	jmp    802c37 <__moddi3+0x37>
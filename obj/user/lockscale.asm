@@ -0,0 +1,5895 @@
+
+obj/user/lockscale.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 d8 01 00 00       	call   800209 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+	__sync_fetch_and_add(&sh->done, 1);
+}
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 20             	sub    $0x20,%esp
+	uint64_t total = 0;
+	int i, r;
+
+	if ((r = sys_page_alloc(0, sh, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80003c:	68 07 04 00 00       	push   $0x407
+  800041:	68 00 10 40 00       	push   $0x401000
+  800046:	6a 00                	push   $0x0
+  800048:	e8 9f 0c 00 00       	call   800cec <sys_page_alloc>
+  80004d:	83 c4 10             	add    $0x10,%esp
+  800050:	85 c0                	test   %eax,%eax
+  800052:	78 2a                	js     80007e <umain+0x4b>
+		panic("sys_page_alloc: %e", r);
+
+	for (i = 0; i < NWORKER; i++) {
+  800054:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if ((r = fork()) < 0)
+  800059:	e8 5c 10 00 00       	call   8010ba <fork>
+  80005e:	85 c0                	test   %eax,%eax
+  800060:	78 2e                	js     800090 <umain+0x5d>
+			panic("fork: %e", r);
+		if (r == 0) {
+  800062:	74 3e                	je     8000a2 <umain+0x6f>
+	for (i = 0; i < NWORKER; i++) {
+  800064:	83 c3 01             	add    $0x1,%ebx
+  800067:	83 fb 08             	cmp    $0x8,%ebx
+  80006a:	75 ed                	jne    800059 <umain+0x26>
+			return;
+		}
+	}
+
+	// Give every worker a moment to reach the start line.
+	sh->start = sys_time_msec() + 100;
+  80006c:	e8 ad 0e 00 00       	call   800f1e <sys_time_msec>
+  800071:	83 c0 64             	add    $0x64,%eax
+  800074:	a3 00 10 40 00       	mov    %eax,0x401000
+	while (sh->done < NWORKER)
+  800079:	e9 f4 00 00 00       	jmp    800172 <umain+0x13f>
+		panic("sys_page_alloc: %e", r);
+  80007e:	50                   	push   %eax
+  80007f:	68 60 2a 80 00       	push   $0x802a60
+  800084:	6a 35                	push   $0x35
+  800086:	68 73 2a 80 00       	push   $0x802a73
+  80008b:	e8 dc 01 00 00       	call   80026c <_panic>
+			panic("fork: %e", r);
+  800090:	50                   	push   %eax
+  800091:	68 84 2a 80 00       	push   $0x802a84
+  800096:	6a 39                	push   $0x39
+  800098:	68 73 2a 80 00       	push   $0x802a73
+  80009d:	e8 ca 01 00 00       	call   80026c <_panic>
+	void *scratch = (void *) (UTEMP + 2 * PGSIZE + id * PGSIZE);
+  8000a2:	89 de                	mov    %ebx,%esi
+  8000a4:	c1 e6 0c             	shl    $0xc,%esi
+  8000a7:	81 c6 00 20 40 00    	add    $0x402000,%esi
+	while (!sh->start)
+  8000ad:	eb 05                	jmp    8000b4 <umain+0x81>
+		sys_yield();
+  8000af:	e8 19 0c 00 00       	call   800ccd <sys_yield>
+	while (!sh->start)
+  8000b4:	a1 00 10 40 00       	mov    0x401000,%eax
+  8000b9:	85 c0                	test   %eax,%eax
+  8000bb:	74 f2                	je     8000af <umain+0x7c>
+  8000bd:	eb 02                	jmp    8000c1 <umain+0x8e>
+		asm volatile("pause");
+  8000bf:	f3 90                	pause
+	while (sys_time_msec() < sh->start)
+  8000c1:	e8 58 0e 00 00       	call   800f1e <sys_time_msec>
+  8000c6:	89 c2                	mov    %eax,%edx
+  8000c8:	a1 00 10 40 00       	mov    0x401000,%eax
+  8000cd:	39 c2                	cmp    %eax,%edx
+  8000cf:	72 ee                	jb     8000bf <umain+0x8c>
+	end = sh->start + RUNMSEC;
+  8000d1:	a1 00 10 40 00       	mov    0x401000,%eax
+  8000d6:	05 e8 03 00 00       	add    $0x3e8,%eax
+  8000db:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	uint32_t ops = 0;
+  8000de:	bf 00 00 00 00       	mov    $0x0,%edi
+	while (sys_time_msec() < end) {
+  8000e3:	e8 36 0e 00 00       	call   800f1e <sys_time_msec>
+  8000e8:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8000eb:	39 c8                	cmp    %ecx,%eax
+  8000ed:	73 58                	jae    800147 <umain+0x114>
+		if (sys_page_alloc(0, scratch, PTE_P|PTE_U|PTE_W) < 0)
+  8000ef:	83 ec 04             	sub    $0x4,%esp
+  8000f2:	6a 07                	push   $0x7
+  8000f4:	56                   	push   %esi
+  8000f5:	6a 00                	push   $0x0
+  8000f7:	e8 f0 0b 00 00       	call   800cec <sys_page_alloc>
+  8000fc:	83 c4 10             	add    $0x10,%esp
+  8000ff:	85 c0                	test   %eax,%eax
+  800101:	78 1c                	js     80011f <umain+0xec>
+		if (sys_page_unmap(0, scratch) < 0)
+  800103:	83 ec 08             	sub    $0x8,%esp
+  800106:	56                   	push   %esi
+  800107:	6a 00                	push   $0x0
+  800109:	e8 63 0c 00 00       	call   800d71 <sys_page_unmap>
+  80010e:	83 c4 10             	add    $0x10,%esp
+  800111:	85 c0                	test   %eax,%eax
+  800113:	78 1e                	js     800133 <umain+0x100>
+		sys_getenvid();
+  800115:	e8 94 0b 00 00       	call   800cae <sys_getenvid>
+		ops += 4;	// counting the sys_time_msec above
+  80011a:	83 c7 04             	add    $0x4,%edi
+  80011d:	eb c4                	jmp    8000e3 <umain+0xb0>
+			panic("sys_page_alloc failed");
+  80011f:	83 ec 04             	sub    $0x4,%esp
+  800122:	68 19 2f 80 00       	push   $0x802f19
+  800127:	6a 22                	push   $0x22
+  800129:	68 73 2a 80 00       	push   $0x802a73
+  80012e:	e8 39 01 00 00       	call   80026c <_panic>
+			panic("sys_page_unmap failed");
+  800133:	83 ec 04             	sub    $0x4,%esp
+  800136:	68 8d 2a 80 00       	push   $0x802a8d
+  80013b:	6a 24                	push   $0x24
+  80013d:	68 73 2a 80 00       	push   $0x802a73
+  800142:	e8 25 01 00 00       	call   80026c <_panic>
+	sh->ops[id] = ops;
+  800147:	89 3c 9d 08 10 40 00 	mov    %edi,0x401008(,%ebx,4)
+	sh->cpu[id] = thisenv->env_cpunum;
+  80014e:	a1 08 50 80 00       	mov    0x805008,%eax
+  800153:	8b 40 5c             	mov    0x5c(%eax),%eax
+  800156:	83 c3 08             	add    $0x8,%ebx
+  800159:	89 04 9d 08 10 40 00 	mov    %eax,0x401008(,%ebx,4)
+	__sync_fetch_and_add(&sh->done, 1);
+  800160:	f0 83 05 04 10 40 00 	lock addl $0x1,0x401004
+  800167:	01 
+}
+  800168:	e9 94 00 00 00       	jmp    800201 <umain+0x1ce>
+		sys_yield();
+  80016d:	e8 5b 0b 00 00       	call   800ccd <sys_yield>
+	while (sh->done < NWORKER)
+  800172:	a1 04 10 40 00       	mov    0x401004,%eax
+  800177:	83 f8 07             	cmp    $0x7,%eax
+  80017a:	7e f1                	jle    80016d <umain+0x13a>
+
+	for (i = 0; i < NWORKER; i++) {
+  80017c:	bb 00 00 00 00       	mov    $0x0,%ebx
+	uint64_t total = 0;
+  800181:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  800188:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+		cprintf("worker %d on CPU %d: %u ops\n", i, sh->cpu[i], sh->ops[i]);
+  80018f:	8d 34 9d 00 10 40 00 	lea    0x401000(,%ebx,4),%esi
+  800196:	8b 56 08             	mov    0x8(%esi),%edx
+  800199:	8b 46 28             	mov    0x28(%esi),%eax
+  80019c:	52                   	push   %edx
+  80019d:	50                   	push   %eax
+  80019e:	53                   	push   %ebx
+  80019f:	68 a3 2a 80 00       	push   $0x802aa3
+  8001a4:	e8 9e 01 00 00       	call   800347 <cprintf>
+		total += sh->ops[i];
+  8001a9:	8b 46 08             	mov    0x8(%esi),%eax
+  8001ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001b1:	01 45 e0             	add    %eax,-0x20(%ebp)
+  8001b4:	11 55 e4             	adc    %edx,-0x1c(%ebp)
+	for (i = 0; i < NWORKER; i++) {
+  8001b7:	83 c3 01             	add    $0x1,%ebx
+  8001ba:	83 c4 10             	add    $0x10,%esp
+  8001bd:	83 fb 08             	cmp    $0x8,%ebx
+  8001c0:	75 cd                	jne    80018f <umain+0x15c>
+	}
+	cprintf("lockscale: %llu syscalls in %d ms, %llu per second\n",
+  8001c2:	83 ec 10             	sub    $0x10,%esp
+		total, RUNMSEC, total * 1000 / RUNMSEC);
+  8001c5:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8001c8:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8001cb:	69 ce e8 03 00 00    	imul   $0x3e8,%esi,%ecx
+  8001d1:	b8 e8 03 00 00       	mov    $0x3e8,%eax
+  8001d6:	f7 e3                	mul    %ebx
+  8001d8:	01 ca                	add    %ecx,%edx
+	cprintf("lockscale: %llu syscalls in %d ms, %llu per second\n",
+  8001da:	6a 00                	push   $0x0
+  8001dc:	68 e8 03 00 00       	push   $0x3e8
+  8001e1:	52                   	push   %edx
+  8001e2:	50                   	push   %eax
+  8001e3:	e8 e8 24 00 00       	call   8026d0 <__udivdi3>
+  8001e8:	83 c4 18             	add    $0x18,%esp
+  8001eb:	52                   	push   %edx
+  8001ec:	50                   	push   %eax
+  8001ed:	68 e8 03 00 00       	push   $0x3e8
+  8001f2:	56                   	push   %esi
+  8001f3:	53                   	push   %ebx
+  8001f4:	68 c0 2a 80 00       	push   $0x802ac0
+  8001f9:	e8 49 01 00 00       	call   800347 <cprintf>
+  8001fe:	83 c4 20             	add    $0x20,%esp
+}
+  800201:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800204:	5b                   	pop    %ebx
+  800205:	5e                   	pop    %esi
+  800206:	5f                   	pop    %edi
+  800207:	5d                   	pop    %ebp
+  800208:	c3                   	ret
+
+00800209 <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  800209:	55                   	push   %ebp
+  80020a:	89 e5                	mov    %esp,%ebp
+  80020c:	56                   	push   %esi
+  80020d:	53                   	push   %ebx
+  80020e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800211:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  800214:	e8 95 0a 00 00       	call   800cae <sys_getenvid>
+  800219:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80021e:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800221:	c1 e0 04             	shl    $0x4,%eax
+  800224:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800229:	a3 08 50 80 00       	mov    %eax,0x805008
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  80022e:	85 db                	test   %ebx,%ebx
+  800230:	7e 07                	jle    800239 <libmain+0x30>
+    binaryname = argv[0];
+  800232:	8b 06                	mov    (%esi),%eax
+  800234:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  800239:	83 ec 08             	sub    $0x8,%esp
+  80023c:	56                   	push   %esi
+  80023d:	53                   	push   %ebx
+  80023e:	e8 f0 fd ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  800243:	e8 0a 00 00 00       	call   800252 <exit>
+}
+  800248:	83 c4 10             	add    $0x10,%esp
+  80024b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80024e:	5b                   	pop    %ebx
+  80024f:	5e                   	pop    %esi
+  800250:	5d                   	pop    %ebp
+  800251:	c3                   	ret
+
+00800252 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800252:	55                   	push   %ebp
+  800253:	89 e5                	mov    %esp,%ebp
+  800255:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800258:	e8 4d 12 00 00       	call   8014aa <close_all>
+	sys_env_destroy(0);
+  80025d:	83 ec 0c             	sub    $0xc,%esp
+  800260:	6a 00                	push   $0x0
+  800262:	e8 06 0a 00 00       	call   800c6d <sys_env_destroy>
+}
+  800267:	83 c4 10             	add    $0x10,%esp
+  80026a:	c9                   	leave
+  80026b:	c3                   	ret
+
+0080026c <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80026c:	55                   	push   %ebp
+  80026d:	89 e5                	mov    %esp,%ebp
+  80026f:	56                   	push   %esi
+  800270:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800271:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800274:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  80027a:	e8 2f 0a 00 00       	call   800cae <sys_getenvid>
+  80027f:	83 ec 0c             	sub    $0xc,%esp
+  800282:	ff 75 0c             	push   0xc(%ebp)
+  800285:	ff 75 08             	push   0x8(%ebp)
+  800288:	56                   	push   %esi
+  800289:	50                   	push   %eax
+  80028a:	68 00 2b 80 00       	push   $0x802b00
+  80028f:	e8 b3 00 00 00       	call   800347 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800294:	83 c4 18             	add    $0x18,%esp
+  800297:	53                   	push   %ebx
+  800298:	ff 75 10             	push   0x10(%ebp)
+  80029b:	e8 56 00 00 00       	call   8002f6 <vcprintf>
+	cprintf("\n");
+  8002a0:	c7 04 24 5c 30 80 00 	movl   $0x80305c,(%esp)
+  8002a7:	e8 9b 00 00 00       	call   800347 <cprintf>
+  8002ac:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8002af:	cc                   	int3
+	while (1)
+  8002b0:	eb fd                	jmp    8002af <_panic+0x43>
+
+008002b2 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8002b2:	55                   	push   %ebp
+  8002b3:	89 e5                	mov    %esp,%ebp
+  8002b5:	53                   	push   %ebx
+  8002b6:	83 ec 04             	sub    $0x4,%esp
+  8002b9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8002bc:	8b 13                	mov    (%ebx),%edx
+  8002be:	8d 42 01             	lea    0x1(%edx),%eax
+  8002c1:	89 03                	mov    %eax,(%ebx)
+  8002c3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8002c6:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8002ca:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8002cf:	74 09                	je     8002da <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8002d1:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8002d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8002d8:	c9                   	leave
+  8002d9:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8002da:	83 ec 08             	sub    $0x8,%esp
+  8002dd:	68 ff 00 00 00       	push   $0xff
+  8002e2:	8d 43 08             	lea    0x8(%ebx),%eax
+  8002e5:	50                   	push   %eax
+  8002e6:	e8 45 09 00 00       	call   800c30 <sys_cputs>
+		b->idx = 0;
+  8002eb:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8002f1:	83 c4 10             	add    $0x10,%esp
+  8002f4:	eb db                	jmp    8002d1 <putch+0x1f>
+
+008002f6 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8002f6:	55                   	push   %ebp
+  8002f7:	89 e5                	mov    %esp,%ebp
+  8002f9:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8002ff:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800306:	00 00 00 
+	b.cnt = 0;
+  800309:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800310:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800313:	ff 75 0c             	push   0xc(%ebp)
+  800316:	ff 75 08             	push   0x8(%ebp)
+  800319:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80031f:	50                   	push   %eax
+  800320:	68 b2 02 80 00       	push   $0x8002b2
+  800325:	e8 14 01 00 00       	call   80043e <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80032a:	83 c4 08             	add    $0x8,%esp
+  80032d:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800333:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800339:	50                   	push   %eax
+  80033a:	e8 f1 08 00 00       	call   800c30 <sys_cputs>
+
+	return b.cnt;
+}
+  80033f:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800345:	c9                   	leave
+  800346:	c3                   	ret
+
+00800347 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800347:	55                   	push   %ebp
+  800348:	89 e5                	mov    %esp,%ebp
+  80034a:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80034d:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800350:	50                   	push   %eax
+  800351:	ff 75 08             	push   0x8(%ebp)
+  800354:	e8 9d ff ff ff       	call   8002f6 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800359:	c9                   	leave
+  80035a:	c3                   	ret
+
+0080035b <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80035b:	55                   	push   %ebp
+  80035c:	89 e5                	mov    %esp,%ebp
+  80035e:	57                   	push   %edi
+  80035f:	56                   	push   %esi
+  800360:	53                   	push   %ebx
+  800361:	83 ec 1c             	sub    $0x1c,%esp
+  800364:	89 c7                	mov    %eax,%edi
+  800366:	89 d6                	mov    %edx,%esi
+  800368:	8b 45 08             	mov    0x8(%ebp),%eax
+  80036b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80036e:	89 d1                	mov    %edx,%ecx
+  800370:	89 c2                	mov    %eax,%edx
+  800372:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800375:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800378:	8b 45 10             	mov    0x10(%ebp),%eax
+  80037b:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80037e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800381:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800388:	39 c2                	cmp    %eax,%edx
+  80038a:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80038d:	72 3e                	jb     8003cd <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80038f:	83 ec 0c             	sub    $0xc,%esp
+  800392:	ff 75 18             	push   0x18(%ebp)
+  800395:	83 eb 01             	sub    $0x1,%ebx
+  800398:	53                   	push   %ebx
+  800399:	50                   	push   %eax
+  80039a:	83 ec 08             	sub    $0x8,%esp
+  80039d:	ff 75 e4             	push   -0x1c(%ebp)
+  8003a0:	ff 75 e0             	push   -0x20(%ebp)
+  8003a3:	ff 75 dc             	push   -0x24(%ebp)
+  8003a6:	ff 75 d8             	push   -0x28(%ebp)
+  8003a9:	e8 22 23 00 00       	call   8026d0 <__udivdi3>
+  8003ae:	83 c4 18             	add    $0x18,%esp
+  8003b1:	52                   	push   %edx
+  8003b2:	50                   	push   %eax
+  8003b3:	89 f2                	mov    %esi,%edx
+  8003b5:	89 f8                	mov    %edi,%eax
+  8003b7:	e8 9f ff ff ff       	call   80035b <printnum>
+  8003bc:	83 c4 20             	add    $0x20,%esp
+  8003bf:	eb 13                	jmp    8003d4 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8003c1:	83 ec 08             	sub    $0x8,%esp
+  8003c4:	56                   	push   %esi
+  8003c5:	ff 75 18             	push   0x18(%ebp)
+  8003c8:	ff d7                	call   *%edi
+  8003ca:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8003cd:	83 eb 01             	sub    $0x1,%ebx
+  8003d0:	85 db                	test   %ebx,%ebx
+  8003d2:	7f ed                	jg     8003c1 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8003d4:	83 ec 08             	sub    $0x8,%esp
+  8003d7:	56                   	push   %esi
+  8003d8:	83 ec 04             	sub    $0x4,%esp
+  8003db:	ff 75 e4             	push   -0x1c(%ebp)
+  8003de:	ff 75 e0             	push   -0x20(%ebp)
+  8003e1:	ff 75 dc             	push   -0x24(%ebp)
+  8003e4:	ff 75 d8             	push   -0x28(%ebp)
+  8003e7:	e8 b4 23 00 00       	call   8027a0 <__umoddi3>
+  8003ec:	83 c4 14             	add    $0x14,%esp
+  8003ef:	0f be 80 23 2b 80 00 	movsbl 0x802b23(%eax),%eax
+  8003f6:	50                   	push   %eax
+  8003f7:	ff d7                	call   *%edi
+}
+  8003f9:	83 c4 10             	add    $0x10,%esp
+  8003fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003ff:	5b                   	pop    %ebx
+  800400:	5e                   	pop    %esi
+  800401:	5f                   	pop    %edi
+  800402:	5d                   	pop    %ebp
+  800403:	c3                   	ret
+
+00800404 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800404:	55                   	push   %ebp
+  800405:	89 e5                	mov    %esp,%ebp
+  800407:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80040a:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80040e:	8b 10                	mov    (%eax),%edx
+  800410:	3b 50 04             	cmp    0x4(%eax),%edx
+  800413:	73 0a                	jae    80041f <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800415:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800418:	89 08                	mov    %ecx,(%eax)
+  80041a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80041d:	88 02                	mov    %al,(%edx)
+}
+  80041f:	5d                   	pop    %ebp
+  800420:	c3                   	ret
+
+00800421 <printfmt>:
+{
+  800421:	55                   	push   %ebp
+  800422:	89 e5                	mov    %esp,%ebp
+  800424:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800427:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80042a:	50                   	push   %eax
+  80042b:	ff 75 10             	push   0x10(%ebp)
+  80042e:	ff 75 0c             	push   0xc(%ebp)
+  800431:	ff 75 08             	push   0x8(%ebp)
+  800434:	e8 05 00 00 00       	call   80043e <vprintfmt>
+}
+  800439:	83 c4 10             	add    $0x10,%esp
+  80043c:	c9                   	leave
+  80043d:	c3                   	ret
+
+0080043e <vprintfmt>:
+{
+  80043e:	55                   	push   %ebp
+  80043f:	89 e5                	mov    %esp,%ebp
+  800441:	57                   	push   %edi
+  800442:	56                   	push   %esi
+  800443:	53                   	push   %ebx
+  800444:	83 ec 2c             	sub    $0x2c,%esp
+  800447:	8b 75 08             	mov    0x8(%ebp),%esi
+  80044a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80044d:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800450:	eb 0a                	jmp    80045c <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800452:	83 ec 08             	sub    $0x8,%esp
+  800455:	53                   	push   %ebx
+  800456:	50                   	push   %eax
+  800457:	ff d6                	call   *%esi
+  800459:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80045c:	83 c7 01             	add    $0x1,%edi
+  80045f:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800463:	83 f8 25             	cmp    $0x25,%eax
+  800466:	74 0c                	je     800474 <vprintfmt+0x36>
+			if (ch == '\0')
+  800468:	85 c0                	test   %eax,%eax
+  80046a:	75 e6                	jne    800452 <vprintfmt+0x14>
+}
+  80046c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80046f:	5b                   	pop    %ebx
+  800470:	5e                   	pop    %esi
+  800471:	5f                   	pop    %edi
+  800472:	5d                   	pop    %ebp
+  800473:	c3                   	ret
+		padc = ' ';
+  800474:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800478:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80047f:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800486:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80048d:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800492:	8d 47 01             	lea    0x1(%edi),%eax
+  800495:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800498:	0f b6 17             	movzbl (%edi),%edx
+  80049b:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80049e:	3c 55                	cmp    $0x55,%al
+  8004a0:	0f 87 9a 03 00 00    	ja     800840 <vprintfmt+0x402>
+  8004a6:	0f b6 c0             	movzbl %al,%eax
+  8004a9:	ff 24 85 60 2c 80 00 	jmp    *0x802c60(,%eax,4)
+  8004b0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8004b3:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8004b7:	eb d9                	jmp    800492 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004b9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8004bc:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8004c0:	eb d0                	jmp    800492 <vprintfmt+0x54>
+  8004c2:	0f b6 d2             	movzbl %dl,%edx
+  8004c5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8004c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004cd:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8004d0:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8004d3:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8004d7:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8004da:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8004dd:	83 f9 09             	cmp    $0x9,%ecx
+  8004e0:	77 55                	ja     800537 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8004e2:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8004e5:	eb e9                	jmp    8004d0 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8004e7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004ea:	8b 00                	mov    (%eax),%eax
+  8004ec:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004ef:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004f2:	8d 40 04             	lea    0x4(%eax),%eax
+  8004f5:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004f8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8004fb:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004ff:	79 91                	jns    800492 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800501:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800504:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800507:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80050e:	eb 82                	jmp    800492 <vprintfmt+0x54>
+			if (width < 0)
+  800510:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800513:	85 d2                	test   %edx,%edx
+  800515:	b8 00 00 00 00       	mov    $0x0,%eax
+  80051a:	0f 49 c2             	cmovns %edx,%eax
+  80051d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800520:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800523:	e9 6a ff ff ff       	jmp    800492 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800528:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80052b:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800532:	e9 5b ff ff ff       	jmp    800492 <vprintfmt+0x54>
+  800537:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80053a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80053d:	eb bc                	jmp    8004fb <vprintfmt+0xbd>
+			lflag++;
+  80053f:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800542:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800545:	e9 48 ff ff ff       	jmp    800492 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80054a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80054d:	8d 78 04             	lea    0x4(%eax),%edi
+  800550:	83 ec 08             	sub    $0x8,%esp
+  800553:	53                   	push   %ebx
+  800554:	ff 30                	push   (%eax)
+  800556:	ff d6                	call   *%esi
+			break;
+  800558:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80055b:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80055e:	e9 7c 02 00 00       	jmp    8007df <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  800563:	8b 45 14             	mov    0x14(%ebp),%eax
+  800566:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800569:	8b 10                	mov    (%eax),%edx
+  80056b:	89 d0                	mov    %edx,%eax
+  80056d:	f7 d8                	neg    %eax
+  80056f:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800572:	83 f8 10             	cmp    $0x10,%eax
+  800575:	7f 23                	jg     80059a <vprintfmt+0x15c>
+  800577:	8b 14 85 c0 2d 80 00 	mov    0x802dc0(,%eax,4),%edx
+  80057e:	85 d2                	test   %edx,%edx
+  800580:	74 18                	je     80059a <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800582:	52                   	push   %edx
+  800583:	68 f1 2f 80 00       	push   $0x802ff1
+  800588:	53                   	push   %ebx
+  800589:	56                   	push   %esi
+  80058a:	e8 92 fe ff ff       	call   800421 <printfmt>
+  80058f:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800592:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800595:	e9 45 02 00 00       	jmp    8007df <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  80059a:	50                   	push   %eax
+  80059b:	68 3b 2b 80 00       	push   $0x802b3b
+  8005a0:	53                   	push   %ebx
+  8005a1:	56                   	push   %esi
+  8005a2:	e8 7a fe ff ff       	call   800421 <printfmt>
+  8005a7:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005aa:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8005ad:	e9 2d 02 00 00       	jmp    8007df <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b5:	83 c0 04             	add    $0x4,%eax
+  8005b8:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8005bb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005be:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8005c0:	85 c9                	test   %ecx,%ecx
+  8005c2:	b8 34 2b 80 00       	mov    $0x802b34,%eax
+  8005c7:	0f 45 c1             	cmovne %ecx,%eax
+  8005ca:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8005cd:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005d1:	7e 06                	jle    8005d9 <vprintfmt+0x19b>
+  8005d3:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8005d7:	75 0b                	jne    8005e4 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005d9:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8005dc:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8005df:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005e2:	eb 5c                	jmp    800640 <vprintfmt+0x202>
+  8005e4:	83 ec 08             	sub    $0x8,%esp
+  8005e7:	ff 75 d0             	push   -0x30(%ebp)
+  8005ea:	ff 75 cc             	push   -0x34(%ebp)
+  8005ed:	e8 eb 02 00 00       	call   8008dd <strnlen>
+  8005f2:	89 c2                	mov    %eax,%edx
+  8005f4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005f7:	29 d0                	sub    %edx,%eax
+  8005f9:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8005fc:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800600:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800603:	89 75 08             	mov    %esi,0x8(%ebp)
+  800606:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800608:	eb 0e                	jmp    800618 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  80060a:	83 ec 08             	sub    $0x8,%esp
+  80060d:	53                   	push   %ebx
+  80060e:	57                   	push   %edi
+  80060f:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800612:	83 ee 01             	sub    $0x1,%esi
+  800615:	83 c4 10             	add    $0x10,%esp
+  800618:	85 f6                	test   %esi,%esi
+  80061a:	7f ee                	jg     80060a <vprintfmt+0x1cc>
+  80061c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80061f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800622:	85 c0                	test   %eax,%eax
+  800624:	ba 00 00 00 00       	mov    $0x0,%edx
+  800629:	0f 49 d0             	cmovns %eax,%edx
+  80062c:	29 d0                	sub    %edx,%eax
+  80062e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800631:	eb a6                	jmp    8005d9 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800633:	83 ec 08             	sub    $0x8,%esp
+  800636:	53                   	push   %ebx
+  800637:	52                   	push   %edx
+  800638:	ff 55 08             	call   *0x8(%ebp)
+  80063b:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80063e:	89 f1                	mov    %esi,%ecx
+  800640:	8d 71 01             	lea    0x1(%ecx),%esi
+  800643:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800647:	0f be d0             	movsbl %al,%edx
+  80064a:	85 d2                	test   %edx,%edx
+  80064c:	74 28                	je     800676 <vprintfmt+0x238>
+  80064e:	85 ff                	test   %edi,%edi
+  800650:	78 05                	js     800657 <vprintfmt+0x219>
+  800652:	83 ef 01             	sub    $0x1,%edi
+  800655:	78 30                	js     800687 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800657:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80065b:	74 d6                	je     800633 <vprintfmt+0x1f5>
+  80065d:	0f be c0             	movsbl %al,%eax
+  800660:	83 e8 20             	sub    $0x20,%eax
+  800663:	83 f8 5e             	cmp    $0x5e,%eax
+  800666:	76 cb                	jbe    800633 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800668:	83 ec 08             	sub    $0x8,%esp
+  80066b:	53                   	push   %ebx
+  80066c:	6a 3f                	push   $0x3f
+  80066e:	ff 55 08             	call   *0x8(%ebp)
+  800671:	83 c4 10             	add    $0x10,%esp
+  800674:	eb c8                	jmp    80063e <vprintfmt+0x200>
+  800676:	8b 75 08             	mov    0x8(%ebp),%esi
+  800679:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80067c:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80067f:	01 d0                	add    %edx,%eax
+  800681:	29 c8                	sub    %ecx,%eax
+  800683:	89 c7                	mov    %eax,%edi
+  800685:	eb 13                	jmp    80069a <vprintfmt+0x25c>
+  800687:	8b 75 08             	mov    0x8(%ebp),%esi
+  80068a:	eb ed                	jmp    800679 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80068c:	83 ec 08             	sub    $0x8,%esp
+  80068f:	53                   	push   %ebx
+  800690:	6a 20                	push   $0x20
+  800692:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800694:	83 ef 01             	sub    $0x1,%edi
+  800697:	83 c4 10             	add    $0x10,%esp
+  80069a:	85 ff                	test   %edi,%edi
+  80069c:	7f ee                	jg     80068c <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80069e:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8006a1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006a4:	e9 36 01 00 00       	jmp    8007df <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  8006a9:	83 f9 01             	cmp    $0x1,%ecx
+  8006ac:	7f 1f                	jg     8006cd <vprintfmt+0x28f>
+	else if (lflag)
+  8006ae:	85 c9                	test   %ecx,%ecx
+  8006b0:	74 67                	je     800719 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8006b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b5:	8b 00                	mov    (%eax),%eax
+  8006b7:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006ba:	89 c1                	mov    %eax,%ecx
+  8006bc:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006bf:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006c2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c5:	8d 40 04             	lea    0x4(%eax),%eax
+  8006c8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006cb:	eb 17                	jmp    8006e4 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8006cd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d0:	8b 50 04             	mov    0x4(%eax),%edx
+  8006d3:	8b 00                	mov    (%eax),%eax
+  8006d5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006d8:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8006db:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006de:	8d 40 08             	lea    0x8(%eax),%eax
+  8006e1:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8006e4:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006e7:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8006ea:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8006ef:	85 c9                	test   %ecx,%ecx
+  8006f1:	0f 89 ce 00 00 00    	jns    8007c5 <vprintfmt+0x387>
+				putch('-', putdat);
+  8006f7:	83 ec 08             	sub    $0x8,%esp
+  8006fa:	53                   	push   %ebx
+  8006fb:	6a 2d                	push   $0x2d
+  8006fd:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8006ff:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800702:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800705:	f7 da                	neg    %edx
+  800707:	83 d1 00             	adc    $0x0,%ecx
+  80070a:	f7 d9                	neg    %ecx
+  80070c:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80070f:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800714:	e9 ac 00 00 00       	jmp    8007c5 <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  800719:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071c:	8b 00                	mov    (%eax),%eax
+  80071e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800721:	89 c1                	mov    %eax,%ecx
+  800723:	c1 f9 1f             	sar    $0x1f,%ecx
+  800726:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800729:	8b 45 14             	mov    0x14(%ebp),%eax
+  80072c:	8d 40 04             	lea    0x4(%eax),%eax
+  80072f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800732:	eb b0                	jmp    8006e4 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800734:	83 f9 01             	cmp    $0x1,%ecx
+  800737:	7f 1b                	jg     800754 <vprintfmt+0x316>
+	else if (lflag)
+  800739:	85 c9                	test   %ecx,%ecx
+  80073b:	74 2c                	je     800769 <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  80073d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800740:	8b 10                	mov    (%eax),%edx
+  800742:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800747:	8d 40 04             	lea    0x4(%eax),%eax
+  80074a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80074d:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800752:	eb 71                	jmp    8007c5 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  800754:	8b 45 14             	mov    0x14(%ebp),%eax
+  800757:	8b 10                	mov    (%eax),%edx
+  800759:	8b 48 04             	mov    0x4(%eax),%ecx
+  80075c:	8d 40 08             	lea    0x8(%eax),%eax
+  80075f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800762:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800767:	eb 5c                	jmp    8007c5 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  800769:	8b 45 14             	mov    0x14(%ebp),%eax
+  80076c:	8b 10                	mov    (%eax),%edx
+  80076e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800773:	8d 40 04             	lea    0x4(%eax),%eax
+  800776:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800779:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80077e:	eb 45                	jmp    8007c5 <vprintfmt+0x387>
+			putch('X', putdat);
+  800780:	83 ec 08             	sub    $0x8,%esp
+  800783:	53                   	push   %ebx
+  800784:	6a 58                	push   $0x58
+  800786:	ff d6                	call   *%esi
+			putch('X', putdat);
+  800788:	83 c4 08             	add    $0x8,%esp
+  80078b:	53                   	push   %ebx
+  80078c:	6a 58                	push   $0x58
+  80078e:	ff d6                	call   *%esi
+			putch('X', putdat);
+  800790:	83 c4 08             	add    $0x8,%esp
+  800793:	53                   	push   %ebx
+  800794:	6a 58                	push   $0x58
+  800796:	ff d6                	call   *%esi
+			break;
+  800798:	83 c4 10             	add    $0x10,%esp
+  80079b:	eb 42                	jmp    8007df <vprintfmt+0x3a1>
+			putch('0', putdat);
+  80079d:	83 ec 08             	sub    $0x8,%esp
+  8007a0:	53                   	push   %ebx
+  8007a1:	6a 30                	push   $0x30
+  8007a3:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8007a5:	83 c4 08             	add    $0x8,%esp
+  8007a8:	53                   	push   %ebx
+  8007a9:	6a 78                	push   $0x78
+  8007ab:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8007ad:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b0:	8b 10                	mov    (%eax),%edx
+  8007b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8007b7:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8007ba:	8d 40 04             	lea    0x4(%eax),%eax
+  8007bd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007c0:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8007c5:	83 ec 0c             	sub    $0xc,%esp
+  8007c8:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8007cc:	50                   	push   %eax
+  8007cd:	ff 75 e0             	push   -0x20(%ebp)
+  8007d0:	57                   	push   %edi
+  8007d1:	51                   	push   %ecx
+  8007d2:	52                   	push   %edx
+  8007d3:	89 da                	mov    %ebx,%edx
+  8007d5:	89 f0                	mov    %esi,%eax
+  8007d7:	e8 7f fb ff ff       	call   80035b <printnum>
+			break;
+  8007dc:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8007df:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8007e2:	e9 75 fc ff ff       	jmp    80045c <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8007e7:	83 f9 01             	cmp    $0x1,%ecx
+  8007ea:	7f 1b                	jg     800807 <vprintfmt+0x3c9>
+	else if (lflag)
+  8007ec:	85 c9                	test   %ecx,%ecx
+  8007ee:	74 2c                	je     80081c <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  8007f0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007f3:	8b 10                	mov    (%eax),%edx
+  8007f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007fa:	8d 40 04             	lea    0x4(%eax),%eax
+  8007fd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800800:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800805:	eb be                	jmp    8007c5 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  800807:	8b 45 14             	mov    0x14(%ebp),%eax
+  80080a:	8b 10                	mov    (%eax),%edx
+  80080c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80080f:	8d 40 08             	lea    0x8(%eax),%eax
+  800812:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800815:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80081a:	eb a9                	jmp    8007c5 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  80081c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80081f:	8b 10                	mov    (%eax),%edx
+  800821:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800826:	8d 40 04             	lea    0x4(%eax),%eax
+  800829:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80082c:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800831:	eb 92                	jmp    8007c5 <vprintfmt+0x387>
+			putch(ch, putdat);
+  800833:	83 ec 08             	sub    $0x8,%esp
+  800836:	53                   	push   %ebx
+  800837:	6a 25                	push   $0x25
+  800839:	ff d6                	call   *%esi
+			break;
+  80083b:	83 c4 10             	add    $0x10,%esp
+  80083e:	eb 9f                	jmp    8007df <vprintfmt+0x3a1>
+			putch('%', putdat);
+  800840:	83 ec 08             	sub    $0x8,%esp
+  800843:	53                   	push   %ebx
+  800844:	6a 25                	push   $0x25
+  800846:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800848:	83 c4 10             	add    $0x10,%esp
+  80084b:	89 f8                	mov    %edi,%eax
+  80084d:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800851:	74 05                	je     800858 <vprintfmt+0x41a>
+  800853:	83 e8 01             	sub    $0x1,%eax
+  800856:	eb f5                	jmp    80084d <vprintfmt+0x40f>
+  800858:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80085b:	eb 82                	jmp    8007df <vprintfmt+0x3a1>
+
+0080085d <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80085d:	55                   	push   %ebp
+  80085e:	89 e5                	mov    %esp,%ebp
+  800860:	83 ec 18             	sub    $0x18,%esp
+  800863:	8b 45 08             	mov    0x8(%ebp),%eax
+  800866:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800869:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80086c:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800870:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800873:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80087a:	85 c0                	test   %eax,%eax
+  80087c:	74 26                	je     8008a4 <vsnprintf+0x47>
+  80087e:	85 d2                	test   %edx,%edx
+  800880:	7e 22                	jle    8008a4 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800882:	ff 75 14             	push   0x14(%ebp)
+  800885:	ff 75 10             	push   0x10(%ebp)
+  800888:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80088b:	50                   	push   %eax
+  80088c:	68 04 04 80 00       	push   $0x800404
+  800891:	e8 a8 fb ff ff       	call   80043e <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800896:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800899:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80089c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80089f:	83 c4 10             	add    $0x10,%esp
+}
+  8008a2:	c9                   	leave
+  8008a3:	c3                   	ret
+		return -E_INVAL;
+  8008a4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008a9:	eb f7                	jmp    8008a2 <vsnprintf+0x45>
+
+008008ab <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8008ab:	55                   	push   %ebp
+  8008ac:	89 e5                	mov    %esp,%ebp
+  8008ae:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8008b1:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8008b4:	50                   	push   %eax
+  8008b5:	ff 75 10             	push   0x10(%ebp)
+  8008b8:	ff 75 0c             	push   0xc(%ebp)
+  8008bb:	ff 75 08             	push   0x8(%ebp)
+  8008be:	e8 9a ff ff ff       	call   80085d <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8008c3:	c9                   	leave
+  8008c4:	c3                   	ret
+
+008008c5 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8008c5:	55                   	push   %ebp
+  8008c6:	89 e5                	mov    %esp,%ebp
+  8008c8:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8008cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d0:	eb 03                	jmp    8008d5 <strlen+0x10>
+		n++;
+  8008d2:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8008d5:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8008d9:	75 f7                	jne    8008d2 <strlen+0xd>
+	return n;
+}
+  8008db:	5d                   	pop    %ebp
+  8008dc:	c3                   	ret
+
+008008dd <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8008dd:	55                   	push   %ebp
+  8008de:	89 e5                	mov    %esp,%ebp
+  8008e0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008e3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008eb:	eb 03                	jmp    8008f0 <strnlen+0x13>
+		n++;
+  8008ed:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008f0:	39 d0                	cmp    %edx,%eax
+  8008f2:	74 08                	je     8008fc <strnlen+0x1f>
+  8008f4:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008f8:	75 f3                	jne    8008ed <strnlen+0x10>
+  8008fa:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8008fc:	89 d0                	mov    %edx,%eax
+  8008fe:	5d                   	pop    %ebp
+  8008ff:	c3                   	ret
+
+00800900 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800900:	55                   	push   %ebp
+  800901:	89 e5                	mov    %esp,%ebp
+  800903:	53                   	push   %ebx
+  800904:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800907:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80090a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80090f:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800913:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800916:	83 c0 01             	add    $0x1,%eax
+  800919:	84 d2                	test   %dl,%dl
+  80091b:	75 f2                	jne    80090f <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80091d:	89 c8                	mov    %ecx,%eax
+  80091f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800922:	c9                   	leave
+  800923:	c3                   	ret
+
+00800924 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800924:	55                   	push   %ebp
+  800925:	89 e5                	mov    %esp,%ebp
+  800927:	53                   	push   %ebx
+  800928:	83 ec 10             	sub    $0x10,%esp
+  80092b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80092e:	53                   	push   %ebx
+  80092f:	e8 91 ff ff ff       	call   8008c5 <strlen>
+  800934:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800937:	ff 75 0c             	push   0xc(%ebp)
+  80093a:	01 d8                	add    %ebx,%eax
+  80093c:	50                   	push   %eax
+  80093d:	e8 be ff ff ff       	call   800900 <strcpy>
+	return dst;
+}
+  800942:	89 d8                	mov    %ebx,%eax
+  800944:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800947:	c9                   	leave
+  800948:	c3                   	ret
+
+00800949 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800949:	55                   	push   %ebp
+  80094a:	89 e5                	mov    %esp,%ebp
+  80094c:	56                   	push   %esi
+  80094d:	53                   	push   %ebx
+  80094e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800951:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800954:	89 f3                	mov    %esi,%ebx
+  800956:	03 5d 10             	add    0x10(%ebp),%ebx
+  800959:	89 f0                	mov    %esi,%eax
+  80095b:	eb 0f                	jmp    80096c <strncpy+0x23>
+		*dst++ = *src;
+  80095d:	83 c0 01             	add    $0x1,%eax
+  800960:	0f b6 0a             	movzbl (%edx),%ecx
+  800963:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800966:	80 f9 01             	cmp    $0x1,%cl
+  800969:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80096c:	39 d8                	cmp    %ebx,%eax
+  80096e:	75 ed                	jne    80095d <strncpy+0x14>
+	}
+	return ret;
+}
+  800970:	89 f0                	mov    %esi,%eax
+  800972:	5b                   	pop    %ebx
+  800973:	5e                   	pop    %esi
+  800974:	5d                   	pop    %ebp
+  800975:	c3                   	ret
+
+00800976 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800976:	55                   	push   %ebp
+  800977:	89 e5                	mov    %esp,%ebp
+  800979:	56                   	push   %esi
+  80097a:	53                   	push   %ebx
+  80097b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80097e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800981:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800984:	89 f0                	mov    %esi,%eax
+  800986:	85 d2                	test   %edx,%edx
+  800988:	74 21                	je     8009ab <strlcpy+0x35>
+  80098a:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80098e:	89 f2                	mov    %esi,%edx
+  800990:	eb 09                	jmp    80099b <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800992:	83 c1 01             	add    $0x1,%ecx
+  800995:	83 c2 01             	add    $0x1,%edx
+  800998:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80099b:	39 c2                	cmp    %eax,%edx
+  80099d:	74 09                	je     8009a8 <strlcpy+0x32>
+  80099f:	0f b6 19             	movzbl (%ecx),%ebx
+  8009a2:	84 db                	test   %bl,%bl
+  8009a4:	75 ec                	jne    800992 <strlcpy+0x1c>
+  8009a6:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8009a8:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8009ab:	29 f0                	sub    %esi,%eax
+}
+  8009ad:	5b                   	pop    %ebx
+  8009ae:	5e                   	pop    %esi
+  8009af:	5d                   	pop    %ebp
+  8009b0:	c3                   	ret
+
+008009b1 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8009b1:	55                   	push   %ebp
+  8009b2:	89 e5                	mov    %esp,%ebp
+  8009b4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009b7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8009ba:	eb 06                	jmp    8009c2 <strcmp+0x11>
+		p++, q++;
+  8009bc:	83 c1 01             	add    $0x1,%ecx
+  8009bf:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8009c2:	0f b6 01             	movzbl (%ecx),%eax
+  8009c5:	84 c0                	test   %al,%al
+  8009c7:	74 04                	je     8009cd <strcmp+0x1c>
+  8009c9:	3a 02                	cmp    (%edx),%al
+  8009cb:	74 ef                	je     8009bc <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009cd:	0f b6 c0             	movzbl %al,%eax
+  8009d0:	0f b6 12             	movzbl (%edx),%edx
+  8009d3:	29 d0                	sub    %edx,%eax
+}
+  8009d5:	5d                   	pop    %ebp
+  8009d6:	c3                   	ret
+
+008009d7 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8009d7:	55                   	push   %ebp
+  8009d8:	89 e5                	mov    %esp,%ebp
+  8009da:	53                   	push   %ebx
+  8009db:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009de:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009e1:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8009e4:	eb 09                	jmp    8009ef <strncmp+0x18>
+		n--, p++, q++;
+  8009e6:	83 ea 01             	sub    $0x1,%edx
+  8009e9:	83 c0 01             	add    $0x1,%eax
+  8009ec:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8009ef:	85 d2                	test   %edx,%edx
+  8009f1:	74 18                	je     800a0b <strncmp+0x34>
+  8009f3:	0f b6 18             	movzbl (%eax),%ebx
+  8009f6:	84 db                	test   %bl,%bl
+  8009f8:	74 04                	je     8009fe <strncmp+0x27>
+  8009fa:	3a 19                	cmp    (%ecx),%bl
+  8009fc:	74 e8                	je     8009e6 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009fe:	0f b6 00             	movzbl (%eax),%eax
+  800a01:	0f b6 11             	movzbl (%ecx),%edx
+  800a04:	29 d0                	sub    %edx,%eax
+}
+  800a06:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a09:	c9                   	leave
+  800a0a:	c3                   	ret
+		return 0;
+  800a0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a10:	eb f4                	jmp    800a06 <strncmp+0x2f>
+
+00800a12 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a12:	55                   	push   %ebp
+  800a13:	89 e5                	mov    %esp,%ebp
+  800a15:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a18:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a1c:	eb 03                	jmp    800a21 <strchr+0xf>
+  800a1e:	83 c0 01             	add    $0x1,%eax
+  800a21:	0f b6 10             	movzbl (%eax),%edx
+  800a24:	84 d2                	test   %dl,%dl
+  800a26:	74 06                	je     800a2e <strchr+0x1c>
+		if (*s == c)
+  800a28:	38 ca                	cmp    %cl,%dl
+  800a2a:	75 f2                	jne    800a1e <strchr+0xc>
+  800a2c:	eb 05                	jmp    800a33 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800a2e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a33:	5d                   	pop    %ebp
+  800a34:	c3                   	ret
+
+00800a35 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a35:	55                   	push   %ebp
+  800a36:	89 e5                	mov    %esp,%ebp
+  800a38:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a3b:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a3f:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a42:	38 ca                	cmp    %cl,%dl
+  800a44:	74 09                	je     800a4f <strfind+0x1a>
+  800a46:	84 d2                	test   %dl,%dl
+  800a48:	74 05                	je     800a4f <strfind+0x1a>
+	for (; *s; s++)
+  800a4a:	83 c0 01             	add    $0x1,%eax
+  800a4d:	eb f0                	jmp    800a3f <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800a4f:	5d                   	pop    %ebp
+  800a50:	c3                   	ret
+
+00800a51 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a51:	55                   	push   %ebp
+  800a52:	89 e5                	mov    %esp,%ebp
+  800a54:	57                   	push   %edi
+  800a55:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a58:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a5b:	85 c9                	test   %ecx,%ecx
+  800a5d:	74 20                	je     800a7f <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a5f:	89 f8                	mov    %edi,%eax
+  800a61:	09 c8                	or     %ecx,%eax
+  800a63:	a8 03                	test   $0x3,%al
+  800a65:	75 12                	jne    800a79 <memset+0x28>
+		c &= 0xFF;
+  800a67:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a6b:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a71:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a74:	fc                   	cld
+  800a75:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a77:	eb 06                	jmp    800a7f <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a79:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a7c:	fc                   	cld
+  800a7d:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a7f:	89 f8                	mov    %edi,%eax
+  800a81:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a84:	c9                   	leave
+  800a85:	c3                   	ret
+
+00800a86 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a86:	55                   	push   %ebp
+  800a87:	89 e5                	mov    %esp,%ebp
+  800a89:	57                   	push   %edi
+  800a8a:	56                   	push   %esi
+  800a8b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a8e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a91:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a94:	39 c6                	cmp    %eax,%esi
+  800a96:	73 32                	jae    800aca <memmove+0x44>
+  800a98:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a9b:	39 d0                	cmp    %edx,%eax
+  800a9d:	73 2b                	jae    800aca <memmove+0x44>
+		s += n;
+		d += n;
+  800a9f:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800aa2:	89 d6                	mov    %edx,%esi
+  800aa4:	09 fe                	or     %edi,%esi
+  800aa6:	09 ce                	or     %ecx,%esi
+  800aa8:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800aae:	75 0e                	jne    800abe <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800ab0:	83 ef 04             	sub    $0x4,%edi
+  800ab3:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800ab6:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800ab9:	fd                   	std
+  800aba:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800abc:	eb 09                	jmp    800ac7 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800abe:	83 ef 01             	sub    $0x1,%edi
+  800ac1:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800ac4:	fd                   	std
+  800ac5:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800ac7:	fc                   	cld
+  800ac8:	eb 1a                	jmp    800ae4 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800aca:	89 f2                	mov    %esi,%edx
+  800acc:	09 c2                	or     %eax,%edx
+  800ace:	09 ca                	or     %ecx,%edx
+  800ad0:	f6 c2 03             	test   $0x3,%dl
+  800ad3:	75 0a                	jne    800adf <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800ad5:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800ad8:	89 c7                	mov    %eax,%edi
+  800ada:	fc                   	cld
+  800adb:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800add:	eb 05                	jmp    800ae4 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800adf:	89 c7                	mov    %eax,%edi
+  800ae1:	fc                   	cld
+  800ae2:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800ae4:	5e                   	pop    %esi
+  800ae5:	5f                   	pop    %edi
+  800ae6:	5d                   	pop    %ebp
+  800ae7:	c3                   	ret
+
+00800ae8 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800ae8:	55                   	push   %ebp
+  800ae9:	89 e5                	mov    %esp,%ebp
+  800aeb:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800aee:	ff 75 10             	push   0x10(%ebp)
+  800af1:	ff 75 0c             	push   0xc(%ebp)
+  800af4:	ff 75 08             	push   0x8(%ebp)
+  800af7:	e8 8a ff ff ff       	call   800a86 <memmove>
+}
+  800afc:	c9                   	leave
+  800afd:	c3                   	ret
+
+00800afe <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800afe:	55                   	push   %ebp
+  800aff:	89 e5                	mov    %esp,%ebp
+  800b01:	56                   	push   %esi
+  800b02:	53                   	push   %ebx
+  800b03:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b06:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800b09:	89 c6                	mov    %eax,%esi
+  800b0b:	03 75 10             	add    0x10(%ebp),%esi
+  800b0e:	eb 06                	jmp    800b16 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800b10:	83 c0 01             	add    $0x1,%eax
+  800b13:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b16:	39 f0                	cmp    %esi,%eax
+  800b18:	74 14                	je     800b2e <memcmp+0x30>
+		if (*s1 != *s2)
+  800b1a:	0f b6 08             	movzbl (%eax),%ecx
+  800b1d:	0f b6 1a             	movzbl (%edx),%ebx
+  800b20:	38 d9                	cmp    %bl,%cl
+  800b22:	74 ec                	je     800b10 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800b24:	0f b6 c1             	movzbl %cl,%eax
+  800b27:	0f b6 db             	movzbl %bl,%ebx
+  800b2a:	29 d8                	sub    %ebx,%eax
+  800b2c:	eb 05                	jmp    800b33 <memcmp+0x35>
+	}
+
+	return 0;
+  800b2e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b33:	5b                   	pop    %ebx
+  800b34:	5e                   	pop    %esi
+  800b35:	5d                   	pop    %ebp
+  800b36:	c3                   	ret
+
+00800b37 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b37:	55                   	push   %ebp
+  800b38:	89 e5                	mov    %esp,%ebp
+  800b3a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b3d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b40:	89 c2                	mov    %eax,%edx
+  800b42:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b45:	eb 03                	jmp    800b4a <memfind+0x13>
+  800b47:	83 c0 01             	add    $0x1,%eax
+  800b4a:	39 d0                	cmp    %edx,%eax
+  800b4c:	73 04                	jae    800b52 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b4e:	38 08                	cmp    %cl,(%eax)
+  800b50:	75 f5                	jne    800b47 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800b52:	5d                   	pop    %ebp
+  800b53:	c3                   	ret
+
+00800b54 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800b54:	55                   	push   %ebp
+  800b55:	89 e5                	mov    %esp,%ebp
+  800b57:	57                   	push   %edi
+  800b58:	56                   	push   %esi
+  800b59:	53                   	push   %ebx
+  800b5a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b5d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b60:	eb 03                	jmp    800b65 <strtol+0x11>
+		s++;
+  800b62:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800b65:	0f b6 02             	movzbl (%edx),%eax
+  800b68:	3c 20                	cmp    $0x20,%al
+  800b6a:	74 f6                	je     800b62 <strtol+0xe>
+  800b6c:	3c 09                	cmp    $0x9,%al
+  800b6e:	74 f2                	je     800b62 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b70:	3c 2b                	cmp    $0x2b,%al
+  800b72:	74 2a                	je     800b9e <strtol+0x4a>
+	int neg = 0;
+  800b74:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800b79:	3c 2d                	cmp    $0x2d,%al
+  800b7b:	74 2b                	je     800ba8 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b7d:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b83:	75 0f                	jne    800b94 <strtol+0x40>
+  800b85:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b88:	74 28                	je     800bb2 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b8a:	85 db                	test   %ebx,%ebx
+  800b8c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b91:	0f 44 d8             	cmove  %eax,%ebx
+  800b94:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b99:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b9c:	eb 46                	jmp    800be4 <strtol+0x90>
+		s++;
+  800b9e:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800ba1:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ba6:	eb d5                	jmp    800b7d <strtol+0x29>
+		s++, neg = 1;
+  800ba8:	83 c2 01             	add    $0x1,%edx
+  800bab:	bf 01 00 00 00       	mov    $0x1,%edi
+  800bb0:	eb cb                	jmp    800b7d <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800bb2:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800bb6:	74 0e                	je     800bc6 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800bb8:	85 db                	test   %ebx,%ebx
+  800bba:	75 d8                	jne    800b94 <strtol+0x40>
+		s++, base = 8;
+  800bbc:	83 c2 01             	add    $0x1,%edx
+  800bbf:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800bc4:	eb ce                	jmp    800b94 <strtol+0x40>
+		s += 2, base = 16;
+  800bc6:	83 c2 02             	add    $0x2,%edx
+  800bc9:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800bce:	eb c4                	jmp    800b94 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800bd0:	0f be c0             	movsbl %al,%eax
+  800bd3:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800bd6:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800bd9:	7d 3a                	jge    800c15 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800bdb:	83 c2 01             	add    $0x1,%edx
+  800bde:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800be2:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800be4:	0f b6 02             	movzbl (%edx),%eax
+  800be7:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800bea:	89 f3                	mov    %esi,%ebx
+  800bec:	80 fb 09             	cmp    $0x9,%bl
+  800bef:	76 df                	jbe    800bd0 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800bf1:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800bf4:	89 f3                	mov    %esi,%ebx
+  800bf6:	80 fb 19             	cmp    $0x19,%bl
+  800bf9:	77 08                	ja     800c03 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800bfb:	0f be c0             	movsbl %al,%eax
+  800bfe:	83 e8 57             	sub    $0x57,%eax
+  800c01:	eb d3                	jmp    800bd6 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800c03:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c06:	89 f3                	mov    %esi,%ebx
+  800c08:	80 fb 19             	cmp    $0x19,%bl
+  800c0b:	77 08                	ja     800c15 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800c0d:	0f be c0             	movsbl %al,%eax
+  800c10:	83 e8 37             	sub    $0x37,%eax
+  800c13:	eb c1                	jmp    800bd6 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c15:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c19:	74 05                	je     800c20 <strtol+0xcc>
+		*endptr = (char *) s;
+  800c1b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c1e:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800c20:	89 c8                	mov    %ecx,%eax
+  800c22:	f7 d8                	neg    %eax
+  800c24:	85 ff                	test   %edi,%edi
+  800c26:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800c29:	89 c8                	mov    %ecx,%eax
+  800c2b:	5b                   	pop    %ebx
+  800c2c:	5e                   	pop    %esi
+  800c2d:	5f                   	pop    %edi
+  800c2e:	5d                   	pop    %ebp
+  800c2f:	c3                   	ret
+
+00800c30 <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800c30:	55                   	push   %ebp
+  800c31:	89 e5                	mov    %esp,%ebp
+  800c33:	57                   	push   %edi
+  800c34:	56                   	push   %esi
+  800c35:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800c36:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c3b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c3e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c41:	89 c3                	mov    %eax,%ebx
+  800c43:	89 c7                	mov    %eax,%edi
+  800c45:	89 c6                	mov    %eax,%esi
+  800c47:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  800c49:	5b                   	pop    %ebx
+  800c4a:	5e                   	pop    %esi
+  800c4b:	5f                   	pop    %edi
+  800c4c:	5d                   	pop    %ebp
+  800c4d:	c3                   	ret
+
+00800c4e <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800c4e:	55                   	push   %ebp
+  800c4f:	89 e5                	mov    %esp,%ebp
+  800c51:	57                   	push   %edi
+  800c52:	56                   	push   %esi
+  800c53:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800c54:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c59:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c5e:	89 d1                	mov    %edx,%ecx
+  800c60:	89 d3                	mov    %edx,%ebx
+  800c62:	89 d7                	mov    %edx,%edi
+  800c64:	89 d6                	mov    %edx,%esi
+  800c66:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c68:	5b                   	pop    %ebx
+  800c69:	5e                   	pop    %esi
+  800c6a:	5f                   	pop    %edi
+  800c6b:	5d                   	pop    %ebp
+  800c6c:	c3                   	ret
+
+00800c6d <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800c6d:	55                   	push   %ebp
+  800c6e:	89 e5                	mov    %esp,%ebp
+  800c70:	57                   	push   %edi
+  800c71:	56                   	push   %esi
+  800c72:	53                   	push   %ebx
+  800c73:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c76:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c7b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c7e:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c83:	89 cb                	mov    %ecx,%ebx
+  800c85:	89 cf                	mov    %ecx,%edi
+  800c87:	89 ce                	mov    %ecx,%esi
+  800c89:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c8b:	85 c0                	test   %eax,%eax
+  800c8d:	7f 08                	jg     800c97 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c8f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c92:	5b                   	pop    %ebx
+  800c93:	5e                   	pop    %esi
+  800c94:	5f                   	pop    %edi
+  800c95:	5d                   	pop    %ebp
+  800c96:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c97:	83 ec 0c             	sub    $0xc,%esp
+  800c9a:	50                   	push   %eax
+  800c9b:	6a 03                	push   $0x3
+  800c9d:	68 23 2e 80 00       	push   $0x802e23
+  800ca2:	6a 3e                	push   $0x3e
+  800ca4:	68 40 2e 80 00       	push   $0x802e40
+  800ca9:	e8 be f5 ff ff       	call   80026c <_panic>
+
+00800cae <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800cae:	55                   	push   %ebp
+  800caf:	89 e5                	mov    %esp,%ebp
+  800cb1:	57                   	push   %edi
+  800cb2:	56                   	push   %esi
+  800cb3:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800cb4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cb9:	b8 02 00 00 00       	mov    $0x2,%eax
+  800cbe:	89 d1                	mov    %edx,%ecx
+  800cc0:	89 d3                	mov    %edx,%ebx
+  800cc2:	89 d7                	mov    %edx,%edi
+  800cc4:	89 d6                	mov    %edx,%esi
+  800cc6:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800cc8:	5b                   	pop    %ebx
+  800cc9:	5e                   	pop    %esi
+  800cca:	5f                   	pop    %edi
+  800ccb:	5d                   	pop    %ebp
+  800ccc:	c3                   	ret
+
+00800ccd <sys_yield>:
+
+void
+sys_yield(void) {
+  800ccd:	55                   	push   %ebp
+  800cce:	89 e5                	mov    %esp,%ebp
+  800cd0:	57                   	push   %edi
+  800cd1:	56                   	push   %esi
+  800cd2:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800cd3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cd8:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800cdd:	89 d1                	mov    %edx,%ecx
+  800cdf:	89 d3                	mov    %edx,%ebx
+  800ce1:	89 d7                	mov    %edx,%edi
+  800ce3:	89 d6                	mov    %edx,%esi
+  800ce5:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800ce7:	5b                   	pop    %ebx
+  800ce8:	5e                   	pop    %esi
+  800ce9:	5f                   	pop    %edi
+  800cea:	5d                   	pop    %ebp
+  800ceb:	c3                   	ret
+
+00800cec <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  800cec:	55                   	push   %ebp
+  800ced:	89 e5                	mov    %esp,%ebp
+  800cef:	57                   	push   %edi
+  800cf0:	56                   	push   %esi
+  800cf1:	53                   	push   %ebx
+  800cf2:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800cf5:	be 00 00 00 00       	mov    $0x0,%esi
+  800cfa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cfd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d00:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d05:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d08:	89 f7                	mov    %esi,%edi
+  800d0a:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d0c:	85 c0                	test   %eax,%eax
+  800d0e:	7f 08                	jg     800d18 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800d10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d13:	5b                   	pop    %ebx
+  800d14:	5e                   	pop    %esi
+  800d15:	5f                   	pop    %edi
+  800d16:	5d                   	pop    %ebp
+  800d17:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d18:	83 ec 0c             	sub    $0xc,%esp
+  800d1b:	50                   	push   %eax
+  800d1c:	6a 04                	push   $0x4
+  800d1e:	68 23 2e 80 00       	push   $0x802e23
+  800d23:	6a 3e                	push   $0x3e
+  800d25:	68 40 2e 80 00       	push   $0x802e40
+  800d2a:	e8 3d f5 ff ff       	call   80026c <_panic>
+
+00800d2f <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  800d2f:	55                   	push   %ebp
+  800d30:	89 e5                	mov    %esp,%ebp
+  800d32:	57                   	push   %edi
+  800d33:	56                   	push   %esi
+  800d34:	53                   	push   %ebx
+  800d35:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800d38:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d3b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d3e:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d43:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d46:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d49:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d4c:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d4e:	85 c0                	test   %eax,%eax
+  800d50:	7f 08                	jg     800d5a <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800d52:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d55:	5b                   	pop    %ebx
+  800d56:	5e                   	pop    %esi
+  800d57:	5f                   	pop    %edi
+  800d58:	5d                   	pop    %ebp
+  800d59:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d5a:	83 ec 0c             	sub    $0xc,%esp
+  800d5d:	50                   	push   %eax
+  800d5e:	6a 05                	push   $0x5
+  800d60:	68 23 2e 80 00       	push   $0x802e23
+  800d65:	6a 3e                	push   $0x3e
+  800d67:	68 40 2e 80 00       	push   $0x802e40
+  800d6c:	e8 fb f4 ff ff       	call   80026c <_panic>
+
+00800d71 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  800d71:	55                   	push   %ebp
+  800d72:	89 e5                	mov    %esp,%ebp
+  800d74:	57                   	push   %edi
+  800d75:	56                   	push   %esi
+  800d76:	53                   	push   %ebx
+  800d77:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800d7a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d7f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d82:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d85:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d8a:	89 df                	mov    %ebx,%edi
+  800d8c:	89 de                	mov    %ebx,%esi
+  800d8e:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d90:	85 c0                	test   %eax,%eax
+  800d92:	7f 08                	jg     800d9c <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800d94:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d97:	5b                   	pop    %ebx
+  800d98:	5e                   	pop    %esi
+  800d99:	5f                   	pop    %edi
+  800d9a:	5d                   	pop    %ebp
+  800d9b:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d9c:	83 ec 0c             	sub    $0xc,%esp
+  800d9f:	50                   	push   %eax
+  800da0:	6a 06                	push   $0x6
+  800da2:	68 23 2e 80 00       	push   $0x802e23
+  800da7:	6a 3e                	push   $0x3e
+  800da9:	68 40 2e 80 00       	push   $0x802e40
+  800dae:	e8 b9 f4 ff ff       	call   80026c <_panic>
+
+00800db3 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800db3:	55                   	push   %ebp
+  800db4:	89 e5                	mov    %esp,%ebp
+  800db6:	57                   	push   %edi
+  800db7:	56                   	push   %esi
+  800db8:	53                   	push   %ebx
+  800db9:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800dbc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dc1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dc7:	b8 08 00 00 00       	mov    $0x8,%eax
+  800dcc:	89 df                	mov    %ebx,%edi
+  800dce:	89 de                	mov    %ebx,%esi
+  800dd0:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800dd2:	85 c0                	test   %eax,%eax
+  800dd4:	7f 08                	jg     800dde <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800dd6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dd9:	5b                   	pop    %ebx
+  800dda:	5e                   	pop    %esi
+  800ddb:	5f                   	pop    %edi
+  800ddc:	5d                   	pop    %ebp
+  800ddd:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800dde:	83 ec 0c             	sub    $0xc,%esp
+  800de1:	50                   	push   %eax
+  800de2:	6a 08                	push   $0x8
+  800de4:	68 23 2e 80 00       	push   $0x802e23
+  800de9:	6a 3e                	push   $0x3e
+  800deb:	68 40 2e 80 00       	push   $0x802e40
+  800df0:	e8 77 f4 ff ff       	call   80026c <_panic>
+
+00800df5 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800df5:	55                   	push   %ebp
+  800df6:	89 e5                	mov    %esp,%ebp
+  800df8:	57                   	push   %edi
+  800df9:	56                   	push   %esi
+  800dfa:	53                   	push   %ebx
+  800dfb:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800dfe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e03:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e06:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e09:	b8 09 00 00 00       	mov    $0x9,%eax
+  800e0e:	89 df                	mov    %ebx,%edi
+  800e10:	89 de                	mov    %ebx,%esi
+  800e12:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e14:	85 c0                	test   %eax,%eax
+  800e16:	7f 08                	jg     800e20 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800e18:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e1b:	5b                   	pop    %ebx
+  800e1c:	5e                   	pop    %esi
+  800e1d:	5f                   	pop    %edi
+  800e1e:	5d                   	pop    %ebp
+  800e1f:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e20:	83 ec 0c             	sub    $0xc,%esp
+  800e23:	50                   	push   %eax
+  800e24:	6a 09                	push   $0x9
+  800e26:	68 23 2e 80 00       	push   $0x802e23
+  800e2b:	6a 3e                	push   $0x3e
+  800e2d:	68 40 2e 80 00       	push   $0x802e40
+  800e32:	e8 35 f4 ff ff       	call   80026c <_panic>
+
+00800e37 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800e37:	55                   	push   %ebp
+  800e38:	89 e5                	mov    %esp,%ebp
+  800e3a:	57                   	push   %edi
+  800e3b:	56                   	push   %esi
+  800e3c:	53                   	push   %ebx
+  800e3d:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800e40:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e45:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e48:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e4b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e50:	89 df                	mov    %ebx,%edi
+  800e52:	89 de                	mov    %ebx,%esi
+  800e54:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e56:	85 c0                	test   %eax,%eax
+  800e58:	7f 08                	jg     800e62 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800e5a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e5d:	5b                   	pop    %ebx
+  800e5e:	5e                   	pop    %esi
+  800e5f:	5f                   	pop    %edi
+  800e60:	5d                   	pop    %ebp
+  800e61:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e62:	83 ec 0c             	sub    $0xc,%esp
+  800e65:	50                   	push   %eax
+  800e66:	6a 0a                	push   $0xa
+  800e68:	68 23 2e 80 00       	push   $0x802e23
+  800e6d:	6a 3e                	push   $0x3e
+  800e6f:	68 40 2e 80 00       	push   $0x802e40
+  800e74:	e8 f3 f3 ff ff       	call   80026c <_panic>
+
+00800e79 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  800e79:	55                   	push   %ebp
+  800e7a:	89 e5                	mov    %esp,%ebp
+  800e7c:	57                   	push   %edi
+  800e7d:	56                   	push   %esi
+  800e7e:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e7f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e82:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e85:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800e8a:	be 00 00 00 00       	mov    $0x0,%esi
+  800e8f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e92:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e95:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800e97:	5b                   	pop    %ebx
+  800e98:	5e                   	pop    %esi
+  800e99:	5f                   	pop    %edi
+  800e9a:	5d                   	pop    %ebp
+  800e9b:	c3                   	ret
+
+00800e9c <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  800e9c:	55                   	push   %ebp
+  800e9d:	89 e5                	mov    %esp,%ebp
+  800e9f:	57                   	push   %edi
+  800ea0:	56                   	push   %esi
+  800ea1:	53                   	push   %ebx
+  800ea2:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800ea5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800eaa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ead:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800eb2:	89 cb                	mov    %ecx,%ebx
+  800eb4:	89 cf                	mov    %ecx,%edi
+  800eb6:	89 ce                	mov    %ecx,%esi
+  800eb8:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800eba:	85 c0                	test   %eax,%eax
+  800ebc:	7f 08                	jg     800ec6 <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  800ebe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ec1:	5b                   	pop    %ebx
+  800ec2:	5e                   	pop    %esi
+  800ec3:	5f                   	pop    %edi
+  800ec4:	5d                   	pop    %ebp
+  800ec5:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ec6:	83 ec 0c             	sub    $0xc,%esp
+  800ec9:	50                   	push   %eax
+  800eca:	6a 0d                	push   $0xd
+  800ecc:	68 23 2e 80 00       	push   $0x802e23
+  800ed1:	6a 3e                	push   $0x3e
+  800ed3:	68 40 2e 80 00       	push   $0x802e40
+  800ed8:	e8 8f f3 ff ff       	call   80026c <_panic>
+
+00800edd <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  800edd:	55                   	push   %ebp
+  800ede:	89 e5                	mov    %esp,%ebp
+  800ee0:	57                   	push   %edi
+  800ee1:	56                   	push   %esi
+  800ee2:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800ee3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ee8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eeb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eee:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800ef3:	89 df                	mov    %ebx,%edi
+  800ef5:	89 de                	mov    %ebx,%esi
+  800ef7:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  800ef9:	5b                   	pop    %ebx
+  800efa:	5e                   	pop    %esi
+  800efb:	5f                   	pop    %edi
+  800efc:	5d                   	pop    %ebp
+  800efd:	c3                   	ret
+
+00800efe <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  800efe:	55                   	push   %ebp
+  800eff:	89 e5                	mov    %esp,%ebp
+  800f01:	57                   	push   %edi
+  800f02:	56                   	push   %esi
+  800f03:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800f04:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f09:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f0c:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f11:	89 cb                	mov    %ecx,%ebx
+  800f13:	89 cf                	mov    %ecx,%edi
+  800f15:	89 ce                	mov    %ecx,%esi
+  800f17:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  800f19:	5b                   	pop    %ebx
+  800f1a:	5e                   	pop    %esi
+  800f1b:	5f                   	pop    %edi
+  800f1c:	5d                   	pop    %ebp
+  800f1d:	c3                   	ret
+
+00800f1e <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  800f1e:	55                   	push   %ebp
+  800f1f:	89 e5                	mov    %esp,%ebp
+  800f21:	57                   	push   %edi
+  800f22:	56                   	push   %esi
+  800f23:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800f24:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f29:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f2e:	89 d1                	mov    %edx,%ecx
+  800f30:	89 d3                	mov    %edx,%ebx
+  800f32:	89 d7                	mov    %edx,%edi
+  800f34:	89 d6                	mov    %edx,%esi
+  800f36:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800f38:	5b                   	pop    %ebx
+  800f39:	5e                   	pop    %esi
+  800f3a:	5f                   	pop    %edi
+  800f3b:	5d                   	pop    %ebp
+  800f3c:	c3                   	ret
+
+00800f3d <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  800f3d:	55                   	push   %ebp
+  800f3e:	89 e5                	mov    %esp,%ebp
+  800f40:	57                   	push   %edi
+  800f41:	56                   	push   %esi
+  800f42:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800f43:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f48:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f4b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f4e:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f53:	89 df                	mov    %ebx,%edi
+  800f55:	89 de                	mov    %ebx,%esi
+  800f57:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800f59:	5b                   	pop    %ebx
+  800f5a:	5e                   	pop    %esi
+  800f5b:	5f                   	pop    %edi
+  800f5c:	5d                   	pop    %ebp
+  800f5d:	c3                   	ret
+
+00800f5e <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  800f5e:	55                   	push   %ebp
+  800f5f:	89 e5                	mov    %esp,%ebp
+  800f61:	57                   	push   %edi
+  800f62:	56                   	push   %esi
+  800f63:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800f64:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f69:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f6c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f6f:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f74:	89 df                	mov    %ebx,%edi
+  800f76:	89 de                	mov    %ebx,%esi
+  800f78:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800f7a:	5b                   	pop    %ebx
+  800f7b:	5e                   	pop    %esi
+  800f7c:	5f                   	pop    %edi
+  800f7d:	5d                   	pop    %ebp
+  800f7e:	c3                   	ret
+
+00800f7f <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  800f7f:	55                   	push   %ebp
+  800f80:	89 e5                	mov    %esp,%ebp
+  800f82:	57                   	push   %edi
+  800f83:	56                   	push   %esi
+  800f84:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800f85:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f8a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f8d:	b8 13 00 00 00       	mov    $0x13,%eax
+  800f92:	89 cb                	mov    %ecx,%ebx
+  800f94:	89 cf                	mov    %ecx,%edi
+  800f96:	89 ce                	mov    %ecx,%esi
+  800f98:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  800f9a:	5b                   	pop    %ebx
+  800f9b:	5e                   	pop    %esi
+  800f9c:	5f                   	pop    %edi
+  800f9d:	5d                   	pop    %ebp
+  800f9e:	c3                   	ret
+
+00800f9f <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  800f9f:	55                   	push   %ebp
+  800fa0:	89 e5                	mov    %esp,%ebp
+  800fa2:	57                   	push   %edi
+  800fa3:	56                   	push   %esi
+  800fa4:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800fa5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800faa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fad:	b8 14 00 00 00       	mov    $0x14,%eax
+  800fb2:	89 cb                	mov    %ecx,%ebx
+  800fb4:	89 cf                	mov    %ecx,%edi
+  800fb6:	89 ce                	mov    %ecx,%esi
+  800fb8:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  800fba:	5b                   	pop    %ebx
+  800fbb:	5e                   	pop    %esi
+  800fbc:	5f                   	pop    %edi
+  800fbd:	5d                   	pop    %ebp
+  800fbe:	c3                   	ret
+
+00800fbf <pgfault>:
+//
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf) {
+  800fbf:	55                   	push   %ebp
+  800fc0:	89 e5                	mov    %esp,%ebp
+  800fc2:	53                   	push   %ebx
+  800fc3:	83 ec 04             	sub    $0x4,%esp
+  800fc6:	8b 45 08             	mov    0x8(%ebp),%eax
+    void *addr = (void *) utf->utf_fault_va;
+  800fc9:	8b 18                	mov    (%eax),%ebx
+    // Hint:
+    //   Use the read-only page table mappings at uvpt
+    //   (see <inc/memlayout.h>).
+
+    // LAB 4: Your code here.
+    if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P) ||
+  800fcb:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  800fcf:	0f 84 95 00 00 00    	je     80106a <pgfault+0xab>
+  800fd5:	89 d8                	mov    %ebx,%eax
+  800fd7:	c1 e8 16             	shr    $0x16,%eax
+  800fda:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  800fe1:	a8 01                	test   $0x1,%al
+  800fe3:	0f 84 81 00 00 00    	je     80106a <pgfault+0xab>
+        (uvpt[PGNUM(addr)] & (PTE_P | PTE_COW)) != (PTE_P | PTE_COW)) {
+  800fe9:	89 d8                	mov    %ebx,%eax
+  800feb:	c1 e8 0c             	shr    $0xc,%eax
+  800fee:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800ff5:	25 01 08 00 00       	and    $0x801,%eax
+    if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P) ||
+  800ffa:	3d 01 08 00 00       	cmp    $0x801,%eax
+  800fff:	75 69                	jne    80106a <pgfault+0xab>
+    // Hint:
+    //   You should make three system calls.
+
+    // LAB 4: Your code here.
+
+    if (sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W))
+  801001:	83 ec 04             	sub    $0x4,%esp
+  801004:	6a 07                	push   $0x7
+  801006:	68 00 f0 7f 00       	push   $0x7ff000
+  80100b:	6a 00                	push   $0x0
+  80100d:	e8 da fc ff ff       	call   800cec <sys_page_alloc>
+  801012:	83 c4 10             	add    $0x10,%esp
+  801015:	85 c0                	test   %eax,%eax
+  801017:	75 65                	jne    80107e <pgfault+0xbf>
+        panic("sys_page_alloc failed");
+
+    addr = ROUNDDOWN(addr, PGSIZE);
+  801019:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+    memmove(PFTEMP, addr, PGSIZE);
+  80101f:	83 ec 04             	sub    $0x4,%esp
+  801022:	68 00 10 00 00       	push   $0x1000
+  801027:	53                   	push   %ebx
+  801028:	68 00 f0 7f 00       	push   $0x7ff000
+  80102d:	e8 54 fa ff ff       	call   800a86 <memmove>
+
+    if (sys_page_map(0, PFTEMP, 0, addr, PTE_P | PTE_U | PTE_W))
+  801032:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801039:	53                   	push   %ebx
+  80103a:	6a 00                	push   $0x0
+  80103c:	68 00 f0 7f 00       	push   $0x7ff000
+  801041:	6a 00                	push   $0x0
+  801043:	e8 e7 fc ff ff       	call   800d2f <sys_page_map>
+  801048:	83 c4 20             	add    $0x20,%esp
+  80104b:	85 c0                	test   %eax,%eax
+  80104d:	75 43                	jne    801092 <pgfault+0xd3>
+        panic("sys_page_map failed");
+    if (sys_page_unmap(0, PFTEMP))
+  80104f:	83 ec 08             	sub    $0x8,%esp
+  801052:	68 00 f0 7f 00       	push   $0x7ff000
+  801057:	6a 00                	push   $0x0
+  801059:	e8 13 fd ff ff       	call   800d71 <sys_page_unmap>
+  80105e:	83 c4 10             	add    $0x10,%esp
+  801061:	85 c0                	test   %eax,%eax
+  801063:	75 41                	jne    8010a6 <pgfault+0xe7>
+        panic("sys_page_unmap failed");
+
+}
+  801065:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801068:	c9                   	leave
+  801069:	c3                   	ret
+        panic("pgfault: faulting access invalid");
+  80106a:	83 ec 04             	sub    $0x4,%esp
+  80106d:	68 50 2e 80 00       	push   $0x802e50
+  801072:	6a 1e                	push   $0x1e
+  801074:	68 bc 2e 80 00       	push   $0x802ebc
+  801079:	e8 ee f1 ff ff       	call   80026c <_panic>
+        panic("sys_page_alloc failed");
+  80107e:	83 ec 04             	sub    $0x4,%esp
+  801081:	68 19 2f 80 00       	push   $0x802f19
+  801086:	6a 2a                	push   $0x2a
+  801088:	68 bc 2e 80 00       	push   $0x802ebc
+  80108d:	e8 da f1 ff ff       	call   80026c <_panic>
+        panic("sys_page_map failed");
+  801092:	83 ec 04             	sub    $0x4,%esp
+  801095:	68 c7 2e 80 00       	push   $0x802ec7
+  80109a:	6a 30                	push   $0x30
+  80109c:	68 bc 2e 80 00       	push   $0x802ebc
+  8010a1:	e8 c6 f1 ff ff       	call   80026c <_panic>
+        panic("sys_page_unmap failed");
+  8010a6:	83 ec 04             	sub    $0x4,%esp
+  8010a9:	68 8d 2a 80 00       	push   $0x802a8d
+  8010ae:	6a 32                	push   $0x32
+  8010b0:	68 bc 2e 80 00       	push   $0x802ebc
+  8010b5:	e8 b2 f1 ff ff       	call   80026c <_panic>
+
+008010ba <fork>:
+//   Remember to fix "thisenv" in the child process.
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void) {
+  8010ba:	55                   	push   %ebp
+  8010bb:	89 e5                	mov    %esp,%ebp
+  8010bd:	57                   	push   %edi
+  8010be:	56                   	push   %esi
+  8010bf:	53                   	push   %ebx
+  8010c0:	83 ec 18             	sub    $0x18,%esp
+    // LAB 4: Your code here.
+    set_pgfault_handler(pgfault);
+  8010c3:	68 bf 0f 80 00       	push   $0x800fbf
+  8010c8:	e8 1a 13 00 00       	call   8023e7 <set_pgfault_handler>
+
+// This must be inlined.  Exercise for reader: why?
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+  envid_t ret;
+  asm volatile("int %2"
+  8010cd:	b8 07 00 00 00       	mov    $0x7,%eax
+  8010d2:	cd 30                	int    $0x30
+  8010d4:	89 c6                	mov    %eax,%esi
+
+    envid_t envid = sys_exofork();
+    if (envid < 0)
+  8010d6:	83 c4 10             	add    $0x10,%esp
+  8010d9:	85 c0                	test   %eax,%eax
+  8010db:	78 2a                	js     801107 <fork+0x4d>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+
+    uintptr_t addr;
+    for (addr = 0; addr < UTOP; addr += PGSIZE) {
+  8010dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (envid == 0) {
+  8010e2:	0f 85 a2 00 00 00    	jne    80118a <fork+0xd0>
+        thisenv = &envs[ENVX(sys_getenvid())];
+  8010e8:	e8 c1 fb ff ff       	call   800cae <sys_getenvid>
+  8010ed:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8010f2:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8010f5:	c1 e0 04             	shl    $0x4,%eax
+  8010f8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8010fd:	a3 08 50 80 00       	mov    %eax,0x805008
+        return 0;
+  801102:	e9 6c 01 00 00       	jmp    801273 <fork+0x1b9>
+        panic("fork: sys_exofork error: %e", envid);
+  801107:	50                   	push   %eax
+  801108:	68 db 2e 80 00       	push   $0x802edb
+  80110d:	6a 6f                	push   $0x6f
+  80110f:	68 bc 2e 80 00       	push   $0x802ebc
+  801114:	e8 53 f1 ff ff       	call   80026c <_panic>
+        if ((r = sys_page_map(0, vptr, envid, vptr, uvpt[pn] & PTE_SYSCALL)) < 0)
+  801119:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801120:	83 ec 0c             	sub    $0xc,%esp
+  801123:	25 07 0e 00 00       	and    $0xe07,%eax
+  801128:	50                   	push   %eax
+  801129:	57                   	push   %edi
+  80112a:	56                   	push   %esi
+  80112b:	57                   	push   %edi
+  80112c:	6a 00                	push   $0x0
+  80112e:	e8 fc fb ff ff       	call   800d2f <sys_page_map>
+  801133:	83 c4 20             	add    $0x20,%esp
+  801136:	85 c0                	test   %eax,%eax
+  801138:	79 3e                	jns    801178 <fork+0xbe>
+            panic("duppage :in sys_page_map %e", r);
+  80113a:	50                   	push   %eax
+  80113b:	68 f7 2e 80 00       	push   $0x802ef7
+  801140:	6a 49                	push   $0x49
+  801142:	68 bc 2e 80 00       	push   $0x802ebc
+  801147:	e8 20 f1 ff ff       	call   80026c <_panic>
+            panic("duppage :in sys_page_map %e", r);
+  80114c:	50                   	push   %eax
+  80114d:	68 f7 2e 80 00       	push   $0x802ef7
+  801152:	6a 4e                	push   $0x4e
+  801154:	68 bc 2e 80 00       	push   $0x802ebc
+  801159:	e8 0e f1 ff ff       	call   80026c <_panic>
+    } else if ((r = sys_page_map(0, vptr, envid, vptr, PTE_P | PTE_U)) < 0)
+  80115e:	83 ec 0c             	sub    $0xc,%esp
+  801161:	6a 05                	push   $0x5
+  801163:	57                   	push   %edi
+  801164:	56                   	push   %esi
+  801165:	57                   	push   %edi
+  801166:	6a 00                	push   $0x0
+  801168:	e8 c2 fb ff ff       	call   800d2f <sys_page_map>
+  80116d:	83 c4 20             	add    $0x20,%esp
+  801170:	85 c0                	test   %eax,%eax
+  801172:	0f 88 ab 00 00 00    	js     801223 <fork+0x169>
+    for (addr = 0; addr < UTOP; addr += PGSIZE) {
+  801178:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80117e:	81 fb 00 00 c0 ee    	cmp    $0xeec00000,%ebx
+  801184:	0f 84 ab 00 00 00    	je     801235 <fork+0x17b>
+        if (uvpd[PDX(addr)] & PTE_P && uvpt[PGNUM(addr)] & PTE_P && addr != UXSTACKTOP - PGSIZE) {
+  80118a:	89 d8                	mov    %ebx,%eax
+  80118c:	c1 e8 16             	shr    $0x16,%eax
+  80118f:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801196:	a8 01                	test   $0x1,%al
+  801198:	74 de                	je     801178 <fork+0xbe>
+  80119a:	89 d8                	mov    %ebx,%eax
+  80119c:	c1 e8 0c             	shr    $0xc,%eax
+  80119f:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8011a6:	f6 c2 01             	test   $0x1,%dl
+  8011a9:	74 cd                	je     801178 <fork+0xbe>
+  8011ab:	81 fb 00 f0 bf ee    	cmp    $0xeebff000,%ebx
+  8011b1:	74 c5                	je     801178 <fork+0xbe>
+    void *vptr = (void *) (pn * PGSIZE);
+  8011b3:	89 c7                	mov    %eax,%edi
+  8011b5:	c1 e7 0c             	shl    $0xc,%edi
+    if (uvpt[pn] & PTE_SHARE) {
+  8011b8:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8011bf:	f6 c6 04             	test   $0x4,%dh
+  8011c2:	0f 85 51 ff ff ff    	jne    801119 <fork+0x5f>
+    } else if (uvpt[pn] & (PTE_W | PTE_COW)) {
+  8011c8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8011cf:	a9 02 08 00 00       	test   $0x802,%eax
+  8011d4:	74 88                	je     80115e <fork+0xa4>
+        if ((r = sys_page_map(0, vptr, envid, vptr, PTE_P | PTE_U | PTE_COW)) < 0)
+  8011d6:	83 ec 0c             	sub    $0xc,%esp
+  8011d9:	68 05 08 00 00       	push   $0x805
+  8011de:	57                   	push   %edi
+  8011df:	56                   	push   %esi
+  8011e0:	57                   	push   %edi
+  8011e1:	6a 00                	push   $0x0
+  8011e3:	e8 47 fb ff ff       	call   800d2f <sys_page_map>
+  8011e8:	83 c4 20             	add    $0x20,%esp
+  8011eb:	85 c0                	test   %eax,%eax
+  8011ed:	0f 88 59 ff ff ff    	js     80114c <fork+0x92>
+        if ((r = sys_page_map(0, vptr, 0, vptr, PTE_P | PTE_U | PTE_COW)) < 0)
+  8011f3:	83 ec 0c             	sub    $0xc,%esp
+  8011f6:	68 05 08 00 00       	push   $0x805
+  8011fb:	57                   	push   %edi
+  8011fc:	6a 00                	push   $0x0
+  8011fe:	57                   	push   %edi
+  8011ff:	6a 00                	push   $0x0
+  801201:	e8 29 fb ff ff       	call   800d2f <sys_page_map>
+  801206:	83 c4 20             	add    $0x20,%esp
+  801209:	85 c0                	test   %eax,%eax
+  80120b:	0f 89 67 ff ff ff    	jns    801178 <fork+0xbe>
+            panic("duppage :in sys_page_map %e", r);
+  801211:	50                   	push   %eax
+  801212:	68 f7 2e 80 00       	push   $0x802ef7
+  801217:	6a 50                	push   $0x50
+  801219:	68 bc 2e 80 00       	push   $0x802ebc
+  80121e:	e8 49 f0 ff ff       	call   80026c <_panic>
+        panic("duppage :in sys_page_map %e", r);
+  801223:	50                   	push   %eax
+  801224:	68 f7 2e 80 00       	push   $0x802ef7
+  801229:	6a 53                	push   $0x53
+  80122b:	68 bc 2e 80 00       	push   $0x802ebc
+  801230:	e8 37 f0 ff ff       	call   80026c <_panic>
+            duppage(envid, PGNUM(addr));
+        }
+    }
+    if (sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W))
+  801235:	83 ec 04             	sub    $0x4,%esp
+  801238:	6a 07                	push   $0x7
+  80123a:	68 00 f0 bf ee       	push   $0xeebff000
+  80123f:	56                   	push   %esi
+  801240:	e8 a7 fa ff ff       	call   800cec <sys_page_alloc>
+  801245:	83 c4 10             	add    $0x10,%esp
+  801248:	85 c0                	test   %eax,%eax
+  80124a:	75 31                	jne    80127d <fork+0x1c3>
+        panic("fork: sys_page_alloc failed");
+    if (sys_env_set_pgfault_upcall(envid, _pgfault_upcall))
+  80124c:	83 ec 08             	sub    $0x8,%esp
+  80124f:	68 52 24 80 00       	push   $0x802452
+  801254:	56                   	push   %esi
+  801255:	e8 dd fb ff ff       	call   800e37 <sys_env_set_pgfault_upcall>
+  80125a:	83 c4 10             	add    $0x10,%esp
+  80125d:	85 c0                	test   %eax,%eax
+  80125f:	75 30                	jne    801291 <fork+0x1d7>
+        panic("fork: sys_env_set_pgfault_upcall failed");
+    if (sys_env_set_status(envid, ENV_RUNNABLE))
+  801261:	83 ec 08             	sub    $0x8,%esp
+  801264:	6a 02                	push   $0x2
+  801266:	56                   	push   %esi
+  801267:	e8 47 fb ff ff       	call   800db3 <sys_env_set_status>
+  80126c:	83 c4 10             	add    $0x10,%esp
+  80126f:	85 c0                	test   %eax,%eax
+  801271:	75 32                	jne    8012a5 <fork+0x1eb>
+        panic("fork: sys_env_set_status failed");
+
+    return envid;
+
+}
+  801273:	89 f0                	mov    %esi,%eax
+  801275:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801278:	5b                   	pop    %ebx
+  801279:	5e                   	pop    %esi
+  80127a:	5f                   	pop    %edi
+  80127b:	5d                   	pop    %ebp
+  80127c:	c3                   	ret
+        panic("fork: sys_page_alloc failed");
+  80127d:	83 ec 04             	sub    $0x4,%esp
+  801280:	68 13 2f 80 00       	push   $0x802f13
+  801285:	6a 7d                	push   $0x7d
+  801287:	68 bc 2e 80 00       	push   $0x802ebc
+  80128c:	e8 db ef ff ff       	call   80026c <_panic>
+        panic("fork: sys_env_set_pgfault_upcall failed");
+  801291:	83 ec 04             	sub    $0x4,%esp
+  801294:	68 74 2e 80 00       	push   $0x802e74
+  801299:	6a 7f                	push   $0x7f
+  80129b:	68 bc 2e 80 00       	push   $0x802ebc
+  8012a0:	e8 c7 ef ff ff       	call   80026c <_panic>
+        panic("fork: sys_env_set_status failed");
+  8012a5:	83 ec 04             	sub    $0x4,%esp
+  8012a8:	68 9c 2e 80 00       	push   $0x802e9c
+  8012ad:	68 81 00 00 00       	push   $0x81
+  8012b2:	68 bc 2e 80 00       	push   $0x802ebc
+  8012b7:	e8 b0 ef ff ff       	call   80026c <_panic>
+
+008012bc <sfork>:
+
+// Challenge!
+int
+sfork(void) {
+  8012bc:	55                   	push   %ebp
+  8012bd:	89 e5                	mov    %esp,%ebp
+  8012bf:	83 ec 0c             	sub    $0xc,%esp
+    panic("sfork not implemented");
+  8012c2:	68 2f 2f 80 00       	push   $0x802f2f
+  8012c7:	68 8a 00 00 00       	push   $0x8a
+  8012cc:	68 bc 2e 80 00       	push   $0x802ebc
+  8012d1:	e8 96 ef ff ff       	call   80026c <_panic>
+
+008012d6 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8012d6:	55                   	push   %ebp
+  8012d7:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8012d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8012dc:	05 00 00 00 30       	add    $0x30000000,%eax
+  8012e1:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8012e4:	5d                   	pop    %ebp
+  8012e5:	c3                   	ret
+
+008012e6 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8012e6:	55                   	push   %ebp
+  8012e7:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8012e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8012ec:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8012f1:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8012f6:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8012fb:	5d                   	pop    %ebp
+  8012fc:	c3                   	ret
+
+008012fd <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8012fd:	55                   	push   %ebp
+  8012fe:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801300:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801305:	eb 02                	jmp    801309 <fd_alloc+0xc>
+  801307:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801309:	89 c2                	mov    %eax,%edx
+  80130b:	c1 ea 16             	shr    $0x16,%edx
+  80130e:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801315:	f6 c2 01             	test   $0x1,%dl
+  801318:	74 2b                	je     801345 <fd_alloc+0x48>
+  80131a:	89 c2                	mov    %eax,%edx
+  80131c:	c1 ea 0c             	shr    $0xc,%edx
+  80131f:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801326:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80132c:	f6 c1 01             	test   $0x1,%cl
+  80132f:	74 14                	je     801345 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801331:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801337:	75 ce                	jne    801307 <fd_alloc+0xa>
+  801339:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80133e:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801343:	eb 05                	jmp    80134a <fd_alloc+0x4d>
+			return 0;
+  801345:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80134a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80134d:	89 02                	mov    %eax,(%edx)
+}
+  80134f:	89 c8                	mov    %ecx,%eax
+  801351:	5d                   	pop    %ebp
+  801352:	c3                   	ret
+
+00801353 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801353:	55                   	push   %ebp
+  801354:	89 e5                	mov    %esp,%ebp
+  801356:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801359:	83 f8 1f             	cmp    $0x1f,%eax
+  80135c:	77 30                	ja     80138e <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80135e:	c1 e0 0c             	shl    $0xc,%eax
+  801361:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801366:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80136c:	f6 c2 01             	test   $0x1,%dl
+  80136f:	74 24                	je     801395 <fd_lookup+0x42>
+  801371:	89 c2                	mov    %eax,%edx
+  801373:	c1 ea 0c             	shr    $0xc,%edx
+  801376:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80137d:	f6 c2 01             	test   $0x1,%dl
+  801380:	74 1a                	je     80139c <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801382:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801385:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801387:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80138c:	5d                   	pop    %ebp
+  80138d:	c3                   	ret
+		return -E_INVAL;
+  80138e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801393:	eb f7                	jmp    80138c <fd_lookup+0x39>
+		return -E_INVAL;
+  801395:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80139a:	eb f0                	jmp    80138c <fd_lookup+0x39>
+  80139c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013a1:	eb e9                	jmp    80138c <fd_lookup+0x39>
+
+008013a3 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8013a3:	55                   	push   %ebp
+  8013a4:	89 e5                	mov    %esp,%ebp
+  8013a6:	53                   	push   %ebx
+  8013a7:	83 ec 04             	sub    $0x4,%esp
+  8013aa:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8013ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013b2:	eb 03                	jmp    8013b7 <dev_lookup+0x14>
+  8013b4:	83 c0 01             	add    $0x1,%eax
+  8013b7:	8b 1c 85 c4 2f 80 00 	mov    0x802fc4(,%eax,4),%ebx
+  8013be:	85 db                	test   %ebx,%ebx
+  8013c0:	74 0b                	je     8013cd <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8013c2:	39 13                	cmp    %edx,(%ebx)
+  8013c4:	75 ee                	jne    8013b4 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8013c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013cb:	eb 1f                	jmp    8013ec <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8013cd:	a1 08 50 80 00       	mov    0x805008,%eax
+  8013d2:	8b 40 48             	mov    0x48(%eax),%eax
+  8013d5:	83 ec 04             	sub    $0x4,%esp
+  8013d8:	52                   	push   %edx
+  8013d9:	50                   	push   %eax
+  8013da:	68 48 2f 80 00       	push   $0x802f48
+  8013df:	e8 63 ef ff ff       	call   800347 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8013e4:	83 c4 10             	add    $0x10,%esp
+  8013e7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8013ec:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8013ef:	89 1a                	mov    %ebx,(%edx)
+}
+  8013f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013f4:	c9                   	leave
+  8013f5:	c3                   	ret
+
+008013f6 <fd_close>:
+{
+  8013f6:	55                   	push   %ebp
+  8013f7:	89 e5                	mov    %esp,%ebp
+  8013f9:	57                   	push   %edi
+  8013fa:	56                   	push   %esi
+  8013fb:	53                   	push   %ebx
+  8013fc:	83 ec 24             	sub    $0x24,%esp
+  8013ff:	8b 75 08             	mov    0x8(%ebp),%esi
+  801402:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801405:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801408:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801409:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80140f:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801412:	50                   	push   %eax
+  801413:	e8 3b ff ff ff       	call   801353 <fd_lookup>
+  801418:	89 c3                	mov    %eax,%ebx
+  80141a:	83 c4 10             	add    $0x10,%esp
+  80141d:	85 c0                	test   %eax,%eax
+  80141f:	78 05                	js     801426 <fd_close+0x30>
+	    || fd != fd2)
+  801421:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801424:	74 16                	je     80143c <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801426:	89 f8                	mov    %edi,%eax
+  801428:	84 c0                	test   %al,%al
+  80142a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80142f:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801432:	89 d8                	mov    %ebx,%eax
+  801434:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801437:	5b                   	pop    %ebx
+  801438:	5e                   	pop    %esi
+  801439:	5f                   	pop    %edi
+  80143a:	5d                   	pop    %ebp
+  80143b:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80143c:	83 ec 08             	sub    $0x8,%esp
+  80143f:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801442:	50                   	push   %eax
+  801443:	ff 36                	push   (%esi)
+  801445:	e8 59 ff ff ff       	call   8013a3 <dev_lookup>
+  80144a:	89 c3                	mov    %eax,%ebx
+  80144c:	83 c4 10             	add    $0x10,%esp
+  80144f:	85 c0                	test   %eax,%eax
+  801451:	78 1a                	js     80146d <fd_close+0x77>
+		if (dev->dev_close)
+  801453:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801456:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801459:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80145e:	85 c0                	test   %eax,%eax
+  801460:	74 0b                	je     80146d <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801462:	83 ec 0c             	sub    $0xc,%esp
+  801465:	56                   	push   %esi
+  801466:	ff d0                	call   *%eax
+  801468:	89 c3                	mov    %eax,%ebx
+  80146a:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80146d:	83 ec 08             	sub    $0x8,%esp
+  801470:	56                   	push   %esi
+  801471:	6a 00                	push   $0x0
+  801473:	e8 f9 f8 ff ff       	call   800d71 <sys_page_unmap>
+	return r;
+  801478:	83 c4 10             	add    $0x10,%esp
+  80147b:	eb b5                	jmp    801432 <fd_close+0x3c>
+
+0080147d <close>:
+
+int
+close(int fdnum)
+{
+  80147d:	55                   	push   %ebp
+  80147e:	89 e5                	mov    %esp,%ebp
+  801480:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801483:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801486:	50                   	push   %eax
+  801487:	ff 75 08             	push   0x8(%ebp)
+  80148a:	e8 c4 fe ff ff       	call   801353 <fd_lookup>
+  80148f:	83 c4 10             	add    $0x10,%esp
+  801492:	85 c0                	test   %eax,%eax
+  801494:	79 02                	jns    801498 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801496:	c9                   	leave
+  801497:	c3                   	ret
+		return fd_close(fd, 1);
+  801498:	83 ec 08             	sub    $0x8,%esp
+  80149b:	6a 01                	push   $0x1
+  80149d:	ff 75 f4             	push   -0xc(%ebp)
+  8014a0:	e8 51 ff ff ff       	call   8013f6 <fd_close>
+  8014a5:	83 c4 10             	add    $0x10,%esp
+  8014a8:	eb ec                	jmp    801496 <close+0x19>
+
+008014aa <close_all>:
+
+void
+close_all(void)
+{
+  8014aa:	55                   	push   %ebp
+  8014ab:	89 e5                	mov    %esp,%ebp
+  8014ad:	53                   	push   %ebx
+  8014ae:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8014b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8014b6:	83 ec 0c             	sub    $0xc,%esp
+  8014b9:	53                   	push   %ebx
+  8014ba:	e8 be ff ff ff       	call   80147d <close>
+	for (i = 0; i < MAXFD; i++)
+  8014bf:	83 c3 01             	add    $0x1,%ebx
+  8014c2:	83 c4 10             	add    $0x10,%esp
+  8014c5:	83 fb 20             	cmp    $0x20,%ebx
+  8014c8:	75 ec                	jne    8014b6 <close_all+0xc>
+}
+  8014ca:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014cd:	c9                   	leave
+  8014ce:	c3                   	ret
+
+008014cf <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8014cf:	55                   	push   %ebp
+  8014d0:	89 e5                	mov    %esp,%ebp
+  8014d2:	57                   	push   %edi
+  8014d3:	56                   	push   %esi
+  8014d4:	53                   	push   %ebx
+  8014d5:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8014d8:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8014db:	50                   	push   %eax
+  8014dc:	ff 75 08             	push   0x8(%ebp)
+  8014df:	e8 6f fe ff ff       	call   801353 <fd_lookup>
+  8014e4:	89 c3                	mov    %eax,%ebx
+  8014e6:	83 c4 10             	add    $0x10,%esp
+  8014e9:	85 c0                	test   %eax,%eax
+  8014eb:	78 7f                	js     80156c <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8014ed:	83 ec 0c             	sub    $0xc,%esp
+  8014f0:	ff 75 0c             	push   0xc(%ebp)
+  8014f3:	e8 85 ff ff ff       	call   80147d <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8014f8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8014fb:	c1 e6 0c             	shl    $0xc,%esi
+  8014fe:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801504:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801507:	89 3c 24             	mov    %edi,(%esp)
+  80150a:	e8 d7 fd ff ff       	call   8012e6 <fd2data>
+  80150f:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801511:	89 34 24             	mov    %esi,(%esp)
+  801514:	e8 cd fd ff ff       	call   8012e6 <fd2data>
+  801519:	83 c4 10             	add    $0x10,%esp
+  80151c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80151f:	89 d8                	mov    %ebx,%eax
+  801521:	c1 e8 16             	shr    $0x16,%eax
+  801524:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80152b:	a8 01                	test   $0x1,%al
+  80152d:	74 11                	je     801540 <dup+0x71>
+  80152f:	89 d8                	mov    %ebx,%eax
+  801531:	c1 e8 0c             	shr    $0xc,%eax
+  801534:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80153b:	f6 c2 01             	test   $0x1,%dl
+  80153e:	75 36                	jne    801576 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801540:	89 f8                	mov    %edi,%eax
+  801542:	c1 e8 0c             	shr    $0xc,%eax
+  801545:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80154c:	83 ec 0c             	sub    $0xc,%esp
+  80154f:	25 07 0e 00 00       	and    $0xe07,%eax
+  801554:	50                   	push   %eax
+  801555:	56                   	push   %esi
+  801556:	6a 00                	push   $0x0
+  801558:	57                   	push   %edi
+  801559:	6a 00                	push   $0x0
+  80155b:	e8 cf f7 ff ff       	call   800d2f <sys_page_map>
+  801560:	89 c3                	mov    %eax,%ebx
+  801562:	83 c4 20             	add    $0x20,%esp
+  801565:	85 c0                	test   %eax,%eax
+  801567:	78 33                	js     80159c <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801569:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80156c:	89 d8                	mov    %ebx,%eax
+  80156e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801571:	5b                   	pop    %ebx
+  801572:	5e                   	pop    %esi
+  801573:	5f                   	pop    %edi
+  801574:	5d                   	pop    %ebp
+  801575:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801576:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80157d:	83 ec 0c             	sub    $0xc,%esp
+  801580:	25 07 0e 00 00       	and    $0xe07,%eax
+  801585:	50                   	push   %eax
+  801586:	ff 75 d4             	push   -0x2c(%ebp)
+  801589:	6a 00                	push   $0x0
+  80158b:	53                   	push   %ebx
+  80158c:	6a 00                	push   $0x0
+  80158e:	e8 9c f7 ff ff       	call   800d2f <sys_page_map>
+  801593:	89 c3                	mov    %eax,%ebx
+  801595:	83 c4 20             	add    $0x20,%esp
+  801598:	85 c0                	test   %eax,%eax
+  80159a:	79 a4                	jns    801540 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80159c:	83 ec 08             	sub    $0x8,%esp
+  80159f:	56                   	push   %esi
+  8015a0:	6a 00                	push   $0x0
+  8015a2:	e8 ca f7 ff ff       	call   800d71 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8015a7:	83 c4 08             	add    $0x8,%esp
+  8015aa:	ff 75 d4             	push   -0x2c(%ebp)
+  8015ad:	6a 00                	push   $0x0
+  8015af:	e8 bd f7 ff ff       	call   800d71 <sys_page_unmap>
+	return r;
+  8015b4:	83 c4 10             	add    $0x10,%esp
+  8015b7:	eb b3                	jmp    80156c <dup+0x9d>
+
+008015b9 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8015b9:	55                   	push   %ebp
+  8015ba:	89 e5                	mov    %esp,%ebp
+  8015bc:	56                   	push   %esi
+  8015bd:	53                   	push   %ebx
+  8015be:	83 ec 18             	sub    $0x18,%esp
+  8015c1:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015c4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8015c7:	50                   	push   %eax
+  8015c8:	56                   	push   %esi
+  8015c9:	e8 85 fd ff ff       	call   801353 <fd_lookup>
+  8015ce:	83 c4 10             	add    $0x10,%esp
+  8015d1:	85 c0                	test   %eax,%eax
+  8015d3:	78 3c                	js     801611 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8015d5:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8015d8:	83 ec 08             	sub    $0x8,%esp
+  8015db:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015de:	50                   	push   %eax
+  8015df:	ff 33                	push   (%ebx)
+  8015e1:	e8 bd fd ff ff       	call   8013a3 <dev_lookup>
+  8015e6:	83 c4 10             	add    $0x10,%esp
+  8015e9:	85 c0                	test   %eax,%eax
+  8015eb:	78 24                	js     801611 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8015ed:	8b 43 08             	mov    0x8(%ebx),%eax
+  8015f0:	83 e0 03             	and    $0x3,%eax
+  8015f3:	83 f8 01             	cmp    $0x1,%eax
+  8015f6:	74 20                	je     801618 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8015f8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015fb:	8b 40 08             	mov    0x8(%eax),%eax
+  8015fe:	85 c0                	test   %eax,%eax
+  801600:	74 37                	je     801639 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801602:	83 ec 04             	sub    $0x4,%esp
+  801605:	ff 75 10             	push   0x10(%ebp)
+  801608:	ff 75 0c             	push   0xc(%ebp)
+  80160b:	53                   	push   %ebx
+  80160c:	ff d0                	call   *%eax
+  80160e:	83 c4 10             	add    $0x10,%esp
+}
+  801611:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801614:	5b                   	pop    %ebx
+  801615:	5e                   	pop    %esi
+  801616:	5d                   	pop    %ebp
+  801617:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801618:	a1 08 50 80 00       	mov    0x805008,%eax
+  80161d:	8b 40 48             	mov    0x48(%eax),%eax
+  801620:	83 ec 04             	sub    $0x4,%esp
+  801623:	56                   	push   %esi
+  801624:	50                   	push   %eax
+  801625:	68 89 2f 80 00       	push   $0x802f89
+  80162a:	e8 18 ed ff ff       	call   800347 <cprintf>
+		return -E_INVAL;
+  80162f:	83 c4 10             	add    $0x10,%esp
+  801632:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801637:	eb d8                	jmp    801611 <read+0x58>
+		return -E_NOT_SUPP;
+  801639:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80163e:	eb d1                	jmp    801611 <read+0x58>
+
+00801640 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801640:	55                   	push   %ebp
+  801641:	89 e5                	mov    %esp,%ebp
+  801643:	57                   	push   %edi
+  801644:	56                   	push   %esi
+  801645:	53                   	push   %ebx
+  801646:	83 ec 0c             	sub    $0xc,%esp
+  801649:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80164c:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80164f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801654:	eb 02                	jmp    801658 <readn+0x18>
+  801656:	01 c3                	add    %eax,%ebx
+  801658:	39 f3                	cmp    %esi,%ebx
+  80165a:	73 21                	jae    80167d <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80165c:	83 ec 04             	sub    $0x4,%esp
+  80165f:	89 f0                	mov    %esi,%eax
+  801661:	29 d8                	sub    %ebx,%eax
+  801663:	50                   	push   %eax
+  801664:	89 d8                	mov    %ebx,%eax
+  801666:	03 45 0c             	add    0xc(%ebp),%eax
+  801669:	50                   	push   %eax
+  80166a:	57                   	push   %edi
+  80166b:	e8 49 ff ff ff       	call   8015b9 <read>
+		if (m < 0)
+  801670:	83 c4 10             	add    $0x10,%esp
+  801673:	85 c0                	test   %eax,%eax
+  801675:	78 04                	js     80167b <readn+0x3b>
+			return m;
+		if (m == 0)
+  801677:	75 dd                	jne    801656 <readn+0x16>
+  801679:	eb 02                	jmp    80167d <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80167b:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80167d:	89 d8                	mov    %ebx,%eax
+  80167f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801682:	5b                   	pop    %ebx
+  801683:	5e                   	pop    %esi
+  801684:	5f                   	pop    %edi
+  801685:	5d                   	pop    %ebp
+  801686:	c3                   	ret
+
+00801687 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801687:	55                   	push   %ebp
+  801688:	89 e5                	mov    %esp,%ebp
+  80168a:	56                   	push   %esi
+  80168b:	53                   	push   %ebx
+  80168c:	83 ec 18             	sub    $0x18,%esp
+  80168f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801692:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801695:	50                   	push   %eax
+  801696:	53                   	push   %ebx
+  801697:	e8 b7 fc ff ff       	call   801353 <fd_lookup>
+  80169c:	83 c4 10             	add    $0x10,%esp
+  80169f:	85 c0                	test   %eax,%eax
+  8016a1:	78 37                	js     8016da <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016a3:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8016a6:	83 ec 08             	sub    $0x8,%esp
+  8016a9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016ac:	50                   	push   %eax
+  8016ad:	ff 36                	push   (%esi)
+  8016af:	e8 ef fc ff ff       	call   8013a3 <dev_lookup>
+  8016b4:	83 c4 10             	add    $0x10,%esp
+  8016b7:	85 c0                	test   %eax,%eax
+  8016b9:	78 1f                	js     8016da <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8016bb:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8016bf:	74 20                	je     8016e1 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8016c1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016c4:	8b 40 0c             	mov    0xc(%eax),%eax
+  8016c7:	85 c0                	test   %eax,%eax
+  8016c9:	74 37                	je     801702 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8016cb:	83 ec 04             	sub    $0x4,%esp
+  8016ce:	ff 75 10             	push   0x10(%ebp)
+  8016d1:	ff 75 0c             	push   0xc(%ebp)
+  8016d4:	56                   	push   %esi
+  8016d5:	ff d0                	call   *%eax
+  8016d7:	83 c4 10             	add    $0x10,%esp
+}
+  8016da:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016dd:	5b                   	pop    %ebx
+  8016de:	5e                   	pop    %esi
+  8016df:	5d                   	pop    %ebp
+  8016e0:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8016e1:	a1 08 50 80 00       	mov    0x805008,%eax
+  8016e6:	8b 40 48             	mov    0x48(%eax),%eax
+  8016e9:	83 ec 04             	sub    $0x4,%esp
+  8016ec:	53                   	push   %ebx
+  8016ed:	50                   	push   %eax
+  8016ee:	68 a5 2f 80 00       	push   $0x802fa5
+  8016f3:	e8 4f ec ff ff       	call   800347 <cprintf>
+		return -E_INVAL;
+  8016f8:	83 c4 10             	add    $0x10,%esp
+  8016fb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801700:	eb d8                	jmp    8016da <write+0x53>
+		return -E_NOT_SUPP;
+  801702:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801707:	eb d1                	jmp    8016da <write+0x53>
+
+00801709 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801709:	55                   	push   %ebp
+  80170a:	89 e5                	mov    %esp,%ebp
+  80170c:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80170f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801712:	50                   	push   %eax
+  801713:	ff 75 08             	push   0x8(%ebp)
+  801716:	e8 38 fc ff ff       	call   801353 <fd_lookup>
+  80171b:	83 c4 10             	add    $0x10,%esp
+  80171e:	85 c0                	test   %eax,%eax
+  801720:	78 0e                	js     801730 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801722:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801725:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801728:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80172b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801730:	c9                   	leave
+  801731:	c3                   	ret
+
+00801732 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801732:	55                   	push   %ebp
+  801733:	89 e5                	mov    %esp,%ebp
+  801735:	56                   	push   %esi
+  801736:	53                   	push   %ebx
+  801737:	83 ec 18             	sub    $0x18,%esp
+  80173a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80173d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801740:	50                   	push   %eax
+  801741:	53                   	push   %ebx
+  801742:	e8 0c fc ff ff       	call   801353 <fd_lookup>
+  801747:	83 c4 10             	add    $0x10,%esp
+  80174a:	85 c0                	test   %eax,%eax
+  80174c:	78 34                	js     801782 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80174e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801751:	83 ec 08             	sub    $0x8,%esp
+  801754:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801757:	50                   	push   %eax
+  801758:	ff 36                	push   (%esi)
+  80175a:	e8 44 fc ff ff       	call   8013a3 <dev_lookup>
+  80175f:	83 c4 10             	add    $0x10,%esp
+  801762:	85 c0                	test   %eax,%eax
+  801764:	78 1c                	js     801782 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801766:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80176a:	74 1d                	je     801789 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80176c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80176f:	8b 40 18             	mov    0x18(%eax),%eax
+  801772:	85 c0                	test   %eax,%eax
+  801774:	74 34                	je     8017aa <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801776:	83 ec 08             	sub    $0x8,%esp
+  801779:	ff 75 0c             	push   0xc(%ebp)
+  80177c:	56                   	push   %esi
+  80177d:	ff d0                	call   *%eax
+  80177f:	83 c4 10             	add    $0x10,%esp
+}
+  801782:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801785:	5b                   	pop    %ebx
+  801786:	5e                   	pop    %esi
+  801787:	5d                   	pop    %ebp
+  801788:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801789:	a1 08 50 80 00       	mov    0x805008,%eax
+  80178e:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801791:	83 ec 04             	sub    $0x4,%esp
+  801794:	53                   	push   %ebx
+  801795:	50                   	push   %eax
+  801796:	68 68 2f 80 00       	push   $0x802f68
+  80179b:	e8 a7 eb ff ff       	call   800347 <cprintf>
+		return -E_INVAL;
+  8017a0:	83 c4 10             	add    $0x10,%esp
+  8017a3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017a8:	eb d8                	jmp    801782 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8017aa:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017af:	eb d1                	jmp    801782 <ftruncate+0x50>
+
+008017b1 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8017b1:	55                   	push   %ebp
+  8017b2:	89 e5                	mov    %esp,%ebp
+  8017b4:	56                   	push   %esi
+  8017b5:	53                   	push   %ebx
+  8017b6:	83 ec 18             	sub    $0x18,%esp
+  8017b9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017bc:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017bf:	50                   	push   %eax
+  8017c0:	ff 75 08             	push   0x8(%ebp)
+  8017c3:	e8 8b fb ff ff       	call   801353 <fd_lookup>
+  8017c8:	83 c4 10             	add    $0x10,%esp
+  8017cb:	85 c0                	test   %eax,%eax
+  8017cd:	78 49                	js     801818 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017cf:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8017d2:	83 ec 08             	sub    $0x8,%esp
+  8017d5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017d8:	50                   	push   %eax
+  8017d9:	ff 36                	push   (%esi)
+  8017db:	e8 c3 fb ff ff       	call   8013a3 <dev_lookup>
+  8017e0:	83 c4 10             	add    $0x10,%esp
+  8017e3:	85 c0                	test   %eax,%eax
+  8017e5:	78 31                	js     801818 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8017e7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017ea:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8017ee:	74 2f                	je     80181f <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8017f0:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8017f3:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8017fa:	00 00 00 
+	stat->st_isdir = 0;
+  8017fd:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801804:	00 00 00 
+	stat->st_dev = dev;
+  801807:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80180d:	83 ec 08             	sub    $0x8,%esp
+  801810:	53                   	push   %ebx
+  801811:	56                   	push   %esi
+  801812:	ff 50 14             	call   *0x14(%eax)
+  801815:	83 c4 10             	add    $0x10,%esp
+}
+  801818:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80181b:	5b                   	pop    %ebx
+  80181c:	5e                   	pop    %esi
+  80181d:	5d                   	pop    %ebp
+  80181e:	c3                   	ret
+		return -E_NOT_SUPP;
+  80181f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801824:	eb f2                	jmp    801818 <fstat+0x67>
+
+00801826 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801826:	55                   	push   %ebp
+  801827:	89 e5                	mov    %esp,%ebp
+  801829:	56                   	push   %esi
+  80182a:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80182b:	83 ec 08             	sub    $0x8,%esp
+  80182e:	6a 00                	push   $0x0
+  801830:	ff 75 08             	push   0x8(%ebp)
+  801833:	e8 e4 01 00 00       	call   801a1c <open>
+  801838:	89 c3                	mov    %eax,%ebx
+  80183a:	83 c4 10             	add    $0x10,%esp
+  80183d:	85 c0                	test   %eax,%eax
+  80183f:	78 1b                	js     80185c <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801841:	83 ec 08             	sub    $0x8,%esp
+  801844:	ff 75 0c             	push   0xc(%ebp)
+  801847:	50                   	push   %eax
+  801848:	e8 64 ff ff ff       	call   8017b1 <fstat>
+  80184d:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80184f:	89 1c 24             	mov    %ebx,(%esp)
+  801852:	e8 26 fc ff ff       	call   80147d <close>
+	return r;
+  801857:	83 c4 10             	add    $0x10,%esp
+  80185a:	89 f3                	mov    %esi,%ebx
+}
+  80185c:	89 d8                	mov    %ebx,%eax
+  80185e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801861:	5b                   	pop    %ebx
+  801862:	5e                   	pop    %esi
+  801863:	5d                   	pop    %ebp
+  801864:	c3                   	ret
+
+00801865 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  801865:	55                   	push   %ebp
+  801866:	89 e5                	mov    %esp,%ebp
+  801868:	56                   	push   %esi
+  801869:	53                   	push   %ebx
+  80186a:	89 c6                	mov    %eax,%esi
+  80186c:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  80186e:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  801875:	74 27                	je     80189e <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801877:	6a 07                	push   $0x7
+  801879:	68 00 60 80 00       	push   $0x806000
+  80187e:	56                   	push   %esi
+  80187f:	ff 35 00 50 80 00    	push   0x805000
+  801885:	e8 60 0c 00 00       	call   8024ea <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  80188a:	83 c4 0c             	add    $0xc,%esp
+  80188d:	6a 00                	push   $0x0
+  80188f:	53                   	push   %ebx
+  801890:	6a 00                	push   $0x0
+  801892:	e8 df 0b 00 00       	call   802476 <ipc_recv>
+}
+  801897:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80189a:	5b                   	pop    %ebx
+  80189b:	5e                   	pop    %esi
+  80189c:	5d                   	pop    %ebp
+  80189d:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  80189e:	83 ec 0c             	sub    $0xc,%esp
+  8018a1:	6a 01                	push   $0x1
+  8018a3:	e8 96 0c 00 00       	call   80253e <ipc_find_env>
+  8018a8:	a3 00 50 80 00       	mov    %eax,0x805000
+  8018ad:	83 c4 10             	add    $0x10,%esp
+  8018b0:	eb c5                	jmp    801877 <fsipc+0x12>
+
+008018b2 <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8018b2:	55                   	push   %ebp
+  8018b3:	89 e5                	mov    %esp,%ebp
+  8018b5:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8018b8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018bb:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018be:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.set_size.req_size = newsize;
+  8018c3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8018c6:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  8018cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018d0:	b8 02 00 00 00       	mov    $0x2,%eax
+  8018d5:	e8 8b ff ff ff       	call   801865 <fsipc>
+}
+  8018da:	c9                   	leave
+  8018db:	c3                   	ret
+
+008018dc <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8018dc:	55                   	push   %ebp
+  8018dd:	89 e5                	mov    %esp,%ebp
+  8018df:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8018e2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018e5:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018e8:	a3 00 60 80 00       	mov    %eax,0x806000
+  return fsipc(FSREQ_FLUSH, NULL);
+  8018ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018f2:	b8 06 00 00 00       	mov    $0x6,%eax
+  8018f7:	e8 69 ff ff ff       	call   801865 <fsipc>
+}
+  8018fc:	c9                   	leave
+  8018fd:	c3                   	ret
+
+008018fe <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8018fe:	55                   	push   %ebp
+  8018ff:	89 e5                	mov    %esp,%ebp
+  801901:	53                   	push   %ebx
+  801902:	83 ec 04             	sub    $0x4,%esp
+  801905:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801908:	8b 45 08             	mov    0x8(%ebp),%eax
+  80190b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80190e:	a3 00 60 80 00       	mov    %eax,0x806000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801913:	ba 00 00 00 00       	mov    $0x0,%edx
+  801918:	b8 05 00 00 00       	mov    $0x5,%eax
+  80191d:	e8 43 ff ff ff       	call   801865 <fsipc>
+  801922:	85 c0                	test   %eax,%eax
+  801924:	78 2c                	js     801952 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801926:	83 ec 08             	sub    $0x8,%esp
+  801929:	68 00 60 80 00       	push   $0x806000
+  80192e:	53                   	push   %ebx
+  80192f:	e8 cc ef ff ff       	call   800900 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801934:	a1 80 60 80 00       	mov    0x806080,%eax
+  801939:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80193f:	a1 84 60 80 00       	mov    0x806084,%eax
+  801944:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  80194a:	83 c4 10             	add    $0x10,%esp
+  80194d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801952:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801955:	c9                   	leave
+  801956:	c3                   	ret
+
+00801957 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801957:	55                   	push   %ebp
+  801958:	89 e5                	mov    %esp,%ebp
+  80195a:	83 ec 0c             	sub    $0xc,%esp
+  80195d:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801960:	8b 55 08             	mov    0x8(%ebp),%edx
+  801963:	8b 52 0c             	mov    0xc(%edx),%edx
+  801966:	89 15 00 60 80 00    	mov    %edx,0x806000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80196c:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801971:	39 d0                	cmp    %edx,%eax
+  801973:	0f 47 c2             	cmova  %edx,%eax
+  801976:	a3 04 60 80 00       	mov    %eax,0x806004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  80197b:	50                   	push   %eax
+  80197c:	ff 75 0c             	push   0xc(%ebp)
+  80197f:	68 08 60 80 00       	push   $0x806008
+  801984:	e8 fd f0 ff ff       	call   800a86 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801989:	ba 00 00 00 00       	mov    $0x0,%edx
+  80198e:	b8 04 00 00 00       	mov    $0x4,%eax
+  801993:	e8 cd fe ff ff       	call   801865 <fsipc>
+}
+  801998:	c9                   	leave
+  801999:	c3                   	ret
+
+0080199a <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80199a:	55                   	push   %ebp
+  80199b:	89 e5                	mov    %esp,%ebp
+  80199d:	56                   	push   %esi
+  80199e:	53                   	push   %ebx
+  80199f:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8019a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019a5:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019a8:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read.req_n = n;
+  8019ad:	89 35 04 60 80 00    	mov    %esi,0x806004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8019b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019b8:	b8 03 00 00 00       	mov    $0x3,%eax
+  8019bd:	e8 a3 fe ff ff       	call   801865 <fsipc>
+  8019c2:	89 c3                	mov    %eax,%ebx
+  8019c4:	85 c0                	test   %eax,%eax
+  8019c6:	78 1f                	js     8019e7 <devfile_read+0x4d>
+  assert(r <= n);
+  8019c8:	39 c6                	cmp    %eax,%esi
+  8019ca:	72 24                	jb     8019f0 <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  8019cc:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8019d1:	7f 33                	jg     801a06 <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8019d3:	83 ec 04             	sub    $0x4,%esp
+  8019d6:	50                   	push   %eax
+  8019d7:	68 00 60 80 00       	push   $0x806000
+  8019dc:	ff 75 0c             	push   0xc(%ebp)
+  8019df:	e8 a2 f0 ff ff       	call   800a86 <memmove>
+  return r;
+  8019e4:	83 c4 10             	add    $0x10,%esp
+}
+  8019e7:	89 d8                	mov    %ebx,%eax
+  8019e9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019ec:	5b                   	pop    %ebx
+  8019ed:	5e                   	pop    %esi
+  8019ee:	5d                   	pop    %ebp
+  8019ef:	c3                   	ret
+  assert(r <= n);
+  8019f0:	68 d8 2f 80 00       	push   $0x802fd8
+  8019f5:	68 df 2f 80 00       	push   $0x802fdf
+  8019fa:	6a 78                	push   $0x78
+  8019fc:	68 f4 2f 80 00       	push   $0x802ff4
+  801a01:	e8 66 e8 ff ff       	call   80026c <_panic>
+  assert(r <= PGSIZE);
+  801a06:	68 ff 2f 80 00       	push   $0x802fff
+  801a0b:	68 df 2f 80 00       	push   $0x802fdf
+  801a10:	6a 79                	push   $0x79
+  801a12:	68 f4 2f 80 00       	push   $0x802ff4
+  801a17:	e8 50 e8 ff ff       	call   80026c <_panic>
+
+00801a1c <open>:
+open(const char *path, int mode) {
+  801a1c:	55                   	push   %ebp
+  801a1d:	89 e5                	mov    %esp,%ebp
+  801a1f:	56                   	push   %esi
+  801a20:	53                   	push   %ebx
+  801a21:	83 ec 1c             	sub    $0x1c,%esp
+  801a24:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801a27:	56                   	push   %esi
+  801a28:	e8 98 ee ff ff       	call   8008c5 <strlen>
+  801a2d:	83 c4 10             	add    $0x10,%esp
+  801a30:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801a35:	7f 6c                	jg     801aa3 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801a37:	83 ec 0c             	sub    $0xc,%esp
+  801a3a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a3d:	50                   	push   %eax
+  801a3e:	e8 ba f8 ff ff       	call   8012fd <fd_alloc>
+  801a43:	89 c3                	mov    %eax,%ebx
+  801a45:	83 c4 10             	add    $0x10,%esp
+  801a48:	85 c0                	test   %eax,%eax
+  801a4a:	78 3c                	js     801a88 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801a4c:	83 ec 08             	sub    $0x8,%esp
+  801a4f:	56                   	push   %esi
+  801a50:	68 00 60 80 00       	push   $0x806000
+  801a55:	e8 a6 ee ff ff       	call   800900 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801a5a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a5d:	a3 00 64 80 00       	mov    %eax,0x806400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801a62:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801a65:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a6a:	e8 f6 fd ff ff       	call   801865 <fsipc>
+  801a6f:	89 c3                	mov    %eax,%ebx
+  801a71:	83 c4 10             	add    $0x10,%esp
+  801a74:	85 c0                	test   %eax,%eax
+  801a76:	78 19                	js     801a91 <open+0x75>
+  return fd2num(fd);
+  801a78:	83 ec 0c             	sub    $0xc,%esp
+  801a7b:	ff 75 f4             	push   -0xc(%ebp)
+  801a7e:	e8 53 f8 ff ff       	call   8012d6 <fd2num>
+  801a83:	89 c3                	mov    %eax,%ebx
+  801a85:	83 c4 10             	add    $0x10,%esp
+}
+  801a88:	89 d8                	mov    %ebx,%eax
+  801a8a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a8d:	5b                   	pop    %ebx
+  801a8e:	5e                   	pop    %esi
+  801a8f:	5d                   	pop    %ebp
+  801a90:	c3                   	ret
+    fd_close(fd, 0);
+  801a91:	83 ec 08             	sub    $0x8,%esp
+  801a94:	6a 00                	push   $0x0
+  801a96:	ff 75 f4             	push   -0xc(%ebp)
+  801a99:	e8 58 f9 ff ff       	call   8013f6 <fd_close>
+    return r;
+  801a9e:	83 c4 10             	add    $0x10,%esp
+  801aa1:	eb e5                	jmp    801a88 <open+0x6c>
+    return -E_BAD_PATH;
+  801aa3:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801aa8:	eb de                	jmp    801a88 <open+0x6c>
+
+00801aaa <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  801aaa:	55                   	push   %ebp
+  801aab:	89 e5                	mov    %esp,%ebp
+  801aad:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801ab0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ab5:	b8 08 00 00 00       	mov    $0x8,%eax
+  801aba:	e8 a6 fd ff ff       	call   801865 <fsipc>
+}
+  801abf:	c9                   	leave
+  801ac0:	c3                   	ret
+
+00801ac1 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801ac1:	55                   	push   %ebp
+  801ac2:	89 e5                	mov    %esp,%ebp
+  801ac4:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801ac7:	68 0b 30 80 00       	push   $0x80300b
+  801acc:	ff 75 0c             	push   0xc(%ebp)
+  801acf:	e8 2c ee ff ff       	call   800900 <strcpy>
+	return 0;
+}
+  801ad4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ad9:	c9                   	leave
+  801ada:	c3                   	ret
+
+00801adb <devsock_close>:
+{
+  801adb:	55                   	push   %ebp
+  801adc:	89 e5                	mov    %esp,%ebp
+  801ade:	53                   	push   %ebx
+  801adf:	83 ec 10             	sub    $0x10,%esp
+  801ae2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801ae5:	53                   	push   %ebx
+  801ae6:	e8 92 0a 00 00       	call   80257d <pageref>
+  801aeb:	89 c2                	mov    %eax,%edx
+  801aed:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801af0:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801af5:	83 fa 01             	cmp    $0x1,%edx
+  801af8:	74 05                	je     801aff <devsock_close+0x24>
+}
+  801afa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801afd:	c9                   	leave
+  801afe:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801aff:	83 ec 0c             	sub    $0xc,%esp
+  801b02:	ff 73 0c             	push   0xc(%ebx)
+  801b05:	e8 b7 02 00 00       	call   801dc1 <nsipc_close>
+  801b0a:	83 c4 10             	add    $0x10,%esp
+  801b0d:	eb eb                	jmp    801afa <devsock_close+0x1f>
+
+00801b0f <devsock_write>:
+{
+  801b0f:	55                   	push   %ebp
+  801b10:	89 e5                	mov    %esp,%ebp
+  801b12:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801b15:	6a 00                	push   $0x0
+  801b17:	ff 75 10             	push   0x10(%ebp)
+  801b1a:	ff 75 0c             	push   0xc(%ebp)
+  801b1d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b20:	ff 70 0c             	push   0xc(%eax)
+  801b23:	e8 79 03 00 00       	call   801ea1 <nsipc_send>
+}
+  801b28:	c9                   	leave
+  801b29:	c3                   	ret
+
+00801b2a <devsock_read>:
+{
+  801b2a:	55                   	push   %ebp
+  801b2b:	89 e5                	mov    %esp,%ebp
+  801b2d:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801b30:	6a 00                	push   $0x0
+  801b32:	ff 75 10             	push   0x10(%ebp)
+  801b35:	ff 75 0c             	push   0xc(%ebp)
+  801b38:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b3b:	ff 70 0c             	push   0xc(%eax)
+  801b3e:	e8 ef 02 00 00       	call   801e32 <nsipc_recv>
+}
+  801b43:	c9                   	leave
+  801b44:	c3                   	ret
+
+00801b45 <fd2sockid>:
+{
+  801b45:	55                   	push   %ebp
+  801b46:	89 e5                	mov    %esp,%ebp
+  801b48:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801b4b:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801b4e:	52                   	push   %edx
+  801b4f:	50                   	push   %eax
+  801b50:	e8 fe f7 ff ff       	call   801353 <fd_lookup>
+  801b55:	83 c4 10             	add    $0x10,%esp
+  801b58:	85 c0                	test   %eax,%eax
+  801b5a:	78 10                	js     801b6c <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801b5c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b5f:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  801b65:	39 08                	cmp    %ecx,(%eax)
+  801b67:	75 05                	jne    801b6e <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801b69:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801b6c:	c9                   	leave
+  801b6d:	c3                   	ret
+		return -E_NOT_SUPP;
+  801b6e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b73:	eb f7                	jmp    801b6c <fd2sockid+0x27>
+
+00801b75 <alloc_sockfd>:
+{
+  801b75:	55                   	push   %ebp
+  801b76:	89 e5                	mov    %esp,%ebp
+  801b78:	56                   	push   %esi
+  801b79:	53                   	push   %ebx
+  801b7a:	83 ec 1c             	sub    $0x1c,%esp
+  801b7d:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801b7f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b82:	50                   	push   %eax
+  801b83:	e8 75 f7 ff ff       	call   8012fd <fd_alloc>
+  801b88:	89 c3                	mov    %eax,%ebx
+  801b8a:	83 c4 10             	add    $0x10,%esp
+  801b8d:	85 c0                	test   %eax,%eax
+  801b8f:	78 43                	js     801bd4 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801b91:	83 ec 04             	sub    $0x4,%esp
+  801b94:	68 07 04 00 00       	push   $0x407
+  801b99:	ff 75 f4             	push   -0xc(%ebp)
+  801b9c:	6a 00                	push   $0x0
+  801b9e:	e8 49 f1 ff ff       	call   800cec <sys_page_alloc>
+  801ba3:	89 c3                	mov    %eax,%ebx
+  801ba5:	83 c4 10             	add    $0x10,%esp
+  801ba8:	85 c0                	test   %eax,%eax
+  801baa:	78 28                	js     801bd4 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801bac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801baf:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801bb5:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801bb7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bba:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801bc1:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801bc4:	83 ec 0c             	sub    $0xc,%esp
+  801bc7:	50                   	push   %eax
+  801bc8:	e8 09 f7 ff ff       	call   8012d6 <fd2num>
+  801bcd:	89 c3                	mov    %eax,%ebx
+  801bcf:	83 c4 10             	add    $0x10,%esp
+  801bd2:	eb 0c                	jmp    801be0 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801bd4:	83 ec 0c             	sub    $0xc,%esp
+  801bd7:	56                   	push   %esi
+  801bd8:	e8 e4 01 00 00       	call   801dc1 <nsipc_close>
+		return r;
+  801bdd:	83 c4 10             	add    $0x10,%esp
+}
+  801be0:	89 d8                	mov    %ebx,%eax
+  801be2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801be5:	5b                   	pop    %ebx
+  801be6:	5e                   	pop    %esi
+  801be7:	5d                   	pop    %ebp
+  801be8:	c3                   	ret
+
+00801be9 <accept>:
+{
+  801be9:	55                   	push   %ebp
+  801bea:	89 e5                	mov    %esp,%ebp
+  801bec:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801bef:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bf2:	e8 4e ff ff ff       	call   801b45 <fd2sockid>
+  801bf7:	85 c0                	test   %eax,%eax
+  801bf9:	78 1b                	js     801c16 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801bfb:	83 ec 04             	sub    $0x4,%esp
+  801bfe:	ff 75 10             	push   0x10(%ebp)
+  801c01:	ff 75 0c             	push   0xc(%ebp)
+  801c04:	50                   	push   %eax
+  801c05:	e8 0e 01 00 00       	call   801d18 <nsipc_accept>
+  801c0a:	83 c4 10             	add    $0x10,%esp
+  801c0d:	85 c0                	test   %eax,%eax
+  801c0f:	78 05                	js     801c16 <accept+0x2d>
+	return alloc_sockfd(r);
+  801c11:	e8 5f ff ff ff       	call   801b75 <alloc_sockfd>
+}
+  801c16:	c9                   	leave
+  801c17:	c3                   	ret
+
+00801c18 <bind>:
+{
+  801c18:	55                   	push   %ebp
+  801c19:	89 e5                	mov    %esp,%ebp
+  801c1b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801c1e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c21:	e8 1f ff ff ff       	call   801b45 <fd2sockid>
+  801c26:	85 c0                	test   %eax,%eax
+  801c28:	78 12                	js     801c3c <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801c2a:	83 ec 04             	sub    $0x4,%esp
+  801c2d:	ff 75 10             	push   0x10(%ebp)
+  801c30:	ff 75 0c             	push   0xc(%ebp)
+  801c33:	50                   	push   %eax
+  801c34:	e8 31 01 00 00       	call   801d6a <nsipc_bind>
+  801c39:	83 c4 10             	add    $0x10,%esp
+}
+  801c3c:	c9                   	leave
+  801c3d:	c3                   	ret
+
+00801c3e <shutdown>:
+{
+  801c3e:	55                   	push   %ebp
+  801c3f:	89 e5                	mov    %esp,%ebp
+  801c41:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801c44:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c47:	e8 f9 fe ff ff       	call   801b45 <fd2sockid>
+  801c4c:	85 c0                	test   %eax,%eax
+  801c4e:	78 0f                	js     801c5f <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801c50:	83 ec 08             	sub    $0x8,%esp
+  801c53:	ff 75 0c             	push   0xc(%ebp)
+  801c56:	50                   	push   %eax
+  801c57:	e8 43 01 00 00       	call   801d9f <nsipc_shutdown>
+  801c5c:	83 c4 10             	add    $0x10,%esp
+}
+  801c5f:	c9                   	leave
+  801c60:	c3                   	ret
+
+00801c61 <connect>:
+{
+  801c61:	55                   	push   %ebp
+  801c62:	89 e5                	mov    %esp,%ebp
+  801c64:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801c67:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c6a:	e8 d6 fe ff ff       	call   801b45 <fd2sockid>
+  801c6f:	85 c0                	test   %eax,%eax
+  801c71:	78 12                	js     801c85 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801c73:	83 ec 04             	sub    $0x4,%esp
+  801c76:	ff 75 10             	push   0x10(%ebp)
+  801c79:	ff 75 0c             	push   0xc(%ebp)
+  801c7c:	50                   	push   %eax
+  801c7d:	e8 59 01 00 00       	call   801ddb <nsipc_connect>
+  801c82:	83 c4 10             	add    $0x10,%esp
+}
+  801c85:	c9                   	leave
+  801c86:	c3                   	ret
+
+00801c87 <listen>:
+{
+  801c87:	55                   	push   %ebp
+  801c88:	89 e5                	mov    %esp,%ebp
+  801c8a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801c8d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c90:	e8 b0 fe ff ff       	call   801b45 <fd2sockid>
+  801c95:	85 c0                	test   %eax,%eax
+  801c97:	78 0f                	js     801ca8 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801c99:	83 ec 08             	sub    $0x8,%esp
+  801c9c:	ff 75 0c             	push   0xc(%ebp)
+  801c9f:	50                   	push   %eax
+  801ca0:	e8 6b 01 00 00       	call   801e10 <nsipc_listen>
+  801ca5:	83 c4 10             	add    $0x10,%esp
+}
+  801ca8:	c9                   	leave
+  801ca9:	c3                   	ret
+
+00801caa <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801caa:	55                   	push   %ebp
+  801cab:	89 e5                	mov    %esp,%ebp
+  801cad:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801cb0:	ff 75 10             	push   0x10(%ebp)
+  801cb3:	ff 75 0c             	push   0xc(%ebp)
+  801cb6:	ff 75 08             	push   0x8(%ebp)
+  801cb9:	e8 41 02 00 00       	call   801eff <nsipc_socket>
+  801cbe:	83 c4 10             	add    $0x10,%esp
+  801cc1:	85 c0                	test   %eax,%eax
+  801cc3:	78 05                	js     801cca <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801cc5:	e8 ab fe ff ff       	call   801b75 <alloc_sockfd>
+}
+  801cca:	c9                   	leave
+  801ccb:	c3                   	ret
+
+00801ccc <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801ccc:	55                   	push   %ebp
+  801ccd:	89 e5                	mov    %esp,%ebp
+  801ccf:	53                   	push   %ebx
+  801cd0:	83 ec 04             	sub    $0x4,%esp
+  801cd3:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801cd5:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  801cdc:	74 26                	je     801d04 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801cde:	6a 07                	push   $0x7
+  801ce0:	68 00 70 80 00       	push   $0x807000
+  801ce5:	53                   	push   %ebx
+  801ce6:	ff 35 04 50 80 00    	push   0x805004
+  801cec:	e8 f9 07 00 00       	call   8024ea <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801cf1:	83 c4 0c             	add    $0xc,%esp
+  801cf4:	6a 00                	push   $0x0
+  801cf6:	6a 00                	push   $0x0
+  801cf8:	6a 00                	push   $0x0
+  801cfa:	e8 77 07 00 00       	call   802476 <ipc_recv>
+}
+  801cff:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d02:	c9                   	leave
+  801d03:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801d04:	83 ec 0c             	sub    $0xc,%esp
+  801d07:	6a 02                	push   $0x2
+  801d09:	e8 30 08 00 00       	call   80253e <ipc_find_env>
+  801d0e:	a3 04 50 80 00       	mov    %eax,0x805004
+  801d13:	83 c4 10             	add    $0x10,%esp
+  801d16:	eb c6                	jmp    801cde <nsipc+0x12>
+
+00801d18 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801d18:	55                   	push   %ebp
+  801d19:	89 e5                	mov    %esp,%ebp
+  801d1b:	56                   	push   %esi
+  801d1c:	53                   	push   %ebx
+  801d1d:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801d20:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d23:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801d28:	8b 06                	mov    (%esi),%eax
+  801d2a:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801d2f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d34:	e8 93 ff ff ff       	call   801ccc <nsipc>
+  801d39:	89 c3                	mov    %eax,%ebx
+  801d3b:	85 c0                	test   %eax,%eax
+  801d3d:	79 09                	jns    801d48 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801d3f:	89 d8                	mov    %ebx,%eax
+  801d41:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d44:	5b                   	pop    %ebx
+  801d45:	5e                   	pop    %esi
+  801d46:	5d                   	pop    %ebp
+  801d47:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801d48:	83 ec 04             	sub    $0x4,%esp
+  801d4b:	ff 35 10 70 80 00    	push   0x807010
+  801d51:	68 00 70 80 00       	push   $0x807000
+  801d56:	ff 75 0c             	push   0xc(%ebp)
+  801d59:	e8 28 ed ff ff       	call   800a86 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801d5e:	a1 10 70 80 00       	mov    0x807010,%eax
+  801d63:	89 06                	mov    %eax,(%esi)
+  801d65:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801d68:	eb d5                	jmp    801d3f <nsipc_accept+0x27>
+
+00801d6a <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801d6a:	55                   	push   %ebp
+  801d6b:	89 e5                	mov    %esp,%ebp
+  801d6d:	53                   	push   %ebx
+  801d6e:	83 ec 08             	sub    $0x8,%esp
+  801d71:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801d74:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d77:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801d7c:	53                   	push   %ebx
+  801d7d:	ff 75 0c             	push   0xc(%ebp)
+  801d80:	68 04 70 80 00       	push   $0x807004
+  801d85:	e8 fc ec ff ff       	call   800a86 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801d8a:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  801d90:	b8 02 00 00 00       	mov    $0x2,%eax
+  801d95:	e8 32 ff ff ff       	call   801ccc <nsipc>
+}
+  801d9a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d9d:	c9                   	leave
+  801d9e:	c3                   	ret
+
+00801d9f <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801d9f:	55                   	push   %ebp
+  801da0:	89 e5                	mov    %esp,%ebp
+  801da2:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801da5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801da8:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  801dad:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801db0:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  801db5:	b8 03 00 00 00       	mov    $0x3,%eax
+  801dba:	e8 0d ff ff ff       	call   801ccc <nsipc>
+}
+  801dbf:	c9                   	leave
+  801dc0:	c3                   	ret
+
+00801dc1 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801dc1:	55                   	push   %ebp
+  801dc2:	89 e5                	mov    %esp,%ebp
+  801dc4:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801dc7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dca:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  801dcf:	b8 04 00 00 00       	mov    $0x4,%eax
+  801dd4:	e8 f3 fe ff ff       	call   801ccc <nsipc>
+}
+  801dd9:	c9                   	leave
+  801dda:	c3                   	ret
+
+00801ddb <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801ddb:	55                   	push   %ebp
+  801ddc:	89 e5                	mov    %esp,%ebp
+  801dde:	53                   	push   %ebx
+  801ddf:	83 ec 08             	sub    $0x8,%esp
+  801de2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801de5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801de8:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801ded:	53                   	push   %ebx
+  801dee:	ff 75 0c             	push   0xc(%ebp)
+  801df1:	68 04 70 80 00       	push   $0x807004
+  801df6:	e8 8b ec ff ff       	call   800a86 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801dfb:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  801e01:	b8 05 00 00 00       	mov    $0x5,%eax
+  801e06:	e8 c1 fe ff ff       	call   801ccc <nsipc>
+}
+  801e0b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e0e:	c9                   	leave
+  801e0f:	c3                   	ret
+
+00801e10 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801e10:	55                   	push   %ebp
+  801e11:	89 e5                	mov    %esp,%ebp
+  801e13:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801e16:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e19:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  801e1e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e21:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  801e26:	b8 06 00 00 00       	mov    $0x6,%eax
+  801e2b:	e8 9c fe ff ff       	call   801ccc <nsipc>
+}
+  801e30:	c9                   	leave
+  801e31:	c3                   	ret
+
+00801e32 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801e32:	55                   	push   %ebp
+  801e33:	89 e5                	mov    %esp,%ebp
+  801e35:	56                   	push   %esi
+  801e36:	53                   	push   %ebx
+  801e37:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801e3a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e3d:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  801e42:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  801e48:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e4b:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801e50:	b8 07 00 00 00       	mov    $0x7,%eax
+  801e55:	e8 72 fe ff ff       	call   801ccc <nsipc>
+  801e5a:	89 c3                	mov    %eax,%ebx
+  801e5c:	85 c0                	test   %eax,%eax
+  801e5e:	78 22                	js     801e82 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801e60:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801e65:	39 c6                	cmp    %eax,%esi
+  801e67:	0f 4e c6             	cmovle %esi,%eax
+  801e6a:	39 c3                	cmp    %eax,%ebx
+  801e6c:	7f 1d                	jg     801e8b <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801e6e:	83 ec 04             	sub    $0x4,%esp
+  801e71:	53                   	push   %ebx
+  801e72:	68 00 70 80 00       	push   $0x807000
+  801e77:	ff 75 0c             	push   0xc(%ebp)
+  801e7a:	e8 07 ec ff ff       	call   800a86 <memmove>
+  801e7f:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801e82:	89 d8                	mov    %ebx,%eax
+  801e84:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e87:	5b                   	pop    %ebx
+  801e88:	5e                   	pop    %esi
+  801e89:	5d                   	pop    %ebp
+  801e8a:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801e8b:	68 17 30 80 00       	push   $0x803017
+  801e90:	68 df 2f 80 00       	push   $0x802fdf
+  801e95:	6a 62                	push   $0x62
+  801e97:	68 2c 30 80 00       	push   $0x80302c
+  801e9c:	e8 cb e3 ff ff       	call   80026c <_panic>
+
+00801ea1 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801ea1:	55                   	push   %ebp
+  801ea2:	89 e5                	mov    %esp,%ebp
+  801ea4:	53                   	push   %ebx
+  801ea5:	83 ec 04             	sub    $0x4,%esp
+  801ea8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801eab:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eae:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  801eb3:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801eb9:	7f 2e                	jg     801ee9 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801ebb:	83 ec 04             	sub    $0x4,%esp
+  801ebe:	53                   	push   %ebx
+  801ebf:	ff 75 0c             	push   0xc(%ebp)
+  801ec2:	68 0c 70 80 00       	push   $0x80700c
+  801ec7:	e8 ba eb ff ff       	call   800a86 <memmove>
+	nsipcbuf.send.req_size = size;
+  801ecc:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  801ed2:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ed5:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  801eda:	b8 08 00 00 00       	mov    $0x8,%eax
+  801edf:	e8 e8 fd ff ff       	call   801ccc <nsipc>
+}
+  801ee4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ee7:	c9                   	leave
+  801ee8:	c3                   	ret
+	assert(size < 1600);
+  801ee9:	68 38 30 80 00       	push   $0x803038
+  801eee:	68 df 2f 80 00       	push   $0x802fdf
+  801ef3:	6a 6d                	push   $0x6d
+  801ef5:	68 2c 30 80 00       	push   $0x80302c
+  801efa:	e8 6d e3 ff ff       	call   80026c <_panic>
+
+00801eff <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801eff:	55                   	push   %ebp
+  801f00:	89 e5                	mov    %esp,%ebp
+  801f02:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801f05:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f08:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  801f0d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f10:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  801f15:	8b 45 10             	mov    0x10(%ebp),%eax
+  801f18:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  801f1d:	b8 09 00 00 00       	mov    $0x9,%eax
+  801f22:	e8 a5 fd ff ff       	call   801ccc <nsipc>
+}
+  801f27:	c9                   	leave
+  801f28:	c3                   	ret
+
+00801f29 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801f29:	55                   	push   %ebp
+  801f2a:	89 e5                	mov    %esp,%ebp
+  801f2c:	56                   	push   %esi
+  801f2d:	53                   	push   %ebx
+  801f2e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801f31:	83 ec 0c             	sub    $0xc,%esp
+  801f34:	ff 75 08             	push   0x8(%ebp)
+  801f37:	e8 aa f3 ff ff       	call   8012e6 <fd2data>
+  801f3c:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801f3e:	83 c4 08             	add    $0x8,%esp
+  801f41:	68 44 30 80 00       	push   $0x803044
+  801f46:	53                   	push   %ebx
+  801f47:	e8 b4 e9 ff ff       	call   800900 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801f4c:	8b 46 04             	mov    0x4(%esi),%eax
+  801f4f:	2b 06                	sub    (%esi),%eax
+  801f51:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  801f57:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801f5e:	00 00 00 
+	stat->st_dev = &devpipe;
+  801f61:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  801f68:	40 80 00 
+	return 0;
+}
+  801f6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f70:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f73:	5b                   	pop    %ebx
+  801f74:	5e                   	pop    %esi
+  801f75:	5d                   	pop    %ebp
+  801f76:	c3                   	ret
+
+00801f77 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801f77:	55                   	push   %ebp
+  801f78:	89 e5                	mov    %esp,%ebp
+  801f7a:	53                   	push   %ebx
+  801f7b:	83 ec 0c             	sub    $0xc,%esp
+  801f7e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801f81:	53                   	push   %ebx
+  801f82:	6a 00                	push   $0x0
+  801f84:	e8 e8 ed ff ff       	call   800d71 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801f89:	89 1c 24             	mov    %ebx,(%esp)
+  801f8c:	e8 55 f3 ff ff       	call   8012e6 <fd2data>
+  801f91:	83 c4 08             	add    $0x8,%esp
+  801f94:	50                   	push   %eax
+  801f95:	6a 00                	push   $0x0
+  801f97:	e8 d5 ed ff ff       	call   800d71 <sys_page_unmap>
+}
+  801f9c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f9f:	c9                   	leave
+  801fa0:	c3                   	ret
+
+00801fa1 <_pipeisclosed>:
+{
+  801fa1:	55                   	push   %ebp
+  801fa2:	89 e5                	mov    %esp,%ebp
+  801fa4:	57                   	push   %edi
+  801fa5:	56                   	push   %esi
+  801fa6:	53                   	push   %ebx
+  801fa7:	83 ec 1c             	sub    $0x1c,%esp
+  801faa:	89 c7                	mov    %eax,%edi
+  801fac:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801fae:	a1 08 50 80 00       	mov    0x805008,%eax
+  801fb3:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801fb6:	83 ec 0c             	sub    $0xc,%esp
+  801fb9:	57                   	push   %edi
+  801fba:	e8 be 05 00 00       	call   80257d <pageref>
+  801fbf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801fc2:	89 34 24             	mov    %esi,(%esp)
+  801fc5:	e8 b3 05 00 00       	call   80257d <pageref>
+		nn = thisenv->env_runs;
+  801fca:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  801fd0:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801fd3:	83 c4 10             	add    $0x10,%esp
+  801fd6:	39 cb                	cmp    %ecx,%ebx
+  801fd8:	74 1b                	je     801ff5 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801fda:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801fdd:	75 cf                	jne    801fae <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801fdf:	8b 42 58             	mov    0x58(%edx),%eax
+  801fe2:	6a 01                	push   $0x1
+  801fe4:	50                   	push   %eax
+  801fe5:	53                   	push   %ebx
+  801fe6:	68 4b 30 80 00       	push   $0x80304b
+  801feb:	e8 57 e3 ff ff       	call   800347 <cprintf>
+  801ff0:	83 c4 10             	add    $0x10,%esp
+  801ff3:	eb b9                	jmp    801fae <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801ff5:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801ff8:	0f 94 c0             	sete   %al
+  801ffb:	0f b6 c0             	movzbl %al,%eax
+}
+  801ffe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802001:	5b                   	pop    %ebx
+  802002:	5e                   	pop    %esi
+  802003:	5f                   	pop    %edi
+  802004:	5d                   	pop    %ebp
+  802005:	c3                   	ret
+
+00802006 <devpipe_write>:
+{
+  802006:	55                   	push   %ebp
+  802007:	89 e5                	mov    %esp,%ebp
+  802009:	57                   	push   %edi
+  80200a:	56                   	push   %esi
+  80200b:	53                   	push   %ebx
+  80200c:	83 ec 28             	sub    $0x28,%esp
+  80200f:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802012:	56                   	push   %esi
+  802013:	e8 ce f2 ff ff       	call   8012e6 <fd2data>
+  802018:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80201a:	83 c4 10             	add    $0x10,%esp
+  80201d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802022:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802025:	75 09                	jne    802030 <devpipe_write+0x2a>
+	return i;
+  802027:	89 f8                	mov    %edi,%eax
+  802029:	eb 23                	jmp    80204e <devpipe_write+0x48>
+			sys_yield();
+  80202b:	e8 9d ec ff ff       	call   800ccd <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802030:	8b 43 04             	mov    0x4(%ebx),%eax
+  802033:	8b 0b                	mov    (%ebx),%ecx
+  802035:	8d 51 20             	lea    0x20(%ecx),%edx
+  802038:	39 d0                	cmp    %edx,%eax
+  80203a:	72 1a                	jb     802056 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  80203c:	89 da                	mov    %ebx,%edx
+  80203e:	89 f0                	mov    %esi,%eax
+  802040:	e8 5c ff ff ff       	call   801fa1 <_pipeisclosed>
+  802045:	85 c0                	test   %eax,%eax
+  802047:	74 e2                	je     80202b <devpipe_write+0x25>
+				return 0;
+  802049:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80204e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802051:	5b                   	pop    %ebx
+  802052:	5e                   	pop    %esi
+  802053:	5f                   	pop    %edi
+  802054:	5d                   	pop    %ebp
+  802055:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802056:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802059:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  80205d:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802060:	89 c2                	mov    %eax,%edx
+  802062:	c1 fa 1f             	sar    $0x1f,%edx
+  802065:	89 d1                	mov    %edx,%ecx
+  802067:	c1 e9 1b             	shr    $0x1b,%ecx
+  80206a:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80206d:	83 e2 1f             	and    $0x1f,%edx
+  802070:	29 ca                	sub    %ecx,%edx
+  802072:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802076:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  80207a:	83 c0 01             	add    $0x1,%eax
+  80207d:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802080:	83 c7 01             	add    $0x1,%edi
+  802083:	eb 9d                	jmp    802022 <devpipe_write+0x1c>
+
+00802085 <devpipe_read>:
+{
+  802085:	55                   	push   %ebp
+  802086:	89 e5                	mov    %esp,%ebp
+  802088:	57                   	push   %edi
+  802089:	56                   	push   %esi
+  80208a:	53                   	push   %ebx
+  80208b:	83 ec 18             	sub    $0x18,%esp
+  80208e:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802091:	57                   	push   %edi
+  802092:	e8 4f f2 ff ff       	call   8012e6 <fd2data>
+  802097:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802099:	83 c4 10             	add    $0x10,%esp
+  80209c:	be 00 00 00 00       	mov    $0x0,%esi
+  8020a1:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8020a4:	75 13                	jne    8020b9 <devpipe_read+0x34>
+	return i;
+  8020a6:	89 f0                	mov    %esi,%eax
+  8020a8:	eb 02                	jmp    8020ac <devpipe_read+0x27>
+				return i;
+  8020aa:	89 f0                	mov    %esi,%eax
+}
+  8020ac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020af:	5b                   	pop    %ebx
+  8020b0:	5e                   	pop    %esi
+  8020b1:	5f                   	pop    %edi
+  8020b2:	5d                   	pop    %ebp
+  8020b3:	c3                   	ret
+			sys_yield();
+  8020b4:	e8 14 ec ff ff       	call   800ccd <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  8020b9:	8b 03                	mov    (%ebx),%eax
+  8020bb:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8020be:	75 18                	jne    8020d8 <devpipe_read+0x53>
+			if (i > 0)
+  8020c0:	85 f6                	test   %esi,%esi
+  8020c2:	75 e6                	jne    8020aa <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  8020c4:	89 da                	mov    %ebx,%edx
+  8020c6:	89 f8                	mov    %edi,%eax
+  8020c8:	e8 d4 fe ff ff       	call   801fa1 <_pipeisclosed>
+  8020cd:	85 c0                	test   %eax,%eax
+  8020cf:	74 e3                	je     8020b4 <devpipe_read+0x2f>
+				return 0;
+  8020d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020d6:	eb d4                	jmp    8020ac <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8020d8:	99                   	cltd
+  8020d9:	c1 ea 1b             	shr    $0x1b,%edx
+  8020dc:	01 d0                	add    %edx,%eax
+  8020de:	83 e0 1f             	and    $0x1f,%eax
+  8020e1:	29 d0                	sub    %edx,%eax
+  8020e3:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8020e8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8020eb:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8020ee:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8020f1:	83 c6 01             	add    $0x1,%esi
+  8020f4:	eb ab                	jmp    8020a1 <devpipe_read+0x1c>
+
+008020f6 <pipe>:
+{
+  8020f6:	55                   	push   %ebp
+  8020f7:	89 e5                	mov    %esp,%ebp
+  8020f9:	56                   	push   %esi
+  8020fa:	53                   	push   %ebx
+  8020fb:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8020fe:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802101:	50                   	push   %eax
+  802102:	e8 f6 f1 ff ff       	call   8012fd <fd_alloc>
+  802107:	89 c3                	mov    %eax,%ebx
+  802109:	83 c4 10             	add    $0x10,%esp
+  80210c:	85 c0                	test   %eax,%eax
+  80210e:	0f 88 23 01 00 00    	js     802237 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802114:	83 ec 04             	sub    $0x4,%esp
+  802117:	68 07 04 00 00       	push   $0x407
+  80211c:	ff 75 f4             	push   -0xc(%ebp)
+  80211f:	6a 00                	push   $0x0
+  802121:	e8 c6 eb ff ff       	call   800cec <sys_page_alloc>
+  802126:	89 c3                	mov    %eax,%ebx
+  802128:	83 c4 10             	add    $0x10,%esp
+  80212b:	85 c0                	test   %eax,%eax
+  80212d:	0f 88 04 01 00 00    	js     802237 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802133:	83 ec 0c             	sub    $0xc,%esp
+  802136:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802139:	50                   	push   %eax
+  80213a:	e8 be f1 ff ff       	call   8012fd <fd_alloc>
+  80213f:	89 c3                	mov    %eax,%ebx
+  802141:	83 c4 10             	add    $0x10,%esp
+  802144:	85 c0                	test   %eax,%eax
+  802146:	0f 88 db 00 00 00    	js     802227 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80214c:	83 ec 04             	sub    $0x4,%esp
+  80214f:	68 07 04 00 00       	push   $0x407
+  802154:	ff 75 f0             	push   -0x10(%ebp)
+  802157:	6a 00                	push   $0x0
+  802159:	e8 8e eb ff ff       	call   800cec <sys_page_alloc>
+  80215e:	89 c3                	mov    %eax,%ebx
+  802160:	83 c4 10             	add    $0x10,%esp
+  802163:	85 c0                	test   %eax,%eax
+  802165:	0f 88 bc 00 00 00    	js     802227 <pipe+0x131>
+	va = fd2data(fd0);
+  80216b:	83 ec 0c             	sub    $0xc,%esp
+  80216e:	ff 75 f4             	push   -0xc(%ebp)
+  802171:	e8 70 f1 ff ff       	call   8012e6 <fd2data>
+  802176:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802178:	83 c4 0c             	add    $0xc,%esp
+  80217b:	68 07 04 00 00       	push   $0x407
+  802180:	50                   	push   %eax
+  802181:	6a 00                	push   $0x0
+  802183:	e8 64 eb ff ff       	call   800cec <sys_page_alloc>
+  802188:	89 c3                	mov    %eax,%ebx
+  80218a:	83 c4 10             	add    $0x10,%esp
+  80218d:	85 c0                	test   %eax,%eax
+  80218f:	0f 88 82 00 00 00    	js     802217 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802195:	83 ec 0c             	sub    $0xc,%esp
+  802198:	ff 75 f0             	push   -0x10(%ebp)
+  80219b:	e8 46 f1 ff ff       	call   8012e6 <fd2data>
+  8021a0:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8021a7:	50                   	push   %eax
+  8021a8:	6a 00                	push   $0x0
+  8021aa:	56                   	push   %esi
+  8021ab:	6a 00                	push   $0x0
+  8021ad:	e8 7d eb ff ff       	call   800d2f <sys_page_map>
+  8021b2:	89 c3                	mov    %eax,%ebx
+  8021b4:	83 c4 20             	add    $0x20,%esp
+  8021b7:	85 c0                	test   %eax,%eax
+  8021b9:	78 4e                	js     802209 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8021bb:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  8021c0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8021c3:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8021c5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8021c8:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8021cf:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8021d2:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8021d4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8021d7:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8021de:	83 ec 0c             	sub    $0xc,%esp
+  8021e1:	ff 75 f4             	push   -0xc(%ebp)
+  8021e4:	e8 ed f0 ff ff       	call   8012d6 <fd2num>
+  8021e9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8021ec:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8021ee:	83 c4 04             	add    $0x4,%esp
+  8021f1:	ff 75 f0             	push   -0x10(%ebp)
+  8021f4:	e8 dd f0 ff ff       	call   8012d6 <fd2num>
+  8021f9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8021fc:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8021ff:	83 c4 10             	add    $0x10,%esp
+  802202:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802207:	eb 2e                	jmp    802237 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802209:	83 ec 08             	sub    $0x8,%esp
+  80220c:	56                   	push   %esi
+  80220d:	6a 00                	push   $0x0
+  80220f:	e8 5d eb ff ff       	call   800d71 <sys_page_unmap>
+  802214:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802217:	83 ec 08             	sub    $0x8,%esp
+  80221a:	ff 75 f0             	push   -0x10(%ebp)
+  80221d:	6a 00                	push   $0x0
+  80221f:	e8 4d eb ff ff       	call   800d71 <sys_page_unmap>
+  802224:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802227:	83 ec 08             	sub    $0x8,%esp
+  80222a:	ff 75 f4             	push   -0xc(%ebp)
+  80222d:	6a 00                	push   $0x0
+  80222f:	e8 3d eb ff ff       	call   800d71 <sys_page_unmap>
+  802234:	83 c4 10             	add    $0x10,%esp
+}
+  802237:	89 d8                	mov    %ebx,%eax
+  802239:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80223c:	5b                   	pop    %ebx
+  80223d:	5e                   	pop    %esi
+  80223e:	5d                   	pop    %ebp
+  80223f:	c3                   	ret
+
+00802240 <pipeisclosed>:
+{
+  802240:	55                   	push   %ebp
+  802241:	89 e5                	mov    %esp,%ebp
+  802243:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802246:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802249:	50                   	push   %eax
+  80224a:	ff 75 08             	push   0x8(%ebp)
+  80224d:	e8 01 f1 ff ff       	call   801353 <fd_lookup>
+  802252:	83 c4 10             	add    $0x10,%esp
+  802255:	85 c0                	test   %eax,%eax
+  802257:	78 18                	js     802271 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802259:	83 ec 0c             	sub    $0xc,%esp
+  80225c:	ff 75 f4             	push   -0xc(%ebp)
+  80225f:	e8 82 f0 ff ff       	call   8012e6 <fd2data>
+  802264:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802266:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802269:	e8 33 fd ff ff       	call   801fa1 <_pipeisclosed>
+  80226e:	83 c4 10             	add    $0x10,%esp
+}
+  802271:	c9                   	leave
+  802272:	c3                   	ret
+
+00802273 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802273:	b8 00 00 00 00       	mov    $0x0,%eax
+  802278:	c3                   	ret
+
+00802279 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802279:	55                   	push   %ebp
+  80227a:	89 e5                	mov    %esp,%ebp
+  80227c:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80227f:	68 63 30 80 00       	push   $0x803063
+  802284:	ff 75 0c             	push   0xc(%ebp)
+  802287:	e8 74 e6 ff ff       	call   800900 <strcpy>
+	return 0;
+}
+  80228c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802291:	c9                   	leave
+  802292:	c3                   	ret
+
+00802293 <devcons_write>:
+{
+  802293:	55                   	push   %ebp
+  802294:	89 e5                	mov    %esp,%ebp
+  802296:	57                   	push   %edi
+  802297:	56                   	push   %esi
+  802298:	53                   	push   %ebx
+  802299:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80229f:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8022a4:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8022aa:	eb 2e                	jmp    8022da <devcons_write+0x47>
+		m = n - tot;
+  8022ac:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8022af:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8022b1:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8022b6:	39 c3                	cmp    %eax,%ebx
+  8022b8:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8022bb:	83 ec 04             	sub    $0x4,%esp
+  8022be:	53                   	push   %ebx
+  8022bf:	89 f0                	mov    %esi,%eax
+  8022c1:	03 45 0c             	add    0xc(%ebp),%eax
+  8022c4:	50                   	push   %eax
+  8022c5:	57                   	push   %edi
+  8022c6:	e8 bb e7 ff ff       	call   800a86 <memmove>
+		sys_cputs(buf, m);
+  8022cb:	83 c4 08             	add    $0x8,%esp
+  8022ce:	53                   	push   %ebx
+  8022cf:	57                   	push   %edi
+  8022d0:	e8 5b e9 ff ff       	call   800c30 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8022d5:	01 de                	add    %ebx,%esi
+  8022d7:	83 c4 10             	add    $0x10,%esp
+  8022da:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8022dd:	72 cd                	jb     8022ac <devcons_write+0x19>
+}
+  8022df:	89 f0                	mov    %esi,%eax
+  8022e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022e4:	5b                   	pop    %ebx
+  8022e5:	5e                   	pop    %esi
+  8022e6:	5f                   	pop    %edi
+  8022e7:	5d                   	pop    %ebp
+  8022e8:	c3                   	ret
+
+008022e9 <devcons_read>:
+{
+  8022e9:	55                   	push   %ebp
+  8022ea:	89 e5                	mov    %esp,%ebp
+  8022ec:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8022ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022f4:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8022f8:	75 07                	jne    802301 <devcons_read+0x18>
+  8022fa:	eb 1f                	jmp    80231b <devcons_read+0x32>
+		sys_yield();
+  8022fc:	e8 cc e9 ff ff       	call   800ccd <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802301:	e8 48 e9 ff ff       	call   800c4e <sys_cgetc>
+  802306:	85 c0                	test   %eax,%eax
+  802308:	74 f2                	je     8022fc <devcons_read+0x13>
+	if (c < 0)
+  80230a:	78 0f                	js     80231b <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80230c:	83 f8 04             	cmp    $0x4,%eax
+  80230f:	74 0c                	je     80231d <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802311:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802314:	88 02                	mov    %al,(%edx)
+	return 1;
+  802316:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80231b:	c9                   	leave
+  80231c:	c3                   	ret
+		return 0;
+  80231d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802322:	eb f7                	jmp    80231b <devcons_read+0x32>
+
+00802324 <cputchar>:
+{
+  802324:	55                   	push   %ebp
+  802325:	89 e5                	mov    %esp,%ebp
+  802327:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80232a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80232d:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802330:	6a 01                	push   $0x1
+  802332:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802335:	50                   	push   %eax
+  802336:	e8 f5 e8 ff ff       	call   800c30 <sys_cputs>
+}
+  80233b:	83 c4 10             	add    $0x10,%esp
+  80233e:	c9                   	leave
+  80233f:	c3                   	ret
+
+00802340 <getchar>:
+{
+  802340:	55                   	push   %ebp
+  802341:	89 e5                	mov    %esp,%ebp
+  802343:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802346:	6a 01                	push   $0x1
+  802348:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80234b:	50                   	push   %eax
+  80234c:	6a 00                	push   $0x0
+  80234e:	e8 66 f2 ff ff       	call   8015b9 <read>
+	if (r < 0)
+  802353:	83 c4 10             	add    $0x10,%esp
+  802356:	85 c0                	test   %eax,%eax
+  802358:	78 06                	js     802360 <getchar+0x20>
+	if (r < 1)
+  80235a:	74 06                	je     802362 <getchar+0x22>
+	return c;
+  80235c:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802360:	c9                   	leave
+  802361:	c3                   	ret
+		return -E_EOF;
+  802362:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802367:	eb f7                	jmp    802360 <getchar+0x20>
+
+00802369 <iscons>:
+{
+  802369:	55                   	push   %ebp
+  80236a:	89 e5                	mov    %esp,%ebp
+  80236c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80236f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802372:	50                   	push   %eax
+  802373:	ff 75 08             	push   0x8(%ebp)
+  802376:	e8 d8 ef ff ff       	call   801353 <fd_lookup>
+  80237b:	83 c4 10             	add    $0x10,%esp
+  80237e:	85 c0                	test   %eax,%eax
+  802380:	78 11                	js     802393 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802382:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802385:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  80238b:	39 10                	cmp    %edx,(%eax)
+  80238d:	0f 94 c0             	sete   %al
+  802390:	0f b6 c0             	movzbl %al,%eax
+}
+  802393:	c9                   	leave
+  802394:	c3                   	ret
+
+00802395 <opencons>:
+{
+  802395:	55                   	push   %ebp
+  802396:	89 e5                	mov    %esp,%ebp
+  802398:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80239b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80239e:	50                   	push   %eax
+  80239f:	e8 59 ef ff ff       	call   8012fd <fd_alloc>
+  8023a4:	83 c4 10             	add    $0x10,%esp
+  8023a7:	85 c0                	test   %eax,%eax
+  8023a9:	78 3a                	js     8023e5 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8023ab:	83 ec 04             	sub    $0x4,%esp
+  8023ae:	68 07 04 00 00       	push   $0x407
+  8023b3:	ff 75 f4             	push   -0xc(%ebp)
+  8023b6:	6a 00                	push   $0x0
+  8023b8:	e8 2f e9 ff ff       	call   800cec <sys_page_alloc>
+  8023bd:	83 c4 10             	add    $0x10,%esp
+  8023c0:	85 c0                	test   %eax,%eax
+  8023c2:	78 21                	js     8023e5 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8023c4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023c7:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  8023cd:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8023cf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023d2:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8023d9:	83 ec 0c             	sub    $0xc,%esp
+  8023dc:	50                   	push   %eax
+  8023dd:	e8 f4 ee ff ff       	call   8012d6 <fd2num>
+  8023e2:	83 c4 10             	add    $0x10,%esp
+}
+  8023e5:	c9                   	leave
+  8023e6:	c3                   	ret
+
+008023e7 <set_pgfault_handler>:
+// allocate an exception stack (one page of memory with its top
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf)) {
+  8023e7:	55                   	push   %ebp
+  8023e8:	89 e5                	mov    %esp,%ebp
+  8023ea:	83 ec 08             	sub    $0x8,%esp
+  int r;
+
+  if (_pgfault_handler == 0) {
+  8023ed:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  8023f4:	74 0a                	je     802400 <set_pgfault_handler+0x19>
+    if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)))
+      panic(" set_pgfault_handler sys_env_set_pgfault_upcall panic: %e\n", r);
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  8023f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023f9:	a3 00 80 80 00       	mov    %eax,0x808000
+
+
+}
+  8023fe:	c9                   	leave
+  8023ff:	c3                   	ret
+    if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)))
+  802400:	83 ec 04             	sub    $0x4,%esp
+  802403:	6a 07                	push   $0x7
+  802405:	68 00 f0 bf ee       	push   $0xeebff000
+  80240a:	6a 00                	push   $0x0
+  80240c:	e8 db e8 ff ff       	call   800cec <sys_page_alloc>
+  802411:	83 c4 10             	add    $0x10,%esp
+  802414:	85 c0                	test   %eax,%eax
+  802416:	75 28                	jne    802440 <set_pgfault_handler+0x59>
+    if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)))
+  802418:	83 ec 08             	sub    $0x8,%esp
+  80241b:	68 52 24 80 00       	push   $0x802452
+  802420:	6a 00                	push   $0x0
+  802422:	e8 10 ea ff ff       	call   800e37 <sys_env_set_pgfault_upcall>
+  802427:	83 c4 10             	add    $0x10,%esp
+  80242a:	85 c0                	test   %eax,%eax
+  80242c:	74 c8                	je     8023f6 <set_pgfault_handler+0xf>
+      panic(" set_pgfault_handler sys_env_set_pgfault_upcall panic: %e\n", r);
+  80242e:	50                   	push   %eax
+  80242f:	68 a0 30 80 00       	push   $0x8030a0
+  802434:	6a 22                	push   $0x22
+  802436:	68 db 30 80 00       	push   $0x8030db
+  80243b:	e8 2c de ff ff       	call   80026c <_panic>
+      panic("set_pgfault_handler sys_page_alloc panic: %e\n", r);
+  802440:	50                   	push   %eax
+  802441:	68 70 30 80 00       	push   $0x803070
+  802446:	6a 20                	push   $0x20
+  802448:	68 db 30 80 00       	push   $0x8030db
+  80244d:	e8 1a de ff ff       	call   80026c <_panic>
+
+00802452 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  802452:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  802453:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  802458:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80245a:	83 c4 04             	add    $0x4,%esp
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	// push the trap-time %eip onto the trap-time stack
+    subl $0x4, 0x30(%esp) # for push eip
+  80245d:	83 6c 24 30 04       	subl   $0x4,0x30(%esp)
+    movl 0x30(%esp), %ebx #regular esp
+  802462:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+    movl 0x28(%esp), %eax #eip
+  802466:	8b 44 24 28          	mov    0x28(%esp),%eax
+    movl %eax, (%ebx)
+  80246a:	89 03                	mov    %eax,(%ebx)
+
+    // Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+    addl $8, %esp
+  80246c:	83 c4 08             	add    $0x8,%esp
+    popal
+  80246f:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  802470:	83 c4 04             	add    $0x4,%esp
+	popfl
+  802473:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  802474:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  802475:	c3                   	ret
+
+00802476 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  802476:	55                   	push   %ebp
+  802477:	89 e5                	mov    %esp,%ebp
+  802479:	56                   	push   %esi
+  80247a:	53                   	push   %ebx
+  80247b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80247e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802481:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  802484:	85 c0                	test   %eax,%eax
+  802486:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80248b:	0f 44 c2             	cmove  %edx,%eax
+  80248e:	83 ec 0c             	sub    $0xc,%esp
+  802491:	50                   	push   %eax
+  802492:	e8 05 ea ff ff       	call   800e9c <sys_ipc_recv>
+
+  if (from_env_store)
+  802497:	83 c4 10             	add    $0x10,%esp
+  80249a:	85 f6                	test   %esi,%esi
+  80249c:	74 17                	je     8024b5 <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  80249e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024a3:	85 c0                	test   %eax,%eax
+  8024a5:	75 0c                	jne    8024b3 <ipc_recv+0x3d>
+  8024a7:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  8024ad:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  8024b3:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  8024b5:	85 db                	test   %ebx,%ebx
+  8024b7:	74 2b                	je     8024e4 <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  8024b9:	85 c0                	test   %eax,%eax
+  8024bb:	74 0d                	je     8024ca <ipc_recv+0x54>
+  8024bd:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  8024c3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024c6:	5b                   	pop    %ebx
+  8024c7:	5e                   	pop    %esi
+  8024c8:	5d                   	pop    %ebp
+  8024c9:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  8024ca:	a1 08 50 80 00       	mov    0x805008,%eax
+  8024cf:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8024d5:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  8024d7:	a1 08 50 80 00       	mov    0x805008,%eax
+  8024dc:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  8024e2:	eb df                	jmp    8024c3 <ipc_recv+0x4d>
+  8024e4:	85 c0                	test   %eax,%eax
+  8024e6:	75 db                	jne    8024c3 <ipc_recv+0x4d>
+  8024e8:	eb ed                	jmp    8024d7 <ipc_recv+0x61>
+
+008024ea <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  8024ea:	55                   	push   %ebp
+  8024eb:	89 e5                	mov    %esp,%ebp
+  8024ed:	57                   	push   %edi
+  8024ee:	56                   	push   %esi
+  8024ef:	53                   	push   %ebx
+  8024f0:	83 ec 0c             	sub    $0xc,%esp
+  8024f3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8024f6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8024f9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  8024fc:	85 db                	test   %ebx,%ebx
+  8024fe:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802503:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  802506:	ff 75 14             	push   0x14(%ebp)
+  802509:	53                   	push   %ebx
+  80250a:	56                   	push   %esi
+  80250b:	57                   	push   %edi
+  80250c:	e8 68 e9 ff ff       	call   800e79 <sys_ipc_try_send>
+  802511:	83 c4 10             	add    $0x10,%esp
+  802514:	85 c0                	test   %eax,%eax
+  802516:	74 1e                	je     802536 <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  802518:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80251b:	75 07                	jne    802524 <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  80251d:	e8 ab e7 ff ff       	call   800ccd <sys_yield>
+  802522:	eb e2                	jmp    802506 <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  802524:	50                   	push   %eax
+  802525:	68 e9 30 80 00       	push   $0x8030e9
+  80252a:	6a 3c                	push   $0x3c
+  80252c:	68 f6 30 80 00       	push   $0x8030f6
+  802531:	e8 36 dd ff ff       	call   80026c <_panic>
+  }
+
+#endif
+}
+  802536:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802539:	5b                   	pop    %ebx
+  80253a:	5e                   	pop    %esi
+  80253b:	5f                   	pop    %edi
+  80253c:	5d                   	pop    %ebp
+  80253d:	c3                   	ret
+
+0080253e <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  80253e:	55                   	push   %ebp
+  80253f:	89 e5                	mov    %esp,%ebp
+  802541:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  802544:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  802549:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80254c:	c1 e0 04             	shl    $0x4,%eax
+  80254f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802554:	8b 40 50             	mov    0x50(%eax),%eax
+  802557:	39 c8                	cmp    %ecx,%eax
+  802559:	74 12                	je     80256d <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  80255b:	83 c2 01             	add    $0x1,%edx
+  80255e:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802564:	75 e3                	jne    802549 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802566:	b8 00 00 00 00       	mov    $0x0,%eax
+  80256b:	eb 0e                	jmp    80257b <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  80256d:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802570:	c1 e0 04             	shl    $0x4,%eax
+  802573:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802578:	8b 40 48             	mov    0x48(%eax),%eax
+  80257b:	5d                   	pop    %ebp
+  80257c:	c3                   	ret
+
+0080257d <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80257d:	55                   	push   %ebp
+  80257e:	89 e5                	mov    %esp,%ebp
+  802580:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802583:	89 c2                	mov    %eax,%edx
+  802585:	c1 ea 16             	shr    $0x16,%edx
+  802588:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80258f:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802594:	f6 c1 01             	test   $0x1,%cl
+  802597:	74 1c                	je     8025b5 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  802599:	c1 e8 0c             	shr    $0xc,%eax
+  80259c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8025a3:	a8 01                	test   $0x1,%al
+  8025a5:	74 0e                	je     8025b5 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8025a7:	c1 e8 0c             	shr    $0xc,%eax
+  8025aa:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  8025b1:	ef 
+  8025b2:	0f b7 d2             	movzwl %dx,%edx
+}
+  8025b5:	89 d0                	mov    %edx,%eax
+  8025b7:	5d                   	pop    %ebp
+  8025b8:	c3                   	ret
+  8025b9:	66 90                	xchg   %ax,%ax
+  8025bb:	66 90                	xchg   %ax,%ax
+  8025bd:	66 90                	xchg   %ax,%ax
+  8025bf:	90                   	nop
+
+008025c0 <__udivmoddi4>:
+  8025c0:	55                   	push   %ebp
+  8025c1:	57                   	push   %edi
+  8025c2:	56                   	push   %esi
+  8025c3:	53                   	push   %ebx
+  8025c4:	83 ec 24             	sub    $0x24,%esp
+  8025c7:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8025cb:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8025cf:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  8025d3:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8025d7:	8b 54 24 44          	mov    0x44(%esp),%edx
+  8025db:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8025df:	8b 44 24 40          	mov    0x40(%esp),%eax
+  8025e3:	89 d3                	mov    %edx,%ebx
+  8025e5:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8025e9:	09 c3                	or     %eax,%ebx
+  8025eb:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8025ef:	0f 84 9c 00 00 00    	je     802691 <__udivmoddi4+0xd1>
+  8025f5:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8025fc:	00 
+  8025fd:	31 c0                	xor    %eax,%eax
+  8025ff:	31 d2                	xor    %edx,%edx
+  802601:	89 fb                	mov    %edi,%ebx
+  802603:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80260a:	00 
+  80260b:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802610:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802614:	01 c0                	add    %eax,%eax
+  802616:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80261d:	00 
+  80261e:	89 c6                	mov    %eax,%esi
+  802620:	89 d7                	mov    %edx,%edi
+  802622:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802626:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80262a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80262d:	d3 ea                	shr    %cl,%edx
+  80262f:	f6 c1 20             	test   $0x20,%cl
+  802632:	0f 45 c2             	cmovne %edx,%eax
+  802635:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802639:	83 e0 01             	and    $0x1,%eax
+  80263c:	09 fa                	or     %edi,%edx
+  80263e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802642:	89 04 24             	mov    %eax,(%esp)
+  802645:	8b 04 24             	mov    (%esp),%eax
+  802648:	89 d5                	mov    %edx,%ebp
+  80264a:	09 f0                	or     %esi,%eax
+  80264c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802650:	39 f0                	cmp    %esi,%eax
+  802652:	19 fd                	sbb    %edi,%ebp
+  802654:	72 1d                	jb     802673 <__udivmoddi4+0xb3>
+  802656:	29 f0                	sub    %esi,%eax
+  802658:	19 fa                	sbb    %edi,%edx
+  80265a:	89 cf                	mov    %ecx,%edi
+  80265c:	c1 ef 05             	shr    $0x5,%edi
+  80265f:	83 e7 01             	and    $0x1,%edi
+  802662:	89 fe                	mov    %edi,%esi
+  802664:	d3 e7                	shl    %cl,%edi
+  802666:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80266a:	83 f6 01             	xor    $0x1,%esi
+  80266d:	d3 e6                	shl    %cl,%esi
+  80266f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802673:	83 e9 01             	sub    $0x1,%ecx
+  802676:	73 98                	jae    802610 <__udivmoddi4+0x50>
+  802678:	85 db                	test   %ebx,%ebx
+  80267a:	74 05                	je     802681 <__udivmoddi4+0xc1>
+  80267c:	89 03                	mov    %eax,(%ebx)
+  80267e:	89 53 04             	mov    %edx,0x4(%ebx)
+  802681:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802685:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802689:	83 c4 24             	add    $0x24,%esp
+  80268c:	5b                   	pop    %ebx
+  80268d:	5e                   	pop    %esi
+  80268e:	5f                   	pop    %edi
+  80268f:	5d                   	pop    %ebp
+  802690:	c3                   	ret
+  802691:	85 ff                	test   %edi,%edi
+  802693:	74 0d                	je     8026a2 <__udivmoddi4+0xe2>
+  802695:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  80269b:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  8026a2:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8026a6:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8026aa:	89 44 24 18          	mov    %eax,0x18(%esp)
+  8026ae:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8026b2:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  8026b6:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8026ba:	83 c4 24             	add    $0x24,%esp
+  8026bd:	5b                   	pop    %ebx
+  8026be:	5e                   	pop    %esi
+  8026bf:	5f                   	pop    %edi
+  8026c0:	5d                   	pop    %ebp
+  8026c1:	c3                   	ret
+  8026c2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8026c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+008026d0 <__udivdi3>:
+  8026d0:	57                   	push   %edi
+  8026d1:	56                   	push   %esi
+  8026d2:	53                   	push   %ebx
+  8026d3:	83 ec 20             	sub    $0x20,%esp
+  8026d6:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8026da:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8026de:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8026e2:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8026e6:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8026ea:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8026ee:	89 d1                	mov    %edx,%ecx
+  8026f0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8026f4:	09 c1                	or     %eax,%ecx
+  8026f6:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8026fa:	89 44 24 18          	mov    %eax,0x18(%esp)
+  8026fe:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802702:	0f 84 88 00 00 00    	je     802790 <__udivdi3+0xc0>
+  802708:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80270f:	00 
+  802710:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802715:	31 c0                	xor    %eax,%eax
+  802717:	31 d2                	xor    %edx,%edx
+  802719:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802720:	00 
+  802721:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802728:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80272c:	01 c0                	add    %eax,%eax
+  80272e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802735:	00 
+  802736:	89 c6                	mov    %eax,%esi
+  802738:	89 d7                	mov    %edx,%edi
+  80273a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80273e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802742:	0f ad d0             	shrd   %cl,%edx,%eax
+  802745:	d3 ea                	shr    %cl,%edx
+  802747:	f6 c1 20             	test   $0x20,%cl
+  80274a:	0f 45 c2             	cmovne %edx,%eax
+  80274d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802751:	83 e0 01             	and    $0x1,%eax
+  802754:	09 fa                	or     %edi,%edx
+  802756:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80275a:	89 04 24             	mov    %eax,(%esp)
+  80275d:	8b 04 24             	mov    (%esp),%eax
+  802760:	89 d3                	mov    %edx,%ebx
+  802762:	09 f0                	or     %esi,%eax
+  802764:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802768:	39 f0                	cmp    %esi,%eax
+  80276a:	19 fb                	sbb    %edi,%ebx
+  80276c:	72 1d                	jb     80278b <__udivdi3+0xbb>
+  80276e:	29 f0                	sub    %esi,%eax
+  802770:	19 fa                	sbb    %edi,%edx
+  802772:	89 cf                	mov    %ecx,%edi
+  802774:	c1 ef 05             	shr    $0x5,%edi
+  802777:	83 e7 01             	and    $0x1,%edi
+  80277a:	89 fe                	mov    %edi,%esi
+  80277c:	d3 e7                	shl    %cl,%edi
+  80277e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802782:	83 f6 01             	xor    $0x1,%esi
+  802785:	d3 e6                	shl    %cl,%esi
+  802787:	09 74 24 18          	or     %esi,0x18(%esp)
+  80278b:	83 e9 01             	sub    $0x1,%ecx
+  80278e:	73 98                	jae    802728 <__udivdi3+0x58>
+  802790:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802794:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802798:	83 c4 20             	add    $0x20,%esp
+  80279b:	5b                   	pop    %ebx
+  80279c:	5e                   	pop    %esi
+  80279d:	5f                   	pop    %edi
+  80279e:	c3                   	ret
+  80279f:	90                   	nop
+
+008027a0 <__umoddi3>:
+  8027a0:	57                   	push   %edi
+  8027a1:	56                   	push   %esi
+  8027a2:	53                   	push   %ebx
+  8027a3:	83 ec 18             	sub    $0x18,%esp
+  8027a6:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8027aa:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8027ae:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8027b2:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8027b6:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8027ba:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8027be:	89 d1                	mov    %edx,%ecx
+  8027c0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8027c4:	09 c1                	or     %eax,%ecx
+  8027c6:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8027ca:	74 5b                	je     802827 <__umoddi3+0x87>
+  8027cc:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8027d1:	31 c0                	xor    %eax,%eax
+  8027d3:	31 d2                	xor    %edx,%edx
+  8027d5:	8d 76 00             	lea    0x0(%esi),%esi
+  8027d8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8027dc:	01 c0                	add    %eax,%eax
+  8027de:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8027e5:	00 
+  8027e6:	89 c6                	mov    %eax,%esi
+  8027e8:	89 d7                	mov    %edx,%edi
+  8027ea:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8027ee:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8027f2:	0f ad d0             	shrd   %cl,%edx,%eax
+  8027f5:	d3 ea                	shr    %cl,%edx
+  8027f7:	f6 c1 20             	test   $0x20,%cl
+  8027fa:	0f 45 c2             	cmovne %edx,%eax
+  8027fd:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802801:	83 e0 01             	and    $0x1,%eax
+  802804:	09 fa                	or     %edi,%edx
+  802806:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80280a:	89 04 24             	mov    %eax,(%esp)
+  80280d:	8b 04 24             	mov    (%esp),%eax
+  802810:	89 d3                	mov    %edx,%ebx
+  802812:	09 f0                	or     %esi,%eax
+  802814:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802818:	39 f0                	cmp    %esi,%eax
+  80281a:	19 fb                	sbb    %edi,%ebx
+  80281c:	72 04                	jb     802822 <__umoddi3+0x82>
+  80281e:	29 f0                	sub    %esi,%eax
+  802820:	19 fa                	sbb    %edi,%edx
+  802822:	83 e9 01             	sub    $0x1,%ecx
+  802825:	73 b1                	jae    8027d8 <__umoddi3+0x38>
+  802827:	83 c4 18             	add    $0x18,%esp
+  80282a:	5b                   	pop    %ebx
+  80282b:	5e                   	pop    %esi
+  80282c:	5f                   	pop    %edi
+  80282d:	c3                   	ret
+  80282e:	66 90                	xchg   %ax,%ax
+
+00802830 <__divdi3>:
+  802830:	55                   	push   %ebp
+  802831:	57                   	push   %edi
+  802832:	56                   	push   %esi
+  802833:	53                   	push   %ebx
+  802834:	83 ec 24             	sub    $0x24,%esp
+  802837:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  80283b:	8b 74 24 44          	mov    0x44(%esp),%esi
+  80283f:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802843:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802847:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  80284b:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  80284f:	85 d2                	test   %edx,%edx
+  802851:	0f 88 e0 00 00 00    	js     802937 <__divdi3+0x107>
+  802857:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  80285b:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  80285f:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802863:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802867:	85 f6                	test   %esi,%esi
+  802869:	78 16                	js     802881 <__divdi3+0x51>
+  80286b:	89 f1                	mov    %esi,%ecx
+  80286d:	31 c0                	xor    %eax,%eax
+  80286f:	31 d2                	xor    %edx,%edx
+  802871:	09 d9                	or     %ebx,%ecx
+  802873:	0f 85 f3 00 00 00    	jne    80296c <__divdi3+0x13c>
+  802879:	83 c4 24             	add    $0x24,%esp
+  80287c:	5b                   	pop    %ebx
+  80287d:	5e                   	pop    %esi
+  80287e:	5f                   	pop    %edi
+  80287f:	5d                   	pop    %ebp
+  802880:	c3                   	ret
+  802881:	bf 01 00 00 00       	mov    $0x1,%edi
+  802886:	f7 5c 24 08          	negl   0x8(%esp)
+  80288a:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  80288f:	f7 5c 24 0c          	negl   0xc(%esp)
+  802893:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80289a:	00 
+  80289b:	31 c0                	xor    %eax,%eax
+  80289d:	31 d2                	xor    %edx,%edx
+  80289f:	89 fb                	mov    %edi,%ebx
+  8028a1:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8028a8:	00 
+  8028a9:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8028ae:	66 90                	xchg   %ax,%ax
+  8028b0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8028b4:	01 c0                	add    %eax,%eax
+  8028b6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8028bd:	00 
+  8028be:	89 c6                	mov    %eax,%esi
+  8028c0:	89 d7                	mov    %edx,%edi
+  8028c2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8028c6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8028ca:	0f ad d0             	shrd   %cl,%edx,%eax
+  8028cd:	d3 ea                	shr    %cl,%edx
+  8028cf:	f6 c1 20             	test   $0x20,%cl
+  8028d2:	0f 45 c2             	cmovne %edx,%eax
+  8028d5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8028d9:	83 e0 01             	and    $0x1,%eax
+  8028dc:	09 fa                	or     %edi,%edx
+  8028de:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8028e2:	89 04 24             	mov    %eax,(%esp)
+  8028e5:	8b 04 24             	mov    (%esp),%eax
+  8028e8:	89 d5                	mov    %edx,%ebp
+  8028ea:	09 f0                	or     %esi,%eax
+  8028ec:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8028f0:	39 f0                	cmp    %esi,%eax
+  8028f2:	19 fd                	sbb    %edi,%ebp
+  8028f4:	72 1d                	jb     802913 <__divdi3+0xe3>
+  8028f6:	29 f0                	sub    %esi,%eax
+  8028f8:	19 fa                	sbb    %edi,%edx
+  8028fa:	89 cf                	mov    %ecx,%edi
+  8028fc:	c1 ef 05             	shr    $0x5,%edi
+  8028ff:	83 e7 01             	and    $0x1,%edi
+  802902:	89 fe                	mov    %edi,%esi
+  802904:	d3 e7                	shl    %cl,%edi
+  802906:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80290a:	83 f6 01             	xor    $0x1,%esi
+  80290d:	d3 e6                	shl    %cl,%esi
+  80290f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802913:	83 e9 01             	sub    $0x1,%ecx
+  802916:	73 98                	jae    8028b0 <__divdi3+0x80>
+  802918:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80291c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802920:	85 db                	test   %ebx,%ebx
+  802922:	0f 84 51 ff ff ff    	je     802879 <__divdi3+0x49>
+  802928:	f7 d8                	neg    %eax
+  80292a:	83 d2 00             	adc    $0x0,%edx
+  80292d:	83 c4 24             	add    $0x24,%esp
+  802930:	5b                   	pop    %ebx
+  802931:	f7 da                	neg    %edx
+  802933:	5e                   	pop    %esi
+  802934:	5f                   	pop    %edi
+  802935:	5d                   	pop    %ebp
+  802936:	c3                   	ret
+  802937:	f7 d8                	neg    %eax
+  802939:	83 d2 00             	adc    $0x0,%edx
+  80293c:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802940:	f7 da                	neg    %edx
+  802942:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802946:	85 f6                	test   %esi,%esi
+  802948:	78 1b                	js     802965 <__divdi3+0x135>
+  80294a:	89 f1                	mov    %esi,%ecx
+  80294c:	31 c0                	xor    %eax,%eax
+  80294e:	31 d2                	xor    %edx,%edx
+  802950:	bf 01 00 00 00       	mov    $0x1,%edi
+  802955:	09 d9                	or     %ebx,%ecx
+  802957:	0f 85 36 ff ff ff    	jne    802893 <__divdi3+0x63>
+  80295d:	83 c4 24             	add    $0x24,%esp
+  802960:	5b                   	pop    %ebx
+  802961:	5e                   	pop    %esi
+  802962:	5f                   	pop    %edi
+  802963:	5d                   	pop    %ebp
+  802964:	c3                   	ret
+  802965:	31 ff                	xor    %edi,%edi
+  802967:	e9 1a ff ff ff       	jmp    802886 <__divdi3+0x56>
+  80296c:	31 ff                	xor    %edi,%edi
+  80296e:	e9 20 ff ff ff       	jmp    802893 <__divdi3+0x63>
+  802973:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80297a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00802980 <__moddi3>:
+  802980:	55                   	push   %ebp
+  802981:	57                   	push   %edi
+  802982:	56                   	push   %esi
+  802983:	53                   	push   %ebx
+  802984:	83 ec 1c             	sub    $0x1c,%esp
+  802987:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  80298b:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  80298f:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  802993:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  802997:	89 c8                	mov    %ecx,%eax
+  802999:	89 f2                	mov    %esi,%edx
+  80299b:	89 f3                	mov    %esi,%ebx
+  80299d:	85 ed                	test   %ebp,%ebp
+  80299f:	0f 88 9d 00 00 00    	js     802a42 <__moddi3+0xc2>
+  8029a5:	09 cb                	or     %ecx,%ebx
+  8029a7:	0f 84 8d 00 00 00    	je     802a3a <__moddi3+0xba>
+  8029ad:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  8029b1:	31 db                	xor    %ebx,%ebx
+  8029b3:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  8029b7:	89 ca                	mov    %ecx,%edx
+  8029b9:	89 f0                	mov    %esi,%eax
+  8029bb:	89 dd                	mov    %ebx,%ebp
+  8029bd:	f7 da                	neg    %edx
+  8029bf:	83 d0 00             	adc    $0x0,%eax
+  8029c2:	f7 d8                	neg    %eax
+  8029c4:	0f 49 f0             	cmovns %eax,%esi
+  8029c7:	0f 49 ca             	cmovns %edx,%ecx
+  8029ca:	31 c0                	xor    %eax,%eax
+  8029cc:	31 d2                	xor    %edx,%edx
+  8029ce:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8029d2:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  8029d6:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8029db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  8029df:	90                   	nop
+  8029e0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8029e4:	01 c0                	add    %eax,%eax
+  8029e6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8029ed:	00 
+  8029ee:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  8029f2:	89 c6                	mov    %eax,%esi
+  8029f4:	89 d7                	mov    %edx,%edi
+  8029f6:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8029fa:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8029fe:	0f ad d0             	shrd   %cl,%edx,%eax
+  802a01:	d3 ea                	shr    %cl,%edx
+  802a03:	f6 c1 20             	test   $0x20,%cl
+  802a06:	0f 45 c2             	cmovne %edx,%eax
+  802a09:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802a0d:	83 e0 01             	and    $0x1,%eax
+  802a10:	09 fa                	or     %edi,%edx
+  802a12:	89 04 24             	mov    %eax,(%esp)
+  802a15:	8b 04 24             	mov    (%esp),%eax
+  802a18:	89 d7                	mov    %edx,%edi
+  802a1a:	09 f0                	or     %esi,%eax
+  802a1c:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  802a20:	39 d8                	cmp    %ebx,%eax
+  802a22:	19 f7                	sbb    %esi,%edi
+  802a24:	72 04                	jb     802a2a <__moddi3+0xaa>
+  802a26:	29 d8                	sub    %ebx,%eax
+  802a28:	19 f2                	sbb    %esi,%edx
+  802a2a:	83 e9 01             	sub    $0x1,%ecx
+  802a2d:	73 b1                	jae    8029e0 <__moddi3+0x60>
+  802a2f:	85 ed                	test   %ebp,%ebp
+  802a31:	74 07                	je     802a3a <__moddi3+0xba>
+  802a33:	f7 d8                	neg    %eax
+  802a35:	83 d2 00             	adc    $0x0,%edx
+  802a38:	f7 da                	neg    %edx
+  802a3a:	83 c4 1c             	add    $0x1c,%esp
+  802a3d:	5b                   	pop    %ebx
+  802a3e:	5e                   	pop    %esi
+  802a3f:	5f                   	pop    %edi
+  802a40:	5d                   	pop    %ebp
+  802a41:	c3                   	ret
+  802a42:	09 cb                	or     %ecx,%ebx
+  802a44:	74 f4                	je     802a3a <__moddi3+0xba>
+  802a46:	f7 df                	neg    %edi
+  802a48:	bb 01 00 00 00       	mov    $0x1,%ebx
+  802a4d:	83 d5 00             	adc    $0x0,%ebp
+  802a50:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802a54:	f7 dd                	neg    %ebp
+  802a56:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802a5a:	e9 58 ff ff ff       	jmp    8029b7 <__moddi3+0x37>
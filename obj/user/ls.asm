@@ -0,0 +1,5946 @@
+
+obj/user/ls.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 9b 02 00 00       	call   8002cc <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <ls1>:
+		panic("error reading directory %s: %e", path, n);
+}
+
+void
+ls1(const char *prefix, bool isdir, off_t size, const char *name)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80003b:	8b 75 0c             	mov    0xc(%ebp),%esi
+	const char *sep;
+
+	if(flag['l'])
+  80003e:	83 3d d0 41 80 00 00 	cmpl   $0x0,0x8041d0
+  800045:	74 20                	je     800067 <ls1+0x34>
+		printf("%11d %c ", size, isdir ? 'd' : '-');
+  800047:	89 f0                	mov    %esi,%eax
+  800049:	3c 01                	cmp    $0x1,%al
+  80004b:	19 c0                	sbb    %eax,%eax
+  80004d:	83 e0 c9             	and    $0xffffffc9,%eax
+  800050:	83 c0 64             	add    $0x64,%eax
+  800053:	83 ec 04             	sub    $0x4,%esp
+  800056:	50                   	push   %eax
+  800057:	ff 75 10             	push   0x10(%ebp)
+  80005a:	68 e2 29 80 00       	push   $0x8029e2
+  80005f:	e8 56 1a 00 00       	call   801aba <printf>
+  800064:	83 c4 10             	add    $0x10,%esp
+	if(prefix) {
+  800067:	85 db                	test   %ebx,%ebx
+  800069:	74 1c                	je     800087 <ls1+0x54>
+		if (prefix[0] && prefix[strlen(prefix)-1] != '/')
+			sep = "/";
+		else
+			sep = "";
+  80006b:	b8 48 2a 80 00       	mov    $0x802a48,%eax
+		if (prefix[0] && prefix[strlen(prefix)-1] != '/')
+  800070:	80 3b 00             	cmpb   $0x0,(%ebx)
+  800073:	75 4b                	jne    8000c0 <ls1+0x8d>
+		printf("%s%s", prefix, sep);
+  800075:	83 ec 04             	sub    $0x4,%esp
+  800078:	50                   	push   %eax
+  800079:	53                   	push   %ebx
+  80007a:	68 eb 29 80 00       	push   $0x8029eb
+  80007f:	e8 36 1a 00 00       	call   801aba <printf>
+  800084:	83 c4 10             	add    $0x10,%esp
+	}
+	printf("%s", name);
+  800087:	83 ec 08             	sub    $0x8,%esp
+  80008a:	ff 75 14             	push   0x14(%ebp)
+  80008d:	68 79 2e 80 00       	push   $0x802e79
+  800092:	e8 23 1a 00 00       	call   801aba <printf>
+	if(flag['F'] && isdir)
+  800097:	83 c4 10             	add    $0x10,%esp
+  80009a:	83 3d 38 41 80 00 00 	cmpl   $0x0,0x804138
+  8000a1:	74 06                	je     8000a9 <ls1+0x76>
+  8000a3:	89 f0                	mov    %esi,%eax
+  8000a5:	84 c0                	test   %al,%al
+  8000a7:	75 37                	jne    8000e0 <ls1+0xad>
+		printf("/");
+	printf("\n");
+  8000a9:	83 ec 0c             	sub    $0xc,%esp
+  8000ac:	68 47 2a 80 00       	push   $0x802a47
+  8000b1:	e8 04 1a 00 00       	call   801aba <printf>
+}
+  8000b6:	83 c4 10             	add    $0x10,%esp
+  8000b9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000bc:	5b                   	pop    %ebx
+  8000bd:	5e                   	pop    %esi
+  8000be:	5d                   	pop    %ebp
+  8000bf:	c3                   	ret
+		if (prefix[0] && prefix[strlen(prefix)-1] != '/')
+  8000c0:	83 ec 0c             	sub    $0xc,%esp
+  8000c3:	53                   	push   %ebx
+  8000c4:	e8 bf 08 00 00       	call   800988 <strlen>
+  8000c9:	83 c4 10             	add    $0x10,%esp
+			sep = "/";
+  8000cc:	80 7c 03 ff 2f       	cmpb   $0x2f,-0x1(%ebx,%eax,1)
+  8000d1:	b8 48 2a 80 00       	mov    $0x802a48,%eax
+  8000d6:	ba e0 29 80 00       	mov    $0x8029e0,%edx
+  8000db:	0f 45 c2             	cmovne %edx,%eax
+  8000de:	eb 95                	jmp    800075 <ls1+0x42>
+		printf("/");
+  8000e0:	83 ec 0c             	sub    $0xc,%esp
+  8000e3:	68 e0 29 80 00       	push   $0x8029e0
+  8000e8:	e8 cd 19 00 00       	call   801aba <printf>
+  8000ed:	83 c4 10             	add    $0x10,%esp
+  8000f0:	eb b7                	jmp    8000a9 <ls1+0x76>
+
+008000f2 <lsdir>:
+{
+  8000f2:	55                   	push   %ebp
+  8000f3:	89 e5                	mov    %esp,%ebp
+  8000f5:	57                   	push   %edi
+  8000f6:	56                   	push   %esi
+  8000f7:	53                   	push   %ebx
+  8000f8:	81 ec 14 01 00 00    	sub    $0x114,%esp
+  8000fe:	8b 7d 08             	mov    0x8(%ebp),%edi
+	if ((fd = open(path, O_RDONLY)) < 0)
+  800101:	6a 00                	push   $0x0
+  800103:	57                   	push   %edi
+  800104:	e8 0e 18 00 00       	call   801917 <open>
+  800109:	89 c3                	mov    %eax,%ebx
+  80010b:	83 c4 10             	add    $0x10,%esp
+  80010e:	85 c0                	test   %eax,%eax
+  800110:	78 50                	js     800162 <lsdir+0x70>
+	while ((n = readn(fd, &f, sizeof f)) == sizeof f)
+  800112:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  800118:	83 ec 04             	sub    $0x4,%esp
+  80011b:	68 00 01 00 00       	push   $0x100
+  800120:	56                   	push   %esi
+  800121:	53                   	push   %ebx
+  800122:	e8 14 14 00 00       	call   80153b <readn>
+  800127:	83 c4 10             	add    $0x10,%esp
+  80012a:	3d 00 01 00 00       	cmp    $0x100,%eax
+  80012f:	75 47                	jne    800178 <lsdir+0x86>
+		if (f.f_name[0])
+  800131:	80 bd e8 fe ff ff 00 	cmpb   $0x0,-0x118(%ebp)
+  800138:	74 de                	je     800118 <lsdir+0x26>
+			ls1(prefix, f.f_type==FTYPE_DIR, f.f_size, f.f_name);
+  80013a:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  800140:	50                   	push   %eax
+  800141:	ff b5 68 ff ff ff    	push   -0x98(%ebp)
+  800147:	83 bd 6c ff ff ff 01 	cmpl   $0x1,-0x94(%ebp)
+  80014e:	0f 94 c0             	sete   %al
+  800151:	0f b6 c0             	movzbl %al,%eax
+  800154:	50                   	push   %eax
+  800155:	ff 75 0c             	push   0xc(%ebp)
+  800158:	e8 d6 fe ff ff       	call   800033 <ls1>
+  80015d:	83 c4 10             	add    $0x10,%esp
+  800160:	eb b6                	jmp    800118 <lsdir+0x26>
+		panic("open %s: %e", path, fd);
+  800162:	83 ec 0c             	sub    $0xc,%esp
+  800165:	50                   	push   %eax
+  800166:	57                   	push   %edi
+  800167:	68 f0 29 80 00       	push   $0x8029f0
+  80016c:	6a 1d                	push   $0x1d
+  80016e:	68 fc 29 80 00       	push   $0x8029fc
+  800173:	e8 b7 01 00 00       	call   80032f <_panic>
+	if (n > 0)
+  800178:	85 c0                	test   %eax,%eax
+  80017a:	7f 0a                	jg     800186 <lsdir+0x94>
+	if (n < 0)
+  80017c:	78 1a                	js     800198 <lsdir+0xa6>
+}
+  80017e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800181:	5b                   	pop    %ebx
+  800182:	5e                   	pop    %esi
+  800183:	5f                   	pop    %edi
+  800184:	5d                   	pop    %ebp
+  800185:	c3                   	ret
+		panic("short read in directory %s", path);
+  800186:	57                   	push   %edi
+  800187:	68 06 2a 80 00       	push   $0x802a06
+  80018c:	6a 22                	push   $0x22
+  80018e:	68 fc 29 80 00       	push   $0x8029fc
+  800193:	e8 97 01 00 00       	call   80032f <_panic>
+		panic("error reading directory %s: %e", path, n);
+  800198:	83 ec 0c             	sub    $0xc,%esp
+  80019b:	50                   	push   %eax
+  80019c:	57                   	push   %edi
+  80019d:	68 4c 2a 80 00       	push   $0x802a4c
+  8001a2:	6a 24                	push   $0x24
+  8001a4:	68 fc 29 80 00       	push   $0x8029fc
+  8001a9:	e8 81 01 00 00       	call   80032f <_panic>
+
+008001ae <ls>:
+{
+  8001ae:	55                   	push   %ebp
+  8001af:	89 e5                	mov    %esp,%ebp
+  8001b1:	53                   	push   %ebx
+  8001b2:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  8001b8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = stat(path, &st)) < 0)
+  8001bb:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+  8001c1:	50                   	push   %eax
+  8001c2:	53                   	push   %ebx
+  8001c3:	e8 59 15 00 00       	call   801721 <stat>
+  8001c8:	83 c4 10             	add    $0x10,%esp
+  8001cb:	85 c0                	test   %eax,%eax
+  8001cd:	78 2c                	js     8001fb <ls+0x4d>
+	if (st.st_isdir && !flag['d'])
+  8001cf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8001d2:	85 c0                	test   %eax,%eax
+  8001d4:	74 09                	je     8001df <ls+0x31>
+  8001d6:	83 3d b0 41 80 00 00 	cmpl   $0x0,0x8041b0
+  8001dd:	74 32                	je     800211 <ls+0x63>
+		ls1(0, st.st_isdir, st.st_size, path);
+  8001df:	53                   	push   %ebx
+  8001e0:	ff 75 ec             	push   -0x14(%ebp)
+  8001e3:	85 c0                	test   %eax,%eax
+  8001e5:	0f 95 c0             	setne  %al
+  8001e8:	0f b6 c0             	movzbl %al,%eax
+  8001eb:	50                   	push   %eax
+  8001ec:	6a 00                	push   $0x0
+  8001ee:	e8 40 fe ff ff       	call   800033 <ls1>
+  8001f3:	83 c4 10             	add    $0x10,%esp
+}
+  8001f6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001f9:	c9                   	leave
+  8001fa:	c3                   	ret
+		panic("stat %s: %e", path, r);
+  8001fb:	83 ec 0c             	sub    $0xc,%esp
+  8001fe:	50                   	push   %eax
+  8001ff:	53                   	push   %ebx
+  800200:	68 21 2a 80 00       	push   $0x802a21
+  800205:	6a 0f                	push   $0xf
+  800207:	68 fc 29 80 00       	push   $0x8029fc
+  80020c:	e8 1e 01 00 00       	call   80032f <_panic>
+		lsdir(path, prefix);
+  800211:	83 ec 08             	sub    $0x8,%esp
+  800214:	ff 75 0c             	push   0xc(%ebp)
+  800217:	53                   	push   %ebx
+  800218:	e8 d5 fe ff ff       	call   8000f2 <lsdir>
+  80021d:	83 c4 10             	add    $0x10,%esp
+  800220:	eb d4                	jmp    8001f6 <ls+0x48>
+
+00800222 <usage>:
+
+void
+usage(void)
+{
+  800222:	55                   	push   %ebp
+  800223:	89 e5                	mov    %esp,%ebp
+  800225:	83 ec 14             	sub    $0x14,%esp
+	printf("usage: ls [-dFl] [file...]\n");
+  800228:	68 2d 2a 80 00       	push   $0x802a2d
+  80022d:	e8 88 18 00 00       	call   801aba <printf>
+	exit();
+  800232:	e8 de 00 00 00       	call   800315 <exit>
+}
+  800237:	83 c4 10             	add    $0x10,%esp
+  80023a:	c9                   	leave
+  80023b:	c3                   	ret
+
+0080023c <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  80023c:	55                   	push   %ebp
+  80023d:	89 e5                	mov    %esp,%ebp
+  80023f:	56                   	push   %esi
+  800240:	53                   	push   %ebx
+  800241:	83 ec 14             	sub    $0x14,%esp
+  800244:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int i;
+	struct Argstate args;
+
+	argstart(&argc, argv, &args);
+  800247:	8d 45 e8             	lea    -0x18(%ebp),%eax
+  80024a:	50                   	push   %eax
+  80024b:	56                   	push   %esi
+  80024c:	8d 45 08             	lea    0x8(%ebp),%eax
+  80024f:	50                   	push   %eax
+  800250:	e8 2d 0e 00 00       	call   801082 <argstart>
+	while ((i = argnext(&args)) >= 0)
+  800255:	83 c4 10             	add    $0x10,%esp
+  800258:	8d 5d e8             	lea    -0x18(%ebp),%ebx
+  80025b:	eb 08                	jmp    800265 <umain+0x29>
+		switch (i) {
+		case 'd':
+		case 'F':
+		case 'l':
+			flag[i]++;
+  80025d:	83 04 85 20 40 80 00 	addl   $0x1,0x804020(,%eax,4)
+  800264:	01 
+	while ((i = argnext(&args)) >= 0)
+  800265:	83 ec 0c             	sub    $0xc,%esp
+  800268:	53                   	push   %ebx
+  800269:	e8 44 0e 00 00       	call   8010b2 <argnext>
+  80026e:	83 c4 10             	add    $0x10,%esp
+  800271:	85 c0                	test   %eax,%eax
+  800273:	78 16                	js     80028b <umain+0x4f>
+		switch (i) {
+  800275:	89 c2                	mov    %eax,%edx
+  800277:	83 e2 f7             	and    $0xfffffff7,%edx
+  80027a:	83 fa 64             	cmp    $0x64,%edx
+  80027d:	74 de                	je     80025d <umain+0x21>
+  80027f:	83 f8 46             	cmp    $0x46,%eax
+  800282:	74 d9                	je     80025d <umain+0x21>
+			break;
+		default:
+			usage();
+  800284:	e8 99 ff ff ff       	call   800222 <usage>
+  800289:	eb da                	jmp    800265 <umain+0x29>
+		}
+
+	if (argc == 1)
+		ls("/", "");
+	else {
+		for (i = 1; i < argc; i++)
+  80028b:	bb 01 00 00 00       	mov    $0x1,%ebx
+	if (argc == 1)
+  800290:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  800294:	75 2a                	jne    8002c0 <umain+0x84>
+		ls("/", "");
+  800296:	83 ec 08             	sub    $0x8,%esp
+  800299:	68 48 2a 80 00       	push   $0x802a48
+  80029e:	68 e0 29 80 00       	push   $0x8029e0
+  8002a3:	e8 06 ff ff ff       	call   8001ae <ls>
+  8002a8:	83 c4 10             	add    $0x10,%esp
+  8002ab:	eb 18                	jmp    8002c5 <umain+0x89>
+			ls(argv[i], argv[i]);
+  8002ad:	8b 04 9e             	mov    (%esi,%ebx,4),%eax
+  8002b0:	83 ec 08             	sub    $0x8,%esp
+  8002b3:	50                   	push   %eax
+  8002b4:	50                   	push   %eax
+  8002b5:	e8 f4 fe ff ff       	call   8001ae <ls>
+		for (i = 1; i < argc; i++)
+  8002ba:	83 c3 01             	add    $0x1,%ebx
+  8002bd:	83 c4 10             	add    $0x10,%esp
+  8002c0:	39 5d 08             	cmp    %ebx,0x8(%ebp)
+  8002c3:	7f e8                	jg     8002ad <umain+0x71>
+	}
+}
+  8002c5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8002c8:	5b                   	pop    %ebx
+  8002c9:	5e                   	pop    %esi
+  8002ca:	5d                   	pop    %ebp
+  8002cb:	c3                   	ret
+
+008002cc <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  8002cc:	55                   	push   %ebp
+  8002cd:	89 e5                	mov    %esp,%ebp
+  8002cf:	56                   	push   %esi
+  8002d0:	53                   	push   %ebx
+  8002d1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8002d4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  8002d7:	e8 95 0a 00 00       	call   800d71 <sys_getenvid>
+  8002dc:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8002e1:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8002e4:	c1 e0 04             	shl    $0x4,%eax
+  8002e7:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8002ec:	a3 20 44 80 00       	mov    %eax,0x804420
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8002f1:	85 db                	test   %ebx,%ebx
+  8002f3:	7e 07                	jle    8002fc <libmain+0x30>
+    binaryname = argv[0];
+  8002f5:	8b 06                	mov    (%esi),%eax
+  8002f7:	a3 00 30 80 00       	mov    %eax,0x803000
+
+  // call user main routine
+  umain(argc, argv);
+  8002fc:	83 ec 08             	sub    $0x8,%esp
+  8002ff:	56                   	push   %esi
+  800300:	53                   	push   %ebx
+  800301:	e8 36 ff ff ff       	call   80023c <umain>
+
+  // exit gracefully
+  exit();
+  800306:	e8 0a 00 00 00       	call   800315 <exit>
+}
+  80030b:	83 c4 10             	add    $0x10,%esp
+  80030e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800311:	5b                   	pop    %ebx
+  800312:	5e                   	pop    %esi
+  800313:	5d                   	pop    %ebp
+  800314:	c3                   	ret
+
+00800315 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800315:	55                   	push   %ebp
+  800316:	89 e5                	mov    %esp,%ebp
+  800318:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80031b:	e8 85 10 00 00       	call   8013a5 <close_all>
+	sys_env_destroy(0);
+  800320:	83 ec 0c             	sub    $0xc,%esp
+  800323:	6a 00                	push   $0x0
+  800325:	e8 06 0a 00 00       	call   800d30 <sys_env_destroy>
+}
+  80032a:	83 c4 10             	add    $0x10,%esp
+  80032d:	c9                   	leave
+  80032e:	c3                   	ret
+
+0080032f <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80032f:	55                   	push   %ebp
+  800330:	89 e5                	mov    %esp,%ebp
+  800332:	56                   	push   %esi
+  800333:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800334:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800337:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  80033d:	e8 2f 0a 00 00       	call   800d71 <sys_getenvid>
+  800342:	83 ec 0c             	sub    $0xc,%esp
+  800345:	ff 75 0c             	push   0xc(%ebp)
+  800348:	ff 75 08             	push   0x8(%ebp)
+  80034b:	56                   	push   %esi
+  80034c:	50                   	push   %eax
+  80034d:	68 78 2a 80 00       	push   $0x802a78
+  800352:	e8 b3 00 00 00       	call   80040a <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800357:	83 c4 18             	add    $0x18,%esp
+  80035a:	53                   	push   %ebx
+  80035b:	ff 75 10             	push   0x10(%ebp)
+  80035e:	e8 56 00 00 00       	call   8003b9 <vcprintf>
+	cprintf("\n");
+  800363:	c7 04 24 47 2a 80 00 	movl   $0x802a47,(%esp)
+  80036a:	e8 9b 00 00 00       	call   80040a <cprintf>
+  80036f:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800372:	cc                   	int3
+	while (1)
+  800373:	eb fd                	jmp    800372 <_panic+0x43>
+
+00800375 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800375:	55                   	push   %ebp
+  800376:	89 e5                	mov    %esp,%ebp
+  800378:	53                   	push   %ebx
+  800379:	83 ec 04             	sub    $0x4,%esp
+  80037c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80037f:	8b 13                	mov    (%ebx),%edx
+  800381:	8d 42 01             	lea    0x1(%edx),%eax
+  800384:	89 03                	mov    %eax,(%ebx)
+  800386:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800389:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80038d:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800392:	74 09                	je     80039d <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800394:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800398:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80039b:	c9                   	leave
+  80039c:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80039d:	83 ec 08             	sub    $0x8,%esp
+  8003a0:	68 ff 00 00 00       	push   $0xff
+  8003a5:	8d 43 08             	lea    0x8(%ebx),%eax
+  8003a8:	50                   	push   %eax
+  8003a9:	e8 45 09 00 00       	call   800cf3 <sys_cputs>
+		b->idx = 0;
+  8003ae:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8003b4:	83 c4 10             	add    $0x10,%esp
+  8003b7:	eb db                	jmp    800394 <putch+0x1f>
+
+008003b9 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8003b9:	55                   	push   %ebp
+  8003ba:	89 e5                	mov    %esp,%ebp
+  8003bc:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8003c2:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8003c9:	00 00 00 
+	b.cnt = 0;
+  8003cc:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8003d3:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8003d6:	ff 75 0c             	push   0xc(%ebp)
+  8003d9:	ff 75 08             	push   0x8(%ebp)
+  8003dc:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8003e2:	50                   	push   %eax
+  8003e3:	68 75 03 80 00       	push   $0x800375
+  8003e8:	e8 14 01 00 00       	call   800501 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8003ed:	83 c4 08             	add    $0x8,%esp
+  8003f0:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8003f6:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8003fc:	50                   	push   %eax
+  8003fd:	e8 f1 08 00 00       	call   800cf3 <sys_cputs>
+
+	return b.cnt;
+}
+  800402:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800408:	c9                   	leave
+  800409:	c3                   	ret
+
+0080040a <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80040a:	55                   	push   %ebp
+  80040b:	89 e5                	mov    %esp,%ebp
+  80040d:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800410:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800413:	50                   	push   %eax
+  800414:	ff 75 08             	push   0x8(%ebp)
+  800417:	e8 9d ff ff ff       	call   8003b9 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80041c:	c9                   	leave
+  80041d:	c3                   	ret
+
+0080041e <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80041e:	55                   	push   %ebp
+  80041f:	89 e5                	mov    %esp,%ebp
+  800421:	57                   	push   %edi
+  800422:	56                   	push   %esi
+  800423:	53                   	push   %ebx
+  800424:	83 ec 1c             	sub    $0x1c,%esp
+  800427:	89 c7                	mov    %eax,%edi
+  800429:	89 d6                	mov    %edx,%esi
+  80042b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80042e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800431:	89 d1                	mov    %edx,%ecx
+  800433:	89 c2                	mov    %eax,%edx
+  800435:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800438:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80043b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80043e:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800441:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800444:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80044b:	39 c2                	cmp    %eax,%edx
+  80044d:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800450:	72 3e                	jb     800490 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800452:	83 ec 0c             	sub    $0xc,%esp
+  800455:	ff 75 18             	push   0x18(%ebp)
+  800458:	83 eb 01             	sub    $0x1,%ebx
+  80045b:	53                   	push   %ebx
+  80045c:	50                   	push   %eax
+  80045d:	83 ec 08             	sub    $0x8,%esp
+  800460:	ff 75 e4             	push   -0x1c(%ebp)
+  800463:	ff 75 e0             	push   -0x20(%ebp)
+  800466:	ff 75 dc             	push   -0x24(%ebp)
+  800469:	ff 75 d8             	push   -0x28(%ebp)
+  80046c:	e8 df 21 00 00       	call   802650 <__udivdi3>
+  800471:	83 c4 18             	add    $0x18,%esp
+  800474:	52                   	push   %edx
+  800475:	50                   	push   %eax
+  800476:	89 f2                	mov    %esi,%edx
+  800478:	89 f8                	mov    %edi,%eax
+  80047a:	e8 9f ff ff ff       	call   80041e <printnum>
+  80047f:	83 c4 20             	add    $0x20,%esp
+  800482:	eb 13                	jmp    800497 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800484:	83 ec 08             	sub    $0x8,%esp
+  800487:	56                   	push   %esi
+  800488:	ff 75 18             	push   0x18(%ebp)
+  80048b:	ff d7                	call   *%edi
+  80048d:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800490:	83 eb 01             	sub    $0x1,%ebx
+  800493:	85 db                	test   %ebx,%ebx
+  800495:	7f ed                	jg     800484 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800497:	83 ec 08             	sub    $0x8,%esp
+  80049a:	56                   	push   %esi
+  80049b:	83 ec 04             	sub    $0x4,%esp
+  80049e:	ff 75 e4             	push   -0x1c(%ebp)
+  8004a1:	ff 75 e0             	push   -0x20(%ebp)
+  8004a4:	ff 75 dc             	push   -0x24(%ebp)
+  8004a7:	ff 75 d8             	push   -0x28(%ebp)
+  8004aa:	e8 71 22 00 00       	call   802720 <__umoddi3>
+  8004af:	83 c4 14             	add    $0x14,%esp
+  8004b2:	0f be 80 9b 2a 80 00 	movsbl 0x802a9b(%eax),%eax
+  8004b9:	50                   	push   %eax
+  8004ba:	ff d7                	call   *%edi
+}
+  8004bc:	83 c4 10             	add    $0x10,%esp
+  8004bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004c2:	5b                   	pop    %ebx
+  8004c3:	5e                   	pop    %esi
+  8004c4:	5f                   	pop    %edi
+  8004c5:	5d                   	pop    %ebp
+  8004c6:	c3                   	ret
+
+008004c7 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8004c7:	55                   	push   %ebp
+  8004c8:	89 e5                	mov    %esp,%ebp
+  8004ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8004cd:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8004d1:	8b 10                	mov    (%eax),%edx
+  8004d3:	3b 50 04             	cmp    0x4(%eax),%edx
+  8004d6:	73 0a                	jae    8004e2 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8004d8:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8004db:	89 08                	mov    %ecx,(%eax)
+  8004dd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8004e0:	88 02                	mov    %al,(%edx)
+}
+  8004e2:	5d                   	pop    %ebp
+  8004e3:	c3                   	ret
+
+008004e4 <printfmt>:
+{
+  8004e4:	55                   	push   %ebp
+  8004e5:	89 e5                	mov    %esp,%ebp
+  8004e7:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8004ea:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8004ed:	50                   	push   %eax
+  8004ee:	ff 75 10             	push   0x10(%ebp)
+  8004f1:	ff 75 0c             	push   0xc(%ebp)
+  8004f4:	ff 75 08             	push   0x8(%ebp)
+  8004f7:	e8 05 00 00 00       	call   800501 <vprintfmt>
+}
+  8004fc:	83 c4 10             	add    $0x10,%esp
+  8004ff:	c9                   	leave
+  800500:	c3                   	ret
+
+00800501 <vprintfmt>:
+{
+  800501:	55                   	push   %ebp
+  800502:	89 e5                	mov    %esp,%ebp
+  800504:	57                   	push   %edi
+  800505:	56                   	push   %esi
+  800506:	53                   	push   %ebx
+  800507:	83 ec 2c             	sub    $0x2c,%esp
+  80050a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80050d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800510:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800513:	eb 0a                	jmp    80051f <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800515:	83 ec 08             	sub    $0x8,%esp
+  800518:	53                   	push   %ebx
+  800519:	50                   	push   %eax
+  80051a:	ff d6                	call   *%esi
+  80051c:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80051f:	83 c7 01             	add    $0x1,%edi
+  800522:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800526:	83 f8 25             	cmp    $0x25,%eax
+  800529:	74 0c                	je     800537 <vprintfmt+0x36>
+			if (ch == '\0')
+  80052b:	85 c0                	test   %eax,%eax
+  80052d:	75 e6                	jne    800515 <vprintfmt+0x14>
+}
+  80052f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800532:	5b                   	pop    %ebx
+  800533:	5e                   	pop    %esi
+  800534:	5f                   	pop    %edi
+  800535:	5d                   	pop    %ebp
+  800536:	c3                   	ret
+		padc = ' ';
+  800537:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80053b:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800542:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800549:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800550:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800555:	8d 47 01             	lea    0x1(%edi),%eax
+  800558:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80055b:	0f b6 17             	movzbl (%edi),%edx
+  80055e:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800561:	3c 55                	cmp    $0x55,%al
+  800563:	0f 87 9a 03 00 00    	ja     800903 <vprintfmt+0x402>
+  800569:	0f b6 c0             	movzbl %al,%eax
+  80056c:	ff 24 85 e0 2b 80 00 	jmp    *0x802be0(,%eax,4)
+  800573:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800576:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80057a:	eb d9                	jmp    800555 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80057c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80057f:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800583:	eb d0                	jmp    800555 <vprintfmt+0x54>
+  800585:	0f b6 d2             	movzbl %dl,%edx
+  800588:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80058b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800590:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800593:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800596:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80059a:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80059d:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8005a0:	83 f9 09             	cmp    $0x9,%ecx
+  8005a3:	77 55                	ja     8005fa <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8005a5:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8005a8:	eb e9                	jmp    800593 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8005aa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ad:	8b 00                	mov    (%eax),%eax
+  8005af:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8005b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b5:	8d 40 04             	lea    0x4(%eax),%eax
+  8005b8:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8005bb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8005be:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005c2:	79 91                	jns    800555 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8005c4:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8005c7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005ca:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8005d1:	eb 82                	jmp    800555 <vprintfmt+0x54>
+			if (width < 0)
+  8005d3:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8005d6:	85 d2                	test   %edx,%edx
+  8005d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005dd:	0f 49 c2             	cmovns %edx,%eax
+  8005e0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8005e3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8005e6:	e9 6a ff ff ff       	jmp    800555 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8005eb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8005ee:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8005f5:	e9 5b ff ff ff       	jmp    800555 <vprintfmt+0x54>
+  8005fa:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8005fd:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800600:	eb bc                	jmp    8005be <vprintfmt+0xbd>
+			lflag++;
+  800602:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800605:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800608:	e9 48 ff ff ff       	jmp    800555 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80060d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800610:	8d 78 04             	lea    0x4(%eax),%edi
+  800613:	83 ec 08             	sub    $0x8,%esp
+  800616:	53                   	push   %ebx
+  800617:	ff 30                	push   (%eax)
+  800619:	ff d6                	call   *%esi
+			break;
+  80061b:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80061e:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800621:	e9 7c 02 00 00       	jmp    8008a2 <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  800626:	8b 45 14             	mov    0x14(%ebp),%eax
+  800629:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80062c:	8b 10                	mov    (%eax),%edx
+  80062e:	89 d0                	mov    %edx,%eax
+  800630:	f7 d8                	neg    %eax
+  800632:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800635:	83 f8 10             	cmp    $0x10,%eax
+  800638:	7f 23                	jg     80065d <vprintfmt+0x15c>
+  80063a:	8b 14 85 40 2d 80 00 	mov    0x802d40(,%eax,4),%edx
+  800641:	85 d2                	test   %edx,%edx
+  800643:	74 18                	je     80065d <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800645:	52                   	push   %edx
+  800646:	68 79 2e 80 00       	push   $0x802e79
+  80064b:	53                   	push   %ebx
+  80064c:	56                   	push   %esi
+  80064d:	e8 92 fe ff ff       	call   8004e4 <printfmt>
+  800652:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800655:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800658:	e9 45 02 00 00       	jmp    8008a2 <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  80065d:	50                   	push   %eax
+  80065e:	68 b3 2a 80 00       	push   $0x802ab3
+  800663:	53                   	push   %ebx
+  800664:	56                   	push   %esi
+  800665:	e8 7a fe ff ff       	call   8004e4 <printfmt>
+  80066a:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80066d:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800670:	e9 2d 02 00 00       	jmp    8008a2 <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800675:	8b 45 14             	mov    0x14(%ebp),%eax
+  800678:	83 c0 04             	add    $0x4,%eax
+  80067b:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80067e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800681:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800683:	85 c9                	test   %ecx,%ecx
+  800685:	b8 ac 2a 80 00       	mov    $0x802aac,%eax
+  80068a:	0f 45 c1             	cmovne %ecx,%eax
+  80068d:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800690:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800694:	7e 06                	jle    80069c <vprintfmt+0x19b>
+  800696:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80069a:	75 0b                	jne    8006a7 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80069c:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80069f:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8006a2:	89 75 08             	mov    %esi,0x8(%ebp)
+  8006a5:	eb 5c                	jmp    800703 <vprintfmt+0x202>
+  8006a7:	83 ec 08             	sub    $0x8,%esp
+  8006aa:	ff 75 d0             	push   -0x30(%ebp)
+  8006ad:	ff 75 cc             	push   -0x34(%ebp)
+  8006b0:	e8 eb 02 00 00       	call   8009a0 <strnlen>
+  8006b5:	89 c2                	mov    %eax,%edx
+  8006b7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006ba:	29 d0                	sub    %edx,%eax
+  8006bc:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8006bf:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8006c3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006c6:	89 75 08             	mov    %esi,0x8(%ebp)
+  8006c9:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8006cb:	eb 0e                	jmp    8006db <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8006cd:	83 ec 08             	sub    $0x8,%esp
+  8006d0:	53                   	push   %ebx
+  8006d1:	57                   	push   %edi
+  8006d2:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8006d5:	83 ee 01             	sub    $0x1,%esi
+  8006d8:	83 c4 10             	add    $0x10,%esp
+  8006db:	85 f6                	test   %esi,%esi
+  8006dd:	7f ee                	jg     8006cd <vprintfmt+0x1cc>
+  8006df:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006e2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006e5:	85 c0                	test   %eax,%eax
+  8006e7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006ec:	0f 49 d0             	cmovns %eax,%edx
+  8006ef:	29 d0                	sub    %edx,%eax
+  8006f1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006f4:	eb a6                	jmp    80069c <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8006f6:	83 ec 08             	sub    $0x8,%esp
+  8006f9:	53                   	push   %ebx
+  8006fa:	52                   	push   %edx
+  8006fb:	ff 55 08             	call   *0x8(%ebp)
+  8006fe:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800701:	89 f1                	mov    %esi,%ecx
+  800703:	8d 71 01             	lea    0x1(%ecx),%esi
+  800706:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80070a:	0f be d0             	movsbl %al,%edx
+  80070d:	85 d2                	test   %edx,%edx
+  80070f:	74 28                	je     800739 <vprintfmt+0x238>
+  800711:	85 ff                	test   %edi,%edi
+  800713:	78 05                	js     80071a <vprintfmt+0x219>
+  800715:	83 ef 01             	sub    $0x1,%edi
+  800718:	78 30                	js     80074a <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80071a:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80071e:	74 d6                	je     8006f6 <vprintfmt+0x1f5>
+  800720:	0f be c0             	movsbl %al,%eax
+  800723:	83 e8 20             	sub    $0x20,%eax
+  800726:	83 f8 5e             	cmp    $0x5e,%eax
+  800729:	76 cb                	jbe    8006f6 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80072b:	83 ec 08             	sub    $0x8,%esp
+  80072e:	53                   	push   %ebx
+  80072f:	6a 3f                	push   $0x3f
+  800731:	ff 55 08             	call   *0x8(%ebp)
+  800734:	83 c4 10             	add    $0x10,%esp
+  800737:	eb c8                	jmp    800701 <vprintfmt+0x200>
+  800739:	8b 75 08             	mov    0x8(%ebp),%esi
+  80073c:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80073f:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800742:	01 d0                	add    %edx,%eax
+  800744:	29 c8                	sub    %ecx,%eax
+  800746:	89 c7                	mov    %eax,%edi
+  800748:	eb 13                	jmp    80075d <vprintfmt+0x25c>
+  80074a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80074d:	eb ed                	jmp    80073c <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80074f:	83 ec 08             	sub    $0x8,%esp
+  800752:	53                   	push   %ebx
+  800753:	6a 20                	push   $0x20
+  800755:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800757:	83 ef 01             	sub    $0x1,%edi
+  80075a:	83 c4 10             	add    $0x10,%esp
+  80075d:	85 ff                	test   %edi,%edi
+  80075f:	7f ee                	jg     80074f <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800761:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800764:	89 45 14             	mov    %eax,0x14(%ebp)
+  800767:	e9 36 01 00 00       	jmp    8008a2 <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  80076c:	83 f9 01             	cmp    $0x1,%ecx
+  80076f:	7f 1f                	jg     800790 <vprintfmt+0x28f>
+	else if (lflag)
+  800771:	85 c9                	test   %ecx,%ecx
+  800773:	74 67                	je     8007dc <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800775:	8b 45 14             	mov    0x14(%ebp),%eax
+  800778:	8b 00                	mov    (%eax),%eax
+  80077a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80077d:	89 c1                	mov    %eax,%ecx
+  80077f:	c1 f9 1f             	sar    $0x1f,%ecx
+  800782:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800785:	8b 45 14             	mov    0x14(%ebp),%eax
+  800788:	8d 40 04             	lea    0x4(%eax),%eax
+  80078b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80078e:	eb 17                	jmp    8007a7 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800790:	8b 45 14             	mov    0x14(%ebp),%eax
+  800793:	8b 50 04             	mov    0x4(%eax),%edx
+  800796:	8b 00                	mov    (%eax),%eax
+  800798:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80079b:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80079e:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a1:	8d 40 08             	lea    0x8(%eax),%eax
+  8007a4:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8007a7:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007aa:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8007ad:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8007b2:	85 c9                	test   %ecx,%ecx
+  8007b4:	0f 89 ce 00 00 00    	jns    800888 <vprintfmt+0x387>
+				putch('-', putdat);
+  8007ba:	83 ec 08             	sub    $0x8,%esp
+  8007bd:	53                   	push   %ebx
+  8007be:	6a 2d                	push   $0x2d
+  8007c0:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8007c2:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007c5:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8007c8:	f7 da                	neg    %edx
+  8007ca:	83 d1 00             	adc    $0x0,%ecx
+  8007cd:	f7 d9                	neg    %ecx
+  8007cf:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8007d2:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8007d7:	e9 ac 00 00 00       	jmp    800888 <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  8007dc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007df:	8b 00                	mov    (%eax),%eax
+  8007e1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007e4:	89 c1                	mov    %eax,%ecx
+  8007e6:	c1 f9 1f             	sar    $0x1f,%ecx
+  8007e9:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8007ec:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ef:	8d 40 04             	lea    0x4(%eax),%eax
+  8007f2:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007f5:	eb b0                	jmp    8007a7 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8007f7:	83 f9 01             	cmp    $0x1,%ecx
+  8007fa:	7f 1b                	jg     800817 <vprintfmt+0x316>
+	else if (lflag)
+  8007fc:	85 c9                	test   %ecx,%ecx
+  8007fe:	74 2c                	je     80082c <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  800800:	8b 45 14             	mov    0x14(%ebp),%eax
+  800803:	8b 10                	mov    (%eax),%edx
+  800805:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80080a:	8d 40 04             	lea    0x4(%eax),%eax
+  80080d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800810:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800815:	eb 71                	jmp    800888 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  800817:	8b 45 14             	mov    0x14(%ebp),%eax
+  80081a:	8b 10                	mov    (%eax),%edx
+  80081c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80081f:	8d 40 08             	lea    0x8(%eax),%eax
+  800822:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800825:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80082a:	eb 5c                	jmp    800888 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  80082c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80082f:	8b 10                	mov    (%eax),%edx
+  800831:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800836:	8d 40 04             	lea    0x4(%eax),%eax
+  800839:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80083c:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800841:	eb 45                	jmp    800888 <vprintfmt+0x387>
+			putch('X', putdat);
+  800843:	83 ec 08             	sub    $0x8,%esp
+  800846:	53                   	push   %ebx
+  800847:	6a 58                	push   $0x58
+  800849:	ff d6                	call   *%esi
+			putch('X', putdat);
+  80084b:	83 c4 08             	add    $0x8,%esp
+  80084e:	53                   	push   %ebx
+  80084f:	6a 58                	push   $0x58
+  800851:	ff d6                	call   *%esi
+			putch('X', putdat);
+  800853:	83 c4 08             	add    $0x8,%esp
+  800856:	53                   	push   %ebx
+  800857:	6a 58                	push   $0x58
+  800859:	ff d6                	call   *%esi
+			break;
+  80085b:	83 c4 10             	add    $0x10,%esp
+  80085e:	eb 42                	jmp    8008a2 <vprintfmt+0x3a1>
+			putch('0', putdat);
+  800860:	83 ec 08             	sub    $0x8,%esp
+  800863:	53                   	push   %ebx
+  800864:	6a 30                	push   $0x30
+  800866:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800868:	83 c4 08             	add    $0x8,%esp
+  80086b:	53                   	push   %ebx
+  80086c:	6a 78                	push   $0x78
+  80086e:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800870:	8b 45 14             	mov    0x14(%ebp),%eax
+  800873:	8b 10                	mov    (%eax),%edx
+  800875:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80087a:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80087d:	8d 40 04             	lea    0x4(%eax),%eax
+  800880:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800883:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800888:	83 ec 0c             	sub    $0xc,%esp
+  80088b:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80088f:	50                   	push   %eax
+  800890:	ff 75 e0             	push   -0x20(%ebp)
+  800893:	57                   	push   %edi
+  800894:	51                   	push   %ecx
+  800895:	52                   	push   %edx
+  800896:	89 da                	mov    %ebx,%edx
+  800898:	89 f0                	mov    %esi,%eax
+  80089a:	e8 7f fb ff ff       	call   80041e <printnum>
+			break;
+  80089f:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8008a2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8008a5:	e9 75 fc ff ff       	jmp    80051f <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8008aa:	83 f9 01             	cmp    $0x1,%ecx
+  8008ad:	7f 1b                	jg     8008ca <vprintfmt+0x3c9>
+	else if (lflag)
+  8008af:	85 c9                	test   %ecx,%ecx
+  8008b1:	74 2c                	je     8008df <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  8008b3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008b6:	8b 10                	mov    (%eax),%edx
+  8008b8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008bd:	8d 40 04             	lea    0x4(%eax),%eax
+  8008c0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008c3:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8008c8:	eb be                	jmp    800888 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  8008ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008cd:	8b 10                	mov    (%eax),%edx
+  8008cf:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008d2:	8d 40 08             	lea    0x8(%eax),%eax
+  8008d5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008d8:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8008dd:	eb a9                	jmp    800888 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  8008df:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008e2:	8b 10                	mov    (%eax),%edx
+  8008e4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008e9:	8d 40 04             	lea    0x4(%eax),%eax
+  8008ec:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008ef:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8008f4:	eb 92                	jmp    800888 <vprintfmt+0x387>
+			putch(ch, putdat);
+  8008f6:	83 ec 08             	sub    $0x8,%esp
+  8008f9:	53                   	push   %ebx
+  8008fa:	6a 25                	push   $0x25
+  8008fc:	ff d6                	call   *%esi
+			break;
+  8008fe:	83 c4 10             	add    $0x10,%esp
+  800901:	eb 9f                	jmp    8008a2 <vprintfmt+0x3a1>
+			putch('%', putdat);
+  800903:	83 ec 08             	sub    $0x8,%esp
+  800906:	53                   	push   %ebx
+  800907:	6a 25                	push   $0x25
+  800909:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80090b:	83 c4 10             	add    $0x10,%esp
+  80090e:	89 f8                	mov    %edi,%eax
+  800910:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800914:	74 05                	je     80091b <vprintfmt+0x41a>
+  800916:	83 e8 01             	sub    $0x1,%eax
+  800919:	eb f5                	jmp    800910 <vprintfmt+0x40f>
+  80091b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80091e:	eb 82                	jmp    8008a2 <vprintfmt+0x3a1>
+
+00800920 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800920:	55                   	push   %ebp
+  800921:	89 e5                	mov    %esp,%ebp
+  800923:	83 ec 18             	sub    $0x18,%esp
+  800926:	8b 45 08             	mov    0x8(%ebp),%eax
+  800929:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80092c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80092f:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800933:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800936:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80093d:	85 c0                	test   %eax,%eax
+  80093f:	74 26                	je     800967 <vsnprintf+0x47>
+  800941:	85 d2                	test   %edx,%edx
+  800943:	7e 22                	jle    800967 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800945:	ff 75 14             	push   0x14(%ebp)
+  800948:	ff 75 10             	push   0x10(%ebp)
+  80094b:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80094e:	50                   	push   %eax
+  80094f:	68 c7 04 80 00       	push   $0x8004c7
+  800954:	e8 a8 fb ff ff       	call   800501 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800959:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80095c:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80095f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800962:	83 c4 10             	add    $0x10,%esp
+}
+  800965:	c9                   	leave
+  800966:	c3                   	ret
+		return -E_INVAL;
+  800967:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80096c:	eb f7                	jmp    800965 <vsnprintf+0x45>
+
+0080096e <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80096e:	55                   	push   %ebp
+  80096f:	89 e5                	mov    %esp,%ebp
+  800971:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800974:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800977:	50                   	push   %eax
+  800978:	ff 75 10             	push   0x10(%ebp)
+  80097b:	ff 75 0c             	push   0xc(%ebp)
+  80097e:	ff 75 08             	push   0x8(%ebp)
+  800981:	e8 9a ff ff ff       	call   800920 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800986:	c9                   	leave
+  800987:	c3                   	ret
+
+00800988 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800988:	55                   	push   %ebp
+  800989:	89 e5                	mov    %esp,%ebp
+  80098b:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80098e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800993:	eb 03                	jmp    800998 <strlen+0x10>
+		n++;
+  800995:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800998:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80099c:	75 f7                	jne    800995 <strlen+0xd>
+	return n;
+}
+  80099e:	5d                   	pop    %ebp
+  80099f:	c3                   	ret
+
+008009a0 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8009a0:	55                   	push   %ebp
+  8009a1:	89 e5                	mov    %esp,%ebp
+  8009a3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009a6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009ae:	eb 03                	jmp    8009b3 <strnlen+0x13>
+		n++;
+  8009b0:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009b3:	39 d0                	cmp    %edx,%eax
+  8009b5:	74 08                	je     8009bf <strnlen+0x1f>
+  8009b7:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8009bb:	75 f3                	jne    8009b0 <strnlen+0x10>
+  8009bd:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8009bf:	89 d0                	mov    %edx,%eax
+  8009c1:	5d                   	pop    %ebp
+  8009c2:	c3                   	ret
+
+008009c3 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8009c3:	55                   	push   %ebp
+  8009c4:	89 e5                	mov    %esp,%ebp
+  8009c6:	53                   	push   %ebx
+  8009c7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009ca:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8009cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009d2:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8009d6:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8009d9:	83 c0 01             	add    $0x1,%eax
+  8009dc:	84 d2                	test   %dl,%dl
+  8009de:	75 f2                	jne    8009d2 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8009e0:	89 c8                	mov    %ecx,%eax
+  8009e2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009e5:	c9                   	leave
+  8009e6:	c3                   	ret
+
+008009e7 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8009e7:	55                   	push   %ebp
+  8009e8:	89 e5                	mov    %esp,%ebp
+  8009ea:	53                   	push   %ebx
+  8009eb:	83 ec 10             	sub    $0x10,%esp
+  8009ee:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8009f1:	53                   	push   %ebx
+  8009f2:	e8 91 ff ff ff       	call   800988 <strlen>
+  8009f7:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8009fa:	ff 75 0c             	push   0xc(%ebp)
+  8009fd:	01 d8                	add    %ebx,%eax
+  8009ff:	50                   	push   %eax
+  800a00:	e8 be ff ff ff       	call   8009c3 <strcpy>
+	return dst;
+}
+  800a05:	89 d8                	mov    %ebx,%eax
+  800a07:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a0a:	c9                   	leave
+  800a0b:	c3                   	ret
+
+00800a0c <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800a0c:	55                   	push   %ebp
+  800a0d:	89 e5                	mov    %esp,%ebp
+  800a0f:	56                   	push   %esi
+  800a10:	53                   	push   %ebx
+  800a11:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a14:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800a17:	89 f3                	mov    %esi,%ebx
+  800a19:	03 5d 10             	add    0x10(%ebp),%ebx
+  800a1c:	89 f0                	mov    %esi,%eax
+  800a1e:	eb 0f                	jmp    800a2f <strncpy+0x23>
+		*dst++ = *src;
+  800a20:	83 c0 01             	add    $0x1,%eax
+  800a23:	0f b6 0a             	movzbl (%edx),%ecx
+  800a26:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800a29:	80 f9 01             	cmp    $0x1,%cl
+  800a2c:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800a2f:	39 d8                	cmp    %ebx,%eax
+  800a31:	75 ed                	jne    800a20 <strncpy+0x14>
+	}
+	return ret;
+}
+  800a33:	89 f0                	mov    %esi,%eax
+  800a35:	5b                   	pop    %ebx
+  800a36:	5e                   	pop    %esi
+  800a37:	5d                   	pop    %ebp
+  800a38:	c3                   	ret
+
+00800a39 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800a39:	55                   	push   %ebp
+  800a3a:	89 e5                	mov    %esp,%ebp
+  800a3c:	56                   	push   %esi
+  800a3d:	53                   	push   %ebx
+  800a3e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a41:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a44:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800a47:	89 f0                	mov    %esi,%eax
+  800a49:	85 d2                	test   %edx,%edx
+  800a4b:	74 21                	je     800a6e <strlcpy+0x35>
+  800a4d:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800a51:	89 f2                	mov    %esi,%edx
+  800a53:	eb 09                	jmp    800a5e <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800a55:	83 c1 01             	add    $0x1,%ecx
+  800a58:	83 c2 01             	add    $0x1,%edx
+  800a5b:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800a5e:	39 c2                	cmp    %eax,%edx
+  800a60:	74 09                	je     800a6b <strlcpy+0x32>
+  800a62:	0f b6 19             	movzbl (%ecx),%ebx
+  800a65:	84 db                	test   %bl,%bl
+  800a67:	75 ec                	jne    800a55 <strlcpy+0x1c>
+  800a69:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800a6b:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800a6e:	29 f0                	sub    %esi,%eax
+}
+  800a70:	5b                   	pop    %ebx
+  800a71:	5e                   	pop    %esi
+  800a72:	5d                   	pop    %ebp
+  800a73:	c3                   	ret
+
+00800a74 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800a74:	55                   	push   %ebp
+  800a75:	89 e5                	mov    %esp,%ebp
+  800a77:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a7a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800a7d:	eb 06                	jmp    800a85 <strcmp+0x11>
+		p++, q++;
+  800a7f:	83 c1 01             	add    $0x1,%ecx
+  800a82:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800a85:	0f b6 01             	movzbl (%ecx),%eax
+  800a88:	84 c0                	test   %al,%al
+  800a8a:	74 04                	je     800a90 <strcmp+0x1c>
+  800a8c:	3a 02                	cmp    (%edx),%al
+  800a8e:	74 ef                	je     800a7f <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a90:	0f b6 c0             	movzbl %al,%eax
+  800a93:	0f b6 12             	movzbl (%edx),%edx
+  800a96:	29 d0                	sub    %edx,%eax
+}
+  800a98:	5d                   	pop    %ebp
+  800a99:	c3                   	ret
+
+00800a9a <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800a9a:	55                   	push   %ebp
+  800a9b:	89 e5                	mov    %esp,%ebp
+  800a9d:	53                   	push   %ebx
+  800a9e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aa1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800aa4:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800aa7:	eb 09                	jmp    800ab2 <strncmp+0x18>
+		n--, p++, q++;
+  800aa9:	83 ea 01             	sub    $0x1,%edx
+  800aac:	83 c0 01             	add    $0x1,%eax
+  800aaf:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800ab2:	85 d2                	test   %edx,%edx
+  800ab4:	74 18                	je     800ace <strncmp+0x34>
+  800ab6:	0f b6 18             	movzbl (%eax),%ebx
+  800ab9:	84 db                	test   %bl,%bl
+  800abb:	74 04                	je     800ac1 <strncmp+0x27>
+  800abd:	3a 19                	cmp    (%ecx),%bl
+  800abf:	74 e8                	je     800aa9 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800ac1:	0f b6 00             	movzbl (%eax),%eax
+  800ac4:	0f b6 11             	movzbl (%ecx),%edx
+  800ac7:	29 d0                	sub    %edx,%eax
+}
+  800ac9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800acc:	c9                   	leave
+  800acd:	c3                   	ret
+		return 0;
+  800ace:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ad3:	eb f4                	jmp    800ac9 <strncmp+0x2f>
+
+00800ad5 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800ad5:	55                   	push   %ebp
+  800ad6:	89 e5                	mov    %esp,%ebp
+  800ad8:	8b 45 08             	mov    0x8(%ebp),%eax
+  800adb:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800adf:	eb 03                	jmp    800ae4 <strchr+0xf>
+  800ae1:	83 c0 01             	add    $0x1,%eax
+  800ae4:	0f b6 10             	movzbl (%eax),%edx
+  800ae7:	84 d2                	test   %dl,%dl
+  800ae9:	74 06                	je     800af1 <strchr+0x1c>
+		if (*s == c)
+  800aeb:	38 ca                	cmp    %cl,%dl
+  800aed:	75 f2                	jne    800ae1 <strchr+0xc>
+  800aef:	eb 05                	jmp    800af6 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800af1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800af6:	5d                   	pop    %ebp
+  800af7:	c3                   	ret
+
+00800af8 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800af8:	55                   	push   %ebp
+  800af9:	89 e5                	mov    %esp,%ebp
+  800afb:	8b 45 08             	mov    0x8(%ebp),%eax
+  800afe:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b02:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800b05:	38 ca                	cmp    %cl,%dl
+  800b07:	74 09                	je     800b12 <strfind+0x1a>
+  800b09:	84 d2                	test   %dl,%dl
+  800b0b:	74 05                	je     800b12 <strfind+0x1a>
+	for (; *s; s++)
+  800b0d:	83 c0 01             	add    $0x1,%eax
+  800b10:	eb f0                	jmp    800b02 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800b12:	5d                   	pop    %ebp
+  800b13:	c3                   	ret
+
+00800b14 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800b14:	55                   	push   %ebp
+  800b15:	89 e5                	mov    %esp,%ebp
+  800b17:	57                   	push   %edi
+  800b18:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b1b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800b1e:	85 c9                	test   %ecx,%ecx
+  800b20:	74 20                	je     800b42 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800b22:	89 f8                	mov    %edi,%eax
+  800b24:	09 c8                	or     %ecx,%eax
+  800b26:	a8 03                	test   $0x3,%al
+  800b28:	75 12                	jne    800b3c <memset+0x28>
+		c &= 0xFF;
+  800b2a:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800b2e:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800b34:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800b37:	fc                   	cld
+  800b38:	f3 ab                	rep stos %eax,%es:(%edi)
+  800b3a:	eb 06                	jmp    800b42 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800b3c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b3f:	fc                   	cld
+  800b40:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800b42:	89 f8                	mov    %edi,%eax
+  800b44:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800b47:	c9                   	leave
+  800b48:	c3                   	ret
+
+00800b49 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800b49:	55                   	push   %ebp
+  800b4a:	89 e5                	mov    %esp,%ebp
+  800b4c:	57                   	push   %edi
+  800b4d:	56                   	push   %esi
+  800b4e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b51:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b54:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800b57:	39 c6                	cmp    %eax,%esi
+  800b59:	73 32                	jae    800b8d <memmove+0x44>
+  800b5b:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800b5e:	39 d0                	cmp    %edx,%eax
+  800b60:	73 2b                	jae    800b8d <memmove+0x44>
+		s += n;
+		d += n;
+  800b62:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b65:	89 d6                	mov    %edx,%esi
+  800b67:	09 fe                	or     %edi,%esi
+  800b69:	09 ce                	or     %ecx,%esi
+  800b6b:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800b71:	75 0e                	jne    800b81 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800b73:	83 ef 04             	sub    $0x4,%edi
+  800b76:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800b79:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800b7c:	fd                   	std
+  800b7d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b7f:	eb 09                	jmp    800b8a <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800b81:	83 ef 01             	sub    $0x1,%edi
+  800b84:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800b87:	fd                   	std
+  800b88:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800b8a:	fc                   	cld
+  800b8b:	eb 1a                	jmp    800ba7 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b8d:	89 f2                	mov    %esi,%edx
+  800b8f:	09 c2                	or     %eax,%edx
+  800b91:	09 ca                	or     %ecx,%edx
+  800b93:	f6 c2 03             	test   $0x3,%dl
+  800b96:	75 0a                	jne    800ba2 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800b98:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800b9b:	89 c7                	mov    %eax,%edi
+  800b9d:	fc                   	cld
+  800b9e:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ba0:	eb 05                	jmp    800ba7 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800ba2:	89 c7                	mov    %eax,%edi
+  800ba4:	fc                   	cld
+  800ba5:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800ba7:	5e                   	pop    %esi
+  800ba8:	5f                   	pop    %edi
+  800ba9:	5d                   	pop    %ebp
+  800baa:	c3                   	ret
+
+00800bab <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800bab:	55                   	push   %ebp
+  800bac:	89 e5                	mov    %esp,%ebp
+  800bae:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800bb1:	ff 75 10             	push   0x10(%ebp)
+  800bb4:	ff 75 0c             	push   0xc(%ebp)
+  800bb7:	ff 75 08             	push   0x8(%ebp)
+  800bba:	e8 8a ff ff ff       	call   800b49 <memmove>
+}
+  800bbf:	c9                   	leave
+  800bc0:	c3                   	ret
+
+00800bc1 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800bc1:	55                   	push   %ebp
+  800bc2:	89 e5                	mov    %esp,%ebp
+  800bc4:	56                   	push   %esi
+  800bc5:	53                   	push   %ebx
+  800bc6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bc9:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800bcc:	89 c6                	mov    %eax,%esi
+  800bce:	03 75 10             	add    0x10(%ebp),%esi
+  800bd1:	eb 06                	jmp    800bd9 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800bd3:	83 c0 01             	add    $0x1,%eax
+  800bd6:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800bd9:	39 f0                	cmp    %esi,%eax
+  800bdb:	74 14                	je     800bf1 <memcmp+0x30>
+		if (*s1 != *s2)
+  800bdd:	0f b6 08             	movzbl (%eax),%ecx
+  800be0:	0f b6 1a             	movzbl (%edx),%ebx
+  800be3:	38 d9                	cmp    %bl,%cl
+  800be5:	74 ec                	je     800bd3 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800be7:	0f b6 c1             	movzbl %cl,%eax
+  800bea:	0f b6 db             	movzbl %bl,%ebx
+  800bed:	29 d8                	sub    %ebx,%eax
+  800bef:	eb 05                	jmp    800bf6 <memcmp+0x35>
+	}
+
+	return 0;
+  800bf1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800bf6:	5b                   	pop    %ebx
+  800bf7:	5e                   	pop    %esi
+  800bf8:	5d                   	pop    %ebp
+  800bf9:	c3                   	ret
+
+00800bfa <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800bfa:	55                   	push   %ebp
+  800bfb:	89 e5                	mov    %esp,%ebp
+  800bfd:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c00:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800c03:	89 c2                	mov    %eax,%edx
+  800c05:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800c08:	eb 03                	jmp    800c0d <memfind+0x13>
+  800c0a:	83 c0 01             	add    $0x1,%eax
+  800c0d:	39 d0                	cmp    %edx,%eax
+  800c0f:	73 04                	jae    800c15 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800c11:	38 08                	cmp    %cl,(%eax)
+  800c13:	75 f5                	jne    800c0a <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800c15:	5d                   	pop    %ebp
+  800c16:	c3                   	ret
+
+00800c17 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800c17:	55                   	push   %ebp
+  800c18:	89 e5                	mov    %esp,%ebp
+  800c1a:	57                   	push   %edi
+  800c1b:	56                   	push   %esi
+  800c1c:	53                   	push   %ebx
+  800c1d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c20:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800c23:	eb 03                	jmp    800c28 <strtol+0x11>
+		s++;
+  800c25:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800c28:	0f b6 02             	movzbl (%edx),%eax
+  800c2b:	3c 20                	cmp    $0x20,%al
+  800c2d:	74 f6                	je     800c25 <strtol+0xe>
+  800c2f:	3c 09                	cmp    $0x9,%al
+  800c31:	74 f2                	je     800c25 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800c33:	3c 2b                	cmp    $0x2b,%al
+  800c35:	74 2a                	je     800c61 <strtol+0x4a>
+	int neg = 0;
+  800c37:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800c3c:	3c 2d                	cmp    $0x2d,%al
+  800c3e:	74 2b                	je     800c6b <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c40:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800c46:	75 0f                	jne    800c57 <strtol+0x40>
+  800c48:	80 3a 30             	cmpb   $0x30,(%edx)
+  800c4b:	74 28                	je     800c75 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800c4d:	85 db                	test   %ebx,%ebx
+  800c4f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c54:	0f 44 d8             	cmove  %eax,%ebx
+  800c57:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c5c:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800c5f:	eb 46                	jmp    800ca7 <strtol+0x90>
+		s++;
+  800c61:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800c64:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c69:	eb d5                	jmp    800c40 <strtol+0x29>
+		s++, neg = 1;
+  800c6b:	83 c2 01             	add    $0x1,%edx
+  800c6e:	bf 01 00 00 00       	mov    $0x1,%edi
+  800c73:	eb cb                	jmp    800c40 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c75:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800c79:	74 0e                	je     800c89 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800c7b:	85 db                	test   %ebx,%ebx
+  800c7d:	75 d8                	jne    800c57 <strtol+0x40>
+		s++, base = 8;
+  800c7f:	83 c2 01             	add    $0x1,%edx
+  800c82:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800c87:	eb ce                	jmp    800c57 <strtol+0x40>
+		s += 2, base = 16;
+  800c89:	83 c2 02             	add    $0x2,%edx
+  800c8c:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800c91:	eb c4                	jmp    800c57 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800c93:	0f be c0             	movsbl %al,%eax
+  800c96:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800c99:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800c9c:	7d 3a                	jge    800cd8 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800c9e:	83 c2 01             	add    $0x1,%edx
+  800ca1:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800ca5:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800ca7:	0f b6 02             	movzbl (%edx),%eax
+  800caa:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800cad:	89 f3                	mov    %esi,%ebx
+  800caf:	80 fb 09             	cmp    $0x9,%bl
+  800cb2:	76 df                	jbe    800c93 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800cb4:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800cb7:	89 f3                	mov    %esi,%ebx
+  800cb9:	80 fb 19             	cmp    $0x19,%bl
+  800cbc:	77 08                	ja     800cc6 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800cbe:	0f be c0             	movsbl %al,%eax
+  800cc1:	83 e8 57             	sub    $0x57,%eax
+  800cc4:	eb d3                	jmp    800c99 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800cc6:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800cc9:	89 f3                	mov    %esi,%ebx
+  800ccb:	80 fb 19             	cmp    $0x19,%bl
+  800cce:	77 08                	ja     800cd8 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800cd0:	0f be c0             	movsbl %al,%eax
+  800cd3:	83 e8 37             	sub    $0x37,%eax
+  800cd6:	eb c1                	jmp    800c99 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800cd8:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800cdc:	74 05                	je     800ce3 <strtol+0xcc>
+		*endptr = (char *) s;
+  800cde:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ce1:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800ce3:	89 c8                	mov    %ecx,%eax
+  800ce5:	f7 d8                	neg    %eax
+  800ce7:	85 ff                	test   %edi,%edi
+  800ce9:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800cec:	89 c8                	mov    %ecx,%eax
+  800cee:	5b                   	pop    %ebx
+  800cef:	5e                   	pop    %esi
+  800cf0:	5f                   	pop    %edi
+  800cf1:	5d                   	pop    %ebp
+  800cf2:	c3                   	ret
+
+00800cf3 <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800cf3:	55                   	push   %ebp
+  800cf4:	89 e5                	mov    %esp,%ebp
+  800cf6:	57                   	push   %edi
+  800cf7:	56                   	push   %esi
+  800cf8:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800cf9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cfe:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d01:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d04:	89 c3                	mov    %eax,%ebx
+  800d06:	89 c7                	mov    %eax,%edi
+  800d08:	89 c6                	mov    %eax,%esi
+  800d0a:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  800d0c:	5b                   	pop    %ebx
+  800d0d:	5e                   	pop    %esi
+  800d0e:	5f                   	pop    %edi
+  800d0f:	5d                   	pop    %ebp
+  800d10:	c3                   	ret
+
+00800d11 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800d11:	55                   	push   %ebp
+  800d12:	89 e5                	mov    %esp,%ebp
+  800d14:	57                   	push   %edi
+  800d15:	56                   	push   %esi
+  800d16:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d17:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d1c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d21:	89 d1                	mov    %edx,%ecx
+  800d23:	89 d3                	mov    %edx,%ebx
+  800d25:	89 d7                	mov    %edx,%edi
+  800d27:	89 d6                	mov    %edx,%esi
+  800d29:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800d2b:	5b                   	pop    %ebx
+  800d2c:	5e                   	pop    %esi
+  800d2d:	5f                   	pop    %edi
+  800d2e:	5d                   	pop    %ebp
+  800d2f:	c3                   	ret
+
+00800d30 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800d30:	55                   	push   %ebp
+  800d31:	89 e5                	mov    %esp,%ebp
+  800d33:	57                   	push   %edi
+  800d34:	56                   	push   %esi
+  800d35:	53                   	push   %ebx
+  800d36:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800d39:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d3e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d41:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d46:	89 cb                	mov    %ecx,%ebx
+  800d48:	89 cf                	mov    %ecx,%edi
+  800d4a:	89 ce                	mov    %ecx,%esi
+  800d4c:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d4e:	85 c0                	test   %eax,%eax
+  800d50:	7f 08                	jg     800d5a <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800d52:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d55:	5b                   	pop    %ebx
+  800d56:	5e                   	pop    %esi
+  800d57:	5f                   	pop    %edi
+  800d58:	5d                   	pop    %ebp
+  800d59:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d5a:	83 ec 0c             	sub    $0xc,%esp
+  800d5d:	50                   	push   %eax
+  800d5e:	6a 03                	push   $0x3
+  800d60:	68 a3 2d 80 00       	push   $0x802da3
+  800d65:	6a 3e                	push   $0x3e
+  800d67:	68 c0 2d 80 00       	push   $0x802dc0
+  800d6c:	e8 be f5 ff ff       	call   80032f <_panic>
+
+00800d71 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800d71:	55                   	push   %ebp
+  800d72:	89 e5                	mov    %esp,%ebp
+  800d74:	57                   	push   %edi
+  800d75:	56                   	push   %esi
+  800d76:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d77:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d7c:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d81:	89 d1                	mov    %edx,%ecx
+  800d83:	89 d3                	mov    %edx,%ebx
+  800d85:	89 d7                	mov    %edx,%edi
+  800d87:	89 d6                	mov    %edx,%esi
+  800d89:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800d8b:	5b                   	pop    %ebx
+  800d8c:	5e                   	pop    %esi
+  800d8d:	5f                   	pop    %edi
+  800d8e:	5d                   	pop    %ebp
+  800d8f:	c3                   	ret
+
+00800d90 <sys_yield>:
+
+void
+sys_yield(void) {
+  800d90:	55                   	push   %ebp
+  800d91:	89 e5                	mov    %esp,%ebp
+  800d93:	57                   	push   %edi
+  800d94:	56                   	push   %esi
+  800d95:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d96:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d9b:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800da0:	89 d1                	mov    %edx,%ecx
+  800da2:	89 d3                	mov    %edx,%ebx
+  800da4:	89 d7                	mov    %edx,%edi
+  800da6:	89 d6                	mov    %edx,%esi
+  800da8:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800daa:	5b                   	pop    %ebx
+  800dab:	5e                   	pop    %esi
+  800dac:	5f                   	pop    %edi
+  800dad:	5d                   	pop    %ebp
+  800dae:	c3                   	ret
+
+00800daf <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  800daf:	55                   	push   %ebp
+  800db0:	89 e5                	mov    %esp,%ebp
+  800db2:	57                   	push   %edi
+  800db3:	56                   	push   %esi
+  800db4:	53                   	push   %ebx
+  800db5:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800db8:	be 00 00 00 00       	mov    $0x0,%esi
+  800dbd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dc3:	b8 04 00 00 00       	mov    $0x4,%eax
+  800dc8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dcb:	89 f7                	mov    %esi,%edi
+  800dcd:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800dcf:	85 c0                	test   %eax,%eax
+  800dd1:	7f 08                	jg     800ddb <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800dd3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dd6:	5b                   	pop    %ebx
+  800dd7:	5e                   	pop    %esi
+  800dd8:	5f                   	pop    %edi
+  800dd9:	5d                   	pop    %ebp
+  800dda:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ddb:	83 ec 0c             	sub    $0xc,%esp
+  800dde:	50                   	push   %eax
+  800ddf:	6a 04                	push   $0x4
+  800de1:	68 a3 2d 80 00       	push   $0x802da3
+  800de6:	6a 3e                	push   $0x3e
+  800de8:	68 c0 2d 80 00       	push   $0x802dc0
+  800ded:	e8 3d f5 ff ff       	call   80032f <_panic>
+
+00800df2 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  800df2:	55                   	push   %ebp
+  800df3:	89 e5                	mov    %esp,%ebp
+  800df5:	57                   	push   %edi
+  800df6:	56                   	push   %esi
+  800df7:	53                   	push   %ebx
+  800df8:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800dfb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dfe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e01:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e06:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e09:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e0c:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e0f:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e11:	85 c0                	test   %eax,%eax
+  800e13:	7f 08                	jg     800e1d <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800e15:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e18:	5b                   	pop    %ebx
+  800e19:	5e                   	pop    %esi
+  800e1a:	5f                   	pop    %edi
+  800e1b:	5d                   	pop    %ebp
+  800e1c:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e1d:	83 ec 0c             	sub    $0xc,%esp
+  800e20:	50                   	push   %eax
+  800e21:	6a 05                	push   $0x5
+  800e23:	68 a3 2d 80 00       	push   $0x802da3
+  800e28:	6a 3e                	push   $0x3e
+  800e2a:	68 c0 2d 80 00       	push   $0x802dc0
+  800e2f:	e8 fb f4 ff ff       	call   80032f <_panic>
+
+00800e34 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  800e34:	55                   	push   %ebp
+  800e35:	89 e5                	mov    %esp,%ebp
+  800e37:	57                   	push   %edi
+  800e38:	56                   	push   %esi
+  800e39:	53                   	push   %ebx
+  800e3a:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800e3d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e42:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e45:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e48:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e4d:	89 df                	mov    %ebx,%edi
+  800e4f:	89 de                	mov    %ebx,%esi
+  800e51:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e53:	85 c0                	test   %eax,%eax
+  800e55:	7f 08                	jg     800e5f <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e57:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e5a:	5b                   	pop    %ebx
+  800e5b:	5e                   	pop    %esi
+  800e5c:	5f                   	pop    %edi
+  800e5d:	5d                   	pop    %ebp
+  800e5e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e5f:	83 ec 0c             	sub    $0xc,%esp
+  800e62:	50                   	push   %eax
+  800e63:	6a 06                	push   $0x6
+  800e65:	68 a3 2d 80 00       	push   $0x802da3
+  800e6a:	6a 3e                	push   $0x3e
+  800e6c:	68 c0 2d 80 00       	push   $0x802dc0
+  800e71:	e8 b9 f4 ff ff       	call   80032f <_panic>
+
+00800e76 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800e76:	55                   	push   %ebp
+  800e77:	89 e5                	mov    %esp,%ebp
+  800e79:	57                   	push   %edi
+  800e7a:	56                   	push   %esi
+  800e7b:	53                   	push   %ebx
+  800e7c:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800e7f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e84:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e87:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e8a:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e8f:	89 df                	mov    %ebx,%edi
+  800e91:	89 de                	mov    %ebx,%esi
+  800e93:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e95:	85 c0                	test   %eax,%eax
+  800e97:	7f 08                	jg     800ea1 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800e99:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e9c:	5b                   	pop    %ebx
+  800e9d:	5e                   	pop    %esi
+  800e9e:	5f                   	pop    %edi
+  800e9f:	5d                   	pop    %ebp
+  800ea0:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ea1:	83 ec 0c             	sub    $0xc,%esp
+  800ea4:	50                   	push   %eax
+  800ea5:	6a 08                	push   $0x8
+  800ea7:	68 a3 2d 80 00       	push   $0x802da3
+  800eac:	6a 3e                	push   $0x3e
+  800eae:	68 c0 2d 80 00       	push   $0x802dc0
+  800eb3:	e8 77 f4 ff ff       	call   80032f <_panic>
+
+00800eb8 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800eb8:	55                   	push   %ebp
+  800eb9:	89 e5                	mov    %esp,%ebp
+  800ebb:	57                   	push   %edi
+  800ebc:	56                   	push   %esi
+  800ebd:	53                   	push   %ebx
+  800ebe:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800ec1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ec6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ecc:	b8 09 00 00 00       	mov    $0x9,%eax
+  800ed1:	89 df                	mov    %ebx,%edi
+  800ed3:	89 de                	mov    %ebx,%esi
+  800ed5:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ed7:	85 c0                	test   %eax,%eax
+  800ed9:	7f 08                	jg     800ee3 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800edb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ede:	5b                   	pop    %ebx
+  800edf:	5e                   	pop    %esi
+  800ee0:	5f                   	pop    %edi
+  800ee1:	5d                   	pop    %ebp
+  800ee2:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ee3:	83 ec 0c             	sub    $0xc,%esp
+  800ee6:	50                   	push   %eax
+  800ee7:	6a 09                	push   $0x9
+  800ee9:	68 a3 2d 80 00       	push   $0x802da3
+  800eee:	6a 3e                	push   $0x3e
+  800ef0:	68 c0 2d 80 00       	push   $0x802dc0
+  800ef5:	e8 35 f4 ff ff       	call   80032f <_panic>
+
+00800efa <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800efa:	55                   	push   %ebp
+  800efb:	89 e5                	mov    %esp,%ebp
+  800efd:	57                   	push   %edi
+  800efe:	56                   	push   %esi
+  800eff:	53                   	push   %ebx
+  800f00:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800f03:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f08:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f0b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f0e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f13:	89 df                	mov    %ebx,%edi
+  800f15:	89 de                	mov    %ebx,%esi
+  800f17:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f19:	85 c0                	test   %eax,%eax
+  800f1b:	7f 08                	jg     800f25 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800f1d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f20:	5b                   	pop    %ebx
+  800f21:	5e                   	pop    %esi
+  800f22:	5f                   	pop    %edi
+  800f23:	5d                   	pop    %ebp
+  800f24:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f25:	83 ec 0c             	sub    $0xc,%esp
+  800f28:	50                   	push   %eax
+  800f29:	6a 0a                	push   $0xa
+  800f2b:	68 a3 2d 80 00       	push   $0x802da3
+  800f30:	6a 3e                	push   $0x3e
+  800f32:	68 c0 2d 80 00       	push   $0x802dc0
+  800f37:	e8 f3 f3 ff ff       	call   80032f <_panic>
+
+00800f3c <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  800f3c:	55                   	push   %ebp
+  800f3d:	89 e5                	mov    %esp,%ebp
+  800f3f:	57                   	push   %edi
+  800f40:	56                   	push   %esi
+  800f41:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800f42:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f45:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f48:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f4d:	be 00 00 00 00       	mov    $0x0,%esi
+  800f52:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f55:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f58:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800f5a:	5b                   	pop    %ebx
+  800f5b:	5e                   	pop    %esi
+  800f5c:	5f                   	pop    %edi
+  800f5d:	5d                   	pop    %ebp
+  800f5e:	c3                   	ret
+
+00800f5f <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  800f5f:	55                   	push   %ebp
+  800f60:	89 e5                	mov    %esp,%ebp
+  800f62:	57                   	push   %edi
+  800f63:	56                   	push   %esi
+  800f64:	53                   	push   %ebx
+  800f65:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800f68:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f6d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f70:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f75:	89 cb                	mov    %ecx,%ebx
+  800f77:	89 cf                	mov    %ecx,%edi
+  800f79:	89 ce                	mov    %ecx,%esi
+  800f7b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f7d:	85 c0                	test   %eax,%eax
+  800f7f:	7f 08                	jg     800f89 <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  800f81:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f84:	5b                   	pop    %ebx
+  800f85:	5e                   	pop    %esi
+  800f86:	5f                   	pop    %edi
+  800f87:	5d                   	pop    %ebp
+  800f88:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f89:	83 ec 0c             	sub    $0xc,%esp
+  800f8c:	50                   	push   %eax
+  800f8d:	6a 0d                	push   $0xd
+  800f8f:	68 a3 2d 80 00       	push   $0x802da3
+  800f94:	6a 3e                	push   $0x3e
+  800f96:	68 c0 2d 80 00       	push   $0x802dc0
+  800f9b:	e8 8f f3 ff ff       	call   80032f <_panic>
+
+00800fa0 <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  800fa0:	55                   	push   %ebp
+  800fa1:	89 e5                	mov    %esp,%ebp
+  800fa3:	57                   	push   %edi
+  800fa4:	56                   	push   %esi
+  800fa5:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800fa6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fab:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fb1:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800fb6:	89 df                	mov    %ebx,%edi
+  800fb8:	89 de                	mov    %ebx,%esi
+  800fba:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  800fbc:	5b                   	pop    %ebx
+  800fbd:	5e                   	pop    %esi
+  800fbe:	5f                   	pop    %edi
+  800fbf:	5d                   	pop    %ebp
+  800fc0:	c3                   	ret
+
+00800fc1 <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  800fc1:	55                   	push   %ebp
+  800fc2:	89 e5                	mov    %esp,%ebp
+  800fc4:	57                   	push   %edi
+  800fc5:	56                   	push   %esi
+  800fc6:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800fc7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fcc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fcf:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800fd4:	89 cb                	mov    %ecx,%ebx
+  800fd6:	89 cf                	mov    %ecx,%edi
+  800fd8:	89 ce                	mov    %ecx,%esi
+  800fda:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  800fdc:	5b                   	pop    %ebx
+  800fdd:	5e                   	pop    %esi
+  800fde:	5f                   	pop    %edi
+  800fdf:	5d                   	pop    %ebp
+  800fe0:	c3                   	ret
+
+00800fe1 <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  800fe1:	55                   	push   %ebp
+  800fe2:	89 e5                	mov    %esp,%ebp
+  800fe4:	57                   	push   %edi
+  800fe5:	56                   	push   %esi
+  800fe6:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800fe7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fec:	b8 10 00 00 00       	mov    $0x10,%eax
+  800ff1:	89 d1                	mov    %edx,%ecx
+  800ff3:	89 d3                	mov    %edx,%ebx
+  800ff5:	89 d7                	mov    %edx,%edi
+  800ff7:	89 d6                	mov    %edx,%esi
+  800ff9:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800ffb:	5b                   	pop    %ebx
+  800ffc:	5e                   	pop    %esi
+  800ffd:	5f                   	pop    %edi
+  800ffe:	5d                   	pop    %ebp
+  800fff:	c3                   	ret
+
+00801000 <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  801000:	55                   	push   %ebp
+  801001:	89 e5                	mov    %esp,%ebp
+  801003:	57                   	push   %edi
+  801004:	56                   	push   %esi
+  801005:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  801006:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80100b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80100e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801011:	b8 11 00 00 00       	mov    $0x11,%eax
+  801016:	89 df                	mov    %ebx,%edi
+  801018:	89 de                	mov    %ebx,%esi
+  80101a:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  80101c:	5b                   	pop    %ebx
+  80101d:	5e                   	pop    %esi
+  80101e:	5f                   	pop    %edi
+  80101f:	5d                   	pop    %ebp
+  801020:	c3                   	ret
+
+00801021 <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  801021:	55                   	push   %ebp
+  801022:	89 e5                	mov    %esp,%ebp
+  801024:	57                   	push   %edi
+  801025:	56                   	push   %esi
+  801026:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  801027:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80102c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80102f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801032:	b8 12 00 00 00       	mov    $0x12,%eax
+  801037:	89 df                	mov    %ebx,%edi
+  801039:	89 de                	mov    %ebx,%esi
+  80103b:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  80103d:	5b                   	pop    %ebx
+  80103e:	5e                   	pop    %esi
+  80103f:	5f                   	pop    %edi
+  801040:	5d                   	pop    %ebp
+  801041:	c3                   	ret
+
+00801042 <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  801042:	55                   	push   %ebp
+  801043:	89 e5                	mov    %esp,%ebp
+  801045:	57                   	push   %edi
+  801046:	56                   	push   %esi
+  801047:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  801048:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80104d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801050:	b8 13 00 00 00       	mov    $0x13,%eax
+  801055:	89 cb                	mov    %ecx,%ebx
+  801057:	89 cf                	mov    %ecx,%edi
+  801059:	89 ce                	mov    %ecx,%esi
+  80105b:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  80105d:	5b                   	pop    %ebx
+  80105e:	5e                   	pop    %esi
+  80105f:	5f                   	pop    %edi
+  801060:	5d                   	pop    %ebp
+  801061:	c3                   	ret
+
+00801062 <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  801062:	55                   	push   %ebp
+  801063:	89 e5                	mov    %esp,%ebp
+  801065:	57                   	push   %edi
+  801066:	56                   	push   %esi
+  801067:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  801068:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80106d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801070:	b8 14 00 00 00       	mov    $0x14,%eax
+  801075:	89 cb                	mov    %ecx,%ebx
+  801077:	89 cf                	mov    %ecx,%edi
+  801079:	89 ce                	mov    %ecx,%esi
+  80107b:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  80107d:	5b                   	pop    %ebx
+  80107e:	5e                   	pop    %esi
+  80107f:	5f                   	pop    %edi
+  801080:	5d                   	pop    %ebp
+  801081:	c3                   	ret
+
+00801082 <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args)
+{
+  801082:	55                   	push   %ebp
+  801083:	89 e5                	mov    %esp,%ebp
+  801085:	8b 55 08             	mov    0x8(%ebp),%edx
+  801088:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80108b:	8b 45 10             	mov    0x10(%ebp),%eax
+	args->argc = argc;
+  80108e:	89 10                	mov    %edx,(%eax)
+	args->argv = (const char **) argv;
+  801090:	89 48 04             	mov    %ecx,0x4(%eax)
+	args->curarg = (*argc > 1 && argv ? "" : 0);
+  801093:	83 3a 01             	cmpl   $0x1,(%edx)
+  801096:	7e 09                	jle    8010a1 <argstart+0x1f>
+  801098:	ba 48 2a 80 00       	mov    $0x802a48,%edx
+  80109d:	85 c9                	test   %ecx,%ecx
+  80109f:	75 05                	jne    8010a6 <argstart+0x24>
+  8010a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010a6:	89 50 08             	mov    %edx,0x8(%eax)
+	args->argvalue = 0;
+  8010a9:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+}
+  8010b0:	5d                   	pop    %ebp
+  8010b1:	c3                   	ret
+
+008010b2 <argnext>:
+
+int
+argnext(struct Argstate *args)
+{
+  8010b2:	55                   	push   %ebp
+  8010b3:	89 e5                	mov    %esp,%ebp
+  8010b5:	53                   	push   %ebx
+  8010b6:	83 ec 04             	sub    $0x4,%esp
+  8010b9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int arg;
+
+	args->argvalue = 0;
+  8010bc:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+
+	// Done processing arguments if args->curarg == 0
+	if (args->curarg == 0)
+  8010c3:	8b 43 08             	mov    0x8(%ebx),%eax
+  8010c6:	85 c0                	test   %eax,%eax
+  8010c8:	74 74                	je     80113e <argnext+0x8c>
+		return -1;
+
+	if (!*args->curarg) {
+  8010ca:	80 38 00             	cmpb   $0x0,(%eax)
+  8010cd:	75 48                	jne    801117 <argnext+0x65>
+		// Need to process the next argument
+		// Check for end of argument list
+		if (*args->argc == 1
+  8010cf:	8b 0b                	mov    (%ebx),%ecx
+  8010d1:	83 39 01             	cmpl   $0x1,(%ecx)
+  8010d4:	74 5a                	je     801130 <argnext+0x7e>
+		    || args->argv[1][0] != '-'
+  8010d6:	8b 53 04             	mov    0x4(%ebx),%edx
+  8010d9:	8b 42 04             	mov    0x4(%edx),%eax
+  8010dc:	80 38 2d             	cmpb   $0x2d,(%eax)
+  8010df:	75 4f                	jne    801130 <argnext+0x7e>
+		    || args->argv[1][1] == '\0')
+  8010e1:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  8010e5:	74 49                	je     801130 <argnext+0x7e>
+			goto endofargs;
+		// Shift arguments down one
+		args->curarg = args->argv[1] + 1;
+  8010e7:	83 c0 01             	add    $0x1,%eax
+  8010ea:	89 43 08             	mov    %eax,0x8(%ebx)
+		memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  8010ed:	83 ec 04             	sub    $0x4,%esp
+  8010f0:	8b 01                	mov    (%ecx),%eax
+  8010f2:	8d 04 85 fc ff ff ff 	lea    -0x4(,%eax,4),%eax
+  8010f9:	50                   	push   %eax
+  8010fa:	8d 42 08             	lea    0x8(%edx),%eax
+  8010fd:	50                   	push   %eax
+  8010fe:	83 c2 04             	add    $0x4,%edx
+  801101:	52                   	push   %edx
+  801102:	e8 42 fa ff ff       	call   800b49 <memmove>
+		(*args->argc)--;
+  801107:	8b 03                	mov    (%ebx),%eax
+  801109:	83 28 01             	subl   $0x1,(%eax)
+		// Check for "--": end of argument list
+		if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  80110c:	8b 43 08             	mov    0x8(%ebx),%eax
+  80110f:	83 c4 10             	add    $0x10,%esp
+  801112:	80 38 2d             	cmpb   $0x2d,(%eax)
+  801115:	74 13                	je     80112a <argnext+0x78>
+			goto endofargs;
+	}
+
+	arg = (unsigned char) *args->curarg;
+  801117:	8b 43 08             	mov    0x8(%ebx),%eax
+  80111a:	0f b6 10             	movzbl (%eax),%edx
+	args->curarg++;
+  80111d:	83 c0 01             	add    $0x1,%eax
+  801120:	89 43 08             	mov    %eax,0x8(%ebx)
+	return arg;
+
+    endofargs:
+	args->curarg = 0;
+	return -1;
+}
+  801123:	89 d0                	mov    %edx,%eax
+  801125:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801128:	c9                   	leave
+  801129:	c3                   	ret
+		if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  80112a:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  80112e:	75 e7                	jne    801117 <argnext+0x65>
+	args->curarg = 0;
+  801130:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+	return -1;
+  801137:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  80113c:	eb e5                	jmp    801123 <argnext+0x71>
+		return -1;
+  80113e:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  801143:	eb de                	jmp    801123 <argnext+0x71>
+
+00801145 <argnextvalue>:
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+}
+
+char *
+argnextvalue(struct Argstate *args)
+{
+  801145:	55                   	push   %ebp
+  801146:	89 e5                	mov    %esp,%ebp
+  801148:	53                   	push   %ebx
+  801149:	83 ec 04             	sub    $0x4,%esp
+  80114c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!args->curarg)
+  80114f:	8b 43 08             	mov    0x8(%ebx),%eax
+  801152:	85 c0                	test   %eax,%eax
+  801154:	74 12                	je     801168 <argnextvalue+0x23>
+		return 0;
+	if (*args->curarg) {
+  801156:	80 38 00             	cmpb   $0x0,(%eax)
+  801159:	74 12                	je     80116d <argnextvalue+0x28>
+		args->argvalue = args->curarg;
+  80115b:	89 43 0c             	mov    %eax,0xc(%ebx)
+		args->curarg = "";
+  80115e:	c7 43 08 48 2a 80 00 	movl   $0x802a48,0x8(%ebx)
+		(*args->argc)--;
+	} else {
+		args->argvalue = 0;
+		args->curarg = 0;
+	}
+	return (char*) args->argvalue;
+  801165:	8b 43 0c             	mov    0xc(%ebx),%eax
+}
+  801168:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80116b:	c9                   	leave
+  80116c:	c3                   	ret
+	} else if (*args->argc > 1) {
+  80116d:	8b 13                	mov    (%ebx),%edx
+  80116f:	83 3a 01             	cmpl   $0x1,(%edx)
+  801172:	7f 10                	jg     801184 <argnextvalue+0x3f>
+		args->argvalue = 0;
+  801174:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		args->curarg = 0;
+  80117b:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  801182:	eb e1                	jmp    801165 <argnextvalue+0x20>
+		args->argvalue = args->argv[1];
+  801184:	8b 43 04             	mov    0x4(%ebx),%eax
+  801187:	8b 48 04             	mov    0x4(%eax),%ecx
+  80118a:	89 4b 0c             	mov    %ecx,0xc(%ebx)
+		memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  80118d:	83 ec 04             	sub    $0x4,%esp
+  801190:	8b 12                	mov    (%edx),%edx
+  801192:	8d 14 95 fc ff ff ff 	lea    -0x4(,%edx,4),%edx
+  801199:	52                   	push   %edx
+  80119a:	8d 50 08             	lea    0x8(%eax),%edx
+  80119d:	52                   	push   %edx
+  80119e:	83 c0 04             	add    $0x4,%eax
+  8011a1:	50                   	push   %eax
+  8011a2:	e8 a2 f9 ff ff       	call   800b49 <memmove>
+		(*args->argc)--;
+  8011a7:	8b 03                	mov    (%ebx),%eax
+  8011a9:	83 28 01             	subl   $0x1,(%eax)
+  8011ac:	83 c4 10             	add    $0x10,%esp
+  8011af:	eb b4                	jmp    801165 <argnextvalue+0x20>
+
+008011b1 <argvalue>:
+{
+  8011b1:	55                   	push   %ebp
+  8011b2:	89 e5                	mov    %esp,%ebp
+  8011b4:	83 ec 08             	sub    $0x8,%esp
+  8011b7:	8b 55 08             	mov    0x8(%ebp),%edx
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+  8011ba:	8b 42 0c             	mov    0xc(%edx),%eax
+  8011bd:	85 c0                	test   %eax,%eax
+  8011bf:	74 02                	je     8011c3 <argvalue+0x12>
+}
+  8011c1:	c9                   	leave
+  8011c2:	c3                   	ret
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+  8011c3:	83 ec 0c             	sub    $0xc,%esp
+  8011c6:	52                   	push   %edx
+  8011c7:	e8 79 ff ff ff       	call   801145 <argnextvalue>
+  8011cc:	83 c4 10             	add    $0x10,%esp
+  8011cf:	eb f0                	jmp    8011c1 <argvalue+0x10>
+
+008011d1 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8011d1:	55                   	push   %ebp
+  8011d2:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8011d4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011d7:	05 00 00 00 30       	add    $0x30000000,%eax
+  8011dc:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8011df:	5d                   	pop    %ebp
+  8011e0:	c3                   	ret
+
+008011e1 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8011e1:	55                   	push   %ebp
+  8011e2:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8011e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011e7:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8011ec:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8011f1:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8011f6:	5d                   	pop    %ebp
+  8011f7:	c3                   	ret
+
+008011f8 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8011f8:	55                   	push   %ebp
+  8011f9:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8011fb:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801200:	eb 02                	jmp    801204 <fd_alloc+0xc>
+  801202:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801204:	89 c2                	mov    %eax,%edx
+  801206:	c1 ea 16             	shr    $0x16,%edx
+  801209:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801210:	f6 c2 01             	test   $0x1,%dl
+  801213:	74 2b                	je     801240 <fd_alloc+0x48>
+  801215:	89 c2                	mov    %eax,%edx
+  801217:	c1 ea 0c             	shr    $0xc,%edx
+  80121a:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801221:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801227:	f6 c1 01             	test   $0x1,%cl
+  80122a:	74 14                	je     801240 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80122c:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801232:	75 ce                	jne    801202 <fd_alloc+0xa>
+  801234:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801239:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80123e:	eb 05                	jmp    801245 <fd_alloc+0x4d>
+			return 0;
+  801240:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801245:	8b 55 08             	mov    0x8(%ebp),%edx
+  801248:	89 02                	mov    %eax,(%edx)
+}
+  80124a:	89 c8                	mov    %ecx,%eax
+  80124c:	5d                   	pop    %ebp
+  80124d:	c3                   	ret
+
+0080124e <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80124e:	55                   	push   %ebp
+  80124f:	89 e5                	mov    %esp,%ebp
+  801251:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801254:	83 f8 1f             	cmp    $0x1f,%eax
+  801257:	77 30                	ja     801289 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801259:	c1 e0 0c             	shl    $0xc,%eax
+  80125c:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801261:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801267:	f6 c2 01             	test   $0x1,%dl
+  80126a:	74 24                	je     801290 <fd_lookup+0x42>
+  80126c:	89 c2                	mov    %eax,%edx
+  80126e:	c1 ea 0c             	shr    $0xc,%edx
+  801271:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801278:	f6 c2 01             	test   $0x1,%dl
+  80127b:	74 1a                	je     801297 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80127d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801280:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801282:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801287:	5d                   	pop    %ebp
+  801288:	c3                   	ret
+		return -E_INVAL;
+  801289:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80128e:	eb f7                	jmp    801287 <fd_lookup+0x39>
+		return -E_INVAL;
+  801290:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801295:	eb f0                	jmp    801287 <fd_lookup+0x39>
+  801297:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80129c:	eb e9                	jmp    801287 <fd_lookup+0x39>
+
+0080129e <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80129e:	55                   	push   %ebp
+  80129f:	89 e5                	mov    %esp,%ebp
+  8012a1:	53                   	push   %ebx
+  8012a2:	83 ec 04             	sub    $0x4,%esp
+  8012a5:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8012a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012ad:	eb 03                	jmp    8012b2 <dev_lookup+0x14>
+  8012af:	83 c0 01             	add    $0x1,%eax
+  8012b2:	8b 1c 85 4c 2e 80 00 	mov    0x802e4c(,%eax,4),%ebx
+  8012b9:	85 db                	test   %ebx,%ebx
+  8012bb:	74 0b                	je     8012c8 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8012bd:	39 13                	cmp    %edx,(%ebx)
+  8012bf:	75 ee                	jne    8012af <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8012c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012c6:	eb 1f                	jmp    8012e7 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8012c8:	a1 20 44 80 00       	mov    0x804420,%eax
+  8012cd:	8b 40 48             	mov    0x48(%eax),%eax
+  8012d0:	83 ec 04             	sub    $0x4,%esp
+  8012d3:	52                   	push   %edx
+  8012d4:	50                   	push   %eax
+  8012d5:	68 d0 2d 80 00       	push   $0x802dd0
+  8012da:	e8 2b f1 ff ff       	call   80040a <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8012df:	83 c4 10             	add    $0x10,%esp
+  8012e2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8012e7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012ea:	89 1a                	mov    %ebx,(%edx)
+}
+  8012ec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012ef:	c9                   	leave
+  8012f0:	c3                   	ret
+
+008012f1 <fd_close>:
+{
+  8012f1:	55                   	push   %ebp
+  8012f2:	89 e5                	mov    %esp,%ebp
+  8012f4:	57                   	push   %edi
+  8012f5:	56                   	push   %esi
+  8012f6:	53                   	push   %ebx
+  8012f7:	83 ec 24             	sub    $0x24,%esp
+  8012fa:	8b 75 08             	mov    0x8(%ebp),%esi
+  8012fd:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801300:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801303:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801304:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80130a:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80130d:	50                   	push   %eax
+  80130e:	e8 3b ff ff ff       	call   80124e <fd_lookup>
+  801313:	89 c3                	mov    %eax,%ebx
+  801315:	83 c4 10             	add    $0x10,%esp
+  801318:	85 c0                	test   %eax,%eax
+  80131a:	78 05                	js     801321 <fd_close+0x30>
+	    || fd != fd2)
+  80131c:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80131f:	74 16                	je     801337 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801321:	89 f8                	mov    %edi,%eax
+  801323:	84 c0                	test   %al,%al
+  801325:	b8 00 00 00 00       	mov    $0x0,%eax
+  80132a:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80132d:	89 d8                	mov    %ebx,%eax
+  80132f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801332:	5b                   	pop    %ebx
+  801333:	5e                   	pop    %esi
+  801334:	5f                   	pop    %edi
+  801335:	5d                   	pop    %ebp
+  801336:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801337:	83 ec 08             	sub    $0x8,%esp
+  80133a:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80133d:	50                   	push   %eax
+  80133e:	ff 36                	push   (%esi)
+  801340:	e8 59 ff ff ff       	call   80129e <dev_lookup>
+  801345:	89 c3                	mov    %eax,%ebx
+  801347:	83 c4 10             	add    $0x10,%esp
+  80134a:	85 c0                	test   %eax,%eax
+  80134c:	78 1a                	js     801368 <fd_close+0x77>
+		if (dev->dev_close)
+  80134e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801351:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801354:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801359:	85 c0                	test   %eax,%eax
+  80135b:	74 0b                	je     801368 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80135d:	83 ec 0c             	sub    $0xc,%esp
+  801360:	56                   	push   %esi
+  801361:	ff d0                	call   *%eax
+  801363:	89 c3                	mov    %eax,%ebx
+  801365:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801368:	83 ec 08             	sub    $0x8,%esp
+  80136b:	56                   	push   %esi
+  80136c:	6a 00                	push   $0x0
+  80136e:	e8 c1 fa ff ff       	call   800e34 <sys_page_unmap>
+	return r;
+  801373:	83 c4 10             	add    $0x10,%esp
+  801376:	eb b5                	jmp    80132d <fd_close+0x3c>
+
+00801378 <close>:
+
+int
+close(int fdnum)
+{
+  801378:	55                   	push   %ebp
+  801379:	89 e5                	mov    %esp,%ebp
+  80137b:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80137e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801381:	50                   	push   %eax
+  801382:	ff 75 08             	push   0x8(%ebp)
+  801385:	e8 c4 fe ff ff       	call   80124e <fd_lookup>
+  80138a:	83 c4 10             	add    $0x10,%esp
+  80138d:	85 c0                	test   %eax,%eax
+  80138f:	79 02                	jns    801393 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801391:	c9                   	leave
+  801392:	c3                   	ret
+		return fd_close(fd, 1);
+  801393:	83 ec 08             	sub    $0x8,%esp
+  801396:	6a 01                	push   $0x1
+  801398:	ff 75 f4             	push   -0xc(%ebp)
+  80139b:	e8 51 ff ff ff       	call   8012f1 <fd_close>
+  8013a0:	83 c4 10             	add    $0x10,%esp
+  8013a3:	eb ec                	jmp    801391 <close+0x19>
+
+008013a5 <close_all>:
+
+void
+close_all(void)
+{
+  8013a5:	55                   	push   %ebp
+  8013a6:	89 e5                	mov    %esp,%ebp
+  8013a8:	53                   	push   %ebx
+  8013a9:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8013ac:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8013b1:	83 ec 0c             	sub    $0xc,%esp
+  8013b4:	53                   	push   %ebx
+  8013b5:	e8 be ff ff ff       	call   801378 <close>
+	for (i = 0; i < MAXFD; i++)
+  8013ba:	83 c3 01             	add    $0x1,%ebx
+  8013bd:	83 c4 10             	add    $0x10,%esp
+  8013c0:	83 fb 20             	cmp    $0x20,%ebx
+  8013c3:	75 ec                	jne    8013b1 <close_all+0xc>
+}
+  8013c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013c8:	c9                   	leave
+  8013c9:	c3                   	ret
+
+008013ca <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8013ca:	55                   	push   %ebp
+  8013cb:	89 e5                	mov    %esp,%ebp
+  8013cd:	57                   	push   %edi
+  8013ce:	56                   	push   %esi
+  8013cf:	53                   	push   %ebx
+  8013d0:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8013d3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8013d6:	50                   	push   %eax
+  8013d7:	ff 75 08             	push   0x8(%ebp)
+  8013da:	e8 6f fe ff ff       	call   80124e <fd_lookup>
+  8013df:	89 c3                	mov    %eax,%ebx
+  8013e1:	83 c4 10             	add    $0x10,%esp
+  8013e4:	85 c0                	test   %eax,%eax
+  8013e6:	78 7f                	js     801467 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8013e8:	83 ec 0c             	sub    $0xc,%esp
+  8013eb:	ff 75 0c             	push   0xc(%ebp)
+  8013ee:	e8 85 ff ff ff       	call   801378 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8013f3:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8013f6:	c1 e6 0c             	shl    $0xc,%esi
+  8013f9:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8013ff:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801402:	89 3c 24             	mov    %edi,(%esp)
+  801405:	e8 d7 fd ff ff       	call   8011e1 <fd2data>
+  80140a:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80140c:	89 34 24             	mov    %esi,(%esp)
+  80140f:	e8 cd fd ff ff       	call   8011e1 <fd2data>
+  801414:	83 c4 10             	add    $0x10,%esp
+  801417:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80141a:	89 d8                	mov    %ebx,%eax
+  80141c:	c1 e8 16             	shr    $0x16,%eax
+  80141f:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801426:	a8 01                	test   $0x1,%al
+  801428:	74 11                	je     80143b <dup+0x71>
+  80142a:	89 d8                	mov    %ebx,%eax
+  80142c:	c1 e8 0c             	shr    $0xc,%eax
+  80142f:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801436:	f6 c2 01             	test   $0x1,%dl
+  801439:	75 36                	jne    801471 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80143b:	89 f8                	mov    %edi,%eax
+  80143d:	c1 e8 0c             	shr    $0xc,%eax
+  801440:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801447:	83 ec 0c             	sub    $0xc,%esp
+  80144a:	25 07 0e 00 00       	and    $0xe07,%eax
+  80144f:	50                   	push   %eax
+  801450:	56                   	push   %esi
+  801451:	6a 00                	push   $0x0
+  801453:	57                   	push   %edi
+  801454:	6a 00                	push   $0x0
+  801456:	e8 97 f9 ff ff       	call   800df2 <sys_page_map>
+  80145b:	89 c3                	mov    %eax,%ebx
+  80145d:	83 c4 20             	add    $0x20,%esp
+  801460:	85 c0                	test   %eax,%eax
+  801462:	78 33                	js     801497 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801464:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801467:	89 d8                	mov    %ebx,%eax
+  801469:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80146c:	5b                   	pop    %ebx
+  80146d:	5e                   	pop    %esi
+  80146e:	5f                   	pop    %edi
+  80146f:	5d                   	pop    %ebp
+  801470:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801471:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801478:	83 ec 0c             	sub    $0xc,%esp
+  80147b:	25 07 0e 00 00       	and    $0xe07,%eax
+  801480:	50                   	push   %eax
+  801481:	ff 75 d4             	push   -0x2c(%ebp)
+  801484:	6a 00                	push   $0x0
+  801486:	53                   	push   %ebx
+  801487:	6a 00                	push   $0x0
+  801489:	e8 64 f9 ff ff       	call   800df2 <sys_page_map>
+  80148e:	89 c3                	mov    %eax,%ebx
+  801490:	83 c4 20             	add    $0x20,%esp
+  801493:	85 c0                	test   %eax,%eax
+  801495:	79 a4                	jns    80143b <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801497:	83 ec 08             	sub    $0x8,%esp
+  80149a:	56                   	push   %esi
+  80149b:	6a 00                	push   $0x0
+  80149d:	e8 92 f9 ff ff       	call   800e34 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8014a2:	83 c4 08             	add    $0x8,%esp
+  8014a5:	ff 75 d4             	push   -0x2c(%ebp)
+  8014a8:	6a 00                	push   $0x0
+  8014aa:	e8 85 f9 ff ff       	call   800e34 <sys_page_unmap>
+	return r;
+  8014af:	83 c4 10             	add    $0x10,%esp
+  8014b2:	eb b3                	jmp    801467 <dup+0x9d>
+
+008014b4 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8014b4:	55                   	push   %ebp
+  8014b5:	89 e5                	mov    %esp,%ebp
+  8014b7:	56                   	push   %esi
+  8014b8:	53                   	push   %ebx
+  8014b9:	83 ec 18             	sub    $0x18,%esp
+  8014bc:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8014bf:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8014c2:	50                   	push   %eax
+  8014c3:	56                   	push   %esi
+  8014c4:	e8 85 fd ff ff       	call   80124e <fd_lookup>
+  8014c9:	83 c4 10             	add    $0x10,%esp
+  8014cc:	85 c0                	test   %eax,%eax
+  8014ce:	78 3c                	js     80150c <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8014d0:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8014d3:	83 ec 08             	sub    $0x8,%esp
+  8014d6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014d9:	50                   	push   %eax
+  8014da:	ff 33                	push   (%ebx)
+  8014dc:	e8 bd fd ff ff       	call   80129e <dev_lookup>
+  8014e1:	83 c4 10             	add    $0x10,%esp
+  8014e4:	85 c0                	test   %eax,%eax
+  8014e6:	78 24                	js     80150c <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8014e8:	8b 43 08             	mov    0x8(%ebx),%eax
+  8014eb:	83 e0 03             	and    $0x3,%eax
+  8014ee:	83 f8 01             	cmp    $0x1,%eax
+  8014f1:	74 20                	je     801513 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8014f3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014f6:	8b 40 08             	mov    0x8(%eax),%eax
+  8014f9:	85 c0                	test   %eax,%eax
+  8014fb:	74 37                	je     801534 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8014fd:	83 ec 04             	sub    $0x4,%esp
+  801500:	ff 75 10             	push   0x10(%ebp)
+  801503:	ff 75 0c             	push   0xc(%ebp)
+  801506:	53                   	push   %ebx
+  801507:	ff d0                	call   *%eax
+  801509:	83 c4 10             	add    $0x10,%esp
+}
+  80150c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80150f:	5b                   	pop    %ebx
+  801510:	5e                   	pop    %esi
+  801511:	5d                   	pop    %ebp
+  801512:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801513:	a1 20 44 80 00       	mov    0x804420,%eax
+  801518:	8b 40 48             	mov    0x48(%eax),%eax
+  80151b:	83 ec 04             	sub    $0x4,%esp
+  80151e:	56                   	push   %esi
+  80151f:	50                   	push   %eax
+  801520:	68 11 2e 80 00       	push   $0x802e11
+  801525:	e8 e0 ee ff ff       	call   80040a <cprintf>
+		return -E_INVAL;
+  80152a:	83 c4 10             	add    $0x10,%esp
+  80152d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801532:	eb d8                	jmp    80150c <read+0x58>
+		return -E_NOT_SUPP;
+  801534:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801539:	eb d1                	jmp    80150c <read+0x58>
+
+0080153b <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80153b:	55                   	push   %ebp
+  80153c:	89 e5                	mov    %esp,%ebp
+  80153e:	57                   	push   %edi
+  80153f:	56                   	push   %esi
+  801540:	53                   	push   %ebx
+  801541:	83 ec 0c             	sub    $0xc,%esp
+  801544:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801547:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80154a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80154f:	eb 02                	jmp    801553 <readn+0x18>
+  801551:	01 c3                	add    %eax,%ebx
+  801553:	39 f3                	cmp    %esi,%ebx
+  801555:	73 21                	jae    801578 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801557:	83 ec 04             	sub    $0x4,%esp
+  80155a:	89 f0                	mov    %esi,%eax
+  80155c:	29 d8                	sub    %ebx,%eax
+  80155e:	50                   	push   %eax
+  80155f:	89 d8                	mov    %ebx,%eax
+  801561:	03 45 0c             	add    0xc(%ebp),%eax
+  801564:	50                   	push   %eax
+  801565:	57                   	push   %edi
+  801566:	e8 49 ff ff ff       	call   8014b4 <read>
+		if (m < 0)
+  80156b:	83 c4 10             	add    $0x10,%esp
+  80156e:	85 c0                	test   %eax,%eax
+  801570:	78 04                	js     801576 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801572:	75 dd                	jne    801551 <readn+0x16>
+  801574:	eb 02                	jmp    801578 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801576:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801578:	89 d8                	mov    %ebx,%eax
+  80157a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80157d:	5b                   	pop    %ebx
+  80157e:	5e                   	pop    %esi
+  80157f:	5f                   	pop    %edi
+  801580:	5d                   	pop    %ebp
+  801581:	c3                   	ret
+
+00801582 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801582:	55                   	push   %ebp
+  801583:	89 e5                	mov    %esp,%ebp
+  801585:	56                   	push   %esi
+  801586:	53                   	push   %ebx
+  801587:	83 ec 18             	sub    $0x18,%esp
+  80158a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80158d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801590:	50                   	push   %eax
+  801591:	53                   	push   %ebx
+  801592:	e8 b7 fc ff ff       	call   80124e <fd_lookup>
+  801597:	83 c4 10             	add    $0x10,%esp
+  80159a:	85 c0                	test   %eax,%eax
+  80159c:	78 37                	js     8015d5 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80159e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8015a1:	83 ec 08             	sub    $0x8,%esp
+  8015a4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015a7:	50                   	push   %eax
+  8015a8:	ff 36                	push   (%esi)
+  8015aa:	e8 ef fc ff ff       	call   80129e <dev_lookup>
+  8015af:	83 c4 10             	add    $0x10,%esp
+  8015b2:	85 c0                	test   %eax,%eax
+  8015b4:	78 1f                	js     8015d5 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8015b6:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8015ba:	74 20                	je     8015dc <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8015bc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015bf:	8b 40 0c             	mov    0xc(%eax),%eax
+  8015c2:	85 c0                	test   %eax,%eax
+  8015c4:	74 37                	je     8015fd <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8015c6:	83 ec 04             	sub    $0x4,%esp
+  8015c9:	ff 75 10             	push   0x10(%ebp)
+  8015cc:	ff 75 0c             	push   0xc(%ebp)
+  8015cf:	56                   	push   %esi
+  8015d0:	ff d0                	call   *%eax
+  8015d2:	83 c4 10             	add    $0x10,%esp
+}
+  8015d5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015d8:	5b                   	pop    %ebx
+  8015d9:	5e                   	pop    %esi
+  8015da:	5d                   	pop    %ebp
+  8015db:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8015dc:	a1 20 44 80 00       	mov    0x804420,%eax
+  8015e1:	8b 40 48             	mov    0x48(%eax),%eax
+  8015e4:	83 ec 04             	sub    $0x4,%esp
+  8015e7:	53                   	push   %ebx
+  8015e8:	50                   	push   %eax
+  8015e9:	68 2d 2e 80 00       	push   $0x802e2d
+  8015ee:	e8 17 ee ff ff       	call   80040a <cprintf>
+		return -E_INVAL;
+  8015f3:	83 c4 10             	add    $0x10,%esp
+  8015f6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015fb:	eb d8                	jmp    8015d5 <write+0x53>
+		return -E_NOT_SUPP;
+  8015fd:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801602:	eb d1                	jmp    8015d5 <write+0x53>
+
+00801604 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801604:	55                   	push   %ebp
+  801605:	89 e5                	mov    %esp,%ebp
+  801607:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80160a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80160d:	50                   	push   %eax
+  80160e:	ff 75 08             	push   0x8(%ebp)
+  801611:	e8 38 fc ff ff       	call   80124e <fd_lookup>
+  801616:	83 c4 10             	add    $0x10,%esp
+  801619:	85 c0                	test   %eax,%eax
+  80161b:	78 0e                	js     80162b <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80161d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801620:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801623:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801626:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80162b:	c9                   	leave
+  80162c:	c3                   	ret
+
+0080162d <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80162d:	55                   	push   %ebp
+  80162e:	89 e5                	mov    %esp,%ebp
+  801630:	56                   	push   %esi
+  801631:	53                   	push   %ebx
+  801632:	83 ec 18             	sub    $0x18,%esp
+  801635:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801638:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80163b:	50                   	push   %eax
+  80163c:	53                   	push   %ebx
+  80163d:	e8 0c fc ff ff       	call   80124e <fd_lookup>
+  801642:	83 c4 10             	add    $0x10,%esp
+  801645:	85 c0                	test   %eax,%eax
+  801647:	78 34                	js     80167d <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801649:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80164c:	83 ec 08             	sub    $0x8,%esp
+  80164f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801652:	50                   	push   %eax
+  801653:	ff 36                	push   (%esi)
+  801655:	e8 44 fc ff ff       	call   80129e <dev_lookup>
+  80165a:	83 c4 10             	add    $0x10,%esp
+  80165d:	85 c0                	test   %eax,%eax
+  80165f:	78 1c                	js     80167d <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801661:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801665:	74 1d                	je     801684 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801667:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80166a:	8b 40 18             	mov    0x18(%eax),%eax
+  80166d:	85 c0                	test   %eax,%eax
+  80166f:	74 34                	je     8016a5 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801671:	83 ec 08             	sub    $0x8,%esp
+  801674:	ff 75 0c             	push   0xc(%ebp)
+  801677:	56                   	push   %esi
+  801678:	ff d0                	call   *%eax
+  80167a:	83 c4 10             	add    $0x10,%esp
+}
+  80167d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801680:	5b                   	pop    %ebx
+  801681:	5e                   	pop    %esi
+  801682:	5d                   	pop    %ebp
+  801683:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801684:	a1 20 44 80 00       	mov    0x804420,%eax
+  801689:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80168c:	83 ec 04             	sub    $0x4,%esp
+  80168f:	53                   	push   %ebx
+  801690:	50                   	push   %eax
+  801691:	68 f0 2d 80 00       	push   $0x802df0
+  801696:	e8 6f ed ff ff       	call   80040a <cprintf>
+		return -E_INVAL;
+  80169b:	83 c4 10             	add    $0x10,%esp
+  80169e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016a3:	eb d8                	jmp    80167d <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8016a5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016aa:	eb d1                	jmp    80167d <ftruncate+0x50>
+
+008016ac <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8016ac:	55                   	push   %ebp
+  8016ad:	89 e5                	mov    %esp,%ebp
+  8016af:	56                   	push   %esi
+  8016b0:	53                   	push   %ebx
+  8016b1:	83 ec 18             	sub    $0x18,%esp
+  8016b4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016b7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016ba:	50                   	push   %eax
+  8016bb:	ff 75 08             	push   0x8(%ebp)
+  8016be:	e8 8b fb ff ff       	call   80124e <fd_lookup>
+  8016c3:	83 c4 10             	add    $0x10,%esp
+  8016c6:	85 c0                	test   %eax,%eax
+  8016c8:	78 49                	js     801713 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016ca:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8016cd:	83 ec 08             	sub    $0x8,%esp
+  8016d0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016d3:	50                   	push   %eax
+  8016d4:	ff 36                	push   (%esi)
+  8016d6:	e8 c3 fb ff ff       	call   80129e <dev_lookup>
+  8016db:	83 c4 10             	add    $0x10,%esp
+  8016de:	85 c0                	test   %eax,%eax
+  8016e0:	78 31                	js     801713 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8016e2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016e5:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8016e9:	74 2f                	je     80171a <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8016eb:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8016ee:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8016f5:	00 00 00 
+	stat->st_isdir = 0;
+  8016f8:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8016ff:	00 00 00 
+	stat->st_dev = dev;
+  801702:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801708:	83 ec 08             	sub    $0x8,%esp
+  80170b:	53                   	push   %ebx
+  80170c:	56                   	push   %esi
+  80170d:	ff 50 14             	call   *0x14(%eax)
+  801710:	83 c4 10             	add    $0x10,%esp
+}
+  801713:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801716:	5b                   	pop    %ebx
+  801717:	5e                   	pop    %esi
+  801718:	5d                   	pop    %ebp
+  801719:	c3                   	ret
+		return -E_NOT_SUPP;
+  80171a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80171f:	eb f2                	jmp    801713 <fstat+0x67>
+
+00801721 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801721:	55                   	push   %ebp
+  801722:	89 e5                	mov    %esp,%ebp
+  801724:	56                   	push   %esi
+  801725:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801726:	83 ec 08             	sub    $0x8,%esp
+  801729:	6a 00                	push   $0x0
+  80172b:	ff 75 08             	push   0x8(%ebp)
+  80172e:	e8 e4 01 00 00       	call   801917 <open>
+  801733:	89 c3                	mov    %eax,%ebx
+  801735:	83 c4 10             	add    $0x10,%esp
+  801738:	85 c0                	test   %eax,%eax
+  80173a:	78 1b                	js     801757 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80173c:	83 ec 08             	sub    $0x8,%esp
+  80173f:	ff 75 0c             	push   0xc(%ebp)
+  801742:	50                   	push   %eax
+  801743:	e8 64 ff ff ff       	call   8016ac <fstat>
+  801748:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80174a:	89 1c 24             	mov    %ebx,(%esp)
+  80174d:	e8 26 fc ff ff       	call   801378 <close>
+	return r;
+  801752:	83 c4 10             	add    $0x10,%esp
+  801755:	89 f3                	mov    %esi,%ebx
+}
+  801757:	89 d8                	mov    %ebx,%eax
+  801759:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80175c:	5b                   	pop    %ebx
+  80175d:	5e                   	pop    %esi
+  80175e:	5d                   	pop    %ebp
+  80175f:	c3                   	ret
+
+00801760 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  801760:	55                   	push   %ebp
+  801761:	89 e5                	mov    %esp,%ebp
+  801763:	56                   	push   %esi
+  801764:	53                   	push   %ebx
+  801765:	89 c6                	mov    %eax,%esi
+  801767:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  801769:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  801770:	74 27                	je     801799 <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801772:	6a 07                	push   $0x7
+  801774:	68 00 50 80 00       	push   $0x805000
+  801779:	56                   	push   %esi
+  80177a:	ff 35 00 40 80 00    	push   0x804000
+  801780:	e8 e5 0c 00 00       	call   80246a <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  801785:	83 c4 0c             	add    $0xc,%esp
+  801788:	6a 00                	push   $0x0
+  80178a:	53                   	push   %ebx
+  80178b:	6a 00                	push   $0x0
+  80178d:	e8 64 0c 00 00       	call   8023f6 <ipc_recv>
+}
+  801792:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801795:	5b                   	pop    %ebx
+  801796:	5e                   	pop    %esi
+  801797:	5d                   	pop    %ebp
+  801798:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  801799:	83 ec 0c             	sub    $0xc,%esp
+  80179c:	6a 01                	push   $0x1
+  80179e:	e8 1b 0d 00 00       	call   8024be <ipc_find_env>
+  8017a3:	a3 00 40 80 00       	mov    %eax,0x804000
+  8017a8:	83 c4 10             	add    $0x10,%esp
+  8017ab:	eb c5                	jmp    801772 <fsipc+0x12>
+
+008017ad <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8017ad:	55                   	push   %ebp
+  8017ae:	89 e5                	mov    %esp,%ebp
+  8017b0:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8017b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017b6:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017b9:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.set_size.req_size = newsize;
+  8017be:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8017c1:	a3 04 50 80 00       	mov    %eax,0x805004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  8017c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017cb:	b8 02 00 00 00       	mov    $0x2,%eax
+  8017d0:	e8 8b ff ff ff       	call   801760 <fsipc>
+}
+  8017d5:	c9                   	leave
+  8017d6:	c3                   	ret
+
+008017d7 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8017d7:	55                   	push   %ebp
+  8017d8:	89 e5                	mov    %esp,%ebp
+  8017da:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8017dd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017e0:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017e3:	a3 00 50 80 00       	mov    %eax,0x805000
+  return fsipc(FSREQ_FLUSH, NULL);
+  8017e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017ed:	b8 06 00 00 00       	mov    $0x6,%eax
+  8017f2:	e8 69 ff ff ff       	call   801760 <fsipc>
+}
+  8017f7:	c9                   	leave
+  8017f8:	c3                   	ret
+
+008017f9 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8017f9:	55                   	push   %ebp
+  8017fa:	89 e5                	mov    %esp,%ebp
+  8017fc:	53                   	push   %ebx
+  8017fd:	83 ec 04             	sub    $0x4,%esp
+  801800:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801803:	8b 45 08             	mov    0x8(%ebp),%eax
+  801806:	8b 40 0c             	mov    0xc(%eax),%eax
+  801809:	a3 00 50 80 00       	mov    %eax,0x805000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80180e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801813:	b8 05 00 00 00       	mov    $0x5,%eax
+  801818:	e8 43 ff ff ff       	call   801760 <fsipc>
+  80181d:	85 c0                	test   %eax,%eax
+  80181f:	78 2c                	js     80184d <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801821:	83 ec 08             	sub    $0x8,%esp
+  801824:	68 00 50 80 00       	push   $0x805000
+  801829:	53                   	push   %ebx
+  80182a:	e8 94 f1 ff ff       	call   8009c3 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  80182f:	a1 80 50 80 00       	mov    0x805080,%eax
+  801834:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80183a:	a1 84 50 80 00       	mov    0x805084,%eax
+  80183f:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801845:	83 c4 10             	add    $0x10,%esp
+  801848:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80184d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801850:	c9                   	leave
+  801851:	c3                   	ret
+
+00801852 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801852:	55                   	push   %ebp
+  801853:	89 e5                	mov    %esp,%ebp
+  801855:	83 ec 0c             	sub    $0xc,%esp
+  801858:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80185b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80185e:	8b 52 0c             	mov    0xc(%edx),%edx
+  801861:	89 15 00 50 80 00    	mov    %edx,0x805000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801867:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  80186c:	39 d0                	cmp    %edx,%eax
+  80186e:	0f 47 c2             	cmova  %edx,%eax
+  801871:	a3 04 50 80 00       	mov    %eax,0x805004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  801876:	50                   	push   %eax
+  801877:	ff 75 0c             	push   0xc(%ebp)
+  80187a:	68 08 50 80 00       	push   $0x805008
+  80187f:	e8 c5 f2 ff ff       	call   800b49 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801884:	ba 00 00 00 00       	mov    $0x0,%edx
+  801889:	b8 04 00 00 00       	mov    $0x4,%eax
+  80188e:	e8 cd fe ff ff       	call   801760 <fsipc>
+}
+  801893:	c9                   	leave
+  801894:	c3                   	ret
+
+00801895 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801895:	55                   	push   %ebp
+  801896:	89 e5                	mov    %esp,%ebp
+  801898:	56                   	push   %esi
+  801899:	53                   	push   %ebx
+  80189a:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80189d:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018a0:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018a3:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.read.req_n = n;
+  8018a8:	89 35 04 50 80 00    	mov    %esi,0x805004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8018ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018b3:	b8 03 00 00 00       	mov    $0x3,%eax
+  8018b8:	e8 a3 fe ff ff       	call   801760 <fsipc>
+  8018bd:	89 c3                	mov    %eax,%ebx
+  8018bf:	85 c0                	test   %eax,%eax
+  8018c1:	78 1f                	js     8018e2 <devfile_read+0x4d>
+  assert(r <= n);
+  8018c3:	39 c6                	cmp    %eax,%esi
+  8018c5:	72 24                	jb     8018eb <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  8018c7:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8018cc:	7f 33                	jg     801901 <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8018ce:	83 ec 04             	sub    $0x4,%esp
+  8018d1:	50                   	push   %eax
+  8018d2:	68 00 50 80 00       	push   $0x805000
+  8018d7:	ff 75 0c             	push   0xc(%ebp)
+  8018da:	e8 6a f2 ff ff       	call   800b49 <memmove>
+  return r;
+  8018df:	83 c4 10             	add    $0x10,%esp
+}
+  8018e2:	89 d8                	mov    %ebx,%eax
+  8018e4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018e7:	5b                   	pop    %ebx
+  8018e8:	5e                   	pop    %esi
+  8018e9:	5d                   	pop    %ebp
+  8018ea:	c3                   	ret
+  assert(r <= n);
+  8018eb:	68 60 2e 80 00       	push   $0x802e60
+  8018f0:	68 67 2e 80 00       	push   $0x802e67
+  8018f5:	6a 78                	push   $0x78
+  8018f7:	68 7c 2e 80 00       	push   $0x802e7c
+  8018fc:	e8 2e ea ff ff       	call   80032f <_panic>
+  assert(r <= PGSIZE);
+  801901:	68 87 2e 80 00       	push   $0x802e87
+  801906:	68 67 2e 80 00       	push   $0x802e67
+  80190b:	6a 79                	push   $0x79
+  80190d:	68 7c 2e 80 00       	push   $0x802e7c
+  801912:	e8 18 ea ff ff       	call   80032f <_panic>
+
+00801917 <open>:
+open(const char *path, int mode) {
+  801917:	55                   	push   %ebp
+  801918:	89 e5                	mov    %esp,%ebp
+  80191a:	56                   	push   %esi
+  80191b:	53                   	push   %ebx
+  80191c:	83 ec 1c             	sub    $0x1c,%esp
+  80191f:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801922:	56                   	push   %esi
+  801923:	e8 60 f0 ff ff       	call   800988 <strlen>
+  801928:	83 c4 10             	add    $0x10,%esp
+  80192b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801930:	7f 6c                	jg     80199e <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801932:	83 ec 0c             	sub    $0xc,%esp
+  801935:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801938:	50                   	push   %eax
+  801939:	e8 ba f8 ff ff       	call   8011f8 <fd_alloc>
+  80193e:	89 c3                	mov    %eax,%ebx
+  801940:	83 c4 10             	add    $0x10,%esp
+  801943:	85 c0                	test   %eax,%eax
+  801945:	78 3c                	js     801983 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801947:	83 ec 08             	sub    $0x8,%esp
+  80194a:	56                   	push   %esi
+  80194b:	68 00 50 80 00       	push   $0x805000
+  801950:	e8 6e f0 ff ff       	call   8009c3 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801955:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801958:	a3 00 54 80 00       	mov    %eax,0x805400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80195d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801960:	b8 01 00 00 00       	mov    $0x1,%eax
+  801965:	e8 f6 fd ff ff       	call   801760 <fsipc>
+  80196a:	89 c3                	mov    %eax,%ebx
+  80196c:	83 c4 10             	add    $0x10,%esp
+  80196f:	85 c0                	test   %eax,%eax
+  801971:	78 19                	js     80198c <open+0x75>
+  return fd2num(fd);
+  801973:	83 ec 0c             	sub    $0xc,%esp
+  801976:	ff 75 f4             	push   -0xc(%ebp)
+  801979:	e8 53 f8 ff ff       	call   8011d1 <fd2num>
+  80197e:	89 c3                	mov    %eax,%ebx
+  801980:	83 c4 10             	add    $0x10,%esp
+}
+  801983:	89 d8                	mov    %ebx,%eax
+  801985:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801988:	5b                   	pop    %ebx
+  801989:	5e                   	pop    %esi
+  80198a:	5d                   	pop    %ebp
+  80198b:	c3                   	ret
+    fd_close(fd, 0);
+  80198c:	83 ec 08             	sub    $0x8,%esp
+  80198f:	6a 00                	push   $0x0
+  801991:	ff 75 f4             	push   -0xc(%ebp)
+  801994:	e8 58 f9 ff ff       	call   8012f1 <fd_close>
+    return r;
+  801999:	83 c4 10             	add    $0x10,%esp
+  80199c:	eb e5                	jmp    801983 <open+0x6c>
+    return -E_BAD_PATH;
+  80199e:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8019a3:	eb de                	jmp    801983 <open+0x6c>
+
+008019a5 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  8019a5:	55                   	push   %ebp
+  8019a6:	89 e5                	mov    %esp,%ebp
+  8019a8:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  8019ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019b0:	b8 08 00 00 00       	mov    $0x8,%eax
+  8019b5:	e8 a6 fd ff ff       	call   801760 <fsipc>
+}
+  8019ba:	c9                   	leave
+  8019bb:	c3                   	ret
+
+008019bc <writebuf>:
+
+
+static void
+writebuf(struct printbuf *b)
+{
+	if (b->error > 0) {
+  8019bc:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8019c0:	7f 01                	jg     8019c3 <writebuf+0x7>
+  8019c2:	c3                   	ret
+{
+  8019c3:	55                   	push   %ebp
+  8019c4:	89 e5                	mov    %esp,%ebp
+  8019c6:	53                   	push   %ebx
+  8019c7:	83 ec 08             	sub    $0x8,%esp
+  8019ca:	89 c3                	mov    %eax,%ebx
+		ssize_t result = write(b->fd, b->buf, b->idx);
+  8019cc:	ff 70 04             	push   0x4(%eax)
+  8019cf:	8d 40 10             	lea    0x10(%eax),%eax
+  8019d2:	50                   	push   %eax
+  8019d3:	ff 33                	push   (%ebx)
+  8019d5:	e8 a8 fb ff ff       	call   801582 <write>
+		if (result > 0)
+  8019da:	83 c4 10             	add    $0x10,%esp
+  8019dd:	85 c0                	test   %eax,%eax
+  8019df:	7e 03                	jle    8019e4 <writebuf+0x28>
+			b->result += result;
+  8019e1:	01 43 08             	add    %eax,0x8(%ebx)
+		if (result != b->idx) // error, or wrote less than supplied
+  8019e4:	39 43 04             	cmp    %eax,0x4(%ebx)
+  8019e7:	74 0d                	je     8019f6 <writebuf+0x3a>
+			b->error = (result < 0 ? result : 0);
+  8019e9:	85 c0                	test   %eax,%eax
+  8019eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019f0:	0f 4f c2             	cmovg  %edx,%eax
+  8019f3:	89 43 0c             	mov    %eax,0xc(%ebx)
+	}
+}
+  8019f6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019f9:	c9                   	leave
+  8019fa:	c3                   	ret
+
+008019fb <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  8019fb:	55                   	push   %ebp
+  8019fc:	89 e5                	mov    %esp,%ebp
+  8019fe:	53                   	push   %ebx
+  8019ff:	83 ec 04             	sub    $0x4,%esp
+  801a02:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct printbuf *b = (struct printbuf *) thunk;
+	b->buf[b->idx++] = ch;
+  801a05:	8b 53 04             	mov    0x4(%ebx),%edx
+  801a08:	8d 42 01             	lea    0x1(%edx),%eax
+  801a0b:	89 43 04             	mov    %eax,0x4(%ebx)
+  801a0e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801a11:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+	if (b->idx == 256) {
+  801a15:	3d 00 01 00 00       	cmp    $0x100,%eax
+  801a1a:	74 05                	je     801a21 <putch+0x26>
+		writebuf(b);
+		b->idx = 0;
+	}
+}
+  801a1c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a1f:	c9                   	leave
+  801a20:	c3                   	ret
+		writebuf(b);
+  801a21:	89 d8                	mov    %ebx,%eax
+  801a23:	e8 94 ff ff ff       	call   8019bc <writebuf>
+		b->idx = 0;
+  801a28:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+  801a2f:	eb eb                	jmp    801a1c <putch+0x21>
+
+00801a31 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  801a31:	55                   	push   %ebp
+  801a32:	89 e5                	mov    %esp,%ebp
+  801a34:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.fd = fd;
+  801a3a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a3d:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+	b.idx = 0;
+  801a43:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  801a4a:	00 00 00 
+	b.result = 0;
+  801a4d:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  801a54:	00 00 00 
+	b.error = 1;
+  801a57:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  801a5e:	00 00 00 
+	vprintfmt(putch, &b, fmt, ap);
+  801a61:	ff 75 10             	push   0x10(%ebp)
+  801a64:	ff 75 0c             	push   0xc(%ebp)
+  801a67:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  801a6d:	50                   	push   %eax
+  801a6e:	68 fb 19 80 00       	push   $0x8019fb
+  801a73:	e8 89 ea ff ff       	call   800501 <vprintfmt>
+	if (b.idx > 0)
+  801a78:	83 c4 10             	add    $0x10,%esp
+  801a7b:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  801a82:	7f 12                	jg     801a96 <vfprintf+0x65>
+		writebuf(&b);
+
+	return (b.result ? b.result : b.error);
+  801a84:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  801a8a:	85 c0                	test   %eax,%eax
+  801a8c:	75 06                	jne    801a94 <vfprintf+0x63>
+  801a8e:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  801a94:	c9                   	leave
+  801a95:	c3                   	ret
+		writebuf(&b);
+  801a96:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  801a9c:	e8 1b ff ff ff       	call   8019bc <writebuf>
+  801aa1:	eb e1                	jmp    801a84 <vfprintf+0x53>
+
+00801aa3 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  801aa3:	55                   	push   %ebp
+  801aa4:	89 e5                	mov    %esp,%ebp
+  801aa6:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  801aa9:	8d 45 10             	lea    0x10(%ebp),%eax
+	cnt = vfprintf(fd, fmt, ap);
+  801aac:	50                   	push   %eax
+  801aad:	ff 75 0c             	push   0xc(%ebp)
+  801ab0:	ff 75 08             	push   0x8(%ebp)
+  801ab3:	e8 79 ff ff ff       	call   801a31 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  801ab8:	c9                   	leave
+  801ab9:	c3                   	ret
+
+00801aba <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  801aba:	55                   	push   %ebp
+  801abb:	89 e5                	mov    %esp,%ebp
+  801abd:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  801ac0:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vfprintf(1, fmt, ap);
+  801ac3:	50                   	push   %eax
+  801ac4:	ff 75 08             	push   0x8(%ebp)
+  801ac7:	6a 01                	push   $0x1
+  801ac9:	e8 63 ff ff ff       	call   801a31 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  801ace:	c9                   	leave
+  801acf:	c3                   	ret
+
+00801ad0 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801ad0:	55                   	push   %ebp
+  801ad1:	89 e5                	mov    %esp,%ebp
+  801ad3:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801ad6:	68 93 2e 80 00       	push   $0x802e93
+  801adb:	ff 75 0c             	push   0xc(%ebp)
+  801ade:	e8 e0 ee ff ff       	call   8009c3 <strcpy>
+	return 0;
+}
+  801ae3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ae8:	c9                   	leave
+  801ae9:	c3                   	ret
+
+00801aea <devsock_close>:
+{
+  801aea:	55                   	push   %ebp
+  801aeb:	89 e5                	mov    %esp,%ebp
+  801aed:	53                   	push   %ebx
+  801aee:	83 ec 10             	sub    $0x10,%esp
+  801af1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801af4:	53                   	push   %ebx
+  801af5:	e8 03 0a 00 00       	call   8024fd <pageref>
+  801afa:	89 c2                	mov    %eax,%edx
+  801afc:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801aff:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801b04:	83 fa 01             	cmp    $0x1,%edx
+  801b07:	74 05                	je     801b0e <devsock_close+0x24>
+}
+  801b09:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b0c:	c9                   	leave
+  801b0d:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801b0e:	83 ec 0c             	sub    $0xc,%esp
+  801b11:	ff 73 0c             	push   0xc(%ebx)
+  801b14:	e8 b7 02 00 00       	call   801dd0 <nsipc_close>
+  801b19:	83 c4 10             	add    $0x10,%esp
+  801b1c:	eb eb                	jmp    801b09 <devsock_close+0x1f>
+
+00801b1e <devsock_write>:
+{
+  801b1e:	55                   	push   %ebp
+  801b1f:	89 e5                	mov    %esp,%ebp
+  801b21:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801b24:	6a 00                	push   $0x0
+  801b26:	ff 75 10             	push   0x10(%ebp)
+  801b29:	ff 75 0c             	push   0xc(%ebp)
+  801b2c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b2f:	ff 70 0c             	push   0xc(%eax)
+  801b32:	e8 79 03 00 00       	call   801eb0 <nsipc_send>
+}
+  801b37:	c9                   	leave
+  801b38:	c3                   	ret
+
+00801b39 <devsock_read>:
+{
+  801b39:	55                   	push   %ebp
+  801b3a:	89 e5                	mov    %esp,%ebp
+  801b3c:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801b3f:	6a 00                	push   $0x0
+  801b41:	ff 75 10             	push   0x10(%ebp)
+  801b44:	ff 75 0c             	push   0xc(%ebp)
+  801b47:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b4a:	ff 70 0c             	push   0xc(%eax)
+  801b4d:	e8 ef 02 00 00       	call   801e41 <nsipc_recv>
+}
+  801b52:	c9                   	leave
+  801b53:	c3                   	ret
+
+00801b54 <fd2sockid>:
+{
+  801b54:	55                   	push   %ebp
+  801b55:	89 e5                	mov    %esp,%ebp
+  801b57:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801b5a:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801b5d:	52                   	push   %edx
+  801b5e:	50                   	push   %eax
+  801b5f:	e8 ea f6 ff ff       	call   80124e <fd_lookup>
+  801b64:	83 c4 10             	add    $0x10,%esp
+  801b67:	85 c0                	test   %eax,%eax
+  801b69:	78 10                	js     801b7b <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801b6b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b6e:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  801b74:	39 08                	cmp    %ecx,(%eax)
+  801b76:	75 05                	jne    801b7d <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801b78:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801b7b:	c9                   	leave
+  801b7c:	c3                   	ret
+		return -E_NOT_SUPP;
+  801b7d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b82:	eb f7                	jmp    801b7b <fd2sockid+0x27>
+
+00801b84 <alloc_sockfd>:
+{
+  801b84:	55                   	push   %ebp
+  801b85:	89 e5                	mov    %esp,%ebp
+  801b87:	56                   	push   %esi
+  801b88:	53                   	push   %ebx
+  801b89:	83 ec 1c             	sub    $0x1c,%esp
+  801b8c:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801b8e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b91:	50                   	push   %eax
+  801b92:	e8 61 f6 ff ff       	call   8011f8 <fd_alloc>
+  801b97:	89 c3                	mov    %eax,%ebx
+  801b99:	83 c4 10             	add    $0x10,%esp
+  801b9c:	85 c0                	test   %eax,%eax
+  801b9e:	78 43                	js     801be3 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801ba0:	83 ec 04             	sub    $0x4,%esp
+  801ba3:	68 07 04 00 00       	push   $0x407
+  801ba8:	ff 75 f4             	push   -0xc(%ebp)
+  801bab:	6a 00                	push   $0x0
+  801bad:	e8 fd f1 ff ff       	call   800daf <sys_page_alloc>
+  801bb2:	89 c3                	mov    %eax,%ebx
+  801bb4:	83 c4 10             	add    $0x10,%esp
+  801bb7:	85 c0                	test   %eax,%eax
+  801bb9:	78 28                	js     801be3 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801bbb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bbe:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  801bc4:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801bc6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bc9:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801bd0:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801bd3:	83 ec 0c             	sub    $0xc,%esp
+  801bd6:	50                   	push   %eax
+  801bd7:	e8 f5 f5 ff ff       	call   8011d1 <fd2num>
+  801bdc:	89 c3                	mov    %eax,%ebx
+  801bde:	83 c4 10             	add    $0x10,%esp
+  801be1:	eb 0c                	jmp    801bef <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801be3:	83 ec 0c             	sub    $0xc,%esp
+  801be6:	56                   	push   %esi
+  801be7:	e8 e4 01 00 00       	call   801dd0 <nsipc_close>
+		return r;
+  801bec:	83 c4 10             	add    $0x10,%esp
+}
+  801bef:	89 d8                	mov    %ebx,%eax
+  801bf1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bf4:	5b                   	pop    %ebx
+  801bf5:	5e                   	pop    %esi
+  801bf6:	5d                   	pop    %ebp
+  801bf7:	c3                   	ret
+
+00801bf8 <accept>:
+{
+  801bf8:	55                   	push   %ebp
+  801bf9:	89 e5                	mov    %esp,%ebp
+  801bfb:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801bfe:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c01:	e8 4e ff ff ff       	call   801b54 <fd2sockid>
+  801c06:	85 c0                	test   %eax,%eax
+  801c08:	78 1b                	js     801c25 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801c0a:	83 ec 04             	sub    $0x4,%esp
+  801c0d:	ff 75 10             	push   0x10(%ebp)
+  801c10:	ff 75 0c             	push   0xc(%ebp)
+  801c13:	50                   	push   %eax
+  801c14:	e8 0e 01 00 00       	call   801d27 <nsipc_accept>
+  801c19:	83 c4 10             	add    $0x10,%esp
+  801c1c:	85 c0                	test   %eax,%eax
+  801c1e:	78 05                	js     801c25 <accept+0x2d>
+	return alloc_sockfd(r);
+  801c20:	e8 5f ff ff ff       	call   801b84 <alloc_sockfd>
+}
+  801c25:	c9                   	leave
+  801c26:	c3                   	ret
+
+00801c27 <bind>:
+{
+  801c27:	55                   	push   %ebp
+  801c28:	89 e5                	mov    %esp,%ebp
+  801c2a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801c2d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c30:	e8 1f ff ff ff       	call   801b54 <fd2sockid>
+  801c35:	85 c0                	test   %eax,%eax
+  801c37:	78 12                	js     801c4b <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801c39:	83 ec 04             	sub    $0x4,%esp
+  801c3c:	ff 75 10             	push   0x10(%ebp)
+  801c3f:	ff 75 0c             	push   0xc(%ebp)
+  801c42:	50                   	push   %eax
+  801c43:	e8 31 01 00 00       	call   801d79 <nsipc_bind>
+  801c48:	83 c4 10             	add    $0x10,%esp
+}
+  801c4b:	c9                   	leave
+  801c4c:	c3                   	ret
+
+00801c4d <shutdown>:
+{
+  801c4d:	55                   	push   %ebp
+  801c4e:	89 e5                	mov    %esp,%ebp
+  801c50:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801c53:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c56:	e8 f9 fe ff ff       	call   801b54 <fd2sockid>
+  801c5b:	85 c0                	test   %eax,%eax
+  801c5d:	78 0f                	js     801c6e <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801c5f:	83 ec 08             	sub    $0x8,%esp
+  801c62:	ff 75 0c             	push   0xc(%ebp)
+  801c65:	50                   	push   %eax
+  801c66:	e8 43 01 00 00       	call   801dae <nsipc_shutdown>
+  801c6b:	83 c4 10             	add    $0x10,%esp
+}
+  801c6e:	c9                   	leave
+  801c6f:	c3                   	ret
+
+00801c70 <connect>:
+{
+  801c70:	55                   	push   %ebp
+  801c71:	89 e5                	mov    %esp,%ebp
+  801c73:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801c76:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c79:	e8 d6 fe ff ff       	call   801b54 <fd2sockid>
+  801c7e:	85 c0                	test   %eax,%eax
+  801c80:	78 12                	js     801c94 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801c82:	83 ec 04             	sub    $0x4,%esp
+  801c85:	ff 75 10             	push   0x10(%ebp)
+  801c88:	ff 75 0c             	push   0xc(%ebp)
+  801c8b:	50                   	push   %eax
+  801c8c:	e8 59 01 00 00       	call   801dea <nsipc_connect>
+  801c91:	83 c4 10             	add    $0x10,%esp
+}
+  801c94:	c9                   	leave
+  801c95:	c3                   	ret
+
+00801c96 <listen>:
+{
+  801c96:	55                   	push   %ebp
+  801c97:	89 e5                	mov    %esp,%ebp
+  801c99:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801c9c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c9f:	e8 b0 fe ff ff       	call   801b54 <fd2sockid>
+  801ca4:	85 c0                	test   %eax,%eax
+  801ca6:	78 0f                	js     801cb7 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801ca8:	83 ec 08             	sub    $0x8,%esp
+  801cab:	ff 75 0c             	push   0xc(%ebp)
+  801cae:	50                   	push   %eax
+  801caf:	e8 6b 01 00 00       	call   801e1f <nsipc_listen>
+  801cb4:	83 c4 10             	add    $0x10,%esp
+}
+  801cb7:	c9                   	leave
+  801cb8:	c3                   	ret
+
+00801cb9 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801cb9:	55                   	push   %ebp
+  801cba:	89 e5                	mov    %esp,%ebp
+  801cbc:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801cbf:	ff 75 10             	push   0x10(%ebp)
+  801cc2:	ff 75 0c             	push   0xc(%ebp)
+  801cc5:	ff 75 08             	push   0x8(%ebp)
+  801cc8:	e8 41 02 00 00       	call   801f0e <nsipc_socket>
+  801ccd:	83 c4 10             	add    $0x10,%esp
+  801cd0:	85 c0                	test   %eax,%eax
+  801cd2:	78 05                	js     801cd9 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801cd4:	e8 ab fe ff ff       	call   801b84 <alloc_sockfd>
+}
+  801cd9:	c9                   	leave
+  801cda:	c3                   	ret
+
+00801cdb <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801cdb:	55                   	push   %ebp
+  801cdc:	89 e5                	mov    %esp,%ebp
+  801cde:	53                   	push   %ebx
+  801cdf:	83 ec 04             	sub    $0x4,%esp
+  801ce2:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801ce4:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801ceb:	74 26                	je     801d13 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801ced:	6a 07                	push   $0x7
+  801cef:	68 00 60 80 00       	push   $0x806000
+  801cf4:	53                   	push   %ebx
+  801cf5:	ff 35 04 40 80 00    	push   0x804004
+  801cfb:	e8 6a 07 00 00       	call   80246a <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801d00:	83 c4 0c             	add    $0xc,%esp
+  801d03:	6a 00                	push   $0x0
+  801d05:	6a 00                	push   $0x0
+  801d07:	6a 00                	push   $0x0
+  801d09:	e8 e8 06 00 00       	call   8023f6 <ipc_recv>
+}
+  801d0e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d11:	c9                   	leave
+  801d12:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801d13:	83 ec 0c             	sub    $0xc,%esp
+  801d16:	6a 02                	push   $0x2
+  801d18:	e8 a1 07 00 00       	call   8024be <ipc_find_env>
+  801d1d:	a3 04 40 80 00       	mov    %eax,0x804004
+  801d22:	83 c4 10             	add    $0x10,%esp
+  801d25:	eb c6                	jmp    801ced <nsipc+0x12>
+
+00801d27 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801d27:	55                   	push   %ebp
+  801d28:	89 e5                	mov    %esp,%ebp
+  801d2a:	56                   	push   %esi
+  801d2b:	53                   	push   %ebx
+  801d2c:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801d2f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d32:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801d37:	8b 06                	mov    (%esi),%eax
+  801d39:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801d3e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d43:	e8 93 ff ff ff       	call   801cdb <nsipc>
+  801d48:	89 c3                	mov    %eax,%ebx
+  801d4a:	85 c0                	test   %eax,%eax
+  801d4c:	79 09                	jns    801d57 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801d4e:	89 d8                	mov    %ebx,%eax
+  801d50:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d53:	5b                   	pop    %ebx
+  801d54:	5e                   	pop    %esi
+  801d55:	5d                   	pop    %ebp
+  801d56:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801d57:	83 ec 04             	sub    $0x4,%esp
+  801d5a:	ff 35 10 60 80 00    	push   0x806010
+  801d60:	68 00 60 80 00       	push   $0x806000
+  801d65:	ff 75 0c             	push   0xc(%ebp)
+  801d68:	e8 dc ed ff ff       	call   800b49 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801d6d:	a1 10 60 80 00       	mov    0x806010,%eax
+  801d72:	89 06                	mov    %eax,(%esi)
+  801d74:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801d77:	eb d5                	jmp    801d4e <nsipc_accept+0x27>
+
+00801d79 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801d79:	55                   	push   %ebp
+  801d7a:	89 e5                	mov    %esp,%ebp
+  801d7c:	53                   	push   %ebx
+  801d7d:	83 ec 08             	sub    $0x8,%esp
+  801d80:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801d83:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d86:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801d8b:	53                   	push   %ebx
+  801d8c:	ff 75 0c             	push   0xc(%ebp)
+  801d8f:	68 04 60 80 00       	push   $0x806004
+  801d94:	e8 b0 ed ff ff       	call   800b49 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801d99:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  801d9f:	b8 02 00 00 00       	mov    $0x2,%eax
+  801da4:	e8 32 ff ff ff       	call   801cdb <nsipc>
+}
+  801da9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801dac:	c9                   	leave
+  801dad:	c3                   	ret
+
+00801dae <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801dae:	55                   	push   %ebp
+  801daf:	89 e5                	mov    %esp,%ebp
+  801db1:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801db4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801db7:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  801dbc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801dbf:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  801dc4:	b8 03 00 00 00       	mov    $0x3,%eax
+  801dc9:	e8 0d ff ff ff       	call   801cdb <nsipc>
+}
+  801dce:	c9                   	leave
+  801dcf:	c3                   	ret
+
+00801dd0 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801dd0:	55                   	push   %ebp
+  801dd1:	89 e5                	mov    %esp,%ebp
+  801dd3:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801dd6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dd9:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  801dde:	b8 04 00 00 00       	mov    $0x4,%eax
+  801de3:	e8 f3 fe ff ff       	call   801cdb <nsipc>
+}
+  801de8:	c9                   	leave
+  801de9:	c3                   	ret
+
+00801dea <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801dea:	55                   	push   %ebp
+  801deb:	89 e5                	mov    %esp,%ebp
+  801ded:	53                   	push   %ebx
+  801dee:	83 ec 08             	sub    $0x8,%esp
+  801df1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801df4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801df7:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801dfc:	53                   	push   %ebx
+  801dfd:	ff 75 0c             	push   0xc(%ebp)
+  801e00:	68 04 60 80 00       	push   $0x806004
+  801e05:	e8 3f ed ff ff       	call   800b49 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801e0a:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  801e10:	b8 05 00 00 00       	mov    $0x5,%eax
+  801e15:	e8 c1 fe ff ff       	call   801cdb <nsipc>
+}
+  801e1a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e1d:	c9                   	leave
+  801e1e:	c3                   	ret
+
+00801e1f <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801e1f:	55                   	push   %ebp
+  801e20:	89 e5                	mov    %esp,%ebp
+  801e22:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801e25:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e28:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  801e2d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e30:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  801e35:	b8 06 00 00 00       	mov    $0x6,%eax
+  801e3a:	e8 9c fe ff ff       	call   801cdb <nsipc>
+}
+  801e3f:	c9                   	leave
+  801e40:	c3                   	ret
+
+00801e41 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801e41:	55                   	push   %ebp
+  801e42:	89 e5                	mov    %esp,%ebp
+  801e44:	56                   	push   %esi
+  801e45:	53                   	push   %ebx
+  801e46:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801e49:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e4c:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  801e51:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  801e57:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e5a:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801e5f:	b8 07 00 00 00       	mov    $0x7,%eax
+  801e64:	e8 72 fe ff ff       	call   801cdb <nsipc>
+  801e69:	89 c3                	mov    %eax,%ebx
+  801e6b:	85 c0                	test   %eax,%eax
+  801e6d:	78 22                	js     801e91 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801e6f:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801e74:	39 c6                	cmp    %eax,%esi
+  801e76:	0f 4e c6             	cmovle %esi,%eax
+  801e79:	39 c3                	cmp    %eax,%ebx
+  801e7b:	7f 1d                	jg     801e9a <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801e7d:	83 ec 04             	sub    $0x4,%esp
+  801e80:	53                   	push   %ebx
+  801e81:	68 00 60 80 00       	push   $0x806000
+  801e86:	ff 75 0c             	push   0xc(%ebp)
+  801e89:	e8 bb ec ff ff       	call   800b49 <memmove>
+  801e8e:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801e91:	89 d8                	mov    %ebx,%eax
+  801e93:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e96:	5b                   	pop    %ebx
+  801e97:	5e                   	pop    %esi
+  801e98:	5d                   	pop    %ebp
+  801e99:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801e9a:	68 9f 2e 80 00       	push   $0x802e9f
+  801e9f:	68 67 2e 80 00       	push   $0x802e67
+  801ea4:	6a 62                	push   $0x62
+  801ea6:	68 b4 2e 80 00       	push   $0x802eb4
+  801eab:	e8 7f e4 ff ff       	call   80032f <_panic>
+
+00801eb0 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801eb0:	55                   	push   %ebp
+  801eb1:	89 e5                	mov    %esp,%ebp
+  801eb3:	53                   	push   %ebx
+  801eb4:	83 ec 04             	sub    $0x4,%esp
+  801eb7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801eba:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ebd:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  801ec2:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801ec8:	7f 2e                	jg     801ef8 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801eca:	83 ec 04             	sub    $0x4,%esp
+  801ecd:	53                   	push   %ebx
+  801ece:	ff 75 0c             	push   0xc(%ebp)
+  801ed1:	68 0c 60 80 00       	push   $0x80600c
+  801ed6:	e8 6e ec ff ff       	call   800b49 <memmove>
+	nsipcbuf.send.req_size = size;
+  801edb:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  801ee1:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ee4:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  801ee9:	b8 08 00 00 00       	mov    $0x8,%eax
+  801eee:	e8 e8 fd ff ff       	call   801cdb <nsipc>
+}
+  801ef3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ef6:	c9                   	leave
+  801ef7:	c3                   	ret
+	assert(size < 1600);
+  801ef8:	68 c0 2e 80 00       	push   $0x802ec0
+  801efd:	68 67 2e 80 00       	push   $0x802e67
+  801f02:	6a 6d                	push   $0x6d
+  801f04:	68 b4 2e 80 00       	push   $0x802eb4
+  801f09:	e8 21 e4 ff ff       	call   80032f <_panic>
+
+00801f0e <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801f0e:	55                   	push   %ebp
+  801f0f:	89 e5                	mov    %esp,%ebp
+  801f11:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801f14:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f17:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  801f1c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f1f:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  801f24:	8b 45 10             	mov    0x10(%ebp),%eax
+  801f27:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  801f2c:	b8 09 00 00 00       	mov    $0x9,%eax
+  801f31:	e8 a5 fd ff ff       	call   801cdb <nsipc>
+}
+  801f36:	c9                   	leave
+  801f37:	c3                   	ret
+
+00801f38 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801f38:	55                   	push   %ebp
+  801f39:	89 e5                	mov    %esp,%ebp
+  801f3b:	56                   	push   %esi
+  801f3c:	53                   	push   %ebx
+  801f3d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801f40:	83 ec 0c             	sub    $0xc,%esp
+  801f43:	ff 75 08             	push   0x8(%ebp)
+  801f46:	e8 96 f2 ff ff       	call   8011e1 <fd2data>
+  801f4b:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801f4d:	83 c4 08             	add    $0x8,%esp
+  801f50:	68 cc 2e 80 00       	push   $0x802ecc
+  801f55:	53                   	push   %ebx
+  801f56:	e8 68 ea ff ff       	call   8009c3 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801f5b:	8b 46 04             	mov    0x4(%esi),%eax
+  801f5e:	2b 06                	sub    (%esi),%eax
+  801f60:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  801f66:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801f6d:	00 00 00 
+	stat->st_dev = &devpipe;
+  801f70:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  801f77:	30 80 00 
+	return 0;
+}
+  801f7a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f7f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f82:	5b                   	pop    %ebx
+  801f83:	5e                   	pop    %esi
+  801f84:	5d                   	pop    %ebp
+  801f85:	c3                   	ret
+
+00801f86 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801f86:	55                   	push   %ebp
+  801f87:	89 e5                	mov    %esp,%ebp
+  801f89:	53                   	push   %ebx
+  801f8a:	83 ec 0c             	sub    $0xc,%esp
+  801f8d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801f90:	53                   	push   %ebx
+  801f91:	6a 00                	push   $0x0
+  801f93:	e8 9c ee ff ff       	call   800e34 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801f98:	89 1c 24             	mov    %ebx,(%esp)
+  801f9b:	e8 41 f2 ff ff       	call   8011e1 <fd2data>
+  801fa0:	83 c4 08             	add    $0x8,%esp
+  801fa3:	50                   	push   %eax
+  801fa4:	6a 00                	push   $0x0
+  801fa6:	e8 89 ee ff ff       	call   800e34 <sys_page_unmap>
+}
+  801fab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fae:	c9                   	leave
+  801faf:	c3                   	ret
+
+00801fb0 <_pipeisclosed>:
+{
+  801fb0:	55                   	push   %ebp
+  801fb1:	89 e5                	mov    %esp,%ebp
+  801fb3:	57                   	push   %edi
+  801fb4:	56                   	push   %esi
+  801fb5:	53                   	push   %ebx
+  801fb6:	83 ec 1c             	sub    $0x1c,%esp
+  801fb9:	89 c7                	mov    %eax,%edi
+  801fbb:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801fbd:	a1 20 44 80 00       	mov    0x804420,%eax
+  801fc2:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801fc5:	83 ec 0c             	sub    $0xc,%esp
+  801fc8:	57                   	push   %edi
+  801fc9:	e8 2f 05 00 00       	call   8024fd <pageref>
+  801fce:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801fd1:	89 34 24             	mov    %esi,(%esp)
+  801fd4:	e8 24 05 00 00       	call   8024fd <pageref>
+		nn = thisenv->env_runs;
+  801fd9:	8b 15 20 44 80 00    	mov    0x804420,%edx
+  801fdf:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801fe2:	83 c4 10             	add    $0x10,%esp
+  801fe5:	39 cb                	cmp    %ecx,%ebx
+  801fe7:	74 1b                	je     802004 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801fe9:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801fec:	75 cf                	jne    801fbd <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801fee:	8b 42 58             	mov    0x58(%edx),%eax
+  801ff1:	6a 01                	push   $0x1
+  801ff3:	50                   	push   %eax
+  801ff4:	53                   	push   %ebx
+  801ff5:	68 d3 2e 80 00       	push   $0x802ed3
+  801ffa:	e8 0b e4 ff ff       	call   80040a <cprintf>
+  801fff:	83 c4 10             	add    $0x10,%esp
+  802002:	eb b9                	jmp    801fbd <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802004:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802007:	0f 94 c0             	sete   %al
+  80200a:	0f b6 c0             	movzbl %al,%eax
+}
+  80200d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802010:	5b                   	pop    %ebx
+  802011:	5e                   	pop    %esi
+  802012:	5f                   	pop    %edi
+  802013:	5d                   	pop    %ebp
+  802014:	c3                   	ret
+
+00802015 <devpipe_write>:
+{
+  802015:	55                   	push   %ebp
+  802016:	89 e5                	mov    %esp,%ebp
+  802018:	57                   	push   %edi
+  802019:	56                   	push   %esi
+  80201a:	53                   	push   %ebx
+  80201b:	83 ec 28             	sub    $0x28,%esp
+  80201e:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802021:	56                   	push   %esi
+  802022:	e8 ba f1 ff ff       	call   8011e1 <fd2data>
+  802027:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802029:	83 c4 10             	add    $0x10,%esp
+  80202c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802031:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802034:	75 09                	jne    80203f <devpipe_write+0x2a>
+	return i;
+  802036:	89 f8                	mov    %edi,%eax
+  802038:	eb 23                	jmp    80205d <devpipe_write+0x48>
+			sys_yield();
+  80203a:	e8 51 ed ff ff       	call   800d90 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80203f:	8b 43 04             	mov    0x4(%ebx),%eax
+  802042:	8b 0b                	mov    (%ebx),%ecx
+  802044:	8d 51 20             	lea    0x20(%ecx),%edx
+  802047:	39 d0                	cmp    %edx,%eax
+  802049:	72 1a                	jb     802065 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  80204b:	89 da                	mov    %ebx,%edx
+  80204d:	89 f0                	mov    %esi,%eax
+  80204f:	e8 5c ff ff ff       	call   801fb0 <_pipeisclosed>
+  802054:	85 c0                	test   %eax,%eax
+  802056:	74 e2                	je     80203a <devpipe_write+0x25>
+				return 0;
+  802058:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80205d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802060:	5b                   	pop    %ebx
+  802061:	5e                   	pop    %esi
+  802062:	5f                   	pop    %edi
+  802063:	5d                   	pop    %ebp
+  802064:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802065:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802068:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  80206c:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  80206f:	89 c2                	mov    %eax,%edx
+  802071:	c1 fa 1f             	sar    $0x1f,%edx
+  802074:	89 d1                	mov    %edx,%ecx
+  802076:	c1 e9 1b             	shr    $0x1b,%ecx
+  802079:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80207c:	83 e2 1f             	and    $0x1f,%edx
+  80207f:	29 ca                	sub    %ecx,%edx
+  802081:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802085:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802089:	83 c0 01             	add    $0x1,%eax
+  80208c:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  80208f:	83 c7 01             	add    $0x1,%edi
+  802092:	eb 9d                	jmp    802031 <devpipe_write+0x1c>
+
+00802094 <devpipe_read>:
+{
+  802094:	55                   	push   %ebp
+  802095:	89 e5                	mov    %esp,%ebp
+  802097:	57                   	push   %edi
+  802098:	56                   	push   %esi
+  802099:	53                   	push   %ebx
+  80209a:	83 ec 18             	sub    $0x18,%esp
+  80209d:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8020a0:	57                   	push   %edi
+  8020a1:	e8 3b f1 ff ff       	call   8011e1 <fd2data>
+  8020a6:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8020a8:	83 c4 10             	add    $0x10,%esp
+  8020ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8020b0:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8020b3:	75 13                	jne    8020c8 <devpipe_read+0x34>
+	return i;
+  8020b5:	89 f0                	mov    %esi,%eax
+  8020b7:	eb 02                	jmp    8020bb <devpipe_read+0x27>
+				return i;
+  8020b9:	89 f0                	mov    %esi,%eax
+}
+  8020bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020be:	5b                   	pop    %ebx
+  8020bf:	5e                   	pop    %esi
+  8020c0:	5f                   	pop    %edi
+  8020c1:	5d                   	pop    %ebp
+  8020c2:	c3                   	ret
+			sys_yield();
+  8020c3:	e8 c8 ec ff ff       	call   800d90 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  8020c8:	8b 03                	mov    (%ebx),%eax
+  8020ca:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8020cd:	75 18                	jne    8020e7 <devpipe_read+0x53>
+			if (i > 0)
+  8020cf:	85 f6                	test   %esi,%esi
+  8020d1:	75 e6                	jne    8020b9 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  8020d3:	89 da                	mov    %ebx,%edx
+  8020d5:	89 f8                	mov    %edi,%eax
+  8020d7:	e8 d4 fe ff ff       	call   801fb0 <_pipeisclosed>
+  8020dc:	85 c0                	test   %eax,%eax
+  8020de:	74 e3                	je     8020c3 <devpipe_read+0x2f>
+				return 0;
+  8020e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020e5:	eb d4                	jmp    8020bb <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8020e7:	99                   	cltd
+  8020e8:	c1 ea 1b             	shr    $0x1b,%edx
+  8020eb:	01 d0                	add    %edx,%eax
+  8020ed:	83 e0 1f             	and    $0x1f,%eax
+  8020f0:	29 d0                	sub    %edx,%eax
+  8020f2:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8020f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8020fa:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8020fd:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802100:	83 c6 01             	add    $0x1,%esi
+  802103:	eb ab                	jmp    8020b0 <devpipe_read+0x1c>
+
+00802105 <pipe>:
+{
+  802105:	55                   	push   %ebp
+  802106:	89 e5                	mov    %esp,%ebp
+  802108:	56                   	push   %esi
+  802109:	53                   	push   %ebx
+  80210a:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80210d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802110:	50                   	push   %eax
+  802111:	e8 e2 f0 ff ff       	call   8011f8 <fd_alloc>
+  802116:	89 c3                	mov    %eax,%ebx
+  802118:	83 c4 10             	add    $0x10,%esp
+  80211b:	85 c0                	test   %eax,%eax
+  80211d:	0f 88 23 01 00 00    	js     802246 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802123:	83 ec 04             	sub    $0x4,%esp
+  802126:	68 07 04 00 00       	push   $0x407
+  80212b:	ff 75 f4             	push   -0xc(%ebp)
+  80212e:	6a 00                	push   $0x0
+  802130:	e8 7a ec ff ff       	call   800daf <sys_page_alloc>
+  802135:	89 c3                	mov    %eax,%ebx
+  802137:	83 c4 10             	add    $0x10,%esp
+  80213a:	85 c0                	test   %eax,%eax
+  80213c:	0f 88 04 01 00 00    	js     802246 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802142:	83 ec 0c             	sub    $0xc,%esp
+  802145:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802148:	50                   	push   %eax
+  802149:	e8 aa f0 ff ff       	call   8011f8 <fd_alloc>
+  80214e:	89 c3                	mov    %eax,%ebx
+  802150:	83 c4 10             	add    $0x10,%esp
+  802153:	85 c0                	test   %eax,%eax
+  802155:	0f 88 db 00 00 00    	js     802236 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80215b:	83 ec 04             	sub    $0x4,%esp
+  80215e:	68 07 04 00 00       	push   $0x407
+  802163:	ff 75 f0             	push   -0x10(%ebp)
+  802166:	6a 00                	push   $0x0
+  802168:	e8 42 ec ff ff       	call   800daf <sys_page_alloc>
+  80216d:	89 c3                	mov    %eax,%ebx
+  80216f:	83 c4 10             	add    $0x10,%esp
+  802172:	85 c0                	test   %eax,%eax
+  802174:	0f 88 bc 00 00 00    	js     802236 <pipe+0x131>
+	va = fd2data(fd0);
+  80217a:	83 ec 0c             	sub    $0xc,%esp
+  80217d:	ff 75 f4             	push   -0xc(%ebp)
+  802180:	e8 5c f0 ff ff       	call   8011e1 <fd2data>
+  802185:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802187:	83 c4 0c             	add    $0xc,%esp
+  80218a:	68 07 04 00 00       	push   $0x407
+  80218f:	50                   	push   %eax
+  802190:	6a 00                	push   $0x0
+  802192:	e8 18 ec ff ff       	call   800daf <sys_page_alloc>
+  802197:	89 c3                	mov    %eax,%ebx
+  802199:	83 c4 10             	add    $0x10,%esp
+  80219c:	85 c0                	test   %eax,%eax
+  80219e:	0f 88 82 00 00 00    	js     802226 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8021a4:	83 ec 0c             	sub    $0xc,%esp
+  8021a7:	ff 75 f0             	push   -0x10(%ebp)
+  8021aa:	e8 32 f0 ff ff       	call   8011e1 <fd2data>
+  8021af:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8021b6:	50                   	push   %eax
+  8021b7:	6a 00                	push   $0x0
+  8021b9:	56                   	push   %esi
+  8021ba:	6a 00                	push   $0x0
+  8021bc:	e8 31 ec ff ff       	call   800df2 <sys_page_map>
+  8021c1:	89 c3                	mov    %eax,%ebx
+  8021c3:	83 c4 20             	add    $0x20,%esp
+  8021c6:	85 c0                	test   %eax,%eax
+  8021c8:	78 4e                	js     802218 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8021ca:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  8021cf:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8021d2:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8021d4:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8021d7:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8021de:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8021e1:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8021e3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8021e6:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8021ed:	83 ec 0c             	sub    $0xc,%esp
+  8021f0:	ff 75 f4             	push   -0xc(%ebp)
+  8021f3:	e8 d9 ef ff ff       	call   8011d1 <fd2num>
+  8021f8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8021fb:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8021fd:	83 c4 04             	add    $0x4,%esp
+  802200:	ff 75 f0             	push   -0x10(%ebp)
+  802203:	e8 c9 ef ff ff       	call   8011d1 <fd2num>
+  802208:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80220b:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80220e:	83 c4 10             	add    $0x10,%esp
+  802211:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802216:	eb 2e                	jmp    802246 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802218:	83 ec 08             	sub    $0x8,%esp
+  80221b:	56                   	push   %esi
+  80221c:	6a 00                	push   $0x0
+  80221e:	e8 11 ec ff ff       	call   800e34 <sys_page_unmap>
+  802223:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802226:	83 ec 08             	sub    $0x8,%esp
+  802229:	ff 75 f0             	push   -0x10(%ebp)
+  80222c:	6a 00                	push   $0x0
+  80222e:	e8 01 ec ff ff       	call   800e34 <sys_page_unmap>
+  802233:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802236:	83 ec 08             	sub    $0x8,%esp
+  802239:	ff 75 f4             	push   -0xc(%ebp)
+  80223c:	6a 00                	push   $0x0
+  80223e:	e8 f1 eb ff ff       	call   800e34 <sys_page_unmap>
+  802243:	83 c4 10             	add    $0x10,%esp
+}
+  802246:	89 d8                	mov    %ebx,%eax
+  802248:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80224b:	5b                   	pop    %ebx
+  80224c:	5e                   	pop    %esi
+  80224d:	5d                   	pop    %ebp
+  80224e:	c3                   	ret
+
+0080224f <pipeisclosed>:
+{
+  80224f:	55                   	push   %ebp
+  802250:	89 e5                	mov    %esp,%ebp
+  802252:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802255:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802258:	50                   	push   %eax
+  802259:	ff 75 08             	push   0x8(%ebp)
+  80225c:	e8 ed ef ff ff       	call   80124e <fd_lookup>
+  802261:	83 c4 10             	add    $0x10,%esp
+  802264:	85 c0                	test   %eax,%eax
+  802266:	78 18                	js     802280 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802268:	83 ec 0c             	sub    $0xc,%esp
+  80226b:	ff 75 f4             	push   -0xc(%ebp)
+  80226e:	e8 6e ef ff ff       	call   8011e1 <fd2data>
+  802273:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802275:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802278:	e8 33 fd ff ff       	call   801fb0 <_pipeisclosed>
+  80227d:	83 c4 10             	add    $0x10,%esp
+}
+  802280:	c9                   	leave
+  802281:	c3                   	ret
+
+00802282 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802282:	b8 00 00 00 00       	mov    $0x0,%eax
+  802287:	c3                   	ret
+
+00802288 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802288:	55                   	push   %ebp
+  802289:	89 e5                	mov    %esp,%ebp
+  80228b:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80228e:	68 eb 2e 80 00       	push   $0x802eeb
+  802293:	ff 75 0c             	push   0xc(%ebp)
+  802296:	e8 28 e7 ff ff       	call   8009c3 <strcpy>
+	return 0;
+}
+  80229b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022a0:	c9                   	leave
+  8022a1:	c3                   	ret
+
+008022a2 <devcons_write>:
+{
+  8022a2:	55                   	push   %ebp
+  8022a3:	89 e5                	mov    %esp,%ebp
+  8022a5:	57                   	push   %edi
+  8022a6:	56                   	push   %esi
+  8022a7:	53                   	push   %ebx
+  8022a8:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8022ae:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8022b3:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8022b9:	eb 2e                	jmp    8022e9 <devcons_write+0x47>
+		m = n - tot;
+  8022bb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8022be:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8022c0:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8022c5:	39 c3                	cmp    %eax,%ebx
+  8022c7:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8022ca:	83 ec 04             	sub    $0x4,%esp
+  8022cd:	53                   	push   %ebx
+  8022ce:	89 f0                	mov    %esi,%eax
+  8022d0:	03 45 0c             	add    0xc(%ebp),%eax
+  8022d3:	50                   	push   %eax
+  8022d4:	57                   	push   %edi
+  8022d5:	e8 6f e8 ff ff       	call   800b49 <memmove>
+		sys_cputs(buf, m);
+  8022da:	83 c4 08             	add    $0x8,%esp
+  8022dd:	53                   	push   %ebx
+  8022de:	57                   	push   %edi
+  8022df:	e8 0f ea ff ff       	call   800cf3 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8022e4:	01 de                	add    %ebx,%esi
+  8022e6:	83 c4 10             	add    $0x10,%esp
+  8022e9:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8022ec:	72 cd                	jb     8022bb <devcons_write+0x19>
+}
+  8022ee:	89 f0                	mov    %esi,%eax
+  8022f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022f3:	5b                   	pop    %ebx
+  8022f4:	5e                   	pop    %esi
+  8022f5:	5f                   	pop    %edi
+  8022f6:	5d                   	pop    %ebp
+  8022f7:	c3                   	ret
+
+008022f8 <devcons_read>:
+{
+  8022f8:	55                   	push   %ebp
+  8022f9:	89 e5                	mov    %esp,%ebp
+  8022fb:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8022fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  802303:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802307:	75 07                	jne    802310 <devcons_read+0x18>
+  802309:	eb 1f                	jmp    80232a <devcons_read+0x32>
+		sys_yield();
+  80230b:	e8 80 ea ff ff       	call   800d90 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802310:	e8 fc e9 ff ff       	call   800d11 <sys_cgetc>
+  802315:	85 c0                	test   %eax,%eax
+  802317:	74 f2                	je     80230b <devcons_read+0x13>
+	if (c < 0)
+  802319:	78 0f                	js     80232a <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80231b:	83 f8 04             	cmp    $0x4,%eax
+  80231e:	74 0c                	je     80232c <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802320:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802323:	88 02                	mov    %al,(%edx)
+	return 1;
+  802325:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80232a:	c9                   	leave
+  80232b:	c3                   	ret
+		return 0;
+  80232c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802331:	eb f7                	jmp    80232a <devcons_read+0x32>
+
+00802333 <cputchar>:
+{
+  802333:	55                   	push   %ebp
+  802334:	89 e5                	mov    %esp,%ebp
+  802336:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802339:	8b 45 08             	mov    0x8(%ebp),%eax
+  80233c:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80233f:	6a 01                	push   $0x1
+  802341:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802344:	50                   	push   %eax
+  802345:	e8 a9 e9 ff ff       	call   800cf3 <sys_cputs>
+}
+  80234a:	83 c4 10             	add    $0x10,%esp
+  80234d:	c9                   	leave
+  80234e:	c3                   	ret
+
+0080234f <getchar>:
+{
+  80234f:	55                   	push   %ebp
+  802350:	89 e5                	mov    %esp,%ebp
+  802352:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802355:	6a 01                	push   $0x1
+  802357:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80235a:	50                   	push   %eax
+  80235b:	6a 00                	push   $0x0
+  80235d:	e8 52 f1 ff ff       	call   8014b4 <read>
+	if (r < 0)
+  802362:	83 c4 10             	add    $0x10,%esp
+  802365:	85 c0                	test   %eax,%eax
+  802367:	78 06                	js     80236f <getchar+0x20>
+	if (r < 1)
+  802369:	74 06                	je     802371 <getchar+0x22>
+	return c;
+  80236b:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80236f:	c9                   	leave
+  802370:	c3                   	ret
+		return -E_EOF;
+  802371:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802376:	eb f7                	jmp    80236f <getchar+0x20>
+
+00802378 <iscons>:
+{
+  802378:	55                   	push   %ebp
+  802379:	89 e5                	mov    %esp,%ebp
+  80237b:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80237e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802381:	50                   	push   %eax
+  802382:	ff 75 08             	push   0x8(%ebp)
+  802385:	e8 c4 ee ff ff       	call   80124e <fd_lookup>
+  80238a:	83 c4 10             	add    $0x10,%esp
+  80238d:	85 c0                	test   %eax,%eax
+  80238f:	78 11                	js     8023a2 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802391:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802394:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  80239a:	39 10                	cmp    %edx,(%eax)
+  80239c:	0f 94 c0             	sete   %al
+  80239f:	0f b6 c0             	movzbl %al,%eax
+}
+  8023a2:	c9                   	leave
+  8023a3:	c3                   	ret
+
+008023a4 <opencons>:
+{
+  8023a4:	55                   	push   %ebp
+  8023a5:	89 e5                	mov    %esp,%ebp
+  8023a7:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8023aa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023ad:	50                   	push   %eax
+  8023ae:	e8 45 ee ff ff       	call   8011f8 <fd_alloc>
+  8023b3:	83 c4 10             	add    $0x10,%esp
+  8023b6:	85 c0                	test   %eax,%eax
+  8023b8:	78 3a                	js     8023f4 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8023ba:	83 ec 04             	sub    $0x4,%esp
+  8023bd:	68 07 04 00 00       	push   $0x407
+  8023c2:	ff 75 f4             	push   -0xc(%ebp)
+  8023c5:	6a 00                	push   $0x0
+  8023c7:	e8 e3 e9 ff ff       	call   800daf <sys_page_alloc>
+  8023cc:	83 c4 10             	add    $0x10,%esp
+  8023cf:	85 c0                	test   %eax,%eax
+  8023d1:	78 21                	js     8023f4 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8023d3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023d6:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  8023dc:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8023de:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023e1:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8023e8:	83 ec 0c             	sub    $0xc,%esp
+  8023eb:	50                   	push   %eax
+  8023ec:	e8 e0 ed ff ff       	call   8011d1 <fd2num>
+  8023f1:	83 c4 10             	add    $0x10,%esp
+}
+  8023f4:	c9                   	leave
+  8023f5:	c3                   	ret
+
+008023f6 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  8023f6:	55                   	push   %ebp
+  8023f7:	89 e5                	mov    %esp,%ebp
+  8023f9:	56                   	push   %esi
+  8023fa:	53                   	push   %ebx
+  8023fb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8023fe:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802401:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  802404:	85 c0                	test   %eax,%eax
+  802406:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80240b:	0f 44 c2             	cmove  %edx,%eax
+  80240e:	83 ec 0c             	sub    $0xc,%esp
+  802411:	50                   	push   %eax
+  802412:	e8 48 eb ff ff       	call   800f5f <sys_ipc_recv>
+
+  if (from_env_store)
+  802417:	83 c4 10             	add    $0x10,%esp
+  80241a:	85 f6                	test   %esi,%esi
+  80241c:	74 17                	je     802435 <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  80241e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802423:	85 c0                	test   %eax,%eax
+  802425:	75 0c                	jne    802433 <ipc_recv+0x3d>
+  802427:	8b 15 20 44 80 00    	mov    0x804420,%edx
+  80242d:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  802433:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  802435:	85 db                	test   %ebx,%ebx
+  802437:	74 2b                	je     802464 <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  802439:	85 c0                	test   %eax,%eax
+  80243b:	74 0d                	je     80244a <ipc_recv+0x54>
+  80243d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  802443:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802446:	5b                   	pop    %ebx
+  802447:	5e                   	pop    %esi
+  802448:	5d                   	pop    %ebp
+  802449:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  80244a:	a1 20 44 80 00       	mov    0x804420,%eax
+  80244f:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  802455:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  802457:	a1 20 44 80 00       	mov    0x804420,%eax
+  80245c:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  802462:	eb df                	jmp    802443 <ipc_recv+0x4d>
+  802464:	85 c0                	test   %eax,%eax
+  802466:	75 db                	jne    802443 <ipc_recv+0x4d>
+  802468:	eb ed                	jmp    802457 <ipc_recv+0x61>
+
+0080246a <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  80246a:	55                   	push   %ebp
+  80246b:	89 e5                	mov    %esp,%ebp
+  80246d:	57                   	push   %edi
+  80246e:	56                   	push   %esi
+  80246f:	53                   	push   %ebx
+  802470:	83 ec 0c             	sub    $0xc,%esp
+  802473:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802476:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802479:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  80247c:	85 db                	test   %ebx,%ebx
+  80247e:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802483:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  802486:	ff 75 14             	push   0x14(%ebp)
+  802489:	53                   	push   %ebx
+  80248a:	56                   	push   %esi
+  80248b:	57                   	push   %edi
+  80248c:	e8 ab ea ff ff       	call   800f3c <sys_ipc_try_send>
+  802491:	83 c4 10             	add    $0x10,%esp
+  802494:	85 c0                	test   %eax,%eax
+  802496:	74 1e                	je     8024b6 <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  802498:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80249b:	75 07                	jne    8024a4 <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  80249d:	e8 ee e8 ff ff       	call   800d90 <sys_yield>
+  8024a2:	eb e2                	jmp    802486 <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  8024a4:	50                   	push   %eax
+  8024a5:	68 f7 2e 80 00       	push   $0x802ef7
+  8024aa:	6a 3c                	push   $0x3c
+  8024ac:	68 04 2f 80 00       	push   $0x802f04
+  8024b1:	e8 79 de ff ff       	call   80032f <_panic>
+  }
+
+#endif
+}
+  8024b6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024b9:	5b                   	pop    %ebx
+  8024ba:	5e                   	pop    %esi
+  8024bb:	5f                   	pop    %edi
+  8024bc:	5d                   	pop    %ebp
+  8024bd:	c3                   	ret
+
+008024be <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  8024be:	55                   	push   %ebp
+  8024bf:	89 e5                	mov    %esp,%ebp
+  8024c1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  8024c4:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  8024c9:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8024cc:	c1 e0 04             	shl    $0x4,%eax
+  8024cf:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8024d4:	8b 40 50             	mov    0x50(%eax),%eax
+  8024d7:	39 c8                	cmp    %ecx,%eax
+  8024d9:	74 12                	je     8024ed <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  8024db:	83 c2 01             	add    $0x1,%edx
+  8024de:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8024e4:	75 e3                	jne    8024c9 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  8024e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024eb:	eb 0e                	jmp    8024fb <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  8024ed:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8024f0:	c1 e0 04             	shl    $0x4,%eax
+  8024f3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8024f8:	8b 40 48             	mov    0x48(%eax),%eax
+  8024fb:	5d                   	pop    %ebp
+  8024fc:	c3                   	ret
+
+008024fd <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8024fd:	55                   	push   %ebp
+  8024fe:	89 e5                	mov    %esp,%ebp
+  802500:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802503:	89 c2                	mov    %eax,%edx
+  802505:	c1 ea 16             	shr    $0x16,%edx
+  802508:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80250f:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802514:	f6 c1 01             	test   $0x1,%cl
+  802517:	74 1c                	je     802535 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  802519:	c1 e8 0c             	shr    $0xc,%eax
+  80251c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802523:	a8 01                	test   $0x1,%al
+  802525:	74 0e                	je     802535 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802527:	c1 e8 0c             	shr    $0xc,%eax
+  80252a:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802531:	ef 
+  802532:	0f b7 d2             	movzwl %dx,%edx
+}
+  802535:	89 d0                	mov    %edx,%eax
+  802537:	5d                   	pop    %ebp
+  802538:	c3                   	ret
+  802539:	66 90                	xchg   %ax,%ax
+  80253b:	66 90                	xchg   %ax,%ax
+  80253d:	66 90                	xchg   %ax,%ax
+  80253f:	90                   	nop
+
+00802540 <__udivmoddi4>:
+  802540:	55                   	push   %ebp
+  802541:	57                   	push   %edi
+  802542:	56                   	push   %esi
+  802543:	53                   	push   %ebx
+  802544:	83 ec 24             	sub    $0x24,%esp
+  802547:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80254b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80254f:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  802553:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802557:	8b 54 24 44          	mov    0x44(%esp),%edx
+  80255b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80255f:	8b 44 24 40          	mov    0x40(%esp),%eax
+  802563:	89 d3                	mov    %edx,%ebx
+  802565:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802569:	09 c3                	or     %eax,%ebx
+  80256b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80256f:	0f 84 9c 00 00 00    	je     802611 <__udivmoddi4+0xd1>
+  802575:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80257c:	00 
+  80257d:	31 c0                	xor    %eax,%eax
+  80257f:	31 d2                	xor    %edx,%edx
+  802581:	89 fb                	mov    %edi,%ebx
+  802583:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80258a:	00 
+  80258b:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802590:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802594:	01 c0                	add    %eax,%eax
+  802596:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80259d:	00 
+  80259e:	89 c6                	mov    %eax,%esi
+  8025a0:	89 d7                	mov    %edx,%edi
+  8025a2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8025a6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8025aa:	0f ad d0             	shrd   %cl,%edx,%eax
+  8025ad:	d3 ea                	shr    %cl,%edx
+  8025af:	f6 c1 20             	test   $0x20,%cl
+  8025b2:	0f 45 c2             	cmovne %edx,%eax
+  8025b5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8025b9:	83 e0 01             	and    $0x1,%eax
+  8025bc:	09 fa                	or     %edi,%edx
+  8025be:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8025c2:	89 04 24             	mov    %eax,(%esp)
+  8025c5:	8b 04 24             	mov    (%esp),%eax
+  8025c8:	89 d5                	mov    %edx,%ebp
+  8025ca:	09 f0                	or     %esi,%eax
+  8025cc:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8025d0:	39 f0                	cmp    %esi,%eax
+  8025d2:	19 fd                	sbb    %edi,%ebp
+  8025d4:	72 1d                	jb     8025f3 <__udivmoddi4+0xb3>
+  8025d6:	29 f0                	sub    %esi,%eax
+  8025d8:	19 fa                	sbb    %edi,%edx
+  8025da:	89 cf                	mov    %ecx,%edi
+  8025dc:	c1 ef 05             	shr    $0x5,%edi
+  8025df:	83 e7 01             	and    $0x1,%edi
+  8025e2:	89 fe                	mov    %edi,%esi
+  8025e4:	d3 e7                	shl    %cl,%edi
+  8025e6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8025ea:	83 f6 01             	xor    $0x1,%esi
+  8025ed:	d3 e6                	shl    %cl,%esi
+  8025ef:	09 74 24 18          	or     %esi,0x18(%esp)
+  8025f3:	83 e9 01             	sub    $0x1,%ecx
+  8025f6:	73 98                	jae    802590 <__udivmoddi4+0x50>
+  8025f8:	85 db                	test   %ebx,%ebx
+  8025fa:	74 05                	je     802601 <__udivmoddi4+0xc1>
+  8025fc:	89 03                	mov    %eax,(%ebx)
+  8025fe:	89 53 04             	mov    %edx,0x4(%ebx)
+  802601:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802605:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802609:	83 c4 24             	add    $0x24,%esp
+  80260c:	5b                   	pop    %ebx
+  80260d:	5e                   	pop    %esi
+  80260e:	5f                   	pop    %edi
+  80260f:	5d                   	pop    %ebp
+  802610:	c3                   	ret
+  802611:	85 ff                	test   %edi,%edi
+  802613:	74 0d                	je     802622 <__udivmoddi4+0xe2>
+  802615:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  80261b:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  802622:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802626:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80262a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80262e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802632:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802636:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80263a:	83 c4 24             	add    $0x24,%esp
+  80263d:	5b                   	pop    %ebx
+  80263e:	5e                   	pop    %esi
+  80263f:	5f                   	pop    %edi
+  802640:	5d                   	pop    %ebp
+  802641:	c3                   	ret
+  802642:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802649:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00802650 <__udivdi3>:
+  802650:	57                   	push   %edi
+  802651:	56                   	push   %esi
+  802652:	53                   	push   %ebx
+  802653:	83 ec 20             	sub    $0x20,%esp
+  802656:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80265a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80265e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802662:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802666:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80266a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80266e:	89 d1                	mov    %edx,%ecx
+  802670:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802674:	09 c1                	or     %eax,%ecx
+  802676:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80267a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80267e:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802682:	0f 84 88 00 00 00    	je     802710 <__udivdi3+0xc0>
+  802688:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80268f:	00 
+  802690:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802695:	31 c0                	xor    %eax,%eax
+  802697:	31 d2                	xor    %edx,%edx
+  802699:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8026a0:	00 
+  8026a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8026a8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8026ac:	01 c0                	add    %eax,%eax
+  8026ae:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8026b5:	00 
+  8026b6:	89 c6                	mov    %eax,%esi
+  8026b8:	89 d7                	mov    %edx,%edi
+  8026ba:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8026be:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8026c2:	0f ad d0             	shrd   %cl,%edx,%eax
+  8026c5:	d3 ea                	shr    %cl,%edx
+  8026c7:	f6 c1 20             	test   $0x20,%cl
+  8026ca:	0f 45 c2             	cmovne %edx,%eax
+  8026cd:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8026d1:	83 e0 01             	and    $0x1,%eax
+  8026d4:	09 fa                	or     %edi,%edx
+  8026d6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8026da:	89 04 24             	mov    %eax,(%esp)
+  8026dd:	8b 04 24             	mov    (%esp),%eax
+  8026e0:	89 d3                	mov    %edx,%ebx
+  8026e2:	09 f0                	or     %esi,%eax
+  8026e4:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8026e8:	39 f0                	cmp    %esi,%eax
+  8026ea:	19 fb                	sbb    %edi,%ebx
+  8026ec:	72 1d                	jb     80270b <__udivdi3+0xbb>
+  8026ee:	29 f0                	sub    %esi,%eax
+  8026f0:	19 fa                	sbb    %edi,%edx
+  8026f2:	89 cf                	mov    %ecx,%edi
+  8026f4:	c1 ef 05             	shr    $0x5,%edi
+  8026f7:	83 e7 01             	and    $0x1,%edi
+  8026fa:	89 fe                	mov    %edi,%esi
+  8026fc:	d3 e7                	shl    %cl,%edi
+  8026fe:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802702:	83 f6 01             	xor    $0x1,%esi
+  802705:	d3 e6                	shl    %cl,%esi
+  802707:	09 74 24 18          	or     %esi,0x18(%esp)
+  80270b:	83 e9 01             	sub    $0x1,%ecx
+  80270e:	73 98                	jae    8026a8 <__udivdi3+0x58>
+  802710:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802714:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802718:	83 c4 20             	add    $0x20,%esp
+  80271b:	5b                   	pop    %ebx
+  80271c:	5e                   	pop    %esi
+  80271d:	5f                   	pop    %edi
+  80271e:	c3                   	ret
+  80271f:	90                   	nop
+
+00802720 <__umoddi3>:
+  802720:	57                   	push   %edi
+  802721:	56                   	push   %esi
+  802722:	53                   	push   %ebx
+  802723:	83 ec 18             	sub    $0x18,%esp
+  802726:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80272a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80272e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802732:	8b 54 24 34          	mov    0x34(%esp),%edx
+  802736:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80273a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80273e:	89 d1                	mov    %edx,%ecx
+  802740:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802744:	09 c1                	or     %eax,%ecx
+  802746:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80274a:	74 5b                	je     8027a7 <__umoddi3+0x87>
+  80274c:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802751:	31 c0                	xor    %eax,%eax
+  802753:	31 d2                	xor    %edx,%edx
+  802755:	8d 76 00             	lea    0x0(%esi),%esi
+  802758:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80275c:	01 c0                	add    %eax,%eax
+  80275e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802765:	00 
+  802766:	89 c6                	mov    %eax,%esi
+  802768:	89 d7                	mov    %edx,%edi
+  80276a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80276e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802772:	0f ad d0             	shrd   %cl,%edx,%eax
+  802775:	d3 ea                	shr    %cl,%edx
+  802777:	f6 c1 20             	test   $0x20,%cl
+  80277a:	0f 45 c2             	cmovne %edx,%eax
+  80277d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802781:	83 e0 01             	and    $0x1,%eax
+  802784:	09 fa                	or     %edi,%edx
+  802786:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80278a:	89 04 24             	mov    %eax,(%esp)
+  80278d:	8b 04 24             	mov    (%esp),%eax
+  802790:	89 d3                	mov    %edx,%ebx
+  802792:	09 f0                	or     %esi,%eax
+  802794:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802798:	39 f0                	cmp    %esi,%eax
+  80279a:	19 fb                	sbb    %edi,%ebx
+  80279c:	72 04                	jb     8027a2 <__umoddi3+0x82>
+  80279e:	29 f0                	sub    %esi,%eax
+  8027a0:	19 fa                	sbb    %edi,%edx
+  8027a2:	83 e9 01             	sub    $0x1,%ecx
+  8027a5:	73 b1                	jae    802758 <__umoddi3+0x38>
+  8027a7:	83 c4 18             	add    $0x18,%esp
+  8027aa:	5b                   	pop    %ebx
+  8027ab:	5e                   	pop    %esi
+  8027ac:	5f                   	pop    %edi
+  8027ad:	c3                   	ret
+  8027ae:	66 90                	xchg   %ax,%ax
+
+008027b0 <__divdi3>:
+  8027b0:	55                   	push   %ebp
+  8027b1:	57                   	push   %edi
+  8027b2:	56                   	push   %esi
+  8027b3:	53                   	push   %ebx
+  8027b4:	83 ec 24             	sub    $0x24,%esp
+  8027b7:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  8027bb:	8b 74 24 44          	mov    0x44(%esp),%esi
+  8027bf:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8027c3:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8027c7:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  8027cb:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8027cf:	85 d2                	test   %edx,%edx
+  8027d1:	0f 88 e0 00 00 00    	js     8028b7 <__divdi3+0x107>
+  8027d7:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  8027db:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  8027df:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8027e3:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8027e7:	85 f6                	test   %esi,%esi
+  8027e9:	78 16                	js     802801 <__divdi3+0x51>
+  8027eb:	89 f1                	mov    %esi,%ecx
+  8027ed:	31 c0                	xor    %eax,%eax
+  8027ef:	31 d2                	xor    %edx,%edx
+  8027f1:	09 d9                	or     %ebx,%ecx
+  8027f3:	0f 85 f3 00 00 00    	jne    8028ec <__divdi3+0x13c>
+  8027f9:	83 c4 24             	add    $0x24,%esp
+  8027fc:	5b                   	pop    %ebx
+  8027fd:	5e                   	pop    %esi
+  8027fe:	5f                   	pop    %edi
+  8027ff:	5d                   	pop    %ebp
+  802800:	c3                   	ret
+  802801:	bf 01 00 00 00       	mov    $0x1,%edi
+  802806:	f7 5c 24 08          	negl   0x8(%esp)
+  80280a:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  80280f:	f7 5c 24 0c          	negl   0xc(%esp)
+  802813:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80281a:	00 
+  80281b:	31 c0                	xor    %eax,%eax
+  80281d:	31 d2                	xor    %edx,%edx
+  80281f:	89 fb                	mov    %edi,%ebx
+  802821:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802828:	00 
+  802829:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80282e:	66 90                	xchg   %ax,%ax
+  802830:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802834:	01 c0                	add    %eax,%eax
+  802836:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80283d:	00 
+  80283e:	89 c6                	mov    %eax,%esi
+  802840:	89 d7                	mov    %edx,%edi
+  802842:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802846:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80284a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80284d:	d3 ea                	shr    %cl,%edx
+  80284f:	f6 c1 20             	test   $0x20,%cl
+  802852:	0f 45 c2             	cmovne %edx,%eax
+  802855:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802859:	83 e0 01             	and    $0x1,%eax
+  80285c:	09 fa                	or     %edi,%edx
+  80285e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802862:	89 04 24             	mov    %eax,(%esp)
+  802865:	8b 04 24             	mov    (%esp),%eax
+  802868:	89 d5                	mov    %edx,%ebp
+  80286a:	09 f0                	or     %esi,%eax
+  80286c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802870:	39 f0                	cmp    %esi,%eax
+  802872:	19 fd                	sbb    %edi,%ebp
+  802874:	72 1d                	jb     802893 <__divdi3+0xe3>
+  802876:	29 f0                	sub    %esi,%eax
+  802878:	19 fa                	sbb    %edi,%edx
+  80287a:	89 cf                	mov    %ecx,%edi
+  80287c:	c1 ef 05             	shr    $0x5,%edi
+  80287f:	83 e7 01             	and    $0x1,%edi
+  802882:	89 fe                	mov    %edi,%esi
+  802884:	d3 e7                	shl    %cl,%edi
+  802886:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80288a:	83 f6 01             	xor    $0x1,%esi
+  80288d:	d3 e6                	shl    %cl,%esi
+  80288f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802893:	83 e9 01             	sub    $0x1,%ecx
+  802896:	73 98                	jae    802830 <__divdi3+0x80>
+  802898:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80289c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8028a0:	85 db                	test   %ebx,%ebx
+  8028a2:	0f 84 51 ff ff ff    	je     8027f9 <__divdi3+0x49>
+  8028a8:	f7 d8                	neg    %eax
+  8028aa:	83 d2 00             	adc    $0x0,%edx
+  8028ad:	83 c4 24             	add    $0x24,%esp
+  8028b0:	5b                   	pop    %ebx
+  8028b1:	f7 da                	neg    %edx
+  8028b3:	5e                   	pop    %esi
+  8028b4:	5f                   	pop    %edi
+  8028b5:	5d                   	pop    %ebp
+  8028b6:	c3                   	ret
+  8028b7:	f7 d8                	neg    %eax
+  8028b9:	83 d2 00             	adc    $0x0,%edx
+  8028bc:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8028c0:	f7 da                	neg    %edx
+  8028c2:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8028c6:	85 f6                	test   %esi,%esi
+  8028c8:	78 1b                	js     8028e5 <__divdi3+0x135>
+  8028ca:	89 f1                	mov    %esi,%ecx
+  8028cc:	31 c0                	xor    %eax,%eax
+  8028ce:	31 d2                	xor    %edx,%edx
+  8028d0:	bf 01 00 00 00       	mov    $0x1,%edi
+  8028d5:	09 d9                	or     %ebx,%ecx
+  8028d7:	0f 85 36 ff ff ff    	jne    802813 <__divdi3+0x63>
+  8028dd:	83 c4 24             	add    $0x24,%esp
+  8028e0:	5b                   	pop    %ebx
+  8028e1:	5e                   	pop    %esi
+  8028e2:	5f                   	pop    %edi
+  8028e3:	5d                   	pop    %ebp
+  8028e4:	c3                   	ret
+  8028e5:	31 ff                	xor    %edi,%edi
+  8028e7:	e9 1a ff ff ff       	jmp    802806 <__divdi3+0x56>
+  8028ec:	31 ff                	xor    %edi,%edi
+  8028ee:	e9 20 ff ff ff       	jmp    802813 <__divdi3+0x63>
+  8028f3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8028fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00802900 <__moddi3>:
+  802900:	55                   	push   %ebp
+  802901:	57                   	push   %edi
+  802902:	56                   	push   %esi
+  802903:	53                   	push   %ebx
+  802904:	83 ec 1c             	sub    $0x1c,%esp
+  802907:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  80290b:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  80290f:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  802913:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  802917:	89 c8                	mov    %ecx,%eax
+  802919:	89 f2                	mov    %esi,%edx
+  80291b:	89 f3                	mov    %esi,%ebx
+  80291d:	85 ed                	test   %ebp,%ebp
+  80291f:	0f 88 9d 00 00 00    	js     8029c2 <__moddi3+0xc2>
+  802925:	09 cb                	or     %ecx,%ebx
+  802927:	0f 84 8d 00 00 00    	je     8029ba <__moddi3+0xba>
+  80292d:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802931:	31 db                	xor    %ebx,%ebx
+  802933:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802937:	89 ca                	mov    %ecx,%edx
+  802939:	89 f0                	mov    %esi,%eax
+  80293b:	89 dd                	mov    %ebx,%ebp
+  80293d:	f7 da                	neg    %edx
+  80293f:	83 d0 00             	adc    $0x0,%eax
+  802942:	f7 d8                	neg    %eax
+  802944:	0f 49 f0             	cmovns %eax,%esi
+  802947:	0f 49 ca             	cmovns %edx,%ecx
+  80294a:	31 c0                	xor    %eax,%eax
+  80294c:	31 d2                	xor    %edx,%edx
+  80294e:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802952:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802956:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80295b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80295f:	90                   	nop
+  802960:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802964:	01 c0                	add    %eax,%eax
+  802966:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80296d:	00 
+  80296e:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  802972:	89 c6                	mov    %eax,%esi
+  802974:	89 d7                	mov    %edx,%edi
+  802976:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80297a:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80297e:	0f ad d0             	shrd   %cl,%edx,%eax
+  802981:	d3 ea                	shr    %cl,%edx
+  802983:	f6 c1 20             	test   $0x20,%cl
+  802986:	0f 45 c2             	cmovne %edx,%eax
+  802989:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80298d:	83 e0 01             	and    $0x1,%eax
+  802990:	09 fa                	or     %edi,%edx
+  802992:	89 04 24             	mov    %eax,(%esp)
+  802995:	8b 04 24             	mov    (%esp),%eax
+  802998:	89 d7                	mov    %edx,%edi
+  80299a:	09 f0                	or     %esi,%eax
+  80299c:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  8029a0:	39 d8                	cmp    %ebx,%eax
+  8029a2:	19 f7                	sbb    %esi,%edi
+  8029a4:	72 04                	jb     8029aa <__moddi3+0xaa>
+  8029a6:	29 d8                	sub    %ebx,%eax
+  8029a8:	19 f2                	sbb    %esi,%edx
+  8029aa:	83 e9 01             	sub    $0x1,%ecx
+  8029ad:	73 b1                	jae    802960 <__moddi3+0x60>
+  8029af:	85 ed                	test   %ebp,%ebp
+  8029b1:	74 07                	je     8029ba <__moddi3+0xba>
+  8029b3:	f7 d8                	neg    %eax
+  8029b5:	83 d2 00             	adc    $0x0,%edx
+  8029b8:	f7 da                	neg    %edx
+  8029ba:	83 c4 1c             	add    $0x1c,%esp
+  8029bd:	5b                   	pop    %ebx
+  8029be:	5e                   	pop    %esi
+  8029bf:	5f                   	pop    %edi
+  8029c0:	5d                   	pop    %ebp
+  8029c1:	c3                   	ret
+  8029c2:	09 cb                	or     %ecx,%ebx
+  8029c4:	74 f4                	je     8029ba <__moddi3+0xba>
+  8029c6:	f7 df                	neg    %edi
+  8029c8:	bb 01 00 00 00       	mov    $0x1,%ebx
+  8029cd:	83 d5 00             	adc    $0x0,%ebp
+  8029d0:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  8029d4:	f7 dd                	neg    %ebp
+  8029d6:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  8029da:	e9 58 ff ff ff       	jmp    802937 <__moddi3+0x37>
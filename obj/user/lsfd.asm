@@ -0,0 +1,5747 @@
+
+obj/user/lsfd.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 e0 00 00 00       	call   800111 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <usage>:
+#include <inc/lib.h>
+
+void
+usage(void)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 14             	sub    $0x14,%esp
+	cprintf("usage: lsfd [-1]\n");
+  800039:	68 20 28 80 00       	push   $0x802820
+  80003e:	e8 c6 01 00 00       	call   800209 <cprintf>
+	exit();
+  800043:	e8 12 01 00 00       	call   80015a <exit>
+}
+  800048:	83 c4 10             	add    $0x10,%esp
+  80004b:	c9                   	leave
+  80004c:	c3                   	ret
+
+0080004d <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  80004d:	55                   	push   %ebp
+  80004e:	89 e5                	mov    %esp,%ebp
+  800050:	57                   	push   %edi
+  800051:	56                   	push   %esi
+  800052:	53                   	push   %ebx
+  800053:	81 ec b0 00 00 00    	sub    $0xb0,%esp
+	int i, usefprint = 0;
+	struct Stat st;
+	struct Argstate args;
+
+	argstart(&argc, argv, &args);
+  800059:	8d 85 4c ff ff ff    	lea    -0xb4(%ebp),%eax
+  80005f:	50                   	push   %eax
+  800060:	ff 75 0c             	push   0xc(%ebp)
+  800063:	8d 45 08             	lea    0x8(%ebp),%eax
+  800066:	50                   	push   %eax
+  800067:	e8 15 0e 00 00       	call   800e81 <argstart>
+	while ((i = argnext(&args)) >= 0)
+  80006c:	83 c4 10             	add    $0x10,%esp
+	int i, usefprint = 0;
+  80006f:	be 00 00 00 00       	mov    $0x0,%esi
+	while ((i = argnext(&args)) >= 0)
+  800074:	8d 9d 4c ff ff ff    	lea    -0xb4(%ebp),%ebx
+		if (i == '1')
+			usefprint = 1;
+  80007a:	bf 01 00 00 00       	mov    $0x1,%edi
+	while ((i = argnext(&args)) >= 0)
+  80007f:	83 ec 0c             	sub    $0xc,%esp
+  800082:	53                   	push   %ebx
+  800083:	e8 29 0e 00 00       	call   800eb1 <argnext>
+  800088:	83 c4 10             	add    $0x10,%esp
+  80008b:	85 c0                	test   %eax,%eax
+  80008d:	78 10                	js     80009f <umain+0x52>
+		if (i == '1')
+  80008f:	83 f8 31             	cmp    $0x31,%eax
+  800092:	75 04                	jne    800098 <umain+0x4b>
+			usefprint = 1;
+  800094:	89 fe                	mov    %edi,%esi
+  800096:	eb e7                	jmp    80007f <umain+0x32>
+		else
+			usage();
+  800098:	e8 96 ff ff ff       	call   800033 <usage>
+  80009d:	eb e0                	jmp    80007f <umain+0x32>
+
+	for (i = 0; i < 32; i++)
+  80009f:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (fstat(i, &st) >= 0) {
+  8000a4:	8d bd 5c ff ff ff    	lea    -0xa4(%ebp),%edi
+  8000aa:	eb 26                	jmp    8000d2 <umain+0x85>
+			if (usefprint)
+				fprintf(1, "fd %d: name %s isdir %d size %d dev %s\n",
+					i, st.st_name, st.st_isdir,
+					st.st_size, st.st_dev->dev_name);
+			else
+				cprintf("fd %d: name %s isdir %d size %d dev %s\n",
+  8000ac:	83 ec 08             	sub    $0x8,%esp
+  8000af:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8000b2:	ff 70 04             	push   0x4(%eax)
+  8000b5:	ff 75 dc             	push   -0x24(%ebp)
+  8000b8:	ff 75 e0             	push   -0x20(%ebp)
+  8000bb:	57                   	push   %edi
+  8000bc:	53                   	push   %ebx
+  8000bd:	68 34 28 80 00       	push   $0x802834
+  8000c2:	e8 42 01 00 00       	call   800209 <cprintf>
+  8000c7:	83 c4 20             	add    $0x20,%esp
+	for (i = 0; i < 32; i++)
+  8000ca:	83 c3 01             	add    $0x1,%ebx
+  8000cd:	83 fb 20             	cmp    $0x20,%ebx
+  8000d0:	74 37                	je     800109 <umain+0xbc>
+		if (fstat(i, &st) >= 0) {
+  8000d2:	83 ec 08             	sub    $0x8,%esp
+  8000d5:	57                   	push   %edi
+  8000d6:	53                   	push   %ebx
+  8000d7:	e8 cf 13 00 00       	call   8014ab <fstat>
+  8000dc:	83 c4 10             	add    $0x10,%esp
+  8000df:	85 c0                	test   %eax,%eax
+  8000e1:	78 e7                	js     8000ca <umain+0x7d>
+			if (usefprint)
+  8000e3:	85 f6                	test   %esi,%esi
+  8000e5:	74 c5                	je     8000ac <umain+0x5f>
+				fprintf(1, "fd %d: name %s isdir %d size %d dev %s\n",
+  8000e7:	83 ec 04             	sub    $0x4,%esp
+  8000ea:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8000ed:	ff 70 04             	push   0x4(%eax)
+  8000f0:	ff 75 dc             	push   -0x24(%ebp)
+  8000f3:	ff 75 e0             	push   -0x20(%ebp)
+  8000f6:	57                   	push   %edi
+  8000f7:	53                   	push   %ebx
+  8000f8:	68 34 28 80 00       	push   $0x802834
+  8000fd:	6a 01                	push   $0x1
+  8000ff:	e8 9e 17 00 00       	call   8018a2 <fprintf>
+  800104:	83 c4 20             	add    $0x20,%esp
+  800107:	eb c1                	jmp    8000ca <umain+0x7d>
+					i, st.st_name, st.st_isdir,
+					st.st_size, st.st_dev->dev_name);
+		}
+}
+  800109:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80010c:	5b                   	pop    %ebx
+  80010d:	5e                   	pop    %esi
+  80010e:	5f                   	pop    %edi
+  80010f:	5d                   	pop    %ebp
+  800110:	c3                   	ret
+
+00800111 <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  800111:	55                   	push   %ebp
+  800112:	89 e5                	mov    %esp,%ebp
+  800114:	56                   	push   %esi
+  800115:	53                   	push   %ebx
+  800116:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800119:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  80011c:	e8 4f 0a 00 00       	call   800b70 <sys_getenvid>
+  800121:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800126:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800129:	c1 e0 04             	shl    $0x4,%eax
+  80012c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800131:	a3 08 40 80 00       	mov    %eax,0x804008
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800136:	85 db                	test   %ebx,%ebx
+  800138:	7e 07                	jle    800141 <libmain+0x30>
+    binaryname = argv[0];
+  80013a:	8b 06                	mov    (%esi),%eax
+  80013c:	a3 00 30 80 00       	mov    %eax,0x803000
+
+  // call user main routine
+  umain(argc, argv);
+  800141:	83 ec 08             	sub    $0x8,%esp
+  800144:	56                   	push   %esi
+  800145:	53                   	push   %ebx
+  800146:	e8 02 ff ff ff       	call   80004d <umain>
+
+  // exit gracefully
+  exit();
+  80014b:	e8 0a 00 00 00       	call   80015a <exit>
+}
+  800150:	83 c4 10             	add    $0x10,%esp
+  800153:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800156:	5b                   	pop    %ebx
+  800157:	5e                   	pop    %esi
+  800158:	5d                   	pop    %ebp
+  800159:	c3                   	ret
+
+0080015a <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80015a:	55                   	push   %ebp
+  80015b:	89 e5                	mov    %esp,%ebp
+  80015d:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800160:	e8 3f 10 00 00       	call   8011a4 <close_all>
+	sys_env_destroy(0);
+  800165:	83 ec 0c             	sub    $0xc,%esp
+  800168:	6a 00                	push   $0x0
+  80016a:	e8 c0 09 00 00       	call   800b2f <sys_env_destroy>
+}
+  80016f:	83 c4 10             	add    $0x10,%esp
+  800172:	c9                   	leave
+  800173:	c3                   	ret
+
+00800174 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800174:	55                   	push   %ebp
+  800175:	89 e5                	mov    %esp,%ebp
+  800177:	53                   	push   %ebx
+  800178:	83 ec 04             	sub    $0x4,%esp
+  80017b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80017e:	8b 13                	mov    (%ebx),%edx
+  800180:	8d 42 01             	lea    0x1(%edx),%eax
+  800183:	89 03                	mov    %eax,(%ebx)
+  800185:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800188:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80018c:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800191:	74 09                	je     80019c <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800193:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800197:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80019a:	c9                   	leave
+  80019b:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80019c:	83 ec 08             	sub    $0x8,%esp
+  80019f:	68 ff 00 00 00       	push   $0xff
+  8001a4:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001a7:	50                   	push   %eax
+  8001a8:	e8 45 09 00 00       	call   800af2 <sys_cputs>
+		b->idx = 0;
+  8001ad:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001b3:	83 c4 10             	add    $0x10,%esp
+  8001b6:	eb db                	jmp    800193 <putch+0x1f>
+
+008001b8 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001b8:	55                   	push   %ebp
+  8001b9:	89 e5                	mov    %esp,%ebp
+  8001bb:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001c1:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001c8:	00 00 00 
+	b.cnt = 0;
+  8001cb:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001d2:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001d5:	ff 75 0c             	push   0xc(%ebp)
+  8001d8:	ff 75 08             	push   0x8(%ebp)
+  8001db:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001e1:	50                   	push   %eax
+  8001e2:	68 74 01 80 00       	push   $0x800174
+  8001e7:	e8 14 01 00 00       	call   800300 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8001ec:	83 c4 08             	add    $0x8,%esp
+  8001ef:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001f5:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001fb:	50                   	push   %eax
+  8001fc:	e8 f1 08 00 00       	call   800af2 <sys_cputs>
+
+	return b.cnt;
+}
+  800201:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800207:	c9                   	leave
+  800208:	c3                   	ret
+
+00800209 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800209:	55                   	push   %ebp
+  80020a:	89 e5                	mov    %esp,%ebp
+  80020c:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80020f:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800212:	50                   	push   %eax
+  800213:	ff 75 08             	push   0x8(%ebp)
+  800216:	e8 9d ff ff ff       	call   8001b8 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80021b:	c9                   	leave
+  80021c:	c3                   	ret
+
+0080021d <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80021d:	55                   	push   %ebp
+  80021e:	89 e5                	mov    %esp,%ebp
+  800220:	57                   	push   %edi
+  800221:	56                   	push   %esi
+  800222:	53                   	push   %ebx
+  800223:	83 ec 1c             	sub    $0x1c,%esp
+  800226:	89 c7                	mov    %eax,%edi
+  800228:	89 d6                	mov    %edx,%esi
+  80022a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80022d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800230:	89 d1                	mov    %edx,%ecx
+  800232:	89 c2                	mov    %eax,%edx
+  800234:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800237:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80023a:	8b 45 10             	mov    0x10(%ebp),%eax
+  80023d:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800240:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800243:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80024a:	39 c2                	cmp    %eax,%edx
+  80024c:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80024f:	72 3e                	jb     80028f <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800251:	83 ec 0c             	sub    $0xc,%esp
+  800254:	ff 75 18             	push   0x18(%ebp)
+  800257:	83 eb 01             	sub    $0x1,%ebx
+  80025a:	53                   	push   %ebx
+  80025b:	50                   	push   %eax
+  80025c:	83 ec 08             	sub    $0x8,%esp
+  80025f:	ff 75 e4             	push   -0x1c(%ebp)
+  800262:	ff 75 e0             	push   -0x20(%ebp)
+  800265:	ff 75 dc             	push   -0x24(%ebp)
+  800268:	ff 75 d8             	push   -0x28(%ebp)
+  80026b:	e8 20 22 00 00       	call   802490 <__udivdi3>
+  800270:	83 c4 18             	add    $0x18,%esp
+  800273:	52                   	push   %edx
+  800274:	50                   	push   %eax
+  800275:	89 f2                	mov    %esi,%edx
+  800277:	89 f8                	mov    %edi,%eax
+  800279:	e8 9f ff ff ff       	call   80021d <printnum>
+  80027e:	83 c4 20             	add    $0x20,%esp
+  800281:	eb 13                	jmp    800296 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800283:	83 ec 08             	sub    $0x8,%esp
+  800286:	56                   	push   %esi
+  800287:	ff 75 18             	push   0x18(%ebp)
+  80028a:	ff d7                	call   *%edi
+  80028c:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80028f:	83 eb 01             	sub    $0x1,%ebx
+  800292:	85 db                	test   %ebx,%ebx
+  800294:	7f ed                	jg     800283 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800296:	83 ec 08             	sub    $0x8,%esp
+  800299:	56                   	push   %esi
+  80029a:	83 ec 04             	sub    $0x4,%esp
+  80029d:	ff 75 e4             	push   -0x1c(%ebp)
+  8002a0:	ff 75 e0             	push   -0x20(%ebp)
+  8002a3:	ff 75 dc             	push   -0x24(%ebp)
+  8002a6:	ff 75 d8             	push   -0x28(%ebp)
+  8002a9:	e8 b2 22 00 00       	call   802560 <__umoddi3>
+  8002ae:	83 c4 14             	add    $0x14,%esp
+  8002b1:	0f be 80 66 28 80 00 	movsbl 0x802866(%eax),%eax
+  8002b8:	50                   	push   %eax
+  8002b9:	ff d7                	call   *%edi
+}
+  8002bb:	83 c4 10             	add    $0x10,%esp
+  8002be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002c1:	5b                   	pop    %ebx
+  8002c2:	5e                   	pop    %esi
+  8002c3:	5f                   	pop    %edi
+  8002c4:	5d                   	pop    %ebp
+  8002c5:	c3                   	ret
+
+008002c6 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002c6:	55                   	push   %ebp
+  8002c7:	89 e5                	mov    %esp,%ebp
+  8002c9:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8002cc:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002d0:	8b 10                	mov    (%eax),%edx
+  8002d2:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002d5:	73 0a                	jae    8002e1 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8002d7:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002da:	89 08                	mov    %ecx,(%eax)
+  8002dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002df:	88 02                	mov    %al,(%edx)
+}
+  8002e1:	5d                   	pop    %ebp
+  8002e2:	c3                   	ret
+
+008002e3 <printfmt>:
+{
+  8002e3:	55                   	push   %ebp
+  8002e4:	89 e5                	mov    %esp,%ebp
+  8002e6:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8002e9:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8002ec:	50                   	push   %eax
+  8002ed:	ff 75 10             	push   0x10(%ebp)
+  8002f0:	ff 75 0c             	push   0xc(%ebp)
+  8002f3:	ff 75 08             	push   0x8(%ebp)
+  8002f6:	e8 05 00 00 00       	call   800300 <vprintfmt>
+}
+  8002fb:	83 c4 10             	add    $0x10,%esp
+  8002fe:	c9                   	leave
+  8002ff:	c3                   	ret
+
+00800300 <vprintfmt>:
+{
+  800300:	55                   	push   %ebp
+  800301:	89 e5                	mov    %esp,%ebp
+  800303:	57                   	push   %edi
+  800304:	56                   	push   %esi
+  800305:	53                   	push   %ebx
+  800306:	83 ec 2c             	sub    $0x2c,%esp
+  800309:	8b 75 08             	mov    0x8(%ebp),%esi
+  80030c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80030f:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800312:	eb 0a                	jmp    80031e <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800314:	83 ec 08             	sub    $0x8,%esp
+  800317:	53                   	push   %ebx
+  800318:	50                   	push   %eax
+  800319:	ff d6                	call   *%esi
+  80031b:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80031e:	83 c7 01             	add    $0x1,%edi
+  800321:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800325:	83 f8 25             	cmp    $0x25,%eax
+  800328:	74 0c                	je     800336 <vprintfmt+0x36>
+			if (ch == '\0')
+  80032a:	85 c0                	test   %eax,%eax
+  80032c:	75 e6                	jne    800314 <vprintfmt+0x14>
+}
+  80032e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800331:	5b                   	pop    %ebx
+  800332:	5e                   	pop    %esi
+  800333:	5f                   	pop    %edi
+  800334:	5d                   	pop    %ebp
+  800335:	c3                   	ret
+		padc = ' ';
+  800336:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80033a:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800341:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800348:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80034f:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800354:	8d 47 01             	lea    0x1(%edi),%eax
+  800357:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80035a:	0f b6 17             	movzbl (%edi),%edx
+  80035d:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800360:	3c 55                	cmp    $0x55,%al
+  800362:	0f 87 9a 03 00 00    	ja     800702 <vprintfmt+0x402>
+  800368:	0f b6 c0             	movzbl %al,%eax
+  80036b:	ff 24 85 a0 29 80 00 	jmp    *0x8029a0(,%eax,4)
+  800372:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800375:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800379:	eb d9                	jmp    800354 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80037b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80037e:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800382:	eb d0                	jmp    800354 <vprintfmt+0x54>
+  800384:	0f b6 d2             	movzbl %dl,%edx
+  800387:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80038a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80038f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800392:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800395:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800399:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80039c:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80039f:	83 f9 09             	cmp    $0x9,%ecx
+  8003a2:	77 55                	ja     8003f9 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8003a4:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8003a7:	eb e9                	jmp    800392 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8003a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003ac:	8b 00                	mov    (%eax),%eax
+  8003ae:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003b4:	8d 40 04             	lea    0x4(%eax),%eax
+  8003b7:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003ba:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8003bd:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003c1:	79 91                	jns    800354 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8003c3:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003c6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003c9:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003d0:	eb 82                	jmp    800354 <vprintfmt+0x54>
+			if (width < 0)
+  8003d2:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003d5:	85 d2                	test   %edx,%edx
+  8003d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003dc:	0f 49 c2             	cmovns %edx,%eax
+  8003df:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003e2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003e5:	e9 6a ff ff ff       	jmp    800354 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003ea:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8003ed:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8003f4:	e9 5b ff ff ff       	jmp    800354 <vprintfmt+0x54>
+  8003f9:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003fc:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003ff:	eb bc                	jmp    8003bd <vprintfmt+0xbd>
+			lflag++;
+  800401:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800404:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800407:	e9 48 ff ff ff       	jmp    800354 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80040c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80040f:	8d 78 04             	lea    0x4(%eax),%edi
+  800412:	83 ec 08             	sub    $0x8,%esp
+  800415:	53                   	push   %ebx
+  800416:	ff 30                	push   (%eax)
+  800418:	ff d6                	call   *%esi
+			break;
+  80041a:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80041d:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800420:	e9 7c 02 00 00       	jmp    8006a1 <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  800425:	8b 45 14             	mov    0x14(%ebp),%eax
+  800428:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80042b:	8b 10                	mov    (%eax),%edx
+  80042d:	89 d0                	mov    %edx,%eax
+  80042f:	f7 d8                	neg    %eax
+  800431:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800434:	83 f8 10             	cmp    $0x10,%eax
+  800437:	7f 23                	jg     80045c <vprintfmt+0x15c>
+  800439:	8b 14 85 00 2b 80 00 	mov    0x802b00(,%eax,4),%edx
+  800440:	85 d2                	test   %edx,%edx
+  800442:	74 18                	je     80045c <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800444:	52                   	push   %edx
+  800445:	68 39 2c 80 00       	push   $0x802c39
+  80044a:	53                   	push   %ebx
+  80044b:	56                   	push   %esi
+  80044c:	e8 92 fe ff ff       	call   8002e3 <printfmt>
+  800451:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800454:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800457:	e9 45 02 00 00       	jmp    8006a1 <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  80045c:	50                   	push   %eax
+  80045d:	68 7e 28 80 00       	push   $0x80287e
+  800462:	53                   	push   %ebx
+  800463:	56                   	push   %esi
+  800464:	e8 7a fe ff ff       	call   8002e3 <printfmt>
+  800469:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80046c:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80046f:	e9 2d 02 00 00       	jmp    8006a1 <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800474:	8b 45 14             	mov    0x14(%ebp),%eax
+  800477:	83 c0 04             	add    $0x4,%eax
+  80047a:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80047d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800480:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800482:	85 c9                	test   %ecx,%ecx
+  800484:	b8 77 28 80 00       	mov    $0x802877,%eax
+  800489:	0f 45 c1             	cmovne %ecx,%eax
+  80048c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80048f:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800493:	7e 06                	jle    80049b <vprintfmt+0x19b>
+  800495:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800499:	75 0b                	jne    8004a6 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80049b:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80049e:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8004a1:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004a4:	eb 5c                	jmp    800502 <vprintfmt+0x202>
+  8004a6:	83 ec 08             	sub    $0x8,%esp
+  8004a9:	ff 75 d0             	push   -0x30(%ebp)
+  8004ac:	ff 75 cc             	push   -0x34(%ebp)
+  8004af:	e8 eb 02 00 00       	call   80079f <strnlen>
+  8004b4:	89 c2                	mov    %eax,%edx
+  8004b6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004b9:	29 d0                	sub    %edx,%eax
+  8004bb:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8004be:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004c2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004c5:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004c8:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004ca:	eb 0e                	jmp    8004da <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8004cc:	83 ec 08             	sub    $0x8,%esp
+  8004cf:	53                   	push   %ebx
+  8004d0:	57                   	push   %edi
+  8004d1:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004d4:	83 ee 01             	sub    $0x1,%esi
+  8004d7:	83 c4 10             	add    $0x10,%esp
+  8004da:	85 f6                	test   %esi,%esi
+  8004dc:	7f ee                	jg     8004cc <vprintfmt+0x1cc>
+  8004de:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004e1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004e4:	85 c0                	test   %eax,%eax
+  8004e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004eb:	0f 49 d0             	cmovns %eax,%edx
+  8004ee:	29 d0                	sub    %edx,%eax
+  8004f0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004f3:	eb a6                	jmp    80049b <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8004f5:	83 ec 08             	sub    $0x8,%esp
+  8004f8:	53                   	push   %ebx
+  8004f9:	52                   	push   %edx
+  8004fa:	ff 55 08             	call   *0x8(%ebp)
+  8004fd:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800500:	89 f1                	mov    %esi,%ecx
+  800502:	8d 71 01             	lea    0x1(%ecx),%esi
+  800505:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800509:	0f be d0             	movsbl %al,%edx
+  80050c:	85 d2                	test   %edx,%edx
+  80050e:	74 28                	je     800538 <vprintfmt+0x238>
+  800510:	85 ff                	test   %edi,%edi
+  800512:	78 05                	js     800519 <vprintfmt+0x219>
+  800514:	83 ef 01             	sub    $0x1,%edi
+  800517:	78 30                	js     800549 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800519:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80051d:	74 d6                	je     8004f5 <vprintfmt+0x1f5>
+  80051f:	0f be c0             	movsbl %al,%eax
+  800522:	83 e8 20             	sub    $0x20,%eax
+  800525:	83 f8 5e             	cmp    $0x5e,%eax
+  800528:	76 cb                	jbe    8004f5 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80052a:	83 ec 08             	sub    $0x8,%esp
+  80052d:	53                   	push   %ebx
+  80052e:	6a 3f                	push   $0x3f
+  800530:	ff 55 08             	call   *0x8(%ebp)
+  800533:	83 c4 10             	add    $0x10,%esp
+  800536:	eb c8                	jmp    800500 <vprintfmt+0x200>
+  800538:	8b 75 08             	mov    0x8(%ebp),%esi
+  80053b:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80053e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800541:	01 d0                	add    %edx,%eax
+  800543:	29 c8                	sub    %ecx,%eax
+  800545:	89 c7                	mov    %eax,%edi
+  800547:	eb 13                	jmp    80055c <vprintfmt+0x25c>
+  800549:	8b 75 08             	mov    0x8(%ebp),%esi
+  80054c:	eb ed                	jmp    80053b <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80054e:	83 ec 08             	sub    $0x8,%esp
+  800551:	53                   	push   %ebx
+  800552:	6a 20                	push   $0x20
+  800554:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800556:	83 ef 01             	sub    $0x1,%edi
+  800559:	83 c4 10             	add    $0x10,%esp
+  80055c:	85 ff                	test   %edi,%edi
+  80055e:	7f ee                	jg     80054e <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800560:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800563:	89 45 14             	mov    %eax,0x14(%ebp)
+  800566:	e9 36 01 00 00       	jmp    8006a1 <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  80056b:	83 f9 01             	cmp    $0x1,%ecx
+  80056e:	7f 1f                	jg     80058f <vprintfmt+0x28f>
+	else if (lflag)
+  800570:	85 c9                	test   %ecx,%ecx
+  800572:	74 67                	je     8005db <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800574:	8b 45 14             	mov    0x14(%ebp),%eax
+  800577:	8b 00                	mov    (%eax),%eax
+  800579:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80057c:	89 c1                	mov    %eax,%ecx
+  80057e:	c1 f9 1f             	sar    $0x1f,%ecx
+  800581:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800584:	8b 45 14             	mov    0x14(%ebp),%eax
+  800587:	8d 40 04             	lea    0x4(%eax),%eax
+  80058a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80058d:	eb 17                	jmp    8005a6 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  80058f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800592:	8b 50 04             	mov    0x4(%eax),%edx
+  800595:	8b 00                	mov    (%eax),%eax
+  800597:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80059a:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80059d:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a0:	8d 40 08             	lea    0x8(%eax),%eax
+  8005a3:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8005a6:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005a9:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8005ac:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8005b1:	85 c9                	test   %ecx,%ecx
+  8005b3:	0f 89 ce 00 00 00    	jns    800687 <vprintfmt+0x387>
+				putch('-', putdat);
+  8005b9:	83 ec 08             	sub    $0x8,%esp
+  8005bc:	53                   	push   %ebx
+  8005bd:	6a 2d                	push   $0x2d
+  8005bf:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8005c1:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005c4:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005c7:	f7 da                	neg    %edx
+  8005c9:	83 d1 00             	adc    $0x0,%ecx
+  8005cc:	f7 d9                	neg    %ecx
+  8005ce:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8005d1:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005d6:	e9 ac 00 00 00       	jmp    800687 <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  8005db:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005de:	8b 00                	mov    (%eax),%eax
+  8005e0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005e3:	89 c1                	mov    %eax,%ecx
+  8005e5:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005e8:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005eb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ee:	8d 40 04             	lea    0x4(%eax),%eax
+  8005f1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005f4:	eb b0                	jmp    8005a6 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8005f6:	83 f9 01             	cmp    $0x1,%ecx
+  8005f9:	7f 1b                	jg     800616 <vprintfmt+0x316>
+	else if (lflag)
+  8005fb:	85 c9                	test   %ecx,%ecx
+  8005fd:	74 2c                	je     80062b <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  8005ff:	8b 45 14             	mov    0x14(%ebp),%eax
+  800602:	8b 10                	mov    (%eax),%edx
+  800604:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800609:	8d 40 04             	lea    0x4(%eax),%eax
+  80060c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80060f:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800614:	eb 71                	jmp    800687 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  800616:	8b 45 14             	mov    0x14(%ebp),%eax
+  800619:	8b 10                	mov    (%eax),%edx
+  80061b:	8b 48 04             	mov    0x4(%eax),%ecx
+  80061e:	8d 40 08             	lea    0x8(%eax),%eax
+  800621:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800624:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800629:	eb 5c                	jmp    800687 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  80062b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062e:	8b 10                	mov    (%eax),%edx
+  800630:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800635:	8d 40 04             	lea    0x4(%eax),%eax
+  800638:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80063b:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800640:	eb 45                	jmp    800687 <vprintfmt+0x387>
+			putch('X', putdat);
+  800642:	83 ec 08             	sub    $0x8,%esp
+  800645:	53                   	push   %ebx
+  800646:	6a 58                	push   $0x58
+  800648:	ff d6                	call   *%esi
+			putch('X', putdat);
+  80064a:	83 c4 08             	add    $0x8,%esp
+  80064d:	53                   	push   %ebx
+  80064e:	6a 58                	push   $0x58
+  800650:	ff d6                	call   *%esi
+			putch('X', putdat);
+  800652:	83 c4 08             	add    $0x8,%esp
+  800655:	53                   	push   %ebx
+  800656:	6a 58                	push   $0x58
+  800658:	ff d6                	call   *%esi
+			break;
+  80065a:	83 c4 10             	add    $0x10,%esp
+  80065d:	eb 42                	jmp    8006a1 <vprintfmt+0x3a1>
+			putch('0', putdat);
+  80065f:	83 ec 08             	sub    $0x8,%esp
+  800662:	53                   	push   %ebx
+  800663:	6a 30                	push   $0x30
+  800665:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800667:	83 c4 08             	add    $0x8,%esp
+  80066a:	53                   	push   %ebx
+  80066b:	6a 78                	push   $0x78
+  80066d:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  80066f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800672:	8b 10                	mov    (%eax),%edx
+  800674:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800679:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80067c:	8d 40 04             	lea    0x4(%eax),%eax
+  80067f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800682:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800687:	83 ec 0c             	sub    $0xc,%esp
+  80068a:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80068e:	50                   	push   %eax
+  80068f:	ff 75 e0             	push   -0x20(%ebp)
+  800692:	57                   	push   %edi
+  800693:	51                   	push   %ecx
+  800694:	52                   	push   %edx
+  800695:	89 da                	mov    %ebx,%edx
+  800697:	89 f0                	mov    %esi,%eax
+  800699:	e8 7f fb ff ff       	call   80021d <printnum>
+			break;
+  80069e:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8006a1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8006a4:	e9 75 fc ff ff       	jmp    80031e <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8006a9:	83 f9 01             	cmp    $0x1,%ecx
+  8006ac:	7f 1b                	jg     8006c9 <vprintfmt+0x3c9>
+	else if (lflag)
+  8006ae:	85 c9                	test   %ecx,%ecx
+  8006b0:	74 2c                	je     8006de <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  8006b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b5:	8b 10                	mov    (%eax),%edx
+  8006b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006bc:	8d 40 04             	lea    0x4(%eax),%eax
+  8006bf:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006c2:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8006c7:	eb be                	jmp    800687 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  8006c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006cc:	8b 10                	mov    (%eax),%edx
+  8006ce:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006d1:	8d 40 08             	lea    0x8(%eax),%eax
+  8006d4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006d7:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8006dc:	eb a9                	jmp    800687 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  8006de:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e1:	8b 10                	mov    (%eax),%edx
+  8006e3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006e8:	8d 40 04             	lea    0x4(%eax),%eax
+  8006eb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006ee:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8006f3:	eb 92                	jmp    800687 <vprintfmt+0x387>
+			putch(ch, putdat);
+  8006f5:	83 ec 08             	sub    $0x8,%esp
+  8006f8:	53                   	push   %ebx
+  8006f9:	6a 25                	push   $0x25
+  8006fb:	ff d6                	call   *%esi
+			break;
+  8006fd:	83 c4 10             	add    $0x10,%esp
+  800700:	eb 9f                	jmp    8006a1 <vprintfmt+0x3a1>
+			putch('%', putdat);
+  800702:	83 ec 08             	sub    $0x8,%esp
+  800705:	53                   	push   %ebx
+  800706:	6a 25                	push   $0x25
+  800708:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80070a:	83 c4 10             	add    $0x10,%esp
+  80070d:	89 f8                	mov    %edi,%eax
+  80070f:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800713:	74 05                	je     80071a <vprintfmt+0x41a>
+  800715:	83 e8 01             	sub    $0x1,%eax
+  800718:	eb f5                	jmp    80070f <vprintfmt+0x40f>
+  80071a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80071d:	eb 82                	jmp    8006a1 <vprintfmt+0x3a1>
+
+0080071f <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80071f:	55                   	push   %ebp
+  800720:	89 e5                	mov    %esp,%ebp
+  800722:	83 ec 18             	sub    $0x18,%esp
+  800725:	8b 45 08             	mov    0x8(%ebp),%eax
+  800728:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80072b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80072e:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800732:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800735:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80073c:	85 c0                	test   %eax,%eax
+  80073e:	74 26                	je     800766 <vsnprintf+0x47>
+  800740:	85 d2                	test   %edx,%edx
+  800742:	7e 22                	jle    800766 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800744:	ff 75 14             	push   0x14(%ebp)
+  800747:	ff 75 10             	push   0x10(%ebp)
+  80074a:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80074d:	50                   	push   %eax
+  80074e:	68 c6 02 80 00       	push   $0x8002c6
+  800753:	e8 a8 fb ff ff       	call   800300 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800758:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80075b:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80075e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800761:	83 c4 10             	add    $0x10,%esp
+}
+  800764:	c9                   	leave
+  800765:	c3                   	ret
+		return -E_INVAL;
+  800766:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80076b:	eb f7                	jmp    800764 <vsnprintf+0x45>
+
+0080076d <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80076d:	55                   	push   %ebp
+  80076e:	89 e5                	mov    %esp,%ebp
+  800770:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800773:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800776:	50                   	push   %eax
+  800777:	ff 75 10             	push   0x10(%ebp)
+  80077a:	ff 75 0c             	push   0xc(%ebp)
+  80077d:	ff 75 08             	push   0x8(%ebp)
+  800780:	e8 9a ff ff ff       	call   80071f <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800785:	c9                   	leave
+  800786:	c3                   	ret
+
+00800787 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800787:	55                   	push   %ebp
+  800788:	89 e5                	mov    %esp,%ebp
+  80078a:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80078d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800792:	eb 03                	jmp    800797 <strlen+0x10>
+		n++;
+  800794:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800797:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80079b:	75 f7                	jne    800794 <strlen+0xd>
+	return n;
+}
+  80079d:	5d                   	pop    %ebp
+  80079e:	c3                   	ret
+
+0080079f <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80079f:	55                   	push   %ebp
+  8007a0:	89 e5                	mov    %esp,%ebp
+  8007a2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007a5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ad:	eb 03                	jmp    8007b2 <strnlen+0x13>
+		n++;
+  8007af:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007b2:	39 d0                	cmp    %edx,%eax
+  8007b4:	74 08                	je     8007be <strnlen+0x1f>
+  8007b6:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8007ba:	75 f3                	jne    8007af <strnlen+0x10>
+  8007bc:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8007be:	89 d0                	mov    %edx,%eax
+  8007c0:	5d                   	pop    %ebp
+  8007c1:	c3                   	ret
+
+008007c2 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8007c2:	55                   	push   %ebp
+  8007c3:	89 e5                	mov    %esp,%ebp
+  8007c5:	53                   	push   %ebx
+  8007c6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007c9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8007cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007d1:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8007d5:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8007d8:	83 c0 01             	add    $0x1,%eax
+  8007db:	84 d2                	test   %dl,%dl
+  8007dd:	75 f2                	jne    8007d1 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8007df:	89 c8                	mov    %ecx,%eax
+  8007e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007e4:	c9                   	leave
+  8007e5:	c3                   	ret
+
+008007e6 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8007e6:	55                   	push   %ebp
+  8007e7:	89 e5                	mov    %esp,%ebp
+  8007e9:	53                   	push   %ebx
+  8007ea:	83 ec 10             	sub    $0x10,%esp
+  8007ed:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8007f0:	53                   	push   %ebx
+  8007f1:	e8 91 ff ff ff       	call   800787 <strlen>
+  8007f6:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8007f9:	ff 75 0c             	push   0xc(%ebp)
+  8007fc:	01 d8                	add    %ebx,%eax
+  8007fe:	50                   	push   %eax
+  8007ff:	e8 be ff ff ff       	call   8007c2 <strcpy>
+	return dst;
+}
+  800804:	89 d8                	mov    %ebx,%eax
+  800806:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800809:	c9                   	leave
+  80080a:	c3                   	ret
+
+0080080b <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80080b:	55                   	push   %ebp
+  80080c:	89 e5                	mov    %esp,%ebp
+  80080e:	56                   	push   %esi
+  80080f:	53                   	push   %ebx
+  800810:	8b 75 08             	mov    0x8(%ebp),%esi
+  800813:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800816:	89 f3                	mov    %esi,%ebx
+  800818:	03 5d 10             	add    0x10(%ebp),%ebx
+  80081b:	89 f0                	mov    %esi,%eax
+  80081d:	eb 0f                	jmp    80082e <strncpy+0x23>
+		*dst++ = *src;
+  80081f:	83 c0 01             	add    $0x1,%eax
+  800822:	0f b6 0a             	movzbl (%edx),%ecx
+  800825:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800828:	80 f9 01             	cmp    $0x1,%cl
+  80082b:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80082e:	39 d8                	cmp    %ebx,%eax
+  800830:	75 ed                	jne    80081f <strncpy+0x14>
+	}
+	return ret;
+}
+  800832:	89 f0                	mov    %esi,%eax
+  800834:	5b                   	pop    %ebx
+  800835:	5e                   	pop    %esi
+  800836:	5d                   	pop    %ebp
+  800837:	c3                   	ret
+
+00800838 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800838:	55                   	push   %ebp
+  800839:	89 e5                	mov    %esp,%ebp
+  80083b:	56                   	push   %esi
+  80083c:	53                   	push   %ebx
+  80083d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800840:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800843:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800846:	89 f0                	mov    %esi,%eax
+  800848:	85 d2                	test   %edx,%edx
+  80084a:	74 21                	je     80086d <strlcpy+0x35>
+  80084c:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800850:	89 f2                	mov    %esi,%edx
+  800852:	eb 09                	jmp    80085d <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800854:	83 c1 01             	add    $0x1,%ecx
+  800857:	83 c2 01             	add    $0x1,%edx
+  80085a:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80085d:	39 c2                	cmp    %eax,%edx
+  80085f:	74 09                	je     80086a <strlcpy+0x32>
+  800861:	0f b6 19             	movzbl (%ecx),%ebx
+  800864:	84 db                	test   %bl,%bl
+  800866:	75 ec                	jne    800854 <strlcpy+0x1c>
+  800868:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80086a:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80086d:	29 f0                	sub    %esi,%eax
+}
+  80086f:	5b                   	pop    %ebx
+  800870:	5e                   	pop    %esi
+  800871:	5d                   	pop    %ebp
+  800872:	c3                   	ret
+
+00800873 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800873:	55                   	push   %ebp
+  800874:	89 e5                	mov    %esp,%ebp
+  800876:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800879:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80087c:	eb 06                	jmp    800884 <strcmp+0x11>
+		p++, q++;
+  80087e:	83 c1 01             	add    $0x1,%ecx
+  800881:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800884:	0f b6 01             	movzbl (%ecx),%eax
+  800887:	84 c0                	test   %al,%al
+  800889:	74 04                	je     80088f <strcmp+0x1c>
+  80088b:	3a 02                	cmp    (%edx),%al
+  80088d:	74 ef                	je     80087e <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80088f:	0f b6 c0             	movzbl %al,%eax
+  800892:	0f b6 12             	movzbl (%edx),%edx
+  800895:	29 d0                	sub    %edx,%eax
+}
+  800897:	5d                   	pop    %ebp
+  800898:	c3                   	ret
+
+00800899 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800899:	55                   	push   %ebp
+  80089a:	89 e5                	mov    %esp,%ebp
+  80089c:	53                   	push   %ebx
+  80089d:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008a0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008a3:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8008a6:	eb 09                	jmp    8008b1 <strncmp+0x18>
+		n--, p++, q++;
+  8008a8:	83 ea 01             	sub    $0x1,%edx
+  8008ab:	83 c0 01             	add    $0x1,%eax
+  8008ae:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8008b1:	85 d2                	test   %edx,%edx
+  8008b3:	74 18                	je     8008cd <strncmp+0x34>
+  8008b5:	0f b6 18             	movzbl (%eax),%ebx
+  8008b8:	84 db                	test   %bl,%bl
+  8008ba:	74 04                	je     8008c0 <strncmp+0x27>
+  8008bc:	3a 19                	cmp    (%ecx),%bl
+  8008be:	74 e8                	je     8008a8 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008c0:	0f b6 00             	movzbl (%eax),%eax
+  8008c3:	0f b6 11             	movzbl (%ecx),%edx
+  8008c6:	29 d0                	sub    %edx,%eax
+}
+  8008c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008cb:	c9                   	leave
+  8008cc:	c3                   	ret
+		return 0;
+  8008cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d2:	eb f4                	jmp    8008c8 <strncmp+0x2f>
+
+008008d4 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8008d4:	55                   	push   %ebp
+  8008d5:	89 e5                	mov    %esp,%ebp
+  8008d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008da:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008de:	eb 03                	jmp    8008e3 <strchr+0xf>
+  8008e0:	83 c0 01             	add    $0x1,%eax
+  8008e3:	0f b6 10             	movzbl (%eax),%edx
+  8008e6:	84 d2                	test   %dl,%dl
+  8008e8:	74 06                	je     8008f0 <strchr+0x1c>
+		if (*s == c)
+  8008ea:	38 ca                	cmp    %cl,%dl
+  8008ec:	75 f2                	jne    8008e0 <strchr+0xc>
+  8008ee:	eb 05                	jmp    8008f5 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8008f0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008f5:	5d                   	pop    %ebp
+  8008f6:	c3                   	ret
+
+008008f7 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8008f7:	55                   	push   %ebp
+  8008f8:	89 e5                	mov    %esp,%ebp
+  8008fa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008fd:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800901:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800904:	38 ca                	cmp    %cl,%dl
+  800906:	74 09                	je     800911 <strfind+0x1a>
+  800908:	84 d2                	test   %dl,%dl
+  80090a:	74 05                	je     800911 <strfind+0x1a>
+	for (; *s; s++)
+  80090c:	83 c0 01             	add    $0x1,%eax
+  80090f:	eb f0                	jmp    800901 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800911:	5d                   	pop    %ebp
+  800912:	c3                   	ret
+
+00800913 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800913:	55                   	push   %ebp
+  800914:	89 e5                	mov    %esp,%ebp
+  800916:	57                   	push   %edi
+  800917:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80091a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  80091d:	85 c9                	test   %ecx,%ecx
+  80091f:	74 20                	je     800941 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800921:	89 f8                	mov    %edi,%eax
+  800923:	09 c8                	or     %ecx,%eax
+  800925:	a8 03                	test   $0x3,%al
+  800927:	75 12                	jne    80093b <memset+0x28>
+		c &= 0xFF;
+  800929:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80092d:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800933:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800936:	fc                   	cld
+  800937:	f3 ab                	rep stos %eax,%es:(%edi)
+  800939:	eb 06                	jmp    800941 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80093b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80093e:	fc                   	cld
+  80093f:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800941:	89 f8                	mov    %edi,%eax
+  800943:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800946:	c9                   	leave
+  800947:	c3                   	ret
+
+00800948 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800948:	55                   	push   %ebp
+  800949:	89 e5                	mov    %esp,%ebp
+  80094b:	57                   	push   %edi
+  80094c:	56                   	push   %esi
+  80094d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800950:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800953:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800956:	39 c6                	cmp    %eax,%esi
+  800958:	73 32                	jae    80098c <memmove+0x44>
+  80095a:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80095d:	39 d0                	cmp    %edx,%eax
+  80095f:	73 2b                	jae    80098c <memmove+0x44>
+		s += n;
+		d += n;
+  800961:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800964:	89 d6                	mov    %edx,%esi
+  800966:	09 fe                	or     %edi,%esi
+  800968:	09 ce                	or     %ecx,%esi
+  80096a:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800970:	75 0e                	jne    800980 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800972:	83 ef 04             	sub    $0x4,%edi
+  800975:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800978:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  80097b:	fd                   	std
+  80097c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80097e:	eb 09                	jmp    800989 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800980:	83 ef 01             	sub    $0x1,%edi
+  800983:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800986:	fd                   	std
+  800987:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800989:	fc                   	cld
+  80098a:	eb 1a                	jmp    8009a6 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80098c:	89 f2                	mov    %esi,%edx
+  80098e:	09 c2                	or     %eax,%edx
+  800990:	09 ca                	or     %ecx,%edx
+  800992:	f6 c2 03             	test   $0x3,%dl
+  800995:	75 0a                	jne    8009a1 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800997:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  80099a:	89 c7                	mov    %eax,%edi
+  80099c:	fc                   	cld
+  80099d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80099f:	eb 05                	jmp    8009a6 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8009a1:	89 c7                	mov    %eax,%edi
+  8009a3:	fc                   	cld
+  8009a4:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8009a6:	5e                   	pop    %esi
+  8009a7:	5f                   	pop    %edi
+  8009a8:	5d                   	pop    %ebp
+  8009a9:	c3                   	ret
+
+008009aa <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8009aa:	55                   	push   %ebp
+  8009ab:	89 e5                	mov    %esp,%ebp
+  8009ad:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8009b0:	ff 75 10             	push   0x10(%ebp)
+  8009b3:	ff 75 0c             	push   0xc(%ebp)
+  8009b6:	ff 75 08             	push   0x8(%ebp)
+  8009b9:	e8 8a ff ff ff       	call   800948 <memmove>
+}
+  8009be:	c9                   	leave
+  8009bf:	c3                   	ret
+
+008009c0 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8009c0:	55                   	push   %ebp
+  8009c1:	89 e5                	mov    %esp,%ebp
+  8009c3:	56                   	push   %esi
+  8009c4:	53                   	push   %ebx
+  8009c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009c8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8009cb:	89 c6                	mov    %eax,%esi
+  8009cd:	03 75 10             	add    0x10(%ebp),%esi
+  8009d0:	eb 06                	jmp    8009d8 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8009d2:	83 c0 01             	add    $0x1,%eax
+  8009d5:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  8009d8:	39 f0                	cmp    %esi,%eax
+  8009da:	74 14                	je     8009f0 <memcmp+0x30>
+		if (*s1 != *s2)
+  8009dc:	0f b6 08             	movzbl (%eax),%ecx
+  8009df:	0f b6 1a             	movzbl (%edx),%ebx
+  8009e2:	38 d9                	cmp    %bl,%cl
+  8009e4:	74 ec                	je     8009d2 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  8009e6:	0f b6 c1             	movzbl %cl,%eax
+  8009e9:	0f b6 db             	movzbl %bl,%ebx
+  8009ec:	29 d8                	sub    %ebx,%eax
+  8009ee:	eb 05                	jmp    8009f5 <memcmp+0x35>
+	}
+
+	return 0;
+  8009f0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009f5:	5b                   	pop    %ebx
+  8009f6:	5e                   	pop    %esi
+  8009f7:	5d                   	pop    %ebp
+  8009f8:	c3                   	ret
+
+008009f9 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8009f9:	55                   	push   %ebp
+  8009fa:	89 e5                	mov    %esp,%ebp
+  8009fc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009ff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a02:	89 c2                	mov    %eax,%edx
+  800a04:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a07:	eb 03                	jmp    800a0c <memfind+0x13>
+  800a09:	83 c0 01             	add    $0x1,%eax
+  800a0c:	39 d0                	cmp    %edx,%eax
+  800a0e:	73 04                	jae    800a14 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a10:	38 08                	cmp    %cl,(%eax)
+  800a12:	75 f5                	jne    800a09 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a14:	5d                   	pop    %ebp
+  800a15:	c3                   	ret
+
+00800a16 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a16:	55                   	push   %ebp
+  800a17:	89 e5                	mov    %esp,%ebp
+  800a19:	57                   	push   %edi
+  800a1a:	56                   	push   %esi
+  800a1b:	53                   	push   %ebx
+  800a1c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a1f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a22:	eb 03                	jmp    800a27 <strtol+0x11>
+		s++;
+  800a24:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a27:	0f b6 02             	movzbl (%edx),%eax
+  800a2a:	3c 20                	cmp    $0x20,%al
+  800a2c:	74 f6                	je     800a24 <strtol+0xe>
+  800a2e:	3c 09                	cmp    $0x9,%al
+  800a30:	74 f2                	je     800a24 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a32:	3c 2b                	cmp    $0x2b,%al
+  800a34:	74 2a                	je     800a60 <strtol+0x4a>
+	int neg = 0;
+  800a36:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a3b:	3c 2d                	cmp    $0x2d,%al
+  800a3d:	74 2b                	je     800a6a <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a3f:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a45:	75 0f                	jne    800a56 <strtol+0x40>
+  800a47:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a4a:	74 28                	je     800a74 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a4c:	85 db                	test   %ebx,%ebx
+  800a4e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a53:	0f 44 d8             	cmove  %eax,%ebx
+  800a56:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a5b:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a5e:	eb 46                	jmp    800aa6 <strtol+0x90>
+		s++;
+  800a60:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a63:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a68:	eb d5                	jmp    800a3f <strtol+0x29>
+		s++, neg = 1;
+  800a6a:	83 c2 01             	add    $0x1,%edx
+  800a6d:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a72:	eb cb                	jmp    800a3f <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a74:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a78:	74 0e                	je     800a88 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a7a:	85 db                	test   %ebx,%ebx
+  800a7c:	75 d8                	jne    800a56 <strtol+0x40>
+		s++, base = 8;
+  800a7e:	83 c2 01             	add    $0x1,%edx
+  800a81:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a86:	eb ce                	jmp    800a56 <strtol+0x40>
+		s += 2, base = 16;
+  800a88:	83 c2 02             	add    $0x2,%edx
+  800a8b:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a90:	eb c4                	jmp    800a56 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a92:	0f be c0             	movsbl %al,%eax
+  800a95:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a98:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a9b:	7d 3a                	jge    800ad7 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a9d:	83 c2 01             	add    $0x1,%edx
+  800aa0:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800aa4:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800aa6:	0f b6 02             	movzbl (%edx),%eax
+  800aa9:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800aac:	89 f3                	mov    %esi,%ebx
+  800aae:	80 fb 09             	cmp    $0x9,%bl
+  800ab1:	76 df                	jbe    800a92 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800ab3:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800ab6:	89 f3                	mov    %esi,%ebx
+  800ab8:	80 fb 19             	cmp    $0x19,%bl
+  800abb:	77 08                	ja     800ac5 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800abd:	0f be c0             	movsbl %al,%eax
+  800ac0:	83 e8 57             	sub    $0x57,%eax
+  800ac3:	eb d3                	jmp    800a98 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800ac5:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800ac8:	89 f3                	mov    %esi,%ebx
+  800aca:	80 fb 19             	cmp    $0x19,%bl
+  800acd:	77 08                	ja     800ad7 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800acf:	0f be c0             	movsbl %al,%eax
+  800ad2:	83 e8 37             	sub    $0x37,%eax
+  800ad5:	eb c1                	jmp    800a98 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800ad7:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800adb:	74 05                	je     800ae2 <strtol+0xcc>
+		*endptr = (char *) s;
+  800add:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ae0:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800ae2:	89 c8                	mov    %ecx,%eax
+  800ae4:	f7 d8                	neg    %eax
+  800ae6:	85 ff                	test   %edi,%edi
+  800ae8:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800aeb:	89 c8                	mov    %ecx,%eax
+  800aed:	5b                   	pop    %ebx
+  800aee:	5e                   	pop    %esi
+  800aef:	5f                   	pop    %edi
+  800af0:	5d                   	pop    %ebp
+  800af1:	c3                   	ret
+
+00800af2 <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800af2:	55                   	push   %ebp
+  800af3:	89 e5                	mov    %esp,%ebp
+  800af5:	57                   	push   %edi
+  800af6:	56                   	push   %esi
+  800af7:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800af8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800afd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b00:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b03:	89 c3                	mov    %eax,%ebx
+  800b05:	89 c7                	mov    %eax,%edi
+  800b07:	89 c6                	mov    %eax,%esi
+  800b09:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  800b0b:	5b                   	pop    %ebx
+  800b0c:	5e                   	pop    %esi
+  800b0d:	5f                   	pop    %edi
+  800b0e:	5d                   	pop    %ebp
+  800b0f:	c3                   	ret
+
+00800b10 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800b10:	55                   	push   %ebp
+  800b11:	89 e5                	mov    %esp,%ebp
+  800b13:	57                   	push   %edi
+  800b14:	56                   	push   %esi
+  800b15:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800b16:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b1b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b20:	89 d1                	mov    %edx,%ecx
+  800b22:	89 d3                	mov    %edx,%ebx
+  800b24:	89 d7                	mov    %edx,%edi
+  800b26:	89 d6                	mov    %edx,%esi
+  800b28:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800b2a:	5b                   	pop    %ebx
+  800b2b:	5e                   	pop    %esi
+  800b2c:	5f                   	pop    %edi
+  800b2d:	5d                   	pop    %ebp
+  800b2e:	c3                   	ret
+
+00800b2f <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800b2f:	55                   	push   %ebp
+  800b30:	89 e5                	mov    %esp,%ebp
+  800b32:	57                   	push   %edi
+  800b33:	56                   	push   %esi
+  800b34:	53                   	push   %ebx
+  800b35:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800b38:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b3d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b40:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b45:	89 cb                	mov    %ecx,%ebx
+  800b47:	89 cf                	mov    %ecx,%edi
+  800b49:	89 ce                	mov    %ecx,%esi
+  800b4b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800b4d:	85 c0                	test   %eax,%eax
+  800b4f:	7f 08                	jg     800b59 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800b51:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b54:	5b                   	pop    %ebx
+  800b55:	5e                   	pop    %esi
+  800b56:	5f                   	pop    %edi
+  800b57:	5d                   	pop    %ebp
+  800b58:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800b59:	83 ec 0c             	sub    $0xc,%esp
+  800b5c:	50                   	push   %eax
+  800b5d:	6a 03                	push   $0x3
+  800b5f:	68 63 2b 80 00       	push   $0x802b63
+  800b64:	6a 3e                	push   $0x3e
+  800b66:	68 80 2b 80 00       	push   $0x802b80
+  800b6b:	e8 85 16 00 00       	call   8021f5 <_panic>
+
+00800b70 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800b70:	55                   	push   %ebp
+  800b71:	89 e5                	mov    %esp,%ebp
+  800b73:	57                   	push   %edi
+  800b74:	56                   	push   %esi
+  800b75:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800b76:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b7b:	b8 02 00 00 00       	mov    $0x2,%eax
+  800b80:	89 d1                	mov    %edx,%ecx
+  800b82:	89 d3                	mov    %edx,%ebx
+  800b84:	89 d7                	mov    %edx,%edi
+  800b86:	89 d6                	mov    %edx,%esi
+  800b88:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800b8a:	5b                   	pop    %ebx
+  800b8b:	5e                   	pop    %esi
+  800b8c:	5f                   	pop    %edi
+  800b8d:	5d                   	pop    %ebp
+  800b8e:	c3                   	ret
+
+00800b8f <sys_yield>:
+
+void
+sys_yield(void) {
+  800b8f:	55                   	push   %ebp
+  800b90:	89 e5                	mov    %esp,%ebp
+  800b92:	57                   	push   %edi
+  800b93:	56                   	push   %esi
+  800b94:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800b95:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b9a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800b9f:	89 d1                	mov    %edx,%ecx
+  800ba1:	89 d3                	mov    %edx,%ebx
+  800ba3:	89 d7                	mov    %edx,%edi
+  800ba5:	89 d6                	mov    %edx,%esi
+  800ba7:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800ba9:	5b                   	pop    %ebx
+  800baa:	5e                   	pop    %esi
+  800bab:	5f                   	pop    %edi
+  800bac:	5d                   	pop    %ebp
+  800bad:	c3                   	ret
+
+00800bae <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  800bae:	55                   	push   %ebp
+  800baf:	89 e5                	mov    %esp,%ebp
+  800bb1:	57                   	push   %edi
+  800bb2:	56                   	push   %esi
+  800bb3:	53                   	push   %ebx
+  800bb4:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800bb7:	be 00 00 00 00       	mov    $0x0,%esi
+  800bbc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bbf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bc2:	b8 04 00 00 00       	mov    $0x4,%eax
+  800bc7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bca:	89 f7                	mov    %esi,%edi
+  800bcc:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800bce:	85 c0                	test   %eax,%eax
+  800bd0:	7f 08                	jg     800bda <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800bd2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bd5:	5b                   	pop    %ebx
+  800bd6:	5e                   	pop    %esi
+  800bd7:	5f                   	pop    %edi
+  800bd8:	5d                   	pop    %ebp
+  800bd9:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800bda:	83 ec 0c             	sub    $0xc,%esp
+  800bdd:	50                   	push   %eax
+  800bde:	6a 04                	push   $0x4
+  800be0:	68 63 2b 80 00       	push   $0x802b63
+  800be5:	6a 3e                	push   $0x3e
+  800be7:	68 80 2b 80 00       	push   $0x802b80
+  800bec:	e8 04 16 00 00       	call   8021f5 <_panic>
+
+00800bf1 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  800bf1:	55                   	push   %ebp
+  800bf2:	89 e5                	mov    %esp,%ebp
+  800bf4:	57                   	push   %edi
+  800bf5:	56                   	push   %esi
+  800bf6:	53                   	push   %ebx
+  800bf7:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800bfa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bfd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c00:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c05:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c08:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c0b:	8b 75 18             	mov    0x18(%ebp),%esi
+  800c0e:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c10:	85 c0                	test   %eax,%eax
+  800c12:	7f 08                	jg     800c1c <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800c14:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c17:	5b                   	pop    %ebx
+  800c18:	5e                   	pop    %esi
+  800c19:	5f                   	pop    %edi
+  800c1a:	5d                   	pop    %ebp
+  800c1b:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c1c:	83 ec 0c             	sub    $0xc,%esp
+  800c1f:	50                   	push   %eax
+  800c20:	6a 05                	push   $0x5
+  800c22:	68 63 2b 80 00       	push   $0x802b63
+  800c27:	6a 3e                	push   $0x3e
+  800c29:	68 80 2b 80 00       	push   $0x802b80
+  800c2e:	e8 c2 15 00 00       	call   8021f5 <_panic>
+
+00800c33 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  800c33:	55                   	push   %ebp
+  800c34:	89 e5                	mov    %esp,%ebp
+  800c36:	57                   	push   %edi
+  800c37:	56                   	push   %esi
+  800c38:	53                   	push   %ebx
+  800c39:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c3c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c41:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c44:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c47:	b8 06 00 00 00       	mov    $0x6,%eax
+  800c4c:	89 df                	mov    %ebx,%edi
+  800c4e:	89 de                	mov    %ebx,%esi
+  800c50:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c52:	85 c0                	test   %eax,%eax
+  800c54:	7f 08                	jg     800c5e <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800c56:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c59:	5b                   	pop    %ebx
+  800c5a:	5e                   	pop    %esi
+  800c5b:	5f                   	pop    %edi
+  800c5c:	5d                   	pop    %ebp
+  800c5d:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c5e:	83 ec 0c             	sub    $0xc,%esp
+  800c61:	50                   	push   %eax
+  800c62:	6a 06                	push   $0x6
+  800c64:	68 63 2b 80 00       	push   $0x802b63
+  800c69:	6a 3e                	push   $0x3e
+  800c6b:	68 80 2b 80 00       	push   $0x802b80
+  800c70:	e8 80 15 00 00       	call   8021f5 <_panic>
+
+00800c75 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800c75:	55                   	push   %ebp
+  800c76:	89 e5                	mov    %esp,%ebp
+  800c78:	57                   	push   %edi
+  800c79:	56                   	push   %esi
+  800c7a:	53                   	push   %ebx
+  800c7b:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c7e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c83:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c86:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c89:	b8 08 00 00 00       	mov    $0x8,%eax
+  800c8e:	89 df                	mov    %ebx,%edi
+  800c90:	89 de                	mov    %ebx,%esi
+  800c92:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c94:	85 c0                	test   %eax,%eax
+  800c96:	7f 08                	jg     800ca0 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800c98:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c9b:	5b                   	pop    %ebx
+  800c9c:	5e                   	pop    %esi
+  800c9d:	5f                   	pop    %edi
+  800c9e:	5d                   	pop    %ebp
+  800c9f:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ca0:	83 ec 0c             	sub    $0xc,%esp
+  800ca3:	50                   	push   %eax
+  800ca4:	6a 08                	push   $0x8
+  800ca6:	68 63 2b 80 00       	push   $0x802b63
+  800cab:	6a 3e                	push   $0x3e
+  800cad:	68 80 2b 80 00       	push   $0x802b80
+  800cb2:	e8 3e 15 00 00       	call   8021f5 <_panic>
+
+00800cb7 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800cb7:	55                   	push   %ebp
+  800cb8:	89 e5                	mov    %esp,%ebp
+  800cba:	57                   	push   %edi
+  800cbb:	56                   	push   %esi
+  800cbc:	53                   	push   %ebx
+  800cbd:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800cc0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cc5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cc8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ccb:	b8 09 00 00 00       	mov    $0x9,%eax
+  800cd0:	89 df                	mov    %ebx,%edi
+  800cd2:	89 de                	mov    %ebx,%esi
+  800cd4:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800cd6:	85 c0                	test   %eax,%eax
+  800cd8:	7f 08                	jg     800ce2 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800cda:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cdd:	5b                   	pop    %ebx
+  800cde:	5e                   	pop    %esi
+  800cdf:	5f                   	pop    %edi
+  800ce0:	5d                   	pop    %ebp
+  800ce1:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ce2:	83 ec 0c             	sub    $0xc,%esp
+  800ce5:	50                   	push   %eax
+  800ce6:	6a 09                	push   $0x9
+  800ce8:	68 63 2b 80 00       	push   $0x802b63
+  800ced:	6a 3e                	push   $0x3e
+  800cef:	68 80 2b 80 00       	push   $0x802b80
+  800cf4:	e8 fc 14 00 00       	call   8021f5 <_panic>
+
+00800cf9 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800cf9:	55                   	push   %ebp
+  800cfa:	89 e5                	mov    %esp,%ebp
+  800cfc:	57                   	push   %edi
+  800cfd:	56                   	push   %esi
+  800cfe:	53                   	push   %ebx
+  800cff:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800d02:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d07:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d0a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d0d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d12:	89 df                	mov    %ebx,%edi
+  800d14:	89 de                	mov    %ebx,%esi
+  800d16:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d18:	85 c0                	test   %eax,%eax
+  800d1a:	7f 08                	jg     800d24 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800d1c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d1f:	5b                   	pop    %ebx
+  800d20:	5e                   	pop    %esi
+  800d21:	5f                   	pop    %edi
+  800d22:	5d                   	pop    %ebp
+  800d23:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d24:	83 ec 0c             	sub    $0xc,%esp
+  800d27:	50                   	push   %eax
+  800d28:	6a 0a                	push   $0xa
+  800d2a:	68 63 2b 80 00       	push   $0x802b63
+  800d2f:	6a 3e                	push   $0x3e
+  800d31:	68 80 2b 80 00       	push   $0x802b80
+  800d36:	e8 ba 14 00 00       	call   8021f5 <_panic>
+
+00800d3b <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  800d3b:	55                   	push   %ebp
+  800d3c:	89 e5                	mov    %esp,%ebp
+  800d3e:	57                   	push   %edi
+  800d3f:	56                   	push   %esi
+  800d40:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d41:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d44:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d47:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800d4c:	be 00 00 00 00       	mov    $0x0,%esi
+  800d51:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d54:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d57:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800d59:	5b                   	pop    %ebx
+  800d5a:	5e                   	pop    %esi
+  800d5b:	5f                   	pop    %edi
+  800d5c:	5d                   	pop    %ebp
+  800d5d:	c3                   	ret
+
+00800d5e <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  800d5e:	55                   	push   %ebp
+  800d5f:	89 e5                	mov    %esp,%ebp
+  800d61:	57                   	push   %edi
+  800d62:	56                   	push   %esi
+  800d63:	53                   	push   %ebx
+  800d64:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800d67:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d6f:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800d74:	89 cb                	mov    %ecx,%ebx
+  800d76:	89 cf                	mov    %ecx,%edi
+  800d78:	89 ce                	mov    %ecx,%esi
+  800d7a:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d7c:	85 c0                	test   %eax,%eax
+  800d7e:	7f 08                	jg     800d88 <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  800d80:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d83:	5b                   	pop    %ebx
+  800d84:	5e                   	pop    %esi
+  800d85:	5f                   	pop    %edi
+  800d86:	5d                   	pop    %ebp
+  800d87:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d88:	83 ec 0c             	sub    $0xc,%esp
+  800d8b:	50                   	push   %eax
+  800d8c:	6a 0d                	push   $0xd
+  800d8e:	68 63 2b 80 00       	push   $0x802b63
+  800d93:	6a 3e                	push   $0x3e
+  800d95:	68 80 2b 80 00       	push   $0x802b80
+  800d9a:	e8 56 14 00 00       	call   8021f5 <_panic>
+
+00800d9f <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  800d9f:	55                   	push   %ebp
+  800da0:	89 e5                	mov    %esp,%ebp
+  800da2:	57                   	push   %edi
+  800da3:	56                   	push   %esi
+  800da4:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800da5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800daa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800db0:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800db5:	89 df                	mov    %ebx,%edi
+  800db7:	89 de                	mov    %ebx,%esi
+  800db9:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  800dbb:	5b                   	pop    %ebx
+  800dbc:	5e                   	pop    %esi
+  800dbd:	5f                   	pop    %edi
+  800dbe:	5d                   	pop    %ebp
+  800dbf:	c3                   	ret
+
+00800dc0 <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  800dc0:	55                   	push   %ebp
+  800dc1:	89 e5                	mov    %esp,%ebp
+  800dc3:	57                   	push   %edi
+  800dc4:	56                   	push   %esi
+  800dc5:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800dc6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dcb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dce:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800dd3:	89 cb                	mov    %ecx,%ebx
+  800dd5:	89 cf                	mov    %ecx,%edi
+  800dd7:	89 ce                	mov    %ecx,%esi
+  800dd9:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  800ddb:	5b                   	pop    %ebx
+  800ddc:	5e                   	pop    %esi
+  800ddd:	5f                   	pop    %edi
+  800dde:	5d                   	pop    %ebp
+  800ddf:	c3                   	ret
+
+00800de0 <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  800de0:	55                   	push   %ebp
+  800de1:	89 e5                	mov    %esp,%ebp
+  800de3:	57                   	push   %edi
+  800de4:	56                   	push   %esi
+  800de5:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800de6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800deb:	b8 10 00 00 00       	mov    $0x10,%eax
+  800df0:	89 d1                	mov    %edx,%ecx
+  800df2:	89 d3                	mov    %edx,%ebx
+  800df4:	89 d7                	mov    %edx,%edi
+  800df6:	89 d6                	mov    %edx,%esi
+  800df8:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800dfa:	5b                   	pop    %ebx
+  800dfb:	5e                   	pop    %esi
+  800dfc:	5f                   	pop    %edi
+  800dfd:	5d                   	pop    %ebp
+  800dfe:	c3                   	ret
+
+00800dff <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  800dff:	55                   	push   %ebp
+  800e00:	89 e5                	mov    %esp,%ebp
+  800e02:	57                   	push   %edi
+  800e03:	56                   	push   %esi
+  800e04:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e05:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e0a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e0d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e10:	b8 11 00 00 00       	mov    $0x11,%eax
+  800e15:	89 df                	mov    %ebx,%edi
+  800e17:	89 de                	mov    %ebx,%esi
+  800e19:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800e1b:	5b                   	pop    %ebx
+  800e1c:	5e                   	pop    %esi
+  800e1d:	5f                   	pop    %edi
+  800e1e:	5d                   	pop    %ebp
+  800e1f:	c3                   	ret
+
+00800e20 <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  800e20:	55                   	push   %ebp
+  800e21:	89 e5                	mov    %esp,%ebp
+  800e23:	57                   	push   %edi
+  800e24:	56                   	push   %esi
+  800e25:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e26:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e2b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e2e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e31:	b8 12 00 00 00       	mov    $0x12,%eax
+  800e36:	89 df                	mov    %ebx,%edi
+  800e38:	89 de                	mov    %ebx,%esi
+  800e3a:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800e3c:	5b                   	pop    %ebx
+  800e3d:	5e                   	pop    %esi
+  800e3e:	5f                   	pop    %edi
+  800e3f:	5d                   	pop    %ebp
+  800e40:	c3                   	ret
+
+00800e41 <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  800e41:	55                   	push   %ebp
+  800e42:	89 e5                	mov    %esp,%ebp
+  800e44:	57                   	push   %edi
+  800e45:	56                   	push   %esi
+  800e46:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e47:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e4c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e4f:	b8 13 00 00 00       	mov    $0x13,%eax
+  800e54:	89 cb                	mov    %ecx,%ebx
+  800e56:	89 cf                	mov    %ecx,%edi
+  800e58:	89 ce                	mov    %ecx,%esi
+  800e5a:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  800e5c:	5b                   	pop    %ebx
+  800e5d:	5e                   	pop    %esi
+  800e5e:	5f                   	pop    %edi
+  800e5f:	5d                   	pop    %ebp
+  800e60:	c3                   	ret
+
+00800e61 <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  800e61:	55                   	push   %ebp
+  800e62:	89 e5                	mov    %esp,%ebp
+  800e64:	57                   	push   %edi
+  800e65:	56                   	push   %esi
+  800e66:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e67:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e6f:	b8 14 00 00 00       	mov    $0x14,%eax
+  800e74:	89 cb                	mov    %ecx,%ebx
+  800e76:	89 cf                	mov    %ecx,%edi
+  800e78:	89 ce                	mov    %ecx,%esi
+  800e7a:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  800e7c:	5b                   	pop    %ebx
+  800e7d:	5e                   	pop    %esi
+  800e7e:	5f                   	pop    %edi
+  800e7f:	5d                   	pop    %ebp
+  800e80:	c3                   	ret
+
+00800e81 <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args)
+{
+  800e81:	55                   	push   %ebp
+  800e82:	89 e5                	mov    %esp,%ebp
+  800e84:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e87:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e8a:	8b 45 10             	mov    0x10(%ebp),%eax
+	args->argc = argc;
+  800e8d:	89 10                	mov    %edx,(%eax)
+	args->argv = (const char **) argv;
+  800e8f:	89 48 04             	mov    %ecx,0x4(%eax)
+	args->curarg = (*argc > 1 && argv ? "" : 0);
+  800e92:	83 3a 01             	cmpl   $0x1,(%edx)
+  800e95:	7e 09                	jle    800ea0 <argstart+0x1f>
+  800e97:	ba 31 28 80 00       	mov    $0x802831,%edx
+  800e9c:	85 c9                	test   %ecx,%ecx
+  800e9e:	75 05                	jne    800ea5 <argstart+0x24>
+  800ea0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ea5:	89 50 08             	mov    %edx,0x8(%eax)
+	args->argvalue = 0;
+  800ea8:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+}
+  800eaf:	5d                   	pop    %ebp
+  800eb0:	c3                   	ret
+
+00800eb1 <argnext>:
+
+int
+argnext(struct Argstate *args)
+{
+  800eb1:	55                   	push   %ebp
+  800eb2:	89 e5                	mov    %esp,%ebp
+  800eb4:	53                   	push   %ebx
+  800eb5:	83 ec 04             	sub    $0x4,%esp
+  800eb8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int arg;
+
+	args->argvalue = 0;
+  800ebb:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+
+	// Done processing arguments if args->curarg == 0
+	if (args->curarg == 0)
+  800ec2:	8b 43 08             	mov    0x8(%ebx),%eax
+  800ec5:	85 c0                	test   %eax,%eax
+  800ec7:	74 74                	je     800f3d <argnext+0x8c>
+		return -1;
+
+	if (!*args->curarg) {
+  800ec9:	80 38 00             	cmpb   $0x0,(%eax)
+  800ecc:	75 48                	jne    800f16 <argnext+0x65>
+		// Need to process the next argument
+		// Check for end of argument list
+		if (*args->argc == 1
+  800ece:	8b 0b                	mov    (%ebx),%ecx
+  800ed0:	83 39 01             	cmpl   $0x1,(%ecx)
+  800ed3:	74 5a                	je     800f2f <argnext+0x7e>
+		    || args->argv[1][0] != '-'
+  800ed5:	8b 53 04             	mov    0x4(%ebx),%edx
+  800ed8:	8b 42 04             	mov    0x4(%edx),%eax
+  800edb:	80 38 2d             	cmpb   $0x2d,(%eax)
+  800ede:	75 4f                	jne    800f2f <argnext+0x7e>
+		    || args->argv[1][1] == '\0')
+  800ee0:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  800ee4:	74 49                	je     800f2f <argnext+0x7e>
+			goto endofargs;
+		// Shift arguments down one
+		args->curarg = args->argv[1] + 1;
+  800ee6:	83 c0 01             	add    $0x1,%eax
+  800ee9:	89 43 08             	mov    %eax,0x8(%ebx)
+		memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  800eec:	83 ec 04             	sub    $0x4,%esp
+  800eef:	8b 01                	mov    (%ecx),%eax
+  800ef1:	8d 04 85 fc ff ff ff 	lea    -0x4(,%eax,4),%eax
+  800ef8:	50                   	push   %eax
+  800ef9:	8d 42 08             	lea    0x8(%edx),%eax
+  800efc:	50                   	push   %eax
+  800efd:	83 c2 04             	add    $0x4,%edx
+  800f00:	52                   	push   %edx
+  800f01:	e8 42 fa ff ff       	call   800948 <memmove>
+		(*args->argc)--;
+  800f06:	8b 03                	mov    (%ebx),%eax
+  800f08:	83 28 01             	subl   $0x1,(%eax)
+		// Check for "--": end of argument list
+		if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  800f0b:	8b 43 08             	mov    0x8(%ebx),%eax
+  800f0e:	83 c4 10             	add    $0x10,%esp
+  800f11:	80 38 2d             	cmpb   $0x2d,(%eax)
+  800f14:	74 13                	je     800f29 <argnext+0x78>
+			goto endofargs;
+	}
+
+	arg = (unsigned char) *args->curarg;
+  800f16:	8b 43 08             	mov    0x8(%ebx),%eax
+  800f19:	0f b6 10             	movzbl (%eax),%edx
+	args->curarg++;
+  800f1c:	83 c0 01             	add    $0x1,%eax
+  800f1f:	89 43 08             	mov    %eax,0x8(%ebx)
+	return arg;
+
+    endofargs:
+	args->curarg = 0;
+	return -1;
+}
+  800f22:	89 d0                	mov    %edx,%eax
+  800f24:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f27:	c9                   	leave
+  800f28:	c3                   	ret
+		if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  800f29:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  800f2d:	75 e7                	jne    800f16 <argnext+0x65>
+	args->curarg = 0;
+  800f2f:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+	return -1;
+  800f36:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  800f3b:	eb e5                	jmp    800f22 <argnext+0x71>
+		return -1;
+  800f3d:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  800f42:	eb de                	jmp    800f22 <argnext+0x71>
+
+00800f44 <argnextvalue>:
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+}
+
+char *
+argnextvalue(struct Argstate *args)
+{
+  800f44:	55                   	push   %ebp
+  800f45:	89 e5                	mov    %esp,%ebp
+  800f47:	53                   	push   %ebx
+  800f48:	83 ec 04             	sub    $0x4,%esp
+  800f4b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!args->curarg)
+  800f4e:	8b 43 08             	mov    0x8(%ebx),%eax
+  800f51:	85 c0                	test   %eax,%eax
+  800f53:	74 12                	je     800f67 <argnextvalue+0x23>
+		return 0;
+	if (*args->curarg) {
+  800f55:	80 38 00             	cmpb   $0x0,(%eax)
+  800f58:	74 12                	je     800f6c <argnextvalue+0x28>
+		args->argvalue = args->curarg;
+  800f5a:	89 43 0c             	mov    %eax,0xc(%ebx)
+		args->curarg = "";
+  800f5d:	c7 43 08 31 28 80 00 	movl   $0x802831,0x8(%ebx)
+		(*args->argc)--;
+	} else {
+		args->argvalue = 0;
+		args->curarg = 0;
+	}
+	return (char*) args->argvalue;
+  800f64:	8b 43 0c             	mov    0xc(%ebx),%eax
+}
+  800f67:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f6a:	c9                   	leave
+  800f6b:	c3                   	ret
+	} else if (*args->argc > 1) {
+  800f6c:	8b 13                	mov    (%ebx),%edx
+  800f6e:	83 3a 01             	cmpl   $0x1,(%edx)
+  800f71:	7f 10                	jg     800f83 <argnextvalue+0x3f>
+		args->argvalue = 0;
+  800f73:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		args->curarg = 0;
+  800f7a:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  800f81:	eb e1                	jmp    800f64 <argnextvalue+0x20>
+		args->argvalue = args->argv[1];
+  800f83:	8b 43 04             	mov    0x4(%ebx),%eax
+  800f86:	8b 48 04             	mov    0x4(%eax),%ecx
+  800f89:	89 4b 0c             	mov    %ecx,0xc(%ebx)
+		memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  800f8c:	83 ec 04             	sub    $0x4,%esp
+  800f8f:	8b 12                	mov    (%edx),%edx
+  800f91:	8d 14 95 fc ff ff ff 	lea    -0x4(,%edx,4),%edx
+  800f98:	52                   	push   %edx
+  800f99:	8d 50 08             	lea    0x8(%eax),%edx
+  800f9c:	52                   	push   %edx
+  800f9d:	83 c0 04             	add    $0x4,%eax
+  800fa0:	50                   	push   %eax
+  800fa1:	e8 a2 f9 ff ff       	call   800948 <memmove>
+		(*args->argc)--;
+  800fa6:	8b 03                	mov    (%ebx),%eax
+  800fa8:	83 28 01             	subl   $0x1,(%eax)
+  800fab:	83 c4 10             	add    $0x10,%esp
+  800fae:	eb b4                	jmp    800f64 <argnextvalue+0x20>
+
+00800fb0 <argvalue>:
+{
+  800fb0:	55                   	push   %ebp
+  800fb1:	89 e5                	mov    %esp,%ebp
+  800fb3:	83 ec 08             	sub    $0x8,%esp
+  800fb6:	8b 55 08             	mov    0x8(%ebp),%edx
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+  800fb9:	8b 42 0c             	mov    0xc(%edx),%eax
+  800fbc:	85 c0                	test   %eax,%eax
+  800fbe:	74 02                	je     800fc2 <argvalue+0x12>
+}
+  800fc0:	c9                   	leave
+  800fc1:	c3                   	ret
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+  800fc2:	83 ec 0c             	sub    $0xc,%esp
+  800fc5:	52                   	push   %edx
+  800fc6:	e8 79 ff ff ff       	call   800f44 <argnextvalue>
+  800fcb:	83 c4 10             	add    $0x10,%esp
+  800fce:	eb f0                	jmp    800fc0 <argvalue+0x10>
+
+00800fd0 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800fd0:	55                   	push   %ebp
+  800fd1:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800fd3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fd6:	05 00 00 00 30       	add    $0x30000000,%eax
+  800fdb:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800fde:	5d                   	pop    %ebp
+  800fdf:	c3                   	ret
+
+00800fe0 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800fe0:	55                   	push   %ebp
+  800fe1:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800fe3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fe6:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800feb:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800ff0:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800ff5:	5d                   	pop    %ebp
+  800ff6:	c3                   	ret
+
+00800ff7 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800ff7:	55                   	push   %ebp
+  800ff8:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  800ffa:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800fff:	eb 02                	jmp    801003 <fd_alloc+0xc>
+  801001:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801003:	89 c2                	mov    %eax,%edx
+  801005:	c1 ea 16             	shr    $0x16,%edx
+  801008:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80100f:	f6 c2 01             	test   $0x1,%dl
+  801012:	74 2b                	je     80103f <fd_alloc+0x48>
+  801014:	89 c2                	mov    %eax,%edx
+  801016:	c1 ea 0c             	shr    $0xc,%edx
+  801019:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801020:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801026:	f6 c1 01             	test   $0x1,%cl
+  801029:	74 14                	je     80103f <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80102b:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801031:	75 ce                	jne    801001 <fd_alloc+0xa>
+  801033:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801038:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80103d:	eb 05                	jmp    801044 <fd_alloc+0x4d>
+			return 0;
+  80103f:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801044:	8b 55 08             	mov    0x8(%ebp),%edx
+  801047:	89 02                	mov    %eax,(%edx)
+}
+  801049:	89 c8                	mov    %ecx,%eax
+  80104b:	5d                   	pop    %ebp
+  80104c:	c3                   	ret
+
+0080104d <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80104d:	55                   	push   %ebp
+  80104e:	89 e5                	mov    %esp,%ebp
+  801050:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801053:	83 f8 1f             	cmp    $0x1f,%eax
+  801056:	77 30                	ja     801088 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801058:	c1 e0 0c             	shl    $0xc,%eax
+  80105b:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801060:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801066:	f6 c2 01             	test   $0x1,%dl
+  801069:	74 24                	je     80108f <fd_lookup+0x42>
+  80106b:	89 c2                	mov    %eax,%edx
+  80106d:	c1 ea 0c             	shr    $0xc,%edx
+  801070:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801077:	f6 c2 01             	test   $0x1,%dl
+  80107a:	74 1a                	je     801096 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80107c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80107f:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801081:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801086:	5d                   	pop    %ebp
+  801087:	c3                   	ret
+		return -E_INVAL;
+  801088:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80108d:	eb f7                	jmp    801086 <fd_lookup+0x39>
+		return -E_INVAL;
+  80108f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801094:	eb f0                	jmp    801086 <fd_lookup+0x39>
+  801096:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80109b:	eb e9                	jmp    801086 <fd_lookup+0x39>
+
+0080109d <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80109d:	55                   	push   %ebp
+  80109e:	89 e5                	mov    %esp,%ebp
+  8010a0:	53                   	push   %ebx
+  8010a1:	83 ec 04             	sub    $0x4,%esp
+  8010a4:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8010a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010ac:	eb 03                	jmp    8010b1 <dev_lookup+0x14>
+  8010ae:	83 c0 01             	add    $0x1,%eax
+  8010b1:	8b 1c 85 0c 2c 80 00 	mov    0x802c0c(,%eax,4),%ebx
+  8010b8:	85 db                	test   %ebx,%ebx
+  8010ba:	74 0b                	je     8010c7 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8010bc:	39 13                	cmp    %edx,(%ebx)
+  8010be:	75 ee                	jne    8010ae <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8010c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010c5:	eb 1f                	jmp    8010e6 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8010c7:	a1 08 40 80 00       	mov    0x804008,%eax
+  8010cc:	8b 40 48             	mov    0x48(%eax),%eax
+  8010cf:	83 ec 04             	sub    $0x4,%esp
+  8010d2:	52                   	push   %edx
+  8010d3:	50                   	push   %eax
+  8010d4:	68 90 2b 80 00       	push   $0x802b90
+  8010d9:	e8 2b f1 ff ff       	call   800209 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8010de:	83 c4 10             	add    $0x10,%esp
+  8010e1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8010e6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8010e9:	89 1a                	mov    %ebx,(%edx)
+}
+  8010eb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010ee:	c9                   	leave
+  8010ef:	c3                   	ret
+
+008010f0 <fd_close>:
+{
+  8010f0:	55                   	push   %ebp
+  8010f1:	89 e5                	mov    %esp,%ebp
+  8010f3:	57                   	push   %edi
+  8010f4:	56                   	push   %esi
+  8010f5:	53                   	push   %ebx
+  8010f6:	83 ec 24             	sub    $0x24,%esp
+  8010f9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8010fc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8010ff:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801102:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801103:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801109:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80110c:	50                   	push   %eax
+  80110d:	e8 3b ff ff ff       	call   80104d <fd_lookup>
+  801112:	89 c3                	mov    %eax,%ebx
+  801114:	83 c4 10             	add    $0x10,%esp
+  801117:	85 c0                	test   %eax,%eax
+  801119:	78 05                	js     801120 <fd_close+0x30>
+	    || fd != fd2)
+  80111b:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80111e:	74 16                	je     801136 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801120:	89 f8                	mov    %edi,%eax
+  801122:	84 c0                	test   %al,%al
+  801124:	b8 00 00 00 00       	mov    $0x0,%eax
+  801129:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80112c:	89 d8                	mov    %ebx,%eax
+  80112e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801131:	5b                   	pop    %ebx
+  801132:	5e                   	pop    %esi
+  801133:	5f                   	pop    %edi
+  801134:	5d                   	pop    %ebp
+  801135:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801136:	83 ec 08             	sub    $0x8,%esp
+  801139:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80113c:	50                   	push   %eax
+  80113d:	ff 36                	push   (%esi)
+  80113f:	e8 59 ff ff ff       	call   80109d <dev_lookup>
+  801144:	89 c3                	mov    %eax,%ebx
+  801146:	83 c4 10             	add    $0x10,%esp
+  801149:	85 c0                	test   %eax,%eax
+  80114b:	78 1a                	js     801167 <fd_close+0x77>
+		if (dev->dev_close)
+  80114d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801150:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801153:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801158:	85 c0                	test   %eax,%eax
+  80115a:	74 0b                	je     801167 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80115c:	83 ec 0c             	sub    $0xc,%esp
+  80115f:	56                   	push   %esi
+  801160:	ff d0                	call   *%eax
+  801162:	89 c3                	mov    %eax,%ebx
+  801164:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801167:	83 ec 08             	sub    $0x8,%esp
+  80116a:	56                   	push   %esi
+  80116b:	6a 00                	push   $0x0
+  80116d:	e8 c1 fa ff ff       	call   800c33 <sys_page_unmap>
+	return r;
+  801172:	83 c4 10             	add    $0x10,%esp
+  801175:	eb b5                	jmp    80112c <fd_close+0x3c>
+
+00801177 <close>:
+
+int
+close(int fdnum)
+{
+  801177:	55                   	push   %ebp
+  801178:	89 e5                	mov    %esp,%ebp
+  80117a:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80117d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801180:	50                   	push   %eax
+  801181:	ff 75 08             	push   0x8(%ebp)
+  801184:	e8 c4 fe ff ff       	call   80104d <fd_lookup>
+  801189:	83 c4 10             	add    $0x10,%esp
+  80118c:	85 c0                	test   %eax,%eax
+  80118e:	79 02                	jns    801192 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801190:	c9                   	leave
+  801191:	c3                   	ret
+		return fd_close(fd, 1);
+  801192:	83 ec 08             	sub    $0x8,%esp
+  801195:	6a 01                	push   $0x1
+  801197:	ff 75 f4             	push   -0xc(%ebp)
+  80119a:	e8 51 ff ff ff       	call   8010f0 <fd_close>
+  80119f:	83 c4 10             	add    $0x10,%esp
+  8011a2:	eb ec                	jmp    801190 <close+0x19>
+
+008011a4 <close_all>:
+
+void
+close_all(void)
+{
+  8011a4:	55                   	push   %ebp
+  8011a5:	89 e5                	mov    %esp,%ebp
+  8011a7:	53                   	push   %ebx
+  8011a8:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8011ab:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8011b0:	83 ec 0c             	sub    $0xc,%esp
+  8011b3:	53                   	push   %ebx
+  8011b4:	e8 be ff ff ff       	call   801177 <close>
+	for (i = 0; i < MAXFD; i++)
+  8011b9:	83 c3 01             	add    $0x1,%ebx
+  8011bc:	83 c4 10             	add    $0x10,%esp
+  8011bf:	83 fb 20             	cmp    $0x20,%ebx
+  8011c2:	75 ec                	jne    8011b0 <close_all+0xc>
+}
+  8011c4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8011c7:	c9                   	leave
+  8011c8:	c3                   	ret
+
+008011c9 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8011c9:	55                   	push   %ebp
+  8011ca:	89 e5                	mov    %esp,%ebp
+  8011cc:	57                   	push   %edi
+  8011cd:	56                   	push   %esi
+  8011ce:	53                   	push   %ebx
+  8011cf:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8011d2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8011d5:	50                   	push   %eax
+  8011d6:	ff 75 08             	push   0x8(%ebp)
+  8011d9:	e8 6f fe ff ff       	call   80104d <fd_lookup>
+  8011de:	89 c3                	mov    %eax,%ebx
+  8011e0:	83 c4 10             	add    $0x10,%esp
+  8011e3:	85 c0                	test   %eax,%eax
+  8011e5:	78 7f                	js     801266 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8011e7:	83 ec 0c             	sub    $0xc,%esp
+  8011ea:	ff 75 0c             	push   0xc(%ebp)
+  8011ed:	e8 85 ff ff ff       	call   801177 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8011f2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8011f5:	c1 e6 0c             	shl    $0xc,%esi
+  8011f8:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8011fe:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801201:	89 3c 24             	mov    %edi,(%esp)
+  801204:	e8 d7 fd ff ff       	call   800fe0 <fd2data>
+  801209:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80120b:	89 34 24             	mov    %esi,(%esp)
+  80120e:	e8 cd fd ff ff       	call   800fe0 <fd2data>
+  801213:	83 c4 10             	add    $0x10,%esp
+  801216:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801219:	89 d8                	mov    %ebx,%eax
+  80121b:	c1 e8 16             	shr    $0x16,%eax
+  80121e:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801225:	a8 01                	test   $0x1,%al
+  801227:	74 11                	je     80123a <dup+0x71>
+  801229:	89 d8                	mov    %ebx,%eax
+  80122b:	c1 e8 0c             	shr    $0xc,%eax
+  80122e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801235:	f6 c2 01             	test   $0x1,%dl
+  801238:	75 36                	jne    801270 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80123a:	89 f8                	mov    %edi,%eax
+  80123c:	c1 e8 0c             	shr    $0xc,%eax
+  80123f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801246:	83 ec 0c             	sub    $0xc,%esp
+  801249:	25 07 0e 00 00       	and    $0xe07,%eax
+  80124e:	50                   	push   %eax
+  80124f:	56                   	push   %esi
+  801250:	6a 00                	push   $0x0
+  801252:	57                   	push   %edi
+  801253:	6a 00                	push   $0x0
+  801255:	e8 97 f9 ff ff       	call   800bf1 <sys_page_map>
+  80125a:	89 c3                	mov    %eax,%ebx
+  80125c:	83 c4 20             	add    $0x20,%esp
+  80125f:	85 c0                	test   %eax,%eax
+  801261:	78 33                	js     801296 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801263:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801266:	89 d8                	mov    %ebx,%eax
+  801268:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80126b:	5b                   	pop    %ebx
+  80126c:	5e                   	pop    %esi
+  80126d:	5f                   	pop    %edi
+  80126e:	5d                   	pop    %ebp
+  80126f:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801270:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801277:	83 ec 0c             	sub    $0xc,%esp
+  80127a:	25 07 0e 00 00       	and    $0xe07,%eax
+  80127f:	50                   	push   %eax
+  801280:	ff 75 d4             	push   -0x2c(%ebp)
+  801283:	6a 00                	push   $0x0
+  801285:	53                   	push   %ebx
+  801286:	6a 00                	push   $0x0
+  801288:	e8 64 f9 ff ff       	call   800bf1 <sys_page_map>
+  80128d:	89 c3                	mov    %eax,%ebx
+  80128f:	83 c4 20             	add    $0x20,%esp
+  801292:	85 c0                	test   %eax,%eax
+  801294:	79 a4                	jns    80123a <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801296:	83 ec 08             	sub    $0x8,%esp
+  801299:	56                   	push   %esi
+  80129a:	6a 00                	push   $0x0
+  80129c:	e8 92 f9 ff ff       	call   800c33 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8012a1:	83 c4 08             	add    $0x8,%esp
+  8012a4:	ff 75 d4             	push   -0x2c(%ebp)
+  8012a7:	6a 00                	push   $0x0
+  8012a9:	e8 85 f9 ff ff       	call   800c33 <sys_page_unmap>
+	return r;
+  8012ae:	83 c4 10             	add    $0x10,%esp
+  8012b1:	eb b3                	jmp    801266 <dup+0x9d>
+
+008012b3 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8012b3:	55                   	push   %ebp
+  8012b4:	89 e5                	mov    %esp,%ebp
+  8012b6:	56                   	push   %esi
+  8012b7:	53                   	push   %ebx
+  8012b8:	83 ec 18             	sub    $0x18,%esp
+  8012bb:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8012be:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8012c1:	50                   	push   %eax
+  8012c2:	56                   	push   %esi
+  8012c3:	e8 85 fd ff ff       	call   80104d <fd_lookup>
+  8012c8:	83 c4 10             	add    $0x10,%esp
+  8012cb:	85 c0                	test   %eax,%eax
+  8012cd:	78 3c                	js     80130b <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8012cf:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8012d2:	83 ec 08             	sub    $0x8,%esp
+  8012d5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8012d8:	50                   	push   %eax
+  8012d9:	ff 33                	push   (%ebx)
+  8012db:	e8 bd fd ff ff       	call   80109d <dev_lookup>
+  8012e0:	83 c4 10             	add    $0x10,%esp
+  8012e3:	85 c0                	test   %eax,%eax
+  8012e5:	78 24                	js     80130b <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8012e7:	8b 43 08             	mov    0x8(%ebx),%eax
+  8012ea:	83 e0 03             	and    $0x3,%eax
+  8012ed:	83 f8 01             	cmp    $0x1,%eax
+  8012f0:	74 20                	je     801312 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8012f2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8012f5:	8b 40 08             	mov    0x8(%eax),%eax
+  8012f8:	85 c0                	test   %eax,%eax
+  8012fa:	74 37                	je     801333 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8012fc:	83 ec 04             	sub    $0x4,%esp
+  8012ff:	ff 75 10             	push   0x10(%ebp)
+  801302:	ff 75 0c             	push   0xc(%ebp)
+  801305:	53                   	push   %ebx
+  801306:	ff d0                	call   *%eax
+  801308:	83 c4 10             	add    $0x10,%esp
+}
+  80130b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80130e:	5b                   	pop    %ebx
+  80130f:	5e                   	pop    %esi
+  801310:	5d                   	pop    %ebp
+  801311:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801312:	a1 08 40 80 00       	mov    0x804008,%eax
+  801317:	8b 40 48             	mov    0x48(%eax),%eax
+  80131a:	83 ec 04             	sub    $0x4,%esp
+  80131d:	56                   	push   %esi
+  80131e:	50                   	push   %eax
+  80131f:	68 d1 2b 80 00       	push   $0x802bd1
+  801324:	e8 e0 ee ff ff       	call   800209 <cprintf>
+		return -E_INVAL;
+  801329:	83 c4 10             	add    $0x10,%esp
+  80132c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801331:	eb d8                	jmp    80130b <read+0x58>
+		return -E_NOT_SUPP;
+  801333:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801338:	eb d1                	jmp    80130b <read+0x58>
+
+0080133a <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80133a:	55                   	push   %ebp
+  80133b:	89 e5                	mov    %esp,%ebp
+  80133d:	57                   	push   %edi
+  80133e:	56                   	push   %esi
+  80133f:	53                   	push   %ebx
+  801340:	83 ec 0c             	sub    $0xc,%esp
+  801343:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801346:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801349:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80134e:	eb 02                	jmp    801352 <readn+0x18>
+  801350:	01 c3                	add    %eax,%ebx
+  801352:	39 f3                	cmp    %esi,%ebx
+  801354:	73 21                	jae    801377 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801356:	83 ec 04             	sub    $0x4,%esp
+  801359:	89 f0                	mov    %esi,%eax
+  80135b:	29 d8                	sub    %ebx,%eax
+  80135d:	50                   	push   %eax
+  80135e:	89 d8                	mov    %ebx,%eax
+  801360:	03 45 0c             	add    0xc(%ebp),%eax
+  801363:	50                   	push   %eax
+  801364:	57                   	push   %edi
+  801365:	e8 49 ff ff ff       	call   8012b3 <read>
+		if (m < 0)
+  80136a:	83 c4 10             	add    $0x10,%esp
+  80136d:	85 c0                	test   %eax,%eax
+  80136f:	78 04                	js     801375 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801371:	75 dd                	jne    801350 <readn+0x16>
+  801373:	eb 02                	jmp    801377 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801375:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801377:	89 d8                	mov    %ebx,%eax
+  801379:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80137c:	5b                   	pop    %ebx
+  80137d:	5e                   	pop    %esi
+  80137e:	5f                   	pop    %edi
+  80137f:	5d                   	pop    %ebp
+  801380:	c3                   	ret
+
+00801381 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801381:	55                   	push   %ebp
+  801382:	89 e5                	mov    %esp,%ebp
+  801384:	56                   	push   %esi
+  801385:	53                   	push   %ebx
+  801386:	83 ec 18             	sub    $0x18,%esp
+  801389:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80138c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80138f:	50                   	push   %eax
+  801390:	53                   	push   %ebx
+  801391:	e8 b7 fc ff ff       	call   80104d <fd_lookup>
+  801396:	83 c4 10             	add    $0x10,%esp
+  801399:	85 c0                	test   %eax,%eax
+  80139b:	78 37                	js     8013d4 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80139d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8013a0:	83 ec 08             	sub    $0x8,%esp
+  8013a3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013a6:	50                   	push   %eax
+  8013a7:	ff 36                	push   (%esi)
+  8013a9:	e8 ef fc ff ff       	call   80109d <dev_lookup>
+  8013ae:	83 c4 10             	add    $0x10,%esp
+  8013b1:	85 c0                	test   %eax,%eax
+  8013b3:	78 1f                	js     8013d4 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8013b5:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8013b9:	74 20                	je     8013db <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8013bb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013be:	8b 40 0c             	mov    0xc(%eax),%eax
+  8013c1:	85 c0                	test   %eax,%eax
+  8013c3:	74 37                	je     8013fc <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8013c5:	83 ec 04             	sub    $0x4,%esp
+  8013c8:	ff 75 10             	push   0x10(%ebp)
+  8013cb:	ff 75 0c             	push   0xc(%ebp)
+  8013ce:	56                   	push   %esi
+  8013cf:	ff d0                	call   *%eax
+  8013d1:	83 c4 10             	add    $0x10,%esp
+}
+  8013d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013d7:	5b                   	pop    %ebx
+  8013d8:	5e                   	pop    %esi
+  8013d9:	5d                   	pop    %ebp
+  8013da:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8013db:	a1 08 40 80 00       	mov    0x804008,%eax
+  8013e0:	8b 40 48             	mov    0x48(%eax),%eax
+  8013e3:	83 ec 04             	sub    $0x4,%esp
+  8013e6:	53                   	push   %ebx
+  8013e7:	50                   	push   %eax
+  8013e8:	68 ed 2b 80 00       	push   $0x802bed
+  8013ed:	e8 17 ee ff ff       	call   800209 <cprintf>
+		return -E_INVAL;
+  8013f2:	83 c4 10             	add    $0x10,%esp
+  8013f5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013fa:	eb d8                	jmp    8013d4 <write+0x53>
+		return -E_NOT_SUPP;
+  8013fc:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801401:	eb d1                	jmp    8013d4 <write+0x53>
+
+00801403 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801403:	55                   	push   %ebp
+  801404:	89 e5                	mov    %esp,%ebp
+  801406:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801409:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80140c:	50                   	push   %eax
+  80140d:	ff 75 08             	push   0x8(%ebp)
+  801410:	e8 38 fc ff ff       	call   80104d <fd_lookup>
+  801415:	83 c4 10             	add    $0x10,%esp
+  801418:	85 c0                	test   %eax,%eax
+  80141a:	78 0e                	js     80142a <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80141c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80141f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801422:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801425:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80142a:	c9                   	leave
+  80142b:	c3                   	ret
+
+0080142c <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80142c:	55                   	push   %ebp
+  80142d:	89 e5                	mov    %esp,%ebp
+  80142f:	56                   	push   %esi
+  801430:	53                   	push   %ebx
+  801431:	83 ec 18             	sub    $0x18,%esp
+  801434:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801437:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80143a:	50                   	push   %eax
+  80143b:	53                   	push   %ebx
+  80143c:	e8 0c fc ff ff       	call   80104d <fd_lookup>
+  801441:	83 c4 10             	add    $0x10,%esp
+  801444:	85 c0                	test   %eax,%eax
+  801446:	78 34                	js     80147c <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801448:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80144b:	83 ec 08             	sub    $0x8,%esp
+  80144e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801451:	50                   	push   %eax
+  801452:	ff 36                	push   (%esi)
+  801454:	e8 44 fc ff ff       	call   80109d <dev_lookup>
+  801459:	83 c4 10             	add    $0x10,%esp
+  80145c:	85 c0                	test   %eax,%eax
+  80145e:	78 1c                	js     80147c <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801460:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801464:	74 1d                	je     801483 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801466:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801469:	8b 40 18             	mov    0x18(%eax),%eax
+  80146c:	85 c0                	test   %eax,%eax
+  80146e:	74 34                	je     8014a4 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801470:	83 ec 08             	sub    $0x8,%esp
+  801473:	ff 75 0c             	push   0xc(%ebp)
+  801476:	56                   	push   %esi
+  801477:	ff d0                	call   *%eax
+  801479:	83 c4 10             	add    $0x10,%esp
+}
+  80147c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80147f:	5b                   	pop    %ebx
+  801480:	5e                   	pop    %esi
+  801481:	5d                   	pop    %ebp
+  801482:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801483:	a1 08 40 80 00       	mov    0x804008,%eax
+  801488:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80148b:	83 ec 04             	sub    $0x4,%esp
+  80148e:	53                   	push   %ebx
+  80148f:	50                   	push   %eax
+  801490:	68 b0 2b 80 00       	push   $0x802bb0
+  801495:	e8 6f ed ff ff       	call   800209 <cprintf>
+		return -E_INVAL;
+  80149a:	83 c4 10             	add    $0x10,%esp
+  80149d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014a2:	eb d8                	jmp    80147c <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8014a4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8014a9:	eb d1                	jmp    80147c <ftruncate+0x50>
+
+008014ab <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8014ab:	55                   	push   %ebp
+  8014ac:	89 e5                	mov    %esp,%ebp
+  8014ae:	56                   	push   %esi
+  8014af:	53                   	push   %ebx
+  8014b0:	83 ec 18             	sub    $0x18,%esp
+  8014b3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8014b6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8014b9:	50                   	push   %eax
+  8014ba:	ff 75 08             	push   0x8(%ebp)
+  8014bd:	e8 8b fb ff ff       	call   80104d <fd_lookup>
+  8014c2:	83 c4 10             	add    $0x10,%esp
+  8014c5:	85 c0                	test   %eax,%eax
+  8014c7:	78 49                	js     801512 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8014c9:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8014cc:	83 ec 08             	sub    $0x8,%esp
+  8014cf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014d2:	50                   	push   %eax
+  8014d3:	ff 36                	push   (%esi)
+  8014d5:	e8 c3 fb ff ff       	call   80109d <dev_lookup>
+  8014da:	83 c4 10             	add    $0x10,%esp
+  8014dd:	85 c0                	test   %eax,%eax
+  8014df:	78 31                	js     801512 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8014e1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014e4:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8014e8:	74 2f                	je     801519 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8014ea:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8014ed:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8014f4:	00 00 00 
+	stat->st_isdir = 0;
+  8014f7:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8014fe:	00 00 00 
+	stat->st_dev = dev;
+  801501:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801507:	83 ec 08             	sub    $0x8,%esp
+  80150a:	53                   	push   %ebx
+  80150b:	56                   	push   %esi
+  80150c:	ff 50 14             	call   *0x14(%eax)
+  80150f:	83 c4 10             	add    $0x10,%esp
+}
+  801512:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801515:	5b                   	pop    %ebx
+  801516:	5e                   	pop    %esi
+  801517:	5d                   	pop    %ebp
+  801518:	c3                   	ret
+		return -E_NOT_SUPP;
+  801519:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80151e:	eb f2                	jmp    801512 <fstat+0x67>
+
+00801520 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801520:	55                   	push   %ebp
+  801521:	89 e5                	mov    %esp,%ebp
+  801523:	56                   	push   %esi
+  801524:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801525:	83 ec 08             	sub    $0x8,%esp
+  801528:	6a 00                	push   $0x0
+  80152a:	ff 75 08             	push   0x8(%ebp)
+  80152d:	e8 e4 01 00 00       	call   801716 <open>
+  801532:	89 c3                	mov    %eax,%ebx
+  801534:	83 c4 10             	add    $0x10,%esp
+  801537:	85 c0                	test   %eax,%eax
+  801539:	78 1b                	js     801556 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80153b:	83 ec 08             	sub    $0x8,%esp
+  80153e:	ff 75 0c             	push   0xc(%ebp)
+  801541:	50                   	push   %eax
+  801542:	e8 64 ff ff ff       	call   8014ab <fstat>
+  801547:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801549:	89 1c 24             	mov    %ebx,(%esp)
+  80154c:	e8 26 fc ff ff       	call   801177 <close>
+	return r;
+  801551:	83 c4 10             	add    $0x10,%esp
+  801554:	89 f3                	mov    %esi,%ebx
+}
+  801556:	89 d8                	mov    %ebx,%eax
+  801558:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80155b:	5b                   	pop    %ebx
+  80155c:	5e                   	pop    %esi
+  80155d:	5d                   	pop    %ebp
+  80155e:	c3                   	ret
+
+0080155f <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  80155f:	55                   	push   %ebp
+  801560:	89 e5                	mov    %esp,%ebp
+  801562:	56                   	push   %esi
+  801563:	53                   	push   %ebx
+  801564:	89 c6                	mov    %eax,%esi
+  801566:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  801568:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  80156f:	74 27                	je     801598 <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801571:	6a 07                	push   $0x7
+  801573:	68 00 50 80 00       	push   $0x805000
+  801578:	56                   	push   %esi
+  801579:	ff 35 00 40 80 00    	push   0x804000
+  80157f:	e8 2b 0d 00 00       	call   8022af <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  801584:	83 c4 0c             	add    $0xc,%esp
+  801587:	6a 00                	push   $0x0
+  801589:	53                   	push   %ebx
+  80158a:	6a 00                	push   $0x0
+  80158c:	e8 aa 0c 00 00       	call   80223b <ipc_recv>
+}
+  801591:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801594:	5b                   	pop    %ebx
+  801595:	5e                   	pop    %esi
+  801596:	5d                   	pop    %ebp
+  801597:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  801598:	83 ec 0c             	sub    $0xc,%esp
+  80159b:	6a 01                	push   $0x1
+  80159d:	e8 61 0d 00 00       	call   802303 <ipc_find_env>
+  8015a2:	a3 00 40 80 00       	mov    %eax,0x804000
+  8015a7:	83 c4 10             	add    $0x10,%esp
+  8015aa:	eb c5                	jmp    801571 <fsipc+0x12>
+
+008015ac <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8015ac:	55                   	push   %ebp
+  8015ad:	89 e5                	mov    %esp,%ebp
+  8015af:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8015b2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015b5:	8b 40 0c             	mov    0xc(%eax),%eax
+  8015b8:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.set_size.req_size = newsize;
+  8015bd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8015c0:	a3 04 50 80 00       	mov    %eax,0x805004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  8015c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015ca:	b8 02 00 00 00       	mov    $0x2,%eax
+  8015cf:	e8 8b ff ff ff       	call   80155f <fsipc>
+}
+  8015d4:	c9                   	leave
+  8015d5:	c3                   	ret
+
+008015d6 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8015d6:	55                   	push   %ebp
+  8015d7:	89 e5                	mov    %esp,%ebp
+  8015d9:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8015dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015df:	8b 40 0c             	mov    0xc(%eax),%eax
+  8015e2:	a3 00 50 80 00       	mov    %eax,0x805000
+  return fsipc(FSREQ_FLUSH, NULL);
+  8015e7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015ec:	b8 06 00 00 00       	mov    $0x6,%eax
+  8015f1:	e8 69 ff ff ff       	call   80155f <fsipc>
+}
+  8015f6:	c9                   	leave
+  8015f7:	c3                   	ret
+
+008015f8 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8015f8:	55                   	push   %ebp
+  8015f9:	89 e5                	mov    %esp,%ebp
+  8015fb:	53                   	push   %ebx
+  8015fc:	83 ec 04             	sub    $0x4,%esp
+  8015ff:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801602:	8b 45 08             	mov    0x8(%ebp),%eax
+  801605:	8b 40 0c             	mov    0xc(%eax),%eax
+  801608:	a3 00 50 80 00       	mov    %eax,0x805000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80160d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801612:	b8 05 00 00 00       	mov    $0x5,%eax
+  801617:	e8 43 ff ff ff       	call   80155f <fsipc>
+  80161c:	85 c0                	test   %eax,%eax
+  80161e:	78 2c                	js     80164c <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801620:	83 ec 08             	sub    $0x8,%esp
+  801623:	68 00 50 80 00       	push   $0x805000
+  801628:	53                   	push   %ebx
+  801629:	e8 94 f1 ff ff       	call   8007c2 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  80162e:	a1 80 50 80 00       	mov    0x805080,%eax
+  801633:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801639:	a1 84 50 80 00       	mov    0x805084,%eax
+  80163e:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801644:	83 c4 10             	add    $0x10,%esp
+  801647:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80164c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80164f:	c9                   	leave
+  801650:	c3                   	ret
+
+00801651 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801651:	55                   	push   %ebp
+  801652:	89 e5                	mov    %esp,%ebp
+  801654:	83 ec 0c             	sub    $0xc,%esp
+  801657:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80165a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80165d:	8b 52 0c             	mov    0xc(%edx),%edx
+  801660:	89 15 00 50 80 00    	mov    %edx,0x805000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801666:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  80166b:	39 d0                	cmp    %edx,%eax
+  80166d:	0f 47 c2             	cmova  %edx,%eax
+  801670:	a3 04 50 80 00       	mov    %eax,0x805004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  801675:	50                   	push   %eax
+  801676:	ff 75 0c             	push   0xc(%ebp)
+  801679:	68 08 50 80 00       	push   $0x805008
+  80167e:	e8 c5 f2 ff ff       	call   800948 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801683:	ba 00 00 00 00       	mov    $0x0,%edx
+  801688:	b8 04 00 00 00       	mov    $0x4,%eax
+  80168d:	e8 cd fe ff ff       	call   80155f <fsipc>
+}
+  801692:	c9                   	leave
+  801693:	c3                   	ret
+
+00801694 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801694:	55                   	push   %ebp
+  801695:	89 e5                	mov    %esp,%ebp
+  801697:	56                   	push   %esi
+  801698:	53                   	push   %ebx
+  801699:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80169c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80169f:	8b 40 0c             	mov    0xc(%eax),%eax
+  8016a2:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.read.req_n = n;
+  8016a7:	89 35 04 50 80 00    	mov    %esi,0x805004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8016ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016b2:	b8 03 00 00 00       	mov    $0x3,%eax
+  8016b7:	e8 a3 fe ff ff       	call   80155f <fsipc>
+  8016bc:	89 c3                	mov    %eax,%ebx
+  8016be:	85 c0                	test   %eax,%eax
+  8016c0:	78 1f                	js     8016e1 <devfile_read+0x4d>
+  assert(r <= n);
+  8016c2:	39 c6                	cmp    %eax,%esi
+  8016c4:	72 24                	jb     8016ea <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  8016c6:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8016cb:	7f 33                	jg     801700 <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8016cd:	83 ec 04             	sub    $0x4,%esp
+  8016d0:	50                   	push   %eax
+  8016d1:	68 00 50 80 00       	push   $0x805000
+  8016d6:	ff 75 0c             	push   0xc(%ebp)
+  8016d9:	e8 6a f2 ff ff       	call   800948 <memmove>
+  return r;
+  8016de:	83 c4 10             	add    $0x10,%esp
+}
+  8016e1:	89 d8                	mov    %ebx,%eax
+  8016e3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016e6:	5b                   	pop    %ebx
+  8016e7:	5e                   	pop    %esi
+  8016e8:	5d                   	pop    %ebp
+  8016e9:	c3                   	ret
+  assert(r <= n);
+  8016ea:	68 20 2c 80 00       	push   $0x802c20
+  8016ef:	68 27 2c 80 00       	push   $0x802c27
+  8016f4:	6a 78                	push   $0x78
+  8016f6:	68 3c 2c 80 00       	push   $0x802c3c
+  8016fb:	e8 f5 0a 00 00       	call   8021f5 <_panic>
+  assert(r <= PGSIZE);
+  801700:	68 47 2c 80 00       	push   $0x802c47
+  801705:	68 27 2c 80 00       	push   $0x802c27
+  80170a:	6a 79                	push   $0x79
+  80170c:	68 3c 2c 80 00       	push   $0x802c3c
+  801711:	e8 df 0a 00 00       	call   8021f5 <_panic>
+
+00801716 <open>:
+open(const char *path, int mode) {
+  801716:	55                   	push   %ebp
+  801717:	89 e5                	mov    %esp,%ebp
+  801719:	56                   	push   %esi
+  80171a:	53                   	push   %ebx
+  80171b:	83 ec 1c             	sub    $0x1c,%esp
+  80171e:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801721:	56                   	push   %esi
+  801722:	e8 60 f0 ff ff       	call   800787 <strlen>
+  801727:	83 c4 10             	add    $0x10,%esp
+  80172a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80172f:	7f 6c                	jg     80179d <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801731:	83 ec 0c             	sub    $0xc,%esp
+  801734:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801737:	50                   	push   %eax
+  801738:	e8 ba f8 ff ff       	call   800ff7 <fd_alloc>
+  80173d:	89 c3                	mov    %eax,%ebx
+  80173f:	83 c4 10             	add    $0x10,%esp
+  801742:	85 c0                	test   %eax,%eax
+  801744:	78 3c                	js     801782 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801746:	83 ec 08             	sub    $0x8,%esp
+  801749:	56                   	push   %esi
+  80174a:	68 00 50 80 00       	push   $0x805000
+  80174f:	e8 6e f0 ff ff       	call   8007c2 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801754:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801757:	a3 00 54 80 00       	mov    %eax,0x805400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80175c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80175f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801764:	e8 f6 fd ff ff       	call   80155f <fsipc>
+  801769:	89 c3                	mov    %eax,%ebx
+  80176b:	83 c4 10             	add    $0x10,%esp
+  80176e:	85 c0                	test   %eax,%eax
+  801770:	78 19                	js     80178b <open+0x75>
+  return fd2num(fd);
+  801772:	83 ec 0c             	sub    $0xc,%esp
+  801775:	ff 75 f4             	push   -0xc(%ebp)
+  801778:	e8 53 f8 ff ff       	call   800fd0 <fd2num>
+  80177d:	89 c3                	mov    %eax,%ebx
+  80177f:	83 c4 10             	add    $0x10,%esp
+}
+  801782:	89 d8                	mov    %ebx,%eax
+  801784:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801787:	5b                   	pop    %ebx
+  801788:	5e                   	pop    %esi
+  801789:	5d                   	pop    %ebp
+  80178a:	c3                   	ret
+    fd_close(fd, 0);
+  80178b:	83 ec 08             	sub    $0x8,%esp
+  80178e:	6a 00                	push   $0x0
+  801790:	ff 75 f4             	push   -0xc(%ebp)
+  801793:	e8 58 f9 ff ff       	call   8010f0 <fd_close>
+    return r;
+  801798:	83 c4 10             	add    $0x10,%esp
+  80179b:	eb e5                	jmp    801782 <open+0x6c>
+    return -E_BAD_PATH;
+  80179d:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8017a2:	eb de                	jmp    801782 <open+0x6c>
+
+008017a4 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  8017a4:	55                   	push   %ebp
+  8017a5:	89 e5                	mov    %esp,%ebp
+  8017a7:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  8017aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017af:	b8 08 00 00 00       	mov    $0x8,%eax
+  8017b4:	e8 a6 fd ff ff       	call   80155f <fsipc>
+}
+  8017b9:	c9                   	leave
+  8017ba:	c3                   	ret
+
+008017bb <writebuf>:
+
+
+static void
+writebuf(struct printbuf *b)
+{
+	if (b->error > 0) {
+  8017bb:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8017bf:	7f 01                	jg     8017c2 <writebuf+0x7>
+  8017c1:	c3                   	ret
+{
+  8017c2:	55                   	push   %ebp
+  8017c3:	89 e5                	mov    %esp,%ebp
+  8017c5:	53                   	push   %ebx
+  8017c6:	83 ec 08             	sub    $0x8,%esp
+  8017c9:	89 c3                	mov    %eax,%ebx
+		ssize_t result = write(b->fd, b->buf, b->idx);
+  8017cb:	ff 70 04             	push   0x4(%eax)
+  8017ce:	8d 40 10             	lea    0x10(%eax),%eax
+  8017d1:	50                   	push   %eax
+  8017d2:	ff 33                	push   (%ebx)
+  8017d4:	e8 a8 fb ff ff       	call   801381 <write>
+		if (result > 0)
+  8017d9:	83 c4 10             	add    $0x10,%esp
+  8017dc:	85 c0                	test   %eax,%eax
+  8017de:	7e 03                	jle    8017e3 <writebuf+0x28>
+			b->result += result;
+  8017e0:	01 43 08             	add    %eax,0x8(%ebx)
+		if (result != b->idx) // error, or wrote less than supplied
+  8017e3:	39 43 04             	cmp    %eax,0x4(%ebx)
+  8017e6:	74 0d                	je     8017f5 <writebuf+0x3a>
+			b->error = (result < 0 ? result : 0);
+  8017e8:	85 c0                	test   %eax,%eax
+  8017ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017ef:	0f 4f c2             	cmovg  %edx,%eax
+  8017f2:	89 43 0c             	mov    %eax,0xc(%ebx)
+	}
+}
+  8017f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017f8:	c9                   	leave
+  8017f9:	c3                   	ret
+
+008017fa <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  8017fa:	55                   	push   %ebp
+  8017fb:	89 e5                	mov    %esp,%ebp
+  8017fd:	53                   	push   %ebx
+  8017fe:	83 ec 04             	sub    $0x4,%esp
+  801801:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct printbuf *b = (struct printbuf *) thunk;
+	b->buf[b->idx++] = ch;
+  801804:	8b 53 04             	mov    0x4(%ebx),%edx
+  801807:	8d 42 01             	lea    0x1(%edx),%eax
+  80180a:	89 43 04             	mov    %eax,0x4(%ebx)
+  80180d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801810:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+	if (b->idx == 256) {
+  801814:	3d 00 01 00 00       	cmp    $0x100,%eax
+  801819:	74 05                	je     801820 <putch+0x26>
+		writebuf(b);
+		b->idx = 0;
+	}
+}
+  80181b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80181e:	c9                   	leave
+  80181f:	c3                   	ret
+		writebuf(b);
+  801820:	89 d8                	mov    %ebx,%eax
+  801822:	e8 94 ff ff ff       	call   8017bb <writebuf>
+		b->idx = 0;
+  801827:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+  80182e:	eb eb                	jmp    80181b <putch+0x21>
+
+00801830 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  801830:	55                   	push   %ebp
+  801831:	89 e5                	mov    %esp,%ebp
+  801833:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.fd = fd;
+  801839:	8b 45 08             	mov    0x8(%ebp),%eax
+  80183c:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+	b.idx = 0;
+  801842:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  801849:	00 00 00 
+	b.result = 0;
+  80184c:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  801853:	00 00 00 
+	b.error = 1;
+  801856:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  80185d:	00 00 00 
+	vprintfmt(putch, &b, fmt, ap);
+  801860:	ff 75 10             	push   0x10(%ebp)
+  801863:	ff 75 0c             	push   0xc(%ebp)
+  801866:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  80186c:	50                   	push   %eax
+  80186d:	68 fa 17 80 00       	push   $0x8017fa
+  801872:	e8 89 ea ff ff       	call   800300 <vprintfmt>
+	if (b.idx > 0)
+  801877:	83 c4 10             	add    $0x10,%esp
+  80187a:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  801881:	7f 12                	jg     801895 <vfprintf+0x65>
+		writebuf(&b);
+
+	return (b.result ? b.result : b.error);
+  801883:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  801889:	85 c0                	test   %eax,%eax
+  80188b:	75 06                	jne    801893 <vfprintf+0x63>
+  80188d:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  801893:	c9                   	leave
+  801894:	c3                   	ret
+		writebuf(&b);
+  801895:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  80189b:	e8 1b ff ff ff       	call   8017bb <writebuf>
+  8018a0:	eb e1                	jmp    801883 <vfprintf+0x53>
+
+008018a2 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  8018a2:	55                   	push   %ebp
+  8018a3:	89 e5                	mov    %esp,%ebp
+  8018a5:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8018a8:	8d 45 10             	lea    0x10(%ebp),%eax
+	cnt = vfprintf(fd, fmt, ap);
+  8018ab:	50                   	push   %eax
+  8018ac:	ff 75 0c             	push   0xc(%ebp)
+  8018af:	ff 75 08             	push   0x8(%ebp)
+  8018b2:	e8 79 ff ff ff       	call   801830 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8018b7:	c9                   	leave
+  8018b8:	c3                   	ret
+
+008018b9 <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  8018b9:	55                   	push   %ebp
+  8018ba:	89 e5                	mov    %esp,%ebp
+  8018bc:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8018bf:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vfprintf(1, fmt, ap);
+  8018c2:	50                   	push   %eax
+  8018c3:	ff 75 08             	push   0x8(%ebp)
+  8018c6:	6a 01                	push   $0x1
+  8018c8:	e8 63 ff ff ff       	call   801830 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8018cd:	c9                   	leave
+  8018ce:	c3                   	ret
+
+008018cf <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8018cf:	55                   	push   %ebp
+  8018d0:	89 e5                	mov    %esp,%ebp
+  8018d2:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8018d5:	68 53 2c 80 00       	push   $0x802c53
+  8018da:	ff 75 0c             	push   0xc(%ebp)
+  8018dd:	e8 e0 ee ff ff       	call   8007c2 <strcpy>
+	return 0;
+}
+  8018e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018e7:	c9                   	leave
+  8018e8:	c3                   	ret
+
+008018e9 <devsock_close>:
+{
+  8018e9:	55                   	push   %ebp
+  8018ea:	89 e5                	mov    %esp,%ebp
+  8018ec:	53                   	push   %ebx
+  8018ed:	83 ec 10             	sub    $0x10,%esp
+  8018f0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8018f3:	53                   	push   %ebx
+  8018f4:	e8 49 0a 00 00       	call   802342 <pageref>
+  8018f9:	89 c2                	mov    %eax,%edx
+  8018fb:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8018fe:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801903:	83 fa 01             	cmp    $0x1,%edx
+  801906:	74 05                	je     80190d <devsock_close+0x24>
+}
+  801908:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80190b:	c9                   	leave
+  80190c:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  80190d:	83 ec 0c             	sub    $0xc,%esp
+  801910:	ff 73 0c             	push   0xc(%ebx)
+  801913:	e8 b7 02 00 00       	call   801bcf <nsipc_close>
+  801918:	83 c4 10             	add    $0x10,%esp
+  80191b:	eb eb                	jmp    801908 <devsock_close+0x1f>
+
+0080191d <devsock_write>:
+{
+  80191d:	55                   	push   %ebp
+  80191e:	89 e5                	mov    %esp,%ebp
+  801920:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801923:	6a 00                	push   $0x0
+  801925:	ff 75 10             	push   0x10(%ebp)
+  801928:	ff 75 0c             	push   0xc(%ebp)
+  80192b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80192e:	ff 70 0c             	push   0xc(%eax)
+  801931:	e8 79 03 00 00       	call   801caf <nsipc_send>
+}
+  801936:	c9                   	leave
+  801937:	c3                   	ret
+
+00801938 <devsock_read>:
+{
+  801938:	55                   	push   %ebp
+  801939:	89 e5                	mov    %esp,%ebp
+  80193b:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  80193e:	6a 00                	push   $0x0
+  801940:	ff 75 10             	push   0x10(%ebp)
+  801943:	ff 75 0c             	push   0xc(%ebp)
+  801946:	8b 45 08             	mov    0x8(%ebp),%eax
+  801949:	ff 70 0c             	push   0xc(%eax)
+  80194c:	e8 ef 02 00 00       	call   801c40 <nsipc_recv>
+}
+  801951:	c9                   	leave
+  801952:	c3                   	ret
+
+00801953 <fd2sockid>:
+{
+  801953:	55                   	push   %ebp
+  801954:	89 e5                	mov    %esp,%ebp
+  801956:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801959:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80195c:	52                   	push   %edx
+  80195d:	50                   	push   %eax
+  80195e:	e8 ea f6 ff ff       	call   80104d <fd_lookup>
+  801963:	83 c4 10             	add    $0x10,%esp
+  801966:	85 c0                	test   %eax,%eax
+  801968:	78 10                	js     80197a <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  80196a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80196d:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  801973:	39 08                	cmp    %ecx,(%eax)
+  801975:	75 05                	jne    80197c <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801977:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  80197a:	c9                   	leave
+  80197b:	c3                   	ret
+		return -E_NOT_SUPP;
+  80197c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801981:	eb f7                	jmp    80197a <fd2sockid+0x27>
+
+00801983 <alloc_sockfd>:
+{
+  801983:	55                   	push   %ebp
+  801984:	89 e5                	mov    %esp,%ebp
+  801986:	56                   	push   %esi
+  801987:	53                   	push   %ebx
+  801988:	83 ec 1c             	sub    $0x1c,%esp
+  80198b:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  80198d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801990:	50                   	push   %eax
+  801991:	e8 61 f6 ff ff       	call   800ff7 <fd_alloc>
+  801996:	89 c3                	mov    %eax,%ebx
+  801998:	83 c4 10             	add    $0x10,%esp
+  80199b:	85 c0                	test   %eax,%eax
+  80199d:	78 43                	js     8019e2 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80199f:	83 ec 04             	sub    $0x4,%esp
+  8019a2:	68 07 04 00 00       	push   $0x407
+  8019a7:	ff 75 f4             	push   -0xc(%ebp)
+  8019aa:	6a 00                	push   $0x0
+  8019ac:	e8 fd f1 ff ff       	call   800bae <sys_page_alloc>
+  8019b1:	89 c3                	mov    %eax,%ebx
+  8019b3:	83 c4 10             	add    $0x10,%esp
+  8019b6:	85 c0                	test   %eax,%eax
+  8019b8:	78 28                	js     8019e2 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8019ba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019bd:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  8019c3:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8019c5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019c8:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8019cf:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8019d2:	83 ec 0c             	sub    $0xc,%esp
+  8019d5:	50                   	push   %eax
+  8019d6:	e8 f5 f5 ff ff       	call   800fd0 <fd2num>
+  8019db:	89 c3                	mov    %eax,%ebx
+  8019dd:	83 c4 10             	add    $0x10,%esp
+  8019e0:	eb 0c                	jmp    8019ee <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8019e2:	83 ec 0c             	sub    $0xc,%esp
+  8019e5:	56                   	push   %esi
+  8019e6:	e8 e4 01 00 00       	call   801bcf <nsipc_close>
+		return r;
+  8019eb:	83 c4 10             	add    $0x10,%esp
+}
+  8019ee:	89 d8                	mov    %ebx,%eax
+  8019f0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019f3:	5b                   	pop    %ebx
+  8019f4:	5e                   	pop    %esi
+  8019f5:	5d                   	pop    %ebp
+  8019f6:	c3                   	ret
+
+008019f7 <accept>:
+{
+  8019f7:	55                   	push   %ebp
+  8019f8:	89 e5                	mov    %esp,%ebp
+  8019fa:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8019fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a00:	e8 4e ff ff ff       	call   801953 <fd2sockid>
+  801a05:	85 c0                	test   %eax,%eax
+  801a07:	78 1b                	js     801a24 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801a09:	83 ec 04             	sub    $0x4,%esp
+  801a0c:	ff 75 10             	push   0x10(%ebp)
+  801a0f:	ff 75 0c             	push   0xc(%ebp)
+  801a12:	50                   	push   %eax
+  801a13:	e8 0e 01 00 00       	call   801b26 <nsipc_accept>
+  801a18:	83 c4 10             	add    $0x10,%esp
+  801a1b:	85 c0                	test   %eax,%eax
+  801a1d:	78 05                	js     801a24 <accept+0x2d>
+	return alloc_sockfd(r);
+  801a1f:	e8 5f ff ff ff       	call   801983 <alloc_sockfd>
+}
+  801a24:	c9                   	leave
+  801a25:	c3                   	ret
+
+00801a26 <bind>:
+{
+  801a26:	55                   	push   %ebp
+  801a27:	89 e5                	mov    %esp,%ebp
+  801a29:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801a2c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a2f:	e8 1f ff ff ff       	call   801953 <fd2sockid>
+  801a34:	85 c0                	test   %eax,%eax
+  801a36:	78 12                	js     801a4a <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801a38:	83 ec 04             	sub    $0x4,%esp
+  801a3b:	ff 75 10             	push   0x10(%ebp)
+  801a3e:	ff 75 0c             	push   0xc(%ebp)
+  801a41:	50                   	push   %eax
+  801a42:	e8 31 01 00 00       	call   801b78 <nsipc_bind>
+  801a47:	83 c4 10             	add    $0x10,%esp
+}
+  801a4a:	c9                   	leave
+  801a4b:	c3                   	ret
+
+00801a4c <shutdown>:
+{
+  801a4c:	55                   	push   %ebp
+  801a4d:	89 e5                	mov    %esp,%ebp
+  801a4f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801a52:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a55:	e8 f9 fe ff ff       	call   801953 <fd2sockid>
+  801a5a:	85 c0                	test   %eax,%eax
+  801a5c:	78 0f                	js     801a6d <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801a5e:	83 ec 08             	sub    $0x8,%esp
+  801a61:	ff 75 0c             	push   0xc(%ebp)
+  801a64:	50                   	push   %eax
+  801a65:	e8 43 01 00 00       	call   801bad <nsipc_shutdown>
+  801a6a:	83 c4 10             	add    $0x10,%esp
+}
+  801a6d:	c9                   	leave
+  801a6e:	c3                   	ret
+
+00801a6f <connect>:
+{
+  801a6f:	55                   	push   %ebp
+  801a70:	89 e5                	mov    %esp,%ebp
+  801a72:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801a75:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a78:	e8 d6 fe ff ff       	call   801953 <fd2sockid>
+  801a7d:	85 c0                	test   %eax,%eax
+  801a7f:	78 12                	js     801a93 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801a81:	83 ec 04             	sub    $0x4,%esp
+  801a84:	ff 75 10             	push   0x10(%ebp)
+  801a87:	ff 75 0c             	push   0xc(%ebp)
+  801a8a:	50                   	push   %eax
+  801a8b:	e8 59 01 00 00       	call   801be9 <nsipc_connect>
+  801a90:	83 c4 10             	add    $0x10,%esp
+}
+  801a93:	c9                   	leave
+  801a94:	c3                   	ret
+
+00801a95 <listen>:
+{
+  801a95:	55                   	push   %ebp
+  801a96:	89 e5                	mov    %esp,%ebp
+  801a98:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801a9b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a9e:	e8 b0 fe ff ff       	call   801953 <fd2sockid>
+  801aa3:	85 c0                	test   %eax,%eax
+  801aa5:	78 0f                	js     801ab6 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801aa7:	83 ec 08             	sub    $0x8,%esp
+  801aaa:	ff 75 0c             	push   0xc(%ebp)
+  801aad:	50                   	push   %eax
+  801aae:	e8 6b 01 00 00       	call   801c1e <nsipc_listen>
+  801ab3:	83 c4 10             	add    $0x10,%esp
+}
+  801ab6:	c9                   	leave
+  801ab7:	c3                   	ret
+
+00801ab8 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801ab8:	55                   	push   %ebp
+  801ab9:	89 e5                	mov    %esp,%ebp
+  801abb:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801abe:	ff 75 10             	push   0x10(%ebp)
+  801ac1:	ff 75 0c             	push   0xc(%ebp)
+  801ac4:	ff 75 08             	push   0x8(%ebp)
+  801ac7:	e8 41 02 00 00       	call   801d0d <nsipc_socket>
+  801acc:	83 c4 10             	add    $0x10,%esp
+  801acf:	85 c0                	test   %eax,%eax
+  801ad1:	78 05                	js     801ad8 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801ad3:	e8 ab fe ff ff       	call   801983 <alloc_sockfd>
+}
+  801ad8:	c9                   	leave
+  801ad9:	c3                   	ret
+
+00801ada <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801ada:	55                   	push   %ebp
+  801adb:	89 e5                	mov    %esp,%ebp
+  801add:	53                   	push   %ebx
+  801ade:	83 ec 04             	sub    $0x4,%esp
+  801ae1:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801ae3:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801aea:	74 26                	je     801b12 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801aec:	6a 07                	push   $0x7
+  801aee:	68 00 60 80 00       	push   $0x806000
+  801af3:	53                   	push   %ebx
+  801af4:	ff 35 04 40 80 00    	push   0x804004
+  801afa:	e8 b0 07 00 00       	call   8022af <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801aff:	83 c4 0c             	add    $0xc,%esp
+  801b02:	6a 00                	push   $0x0
+  801b04:	6a 00                	push   $0x0
+  801b06:	6a 00                	push   $0x0
+  801b08:	e8 2e 07 00 00       	call   80223b <ipc_recv>
+}
+  801b0d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b10:	c9                   	leave
+  801b11:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801b12:	83 ec 0c             	sub    $0xc,%esp
+  801b15:	6a 02                	push   $0x2
+  801b17:	e8 e7 07 00 00       	call   802303 <ipc_find_env>
+  801b1c:	a3 04 40 80 00       	mov    %eax,0x804004
+  801b21:	83 c4 10             	add    $0x10,%esp
+  801b24:	eb c6                	jmp    801aec <nsipc+0x12>
+
+00801b26 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801b26:	55                   	push   %ebp
+  801b27:	89 e5                	mov    %esp,%ebp
+  801b29:	56                   	push   %esi
+  801b2a:	53                   	push   %ebx
+  801b2b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801b2e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b31:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801b36:	8b 06                	mov    (%esi),%eax
+  801b38:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801b3d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b42:	e8 93 ff ff ff       	call   801ada <nsipc>
+  801b47:	89 c3                	mov    %eax,%ebx
+  801b49:	85 c0                	test   %eax,%eax
+  801b4b:	79 09                	jns    801b56 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801b4d:	89 d8                	mov    %ebx,%eax
+  801b4f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b52:	5b                   	pop    %ebx
+  801b53:	5e                   	pop    %esi
+  801b54:	5d                   	pop    %ebp
+  801b55:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801b56:	83 ec 04             	sub    $0x4,%esp
+  801b59:	ff 35 10 60 80 00    	push   0x806010
+  801b5f:	68 00 60 80 00       	push   $0x806000
+  801b64:	ff 75 0c             	push   0xc(%ebp)
+  801b67:	e8 dc ed ff ff       	call   800948 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801b6c:	a1 10 60 80 00       	mov    0x806010,%eax
+  801b71:	89 06                	mov    %eax,(%esi)
+  801b73:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801b76:	eb d5                	jmp    801b4d <nsipc_accept+0x27>
+
+00801b78 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801b78:	55                   	push   %ebp
+  801b79:	89 e5                	mov    %esp,%ebp
+  801b7b:	53                   	push   %ebx
+  801b7c:	83 ec 08             	sub    $0x8,%esp
+  801b7f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801b82:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b85:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801b8a:	53                   	push   %ebx
+  801b8b:	ff 75 0c             	push   0xc(%ebp)
+  801b8e:	68 04 60 80 00       	push   $0x806004
+  801b93:	e8 b0 ed ff ff       	call   800948 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801b98:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  801b9e:	b8 02 00 00 00       	mov    $0x2,%eax
+  801ba3:	e8 32 ff ff ff       	call   801ada <nsipc>
+}
+  801ba8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bab:	c9                   	leave
+  801bac:	c3                   	ret
+
+00801bad <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801bad:	55                   	push   %ebp
+  801bae:	89 e5                	mov    %esp,%ebp
+  801bb0:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801bb3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bb6:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  801bbb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801bbe:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  801bc3:	b8 03 00 00 00       	mov    $0x3,%eax
+  801bc8:	e8 0d ff ff ff       	call   801ada <nsipc>
+}
+  801bcd:	c9                   	leave
+  801bce:	c3                   	ret
+
+00801bcf <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801bcf:	55                   	push   %ebp
+  801bd0:	89 e5                	mov    %esp,%ebp
+  801bd2:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801bd5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bd8:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  801bdd:	b8 04 00 00 00       	mov    $0x4,%eax
+  801be2:	e8 f3 fe ff ff       	call   801ada <nsipc>
+}
+  801be7:	c9                   	leave
+  801be8:	c3                   	ret
+
+00801be9 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801be9:	55                   	push   %ebp
+  801bea:	89 e5                	mov    %esp,%ebp
+  801bec:	53                   	push   %ebx
+  801bed:	83 ec 08             	sub    $0x8,%esp
+  801bf0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801bf3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bf6:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801bfb:	53                   	push   %ebx
+  801bfc:	ff 75 0c             	push   0xc(%ebp)
+  801bff:	68 04 60 80 00       	push   $0x806004
+  801c04:	e8 3f ed ff ff       	call   800948 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801c09:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  801c0f:	b8 05 00 00 00       	mov    $0x5,%eax
+  801c14:	e8 c1 fe ff ff       	call   801ada <nsipc>
+}
+  801c19:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c1c:	c9                   	leave
+  801c1d:	c3                   	ret
+
+00801c1e <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801c1e:	55                   	push   %ebp
+  801c1f:	89 e5                	mov    %esp,%ebp
+  801c21:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801c24:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c27:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  801c2c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c2f:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  801c34:	b8 06 00 00 00       	mov    $0x6,%eax
+  801c39:	e8 9c fe ff ff       	call   801ada <nsipc>
+}
+  801c3e:	c9                   	leave
+  801c3f:	c3                   	ret
+
+00801c40 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801c40:	55                   	push   %ebp
+  801c41:	89 e5                	mov    %esp,%ebp
+  801c43:	56                   	push   %esi
+  801c44:	53                   	push   %ebx
+  801c45:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801c48:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c4b:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  801c50:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  801c56:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c59:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801c5e:	b8 07 00 00 00       	mov    $0x7,%eax
+  801c63:	e8 72 fe ff ff       	call   801ada <nsipc>
+  801c68:	89 c3                	mov    %eax,%ebx
+  801c6a:	85 c0                	test   %eax,%eax
+  801c6c:	78 22                	js     801c90 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801c6e:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801c73:	39 c6                	cmp    %eax,%esi
+  801c75:	0f 4e c6             	cmovle %esi,%eax
+  801c78:	39 c3                	cmp    %eax,%ebx
+  801c7a:	7f 1d                	jg     801c99 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801c7c:	83 ec 04             	sub    $0x4,%esp
+  801c7f:	53                   	push   %ebx
+  801c80:	68 00 60 80 00       	push   $0x806000
+  801c85:	ff 75 0c             	push   0xc(%ebp)
+  801c88:	e8 bb ec ff ff       	call   800948 <memmove>
+  801c8d:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801c90:	89 d8                	mov    %ebx,%eax
+  801c92:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c95:	5b                   	pop    %ebx
+  801c96:	5e                   	pop    %esi
+  801c97:	5d                   	pop    %ebp
+  801c98:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801c99:	68 5f 2c 80 00       	push   $0x802c5f
+  801c9e:	68 27 2c 80 00       	push   $0x802c27
+  801ca3:	6a 62                	push   $0x62
+  801ca5:	68 74 2c 80 00       	push   $0x802c74
+  801caa:	e8 46 05 00 00       	call   8021f5 <_panic>
+
+00801caf <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801caf:	55                   	push   %ebp
+  801cb0:	89 e5                	mov    %esp,%ebp
+  801cb2:	53                   	push   %ebx
+  801cb3:	83 ec 04             	sub    $0x4,%esp
+  801cb6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801cb9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cbc:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  801cc1:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801cc7:	7f 2e                	jg     801cf7 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801cc9:	83 ec 04             	sub    $0x4,%esp
+  801ccc:	53                   	push   %ebx
+  801ccd:	ff 75 0c             	push   0xc(%ebp)
+  801cd0:	68 0c 60 80 00       	push   $0x80600c
+  801cd5:	e8 6e ec ff ff       	call   800948 <memmove>
+	nsipcbuf.send.req_size = size;
+  801cda:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  801ce0:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ce3:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  801ce8:	b8 08 00 00 00       	mov    $0x8,%eax
+  801ced:	e8 e8 fd ff ff       	call   801ada <nsipc>
+}
+  801cf2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cf5:	c9                   	leave
+  801cf6:	c3                   	ret
+	assert(size < 1600);
+  801cf7:	68 80 2c 80 00       	push   $0x802c80
+  801cfc:	68 27 2c 80 00       	push   $0x802c27
+  801d01:	6a 6d                	push   $0x6d
+  801d03:	68 74 2c 80 00       	push   $0x802c74
+  801d08:	e8 e8 04 00 00       	call   8021f5 <_panic>
+
+00801d0d <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801d0d:	55                   	push   %ebp
+  801d0e:	89 e5                	mov    %esp,%ebp
+  801d10:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801d13:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d16:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  801d1b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d1e:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  801d23:	8b 45 10             	mov    0x10(%ebp),%eax
+  801d26:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  801d2b:	b8 09 00 00 00       	mov    $0x9,%eax
+  801d30:	e8 a5 fd ff ff       	call   801ada <nsipc>
+}
+  801d35:	c9                   	leave
+  801d36:	c3                   	ret
+
+00801d37 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801d37:	55                   	push   %ebp
+  801d38:	89 e5                	mov    %esp,%ebp
+  801d3a:	56                   	push   %esi
+  801d3b:	53                   	push   %ebx
+  801d3c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801d3f:	83 ec 0c             	sub    $0xc,%esp
+  801d42:	ff 75 08             	push   0x8(%ebp)
+  801d45:	e8 96 f2 ff ff       	call   800fe0 <fd2data>
+  801d4a:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801d4c:	83 c4 08             	add    $0x8,%esp
+  801d4f:	68 8c 2c 80 00       	push   $0x802c8c
+  801d54:	53                   	push   %ebx
+  801d55:	e8 68 ea ff ff       	call   8007c2 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801d5a:	8b 46 04             	mov    0x4(%esi),%eax
+  801d5d:	2b 06                	sub    (%esi),%eax
+  801d5f:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  801d65:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801d6c:	00 00 00 
+	stat->st_dev = &devpipe;
+  801d6f:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  801d76:	30 80 00 
+	return 0;
+}
+  801d79:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d7e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d81:	5b                   	pop    %ebx
+  801d82:	5e                   	pop    %esi
+  801d83:	5d                   	pop    %ebp
+  801d84:	c3                   	ret
+
+00801d85 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801d85:	55                   	push   %ebp
+  801d86:	89 e5                	mov    %esp,%ebp
+  801d88:	53                   	push   %ebx
+  801d89:	83 ec 0c             	sub    $0xc,%esp
+  801d8c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801d8f:	53                   	push   %ebx
+  801d90:	6a 00                	push   $0x0
+  801d92:	e8 9c ee ff ff       	call   800c33 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801d97:	89 1c 24             	mov    %ebx,(%esp)
+  801d9a:	e8 41 f2 ff ff       	call   800fe0 <fd2data>
+  801d9f:	83 c4 08             	add    $0x8,%esp
+  801da2:	50                   	push   %eax
+  801da3:	6a 00                	push   $0x0
+  801da5:	e8 89 ee ff ff       	call   800c33 <sys_page_unmap>
+}
+  801daa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801dad:	c9                   	leave
+  801dae:	c3                   	ret
+
+00801daf <_pipeisclosed>:
+{
+  801daf:	55                   	push   %ebp
+  801db0:	89 e5                	mov    %esp,%ebp
+  801db2:	57                   	push   %edi
+  801db3:	56                   	push   %esi
+  801db4:	53                   	push   %ebx
+  801db5:	83 ec 1c             	sub    $0x1c,%esp
+  801db8:	89 c7                	mov    %eax,%edi
+  801dba:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801dbc:	a1 08 40 80 00       	mov    0x804008,%eax
+  801dc1:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801dc4:	83 ec 0c             	sub    $0xc,%esp
+  801dc7:	57                   	push   %edi
+  801dc8:	e8 75 05 00 00       	call   802342 <pageref>
+  801dcd:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801dd0:	89 34 24             	mov    %esi,(%esp)
+  801dd3:	e8 6a 05 00 00       	call   802342 <pageref>
+		nn = thisenv->env_runs;
+  801dd8:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801dde:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801de1:	83 c4 10             	add    $0x10,%esp
+  801de4:	39 cb                	cmp    %ecx,%ebx
+  801de6:	74 1b                	je     801e03 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801de8:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801deb:	75 cf                	jne    801dbc <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801ded:	8b 42 58             	mov    0x58(%edx),%eax
+  801df0:	6a 01                	push   $0x1
+  801df2:	50                   	push   %eax
+  801df3:	53                   	push   %ebx
+  801df4:	68 93 2c 80 00       	push   $0x802c93
+  801df9:	e8 0b e4 ff ff       	call   800209 <cprintf>
+  801dfe:	83 c4 10             	add    $0x10,%esp
+  801e01:	eb b9                	jmp    801dbc <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801e03:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801e06:	0f 94 c0             	sete   %al
+  801e09:	0f b6 c0             	movzbl %al,%eax
+}
+  801e0c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e0f:	5b                   	pop    %ebx
+  801e10:	5e                   	pop    %esi
+  801e11:	5f                   	pop    %edi
+  801e12:	5d                   	pop    %ebp
+  801e13:	c3                   	ret
+
+00801e14 <devpipe_write>:
+{
+  801e14:	55                   	push   %ebp
+  801e15:	89 e5                	mov    %esp,%ebp
+  801e17:	57                   	push   %edi
+  801e18:	56                   	push   %esi
+  801e19:	53                   	push   %ebx
+  801e1a:	83 ec 28             	sub    $0x28,%esp
+  801e1d:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801e20:	56                   	push   %esi
+  801e21:	e8 ba f1 ff ff       	call   800fe0 <fd2data>
+  801e26:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801e28:	83 c4 10             	add    $0x10,%esp
+  801e2b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e30:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801e33:	75 09                	jne    801e3e <devpipe_write+0x2a>
+	return i;
+  801e35:	89 f8                	mov    %edi,%eax
+  801e37:	eb 23                	jmp    801e5c <devpipe_write+0x48>
+			sys_yield();
+  801e39:	e8 51 ed ff ff       	call   800b8f <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801e3e:	8b 43 04             	mov    0x4(%ebx),%eax
+  801e41:	8b 0b                	mov    (%ebx),%ecx
+  801e43:	8d 51 20             	lea    0x20(%ecx),%edx
+  801e46:	39 d0                	cmp    %edx,%eax
+  801e48:	72 1a                	jb     801e64 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  801e4a:	89 da                	mov    %ebx,%edx
+  801e4c:	89 f0                	mov    %esi,%eax
+  801e4e:	e8 5c ff ff ff       	call   801daf <_pipeisclosed>
+  801e53:	85 c0                	test   %eax,%eax
+  801e55:	74 e2                	je     801e39 <devpipe_write+0x25>
+				return 0;
+  801e57:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e5c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e5f:	5b                   	pop    %ebx
+  801e60:	5e                   	pop    %esi
+  801e61:	5f                   	pop    %edi
+  801e62:	5d                   	pop    %ebp
+  801e63:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801e64:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e67:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801e6b:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801e6e:	89 c2                	mov    %eax,%edx
+  801e70:	c1 fa 1f             	sar    $0x1f,%edx
+  801e73:	89 d1                	mov    %edx,%ecx
+  801e75:	c1 e9 1b             	shr    $0x1b,%ecx
+  801e78:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801e7b:	83 e2 1f             	and    $0x1f,%edx
+  801e7e:	29 ca                	sub    %ecx,%edx
+  801e80:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801e84:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  801e88:	83 c0 01             	add    $0x1,%eax
+  801e8b:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  801e8e:	83 c7 01             	add    $0x1,%edi
+  801e91:	eb 9d                	jmp    801e30 <devpipe_write+0x1c>
+
+00801e93 <devpipe_read>:
+{
+  801e93:	55                   	push   %ebp
+  801e94:	89 e5                	mov    %esp,%ebp
+  801e96:	57                   	push   %edi
+  801e97:	56                   	push   %esi
+  801e98:	53                   	push   %ebx
+  801e99:	83 ec 18             	sub    $0x18,%esp
+  801e9c:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  801e9f:	57                   	push   %edi
+  801ea0:	e8 3b f1 ff ff       	call   800fe0 <fd2data>
+  801ea5:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801ea7:	83 c4 10             	add    $0x10,%esp
+  801eaa:	be 00 00 00 00       	mov    $0x0,%esi
+  801eaf:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801eb2:	75 13                	jne    801ec7 <devpipe_read+0x34>
+	return i;
+  801eb4:	89 f0                	mov    %esi,%eax
+  801eb6:	eb 02                	jmp    801eba <devpipe_read+0x27>
+				return i;
+  801eb8:	89 f0                	mov    %esi,%eax
+}
+  801eba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ebd:	5b                   	pop    %ebx
+  801ebe:	5e                   	pop    %esi
+  801ebf:	5f                   	pop    %edi
+  801ec0:	5d                   	pop    %ebp
+  801ec1:	c3                   	ret
+			sys_yield();
+  801ec2:	e8 c8 ec ff ff       	call   800b8f <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  801ec7:	8b 03                	mov    (%ebx),%eax
+  801ec9:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801ecc:	75 18                	jne    801ee6 <devpipe_read+0x53>
+			if (i > 0)
+  801ece:	85 f6                	test   %esi,%esi
+  801ed0:	75 e6                	jne    801eb8 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  801ed2:	89 da                	mov    %ebx,%edx
+  801ed4:	89 f8                	mov    %edi,%eax
+  801ed6:	e8 d4 fe ff ff       	call   801daf <_pipeisclosed>
+  801edb:	85 c0                	test   %eax,%eax
+  801edd:	74 e3                	je     801ec2 <devpipe_read+0x2f>
+				return 0;
+  801edf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ee4:	eb d4                	jmp    801eba <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801ee6:	99                   	cltd
+  801ee7:	c1 ea 1b             	shr    $0x1b,%edx
+  801eea:	01 d0                	add    %edx,%eax
+  801eec:	83 e0 1f             	and    $0x1f,%eax
+  801eef:	29 d0                	sub    %edx,%eax
+  801ef1:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801ef6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ef9:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  801efc:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  801eff:	83 c6 01             	add    $0x1,%esi
+  801f02:	eb ab                	jmp    801eaf <devpipe_read+0x1c>
+
+00801f04 <pipe>:
+{
+  801f04:	55                   	push   %ebp
+  801f05:	89 e5                	mov    %esp,%ebp
+  801f07:	56                   	push   %esi
+  801f08:	53                   	push   %ebx
+  801f09:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801f0c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f0f:	50                   	push   %eax
+  801f10:	e8 e2 f0 ff ff       	call   800ff7 <fd_alloc>
+  801f15:	89 c3                	mov    %eax,%ebx
+  801f17:	83 c4 10             	add    $0x10,%esp
+  801f1a:	85 c0                	test   %eax,%eax
+  801f1c:	0f 88 23 01 00 00    	js     802045 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801f22:	83 ec 04             	sub    $0x4,%esp
+  801f25:	68 07 04 00 00       	push   $0x407
+  801f2a:	ff 75 f4             	push   -0xc(%ebp)
+  801f2d:	6a 00                	push   $0x0
+  801f2f:	e8 7a ec ff ff       	call   800bae <sys_page_alloc>
+  801f34:	89 c3                	mov    %eax,%ebx
+  801f36:	83 c4 10             	add    $0x10,%esp
+  801f39:	85 c0                	test   %eax,%eax
+  801f3b:	0f 88 04 01 00 00    	js     802045 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801f41:	83 ec 0c             	sub    $0xc,%esp
+  801f44:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801f47:	50                   	push   %eax
+  801f48:	e8 aa f0 ff ff       	call   800ff7 <fd_alloc>
+  801f4d:	89 c3                	mov    %eax,%ebx
+  801f4f:	83 c4 10             	add    $0x10,%esp
+  801f52:	85 c0                	test   %eax,%eax
+  801f54:	0f 88 db 00 00 00    	js     802035 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801f5a:	83 ec 04             	sub    $0x4,%esp
+  801f5d:	68 07 04 00 00       	push   $0x407
+  801f62:	ff 75 f0             	push   -0x10(%ebp)
+  801f65:	6a 00                	push   $0x0
+  801f67:	e8 42 ec ff ff       	call   800bae <sys_page_alloc>
+  801f6c:	89 c3                	mov    %eax,%ebx
+  801f6e:	83 c4 10             	add    $0x10,%esp
+  801f71:	85 c0                	test   %eax,%eax
+  801f73:	0f 88 bc 00 00 00    	js     802035 <pipe+0x131>
+	va = fd2data(fd0);
+  801f79:	83 ec 0c             	sub    $0xc,%esp
+  801f7c:	ff 75 f4             	push   -0xc(%ebp)
+  801f7f:	e8 5c f0 ff ff       	call   800fe0 <fd2data>
+  801f84:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801f86:	83 c4 0c             	add    $0xc,%esp
+  801f89:	68 07 04 00 00       	push   $0x407
+  801f8e:	50                   	push   %eax
+  801f8f:	6a 00                	push   $0x0
+  801f91:	e8 18 ec ff ff       	call   800bae <sys_page_alloc>
+  801f96:	89 c3                	mov    %eax,%ebx
+  801f98:	83 c4 10             	add    $0x10,%esp
+  801f9b:	85 c0                	test   %eax,%eax
+  801f9d:	0f 88 82 00 00 00    	js     802025 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801fa3:	83 ec 0c             	sub    $0xc,%esp
+  801fa6:	ff 75 f0             	push   -0x10(%ebp)
+  801fa9:	e8 32 f0 ff ff       	call   800fe0 <fd2data>
+  801fae:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801fb5:	50                   	push   %eax
+  801fb6:	6a 00                	push   $0x0
+  801fb8:	56                   	push   %esi
+  801fb9:	6a 00                	push   $0x0
+  801fbb:	e8 31 ec ff ff       	call   800bf1 <sys_page_map>
+  801fc0:	89 c3                	mov    %eax,%ebx
+  801fc2:	83 c4 20             	add    $0x20,%esp
+  801fc5:	85 c0                	test   %eax,%eax
+  801fc7:	78 4e                	js     802017 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  801fc9:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  801fce:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801fd1:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  801fd3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801fd6:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  801fdd:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801fe0:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  801fe2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801fe5:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  801fec:	83 ec 0c             	sub    $0xc,%esp
+  801fef:	ff 75 f4             	push   -0xc(%ebp)
+  801ff2:	e8 d9 ef ff ff       	call   800fd0 <fd2num>
+  801ff7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801ffa:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  801ffc:	83 c4 04             	add    $0x4,%esp
+  801fff:	ff 75 f0             	push   -0x10(%ebp)
+  802002:	e8 c9 ef ff ff       	call   800fd0 <fd2num>
+  802007:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80200a:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80200d:	83 c4 10             	add    $0x10,%esp
+  802010:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802015:	eb 2e                	jmp    802045 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802017:	83 ec 08             	sub    $0x8,%esp
+  80201a:	56                   	push   %esi
+  80201b:	6a 00                	push   $0x0
+  80201d:	e8 11 ec ff ff       	call   800c33 <sys_page_unmap>
+  802022:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802025:	83 ec 08             	sub    $0x8,%esp
+  802028:	ff 75 f0             	push   -0x10(%ebp)
+  80202b:	6a 00                	push   $0x0
+  80202d:	e8 01 ec ff ff       	call   800c33 <sys_page_unmap>
+  802032:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802035:	83 ec 08             	sub    $0x8,%esp
+  802038:	ff 75 f4             	push   -0xc(%ebp)
+  80203b:	6a 00                	push   $0x0
+  80203d:	e8 f1 eb ff ff       	call   800c33 <sys_page_unmap>
+  802042:	83 c4 10             	add    $0x10,%esp
+}
+  802045:	89 d8                	mov    %ebx,%eax
+  802047:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80204a:	5b                   	pop    %ebx
+  80204b:	5e                   	pop    %esi
+  80204c:	5d                   	pop    %ebp
+  80204d:	c3                   	ret
+
+0080204e <pipeisclosed>:
+{
+  80204e:	55                   	push   %ebp
+  80204f:	89 e5                	mov    %esp,%ebp
+  802051:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802054:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802057:	50                   	push   %eax
+  802058:	ff 75 08             	push   0x8(%ebp)
+  80205b:	e8 ed ef ff ff       	call   80104d <fd_lookup>
+  802060:	83 c4 10             	add    $0x10,%esp
+  802063:	85 c0                	test   %eax,%eax
+  802065:	78 18                	js     80207f <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802067:	83 ec 0c             	sub    $0xc,%esp
+  80206a:	ff 75 f4             	push   -0xc(%ebp)
+  80206d:	e8 6e ef ff ff       	call   800fe0 <fd2data>
+  802072:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802074:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802077:	e8 33 fd ff ff       	call   801daf <_pipeisclosed>
+  80207c:	83 c4 10             	add    $0x10,%esp
+}
+  80207f:	c9                   	leave
+  802080:	c3                   	ret
+
+00802081 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802081:	b8 00 00 00 00       	mov    $0x0,%eax
+  802086:	c3                   	ret
+
+00802087 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802087:	55                   	push   %ebp
+  802088:	89 e5                	mov    %esp,%ebp
+  80208a:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80208d:	68 ab 2c 80 00       	push   $0x802cab
+  802092:	ff 75 0c             	push   0xc(%ebp)
+  802095:	e8 28 e7 ff ff       	call   8007c2 <strcpy>
+	return 0;
+}
+  80209a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80209f:	c9                   	leave
+  8020a0:	c3                   	ret
+
+008020a1 <devcons_write>:
+{
+  8020a1:	55                   	push   %ebp
+  8020a2:	89 e5                	mov    %esp,%ebp
+  8020a4:	57                   	push   %edi
+  8020a5:	56                   	push   %esi
+  8020a6:	53                   	push   %ebx
+  8020a7:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8020ad:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8020b2:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8020b8:	eb 2e                	jmp    8020e8 <devcons_write+0x47>
+		m = n - tot;
+  8020ba:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8020bd:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8020bf:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8020c4:	39 c3                	cmp    %eax,%ebx
+  8020c6:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8020c9:	83 ec 04             	sub    $0x4,%esp
+  8020cc:	53                   	push   %ebx
+  8020cd:	89 f0                	mov    %esi,%eax
+  8020cf:	03 45 0c             	add    0xc(%ebp),%eax
+  8020d2:	50                   	push   %eax
+  8020d3:	57                   	push   %edi
+  8020d4:	e8 6f e8 ff ff       	call   800948 <memmove>
+		sys_cputs(buf, m);
+  8020d9:	83 c4 08             	add    $0x8,%esp
+  8020dc:	53                   	push   %ebx
+  8020dd:	57                   	push   %edi
+  8020de:	e8 0f ea ff ff       	call   800af2 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8020e3:	01 de                	add    %ebx,%esi
+  8020e5:	83 c4 10             	add    $0x10,%esp
+  8020e8:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8020eb:	72 cd                	jb     8020ba <devcons_write+0x19>
+}
+  8020ed:	89 f0                	mov    %esi,%eax
+  8020ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020f2:	5b                   	pop    %ebx
+  8020f3:	5e                   	pop    %esi
+  8020f4:	5f                   	pop    %edi
+  8020f5:	5d                   	pop    %ebp
+  8020f6:	c3                   	ret
+
+008020f7 <devcons_read>:
+{
+  8020f7:	55                   	push   %ebp
+  8020f8:	89 e5                	mov    %esp,%ebp
+  8020fa:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8020fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802102:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802106:	75 07                	jne    80210f <devcons_read+0x18>
+  802108:	eb 1f                	jmp    802129 <devcons_read+0x32>
+		sys_yield();
+  80210a:	e8 80 ea ff ff       	call   800b8f <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80210f:	e8 fc e9 ff ff       	call   800b10 <sys_cgetc>
+  802114:	85 c0                	test   %eax,%eax
+  802116:	74 f2                	je     80210a <devcons_read+0x13>
+	if (c < 0)
+  802118:	78 0f                	js     802129 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80211a:	83 f8 04             	cmp    $0x4,%eax
+  80211d:	74 0c                	je     80212b <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80211f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802122:	88 02                	mov    %al,(%edx)
+	return 1;
+  802124:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802129:	c9                   	leave
+  80212a:	c3                   	ret
+		return 0;
+  80212b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802130:	eb f7                	jmp    802129 <devcons_read+0x32>
+
+00802132 <cputchar>:
+{
+  802132:	55                   	push   %ebp
+  802133:	89 e5                	mov    %esp,%ebp
+  802135:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802138:	8b 45 08             	mov    0x8(%ebp),%eax
+  80213b:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80213e:	6a 01                	push   $0x1
+  802140:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802143:	50                   	push   %eax
+  802144:	e8 a9 e9 ff ff       	call   800af2 <sys_cputs>
+}
+  802149:	83 c4 10             	add    $0x10,%esp
+  80214c:	c9                   	leave
+  80214d:	c3                   	ret
+
+0080214e <getchar>:
+{
+  80214e:	55                   	push   %ebp
+  80214f:	89 e5                	mov    %esp,%ebp
+  802151:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802154:	6a 01                	push   $0x1
+  802156:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802159:	50                   	push   %eax
+  80215a:	6a 00                	push   $0x0
+  80215c:	e8 52 f1 ff ff       	call   8012b3 <read>
+	if (r < 0)
+  802161:	83 c4 10             	add    $0x10,%esp
+  802164:	85 c0                	test   %eax,%eax
+  802166:	78 06                	js     80216e <getchar+0x20>
+	if (r < 1)
+  802168:	74 06                	je     802170 <getchar+0x22>
+	return c;
+  80216a:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80216e:	c9                   	leave
+  80216f:	c3                   	ret
+		return -E_EOF;
+  802170:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802175:	eb f7                	jmp    80216e <getchar+0x20>
+
+00802177 <iscons>:
+{
+  802177:	55                   	push   %ebp
+  802178:	89 e5                	mov    %esp,%ebp
+  80217a:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80217d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802180:	50                   	push   %eax
+  802181:	ff 75 08             	push   0x8(%ebp)
+  802184:	e8 c4 ee ff ff       	call   80104d <fd_lookup>
+  802189:	83 c4 10             	add    $0x10,%esp
+  80218c:	85 c0                	test   %eax,%eax
+  80218e:	78 11                	js     8021a1 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802190:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802193:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  802199:	39 10                	cmp    %edx,(%eax)
+  80219b:	0f 94 c0             	sete   %al
+  80219e:	0f b6 c0             	movzbl %al,%eax
+}
+  8021a1:	c9                   	leave
+  8021a2:	c3                   	ret
+
+008021a3 <opencons>:
+{
+  8021a3:	55                   	push   %ebp
+  8021a4:	89 e5                	mov    %esp,%ebp
+  8021a6:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8021a9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021ac:	50                   	push   %eax
+  8021ad:	e8 45 ee ff ff       	call   800ff7 <fd_alloc>
+  8021b2:	83 c4 10             	add    $0x10,%esp
+  8021b5:	85 c0                	test   %eax,%eax
+  8021b7:	78 3a                	js     8021f3 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8021b9:	83 ec 04             	sub    $0x4,%esp
+  8021bc:	68 07 04 00 00       	push   $0x407
+  8021c1:	ff 75 f4             	push   -0xc(%ebp)
+  8021c4:	6a 00                	push   $0x0
+  8021c6:	e8 e3 e9 ff ff       	call   800bae <sys_page_alloc>
+  8021cb:	83 c4 10             	add    $0x10,%esp
+  8021ce:	85 c0                	test   %eax,%eax
+  8021d0:	78 21                	js     8021f3 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8021d2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021d5:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  8021db:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8021dd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021e0:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8021e7:	83 ec 0c             	sub    $0xc,%esp
+  8021ea:	50                   	push   %eax
+  8021eb:	e8 e0 ed ff ff       	call   800fd0 <fd2num>
+  8021f0:	83 c4 10             	add    $0x10,%esp
+}
+  8021f3:	c9                   	leave
+  8021f4:	c3                   	ret
+
+008021f5 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8021f5:	55                   	push   %ebp
+  8021f6:	89 e5                	mov    %esp,%ebp
+  8021f8:	56                   	push   %esi
+  8021f9:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8021fa:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8021fd:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  802203:	e8 68 e9 ff ff       	call   800b70 <sys_getenvid>
+  802208:	83 ec 0c             	sub    $0xc,%esp
+  80220b:	ff 75 0c             	push   0xc(%ebp)
+  80220e:	ff 75 08             	push   0x8(%ebp)
+  802211:	56                   	push   %esi
+  802212:	50                   	push   %eax
+  802213:	68 b8 2c 80 00       	push   $0x802cb8
+  802218:	e8 ec df ff ff       	call   800209 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80221d:	83 c4 18             	add    $0x18,%esp
+  802220:	53                   	push   %ebx
+  802221:	ff 75 10             	push   0x10(%ebp)
+  802224:	e8 8f df ff ff       	call   8001b8 <vcprintf>
+	cprintf("\n");
+  802229:	c7 04 24 30 28 80 00 	movl   $0x802830,(%esp)
+  802230:	e8 d4 df ff ff       	call   800209 <cprintf>
+  802235:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  802238:	cc                   	int3
+	while (1)
+  802239:	eb fd                	jmp    802238 <_panic+0x43>
+
+0080223b <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  80223b:	55                   	push   %ebp
+  80223c:	89 e5                	mov    %esp,%ebp
+  80223e:	56                   	push   %esi
+  80223f:	53                   	push   %ebx
+  802240:	8b 75 08             	mov    0x8(%ebp),%esi
+  802243:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802246:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  802249:	85 c0                	test   %eax,%eax
+  80224b:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802250:	0f 44 c2             	cmove  %edx,%eax
+  802253:	83 ec 0c             	sub    $0xc,%esp
+  802256:	50                   	push   %eax
+  802257:	e8 02 eb ff ff       	call   800d5e <sys_ipc_recv>
+
+  if (from_env_store)
+  80225c:	83 c4 10             	add    $0x10,%esp
+  80225f:	85 f6                	test   %esi,%esi
+  802261:	74 17                	je     80227a <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  802263:	ba 00 00 00 00       	mov    $0x0,%edx
+  802268:	85 c0                	test   %eax,%eax
+  80226a:	75 0c                	jne    802278 <ipc_recv+0x3d>
+  80226c:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  802272:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  802278:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  80227a:	85 db                	test   %ebx,%ebx
+  80227c:	74 2b                	je     8022a9 <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  80227e:	85 c0                	test   %eax,%eax
+  802280:	74 0d                	je     80228f <ipc_recv+0x54>
+  802282:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  802288:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80228b:	5b                   	pop    %ebx
+  80228c:	5e                   	pop    %esi
+  80228d:	5d                   	pop    %ebp
+  80228e:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  80228f:	a1 08 40 80 00       	mov    0x804008,%eax
+  802294:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80229a:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  80229c:	a1 08 40 80 00       	mov    0x804008,%eax
+  8022a1:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  8022a7:	eb df                	jmp    802288 <ipc_recv+0x4d>
+  8022a9:	85 c0                	test   %eax,%eax
+  8022ab:	75 db                	jne    802288 <ipc_recv+0x4d>
+  8022ad:	eb ed                	jmp    80229c <ipc_recv+0x61>
+
+008022af <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  8022af:	55                   	push   %ebp
+  8022b0:	89 e5                	mov    %esp,%ebp
+  8022b2:	57                   	push   %edi
+  8022b3:	56                   	push   %esi
+  8022b4:	53                   	push   %ebx
+  8022b5:	83 ec 0c             	sub    $0xc,%esp
+  8022b8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8022bb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8022be:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  8022c1:	85 db                	test   %ebx,%ebx
+  8022c3:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8022c8:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  8022cb:	ff 75 14             	push   0x14(%ebp)
+  8022ce:	53                   	push   %ebx
+  8022cf:	56                   	push   %esi
+  8022d0:	57                   	push   %edi
+  8022d1:	e8 65 ea ff ff       	call   800d3b <sys_ipc_try_send>
+  8022d6:	83 c4 10             	add    $0x10,%esp
+  8022d9:	85 c0                	test   %eax,%eax
+  8022db:	74 1e                	je     8022fb <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  8022dd:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8022e0:	75 07                	jne    8022e9 <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  8022e2:	e8 a8 e8 ff ff       	call   800b8f <sys_yield>
+  8022e7:	eb e2                	jmp    8022cb <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  8022e9:	50                   	push   %eax
+  8022ea:	68 db 2c 80 00       	push   $0x802cdb
+  8022ef:	6a 3c                	push   $0x3c
+  8022f1:	68 e8 2c 80 00       	push   $0x802ce8
+  8022f6:	e8 fa fe ff ff       	call   8021f5 <_panic>
+  }
+
+#endif
+}
+  8022fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022fe:	5b                   	pop    %ebx
+  8022ff:	5e                   	pop    %esi
+  802300:	5f                   	pop    %edi
+  802301:	5d                   	pop    %ebp
+  802302:	c3                   	ret
+
+00802303 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  802303:	55                   	push   %ebp
+  802304:	89 e5                	mov    %esp,%ebp
+  802306:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  802309:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  80230e:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802311:	c1 e0 04             	shl    $0x4,%eax
+  802314:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802319:	8b 40 50             	mov    0x50(%eax),%eax
+  80231c:	39 c8                	cmp    %ecx,%eax
+  80231e:	74 12                	je     802332 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  802320:	83 c2 01             	add    $0x1,%edx
+  802323:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802329:	75 e3                	jne    80230e <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  80232b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802330:	eb 0e                	jmp    802340 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  802332:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802335:	c1 e0 04             	shl    $0x4,%eax
+  802338:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80233d:	8b 40 48             	mov    0x48(%eax),%eax
+  802340:	5d                   	pop    %ebp
+  802341:	c3                   	ret
+
+00802342 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802342:	55                   	push   %ebp
+  802343:	89 e5                	mov    %esp,%ebp
+  802345:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802348:	89 c2                	mov    %eax,%edx
+  80234a:	c1 ea 16             	shr    $0x16,%edx
+  80234d:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802354:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802359:	f6 c1 01             	test   $0x1,%cl
+  80235c:	74 1c                	je     80237a <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  80235e:	c1 e8 0c             	shr    $0xc,%eax
+  802361:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802368:	a8 01                	test   $0x1,%al
+  80236a:	74 0e                	je     80237a <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80236c:	c1 e8 0c             	shr    $0xc,%eax
+  80236f:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802376:	ef 
+  802377:	0f b7 d2             	movzwl %dx,%edx
+}
+  80237a:	89 d0                	mov    %edx,%eax
+  80237c:	5d                   	pop    %ebp
+  80237d:	c3                   	ret
+  80237e:	66 90                	xchg   %ax,%ax
+
+00802380 <__udivmoddi4>:
+  802380:	55                   	push   %ebp
+  802381:	57                   	push   %edi
+  802382:	56                   	push   %esi
+  802383:	53                   	push   %ebx
+  802384:	83 ec 24             	sub    $0x24,%esp
+  802387:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80238b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80238f:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  802393:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802397:	8b 54 24 44          	mov    0x44(%esp),%edx
+  80239b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80239f:	8b 44 24 40          	mov    0x40(%esp),%eax
+  8023a3:	89 d3                	mov    %edx,%ebx
+  8023a5:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8023a9:	09 c3                	or     %eax,%ebx
+  8023ab:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8023af:	0f 84 9c 00 00 00    	je     802451 <__udivmoddi4+0xd1>
+  8023b5:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8023bc:	00 
+  8023bd:	31 c0                	xor    %eax,%eax
+  8023bf:	31 d2                	xor    %edx,%edx
+  8023c1:	89 fb                	mov    %edi,%ebx
+  8023c3:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8023ca:	00 
+  8023cb:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8023d0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8023d4:	01 c0                	add    %eax,%eax
+  8023d6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8023dd:	00 
+  8023de:	89 c6                	mov    %eax,%esi
+  8023e0:	89 d7                	mov    %edx,%edi
+  8023e2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8023e6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8023ea:	0f ad d0             	shrd   %cl,%edx,%eax
+  8023ed:	d3 ea                	shr    %cl,%edx
+  8023ef:	f6 c1 20             	test   $0x20,%cl
+  8023f2:	0f 45 c2             	cmovne %edx,%eax
+  8023f5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8023f9:	83 e0 01             	and    $0x1,%eax
+  8023fc:	09 fa                	or     %edi,%edx
+  8023fe:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802402:	89 04 24             	mov    %eax,(%esp)
+  802405:	8b 04 24             	mov    (%esp),%eax
+  802408:	89 d5                	mov    %edx,%ebp
+  80240a:	09 f0                	or     %esi,%eax
+  80240c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802410:	39 f0                	cmp    %esi,%eax
+  802412:	19 fd                	sbb    %edi,%ebp
+  802414:	72 1d                	jb     802433 <__udivmoddi4+0xb3>
+  802416:	29 f0                	sub    %esi,%eax
+  802418:	19 fa                	sbb    %edi,%edx
+  80241a:	89 cf                	mov    %ecx,%edi
+  80241c:	c1 ef 05             	shr    $0x5,%edi
+  80241f:	83 e7 01             	and    $0x1,%edi
+  802422:	89 fe                	mov    %edi,%esi
+  802424:	d3 e7                	shl    %cl,%edi
+  802426:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80242a:	83 f6 01             	xor    $0x1,%esi
+  80242d:	d3 e6                	shl    %cl,%esi
+  80242f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802433:	83 e9 01             	sub    $0x1,%ecx
+  802436:	73 98                	jae    8023d0 <__udivmoddi4+0x50>
+  802438:	85 db                	test   %ebx,%ebx
+  80243a:	74 05                	je     802441 <__udivmoddi4+0xc1>
+  80243c:	89 03                	mov    %eax,(%ebx)
+  80243e:	89 53 04             	mov    %edx,0x4(%ebx)
+  802441:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802445:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802449:	83 c4 24             	add    $0x24,%esp
+  80244c:	5b                   	pop    %ebx
+  80244d:	5e                   	pop    %esi
+  80244e:	5f                   	pop    %edi
+  80244f:	5d                   	pop    %ebp
+  802450:	c3                   	ret
+  802451:	85 ff                	test   %edi,%edi
+  802453:	74 0d                	je     802462 <__udivmoddi4+0xe2>
+  802455:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  80245b:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  802462:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802466:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80246a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80246e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802472:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802476:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80247a:	83 c4 24             	add    $0x24,%esp
+  80247d:	5b                   	pop    %ebx
+  80247e:	5e                   	pop    %esi
+  80247f:	5f                   	pop    %edi
+  802480:	5d                   	pop    %ebp
+  802481:	c3                   	ret
+  802482:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802489:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00802490 <__udivdi3>:
+  802490:	57                   	push   %edi
+  802491:	56                   	push   %esi
+  802492:	53                   	push   %ebx
+  802493:	83 ec 20             	sub    $0x20,%esp
+  802496:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80249a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80249e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8024a2:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8024a6:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8024aa:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8024ae:	89 d1                	mov    %edx,%ecx
+  8024b0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8024b4:	09 c1                	or     %eax,%ecx
+  8024b6:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8024ba:	89 44 24 18          	mov    %eax,0x18(%esp)
+  8024be:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  8024c2:	0f 84 88 00 00 00    	je     802550 <__udivdi3+0xc0>
+  8024c8:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8024cf:	00 
+  8024d0:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8024d5:	31 c0                	xor    %eax,%eax
+  8024d7:	31 d2                	xor    %edx,%edx
+  8024d9:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8024e0:	00 
+  8024e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8024e8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8024ec:	01 c0                	add    %eax,%eax
+  8024ee:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8024f5:	00 
+  8024f6:	89 c6                	mov    %eax,%esi
+  8024f8:	89 d7                	mov    %edx,%edi
+  8024fa:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8024fe:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802502:	0f ad d0             	shrd   %cl,%edx,%eax
+  802505:	d3 ea                	shr    %cl,%edx
+  802507:	f6 c1 20             	test   $0x20,%cl
+  80250a:	0f 45 c2             	cmovne %edx,%eax
+  80250d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802511:	83 e0 01             	and    $0x1,%eax
+  802514:	09 fa                	or     %edi,%edx
+  802516:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80251a:	89 04 24             	mov    %eax,(%esp)
+  80251d:	8b 04 24             	mov    (%esp),%eax
+  802520:	89 d3                	mov    %edx,%ebx
+  802522:	09 f0                	or     %esi,%eax
+  802524:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802528:	39 f0                	cmp    %esi,%eax
+  80252a:	19 fb                	sbb    %edi,%ebx
+  80252c:	72 1d                	jb     80254b <__udivdi3+0xbb>
+  80252e:	29 f0                	sub    %esi,%eax
+  802530:	19 fa                	sbb    %edi,%edx
+  802532:	89 cf                	mov    %ecx,%edi
+  802534:	c1 ef 05             	shr    $0x5,%edi
+  802537:	83 e7 01             	and    $0x1,%edi
+  80253a:	89 fe                	mov    %edi,%esi
+  80253c:	d3 e7                	shl    %cl,%edi
+  80253e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802542:	83 f6 01             	xor    $0x1,%esi
+  802545:	d3 e6                	shl    %cl,%esi
+  802547:	09 74 24 18          	or     %esi,0x18(%esp)
+  80254b:	83 e9 01             	sub    $0x1,%ecx
+  80254e:	73 98                	jae    8024e8 <__udivdi3+0x58>
+  802550:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802554:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802558:	83 c4 20             	add    $0x20,%esp
+  80255b:	5b                   	pop    %ebx
+  80255c:	5e                   	pop    %esi
+  80255d:	5f                   	pop    %edi
+  80255e:	c3                   	ret
+  80255f:	90                   	nop
+
+00802560 <__umoddi3>:
+  802560:	57                   	push   %edi
+  802561:	56                   	push   %esi
+  802562:	53                   	push   %ebx
+  802563:	83 ec 18             	sub    $0x18,%esp
+  802566:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80256a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80256e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802572:	8b 54 24 34          	mov    0x34(%esp),%edx
+  802576:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80257a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80257e:	89 d1                	mov    %edx,%ecx
+  802580:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802584:	09 c1                	or     %eax,%ecx
+  802586:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80258a:	74 5b                	je     8025e7 <__umoddi3+0x87>
+  80258c:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802591:	31 c0                	xor    %eax,%eax
+  802593:	31 d2                	xor    %edx,%edx
+  802595:	8d 76 00             	lea    0x0(%esi),%esi
+  802598:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80259c:	01 c0                	add    %eax,%eax
+  80259e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8025a5:	00 
+  8025a6:	89 c6                	mov    %eax,%esi
+  8025a8:	89 d7                	mov    %edx,%edi
+  8025aa:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8025ae:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8025b2:	0f ad d0             	shrd   %cl,%edx,%eax
+  8025b5:	d3 ea                	shr    %cl,%edx
+  8025b7:	f6 c1 20             	test   $0x20,%cl
+  8025ba:	0f 45 c2             	cmovne %edx,%eax
+  8025bd:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8025c1:	83 e0 01             	and    $0x1,%eax
+  8025c4:	09 fa                	or     %edi,%edx
+  8025c6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8025ca:	89 04 24             	mov    %eax,(%esp)
+  8025cd:	8b 04 24             	mov    (%esp),%eax
+  8025d0:	89 d3                	mov    %edx,%ebx
+  8025d2:	09 f0                	or     %esi,%eax
+  8025d4:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8025d8:	39 f0                	cmp    %esi,%eax
+  8025da:	19 fb                	sbb    %edi,%ebx
+  8025dc:	72 04                	jb     8025e2 <__umoddi3+0x82>
+  8025de:	29 f0                	sub    %esi,%eax
+  8025e0:	19 fa                	sbb    %edi,%edx
+  8025e2:	83 e9 01             	sub    $0x1,%ecx
+  8025e5:	73 b1                	jae    802598 <__umoddi3+0x38>
+  8025e7:	83 c4 18             	add    $0x18,%esp
+  8025ea:	5b                   	pop    %ebx
+  8025eb:	5e                   	pop    %esi
+  8025ec:	5f                   	pop    %edi
+  8025ed:	c3                   	ret
+  8025ee:	66 90                	xchg   %ax,%ax
+
+008025f0 <__divdi3>:
+  8025f0:	55                   	push   %ebp
+  8025f1:	57                   	push   %edi
+  8025f2:	56                   	push   %esi
+  8025f3:	53                   	push   %ebx
+  8025f4:	83 ec 24             	sub    $0x24,%esp
+  8025f7:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  8025fb:	8b 74 24 44          	mov    0x44(%esp),%esi
+  8025ff:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802603:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802607:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  80260b:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  80260f:	85 d2                	test   %edx,%edx
+  802611:	0f 88 e0 00 00 00    	js     8026f7 <__divdi3+0x107>
+  802617:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  80261b:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  80261f:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802623:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802627:	85 f6                	test   %esi,%esi
+  802629:	78 16                	js     802641 <__divdi3+0x51>
+  80262b:	89 f1                	mov    %esi,%ecx
+  80262d:	31 c0                	xor    %eax,%eax
+  80262f:	31 d2                	xor    %edx,%edx
+  802631:	09 d9                	or     %ebx,%ecx
+  802633:	0f 85 f3 00 00 00    	jne    80272c <__divdi3+0x13c>
+  802639:	83 c4 24             	add    $0x24,%esp
+  80263c:	5b                   	pop    %ebx
+  80263d:	5e                   	pop    %esi
+  80263e:	5f                   	pop    %edi
+  80263f:	5d                   	pop    %ebp
+  802640:	c3                   	ret
+  802641:	bf 01 00 00 00       	mov    $0x1,%edi
+  802646:	f7 5c 24 08          	negl   0x8(%esp)
+  80264a:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  80264f:	f7 5c 24 0c          	negl   0xc(%esp)
+  802653:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80265a:	00 
+  80265b:	31 c0                	xor    %eax,%eax
+  80265d:	31 d2                	xor    %edx,%edx
+  80265f:	89 fb                	mov    %edi,%ebx
+  802661:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802668:	00 
+  802669:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80266e:	66 90                	xchg   %ax,%ax
+  802670:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802674:	01 c0                	add    %eax,%eax
+  802676:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80267d:	00 
+  80267e:	89 c6                	mov    %eax,%esi
+  802680:	89 d7                	mov    %edx,%edi
+  802682:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802686:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80268a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80268d:	d3 ea                	shr    %cl,%edx
+  80268f:	f6 c1 20             	test   $0x20,%cl
+  802692:	0f 45 c2             	cmovne %edx,%eax
+  802695:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802699:	83 e0 01             	and    $0x1,%eax
+  80269c:	09 fa                	or     %edi,%edx
+  80269e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8026a2:	89 04 24             	mov    %eax,(%esp)
+  8026a5:	8b 04 24             	mov    (%esp),%eax
+  8026a8:	89 d5                	mov    %edx,%ebp
+  8026aa:	09 f0                	or     %esi,%eax
+  8026ac:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8026b0:	39 f0                	cmp    %esi,%eax
+  8026b2:	19 fd                	sbb    %edi,%ebp
+  8026b4:	72 1d                	jb     8026d3 <__divdi3+0xe3>
+  8026b6:	29 f0                	sub    %esi,%eax
+  8026b8:	19 fa                	sbb    %edi,%edx
+  8026ba:	89 cf                	mov    %ecx,%edi
+  8026bc:	c1 ef 05             	shr    $0x5,%edi
+  8026bf:	83 e7 01             	and    $0x1,%edi
+  8026c2:	89 fe                	mov    %edi,%esi
+  8026c4:	d3 e7                	shl    %cl,%edi
+  8026c6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8026ca:	83 f6 01             	xor    $0x1,%esi
+  8026cd:	d3 e6                	shl    %cl,%esi
+  8026cf:	09 74 24 18          	or     %esi,0x18(%esp)
+  8026d3:	83 e9 01             	sub    $0x1,%ecx
+  8026d6:	73 98                	jae    802670 <__divdi3+0x80>
+  8026d8:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8026dc:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8026e0:	85 db                	test   %ebx,%ebx
+  8026e2:	0f 84 51 ff ff ff    	je     802639 <__divdi3+0x49>
+  8026e8:	f7 d8                	neg    %eax
+  8026ea:	83 d2 00             	adc    $0x0,%edx
+  8026ed:	83 c4 24             	add    $0x24,%esp
+  8026f0:	5b                   	pop    %ebx
+  8026f1:	f7 da                	neg    %edx
+  8026f3:	5e                   	pop    %esi
+  8026f4:	5f                   	pop    %edi
+  8026f5:	5d                   	pop    %ebp
+  8026f6:	c3                   	ret
+  8026f7:	f7 d8                	neg    %eax
+  8026f9:	83 d2 00             	adc    $0x0,%edx
+  8026fc:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802700:	f7 da                	neg    %edx
+  802702:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802706:	85 f6                	test   %esi,%esi
+  802708:	78 1b                	js     802725 <__divdi3+0x135>
+  80270a:	89 f1                	mov    %esi,%ecx
+  80270c:	31 c0                	xor    %eax,%eax
+  80270e:	31 d2                	xor    %edx,%edx
+  802710:	bf 01 00 00 00       	mov    $0x1,%edi
+  802715:	09 d9                	or     %ebx,%ecx
+  802717:	0f 85 36 ff ff ff    	jne    802653 <__divdi3+0x63>
+  80271d:	83 c4 24             	add    $0x24,%esp
+  802720:	5b                   	pop    %ebx
+  802721:	5e                   	pop    %esi
+  802722:	5f                   	pop    %edi
+  802723:	5d                   	pop    %ebp
+  802724:	c3                   	ret
+  802725:	31 ff                	xor    %edi,%edi
+  802727:	e9 1a ff ff ff       	jmp    802646 <__divdi3+0x56>
+  80272c:	31 ff                	xor    %edi,%edi
+  80272e:	e9 20 ff ff ff       	jmp    802653 <__divdi3+0x63>
+  802733:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80273a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00802740 <__moddi3>:
+  802740:	55                   	push   %ebp
+  802741:	57                   	push   %edi
+  802742:	56                   	push   %esi
+  802743:	53                   	push   %ebx
+  802744:	83 ec 1c             	sub    $0x1c,%esp
+  802747:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  80274b:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  80274f:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  802753:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  802757:	89 c8                	mov    %ecx,%eax
+  802759:	89 f2                	mov    %esi,%edx
+  80275b:	89 f3                	mov    %esi,%ebx
+  80275d:	85 ed                	test   %ebp,%ebp
+  80275f:	0f 88 9d 00 00 00    	js     802802 <__moddi3+0xc2>
+  802765:	09 cb                	or     %ecx,%ebx
+  802767:	0f 84 8d 00 00 00    	je     8027fa <__moddi3+0xba>
+  80276d:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802771:	31 db                	xor    %ebx,%ebx
+  802773:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802777:	89 ca                	mov    %ecx,%edx
+  802779:	89 f0                	mov    %esi,%eax
+  80277b:	89 dd                	mov    %ebx,%ebp
+  80277d:	f7 da                	neg    %edx
+  80277f:	83 d0 00             	adc    $0x0,%eax
+  802782:	f7 d8                	neg    %eax
+  802784:	0f 49 f0             	cmovns %eax,%esi
+  802787:	0f 49 ca             	cmovns %edx,%ecx
+  80278a:	31 c0                	xor    %eax,%eax
+  80278c:	31 d2                	xor    %edx,%edx
+  80278e:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802792:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802796:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80279b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80279f:	90                   	nop
+  8027a0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8027a4:	01 c0                	add    %eax,%eax
+  8027a6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8027ad:	00 
+  8027ae:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  8027b2:	89 c6                	mov    %eax,%esi
+  8027b4:	89 d7                	mov    %edx,%edi
+  8027b6:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8027ba:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8027be:	0f ad d0             	shrd   %cl,%edx,%eax
+  8027c1:	d3 ea                	shr    %cl,%edx
+  8027c3:	f6 c1 20             	test   $0x20,%cl
+  8027c6:	0f 45 c2             	cmovne %edx,%eax
+  8027c9:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8027cd:	83 e0 01             	and    $0x1,%eax
+  8027d0:	09 fa                	or     %edi,%edx
+  8027d2:	89 04 24             	mov    %eax,(%esp)
+  8027d5:	8b 04 24             	mov    (%esp),%eax
+  8027d8:	89 d7                	mov    %edx,%edi
+  8027da:	09 f0                	or     %esi,%eax
+  8027dc:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  8027e0:	39 d8                	cmp    %ebx,%eax
+  8027e2:	19 f7                	sbb    %esi,%edi
+  8027e4:	72 04                	jb     8027ea <__moddi3+0xaa>
+  8027e6:	29 d8                	sub    %ebx,%eax
+  8027e8:	19 f2                	sbb    %esi,%edx
+  8027ea:	83 e9 01             	sub    $0x1,%ecx
+  8027ed:	73 b1                	jae    8027a0 <__moddi3+0x60>
+  8027ef:	85 ed                	test   %ebp,%ebp
+  8027f1:	74 07                	je     8027fa <__moddi3+0xba>
+  8027f3:	f7 d8                	neg    %eax
+  8027f5:	83 d2 00             	adc    $0x0,%edx
+  8027f8:	f7 da                	neg    %edx
+  8027fa:	83 c4 1c             	add    $0x1c,%esp
+  8027fd:	5b                   	pop    %ebx
+  8027fe:	5e                   	pop    %esi
+  8027ff:	5f                   	pop    %edi
+  802800:	5d                   	pop    %ebp
+  802801:	c3                   	ret
+  802802:	09 cb                	or     %ecx,%ebx
+  802804:	74 f4                	je     8027fa <__moddi3+0xba>
+  802806:	f7 df                	neg    %edi
+  802808:	bb 01 00 00 00       	mov    $0x1,%ebx
+  80280d:	83 d5 00             	adc    $0x0,%ebp
+  802810:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802814:	f7 dd                	neg    %ebp
+  802816:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  80281a:	e9 58 ff ff ff       	jmp    802777 <__moddi3+0x37>
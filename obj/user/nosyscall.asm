@@ -0,0 +1,58 @@
+
+obj/user/nosyscall.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+		serial_putc(*p);
+}
+
+void
+_start()
+{
+  800020:	55                   	push   %ebp
+  800021:	89 e5                	mov    %esp,%ebp
+  800023:	57                   	push   %edi
+  800024:	56                   	push   %esi
+  800025:	53                   	push   %ebx
+  800026:	83 ec 04             	sub    $0x4,%esp
+	for (char *p = s; *p; p++)
+  800029:	bf 72 00 80 00       	mov    $0x800072,%edi
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  80002e:	b9 84 00 00 00       	mov    $0x84,%ecx
+	for (char *p = s; *p; p++)
+  800033:	eb 0d                	jmp    800042 <_start+0x22>
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  800035:	ba f8 03 00 00       	mov    $0x3f8,%edx
+  80003a:	0f b6 45 f3          	movzbl -0xd(%ebp),%eax
+  80003e:	ee                   	out    %al,(%dx)
+	for (char *p = s; *p; p++)
+  80003f:	83 c7 01             	add    $0x1,%edi
+  800042:	0f b6 07             	movzbl (%edi),%eax
+  800045:	88 45 f3             	mov    %al,-0xd(%ebp)
+  800048:	84 c0                	test   %al,%al
+  80004a:	74 24                	je     800070 <_start+0x50>
+	for (i = 0;
+  80004c:	bb 00 00 00 00       	mov    $0x0,%ebx
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  800051:	be fd 03 00 00       	mov    $0x3fd,%esi
+  800056:	89 f2                	mov    %esi,%edx
+  800058:	ec                   	in     (%dx),%al
+	     !(inb(COM1 + COM_LSR) & COM_LSR_TXRDY) && i < 12800;
+  800059:	a8 20                	test   $0x20,%al
+  80005b:	75 d8                	jne    800035 <_start+0x15>
+  80005d:	81 fb ff 31 00 00    	cmp    $0x31ff,%ebx
+  800063:	7f d0                	jg     800035 <_start+0x15>
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  800065:	89 ca                	mov    %ecx,%edx
+  800067:	ec                   	in     (%dx),%al
+  800068:	ec                   	in     (%dx),%al
+  800069:	ec                   	in     (%dx),%al
+  80006a:	ec                   	in     (%dx),%al
+	     i++)
+  80006b:	83 c3 01             	add    $0x1,%ebx
+  80006e:	eb e6                	jmp    800056 <_start+0x36>
+	puts("hello, world!\r\n");
+	for (;;);
+  800070:	eb fe                	jmp    800070 <_start+0x50>
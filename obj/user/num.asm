@@ -0,0 +1,5586 @@
+
+obj/user/num.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 4a 01 00 00       	call   80017b <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <num>:
+int bol = 1;
+int line = 0;
+
+void
+num(int f, const char *s)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	83 ec 10             	sub    $0x10,%esp
+  80003b:	8b 75 08             	mov    0x8(%ebp),%esi
+	long n;
+	int r;
+	char c;
+
+	while ((n = read(f, &c, 1)) > 0) {
+  80003e:	8d 5d f7             	lea    -0x9(%ebp),%ebx
+  800041:	eb 1b                	jmp    80005e <num+0x2b>
+		if (bol) {
+			printf("%5d ", ++line);
+			bol = 0;
+		}
+		if ((r = write(1, &c, 1)) != 1)
+  800043:	83 ec 04             	sub    $0x4,%esp
+  800046:	6a 01                	push   $0x1
+  800048:	53                   	push   %ebx
+  800049:	6a 01                	push   $0x1
+  80004b:	e8 92 12 00 00       	call   8012e2 <write>
+  800050:	83 c4 10             	add    $0x10,%esp
+  800053:	83 f8 01             	cmp    $0x1,%eax
+  800056:	75 4c                	jne    8000a4 <num+0x71>
+			panic("write error copying %s: %e", s, r);
+		if (c == '\n')
+  800058:	80 7d f7 0a          	cmpb   $0xa,-0x9(%ebp)
+  80005c:	74 5e                	je     8000bc <num+0x89>
+	while ((n = read(f, &c, 1)) > 0) {
+  80005e:	83 ec 04             	sub    $0x4,%esp
+  800061:	6a 01                	push   $0x1
+  800063:	53                   	push   %ebx
+  800064:	56                   	push   %esi
+  800065:	e8 aa 11 00 00       	call   801214 <read>
+  80006a:	83 c4 10             	add    $0x10,%esp
+  80006d:	85 c0                	test   %eax,%eax
+  80006f:	7e 57                	jle    8000c8 <num+0x95>
+		if (bol) {
+  800071:	83 3d 00 30 80 00 00 	cmpl   $0x0,0x803000
+  800078:	74 c9                	je     800043 <num+0x10>
+			printf("%5d ", ++line);
+  80007a:	a1 00 40 80 00       	mov    0x804000,%eax
+  80007f:	83 c0 01             	add    $0x1,%eax
+  800082:	a3 00 40 80 00       	mov    %eax,0x804000
+  800087:	83 ec 08             	sub    $0x8,%esp
+  80008a:	50                   	push   %eax
+  80008b:	68 40 27 80 00       	push   $0x802740
+  800090:	e8 85 17 00 00       	call   80181a <printf>
+			bol = 0;
+  800095:	c7 05 00 30 80 00 00 	movl   $0x0,0x803000
+  80009c:	00 00 00 
+  80009f:	83 c4 10             	add    $0x10,%esp
+  8000a2:	eb 9f                	jmp    800043 <num+0x10>
+			panic("write error copying %s: %e", s, r);
+  8000a4:	83 ec 0c             	sub    $0xc,%esp
+  8000a7:	50                   	push   %eax
+  8000a8:	ff 75 0c             	push   0xc(%ebp)
+  8000ab:	68 45 27 80 00       	push   $0x802745
+  8000b0:	6a 13                	push   $0x13
+  8000b2:	68 60 27 80 00       	push   $0x802760
+  8000b7:	e8 22 01 00 00       	call   8001de <_panic>
+			bol = 1;
+  8000bc:	c7 05 00 30 80 00 01 	movl   $0x1,0x803000
+  8000c3:	00 00 00 
+  8000c6:	eb 96                	jmp    80005e <num+0x2b>
+	}
+	if (n < 0)
+  8000c8:	78 07                	js     8000d1 <num+0x9e>
+		panic("error reading %s: %e", s, n);
+}
+  8000ca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000cd:	5b                   	pop    %ebx
+  8000ce:	5e                   	pop    %esi
+  8000cf:	5d                   	pop    %ebp
+  8000d0:	c3                   	ret
+		panic("error reading %s: %e", s, n);
+  8000d1:	83 ec 0c             	sub    $0xc,%esp
+  8000d4:	50                   	push   %eax
+  8000d5:	ff 75 0c             	push   0xc(%ebp)
+  8000d8:	68 6b 27 80 00       	push   $0x80276b
+  8000dd:	6a 18                	push   $0x18
+  8000df:	68 60 27 80 00       	push   $0x802760
+  8000e4:	e8 f5 00 00 00       	call   8001de <_panic>
+
+008000e9 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8000e9:	55                   	push   %ebp
+  8000ea:	89 e5                	mov    %esp,%ebp
+  8000ec:	57                   	push   %edi
+  8000ed:	56                   	push   %esi
+  8000ee:	53                   	push   %ebx
+  8000ef:	83 ec 0c             	sub    $0xc,%esp
+	int f, i;
+
+	binaryname = "num";
+  8000f2:	c7 05 04 30 80 00 80 	movl   $0x802780,0x803004
+  8000f9:	27 80 00 
+	if (argc == 1)
+  8000fc:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  800100:	74 0d                	je     80010f <umain+0x26>
+  800102:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800105:	8d 70 04             	lea    0x4(%eax),%esi
+		num(0, "<stdin>");
+	else
+		for (i = 1; i < argc; i++) {
+  800108:	bf 01 00 00 00       	mov    $0x1,%edi
+  80010d:	eb 3b                	jmp    80014a <umain+0x61>
+		num(0, "<stdin>");
+  80010f:	83 ec 08             	sub    $0x8,%esp
+  800112:	68 84 27 80 00       	push   $0x802784
+  800117:	6a 00                	push   $0x0
+  800119:	e8 15 ff ff ff       	call   800033 <num>
+  80011e:	83 c4 10             	add    $0x10,%esp
+			else {
+				num(f, argv[i]);
+				close(f);
+			}
+		}
+	exit();
+  800121:	e8 9e 00 00 00       	call   8001c4 <exit>
+}
+  800126:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800129:	5b                   	pop    %ebx
+  80012a:	5e                   	pop    %esi
+  80012b:	5f                   	pop    %edi
+  80012c:	5d                   	pop    %ebp
+  80012d:	c3                   	ret
+				num(f, argv[i]);
+  80012e:	83 ec 08             	sub    $0x8,%esp
+  800131:	ff 36                	push   (%esi)
+  800133:	50                   	push   %eax
+  800134:	e8 fa fe ff ff       	call   800033 <num>
+				close(f);
+  800139:	89 1c 24             	mov    %ebx,(%esp)
+  80013c:	e8 97 0f 00 00       	call   8010d8 <close>
+		for (i = 1; i < argc; i++) {
+  800141:	83 c7 01             	add    $0x1,%edi
+  800144:	83 c6 04             	add    $0x4,%esi
+  800147:	83 c4 10             	add    $0x10,%esp
+  80014a:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  80014d:	7d d2                	jge    800121 <umain+0x38>
+			f = open(argv[i], O_RDONLY);
+  80014f:	83 ec 08             	sub    $0x8,%esp
+  800152:	6a 00                	push   $0x0
+  800154:	ff 36                	push   (%esi)
+  800156:	e8 1c 15 00 00       	call   801677 <open>
+  80015b:	89 c3                	mov    %eax,%ebx
+			if (f < 0)
+  80015d:	83 c4 10             	add    $0x10,%esp
+  800160:	85 c0                	test   %eax,%eax
+  800162:	79 ca                	jns    80012e <umain+0x45>
+				panic("can't open %s: %e", argv[i], f);
+  800164:	83 ec 0c             	sub    $0xc,%esp
+  800167:	50                   	push   %eax
+  800168:	ff 36                	push   (%esi)
+  80016a:	68 8c 27 80 00       	push   $0x80278c
+  80016f:	6a 27                	push   $0x27
+  800171:	68 60 27 80 00       	push   $0x802760
+  800176:	e8 63 00 00 00       	call   8001de <_panic>
+
+0080017b <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  80017b:	55                   	push   %ebp
+  80017c:	89 e5                	mov    %esp,%ebp
+  80017e:	56                   	push   %esi
+  80017f:	53                   	push   %ebx
+  800180:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800183:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  800186:	e8 95 0a 00 00       	call   800c20 <sys_getenvid>
+  80018b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800190:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800193:	c1 e0 04             	shl    $0x4,%eax
+  800196:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80019b:	a3 0c 40 80 00       	mov    %eax,0x80400c
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8001a0:	85 db                	test   %ebx,%ebx
+  8001a2:	7e 07                	jle    8001ab <libmain+0x30>
+    binaryname = argv[0];
+  8001a4:	8b 06                	mov    (%esi),%eax
+  8001a6:	a3 04 30 80 00       	mov    %eax,0x803004
+
+  // call user main routine
+  umain(argc, argv);
+  8001ab:	83 ec 08             	sub    $0x8,%esp
+  8001ae:	56                   	push   %esi
+  8001af:	53                   	push   %ebx
+  8001b0:	e8 34 ff ff ff       	call   8000e9 <umain>
+
+  // exit gracefully
+  exit();
+  8001b5:	e8 0a 00 00 00       	call   8001c4 <exit>
+}
+  8001ba:	83 c4 10             	add    $0x10,%esp
+  8001bd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8001c0:	5b                   	pop    %ebx
+  8001c1:	5e                   	pop    %esi
+  8001c2:	5d                   	pop    %ebp
+  8001c3:	c3                   	ret
+
+008001c4 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8001c4:	55                   	push   %ebp
+  8001c5:	89 e5                	mov    %esp,%ebp
+  8001c7:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8001ca:	e8 36 0f 00 00       	call   801105 <close_all>
+	sys_env_destroy(0);
+  8001cf:	83 ec 0c             	sub    $0xc,%esp
+  8001d2:	6a 00                	push   $0x0
+  8001d4:	e8 06 0a 00 00       	call   800bdf <sys_env_destroy>
+}
+  8001d9:	83 c4 10             	add    $0x10,%esp
+  8001dc:	c9                   	leave
+  8001dd:	c3                   	ret
+
+008001de <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8001de:	55                   	push   %ebp
+  8001df:	89 e5                	mov    %esp,%ebp
+  8001e1:	56                   	push   %esi
+  8001e2:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8001e3:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8001e6:	8b 35 04 30 80 00    	mov    0x803004,%esi
+  8001ec:	e8 2f 0a 00 00       	call   800c20 <sys_getenvid>
+  8001f1:	83 ec 0c             	sub    $0xc,%esp
+  8001f4:	ff 75 0c             	push   0xc(%ebp)
+  8001f7:	ff 75 08             	push   0x8(%ebp)
+  8001fa:	56                   	push   %esi
+  8001fb:	50                   	push   %eax
+  8001fc:	68 a8 27 80 00       	push   $0x8027a8
+  800201:	e8 b3 00 00 00       	call   8002b9 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800206:	83 c4 18             	add    $0x18,%esp
+  800209:	53                   	push   %ebx
+  80020a:	ff 75 10             	push   0x10(%ebp)
+  80020d:	e8 56 00 00 00       	call   800268 <vcprintf>
+	cprintf("\n");
+  800212:	c7 04 24 04 2c 80 00 	movl   $0x802c04,(%esp)
+  800219:	e8 9b 00 00 00       	call   8002b9 <cprintf>
+  80021e:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800221:	cc                   	int3
+	while (1)
+  800222:	eb fd                	jmp    800221 <_panic+0x43>
+
+00800224 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800224:	55                   	push   %ebp
+  800225:	89 e5                	mov    %esp,%ebp
+  800227:	53                   	push   %ebx
+  800228:	83 ec 04             	sub    $0x4,%esp
+  80022b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80022e:	8b 13                	mov    (%ebx),%edx
+  800230:	8d 42 01             	lea    0x1(%edx),%eax
+  800233:	89 03                	mov    %eax,(%ebx)
+  800235:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800238:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80023c:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800241:	74 09                	je     80024c <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800243:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800247:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80024a:	c9                   	leave
+  80024b:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80024c:	83 ec 08             	sub    $0x8,%esp
+  80024f:	68 ff 00 00 00       	push   $0xff
+  800254:	8d 43 08             	lea    0x8(%ebx),%eax
+  800257:	50                   	push   %eax
+  800258:	e8 45 09 00 00       	call   800ba2 <sys_cputs>
+		b->idx = 0;
+  80025d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800263:	83 c4 10             	add    $0x10,%esp
+  800266:	eb db                	jmp    800243 <putch+0x1f>
+
+00800268 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800268:	55                   	push   %ebp
+  800269:	89 e5                	mov    %esp,%ebp
+  80026b:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800271:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800278:	00 00 00 
+	b.cnt = 0;
+  80027b:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800282:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800285:	ff 75 0c             	push   0xc(%ebp)
+  800288:	ff 75 08             	push   0x8(%ebp)
+  80028b:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800291:	50                   	push   %eax
+  800292:	68 24 02 80 00       	push   $0x800224
+  800297:	e8 14 01 00 00       	call   8003b0 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80029c:	83 c4 08             	add    $0x8,%esp
+  80029f:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8002a5:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8002ab:	50                   	push   %eax
+  8002ac:	e8 f1 08 00 00       	call   800ba2 <sys_cputs>
+
+	return b.cnt;
+}
+  8002b1:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8002b7:	c9                   	leave
+  8002b8:	c3                   	ret
+
+008002b9 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8002b9:	55                   	push   %ebp
+  8002ba:	89 e5                	mov    %esp,%ebp
+  8002bc:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8002bf:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8002c2:	50                   	push   %eax
+  8002c3:	ff 75 08             	push   0x8(%ebp)
+  8002c6:	e8 9d ff ff ff       	call   800268 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8002cb:	c9                   	leave
+  8002cc:	c3                   	ret
+
+008002cd <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8002cd:	55                   	push   %ebp
+  8002ce:	89 e5                	mov    %esp,%ebp
+  8002d0:	57                   	push   %edi
+  8002d1:	56                   	push   %esi
+  8002d2:	53                   	push   %ebx
+  8002d3:	83 ec 1c             	sub    $0x1c,%esp
+  8002d6:	89 c7                	mov    %eax,%edi
+  8002d8:	89 d6                	mov    %edx,%esi
+  8002da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002dd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8002e0:	89 d1                	mov    %edx,%ecx
+  8002e2:	89 c2                	mov    %eax,%edx
+  8002e4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8002e7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8002ea:	8b 45 10             	mov    0x10(%ebp),%eax
+  8002ed:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8002f0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8002f3:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8002fa:	39 c2                	cmp    %eax,%edx
+  8002fc:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8002ff:	72 3e                	jb     80033f <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800301:	83 ec 0c             	sub    $0xc,%esp
+  800304:	ff 75 18             	push   0x18(%ebp)
+  800307:	83 eb 01             	sub    $0x1,%ebx
+  80030a:	53                   	push   %ebx
+  80030b:	50                   	push   %eax
+  80030c:	83 ec 08             	sub    $0x8,%esp
+  80030f:	ff 75 e4             	push   -0x1c(%ebp)
+  800312:	ff 75 e0             	push   -0x20(%ebp)
+  800315:	ff 75 dc             	push   -0x24(%ebp)
+  800318:	ff 75 d8             	push   -0x28(%ebp)
+  80031b:	e8 90 20 00 00       	call   8023b0 <__udivdi3>
+  800320:	83 c4 18             	add    $0x18,%esp
+  800323:	52                   	push   %edx
+  800324:	50                   	push   %eax
+  800325:	89 f2                	mov    %esi,%edx
+  800327:	89 f8                	mov    %edi,%eax
+  800329:	e8 9f ff ff ff       	call   8002cd <printnum>
+  80032e:	83 c4 20             	add    $0x20,%esp
+  800331:	eb 13                	jmp    800346 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800333:	83 ec 08             	sub    $0x8,%esp
+  800336:	56                   	push   %esi
+  800337:	ff 75 18             	push   0x18(%ebp)
+  80033a:	ff d7                	call   *%edi
+  80033c:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80033f:	83 eb 01             	sub    $0x1,%ebx
+  800342:	85 db                	test   %ebx,%ebx
+  800344:	7f ed                	jg     800333 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800346:	83 ec 08             	sub    $0x8,%esp
+  800349:	56                   	push   %esi
+  80034a:	83 ec 04             	sub    $0x4,%esp
+  80034d:	ff 75 e4             	push   -0x1c(%ebp)
+  800350:	ff 75 e0             	push   -0x20(%ebp)
+  800353:	ff 75 dc             	push   -0x24(%ebp)
+  800356:	ff 75 d8             	push   -0x28(%ebp)
+  800359:	e8 22 21 00 00       	call   802480 <__umoddi3>
+  80035e:	83 c4 14             	add    $0x14,%esp
+  800361:	0f be 80 cb 27 80 00 	movsbl 0x8027cb(%eax),%eax
+  800368:	50                   	push   %eax
+  800369:	ff d7                	call   *%edi
+}
+  80036b:	83 c4 10             	add    $0x10,%esp
+  80036e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800371:	5b                   	pop    %ebx
+  800372:	5e                   	pop    %esi
+  800373:	5f                   	pop    %edi
+  800374:	5d                   	pop    %ebp
+  800375:	c3                   	ret
+
+00800376 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800376:	55                   	push   %ebp
+  800377:	89 e5                	mov    %esp,%ebp
+  800379:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80037c:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800380:	8b 10                	mov    (%eax),%edx
+  800382:	3b 50 04             	cmp    0x4(%eax),%edx
+  800385:	73 0a                	jae    800391 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800387:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80038a:	89 08                	mov    %ecx,(%eax)
+  80038c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80038f:	88 02                	mov    %al,(%edx)
+}
+  800391:	5d                   	pop    %ebp
+  800392:	c3                   	ret
+
+00800393 <printfmt>:
+{
+  800393:	55                   	push   %ebp
+  800394:	89 e5                	mov    %esp,%ebp
+  800396:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800399:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80039c:	50                   	push   %eax
+  80039d:	ff 75 10             	push   0x10(%ebp)
+  8003a0:	ff 75 0c             	push   0xc(%ebp)
+  8003a3:	ff 75 08             	push   0x8(%ebp)
+  8003a6:	e8 05 00 00 00       	call   8003b0 <vprintfmt>
+}
+  8003ab:	83 c4 10             	add    $0x10,%esp
+  8003ae:	c9                   	leave
+  8003af:	c3                   	ret
+
+008003b0 <vprintfmt>:
+{
+  8003b0:	55                   	push   %ebp
+  8003b1:	89 e5                	mov    %esp,%ebp
+  8003b3:	57                   	push   %edi
+  8003b4:	56                   	push   %esi
+  8003b5:	53                   	push   %ebx
+  8003b6:	83 ec 2c             	sub    $0x2c,%esp
+  8003b9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8003bc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8003bf:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8003c2:	eb 0a                	jmp    8003ce <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8003c4:	83 ec 08             	sub    $0x8,%esp
+  8003c7:	53                   	push   %ebx
+  8003c8:	50                   	push   %eax
+  8003c9:	ff d6                	call   *%esi
+  8003cb:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8003ce:	83 c7 01             	add    $0x1,%edi
+  8003d1:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8003d5:	83 f8 25             	cmp    $0x25,%eax
+  8003d8:	74 0c                	je     8003e6 <vprintfmt+0x36>
+			if (ch == '\0')
+  8003da:	85 c0                	test   %eax,%eax
+  8003dc:	75 e6                	jne    8003c4 <vprintfmt+0x14>
+}
+  8003de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003e1:	5b                   	pop    %ebx
+  8003e2:	5e                   	pop    %esi
+  8003e3:	5f                   	pop    %edi
+  8003e4:	5d                   	pop    %ebp
+  8003e5:	c3                   	ret
+		padc = ' ';
+  8003e6:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8003ea:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8003f1:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8003f8:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8003ff:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800404:	8d 47 01             	lea    0x1(%edi),%eax
+  800407:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80040a:	0f b6 17             	movzbl (%edi),%edx
+  80040d:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800410:	3c 55                	cmp    $0x55,%al
+  800412:	0f 87 9a 03 00 00    	ja     8007b2 <vprintfmt+0x402>
+  800418:	0f b6 c0             	movzbl %al,%eax
+  80041b:	ff 24 85 00 29 80 00 	jmp    *0x802900(,%eax,4)
+  800422:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800425:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800429:	eb d9                	jmp    800404 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80042b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80042e:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800432:	eb d0                	jmp    800404 <vprintfmt+0x54>
+  800434:	0f b6 d2             	movzbl %dl,%edx
+  800437:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80043a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80043f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800442:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800445:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800449:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80044c:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80044f:	83 f9 09             	cmp    $0x9,%ecx
+  800452:	77 55                	ja     8004a9 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800454:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800457:	eb e9                	jmp    800442 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800459:	8b 45 14             	mov    0x14(%ebp),%eax
+  80045c:	8b 00                	mov    (%eax),%eax
+  80045e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800461:	8b 45 14             	mov    0x14(%ebp),%eax
+  800464:	8d 40 04             	lea    0x4(%eax),%eax
+  800467:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80046a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80046d:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800471:	79 91                	jns    800404 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800473:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800476:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800479:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800480:	eb 82                	jmp    800404 <vprintfmt+0x54>
+			if (width < 0)
+  800482:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800485:	85 d2                	test   %edx,%edx
+  800487:	b8 00 00 00 00       	mov    $0x0,%eax
+  80048c:	0f 49 c2             	cmovns %edx,%eax
+  80048f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800492:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800495:	e9 6a ff ff ff       	jmp    800404 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80049a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80049d:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8004a4:	e9 5b ff ff ff       	jmp    800404 <vprintfmt+0x54>
+  8004a9:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8004ac:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004af:	eb bc                	jmp    80046d <vprintfmt+0xbd>
+			lflag++;
+  8004b1:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8004b4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8004b7:	e9 48 ff ff ff       	jmp    800404 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8004bc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004bf:	8d 78 04             	lea    0x4(%eax),%edi
+  8004c2:	83 ec 08             	sub    $0x8,%esp
+  8004c5:	53                   	push   %ebx
+  8004c6:	ff 30                	push   (%eax)
+  8004c8:	ff d6                	call   *%esi
+			break;
+  8004ca:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8004cd:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8004d0:	e9 7c 02 00 00       	jmp    800751 <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  8004d5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004d8:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8004db:	8b 10                	mov    (%eax),%edx
+  8004dd:	89 d0                	mov    %edx,%eax
+  8004df:	f7 d8                	neg    %eax
+  8004e1:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8004e4:	83 f8 10             	cmp    $0x10,%eax
+  8004e7:	7f 23                	jg     80050c <vprintfmt+0x15c>
+  8004e9:	8b 14 85 60 2a 80 00 	mov    0x802a60(,%eax,4),%edx
+  8004f0:	85 d2                	test   %edx,%edx
+  8004f2:	74 18                	je     80050c <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8004f4:	52                   	push   %edx
+  8004f5:	68 99 2b 80 00       	push   $0x802b99
+  8004fa:	53                   	push   %ebx
+  8004fb:	56                   	push   %esi
+  8004fc:	e8 92 fe ff ff       	call   800393 <printfmt>
+  800501:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800504:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800507:	e9 45 02 00 00       	jmp    800751 <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  80050c:	50                   	push   %eax
+  80050d:	68 e3 27 80 00       	push   $0x8027e3
+  800512:	53                   	push   %ebx
+  800513:	56                   	push   %esi
+  800514:	e8 7a fe ff ff       	call   800393 <printfmt>
+  800519:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80051c:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80051f:	e9 2d 02 00 00       	jmp    800751 <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800524:	8b 45 14             	mov    0x14(%ebp),%eax
+  800527:	83 c0 04             	add    $0x4,%eax
+  80052a:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80052d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800530:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800532:	85 c9                	test   %ecx,%ecx
+  800534:	b8 dc 27 80 00       	mov    $0x8027dc,%eax
+  800539:	0f 45 c1             	cmovne %ecx,%eax
+  80053c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80053f:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800543:	7e 06                	jle    80054b <vprintfmt+0x19b>
+  800545:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800549:	75 0b                	jne    800556 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80054b:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80054e:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800551:	89 75 08             	mov    %esi,0x8(%ebp)
+  800554:	eb 5c                	jmp    8005b2 <vprintfmt+0x202>
+  800556:	83 ec 08             	sub    $0x8,%esp
+  800559:	ff 75 d0             	push   -0x30(%ebp)
+  80055c:	ff 75 cc             	push   -0x34(%ebp)
+  80055f:	e8 eb 02 00 00       	call   80084f <strnlen>
+  800564:	89 c2                	mov    %eax,%edx
+  800566:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800569:	29 d0                	sub    %edx,%eax
+  80056b:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80056e:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800572:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800575:	89 75 08             	mov    %esi,0x8(%ebp)
+  800578:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80057a:	eb 0e                	jmp    80058a <vprintfmt+0x1da>
+					putch(padc, putdat);
+  80057c:	83 ec 08             	sub    $0x8,%esp
+  80057f:	53                   	push   %ebx
+  800580:	57                   	push   %edi
+  800581:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800584:	83 ee 01             	sub    $0x1,%esi
+  800587:	83 c4 10             	add    $0x10,%esp
+  80058a:	85 f6                	test   %esi,%esi
+  80058c:	7f ee                	jg     80057c <vprintfmt+0x1cc>
+  80058e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800591:	8b 75 08             	mov    0x8(%ebp),%esi
+  800594:	85 c0                	test   %eax,%eax
+  800596:	ba 00 00 00 00       	mov    $0x0,%edx
+  80059b:	0f 49 d0             	cmovns %eax,%edx
+  80059e:	29 d0                	sub    %edx,%eax
+  8005a0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005a3:	eb a6                	jmp    80054b <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8005a5:	83 ec 08             	sub    $0x8,%esp
+  8005a8:	53                   	push   %ebx
+  8005a9:	52                   	push   %edx
+  8005aa:	ff 55 08             	call   *0x8(%ebp)
+  8005ad:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005b0:	89 f1                	mov    %esi,%ecx
+  8005b2:	8d 71 01             	lea    0x1(%ecx),%esi
+  8005b5:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8005b9:	0f be d0             	movsbl %al,%edx
+  8005bc:	85 d2                	test   %edx,%edx
+  8005be:	74 28                	je     8005e8 <vprintfmt+0x238>
+  8005c0:	85 ff                	test   %edi,%edi
+  8005c2:	78 05                	js     8005c9 <vprintfmt+0x219>
+  8005c4:	83 ef 01             	sub    $0x1,%edi
+  8005c7:	78 30                	js     8005f9 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8005c9:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8005cd:	74 d6                	je     8005a5 <vprintfmt+0x1f5>
+  8005cf:	0f be c0             	movsbl %al,%eax
+  8005d2:	83 e8 20             	sub    $0x20,%eax
+  8005d5:	83 f8 5e             	cmp    $0x5e,%eax
+  8005d8:	76 cb                	jbe    8005a5 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8005da:	83 ec 08             	sub    $0x8,%esp
+  8005dd:	53                   	push   %ebx
+  8005de:	6a 3f                	push   $0x3f
+  8005e0:	ff 55 08             	call   *0x8(%ebp)
+  8005e3:	83 c4 10             	add    $0x10,%esp
+  8005e6:	eb c8                	jmp    8005b0 <vprintfmt+0x200>
+  8005e8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005eb:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005ee:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8005f1:	01 d0                	add    %edx,%eax
+  8005f3:	29 c8                	sub    %ecx,%eax
+  8005f5:	89 c7                	mov    %eax,%edi
+  8005f7:	eb 13                	jmp    80060c <vprintfmt+0x25c>
+  8005f9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005fc:	eb ed                	jmp    8005eb <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8005fe:	83 ec 08             	sub    $0x8,%esp
+  800601:	53                   	push   %ebx
+  800602:	6a 20                	push   $0x20
+  800604:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800606:	83 ef 01             	sub    $0x1,%edi
+  800609:	83 c4 10             	add    $0x10,%esp
+  80060c:	85 ff                	test   %edi,%edi
+  80060e:	7f ee                	jg     8005fe <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800610:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800613:	89 45 14             	mov    %eax,0x14(%ebp)
+  800616:	e9 36 01 00 00       	jmp    800751 <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  80061b:	83 f9 01             	cmp    $0x1,%ecx
+  80061e:	7f 1f                	jg     80063f <vprintfmt+0x28f>
+	else if (lflag)
+  800620:	85 c9                	test   %ecx,%ecx
+  800622:	74 67                	je     80068b <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800624:	8b 45 14             	mov    0x14(%ebp),%eax
+  800627:	8b 00                	mov    (%eax),%eax
+  800629:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80062c:	89 c1                	mov    %eax,%ecx
+  80062e:	c1 f9 1f             	sar    $0x1f,%ecx
+  800631:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800634:	8b 45 14             	mov    0x14(%ebp),%eax
+  800637:	8d 40 04             	lea    0x4(%eax),%eax
+  80063a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80063d:	eb 17                	jmp    800656 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  80063f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800642:	8b 50 04             	mov    0x4(%eax),%edx
+  800645:	8b 00                	mov    (%eax),%eax
+  800647:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80064a:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80064d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800650:	8d 40 08             	lea    0x8(%eax),%eax
+  800653:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800656:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800659:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80065c:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800661:	85 c9                	test   %ecx,%ecx
+  800663:	0f 89 ce 00 00 00    	jns    800737 <vprintfmt+0x387>
+				putch('-', putdat);
+  800669:	83 ec 08             	sub    $0x8,%esp
+  80066c:	53                   	push   %ebx
+  80066d:	6a 2d                	push   $0x2d
+  80066f:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800671:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800674:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800677:	f7 da                	neg    %edx
+  800679:	83 d1 00             	adc    $0x0,%ecx
+  80067c:	f7 d9                	neg    %ecx
+  80067e:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800681:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800686:	e9 ac 00 00 00       	jmp    800737 <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  80068b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068e:	8b 00                	mov    (%eax),%eax
+  800690:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800693:	89 c1                	mov    %eax,%ecx
+  800695:	c1 f9 1f             	sar    $0x1f,%ecx
+  800698:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80069b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069e:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006a4:	eb b0                	jmp    800656 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8006a6:	83 f9 01             	cmp    $0x1,%ecx
+  8006a9:	7f 1b                	jg     8006c6 <vprintfmt+0x316>
+	else if (lflag)
+  8006ab:	85 c9                	test   %ecx,%ecx
+  8006ad:	74 2c                	je     8006db <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  8006af:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b2:	8b 10                	mov    (%eax),%edx
+  8006b4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006b9:	8d 40 04             	lea    0x4(%eax),%eax
+  8006bc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006bf:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8006c4:	eb 71                	jmp    800737 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  8006c6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c9:	8b 10                	mov    (%eax),%edx
+  8006cb:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006ce:	8d 40 08             	lea    0x8(%eax),%eax
+  8006d1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006d4:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8006d9:	eb 5c                	jmp    800737 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  8006db:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006de:	8b 10                	mov    (%eax),%edx
+  8006e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006e5:	8d 40 04             	lea    0x4(%eax),%eax
+  8006e8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006eb:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8006f0:	eb 45                	jmp    800737 <vprintfmt+0x387>
+			putch('X', putdat);
+  8006f2:	83 ec 08             	sub    $0x8,%esp
+  8006f5:	53                   	push   %ebx
+  8006f6:	6a 58                	push   $0x58
+  8006f8:	ff d6                	call   *%esi
+			putch('X', putdat);
+  8006fa:	83 c4 08             	add    $0x8,%esp
+  8006fd:	53                   	push   %ebx
+  8006fe:	6a 58                	push   $0x58
+  800700:	ff d6                	call   *%esi
+			putch('X', putdat);
+  800702:	83 c4 08             	add    $0x8,%esp
+  800705:	53                   	push   %ebx
+  800706:	6a 58                	push   $0x58
+  800708:	ff d6                	call   *%esi
+			break;
+  80070a:	83 c4 10             	add    $0x10,%esp
+  80070d:	eb 42                	jmp    800751 <vprintfmt+0x3a1>
+			putch('0', putdat);
+  80070f:	83 ec 08             	sub    $0x8,%esp
+  800712:	53                   	push   %ebx
+  800713:	6a 30                	push   $0x30
+  800715:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800717:	83 c4 08             	add    $0x8,%esp
+  80071a:	53                   	push   %ebx
+  80071b:	6a 78                	push   $0x78
+  80071d:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  80071f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800722:	8b 10                	mov    (%eax),%edx
+  800724:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800729:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80072c:	8d 40 04             	lea    0x4(%eax),%eax
+  80072f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800732:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800737:	83 ec 0c             	sub    $0xc,%esp
+  80073a:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80073e:	50                   	push   %eax
+  80073f:	ff 75 e0             	push   -0x20(%ebp)
+  800742:	57                   	push   %edi
+  800743:	51                   	push   %ecx
+  800744:	52                   	push   %edx
+  800745:	89 da                	mov    %ebx,%edx
+  800747:	89 f0                	mov    %esi,%eax
+  800749:	e8 7f fb ff ff       	call   8002cd <printnum>
+			break;
+  80074e:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800751:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800754:	e9 75 fc ff ff       	jmp    8003ce <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800759:	83 f9 01             	cmp    $0x1,%ecx
+  80075c:	7f 1b                	jg     800779 <vprintfmt+0x3c9>
+	else if (lflag)
+  80075e:	85 c9                	test   %ecx,%ecx
+  800760:	74 2c                	je     80078e <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  800762:	8b 45 14             	mov    0x14(%ebp),%eax
+  800765:	8b 10                	mov    (%eax),%edx
+  800767:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80076c:	8d 40 04             	lea    0x4(%eax),%eax
+  80076f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800772:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800777:	eb be                	jmp    800737 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  800779:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077c:	8b 10                	mov    (%eax),%edx
+  80077e:	8b 48 04             	mov    0x4(%eax),%ecx
+  800781:	8d 40 08             	lea    0x8(%eax),%eax
+  800784:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800787:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80078c:	eb a9                	jmp    800737 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  80078e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800791:	8b 10                	mov    (%eax),%edx
+  800793:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800798:	8d 40 04             	lea    0x4(%eax),%eax
+  80079b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80079e:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8007a3:	eb 92                	jmp    800737 <vprintfmt+0x387>
+			putch(ch, putdat);
+  8007a5:	83 ec 08             	sub    $0x8,%esp
+  8007a8:	53                   	push   %ebx
+  8007a9:	6a 25                	push   $0x25
+  8007ab:	ff d6                	call   *%esi
+			break;
+  8007ad:	83 c4 10             	add    $0x10,%esp
+  8007b0:	eb 9f                	jmp    800751 <vprintfmt+0x3a1>
+			putch('%', putdat);
+  8007b2:	83 ec 08             	sub    $0x8,%esp
+  8007b5:	53                   	push   %ebx
+  8007b6:	6a 25                	push   $0x25
+  8007b8:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8007ba:	83 c4 10             	add    $0x10,%esp
+  8007bd:	89 f8                	mov    %edi,%eax
+  8007bf:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8007c3:	74 05                	je     8007ca <vprintfmt+0x41a>
+  8007c5:	83 e8 01             	sub    $0x1,%eax
+  8007c8:	eb f5                	jmp    8007bf <vprintfmt+0x40f>
+  8007ca:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8007cd:	eb 82                	jmp    800751 <vprintfmt+0x3a1>
+
+008007cf <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8007cf:	55                   	push   %ebp
+  8007d0:	89 e5                	mov    %esp,%ebp
+  8007d2:	83 ec 18             	sub    $0x18,%esp
+  8007d5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007d8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8007db:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8007de:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8007e2:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8007e5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8007ec:	85 c0                	test   %eax,%eax
+  8007ee:	74 26                	je     800816 <vsnprintf+0x47>
+  8007f0:	85 d2                	test   %edx,%edx
+  8007f2:	7e 22                	jle    800816 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8007f4:	ff 75 14             	push   0x14(%ebp)
+  8007f7:	ff 75 10             	push   0x10(%ebp)
+  8007fa:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8007fd:	50                   	push   %eax
+  8007fe:	68 76 03 80 00       	push   $0x800376
+  800803:	e8 a8 fb ff ff       	call   8003b0 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800808:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80080b:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80080e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800811:	83 c4 10             	add    $0x10,%esp
+}
+  800814:	c9                   	leave
+  800815:	c3                   	ret
+		return -E_INVAL;
+  800816:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80081b:	eb f7                	jmp    800814 <vsnprintf+0x45>
+
+0080081d <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80081d:	55                   	push   %ebp
+  80081e:	89 e5                	mov    %esp,%ebp
+  800820:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800823:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800826:	50                   	push   %eax
+  800827:	ff 75 10             	push   0x10(%ebp)
+  80082a:	ff 75 0c             	push   0xc(%ebp)
+  80082d:	ff 75 08             	push   0x8(%ebp)
+  800830:	e8 9a ff ff ff       	call   8007cf <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800835:	c9                   	leave
+  800836:	c3                   	ret
+
+00800837 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800837:	55                   	push   %ebp
+  800838:	89 e5                	mov    %esp,%ebp
+  80083a:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80083d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800842:	eb 03                	jmp    800847 <strlen+0x10>
+		n++;
+  800844:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800847:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80084b:	75 f7                	jne    800844 <strlen+0xd>
+	return n;
+}
+  80084d:	5d                   	pop    %ebp
+  80084e:	c3                   	ret
+
+0080084f <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80084f:	55                   	push   %ebp
+  800850:	89 e5                	mov    %esp,%ebp
+  800852:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800855:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800858:	b8 00 00 00 00       	mov    $0x0,%eax
+  80085d:	eb 03                	jmp    800862 <strnlen+0x13>
+		n++;
+  80085f:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800862:	39 d0                	cmp    %edx,%eax
+  800864:	74 08                	je     80086e <strnlen+0x1f>
+  800866:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80086a:	75 f3                	jne    80085f <strnlen+0x10>
+  80086c:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80086e:	89 d0                	mov    %edx,%eax
+  800870:	5d                   	pop    %ebp
+  800871:	c3                   	ret
+
+00800872 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800872:	55                   	push   %ebp
+  800873:	89 e5                	mov    %esp,%ebp
+  800875:	53                   	push   %ebx
+  800876:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800879:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80087c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800881:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800885:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800888:	83 c0 01             	add    $0x1,%eax
+  80088b:	84 d2                	test   %dl,%dl
+  80088d:	75 f2                	jne    800881 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80088f:	89 c8                	mov    %ecx,%eax
+  800891:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800894:	c9                   	leave
+  800895:	c3                   	ret
+
+00800896 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800896:	55                   	push   %ebp
+  800897:	89 e5                	mov    %esp,%ebp
+  800899:	53                   	push   %ebx
+  80089a:	83 ec 10             	sub    $0x10,%esp
+  80089d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8008a0:	53                   	push   %ebx
+  8008a1:	e8 91 ff ff ff       	call   800837 <strlen>
+  8008a6:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8008a9:	ff 75 0c             	push   0xc(%ebp)
+  8008ac:	01 d8                	add    %ebx,%eax
+  8008ae:	50                   	push   %eax
+  8008af:	e8 be ff ff ff       	call   800872 <strcpy>
+	return dst;
+}
+  8008b4:	89 d8                	mov    %ebx,%eax
+  8008b6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008b9:	c9                   	leave
+  8008ba:	c3                   	ret
+
+008008bb <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8008bb:	55                   	push   %ebp
+  8008bc:	89 e5                	mov    %esp,%ebp
+  8008be:	56                   	push   %esi
+  8008bf:	53                   	push   %ebx
+  8008c0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008c3:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8008c6:	89 f3                	mov    %esi,%ebx
+  8008c8:	03 5d 10             	add    0x10(%ebp),%ebx
+  8008cb:	89 f0                	mov    %esi,%eax
+  8008cd:	eb 0f                	jmp    8008de <strncpy+0x23>
+		*dst++ = *src;
+  8008cf:	83 c0 01             	add    $0x1,%eax
+  8008d2:	0f b6 0a             	movzbl (%edx),%ecx
+  8008d5:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8008d8:	80 f9 01             	cmp    $0x1,%cl
+  8008db:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8008de:	39 d8                	cmp    %ebx,%eax
+  8008e0:	75 ed                	jne    8008cf <strncpy+0x14>
+	}
+	return ret;
+}
+  8008e2:	89 f0                	mov    %esi,%eax
+  8008e4:	5b                   	pop    %ebx
+  8008e5:	5e                   	pop    %esi
+  8008e6:	5d                   	pop    %ebp
+  8008e7:	c3                   	ret
+
+008008e8 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8008e8:	55                   	push   %ebp
+  8008e9:	89 e5                	mov    %esp,%ebp
+  8008eb:	56                   	push   %esi
+  8008ec:	53                   	push   %ebx
+  8008ed:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008f0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008f3:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8008f6:	89 f0                	mov    %esi,%eax
+  8008f8:	85 d2                	test   %edx,%edx
+  8008fa:	74 21                	je     80091d <strlcpy+0x35>
+  8008fc:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800900:	89 f2                	mov    %esi,%edx
+  800902:	eb 09                	jmp    80090d <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800904:	83 c1 01             	add    $0x1,%ecx
+  800907:	83 c2 01             	add    $0x1,%edx
+  80090a:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80090d:	39 c2                	cmp    %eax,%edx
+  80090f:	74 09                	je     80091a <strlcpy+0x32>
+  800911:	0f b6 19             	movzbl (%ecx),%ebx
+  800914:	84 db                	test   %bl,%bl
+  800916:	75 ec                	jne    800904 <strlcpy+0x1c>
+  800918:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80091a:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80091d:	29 f0                	sub    %esi,%eax
+}
+  80091f:	5b                   	pop    %ebx
+  800920:	5e                   	pop    %esi
+  800921:	5d                   	pop    %ebp
+  800922:	c3                   	ret
+
+00800923 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800923:	55                   	push   %ebp
+  800924:	89 e5                	mov    %esp,%ebp
+  800926:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800929:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80092c:	eb 06                	jmp    800934 <strcmp+0x11>
+		p++, q++;
+  80092e:	83 c1 01             	add    $0x1,%ecx
+  800931:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800934:	0f b6 01             	movzbl (%ecx),%eax
+  800937:	84 c0                	test   %al,%al
+  800939:	74 04                	je     80093f <strcmp+0x1c>
+  80093b:	3a 02                	cmp    (%edx),%al
+  80093d:	74 ef                	je     80092e <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80093f:	0f b6 c0             	movzbl %al,%eax
+  800942:	0f b6 12             	movzbl (%edx),%edx
+  800945:	29 d0                	sub    %edx,%eax
+}
+  800947:	5d                   	pop    %ebp
+  800948:	c3                   	ret
+
+00800949 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800949:	55                   	push   %ebp
+  80094a:	89 e5                	mov    %esp,%ebp
+  80094c:	53                   	push   %ebx
+  80094d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800950:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800953:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800956:	eb 09                	jmp    800961 <strncmp+0x18>
+		n--, p++, q++;
+  800958:	83 ea 01             	sub    $0x1,%edx
+  80095b:	83 c0 01             	add    $0x1,%eax
+  80095e:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800961:	85 d2                	test   %edx,%edx
+  800963:	74 18                	je     80097d <strncmp+0x34>
+  800965:	0f b6 18             	movzbl (%eax),%ebx
+  800968:	84 db                	test   %bl,%bl
+  80096a:	74 04                	je     800970 <strncmp+0x27>
+  80096c:	3a 19                	cmp    (%ecx),%bl
+  80096e:	74 e8                	je     800958 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800970:	0f b6 00             	movzbl (%eax),%eax
+  800973:	0f b6 11             	movzbl (%ecx),%edx
+  800976:	29 d0                	sub    %edx,%eax
+}
+  800978:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80097b:	c9                   	leave
+  80097c:	c3                   	ret
+		return 0;
+  80097d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800982:	eb f4                	jmp    800978 <strncmp+0x2f>
+
+00800984 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800984:	55                   	push   %ebp
+  800985:	89 e5                	mov    %esp,%ebp
+  800987:	8b 45 08             	mov    0x8(%ebp),%eax
+  80098a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80098e:	eb 03                	jmp    800993 <strchr+0xf>
+  800990:	83 c0 01             	add    $0x1,%eax
+  800993:	0f b6 10             	movzbl (%eax),%edx
+  800996:	84 d2                	test   %dl,%dl
+  800998:	74 06                	je     8009a0 <strchr+0x1c>
+		if (*s == c)
+  80099a:	38 ca                	cmp    %cl,%dl
+  80099c:	75 f2                	jne    800990 <strchr+0xc>
+  80099e:	eb 05                	jmp    8009a5 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8009a0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009a5:	5d                   	pop    %ebp
+  8009a6:	c3                   	ret
+
+008009a7 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8009a7:	55                   	push   %ebp
+  8009a8:	89 e5                	mov    %esp,%ebp
+  8009aa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009ad:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009b1:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8009b4:	38 ca                	cmp    %cl,%dl
+  8009b6:	74 09                	je     8009c1 <strfind+0x1a>
+  8009b8:	84 d2                	test   %dl,%dl
+  8009ba:	74 05                	je     8009c1 <strfind+0x1a>
+	for (; *s; s++)
+  8009bc:	83 c0 01             	add    $0x1,%eax
+  8009bf:	eb f0                	jmp    8009b1 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8009c1:	5d                   	pop    %ebp
+  8009c2:	c3                   	ret
+
+008009c3 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8009c3:	55                   	push   %ebp
+  8009c4:	89 e5                	mov    %esp,%ebp
+  8009c6:	57                   	push   %edi
+  8009c7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8009ca:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8009cd:	85 c9                	test   %ecx,%ecx
+  8009cf:	74 20                	je     8009f1 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8009d1:	89 f8                	mov    %edi,%eax
+  8009d3:	09 c8                	or     %ecx,%eax
+  8009d5:	a8 03                	test   $0x3,%al
+  8009d7:	75 12                	jne    8009eb <memset+0x28>
+		c &= 0xFF;
+  8009d9:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8009dd:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8009e3:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8009e6:	fc                   	cld
+  8009e7:	f3 ab                	rep stos %eax,%es:(%edi)
+  8009e9:	eb 06                	jmp    8009f1 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8009eb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8009ee:	fc                   	cld
+  8009ef:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8009f1:	89 f8                	mov    %edi,%eax
+  8009f3:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8009f6:	c9                   	leave
+  8009f7:	c3                   	ret
+
+008009f8 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8009f8:	55                   	push   %ebp
+  8009f9:	89 e5                	mov    %esp,%ebp
+  8009fb:	57                   	push   %edi
+  8009fc:	56                   	push   %esi
+  8009fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a00:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a03:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a06:	39 c6                	cmp    %eax,%esi
+  800a08:	73 32                	jae    800a3c <memmove+0x44>
+  800a0a:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a0d:	39 d0                	cmp    %edx,%eax
+  800a0f:	73 2b                	jae    800a3c <memmove+0x44>
+		s += n;
+		d += n;
+  800a11:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a14:	89 d6                	mov    %edx,%esi
+  800a16:	09 fe                	or     %edi,%esi
+  800a18:	09 ce                	or     %ecx,%esi
+  800a1a:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a20:	75 0e                	jne    800a30 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a22:	83 ef 04             	sub    $0x4,%edi
+  800a25:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a28:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a2b:	fd                   	std
+  800a2c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a2e:	eb 09                	jmp    800a39 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a30:	83 ef 01             	sub    $0x1,%edi
+  800a33:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800a36:	fd                   	std
+  800a37:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a39:	fc                   	cld
+  800a3a:	eb 1a                	jmp    800a56 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a3c:	89 f2                	mov    %esi,%edx
+  800a3e:	09 c2                	or     %eax,%edx
+  800a40:	09 ca                	or     %ecx,%edx
+  800a42:	f6 c2 03             	test   $0x3,%dl
+  800a45:	75 0a                	jne    800a51 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a47:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a4a:	89 c7                	mov    %eax,%edi
+  800a4c:	fc                   	cld
+  800a4d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a4f:	eb 05                	jmp    800a56 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a51:	89 c7                	mov    %eax,%edi
+  800a53:	fc                   	cld
+  800a54:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a56:	5e                   	pop    %esi
+  800a57:	5f                   	pop    %edi
+  800a58:	5d                   	pop    %ebp
+  800a59:	c3                   	ret
+
+00800a5a <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a5a:	55                   	push   %ebp
+  800a5b:	89 e5                	mov    %esp,%ebp
+  800a5d:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a60:	ff 75 10             	push   0x10(%ebp)
+  800a63:	ff 75 0c             	push   0xc(%ebp)
+  800a66:	ff 75 08             	push   0x8(%ebp)
+  800a69:	e8 8a ff ff ff       	call   8009f8 <memmove>
+}
+  800a6e:	c9                   	leave
+  800a6f:	c3                   	ret
+
+00800a70 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a70:	55                   	push   %ebp
+  800a71:	89 e5                	mov    %esp,%ebp
+  800a73:	56                   	push   %esi
+  800a74:	53                   	push   %ebx
+  800a75:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a78:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a7b:	89 c6                	mov    %eax,%esi
+  800a7d:	03 75 10             	add    0x10(%ebp),%esi
+  800a80:	eb 06                	jmp    800a88 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a82:	83 c0 01             	add    $0x1,%eax
+  800a85:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a88:	39 f0                	cmp    %esi,%eax
+  800a8a:	74 14                	je     800aa0 <memcmp+0x30>
+		if (*s1 != *s2)
+  800a8c:	0f b6 08             	movzbl (%eax),%ecx
+  800a8f:	0f b6 1a             	movzbl (%edx),%ebx
+  800a92:	38 d9                	cmp    %bl,%cl
+  800a94:	74 ec                	je     800a82 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a96:	0f b6 c1             	movzbl %cl,%eax
+  800a99:	0f b6 db             	movzbl %bl,%ebx
+  800a9c:	29 d8                	sub    %ebx,%eax
+  800a9e:	eb 05                	jmp    800aa5 <memcmp+0x35>
+	}
+
+	return 0;
+  800aa0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800aa5:	5b                   	pop    %ebx
+  800aa6:	5e                   	pop    %esi
+  800aa7:	5d                   	pop    %ebp
+  800aa8:	c3                   	ret
+
+00800aa9 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800aa9:	55                   	push   %ebp
+  800aaa:	89 e5                	mov    %esp,%ebp
+  800aac:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aaf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800ab2:	89 c2                	mov    %eax,%edx
+  800ab4:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800ab7:	eb 03                	jmp    800abc <memfind+0x13>
+  800ab9:	83 c0 01             	add    $0x1,%eax
+  800abc:	39 d0                	cmp    %edx,%eax
+  800abe:	73 04                	jae    800ac4 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800ac0:	38 08                	cmp    %cl,(%eax)
+  800ac2:	75 f5                	jne    800ab9 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800ac4:	5d                   	pop    %ebp
+  800ac5:	c3                   	ret
+
+00800ac6 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800ac6:	55                   	push   %ebp
+  800ac7:	89 e5                	mov    %esp,%ebp
+  800ac9:	57                   	push   %edi
+  800aca:	56                   	push   %esi
+  800acb:	53                   	push   %ebx
+  800acc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800acf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800ad2:	eb 03                	jmp    800ad7 <strtol+0x11>
+		s++;
+  800ad4:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800ad7:	0f b6 02             	movzbl (%edx),%eax
+  800ada:	3c 20                	cmp    $0x20,%al
+  800adc:	74 f6                	je     800ad4 <strtol+0xe>
+  800ade:	3c 09                	cmp    $0x9,%al
+  800ae0:	74 f2                	je     800ad4 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800ae2:	3c 2b                	cmp    $0x2b,%al
+  800ae4:	74 2a                	je     800b10 <strtol+0x4a>
+	int neg = 0;
+  800ae6:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800aeb:	3c 2d                	cmp    $0x2d,%al
+  800aed:	74 2b                	je     800b1a <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800aef:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800af5:	75 0f                	jne    800b06 <strtol+0x40>
+  800af7:	80 3a 30             	cmpb   $0x30,(%edx)
+  800afa:	74 28                	je     800b24 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800afc:	85 db                	test   %ebx,%ebx
+  800afe:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b03:	0f 44 d8             	cmove  %eax,%ebx
+  800b06:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b0b:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b0e:	eb 46                	jmp    800b56 <strtol+0x90>
+		s++;
+  800b10:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800b13:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b18:	eb d5                	jmp    800aef <strtol+0x29>
+		s++, neg = 1;
+  800b1a:	83 c2 01             	add    $0x1,%edx
+  800b1d:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b22:	eb cb                	jmp    800aef <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b24:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b28:	74 0e                	je     800b38 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800b2a:	85 db                	test   %ebx,%ebx
+  800b2c:	75 d8                	jne    800b06 <strtol+0x40>
+		s++, base = 8;
+  800b2e:	83 c2 01             	add    $0x1,%edx
+  800b31:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b36:	eb ce                	jmp    800b06 <strtol+0x40>
+		s += 2, base = 16;
+  800b38:	83 c2 02             	add    $0x2,%edx
+  800b3b:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b40:	eb c4                	jmp    800b06 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800b42:	0f be c0             	movsbl %al,%eax
+  800b45:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800b48:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b4b:	7d 3a                	jge    800b87 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800b4d:	83 c2 01             	add    $0x1,%edx
+  800b50:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800b54:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800b56:	0f b6 02             	movzbl (%edx),%eax
+  800b59:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b5c:	89 f3                	mov    %esi,%ebx
+  800b5e:	80 fb 09             	cmp    $0x9,%bl
+  800b61:	76 df                	jbe    800b42 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800b63:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b66:	89 f3                	mov    %esi,%ebx
+  800b68:	80 fb 19             	cmp    $0x19,%bl
+  800b6b:	77 08                	ja     800b75 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800b6d:	0f be c0             	movsbl %al,%eax
+  800b70:	83 e8 57             	sub    $0x57,%eax
+  800b73:	eb d3                	jmp    800b48 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b75:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b78:	89 f3                	mov    %esi,%ebx
+  800b7a:	80 fb 19             	cmp    $0x19,%bl
+  800b7d:	77 08                	ja     800b87 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800b7f:	0f be c0             	movsbl %al,%eax
+  800b82:	83 e8 37             	sub    $0x37,%eax
+  800b85:	eb c1                	jmp    800b48 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b87:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b8b:	74 05                	je     800b92 <strtol+0xcc>
+		*endptr = (char *) s;
+  800b8d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b90:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800b92:	89 c8                	mov    %ecx,%eax
+  800b94:	f7 d8                	neg    %eax
+  800b96:	85 ff                	test   %edi,%edi
+  800b98:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b9b:	89 c8                	mov    %ecx,%eax
+  800b9d:	5b                   	pop    %ebx
+  800b9e:	5e                   	pop    %esi
+  800b9f:	5f                   	pop    %edi
+  800ba0:	5d                   	pop    %ebp
+  800ba1:	c3                   	ret
+
+00800ba2 <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800ba2:	55                   	push   %ebp
+  800ba3:	89 e5                	mov    %esp,%ebp
+  800ba5:	57                   	push   %edi
+  800ba6:	56                   	push   %esi
+  800ba7:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800ba8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bad:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bb0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bb3:	89 c3                	mov    %eax,%ebx
+  800bb5:	89 c7                	mov    %eax,%edi
+  800bb7:	89 c6                	mov    %eax,%esi
+  800bb9:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  800bbb:	5b                   	pop    %ebx
+  800bbc:	5e                   	pop    %esi
+  800bbd:	5f                   	pop    %edi
+  800bbe:	5d                   	pop    %ebp
+  800bbf:	c3                   	ret
+
+00800bc0 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800bc0:	55                   	push   %ebp
+  800bc1:	89 e5                	mov    %esp,%ebp
+  800bc3:	57                   	push   %edi
+  800bc4:	56                   	push   %esi
+  800bc5:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800bc6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bcb:	b8 01 00 00 00       	mov    $0x1,%eax
+  800bd0:	89 d1                	mov    %edx,%ecx
+  800bd2:	89 d3                	mov    %edx,%ebx
+  800bd4:	89 d7                	mov    %edx,%edi
+  800bd6:	89 d6                	mov    %edx,%esi
+  800bd8:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800bda:	5b                   	pop    %ebx
+  800bdb:	5e                   	pop    %esi
+  800bdc:	5f                   	pop    %edi
+  800bdd:	5d                   	pop    %ebp
+  800bde:	c3                   	ret
+
+00800bdf <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800bdf:	55                   	push   %ebp
+  800be0:	89 e5                	mov    %esp,%ebp
+  800be2:	57                   	push   %edi
+  800be3:	56                   	push   %esi
+  800be4:	53                   	push   %ebx
+  800be5:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800be8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bed:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bf0:	b8 03 00 00 00       	mov    $0x3,%eax
+  800bf5:	89 cb                	mov    %ecx,%ebx
+  800bf7:	89 cf                	mov    %ecx,%edi
+  800bf9:	89 ce                	mov    %ecx,%esi
+  800bfb:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800bfd:	85 c0                	test   %eax,%eax
+  800bff:	7f 08                	jg     800c09 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c01:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c04:	5b                   	pop    %ebx
+  800c05:	5e                   	pop    %esi
+  800c06:	5f                   	pop    %edi
+  800c07:	5d                   	pop    %ebp
+  800c08:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c09:	83 ec 0c             	sub    $0xc,%esp
+  800c0c:	50                   	push   %eax
+  800c0d:	6a 03                	push   $0x3
+  800c0f:	68 c3 2a 80 00       	push   $0x802ac3
+  800c14:	6a 3e                	push   $0x3e
+  800c16:	68 e0 2a 80 00       	push   $0x802ae0
+  800c1b:	e8 be f5 ff ff       	call   8001de <_panic>
+
+00800c20 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800c20:	55                   	push   %ebp
+  800c21:	89 e5                	mov    %esp,%ebp
+  800c23:	57                   	push   %edi
+  800c24:	56                   	push   %esi
+  800c25:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800c26:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c2b:	b8 02 00 00 00       	mov    $0x2,%eax
+  800c30:	89 d1                	mov    %edx,%ecx
+  800c32:	89 d3                	mov    %edx,%ebx
+  800c34:	89 d7                	mov    %edx,%edi
+  800c36:	89 d6                	mov    %edx,%esi
+  800c38:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800c3a:	5b                   	pop    %ebx
+  800c3b:	5e                   	pop    %esi
+  800c3c:	5f                   	pop    %edi
+  800c3d:	5d                   	pop    %ebp
+  800c3e:	c3                   	ret
+
+00800c3f <sys_yield>:
+
+void
+sys_yield(void) {
+  800c3f:	55                   	push   %ebp
+  800c40:	89 e5                	mov    %esp,%ebp
+  800c42:	57                   	push   %edi
+  800c43:	56                   	push   %esi
+  800c44:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800c45:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c4a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800c4f:	89 d1                	mov    %edx,%ecx
+  800c51:	89 d3                	mov    %edx,%ebx
+  800c53:	89 d7                	mov    %edx,%edi
+  800c55:	89 d6                	mov    %edx,%esi
+  800c57:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800c59:	5b                   	pop    %ebx
+  800c5a:	5e                   	pop    %esi
+  800c5b:	5f                   	pop    %edi
+  800c5c:	5d                   	pop    %ebp
+  800c5d:	c3                   	ret
+
+00800c5e <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  800c5e:	55                   	push   %ebp
+  800c5f:	89 e5                	mov    %esp,%ebp
+  800c61:	57                   	push   %edi
+  800c62:	56                   	push   %esi
+  800c63:	53                   	push   %ebx
+  800c64:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c67:	be 00 00 00 00       	mov    $0x0,%esi
+  800c6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c6f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c72:	b8 04 00 00 00       	mov    $0x4,%eax
+  800c77:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c7a:	89 f7                	mov    %esi,%edi
+  800c7c:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c7e:	85 c0                	test   %eax,%eax
+  800c80:	7f 08                	jg     800c8a <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800c82:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c85:	5b                   	pop    %ebx
+  800c86:	5e                   	pop    %esi
+  800c87:	5f                   	pop    %edi
+  800c88:	5d                   	pop    %ebp
+  800c89:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c8a:	83 ec 0c             	sub    $0xc,%esp
+  800c8d:	50                   	push   %eax
+  800c8e:	6a 04                	push   $0x4
+  800c90:	68 c3 2a 80 00       	push   $0x802ac3
+  800c95:	6a 3e                	push   $0x3e
+  800c97:	68 e0 2a 80 00       	push   $0x802ae0
+  800c9c:	e8 3d f5 ff ff       	call   8001de <_panic>
+
+00800ca1 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  800ca1:	55                   	push   %ebp
+  800ca2:	89 e5                	mov    %esp,%ebp
+  800ca4:	57                   	push   %edi
+  800ca5:	56                   	push   %esi
+  800ca6:	53                   	push   %ebx
+  800ca7:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800caa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cb0:	b8 05 00 00 00       	mov    $0x5,%eax
+  800cb5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cb8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800cbb:	8b 75 18             	mov    0x18(%ebp),%esi
+  800cbe:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800cc0:	85 c0                	test   %eax,%eax
+  800cc2:	7f 08                	jg     800ccc <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800cc4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cc7:	5b                   	pop    %ebx
+  800cc8:	5e                   	pop    %esi
+  800cc9:	5f                   	pop    %edi
+  800cca:	5d                   	pop    %ebp
+  800ccb:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ccc:	83 ec 0c             	sub    $0xc,%esp
+  800ccf:	50                   	push   %eax
+  800cd0:	6a 05                	push   $0x5
+  800cd2:	68 c3 2a 80 00       	push   $0x802ac3
+  800cd7:	6a 3e                	push   $0x3e
+  800cd9:	68 e0 2a 80 00       	push   $0x802ae0
+  800cde:	e8 fb f4 ff ff       	call   8001de <_panic>
+
+00800ce3 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  800ce3:	55                   	push   %ebp
+  800ce4:	89 e5                	mov    %esp,%ebp
+  800ce6:	57                   	push   %edi
+  800ce7:	56                   	push   %esi
+  800ce8:	53                   	push   %ebx
+  800ce9:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800cec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cf1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cf4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cf7:	b8 06 00 00 00       	mov    $0x6,%eax
+  800cfc:	89 df                	mov    %ebx,%edi
+  800cfe:	89 de                	mov    %ebx,%esi
+  800d00:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d02:	85 c0                	test   %eax,%eax
+  800d04:	7f 08                	jg     800d0e <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800d06:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d09:	5b                   	pop    %ebx
+  800d0a:	5e                   	pop    %esi
+  800d0b:	5f                   	pop    %edi
+  800d0c:	5d                   	pop    %ebp
+  800d0d:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d0e:	83 ec 0c             	sub    $0xc,%esp
+  800d11:	50                   	push   %eax
+  800d12:	6a 06                	push   $0x6
+  800d14:	68 c3 2a 80 00       	push   $0x802ac3
+  800d19:	6a 3e                	push   $0x3e
+  800d1b:	68 e0 2a 80 00       	push   $0x802ae0
+  800d20:	e8 b9 f4 ff ff       	call   8001de <_panic>
+
+00800d25 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800d25:	55                   	push   %ebp
+  800d26:	89 e5                	mov    %esp,%ebp
+  800d28:	57                   	push   %edi
+  800d29:	56                   	push   %esi
+  800d2a:	53                   	push   %ebx
+  800d2b:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800d2e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d33:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d36:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d39:	b8 08 00 00 00       	mov    $0x8,%eax
+  800d3e:	89 df                	mov    %ebx,%edi
+  800d40:	89 de                	mov    %ebx,%esi
+  800d42:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d44:	85 c0                	test   %eax,%eax
+  800d46:	7f 08                	jg     800d50 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800d48:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d4b:	5b                   	pop    %ebx
+  800d4c:	5e                   	pop    %esi
+  800d4d:	5f                   	pop    %edi
+  800d4e:	5d                   	pop    %ebp
+  800d4f:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d50:	83 ec 0c             	sub    $0xc,%esp
+  800d53:	50                   	push   %eax
+  800d54:	6a 08                	push   $0x8
+  800d56:	68 c3 2a 80 00       	push   $0x802ac3
+  800d5b:	6a 3e                	push   $0x3e
+  800d5d:	68 e0 2a 80 00       	push   $0x802ae0
+  800d62:	e8 77 f4 ff ff       	call   8001de <_panic>
+
+00800d67 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800d67:	55                   	push   %ebp
+  800d68:	89 e5                	mov    %esp,%ebp
+  800d6a:	57                   	push   %edi
+  800d6b:	56                   	push   %esi
+  800d6c:	53                   	push   %ebx
+  800d6d:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800d70:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d75:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d78:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d7b:	b8 09 00 00 00       	mov    $0x9,%eax
+  800d80:	89 df                	mov    %ebx,%edi
+  800d82:	89 de                	mov    %ebx,%esi
+  800d84:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d86:	85 c0                	test   %eax,%eax
+  800d88:	7f 08                	jg     800d92 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800d8a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d8d:	5b                   	pop    %ebx
+  800d8e:	5e                   	pop    %esi
+  800d8f:	5f                   	pop    %edi
+  800d90:	5d                   	pop    %ebp
+  800d91:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d92:	83 ec 0c             	sub    $0xc,%esp
+  800d95:	50                   	push   %eax
+  800d96:	6a 09                	push   $0x9
+  800d98:	68 c3 2a 80 00       	push   $0x802ac3
+  800d9d:	6a 3e                	push   $0x3e
+  800d9f:	68 e0 2a 80 00       	push   $0x802ae0
+  800da4:	e8 35 f4 ff ff       	call   8001de <_panic>
+
+00800da9 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800da9:	55                   	push   %ebp
+  800daa:	89 e5                	mov    %esp,%ebp
+  800dac:	57                   	push   %edi
+  800dad:	56                   	push   %esi
+  800dae:	53                   	push   %ebx
+  800daf:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800db2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800db7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dbd:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800dc2:	89 df                	mov    %ebx,%edi
+  800dc4:	89 de                	mov    %ebx,%esi
+  800dc6:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800dc8:	85 c0                	test   %eax,%eax
+  800dca:	7f 08                	jg     800dd4 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800dcc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dcf:	5b                   	pop    %ebx
+  800dd0:	5e                   	pop    %esi
+  800dd1:	5f                   	pop    %edi
+  800dd2:	5d                   	pop    %ebp
+  800dd3:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800dd4:	83 ec 0c             	sub    $0xc,%esp
+  800dd7:	50                   	push   %eax
+  800dd8:	6a 0a                	push   $0xa
+  800dda:	68 c3 2a 80 00       	push   $0x802ac3
+  800ddf:	6a 3e                	push   $0x3e
+  800de1:	68 e0 2a 80 00       	push   $0x802ae0
+  800de6:	e8 f3 f3 ff ff       	call   8001de <_panic>
+
+00800deb <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  800deb:	55                   	push   %ebp
+  800dec:	89 e5                	mov    %esp,%ebp
+  800dee:	57                   	push   %edi
+  800def:	56                   	push   %esi
+  800df0:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800df1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800df7:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800dfc:	be 00 00 00 00       	mov    $0x0,%esi
+  800e01:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e04:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e07:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800e09:	5b                   	pop    %ebx
+  800e0a:	5e                   	pop    %esi
+  800e0b:	5f                   	pop    %edi
+  800e0c:	5d                   	pop    %ebp
+  800e0d:	c3                   	ret
+
+00800e0e <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  800e0e:	55                   	push   %ebp
+  800e0f:	89 e5                	mov    %esp,%ebp
+  800e11:	57                   	push   %edi
+  800e12:	56                   	push   %esi
+  800e13:	53                   	push   %ebx
+  800e14:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800e17:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e1c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e1f:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e24:	89 cb                	mov    %ecx,%ebx
+  800e26:	89 cf                	mov    %ecx,%edi
+  800e28:	89 ce                	mov    %ecx,%esi
+  800e2a:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e2c:	85 c0                	test   %eax,%eax
+  800e2e:	7f 08                	jg     800e38 <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  800e30:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e33:	5b                   	pop    %ebx
+  800e34:	5e                   	pop    %esi
+  800e35:	5f                   	pop    %edi
+  800e36:	5d                   	pop    %ebp
+  800e37:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e38:	83 ec 0c             	sub    $0xc,%esp
+  800e3b:	50                   	push   %eax
+  800e3c:	6a 0d                	push   $0xd
+  800e3e:	68 c3 2a 80 00       	push   $0x802ac3
+  800e43:	6a 3e                	push   $0x3e
+  800e45:	68 e0 2a 80 00       	push   $0x802ae0
+  800e4a:	e8 8f f3 ff ff       	call   8001de <_panic>
+
+00800e4f <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  800e4f:	55                   	push   %ebp
+  800e50:	89 e5                	mov    %esp,%ebp
+  800e52:	57                   	push   %edi
+  800e53:	56                   	push   %esi
+  800e54:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e55:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e5a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e5d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e60:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800e65:	89 df                	mov    %ebx,%edi
+  800e67:	89 de                	mov    %ebx,%esi
+  800e69:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  800e6b:	5b                   	pop    %ebx
+  800e6c:	5e                   	pop    %esi
+  800e6d:	5f                   	pop    %edi
+  800e6e:	5d                   	pop    %ebp
+  800e6f:	c3                   	ret
+
+00800e70 <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  800e70:	55                   	push   %ebp
+  800e71:	89 e5                	mov    %esp,%ebp
+  800e73:	57                   	push   %edi
+  800e74:	56                   	push   %esi
+  800e75:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e76:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e7b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e7e:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800e83:	89 cb                	mov    %ecx,%ebx
+  800e85:	89 cf                	mov    %ecx,%edi
+  800e87:	89 ce                	mov    %ecx,%esi
+  800e89:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  800e8b:	5b                   	pop    %ebx
+  800e8c:	5e                   	pop    %esi
+  800e8d:	5f                   	pop    %edi
+  800e8e:	5d                   	pop    %ebp
+  800e8f:	c3                   	ret
+
+00800e90 <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  800e90:	55                   	push   %ebp
+  800e91:	89 e5                	mov    %esp,%ebp
+  800e93:	57                   	push   %edi
+  800e94:	56                   	push   %esi
+  800e95:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e96:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e9b:	b8 10 00 00 00       	mov    $0x10,%eax
+  800ea0:	89 d1                	mov    %edx,%ecx
+  800ea2:	89 d3                	mov    %edx,%ebx
+  800ea4:	89 d7                	mov    %edx,%edi
+  800ea6:	89 d6                	mov    %edx,%esi
+  800ea8:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800eaa:	5b                   	pop    %ebx
+  800eab:	5e                   	pop    %esi
+  800eac:	5f                   	pop    %edi
+  800ead:	5d                   	pop    %ebp
+  800eae:	c3                   	ret
+
+00800eaf <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  800eaf:	55                   	push   %ebp
+  800eb0:	89 e5                	mov    %esp,%ebp
+  800eb2:	57                   	push   %edi
+  800eb3:	56                   	push   %esi
+  800eb4:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800eb5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eba:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ebd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec0:	b8 11 00 00 00       	mov    $0x11,%eax
+  800ec5:	89 df                	mov    %ebx,%edi
+  800ec7:	89 de                	mov    %ebx,%esi
+  800ec9:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800ecb:	5b                   	pop    %ebx
+  800ecc:	5e                   	pop    %esi
+  800ecd:	5f                   	pop    %edi
+  800ece:	5d                   	pop    %ebp
+  800ecf:	c3                   	ret
+
+00800ed0 <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  800ed0:	55                   	push   %ebp
+  800ed1:	89 e5                	mov    %esp,%ebp
+  800ed3:	57                   	push   %edi
+  800ed4:	56                   	push   %esi
+  800ed5:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800ed6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800edb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ede:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee1:	b8 12 00 00 00       	mov    $0x12,%eax
+  800ee6:	89 df                	mov    %ebx,%edi
+  800ee8:	89 de                	mov    %ebx,%esi
+  800eea:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800eec:	5b                   	pop    %ebx
+  800eed:	5e                   	pop    %esi
+  800eee:	5f                   	pop    %edi
+  800eef:	5d                   	pop    %ebp
+  800ef0:	c3                   	ret
+
+00800ef1 <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  800ef1:	55                   	push   %ebp
+  800ef2:	89 e5                	mov    %esp,%ebp
+  800ef4:	57                   	push   %edi
+  800ef5:	56                   	push   %esi
+  800ef6:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800ef7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800efc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eff:	b8 13 00 00 00       	mov    $0x13,%eax
+  800f04:	89 cb                	mov    %ecx,%ebx
+  800f06:	89 cf                	mov    %ecx,%edi
+  800f08:	89 ce                	mov    %ecx,%esi
+  800f0a:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  800f0c:	5b                   	pop    %ebx
+  800f0d:	5e                   	pop    %esi
+  800f0e:	5f                   	pop    %edi
+  800f0f:	5d                   	pop    %ebp
+  800f10:	c3                   	ret
+
+00800f11 <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  800f11:	55                   	push   %ebp
+  800f12:	89 e5                	mov    %esp,%ebp
+  800f14:	57                   	push   %edi
+  800f15:	56                   	push   %esi
+  800f16:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800f17:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f1c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f1f:	b8 14 00 00 00       	mov    $0x14,%eax
+  800f24:	89 cb                	mov    %ecx,%ebx
+  800f26:	89 cf                	mov    %ecx,%edi
+  800f28:	89 ce                	mov    %ecx,%esi
+  800f2a:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  800f2c:	5b                   	pop    %ebx
+  800f2d:	5e                   	pop    %esi
+  800f2e:	5f                   	pop    %edi
+  800f2f:	5d                   	pop    %ebp
+  800f30:	c3                   	ret
+
+00800f31 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800f31:	55                   	push   %ebp
+  800f32:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800f34:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f37:	05 00 00 00 30       	add    $0x30000000,%eax
+  800f3c:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800f3f:	5d                   	pop    %ebp
+  800f40:	c3                   	ret
+
+00800f41 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800f41:	55                   	push   %ebp
+  800f42:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800f44:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f47:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800f4c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800f51:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800f56:	5d                   	pop    %ebp
+  800f57:	c3                   	ret
+
+00800f58 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800f58:	55                   	push   %ebp
+  800f59:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  800f5b:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800f60:	eb 02                	jmp    800f64 <fd_alloc+0xc>
+  800f62:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800f64:	89 c2                	mov    %eax,%edx
+  800f66:	c1 ea 16             	shr    $0x16,%edx
+  800f69:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800f70:	f6 c2 01             	test   $0x1,%dl
+  800f73:	74 2b                	je     800fa0 <fd_alloc+0x48>
+  800f75:	89 c2                	mov    %eax,%edx
+  800f77:	c1 ea 0c             	shr    $0xc,%edx
+  800f7a:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  800f81:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  800f87:	f6 c1 01             	test   $0x1,%cl
+  800f8a:	74 14                	je     800fa0 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  800f8c:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  800f92:	75 ce                	jne    800f62 <fd_alloc+0xa>
+  800f94:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  800f99:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800f9e:	eb 05                	jmp    800fa5 <fd_alloc+0x4d>
+			return 0;
+  800fa0:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  800fa5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa8:	89 02                	mov    %eax,(%edx)
+}
+  800faa:	89 c8                	mov    %ecx,%eax
+  800fac:	5d                   	pop    %ebp
+  800fad:	c3                   	ret
+
+00800fae <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  800fae:	55                   	push   %ebp
+  800faf:	89 e5                	mov    %esp,%ebp
+  800fb1:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  800fb4:	83 f8 1f             	cmp    $0x1f,%eax
+  800fb7:	77 30                	ja     800fe9 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  800fb9:	c1 e0 0c             	shl    $0xc,%eax
+  800fbc:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800fc1:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  800fc7:	f6 c2 01             	test   $0x1,%dl
+  800fca:	74 24                	je     800ff0 <fd_lookup+0x42>
+  800fcc:	89 c2                	mov    %eax,%edx
+  800fce:	c1 ea 0c             	shr    $0xc,%edx
+  800fd1:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800fd8:	f6 c2 01             	test   $0x1,%dl
+  800fdb:	74 1a                	je     800ff7 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  800fdd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800fe0:	89 02                	mov    %eax,(%edx)
+	return 0;
+  800fe2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fe7:	5d                   	pop    %ebp
+  800fe8:	c3                   	ret
+		return -E_INVAL;
+  800fe9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800fee:	eb f7                	jmp    800fe7 <fd_lookup+0x39>
+		return -E_INVAL;
+  800ff0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ff5:	eb f0                	jmp    800fe7 <fd_lookup+0x39>
+  800ff7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ffc:	eb e9                	jmp    800fe7 <fd_lookup+0x39>
+
+00800ffe <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  800ffe:	55                   	push   %ebp
+  800fff:	89 e5                	mov    %esp,%ebp
+  801001:	53                   	push   %ebx
+  801002:	83 ec 04             	sub    $0x4,%esp
+  801005:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801008:	b8 00 00 00 00       	mov    $0x0,%eax
+  80100d:	eb 03                	jmp    801012 <dev_lookup+0x14>
+  80100f:	83 c0 01             	add    $0x1,%eax
+  801012:	8b 1c 85 6c 2b 80 00 	mov    0x802b6c(,%eax,4),%ebx
+  801019:	85 db                	test   %ebx,%ebx
+  80101b:	74 0b                	je     801028 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  80101d:	39 13                	cmp    %edx,(%ebx)
+  80101f:	75 ee                	jne    80100f <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801021:	b8 00 00 00 00       	mov    $0x0,%eax
+  801026:	eb 1f                	jmp    801047 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801028:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  80102d:	8b 40 48             	mov    0x48(%eax),%eax
+  801030:	83 ec 04             	sub    $0x4,%esp
+  801033:	52                   	push   %edx
+  801034:	50                   	push   %eax
+  801035:	68 f0 2a 80 00       	push   $0x802af0
+  80103a:	e8 7a f2 ff ff       	call   8002b9 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80103f:	83 c4 10             	add    $0x10,%esp
+  801042:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801047:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80104a:	89 1a                	mov    %ebx,(%edx)
+}
+  80104c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80104f:	c9                   	leave
+  801050:	c3                   	ret
+
+00801051 <fd_close>:
+{
+  801051:	55                   	push   %ebp
+  801052:	89 e5                	mov    %esp,%ebp
+  801054:	57                   	push   %edi
+  801055:	56                   	push   %esi
+  801056:	53                   	push   %ebx
+  801057:	83 ec 24             	sub    $0x24,%esp
+  80105a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80105d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801060:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801063:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801064:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80106a:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80106d:	50                   	push   %eax
+  80106e:	e8 3b ff ff ff       	call   800fae <fd_lookup>
+  801073:	89 c3                	mov    %eax,%ebx
+  801075:	83 c4 10             	add    $0x10,%esp
+  801078:	85 c0                	test   %eax,%eax
+  80107a:	78 05                	js     801081 <fd_close+0x30>
+	    || fd != fd2)
+  80107c:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80107f:	74 16                	je     801097 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801081:	89 f8                	mov    %edi,%eax
+  801083:	84 c0                	test   %al,%al
+  801085:	b8 00 00 00 00       	mov    $0x0,%eax
+  80108a:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80108d:	89 d8                	mov    %ebx,%eax
+  80108f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801092:	5b                   	pop    %ebx
+  801093:	5e                   	pop    %esi
+  801094:	5f                   	pop    %edi
+  801095:	5d                   	pop    %ebp
+  801096:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801097:	83 ec 08             	sub    $0x8,%esp
+  80109a:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80109d:	50                   	push   %eax
+  80109e:	ff 36                	push   (%esi)
+  8010a0:	e8 59 ff ff ff       	call   800ffe <dev_lookup>
+  8010a5:	89 c3                	mov    %eax,%ebx
+  8010a7:	83 c4 10             	add    $0x10,%esp
+  8010aa:	85 c0                	test   %eax,%eax
+  8010ac:	78 1a                	js     8010c8 <fd_close+0x77>
+		if (dev->dev_close)
+  8010ae:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8010b1:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8010b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8010b9:	85 c0                	test   %eax,%eax
+  8010bb:	74 0b                	je     8010c8 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8010bd:	83 ec 0c             	sub    $0xc,%esp
+  8010c0:	56                   	push   %esi
+  8010c1:	ff d0                	call   *%eax
+  8010c3:	89 c3                	mov    %eax,%ebx
+  8010c5:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8010c8:	83 ec 08             	sub    $0x8,%esp
+  8010cb:	56                   	push   %esi
+  8010cc:	6a 00                	push   $0x0
+  8010ce:	e8 10 fc ff ff       	call   800ce3 <sys_page_unmap>
+	return r;
+  8010d3:	83 c4 10             	add    $0x10,%esp
+  8010d6:	eb b5                	jmp    80108d <fd_close+0x3c>
+
+008010d8 <close>:
+
+int
+close(int fdnum)
+{
+  8010d8:	55                   	push   %ebp
+  8010d9:	89 e5                	mov    %esp,%ebp
+  8010db:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8010de:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8010e1:	50                   	push   %eax
+  8010e2:	ff 75 08             	push   0x8(%ebp)
+  8010e5:	e8 c4 fe ff ff       	call   800fae <fd_lookup>
+  8010ea:	83 c4 10             	add    $0x10,%esp
+  8010ed:	85 c0                	test   %eax,%eax
+  8010ef:	79 02                	jns    8010f3 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8010f1:	c9                   	leave
+  8010f2:	c3                   	ret
+		return fd_close(fd, 1);
+  8010f3:	83 ec 08             	sub    $0x8,%esp
+  8010f6:	6a 01                	push   $0x1
+  8010f8:	ff 75 f4             	push   -0xc(%ebp)
+  8010fb:	e8 51 ff ff ff       	call   801051 <fd_close>
+  801100:	83 c4 10             	add    $0x10,%esp
+  801103:	eb ec                	jmp    8010f1 <close+0x19>
+
+00801105 <close_all>:
+
+void
+close_all(void)
+{
+  801105:	55                   	push   %ebp
+  801106:	89 e5                	mov    %esp,%ebp
+  801108:	53                   	push   %ebx
+  801109:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80110c:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801111:	83 ec 0c             	sub    $0xc,%esp
+  801114:	53                   	push   %ebx
+  801115:	e8 be ff ff ff       	call   8010d8 <close>
+	for (i = 0; i < MAXFD; i++)
+  80111a:	83 c3 01             	add    $0x1,%ebx
+  80111d:	83 c4 10             	add    $0x10,%esp
+  801120:	83 fb 20             	cmp    $0x20,%ebx
+  801123:	75 ec                	jne    801111 <close_all+0xc>
+}
+  801125:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801128:	c9                   	leave
+  801129:	c3                   	ret
+
+0080112a <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80112a:	55                   	push   %ebp
+  80112b:	89 e5                	mov    %esp,%ebp
+  80112d:	57                   	push   %edi
+  80112e:	56                   	push   %esi
+  80112f:	53                   	push   %ebx
+  801130:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801133:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801136:	50                   	push   %eax
+  801137:	ff 75 08             	push   0x8(%ebp)
+  80113a:	e8 6f fe ff ff       	call   800fae <fd_lookup>
+  80113f:	89 c3                	mov    %eax,%ebx
+  801141:	83 c4 10             	add    $0x10,%esp
+  801144:	85 c0                	test   %eax,%eax
+  801146:	78 7f                	js     8011c7 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801148:	83 ec 0c             	sub    $0xc,%esp
+  80114b:	ff 75 0c             	push   0xc(%ebp)
+  80114e:	e8 85 ff ff ff       	call   8010d8 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801153:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801156:	c1 e6 0c             	shl    $0xc,%esi
+  801159:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80115f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801162:	89 3c 24             	mov    %edi,(%esp)
+  801165:	e8 d7 fd ff ff       	call   800f41 <fd2data>
+  80116a:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80116c:	89 34 24             	mov    %esi,(%esp)
+  80116f:	e8 cd fd ff ff       	call   800f41 <fd2data>
+  801174:	83 c4 10             	add    $0x10,%esp
+  801177:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80117a:	89 d8                	mov    %ebx,%eax
+  80117c:	c1 e8 16             	shr    $0x16,%eax
+  80117f:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801186:	a8 01                	test   $0x1,%al
+  801188:	74 11                	je     80119b <dup+0x71>
+  80118a:	89 d8                	mov    %ebx,%eax
+  80118c:	c1 e8 0c             	shr    $0xc,%eax
+  80118f:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801196:	f6 c2 01             	test   $0x1,%dl
+  801199:	75 36                	jne    8011d1 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80119b:	89 f8                	mov    %edi,%eax
+  80119d:	c1 e8 0c             	shr    $0xc,%eax
+  8011a0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8011a7:	83 ec 0c             	sub    $0xc,%esp
+  8011aa:	25 07 0e 00 00       	and    $0xe07,%eax
+  8011af:	50                   	push   %eax
+  8011b0:	56                   	push   %esi
+  8011b1:	6a 00                	push   $0x0
+  8011b3:	57                   	push   %edi
+  8011b4:	6a 00                	push   $0x0
+  8011b6:	e8 e6 fa ff ff       	call   800ca1 <sys_page_map>
+  8011bb:	89 c3                	mov    %eax,%ebx
+  8011bd:	83 c4 20             	add    $0x20,%esp
+  8011c0:	85 c0                	test   %eax,%eax
+  8011c2:	78 33                	js     8011f7 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8011c4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8011c7:	89 d8                	mov    %ebx,%eax
+  8011c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011cc:	5b                   	pop    %ebx
+  8011cd:	5e                   	pop    %esi
+  8011ce:	5f                   	pop    %edi
+  8011cf:	5d                   	pop    %ebp
+  8011d0:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8011d1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8011d8:	83 ec 0c             	sub    $0xc,%esp
+  8011db:	25 07 0e 00 00       	and    $0xe07,%eax
+  8011e0:	50                   	push   %eax
+  8011e1:	ff 75 d4             	push   -0x2c(%ebp)
+  8011e4:	6a 00                	push   $0x0
+  8011e6:	53                   	push   %ebx
+  8011e7:	6a 00                	push   $0x0
+  8011e9:	e8 b3 fa ff ff       	call   800ca1 <sys_page_map>
+  8011ee:	89 c3                	mov    %eax,%ebx
+  8011f0:	83 c4 20             	add    $0x20,%esp
+  8011f3:	85 c0                	test   %eax,%eax
+  8011f5:	79 a4                	jns    80119b <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8011f7:	83 ec 08             	sub    $0x8,%esp
+  8011fa:	56                   	push   %esi
+  8011fb:	6a 00                	push   $0x0
+  8011fd:	e8 e1 fa ff ff       	call   800ce3 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801202:	83 c4 08             	add    $0x8,%esp
+  801205:	ff 75 d4             	push   -0x2c(%ebp)
+  801208:	6a 00                	push   $0x0
+  80120a:	e8 d4 fa ff ff       	call   800ce3 <sys_page_unmap>
+	return r;
+  80120f:	83 c4 10             	add    $0x10,%esp
+  801212:	eb b3                	jmp    8011c7 <dup+0x9d>
+
+00801214 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801214:	55                   	push   %ebp
+  801215:	89 e5                	mov    %esp,%ebp
+  801217:	56                   	push   %esi
+  801218:	53                   	push   %ebx
+  801219:	83 ec 18             	sub    $0x18,%esp
+  80121c:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80121f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801222:	50                   	push   %eax
+  801223:	56                   	push   %esi
+  801224:	e8 85 fd ff ff       	call   800fae <fd_lookup>
+  801229:	83 c4 10             	add    $0x10,%esp
+  80122c:	85 c0                	test   %eax,%eax
+  80122e:	78 3c                	js     80126c <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801230:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801233:	83 ec 08             	sub    $0x8,%esp
+  801236:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801239:	50                   	push   %eax
+  80123a:	ff 33                	push   (%ebx)
+  80123c:	e8 bd fd ff ff       	call   800ffe <dev_lookup>
+  801241:	83 c4 10             	add    $0x10,%esp
+  801244:	85 c0                	test   %eax,%eax
+  801246:	78 24                	js     80126c <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801248:	8b 43 08             	mov    0x8(%ebx),%eax
+  80124b:	83 e0 03             	and    $0x3,%eax
+  80124e:	83 f8 01             	cmp    $0x1,%eax
+  801251:	74 20                	je     801273 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801253:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801256:	8b 40 08             	mov    0x8(%eax),%eax
+  801259:	85 c0                	test   %eax,%eax
+  80125b:	74 37                	je     801294 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80125d:	83 ec 04             	sub    $0x4,%esp
+  801260:	ff 75 10             	push   0x10(%ebp)
+  801263:	ff 75 0c             	push   0xc(%ebp)
+  801266:	53                   	push   %ebx
+  801267:	ff d0                	call   *%eax
+  801269:	83 c4 10             	add    $0x10,%esp
+}
+  80126c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80126f:	5b                   	pop    %ebx
+  801270:	5e                   	pop    %esi
+  801271:	5d                   	pop    %ebp
+  801272:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801273:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  801278:	8b 40 48             	mov    0x48(%eax),%eax
+  80127b:	83 ec 04             	sub    $0x4,%esp
+  80127e:	56                   	push   %esi
+  80127f:	50                   	push   %eax
+  801280:	68 31 2b 80 00       	push   $0x802b31
+  801285:	e8 2f f0 ff ff       	call   8002b9 <cprintf>
+		return -E_INVAL;
+  80128a:	83 c4 10             	add    $0x10,%esp
+  80128d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801292:	eb d8                	jmp    80126c <read+0x58>
+		return -E_NOT_SUPP;
+  801294:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801299:	eb d1                	jmp    80126c <read+0x58>
+
+0080129b <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80129b:	55                   	push   %ebp
+  80129c:	89 e5                	mov    %esp,%ebp
+  80129e:	57                   	push   %edi
+  80129f:	56                   	push   %esi
+  8012a0:	53                   	push   %ebx
+  8012a1:	83 ec 0c             	sub    $0xc,%esp
+  8012a4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8012a7:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8012aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012af:	eb 02                	jmp    8012b3 <readn+0x18>
+  8012b1:	01 c3                	add    %eax,%ebx
+  8012b3:	39 f3                	cmp    %esi,%ebx
+  8012b5:	73 21                	jae    8012d8 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8012b7:	83 ec 04             	sub    $0x4,%esp
+  8012ba:	89 f0                	mov    %esi,%eax
+  8012bc:	29 d8                	sub    %ebx,%eax
+  8012be:	50                   	push   %eax
+  8012bf:	89 d8                	mov    %ebx,%eax
+  8012c1:	03 45 0c             	add    0xc(%ebp),%eax
+  8012c4:	50                   	push   %eax
+  8012c5:	57                   	push   %edi
+  8012c6:	e8 49 ff ff ff       	call   801214 <read>
+		if (m < 0)
+  8012cb:	83 c4 10             	add    $0x10,%esp
+  8012ce:	85 c0                	test   %eax,%eax
+  8012d0:	78 04                	js     8012d6 <readn+0x3b>
+			return m;
+		if (m == 0)
+  8012d2:	75 dd                	jne    8012b1 <readn+0x16>
+  8012d4:	eb 02                	jmp    8012d8 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8012d6:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8012d8:	89 d8                	mov    %ebx,%eax
+  8012da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012dd:	5b                   	pop    %ebx
+  8012de:	5e                   	pop    %esi
+  8012df:	5f                   	pop    %edi
+  8012e0:	5d                   	pop    %ebp
+  8012e1:	c3                   	ret
+
+008012e2 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8012e2:	55                   	push   %ebp
+  8012e3:	89 e5                	mov    %esp,%ebp
+  8012e5:	56                   	push   %esi
+  8012e6:	53                   	push   %ebx
+  8012e7:	83 ec 18             	sub    $0x18,%esp
+  8012ea:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8012ed:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8012f0:	50                   	push   %eax
+  8012f1:	53                   	push   %ebx
+  8012f2:	e8 b7 fc ff ff       	call   800fae <fd_lookup>
+  8012f7:	83 c4 10             	add    $0x10,%esp
+  8012fa:	85 c0                	test   %eax,%eax
+  8012fc:	78 37                	js     801335 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8012fe:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801301:	83 ec 08             	sub    $0x8,%esp
+  801304:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801307:	50                   	push   %eax
+  801308:	ff 36                	push   (%esi)
+  80130a:	e8 ef fc ff ff       	call   800ffe <dev_lookup>
+  80130f:	83 c4 10             	add    $0x10,%esp
+  801312:	85 c0                	test   %eax,%eax
+  801314:	78 1f                	js     801335 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801316:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80131a:	74 20                	je     80133c <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80131c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80131f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801322:	85 c0                	test   %eax,%eax
+  801324:	74 37                	je     80135d <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801326:	83 ec 04             	sub    $0x4,%esp
+  801329:	ff 75 10             	push   0x10(%ebp)
+  80132c:	ff 75 0c             	push   0xc(%ebp)
+  80132f:	56                   	push   %esi
+  801330:	ff d0                	call   *%eax
+  801332:	83 c4 10             	add    $0x10,%esp
+}
+  801335:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801338:	5b                   	pop    %ebx
+  801339:	5e                   	pop    %esi
+  80133a:	5d                   	pop    %ebp
+  80133b:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80133c:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  801341:	8b 40 48             	mov    0x48(%eax),%eax
+  801344:	83 ec 04             	sub    $0x4,%esp
+  801347:	53                   	push   %ebx
+  801348:	50                   	push   %eax
+  801349:	68 4d 2b 80 00       	push   $0x802b4d
+  80134e:	e8 66 ef ff ff       	call   8002b9 <cprintf>
+		return -E_INVAL;
+  801353:	83 c4 10             	add    $0x10,%esp
+  801356:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80135b:	eb d8                	jmp    801335 <write+0x53>
+		return -E_NOT_SUPP;
+  80135d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801362:	eb d1                	jmp    801335 <write+0x53>
+
+00801364 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801364:	55                   	push   %ebp
+  801365:	89 e5                	mov    %esp,%ebp
+  801367:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80136a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80136d:	50                   	push   %eax
+  80136e:	ff 75 08             	push   0x8(%ebp)
+  801371:	e8 38 fc ff ff       	call   800fae <fd_lookup>
+  801376:	83 c4 10             	add    $0x10,%esp
+  801379:	85 c0                	test   %eax,%eax
+  80137b:	78 0e                	js     80138b <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80137d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801380:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801383:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801386:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80138b:	c9                   	leave
+  80138c:	c3                   	ret
+
+0080138d <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80138d:	55                   	push   %ebp
+  80138e:	89 e5                	mov    %esp,%ebp
+  801390:	56                   	push   %esi
+  801391:	53                   	push   %ebx
+  801392:	83 ec 18             	sub    $0x18,%esp
+  801395:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801398:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80139b:	50                   	push   %eax
+  80139c:	53                   	push   %ebx
+  80139d:	e8 0c fc ff ff       	call   800fae <fd_lookup>
+  8013a2:	83 c4 10             	add    $0x10,%esp
+  8013a5:	85 c0                	test   %eax,%eax
+  8013a7:	78 34                	js     8013dd <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8013a9:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8013ac:	83 ec 08             	sub    $0x8,%esp
+  8013af:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013b2:	50                   	push   %eax
+  8013b3:	ff 36                	push   (%esi)
+  8013b5:	e8 44 fc ff ff       	call   800ffe <dev_lookup>
+  8013ba:	83 c4 10             	add    $0x10,%esp
+  8013bd:	85 c0                	test   %eax,%eax
+  8013bf:	78 1c                	js     8013dd <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8013c1:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8013c5:	74 1d                	je     8013e4 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8013c7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013ca:	8b 40 18             	mov    0x18(%eax),%eax
+  8013cd:	85 c0                	test   %eax,%eax
+  8013cf:	74 34                	je     801405 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8013d1:	83 ec 08             	sub    $0x8,%esp
+  8013d4:	ff 75 0c             	push   0xc(%ebp)
+  8013d7:	56                   	push   %esi
+  8013d8:	ff d0                	call   *%eax
+  8013da:	83 c4 10             	add    $0x10,%esp
+}
+  8013dd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013e0:	5b                   	pop    %ebx
+  8013e1:	5e                   	pop    %esi
+  8013e2:	5d                   	pop    %ebp
+  8013e3:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8013e4:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  8013e9:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8013ec:	83 ec 04             	sub    $0x4,%esp
+  8013ef:	53                   	push   %ebx
+  8013f0:	50                   	push   %eax
+  8013f1:	68 10 2b 80 00       	push   $0x802b10
+  8013f6:	e8 be ee ff ff       	call   8002b9 <cprintf>
+		return -E_INVAL;
+  8013fb:	83 c4 10             	add    $0x10,%esp
+  8013fe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801403:	eb d8                	jmp    8013dd <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801405:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80140a:	eb d1                	jmp    8013dd <ftruncate+0x50>
+
+0080140c <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80140c:	55                   	push   %ebp
+  80140d:	89 e5                	mov    %esp,%ebp
+  80140f:	56                   	push   %esi
+  801410:	53                   	push   %ebx
+  801411:	83 ec 18             	sub    $0x18,%esp
+  801414:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801417:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80141a:	50                   	push   %eax
+  80141b:	ff 75 08             	push   0x8(%ebp)
+  80141e:	e8 8b fb ff ff       	call   800fae <fd_lookup>
+  801423:	83 c4 10             	add    $0x10,%esp
+  801426:	85 c0                	test   %eax,%eax
+  801428:	78 49                	js     801473 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80142a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80142d:	83 ec 08             	sub    $0x8,%esp
+  801430:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801433:	50                   	push   %eax
+  801434:	ff 36                	push   (%esi)
+  801436:	e8 c3 fb ff ff       	call   800ffe <dev_lookup>
+  80143b:	83 c4 10             	add    $0x10,%esp
+  80143e:	85 c0                	test   %eax,%eax
+  801440:	78 31                	js     801473 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801442:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801445:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801449:	74 2f                	je     80147a <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80144b:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80144e:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801455:	00 00 00 
+	stat->st_isdir = 0;
+  801458:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80145f:	00 00 00 
+	stat->st_dev = dev;
+  801462:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801468:	83 ec 08             	sub    $0x8,%esp
+  80146b:	53                   	push   %ebx
+  80146c:	56                   	push   %esi
+  80146d:	ff 50 14             	call   *0x14(%eax)
+  801470:	83 c4 10             	add    $0x10,%esp
+}
+  801473:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801476:	5b                   	pop    %ebx
+  801477:	5e                   	pop    %esi
+  801478:	5d                   	pop    %ebp
+  801479:	c3                   	ret
+		return -E_NOT_SUPP;
+  80147a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80147f:	eb f2                	jmp    801473 <fstat+0x67>
+
+00801481 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801481:	55                   	push   %ebp
+  801482:	89 e5                	mov    %esp,%ebp
+  801484:	56                   	push   %esi
+  801485:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801486:	83 ec 08             	sub    $0x8,%esp
+  801489:	6a 00                	push   $0x0
+  80148b:	ff 75 08             	push   0x8(%ebp)
+  80148e:	e8 e4 01 00 00       	call   801677 <open>
+  801493:	89 c3                	mov    %eax,%ebx
+  801495:	83 c4 10             	add    $0x10,%esp
+  801498:	85 c0                	test   %eax,%eax
+  80149a:	78 1b                	js     8014b7 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80149c:	83 ec 08             	sub    $0x8,%esp
+  80149f:	ff 75 0c             	push   0xc(%ebp)
+  8014a2:	50                   	push   %eax
+  8014a3:	e8 64 ff ff ff       	call   80140c <fstat>
+  8014a8:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8014aa:	89 1c 24             	mov    %ebx,(%esp)
+  8014ad:	e8 26 fc ff ff       	call   8010d8 <close>
+	return r;
+  8014b2:	83 c4 10             	add    $0x10,%esp
+  8014b5:	89 f3                	mov    %esi,%ebx
+}
+  8014b7:	89 d8                	mov    %ebx,%eax
+  8014b9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014bc:	5b                   	pop    %ebx
+  8014bd:	5e                   	pop    %esi
+  8014be:	5d                   	pop    %ebp
+  8014bf:	c3                   	ret
+
+008014c0 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  8014c0:	55                   	push   %ebp
+  8014c1:	89 e5                	mov    %esp,%ebp
+  8014c3:	56                   	push   %esi
+  8014c4:	53                   	push   %ebx
+  8014c5:	89 c6                	mov    %eax,%esi
+  8014c7:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  8014c9:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8014d0:	74 27                	je     8014f9 <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8014d2:	6a 07                	push   $0x7
+  8014d4:	68 00 50 80 00       	push   $0x805000
+  8014d9:	56                   	push   %esi
+  8014da:	ff 35 04 40 80 00    	push   0x804004
+  8014e0:	e8 e5 0c 00 00       	call   8021ca <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  8014e5:	83 c4 0c             	add    $0xc,%esp
+  8014e8:	6a 00                	push   $0x0
+  8014ea:	53                   	push   %ebx
+  8014eb:	6a 00                	push   $0x0
+  8014ed:	e8 64 0c 00 00       	call   802156 <ipc_recv>
+}
+  8014f2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014f5:	5b                   	pop    %ebx
+  8014f6:	5e                   	pop    %esi
+  8014f7:	5d                   	pop    %ebp
+  8014f8:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  8014f9:	83 ec 0c             	sub    $0xc,%esp
+  8014fc:	6a 01                	push   $0x1
+  8014fe:	e8 1b 0d 00 00       	call   80221e <ipc_find_env>
+  801503:	a3 04 40 80 00       	mov    %eax,0x804004
+  801508:	83 c4 10             	add    $0x10,%esp
+  80150b:	eb c5                	jmp    8014d2 <fsipc+0x12>
+
+0080150d <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80150d:	55                   	push   %ebp
+  80150e:	89 e5                	mov    %esp,%ebp
+  801510:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801513:	8b 45 08             	mov    0x8(%ebp),%eax
+  801516:	8b 40 0c             	mov    0xc(%eax),%eax
+  801519:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.set_size.req_size = newsize;
+  80151e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801521:	a3 04 50 80 00       	mov    %eax,0x805004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801526:	ba 00 00 00 00       	mov    $0x0,%edx
+  80152b:	b8 02 00 00 00       	mov    $0x2,%eax
+  801530:	e8 8b ff ff ff       	call   8014c0 <fsipc>
+}
+  801535:	c9                   	leave
+  801536:	c3                   	ret
+
+00801537 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801537:	55                   	push   %ebp
+  801538:	89 e5                	mov    %esp,%ebp
+  80153a:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80153d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801540:	8b 40 0c             	mov    0xc(%eax),%eax
+  801543:	a3 00 50 80 00       	mov    %eax,0x805000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801548:	ba 00 00 00 00       	mov    $0x0,%edx
+  80154d:	b8 06 00 00 00       	mov    $0x6,%eax
+  801552:	e8 69 ff ff ff       	call   8014c0 <fsipc>
+}
+  801557:	c9                   	leave
+  801558:	c3                   	ret
+
+00801559 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801559:	55                   	push   %ebp
+  80155a:	89 e5                	mov    %esp,%ebp
+  80155c:	53                   	push   %ebx
+  80155d:	83 ec 04             	sub    $0x4,%esp
+  801560:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801563:	8b 45 08             	mov    0x8(%ebp),%eax
+  801566:	8b 40 0c             	mov    0xc(%eax),%eax
+  801569:	a3 00 50 80 00       	mov    %eax,0x805000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80156e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801573:	b8 05 00 00 00       	mov    $0x5,%eax
+  801578:	e8 43 ff ff ff       	call   8014c0 <fsipc>
+  80157d:	85 c0                	test   %eax,%eax
+  80157f:	78 2c                	js     8015ad <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801581:	83 ec 08             	sub    $0x8,%esp
+  801584:	68 00 50 80 00       	push   $0x805000
+  801589:	53                   	push   %ebx
+  80158a:	e8 e3 f2 ff ff       	call   800872 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  80158f:	a1 80 50 80 00       	mov    0x805080,%eax
+  801594:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80159a:	a1 84 50 80 00       	mov    0x805084,%eax
+  80159f:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  8015a5:	83 c4 10             	add    $0x10,%esp
+  8015a8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015ad:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015b0:	c9                   	leave
+  8015b1:	c3                   	ret
+
+008015b2 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8015b2:	55                   	push   %ebp
+  8015b3:	89 e5                	mov    %esp,%ebp
+  8015b5:	83 ec 0c             	sub    $0xc,%esp
+  8015b8:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8015bb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015be:	8b 52 0c             	mov    0xc(%edx),%edx
+  8015c1:	89 15 00 50 80 00    	mov    %edx,0x805000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8015c7:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8015cc:	39 d0                	cmp    %edx,%eax
+  8015ce:	0f 47 c2             	cmova  %edx,%eax
+  8015d1:	a3 04 50 80 00       	mov    %eax,0x805004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  8015d6:	50                   	push   %eax
+  8015d7:	ff 75 0c             	push   0xc(%ebp)
+  8015da:	68 08 50 80 00       	push   $0x805008
+  8015df:	e8 14 f4 ff ff       	call   8009f8 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  8015e4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015e9:	b8 04 00 00 00       	mov    $0x4,%eax
+  8015ee:	e8 cd fe ff ff       	call   8014c0 <fsipc>
+}
+  8015f3:	c9                   	leave
+  8015f4:	c3                   	ret
+
+008015f5 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8015f5:	55                   	push   %ebp
+  8015f6:	89 e5                	mov    %esp,%ebp
+  8015f8:	56                   	push   %esi
+  8015f9:	53                   	push   %ebx
+  8015fa:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8015fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801600:	8b 40 0c             	mov    0xc(%eax),%eax
+  801603:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.read.req_n = n;
+  801608:	89 35 04 50 80 00    	mov    %esi,0x805004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  80160e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801613:	b8 03 00 00 00       	mov    $0x3,%eax
+  801618:	e8 a3 fe ff ff       	call   8014c0 <fsipc>
+  80161d:	89 c3                	mov    %eax,%ebx
+  80161f:	85 c0                	test   %eax,%eax
+  801621:	78 1f                	js     801642 <devfile_read+0x4d>
+  assert(r <= n);
+  801623:	39 c6                	cmp    %eax,%esi
+  801625:	72 24                	jb     80164b <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  801627:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80162c:	7f 33                	jg     801661 <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80162e:	83 ec 04             	sub    $0x4,%esp
+  801631:	50                   	push   %eax
+  801632:	68 00 50 80 00       	push   $0x805000
+  801637:	ff 75 0c             	push   0xc(%ebp)
+  80163a:	e8 b9 f3 ff ff       	call   8009f8 <memmove>
+  return r;
+  80163f:	83 c4 10             	add    $0x10,%esp
+}
+  801642:	89 d8                	mov    %ebx,%eax
+  801644:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801647:	5b                   	pop    %ebx
+  801648:	5e                   	pop    %esi
+  801649:	5d                   	pop    %ebp
+  80164a:	c3                   	ret
+  assert(r <= n);
+  80164b:	68 80 2b 80 00       	push   $0x802b80
+  801650:	68 87 2b 80 00       	push   $0x802b87
+  801655:	6a 78                	push   $0x78
+  801657:	68 9c 2b 80 00       	push   $0x802b9c
+  80165c:	e8 7d eb ff ff       	call   8001de <_panic>
+  assert(r <= PGSIZE);
+  801661:	68 a7 2b 80 00       	push   $0x802ba7
+  801666:	68 87 2b 80 00       	push   $0x802b87
+  80166b:	6a 79                	push   $0x79
+  80166d:	68 9c 2b 80 00       	push   $0x802b9c
+  801672:	e8 67 eb ff ff       	call   8001de <_panic>
+
+00801677 <open>:
+open(const char *path, int mode) {
+  801677:	55                   	push   %ebp
+  801678:	89 e5                	mov    %esp,%ebp
+  80167a:	56                   	push   %esi
+  80167b:	53                   	push   %ebx
+  80167c:	83 ec 1c             	sub    $0x1c,%esp
+  80167f:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801682:	56                   	push   %esi
+  801683:	e8 af f1 ff ff       	call   800837 <strlen>
+  801688:	83 c4 10             	add    $0x10,%esp
+  80168b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801690:	7f 6c                	jg     8016fe <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801692:	83 ec 0c             	sub    $0xc,%esp
+  801695:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801698:	50                   	push   %eax
+  801699:	e8 ba f8 ff ff       	call   800f58 <fd_alloc>
+  80169e:	89 c3                	mov    %eax,%ebx
+  8016a0:	83 c4 10             	add    $0x10,%esp
+  8016a3:	85 c0                	test   %eax,%eax
+  8016a5:	78 3c                	js     8016e3 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  8016a7:	83 ec 08             	sub    $0x8,%esp
+  8016aa:	56                   	push   %esi
+  8016ab:	68 00 50 80 00       	push   $0x805000
+  8016b0:	e8 bd f1 ff ff       	call   800872 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  8016b5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8016b8:	a3 00 54 80 00       	mov    %eax,0x805400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8016bd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8016c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8016c5:	e8 f6 fd ff ff       	call   8014c0 <fsipc>
+  8016ca:	89 c3                	mov    %eax,%ebx
+  8016cc:	83 c4 10             	add    $0x10,%esp
+  8016cf:	85 c0                	test   %eax,%eax
+  8016d1:	78 19                	js     8016ec <open+0x75>
+  return fd2num(fd);
+  8016d3:	83 ec 0c             	sub    $0xc,%esp
+  8016d6:	ff 75 f4             	push   -0xc(%ebp)
+  8016d9:	e8 53 f8 ff ff       	call   800f31 <fd2num>
+  8016de:	89 c3                	mov    %eax,%ebx
+  8016e0:	83 c4 10             	add    $0x10,%esp
+}
+  8016e3:	89 d8                	mov    %ebx,%eax
+  8016e5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016e8:	5b                   	pop    %ebx
+  8016e9:	5e                   	pop    %esi
+  8016ea:	5d                   	pop    %ebp
+  8016eb:	c3                   	ret
+    fd_close(fd, 0);
+  8016ec:	83 ec 08             	sub    $0x8,%esp
+  8016ef:	6a 00                	push   $0x0
+  8016f1:	ff 75 f4             	push   -0xc(%ebp)
+  8016f4:	e8 58 f9 ff ff       	call   801051 <fd_close>
+    return r;
+  8016f9:	83 c4 10             	add    $0x10,%esp
+  8016fc:	eb e5                	jmp    8016e3 <open+0x6c>
+    return -E_BAD_PATH;
+  8016fe:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801703:	eb de                	jmp    8016e3 <open+0x6c>
+
+00801705 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  801705:	55                   	push   %ebp
+  801706:	89 e5                	mov    %esp,%ebp
+  801708:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  80170b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801710:	b8 08 00 00 00       	mov    $0x8,%eax
+  801715:	e8 a6 fd ff ff       	call   8014c0 <fsipc>
+}
+  80171a:	c9                   	leave
+  80171b:	c3                   	ret
+
+0080171c <writebuf>:
+
+
+static void
+writebuf(struct printbuf *b)
+{
+	if (b->error > 0) {
+  80171c:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  801720:	7f 01                	jg     801723 <writebuf+0x7>
+  801722:	c3                   	ret
+{
+  801723:	55                   	push   %ebp
+  801724:	89 e5                	mov    %esp,%ebp
+  801726:	53                   	push   %ebx
+  801727:	83 ec 08             	sub    $0x8,%esp
+  80172a:	89 c3                	mov    %eax,%ebx
+		ssize_t result = write(b->fd, b->buf, b->idx);
+  80172c:	ff 70 04             	push   0x4(%eax)
+  80172f:	8d 40 10             	lea    0x10(%eax),%eax
+  801732:	50                   	push   %eax
+  801733:	ff 33                	push   (%ebx)
+  801735:	e8 a8 fb ff ff       	call   8012e2 <write>
+		if (result > 0)
+  80173a:	83 c4 10             	add    $0x10,%esp
+  80173d:	85 c0                	test   %eax,%eax
+  80173f:	7e 03                	jle    801744 <writebuf+0x28>
+			b->result += result;
+  801741:	01 43 08             	add    %eax,0x8(%ebx)
+		if (result != b->idx) // error, or wrote less than supplied
+  801744:	39 43 04             	cmp    %eax,0x4(%ebx)
+  801747:	74 0d                	je     801756 <writebuf+0x3a>
+			b->error = (result < 0 ? result : 0);
+  801749:	85 c0                	test   %eax,%eax
+  80174b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801750:	0f 4f c2             	cmovg  %edx,%eax
+  801753:	89 43 0c             	mov    %eax,0xc(%ebx)
+	}
+}
+  801756:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801759:	c9                   	leave
+  80175a:	c3                   	ret
+
+0080175b <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  80175b:	55                   	push   %ebp
+  80175c:	89 e5                	mov    %esp,%ebp
+  80175e:	53                   	push   %ebx
+  80175f:	83 ec 04             	sub    $0x4,%esp
+  801762:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct printbuf *b = (struct printbuf *) thunk;
+	b->buf[b->idx++] = ch;
+  801765:	8b 53 04             	mov    0x4(%ebx),%edx
+  801768:	8d 42 01             	lea    0x1(%edx),%eax
+  80176b:	89 43 04             	mov    %eax,0x4(%ebx)
+  80176e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801771:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+	if (b->idx == 256) {
+  801775:	3d 00 01 00 00       	cmp    $0x100,%eax
+  80177a:	74 05                	je     801781 <putch+0x26>
+		writebuf(b);
+		b->idx = 0;
+	}
+}
+  80177c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80177f:	c9                   	leave
+  801780:	c3                   	ret
+		writebuf(b);
+  801781:	89 d8                	mov    %ebx,%eax
+  801783:	e8 94 ff ff ff       	call   80171c <writebuf>
+		b->idx = 0;
+  801788:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+  80178f:	eb eb                	jmp    80177c <putch+0x21>
+
+00801791 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  801791:	55                   	push   %ebp
+  801792:	89 e5                	mov    %esp,%ebp
+  801794:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.fd = fd;
+  80179a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80179d:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+	b.idx = 0;
+  8017a3:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  8017aa:	00 00 00 
+	b.result = 0;
+  8017ad:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8017b4:	00 00 00 
+	b.error = 1;
+  8017b7:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  8017be:	00 00 00 
+	vprintfmt(putch, &b, fmt, ap);
+  8017c1:	ff 75 10             	push   0x10(%ebp)
+  8017c4:	ff 75 0c             	push   0xc(%ebp)
+  8017c7:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  8017cd:	50                   	push   %eax
+  8017ce:	68 5b 17 80 00       	push   $0x80175b
+  8017d3:	e8 d8 eb ff ff       	call   8003b0 <vprintfmt>
+	if (b.idx > 0)
+  8017d8:	83 c4 10             	add    $0x10,%esp
+  8017db:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  8017e2:	7f 12                	jg     8017f6 <vfprintf+0x65>
+		writebuf(&b);
+
+	return (b.result ? b.result : b.error);
+  8017e4:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  8017ea:	85 c0                	test   %eax,%eax
+  8017ec:	75 06                	jne    8017f4 <vfprintf+0x63>
+  8017ee:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  8017f4:	c9                   	leave
+  8017f5:	c3                   	ret
+		writebuf(&b);
+  8017f6:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  8017fc:	e8 1b ff ff ff       	call   80171c <writebuf>
+  801801:	eb e1                	jmp    8017e4 <vfprintf+0x53>
+
+00801803 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  801803:	55                   	push   %ebp
+  801804:	89 e5                	mov    %esp,%ebp
+  801806:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  801809:	8d 45 10             	lea    0x10(%ebp),%eax
+	cnt = vfprintf(fd, fmt, ap);
+  80180c:	50                   	push   %eax
+  80180d:	ff 75 0c             	push   0xc(%ebp)
+  801810:	ff 75 08             	push   0x8(%ebp)
+  801813:	e8 79 ff ff ff       	call   801791 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  801818:	c9                   	leave
+  801819:	c3                   	ret
+
+0080181a <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  80181a:	55                   	push   %ebp
+  80181b:	89 e5                	mov    %esp,%ebp
+  80181d:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  801820:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vfprintf(1, fmt, ap);
+  801823:	50                   	push   %eax
+  801824:	ff 75 08             	push   0x8(%ebp)
+  801827:	6a 01                	push   $0x1
+  801829:	e8 63 ff ff ff       	call   801791 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80182e:	c9                   	leave
+  80182f:	c3                   	ret
+
+00801830 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801830:	55                   	push   %ebp
+  801831:	89 e5                	mov    %esp,%ebp
+  801833:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801836:	68 b3 2b 80 00       	push   $0x802bb3
+  80183b:	ff 75 0c             	push   0xc(%ebp)
+  80183e:	e8 2f f0 ff ff       	call   800872 <strcpy>
+	return 0;
+}
+  801843:	b8 00 00 00 00       	mov    $0x0,%eax
+  801848:	c9                   	leave
+  801849:	c3                   	ret
+
+0080184a <devsock_close>:
+{
+  80184a:	55                   	push   %ebp
+  80184b:	89 e5                	mov    %esp,%ebp
+  80184d:	53                   	push   %ebx
+  80184e:	83 ec 10             	sub    $0x10,%esp
+  801851:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801854:	53                   	push   %ebx
+  801855:	e8 03 0a 00 00       	call   80225d <pageref>
+  80185a:	89 c2                	mov    %eax,%edx
+  80185c:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80185f:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801864:	83 fa 01             	cmp    $0x1,%edx
+  801867:	74 05                	je     80186e <devsock_close+0x24>
+}
+  801869:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80186c:	c9                   	leave
+  80186d:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  80186e:	83 ec 0c             	sub    $0xc,%esp
+  801871:	ff 73 0c             	push   0xc(%ebx)
+  801874:	e8 b7 02 00 00       	call   801b30 <nsipc_close>
+  801879:	83 c4 10             	add    $0x10,%esp
+  80187c:	eb eb                	jmp    801869 <devsock_close+0x1f>
+
+0080187e <devsock_write>:
+{
+  80187e:	55                   	push   %ebp
+  80187f:	89 e5                	mov    %esp,%ebp
+  801881:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801884:	6a 00                	push   $0x0
+  801886:	ff 75 10             	push   0x10(%ebp)
+  801889:	ff 75 0c             	push   0xc(%ebp)
+  80188c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80188f:	ff 70 0c             	push   0xc(%eax)
+  801892:	e8 79 03 00 00       	call   801c10 <nsipc_send>
+}
+  801897:	c9                   	leave
+  801898:	c3                   	ret
+
+00801899 <devsock_read>:
+{
+  801899:	55                   	push   %ebp
+  80189a:	89 e5                	mov    %esp,%ebp
+  80189c:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  80189f:	6a 00                	push   $0x0
+  8018a1:	ff 75 10             	push   0x10(%ebp)
+  8018a4:	ff 75 0c             	push   0xc(%ebp)
+  8018a7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018aa:	ff 70 0c             	push   0xc(%eax)
+  8018ad:	e8 ef 02 00 00       	call   801ba1 <nsipc_recv>
+}
+  8018b2:	c9                   	leave
+  8018b3:	c3                   	ret
+
+008018b4 <fd2sockid>:
+{
+  8018b4:	55                   	push   %ebp
+  8018b5:	89 e5                	mov    %esp,%ebp
+  8018b7:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8018ba:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8018bd:	52                   	push   %edx
+  8018be:	50                   	push   %eax
+  8018bf:	e8 ea f6 ff ff       	call   800fae <fd_lookup>
+  8018c4:	83 c4 10             	add    $0x10,%esp
+  8018c7:	85 c0                	test   %eax,%eax
+  8018c9:	78 10                	js     8018db <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8018cb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018ce:	8b 0d 24 30 80 00    	mov    0x803024,%ecx
+  8018d4:	39 08                	cmp    %ecx,(%eax)
+  8018d6:	75 05                	jne    8018dd <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8018d8:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8018db:	c9                   	leave
+  8018dc:	c3                   	ret
+		return -E_NOT_SUPP;
+  8018dd:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8018e2:	eb f7                	jmp    8018db <fd2sockid+0x27>
+
+008018e4 <alloc_sockfd>:
+{
+  8018e4:	55                   	push   %ebp
+  8018e5:	89 e5                	mov    %esp,%ebp
+  8018e7:	56                   	push   %esi
+  8018e8:	53                   	push   %ebx
+  8018e9:	83 ec 1c             	sub    $0x1c,%esp
+  8018ec:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8018ee:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018f1:	50                   	push   %eax
+  8018f2:	e8 61 f6 ff ff       	call   800f58 <fd_alloc>
+  8018f7:	89 c3                	mov    %eax,%ebx
+  8018f9:	83 c4 10             	add    $0x10,%esp
+  8018fc:	85 c0                	test   %eax,%eax
+  8018fe:	78 43                	js     801943 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801900:	83 ec 04             	sub    $0x4,%esp
+  801903:	68 07 04 00 00       	push   $0x407
+  801908:	ff 75 f4             	push   -0xc(%ebp)
+  80190b:	6a 00                	push   $0x0
+  80190d:	e8 4c f3 ff ff       	call   800c5e <sys_page_alloc>
+  801912:	89 c3                	mov    %eax,%ebx
+  801914:	83 c4 10             	add    $0x10,%esp
+  801917:	85 c0                	test   %eax,%eax
+  801919:	78 28                	js     801943 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  80191b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80191e:	8b 15 24 30 80 00    	mov    0x803024,%edx
+  801924:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801926:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801929:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801930:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801933:	83 ec 0c             	sub    $0xc,%esp
+  801936:	50                   	push   %eax
+  801937:	e8 f5 f5 ff ff       	call   800f31 <fd2num>
+  80193c:	89 c3                	mov    %eax,%ebx
+  80193e:	83 c4 10             	add    $0x10,%esp
+  801941:	eb 0c                	jmp    80194f <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801943:	83 ec 0c             	sub    $0xc,%esp
+  801946:	56                   	push   %esi
+  801947:	e8 e4 01 00 00       	call   801b30 <nsipc_close>
+		return r;
+  80194c:	83 c4 10             	add    $0x10,%esp
+}
+  80194f:	89 d8                	mov    %ebx,%eax
+  801951:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801954:	5b                   	pop    %ebx
+  801955:	5e                   	pop    %esi
+  801956:	5d                   	pop    %ebp
+  801957:	c3                   	ret
+
+00801958 <accept>:
+{
+  801958:	55                   	push   %ebp
+  801959:	89 e5                	mov    %esp,%ebp
+  80195b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80195e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801961:	e8 4e ff ff ff       	call   8018b4 <fd2sockid>
+  801966:	85 c0                	test   %eax,%eax
+  801968:	78 1b                	js     801985 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  80196a:	83 ec 04             	sub    $0x4,%esp
+  80196d:	ff 75 10             	push   0x10(%ebp)
+  801970:	ff 75 0c             	push   0xc(%ebp)
+  801973:	50                   	push   %eax
+  801974:	e8 0e 01 00 00       	call   801a87 <nsipc_accept>
+  801979:	83 c4 10             	add    $0x10,%esp
+  80197c:	85 c0                	test   %eax,%eax
+  80197e:	78 05                	js     801985 <accept+0x2d>
+	return alloc_sockfd(r);
+  801980:	e8 5f ff ff ff       	call   8018e4 <alloc_sockfd>
+}
+  801985:	c9                   	leave
+  801986:	c3                   	ret
+
+00801987 <bind>:
+{
+  801987:	55                   	push   %ebp
+  801988:	89 e5                	mov    %esp,%ebp
+  80198a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80198d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801990:	e8 1f ff ff ff       	call   8018b4 <fd2sockid>
+  801995:	85 c0                	test   %eax,%eax
+  801997:	78 12                	js     8019ab <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801999:	83 ec 04             	sub    $0x4,%esp
+  80199c:	ff 75 10             	push   0x10(%ebp)
+  80199f:	ff 75 0c             	push   0xc(%ebp)
+  8019a2:	50                   	push   %eax
+  8019a3:	e8 31 01 00 00       	call   801ad9 <nsipc_bind>
+  8019a8:	83 c4 10             	add    $0x10,%esp
+}
+  8019ab:	c9                   	leave
+  8019ac:	c3                   	ret
+
+008019ad <shutdown>:
+{
+  8019ad:	55                   	push   %ebp
+  8019ae:	89 e5                	mov    %esp,%ebp
+  8019b0:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8019b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019b6:	e8 f9 fe ff ff       	call   8018b4 <fd2sockid>
+  8019bb:	85 c0                	test   %eax,%eax
+  8019bd:	78 0f                	js     8019ce <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8019bf:	83 ec 08             	sub    $0x8,%esp
+  8019c2:	ff 75 0c             	push   0xc(%ebp)
+  8019c5:	50                   	push   %eax
+  8019c6:	e8 43 01 00 00       	call   801b0e <nsipc_shutdown>
+  8019cb:	83 c4 10             	add    $0x10,%esp
+}
+  8019ce:	c9                   	leave
+  8019cf:	c3                   	ret
+
+008019d0 <connect>:
+{
+  8019d0:	55                   	push   %ebp
+  8019d1:	89 e5                	mov    %esp,%ebp
+  8019d3:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8019d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019d9:	e8 d6 fe ff ff       	call   8018b4 <fd2sockid>
+  8019de:	85 c0                	test   %eax,%eax
+  8019e0:	78 12                	js     8019f4 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8019e2:	83 ec 04             	sub    $0x4,%esp
+  8019e5:	ff 75 10             	push   0x10(%ebp)
+  8019e8:	ff 75 0c             	push   0xc(%ebp)
+  8019eb:	50                   	push   %eax
+  8019ec:	e8 59 01 00 00       	call   801b4a <nsipc_connect>
+  8019f1:	83 c4 10             	add    $0x10,%esp
+}
+  8019f4:	c9                   	leave
+  8019f5:	c3                   	ret
+
+008019f6 <listen>:
+{
+  8019f6:	55                   	push   %ebp
+  8019f7:	89 e5                	mov    %esp,%ebp
+  8019f9:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8019fc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019ff:	e8 b0 fe ff ff       	call   8018b4 <fd2sockid>
+  801a04:	85 c0                	test   %eax,%eax
+  801a06:	78 0f                	js     801a17 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801a08:	83 ec 08             	sub    $0x8,%esp
+  801a0b:	ff 75 0c             	push   0xc(%ebp)
+  801a0e:	50                   	push   %eax
+  801a0f:	e8 6b 01 00 00       	call   801b7f <nsipc_listen>
+  801a14:	83 c4 10             	add    $0x10,%esp
+}
+  801a17:	c9                   	leave
+  801a18:	c3                   	ret
+
+00801a19 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801a19:	55                   	push   %ebp
+  801a1a:	89 e5                	mov    %esp,%ebp
+  801a1c:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801a1f:	ff 75 10             	push   0x10(%ebp)
+  801a22:	ff 75 0c             	push   0xc(%ebp)
+  801a25:	ff 75 08             	push   0x8(%ebp)
+  801a28:	e8 41 02 00 00       	call   801c6e <nsipc_socket>
+  801a2d:	83 c4 10             	add    $0x10,%esp
+  801a30:	85 c0                	test   %eax,%eax
+  801a32:	78 05                	js     801a39 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801a34:	e8 ab fe ff ff       	call   8018e4 <alloc_sockfd>
+}
+  801a39:	c9                   	leave
+  801a3a:	c3                   	ret
+
+00801a3b <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801a3b:	55                   	push   %ebp
+  801a3c:	89 e5                	mov    %esp,%ebp
+  801a3e:	53                   	push   %ebx
+  801a3f:	83 ec 04             	sub    $0x4,%esp
+  801a42:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801a44:	83 3d 08 40 80 00 00 	cmpl   $0x0,0x804008
+  801a4b:	74 26                	je     801a73 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801a4d:	6a 07                	push   $0x7
+  801a4f:	68 00 60 80 00       	push   $0x806000
+  801a54:	53                   	push   %ebx
+  801a55:	ff 35 08 40 80 00    	push   0x804008
+  801a5b:	e8 6a 07 00 00       	call   8021ca <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801a60:	83 c4 0c             	add    $0xc,%esp
+  801a63:	6a 00                	push   $0x0
+  801a65:	6a 00                	push   $0x0
+  801a67:	6a 00                	push   $0x0
+  801a69:	e8 e8 06 00 00       	call   802156 <ipc_recv>
+}
+  801a6e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a71:	c9                   	leave
+  801a72:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801a73:	83 ec 0c             	sub    $0xc,%esp
+  801a76:	6a 02                	push   $0x2
+  801a78:	e8 a1 07 00 00       	call   80221e <ipc_find_env>
+  801a7d:	a3 08 40 80 00       	mov    %eax,0x804008
+  801a82:	83 c4 10             	add    $0x10,%esp
+  801a85:	eb c6                	jmp    801a4d <nsipc+0x12>
+
+00801a87 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801a87:	55                   	push   %ebp
+  801a88:	89 e5                	mov    %esp,%ebp
+  801a8a:	56                   	push   %esi
+  801a8b:	53                   	push   %ebx
+  801a8c:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801a8f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a92:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801a97:	8b 06                	mov    (%esi),%eax
+  801a99:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801a9e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801aa3:	e8 93 ff ff ff       	call   801a3b <nsipc>
+  801aa8:	89 c3                	mov    %eax,%ebx
+  801aaa:	85 c0                	test   %eax,%eax
+  801aac:	79 09                	jns    801ab7 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801aae:	89 d8                	mov    %ebx,%eax
+  801ab0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ab3:	5b                   	pop    %ebx
+  801ab4:	5e                   	pop    %esi
+  801ab5:	5d                   	pop    %ebp
+  801ab6:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801ab7:	83 ec 04             	sub    $0x4,%esp
+  801aba:	ff 35 10 60 80 00    	push   0x806010
+  801ac0:	68 00 60 80 00       	push   $0x806000
+  801ac5:	ff 75 0c             	push   0xc(%ebp)
+  801ac8:	e8 2b ef ff ff       	call   8009f8 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801acd:	a1 10 60 80 00       	mov    0x806010,%eax
+  801ad2:	89 06                	mov    %eax,(%esi)
+  801ad4:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801ad7:	eb d5                	jmp    801aae <nsipc_accept+0x27>
+
+00801ad9 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801ad9:	55                   	push   %ebp
+  801ada:	89 e5                	mov    %esp,%ebp
+  801adc:	53                   	push   %ebx
+  801add:	83 ec 08             	sub    $0x8,%esp
+  801ae0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801ae3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ae6:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801aeb:	53                   	push   %ebx
+  801aec:	ff 75 0c             	push   0xc(%ebp)
+  801aef:	68 04 60 80 00       	push   $0x806004
+  801af4:	e8 ff ee ff ff       	call   8009f8 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801af9:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  801aff:	b8 02 00 00 00       	mov    $0x2,%eax
+  801b04:	e8 32 ff ff ff       	call   801a3b <nsipc>
+}
+  801b09:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b0c:	c9                   	leave
+  801b0d:	c3                   	ret
+
+00801b0e <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801b0e:	55                   	push   %ebp
+  801b0f:	89 e5                	mov    %esp,%ebp
+  801b11:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801b14:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b17:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  801b1c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b1f:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  801b24:	b8 03 00 00 00       	mov    $0x3,%eax
+  801b29:	e8 0d ff ff ff       	call   801a3b <nsipc>
+}
+  801b2e:	c9                   	leave
+  801b2f:	c3                   	ret
+
+00801b30 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801b30:	55                   	push   %ebp
+  801b31:	89 e5                	mov    %esp,%ebp
+  801b33:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801b36:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b39:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  801b3e:	b8 04 00 00 00       	mov    $0x4,%eax
+  801b43:	e8 f3 fe ff ff       	call   801a3b <nsipc>
+}
+  801b48:	c9                   	leave
+  801b49:	c3                   	ret
+
+00801b4a <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801b4a:	55                   	push   %ebp
+  801b4b:	89 e5                	mov    %esp,%ebp
+  801b4d:	53                   	push   %ebx
+  801b4e:	83 ec 08             	sub    $0x8,%esp
+  801b51:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801b54:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b57:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801b5c:	53                   	push   %ebx
+  801b5d:	ff 75 0c             	push   0xc(%ebp)
+  801b60:	68 04 60 80 00       	push   $0x806004
+  801b65:	e8 8e ee ff ff       	call   8009f8 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801b6a:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  801b70:	b8 05 00 00 00       	mov    $0x5,%eax
+  801b75:	e8 c1 fe ff ff       	call   801a3b <nsipc>
+}
+  801b7a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b7d:	c9                   	leave
+  801b7e:	c3                   	ret
+
+00801b7f <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801b7f:	55                   	push   %ebp
+  801b80:	89 e5                	mov    %esp,%ebp
+  801b82:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801b85:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b88:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  801b8d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b90:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  801b95:	b8 06 00 00 00       	mov    $0x6,%eax
+  801b9a:	e8 9c fe ff ff       	call   801a3b <nsipc>
+}
+  801b9f:	c9                   	leave
+  801ba0:	c3                   	ret
+
+00801ba1 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801ba1:	55                   	push   %ebp
+  801ba2:	89 e5                	mov    %esp,%ebp
+  801ba4:	56                   	push   %esi
+  801ba5:	53                   	push   %ebx
+  801ba6:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801ba9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bac:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  801bb1:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  801bb7:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bba:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801bbf:	b8 07 00 00 00       	mov    $0x7,%eax
+  801bc4:	e8 72 fe ff ff       	call   801a3b <nsipc>
+  801bc9:	89 c3                	mov    %eax,%ebx
+  801bcb:	85 c0                	test   %eax,%eax
+  801bcd:	78 22                	js     801bf1 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801bcf:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801bd4:	39 c6                	cmp    %eax,%esi
+  801bd6:	0f 4e c6             	cmovle %esi,%eax
+  801bd9:	39 c3                	cmp    %eax,%ebx
+  801bdb:	7f 1d                	jg     801bfa <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801bdd:	83 ec 04             	sub    $0x4,%esp
+  801be0:	53                   	push   %ebx
+  801be1:	68 00 60 80 00       	push   $0x806000
+  801be6:	ff 75 0c             	push   0xc(%ebp)
+  801be9:	e8 0a ee ff ff       	call   8009f8 <memmove>
+  801bee:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801bf1:	89 d8                	mov    %ebx,%eax
+  801bf3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bf6:	5b                   	pop    %ebx
+  801bf7:	5e                   	pop    %esi
+  801bf8:	5d                   	pop    %ebp
+  801bf9:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801bfa:	68 bf 2b 80 00       	push   $0x802bbf
+  801bff:	68 87 2b 80 00       	push   $0x802b87
+  801c04:	6a 62                	push   $0x62
+  801c06:	68 d4 2b 80 00       	push   $0x802bd4
+  801c0b:	e8 ce e5 ff ff       	call   8001de <_panic>
+
+00801c10 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801c10:	55                   	push   %ebp
+  801c11:	89 e5                	mov    %esp,%ebp
+  801c13:	53                   	push   %ebx
+  801c14:	83 ec 04             	sub    $0x4,%esp
+  801c17:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801c1a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c1d:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  801c22:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801c28:	7f 2e                	jg     801c58 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801c2a:	83 ec 04             	sub    $0x4,%esp
+  801c2d:	53                   	push   %ebx
+  801c2e:	ff 75 0c             	push   0xc(%ebp)
+  801c31:	68 0c 60 80 00       	push   $0x80600c
+  801c36:	e8 bd ed ff ff       	call   8009f8 <memmove>
+	nsipcbuf.send.req_size = size;
+  801c3b:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  801c41:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c44:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  801c49:	b8 08 00 00 00       	mov    $0x8,%eax
+  801c4e:	e8 e8 fd ff ff       	call   801a3b <nsipc>
+}
+  801c53:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c56:	c9                   	leave
+  801c57:	c3                   	ret
+	assert(size < 1600);
+  801c58:	68 e0 2b 80 00       	push   $0x802be0
+  801c5d:	68 87 2b 80 00       	push   $0x802b87
+  801c62:	6a 6d                	push   $0x6d
+  801c64:	68 d4 2b 80 00       	push   $0x802bd4
+  801c69:	e8 70 e5 ff ff       	call   8001de <_panic>
+
+00801c6e <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801c6e:	55                   	push   %ebp
+  801c6f:	89 e5                	mov    %esp,%ebp
+  801c71:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801c74:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c77:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  801c7c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c7f:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  801c84:	8b 45 10             	mov    0x10(%ebp),%eax
+  801c87:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  801c8c:	b8 09 00 00 00       	mov    $0x9,%eax
+  801c91:	e8 a5 fd ff ff       	call   801a3b <nsipc>
+}
+  801c96:	c9                   	leave
+  801c97:	c3                   	ret
+
+00801c98 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801c98:	55                   	push   %ebp
+  801c99:	89 e5                	mov    %esp,%ebp
+  801c9b:	56                   	push   %esi
+  801c9c:	53                   	push   %ebx
+  801c9d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801ca0:	83 ec 0c             	sub    $0xc,%esp
+  801ca3:	ff 75 08             	push   0x8(%ebp)
+  801ca6:	e8 96 f2 ff ff       	call   800f41 <fd2data>
+  801cab:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801cad:	83 c4 08             	add    $0x8,%esp
+  801cb0:	68 ec 2b 80 00       	push   $0x802bec
+  801cb5:	53                   	push   %ebx
+  801cb6:	e8 b7 eb ff ff       	call   800872 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801cbb:	8b 46 04             	mov    0x4(%esi),%eax
+  801cbe:	2b 06                	sub    (%esi),%eax
+  801cc0:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  801cc6:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801ccd:	00 00 00 
+	stat->st_dev = &devpipe;
+  801cd0:	c7 83 88 00 00 00 40 	movl   $0x803040,0x88(%ebx)
+  801cd7:	30 80 00 
+	return 0;
+}
+  801cda:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cdf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ce2:	5b                   	pop    %ebx
+  801ce3:	5e                   	pop    %esi
+  801ce4:	5d                   	pop    %ebp
+  801ce5:	c3                   	ret
+
+00801ce6 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801ce6:	55                   	push   %ebp
+  801ce7:	89 e5                	mov    %esp,%ebp
+  801ce9:	53                   	push   %ebx
+  801cea:	83 ec 0c             	sub    $0xc,%esp
+  801ced:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801cf0:	53                   	push   %ebx
+  801cf1:	6a 00                	push   $0x0
+  801cf3:	e8 eb ef ff ff       	call   800ce3 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801cf8:	89 1c 24             	mov    %ebx,(%esp)
+  801cfb:	e8 41 f2 ff ff       	call   800f41 <fd2data>
+  801d00:	83 c4 08             	add    $0x8,%esp
+  801d03:	50                   	push   %eax
+  801d04:	6a 00                	push   $0x0
+  801d06:	e8 d8 ef ff ff       	call   800ce3 <sys_page_unmap>
+}
+  801d0b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d0e:	c9                   	leave
+  801d0f:	c3                   	ret
+
+00801d10 <_pipeisclosed>:
+{
+  801d10:	55                   	push   %ebp
+  801d11:	89 e5                	mov    %esp,%ebp
+  801d13:	57                   	push   %edi
+  801d14:	56                   	push   %esi
+  801d15:	53                   	push   %ebx
+  801d16:	83 ec 1c             	sub    $0x1c,%esp
+  801d19:	89 c7                	mov    %eax,%edi
+  801d1b:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801d1d:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  801d22:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801d25:	83 ec 0c             	sub    $0xc,%esp
+  801d28:	57                   	push   %edi
+  801d29:	e8 2f 05 00 00       	call   80225d <pageref>
+  801d2e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801d31:	89 34 24             	mov    %esi,(%esp)
+  801d34:	e8 24 05 00 00       	call   80225d <pageref>
+		nn = thisenv->env_runs;
+  801d39:	8b 15 0c 40 80 00    	mov    0x80400c,%edx
+  801d3f:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801d42:	83 c4 10             	add    $0x10,%esp
+  801d45:	39 cb                	cmp    %ecx,%ebx
+  801d47:	74 1b                	je     801d64 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801d49:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801d4c:	75 cf                	jne    801d1d <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801d4e:	8b 42 58             	mov    0x58(%edx),%eax
+  801d51:	6a 01                	push   $0x1
+  801d53:	50                   	push   %eax
+  801d54:	53                   	push   %ebx
+  801d55:	68 f3 2b 80 00       	push   $0x802bf3
+  801d5a:	e8 5a e5 ff ff       	call   8002b9 <cprintf>
+  801d5f:	83 c4 10             	add    $0x10,%esp
+  801d62:	eb b9                	jmp    801d1d <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801d64:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801d67:	0f 94 c0             	sete   %al
+  801d6a:	0f b6 c0             	movzbl %al,%eax
+}
+  801d6d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d70:	5b                   	pop    %ebx
+  801d71:	5e                   	pop    %esi
+  801d72:	5f                   	pop    %edi
+  801d73:	5d                   	pop    %ebp
+  801d74:	c3                   	ret
+
+00801d75 <devpipe_write>:
+{
+  801d75:	55                   	push   %ebp
+  801d76:	89 e5                	mov    %esp,%ebp
+  801d78:	57                   	push   %edi
+  801d79:	56                   	push   %esi
+  801d7a:	53                   	push   %ebx
+  801d7b:	83 ec 28             	sub    $0x28,%esp
+  801d7e:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801d81:	56                   	push   %esi
+  801d82:	e8 ba f1 ff ff       	call   800f41 <fd2data>
+  801d87:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801d89:	83 c4 10             	add    $0x10,%esp
+  801d8c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d91:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801d94:	75 09                	jne    801d9f <devpipe_write+0x2a>
+	return i;
+  801d96:	89 f8                	mov    %edi,%eax
+  801d98:	eb 23                	jmp    801dbd <devpipe_write+0x48>
+			sys_yield();
+  801d9a:	e8 a0 ee ff ff       	call   800c3f <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801d9f:	8b 43 04             	mov    0x4(%ebx),%eax
+  801da2:	8b 0b                	mov    (%ebx),%ecx
+  801da4:	8d 51 20             	lea    0x20(%ecx),%edx
+  801da7:	39 d0                	cmp    %edx,%eax
+  801da9:	72 1a                	jb     801dc5 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  801dab:	89 da                	mov    %ebx,%edx
+  801dad:	89 f0                	mov    %esi,%eax
+  801daf:	e8 5c ff ff ff       	call   801d10 <_pipeisclosed>
+  801db4:	85 c0                	test   %eax,%eax
+  801db6:	74 e2                	je     801d9a <devpipe_write+0x25>
+				return 0;
+  801db8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801dbd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801dc0:	5b                   	pop    %ebx
+  801dc1:	5e                   	pop    %esi
+  801dc2:	5f                   	pop    %edi
+  801dc3:	5d                   	pop    %ebp
+  801dc4:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801dc5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801dc8:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801dcc:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801dcf:	89 c2                	mov    %eax,%edx
+  801dd1:	c1 fa 1f             	sar    $0x1f,%edx
+  801dd4:	89 d1                	mov    %edx,%ecx
+  801dd6:	c1 e9 1b             	shr    $0x1b,%ecx
+  801dd9:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801ddc:	83 e2 1f             	and    $0x1f,%edx
+  801ddf:	29 ca                	sub    %ecx,%edx
+  801de1:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801de5:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  801de9:	83 c0 01             	add    $0x1,%eax
+  801dec:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  801def:	83 c7 01             	add    $0x1,%edi
+  801df2:	eb 9d                	jmp    801d91 <devpipe_write+0x1c>
+
+00801df4 <devpipe_read>:
+{
+  801df4:	55                   	push   %ebp
+  801df5:	89 e5                	mov    %esp,%ebp
+  801df7:	57                   	push   %edi
+  801df8:	56                   	push   %esi
+  801df9:	53                   	push   %ebx
+  801dfa:	83 ec 18             	sub    $0x18,%esp
+  801dfd:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  801e00:	57                   	push   %edi
+  801e01:	e8 3b f1 ff ff       	call   800f41 <fd2data>
+  801e06:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801e08:	83 c4 10             	add    $0x10,%esp
+  801e0b:	be 00 00 00 00       	mov    $0x0,%esi
+  801e10:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801e13:	75 13                	jne    801e28 <devpipe_read+0x34>
+	return i;
+  801e15:	89 f0                	mov    %esi,%eax
+  801e17:	eb 02                	jmp    801e1b <devpipe_read+0x27>
+				return i;
+  801e19:	89 f0                	mov    %esi,%eax
+}
+  801e1b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e1e:	5b                   	pop    %ebx
+  801e1f:	5e                   	pop    %esi
+  801e20:	5f                   	pop    %edi
+  801e21:	5d                   	pop    %ebp
+  801e22:	c3                   	ret
+			sys_yield();
+  801e23:	e8 17 ee ff ff       	call   800c3f <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  801e28:	8b 03                	mov    (%ebx),%eax
+  801e2a:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801e2d:	75 18                	jne    801e47 <devpipe_read+0x53>
+			if (i > 0)
+  801e2f:	85 f6                	test   %esi,%esi
+  801e31:	75 e6                	jne    801e19 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  801e33:	89 da                	mov    %ebx,%edx
+  801e35:	89 f8                	mov    %edi,%eax
+  801e37:	e8 d4 fe ff ff       	call   801d10 <_pipeisclosed>
+  801e3c:	85 c0                	test   %eax,%eax
+  801e3e:	74 e3                	je     801e23 <devpipe_read+0x2f>
+				return 0;
+  801e40:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e45:	eb d4                	jmp    801e1b <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801e47:	99                   	cltd
+  801e48:	c1 ea 1b             	shr    $0x1b,%edx
+  801e4b:	01 d0                	add    %edx,%eax
+  801e4d:	83 e0 1f             	and    $0x1f,%eax
+  801e50:	29 d0                	sub    %edx,%eax
+  801e52:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801e57:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e5a:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  801e5d:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  801e60:	83 c6 01             	add    $0x1,%esi
+  801e63:	eb ab                	jmp    801e10 <devpipe_read+0x1c>
+
+00801e65 <pipe>:
+{
+  801e65:	55                   	push   %ebp
+  801e66:	89 e5                	mov    %esp,%ebp
+  801e68:	56                   	push   %esi
+  801e69:	53                   	push   %ebx
+  801e6a:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801e6d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e70:	50                   	push   %eax
+  801e71:	e8 e2 f0 ff ff       	call   800f58 <fd_alloc>
+  801e76:	89 c3                	mov    %eax,%ebx
+  801e78:	83 c4 10             	add    $0x10,%esp
+  801e7b:	85 c0                	test   %eax,%eax
+  801e7d:	0f 88 23 01 00 00    	js     801fa6 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801e83:	83 ec 04             	sub    $0x4,%esp
+  801e86:	68 07 04 00 00       	push   $0x407
+  801e8b:	ff 75 f4             	push   -0xc(%ebp)
+  801e8e:	6a 00                	push   $0x0
+  801e90:	e8 c9 ed ff ff       	call   800c5e <sys_page_alloc>
+  801e95:	89 c3                	mov    %eax,%ebx
+  801e97:	83 c4 10             	add    $0x10,%esp
+  801e9a:	85 c0                	test   %eax,%eax
+  801e9c:	0f 88 04 01 00 00    	js     801fa6 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801ea2:	83 ec 0c             	sub    $0xc,%esp
+  801ea5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ea8:	50                   	push   %eax
+  801ea9:	e8 aa f0 ff ff       	call   800f58 <fd_alloc>
+  801eae:	89 c3                	mov    %eax,%ebx
+  801eb0:	83 c4 10             	add    $0x10,%esp
+  801eb3:	85 c0                	test   %eax,%eax
+  801eb5:	0f 88 db 00 00 00    	js     801f96 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801ebb:	83 ec 04             	sub    $0x4,%esp
+  801ebe:	68 07 04 00 00       	push   $0x407
+  801ec3:	ff 75 f0             	push   -0x10(%ebp)
+  801ec6:	6a 00                	push   $0x0
+  801ec8:	e8 91 ed ff ff       	call   800c5e <sys_page_alloc>
+  801ecd:	89 c3                	mov    %eax,%ebx
+  801ecf:	83 c4 10             	add    $0x10,%esp
+  801ed2:	85 c0                	test   %eax,%eax
+  801ed4:	0f 88 bc 00 00 00    	js     801f96 <pipe+0x131>
+	va = fd2data(fd0);
+  801eda:	83 ec 0c             	sub    $0xc,%esp
+  801edd:	ff 75 f4             	push   -0xc(%ebp)
+  801ee0:	e8 5c f0 ff ff       	call   800f41 <fd2data>
+  801ee5:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801ee7:	83 c4 0c             	add    $0xc,%esp
+  801eea:	68 07 04 00 00       	push   $0x407
+  801eef:	50                   	push   %eax
+  801ef0:	6a 00                	push   $0x0
+  801ef2:	e8 67 ed ff ff       	call   800c5e <sys_page_alloc>
+  801ef7:	89 c3                	mov    %eax,%ebx
+  801ef9:	83 c4 10             	add    $0x10,%esp
+  801efc:	85 c0                	test   %eax,%eax
+  801efe:	0f 88 82 00 00 00    	js     801f86 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801f04:	83 ec 0c             	sub    $0xc,%esp
+  801f07:	ff 75 f0             	push   -0x10(%ebp)
+  801f0a:	e8 32 f0 ff ff       	call   800f41 <fd2data>
+  801f0f:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801f16:	50                   	push   %eax
+  801f17:	6a 00                	push   $0x0
+  801f19:	56                   	push   %esi
+  801f1a:	6a 00                	push   $0x0
+  801f1c:	e8 80 ed ff ff       	call   800ca1 <sys_page_map>
+  801f21:	89 c3                	mov    %eax,%ebx
+  801f23:	83 c4 20             	add    $0x20,%esp
+  801f26:	85 c0                	test   %eax,%eax
+  801f28:	78 4e                	js     801f78 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  801f2a:	a1 40 30 80 00       	mov    0x803040,%eax
+  801f2f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801f32:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  801f34:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801f37:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  801f3e:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801f41:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  801f43:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801f46:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  801f4d:	83 ec 0c             	sub    $0xc,%esp
+  801f50:	ff 75 f4             	push   -0xc(%ebp)
+  801f53:	e8 d9 ef ff ff       	call   800f31 <fd2num>
+  801f58:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801f5b:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  801f5d:	83 c4 04             	add    $0x4,%esp
+  801f60:	ff 75 f0             	push   -0x10(%ebp)
+  801f63:	e8 c9 ef ff ff       	call   800f31 <fd2num>
+  801f68:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801f6b:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  801f6e:	83 c4 10             	add    $0x10,%esp
+  801f71:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f76:	eb 2e                	jmp    801fa6 <pipe+0x141>
+	sys_page_unmap(0, va);
+  801f78:	83 ec 08             	sub    $0x8,%esp
+  801f7b:	56                   	push   %esi
+  801f7c:	6a 00                	push   $0x0
+  801f7e:	e8 60 ed ff ff       	call   800ce3 <sys_page_unmap>
+  801f83:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  801f86:	83 ec 08             	sub    $0x8,%esp
+  801f89:	ff 75 f0             	push   -0x10(%ebp)
+  801f8c:	6a 00                	push   $0x0
+  801f8e:	e8 50 ed ff ff       	call   800ce3 <sys_page_unmap>
+  801f93:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  801f96:	83 ec 08             	sub    $0x8,%esp
+  801f99:	ff 75 f4             	push   -0xc(%ebp)
+  801f9c:	6a 00                	push   $0x0
+  801f9e:	e8 40 ed ff ff       	call   800ce3 <sys_page_unmap>
+  801fa3:	83 c4 10             	add    $0x10,%esp
+}
+  801fa6:	89 d8                	mov    %ebx,%eax
+  801fa8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fab:	5b                   	pop    %ebx
+  801fac:	5e                   	pop    %esi
+  801fad:	5d                   	pop    %ebp
+  801fae:	c3                   	ret
+
+00801faf <pipeisclosed>:
+{
+  801faf:	55                   	push   %ebp
+  801fb0:	89 e5                	mov    %esp,%ebp
+  801fb2:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801fb5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fb8:	50                   	push   %eax
+  801fb9:	ff 75 08             	push   0x8(%ebp)
+  801fbc:	e8 ed ef ff ff       	call   800fae <fd_lookup>
+  801fc1:	83 c4 10             	add    $0x10,%esp
+  801fc4:	85 c0                	test   %eax,%eax
+  801fc6:	78 18                	js     801fe0 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  801fc8:	83 ec 0c             	sub    $0xc,%esp
+  801fcb:	ff 75 f4             	push   -0xc(%ebp)
+  801fce:	e8 6e ef ff ff       	call   800f41 <fd2data>
+  801fd3:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  801fd5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801fd8:	e8 33 fd ff ff       	call   801d10 <_pipeisclosed>
+  801fdd:	83 c4 10             	add    $0x10,%esp
+}
+  801fe0:	c9                   	leave
+  801fe1:	c3                   	ret
+
+00801fe2 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  801fe2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fe7:	c3                   	ret
+
+00801fe8 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  801fe8:	55                   	push   %ebp
+  801fe9:	89 e5                	mov    %esp,%ebp
+  801feb:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  801fee:	68 0b 2c 80 00       	push   $0x802c0b
+  801ff3:	ff 75 0c             	push   0xc(%ebp)
+  801ff6:	e8 77 e8 ff ff       	call   800872 <strcpy>
+	return 0;
+}
+  801ffb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802000:	c9                   	leave
+  802001:	c3                   	ret
+
+00802002 <devcons_write>:
+{
+  802002:	55                   	push   %ebp
+  802003:	89 e5                	mov    %esp,%ebp
+  802005:	57                   	push   %edi
+  802006:	56                   	push   %esi
+  802007:	53                   	push   %ebx
+  802008:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80200e:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802013:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802019:	eb 2e                	jmp    802049 <devcons_write+0x47>
+		m = n - tot;
+  80201b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80201e:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802020:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802025:	39 c3                	cmp    %eax,%ebx
+  802027:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80202a:	83 ec 04             	sub    $0x4,%esp
+  80202d:	53                   	push   %ebx
+  80202e:	89 f0                	mov    %esi,%eax
+  802030:	03 45 0c             	add    0xc(%ebp),%eax
+  802033:	50                   	push   %eax
+  802034:	57                   	push   %edi
+  802035:	e8 be e9 ff ff       	call   8009f8 <memmove>
+		sys_cputs(buf, m);
+  80203a:	83 c4 08             	add    $0x8,%esp
+  80203d:	53                   	push   %ebx
+  80203e:	57                   	push   %edi
+  80203f:	e8 5e eb ff ff       	call   800ba2 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802044:	01 de                	add    %ebx,%esi
+  802046:	83 c4 10             	add    $0x10,%esp
+  802049:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80204c:	72 cd                	jb     80201b <devcons_write+0x19>
+}
+  80204e:	89 f0                	mov    %esi,%eax
+  802050:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802053:	5b                   	pop    %ebx
+  802054:	5e                   	pop    %esi
+  802055:	5f                   	pop    %edi
+  802056:	5d                   	pop    %ebp
+  802057:	c3                   	ret
+
+00802058 <devcons_read>:
+{
+  802058:	55                   	push   %ebp
+  802059:	89 e5                	mov    %esp,%ebp
+  80205b:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80205e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802063:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802067:	75 07                	jne    802070 <devcons_read+0x18>
+  802069:	eb 1f                	jmp    80208a <devcons_read+0x32>
+		sys_yield();
+  80206b:	e8 cf eb ff ff       	call   800c3f <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802070:	e8 4b eb ff ff       	call   800bc0 <sys_cgetc>
+  802075:	85 c0                	test   %eax,%eax
+  802077:	74 f2                	je     80206b <devcons_read+0x13>
+	if (c < 0)
+  802079:	78 0f                	js     80208a <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80207b:	83 f8 04             	cmp    $0x4,%eax
+  80207e:	74 0c                	je     80208c <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802080:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802083:	88 02                	mov    %al,(%edx)
+	return 1;
+  802085:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80208a:	c9                   	leave
+  80208b:	c3                   	ret
+		return 0;
+  80208c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802091:	eb f7                	jmp    80208a <devcons_read+0x32>
+
+00802093 <cputchar>:
+{
+  802093:	55                   	push   %ebp
+  802094:	89 e5                	mov    %esp,%ebp
+  802096:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802099:	8b 45 08             	mov    0x8(%ebp),%eax
+  80209c:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80209f:	6a 01                	push   $0x1
+  8020a1:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8020a4:	50                   	push   %eax
+  8020a5:	e8 f8 ea ff ff       	call   800ba2 <sys_cputs>
+}
+  8020aa:	83 c4 10             	add    $0x10,%esp
+  8020ad:	c9                   	leave
+  8020ae:	c3                   	ret
+
+008020af <getchar>:
+{
+  8020af:	55                   	push   %ebp
+  8020b0:	89 e5                	mov    %esp,%ebp
+  8020b2:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8020b5:	6a 01                	push   $0x1
+  8020b7:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8020ba:	50                   	push   %eax
+  8020bb:	6a 00                	push   $0x0
+  8020bd:	e8 52 f1 ff ff       	call   801214 <read>
+	if (r < 0)
+  8020c2:	83 c4 10             	add    $0x10,%esp
+  8020c5:	85 c0                	test   %eax,%eax
+  8020c7:	78 06                	js     8020cf <getchar+0x20>
+	if (r < 1)
+  8020c9:	74 06                	je     8020d1 <getchar+0x22>
+	return c;
+  8020cb:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8020cf:	c9                   	leave
+  8020d0:	c3                   	ret
+		return -E_EOF;
+  8020d1:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8020d6:	eb f7                	jmp    8020cf <getchar+0x20>
+
+008020d8 <iscons>:
+{
+  8020d8:	55                   	push   %ebp
+  8020d9:	89 e5                	mov    %esp,%ebp
+  8020db:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8020de:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020e1:	50                   	push   %eax
+  8020e2:	ff 75 08             	push   0x8(%ebp)
+  8020e5:	e8 c4 ee ff ff       	call   800fae <fd_lookup>
+  8020ea:	83 c4 10             	add    $0x10,%esp
+  8020ed:	85 c0                	test   %eax,%eax
+  8020ef:	78 11                	js     802102 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8020f1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020f4:	8b 15 5c 30 80 00    	mov    0x80305c,%edx
+  8020fa:	39 10                	cmp    %edx,(%eax)
+  8020fc:	0f 94 c0             	sete   %al
+  8020ff:	0f b6 c0             	movzbl %al,%eax
+}
+  802102:	c9                   	leave
+  802103:	c3                   	ret
+
+00802104 <opencons>:
+{
+  802104:	55                   	push   %ebp
+  802105:	89 e5                	mov    %esp,%ebp
+  802107:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80210a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80210d:	50                   	push   %eax
+  80210e:	e8 45 ee ff ff       	call   800f58 <fd_alloc>
+  802113:	83 c4 10             	add    $0x10,%esp
+  802116:	85 c0                	test   %eax,%eax
+  802118:	78 3a                	js     802154 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80211a:	83 ec 04             	sub    $0x4,%esp
+  80211d:	68 07 04 00 00       	push   $0x407
+  802122:	ff 75 f4             	push   -0xc(%ebp)
+  802125:	6a 00                	push   $0x0
+  802127:	e8 32 eb ff ff       	call   800c5e <sys_page_alloc>
+  80212c:	83 c4 10             	add    $0x10,%esp
+  80212f:	85 c0                	test   %eax,%eax
+  802131:	78 21                	js     802154 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802133:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802136:	8b 15 5c 30 80 00    	mov    0x80305c,%edx
+  80213c:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80213e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802141:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802148:	83 ec 0c             	sub    $0xc,%esp
+  80214b:	50                   	push   %eax
+  80214c:	e8 e0 ed ff ff       	call   800f31 <fd2num>
+  802151:	83 c4 10             	add    $0x10,%esp
+}
+  802154:	c9                   	leave
+  802155:	c3                   	ret
+
+00802156 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  802156:	55                   	push   %ebp
+  802157:	89 e5                	mov    %esp,%ebp
+  802159:	56                   	push   %esi
+  80215a:	53                   	push   %ebx
+  80215b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80215e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802161:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  802164:	85 c0                	test   %eax,%eax
+  802166:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80216b:	0f 44 c2             	cmove  %edx,%eax
+  80216e:	83 ec 0c             	sub    $0xc,%esp
+  802171:	50                   	push   %eax
+  802172:	e8 97 ec ff ff       	call   800e0e <sys_ipc_recv>
+
+  if (from_env_store)
+  802177:	83 c4 10             	add    $0x10,%esp
+  80217a:	85 f6                	test   %esi,%esi
+  80217c:	74 17                	je     802195 <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  80217e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802183:	85 c0                	test   %eax,%eax
+  802185:	75 0c                	jne    802193 <ipc_recv+0x3d>
+  802187:	8b 15 0c 40 80 00    	mov    0x80400c,%edx
+  80218d:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  802193:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  802195:	85 db                	test   %ebx,%ebx
+  802197:	74 2b                	je     8021c4 <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  802199:	85 c0                	test   %eax,%eax
+  80219b:	74 0d                	je     8021aa <ipc_recv+0x54>
+  80219d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  8021a3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021a6:	5b                   	pop    %ebx
+  8021a7:	5e                   	pop    %esi
+  8021a8:	5d                   	pop    %ebp
+  8021a9:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  8021aa:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  8021af:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8021b5:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  8021b7:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  8021bc:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  8021c2:	eb df                	jmp    8021a3 <ipc_recv+0x4d>
+  8021c4:	85 c0                	test   %eax,%eax
+  8021c6:	75 db                	jne    8021a3 <ipc_recv+0x4d>
+  8021c8:	eb ed                	jmp    8021b7 <ipc_recv+0x61>
+
+008021ca <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  8021ca:	55                   	push   %ebp
+  8021cb:	89 e5                	mov    %esp,%ebp
+  8021cd:	57                   	push   %edi
+  8021ce:	56                   	push   %esi
+  8021cf:	53                   	push   %ebx
+  8021d0:	83 ec 0c             	sub    $0xc,%esp
+  8021d3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8021d6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8021d9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  8021dc:	85 db                	test   %ebx,%ebx
+  8021de:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8021e3:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  8021e6:	ff 75 14             	push   0x14(%ebp)
+  8021e9:	53                   	push   %ebx
+  8021ea:	56                   	push   %esi
+  8021eb:	57                   	push   %edi
+  8021ec:	e8 fa eb ff ff       	call   800deb <sys_ipc_try_send>
+  8021f1:	83 c4 10             	add    $0x10,%esp
+  8021f4:	85 c0                	test   %eax,%eax
+  8021f6:	74 1e                	je     802216 <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  8021f8:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8021fb:	75 07                	jne    802204 <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  8021fd:	e8 3d ea ff ff       	call   800c3f <sys_yield>
+  802202:	eb e2                	jmp    8021e6 <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  802204:	50                   	push   %eax
+  802205:	68 17 2c 80 00       	push   $0x802c17
+  80220a:	6a 3c                	push   $0x3c
+  80220c:	68 24 2c 80 00       	push   $0x802c24
+  802211:	e8 c8 df ff ff       	call   8001de <_panic>
+  }
+
+#endif
+}
+  802216:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802219:	5b                   	pop    %ebx
+  80221a:	5e                   	pop    %esi
+  80221b:	5f                   	pop    %edi
+  80221c:	5d                   	pop    %ebp
+  80221d:	c3                   	ret
+
+0080221e <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  80221e:	55                   	push   %ebp
+  80221f:	89 e5                	mov    %esp,%ebp
+  802221:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  802224:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  802229:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80222c:	c1 e0 04             	shl    $0x4,%eax
+  80222f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802234:	8b 40 50             	mov    0x50(%eax),%eax
+  802237:	39 c8                	cmp    %ecx,%eax
+  802239:	74 12                	je     80224d <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  80223b:	83 c2 01             	add    $0x1,%edx
+  80223e:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802244:	75 e3                	jne    802229 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802246:	b8 00 00 00 00       	mov    $0x0,%eax
+  80224b:	eb 0e                	jmp    80225b <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  80224d:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802250:	c1 e0 04             	shl    $0x4,%eax
+  802253:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802258:	8b 40 48             	mov    0x48(%eax),%eax
+  80225b:	5d                   	pop    %ebp
+  80225c:	c3                   	ret
+
+0080225d <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80225d:	55                   	push   %ebp
+  80225e:	89 e5                	mov    %esp,%ebp
+  802260:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802263:	89 c2                	mov    %eax,%edx
+  802265:	c1 ea 16             	shr    $0x16,%edx
+  802268:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80226f:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802274:	f6 c1 01             	test   $0x1,%cl
+  802277:	74 1c                	je     802295 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  802279:	c1 e8 0c             	shr    $0xc,%eax
+  80227c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802283:	a8 01                	test   $0x1,%al
+  802285:	74 0e                	je     802295 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802287:	c1 e8 0c             	shr    $0xc,%eax
+  80228a:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802291:	ef 
+  802292:	0f b7 d2             	movzwl %dx,%edx
+}
+  802295:	89 d0                	mov    %edx,%eax
+  802297:	5d                   	pop    %ebp
+  802298:	c3                   	ret
+  802299:	66 90                	xchg   %ax,%ax
+  80229b:	66 90                	xchg   %ax,%ax
+  80229d:	66 90                	xchg   %ax,%ax
+  80229f:	90                   	nop
+
+008022a0 <__udivmoddi4>:
+  8022a0:	55                   	push   %ebp
+  8022a1:	57                   	push   %edi
+  8022a2:	56                   	push   %esi
+  8022a3:	53                   	push   %ebx
+  8022a4:	83 ec 24             	sub    $0x24,%esp
+  8022a7:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8022ab:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8022af:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  8022b3:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8022b7:	8b 54 24 44          	mov    0x44(%esp),%edx
+  8022bb:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8022bf:	8b 44 24 40          	mov    0x40(%esp),%eax
+  8022c3:	89 d3                	mov    %edx,%ebx
+  8022c5:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8022c9:	09 c3                	or     %eax,%ebx
+  8022cb:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8022cf:	0f 84 9c 00 00 00    	je     802371 <__udivmoddi4+0xd1>
+  8022d5:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8022dc:	00 
+  8022dd:	31 c0                	xor    %eax,%eax
+  8022df:	31 d2                	xor    %edx,%edx
+  8022e1:	89 fb                	mov    %edi,%ebx
+  8022e3:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8022ea:	00 
+  8022eb:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8022f0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8022f4:	01 c0                	add    %eax,%eax
+  8022f6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8022fd:	00 
+  8022fe:	89 c6                	mov    %eax,%esi
+  802300:	89 d7                	mov    %edx,%edi
+  802302:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802306:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80230a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80230d:	d3 ea                	shr    %cl,%edx
+  80230f:	f6 c1 20             	test   $0x20,%cl
+  802312:	0f 45 c2             	cmovne %edx,%eax
+  802315:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802319:	83 e0 01             	and    $0x1,%eax
+  80231c:	09 fa                	or     %edi,%edx
+  80231e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802322:	89 04 24             	mov    %eax,(%esp)
+  802325:	8b 04 24             	mov    (%esp),%eax
+  802328:	89 d5                	mov    %edx,%ebp
+  80232a:	09 f0                	or     %esi,%eax
+  80232c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802330:	39 f0                	cmp    %esi,%eax
+  802332:	19 fd                	sbb    %edi,%ebp
+  802334:	72 1d                	jb     802353 <__udivmoddi4+0xb3>
+  802336:	29 f0                	sub    %esi,%eax
+  802338:	19 fa                	sbb    %edi,%edx
+  80233a:	89 cf                	mov    %ecx,%edi
+  80233c:	c1 ef 05             	shr    $0x5,%edi
+  80233f:	83 e7 01             	and    $0x1,%edi
+  802342:	89 fe                	mov    %edi,%esi
+  802344:	d3 e7                	shl    %cl,%edi
+  802346:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80234a:	83 f6 01             	xor    $0x1,%esi
+  80234d:	d3 e6                	shl    %cl,%esi
+  80234f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802353:	83 e9 01             	sub    $0x1,%ecx
+  802356:	73 98                	jae    8022f0 <__udivmoddi4+0x50>
+  802358:	85 db                	test   %ebx,%ebx
+  80235a:	74 05                	je     802361 <__udivmoddi4+0xc1>
+  80235c:	89 03                	mov    %eax,(%ebx)
+  80235e:	89 53 04             	mov    %edx,0x4(%ebx)
+  802361:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802365:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802369:	83 c4 24             	add    $0x24,%esp
+  80236c:	5b                   	pop    %ebx
+  80236d:	5e                   	pop    %esi
+  80236e:	5f                   	pop    %edi
+  80236f:	5d                   	pop    %ebp
+  802370:	c3                   	ret
+  802371:	85 ff                	test   %edi,%edi
+  802373:	74 0d                	je     802382 <__udivmoddi4+0xe2>
+  802375:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  80237b:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  802382:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802386:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80238a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80238e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802392:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802396:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80239a:	83 c4 24             	add    $0x24,%esp
+  80239d:	5b                   	pop    %ebx
+  80239e:	5e                   	pop    %esi
+  80239f:	5f                   	pop    %edi
+  8023a0:	5d                   	pop    %ebp
+  8023a1:	c3                   	ret
+  8023a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8023a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+008023b0 <__udivdi3>:
+  8023b0:	57                   	push   %edi
+  8023b1:	56                   	push   %esi
+  8023b2:	53                   	push   %ebx
+  8023b3:	83 ec 20             	sub    $0x20,%esp
+  8023b6:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8023ba:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8023be:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8023c2:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8023c6:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8023ca:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8023ce:	89 d1                	mov    %edx,%ecx
+  8023d0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8023d4:	09 c1                	or     %eax,%ecx
+  8023d6:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8023da:	89 44 24 18          	mov    %eax,0x18(%esp)
+  8023de:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  8023e2:	0f 84 88 00 00 00    	je     802470 <__udivdi3+0xc0>
+  8023e8:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8023ef:	00 
+  8023f0:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8023f5:	31 c0                	xor    %eax,%eax
+  8023f7:	31 d2                	xor    %edx,%edx
+  8023f9:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802400:	00 
+  802401:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802408:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80240c:	01 c0                	add    %eax,%eax
+  80240e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802415:	00 
+  802416:	89 c6                	mov    %eax,%esi
+  802418:	89 d7                	mov    %edx,%edi
+  80241a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80241e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802422:	0f ad d0             	shrd   %cl,%edx,%eax
+  802425:	d3 ea                	shr    %cl,%edx
+  802427:	f6 c1 20             	test   $0x20,%cl
+  80242a:	0f 45 c2             	cmovne %edx,%eax
+  80242d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802431:	83 e0 01             	and    $0x1,%eax
+  802434:	09 fa                	or     %edi,%edx
+  802436:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80243a:	89 04 24             	mov    %eax,(%esp)
+  80243d:	8b 04 24             	mov    (%esp),%eax
+  802440:	89 d3                	mov    %edx,%ebx
+  802442:	09 f0                	or     %esi,%eax
+  802444:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802448:	39 f0                	cmp    %esi,%eax
+  80244a:	19 fb                	sbb    %edi,%ebx
+  80244c:	72 1d                	jb     80246b <__udivdi3+0xbb>
+  80244e:	29 f0                	sub    %esi,%eax
+  802450:	19 fa                	sbb    %edi,%edx
+  802452:	89 cf                	mov    %ecx,%edi
+  802454:	c1 ef 05             	shr    $0x5,%edi
+  802457:	83 e7 01             	and    $0x1,%edi
+  80245a:	89 fe                	mov    %edi,%esi
+  80245c:	d3 e7                	shl    %cl,%edi
+  80245e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802462:	83 f6 01             	xor    $0x1,%esi
+  802465:	d3 e6                	shl    %cl,%esi
+  802467:	09 74 24 18          	or     %esi,0x18(%esp)
+  80246b:	83 e9 01             	sub    $0x1,%ecx
+  80246e:	73 98                	jae    802408 <__udivdi3+0x58>
+  802470:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802474:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802478:	83 c4 20             	add    $0x20,%esp
+  80247b:	5b                   	pop    %ebx
+  80247c:	5e                   	pop    %esi
+  80247d:	5f                   	pop    %edi
+  80247e:	c3                   	ret
+  80247f:	90                   	nop
+
+00802480 <__umoddi3>:
+  802480:	57                   	push   %edi
+  802481:	56                   	push   %esi
+  802482:	53                   	push   %ebx
+  802483:	83 ec 18             	sub    $0x18,%esp
+  802486:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80248a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80248e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802492:	8b 54 24 34          	mov    0x34(%esp),%edx
+  802496:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80249a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80249e:	89 d1                	mov    %edx,%ecx
+  8024a0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8024a4:	09 c1                	or     %eax,%ecx
+  8024a6:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8024aa:	74 5b                	je     802507 <__umoddi3+0x87>
+  8024ac:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8024b1:	31 c0                	xor    %eax,%eax
+  8024b3:	31 d2                	xor    %edx,%edx
+  8024b5:	8d 76 00             	lea    0x0(%esi),%esi
+  8024b8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8024bc:	01 c0                	add    %eax,%eax
+  8024be:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8024c5:	00 
+  8024c6:	89 c6                	mov    %eax,%esi
+  8024c8:	89 d7                	mov    %edx,%edi
+  8024ca:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8024ce:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8024d2:	0f ad d0             	shrd   %cl,%edx,%eax
+  8024d5:	d3 ea                	shr    %cl,%edx
+  8024d7:	f6 c1 20             	test   $0x20,%cl
+  8024da:	0f 45 c2             	cmovne %edx,%eax
+  8024dd:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8024e1:	83 e0 01             	and    $0x1,%eax
+  8024e4:	09 fa                	or     %edi,%edx
+  8024e6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8024ea:	89 04 24             	mov    %eax,(%esp)
+  8024ed:	8b 04 24             	mov    (%esp),%eax
+  8024f0:	89 d3                	mov    %edx,%ebx
+  8024f2:	09 f0                	or     %esi,%eax
+  8024f4:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8024f8:	39 f0                	cmp    %esi,%eax
+  8024fa:	19 fb                	sbb    %edi,%ebx
+  8024fc:	72 04                	jb     802502 <__umoddi3+0x82>
+  8024fe:	29 f0                	sub    %esi,%eax
+  802500:	19 fa                	sbb    %edi,%edx
+  802502:	83 e9 01             	sub    $0x1,%ecx
+  802505:	73 b1                	jae    8024b8 <__umoddi3+0x38>
+  802507:	83 c4 18             	add    $0x18,%esp
+  80250a:	5b                   	pop    %ebx
+  80250b:	5e                   	pop    %esi
+  80250c:	5f                   	pop    %edi
+  80250d:	c3                   	ret
+  80250e:	66 90                	xchg   %ax,%ax
+
+00802510 <__divdi3>:
+  802510:	55                   	push   %ebp
+  802511:	57                   	push   %edi
+  802512:	56                   	push   %esi
+  802513:	53                   	push   %ebx
+  802514:	83 ec 24             	sub    $0x24,%esp
+  802517:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  80251b:	8b 74 24 44          	mov    0x44(%esp),%esi
+  80251f:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802523:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802527:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  80252b:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  80252f:	85 d2                	test   %edx,%edx
+  802531:	0f 88 e0 00 00 00    	js     802617 <__divdi3+0x107>
+  802537:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  80253b:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  80253f:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802543:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802547:	85 f6                	test   %esi,%esi
+  802549:	78 16                	js     802561 <__divdi3+0x51>
+  80254b:	89 f1                	mov    %esi,%ecx
+  80254d:	31 c0                	xor    %eax,%eax
+  80254f:	31 d2                	xor    %edx,%edx
+  802551:	09 d9                	or     %ebx,%ecx
+  802553:	0f 85 f3 00 00 00    	jne    80264c <__divdi3+0x13c>
+  802559:	83 c4 24             	add    $0x24,%esp
+  80255c:	5b                   	pop    %ebx
+  80255d:	5e                   	pop    %esi
+  80255e:	5f                   	pop    %edi
+  80255f:	5d                   	pop    %ebp
+  802560:	c3                   	ret
+  802561:	bf 01 00 00 00       	mov    $0x1,%edi
+  802566:	f7 5c 24 08          	negl   0x8(%esp)
+  80256a:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  80256f:	f7 5c 24 0c          	negl   0xc(%esp)
+  802573:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80257a:	00 
+  80257b:	31 c0                	xor    %eax,%eax
+  80257d:	31 d2                	xor    %edx,%edx
+  80257f:	89 fb                	mov    %edi,%ebx
+  802581:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802588:	00 
+  802589:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80258e:	66 90                	xchg   %ax,%ax
+  802590:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802594:	01 c0                	add    %eax,%eax
+  802596:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80259d:	00 
+  80259e:	89 c6                	mov    %eax,%esi
+  8025a0:	89 d7                	mov    %edx,%edi
+  8025a2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8025a6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8025aa:	0f ad d0             	shrd   %cl,%edx,%eax
+  8025ad:	d3 ea                	shr    %cl,%edx
+  8025af:	f6 c1 20             	test   $0x20,%cl
+  8025b2:	0f 45 c2             	cmovne %edx,%eax
+  8025b5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8025b9:	83 e0 01             	and    $0x1,%eax
+  8025bc:	09 fa                	or     %edi,%edx
+  8025be:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8025c2:	89 04 24             	mov    %eax,(%esp)
+  8025c5:	8b 04 24             	mov    (%esp),%eax
+  8025c8:	89 d5                	mov    %edx,%ebp
+  8025ca:	09 f0                	or     %esi,%eax
+  8025cc:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8025d0:	39 f0                	cmp    %esi,%eax
+  8025d2:	19 fd                	sbb    %edi,%ebp
+  8025d4:	72 1d                	jb     8025f3 <__divdi3+0xe3>
+  8025d6:	29 f0                	sub    %esi,%eax
+  8025d8:	19 fa                	sbb    %edi,%edx
+  8025da:	89 cf                	mov    %ecx,%edi
+  8025dc:	c1 ef 05             	shr    $0x5,%edi
+  8025df:	83 e7 01             	and    $0x1,%edi
+  8025e2:	89 fe                	mov    %edi,%esi
+  8025e4:	d3 e7                	shl    %cl,%edi
+  8025e6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8025ea:	83 f6 01             	xor    $0x1,%esi
+  8025ed:	d3 e6                	shl    %cl,%esi
+  8025ef:	09 74 24 18          	or     %esi,0x18(%esp)
+  8025f3:	83 e9 01             	sub    $0x1,%ecx
+  8025f6:	73 98                	jae    802590 <__divdi3+0x80>
+  8025f8:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8025fc:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802600:	85 db                	test   %ebx,%ebx
+  802602:	0f 84 51 ff ff ff    	je     802559 <__divdi3+0x49>
+  802608:	f7 d8                	neg    %eax
+  80260a:	83 d2 00             	adc    $0x0,%edx
+  80260d:	83 c4 24             	add    $0x24,%esp
+  802610:	5b                   	pop    %ebx
+  802611:	f7 da                	neg    %edx
+  802613:	5e                   	pop    %esi
+  802614:	5f                   	pop    %edi
+  802615:	5d                   	pop    %ebp
+  802616:	c3                   	ret
+  802617:	f7 d8                	neg    %eax
+  802619:	83 d2 00             	adc    $0x0,%edx
+  80261c:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802620:	f7 da                	neg    %edx
+  802622:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802626:	85 f6                	test   %esi,%esi
+  802628:	78 1b                	js     802645 <__divdi3+0x135>
+  80262a:	89 f1                	mov    %esi,%ecx
+  80262c:	31 c0                	xor    %eax,%eax
+  80262e:	31 d2                	xor    %edx,%edx
+  802630:	bf 01 00 00 00       	mov    $0x1,%edi
+  802635:	09 d9                	or     %ebx,%ecx
+  802637:	0f 85 36 ff ff ff    	jne    802573 <__divdi3+0x63>
+  80263d:	83 c4 24             	add    $0x24,%esp
+  802640:	5b                   	pop    %ebx
+  802641:	5e                   	pop    %esi
+  802642:	5f                   	pop    %edi
+  802643:	5d                   	pop    %ebp
+  802644:	c3                   	ret
+  802645:	31 ff                	xor    %edi,%edi
+  802647:	e9 1a ff ff ff       	jmp    802566 <__divdi3+0x56>
+  80264c:	31 ff                	xor    %edi,%edi
+  80264e:	e9 20 ff ff ff       	jmp    802573 <__divdi3+0x63>
+  802653:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80265a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00802660 <__moddi3>:
+  802660:	55                   	push   %ebp
+  802661:	57                   	push   %edi
+  802662:	56                   	push   %esi
+  802663:	53                   	push   %ebx
+  802664:	83 ec 1c             	sub    $0x1c,%esp
+  802667:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  80266b:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  80266f:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  802673:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  802677:	89 c8                	mov    %ecx,%eax
+  802679:	89 f2                	mov    %esi,%edx
+  80267b:	89 f3                	mov    %esi,%ebx
+  80267d:	85 ed                	test   %ebp,%ebp
+  80267f:	0f 88 9d 00 00 00    	js     802722 <__moddi3+0xc2>
+  802685:	09 cb                	or     %ecx,%ebx
+  802687:	0f 84 8d 00 00 00    	je     80271a <__moddi3+0xba>
+  80268d:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802691:	31 db                	xor    %ebx,%ebx
+  802693:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802697:	89 ca                	mov    %ecx,%edx
+  802699:	89 f0                	mov    %esi,%eax
+  80269b:	89 dd                	mov    %ebx,%ebp
+  80269d:	f7 da                	neg    %edx
+  80269f:	83 d0 00             	adc    $0x0,%eax
+  8026a2:	f7 d8                	neg    %eax
+  8026a4:	0f 49 f0             	cmovns %eax,%esi
+  8026a7:	0f 49 ca             	cmovns %edx,%ecx
+  8026aa:	31 c0                	xor    %eax,%eax
+  8026ac:	31 d2                	xor    %edx,%edx
+  8026ae:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8026b2:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  8026b6:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8026bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  8026bf:	90                   	nop
+  8026c0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8026c4:	01 c0                	add    %eax,%eax
+  8026c6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8026cd:	00 
+  8026ce:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  8026d2:	89 c6                	mov    %eax,%esi
+  8026d4:	89 d7                	mov    %edx,%edi
+  8026d6:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8026da:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8026de:	0f ad d0             	shrd   %cl,%edx,%eax
+  8026e1:	d3 ea                	shr    %cl,%edx
+  8026e3:	f6 c1 20             	test   $0x20,%cl
+  8026e6:	0f 45 c2             	cmovne %edx,%eax
+  8026e9:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8026ed:	83 e0 01             	and    $0x1,%eax
+  8026f0:	09 fa                	or     %edi,%edx
+  8026f2:	89 04 24             	mov    %eax,(%esp)
+  8026f5:	8b 04 24             	mov    (%esp),%eax
+  8026f8:	89 d7                	mov    %edx,%edi
+  8026fa:	09 f0                	or     %esi,%eax
+  8026fc:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  802700:	39 d8                	cmp    %ebx,%eax
+  802702:	19 f7                	sbb    %esi,%edi
+  802704:	72 04                	jb     80270a <__moddi3+0xaa>
+  802706:	29 d8                	sub    %ebx,%eax
+  802708:	19 f2                	sbb    %esi,%edx
+  80270a:	83 e9 01             	sub    $0x1,%ecx
+  80270d:	73 b1                	jae    8026c0 <__moddi3+0x60>
+  80270f:	85 ed                	test   %ebp,%ebp
+  802711:	74 07                	je     80271a <__moddi3+0xba>
+  802713:	f7 d8                	neg    %eax
+  802715:	83 d2 00             	adc    $0x0,%edx
+  802718:	f7 da                	neg    %edx
+  80271a:	83 c4 1c             	add    $0x1c,%esp
+  80271d:	5b                   	pop    %ebx
+  80271e:	5e                   	pop    %esi
+  80271f:	5f                   	pop    %edi
+  802720:	5d                   	pop    %ebp
+  802721:	c3                   	ret
+  802722:	09 cb                	or     %ecx,%ebx
+  802724:	74 f4                	je     80271a <__moddi3+0xba>
+  802726:	f7 df                	neg    %edi
+  802728:	bb 01 00 00 00       	mov    $0x1,%ebx
+  80272d:	83 d5 00             	adc    $0x0,%ebp
+  802730:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802734:	f7 dd                	neg    %ebp
+  802736:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  80273a:	e9 58 ff ff ff       	jmp    802697 <__moddi3+0x37>
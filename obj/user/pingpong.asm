@@ -0,0 +1,5772 @@
+
+obj/user/pingpong.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 8f 00 00 00       	call   8000c0 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 1c             	sub    $0x1c,%esp
+	envid_t who;
+
+	if ((who = fork()) != 0) {
+  80003c:	e8 ea 0e 00 00       	call   800f2b <fork>
+  800041:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800044:	85 c0                	test   %eax,%eax
+  800046:	75 4f                	jne    800097 <umain+0x64>
+		cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+		ipc_send(who, 0, 0, 0);
+	}
+
+	while (1) {
+		uint32_t i = ipc_recv(&who, 0, 0);
+  800048:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  80004b:	83 ec 04             	sub    $0x4,%esp
+  80004e:	6a 00                	push   $0x0
+  800050:	6a 00                	push   $0x0
+  800052:	56                   	push   %esi
+  800053:	e8 ef 10 00 00       	call   801147 <ipc_recv>
+  800058:	89 c3                	mov    %eax,%ebx
+		cprintf("%x got %d from %x\n", sys_getenvid(), i, who);
+  80005a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80005d:	e8 bd 0a 00 00       	call   800b1f <sys_getenvid>
+  800062:	57                   	push   %edi
+  800063:	53                   	push   %ebx
+  800064:	50                   	push   %eax
+  800065:	68 36 29 80 00       	push   $0x802936
+  80006a:	e8 49 01 00 00       	call   8001b8 <cprintf>
+		if (i == 10)
+  80006f:	83 c4 20             	add    $0x20,%esp
+  800072:	83 fb 0a             	cmp    $0xa,%ebx
+  800075:	74 18                	je     80008f <umain+0x5c>
+			return;
+		i++;
+  800077:	83 c3 01             	add    $0x1,%ebx
+		ipc_send(who, i, 0, 0);
+  80007a:	6a 00                	push   $0x0
+  80007c:	6a 00                	push   $0x0
+  80007e:	53                   	push   %ebx
+  80007f:	ff 75 e4             	push   -0x1c(%ebp)
+  800082:	e8 34 11 00 00       	call   8011bb <ipc_send>
+		if (i == 10)
+  800087:	83 c4 10             	add    $0x10,%esp
+  80008a:	83 fb 0a             	cmp    $0xa,%ebx
+  80008d:	75 bc                	jne    80004b <umain+0x18>
+			return;
+	}
+
+}
+  80008f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800092:	5b                   	pop    %ebx
+  800093:	5e                   	pop    %esi
+  800094:	5f                   	pop    %edi
+  800095:	5d                   	pop    %ebp
+  800096:	c3                   	ret
+  800097:	89 c3                	mov    %eax,%ebx
+		cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+  800099:	e8 81 0a 00 00       	call   800b1f <sys_getenvid>
+  80009e:	83 ec 04             	sub    $0x4,%esp
+  8000a1:	53                   	push   %ebx
+  8000a2:	50                   	push   %eax
+  8000a3:	68 20 29 80 00       	push   $0x802920
+  8000a8:	e8 0b 01 00 00       	call   8001b8 <cprintf>
+		ipc_send(who, 0, 0, 0);
+  8000ad:	6a 00                	push   $0x0
+  8000af:	6a 00                	push   $0x0
+  8000b1:	6a 00                	push   $0x0
+  8000b3:	ff 75 e4             	push   -0x1c(%ebp)
+  8000b6:	e8 00 11 00 00       	call   8011bb <ipc_send>
+  8000bb:	83 c4 20             	add    $0x20,%esp
+  8000be:	eb 88                	jmp    800048 <umain+0x15>
+
+008000c0 <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  8000c0:	55                   	push   %ebp
+  8000c1:	89 e5                	mov    %esp,%ebp
+  8000c3:	56                   	push   %esi
+  8000c4:	53                   	push   %ebx
+  8000c5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000c8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  8000cb:	e8 4f 0a 00 00       	call   800b1f <sys_getenvid>
+  8000d0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000d5:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8000d8:	c1 e0 04             	shl    $0x4,%eax
+  8000db:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000e0:	a3 08 40 80 00       	mov    %eax,0x804008
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8000e5:	85 db                	test   %ebx,%ebx
+  8000e7:	7e 07                	jle    8000f0 <libmain+0x30>
+    binaryname = argv[0];
+  8000e9:	8b 06                	mov    (%esi),%eax
+  8000eb:	a3 00 30 80 00       	mov    %eax,0x803000
+
+  // call user main routine
+  umain(argc, argv);
+  8000f0:	83 ec 08             	sub    $0x8,%esp
+  8000f3:	56                   	push   %esi
+  8000f4:	53                   	push   %ebx
+  8000f5:	e8 39 ff ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  8000fa:	e8 0a 00 00 00       	call   800109 <exit>
+}
+  8000ff:	83 c4 10             	add    $0x10,%esp
+  800102:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800105:	5b                   	pop    %ebx
+  800106:	5e                   	pop    %esi
+  800107:	5d                   	pop    %ebp
+  800108:	c3                   	ret
+
+00800109 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800109:	55                   	push   %ebp
+  80010a:	89 e5                	mov    %esp,%ebp
+  80010c:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80010f:	e8 0e 13 00 00       	call   801422 <close_all>
+	sys_env_destroy(0);
+  800114:	83 ec 0c             	sub    $0xc,%esp
+  800117:	6a 00                	push   $0x0
+  800119:	e8 c0 09 00 00       	call   800ade <sys_env_destroy>
+}
+  80011e:	83 c4 10             	add    $0x10,%esp
+  800121:	c9                   	leave
+  800122:	c3                   	ret
+
+00800123 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800123:	55                   	push   %ebp
+  800124:	89 e5                	mov    %esp,%ebp
+  800126:	53                   	push   %ebx
+  800127:	83 ec 04             	sub    $0x4,%esp
+  80012a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80012d:	8b 13                	mov    (%ebx),%edx
+  80012f:	8d 42 01             	lea    0x1(%edx),%eax
+  800132:	89 03                	mov    %eax,(%ebx)
+  800134:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800137:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80013b:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800140:	74 09                	je     80014b <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800142:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800146:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800149:	c9                   	leave
+  80014a:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80014b:	83 ec 08             	sub    $0x8,%esp
+  80014e:	68 ff 00 00 00       	push   $0xff
+  800153:	8d 43 08             	lea    0x8(%ebx),%eax
+  800156:	50                   	push   %eax
+  800157:	e8 45 09 00 00       	call   800aa1 <sys_cputs>
+		b->idx = 0;
+  80015c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800162:	83 c4 10             	add    $0x10,%esp
+  800165:	eb db                	jmp    800142 <putch+0x1f>
+
+00800167 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800167:	55                   	push   %ebp
+  800168:	89 e5                	mov    %esp,%ebp
+  80016a:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800170:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800177:	00 00 00 
+	b.cnt = 0;
+  80017a:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800181:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800184:	ff 75 0c             	push   0xc(%ebp)
+  800187:	ff 75 08             	push   0x8(%ebp)
+  80018a:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800190:	50                   	push   %eax
+  800191:	68 23 01 80 00       	push   $0x800123
+  800196:	e8 14 01 00 00       	call   8002af <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80019b:	83 c4 08             	add    $0x8,%esp
+  80019e:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001a4:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001aa:	50                   	push   %eax
+  8001ab:	e8 f1 08 00 00       	call   800aa1 <sys_cputs>
+
+	return b.cnt;
+}
+  8001b0:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001b6:	c9                   	leave
+  8001b7:	c3                   	ret
+
+008001b8 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001b8:	55                   	push   %ebp
+  8001b9:	89 e5                	mov    %esp,%ebp
+  8001bb:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8001be:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8001c1:	50                   	push   %eax
+  8001c2:	ff 75 08             	push   0x8(%ebp)
+  8001c5:	e8 9d ff ff ff       	call   800167 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8001ca:	c9                   	leave
+  8001cb:	c3                   	ret
+
+008001cc <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8001cc:	55                   	push   %ebp
+  8001cd:	89 e5                	mov    %esp,%ebp
+  8001cf:	57                   	push   %edi
+  8001d0:	56                   	push   %esi
+  8001d1:	53                   	push   %ebx
+  8001d2:	83 ec 1c             	sub    $0x1c,%esp
+  8001d5:	89 c7                	mov    %eax,%edi
+  8001d7:	89 d6                	mov    %edx,%esi
+  8001d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001dc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001df:	89 d1                	mov    %edx,%ecx
+  8001e1:	89 c2                	mov    %eax,%edx
+  8001e3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001e6:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001e9:	8b 45 10             	mov    0x10(%ebp),%eax
+  8001ec:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8001ef:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001f2:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8001f9:	39 c2                	cmp    %eax,%edx
+  8001fb:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8001fe:	72 3e                	jb     80023e <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800200:	83 ec 0c             	sub    $0xc,%esp
+  800203:	ff 75 18             	push   0x18(%ebp)
+  800206:	83 eb 01             	sub    $0x1,%ebx
+  800209:	53                   	push   %ebx
+  80020a:	50                   	push   %eax
+  80020b:	83 ec 08             	sub    $0x8,%esp
+  80020e:	ff 75 e4             	push   -0x1c(%ebp)
+  800211:	ff 75 e0             	push   -0x20(%ebp)
+  800214:	ff 75 dc             	push   -0x24(%ebp)
+  800217:	ff 75 d8             	push   -0x28(%ebp)
+  80021a:	e8 61 23 00 00       	call   802580 <__udivdi3>
+  80021f:	83 c4 18             	add    $0x18,%esp
+  800222:	52                   	push   %edx
+  800223:	50                   	push   %eax
+  800224:	89 f2                	mov    %esi,%edx
+  800226:	89 f8                	mov    %edi,%eax
+  800228:	e8 9f ff ff ff       	call   8001cc <printnum>
+  80022d:	83 c4 20             	add    $0x20,%esp
+  800230:	eb 13                	jmp    800245 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800232:	83 ec 08             	sub    $0x8,%esp
+  800235:	56                   	push   %esi
+  800236:	ff 75 18             	push   0x18(%ebp)
+  800239:	ff d7                	call   *%edi
+  80023b:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80023e:	83 eb 01             	sub    $0x1,%ebx
+  800241:	85 db                	test   %ebx,%ebx
+  800243:	7f ed                	jg     800232 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800245:	83 ec 08             	sub    $0x8,%esp
+  800248:	56                   	push   %esi
+  800249:	83 ec 04             	sub    $0x4,%esp
+  80024c:	ff 75 e4             	push   -0x1c(%ebp)
+  80024f:	ff 75 e0             	push   -0x20(%ebp)
+  800252:	ff 75 dc             	push   -0x24(%ebp)
+  800255:	ff 75 d8             	push   -0x28(%ebp)
+  800258:	e8 f3 23 00 00       	call   802650 <__umoddi3>
+  80025d:	83 c4 14             	add    $0x14,%esp
+  800260:	0f be 80 53 29 80 00 	movsbl 0x802953(%eax),%eax
+  800267:	50                   	push   %eax
+  800268:	ff d7                	call   *%edi
+}
+  80026a:	83 c4 10             	add    $0x10,%esp
+  80026d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800270:	5b                   	pop    %ebx
+  800271:	5e                   	pop    %esi
+  800272:	5f                   	pop    %edi
+  800273:	5d                   	pop    %ebp
+  800274:	c3                   	ret
+
+00800275 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800275:	55                   	push   %ebp
+  800276:	89 e5                	mov    %esp,%ebp
+  800278:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80027b:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80027f:	8b 10                	mov    (%eax),%edx
+  800281:	3b 50 04             	cmp    0x4(%eax),%edx
+  800284:	73 0a                	jae    800290 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800286:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800289:	89 08                	mov    %ecx,(%eax)
+  80028b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80028e:	88 02                	mov    %al,(%edx)
+}
+  800290:	5d                   	pop    %ebp
+  800291:	c3                   	ret
+
+00800292 <printfmt>:
+{
+  800292:	55                   	push   %ebp
+  800293:	89 e5                	mov    %esp,%ebp
+  800295:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800298:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80029b:	50                   	push   %eax
+  80029c:	ff 75 10             	push   0x10(%ebp)
+  80029f:	ff 75 0c             	push   0xc(%ebp)
+  8002a2:	ff 75 08             	push   0x8(%ebp)
+  8002a5:	e8 05 00 00 00       	call   8002af <vprintfmt>
+}
+  8002aa:	83 c4 10             	add    $0x10,%esp
+  8002ad:	c9                   	leave
+  8002ae:	c3                   	ret
+
+008002af <vprintfmt>:
+{
+  8002af:	55                   	push   %ebp
+  8002b0:	89 e5                	mov    %esp,%ebp
+  8002b2:	57                   	push   %edi
+  8002b3:	56                   	push   %esi
+  8002b4:	53                   	push   %ebx
+  8002b5:	83 ec 2c             	sub    $0x2c,%esp
+  8002b8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8002bb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8002be:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8002c1:	eb 0a                	jmp    8002cd <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8002c3:	83 ec 08             	sub    $0x8,%esp
+  8002c6:	53                   	push   %ebx
+  8002c7:	50                   	push   %eax
+  8002c8:	ff d6                	call   *%esi
+  8002ca:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8002cd:	83 c7 01             	add    $0x1,%edi
+  8002d0:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8002d4:	83 f8 25             	cmp    $0x25,%eax
+  8002d7:	74 0c                	je     8002e5 <vprintfmt+0x36>
+			if (ch == '\0')
+  8002d9:	85 c0                	test   %eax,%eax
+  8002db:	75 e6                	jne    8002c3 <vprintfmt+0x14>
+}
+  8002dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002e0:	5b                   	pop    %ebx
+  8002e1:	5e                   	pop    %esi
+  8002e2:	5f                   	pop    %edi
+  8002e3:	5d                   	pop    %ebp
+  8002e4:	c3                   	ret
+		padc = ' ';
+  8002e5:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8002e9:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8002f0:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8002f7:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8002fe:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800303:	8d 47 01             	lea    0x1(%edi),%eax
+  800306:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800309:	0f b6 17             	movzbl (%edi),%edx
+  80030c:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80030f:	3c 55                	cmp    $0x55,%al
+  800311:	0f 87 9a 03 00 00    	ja     8006b1 <vprintfmt+0x402>
+  800317:	0f b6 c0             	movzbl %al,%eax
+  80031a:	ff 24 85 a0 2a 80 00 	jmp    *0x802aa0(,%eax,4)
+  800321:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800324:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800328:	eb d9                	jmp    800303 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80032a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80032d:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800331:	eb d0                	jmp    800303 <vprintfmt+0x54>
+  800333:	0f b6 d2             	movzbl %dl,%edx
+  800336:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800339:	b8 00 00 00 00       	mov    $0x0,%eax
+  80033e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800341:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800344:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800348:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80034b:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80034e:	83 f9 09             	cmp    $0x9,%ecx
+  800351:	77 55                	ja     8003a8 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800353:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800356:	eb e9                	jmp    800341 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800358:	8b 45 14             	mov    0x14(%ebp),%eax
+  80035b:	8b 00                	mov    (%eax),%eax
+  80035d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800360:	8b 45 14             	mov    0x14(%ebp),%eax
+  800363:	8d 40 04             	lea    0x4(%eax),%eax
+  800366:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800369:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80036c:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800370:	79 91                	jns    800303 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800372:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800375:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800378:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80037f:	eb 82                	jmp    800303 <vprintfmt+0x54>
+			if (width < 0)
+  800381:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800384:	85 d2                	test   %edx,%edx
+  800386:	b8 00 00 00 00       	mov    $0x0,%eax
+  80038b:	0f 49 c2             	cmovns %edx,%eax
+  80038e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800391:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800394:	e9 6a ff ff ff       	jmp    800303 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800399:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80039c:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8003a3:	e9 5b ff ff ff       	jmp    800303 <vprintfmt+0x54>
+  8003a8:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003ab:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003ae:	eb bc                	jmp    80036c <vprintfmt+0xbd>
+			lflag++;
+  8003b0:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003b3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003b6:	e9 48 ff ff ff       	jmp    800303 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8003bb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003be:	8d 78 04             	lea    0x4(%eax),%edi
+  8003c1:	83 ec 08             	sub    $0x8,%esp
+  8003c4:	53                   	push   %ebx
+  8003c5:	ff 30                	push   (%eax)
+  8003c7:	ff d6                	call   *%esi
+			break;
+  8003c9:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8003cc:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8003cf:	e9 7c 02 00 00       	jmp    800650 <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  8003d4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003d7:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8003da:	8b 10                	mov    (%eax),%edx
+  8003dc:	89 d0                	mov    %edx,%eax
+  8003de:	f7 d8                	neg    %eax
+  8003e0:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8003e3:	83 f8 10             	cmp    $0x10,%eax
+  8003e6:	7f 23                	jg     80040b <vprintfmt+0x15c>
+  8003e8:	8b 14 85 00 2c 80 00 	mov    0x802c00(,%eax,4),%edx
+  8003ef:	85 d2                	test   %edx,%edx
+  8003f1:	74 18                	je     80040b <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8003f3:	52                   	push   %edx
+  8003f4:	68 5d 2e 80 00       	push   $0x802e5d
+  8003f9:	53                   	push   %ebx
+  8003fa:	56                   	push   %esi
+  8003fb:	e8 92 fe ff ff       	call   800292 <printfmt>
+  800400:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800403:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800406:	e9 45 02 00 00       	jmp    800650 <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  80040b:	50                   	push   %eax
+  80040c:	68 6b 29 80 00       	push   $0x80296b
+  800411:	53                   	push   %ebx
+  800412:	56                   	push   %esi
+  800413:	e8 7a fe ff ff       	call   800292 <printfmt>
+  800418:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80041b:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80041e:	e9 2d 02 00 00       	jmp    800650 <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800423:	8b 45 14             	mov    0x14(%ebp),%eax
+  800426:	83 c0 04             	add    $0x4,%eax
+  800429:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80042c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80042f:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800431:	85 c9                	test   %ecx,%ecx
+  800433:	b8 64 29 80 00       	mov    $0x802964,%eax
+  800438:	0f 45 c1             	cmovne %ecx,%eax
+  80043b:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80043e:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800442:	7e 06                	jle    80044a <vprintfmt+0x19b>
+  800444:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800448:	75 0b                	jne    800455 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80044a:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80044d:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800450:	89 75 08             	mov    %esi,0x8(%ebp)
+  800453:	eb 5c                	jmp    8004b1 <vprintfmt+0x202>
+  800455:	83 ec 08             	sub    $0x8,%esp
+  800458:	ff 75 d0             	push   -0x30(%ebp)
+  80045b:	ff 75 cc             	push   -0x34(%ebp)
+  80045e:	e8 eb 02 00 00       	call   80074e <strnlen>
+  800463:	89 c2                	mov    %eax,%edx
+  800465:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800468:	29 d0                	sub    %edx,%eax
+  80046a:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80046d:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800471:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800474:	89 75 08             	mov    %esi,0x8(%ebp)
+  800477:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800479:	eb 0e                	jmp    800489 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  80047b:	83 ec 08             	sub    $0x8,%esp
+  80047e:	53                   	push   %ebx
+  80047f:	57                   	push   %edi
+  800480:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800483:	83 ee 01             	sub    $0x1,%esi
+  800486:	83 c4 10             	add    $0x10,%esp
+  800489:	85 f6                	test   %esi,%esi
+  80048b:	7f ee                	jg     80047b <vprintfmt+0x1cc>
+  80048d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800490:	8b 75 08             	mov    0x8(%ebp),%esi
+  800493:	85 c0                	test   %eax,%eax
+  800495:	ba 00 00 00 00       	mov    $0x0,%edx
+  80049a:	0f 49 d0             	cmovns %eax,%edx
+  80049d:	29 d0                	sub    %edx,%eax
+  80049f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004a2:	eb a6                	jmp    80044a <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8004a4:	83 ec 08             	sub    $0x8,%esp
+  8004a7:	53                   	push   %ebx
+  8004a8:	52                   	push   %edx
+  8004a9:	ff 55 08             	call   *0x8(%ebp)
+  8004ac:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004af:	89 f1                	mov    %esi,%ecx
+  8004b1:	8d 71 01             	lea    0x1(%ecx),%esi
+  8004b4:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004b8:	0f be d0             	movsbl %al,%edx
+  8004bb:	85 d2                	test   %edx,%edx
+  8004bd:	74 28                	je     8004e7 <vprintfmt+0x238>
+  8004bf:	85 ff                	test   %edi,%edi
+  8004c1:	78 05                	js     8004c8 <vprintfmt+0x219>
+  8004c3:	83 ef 01             	sub    $0x1,%edi
+  8004c6:	78 30                	js     8004f8 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8004c8:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8004cc:	74 d6                	je     8004a4 <vprintfmt+0x1f5>
+  8004ce:	0f be c0             	movsbl %al,%eax
+  8004d1:	83 e8 20             	sub    $0x20,%eax
+  8004d4:	83 f8 5e             	cmp    $0x5e,%eax
+  8004d7:	76 cb                	jbe    8004a4 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8004d9:	83 ec 08             	sub    $0x8,%esp
+  8004dc:	53                   	push   %ebx
+  8004dd:	6a 3f                	push   $0x3f
+  8004df:	ff 55 08             	call   *0x8(%ebp)
+  8004e2:	83 c4 10             	add    $0x10,%esp
+  8004e5:	eb c8                	jmp    8004af <vprintfmt+0x200>
+  8004e7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004ea:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8004ed:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004f0:	01 d0                	add    %edx,%eax
+  8004f2:	29 c8                	sub    %ecx,%eax
+  8004f4:	89 c7                	mov    %eax,%edi
+  8004f6:	eb 13                	jmp    80050b <vprintfmt+0x25c>
+  8004f8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004fb:	eb ed                	jmp    8004ea <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8004fd:	83 ec 08             	sub    $0x8,%esp
+  800500:	53                   	push   %ebx
+  800501:	6a 20                	push   $0x20
+  800503:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800505:	83 ef 01             	sub    $0x1,%edi
+  800508:	83 c4 10             	add    $0x10,%esp
+  80050b:	85 ff                	test   %edi,%edi
+  80050d:	7f ee                	jg     8004fd <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80050f:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800512:	89 45 14             	mov    %eax,0x14(%ebp)
+  800515:	e9 36 01 00 00       	jmp    800650 <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  80051a:	83 f9 01             	cmp    $0x1,%ecx
+  80051d:	7f 1f                	jg     80053e <vprintfmt+0x28f>
+	else if (lflag)
+  80051f:	85 c9                	test   %ecx,%ecx
+  800521:	74 67                	je     80058a <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800523:	8b 45 14             	mov    0x14(%ebp),%eax
+  800526:	8b 00                	mov    (%eax),%eax
+  800528:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80052b:	89 c1                	mov    %eax,%ecx
+  80052d:	c1 f9 1f             	sar    $0x1f,%ecx
+  800530:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800533:	8b 45 14             	mov    0x14(%ebp),%eax
+  800536:	8d 40 04             	lea    0x4(%eax),%eax
+  800539:	89 45 14             	mov    %eax,0x14(%ebp)
+  80053c:	eb 17                	jmp    800555 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  80053e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800541:	8b 50 04             	mov    0x4(%eax),%edx
+  800544:	8b 00                	mov    (%eax),%eax
+  800546:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800549:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80054c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80054f:	8d 40 08             	lea    0x8(%eax),%eax
+  800552:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800555:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800558:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80055b:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800560:	85 c9                	test   %ecx,%ecx
+  800562:	0f 89 ce 00 00 00    	jns    800636 <vprintfmt+0x387>
+				putch('-', putdat);
+  800568:	83 ec 08             	sub    $0x8,%esp
+  80056b:	53                   	push   %ebx
+  80056c:	6a 2d                	push   $0x2d
+  80056e:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800570:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800573:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800576:	f7 da                	neg    %edx
+  800578:	83 d1 00             	adc    $0x0,%ecx
+  80057b:	f7 d9                	neg    %ecx
+  80057d:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800580:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800585:	e9 ac 00 00 00       	jmp    800636 <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  80058a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058d:	8b 00                	mov    (%eax),%eax
+  80058f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800592:	89 c1                	mov    %eax,%ecx
+  800594:	c1 f9 1f             	sar    $0x1f,%ecx
+  800597:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80059a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059d:	8d 40 04             	lea    0x4(%eax),%eax
+  8005a0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005a3:	eb b0                	jmp    800555 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8005a5:	83 f9 01             	cmp    $0x1,%ecx
+  8005a8:	7f 1b                	jg     8005c5 <vprintfmt+0x316>
+	else if (lflag)
+  8005aa:	85 c9                	test   %ecx,%ecx
+  8005ac:	74 2c                	je     8005da <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  8005ae:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b1:	8b 10                	mov    (%eax),%edx
+  8005b3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005b8:	8d 40 04             	lea    0x4(%eax),%eax
+  8005bb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005be:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8005c3:	eb 71                	jmp    800636 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  8005c5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c8:	8b 10                	mov    (%eax),%edx
+  8005ca:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005cd:	8d 40 08             	lea    0x8(%eax),%eax
+  8005d0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005d3:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8005d8:	eb 5c                	jmp    800636 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  8005da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005dd:	8b 10                	mov    (%eax),%edx
+  8005df:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005e4:	8d 40 04             	lea    0x4(%eax),%eax
+  8005e7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005ea:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8005ef:	eb 45                	jmp    800636 <vprintfmt+0x387>
+			putch('X', putdat);
+  8005f1:	83 ec 08             	sub    $0x8,%esp
+  8005f4:	53                   	push   %ebx
+  8005f5:	6a 58                	push   $0x58
+  8005f7:	ff d6                	call   *%esi
+			putch('X', putdat);
+  8005f9:	83 c4 08             	add    $0x8,%esp
+  8005fc:	53                   	push   %ebx
+  8005fd:	6a 58                	push   $0x58
+  8005ff:	ff d6                	call   *%esi
+			putch('X', putdat);
+  800601:	83 c4 08             	add    $0x8,%esp
+  800604:	53                   	push   %ebx
+  800605:	6a 58                	push   $0x58
+  800607:	ff d6                	call   *%esi
+			break;
+  800609:	83 c4 10             	add    $0x10,%esp
+  80060c:	eb 42                	jmp    800650 <vprintfmt+0x3a1>
+			putch('0', putdat);
+  80060e:	83 ec 08             	sub    $0x8,%esp
+  800611:	53                   	push   %ebx
+  800612:	6a 30                	push   $0x30
+  800614:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800616:	83 c4 08             	add    $0x8,%esp
+  800619:	53                   	push   %ebx
+  80061a:	6a 78                	push   $0x78
+  80061c:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  80061e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800621:	8b 10                	mov    (%eax),%edx
+  800623:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800628:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80062b:	8d 40 04             	lea    0x4(%eax),%eax
+  80062e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800631:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800636:	83 ec 0c             	sub    $0xc,%esp
+  800639:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80063d:	50                   	push   %eax
+  80063e:	ff 75 e0             	push   -0x20(%ebp)
+  800641:	57                   	push   %edi
+  800642:	51                   	push   %ecx
+  800643:	52                   	push   %edx
+  800644:	89 da                	mov    %ebx,%edx
+  800646:	89 f0                	mov    %esi,%eax
+  800648:	e8 7f fb ff ff       	call   8001cc <printnum>
+			break;
+  80064d:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800650:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800653:	e9 75 fc ff ff       	jmp    8002cd <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800658:	83 f9 01             	cmp    $0x1,%ecx
+  80065b:	7f 1b                	jg     800678 <vprintfmt+0x3c9>
+	else if (lflag)
+  80065d:	85 c9                	test   %ecx,%ecx
+  80065f:	74 2c                	je     80068d <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  800661:	8b 45 14             	mov    0x14(%ebp),%eax
+  800664:	8b 10                	mov    (%eax),%edx
+  800666:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80066b:	8d 40 04             	lea    0x4(%eax),%eax
+  80066e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800671:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800676:	eb be                	jmp    800636 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  800678:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067b:	8b 10                	mov    (%eax),%edx
+  80067d:	8b 48 04             	mov    0x4(%eax),%ecx
+  800680:	8d 40 08             	lea    0x8(%eax),%eax
+  800683:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800686:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80068b:	eb a9                	jmp    800636 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  80068d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800690:	8b 10                	mov    (%eax),%edx
+  800692:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800697:	8d 40 04             	lea    0x4(%eax),%eax
+  80069a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80069d:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8006a2:	eb 92                	jmp    800636 <vprintfmt+0x387>
+			putch(ch, putdat);
+  8006a4:	83 ec 08             	sub    $0x8,%esp
+  8006a7:	53                   	push   %ebx
+  8006a8:	6a 25                	push   $0x25
+  8006aa:	ff d6                	call   *%esi
+			break;
+  8006ac:	83 c4 10             	add    $0x10,%esp
+  8006af:	eb 9f                	jmp    800650 <vprintfmt+0x3a1>
+			putch('%', putdat);
+  8006b1:	83 ec 08             	sub    $0x8,%esp
+  8006b4:	53                   	push   %ebx
+  8006b5:	6a 25                	push   $0x25
+  8006b7:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8006b9:	83 c4 10             	add    $0x10,%esp
+  8006bc:	89 f8                	mov    %edi,%eax
+  8006be:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8006c2:	74 05                	je     8006c9 <vprintfmt+0x41a>
+  8006c4:	83 e8 01             	sub    $0x1,%eax
+  8006c7:	eb f5                	jmp    8006be <vprintfmt+0x40f>
+  8006c9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8006cc:	eb 82                	jmp    800650 <vprintfmt+0x3a1>
+
+008006ce <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8006ce:	55                   	push   %ebp
+  8006cf:	89 e5                	mov    %esp,%ebp
+  8006d1:	83 ec 18             	sub    $0x18,%esp
+  8006d4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006d7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8006da:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8006dd:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8006e1:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8006e4:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8006eb:	85 c0                	test   %eax,%eax
+  8006ed:	74 26                	je     800715 <vsnprintf+0x47>
+  8006ef:	85 d2                	test   %edx,%edx
+  8006f1:	7e 22                	jle    800715 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8006f3:	ff 75 14             	push   0x14(%ebp)
+  8006f6:	ff 75 10             	push   0x10(%ebp)
+  8006f9:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8006fc:	50                   	push   %eax
+  8006fd:	68 75 02 80 00       	push   $0x800275
+  800702:	e8 a8 fb ff ff       	call   8002af <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800707:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80070a:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80070d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800710:	83 c4 10             	add    $0x10,%esp
+}
+  800713:	c9                   	leave
+  800714:	c3                   	ret
+		return -E_INVAL;
+  800715:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80071a:	eb f7                	jmp    800713 <vsnprintf+0x45>
+
+0080071c <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80071c:	55                   	push   %ebp
+  80071d:	89 e5                	mov    %esp,%ebp
+  80071f:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800722:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800725:	50                   	push   %eax
+  800726:	ff 75 10             	push   0x10(%ebp)
+  800729:	ff 75 0c             	push   0xc(%ebp)
+  80072c:	ff 75 08             	push   0x8(%ebp)
+  80072f:	e8 9a ff ff ff       	call   8006ce <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800734:	c9                   	leave
+  800735:	c3                   	ret
+
+00800736 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800736:	55                   	push   %ebp
+  800737:	89 e5                	mov    %esp,%ebp
+  800739:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80073c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800741:	eb 03                	jmp    800746 <strlen+0x10>
+		n++;
+  800743:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800746:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80074a:	75 f7                	jne    800743 <strlen+0xd>
+	return n;
+}
+  80074c:	5d                   	pop    %ebp
+  80074d:	c3                   	ret
+
+0080074e <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80074e:	55                   	push   %ebp
+  80074f:	89 e5                	mov    %esp,%ebp
+  800751:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800754:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800757:	b8 00 00 00 00       	mov    $0x0,%eax
+  80075c:	eb 03                	jmp    800761 <strnlen+0x13>
+		n++;
+  80075e:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800761:	39 d0                	cmp    %edx,%eax
+  800763:	74 08                	je     80076d <strnlen+0x1f>
+  800765:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800769:	75 f3                	jne    80075e <strnlen+0x10>
+  80076b:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80076d:	89 d0                	mov    %edx,%eax
+  80076f:	5d                   	pop    %ebp
+  800770:	c3                   	ret
+
+00800771 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800771:	55                   	push   %ebp
+  800772:	89 e5                	mov    %esp,%ebp
+  800774:	53                   	push   %ebx
+  800775:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800778:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80077b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800780:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800784:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800787:	83 c0 01             	add    $0x1,%eax
+  80078a:	84 d2                	test   %dl,%dl
+  80078c:	75 f2                	jne    800780 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80078e:	89 c8                	mov    %ecx,%eax
+  800790:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800793:	c9                   	leave
+  800794:	c3                   	ret
+
+00800795 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800795:	55                   	push   %ebp
+  800796:	89 e5                	mov    %esp,%ebp
+  800798:	53                   	push   %ebx
+  800799:	83 ec 10             	sub    $0x10,%esp
+  80079c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80079f:	53                   	push   %ebx
+  8007a0:	e8 91 ff ff ff       	call   800736 <strlen>
+  8007a5:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8007a8:	ff 75 0c             	push   0xc(%ebp)
+  8007ab:	01 d8                	add    %ebx,%eax
+  8007ad:	50                   	push   %eax
+  8007ae:	e8 be ff ff ff       	call   800771 <strcpy>
+	return dst;
+}
+  8007b3:	89 d8                	mov    %ebx,%eax
+  8007b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007b8:	c9                   	leave
+  8007b9:	c3                   	ret
+
+008007ba <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8007ba:	55                   	push   %ebp
+  8007bb:	89 e5                	mov    %esp,%ebp
+  8007bd:	56                   	push   %esi
+  8007be:	53                   	push   %ebx
+  8007bf:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007c2:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8007c5:	89 f3                	mov    %esi,%ebx
+  8007c7:	03 5d 10             	add    0x10(%ebp),%ebx
+  8007ca:	89 f0                	mov    %esi,%eax
+  8007cc:	eb 0f                	jmp    8007dd <strncpy+0x23>
+		*dst++ = *src;
+  8007ce:	83 c0 01             	add    $0x1,%eax
+  8007d1:	0f b6 0a             	movzbl (%edx),%ecx
+  8007d4:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8007d7:	80 f9 01             	cmp    $0x1,%cl
+  8007da:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8007dd:	39 d8                	cmp    %ebx,%eax
+  8007df:	75 ed                	jne    8007ce <strncpy+0x14>
+	}
+	return ret;
+}
+  8007e1:	89 f0                	mov    %esi,%eax
+  8007e3:	5b                   	pop    %ebx
+  8007e4:	5e                   	pop    %esi
+  8007e5:	5d                   	pop    %ebp
+  8007e6:	c3                   	ret
+
+008007e7 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8007e7:	55                   	push   %ebp
+  8007e8:	89 e5                	mov    %esp,%ebp
+  8007ea:	56                   	push   %esi
+  8007eb:	53                   	push   %ebx
+  8007ec:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007ef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007f2:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8007f5:	89 f0                	mov    %esi,%eax
+  8007f7:	85 d2                	test   %edx,%edx
+  8007f9:	74 21                	je     80081c <strlcpy+0x35>
+  8007fb:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8007ff:	89 f2                	mov    %esi,%edx
+  800801:	eb 09                	jmp    80080c <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800803:	83 c1 01             	add    $0x1,%ecx
+  800806:	83 c2 01             	add    $0x1,%edx
+  800809:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80080c:	39 c2                	cmp    %eax,%edx
+  80080e:	74 09                	je     800819 <strlcpy+0x32>
+  800810:	0f b6 19             	movzbl (%ecx),%ebx
+  800813:	84 db                	test   %bl,%bl
+  800815:	75 ec                	jne    800803 <strlcpy+0x1c>
+  800817:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800819:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80081c:	29 f0                	sub    %esi,%eax
+}
+  80081e:	5b                   	pop    %ebx
+  80081f:	5e                   	pop    %esi
+  800820:	5d                   	pop    %ebp
+  800821:	c3                   	ret
+
+00800822 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800822:	55                   	push   %ebp
+  800823:	89 e5                	mov    %esp,%ebp
+  800825:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800828:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80082b:	eb 06                	jmp    800833 <strcmp+0x11>
+		p++, q++;
+  80082d:	83 c1 01             	add    $0x1,%ecx
+  800830:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800833:	0f b6 01             	movzbl (%ecx),%eax
+  800836:	84 c0                	test   %al,%al
+  800838:	74 04                	je     80083e <strcmp+0x1c>
+  80083a:	3a 02                	cmp    (%edx),%al
+  80083c:	74 ef                	je     80082d <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80083e:	0f b6 c0             	movzbl %al,%eax
+  800841:	0f b6 12             	movzbl (%edx),%edx
+  800844:	29 d0                	sub    %edx,%eax
+}
+  800846:	5d                   	pop    %ebp
+  800847:	c3                   	ret
+
+00800848 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800848:	55                   	push   %ebp
+  800849:	89 e5                	mov    %esp,%ebp
+  80084b:	53                   	push   %ebx
+  80084c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80084f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800852:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800855:	eb 09                	jmp    800860 <strncmp+0x18>
+		n--, p++, q++;
+  800857:	83 ea 01             	sub    $0x1,%edx
+  80085a:	83 c0 01             	add    $0x1,%eax
+  80085d:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800860:	85 d2                	test   %edx,%edx
+  800862:	74 18                	je     80087c <strncmp+0x34>
+  800864:	0f b6 18             	movzbl (%eax),%ebx
+  800867:	84 db                	test   %bl,%bl
+  800869:	74 04                	je     80086f <strncmp+0x27>
+  80086b:	3a 19                	cmp    (%ecx),%bl
+  80086d:	74 e8                	je     800857 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80086f:	0f b6 00             	movzbl (%eax),%eax
+  800872:	0f b6 11             	movzbl (%ecx),%edx
+  800875:	29 d0                	sub    %edx,%eax
+}
+  800877:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80087a:	c9                   	leave
+  80087b:	c3                   	ret
+		return 0;
+  80087c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800881:	eb f4                	jmp    800877 <strncmp+0x2f>
+
+00800883 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800883:	55                   	push   %ebp
+  800884:	89 e5                	mov    %esp,%ebp
+  800886:	8b 45 08             	mov    0x8(%ebp),%eax
+  800889:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80088d:	eb 03                	jmp    800892 <strchr+0xf>
+  80088f:	83 c0 01             	add    $0x1,%eax
+  800892:	0f b6 10             	movzbl (%eax),%edx
+  800895:	84 d2                	test   %dl,%dl
+  800897:	74 06                	je     80089f <strchr+0x1c>
+		if (*s == c)
+  800899:	38 ca                	cmp    %cl,%dl
+  80089b:	75 f2                	jne    80088f <strchr+0xc>
+  80089d:	eb 05                	jmp    8008a4 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  80089f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008a4:	5d                   	pop    %ebp
+  8008a5:	c3                   	ret
+
+008008a6 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8008a6:	55                   	push   %ebp
+  8008a7:	89 e5                	mov    %esp,%ebp
+  8008a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008ac:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008b0:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8008b3:	38 ca                	cmp    %cl,%dl
+  8008b5:	74 09                	je     8008c0 <strfind+0x1a>
+  8008b7:	84 d2                	test   %dl,%dl
+  8008b9:	74 05                	je     8008c0 <strfind+0x1a>
+	for (; *s; s++)
+  8008bb:	83 c0 01             	add    $0x1,%eax
+  8008be:	eb f0                	jmp    8008b0 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8008c0:	5d                   	pop    %ebp
+  8008c1:	c3                   	ret
+
+008008c2 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8008c2:	55                   	push   %ebp
+  8008c3:	89 e5                	mov    %esp,%ebp
+  8008c5:	57                   	push   %edi
+  8008c6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8008c9:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8008cc:	85 c9                	test   %ecx,%ecx
+  8008ce:	74 20                	je     8008f0 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8008d0:	89 f8                	mov    %edi,%eax
+  8008d2:	09 c8                	or     %ecx,%eax
+  8008d4:	a8 03                	test   $0x3,%al
+  8008d6:	75 12                	jne    8008ea <memset+0x28>
+		c &= 0xFF;
+  8008d8:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8008dc:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8008e2:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8008e5:	fc                   	cld
+  8008e6:	f3 ab                	rep stos %eax,%es:(%edi)
+  8008e8:	eb 06                	jmp    8008f0 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8008ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8008ed:	fc                   	cld
+  8008ee:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8008f0:	89 f8                	mov    %edi,%eax
+  8008f2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8008f5:	c9                   	leave
+  8008f6:	c3                   	ret
+
+008008f7 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8008f7:	55                   	push   %ebp
+  8008f8:	89 e5                	mov    %esp,%ebp
+  8008fa:	57                   	push   %edi
+  8008fb:	56                   	push   %esi
+  8008fc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008ff:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800902:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800905:	39 c6                	cmp    %eax,%esi
+  800907:	73 32                	jae    80093b <memmove+0x44>
+  800909:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80090c:	39 d0                	cmp    %edx,%eax
+  80090e:	73 2b                	jae    80093b <memmove+0x44>
+		s += n;
+		d += n;
+  800910:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800913:	89 d6                	mov    %edx,%esi
+  800915:	09 fe                	or     %edi,%esi
+  800917:	09 ce                	or     %ecx,%esi
+  800919:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  80091f:	75 0e                	jne    80092f <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800921:	83 ef 04             	sub    $0x4,%edi
+  800924:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800927:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  80092a:	fd                   	std
+  80092b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80092d:	eb 09                	jmp    800938 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  80092f:	83 ef 01             	sub    $0x1,%edi
+  800932:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800935:	fd                   	std
+  800936:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800938:	fc                   	cld
+  800939:	eb 1a                	jmp    800955 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80093b:	89 f2                	mov    %esi,%edx
+  80093d:	09 c2                	or     %eax,%edx
+  80093f:	09 ca                	or     %ecx,%edx
+  800941:	f6 c2 03             	test   $0x3,%dl
+  800944:	75 0a                	jne    800950 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800946:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800949:	89 c7                	mov    %eax,%edi
+  80094b:	fc                   	cld
+  80094c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80094e:	eb 05                	jmp    800955 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800950:	89 c7                	mov    %eax,%edi
+  800952:	fc                   	cld
+  800953:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800955:	5e                   	pop    %esi
+  800956:	5f                   	pop    %edi
+  800957:	5d                   	pop    %ebp
+  800958:	c3                   	ret
+
+00800959 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800959:	55                   	push   %ebp
+  80095a:	89 e5                	mov    %esp,%ebp
+  80095c:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  80095f:	ff 75 10             	push   0x10(%ebp)
+  800962:	ff 75 0c             	push   0xc(%ebp)
+  800965:	ff 75 08             	push   0x8(%ebp)
+  800968:	e8 8a ff ff ff       	call   8008f7 <memmove>
+}
+  80096d:	c9                   	leave
+  80096e:	c3                   	ret
+
+0080096f <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  80096f:	55                   	push   %ebp
+  800970:	89 e5                	mov    %esp,%ebp
+  800972:	56                   	push   %esi
+  800973:	53                   	push   %ebx
+  800974:	8b 45 08             	mov    0x8(%ebp),%eax
+  800977:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  80097a:	89 c6                	mov    %eax,%esi
+  80097c:	03 75 10             	add    0x10(%ebp),%esi
+  80097f:	eb 06                	jmp    800987 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800981:	83 c0 01             	add    $0x1,%eax
+  800984:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800987:	39 f0                	cmp    %esi,%eax
+  800989:	74 14                	je     80099f <memcmp+0x30>
+		if (*s1 != *s2)
+  80098b:	0f b6 08             	movzbl (%eax),%ecx
+  80098e:	0f b6 1a             	movzbl (%edx),%ebx
+  800991:	38 d9                	cmp    %bl,%cl
+  800993:	74 ec                	je     800981 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800995:	0f b6 c1             	movzbl %cl,%eax
+  800998:	0f b6 db             	movzbl %bl,%ebx
+  80099b:	29 d8                	sub    %ebx,%eax
+  80099d:	eb 05                	jmp    8009a4 <memcmp+0x35>
+	}
+
+	return 0;
+  80099f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009a4:	5b                   	pop    %ebx
+  8009a5:	5e                   	pop    %esi
+  8009a6:	5d                   	pop    %ebp
+  8009a7:	c3                   	ret
+
+008009a8 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8009a8:	55                   	push   %ebp
+  8009a9:	89 e5                	mov    %esp,%ebp
+  8009ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009ae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8009b1:	89 c2                	mov    %eax,%edx
+  8009b3:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8009b6:	eb 03                	jmp    8009bb <memfind+0x13>
+  8009b8:	83 c0 01             	add    $0x1,%eax
+  8009bb:	39 d0                	cmp    %edx,%eax
+  8009bd:	73 04                	jae    8009c3 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8009bf:	38 08                	cmp    %cl,(%eax)
+  8009c1:	75 f5                	jne    8009b8 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8009c3:	5d                   	pop    %ebp
+  8009c4:	c3                   	ret
+
+008009c5 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8009c5:	55                   	push   %ebp
+  8009c6:	89 e5                	mov    %esp,%ebp
+  8009c8:	57                   	push   %edi
+  8009c9:	56                   	push   %esi
+  8009ca:	53                   	push   %ebx
+  8009cb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009ce:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8009d1:	eb 03                	jmp    8009d6 <strtol+0x11>
+		s++;
+  8009d3:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  8009d6:	0f b6 02             	movzbl (%edx),%eax
+  8009d9:	3c 20                	cmp    $0x20,%al
+  8009db:	74 f6                	je     8009d3 <strtol+0xe>
+  8009dd:	3c 09                	cmp    $0x9,%al
+  8009df:	74 f2                	je     8009d3 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8009e1:	3c 2b                	cmp    $0x2b,%al
+  8009e3:	74 2a                	je     800a0f <strtol+0x4a>
+	int neg = 0;
+  8009e5:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8009ea:	3c 2d                	cmp    $0x2d,%al
+  8009ec:	74 2b                	je     800a19 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009ee:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8009f4:	75 0f                	jne    800a05 <strtol+0x40>
+  8009f6:	80 3a 30             	cmpb   $0x30,(%edx)
+  8009f9:	74 28                	je     800a23 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8009fb:	85 db                	test   %ebx,%ebx
+  8009fd:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a02:	0f 44 d8             	cmove  %eax,%ebx
+  800a05:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a0a:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a0d:	eb 46                	jmp    800a55 <strtol+0x90>
+		s++;
+  800a0f:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a12:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a17:	eb d5                	jmp    8009ee <strtol+0x29>
+		s++, neg = 1;
+  800a19:	83 c2 01             	add    $0x1,%edx
+  800a1c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a21:	eb cb                	jmp    8009ee <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a23:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a27:	74 0e                	je     800a37 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a29:	85 db                	test   %ebx,%ebx
+  800a2b:	75 d8                	jne    800a05 <strtol+0x40>
+		s++, base = 8;
+  800a2d:	83 c2 01             	add    $0x1,%edx
+  800a30:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a35:	eb ce                	jmp    800a05 <strtol+0x40>
+		s += 2, base = 16;
+  800a37:	83 c2 02             	add    $0x2,%edx
+  800a3a:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a3f:	eb c4                	jmp    800a05 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a41:	0f be c0             	movsbl %al,%eax
+  800a44:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a47:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a4a:	7d 3a                	jge    800a86 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a4c:	83 c2 01             	add    $0x1,%edx
+  800a4f:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a53:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a55:	0f b6 02             	movzbl (%edx),%eax
+  800a58:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a5b:	89 f3                	mov    %esi,%ebx
+  800a5d:	80 fb 09             	cmp    $0x9,%bl
+  800a60:	76 df                	jbe    800a41 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a62:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a65:	89 f3                	mov    %esi,%ebx
+  800a67:	80 fb 19             	cmp    $0x19,%bl
+  800a6a:	77 08                	ja     800a74 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800a6c:	0f be c0             	movsbl %al,%eax
+  800a6f:	83 e8 57             	sub    $0x57,%eax
+  800a72:	eb d3                	jmp    800a47 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800a74:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800a77:	89 f3                	mov    %esi,%ebx
+  800a79:	80 fb 19             	cmp    $0x19,%bl
+  800a7c:	77 08                	ja     800a86 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800a7e:	0f be c0             	movsbl %al,%eax
+  800a81:	83 e8 37             	sub    $0x37,%eax
+  800a84:	eb c1                	jmp    800a47 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800a86:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800a8a:	74 05                	je     800a91 <strtol+0xcc>
+		*endptr = (char *) s;
+  800a8c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a8f:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800a91:	89 c8                	mov    %ecx,%eax
+  800a93:	f7 d8                	neg    %eax
+  800a95:	85 ff                	test   %edi,%edi
+  800a97:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800a9a:	89 c8                	mov    %ecx,%eax
+  800a9c:	5b                   	pop    %ebx
+  800a9d:	5e                   	pop    %esi
+  800a9e:	5f                   	pop    %edi
+  800a9f:	5d                   	pop    %ebp
+  800aa0:	c3                   	ret
+
+00800aa1 <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800aa1:	55                   	push   %ebp
+  800aa2:	89 e5                	mov    %esp,%ebp
+  800aa4:	57                   	push   %edi
+  800aa5:	56                   	push   %esi
+  800aa6:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800aa7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aac:	8b 55 08             	mov    0x8(%ebp),%edx
+  800aaf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ab2:	89 c3                	mov    %eax,%ebx
+  800ab4:	89 c7                	mov    %eax,%edi
+  800ab6:	89 c6                	mov    %eax,%esi
+  800ab8:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  800aba:	5b                   	pop    %ebx
+  800abb:	5e                   	pop    %esi
+  800abc:	5f                   	pop    %edi
+  800abd:	5d                   	pop    %ebp
+  800abe:	c3                   	ret
+
+00800abf <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800abf:	55                   	push   %ebp
+  800ac0:	89 e5                	mov    %esp,%ebp
+  800ac2:	57                   	push   %edi
+  800ac3:	56                   	push   %esi
+  800ac4:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800ac5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800aca:	b8 01 00 00 00       	mov    $0x1,%eax
+  800acf:	89 d1                	mov    %edx,%ecx
+  800ad1:	89 d3                	mov    %edx,%ebx
+  800ad3:	89 d7                	mov    %edx,%edi
+  800ad5:	89 d6                	mov    %edx,%esi
+  800ad7:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800ad9:	5b                   	pop    %ebx
+  800ada:	5e                   	pop    %esi
+  800adb:	5f                   	pop    %edi
+  800adc:	5d                   	pop    %ebp
+  800add:	c3                   	ret
+
+00800ade <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800ade:	55                   	push   %ebp
+  800adf:	89 e5                	mov    %esp,%ebp
+  800ae1:	57                   	push   %edi
+  800ae2:	56                   	push   %esi
+  800ae3:	53                   	push   %ebx
+  800ae4:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800ae7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800aec:	8b 55 08             	mov    0x8(%ebp),%edx
+  800aef:	b8 03 00 00 00       	mov    $0x3,%eax
+  800af4:	89 cb                	mov    %ecx,%ebx
+  800af6:	89 cf                	mov    %ecx,%edi
+  800af8:	89 ce                	mov    %ecx,%esi
+  800afa:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800afc:	85 c0                	test   %eax,%eax
+  800afe:	7f 08                	jg     800b08 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800b00:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b03:	5b                   	pop    %ebx
+  800b04:	5e                   	pop    %esi
+  800b05:	5f                   	pop    %edi
+  800b06:	5d                   	pop    %ebp
+  800b07:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800b08:	83 ec 0c             	sub    $0xc,%esp
+  800b0b:	50                   	push   %eax
+  800b0c:	6a 03                	push   $0x3
+  800b0e:	68 63 2c 80 00       	push   $0x802c63
+  800b13:	6a 3e                	push   $0x3e
+  800b15:	68 80 2c 80 00       	push   $0x802c80
+  800b1a:	e8 40 18 00 00       	call   80235f <_panic>
+
+00800b1f <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800b1f:	55                   	push   %ebp
+  800b20:	89 e5                	mov    %esp,%ebp
+  800b22:	57                   	push   %edi
+  800b23:	56                   	push   %esi
+  800b24:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800b25:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b2a:	b8 02 00 00 00       	mov    $0x2,%eax
+  800b2f:	89 d1                	mov    %edx,%ecx
+  800b31:	89 d3                	mov    %edx,%ebx
+  800b33:	89 d7                	mov    %edx,%edi
+  800b35:	89 d6                	mov    %edx,%esi
+  800b37:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800b39:	5b                   	pop    %ebx
+  800b3a:	5e                   	pop    %esi
+  800b3b:	5f                   	pop    %edi
+  800b3c:	5d                   	pop    %ebp
+  800b3d:	c3                   	ret
+
+00800b3e <sys_yield>:
+
+void
+sys_yield(void) {
+  800b3e:	55                   	push   %ebp
+  800b3f:	89 e5                	mov    %esp,%ebp
+  800b41:	57                   	push   %edi
+  800b42:	56                   	push   %esi
+  800b43:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800b44:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b49:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800b4e:	89 d1                	mov    %edx,%ecx
+  800b50:	89 d3                	mov    %edx,%ebx
+  800b52:	89 d7                	mov    %edx,%edi
+  800b54:	89 d6                	mov    %edx,%esi
+  800b56:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800b58:	5b                   	pop    %ebx
+  800b59:	5e                   	pop    %esi
+  800b5a:	5f                   	pop    %edi
+  800b5b:	5d                   	pop    %ebp
+  800b5c:	c3                   	ret
+
+00800b5d <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  800b5d:	55                   	push   %ebp
+  800b5e:	89 e5                	mov    %esp,%ebp
+  800b60:	57                   	push   %edi
+  800b61:	56                   	push   %esi
+  800b62:	53                   	push   %ebx
+  800b63:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800b66:	be 00 00 00 00       	mov    $0x0,%esi
+  800b6b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b6e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b71:	b8 04 00 00 00       	mov    $0x4,%eax
+  800b76:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b79:	89 f7                	mov    %esi,%edi
+  800b7b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800b7d:	85 c0                	test   %eax,%eax
+  800b7f:	7f 08                	jg     800b89 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800b81:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b84:	5b                   	pop    %ebx
+  800b85:	5e                   	pop    %esi
+  800b86:	5f                   	pop    %edi
+  800b87:	5d                   	pop    %ebp
+  800b88:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800b89:	83 ec 0c             	sub    $0xc,%esp
+  800b8c:	50                   	push   %eax
+  800b8d:	6a 04                	push   $0x4
+  800b8f:	68 63 2c 80 00       	push   $0x802c63
+  800b94:	6a 3e                	push   $0x3e
+  800b96:	68 80 2c 80 00       	push   $0x802c80
+  800b9b:	e8 bf 17 00 00       	call   80235f <_panic>
+
+00800ba0 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  800ba0:	55                   	push   %ebp
+  800ba1:	89 e5                	mov    %esp,%ebp
+  800ba3:	57                   	push   %edi
+  800ba4:	56                   	push   %esi
+  800ba5:	53                   	push   %ebx
+  800ba6:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800ba9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800baf:	b8 05 00 00 00       	mov    $0x5,%eax
+  800bb4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bb7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800bba:	8b 75 18             	mov    0x18(%ebp),%esi
+  800bbd:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800bbf:	85 c0                	test   %eax,%eax
+  800bc1:	7f 08                	jg     800bcb <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800bc3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bc6:	5b                   	pop    %ebx
+  800bc7:	5e                   	pop    %esi
+  800bc8:	5f                   	pop    %edi
+  800bc9:	5d                   	pop    %ebp
+  800bca:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800bcb:	83 ec 0c             	sub    $0xc,%esp
+  800bce:	50                   	push   %eax
+  800bcf:	6a 05                	push   $0x5
+  800bd1:	68 63 2c 80 00       	push   $0x802c63
+  800bd6:	6a 3e                	push   $0x3e
+  800bd8:	68 80 2c 80 00       	push   $0x802c80
+  800bdd:	e8 7d 17 00 00       	call   80235f <_panic>
+
+00800be2 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  800be2:	55                   	push   %ebp
+  800be3:	89 e5                	mov    %esp,%ebp
+  800be5:	57                   	push   %edi
+  800be6:	56                   	push   %esi
+  800be7:	53                   	push   %ebx
+  800be8:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800beb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800bf0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bf3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bf6:	b8 06 00 00 00       	mov    $0x6,%eax
+  800bfb:	89 df                	mov    %ebx,%edi
+  800bfd:	89 de                	mov    %ebx,%esi
+  800bff:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c01:	85 c0                	test   %eax,%eax
+  800c03:	7f 08                	jg     800c0d <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800c05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c08:	5b                   	pop    %ebx
+  800c09:	5e                   	pop    %esi
+  800c0a:	5f                   	pop    %edi
+  800c0b:	5d                   	pop    %ebp
+  800c0c:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c0d:	83 ec 0c             	sub    $0xc,%esp
+  800c10:	50                   	push   %eax
+  800c11:	6a 06                	push   $0x6
+  800c13:	68 63 2c 80 00       	push   $0x802c63
+  800c18:	6a 3e                	push   $0x3e
+  800c1a:	68 80 2c 80 00       	push   $0x802c80
+  800c1f:	e8 3b 17 00 00       	call   80235f <_panic>
+
+00800c24 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800c24:	55                   	push   %ebp
+  800c25:	89 e5                	mov    %esp,%ebp
+  800c27:	57                   	push   %edi
+  800c28:	56                   	push   %esi
+  800c29:	53                   	push   %ebx
+  800c2a:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c2d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c32:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c35:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c38:	b8 08 00 00 00       	mov    $0x8,%eax
+  800c3d:	89 df                	mov    %ebx,%edi
+  800c3f:	89 de                	mov    %ebx,%esi
+  800c41:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c43:	85 c0                	test   %eax,%eax
+  800c45:	7f 08                	jg     800c4f <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800c47:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c4a:	5b                   	pop    %ebx
+  800c4b:	5e                   	pop    %esi
+  800c4c:	5f                   	pop    %edi
+  800c4d:	5d                   	pop    %ebp
+  800c4e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c4f:	83 ec 0c             	sub    $0xc,%esp
+  800c52:	50                   	push   %eax
+  800c53:	6a 08                	push   $0x8
+  800c55:	68 63 2c 80 00       	push   $0x802c63
+  800c5a:	6a 3e                	push   $0x3e
+  800c5c:	68 80 2c 80 00       	push   $0x802c80
+  800c61:	e8 f9 16 00 00       	call   80235f <_panic>
+
+00800c66 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800c66:	55                   	push   %ebp
+  800c67:	89 e5                	mov    %esp,%ebp
+  800c69:	57                   	push   %edi
+  800c6a:	56                   	push   %esi
+  800c6b:	53                   	push   %ebx
+  800c6c:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c6f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c74:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c77:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c7a:	b8 09 00 00 00       	mov    $0x9,%eax
+  800c7f:	89 df                	mov    %ebx,%edi
+  800c81:	89 de                	mov    %ebx,%esi
+  800c83:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c85:	85 c0                	test   %eax,%eax
+  800c87:	7f 08                	jg     800c91 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800c89:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c8c:	5b                   	pop    %ebx
+  800c8d:	5e                   	pop    %esi
+  800c8e:	5f                   	pop    %edi
+  800c8f:	5d                   	pop    %ebp
+  800c90:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c91:	83 ec 0c             	sub    $0xc,%esp
+  800c94:	50                   	push   %eax
+  800c95:	6a 09                	push   $0x9
+  800c97:	68 63 2c 80 00       	push   $0x802c63
+  800c9c:	6a 3e                	push   $0x3e
+  800c9e:	68 80 2c 80 00       	push   $0x802c80
+  800ca3:	e8 b7 16 00 00       	call   80235f <_panic>
+
+00800ca8 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800ca8:	55                   	push   %ebp
+  800ca9:	89 e5                	mov    %esp,%ebp
+  800cab:	57                   	push   %edi
+  800cac:	56                   	push   %esi
+  800cad:	53                   	push   %ebx
+  800cae:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800cb1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cb6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cb9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cbc:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800cc1:	89 df                	mov    %ebx,%edi
+  800cc3:	89 de                	mov    %ebx,%esi
+  800cc5:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800cc7:	85 c0                	test   %eax,%eax
+  800cc9:	7f 08                	jg     800cd3 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800ccb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cce:	5b                   	pop    %ebx
+  800ccf:	5e                   	pop    %esi
+  800cd0:	5f                   	pop    %edi
+  800cd1:	5d                   	pop    %ebp
+  800cd2:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800cd3:	83 ec 0c             	sub    $0xc,%esp
+  800cd6:	50                   	push   %eax
+  800cd7:	6a 0a                	push   $0xa
+  800cd9:	68 63 2c 80 00       	push   $0x802c63
+  800cde:	6a 3e                	push   $0x3e
+  800ce0:	68 80 2c 80 00       	push   $0x802c80
+  800ce5:	e8 75 16 00 00       	call   80235f <_panic>
+
+00800cea <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  800cea:	55                   	push   %ebp
+  800ceb:	89 e5                	mov    %esp,%ebp
+  800ced:	57                   	push   %edi
+  800cee:	56                   	push   %esi
+  800cef:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800cf0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cf3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cf6:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800cfb:	be 00 00 00 00       	mov    $0x0,%esi
+  800d00:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d03:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d06:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800d08:	5b                   	pop    %ebx
+  800d09:	5e                   	pop    %esi
+  800d0a:	5f                   	pop    %edi
+  800d0b:	5d                   	pop    %ebp
+  800d0c:	c3                   	ret
+
+00800d0d <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  800d0d:	55                   	push   %ebp
+  800d0e:	89 e5                	mov    %esp,%ebp
+  800d10:	57                   	push   %edi
+  800d11:	56                   	push   %esi
+  800d12:	53                   	push   %ebx
+  800d13:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800d16:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d1b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d1e:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800d23:	89 cb                	mov    %ecx,%ebx
+  800d25:	89 cf                	mov    %ecx,%edi
+  800d27:	89 ce                	mov    %ecx,%esi
+  800d29:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d2b:	85 c0                	test   %eax,%eax
+  800d2d:	7f 08                	jg     800d37 <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  800d2f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d32:	5b                   	pop    %ebx
+  800d33:	5e                   	pop    %esi
+  800d34:	5f                   	pop    %edi
+  800d35:	5d                   	pop    %ebp
+  800d36:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d37:	83 ec 0c             	sub    $0xc,%esp
+  800d3a:	50                   	push   %eax
+  800d3b:	6a 0d                	push   $0xd
+  800d3d:	68 63 2c 80 00       	push   $0x802c63
+  800d42:	6a 3e                	push   $0x3e
+  800d44:	68 80 2c 80 00       	push   $0x802c80
+  800d49:	e8 11 16 00 00       	call   80235f <_panic>
+
+00800d4e <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  800d4e:	55                   	push   %ebp
+  800d4f:	89 e5                	mov    %esp,%ebp
+  800d51:	57                   	push   %edi
+  800d52:	56                   	push   %esi
+  800d53:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d54:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d59:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d5c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d5f:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800d64:	89 df                	mov    %ebx,%edi
+  800d66:	89 de                	mov    %ebx,%esi
+  800d68:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  800d6a:	5b                   	pop    %ebx
+  800d6b:	5e                   	pop    %esi
+  800d6c:	5f                   	pop    %edi
+  800d6d:	5d                   	pop    %ebp
+  800d6e:	c3                   	ret
+
+00800d6f <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  800d6f:	55                   	push   %ebp
+  800d70:	89 e5                	mov    %esp,%ebp
+  800d72:	57                   	push   %edi
+  800d73:	56                   	push   %esi
+  800d74:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d75:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d7a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d7d:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800d82:	89 cb                	mov    %ecx,%ebx
+  800d84:	89 cf                	mov    %ecx,%edi
+  800d86:	89 ce                	mov    %ecx,%esi
+  800d88:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  800d8a:	5b                   	pop    %ebx
+  800d8b:	5e                   	pop    %esi
+  800d8c:	5f                   	pop    %edi
+  800d8d:	5d                   	pop    %ebp
+  800d8e:	c3                   	ret
+
+00800d8f <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  800d8f:	55                   	push   %ebp
+  800d90:	89 e5                	mov    %esp,%ebp
+  800d92:	57                   	push   %edi
+  800d93:	56                   	push   %esi
+  800d94:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d95:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d9a:	b8 10 00 00 00       	mov    $0x10,%eax
+  800d9f:	89 d1                	mov    %edx,%ecx
+  800da1:	89 d3                	mov    %edx,%ebx
+  800da3:	89 d7                	mov    %edx,%edi
+  800da5:	89 d6                	mov    %edx,%esi
+  800da7:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800da9:	5b                   	pop    %ebx
+  800daa:	5e                   	pop    %esi
+  800dab:	5f                   	pop    %edi
+  800dac:	5d                   	pop    %ebp
+  800dad:	c3                   	ret
+
+00800dae <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  800dae:	55                   	push   %ebp
+  800daf:	89 e5                	mov    %esp,%ebp
+  800db1:	57                   	push   %edi
+  800db2:	56                   	push   %esi
+  800db3:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800db4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800db9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dbc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dbf:	b8 11 00 00 00       	mov    $0x11,%eax
+  800dc4:	89 df                	mov    %ebx,%edi
+  800dc6:	89 de                	mov    %ebx,%esi
+  800dc8:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800dca:	5b                   	pop    %ebx
+  800dcb:	5e                   	pop    %esi
+  800dcc:	5f                   	pop    %edi
+  800dcd:	5d                   	pop    %ebp
+  800dce:	c3                   	ret
+
+00800dcf <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  800dcf:	55                   	push   %ebp
+  800dd0:	89 e5                	mov    %esp,%ebp
+  800dd2:	57                   	push   %edi
+  800dd3:	56                   	push   %esi
+  800dd4:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800dd5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dda:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ddd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800de0:	b8 12 00 00 00       	mov    $0x12,%eax
+  800de5:	89 df                	mov    %ebx,%edi
+  800de7:	89 de                	mov    %ebx,%esi
+  800de9:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800deb:	5b                   	pop    %ebx
+  800dec:	5e                   	pop    %esi
+  800ded:	5f                   	pop    %edi
+  800dee:	5d                   	pop    %ebp
+  800def:	c3                   	ret
+
+00800df0 <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  800df0:	55                   	push   %ebp
+  800df1:	89 e5                	mov    %esp,%ebp
+  800df3:	57                   	push   %edi
+  800df4:	56                   	push   %esi
+  800df5:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800df6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dfb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dfe:	b8 13 00 00 00       	mov    $0x13,%eax
+  800e03:	89 cb                	mov    %ecx,%ebx
+  800e05:	89 cf                	mov    %ecx,%edi
+  800e07:	89 ce                	mov    %ecx,%esi
+  800e09:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  800e0b:	5b                   	pop    %ebx
+  800e0c:	5e                   	pop    %esi
+  800e0d:	5f                   	pop    %edi
+  800e0e:	5d                   	pop    %ebp
+  800e0f:	c3                   	ret
+
+00800e10 <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  800e10:	55                   	push   %ebp
+  800e11:	89 e5                	mov    %esp,%ebp
+  800e13:	57                   	push   %edi
+  800e14:	56                   	push   %esi
+  800e15:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e16:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e1b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e1e:	b8 14 00 00 00       	mov    $0x14,%eax
+  800e23:	89 cb                	mov    %ecx,%ebx
+  800e25:	89 cf                	mov    %ecx,%edi
+  800e27:	89 ce                	mov    %ecx,%esi
+  800e29:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  800e2b:	5b                   	pop    %ebx
+  800e2c:	5e                   	pop    %esi
+  800e2d:	5f                   	pop    %edi
+  800e2e:	5d                   	pop    %ebp
+  800e2f:	c3                   	ret
+
+00800e30 <pgfault>:
+//
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf) {
+  800e30:	55                   	push   %ebp
+  800e31:	89 e5                	mov    %esp,%ebp
+  800e33:	53                   	push   %ebx
+  800e34:	83 ec 04             	sub    $0x4,%esp
+  800e37:	8b 45 08             	mov    0x8(%ebp),%eax
+    void *addr = (void *) utf->utf_fault_va;
+  800e3a:	8b 18                	mov    (%eax),%ebx
+    // Hint:
+    //   Use the read-only page table mappings at uvpt
+    //   (see <inc/memlayout.h>).
+
+    // LAB 4: Your code here.
+    if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P) ||
+  800e3c:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  800e40:	0f 84 95 00 00 00    	je     800edb <pgfault+0xab>
+  800e46:	89 d8                	mov    %ebx,%eax
+  800e48:	c1 e8 16             	shr    $0x16,%eax
+  800e4b:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  800e52:	a8 01                	test   $0x1,%al
+  800e54:	0f 84 81 00 00 00    	je     800edb <pgfault+0xab>
+        (uvpt[PGNUM(addr)] & (PTE_P | PTE_COW)) != (PTE_P | PTE_COW)) {
+  800e5a:	89 d8                	mov    %ebx,%eax
+  800e5c:	c1 e8 0c             	shr    $0xc,%eax
+  800e5f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800e66:	25 01 08 00 00       	and    $0x801,%eax
+    if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P) ||
+  800e6b:	3d 01 08 00 00       	cmp    $0x801,%eax
+  800e70:	75 69                	jne    800edb <pgfault+0xab>
+    // Hint:
+    //   You should make three system calls.
+
+    // LAB 4: Your code here.
+
+    if (sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W))
+  800e72:	83 ec 04             	sub    $0x4,%esp
+  800e75:	6a 07                	push   $0x7
+  800e77:	68 00 f0 7f 00       	push   $0x7ff000
+  800e7c:	6a 00                	push   $0x0
+  800e7e:	e8 da fc ff ff       	call   800b5d <sys_page_alloc>
+  800e83:	83 c4 10             	add    $0x10,%esp
+  800e86:	85 c0                	test   %eax,%eax
+  800e88:	75 65                	jne    800eef <pgfault+0xbf>
+        panic("sys_page_alloc failed");
+
+    addr = ROUNDDOWN(addr, PGSIZE);
+  800e8a:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+    memmove(PFTEMP, addr, PGSIZE);
+  800e90:	83 ec 04             	sub    $0x4,%esp
+  800e93:	68 00 10 00 00       	push   $0x1000
+  800e98:	53                   	push   %ebx
+  800e99:	68 00 f0 7f 00       	push   $0x7ff000
+  800e9e:	e8 54 fa ff ff       	call   8008f7 <memmove>
+
+    if (sys_page_map(0, PFTEMP, 0, addr, PTE_P | PTE_U | PTE_W))
+  800ea3:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  800eaa:	53                   	push   %ebx
+  800eab:	6a 00                	push   $0x0
+  800ead:	68 00 f0 7f 00       	push   $0x7ff000
+  800eb2:	6a 00                	push   $0x0
+  800eb4:	e8 e7 fc ff ff       	call   800ba0 <sys_page_map>
+  800eb9:	83 c4 20             	add    $0x20,%esp
+  800ebc:	85 c0                	test   %eax,%eax
+  800ebe:	75 43                	jne    800f03 <pgfault+0xd3>
+        panic("sys_page_map failed");
+    if (sys_page_unmap(0, PFTEMP))
+  800ec0:	83 ec 08             	sub    $0x8,%esp
+  800ec3:	68 00 f0 7f 00       	push   $0x7ff000
+  800ec8:	6a 00                	push   $0x0
+  800eca:	e8 13 fd ff ff       	call   800be2 <sys_page_unmap>
+  800ecf:	83 c4 10             	add    $0x10,%esp
+  800ed2:	85 c0                	test   %eax,%eax
+  800ed4:	75 41                	jne    800f17 <pgfault+0xe7>
+        panic("sys_page_unmap failed");
+
+}
+  800ed6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ed9:	c9                   	leave
+  800eda:	c3                   	ret
+        panic("pgfault: faulting access invalid");
+  800edb:	83 ec 04             	sub    $0x4,%esp
+  800ede:	68 90 2c 80 00       	push   $0x802c90
+  800ee3:	6a 1e                	push   $0x1e
+  800ee5:	68 fc 2c 80 00       	push   $0x802cfc
+  800eea:	e8 70 14 00 00       	call   80235f <_panic>
+        panic("sys_page_alloc failed");
+  800eef:	83 ec 04             	sub    $0x4,%esp
+  800ef2:	68 6f 2d 80 00       	push   $0x802d6f
+  800ef7:	6a 2a                	push   $0x2a
+  800ef9:	68 fc 2c 80 00       	push   $0x802cfc
+  800efe:	e8 5c 14 00 00       	call   80235f <_panic>
+        panic("sys_page_map failed");
+  800f03:	83 ec 04             	sub    $0x4,%esp
+  800f06:	68 07 2d 80 00       	push   $0x802d07
+  800f0b:	6a 30                	push   $0x30
+  800f0d:	68 fc 2c 80 00       	push   $0x802cfc
+  800f12:	e8 48 14 00 00       	call   80235f <_panic>
+        panic("sys_page_unmap failed");
+  800f17:	83 ec 04             	sub    $0x4,%esp
+  800f1a:	68 1b 2d 80 00       	push   $0x802d1b
+  800f1f:	6a 32                	push   $0x32
+  800f21:	68 fc 2c 80 00       	push   $0x802cfc
+  800f26:	e8 34 14 00 00       	call   80235f <_panic>
+
+00800f2b <fork>:
+//   Remember to fix "thisenv" in the child process.
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void) {
+  800f2b:	55                   	push   %ebp
+  800f2c:	89 e5                	mov    %esp,%ebp
+  800f2e:	57                   	push   %edi
+  800f2f:	56                   	push   %esi
+  800f30:	53                   	push   %ebx
+  800f31:	83 ec 18             	sub    $0x18,%esp
+    // LAB 4: Your code here.
+    set_pgfault_handler(pgfault);
+  800f34:	68 30 0e 80 00       	push   $0x800e30
+  800f39:	e8 67 14 00 00       	call   8023a5 <set_pgfault_handler>
+
+// This must be inlined.  Exercise for reader: why?
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+  envid_t ret;
+  asm volatile("int %2"
+  800f3e:	b8 07 00 00 00       	mov    $0x7,%eax
+  800f43:	cd 30                	int    $0x30
+  800f45:	89 c6                	mov    %eax,%esi
+
+    envid_t envid = sys_exofork();
+    if (envid < 0)
+  800f47:	83 c4 10             	add    $0x10,%esp
+  800f4a:	85 c0                	test   %eax,%eax
+  800f4c:	78 2a                	js     800f78 <fork+0x4d>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+
+    uintptr_t addr;
+    for (addr = 0; addr < UTOP; addr += PGSIZE) {
+  800f4e:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (envid == 0) {
+  800f53:	0f 85 a2 00 00 00    	jne    800ffb <fork+0xd0>
+        thisenv = &envs[ENVX(sys_getenvid())];
+  800f59:	e8 c1 fb ff ff       	call   800b1f <sys_getenvid>
+  800f5e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800f63:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800f66:	c1 e0 04             	shl    $0x4,%eax
+  800f69:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800f6e:	a3 08 40 80 00       	mov    %eax,0x804008
+        return 0;
+  800f73:	e9 6c 01 00 00       	jmp    8010e4 <fork+0x1b9>
+        panic("fork: sys_exofork error: %e", envid);
+  800f78:	50                   	push   %eax
+  800f79:	68 31 2d 80 00       	push   $0x802d31
+  800f7e:	6a 6f                	push   $0x6f
+  800f80:	68 fc 2c 80 00       	push   $0x802cfc
+  800f85:	e8 d5 13 00 00       	call   80235f <_panic>
+        if ((r = sys_page_map(0, vptr, envid, vptr, uvpt[pn] & PTE_SYSCALL)) < 0)
+  800f8a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800f91:	83 ec 0c             	sub    $0xc,%esp
+  800f94:	25 07 0e 00 00       	and    $0xe07,%eax
+  800f99:	50                   	push   %eax
+  800f9a:	57                   	push   %edi
+  800f9b:	56                   	push   %esi
+  800f9c:	57                   	push   %edi
+  800f9d:	6a 00                	push   $0x0
+  800f9f:	e8 fc fb ff ff       	call   800ba0 <sys_page_map>
+  800fa4:	83 c4 20             	add    $0x20,%esp
+  800fa7:	85 c0                	test   %eax,%eax
+  800fa9:	79 3e                	jns    800fe9 <fork+0xbe>
+            panic("duppage :in sys_page_map %e", r);
+  800fab:	50                   	push   %eax
+  800fac:	68 4d 2d 80 00       	push   $0x802d4d
+  800fb1:	6a 49                	push   $0x49
+  800fb3:	68 fc 2c 80 00       	push   $0x802cfc
+  800fb8:	e8 a2 13 00 00       	call   80235f <_panic>
+            panic("duppage :in sys_page_map %e", r);
+  800fbd:	50                   	push   %eax
+  800fbe:	68 4d 2d 80 00       	push   $0x802d4d
+  800fc3:	6a 4e                	push   $0x4e
+  800fc5:	68 fc 2c 80 00       	push   $0x802cfc
+  800fca:	e8 90 13 00 00       	call   80235f <_panic>
+    } else if ((r = sys_page_map(0, vptr, envid, vptr, PTE_P | PTE_U)) < 0)
+  800fcf:	83 ec 0c             	sub    $0xc,%esp
+  800fd2:	6a 05                	push   $0x5
+  800fd4:	57                   	push   %edi
+  800fd5:	56                   	push   %esi
+  800fd6:	57                   	push   %edi
+  800fd7:	6a 00                	push   $0x0
+  800fd9:	e8 c2 fb ff ff       	call   800ba0 <sys_page_map>
+  800fde:	83 c4 20             	add    $0x20,%esp
+  800fe1:	85 c0                	test   %eax,%eax
+  800fe3:	0f 88 ab 00 00 00    	js     801094 <fork+0x169>
+    for (addr = 0; addr < UTOP; addr += PGSIZE) {
+  800fe9:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  800fef:	81 fb 00 00 c0 ee    	cmp    $0xeec00000,%ebx
+  800ff5:	0f 84 ab 00 00 00    	je     8010a6 <fork+0x17b>
+        if (uvpd[PDX(addr)] & PTE_P && uvpt[PGNUM(addr)] & PTE_P && addr != UXSTACKTOP - PGSIZE) {
+  800ffb:	89 d8                	mov    %ebx,%eax
+  800ffd:	c1 e8 16             	shr    $0x16,%eax
+  801000:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801007:	a8 01                	test   $0x1,%al
+  801009:	74 de                	je     800fe9 <fork+0xbe>
+  80100b:	89 d8                	mov    %ebx,%eax
+  80100d:	c1 e8 0c             	shr    $0xc,%eax
+  801010:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801017:	f6 c2 01             	test   $0x1,%dl
+  80101a:	74 cd                	je     800fe9 <fork+0xbe>
+  80101c:	81 fb 00 f0 bf ee    	cmp    $0xeebff000,%ebx
+  801022:	74 c5                	je     800fe9 <fork+0xbe>
+    void *vptr = (void *) (pn * PGSIZE);
+  801024:	89 c7                	mov    %eax,%edi
+  801026:	c1 e7 0c             	shl    $0xc,%edi
+    if (uvpt[pn] & PTE_SHARE) {
+  801029:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801030:	f6 c6 04             	test   $0x4,%dh
+  801033:	0f 85 51 ff ff ff    	jne    800f8a <fork+0x5f>
+    } else if (uvpt[pn] & (PTE_W | PTE_COW)) {
+  801039:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801040:	a9 02 08 00 00       	test   $0x802,%eax
+  801045:	74 88                	je     800fcf <fork+0xa4>
+        if ((r = sys_page_map(0, vptr, envid, vptr, PTE_P | PTE_U | PTE_COW)) < 0)
+  801047:	83 ec 0c             	sub    $0xc,%esp
+  80104a:	68 05 08 00 00       	push   $0x805
+  80104f:	57                   	push   %edi
+  801050:	56                   	push   %esi
+  801051:	57                   	push   %edi
+  801052:	6a 00                	push   $0x0
+  801054:	e8 47 fb ff ff       	call   800ba0 <sys_page_map>
+  801059:	83 c4 20             	add    $0x20,%esp
+  80105c:	85 c0                	test   %eax,%eax
+  80105e:	0f 88 59 ff ff ff    	js     800fbd <fork+0x92>
+        if ((r = sys_page_map(0, vptr, 0, vptr, PTE_P | PTE_U | PTE_COW)) < 0)
+  801064:	83 ec 0c             	sub    $0xc,%esp
+  801067:	68 05 08 00 00       	push   $0x805
+  80106c:	57                   	push   %edi
+  80106d:	6a 00                	push   $0x0
+  80106f:	57                   	push   %edi
+  801070:	6a 00                	push   $0x0
+  801072:	e8 29 fb ff ff       	call   800ba0 <sys_page_map>
+  801077:	83 c4 20             	add    $0x20,%esp
+  80107a:	85 c0                	test   %eax,%eax
+  80107c:	0f 89 67 ff ff ff    	jns    800fe9 <fork+0xbe>
+            panic("duppage :in sys_page_map %e", r);
+  801082:	50                   	push   %eax
+  801083:	68 4d 2d 80 00       	push   $0x802d4d
+  801088:	6a 50                	push   $0x50
+  80108a:	68 fc 2c 80 00       	push   $0x802cfc
+  80108f:	e8 cb 12 00 00       	call   80235f <_panic>
+        panic("duppage :in sys_page_map %e", r);
+  801094:	50                   	push   %eax
+  801095:	68 4d 2d 80 00       	push   $0x802d4d
+  80109a:	6a 53                	push   $0x53
+  80109c:	68 fc 2c 80 00       	push   $0x802cfc
+  8010a1:	e8 b9 12 00 00       	call   80235f <_panic>
+            duppage(envid, PGNUM(addr));
+        }
+    }
+    if (sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W))
+  8010a6:	83 ec 04             	sub    $0x4,%esp
+  8010a9:	6a 07                	push   $0x7
+  8010ab:	68 00 f0 bf ee       	push   $0xeebff000
+  8010b0:	56                   	push   %esi
+  8010b1:	e8 a7 fa ff ff       	call   800b5d <sys_page_alloc>
+  8010b6:	83 c4 10             	add    $0x10,%esp
+  8010b9:	85 c0                	test   %eax,%eax
+  8010bb:	75 31                	jne    8010ee <fork+0x1c3>
+        panic("fork: sys_page_alloc failed");
+    if (sys_env_set_pgfault_upcall(envid, _pgfault_upcall))
+  8010bd:	83 ec 08             	sub    $0x8,%esp
+  8010c0:	68 10 24 80 00       	push   $0x802410
+  8010c5:	56                   	push   %esi
+  8010c6:	e8 dd fb ff ff       	call   800ca8 <sys_env_set_pgfault_upcall>
+  8010cb:	83 c4 10             	add    $0x10,%esp
+  8010ce:	85 c0                	test   %eax,%eax
+  8010d0:	75 30                	jne    801102 <fork+0x1d7>
+        panic("fork: sys_env_set_pgfault_upcall failed");
+    if (sys_env_set_status(envid, ENV_RUNNABLE))
+  8010d2:	83 ec 08             	sub    $0x8,%esp
+  8010d5:	6a 02                	push   $0x2
+  8010d7:	56                   	push   %esi
+  8010d8:	e8 47 fb ff ff       	call   800c24 <sys_env_set_status>
+  8010dd:	83 c4 10             	add    $0x10,%esp
+  8010e0:	85 c0                	test   %eax,%eax
+  8010e2:	75 32                	jne    801116 <fork+0x1eb>
+        panic("fork: sys_env_set_status failed");
+
+    return envid;
+
+}
+  8010e4:	89 f0                	mov    %esi,%eax
+  8010e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010e9:	5b                   	pop    %ebx
+  8010ea:	5e                   	pop    %esi
+  8010eb:	5f                   	pop    %edi
+  8010ec:	5d                   	pop    %ebp
+  8010ed:	c3                   	ret
+        panic("fork: sys_page_alloc failed");
+  8010ee:	83 ec 04             	sub    $0x4,%esp
+  8010f1:	68 69 2d 80 00       	push   $0x802d69
+  8010f6:	6a 7d                	push   $0x7d
+  8010f8:	68 fc 2c 80 00       	push   $0x802cfc
+  8010fd:	e8 5d 12 00 00       	call   80235f <_panic>
+        panic("fork: sys_env_set_pgfault_upcall failed");
+  801102:	83 ec 04             	sub    $0x4,%esp
+  801105:	68 b4 2c 80 00       	push   $0x802cb4
+  80110a:	6a 7f                	push   $0x7f
+  80110c:	68 fc 2c 80 00       	push   $0x802cfc
+  801111:	e8 49 12 00 00       	call   80235f <_panic>
+        panic("fork: sys_env_set_status failed");
+  801116:	83 ec 04             	sub    $0x4,%esp
+  801119:	68 dc 2c 80 00       	push   $0x802cdc
+  80111e:	68 81 00 00 00       	push   $0x81
+  801123:	68 fc 2c 80 00       	push   $0x802cfc
+  801128:	e8 32 12 00 00       	call   80235f <_panic>
+
+0080112d <sfork>:
+
+// Challenge!
+int
+sfork(void) {
+  80112d:	55                   	push   %ebp
+  80112e:	89 e5                	mov    %esp,%ebp
+  801130:	83 ec 0c             	sub    $0xc,%esp
+    panic("sfork not implemented");
+  801133:	68 85 2d 80 00       	push   $0x802d85
+  801138:	68 8a 00 00 00       	push   $0x8a
+  80113d:	68 fc 2c 80 00       	push   $0x802cfc
+  801142:	e8 18 12 00 00       	call   80235f <_panic>
+
+00801147 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  801147:	55                   	push   %ebp
+  801148:	89 e5                	mov    %esp,%ebp
+  80114a:	56                   	push   %esi
+  80114b:	53                   	push   %ebx
+  80114c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80114f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801152:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  801155:	85 c0                	test   %eax,%eax
+  801157:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80115c:	0f 44 c2             	cmove  %edx,%eax
+  80115f:	83 ec 0c             	sub    $0xc,%esp
+  801162:	50                   	push   %eax
+  801163:	e8 a5 fb ff ff       	call   800d0d <sys_ipc_recv>
+
+  if (from_env_store)
+  801168:	83 c4 10             	add    $0x10,%esp
+  80116b:	85 f6                	test   %esi,%esi
+  80116d:	74 17                	je     801186 <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  80116f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801174:	85 c0                	test   %eax,%eax
+  801176:	75 0c                	jne    801184 <ipc_recv+0x3d>
+  801178:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  80117e:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  801184:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  801186:	85 db                	test   %ebx,%ebx
+  801188:	74 2b                	je     8011b5 <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  80118a:	85 c0                	test   %eax,%eax
+  80118c:	74 0d                	je     80119b <ipc_recv+0x54>
+  80118e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  801194:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801197:	5b                   	pop    %ebx
+  801198:	5e                   	pop    %esi
+  801199:	5d                   	pop    %ebp
+  80119a:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  80119b:	a1 08 40 80 00       	mov    0x804008,%eax
+  8011a0:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8011a6:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  8011a8:	a1 08 40 80 00       	mov    0x804008,%eax
+  8011ad:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  8011b3:	eb df                	jmp    801194 <ipc_recv+0x4d>
+  8011b5:	85 c0                	test   %eax,%eax
+  8011b7:	75 db                	jne    801194 <ipc_recv+0x4d>
+  8011b9:	eb ed                	jmp    8011a8 <ipc_recv+0x61>
+
+008011bb <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  8011bb:	55                   	push   %ebp
+  8011bc:	89 e5                	mov    %esp,%ebp
+  8011be:	57                   	push   %edi
+  8011bf:	56                   	push   %esi
+  8011c0:	53                   	push   %ebx
+  8011c1:	83 ec 0c             	sub    $0xc,%esp
+  8011c4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8011c7:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8011ca:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  8011cd:	85 db                	test   %ebx,%ebx
+  8011cf:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8011d4:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  8011d7:	ff 75 14             	push   0x14(%ebp)
+  8011da:	53                   	push   %ebx
+  8011db:	56                   	push   %esi
+  8011dc:	57                   	push   %edi
+  8011dd:	e8 08 fb ff ff       	call   800cea <sys_ipc_try_send>
+  8011e2:	83 c4 10             	add    $0x10,%esp
+  8011e5:	85 c0                	test   %eax,%eax
+  8011e7:	74 1e                	je     801207 <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  8011e9:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8011ec:	75 07                	jne    8011f5 <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  8011ee:	e8 4b f9 ff ff       	call   800b3e <sys_yield>
+  8011f3:	eb e2                	jmp    8011d7 <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  8011f5:	50                   	push   %eax
+  8011f6:	68 9b 2d 80 00       	push   $0x802d9b
+  8011fb:	6a 3c                	push   $0x3c
+  8011fd:	68 a8 2d 80 00       	push   $0x802da8
+  801202:	e8 58 11 00 00       	call   80235f <_panic>
+  }
+
+#endif
+}
+  801207:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80120a:	5b                   	pop    %ebx
+  80120b:	5e                   	pop    %esi
+  80120c:	5f                   	pop    %edi
+  80120d:	5d                   	pop    %ebp
+  80120e:	c3                   	ret
+
+0080120f <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  80120f:	55                   	push   %ebp
+  801210:	89 e5                	mov    %esp,%ebp
+  801212:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  801215:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  80121a:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80121d:	c1 e0 04             	shl    $0x4,%eax
+  801220:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801225:	8b 40 50             	mov    0x50(%eax),%eax
+  801228:	39 c8                	cmp    %ecx,%eax
+  80122a:	74 12                	je     80123e <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  80122c:	83 c2 01             	add    $0x1,%edx
+  80122f:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  801235:	75 e3                	jne    80121a <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  801237:	b8 00 00 00 00       	mov    $0x0,%eax
+  80123c:	eb 0e                	jmp    80124c <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  80123e:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  801241:	c1 e0 04             	shl    $0x4,%eax
+  801244:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801249:	8b 40 48             	mov    0x48(%eax),%eax
+  80124c:	5d                   	pop    %ebp
+  80124d:	c3                   	ret
+
+0080124e <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80124e:	55                   	push   %ebp
+  80124f:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801251:	8b 45 08             	mov    0x8(%ebp),%eax
+  801254:	05 00 00 00 30       	add    $0x30000000,%eax
+  801259:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80125c:	5d                   	pop    %ebp
+  80125d:	c3                   	ret
+
+0080125e <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80125e:	55                   	push   %ebp
+  80125f:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801261:	8b 45 08             	mov    0x8(%ebp),%eax
+  801264:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801269:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80126e:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801273:	5d                   	pop    %ebp
+  801274:	c3                   	ret
+
+00801275 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801275:	55                   	push   %ebp
+  801276:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801278:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80127d:	eb 02                	jmp    801281 <fd_alloc+0xc>
+  80127f:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801281:	89 c2                	mov    %eax,%edx
+  801283:	c1 ea 16             	shr    $0x16,%edx
+  801286:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80128d:	f6 c2 01             	test   $0x1,%dl
+  801290:	74 2b                	je     8012bd <fd_alloc+0x48>
+  801292:	89 c2                	mov    %eax,%edx
+  801294:	c1 ea 0c             	shr    $0xc,%edx
+  801297:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80129e:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8012a4:	f6 c1 01             	test   $0x1,%cl
+  8012a7:	74 14                	je     8012bd <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8012a9:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8012af:	75 ce                	jne    80127f <fd_alloc+0xa>
+  8012b1:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8012b6:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8012bb:	eb 05                	jmp    8012c2 <fd_alloc+0x4d>
+			return 0;
+  8012bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8012c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012c5:	89 02                	mov    %eax,(%edx)
+}
+  8012c7:	89 c8                	mov    %ecx,%eax
+  8012c9:	5d                   	pop    %ebp
+  8012ca:	c3                   	ret
+
+008012cb <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8012cb:	55                   	push   %ebp
+  8012cc:	89 e5                	mov    %esp,%ebp
+  8012ce:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8012d1:	83 f8 1f             	cmp    $0x1f,%eax
+  8012d4:	77 30                	ja     801306 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8012d6:	c1 e0 0c             	shl    $0xc,%eax
+  8012d9:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8012de:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8012e4:	f6 c2 01             	test   $0x1,%dl
+  8012e7:	74 24                	je     80130d <fd_lookup+0x42>
+  8012e9:	89 c2                	mov    %eax,%edx
+  8012eb:	c1 ea 0c             	shr    $0xc,%edx
+  8012ee:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8012f5:	f6 c2 01             	test   $0x1,%dl
+  8012f8:	74 1a                	je     801314 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8012fa:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012fd:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8012ff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801304:	5d                   	pop    %ebp
+  801305:	c3                   	ret
+		return -E_INVAL;
+  801306:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80130b:	eb f7                	jmp    801304 <fd_lookup+0x39>
+		return -E_INVAL;
+  80130d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801312:	eb f0                	jmp    801304 <fd_lookup+0x39>
+  801314:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801319:	eb e9                	jmp    801304 <fd_lookup+0x39>
+
+0080131b <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80131b:	55                   	push   %ebp
+  80131c:	89 e5                	mov    %esp,%ebp
+  80131e:	53                   	push   %ebx
+  80131f:	83 ec 04             	sub    $0x4,%esp
+  801322:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801325:	b8 00 00 00 00       	mov    $0x0,%eax
+  80132a:	eb 03                	jmp    80132f <dev_lookup+0x14>
+  80132c:	83 c0 01             	add    $0x1,%eax
+  80132f:	8b 1c 85 30 2e 80 00 	mov    0x802e30(,%eax,4),%ebx
+  801336:	85 db                	test   %ebx,%ebx
+  801338:	74 0b                	je     801345 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  80133a:	39 13                	cmp    %edx,(%ebx)
+  80133c:	75 ee                	jne    80132c <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  80133e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801343:	eb 1f                	jmp    801364 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801345:	a1 08 40 80 00       	mov    0x804008,%eax
+  80134a:	8b 40 48             	mov    0x48(%eax),%eax
+  80134d:	83 ec 04             	sub    $0x4,%esp
+  801350:	52                   	push   %edx
+  801351:	50                   	push   %eax
+  801352:	68 b4 2d 80 00       	push   $0x802db4
+  801357:	e8 5c ee ff ff       	call   8001b8 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80135c:	83 c4 10             	add    $0x10,%esp
+  80135f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801364:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801367:	89 1a                	mov    %ebx,(%edx)
+}
+  801369:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80136c:	c9                   	leave
+  80136d:	c3                   	ret
+
+0080136e <fd_close>:
+{
+  80136e:	55                   	push   %ebp
+  80136f:	89 e5                	mov    %esp,%ebp
+  801371:	57                   	push   %edi
+  801372:	56                   	push   %esi
+  801373:	53                   	push   %ebx
+  801374:	83 ec 24             	sub    $0x24,%esp
+  801377:	8b 75 08             	mov    0x8(%ebp),%esi
+  80137a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80137d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801380:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801381:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801387:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80138a:	50                   	push   %eax
+  80138b:	e8 3b ff ff ff       	call   8012cb <fd_lookup>
+  801390:	89 c3                	mov    %eax,%ebx
+  801392:	83 c4 10             	add    $0x10,%esp
+  801395:	85 c0                	test   %eax,%eax
+  801397:	78 05                	js     80139e <fd_close+0x30>
+	    || fd != fd2)
+  801399:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80139c:	74 16                	je     8013b4 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80139e:	89 f8                	mov    %edi,%eax
+  8013a0:	84 c0                	test   %al,%al
+  8013a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013a7:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8013aa:	89 d8                	mov    %ebx,%eax
+  8013ac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013af:	5b                   	pop    %ebx
+  8013b0:	5e                   	pop    %esi
+  8013b1:	5f                   	pop    %edi
+  8013b2:	5d                   	pop    %ebp
+  8013b3:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8013b4:	83 ec 08             	sub    $0x8,%esp
+  8013b7:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8013ba:	50                   	push   %eax
+  8013bb:	ff 36                	push   (%esi)
+  8013bd:	e8 59 ff ff ff       	call   80131b <dev_lookup>
+  8013c2:	89 c3                	mov    %eax,%ebx
+  8013c4:	83 c4 10             	add    $0x10,%esp
+  8013c7:	85 c0                	test   %eax,%eax
+  8013c9:	78 1a                	js     8013e5 <fd_close+0x77>
+		if (dev->dev_close)
+  8013cb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8013ce:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8013d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8013d6:	85 c0                	test   %eax,%eax
+  8013d8:	74 0b                	je     8013e5 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8013da:	83 ec 0c             	sub    $0xc,%esp
+  8013dd:	56                   	push   %esi
+  8013de:	ff d0                	call   *%eax
+  8013e0:	89 c3                	mov    %eax,%ebx
+  8013e2:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8013e5:	83 ec 08             	sub    $0x8,%esp
+  8013e8:	56                   	push   %esi
+  8013e9:	6a 00                	push   $0x0
+  8013eb:	e8 f2 f7 ff ff       	call   800be2 <sys_page_unmap>
+	return r;
+  8013f0:	83 c4 10             	add    $0x10,%esp
+  8013f3:	eb b5                	jmp    8013aa <fd_close+0x3c>
+
+008013f5 <close>:
+
+int
+close(int fdnum)
+{
+  8013f5:	55                   	push   %ebp
+  8013f6:	89 e5                	mov    %esp,%ebp
+  8013f8:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8013fb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013fe:	50                   	push   %eax
+  8013ff:	ff 75 08             	push   0x8(%ebp)
+  801402:	e8 c4 fe ff ff       	call   8012cb <fd_lookup>
+  801407:	83 c4 10             	add    $0x10,%esp
+  80140a:	85 c0                	test   %eax,%eax
+  80140c:	79 02                	jns    801410 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80140e:	c9                   	leave
+  80140f:	c3                   	ret
+		return fd_close(fd, 1);
+  801410:	83 ec 08             	sub    $0x8,%esp
+  801413:	6a 01                	push   $0x1
+  801415:	ff 75 f4             	push   -0xc(%ebp)
+  801418:	e8 51 ff ff ff       	call   80136e <fd_close>
+  80141d:	83 c4 10             	add    $0x10,%esp
+  801420:	eb ec                	jmp    80140e <close+0x19>
+
+00801422 <close_all>:
+
+void
+close_all(void)
+{
+  801422:	55                   	push   %ebp
+  801423:	89 e5                	mov    %esp,%ebp
+  801425:	53                   	push   %ebx
+  801426:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801429:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80142e:	83 ec 0c             	sub    $0xc,%esp
+  801431:	53                   	push   %ebx
+  801432:	e8 be ff ff ff       	call   8013f5 <close>
+	for (i = 0; i < MAXFD; i++)
+  801437:	83 c3 01             	add    $0x1,%ebx
+  80143a:	83 c4 10             	add    $0x10,%esp
+  80143d:	83 fb 20             	cmp    $0x20,%ebx
+  801440:	75 ec                	jne    80142e <close_all+0xc>
+}
+  801442:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801445:	c9                   	leave
+  801446:	c3                   	ret
+
+00801447 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801447:	55                   	push   %ebp
+  801448:	89 e5                	mov    %esp,%ebp
+  80144a:	57                   	push   %edi
+  80144b:	56                   	push   %esi
+  80144c:	53                   	push   %ebx
+  80144d:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801450:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801453:	50                   	push   %eax
+  801454:	ff 75 08             	push   0x8(%ebp)
+  801457:	e8 6f fe ff ff       	call   8012cb <fd_lookup>
+  80145c:	89 c3                	mov    %eax,%ebx
+  80145e:	83 c4 10             	add    $0x10,%esp
+  801461:	85 c0                	test   %eax,%eax
+  801463:	78 7f                	js     8014e4 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801465:	83 ec 0c             	sub    $0xc,%esp
+  801468:	ff 75 0c             	push   0xc(%ebp)
+  80146b:	e8 85 ff ff ff       	call   8013f5 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801470:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801473:	c1 e6 0c             	shl    $0xc,%esi
+  801476:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80147c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80147f:	89 3c 24             	mov    %edi,(%esp)
+  801482:	e8 d7 fd ff ff       	call   80125e <fd2data>
+  801487:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801489:	89 34 24             	mov    %esi,(%esp)
+  80148c:	e8 cd fd ff ff       	call   80125e <fd2data>
+  801491:	83 c4 10             	add    $0x10,%esp
+  801494:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801497:	89 d8                	mov    %ebx,%eax
+  801499:	c1 e8 16             	shr    $0x16,%eax
+  80149c:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8014a3:	a8 01                	test   $0x1,%al
+  8014a5:	74 11                	je     8014b8 <dup+0x71>
+  8014a7:	89 d8                	mov    %ebx,%eax
+  8014a9:	c1 e8 0c             	shr    $0xc,%eax
+  8014ac:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8014b3:	f6 c2 01             	test   $0x1,%dl
+  8014b6:	75 36                	jne    8014ee <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8014b8:	89 f8                	mov    %edi,%eax
+  8014ba:	c1 e8 0c             	shr    $0xc,%eax
+  8014bd:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8014c4:	83 ec 0c             	sub    $0xc,%esp
+  8014c7:	25 07 0e 00 00       	and    $0xe07,%eax
+  8014cc:	50                   	push   %eax
+  8014cd:	56                   	push   %esi
+  8014ce:	6a 00                	push   $0x0
+  8014d0:	57                   	push   %edi
+  8014d1:	6a 00                	push   $0x0
+  8014d3:	e8 c8 f6 ff ff       	call   800ba0 <sys_page_map>
+  8014d8:	89 c3                	mov    %eax,%ebx
+  8014da:	83 c4 20             	add    $0x20,%esp
+  8014dd:	85 c0                	test   %eax,%eax
+  8014df:	78 33                	js     801514 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8014e1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8014e4:	89 d8                	mov    %ebx,%eax
+  8014e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014e9:	5b                   	pop    %ebx
+  8014ea:	5e                   	pop    %esi
+  8014eb:	5f                   	pop    %edi
+  8014ec:	5d                   	pop    %ebp
+  8014ed:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8014ee:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8014f5:	83 ec 0c             	sub    $0xc,%esp
+  8014f8:	25 07 0e 00 00       	and    $0xe07,%eax
+  8014fd:	50                   	push   %eax
+  8014fe:	ff 75 d4             	push   -0x2c(%ebp)
+  801501:	6a 00                	push   $0x0
+  801503:	53                   	push   %ebx
+  801504:	6a 00                	push   $0x0
+  801506:	e8 95 f6 ff ff       	call   800ba0 <sys_page_map>
+  80150b:	89 c3                	mov    %eax,%ebx
+  80150d:	83 c4 20             	add    $0x20,%esp
+  801510:	85 c0                	test   %eax,%eax
+  801512:	79 a4                	jns    8014b8 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801514:	83 ec 08             	sub    $0x8,%esp
+  801517:	56                   	push   %esi
+  801518:	6a 00                	push   $0x0
+  80151a:	e8 c3 f6 ff ff       	call   800be2 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  80151f:	83 c4 08             	add    $0x8,%esp
+  801522:	ff 75 d4             	push   -0x2c(%ebp)
+  801525:	6a 00                	push   $0x0
+  801527:	e8 b6 f6 ff ff       	call   800be2 <sys_page_unmap>
+	return r;
+  80152c:	83 c4 10             	add    $0x10,%esp
+  80152f:	eb b3                	jmp    8014e4 <dup+0x9d>
+
+00801531 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801531:	55                   	push   %ebp
+  801532:	89 e5                	mov    %esp,%ebp
+  801534:	56                   	push   %esi
+  801535:	53                   	push   %ebx
+  801536:	83 ec 18             	sub    $0x18,%esp
+  801539:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80153c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80153f:	50                   	push   %eax
+  801540:	56                   	push   %esi
+  801541:	e8 85 fd ff ff       	call   8012cb <fd_lookup>
+  801546:	83 c4 10             	add    $0x10,%esp
+  801549:	85 c0                	test   %eax,%eax
+  80154b:	78 3c                	js     801589 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80154d:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801550:	83 ec 08             	sub    $0x8,%esp
+  801553:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801556:	50                   	push   %eax
+  801557:	ff 33                	push   (%ebx)
+  801559:	e8 bd fd ff ff       	call   80131b <dev_lookup>
+  80155e:	83 c4 10             	add    $0x10,%esp
+  801561:	85 c0                	test   %eax,%eax
+  801563:	78 24                	js     801589 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801565:	8b 43 08             	mov    0x8(%ebx),%eax
+  801568:	83 e0 03             	and    $0x3,%eax
+  80156b:	83 f8 01             	cmp    $0x1,%eax
+  80156e:	74 20                	je     801590 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801570:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801573:	8b 40 08             	mov    0x8(%eax),%eax
+  801576:	85 c0                	test   %eax,%eax
+  801578:	74 37                	je     8015b1 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80157a:	83 ec 04             	sub    $0x4,%esp
+  80157d:	ff 75 10             	push   0x10(%ebp)
+  801580:	ff 75 0c             	push   0xc(%ebp)
+  801583:	53                   	push   %ebx
+  801584:	ff d0                	call   *%eax
+  801586:	83 c4 10             	add    $0x10,%esp
+}
+  801589:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80158c:	5b                   	pop    %ebx
+  80158d:	5e                   	pop    %esi
+  80158e:	5d                   	pop    %ebp
+  80158f:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801590:	a1 08 40 80 00       	mov    0x804008,%eax
+  801595:	8b 40 48             	mov    0x48(%eax),%eax
+  801598:	83 ec 04             	sub    $0x4,%esp
+  80159b:	56                   	push   %esi
+  80159c:	50                   	push   %eax
+  80159d:	68 f5 2d 80 00       	push   $0x802df5
+  8015a2:	e8 11 ec ff ff       	call   8001b8 <cprintf>
+		return -E_INVAL;
+  8015a7:	83 c4 10             	add    $0x10,%esp
+  8015aa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015af:	eb d8                	jmp    801589 <read+0x58>
+		return -E_NOT_SUPP;
+  8015b1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015b6:	eb d1                	jmp    801589 <read+0x58>
+
+008015b8 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8015b8:	55                   	push   %ebp
+  8015b9:	89 e5                	mov    %esp,%ebp
+  8015bb:	57                   	push   %edi
+  8015bc:	56                   	push   %esi
+  8015bd:	53                   	push   %ebx
+  8015be:	83 ec 0c             	sub    $0xc,%esp
+  8015c1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8015c4:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8015c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015cc:	eb 02                	jmp    8015d0 <readn+0x18>
+  8015ce:	01 c3                	add    %eax,%ebx
+  8015d0:	39 f3                	cmp    %esi,%ebx
+  8015d2:	73 21                	jae    8015f5 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8015d4:	83 ec 04             	sub    $0x4,%esp
+  8015d7:	89 f0                	mov    %esi,%eax
+  8015d9:	29 d8                	sub    %ebx,%eax
+  8015db:	50                   	push   %eax
+  8015dc:	89 d8                	mov    %ebx,%eax
+  8015de:	03 45 0c             	add    0xc(%ebp),%eax
+  8015e1:	50                   	push   %eax
+  8015e2:	57                   	push   %edi
+  8015e3:	e8 49 ff ff ff       	call   801531 <read>
+		if (m < 0)
+  8015e8:	83 c4 10             	add    $0x10,%esp
+  8015eb:	85 c0                	test   %eax,%eax
+  8015ed:	78 04                	js     8015f3 <readn+0x3b>
+			return m;
+		if (m == 0)
+  8015ef:	75 dd                	jne    8015ce <readn+0x16>
+  8015f1:	eb 02                	jmp    8015f5 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8015f3:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8015f5:	89 d8                	mov    %ebx,%eax
+  8015f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015fa:	5b                   	pop    %ebx
+  8015fb:	5e                   	pop    %esi
+  8015fc:	5f                   	pop    %edi
+  8015fd:	5d                   	pop    %ebp
+  8015fe:	c3                   	ret
+
+008015ff <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8015ff:	55                   	push   %ebp
+  801600:	89 e5                	mov    %esp,%ebp
+  801602:	56                   	push   %esi
+  801603:	53                   	push   %ebx
+  801604:	83 ec 18             	sub    $0x18,%esp
+  801607:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80160a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80160d:	50                   	push   %eax
+  80160e:	53                   	push   %ebx
+  80160f:	e8 b7 fc ff ff       	call   8012cb <fd_lookup>
+  801614:	83 c4 10             	add    $0x10,%esp
+  801617:	85 c0                	test   %eax,%eax
+  801619:	78 37                	js     801652 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80161b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80161e:	83 ec 08             	sub    $0x8,%esp
+  801621:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801624:	50                   	push   %eax
+  801625:	ff 36                	push   (%esi)
+  801627:	e8 ef fc ff ff       	call   80131b <dev_lookup>
+  80162c:	83 c4 10             	add    $0x10,%esp
+  80162f:	85 c0                	test   %eax,%eax
+  801631:	78 1f                	js     801652 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801633:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801637:	74 20                	je     801659 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801639:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80163c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80163f:	85 c0                	test   %eax,%eax
+  801641:	74 37                	je     80167a <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801643:	83 ec 04             	sub    $0x4,%esp
+  801646:	ff 75 10             	push   0x10(%ebp)
+  801649:	ff 75 0c             	push   0xc(%ebp)
+  80164c:	56                   	push   %esi
+  80164d:	ff d0                	call   *%eax
+  80164f:	83 c4 10             	add    $0x10,%esp
+}
+  801652:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801655:	5b                   	pop    %ebx
+  801656:	5e                   	pop    %esi
+  801657:	5d                   	pop    %ebp
+  801658:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801659:	a1 08 40 80 00       	mov    0x804008,%eax
+  80165e:	8b 40 48             	mov    0x48(%eax),%eax
+  801661:	83 ec 04             	sub    $0x4,%esp
+  801664:	53                   	push   %ebx
+  801665:	50                   	push   %eax
+  801666:	68 11 2e 80 00       	push   $0x802e11
+  80166b:	e8 48 eb ff ff       	call   8001b8 <cprintf>
+		return -E_INVAL;
+  801670:	83 c4 10             	add    $0x10,%esp
+  801673:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801678:	eb d8                	jmp    801652 <write+0x53>
+		return -E_NOT_SUPP;
+  80167a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80167f:	eb d1                	jmp    801652 <write+0x53>
+
+00801681 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801681:	55                   	push   %ebp
+  801682:	89 e5                	mov    %esp,%ebp
+  801684:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801687:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80168a:	50                   	push   %eax
+  80168b:	ff 75 08             	push   0x8(%ebp)
+  80168e:	e8 38 fc ff ff       	call   8012cb <fd_lookup>
+  801693:	83 c4 10             	add    $0x10,%esp
+  801696:	85 c0                	test   %eax,%eax
+  801698:	78 0e                	js     8016a8 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80169a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80169d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016a0:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8016a3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8016a8:	c9                   	leave
+  8016a9:	c3                   	ret
+
+008016aa <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8016aa:	55                   	push   %ebp
+  8016ab:	89 e5                	mov    %esp,%ebp
+  8016ad:	56                   	push   %esi
+  8016ae:	53                   	push   %ebx
+  8016af:	83 ec 18             	sub    $0x18,%esp
+  8016b2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016b5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016b8:	50                   	push   %eax
+  8016b9:	53                   	push   %ebx
+  8016ba:	e8 0c fc ff ff       	call   8012cb <fd_lookup>
+  8016bf:	83 c4 10             	add    $0x10,%esp
+  8016c2:	85 c0                	test   %eax,%eax
+  8016c4:	78 34                	js     8016fa <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016c6:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8016c9:	83 ec 08             	sub    $0x8,%esp
+  8016cc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016cf:	50                   	push   %eax
+  8016d0:	ff 36                	push   (%esi)
+  8016d2:	e8 44 fc ff ff       	call   80131b <dev_lookup>
+  8016d7:	83 c4 10             	add    $0x10,%esp
+  8016da:	85 c0                	test   %eax,%eax
+  8016dc:	78 1c                	js     8016fa <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8016de:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8016e2:	74 1d                	je     801701 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8016e4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016e7:	8b 40 18             	mov    0x18(%eax),%eax
+  8016ea:	85 c0                	test   %eax,%eax
+  8016ec:	74 34                	je     801722 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8016ee:	83 ec 08             	sub    $0x8,%esp
+  8016f1:	ff 75 0c             	push   0xc(%ebp)
+  8016f4:	56                   	push   %esi
+  8016f5:	ff d0                	call   *%eax
+  8016f7:	83 c4 10             	add    $0x10,%esp
+}
+  8016fa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016fd:	5b                   	pop    %ebx
+  8016fe:	5e                   	pop    %esi
+  8016ff:	5d                   	pop    %ebp
+  801700:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801701:	a1 08 40 80 00       	mov    0x804008,%eax
+  801706:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801709:	83 ec 04             	sub    $0x4,%esp
+  80170c:	53                   	push   %ebx
+  80170d:	50                   	push   %eax
+  80170e:	68 d4 2d 80 00       	push   $0x802dd4
+  801713:	e8 a0 ea ff ff       	call   8001b8 <cprintf>
+		return -E_INVAL;
+  801718:	83 c4 10             	add    $0x10,%esp
+  80171b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801720:	eb d8                	jmp    8016fa <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801722:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801727:	eb d1                	jmp    8016fa <ftruncate+0x50>
+
+00801729 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801729:	55                   	push   %ebp
+  80172a:	89 e5                	mov    %esp,%ebp
+  80172c:	56                   	push   %esi
+  80172d:	53                   	push   %ebx
+  80172e:	83 ec 18             	sub    $0x18,%esp
+  801731:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801734:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801737:	50                   	push   %eax
+  801738:	ff 75 08             	push   0x8(%ebp)
+  80173b:	e8 8b fb ff ff       	call   8012cb <fd_lookup>
+  801740:	83 c4 10             	add    $0x10,%esp
+  801743:	85 c0                	test   %eax,%eax
+  801745:	78 49                	js     801790 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801747:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80174a:	83 ec 08             	sub    $0x8,%esp
+  80174d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801750:	50                   	push   %eax
+  801751:	ff 36                	push   (%esi)
+  801753:	e8 c3 fb ff ff       	call   80131b <dev_lookup>
+  801758:	83 c4 10             	add    $0x10,%esp
+  80175b:	85 c0                	test   %eax,%eax
+  80175d:	78 31                	js     801790 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  80175f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801762:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801766:	74 2f                	je     801797 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801768:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80176b:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801772:	00 00 00 
+	stat->st_isdir = 0;
+  801775:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80177c:	00 00 00 
+	stat->st_dev = dev;
+  80177f:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801785:	83 ec 08             	sub    $0x8,%esp
+  801788:	53                   	push   %ebx
+  801789:	56                   	push   %esi
+  80178a:	ff 50 14             	call   *0x14(%eax)
+  80178d:	83 c4 10             	add    $0x10,%esp
+}
+  801790:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801793:	5b                   	pop    %ebx
+  801794:	5e                   	pop    %esi
+  801795:	5d                   	pop    %ebp
+  801796:	c3                   	ret
+		return -E_NOT_SUPP;
+  801797:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80179c:	eb f2                	jmp    801790 <fstat+0x67>
+
+0080179e <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80179e:	55                   	push   %ebp
+  80179f:	89 e5                	mov    %esp,%ebp
+  8017a1:	56                   	push   %esi
+  8017a2:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8017a3:	83 ec 08             	sub    $0x8,%esp
+  8017a6:	6a 00                	push   $0x0
+  8017a8:	ff 75 08             	push   0x8(%ebp)
+  8017ab:	e8 e4 01 00 00       	call   801994 <open>
+  8017b0:	89 c3                	mov    %eax,%ebx
+  8017b2:	83 c4 10             	add    $0x10,%esp
+  8017b5:	85 c0                	test   %eax,%eax
+  8017b7:	78 1b                	js     8017d4 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8017b9:	83 ec 08             	sub    $0x8,%esp
+  8017bc:	ff 75 0c             	push   0xc(%ebp)
+  8017bf:	50                   	push   %eax
+  8017c0:	e8 64 ff ff ff       	call   801729 <fstat>
+  8017c5:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8017c7:	89 1c 24             	mov    %ebx,(%esp)
+  8017ca:	e8 26 fc ff ff       	call   8013f5 <close>
+	return r;
+  8017cf:	83 c4 10             	add    $0x10,%esp
+  8017d2:	89 f3                	mov    %esi,%ebx
+}
+  8017d4:	89 d8                	mov    %ebx,%eax
+  8017d6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017d9:	5b                   	pop    %ebx
+  8017da:	5e                   	pop    %esi
+  8017db:	5d                   	pop    %ebp
+  8017dc:	c3                   	ret
+
+008017dd <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  8017dd:	55                   	push   %ebp
+  8017de:	89 e5                	mov    %esp,%ebp
+  8017e0:	56                   	push   %esi
+  8017e1:	53                   	push   %ebx
+  8017e2:	89 c6                	mov    %eax,%esi
+  8017e4:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  8017e6:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  8017ed:	74 27                	je     801816 <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8017ef:	6a 07                	push   $0x7
+  8017f1:	68 00 50 80 00       	push   $0x805000
+  8017f6:	56                   	push   %esi
+  8017f7:	ff 35 00 40 80 00    	push   0x804000
+  8017fd:	e8 b9 f9 ff ff       	call   8011bb <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  801802:	83 c4 0c             	add    $0xc,%esp
+  801805:	6a 00                	push   $0x0
+  801807:	53                   	push   %ebx
+  801808:	6a 00                	push   $0x0
+  80180a:	e8 38 f9 ff ff       	call   801147 <ipc_recv>
+}
+  80180f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801812:	5b                   	pop    %ebx
+  801813:	5e                   	pop    %esi
+  801814:	5d                   	pop    %ebp
+  801815:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  801816:	83 ec 0c             	sub    $0xc,%esp
+  801819:	6a 01                	push   $0x1
+  80181b:	e8 ef f9 ff ff       	call   80120f <ipc_find_env>
+  801820:	a3 00 40 80 00       	mov    %eax,0x804000
+  801825:	83 c4 10             	add    $0x10,%esp
+  801828:	eb c5                	jmp    8017ef <fsipc+0x12>
+
+0080182a <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80182a:	55                   	push   %ebp
+  80182b:	89 e5                	mov    %esp,%ebp
+  80182d:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801830:	8b 45 08             	mov    0x8(%ebp),%eax
+  801833:	8b 40 0c             	mov    0xc(%eax),%eax
+  801836:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.set_size.req_size = newsize;
+  80183b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80183e:	a3 04 50 80 00       	mov    %eax,0x805004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801843:	ba 00 00 00 00       	mov    $0x0,%edx
+  801848:	b8 02 00 00 00       	mov    $0x2,%eax
+  80184d:	e8 8b ff ff ff       	call   8017dd <fsipc>
+}
+  801852:	c9                   	leave
+  801853:	c3                   	ret
+
+00801854 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801854:	55                   	push   %ebp
+  801855:	89 e5                	mov    %esp,%ebp
+  801857:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80185a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80185d:	8b 40 0c             	mov    0xc(%eax),%eax
+  801860:	a3 00 50 80 00       	mov    %eax,0x805000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801865:	ba 00 00 00 00       	mov    $0x0,%edx
+  80186a:	b8 06 00 00 00       	mov    $0x6,%eax
+  80186f:	e8 69 ff ff ff       	call   8017dd <fsipc>
+}
+  801874:	c9                   	leave
+  801875:	c3                   	ret
+
+00801876 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801876:	55                   	push   %ebp
+  801877:	89 e5                	mov    %esp,%ebp
+  801879:	53                   	push   %ebx
+  80187a:	83 ec 04             	sub    $0x4,%esp
+  80187d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801880:	8b 45 08             	mov    0x8(%ebp),%eax
+  801883:	8b 40 0c             	mov    0xc(%eax),%eax
+  801886:	a3 00 50 80 00       	mov    %eax,0x805000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80188b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801890:	b8 05 00 00 00       	mov    $0x5,%eax
+  801895:	e8 43 ff ff ff       	call   8017dd <fsipc>
+  80189a:	85 c0                	test   %eax,%eax
+  80189c:	78 2c                	js     8018ca <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80189e:	83 ec 08             	sub    $0x8,%esp
+  8018a1:	68 00 50 80 00       	push   $0x805000
+  8018a6:	53                   	push   %ebx
+  8018a7:	e8 c5 ee ff ff       	call   800771 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  8018ac:	a1 80 50 80 00       	mov    0x805080,%eax
+  8018b1:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8018b7:	a1 84 50 80 00       	mov    0x805084,%eax
+  8018bc:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  8018c2:	83 c4 10             	add    $0x10,%esp
+  8018c5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018ca:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018cd:	c9                   	leave
+  8018ce:	c3                   	ret
+
+008018cf <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8018cf:	55                   	push   %ebp
+  8018d0:	89 e5                	mov    %esp,%ebp
+  8018d2:	83 ec 0c             	sub    $0xc,%esp
+  8018d5:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8018d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018db:	8b 52 0c             	mov    0xc(%edx),%edx
+  8018de:	89 15 00 50 80 00    	mov    %edx,0x805000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8018e4:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8018e9:	39 d0                	cmp    %edx,%eax
+  8018eb:	0f 47 c2             	cmova  %edx,%eax
+  8018ee:	a3 04 50 80 00       	mov    %eax,0x805004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  8018f3:	50                   	push   %eax
+  8018f4:	ff 75 0c             	push   0xc(%ebp)
+  8018f7:	68 08 50 80 00       	push   $0x805008
+  8018fc:	e8 f6 ef ff ff       	call   8008f7 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801901:	ba 00 00 00 00       	mov    $0x0,%edx
+  801906:	b8 04 00 00 00       	mov    $0x4,%eax
+  80190b:	e8 cd fe ff ff       	call   8017dd <fsipc>
+}
+  801910:	c9                   	leave
+  801911:	c3                   	ret
+
+00801912 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801912:	55                   	push   %ebp
+  801913:	89 e5                	mov    %esp,%ebp
+  801915:	56                   	push   %esi
+  801916:	53                   	push   %ebx
+  801917:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80191a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80191d:	8b 40 0c             	mov    0xc(%eax),%eax
+  801920:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.read.req_n = n;
+  801925:	89 35 04 50 80 00    	mov    %esi,0x805004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  80192b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801930:	b8 03 00 00 00       	mov    $0x3,%eax
+  801935:	e8 a3 fe ff ff       	call   8017dd <fsipc>
+  80193a:	89 c3                	mov    %eax,%ebx
+  80193c:	85 c0                	test   %eax,%eax
+  80193e:	78 1f                	js     80195f <devfile_read+0x4d>
+  assert(r <= n);
+  801940:	39 c6                	cmp    %eax,%esi
+  801942:	72 24                	jb     801968 <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  801944:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801949:	7f 33                	jg     80197e <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80194b:	83 ec 04             	sub    $0x4,%esp
+  80194e:	50                   	push   %eax
+  80194f:	68 00 50 80 00       	push   $0x805000
+  801954:	ff 75 0c             	push   0xc(%ebp)
+  801957:	e8 9b ef ff ff       	call   8008f7 <memmove>
+  return r;
+  80195c:	83 c4 10             	add    $0x10,%esp
+}
+  80195f:	89 d8                	mov    %ebx,%eax
+  801961:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801964:	5b                   	pop    %ebx
+  801965:	5e                   	pop    %esi
+  801966:	5d                   	pop    %ebp
+  801967:	c3                   	ret
+  assert(r <= n);
+  801968:	68 44 2e 80 00       	push   $0x802e44
+  80196d:	68 4b 2e 80 00       	push   $0x802e4b
+  801972:	6a 78                	push   $0x78
+  801974:	68 60 2e 80 00       	push   $0x802e60
+  801979:	e8 e1 09 00 00       	call   80235f <_panic>
+  assert(r <= PGSIZE);
+  80197e:	68 6b 2e 80 00       	push   $0x802e6b
+  801983:	68 4b 2e 80 00       	push   $0x802e4b
+  801988:	6a 79                	push   $0x79
+  80198a:	68 60 2e 80 00       	push   $0x802e60
+  80198f:	e8 cb 09 00 00       	call   80235f <_panic>
+
+00801994 <open>:
+open(const char *path, int mode) {
+  801994:	55                   	push   %ebp
+  801995:	89 e5                	mov    %esp,%ebp
+  801997:	56                   	push   %esi
+  801998:	53                   	push   %ebx
+  801999:	83 ec 1c             	sub    $0x1c,%esp
+  80199c:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  80199f:	56                   	push   %esi
+  8019a0:	e8 91 ed ff ff       	call   800736 <strlen>
+  8019a5:	83 c4 10             	add    $0x10,%esp
+  8019a8:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8019ad:	7f 6c                	jg     801a1b <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  8019af:	83 ec 0c             	sub    $0xc,%esp
+  8019b2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019b5:	50                   	push   %eax
+  8019b6:	e8 ba f8 ff ff       	call   801275 <fd_alloc>
+  8019bb:	89 c3                	mov    %eax,%ebx
+  8019bd:	83 c4 10             	add    $0x10,%esp
+  8019c0:	85 c0                	test   %eax,%eax
+  8019c2:	78 3c                	js     801a00 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  8019c4:	83 ec 08             	sub    $0x8,%esp
+  8019c7:	56                   	push   %esi
+  8019c8:	68 00 50 80 00       	push   $0x805000
+  8019cd:	e8 9f ed ff ff       	call   800771 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  8019d2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019d5:	a3 00 54 80 00       	mov    %eax,0x805400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8019da:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8019dd:	b8 01 00 00 00       	mov    $0x1,%eax
+  8019e2:	e8 f6 fd ff ff       	call   8017dd <fsipc>
+  8019e7:	89 c3                	mov    %eax,%ebx
+  8019e9:	83 c4 10             	add    $0x10,%esp
+  8019ec:	85 c0                	test   %eax,%eax
+  8019ee:	78 19                	js     801a09 <open+0x75>
+  return fd2num(fd);
+  8019f0:	83 ec 0c             	sub    $0xc,%esp
+  8019f3:	ff 75 f4             	push   -0xc(%ebp)
+  8019f6:	e8 53 f8 ff ff       	call   80124e <fd2num>
+  8019fb:	89 c3                	mov    %eax,%ebx
+  8019fd:	83 c4 10             	add    $0x10,%esp
+}
+  801a00:	89 d8                	mov    %ebx,%eax
+  801a02:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a05:	5b                   	pop    %ebx
+  801a06:	5e                   	pop    %esi
+  801a07:	5d                   	pop    %ebp
+  801a08:	c3                   	ret
+    fd_close(fd, 0);
+  801a09:	83 ec 08             	sub    $0x8,%esp
+  801a0c:	6a 00                	push   $0x0
+  801a0e:	ff 75 f4             	push   -0xc(%ebp)
+  801a11:	e8 58 f9 ff ff       	call   80136e <fd_close>
+    return r;
+  801a16:	83 c4 10             	add    $0x10,%esp
+  801a19:	eb e5                	jmp    801a00 <open+0x6c>
+    return -E_BAD_PATH;
+  801a1b:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801a20:	eb de                	jmp    801a00 <open+0x6c>
+
+00801a22 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  801a22:	55                   	push   %ebp
+  801a23:	89 e5                	mov    %esp,%ebp
+  801a25:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801a28:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a2d:	b8 08 00 00 00       	mov    $0x8,%eax
+  801a32:	e8 a6 fd ff ff       	call   8017dd <fsipc>
+}
+  801a37:	c9                   	leave
+  801a38:	c3                   	ret
+
+00801a39 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801a39:	55                   	push   %ebp
+  801a3a:	89 e5                	mov    %esp,%ebp
+  801a3c:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801a3f:	68 77 2e 80 00       	push   $0x802e77
+  801a44:	ff 75 0c             	push   0xc(%ebp)
+  801a47:	e8 25 ed ff ff       	call   800771 <strcpy>
+	return 0;
+}
+  801a4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a51:	c9                   	leave
+  801a52:	c3                   	ret
+
+00801a53 <devsock_close>:
+{
+  801a53:	55                   	push   %ebp
+  801a54:	89 e5                	mov    %esp,%ebp
+  801a56:	53                   	push   %ebx
+  801a57:	83 ec 10             	sub    $0x10,%esp
+  801a5a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801a5d:	53                   	push   %ebx
+  801a5e:	e8 d1 09 00 00       	call   802434 <pageref>
+  801a63:	89 c2                	mov    %eax,%edx
+  801a65:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801a68:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801a6d:	83 fa 01             	cmp    $0x1,%edx
+  801a70:	74 05                	je     801a77 <devsock_close+0x24>
+}
+  801a72:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a75:	c9                   	leave
+  801a76:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801a77:	83 ec 0c             	sub    $0xc,%esp
+  801a7a:	ff 73 0c             	push   0xc(%ebx)
+  801a7d:	e8 b7 02 00 00       	call   801d39 <nsipc_close>
+  801a82:	83 c4 10             	add    $0x10,%esp
+  801a85:	eb eb                	jmp    801a72 <devsock_close+0x1f>
+
+00801a87 <devsock_write>:
+{
+  801a87:	55                   	push   %ebp
+  801a88:	89 e5                	mov    %esp,%ebp
+  801a8a:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801a8d:	6a 00                	push   $0x0
+  801a8f:	ff 75 10             	push   0x10(%ebp)
+  801a92:	ff 75 0c             	push   0xc(%ebp)
+  801a95:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a98:	ff 70 0c             	push   0xc(%eax)
+  801a9b:	e8 79 03 00 00       	call   801e19 <nsipc_send>
+}
+  801aa0:	c9                   	leave
+  801aa1:	c3                   	ret
+
+00801aa2 <devsock_read>:
+{
+  801aa2:	55                   	push   %ebp
+  801aa3:	89 e5                	mov    %esp,%ebp
+  801aa5:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801aa8:	6a 00                	push   $0x0
+  801aaa:	ff 75 10             	push   0x10(%ebp)
+  801aad:	ff 75 0c             	push   0xc(%ebp)
+  801ab0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ab3:	ff 70 0c             	push   0xc(%eax)
+  801ab6:	e8 ef 02 00 00       	call   801daa <nsipc_recv>
+}
+  801abb:	c9                   	leave
+  801abc:	c3                   	ret
+
+00801abd <fd2sockid>:
+{
+  801abd:	55                   	push   %ebp
+  801abe:	89 e5                	mov    %esp,%ebp
+  801ac0:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801ac3:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801ac6:	52                   	push   %edx
+  801ac7:	50                   	push   %eax
+  801ac8:	e8 fe f7 ff ff       	call   8012cb <fd_lookup>
+  801acd:	83 c4 10             	add    $0x10,%esp
+  801ad0:	85 c0                	test   %eax,%eax
+  801ad2:	78 10                	js     801ae4 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801ad4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ad7:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  801add:	39 08                	cmp    %ecx,(%eax)
+  801adf:	75 05                	jne    801ae6 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801ae1:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801ae4:	c9                   	leave
+  801ae5:	c3                   	ret
+		return -E_NOT_SUPP;
+  801ae6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801aeb:	eb f7                	jmp    801ae4 <fd2sockid+0x27>
+
+00801aed <alloc_sockfd>:
+{
+  801aed:	55                   	push   %ebp
+  801aee:	89 e5                	mov    %esp,%ebp
+  801af0:	56                   	push   %esi
+  801af1:	53                   	push   %ebx
+  801af2:	83 ec 1c             	sub    $0x1c,%esp
+  801af5:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801af7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801afa:	50                   	push   %eax
+  801afb:	e8 75 f7 ff ff       	call   801275 <fd_alloc>
+  801b00:	89 c3                	mov    %eax,%ebx
+  801b02:	83 c4 10             	add    $0x10,%esp
+  801b05:	85 c0                	test   %eax,%eax
+  801b07:	78 43                	js     801b4c <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801b09:	83 ec 04             	sub    $0x4,%esp
+  801b0c:	68 07 04 00 00       	push   $0x407
+  801b11:	ff 75 f4             	push   -0xc(%ebp)
+  801b14:	6a 00                	push   $0x0
+  801b16:	e8 42 f0 ff ff       	call   800b5d <sys_page_alloc>
+  801b1b:	89 c3                	mov    %eax,%ebx
+  801b1d:	83 c4 10             	add    $0x10,%esp
+  801b20:	85 c0                	test   %eax,%eax
+  801b22:	78 28                	js     801b4c <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801b24:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b27:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  801b2d:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801b2f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b32:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801b39:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801b3c:	83 ec 0c             	sub    $0xc,%esp
+  801b3f:	50                   	push   %eax
+  801b40:	e8 09 f7 ff ff       	call   80124e <fd2num>
+  801b45:	89 c3                	mov    %eax,%ebx
+  801b47:	83 c4 10             	add    $0x10,%esp
+  801b4a:	eb 0c                	jmp    801b58 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801b4c:	83 ec 0c             	sub    $0xc,%esp
+  801b4f:	56                   	push   %esi
+  801b50:	e8 e4 01 00 00       	call   801d39 <nsipc_close>
+		return r;
+  801b55:	83 c4 10             	add    $0x10,%esp
+}
+  801b58:	89 d8                	mov    %ebx,%eax
+  801b5a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b5d:	5b                   	pop    %ebx
+  801b5e:	5e                   	pop    %esi
+  801b5f:	5d                   	pop    %ebp
+  801b60:	c3                   	ret
+
+00801b61 <accept>:
+{
+  801b61:	55                   	push   %ebp
+  801b62:	89 e5                	mov    %esp,%ebp
+  801b64:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801b67:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b6a:	e8 4e ff ff ff       	call   801abd <fd2sockid>
+  801b6f:	85 c0                	test   %eax,%eax
+  801b71:	78 1b                	js     801b8e <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801b73:	83 ec 04             	sub    $0x4,%esp
+  801b76:	ff 75 10             	push   0x10(%ebp)
+  801b79:	ff 75 0c             	push   0xc(%ebp)
+  801b7c:	50                   	push   %eax
+  801b7d:	e8 0e 01 00 00       	call   801c90 <nsipc_accept>
+  801b82:	83 c4 10             	add    $0x10,%esp
+  801b85:	85 c0                	test   %eax,%eax
+  801b87:	78 05                	js     801b8e <accept+0x2d>
+	return alloc_sockfd(r);
+  801b89:	e8 5f ff ff ff       	call   801aed <alloc_sockfd>
+}
+  801b8e:	c9                   	leave
+  801b8f:	c3                   	ret
+
+00801b90 <bind>:
+{
+  801b90:	55                   	push   %ebp
+  801b91:	89 e5                	mov    %esp,%ebp
+  801b93:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801b96:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b99:	e8 1f ff ff ff       	call   801abd <fd2sockid>
+  801b9e:	85 c0                	test   %eax,%eax
+  801ba0:	78 12                	js     801bb4 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801ba2:	83 ec 04             	sub    $0x4,%esp
+  801ba5:	ff 75 10             	push   0x10(%ebp)
+  801ba8:	ff 75 0c             	push   0xc(%ebp)
+  801bab:	50                   	push   %eax
+  801bac:	e8 31 01 00 00       	call   801ce2 <nsipc_bind>
+  801bb1:	83 c4 10             	add    $0x10,%esp
+}
+  801bb4:	c9                   	leave
+  801bb5:	c3                   	ret
+
+00801bb6 <shutdown>:
+{
+  801bb6:	55                   	push   %ebp
+  801bb7:	89 e5                	mov    %esp,%ebp
+  801bb9:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801bbc:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bbf:	e8 f9 fe ff ff       	call   801abd <fd2sockid>
+  801bc4:	85 c0                	test   %eax,%eax
+  801bc6:	78 0f                	js     801bd7 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801bc8:	83 ec 08             	sub    $0x8,%esp
+  801bcb:	ff 75 0c             	push   0xc(%ebp)
+  801bce:	50                   	push   %eax
+  801bcf:	e8 43 01 00 00       	call   801d17 <nsipc_shutdown>
+  801bd4:	83 c4 10             	add    $0x10,%esp
+}
+  801bd7:	c9                   	leave
+  801bd8:	c3                   	ret
+
+00801bd9 <connect>:
+{
+  801bd9:	55                   	push   %ebp
+  801bda:	89 e5                	mov    %esp,%ebp
+  801bdc:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801bdf:	8b 45 08             	mov    0x8(%ebp),%eax
+  801be2:	e8 d6 fe ff ff       	call   801abd <fd2sockid>
+  801be7:	85 c0                	test   %eax,%eax
+  801be9:	78 12                	js     801bfd <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801beb:	83 ec 04             	sub    $0x4,%esp
+  801bee:	ff 75 10             	push   0x10(%ebp)
+  801bf1:	ff 75 0c             	push   0xc(%ebp)
+  801bf4:	50                   	push   %eax
+  801bf5:	e8 59 01 00 00       	call   801d53 <nsipc_connect>
+  801bfa:	83 c4 10             	add    $0x10,%esp
+}
+  801bfd:	c9                   	leave
+  801bfe:	c3                   	ret
+
+00801bff <listen>:
+{
+  801bff:	55                   	push   %ebp
+  801c00:	89 e5                	mov    %esp,%ebp
+  801c02:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801c05:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c08:	e8 b0 fe ff ff       	call   801abd <fd2sockid>
+  801c0d:	85 c0                	test   %eax,%eax
+  801c0f:	78 0f                	js     801c20 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801c11:	83 ec 08             	sub    $0x8,%esp
+  801c14:	ff 75 0c             	push   0xc(%ebp)
+  801c17:	50                   	push   %eax
+  801c18:	e8 6b 01 00 00       	call   801d88 <nsipc_listen>
+  801c1d:	83 c4 10             	add    $0x10,%esp
+}
+  801c20:	c9                   	leave
+  801c21:	c3                   	ret
+
+00801c22 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801c22:	55                   	push   %ebp
+  801c23:	89 e5                	mov    %esp,%ebp
+  801c25:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801c28:	ff 75 10             	push   0x10(%ebp)
+  801c2b:	ff 75 0c             	push   0xc(%ebp)
+  801c2e:	ff 75 08             	push   0x8(%ebp)
+  801c31:	e8 41 02 00 00       	call   801e77 <nsipc_socket>
+  801c36:	83 c4 10             	add    $0x10,%esp
+  801c39:	85 c0                	test   %eax,%eax
+  801c3b:	78 05                	js     801c42 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801c3d:	e8 ab fe ff ff       	call   801aed <alloc_sockfd>
+}
+  801c42:	c9                   	leave
+  801c43:	c3                   	ret
+
+00801c44 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801c44:	55                   	push   %ebp
+  801c45:	89 e5                	mov    %esp,%ebp
+  801c47:	53                   	push   %ebx
+  801c48:	83 ec 04             	sub    $0x4,%esp
+  801c4b:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801c4d:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801c54:	74 26                	je     801c7c <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801c56:	6a 07                	push   $0x7
+  801c58:	68 00 60 80 00       	push   $0x806000
+  801c5d:	53                   	push   %ebx
+  801c5e:	ff 35 04 40 80 00    	push   0x804004
+  801c64:	e8 52 f5 ff ff       	call   8011bb <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801c69:	83 c4 0c             	add    $0xc,%esp
+  801c6c:	6a 00                	push   $0x0
+  801c6e:	6a 00                	push   $0x0
+  801c70:	6a 00                	push   $0x0
+  801c72:	e8 d0 f4 ff ff       	call   801147 <ipc_recv>
+}
+  801c77:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c7a:	c9                   	leave
+  801c7b:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801c7c:	83 ec 0c             	sub    $0xc,%esp
+  801c7f:	6a 02                	push   $0x2
+  801c81:	e8 89 f5 ff ff       	call   80120f <ipc_find_env>
+  801c86:	a3 04 40 80 00       	mov    %eax,0x804004
+  801c8b:	83 c4 10             	add    $0x10,%esp
+  801c8e:	eb c6                	jmp    801c56 <nsipc+0x12>
+
+00801c90 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801c90:	55                   	push   %ebp
+  801c91:	89 e5                	mov    %esp,%ebp
+  801c93:	56                   	push   %esi
+  801c94:	53                   	push   %ebx
+  801c95:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801c98:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c9b:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801ca0:	8b 06                	mov    (%esi),%eax
+  801ca2:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801ca7:	b8 01 00 00 00       	mov    $0x1,%eax
+  801cac:	e8 93 ff ff ff       	call   801c44 <nsipc>
+  801cb1:	89 c3                	mov    %eax,%ebx
+  801cb3:	85 c0                	test   %eax,%eax
+  801cb5:	79 09                	jns    801cc0 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801cb7:	89 d8                	mov    %ebx,%eax
+  801cb9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cbc:	5b                   	pop    %ebx
+  801cbd:	5e                   	pop    %esi
+  801cbe:	5d                   	pop    %ebp
+  801cbf:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801cc0:	83 ec 04             	sub    $0x4,%esp
+  801cc3:	ff 35 10 60 80 00    	push   0x806010
+  801cc9:	68 00 60 80 00       	push   $0x806000
+  801cce:	ff 75 0c             	push   0xc(%ebp)
+  801cd1:	e8 21 ec ff ff       	call   8008f7 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801cd6:	a1 10 60 80 00       	mov    0x806010,%eax
+  801cdb:	89 06                	mov    %eax,(%esi)
+  801cdd:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801ce0:	eb d5                	jmp    801cb7 <nsipc_accept+0x27>
+
+00801ce2 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801ce2:	55                   	push   %ebp
+  801ce3:	89 e5                	mov    %esp,%ebp
+  801ce5:	53                   	push   %ebx
+  801ce6:	83 ec 08             	sub    $0x8,%esp
+  801ce9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801cec:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cef:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801cf4:	53                   	push   %ebx
+  801cf5:	ff 75 0c             	push   0xc(%ebp)
+  801cf8:	68 04 60 80 00       	push   $0x806004
+  801cfd:	e8 f5 eb ff ff       	call   8008f7 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801d02:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  801d08:	b8 02 00 00 00       	mov    $0x2,%eax
+  801d0d:	e8 32 ff ff ff       	call   801c44 <nsipc>
+}
+  801d12:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d15:	c9                   	leave
+  801d16:	c3                   	ret
+
+00801d17 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801d17:	55                   	push   %ebp
+  801d18:	89 e5                	mov    %esp,%ebp
+  801d1a:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801d1d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d20:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  801d25:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d28:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  801d2d:	b8 03 00 00 00       	mov    $0x3,%eax
+  801d32:	e8 0d ff ff ff       	call   801c44 <nsipc>
+}
+  801d37:	c9                   	leave
+  801d38:	c3                   	ret
+
+00801d39 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801d39:	55                   	push   %ebp
+  801d3a:	89 e5                	mov    %esp,%ebp
+  801d3c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801d3f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d42:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  801d47:	b8 04 00 00 00       	mov    $0x4,%eax
+  801d4c:	e8 f3 fe ff ff       	call   801c44 <nsipc>
+}
+  801d51:	c9                   	leave
+  801d52:	c3                   	ret
+
+00801d53 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801d53:	55                   	push   %ebp
+  801d54:	89 e5                	mov    %esp,%ebp
+  801d56:	53                   	push   %ebx
+  801d57:	83 ec 08             	sub    $0x8,%esp
+  801d5a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801d5d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d60:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801d65:	53                   	push   %ebx
+  801d66:	ff 75 0c             	push   0xc(%ebp)
+  801d69:	68 04 60 80 00       	push   $0x806004
+  801d6e:	e8 84 eb ff ff       	call   8008f7 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801d73:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  801d79:	b8 05 00 00 00       	mov    $0x5,%eax
+  801d7e:	e8 c1 fe ff ff       	call   801c44 <nsipc>
+}
+  801d83:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d86:	c9                   	leave
+  801d87:	c3                   	ret
+
+00801d88 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801d88:	55                   	push   %ebp
+  801d89:	89 e5                	mov    %esp,%ebp
+  801d8b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801d8e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d91:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  801d96:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d99:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  801d9e:	b8 06 00 00 00       	mov    $0x6,%eax
+  801da3:	e8 9c fe ff ff       	call   801c44 <nsipc>
+}
+  801da8:	c9                   	leave
+  801da9:	c3                   	ret
+
+00801daa <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801daa:	55                   	push   %ebp
+  801dab:	89 e5                	mov    %esp,%ebp
+  801dad:	56                   	push   %esi
+  801dae:	53                   	push   %ebx
+  801daf:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801db2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801db5:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  801dba:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  801dc0:	8b 45 14             	mov    0x14(%ebp),%eax
+  801dc3:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801dc8:	b8 07 00 00 00       	mov    $0x7,%eax
+  801dcd:	e8 72 fe ff ff       	call   801c44 <nsipc>
+  801dd2:	89 c3                	mov    %eax,%ebx
+  801dd4:	85 c0                	test   %eax,%eax
+  801dd6:	78 22                	js     801dfa <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801dd8:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801ddd:	39 c6                	cmp    %eax,%esi
+  801ddf:	0f 4e c6             	cmovle %esi,%eax
+  801de2:	39 c3                	cmp    %eax,%ebx
+  801de4:	7f 1d                	jg     801e03 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801de6:	83 ec 04             	sub    $0x4,%esp
+  801de9:	53                   	push   %ebx
+  801dea:	68 00 60 80 00       	push   $0x806000
+  801def:	ff 75 0c             	push   0xc(%ebp)
+  801df2:	e8 00 eb ff ff       	call   8008f7 <memmove>
+  801df7:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801dfa:	89 d8                	mov    %ebx,%eax
+  801dfc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dff:	5b                   	pop    %ebx
+  801e00:	5e                   	pop    %esi
+  801e01:	5d                   	pop    %ebp
+  801e02:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801e03:	68 83 2e 80 00       	push   $0x802e83
+  801e08:	68 4b 2e 80 00       	push   $0x802e4b
+  801e0d:	6a 62                	push   $0x62
+  801e0f:	68 98 2e 80 00       	push   $0x802e98
+  801e14:	e8 46 05 00 00       	call   80235f <_panic>
+
+00801e19 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801e19:	55                   	push   %ebp
+  801e1a:	89 e5                	mov    %esp,%ebp
+  801e1c:	53                   	push   %ebx
+  801e1d:	83 ec 04             	sub    $0x4,%esp
+  801e20:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801e23:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e26:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  801e2b:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801e31:	7f 2e                	jg     801e61 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801e33:	83 ec 04             	sub    $0x4,%esp
+  801e36:	53                   	push   %ebx
+  801e37:	ff 75 0c             	push   0xc(%ebp)
+  801e3a:	68 0c 60 80 00       	push   $0x80600c
+  801e3f:	e8 b3 ea ff ff       	call   8008f7 <memmove>
+	nsipcbuf.send.req_size = size;
+  801e44:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  801e4a:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e4d:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  801e52:	b8 08 00 00 00       	mov    $0x8,%eax
+  801e57:	e8 e8 fd ff ff       	call   801c44 <nsipc>
+}
+  801e5c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e5f:	c9                   	leave
+  801e60:	c3                   	ret
+	assert(size < 1600);
+  801e61:	68 a4 2e 80 00       	push   $0x802ea4
+  801e66:	68 4b 2e 80 00       	push   $0x802e4b
+  801e6b:	6a 6d                	push   $0x6d
+  801e6d:	68 98 2e 80 00       	push   $0x802e98
+  801e72:	e8 e8 04 00 00       	call   80235f <_panic>
+
+00801e77 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801e77:	55                   	push   %ebp
+  801e78:	89 e5                	mov    %esp,%ebp
+  801e7a:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801e7d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e80:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  801e85:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e88:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  801e8d:	8b 45 10             	mov    0x10(%ebp),%eax
+  801e90:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  801e95:	b8 09 00 00 00       	mov    $0x9,%eax
+  801e9a:	e8 a5 fd ff ff       	call   801c44 <nsipc>
+}
+  801e9f:	c9                   	leave
+  801ea0:	c3                   	ret
+
+00801ea1 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801ea1:	55                   	push   %ebp
+  801ea2:	89 e5                	mov    %esp,%ebp
+  801ea4:	56                   	push   %esi
+  801ea5:	53                   	push   %ebx
+  801ea6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801ea9:	83 ec 0c             	sub    $0xc,%esp
+  801eac:	ff 75 08             	push   0x8(%ebp)
+  801eaf:	e8 aa f3 ff ff       	call   80125e <fd2data>
+  801eb4:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801eb6:	83 c4 08             	add    $0x8,%esp
+  801eb9:	68 b0 2e 80 00       	push   $0x802eb0
+  801ebe:	53                   	push   %ebx
+  801ebf:	e8 ad e8 ff ff       	call   800771 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801ec4:	8b 46 04             	mov    0x4(%esi),%eax
+  801ec7:	2b 06                	sub    (%esi),%eax
+  801ec9:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  801ecf:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801ed6:	00 00 00 
+	stat->st_dev = &devpipe;
+  801ed9:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  801ee0:	30 80 00 
+	return 0;
+}
+  801ee3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ee8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801eeb:	5b                   	pop    %ebx
+  801eec:	5e                   	pop    %esi
+  801eed:	5d                   	pop    %ebp
+  801eee:	c3                   	ret
+
+00801eef <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801eef:	55                   	push   %ebp
+  801ef0:	89 e5                	mov    %esp,%ebp
+  801ef2:	53                   	push   %ebx
+  801ef3:	83 ec 0c             	sub    $0xc,%esp
+  801ef6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801ef9:	53                   	push   %ebx
+  801efa:	6a 00                	push   $0x0
+  801efc:	e8 e1 ec ff ff       	call   800be2 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801f01:	89 1c 24             	mov    %ebx,(%esp)
+  801f04:	e8 55 f3 ff ff       	call   80125e <fd2data>
+  801f09:	83 c4 08             	add    $0x8,%esp
+  801f0c:	50                   	push   %eax
+  801f0d:	6a 00                	push   $0x0
+  801f0f:	e8 ce ec ff ff       	call   800be2 <sys_page_unmap>
+}
+  801f14:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f17:	c9                   	leave
+  801f18:	c3                   	ret
+
+00801f19 <_pipeisclosed>:
+{
+  801f19:	55                   	push   %ebp
+  801f1a:	89 e5                	mov    %esp,%ebp
+  801f1c:	57                   	push   %edi
+  801f1d:	56                   	push   %esi
+  801f1e:	53                   	push   %ebx
+  801f1f:	83 ec 1c             	sub    $0x1c,%esp
+  801f22:	89 c7                	mov    %eax,%edi
+  801f24:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801f26:	a1 08 40 80 00       	mov    0x804008,%eax
+  801f2b:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801f2e:	83 ec 0c             	sub    $0xc,%esp
+  801f31:	57                   	push   %edi
+  801f32:	e8 fd 04 00 00       	call   802434 <pageref>
+  801f37:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801f3a:	89 34 24             	mov    %esi,(%esp)
+  801f3d:	e8 f2 04 00 00       	call   802434 <pageref>
+		nn = thisenv->env_runs;
+  801f42:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801f48:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801f4b:	83 c4 10             	add    $0x10,%esp
+  801f4e:	39 cb                	cmp    %ecx,%ebx
+  801f50:	74 1b                	je     801f6d <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801f52:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801f55:	75 cf                	jne    801f26 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801f57:	8b 42 58             	mov    0x58(%edx),%eax
+  801f5a:	6a 01                	push   $0x1
+  801f5c:	50                   	push   %eax
+  801f5d:	53                   	push   %ebx
+  801f5e:	68 b7 2e 80 00       	push   $0x802eb7
+  801f63:	e8 50 e2 ff ff       	call   8001b8 <cprintf>
+  801f68:	83 c4 10             	add    $0x10,%esp
+  801f6b:	eb b9                	jmp    801f26 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801f6d:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801f70:	0f 94 c0             	sete   %al
+  801f73:	0f b6 c0             	movzbl %al,%eax
+}
+  801f76:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f79:	5b                   	pop    %ebx
+  801f7a:	5e                   	pop    %esi
+  801f7b:	5f                   	pop    %edi
+  801f7c:	5d                   	pop    %ebp
+  801f7d:	c3                   	ret
+
+00801f7e <devpipe_write>:
+{
+  801f7e:	55                   	push   %ebp
+  801f7f:	89 e5                	mov    %esp,%ebp
+  801f81:	57                   	push   %edi
+  801f82:	56                   	push   %esi
+  801f83:	53                   	push   %ebx
+  801f84:	83 ec 28             	sub    $0x28,%esp
+  801f87:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801f8a:	56                   	push   %esi
+  801f8b:	e8 ce f2 ff ff       	call   80125e <fd2data>
+  801f90:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801f92:	83 c4 10             	add    $0x10,%esp
+  801f95:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f9a:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801f9d:	75 09                	jne    801fa8 <devpipe_write+0x2a>
+	return i;
+  801f9f:	89 f8                	mov    %edi,%eax
+  801fa1:	eb 23                	jmp    801fc6 <devpipe_write+0x48>
+			sys_yield();
+  801fa3:	e8 96 eb ff ff       	call   800b3e <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801fa8:	8b 43 04             	mov    0x4(%ebx),%eax
+  801fab:	8b 0b                	mov    (%ebx),%ecx
+  801fad:	8d 51 20             	lea    0x20(%ecx),%edx
+  801fb0:	39 d0                	cmp    %edx,%eax
+  801fb2:	72 1a                	jb     801fce <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  801fb4:	89 da                	mov    %ebx,%edx
+  801fb6:	89 f0                	mov    %esi,%eax
+  801fb8:	e8 5c ff ff ff       	call   801f19 <_pipeisclosed>
+  801fbd:	85 c0                	test   %eax,%eax
+  801fbf:	74 e2                	je     801fa3 <devpipe_write+0x25>
+				return 0;
+  801fc1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801fc6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fc9:	5b                   	pop    %ebx
+  801fca:	5e                   	pop    %esi
+  801fcb:	5f                   	pop    %edi
+  801fcc:	5d                   	pop    %ebp
+  801fcd:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801fce:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801fd1:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801fd5:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801fd8:	89 c2                	mov    %eax,%edx
+  801fda:	c1 fa 1f             	sar    $0x1f,%edx
+  801fdd:	89 d1                	mov    %edx,%ecx
+  801fdf:	c1 e9 1b             	shr    $0x1b,%ecx
+  801fe2:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801fe5:	83 e2 1f             	and    $0x1f,%edx
+  801fe8:	29 ca                	sub    %ecx,%edx
+  801fea:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801fee:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  801ff2:	83 c0 01             	add    $0x1,%eax
+  801ff5:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  801ff8:	83 c7 01             	add    $0x1,%edi
+  801ffb:	eb 9d                	jmp    801f9a <devpipe_write+0x1c>
+
+00801ffd <devpipe_read>:
+{
+  801ffd:	55                   	push   %ebp
+  801ffe:	89 e5                	mov    %esp,%ebp
+  802000:	57                   	push   %edi
+  802001:	56                   	push   %esi
+  802002:	53                   	push   %ebx
+  802003:	83 ec 18             	sub    $0x18,%esp
+  802006:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802009:	57                   	push   %edi
+  80200a:	e8 4f f2 ff ff       	call   80125e <fd2data>
+  80200f:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802011:	83 c4 10             	add    $0x10,%esp
+  802014:	be 00 00 00 00       	mov    $0x0,%esi
+  802019:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80201c:	75 13                	jne    802031 <devpipe_read+0x34>
+	return i;
+  80201e:	89 f0                	mov    %esi,%eax
+  802020:	eb 02                	jmp    802024 <devpipe_read+0x27>
+				return i;
+  802022:	89 f0                	mov    %esi,%eax
+}
+  802024:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802027:	5b                   	pop    %ebx
+  802028:	5e                   	pop    %esi
+  802029:	5f                   	pop    %edi
+  80202a:	5d                   	pop    %ebp
+  80202b:	c3                   	ret
+			sys_yield();
+  80202c:	e8 0d eb ff ff       	call   800b3e <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802031:	8b 03                	mov    (%ebx),%eax
+  802033:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802036:	75 18                	jne    802050 <devpipe_read+0x53>
+			if (i > 0)
+  802038:	85 f6                	test   %esi,%esi
+  80203a:	75 e6                	jne    802022 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  80203c:	89 da                	mov    %ebx,%edx
+  80203e:	89 f8                	mov    %edi,%eax
+  802040:	e8 d4 fe ff ff       	call   801f19 <_pipeisclosed>
+  802045:	85 c0                	test   %eax,%eax
+  802047:	74 e3                	je     80202c <devpipe_read+0x2f>
+				return 0;
+  802049:	b8 00 00 00 00       	mov    $0x0,%eax
+  80204e:	eb d4                	jmp    802024 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802050:	99                   	cltd
+  802051:	c1 ea 1b             	shr    $0x1b,%edx
+  802054:	01 d0                	add    %edx,%eax
+  802056:	83 e0 1f             	and    $0x1f,%eax
+  802059:	29 d0                	sub    %edx,%eax
+  80205b:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802060:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802063:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802066:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802069:	83 c6 01             	add    $0x1,%esi
+  80206c:	eb ab                	jmp    802019 <devpipe_read+0x1c>
+
+0080206e <pipe>:
+{
+  80206e:	55                   	push   %ebp
+  80206f:	89 e5                	mov    %esp,%ebp
+  802071:	56                   	push   %esi
+  802072:	53                   	push   %ebx
+  802073:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802076:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802079:	50                   	push   %eax
+  80207a:	e8 f6 f1 ff ff       	call   801275 <fd_alloc>
+  80207f:	89 c3                	mov    %eax,%ebx
+  802081:	83 c4 10             	add    $0x10,%esp
+  802084:	85 c0                	test   %eax,%eax
+  802086:	0f 88 23 01 00 00    	js     8021af <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80208c:	83 ec 04             	sub    $0x4,%esp
+  80208f:	68 07 04 00 00       	push   $0x407
+  802094:	ff 75 f4             	push   -0xc(%ebp)
+  802097:	6a 00                	push   $0x0
+  802099:	e8 bf ea ff ff       	call   800b5d <sys_page_alloc>
+  80209e:	89 c3                	mov    %eax,%ebx
+  8020a0:	83 c4 10             	add    $0x10,%esp
+  8020a3:	85 c0                	test   %eax,%eax
+  8020a5:	0f 88 04 01 00 00    	js     8021af <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8020ab:	83 ec 0c             	sub    $0xc,%esp
+  8020ae:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8020b1:	50                   	push   %eax
+  8020b2:	e8 be f1 ff ff       	call   801275 <fd_alloc>
+  8020b7:	89 c3                	mov    %eax,%ebx
+  8020b9:	83 c4 10             	add    $0x10,%esp
+  8020bc:	85 c0                	test   %eax,%eax
+  8020be:	0f 88 db 00 00 00    	js     80219f <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8020c4:	83 ec 04             	sub    $0x4,%esp
+  8020c7:	68 07 04 00 00       	push   $0x407
+  8020cc:	ff 75 f0             	push   -0x10(%ebp)
+  8020cf:	6a 00                	push   $0x0
+  8020d1:	e8 87 ea ff ff       	call   800b5d <sys_page_alloc>
+  8020d6:	89 c3                	mov    %eax,%ebx
+  8020d8:	83 c4 10             	add    $0x10,%esp
+  8020db:	85 c0                	test   %eax,%eax
+  8020dd:	0f 88 bc 00 00 00    	js     80219f <pipe+0x131>
+	va = fd2data(fd0);
+  8020e3:	83 ec 0c             	sub    $0xc,%esp
+  8020e6:	ff 75 f4             	push   -0xc(%ebp)
+  8020e9:	e8 70 f1 ff ff       	call   80125e <fd2data>
+  8020ee:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8020f0:	83 c4 0c             	add    $0xc,%esp
+  8020f3:	68 07 04 00 00       	push   $0x407
+  8020f8:	50                   	push   %eax
+  8020f9:	6a 00                	push   $0x0
+  8020fb:	e8 5d ea ff ff       	call   800b5d <sys_page_alloc>
+  802100:	89 c3                	mov    %eax,%ebx
+  802102:	83 c4 10             	add    $0x10,%esp
+  802105:	85 c0                	test   %eax,%eax
+  802107:	0f 88 82 00 00 00    	js     80218f <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80210d:	83 ec 0c             	sub    $0xc,%esp
+  802110:	ff 75 f0             	push   -0x10(%ebp)
+  802113:	e8 46 f1 ff ff       	call   80125e <fd2data>
+  802118:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80211f:	50                   	push   %eax
+  802120:	6a 00                	push   $0x0
+  802122:	56                   	push   %esi
+  802123:	6a 00                	push   $0x0
+  802125:	e8 76 ea ff ff       	call   800ba0 <sys_page_map>
+  80212a:	89 c3                	mov    %eax,%ebx
+  80212c:	83 c4 20             	add    $0x20,%esp
+  80212f:	85 c0                	test   %eax,%eax
+  802131:	78 4e                	js     802181 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802133:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  802138:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80213b:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80213d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802140:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802147:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80214a:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80214c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80214f:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802156:	83 ec 0c             	sub    $0xc,%esp
+  802159:	ff 75 f4             	push   -0xc(%ebp)
+  80215c:	e8 ed f0 ff ff       	call   80124e <fd2num>
+  802161:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802164:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802166:	83 c4 04             	add    $0x4,%esp
+  802169:	ff 75 f0             	push   -0x10(%ebp)
+  80216c:	e8 dd f0 ff ff       	call   80124e <fd2num>
+  802171:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802174:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802177:	83 c4 10             	add    $0x10,%esp
+  80217a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80217f:	eb 2e                	jmp    8021af <pipe+0x141>
+	sys_page_unmap(0, va);
+  802181:	83 ec 08             	sub    $0x8,%esp
+  802184:	56                   	push   %esi
+  802185:	6a 00                	push   $0x0
+  802187:	e8 56 ea ff ff       	call   800be2 <sys_page_unmap>
+  80218c:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80218f:	83 ec 08             	sub    $0x8,%esp
+  802192:	ff 75 f0             	push   -0x10(%ebp)
+  802195:	6a 00                	push   $0x0
+  802197:	e8 46 ea ff ff       	call   800be2 <sys_page_unmap>
+  80219c:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80219f:	83 ec 08             	sub    $0x8,%esp
+  8021a2:	ff 75 f4             	push   -0xc(%ebp)
+  8021a5:	6a 00                	push   $0x0
+  8021a7:	e8 36 ea ff ff       	call   800be2 <sys_page_unmap>
+  8021ac:	83 c4 10             	add    $0x10,%esp
+}
+  8021af:	89 d8                	mov    %ebx,%eax
+  8021b1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021b4:	5b                   	pop    %ebx
+  8021b5:	5e                   	pop    %esi
+  8021b6:	5d                   	pop    %ebp
+  8021b7:	c3                   	ret
+
+008021b8 <pipeisclosed>:
+{
+  8021b8:	55                   	push   %ebp
+  8021b9:	89 e5                	mov    %esp,%ebp
+  8021bb:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8021be:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021c1:	50                   	push   %eax
+  8021c2:	ff 75 08             	push   0x8(%ebp)
+  8021c5:	e8 01 f1 ff ff       	call   8012cb <fd_lookup>
+  8021ca:	83 c4 10             	add    $0x10,%esp
+  8021cd:	85 c0                	test   %eax,%eax
+  8021cf:	78 18                	js     8021e9 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8021d1:	83 ec 0c             	sub    $0xc,%esp
+  8021d4:	ff 75 f4             	push   -0xc(%ebp)
+  8021d7:	e8 82 f0 ff ff       	call   80125e <fd2data>
+  8021dc:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8021de:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021e1:	e8 33 fd ff ff       	call   801f19 <_pipeisclosed>
+  8021e6:	83 c4 10             	add    $0x10,%esp
+}
+  8021e9:	c9                   	leave
+  8021ea:	c3                   	ret
+
+008021eb <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8021eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021f0:	c3                   	ret
+
+008021f1 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8021f1:	55                   	push   %ebp
+  8021f2:	89 e5                	mov    %esp,%ebp
+  8021f4:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8021f7:	68 cf 2e 80 00       	push   $0x802ecf
+  8021fc:	ff 75 0c             	push   0xc(%ebp)
+  8021ff:	e8 6d e5 ff ff       	call   800771 <strcpy>
+	return 0;
+}
+  802204:	b8 00 00 00 00       	mov    $0x0,%eax
+  802209:	c9                   	leave
+  80220a:	c3                   	ret
+
+0080220b <devcons_write>:
+{
+  80220b:	55                   	push   %ebp
+  80220c:	89 e5                	mov    %esp,%ebp
+  80220e:	57                   	push   %edi
+  80220f:	56                   	push   %esi
+  802210:	53                   	push   %ebx
+  802211:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802217:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80221c:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802222:	eb 2e                	jmp    802252 <devcons_write+0x47>
+		m = n - tot;
+  802224:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802227:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802229:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80222e:	39 c3                	cmp    %eax,%ebx
+  802230:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802233:	83 ec 04             	sub    $0x4,%esp
+  802236:	53                   	push   %ebx
+  802237:	89 f0                	mov    %esi,%eax
+  802239:	03 45 0c             	add    0xc(%ebp),%eax
+  80223c:	50                   	push   %eax
+  80223d:	57                   	push   %edi
+  80223e:	e8 b4 e6 ff ff       	call   8008f7 <memmove>
+		sys_cputs(buf, m);
+  802243:	83 c4 08             	add    $0x8,%esp
+  802246:	53                   	push   %ebx
+  802247:	57                   	push   %edi
+  802248:	e8 54 e8 ff ff       	call   800aa1 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80224d:	01 de                	add    %ebx,%esi
+  80224f:	83 c4 10             	add    $0x10,%esp
+  802252:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802255:	72 cd                	jb     802224 <devcons_write+0x19>
+}
+  802257:	89 f0                	mov    %esi,%eax
+  802259:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80225c:	5b                   	pop    %ebx
+  80225d:	5e                   	pop    %esi
+  80225e:	5f                   	pop    %edi
+  80225f:	5d                   	pop    %ebp
+  802260:	c3                   	ret
+
+00802261 <devcons_read>:
+{
+  802261:	55                   	push   %ebp
+  802262:	89 e5                	mov    %esp,%ebp
+  802264:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802267:	b8 00 00 00 00       	mov    $0x0,%eax
+  80226c:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802270:	75 07                	jne    802279 <devcons_read+0x18>
+  802272:	eb 1f                	jmp    802293 <devcons_read+0x32>
+		sys_yield();
+  802274:	e8 c5 e8 ff ff       	call   800b3e <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802279:	e8 41 e8 ff ff       	call   800abf <sys_cgetc>
+  80227e:	85 c0                	test   %eax,%eax
+  802280:	74 f2                	je     802274 <devcons_read+0x13>
+	if (c < 0)
+  802282:	78 0f                	js     802293 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802284:	83 f8 04             	cmp    $0x4,%eax
+  802287:	74 0c                	je     802295 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802289:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80228c:	88 02                	mov    %al,(%edx)
+	return 1;
+  80228e:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802293:	c9                   	leave
+  802294:	c3                   	ret
+		return 0;
+  802295:	b8 00 00 00 00       	mov    $0x0,%eax
+  80229a:	eb f7                	jmp    802293 <devcons_read+0x32>
+
+0080229c <cputchar>:
+{
+  80229c:	55                   	push   %ebp
+  80229d:	89 e5                	mov    %esp,%ebp
+  80229f:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8022a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022a5:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8022a8:	6a 01                	push   $0x1
+  8022aa:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8022ad:	50                   	push   %eax
+  8022ae:	e8 ee e7 ff ff       	call   800aa1 <sys_cputs>
+}
+  8022b3:	83 c4 10             	add    $0x10,%esp
+  8022b6:	c9                   	leave
+  8022b7:	c3                   	ret
+
+008022b8 <getchar>:
+{
+  8022b8:	55                   	push   %ebp
+  8022b9:	89 e5                	mov    %esp,%ebp
+  8022bb:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8022be:	6a 01                	push   $0x1
+  8022c0:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8022c3:	50                   	push   %eax
+  8022c4:	6a 00                	push   $0x0
+  8022c6:	e8 66 f2 ff ff       	call   801531 <read>
+	if (r < 0)
+  8022cb:	83 c4 10             	add    $0x10,%esp
+  8022ce:	85 c0                	test   %eax,%eax
+  8022d0:	78 06                	js     8022d8 <getchar+0x20>
+	if (r < 1)
+  8022d2:	74 06                	je     8022da <getchar+0x22>
+	return c;
+  8022d4:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8022d8:	c9                   	leave
+  8022d9:	c3                   	ret
+		return -E_EOF;
+  8022da:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8022df:	eb f7                	jmp    8022d8 <getchar+0x20>
+
+008022e1 <iscons>:
+{
+  8022e1:	55                   	push   %ebp
+  8022e2:	89 e5                	mov    %esp,%ebp
+  8022e4:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8022e7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022ea:	50                   	push   %eax
+  8022eb:	ff 75 08             	push   0x8(%ebp)
+  8022ee:	e8 d8 ef ff ff       	call   8012cb <fd_lookup>
+  8022f3:	83 c4 10             	add    $0x10,%esp
+  8022f6:	85 c0                	test   %eax,%eax
+  8022f8:	78 11                	js     80230b <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8022fa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022fd:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  802303:	39 10                	cmp    %edx,(%eax)
+  802305:	0f 94 c0             	sete   %al
+  802308:	0f b6 c0             	movzbl %al,%eax
+}
+  80230b:	c9                   	leave
+  80230c:	c3                   	ret
+
+0080230d <opencons>:
+{
+  80230d:	55                   	push   %ebp
+  80230e:	89 e5                	mov    %esp,%ebp
+  802310:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802313:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802316:	50                   	push   %eax
+  802317:	e8 59 ef ff ff       	call   801275 <fd_alloc>
+  80231c:	83 c4 10             	add    $0x10,%esp
+  80231f:	85 c0                	test   %eax,%eax
+  802321:	78 3a                	js     80235d <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802323:	83 ec 04             	sub    $0x4,%esp
+  802326:	68 07 04 00 00       	push   $0x407
+  80232b:	ff 75 f4             	push   -0xc(%ebp)
+  80232e:	6a 00                	push   $0x0
+  802330:	e8 28 e8 ff ff       	call   800b5d <sys_page_alloc>
+  802335:	83 c4 10             	add    $0x10,%esp
+  802338:	85 c0                	test   %eax,%eax
+  80233a:	78 21                	js     80235d <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80233c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80233f:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  802345:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802347:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80234a:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802351:	83 ec 0c             	sub    $0xc,%esp
+  802354:	50                   	push   %eax
+  802355:	e8 f4 ee ff ff       	call   80124e <fd2num>
+  80235a:	83 c4 10             	add    $0x10,%esp
+}
+  80235d:	c9                   	leave
+  80235e:	c3                   	ret
+
+0080235f <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80235f:	55                   	push   %ebp
+  802360:	89 e5                	mov    %esp,%ebp
+  802362:	56                   	push   %esi
+  802363:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  802364:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  802367:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  80236d:	e8 ad e7 ff ff       	call   800b1f <sys_getenvid>
+  802372:	83 ec 0c             	sub    $0xc,%esp
+  802375:	ff 75 0c             	push   0xc(%ebp)
+  802378:	ff 75 08             	push   0x8(%ebp)
+  80237b:	56                   	push   %esi
+  80237c:	50                   	push   %eax
+  80237d:	68 dc 2e 80 00       	push   $0x802edc
+  802382:	e8 31 de ff ff       	call   8001b8 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  802387:	83 c4 18             	add    $0x18,%esp
+  80238a:	53                   	push   %ebx
+  80238b:	ff 75 10             	push   0x10(%ebp)
+  80238e:	e8 d4 dd ff ff       	call   800167 <vcprintf>
+	cprintf("\n");
+  802393:	c7 04 24 c8 2e 80 00 	movl   $0x802ec8,(%esp)
+  80239a:	e8 19 de ff ff       	call   8001b8 <cprintf>
+  80239f:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8023a2:	cc                   	int3
+	while (1)
+  8023a3:	eb fd                	jmp    8023a2 <_panic+0x43>
+
+008023a5 <set_pgfault_handler>:
+// allocate an exception stack (one page of memory with its top
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf)) {
+  8023a5:	55                   	push   %ebp
+  8023a6:	89 e5                	mov    %esp,%ebp
+  8023a8:	83 ec 08             	sub    $0x8,%esp
+  int r;
+
+  if (_pgfault_handler == 0) {
+  8023ab:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  8023b2:	74 0a                	je     8023be <set_pgfault_handler+0x19>
+    if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)))
+      panic(" set_pgfault_handler sys_env_set_pgfault_upcall panic: %e\n", r);
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  8023b4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023b7:	a3 00 70 80 00       	mov    %eax,0x807000
+
+
+}
+  8023bc:	c9                   	leave
+  8023bd:	c3                   	ret
+    if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)))
+  8023be:	83 ec 04             	sub    $0x4,%esp
+  8023c1:	6a 07                	push   $0x7
+  8023c3:	68 00 f0 bf ee       	push   $0xeebff000
+  8023c8:	6a 00                	push   $0x0
+  8023ca:	e8 8e e7 ff ff       	call   800b5d <sys_page_alloc>
+  8023cf:	83 c4 10             	add    $0x10,%esp
+  8023d2:	85 c0                	test   %eax,%eax
+  8023d4:	75 28                	jne    8023fe <set_pgfault_handler+0x59>
+    if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)))
+  8023d6:	83 ec 08             	sub    $0x8,%esp
+  8023d9:	68 10 24 80 00       	push   $0x802410
+  8023de:	6a 00                	push   $0x0
+  8023e0:	e8 c3 e8 ff ff       	call   800ca8 <sys_env_set_pgfault_upcall>
+  8023e5:	83 c4 10             	add    $0x10,%esp
+  8023e8:	85 c0                	test   %eax,%eax
+  8023ea:	74 c8                	je     8023b4 <set_pgfault_handler+0xf>
+      panic(" set_pgfault_handler sys_env_set_pgfault_upcall panic: %e\n", r);
+  8023ec:	50                   	push   %eax
+  8023ed:	68 30 2f 80 00       	push   $0x802f30
+  8023f2:	6a 22                	push   $0x22
+  8023f4:	68 6b 2f 80 00       	push   $0x802f6b
+  8023f9:	e8 61 ff ff ff       	call   80235f <_panic>
+      panic("set_pgfault_handler sys_page_alloc panic: %e\n", r);
+  8023fe:	50                   	push   %eax
+  8023ff:	68 00 2f 80 00       	push   $0x802f00
+  802404:	6a 20                	push   $0x20
+  802406:	68 6b 2f 80 00       	push   $0x802f6b
+  80240b:	e8 4f ff ff ff       	call   80235f <_panic>
+
+00802410 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  802410:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  802411:	a1 00 70 80 00       	mov    0x807000,%eax
+	call *%eax
+  802416:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  802418:	83 c4 04             	add    $0x4,%esp
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	// push the trap-time %eip onto the trap-time stack
+    subl $0x4, 0x30(%esp) # for push eip
+  80241b:	83 6c 24 30 04       	subl   $0x4,0x30(%esp)
+    movl 0x30(%esp), %ebx #regular esp
+  802420:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+    movl 0x28(%esp), %eax #eip
+  802424:	8b 44 24 28          	mov    0x28(%esp),%eax
+    movl %eax, (%ebx)
+  802428:	89 03                	mov    %eax,(%ebx)
+
+    // Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+    addl $8, %esp
+  80242a:	83 c4 08             	add    $0x8,%esp
+    popal
+  80242d:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  80242e:	83 c4 04             	add    $0x4,%esp
+	popfl
+  802431:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  802432:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  802433:	c3                   	ret
+
+00802434 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802434:	55                   	push   %ebp
+  802435:	89 e5                	mov    %esp,%ebp
+  802437:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80243a:	89 c2                	mov    %eax,%edx
+  80243c:	c1 ea 16             	shr    $0x16,%edx
+  80243f:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802446:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80244b:	f6 c1 01             	test   $0x1,%cl
+  80244e:	74 1c                	je     80246c <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  802450:	c1 e8 0c             	shr    $0xc,%eax
+  802453:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80245a:	a8 01                	test   $0x1,%al
+  80245c:	74 0e                	je     80246c <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80245e:	c1 e8 0c             	shr    $0xc,%eax
+  802461:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802468:	ef 
+  802469:	0f b7 d2             	movzwl %dx,%edx
+}
+  80246c:	89 d0                	mov    %edx,%eax
+  80246e:	5d                   	pop    %ebp
+  80246f:	c3                   	ret
+
+00802470 <__udivmoddi4>:
+  802470:	55                   	push   %ebp
+  802471:	57                   	push   %edi
+  802472:	56                   	push   %esi
+  802473:	53                   	push   %ebx
+  802474:	83 ec 24             	sub    $0x24,%esp
+  802477:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80247b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80247f:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  802483:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802487:	8b 54 24 44          	mov    0x44(%esp),%edx
+  80248b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80248f:	8b 44 24 40          	mov    0x40(%esp),%eax
+  802493:	89 d3                	mov    %edx,%ebx
+  802495:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802499:	09 c3                	or     %eax,%ebx
+  80249b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80249f:	0f 84 9c 00 00 00    	je     802541 <__udivmoddi4+0xd1>
+  8024a5:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8024ac:	00 
+  8024ad:	31 c0                	xor    %eax,%eax
+  8024af:	31 d2                	xor    %edx,%edx
+  8024b1:	89 fb                	mov    %edi,%ebx
+  8024b3:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8024ba:	00 
+  8024bb:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8024c0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8024c4:	01 c0                	add    %eax,%eax
+  8024c6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8024cd:	00 
+  8024ce:	89 c6                	mov    %eax,%esi
+  8024d0:	89 d7                	mov    %edx,%edi
+  8024d2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8024d6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8024da:	0f ad d0             	shrd   %cl,%edx,%eax
+  8024dd:	d3 ea                	shr    %cl,%edx
+  8024df:	f6 c1 20             	test   $0x20,%cl
+  8024e2:	0f 45 c2             	cmovne %edx,%eax
+  8024e5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8024e9:	83 e0 01             	and    $0x1,%eax
+  8024ec:	09 fa                	or     %edi,%edx
+  8024ee:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8024f2:	89 04 24             	mov    %eax,(%esp)
+  8024f5:	8b 04 24             	mov    (%esp),%eax
+  8024f8:	89 d5                	mov    %edx,%ebp
+  8024fa:	09 f0                	or     %esi,%eax
+  8024fc:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802500:	39 f0                	cmp    %esi,%eax
+  802502:	19 fd                	sbb    %edi,%ebp
+  802504:	72 1d                	jb     802523 <__udivmoddi4+0xb3>
+  802506:	29 f0                	sub    %esi,%eax
+  802508:	19 fa                	sbb    %edi,%edx
+  80250a:	89 cf                	mov    %ecx,%edi
+  80250c:	c1 ef 05             	shr    $0x5,%edi
+  80250f:	83 e7 01             	and    $0x1,%edi
+  802512:	89 fe                	mov    %edi,%esi
+  802514:	d3 e7                	shl    %cl,%edi
+  802516:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80251a:	83 f6 01             	xor    $0x1,%esi
+  80251d:	d3 e6                	shl    %cl,%esi
+  80251f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802523:	83 e9 01             	sub    $0x1,%ecx
+  802526:	73 98                	jae    8024c0 <__udivmoddi4+0x50>
+  802528:	85 db                	test   %ebx,%ebx
+  80252a:	74 05                	je     802531 <__udivmoddi4+0xc1>
+  80252c:	89 03                	mov    %eax,(%ebx)
+  80252e:	89 53 04             	mov    %edx,0x4(%ebx)
+  802531:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802535:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802539:	83 c4 24             	add    $0x24,%esp
+  80253c:	5b                   	pop    %ebx
+  80253d:	5e                   	pop    %esi
+  80253e:	5f                   	pop    %edi
+  80253f:	5d                   	pop    %ebp
+  802540:	c3                   	ret
+  802541:	85 ff                	test   %edi,%edi
+  802543:	74 0d                	je     802552 <__udivmoddi4+0xe2>
+  802545:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  80254b:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  802552:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802556:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80255a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80255e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802562:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802566:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80256a:	83 c4 24             	add    $0x24,%esp
+  80256d:	5b                   	pop    %ebx
+  80256e:	5e                   	pop    %esi
+  80256f:	5f                   	pop    %edi
+  802570:	5d                   	pop    %ebp
+  802571:	c3                   	ret
+  802572:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802579:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00802580 <__udivdi3>:
+  802580:	57                   	push   %edi
+  802581:	56                   	push   %esi
+  802582:	53                   	push   %ebx
+  802583:	83 ec 20             	sub    $0x20,%esp
+  802586:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80258a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80258e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802592:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802596:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80259a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80259e:	89 d1                	mov    %edx,%ecx
+  8025a0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8025a4:	09 c1                	or     %eax,%ecx
+  8025a6:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8025aa:	89 44 24 18          	mov    %eax,0x18(%esp)
+  8025ae:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  8025b2:	0f 84 88 00 00 00    	je     802640 <__udivdi3+0xc0>
+  8025b8:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8025bf:	00 
+  8025c0:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8025c5:	31 c0                	xor    %eax,%eax
+  8025c7:	31 d2                	xor    %edx,%edx
+  8025c9:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8025d0:	00 
+  8025d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8025d8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8025dc:	01 c0                	add    %eax,%eax
+  8025de:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8025e5:	00 
+  8025e6:	89 c6                	mov    %eax,%esi
+  8025e8:	89 d7                	mov    %edx,%edi
+  8025ea:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8025ee:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8025f2:	0f ad d0             	shrd   %cl,%edx,%eax
+  8025f5:	d3 ea                	shr    %cl,%edx
+  8025f7:	f6 c1 20             	test   $0x20,%cl
+  8025fa:	0f 45 c2             	cmovne %edx,%eax
+  8025fd:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802601:	83 e0 01             	and    $0x1,%eax
+  802604:	09 fa                	or     %edi,%edx
+  802606:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80260a:	89 04 24             	mov    %eax,(%esp)
+  80260d:	8b 04 24             	mov    (%esp),%eax
+  802610:	89 d3                	mov    %edx,%ebx
+  802612:	09 f0                	or     %esi,%eax
+  802614:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802618:	39 f0                	cmp    %esi,%eax
+  80261a:	19 fb                	sbb    %edi,%ebx
+  80261c:	72 1d                	jb     80263b <__udivdi3+0xbb>
+  80261e:	29 f0                	sub    %esi,%eax
+  802620:	19 fa                	sbb    %edi,%edx
+  802622:	89 cf                	mov    %ecx,%edi
+  802624:	c1 ef 05             	shr    $0x5,%edi
+  802627:	83 e7 01             	and    $0x1,%edi
+  80262a:	89 fe                	mov    %edi,%esi
+  80262c:	d3 e7                	shl    %cl,%edi
+  80262e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802632:	83 f6 01             	xor    $0x1,%esi
+  802635:	d3 e6                	shl    %cl,%esi
+  802637:	09 74 24 18          	or     %esi,0x18(%esp)
+  80263b:	83 e9 01             	sub    $0x1,%ecx
+  80263e:	73 98                	jae    8025d8 <__udivdi3+0x58>
+  802640:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802644:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802648:	83 c4 20             	add    $0x20,%esp
+  80264b:	5b                   	pop    %ebx
+  80264c:	5e                   	pop    %esi
+  80264d:	5f                   	pop    %edi
+  80264e:	c3                   	ret
+  80264f:	90                   	nop
+
+00802650 <__umoddi3>:
+  802650:	57                   	push   %edi
+  802651:	56                   	push   %esi
+  802652:	53                   	push   %ebx
+  802653:	83 ec 18             	sub    $0x18,%esp
+  802656:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80265a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80265e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802662:	8b 54 24 34          	mov    0x34(%esp),%edx
+  802666:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80266a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80266e:	89 d1                	mov    %edx,%ecx
+  802670:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802674:	09 c1                	or     %eax,%ecx
+  802676:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80267a:	74 5b                	je     8026d7 <__umoddi3+0x87>
+  80267c:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802681:	31 c0                	xor    %eax,%eax
+  802683:	31 d2                	xor    %edx,%edx
+  802685:	8d 76 00             	lea    0x0(%esi),%esi
+  802688:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80268c:	01 c0                	add    %eax,%eax
+  80268e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802695:	00 
+  802696:	89 c6                	mov    %eax,%esi
+  802698:	89 d7                	mov    %edx,%edi
+  80269a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80269e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8026a2:	0f ad d0             	shrd   %cl,%edx,%eax
+  8026a5:	d3 ea                	shr    %cl,%edx
+  8026a7:	f6 c1 20             	test   $0x20,%cl
+  8026aa:	0f 45 c2             	cmovne %edx,%eax
+  8026ad:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8026b1:	83 e0 01             	and    $0x1,%eax
+  8026b4:	09 fa                	or     %edi,%edx
+  8026b6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8026ba:	89 04 24             	mov    %eax,(%esp)
+  8026bd:	8b 04 24             	mov    (%esp),%eax
+  8026c0:	89 d3                	mov    %edx,%ebx
+  8026c2:	09 f0                	or     %esi,%eax
+  8026c4:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8026c8:	39 f0                	cmp    %esi,%eax
+  8026ca:	19 fb                	sbb    %edi,%ebx
+  8026cc:	72 04                	jb     8026d2 <__umoddi3+0x82>
+  8026ce:	29 f0                	sub    %esi,%eax
+  8026d0:	19 fa                	sbb    %edi,%edx
+  8026d2:	83 e9 01             	sub    $0x1,%ecx
+  8026d5:	73 b1                	jae    802688 <__umoddi3+0x38>
+  8026d7:	83 c4 18             	add    $0x18,%esp
+  8026da:	5b                   	pop    %ebx
+  8026db:	5e                   	pop    %esi
+  8026dc:	5f                   	pop    %edi
+  8026dd:	c3                   	ret
+  8026de:	66 90                	xchg   %ax,%ax
+
+008026e0 <__divdi3>:
+  8026e0:	55                   	push   %ebp
+  8026e1:	57                   	push   %edi
+  8026e2:	56                   	push   %esi
+  8026e3:	53                   	push   %ebx
+  8026e4:	83 ec 24             	sub    $0x24,%esp
+  8026e7:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  8026eb:	8b 74 24 44          	mov    0x44(%esp),%esi
+  8026ef:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8026f3:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8026f7:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  8026fb:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8026ff:	85 d2                	test   %edx,%edx
+  802701:	0f 88 e0 00 00 00    	js     8027e7 <__divdi3+0x107>
+  802707:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  80270b:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  80270f:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802713:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802717:	85 f6                	test   %esi,%esi
+  802719:	78 16                	js     802731 <__divdi3+0x51>
+  80271b:	89 f1                	mov    %esi,%ecx
+  80271d:	31 c0                	xor    %eax,%eax
+  80271f:	31 d2                	xor    %edx,%edx
+  802721:	09 d9                	or     %ebx,%ecx
+  802723:	0f 85 f3 00 00 00    	jne    80281c <__divdi3+0x13c>
+  802729:	83 c4 24             	add    $0x24,%esp
+  80272c:	5b                   	pop    %ebx
+  80272d:	5e                   	pop    %esi
+  80272e:	5f                   	pop    %edi
+  80272f:	5d                   	pop    %ebp
+  802730:	c3                   	ret
+  802731:	bf 01 00 00 00       	mov    $0x1,%edi
+  802736:	f7 5c 24 08          	negl   0x8(%esp)
+  80273a:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  80273f:	f7 5c 24 0c          	negl   0xc(%esp)
+  802743:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80274a:	00 
+  80274b:	31 c0                	xor    %eax,%eax
+  80274d:	31 d2                	xor    %edx,%edx
+  80274f:	89 fb                	mov    %edi,%ebx
+  802751:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802758:	00 
+  802759:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80275e:	66 90                	xchg   %ax,%ax
+  802760:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802764:	01 c0                	add    %eax,%eax
+  802766:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80276d:	00 
+  80276e:	89 c6                	mov    %eax,%esi
+  802770:	89 d7                	mov    %edx,%edi
+  802772:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802776:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80277a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80277d:	d3 ea                	shr    %cl,%edx
+  80277f:	f6 c1 20             	test   $0x20,%cl
+  802782:	0f 45 c2             	cmovne %edx,%eax
+  802785:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802789:	83 e0 01             	and    $0x1,%eax
+  80278c:	09 fa                	or     %edi,%edx
+  80278e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802792:	89 04 24             	mov    %eax,(%esp)
+  802795:	8b 04 24             	mov    (%esp),%eax
+  802798:	89 d5                	mov    %edx,%ebp
+  80279a:	09 f0                	or     %esi,%eax
+  80279c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8027a0:	39 f0                	cmp    %esi,%eax
+  8027a2:	19 fd                	sbb    %edi,%ebp
+  8027a4:	72 1d                	jb     8027c3 <__divdi3+0xe3>
+  8027a6:	29 f0                	sub    %esi,%eax
+  8027a8:	19 fa                	sbb    %edi,%edx
+  8027aa:	89 cf                	mov    %ecx,%edi
+  8027ac:	c1 ef 05             	shr    $0x5,%edi
+  8027af:	83 e7 01             	and    $0x1,%edi
+  8027b2:	89 fe                	mov    %edi,%esi
+  8027b4:	d3 e7                	shl    %cl,%edi
+  8027b6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8027ba:	83 f6 01             	xor    $0x1,%esi
+  8027bd:	d3 e6                	shl    %cl,%esi
+  8027bf:	09 74 24 18          	or     %esi,0x18(%esp)
+  8027c3:	83 e9 01             	sub    $0x1,%ecx
+  8027c6:	73 98                	jae    802760 <__divdi3+0x80>
+  8027c8:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8027cc:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8027d0:	85 db                	test   %ebx,%ebx
+  8027d2:	0f 84 51 ff ff ff    	je     802729 <__divdi3+0x49>
+  8027d8:	f7 d8                	neg    %eax
+  8027da:	83 d2 00             	adc    $0x0,%edx
+  8027dd:	83 c4 24             	add    $0x24,%esp
+  8027e0:	5b                   	pop    %ebx
+  8027e1:	f7 da                	neg    %edx
+  8027e3:	5e                   	pop    %esi
+  8027e4:	5f                   	pop    %edi
+  8027e5:	5d                   	pop    %ebp
+  8027e6:	c3                   	ret
+  8027e7:	f7 d8                	neg    %eax
+  8027e9:	83 d2 00             	adc    $0x0,%edx
+  8027ec:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8027f0:	f7 da                	neg    %edx
+  8027f2:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8027f6:	85 f6                	test   %esi,%esi
+  8027f8:	78 1b                	js     802815 <__divdi3+0x135>
+  8027fa:	89 f1                	mov    %esi,%ecx
+  8027fc:	31 c0                	xor    %eax,%eax
+  8027fe:	31 d2                	xor    %edx,%edx
+  802800:	bf 01 00 00 00       	mov    $0x1,%edi
+  802805:	09 d9                	or     %ebx,%ecx
+  802807:	0f 85 36 ff ff ff    	jne    802743 <__divdi3+0x63>
+  80280d:	83 c4 24             	add    $0x24,%esp
+  802810:	5b                   	pop    %ebx
+  802811:	5e                   	pop    %esi
+  802812:	5f                   	pop    %edi
+  802813:	5d                   	pop    %ebp
+  802814:	c3                   	ret
+  802815:	31 ff                	xor    %edi,%edi
+  802817:	e9 1a ff ff ff       	jmp    802736 <__divdi3+0x56>
+  80281c:	31 ff                	xor    %edi,%edi
+  80281e:	e9 20 ff ff ff       	jmp    802743 <__divdi3+0x63>
+  802823:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80282a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00802830 <__moddi3>:
+  802830:	55                   	push   %ebp
+  802831:	57                   	push   %edi
+  802832:	56                   	push   %esi
+  802833:	53                   	push   %ebx
+  802834:	83 ec 1c             	sub    $0x1c,%esp
+  802837:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  80283b:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  80283f:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  802843:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  802847:	89 c8                	mov    %ecx,%eax
+  802849:	89 f2                	mov    %esi,%edx
+  80284b:	89 f3                	mov    %esi,%ebx
+  80284d:	85 ed                	test   %ebp,%ebp
+  80284f:	0f 88 9d 00 00 00    	js     8028f2 <__moddi3+0xc2>
+  802855:	09 cb                	or     %ecx,%ebx
+  802857:	0f 84 8d 00 00 00    	je     8028ea <__moddi3+0xba>
+  80285d:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802861:	31 db                	xor    %ebx,%ebx
+  802863:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802867:	89 ca                	mov    %ecx,%edx
+  802869:	89 f0                	mov    %esi,%eax
+  80286b:	89 dd                	mov    %ebx,%ebp
+  80286d:	f7 da                	neg    %edx
+  80286f:	83 d0 00             	adc    $0x0,%eax
+  802872:	f7 d8                	neg    %eax
+  802874:	0f 49 f0             	cmovns %eax,%esi
+  802877:	0f 49 ca             	cmovns %edx,%ecx
+  80287a:	31 c0                	xor    %eax,%eax
+  80287c:	31 d2                	xor    %edx,%edx
+  80287e:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802882:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802886:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80288b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80288f:	90                   	nop
+  802890:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802894:	01 c0                	add    %eax,%eax
+  802896:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80289d:	00 
+  80289e:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  8028a2:	89 c6                	mov    %eax,%esi
+  8028a4:	89 d7                	mov    %edx,%edi
+  8028a6:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8028aa:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8028ae:	0f ad d0             	shrd   %cl,%edx,%eax
+  8028b1:	d3 ea                	shr    %cl,%edx
+  8028b3:	f6 c1 20             	test   $0x20,%cl
+  8028b6:	0f 45 c2             	cmovne %edx,%eax
+  8028b9:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8028bd:	83 e0 01             	and    $0x1,%eax
+  8028c0:	09 fa                	or     %edi,%edx
+  8028c2:	89 04 24             	mov    %eax,(%esp)
+  8028c5:	8b 04 24             	mov    (%esp),%eax
+  8028c8:	89 d7                	mov    %edx,%edi
+  8028ca:	09 f0                	or     %esi,%eax
+  8028cc:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  8028d0:	39 d8                	cmp    %ebx,%eax
+  8028d2:	19 f7                	sbb    %esi,%edi
+  8028d4:	72 04                	jb     8028da <__moddi3+0xaa>
+  8028d6:	29 d8                	sub    %ebx,%eax
+  8028d8:	19 f2                	sbb    %esi,%edx
+  8028da:	83 e9 01             	sub    $0x1,%ecx
+  8028dd:	73 b1                	jae    802890 <__moddi3+0x60>
+  8028df:	85 ed                	test   %ebp,%ebp
+  8028e1:	74 07                	je     8028ea <__moddi3+0xba>
+  8028e3:	f7 d8                	neg    %eax
+  8028e5:	83 d2 00             	adc    $0x0,%edx
+  8028e8:	f7 da                	neg    %edx
+  8028ea:	83 c4 1c             	add    $0x1c,%esp
+  8028ed:	5b                   	pop    %ebx
+  8028ee:	5e                   	pop    %esi
+  8028ef:	5f                   	pop    %edi
+  8028f0:	5d                   	pop    %ebp
+  8028f1:	c3                   	ret
+  8028f2:	09 cb                	or     %ecx,%ebx
+  8028f4:	74 f4                	je     8028ea <__moddi3+0xba>
+  8028f6:	f7 df                	neg    %edi
+  8028f8:	bb 01 00 00 00       	mov    $0x1,%ebx
+  8028fd:	83 d5 00             	adc    $0x0,%ebp
+  802900:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802904:	f7 dd                	neg    %ebp
+  802906:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  80290a:	e9 58 ff ff ff       	jmp    802867 <__moddi3+0x37>
@@ -0,0 +1,5797 @@
+
+obj/user/pingpongs.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 d2 00 00 00       	call   800103 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+uint32_t val;
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 2c             	sub    $0x2c,%esp
+	envid_t who;
+	uint32_t i;
+
+	i = 0;
+	if ((who = sfork()) != 0) {
+  80003c:	e8 2f 11 00 00       	call   801170 <sfork>
+  800041:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800044:	85 c0                	test   %eax,%eax
+  800046:	75 74                	jne    8000bc <umain+0x89>
+		cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+		ipc_send(who, 0, 0, 0);
+	}
+
+	while (1) {
+		ipc_recv(&who, 0, 0);
+  800048:	83 ec 04             	sub    $0x4,%esp
+  80004b:	6a 00                	push   $0x0
+  80004d:	6a 00                	push   $0x0
+  80004f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800052:	50                   	push   %eax
+  800053:	e8 32 11 00 00       	call   80118a <ipc_recv>
+		cprintf("%x got %d from %x (thisenv is %p %x)\n", sys_getenvid(), val, who, thisenv, thisenv->env_id);
+  800058:	8b 1d 0c 40 80 00    	mov    0x80400c,%ebx
+  80005e:	8b 7b 48             	mov    0x48(%ebx),%edi
+  800061:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800064:	a1 08 40 80 00       	mov    0x804008,%eax
+  800069:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80006c:	e8 f1 0a 00 00       	call   800b62 <sys_getenvid>
+  800071:	83 c4 08             	add    $0x8,%esp
+  800074:	57                   	push   %edi
+  800075:	53                   	push   %ebx
+  800076:	56                   	push   %esi
+  800077:	ff 75 d4             	push   -0x2c(%ebp)
+  80007a:	50                   	push   %eax
+  80007b:	68 90 29 80 00       	push   $0x802990
+  800080:	e8 76 01 00 00       	call   8001fb <cprintf>
+		if (val == 10)
+  800085:	a1 08 40 80 00       	mov    0x804008,%eax
+  80008a:	83 c4 20             	add    $0x20,%esp
+  80008d:	83 f8 0a             	cmp    $0xa,%eax
+  800090:	74 22                	je     8000b4 <umain+0x81>
+			return;
+		++val;
+  800092:	83 c0 01             	add    $0x1,%eax
+  800095:	a3 08 40 80 00       	mov    %eax,0x804008
+		ipc_send(who, 0, 0, 0);
+  80009a:	6a 00                	push   $0x0
+  80009c:	6a 00                	push   $0x0
+  80009e:	6a 00                	push   $0x0
+  8000a0:	ff 75 e4             	push   -0x1c(%ebp)
+  8000a3:	e8 56 11 00 00       	call   8011fe <ipc_send>
+		if (val == 10)
+  8000a8:	83 c4 10             	add    $0x10,%esp
+  8000ab:	83 3d 08 40 80 00 0a 	cmpl   $0xa,0x804008
+  8000b2:	75 94                	jne    800048 <umain+0x15>
+			return;
+	}
+
+}
+  8000b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000b7:	5b                   	pop    %ebx
+  8000b8:	5e                   	pop    %esi
+  8000b9:	5f                   	pop    %edi
+  8000ba:	5d                   	pop    %ebp
+  8000bb:	c3                   	ret
+		cprintf("i am %08x; thisenv is %p\n", sys_getenvid(), thisenv);
+  8000bc:	8b 1d 0c 40 80 00    	mov    0x80400c,%ebx
+  8000c2:	e8 9b 0a 00 00       	call   800b62 <sys_getenvid>
+  8000c7:	83 ec 04             	sub    $0x4,%esp
+  8000ca:	53                   	push   %ebx
+  8000cb:	50                   	push   %eax
+  8000cc:	68 60 29 80 00       	push   $0x802960
+  8000d1:	e8 25 01 00 00       	call   8001fb <cprintf>
+		cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+  8000d6:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8000d9:	e8 84 0a 00 00       	call   800b62 <sys_getenvid>
+  8000de:	83 c4 0c             	add    $0xc,%esp
+  8000e1:	53                   	push   %ebx
+  8000e2:	50                   	push   %eax
+  8000e3:	68 7a 29 80 00       	push   $0x80297a
+  8000e8:	e8 0e 01 00 00       	call   8001fb <cprintf>
+		ipc_send(who, 0, 0, 0);
+  8000ed:	6a 00                	push   $0x0
+  8000ef:	6a 00                	push   $0x0
+  8000f1:	6a 00                	push   $0x0
+  8000f3:	ff 75 e4             	push   -0x1c(%ebp)
+  8000f6:	e8 03 11 00 00       	call   8011fe <ipc_send>
+  8000fb:	83 c4 20             	add    $0x20,%esp
+  8000fe:	e9 45 ff ff ff       	jmp    800048 <umain+0x15>
+
+00800103 <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  800103:	55                   	push   %ebp
+  800104:	89 e5                	mov    %esp,%ebp
+  800106:	56                   	push   %esi
+  800107:	53                   	push   %ebx
+  800108:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80010b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  80010e:	e8 4f 0a 00 00       	call   800b62 <sys_getenvid>
+  800113:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800118:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80011b:	c1 e0 04             	shl    $0x4,%eax
+  80011e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800123:	a3 0c 40 80 00       	mov    %eax,0x80400c
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800128:	85 db                	test   %ebx,%ebx
+  80012a:	7e 07                	jle    800133 <libmain+0x30>
+    binaryname = argv[0];
+  80012c:	8b 06                	mov    (%esi),%eax
+  80012e:	a3 00 30 80 00       	mov    %eax,0x803000
+
+  // call user main routine
+  umain(argc, argv);
+  800133:	83 ec 08             	sub    $0x8,%esp
+  800136:	56                   	push   %esi
+  800137:	53                   	push   %ebx
+  800138:	e8 f6 fe ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  80013d:	e8 0a 00 00 00       	call   80014c <exit>
+}
+  800142:	83 c4 10             	add    $0x10,%esp
+  800145:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800148:	5b                   	pop    %ebx
+  800149:	5e                   	pop    %esi
+  80014a:	5d                   	pop    %ebp
+  80014b:	c3                   	ret
+
+0080014c <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80014c:	55                   	push   %ebp
+  80014d:	89 e5                	mov    %esp,%ebp
+  80014f:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800152:	e8 0e 13 00 00       	call   801465 <close_all>
+	sys_env_destroy(0);
+  800157:	83 ec 0c             	sub    $0xc,%esp
+  80015a:	6a 00                	push   $0x0
+  80015c:	e8 c0 09 00 00       	call   800b21 <sys_env_destroy>
+}
+  800161:	83 c4 10             	add    $0x10,%esp
+  800164:	c9                   	leave
+  800165:	c3                   	ret
+
+00800166 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800166:	55                   	push   %ebp
+  800167:	89 e5                	mov    %esp,%ebp
+  800169:	53                   	push   %ebx
+  80016a:	83 ec 04             	sub    $0x4,%esp
+  80016d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800170:	8b 13                	mov    (%ebx),%edx
+  800172:	8d 42 01             	lea    0x1(%edx),%eax
+  800175:	89 03                	mov    %eax,(%ebx)
+  800177:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80017a:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80017e:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800183:	74 09                	je     80018e <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800185:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800189:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80018c:	c9                   	leave
+  80018d:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80018e:	83 ec 08             	sub    $0x8,%esp
+  800191:	68 ff 00 00 00       	push   $0xff
+  800196:	8d 43 08             	lea    0x8(%ebx),%eax
+  800199:	50                   	push   %eax
+  80019a:	e8 45 09 00 00       	call   800ae4 <sys_cputs>
+		b->idx = 0;
+  80019f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001a5:	83 c4 10             	add    $0x10,%esp
+  8001a8:	eb db                	jmp    800185 <putch+0x1f>
+
+008001aa <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001aa:	55                   	push   %ebp
+  8001ab:	89 e5                	mov    %esp,%ebp
+  8001ad:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001b3:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001ba:	00 00 00 
+	b.cnt = 0;
+  8001bd:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001c4:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001c7:	ff 75 0c             	push   0xc(%ebp)
+  8001ca:	ff 75 08             	push   0x8(%ebp)
+  8001cd:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001d3:	50                   	push   %eax
+  8001d4:	68 66 01 80 00       	push   $0x800166
+  8001d9:	e8 14 01 00 00       	call   8002f2 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8001de:	83 c4 08             	add    $0x8,%esp
+  8001e1:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001e7:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001ed:	50                   	push   %eax
+  8001ee:	e8 f1 08 00 00       	call   800ae4 <sys_cputs>
+
+	return b.cnt;
+}
+  8001f3:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001f9:	c9                   	leave
+  8001fa:	c3                   	ret
+
+008001fb <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001fb:	55                   	push   %ebp
+  8001fc:	89 e5                	mov    %esp,%ebp
+  8001fe:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800201:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800204:	50                   	push   %eax
+  800205:	ff 75 08             	push   0x8(%ebp)
+  800208:	e8 9d ff ff ff       	call   8001aa <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80020d:	c9                   	leave
+  80020e:	c3                   	ret
+
+0080020f <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80020f:	55                   	push   %ebp
+  800210:	89 e5                	mov    %esp,%ebp
+  800212:	57                   	push   %edi
+  800213:	56                   	push   %esi
+  800214:	53                   	push   %ebx
+  800215:	83 ec 1c             	sub    $0x1c,%esp
+  800218:	89 c7                	mov    %eax,%edi
+  80021a:	89 d6                	mov    %edx,%esi
+  80021c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80021f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800222:	89 d1                	mov    %edx,%ecx
+  800224:	89 c2                	mov    %eax,%edx
+  800226:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800229:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80022c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80022f:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800232:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800235:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80023c:	39 c2                	cmp    %eax,%edx
+  80023e:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800241:	72 3e                	jb     800281 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800243:	83 ec 0c             	sub    $0xc,%esp
+  800246:	ff 75 18             	push   0x18(%ebp)
+  800249:	83 eb 01             	sub    $0x1,%ebx
+  80024c:	53                   	push   %ebx
+  80024d:	50                   	push   %eax
+  80024e:	83 ec 08             	sub    $0x8,%esp
+  800251:	ff 75 e4             	push   -0x1c(%ebp)
+  800254:	ff 75 e0             	push   -0x20(%ebp)
+  800257:	ff 75 dc             	push   -0x24(%ebp)
+  80025a:	ff 75 d8             	push   -0x28(%ebp)
+  80025d:	e8 6e 23 00 00       	call   8025d0 <__udivdi3>
+  800262:	83 c4 18             	add    $0x18,%esp
+  800265:	52                   	push   %edx
+  800266:	50                   	push   %eax
+  800267:	89 f2                	mov    %esi,%edx
+  800269:	89 f8                	mov    %edi,%eax
+  80026b:	e8 9f ff ff ff       	call   80020f <printnum>
+  800270:	83 c4 20             	add    $0x20,%esp
+  800273:	eb 13                	jmp    800288 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800275:	83 ec 08             	sub    $0x8,%esp
+  800278:	56                   	push   %esi
+  800279:	ff 75 18             	push   0x18(%ebp)
+  80027c:	ff d7                	call   *%edi
+  80027e:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800281:	83 eb 01             	sub    $0x1,%ebx
+  800284:	85 db                	test   %ebx,%ebx
+  800286:	7f ed                	jg     800275 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800288:	83 ec 08             	sub    $0x8,%esp
+  80028b:	56                   	push   %esi
+  80028c:	83 ec 04             	sub    $0x4,%esp
+  80028f:	ff 75 e4             	push   -0x1c(%ebp)
+  800292:	ff 75 e0             	push   -0x20(%ebp)
+  800295:	ff 75 dc             	push   -0x24(%ebp)
+  800298:	ff 75 d8             	push   -0x28(%ebp)
+  80029b:	e8 00 24 00 00       	call   8026a0 <__umoddi3>
+  8002a0:	83 c4 14             	add    $0x14,%esp
+  8002a3:	0f be 80 c0 29 80 00 	movsbl 0x8029c0(%eax),%eax
+  8002aa:	50                   	push   %eax
+  8002ab:	ff d7                	call   *%edi
+}
+  8002ad:	83 c4 10             	add    $0x10,%esp
+  8002b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002b3:	5b                   	pop    %ebx
+  8002b4:	5e                   	pop    %esi
+  8002b5:	5f                   	pop    %edi
+  8002b6:	5d                   	pop    %ebp
+  8002b7:	c3                   	ret
+
+008002b8 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002b8:	55                   	push   %ebp
+  8002b9:	89 e5                	mov    %esp,%ebp
+  8002bb:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8002be:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002c2:	8b 10                	mov    (%eax),%edx
+  8002c4:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002c7:	73 0a                	jae    8002d3 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8002c9:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002cc:	89 08                	mov    %ecx,(%eax)
+  8002ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002d1:	88 02                	mov    %al,(%edx)
+}
+  8002d3:	5d                   	pop    %ebp
+  8002d4:	c3                   	ret
+
+008002d5 <printfmt>:
+{
+  8002d5:	55                   	push   %ebp
+  8002d6:	89 e5                	mov    %esp,%ebp
+  8002d8:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8002db:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8002de:	50                   	push   %eax
+  8002df:	ff 75 10             	push   0x10(%ebp)
+  8002e2:	ff 75 0c             	push   0xc(%ebp)
+  8002e5:	ff 75 08             	push   0x8(%ebp)
+  8002e8:	e8 05 00 00 00       	call   8002f2 <vprintfmt>
+}
+  8002ed:	83 c4 10             	add    $0x10,%esp
+  8002f0:	c9                   	leave
+  8002f1:	c3                   	ret
+
+008002f2 <vprintfmt>:
+{
+  8002f2:	55                   	push   %ebp
+  8002f3:	89 e5                	mov    %esp,%ebp
+  8002f5:	57                   	push   %edi
+  8002f6:	56                   	push   %esi
+  8002f7:	53                   	push   %ebx
+  8002f8:	83 ec 2c             	sub    $0x2c,%esp
+  8002fb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8002fe:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800301:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800304:	eb 0a                	jmp    800310 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800306:	83 ec 08             	sub    $0x8,%esp
+  800309:	53                   	push   %ebx
+  80030a:	50                   	push   %eax
+  80030b:	ff d6                	call   *%esi
+  80030d:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800310:	83 c7 01             	add    $0x1,%edi
+  800313:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800317:	83 f8 25             	cmp    $0x25,%eax
+  80031a:	74 0c                	je     800328 <vprintfmt+0x36>
+			if (ch == '\0')
+  80031c:	85 c0                	test   %eax,%eax
+  80031e:	75 e6                	jne    800306 <vprintfmt+0x14>
+}
+  800320:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800323:	5b                   	pop    %ebx
+  800324:	5e                   	pop    %esi
+  800325:	5f                   	pop    %edi
+  800326:	5d                   	pop    %ebp
+  800327:	c3                   	ret
+		padc = ' ';
+  800328:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80032c:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800333:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80033a:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800341:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800346:	8d 47 01             	lea    0x1(%edi),%eax
+  800349:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80034c:	0f b6 17             	movzbl (%edi),%edx
+  80034f:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800352:	3c 55                	cmp    $0x55,%al
+  800354:	0f 87 9a 03 00 00    	ja     8006f4 <vprintfmt+0x402>
+  80035a:	0f b6 c0             	movzbl %al,%eax
+  80035d:	ff 24 85 00 2b 80 00 	jmp    *0x802b00(,%eax,4)
+  800364:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800367:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80036b:	eb d9                	jmp    800346 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80036d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800370:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800374:	eb d0                	jmp    800346 <vprintfmt+0x54>
+  800376:	0f b6 d2             	movzbl %dl,%edx
+  800379:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80037c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800381:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800384:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800387:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80038b:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80038e:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800391:	83 f9 09             	cmp    $0x9,%ecx
+  800394:	77 55                	ja     8003eb <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800396:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800399:	eb e9                	jmp    800384 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  80039b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80039e:	8b 00                	mov    (%eax),%eax
+  8003a0:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003a6:	8d 40 04             	lea    0x4(%eax),%eax
+  8003a9:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003ac:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8003af:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003b3:	79 91                	jns    800346 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8003b5:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003b8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003bb:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003c2:	eb 82                	jmp    800346 <vprintfmt+0x54>
+			if (width < 0)
+  8003c4:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003c7:	85 d2                	test   %edx,%edx
+  8003c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ce:	0f 49 c2             	cmovns %edx,%eax
+  8003d1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003d4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003d7:	e9 6a ff ff ff       	jmp    800346 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003dc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8003df:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8003e6:	e9 5b ff ff ff       	jmp    800346 <vprintfmt+0x54>
+  8003eb:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003ee:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003f1:	eb bc                	jmp    8003af <vprintfmt+0xbd>
+			lflag++;
+  8003f3:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003f6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003f9:	e9 48 ff ff ff       	jmp    800346 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8003fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800401:	8d 78 04             	lea    0x4(%eax),%edi
+  800404:	83 ec 08             	sub    $0x8,%esp
+  800407:	53                   	push   %ebx
+  800408:	ff 30                	push   (%eax)
+  80040a:	ff d6                	call   *%esi
+			break;
+  80040c:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80040f:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800412:	e9 7c 02 00 00       	jmp    800693 <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  800417:	8b 45 14             	mov    0x14(%ebp),%eax
+  80041a:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80041d:	8b 10                	mov    (%eax),%edx
+  80041f:	89 d0                	mov    %edx,%eax
+  800421:	f7 d8                	neg    %eax
+  800423:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800426:	83 f8 10             	cmp    $0x10,%eax
+  800429:	7f 23                	jg     80044e <vprintfmt+0x15c>
+  80042b:	8b 14 85 60 2c 80 00 	mov    0x802c60(,%eax,4),%edx
+  800432:	85 d2                	test   %edx,%edx
+  800434:	74 18                	je     80044e <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800436:	52                   	push   %edx
+  800437:	68 bd 2e 80 00       	push   $0x802ebd
+  80043c:	53                   	push   %ebx
+  80043d:	56                   	push   %esi
+  80043e:	e8 92 fe ff ff       	call   8002d5 <printfmt>
+  800443:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800446:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800449:	e9 45 02 00 00       	jmp    800693 <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  80044e:	50                   	push   %eax
+  80044f:	68 d8 29 80 00       	push   $0x8029d8
+  800454:	53                   	push   %ebx
+  800455:	56                   	push   %esi
+  800456:	e8 7a fe ff ff       	call   8002d5 <printfmt>
+  80045b:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80045e:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800461:	e9 2d 02 00 00       	jmp    800693 <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800466:	8b 45 14             	mov    0x14(%ebp),%eax
+  800469:	83 c0 04             	add    $0x4,%eax
+  80046c:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80046f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800472:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800474:	85 c9                	test   %ecx,%ecx
+  800476:	b8 d1 29 80 00       	mov    $0x8029d1,%eax
+  80047b:	0f 45 c1             	cmovne %ecx,%eax
+  80047e:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800481:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800485:	7e 06                	jle    80048d <vprintfmt+0x19b>
+  800487:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80048b:	75 0b                	jne    800498 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80048d:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800490:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800493:	89 75 08             	mov    %esi,0x8(%ebp)
+  800496:	eb 5c                	jmp    8004f4 <vprintfmt+0x202>
+  800498:	83 ec 08             	sub    $0x8,%esp
+  80049b:	ff 75 d0             	push   -0x30(%ebp)
+  80049e:	ff 75 cc             	push   -0x34(%ebp)
+  8004a1:	e8 eb 02 00 00       	call   800791 <strnlen>
+  8004a6:	89 c2                	mov    %eax,%edx
+  8004a8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004ab:	29 d0                	sub    %edx,%eax
+  8004ad:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8004b0:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004b4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004b7:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004ba:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004bc:	eb 0e                	jmp    8004cc <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8004be:	83 ec 08             	sub    $0x8,%esp
+  8004c1:	53                   	push   %ebx
+  8004c2:	57                   	push   %edi
+  8004c3:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004c6:	83 ee 01             	sub    $0x1,%esi
+  8004c9:	83 c4 10             	add    $0x10,%esp
+  8004cc:	85 f6                	test   %esi,%esi
+  8004ce:	7f ee                	jg     8004be <vprintfmt+0x1cc>
+  8004d0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004d3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004d6:	85 c0                	test   %eax,%eax
+  8004d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004dd:	0f 49 d0             	cmovns %eax,%edx
+  8004e0:	29 d0                	sub    %edx,%eax
+  8004e2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004e5:	eb a6                	jmp    80048d <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8004e7:	83 ec 08             	sub    $0x8,%esp
+  8004ea:	53                   	push   %ebx
+  8004eb:	52                   	push   %edx
+  8004ec:	ff 55 08             	call   *0x8(%ebp)
+  8004ef:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004f2:	89 f1                	mov    %esi,%ecx
+  8004f4:	8d 71 01             	lea    0x1(%ecx),%esi
+  8004f7:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004fb:	0f be d0             	movsbl %al,%edx
+  8004fe:	85 d2                	test   %edx,%edx
+  800500:	74 28                	je     80052a <vprintfmt+0x238>
+  800502:	85 ff                	test   %edi,%edi
+  800504:	78 05                	js     80050b <vprintfmt+0x219>
+  800506:	83 ef 01             	sub    $0x1,%edi
+  800509:	78 30                	js     80053b <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80050b:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80050f:	74 d6                	je     8004e7 <vprintfmt+0x1f5>
+  800511:	0f be c0             	movsbl %al,%eax
+  800514:	83 e8 20             	sub    $0x20,%eax
+  800517:	83 f8 5e             	cmp    $0x5e,%eax
+  80051a:	76 cb                	jbe    8004e7 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80051c:	83 ec 08             	sub    $0x8,%esp
+  80051f:	53                   	push   %ebx
+  800520:	6a 3f                	push   $0x3f
+  800522:	ff 55 08             	call   *0x8(%ebp)
+  800525:	83 c4 10             	add    $0x10,%esp
+  800528:	eb c8                	jmp    8004f2 <vprintfmt+0x200>
+  80052a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80052d:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800530:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800533:	01 d0                	add    %edx,%eax
+  800535:	29 c8                	sub    %ecx,%eax
+  800537:	89 c7                	mov    %eax,%edi
+  800539:	eb 13                	jmp    80054e <vprintfmt+0x25c>
+  80053b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80053e:	eb ed                	jmp    80052d <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800540:	83 ec 08             	sub    $0x8,%esp
+  800543:	53                   	push   %ebx
+  800544:	6a 20                	push   $0x20
+  800546:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800548:	83 ef 01             	sub    $0x1,%edi
+  80054b:	83 c4 10             	add    $0x10,%esp
+  80054e:	85 ff                	test   %edi,%edi
+  800550:	7f ee                	jg     800540 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800552:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800555:	89 45 14             	mov    %eax,0x14(%ebp)
+  800558:	e9 36 01 00 00       	jmp    800693 <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  80055d:	83 f9 01             	cmp    $0x1,%ecx
+  800560:	7f 1f                	jg     800581 <vprintfmt+0x28f>
+	else if (lflag)
+  800562:	85 c9                	test   %ecx,%ecx
+  800564:	74 67                	je     8005cd <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800566:	8b 45 14             	mov    0x14(%ebp),%eax
+  800569:	8b 00                	mov    (%eax),%eax
+  80056b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80056e:	89 c1                	mov    %eax,%ecx
+  800570:	c1 f9 1f             	sar    $0x1f,%ecx
+  800573:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800576:	8b 45 14             	mov    0x14(%ebp),%eax
+  800579:	8d 40 04             	lea    0x4(%eax),%eax
+  80057c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80057f:	eb 17                	jmp    800598 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800581:	8b 45 14             	mov    0x14(%ebp),%eax
+  800584:	8b 50 04             	mov    0x4(%eax),%edx
+  800587:	8b 00                	mov    (%eax),%eax
+  800589:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80058c:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80058f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800592:	8d 40 08             	lea    0x8(%eax),%eax
+  800595:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800598:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80059b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80059e:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8005a3:	85 c9                	test   %ecx,%ecx
+  8005a5:	0f 89 ce 00 00 00    	jns    800679 <vprintfmt+0x387>
+				putch('-', putdat);
+  8005ab:	83 ec 08             	sub    $0x8,%esp
+  8005ae:	53                   	push   %ebx
+  8005af:	6a 2d                	push   $0x2d
+  8005b1:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8005b3:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005b6:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005b9:	f7 da                	neg    %edx
+  8005bb:	83 d1 00             	adc    $0x0,%ecx
+  8005be:	f7 d9                	neg    %ecx
+  8005c0:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8005c3:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005c8:	e9 ac 00 00 00       	jmp    800679 <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  8005cd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d0:	8b 00                	mov    (%eax),%eax
+  8005d2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005d5:	89 c1                	mov    %eax,%ecx
+  8005d7:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005da:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005dd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e0:	8d 40 04             	lea    0x4(%eax),%eax
+  8005e3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005e6:	eb b0                	jmp    800598 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8005e8:	83 f9 01             	cmp    $0x1,%ecx
+  8005eb:	7f 1b                	jg     800608 <vprintfmt+0x316>
+	else if (lflag)
+  8005ed:	85 c9                	test   %ecx,%ecx
+  8005ef:	74 2c                	je     80061d <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  8005f1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f4:	8b 10                	mov    (%eax),%edx
+  8005f6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005fb:	8d 40 04             	lea    0x4(%eax),%eax
+  8005fe:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800601:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800606:	eb 71                	jmp    800679 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  800608:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060b:	8b 10                	mov    (%eax),%edx
+  80060d:	8b 48 04             	mov    0x4(%eax),%ecx
+  800610:	8d 40 08             	lea    0x8(%eax),%eax
+  800613:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800616:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80061b:	eb 5c                	jmp    800679 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  80061d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800620:	8b 10                	mov    (%eax),%edx
+  800622:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800627:	8d 40 04             	lea    0x4(%eax),%eax
+  80062a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80062d:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800632:	eb 45                	jmp    800679 <vprintfmt+0x387>
+			putch('X', putdat);
+  800634:	83 ec 08             	sub    $0x8,%esp
+  800637:	53                   	push   %ebx
+  800638:	6a 58                	push   $0x58
+  80063a:	ff d6                	call   *%esi
+			putch('X', putdat);
+  80063c:	83 c4 08             	add    $0x8,%esp
+  80063f:	53                   	push   %ebx
+  800640:	6a 58                	push   $0x58
+  800642:	ff d6                	call   *%esi
+			putch('X', putdat);
+  800644:	83 c4 08             	add    $0x8,%esp
+  800647:	53                   	push   %ebx
+  800648:	6a 58                	push   $0x58
+  80064a:	ff d6                	call   *%esi
+			break;
+  80064c:	83 c4 10             	add    $0x10,%esp
+  80064f:	eb 42                	jmp    800693 <vprintfmt+0x3a1>
+			putch('0', putdat);
+  800651:	83 ec 08             	sub    $0x8,%esp
+  800654:	53                   	push   %ebx
+  800655:	6a 30                	push   $0x30
+  800657:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800659:	83 c4 08             	add    $0x8,%esp
+  80065c:	53                   	push   %ebx
+  80065d:	6a 78                	push   $0x78
+  80065f:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800661:	8b 45 14             	mov    0x14(%ebp),%eax
+  800664:	8b 10                	mov    (%eax),%edx
+  800666:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80066b:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80066e:	8d 40 04             	lea    0x4(%eax),%eax
+  800671:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800674:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800679:	83 ec 0c             	sub    $0xc,%esp
+  80067c:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800680:	50                   	push   %eax
+  800681:	ff 75 e0             	push   -0x20(%ebp)
+  800684:	57                   	push   %edi
+  800685:	51                   	push   %ecx
+  800686:	52                   	push   %edx
+  800687:	89 da                	mov    %ebx,%edx
+  800689:	89 f0                	mov    %esi,%eax
+  80068b:	e8 7f fb ff ff       	call   80020f <printnum>
+			break;
+  800690:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800693:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800696:	e9 75 fc ff ff       	jmp    800310 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  80069b:	83 f9 01             	cmp    $0x1,%ecx
+  80069e:	7f 1b                	jg     8006bb <vprintfmt+0x3c9>
+	else if (lflag)
+  8006a0:	85 c9                	test   %ecx,%ecx
+  8006a2:	74 2c                	je     8006d0 <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  8006a4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a7:	8b 10                	mov    (%eax),%edx
+  8006a9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006ae:	8d 40 04             	lea    0x4(%eax),%eax
+  8006b1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006b4:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8006b9:	eb be                	jmp    800679 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  8006bb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006be:	8b 10                	mov    (%eax),%edx
+  8006c0:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006c3:	8d 40 08             	lea    0x8(%eax),%eax
+  8006c6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006c9:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8006ce:	eb a9                	jmp    800679 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  8006d0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d3:	8b 10                	mov    (%eax),%edx
+  8006d5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006da:	8d 40 04             	lea    0x4(%eax),%eax
+  8006dd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006e0:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8006e5:	eb 92                	jmp    800679 <vprintfmt+0x387>
+			putch(ch, putdat);
+  8006e7:	83 ec 08             	sub    $0x8,%esp
+  8006ea:	53                   	push   %ebx
+  8006eb:	6a 25                	push   $0x25
+  8006ed:	ff d6                	call   *%esi
+			break;
+  8006ef:	83 c4 10             	add    $0x10,%esp
+  8006f2:	eb 9f                	jmp    800693 <vprintfmt+0x3a1>
+			putch('%', putdat);
+  8006f4:	83 ec 08             	sub    $0x8,%esp
+  8006f7:	53                   	push   %ebx
+  8006f8:	6a 25                	push   $0x25
+  8006fa:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8006fc:	83 c4 10             	add    $0x10,%esp
+  8006ff:	89 f8                	mov    %edi,%eax
+  800701:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800705:	74 05                	je     80070c <vprintfmt+0x41a>
+  800707:	83 e8 01             	sub    $0x1,%eax
+  80070a:	eb f5                	jmp    800701 <vprintfmt+0x40f>
+  80070c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80070f:	eb 82                	jmp    800693 <vprintfmt+0x3a1>
+
+00800711 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800711:	55                   	push   %ebp
+  800712:	89 e5                	mov    %esp,%ebp
+  800714:	83 ec 18             	sub    $0x18,%esp
+  800717:	8b 45 08             	mov    0x8(%ebp),%eax
+  80071a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80071d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800720:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800724:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800727:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80072e:	85 c0                	test   %eax,%eax
+  800730:	74 26                	je     800758 <vsnprintf+0x47>
+  800732:	85 d2                	test   %edx,%edx
+  800734:	7e 22                	jle    800758 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800736:	ff 75 14             	push   0x14(%ebp)
+  800739:	ff 75 10             	push   0x10(%ebp)
+  80073c:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80073f:	50                   	push   %eax
+  800740:	68 b8 02 80 00       	push   $0x8002b8
+  800745:	e8 a8 fb ff ff       	call   8002f2 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80074a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80074d:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800750:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800753:	83 c4 10             	add    $0x10,%esp
+}
+  800756:	c9                   	leave
+  800757:	c3                   	ret
+		return -E_INVAL;
+  800758:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80075d:	eb f7                	jmp    800756 <vsnprintf+0x45>
+
+0080075f <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80075f:	55                   	push   %ebp
+  800760:	89 e5                	mov    %esp,%ebp
+  800762:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800765:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800768:	50                   	push   %eax
+  800769:	ff 75 10             	push   0x10(%ebp)
+  80076c:	ff 75 0c             	push   0xc(%ebp)
+  80076f:	ff 75 08             	push   0x8(%ebp)
+  800772:	e8 9a ff ff ff       	call   800711 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800777:	c9                   	leave
+  800778:	c3                   	ret
+
+00800779 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800779:	55                   	push   %ebp
+  80077a:	89 e5                	mov    %esp,%ebp
+  80077c:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80077f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800784:	eb 03                	jmp    800789 <strlen+0x10>
+		n++;
+  800786:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800789:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80078d:	75 f7                	jne    800786 <strlen+0xd>
+	return n;
+}
+  80078f:	5d                   	pop    %ebp
+  800790:	c3                   	ret
+
+00800791 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800791:	55                   	push   %ebp
+  800792:	89 e5                	mov    %esp,%ebp
+  800794:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800797:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80079a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80079f:	eb 03                	jmp    8007a4 <strnlen+0x13>
+		n++;
+  8007a1:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007a4:	39 d0                	cmp    %edx,%eax
+  8007a6:	74 08                	je     8007b0 <strnlen+0x1f>
+  8007a8:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8007ac:	75 f3                	jne    8007a1 <strnlen+0x10>
+  8007ae:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8007b0:	89 d0                	mov    %edx,%eax
+  8007b2:	5d                   	pop    %ebp
+  8007b3:	c3                   	ret
+
+008007b4 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8007b4:	55                   	push   %ebp
+  8007b5:	89 e5                	mov    %esp,%ebp
+  8007b7:	53                   	push   %ebx
+  8007b8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007bb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8007be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007c3:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8007c7:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8007ca:	83 c0 01             	add    $0x1,%eax
+  8007cd:	84 d2                	test   %dl,%dl
+  8007cf:	75 f2                	jne    8007c3 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8007d1:	89 c8                	mov    %ecx,%eax
+  8007d3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007d6:	c9                   	leave
+  8007d7:	c3                   	ret
+
+008007d8 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8007d8:	55                   	push   %ebp
+  8007d9:	89 e5                	mov    %esp,%ebp
+  8007db:	53                   	push   %ebx
+  8007dc:	83 ec 10             	sub    $0x10,%esp
+  8007df:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8007e2:	53                   	push   %ebx
+  8007e3:	e8 91 ff ff ff       	call   800779 <strlen>
+  8007e8:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8007eb:	ff 75 0c             	push   0xc(%ebp)
+  8007ee:	01 d8                	add    %ebx,%eax
+  8007f0:	50                   	push   %eax
+  8007f1:	e8 be ff ff ff       	call   8007b4 <strcpy>
+	return dst;
+}
+  8007f6:	89 d8                	mov    %ebx,%eax
+  8007f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007fb:	c9                   	leave
+  8007fc:	c3                   	ret
+
+008007fd <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8007fd:	55                   	push   %ebp
+  8007fe:	89 e5                	mov    %esp,%ebp
+  800800:	56                   	push   %esi
+  800801:	53                   	push   %ebx
+  800802:	8b 75 08             	mov    0x8(%ebp),%esi
+  800805:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800808:	89 f3                	mov    %esi,%ebx
+  80080a:	03 5d 10             	add    0x10(%ebp),%ebx
+  80080d:	89 f0                	mov    %esi,%eax
+  80080f:	eb 0f                	jmp    800820 <strncpy+0x23>
+		*dst++ = *src;
+  800811:	83 c0 01             	add    $0x1,%eax
+  800814:	0f b6 0a             	movzbl (%edx),%ecx
+  800817:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80081a:	80 f9 01             	cmp    $0x1,%cl
+  80081d:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800820:	39 d8                	cmp    %ebx,%eax
+  800822:	75 ed                	jne    800811 <strncpy+0x14>
+	}
+	return ret;
+}
+  800824:	89 f0                	mov    %esi,%eax
+  800826:	5b                   	pop    %ebx
+  800827:	5e                   	pop    %esi
+  800828:	5d                   	pop    %ebp
+  800829:	c3                   	ret
+
+0080082a <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80082a:	55                   	push   %ebp
+  80082b:	89 e5                	mov    %esp,%ebp
+  80082d:	56                   	push   %esi
+  80082e:	53                   	push   %ebx
+  80082f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800832:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800835:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800838:	89 f0                	mov    %esi,%eax
+  80083a:	85 d2                	test   %edx,%edx
+  80083c:	74 21                	je     80085f <strlcpy+0x35>
+  80083e:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800842:	89 f2                	mov    %esi,%edx
+  800844:	eb 09                	jmp    80084f <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800846:	83 c1 01             	add    $0x1,%ecx
+  800849:	83 c2 01             	add    $0x1,%edx
+  80084c:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80084f:	39 c2                	cmp    %eax,%edx
+  800851:	74 09                	je     80085c <strlcpy+0x32>
+  800853:	0f b6 19             	movzbl (%ecx),%ebx
+  800856:	84 db                	test   %bl,%bl
+  800858:	75 ec                	jne    800846 <strlcpy+0x1c>
+  80085a:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80085c:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80085f:	29 f0                	sub    %esi,%eax
+}
+  800861:	5b                   	pop    %ebx
+  800862:	5e                   	pop    %esi
+  800863:	5d                   	pop    %ebp
+  800864:	c3                   	ret
+
+00800865 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800865:	55                   	push   %ebp
+  800866:	89 e5                	mov    %esp,%ebp
+  800868:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80086b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80086e:	eb 06                	jmp    800876 <strcmp+0x11>
+		p++, q++;
+  800870:	83 c1 01             	add    $0x1,%ecx
+  800873:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800876:	0f b6 01             	movzbl (%ecx),%eax
+  800879:	84 c0                	test   %al,%al
+  80087b:	74 04                	je     800881 <strcmp+0x1c>
+  80087d:	3a 02                	cmp    (%edx),%al
+  80087f:	74 ef                	je     800870 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800881:	0f b6 c0             	movzbl %al,%eax
+  800884:	0f b6 12             	movzbl (%edx),%edx
+  800887:	29 d0                	sub    %edx,%eax
+}
+  800889:	5d                   	pop    %ebp
+  80088a:	c3                   	ret
+
+0080088b <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80088b:	55                   	push   %ebp
+  80088c:	89 e5                	mov    %esp,%ebp
+  80088e:	53                   	push   %ebx
+  80088f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800892:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800895:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800898:	eb 09                	jmp    8008a3 <strncmp+0x18>
+		n--, p++, q++;
+  80089a:	83 ea 01             	sub    $0x1,%edx
+  80089d:	83 c0 01             	add    $0x1,%eax
+  8008a0:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8008a3:	85 d2                	test   %edx,%edx
+  8008a5:	74 18                	je     8008bf <strncmp+0x34>
+  8008a7:	0f b6 18             	movzbl (%eax),%ebx
+  8008aa:	84 db                	test   %bl,%bl
+  8008ac:	74 04                	je     8008b2 <strncmp+0x27>
+  8008ae:	3a 19                	cmp    (%ecx),%bl
+  8008b0:	74 e8                	je     80089a <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008b2:	0f b6 00             	movzbl (%eax),%eax
+  8008b5:	0f b6 11             	movzbl (%ecx),%edx
+  8008b8:	29 d0                	sub    %edx,%eax
+}
+  8008ba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008bd:	c9                   	leave
+  8008be:	c3                   	ret
+		return 0;
+  8008bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008c4:	eb f4                	jmp    8008ba <strncmp+0x2f>
+
+008008c6 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8008c6:	55                   	push   %ebp
+  8008c7:	89 e5                	mov    %esp,%ebp
+  8008c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008cc:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008d0:	eb 03                	jmp    8008d5 <strchr+0xf>
+  8008d2:	83 c0 01             	add    $0x1,%eax
+  8008d5:	0f b6 10             	movzbl (%eax),%edx
+  8008d8:	84 d2                	test   %dl,%dl
+  8008da:	74 06                	je     8008e2 <strchr+0x1c>
+		if (*s == c)
+  8008dc:	38 ca                	cmp    %cl,%dl
+  8008de:	75 f2                	jne    8008d2 <strchr+0xc>
+  8008e0:	eb 05                	jmp    8008e7 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8008e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008e7:	5d                   	pop    %ebp
+  8008e8:	c3                   	ret
+
+008008e9 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8008e9:	55                   	push   %ebp
+  8008ea:	89 e5                	mov    %esp,%ebp
+  8008ec:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008ef:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008f3:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8008f6:	38 ca                	cmp    %cl,%dl
+  8008f8:	74 09                	je     800903 <strfind+0x1a>
+  8008fa:	84 d2                	test   %dl,%dl
+  8008fc:	74 05                	je     800903 <strfind+0x1a>
+	for (; *s; s++)
+  8008fe:	83 c0 01             	add    $0x1,%eax
+  800901:	eb f0                	jmp    8008f3 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800903:	5d                   	pop    %ebp
+  800904:	c3                   	ret
+
+00800905 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800905:	55                   	push   %ebp
+  800906:	89 e5                	mov    %esp,%ebp
+  800908:	57                   	push   %edi
+  800909:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80090c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  80090f:	85 c9                	test   %ecx,%ecx
+  800911:	74 20                	je     800933 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800913:	89 f8                	mov    %edi,%eax
+  800915:	09 c8                	or     %ecx,%eax
+  800917:	a8 03                	test   $0x3,%al
+  800919:	75 12                	jne    80092d <memset+0x28>
+		c &= 0xFF;
+  80091b:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80091f:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800925:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800928:	fc                   	cld
+  800929:	f3 ab                	rep stos %eax,%es:(%edi)
+  80092b:	eb 06                	jmp    800933 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80092d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800930:	fc                   	cld
+  800931:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800933:	89 f8                	mov    %edi,%eax
+  800935:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800938:	c9                   	leave
+  800939:	c3                   	ret
+
+0080093a <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  80093a:	55                   	push   %ebp
+  80093b:	89 e5                	mov    %esp,%ebp
+  80093d:	57                   	push   %edi
+  80093e:	56                   	push   %esi
+  80093f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800942:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800945:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800948:	39 c6                	cmp    %eax,%esi
+  80094a:	73 32                	jae    80097e <memmove+0x44>
+  80094c:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80094f:	39 d0                	cmp    %edx,%eax
+  800951:	73 2b                	jae    80097e <memmove+0x44>
+		s += n;
+		d += n;
+  800953:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800956:	89 d6                	mov    %edx,%esi
+  800958:	09 fe                	or     %edi,%esi
+  80095a:	09 ce                	or     %ecx,%esi
+  80095c:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800962:	75 0e                	jne    800972 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800964:	83 ef 04             	sub    $0x4,%edi
+  800967:	8d 72 fc             	lea    -0x4(%edx),%esi
+  80096a:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  80096d:	fd                   	std
+  80096e:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800970:	eb 09                	jmp    80097b <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800972:	83 ef 01             	sub    $0x1,%edi
+  800975:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800978:	fd                   	std
+  800979:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  80097b:	fc                   	cld
+  80097c:	eb 1a                	jmp    800998 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80097e:	89 f2                	mov    %esi,%edx
+  800980:	09 c2                	or     %eax,%edx
+  800982:	09 ca                	or     %ecx,%edx
+  800984:	f6 c2 03             	test   $0x3,%dl
+  800987:	75 0a                	jne    800993 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800989:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  80098c:	89 c7                	mov    %eax,%edi
+  80098e:	fc                   	cld
+  80098f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800991:	eb 05                	jmp    800998 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800993:	89 c7                	mov    %eax,%edi
+  800995:	fc                   	cld
+  800996:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800998:	5e                   	pop    %esi
+  800999:	5f                   	pop    %edi
+  80099a:	5d                   	pop    %ebp
+  80099b:	c3                   	ret
+
+0080099c <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  80099c:	55                   	push   %ebp
+  80099d:	89 e5                	mov    %esp,%ebp
+  80099f:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8009a2:	ff 75 10             	push   0x10(%ebp)
+  8009a5:	ff 75 0c             	push   0xc(%ebp)
+  8009a8:	ff 75 08             	push   0x8(%ebp)
+  8009ab:	e8 8a ff ff ff       	call   80093a <memmove>
+}
+  8009b0:	c9                   	leave
+  8009b1:	c3                   	ret
+
+008009b2 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8009b2:	55                   	push   %ebp
+  8009b3:	89 e5                	mov    %esp,%ebp
+  8009b5:	56                   	push   %esi
+  8009b6:	53                   	push   %ebx
+  8009b7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009ba:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8009bd:	89 c6                	mov    %eax,%esi
+  8009bf:	03 75 10             	add    0x10(%ebp),%esi
+  8009c2:	eb 06                	jmp    8009ca <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8009c4:	83 c0 01             	add    $0x1,%eax
+  8009c7:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  8009ca:	39 f0                	cmp    %esi,%eax
+  8009cc:	74 14                	je     8009e2 <memcmp+0x30>
+		if (*s1 != *s2)
+  8009ce:	0f b6 08             	movzbl (%eax),%ecx
+  8009d1:	0f b6 1a             	movzbl (%edx),%ebx
+  8009d4:	38 d9                	cmp    %bl,%cl
+  8009d6:	74 ec                	je     8009c4 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  8009d8:	0f b6 c1             	movzbl %cl,%eax
+  8009db:	0f b6 db             	movzbl %bl,%ebx
+  8009de:	29 d8                	sub    %ebx,%eax
+  8009e0:	eb 05                	jmp    8009e7 <memcmp+0x35>
+	}
+
+	return 0;
+  8009e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009e7:	5b                   	pop    %ebx
+  8009e8:	5e                   	pop    %esi
+  8009e9:	5d                   	pop    %ebp
+  8009ea:	c3                   	ret
+
+008009eb <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8009eb:	55                   	push   %ebp
+  8009ec:	89 e5                	mov    %esp,%ebp
+  8009ee:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8009f4:	89 c2                	mov    %eax,%edx
+  8009f6:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8009f9:	eb 03                	jmp    8009fe <memfind+0x13>
+  8009fb:	83 c0 01             	add    $0x1,%eax
+  8009fe:	39 d0                	cmp    %edx,%eax
+  800a00:	73 04                	jae    800a06 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a02:	38 08                	cmp    %cl,(%eax)
+  800a04:	75 f5                	jne    8009fb <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a06:	5d                   	pop    %ebp
+  800a07:	c3                   	ret
+
+00800a08 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a08:	55                   	push   %ebp
+  800a09:	89 e5                	mov    %esp,%ebp
+  800a0b:	57                   	push   %edi
+  800a0c:	56                   	push   %esi
+  800a0d:	53                   	push   %ebx
+  800a0e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a11:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a14:	eb 03                	jmp    800a19 <strtol+0x11>
+		s++;
+  800a16:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a19:	0f b6 02             	movzbl (%edx),%eax
+  800a1c:	3c 20                	cmp    $0x20,%al
+  800a1e:	74 f6                	je     800a16 <strtol+0xe>
+  800a20:	3c 09                	cmp    $0x9,%al
+  800a22:	74 f2                	je     800a16 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a24:	3c 2b                	cmp    $0x2b,%al
+  800a26:	74 2a                	je     800a52 <strtol+0x4a>
+	int neg = 0;
+  800a28:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a2d:	3c 2d                	cmp    $0x2d,%al
+  800a2f:	74 2b                	je     800a5c <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a31:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a37:	75 0f                	jne    800a48 <strtol+0x40>
+  800a39:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a3c:	74 28                	je     800a66 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a3e:	85 db                	test   %ebx,%ebx
+  800a40:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a45:	0f 44 d8             	cmove  %eax,%ebx
+  800a48:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a4d:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a50:	eb 46                	jmp    800a98 <strtol+0x90>
+		s++;
+  800a52:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a55:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a5a:	eb d5                	jmp    800a31 <strtol+0x29>
+		s++, neg = 1;
+  800a5c:	83 c2 01             	add    $0x1,%edx
+  800a5f:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a64:	eb cb                	jmp    800a31 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a66:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a6a:	74 0e                	je     800a7a <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a6c:	85 db                	test   %ebx,%ebx
+  800a6e:	75 d8                	jne    800a48 <strtol+0x40>
+		s++, base = 8;
+  800a70:	83 c2 01             	add    $0x1,%edx
+  800a73:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a78:	eb ce                	jmp    800a48 <strtol+0x40>
+		s += 2, base = 16;
+  800a7a:	83 c2 02             	add    $0x2,%edx
+  800a7d:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a82:	eb c4                	jmp    800a48 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a84:	0f be c0             	movsbl %al,%eax
+  800a87:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a8a:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a8d:	7d 3a                	jge    800ac9 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a8f:	83 c2 01             	add    $0x1,%edx
+  800a92:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a96:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a98:	0f b6 02             	movzbl (%edx),%eax
+  800a9b:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a9e:	89 f3                	mov    %esi,%ebx
+  800aa0:	80 fb 09             	cmp    $0x9,%bl
+  800aa3:	76 df                	jbe    800a84 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800aa5:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800aa8:	89 f3                	mov    %esi,%ebx
+  800aaa:	80 fb 19             	cmp    $0x19,%bl
+  800aad:	77 08                	ja     800ab7 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800aaf:	0f be c0             	movsbl %al,%eax
+  800ab2:	83 e8 57             	sub    $0x57,%eax
+  800ab5:	eb d3                	jmp    800a8a <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800ab7:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800aba:	89 f3                	mov    %esi,%ebx
+  800abc:	80 fb 19             	cmp    $0x19,%bl
+  800abf:	77 08                	ja     800ac9 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800ac1:	0f be c0             	movsbl %al,%eax
+  800ac4:	83 e8 37             	sub    $0x37,%eax
+  800ac7:	eb c1                	jmp    800a8a <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800ac9:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800acd:	74 05                	je     800ad4 <strtol+0xcc>
+		*endptr = (char *) s;
+  800acf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ad2:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800ad4:	89 c8                	mov    %ecx,%eax
+  800ad6:	f7 d8                	neg    %eax
+  800ad8:	85 ff                	test   %edi,%edi
+  800ada:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800add:	89 c8                	mov    %ecx,%eax
+  800adf:	5b                   	pop    %ebx
+  800ae0:	5e                   	pop    %esi
+  800ae1:	5f                   	pop    %edi
+  800ae2:	5d                   	pop    %ebp
+  800ae3:	c3                   	ret
+
+00800ae4 <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800ae4:	55                   	push   %ebp
+  800ae5:	89 e5                	mov    %esp,%ebp
+  800ae7:	57                   	push   %edi
+  800ae8:	56                   	push   %esi
+  800ae9:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800aea:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aef:	8b 55 08             	mov    0x8(%ebp),%edx
+  800af2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800af5:	89 c3                	mov    %eax,%ebx
+  800af7:	89 c7                	mov    %eax,%edi
+  800af9:	89 c6                	mov    %eax,%esi
+  800afb:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  800afd:	5b                   	pop    %ebx
+  800afe:	5e                   	pop    %esi
+  800aff:	5f                   	pop    %edi
+  800b00:	5d                   	pop    %ebp
+  800b01:	c3                   	ret
+
+00800b02 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800b02:	55                   	push   %ebp
+  800b03:	89 e5                	mov    %esp,%ebp
+  800b05:	57                   	push   %edi
+  800b06:	56                   	push   %esi
+  800b07:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800b08:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b0d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b12:	89 d1                	mov    %edx,%ecx
+  800b14:	89 d3                	mov    %edx,%ebx
+  800b16:	89 d7                	mov    %edx,%edi
+  800b18:	89 d6                	mov    %edx,%esi
+  800b1a:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800b1c:	5b                   	pop    %ebx
+  800b1d:	5e                   	pop    %esi
+  800b1e:	5f                   	pop    %edi
+  800b1f:	5d                   	pop    %ebp
+  800b20:	c3                   	ret
+
+00800b21 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800b21:	55                   	push   %ebp
+  800b22:	89 e5                	mov    %esp,%ebp
+  800b24:	57                   	push   %edi
+  800b25:	56                   	push   %esi
+  800b26:	53                   	push   %ebx
+  800b27:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800b2a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b2f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b32:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b37:	89 cb                	mov    %ecx,%ebx
+  800b39:	89 cf                	mov    %ecx,%edi
+  800b3b:	89 ce                	mov    %ecx,%esi
+  800b3d:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800b3f:	85 c0                	test   %eax,%eax
+  800b41:	7f 08                	jg     800b4b <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800b43:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b46:	5b                   	pop    %ebx
+  800b47:	5e                   	pop    %esi
+  800b48:	5f                   	pop    %edi
+  800b49:	5d                   	pop    %ebp
+  800b4a:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800b4b:	83 ec 0c             	sub    $0xc,%esp
+  800b4e:	50                   	push   %eax
+  800b4f:	6a 03                	push   $0x3
+  800b51:	68 c3 2c 80 00       	push   $0x802cc3
+  800b56:	6a 3e                	push   $0x3e
+  800b58:	68 e0 2c 80 00       	push   $0x802ce0
+  800b5d:	e8 40 18 00 00       	call   8023a2 <_panic>
+
+00800b62 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800b62:	55                   	push   %ebp
+  800b63:	89 e5                	mov    %esp,%ebp
+  800b65:	57                   	push   %edi
+  800b66:	56                   	push   %esi
+  800b67:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800b68:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b6d:	b8 02 00 00 00       	mov    $0x2,%eax
+  800b72:	89 d1                	mov    %edx,%ecx
+  800b74:	89 d3                	mov    %edx,%ebx
+  800b76:	89 d7                	mov    %edx,%edi
+  800b78:	89 d6                	mov    %edx,%esi
+  800b7a:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800b7c:	5b                   	pop    %ebx
+  800b7d:	5e                   	pop    %esi
+  800b7e:	5f                   	pop    %edi
+  800b7f:	5d                   	pop    %ebp
+  800b80:	c3                   	ret
+
+00800b81 <sys_yield>:
+
+void
+sys_yield(void) {
+  800b81:	55                   	push   %ebp
+  800b82:	89 e5                	mov    %esp,%ebp
+  800b84:	57                   	push   %edi
+  800b85:	56                   	push   %esi
+  800b86:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800b87:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b8c:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800b91:	89 d1                	mov    %edx,%ecx
+  800b93:	89 d3                	mov    %edx,%ebx
+  800b95:	89 d7                	mov    %edx,%edi
+  800b97:	89 d6                	mov    %edx,%esi
+  800b99:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800b9b:	5b                   	pop    %ebx
+  800b9c:	5e                   	pop    %esi
+  800b9d:	5f                   	pop    %edi
+  800b9e:	5d                   	pop    %ebp
+  800b9f:	c3                   	ret
+
+00800ba0 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  800ba0:	55                   	push   %ebp
+  800ba1:	89 e5                	mov    %esp,%ebp
+  800ba3:	57                   	push   %edi
+  800ba4:	56                   	push   %esi
+  800ba5:	53                   	push   %ebx
+  800ba6:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800ba9:	be 00 00 00 00       	mov    $0x0,%esi
+  800bae:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bb1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bb4:	b8 04 00 00 00       	mov    $0x4,%eax
+  800bb9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bbc:	89 f7                	mov    %esi,%edi
+  800bbe:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800bc0:	85 c0                	test   %eax,%eax
+  800bc2:	7f 08                	jg     800bcc <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800bc4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bc7:	5b                   	pop    %ebx
+  800bc8:	5e                   	pop    %esi
+  800bc9:	5f                   	pop    %edi
+  800bca:	5d                   	pop    %ebp
+  800bcb:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800bcc:	83 ec 0c             	sub    $0xc,%esp
+  800bcf:	50                   	push   %eax
+  800bd0:	6a 04                	push   $0x4
+  800bd2:	68 c3 2c 80 00       	push   $0x802cc3
+  800bd7:	6a 3e                	push   $0x3e
+  800bd9:	68 e0 2c 80 00       	push   $0x802ce0
+  800bde:	e8 bf 17 00 00       	call   8023a2 <_panic>
+
+00800be3 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  800be3:	55                   	push   %ebp
+  800be4:	89 e5                	mov    %esp,%ebp
+  800be6:	57                   	push   %edi
+  800be7:	56                   	push   %esi
+  800be8:	53                   	push   %ebx
+  800be9:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800bec:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bf2:	b8 05 00 00 00       	mov    $0x5,%eax
+  800bf7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bfa:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800bfd:	8b 75 18             	mov    0x18(%ebp),%esi
+  800c00:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c02:	85 c0                	test   %eax,%eax
+  800c04:	7f 08                	jg     800c0e <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800c06:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c09:	5b                   	pop    %ebx
+  800c0a:	5e                   	pop    %esi
+  800c0b:	5f                   	pop    %edi
+  800c0c:	5d                   	pop    %ebp
+  800c0d:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c0e:	83 ec 0c             	sub    $0xc,%esp
+  800c11:	50                   	push   %eax
+  800c12:	6a 05                	push   $0x5
+  800c14:	68 c3 2c 80 00       	push   $0x802cc3
+  800c19:	6a 3e                	push   $0x3e
+  800c1b:	68 e0 2c 80 00       	push   $0x802ce0
+  800c20:	e8 7d 17 00 00       	call   8023a2 <_panic>
+
+00800c25 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  800c25:	55                   	push   %ebp
+  800c26:	89 e5                	mov    %esp,%ebp
+  800c28:	57                   	push   %edi
+  800c29:	56                   	push   %esi
+  800c2a:	53                   	push   %ebx
+  800c2b:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c2e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c33:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c36:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c39:	b8 06 00 00 00       	mov    $0x6,%eax
+  800c3e:	89 df                	mov    %ebx,%edi
+  800c40:	89 de                	mov    %ebx,%esi
+  800c42:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c44:	85 c0                	test   %eax,%eax
+  800c46:	7f 08                	jg     800c50 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800c48:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c4b:	5b                   	pop    %ebx
+  800c4c:	5e                   	pop    %esi
+  800c4d:	5f                   	pop    %edi
+  800c4e:	5d                   	pop    %ebp
+  800c4f:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c50:	83 ec 0c             	sub    $0xc,%esp
+  800c53:	50                   	push   %eax
+  800c54:	6a 06                	push   $0x6
+  800c56:	68 c3 2c 80 00       	push   $0x802cc3
+  800c5b:	6a 3e                	push   $0x3e
+  800c5d:	68 e0 2c 80 00       	push   $0x802ce0
+  800c62:	e8 3b 17 00 00       	call   8023a2 <_panic>
+
+00800c67 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800c67:	55                   	push   %ebp
+  800c68:	89 e5                	mov    %esp,%ebp
+  800c6a:	57                   	push   %edi
+  800c6b:	56                   	push   %esi
+  800c6c:	53                   	push   %ebx
+  800c6d:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c70:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c75:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c78:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c7b:	b8 08 00 00 00       	mov    $0x8,%eax
+  800c80:	89 df                	mov    %ebx,%edi
+  800c82:	89 de                	mov    %ebx,%esi
+  800c84:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c86:	85 c0                	test   %eax,%eax
+  800c88:	7f 08                	jg     800c92 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800c8a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c8d:	5b                   	pop    %ebx
+  800c8e:	5e                   	pop    %esi
+  800c8f:	5f                   	pop    %edi
+  800c90:	5d                   	pop    %ebp
+  800c91:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c92:	83 ec 0c             	sub    $0xc,%esp
+  800c95:	50                   	push   %eax
+  800c96:	6a 08                	push   $0x8
+  800c98:	68 c3 2c 80 00       	push   $0x802cc3
+  800c9d:	6a 3e                	push   $0x3e
+  800c9f:	68 e0 2c 80 00       	push   $0x802ce0
+  800ca4:	e8 f9 16 00 00       	call   8023a2 <_panic>
+
+00800ca9 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800ca9:	55                   	push   %ebp
+  800caa:	89 e5                	mov    %esp,%ebp
+  800cac:	57                   	push   %edi
+  800cad:	56                   	push   %esi
+  800cae:	53                   	push   %ebx
+  800caf:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800cb2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cb7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cbd:	b8 09 00 00 00       	mov    $0x9,%eax
+  800cc2:	89 df                	mov    %ebx,%edi
+  800cc4:	89 de                	mov    %ebx,%esi
+  800cc6:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800cc8:	85 c0                	test   %eax,%eax
+  800cca:	7f 08                	jg     800cd4 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800ccc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ccf:	5b                   	pop    %ebx
+  800cd0:	5e                   	pop    %esi
+  800cd1:	5f                   	pop    %edi
+  800cd2:	5d                   	pop    %ebp
+  800cd3:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800cd4:	83 ec 0c             	sub    $0xc,%esp
+  800cd7:	50                   	push   %eax
+  800cd8:	6a 09                	push   $0x9
+  800cda:	68 c3 2c 80 00       	push   $0x802cc3
+  800cdf:	6a 3e                	push   $0x3e
+  800ce1:	68 e0 2c 80 00       	push   $0x802ce0
+  800ce6:	e8 b7 16 00 00       	call   8023a2 <_panic>
+
+00800ceb <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800ceb:	55                   	push   %ebp
+  800cec:	89 e5                	mov    %esp,%ebp
+  800cee:	57                   	push   %edi
+  800cef:	56                   	push   %esi
+  800cf0:	53                   	push   %ebx
+  800cf1:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800cf4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cf9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cfc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cff:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d04:	89 df                	mov    %ebx,%edi
+  800d06:	89 de                	mov    %ebx,%esi
+  800d08:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d0a:	85 c0                	test   %eax,%eax
+  800d0c:	7f 08                	jg     800d16 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800d0e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d11:	5b                   	pop    %ebx
+  800d12:	5e                   	pop    %esi
+  800d13:	5f                   	pop    %edi
+  800d14:	5d                   	pop    %ebp
+  800d15:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d16:	83 ec 0c             	sub    $0xc,%esp
+  800d19:	50                   	push   %eax
+  800d1a:	6a 0a                	push   $0xa
+  800d1c:	68 c3 2c 80 00       	push   $0x802cc3
+  800d21:	6a 3e                	push   $0x3e
+  800d23:	68 e0 2c 80 00       	push   $0x802ce0
+  800d28:	e8 75 16 00 00       	call   8023a2 <_panic>
+
+00800d2d <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  800d2d:	55                   	push   %ebp
+  800d2e:	89 e5                	mov    %esp,%ebp
+  800d30:	57                   	push   %edi
+  800d31:	56                   	push   %esi
+  800d32:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d33:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d36:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d39:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800d3e:	be 00 00 00 00       	mov    $0x0,%esi
+  800d43:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d46:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d49:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800d4b:	5b                   	pop    %ebx
+  800d4c:	5e                   	pop    %esi
+  800d4d:	5f                   	pop    %edi
+  800d4e:	5d                   	pop    %ebp
+  800d4f:	c3                   	ret
+
+00800d50 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  800d50:	55                   	push   %ebp
+  800d51:	89 e5                	mov    %esp,%ebp
+  800d53:	57                   	push   %edi
+  800d54:	56                   	push   %esi
+  800d55:	53                   	push   %ebx
+  800d56:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800d59:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d5e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d61:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800d66:	89 cb                	mov    %ecx,%ebx
+  800d68:	89 cf                	mov    %ecx,%edi
+  800d6a:	89 ce                	mov    %ecx,%esi
+  800d6c:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d6e:	85 c0                	test   %eax,%eax
+  800d70:	7f 08                	jg     800d7a <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  800d72:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d75:	5b                   	pop    %ebx
+  800d76:	5e                   	pop    %esi
+  800d77:	5f                   	pop    %edi
+  800d78:	5d                   	pop    %ebp
+  800d79:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d7a:	83 ec 0c             	sub    $0xc,%esp
+  800d7d:	50                   	push   %eax
+  800d7e:	6a 0d                	push   $0xd
+  800d80:	68 c3 2c 80 00       	push   $0x802cc3
+  800d85:	6a 3e                	push   $0x3e
+  800d87:	68 e0 2c 80 00       	push   $0x802ce0
+  800d8c:	e8 11 16 00 00       	call   8023a2 <_panic>
+
+00800d91 <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  800d91:	55                   	push   %ebp
+  800d92:	89 e5                	mov    %esp,%ebp
+  800d94:	57                   	push   %edi
+  800d95:	56                   	push   %esi
+  800d96:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d97:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d9c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d9f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800da2:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800da7:	89 df                	mov    %ebx,%edi
+  800da9:	89 de                	mov    %ebx,%esi
+  800dab:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  800dad:	5b                   	pop    %ebx
+  800dae:	5e                   	pop    %esi
+  800daf:	5f                   	pop    %edi
+  800db0:	5d                   	pop    %ebp
+  800db1:	c3                   	ret
+
+00800db2 <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  800db2:	55                   	push   %ebp
+  800db3:	89 e5                	mov    %esp,%ebp
+  800db5:	57                   	push   %edi
+  800db6:	56                   	push   %esi
+  800db7:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800db8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dbd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc0:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800dc5:	89 cb                	mov    %ecx,%ebx
+  800dc7:	89 cf                	mov    %ecx,%edi
+  800dc9:	89 ce                	mov    %ecx,%esi
+  800dcb:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  800dcd:	5b                   	pop    %ebx
+  800dce:	5e                   	pop    %esi
+  800dcf:	5f                   	pop    %edi
+  800dd0:	5d                   	pop    %ebp
+  800dd1:	c3                   	ret
+
+00800dd2 <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  800dd2:	55                   	push   %ebp
+  800dd3:	89 e5                	mov    %esp,%ebp
+  800dd5:	57                   	push   %edi
+  800dd6:	56                   	push   %esi
+  800dd7:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800dd8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ddd:	b8 10 00 00 00       	mov    $0x10,%eax
+  800de2:	89 d1                	mov    %edx,%ecx
+  800de4:	89 d3                	mov    %edx,%ebx
+  800de6:	89 d7                	mov    %edx,%edi
+  800de8:	89 d6                	mov    %edx,%esi
+  800dea:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800dec:	5b                   	pop    %ebx
+  800ded:	5e                   	pop    %esi
+  800dee:	5f                   	pop    %edi
+  800def:	5d                   	pop    %ebp
+  800df0:	c3                   	ret
+
+00800df1 <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  800df1:	55                   	push   %ebp
+  800df2:	89 e5                	mov    %esp,%ebp
+  800df4:	57                   	push   %edi
+  800df5:	56                   	push   %esi
+  800df6:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800df7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dfc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e02:	b8 11 00 00 00       	mov    $0x11,%eax
+  800e07:	89 df                	mov    %ebx,%edi
+  800e09:	89 de                	mov    %ebx,%esi
+  800e0b:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800e0d:	5b                   	pop    %ebx
+  800e0e:	5e                   	pop    %esi
+  800e0f:	5f                   	pop    %edi
+  800e10:	5d                   	pop    %ebp
+  800e11:	c3                   	ret
+
+00800e12 <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  800e12:	55                   	push   %ebp
+  800e13:	89 e5                	mov    %esp,%ebp
+  800e15:	57                   	push   %edi
+  800e16:	56                   	push   %esi
+  800e17:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e18:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e1d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e20:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e23:	b8 12 00 00 00       	mov    $0x12,%eax
+  800e28:	89 df                	mov    %ebx,%edi
+  800e2a:	89 de                	mov    %ebx,%esi
+  800e2c:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800e2e:	5b                   	pop    %ebx
+  800e2f:	5e                   	pop    %esi
+  800e30:	5f                   	pop    %edi
+  800e31:	5d                   	pop    %ebp
+  800e32:	c3                   	ret
+
+00800e33 <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  800e33:	55                   	push   %ebp
+  800e34:	89 e5                	mov    %esp,%ebp
+  800e36:	57                   	push   %edi
+  800e37:	56                   	push   %esi
+  800e38:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e39:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e3e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e41:	b8 13 00 00 00       	mov    $0x13,%eax
+  800e46:	89 cb                	mov    %ecx,%ebx
+  800e48:	89 cf                	mov    %ecx,%edi
+  800e4a:	89 ce                	mov    %ecx,%esi
+  800e4c:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  800e4e:	5b                   	pop    %ebx
+  800e4f:	5e                   	pop    %esi
+  800e50:	5f                   	pop    %edi
+  800e51:	5d                   	pop    %ebp
+  800e52:	c3                   	ret
+
+00800e53 <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  800e53:	55                   	push   %ebp
+  800e54:	89 e5                	mov    %esp,%ebp
+  800e56:	57                   	push   %edi
+  800e57:	56                   	push   %esi
+  800e58:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e59:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e5e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e61:	b8 14 00 00 00       	mov    $0x14,%eax
+  800e66:	89 cb                	mov    %ecx,%ebx
+  800e68:	89 cf                	mov    %ecx,%edi
+  800e6a:	89 ce                	mov    %ecx,%esi
+  800e6c:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  800e6e:	5b                   	pop    %ebx
+  800e6f:	5e                   	pop    %esi
+  800e70:	5f                   	pop    %edi
+  800e71:	5d                   	pop    %ebp
+  800e72:	c3                   	ret
+
+00800e73 <pgfault>:
+//
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf) {
+  800e73:	55                   	push   %ebp
+  800e74:	89 e5                	mov    %esp,%ebp
+  800e76:	53                   	push   %ebx
+  800e77:	83 ec 04             	sub    $0x4,%esp
+  800e7a:	8b 45 08             	mov    0x8(%ebp),%eax
+    void *addr = (void *) utf->utf_fault_va;
+  800e7d:	8b 18                	mov    (%eax),%ebx
+    // Hint:
+    //   Use the read-only page table mappings at uvpt
+    //   (see <inc/memlayout.h>).
+
+    // LAB 4: Your code here.
+    if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P) ||
+  800e7f:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  800e83:	0f 84 95 00 00 00    	je     800f1e <pgfault+0xab>
+  800e89:	89 d8                	mov    %ebx,%eax
+  800e8b:	c1 e8 16             	shr    $0x16,%eax
+  800e8e:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  800e95:	a8 01                	test   $0x1,%al
+  800e97:	0f 84 81 00 00 00    	je     800f1e <pgfault+0xab>
+        (uvpt[PGNUM(addr)] & (PTE_P | PTE_COW)) != (PTE_P | PTE_COW)) {
+  800e9d:	89 d8                	mov    %ebx,%eax
+  800e9f:	c1 e8 0c             	shr    $0xc,%eax
+  800ea2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800ea9:	25 01 08 00 00       	and    $0x801,%eax
+    if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P) ||
+  800eae:	3d 01 08 00 00       	cmp    $0x801,%eax
+  800eb3:	75 69                	jne    800f1e <pgfault+0xab>
+    // Hint:
+    //   You should make three system calls.
+
+    // LAB 4: Your code here.
+
+    if (sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W))
+  800eb5:	83 ec 04             	sub    $0x4,%esp
+  800eb8:	6a 07                	push   $0x7
+  800eba:	68 00 f0 7f 00       	push   $0x7ff000
+  800ebf:	6a 00                	push   $0x0
+  800ec1:	e8 da fc ff ff       	call   800ba0 <sys_page_alloc>
+  800ec6:	83 c4 10             	add    $0x10,%esp
+  800ec9:	85 c0                	test   %eax,%eax
+  800ecb:	75 65                	jne    800f32 <pgfault+0xbf>
+        panic("sys_page_alloc failed");
+
+    addr = ROUNDDOWN(addr, PGSIZE);
+  800ecd:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+    memmove(PFTEMP, addr, PGSIZE);
+  800ed3:	83 ec 04             	sub    $0x4,%esp
+  800ed6:	68 00 10 00 00       	push   $0x1000
+  800edb:	53                   	push   %ebx
+  800edc:	68 00 f0 7f 00       	push   $0x7ff000
+  800ee1:	e8 54 fa ff ff       	call   80093a <memmove>
+
+    if (sys_page_map(0, PFTEMP, 0, addr, PTE_P | PTE_U | PTE_W))
+  800ee6:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  800eed:	53                   	push   %ebx
+  800eee:	6a 00                	push   $0x0
+  800ef0:	68 00 f0 7f 00       	push   $0x7ff000
+  800ef5:	6a 00                	push   $0x0
+  800ef7:	e8 e7 fc ff ff       	call   800be3 <sys_page_map>
+  800efc:	83 c4 20             	add    $0x20,%esp
+  800eff:	85 c0                	test   %eax,%eax
+  800f01:	75 43                	jne    800f46 <pgfault+0xd3>
+        panic("sys_page_map failed");
+    if (sys_page_unmap(0, PFTEMP))
+  800f03:	83 ec 08             	sub    $0x8,%esp
+  800f06:	68 00 f0 7f 00       	push   $0x7ff000
+  800f0b:	6a 00                	push   $0x0
+  800f0d:	e8 13 fd ff ff       	call   800c25 <sys_page_unmap>
+  800f12:	83 c4 10             	add    $0x10,%esp
+  800f15:	85 c0                	test   %eax,%eax
+  800f17:	75 41                	jne    800f5a <pgfault+0xe7>
+        panic("sys_page_unmap failed");
+
+}
+  800f19:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f1c:	c9                   	leave
+  800f1d:	c3                   	ret
+        panic("pgfault: faulting access invalid");
+  800f1e:	83 ec 04             	sub    $0x4,%esp
+  800f21:	68 f0 2c 80 00       	push   $0x802cf0
+  800f26:	6a 1e                	push   $0x1e
+  800f28:	68 5c 2d 80 00       	push   $0x802d5c
+  800f2d:	e8 70 14 00 00       	call   8023a2 <_panic>
+        panic("sys_page_alloc failed");
+  800f32:	83 ec 04             	sub    $0x4,%esp
+  800f35:	68 cf 2d 80 00       	push   $0x802dcf
+  800f3a:	6a 2a                	push   $0x2a
+  800f3c:	68 5c 2d 80 00       	push   $0x802d5c
+  800f41:	e8 5c 14 00 00       	call   8023a2 <_panic>
+        panic("sys_page_map failed");
+  800f46:	83 ec 04             	sub    $0x4,%esp
+  800f49:	68 67 2d 80 00       	push   $0x802d67
+  800f4e:	6a 30                	push   $0x30
+  800f50:	68 5c 2d 80 00       	push   $0x802d5c
+  800f55:	e8 48 14 00 00       	call   8023a2 <_panic>
+        panic("sys_page_unmap failed");
+  800f5a:	83 ec 04             	sub    $0x4,%esp
+  800f5d:	68 7b 2d 80 00       	push   $0x802d7b
+  800f62:	6a 32                	push   $0x32
+  800f64:	68 5c 2d 80 00       	push   $0x802d5c
+  800f69:	e8 34 14 00 00       	call   8023a2 <_panic>
+
+00800f6e <fork>:
+//   Remember to fix "thisenv" in the child process.
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void) {
+  800f6e:	55                   	push   %ebp
+  800f6f:	89 e5                	mov    %esp,%ebp
+  800f71:	57                   	push   %edi
+  800f72:	56                   	push   %esi
+  800f73:	53                   	push   %ebx
+  800f74:	83 ec 18             	sub    $0x18,%esp
+    // LAB 4: Your code here.
+    set_pgfault_handler(pgfault);
+  800f77:	68 73 0e 80 00       	push   $0x800e73
+  800f7c:	e8 67 14 00 00       	call   8023e8 <set_pgfault_handler>
+
+// This must be inlined.  Exercise for reader: why?
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+  envid_t ret;
+  asm volatile("int %2"
+  800f81:	b8 07 00 00 00       	mov    $0x7,%eax
+  800f86:	cd 30                	int    $0x30
+  800f88:	89 c6                	mov    %eax,%esi
+
+    envid_t envid = sys_exofork();
+    if (envid < 0)
+  800f8a:	83 c4 10             	add    $0x10,%esp
+  800f8d:	85 c0                	test   %eax,%eax
+  800f8f:	78 2a                	js     800fbb <fork+0x4d>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+
+    uintptr_t addr;
+    for (addr = 0; addr < UTOP; addr += PGSIZE) {
+  800f91:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (envid == 0) {
+  800f96:	0f 85 a2 00 00 00    	jne    80103e <fork+0xd0>
+        thisenv = &envs[ENVX(sys_getenvid())];
+  800f9c:	e8 c1 fb ff ff       	call   800b62 <sys_getenvid>
+  800fa1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800fa6:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800fa9:	c1 e0 04             	shl    $0x4,%eax
+  800fac:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800fb1:	a3 0c 40 80 00       	mov    %eax,0x80400c
+        return 0;
+  800fb6:	e9 6c 01 00 00       	jmp    801127 <fork+0x1b9>
+        panic("fork: sys_exofork error: %e", envid);
+  800fbb:	50                   	push   %eax
+  800fbc:	68 91 2d 80 00       	push   $0x802d91
+  800fc1:	6a 6f                	push   $0x6f
+  800fc3:	68 5c 2d 80 00       	push   $0x802d5c
+  800fc8:	e8 d5 13 00 00       	call   8023a2 <_panic>
+        if ((r = sys_page_map(0, vptr, envid, vptr, uvpt[pn] & PTE_SYSCALL)) < 0)
+  800fcd:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800fd4:	83 ec 0c             	sub    $0xc,%esp
+  800fd7:	25 07 0e 00 00       	and    $0xe07,%eax
+  800fdc:	50                   	push   %eax
+  800fdd:	57                   	push   %edi
+  800fde:	56                   	push   %esi
+  800fdf:	57                   	push   %edi
+  800fe0:	6a 00                	push   $0x0
+  800fe2:	e8 fc fb ff ff       	call   800be3 <sys_page_map>
+  800fe7:	83 c4 20             	add    $0x20,%esp
+  800fea:	85 c0                	test   %eax,%eax
+  800fec:	79 3e                	jns    80102c <fork+0xbe>
+            panic("duppage :in sys_page_map %e", r);
+  800fee:	50                   	push   %eax
+  800fef:	68 ad 2d 80 00       	push   $0x802dad
+  800ff4:	6a 49                	push   $0x49
+  800ff6:	68 5c 2d 80 00       	push   $0x802d5c
+  800ffb:	e8 a2 13 00 00       	call   8023a2 <_panic>
+            panic("duppage :in sys_page_map %e", r);
+  801000:	50                   	push   %eax
+  801001:	68 ad 2d 80 00       	push   $0x802dad
+  801006:	6a 4e                	push   $0x4e
+  801008:	68 5c 2d 80 00       	push   $0x802d5c
+  80100d:	e8 90 13 00 00       	call   8023a2 <_panic>
+    } else if ((r = sys_page_map(0, vptr, envid, vptr, PTE_P | PTE_U)) < 0)
+  801012:	83 ec 0c             	sub    $0xc,%esp
+  801015:	6a 05                	push   $0x5
+  801017:	57                   	push   %edi
+  801018:	56                   	push   %esi
+  801019:	57                   	push   %edi
+  80101a:	6a 00                	push   $0x0
+  80101c:	e8 c2 fb ff ff       	call   800be3 <sys_page_map>
+  801021:	83 c4 20             	add    $0x20,%esp
+  801024:	85 c0                	test   %eax,%eax
+  801026:	0f 88 ab 00 00 00    	js     8010d7 <fork+0x169>
+    for (addr = 0; addr < UTOP; addr += PGSIZE) {
+  80102c:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801032:	81 fb 00 00 c0 ee    	cmp    $0xeec00000,%ebx
+  801038:	0f 84 ab 00 00 00    	je     8010e9 <fork+0x17b>
+        if (uvpd[PDX(addr)] & PTE_P && uvpt[PGNUM(addr)] & PTE_P && addr != UXSTACKTOP - PGSIZE) {
+  80103e:	89 d8                	mov    %ebx,%eax
+  801040:	c1 e8 16             	shr    $0x16,%eax
+  801043:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80104a:	a8 01                	test   $0x1,%al
+  80104c:	74 de                	je     80102c <fork+0xbe>
+  80104e:	89 d8                	mov    %ebx,%eax
+  801050:	c1 e8 0c             	shr    $0xc,%eax
+  801053:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80105a:	f6 c2 01             	test   $0x1,%dl
+  80105d:	74 cd                	je     80102c <fork+0xbe>
+  80105f:	81 fb 00 f0 bf ee    	cmp    $0xeebff000,%ebx
+  801065:	74 c5                	je     80102c <fork+0xbe>
+    void *vptr = (void *) (pn * PGSIZE);
+  801067:	89 c7                	mov    %eax,%edi
+  801069:	c1 e7 0c             	shl    $0xc,%edi
+    if (uvpt[pn] & PTE_SHARE) {
+  80106c:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801073:	f6 c6 04             	test   $0x4,%dh
+  801076:	0f 85 51 ff ff ff    	jne    800fcd <fork+0x5f>
+    } else if (uvpt[pn] & (PTE_W | PTE_COW)) {
+  80107c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801083:	a9 02 08 00 00       	test   $0x802,%eax
+  801088:	74 88                	je     801012 <fork+0xa4>
+        if ((r = sys_page_map(0, vptr, envid, vptr, PTE_P | PTE_U | PTE_COW)) < 0)
+  80108a:	83 ec 0c             	sub    $0xc,%esp
+  80108d:	68 05 08 00 00       	push   $0x805
+  801092:	57                   	push   %edi
+  801093:	56                   	push   %esi
+  801094:	57                   	push   %edi
+  801095:	6a 00                	push   $0x0
+  801097:	e8 47 fb ff ff       	call   800be3 <sys_page_map>
+  80109c:	83 c4 20             	add    $0x20,%esp
+  80109f:	85 c0                	test   %eax,%eax
+  8010a1:	0f 88 59 ff ff ff    	js     801000 <fork+0x92>
+        if ((r = sys_page_map(0, vptr, 0, vptr, PTE_P | PTE_U | PTE_COW)) < 0)
+  8010a7:	83 ec 0c             	sub    $0xc,%esp
+  8010aa:	68 05 08 00 00       	push   $0x805
+  8010af:	57                   	push   %edi
+  8010b0:	6a 00                	push   $0x0
+  8010b2:	57                   	push   %edi
+  8010b3:	6a 00                	push   $0x0
+  8010b5:	e8 29 fb ff ff       	call   800be3 <sys_page_map>
+  8010ba:	83 c4 20             	add    $0x20,%esp
+  8010bd:	85 c0                	test   %eax,%eax
+  8010bf:	0f 89 67 ff ff ff    	jns    80102c <fork+0xbe>
+            panic("duppage :in sys_page_map %e", r);
+  8010c5:	50                   	push   %eax
+  8010c6:	68 ad 2d 80 00       	push   $0x802dad
+  8010cb:	6a 50                	push   $0x50
+  8010cd:	68 5c 2d 80 00       	push   $0x802d5c
+  8010d2:	e8 cb 12 00 00       	call   8023a2 <_panic>
+        panic("duppage :in sys_page_map %e", r);
+  8010d7:	50                   	push   %eax
+  8010d8:	68 ad 2d 80 00       	push   $0x802dad
+  8010dd:	6a 53                	push   $0x53
+  8010df:	68 5c 2d 80 00       	push   $0x802d5c
+  8010e4:	e8 b9 12 00 00       	call   8023a2 <_panic>
+            duppage(envid, PGNUM(addr));
+        }
+    }
+    if (sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W))
+  8010e9:	83 ec 04             	sub    $0x4,%esp
+  8010ec:	6a 07                	push   $0x7
+  8010ee:	68 00 f0 bf ee       	push   $0xeebff000
+  8010f3:	56                   	push   %esi
+  8010f4:	e8 a7 fa ff ff       	call   800ba0 <sys_page_alloc>
+  8010f9:	83 c4 10             	add    $0x10,%esp
+  8010fc:	85 c0                	test   %eax,%eax
+  8010fe:	75 31                	jne    801131 <fork+0x1c3>
+        panic("fork: sys_page_alloc failed");
+    if (sys_env_set_pgfault_upcall(envid, _pgfault_upcall))
+  801100:	83 ec 08             	sub    $0x8,%esp
+  801103:	68 53 24 80 00       	push   $0x802453
+  801108:	56                   	push   %esi
+  801109:	e8 dd fb ff ff       	call   800ceb <sys_env_set_pgfault_upcall>
+  80110e:	83 c4 10             	add    $0x10,%esp
+  801111:	85 c0                	test   %eax,%eax
+  801113:	75 30                	jne    801145 <fork+0x1d7>
+        panic("fork: sys_env_set_pgfault_upcall failed");
+    if (sys_env_set_status(envid, ENV_RUNNABLE))
+  801115:	83 ec 08             	sub    $0x8,%esp
+  801118:	6a 02                	push   $0x2
+  80111a:	56                   	push   %esi
+  80111b:	e8 47 fb ff ff       	call   800c67 <sys_env_set_status>
+  801120:	83 c4 10             	add    $0x10,%esp
+  801123:	85 c0                	test   %eax,%eax
+  801125:	75 32                	jne    801159 <fork+0x1eb>
+        panic("fork: sys_env_set_status failed");
+
+    return envid;
+
+}
+  801127:	89 f0                	mov    %esi,%eax
+  801129:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80112c:	5b                   	pop    %ebx
+  80112d:	5e                   	pop    %esi
+  80112e:	5f                   	pop    %edi
+  80112f:	5d                   	pop    %ebp
+  801130:	c3                   	ret
+        panic("fork: sys_page_alloc failed");
+  801131:	83 ec 04             	sub    $0x4,%esp
+  801134:	68 c9 2d 80 00       	push   $0x802dc9
+  801139:	6a 7d                	push   $0x7d
+  80113b:	68 5c 2d 80 00       	push   $0x802d5c
+  801140:	e8 5d 12 00 00       	call   8023a2 <_panic>
+        panic("fork: sys_env_set_pgfault_upcall failed");
+  801145:	83 ec 04             	sub    $0x4,%esp
+  801148:	68 14 2d 80 00       	push   $0x802d14
+  80114d:	6a 7f                	push   $0x7f
+  80114f:	68 5c 2d 80 00       	push   $0x802d5c
+  801154:	e8 49 12 00 00       	call   8023a2 <_panic>
+        panic("fork: sys_env_set_status failed");
+  801159:	83 ec 04             	sub    $0x4,%esp
+  80115c:	68 3c 2d 80 00       	push   $0x802d3c
+  801161:	68 81 00 00 00       	push   $0x81
+  801166:	68 5c 2d 80 00       	push   $0x802d5c
+  80116b:	e8 32 12 00 00       	call   8023a2 <_panic>
+
+00801170 <sfork>:
+
+// Challenge!
+int
+sfork(void) {
+  801170:	55                   	push   %ebp
+  801171:	89 e5                	mov    %esp,%ebp
+  801173:	83 ec 0c             	sub    $0xc,%esp
+    panic("sfork not implemented");
+  801176:	68 e5 2d 80 00       	push   $0x802de5
+  80117b:	68 8a 00 00 00       	push   $0x8a
+  801180:	68 5c 2d 80 00       	push   $0x802d5c
+  801185:	e8 18 12 00 00       	call   8023a2 <_panic>
+
+0080118a <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  80118a:	55                   	push   %ebp
+  80118b:	89 e5                	mov    %esp,%ebp
+  80118d:	56                   	push   %esi
+  80118e:	53                   	push   %ebx
+  80118f:	8b 75 08             	mov    0x8(%ebp),%esi
+  801192:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801195:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  801198:	85 c0                	test   %eax,%eax
+  80119a:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80119f:	0f 44 c2             	cmove  %edx,%eax
+  8011a2:	83 ec 0c             	sub    $0xc,%esp
+  8011a5:	50                   	push   %eax
+  8011a6:	e8 a5 fb ff ff       	call   800d50 <sys_ipc_recv>
+
+  if (from_env_store)
+  8011ab:	83 c4 10             	add    $0x10,%esp
+  8011ae:	85 f6                	test   %esi,%esi
+  8011b0:	74 17                	je     8011c9 <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  8011b2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011b7:	85 c0                	test   %eax,%eax
+  8011b9:	75 0c                	jne    8011c7 <ipc_recv+0x3d>
+  8011bb:	8b 15 0c 40 80 00    	mov    0x80400c,%edx
+  8011c1:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  8011c7:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  8011c9:	85 db                	test   %ebx,%ebx
+  8011cb:	74 2b                	je     8011f8 <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  8011cd:	85 c0                	test   %eax,%eax
+  8011cf:	74 0d                	je     8011de <ipc_recv+0x54>
+  8011d1:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  8011d7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8011da:	5b                   	pop    %ebx
+  8011db:	5e                   	pop    %esi
+  8011dc:	5d                   	pop    %ebp
+  8011dd:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  8011de:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  8011e3:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8011e9:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  8011eb:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  8011f0:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  8011f6:	eb df                	jmp    8011d7 <ipc_recv+0x4d>
+  8011f8:	85 c0                	test   %eax,%eax
+  8011fa:	75 db                	jne    8011d7 <ipc_recv+0x4d>
+  8011fc:	eb ed                	jmp    8011eb <ipc_recv+0x61>
+
+008011fe <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  8011fe:	55                   	push   %ebp
+  8011ff:	89 e5                	mov    %esp,%ebp
+  801201:	57                   	push   %edi
+  801202:	56                   	push   %esi
+  801203:	53                   	push   %ebx
+  801204:	83 ec 0c             	sub    $0xc,%esp
+  801207:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80120a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80120d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  801210:	85 db                	test   %ebx,%ebx
+  801212:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801217:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  80121a:	ff 75 14             	push   0x14(%ebp)
+  80121d:	53                   	push   %ebx
+  80121e:	56                   	push   %esi
+  80121f:	57                   	push   %edi
+  801220:	e8 08 fb ff ff       	call   800d2d <sys_ipc_try_send>
+  801225:	83 c4 10             	add    $0x10,%esp
+  801228:	85 c0                	test   %eax,%eax
+  80122a:	74 1e                	je     80124a <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  80122c:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80122f:	75 07                	jne    801238 <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  801231:	e8 4b f9 ff ff       	call   800b81 <sys_yield>
+  801236:	eb e2                	jmp    80121a <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  801238:	50                   	push   %eax
+  801239:	68 fb 2d 80 00       	push   $0x802dfb
+  80123e:	6a 3c                	push   $0x3c
+  801240:	68 08 2e 80 00       	push   $0x802e08
+  801245:	e8 58 11 00 00       	call   8023a2 <_panic>
+  }
+
+#endif
+}
+  80124a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80124d:	5b                   	pop    %ebx
+  80124e:	5e                   	pop    %esi
+  80124f:	5f                   	pop    %edi
+  801250:	5d                   	pop    %ebp
+  801251:	c3                   	ret
+
+00801252 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  801252:	55                   	push   %ebp
+  801253:	89 e5                	mov    %esp,%ebp
+  801255:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  801258:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  80125d:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  801260:	c1 e0 04             	shl    $0x4,%eax
+  801263:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801268:	8b 40 50             	mov    0x50(%eax),%eax
+  80126b:	39 c8                	cmp    %ecx,%eax
+  80126d:	74 12                	je     801281 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  80126f:	83 c2 01             	add    $0x1,%edx
+  801272:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  801278:	75 e3                	jne    80125d <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  80127a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80127f:	eb 0e                	jmp    80128f <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  801281:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  801284:	c1 e0 04             	shl    $0x4,%eax
+  801287:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80128c:	8b 40 48             	mov    0x48(%eax),%eax
+  80128f:	5d                   	pop    %ebp
+  801290:	c3                   	ret
+
+00801291 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801291:	55                   	push   %ebp
+  801292:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801294:	8b 45 08             	mov    0x8(%ebp),%eax
+  801297:	05 00 00 00 30       	add    $0x30000000,%eax
+  80129c:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80129f:	5d                   	pop    %ebp
+  8012a0:	c3                   	ret
+
+008012a1 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8012a1:	55                   	push   %ebp
+  8012a2:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8012a4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8012a7:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8012ac:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8012b1:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8012b6:	5d                   	pop    %ebp
+  8012b7:	c3                   	ret
+
+008012b8 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8012b8:	55                   	push   %ebp
+  8012b9:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8012bb:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8012c0:	eb 02                	jmp    8012c4 <fd_alloc+0xc>
+  8012c2:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8012c4:	89 c2                	mov    %eax,%edx
+  8012c6:	c1 ea 16             	shr    $0x16,%edx
+  8012c9:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8012d0:	f6 c2 01             	test   $0x1,%dl
+  8012d3:	74 2b                	je     801300 <fd_alloc+0x48>
+  8012d5:	89 c2                	mov    %eax,%edx
+  8012d7:	c1 ea 0c             	shr    $0xc,%edx
+  8012da:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8012e1:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8012e7:	f6 c1 01             	test   $0x1,%cl
+  8012ea:	74 14                	je     801300 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8012ec:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8012f2:	75 ce                	jne    8012c2 <fd_alloc+0xa>
+  8012f4:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8012f9:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8012fe:	eb 05                	jmp    801305 <fd_alloc+0x4d>
+			return 0;
+  801300:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801305:	8b 55 08             	mov    0x8(%ebp),%edx
+  801308:	89 02                	mov    %eax,(%edx)
+}
+  80130a:	89 c8                	mov    %ecx,%eax
+  80130c:	5d                   	pop    %ebp
+  80130d:	c3                   	ret
+
+0080130e <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80130e:	55                   	push   %ebp
+  80130f:	89 e5                	mov    %esp,%ebp
+  801311:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801314:	83 f8 1f             	cmp    $0x1f,%eax
+  801317:	77 30                	ja     801349 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801319:	c1 e0 0c             	shl    $0xc,%eax
+  80131c:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801321:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801327:	f6 c2 01             	test   $0x1,%dl
+  80132a:	74 24                	je     801350 <fd_lookup+0x42>
+  80132c:	89 c2                	mov    %eax,%edx
+  80132e:	c1 ea 0c             	shr    $0xc,%edx
+  801331:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801338:	f6 c2 01             	test   $0x1,%dl
+  80133b:	74 1a                	je     801357 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80133d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801340:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801342:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801347:	5d                   	pop    %ebp
+  801348:	c3                   	ret
+		return -E_INVAL;
+  801349:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80134e:	eb f7                	jmp    801347 <fd_lookup+0x39>
+		return -E_INVAL;
+  801350:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801355:	eb f0                	jmp    801347 <fd_lookup+0x39>
+  801357:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80135c:	eb e9                	jmp    801347 <fd_lookup+0x39>
+
+0080135e <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80135e:	55                   	push   %ebp
+  80135f:	89 e5                	mov    %esp,%ebp
+  801361:	53                   	push   %ebx
+  801362:	83 ec 04             	sub    $0x4,%esp
+  801365:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801368:	b8 00 00 00 00       	mov    $0x0,%eax
+  80136d:	eb 03                	jmp    801372 <dev_lookup+0x14>
+  80136f:	83 c0 01             	add    $0x1,%eax
+  801372:	8b 1c 85 90 2e 80 00 	mov    0x802e90(,%eax,4),%ebx
+  801379:	85 db                	test   %ebx,%ebx
+  80137b:	74 0b                	je     801388 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  80137d:	39 13                	cmp    %edx,(%ebx)
+  80137f:	75 ee                	jne    80136f <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801381:	b8 00 00 00 00       	mov    $0x0,%eax
+  801386:	eb 1f                	jmp    8013a7 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801388:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  80138d:	8b 40 48             	mov    0x48(%eax),%eax
+  801390:	83 ec 04             	sub    $0x4,%esp
+  801393:	52                   	push   %edx
+  801394:	50                   	push   %eax
+  801395:	68 14 2e 80 00       	push   $0x802e14
+  80139a:	e8 5c ee ff ff       	call   8001fb <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80139f:	83 c4 10             	add    $0x10,%esp
+  8013a2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8013a7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8013aa:	89 1a                	mov    %ebx,(%edx)
+}
+  8013ac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013af:	c9                   	leave
+  8013b0:	c3                   	ret
+
+008013b1 <fd_close>:
+{
+  8013b1:	55                   	push   %ebp
+  8013b2:	89 e5                	mov    %esp,%ebp
+  8013b4:	57                   	push   %edi
+  8013b5:	56                   	push   %esi
+  8013b6:	53                   	push   %ebx
+  8013b7:	83 ec 24             	sub    $0x24,%esp
+  8013ba:	8b 75 08             	mov    0x8(%ebp),%esi
+  8013bd:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8013c0:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8013c3:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8013c4:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8013ca:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8013cd:	50                   	push   %eax
+  8013ce:	e8 3b ff ff ff       	call   80130e <fd_lookup>
+  8013d3:	89 c3                	mov    %eax,%ebx
+  8013d5:	83 c4 10             	add    $0x10,%esp
+  8013d8:	85 c0                	test   %eax,%eax
+  8013da:	78 05                	js     8013e1 <fd_close+0x30>
+	    || fd != fd2)
+  8013dc:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8013df:	74 16                	je     8013f7 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8013e1:	89 f8                	mov    %edi,%eax
+  8013e3:	84 c0                	test   %al,%al
+  8013e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013ea:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8013ed:	89 d8                	mov    %ebx,%eax
+  8013ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013f2:	5b                   	pop    %ebx
+  8013f3:	5e                   	pop    %esi
+  8013f4:	5f                   	pop    %edi
+  8013f5:	5d                   	pop    %ebp
+  8013f6:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8013f7:	83 ec 08             	sub    $0x8,%esp
+  8013fa:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8013fd:	50                   	push   %eax
+  8013fe:	ff 36                	push   (%esi)
+  801400:	e8 59 ff ff ff       	call   80135e <dev_lookup>
+  801405:	89 c3                	mov    %eax,%ebx
+  801407:	83 c4 10             	add    $0x10,%esp
+  80140a:	85 c0                	test   %eax,%eax
+  80140c:	78 1a                	js     801428 <fd_close+0x77>
+		if (dev->dev_close)
+  80140e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801411:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801414:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801419:	85 c0                	test   %eax,%eax
+  80141b:	74 0b                	je     801428 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80141d:	83 ec 0c             	sub    $0xc,%esp
+  801420:	56                   	push   %esi
+  801421:	ff d0                	call   *%eax
+  801423:	89 c3                	mov    %eax,%ebx
+  801425:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801428:	83 ec 08             	sub    $0x8,%esp
+  80142b:	56                   	push   %esi
+  80142c:	6a 00                	push   $0x0
+  80142e:	e8 f2 f7 ff ff       	call   800c25 <sys_page_unmap>
+	return r;
+  801433:	83 c4 10             	add    $0x10,%esp
+  801436:	eb b5                	jmp    8013ed <fd_close+0x3c>
+
+00801438 <close>:
+
+int
+close(int fdnum)
+{
+  801438:	55                   	push   %ebp
+  801439:	89 e5                	mov    %esp,%ebp
+  80143b:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80143e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801441:	50                   	push   %eax
+  801442:	ff 75 08             	push   0x8(%ebp)
+  801445:	e8 c4 fe ff ff       	call   80130e <fd_lookup>
+  80144a:	83 c4 10             	add    $0x10,%esp
+  80144d:	85 c0                	test   %eax,%eax
+  80144f:	79 02                	jns    801453 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801451:	c9                   	leave
+  801452:	c3                   	ret
+		return fd_close(fd, 1);
+  801453:	83 ec 08             	sub    $0x8,%esp
+  801456:	6a 01                	push   $0x1
+  801458:	ff 75 f4             	push   -0xc(%ebp)
+  80145b:	e8 51 ff ff ff       	call   8013b1 <fd_close>
+  801460:	83 c4 10             	add    $0x10,%esp
+  801463:	eb ec                	jmp    801451 <close+0x19>
+
+00801465 <close_all>:
+
+void
+close_all(void)
+{
+  801465:	55                   	push   %ebp
+  801466:	89 e5                	mov    %esp,%ebp
+  801468:	53                   	push   %ebx
+  801469:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80146c:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801471:	83 ec 0c             	sub    $0xc,%esp
+  801474:	53                   	push   %ebx
+  801475:	e8 be ff ff ff       	call   801438 <close>
+	for (i = 0; i < MAXFD; i++)
+  80147a:	83 c3 01             	add    $0x1,%ebx
+  80147d:	83 c4 10             	add    $0x10,%esp
+  801480:	83 fb 20             	cmp    $0x20,%ebx
+  801483:	75 ec                	jne    801471 <close_all+0xc>
+}
+  801485:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801488:	c9                   	leave
+  801489:	c3                   	ret
+
+0080148a <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80148a:	55                   	push   %ebp
+  80148b:	89 e5                	mov    %esp,%ebp
+  80148d:	57                   	push   %edi
+  80148e:	56                   	push   %esi
+  80148f:	53                   	push   %ebx
+  801490:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801493:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801496:	50                   	push   %eax
+  801497:	ff 75 08             	push   0x8(%ebp)
+  80149a:	e8 6f fe ff ff       	call   80130e <fd_lookup>
+  80149f:	89 c3                	mov    %eax,%ebx
+  8014a1:	83 c4 10             	add    $0x10,%esp
+  8014a4:	85 c0                	test   %eax,%eax
+  8014a6:	78 7f                	js     801527 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8014a8:	83 ec 0c             	sub    $0xc,%esp
+  8014ab:	ff 75 0c             	push   0xc(%ebp)
+  8014ae:	e8 85 ff ff ff       	call   801438 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8014b3:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8014b6:	c1 e6 0c             	shl    $0xc,%esi
+  8014b9:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8014bf:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8014c2:	89 3c 24             	mov    %edi,(%esp)
+  8014c5:	e8 d7 fd ff ff       	call   8012a1 <fd2data>
+  8014ca:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8014cc:	89 34 24             	mov    %esi,(%esp)
+  8014cf:	e8 cd fd ff ff       	call   8012a1 <fd2data>
+  8014d4:	83 c4 10             	add    $0x10,%esp
+  8014d7:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8014da:	89 d8                	mov    %ebx,%eax
+  8014dc:	c1 e8 16             	shr    $0x16,%eax
+  8014df:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8014e6:	a8 01                	test   $0x1,%al
+  8014e8:	74 11                	je     8014fb <dup+0x71>
+  8014ea:	89 d8                	mov    %ebx,%eax
+  8014ec:	c1 e8 0c             	shr    $0xc,%eax
+  8014ef:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8014f6:	f6 c2 01             	test   $0x1,%dl
+  8014f9:	75 36                	jne    801531 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8014fb:	89 f8                	mov    %edi,%eax
+  8014fd:	c1 e8 0c             	shr    $0xc,%eax
+  801500:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801507:	83 ec 0c             	sub    $0xc,%esp
+  80150a:	25 07 0e 00 00       	and    $0xe07,%eax
+  80150f:	50                   	push   %eax
+  801510:	56                   	push   %esi
+  801511:	6a 00                	push   $0x0
+  801513:	57                   	push   %edi
+  801514:	6a 00                	push   $0x0
+  801516:	e8 c8 f6 ff ff       	call   800be3 <sys_page_map>
+  80151b:	89 c3                	mov    %eax,%ebx
+  80151d:	83 c4 20             	add    $0x20,%esp
+  801520:	85 c0                	test   %eax,%eax
+  801522:	78 33                	js     801557 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801524:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801527:	89 d8                	mov    %ebx,%eax
+  801529:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80152c:	5b                   	pop    %ebx
+  80152d:	5e                   	pop    %esi
+  80152e:	5f                   	pop    %edi
+  80152f:	5d                   	pop    %ebp
+  801530:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801531:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801538:	83 ec 0c             	sub    $0xc,%esp
+  80153b:	25 07 0e 00 00       	and    $0xe07,%eax
+  801540:	50                   	push   %eax
+  801541:	ff 75 d4             	push   -0x2c(%ebp)
+  801544:	6a 00                	push   $0x0
+  801546:	53                   	push   %ebx
+  801547:	6a 00                	push   $0x0
+  801549:	e8 95 f6 ff ff       	call   800be3 <sys_page_map>
+  80154e:	89 c3                	mov    %eax,%ebx
+  801550:	83 c4 20             	add    $0x20,%esp
+  801553:	85 c0                	test   %eax,%eax
+  801555:	79 a4                	jns    8014fb <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801557:	83 ec 08             	sub    $0x8,%esp
+  80155a:	56                   	push   %esi
+  80155b:	6a 00                	push   $0x0
+  80155d:	e8 c3 f6 ff ff       	call   800c25 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801562:	83 c4 08             	add    $0x8,%esp
+  801565:	ff 75 d4             	push   -0x2c(%ebp)
+  801568:	6a 00                	push   $0x0
+  80156a:	e8 b6 f6 ff ff       	call   800c25 <sys_page_unmap>
+	return r;
+  80156f:	83 c4 10             	add    $0x10,%esp
+  801572:	eb b3                	jmp    801527 <dup+0x9d>
+
+00801574 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801574:	55                   	push   %ebp
+  801575:	89 e5                	mov    %esp,%ebp
+  801577:	56                   	push   %esi
+  801578:	53                   	push   %ebx
+  801579:	83 ec 18             	sub    $0x18,%esp
+  80157c:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80157f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801582:	50                   	push   %eax
+  801583:	56                   	push   %esi
+  801584:	e8 85 fd ff ff       	call   80130e <fd_lookup>
+  801589:	83 c4 10             	add    $0x10,%esp
+  80158c:	85 c0                	test   %eax,%eax
+  80158e:	78 3c                	js     8015cc <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801590:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801593:	83 ec 08             	sub    $0x8,%esp
+  801596:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801599:	50                   	push   %eax
+  80159a:	ff 33                	push   (%ebx)
+  80159c:	e8 bd fd ff ff       	call   80135e <dev_lookup>
+  8015a1:	83 c4 10             	add    $0x10,%esp
+  8015a4:	85 c0                	test   %eax,%eax
+  8015a6:	78 24                	js     8015cc <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8015a8:	8b 43 08             	mov    0x8(%ebx),%eax
+  8015ab:	83 e0 03             	and    $0x3,%eax
+  8015ae:	83 f8 01             	cmp    $0x1,%eax
+  8015b1:	74 20                	je     8015d3 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8015b3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015b6:	8b 40 08             	mov    0x8(%eax),%eax
+  8015b9:	85 c0                	test   %eax,%eax
+  8015bb:	74 37                	je     8015f4 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8015bd:	83 ec 04             	sub    $0x4,%esp
+  8015c0:	ff 75 10             	push   0x10(%ebp)
+  8015c3:	ff 75 0c             	push   0xc(%ebp)
+  8015c6:	53                   	push   %ebx
+  8015c7:	ff d0                	call   *%eax
+  8015c9:	83 c4 10             	add    $0x10,%esp
+}
+  8015cc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015cf:	5b                   	pop    %ebx
+  8015d0:	5e                   	pop    %esi
+  8015d1:	5d                   	pop    %ebp
+  8015d2:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8015d3:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  8015d8:	8b 40 48             	mov    0x48(%eax),%eax
+  8015db:	83 ec 04             	sub    $0x4,%esp
+  8015de:	56                   	push   %esi
+  8015df:	50                   	push   %eax
+  8015e0:	68 55 2e 80 00       	push   $0x802e55
+  8015e5:	e8 11 ec ff ff       	call   8001fb <cprintf>
+		return -E_INVAL;
+  8015ea:	83 c4 10             	add    $0x10,%esp
+  8015ed:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015f2:	eb d8                	jmp    8015cc <read+0x58>
+		return -E_NOT_SUPP;
+  8015f4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015f9:	eb d1                	jmp    8015cc <read+0x58>
+
+008015fb <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8015fb:	55                   	push   %ebp
+  8015fc:	89 e5                	mov    %esp,%ebp
+  8015fe:	57                   	push   %edi
+  8015ff:	56                   	push   %esi
+  801600:	53                   	push   %ebx
+  801601:	83 ec 0c             	sub    $0xc,%esp
+  801604:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801607:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80160a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80160f:	eb 02                	jmp    801613 <readn+0x18>
+  801611:	01 c3                	add    %eax,%ebx
+  801613:	39 f3                	cmp    %esi,%ebx
+  801615:	73 21                	jae    801638 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801617:	83 ec 04             	sub    $0x4,%esp
+  80161a:	89 f0                	mov    %esi,%eax
+  80161c:	29 d8                	sub    %ebx,%eax
+  80161e:	50                   	push   %eax
+  80161f:	89 d8                	mov    %ebx,%eax
+  801621:	03 45 0c             	add    0xc(%ebp),%eax
+  801624:	50                   	push   %eax
+  801625:	57                   	push   %edi
+  801626:	e8 49 ff ff ff       	call   801574 <read>
+		if (m < 0)
+  80162b:	83 c4 10             	add    $0x10,%esp
+  80162e:	85 c0                	test   %eax,%eax
+  801630:	78 04                	js     801636 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801632:	75 dd                	jne    801611 <readn+0x16>
+  801634:	eb 02                	jmp    801638 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801636:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801638:	89 d8                	mov    %ebx,%eax
+  80163a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80163d:	5b                   	pop    %ebx
+  80163e:	5e                   	pop    %esi
+  80163f:	5f                   	pop    %edi
+  801640:	5d                   	pop    %ebp
+  801641:	c3                   	ret
+
+00801642 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801642:	55                   	push   %ebp
+  801643:	89 e5                	mov    %esp,%ebp
+  801645:	56                   	push   %esi
+  801646:	53                   	push   %ebx
+  801647:	83 ec 18             	sub    $0x18,%esp
+  80164a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80164d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801650:	50                   	push   %eax
+  801651:	53                   	push   %ebx
+  801652:	e8 b7 fc ff ff       	call   80130e <fd_lookup>
+  801657:	83 c4 10             	add    $0x10,%esp
+  80165a:	85 c0                	test   %eax,%eax
+  80165c:	78 37                	js     801695 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80165e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801661:	83 ec 08             	sub    $0x8,%esp
+  801664:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801667:	50                   	push   %eax
+  801668:	ff 36                	push   (%esi)
+  80166a:	e8 ef fc ff ff       	call   80135e <dev_lookup>
+  80166f:	83 c4 10             	add    $0x10,%esp
+  801672:	85 c0                	test   %eax,%eax
+  801674:	78 1f                	js     801695 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801676:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80167a:	74 20                	je     80169c <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80167c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80167f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801682:	85 c0                	test   %eax,%eax
+  801684:	74 37                	je     8016bd <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801686:	83 ec 04             	sub    $0x4,%esp
+  801689:	ff 75 10             	push   0x10(%ebp)
+  80168c:	ff 75 0c             	push   0xc(%ebp)
+  80168f:	56                   	push   %esi
+  801690:	ff d0                	call   *%eax
+  801692:	83 c4 10             	add    $0x10,%esp
+}
+  801695:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801698:	5b                   	pop    %ebx
+  801699:	5e                   	pop    %esi
+  80169a:	5d                   	pop    %ebp
+  80169b:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80169c:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  8016a1:	8b 40 48             	mov    0x48(%eax),%eax
+  8016a4:	83 ec 04             	sub    $0x4,%esp
+  8016a7:	53                   	push   %ebx
+  8016a8:	50                   	push   %eax
+  8016a9:	68 71 2e 80 00       	push   $0x802e71
+  8016ae:	e8 48 eb ff ff       	call   8001fb <cprintf>
+		return -E_INVAL;
+  8016b3:	83 c4 10             	add    $0x10,%esp
+  8016b6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016bb:	eb d8                	jmp    801695 <write+0x53>
+		return -E_NOT_SUPP;
+  8016bd:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016c2:	eb d1                	jmp    801695 <write+0x53>
+
+008016c4 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8016c4:	55                   	push   %ebp
+  8016c5:	89 e5                	mov    %esp,%ebp
+  8016c7:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8016ca:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016cd:	50                   	push   %eax
+  8016ce:	ff 75 08             	push   0x8(%ebp)
+  8016d1:	e8 38 fc ff ff       	call   80130e <fd_lookup>
+  8016d6:	83 c4 10             	add    $0x10,%esp
+  8016d9:	85 c0                	test   %eax,%eax
+  8016db:	78 0e                	js     8016eb <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8016dd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8016e0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016e3:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8016e6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8016eb:	c9                   	leave
+  8016ec:	c3                   	ret
+
+008016ed <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8016ed:	55                   	push   %ebp
+  8016ee:	89 e5                	mov    %esp,%ebp
+  8016f0:	56                   	push   %esi
+  8016f1:	53                   	push   %ebx
+  8016f2:	83 ec 18             	sub    $0x18,%esp
+  8016f5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016f8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016fb:	50                   	push   %eax
+  8016fc:	53                   	push   %ebx
+  8016fd:	e8 0c fc ff ff       	call   80130e <fd_lookup>
+  801702:	83 c4 10             	add    $0x10,%esp
+  801705:	85 c0                	test   %eax,%eax
+  801707:	78 34                	js     80173d <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801709:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80170c:	83 ec 08             	sub    $0x8,%esp
+  80170f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801712:	50                   	push   %eax
+  801713:	ff 36                	push   (%esi)
+  801715:	e8 44 fc ff ff       	call   80135e <dev_lookup>
+  80171a:	83 c4 10             	add    $0x10,%esp
+  80171d:	85 c0                	test   %eax,%eax
+  80171f:	78 1c                	js     80173d <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801721:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801725:	74 1d                	je     801744 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801727:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80172a:	8b 40 18             	mov    0x18(%eax),%eax
+  80172d:	85 c0                	test   %eax,%eax
+  80172f:	74 34                	je     801765 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801731:	83 ec 08             	sub    $0x8,%esp
+  801734:	ff 75 0c             	push   0xc(%ebp)
+  801737:	56                   	push   %esi
+  801738:	ff d0                	call   *%eax
+  80173a:	83 c4 10             	add    $0x10,%esp
+}
+  80173d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801740:	5b                   	pop    %ebx
+  801741:	5e                   	pop    %esi
+  801742:	5d                   	pop    %ebp
+  801743:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801744:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  801749:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80174c:	83 ec 04             	sub    $0x4,%esp
+  80174f:	53                   	push   %ebx
+  801750:	50                   	push   %eax
+  801751:	68 34 2e 80 00       	push   $0x802e34
+  801756:	e8 a0 ea ff ff       	call   8001fb <cprintf>
+		return -E_INVAL;
+  80175b:	83 c4 10             	add    $0x10,%esp
+  80175e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801763:	eb d8                	jmp    80173d <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801765:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80176a:	eb d1                	jmp    80173d <ftruncate+0x50>
+
+0080176c <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80176c:	55                   	push   %ebp
+  80176d:	89 e5                	mov    %esp,%ebp
+  80176f:	56                   	push   %esi
+  801770:	53                   	push   %ebx
+  801771:	83 ec 18             	sub    $0x18,%esp
+  801774:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801777:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80177a:	50                   	push   %eax
+  80177b:	ff 75 08             	push   0x8(%ebp)
+  80177e:	e8 8b fb ff ff       	call   80130e <fd_lookup>
+  801783:	83 c4 10             	add    $0x10,%esp
+  801786:	85 c0                	test   %eax,%eax
+  801788:	78 49                	js     8017d3 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80178a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80178d:	83 ec 08             	sub    $0x8,%esp
+  801790:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801793:	50                   	push   %eax
+  801794:	ff 36                	push   (%esi)
+  801796:	e8 c3 fb ff ff       	call   80135e <dev_lookup>
+  80179b:	83 c4 10             	add    $0x10,%esp
+  80179e:	85 c0                	test   %eax,%eax
+  8017a0:	78 31                	js     8017d3 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8017a2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017a5:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8017a9:	74 2f                	je     8017da <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8017ab:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8017ae:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8017b5:	00 00 00 
+	stat->st_isdir = 0;
+  8017b8:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8017bf:	00 00 00 
+	stat->st_dev = dev;
+  8017c2:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8017c8:	83 ec 08             	sub    $0x8,%esp
+  8017cb:	53                   	push   %ebx
+  8017cc:	56                   	push   %esi
+  8017cd:	ff 50 14             	call   *0x14(%eax)
+  8017d0:	83 c4 10             	add    $0x10,%esp
+}
+  8017d3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017d6:	5b                   	pop    %ebx
+  8017d7:	5e                   	pop    %esi
+  8017d8:	5d                   	pop    %ebp
+  8017d9:	c3                   	ret
+		return -E_NOT_SUPP;
+  8017da:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017df:	eb f2                	jmp    8017d3 <fstat+0x67>
+
+008017e1 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8017e1:	55                   	push   %ebp
+  8017e2:	89 e5                	mov    %esp,%ebp
+  8017e4:	56                   	push   %esi
+  8017e5:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8017e6:	83 ec 08             	sub    $0x8,%esp
+  8017e9:	6a 00                	push   $0x0
+  8017eb:	ff 75 08             	push   0x8(%ebp)
+  8017ee:	e8 e4 01 00 00       	call   8019d7 <open>
+  8017f3:	89 c3                	mov    %eax,%ebx
+  8017f5:	83 c4 10             	add    $0x10,%esp
+  8017f8:	85 c0                	test   %eax,%eax
+  8017fa:	78 1b                	js     801817 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8017fc:	83 ec 08             	sub    $0x8,%esp
+  8017ff:	ff 75 0c             	push   0xc(%ebp)
+  801802:	50                   	push   %eax
+  801803:	e8 64 ff ff ff       	call   80176c <fstat>
+  801808:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80180a:	89 1c 24             	mov    %ebx,(%esp)
+  80180d:	e8 26 fc ff ff       	call   801438 <close>
+	return r;
+  801812:	83 c4 10             	add    $0x10,%esp
+  801815:	89 f3                	mov    %esi,%ebx
+}
+  801817:	89 d8                	mov    %ebx,%eax
+  801819:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80181c:	5b                   	pop    %ebx
+  80181d:	5e                   	pop    %esi
+  80181e:	5d                   	pop    %ebp
+  80181f:	c3                   	ret
+
+00801820 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  801820:	55                   	push   %ebp
+  801821:	89 e5                	mov    %esp,%ebp
+  801823:	56                   	push   %esi
+  801824:	53                   	push   %ebx
+  801825:	89 c6                	mov    %eax,%esi
+  801827:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  801829:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  801830:	74 27                	je     801859 <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801832:	6a 07                	push   $0x7
+  801834:	68 00 50 80 00       	push   $0x805000
+  801839:	56                   	push   %esi
+  80183a:	ff 35 00 40 80 00    	push   0x804000
+  801840:	e8 b9 f9 ff ff       	call   8011fe <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  801845:	83 c4 0c             	add    $0xc,%esp
+  801848:	6a 00                	push   $0x0
+  80184a:	53                   	push   %ebx
+  80184b:	6a 00                	push   $0x0
+  80184d:	e8 38 f9 ff ff       	call   80118a <ipc_recv>
+}
+  801852:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801855:	5b                   	pop    %ebx
+  801856:	5e                   	pop    %esi
+  801857:	5d                   	pop    %ebp
+  801858:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  801859:	83 ec 0c             	sub    $0xc,%esp
+  80185c:	6a 01                	push   $0x1
+  80185e:	e8 ef f9 ff ff       	call   801252 <ipc_find_env>
+  801863:	a3 00 40 80 00       	mov    %eax,0x804000
+  801868:	83 c4 10             	add    $0x10,%esp
+  80186b:	eb c5                	jmp    801832 <fsipc+0x12>
+
+0080186d <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80186d:	55                   	push   %ebp
+  80186e:	89 e5                	mov    %esp,%ebp
+  801870:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801873:	8b 45 08             	mov    0x8(%ebp),%eax
+  801876:	8b 40 0c             	mov    0xc(%eax),%eax
+  801879:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.set_size.req_size = newsize;
+  80187e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801881:	a3 04 50 80 00       	mov    %eax,0x805004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801886:	ba 00 00 00 00       	mov    $0x0,%edx
+  80188b:	b8 02 00 00 00       	mov    $0x2,%eax
+  801890:	e8 8b ff ff ff       	call   801820 <fsipc>
+}
+  801895:	c9                   	leave
+  801896:	c3                   	ret
+
+00801897 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801897:	55                   	push   %ebp
+  801898:	89 e5                	mov    %esp,%ebp
+  80189a:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80189d:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018a0:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018a3:	a3 00 50 80 00       	mov    %eax,0x805000
+  return fsipc(FSREQ_FLUSH, NULL);
+  8018a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018ad:	b8 06 00 00 00       	mov    $0x6,%eax
+  8018b2:	e8 69 ff ff ff       	call   801820 <fsipc>
+}
+  8018b7:	c9                   	leave
+  8018b8:	c3                   	ret
+
+008018b9 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8018b9:	55                   	push   %ebp
+  8018ba:	89 e5                	mov    %esp,%ebp
+  8018bc:	53                   	push   %ebx
+  8018bd:	83 ec 04             	sub    $0x4,%esp
+  8018c0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8018c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018c6:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018c9:	a3 00 50 80 00       	mov    %eax,0x805000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8018ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018d3:	b8 05 00 00 00       	mov    $0x5,%eax
+  8018d8:	e8 43 ff ff ff       	call   801820 <fsipc>
+  8018dd:	85 c0                	test   %eax,%eax
+  8018df:	78 2c                	js     80190d <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8018e1:	83 ec 08             	sub    $0x8,%esp
+  8018e4:	68 00 50 80 00       	push   $0x805000
+  8018e9:	53                   	push   %ebx
+  8018ea:	e8 c5 ee ff ff       	call   8007b4 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  8018ef:	a1 80 50 80 00       	mov    0x805080,%eax
+  8018f4:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8018fa:	a1 84 50 80 00       	mov    0x805084,%eax
+  8018ff:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801905:	83 c4 10             	add    $0x10,%esp
+  801908:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80190d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801910:	c9                   	leave
+  801911:	c3                   	ret
+
+00801912 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801912:	55                   	push   %ebp
+  801913:	89 e5                	mov    %esp,%ebp
+  801915:	83 ec 0c             	sub    $0xc,%esp
+  801918:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80191b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80191e:	8b 52 0c             	mov    0xc(%edx),%edx
+  801921:	89 15 00 50 80 00    	mov    %edx,0x805000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801927:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  80192c:	39 d0                	cmp    %edx,%eax
+  80192e:	0f 47 c2             	cmova  %edx,%eax
+  801931:	a3 04 50 80 00       	mov    %eax,0x805004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  801936:	50                   	push   %eax
+  801937:	ff 75 0c             	push   0xc(%ebp)
+  80193a:	68 08 50 80 00       	push   $0x805008
+  80193f:	e8 f6 ef ff ff       	call   80093a <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801944:	ba 00 00 00 00       	mov    $0x0,%edx
+  801949:	b8 04 00 00 00       	mov    $0x4,%eax
+  80194e:	e8 cd fe ff ff       	call   801820 <fsipc>
+}
+  801953:	c9                   	leave
+  801954:	c3                   	ret
+
+00801955 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801955:	55                   	push   %ebp
+  801956:	89 e5                	mov    %esp,%ebp
+  801958:	56                   	push   %esi
+  801959:	53                   	push   %ebx
+  80195a:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80195d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801960:	8b 40 0c             	mov    0xc(%eax),%eax
+  801963:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.read.req_n = n;
+  801968:	89 35 04 50 80 00    	mov    %esi,0x805004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  80196e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801973:	b8 03 00 00 00       	mov    $0x3,%eax
+  801978:	e8 a3 fe ff ff       	call   801820 <fsipc>
+  80197d:	89 c3                	mov    %eax,%ebx
+  80197f:	85 c0                	test   %eax,%eax
+  801981:	78 1f                	js     8019a2 <devfile_read+0x4d>
+  assert(r <= n);
+  801983:	39 c6                	cmp    %eax,%esi
+  801985:	72 24                	jb     8019ab <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  801987:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80198c:	7f 33                	jg     8019c1 <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80198e:	83 ec 04             	sub    $0x4,%esp
+  801991:	50                   	push   %eax
+  801992:	68 00 50 80 00       	push   $0x805000
+  801997:	ff 75 0c             	push   0xc(%ebp)
+  80199a:	e8 9b ef ff ff       	call   80093a <memmove>
+  return r;
+  80199f:	83 c4 10             	add    $0x10,%esp
+}
+  8019a2:	89 d8                	mov    %ebx,%eax
+  8019a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019a7:	5b                   	pop    %ebx
+  8019a8:	5e                   	pop    %esi
+  8019a9:	5d                   	pop    %ebp
+  8019aa:	c3                   	ret
+  assert(r <= n);
+  8019ab:	68 a4 2e 80 00       	push   $0x802ea4
+  8019b0:	68 ab 2e 80 00       	push   $0x802eab
+  8019b5:	6a 78                	push   $0x78
+  8019b7:	68 c0 2e 80 00       	push   $0x802ec0
+  8019bc:	e8 e1 09 00 00       	call   8023a2 <_panic>
+  assert(r <= PGSIZE);
+  8019c1:	68 cb 2e 80 00       	push   $0x802ecb
+  8019c6:	68 ab 2e 80 00       	push   $0x802eab
+  8019cb:	6a 79                	push   $0x79
+  8019cd:	68 c0 2e 80 00       	push   $0x802ec0
+  8019d2:	e8 cb 09 00 00       	call   8023a2 <_panic>
+
+008019d7 <open>:
+open(const char *path, int mode) {
+  8019d7:	55                   	push   %ebp
+  8019d8:	89 e5                	mov    %esp,%ebp
+  8019da:	56                   	push   %esi
+  8019db:	53                   	push   %ebx
+  8019dc:	83 ec 1c             	sub    $0x1c,%esp
+  8019df:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  8019e2:	56                   	push   %esi
+  8019e3:	e8 91 ed ff ff       	call   800779 <strlen>
+  8019e8:	83 c4 10             	add    $0x10,%esp
+  8019eb:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8019f0:	7f 6c                	jg     801a5e <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  8019f2:	83 ec 0c             	sub    $0xc,%esp
+  8019f5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019f8:	50                   	push   %eax
+  8019f9:	e8 ba f8 ff ff       	call   8012b8 <fd_alloc>
+  8019fe:	89 c3                	mov    %eax,%ebx
+  801a00:	83 c4 10             	add    $0x10,%esp
+  801a03:	85 c0                	test   %eax,%eax
+  801a05:	78 3c                	js     801a43 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801a07:	83 ec 08             	sub    $0x8,%esp
+  801a0a:	56                   	push   %esi
+  801a0b:	68 00 50 80 00       	push   $0x805000
+  801a10:	e8 9f ed ff ff       	call   8007b4 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801a15:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a18:	a3 00 54 80 00       	mov    %eax,0x805400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801a1d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801a20:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a25:	e8 f6 fd ff ff       	call   801820 <fsipc>
+  801a2a:	89 c3                	mov    %eax,%ebx
+  801a2c:	83 c4 10             	add    $0x10,%esp
+  801a2f:	85 c0                	test   %eax,%eax
+  801a31:	78 19                	js     801a4c <open+0x75>
+  return fd2num(fd);
+  801a33:	83 ec 0c             	sub    $0xc,%esp
+  801a36:	ff 75 f4             	push   -0xc(%ebp)
+  801a39:	e8 53 f8 ff ff       	call   801291 <fd2num>
+  801a3e:	89 c3                	mov    %eax,%ebx
+  801a40:	83 c4 10             	add    $0x10,%esp
+}
+  801a43:	89 d8                	mov    %ebx,%eax
+  801a45:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a48:	5b                   	pop    %ebx
+  801a49:	5e                   	pop    %esi
+  801a4a:	5d                   	pop    %ebp
+  801a4b:	c3                   	ret
+    fd_close(fd, 0);
+  801a4c:	83 ec 08             	sub    $0x8,%esp
+  801a4f:	6a 00                	push   $0x0
+  801a51:	ff 75 f4             	push   -0xc(%ebp)
+  801a54:	e8 58 f9 ff ff       	call   8013b1 <fd_close>
+    return r;
+  801a59:	83 c4 10             	add    $0x10,%esp
+  801a5c:	eb e5                	jmp    801a43 <open+0x6c>
+    return -E_BAD_PATH;
+  801a5e:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801a63:	eb de                	jmp    801a43 <open+0x6c>
+
+00801a65 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  801a65:	55                   	push   %ebp
+  801a66:	89 e5                	mov    %esp,%ebp
+  801a68:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801a6b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a70:	b8 08 00 00 00       	mov    $0x8,%eax
+  801a75:	e8 a6 fd ff ff       	call   801820 <fsipc>
+}
+  801a7a:	c9                   	leave
+  801a7b:	c3                   	ret
+
+00801a7c <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801a7c:	55                   	push   %ebp
+  801a7d:	89 e5                	mov    %esp,%ebp
+  801a7f:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801a82:	68 d7 2e 80 00       	push   $0x802ed7
+  801a87:	ff 75 0c             	push   0xc(%ebp)
+  801a8a:	e8 25 ed ff ff       	call   8007b4 <strcpy>
+	return 0;
+}
+  801a8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a94:	c9                   	leave
+  801a95:	c3                   	ret
+
+00801a96 <devsock_close>:
+{
+  801a96:	55                   	push   %ebp
+  801a97:	89 e5                	mov    %esp,%ebp
+  801a99:	53                   	push   %ebx
+  801a9a:	83 ec 10             	sub    $0x10,%esp
+  801a9d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801aa0:	53                   	push   %ebx
+  801aa1:	e8 d1 09 00 00       	call   802477 <pageref>
+  801aa6:	89 c2                	mov    %eax,%edx
+  801aa8:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801aab:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801ab0:	83 fa 01             	cmp    $0x1,%edx
+  801ab3:	74 05                	je     801aba <devsock_close+0x24>
+}
+  801ab5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ab8:	c9                   	leave
+  801ab9:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801aba:	83 ec 0c             	sub    $0xc,%esp
+  801abd:	ff 73 0c             	push   0xc(%ebx)
+  801ac0:	e8 b7 02 00 00       	call   801d7c <nsipc_close>
+  801ac5:	83 c4 10             	add    $0x10,%esp
+  801ac8:	eb eb                	jmp    801ab5 <devsock_close+0x1f>
+
+00801aca <devsock_write>:
+{
+  801aca:	55                   	push   %ebp
+  801acb:	89 e5                	mov    %esp,%ebp
+  801acd:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801ad0:	6a 00                	push   $0x0
+  801ad2:	ff 75 10             	push   0x10(%ebp)
+  801ad5:	ff 75 0c             	push   0xc(%ebp)
+  801ad8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801adb:	ff 70 0c             	push   0xc(%eax)
+  801ade:	e8 79 03 00 00       	call   801e5c <nsipc_send>
+}
+  801ae3:	c9                   	leave
+  801ae4:	c3                   	ret
+
+00801ae5 <devsock_read>:
+{
+  801ae5:	55                   	push   %ebp
+  801ae6:	89 e5                	mov    %esp,%ebp
+  801ae8:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801aeb:	6a 00                	push   $0x0
+  801aed:	ff 75 10             	push   0x10(%ebp)
+  801af0:	ff 75 0c             	push   0xc(%ebp)
+  801af3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801af6:	ff 70 0c             	push   0xc(%eax)
+  801af9:	e8 ef 02 00 00       	call   801ded <nsipc_recv>
+}
+  801afe:	c9                   	leave
+  801aff:	c3                   	ret
+
+00801b00 <fd2sockid>:
+{
+  801b00:	55                   	push   %ebp
+  801b01:	89 e5                	mov    %esp,%ebp
+  801b03:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801b06:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801b09:	52                   	push   %edx
+  801b0a:	50                   	push   %eax
+  801b0b:	e8 fe f7 ff ff       	call   80130e <fd_lookup>
+  801b10:	83 c4 10             	add    $0x10,%esp
+  801b13:	85 c0                	test   %eax,%eax
+  801b15:	78 10                	js     801b27 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801b17:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b1a:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  801b20:	39 08                	cmp    %ecx,(%eax)
+  801b22:	75 05                	jne    801b29 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801b24:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801b27:	c9                   	leave
+  801b28:	c3                   	ret
+		return -E_NOT_SUPP;
+  801b29:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b2e:	eb f7                	jmp    801b27 <fd2sockid+0x27>
+
+00801b30 <alloc_sockfd>:
+{
+  801b30:	55                   	push   %ebp
+  801b31:	89 e5                	mov    %esp,%ebp
+  801b33:	56                   	push   %esi
+  801b34:	53                   	push   %ebx
+  801b35:	83 ec 1c             	sub    $0x1c,%esp
+  801b38:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801b3a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b3d:	50                   	push   %eax
+  801b3e:	e8 75 f7 ff ff       	call   8012b8 <fd_alloc>
+  801b43:	89 c3                	mov    %eax,%ebx
+  801b45:	83 c4 10             	add    $0x10,%esp
+  801b48:	85 c0                	test   %eax,%eax
+  801b4a:	78 43                	js     801b8f <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801b4c:	83 ec 04             	sub    $0x4,%esp
+  801b4f:	68 07 04 00 00       	push   $0x407
+  801b54:	ff 75 f4             	push   -0xc(%ebp)
+  801b57:	6a 00                	push   $0x0
+  801b59:	e8 42 f0 ff ff       	call   800ba0 <sys_page_alloc>
+  801b5e:	89 c3                	mov    %eax,%ebx
+  801b60:	83 c4 10             	add    $0x10,%esp
+  801b63:	85 c0                	test   %eax,%eax
+  801b65:	78 28                	js     801b8f <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801b67:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b6a:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  801b70:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801b72:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b75:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801b7c:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801b7f:	83 ec 0c             	sub    $0xc,%esp
+  801b82:	50                   	push   %eax
+  801b83:	e8 09 f7 ff ff       	call   801291 <fd2num>
+  801b88:	89 c3                	mov    %eax,%ebx
+  801b8a:	83 c4 10             	add    $0x10,%esp
+  801b8d:	eb 0c                	jmp    801b9b <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801b8f:	83 ec 0c             	sub    $0xc,%esp
+  801b92:	56                   	push   %esi
+  801b93:	e8 e4 01 00 00       	call   801d7c <nsipc_close>
+		return r;
+  801b98:	83 c4 10             	add    $0x10,%esp
+}
+  801b9b:	89 d8                	mov    %ebx,%eax
+  801b9d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ba0:	5b                   	pop    %ebx
+  801ba1:	5e                   	pop    %esi
+  801ba2:	5d                   	pop    %ebp
+  801ba3:	c3                   	ret
+
+00801ba4 <accept>:
+{
+  801ba4:	55                   	push   %ebp
+  801ba5:	89 e5                	mov    %esp,%ebp
+  801ba7:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801baa:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bad:	e8 4e ff ff ff       	call   801b00 <fd2sockid>
+  801bb2:	85 c0                	test   %eax,%eax
+  801bb4:	78 1b                	js     801bd1 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801bb6:	83 ec 04             	sub    $0x4,%esp
+  801bb9:	ff 75 10             	push   0x10(%ebp)
+  801bbc:	ff 75 0c             	push   0xc(%ebp)
+  801bbf:	50                   	push   %eax
+  801bc0:	e8 0e 01 00 00       	call   801cd3 <nsipc_accept>
+  801bc5:	83 c4 10             	add    $0x10,%esp
+  801bc8:	85 c0                	test   %eax,%eax
+  801bca:	78 05                	js     801bd1 <accept+0x2d>
+	return alloc_sockfd(r);
+  801bcc:	e8 5f ff ff ff       	call   801b30 <alloc_sockfd>
+}
+  801bd1:	c9                   	leave
+  801bd2:	c3                   	ret
+
+00801bd3 <bind>:
+{
+  801bd3:	55                   	push   %ebp
+  801bd4:	89 e5                	mov    %esp,%ebp
+  801bd6:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801bd9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bdc:	e8 1f ff ff ff       	call   801b00 <fd2sockid>
+  801be1:	85 c0                	test   %eax,%eax
+  801be3:	78 12                	js     801bf7 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801be5:	83 ec 04             	sub    $0x4,%esp
+  801be8:	ff 75 10             	push   0x10(%ebp)
+  801beb:	ff 75 0c             	push   0xc(%ebp)
+  801bee:	50                   	push   %eax
+  801bef:	e8 31 01 00 00       	call   801d25 <nsipc_bind>
+  801bf4:	83 c4 10             	add    $0x10,%esp
+}
+  801bf7:	c9                   	leave
+  801bf8:	c3                   	ret
+
+00801bf9 <shutdown>:
+{
+  801bf9:	55                   	push   %ebp
+  801bfa:	89 e5                	mov    %esp,%ebp
+  801bfc:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801bff:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c02:	e8 f9 fe ff ff       	call   801b00 <fd2sockid>
+  801c07:	85 c0                	test   %eax,%eax
+  801c09:	78 0f                	js     801c1a <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801c0b:	83 ec 08             	sub    $0x8,%esp
+  801c0e:	ff 75 0c             	push   0xc(%ebp)
+  801c11:	50                   	push   %eax
+  801c12:	e8 43 01 00 00       	call   801d5a <nsipc_shutdown>
+  801c17:	83 c4 10             	add    $0x10,%esp
+}
+  801c1a:	c9                   	leave
+  801c1b:	c3                   	ret
+
+00801c1c <connect>:
+{
+  801c1c:	55                   	push   %ebp
+  801c1d:	89 e5                	mov    %esp,%ebp
+  801c1f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801c22:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c25:	e8 d6 fe ff ff       	call   801b00 <fd2sockid>
+  801c2a:	85 c0                	test   %eax,%eax
+  801c2c:	78 12                	js     801c40 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801c2e:	83 ec 04             	sub    $0x4,%esp
+  801c31:	ff 75 10             	push   0x10(%ebp)
+  801c34:	ff 75 0c             	push   0xc(%ebp)
+  801c37:	50                   	push   %eax
+  801c38:	e8 59 01 00 00       	call   801d96 <nsipc_connect>
+  801c3d:	83 c4 10             	add    $0x10,%esp
+}
+  801c40:	c9                   	leave
+  801c41:	c3                   	ret
+
+00801c42 <listen>:
+{
+  801c42:	55                   	push   %ebp
+  801c43:	89 e5                	mov    %esp,%ebp
+  801c45:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801c48:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c4b:	e8 b0 fe ff ff       	call   801b00 <fd2sockid>
+  801c50:	85 c0                	test   %eax,%eax
+  801c52:	78 0f                	js     801c63 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801c54:	83 ec 08             	sub    $0x8,%esp
+  801c57:	ff 75 0c             	push   0xc(%ebp)
+  801c5a:	50                   	push   %eax
+  801c5b:	e8 6b 01 00 00       	call   801dcb <nsipc_listen>
+  801c60:	83 c4 10             	add    $0x10,%esp
+}
+  801c63:	c9                   	leave
+  801c64:	c3                   	ret
+
+00801c65 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801c65:	55                   	push   %ebp
+  801c66:	89 e5                	mov    %esp,%ebp
+  801c68:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801c6b:	ff 75 10             	push   0x10(%ebp)
+  801c6e:	ff 75 0c             	push   0xc(%ebp)
+  801c71:	ff 75 08             	push   0x8(%ebp)
+  801c74:	e8 41 02 00 00       	call   801eba <nsipc_socket>
+  801c79:	83 c4 10             	add    $0x10,%esp
+  801c7c:	85 c0                	test   %eax,%eax
+  801c7e:	78 05                	js     801c85 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801c80:	e8 ab fe ff ff       	call   801b30 <alloc_sockfd>
+}
+  801c85:	c9                   	leave
+  801c86:	c3                   	ret
+
+00801c87 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801c87:	55                   	push   %ebp
+  801c88:	89 e5                	mov    %esp,%ebp
+  801c8a:	53                   	push   %ebx
+  801c8b:	83 ec 04             	sub    $0x4,%esp
+  801c8e:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801c90:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801c97:	74 26                	je     801cbf <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801c99:	6a 07                	push   $0x7
+  801c9b:	68 00 60 80 00       	push   $0x806000
+  801ca0:	53                   	push   %ebx
+  801ca1:	ff 35 04 40 80 00    	push   0x804004
+  801ca7:	e8 52 f5 ff ff       	call   8011fe <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801cac:	83 c4 0c             	add    $0xc,%esp
+  801caf:	6a 00                	push   $0x0
+  801cb1:	6a 00                	push   $0x0
+  801cb3:	6a 00                	push   $0x0
+  801cb5:	e8 d0 f4 ff ff       	call   80118a <ipc_recv>
+}
+  801cba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cbd:	c9                   	leave
+  801cbe:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801cbf:	83 ec 0c             	sub    $0xc,%esp
+  801cc2:	6a 02                	push   $0x2
+  801cc4:	e8 89 f5 ff ff       	call   801252 <ipc_find_env>
+  801cc9:	a3 04 40 80 00       	mov    %eax,0x804004
+  801cce:	83 c4 10             	add    $0x10,%esp
+  801cd1:	eb c6                	jmp    801c99 <nsipc+0x12>
+
+00801cd3 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801cd3:	55                   	push   %ebp
+  801cd4:	89 e5                	mov    %esp,%ebp
+  801cd6:	56                   	push   %esi
+  801cd7:	53                   	push   %ebx
+  801cd8:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801cdb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cde:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801ce3:	8b 06                	mov    (%esi),%eax
+  801ce5:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801cea:	b8 01 00 00 00       	mov    $0x1,%eax
+  801cef:	e8 93 ff ff ff       	call   801c87 <nsipc>
+  801cf4:	89 c3                	mov    %eax,%ebx
+  801cf6:	85 c0                	test   %eax,%eax
+  801cf8:	79 09                	jns    801d03 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801cfa:	89 d8                	mov    %ebx,%eax
+  801cfc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cff:	5b                   	pop    %ebx
+  801d00:	5e                   	pop    %esi
+  801d01:	5d                   	pop    %ebp
+  801d02:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801d03:	83 ec 04             	sub    $0x4,%esp
+  801d06:	ff 35 10 60 80 00    	push   0x806010
+  801d0c:	68 00 60 80 00       	push   $0x806000
+  801d11:	ff 75 0c             	push   0xc(%ebp)
+  801d14:	e8 21 ec ff ff       	call   80093a <memmove>
+		*addrlen = ret->ret_addrlen;
+  801d19:	a1 10 60 80 00       	mov    0x806010,%eax
+  801d1e:	89 06                	mov    %eax,(%esi)
+  801d20:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801d23:	eb d5                	jmp    801cfa <nsipc_accept+0x27>
+
+00801d25 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801d25:	55                   	push   %ebp
+  801d26:	89 e5                	mov    %esp,%ebp
+  801d28:	53                   	push   %ebx
+  801d29:	83 ec 08             	sub    $0x8,%esp
+  801d2c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801d2f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d32:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801d37:	53                   	push   %ebx
+  801d38:	ff 75 0c             	push   0xc(%ebp)
+  801d3b:	68 04 60 80 00       	push   $0x806004
+  801d40:	e8 f5 eb ff ff       	call   80093a <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801d45:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  801d4b:	b8 02 00 00 00       	mov    $0x2,%eax
+  801d50:	e8 32 ff ff ff       	call   801c87 <nsipc>
+}
+  801d55:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d58:	c9                   	leave
+  801d59:	c3                   	ret
+
+00801d5a <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801d5a:	55                   	push   %ebp
+  801d5b:	89 e5                	mov    %esp,%ebp
+  801d5d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801d60:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d63:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  801d68:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d6b:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  801d70:	b8 03 00 00 00       	mov    $0x3,%eax
+  801d75:	e8 0d ff ff ff       	call   801c87 <nsipc>
+}
+  801d7a:	c9                   	leave
+  801d7b:	c3                   	ret
+
+00801d7c <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801d7c:	55                   	push   %ebp
+  801d7d:	89 e5                	mov    %esp,%ebp
+  801d7f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801d82:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d85:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  801d8a:	b8 04 00 00 00       	mov    $0x4,%eax
+  801d8f:	e8 f3 fe ff ff       	call   801c87 <nsipc>
+}
+  801d94:	c9                   	leave
+  801d95:	c3                   	ret
+
+00801d96 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801d96:	55                   	push   %ebp
+  801d97:	89 e5                	mov    %esp,%ebp
+  801d99:	53                   	push   %ebx
+  801d9a:	83 ec 08             	sub    $0x8,%esp
+  801d9d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801da0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801da3:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801da8:	53                   	push   %ebx
+  801da9:	ff 75 0c             	push   0xc(%ebp)
+  801dac:	68 04 60 80 00       	push   $0x806004
+  801db1:	e8 84 eb ff ff       	call   80093a <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801db6:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  801dbc:	b8 05 00 00 00       	mov    $0x5,%eax
+  801dc1:	e8 c1 fe ff ff       	call   801c87 <nsipc>
+}
+  801dc6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801dc9:	c9                   	leave
+  801dca:	c3                   	ret
+
+00801dcb <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801dcb:	55                   	push   %ebp
+  801dcc:	89 e5                	mov    %esp,%ebp
+  801dce:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801dd1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dd4:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  801dd9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ddc:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  801de1:	b8 06 00 00 00       	mov    $0x6,%eax
+  801de6:	e8 9c fe ff ff       	call   801c87 <nsipc>
+}
+  801deb:	c9                   	leave
+  801dec:	c3                   	ret
+
+00801ded <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801ded:	55                   	push   %ebp
+  801dee:	89 e5                	mov    %esp,%ebp
+  801df0:	56                   	push   %esi
+  801df1:	53                   	push   %ebx
+  801df2:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801df5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801df8:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  801dfd:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  801e03:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e06:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801e0b:	b8 07 00 00 00       	mov    $0x7,%eax
+  801e10:	e8 72 fe ff ff       	call   801c87 <nsipc>
+  801e15:	89 c3                	mov    %eax,%ebx
+  801e17:	85 c0                	test   %eax,%eax
+  801e19:	78 22                	js     801e3d <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801e1b:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801e20:	39 c6                	cmp    %eax,%esi
+  801e22:	0f 4e c6             	cmovle %esi,%eax
+  801e25:	39 c3                	cmp    %eax,%ebx
+  801e27:	7f 1d                	jg     801e46 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801e29:	83 ec 04             	sub    $0x4,%esp
+  801e2c:	53                   	push   %ebx
+  801e2d:	68 00 60 80 00       	push   $0x806000
+  801e32:	ff 75 0c             	push   0xc(%ebp)
+  801e35:	e8 00 eb ff ff       	call   80093a <memmove>
+  801e3a:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801e3d:	89 d8                	mov    %ebx,%eax
+  801e3f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e42:	5b                   	pop    %ebx
+  801e43:	5e                   	pop    %esi
+  801e44:	5d                   	pop    %ebp
+  801e45:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801e46:	68 e3 2e 80 00       	push   $0x802ee3
+  801e4b:	68 ab 2e 80 00       	push   $0x802eab
+  801e50:	6a 62                	push   $0x62
+  801e52:	68 f8 2e 80 00       	push   $0x802ef8
+  801e57:	e8 46 05 00 00       	call   8023a2 <_panic>
+
+00801e5c <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801e5c:	55                   	push   %ebp
+  801e5d:	89 e5                	mov    %esp,%ebp
+  801e5f:	53                   	push   %ebx
+  801e60:	83 ec 04             	sub    $0x4,%esp
+  801e63:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801e66:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e69:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  801e6e:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801e74:	7f 2e                	jg     801ea4 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801e76:	83 ec 04             	sub    $0x4,%esp
+  801e79:	53                   	push   %ebx
+  801e7a:	ff 75 0c             	push   0xc(%ebp)
+  801e7d:	68 0c 60 80 00       	push   $0x80600c
+  801e82:	e8 b3 ea ff ff       	call   80093a <memmove>
+	nsipcbuf.send.req_size = size;
+  801e87:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  801e8d:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e90:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  801e95:	b8 08 00 00 00       	mov    $0x8,%eax
+  801e9a:	e8 e8 fd ff ff       	call   801c87 <nsipc>
+}
+  801e9f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ea2:	c9                   	leave
+  801ea3:	c3                   	ret
+	assert(size < 1600);
+  801ea4:	68 04 2f 80 00       	push   $0x802f04
+  801ea9:	68 ab 2e 80 00       	push   $0x802eab
+  801eae:	6a 6d                	push   $0x6d
+  801eb0:	68 f8 2e 80 00       	push   $0x802ef8
+  801eb5:	e8 e8 04 00 00       	call   8023a2 <_panic>
+
+00801eba <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801eba:	55                   	push   %ebp
+  801ebb:	89 e5                	mov    %esp,%ebp
+  801ebd:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801ec0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ec3:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  801ec8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ecb:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  801ed0:	8b 45 10             	mov    0x10(%ebp),%eax
+  801ed3:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  801ed8:	b8 09 00 00 00       	mov    $0x9,%eax
+  801edd:	e8 a5 fd ff ff       	call   801c87 <nsipc>
+}
+  801ee2:	c9                   	leave
+  801ee3:	c3                   	ret
+
+00801ee4 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801ee4:	55                   	push   %ebp
+  801ee5:	89 e5                	mov    %esp,%ebp
+  801ee7:	56                   	push   %esi
+  801ee8:	53                   	push   %ebx
+  801ee9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801eec:	83 ec 0c             	sub    $0xc,%esp
+  801eef:	ff 75 08             	push   0x8(%ebp)
+  801ef2:	e8 aa f3 ff ff       	call   8012a1 <fd2data>
+  801ef7:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801ef9:	83 c4 08             	add    $0x8,%esp
+  801efc:	68 10 2f 80 00       	push   $0x802f10
+  801f01:	53                   	push   %ebx
+  801f02:	e8 ad e8 ff ff       	call   8007b4 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801f07:	8b 46 04             	mov    0x4(%esi),%eax
+  801f0a:	2b 06                	sub    (%esi),%eax
+  801f0c:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  801f12:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801f19:	00 00 00 
+	stat->st_dev = &devpipe;
+  801f1c:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  801f23:	30 80 00 
+	return 0;
+}
+  801f26:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f2b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f2e:	5b                   	pop    %ebx
+  801f2f:	5e                   	pop    %esi
+  801f30:	5d                   	pop    %ebp
+  801f31:	c3                   	ret
+
+00801f32 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801f32:	55                   	push   %ebp
+  801f33:	89 e5                	mov    %esp,%ebp
+  801f35:	53                   	push   %ebx
+  801f36:	83 ec 0c             	sub    $0xc,%esp
+  801f39:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801f3c:	53                   	push   %ebx
+  801f3d:	6a 00                	push   $0x0
+  801f3f:	e8 e1 ec ff ff       	call   800c25 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801f44:	89 1c 24             	mov    %ebx,(%esp)
+  801f47:	e8 55 f3 ff ff       	call   8012a1 <fd2data>
+  801f4c:	83 c4 08             	add    $0x8,%esp
+  801f4f:	50                   	push   %eax
+  801f50:	6a 00                	push   $0x0
+  801f52:	e8 ce ec ff ff       	call   800c25 <sys_page_unmap>
+}
+  801f57:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f5a:	c9                   	leave
+  801f5b:	c3                   	ret
+
+00801f5c <_pipeisclosed>:
+{
+  801f5c:	55                   	push   %ebp
+  801f5d:	89 e5                	mov    %esp,%ebp
+  801f5f:	57                   	push   %edi
+  801f60:	56                   	push   %esi
+  801f61:	53                   	push   %ebx
+  801f62:	83 ec 1c             	sub    $0x1c,%esp
+  801f65:	89 c7                	mov    %eax,%edi
+  801f67:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801f69:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  801f6e:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801f71:	83 ec 0c             	sub    $0xc,%esp
+  801f74:	57                   	push   %edi
+  801f75:	e8 fd 04 00 00       	call   802477 <pageref>
+  801f7a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801f7d:	89 34 24             	mov    %esi,(%esp)
+  801f80:	e8 f2 04 00 00       	call   802477 <pageref>
+		nn = thisenv->env_runs;
+  801f85:	8b 15 0c 40 80 00    	mov    0x80400c,%edx
+  801f8b:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801f8e:	83 c4 10             	add    $0x10,%esp
+  801f91:	39 cb                	cmp    %ecx,%ebx
+  801f93:	74 1b                	je     801fb0 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801f95:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801f98:	75 cf                	jne    801f69 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801f9a:	8b 42 58             	mov    0x58(%edx),%eax
+  801f9d:	6a 01                	push   $0x1
+  801f9f:	50                   	push   %eax
+  801fa0:	53                   	push   %ebx
+  801fa1:	68 17 2f 80 00       	push   $0x802f17
+  801fa6:	e8 50 e2 ff ff       	call   8001fb <cprintf>
+  801fab:	83 c4 10             	add    $0x10,%esp
+  801fae:	eb b9                	jmp    801f69 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801fb0:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801fb3:	0f 94 c0             	sete   %al
+  801fb6:	0f b6 c0             	movzbl %al,%eax
+}
+  801fb9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fbc:	5b                   	pop    %ebx
+  801fbd:	5e                   	pop    %esi
+  801fbe:	5f                   	pop    %edi
+  801fbf:	5d                   	pop    %ebp
+  801fc0:	c3                   	ret
+
+00801fc1 <devpipe_write>:
+{
+  801fc1:	55                   	push   %ebp
+  801fc2:	89 e5                	mov    %esp,%ebp
+  801fc4:	57                   	push   %edi
+  801fc5:	56                   	push   %esi
+  801fc6:	53                   	push   %ebx
+  801fc7:	83 ec 28             	sub    $0x28,%esp
+  801fca:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801fcd:	56                   	push   %esi
+  801fce:	e8 ce f2 ff ff       	call   8012a1 <fd2data>
+  801fd3:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801fd5:	83 c4 10             	add    $0x10,%esp
+  801fd8:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fdd:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801fe0:	75 09                	jne    801feb <devpipe_write+0x2a>
+	return i;
+  801fe2:	89 f8                	mov    %edi,%eax
+  801fe4:	eb 23                	jmp    802009 <devpipe_write+0x48>
+			sys_yield();
+  801fe6:	e8 96 eb ff ff       	call   800b81 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801feb:	8b 43 04             	mov    0x4(%ebx),%eax
+  801fee:	8b 0b                	mov    (%ebx),%ecx
+  801ff0:	8d 51 20             	lea    0x20(%ecx),%edx
+  801ff3:	39 d0                	cmp    %edx,%eax
+  801ff5:	72 1a                	jb     802011 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  801ff7:	89 da                	mov    %ebx,%edx
+  801ff9:	89 f0                	mov    %esi,%eax
+  801ffb:	e8 5c ff ff ff       	call   801f5c <_pipeisclosed>
+  802000:	85 c0                	test   %eax,%eax
+  802002:	74 e2                	je     801fe6 <devpipe_write+0x25>
+				return 0;
+  802004:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802009:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80200c:	5b                   	pop    %ebx
+  80200d:	5e                   	pop    %esi
+  80200e:	5f                   	pop    %edi
+  80200f:	5d                   	pop    %ebp
+  802010:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802011:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802014:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802018:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  80201b:	89 c2                	mov    %eax,%edx
+  80201d:	c1 fa 1f             	sar    $0x1f,%edx
+  802020:	89 d1                	mov    %edx,%ecx
+  802022:	c1 e9 1b             	shr    $0x1b,%ecx
+  802025:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802028:	83 e2 1f             	and    $0x1f,%edx
+  80202b:	29 ca                	sub    %ecx,%edx
+  80202d:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802031:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802035:	83 c0 01             	add    $0x1,%eax
+  802038:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  80203b:	83 c7 01             	add    $0x1,%edi
+  80203e:	eb 9d                	jmp    801fdd <devpipe_write+0x1c>
+
+00802040 <devpipe_read>:
+{
+  802040:	55                   	push   %ebp
+  802041:	89 e5                	mov    %esp,%ebp
+  802043:	57                   	push   %edi
+  802044:	56                   	push   %esi
+  802045:	53                   	push   %ebx
+  802046:	83 ec 18             	sub    $0x18,%esp
+  802049:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  80204c:	57                   	push   %edi
+  80204d:	e8 4f f2 ff ff       	call   8012a1 <fd2data>
+  802052:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802054:	83 c4 10             	add    $0x10,%esp
+  802057:	be 00 00 00 00       	mov    $0x0,%esi
+  80205c:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80205f:	75 13                	jne    802074 <devpipe_read+0x34>
+	return i;
+  802061:	89 f0                	mov    %esi,%eax
+  802063:	eb 02                	jmp    802067 <devpipe_read+0x27>
+				return i;
+  802065:	89 f0                	mov    %esi,%eax
+}
+  802067:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80206a:	5b                   	pop    %ebx
+  80206b:	5e                   	pop    %esi
+  80206c:	5f                   	pop    %edi
+  80206d:	5d                   	pop    %ebp
+  80206e:	c3                   	ret
+			sys_yield();
+  80206f:	e8 0d eb ff ff       	call   800b81 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802074:	8b 03                	mov    (%ebx),%eax
+  802076:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802079:	75 18                	jne    802093 <devpipe_read+0x53>
+			if (i > 0)
+  80207b:	85 f6                	test   %esi,%esi
+  80207d:	75 e6                	jne    802065 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  80207f:	89 da                	mov    %ebx,%edx
+  802081:	89 f8                	mov    %edi,%eax
+  802083:	e8 d4 fe ff ff       	call   801f5c <_pipeisclosed>
+  802088:	85 c0                	test   %eax,%eax
+  80208a:	74 e3                	je     80206f <devpipe_read+0x2f>
+				return 0;
+  80208c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802091:	eb d4                	jmp    802067 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802093:	99                   	cltd
+  802094:	c1 ea 1b             	shr    $0x1b,%edx
+  802097:	01 d0                	add    %edx,%eax
+  802099:	83 e0 1f             	and    $0x1f,%eax
+  80209c:	29 d0                	sub    %edx,%eax
+  80209e:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8020a3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8020a6:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8020a9:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8020ac:	83 c6 01             	add    $0x1,%esi
+  8020af:	eb ab                	jmp    80205c <devpipe_read+0x1c>
+
+008020b1 <pipe>:
+{
+  8020b1:	55                   	push   %ebp
+  8020b2:	89 e5                	mov    %esp,%ebp
+  8020b4:	56                   	push   %esi
+  8020b5:	53                   	push   %ebx
+  8020b6:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8020b9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020bc:	50                   	push   %eax
+  8020bd:	e8 f6 f1 ff ff       	call   8012b8 <fd_alloc>
+  8020c2:	89 c3                	mov    %eax,%ebx
+  8020c4:	83 c4 10             	add    $0x10,%esp
+  8020c7:	85 c0                	test   %eax,%eax
+  8020c9:	0f 88 23 01 00 00    	js     8021f2 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8020cf:	83 ec 04             	sub    $0x4,%esp
+  8020d2:	68 07 04 00 00       	push   $0x407
+  8020d7:	ff 75 f4             	push   -0xc(%ebp)
+  8020da:	6a 00                	push   $0x0
+  8020dc:	e8 bf ea ff ff       	call   800ba0 <sys_page_alloc>
+  8020e1:	89 c3                	mov    %eax,%ebx
+  8020e3:	83 c4 10             	add    $0x10,%esp
+  8020e6:	85 c0                	test   %eax,%eax
+  8020e8:	0f 88 04 01 00 00    	js     8021f2 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8020ee:	83 ec 0c             	sub    $0xc,%esp
+  8020f1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8020f4:	50                   	push   %eax
+  8020f5:	e8 be f1 ff ff       	call   8012b8 <fd_alloc>
+  8020fa:	89 c3                	mov    %eax,%ebx
+  8020fc:	83 c4 10             	add    $0x10,%esp
+  8020ff:	85 c0                	test   %eax,%eax
+  802101:	0f 88 db 00 00 00    	js     8021e2 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802107:	83 ec 04             	sub    $0x4,%esp
+  80210a:	68 07 04 00 00       	push   $0x407
+  80210f:	ff 75 f0             	push   -0x10(%ebp)
+  802112:	6a 00                	push   $0x0
+  802114:	e8 87 ea ff ff       	call   800ba0 <sys_page_alloc>
+  802119:	89 c3                	mov    %eax,%ebx
+  80211b:	83 c4 10             	add    $0x10,%esp
+  80211e:	85 c0                	test   %eax,%eax
+  802120:	0f 88 bc 00 00 00    	js     8021e2 <pipe+0x131>
+	va = fd2data(fd0);
+  802126:	83 ec 0c             	sub    $0xc,%esp
+  802129:	ff 75 f4             	push   -0xc(%ebp)
+  80212c:	e8 70 f1 ff ff       	call   8012a1 <fd2data>
+  802131:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802133:	83 c4 0c             	add    $0xc,%esp
+  802136:	68 07 04 00 00       	push   $0x407
+  80213b:	50                   	push   %eax
+  80213c:	6a 00                	push   $0x0
+  80213e:	e8 5d ea ff ff       	call   800ba0 <sys_page_alloc>
+  802143:	89 c3                	mov    %eax,%ebx
+  802145:	83 c4 10             	add    $0x10,%esp
+  802148:	85 c0                	test   %eax,%eax
+  80214a:	0f 88 82 00 00 00    	js     8021d2 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802150:	83 ec 0c             	sub    $0xc,%esp
+  802153:	ff 75 f0             	push   -0x10(%ebp)
+  802156:	e8 46 f1 ff ff       	call   8012a1 <fd2data>
+  80215b:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802162:	50                   	push   %eax
+  802163:	6a 00                	push   $0x0
+  802165:	56                   	push   %esi
+  802166:	6a 00                	push   $0x0
+  802168:	e8 76 ea ff ff       	call   800be3 <sys_page_map>
+  80216d:	89 c3                	mov    %eax,%ebx
+  80216f:	83 c4 20             	add    $0x20,%esp
+  802172:	85 c0                	test   %eax,%eax
+  802174:	78 4e                	js     8021c4 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802176:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  80217b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80217e:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802180:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802183:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80218a:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80218d:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80218f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802192:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802199:	83 ec 0c             	sub    $0xc,%esp
+  80219c:	ff 75 f4             	push   -0xc(%ebp)
+  80219f:	e8 ed f0 ff ff       	call   801291 <fd2num>
+  8021a4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8021a7:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8021a9:	83 c4 04             	add    $0x4,%esp
+  8021ac:	ff 75 f0             	push   -0x10(%ebp)
+  8021af:	e8 dd f0 ff ff       	call   801291 <fd2num>
+  8021b4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8021b7:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8021ba:	83 c4 10             	add    $0x10,%esp
+  8021bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8021c2:	eb 2e                	jmp    8021f2 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8021c4:	83 ec 08             	sub    $0x8,%esp
+  8021c7:	56                   	push   %esi
+  8021c8:	6a 00                	push   $0x0
+  8021ca:	e8 56 ea ff ff       	call   800c25 <sys_page_unmap>
+  8021cf:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8021d2:	83 ec 08             	sub    $0x8,%esp
+  8021d5:	ff 75 f0             	push   -0x10(%ebp)
+  8021d8:	6a 00                	push   $0x0
+  8021da:	e8 46 ea ff ff       	call   800c25 <sys_page_unmap>
+  8021df:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8021e2:	83 ec 08             	sub    $0x8,%esp
+  8021e5:	ff 75 f4             	push   -0xc(%ebp)
+  8021e8:	6a 00                	push   $0x0
+  8021ea:	e8 36 ea ff ff       	call   800c25 <sys_page_unmap>
+  8021ef:	83 c4 10             	add    $0x10,%esp
+}
+  8021f2:	89 d8                	mov    %ebx,%eax
+  8021f4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021f7:	5b                   	pop    %ebx
+  8021f8:	5e                   	pop    %esi
+  8021f9:	5d                   	pop    %ebp
+  8021fa:	c3                   	ret
+
+008021fb <pipeisclosed>:
+{
+  8021fb:	55                   	push   %ebp
+  8021fc:	89 e5                	mov    %esp,%ebp
+  8021fe:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802201:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802204:	50                   	push   %eax
+  802205:	ff 75 08             	push   0x8(%ebp)
+  802208:	e8 01 f1 ff ff       	call   80130e <fd_lookup>
+  80220d:	83 c4 10             	add    $0x10,%esp
+  802210:	85 c0                	test   %eax,%eax
+  802212:	78 18                	js     80222c <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802214:	83 ec 0c             	sub    $0xc,%esp
+  802217:	ff 75 f4             	push   -0xc(%ebp)
+  80221a:	e8 82 f0 ff ff       	call   8012a1 <fd2data>
+  80221f:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802221:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802224:	e8 33 fd ff ff       	call   801f5c <_pipeisclosed>
+  802229:	83 c4 10             	add    $0x10,%esp
+}
+  80222c:	c9                   	leave
+  80222d:	c3                   	ret
+
+0080222e <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80222e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802233:	c3                   	ret
+
+00802234 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802234:	55                   	push   %ebp
+  802235:	89 e5                	mov    %esp,%ebp
+  802237:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80223a:	68 2f 2f 80 00       	push   $0x802f2f
+  80223f:	ff 75 0c             	push   0xc(%ebp)
+  802242:	e8 6d e5 ff ff       	call   8007b4 <strcpy>
+	return 0;
+}
+  802247:	b8 00 00 00 00       	mov    $0x0,%eax
+  80224c:	c9                   	leave
+  80224d:	c3                   	ret
+
+0080224e <devcons_write>:
+{
+  80224e:	55                   	push   %ebp
+  80224f:	89 e5                	mov    %esp,%ebp
+  802251:	57                   	push   %edi
+  802252:	56                   	push   %esi
+  802253:	53                   	push   %ebx
+  802254:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80225a:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80225f:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802265:	eb 2e                	jmp    802295 <devcons_write+0x47>
+		m = n - tot;
+  802267:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80226a:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80226c:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802271:	39 c3                	cmp    %eax,%ebx
+  802273:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802276:	83 ec 04             	sub    $0x4,%esp
+  802279:	53                   	push   %ebx
+  80227a:	89 f0                	mov    %esi,%eax
+  80227c:	03 45 0c             	add    0xc(%ebp),%eax
+  80227f:	50                   	push   %eax
+  802280:	57                   	push   %edi
+  802281:	e8 b4 e6 ff ff       	call   80093a <memmove>
+		sys_cputs(buf, m);
+  802286:	83 c4 08             	add    $0x8,%esp
+  802289:	53                   	push   %ebx
+  80228a:	57                   	push   %edi
+  80228b:	e8 54 e8 ff ff       	call   800ae4 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802290:	01 de                	add    %ebx,%esi
+  802292:	83 c4 10             	add    $0x10,%esp
+  802295:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802298:	72 cd                	jb     802267 <devcons_write+0x19>
+}
+  80229a:	89 f0                	mov    %esi,%eax
+  80229c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80229f:	5b                   	pop    %ebx
+  8022a0:	5e                   	pop    %esi
+  8022a1:	5f                   	pop    %edi
+  8022a2:	5d                   	pop    %ebp
+  8022a3:	c3                   	ret
+
+008022a4 <devcons_read>:
+{
+  8022a4:	55                   	push   %ebp
+  8022a5:	89 e5                	mov    %esp,%ebp
+  8022a7:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8022aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022af:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8022b3:	75 07                	jne    8022bc <devcons_read+0x18>
+  8022b5:	eb 1f                	jmp    8022d6 <devcons_read+0x32>
+		sys_yield();
+  8022b7:	e8 c5 e8 ff ff       	call   800b81 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8022bc:	e8 41 e8 ff ff       	call   800b02 <sys_cgetc>
+  8022c1:	85 c0                	test   %eax,%eax
+  8022c3:	74 f2                	je     8022b7 <devcons_read+0x13>
+	if (c < 0)
+  8022c5:	78 0f                	js     8022d6 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8022c7:	83 f8 04             	cmp    $0x4,%eax
+  8022ca:	74 0c                	je     8022d8 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8022cc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8022cf:	88 02                	mov    %al,(%edx)
+	return 1;
+  8022d1:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8022d6:	c9                   	leave
+  8022d7:	c3                   	ret
+		return 0;
+  8022d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022dd:	eb f7                	jmp    8022d6 <devcons_read+0x32>
+
+008022df <cputchar>:
+{
+  8022df:	55                   	push   %ebp
+  8022e0:	89 e5                	mov    %esp,%ebp
+  8022e2:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8022e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022e8:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8022eb:	6a 01                	push   $0x1
+  8022ed:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8022f0:	50                   	push   %eax
+  8022f1:	e8 ee e7 ff ff       	call   800ae4 <sys_cputs>
+}
+  8022f6:	83 c4 10             	add    $0x10,%esp
+  8022f9:	c9                   	leave
+  8022fa:	c3                   	ret
+
+008022fb <getchar>:
+{
+  8022fb:	55                   	push   %ebp
+  8022fc:	89 e5                	mov    %esp,%ebp
+  8022fe:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802301:	6a 01                	push   $0x1
+  802303:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802306:	50                   	push   %eax
+  802307:	6a 00                	push   $0x0
+  802309:	e8 66 f2 ff ff       	call   801574 <read>
+	if (r < 0)
+  80230e:	83 c4 10             	add    $0x10,%esp
+  802311:	85 c0                	test   %eax,%eax
+  802313:	78 06                	js     80231b <getchar+0x20>
+	if (r < 1)
+  802315:	74 06                	je     80231d <getchar+0x22>
+	return c;
+  802317:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80231b:	c9                   	leave
+  80231c:	c3                   	ret
+		return -E_EOF;
+  80231d:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802322:	eb f7                	jmp    80231b <getchar+0x20>
+
+00802324 <iscons>:
+{
+  802324:	55                   	push   %ebp
+  802325:	89 e5                	mov    %esp,%ebp
+  802327:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80232a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80232d:	50                   	push   %eax
+  80232e:	ff 75 08             	push   0x8(%ebp)
+  802331:	e8 d8 ef ff ff       	call   80130e <fd_lookup>
+  802336:	83 c4 10             	add    $0x10,%esp
+  802339:	85 c0                	test   %eax,%eax
+  80233b:	78 11                	js     80234e <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80233d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802340:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  802346:	39 10                	cmp    %edx,(%eax)
+  802348:	0f 94 c0             	sete   %al
+  80234b:	0f b6 c0             	movzbl %al,%eax
+}
+  80234e:	c9                   	leave
+  80234f:	c3                   	ret
+
+00802350 <opencons>:
+{
+  802350:	55                   	push   %ebp
+  802351:	89 e5                	mov    %esp,%ebp
+  802353:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802356:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802359:	50                   	push   %eax
+  80235a:	e8 59 ef ff ff       	call   8012b8 <fd_alloc>
+  80235f:	83 c4 10             	add    $0x10,%esp
+  802362:	85 c0                	test   %eax,%eax
+  802364:	78 3a                	js     8023a0 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802366:	83 ec 04             	sub    $0x4,%esp
+  802369:	68 07 04 00 00       	push   $0x407
+  80236e:	ff 75 f4             	push   -0xc(%ebp)
+  802371:	6a 00                	push   $0x0
+  802373:	e8 28 e8 ff ff       	call   800ba0 <sys_page_alloc>
+  802378:	83 c4 10             	add    $0x10,%esp
+  80237b:	85 c0                	test   %eax,%eax
+  80237d:	78 21                	js     8023a0 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80237f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802382:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  802388:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80238a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80238d:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802394:	83 ec 0c             	sub    $0xc,%esp
+  802397:	50                   	push   %eax
+  802398:	e8 f4 ee ff ff       	call   801291 <fd2num>
+  80239d:	83 c4 10             	add    $0x10,%esp
+}
+  8023a0:	c9                   	leave
+  8023a1:	c3                   	ret
+
+008023a2 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8023a2:	55                   	push   %ebp
+  8023a3:	89 e5                	mov    %esp,%ebp
+  8023a5:	56                   	push   %esi
+  8023a6:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8023a7:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8023aa:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  8023b0:	e8 ad e7 ff ff       	call   800b62 <sys_getenvid>
+  8023b5:	83 ec 0c             	sub    $0xc,%esp
+  8023b8:	ff 75 0c             	push   0xc(%ebp)
+  8023bb:	ff 75 08             	push   0x8(%ebp)
+  8023be:	56                   	push   %esi
+  8023bf:	50                   	push   %eax
+  8023c0:	68 3c 2f 80 00       	push   $0x802f3c
+  8023c5:	e8 31 de ff ff       	call   8001fb <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8023ca:	83 c4 18             	add    $0x18,%esp
+  8023cd:	53                   	push   %ebx
+  8023ce:	ff 75 10             	push   0x10(%ebp)
+  8023d1:	e8 d4 dd ff ff       	call   8001aa <vcprintf>
+	cprintf("\n");
+  8023d6:	c7 04 24 28 2f 80 00 	movl   $0x802f28,(%esp)
+  8023dd:	e8 19 de ff ff       	call   8001fb <cprintf>
+  8023e2:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8023e5:	cc                   	int3
+	while (1)
+  8023e6:	eb fd                	jmp    8023e5 <_panic+0x43>
+
+008023e8 <set_pgfault_handler>:
+// allocate an exception stack (one page of memory with its top
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf)) {
+  8023e8:	55                   	push   %ebp
+  8023e9:	89 e5                	mov    %esp,%ebp
+  8023eb:	83 ec 08             	sub    $0x8,%esp
+  int r;
+
+  if (_pgfault_handler == 0) {
+  8023ee:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  8023f5:	74 0a                	je     802401 <set_pgfault_handler+0x19>
+    if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)))
+      panic(" set_pgfault_handler sys_env_set_pgfault_upcall panic: %e\n", r);
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  8023f7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023fa:	a3 00 70 80 00       	mov    %eax,0x807000
+
+
+}
+  8023ff:	c9                   	leave
+  802400:	c3                   	ret
+    if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)))
+  802401:	83 ec 04             	sub    $0x4,%esp
+  802404:	6a 07                	push   $0x7
+  802406:	68 00 f0 bf ee       	push   $0xeebff000
+  80240b:	6a 00                	push   $0x0
+  80240d:	e8 8e e7 ff ff       	call   800ba0 <sys_page_alloc>
+  802412:	83 c4 10             	add    $0x10,%esp
+  802415:	85 c0                	test   %eax,%eax
+  802417:	75 28                	jne    802441 <set_pgfault_handler+0x59>
+    if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)))
+  802419:	83 ec 08             	sub    $0x8,%esp
+  80241c:	68 53 24 80 00       	push   $0x802453
+  802421:	6a 00                	push   $0x0
+  802423:	e8 c3 e8 ff ff       	call   800ceb <sys_env_set_pgfault_upcall>
+  802428:	83 c4 10             	add    $0x10,%esp
+  80242b:	85 c0                	test   %eax,%eax
+  80242d:	74 c8                	je     8023f7 <set_pgfault_handler+0xf>
+      panic(" set_pgfault_handler sys_env_set_pgfault_upcall panic: %e\n", r);
+  80242f:	50                   	push   %eax
+  802430:	68 90 2f 80 00       	push   $0x802f90
+  802435:	6a 22                	push   $0x22
+  802437:	68 cb 2f 80 00       	push   $0x802fcb
+  80243c:	e8 61 ff ff ff       	call   8023a2 <_panic>
+      panic("set_pgfault_handler sys_page_alloc panic: %e\n", r);
+  802441:	50                   	push   %eax
+  802442:	68 60 2f 80 00       	push   $0x802f60
+  802447:	6a 20                	push   $0x20
+  802449:	68 cb 2f 80 00       	push   $0x802fcb
+  80244e:	e8 4f ff ff ff       	call   8023a2 <_panic>
+
+00802453 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  802453:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  802454:	a1 00 70 80 00       	mov    0x807000,%eax
+	call *%eax
+  802459:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80245b:	83 c4 04             	add    $0x4,%esp
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	// push the trap-time %eip onto the trap-time stack
+    subl $0x4, 0x30(%esp) # for push eip
+  80245e:	83 6c 24 30 04       	subl   $0x4,0x30(%esp)
+    movl 0x30(%esp), %ebx #regular esp
+  802463:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+    movl 0x28(%esp), %eax #eip
+  802467:	8b 44 24 28          	mov    0x28(%esp),%eax
+    movl %eax, (%ebx)
+  80246b:	89 03                	mov    %eax,(%ebx)
+
+    // Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+    addl $8, %esp
+  80246d:	83 c4 08             	add    $0x8,%esp
+    popal
+  802470:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  802471:	83 c4 04             	add    $0x4,%esp
+	popfl
+  802474:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  802475:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  802476:	c3                   	ret
+
+00802477 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802477:	55                   	push   %ebp
+  802478:	89 e5                	mov    %esp,%ebp
+  80247a:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80247d:	89 c2                	mov    %eax,%edx
+  80247f:	c1 ea 16             	shr    $0x16,%edx
+  802482:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802489:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80248e:	f6 c1 01             	test   $0x1,%cl
+  802491:	74 1c                	je     8024af <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  802493:	c1 e8 0c             	shr    $0xc,%eax
+  802496:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80249d:	a8 01                	test   $0x1,%al
+  80249f:	74 0e                	je     8024af <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8024a1:	c1 e8 0c             	shr    $0xc,%eax
+  8024a4:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  8024ab:	ef 
+  8024ac:	0f b7 d2             	movzwl %dx,%edx
+}
+  8024af:	89 d0                	mov    %edx,%eax
+  8024b1:	5d                   	pop    %ebp
+  8024b2:	c3                   	ret
+  8024b3:	66 90                	xchg   %ax,%ax
+  8024b5:	66 90                	xchg   %ax,%ax
+  8024b7:	66 90                	xchg   %ax,%ax
+  8024b9:	66 90                	xchg   %ax,%ax
+  8024bb:	66 90                	xchg   %ax,%ax
+  8024bd:	66 90                	xchg   %ax,%ax
+  8024bf:	90                   	nop
+
+008024c0 <__udivmoddi4>:
+  8024c0:	55                   	push   %ebp
+  8024c1:	57                   	push   %edi
+  8024c2:	56                   	push   %esi
+  8024c3:	53                   	push   %ebx
+  8024c4:	83 ec 24             	sub    $0x24,%esp
+  8024c7:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8024cb:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8024cf:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  8024d3:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8024d7:	8b 54 24 44          	mov    0x44(%esp),%edx
+  8024db:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8024df:	8b 44 24 40          	mov    0x40(%esp),%eax
+  8024e3:	89 d3                	mov    %edx,%ebx
+  8024e5:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8024e9:	09 c3                	or     %eax,%ebx
+  8024eb:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8024ef:	0f 84 9c 00 00 00    	je     802591 <__udivmoddi4+0xd1>
+  8024f5:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8024fc:	00 
+  8024fd:	31 c0                	xor    %eax,%eax
+  8024ff:	31 d2                	xor    %edx,%edx
+  802501:	89 fb                	mov    %edi,%ebx
+  802503:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80250a:	00 
+  80250b:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802510:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802514:	01 c0                	add    %eax,%eax
+  802516:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80251d:	00 
+  80251e:	89 c6                	mov    %eax,%esi
+  802520:	89 d7                	mov    %edx,%edi
+  802522:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802526:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80252a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80252d:	d3 ea                	shr    %cl,%edx
+  80252f:	f6 c1 20             	test   $0x20,%cl
+  802532:	0f 45 c2             	cmovne %edx,%eax
+  802535:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802539:	83 e0 01             	and    $0x1,%eax
+  80253c:	09 fa                	or     %edi,%edx
+  80253e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802542:	89 04 24             	mov    %eax,(%esp)
+  802545:	8b 04 24             	mov    (%esp),%eax
+  802548:	89 d5                	mov    %edx,%ebp
+  80254a:	09 f0                	or     %esi,%eax
+  80254c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802550:	39 f0                	cmp    %esi,%eax
+  802552:	19 fd                	sbb    %edi,%ebp
+  802554:	72 1d                	jb     802573 <__udivmoddi4+0xb3>
+  802556:	29 f0                	sub    %esi,%eax
+  802558:	19 fa                	sbb    %edi,%edx
+  80255a:	89 cf                	mov    %ecx,%edi
+  80255c:	c1 ef 05             	shr    $0x5,%edi
+  80255f:	83 e7 01             	and    $0x1,%edi
+  802562:	89 fe                	mov    %edi,%esi
+  802564:	d3 e7                	shl    %cl,%edi
+  802566:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80256a:	83 f6 01             	xor    $0x1,%esi
+  80256d:	d3 e6                	shl    %cl,%esi
+  80256f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802573:	83 e9 01             	sub    $0x1,%ecx
+  802576:	73 98                	jae    802510 <__udivmoddi4+0x50>
+  802578:	85 db                	test   %ebx,%ebx
+  80257a:	74 05                	je     802581 <__udivmoddi4+0xc1>
+  80257c:	89 03                	mov    %eax,(%ebx)
+  80257e:	89 53 04             	mov    %edx,0x4(%ebx)
+  802581:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802585:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802589:	83 c4 24             	add    $0x24,%esp
+  80258c:	5b                   	pop    %ebx
+  80258d:	5e                   	pop    %esi
+  80258e:	5f                   	pop    %edi
+  80258f:	5d                   	pop    %ebp
+  802590:	c3                   	ret
+  802591:	85 ff                	test   %edi,%edi
+  802593:	74 0d                	je     8025a2 <__udivmoddi4+0xe2>
+  802595:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  80259b:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  8025a2:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8025a6:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8025aa:	89 44 24 18          	mov    %eax,0x18(%esp)
+  8025ae:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8025b2:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  8025b6:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8025ba:	83 c4 24             	add    $0x24,%esp
+  8025bd:	5b                   	pop    %ebx
+  8025be:	5e                   	pop    %esi
+  8025bf:	5f                   	pop    %edi
+  8025c0:	5d                   	pop    %ebp
+  8025c1:	c3                   	ret
+  8025c2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8025c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+008025d0 <__udivdi3>:
+  8025d0:	57                   	push   %edi
+  8025d1:	56                   	push   %esi
+  8025d2:	53                   	push   %ebx
+  8025d3:	83 ec 20             	sub    $0x20,%esp
+  8025d6:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8025da:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8025de:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8025e2:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8025e6:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8025ea:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8025ee:	89 d1                	mov    %edx,%ecx
+  8025f0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8025f4:	09 c1                	or     %eax,%ecx
+  8025f6:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8025fa:	89 44 24 18          	mov    %eax,0x18(%esp)
+  8025fe:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802602:	0f 84 88 00 00 00    	je     802690 <__udivdi3+0xc0>
+  802608:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80260f:	00 
+  802610:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802615:	31 c0                	xor    %eax,%eax
+  802617:	31 d2                	xor    %edx,%edx
+  802619:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802620:	00 
+  802621:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802628:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80262c:	01 c0                	add    %eax,%eax
+  80262e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802635:	00 
+  802636:	89 c6                	mov    %eax,%esi
+  802638:	89 d7                	mov    %edx,%edi
+  80263a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80263e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802642:	0f ad d0             	shrd   %cl,%edx,%eax
+  802645:	d3 ea                	shr    %cl,%edx
+  802647:	f6 c1 20             	test   $0x20,%cl
+  80264a:	0f 45 c2             	cmovne %edx,%eax
+  80264d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802651:	83 e0 01             	and    $0x1,%eax
+  802654:	09 fa                	or     %edi,%edx
+  802656:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80265a:	89 04 24             	mov    %eax,(%esp)
+  80265d:	8b 04 24             	mov    (%esp),%eax
+  802660:	89 d3                	mov    %edx,%ebx
+  802662:	09 f0                	or     %esi,%eax
+  802664:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802668:	39 f0                	cmp    %esi,%eax
+  80266a:	19 fb                	sbb    %edi,%ebx
+  80266c:	72 1d                	jb     80268b <__udivdi3+0xbb>
+  80266e:	29 f0                	sub    %esi,%eax
+  802670:	19 fa                	sbb    %edi,%edx
+  802672:	89 cf                	mov    %ecx,%edi
+  802674:	c1 ef 05             	shr    $0x5,%edi
+  802677:	83 e7 01             	and    $0x1,%edi
+  80267a:	89 fe                	mov    %edi,%esi
+  80267c:	d3 e7                	shl    %cl,%edi
+  80267e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802682:	83 f6 01             	xor    $0x1,%esi
+  802685:	d3 e6                	shl    %cl,%esi
+  802687:	09 74 24 18          	or     %esi,0x18(%esp)
+  80268b:	83 e9 01             	sub    $0x1,%ecx
+  80268e:	73 98                	jae    802628 <__udivdi3+0x58>
+  802690:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802694:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802698:	83 c4 20             	add    $0x20,%esp
+  80269b:	5b                   	pop    %ebx
+  80269c:	5e                   	pop    %esi
+  80269d:	5f                   	pop    %edi
+  80269e:	c3                   	ret
+  80269f:	90                   	nop
+
+008026a0 <__umoddi3>:
+  8026a0:	57                   	push   %edi
+  8026a1:	56                   	push   %esi
+  8026a2:	53                   	push   %ebx
+  8026a3:	83 ec 18             	sub    $0x18,%esp
+  8026a6:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8026aa:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8026ae:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8026b2:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8026b6:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8026ba:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8026be:	89 d1                	mov    %edx,%ecx
+  8026c0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8026c4:	09 c1                	or     %eax,%ecx
+  8026c6:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8026ca:	74 5b                	je     802727 <__umoddi3+0x87>
+  8026cc:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8026d1:	31 c0                	xor    %eax,%eax
+  8026d3:	31 d2                	xor    %edx,%edx
+  8026d5:	8d 76 00             	lea    0x0(%esi),%esi
+  8026d8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8026dc:	01 c0                	add    %eax,%eax
+  8026de:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8026e5:	00 
+  8026e6:	89 c6                	mov    %eax,%esi
+  8026e8:	89 d7                	mov    %edx,%edi
+  8026ea:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8026ee:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8026f2:	0f ad d0             	shrd   %cl,%edx,%eax
+  8026f5:	d3 ea                	shr    %cl,%edx
+  8026f7:	f6 c1 20             	test   $0x20,%cl
+  8026fa:	0f 45 c2             	cmovne %edx,%eax
+  8026fd:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802701:	83 e0 01             	and    $0x1,%eax
+  802704:	09 fa                	or     %edi,%edx
+  802706:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80270a:	89 04 24             	mov    %eax,(%esp)
+  80270d:	8b 04 24             	mov    (%esp),%eax
+  802710:	89 d3                	mov    %edx,%ebx
+  802712:	09 f0                	or     %esi,%eax
+  802714:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802718:	39 f0                	cmp    %esi,%eax
+  80271a:	19 fb                	sbb    %edi,%ebx
+  80271c:	72 04                	jb     802722 <__umoddi3+0x82>
+  80271e:	29 f0                	sub    %esi,%eax
+  802720:	19 fa                	sbb    %edi,%edx
+  802722:	83 e9 01             	sub    $0x1,%ecx
+  802725:	73 b1                	jae    8026d8 <__umoddi3+0x38>
+  802727:	83 c4 18             	add    $0x18,%esp
+  80272a:	5b                   	pop    %ebx
+  80272b:	5e                   	pop    %esi
+  80272c:	5f                   	pop    %edi
+  80272d:	c3                   	ret
+  80272e:	66 90                	xchg   %ax,%ax
+
+00802730 <__divdi3>:
+  802730:	55                   	push   %ebp
+  802731:	57                   	push   %edi
+  802732:	56                   	push   %esi
+  802733:	53                   	push   %ebx
+  802734:	83 ec 24             	sub    $0x24,%esp
+  802737:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  80273b:	8b 74 24 44          	mov    0x44(%esp),%esi
+  80273f:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802743:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802747:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  80274b:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  80274f:	85 d2                	test   %edx,%edx
+  802751:	0f 88 e0 00 00 00    	js     802837 <__divdi3+0x107>
+  802757:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  80275b:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  80275f:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802763:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802767:	85 f6                	test   %esi,%esi
+  802769:	78 16                	js     802781 <__divdi3+0x51>
+  80276b:	89 f1                	mov    %esi,%ecx
+  80276d:	31 c0                	xor    %eax,%eax
+  80276f:	31 d2                	xor    %edx,%edx
+  802771:	09 d9                	or     %ebx,%ecx
+  802773:	0f 85 f3 00 00 00    	jne    80286c <__divdi3+0x13c>
+  802779:	83 c4 24             	add    $0x24,%esp
+  80277c:	5b                   	pop    %ebx
+  80277d:	5e                   	pop    %esi
+  80277e:	5f                   	pop    %edi
+  80277f:	5d                   	pop    %ebp
+  802780:	c3                   	ret
+  802781:	bf 01 00 00 00       	mov    $0x1,%edi
+  802786:	f7 5c 24 08          	negl   0x8(%esp)
+  80278a:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  80278f:	f7 5c 24 0c          	negl   0xc(%esp)
+  802793:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80279a:	00 
+  80279b:	31 c0                	xor    %eax,%eax
+  80279d:	31 d2                	xor    %edx,%edx
+  80279f:	89 fb                	mov    %edi,%ebx
+  8027a1:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8027a8:	00 
+  8027a9:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8027ae:	66 90                	xchg   %ax,%ax
+  8027b0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8027b4:	01 c0                	add    %eax,%eax
+  8027b6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8027bd:	00 
+  8027be:	89 c6                	mov    %eax,%esi
+  8027c0:	89 d7                	mov    %edx,%edi
+  8027c2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8027c6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8027ca:	0f ad d0             	shrd   %cl,%edx,%eax
+  8027cd:	d3 ea                	shr    %cl,%edx
+  8027cf:	f6 c1 20             	test   $0x20,%cl
+  8027d2:	0f 45 c2             	cmovne %edx,%eax
+  8027d5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8027d9:	83 e0 01             	and    $0x1,%eax
+  8027dc:	09 fa                	or     %edi,%edx
+  8027de:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8027e2:	89 04 24             	mov    %eax,(%esp)
+  8027e5:	8b 04 24             	mov    (%esp),%eax
+  8027e8:	89 d5                	mov    %edx,%ebp
+  8027ea:	09 f0                	or     %esi,%eax
+  8027ec:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8027f0:	39 f0                	cmp    %esi,%eax
+  8027f2:	19 fd                	sbb    %edi,%ebp
+  8027f4:	72 1d                	jb     802813 <__divdi3+0xe3>
+  8027f6:	29 f0                	sub    %esi,%eax
+  8027f8:	19 fa                	sbb    %edi,%edx
+  8027fa:	89 cf                	mov    %ecx,%edi
+  8027fc:	c1 ef 05             	shr    $0x5,%edi
+  8027ff:	83 e7 01             	and    $0x1,%edi
+  802802:	89 fe                	mov    %edi,%esi
+  802804:	d3 e7                	shl    %cl,%edi
+  802806:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80280a:	83 f6 01             	xor    $0x1,%esi
+  80280d:	d3 e6                	shl    %cl,%esi
+  80280f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802813:	83 e9 01             	sub    $0x1,%ecx
+  802816:	73 98                	jae    8027b0 <__divdi3+0x80>
+  802818:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80281c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802820:	85 db                	test   %ebx,%ebx
+  802822:	0f 84 51 ff ff ff    	je     802779 <__divdi3+0x49>
+  802828:	f7 d8                	neg    %eax
+  80282a:	83 d2 00             	adc    $0x0,%edx
+  80282d:	83 c4 24             	add    $0x24,%esp
+  802830:	5b                   	pop    %ebx
+  802831:	f7 da                	neg    %edx
+  802833:	5e                   	pop    %esi
+  802834:	5f                   	pop    %edi
+  802835:	5d                   	pop    %ebp
+  802836:	c3                   	ret
+  802837:	f7 d8                	neg    %eax
+  802839:	83 d2 00             	adc    $0x0,%edx
+  80283c:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802840:	f7 da                	neg    %edx
+  802842:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802846:	85 f6                	test   %esi,%esi
+  802848:	78 1b                	js     802865 <__divdi3+0x135>
+  80284a:	89 f1                	mov    %esi,%ecx
+  80284c:	31 c0                	xor    %eax,%eax
+  80284e:	31 d2                	xor    %edx,%edx
+  802850:	bf 01 00 00 00       	mov    $0x1,%edi
+  802855:	09 d9                	or     %ebx,%ecx
+  802857:	0f 85 36 ff ff ff    	jne    802793 <__divdi3+0x63>
+  80285d:	83 c4 24             	add    $0x24,%esp
+  802860:	5b                   	pop    %ebx
+  802861:	5e                   	pop    %esi
+  802862:	5f                   	pop    %edi
+  802863:	5d                   	pop    %ebp
+  802864:	c3                   	ret
+  802865:	31 ff                	xor    %edi,%edi
+  802867:	e9 1a ff ff ff       	jmp    802786 <__divdi3+0x56>
+  80286c:	31 ff                	xor    %edi,%edi
+  80286e:	e9 20 ff ff ff       	jmp    802793 <__divdi3+0x63>
+  802873:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80287a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00802880 <__moddi3>:
+  802880:	55                   	push   %ebp
+  802881:	57                   	push   %edi
+  802882:	56                   	push   %esi
+  802883:	53                   	push   %ebx
+  802884:	83 ec 1c             	sub    $0x1c,%esp
+  802887:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  80288b:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  80288f:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  802893:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  802897:	89 c8                	mov    %ecx,%eax
+  802899:	89 f2                	mov    %esi,%edx
+  80289b:	89 f3                	mov    %esi,%ebx
+  80289d:	85 ed                	test   %ebp,%ebp
+  80289f:	0f 88 9d 00 00 00    	js     802942 <__moddi3+0xc2>
+  8028a5:	09 cb                	or     %ecx,%ebx
+  8028a7:	0f 84 8d 00 00 00    	je     80293a <__moddi3+0xba>
+  8028ad:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  8028b1:	31 db                	xor    %ebx,%ebx
+  8028b3:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  8028b7:	89 ca                	mov    %ecx,%edx
+  8028b9:	89 f0                	mov    %esi,%eax
+  8028bb:	89 dd                	mov    %ebx,%ebp
+  8028bd:	f7 da                	neg    %edx
+  8028bf:	83 d0 00             	adc    $0x0,%eax
+  8028c2:	f7 d8                	neg    %eax
+  8028c4:	0f 49 f0             	cmovns %eax,%esi
+  8028c7:	0f 49 ca             	cmovns %edx,%ecx
+  8028ca:	31 c0                	xor    %eax,%eax
+  8028cc:	31 d2                	xor    %edx,%edx
+  8028ce:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8028d2:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  8028d6:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8028db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  8028df:	90                   	nop
+  8028e0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8028e4:	01 c0                	add    %eax,%eax
+  8028e6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8028ed:	00 
+  8028ee:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  8028f2:	89 c6                	mov    %eax,%esi
+  8028f4:	89 d7                	mov    %edx,%edi
+  8028f6:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8028fa:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8028fe:	0f ad d0             	shrd   %cl,%edx,%eax
+  802901:	d3 ea                	shr    %cl,%edx
+  802903:	f6 c1 20             	test   $0x20,%cl
+  802906:	0f 45 c2             	cmovne %edx,%eax
+  802909:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80290d:	83 e0 01             	and    $0x1,%eax
+  802910:	09 fa                	or     %edi,%edx
+  802912:	89 04 24             	mov    %eax,(%esp)
+  802915:	8b 04 24             	mov    (%esp),%eax
+  802918:	89 d7                	mov    %edx,%edi
+  80291a:	09 f0                	or     %esi,%eax
+  80291c:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  802920:	39 d8                	cmp    %ebx,%eax
+  802922:	19 f7                	sbb    %esi,%edi
+  802924:	72 04                	jb     80292a <__moddi3+0xaa>
+  802926:	29 d8                	sub    %ebx,%eax
+  802928:	19 f2                	sbb    %esi,%edx
+  80292a:	83 e9 01             	sub    $0x1,%ecx
+  80292d:	73 b1                	jae    8028e0 <__moddi3+0x60>
+  80292f:	85 ed                	test   %ebp,%ebp
+  802931:	74 07                	je     80293a <__moddi3+0xba>
+  802933:	f7 d8                	neg    %eax
+  802935:	83 d2 00             	adc    $0x0,%edx
+  802938:	f7 da                	neg    %edx
+  80293a:	83 c4 1c             	add    $0x1c,%esp
+  80293d:	5b                   	pop    %ebx
+  80293e:	5e                   	pop    %esi
+  80293f:	5f                   	pop    %edi
+  802940:	5d                   	pop    %ebp
+  802941:	c3                   	ret
+  802942:	09 cb                	or     %ecx,%ebx
+  802944:	74 f4                	je     80293a <__moddi3+0xba>
+  802946:	f7 df                	neg    %edi
+  802948:	bb 01 00 00 00       	mov    $0x1,%ebx
+  80294d:	83 d5 00             	adc    $0x0,%ebp
+  802950:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802954:	f7 dd                	neg    %ebp
+  802956:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  80295a:	e9 58 ff ff ff       	jmp    8028b7 <__moddi3+0x37>
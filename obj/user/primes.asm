@@ -0,0 +1,5818 @@
+
+obj/user/primes.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 c3 00 00 00       	call   8000f4 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <primeproc>:
+
+#include <inc/lib.h>
+
+unsigned
+primeproc(void)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 1c             	sub    $0x1c,%esp
+	int i, id, p;
+	envid_t envid;
+
+	// fetch a prime from our left neighbor
+top:
+	p = ipc_recv(&envid, 0, 0);
+  80003c:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  80003f:	83 ec 04             	sub    $0x4,%esp
+  800042:	6a 00                	push   $0x0
+  800044:	6a 00                	push   $0x0
+  800046:	56                   	push   %esi
+  800047:	e8 75 11 00 00       	call   8011c1 <ipc_recv>
+  80004c:	89 c3                	mov    %eax,%ebx
+	cprintf("CPU %d: %d ", thisenv->env_cpunum, p);
+  80004e:	a1 08 40 80 00       	mov    0x804008,%eax
+  800053:	8b 40 5c             	mov    0x5c(%eax),%eax
+  800056:	83 c4 0c             	add    $0xc,%esp
+  800059:	53                   	push   %ebx
+  80005a:	50                   	push   %eax
+  80005b:	68 60 29 80 00       	push   $0x802960
+  800060:	e8 cd 01 00 00       	call   800232 <cprintf>
+
+	// fork a right neighbor to continue the chain
+	if ((id = fork()) < 0)
+  800065:	e8 3b 0f 00 00       	call   800fa5 <fork>
+  80006a:	89 c7                	mov    %eax,%edi
+  80006c:	83 c4 10             	add    $0x10,%esp
+  80006f:	85 c0                	test   %eax,%eax
+  800071:	78 2e                	js     8000a1 <primeproc+0x6e>
+		panic("fork: %e", id);
+	if (id == 0)
+  800073:	74 ca                	je     80003f <primeproc+0xc>
+		goto top;
+
+	// filter out multiples of our prime
+	while (1) {
+		i = ipc_recv(&envid, 0, 0);
+  800075:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  800078:	83 ec 04             	sub    $0x4,%esp
+  80007b:	6a 00                	push   $0x0
+  80007d:	6a 00                	push   $0x0
+  80007f:	56                   	push   %esi
+  800080:	e8 3c 11 00 00       	call   8011c1 <ipc_recv>
+  800085:	89 c1                	mov    %eax,%ecx
+		if (i % p)
+  800087:	99                   	cltd
+  800088:	f7 fb                	idiv   %ebx
+  80008a:	83 c4 10             	add    $0x10,%esp
+  80008d:	85 d2                	test   %edx,%edx
+  80008f:	74 e7                	je     800078 <primeproc+0x45>
+			ipc_send(id, i, 0, 0);
+  800091:	6a 00                	push   $0x0
+  800093:	6a 00                	push   $0x0
+  800095:	51                   	push   %ecx
+  800096:	57                   	push   %edi
+  800097:	e8 99 11 00 00       	call   801235 <ipc_send>
+  80009c:	83 c4 10             	add    $0x10,%esp
+  80009f:	eb d7                	jmp    800078 <primeproc+0x45>
+		panic("fork: %e", id);
+  8000a1:	50                   	push   %eax
+  8000a2:	68 6c 29 80 00       	push   $0x80296c
+  8000a7:	6a 1a                	push   $0x1a
+  8000a9:	68 75 29 80 00       	push   $0x802975
+  8000ae:	e8 a4 00 00 00       	call   800157 <_panic>
+
+008000b3 <umain>:
+	}
+}
+
+void
+umain(int argc, char **argv)
+{
+  8000b3:	55                   	push   %ebp
+  8000b4:	89 e5                	mov    %esp,%ebp
+  8000b6:	56                   	push   %esi
+  8000b7:	53                   	push   %ebx
+	int i, id;
+
+	// fork the first prime process in the chain
+	if ((id = fork()) < 0)
+  8000b8:	e8 e8 0e 00 00       	call   800fa5 <fork>
+  8000bd:	89 c6                	mov    %eax,%esi
+  8000bf:	85 c0                	test   %eax,%eax
+  8000c1:	78 1a                	js     8000dd <umain+0x2a>
+		panic("fork: %e", id);
+	if (id == 0)
+		primeproc();
+
+	// feed all the integers through
+	for (i = 2; ; i++)
+  8000c3:	bb 02 00 00 00       	mov    $0x2,%ebx
+	if (id == 0)
+  8000c8:	74 25                	je     8000ef <umain+0x3c>
+		ipc_send(id, i, 0, 0);
+  8000ca:	6a 00                	push   $0x0
+  8000cc:	6a 00                	push   $0x0
+  8000ce:	53                   	push   %ebx
+  8000cf:	56                   	push   %esi
+  8000d0:	e8 60 11 00 00       	call   801235 <ipc_send>
+	for (i = 2; ; i++)
+  8000d5:	83 c3 01             	add    $0x1,%ebx
+  8000d8:	83 c4 10             	add    $0x10,%esp
+  8000db:	eb ed                	jmp    8000ca <umain+0x17>
+		panic("fork: %e", id);
+  8000dd:	50                   	push   %eax
+  8000de:	68 6c 29 80 00       	push   $0x80296c
+  8000e3:	6a 2d                	push   $0x2d
+  8000e5:	68 75 29 80 00       	push   $0x802975
+  8000ea:	e8 68 00 00 00       	call   800157 <_panic>
+		primeproc();
+  8000ef:	e8 3f ff ff ff       	call   800033 <primeproc>
+
+008000f4 <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  8000f4:	55                   	push   %ebp
+  8000f5:	89 e5                	mov    %esp,%ebp
+  8000f7:	56                   	push   %esi
+  8000f8:	53                   	push   %ebx
+  8000f9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000fc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  8000ff:	e8 95 0a 00 00       	call   800b99 <sys_getenvid>
+  800104:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800109:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80010c:	c1 e0 04             	shl    $0x4,%eax
+  80010f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800114:	a3 08 40 80 00       	mov    %eax,0x804008
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800119:	85 db                	test   %ebx,%ebx
+  80011b:	7e 07                	jle    800124 <libmain+0x30>
+    binaryname = argv[0];
+  80011d:	8b 06                	mov    (%esi),%eax
+  80011f:	a3 00 30 80 00       	mov    %eax,0x803000
+
+  // call user main routine
+  umain(argc, argv);
+  800124:	83 ec 08             	sub    $0x8,%esp
+  800127:	56                   	push   %esi
+  800128:	53                   	push   %ebx
+  800129:	e8 85 ff ff ff       	call   8000b3 <umain>
+
+  // exit gracefully
+  exit();
+  80012e:	e8 0a 00 00 00       	call   80013d <exit>
+}
+  800133:	83 c4 10             	add    $0x10,%esp
+  800136:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800139:	5b                   	pop    %ebx
+  80013a:	5e                   	pop    %esi
+  80013b:	5d                   	pop    %ebp
+  80013c:	c3                   	ret
+
+0080013d <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80013d:	55                   	push   %ebp
+  80013e:	89 e5                	mov    %esp,%ebp
+  800140:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800143:	e8 54 13 00 00       	call   80149c <close_all>
+	sys_env_destroy(0);
+  800148:	83 ec 0c             	sub    $0xc,%esp
+  80014b:	6a 00                	push   $0x0
+  80014d:	e8 06 0a 00 00       	call   800b58 <sys_env_destroy>
+}
+  800152:	83 c4 10             	add    $0x10,%esp
+  800155:	c9                   	leave
+  800156:	c3                   	ret
+
+00800157 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800157:	55                   	push   %ebp
+  800158:	89 e5                	mov    %esp,%ebp
+  80015a:	56                   	push   %esi
+  80015b:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80015c:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80015f:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  800165:	e8 2f 0a 00 00       	call   800b99 <sys_getenvid>
+  80016a:	83 ec 0c             	sub    $0xc,%esp
+  80016d:	ff 75 0c             	push   0xc(%ebp)
+  800170:	ff 75 08             	push   0x8(%ebp)
+  800173:	56                   	push   %esi
+  800174:	50                   	push   %eax
+  800175:	68 90 29 80 00       	push   $0x802990
+  80017a:	e8 b3 00 00 00       	call   800232 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80017f:	83 c4 18             	add    $0x18,%esp
+  800182:	53                   	push   %ebx
+  800183:	ff 75 10             	push   0x10(%ebp)
+  800186:	e8 56 00 00 00       	call   8001e1 <vcprintf>
+	cprintf("\n");
+  80018b:	c7 04 24 28 2f 80 00 	movl   $0x802f28,(%esp)
+  800192:	e8 9b 00 00 00       	call   800232 <cprintf>
+  800197:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80019a:	cc                   	int3
+	while (1)
+  80019b:	eb fd                	jmp    80019a <_panic+0x43>
+
+0080019d <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80019d:	55                   	push   %ebp
+  80019e:	89 e5                	mov    %esp,%ebp
+  8001a0:	53                   	push   %ebx
+  8001a1:	83 ec 04             	sub    $0x4,%esp
+  8001a4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8001a7:	8b 13                	mov    (%ebx),%edx
+  8001a9:	8d 42 01             	lea    0x1(%edx),%eax
+  8001ac:	89 03                	mov    %eax,(%ebx)
+  8001ae:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001b1:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8001b5:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001ba:	74 09                	je     8001c5 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001bc:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001c0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001c3:	c9                   	leave
+  8001c4:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8001c5:	83 ec 08             	sub    $0x8,%esp
+  8001c8:	68 ff 00 00 00       	push   $0xff
+  8001cd:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001d0:	50                   	push   %eax
+  8001d1:	e8 45 09 00 00       	call   800b1b <sys_cputs>
+		b->idx = 0;
+  8001d6:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001dc:	83 c4 10             	add    $0x10,%esp
+  8001df:	eb db                	jmp    8001bc <putch+0x1f>
+
+008001e1 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001e1:	55                   	push   %ebp
+  8001e2:	89 e5                	mov    %esp,%ebp
+  8001e4:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001ea:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001f1:	00 00 00 
+	b.cnt = 0;
+  8001f4:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001fb:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001fe:	ff 75 0c             	push   0xc(%ebp)
+  800201:	ff 75 08             	push   0x8(%ebp)
+  800204:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80020a:	50                   	push   %eax
+  80020b:	68 9d 01 80 00       	push   $0x80019d
+  800210:	e8 14 01 00 00       	call   800329 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800215:	83 c4 08             	add    $0x8,%esp
+  800218:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80021e:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800224:	50                   	push   %eax
+  800225:	e8 f1 08 00 00       	call   800b1b <sys_cputs>
+
+	return b.cnt;
+}
+  80022a:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800230:	c9                   	leave
+  800231:	c3                   	ret
+
+00800232 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800232:	55                   	push   %ebp
+  800233:	89 e5                	mov    %esp,%ebp
+  800235:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800238:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80023b:	50                   	push   %eax
+  80023c:	ff 75 08             	push   0x8(%ebp)
+  80023f:	e8 9d ff ff ff       	call   8001e1 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800244:	c9                   	leave
+  800245:	c3                   	ret
+
+00800246 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800246:	55                   	push   %ebp
+  800247:	89 e5                	mov    %esp,%ebp
+  800249:	57                   	push   %edi
+  80024a:	56                   	push   %esi
+  80024b:	53                   	push   %ebx
+  80024c:	83 ec 1c             	sub    $0x1c,%esp
+  80024f:	89 c7                	mov    %eax,%edi
+  800251:	89 d6                	mov    %edx,%esi
+  800253:	8b 45 08             	mov    0x8(%ebp),%eax
+  800256:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800259:	89 d1                	mov    %edx,%ecx
+  80025b:	89 c2                	mov    %eax,%edx
+  80025d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800260:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800263:	8b 45 10             	mov    0x10(%ebp),%eax
+  800266:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800269:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80026c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800273:	39 c2                	cmp    %eax,%edx
+  800275:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800278:	72 3e                	jb     8002b8 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80027a:	83 ec 0c             	sub    $0xc,%esp
+  80027d:	ff 75 18             	push   0x18(%ebp)
+  800280:	83 eb 01             	sub    $0x1,%ebx
+  800283:	53                   	push   %ebx
+  800284:	50                   	push   %eax
+  800285:	83 ec 08             	sub    $0x8,%esp
+  800288:	ff 75 e4             	push   -0x1c(%ebp)
+  80028b:	ff 75 e0             	push   -0x20(%ebp)
+  80028e:	ff 75 dc             	push   -0x24(%ebp)
+  800291:	ff 75 d8             	push   -0x28(%ebp)
+  800294:	e8 27 23 00 00       	call   8025c0 <__udivdi3>
+  800299:	83 c4 18             	add    $0x18,%esp
+  80029c:	52                   	push   %edx
+  80029d:	50                   	push   %eax
+  80029e:	89 f2                	mov    %esi,%edx
+  8002a0:	89 f8                	mov    %edi,%eax
+  8002a2:	e8 9f ff ff ff       	call   800246 <printnum>
+  8002a7:	83 c4 20             	add    $0x20,%esp
+  8002aa:	eb 13                	jmp    8002bf <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8002ac:	83 ec 08             	sub    $0x8,%esp
+  8002af:	56                   	push   %esi
+  8002b0:	ff 75 18             	push   0x18(%ebp)
+  8002b3:	ff d7                	call   *%edi
+  8002b5:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8002b8:	83 eb 01             	sub    $0x1,%ebx
+  8002bb:	85 db                	test   %ebx,%ebx
+  8002bd:	7f ed                	jg     8002ac <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8002bf:	83 ec 08             	sub    $0x8,%esp
+  8002c2:	56                   	push   %esi
+  8002c3:	83 ec 04             	sub    $0x4,%esp
+  8002c6:	ff 75 e4             	push   -0x1c(%ebp)
+  8002c9:	ff 75 e0             	push   -0x20(%ebp)
+  8002cc:	ff 75 dc             	push   -0x24(%ebp)
+  8002cf:	ff 75 d8             	push   -0x28(%ebp)
+  8002d2:	e8 b9 23 00 00       	call   802690 <__umoddi3>
+  8002d7:	83 c4 14             	add    $0x14,%esp
+  8002da:	0f be 80 b3 29 80 00 	movsbl 0x8029b3(%eax),%eax
+  8002e1:	50                   	push   %eax
+  8002e2:	ff d7                	call   *%edi
+}
+  8002e4:	83 c4 10             	add    $0x10,%esp
+  8002e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002ea:	5b                   	pop    %ebx
+  8002eb:	5e                   	pop    %esi
+  8002ec:	5f                   	pop    %edi
+  8002ed:	5d                   	pop    %ebp
+  8002ee:	c3                   	ret
+
+008002ef <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002ef:	55                   	push   %ebp
+  8002f0:	89 e5                	mov    %esp,%ebp
+  8002f2:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8002f5:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002f9:	8b 10                	mov    (%eax),%edx
+  8002fb:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002fe:	73 0a                	jae    80030a <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800300:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800303:	89 08                	mov    %ecx,(%eax)
+  800305:	8b 45 08             	mov    0x8(%ebp),%eax
+  800308:	88 02                	mov    %al,(%edx)
+}
+  80030a:	5d                   	pop    %ebp
+  80030b:	c3                   	ret
+
+0080030c <printfmt>:
+{
+  80030c:	55                   	push   %ebp
+  80030d:	89 e5                	mov    %esp,%ebp
+  80030f:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800312:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800315:	50                   	push   %eax
+  800316:	ff 75 10             	push   0x10(%ebp)
+  800319:	ff 75 0c             	push   0xc(%ebp)
+  80031c:	ff 75 08             	push   0x8(%ebp)
+  80031f:	e8 05 00 00 00       	call   800329 <vprintfmt>
+}
+  800324:	83 c4 10             	add    $0x10,%esp
+  800327:	c9                   	leave
+  800328:	c3                   	ret
+
+00800329 <vprintfmt>:
+{
+  800329:	55                   	push   %ebp
+  80032a:	89 e5                	mov    %esp,%ebp
+  80032c:	57                   	push   %edi
+  80032d:	56                   	push   %esi
+  80032e:	53                   	push   %ebx
+  80032f:	83 ec 2c             	sub    $0x2c,%esp
+  800332:	8b 75 08             	mov    0x8(%ebp),%esi
+  800335:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800338:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80033b:	eb 0a                	jmp    800347 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80033d:	83 ec 08             	sub    $0x8,%esp
+  800340:	53                   	push   %ebx
+  800341:	50                   	push   %eax
+  800342:	ff d6                	call   *%esi
+  800344:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800347:	83 c7 01             	add    $0x1,%edi
+  80034a:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80034e:	83 f8 25             	cmp    $0x25,%eax
+  800351:	74 0c                	je     80035f <vprintfmt+0x36>
+			if (ch == '\0')
+  800353:	85 c0                	test   %eax,%eax
+  800355:	75 e6                	jne    80033d <vprintfmt+0x14>
+}
+  800357:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80035a:	5b                   	pop    %ebx
+  80035b:	5e                   	pop    %esi
+  80035c:	5f                   	pop    %edi
+  80035d:	5d                   	pop    %ebp
+  80035e:	c3                   	ret
+		padc = ' ';
+  80035f:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800363:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80036a:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800371:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800378:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80037d:	8d 47 01             	lea    0x1(%edi),%eax
+  800380:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800383:	0f b6 17             	movzbl (%edi),%edx
+  800386:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800389:	3c 55                	cmp    $0x55,%al
+  80038b:	0f 87 9a 03 00 00    	ja     80072b <vprintfmt+0x402>
+  800391:	0f b6 c0             	movzbl %al,%eax
+  800394:	ff 24 85 00 2b 80 00 	jmp    *0x802b00(,%eax,4)
+  80039b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  80039e:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8003a2:	eb d9                	jmp    80037d <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003a4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003a7:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8003ab:	eb d0                	jmp    80037d <vprintfmt+0x54>
+  8003ad:	0f b6 d2             	movzbl %dl,%edx
+  8003b0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8003b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003b8:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8003bb:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003be:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8003c2:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8003c5:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8003c8:	83 f9 09             	cmp    $0x9,%ecx
+  8003cb:	77 55                	ja     800422 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8003cd:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8003d0:	eb e9                	jmp    8003bb <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8003d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003d5:	8b 00                	mov    (%eax),%eax
+  8003d7:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003dd:	8d 40 04             	lea    0x4(%eax),%eax
+  8003e0:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003e3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8003e6:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003ea:	79 91                	jns    80037d <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8003ec:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003ef:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003f2:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003f9:	eb 82                	jmp    80037d <vprintfmt+0x54>
+			if (width < 0)
+  8003fb:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003fe:	85 d2                	test   %edx,%edx
+  800400:	b8 00 00 00 00       	mov    $0x0,%eax
+  800405:	0f 49 c2             	cmovns %edx,%eax
+  800408:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80040b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80040e:	e9 6a ff ff ff       	jmp    80037d <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800413:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800416:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80041d:	e9 5b ff ff ff       	jmp    80037d <vprintfmt+0x54>
+  800422:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800425:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800428:	eb bc                	jmp    8003e6 <vprintfmt+0xbd>
+			lflag++;
+  80042a:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80042d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800430:	e9 48 ff ff ff       	jmp    80037d <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800435:	8b 45 14             	mov    0x14(%ebp),%eax
+  800438:	8d 78 04             	lea    0x4(%eax),%edi
+  80043b:	83 ec 08             	sub    $0x8,%esp
+  80043e:	53                   	push   %ebx
+  80043f:	ff 30                	push   (%eax)
+  800441:	ff d6                	call   *%esi
+			break;
+  800443:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800446:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800449:	e9 7c 02 00 00       	jmp    8006ca <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  80044e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800451:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800454:	8b 10                	mov    (%eax),%edx
+  800456:	89 d0                	mov    %edx,%eax
+  800458:	f7 d8                	neg    %eax
+  80045a:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80045d:	83 f8 10             	cmp    $0x10,%eax
+  800460:	7f 23                	jg     800485 <vprintfmt+0x15c>
+  800462:	8b 14 85 60 2c 80 00 	mov    0x802c60(,%eax,4),%edx
+  800469:	85 d2                	test   %edx,%edx
+  80046b:	74 18                	je     800485 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  80046d:	52                   	push   %edx
+  80046e:	68 bd 2e 80 00       	push   $0x802ebd
+  800473:	53                   	push   %ebx
+  800474:	56                   	push   %esi
+  800475:	e8 92 fe ff ff       	call   80030c <printfmt>
+  80047a:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80047d:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800480:	e9 45 02 00 00       	jmp    8006ca <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  800485:	50                   	push   %eax
+  800486:	68 cb 29 80 00       	push   $0x8029cb
+  80048b:	53                   	push   %ebx
+  80048c:	56                   	push   %esi
+  80048d:	e8 7a fe ff ff       	call   80030c <printfmt>
+  800492:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800495:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800498:	e9 2d 02 00 00       	jmp    8006ca <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80049d:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004a0:	83 c0 04             	add    $0x4,%eax
+  8004a3:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8004a6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004a9:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8004ab:	85 c9                	test   %ecx,%ecx
+  8004ad:	b8 c4 29 80 00       	mov    $0x8029c4,%eax
+  8004b2:	0f 45 c1             	cmovne %ecx,%eax
+  8004b5:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8004b8:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004bc:	7e 06                	jle    8004c4 <vprintfmt+0x19b>
+  8004be:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8004c2:	75 0b                	jne    8004cf <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004c4:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8004c7:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8004ca:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004cd:	eb 5c                	jmp    80052b <vprintfmt+0x202>
+  8004cf:	83 ec 08             	sub    $0x8,%esp
+  8004d2:	ff 75 d0             	push   -0x30(%ebp)
+  8004d5:	ff 75 cc             	push   -0x34(%ebp)
+  8004d8:	e8 eb 02 00 00       	call   8007c8 <strnlen>
+  8004dd:	89 c2                	mov    %eax,%edx
+  8004df:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004e2:	29 d0                	sub    %edx,%eax
+  8004e4:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8004e7:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004eb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004ee:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004f1:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004f3:	eb 0e                	jmp    800503 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8004f5:	83 ec 08             	sub    $0x8,%esp
+  8004f8:	53                   	push   %ebx
+  8004f9:	57                   	push   %edi
+  8004fa:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004fd:	83 ee 01             	sub    $0x1,%esi
+  800500:	83 c4 10             	add    $0x10,%esp
+  800503:	85 f6                	test   %esi,%esi
+  800505:	7f ee                	jg     8004f5 <vprintfmt+0x1cc>
+  800507:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80050a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80050d:	85 c0                	test   %eax,%eax
+  80050f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800514:	0f 49 d0             	cmovns %eax,%edx
+  800517:	29 d0                	sub    %edx,%eax
+  800519:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80051c:	eb a6                	jmp    8004c4 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  80051e:	83 ec 08             	sub    $0x8,%esp
+  800521:	53                   	push   %ebx
+  800522:	52                   	push   %edx
+  800523:	ff 55 08             	call   *0x8(%ebp)
+  800526:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800529:	89 f1                	mov    %esi,%ecx
+  80052b:	8d 71 01             	lea    0x1(%ecx),%esi
+  80052e:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800532:	0f be d0             	movsbl %al,%edx
+  800535:	85 d2                	test   %edx,%edx
+  800537:	74 28                	je     800561 <vprintfmt+0x238>
+  800539:	85 ff                	test   %edi,%edi
+  80053b:	78 05                	js     800542 <vprintfmt+0x219>
+  80053d:	83 ef 01             	sub    $0x1,%edi
+  800540:	78 30                	js     800572 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800542:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800546:	74 d6                	je     80051e <vprintfmt+0x1f5>
+  800548:	0f be c0             	movsbl %al,%eax
+  80054b:	83 e8 20             	sub    $0x20,%eax
+  80054e:	83 f8 5e             	cmp    $0x5e,%eax
+  800551:	76 cb                	jbe    80051e <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800553:	83 ec 08             	sub    $0x8,%esp
+  800556:	53                   	push   %ebx
+  800557:	6a 3f                	push   $0x3f
+  800559:	ff 55 08             	call   *0x8(%ebp)
+  80055c:	83 c4 10             	add    $0x10,%esp
+  80055f:	eb c8                	jmp    800529 <vprintfmt+0x200>
+  800561:	8b 75 08             	mov    0x8(%ebp),%esi
+  800564:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800567:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80056a:	01 d0                	add    %edx,%eax
+  80056c:	29 c8                	sub    %ecx,%eax
+  80056e:	89 c7                	mov    %eax,%edi
+  800570:	eb 13                	jmp    800585 <vprintfmt+0x25c>
+  800572:	8b 75 08             	mov    0x8(%ebp),%esi
+  800575:	eb ed                	jmp    800564 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800577:	83 ec 08             	sub    $0x8,%esp
+  80057a:	53                   	push   %ebx
+  80057b:	6a 20                	push   $0x20
+  80057d:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80057f:	83 ef 01             	sub    $0x1,%edi
+  800582:	83 c4 10             	add    $0x10,%esp
+  800585:	85 ff                	test   %edi,%edi
+  800587:	7f ee                	jg     800577 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800589:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80058c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80058f:	e9 36 01 00 00       	jmp    8006ca <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  800594:	83 f9 01             	cmp    $0x1,%ecx
+  800597:	7f 1f                	jg     8005b8 <vprintfmt+0x28f>
+	else if (lflag)
+  800599:	85 c9                	test   %ecx,%ecx
+  80059b:	74 67                	je     800604 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  80059d:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a0:	8b 00                	mov    (%eax),%eax
+  8005a2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005a5:	89 c1                	mov    %eax,%ecx
+  8005a7:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005aa:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005ad:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b0:	8d 40 04             	lea    0x4(%eax),%eax
+  8005b3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005b6:	eb 17                	jmp    8005cf <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8005b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005bb:	8b 50 04             	mov    0x4(%eax),%edx
+  8005be:	8b 00                	mov    (%eax),%eax
+  8005c0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005c3:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005c6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c9:	8d 40 08             	lea    0x8(%eax),%eax
+  8005cc:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8005cf:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005d2:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8005d5:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8005da:	85 c9                	test   %ecx,%ecx
+  8005dc:	0f 89 ce 00 00 00    	jns    8006b0 <vprintfmt+0x387>
+				putch('-', putdat);
+  8005e2:	83 ec 08             	sub    $0x8,%esp
+  8005e5:	53                   	push   %ebx
+  8005e6:	6a 2d                	push   $0x2d
+  8005e8:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8005ea:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005ed:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005f0:	f7 da                	neg    %edx
+  8005f2:	83 d1 00             	adc    $0x0,%ecx
+  8005f5:	f7 d9                	neg    %ecx
+  8005f7:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8005fa:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005ff:	e9 ac 00 00 00       	jmp    8006b0 <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  800604:	8b 45 14             	mov    0x14(%ebp),%eax
+  800607:	8b 00                	mov    (%eax),%eax
+  800609:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80060c:	89 c1                	mov    %eax,%ecx
+  80060e:	c1 f9 1f             	sar    $0x1f,%ecx
+  800611:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800614:	8b 45 14             	mov    0x14(%ebp),%eax
+  800617:	8d 40 04             	lea    0x4(%eax),%eax
+  80061a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80061d:	eb b0                	jmp    8005cf <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  80061f:	83 f9 01             	cmp    $0x1,%ecx
+  800622:	7f 1b                	jg     80063f <vprintfmt+0x316>
+	else if (lflag)
+  800624:	85 c9                	test   %ecx,%ecx
+  800626:	74 2c                	je     800654 <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  800628:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062b:	8b 10                	mov    (%eax),%edx
+  80062d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800632:	8d 40 04             	lea    0x4(%eax),%eax
+  800635:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800638:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80063d:	eb 71                	jmp    8006b0 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  80063f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800642:	8b 10                	mov    (%eax),%edx
+  800644:	8b 48 04             	mov    0x4(%eax),%ecx
+  800647:	8d 40 08             	lea    0x8(%eax),%eax
+  80064a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80064d:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800652:	eb 5c                	jmp    8006b0 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  800654:	8b 45 14             	mov    0x14(%ebp),%eax
+  800657:	8b 10                	mov    (%eax),%edx
+  800659:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80065e:	8d 40 04             	lea    0x4(%eax),%eax
+  800661:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800664:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800669:	eb 45                	jmp    8006b0 <vprintfmt+0x387>
+			putch('X', putdat);
+  80066b:	83 ec 08             	sub    $0x8,%esp
+  80066e:	53                   	push   %ebx
+  80066f:	6a 58                	push   $0x58
+  800671:	ff d6                	call   *%esi
+			putch('X', putdat);
+  800673:	83 c4 08             	add    $0x8,%esp
+  800676:	53                   	push   %ebx
+  800677:	6a 58                	push   $0x58
+  800679:	ff d6                	call   *%esi
+			putch('X', putdat);
+  80067b:	83 c4 08             	add    $0x8,%esp
+  80067e:	53                   	push   %ebx
+  80067f:	6a 58                	push   $0x58
+  800681:	ff d6                	call   *%esi
+			break;
+  800683:	83 c4 10             	add    $0x10,%esp
+  800686:	eb 42                	jmp    8006ca <vprintfmt+0x3a1>
+			putch('0', putdat);
+  800688:	83 ec 08             	sub    $0x8,%esp
+  80068b:	53                   	push   %ebx
+  80068c:	6a 30                	push   $0x30
+  80068e:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800690:	83 c4 08             	add    $0x8,%esp
+  800693:	53                   	push   %ebx
+  800694:	6a 78                	push   $0x78
+  800696:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800698:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069b:	8b 10                	mov    (%eax),%edx
+  80069d:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8006a2:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8006a5:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006ab:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8006b0:	83 ec 0c             	sub    $0xc,%esp
+  8006b3:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8006b7:	50                   	push   %eax
+  8006b8:	ff 75 e0             	push   -0x20(%ebp)
+  8006bb:	57                   	push   %edi
+  8006bc:	51                   	push   %ecx
+  8006bd:	52                   	push   %edx
+  8006be:	89 da                	mov    %ebx,%edx
+  8006c0:	89 f0                	mov    %esi,%eax
+  8006c2:	e8 7f fb ff ff       	call   800246 <printnum>
+			break;
+  8006c7:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8006ca:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8006cd:	e9 75 fc ff ff       	jmp    800347 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8006d2:	83 f9 01             	cmp    $0x1,%ecx
+  8006d5:	7f 1b                	jg     8006f2 <vprintfmt+0x3c9>
+	else if (lflag)
+  8006d7:	85 c9                	test   %ecx,%ecx
+  8006d9:	74 2c                	je     800707 <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  8006db:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006de:	8b 10                	mov    (%eax),%edx
+  8006e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006e5:	8d 40 04             	lea    0x4(%eax),%eax
+  8006e8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006eb:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8006f0:	eb be                	jmp    8006b0 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  8006f2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f5:	8b 10                	mov    (%eax),%edx
+  8006f7:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006fa:	8d 40 08             	lea    0x8(%eax),%eax
+  8006fd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800700:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800705:	eb a9                	jmp    8006b0 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  800707:	8b 45 14             	mov    0x14(%ebp),%eax
+  80070a:	8b 10                	mov    (%eax),%edx
+  80070c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800711:	8d 40 04             	lea    0x4(%eax),%eax
+  800714:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800717:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80071c:	eb 92                	jmp    8006b0 <vprintfmt+0x387>
+			putch(ch, putdat);
+  80071e:	83 ec 08             	sub    $0x8,%esp
+  800721:	53                   	push   %ebx
+  800722:	6a 25                	push   $0x25
+  800724:	ff d6                	call   *%esi
+			break;
+  800726:	83 c4 10             	add    $0x10,%esp
+  800729:	eb 9f                	jmp    8006ca <vprintfmt+0x3a1>
+			putch('%', putdat);
+  80072b:	83 ec 08             	sub    $0x8,%esp
+  80072e:	53                   	push   %ebx
+  80072f:	6a 25                	push   $0x25
+  800731:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800733:	83 c4 10             	add    $0x10,%esp
+  800736:	89 f8                	mov    %edi,%eax
+  800738:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80073c:	74 05                	je     800743 <vprintfmt+0x41a>
+  80073e:	83 e8 01             	sub    $0x1,%eax
+  800741:	eb f5                	jmp    800738 <vprintfmt+0x40f>
+  800743:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800746:	eb 82                	jmp    8006ca <vprintfmt+0x3a1>
+
+00800748 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800748:	55                   	push   %ebp
+  800749:	89 e5                	mov    %esp,%ebp
+  80074b:	83 ec 18             	sub    $0x18,%esp
+  80074e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800751:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800754:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800757:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80075b:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80075e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800765:	85 c0                	test   %eax,%eax
+  800767:	74 26                	je     80078f <vsnprintf+0x47>
+  800769:	85 d2                	test   %edx,%edx
+  80076b:	7e 22                	jle    80078f <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80076d:	ff 75 14             	push   0x14(%ebp)
+  800770:	ff 75 10             	push   0x10(%ebp)
+  800773:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800776:	50                   	push   %eax
+  800777:	68 ef 02 80 00       	push   $0x8002ef
+  80077c:	e8 a8 fb ff ff       	call   800329 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800781:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800784:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800787:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80078a:	83 c4 10             	add    $0x10,%esp
+}
+  80078d:	c9                   	leave
+  80078e:	c3                   	ret
+		return -E_INVAL;
+  80078f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800794:	eb f7                	jmp    80078d <vsnprintf+0x45>
+
+00800796 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800796:	55                   	push   %ebp
+  800797:	89 e5                	mov    %esp,%ebp
+  800799:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80079c:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80079f:	50                   	push   %eax
+  8007a0:	ff 75 10             	push   0x10(%ebp)
+  8007a3:	ff 75 0c             	push   0xc(%ebp)
+  8007a6:	ff 75 08             	push   0x8(%ebp)
+  8007a9:	e8 9a ff ff ff       	call   800748 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8007ae:	c9                   	leave
+  8007af:	c3                   	ret
+
+008007b0 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007b0:	55                   	push   %ebp
+  8007b1:	89 e5                	mov    %esp,%ebp
+  8007b3:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8007b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007bb:	eb 03                	jmp    8007c0 <strlen+0x10>
+		n++;
+  8007bd:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8007c0:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007c4:	75 f7                	jne    8007bd <strlen+0xd>
+	return n;
+}
+  8007c6:	5d                   	pop    %ebp
+  8007c7:	c3                   	ret
+
+008007c8 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8007c8:	55                   	push   %ebp
+  8007c9:	89 e5                	mov    %esp,%ebp
+  8007cb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007ce:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007d6:	eb 03                	jmp    8007db <strnlen+0x13>
+		n++;
+  8007d8:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007db:	39 d0                	cmp    %edx,%eax
+  8007dd:	74 08                	je     8007e7 <strnlen+0x1f>
+  8007df:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8007e3:	75 f3                	jne    8007d8 <strnlen+0x10>
+  8007e5:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8007e7:	89 d0                	mov    %edx,%eax
+  8007e9:	5d                   	pop    %ebp
+  8007ea:	c3                   	ret
+
+008007eb <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8007eb:	55                   	push   %ebp
+  8007ec:	89 e5                	mov    %esp,%ebp
+  8007ee:	53                   	push   %ebx
+  8007ef:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007f2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8007f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fa:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8007fe:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800801:	83 c0 01             	add    $0x1,%eax
+  800804:	84 d2                	test   %dl,%dl
+  800806:	75 f2                	jne    8007fa <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800808:	89 c8                	mov    %ecx,%eax
+  80080a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80080d:	c9                   	leave
+  80080e:	c3                   	ret
+
+0080080f <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80080f:	55                   	push   %ebp
+  800810:	89 e5                	mov    %esp,%ebp
+  800812:	53                   	push   %ebx
+  800813:	83 ec 10             	sub    $0x10,%esp
+  800816:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800819:	53                   	push   %ebx
+  80081a:	e8 91 ff ff ff       	call   8007b0 <strlen>
+  80081f:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800822:	ff 75 0c             	push   0xc(%ebp)
+  800825:	01 d8                	add    %ebx,%eax
+  800827:	50                   	push   %eax
+  800828:	e8 be ff ff ff       	call   8007eb <strcpy>
+	return dst;
+}
+  80082d:	89 d8                	mov    %ebx,%eax
+  80082f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800832:	c9                   	leave
+  800833:	c3                   	ret
+
+00800834 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800834:	55                   	push   %ebp
+  800835:	89 e5                	mov    %esp,%ebp
+  800837:	56                   	push   %esi
+  800838:	53                   	push   %ebx
+  800839:	8b 75 08             	mov    0x8(%ebp),%esi
+  80083c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80083f:	89 f3                	mov    %esi,%ebx
+  800841:	03 5d 10             	add    0x10(%ebp),%ebx
+  800844:	89 f0                	mov    %esi,%eax
+  800846:	eb 0f                	jmp    800857 <strncpy+0x23>
+		*dst++ = *src;
+  800848:	83 c0 01             	add    $0x1,%eax
+  80084b:	0f b6 0a             	movzbl (%edx),%ecx
+  80084e:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800851:	80 f9 01             	cmp    $0x1,%cl
+  800854:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800857:	39 d8                	cmp    %ebx,%eax
+  800859:	75 ed                	jne    800848 <strncpy+0x14>
+	}
+	return ret;
+}
+  80085b:	89 f0                	mov    %esi,%eax
+  80085d:	5b                   	pop    %ebx
+  80085e:	5e                   	pop    %esi
+  80085f:	5d                   	pop    %ebp
+  800860:	c3                   	ret
+
+00800861 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800861:	55                   	push   %ebp
+  800862:	89 e5                	mov    %esp,%ebp
+  800864:	56                   	push   %esi
+  800865:	53                   	push   %ebx
+  800866:	8b 75 08             	mov    0x8(%ebp),%esi
+  800869:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80086c:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80086f:	89 f0                	mov    %esi,%eax
+  800871:	85 d2                	test   %edx,%edx
+  800873:	74 21                	je     800896 <strlcpy+0x35>
+  800875:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800879:	89 f2                	mov    %esi,%edx
+  80087b:	eb 09                	jmp    800886 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  80087d:	83 c1 01             	add    $0x1,%ecx
+  800880:	83 c2 01             	add    $0x1,%edx
+  800883:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800886:	39 c2                	cmp    %eax,%edx
+  800888:	74 09                	je     800893 <strlcpy+0x32>
+  80088a:	0f b6 19             	movzbl (%ecx),%ebx
+  80088d:	84 db                	test   %bl,%bl
+  80088f:	75 ec                	jne    80087d <strlcpy+0x1c>
+  800891:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800893:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800896:	29 f0                	sub    %esi,%eax
+}
+  800898:	5b                   	pop    %ebx
+  800899:	5e                   	pop    %esi
+  80089a:	5d                   	pop    %ebp
+  80089b:	c3                   	ret
+
+0080089c <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80089c:	55                   	push   %ebp
+  80089d:	89 e5                	mov    %esp,%ebp
+  80089f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008a2:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8008a5:	eb 06                	jmp    8008ad <strcmp+0x11>
+		p++, q++;
+  8008a7:	83 c1 01             	add    $0x1,%ecx
+  8008aa:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8008ad:	0f b6 01             	movzbl (%ecx),%eax
+  8008b0:	84 c0                	test   %al,%al
+  8008b2:	74 04                	je     8008b8 <strcmp+0x1c>
+  8008b4:	3a 02                	cmp    (%edx),%al
+  8008b6:	74 ef                	je     8008a7 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008b8:	0f b6 c0             	movzbl %al,%eax
+  8008bb:	0f b6 12             	movzbl (%edx),%edx
+  8008be:	29 d0                	sub    %edx,%eax
+}
+  8008c0:	5d                   	pop    %ebp
+  8008c1:	c3                   	ret
+
+008008c2 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8008c2:	55                   	push   %ebp
+  8008c3:	89 e5                	mov    %esp,%ebp
+  8008c5:	53                   	push   %ebx
+  8008c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008c9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008cc:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8008cf:	eb 09                	jmp    8008da <strncmp+0x18>
+		n--, p++, q++;
+  8008d1:	83 ea 01             	sub    $0x1,%edx
+  8008d4:	83 c0 01             	add    $0x1,%eax
+  8008d7:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8008da:	85 d2                	test   %edx,%edx
+  8008dc:	74 18                	je     8008f6 <strncmp+0x34>
+  8008de:	0f b6 18             	movzbl (%eax),%ebx
+  8008e1:	84 db                	test   %bl,%bl
+  8008e3:	74 04                	je     8008e9 <strncmp+0x27>
+  8008e5:	3a 19                	cmp    (%ecx),%bl
+  8008e7:	74 e8                	je     8008d1 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008e9:	0f b6 00             	movzbl (%eax),%eax
+  8008ec:	0f b6 11             	movzbl (%ecx),%edx
+  8008ef:	29 d0                	sub    %edx,%eax
+}
+  8008f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008f4:	c9                   	leave
+  8008f5:	c3                   	ret
+		return 0;
+  8008f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008fb:	eb f4                	jmp    8008f1 <strncmp+0x2f>
+
+008008fd <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8008fd:	55                   	push   %ebp
+  8008fe:	89 e5                	mov    %esp,%ebp
+  800900:	8b 45 08             	mov    0x8(%ebp),%eax
+  800903:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800907:	eb 03                	jmp    80090c <strchr+0xf>
+  800909:	83 c0 01             	add    $0x1,%eax
+  80090c:	0f b6 10             	movzbl (%eax),%edx
+  80090f:	84 d2                	test   %dl,%dl
+  800911:	74 06                	je     800919 <strchr+0x1c>
+		if (*s == c)
+  800913:	38 ca                	cmp    %cl,%dl
+  800915:	75 f2                	jne    800909 <strchr+0xc>
+  800917:	eb 05                	jmp    80091e <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800919:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80091e:	5d                   	pop    %ebp
+  80091f:	c3                   	ret
+
+00800920 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800920:	55                   	push   %ebp
+  800921:	89 e5                	mov    %esp,%ebp
+  800923:	8b 45 08             	mov    0x8(%ebp),%eax
+  800926:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80092a:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  80092d:	38 ca                	cmp    %cl,%dl
+  80092f:	74 09                	je     80093a <strfind+0x1a>
+  800931:	84 d2                	test   %dl,%dl
+  800933:	74 05                	je     80093a <strfind+0x1a>
+	for (; *s; s++)
+  800935:	83 c0 01             	add    $0x1,%eax
+  800938:	eb f0                	jmp    80092a <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  80093a:	5d                   	pop    %ebp
+  80093b:	c3                   	ret
+
+0080093c <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  80093c:	55                   	push   %ebp
+  80093d:	89 e5                	mov    %esp,%ebp
+  80093f:	57                   	push   %edi
+  800940:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800943:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800946:	85 c9                	test   %ecx,%ecx
+  800948:	74 20                	je     80096a <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  80094a:	89 f8                	mov    %edi,%eax
+  80094c:	09 c8                	or     %ecx,%eax
+  80094e:	a8 03                	test   $0x3,%al
+  800950:	75 12                	jne    800964 <memset+0x28>
+		c &= 0xFF;
+  800952:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800956:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  80095c:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  80095f:	fc                   	cld
+  800960:	f3 ab                	rep stos %eax,%es:(%edi)
+  800962:	eb 06                	jmp    80096a <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800964:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800967:	fc                   	cld
+  800968:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  80096a:	89 f8                	mov    %edi,%eax
+  80096c:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  80096f:	c9                   	leave
+  800970:	c3                   	ret
+
+00800971 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800971:	55                   	push   %ebp
+  800972:	89 e5                	mov    %esp,%ebp
+  800974:	57                   	push   %edi
+  800975:	56                   	push   %esi
+  800976:	8b 45 08             	mov    0x8(%ebp),%eax
+  800979:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80097c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  80097f:	39 c6                	cmp    %eax,%esi
+  800981:	73 32                	jae    8009b5 <memmove+0x44>
+  800983:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800986:	39 d0                	cmp    %edx,%eax
+  800988:	73 2b                	jae    8009b5 <memmove+0x44>
+		s += n;
+		d += n;
+  80098a:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80098d:	89 d6                	mov    %edx,%esi
+  80098f:	09 fe                	or     %edi,%esi
+  800991:	09 ce                	or     %ecx,%esi
+  800993:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800999:	75 0e                	jne    8009a9 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  80099b:	83 ef 04             	sub    $0x4,%edi
+  80099e:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8009a1:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8009a4:	fd                   	std
+  8009a5:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009a7:	eb 09                	jmp    8009b2 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8009a9:	83 ef 01             	sub    $0x1,%edi
+  8009ac:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8009af:	fd                   	std
+  8009b0:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8009b2:	fc                   	cld
+  8009b3:	eb 1a                	jmp    8009cf <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009b5:	89 f2                	mov    %esi,%edx
+  8009b7:	09 c2                	or     %eax,%edx
+  8009b9:	09 ca                	or     %ecx,%edx
+  8009bb:	f6 c2 03             	test   $0x3,%dl
+  8009be:	75 0a                	jne    8009ca <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8009c0:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8009c3:	89 c7                	mov    %eax,%edi
+  8009c5:	fc                   	cld
+  8009c6:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009c8:	eb 05                	jmp    8009cf <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8009ca:	89 c7                	mov    %eax,%edi
+  8009cc:	fc                   	cld
+  8009cd:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8009cf:	5e                   	pop    %esi
+  8009d0:	5f                   	pop    %edi
+  8009d1:	5d                   	pop    %ebp
+  8009d2:	c3                   	ret
+
+008009d3 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8009d3:	55                   	push   %ebp
+  8009d4:	89 e5                	mov    %esp,%ebp
+  8009d6:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8009d9:	ff 75 10             	push   0x10(%ebp)
+  8009dc:	ff 75 0c             	push   0xc(%ebp)
+  8009df:	ff 75 08             	push   0x8(%ebp)
+  8009e2:	e8 8a ff ff ff       	call   800971 <memmove>
+}
+  8009e7:	c9                   	leave
+  8009e8:	c3                   	ret
+
+008009e9 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8009e9:	55                   	push   %ebp
+  8009ea:	89 e5                	mov    %esp,%ebp
+  8009ec:	56                   	push   %esi
+  8009ed:	53                   	push   %ebx
+  8009ee:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009f1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8009f4:	89 c6                	mov    %eax,%esi
+  8009f6:	03 75 10             	add    0x10(%ebp),%esi
+  8009f9:	eb 06                	jmp    800a01 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8009fb:	83 c0 01             	add    $0x1,%eax
+  8009fe:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a01:	39 f0                	cmp    %esi,%eax
+  800a03:	74 14                	je     800a19 <memcmp+0x30>
+		if (*s1 != *s2)
+  800a05:	0f b6 08             	movzbl (%eax),%ecx
+  800a08:	0f b6 1a             	movzbl (%edx),%ebx
+  800a0b:	38 d9                	cmp    %bl,%cl
+  800a0d:	74 ec                	je     8009fb <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a0f:	0f b6 c1             	movzbl %cl,%eax
+  800a12:	0f b6 db             	movzbl %bl,%ebx
+  800a15:	29 d8                	sub    %ebx,%eax
+  800a17:	eb 05                	jmp    800a1e <memcmp+0x35>
+	}
+
+	return 0;
+  800a19:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a1e:	5b                   	pop    %ebx
+  800a1f:	5e                   	pop    %esi
+  800a20:	5d                   	pop    %ebp
+  800a21:	c3                   	ret
+
+00800a22 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a22:	55                   	push   %ebp
+  800a23:	89 e5                	mov    %esp,%ebp
+  800a25:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a28:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a2b:	89 c2                	mov    %eax,%edx
+  800a2d:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a30:	eb 03                	jmp    800a35 <memfind+0x13>
+  800a32:	83 c0 01             	add    $0x1,%eax
+  800a35:	39 d0                	cmp    %edx,%eax
+  800a37:	73 04                	jae    800a3d <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a39:	38 08                	cmp    %cl,(%eax)
+  800a3b:	75 f5                	jne    800a32 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a3d:	5d                   	pop    %ebp
+  800a3e:	c3                   	ret
+
+00800a3f <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a3f:	55                   	push   %ebp
+  800a40:	89 e5                	mov    %esp,%ebp
+  800a42:	57                   	push   %edi
+  800a43:	56                   	push   %esi
+  800a44:	53                   	push   %ebx
+  800a45:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a48:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a4b:	eb 03                	jmp    800a50 <strtol+0x11>
+		s++;
+  800a4d:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a50:	0f b6 02             	movzbl (%edx),%eax
+  800a53:	3c 20                	cmp    $0x20,%al
+  800a55:	74 f6                	je     800a4d <strtol+0xe>
+  800a57:	3c 09                	cmp    $0x9,%al
+  800a59:	74 f2                	je     800a4d <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a5b:	3c 2b                	cmp    $0x2b,%al
+  800a5d:	74 2a                	je     800a89 <strtol+0x4a>
+	int neg = 0;
+  800a5f:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a64:	3c 2d                	cmp    $0x2d,%al
+  800a66:	74 2b                	je     800a93 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a68:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a6e:	75 0f                	jne    800a7f <strtol+0x40>
+  800a70:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a73:	74 28                	je     800a9d <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a75:	85 db                	test   %ebx,%ebx
+  800a77:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a7c:	0f 44 d8             	cmove  %eax,%ebx
+  800a7f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a84:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a87:	eb 46                	jmp    800acf <strtol+0x90>
+		s++;
+  800a89:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a8c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a91:	eb d5                	jmp    800a68 <strtol+0x29>
+		s++, neg = 1;
+  800a93:	83 c2 01             	add    $0x1,%edx
+  800a96:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a9b:	eb cb                	jmp    800a68 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a9d:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800aa1:	74 0e                	je     800ab1 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800aa3:	85 db                	test   %ebx,%ebx
+  800aa5:	75 d8                	jne    800a7f <strtol+0x40>
+		s++, base = 8;
+  800aa7:	83 c2 01             	add    $0x1,%edx
+  800aaa:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800aaf:	eb ce                	jmp    800a7f <strtol+0x40>
+		s += 2, base = 16;
+  800ab1:	83 c2 02             	add    $0x2,%edx
+  800ab4:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800ab9:	eb c4                	jmp    800a7f <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800abb:	0f be c0             	movsbl %al,%eax
+  800abe:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800ac1:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800ac4:	7d 3a                	jge    800b00 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800ac6:	83 c2 01             	add    $0x1,%edx
+  800ac9:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800acd:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800acf:	0f b6 02             	movzbl (%edx),%eax
+  800ad2:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800ad5:	89 f3                	mov    %esi,%ebx
+  800ad7:	80 fb 09             	cmp    $0x9,%bl
+  800ada:	76 df                	jbe    800abb <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800adc:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800adf:	89 f3                	mov    %esi,%ebx
+  800ae1:	80 fb 19             	cmp    $0x19,%bl
+  800ae4:	77 08                	ja     800aee <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800ae6:	0f be c0             	movsbl %al,%eax
+  800ae9:	83 e8 57             	sub    $0x57,%eax
+  800aec:	eb d3                	jmp    800ac1 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800aee:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800af1:	89 f3                	mov    %esi,%ebx
+  800af3:	80 fb 19             	cmp    $0x19,%bl
+  800af6:	77 08                	ja     800b00 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800af8:	0f be c0             	movsbl %al,%eax
+  800afb:	83 e8 37             	sub    $0x37,%eax
+  800afe:	eb c1                	jmp    800ac1 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b00:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b04:	74 05                	je     800b0b <strtol+0xcc>
+		*endptr = (char *) s;
+  800b06:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b09:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800b0b:	89 c8                	mov    %ecx,%eax
+  800b0d:	f7 d8                	neg    %eax
+  800b0f:	85 ff                	test   %edi,%edi
+  800b11:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b14:	89 c8                	mov    %ecx,%eax
+  800b16:	5b                   	pop    %ebx
+  800b17:	5e                   	pop    %esi
+  800b18:	5f                   	pop    %edi
+  800b19:	5d                   	pop    %ebp
+  800b1a:	c3                   	ret
+
+00800b1b <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800b1b:	55                   	push   %ebp
+  800b1c:	89 e5                	mov    %esp,%ebp
+  800b1e:	57                   	push   %edi
+  800b1f:	56                   	push   %esi
+  800b20:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800b21:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b26:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b29:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b2c:	89 c3                	mov    %eax,%ebx
+  800b2e:	89 c7                	mov    %eax,%edi
+  800b30:	89 c6                	mov    %eax,%esi
+  800b32:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  800b34:	5b                   	pop    %ebx
+  800b35:	5e                   	pop    %esi
+  800b36:	5f                   	pop    %edi
+  800b37:	5d                   	pop    %ebp
+  800b38:	c3                   	ret
+
+00800b39 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800b39:	55                   	push   %ebp
+  800b3a:	89 e5                	mov    %esp,%ebp
+  800b3c:	57                   	push   %edi
+  800b3d:	56                   	push   %esi
+  800b3e:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800b3f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b44:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b49:	89 d1                	mov    %edx,%ecx
+  800b4b:	89 d3                	mov    %edx,%ebx
+  800b4d:	89 d7                	mov    %edx,%edi
+  800b4f:	89 d6                	mov    %edx,%esi
+  800b51:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800b53:	5b                   	pop    %ebx
+  800b54:	5e                   	pop    %esi
+  800b55:	5f                   	pop    %edi
+  800b56:	5d                   	pop    %ebp
+  800b57:	c3                   	ret
+
+00800b58 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800b58:	55                   	push   %ebp
+  800b59:	89 e5                	mov    %esp,%ebp
+  800b5b:	57                   	push   %edi
+  800b5c:	56                   	push   %esi
+  800b5d:	53                   	push   %ebx
+  800b5e:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800b61:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b66:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b69:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b6e:	89 cb                	mov    %ecx,%ebx
+  800b70:	89 cf                	mov    %ecx,%edi
+  800b72:	89 ce                	mov    %ecx,%esi
+  800b74:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800b76:	85 c0                	test   %eax,%eax
+  800b78:	7f 08                	jg     800b82 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800b7a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b7d:	5b                   	pop    %ebx
+  800b7e:	5e                   	pop    %esi
+  800b7f:	5f                   	pop    %edi
+  800b80:	5d                   	pop    %ebp
+  800b81:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800b82:	83 ec 0c             	sub    $0xc,%esp
+  800b85:	50                   	push   %eax
+  800b86:	6a 03                	push   $0x3
+  800b88:	68 c3 2c 80 00       	push   $0x802cc3
+  800b8d:	6a 3e                	push   $0x3e
+  800b8f:	68 e0 2c 80 00       	push   $0x802ce0
+  800b94:	e8 be f5 ff ff       	call   800157 <_panic>
+
+00800b99 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800b99:	55                   	push   %ebp
+  800b9a:	89 e5                	mov    %esp,%ebp
+  800b9c:	57                   	push   %edi
+  800b9d:	56                   	push   %esi
+  800b9e:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800b9f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ba4:	b8 02 00 00 00       	mov    $0x2,%eax
+  800ba9:	89 d1                	mov    %edx,%ecx
+  800bab:	89 d3                	mov    %edx,%ebx
+  800bad:	89 d7                	mov    %edx,%edi
+  800baf:	89 d6                	mov    %edx,%esi
+  800bb1:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800bb3:	5b                   	pop    %ebx
+  800bb4:	5e                   	pop    %esi
+  800bb5:	5f                   	pop    %edi
+  800bb6:	5d                   	pop    %ebp
+  800bb7:	c3                   	ret
+
+00800bb8 <sys_yield>:
+
+void
+sys_yield(void) {
+  800bb8:	55                   	push   %ebp
+  800bb9:	89 e5                	mov    %esp,%ebp
+  800bbb:	57                   	push   %edi
+  800bbc:	56                   	push   %esi
+  800bbd:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800bbe:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bc3:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800bc8:	89 d1                	mov    %edx,%ecx
+  800bca:	89 d3                	mov    %edx,%ebx
+  800bcc:	89 d7                	mov    %edx,%edi
+  800bce:	89 d6                	mov    %edx,%esi
+  800bd0:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800bd2:	5b                   	pop    %ebx
+  800bd3:	5e                   	pop    %esi
+  800bd4:	5f                   	pop    %edi
+  800bd5:	5d                   	pop    %ebp
+  800bd6:	c3                   	ret
+
+00800bd7 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  800bd7:	55                   	push   %ebp
+  800bd8:	89 e5                	mov    %esp,%ebp
+  800bda:	57                   	push   %edi
+  800bdb:	56                   	push   %esi
+  800bdc:	53                   	push   %ebx
+  800bdd:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800be0:	be 00 00 00 00       	mov    $0x0,%esi
+  800be5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800be8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800beb:	b8 04 00 00 00       	mov    $0x4,%eax
+  800bf0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bf3:	89 f7                	mov    %esi,%edi
+  800bf5:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800bf7:	85 c0                	test   %eax,%eax
+  800bf9:	7f 08                	jg     800c03 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800bfb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bfe:	5b                   	pop    %ebx
+  800bff:	5e                   	pop    %esi
+  800c00:	5f                   	pop    %edi
+  800c01:	5d                   	pop    %ebp
+  800c02:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c03:	83 ec 0c             	sub    $0xc,%esp
+  800c06:	50                   	push   %eax
+  800c07:	6a 04                	push   $0x4
+  800c09:	68 c3 2c 80 00       	push   $0x802cc3
+  800c0e:	6a 3e                	push   $0x3e
+  800c10:	68 e0 2c 80 00       	push   $0x802ce0
+  800c15:	e8 3d f5 ff ff       	call   800157 <_panic>
+
+00800c1a <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  800c1a:	55                   	push   %ebp
+  800c1b:	89 e5                	mov    %esp,%ebp
+  800c1d:	57                   	push   %edi
+  800c1e:	56                   	push   %esi
+  800c1f:	53                   	push   %ebx
+  800c20:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c23:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c26:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c29:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c2e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c31:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c34:	8b 75 18             	mov    0x18(%ebp),%esi
+  800c37:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c39:	85 c0                	test   %eax,%eax
+  800c3b:	7f 08                	jg     800c45 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800c3d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c40:	5b                   	pop    %ebx
+  800c41:	5e                   	pop    %esi
+  800c42:	5f                   	pop    %edi
+  800c43:	5d                   	pop    %ebp
+  800c44:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c45:	83 ec 0c             	sub    $0xc,%esp
+  800c48:	50                   	push   %eax
+  800c49:	6a 05                	push   $0x5
+  800c4b:	68 c3 2c 80 00       	push   $0x802cc3
+  800c50:	6a 3e                	push   $0x3e
+  800c52:	68 e0 2c 80 00       	push   $0x802ce0
+  800c57:	e8 fb f4 ff ff       	call   800157 <_panic>
+
+00800c5c <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  800c5c:	55                   	push   %ebp
+  800c5d:	89 e5                	mov    %esp,%ebp
+  800c5f:	57                   	push   %edi
+  800c60:	56                   	push   %esi
+  800c61:	53                   	push   %ebx
+  800c62:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c65:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c6a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c6d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c70:	b8 06 00 00 00       	mov    $0x6,%eax
+  800c75:	89 df                	mov    %ebx,%edi
+  800c77:	89 de                	mov    %ebx,%esi
+  800c79:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c7b:	85 c0                	test   %eax,%eax
+  800c7d:	7f 08                	jg     800c87 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800c7f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c82:	5b                   	pop    %ebx
+  800c83:	5e                   	pop    %esi
+  800c84:	5f                   	pop    %edi
+  800c85:	5d                   	pop    %ebp
+  800c86:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c87:	83 ec 0c             	sub    $0xc,%esp
+  800c8a:	50                   	push   %eax
+  800c8b:	6a 06                	push   $0x6
+  800c8d:	68 c3 2c 80 00       	push   $0x802cc3
+  800c92:	6a 3e                	push   $0x3e
+  800c94:	68 e0 2c 80 00       	push   $0x802ce0
+  800c99:	e8 b9 f4 ff ff       	call   800157 <_panic>
+
+00800c9e <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800c9e:	55                   	push   %ebp
+  800c9f:	89 e5                	mov    %esp,%ebp
+  800ca1:	57                   	push   %edi
+  800ca2:	56                   	push   %esi
+  800ca3:	53                   	push   %ebx
+  800ca4:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800ca7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cac:	8b 55 08             	mov    0x8(%ebp),%edx
+  800caf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cb2:	b8 08 00 00 00       	mov    $0x8,%eax
+  800cb7:	89 df                	mov    %ebx,%edi
+  800cb9:	89 de                	mov    %ebx,%esi
+  800cbb:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800cbd:	85 c0                	test   %eax,%eax
+  800cbf:	7f 08                	jg     800cc9 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800cc1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cc4:	5b                   	pop    %ebx
+  800cc5:	5e                   	pop    %esi
+  800cc6:	5f                   	pop    %edi
+  800cc7:	5d                   	pop    %ebp
+  800cc8:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800cc9:	83 ec 0c             	sub    $0xc,%esp
+  800ccc:	50                   	push   %eax
+  800ccd:	6a 08                	push   $0x8
+  800ccf:	68 c3 2c 80 00       	push   $0x802cc3
+  800cd4:	6a 3e                	push   $0x3e
+  800cd6:	68 e0 2c 80 00       	push   $0x802ce0
+  800cdb:	e8 77 f4 ff ff       	call   800157 <_panic>
+
+00800ce0 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800ce0:	55                   	push   %ebp
+  800ce1:	89 e5                	mov    %esp,%ebp
+  800ce3:	57                   	push   %edi
+  800ce4:	56                   	push   %esi
+  800ce5:	53                   	push   %ebx
+  800ce6:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800ce9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cee:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cf1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cf4:	b8 09 00 00 00       	mov    $0x9,%eax
+  800cf9:	89 df                	mov    %ebx,%edi
+  800cfb:	89 de                	mov    %ebx,%esi
+  800cfd:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800cff:	85 c0                	test   %eax,%eax
+  800d01:	7f 08                	jg     800d0b <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800d03:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d06:	5b                   	pop    %ebx
+  800d07:	5e                   	pop    %esi
+  800d08:	5f                   	pop    %edi
+  800d09:	5d                   	pop    %ebp
+  800d0a:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d0b:	83 ec 0c             	sub    $0xc,%esp
+  800d0e:	50                   	push   %eax
+  800d0f:	6a 09                	push   $0x9
+  800d11:	68 c3 2c 80 00       	push   $0x802cc3
+  800d16:	6a 3e                	push   $0x3e
+  800d18:	68 e0 2c 80 00       	push   $0x802ce0
+  800d1d:	e8 35 f4 ff ff       	call   800157 <_panic>
+
+00800d22 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800d22:	55                   	push   %ebp
+  800d23:	89 e5                	mov    %esp,%ebp
+  800d25:	57                   	push   %edi
+  800d26:	56                   	push   %esi
+  800d27:	53                   	push   %ebx
+  800d28:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800d2b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d30:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d33:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d36:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d3b:	89 df                	mov    %ebx,%edi
+  800d3d:	89 de                	mov    %ebx,%esi
+  800d3f:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d41:	85 c0                	test   %eax,%eax
+  800d43:	7f 08                	jg     800d4d <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800d45:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d48:	5b                   	pop    %ebx
+  800d49:	5e                   	pop    %esi
+  800d4a:	5f                   	pop    %edi
+  800d4b:	5d                   	pop    %ebp
+  800d4c:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d4d:	83 ec 0c             	sub    $0xc,%esp
+  800d50:	50                   	push   %eax
+  800d51:	6a 0a                	push   $0xa
+  800d53:	68 c3 2c 80 00       	push   $0x802cc3
+  800d58:	6a 3e                	push   $0x3e
+  800d5a:	68 e0 2c 80 00       	push   $0x802ce0
+  800d5f:	e8 f3 f3 ff ff       	call   800157 <_panic>
+
+00800d64 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  800d64:	55                   	push   %ebp
+  800d65:	89 e5                	mov    %esp,%ebp
+  800d67:	57                   	push   %edi
+  800d68:	56                   	push   %esi
+  800d69:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d6a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d6d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d70:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800d75:	be 00 00 00 00       	mov    $0x0,%esi
+  800d7a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d7d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d80:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800d82:	5b                   	pop    %ebx
+  800d83:	5e                   	pop    %esi
+  800d84:	5f                   	pop    %edi
+  800d85:	5d                   	pop    %ebp
+  800d86:	c3                   	ret
+
+00800d87 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  800d87:	55                   	push   %ebp
+  800d88:	89 e5                	mov    %esp,%ebp
+  800d8a:	57                   	push   %edi
+  800d8b:	56                   	push   %esi
+  800d8c:	53                   	push   %ebx
+  800d8d:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800d90:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d95:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d98:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800d9d:	89 cb                	mov    %ecx,%ebx
+  800d9f:	89 cf                	mov    %ecx,%edi
+  800da1:	89 ce                	mov    %ecx,%esi
+  800da3:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800da5:	85 c0                	test   %eax,%eax
+  800da7:	7f 08                	jg     800db1 <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  800da9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dac:	5b                   	pop    %ebx
+  800dad:	5e                   	pop    %esi
+  800dae:	5f                   	pop    %edi
+  800daf:	5d                   	pop    %ebp
+  800db0:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800db1:	83 ec 0c             	sub    $0xc,%esp
+  800db4:	50                   	push   %eax
+  800db5:	6a 0d                	push   $0xd
+  800db7:	68 c3 2c 80 00       	push   $0x802cc3
+  800dbc:	6a 3e                	push   $0x3e
+  800dbe:	68 e0 2c 80 00       	push   $0x802ce0
+  800dc3:	e8 8f f3 ff ff       	call   800157 <_panic>
+
+00800dc8 <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  800dc8:	55                   	push   %ebp
+  800dc9:	89 e5                	mov    %esp,%ebp
+  800dcb:	57                   	push   %edi
+  800dcc:	56                   	push   %esi
+  800dcd:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800dce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dd3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dd9:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800dde:	89 df                	mov    %ebx,%edi
+  800de0:	89 de                	mov    %ebx,%esi
+  800de2:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  800de4:	5b                   	pop    %ebx
+  800de5:	5e                   	pop    %esi
+  800de6:	5f                   	pop    %edi
+  800de7:	5d                   	pop    %ebp
+  800de8:	c3                   	ret
+
+00800de9 <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  800de9:	55                   	push   %ebp
+  800dea:	89 e5                	mov    %esp,%ebp
+  800dec:	57                   	push   %edi
+  800ded:	56                   	push   %esi
+  800dee:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800def:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800df4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df7:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800dfc:	89 cb                	mov    %ecx,%ebx
+  800dfe:	89 cf                	mov    %ecx,%edi
+  800e00:	89 ce                	mov    %ecx,%esi
+  800e02:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  800e04:	5b                   	pop    %ebx
+  800e05:	5e                   	pop    %esi
+  800e06:	5f                   	pop    %edi
+  800e07:	5d                   	pop    %ebp
+  800e08:	c3                   	ret
+
+00800e09 <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  800e09:	55                   	push   %ebp
+  800e0a:	89 e5                	mov    %esp,%ebp
+  800e0c:	57                   	push   %edi
+  800e0d:	56                   	push   %esi
+  800e0e:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e0f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e14:	b8 10 00 00 00       	mov    $0x10,%eax
+  800e19:	89 d1                	mov    %edx,%ecx
+  800e1b:	89 d3                	mov    %edx,%ebx
+  800e1d:	89 d7                	mov    %edx,%edi
+  800e1f:	89 d6                	mov    %edx,%esi
+  800e21:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800e23:	5b                   	pop    %ebx
+  800e24:	5e                   	pop    %esi
+  800e25:	5f                   	pop    %edi
+  800e26:	5d                   	pop    %ebp
+  800e27:	c3                   	ret
+
+00800e28 <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  800e28:	55                   	push   %ebp
+  800e29:	89 e5                	mov    %esp,%ebp
+  800e2b:	57                   	push   %edi
+  800e2c:	56                   	push   %esi
+  800e2d:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e2e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e33:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e36:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e39:	b8 11 00 00 00       	mov    $0x11,%eax
+  800e3e:	89 df                	mov    %ebx,%edi
+  800e40:	89 de                	mov    %ebx,%esi
+  800e42:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800e44:	5b                   	pop    %ebx
+  800e45:	5e                   	pop    %esi
+  800e46:	5f                   	pop    %edi
+  800e47:	5d                   	pop    %ebp
+  800e48:	c3                   	ret
+
+00800e49 <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  800e49:	55                   	push   %ebp
+  800e4a:	89 e5                	mov    %esp,%ebp
+  800e4c:	57                   	push   %edi
+  800e4d:	56                   	push   %esi
+  800e4e:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e4f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e54:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e57:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e5a:	b8 12 00 00 00       	mov    $0x12,%eax
+  800e5f:	89 df                	mov    %ebx,%edi
+  800e61:	89 de                	mov    %ebx,%esi
+  800e63:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800e65:	5b                   	pop    %ebx
+  800e66:	5e                   	pop    %esi
+  800e67:	5f                   	pop    %edi
+  800e68:	5d                   	pop    %ebp
+  800e69:	c3                   	ret
+
+00800e6a <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  800e6a:	55                   	push   %ebp
+  800e6b:	89 e5                	mov    %esp,%ebp
+  800e6d:	57                   	push   %edi
+  800e6e:	56                   	push   %esi
+  800e6f:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e70:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e75:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e78:	b8 13 00 00 00       	mov    $0x13,%eax
+  800e7d:	89 cb                	mov    %ecx,%ebx
+  800e7f:	89 cf                	mov    %ecx,%edi
+  800e81:	89 ce                	mov    %ecx,%esi
+  800e83:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  800e85:	5b                   	pop    %ebx
+  800e86:	5e                   	pop    %esi
+  800e87:	5f                   	pop    %edi
+  800e88:	5d                   	pop    %ebp
+  800e89:	c3                   	ret
+
+00800e8a <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  800e8a:	55                   	push   %ebp
+  800e8b:	89 e5                	mov    %esp,%ebp
+  800e8d:	57                   	push   %edi
+  800e8e:	56                   	push   %esi
+  800e8f:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e90:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e95:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e98:	b8 14 00 00 00       	mov    $0x14,%eax
+  800e9d:	89 cb                	mov    %ecx,%ebx
+  800e9f:	89 cf                	mov    %ecx,%edi
+  800ea1:	89 ce                	mov    %ecx,%esi
+  800ea3:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  800ea5:	5b                   	pop    %ebx
+  800ea6:	5e                   	pop    %esi
+  800ea7:	5f                   	pop    %edi
+  800ea8:	5d                   	pop    %ebp
+  800ea9:	c3                   	ret
+
+00800eaa <pgfault>:
+//
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf) {
+  800eaa:	55                   	push   %ebp
+  800eab:	89 e5                	mov    %esp,%ebp
+  800ead:	53                   	push   %ebx
+  800eae:	83 ec 04             	sub    $0x4,%esp
+  800eb1:	8b 45 08             	mov    0x8(%ebp),%eax
+    void *addr = (void *) utf->utf_fault_va;
+  800eb4:	8b 18                	mov    (%eax),%ebx
+    // Hint:
+    //   Use the read-only page table mappings at uvpt
+    //   (see <inc/memlayout.h>).
+
+    // LAB 4: Your code here.
+    if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P) ||
+  800eb6:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  800eba:	0f 84 95 00 00 00    	je     800f55 <pgfault+0xab>
+  800ec0:	89 d8                	mov    %ebx,%eax
+  800ec2:	c1 e8 16             	shr    $0x16,%eax
+  800ec5:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  800ecc:	a8 01                	test   $0x1,%al
+  800ece:	0f 84 81 00 00 00    	je     800f55 <pgfault+0xab>
+        (uvpt[PGNUM(addr)] & (PTE_P | PTE_COW)) != (PTE_P | PTE_COW)) {
+  800ed4:	89 d8                	mov    %ebx,%eax
+  800ed6:	c1 e8 0c             	shr    $0xc,%eax
+  800ed9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800ee0:	25 01 08 00 00       	and    $0x801,%eax
+    if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P) ||
+  800ee5:	3d 01 08 00 00       	cmp    $0x801,%eax
+  800eea:	75 69                	jne    800f55 <pgfault+0xab>
+    // Hint:
+    //   You should make three system calls.
+
+    // LAB 4: Your code here.
+
+    if (sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W))
+  800eec:	83 ec 04             	sub    $0x4,%esp
+  800eef:	6a 07                	push   $0x7
+  800ef1:	68 00 f0 7f 00       	push   $0x7ff000
+  800ef6:	6a 00                	push   $0x0
+  800ef8:	e8 da fc ff ff       	call   800bd7 <sys_page_alloc>
+  800efd:	83 c4 10             	add    $0x10,%esp
+  800f00:	85 c0                	test   %eax,%eax
+  800f02:	75 65                	jne    800f69 <pgfault+0xbf>
+        panic("sys_page_alloc failed");
+
+    addr = ROUNDDOWN(addr, PGSIZE);
+  800f04:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+    memmove(PFTEMP, addr, PGSIZE);
+  800f0a:	83 ec 04             	sub    $0x4,%esp
+  800f0d:	68 00 10 00 00       	push   $0x1000
+  800f12:	53                   	push   %ebx
+  800f13:	68 00 f0 7f 00       	push   $0x7ff000
+  800f18:	e8 54 fa ff ff       	call   800971 <memmove>
+
+    if (sys_page_map(0, PFTEMP, 0, addr, PTE_P | PTE_U | PTE_W))
+  800f1d:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  800f24:	53                   	push   %ebx
+  800f25:	6a 00                	push   $0x0
+  800f27:	68 00 f0 7f 00       	push   $0x7ff000
+  800f2c:	6a 00                	push   $0x0
+  800f2e:	e8 e7 fc ff ff       	call   800c1a <sys_page_map>
+  800f33:	83 c4 20             	add    $0x20,%esp
+  800f36:	85 c0                	test   %eax,%eax
+  800f38:	75 43                	jne    800f7d <pgfault+0xd3>
+        panic("sys_page_map failed");
+    if (sys_page_unmap(0, PFTEMP))
+  800f3a:	83 ec 08             	sub    $0x8,%esp
+  800f3d:	68 00 f0 7f 00       	push   $0x7ff000
+  800f42:	6a 00                	push   $0x0
+  800f44:	e8 13 fd ff ff       	call   800c5c <sys_page_unmap>
+  800f49:	83 c4 10             	add    $0x10,%esp
+  800f4c:	85 c0                	test   %eax,%eax
+  800f4e:	75 41                	jne    800f91 <pgfault+0xe7>
+        panic("sys_page_unmap failed");
+
+}
+  800f50:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f53:	c9                   	leave
+  800f54:	c3                   	ret
+        panic("pgfault: faulting access invalid");
+  800f55:	83 ec 04             	sub    $0x4,%esp
+  800f58:	68 f0 2c 80 00       	push   $0x802cf0
+  800f5d:	6a 1e                	push   $0x1e
+  800f5f:	68 5c 2d 80 00       	push   $0x802d5c
+  800f64:	e8 ee f1 ff ff       	call   800157 <_panic>
+        panic("sys_page_alloc failed");
+  800f69:	83 ec 04             	sub    $0x4,%esp
+  800f6c:	68 cf 2d 80 00       	push   $0x802dcf
+  800f71:	6a 2a                	push   $0x2a
+  800f73:	68 5c 2d 80 00       	push   $0x802d5c
+  800f78:	e8 da f1 ff ff       	call   800157 <_panic>
+        panic("sys_page_map failed");
+  800f7d:	83 ec 04             	sub    $0x4,%esp
+  800f80:	68 67 2d 80 00       	push   $0x802d67
+  800f85:	6a 30                	push   $0x30
+  800f87:	68 5c 2d 80 00       	push   $0x802d5c
+  800f8c:	e8 c6 f1 ff ff       	call   800157 <_panic>
+        panic("sys_page_unmap failed");
+  800f91:	83 ec 04             	sub    $0x4,%esp
+  800f94:	68 7b 2d 80 00       	push   $0x802d7b
+  800f99:	6a 32                	push   $0x32
+  800f9b:	68 5c 2d 80 00       	push   $0x802d5c
+  800fa0:	e8 b2 f1 ff ff       	call   800157 <_panic>
+
+00800fa5 <fork>:
+//   Remember to fix "thisenv" in the child process.
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void) {
+  800fa5:	55                   	push   %ebp
+  800fa6:	89 e5                	mov    %esp,%ebp
+  800fa8:	57                   	push   %edi
+  800fa9:	56                   	push   %esi
+  800faa:	53                   	push   %ebx
+  800fab:	83 ec 18             	sub    $0x18,%esp
+    // LAB 4: Your code here.
+    set_pgfault_handler(pgfault);
+  800fae:	68 aa 0e 80 00       	push   $0x800eaa
+  800fb3:	e8 21 14 00 00       	call   8023d9 <set_pgfault_handler>
+
+// This must be inlined.  Exercise for reader: why?
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+  envid_t ret;
+  asm volatile("int %2"
+  800fb8:	b8 07 00 00 00       	mov    $0x7,%eax
+  800fbd:	cd 30                	int    $0x30
+  800fbf:	89 c6                	mov    %eax,%esi
+
+    envid_t envid = sys_exofork();
+    if (envid < 0)
+  800fc1:	83 c4 10             	add    $0x10,%esp
+  800fc4:	85 c0                	test   %eax,%eax
+  800fc6:	78 2a                	js     800ff2 <fork+0x4d>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+
+    uintptr_t addr;
+    for (addr = 0; addr < UTOP; addr += PGSIZE) {
+  800fc8:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (envid == 0) {
+  800fcd:	0f 85 a2 00 00 00    	jne    801075 <fork+0xd0>
+        thisenv = &envs[ENVX(sys_getenvid())];
+  800fd3:	e8 c1 fb ff ff       	call   800b99 <sys_getenvid>
+  800fd8:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800fdd:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800fe0:	c1 e0 04             	shl    $0x4,%eax
+  800fe3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800fe8:	a3 08 40 80 00       	mov    %eax,0x804008
+        return 0;
+  800fed:	e9 6c 01 00 00       	jmp    80115e <fork+0x1b9>
+        panic("fork: sys_exofork error: %e", envid);
+  800ff2:	50                   	push   %eax
+  800ff3:	68 91 2d 80 00       	push   $0x802d91
+  800ff8:	6a 6f                	push   $0x6f
+  800ffa:	68 5c 2d 80 00       	push   $0x802d5c
+  800fff:	e8 53 f1 ff ff       	call   800157 <_panic>
+        if ((r = sys_page_map(0, vptr, envid, vptr, uvpt[pn] & PTE_SYSCALL)) < 0)
+  801004:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80100b:	83 ec 0c             	sub    $0xc,%esp
+  80100e:	25 07 0e 00 00       	and    $0xe07,%eax
+  801013:	50                   	push   %eax
+  801014:	57                   	push   %edi
+  801015:	56                   	push   %esi
+  801016:	57                   	push   %edi
+  801017:	6a 00                	push   $0x0
+  801019:	e8 fc fb ff ff       	call   800c1a <sys_page_map>
+  80101e:	83 c4 20             	add    $0x20,%esp
+  801021:	85 c0                	test   %eax,%eax
+  801023:	79 3e                	jns    801063 <fork+0xbe>
+            panic("duppage :in sys_page_map %e", r);
+  801025:	50                   	push   %eax
+  801026:	68 ad 2d 80 00       	push   $0x802dad
+  80102b:	6a 49                	push   $0x49
+  80102d:	68 5c 2d 80 00       	push   $0x802d5c
+  801032:	e8 20 f1 ff ff       	call   800157 <_panic>
+            panic("duppage :in sys_page_map %e", r);
+  801037:	50                   	push   %eax
+  801038:	68 ad 2d 80 00       	push   $0x802dad
+  80103d:	6a 4e                	push   $0x4e
+  80103f:	68 5c 2d 80 00       	push   $0x802d5c
+  801044:	e8 0e f1 ff ff       	call   800157 <_panic>
+    } else if ((r = sys_page_map(0, vptr, envid, vptr, PTE_P | PTE_U)) < 0)
+  801049:	83 ec 0c             	sub    $0xc,%esp
+  80104c:	6a 05                	push   $0x5
+  80104e:	57                   	push   %edi
+  80104f:	56                   	push   %esi
+  801050:	57                   	push   %edi
+  801051:	6a 00                	push   $0x0
+  801053:	e8 c2 fb ff ff       	call   800c1a <sys_page_map>
+  801058:	83 c4 20             	add    $0x20,%esp
+  80105b:	85 c0                	test   %eax,%eax
+  80105d:	0f 88 ab 00 00 00    	js     80110e <fork+0x169>
+    for (addr = 0; addr < UTOP; addr += PGSIZE) {
+  801063:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801069:	81 fb 00 00 c0 ee    	cmp    $0xeec00000,%ebx
+  80106f:	0f 84 ab 00 00 00    	je     801120 <fork+0x17b>
+        if (uvpd[PDX(addr)] & PTE_P && uvpt[PGNUM(addr)] & PTE_P && addr != UXSTACKTOP - PGSIZE) {
+  801075:	89 d8                	mov    %ebx,%eax
+  801077:	c1 e8 16             	shr    $0x16,%eax
+  80107a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801081:	a8 01                	test   $0x1,%al
+  801083:	74 de                	je     801063 <fork+0xbe>
+  801085:	89 d8                	mov    %ebx,%eax
+  801087:	c1 e8 0c             	shr    $0xc,%eax
+  80108a:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801091:	f6 c2 01             	test   $0x1,%dl
+  801094:	74 cd                	je     801063 <fork+0xbe>
+  801096:	81 fb 00 f0 bf ee    	cmp    $0xeebff000,%ebx
+  80109c:	74 c5                	je     801063 <fork+0xbe>
+    void *vptr = (void *) (pn * PGSIZE);
+  80109e:	89 c7                	mov    %eax,%edi
+  8010a0:	c1 e7 0c             	shl    $0xc,%edi
+    if (uvpt[pn] & PTE_SHARE) {
+  8010a3:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8010aa:	f6 c6 04             	test   $0x4,%dh
+  8010ad:	0f 85 51 ff ff ff    	jne    801004 <fork+0x5f>
+    } else if (uvpt[pn] & (PTE_W | PTE_COW)) {
+  8010b3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8010ba:	a9 02 08 00 00       	test   $0x802,%eax
+  8010bf:	74 88                	je     801049 <fork+0xa4>
+        if ((r = sys_page_map(0, vptr, envid, vptr, PTE_P | PTE_U | PTE_COW)) < 0)
+  8010c1:	83 ec 0c             	sub    $0xc,%esp
+  8010c4:	68 05 08 00 00       	push   $0x805
+  8010c9:	57                   	push   %edi
+  8010ca:	56                   	push   %esi
+  8010cb:	57                   	push   %edi
+  8010cc:	6a 00                	push   $0x0
+  8010ce:	e8 47 fb ff ff       	call   800c1a <sys_page_map>
+  8010d3:	83 c4 20             	add    $0x20,%esp
+  8010d6:	85 c0                	test   %eax,%eax
+  8010d8:	0f 88 59 ff ff ff    	js     801037 <fork+0x92>
+        if ((r = sys_page_map(0, vptr, 0, vptr, PTE_P | PTE_U | PTE_COW)) < 0)
+  8010de:	83 ec 0c             	sub    $0xc,%esp
+  8010e1:	68 05 08 00 00       	push   $0x805
+  8010e6:	57                   	push   %edi
+  8010e7:	6a 00                	push   $0x0
+  8010e9:	57                   	push   %edi
+  8010ea:	6a 00                	push   $0x0
+  8010ec:	e8 29 fb ff ff       	call   800c1a <sys_page_map>
+  8010f1:	83 c4 20             	add    $0x20,%esp
+  8010f4:	85 c0                	test   %eax,%eax
+  8010f6:	0f 89 67 ff ff ff    	jns    801063 <fork+0xbe>
+            panic("duppage :in sys_page_map %e", r);
+  8010fc:	50                   	push   %eax
+  8010fd:	68 ad 2d 80 00       	push   $0x802dad
+  801102:	6a 50                	push   $0x50
+  801104:	68 5c 2d 80 00       	push   $0x802d5c
+  801109:	e8 49 f0 ff ff       	call   800157 <_panic>
+        panic("duppage :in sys_page_map %e", r);
+  80110e:	50                   	push   %eax
+  80110f:	68 ad 2d 80 00       	push   $0x802dad
+  801114:	6a 53                	push   $0x53
+  801116:	68 5c 2d 80 00       	push   $0x802d5c
+  80111b:	e8 37 f0 ff ff       	call   800157 <_panic>
+            duppage(envid, PGNUM(addr));
+        }
+    }
+    if (sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W))
+  801120:	83 ec 04             	sub    $0x4,%esp
+  801123:	6a 07                	push   $0x7
+  801125:	68 00 f0 bf ee       	push   $0xeebff000
+  80112a:	56                   	push   %esi
+  80112b:	e8 a7 fa ff ff       	call   800bd7 <sys_page_alloc>
+  801130:	83 c4 10             	add    $0x10,%esp
+  801133:	85 c0                	test   %eax,%eax
+  801135:	75 31                	jne    801168 <fork+0x1c3>
+        panic("fork: sys_page_alloc failed");
+    if (sys_env_set_pgfault_upcall(envid, _pgfault_upcall))
+  801137:	83 ec 08             	sub    $0x8,%esp
+  80113a:	68 44 24 80 00       	push   $0x802444
+  80113f:	56                   	push   %esi
+  801140:	e8 dd fb ff ff       	call   800d22 <sys_env_set_pgfault_upcall>
+  801145:	83 c4 10             	add    $0x10,%esp
+  801148:	85 c0                	test   %eax,%eax
+  80114a:	75 30                	jne    80117c <fork+0x1d7>
+        panic("fork: sys_env_set_pgfault_upcall failed");
+    if (sys_env_set_status(envid, ENV_RUNNABLE))
+  80114c:	83 ec 08             	sub    $0x8,%esp
+  80114f:	6a 02                	push   $0x2
+  801151:	56                   	push   %esi
+  801152:	e8 47 fb ff ff       	call   800c9e <sys_env_set_status>
+  801157:	83 c4 10             	add    $0x10,%esp
+  80115a:	85 c0                	test   %eax,%eax
+  80115c:	75 32                	jne    801190 <fork+0x1eb>
+        panic("fork: sys_env_set_status failed");
+
+    return envid;
+
+}
+  80115e:	89 f0                	mov    %esi,%eax
+  801160:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801163:	5b                   	pop    %ebx
+  801164:	5e                   	pop    %esi
+  801165:	5f                   	pop    %edi
+  801166:	5d                   	pop    %ebp
+  801167:	c3                   	ret
+        panic("fork: sys_page_alloc failed");
+  801168:	83 ec 04             	sub    $0x4,%esp
+  80116b:	68 c9 2d 80 00       	push   $0x802dc9
+  801170:	6a 7d                	push   $0x7d
+  801172:	68 5c 2d 80 00       	push   $0x802d5c
+  801177:	e8 db ef ff ff       	call   800157 <_panic>
+        panic("fork: sys_env_set_pgfault_upcall failed");
+  80117c:	83 ec 04             	sub    $0x4,%esp
+  80117f:	68 14 2d 80 00       	push   $0x802d14
+  801184:	6a 7f                	push   $0x7f
+  801186:	68 5c 2d 80 00       	push   $0x802d5c
+  80118b:	e8 c7 ef ff ff       	call   800157 <_panic>
+        panic("fork: sys_env_set_status failed");
+  801190:	83 ec 04             	sub    $0x4,%esp
+  801193:	68 3c 2d 80 00       	push   $0x802d3c
+  801198:	68 81 00 00 00       	push   $0x81
+  80119d:	68 5c 2d 80 00       	push   $0x802d5c
+  8011a2:	e8 b0 ef ff ff       	call   800157 <_panic>
+
+008011a7 <sfork>:
+
+// Challenge!
+int
+sfork(void) {
+  8011a7:	55                   	push   %ebp
+  8011a8:	89 e5                	mov    %esp,%ebp
+  8011aa:	83 ec 0c             	sub    $0xc,%esp
+    panic("sfork not implemented");
+  8011ad:	68 e5 2d 80 00       	push   $0x802de5
+  8011b2:	68 8a 00 00 00       	push   $0x8a
+  8011b7:	68 5c 2d 80 00       	push   $0x802d5c
+  8011bc:	e8 96 ef ff ff       	call   800157 <_panic>
+
+008011c1 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  8011c1:	55                   	push   %ebp
+  8011c2:	89 e5                	mov    %esp,%ebp
+  8011c4:	56                   	push   %esi
+  8011c5:	53                   	push   %ebx
+  8011c6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8011c9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8011cc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  8011cf:	85 c0                	test   %eax,%eax
+  8011d1:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8011d6:	0f 44 c2             	cmove  %edx,%eax
+  8011d9:	83 ec 0c             	sub    $0xc,%esp
+  8011dc:	50                   	push   %eax
+  8011dd:	e8 a5 fb ff ff       	call   800d87 <sys_ipc_recv>
+
+  if (from_env_store)
+  8011e2:	83 c4 10             	add    $0x10,%esp
+  8011e5:	85 f6                	test   %esi,%esi
+  8011e7:	74 17                	je     801200 <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  8011e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011ee:	85 c0                	test   %eax,%eax
+  8011f0:	75 0c                	jne    8011fe <ipc_recv+0x3d>
+  8011f2:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  8011f8:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  8011fe:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  801200:	85 db                	test   %ebx,%ebx
+  801202:	74 2b                	je     80122f <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  801204:	85 c0                	test   %eax,%eax
+  801206:	74 0d                	je     801215 <ipc_recv+0x54>
+  801208:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  80120e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801211:	5b                   	pop    %ebx
+  801212:	5e                   	pop    %esi
+  801213:	5d                   	pop    %ebp
+  801214:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  801215:	a1 08 40 80 00       	mov    0x804008,%eax
+  80121a:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  801220:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  801222:	a1 08 40 80 00       	mov    0x804008,%eax
+  801227:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  80122d:	eb df                	jmp    80120e <ipc_recv+0x4d>
+  80122f:	85 c0                	test   %eax,%eax
+  801231:	75 db                	jne    80120e <ipc_recv+0x4d>
+  801233:	eb ed                	jmp    801222 <ipc_recv+0x61>
+
+00801235 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  801235:	55                   	push   %ebp
+  801236:	89 e5                	mov    %esp,%ebp
+  801238:	57                   	push   %edi
+  801239:	56                   	push   %esi
+  80123a:	53                   	push   %ebx
+  80123b:	83 ec 0c             	sub    $0xc,%esp
+  80123e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801241:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801244:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  801247:	85 db                	test   %ebx,%ebx
+  801249:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80124e:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  801251:	ff 75 14             	push   0x14(%ebp)
+  801254:	53                   	push   %ebx
+  801255:	56                   	push   %esi
+  801256:	57                   	push   %edi
+  801257:	e8 08 fb ff ff       	call   800d64 <sys_ipc_try_send>
+  80125c:	83 c4 10             	add    $0x10,%esp
+  80125f:	85 c0                	test   %eax,%eax
+  801261:	74 1e                	je     801281 <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  801263:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801266:	75 07                	jne    80126f <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  801268:	e8 4b f9 ff ff       	call   800bb8 <sys_yield>
+  80126d:	eb e2                	jmp    801251 <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  80126f:	50                   	push   %eax
+  801270:	68 fb 2d 80 00       	push   $0x802dfb
+  801275:	6a 3c                	push   $0x3c
+  801277:	68 08 2e 80 00       	push   $0x802e08
+  80127c:	e8 d6 ee ff ff       	call   800157 <_panic>
+  }
+
+#endif
+}
+  801281:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801284:	5b                   	pop    %ebx
+  801285:	5e                   	pop    %esi
+  801286:	5f                   	pop    %edi
+  801287:	5d                   	pop    %ebp
+  801288:	c3                   	ret
+
+00801289 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  801289:	55                   	push   %ebp
+  80128a:	89 e5                	mov    %esp,%ebp
+  80128c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  80128f:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  801294:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  801297:	c1 e0 04             	shl    $0x4,%eax
+  80129a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80129f:	8b 40 50             	mov    0x50(%eax),%eax
+  8012a2:	39 c8                	cmp    %ecx,%eax
+  8012a4:	74 12                	je     8012b8 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  8012a6:	83 c2 01             	add    $0x1,%edx
+  8012a9:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8012af:	75 e3                	jne    801294 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  8012b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012b6:	eb 0e                	jmp    8012c6 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  8012b8:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8012bb:	c1 e0 04             	shl    $0x4,%eax
+  8012be:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8012c3:	8b 40 48             	mov    0x48(%eax),%eax
+  8012c6:	5d                   	pop    %ebp
+  8012c7:	c3                   	ret
+
+008012c8 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8012c8:	55                   	push   %ebp
+  8012c9:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8012cb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8012ce:	05 00 00 00 30       	add    $0x30000000,%eax
+  8012d3:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8012d6:	5d                   	pop    %ebp
+  8012d7:	c3                   	ret
+
+008012d8 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8012d8:	55                   	push   %ebp
+  8012d9:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8012db:	8b 45 08             	mov    0x8(%ebp),%eax
+  8012de:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8012e3:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8012e8:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8012ed:	5d                   	pop    %ebp
+  8012ee:	c3                   	ret
+
+008012ef <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8012ef:	55                   	push   %ebp
+  8012f0:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8012f2:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8012f7:	eb 02                	jmp    8012fb <fd_alloc+0xc>
+  8012f9:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8012fb:	89 c2                	mov    %eax,%edx
+  8012fd:	c1 ea 16             	shr    $0x16,%edx
+  801300:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801307:	f6 c2 01             	test   $0x1,%dl
+  80130a:	74 2b                	je     801337 <fd_alloc+0x48>
+  80130c:	89 c2                	mov    %eax,%edx
+  80130e:	c1 ea 0c             	shr    $0xc,%edx
+  801311:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801318:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80131e:	f6 c1 01             	test   $0x1,%cl
+  801321:	74 14                	je     801337 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801323:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801329:	75 ce                	jne    8012f9 <fd_alloc+0xa>
+  80132b:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801330:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801335:	eb 05                	jmp    80133c <fd_alloc+0x4d>
+			return 0;
+  801337:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80133c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80133f:	89 02                	mov    %eax,(%edx)
+}
+  801341:	89 c8                	mov    %ecx,%eax
+  801343:	5d                   	pop    %ebp
+  801344:	c3                   	ret
+
+00801345 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801345:	55                   	push   %ebp
+  801346:	89 e5                	mov    %esp,%ebp
+  801348:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80134b:	83 f8 1f             	cmp    $0x1f,%eax
+  80134e:	77 30                	ja     801380 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801350:	c1 e0 0c             	shl    $0xc,%eax
+  801353:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801358:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80135e:	f6 c2 01             	test   $0x1,%dl
+  801361:	74 24                	je     801387 <fd_lookup+0x42>
+  801363:	89 c2                	mov    %eax,%edx
+  801365:	c1 ea 0c             	shr    $0xc,%edx
+  801368:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80136f:	f6 c2 01             	test   $0x1,%dl
+  801372:	74 1a                	je     80138e <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801374:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801377:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801379:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80137e:	5d                   	pop    %ebp
+  80137f:	c3                   	ret
+		return -E_INVAL;
+  801380:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801385:	eb f7                	jmp    80137e <fd_lookup+0x39>
+		return -E_INVAL;
+  801387:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80138c:	eb f0                	jmp    80137e <fd_lookup+0x39>
+  80138e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801393:	eb e9                	jmp    80137e <fd_lookup+0x39>
+
+00801395 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801395:	55                   	push   %ebp
+  801396:	89 e5                	mov    %esp,%ebp
+  801398:	53                   	push   %ebx
+  801399:	83 ec 04             	sub    $0x4,%esp
+  80139c:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80139f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013a4:	eb 03                	jmp    8013a9 <dev_lookup+0x14>
+  8013a6:	83 c0 01             	add    $0x1,%eax
+  8013a9:	8b 1c 85 90 2e 80 00 	mov    0x802e90(,%eax,4),%ebx
+  8013b0:	85 db                	test   %ebx,%ebx
+  8013b2:	74 0b                	je     8013bf <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8013b4:	39 13                	cmp    %edx,(%ebx)
+  8013b6:	75 ee                	jne    8013a6 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8013b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013bd:	eb 1f                	jmp    8013de <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8013bf:	a1 08 40 80 00       	mov    0x804008,%eax
+  8013c4:	8b 40 48             	mov    0x48(%eax),%eax
+  8013c7:	83 ec 04             	sub    $0x4,%esp
+  8013ca:	52                   	push   %edx
+  8013cb:	50                   	push   %eax
+  8013cc:	68 14 2e 80 00       	push   $0x802e14
+  8013d1:	e8 5c ee ff ff       	call   800232 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8013d6:	83 c4 10             	add    $0x10,%esp
+  8013d9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8013de:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8013e1:	89 1a                	mov    %ebx,(%edx)
+}
+  8013e3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013e6:	c9                   	leave
+  8013e7:	c3                   	ret
+
+008013e8 <fd_close>:
+{
+  8013e8:	55                   	push   %ebp
+  8013e9:	89 e5                	mov    %esp,%ebp
+  8013eb:	57                   	push   %edi
+  8013ec:	56                   	push   %esi
+  8013ed:	53                   	push   %ebx
+  8013ee:	83 ec 24             	sub    $0x24,%esp
+  8013f1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8013f4:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8013f7:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8013fa:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8013fb:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801401:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801404:	50                   	push   %eax
+  801405:	e8 3b ff ff ff       	call   801345 <fd_lookup>
+  80140a:	89 c3                	mov    %eax,%ebx
+  80140c:	83 c4 10             	add    $0x10,%esp
+  80140f:	85 c0                	test   %eax,%eax
+  801411:	78 05                	js     801418 <fd_close+0x30>
+	    || fd != fd2)
+  801413:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801416:	74 16                	je     80142e <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801418:	89 f8                	mov    %edi,%eax
+  80141a:	84 c0                	test   %al,%al
+  80141c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801421:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801424:	89 d8                	mov    %ebx,%eax
+  801426:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801429:	5b                   	pop    %ebx
+  80142a:	5e                   	pop    %esi
+  80142b:	5f                   	pop    %edi
+  80142c:	5d                   	pop    %ebp
+  80142d:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80142e:	83 ec 08             	sub    $0x8,%esp
+  801431:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801434:	50                   	push   %eax
+  801435:	ff 36                	push   (%esi)
+  801437:	e8 59 ff ff ff       	call   801395 <dev_lookup>
+  80143c:	89 c3                	mov    %eax,%ebx
+  80143e:	83 c4 10             	add    $0x10,%esp
+  801441:	85 c0                	test   %eax,%eax
+  801443:	78 1a                	js     80145f <fd_close+0x77>
+		if (dev->dev_close)
+  801445:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801448:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80144b:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801450:	85 c0                	test   %eax,%eax
+  801452:	74 0b                	je     80145f <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801454:	83 ec 0c             	sub    $0xc,%esp
+  801457:	56                   	push   %esi
+  801458:	ff d0                	call   *%eax
+  80145a:	89 c3                	mov    %eax,%ebx
+  80145c:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80145f:	83 ec 08             	sub    $0x8,%esp
+  801462:	56                   	push   %esi
+  801463:	6a 00                	push   $0x0
+  801465:	e8 f2 f7 ff ff       	call   800c5c <sys_page_unmap>
+	return r;
+  80146a:	83 c4 10             	add    $0x10,%esp
+  80146d:	eb b5                	jmp    801424 <fd_close+0x3c>
+
+0080146f <close>:
+
+int
+close(int fdnum)
+{
+  80146f:	55                   	push   %ebp
+  801470:	89 e5                	mov    %esp,%ebp
+  801472:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801475:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801478:	50                   	push   %eax
+  801479:	ff 75 08             	push   0x8(%ebp)
+  80147c:	e8 c4 fe ff ff       	call   801345 <fd_lookup>
+  801481:	83 c4 10             	add    $0x10,%esp
+  801484:	85 c0                	test   %eax,%eax
+  801486:	79 02                	jns    80148a <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801488:	c9                   	leave
+  801489:	c3                   	ret
+		return fd_close(fd, 1);
+  80148a:	83 ec 08             	sub    $0x8,%esp
+  80148d:	6a 01                	push   $0x1
+  80148f:	ff 75 f4             	push   -0xc(%ebp)
+  801492:	e8 51 ff ff ff       	call   8013e8 <fd_close>
+  801497:	83 c4 10             	add    $0x10,%esp
+  80149a:	eb ec                	jmp    801488 <close+0x19>
+
+0080149c <close_all>:
+
+void
+close_all(void)
+{
+  80149c:	55                   	push   %ebp
+  80149d:	89 e5                	mov    %esp,%ebp
+  80149f:	53                   	push   %ebx
+  8014a0:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8014a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8014a8:	83 ec 0c             	sub    $0xc,%esp
+  8014ab:	53                   	push   %ebx
+  8014ac:	e8 be ff ff ff       	call   80146f <close>
+	for (i = 0; i < MAXFD; i++)
+  8014b1:	83 c3 01             	add    $0x1,%ebx
+  8014b4:	83 c4 10             	add    $0x10,%esp
+  8014b7:	83 fb 20             	cmp    $0x20,%ebx
+  8014ba:	75 ec                	jne    8014a8 <close_all+0xc>
+}
+  8014bc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014bf:	c9                   	leave
+  8014c0:	c3                   	ret
+
+008014c1 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8014c1:	55                   	push   %ebp
+  8014c2:	89 e5                	mov    %esp,%ebp
+  8014c4:	57                   	push   %edi
+  8014c5:	56                   	push   %esi
+  8014c6:	53                   	push   %ebx
+  8014c7:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8014ca:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8014cd:	50                   	push   %eax
+  8014ce:	ff 75 08             	push   0x8(%ebp)
+  8014d1:	e8 6f fe ff ff       	call   801345 <fd_lookup>
+  8014d6:	89 c3                	mov    %eax,%ebx
+  8014d8:	83 c4 10             	add    $0x10,%esp
+  8014db:	85 c0                	test   %eax,%eax
+  8014dd:	78 7f                	js     80155e <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8014df:	83 ec 0c             	sub    $0xc,%esp
+  8014e2:	ff 75 0c             	push   0xc(%ebp)
+  8014e5:	e8 85 ff ff ff       	call   80146f <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8014ea:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8014ed:	c1 e6 0c             	shl    $0xc,%esi
+  8014f0:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8014f6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8014f9:	89 3c 24             	mov    %edi,(%esp)
+  8014fc:	e8 d7 fd ff ff       	call   8012d8 <fd2data>
+  801501:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801503:	89 34 24             	mov    %esi,(%esp)
+  801506:	e8 cd fd ff ff       	call   8012d8 <fd2data>
+  80150b:	83 c4 10             	add    $0x10,%esp
+  80150e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801511:	89 d8                	mov    %ebx,%eax
+  801513:	c1 e8 16             	shr    $0x16,%eax
+  801516:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80151d:	a8 01                	test   $0x1,%al
+  80151f:	74 11                	je     801532 <dup+0x71>
+  801521:	89 d8                	mov    %ebx,%eax
+  801523:	c1 e8 0c             	shr    $0xc,%eax
+  801526:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80152d:	f6 c2 01             	test   $0x1,%dl
+  801530:	75 36                	jne    801568 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801532:	89 f8                	mov    %edi,%eax
+  801534:	c1 e8 0c             	shr    $0xc,%eax
+  801537:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80153e:	83 ec 0c             	sub    $0xc,%esp
+  801541:	25 07 0e 00 00       	and    $0xe07,%eax
+  801546:	50                   	push   %eax
+  801547:	56                   	push   %esi
+  801548:	6a 00                	push   $0x0
+  80154a:	57                   	push   %edi
+  80154b:	6a 00                	push   $0x0
+  80154d:	e8 c8 f6 ff ff       	call   800c1a <sys_page_map>
+  801552:	89 c3                	mov    %eax,%ebx
+  801554:	83 c4 20             	add    $0x20,%esp
+  801557:	85 c0                	test   %eax,%eax
+  801559:	78 33                	js     80158e <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80155b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80155e:	89 d8                	mov    %ebx,%eax
+  801560:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801563:	5b                   	pop    %ebx
+  801564:	5e                   	pop    %esi
+  801565:	5f                   	pop    %edi
+  801566:	5d                   	pop    %ebp
+  801567:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801568:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80156f:	83 ec 0c             	sub    $0xc,%esp
+  801572:	25 07 0e 00 00       	and    $0xe07,%eax
+  801577:	50                   	push   %eax
+  801578:	ff 75 d4             	push   -0x2c(%ebp)
+  80157b:	6a 00                	push   $0x0
+  80157d:	53                   	push   %ebx
+  80157e:	6a 00                	push   $0x0
+  801580:	e8 95 f6 ff ff       	call   800c1a <sys_page_map>
+  801585:	89 c3                	mov    %eax,%ebx
+  801587:	83 c4 20             	add    $0x20,%esp
+  80158a:	85 c0                	test   %eax,%eax
+  80158c:	79 a4                	jns    801532 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80158e:	83 ec 08             	sub    $0x8,%esp
+  801591:	56                   	push   %esi
+  801592:	6a 00                	push   $0x0
+  801594:	e8 c3 f6 ff ff       	call   800c5c <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801599:	83 c4 08             	add    $0x8,%esp
+  80159c:	ff 75 d4             	push   -0x2c(%ebp)
+  80159f:	6a 00                	push   $0x0
+  8015a1:	e8 b6 f6 ff ff       	call   800c5c <sys_page_unmap>
+	return r;
+  8015a6:	83 c4 10             	add    $0x10,%esp
+  8015a9:	eb b3                	jmp    80155e <dup+0x9d>
+
+008015ab <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8015ab:	55                   	push   %ebp
+  8015ac:	89 e5                	mov    %esp,%ebp
+  8015ae:	56                   	push   %esi
+  8015af:	53                   	push   %ebx
+  8015b0:	83 ec 18             	sub    $0x18,%esp
+  8015b3:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015b6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8015b9:	50                   	push   %eax
+  8015ba:	56                   	push   %esi
+  8015bb:	e8 85 fd ff ff       	call   801345 <fd_lookup>
+  8015c0:	83 c4 10             	add    $0x10,%esp
+  8015c3:	85 c0                	test   %eax,%eax
+  8015c5:	78 3c                	js     801603 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8015c7:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8015ca:	83 ec 08             	sub    $0x8,%esp
+  8015cd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015d0:	50                   	push   %eax
+  8015d1:	ff 33                	push   (%ebx)
+  8015d3:	e8 bd fd ff ff       	call   801395 <dev_lookup>
+  8015d8:	83 c4 10             	add    $0x10,%esp
+  8015db:	85 c0                	test   %eax,%eax
+  8015dd:	78 24                	js     801603 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8015df:	8b 43 08             	mov    0x8(%ebx),%eax
+  8015e2:	83 e0 03             	and    $0x3,%eax
+  8015e5:	83 f8 01             	cmp    $0x1,%eax
+  8015e8:	74 20                	je     80160a <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8015ea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015ed:	8b 40 08             	mov    0x8(%eax),%eax
+  8015f0:	85 c0                	test   %eax,%eax
+  8015f2:	74 37                	je     80162b <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8015f4:	83 ec 04             	sub    $0x4,%esp
+  8015f7:	ff 75 10             	push   0x10(%ebp)
+  8015fa:	ff 75 0c             	push   0xc(%ebp)
+  8015fd:	53                   	push   %ebx
+  8015fe:	ff d0                	call   *%eax
+  801600:	83 c4 10             	add    $0x10,%esp
+}
+  801603:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801606:	5b                   	pop    %ebx
+  801607:	5e                   	pop    %esi
+  801608:	5d                   	pop    %ebp
+  801609:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80160a:	a1 08 40 80 00       	mov    0x804008,%eax
+  80160f:	8b 40 48             	mov    0x48(%eax),%eax
+  801612:	83 ec 04             	sub    $0x4,%esp
+  801615:	56                   	push   %esi
+  801616:	50                   	push   %eax
+  801617:	68 55 2e 80 00       	push   $0x802e55
+  80161c:	e8 11 ec ff ff       	call   800232 <cprintf>
+		return -E_INVAL;
+  801621:	83 c4 10             	add    $0x10,%esp
+  801624:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801629:	eb d8                	jmp    801603 <read+0x58>
+		return -E_NOT_SUPP;
+  80162b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801630:	eb d1                	jmp    801603 <read+0x58>
+
+00801632 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801632:	55                   	push   %ebp
+  801633:	89 e5                	mov    %esp,%ebp
+  801635:	57                   	push   %edi
+  801636:	56                   	push   %esi
+  801637:	53                   	push   %ebx
+  801638:	83 ec 0c             	sub    $0xc,%esp
+  80163b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80163e:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801641:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801646:	eb 02                	jmp    80164a <readn+0x18>
+  801648:	01 c3                	add    %eax,%ebx
+  80164a:	39 f3                	cmp    %esi,%ebx
+  80164c:	73 21                	jae    80166f <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80164e:	83 ec 04             	sub    $0x4,%esp
+  801651:	89 f0                	mov    %esi,%eax
+  801653:	29 d8                	sub    %ebx,%eax
+  801655:	50                   	push   %eax
+  801656:	89 d8                	mov    %ebx,%eax
+  801658:	03 45 0c             	add    0xc(%ebp),%eax
+  80165b:	50                   	push   %eax
+  80165c:	57                   	push   %edi
+  80165d:	e8 49 ff ff ff       	call   8015ab <read>
+		if (m < 0)
+  801662:	83 c4 10             	add    $0x10,%esp
+  801665:	85 c0                	test   %eax,%eax
+  801667:	78 04                	js     80166d <readn+0x3b>
+			return m;
+		if (m == 0)
+  801669:	75 dd                	jne    801648 <readn+0x16>
+  80166b:	eb 02                	jmp    80166f <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80166d:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80166f:	89 d8                	mov    %ebx,%eax
+  801671:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801674:	5b                   	pop    %ebx
+  801675:	5e                   	pop    %esi
+  801676:	5f                   	pop    %edi
+  801677:	5d                   	pop    %ebp
+  801678:	c3                   	ret
+
+00801679 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801679:	55                   	push   %ebp
+  80167a:	89 e5                	mov    %esp,%ebp
+  80167c:	56                   	push   %esi
+  80167d:	53                   	push   %ebx
+  80167e:	83 ec 18             	sub    $0x18,%esp
+  801681:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801684:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801687:	50                   	push   %eax
+  801688:	53                   	push   %ebx
+  801689:	e8 b7 fc ff ff       	call   801345 <fd_lookup>
+  80168e:	83 c4 10             	add    $0x10,%esp
+  801691:	85 c0                	test   %eax,%eax
+  801693:	78 37                	js     8016cc <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801695:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801698:	83 ec 08             	sub    $0x8,%esp
+  80169b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80169e:	50                   	push   %eax
+  80169f:	ff 36                	push   (%esi)
+  8016a1:	e8 ef fc ff ff       	call   801395 <dev_lookup>
+  8016a6:	83 c4 10             	add    $0x10,%esp
+  8016a9:	85 c0                	test   %eax,%eax
+  8016ab:	78 1f                	js     8016cc <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8016ad:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8016b1:	74 20                	je     8016d3 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8016b3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016b6:	8b 40 0c             	mov    0xc(%eax),%eax
+  8016b9:	85 c0                	test   %eax,%eax
+  8016bb:	74 37                	je     8016f4 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8016bd:	83 ec 04             	sub    $0x4,%esp
+  8016c0:	ff 75 10             	push   0x10(%ebp)
+  8016c3:	ff 75 0c             	push   0xc(%ebp)
+  8016c6:	56                   	push   %esi
+  8016c7:	ff d0                	call   *%eax
+  8016c9:	83 c4 10             	add    $0x10,%esp
+}
+  8016cc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016cf:	5b                   	pop    %ebx
+  8016d0:	5e                   	pop    %esi
+  8016d1:	5d                   	pop    %ebp
+  8016d2:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8016d3:	a1 08 40 80 00       	mov    0x804008,%eax
+  8016d8:	8b 40 48             	mov    0x48(%eax),%eax
+  8016db:	83 ec 04             	sub    $0x4,%esp
+  8016de:	53                   	push   %ebx
+  8016df:	50                   	push   %eax
+  8016e0:	68 71 2e 80 00       	push   $0x802e71
+  8016e5:	e8 48 eb ff ff       	call   800232 <cprintf>
+		return -E_INVAL;
+  8016ea:	83 c4 10             	add    $0x10,%esp
+  8016ed:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016f2:	eb d8                	jmp    8016cc <write+0x53>
+		return -E_NOT_SUPP;
+  8016f4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016f9:	eb d1                	jmp    8016cc <write+0x53>
+
+008016fb <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8016fb:	55                   	push   %ebp
+  8016fc:	89 e5                	mov    %esp,%ebp
+  8016fe:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801701:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801704:	50                   	push   %eax
+  801705:	ff 75 08             	push   0x8(%ebp)
+  801708:	e8 38 fc ff ff       	call   801345 <fd_lookup>
+  80170d:	83 c4 10             	add    $0x10,%esp
+  801710:	85 c0                	test   %eax,%eax
+  801712:	78 0e                	js     801722 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801714:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801717:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80171a:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80171d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801722:	c9                   	leave
+  801723:	c3                   	ret
+
+00801724 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801724:	55                   	push   %ebp
+  801725:	89 e5                	mov    %esp,%ebp
+  801727:	56                   	push   %esi
+  801728:	53                   	push   %ebx
+  801729:	83 ec 18             	sub    $0x18,%esp
+  80172c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80172f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801732:	50                   	push   %eax
+  801733:	53                   	push   %ebx
+  801734:	e8 0c fc ff ff       	call   801345 <fd_lookup>
+  801739:	83 c4 10             	add    $0x10,%esp
+  80173c:	85 c0                	test   %eax,%eax
+  80173e:	78 34                	js     801774 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801740:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801743:	83 ec 08             	sub    $0x8,%esp
+  801746:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801749:	50                   	push   %eax
+  80174a:	ff 36                	push   (%esi)
+  80174c:	e8 44 fc ff ff       	call   801395 <dev_lookup>
+  801751:	83 c4 10             	add    $0x10,%esp
+  801754:	85 c0                	test   %eax,%eax
+  801756:	78 1c                	js     801774 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801758:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80175c:	74 1d                	je     80177b <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80175e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801761:	8b 40 18             	mov    0x18(%eax),%eax
+  801764:	85 c0                	test   %eax,%eax
+  801766:	74 34                	je     80179c <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801768:	83 ec 08             	sub    $0x8,%esp
+  80176b:	ff 75 0c             	push   0xc(%ebp)
+  80176e:	56                   	push   %esi
+  80176f:	ff d0                	call   *%eax
+  801771:	83 c4 10             	add    $0x10,%esp
+}
+  801774:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801777:	5b                   	pop    %ebx
+  801778:	5e                   	pop    %esi
+  801779:	5d                   	pop    %ebp
+  80177a:	c3                   	ret
+			thisenv->env_id, fdnum);
+  80177b:	a1 08 40 80 00       	mov    0x804008,%eax
+  801780:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801783:	83 ec 04             	sub    $0x4,%esp
+  801786:	53                   	push   %ebx
+  801787:	50                   	push   %eax
+  801788:	68 34 2e 80 00       	push   $0x802e34
+  80178d:	e8 a0 ea ff ff       	call   800232 <cprintf>
+		return -E_INVAL;
+  801792:	83 c4 10             	add    $0x10,%esp
+  801795:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80179a:	eb d8                	jmp    801774 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  80179c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017a1:	eb d1                	jmp    801774 <ftruncate+0x50>
+
+008017a3 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8017a3:	55                   	push   %ebp
+  8017a4:	89 e5                	mov    %esp,%ebp
+  8017a6:	56                   	push   %esi
+  8017a7:	53                   	push   %ebx
+  8017a8:	83 ec 18             	sub    $0x18,%esp
+  8017ab:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017ae:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017b1:	50                   	push   %eax
+  8017b2:	ff 75 08             	push   0x8(%ebp)
+  8017b5:	e8 8b fb ff ff       	call   801345 <fd_lookup>
+  8017ba:	83 c4 10             	add    $0x10,%esp
+  8017bd:	85 c0                	test   %eax,%eax
+  8017bf:	78 49                	js     80180a <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017c1:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8017c4:	83 ec 08             	sub    $0x8,%esp
+  8017c7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017ca:	50                   	push   %eax
+  8017cb:	ff 36                	push   (%esi)
+  8017cd:	e8 c3 fb ff ff       	call   801395 <dev_lookup>
+  8017d2:	83 c4 10             	add    $0x10,%esp
+  8017d5:	85 c0                	test   %eax,%eax
+  8017d7:	78 31                	js     80180a <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8017d9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017dc:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8017e0:	74 2f                	je     801811 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8017e2:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8017e5:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8017ec:	00 00 00 
+	stat->st_isdir = 0;
+  8017ef:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8017f6:	00 00 00 
+	stat->st_dev = dev;
+  8017f9:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8017ff:	83 ec 08             	sub    $0x8,%esp
+  801802:	53                   	push   %ebx
+  801803:	56                   	push   %esi
+  801804:	ff 50 14             	call   *0x14(%eax)
+  801807:	83 c4 10             	add    $0x10,%esp
+}
+  80180a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80180d:	5b                   	pop    %ebx
+  80180e:	5e                   	pop    %esi
+  80180f:	5d                   	pop    %ebp
+  801810:	c3                   	ret
+		return -E_NOT_SUPP;
+  801811:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801816:	eb f2                	jmp    80180a <fstat+0x67>
+
+00801818 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801818:	55                   	push   %ebp
+  801819:	89 e5                	mov    %esp,%ebp
+  80181b:	56                   	push   %esi
+  80181c:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80181d:	83 ec 08             	sub    $0x8,%esp
+  801820:	6a 00                	push   $0x0
+  801822:	ff 75 08             	push   0x8(%ebp)
+  801825:	e8 e4 01 00 00       	call   801a0e <open>
+  80182a:	89 c3                	mov    %eax,%ebx
+  80182c:	83 c4 10             	add    $0x10,%esp
+  80182f:	85 c0                	test   %eax,%eax
+  801831:	78 1b                	js     80184e <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801833:	83 ec 08             	sub    $0x8,%esp
+  801836:	ff 75 0c             	push   0xc(%ebp)
+  801839:	50                   	push   %eax
+  80183a:	e8 64 ff ff ff       	call   8017a3 <fstat>
+  80183f:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801841:	89 1c 24             	mov    %ebx,(%esp)
+  801844:	e8 26 fc ff ff       	call   80146f <close>
+	return r;
+  801849:	83 c4 10             	add    $0x10,%esp
+  80184c:	89 f3                	mov    %esi,%ebx
+}
+  80184e:	89 d8                	mov    %ebx,%eax
+  801850:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801853:	5b                   	pop    %ebx
+  801854:	5e                   	pop    %esi
+  801855:	5d                   	pop    %ebp
+  801856:	c3                   	ret
+
+00801857 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  801857:	55                   	push   %ebp
+  801858:	89 e5                	mov    %esp,%ebp
+  80185a:	56                   	push   %esi
+  80185b:	53                   	push   %ebx
+  80185c:	89 c6                	mov    %eax,%esi
+  80185e:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  801860:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  801867:	74 27                	je     801890 <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801869:	6a 07                	push   $0x7
+  80186b:	68 00 50 80 00       	push   $0x805000
+  801870:	56                   	push   %esi
+  801871:	ff 35 00 40 80 00    	push   0x804000
+  801877:	e8 b9 f9 ff ff       	call   801235 <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  80187c:	83 c4 0c             	add    $0xc,%esp
+  80187f:	6a 00                	push   $0x0
+  801881:	53                   	push   %ebx
+  801882:	6a 00                	push   $0x0
+  801884:	e8 38 f9 ff ff       	call   8011c1 <ipc_recv>
+}
+  801889:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80188c:	5b                   	pop    %ebx
+  80188d:	5e                   	pop    %esi
+  80188e:	5d                   	pop    %ebp
+  80188f:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  801890:	83 ec 0c             	sub    $0xc,%esp
+  801893:	6a 01                	push   $0x1
+  801895:	e8 ef f9 ff ff       	call   801289 <ipc_find_env>
+  80189a:	a3 00 40 80 00       	mov    %eax,0x804000
+  80189f:	83 c4 10             	add    $0x10,%esp
+  8018a2:	eb c5                	jmp    801869 <fsipc+0x12>
+
+008018a4 <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8018a4:	55                   	push   %ebp
+  8018a5:	89 e5                	mov    %esp,%ebp
+  8018a7:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8018aa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018ad:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018b0:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.set_size.req_size = newsize;
+  8018b5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8018b8:	a3 04 50 80 00       	mov    %eax,0x805004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  8018bd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018c2:	b8 02 00 00 00       	mov    $0x2,%eax
+  8018c7:	e8 8b ff ff ff       	call   801857 <fsipc>
+}
+  8018cc:	c9                   	leave
+  8018cd:	c3                   	ret
+
+008018ce <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8018ce:	55                   	push   %ebp
+  8018cf:	89 e5                	mov    %esp,%ebp
+  8018d1:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8018d4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018d7:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018da:	a3 00 50 80 00       	mov    %eax,0x805000
+  return fsipc(FSREQ_FLUSH, NULL);
+  8018df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018e4:	b8 06 00 00 00       	mov    $0x6,%eax
+  8018e9:	e8 69 ff ff ff       	call   801857 <fsipc>
+}
+  8018ee:	c9                   	leave
+  8018ef:	c3                   	ret
+
+008018f0 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8018f0:	55                   	push   %ebp
+  8018f1:	89 e5                	mov    %esp,%ebp
+  8018f3:	53                   	push   %ebx
+  8018f4:	83 ec 04             	sub    $0x4,%esp
+  8018f7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8018fa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018fd:	8b 40 0c             	mov    0xc(%eax),%eax
+  801900:	a3 00 50 80 00       	mov    %eax,0x805000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801905:	ba 00 00 00 00       	mov    $0x0,%edx
+  80190a:	b8 05 00 00 00       	mov    $0x5,%eax
+  80190f:	e8 43 ff ff ff       	call   801857 <fsipc>
+  801914:	85 c0                	test   %eax,%eax
+  801916:	78 2c                	js     801944 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801918:	83 ec 08             	sub    $0x8,%esp
+  80191b:	68 00 50 80 00       	push   $0x805000
+  801920:	53                   	push   %ebx
+  801921:	e8 c5 ee ff ff       	call   8007eb <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801926:	a1 80 50 80 00       	mov    0x805080,%eax
+  80192b:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801931:	a1 84 50 80 00       	mov    0x805084,%eax
+  801936:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  80193c:	83 c4 10             	add    $0x10,%esp
+  80193f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801944:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801947:	c9                   	leave
+  801948:	c3                   	ret
+
+00801949 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801949:	55                   	push   %ebp
+  80194a:	89 e5                	mov    %esp,%ebp
+  80194c:	83 ec 0c             	sub    $0xc,%esp
+  80194f:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801952:	8b 55 08             	mov    0x8(%ebp),%edx
+  801955:	8b 52 0c             	mov    0xc(%edx),%edx
+  801958:	89 15 00 50 80 00    	mov    %edx,0x805000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80195e:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801963:	39 d0                	cmp    %edx,%eax
+  801965:	0f 47 c2             	cmova  %edx,%eax
+  801968:	a3 04 50 80 00       	mov    %eax,0x805004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  80196d:	50                   	push   %eax
+  80196e:	ff 75 0c             	push   0xc(%ebp)
+  801971:	68 08 50 80 00       	push   $0x805008
+  801976:	e8 f6 ef ff ff       	call   800971 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  80197b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801980:	b8 04 00 00 00       	mov    $0x4,%eax
+  801985:	e8 cd fe ff ff       	call   801857 <fsipc>
+}
+  80198a:	c9                   	leave
+  80198b:	c3                   	ret
+
+0080198c <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80198c:	55                   	push   %ebp
+  80198d:	89 e5                	mov    %esp,%ebp
+  80198f:	56                   	push   %esi
+  801990:	53                   	push   %ebx
+  801991:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801994:	8b 45 08             	mov    0x8(%ebp),%eax
+  801997:	8b 40 0c             	mov    0xc(%eax),%eax
+  80199a:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.read.req_n = n;
+  80199f:	89 35 04 50 80 00    	mov    %esi,0x805004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8019a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019aa:	b8 03 00 00 00       	mov    $0x3,%eax
+  8019af:	e8 a3 fe ff ff       	call   801857 <fsipc>
+  8019b4:	89 c3                	mov    %eax,%ebx
+  8019b6:	85 c0                	test   %eax,%eax
+  8019b8:	78 1f                	js     8019d9 <devfile_read+0x4d>
+  assert(r <= n);
+  8019ba:	39 c6                	cmp    %eax,%esi
+  8019bc:	72 24                	jb     8019e2 <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  8019be:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8019c3:	7f 33                	jg     8019f8 <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8019c5:	83 ec 04             	sub    $0x4,%esp
+  8019c8:	50                   	push   %eax
+  8019c9:	68 00 50 80 00       	push   $0x805000
+  8019ce:	ff 75 0c             	push   0xc(%ebp)
+  8019d1:	e8 9b ef ff ff       	call   800971 <memmove>
+  return r;
+  8019d6:	83 c4 10             	add    $0x10,%esp
+}
+  8019d9:	89 d8                	mov    %ebx,%eax
+  8019db:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019de:	5b                   	pop    %ebx
+  8019df:	5e                   	pop    %esi
+  8019e0:	5d                   	pop    %ebp
+  8019e1:	c3                   	ret
+  assert(r <= n);
+  8019e2:	68 a4 2e 80 00       	push   $0x802ea4
+  8019e7:	68 ab 2e 80 00       	push   $0x802eab
+  8019ec:	6a 78                	push   $0x78
+  8019ee:	68 c0 2e 80 00       	push   $0x802ec0
+  8019f3:	e8 5f e7 ff ff       	call   800157 <_panic>
+  assert(r <= PGSIZE);
+  8019f8:	68 cb 2e 80 00       	push   $0x802ecb
+  8019fd:	68 ab 2e 80 00       	push   $0x802eab
+  801a02:	6a 79                	push   $0x79
+  801a04:	68 c0 2e 80 00       	push   $0x802ec0
+  801a09:	e8 49 e7 ff ff       	call   800157 <_panic>
+
+00801a0e <open>:
+open(const char *path, int mode) {
+  801a0e:	55                   	push   %ebp
+  801a0f:	89 e5                	mov    %esp,%ebp
+  801a11:	56                   	push   %esi
+  801a12:	53                   	push   %ebx
+  801a13:	83 ec 1c             	sub    $0x1c,%esp
+  801a16:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801a19:	56                   	push   %esi
+  801a1a:	e8 91 ed ff ff       	call   8007b0 <strlen>
+  801a1f:	83 c4 10             	add    $0x10,%esp
+  801a22:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801a27:	7f 6c                	jg     801a95 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801a29:	83 ec 0c             	sub    $0xc,%esp
+  801a2c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a2f:	50                   	push   %eax
+  801a30:	e8 ba f8 ff ff       	call   8012ef <fd_alloc>
+  801a35:	89 c3                	mov    %eax,%ebx
+  801a37:	83 c4 10             	add    $0x10,%esp
+  801a3a:	85 c0                	test   %eax,%eax
+  801a3c:	78 3c                	js     801a7a <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801a3e:	83 ec 08             	sub    $0x8,%esp
+  801a41:	56                   	push   %esi
+  801a42:	68 00 50 80 00       	push   $0x805000
+  801a47:	e8 9f ed ff ff       	call   8007eb <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801a4c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a4f:	a3 00 54 80 00       	mov    %eax,0x805400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801a54:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801a57:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a5c:	e8 f6 fd ff ff       	call   801857 <fsipc>
+  801a61:	89 c3                	mov    %eax,%ebx
+  801a63:	83 c4 10             	add    $0x10,%esp
+  801a66:	85 c0                	test   %eax,%eax
+  801a68:	78 19                	js     801a83 <open+0x75>
+  return fd2num(fd);
+  801a6a:	83 ec 0c             	sub    $0xc,%esp
+  801a6d:	ff 75 f4             	push   -0xc(%ebp)
+  801a70:	e8 53 f8 ff ff       	call   8012c8 <fd2num>
+  801a75:	89 c3                	mov    %eax,%ebx
+  801a77:	83 c4 10             	add    $0x10,%esp
+}
+  801a7a:	89 d8                	mov    %ebx,%eax
+  801a7c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a7f:	5b                   	pop    %ebx
+  801a80:	5e                   	pop    %esi
+  801a81:	5d                   	pop    %ebp
+  801a82:	c3                   	ret
+    fd_close(fd, 0);
+  801a83:	83 ec 08             	sub    $0x8,%esp
+  801a86:	6a 00                	push   $0x0
+  801a88:	ff 75 f4             	push   -0xc(%ebp)
+  801a8b:	e8 58 f9 ff ff       	call   8013e8 <fd_close>
+    return r;
+  801a90:	83 c4 10             	add    $0x10,%esp
+  801a93:	eb e5                	jmp    801a7a <open+0x6c>
+    return -E_BAD_PATH;
+  801a95:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801a9a:	eb de                	jmp    801a7a <open+0x6c>
+
+00801a9c <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  801a9c:	55                   	push   %ebp
+  801a9d:	89 e5                	mov    %esp,%ebp
+  801a9f:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801aa2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801aa7:	b8 08 00 00 00       	mov    $0x8,%eax
+  801aac:	e8 a6 fd ff ff       	call   801857 <fsipc>
+}
+  801ab1:	c9                   	leave
+  801ab2:	c3                   	ret
+
+00801ab3 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801ab3:	55                   	push   %ebp
+  801ab4:	89 e5                	mov    %esp,%ebp
+  801ab6:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801ab9:	68 d7 2e 80 00       	push   $0x802ed7
+  801abe:	ff 75 0c             	push   0xc(%ebp)
+  801ac1:	e8 25 ed ff ff       	call   8007eb <strcpy>
+	return 0;
+}
+  801ac6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801acb:	c9                   	leave
+  801acc:	c3                   	ret
+
+00801acd <devsock_close>:
+{
+  801acd:	55                   	push   %ebp
+  801ace:	89 e5                	mov    %esp,%ebp
+  801ad0:	53                   	push   %ebx
+  801ad1:	83 ec 10             	sub    $0x10,%esp
+  801ad4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801ad7:	53                   	push   %ebx
+  801ad8:	e8 8b 09 00 00       	call   802468 <pageref>
+  801add:	89 c2                	mov    %eax,%edx
+  801adf:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801ae2:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801ae7:	83 fa 01             	cmp    $0x1,%edx
+  801aea:	74 05                	je     801af1 <devsock_close+0x24>
+}
+  801aec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801aef:	c9                   	leave
+  801af0:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801af1:	83 ec 0c             	sub    $0xc,%esp
+  801af4:	ff 73 0c             	push   0xc(%ebx)
+  801af7:	e8 b7 02 00 00       	call   801db3 <nsipc_close>
+  801afc:	83 c4 10             	add    $0x10,%esp
+  801aff:	eb eb                	jmp    801aec <devsock_close+0x1f>
+
+00801b01 <devsock_write>:
+{
+  801b01:	55                   	push   %ebp
+  801b02:	89 e5                	mov    %esp,%ebp
+  801b04:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801b07:	6a 00                	push   $0x0
+  801b09:	ff 75 10             	push   0x10(%ebp)
+  801b0c:	ff 75 0c             	push   0xc(%ebp)
+  801b0f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b12:	ff 70 0c             	push   0xc(%eax)
+  801b15:	e8 79 03 00 00       	call   801e93 <nsipc_send>
+}
+  801b1a:	c9                   	leave
+  801b1b:	c3                   	ret
+
+00801b1c <devsock_read>:
+{
+  801b1c:	55                   	push   %ebp
+  801b1d:	89 e5                	mov    %esp,%ebp
+  801b1f:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801b22:	6a 00                	push   $0x0
+  801b24:	ff 75 10             	push   0x10(%ebp)
+  801b27:	ff 75 0c             	push   0xc(%ebp)
+  801b2a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b2d:	ff 70 0c             	push   0xc(%eax)
+  801b30:	e8 ef 02 00 00       	call   801e24 <nsipc_recv>
+}
+  801b35:	c9                   	leave
+  801b36:	c3                   	ret
+
+00801b37 <fd2sockid>:
+{
+  801b37:	55                   	push   %ebp
+  801b38:	89 e5                	mov    %esp,%ebp
+  801b3a:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801b3d:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801b40:	52                   	push   %edx
+  801b41:	50                   	push   %eax
+  801b42:	e8 fe f7 ff ff       	call   801345 <fd_lookup>
+  801b47:	83 c4 10             	add    $0x10,%esp
+  801b4a:	85 c0                	test   %eax,%eax
+  801b4c:	78 10                	js     801b5e <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801b4e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b51:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  801b57:	39 08                	cmp    %ecx,(%eax)
+  801b59:	75 05                	jne    801b60 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801b5b:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801b5e:	c9                   	leave
+  801b5f:	c3                   	ret
+		return -E_NOT_SUPP;
+  801b60:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b65:	eb f7                	jmp    801b5e <fd2sockid+0x27>
+
+00801b67 <alloc_sockfd>:
+{
+  801b67:	55                   	push   %ebp
+  801b68:	89 e5                	mov    %esp,%ebp
+  801b6a:	56                   	push   %esi
+  801b6b:	53                   	push   %ebx
+  801b6c:	83 ec 1c             	sub    $0x1c,%esp
+  801b6f:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801b71:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b74:	50                   	push   %eax
+  801b75:	e8 75 f7 ff ff       	call   8012ef <fd_alloc>
+  801b7a:	89 c3                	mov    %eax,%ebx
+  801b7c:	83 c4 10             	add    $0x10,%esp
+  801b7f:	85 c0                	test   %eax,%eax
+  801b81:	78 43                	js     801bc6 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801b83:	83 ec 04             	sub    $0x4,%esp
+  801b86:	68 07 04 00 00       	push   $0x407
+  801b8b:	ff 75 f4             	push   -0xc(%ebp)
+  801b8e:	6a 00                	push   $0x0
+  801b90:	e8 42 f0 ff ff       	call   800bd7 <sys_page_alloc>
+  801b95:	89 c3                	mov    %eax,%ebx
+  801b97:	83 c4 10             	add    $0x10,%esp
+  801b9a:	85 c0                	test   %eax,%eax
+  801b9c:	78 28                	js     801bc6 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801b9e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ba1:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  801ba7:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801ba9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bac:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801bb3:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801bb6:	83 ec 0c             	sub    $0xc,%esp
+  801bb9:	50                   	push   %eax
+  801bba:	e8 09 f7 ff ff       	call   8012c8 <fd2num>
+  801bbf:	89 c3                	mov    %eax,%ebx
+  801bc1:	83 c4 10             	add    $0x10,%esp
+  801bc4:	eb 0c                	jmp    801bd2 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801bc6:	83 ec 0c             	sub    $0xc,%esp
+  801bc9:	56                   	push   %esi
+  801bca:	e8 e4 01 00 00       	call   801db3 <nsipc_close>
+		return r;
+  801bcf:	83 c4 10             	add    $0x10,%esp
+}
+  801bd2:	89 d8                	mov    %ebx,%eax
+  801bd4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bd7:	5b                   	pop    %ebx
+  801bd8:	5e                   	pop    %esi
+  801bd9:	5d                   	pop    %ebp
+  801bda:	c3                   	ret
+
+00801bdb <accept>:
+{
+  801bdb:	55                   	push   %ebp
+  801bdc:	89 e5                	mov    %esp,%ebp
+  801bde:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801be1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801be4:	e8 4e ff ff ff       	call   801b37 <fd2sockid>
+  801be9:	85 c0                	test   %eax,%eax
+  801beb:	78 1b                	js     801c08 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801bed:	83 ec 04             	sub    $0x4,%esp
+  801bf0:	ff 75 10             	push   0x10(%ebp)
+  801bf3:	ff 75 0c             	push   0xc(%ebp)
+  801bf6:	50                   	push   %eax
+  801bf7:	e8 0e 01 00 00       	call   801d0a <nsipc_accept>
+  801bfc:	83 c4 10             	add    $0x10,%esp
+  801bff:	85 c0                	test   %eax,%eax
+  801c01:	78 05                	js     801c08 <accept+0x2d>
+	return alloc_sockfd(r);
+  801c03:	e8 5f ff ff ff       	call   801b67 <alloc_sockfd>
+}
+  801c08:	c9                   	leave
+  801c09:	c3                   	ret
+
+00801c0a <bind>:
+{
+  801c0a:	55                   	push   %ebp
+  801c0b:	89 e5                	mov    %esp,%ebp
+  801c0d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801c10:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c13:	e8 1f ff ff ff       	call   801b37 <fd2sockid>
+  801c18:	85 c0                	test   %eax,%eax
+  801c1a:	78 12                	js     801c2e <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801c1c:	83 ec 04             	sub    $0x4,%esp
+  801c1f:	ff 75 10             	push   0x10(%ebp)
+  801c22:	ff 75 0c             	push   0xc(%ebp)
+  801c25:	50                   	push   %eax
+  801c26:	e8 31 01 00 00       	call   801d5c <nsipc_bind>
+  801c2b:	83 c4 10             	add    $0x10,%esp
+}
+  801c2e:	c9                   	leave
+  801c2f:	c3                   	ret
+
+00801c30 <shutdown>:
+{
+  801c30:	55                   	push   %ebp
+  801c31:	89 e5                	mov    %esp,%ebp
+  801c33:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801c36:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c39:	e8 f9 fe ff ff       	call   801b37 <fd2sockid>
+  801c3e:	85 c0                	test   %eax,%eax
+  801c40:	78 0f                	js     801c51 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801c42:	83 ec 08             	sub    $0x8,%esp
+  801c45:	ff 75 0c             	push   0xc(%ebp)
+  801c48:	50                   	push   %eax
+  801c49:	e8 43 01 00 00       	call   801d91 <nsipc_shutdown>
+  801c4e:	83 c4 10             	add    $0x10,%esp
+}
+  801c51:	c9                   	leave
+  801c52:	c3                   	ret
+
+00801c53 <connect>:
+{
+  801c53:	55                   	push   %ebp
+  801c54:	89 e5                	mov    %esp,%ebp
+  801c56:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801c59:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c5c:	e8 d6 fe ff ff       	call   801b37 <fd2sockid>
+  801c61:	85 c0                	test   %eax,%eax
+  801c63:	78 12                	js     801c77 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801c65:	83 ec 04             	sub    $0x4,%esp
+  801c68:	ff 75 10             	push   0x10(%ebp)
+  801c6b:	ff 75 0c             	push   0xc(%ebp)
+  801c6e:	50                   	push   %eax
+  801c6f:	e8 59 01 00 00       	call   801dcd <nsipc_connect>
+  801c74:	83 c4 10             	add    $0x10,%esp
+}
+  801c77:	c9                   	leave
+  801c78:	c3                   	ret
+
+00801c79 <listen>:
+{
+  801c79:	55                   	push   %ebp
+  801c7a:	89 e5                	mov    %esp,%ebp
+  801c7c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801c7f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c82:	e8 b0 fe ff ff       	call   801b37 <fd2sockid>
+  801c87:	85 c0                	test   %eax,%eax
+  801c89:	78 0f                	js     801c9a <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801c8b:	83 ec 08             	sub    $0x8,%esp
+  801c8e:	ff 75 0c             	push   0xc(%ebp)
+  801c91:	50                   	push   %eax
+  801c92:	e8 6b 01 00 00       	call   801e02 <nsipc_listen>
+  801c97:	83 c4 10             	add    $0x10,%esp
+}
+  801c9a:	c9                   	leave
+  801c9b:	c3                   	ret
+
+00801c9c <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801c9c:	55                   	push   %ebp
+  801c9d:	89 e5                	mov    %esp,%ebp
+  801c9f:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801ca2:	ff 75 10             	push   0x10(%ebp)
+  801ca5:	ff 75 0c             	push   0xc(%ebp)
+  801ca8:	ff 75 08             	push   0x8(%ebp)
+  801cab:	e8 41 02 00 00       	call   801ef1 <nsipc_socket>
+  801cb0:	83 c4 10             	add    $0x10,%esp
+  801cb3:	85 c0                	test   %eax,%eax
+  801cb5:	78 05                	js     801cbc <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801cb7:	e8 ab fe ff ff       	call   801b67 <alloc_sockfd>
+}
+  801cbc:	c9                   	leave
+  801cbd:	c3                   	ret
+
+00801cbe <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801cbe:	55                   	push   %ebp
+  801cbf:	89 e5                	mov    %esp,%ebp
+  801cc1:	53                   	push   %ebx
+  801cc2:	83 ec 04             	sub    $0x4,%esp
+  801cc5:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801cc7:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801cce:	74 26                	je     801cf6 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801cd0:	6a 07                	push   $0x7
+  801cd2:	68 00 60 80 00       	push   $0x806000
+  801cd7:	53                   	push   %ebx
+  801cd8:	ff 35 04 40 80 00    	push   0x804004
+  801cde:	e8 52 f5 ff ff       	call   801235 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801ce3:	83 c4 0c             	add    $0xc,%esp
+  801ce6:	6a 00                	push   $0x0
+  801ce8:	6a 00                	push   $0x0
+  801cea:	6a 00                	push   $0x0
+  801cec:	e8 d0 f4 ff ff       	call   8011c1 <ipc_recv>
+}
+  801cf1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cf4:	c9                   	leave
+  801cf5:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801cf6:	83 ec 0c             	sub    $0xc,%esp
+  801cf9:	6a 02                	push   $0x2
+  801cfb:	e8 89 f5 ff ff       	call   801289 <ipc_find_env>
+  801d00:	a3 04 40 80 00       	mov    %eax,0x804004
+  801d05:	83 c4 10             	add    $0x10,%esp
+  801d08:	eb c6                	jmp    801cd0 <nsipc+0x12>
+
+00801d0a <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801d0a:	55                   	push   %ebp
+  801d0b:	89 e5                	mov    %esp,%ebp
+  801d0d:	56                   	push   %esi
+  801d0e:	53                   	push   %ebx
+  801d0f:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801d12:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d15:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801d1a:	8b 06                	mov    (%esi),%eax
+  801d1c:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801d21:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d26:	e8 93 ff ff ff       	call   801cbe <nsipc>
+  801d2b:	89 c3                	mov    %eax,%ebx
+  801d2d:	85 c0                	test   %eax,%eax
+  801d2f:	79 09                	jns    801d3a <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801d31:	89 d8                	mov    %ebx,%eax
+  801d33:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d36:	5b                   	pop    %ebx
+  801d37:	5e                   	pop    %esi
+  801d38:	5d                   	pop    %ebp
+  801d39:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801d3a:	83 ec 04             	sub    $0x4,%esp
+  801d3d:	ff 35 10 60 80 00    	push   0x806010
+  801d43:	68 00 60 80 00       	push   $0x806000
+  801d48:	ff 75 0c             	push   0xc(%ebp)
+  801d4b:	e8 21 ec ff ff       	call   800971 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801d50:	a1 10 60 80 00       	mov    0x806010,%eax
+  801d55:	89 06                	mov    %eax,(%esi)
+  801d57:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801d5a:	eb d5                	jmp    801d31 <nsipc_accept+0x27>
+
+00801d5c <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801d5c:	55                   	push   %ebp
+  801d5d:	89 e5                	mov    %esp,%ebp
+  801d5f:	53                   	push   %ebx
+  801d60:	83 ec 08             	sub    $0x8,%esp
+  801d63:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801d66:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d69:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801d6e:	53                   	push   %ebx
+  801d6f:	ff 75 0c             	push   0xc(%ebp)
+  801d72:	68 04 60 80 00       	push   $0x806004
+  801d77:	e8 f5 eb ff ff       	call   800971 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801d7c:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  801d82:	b8 02 00 00 00       	mov    $0x2,%eax
+  801d87:	e8 32 ff ff ff       	call   801cbe <nsipc>
+}
+  801d8c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d8f:	c9                   	leave
+  801d90:	c3                   	ret
+
+00801d91 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801d91:	55                   	push   %ebp
+  801d92:	89 e5                	mov    %esp,%ebp
+  801d94:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801d97:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d9a:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  801d9f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801da2:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  801da7:	b8 03 00 00 00       	mov    $0x3,%eax
+  801dac:	e8 0d ff ff ff       	call   801cbe <nsipc>
+}
+  801db1:	c9                   	leave
+  801db2:	c3                   	ret
+
+00801db3 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801db3:	55                   	push   %ebp
+  801db4:	89 e5                	mov    %esp,%ebp
+  801db6:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801db9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dbc:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  801dc1:	b8 04 00 00 00       	mov    $0x4,%eax
+  801dc6:	e8 f3 fe ff ff       	call   801cbe <nsipc>
+}
+  801dcb:	c9                   	leave
+  801dcc:	c3                   	ret
+
+00801dcd <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801dcd:	55                   	push   %ebp
+  801dce:	89 e5                	mov    %esp,%ebp
+  801dd0:	53                   	push   %ebx
+  801dd1:	83 ec 08             	sub    $0x8,%esp
+  801dd4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801dd7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dda:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801ddf:	53                   	push   %ebx
+  801de0:	ff 75 0c             	push   0xc(%ebp)
+  801de3:	68 04 60 80 00       	push   $0x806004
+  801de8:	e8 84 eb ff ff       	call   800971 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801ded:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  801df3:	b8 05 00 00 00       	mov    $0x5,%eax
+  801df8:	e8 c1 fe ff ff       	call   801cbe <nsipc>
+}
+  801dfd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e00:	c9                   	leave
+  801e01:	c3                   	ret
+
+00801e02 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801e02:	55                   	push   %ebp
+  801e03:	89 e5                	mov    %esp,%ebp
+  801e05:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801e08:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e0b:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  801e10:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e13:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  801e18:	b8 06 00 00 00       	mov    $0x6,%eax
+  801e1d:	e8 9c fe ff ff       	call   801cbe <nsipc>
+}
+  801e22:	c9                   	leave
+  801e23:	c3                   	ret
+
+00801e24 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801e24:	55                   	push   %ebp
+  801e25:	89 e5                	mov    %esp,%ebp
+  801e27:	56                   	push   %esi
+  801e28:	53                   	push   %ebx
+  801e29:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801e2c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e2f:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  801e34:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  801e3a:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e3d:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801e42:	b8 07 00 00 00       	mov    $0x7,%eax
+  801e47:	e8 72 fe ff ff       	call   801cbe <nsipc>
+  801e4c:	89 c3                	mov    %eax,%ebx
+  801e4e:	85 c0                	test   %eax,%eax
+  801e50:	78 22                	js     801e74 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801e52:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801e57:	39 c6                	cmp    %eax,%esi
+  801e59:	0f 4e c6             	cmovle %esi,%eax
+  801e5c:	39 c3                	cmp    %eax,%ebx
+  801e5e:	7f 1d                	jg     801e7d <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801e60:	83 ec 04             	sub    $0x4,%esp
+  801e63:	53                   	push   %ebx
+  801e64:	68 00 60 80 00       	push   $0x806000
+  801e69:	ff 75 0c             	push   0xc(%ebp)
+  801e6c:	e8 00 eb ff ff       	call   800971 <memmove>
+  801e71:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801e74:	89 d8                	mov    %ebx,%eax
+  801e76:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e79:	5b                   	pop    %ebx
+  801e7a:	5e                   	pop    %esi
+  801e7b:	5d                   	pop    %ebp
+  801e7c:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801e7d:	68 e3 2e 80 00       	push   $0x802ee3
+  801e82:	68 ab 2e 80 00       	push   $0x802eab
+  801e87:	6a 62                	push   $0x62
+  801e89:	68 f8 2e 80 00       	push   $0x802ef8
+  801e8e:	e8 c4 e2 ff ff       	call   800157 <_panic>
+
+00801e93 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801e93:	55                   	push   %ebp
+  801e94:	89 e5                	mov    %esp,%ebp
+  801e96:	53                   	push   %ebx
+  801e97:	83 ec 04             	sub    $0x4,%esp
+  801e9a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801e9d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ea0:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  801ea5:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801eab:	7f 2e                	jg     801edb <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801ead:	83 ec 04             	sub    $0x4,%esp
+  801eb0:	53                   	push   %ebx
+  801eb1:	ff 75 0c             	push   0xc(%ebp)
+  801eb4:	68 0c 60 80 00       	push   $0x80600c
+  801eb9:	e8 b3 ea ff ff       	call   800971 <memmove>
+	nsipcbuf.send.req_size = size;
+  801ebe:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  801ec4:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ec7:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  801ecc:	b8 08 00 00 00       	mov    $0x8,%eax
+  801ed1:	e8 e8 fd ff ff       	call   801cbe <nsipc>
+}
+  801ed6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ed9:	c9                   	leave
+  801eda:	c3                   	ret
+	assert(size < 1600);
+  801edb:	68 04 2f 80 00       	push   $0x802f04
+  801ee0:	68 ab 2e 80 00       	push   $0x802eab
+  801ee5:	6a 6d                	push   $0x6d
+  801ee7:	68 f8 2e 80 00       	push   $0x802ef8
+  801eec:	e8 66 e2 ff ff       	call   800157 <_panic>
+
+00801ef1 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801ef1:	55                   	push   %ebp
+  801ef2:	89 e5                	mov    %esp,%ebp
+  801ef4:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801ef7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801efa:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  801eff:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f02:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  801f07:	8b 45 10             	mov    0x10(%ebp),%eax
+  801f0a:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  801f0f:	b8 09 00 00 00       	mov    $0x9,%eax
+  801f14:	e8 a5 fd ff ff       	call   801cbe <nsipc>
+}
+  801f19:	c9                   	leave
+  801f1a:	c3                   	ret
+
+00801f1b <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801f1b:	55                   	push   %ebp
+  801f1c:	89 e5                	mov    %esp,%ebp
+  801f1e:	56                   	push   %esi
+  801f1f:	53                   	push   %ebx
+  801f20:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801f23:	83 ec 0c             	sub    $0xc,%esp
+  801f26:	ff 75 08             	push   0x8(%ebp)
+  801f29:	e8 aa f3 ff ff       	call   8012d8 <fd2data>
+  801f2e:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801f30:	83 c4 08             	add    $0x8,%esp
+  801f33:	68 10 2f 80 00       	push   $0x802f10
+  801f38:	53                   	push   %ebx
+  801f39:	e8 ad e8 ff ff       	call   8007eb <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801f3e:	8b 46 04             	mov    0x4(%esi),%eax
+  801f41:	2b 06                	sub    (%esi),%eax
+  801f43:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  801f49:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801f50:	00 00 00 
+	stat->st_dev = &devpipe;
+  801f53:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  801f5a:	30 80 00 
+	return 0;
+}
+  801f5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f62:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f65:	5b                   	pop    %ebx
+  801f66:	5e                   	pop    %esi
+  801f67:	5d                   	pop    %ebp
+  801f68:	c3                   	ret
+
+00801f69 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801f69:	55                   	push   %ebp
+  801f6a:	89 e5                	mov    %esp,%ebp
+  801f6c:	53                   	push   %ebx
+  801f6d:	83 ec 0c             	sub    $0xc,%esp
+  801f70:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801f73:	53                   	push   %ebx
+  801f74:	6a 00                	push   $0x0
+  801f76:	e8 e1 ec ff ff       	call   800c5c <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801f7b:	89 1c 24             	mov    %ebx,(%esp)
+  801f7e:	e8 55 f3 ff ff       	call   8012d8 <fd2data>
+  801f83:	83 c4 08             	add    $0x8,%esp
+  801f86:	50                   	push   %eax
+  801f87:	6a 00                	push   $0x0
+  801f89:	e8 ce ec ff ff       	call   800c5c <sys_page_unmap>
+}
+  801f8e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f91:	c9                   	leave
+  801f92:	c3                   	ret
+
+00801f93 <_pipeisclosed>:
+{
+  801f93:	55                   	push   %ebp
+  801f94:	89 e5                	mov    %esp,%ebp
+  801f96:	57                   	push   %edi
+  801f97:	56                   	push   %esi
+  801f98:	53                   	push   %ebx
+  801f99:	83 ec 1c             	sub    $0x1c,%esp
+  801f9c:	89 c7                	mov    %eax,%edi
+  801f9e:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801fa0:	a1 08 40 80 00       	mov    0x804008,%eax
+  801fa5:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801fa8:	83 ec 0c             	sub    $0xc,%esp
+  801fab:	57                   	push   %edi
+  801fac:	e8 b7 04 00 00       	call   802468 <pageref>
+  801fb1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801fb4:	89 34 24             	mov    %esi,(%esp)
+  801fb7:	e8 ac 04 00 00       	call   802468 <pageref>
+		nn = thisenv->env_runs;
+  801fbc:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801fc2:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801fc5:	83 c4 10             	add    $0x10,%esp
+  801fc8:	39 cb                	cmp    %ecx,%ebx
+  801fca:	74 1b                	je     801fe7 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801fcc:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801fcf:	75 cf                	jne    801fa0 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801fd1:	8b 42 58             	mov    0x58(%edx),%eax
+  801fd4:	6a 01                	push   $0x1
+  801fd6:	50                   	push   %eax
+  801fd7:	53                   	push   %ebx
+  801fd8:	68 17 2f 80 00       	push   $0x802f17
+  801fdd:	e8 50 e2 ff ff       	call   800232 <cprintf>
+  801fe2:	83 c4 10             	add    $0x10,%esp
+  801fe5:	eb b9                	jmp    801fa0 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801fe7:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801fea:	0f 94 c0             	sete   %al
+  801fed:	0f b6 c0             	movzbl %al,%eax
+}
+  801ff0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ff3:	5b                   	pop    %ebx
+  801ff4:	5e                   	pop    %esi
+  801ff5:	5f                   	pop    %edi
+  801ff6:	5d                   	pop    %ebp
+  801ff7:	c3                   	ret
+
+00801ff8 <devpipe_write>:
+{
+  801ff8:	55                   	push   %ebp
+  801ff9:	89 e5                	mov    %esp,%ebp
+  801ffb:	57                   	push   %edi
+  801ffc:	56                   	push   %esi
+  801ffd:	53                   	push   %ebx
+  801ffe:	83 ec 28             	sub    $0x28,%esp
+  802001:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802004:	56                   	push   %esi
+  802005:	e8 ce f2 ff ff       	call   8012d8 <fd2data>
+  80200a:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80200c:	83 c4 10             	add    $0x10,%esp
+  80200f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802014:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802017:	75 09                	jne    802022 <devpipe_write+0x2a>
+	return i;
+  802019:	89 f8                	mov    %edi,%eax
+  80201b:	eb 23                	jmp    802040 <devpipe_write+0x48>
+			sys_yield();
+  80201d:	e8 96 eb ff ff       	call   800bb8 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802022:	8b 43 04             	mov    0x4(%ebx),%eax
+  802025:	8b 0b                	mov    (%ebx),%ecx
+  802027:	8d 51 20             	lea    0x20(%ecx),%edx
+  80202a:	39 d0                	cmp    %edx,%eax
+  80202c:	72 1a                	jb     802048 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  80202e:	89 da                	mov    %ebx,%edx
+  802030:	89 f0                	mov    %esi,%eax
+  802032:	e8 5c ff ff ff       	call   801f93 <_pipeisclosed>
+  802037:	85 c0                	test   %eax,%eax
+  802039:	74 e2                	je     80201d <devpipe_write+0x25>
+				return 0;
+  80203b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802040:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802043:	5b                   	pop    %ebx
+  802044:	5e                   	pop    %esi
+  802045:	5f                   	pop    %edi
+  802046:	5d                   	pop    %ebp
+  802047:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802048:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80204b:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  80204f:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802052:	89 c2                	mov    %eax,%edx
+  802054:	c1 fa 1f             	sar    $0x1f,%edx
+  802057:	89 d1                	mov    %edx,%ecx
+  802059:	c1 e9 1b             	shr    $0x1b,%ecx
+  80205c:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80205f:	83 e2 1f             	and    $0x1f,%edx
+  802062:	29 ca                	sub    %ecx,%edx
+  802064:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802068:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  80206c:	83 c0 01             	add    $0x1,%eax
+  80206f:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802072:	83 c7 01             	add    $0x1,%edi
+  802075:	eb 9d                	jmp    802014 <devpipe_write+0x1c>
+
+00802077 <devpipe_read>:
+{
+  802077:	55                   	push   %ebp
+  802078:	89 e5                	mov    %esp,%ebp
+  80207a:	57                   	push   %edi
+  80207b:	56                   	push   %esi
+  80207c:	53                   	push   %ebx
+  80207d:	83 ec 18             	sub    $0x18,%esp
+  802080:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802083:	57                   	push   %edi
+  802084:	e8 4f f2 ff ff       	call   8012d8 <fd2data>
+  802089:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80208b:	83 c4 10             	add    $0x10,%esp
+  80208e:	be 00 00 00 00       	mov    $0x0,%esi
+  802093:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802096:	75 13                	jne    8020ab <devpipe_read+0x34>
+	return i;
+  802098:	89 f0                	mov    %esi,%eax
+  80209a:	eb 02                	jmp    80209e <devpipe_read+0x27>
+				return i;
+  80209c:	89 f0                	mov    %esi,%eax
+}
+  80209e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020a1:	5b                   	pop    %ebx
+  8020a2:	5e                   	pop    %esi
+  8020a3:	5f                   	pop    %edi
+  8020a4:	5d                   	pop    %ebp
+  8020a5:	c3                   	ret
+			sys_yield();
+  8020a6:	e8 0d eb ff ff       	call   800bb8 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  8020ab:	8b 03                	mov    (%ebx),%eax
+  8020ad:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8020b0:	75 18                	jne    8020ca <devpipe_read+0x53>
+			if (i > 0)
+  8020b2:	85 f6                	test   %esi,%esi
+  8020b4:	75 e6                	jne    80209c <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  8020b6:	89 da                	mov    %ebx,%edx
+  8020b8:	89 f8                	mov    %edi,%eax
+  8020ba:	e8 d4 fe ff ff       	call   801f93 <_pipeisclosed>
+  8020bf:	85 c0                	test   %eax,%eax
+  8020c1:	74 e3                	je     8020a6 <devpipe_read+0x2f>
+				return 0;
+  8020c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020c8:	eb d4                	jmp    80209e <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8020ca:	99                   	cltd
+  8020cb:	c1 ea 1b             	shr    $0x1b,%edx
+  8020ce:	01 d0                	add    %edx,%eax
+  8020d0:	83 e0 1f             	and    $0x1f,%eax
+  8020d3:	29 d0                	sub    %edx,%eax
+  8020d5:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8020da:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8020dd:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8020e0:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8020e3:	83 c6 01             	add    $0x1,%esi
+  8020e6:	eb ab                	jmp    802093 <devpipe_read+0x1c>
+
+008020e8 <pipe>:
+{
+  8020e8:	55                   	push   %ebp
+  8020e9:	89 e5                	mov    %esp,%ebp
+  8020eb:	56                   	push   %esi
+  8020ec:	53                   	push   %ebx
+  8020ed:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8020f0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020f3:	50                   	push   %eax
+  8020f4:	e8 f6 f1 ff ff       	call   8012ef <fd_alloc>
+  8020f9:	89 c3                	mov    %eax,%ebx
+  8020fb:	83 c4 10             	add    $0x10,%esp
+  8020fe:	85 c0                	test   %eax,%eax
+  802100:	0f 88 23 01 00 00    	js     802229 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802106:	83 ec 04             	sub    $0x4,%esp
+  802109:	68 07 04 00 00       	push   $0x407
+  80210e:	ff 75 f4             	push   -0xc(%ebp)
+  802111:	6a 00                	push   $0x0
+  802113:	e8 bf ea ff ff       	call   800bd7 <sys_page_alloc>
+  802118:	89 c3                	mov    %eax,%ebx
+  80211a:	83 c4 10             	add    $0x10,%esp
+  80211d:	85 c0                	test   %eax,%eax
+  80211f:	0f 88 04 01 00 00    	js     802229 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802125:	83 ec 0c             	sub    $0xc,%esp
+  802128:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80212b:	50                   	push   %eax
+  80212c:	e8 be f1 ff ff       	call   8012ef <fd_alloc>
+  802131:	89 c3                	mov    %eax,%ebx
+  802133:	83 c4 10             	add    $0x10,%esp
+  802136:	85 c0                	test   %eax,%eax
+  802138:	0f 88 db 00 00 00    	js     802219 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80213e:	83 ec 04             	sub    $0x4,%esp
+  802141:	68 07 04 00 00       	push   $0x407
+  802146:	ff 75 f0             	push   -0x10(%ebp)
+  802149:	6a 00                	push   $0x0
+  80214b:	e8 87 ea ff ff       	call   800bd7 <sys_page_alloc>
+  802150:	89 c3                	mov    %eax,%ebx
+  802152:	83 c4 10             	add    $0x10,%esp
+  802155:	85 c0                	test   %eax,%eax
+  802157:	0f 88 bc 00 00 00    	js     802219 <pipe+0x131>
+	va = fd2data(fd0);
+  80215d:	83 ec 0c             	sub    $0xc,%esp
+  802160:	ff 75 f4             	push   -0xc(%ebp)
+  802163:	e8 70 f1 ff ff       	call   8012d8 <fd2data>
+  802168:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80216a:	83 c4 0c             	add    $0xc,%esp
+  80216d:	68 07 04 00 00       	push   $0x407
+  802172:	50                   	push   %eax
+  802173:	6a 00                	push   $0x0
+  802175:	e8 5d ea ff ff       	call   800bd7 <sys_page_alloc>
+  80217a:	89 c3                	mov    %eax,%ebx
+  80217c:	83 c4 10             	add    $0x10,%esp
+  80217f:	85 c0                	test   %eax,%eax
+  802181:	0f 88 82 00 00 00    	js     802209 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802187:	83 ec 0c             	sub    $0xc,%esp
+  80218a:	ff 75 f0             	push   -0x10(%ebp)
+  80218d:	e8 46 f1 ff ff       	call   8012d8 <fd2data>
+  802192:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802199:	50                   	push   %eax
+  80219a:	6a 00                	push   $0x0
+  80219c:	56                   	push   %esi
+  80219d:	6a 00                	push   $0x0
+  80219f:	e8 76 ea ff ff       	call   800c1a <sys_page_map>
+  8021a4:	89 c3                	mov    %eax,%ebx
+  8021a6:	83 c4 20             	add    $0x20,%esp
+  8021a9:	85 c0                	test   %eax,%eax
+  8021ab:	78 4e                	js     8021fb <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8021ad:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  8021b2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8021b5:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8021b7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8021ba:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8021c1:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8021c4:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8021c6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8021c9:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8021d0:	83 ec 0c             	sub    $0xc,%esp
+  8021d3:	ff 75 f4             	push   -0xc(%ebp)
+  8021d6:	e8 ed f0 ff ff       	call   8012c8 <fd2num>
+  8021db:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8021de:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8021e0:	83 c4 04             	add    $0x4,%esp
+  8021e3:	ff 75 f0             	push   -0x10(%ebp)
+  8021e6:	e8 dd f0 ff ff       	call   8012c8 <fd2num>
+  8021eb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8021ee:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8021f1:	83 c4 10             	add    $0x10,%esp
+  8021f4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8021f9:	eb 2e                	jmp    802229 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8021fb:	83 ec 08             	sub    $0x8,%esp
+  8021fe:	56                   	push   %esi
+  8021ff:	6a 00                	push   $0x0
+  802201:	e8 56 ea ff ff       	call   800c5c <sys_page_unmap>
+  802206:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802209:	83 ec 08             	sub    $0x8,%esp
+  80220c:	ff 75 f0             	push   -0x10(%ebp)
+  80220f:	6a 00                	push   $0x0
+  802211:	e8 46 ea ff ff       	call   800c5c <sys_page_unmap>
+  802216:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802219:	83 ec 08             	sub    $0x8,%esp
+  80221c:	ff 75 f4             	push   -0xc(%ebp)
+  80221f:	6a 00                	push   $0x0
+  802221:	e8 36 ea ff ff       	call   800c5c <sys_page_unmap>
+  802226:	83 c4 10             	add    $0x10,%esp
+}
+  802229:	89 d8                	mov    %ebx,%eax
+  80222b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80222e:	5b                   	pop    %ebx
+  80222f:	5e                   	pop    %esi
+  802230:	5d                   	pop    %ebp
+  802231:	c3                   	ret
+
+00802232 <pipeisclosed>:
+{
+  802232:	55                   	push   %ebp
+  802233:	89 e5                	mov    %esp,%ebp
+  802235:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802238:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80223b:	50                   	push   %eax
+  80223c:	ff 75 08             	push   0x8(%ebp)
+  80223f:	e8 01 f1 ff ff       	call   801345 <fd_lookup>
+  802244:	83 c4 10             	add    $0x10,%esp
+  802247:	85 c0                	test   %eax,%eax
+  802249:	78 18                	js     802263 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80224b:	83 ec 0c             	sub    $0xc,%esp
+  80224e:	ff 75 f4             	push   -0xc(%ebp)
+  802251:	e8 82 f0 ff ff       	call   8012d8 <fd2data>
+  802256:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802258:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80225b:	e8 33 fd ff ff       	call   801f93 <_pipeisclosed>
+  802260:	83 c4 10             	add    $0x10,%esp
+}
+  802263:	c9                   	leave
+  802264:	c3                   	ret
+
+00802265 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802265:	b8 00 00 00 00       	mov    $0x0,%eax
+  80226a:	c3                   	ret
+
+0080226b <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80226b:	55                   	push   %ebp
+  80226c:	89 e5                	mov    %esp,%ebp
+  80226e:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802271:	68 2f 2f 80 00       	push   $0x802f2f
+  802276:	ff 75 0c             	push   0xc(%ebp)
+  802279:	e8 6d e5 ff ff       	call   8007eb <strcpy>
+	return 0;
+}
+  80227e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802283:	c9                   	leave
+  802284:	c3                   	ret
+
+00802285 <devcons_write>:
+{
+  802285:	55                   	push   %ebp
+  802286:	89 e5                	mov    %esp,%ebp
+  802288:	57                   	push   %edi
+  802289:	56                   	push   %esi
+  80228a:	53                   	push   %ebx
+  80228b:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802291:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802296:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80229c:	eb 2e                	jmp    8022cc <devcons_write+0x47>
+		m = n - tot;
+  80229e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8022a1:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8022a3:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8022a8:	39 c3                	cmp    %eax,%ebx
+  8022aa:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8022ad:	83 ec 04             	sub    $0x4,%esp
+  8022b0:	53                   	push   %ebx
+  8022b1:	89 f0                	mov    %esi,%eax
+  8022b3:	03 45 0c             	add    0xc(%ebp),%eax
+  8022b6:	50                   	push   %eax
+  8022b7:	57                   	push   %edi
+  8022b8:	e8 b4 e6 ff ff       	call   800971 <memmove>
+		sys_cputs(buf, m);
+  8022bd:	83 c4 08             	add    $0x8,%esp
+  8022c0:	53                   	push   %ebx
+  8022c1:	57                   	push   %edi
+  8022c2:	e8 54 e8 ff ff       	call   800b1b <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8022c7:	01 de                	add    %ebx,%esi
+  8022c9:	83 c4 10             	add    $0x10,%esp
+  8022cc:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8022cf:	72 cd                	jb     80229e <devcons_write+0x19>
+}
+  8022d1:	89 f0                	mov    %esi,%eax
+  8022d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022d6:	5b                   	pop    %ebx
+  8022d7:	5e                   	pop    %esi
+  8022d8:	5f                   	pop    %edi
+  8022d9:	5d                   	pop    %ebp
+  8022da:	c3                   	ret
+
+008022db <devcons_read>:
+{
+  8022db:	55                   	push   %ebp
+  8022dc:	89 e5                	mov    %esp,%ebp
+  8022de:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8022e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022e6:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8022ea:	75 07                	jne    8022f3 <devcons_read+0x18>
+  8022ec:	eb 1f                	jmp    80230d <devcons_read+0x32>
+		sys_yield();
+  8022ee:	e8 c5 e8 ff ff       	call   800bb8 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8022f3:	e8 41 e8 ff ff       	call   800b39 <sys_cgetc>
+  8022f8:	85 c0                	test   %eax,%eax
+  8022fa:	74 f2                	je     8022ee <devcons_read+0x13>
+	if (c < 0)
+  8022fc:	78 0f                	js     80230d <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8022fe:	83 f8 04             	cmp    $0x4,%eax
+  802301:	74 0c                	je     80230f <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802303:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802306:	88 02                	mov    %al,(%edx)
+	return 1;
+  802308:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80230d:	c9                   	leave
+  80230e:	c3                   	ret
+		return 0;
+  80230f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802314:	eb f7                	jmp    80230d <devcons_read+0x32>
+
+00802316 <cputchar>:
+{
+  802316:	55                   	push   %ebp
+  802317:	89 e5                	mov    %esp,%ebp
+  802319:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80231c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80231f:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802322:	6a 01                	push   $0x1
+  802324:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802327:	50                   	push   %eax
+  802328:	e8 ee e7 ff ff       	call   800b1b <sys_cputs>
+}
+  80232d:	83 c4 10             	add    $0x10,%esp
+  802330:	c9                   	leave
+  802331:	c3                   	ret
+
+00802332 <getchar>:
+{
+  802332:	55                   	push   %ebp
+  802333:	89 e5                	mov    %esp,%ebp
+  802335:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802338:	6a 01                	push   $0x1
+  80233a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80233d:	50                   	push   %eax
+  80233e:	6a 00                	push   $0x0
+  802340:	e8 66 f2 ff ff       	call   8015ab <read>
+	if (r < 0)
+  802345:	83 c4 10             	add    $0x10,%esp
+  802348:	85 c0                	test   %eax,%eax
+  80234a:	78 06                	js     802352 <getchar+0x20>
+	if (r < 1)
+  80234c:	74 06                	je     802354 <getchar+0x22>
+	return c;
+  80234e:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802352:	c9                   	leave
+  802353:	c3                   	ret
+		return -E_EOF;
+  802354:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802359:	eb f7                	jmp    802352 <getchar+0x20>
+
+0080235b <iscons>:
+{
+  80235b:	55                   	push   %ebp
+  80235c:	89 e5                	mov    %esp,%ebp
+  80235e:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802361:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802364:	50                   	push   %eax
+  802365:	ff 75 08             	push   0x8(%ebp)
+  802368:	e8 d8 ef ff ff       	call   801345 <fd_lookup>
+  80236d:	83 c4 10             	add    $0x10,%esp
+  802370:	85 c0                	test   %eax,%eax
+  802372:	78 11                	js     802385 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802374:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802377:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  80237d:	39 10                	cmp    %edx,(%eax)
+  80237f:	0f 94 c0             	sete   %al
+  802382:	0f b6 c0             	movzbl %al,%eax
+}
+  802385:	c9                   	leave
+  802386:	c3                   	ret
+
+00802387 <opencons>:
+{
+  802387:	55                   	push   %ebp
+  802388:	89 e5                	mov    %esp,%ebp
+  80238a:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80238d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802390:	50                   	push   %eax
+  802391:	e8 59 ef ff ff       	call   8012ef <fd_alloc>
+  802396:	83 c4 10             	add    $0x10,%esp
+  802399:	85 c0                	test   %eax,%eax
+  80239b:	78 3a                	js     8023d7 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80239d:	83 ec 04             	sub    $0x4,%esp
+  8023a0:	68 07 04 00 00       	push   $0x407
+  8023a5:	ff 75 f4             	push   -0xc(%ebp)
+  8023a8:	6a 00                	push   $0x0
+  8023aa:	e8 28 e8 ff ff       	call   800bd7 <sys_page_alloc>
+  8023af:	83 c4 10             	add    $0x10,%esp
+  8023b2:	85 c0                	test   %eax,%eax
+  8023b4:	78 21                	js     8023d7 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8023b6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023b9:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  8023bf:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8023c1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023c4:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8023cb:	83 ec 0c             	sub    $0xc,%esp
+  8023ce:	50                   	push   %eax
+  8023cf:	e8 f4 ee ff ff       	call   8012c8 <fd2num>
+  8023d4:	83 c4 10             	add    $0x10,%esp
+}
+  8023d7:	c9                   	leave
+  8023d8:	c3                   	ret
+
+008023d9 <set_pgfault_handler>:
+// allocate an exception stack (one page of memory with its top
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf)) {
+  8023d9:	55                   	push   %ebp
+  8023da:	89 e5                	mov    %esp,%ebp
+  8023dc:	83 ec 08             	sub    $0x8,%esp
+  int r;
+
+  if (_pgfault_handler == 0) {
+  8023df:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  8023e6:	74 0a                	je     8023f2 <set_pgfault_handler+0x19>
+    if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)))
+      panic(" set_pgfault_handler sys_env_set_pgfault_upcall panic: %e\n", r);
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  8023e8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023eb:	a3 00 70 80 00       	mov    %eax,0x807000
+
+
+}
+  8023f0:	c9                   	leave
+  8023f1:	c3                   	ret
+    if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)))
+  8023f2:	83 ec 04             	sub    $0x4,%esp
+  8023f5:	6a 07                	push   $0x7
+  8023f7:	68 00 f0 bf ee       	push   $0xeebff000
+  8023fc:	6a 00                	push   $0x0
+  8023fe:	e8 d4 e7 ff ff       	call   800bd7 <sys_page_alloc>
+  802403:	83 c4 10             	add    $0x10,%esp
+  802406:	85 c0                	test   %eax,%eax
+  802408:	75 28                	jne    802432 <set_pgfault_handler+0x59>
+    if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)))
+  80240a:	83 ec 08             	sub    $0x8,%esp
+  80240d:	68 44 24 80 00       	push   $0x802444
+  802412:	6a 00                	push   $0x0
+  802414:	e8 09 e9 ff ff       	call   800d22 <sys_env_set_pgfault_upcall>
+  802419:	83 c4 10             	add    $0x10,%esp
+  80241c:	85 c0                	test   %eax,%eax
+  80241e:	74 c8                	je     8023e8 <set_pgfault_handler+0xf>
+      panic(" set_pgfault_handler sys_env_set_pgfault_upcall panic: %e\n", r);
+  802420:	50                   	push   %eax
+  802421:	68 6c 2f 80 00       	push   $0x802f6c
+  802426:	6a 22                	push   $0x22
+  802428:	68 a7 2f 80 00       	push   $0x802fa7
+  80242d:	e8 25 dd ff ff       	call   800157 <_panic>
+      panic("set_pgfault_handler sys_page_alloc panic: %e\n", r);
+  802432:	50                   	push   %eax
+  802433:	68 3c 2f 80 00       	push   $0x802f3c
+  802438:	6a 20                	push   $0x20
+  80243a:	68 a7 2f 80 00       	push   $0x802fa7
+  80243f:	e8 13 dd ff ff       	call   800157 <_panic>
+
+00802444 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  802444:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  802445:	a1 00 70 80 00       	mov    0x807000,%eax
+	call *%eax
+  80244a:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80244c:	83 c4 04             	add    $0x4,%esp
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	// push the trap-time %eip onto the trap-time stack
+    subl $0x4, 0x30(%esp) # for push eip
+  80244f:	83 6c 24 30 04       	subl   $0x4,0x30(%esp)
+    movl 0x30(%esp), %ebx #regular esp
+  802454:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+    movl 0x28(%esp), %eax #eip
+  802458:	8b 44 24 28          	mov    0x28(%esp),%eax
+    movl %eax, (%ebx)
+  80245c:	89 03                	mov    %eax,(%ebx)
+
+    // Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+    addl $8, %esp
+  80245e:	83 c4 08             	add    $0x8,%esp
+    popal
+  802461:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  802462:	83 c4 04             	add    $0x4,%esp
+	popfl
+  802465:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  802466:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  802467:	c3                   	ret
+
+00802468 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802468:	55                   	push   %ebp
+  802469:	89 e5                	mov    %esp,%ebp
+  80246b:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80246e:	89 c2                	mov    %eax,%edx
+  802470:	c1 ea 16             	shr    $0x16,%edx
+  802473:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80247a:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80247f:	f6 c1 01             	test   $0x1,%cl
+  802482:	74 1c                	je     8024a0 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  802484:	c1 e8 0c             	shr    $0xc,%eax
+  802487:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80248e:	a8 01                	test   $0x1,%al
+  802490:	74 0e                	je     8024a0 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802492:	c1 e8 0c             	shr    $0xc,%eax
+  802495:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  80249c:	ef 
+  80249d:	0f b7 d2             	movzwl %dx,%edx
+}
+  8024a0:	89 d0                	mov    %edx,%eax
+  8024a2:	5d                   	pop    %ebp
+  8024a3:	c3                   	ret
+  8024a4:	66 90                	xchg   %ax,%ax
+  8024a6:	66 90                	xchg   %ax,%ax
+  8024a8:	66 90                	xchg   %ax,%ax
+  8024aa:	66 90                	xchg   %ax,%ax
+  8024ac:	66 90                	xchg   %ax,%ax
+  8024ae:	66 90                	xchg   %ax,%ax
+
+008024b0 <__udivmoddi4>:
+  8024b0:	55                   	push   %ebp
+  8024b1:	57                   	push   %edi
+  8024b2:	56                   	push   %esi
+  8024b3:	53                   	push   %ebx
+  8024b4:	83 ec 24             	sub    $0x24,%esp
+  8024b7:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8024bb:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8024bf:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  8024c3:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8024c7:	8b 54 24 44          	mov    0x44(%esp),%edx
+  8024cb:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8024cf:	8b 44 24 40          	mov    0x40(%esp),%eax
+  8024d3:	89 d3                	mov    %edx,%ebx
+  8024d5:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8024d9:	09 c3                	or     %eax,%ebx
+  8024db:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8024df:	0f 84 9c 00 00 00    	je     802581 <__udivmoddi4+0xd1>
+  8024e5:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8024ec:	00 
+  8024ed:	31 c0                	xor    %eax,%eax
+  8024ef:	31 d2                	xor    %edx,%edx
+  8024f1:	89 fb                	mov    %edi,%ebx
+  8024f3:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8024fa:	00 
+  8024fb:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802500:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802504:	01 c0                	add    %eax,%eax
+  802506:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80250d:	00 
+  80250e:	89 c6                	mov    %eax,%esi
+  802510:	89 d7                	mov    %edx,%edi
+  802512:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802516:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80251a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80251d:	d3 ea                	shr    %cl,%edx
+  80251f:	f6 c1 20             	test   $0x20,%cl
+  802522:	0f 45 c2             	cmovne %edx,%eax
+  802525:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802529:	83 e0 01             	and    $0x1,%eax
+  80252c:	09 fa                	or     %edi,%edx
+  80252e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802532:	89 04 24             	mov    %eax,(%esp)
+  802535:	8b 04 24             	mov    (%esp),%eax
+  802538:	89 d5                	mov    %edx,%ebp
+  80253a:	09 f0                	or     %esi,%eax
+  80253c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802540:	39 f0                	cmp    %esi,%eax
+  802542:	19 fd                	sbb    %edi,%ebp
+  802544:	72 1d                	jb     802563 <__udivmoddi4+0xb3>
+  802546:	29 f0                	sub    %esi,%eax
+  802548:	19 fa                	sbb    %edi,%edx
+  80254a:	89 cf                	mov    %ecx,%edi
+  80254c:	c1 ef 05             	shr    $0x5,%edi
+  80254f:	83 e7 01             	and    $0x1,%edi
+  802552:	89 fe                	mov    %edi,%esi
+  802554:	d3 e7                	shl    %cl,%edi
+  802556:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80255a:	83 f6 01             	xor    $0x1,%esi
+  80255d:	d3 e6                	shl    %cl,%esi
+  80255f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802563:	83 e9 01             	sub    $0x1,%ecx
+  802566:	73 98                	jae    802500 <__udivmoddi4+0x50>
+  802568:	85 db                	test   %ebx,%ebx
+  80256a:	74 05                	je     802571 <__udivmoddi4+0xc1>
+  80256c:	89 03                	mov    %eax,(%ebx)
+  80256e:	89 53 04             	mov    %edx,0x4(%ebx)
+  802571:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802575:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802579:	83 c4 24             	add    $0x24,%esp
+  80257c:	5b                   	pop    %ebx
+  80257d:	5e                   	pop    %esi
+  80257e:	5f                   	pop    %edi
+  80257f:	5d                   	pop    %ebp
+  802580:	c3                   	ret
+  802581:	85 ff                	test   %edi,%edi
+  802583:	74 0d                	je     802592 <__udivmoddi4+0xe2>
+  802585:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  80258b:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  802592:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802596:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80259a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80259e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8025a2:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  8025a6:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8025aa:	83 c4 24             	add    $0x24,%esp
+  8025ad:	5b                   	pop    %ebx
+  8025ae:	5e                   	pop    %esi
+  8025af:	5f                   	pop    %edi
+  8025b0:	5d                   	pop    %ebp
+  8025b1:	c3                   	ret
+  8025b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8025b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+008025c0 <__udivdi3>:
+  8025c0:	57                   	push   %edi
+  8025c1:	56                   	push   %esi
+  8025c2:	53                   	push   %ebx
+  8025c3:	83 ec 20             	sub    $0x20,%esp
+  8025c6:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8025ca:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8025ce:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8025d2:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8025d6:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8025da:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8025de:	89 d1                	mov    %edx,%ecx
+  8025e0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8025e4:	09 c1                	or     %eax,%ecx
+  8025e6:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8025ea:	89 44 24 18          	mov    %eax,0x18(%esp)
+  8025ee:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  8025f2:	0f 84 88 00 00 00    	je     802680 <__udivdi3+0xc0>
+  8025f8:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8025ff:	00 
+  802600:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802605:	31 c0                	xor    %eax,%eax
+  802607:	31 d2                	xor    %edx,%edx
+  802609:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802610:	00 
+  802611:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802618:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80261c:	01 c0                	add    %eax,%eax
+  80261e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802625:	00 
+  802626:	89 c6                	mov    %eax,%esi
+  802628:	89 d7                	mov    %edx,%edi
+  80262a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80262e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802632:	0f ad d0             	shrd   %cl,%edx,%eax
+  802635:	d3 ea                	shr    %cl,%edx
+  802637:	f6 c1 20             	test   $0x20,%cl
+  80263a:	0f 45 c2             	cmovne %edx,%eax
+  80263d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802641:	83 e0 01             	and    $0x1,%eax
+  802644:	09 fa                	or     %edi,%edx
+  802646:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80264a:	89 04 24             	mov    %eax,(%esp)
+  80264d:	8b 04 24             	mov    (%esp),%eax
+  802650:	89 d3                	mov    %edx,%ebx
+  802652:	09 f0                	or     %esi,%eax
+  802654:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802658:	39 f0                	cmp    %esi,%eax
+  80265a:	19 fb                	sbb    %edi,%ebx
+  80265c:	72 1d                	jb     80267b <__udivdi3+0xbb>
+  80265e:	29 f0                	sub    %esi,%eax
+  802660:	19 fa                	sbb    %edi,%edx
+  802662:	89 cf                	mov    %ecx,%edi
+  802664:	c1 ef 05             	shr    $0x5,%edi
+  802667:	83 e7 01             	and    $0x1,%edi
+  80266a:	89 fe                	mov    %edi,%esi
+  80266c:	d3 e7                	shl    %cl,%edi
+  80266e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802672:	83 f6 01             	xor    $0x1,%esi
+  802675:	d3 e6                	shl    %cl,%esi
+  802677:	09 74 24 18          	or     %esi,0x18(%esp)
+  80267b:	83 e9 01             	sub    $0x1,%ecx
+  80267e:	73 98                	jae    802618 <__udivdi3+0x58>
+  802680:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802684:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802688:	83 c4 20             	add    $0x20,%esp
+  80268b:	5b                   	pop    %ebx
+  80268c:	5e                   	pop    %esi
+  80268d:	5f                   	pop    %edi
+  80268e:	c3                   	ret
+  80268f:	90                   	nop
+
+00802690 <__umoddi3>:
+  802690:	57                   	push   %edi
+  802691:	56                   	push   %esi
+  802692:	53                   	push   %ebx
+  802693:	83 ec 18             	sub    $0x18,%esp
+  802696:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80269a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80269e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8026a2:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8026a6:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8026aa:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8026ae:	89 d1                	mov    %edx,%ecx
+  8026b0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8026b4:	09 c1                	or     %eax,%ecx
+  8026b6:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8026ba:	74 5b                	je     802717 <__umoddi3+0x87>
+  8026bc:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8026c1:	31 c0                	xor    %eax,%eax
+  8026c3:	31 d2                	xor    %edx,%edx
+  8026c5:	8d 76 00             	lea    0x0(%esi),%esi
+  8026c8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8026cc:	01 c0                	add    %eax,%eax
+  8026ce:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8026d5:	00 
+  8026d6:	89 c6                	mov    %eax,%esi
+  8026d8:	89 d7                	mov    %edx,%edi
+  8026da:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8026de:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8026e2:	0f ad d0             	shrd   %cl,%edx,%eax
+  8026e5:	d3 ea                	shr    %cl,%edx
+  8026e7:	f6 c1 20             	test   $0x20,%cl
+  8026ea:	0f 45 c2             	cmovne %edx,%eax
+  8026ed:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8026f1:	83 e0 01             	and    $0x1,%eax
+  8026f4:	09 fa                	or     %edi,%edx
+  8026f6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8026fa:	89 04 24             	mov    %eax,(%esp)
+  8026fd:	8b 04 24             	mov    (%esp),%eax
+  802700:	89 d3                	mov    %edx,%ebx
+  802702:	09 f0                	or     %esi,%eax
+  802704:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802708:	39 f0                	cmp    %esi,%eax
+  80270a:	19 fb                	sbb    %edi,%ebx
+  80270c:	72 04                	jb     802712 <__umoddi3+0x82>
+  80270e:	29 f0                	sub    %esi,%eax
+  802710:	19 fa                	sbb    %edi,%edx
+  802712:	83 e9 01             	sub    $0x1,%ecx
+  802715:	73 b1                	jae    8026c8 <__umoddi3+0x38>
+  802717:	83 c4 18             	add    $0x18,%esp
+  80271a:	5b                   	pop    %ebx
+  80271b:	5e                   	pop    %esi
+  80271c:	5f                   	pop    %edi
+  80271d:	c3                   	ret
+  80271e:	66 90                	xchg   %ax,%ax
+
+00802720 <__divdi3>:
+  802720:	55                   	push   %ebp
+  802721:	57                   	push   %edi
+  802722:	56                   	push   %esi
+  802723:	53                   	push   %ebx
+  802724:	83 ec 24             	sub    $0x24,%esp
+  802727:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  80272b:	8b 74 24 44          	mov    0x44(%esp),%esi
+  80272f:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802733:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802737:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  80273b:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  80273f:	85 d2                	test   %edx,%edx
+  802741:	0f 88 e0 00 00 00    	js     802827 <__divdi3+0x107>
+  802747:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  80274b:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  80274f:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802753:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802757:	85 f6                	test   %esi,%esi
+  802759:	78 16                	js     802771 <__divdi3+0x51>
+  80275b:	89 f1                	mov    %esi,%ecx
+  80275d:	31 c0                	xor    %eax,%eax
+  80275f:	31 d2                	xor    %edx,%edx
+  802761:	09 d9                	or     %ebx,%ecx
+  802763:	0f 85 f3 00 00 00    	jne    80285c <__divdi3+0x13c>
+  802769:	83 c4 24             	add    $0x24,%esp
+  80276c:	5b                   	pop    %ebx
+  80276d:	5e                   	pop    %esi
+  80276e:	5f                   	pop    %edi
+  80276f:	5d                   	pop    %ebp
+  802770:	c3                   	ret
+  802771:	bf 01 00 00 00       	mov    $0x1,%edi
+  802776:	f7 5c 24 08          	negl   0x8(%esp)
+  80277a:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  80277f:	f7 5c 24 0c          	negl   0xc(%esp)
+  802783:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80278a:	00 
+  80278b:	31 c0                	xor    %eax,%eax
+  80278d:	31 d2                	xor    %edx,%edx
+  80278f:	89 fb                	mov    %edi,%ebx
+  802791:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802798:	00 
+  802799:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80279e:	66 90                	xchg   %ax,%ax
+  8027a0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8027a4:	01 c0                	add    %eax,%eax
+  8027a6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8027ad:	00 
+  8027ae:	89 c6                	mov    %eax,%esi
+  8027b0:	89 d7                	mov    %edx,%edi
+  8027b2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8027b6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8027ba:	0f ad d0             	shrd   %cl,%edx,%eax
+  8027bd:	d3 ea                	shr    %cl,%edx
+  8027bf:	f6 c1 20             	test   $0x20,%cl
+  8027c2:	0f 45 c2             	cmovne %edx,%eax
+  8027c5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8027c9:	83 e0 01             	and    $0x1,%eax
+  8027cc:	09 fa                	or     %edi,%edx
+  8027ce:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8027d2:	89 04 24             	mov    %eax,(%esp)
+  8027d5:	8b 04 24             	mov    (%esp),%eax
+  8027d8:	89 d5                	mov    %edx,%ebp
+  8027da:	09 f0                	or     %esi,%eax
+  8027dc:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8027e0:	39 f0                	cmp    %esi,%eax
+  8027e2:	19 fd                	sbb    %edi,%ebp
+  8027e4:	72 1d                	jb     802803 <__divdi3+0xe3>
+  8027e6:	29 f0                	sub    %esi,%eax
+  8027e8:	19 fa                	sbb    %edi,%edx
+  8027ea:	89 cf                	mov    %ecx,%edi
+  8027ec:	c1 ef 05             	shr    $0x5,%edi
+  8027ef:	83 e7 01             	and    $0x1,%edi
+  8027f2:	89 fe                	mov    %edi,%esi
+  8027f4:	d3 e7                	shl    %cl,%edi
+  8027f6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8027fa:	83 f6 01             	xor    $0x1,%esi
+  8027fd:	d3 e6                	shl    %cl,%esi
+  8027ff:	09 74 24 18          	or     %esi,0x18(%esp)
+  802803:	83 e9 01             	sub    $0x1,%ecx
+  802806:	73 98                	jae    8027a0 <__divdi3+0x80>
+  802808:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80280c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802810:	85 db                	test   %ebx,%ebx
+  802812:	0f 84 51 ff ff ff    	je     802769 <__divdi3+0x49>
+  802818:	f7 d8                	neg    %eax
+  80281a:	83 d2 00             	adc    $0x0,%edx
+  80281d:	83 c4 24             	add    $0x24,%esp
+  802820:	5b                   	pop    %ebx
+  802821:	f7 da                	neg    %edx
+  802823:	5e                   	pop    %esi
+  802824:	5f                   	pop    %edi
+  802825:	5d                   	pop    %ebp
+  802826:	c3                   	ret
+  802827:	f7 d8                	neg    %eax
+  802829:	83 d2 00             	adc    $0x0,%edx
+  80282c:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802830:	f7 da                	neg    %edx
+  802832:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802836:	85 f6                	test   %esi,%esi
+  802838:	78 1b                	js     802855 <__divdi3+0x135>
+  80283a:	89 f1                	mov    %esi,%ecx
+  80283c:	31 c0                	xor    %eax,%eax
+  80283e:	31 d2                	xor    %edx,%edx
+  802840:	bf 01 00 00 00       	mov    $0x1,%edi
+  802845:	09 d9                	or     %ebx,%ecx
+  802847:	0f 85 36 ff ff ff    	jne    802783 <__divdi3+0x63>
+  80284d:	83 c4 24             	add    $0x24,%esp
+  802850:	5b                   	pop    %ebx
+  802851:	5e                   	pop    %esi
+  802852:	5f                   	pop    %edi
+  802853:	5d                   	pop    %ebp
+  802854:	c3                   	ret
+  802855:	31 ff                	xor    %edi,%edi
+  802857:	e9 1a ff ff ff       	jmp    802776 <__divdi3+0x56>
+  80285c:	31 ff                	xor    %edi,%edi
+  80285e:	e9 20 ff ff ff       	jmp    802783 <__divdi3+0x63>
+  802863:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80286a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00802870 <__moddi3>:
+  802870:	55                   	push   %ebp
+  802871:	57                   	push   %edi
+  802872:	56                   	push   %esi
+  802873:	53                   	push   %ebx
+  802874:	83 ec 1c             	sub    $0x1c,%esp
+  802877:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  80287b:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  80287f:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  802883:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  802887:	89 c8                	mov    %ecx,%eax
+  802889:	89 f2                	mov    %esi,%edx
+  80288b:	89 f3                	mov    %esi,%ebx
+  80288d:	85 ed                	test   %ebp,%ebp
+  80288f:	0f 88 9d 00 00 00    	js     802932 <__moddi3+0xc2>
+  802895:	09 cb                	or     %ecx,%ebx
+  802897:	0f 84 8d 00 00 00    	je     80292a <__moddi3+0xba>
+  80289d:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  8028a1:	31 db                	xor    %ebx,%ebx
+  8028a3:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  8028a7:	89 ca                	mov    %ecx,%edx
+  8028a9:	89 f0                	mov    %esi,%eax
+  8028ab:	89 dd                	mov    %ebx,%ebp
+  8028ad:	f7 da                	neg    %edx
+  8028af:	83 d0 00             	adc    $0x0,%eax
+  8028b2:	f7 d8                	neg    %eax
+  8028b4:	0f 49 f0             	cmovns %eax,%esi
+  8028b7:	0f 49 ca             	cmovns %edx,%ecx
+  8028ba:	31 c0                	xor    %eax,%eax
+  8028bc:	31 d2                	xor    %edx,%edx
+  8028be:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8028c2:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  8028c6:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8028cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  8028cf:	90                   	nop
+  8028d0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8028d4:	01 c0                	add    %eax,%eax
+  8028d6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8028dd:	00 
+  8028de:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  8028e2:	89 c6                	mov    %eax,%esi
+  8028e4:	89 d7                	mov    %edx,%edi
+  8028e6:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8028ea:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8028ee:	0f ad d0             	shrd   %cl,%edx,%eax
+  8028f1:	d3 ea                	shr    %cl,%edx
+  8028f3:	f6 c1 20             	test   $0x20,%cl
+  8028f6:	0f 45 c2             	cmovne %edx,%eax
+  8028f9:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8028fd:	83 e0 01             	and    $0x1,%eax
+  802900:	09 fa                	or     %edi,%edx
+  802902:	89 04 24             	mov    %eax,(%esp)
+  802905:	8b 04 24             	mov    (%esp),%eax
+  802908:	89 d7                	mov    %edx,%edi
+  80290a:	09 f0                	or     %esi,%eax
+  80290c:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  802910:	39 d8                	cmp    %ebx,%eax
+  802912:	19 f7                	sbb    %esi,%edi
+  802914:	72 04                	jb     80291a <__moddi3+0xaa>
+  802916:	29 d8                	sub    %ebx,%eax
+  802918:	19 f2                	sbb    %esi,%edx
+  80291a:	83 e9 01             	sub    $0x1,%ecx
+  80291d:	73 b1                	jae    8028d0 <__moddi3+0x60>
+  80291f:	85 ed                	test   %ebp,%ebp
+  802921:	74 07                	je     80292a <__moddi3+0xba>
+  802923:	f7 d8                	neg    %eax
+  802925:	83 d2 00             	adc    $0x0,%edx
+  802928:	f7 da                	neg    %edx
+  80292a:	83 c4 1c             	add    $0x1c,%esp
+  80292d:	5b                   	pop    %ebx
+  80292e:	5e                   	pop    %esi
+  80292f:	5f                   	pop    %edi
+  802930:	5d                   	pop    %ebp
+  802931:	c3                   	ret
+  802932:	09 cb                	or     %ecx,%ebx
+  802934:	74 f4                	je     80292a <__moddi3+0xba>
+  802936:	f7 df                	neg    %edi
+  802938:	bb 01 00 00 00       	mov    $0x1,%ebx
+  80293d:	83 d5 00             	adc    $0x0,%ebp
+  802940:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802944:	f7 dd                	neg    %ebp
+  802946:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  80294a:	e9 58 ff ff ff       	jmp    8028a7 <__moddi3+0x37>
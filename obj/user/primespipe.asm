@@ -0,0 +1,5944 @@
+
+obj/user/primespipe.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 06 02 00 00       	call   800237 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <primeproc>:
+
+#include <inc/lib.h>
+
+unsigned
+primeproc(int fd)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 1c             	sub    $0x1c,%esp
+  80003c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int i, id, p, pfd[2], wfd, r;
+
+	// fetch a prime from our left neighbor
+top:
+	if ((r = readn(fd, &p, 4)) != 4)
+  80003f:	8d 75 e0             	lea    -0x20(%ebp),%esi
+		panic("primeproc could not read initial prime: %d, %e", r, r >= 0 ? 0 : r);
+
+	cprintf("%d\n", p);
+
+	// fork a right neighbor to continue the chain
+	if ((i=pipe(pfd)) < 0)
+  800042:	8d 7d d8             	lea    -0x28(%ebp),%edi
+	if ((r = readn(fd, &p, 4)) != 4)
+  800045:	83 ec 04             	sub    $0x4,%esp
+  800048:	6a 04                	push   $0x4
+  80004a:	56                   	push   %esi
+  80004b:	53                   	push   %ebx
+  80004c:	e8 1d 16 00 00       	call   80166e <readn>
+  800051:	83 c4 10             	add    $0x10,%esp
+  800054:	83 f8 04             	cmp    $0x4,%eax
+  800057:	75 49                	jne    8000a2 <primeproc+0x6f>
+	cprintf("%d\n", p);
+  800059:	83 ec 08             	sub    $0x8,%esp
+  80005c:	ff 75 e0             	push   -0x20(%ebp)
+  80005f:	68 e1 2a 80 00       	push   $0x802ae1
+  800064:	e8 0c 03 00 00       	call   800375 <cprintf>
+	if ((i=pipe(pfd)) < 0)
+  800069:	89 3c 24             	mov    %edi,(%esp)
+  80006c:	e8 b3 20 00 00       	call   802124 <pipe>
+  800071:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800074:	83 c4 10             	add    $0x10,%esp
+  800077:	85 c0                	test   %eax,%eax
+  800079:	78 47                	js     8000c2 <primeproc+0x8f>
+		panic("pipe: %e", i);
+	if ((id = fork()) < 0)
+  80007b:	e8 68 10 00 00       	call   8010e8 <fork>
+  800080:	85 c0                	test   %eax,%eax
+  800082:	78 50                	js     8000d4 <primeproc+0xa1>
+		panic("fork: %e", id);
+	if (id == 0) {
+  800084:	75 60                	jne    8000e6 <primeproc+0xb3>
+		close(fd);
+  800086:	83 ec 0c             	sub    $0xc,%esp
+  800089:	53                   	push   %ebx
+  80008a:	e8 1c 14 00 00       	call   8014ab <close>
+		close(pfd[1]);
+  80008f:	83 c4 04             	add    $0x4,%esp
+  800092:	ff 75 dc             	push   -0x24(%ebp)
+  800095:	e8 11 14 00 00       	call   8014ab <close>
+		fd = pfd[0];
+  80009a:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+		goto top;
+  80009d:	83 c4 10             	add    $0x10,%esp
+  8000a0:	eb a3                	jmp    800045 <primeproc+0x12>
+		panic("primeproc could not read initial prime: %d, %e", r, r >= 0 ? 0 : r);
+  8000a2:	83 ec 0c             	sub    $0xc,%esp
+  8000a5:	85 c0                	test   %eax,%eax
+  8000a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000ac:	0f 4e d0             	cmovle %eax,%edx
+  8000af:	52                   	push   %edx
+  8000b0:	50                   	push   %eax
+  8000b1:	68 a0 2a 80 00       	push   $0x802aa0
+  8000b6:	6a 15                	push   $0x15
+  8000b8:	68 cf 2a 80 00       	push   $0x802acf
+  8000bd:	e8 d8 01 00 00       	call   80029a <_panic>
+		panic("pipe: %e", i);
+  8000c2:	50                   	push   %eax
+  8000c3:	68 e5 2a 80 00       	push   $0x802ae5
+  8000c8:	6a 1b                	push   $0x1b
+  8000ca:	68 cf 2a 80 00       	push   $0x802acf
+  8000cf:	e8 c6 01 00 00       	call   80029a <_panic>
+		panic("fork: %e", id);
+  8000d4:	50                   	push   %eax
+  8000d5:	68 ee 2a 80 00       	push   $0x802aee
+  8000da:	6a 1d                	push   $0x1d
+  8000dc:	68 cf 2a 80 00       	push   $0x802acf
+  8000e1:	e8 b4 01 00 00       	call   80029a <_panic>
+	}
+
+	close(pfd[0]);
+  8000e6:	83 ec 0c             	sub    $0xc,%esp
+  8000e9:	ff 75 d8             	push   -0x28(%ebp)
+  8000ec:	e8 ba 13 00 00       	call   8014ab <close>
+	wfd = pfd[1];
+  8000f1:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8000f4:	83 c4 10             	add    $0x10,%esp
+
+	// filter out multiples of our prime
+	for (;;) {
+		if ((r=readn(fd, &i, 4)) != 4)
+  8000f7:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  8000fa:	83 ec 04             	sub    $0x4,%esp
+  8000fd:	6a 04                	push   $0x4
+  8000ff:	56                   	push   %esi
+  800100:	53                   	push   %ebx
+  800101:	e8 68 15 00 00       	call   80166e <readn>
+  800106:	83 c4 10             	add    $0x10,%esp
+  800109:	83 f8 04             	cmp    $0x4,%eax
+  80010c:	75 45                	jne    800153 <primeproc+0x120>
+			panic("primeproc %d readn %d %d %e", p, fd, r, r >= 0 ? 0 : r);
+		if (i%p)
+  80010e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800111:	99                   	cltd
+  800112:	f7 7d e0             	idivl  -0x20(%ebp)
+  800115:	85 d2                	test   %edx,%edx
+  800117:	74 e1                	je     8000fa <primeproc+0xc7>
+			if ((r=write(wfd, &i, 4)) != 4)
+  800119:	83 ec 04             	sub    $0x4,%esp
+  80011c:	6a 04                	push   $0x4
+  80011e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800121:	50                   	push   %eax
+  800122:	57                   	push   %edi
+  800123:	e8 8d 15 00 00       	call   8016b5 <write>
+  800128:	83 c4 10             	add    $0x10,%esp
+  80012b:	83 f8 04             	cmp    $0x4,%eax
+  80012e:	74 ca                	je     8000fa <primeproc+0xc7>
+				panic("primeproc %d write: %d %e", p, r, r >= 0 ? 0 : r);
+  800130:	83 ec 08             	sub    $0x8,%esp
+  800133:	85 c0                	test   %eax,%eax
+  800135:	ba 00 00 00 00       	mov    $0x0,%edx
+  80013a:	0f 4e d0             	cmovle %eax,%edx
+  80013d:	52                   	push   %edx
+  80013e:	50                   	push   %eax
+  80013f:	ff 75 e0             	push   -0x20(%ebp)
+  800142:	68 13 2b 80 00       	push   $0x802b13
+  800147:	6a 2e                	push   $0x2e
+  800149:	68 cf 2a 80 00       	push   $0x802acf
+  80014e:	e8 47 01 00 00       	call   80029a <_panic>
+			panic("primeproc %d readn %d %d %e", p, fd, r, r >= 0 ? 0 : r);
+  800153:	83 ec 04             	sub    $0x4,%esp
+  800156:	85 c0                	test   %eax,%eax
+  800158:	ba 00 00 00 00       	mov    $0x0,%edx
+  80015d:	0f 4e d0             	cmovle %eax,%edx
+  800160:	52                   	push   %edx
+  800161:	50                   	push   %eax
+  800162:	53                   	push   %ebx
+  800163:	ff 75 e0             	push   -0x20(%ebp)
+  800166:	68 f7 2a 80 00       	push   $0x802af7
+  80016b:	6a 2b                	push   $0x2b
+  80016d:	68 cf 2a 80 00       	push   $0x802acf
+  800172:	e8 23 01 00 00       	call   80029a <_panic>
+
+00800177 <umain>:
+	}
+}
+
+void
+umain(int argc, char **argv)
+{
+  800177:	55                   	push   %ebp
+  800178:	89 e5                	mov    %esp,%ebp
+  80017a:	53                   	push   %ebx
+  80017b:	83 ec 20             	sub    $0x20,%esp
+	int i, id, p[2], r;
+
+	binaryname = "primespipe";
+  80017e:	c7 05 00 40 80 00 2d 	movl   $0x802b2d,0x804000
+  800185:	2b 80 00 
+
+	if ((i=pipe(p)) < 0)
+  800188:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80018b:	50                   	push   %eax
+  80018c:	e8 93 1f 00 00       	call   802124 <pipe>
+  800191:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  800194:	83 c4 10             	add    $0x10,%esp
+  800197:	85 c0                	test   %eax,%eax
+  800199:	78 21                	js     8001bc <umain+0x45>
+		panic("pipe: %e", i);
+
+	// fork the first prime process in the chain
+	if ((id=fork()) < 0)
+  80019b:	e8 48 0f 00 00       	call   8010e8 <fork>
+  8001a0:	85 c0                	test   %eax,%eax
+  8001a2:	78 2a                	js     8001ce <umain+0x57>
+		panic("fork: %e", id);
+
+	if (id == 0) {
+  8001a4:	75 3a                	jne    8001e0 <umain+0x69>
+		close(p[1]);
+  8001a6:	83 ec 0c             	sub    $0xc,%esp
+  8001a9:	ff 75 f0             	push   -0x10(%ebp)
+  8001ac:	e8 fa 12 00 00       	call   8014ab <close>
+		primeproc(p[0]);
+  8001b1:	83 c4 04             	add    $0x4,%esp
+  8001b4:	ff 75 ec             	push   -0x14(%ebp)
+  8001b7:	e8 77 fe ff ff       	call   800033 <primeproc>
+		panic("pipe: %e", i);
+  8001bc:	50                   	push   %eax
+  8001bd:	68 e5 2a 80 00       	push   $0x802ae5
+  8001c2:	6a 3a                	push   $0x3a
+  8001c4:	68 cf 2a 80 00       	push   $0x802acf
+  8001c9:	e8 cc 00 00 00       	call   80029a <_panic>
+		panic("fork: %e", id);
+  8001ce:	50                   	push   %eax
+  8001cf:	68 ee 2a 80 00       	push   $0x802aee
+  8001d4:	6a 3e                	push   $0x3e
+  8001d6:	68 cf 2a 80 00       	push   $0x802acf
+  8001db:	e8 ba 00 00 00       	call   80029a <_panic>
+	}
+
+	close(p[0]);
+  8001e0:	83 ec 0c             	sub    $0xc,%esp
+  8001e3:	ff 75 ec             	push   -0x14(%ebp)
+  8001e6:	e8 c0 12 00 00       	call   8014ab <close>
+  8001eb:	83 c4 10             	add    $0x10,%esp
+  8001ee:	b8 02 00 00 00       	mov    $0x2,%eax
+
+	// feed all the integers through
+	for (i=2;; i++)
+		if ((r=write(p[1], &i, 4)) != 4)
+  8001f3:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+  8001f6:	eb 06                	jmp    8001fe <umain+0x87>
+	for (i=2;; i++)
+  8001f8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8001fb:	83 c0 01             	add    $0x1,%eax
+  8001fe:	89 45 f4             	mov    %eax,-0xc(%ebp)
+		if ((r=write(p[1], &i, 4)) != 4)
+  800201:	83 ec 04             	sub    $0x4,%esp
+  800204:	6a 04                	push   $0x4
+  800206:	53                   	push   %ebx
+  800207:	ff 75 f0             	push   -0x10(%ebp)
+  80020a:	e8 a6 14 00 00       	call   8016b5 <write>
+  80020f:	83 c4 10             	add    $0x10,%esp
+  800212:	83 f8 04             	cmp    $0x4,%eax
+  800215:	74 e1                	je     8001f8 <umain+0x81>
+			panic("generator write: %d, %e", r, r >= 0 ? 0 : r);
+  800217:	83 ec 0c             	sub    $0xc,%esp
+  80021a:	85 c0                	test   %eax,%eax
+  80021c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800221:	0f 4e d0             	cmovle %eax,%edx
+  800224:	52                   	push   %edx
+  800225:	50                   	push   %eax
+  800226:	68 38 2b 80 00       	push   $0x802b38
+  80022b:	6a 4a                	push   $0x4a
+  80022d:	68 cf 2a 80 00       	push   $0x802acf
+  800232:	e8 63 00 00 00       	call   80029a <_panic>
+
+00800237 <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  800237:	55                   	push   %ebp
+  800238:	89 e5                	mov    %esp,%ebp
+  80023a:	56                   	push   %esi
+  80023b:	53                   	push   %ebx
+  80023c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80023f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  800242:	e8 95 0a 00 00       	call   800cdc <sys_getenvid>
+  800247:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80024c:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80024f:	c1 e0 04             	shl    $0x4,%eax
+  800252:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800257:	a3 08 50 80 00       	mov    %eax,0x805008
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  80025c:	85 db                	test   %ebx,%ebx
+  80025e:	7e 07                	jle    800267 <libmain+0x30>
+    binaryname = argv[0];
+  800260:	8b 06                	mov    (%esi),%eax
+  800262:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  800267:	83 ec 08             	sub    $0x8,%esp
+  80026a:	56                   	push   %esi
+  80026b:	53                   	push   %ebx
+  80026c:	e8 06 ff ff ff       	call   800177 <umain>
+
+  // exit gracefully
+  exit();
+  800271:	e8 0a 00 00 00       	call   800280 <exit>
+}
+  800276:	83 c4 10             	add    $0x10,%esp
+  800279:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80027c:	5b                   	pop    %ebx
+  80027d:	5e                   	pop    %esi
+  80027e:	5d                   	pop    %ebp
+  80027f:	c3                   	ret
+
+00800280 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800280:	55                   	push   %ebp
+  800281:	89 e5                	mov    %esp,%ebp
+  800283:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800286:	e8 4d 12 00 00       	call   8014d8 <close_all>
+	sys_env_destroy(0);
+  80028b:	83 ec 0c             	sub    $0xc,%esp
+  80028e:	6a 00                	push   $0x0
+  800290:	e8 06 0a 00 00       	call   800c9b <sys_env_destroy>
+}
+  800295:	83 c4 10             	add    $0x10,%esp
+  800298:	c9                   	leave
+  800299:	c3                   	ret
+
+0080029a <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80029a:	55                   	push   %ebp
+  80029b:	89 e5                	mov    %esp,%ebp
+  80029d:	56                   	push   %esi
+  80029e:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80029f:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8002a2:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  8002a8:	e8 2f 0a 00 00       	call   800cdc <sys_getenvid>
+  8002ad:	83 ec 0c             	sub    $0xc,%esp
+  8002b0:	ff 75 0c             	push   0xc(%ebp)
+  8002b3:	ff 75 08             	push   0x8(%ebp)
+  8002b6:	56                   	push   %esi
+  8002b7:	50                   	push   %eax
+  8002b8:	68 5c 2b 80 00       	push   $0x802b5c
+  8002bd:	e8 b3 00 00 00       	call   800375 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8002c2:	83 c4 18             	add    $0x18,%esp
+  8002c5:	53                   	push   %ebx
+  8002c6:	ff 75 10             	push   0x10(%ebp)
+  8002c9:	e8 56 00 00 00       	call   800324 <vcprintf>
+	cprintf("\n");
+  8002ce:	c7 04 24 e3 2a 80 00 	movl   $0x802ae3,(%esp)
+  8002d5:	e8 9b 00 00 00       	call   800375 <cprintf>
+  8002da:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8002dd:	cc                   	int3
+	while (1)
+  8002de:	eb fd                	jmp    8002dd <_panic+0x43>
+
+008002e0 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8002e0:	55                   	push   %ebp
+  8002e1:	89 e5                	mov    %esp,%ebp
+  8002e3:	53                   	push   %ebx
+  8002e4:	83 ec 04             	sub    $0x4,%esp
+  8002e7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8002ea:	8b 13                	mov    (%ebx),%edx
+  8002ec:	8d 42 01             	lea    0x1(%edx),%eax
+  8002ef:	89 03                	mov    %eax,(%ebx)
+  8002f1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8002f4:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8002f8:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8002fd:	74 09                	je     800308 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8002ff:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800303:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800306:	c9                   	leave
+  800307:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800308:	83 ec 08             	sub    $0x8,%esp
+  80030b:	68 ff 00 00 00       	push   $0xff
+  800310:	8d 43 08             	lea    0x8(%ebx),%eax
+  800313:	50                   	push   %eax
+  800314:	e8 45 09 00 00       	call   800c5e <sys_cputs>
+		b->idx = 0;
+  800319:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80031f:	83 c4 10             	add    $0x10,%esp
+  800322:	eb db                	jmp    8002ff <putch+0x1f>
+
+00800324 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800324:	55                   	push   %ebp
+  800325:	89 e5                	mov    %esp,%ebp
+  800327:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80032d:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800334:	00 00 00 
+	b.cnt = 0;
+  800337:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80033e:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800341:	ff 75 0c             	push   0xc(%ebp)
+  800344:	ff 75 08             	push   0x8(%ebp)
+  800347:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80034d:	50                   	push   %eax
+  80034e:	68 e0 02 80 00       	push   $0x8002e0
+  800353:	e8 14 01 00 00       	call   80046c <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800358:	83 c4 08             	add    $0x8,%esp
+  80035b:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800361:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800367:	50                   	push   %eax
+  800368:	e8 f1 08 00 00       	call   800c5e <sys_cputs>
+
+	return b.cnt;
+}
+  80036d:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800373:	c9                   	leave
+  800374:	c3                   	ret
+
+00800375 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800375:	55                   	push   %ebp
+  800376:	89 e5                	mov    %esp,%ebp
+  800378:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80037b:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80037e:	50                   	push   %eax
+  80037f:	ff 75 08             	push   0x8(%ebp)
+  800382:	e8 9d ff ff ff       	call   800324 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800387:	c9                   	leave
+  800388:	c3                   	ret
+
+00800389 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800389:	55                   	push   %ebp
+  80038a:	89 e5                	mov    %esp,%ebp
+  80038c:	57                   	push   %edi
+  80038d:	56                   	push   %esi
+  80038e:	53                   	push   %ebx
+  80038f:	83 ec 1c             	sub    $0x1c,%esp
+  800392:	89 c7                	mov    %eax,%edi
+  800394:	89 d6                	mov    %edx,%esi
+  800396:	8b 45 08             	mov    0x8(%ebp),%eax
+  800399:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80039c:	89 d1                	mov    %edx,%ecx
+  80039e:	89 c2                	mov    %eax,%edx
+  8003a0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8003a3:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8003a6:	8b 45 10             	mov    0x10(%ebp),%eax
+  8003a9:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8003ac:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003af:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8003b6:	39 c2                	cmp    %eax,%edx
+  8003b8:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8003bb:	72 3e                	jb     8003fb <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8003bd:	83 ec 0c             	sub    $0xc,%esp
+  8003c0:	ff 75 18             	push   0x18(%ebp)
+  8003c3:	83 eb 01             	sub    $0x1,%ebx
+  8003c6:	53                   	push   %ebx
+  8003c7:	50                   	push   %eax
+  8003c8:	83 ec 08             	sub    $0x8,%esp
+  8003cb:	ff 75 e4             	push   -0x1c(%ebp)
+  8003ce:	ff 75 e0             	push   -0x20(%ebp)
+  8003d1:	ff 75 dc             	push   -0x24(%ebp)
+  8003d4:	ff 75 d8             	push   -0x28(%ebp)
+  8003d7:	e8 24 23 00 00       	call   802700 <__udivdi3>
+  8003dc:	83 c4 18             	add    $0x18,%esp
+  8003df:	52                   	push   %edx
+  8003e0:	50                   	push   %eax
+  8003e1:	89 f2                	mov    %esi,%edx
+  8003e3:	89 f8                	mov    %edi,%eax
+  8003e5:	e8 9f ff ff ff       	call   800389 <printnum>
+  8003ea:	83 c4 20             	add    $0x20,%esp
+  8003ed:	eb 13                	jmp    800402 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8003ef:	83 ec 08             	sub    $0x8,%esp
+  8003f2:	56                   	push   %esi
+  8003f3:	ff 75 18             	push   0x18(%ebp)
+  8003f6:	ff d7                	call   *%edi
+  8003f8:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8003fb:	83 eb 01             	sub    $0x1,%ebx
+  8003fe:	85 db                	test   %ebx,%ebx
+  800400:	7f ed                	jg     8003ef <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800402:	83 ec 08             	sub    $0x8,%esp
+  800405:	56                   	push   %esi
+  800406:	83 ec 04             	sub    $0x4,%esp
+  800409:	ff 75 e4             	push   -0x1c(%ebp)
+  80040c:	ff 75 e0             	push   -0x20(%ebp)
+  80040f:	ff 75 dc             	push   -0x24(%ebp)
+  800412:	ff 75 d8             	push   -0x28(%ebp)
+  800415:	e8 b6 23 00 00       	call   8027d0 <__umoddi3>
+  80041a:	83 c4 14             	add    $0x14,%esp
+  80041d:	0f be 80 7f 2b 80 00 	movsbl 0x802b7f(%eax),%eax
+  800424:	50                   	push   %eax
+  800425:	ff d7                	call   *%edi
+}
+  800427:	83 c4 10             	add    $0x10,%esp
+  80042a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80042d:	5b                   	pop    %ebx
+  80042e:	5e                   	pop    %esi
+  80042f:	5f                   	pop    %edi
+  800430:	5d                   	pop    %ebp
+  800431:	c3                   	ret
+
+00800432 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800432:	55                   	push   %ebp
+  800433:	89 e5                	mov    %esp,%ebp
+  800435:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800438:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80043c:	8b 10                	mov    (%eax),%edx
+  80043e:	3b 50 04             	cmp    0x4(%eax),%edx
+  800441:	73 0a                	jae    80044d <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800443:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800446:	89 08                	mov    %ecx,(%eax)
+  800448:	8b 45 08             	mov    0x8(%ebp),%eax
+  80044b:	88 02                	mov    %al,(%edx)
+}
+  80044d:	5d                   	pop    %ebp
+  80044e:	c3                   	ret
+
+0080044f <printfmt>:
+{
+  80044f:	55                   	push   %ebp
+  800450:	89 e5                	mov    %esp,%ebp
+  800452:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800455:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800458:	50                   	push   %eax
+  800459:	ff 75 10             	push   0x10(%ebp)
+  80045c:	ff 75 0c             	push   0xc(%ebp)
+  80045f:	ff 75 08             	push   0x8(%ebp)
+  800462:	e8 05 00 00 00       	call   80046c <vprintfmt>
+}
+  800467:	83 c4 10             	add    $0x10,%esp
+  80046a:	c9                   	leave
+  80046b:	c3                   	ret
+
+0080046c <vprintfmt>:
+{
+  80046c:	55                   	push   %ebp
+  80046d:	89 e5                	mov    %esp,%ebp
+  80046f:	57                   	push   %edi
+  800470:	56                   	push   %esi
+  800471:	53                   	push   %ebx
+  800472:	83 ec 2c             	sub    $0x2c,%esp
+  800475:	8b 75 08             	mov    0x8(%ebp),%esi
+  800478:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80047b:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80047e:	eb 0a                	jmp    80048a <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800480:	83 ec 08             	sub    $0x8,%esp
+  800483:	53                   	push   %ebx
+  800484:	50                   	push   %eax
+  800485:	ff d6                	call   *%esi
+  800487:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80048a:	83 c7 01             	add    $0x1,%edi
+  80048d:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800491:	83 f8 25             	cmp    $0x25,%eax
+  800494:	74 0c                	je     8004a2 <vprintfmt+0x36>
+			if (ch == '\0')
+  800496:	85 c0                	test   %eax,%eax
+  800498:	75 e6                	jne    800480 <vprintfmt+0x14>
+}
+  80049a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80049d:	5b                   	pop    %ebx
+  80049e:	5e                   	pop    %esi
+  80049f:	5f                   	pop    %edi
+  8004a0:	5d                   	pop    %ebp
+  8004a1:	c3                   	ret
+		padc = ' ';
+  8004a2:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8004a6:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8004ad:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8004b4:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8004bb:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8004c0:	8d 47 01             	lea    0x1(%edi),%eax
+  8004c3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8004c6:	0f b6 17             	movzbl (%edi),%edx
+  8004c9:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8004cc:	3c 55                	cmp    $0x55,%al
+  8004ce:	0f 87 9a 03 00 00    	ja     80086e <vprintfmt+0x402>
+  8004d4:	0f b6 c0             	movzbl %al,%eax
+  8004d7:	ff 24 85 c0 2c 80 00 	jmp    *0x802cc0(,%eax,4)
+  8004de:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8004e1:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8004e5:	eb d9                	jmp    8004c0 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004e7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8004ea:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8004ee:	eb d0                	jmp    8004c0 <vprintfmt+0x54>
+  8004f0:	0f b6 d2             	movzbl %dl,%edx
+  8004f3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8004f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004fb:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8004fe:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800501:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800505:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800508:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80050b:	83 f9 09             	cmp    $0x9,%ecx
+  80050e:	77 55                	ja     800565 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800510:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800513:	eb e9                	jmp    8004fe <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800515:	8b 45 14             	mov    0x14(%ebp),%eax
+  800518:	8b 00                	mov    (%eax),%eax
+  80051a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80051d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800520:	8d 40 04             	lea    0x4(%eax),%eax
+  800523:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800526:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800529:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80052d:	79 91                	jns    8004c0 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80052f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800532:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800535:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80053c:	eb 82                	jmp    8004c0 <vprintfmt+0x54>
+			if (width < 0)
+  80053e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800541:	85 d2                	test   %edx,%edx
+  800543:	b8 00 00 00 00       	mov    $0x0,%eax
+  800548:	0f 49 c2             	cmovns %edx,%eax
+  80054b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80054e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800551:	e9 6a ff ff ff       	jmp    8004c0 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800556:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800559:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800560:	e9 5b ff ff ff       	jmp    8004c0 <vprintfmt+0x54>
+  800565:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800568:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80056b:	eb bc                	jmp    800529 <vprintfmt+0xbd>
+			lflag++;
+  80056d:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800570:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800573:	e9 48 ff ff ff       	jmp    8004c0 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800578:	8b 45 14             	mov    0x14(%ebp),%eax
+  80057b:	8d 78 04             	lea    0x4(%eax),%edi
+  80057e:	83 ec 08             	sub    $0x8,%esp
+  800581:	53                   	push   %ebx
+  800582:	ff 30                	push   (%eax)
+  800584:	ff d6                	call   *%esi
+			break;
+  800586:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800589:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80058c:	e9 7c 02 00 00       	jmp    80080d <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  800591:	8b 45 14             	mov    0x14(%ebp),%eax
+  800594:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800597:	8b 10                	mov    (%eax),%edx
+  800599:	89 d0                	mov    %edx,%eax
+  80059b:	f7 d8                	neg    %eax
+  80059d:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8005a0:	83 f8 10             	cmp    $0x10,%eax
+  8005a3:	7f 23                	jg     8005c8 <vprintfmt+0x15c>
+  8005a5:	8b 14 85 20 2e 80 00 	mov    0x802e20(,%eax,4),%edx
+  8005ac:	85 d2                	test   %edx,%edx
+  8005ae:	74 18                	je     8005c8 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8005b0:	52                   	push   %edx
+  8005b1:	68 65 30 80 00       	push   $0x803065
+  8005b6:	53                   	push   %ebx
+  8005b7:	56                   	push   %esi
+  8005b8:	e8 92 fe ff ff       	call   80044f <printfmt>
+  8005bd:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005c0:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8005c3:	e9 45 02 00 00       	jmp    80080d <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  8005c8:	50                   	push   %eax
+  8005c9:	68 97 2b 80 00       	push   $0x802b97
+  8005ce:	53                   	push   %ebx
+  8005cf:	56                   	push   %esi
+  8005d0:	e8 7a fe ff ff       	call   80044f <printfmt>
+  8005d5:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005d8:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8005db:	e9 2d 02 00 00       	jmp    80080d <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005e0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e3:	83 c0 04             	add    $0x4,%eax
+  8005e6:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8005e9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ec:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8005ee:	85 c9                	test   %ecx,%ecx
+  8005f0:	b8 90 2b 80 00       	mov    $0x802b90,%eax
+  8005f5:	0f 45 c1             	cmovne %ecx,%eax
+  8005f8:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8005fb:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005ff:	7e 06                	jle    800607 <vprintfmt+0x19b>
+  800601:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800605:	75 0b                	jne    800612 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800607:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80060a:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80060d:	89 75 08             	mov    %esi,0x8(%ebp)
+  800610:	eb 5c                	jmp    80066e <vprintfmt+0x202>
+  800612:	83 ec 08             	sub    $0x8,%esp
+  800615:	ff 75 d0             	push   -0x30(%ebp)
+  800618:	ff 75 cc             	push   -0x34(%ebp)
+  80061b:	e8 eb 02 00 00       	call   80090b <strnlen>
+  800620:	89 c2                	mov    %eax,%edx
+  800622:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800625:	29 d0                	sub    %edx,%eax
+  800627:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80062a:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80062e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800631:	89 75 08             	mov    %esi,0x8(%ebp)
+  800634:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800636:	eb 0e                	jmp    800646 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800638:	83 ec 08             	sub    $0x8,%esp
+  80063b:	53                   	push   %ebx
+  80063c:	57                   	push   %edi
+  80063d:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800640:	83 ee 01             	sub    $0x1,%esi
+  800643:	83 c4 10             	add    $0x10,%esp
+  800646:	85 f6                	test   %esi,%esi
+  800648:	7f ee                	jg     800638 <vprintfmt+0x1cc>
+  80064a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80064d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800650:	85 c0                	test   %eax,%eax
+  800652:	ba 00 00 00 00       	mov    $0x0,%edx
+  800657:	0f 49 d0             	cmovns %eax,%edx
+  80065a:	29 d0                	sub    %edx,%eax
+  80065c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80065f:	eb a6                	jmp    800607 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800661:	83 ec 08             	sub    $0x8,%esp
+  800664:	53                   	push   %ebx
+  800665:	52                   	push   %edx
+  800666:	ff 55 08             	call   *0x8(%ebp)
+  800669:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80066c:	89 f1                	mov    %esi,%ecx
+  80066e:	8d 71 01             	lea    0x1(%ecx),%esi
+  800671:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800675:	0f be d0             	movsbl %al,%edx
+  800678:	85 d2                	test   %edx,%edx
+  80067a:	74 28                	je     8006a4 <vprintfmt+0x238>
+  80067c:	85 ff                	test   %edi,%edi
+  80067e:	78 05                	js     800685 <vprintfmt+0x219>
+  800680:	83 ef 01             	sub    $0x1,%edi
+  800683:	78 30                	js     8006b5 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800685:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800689:	74 d6                	je     800661 <vprintfmt+0x1f5>
+  80068b:	0f be c0             	movsbl %al,%eax
+  80068e:	83 e8 20             	sub    $0x20,%eax
+  800691:	83 f8 5e             	cmp    $0x5e,%eax
+  800694:	76 cb                	jbe    800661 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800696:	83 ec 08             	sub    $0x8,%esp
+  800699:	53                   	push   %ebx
+  80069a:	6a 3f                	push   $0x3f
+  80069c:	ff 55 08             	call   *0x8(%ebp)
+  80069f:	83 c4 10             	add    $0x10,%esp
+  8006a2:	eb c8                	jmp    80066c <vprintfmt+0x200>
+  8006a4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006a7:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8006aa:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8006ad:	01 d0                	add    %edx,%eax
+  8006af:	29 c8                	sub    %ecx,%eax
+  8006b1:	89 c7                	mov    %eax,%edi
+  8006b3:	eb 13                	jmp    8006c8 <vprintfmt+0x25c>
+  8006b5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006b8:	eb ed                	jmp    8006a7 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8006ba:	83 ec 08             	sub    $0x8,%esp
+  8006bd:	53                   	push   %ebx
+  8006be:	6a 20                	push   $0x20
+  8006c0:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8006c2:	83 ef 01             	sub    $0x1,%edi
+  8006c5:	83 c4 10             	add    $0x10,%esp
+  8006c8:	85 ff                	test   %edi,%edi
+  8006ca:	7f ee                	jg     8006ba <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8006cc:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8006cf:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006d2:	e9 36 01 00 00       	jmp    80080d <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  8006d7:	83 f9 01             	cmp    $0x1,%ecx
+  8006da:	7f 1f                	jg     8006fb <vprintfmt+0x28f>
+	else if (lflag)
+  8006dc:	85 c9                	test   %ecx,%ecx
+  8006de:	74 67                	je     800747 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8006e0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e3:	8b 00                	mov    (%eax),%eax
+  8006e5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006e8:	89 c1                	mov    %eax,%ecx
+  8006ea:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006ed:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006f0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f3:	8d 40 04             	lea    0x4(%eax),%eax
+  8006f6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006f9:	eb 17                	jmp    800712 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8006fb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006fe:	8b 50 04             	mov    0x4(%eax),%edx
+  800701:	8b 00                	mov    (%eax),%eax
+  800703:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800706:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800709:	8b 45 14             	mov    0x14(%ebp),%eax
+  80070c:	8d 40 08             	lea    0x8(%eax),%eax
+  80070f:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800712:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800715:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800718:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80071d:	85 c9                	test   %ecx,%ecx
+  80071f:	0f 89 ce 00 00 00    	jns    8007f3 <vprintfmt+0x387>
+				putch('-', putdat);
+  800725:	83 ec 08             	sub    $0x8,%esp
+  800728:	53                   	push   %ebx
+  800729:	6a 2d                	push   $0x2d
+  80072b:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80072d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800730:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800733:	f7 da                	neg    %edx
+  800735:	83 d1 00             	adc    $0x0,%ecx
+  800738:	f7 d9                	neg    %ecx
+  80073a:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80073d:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800742:	e9 ac 00 00 00       	jmp    8007f3 <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  800747:	8b 45 14             	mov    0x14(%ebp),%eax
+  80074a:	8b 00                	mov    (%eax),%eax
+  80074c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80074f:	89 c1                	mov    %eax,%ecx
+  800751:	c1 f9 1f             	sar    $0x1f,%ecx
+  800754:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800757:	8b 45 14             	mov    0x14(%ebp),%eax
+  80075a:	8d 40 04             	lea    0x4(%eax),%eax
+  80075d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800760:	eb b0                	jmp    800712 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800762:	83 f9 01             	cmp    $0x1,%ecx
+  800765:	7f 1b                	jg     800782 <vprintfmt+0x316>
+	else if (lflag)
+  800767:	85 c9                	test   %ecx,%ecx
+  800769:	74 2c                	je     800797 <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  80076b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80076e:	8b 10                	mov    (%eax),%edx
+  800770:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800775:	8d 40 04             	lea    0x4(%eax),%eax
+  800778:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80077b:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800780:	eb 71                	jmp    8007f3 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  800782:	8b 45 14             	mov    0x14(%ebp),%eax
+  800785:	8b 10                	mov    (%eax),%edx
+  800787:	8b 48 04             	mov    0x4(%eax),%ecx
+  80078a:	8d 40 08             	lea    0x8(%eax),%eax
+  80078d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800790:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800795:	eb 5c                	jmp    8007f3 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  800797:	8b 45 14             	mov    0x14(%ebp),%eax
+  80079a:	8b 10                	mov    (%eax),%edx
+  80079c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007a1:	8d 40 04             	lea    0x4(%eax),%eax
+  8007a4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007a7:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8007ac:	eb 45                	jmp    8007f3 <vprintfmt+0x387>
+			putch('X', putdat);
+  8007ae:	83 ec 08             	sub    $0x8,%esp
+  8007b1:	53                   	push   %ebx
+  8007b2:	6a 58                	push   $0x58
+  8007b4:	ff d6                	call   *%esi
+			putch('X', putdat);
+  8007b6:	83 c4 08             	add    $0x8,%esp
+  8007b9:	53                   	push   %ebx
+  8007ba:	6a 58                	push   $0x58
+  8007bc:	ff d6                	call   *%esi
+			putch('X', putdat);
+  8007be:	83 c4 08             	add    $0x8,%esp
+  8007c1:	53                   	push   %ebx
+  8007c2:	6a 58                	push   $0x58
+  8007c4:	ff d6                	call   *%esi
+			break;
+  8007c6:	83 c4 10             	add    $0x10,%esp
+  8007c9:	eb 42                	jmp    80080d <vprintfmt+0x3a1>
+			putch('0', putdat);
+  8007cb:	83 ec 08             	sub    $0x8,%esp
+  8007ce:	53                   	push   %ebx
+  8007cf:	6a 30                	push   $0x30
+  8007d1:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8007d3:	83 c4 08             	add    $0x8,%esp
+  8007d6:	53                   	push   %ebx
+  8007d7:	6a 78                	push   $0x78
+  8007d9:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8007db:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007de:	8b 10                	mov    (%eax),%edx
+  8007e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8007e5:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8007e8:	8d 40 04             	lea    0x4(%eax),%eax
+  8007eb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007ee:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8007f3:	83 ec 0c             	sub    $0xc,%esp
+  8007f6:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8007fa:	50                   	push   %eax
+  8007fb:	ff 75 e0             	push   -0x20(%ebp)
+  8007fe:	57                   	push   %edi
+  8007ff:	51                   	push   %ecx
+  800800:	52                   	push   %edx
+  800801:	89 da                	mov    %ebx,%edx
+  800803:	89 f0                	mov    %esi,%eax
+  800805:	e8 7f fb ff ff       	call   800389 <printnum>
+			break;
+  80080a:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80080d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800810:	e9 75 fc ff ff       	jmp    80048a <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800815:	83 f9 01             	cmp    $0x1,%ecx
+  800818:	7f 1b                	jg     800835 <vprintfmt+0x3c9>
+	else if (lflag)
+  80081a:	85 c9                	test   %ecx,%ecx
+  80081c:	74 2c                	je     80084a <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  80081e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800821:	8b 10                	mov    (%eax),%edx
+  800823:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800828:	8d 40 04             	lea    0x4(%eax),%eax
+  80082b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80082e:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800833:	eb be                	jmp    8007f3 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  800835:	8b 45 14             	mov    0x14(%ebp),%eax
+  800838:	8b 10                	mov    (%eax),%edx
+  80083a:	8b 48 04             	mov    0x4(%eax),%ecx
+  80083d:	8d 40 08             	lea    0x8(%eax),%eax
+  800840:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800843:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800848:	eb a9                	jmp    8007f3 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  80084a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80084d:	8b 10                	mov    (%eax),%edx
+  80084f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800854:	8d 40 04             	lea    0x4(%eax),%eax
+  800857:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80085a:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80085f:	eb 92                	jmp    8007f3 <vprintfmt+0x387>
+			putch(ch, putdat);
+  800861:	83 ec 08             	sub    $0x8,%esp
+  800864:	53                   	push   %ebx
+  800865:	6a 25                	push   $0x25
+  800867:	ff d6                	call   *%esi
+			break;
+  800869:	83 c4 10             	add    $0x10,%esp
+  80086c:	eb 9f                	jmp    80080d <vprintfmt+0x3a1>
+			putch('%', putdat);
+  80086e:	83 ec 08             	sub    $0x8,%esp
+  800871:	53                   	push   %ebx
+  800872:	6a 25                	push   $0x25
+  800874:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800876:	83 c4 10             	add    $0x10,%esp
+  800879:	89 f8                	mov    %edi,%eax
+  80087b:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80087f:	74 05                	je     800886 <vprintfmt+0x41a>
+  800881:	83 e8 01             	sub    $0x1,%eax
+  800884:	eb f5                	jmp    80087b <vprintfmt+0x40f>
+  800886:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800889:	eb 82                	jmp    80080d <vprintfmt+0x3a1>
+
+0080088b <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80088b:	55                   	push   %ebp
+  80088c:	89 e5                	mov    %esp,%ebp
+  80088e:	83 ec 18             	sub    $0x18,%esp
+  800891:	8b 45 08             	mov    0x8(%ebp),%eax
+  800894:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800897:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80089a:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80089e:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8008a1:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8008a8:	85 c0                	test   %eax,%eax
+  8008aa:	74 26                	je     8008d2 <vsnprintf+0x47>
+  8008ac:	85 d2                	test   %edx,%edx
+  8008ae:	7e 22                	jle    8008d2 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8008b0:	ff 75 14             	push   0x14(%ebp)
+  8008b3:	ff 75 10             	push   0x10(%ebp)
+  8008b6:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8008b9:	50                   	push   %eax
+  8008ba:	68 32 04 80 00       	push   $0x800432
+  8008bf:	e8 a8 fb ff ff       	call   80046c <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8008c4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8008c7:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8008ca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008cd:	83 c4 10             	add    $0x10,%esp
+}
+  8008d0:	c9                   	leave
+  8008d1:	c3                   	ret
+		return -E_INVAL;
+  8008d2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008d7:	eb f7                	jmp    8008d0 <vsnprintf+0x45>
+
+008008d9 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8008d9:	55                   	push   %ebp
+  8008da:	89 e5                	mov    %esp,%ebp
+  8008dc:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8008df:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8008e2:	50                   	push   %eax
+  8008e3:	ff 75 10             	push   0x10(%ebp)
+  8008e6:	ff 75 0c             	push   0xc(%ebp)
+  8008e9:	ff 75 08             	push   0x8(%ebp)
+  8008ec:	e8 9a ff ff ff       	call   80088b <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8008f1:	c9                   	leave
+  8008f2:	c3                   	ret
+
+008008f3 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8008f3:	55                   	push   %ebp
+  8008f4:	89 e5                	mov    %esp,%ebp
+  8008f6:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8008f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008fe:	eb 03                	jmp    800903 <strlen+0x10>
+		n++;
+  800900:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800903:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800907:	75 f7                	jne    800900 <strlen+0xd>
+	return n;
+}
+  800909:	5d                   	pop    %ebp
+  80090a:	c3                   	ret
+
+0080090b <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80090b:	55                   	push   %ebp
+  80090c:	89 e5                	mov    %esp,%ebp
+  80090e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800911:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800914:	b8 00 00 00 00       	mov    $0x0,%eax
+  800919:	eb 03                	jmp    80091e <strnlen+0x13>
+		n++;
+  80091b:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80091e:	39 d0                	cmp    %edx,%eax
+  800920:	74 08                	je     80092a <strnlen+0x1f>
+  800922:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800926:	75 f3                	jne    80091b <strnlen+0x10>
+  800928:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80092a:	89 d0                	mov    %edx,%eax
+  80092c:	5d                   	pop    %ebp
+  80092d:	c3                   	ret
+
+0080092e <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80092e:	55                   	push   %ebp
+  80092f:	89 e5                	mov    %esp,%ebp
+  800931:	53                   	push   %ebx
+  800932:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800935:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800938:	b8 00 00 00 00       	mov    $0x0,%eax
+  80093d:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800941:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800944:	83 c0 01             	add    $0x1,%eax
+  800947:	84 d2                	test   %dl,%dl
+  800949:	75 f2                	jne    80093d <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80094b:	89 c8                	mov    %ecx,%eax
+  80094d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800950:	c9                   	leave
+  800951:	c3                   	ret
+
+00800952 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800952:	55                   	push   %ebp
+  800953:	89 e5                	mov    %esp,%ebp
+  800955:	53                   	push   %ebx
+  800956:	83 ec 10             	sub    $0x10,%esp
+  800959:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80095c:	53                   	push   %ebx
+  80095d:	e8 91 ff ff ff       	call   8008f3 <strlen>
+  800962:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800965:	ff 75 0c             	push   0xc(%ebp)
+  800968:	01 d8                	add    %ebx,%eax
+  80096a:	50                   	push   %eax
+  80096b:	e8 be ff ff ff       	call   80092e <strcpy>
+	return dst;
+}
+  800970:	89 d8                	mov    %ebx,%eax
+  800972:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800975:	c9                   	leave
+  800976:	c3                   	ret
+
+00800977 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800977:	55                   	push   %ebp
+  800978:	89 e5                	mov    %esp,%ebp
+  80097a:	56                   	push   %esi
+  80097b:	53                   	push   %ebx
+  80097c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80097f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800982:	89 f3                	mov    %esi,%ebx
+  800984:	03 5d 10             	add    0x10(%ebp),%ebx
+  800987:	89 f0                	mov    %esi,%eax
+  800989:	eb 0f                	jmp    80099a <strncpy+0x23>
+		*dst++ = *src;
+  80098b:	83 c0 01             	add    $0x1,%eax
+  80098e:	0f b6 0a             	movzbl (%edx),%ecx
+  800991:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800994:	80 f9 01             	cmp    $0x1,%cl
+  800997:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80099a:	39 d8                	cmp    %ebx,%eax
+  80099c:	75 ed                	jne    80098b <strncpy+0x14>
+	}
+	return ret;
+}
+  80099e:	89 f0                	mov    %esi,%eax
+  8009a0:	5b                   	pop    %ebx
+  8009a1:	5e                   	pop    %esi
+  8009a2:	5d                   	pop    %ebp
+  8009a3:	c3                   	ret
+
+008009a4 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8009a4:	55                   	push   %ebp
+  8009a5:	89 e5                	mov    %esp,%ebp
+  8009a7:	56                   	push   %esi
+  8009a8:	53                   	push   %ebx
+  8009a9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009ac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009af:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8009b2:	89 f0                	mov    %esi,%eax
+  8009b4:	85 d2                	test   %edx,%edx
+  8009b6:	74 21                	je     8009d9 <strlcpy+0x35>
+  8009b8:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8009bc:	89 f2                	mov    %esi,%edx
+  8009be:	eb 09                	jmp    8009c9 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8009c0:	83 c1 01             	add    $0x1,%ecx
+  8009c3:	83 c2 01             	add    $0x1,%edx
+  8009c6:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8009c9:	39 c2                	cmp    %eax,%edx
+  8009cb:	74 09                	je     8009d6 <strlcpy+0x32>
+  8009cd:	0f b6 19             	movzbl (%ecx),%ebx
+  8009d0:	84 db                	test   %bl,%bl
+  8009d2:	75 ec                	jne    8009c0 <strlcpy+0x1c>
+  8009d4:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8009d6:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8009d9:	29 f0                	sub    %esi,%eax
+}
+  8009db:	5b                   	pop    %ebx
+  8009dc:	5e                   	pop    %esi
+  8009dd:	5d                   	pop    %ebp
+  8009de:	c3                   	ret
+
+008009df <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8009df:	55                   	push   %ebp
+  8009e0:	89 e5                	mov    %esp,%ebp
+  8009e2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009e5:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8009e8:	eb 06                	jmp    8009f0 <strcmp+0x11>
+		p++, q++;
+  8009ea:	83 c1 01             	add    $0x1,%ecx
+  8009ed:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8009f0:	0f b6 01             	movzbl (%ecx),%eax
+  8009f3:	84 c0                	test   %al,%al
+  8009f5:	74 04                	je     8009fb <strcmp+0x1c>
+  8009f7:	3a 02                	cmp    (%edx),%al
+  8009f9:	74 ef                	je     8009ea <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009fb:	0f b6 c0             	movzbl %al,%eax
+  8009fe:	0f b6 12             	movzbl (%edx),%edx
+  800a01:	29 d0                	sub    %edx,%eax
+}
+  800a03:	5d                   	pop    %ebp
+  800a04:	c3                   	ret
+
+00800a05 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800a05:	55                   	push   %ebp
+  800a06:	89 e5                	mov    %esp,%ebp
+  800a08:	53                   	push   %ebx
+  800a09:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a0c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a0f:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800a12:	eb 09                	jmp    800a1d <strncmp+0x18>
+		n--, p++, q++;
+  800a14:	83 ea 01             	sub    $0x1,%edx
+  800a17:	83 c0 01             	add    $0x1,%eax
+  800a1a:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800a1d:	85 d2                	test   %edx,%edx
+  800a1f:	74 18                	je     800a39 <strncmp+0x34>
+  800a21:	0f b6 18             	movzbl (%eax),%ebx
+  800a24:	84 db                	test   %bl,%bl
+  800a26:	74 04                	je     800a2c <strncmp+0x27>
+  800a28:	3a 19                	cmp    (%ecx),%bl
+  800a2a:	74 e8                	je     800a14 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a2c:	0f b6 00             	movzbl (%eax),%eax
+  800a2f:	0f b6 11             	movzbl (%ecx),%edx
+  800a32:	29 d0                	sub    %edx,%eax
+}
+  800a34:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a37:	c9                   	leave
+  800a38:	c3                   	ret
+		return 0;
+  800a39:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a3e:	eb f4                	jmp    800a34 <strncmp+0x2f>
+
+00800a40 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a40:	55                   	push   %ebp
+  800a41:	89 e5                	mov    %esp,%ebp
+  800a43:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a46:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a4a:	eb 03                	jmp    800a4f <strchr+0xf>
+  800a4c:	83 c0 01             	add    $0x1,%eax
+  800a4f:	0f b6 10             	movzbl (%eax),%edx
+  800a52:	84 d2                	test   %dl,%dl
+  800a54:	74 06                	je     800a5c <strchr+0x1c>
+		if (*s == c)
+  800a56:	38 ca                	cmp    %cl,%dl
+  800a58:	75 f2                	jne    800a4c <strchr+0xc>
+  800a5a:	eb 05                	jmp    800a61 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800a5c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a61:	5d                   	pop    %ebp
+  800a62:	c3                   	ret
+
+00800a63 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a63:	55                   	push   %ebp
+  800a64:	89 e5                	mov    %esp,%ebp
+  800a66:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a69:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a6d:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a70:	38 ca                	cmp    %cl,%dl
+  800a72:	74 09                	je     800a7d <strfind+0x1a>
+  800a74:	84 d2                	test   %dl,%dl
+  800a76:	74 05                	je     800a7d <strfind+0x1a>
+	for (; *s; s++)
+  800a78:	83 c0 01             	add    $0x1,%eax
+  800a7b:	eb f0                	jmp    800a6d <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800a7d:	5d                   	pop    %ebp
+  800a7e:	c3                   	ret
+
+00800a7f <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a7f:	55                   	push   %ebp
+  800a80:	89 e5                	mov    %esp,%ebp
+  800a82:	57                   	push   %edi
+  800a83:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a86:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a89:	85 c9                	test   %ecx,%ecx
+  800a8b:	74 20                	je     800aad <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a8d:	89 f8                	mov    %edi,%eax
+  800a8f:	09 c8                	or     %ecx,%eax
+  800a91:	a8 03                	test   $0x3,%al
+  800a93:	75 12                	jne    800aa7 <memset+0x28>
+		c &= 0xFF;
+  800a95:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a99:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a9f:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800aa2:	fc                   	cld
+  800aa3:	f3 ab                	rep stos %eax,%es:(%edi)
+  800aa5:	eb 06                	jmp    800aad <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800aa7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800aaa:	fc                   	cld
+  800aab:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800aad:	89 f8                	mov    %edi,%eax
+  800aaf:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800ab2:	c9                   	leave
+  800ab3:	c3                   	ret
+
+00800ab4 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800ab4:	55                   	push   %ebp
+  800ab5:	89 e5                	mov    %esp,%ebp
+  800ab7:	57                   	push   %edi
+  800ab8:	56                   	push   %esi
+  800ab9:	8b 45 08             	mov    0x8(%ebp),%eax
+  800abc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800abf:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800ac2:	39 c6                	cmp    %eax,%esi
+  800ac4:	73 32                	jae    800af8 <memmove+0x44>
+  800ac6:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800ac9:	39 d0                	cmp    %edx,%eax
+  800acb:	73 2b                	jae    800af8 <memmove+0x44>
+		s += n;
+		d += n;
+  800acd:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ad0:	89 d6                	mov    %edx,%esi
+  800ad2:	09 fe                	or     %edi,%esi
+  800ad4:	09 ce                	or     %ecx,%esi
+  800ad6:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800adc:	75 0e                	jne    800aec <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800ade:	83 ef 04             	sub    $0x4,%edi
+  800ae1:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800ae4:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800ae7:	fd                   	std
+  800ae8:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800aea:	eb 09                	jmp    800af5 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800aec:	83 ef 01             	sub    $0x1,%edi
+  800aef:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800af2:	fd                   	std
+  800af3:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800af5:	fc                   	cld
+  800af6:	eb 1a                	jmp    800b12 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800af8:	89 f2                	mov    %esi,%edx
+  800afa:	09 c2                	or     %eax,%edx
+  800afc:	09 ca                	or     %ecx,%edx
+  800afe:	f6 c2 03             	test   $0x3,%dl
+  800b01:	75 0a                	jne    800b0d <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800b03:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800b06:	89 c7                	mov    %eax,%edi
+  800b08:	fc                   	cld
+  800b09:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b0b:	eb 05                	jmp    800b12 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800b0d:	89 c7                	mov    %eax,%edi
+  800b0f:	fc                   	cld
+  800b10:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800b12:	5e                   	pop    %esi
+  800b13:	5f                   	pop    %edi
+  800b14:	5d                   	pop    %ebp
+  800b15:	c3                   	ret
+
+00800b16 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800b16:	55                   	push   %ebp
+  800b17:	89 e5                	mov    %esp,%ebp
+  800b19:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800b1c:	ff 75 10             	push   0x10(%ebp)
+  800b1f:	ff 75 0c             	push   0xc(%ebp)
+  800b22:	ff 75 08             	push   0x8(%ebp)
+  800b25:	e8 8a ff ff ff       	call   800ab4 <memmove>
+}
+  800b2a:	c9                   	leave
+  800b2b:	c3                   	ret
+
+00800b2c <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800b2c:	55                   	push   %ebp
+  800b2d:	89 e5                	mov    %esp,%ebp
+  800b2f:	56                   	push   %esi
+  800b30:	53                   	push   %ebx
+  800b31:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b34:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800b37:	89 c6                	mov    %eax,%esi
+  800b39:	03 75 10             	add    0x10(%ebp),%esi
+  800b3c:	eb 06                	jmp    800b44 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800b3e:	83 c0 01             	add    $0x1,%eax
+  800b41:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b44:	39 f0                	cmp    %esi,%eax
+  800b46:	74 14                	je     800b5c <memcmp+0x30>
+		if (*s1 != *s2)
+  800b48:	0f b6 08             	movzbl (%eax),%ecx
+  800b4b:	0f b6 1a             	movzbl (%edx),%ebx
+  800b4e:	38 d9                	cmp    %bl,%cl
+  800b50:	74 ec                	je     800b3e <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800b52:	0f b6 c1             	movzbl %cl,%eax
+  800b55:	0f b6 db             	movzbl %bl,%ebx
+  800b58:	29 d8                	sub    %ebx,%eax
+  800b5a:	eb 05                	jmp    800b61 <memcmp+0x35>
+	}
+
+	return 0;
+  800b5c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b61:	5b                   	pop    %ebx
+  800b62:	5e                   	pop    %esi
+  800b63:	5d                   	pop    %ebp
+  800b64:	c3                   	ret
+
+00800b65 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b65:	55                   	push   %ebp
+  800b66:	89 e5                	mov    %esp,%ebp
+  800b68:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b6b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b6e:	89 c2                	mov    %eax,%edx
+  800b70:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b73:	eb 03                	jmp    800b78 <memfind+0x13>
+  800b75:	83 c0 01             	add    $0x1,%eax
+  800b78:	39 d0                	cmp    %edx,%eax
+  800b7a:	73 04                	jae    800b80 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b7c:	38 08                	cmp    %cl,(%eax)
+  800b7e:	75 f5                	jne    800b75 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800b80:	5d                   	pop    %ebp
+  800b81:	c3                   	ret
+
+00800b82 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800b82:	55                   	push   %ebp
+  800b83:	89 e5                	mov    %esp,%ebp
+  800b85:	57                   	push   %edi
+  800b86:	56                   	push   %esi
+  800b87:	53                   	push   %ebx
+  800b88:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b8b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b8e:	eb 03                	jmp    800b93 <strtol+0x11>
+		s++;
+  800b90:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800b93:	0f b6 02             	movzbl (%edx),%eax
+  800b96:	3c 20                	cmp    $0x20,%al
+  800b98:	74 f6                	je     800b90 <strtol+0xe>
+  800b9a:	3c 09                	cmp    $0x9,%al
+  800b9c:	74 f2                	je     800b90 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b9e:	3c 2b                	cmp    $0x2b,%al
+  800ba0:	74 2a                	je     800bcc <strtol+0x4a>
+	int neg = 0;
+  800ba2:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800ba7:	3c 2d                	cmp    $0x2d,%al
+  800ba9:	74 2b                	je     800bd6 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800bab:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800bb1:	75 0f                	jne    800bc2 <strtol+0x40>
+  800bb3:	80 3a 30             	cmpb   $0x30,(%edx)
+  800bb6:	74 28                	je     800be0 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800bb8:	85 db                	test   %ebx,%ebx
+  800bba:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800bbf:	0f 44 d8             	cmove  %eax,%ebx
+  800bc2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bc7:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800bca:	eb 46                	jmp    800c12 <strtol+0x90>
+		s++;
+  800bcc:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800bcf:	bf 00 00 00 00       	mov    $0x0,%edi
+  800bd4:	eb d5                	jmp    800bab <strtol+0x29>
+		s++, neg = 1;
+  800bd6:	83 c2 01             	add    $0x1,%edx
+  800bd9:	bf 01 00 00 00       	mov    $0x1,%edi
+  800bde:	eb cb                	jmp    800bab <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800be0:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800be4:	74 0e                	je     800bf4 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800be6:	85 db                	test   %ebx,%ebx
+  800be8:	75 d8                	jne    800bc2 <strtol+0x40>
+		s++, base = 8;
+  800bea:	83 c2 01             	add    $0x1,%edx
+  800bed:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800bf2:	eb ce                	jmp    800bc2 <strtol+0x40>
+		s += 2, base = 16;
+  800bf4:	83 c2 02             	add    $0x2,%edx
+  800bf7:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800bfc:	eb c4                	jmp    800bc2 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800bfe:	0f be c0             	movsbl %al,%eax
+  800c01:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800c04:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800c07:	7d 3a                	jge    800c43 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800c09:	83 c2 01             	add    $0x1,%edx
+  800c0c:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800c10:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800c12:	0f b6 02             	movzbl (%edx),%eax
+  800c15:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800c18:	89 f3                	mov    %esi,%ebx
+  800c1a:	80 fb 09             	cmp    $0x9,%bl
+  800c1d:	76 df                	jbe    800bfe <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800c1f:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800c22:	89 f3                	mov    %esi,%ebx
+  800c24:	80 fb 19             	cmp    $0x19,%bl
+  800c27:	77 08                	ja     800c31 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800c29:	0f be c0             	movsbl %al,%eax
+  800c2c:	83 e8 57             	sub    $0x57,%eax
+  800c2f:	eb d3                	jmp    800c04 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800c31:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c34:	89 f3                	mov    %esi,%ebx
+  800c36:	80 fb 19             	cmp    $0x19,%bl
+  800c39:	77 08                	ja     800c43 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800c3b:	0f be c0             	movsbl %al,%eax
+  800c3e:	83 e8 37             	sub    $0x37,%eax
+  800c41:	eb c1                	jmp    800c04 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c43:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c47:	74 05                	je     800c4e <strtol+0xcc>
+		*endptr = (char *) s;
+  800c49:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c4c:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800c4e:	89 c8                	mov    %ecx,%eax
+  800c50:	f7 d8                	neg    %eax
+  800c52:	85 ff                	test   %edi,%edi
+  800c54:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800c57:	89 c8                	mov    %ecx,%eax
+  800c59:	5b                   	pop    %ebx
+  800c5a:	5e                   	pop    %esi
+  800c5b:	5f                   	pop    %edi
+  800c5c:	5d                   	pop    %ebp
+  800c5d:	c3                   	ret
+
+00800c5e <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800c5e:	55                   	push   %ebp
+  800c5f:	89 e5                	mov    %esp,%ebp
+  800c61:	57                   	push   %edi
+  800c62:	56                   	push   %esi
+  800c63:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800c64:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c69:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c6c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c6f:	89 c3                	mov    %eax,%ebx
+  800c71:	89 c7                	mov    %eax,%edi
+  800c73:	89 c6                	mov    %eax,%esi
+  800c75:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  800c77:	5b                   	pop    %ebx
+  800c78:	5e                   	pop    %esi
+  800c79:	5f                   	pop    %edi
+  800c7a:	5d                   	pop    %ebp
+  800c7b:	c3                   	ret
+
+00800c7c <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800c7c:	55                   	push   %ebp
+  800c7d:	89 e5                	mov    %esp,%ebp
+  800c7f:	57                   	push   %edi
+  800c80:	56                   	push   %esi
+  800c81:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800c82:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c87:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c8c:	89 d1                	mov    %edx,%ecx
+  800c8e:	89 d3                	mov    %edx,%ebx
+  800c90:	89 d7                	mov    %edx,%edi
+  800c92:	89 d6                	mov    %edx,%esi
+  800c94:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c96:	5b                   	pop    %ebx
+  800c97:	5e                   	pop    %esi
+  800c98:	5f                   	pop    %edi
+  800c99:	5d                   	pop    %ebp
+  800c9a:	c3                   	ret
+
+00800c9b <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800c9b:	55                   	push   %ebp
+  800c9c:	89 e5                	mov    %esp,%ebp
+  800c9e:	57                   	push   %edi
+  800c9f:	56                   	push   %esi
+  800ca0:	53                   	push   %ebx
+  800ca1:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800ca4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ca9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cac:	b8 03 00 00 00       	mov    $0x3,%eax
+  800cb1:	89 cb                	mov    %ecx,%ebx
+  800cb3:	89 cf                	mov    %ecx,%edi
+  800cb5:	89 ce                	mov    %ecx,%esi
+  800cb7:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800cb9:	85 c0                	test   %eax,%eax
+  800cbb:	7f 08                	jg     800cc5 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800cbd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cc0:	5b                   	pop    %ebx
+  800cc1:	5e                   	pop    %esi
+  800cc2:	5f                   	pop    %edi
+  800cc3:	5d                   	pop    %ebp
+  800cc4:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800cc5:	83 ec 0c             	sub    $0xc,%esp
+  800cc8:	50                   	push   %eax
+  800cc9:	6a 03                	push   $0x3
+  800ccb:	68 83 2e 80 00       	push   $0x802e83
+  800cd0:	6a 3e                	push   $0x3e
+  800cd2:	68 a0 2e 80 00       	push   $0x802ea0
+  800cd7:	e8 be f5 ff ff       	call   80029a <_panic>
+
+00800cdc <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800cdc:	55                   	push   %ebp
+  800cdd:	89 e5                	mov    %esp,%ebp
+  800cdf:	57                   	push   %edi
+  800ce0:	56                   	push   %esi
+  800ce1:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800ce2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ce7:	b8 02 00 00 00       	mov    $0x2,%eax
+  800cec:	89 d1                	mov    %edx,%ecx
+  800cee:	89 d3                	mov    %edx,%ebx
+  800cf0:	89 d7                	mov    %edx,%edi
+  800cf2:	89 d6                	mov    %edx,%esi
+  800cf4:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800cf6:	5b                   	pop    %ebx
+  800cf7:	5e                   	pop    %esi
+  800cf8:	5f                   	pop    %edi
+  800cf9:	5d                   	pop    %ebp
+  800cfa:	c3                   	ret
+
+00800cfb <sys_yield>:
+
+void
+sys_yield(void) {
+  800cfb:	55                   	push   %ebp
+  800cfc:	89 e5                	mov    %esp,%ebp
+  800cfe:	57                   	push   %edi
+  800cff:	56                   	push   %esi
+  800d00:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d01:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d06:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d0b:	89 d1                	mov    %edx,%ecx
+  800d0d:	89 d3                	mov    %edx,%ebx
+  800d0f:	89 d7                	mov    %edx,%edi
+  800d11:	89 d6                	mov    %edx,%esi
+  800d13:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800d15:	5b                   	pop    %ebx
+  800d16:	5e                   	pop    %esi
+  800d17:	5f                   	pop    %edi
+  800d18:	5d                   	pop    %ebp
+  800d19:	c3                   	ret
+
+00800d1a <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  800d1a:	55                   	push   %ebp
+  800d1b:	89 e5                	mov    %esp,%ebp
+  800d1d:	57                   	push   %edi
+  800d1e:	56                   	push   %esi
+  800d1f:	53                   	push   %ebx
+  800d20:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800d23:	be 00 00 00 00       	mov    $0x0,%esi
+  800d28:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d2b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d2e:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d33:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d36:	89 f7                	mov    %esi,%edi
+  800d38:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d3a:	85 c0                	test   %eax,%eax
+  800d3c:	7f 08                	jg     800d46 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800d3e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d41:	5b                   	pop    %ebx
+  800d42:	5e                   	pop    %esi
+  800d43:	5f                   	pop    %edi
+  800d44:	5d                   	pop    %ebp
+  800d45:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d46:	83 ec 0c             	sub    $0xc,%esp
+  800d49:	50                   	push   %eax
+  800d4a:	6a 04                	push   $0x4
+  800d4c:	68 83 2e 80 00       	push   $0x802e83
+  800d51:	6a 3e                	push   $0x3e
+  800d53:	68 a0 2e 80 00       	push   $0x802ea0
+  800d58:	e8 3d f5 ff ff       	call   80029a <_panic>
+
+00800d5d <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  800d5d:	55                   	push   %ebp
+  800d5e:	89 e5                	mov    %esp,%ebp
+  800d60:	57                   	push   %edi
+  800d61:	56                   	push   %esi
+  800d62:	53                   	push   %ebx
+  800d63:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800d66:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d69:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d6c:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d71:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d74:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d77:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d7a:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d7c:	85 c0                	test   %eax,%eax
+  800d7e:	7f 08                	jg     800d88 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800d80:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d83:	5b                   	pop    %ebx
+  800d84:	5e                   	pop    %esi
+  800d85:	5f                   	pop    %edi
+  800d86:	5d                   	pop    %ebp
+  800d87:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d88:	83 ec 0c             	sub    $0xc,%esp
+  800d8b:	50                   	push   %eax
+  800d8c:	6a 05                	push   $0x5
+  800d8e:	68 83 2e 80 00       	push   $0x802e83
+  800d93:	6a 3e                	push   $0x3e
+  800d95:	68 a0 2e 80 00       	push   $0x802ea0
+  800d9a:	e8 fb f4 ff ff       	call   80029a <_panic>
+
+00800d9f <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  800d9f:	55                   	push   %ebp
+  800da0:	89 e5                	mov    %esp,%ebp
+  800da2:	57                   	push   %edi
+  800da3:	56                   	push   %esi
+  800da4:	53                   	push   %ebx
+  800da5:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800da8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dad:	8b 55 08             	mov    0x8(%ebp),%edx
+  800db0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800db3:	b8 06 00 00 00       	mov    $0x6,%eax
+  800db8:	89 df                	mov    %ebx,%edi
+  800dba:	89 de                	mov    %ebx,%esi
+  800dbc:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800dbe:	85 c0                	test   %eax,%eax
+  800dc0:	7f 08                	jg     800dca <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800dc2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dc5:	5b                   	pop    %ebx
+  800dc6:	5e                   	pop    %esi
+  800dc7:	5f                   	pop    %edi
+  800dc8:	5d                   	pop    %ebp
+  800dc9:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800dca:	83 ec 0c             	sub    $0xc,%esp
+  800dcd:	50                   	push   %eax
+  800dce:	6a 06                	push   $0x6
+  800dd0:	68 83 2e 80 00       	push   $0x802e83
+  800dd5:	6a 3e                	push   $0x3e
+  800dd7:	68 a0 2e 80 00       	push   $0x802ea0
+  800ddc:	e8 b9 f4 ff ff       	call   80029a <_panic>
+
+00800de1 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800de1:	55                   	push   %ebp
+  800de2:	89 e5                	mov    %esp,%ebp
+  800de4:	57                   	push   %edi
+  800de5:	56                   	push   %esi
+  800de6:	53                   	push   %ebx
+  800de7:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800dea:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800def:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800df5:	b8 08 00 00 00       	mov    $0x8,%eax
+  800dfa:	89 df                	mov    %ebx,%edi
+  800dfc:	89 de                	mov    %ebx,%esi
+  800dfe:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e00:	85 c0                	test   %eax,%eax
+  800e02:	7f 08                	jg     800e0c <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800e04:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e07:	5b                   	pop    %ebx
+  800e08:	5e                   	pop    %esi
+  800e09:	5f                   	pop    %edi
+  800e0a:	5d                   	pop    %ebp
+  800e0b:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e0c:	83 ec 0c             	sub    $0xc,%esp
+  800e0f:	50                   	push   %eax
+  800e10:	6a 08                	push   $0x8
+  800e12:	68 83 2e 80 00       	push   $0x802e83
+  800e17:	6a 3e                	push   $0x3e
+  800e19:	68 a0 2e 80 00       	push   $0x802ea0
+  800e1e:	e8 77 f4 ff ff       	call   80029a <_panic>
+
+00800e23 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800e23:	55                   	push   %ebp
+  800e24:	89 e5                	mov    %esp,%ebp
+  800e26:	57                   	push   %edi
+  800e27:	56                   	push   %esi
+  800e28:	53                   	push   %ebx
+  800e29:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800e2c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e31:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e34:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e37:	b8 09 00 00 00       	mov    $0x9,%eax
+  800e3c:	89 df                	mov    %ebx,%edi
+  800e3e:	89 de                	mov    %ebx,%esi
+  800e40:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e42:	85 c0                	test   %eax,%eax
+  800e44:	7f 08                	jg     800e4e <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800e46:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e49:	5b                   	pop    %ebx
+  800e4a:	5e                   	pop    %esi
+  800e4b:	5f                   	pop    %edi
+  800e4c:	5d                   	pop    %ebp
+  800e4d:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e4e:	83 ec 0c             	sub    $0xc,%esp
+  800e51:	50                   	push   %eax
+  800e52:	6a 09                	push   $0x9
+  800e54:	68 83 2e 80 00       	push   $0x802e83
+  800e59:	6a 3e                	push   $0x3e
+  800e5b:	68 a0 2e 80 00       	push   $0x802ea0
+  800e60:	e8 35 f4 ff ff       	call   80029a <_panic>
+
+00800e65 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800e65:	55                   	push   %ebp
+  800e66:	89 e5                	mov    %esp,%ebp
+  800e68:	57                   	push   %edi
+  800e69:	56                   	push   %esi
+  800e6a:	53                   	push   %ebx
+  800e6b:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800e6e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e73:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e76:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e79:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e7e:	89 df                	mov    %ebx,%edi
+  800e80:	89 de                	mov    %ebx,%esi
+  800e82:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e84:	85 c0                	test   %eax,%eax
+  800e86:	7f 08                	jg     800e90 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800e88:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e8b:	5b                   	pop    %ebx
+  800e8c:	5e                   	pop    %esi
+  800e8d:	5f                   	pop    %edi
+  800e8e:	5d                   	pop    %ebp
+  800e8f:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e90:	83 ec 0c             	sub    $0xc,%esp
+  800e93:	50                   	push   %eax
+  800e94:	6a 0a                	push   $0xa
+  800e96:	68 83 2e 80 00       	push   $0x802e83
+  800e9b:	6a 3e                	push   $0x3e
+  800e9d:	68 a0 2e 80 00       	push   $0x802ea0
+  800ea2:	e8 f3 f3 ff ff       	call   80029a <_panic>
+
+00800ea7 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  800ea7:	55                   	push   %ebp
+  800ea8:	89 e5                	mov    %esp,%ebp
+  800eaa:	57                   	push   %edi
+  800eab:	56                   	push   %esi
+  800eac:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800ead:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb3:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800eb8:	be 00 00 00 00       	mov    $0x0,%esi
+  800ebd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ec0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ec3:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800ec5:	5b                   	pop    %ebx
+  800ec6:	5e                   	pop    %esi
+  800ec7:	5f                   	pop    %edi
+  800ec8:	5d                   	pop    %ebp
+  800ec9:	c3                   	ret
+
+00800eca <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  800eca:	55                   	push   %ebp
+  800ecb:	89 e5                	mov    %esp,%ebp
+  800ecd:	57                   	push   %edi
+  800ece:	56                   	push   %esi
+  800ecf:	53                   	push   %ebx
+  800ed0:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800ed3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ed8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800edb:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800ee0:	89 cb                	mov    %ecx,%ebx
+  800ee2:	89 cf                	mov    %ecx,%edi
+  800ee4:	89 ce                	mov    %ecx,%esi
+  800ee6:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ee8:	85 c0                	test   %eax,%eax
+  800eea:	7f 08                	jg     800ef4 <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  800eec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eef:	5b                   	pop    %ebx
+  800ef0:	5e                   	pop    %esi
+  800ef1:	5f                   	pop    %edi
+  800ef2:	5d                   	pop    %ebp
+  800ef3:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ef4:	83 ec 0c             	sub    $0xc,%esp
+  800ef7:	50                   	push   %eax
+  800ef8:	6a 0d                	push   $0xd
+  800efa:	68 83 2e 80 00       	push   $0x802e83
+  800eff:	6a 3e                	push   $0x3e
+  800f01:	68 a0 2e 80 00       	push   $0x802ea0
+  800f06:	e8 8f f3 ff ff       	call   80029a <_panic>
+
+00800f0b <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  800f0b:	55                   	push   %ebp
+  800f0c:	89 e5                	mov    %esp,%ebp
+  800f0e:	57                   	push   %edi
+  800f0f:	56                   	push   %esi
+  800f10:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800f11:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f16:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f19:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f1c:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800f21:	89 df                	mov    %ebx,%edi
+  800f23:	89 de                	mov    %ebx,%esi
+  800f25:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  800f27:	5b                   	pop    %ebx
+  800f28:	5e                   	pop    %esi
+  800f29:	5f                   	pop    %edi
+  800f2a:	5d                   	pop    %ebp
+  800f2b:	c3                   	ret
+
+00800f2c <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  800f2c:	55                   	push   %ebp
+  800f2d:	89 e5                	mov    %esp,%ebp
+  800f2f:	57                   	push   %edi
+  800f30:	56                   	push   %esi
+  800f31:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800f32:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f37:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f3a:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f3f:	89 cb                	mov    %ecx,%ebx
+  800f41:	89 cf                	mov    %ecx,%edi
+  800f43:	89 ce                	mov    %ecx,%esi
+  800f45:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  800f47:	5b                   	pop    %ebx
+  800f48:	5e                   	pop    %esi
+  800f49:	5f                   	pop    %edi
+  800f4a:	5d                   	pop    %ebp
+  800f4b:	c3                   	ret
+
+00800f4c <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  800f4c:	55                   	push   %ebp
+  800f4d:	89 e5                	mov    %esp,%ebp
+  800f4f:	57                   	push   %edi
+  800f50:	56                   	push   %esi
+  800f51:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800f52:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f57:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f5c:	89 d1                	mov    %edx,%ecx
+  800f5e:	89 d3                	mov    %edx,%ebx
+  800f60:	89 d7                	mov    %edx,%edi
+  800f62:	89 d6                	mov    %edx,%esi
+  800f64:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800f66:	5b                   	pop    %ebx
+  800f67:	5e                   	pop    %esi
+  800f68:	5f                   	pop    %edi
+  800f69:	5d                   	pop    %ebp
+  800f6a:	c3                   	ret
+
+00800f6b <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  800f6b:	55                   	push   %ebp
+  800f6c:	89 e5                	mov    %esp,%ebp
+  800f6e:	57                   	push   %edi
+  800f6f:	56                   	push   %esi
+  800f70:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800f71:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f76:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f79:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f7c:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f81:	89 df                	mov    %ebx,%edi
+  800f83:	89 de                	mov    %ebx,%esi
+  800f85:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800f87:	5b                   	pop    %ebx
+  800f88:	5e                   	pop    %esi
+  800f89:	5f                   	pop    %edi
+  800f8a:	5d                   	pop    %ebp
+  800f8b:	c3                   	ret
+
+00800f8c <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  800f8c:	55                   	push   %ebp
+  800f8d:	89 e5                	mov    %esp,%ebp
+  800f8f:	57                   	push   %edi
+  800f90:	56                   	push   %esi
+  800f91:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800f92:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f97:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f9a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f9d:	b8 12 00 00 00       	mov    $0x12,%eax
+  800fa2:	89 df                	mov    %ebx,%edi
+  800fa4:	89 de                	mov    %ebx,%esi
+  800fa6:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800fa8:	5b                   	pop    %ebx
+  800fa9:	5e                   	pop    %esi
+  800faa:	5f                   	pop    %edi
+  800fab:	5d                   	pop    %ebp
+  800fac:	c3                   	ret
+
+00800fad <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  800fad:	55                   	push   %ebp
+  800fae:	89 e5                	mov    %esp,%ebp
+  800fb0:	57                   	push   %edi
+  800fb1:	56                   	push   %esi
+  800fb2:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800fb3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fb8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fbb:	b8 13 00 00 00       	mov    $0x13,%eax
+  800fc0:	89 cb                	mov    %ecx,%ebx
+  800fc2:	89 cf                	mov    %ecx,%edi
+  800fc4:	89 ce                	mov    %ecx,%esi
+  800fc6:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  800fc8:	5b                   	pop    %ebx
+  800fc9:	5e                   	pop    %esi
+  800fca:	5f                   	pop    %edi
+  800fcb:	5d                   	pop    %ebp
+  800fcc:	c3                   	ret
+
+00800fcd <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  800fcd:	55                   	push   %ebp
+  800fce:	89 e5                	mov    %esp,%ebp
+  800fd0:	57                   	push   %edi
+  800fd1:	56                   	push   %esi
+  800fd2:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800fd3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fd8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fdb:	b8 14 00 00 00       	mov    $0x14,%eax
+  800fe0:	89 cb                	mov    %ecx,%ebx
+  800fe2:	89 cf                	mov    %ecx,%edi
+  800fe4:	89 ce                	mov    %ecx,%esi
+  800fe6:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  800fe8:	5b                   	pop    %ebx
+  800fe9:	5e                   	pop    %esi
+  800fea:	5f                   	pop    %edi
+  800feb:	5d                   	pop    %ebp
+  800fec:	c3                   	ret
+
+00800fed <pgfault>:
+//
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf) {
+  800fed:	55                   	push   %ebp
+  800fee:	89 e5                	mov    %esp,%ebp
+  800ff0:	53                   	push   %ebx
+  800ff1:	83 ec 04             	sub    $0x4,%esp
+  800ff4:	8b 45 08             	mov    0x8(%ebp),%eax
+    void *addr = (void *) utf->utf_fault_va;
+  800ff7:	8b 18                	mov    (%eax),%ebx
+    // Hint:
+    //   Use the read-only page table mappings at uvpt
+    //   (see <inc/memlayout.h>).
+
+    // LAB 4: Your code here.
+    if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P) ||
+  800ff9:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  800ffd:	0f 84 95 00 00 00    	je     801098 <pgfault+0xab>
+  801003:	89 d8                	mov    %ebx,%eax
+  801005:	c1 e8 16             	shr    $0x16,%eax
+  801008:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80100f:	a8 01                	test   $0x1,%al
+  801011:	0f 84 81 00 00 00    	je     801098 <pgfault+0xab>
+        (uvpt[PGNUM(addr)] & (PTE_P | PTE_COW)) != (PTE_P | PTE_COW)) {
+  801017:	89 d8                	mov    %ebx,%eax
+  801019:	c1 e8 0c             	shr    $0xc,%eax
+  80101c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801023:	25 01 08 00 00       	and    $0x801,%eax
+    if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P) ||
+  801028:	3d 01 08 00 00       	cmp    $0x801,%eax
+  80102d:	75 69                	jne    801098 <pgfault+0xab>
+    // Hint:
+    //   You should make three system calls.
+
+    // LAB 4: Your code here.
+
+    if (sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W))
+  80102f:	83 ec 04             	sub    $0x4,%esp
+  801032:	6a 07                	push   $0x7
+  801034:	68 00 f0 7f 00       	push   $0x7ff000
+  801039:	6a 00                	push   $0x0
+  80103b:	e8 da fc ff ff       	call   800d1a <sys_page_alloc>
+  801040:	83 c4 10             	add    $0x10,%esp
+  801043:	85 c0                	test   %eax,%eax
+  801045:	75 65                	jne    8010ac <pgfault+0xbf>
+        panic("sys_page_alloc failed");
+
+    addr = ROUNDDOWN(addr, PGSIZE);
+  801047:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+    memmove(PFTEMP, addr, PGSIZE);
+  80104d:	83 ec 04             	sub    $0x4,%esp
+  801050:	68 00 10 00 00       	push   $0x1000
+  801055:	53                   	push   %ebx
+  801056:	68 00 f0 7f 00       	push   $0x7ff000
+  80105b:	e8 54 fa ff ff       	call   800ab4 <memmove>
+
+    if (sys_page_map(0, PFTEMP, 0, addr, PTE_P | PTE_U | PTE_W))
+  801060:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801067:	53                   	push   %ebx
+  801068:	6a 00                	push   $0x0
+  80106a:	68 00 f0 7f 00       	push   $0x7ff000
+  80106f:	6a 00                	push   $0x0
+  801071:	e8 e7 fc ff ff       	call   800d5d <sys_page_map>
+  801076:	83 c4 20             	add    $0x20,%esp
+  801079:	85 c0                	test   %eax,%eax
+  80107b:	75 43                	jne    8010c0 <pgfault+0xd3>
+        panic("sys_page_map failed");
+    if (sys_page_unmap(0, PFTEMP))
+  80107d:	83 ec 08             	sub    $0x8,%esp
+  801080:	68 00 f0 7f 00       	push   $0x7ff000
+  801085:	6a 00                	push   $0x0
+  801087:	e8 13 fd ff ff       	call   800d9f <sys_page_unmap>
+  80108c:	83 c4 10             	add    $0x10,%esp
+  80108f:	85 c0                	test   %eax,%eax
+  801091:	75 41                	jne    8010d4 <pgfault+0xe7>
+        panic("sys_page_unmap failed");
+
+}
+  801093:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801096:	c9                   	leave
+  801097:	c3                   	ret
+        panic("pgfault: faulting access invalid");
+  801098:	83 ec 04             	sub    $0x4,%esp
+  80109b:	68 b0 2e 80 00       	push   $0x802eb0
+  8010a0:	6a 1e                	push   $0x1e
+  8010a2:	68 1c 2f 80 00       	push   $0x802f1c
+  8010a7:	e8 ee f1 ff ff       	call   80029a <_panic>
+        panic("sys_page_alloc failed");
+  8010ac:	83 ec 04             	sub    $0x4,%esp
+  8010af:	68 8f 2f 80 00       	push   $0x802f8f
+  8010b4:	6a 2a                	push   $0x2a
+  8010b6:	68 1c 2f 80 00       	push   $0x802f1c
+  8010bb:	e8 da f1 ff ff       	call   80029a <_panic>
+        panic("sys_page_map failed");
+  8010c0:	83 ec 04             	sub    $0x4,%esp
+  8010c3:	68 27 2f 80 00       	push   $0x802f27
+  8010c8:	6a 30                	push   $0x30
+  8010ca:	68 1c 2f 80 00       	push   $0x802f1c
+  8010cf:	e8 c6 f1 ff ff       	call   80029a <_panic>
+        panic("sys_page_unmap failed");
+  8010d4:	83 ec 04             	sub    $0x4,%esp
+  8010d7:	68 3b 2f 80 00       	push   $0x802f3b
+  8010dc:	6a 32                	push   $0x32
+  8010de:	68 1c 2f 80 00       	push   $0x802f1c
+  8010e3:	e8 b2 f1 ff ff       	call   80029a <_panic>
+
+008010e8 <fork>:
+//   Remember to fix "thisenv" in the child process.
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void) {
+  8010e8:	55                   	push   %ebp
+  8010e9:	89 e5                	mov    %esp,%ebp
+  8010eb:	57                   	push   %edi
+  8010ec:	56                   	push   %esi
+  8010ed:	53                   	push   %ebx
+  8010ee:	83 ec 18             	sub    $0x18,%esp
+    // LAB 4: Your code here.
+    set_pgfault_handler(pgfault);
+  8010f1:	68 ed 0f 80 00       	push   $0x800fed
+  8010f6:	e8 1a 13 00 00       	call   802415 <set_pgfault_handler>
+
+// This must be inlined.  Exercise for reader: why?
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+  envid_t ret;
+  asm volatile("int %2"
+  8010fb:	b8 07 00 00 00       	mov    $0x7,%eax
+  801100:	cd 30                	int    $0x30
+  801102:	89 c6                	mov    %eax,%esi
+
+    envid_t envid = sys_exofork();
+    if (envid < 0)
+  801104:	83 c4 10             	add    $0x10,%esp
+  801107:	85 c0                	test   %eax,%eax
+  801109:	78 2a                	js     801135 <fork+0x4d>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+
+    uintptr_t addr;
+    for (addr = 0; addr < UTOP; addr += PGSIZE) {
+  80110b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (envid == 0) {
+  801110:	0f 85 a2 00 00 00    	jne    8011b8 <fork+0xd0>
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801116:	e8 c1 fb ff ff       	call   800cdc <sys_getenvid>
+  80111b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801120:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  801123:	c1 e0 04             	shl    $0x4,%eax
+  801126:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80112b:	a3 08 50 80 00       	mov    %eax,0x805008
+        return 0;
+  801130:	e9 6c 01 00 00       	jmp    8012a1 <fork+0x1b9>
+        panic("fork: sys_exofork error: %e", envid);
+  801135:	50                   	push   %eax
+  801136:	68 51 2f 80 00       	push   $0x802f51
+  80113b:	6a 6f                	push   $0x6f
+  80113d:	68 1c 2f 80 00       	push   $0x802f1c
+  801142:	e8 53 f1 ff ff       	call   80029a <_panic>
+        if ((r = sys_page_map(0, vptr, envid, vptr, uvpt[pn] & PTE_SYSCALL)) < 0)
+  801147:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80114e:	83 ec 0c             	sub    $0xc,%esp
+  801151:	25 07 0e 00 00       	and    $0xe07,%eax
+  801156:	50                   	push   %eax
+  801157:	57                   	push   %edi
+  801158:	56                   	push   %esi
+  801159:	57                   	push   %edi
+  80115a:	6a 00                	push   $0x0
+  80115c:	e8 fc fb ff ff       	call   800d5d <sys_page_map>
+  801161:	83 c4 20             	add    $0x20,%esp
+  801164:	85 c0                	test   %eax,%eax
+  801166:	79 3e                	jns    8011a6 <fork+0xbe>
+            panic("duppage :in sys_page_map %e", r);
+  801168:	50                   	push   %eax
+  801169:	68 6d 2f 80 00       	push   $0x802f6d
+  80116e:	6a 49                	push   $0x49
+  801170:	68 1c 2f 80 00       	push   $0x802f1c
+  801175:	e8 20 f1 ff ff       	call   80029a <_panic>
+            panic("duppage :in sys_page_map %e", r);
+  80117a:	50                   	push   %eax
+  80117b:	68 6d 2f 80 00       	push   $0x802f6d
+  801180:	6a 4e                	push   $0x4e
+  801182:	68 1c 2f 80 00       	push   $0x802f1c
+  801187:	e8 0e f1 ff ff       	call   80029a <_panic>
+    } else if ((r = sys_page_map(0, vptr, envid, vptr, PTE_P | PTE_U)) < 0)
+  80118c:	83 ec 0c             	sub    $0xc,%esp
+  80118f:	6a 05                	push   $0x5
+  801191:	57                   	push   %edi
+  801192:	56                   	push   %esi
+  801193:	57                   	push   %edi
+  801194:	6a 00                	push   $0x0
+  801196:	e8 c2 fb ff ff       	call   800d5d <sys_page_map>
+  80119b:	83 c4 20             	add    $0x20,%esp
+  80119e:	85 c0                	test   %eax,%eax
+  8011a0:	0f 88 ab 00 00 00    	js     801251 <fork+0x169>
+    for (addr = 0; addr < UTOP; addr += PGSIZE) {
+  8011a6:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8011ac:	81 fb 00 00 c0 ee    	cmp    $0xeec00000,%ebx
+  8011b2:	0f 84 ab 00 00 00    	je     801263 <fork+0x17b>
+        if (uvpd[PDX(addr)] & PTE_P && uvpt[PGNUM(addr)] & PTE_P && addr != UXSTACKTOP - PGSIZE) {
+  8011b8:	89 d8                	mov    %ebx,%eax
+  8011ba:	c1 e8 16             	shr    $0x16,%eax
+  8011bd:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8011c4:	a8 01                	test   $0x1,%al
+  8011c6:	74 de                	je     8011a6 <fork+0xbe>
+  8011c8:	89 d8                	mov    %ebx,%eax
+  8011ca:	c1 e8 0c             	shr    $0xc,%eax
+  8011cd:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8011d4:	f6 c2 01             	test   $0x1,%dl
+  8011d7:	74 cd                	je     8011a6 <fork+0xbe>
+  8011d9:	81 fb 00 f0 bf ee    	cmp    $0xeebff000,%ebx
+  8011df:	74 c5                	je     8011a6 <fork+0xbe>
+    void *vptr = (void *) (pn * PGSIZE);
+  8011e1:	89 c7                	mov    %eax,%edi
+  8011e3:	c1 e7 0c             	shl    $0xc,%edi
+    if (uvpt[pn] & PTE_SHARE) {
+  8011e6:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8011ed:	f6 c6 04             	test   $0x4,%dh
+  8011f0:	0f 85 51 ff ff ff    	jne    801147 <fork+0x5f>
+    } else if (uvpt[pn] & (PTE_W | PTE_COW)) {
+  8011f6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8011fd:	a9 02 08 00 00       	test   $0x802,%eax
+  801202:	74 88                	je     80118c <fork+0xa4>
+        if ((r = sys_page_map(0, vptr, envid, vptr, PTE_P | PTE_U | PTE_COW)) < 0)
+  801204:	83 ec 0c             	sub    $0xc,%esp
+  801207:	68 05 08 00 00       	push   $0x805
+  80120c:	57                   	push   %edi
+  80120d:	56                   	push   %esi
+  80120e:	57                   	push   %edi
+  80120f:	6a 00                	push   $0x0
+  801211:	e8 47 fb ff ff       	call   800d5d <sys_page_map>
+  801216:	83 c4 20             	add    $0x20,%esp
+  801219:	85 c0                	test   %eax,%eax
+  80121b:	0f 88 59 ff ff ff    	js     80117a <fork+0x92>
+        if ((r = sys_page_map(0, vptr, 0, vptr, PTE_P | PTE_U | PTE_COW)) < 0)
+  801221:	83 ec 0c             	sub    $0xc,%esp
+  801224:	68 05 08 00 00       	push   $0x805
+  801229:	57                   	push   %edi
+  80122a:	6a 00                	push   $0x0
+  80122c:	57                   	push   %edi
+  80122d:	6a 00                	push   $0x0
+  80122f:	e8 29 fb ff ff       	call   800d5d <sys_page_map>
+  801234:	83 c4 20             	add    $0x20,%esp
+  801237:	85 c0                	test   %eax,%eax
+  801239:	0f 89 67 ff ff ff    	jns    8011a6 <fork+0xbe>
+            panic("duppage :in sys_page_map %e", r);
+  80123f:	50                   	push   %eax
+  801240:	68 6d 2f 80 00       	push   $0x802f6d
+  801245:	6a 50                	push   $0x50
+  801247:	68 1c 2f 80 00       	push   $0x802f1c
+  80124c:	e8 49 f0 ff ff       	call   80029a <_panic>
+        panic("duppage :in sys_page_map %e", r);
+  801251:	50                   	push   %eax
+  801252:	68 6d 2f 80 00       	push   $0x802f6d
+  801257:	6a 53                	push   $0x53
+  801259:	68 1c 2f 80 00       	push   $0x802f1c
+  80125e:	e8 37 f0 ff ff       	call   80029a <_panic>
+            duppage(envid, PGNUM(addr));
+        }
+    }
+    if (sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W))
+  801263:	83 ec 04             	sub    $0x4,%esp
+  801266:	6a 07                	push   $0x7
+  801268:	68 00 f0 bf ee       	push   $0xeebff000
+  80126d:	56                   	push   %esi
+  80126e:	e8 a7 fa ff ff       	call   800d1a <sys_page_alloc>
+  801273:	83 c4 10             	add    $0x10,%esp
+  801276:	85 c0                	test   %eax,%eax
+  801278:	75 31                	jne    8012ab <fork+0x1c3>
+        panic("fork: sys_page_alloc failed");
+    if (sys_env_set_pgfault_upcall(envid, _pgfault_upcall))
+  80127a:	83 ec 08             	sub    $0x8,%esp
+  80127d:	68 80 24 80 00       	push   $0x802480
+  801282:	56                   	push   %esi
+  801283:	e8 dd fb ff ff       	call   800e65 <sys_env_set_pgfault_upcall>
+  801288:	83 c4 10             	add    $0x10,%esp
+  80128b:	85 c0                	test   %eax,%eax
+  80128d:	75 30                	jne    8012bf <fork+0x1d7>
+        panic("fork: sys_env_set_pgfault_upcall failed");
+    if (sys_env_set_status(envid, ENV_RUNNABLE))
+  80128f:	83 ec 08             	sub    $0x8,%esp
+  801292:	6a 02                	push   $0x2
+  801294:	56                   	push   %esi
+  801295:	e8 47 fb ff ff       	call   800de1 <sys_env_set_status>
+  80129a:	83 c4 10             	add    $0x10,%esp
+  80129d:	85 c0                	test   %eax,%eax
+  80129f:	75 32                	jne    8012d3 <fork+0x1eb>
+        panic("fork: sys_env_set_status failed");
+
+    return envid;
+
+}
+  8012a1:	89 f0                	mov    %esi,%eax
+  8012a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012a6:	5b                   	pop    %ebx
+  8012a7:	5e                   	pop    %esi
+  8012a8:	5f                   	pop    %edi
+  8012a9:	5d                   	pop    %ebp
+  8012aa:	c3                   	ret
+        panic("fork: sys_page_alloc failed");
+  8012ab:	83 ec 04             	sub    $0x4,%esp
+  8012ae:	68 89 2f 80 00       	push   $0x802f89
+  8012b3:	6a 7d                	push   $0x7d
+  8012b5:	68 1c 2f 80 00       	push   $0x802f1c
+  8012ba:	e8 db ef ff ff       	call   80029a <_panic>
+        panic("fork: sys_env_set_pgfault_upcall failed");
+  8012bf:	83 ec 04             	sub    $0x4,%esp
+  8012c2:	68 d4 2e 80 00       	push   $0x802ed4
+  8012c7:	6a 7f                	push   $0x7f
+  8012c9:	68 1c 2f 80 00       	push   $0x802f1c
+  8012ce:	e8 c7 ef ff ff       	call   80029a <_panic>
+        panic("fork: sys_env_set_status failed");
+  8012d3:	83 ec 04             	sub    $0x4,%esp
+  8012d6:	68 fc 2e 80 00       	push   $0x802efc
+  8012db:	68 81 00 00 00       	push   $0x81
+  8012e0:	68 1c 2f 80 00       	push   $0x802f1c
+  8012e5:	e8 b0 ef ff ff       	call   80029a <_panic>
+
+008012ea <sfork>:
+
+// Challenge!
+int
+sfork(void) {
+  8012ea:	55                   	push   %ebp
+  8012eb:	89 e5                	mov    %esp,%ebp
+  8012ed:	83 ec 0c             	sub    $0xc,%esp
+    panic("sfork not implemented");
+  8012f0:	68 a5 2f 80 00       	push   $0x802fa5
+  8012f5:	68 8a 00 00 00       	push   $0x8a
+  8012fa:	68 1c 2f 80 00       	push   $0x802f1c
+  8012ff:	e8 96 ef ff ff       	call   80029a <_panic>
+
+00801304 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801304:	55                   	push   %ebp
+  801305:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801307:	8b 45 08             	mov    0x8(%ebp),%eax
+  80130a:	05 00 00 00 30       	add    $0x30000000,%eax
+  80130f:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801312:	5d                   	pop    %ebp
+  801313:	c3                   	ret
+
+00801314 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801314:	55                   	push   %ebp
+  801315:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801317:	8b 45 08             	mov    0x8(%ebp),%eax
+  80131a:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80131f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801324:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801329:	5d                   	pop    %ebp
+  80132a:	c3                   	ret
+
+0080132b <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80132b:	55                   	push   %ebp
+  80132c:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80132e:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801333:	eb 02                	jmp    801337 <fd_alloc+0xc>
+  801335:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801337:	89 c2                	mov    %eax,%edx
+  801339:	c1 ea 16             	shr    $0x16,%edx
+  80133c:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801343:	f6 c2 01             	test   $0x1,%dl
+  801346:	74 2b                	je     801373 <fd_alloc+0x48>
+  801348:	89 c2                	mov    %eax,%edx
+  80134a:	c1 ea 0c             	shr    $0xc,%edx
+  80134d:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801354:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80135a:	f6 c1 01             	test   $0x1,%cl
+  80135d:	74 14                	je     801373 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80135f:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801365:	75 ce                	jne    801335 <fd_alloc+0xa>
+  801367:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80136c:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801371:	eb 05                	jmp    801378 <fd_alloc+0x4d>
+			return 0;
+  801373:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801378:	8b 55 08             	mov    0x8(%ebp),%edx
+  80137b:	89 02                	mov    %eax,(%edx)
+}
+  80137d:	89 c8                	mov    %ecx,%eax
+  80137f:	5d                   	pop    %ebp
+  801380:	c3                   	ret
+
+00801381 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801381:	55                   	push   %ebp
+  801382:	89 e5                	mov    %esp,%ebp
+  801384:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801387:	83 f8 1f             	cmp    $0x1f,%eax
+  80138a:	77 30                	ja     8013bc <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80138c:	c1 e0 0c             	shl    $0xc,%eax
+  80138f:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801394:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80139a:	f6 c2 01             	test   $0x1,%dl
+  80139d:	74 24                	je     8013c3 <fd_lookup+0x42>
+  80139f:	89 c2                	mov    %eax,%edx
+  8013a1:	c1 ea 0c             	shr    $0xc,%edx
+  8013a4:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8013ab:	f6 c2 01             	test   $0x1,%dl
+  8013ae:	74 1a                	je     8013ca <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8013b0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8013b3:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8013b5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013ba:	5d                   	pop    %ebp
+  8013bb:	c3                   	ret
+		return -E_INVAL;
+  8013bc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013c1:	eb f7                	jmp    8013ba <fd_lookup+0x39>
+		return -E_INVAL;
+  8013c3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013c8:	eb f0                	jmp    8013ba <fd_lookup+0x39>
+  8013ca:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013cf:	eb e9                	jmp    8013ba <fd_lookup+0x39>
+
+008013d1 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8013d1:	55                   	push   %ebp
+  8013d2:	89 e5                	mov    %esp,%ebp
+  8013d4:	53                   	push   %ebx
+  8013d5:	83 ec 04             	sub    $0x4,%esp
+  8013d8:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8013db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013e0:	eb 03                	jmp    8013e5 <dev_lookup+0x14>
+  8013e2:	83 c0 01             	add    $0x1,%eax
+  8013e5:	8b 1c 85 38 30 80 00 	mov    0x803038(,%eax,4),%ebx
+  8013ec:	85 db                	test   %ebx,%ebx
+  8013ee:	74 0b                	je     8013fb <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8013f0:	39 13                	cmp    %edx,(%ebx)
+  8013f2:	75 ee                	jne    8013e2 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8013f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013f9:	eb 1f                	jmp    80141a <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8013fb:	a1 08 50 80 00       	mov    0x805008,%eax
+  801400:	8b 40 48             	mov    0x48(%eax),%eax
+  801403:	83 ec 04             	sub    $0x4,%esp
+  801406:	52                   	push   %edx
+  801407:	50                   	push   %eax
+  801408:	68 bc 2f 80 00       	push   $0x802fbc
+  80140d:	e8 63 ef ff ff       	call   800375 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801412:	83 c4 10             	add    $0x10,%esp
+  801415:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80141a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80141d:	89 1a                	mov    %ebx,(%edx)
+}
+  80141f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801422:	c9                   	leave
+  801423:	c3                   	ret
+
+00801424 <fd_close>:
+{
+  801424:	55                   	push   %ebp
+  801425:	89 e5                	mov    %esp,%ebp
+  801427:	57                   	push   %edi
+  801428:	56                   	push   %esi
+  801429:	53                   	push   %ebx
+  80142a:	83 ec 24             	sub    $0x24,%esp
+  80142d:	8b 75 08             	mov    0x8(%ebp),%esi
+  801430:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801433:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801436:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801437:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80143d:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801440:	50                   	push   %eax
+  801441:	e8 3b ff ff ff       	call   801381 <fd_lookup>
+  801446:	89 c3                	mov    %eax,%ebx
+  801448:	83 c4 10             	add    $0x10,%esp
+  80144b:	85 c0                	test   %eax,%eax
+  80144d:	78 05                	js     801454 <fd_close+0x30>
+	    || fd != fd2)
+  80144f:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801452:	74 16                	je     80146a <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801454:	89 f8                	mov    %edi,%eax
+  801456:	84 c0                	test   %al,%al
+  801458:	b8 00 00 00 00       	mov    $0x0,%eax
+  80145d:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801460:	89 d8                	mov    %ebx,%eax
+  801462:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801465:	5b                   	pop    %ebx
+  801466:	5e                   	pop    %esi
+  801467:	5f                   	pop    %edi
+  801468:	5d                   	pop    %ebp
+  801469:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80146a:	83 ec 08             	sub    $0x8,%esp
+  80146d:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801470:	50                   	push   %eax
+  801471:	ff 36                	push   (%esi)
+  801473:	e8 59 ff ff ff       	call   8013d1 <dev_lookup>
+  801478:	89 c3                	mov    %eax,%ebx
+  80147a:	83 c4 10             	add    $0x10,%esp
+  80147d:	85 c0                	test   %eax,%eax
+  80147f:	78 1a                	js     80149b <fd_close+0x77>
+		if (dev->dev_close)
+  801481:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801484:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801487:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80148c:	85 c0                	test   %eax,%eax
+  80148e:	74 0b                	je     80149b <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801490:	83 ec 0c             	sub    $0xc,%esp
+  801493:	56                   	push   %esi
+  801494:	ff d0                	call   *%eax
+  801496:	89 c3                	mov    %eax,%ebx
+  801498:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80149b:	83 ec 08             	sub    $0x8,%esp
+  80149e:	56                   	push   %esi
+  80149f:	6a 00                	push   $0x0
+  8014a1:	e8 f9 f8 ff ff       	call   800d9f <sys_page_unmap>
+	return r;
+  8014a6:	83 c4 10             	add    $0x10,%esp
+  8014a9:	eb b5                	jmp    801460 <fd_close+0x3c>
+
+008014ab <close>:
+
+int
+close(int fdnum)
+{
+  8014ab:	55                   	push   %ebp
+  8014ac:	89 e5                	mov    %esp,%ebp
+  8014ae:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8014b1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014b4:	50                   	push   %eax
+  8014b5:	ff 75 08             	push   0x8(%ebp)
+  8014b8:	e8 c4 fe ff ff       	call   801381 <fd_lookup>
+  8014bd:	83 c4 10             	add    $0x10,%esp
+  8014c0:	85 c0                	test   %eax,%eax
+  8014c2:	79 02                	jns    8014c6 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8014c4:	c9                   	leave
+  8014c5:	c3                   	ret
+		return fd_close(fd, 1);
+  8014c6:	83 ec 08             	sub    $0x8,%esp
+  8014c9:	6a 01                	push   $0x1
+  8014cb:	ff 75 f4             	push   -0xc(%ebp)
+  8014ce:	e8 51 ff ff ff       	call   801424 <fd_close>
+  8014d3:	83 c4 10             	add    $0x10,%esp
+  8014d6:	eb ec                	jmp    8014c4 <close+0x19>
+
+008014d8 <close_all>:
+
+void
+close_all(void)
+{
+  8014d8:	55                   	push   %ebp
+  8014d9:	89 e5                	mov    %esp,%ebp
+  8014db:	53                   	push   %ebx
+  8014dc:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8014df:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8014e4:	83 ec 0c             	sub    $0xc,%esp
+  8014e7:	53                   	push   %ebx
+  8014e8:	e8 be ff ff ff       	call   8014ab <close>
+	for (i = 0; i < MAXFD; i++)
+  8014ed:	83 c3 01             	add    $0x1,%ebx
+  8014f0:	83 c4 10             	add    $0x10,%esp
+  8014f3:	83 fb 20             	cmp    $0x20,%ebx
+  8014f6:	75 ec                	jne    8014e4 <close_all+0xc>
+}
+  8014f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014fb:	c9                   	leave
+  8014fc:	c3                   	ret
+
+008014fd <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8014fd:	55                   	push   %ebp
+  8014fe:	89 e5                	mov    %esp,%ebp
+  801500:	57                   	push   %edi
+  801501:	56                   	push   %esi
+  801502:	53                   	push   %ebx
+  801503:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801506:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801509:	50                   	push   %eax
+  80150a:	ff 75 08             	push   0x8(%ebp)
+  80150d:	e8 6f fe ff ff       	call   801381 <fd_lookup>
+  801512:	89 c3                	mov    %eax,%ebx
+  801514:	83 c4 10             	add    $0x10,%esp
+  801517:	85 c0                	test   %eax,%eax
+  801519:	78 7f                	js     80159a <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80151b:	83 ec 0c             	sub    $0xc,%esp
+  80151e:	ff 75 0c             	push   0xc(%ebp)
+  801521:	e8 85 ff ff ff       	call   8014ab <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801526:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801529:	c1 e6 0c             	shl    $0xc,%esi
+  80152c:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801532:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801535:	89 3c 24             	mov    %edi,(%esp)
+  801538:	e8 d7 fd ff ff       	call   801314 <fd2data>
+  80153d:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80153f:	89 34 24             	mov    %esi,(%esp)
+  801542:	e8 cd fd ff ff       	call   801314 <fd2data>
+  801547:	83 c4 10             	add    $0x10,%esp
+  80154a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80154d:	89 d8                	mov    %ebx,%eax
+  80154f:	c1 e8 16             	shr    $0x16,%eax
+  801552:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801559:	a8 01                	test   $0x1,%al
+  80155b:	74 11                	je     80156e <dup+0x71>
+  80155d:	89 d8                	mov    %ebx,%eax
+  80155f:	c1 e8 0c             	shr    $0xc,%eax
+  801562:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801569:	f6 c2 01             	test   $0x1,%dl
+  80156c:	75 36                	jne    8015a4 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80156e:	89 f8                	mov    %edi,%eax
+  801570:	c1 e8 0c             	shr    $0xc,%eax
+  801573:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80157a:	83 ec 0c             	sub    $0xc,%esp
+  80157d:	25 07 0e 00 00       	and    $0xe07,%eax
+  801582:	50                   	push   %eax
+  801583:	56                   	push   %esi
+  801584:	6a 00                	push   $0x0
+  801586:	57                   	push   %edi
+  801587:	6a 00                	push   $0x0
+  801589:	e8 cf f7 ff ff       	call   800d5d <sys_page_map>
+  80158e:	89 c3                	mov    %eax,%ebx
+  801590:	83 c4 20             	add    $0x20,%esp
+  801593:	85 c0                	test   %eax,%eax
+  801595:	78 33                	js     8015ca <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801597:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80159a:	89 d8                	mov    %ebx,%eax
+  80159c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80159f:	5b                   	pop    %ebx
+  8015a0:	5e                   	pop    %esi
+  8015a1:	5f                   	pop    %edi
+  8015a2:	5d                   	pop    %ebp
+  8015a3:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8015a4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8015ab:	83 ec 0c             	sub    $0xc,%esp
+  8015ae:	25 07 0e 00 00       	and    $0xe07,%eax
+  8015b3:	50                   	push   %eax
+  8015b4:	ff 75 d4             	push   -0x2c(%ebp)
+  8015b7:	6a 00                	push   $0x0
+  8015b9:	53                   	push   %ebx
+  8015ba:	6a 00                	push   $0x0
+  8015bc:	e8 9c f7 ff ff       	call   800d5d <sys_page_map>
+  8015c1:	89 c3                	mov    %eax,%ebx
+  8015c3:	83 c4 20             	add    $0x20,%esp
+  8015c6:	85 c0                	test   %eax,%eax
+  8015c8:	79 a4                	jns    80156e <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8015ca:	83 ec 08             	sub    $0x8,%esp
+  8015cd:	56                   	push   %esi
+  8015ce:	6a 00                	push   $0x0
+  8015d0:	e8 ca f7 ff ff       	call   800d9f <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8015d5:	83 c4 08             	add    $0x8,%esp
+  8015d8:	ff 75 d4             	push   -0x2c(%ebp)
+  8015db:	6a 00                	push   $0x0
+  8015dd:	e8 bd f7 ff ff       	call   800d9f <sys_page_unmap>
+	return r;
+  8015e2:	83 c4 10             	add    $0x10,%esp
+  8015e5:	eb b3                	jmp    80159a <dup+0x9d>
+
+008015e7 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8015e7:	55                   	push   %ebp
+  8015e8:	89 e5                	mov    %esp,%ebp
+  8015ea:	56                   	push   %esi
+  8015eb:	53                   	push   %ebx
+  8015ec:	83 ec 18             	sub    $0x18,%esp
+  8015ef:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015f2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8015f5:	50                   	push   %eax
+  8015f6:	56                   	push   %esi
+  8015f7:	e8 85 fd ff ff       	call   801381 <fd_lookup>
+  8015fc:	83 c4 10             	add    $0x10,%esp
+  8015ff:	85 c0                	test   %eax,%eax
+  801601:	78 3c                	js     80163f <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801603:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801606:	83 ec 08             	sub    $0x8,%esp
+  801609:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80160c:	50                   	push   %eax
+  80160d:	ff 33                	push   (%ebx)
+  80160f:	e8 bd fd ff ff       	call   8013d1 <dev_lookup>
+  801614:	83 c4 10             	add    $0x10,%esp
+  801617:	85 c0                	test   %eax,%eax
+  801619:	78 24                	js     80163f <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80161b:	8b 43 08             	mov    0x8(%ebx),%eax
+  80161e:	83 e0 03             	and    $0x3,%eax
+  801621:	83 f8 01             	cmp    $0x1,%eax
+  801624:	74 20                	je     801646 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801626:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801629:	8b 40 08             	mov    0x8(%eax),%eax
+  80162c:	85 c0                	test   %eax,%eax
+  80162e:	74 37                	je     801667 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801630:	83 ec 04             	sub    $0x4,%esp
+  801633:	ff 75 10             	push   0x10(%ebp)
+  801636:	ff 75 0c             	push   0xc(%ebp)
+  801639:	53                   	push   %ebx
+  80163a:	ff d0                	call   *%eax
+  80163c:	83 c4 10             	add    $0x10,%esp
+}
+  80163f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801642:	5b                   	pop    %ebx
+  801643:	5e                   	pop    %esi
+  801644:	5d                   	pop    %ebp
+  801645:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801646:	a1 08 50 80 00       	mov    0x805008,%eax
+  80164b:	8b 40 48             	mov    0x48(%eax),%eax
+  80164e:	83 ec 04             	sub    $0x4,%esp
+  801651:	56                   	push   %esi
+  801652:	50                   	push   %eax
+  801653:	68 fd 2f 80 00       	push   $0x802ffd
+  801658:	e8 18 ed ff ff       	call   800375 <cprintf>
+		return -E_INVAL;
+  80165d:	83 c4 10             	add    $0x10,%esp
+  801660:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801665:	eb d8                	jmp    80163f <read+0x58>
+		return -E_NOT_SUPP;
+  801667:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80166c:	eb d1                	jmp    80163f <read+0x58>
+
+0080166e <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80166e:	55                   	push   %ebp
+  80166f:	89 e5                	mov    %esp,%ebp
+  801671:	57                   	push   %edi
+  801672:	56                   	push   %esi
+  801673:	53                   	push   %ebx
+  801674:	83 ec 0c             	sub    $0xc,%esp
+  801677:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80167a:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80167d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801682:	eb 02                	jmp    801686 <readn+0x18>
+  801684:	01 c3                	add    %eax,%ebx
+  801686:	39 f3                	cmp    %esi,%ebx
+  801688:	73 21                	jae    8016ab <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80168a:	83 ec 04             	sub    $0x4,%esp
+  80168d:	89 f0                	mov    %esi,%eax
+  80168f:	29 d8                	sub    %ebx,%eax
+  801691:	50                   	push   %eax
+  801692:	89 d8                	mov    %ebx,%eax
+  801694:	03 45 0c             	add    0xc(%ebp),%eax
+  801697:	50                   	push   %eax
+  801698:	57                   	push   %edi
+  801699:	e8 49 ff ff ff       	call   8015e7 <read>
+		if (m < 0)
+  80169e:	83 c4 10             	add    $0x10,%esp
+  8016a1:	85 c0                	test   %eax,%eax
+  8016a3:	78 04                	js     8016a9 <readn+0x3b>
+			return m;
+		if (m == 0)
+  8016a5:	75 dd                	jne    801684 <readn+0x16>
+  8016a7:	eb 02                	jmp    8016ab <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8016a9:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8016ab:	89 d8                	mov    %ebx,%eax
+  8016ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016b0:	5b                   	pop    %ebx
+  8016b1:	5e                   	pop    %esi
+  8016b2:	5f                   	pop    %edi
+  8016b3:	5d                   	pop    %ebp
+  8016b4:	c3                   	ret
+
+008016b5 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8016b5:	55                   	push   %ebp
+  8016b6:	89 e5                	mov    %esp,%ebp
+  8016b8:	56                   	push   %esi
+  8016b9:	53                   	push   %ebx
+  8016ba:	83 ec 18             	sub    $0x18,%esp
+  8016bd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016c0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016c3:	50                   	push   %eax
+  8016c4:	53                   	push   %ebx
+  8016c5:	e8 b7 fc ff ff       	call   801381 <fd_lookup>
+  8016ca:	83 c4 10             	add    $0x10,%esp
+  8016cd:	85 c0                	test   %eax,%eax
+  8016cf:	78 37                	js     801708 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016d1:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8016d4:	83 ec 08             	sub    $0x8,%esp
+  8016d7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016da:	50                   	push   %eax
+  8016db:	ff 36                	push   (%esi)
+  8016dd:	e8 ef fc ff ff       	call   8013d1 <dev_lookup>
+  8016e2:	83 c4 10             	add    $0x10,%esp
+  8016e5:	85 c0                	test   %eax,%eax
+  8016e7:	78 1f                	js     801708 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8016e9:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8016ed:	74 20                	je     80170f <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8016ef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016f2:	8b 40 0c             	mov    0xc(%eax),%eax
+  8016f5:	85 c0                	test   %eax,%eax
+  8016f7:	74 37                	je     801730 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8016f9:	83 ec 04             	sub    $0x4,%esp
+  8016fc:	ff 75 10             	push   0x10(%ebp)
+  8016ff:	ff 75 0c             	push   0xc(%ebp)
+  801702:	56                   	push   %esi
+  801703:	ff d0                	call   *%eax
+  801705:	83 c4 10             	add    $0x10,%esp
+}
+  801708:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80170b:	5b                   	pop    %ebx
+  80170c:	5e                   	pop    %esi
+  80170d:	5d                   	pop    %ebp
+  80170e:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80170f:	a1 08 50 80 00       	mov    0x805008,%eax
+  801714:	8b 40 48             	mov    0x48(%eax),%eax
+  801717:	83 ec 04             	sub    $0x4,%esp
+  80171a:	53                   	push   %ebx
+  80171b:	50                   	push   %eax
+  80171c:	68 19 30 80 00       	push   $0x803019
+  801721:	e8 4f ec ff ff       	call   800375 <cprintf>
+		return -E_INVAL;
+  801726:	83 c4 10             	add    $0x10,%esp
+  801729:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80172e:	eb d8                	jmp    801708 <write+0x53>
+		return -E_NOT_SUPP;
+  801730:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801735:	eb d1                	jmp    801708 <write+0x53>
+
+00801737 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801737:	55                   	push   %ebp
+  801738:	89 e5                	mov    %esp,%ebp
+  80173a:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80173d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801740:	50                   	push   %eax
+  801741:	ff 75 08             	push   0x8(%ebp)
+  801744:	e8 38 fc ff ff       	call   801381 <fd_lookup>
+  801749:	83 c4 10             	add    $0x10,%esp
+  80174c:	85 c0                	test   %eax,%eax
+  80174e:	78 0e                	js     80175e <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801750:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801753:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801756:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801759:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80175e:	c9                   	leave
+  80175f:	c3                   	ret
+
+00801760 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801760:	55                   	push   %ebp
+  801761:	89 e5                	mov    %esp,%ebp
+  801763:	56                   	push   %esi
+  801764:	53                   	push   %ebx
+  801765:	83 ec 18             	sub    $0x18,%esp
+  801768:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80176b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80176e:	50                   	push   %eax
+  80176f:	53                   	push   %ebx
+  801770:	e8 0c fc ff ff       	call   801381 <fd_lookup>
+  801775:	83 c4 10             	add    $0x10,%esp
+  801778:	85 c0                	test   %eax,%eax
+  80177a:	78 34                	js     8017b0 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80177c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80177f:	83 ec 08             	sub    $0x8,%esp
+  801782:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801785:	50                   	push   %eax
+  801786:	ff 36                	push   (%esi)
+  801788:	e8 44 fc ff ff       	call   8013d1 <dev_lookup>
+  80178d:	83 c4 10             	add    $0x10,%esp
+  801790:	85 c0                	test   %eax,%eax
+  801792:	78 1c                	js     8017b0 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801794:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801798:	74 1d                	je     8017b7 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80179a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80179d:	8b 40 18             	mov    0x18(%eax),%eax
+  8017a0:	85 c0                	test   %eax,%eax
+  8017a2:	74 34                	je     8017d8 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8017a4:	83 ec 08             	sub    $0x8,%esp
+  8017a7:	ff 75 0c             	push   0xc(%ebp)
+  8017aa:	56                   	push   %esi
+  8017ab:	ff d0                	call   *%eax
+  8017ad:	83 c4 10             	add    $0x10,%esp
+}
+  8017b0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017b3:	5b                   	pop    %ebx
+  8017b4:	5e                   	pop    %esi
+  8017b5:	5d                   	pop    %ebp
+  8017b6:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8017b7:	a1 08 50 80 00       	mov    0x805008,%eax
+  8017bc:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8017bf:	83 ec 04             	sub    $0x4,%esp
+  8017c2:	53                   	push   %ebx
+  8017c3:	50                   	push   %eax
+  8017c4:	68 dc 2f 80 00       	push   $0x802fdc
+  8017c9:	e8 a7 eb ff ff       	call   800375 <cprintf>
+		return -E_INVAL;
+  8017ce:	83 c4 10             	add    $0x10,%esp
+  8017d1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017d6:	eb d8                	jmp    8017b0 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8017d8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017dd:	eb d1                	jmp    8017b0 <ftruncate+0x50>
+
+008017df <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8017df:	55                   	push   %ebp
+  8017e0:	89 e5                	mov    %esp,%ebp
+  8017e2:	56                   	push   %esi
+  8017e3:	53                   	push   %ebx
+  8017e4:	83 ec 18             	sub    $0x18,%esp
+  8017e7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017ea:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017ed:	50                   	push   %eax
+  8017ee:	ff 75 08             	push   0x8(%ebp)
+  8017f1:	e8 8b fb ff ff       	call   801381 <fd_lookup>
+  8017f6:	83 c4 10             	add    $0x10,%esp
+  8017f9:	85 c0                	test   %eax,%eax
+  8017fb:	78 49                	js     801846 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017fd:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801800:	83 ec 08             	sub    $0x8,%esp
+  801803:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801806:	50                   	push   %eax
+  801807:	ff 36                	push   (%esi)
+  801809:	e8 c3 fb ff ff       	call   8013d1 <dev_lookup>
+  80180e:	83 c4 10             	add    $0x10,%esp
+  801811:	85 c0                	test   %eax,%eax
+  801813:	78 31                	js     801846 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801815:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801818:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80181c:	74 2f                	je     80184d <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80181e:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801821:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801828:	00 00 00 
+	stat->st_isdir = 0;
+  80182b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801832:	00 00 00 
+	stat->st_dev = dev;
+  801835:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80183b:	83 ec 08             	sub    $0x8,%esp
+  80183e:	53                   	push   %ebx
+  80183f:	56                   	push   %esi
+  801840:	ff 50 14             	call   *0x14(%eax)
+  801843:	83 c4 10             	add    $0x10,%esp
+}
+  801846:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801849:	5b                   	pop    %ebx
+  80184a:	5e                   	pop    %esi
+  80184b:	5d                   	pop    %ebp
+  80184c:	c3                   	ret
+		return -E_NOT_SUPP;
+  80184d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801852:	eb f2                	jmp    801846 <fstat+0x67>
+
+00801854 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801854:	55                   	push   %ebp
+  801855:	89 e5                	mov    %esp,%ebp
+  801857:	56                   	push   %esi
+  801858:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801859:	83 ec 08             	sub    $0x8,%esp
+  80185c:	6a 00                	push   $0x0
+  80185e:	ff 75 08             	push   0x8(%ebp)
+  801861:	e8 e4 01 00 00       	call   801a4a <open>
+  801866:	89 c3                	mov    %eax,%ebx
+  801868:	83 c4 10             	add    $0x10,%esp
+  80186b:	85 c0                	test   %eax,%eax
+  80186d:	78 1b                	js     80188a <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80186f:	83 ec 08             	sub    $0x8,%esp
+  801872:	ff 75 0c             	push   0xc(%ebp)
+  801875:	50                   	push   %eax
+  801876:	e8 64 ff ff ff       	call   8017df <fstat>
+  80187b:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80187d:	89 1c 24             	mov    %ebx,(%esp)
+  801880:	e8 26 fc ff ff       	call   8014ab <close>
+	return r;
+  801885:	83 c4 10             	add    $0x10,%esp
+  801888:	89 f3                	mov    %esi,%ebx
+}
+  80188a:	89 d8                	mov    %ebx,%eax
+  80188c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80188f:	5b                   	pop    %ebx
+  801890:	5e                   	pop    %esi
+  801891:	5d                   	pop    %ebp
+  801892:	c3                   	ret
+
+00801893 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  801893:	55                   	push   %ebp
+  801894:	89 e5                	mov    %esp,%ebp
+  801896:	56                   	push   %esi
+  801897:	53                   	push   %ebx
+  801898:	89 c6                	mov    %eax,%esi
+  80189a:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  80189c:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  8018a3:	74 27                	je     8018cc <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8018a5:	6a 07                	push   $0x7
+  8018a7:	68 00 60 80 00       	push   $0x806000
+  8018ac:	56                   	push   %esi
+  8018ad:	ff 35 00 50 80 00    	push   0x805000
+  8018b3:	e8 60 0c 00 00       	call   802518 <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  8018b8:	83 c4 0c             	add    $0xc,%esp
+  8018bb:	6a 00                	push   $0x0
+  8018bd:	53                   	push   %ebx
+  8018be:	6a 00                	push   $0x0
+  8018c0:	e8 df 0b 00 00       	call   8024a4 <ipc_recv>
+}
+  8018c5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018c8:	5b                   	pop    %ebx
+  8018c9:	5e                   	pop    %esi
+  8018ca:	5d                   	pop    %ebp
+  8018cb:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  8018cc:	83 ec 0c             	sub    $0xc,%esp
+  8018cf:	6a 01                	push   $0x1
+  8018d1:	e8 96 0c 00 00       	call   80256c <ipc_find_env>
+  8018d6:	a3 00 50 80 00       	mov    %eax,0x805000
+  8018db:	83 c4 10             	add    $0x10,%esp
+  8018de:	eb c5                	jmp    8018a5 <fsipc+0x12>
+
+008018e0 <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8018e0:	55                   	push   %ebp
+  8018e1:	89 e5                	mov    %esp,%ebp
+  8018e3:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8018e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018e9:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018ec:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.set_size.req_size = newsize;
+  8018f1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8018f4:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  8018f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018fe:	b8 02 00 00 00       	mov    $0x2,%eax
+  801903:	e8 8b ff ff ff       	call   801893 <fsipc>
+}
+  801908:	c9                   	leave
+  801909:	c3                   	ret
+
+0080190a <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80190a:	55                   	push   %ebp
+  80190b:	89 e5                	mov    %esp,%ebp
+  80190d:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801910:	8b 45 08             	mov    0x8(%ebp),%eax
+  801913:	8b 40 0c             	mov    0xc(%eax),%eax
+  801916:	a3 00 60 80 00       	mov    %eax,0x806000
+  return fsipc(FSREQ_FLUSH, NULL);
+  80191b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801920:	b8 06 00 00 00       	mov    $0x6,%eax
+  801925:	e8 69 ff ff ff       	call   801893 <fsipc>
+}
+  80192a:	c9                   	leave
+  80192b:	c3                   	ret
+
+0080192c <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80192c:	55                   	push   %ebp
+  80192d:	89 e5                	mov    %esp,%ebp
+  80192f:	53                   	push   %ebx
+  801930:	83 ec 04             	sub    $0x4,%esp
+  801933:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801936:	8b 45 08             	mov    0x8(%ebp),%eax
+  801939:	8b 40 0c             	mov    0xc(%eax),%eax
+  80193c:	a3 00 60 80 00       	mov    %eax,0x806000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801941:	ba 00 00 00 00       	mov    $0x0,%edx
+  801946:	b8 05 00 00 00       	mov    $0x5,%eax
+  80194b:	e8 43 ff ff ff       	call   801893 <fsipc>
+  801950:	85 c0                	test   %eax,%eax
+  801952:	78 2c                	js     801980 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801954:	83 ec 08             	sub    $0x8,%esp
+  801957:	68 00 60 80 00       	push   $0x806000
+  80195c:	53                   	push   %ebx
+  80195d:	e8 cc ef ff ff       	call   80092e <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801962:	a1 80 60 80 00       	mov    0x806080,%eax
+  801967:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80196d:	a1 84 60 80 00       	mov    0x806084,%eax
+  801972:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801978:	83 c4 10             	add    $0x10,%esp
+  80197b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801980:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801983:	c9                   	leave
+  801984:	c3                   	ret
+
+00801985 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801985:	55                   	push   %ebp
+  801986:	89 e5                	mov    %esp,%ebp
+  801988:	83 ec 0c             	sub    $0xc,%esp
+  80198b:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80198e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801991:	8b 52 0c             	mov    0xc(%edx),%edx
+  801994:	89 15 00 60 80 00    	mov    %edx,0x806000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80199a:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  80199f:	39 d0                	cmp    %edx,%eax
+  8019a1:	0f 47 c2             	cmova  %edx,%eax
+  8019a4:	a3 04 60 80 00       	mov    %eax,0x806004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  8019a9:	50                   	push   %eax
+  8019aa:	ff 75 0c             	push   0xc(%ebp)
+  8019ad:	68 08 60 80 00       	push   $0x806008
+  8019b2:	e8 fd f0 ff ff       	call   800ab4 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  8019b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019bc:	b8 04 00 00 00       	mov    $0x4,%eax
+  8019c1:	e8 cd fe ff ff       	call   801893 <fsipc>
+}
+  8019c6:	c9                   	leave
+  8019c7:	c3                   	ret
+
+008019c8 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8019c8:	55                   	push   %ebp
+  8019c9:	89 e5                	mov    %esp,%ebp
+  8019cb:	56                   	push   %esi
+  8019cc:	53                   	push   %ebx
+  8019cd:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8019d0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019d3:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019d6:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read.req_n = n;
+  8019db:	89 35 04 60 80 00    	mov    %esi,0x806004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8019e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019e6:	b8 03 00 00 00       	mov    $0x3,%eax
+  8019eb:	e8 a3 fe ff ff       	call   801893 <fsipc>
+  8019f0:	89 c3                	mov    %eax,%ebx
+  8019f2:	85 c0                	test   %eax,%eax
+  8019f4:	78 1f                	js     801a15 <devfile_read+0x4d>
+  assert(r <= n);
+  8019f6:	39 c6                	cmp    %eax,%esi
+  8019f8:	72 24                	jb     801a1e <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  8019fa:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8019ff:	7f 33                	jg     801a34 <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801a01:	83 ec 04             	sub    $0x4,%esp
+  801a04:	50                   	push   %eax
+  801a05:	68 00 60 80 00       	push   $0x806000
+  801a0a:	ff 75 0c             	push   0xc(%ebp)
+  801a0d:	e8 a2 f0 ff ff       	call   800ab4 <memmove>
+  return r;
+  801a12:	83 c4 10             	add    $0x10,%esp
+}
+  801a15:	89 d8                	mov    %ebx,%eax
+  801a17:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a1a:	5b                   	pop    %ebx
+  801a1b:	5e                   	pop    %esi
+  801a1c:	5d                   	pop    %ebp
+  801a1d:	c3                   	ret
+  assert(r <= n);
+  801a1e:	68 4c 30 80 00       	push   $0x80304c
+  801a23:	68 53 30 80 00       	push   $0x803053
+  801a28:	6a 78                	push   $0x78
+  801a2a:	68 68 30 80 00       	push   $0x803068
+  801a2f:	e8 66 e8 ff ff       	call   80029a <_panic>
+  assert(r <= PGSIZE);
+  801a34:	68 73 30 80 00       	push   $0x803073
+  801a39:	68 53 30 80 00       	push   $0x803053
+  801a3e:	6a 79                	push   $0x79
+  801a40:	68 68 30 80 00       	push   $0x803068
+  801a45:	e8 50 e8 ff ff       	call   80029a <_panic>
+
+00801a4a <open>:
+open(const char *path, int mode) {
+  801a4a:	55                   	push   %ebp
+  801a4b:	89 e5                	mov    %esp,%ebp
+  801a4d:	56                   	push   %esi
+  801a4e:	53                   	push   %ebx
+  801a4f:	83 ec 1c             	sub    $0x1c,%esp
+  801a52:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801a55:	56                   	push   %esi
+  801a56:	e8 98 ee ff ff       	call   8008f3 <strlen>
+  801a5b:	83 c4 10             	add    $0x10,%esp
+  801a5e:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801a63:	7f 6c                	jg     801ad1 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801a65:	83 ec 0c             	sub    $0xc,%esp
+  801a68:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a6b:	50                   	push   %eax
+  801a6c:	e8 ba f8 ff ff       	call   80132b <fd_alloc>
+  801a71:	89 c3                	mov    %eax,%ebx
+  801a73:	83 c4 10             	add    $0x10,%esp
+  801a76:	85 c0                	test   %eax,%eax
+  801a78:	78 3c                	js     801ab6 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801a7a:	83 ec 08             	sub    $0x8,%esp
+  801a7d:	56                   	push   %esi
+  801a7e:	68 00 60 80 00       	push   $0x806000
+  801a83:	e8 a6 ee ff ff       	call   80092e <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801a88:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a8b:	a3 00 64 80 00       	mov    %eax,0x806400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801a90:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801a93:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a98:	e8 f6 fd ff ff       	call   801893 <fsipc>
+  801a9d:	89 c3                	mov    %eax,%ebx
+  801a9f:	83 c4 10             	add    $0x10,%esp
+  801aa2:	85 c0                	test   %eax,%eax
+  801aa4:	78 19                	js     801abf <open+0x75>
+  return fd2num(fd);
+  801aa6:	83 ec 0c             	sub    $0xc,%esp
+  801aa9:	ff 75 f4             	push   -0xc(%ebp)
+  801aac:	e8 53 f8 ff ff       	call   801304 <fd2num>
+  801ab1:	89 c3                	mov    %eax,%ebx
+  801ab3:	83 c4 10             	add    $0x10,%esp
+}
+  801ab6:	89 d8                	mov    %ebx,%eax
+  801ab8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801abb:	5b                   	pop    %ebx
+  801abc:	5e                   	pop    %esi
+  801abd:	5d                   	pop    %ebp
+  801abe:	c3                   	ret
+    fd_close(fd, 0);
+  801abf:	83 ec 08             	sub    $0x8,%esp
+  801ac2:	6a 00                	push   $0x0
+  801ac4:	ff 75 f4             	push   -0xc(%ebp)
+  801ac7:	e8 58 f9 ff ff       	call   801424 <fd_close>
+    return r;
+  801acc:	83 c4 10             	add    $0x10,%esp
+  801acf:	eb e5                	jmp    801ab6 <open+0x6c>
+    return -E_BAD_PATH;
+  801ad1:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801ad6:	eb de                	jmp    801ab6 <open+0x6c>
+
+00801ad8 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  801ad8:	55                   	push   %ebp
+  801ad9:	89 e5                	mov    %esp,%ebp
+  801adb:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801ade:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ae3:	b8 08 00 00 00       	mov    $0x8,%eax
+  801ae8:	e8 a6 fd ff ff       	call   801893 <fsipc>
+}
+  801aed:	c9                   	leave
+  801aee:	c3                   	ret
+
+00801aef <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801aef:	55                   	push   %ebp
+  801af0:	89 e5                	mov    %esp,%ebp
+  801af2:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801af5:	68 7f 30 80 00       	push   $0x80307f
+  801afa:	ff 75 0c             	push   0xc(%ebp)
+  801afd:	e8 2c ee ff ff       	call   80092e <strcpy>
+	return 0;
+}
+  801b02:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b07:	c9                   	leave
+  801b08:	c3                   	ret
+
+00801b09 <devsock_close>:
+{
+  801b09:	55                   	push   %ebp
+  801b0a:	89 e5                	mov    %esp,%ebp
+  801b0c:	53                   	push   %ebx
+  801b0d:	83 ec 10             	sub    $0x10,%esp
+  801b10:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801b13:	53                   	push   %ebx
+  801b14:	e8 92 0a 00 00       	call   8025ab <pageref>
+  801b19:	89 c2                	mov    %eax,%edx
+  801b1b:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801b1e:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801b23:	83 fa 01             	cmp    $0x1,%edx
+  801b26:	74 05                	je     801b2d <devsock_close+0x24>
+}
+  801b28:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b2b:	c9                   	leave
+  801b2c:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801b2d:	83 ec 0c             	sub    $0xc,%esp
+  801b30:	ff 73 0c             	push   0xc(%ebx)
+  801b33:	e8 b7 02 00 00       	call   801def <nsipc_close>
+  801b38:	83 c4 10             	add    $0x10,%esp
+  801b3b:	eb eb                	jmp    801b28 <devsock_close+0x1f>
+
+00801b3d <devsock_write>:
+{
+  801b3d:	55                   	push   %ebp
+  801b3e:	89 e5                	mov    %esp,%ebp
+  801b40:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801b43:	6a 00                	push   $0x0
+  801b45:	ff 75 10             	push   0x10(%ebp)
+  801b48:	ff 75 0c             	push   0xc(%ebp)
+  801b4b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b4e:	ff 70 0c             	push   0xc(%eax)
+  801b51:	e8 79 03 00 00       	call   801ecf <nsipc_send>
+}
+  801b56:	c9                   	leave
+  801b57:	c3                   	ret
+
+00801b58 <devsock_read>:
+{
+  801b58:	55                   	push   %ebp
+  801b59:	89 e5                	mov    %esp,%ebp
+  801b5b:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801b5e:	6a 00                	push   $0x0
+  801b60:	ff 75 10             	push   0x10(%ebp)
+  801b63:	ff 75 0c             	push   0xc(%ebp)
+  801b66:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b69:	ff 70 0c             	push   0xc(%eax)
+  801b6c:	e8 ef 02 00 00       	call   801e60 <nsipc_recv>
+}
+  801b71:	c9                   	leave
+  801b72:	c3                   	ret
+
+00801b73 <fd2sockid>:
+{
+  801b73:	55                   	push   %ebp
+  801b74:	89 e5                	mov    %esp,%ebp
+  801b76:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801b79:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801b7c:	52                   	push   %edx
+  801b7d:	50                   	push   %eax
+  801b7e:	e8 fe f7 ff ff       	call   801381 <fd_lookup>
+  801b83:	83 c4 10             	add    $0x10,%esp
+  801b86:	85 c0                	test   %eax,%eax
+  801b88:	78 10                	js     801b9a <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801b8a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b8d:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  801b93:	39 08                	cmp    %ecx,(%eax)
+  801b95:	75 05                	jne    801b9c <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801b97:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801b9a:	c9                   	leave
+  801b9b:	c3                   	ret
+		return -E_NOT_SUPP;
+  801b9c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ba1:	eb f7                	jmp    801b9a <fd2sockid+0x27>
+
+00801ba3 <alloc_sockfd>:
+{
+  801ba3:	55                   	push   %ebp
+  801ba4:	89 e5                	mov    %esp,%ebp
+  801ba6:	56                   	push   %esi
+  801ba7:	53                   	push   %ebx
+  801ba8:	83 ec 1c             	sub    $0x1c,%esp
+  801bab:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801bad:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bb0:	50                   	push   %eax
+  801bb1:	e8 75 f7 ff ff       	call   80132b <fd_alloc>
+  801bb6:	89 c3                	mov    %eax,%ebx
+  801bb8:	83 c4 10             	add    $0x10,%esp
+  801bbb:	85 c0                	test   %eax,%eax
+  801bbd:	78 43                	js     801c02 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801bbf:	83 ec 04             	sub    $0x4,%esp
+  801bc2:	68 07 04 00 00       	push   $0x407
+  801bc7:	ff 75 f4             	push   -0xc(%ebp)
+  801bca:	6a 00                	push   $0x0
+  801bcc:	e8 49 f1 ff ff       	call   800d1a <sys_page_alloc>
+  801bd1:	89 c3                	mov    %eax,%ebx
+  801bd3:	83 c4 10             	add    $0x10,%esp
+  801bd6:	85 c0                	test   %eax,%eax
+  801bd8:	78 28                	js     801c02 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801bda:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bdd:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801be3:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801be5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801be8:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801bef:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801bf2:	83 ec 0c             	sub    $0xc,%esp
+  801bf5:	50                   	push   %eax
+  801bf6:	e8 09 f7 ff ff       	call   801304 <fd2num>
+  801bfb:	89 c3                	mov    %eax,%ebx
+  801bfd:	83 c4 10             	add    $0x10,%esp
+  801c00:	eb 0c                	jmp    801c0e <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801c02:	83 ec 0c             	sub    $0xc,%esp
+  801c05:	56                   	push   %esi
+  801c06:	e8 e4 01 00 00       	call   801def <nsipc_close>
+		return r;
+  801c0b:	83 c4 10             	add    $0x10,%esp
+}
+  801c0e:	89 d8                	mov    %ebx,%eax
+  801c10:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c13:	5b                   	pop    %ebx
+  801c14:	5e                   	pop    %esi
+  801c15:	5d                   	pop    %ebp
+  801c16:	c3                   	ret
+
+00801c17 <accept>:
+{
+  801c17:	55                   	push   %ebp
+  801c18:	89 e5                	mov    %esp,%ebp
+  801c1a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801c1d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c20:	e8 4e ff ff ff       	call   801b73 <fd2sockid>
+  801c25:	85 c0                	test   %eax,%eax
+  801c27:	78 1b                	js     801c44 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801c29:	83 ec 04             	sub    $0x4,%esp
+  801c2c:	ff 75 10             	push   0x10(%ebp)
+  801c2f:	ff 75 0c             	push   0xc(%ebp)
+  801c32:	50                   	push   %eax
+  801c33:	e8 0e 01 00 00       	call   801d46 <nsipc_accept>
+  801c38:	83 c4 10             	add    $0x10,%esp
+  801c3b:	85 c0                	test   %eax,%eax
+  801c3d:	78 05                	js     801c44 <accept+0x2d>
+	return alloc_sockfd(r);
+  801c3f:	e8 5f ff ff ff       	call   801ba3 <alloc_sockfd>
+}
+  801c44:	c9                   	leave
+  801c45:	c3                   	ret
+
+00801c46 <bind>:
+{
+  801c46:	55                   	push   %ebp
+  801c47:	89 e5                	mov    %esp,%ebp
+  801c49:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801c4c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c4f:	e8 1f ff ff ff       	call   801b73 <fd2sockid>
+  801c54:	85 c0                	test   %eax,%eax
+  801c56:	78 12                	js     801c6a <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801c58:	83 ec 04             	sub    $0x4,%esp
+  801c5b:	ff 75 10             	push   0x10(%ebp)
+  801c5e:	ff 75 0c             	push   0xc(%ebp)
+  801c61:	50                   	push   %eax
+  801c62:	e8 31 01 00 00       	call   801d98 <nsipc_bind>
+  801c67:	83 c4 10             	add    $0x10,%esp
+}
+  801c6a:	c9                   	leave
+  801c6b:	c3                   	ret
+
+00801c6c <shutdown>:
+{
+  801c6c:	55                   	push   %ebp
+  801c6d:	89 e5                	mov    %esp,%ebp
+  801c6f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801c72:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c75:	e8 f9 fe ff ff       	call   801b73 <fd2sockid>
+  801c7a:	85 c0                	test   %eax,%eax
+  801c7c:	78 0f                	js     801c8d <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801c7e:	83 ec 08             	sub    $0x8,%esp
+  801c81:	ff 75 0c             	push   0xc(%ebp)
+  801c84:	50                   	push   %eax
+  801c85:	e8 43 01 00 00       	call   801dcd <nsipc_shutdown>
+  801c8a:	83 c4 10             	add    $0x10,%esp
+}
+  801c8d:	c9                   	leave
+  801c8e:	c3                   	ret
+
+00801c8f <connect>:
+{
+  801c8f:	55                   	push   %ebp
+  801c90:	89 e5                	mov    %esp,%ebp
+  801c92:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801c95:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c98:	e8 d6 fe ff ff       	call   801b73 <fd2sockid>
+  801c9d:	85 c0                	test   %eax,%eax
+  801c9f:	78 12                	js     801cb3 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801ca1:	83 ec 04             	sub    $0x4,%esp
+  801ca4:	ff 75 10             	push   0x10(%ebp)
+  801ca7:	ff 75 0c             	push   0xc(%ebp)
+  801caa:	50                   	push   %eax
+  801cab:	e8 59 01 00 00       	call   801e09 <nsipc_connect>
+  801cb0:	83 c4 10             	add    $0x10,%esp
+}
+  801cb3:	c9                   	leave
+  801cb4:	c3                   	ret
+
+00801cb5 <listen>:
+{
+  801cb5:	55                   	push   %ebp
+  801cb6:	89 e5                	mov    %esp,%ebp
+  801cb8:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801cbb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cbe:	e8 b0 fe ff ff       	call   801b73 <fd2sockid>
+  801cc3:	85 c0                	test   %eax,%eax
+  801cc5:	78 0f                	js     801cd6 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801cc7:	83 ec 08             	sub    $0x8,%esp
+  801cca:	ff 75 0c             	push   0xc(%ebp)
+  801ccd:	50                   	push   %eax
+  801cce:	e8 6b 01 00 00       	call   801e3e <nsipc_listen>
+  801cd3:	83 c4 10             	add    $0x10,%esp
+}
+  801cd6:	c9                   	leave
+  801cd7:	c3                   	ret
+
+00801cd8 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801cd8:	55                   	push   %ebp
+  801cd9:	89 e5                	mov    %esp,%ebp
+  801cdb:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801cde:	ff 75 10             	push   0x10(%ebp)
+  801ce1:	ff 75 0c             	push   0xc(%ebp)
+  801ce4:	ff 75 08             	push   0x8(%ebp)
+  801ce7:	e8 41 02 00 00       	call   801f2d <nsipc_socket>
+  801cec:	83 c4 10             	add    $0x10,%esp
+  801cef:	85 c0                	test   %eax,%eax
+  801cf1:	78 05                	js     801cf8 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801cf3:	e8 ab fe ff ff       	call   801ba3 <alloc_sockfd>
+}
+  801cf8:	c9                   	leave
+  801cf9:	c3                   	ret
+
+00801cfa <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801cfa:	55                   	push   %ebp
+  801cfb:	89 e5                	mov    %esp,%ebp
+  801cfd:	53                   	push   %ebx
+  801cfe:	83 ec 04             	sub    $0x4,%esp
+  801d01:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801d03:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  801d0a:	74 26                	je     801d32 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801d0c:	6a 07                	push   $0x7
+  801d0e:	68 00 70 80 00       	push   $0x807000
+  801d13:	53                   	push   %ebx
+  801d14:	ff 35 04 50 80 00    	push   0x805004
+  801d1a:	e8 f9 07 00 00       	call   802518 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801d1f:	83 c4 0c             	add    $0xc,%esp
+  801d22:	6a 00                	push   $0x0
+  801d24:	6a 00                	push   $0x0
+  801d26:	6a 00                	push   $0x0
+  801d28:	e8 77 07 00 00       	call   8024a4 <ipc_recv>
+}
+  801d2d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d30:	c9                   	leave
+  801d31:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801d32:	83 ec 0c             	sub    $0xc,%esp
+  801d35:	6a 02                	push   $0x2
+  801d37:	e8 30 08 00 00       	call   80256c <ipc_find_env>
+  801d3c:	a3 04 50 80 00       	mov    %eax,0x805004
+  801d41:	83 c4 10             	add    $0x10,%esp
+  801d44:	eb c6                	jmp    801d0c <nsipc+0x12>
+
+00801d46 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801d46:	55                   	push   %ebp
+  801d47:	89 e5                	mov    %esp,%ebp
+  801d49:	56                   	push   %esi
+  801d4a:	53                   	push   %ebx
+  801d4b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801d4e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d51:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801d56:	8b 06                	mov    (%esi),%eax
+  801d58:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801d5d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d62:	e8 93 ff ff ff       	call   801cfa <nsipc>
+  801d67:	89 c3                	mov    %eax,%ebx
+  801d69:	85 c0                	test   %eax,%eax
+  801d6b:	79 09                	jns    801d76 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801d6d:	89 d8                	mov    %ebx,%eax
+  801d6f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d72:	5b                   	pop    %ebx
+  801d73:	5e                   	pop    %esi
+  801d74:	5d                   	pop    %ebp
+  801d75:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801d76:	83 ec 04             	sub    $0x4,%esp
+  801d79:	ff 35 10 70 80 00    	push   0x807010
+  801d7f:	68 00 70 80 00       	push   $0x807000
+  801d84:	ff 75 0c             	push   0xc(%ebp)
+  801d87:	e8 28 ed ff ff       	call   800ab4 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801d8c:	a1 10 70 80 00       	mov    0x807010,%eax
+  801d91:	89 06                	mov    %eax,(%esi)
+  801d93:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801d96:	eb d5                	jmp    801d6d <nsipc_accept+0x27>
+
+00801d98 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801d98:	55                   	push   %ebp
+  801d99:	89 e5                	mov    %esp,%ebp
+  801d9b:	53                   	push   %ebx
+  801d9c:	83 ec 08             	sub    $0x8,%esp
+  801d9f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801da2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801da5:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801daa:	53                   	push   %ebx
+  801dab:	ff 75 0c             	push   0xc(%ebp)
+  801dae:	68 04 70 80 00       	push   $0x807004
+  801db3:	e8 fc ec ff ff       	call   800ab4 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801db8:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  801dbe:	b8 02 00 00 00       	mov    $0x2,%eax
+  801dc3:	e8 32 ff ff ff       	call   801cfa <nsipc>
+}
+  801dc8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801dcb:	c9                   	leave
+  801dcc:	c3                   	ret
+
+00801dcd <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801dcd:	55                   	push   %ebp
+  801dce:	89 e5                	mov    %esp,%ebp
+  801dd0:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801dd3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dd6:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  801ddb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801dde:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  801de3:	b8 03 00 00 00       	mov    $0x3,%eax
+  801de8:	e8 0d ff ff ff       	call   801cfa <nsipc>
+}
+  801ded:	c9                   	leave
+  801dee:	c3                   	ret
+
+00801def <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801def:	55                   	push   %ebp
+  801df0:	89 e5                	mov    %esp,%ebp
+  801df2:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801df5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801df8:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  801dfd:	b8 04 00 00 00       	mov    $0x4,%eax
+  801e02:	e8 f3 fe ff ff       	call   801cfa <nsipc>
+}
+  801e07:	c9                   	leave
+  801e08:	c3                   	ret
+
+00801e09 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801e09:	55                   	push   %ebp
+  801e0a:	89 e5                	mov    %esp,%ebp
+  801e0c:	53                   	push   %ebx
+  801e0d:	83 ec 08             	sub    $0x8,%esp
+  801e10:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801e13:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e16:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801e1b:	53                   	push   %ebx
+  801e1c:	ff 75 0c             	push   0xc(%ebp)
+  801e1f:	68 04 70 80 00       	push   $0x807004
+  801e24:	e8 8b ec ff ff       	call   800ab4 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801e29:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  801e2f:	b8 05 00 00 00       	mov    $0x5,%eax
+  801e34:	e8 c1 fe ff ff       	call   801cfa <nsipc>
+}
+  801e39:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e3c:	c9                   	leave
+  801e3d:	c3                   	ret
+
+00801e3e <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801e3e:	55                   	push   %ebp
+  801e3f:	89 e5                	mov    %esp,%ebp
+  801e41:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801e44:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e47:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  801e4c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e4f:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  801e54:	b8 06 00 00 00       	mov    $0x6,%eax
+  801e59:	e8 9c fe ff ff       	call   801cfa <nsipc>
+}
+  801e5e:	c9                   	leave
+  801e5f:	c3                   	ret
+
+00801e60 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801e60:	55                   	push   %ebp
+  801e61:	89 e5                	mov    %esp,%ebp
+  801e63:	56                   	push   %esi
+  801e64:	53                   	push   %ebx
+  801e65:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801e68:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e6b:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  801e70:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  801e76:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e79:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801e7e:	b8 07 00 00 00       	mov    $0x7,%eax
+  801e83:	e8 72 fe ff ff       	call   801cfa <nsipc>
+  801e88:	89 c3                	mov    %eax,%ebx
+  801e8a:	85 c0                	test   %eax,%eax
+  801e8c:	78 22                	js     801eb0 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801e8e:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801e93:	39 c6                	cmp    %eax,%esi
+  801e95:	0f 4e c6             	cmovle %esi,%eax
+  801e98:	39 c3                	cmp    %eax,%ebx
+  801e9a:	7f 1d                	jg     801eb9 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801e9c:	83 ec 04             	sub    $0x4,%esp
+  801e9f:	53                   	push   %ebx
+  801ea0:	68 00 70 80 00       	push   $0x807000
+  801ea5:	ff 75 0c             	push   0xc(%ebp)
+  801ea8:	e8 07 ec ff ff       	call   800ab4 <memmove>
+  801ead:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801eb0:	89 d8                	mov    %ebx,%eax
+  801eb2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801eb5:	5b                   	pop    %ebx
+  801eb6:	5e                   	pop    %esi
+  801eb7:	5d                   	pop    %ebp
+  801eb8:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801eb9:	68 8b 30 80 00       	push   $0x80308b
+  801ebe:	68 53 30 80 00       	push   $0x803053
+  801ec3:	6a 62                	push   $0x62
+  801ec5:	68 a0 30 80 00       	push   $0x8030a0
+  801eca:	e8 cb e3 ff ff       	call   80029a <_panic>
+
+00801ecf <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801ecf:	55                   	push   %ebp
+  801ed0:	89 e5                	mov    %esp,%ebp
+  801ed2:	53                   	push   %ebx
+  801ed3:	83 ec 04             	sub    $0x4,%esp
+  801ed6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801ed9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801edc:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  801ee1:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801ee7:	7f 2e                	jg     801f17 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801ee9:	83 ec 04             	sub    $0x4,%esp
+  801eec:	53                   	push   %ebx
+  801eed:	ff 75 0c             	push   0xc(%ebp)
+  801ef0:	68 0c 70 80 00       	push   $0x80700c
+  801ef5:	e8 ba eb ff ff       	call   800ab4 <memmove>
+	nsipcbuf.send.req_size = size;
+  801efa:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  801f00:	8b 45 14             	mov    0x14(%ebp),%eax
+  801f03:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  801f08:	b8 08 00 00 00       	mov    $0x8,%eax
+  801f0d:	e8 e8 fd ff ff       	call   801cfa <nsipc>
+}
+  801f12:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f15:	c9                   	leave
+  801f16:	c3                   	ret
+	assert(size < 1600);
+  801f17:	68 ac 30 80 00       	push   $0x8030ac
+  801f1c:	68 53 30 80 00       	push   $0x803053
+  801f21:	6a 6d                	push   $0x6d
+  801f23:	68 a0 30 80 00       	push   $0x8030a0
+  801f28:	e8 6d e3 ff ff       	call   80029a <_panic>
+
+00801f2d <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801f2d:	55                   	push   %ebp
+  801f2e:	89 e5                	mov    %esp,%ebp
+  801f30:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801f33:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f36:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  801f3b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f3e:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  801f43:	8b 45 10             	mov    0x10(%ebp),%eax
+  801f46:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  801f4b:	b8 09 00 00 00       	mov    $0x9,%eax
+  801f50:	e8 a5 fd ff ff       	call   801cfa <nsipc>
+}
+  801f55:	c9                   	leave
+  801f56:	c3                   	ret
+
+00801f57 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801f57:	55                   	push   %ebp
+  801f58:	89 e5                	mov    %esp,%ebp
+  801f5a:	56                   	push   %esi
+  801f5b:	53                   	push   %ebx
+  801f5c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801f5f:	83 ec 0c             	sub    $0xc,%esp
+  801f62:	ff 75 08             	push   0x8(%ebp)
+  801f65:	e8 aa f3 ff ff       	call   801314 <fd2data>
+  801f6a:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801f6c:	83 c4 08             	add    $0x8,%esp
+  801f6f:	68 b8 30 80 00       	push   $0x8030b8
+  801f74:	53                   	push   %ebx
+  801f75:	e8 b4 e9 ff ff       	call   80092e <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801f7a:	8b 46 04             	mov    0x4(%esi),%eax
+  801f7d:	2b 06                	sub    (%esi),%eax
+  801f7f:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  801f85:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801f8c:	00 00 00 
+	stat->st_dev = &devpipe;
+  801f8f:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  801f96:	40 80 00 
+	return 0;
+}
+  801f99:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f9e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fa1:	5b                   	pop    %ebx
+  801fa2:	5e                   	pop    %esi
+  801fa3:	5d                   	pop    %ebp
+  801fa4:	c3                   	ret
+
+00801fa5 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801fa5:	55                   	push   %ebp
+  801fa6:	89 e5                	mov    %esp,%ebp
+  801fa8:	53                   	push   %ebx
+  801fa9:	83 ec 0c             	sub    $0xc,%esp
+  801fac:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801faf:	53                   	push   %ebx
+  801fb0:	6a 00                	push   $0x0
+  801fb2:	e8 e8 ed ff ff       	call   800d9f <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801fb7:	89 1c 24             	mov    %ebx,(%esp)
+  801fba:	e8 55 f3 ff ff       	call   801314 <fd2data>
+  801fbf:	83 c4 08             	add    $0x8,%esp
+  801fc2:	50                   	push   %eax
+  801fc3:	6a 00                	push   $0x0
+  801fc5:	e8 d5 ed ff ff       	call   800d9f <sys_page_unmap>
+}
+  801fca:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fcd:	c9                   	leave
+  801fce:	c3                   	ret
+
+00801fcf <_pipeisclosed>:
+{
+  801fcf:	55                   	push   %ebp
+  801fd0:	89 e5                	mov    %esp,%ebp
+  801fd2:	57                   	push   %edi
+  801fd3:	56                   	push   %esi
+  801fd4:	53                   	push   %ebx
+  801fd5:	83 ec 1c             	sub    $0x1c,%esp
+  801fd8:	89 c7                	mov    %eax,%edi
+  801fda:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801fdc:	a1 08 50 80 00       	mov    0x805008,%eax
+  801fe1:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801fe4:	83 ec 0c             	sub    $0xc,%esp
+  801fe7:	57                   	push   %edi
+  801fe8:	e8 be 05 00 00       	call   8025ab <pageref>
+  801fed:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801ff0:	89 34 24             	mov    %esi,(%esp)
+  801ff3:	e8 b3 05 00 00       	call   8025ab <pageref>
+		nn = thisenv->env_runs;
+  801ff8:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  801ffe:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  802001:	83 c4 10             	add    $0x10,%esp
+  802004:	39 cb                	cmp    %ecx,%ebx
+  802006:	74 1b                	je     802023 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802008:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80200b:	75 cf                	jne    801fdc <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80200d:	8b 42 58             	mov    0x58(%edx),%eax
+  802010:	6a 01                	push   $0x1
+  802012:	50                   	push   %eax
+  802013:	53                   	push   %ebx
+  802014:	68 bf 30 80 00       	push   $0x8030bf
+  802019:	e8 57 e3 ff ff       	call   800375 <cprintf>
+  80201e:	83 c4 10             	add    $0x10,%esp
+  802021:	eb b9                	jmp    801fdc <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802023:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802026:	0f 94 c0             	sete   %al
+  802029:	0f b6 c0             	movzbl %al,%eax
+}
+  80202c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80202f:	5b                   	pop    %ebx
+  802030:	5e                   	pop    %esi
+  802031:	5f                   	pop    %edi
+  802032:	5d                   	pop    %ebp
+  802033:	c3                   	ret
+
+00802034 <devpipe_write>:
+{
+  802034:	55                   	push   %ebp
+  802035:	89 e5                	mov    %esp,%ebp
+  802037:	57                   	push   %edi
+  802038:	56                   	push   %esi
+  802039:	53                   	push   %ebx
+  80203a:	83 ec 28             	sub    $0x28,%esp
+  80203d:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802040:	56                   	push   %esi
+  802041:	e8 ce f2 ff ff       	call   801314 <fd2data>
+  802046:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802048:	83 c4 10             	add    $0x10,%esp
+  80204b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802050:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802053:	75 09                	jne    80205e <devpipe_write+0x2a>
+	return i;
+  802055:	89 f8                	mov    %edi,%eax
+  802057:	eb 23                	jmp    80207c <devpipe_write+0x48>
+			sys_yield();
+  802059:	e8 9d ec ff ff       	call   800cfb <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80205e:	8b 43 04             	mov    0x4(%ebx),%eax
+  802061:	8b 0b                	mov    (%ebx),%ecx
+  802063:	8d 51 20             	lea    0x20(%ecx),%edx
+  802066:	39 d0                	cmp    %edx,%eax
+  802068:	72 1a                	jb     802084 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  80206a:	89 da                	mov    %ebx,%edx
+  80206c:	89 f0                	mov    %esi,%eax
+  80206e:	e8 5c ff ff ff       	call   801fcf <_pipeisclosed>
+  802073:	85 c0                	test   %eax,%eax
+  802075:	74 e2                	je     802059 <devpipe_write+0x25>
+				return 0;
+  802077:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80207c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80207f:	5b                   	pop    %ebx
+  802080:	5e                   	pop    %esi
+  802081:	5f                   	pop    %edi
+  802082:	5d                   	pop    %ebp
+  802083:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802084:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802087:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  80208b:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  80208e:	89 c2                	mov    %eax,%edx
+  802090:	c1 fa 1f             	sar    $0x1f,%edx
+  802093:	89 d1                	mov    %edx,%ecx
+  802095:	c1 e9 1b             	shr    $0x1b,%ecx
+  802098:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80209b:	83 e2 1f             	and    $0x1f,%edx
+  80209e:	29 ca                	sub    %ecx,%edx
+  8020a0:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8020a4:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8020a8:	83 c0 01             	add    $0x1,%eax
+  8020ab:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8020ae:	83 c7 01             	add    $0x1,%edi
+  8020b1:	eb 9d                	jmp    802050 <devpipe_write+0x1c>
+
+008020b3 <devpipe_read>:
+{
+  8020b3:	55                   	push   %ebp
+  8020b4:	89 e5                	mov    %esp,%ebp
+  8020b6:	57                   	push   %edi
+  8020b7:	56                   	push   %esi
+  8020b8:	53                   	push   %ebx
+  8020b9:	83 ec 18             	sub    $0x18,%esp
+  8020bc:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8020bf:	57                   	push   %edi
+  8020c0:	e8 4f f2 ff ff       	call   801314 <fd2data>
+  8020c5:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8020c7:	83 c4 10             	add    $0x10,%esp
+  8020ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8020cf:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8020d2:	75 13                	jne    8020e7 <devpipe_read+0x34>
+	return i;
+  8020d4:	89 f0                	mov    %esi,%eax
+  8020d6:	eb 02                	jmp    8020da <devpipe_read+0x27>
+				return i;
+  8020d8:	89 f0                	mov    %esi,%eax
+}
+  8020da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020dd:	5b                   	pop    %ebx
+  8020de:	5e                   	pop    %esi
+  8020df:	5f                   	pop    %edi
+  8020e0:	5d                   	pop    %ebp
+  8020e1:	c3                   	ret
+			sys_yield();
+  8020e2:	e8 14 ec ff ff       	call   800cfb <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  8020e7:	8b 03                	mov    (%ebx),%eax
+  8020e9:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8020ec:	75 18                	jne    802106 <devpipe_read+0x53>
+			if (i > 0)
+  8020ee:	85 f6                	test   %esi,%esi
+  8020f0:	75 e6                	jne    8020d8 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  8020f2:	89 da                	mov    %ebx,%edx
+  8020f4:	89 f8                	mov    %edi,%eax
+  8020f6:	e8 d4 fe ff ff       	call   801fcf <_pipeisclosed>
+  8020fb:	85 c0                	test   %eax,%eax
+  8020fd:	74 e3                	je     8020e2 <devpipe_read+0x2f>
+				return 0;
+  8020ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  802104:	eb d4                	jmp    8020da <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802106:	99                   	cltd
+  802107:	c1 ea 1b             	shr    $0x1b,%edx
+  80210a:	01 d0                	add    %edx,%eax
+  80210c:	83 e0 1f             	and    $0x1f,%eax
+  80210f:	29 d0                	sub    %edx,%eax
+  802111:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802116:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802119:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80211c:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80211f:	83 c6 01             	add    $0x1,%esi
+  802122:	eb ab                	jmp    8020cf <devpipe_read+0x1c>
+
+00802124 <pipe>:
+{
+  802124:	55                   	push   %ebp
+  802125:	89 e5                	mov    %esp,%ebp
+  802127:	56                   	push   %esi
+  802128:	53                   	push   %ebx
+  802129:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80212c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80212f:	50                   	push   %eax
+  802130:	e8 f6 f1 ff ff       	call   80132b <fd_alloc>
+  802135:	89 c3                	mov    %eax,%ebx
+  802137:	83 c4 10             	add    $0x10,%esp
+  80213a:	85 c0                	test   %eax,%eax
+  80213c:	0f 88 23 01 00 00    	js     802265 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802142:	83 ec 04             	sub    $0x4,%esp
+  802145:	68 07 04 00 00       	push   $0x407
+  80214a:	ff 75 f4             	push   -0xc(%ebp)
+  80214d:	6a 00                	push   $0x0
+  80214f:	e8 c6 eb ff ff       	call   800d1a <sys_page_alloc>
+  802154:	89 c3                	mov    %eax,%ebx
+  802156:	83 c4 10             	add    $0x10,%esp
+  802159:	85 c0                	test   %eax,%eax
+  80215b:	0f 88 04 01 00 00    	js     802265 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802161:	83 ec 0c             	sub    $0xc,%esp
+  802164:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802167:	50                   	push   %eax
+  802168:	e8 be f1 ff ff       	call   80132b <fd_alloc>
+  80216d:	89 c3                	mov    %eax,%ebx
+  80216f:	83 c4 10             	add    $0x10,%esp
+  802172:	85 c0                	test   %eax,%eax
+  802174:	0f 88 db 00 00 00    	js     802255 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80217a:	83 ec 04             	sub    $0x4,%esp
+  80217d:	68 07 04 00 00       	push   $0x407
+  802182:	ff 75 f0             	push   -0x10(%ebp)
+  802185:	6a 00                	push   $0x0
+  802187:	e8 8e eb ff ff       	call   800d1a <sys_page_alloc>
+  80218c:	89 c3                	mov    %eax,%ebx
+  80218e:	83 c4 10             	add    $0x10,%esp
+  802191:	85 c0                	test   %eax,%eax
+  802193:	0f 88 bc 00 00 00    	js     802255 <pipe+0x131>
+	va = fd2data(fd0);
+  802199:	83 ec 0c             	sub    $0xc,%esp
+  80219c:	ff 75 f4             	push   -0xc(%ebp)
+  80219f:	e8 70 f1 ff ff       	call   801314 <fd2data>
+  8021a4:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8021a6:	83 c4 0c             	add    $0xc,%esp
+  8021a9:	68 07 04 00 00       	push   $0x407
+  8021ae:	50                   	push   %eax
+  8021af:	6a 00                	push   $0x0
+  8021b1:	e8 64 eb ff ff       	call   800d1a <sys_page_alloc>
+  8021b6:	89 c3                	mov    %eax,%ebx
+  8021b8:	83 c4 10             	add    $0x10,%esp
+  8021bb:	85 c0                	test   %eax,%eax
+  8021bd:	0f 88 82 00 00 00    	js     802245 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8021c3:	83 ec 0c             	sub    $0xc,%esp
+  8021c6:	ff 75 f0             	push   -0x10(%ebp)
+  8021c9:	e8 46 f1 ff ff       	call   801314 <fd2data>
+  8021ce:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8021d5:	50                   	push   %eax
+  8021d6:	6a 00                	push   $0x0
+  8021d8:	56                   	push   %esi
+  8021d9:	6a 00                	push   $0x0
+  8021db:	e8 7d eb ff ff       	call   800d5d <sys_page_map>
+  8021e0:	89 c3                	mov    %eax,%ebx
+  8021e2:	83 c4 20             	add    $0x20,%esp
+  8021e5:	85 c0                	test   %eax,%eax
+  8021e7:	78 4e                	js     802237 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8021e9:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  8021ee:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8021f1:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8021f3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8021f6:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8021fd:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802200:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802202:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802205:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80220c:	83 ec 0c             	sub    $0xc,%esp
+  80220f:	ff 75 f4             	push   -0xc(%ebp)
+  802212:	e8 ed f0 ff ff       	call   801304 <fd2num>
+  802217:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80221a:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80221c:	83 c4 04             	add    $0x4,%esp
+  80221f:	ff 75 f0             	push   -0x10(%ebp)
+  802222:	e8 dd f0 ff ff       	call   801304 <fd2num>
+  802227:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80222a:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80222d:	83 c4 10             	add    $0x10,%esp
+  802230:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802235:	eb 2e                	jmp    802265 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802237:	83 ec 08             	sub    $0x8,%esp
+  80223a:	56                   	push   %esi
+  80223b:	6a 00                	push   $0x0
+  80223d:	e8 5d eb ff ff       	call   800d9f <sys_page_unmap>
+  802242:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802245:	83 ec 08             	sub    $0x8,%esp
+  802248:	ff 75 f0             	push   -0x10(%ebp)
+  80224b:	6a 00                	push   $0x0
+  80224d:	e8 4d eb ff ff       	call   800d9f <sys_page_unmap>
+  802252:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802255:	83 ec 08             	sub    $0x8,%esp
+  802258:	ff 75 f4             	push   -0xc(%ebp)
+  80225b:	6a 00                	push   $0x0
+  80225d:	e8 3d eb ff ff       	call   800d9f <sys_page_unmap>
+  802262:	83 c4 10             	add    $0x10,%esp
+}
+  802265:	89 d8                	mov    %ebx,%eax
+  802267:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80226a:	5b                   	pop    %ebx
+  80226b:	5e                   	pop    %esi
+  80226c:	5d                   	pop    %ebp
+  80226d:	c3                   	ret
+
+0080226e <pipeisclosed>:
+{
+  80226e:	55                   	push   %ebp
+  80226f:	89 e5                	mov    %esp,%ebp
+  802271:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802274:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802277:	50                   	push   %eax
+  802278:	ff 75 08             	push   0x8(%ebp)
+  80227b:	e8 01 f1 ff ff       	call   801381 <fd_lookup>
+  802280:	83 c4 10             	add    $0x10,%esp
+  802283:	85 c0                	test   %eax,%eax
+  802285:	78 18                	js     80229f <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802287:	83 ec 0c             	sub    $0xc,%esp
+  80228a:	ff 75 f4             	push   -0xc(%ebp)
+  80228d:	e8 82 f0 ff ff       	call   801314 <fd2data>
+  802292:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802294:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802297:	e8 33 fd ff ff       	call   801fcf <_pipeisclosed>
+  80229c:	83 c4 10             	add    $0x10,%esp
+}
+  80229f:	c9                   	leave
+  8022a0:	c3                   	ret
+
+008022a1 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8022a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022a6:	c3                   	ret
+
+008022a7 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8022a7:	55                   	push   %ebp
+  8022a8:	89 e5                	mov    %esp,%ebp
+  8022aa:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8022ad:	68 d2 30 80 00       	push   $0x8030d2
+  8022b2:	ff 75 0c             	push   0xc(%ebp)
+  8022b5:	e8 74 e6 ff ff       	call   80092e <strcpy>
+	return 0;
+}
+  8022ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022bf:	c9                   	leave
+  8022c0:	c3                   	ret
+
+008022c1 <devcons_write>:
+{
+  8022c1:	55                   	push   %ebp
+  8022c2:	89 e5                	mov    %esp,%ebp
+  8022c4:	57                   	push   %edi
+  8022c5:	56                   	push   %esi
+  8022c6:	53                   	push   %ebx
+  8022c7:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8022cd:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8022d2:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8022d8:	eb 2e                	jmp    802308 <devcons_write+0x47>
+		m = n - tot;
+  8022da:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8022dd:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8022df:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8022e4:	39 c3                	cmp    %eax,%ebx
+  8022e6:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8022e9:	83 ec 04             	sub    $0x4,%esp
+  8022ec:	53                   	push   %ebx
+  8022ed:	89 f0                	mov    %esi,%eax
+  8022ef:	03 45 0c             	add    0xc(%ebp),%eax
+  8022f2:	50                   	push   %eax
+  8022f3:	57                   	push   %edi
+  8022f4:	e8 bb e7 ff ff       	call   800ab4 <memmove>
+		sys_cputs(buf, m);
+  8022f9:	83 c4 08             	add    $0x8,%esp
+  8022fc:	53                   	push   %ebx
+  8022fd:	57                   	push   %edi
+  8022fe:	e8 5b e9 ff ff       	call   800c5e <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802303:	01 de                	add    %ebx,%esi
+  802305:	83 c4 10             	add    $0x10,%esp
+  802308:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80230b:	72 cd                	jb     8022da <devcons_write+0x19>
+}
+  80230d:	89 f0                	mov    %esi,%eax
+  80230f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802312:	5b                   	pop    %ebx
+  802313:	5e                   	pop    %esi
+  802314:	5f                   	pop    %edi
+  802315:	5d                   	pop    %ebp
+  802316:	c3                   	ret
+
+00802317 <devcons_read>:
+{
+  802317:	55                   	push   %ebp
+  802318:	89 e5                	mov    %esp,%ebp
+  80231a:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80231d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802322:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802326:	75 07                	jne    80232f <devcons_read+0x18>
+  802328:	eb 1f                	jmp    802349 <devcons_read+0x32>
+		sys_yield();
+  80232a:	e8 cc e9 ff ff       	call   800cfb <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80232f:	e8 48 e9 ff ff       	call   800c7c <sys_cgetc>
+  802334:	85 c0                	test   %eax,%eax
+  802336:	74 f2                	je     80232a <devcons_read+0x13>
+	if (c < 0)
+  802338:	78 0f                	js     802349 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80233a:	83 f8 04             	cmp    $0x4,%eax
+  80233d:	74 0c                	je     80234b <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80233f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802342:	88 02                	mov    %al,(%edx)
+	return 1;
+  802344:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802349:	c9                   	leave
+  80234a:	c3                   	ret
+		return 0;
+  80234b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802350:	eb f7                	jmp    802349 <devcons_read+0x32>
+
+00802352 <cputchar>:
+{
+  802352:	55                   	push   %ebp
+  802353:	89 e5                	mov    %esp,%ebp
+  802355:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802358:	8b 45 08             	mov    0x8(%ebp),%eax
+  80235b:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80235e:	6a 01                	push   $0x1
+  802360:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802363:	50                   	push   %eax
+  802364:	e8 f5 e8 ff ff       	call   800c5e <sys_cputs>
+}
+  802369:	83 c4 10             	add    $0x10,%esp
+  80236c:	c9                   	leave
+  80236d:	c3                   	ret
+
+0080236e <getchar>:
+{
+  80236e:	55                   	push   %ebp
+  80236f:	89 e5                	mov    %esp,%ebp
+  802371:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802374:	6a 01                	push   $0x1
+  802376:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802379:	50                   	push   %eax
+  80237a:	6a 00                	push   $0x0
+  80237c:	e8 66 f2 ff ff       	call   8015e7 <read>
+	if (r < 0)
+  802381:	83 c4 10             	add    $0x10,%esp
+  802384:	85 c0                	test   %eax,%eax
+  802386:	78 06                	js     80238e <getchar+0x20>
+	if (r < 1)
+  802388:	74 06                	je     802390 <getchar+0x22>
+	return c;
+  80238a:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80238e:	c9                   	leave
+  80238f:	c3                   	ret
+		return -E_EOF;
+  802390:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802395:	eb f7                	jmp    80238e <getchar+0x20>
+
+00802397 <iscons>:
+{
+  802397:	55                   	push   %ebp
+  802398:	89 e5                	mov    %esp,%ebp
+  80239a:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80239d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023a0:	50                   	push   %eax
+  8023a1:	ff 75 08             	push   0x8(%ebp)
+  8023a4:	e8 d8 ef ff ff       	call   801381 <fd_lookup>
+  8023a9:	83 c4 10             	add    $0x10,%esp
+  8023ac:	85 c0                	test   %eax,%eax
+  8023ae:	78 11                	js     8023c1 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8023b0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023b3:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  8023b9:	39 10                	cmp    %edx,(%eax)
+  8023bb:	0f 94 c0             	sete   %al
+  8023be:	0f b6 c0             	movzbl %al,%eax
+}
+  8023c1:	c9                   	leave
+  8023c2:	c3                   	ret
+
+008023c3 <opencons>:
+{
+  8023c3:	55                   	push   %ebp
+  8023c4:	89 e5                	mov    %esp,%ebp
+  8023c6:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8023c9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023cc:	50                   	push   %eax
+  8023cd:	e8 59 ef ff ff       	call   80132b <fd_alloc>
+  8023d2:	83 c4 10             	add    $0x10,%esp
+  8023d5:	85 c0                	test   %eax,%eax
+  8023d7:	78 3a                	js     802413 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8023d9:	83 ec 04             	sub    $0x4,%esp
+  8023dc:	68 07 04 00 00       	push   $0x407
+  8023e1:	ff 75 f4             	push   -0xc(%ebp)
+  8023e4:	6a 00                	push   $0x0
+  8023e6:	e8 2f e9 ff ff       	call   800d1a <sys_page_alloc>
+  8023eb:	83 c4 10             	add    $0x10,%esp
+  8023ee:	85 c0                	test   %eax,%eax
+  8023f0:	78 21                	js     802413 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8023f2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023f5:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  8023fb:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8023fd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802400:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802407:	83 ec 0c             	sub    $0xc,%esp
+  80240a:	50                   	push   %eax
+  80240b:	e8 f4 ee ff ff       	call   801304 <fd2num>
+  802410:	83 c4 10             	add    $0x10,%esp
+}
+  802413:	c9                   	leave
+  802414:	c3                   	ret
+
+00802415 <set_pgfault_handler>:
+// allocate an exception stack (one page of memory with its top
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf)) {
+  802415:	55                   	push   %ebp
+  802416:	89 e5                	mov    %esp,%ebp
+  802418:	83 ec 08             	sub    $0x8,%esp
+  int r;
+
+  if (_pgfault_handler == 0) {
+  80241b:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  802422:	74 0a                	je     80242e <set_pgfault_handler+0x19>
+    if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)))
+      panic(" set_pgfault_handler sys_env_set_pgfault_upcall panic: %e\n", r);
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  802424:	8b 45 08             	mov    0x8(%ebp),%eax
+  802427:	a3 00 80 80 00       	mov    %eax,0x808000
+
+
+}
+  80242c:	c9                   	leave
+  80242d:	c3                   	ret
+    if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)))
+  80242e:	83 ec 04             	sub    $0x4,%esp
+  802431:	6a 07                	push   $0x7
+  802433:	68 00 f0 bf ee       	push   $0xeebff000
+  802438:	6a 00                	push   $0x0
+  80243a:	e8 db e8 ff ff       	call   800d1a <sys_page_alloc>
+  80243f:	83 c4 10             	add    $0x10,%esp
+  802442:	85 c0                	test   %eax,%eax
+  802444:	75 28                	jne    80246e <set_pgfault_handler+0x59>
+    if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)))
+  802446:	83 ec 08             	sub    $0x8,%esp
+  802449:	68 80 24 80 00       	push   $0x802480
+  80244e:	6a 00                	push   $0x0
+  802450:	e8 10 ea ff ff       	call   800e65 <sys_env_set_pgfault_upcall>
+  802455:	83 c4 10             	add    $0x10,%esp
+  802458:	85 c0                	test   %eax,%eax
+  80245a:	74 c8                	je     802424 <set_pgfault_handler+0xf>
+      panic(" set_pgfault_handler sys_env_set_pgfault_upcall panic: %e\n", r);
+  80245c:	50                   	push   %eax
+  80245d:	68 10 31 80 00       	push   $0x803110
+  802462:	6a 22                	push   $0x22
+  802464:	68 4b 31 80 00       	push   $0x80314b
+  802469:	e8 2c de ff ff       	call   80029a <_panic>
+      panic("set_pgfault_handler sys_page_alloc panic: %e\n", r);
+  80246e:	50                   	push   %eax
+  80246f:	68 e0 30 80 00       	push   $0x8030e0
+  802474:	6a 20                	push   $0x20
+  802476:	68 4b 31 80 00       	push   $0x80314b
+  80247b:	e8 1a de ff ff       	call   80029a <_panic>
+
+00802480 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  802480:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  802481:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  802486:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  802488:	83 c4 04             	add    $0x4,%esp
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	// push the trap-time %eip onto the trap-time stack
+    subl $0x4, 0x30(%esp) # for push eip
+  80248b:	83 6c 24 30 04       	subl   $0x4,0x30(%esp)
+    movl 0x30(%esp), %ebx #regular esp
+  802490:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+    movl 0x28(%esp), %eax #eip
+  802494:	8b 44 24 28          	mov    0x28(%esp),%eax
+    movl %eax, (%ebx)
+  802498:	89 03                	mov    %eax,(%ebx)
+
+    // Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+    addl $8, %esp
+  80249a:	83 c4 08             	add    $0x8,%esp
+    popal
+  80249d:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  80249e:	83 c4 04             	add    $0x4,%esp
+	popfl
+  8024a1:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  8024a2:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  8024a3:	c3                   	ret
+
+008024a4 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  8024a4:	55                   	push   %ebp
+  8024a5:	89 e5                	mov    %esp,%ebp
+  8024a7:	56                   	push   %esi
+  8024a8:	53                   	push   %ebx
+  8024a9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8024ac:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024af:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  8024b2:	85 c0                	test   %eax,%eax
+  8024b4:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8024b9:	0f 44 c2             	cmove  %edx,%eax
+  8024bc:	83 ec 0c             	sub    $0xc,%esp
+  8024bf:	50                   	push   %eax
+  8024c0:	e8 05 ea ff ff       	call   800eca <sys_ipc_recv>
+
+  if (from_env_store)
+  8024c5:	83 c4 10             	add    $0x10,%esp
+  8024c8:	85 f6                	test   %esi,%esi
+  8024ca:	74 17                	je     8024e3 <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  8024cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024d1:	85 c0                	test   %eax,%eax
+  8024d3:	75 0c                	jne    8024e1 <ipc_recv+0x3d>
+  8024d5:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  8024db:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  8024e1:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  8024e3:	85 db                	test   %ebx,%ebx
+  8024e5:	74 2b                	je     802512 <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  8024e7:	85 c0                	test   %eax,%eax
+  8024e9:	74 0d                	je     8024f8 <ipc_recv+0x54>
+  8024eb:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  8024f1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024f4:	5b                   	pop    %ebx
+  8024f5:	5e                   	pop    %esi
+  8024f6:	5d                   	pop    %ebp
+  8024f7:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  8024f8:	a1 08 50 80 00       	mov    0x805008,%eax
+  8024fd:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  802503:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  802505:	a1 08 50 80 00       	mov    0x805008,%eax
+  80250a:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  802510:	eb df                	jmp    8024f1 <ipc_recv+0x4d>
+  802512:	85 c0                	test   %eax,%eax
+  802514:	75 db                	jne    8024f1 <ipc_recv+0x4d>
+  802516:	eb ed                	jmp    802505 <ipc_recv+0x61>
+
+00802518 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  802518:	55                   	push   %ebp
+  802519:	89 e5                	mov    %esp,%ebp
+  80251b:	57                   	push   %edi
+  80251c:	56                   	push   %esi
+  80251d:	53                   	push   %ebx
+  80251e:	83 ec 0c             	sub    $0xc,%esp
+  802521:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802524:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802527:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  80252a:	85 db                	test   %ebx,%ebx
+  80252c:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802531:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  802534:	ff 75 14             	push   0x14(%ebp)
+  802537:	53                   	push   %ebx
+  802538:	56                   	push   %esi
+  802539:	57                   	push   %edi
+  80253a:	e8 68 e9 ff ff       	call   800ea7 <sys_ipc_try_send>
+  80253f:	83 c4 10             	add    $0x10,%esp
+  802542:	85 c0                	test   %eax,%eax
+  802544:	74 1e                	je     802564 <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  802546:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802549:	75 07                	jne    802552 <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  80254b:	e8 ab e7 ff ff       	call   800cfb <sys_yield>
+  802550:	eb e2                	jmp    802534 <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  802552:	50                   	push   %eax
+  802553:	68 59 31 80 00       	push   $0x803159
+  802558:	6a 3c                	push   $0x3c
+  80255a:	68 66 31 80 00       	push   $0x803166
+  80255f:	e8 36 dd ff ff       	call   80029a <_panic>
+  }
+
+#endif
+}
+  802564:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802567:	5b                   	pop    %ebx
+  802568:	5e                   	pop    %esi
+  802569:	5f                   	pop    %edi
+  80256a:	5d                   	pop    %ebp
+  80256b:	c3                   	ret
+
+0080256c <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  80256c:	55                   	push   %ebp
+  80256d:	89 e5                	mov    %esp,%ebp
+  80256f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  802572:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  802577:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80257a:	c1 e0 04             	shl    $0x4,%eax
+  80257d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802582:	8b 40 50             	mov    0x50(%eax),%eax
+  802585:	39 c8                	cmp    %ecx,%eax
+  802587:	74 12                	je     80259b <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  802589:	83 c2 01             	add    $0x1,%edx
+  80258c:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802592:	75 e3                	jne    802577 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802594:	b8 00 00 00 00       	mov    $0x0,%eax
+  802599:	eb 0e                	jmp    8025a9 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  80259b:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80259e:	c1 e0 04             	shl    $0x4,%eax
+  8025a1:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8025a6:	8b 40 48             	mov    0x48(%eax),%eax
+  8025a9:	5d                   	pop    %ebp
+  8025aa:	c3                   	ret
+
+008025ab <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8025ab:	55                   	push   %ebp
+  8025ac:	89 e5                	mov    %esp,%ebp
+  8025ae:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8025b1:	89 c2                	mov    %eax,%edx
+  8025b3:	c1 ea 16             	shr    $0x16,%edx
+  8025b6:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8025bd:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8025c2:	f6 c1 01             	test   $0x1,%cl
+  8025c5:	74 1c                	je     8025e3 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  8025c7:	c1 e8 0c             	shr    $0xc,%eax
+  8025ca:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8025d1:	a8 01                	test   $0x1,%al
+  8025d3:	74 0e                	je     8025e3 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8025d5:	c1 e8 0c             	shr    $0xc,%eax
+  8025d8:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  8025df:	ef 
+  8025e0:	0f b7 d2             	movzwl %dx,%edx
+}
+  8025e3:	89 d0                	mov    %edx,%eax
+  8025e5:	5d                   	pop    %ebp
+  8025e6:	c3                   	ret
+  8025e7:	66 90                	xchg   %ax,%ax
+  8025e9:	66 90                	xchg   %ax,%ax
+  8025eb:	66 90                	xchg   %ax,%ax
+  8025ed:	66 90                	xchg   %ax,%ax
+  8025ef:	90                   	nop
+
+008025f0 <__udivmoddi4>:
+  8025f0:	55                   	push   %ebp
+  8025f1:	57                   	push   %edi
+  8025f2:	56                   	push   %esi
+  8025f3:	53                   	push   %ebx
+  8025f4:	83 ec 24             	sub    $0x24,%esp
+  8025f7:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8025fb:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8025ff:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  802603:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802607:	8b 54 24 44          	mov    0x44(%esp),%edx
+  80260b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80260f:	8b 44 24 40          	mov    0x40(%esp),%eax
+  802613:	89 d3                	mov    %edx,%ebx
+  802615:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802619:	09 c3                	or     %eax,%ebx
+  80261b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80261f:	0f 84 9c 00 00 00    	je     8026c1 <__udivmoddi4+0xd1>
+  802625:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80262c:	00 
+  80262d:	31 c0                	xor    %eax,%eax
+  80262f:	31 d2                	xor    %edx,%edx
+  802631:	89 fb                	mov    %edi,%ebx
+  802633:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80263a:	00 
+  80263b:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802640:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802644:	01 c0                	add    %eax,%eax
+  802646:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80264d:	00 
+  80264e:	89 c6                	mov    %eax,%esi
+  802650:	89 d7                	mov    %edx,%edi
+  802652:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802656:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80265a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80265d:	d3 ea                	shr    %cl,%edx
+  80265f:	f6 c1 20             	test   $0x20,%cl
+  802662:	0f 45 c2             	cmovne %edx,%eax
+  802665:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802669:	83 e0 01             	and    $0x1,%eax
+  80266c:	09 fa                	or     %edi,%edx
+  80266e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802672:	89 04 24             	mov    %eax,(%esp)
+  802675:	8b 04 24             	mov    (%esp),%eax
+  802678:	89 d5                	mov    %edx,%ebp
+  80267a:	09 f0                	or     %esi,%eax
+  80267c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802680:	39 f0                	cmp    %esi,%eax
+  802682:	19 fd                	sbb    %edi,%ebp
+  802684:	72 1d                	jb     8026a3 <__udivmoddi4+0xb3>
+  802686:	29 f0                	sub    %esi,%eax
+  802688:	19 fa                	sbb    %edi,%edx
+  80268a:	89 cf                	mov    %ecx,%edi
+  80268c:	c1 ef 05             	shr    $0x5,%edi
+  80268f:	83 e7 01             	and    $0x1,%edi
+  802692:	89 fe                	mov    %edi,%esi
+  802694:	d3 e7                	shl    %cl,%edi
+  802696:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80269a:	83 f6 01             	xor    $0x1,%esi
+  80269d:	d3 e6                	shl    %cl,%esi
+  80269f:	09 74 24 18          	or     %esi,0x18(%esp)
+  8026a3:	83 e9 01             	sub    $0x1,%ecx
+  8026a6:	73 98                	jae    802640 <__udivmoddi4+0x50>
+  8026a8:	85 db                	test   %ebx,%ebx
+  8026aa:	74 05                	je     8026b1 <__udivmoddi4+0xc1>
+  8026ac:	89 03                	mov    %eax,(%ebx)
+  8026ae:	89 53 04             	mov    %edx,0x4(%ebx)
+  8026b1:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8026b5:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8026b9:	83 c4 24             	add    $0x24,%esp
+  8026bc:	5b                   	pop    %ebx
+  8026bd:	5e                   	pop    %esi
+  8026be:	5f                   	pop    %edi
+  8026bf:	5d                   	pop    %ebp
+  8026c0:	c3                   	ret
+  8026c1:	85 ff                	test   %edi,%edi
+  8026c3:	74 0d                	je     8026d2 <__udivmoddi4+0xe2>
+  8026c5:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  8026cb:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  8026d2:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8026d6:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8026da:	89 44 24 18          	mov    %eax,0x18(%esp)
+  8026de:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8026e2:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  8026e6:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8026ea:	83 c4 24             	add    $0x24,%esp
+  8026ed:	5b                   	pop    %ebx
+  8026ee:	5e                   	pop    %esi
+  8026ef:	5f                   	pop    %edi
+  8026f0:	5d                   	pop    %ebp
+  8026f1:	c3                   	ret
+  8026f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8026f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00802700 <__udivdi3>:
+  802700:	57                   	push   %edi
+  802701:	56                   	push   %esi
+  802702:	53                   	push   %ebx
+  802703:	83 ec 20             	sub    $0x20,%esp
+  802706:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80270a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80270e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802712:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802716:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80271a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80271e:	89 d1                	mov    %edx,%ecx
+  802720:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802724:	09 c1                	or     %eax,%ecx
+  802726:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80272a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80272e:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802732:	0f 84 88 00 00 00    	je     8027c0 <__udivdi3+0xc0>
+  802738:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80273f:	00 
+  802740:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802745:	31 c0                	xor    %eax,%eax
+  802747:	31 d2                	xor    %edx,%edx
+  802749:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802750:	00 
+  802751:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802758:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80275c:	01 c0                	add    %eax,%eax
+  80275e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802765:	00 
+  802766:	89 c6                	mov    %eax,%esi
+  802768:	89 d7                	mov    %edx,%edi
+  80276a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80276e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802772:	0f ad d0             	shrd   %cl,%edx,%eax
+  802775:	d3 ea                	shr    %cl,%edx
+  802777:	f6 c1 20             	test   $0x20,%cl
+  80277a:	0f 45 c2             	cmovne %edx,%eax
+  80277d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802781:	83 e0 01             	and    $0x1,%eax
+  802784:	09 fa                	or     %edi,%edx
+  802786:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80278a:	89 04 24             	mov    %eax,(%esp)
+  80278d:	8b 04 24             	mov    (%esp),%eax
+  802790:	89 d3                	mov    %edx,%ebx
+  802792:	09 f0                	or     %esi,%eax
+  802794:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802798:	39 f0                	cmp    %esi,%eax
+  80279a:	19 fb                	sbb    %edi,%ebx
+  80279c:	72 1d                	jb     8027bb <__udivdi3+0xbb>
+  80279e:	29 f0                	sub    %esi,%eax
+  8027a0:	19 fa                	sbb    %edi,%edx
+  8027a2:	89 cf                	mov    %ecx,%edi
+  8027a4:	c1 ef 05             	shr    $0x5,%edi
+  8027a7:	83 e7 01             	and    $0x1,%edi
+  8027aa:	89 fe                	mov    %edi,%esi
+  8027ac:	d3 e7                	shl    %cl,%edi
+  8027ae:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8027b2:	83 f6 01             	xor    $0x1,%esi
+  8027b5:	d3 e6                	shl    %cl,%esi
+  8027b7:	09 74 24 18          	or     %esi,0x18(%esp)
+  8027bb:	83 e9 01             	sub    $0x1,%ecx
+  8027be:	73 98                	jae    802758 <__udivdi3+0x58>
+  8027c0:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8027c4:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8027c8:	83 c4 20             	add    $0x20,%esp
+  8027cb:	5b                   	pop    %ebx
+  8027cc:	5e                   	pop    %esi
+  8027cd:	5f                   	pop    %edi
+  8027ce:	c3                   	ret
+  8027cf:	90                   	nop
+
+008027d0 <__umoddi3>:
+  8027d0:	57                   	push   %edi
+  8027d1:	56                   	push   %esi
+  8027d2:	53                   	push   %ebx
+  8027d3:	83 ec 18             	sub    $0x18,%esp
+  8027d6:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8027da:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8027de:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8027e2:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8027e6:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8027ea:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8027ee:	89 d1                	mov    %edx,%ecx
+  8027f0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8027f4:	09 c1                	or     %eax,%ecx
+  8027f6:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8027fa:	74 5b                	je     802857 <__umoddi3+0x87>
+  8027fc:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802801:	31 c0                	xor    %eax,%eax
+  802803:	31 d2                	xor    %edx,%edx
+  802805:	8d 76 00             	lea    0x0(%esi),%esi
+  802808:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80280c:	01 c0                	add    %eax,%eax
+  80280e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802815:	00 
+  802816:	89 c6                	mov    %eax,%esi
+  802818:	89 d7                	mov    %edx,%edi
+  80281a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80281e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802822:	0f ad d0             	shrd   %cl,%edx,%eax
+  802825:	d3 ea                	shr    %cl,%edx
+  802827:	f6 c1 20             	test   $0x20,%cl
+  80282a:	0f 45 c2             	cmovne %edx,%eax
+  80282d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802831:	83 e0 01             	and    $0x1,%eax
+  802834:	09 fa                	or     %edi,%edx
+  802836:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80283a:	89 04 24             	mov    %eax,(%esp)
+  80283d:	8b 04 24             	mov    (%esp),%eax
+  802840:	89 d3                	mov    %edx,%ebx
+  802842:	09 f0                	or     %esi,%eax
+  802844:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802848:	39 f0                	cmp    %esi,%eax
+  80284a:	19 fb                	sbb    %edi,%ebx
+  80284c:	72 04                	jb     802852 <__umoddi3+0x82>
+  80284e:	29 f0                	sub    %esi,%eax
+  802850:	19 fa                	sbb    %edi,%edx
+  802852:	83 e9 01             	sub    $0x1,%ecx
+  802855:	73 b1                	jae    802808 <__umoddi3+0x38>
+  802857:	83 c4 18             	add    $0x18,%esp
+  80285a:	5b                   	pop    %ebx
+  80285b:	5e                   	pop    %esi
+  80285c:	5f                   	pop    %edi
+  80285d:	c3                   	ret
+  80285e:	66 90                	xchg   %ax,%ax
+
+00802860 <__divdi3>:
+  802860:	55                   	push   %ebp
+  802861:	57                   	push   %edi
+  802862:	56                   	push   %esi
+  802863:	53                   	push   %ebx
+  802864:	83 ec 24             	sub    $0x24,%esp
+  802867:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  80286b:	8b 74 24 44          	mov    0x44(%esp),%esi
+  80286f:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802873:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802877:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  80287b:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  80287f:	85 d2                	test   %edx,%edx
+  802881:	0f 88 e0 00 00 00    	js     802967 <__divdi3+0x107>
+  802887:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  80288b:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  80288f:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802893:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802897:	85 f6                	test   %esi,%esi
+  802899:	78 16                	js     8028b1 <__divdi3+0x51>
+  80289b:	89 f1                	mov    %esi,%ecx
+  80289d:	31 c0                	xor    %eax,%eax
+  80289f:	31 d2                	xor    %edx,%edx
+  8028a1:	09 d9                	or     %ebx,%ecx
+  8028a3:	0f 85 f3 00 00 00    	jne    80299c <__divdi3+0x13c>
+  8028a9:	83 c4 24             	add    $0x24,%esp
+  8028ac:	5b                   	pop    %ebx
+  8028ad:	5e                   	pop    %esi
+  8028ae:	5f                   	pop    %edi
+  8028af:	5d                   	pop    %ebp
+  8028b0:	c3                   	ret
+  8028b1:	bf 01 00 00 00       	mov    $0x1,%edi
+  8028b6:	f7 5c 24 08          	negl   0x8(%esp)
+  8028ba:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  8028bf:	f7 5c 24 0c          	negl   0xc(%esp)
+  8028c3:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8028ca:	00 
+  8028cb:	31 c0                	xor    %eax,%eax
+  8028cd:	31 d2                	xor    %edx,%edx
+  8028cf:	89 fb                	mov    %edi,%ebx
+  8028d1:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8028d8:	00 
+  8028d9:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8028de:	66 90                	xchg   %ax,%ax
+  8028e0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8028e4:	01 c0                	add    %eax,%eax
+  8028e6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8028ed:	00 
+  8028ee:	89 c6                	mov    %eax,%esi
+  8028f0:	89 d7                	mov    %edx,%edi
+  8028f2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8028f6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8028fa:	0f ad d0             	shrd   %cl,%edx,%eax
+  8028fd:	d3 ea                	shr    %cl,%edx
+  8028ff:	f6 c1 20             	test   $0x20,%cl
+  802902:	0f 45 c2             	cmovne %edx,%eax
+  802905:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802909:	83 e0 01             	and    $0x1,%eax
+  80290c:	09 fa                	or     %edi,%edx
+  80290e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802912:	89 04 24             	mov    %eax,(%esp)
+  802915:	8b 04 24             	mov    (%esp),%eax
+  802918:	89 d5                	mov    %edx,%ebp
+  80291a:	09 f0                	or     %esi,%eax
+  80291c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802920:	39 f0                	cmp    %esi,%eax
+  802922:	19 fd                	sbb    %edi,%ebp
+  802924:	72 1d                	jb     802943 <__divdi3+0xe3>
+  802926:	29 f0                	sub    %esi,%eax
+  802928:	19 fa                	sbb    %edi,%edx
+  80292a:	89 cf                	mov    %ecx,%edi
+  80292c:	c1 ef 05             	shr    $0x5,%edi
+  80292f:	83 e7 01             	and    $0x1,%edi
+  802932:	89 fe                	mov    %edi,%esi
+  802934:	d3 e7                	shl    %cl,%edi
+  802936:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80293a:	83 f6 01             	xor    $0x1,%esi
+  80293d:	d3 e6                	shl    %cl,%esi
+  80293f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802943:	83 e9 01             	sub    $0x1,%ecx
+  802946:	73 98                	jae    8028e0 <__divdi3+0x80>
+  802948:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80294c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802950:	85 db                	test   %ebx,%ebx
+  802952:	0f 84 51 ff ff ff    	je     8028a9 <__divdi3+0x49>
+  802958:	f7 d8                	neg    %eax
+  80295a:	83 d2 00             	adc    $0x0,%edx
+  80295d:	83 c4 24             	add    $0x24,%esp
+  802960:	5b                   	pop    %ebx
+  802961:	f7 da                	neg    %edx
+  802963:	5e                   	pop    %esi
+  802964:	5f                   	pop    %edi
+  802965:	5d                   	pop    %ebp
+  802966:	c3                   	ret
+  802967:	f7 d8                	neg    %eax
+  802969:	83 d2 00             	adc    $0x0,%edx
+  80296c:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802970:	f7 da                	neg    %edx
+  802972:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802976:	85 f6                	test   %esi,%esi
+  802978:	78 1b                	js     802995 <__divdi3+0x135>
+  80297a:	89 f1                	mov    %esi,%ecx
+  80297c:	31 c0                	xor    %eax,%eax
+  80297e:	31 d2                	xor    %edx,%edx
+  802980:	bf 01 00 00 00       	mov    $0x1,%edi
+  802985:	09 d9                	or     %ebx,%ecx
+  802987:	0f 85 36 ff ff ff    	jne    8028c3 <__divdi3+0x63>
+  80298d:	83 c4 24             	add    $0x24,%esp
+  802990:	5b                   	pop    %ebx
+  802991:	5e                   	pop    %esi
+  802992:	5f                   	pop    %edi
+  802993:	5d                   	pop    %ebp
+  802994:	c3                   	ret
+  802995:	31 ff                	xor    %edi,%edi
+  802997:	e9 1a ff ff ff       	jmp    8028b6 <__divdi3+0x56>
+  80299c:	31 ff                	xor    %edi,%edi
+  80299e:	e9 20 ff ff ff       	jmp    8028c3 <__divdi3+0x63>
+  8029a3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8029aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+008029b0 <__moddi3>:
+  8029b0:	55                   	push   %ebp
+  8029b1:	57                   	push   %edi
+  8029b2:	56                   	push   %esi
+  8029b3:	53                   	push   %ebx
+  8029b4:	83 ec 1c             	sub    $0x1c,%esp
+  8029b7:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  8029bb:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  8029bf:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  8029c3:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  8029c7:	89 c8                	mov    %ecx,%eax
+  8029c9:	89 f2                	mov    %esi,%edx
+  8029cb:	89 f3                	mov    %esi,%ebx
+  8029cd:	85 ed                	test   %ebp,%ebp
+  8029cf:	0f 88 9d 00 00 00    	js     802a72 <__moddi3+0xc2>
+  8029d5:	09 cb                	or     %ecx,%ebx
+  8029d7:	0f 84 8d 00 00 00    	je     802a6a <__moddi3+0xba>
+  8029dd:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  8029e1:	31 db                	xor    %ebx,%ebx
+  8029e3:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  8029e7:	89 ca                	mov    %ecx,%edx
+  8029e9:	89 f0                	mov    %esi,%eax
+  8029eb:	89 dd                	mov    %ebx,%ebp
+  8029ed:	f7 da                	neg    %edx
+  8029ef:	83 d0 00             	adc    $0x0,%eax
+  8029f2:	f7 d8                	neg    %eax
+  8029f4:	0f 49 f0             	cmovns %eax,%esi
+  8029f7:	0f 49 ca             	cmovns %edx,%ecx
+  8029fa:	31 c0                	xor    %eax,%eax
+  8029fc:	31 d2                	xor    %edx,%edx
+  8029fe:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802a02:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802a06:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802a0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  802a0f:	90                   	nop
+  802a10:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802a14:	01 c0                	add    %eax,%eax
+  802a16:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802a1d:	00 
+  802a1e:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  802a22:	89 c6                	mov    %eax,%esi
+  802a24:	89 d7                	mov    %edx,%edi
+  802a26:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802a2a:	8b 54 24 14          	mov    0x14(%esp),%edx
+  802a2e:	0f ad d0             	shrd   %cl,%edx,%eax
+  802a31:	d3 ea                	shr    %cl,%edx
+  802a33:	f6 c1 20             	test   $0x20,%cl
+  802a36:	0f 45 c2             	cmovne %edx,%eax
+  802a39:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802a3d:	83 e0 01             	and    $0x1,%eax
+  802a40:	09 fa                	or     %edi,%edx
+  802a42:	89 04 24             	mov    %eax,(%esp)
+  802a45:	8b 04 24             	mov    (%esp),%eax
+  802a48:	89 d7                	mov    %edx,%edi
+  802a4a:	09 f0                	or     %esi,%eax
+  802a4c:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  802a50:	39 d8                	cmp    %ebx,%eax
+  802a52:	19 f7                	sbb    %esi,%edi
+  802a54:	72 04                	jb     802a5a <__moddi3+0xaa>
+  802a56:	29 d8                	sub    %ebx,%eax
+  802a58:	19 f2                	sbb    %esi,%edx
+  802a5a:	83 e9 01             	sub    $0x1,%ecx
+  802a5d:	73 b1                	jae    802a10 <__moddi3+0x60>
+  802a5f:	85 ed                	test   %ebp,%ebp
+  802a61:	74 07                	je     802a6a <__moddi3+0xba>
+  802a63:	f7 d8                	neg    %eax
+  802a65:	83 d2 00             	adc    $0x0,%edx
+  802a68:	f7 da                	neg    %edx
+  802a6a:	83 c4 1c             	add    $0x1c,%esp
+  802a6d:	5b                   	pop    %ebx
+  802a6e:	5e                   	pop    %esi
+  802a6f:	5f                   	pop    %edi
+  802a70:	5d                   	pop    %ebp
+  802a71:	c3                   	ret
+  802a72:	09 cb                	or     %ecx,%ebx
+  802a74:	74 f4                	je     802a6a <__moddi3+0xba>
+  802a76:	f7 df                	neg    %edi
+  802a78:	bb 01 00 00 00       	mov    $0x1,%ebx
+  802a7d:	83 d5 00             	adc    $0x0,%ebp
+  802a80:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802a84:	f7 dd                	neg    %ebp
+  802a86:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802a8a:	e9 58 ff ff ff       	jmp    8029e7 <__moddi3+0x37>
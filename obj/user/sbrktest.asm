@@ -0,0 +1,5318 @@
+
+obj/user/sbrktest.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 86 00 00 00       	call   8000b7 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#define ALLOCATE_SIZE 4096
+#define STRING_SIZE	  64
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+	int i;
+	uint32_t start, end;
+	char *s;
+
+	start = sys_sbrk(0);
+  800038:	83 ec 0c             	sub    $0xc,%esp
+  80003b:	6a 00                	push   $0x0
+  80003d:	e8 24 0d 00 00       	call   800d66 <sys_sbrk>
+  800042:	89 c3                	mov    %eax,%ebx
+	end = sys_sbrk(ALLOCATE_SIZE);
+  800044:	c7 04 24 00 10 00 00 	movl   $0x1000,(%esp)
+  80004b:	e8 16 0d 00 00       	call   800d66 <sys_sbrk>
+
+	if (end - start < ALLOCATE_SIZE) {
+  800050:	29 d8                	sub    %ebx,%eax
+  800052:	83 c4 10             	add    $0x10,%esp
+  800055:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  80005a:	76 49                	jbe    8000a5 <umain+0x72>
+		cprintf("sbrk not correctly implemented\n");
+	}
+
+	s = (char *) start;
+	for ( i = 0; i < STRING_SIZE; i++) {
+  80005c:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s[i] = 'A' + (i % 26);
+  800061:	be 4f ec c4 4e       	mov    $0x4ec4ec4f,%esi
+  800066:	89 c8                	mov    %ecx,%eax
+  800068:	f7 ee                	imul   %esi
+  80006a:	c1 fa 03             	sar    $0x3,%edx
+  80006d:	89 c8                	mov    %ecx,%eax
+  80006f:	c1 f8 1f             	sar    $0x1f,%eax
+  800072:	29 c2                	sub    %eax,%edx
+  800074:	6b d2 1a             	imul   $0x1a,%edx,%edx
+  800077:	89 c8                	mov    %ecx,%eax
+  800079:	29 d0                	sub    %edx,%eax
+  80007b:	83 c0 41             	add    $0x41,%eax
+  80007e:	88 04 19             	mov    %al,(%ecx,%ebx,1)
+	for ( i = 0; i < STRING_SIZE; i++) {
+  800081:	83 c1 01             	add    $0x1,%ecx
+  800084:	83 f9 40             	cmp    $0x40,%ecx
+  800087:	75 dd                	jne    800066 <umain+0x33>
+	}
+	s[STRING_SIZE] = '\0';
+  800089:	c6 43 40 00          	movb   $0x0,0x40(%ebx)
+
+	cprintf("SBRK_TEST(%s)\n", s);
+  80008d:	83 ec 08             	sub    $0x8,%esp
+  800090:	53                   	push   %ebx
+  800091:	68 a0 25 80 00       	push   $0x8025a0
+  800096:	e8 14 01 00 00       	call   8001af <cprintf>
+}
+  80009b:	83 c4 10             	add    $0x10,%esp
+  80009e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000a1:	5b                   	pop    %ebx
+  8000a2:	5e                   	pop    %esi
+  8000a3:	5d                   	pop    %ebp
+  8000a4:	c3                   	ret
+		cprintf("sbrk not correctly implemented\n");
+  8000a5:	83 ec 0c             	sub    $0xc,%esp
+  8000a8:	68 80 25 80 00       	push   $0x802580
+  8000ad:	e8 fd 00 00 00       	call   8001af <cprintf>
+  8000b2:	83 c4 10             	add    $0x10,%esp
+  8000b5:	eb a5                	jmp    80005c <umain+0x29>
+
+008000b7 <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  8000b7:	55                   	push   %ebp
+  8000b8:	89 e5                	mov    %esp,%ebp
+  8000ba:	56                   	push   %esi
+  8000bb:	53                   	push   %ebx
+  8000bc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000bf:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  8000c2:	e8 4f 0a 00 00       	call   800b16 <sys_getenvid>
+  8000c7:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000cc:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8000cf:	c1 e0 04             	shl    $0x4,%eax
+  8000d2:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000d7:	a3 08 40 80 00       	mov    %eax,0x804008
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8000dc:	85 db                	test   %ebx,%ebx
+  8000de:	7e 07                	jle    8000e7 <libmain+0x30>
+    binaryname = argv[0];
+  8000e0:	8b 06                	mov    (%esi),%eax
+  8000e2:	a3 00 30 80 00       	mov    %eax,0x803000
+
+  // call user main routine
+  umain(argc, argv);
+  8000e7:	83 ec 08             	sub    $0x8,%esp
+  8000ea:	56                   	push   %esi
+  8000eb:	53                   	push   %ebx
+  8000ec:	e8 42 ff ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  8000f1:	e8 0a 00 00 00       	call   800100 <exit>
+}
+  8000f6:	83 c4 10             	add    $0x10,%esp
+  8000f9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000fc:	5b                   	pop    %ebx
+  8000fd:	5e                   	pop    %esi
+  8000fe:	5d                   	pop    %ebp
+  8000ff:	c3                   	ret
+
+00800100 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800100:	55                   	push   %ebp
+  800101:	89 e5                	mov    %esp,%ebp
+  800103:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800106:	e8 f0 0e 00 00       	call   800ffb <close_all>
+	sys_env_destroy(0);
+  80010b:	83 ec 0c             	sub    $0xc,%esp
+  80010e:	6a 00                	push   $0x0
+  800110:	e8 c0 09 00 00       	call   800ad5 <sys_env_destroy>
+}
+  800115:	83 c4 10             	add    $0x10,%esp
+  800118:	c9                   	leave
+  800119:	c3                   	ret
+
+0080011a <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80011a:	55                   	push   %ebp
+  80011b:	89 e5                	mov    %esp,%ebp
+  80011d:	53                   	push   %ebx
+  80011e:	83 ec 04             	sub    $0x4,%esp
+  800121:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800124:	8b 13                	mov    (%ebx),%edx
+  800126:	8d 42 01             	lea    0x1(%edx),%eax
+  800129:	89 03                	mov    %eax,(%ebx)
+  80012b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80012e:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800132:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800137:	74 09                	je     800142 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800139:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80013d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800140:	c9                   	leave
+  800141:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800142:	83 ec 08             	sub    $0x8,%esp
+  800145:	68 ff 00 00 00       	push   $0xff
+  80014a:	8d 43 08             	lea    0x8(%ebx),%eax
+  80014d:	50                   	push   %eax
+  80014e:	e8 45 09 00 00       	call   800a98 <sys_cputs>
+		b->idx = 0;
+  800153:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800159:	83 c4 10             	add    $0x10,%esp
+  80015c:	eb db                	jmp    800139 <putch+0x1f>
+
+0080015e <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80015e:	55                   	push   %ebp
+  80015f:	89 e5                	mov    %esp,%ebp
+  800161:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800167:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80016e:	00 00 00 
+	b.cnt = 0;
+  800171:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800178:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80017b:	ff 75 0c             	push   0xc(%ebp)
+  80017e:	ff 75 08             	push   0x8(%ebp)
+  800181:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800187:	50                   	push   %eax
+  800188:	68 1a 01 80 00       	push   $0x80011a
+  80018d:	e8 14 01 00 00       	call   8002a6 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800192:	83 c4 08             	add    $0x8,%esp
+  800195:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80019b:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001a1:	50                   	push   %eax
+  8001a2:	e8 f1 08 00 00       	call   800a98 <sys_cputs>
+
+	return b.cnt;
+}
+  8001a7:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001ad:	c9                   	leave
+  8001ae:	c3                   	ret
+
+008001af <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001af:	55                   	push   %ebp
+  8001b0:	89 e5                	mov    %esp,%ebp
+  8001b2:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8001b5:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8001b8:	50                   	push   %eax
+  8001b9:	ff 75 08             	push   0x8(%ebp)
+  8001bc:	e8 9d ff ff ff       	call   80015e <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8001c1:	c9                   	leave
+  8001c2:	c3                   	ret
+
+008001c3 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8001c3:	55                   	push   %ebp
+  8001c4:	89 e5                	mov    %esp,%ebp
+  8001c6:	57                   	push   %edi
+  8001c7:	56                   	push   %esi
+  8001c8:	53                   	push   %ebx
+  8001c9:	83 ec 1c             	sub    $0x1c,%esp
+  8001cc:	89 c7                	mov    %eax,%edi
+  8001ce:	89 d6                	mov    %edx,%esi
+  8001d0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001d3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001d6:	89 d1                	mov    %edx,%ecx
+  8001d8:	89 c2                	mov    %eax,%edx
+  8001da:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001dd:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001e0:	8b 45 10             	mov    0x10(%ebp),%eax
+  8001e3:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8001e6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001e9:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8001f0:	39 c2                	cmp    %eax,%edx
+  8001f2:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8001f5:	72 3e                	jb     800235 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8001f7:	83 ec 0c             	sub    $0xc,%esp
+  8001fa:	ff 75 18             	push   0x18(%ebp)
+  8001fd:	83 eb 01             	sub    $0x1,%ebx
+  800200:	53                   	push   %ebx
+  800201:	50                   	push   %eax
+  800202:	83 ec 08             	sub    $0x8,%esp
+  800205:	ff 75 e4             	push   -0x1c(%ebp)
+  800208:	ff 75 e0             	push   -0x20(%ebp)
+  80020b:	ff 75 dc             	push   -0x24(%ebp)
+  80020e:	ff 75 d8             	push   -0x28(%ebp)
+  800211:	e8 ca 1f 00 00       	call   8021e0 <__udivdi3>
+  800216:	83 c4 18             	add    $0x18,%esp
+  800219:	52                   	push   %edx
+  80021a:	50                   	push   %eax
+  80021b:	89 f2                	mov    %esi,%edx
+  80021d:	89 f8                	mov    %edi,%eax
+  80021f:	e8 9f ff ff ff       	call   8001c3 <printnum>
+  800224:	83 c4 20             	add    $0x20,%esp
+  800227:	eb 13                	jmp    80023c <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800229:	83 ec 08             	sub    $0x8,%esp
+  80022c:	56                   	push   %esi
+  80022d:	ff 75 18             	push   0x18(%ebp)
+  800230:	ff d7                	call   *%edi
+  800232:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800235:	83 eb 01             	sub    $0x1,%ebx
+  800238:	85 db                	test   %ebx,%ebx
+  80023a:	7f ed                	jg     800229 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80023c:	83 ec 08             	sub    $0x8,%esp
+  80023f:	56                   	push   %esi
+  800240:	83 ec 04             	sub    $0x4,%esp
+  800243:	ff 75 e4             	push   -0x1c(%ebp)
+  800246:	ff 75 e0             	push   -0x20(%ebp)
+  800249:	ff 75 dc             	push   -0x24(%ebp)
+  80024c:	ff 75 d8             	push   -0x28(%ebp)
+  80024f:	e8 5c 20 00 00       	call   8022b0 <__umoddi3>
+  800254:	83 c4 14             	add    $0x14,%esp
+  800257:	0f be 80 b9 25 80 00 	movsbl 0x8025b9(%eax),%eax
+  80025e:	50                   	push   %eax
+  80025f:	ff d7                	call   *%edi
+}
+  800261:	83 c4 10             	add    $0x10,%esp
+  800264:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800267:	5b                   	pop    %ebx
+  800268:	5e                   	pop    %esi
+  800269:	5f                   	pop    %edi
+  80026a:	5d                   	pop    %ebp
+  80026b:	c3                   	ret
+
+0080026c <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80026c:	55                   	push   %ebp
+  80026d:	89 e5                	mov    %esp,%ebp
+  80026f:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800272:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800276:	8b 10                	mov    (%eax),%edx
+  800278:	3b 50 04             	cmp    0x4(%eax),%edx
+  80027b:	73 0a                	jae    800287 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80027d:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800280:	89 08                	mov    %ecx,(%eax)
+  800282:	8b 45 08             	mov    0x8(%ebp),%eax
+  800285:	88 02                	mov    %al,(%edx)
+}
+  800287:	5d                   	pop    %ebp
+  800288:	c3                   	ret
+
+00800289 <printfmt>:
+{
+  800289:	55                   	push   %ebp
+  80028a:	89 e5                	mov    %esp,%ebp
+  80028c:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80028f:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800292:	50                   	push   %eax
+  800293:	ff 75 10             	push   0x10(%ebp)
+  800296:	ff 75 0c             	push   0xc(%ebp)
+  800299:	ff 75 08             	push   0x8(%ebp)
+  80029c:	e8 05 00 00 00       	call   8002a6 <vprintfmt>
+}
+  8002a1:	83 c4 10             	add    $0x10,%esp
+  8002a4:	c9                   	leave
+  8002a5:	c3                   	ret
+
+008002a6 <vprintfmt>:
+{
+  8002a6:	55                   	push   %ebp
+  8002a7:	89 e5                	mov    %esp,%ebp
+  8002a9:	57                   	push   %edi
+  8002aa:	56                   	push   %esi
+  8002ab:	53                   	push   %ebx
+  8002ac:	83 ec 2c             	sub    $0x2c,%esp
+  8002af:	8b 75 08             	mov    0x8(%ebp),%esi
+  8002b2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8002b5:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8002b8:	eb 0a                	jmp    8002c4 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8002ba:	83 ec 08             	sub    $0x8,%esp
+  8002bd:	53                   	push   %ebx
+  8002be:	50                   	push   %eax
+  8002bf:	ff d6                	call   *%esi
+  8002c1:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8002c4:	83 c7 01             	add    $0x1,%edi
+  8002c7:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8002cb:	83 f8 25             	cmp    $0x25,%eax
+  8002ce:	74 0c                	je     8002dc <vprintfmt+0x36>
+			if (ch == '\0')
+  8002d0:	85 c0                	test   %eax,%eax
+  8002d2:	75 e6                	jne    8002ba <vprintfmt+0x14>
+}
+  8002d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002d7:	5b                   	pop    %ebx
+  8002d8:	5e                   	pop    %esi
+  8002d9:	5f                   	pop    %edi
+  8002da:	5d                   	pop    %ebp
+  8002db:	c3                   	ret
+		padc = ' ';
+  8002dc:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8002e0:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8002e7:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8002ee:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8002f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8002fa:	8d 47 01             	lea    0x1(%edi),%eax
+  8002fd:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800300:	0f b6 17             	movzbl (%edi),%edx
+  800303:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800306:	3c 55                	cmp    $0x55,%al
+  800308:	0f 87 9a 03 00 00    	ja     8006a8 <vprintfmt+0x402>
+  80030e:	0f b6 c0             	movzbl %al,%eax
+  800311:	ff 24 85 00 27 80 00 	jmp    *0x802700(,%eax,4)
+  800318:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  80031b:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80031f:	eb d9                	jmp    8002fa <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800321:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800324:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800328:	eb d0                	jmp    8002fa <vprintfmt+0x54>
+  80032a:	0f b6 d2             	movzbl %dl,%edx
+  80032d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800330:	b8 00 00 00 00       	mov    $0x0,%eax
+  800335:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800338:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80033b:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80033f:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800342:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800345:	83 f9 09             	cmp    $0x9,%ecx
+  800348:	77 55                	ja     80039f <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  80034a:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  80034d:	eb e9                	jmp    800338 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  80034f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800352:	8b 00                	mov    (%eax),%eax
+  800354:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800357:	8b 45 14             	mov    0x14(%ebp),%eax
+  80035a:	8d 40 04             	lea    0x4(%eax),%eax
+  80035d:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800360:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800363:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800367:	79 91                	jns    8002fa <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800369:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80036c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80036f:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800376:	eb 82                	jmp    8002fa <vprintfmt+0x54>
+			if (width < 0)
+  800378:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80037b:	85 d2                	test   %edx,%edx
+  80037d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800382:	0f 49 c2             	cmovns %edx,%eax
+  800385:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800388:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80038b:	e9 6a ff ff ff       	jmp    8002fa <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800390:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800393:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80039a:	e9 5b ff ff ff       	jmp    8002fa <vprintfmt+0x54>
+  80039f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003a2:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003a5:	eb bc                	jmp    800363 <vprintfmt+0xbd>
+			lflag++;
+  8003a7:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003aa:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003ad:	e9 48 ff ff ff       	jmp    8002fa <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8003b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003b5:	8d 78 04             	lea    0x4(%eax),%edi
+  8003b8:	83 ec 08             	sub    $0x8,%esp
+  8003bb:	53                   	push   %ebx
+  8003bc:	ff 30                	push   (%eax)
+  8003be:	ff d6                	call   *%esi
+			break;
+  8003c0:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8003c3:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8003c6:	e9 7c 02 00 00       	jmp    800647 <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  8003cb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003ce:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8003d1:	8b 10                	mov    (%eax),%edx
+  8003d3:	89 d0                	mov    %edx,%eax
+  8003d5:	f7 d8                	neg    %eax
+  8003d7:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8003da:	83 f8 10             	cmp    $0x10,%eax
+  8003dd:	7f 23                	jg     800402 <vprintfmt+0x15c>
+  8003df:	8b 14 85 60 28 80 00 	mov    0x802860(,%eax,4),%edx
+  8003e6:	85 d2                	test   %edx,%edx
+  8003e8:	74 18                	je     800402 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8003ea:	52                   	push   %edx
+  8003eb:	68 99 29 80 00       	push   $0x802999
+  8003f0:	53                   	push   %ebx
+  8003f1:	56                   	push   %esi
+  8003f2:	e8 92 fe ff ff       	call   800289 <printfmt>
+  8003f7:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003fa:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8003fd:	e9 45 02 00 00       	jmp    800647 <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  800402:	50                   	push   %eax
+  800403:	68 d1 25 80 00       	push   $0x8025d1
+  800408:	53                   	push   %ebx
+  800409:	56                   	push   %esi
+  80040a:	e8 7a fe ff ff       	call   800289 <printfmt>
+  80040f:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800412:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800415:	e9 2d 02 00 00       	jmp    800647 <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80041a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80041d:	83 c0 04             	add    $0x4,%eax
+  800420:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800423:	8b 45 14             	mov    0x14(%ebp),%eax
+  800426:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800428:	85 c9                	test   %ecx,%ecx
+  80042a:	b8 ca 25 80 00       	mov    $0x8025ca,%eax
+  80042f:	0f 45 c1             	cmovne %ecx,%eax
+  800432:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800435:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800439:	7e 06                	jle    800441 <vprintfmt+0x19b>
+  80043b:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80043f:	75 0b                	jne    80044c <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800441:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800444:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800447:	89 75 08             	mov    %esi,0x8(%ebp)
+  80044a:	eb 5c                	jmp    8004a8 <vprintfmt+0x202>
+  80044c:	83 ec 08             	sub    $0x8,%esp
+  80044f:	ff 75 d0             	push   -0x30(%ebp)
+  800452:	ff 75 cc             	push   -0x34(%ebp)
+  800455:	e8 eb 02 00 00       	call   800745 <strnlen>
+  80045a:	89 c2                	mov    %eax,%edx
+  80045c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80045f:	29 d0                	sub    %edx,%eax
+  800461:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800464:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800468:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80046b:	89 75 08             	mov    %esi,0x8(%ebp)
+  80046e:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800470:	eb 0e                	jmp    800480 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800472:	83 ec 08             	sub    $0x8,%esp
+  800475:	53                   	push   %ebx
+  800476:	57                   	push   %edi
+  800477:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80047a:	83 ee 01             	sub    $0x1,%esi
+  80047d:	83 c4 10             	add    $0x10,%esp
+  800480:	85 f6                	test   %esi,%esi
+  800482:	7f ee                	jg     800472 <vprintfmt+0x1cc>
+  800484:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800487:	8b 75 08             	mov    0x8(%ebp),%esi
+  80048a:	85 c0                	test   %eax,%eax
+  80048c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800491:	0f 49 d0             	cmovns %eax,%edx
+  800494:	29 d0                	sub    %edx,%eax
+  800496:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800499:	eb a6                	jmp    800441 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  80049b:	83 ec 08             	sub    $0x8,%esp
+  80049e:	53                   	push   %ebx
+  80049f:	52                   	push   %edx
+  8004a0:	ff 55 08             	call   *0x8(%ebp)
+  8004a3:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004a6:	89 f1                	mov    %esi,%ecx
+  8004a8:	8d 71 01             	lea    0x1(%ecx),%esi
+  8004ab:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004af:	0f be d0             	movsbl %al,%edx
+  8004b2:	85 d2                	test   %edx,%edx
+  8004b4:	74 28                	je     8004de <vprintfmt+0x238>
+  8004b6:	85 ff                	test   %edi,%edi
+  8004b8:	78 05                	js     8004bf <vprintfmt+0x219>
+  8004ba:	83 ef 01             	sub    $0x1,%edi
+  8004bd:	78 30                	js     8004ef <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8004bf:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8004c3:	74 d6                	je     80049b <vprintfmt+0x1f5>
+  8004c5:	0f be c0             	movsbl %al,%eax
+  8004c8:	83 e8 20             	sub    $0x20,%eax
+  8004cb:	83 f8 5e             	cmp    $0x5e,%eax
+  8004ce:	76 cb                	jbe    80049b <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8004d0:	83 ec 08             	sub    $0x8,%esp
+  8004d3:	53                   	push   %ebx
+  8004d4:	6a 3f                	push   $0x3f
+  8004d6:	ff 55 08             	call   *0x8(%ebp)
+  8004d9:	83 c4 10             	add    $0x10,%esp
+  8004dc:	eb c8                	jmp    8004a6 <vprintfmt+0x200>
+  8004de:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004e1:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8004e4:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004e7:	01 d0                	add    %edx,%eax
+  8004e9:	29 c8                	sub    %ecx,%eax
+  8004eb:	89 c7                	mov    %eax,%edi
+  8004ed:	eb 13                	jmp    800502 <vprintfmt+0x25c>
+  8004ef:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004f2:	eb ed                	jmp    8004e1 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8004f4:	83 ec 08             	sub    $0x8,%esp
+  8004f7:	53                   	push   %ebx
+  8004f8:	6a 20                	push   $0x20
+  8004fa:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8004fc:	83 ef 01             	sub    $0x1,%edi
+  8004ff:	83 c4 10             	add    $0x10,%esp
+  800502:	85 ff                	test   %edi,%edi
+  800504:	7f ee                	jg     8004f4 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800506:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800509:	89 45 14             	mov    %eax,0x14(%ebp)
+  80050c:	e9 36 01 00 00       	jmp    800647 <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  800511:	83 f9 01             	cmp    $0x1,%ecx
+  800514:	7f 1f                	jg     800535 <vprintfmt+0x28f>
+	else if (lflag)
+  800516:	85 c9                	test   %ecx,%ecx
+  800518:	74 67                	je     800581 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  80051a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80051d:	8b 00                	mov    (%eax),%eax
+  80051f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800522:	89 c1                	mov    %eax,%ecx
+  800524:	c1 f9 1f             	sar    $0x1f,%ecx
+  800527:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80052a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80052d:	8d 40 04             	lea    0x4(%eax),%eax
+  800530:	89 45 14             	mov    %eax,0x14(%ebp)
+  800533:	eb 17                	jmp    80054c <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800535:	8b 45 14             	mov    0x14(%ebp),%eax
+  800538:	8b 50 04             	mov    0x4(%eax),%edx
+  80053b:	8b 00                	mov    (%eax),%eax
+  80053d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800540:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800543:	8b 45 14             	mov    0x14(%ebp),%eax
+  800546:	8d 40 08             	lea    0x8(%eax),%eax
+  800549:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80054c:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80054f:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800552:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800557:	85 c9                	test   %ecx,%ecx
+  800559:	0f 89 ce 00 00 00    	jns    80062d <vprintfmt+0x387>
+				putch('-', putdat);
+  80055f:	83 ec 08             	sub    $0x8,%esp
+  800562:	53                   	push   %ebx
+  800563:	6a 2d                	push   $0x2d
+  800565:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800567:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80056a:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80056d:	f7 da                	neg    %edx
+  80056f:	83 d1 00             	adc    $0x0,%ecx
+  800572:	f7 d9                	neg    %ecx
+  800574:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800577:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80057c:	e9 ac 00 00 00       	jmp    80062d <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  800581:	8b 45 14             	mov    0x14(%ebp),%eax
+  800584:	8b 00                	mov    (%eax),%eax
+  800586:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800589:	89 c1                	mov    %eax,%ecx
+  80058b:	c1 f9 1f             	sar    $0x1f,%ecx
+  80058e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800591:	8b 45 14             	mov    0x14(%ebp),%eax
+  800594:	8d 40 04             	lea    0x4(%eax),%eax
+  800597:	89 45 14             	mov    %eax,0x14(%ebp)
+  80059a:	eb b0                	jmp    80054c <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  80059c:	83 f9 01             	cmp    $0x1,%ecx
+  80059f:	7f 1b                	jg     8005bc <vprintfmt+0x316>
+	else if (lflag)
+  8005a1:	85 c9                	test   %ecx,%ecx
+  8005a3:	74 2c                	je     8005d1 <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  8005a5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a8:	8b 10                	mov    (%eax),%edx
+  8005aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005af:	8d 40 04             	lea    0x4(%eax),%eax
+  8005b2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005b5:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8005ba:	eb 71                	jmp    80062d <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  8005bc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005bf:	8b 10                	mov    (%eax),%edx
+  8005c1:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005c4:	8d 40 08             	lea    0x8(%eax),%eax
+  8005c7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005ca:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8005cf:	eb 5c                	jmp    80062d <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  8005d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d4:	8b 10                	mov    (%eax),%edx
+  8005d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005db:	8d 40 04             	lea    0x4(%eax),%eax
+  8005de:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005e1:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8005e6:	eb 45                	jmp    80062d <vprintfmt+0x387>
+			putch('X', putdat);
+  8005e8:	83 ec 08             	sub    $0x8,%esp
+  8005eb:	53                   	push   %ebx
+  8005ec:	6a 58                	push   $0x58
+  8005ee:	ff d6                	call   *%esi
+			putch('X', putdat);
+  8005f0:	83 c4 08             	add    $0x8,%esp
+  8005f3:	53                   	push   %ebx
+  8005f4:	6a 58                	push   $0x58
+  8005f6:	ff d6                	call   *%esi
+			putch('X', putdat);
+  8005f8:	83 c4 08             	add    $0x8,%esp
+  8005fb:	53                   	push   %ebx
+  8005fc:	6a 58                	push   $0x58
+  8005fe:	ff d6                	call   *%esi
+			break;
+  800600:	83 c4 10             	add    $0x10,%esp
+  800603:	eb 42                	jmp    800647 <vprintfmt+0x3a1>
+			putch('0', putdat);
+  800605:	83 ec 08             	sub    $0x8,%esp
+  800608:	53                   	push   %ebx
+  800609:	6a 30                	push   $0x30
+  80060b:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80060d:	83 c4 08             	add    $0x8,%esp
+  800610:	53                   	push   %ebx
+  800611:	6a 78                	push   $0x78
+  800613:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800615:	8b 45 14             	mov    0x14(%ebp),%eax
+  800618:	8b 10                	mov    (%eax),%edx
+  80061a:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80061f:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800622:	8d 40 04             	lea    0x4(%eax),%eax
+  800625:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800628:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80062d:	83 ec 0c             	sub    $0xc,%esp
+  800630:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800634:	50                   	push   %eax
+  800635:	ff 75 e0             	push   -0x20(%ebp)
+  800638:	57                   	push   %edi
+  800639:	51                   	push   %ecx
+  80063a:	52                   	push   %edx
+  80063b:	89 da                	mov    %ebx,%edx
+  80063d:	89 f0                	mov    %esi,%eax
+  80063f:	e8 7f fb ff ff       	call   8001c3 <printnum>
+			break;
+  800644:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800647:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80064a:	e9 75 fc ff ff       	jmp    8002c4 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  80064f:	83 f9 01             	cmp    $0x1,%ecx
+  800652:	7f 1b                	jg     80066f <vprintfmt+0x3c9>
+	else if (lflag)
+  800654:	85 c9                	test   %ecx,%ecx
+  800656:	74 2c                	je     800684 <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  800658:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065b:	8b 10                	mov    (%eax),%edx
+  80065d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800662:	8d 40 04             	lea    0x4(%eax),%eax
+  800665:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800668:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  80066d:	eb be                	jmp    80062d <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  80066f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800672:	8b 10                	mov    (%eax),%edx
+  800674:	8b 48 04             	mov    0x4(%eax),%ecx
+  800677:	8d 40 08             	lea    0x8(%eax),%eax
+  80067a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80067d:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800682:	eb a9                	jmp    80062d <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  800684:	8b 45 14             	mov    0x14(%ebp),%eax
+  800687:	8b 10                	mov    (%eax),%edx
+  800689:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80068e:	8d 40 04             	lea    0x4(%eax),%eax
+  800691:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800694:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800699:	eb 92                	jmp    80062d <vprintfmt+0x387>
+			putch(ch, putdat);
+  80069b:	83 ec 08             	sub    $0x8,%esp
+  80069e:	53                   	push   %ebx
+  80069f:	6a 25                	push   $0x25
+  8006a1:	ff d6                	call   *%esi
+			break;
+  8006a3:	83 c4 10             	add    $0x10,%esp
+  8006a6:	eb 9f                	jmp    800647 <vprintfmt+0x3a1>
+			putch('%', putdat);
+  8006a8:	83 ec 08             	sub    $0x8,%esp
+  8006ab:	53                   	push   %ebx
+  8006ac:	6a 25                	push   $0x25
+  8006ae:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8006b0:	83 c4 10             	add    $0x10,%esp
+  8006b3:	89 f8                	mov    %edi,%eax
+  8006b5:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8006b9:	74 05                	je     8006c0 <vprintfmt+0x41a>
+  8006bb:	83 e8 01             	sub    $0x1,%eax
+  8006be:	eb f5                	jmp    8006b5 <vprintfmt+0x40f>
+  8006c0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8006c3:	eb 82                	jmp    800647 <vprintfmt+0x3a1>
+
+008006c5 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8006c5:	55                   	push   %ebp
+  8006c6:	89 e5                	mov    %esp,%ebp
+  8006c8:	83 ec 18             	sub    $0x18,%esp
+  8006cb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006ce:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8006d1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8006d4:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8006d8:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8006db:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8006e2:	85 c0                	test   %eax,%eax
+  8006e4:	74 26                	je     80070c <vsnprintf+0x47>
+  8006e6:	85 d2                	test   %edx,%edx
+  8006e8:	7e 22                	jle    80070c <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8006ea:	ff 75 14             	push   0x14(%ebp)
+  8006ed:	ff 75 10             	push   0x10(%ebp)
+  8006f0:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8006f3:	50                   	push   %eax
+  8006f4:	68 6c 02 80 00       	push   $0x80026c
+  8006f9:	e8 a8 fb ff ff       	call   8002a6 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8006fe:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800701:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800704:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800707:	83 c4 10             	add    $0x10,%esp
+}
+  80070a:	c9                   	leave
+  80070b:	c3                   	ret
+		return -E_INVAL;
+  80070c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800711:	eb f7                	jmp    80070a <vsnprintf+0x45>
+
+00800713 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800713:	55                   	push   %ebp
+  800714:	89 e5                	mov    %esp,%ebp
+  800716:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800719:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80071c:	50                   	push   %eax
+  80071d:	ff 75 10             	push   0x10(%ebp)
+  800720:	ff 75 0c             	push   0xc(%ebp)
+  800723:	ff 75 08             	push   0x8(%ebp)
+  800726:	e8 9a ff ff ff       	call   8006c5 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80072b:	c9                   	leave
+  80072c:	c3                   	ret
+
+0080072d <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80072d:	55                   	push   %ebp
+  80072e:	89 e5                	mov    %esp,%ebp
+  800730:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800733:	b8 00 00 00 00       	mov    $0x0,%eax
+  800738:	eb 03                	jmp    80073d <strlen+0x10>
+		n++;
+  80073a:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80073d:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800741:	75 f7                	jne    80073a <strlen+0xd>
+	return n;
+}
+  800743:	5d                   	pop    %ebp
+  800744:	c3                   	ret
+
+00800745 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800745:	55                   	push   %ebp
+  800746:	89 e5                	mov    %esp,%ebp
+  800748:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80074b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80074e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800753:	eb 03                	jmp    800758 <strnlen+0x13>
+		n++;
+  800755:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800758:	39 d0                	cmp    %edx,%eax
+  80075a:	74 08                	je     800764 <strnlen+0x1f>
+  80075c:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800760:	75 f3                	jne    800755 <strnlen+0x10>
+  800762:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800764:	89 d0                	mov    %edx,%eax
+  800766:	5d                   	pop    %ebp
+  800767:	c3                   	ret
+
+00800768 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800768:	55                   	push   %ebp
+  800769:	89 e5                	mov    %esp,%ebp
+  80076b:	53                   	push   %ebx
+  80076c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80076f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800772:	b8 00 00 00 00       	mov    $0x0,%eax
+  800777:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80077b:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80077e:	83 c0 01             	add    $0x1,%eax
+  800781:	84 d2                	test   %dl,%dl
+  800783:	75 f2                	jne    800777 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800785:	89 c8                	mov    %ecx,%eax
+  800787:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80078a:	c9                   	leave
+  80078b:	c3                   	ret
+
+0080078c <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80078c:	55                   	push   %ebp
+  80078d:	89 e5                	mov    %esp,%ebp
+  80078f:	53                   	push   %ebx
+  800790:	83 ec 10             	sub    $0x10,%esp
+  800793:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800796:	53                   	push   %ebx
+  800797:	e8 91 ff ff ff       	call   80072d <strlen>
+  80079c:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80079f:	ff 75 0c             	push   0xc(%ebp)
+  8007a2:	01 d8                	add    %ebx,%eax
+  8007a4:	50                   	push   %eax
+  8007a5:	e8 be ff ff ff       	call   800768 <strcpy>
+	return dst;
+}
+  8007aa:	89 d8                	mov    %ebx,%eax
+  8007ac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007af:	c9                   	leave
+  8007b0:	c3                   	ret
+
+008007b1 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8007b1:	55                   	push   %ebp
+  8007b2:	89 e5                	mov    %esp,%ebp
+  8007b4:	56                   	push   %esi
+  8007b5:	53                   	push   %ebx
+  8007b6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007b9:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8007bc:	89 f3                	mov    %esi,%ebx
+  8007be:	03 5d 10             	add    0x10(%ebp),%ebx
+  8007c1:	89 f0                	mov    %esi,%eax
+  8007c3:	eb 0f                	jmp    8007d4 <strncpy+0x23>
+		*dst++ = *src;
+  8007c5:	83 c0 01             	add    $0x1,%eax
+  8007c8:	0f b6 0a             	movzbl (%edx),%ecx
+  8007cb:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8007ce:	80 f9 01             	cmp    $0x1,%cl
+  8007d1:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8007d4:	39 d8                	cmp    %ebx,%eax
+  8007d6:	75 ed                	jne    8007c5 <strncpy+0x14>
+	}
+	return ret;
+}
+  8007d8:	89 f0                	mov    %esi,%eax
+  8007da:	5b                   	pop    %ebx
+  8007db:	5e                   	pop    %esi
+  8007dc:	5d                   	pop    %ebp
+  8007dd:	c3                   	ret
+
+008007de <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8007de:	55                   	push   %ebp
+  8007df:	89 e5                	mov    %esp,%ebp
+  8007e1:	56                   	push   %esi
+  8007e2:	53                   	push   %ebx
+  8007e3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007e9:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8007ec:	89 f0                	mov    %esi,%eax
+  8007ee:	85 d2                	test   %edx,%edx
+  8007f0:	74 21                	je     800813 <strlcpy+0x35>
+  8007f2:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8007f6:	89 f2                	mov    %esi,%edx
+  8007f8:	eb 09                	jmp    800803 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8007fa:	83 c1 01             	add    $0x1,%ecx
+  8007fd:	83 c2 01             	add    $0x1,%edx
+  800800:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800803:	39 c2                	cmp    %eax,%edx
+  800805:	74 09                	je     800810 <strlcpy+0x32>
+  800807:	0f b6 19             	movzbl (%ecx),%ebx
+  80080a:	84 db                	test   %bl,%bl
+  80080c:	75 ec                	jne    8007fa <strlcpy+0x1c>
+  80080e:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800810:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800813:	29 f0                	sub    %esi,%eax
+}
+  800815:	5b                   	pop    %ebx
+  800816:	5e                   	pop    %esi
+  800817:	5d                   	pop    %ebp
+  800818:	c3                   	ret
+
+00800819 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800819:	55                   	push   %ebp
+  80081a:	89 e5                	mov    %esp,%ebp
+  80081c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80081f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800822:	eb 06                	jmp    80082a <strcmp+0x11>
+		p++, q++;
+  800824:	83 c1 01             	add    $0x1,%ecx
+  800827:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  80082a:	0f b6 01             	movzbl (%ecx),%eax
+  80082d:	84 c0                	test   %al,%al
+  80082f:	74 04                	je     800835 <strcmp+0x1c>
+  800831:	3a 02                	cmp    (%edx),%al
+  800833:	74 ef                	je     800824 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800835:	0f b6 c0             	movzbl %al,%eax
+  800838:	0f b6 12             	movzbl (%edx),%edx
+  80083b:	29 d0                	sub    %edx,%eax
+}
+  80083d:	5d                   	pop    %ebp
+  80083e:	c3                   	ret
+
+0080083f <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80083f:	55                   	push   %ebp
+  800840:	89 e5                	mov    %esp,%ebp
+  800842:	53                   	push   %ebx
+  800843:	8b 45 08             	mov    0x8(%ebp),%eax
+  800846:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800849:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80084c:	eb 09                	jmp    800857 <strncmp+0x18>
+		n--, p++, q++;
+  80084e:	83 ea 01             	sub    $0x1,%edx
+  800851:	83 c0 01             	add    $0x1,%eax
+  800854:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800857:	85 d2                	test   %edx,%edx
+  800859:	74 18                	je     800873 <strncmp+0x34>
+  80085b:	0f b6 18             	movzbl (%eax),%ebx
+  80085e:	84 db                	test   %bl,%bl
+  800860:	74 04                	je     800866 <strncmp+0x27>
+  800862:	3a 19                	cmp    (%ecx),%bl
+  800864:	74 e8                	je     80084e <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800866:	0f b6 00             	movzbl (%eax),%eax
+  800869:	0f b6 11             	movzbl (%ecx),%edx
+  80086c:	29 d0                	sub    %edx,%eax
+}
+  80086e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800871:	c9                   	leave
+  800872:	c3                   	ret
+		return 0;
+  800873:	b8 00 00 00 00       	mov    $0x0,%eax
+  800878:	eb f4                	jmp    80086e <strncmp+0x2f>
+
+0080087a <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80087a:	55                   	push   %ebp
+  80087b:	89 e5                	mov    %esp,%ebp
+  80087d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800880:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800884:	eb 03                	jmp    800889 <strchr+0xf>
+  800886:	83 c0 01             	add    $0x1,%eax
+  800889:	0f b6 10             	movzbl (%eax),%edx
+  80088c:	84 d2                	test   %dl,%dl
+  80088e:	74 06                	je     800896 <strchr+0x1c>
+		if (*s == c)
+  800890:	38 ca                	cmp    %cl,%dl
+  800892:	75 f2                	jne    800886 <strchr+0xc>
+  800894:	eb 05                	jmp    80089b <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800896:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80089b:	5d                   	pop    %ebp
+  80089c:	c3                   	ret
+
+0080089d <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80089d:	55                   	push   %ebp
+  80089e:	89 e5                	mov    %esp,%ebp
+  8008a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008a3:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008a7:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8008aa:	38 ca                	cmp    %cl,%dl
+  8008ac:	74 09                	je     8008b7 <strfind+0x1a>
+  8008ae:	84 d2                	test   %dl,%dl
+  8008b0:	74 05                	je     8008b7 <strfind+0x1a>
+	for (; *s; s++)
+  8008b2:	83 c0 01             	add    $0x1,%eax
+  8008b5:	eb f0                	jmp    8008a7 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8008b7:	5d                   	pop    %ebp
+  8008b8:	c3                   	ret
+
+008008b9 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8008b9:	55                   	push   %ebp
+  8008ba:	89 e5                	mov    %esp,%ebp
+  8008bc:	57                   	push   %edi
+  8008bd:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8008c0:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8008c3:	85 c9                	test   %ecx,%ecx
+  8008c5:	74 20                	je     8008e7 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8008c7:	89 f8                	mov    %edi,%eax
+  8008c9:	09 c8                	or     %ecx,%eax
+  8008cb:	a8 03                	test   $0x3,%al
+  8008cd:	75 12                	jne    8008e1 <memset+0x28>
+		c &= 0xFF;
+  8008cf:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8008d3:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8008d9:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8008dc:	fc                   	cld
+  8008dd:	f3 ab                	rep stos %eax,%es:(%edi)
+  8008df:	eb 06                	jmp    8008e7 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8008e1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8008e4:	fc                   	cld
+  8008e5:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8008e7:	89 f8                	mov    %edi,%eax
+  8008e9:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8008ec:	c9                   	leave
+  8008ed:	c3                   	ret
+
+008008ee <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8008ee:	55                   	push   %ebp
+  8008ef:	89 e5                	mov    %esp,%ebp
+  8008f1:	57                   	push   %edi
+  8008f2:	56                   	push   %esi
+  8008f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008f6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8008f9:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8008fc:	39 c6                	cmp    %eax,%esi
+  8008fe:	73 32                	jae    800932 <memmove+0x44>
+  800900:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800903:	39 d0                	cmp    %edx,%eax
+  800905:	73 2b                	jae    800932 <memmove+0x44>
+		s += n;
+		d += n;
+  800907:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80090a:	89 d6                	mov    %edx,%esi
+  80090c:	09 fe                	or     %edi,%esi
+  80090e:	09 ce                	or     %ecx,%esi
+  800910:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800916:	75 0e                	jne    800926 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800918:	83 ef 04             	sub    $0x4,%edi
+  80091b:	8d 72 fc             	lea    -0x4(%edx),%esi
+  80091e:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800921:	fd                   	std
+  800922:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800924:	eb 09                	jmp    80092f <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800926:	83 ef 01             	sub    $0x1,%edi
+  800929:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  80092c:	fd                   	std
+  80092d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  80092f:	fc                   	cld
+  800930:	eb 1a                	jmp    80094c <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800932:	89 f2                	mov    %esi,%edx
+  800934:	09 c2                	or     %eax,%edx
+  800936:	09 ca                	or     %ecx,%edx
+  800938:	f6 c2 03             	test   $0x3,%dl
+  80093b:	75 0a                	jne    800947 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  80093d:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800940:	89 c7                	mov    %eax,%edi
+  800942:	fc                   	cld
+  800943:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800945:	eb 05                	jmp    80094c <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800947:	89 c7                	mov    %eax,%edi
+  800949:	fc                   	cld
+  80094a:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  80094c:	5e                   	pop    %esi
+  80094d:	5f                   	pop    %edi
+  80094e:	5d                   	pop    %ebp
+  80094f:	c3                   	ret
+
+00800950 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800950:	55                   	push   %ebp
+  800951:	89 e5                	mov    %esp,%ebp
+  800953:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800956:	ff 75 10             	push   0x10(%ebp)
+  800959:	ff 75 0c             	push   0xc(%ebp)
+  80095c:	ff 75 08             	push   0x8(%ebp)
+  80095f:	e8 8a ff ff ff       	call   8008ee <memmove>
+}
+  800964:	c9                   	leave
+  800965:	c3                   	ret
+
+00800966 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800966:	55                   	push   %ebp
+  800967:	89 e5                	mov    %esp,%ebp
+  800969:	56                   	push   %esi
+  80096a:	53                   	push   %ebx
+  80096b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80096e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800971:	89 c6                	mov    %eax,%esi
+  800973:	03 75 10             	add    0x10(%ebp),%esi
+  800976:	eb 06                	jmp    80097e <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800978:	83 c0 01             	add    $0x1,%eax
+  80097b:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  80097e:	39 f0                	cmp    %esi,%eax
+  800980:	74 14                	je     800996 <memcmp+0x30>
+		if (*s1 != *s2)
+  800982:	0f b6 08             	movzbl (%eax),%ecx
+  800985:	0f b6 1a             	movzbl (%edx),%ebx
+  800988:	38 d9                	cmp    %bl,%cl
+  80098a:	74 ec                	je     800978 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  80098c:	0f b6 c1             	movzbl %cl,%eax
+  80098f:	0f b6 db             	movzbl %bl,%ebx
+  800992:	29 d8                	sub    %ebx,%eax
+  800994:	eb 05                	jmp    80099b <memcmp+0x35>
+	}
+
+	return 0;
+  800996:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80099b:	5b                   	pop    %ebx
+  80099c:	5e                   	pop    %esi
+  80099d:	5d                   	pop    %ebp
+  80099e:	c3                   	ret
+
+0080099f <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  80099f:	55                   	push   %ebp
+  8009a0:	89 e5                	mov    %esp,%ebp
+  8009a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009a5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8009a8:	89 c2                	mov    %eax,%edx
+  8009aa:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8009ad:	eb 03                	jmp    8009b2 <memfind+0x13>
+  8009af:	83 c0 01             	add    $0x1,%eax
+  8009b2:	39 d0                	cmp    %edx,%eax
+  8009b4:	73 04                	jae    8009ba <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8009b6:	38 08                	cmp    %cl,(%eax)
+  8009b8:	75 f5                	jne    8009af <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8009ba:	5d                   	pop    %ebp
+  8009bb:	c3                   	ret
+
+008009bc <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8009bc:	55                   	push   %ebp
+  8009bd:	89 e5                	mov    %esp,%ebp
+  8009bf:	57                   	push   %edi
+  8009c0:	56                   	push   %esi
+  8009c1:	53                   	push   %ebx
+  8009c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009c5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8009c8:	eb 03                	jmp    8009cd <strtol+0x11>
+		s++;
+  8009ca:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  8009cd:	0f b6 02             	movzbl (%edx),%eax
+  8009d0:	3c 20                	cmp    $0x20,%al
+  8009d2:	74 f6                	je     8009ca <strtol+0xe>
+  8009d4:	3c 09                	cmp    $0x9,%al
+  8009d6:	74 f2                	je     8009ca <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8009d8:	3c 2b                	cmp    $0x2b,%al
+  8009da:	74 2a                	je     800a06 <strtol+0x4a>
+	int neg = 0;
+  8009dc:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8009e1:	3c 2d                	cmp    $0x2d,%al
+  8009e3:	74 2b                	je     800a10 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009e5:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8009eb:	75 0f                	jne    8009fc <strtol+0x40>
+  8009ed:	80 3a 30             	cmpb   $0x30,(%edx)
+  8009f0:	74 28                	je     800a1a <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8009f2:	85 db                	test   %ebx,%ebx
+  8009f4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8009f9:	0f 44 d8             	cmove  %eax,%ebx
+  8009fc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a01:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a04:	eb 46                	jmp    800a4c <strtol+0x90>
+		s++;
+  800a06:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a09:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a0e:	eb d5                	jmp    8009e5 <strtol+0x29>
+		s++, neg = 1;
+  800a10:	83 c2 01             	add    $0x1,%edx
+  800a13:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a18:	eb cb                	jmp    8009e5 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a1a:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a1e:	74 0e                	je     800a2e <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a20:	85 db                	test   %ebx,%ebx
+  800a22:	75 d8                	jne    8009fc <strtol+0x40>
+		s++, base = 8;
+  800a24:	83 c2 01             	add    $0x1,%edx
+  800a27:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a2c:	eb ce                	jmp    8009fc <strtol+0x40>
+		s += 2, base = 16;
+  800a2e:	83 c2 02             	add    $0x2,%edx
+  800a31:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a36:	eb c4                	jmp    8009fc <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a38:	0f be c0             	movsbl %al,%eax
+  800a3b:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a3e:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a41:	7d 3a                	jge    800a7d <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a43:	83 c2 01             	add    $0x1,%edx
+  800a46:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a4a:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a4c:	0f b6 02             	movzbl (%edx),%eax
+  800a4f:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a52:	89 f3                	mov    %esi,%ebx
+  800a54:	80 fb 09             	cmp    $0x9,%bl
+  800a57:	76 df                	jbe    800a38 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a59:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a5c:	89 f3                	mov    %esi,%ebx
+  800a5e:	80 fb 19             	cmp    $0x19,%bl
+  800a61:	77 08                	ja     800a6b <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800a63:	0f be c0             	movsbl %al,%eax
+  800a66:	83 e8 57             	sub    $0x57,%eax
+  800a69:	eb d3                	jmp    800a3e <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800a6b:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800a6e:	89 f3                	mov    %esi,%ebx
+  800a70:	80 fb 19             	cmp    $0x19,%bl
+  800a73:	77 08                	ja     800a7d <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800a75:	0f be c0             	movsbl %al,%eax
+  800a78:	83 e8 37             	sub    $0x37,%eax
+  800a7b:	eb c1                	jmp    800a3e <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800a7d:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800a81:	74 05                	je     800a88 <strtol+0xcc>
+		*endptr = (char *) s;
+  800a83:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a86:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800a88:	89 c8                	mov    %ecx,%eax
+  800a8a:	f7 d8                	neg    %eax
+  800a8c:	85 ff                	test   %edi,%edi
+  800a8e:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800a91:	89 c8                	mov    %ecx,%eax
+  800a93:	5b                   	pop    %ebx
+  800a94:	5e                   	pop    %esi
+  800a95:	5f                   	pop    %edi
+  800a96:	5d                   	pop    %ebp
+  800a97:	c3                   	ret
+
+00800a98 <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800a98:	55                   	push   %ebp
+  800a99:	89 e5                	mov    %esp,%ebp
+  800a9b:	57                   	push   %edi
+  800a9c:	56                   	push   %esi
+  800a9d:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800a9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aa3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800aa6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800aa9:	89 c3                	mov    %eax,%ebx
+  800aab:	89 c7                	mov    %eax,%edi
+  800aad:	89 c6                	mov    %eax,%esi
+  800aaf:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  800ab1:	5b                   	pop    %ebx
+  800ab2:	5e                   	pop    %esi
+  800ab3:	5f                   	pop    %edi
+  800ab4:	5d                   	pop    %ebp
+  800ab5:	c3                   	ret
+
+00800ab6 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800ab6:	55                   	push   %ebp
+  800ab7:	89 e5                	mov    %esp,%ebp
+  800ab9:	57                   	push   %edi
+  800aba:	56                   	push   %esi
+  800abb:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800abc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ac1:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ac6:	89 d1                	mov    %edx,%ecx
+  800ac8:	89 d3                	mov    %edx,%ebx
+  800aca:	89 d7                	mov    %edx,%edi
+  800acc:	89 d6                	mov    %edx,%esi
+  800ace:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800ad0:	5b                   	pop    %ebx
+  800ad1:	5e                   	pop    %esi
+  800ad2:	5f                   	pop    %edi
+  800ad3:	5d                   	pop    %ebp
+  800ad4:	c3                   	ret
+
+00800ad5 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800ad5:	55                   	push   %ebp
+  800ad6:	89 e5                	mov    %esp,%ebp
+  800ad8:	57                   	push   %edi
+  800ad9:	56                   	push   %esi
+  800ada:	53                   	push   %ebx
+  800adb:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800ade:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ae3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ae6:	b8 03 00 00 00       	mov    $0x3,%eax
+  800aeb:	89 cb                	mov    %ecx,%ebx
+  800aed:	89 cf                	mov    %ecx,%edi
+  800aef:	89 ce                	mov    %ecx,%esi
+  800af1:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800af3:	85 c0                	test   %eax,%eax
+  800af5:	7f 08                	jg     800aff <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800af7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800afa:	5b                   	pop    %ebx
+  800afb:	5e                   	pop    %esi
+  800afc:	5f                   	pop    %edi
+  800afd:	5d                   	pop    %ebp
+  800afe:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800aff:	83 ec 0c             	sub    $0xc,%esp
+  800b02:	50                   	push   %eax
+  800b03:	6a 03                	push   $0x3
+  800b05:	68 c3 28 80 00       	push   $0x8028c3
+  800b0a:	6a 3e                	push   $0x3e
+  800b0c:	68 e0 28 80 00       	push   $0x8028e0
+  800b11:	e8 22 14 00 00       	call   801f38 <_panic>
+
+00800b16 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800b16:	55                   	push   %ebp
+  800b17:	89 e5                	mov    %esp,%ebp
+  800b19:	57                   	push   %edi
+  800b1a:	56                   	push   %esi
+  800b1b:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800b1c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b21:	b8 02 00 00 00       	mov    $0x2,%eax
+  800b26:	89 d1                	mov    %edx,%ecx
+  800b28:	89 d3                	mov    %edx,%ebx
+  800b2a:	89 d7                	mov    %edx,%edi
+  800b2c:	89 d6                	mov    %edx,%esi
+  800b2e:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800b30:	5b                   	pop    %ebx
+  800b31:	5e                   	pop    %esi
+  800b32:	5f                   	pop    %edi
+  800b33:	5d                   	pop    %ebp
+  800b34:	c3                   	ret
+
+00800b35 <sys_yield>:
+
+void
+sys_yield(void) {
+  800b35:	55                   	push   %ebp
+  800b36:	89 e5                	mov    %esp,%ebp
+  800b38:	57                   	push   %edi
+  800b39:	56                   	push   %esi
+  800b3a:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800b3b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b40:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800b45:	89 d1                	mov    %edx,%ecx
+  800b47:	89 d3                	mov    %edx,%ebx
+  800b49:	89 d7                	mov    %edx,%edi
+  800b4b:	89 d6                	mov    %edx,%esi
+  800b4d:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800b4f:	5b                   	pop    %ebx
+  800b50:	5e                   	pop    %esi
+  800b51:	5f                   	pop    %edi
+  800b52:	5d                   	pop    %ebp
+  800b53:	c3                   	ret
+
+00800b54 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  800b54:	55                   	push   %ebp
+  800b55:	89 e5                	mov    %esp,%ebp
+  800b57:	57                   	push   %edi
+  800b58:	56                   	push   %esi
+  800b59:	53                   	push   %ebx
+  800b5a:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800b5d:	be 00 00 00 00       	mov    $0x0,%esi
+  800b62:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b65:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b68:	b8 04 00 00 00       	mov    $0x4,%eax
+  800b6d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b70:	89 f7                	mov    %esi,%edi
+  800b72:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800b74:	85 c0                	test   %eax,%eax
+  800b76:	7f 08                	jg     800b80 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800b78:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b7b:	5b                   	pop    %ebx
+  800b7c:	5e                   	pop    %esi
+  800b7d:	5f                   	pop    %edi
+  800b7e:	5d                   	pop    %ebp
+  800b7f:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800b80:	83 ec 0c             	sub    $0xc,%esp
+  800b83:	50                   	push   %eax
+  800b84:	6a 04                	push   $0x4
+  800b86:	68 c3 28 80 00       	push   $0x8028c3
+  800b8b:	6a 3e                	push   $0x3e
+  800b8d:	68 e0 28 80 00       	push   $0x8028e0
+  800b92:	e8 a1 13 00 00       	call   801f38 <_panic>
+
+00800b97 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  800b97:	55                   	push   %ebp
+  800b98:	89 e5                	mov    %esp,%ebp
+  800b9a:	57                   	push   %edi
+  800b9b:	56                   	push   %esi
+  800b9c:	53                   	push   %ebx
+  800b9d:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800ba0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ba3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ba6:	b8 05 00 00 00       	mov    $0x5,%eax
+  800bab:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bae:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800bb1:	8b 75 18             	mov    0x18(%ebp),%esi
+  800bb4:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800bb6:	85 c0                	test   %eax,%eax
+  800bb8:	7f 08                	jg     800bc2 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800bba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bbd:	5b                   	pop    %ebx
+  800bbe:	5e                   	pop    %esi
+  800bbf:	5f                   	pop    %edi
+  800bc0:	5d                   	pop    %ebp
+  800bc1:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800bc2:	83 ec 0c             	sub    $0xc,%esp
+  800bc5:	50                   	push   %eax
+  800bc6:	6a 05                	push   $0x5
+  800bc8:	68 c3 28 80 00       	push   $0x8028c3
+  800bcd:	6a 3e                	push   $0x3e
+  800bcf:	68 e0 28 80 00       	push   $0x8028e0
+  800bd4:	e8 5f 13 00 00       	call   801f38 <_panic>
+
+00800bd9 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  800bd9:	55                   	push   %ebp
+  800bda:	89 e5                	mov    %esp,%ebp
+  800bdc:	57                   	push   %edi
+  800bdd:	56                   	push   %esi
+  800bde:	53                   	push   %ebx
+  800bdf:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800be2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800be7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bed:	b8 06 00 00 00       	mov    $0x6,%eax
+  800bf2:	89 df                	mov    %ebx,%edi
+  800bf4:	89 de                	mov    %ebx,%esi
+  800bf6:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800bf8:	85 c0                	test   %eax,%eax
+  800bfa:	7f 08                	jg     800c04 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800bfc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bff:	5b                   	pop    %ebx
+  800c00:	5e                   	pop    %esi
+  800c01:	5f                   	pop    %edi
+  800c02:	5d                   	pop    %ebp
+  800c03:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c04:	83 ec 0c             	sub    $0xc,%esp
+  800c07:	50                   	push   %eax
+  800c08:	6a 06                	push   $0x6
+  800c0a:	68 c3 28 80 00       	push   $0x8028c3
+  800c0f:	6a 3e                	push   $0x3e
+  800c11:	68 e0 28 80 00       	push   $0x8028e0
+  800c16:	e8 1d 13 00 00       	call   801f38 <_panic>
+
+00800c1b <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800c1b:	55                   	push   %ebp
+  800c1c:	89 e5                	mov    %esp,%ebp
+  800c1e:	57                   	push   %edi
+  800c1f:	56                   	push   %esi
+  800c20:	53                   	push   %ebx
+  800c21:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c24:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c29:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c2c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c2f:	b8 08 00 00 00       	mov    $0x8,%eax
+  800c34:	89 df                	mov    %ebx,%edi
+  800c36:	89 de                	mov    %ebx,%esi
+  800c38:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c3a:	85 c0                	test   %eax,%eax
+  800c3c:	7f 08                	jg     800c46 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800c3e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c41:	5b                   	pop    %ebx
+  800c42:	5e                   	pop    %esi
+  800c43:	5f                   	pop    %edi
+  800c44:	5d                   	pop    %ebp
+  800c45:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c46:	83 ec 0c             	sub    $0xc,%esp
+  800c49:	50                   	push   %eax
+  800c4a:	6a 08                	push   $0x8
+  800c4c:	68 c3 28 80 00       	push   $0x8028c3
+  800c51:	6a 3e                	push   $0x3e
+  800c53:	68 e0 28 80 00       	push   $0x8028e0
+  800c58:	e8 db 12 00 00       	call   801f38 <_panic>
+
+00800c5d <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800c5d:	55                   	push   %ebp
+  800c5e:	89 e5                	mov    %esp,%ebp
+  800c60:	57                   	push   %edi
+  800c61:	56                   	push   %esi
+  800c62:	53                   	push   %ebx
+  800c63:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c66:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c6b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c6e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c71:	b8 09 00 00 00       	mov    $0x9,%eax
+  800c76:	89 df                	mov    %ebx,%edi
+  800c78:	89 de                	mov    %ebx,%esi
+  800c7a:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c7c:	85 c0                	test   %eax,%eax
+  800c7e:	7f 08                	jg     800c88 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800c80:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c83:	5b                   	pop    %ebx
+  800c84:	5e                   	pop    %esi
+  800c85:	5f                   	pop    %edi
+  800c86:	5d                   	pop    %ebp
+  800c87:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c88:	83 ec 0c             	sub    $0xc,%esp
+  800c8b:	50                   	push   %eax
+  800c8c:	6a 09                	push   $0x9
+  800c8e:	68 c3 28 80 00       	push   $0x8028c3
+  800c93:	6a 3e                	push   $0x3e
+  800c95:	68 e0 28 80 00       	push   $0x8028e0
+  800c9a:	e8 99 12 00 00       	call   801f38 <_panic>
+
+00800c9f <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800c9f:	55                   	push   %ebp
+  800ca0:	89 e5                	mov    %esp,%ebp
+  800ca2:	57                   	push   %edi
+  800ca3:	56                   	push   %esi
+  800ca4:	53                   	push   %ebx
+  800ca5:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800ca8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cad:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cb0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cb3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800cb8:	89 df                	mov    %ebx,%edi
+  800cba:	89 de                	mov    %ebx,%esi
+  800cbc:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800cbe:	85 c0                	test   %eax,%eax
+  800cc0:	7f 08                	jg     800cca <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800cc2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cc5:	5b                   	pop    %ebx
+  800cc6:	5e                   	pop    %esi
+  800cc7:	5f                   	pop    %edi
+  800cc8:	5d                   	pop    %ebp
+  800cc9:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800cca:	83 ec 0c             	sub    $0xc,%esp
+  800ccd:	50                   	push   %eax
+  800cce:	6a 0a                	push   $0xa
+  800cd0:	68 c3 28 80 00       	push   $0x8028c3
+  800cd5:	6a 3e                	push   $0x3e
+  800cd7:	68 e0 28 80 00       	push   $0x8028e0
+  800cdc:	e8 57 12 00 00       	call   801f38 <_panic>
+
+00800ce1 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  800ce1:	55                   	push   %ebp
+  800ce2:	89 e5                	mov    %esp,%ebp
+  800ce4:	57                   	push   %edi
+  800ce5:	56                   	push   %esi
+  800ce6:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800ce7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ced:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800cf2:	be 00 00 00 00       	mov    $0x0,%esi
+  800cf7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cfa:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800cfd:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800cff:	5b                   	pop    %ebx
+  800d00:	5e                   	pop    %esi
+  800d01:	5f                   	pop    %edi
+  800d02:	5d                   	pop    %ebp
+  800d03:	c3                   	ret
+
+00800d04 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  800d04:	55                   	push   %ebp
+  800d05:	89 e5                	mov    %esp,%ebp
+  800d07:	57                   	push   %edi
+  800d08:	56                   	push   %esi
+  800d09:	53                   	push   %ebx
+  800d0a:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800d0d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d12:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d15:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800d1a:	89 cb                	mov    %ecx,%ebx
+  800d1c:	89 cf                	mov    %ecx,%edi
+  800d1e:	89 ce                	mov    %ecx,%esi
+  800d20:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d22:	85 c0                	test   %eax,%eax
+  800d24:	7f 08                	jg     800d2e <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  800d26:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d29:	5b                   	pop    %ebx
+  800d2a:	5e                   	pop    %esi
+  800d2b:	5f                   	pop    %edi
+  800d2c:	5d                   	pop    %ebp
+  800d2d:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d2e:	83 ec 0c             	sub    $0xc,%esp
+  800d31:	50                   	push   %eax
+  800d32:	6a 0d                	push   $0xd
+  800d34:	68 c3 28 80 00       	push   $0x8028c3
+  800d39:	6a 3e                	push   $0x3e
+  800d3b:	68 e0 28 80 00       	push   $0x8028e0
+  800d40:	e8 f3 11 00 00       	call   801f38 <_panic>
+
+00800d45 <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  800d45:	55                   	push   %ebp
+  800d46:	89 e5                	mov    %esp,%ebp
+  800d48:	57                   	push   %edi
+  800d49:	56                   	push   %esi
+  800d4a:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d4b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d50:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d53:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d56:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800d5b:	89 df                	mov    %ebx,%edi
+  800d5d:	89 de                	mov    %ebx,%esi
+  800d5f:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  800d61:	5b                   	pop    %ebx
+  800d62:	5e                   	pop    %esi
+  800d63:	5f                   	pop    %edi
+  800d64:	5d                   	pop    %ebp
+  800d65:	c3                   	ret
+
+00800d66 <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  800d66:	55                   	push   %ebp
+  800d67:	89 e5                	mov    %esp,%ebp
+  800d69:	57                   	push   %edi
+  800d6a:	56                   	push   %esi
+  800d6b:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d6c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d71:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d74:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800d79:	89 cb                	mov    %ecx,%ebx
+  800d7b:	89 cf                	mov    %ecx,%edi
+  800d7d:	89 ce                	mov    %ecx,%esi
+  800d7f:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  800d81:	5b                   	pop    %ebx
+  800d82:	5e                   	pop    %esi
+  800d83:	5f                   	pop    %edi
+  800d84:	5d                   	pop    %ebp
+  800d85:	c3                   	ret
+
+00800d86 <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  800d86:	55                   	push   %ebp
+  800d87:	89 e5                	mov    %esp,%ebp
+  800d89:	57                   	push   %edi
+  800d8a:	56                   	push   %esi
+  800d8b:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d8c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d91:	b8 10 00 00 00       	mov    $0x10,%eax
+  800d96:	89 d1                	mov    %edx,%ecx
+  800d98:	89 d3                	mov    %edx,%ebx
+  800d9a:	89 d7                	mov    %edx,%edi
+  800d9c:	89 d6                	mov    %edx,%esi
+  800d9e:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800da0:	5b                   	pop    %ebx
+  800da1:	5e                   	pop    %esi
+  800da2:	5f                   	pop    %edi
+  800da3:	5d                   	pop    %ebp
+  800da4:	c3                   	ret
+
+00800da5 <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  800da5:	55                   	push   %ebp
+  800da6:	89 e5                	mov    %esp,%ebp
+  800da8:	57                   	push   %edi
+  800da9:	56                   	push   %esi
+  800daa:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800dab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800db0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800db3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800db6:	b8 11 00 00 00       	mov    $0x11,%eax
+  800dbb:	89 df                	mov    %ebx,%edi
+  800dbd:	89 de                	mov    %ebx,%esi
+  800dbf:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800dc1:	5b                   	pop    %ebx
+  800dc2:	5e                   	pop    %esi
+  800dc3:	5f                   	pop    %edi
+  800dc4:	5d                   	pop    %ebp
+  800dc5:	c3                   	ret
+
+00800dc6 <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  800dc6:	55                   	push   %ebp
+  800dc7:	89 e5                	mov    %esp,%ebp
+  800dc9:	57                   	push   %edi
+  800dca:	56                   	push   %esi
+  800dcb:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800dcc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dd1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dd7:	b8 12 00 00 00       	mov    $0x12,%eax
+  800ddc:	89 df                	mov    %ebx,%edi
+  800dde:	89 de                	mov    %ebx,%esi
+  800de0:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800de2:	5b                   	pop    %ebx
+  800de3:	5e                   	pop    %esi
+  800de4:	5f                   	pop    %edi
+  800de5:	5d                   	pop    %ebp
+  800de6:	c3                   	ret
+
+00800de7 <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  800de7:	55                   	push   %ebp
+  800de8:	89 e5                	mov    %esp,%ebp
+  800dea:	57                   	push   %edi
+  800deb:	56                   	push   %esi
+  800dec:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800ded:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800df2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df5:	b8 13 00 00 00       	mov    $0x13,%eax
+  800dfa:	89 cb                	mov    %ecx,%ebx
+  800dfc:	89 cf                	mov    %ecx,%edi
+  800dfe:	89 ce                	mov    %ecx,%esi
+  800e00:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  800e02:	5b                   	pop    %ebx
+  800e03:	5e                   	pop    %esi
+  800e04:	5f                   	pop    %edi
+  800e05:	5d                   	pop    %ebp
+  800e06:	c3                   	ret
+
+00800e07 <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  800e07:	55                   	push   %ebp
+  800e08:	89 e5                	mov    %esp,%ebp
+  800e0a:	57                   	push   %edi
+  800e0b:	56                   	push   %esi
+  800e0c:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e0d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e12:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e15:	b8 14 00 00 00       	mov    $0x14,%eax
+  800e1a:	89 cb                	mov    %ecx,%ebx
+  800e1c:	89 cf                	mov    %ecx,%edi
+  800e1e:	89 ce                	mov    %ecx,%esi
+  800e20:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  800e22:	5b                   	pop    %ebx
+  800e23:	5e                   	pop    %esi
+  800e24:	5f                   	pop    %edi
+  800e25:	5d                   	pop    %ebp
+  800e26:	c3                   	ret
+
+00800e27 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800e27:	55                   	push   %ebp
+  800e28:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800e2a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e2d:	05 00 00 00 30       	add    $0x30000000,%eax
+  800e32:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800e35:	5d                   	pop    %ebp
+  800e36:	c3                   	ret
+
+00800e37 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800e37:	55                   	push   %ebp
+  800e38:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800e3a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e3d:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800e42:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800e47:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800e4c:	5d                   	pop    %ebp
+  800e4d:	c3                   	ret
+
+00800e4e <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800e4e:	55                   	push   %ebp
+  800e4f:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  800e51:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800e56:	eb 02                	jmp    800e5a <fd_alloc+0xc>
+  800e58:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800e5a:	89 c2                	mov    %eax,%edx
+  800e5c:	c1 ea 16             	shr    $0x16,%edx
+  800e5f:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800e66:	f6 c2 01             	test   $0x1,%dl
+  800e69:	74 2b                	je     800e96 <fd_alloc+0x48>
+  800e6b:	89 c2                	mov    %eax,%edx
+  800e6d:	c1 ea 0c             	shr    $0xc,%edx
+  800e70:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  800e77:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  800e7d:	f6 c1 01             	test   $0x1,%cl
+  800e80:	74 14                	je     800e96 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  800e82:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  800e88:	75 ce                	jne    800e58 <fd_alloc+0xa>
+  800e8a:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  800e8f:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800e94:	eb 05                	jmp    800e9b <fd_alloc+0x4d>
+			return 0;
+  800e96:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  800e9b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e9e:	89 02                	mov    %eax,(%edx)
+}
+  800ea0:	89 c8                	mov    %ecx,%eax
+  800ea2:	5d                   	pop    %ebp
+  800ea3:	c3                   	ret
+
+00800ea4 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  800ea4:	55                   	push   %ebp
+  800ea5:	89 e5                	mov    %esp,%ebp
+  800ea7:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  800eaa:	83 f8 1f             	cmp    $0x1f,%eax
+  800ead:	77 30                	ja     800edf <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  800eaf:	c1 e0 0c             	shl    $0xc,%eax
+  800eb2:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800eb7:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  800ebd:	f6 c2 01             	test   $0x1,%dl
+  800ec0:	74 24                	je     800ee6 <fd_lookup+0x42>
+  800ec2:	89 c2                	mov    %eax,%edx
+  800ec4:	c1 ea 0c             	shr    $0xc,%edx
+  800ec7:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800ece:	f6 c2 01             	test   $0x1,%dl
+  800ed1:	74 1a                	je     800eed <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  800ed3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ed6:	89 02                	mov    %eax,(%edx)
+	return 0;
+  800ed8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800edd:	5d                   	pop    %ebp
+  800ede:	c3                   	ret
+		return -E_INVAL;
+  800edf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ee4:	eb f7                	jmp    800edd <fd_lookup+0x39>
+		return -E_INVAL;
+  800ee6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800eeb:	eb f0                	jmp    800edd <fd_lookup+0x39>
+  800eed:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ef2:	eb e9                	jmp    800edd <fd_lookup+0x39>
+
+00800ef4 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  800ef4:	55                   	push   %ebp
+  800ef5:	89 e5                	mov    %esp,%ebp
+  800ef7:	53                   	push   %ebx
+  800ef8:	83 ec 04             	sub    $0x4,%esp
+  800efb:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  800efe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f03:	eb 03                	jmp    800f08 <dev_lookup+0x14>
+  800f05:	83 c0 01             	add    $0x1,%eax
+  800f08:	8b 1c 85 6c 29 80 00 	mov    0x80296c(,%eax,4),%ebx
+  800f0f:	85 db                	test   %ebx,%ebx
+  800f11:	74 0b                	je     800f1e <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  800f13:	39 13                	cmp    %edx,(%ebx)
+  800f15:	75 ee                	jne    800f05 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  800f17:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f1c:	eb 1f                	jmp    800f3d <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800f1e:	a1 08 40 80 00       	mov    0x804008,%eax
+  800f23:	8b 40 48             	mov    0x48(%eax),%eax
+  800f26:	83 ec 04             	sub    $0x4,%esp
+  800f29:	52                   	push   %edx
+  800f2a:	50                   	push   %eax
+  800f2b:	68 f0 28 80 00       	push   $0x8028f0
+  800f30:	e8 7a f2 ff ff       	call   8001af <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  800f35:	83 c4 10             	add    $0x10,%esp
+  800f38:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  800f3d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800f40:	89 1a                	mov    %ebx,(%edx)
+}
+  800f42:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f45:	c9                   	leave
+  800f46:	c3                   	ret
+
+00800f47 <fd_close>:
+{
+  800f47:	55                   	push   %ebp
+  800f48:	89 e5                	mov    %esp,%ebp
+  800f4a:	57                   	push   %edi
+  800f4b:	56                   	push   %esi
+  800f4c:	53                   	push   %ebx
+  800f4d:	83 ec 24             	sub    $0x24,%esp
+  800f50:	8b 75 08             	mov    0x8(%ebp),%esi
+  800f53:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800f56:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800f59:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800f5a:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800f60:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800f63:	50                   	push   %eax
+  800f64:	e8 3b ff ff ff       	call   800ea4 <fd_lookup>
+  800f69:	89 c3                	mov    %eax,%ebx
+  800f6b:	83 c4 10             	add    $0x10,%esp
+  800f6e:	85 c0                	test   %eax,%eax
+  800f70:	78 05                	js     800f77 <fd_close+0x30>
+	    || fd != fd2)
+  800f72:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  800f75:	74 16                	je     800f8d <fd_close+0x46>
+		return (must_exist ? r : 0);
+  800f77:	89 f8                	mov    %edi,%eax
+  800f79:	84 c0                	test   %al,%al
+  800f7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f80:	0f 44 d8             	cmove  %eax,%ebx
+}
+  800f83:	89 d8                	mov    %ebx,%eax
+  800f85:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f88:	5b                   	pop    %ebx
+  800f89:	5e                   	pop    %esi
+  800f8a:	5f                   	pop    %edi
+  800f8b:	5d                   	pop    %ebp
+  800f8c:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800f8d:	83 ec 08             	sub    $0x8,%esp
+  800f90:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800f93:	50                   	push   %eax
+  800f94:	ff 36                	push   (%esi)
+  800f96:	e8 59 ff ff ff       	call   800ef4 <dev_lookup>
+  800f9b:	89 c3                	mov    %eax,%ebx
+  800f9d:	83 c4 10             	add    $0x10,%esp
+  800fa0:	85 c0                	test   %eax,%eax
+  800fa2:	78 1a                	js     800fbe <fd_close+0x77>
+		if (dev->dev_close)
+  800fa4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800fa7:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  800faa:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  800faf:	85 c0                	test   %eax,%eax
+  800fb1:	74 0b                	je     800fbe <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  800fb3:	83 ec 0c             	sub    $0xc,%esp
+  800fb6:	56                   	push   %esi
+  800fb7:	ff d0                	call   *%eax
+  800fb9:	89 c3                	mov    %eax,%ebx
+  800fbb:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  800fbe:	83 ec 08             	sub    $0x8,%esp
+  800fc1:	56                   	push   %esi
+  800fc2:	6a 00                	push   $0x0
+  800fc4:	e8 10 fc ff ff       	call   800bd9 <sys_page_unmap>
+	return r;
+  800fc9:	83 c4 10             	add    $0x10,%esp
+  800fcc:	eb b5                	jmp    800f83 <fd_close+0x3c>
+
+00800fce <close>:
+
+int
+close(int fdnum)
+{
+  800fce:	55                   	push   %ebp
+  800fcf:	89 e5                	mov    %esp,%ebp
+  800fd1:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800fd4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800fd7:	50                   	push   %eax
+  800fd8:	ff 75 08             	push   0x8(%ebp)
+  800fdb:	e8 c4 fe ff ff       	call   800ea4 <fd_lookup>
+  800fe0:	83 c4 10             	add    $0x10,%esp
+  800fe3:	85 c0                	test   %eax,%eax
+  800fe5:	79 02                	jns    800fe9 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  800fe7:	c9                   	leave
+  800fe8:	c3                   	ret
+		return fd_close(fd, 1);
+  800fe9:	83 ec 08             	sub    $0x8,%esp
+  800fec:	6a 01                	push   $0x1
+  800fee:	ff 75 f4             	push   -0xc(%ebp)
+  800ff1:	e8 51 ff ff ff       	call   800f47 <fd_close>
+  800ff6:	83 c4 10             	add    $0x10,%esp
+  800ff9:	eb ec                	jmp    800fe7 <close+0x19>
+
+00800ffb <close_all>:
+
+void
+close_all(void)
+{
+  800ffb:	55                   	push   %ebp
+  800ffc:	89 e5                	mov    %esp,%ebp
+  800ffe:	53                   	push   %ebx
+  800fff:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801002:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801007:	83 ec 0c             	sub    $0xc,%esp
+  80100a:	53                   	push   %ebx
+  80100b:	e8 be ff ff ff       	call   800fce <close>
+	for (i = 0; i < MAXFD; i++)
+  801010:	83 c3 01             	add    $0x1,%ebx
+  801013:	83 c4 10             	add    $0x10,%esp
+  801016:	83 fb 20             	cmp    $0x20,%ebx
+  801019:	75 ec                	jne    801007 <close_all+0xc>
+}
+  80101b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80101e:	c9                   	leave
+  80101f:	c3                   	ret
+
+00801020 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801020:	55                   	push   %ebp
+  801021:	89 e5                	mov    %esp,%ebp
+  801023:	57                   	push   %edi
+  801024:	56                   	push   %esi
+  801025:	53                   	push   %ebx
+  801026:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801029:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80102c:	50                   	push   %eax
+  80102d:	ff 75 08             	push   0x8(%ebp)
+  801030:	e8 6f fe ff ff       	call   800ea4 <fd_lookup>
+  801035:	89 c3                	mov    %eax,%ebx
+  801037:	83 c4 10             	add    $0x10,%esp
+  80103a:	85 c0                	test   %eax,%eax
+  80103c:	78 7f                	js     8010bd <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80103e:	83 ec 0c             	sub    $0xc,%esp
+  801041:	ff 75 0c             	push   0xc(%ebp)
+  801044:	e8 85 ff ff ff       	call   800fce <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801049:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80104c:	c1 e6 0c             	shl    $0xc,%esi
+  80104f:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801055:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801058:	89 3c 24             	mov    %edi,(%esp)
+  80105b:	e8 d7 fd ff ff       	call   800e37 <fd2data>
+  801060:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801062:	89 34 24             	mov    %esi,(%esp)
+  801065:	e8 cd fd ff ff       	call   800e37 <fd2data>
+  80106a:	83 c4 10             	add    $0x10,%esp
+  80106d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801070:	89 d8                	mov    %ebx,%eax
+  801072:	c1 e8 16             	shr    $0x16,%eax
+  801075:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80107c:	a8 01                	test   $0x1,%al
+  80107e:	74 11                	je     801091 <dup+0x71>
+  801080:	89 d8                	mov    %ebx,%eax
+  801082:	c1 e8 0c             	shr    $0xc,%eax
+  801085:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80108c:	f6 c2 01             	test   $0x1,%dl
+  80108f:	75 36                	jne    8010c7 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801091:	89 f8                	mov    %edi,%eax
+  801093:	c1 e8 0c             	shr    $0xc,%eax
+  801096:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80109d:	83 ec 0c             	sub    $0xc,%esp
+  8010a0:	25 07 0e 00 00       	and    $0xe07,%eax
+  8010a5:	50                   	push   %eax
+  8010a6:	56                   	push   %esi
+  8010a7:	6a 00                	push   $0x0
+  8010a9:	57                   	push   %edi
+  8010aa:	6a 00                	push   $0x0
+  8010ac:	e8 e6 fa ff ff       	call   800b97 <sys_page_map>
+  8010b1:	89 c3                	mov    %eax,%ebx
+  8010b3:	83 c4 20             	add    $0x20,%esp
+  8010b6:	85 c0                	test   %eax,%eax
+  8010b8:	78 33                	js     8010ed <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8010ba:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8010bd:	89 d8                	mov    %ebx,%eax
+  8010bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010c2:	5b                   	pop    %ebx
+  8010c3:	5e                   	pop    %esi
+  8010c4:	5f                   	pop    %edi
+  8010c5:	5d                   	pop    %ebp
+  8010c6:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8010c7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8010ce:	83 ec 0c             	sub    $0xc,%esp
+  8010d1:	25 07 0e 00 00       	and    $0xe07,%eax
+  8010d6:	50                   	push   %eax
+  8010d7:	ff 75 d4             	push   -0x2c(%ebp)
+  8010da:	6a 00                	push   $0x0
+  8010dc:	53                   	push   %ebx
+  8010dd:	6a 00                	push   $0x0
+  8010df:	e8 b3 fa ff ff       	call   800b97 <sys_page_map>
+  8010e4:	89 c3                	mov    %eax,%ebx
+  8010e6:	83 c4 20             	add    $0x20,%esp
+  8010e9:	85 c0                	test   %eax,%eax
+  8010eb:	79 a4                	jns    801091 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8010ed:	83 ec 08             	sub    $0x8,%esp
+  8010f0:	56                   	push   %esi
+  8010f1:	6a 00                	push   $0x0
+  8010f3:	e8 e1 fa ff ff       	call   800bd9 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8010f8:	83 c4 08             	add    $0x8,%esp
+  8010fb:	ff 75 d4             	push   -0x2c(%ebp)
+  8010fe:	6a 00                	push   $0x0
+  801100:	e8 d4 fa ff ff       	call   800bd9 <sys_page_unmap>
+	return r;
+  801105:	83 c4 10             	add    $0x10,%esp
+  801108:	eb b3                	jmp    8010bd <dup+0x9d>
+
+0080110a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80110a:	55                   	push   %ebp
+  80110b:	89 e5                	mov    %esp,%ebp
+  80110d:	56                   	push   %esi
+  80110e:	53                   	push   %ebx
+  80110f:	83 ec 18             	sub    $0x18,%esp
+  801112:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801115:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801118:	50                   	push   %eax
+  801119:	56                   	push   %esi
+  80111a:	e8 85 fd ff ff       	call   800ea4 <fd_lookup>
+  80111f:	83 c4 10             	add    $0x10,%esp
+  801122:	85 c0                	test   %eax,%eax
+  801124:	78 3c                	js     801162 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801126:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801129:	83 ec 08             	sub    $0x8,%esp
+  80112c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80112f:	50                   	push   %eax
+  801130:	ff 33                	push   (%ebx)
+  801132:	e8 bd fd ff ff       	call   800ef4 <dev_lookup>
+  801137:	83 c4 10             	add    $0x10,%esp
+  80113a:	85 c0                	test   %eax,%eax
+  80113c:	78 24                	js     801162 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80113e:	8b 43 08             	mov    0x8(%ebx),%eax
+  801141:	83 e0 03             	and    $0x3,%eax
+  801144:	83 f8 01             	cmp    $0x1,%eax
+  801147:	74 20                	je     801169 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801149:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80114c:	8b 40 08             	mov    0x8(%eax),%eax
+  80114f:	85 c0                	test   %eax,%eax
+  801151:	74 37                	je     80118a <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801153:	83 ec 04             	sub    $0x4,%esp
+  801156:	ff 75 10             	push   0x10(%ebp)
+  801159:	ff 75 0c             	push   0xc(%ebp)
+  80115c:	53                   	push   %ebx
+  80115d:	ff d0                	call   *%eax
+  80115f:	83 c4 10             	add    $0x10,%esp
+}
+  801162:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801165:	5b                   	pop    %ebx
+  801166:	5e                   	pop    %esi
+  801167:	5d                   	pop    %ebp
+  801168:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801169:	a1 08 40 80 00       	mov    0x804008,%eax
+  80116e:	8b 40 48             	mov    0x48(%eax),%eax
+  801171:	83 ec 04             	sub    $0x4,%esp
+  801174:	56                   	push   %esi
+  801175:	50                   	push   %eax
+  801176:	68 31 29 80 00       	push   $0x802931
+  80117b:	e8 2f f0 ff ff       	call   8001af <cprintf>
+		return -E_INVAL;
+  801180:	83 c4 10             	add    $0x10,%esp
+  801183:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801188:	eb d8                	jmp    801162 <read+0x58>
+		return -E_NOT_SUPP;
+  80118a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80118f:	eb d1                	jmp    801162 <read+0x58>
+
+00801191 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801191:	55                   	push   %ebp
+  801192:	89 e5                	mov    %esp,%ebp
+  801194:	57                   	push   %edi
+  801195:	56                   	push   %esi
+  801196:	53                   	push   %ebx
+  801197:	83 ec 0c             	sub    $0xc,%esp
+  80119a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80119d:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8011a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011a5:	eb 02                	jmp    8011a9 <readn+0x18>
+  8011a7:	01 c3                	add    %eax,%ebx
+  8011a9:	39 f3                	cmp    %esi,%ebx
+  8011ab:	73 21                	jae    8011ce <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8011ad:	83 ec 04             	sub    $0x4,%esp
+  8011b0:	89 f0                	mov    %esi,%eax
+  8011b2:	29 d8                	sub    %ebx,%eax
+  8011b4:	50                   	push   %eax
+  8011b5:	89 d8                	mov    %ebx,%eax
+  8011b7:	03 45 0c             	add    0xc(%ebp),%eax
+  8011ba:	50                   	push   %eax
+  8011bb:	57                   	push   %edi
+  8011bc:	e8 49 ff ff ff       	call   80110a <read>
+		if (m < 0)
+  8011c1:	83 c4 10             	add    $0x10,%esp
+  8011c4:	85 c0                	test   %eax,%eax
+  8011c6:	78 04                	js     8011cc <readn+0x3b>
+			return m;
+		if (m == 0)
+  8011c8:	75 dd                	jne    8011a7 <readn+0x16>
+  8011ca:	eb 02                	jmp    8011ce <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8011cc:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8011ce:	89 d8                	mov    %ebx,%eax
+  8011d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011d3:	5b                   	pop    %ebx
+  8011d4:	5e                   	pop    %esi
+  8011d5:	5f                   	pop    %edi
+  8011d6:	5d                   	pop    %ebp
+  8011d7:	c3                   	ret
+
+008011d8 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8011d8:	55                   	push   %ebp
+  8011d9:	89 e5                	mov    %esp,%ebp
+  8011db:	56                   	push   %esi
+  8011dc:	53                   	push   %ebx
+  8011dd:	83 ec 18             	sub    $0x18,%esp
+  8011e0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8011e3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8011e6:	50                   	push   %eax
+  8011e7:	53                   	push   %ebx
+  8011e8:	e8 b7 fc ff ff       	call   800ea4 <fd_lookup>
+  8011ed:	83 c4 10             	add    $0x10,%esp
+  8011f0:	85 c0                	test   %eax,%eax
+  8011f2:	78 37                	js     80122b <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8011f4:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8011f7:	83 ec 08             	sub    $0x8,%esp
+  8011fa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8011fd:	50                   	push   %eax
+  8011fe:	ff 36                	push   (%esi)
+  801200:	e8 ef fc ff ff       	call   800ef4 <dev_lookup>
+  801205:	83 c4 10             	add    $0x10,%esp
+  801208:	85 c0                	test   %eax,%eax
+  80120a:	78 1f                	js     80122b <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80120c:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801210:	74 20                	je     801232 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801212:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801215:	8b 40 0c             	mov    0xc(%eax),%eax
+  801218:	85 c0                	test   %eax,%eax
+  80121a:	74 37                	je     801253 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80121c:	83 ec 04             	sub    $0x4,%esp
+  80121f:	ff 75 10             	push   0x10(%ebp)
+  801222:	ff 75 0c             	push   0xc(%ebp)
+  801225:	56                   	push   %esi
+  801226:	ff d0                	call   *%eax
+  801228:	83 c4 10             	add    $0x10,%esp
+}
+  80122b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80122e:	5b                   	pop    %ebx
+  80122f:	5e                   	pop    %esi
+  801230:	5d                   	pop    %ebp
+  801231:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801232:	a1 08 40 80 00       	mov    0x804008,%eax
+  801237:	8b 40 48             	mov    0x48(%eax),%eax
+  80123a:	83 ec 04             	sub    $0x4,%esp
+  80123d:	53                   	push   %ebx
+  80123e:	50                   	push   %eax
+  80123f:	68 4d 29 80 00       	push   $0x80294d
+  801244:	e8 66 ef ff ff       	call   8001af <cprintf>
+		return -E_INVAL;
+  801249:	83 c4 10             	add    $0x10,%esp
+  80124c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801251:	eb d8                	jmp    80122b <write+0x53>
+		return -E_NOT_SUPP;
+  801253:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801258:	eb d1                	jmp    80122b <write+0x53>
+
+0080125a <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80125a:	55                   	push   %ebp
+  80125b:	89 e5                	mov    %esp,%ebp
+  80125d:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801260:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801263:	50                   	push   %eax
+  801264:	ff 75 08             	push   0x8(%ebp)
+  801267:	e8 38 fc ff ff       	call   800ea4 <fd_lookup>
+  80126c:	83 c4 10             	add    $0x10,%esp
+  80126f:	85 c0                	test   %eax,%eax
+  801271:	78 0e                	js     801281 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801273:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801276:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801279:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80127c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801281:	c9                   	leave
+  801282:	c3                   	ret
+
+00801283 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801283:	55                   	push   %ebp
+  801284:	89 e5                	mov    %esp,%ebp
+  801286:	56                   	push   %esi
+  801287:	53                   	push   %ebx
+  801288:	83 ec 18             	sub    $0x18,%esp
+  80128b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80128e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801291:	50                   	push   %eax
+  801292:	53                   	push   %ebx
+  801293:	e8 0c fc ff ff       	call   800ea4 <fd_lookup>
+  801298:	83 c4 10             	add    $0x10,%esp
+  80129b:	85 c0                	test   %eax,%eax
+  80129d:	78 34                	js     8012d3 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80129f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8012a2:	83 ec 08             	sub    $0x8,%esp
+  8012a5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8012a8:	50                   	push   %eax
+  8012a9:	ff 36                	push   (%esi)
+  8012ab:	e8 44 fc ff ff       	call   800ef4 <dev_lookup>
+  8012b0:	83 c4 10             	add    $0x10,%esp
+  8012b3:	85 c0                	test   %eax,%eax
+  8012b5:	78 1c                	js     8012d3 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8012b7:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8012bb:	74 1d                	je     8012da <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8012bd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8012c0:	8b 40 18             	mov    0x18(%eax),%eax
+  8012c3:	85 c0                	test   %eax,%eax
+  8012c5:	74 34                	je     8012fb <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8012c7:	83 ec 08             	sub    $0x8,%esp
+  8012ca:	ff 75 0c             	push   0xc(%ebp)
+  8012cd:	56                   	push   %esi
+  8012ce:	ff d0                	call   *%eax
+  8012d0:	83 c4 10             	add    $0x10,%esp
+}
+  8012d3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8012d6:	5b                   	pop    %ebx
+  8012d7:	5e                   	pop    %esi
+  8012d8:	5d                   	pop    %ebp
+  8012d9:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8012da:	a1 08 40 80 00       	mov    0x804008,%eax
+  8012df:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8012e2:	83 ec 04             	sub    $0x4,%esp
+  8012e5:	53                   	push   %ebx
+  8012e6:	50                   	push   %eax
+  8012e7:	68 10 29 80 00       	push   $0x802910
+  8012ec:	e8 be ee ff ff       	call   8001af <cprintf>
+		return -E_INVAL;
+  8012f1:	83 c4 10             	add    $0x10,%esp
+  8012f4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012f9:	eb d8                	jmp    8012d3 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8012fb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801300:	eb d1                	jmp    8012d3 <ftruncate+0x50>
+
+00801302 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801302:	55                   	push   %ebp
+  801303:	89 e5                	mov    %esp,%ebp
+  801305:	56                   	push   %esi
+  801306:	53                   	push   %ebx
+  801307:	83 ec 18             	sub    $0x18,%esp
+  80130a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80130d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801310:	50                   	push   %eax
+  801311:	ff 75 08             	push   0x8(%ebp)
+  801314:	e8 8b fb ff ff       	call   800ea4 <fd_lookup>
+  801319:	83 c4 10             	add    $0x10,%esp
+  80131c:	85 c0                	test   %eax,%eax
+  80131e:	78 49                	js     801369 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801320:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801323:	83 ec 08             	sub    $0x8,%esp
+  801326:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801329:	50                   	push   %eax
+  80132a:	ff 36                	push   (%esi)
+  80132c:	e8 c3 fb ff ff       	call   800ef4 <dev_lookup>
+  801331:	83 c4 10             	add    $0x10,%esp
+  801334:	85 c0                	test   %eax,%eax
+  801336:	78 31                	js     801369 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801338:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80133b:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80133f:	74 2f                	je     801370 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801341:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801344:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80134b:	00 00 00 
+	stat->st_isdir = 0;
+  80134e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801355:	00 00 00 
+	stat->st_dev = dev;
+  801358:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80135e:	83 ec 08             	sub    $0x8,%esp
+  801361:	53                   	push   %ebx
+  801362:	56                   	push   %esi
+  801363:	ff 50 14             	call   *0x14(%eax)
+  801366:	83 c4 10             	add    $0x10,%esp
+}
+  801369:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80136c:	5b                   	pop    %ebx
+  80136d:	5e                   	pop    %esi
+  80136e:	5d                   	pop    %ebp
+  80136f:	c3                   	ret
+		return -E_NOT_SUPP;
+  801370:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801375:	eb f2                	jmp    801369 <fstat+0x67>
+
+00801377 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801377:	55                   	push   %ebp
+  801378:	89 e5                	mov    %esp,%ebp
+  80137a:	56                   	push   %esi
+  80137b:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80137c:	83 ec 08             	sub    $0x8,%esp
+  80137f:	6a 00                	push   $0x0
+  801381:	ff 75 08             	push   0x8(%ebp)
+  801384:	e8 e4 01 00 00       	call   80156d <open>
+  801389:	89 c3                	mov    %eax,%ebx
+  80138b:	83 c4 10             	add    $0x10,%esp
+  80138e:	85 c0                	test   %eax,%eax
+  801390:	78 1b                	js     8013ad <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801392:	83 ec 08             	sub    $0x8,%esp
+  801395:	ff 75 0c             	push   0xc(%ebp)
+  801398:	50                   	push   %eax
+  801399:	e8 64 ff ff ff       	call   801302 <fstat>
+  80139e:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8013a0:	89 1c 24             	mov    %ebx,(%esp)
+  8013a3:	e8 26 fc ff ff       	call   800fce <close>
+	return r;
+  8013a8:	83 c4 10             	add    $0x10,%esp
+  8013ab:	89 f3                	mov    %esi,%ebx
+}
+  8013ad:	89 d8                	mov    %ebx,%eax
+  8013af:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013b2:	5b                   	pop    %ebx
+  8013b3:	5e                   	pop    %esi
+  8013b4:	5d                   	pop    %ebp
+  8013b5:	c3                   	ret
+
+008013b6 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  8013b6:	55                   	push   %ebp
+  8013b7:	89 e5                	mov    %esp,%ebp
+  8013b9:	56                   	push   %esi
+  8013ba:	53                   	push   %ebx
+  8013bb:	89 c6                	mov    %eax,%esi
+  8013bd:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  8013bf:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  8013c6:	74 27                	je     8013ef <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8013c8:	6a 07                	push   $0x7
+  8013ca:	68 00 50 80 00       	push   $0x805000
+  8013cf:	56                   	push   %esi
+  8013d0:	ff 35 00 40 80 00    	push   0x804000
+  8013d6:	e8 17 0c 00 00       	call   801ff2 <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  8013db:	83 c4 0c             	add    $0xc,%esp
+  8013de:	6a 00                	push   $0x0
+  8013e0:	53                   	push   %ebx
+  8013e1:	6a 00                	push   $0x0
+  8013e3:	e8 96 0b 00 00       	call   801f7e <ipc_recv>
+}
+  8013e8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013eb:	5b                   	pop    %ebx
+  8013ec:	5e                   	pop    %esi
+  8013ed:	5d                   	pop    %ebp
+  8013ee:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  8013ef:	83 ec 0c             	sub    $0xc,%esp
+  8013f2:	6a 01                	push   $0x1
+  8013f4:	e8 4d 0c 00 00       	call   802046 <ipc_find_env>
+  8013f9:	a3 00 40 80 00       	mov    %eax,0x804000
+  8013fe:	83 c4 10             	add    $0x10,%esp
+  801401:	eb c5                	jmp    8013c8 <fsipc+0x12>
+
+00801403 <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801403:	55                   	push   %ebp
+  801404:	89 e5                	mov    %esp,%ebp
+  801406:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801409:	8b 45 08             	mov    0x8(%ebp),%eax
+  80140c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80140f:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.set_size.req_size = newsize;
+  801414:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801417:	a3 04 50 80 00       	mov    %eax,0x805004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  80141c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801421:	b8 02 00 00 00       	mov    $0x2,%eax
+  801426:	e8 8b ff ff ff       	call   8013b6 <fsipc>
+}
+  80142b:	c9                   	leave
+  80142c:	c3                   	ret
+
+0080142d <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80142d:	55                   	push   %ebp
+  80142e:	89 e5                	mov    %esp,%ebp
+  801430:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801433:	8b 45 08             	mov    0x8(%ebp),%eax
+  801436:	8b 40 0c             	mov    0xc(%eax),%eax
+  801439:	a3 00 50 80 00       	mov    %eax,0x805000
+  return fsipc(FSREQ_FLUSH, NULL);
+  80143e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801443:	b8 06 00 00 00       	mov    $0x6,%eax
+  801448:	e8 69 ff ff ff       	call   8013b6 <fsipc>
+}
+  80144d:	c9                   	leave
+  80144e:	c3                   	ret
+
+0080144f <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80144f:	55                   	push   %ebp
+  801450:	89 e5                	mov    %esp,%ebp
+  801452:	53                   	push   %ebx
+  801453:	83 ec 04             	sub    $0x4,%esp
+  801456:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801459:	8b 45 08             	mov    0x8(%ebp),%eax
+  80145c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80145f:	a3 00 50 80 00       	mov    %eax,0x805000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801464:	ba 00 00 00 00       	mov    $0x0,%edx
+  801469:	b8 05 00 00 00       	mov    $0x5,%eax
+  80146e:	e8 43 ff ff ff       	call   8013b6 <fsipc>
+  801473:	85 c0                	test   %eax,%eax
+  801475:	78 2c                	js     8014a3 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801477:	83 ec 08             	sub    $0x8,%esp
+  80147a:	68 00 50 80 00       	push   $0x805000
+  80147f:	53                   	push   %ebx
+  801480:	e8 e3 f2 ff ff       	call   800768 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801485:	a1 80 50 80 00       	mov    0x805080,%eax
+  80148a:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801490:	a1 84 50 80 00       	mov    0x805084,%eax
+  801495:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  80149b:	83 c4 10             	add    $0x10,%esp
+  80149e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8014a3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014a6:	c9                   	leave
+  8014a7:	c3                   	ret
+
+008014a8 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8014a8:	55                   	push   %ebp
+  8014a9:	89 e5                	mov    %esp,%ebp
+  8014ab:	83 ec 0c             	sub    $0xc,%esp
+  8014ae:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8014b1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014b4:	8b 52 0c             	mov    0xc(%edx),%edx
+  8014b7:	89 15 00 50 80 00    	mov    %edx,0x805000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8014bd:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8014c2:	39 d0                	cmp    %edx,%eax
+  8014c4:	0f 47 c2             	cmova  %edx,%eax
+  8014c7:	a3 04 50 80 00       	mov    %eax,0x805004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  8014cc:	50                   	push   %eax
+  8014cd:	ff 75 0c             	push   0xc(%ebp)
+  8014d0:	68 08 50 80 00       	push   $0x805008
+  8014d5:	e8 14 f4 ff ff       	call   8008ee <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  8014da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014df:	b8 04 00 00 00       	mov    $0x4,%eax
+  8014e4:	e8 cd fe ff ff       	call   8013b6 <fsipc>
+}
+  8014e9:	c9                   	leave
+  8014ea:	c3                   	ret
+
+008014eb <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8014eb:	55                   	push   %ebp
+  8014ec:	89 e5                	mov    %esp,%ebp
+  8014ee:	56                   	push   %esi
+  8014ef:	53                   	push   %ebx
+  8014f0:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8014f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014f6:	8b 40 0c             	mov    0xc(%eax),%eax
+  8014f9:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.read.req_n = n;
+  8014fe:	89 35 04 50 80 00    	mov    %esi,0x805004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801504:	ba 00 00 00 00       	mov    $0x0,%edx
+  801509:	b8 03 00 00 00       	mov    $0x3,%eax
+  80150e:	e8 a3 fe ff ff       	call   8013b6 <fsipc>
+  801513:	89 c3                	mov    %eax,%ebx
+  801515:	85 c0                	test   %eax,%eax
+  801517:	78 1f                	js     801538 <devfile_read+0x4d>
+  assert(r <= n);
+  801519:	39 c6                	cmp    %eax,%esi
+  80151b:	72 24                	jb     801541 <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  80151d:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801522:	7f 33                	jg     801557 <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801524:	83 ec 04             	sub    $0x4,%esp
+  801527:	50                   	push   %eax
+  801528:	68 00 50 80 00       	push   $0x805000
+  80152d:	ff 75 0c             	push   0xc(%ebp)
+  801530:	e8 b9 f3 ff ff       	call   8008ee <memmove>
+  return r;
+  801535:	83 c4 10             	add    $0x10,%esp
+}
+  801538:	89 d8                	mov    %ebx,%eax
+  80153a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80153d:	5b                   	pop    %ebx
+  80153e:	5e                   	pop    %esi
+  80153f:	5d                   	pop    %ebp
+  801540:	c3                   	ret
+  assert(r <= n);
+  801541:	68 80 29 80 00       	push   $0x802980
+  801546:	68 87 29 80 00       	push   $0x802987
+  80154b:	6a 78                	push   $0x78
+  80154d:	68 9c 29 80 00       	push   $0x80299c
+  801552:	e8 e1 09 00 00       	call   801f38 <_panic>
+  assert(r <= PGSIZE);
+  801557:	68 a7 29 80 00       	push   $0x8029a7
+  80155c:	68 87 29 80 00       	push   $0x802987
+  801561:	6a 79                	push   $0x79
+  801563:	68 9c 29 80 00       	push   $0x80299c
+  801568:	e8 cb 09 00 00       	call   801f38 <_panic>
+
+0080156d <open>:
+open(const char *path, int mode) {
+  80156d:	55                   	push   %ebp
+  80156e:	89 e5                	mov    %esp,%ebp
+  801570:	56                   	push   %esi
+  801571:	53                   	push   %ebx
+  801572:	83 ec 1c             	sub    $0x1c,%esp
+  801575:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801578:	56                   	push   %esi
+  801579:	e8 af f1 ff ff       	call   80072d <strlen>
+  80157e:	83 c4 10             	add    $0x10,%esp
+  801581:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801586:	7f 6c                	jg     8015f4 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801588:	83 ec 0c             	sub    $0xc,%esp
+  80158b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80158e:	50                   	push   %eax
+  80158f:	e8 ba f8 ff ff       	call   800e4e <fd_alloc>
+  801594:	89 c3                	mov    %eax,%ebx
+  801596:	83 c4 10             	add    $0x10,%esp
+  801599:	85 c0                	test   %eax,%eax
+  80159b:	78 3c                	js     8015d9 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  80159d:	83 ec 08             	sub    $0x8,%esp
+  8015a0:	56                   	push   %esi
+  8015a1:	68 00 50 80 00       	push   $0x805000
+  8015a6:	e8 bd f1 ff ff       	call   800768 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  8015ab:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8015ae:	a3 00 54 80 00       	mov    %eax,0x805400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8015b3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8015b6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8015bb:	e8 f6 fd ff ff       	call   8013b6 <fsipc>
+  8015c0:	89 c3                	mov    %eax,%ebx
+  8015c2:	83 c4 10             	add    $0x10,%esp
+  8015c5:	85 c0                	test   %eax,%eax
+  8015c7:	78 19                	js     8015e2 <open+0x75>
+  return fd2num(fd);
+  8015c9:	83 ec 0c             	sub    $0xc,%esp
+  8015cc:	ff 75 f4             	push   -0xc(%ebp)
+  8015cf:	e8 53 f8 ff ff       	call   800e27 <fd2num>
+  8015d4:	89 c3                	mov    %eax,%ebx
+  8015d6:	83 c4 10             	add    $0x10,%esp
+}
+  8015d9:	89 d8                	mov    %ebx,%eax
+  8015db:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015de:	5b                   	pop    %ebx
+  8015df:	5e                   	pop    %esi
+  8015e0:	5d                   	pop    %ebp
+  8015e1:	c3                   	ret
+    fd_close(fd, 0);
+  8015e2:	83 ec 08             	sub    $0x8,%esp
+  8015e5:	6a 00                	push   $0x0
+  8015e7:	ff 75 f4             	push   -0xc(%ebp)
+  8015ea:	e8 58 f9 ff ff       	call   800f47 <fd_close>
+    return r;
+  8015ef:	83 c4 10             	add    $0x10,%esp
+  8015f2:	eb e5                	jmp    8015d9 <open+0x6c>
+    return -E_BAD_PATH;
+  8015f4:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8015f9:	eb de                	jmp    8015d9 <open+0x6c>
+
+008015fb <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  8015fb:	55                   	push   %ebp
+  8015fc:	89 e5                	mov    %esp,%ebp
+  8015fe:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801601:	ba 00 00 00 00       	mov    $0x0,%edx
+  801606:	b8 08 00 00 00       	mov    $0x8,%eax
+  80160b:	e8 a6 fd ff ff       	call   8013b6 <fsipc>
+}
+  801610:	c9                   	leave
+  801611:	c3                   	ret
+
+00801612 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801612:	55                   	push   %ebp
+  801613:	89 e5                	mov    %esp,%ebp
+  801615:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801618:	68 b3 29 80 00       	push   $0x8029b3
+  80161d:	ff 75 0c             	push   0xc(%ebp)
+  801620:	e8 43 f1 ff ff       	call   800768 <strcpy>
+	return 0;
+}
+  801625:	b8 00 00 00 00       	mov    $0x0,%eax
+  80162a:	c9                   	leave
+  80162b:	c3                   	ret
+
+0080162c <devsock_close>:
+{
+  80162c:	55                   	push   %ebp
+  80162d:	89 e5                	mov    %esp,%ebp
+  80162f:	53                   	push   %ebx
+  801630:	83 ec 10             	sub    $0x10,%esp
+  801633:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801636:	53                   	push   %ebx
+  801637:	e8 49 0a 00 00       	call   802085 <pageref>
+  80163c:	89 c2                	mov    %eax,%edx
+  80163e:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801641:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801646:	83 fa 01             	cmp    $0x1,%edx
+  801649:	74 05                	je     801650 <devsock_close+0x24>
+}
+  80164b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80164e:	c9                   	leave
+  80164f:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801650:	83 ec 0c             	sub    $0xc,%esp
+  801653:	ff 73 0c             	push   0xc(%ebx)
+  801656:	e8 b7 02 00 00       	call   801912 <nsipc_close>
+  80165b:	83 c4 10             	add    $0x10,%esp
+  80165e:	eb eb                	jmp    80164b <devsock_close+0x1f>
+
+00801660 <devsock_write>:
+{
+  801660:	55                   	push   %ebp
+  801661:	89 e5                	mov    %esp,%ebp
+  801663:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801666:	6a 00                	push   $0x0
+  801668:	ff 75 10             	push   0x10(%ebp)
+  80166b:	ff 75 0c             	push   0xc(%ebp)
+  80166e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801671:	ff 70 0c             	push   0xc(%eax)
+  801674:	e8 79 03 00 00       	call   8019f2 <nsipc_send>
+}
+  801679:	c9                   	leave
+  80167a:	c3                   	ret
+
+0080167b <devsock_read>:
+{
+  80167b:	55                   	push   %ebp
+  80167c:	89 e5                	mov    %esp,%ebp
+  80167e:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801681:	6a 00                	push   $0x0
+  801683:	ff 75 10             	push   0x10(%ebp)
+  801686:	ff 75 0c             	push   0xc(%ebp)
+  801689:	8b 45 08             	mov    0x8(%ebp),%eax
+  80168c:	ff 70 0c             	push   0xc(%eax)
+  80168f:	e8 ef 02 00 00       	call   801983 <nsipc_recv>
+}
+  801694:	c9                   	leave
+  801695:	c3                   	ret
+
+00801696 <fd2sockid>:
+{
+  801696:	55                   	push   %ebp
+  801697:	89 e5                	mov    %esp,%ebp
+  801699:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  80169c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80169f:	52                   	push   %edx
+  8016a0:	50                   	push   %eax
+  8016a1:	e8 fe f7 ff ff       	call   800ea4 <fd_lookup>
+  8016a6:	83 c4 10             	add    $0x10,%esp
+  8016a9:	85 c0                	test   %eax,%eax
+  8016ab:	78 10                	js     8016bd <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8016ad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016b0:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  8016b6:	39 08                	cmp    %ecx,(%eax)
+  8016b8:	75 05                	jne    8016bf <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8016ba:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8016bd:	c9                   	leave
+  8016be:	c3                   	ret
+		return -E_NOT_SUPP;
+  8016bf:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016c4:	eb f7                	jmp    8016bd <fd2sockid+0x27>
+
+008016c6 <alloc_sockfd>:
+{
+  8016c6:	55                   	push   %ebp
+  8016c7:	89 e5                	mov    %esp,%ebp
+  8016c9:	56                   	push   %esi
+  8016ca:	53                   	push   %ebx
+  8016cb:	83 ec 1c             	sub    $0x1c,%esp
+  8016ce:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8016d0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016d3:	50                   	push   %eax
+  8016d4:	e8 75 f7 ff ff       	call   800e4e <fd_alloc>
+  8016d9:	89 c3                	mov    %eax,%ebx
+  8016db:	83 c4 10             	add    $0x10,%esp
+  8016de:	85 c0                	test   %eax,%eax
+  8016e0:	78 43                	js     801725 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8016e2:	83 ec 04             	sub    $0x4,%esp
+  8016e5:	68 07 04 00 00       	push   $0x407
+  8016ea:	ff 75 f4             	push   -0xc(%ebp)
+  8016ed:	6a 00                	push   $0x0
+  8016ef:	e8 60 f4 ff ff       	call   800b54 <sys_page_alloc>
+  8016f4:	89 c3                	mov    %eax,%ebx
+  8016f6:	83 c4 10             	add    $0x10,%esp
+  8016f9:	85 c0                	test   %eax,%eax
+  8016fb:	78 28                	js     801725 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8016fd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801700:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  801706:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801708:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80170b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801712:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801715:	83 ec 0c             	sub    $0xc,%esp
+  801718:	50                   	push   %eax
+  801719:	e8 09 f7 ff ff       	call   800e27 <fd2num>
+  80171e:	89 c3                	mov    %eax,%ebx
+  801720:	83 c4 10             	add    $0x10,%esp
+  801723:	eb 0c                	jmp    801731 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801725:	83 ec 0c             	sub    $0xc,%esp
+  801728:	56                   	push   %esi
+  801729:	e8 e4 01 00 00       	call   801912 <nsipc_close>
+		return r;
+  80172e:	83 c4 10             	add    $0x10,%esp
+}
+  801731:	89 d8                	mov    %ebx,%eax
+  801733:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801736:	5b                   	pop    %ebx
+  801737:	5e                   	pop    %esi
+  801738:	5d                   	pop    %ebp
+  801739:	c3                   	ret
+
+0080173a <accept>:
+{
+  80173a:	55                   	push   %ebp
+  80173b:	89 e5                	mov    %esp,%ebp
+  80173d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801740:	8b 45 08             	mov    0x8(%ebp),%eax
+  801743:	e8 4e ff ff ff       	call   801696 <fd2sockid>
+  801748:	85 c0                	test   %eax,%eax
+  80174a:	78 1b                	js     801767 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  80174c:	83 ec 04             	sub    $0x4,%esp
+  80174f:	ff 75 10             	push   0x10(%ebp)
+  801752:	ff 75 0c             	push   0xc(%ebp)
+  801755:	50                   	push   %eax
+  801756:	e8 0e 01 00 00       	call   801869 <nsipc_accept>
+  80175b:	83 c4 10             	add    $0x10,%esp
+  80175e:	85 c0                	test   %eax,%eax
+  801760:	78 05                	js     801767 <accept+0x2d>
+	return alloc_sockfd(r);
+  801762:	e8 5f ff ff ff       	call   8016c6 <alloc_sockfd>
+}
+  801767:	c9                   	leave
+  801768:	c3                   	ret
+
+00801769 <bind>:
+{
+  801769:	55                   	push   %ebp
+  80176a:	89 e5                	mov    %esp,%ebp
+  80176c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80176f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801772:	e8 1f ff ff ff       	call   801696 <fd2sockid>
+  801777:	85 c0                	test   %eax,%eax
+  801779:	78 12                	js     80178d <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  80177b:	83 ec 04             	sub    $0x4,%esp
+  80177e:	ff 75 10             	push   0x10(%ebp)
+  801781:	ff 75 0c             	push   0xc(%ebp)
+  801784:	50                   	push   %eax
+  801785:	e8 31 01 00 00       	call   8018bb <nsipc_bind>
+  80178a:	83 c4 10             	add    $0x10,%esp
+}
+  80178d:	c9                   	leave
+  80178e:	c3                   	ret
+
+0080178f <shutdown>:
+{
+  80178f:	55                   	push   %ebp
+  801790:	89 e5                	mov    %esp,%ebp
+  801792:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801795:	8b 45 08             	mov    0x8(%ebp),%eax
+  801798:	e8 f9 fe ff ff       	call   801696 <fd2sockid>
+  80179d:	85 c0                	test   %eax,%eax
+  80179f:	78 0f                	js     8017b0 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8017a1:	83 ec 08             	sub    $0x8,%esp
+  8017a4:	ff 75 0c             	push   0xc(%ebp)
+  8017a7:	50                   	push   %eax
+  8017a8:	e8 43 01 00 00       	call   8018f0 <nsipc_shutdown>
+  8017ad:	83 c4 10             	add    $0x10,%esp
+}
+  8017b0:	c9                   	leave
+  8017b1:	c3                   	ret
+
+008017b2 <connect>:
+{
+  8017b2:	55                   	push   %ebp
+  8017b3:	89 e5                	mov    %esp,%ebp
+  8017b5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8017b8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017bb:	e8 d6 fe ff ff       	call   801696 <fd2sockid>
+  8017c0:	85 c0                	test   %eax,%eax
+  8017c2:	78 12                	js     8017d6 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8017c4:	83 ec 04             	sub    $0x4,%esp
+  8017c7:	ff 75 10             	push   0x10(%ebp)
+  8017ca:	ff 75 0c             	push   0xc(%ebp)
+  8017cd:	50                   	push   %eax
+  8017ce:	e8 59 01 00 00       	call   80192c <nsipc_connect>
+  8017d3:	83 c4 10             	add    $0x10,%esp
+}
+  8017d6:	c9                   	leave
+  8017d7:	c3                   	ret
+
+008017d8 <listen>:
+{
+  8017d8:	55                   	push   %ebp
+  8017d9:	89 e5                	mov    %esp,%ebp
+  8017db:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8017de:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017e1:	e8 b0 fe ff ff       	call   801696 <fd2sockid>
+  8017e6:	85 c0                	test   %eax,%eax
+  8017e8:	78 0f                	js     8017f9 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8017ea:	83 ec 08             	sub    $0x8,%esp
+  8017ed:	ff 75 0c             	push   0xc(%ebp)
+  8017f0:	50                   	push   %eax
+  8017f1:	e8 6b 01 00 00       	call   801961 <nsipc_listen>
+  8017f6:	83 c4 10             	add    $0x10,%esp
+}
+  8017f9:	c9                   	leave
+  8017fa:	c3                   	ret
+
+008017fb <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8017fb:	55                   	push   %ebp
+  8017fc:	89 e5                	mov    %esp,%ebp
+  8017fe:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801801:	ff 75 10             	push   0x10(%ebp)
+  801804:	ff 75 0c             	push   0xc(%ebp)
+  801807:	ff 75 08             	push   0x8(%ebp)
+  80180a:	e8 41 02 00 00       	call   801a50 <nsipc_socket>
+  80180f:	83 c4 10             	add    $0x10,%esp
+  801812:	85 c0                	test   %eax,%eax
+  801814:	78 05                	js     80181b <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801816:	e8 ab fe ff ff       	call   8016c6 <alloc_sockfd>
+}
+  80181b:	c9                   	leave
+  80181c:	c3                   	ret
+
+0080181d <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80181d:	55                   	push   %ebp
+  80181e:	89 e5                	mov    %esp,%ebp
+  801820:	53                   	push   %ebx
+  801821:	83 ec 04             	sub    $0x4,%esp
+  801824:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801826:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  80182d:	74 26                	je     801855 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  80182f:	6a 07                	push   $0x7
+  801831:	68 00 60 80 00       	push   $0x806000
+  801836:	53                   	push   %ebx
+  801837:	ff 35 04 40 80 00    	push   0x804004
+  80183d:	e8 b0 07 00 00       	call   801ff2 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801842:	83 c4 0c             	add    $0xc,%esp
+  801845:	6a 00                	push   $0x0
+  801847:	6a 00                	push   $0x0
+  801849:	6a 00                	push   $0x0
+  80184b:	e8 2e 07 00 00       	call   801f7e <ipc_recv>
+}
+  801850:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801853:	c9                   	leave
+  801854:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801855:	83 ec 0c             	sub    $0xc,%esp
+  801858:	6a 02                	push   $0x2
+  80185a:	e8 e7 07 00 00       	call   802046 <ipc_find_env>
+  80185f:	a3 04 40 80 00       	mov    %eax,0x804004
+  801864:	83 c4 10             	add    $0x10,%esp
+  801867:	eb c6                	jmp    80182f <nsipc+0x12>
+
+00801869 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801869:	55                   	push   %ebp
+  80186a:	89 e5                	mov    %esp,%ebp
+  80186c:	56                   	push   %esi
+  80186d:	53                   	push   %ebx
+  80186e:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801871:	8b 45 08             	mov    0x8(%ebp),%eax
+  801874:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801879:	8b 06                	mov    (%esi),%eax
+  80187b:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801880:	b8 01 00 00 00       	mov    $0x1,%eax
+  801885:	e8 93 ff ff ff       	call   80181d <nsipc>
+  80188a:	89 c3                	mov    %eax,%ebx
+  80188c:	85 c0                	test   %eax,%eax
+  80188e:	79 09                	jns    801899 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801890:	89 d8                	mov    %ebx,%eax
+  801892:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801895:	5b                   	pop    %ebx
+  801896:	5e                   	pop    %esi
+  801897:	5d                   	pop    %ebp
+  801898:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801899:	83 ec 04             	sub    $0x4,%esp
+  80189c:	ff 35 10 60 80 00    	push   0x806010
+  8018a2:	68 00 60 80 00       	push   $0x806000
+  8018a7:	ff 75 0c             	push   0xc(%ebp)
+  8018aa:	e8 3f f0 ff ff       	call   8008ee <memmove>
+		*addrlen = ret->ret_addrlen;
+  8018af:	a1 10 60 80 00       	mov    0x806010,%eax
+  8018b4:	89 06                	mov    %eax,(%esi)
+  8018b6:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8018b9:	eb d5                	jmp    801890 <nsipc_accept+0x27>
+
+008018bb <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8018bb:	55                   	push   %ebp
+  8018bc:	89 e5                	mov    %esp,%ebp
+  8018be:	53                   	push   %ebx
+  8018bf:	83 ec 08             	sub    $0x8,%esp
+  8018c2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8018c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018c8:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8018cd:	53                   	push   %ebx
+  8018ce:	ff 75 0c             	push   0xc(%ebp)
+  8018d1:	68 04 60 80 00       	push   $0x806004
+  8018d6:	e8 13 f0 ff ff       	call   8008ee <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8018db:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  8018e1:	b8 02 00 00 00       	mov    $0x2,%eax
+  8018e6:	e8 32 ff ff ff       	call   80181d <nsipc>
+}
+  8018eb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018ee:	c9                   	leave
+  8018ef:	c3                   	ret
+
+008018f0 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8018f0:	55                   	push   %ebp
+  8018f1:	89 e5                	mov    %esp,%ebp
+  8018f3:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8018f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018f9:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  8018fe:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801901:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  801906:	b8 03 00 00 00       	mov    $0x3,%eax
+  80190b:	e8 0d ff ff ff       	call   80181d <nsipc>
+}
+  801910:	c9                   	leave
+  801911:	c3                   	ret
+
+00801912 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801912:	55                   	push   %ebp
+  801913:	89 e5                	mov    %esp,%ebp
+  801915:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801918:	8b 45 08             	mov    0x8(%ebp),%eax
+  80191b:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  801920:	b8 04 00 00 00       	mov    $0x4,%eax
+  801925:	e8 f3 fe ff ff       	call   80181d <nsipc>
+}
+  80192a:	c9                   	leave
+  80192b:	c3                   	ret
+
+0080192c <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80192c:	55                   	push   %ebp
+  80192d:	89 e5                	mov    %esp,%ebp
+  80192f:	53                   	push   %ebx
+  801930:	83 ec 08             	sub    $0x8,%esp
+  801933:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801936:	8b 45 08             	mov    0x8(%ebp),%eax
+  801939:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  80193e:	53                   	push   %ebx
+  80193f:	ff 75 0c             	push   0xc(%ebp)
+  801942:	68 04 60 80 00       	push   $0x806004
+  801947:	e8 a2 ef ff ff       	call   8008ee <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  80194c:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  801952:	b8 05 00 00 00       	mov    $0x5,%eax
+  801957:	e8 c1 fe ff ff       	call   80181d <nsipc>
+}
+  80195c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80195f:	c9                   	leave
+  801960:	c3                   	ret
+
+00801961 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801961:	55                   	push   %ebp
+  801962:	89 e5                	mov    %esp,%ebp
+  801964:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801967:	8b 45 08             	mov    0x8(%ebp),%eax
+  80196a:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  80196f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801972:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  801977:	b8 06 00 00 00       	mov    $0x6,%eax
+  80197c:	e8 9c fe ff ff       	call   80181d <nsipc>
+}
+  801981:	c9                   	leave
+  801982:	c3                   	ret
+
+00801983 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801983:	55                   	push   %ebp
+  801984:	89 e5                	mov    %esp,%ebp
+  801986:	56                   	push   %esi
+  801987:	53                   	push   %ebx
+  801988:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80198b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80198e:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  801993:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  801999:	8b 45 14             	mov    0x14(%ebp),%eax
+  80199c:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8019a1:	b8 07 00 00 00       	mov    $0x7,%eax
+  8019a6:	e8 72 fe ff ff       	call   80181d <nsipc>
+  8019ab:	89 c3                	mov    %eax,%ebx
+  8019ad:	85 c0                	test   %eax,%eax
+  8019af:	78 22                	js     8019d3 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8019b1:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8019b6:	39 c6                	cmp    %eax,%esi
+  8019b8:	0f 4e c6             	cmovle %esi,%eax
+  8019bb:	39 c3                	cmp    %eax,%ebx
+  8019bd:	7f 1d                	jg     8019dc <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8019bf:	83 ec 04             	sub    $0x4,%esp
+  8019c2:	53                   	push   %ebx
+  8019c3:	68 00 60 80 00       	push   $0x806000
+  8019c8:	ff 75 0c             	push   0xc(%ebp)
+  8019cb:	e8 1e ef ff ff       	call   8008ee <memmove>
+  8019d0:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8019d3:	89 d8                	mov    %ebx,%eax
+  8019d5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019d8:	5b                   	pop    %ebx
+  8019d9:	5e                   	pop    %esi
+  8019da:	5d                   	pop    %ebp
+  8019db:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8019dc:	68 bf 29 80 00       	push   $0x8029bf
+  8019e1:	68 87 29 80 00       	push   $0x802987
+  8019e6:	6a 62                	push   $0x62
+  8019e8:	68 d4 29 80 00       	push   $0x8029d4
+  8019ed:	e8 46 05 00 00       	call   801f38 <_panic>
+
+008019f2 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8019f2:	55                   	push   %ebp
+  8019f3:	89 e5                	mov    %esp,%ebp
+  8019f5:	53                   	push   %ebx
+  8019f6:	83 ec 04             	sub    $0x4,%esp
+  8019f9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8019fc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019ff:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  801a04:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801a0a:	7f 2e                	jg     801a3a <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801a0c:	83 ec 04             	sub    $0x4,%esp
+  801a0f:	53                   	push   %ebx
+  801a10:	ff 75 0c             	push   0xc(%ebp)
+  801a13:	68 0c 60 80 00       	push   $0x80600c
+  801a18:	e8 d1 ee ff ff       	call   8008ee <memmove>
+	nsipcbuf.send.req_size = size;
+  801a1d:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  801a23:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a26:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  801a2b:	b8 08 00 00 00       	mov    $0x8,%eax
+  801a30:	e8 e8 fd ff ff       	call   80181d <nsipc>
+}
+  801a35:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a38:	c9                   	leave
+  801a39:	c3                   	ret
+	assert(size < 1600);
+  801a3a:	68 e0 29 80 00       	push   $0x8029e0
+  801a3f:	68 87 29 80 00       	push   $0x802987
+  801a44:	6a 6d                	push   $0x6d
+  801a46:	68 d4 29 80 00       	push   $0x8029d4
+  801a4b:	e8 e8 04 00 00       	call   801f38 <_panic>
+
+00801a50 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801a50:	55                   	push   %ebp
+  801a51:	89 e5                	mov    %esp,%ebp
+  801a53:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801a56:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a59:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  801a5e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a61:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  801a66:	8b 45 10             	mov    0x10(%ebp),%eax
+  801a69:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  801a6e:	b8 09 00 00 00       	mov    $0x9,%eax
+  801a73:	e8 a5 fd ff ff       	call   80181d <nsipc>
+}
+  801a78:	c9                   	leave
+  801a79:	c3                   	ret
+
+00801a7a <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801a7a:	55                   	push   %ebp
+  801a7b:	89 e5                	mov    %esp,%ebp
+  801a7d:	56                   	push   %esi
+  801a7e:	53                   	push   %ebx
+  801a7f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801a82:	83 ec 0c             	sub    $0xc,%esp
+  801a85:	ff 75 08             	push   0x8(%ebp)
+  801a88:	e8 aa f3 ff ff       	call   800e37 <fd2data>
+  801a8d:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801a8f:	83 c4 08             	add    $0x8,%esp
+  801a92:	68 ec 29 80 00       	push   $0x8029ec
+  801a97:	53                   	push   %ebx
+  801a98:	e8 cb ec ff ff       	call   800768 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801a9d:	8b 46 04             	mov    0x4(%esi),%eax
+  801aa0:	2b 06                	sub    (%esi),%eax
+  801aa2:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  801aa8:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801aaf:	00 00 00 
+	stat->st_dev = &devpipe;
+  801ab2:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  801ab9:	30 80 00 
+	return 0;
+}
+  801abc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ac1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ac4:	5b                   	pop    %ebx
+  801ac5:	5e                   	pop    %esi
+  801ac6:	5d                   	pop    %ebp
+  801ac7:	c3                   	ret
+
+00801ac8 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801ac8:	55                   	push   %ebp
+  801ac9:	89 e5                	mov    %esp,%ebp
+  801acb:	53                   	push   %ebx
+  801acc:	83 ec 0c             	sub    $0xc,%esp
+  801acf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801ad2:	53                   	push   %ebx
+  801ad3:	6a 00                	push   $0x0
+  801ad5:	e8 ff f0 ff ff       	call   800bd9 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801ada:	89 1c 24             	mov    %ebx,(%esp)
+  801add:	e8 55 f3 ff ff       	call   800e37 <fd2data>
+  801ae2:	83 c4 08             	add    $0x8,%esp
+  801ae5:	50                   	push   %eax
+  801ae6:	6a 00                	push   $0x0
+  801ae8:	e8 ec f0 ff ff       	call   800bd9 <sys_page_unmap>
+}
+  801aed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801af0:	c9                   	leave
+  801af1:	c3                   	ret
+
+00801af2 <_pipeisclosed>:
+{
+  801af2:	55                   	push   %ebp
+  801af3:	89 e5                	mov    %esp,%ebp
+  801af5:	57                   	push   %edi
+  801af6:	56                   	push   %esi
+  801af7:	53                   	push   %ebx
+  801af8:	83 ec 1c             	sub    $0x1c,%esp
+  801afb:	89 c7                	mov    %eax,%edi
+  801afd:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801aff:	a1 08 40 80 00       	mov    0x804008,%eax
+  801b04:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801b07:	83 ec 0c             	sub    $0xc,%esp
+  801b0a:	57                   	push   %edi
+  801b0b:	e8 75 05 00 00       	call   802085 <pageref>
+  801b10:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801b13:	89 34 24             	mov    %esi,(%esp)
+  801b16:	e8 6a 05 00 00       	call   802085 <pageref>
+		nn = thisenv->env_runs;
+  801b1b:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801b21:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801b24:	83 c4 10             	add    $0x10,%esp
+  801b27:	39 cb                	cmp    %ecx,%ebx
+  801b29:	74 1b                	je     801b46 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801b2b:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801b2e:	75 cf                	jne    801aff <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801b30:	8b 42 58             	mov    0x58(%edx),%eax
+  801b33:	6a 01                	push   $0x1
+  801b35:	50                   	push   %eax
+  801b36:	53                   	push   %ebx
+  801b37:	68 f3 29 80 00       	push   $0x8029f3
+  801b3c:	e8 6e e6 ff ff       	call   8001af <cprintf>
+  801b41:	83 c4 10             	add    $0x10,%esp
+  801b44:	eb b9                	jmp    801aff <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801b46:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801b49:	0f 94 c0             	sete   %al
+  801b4c:	0f b6 c0             	movzbl %al,%eax
+}
+  801b4f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b52:	5b                   	pop    %ebx
+  801b53:	5e                   	pop    %esi
+  801b54:	5f                   	pop    %edi
+  801b55:	5d                   	pop    %ebp
+  801b56:	c3                   	ret
+
+00801b57 <devpipe_write>:
+{
+  801b57:	55                   	push   %ebp
+  801b58:	89 e5                	mov    %esp,%ebp
+  801b5a:	57                   	push   %edi
+  801b5b:	56                   	push   %esi
+  801b5c:	53                   	push   %ebx
+  801b5d:	83 ec 28             	sub    $0x28,%esp
+  801b60:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801b63:	56                   	push   %esi
+  801b64:	e8 ce f2 ff ff       	call   800e37 <fd2data>
+  801b69:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801b6b:	83 c4 10             	add    $0x10,%esp
+  801b6e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b73:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801b76:	75 09                	jne    801b81 <devpipe_write+0x2a>
+	return i;
+  801b78:	89 f8                	mov    %edi,%eax
+  801b7a:	eb 23                	jmp    801b9f <devpipe_write+0x48>
+			sys_yield();
+  801b7c:	e8 b4 ef ff ff       	call   800b35 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801b81:	8b 43 04             	mov    0x4(%ebx),%eax
+  801b84:	8b 0b                	mov    (%ebx),%ecx
+  801b86:	8d 51 20             	lea    0x20(%ecx),%edx
+  801b89:	39 d0                	cmp    %edx,%eax
+  801b8b:	72 1a                	jb     801ba7 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  801b8d:	89 da                	mov    %ebx,%edx
+  801b8f:	89 f0                	mov    %esi,%eax
+  801b91:	e8 5c ff ff ff       	call   801af2 <_pipeisclosed>
+  801b96:	85 c0                	test   %eax,%eax
+  801b98:	74 e2                	je     801b7c <devpipe_write+0x25>
+				return 0;
+  801b9a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b9f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ba2:	5b                   	pop    %ebx
+  801ba3:	5e                   	pop    %esi
+  801ba4:	5f                   	pop    %edi
+  801ba5:	5d                   	pop    %ebp
+  801ba6:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801ba7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801baa:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801bae:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801bb1:	89 c2                	mov    %eax,%edx
+  801bb3:	c1 fa 1f             	sar    $0x1f,%edx
+  801bb6:	89 d1                	mov    %edx,%ecx
+  801bb8:	c1 e9 1b             	shr    $0x1b,%ecx
+  801bbb:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801bbe:	83 e2 1f             	and    $0x1f,%edx
+  801bc1:	29 ca                	sub    %ecx,%edx
+  801bc3:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801bc7:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  801bcb:	83 c0 01             	add    $0x1,%eax
+  801bce:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  801bd1:	83 c7 01             	add    $0x1,%edi
+  801bd4:	eb 9d                	jmp    801b73 <devpipe_write+0x1c>
+
+00801bd6 <devpipe_read>:
+{
+  801bd6:	55                   	push   %ebp
+  801bd7:	89 e5                	mov    %esp,%ebp
+  801bd9:	57                   	push   %edi
+  801bda:	56                   	push   %esi
+  801bdb:	53                   	push   %ebx
+  801bdc:	83 ec 18             	sub    $0x18,%esp
+  801bdf:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  801be2:	57                   	push   %edi
+  801be3:	e8 4f f2 ff ff       	call   800e37 <fd2data>
+  801be8:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801bea:	83 c4 10             	add    $0x10,%esp
+  801bed:	be 00 00 00 00       	mov    $0x0,%esi
+  801bf2:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801bf5:	75 13                	jne    801c0a <devpipe_read+0x34>
+	return i;
+  801bf7:	89 f0                	mov    %esi,%eax
+  801bf9:	eb 02                	jmp    801bfd <devpipe_read+0x27>
+				return i;
+  801bfb:	89 f0                	mov    %esi,%eax
+}
+  801bfd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c00:	5b                   	pop    %ebx
+  801c01:	5e                   	pop    %esi
+  801c02:	5f                   	pop    %edi
+  801c03:	5d                   	pop    %ebp
+  801c04:	c3                   	ret
+			sys_yield();
+  801c05:	e8 2b ef ff ff       	call   800b35 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  801c0a:	8b 03                	mov    (%ebx),%eax
+  801c0c:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801c0f:	75 18                	jne    801c29 <devpipe_read+0x53>
+			if (i > 0)
+  801c11:	85 f6                	test   %esi,%esi
+  801c13:	75 e6                	jne    801bfb <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  801c15:	89 da                	mov    %ebx,%edx
+  801c17:	89 f8                	mov    %edi,%eax
+  801c19:	e8 d4 fe ff ff       	call   801af2 <_pipeisclosed>
+  801c1e:	85 c0                	test   %eax,%eax
+  801c20:	74 e3                	je     801c05 <devpipe_read+0x2f>
+				return 0;
+  801c22:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c27:	eb d4                	jmp    801bfd <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801c29:	99                   	cltd
+  801c2a:	c1 ea 1b             	shr    $0x1b,%edx
+  801c2d:	01 d0                	add    %edx,%eax
+  801c2f:	83 e0 1f             	and    $0x1f,%eax
+  801c32:	29 d0                	sub    %edx,%eax
+  801c34:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801c39:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c3c:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  801c3f:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  801c42:	83 c6 01             	add    $0x1,%esi
+  801c45:	eb ab                	jmp    801bf2 <devpipe_read+0x1c>
+
+00801c47 <pipe>:
+{
+  801c47:	55                   	push   %ebp
+  801c48:	89 e5                	mov    %esp,%ebp
+  801c4a:	56                   	push   %esi
+  801c4b:	53                   	push   %ebx
+  801c4c:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801c4f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c52:	50                   	push   %eax
+  801c53:	e8 f6 f1 ff ff       	call   800e4e <fd_alloc>
+  801c58:	89 c3                	mov    %eax,%ebx
+  801c5a:	83 c4 10             	add    $0x10,%esp
+  801c5d:	85 c0                	test   %eax,%eax
+  801c5f:	0f 88 23 01 00 00    	js     801d88 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801c65:	83 ec 04             	sub    $0x4,%esp
+  801c68:	68 07 04 00 00       	push   $0x407
+  801c6d:	ff 75 f4             	push   -0xc(%ebp)
+  801c70:	6a 00                	push   $0x0
+  801c72:	e8 dd ee ff ff       	call   800b54 <sys_page_alloc>
+  801c77:	89 c3                	mov    %eax,%ebx
+  801c79:	83 c4 10             	add    $0x10,%esp
+  801c7c:	85 c0                	test   %eax,%eax
+  801c7e:	0f 88 04 01 00 00    	js     801d88 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801c84:	83 ec 0c             	sub    $0xc,%esp
+  801c87:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c8a:	50                   	push   %eax
+  801c8b:	e8 be f1 ff ff       	call   800e4e <fd_alloc>
+  801c90:	89 c3                	mov    %eax,%ebx
+  801c92:	83 c4 10             	add    $0x10,%esp
+  801c95:	85 c0                	test   %eax,%eax
+  801c97:	0f 88 db 00 00 00    	js     801d78 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801c9d:	83 ec 04             	sub    $0x4,%esp
+  801ca0:	68 07 04 00 00       	push   $0x407
+  801ca5:	ff 75 f0             	push   -0x10(%ebp)
+  801ca8:	6a 00                	push   $0x0
+  801caa:	e8 a5 ee ff ff       	call   800b54 <sys_page_alloc>
+  801caf:	89 c3                	mov    %eax,%ebx
+  801cb1:	83 c4 10             	add    $0x10,%esp
+  801cb4:	85 c0                	test   %eax,%eax
+  801cb6:	0f 88 bc 00 00 00    	js     801d78 <pipe+0x131>
+	va = fd2data(fd0);
+  801cbc:	83 ec 0c             	sub    $0xc,%esp
+  801cbf:	ff 75 f4             	push   -0xc(%ebp)
+  801cc2:	e8 70 f1 ff ff       	call   800e37 <fd2data>
+  801cc7:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801cc9:	83 c4 0c             	add    $0xc,%esp
+  801ccc:	68 07 04 00 00       	push   $0x407
+  801cd1:	50                   	push   %eax
+  801cd2:	6a 00                	push   $0x0
+  801cd4:	e8 7b ee ff ff       	call   800b54 <sys_page_alloc>
+  801cd9:	89 c3                	mov    %eax,%ebx
+  801cdb:	83 c4 10             	add    $0x10,%esp
+  801cde:	85 c0                	test   %eax,%eax
+  801ce0:	0f 88 82 00 00 00    	js     801d68 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801ce6:	83 ec 0c             	sub    $0xc,%esp
+  801ce9:	ff 75 f0             	push   -0x10(%ebp)
+  801cec:	e8 46 f1 ff ff       	call   800e37 <fd2data>
+  801cf1:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801cf8:	50                   	push   %eax
+  801cf9:	6a 00                	push   $0x0
+  801cfb:	56                   	push   %esi
+  801cfc:	6a 00                	push   $0x0
+  801cfe:	e8 94 ee ff ff       	call   800b97 <sys_page_map>
+  801d03:	89 c3                	mov    %eax,%ebx
+  801d05:	83 c4 20             	add    $0x20,%esp
+  801d08:	85 c0                	test   %eax,%eax
+  801d0a:	78 4e                	js     801d5a <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  801d0c:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  801d11:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801d14:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  801d16:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801d19:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  801d20:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801d23:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  801d25:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801d28:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  801d2f:	83 ec 0c             	sub    $0xc,%esp
+  801d32:	ff 75 f4             	push   -0xc(%ebp)
+  801d35:	e8 ed f0 ff ff       	call   800e27 <fd2num>
+  801d3a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801d3d:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  801d3f:	83 c4 04             	add    $0x4,%esp
+  801d42:	ff 75 f0             	push   -0x10(%ebp)
+  801d45:	e8 dd f0 ff ff       	call   800e27 <fd2num>
+  801d4a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801d4d:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  801d50:	83 c4 10             	add    $0x10,%esp
+  801d53:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d58:	eb 2e                	jmp    801d88 <pipe+0x141>
+	sys_page_unmap(0, va);
+  801d5a:	83 ec 08             	sub    $0x8,%esp
+  801d5d:	56                   	push   %esi
+  801d5e:	6a 00                	push   $0x0
+  801d60:	e8 74 ee ff ff       	call   800bd9 <sys_page_unmap>
+  801d65:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  801d68:	83 ec 08             	sub    $0x8,%esp
+  801d6b:	ff 75 f0             	push   -0x10(%ebp)
+  801d6e:	6a 00                	push   $0x0
+  801d70:	e8 64 ee ff ff       	call   800bd9 <sys_page_unmap>
+  801d75:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  801d78:	83 ec 08             	sub    $0x8,%esp
+  801d7b:	ff 75 f4             	push   -0xc(%ebp)
+  801d7e:	6a 00                	push   $0x0
+  801d80:	e8 54 ee ff ff       	call   800bd9 <sys_page_unmap>
+  801d85:	83 c4 10             	add    $0x10,%esp
+}
+  801d88:	89 d8                	mov    %ebx,%eax
+  801d8a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d8d:	5b                   	pop    %ebx
+  801d8e:	5e                   	pop    %esi
+  801d8f:	5d                   	pop    %ebp
+  801d90:	c3                   	ret
+
+00801d91 <pipeisclosed>:
+{
+  801d91:	55                   	push   %ebp
+  801d92:	89 e5                	mov    %esp,%ebp
+  801d94:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d97:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d9a:	50                   	push   %eax
+  801d9b:	ff 75 08             	push   0x8(%ebp)
+  801d9e:	e8 01 f1 ff ff       	call   800ea4 <fd_lookup>
+  801da3:	83 c4 10             	add    $0x10,%esp
+  801da6:	85 c0                	test   %eax,%eax
+  801da8:	78 18                	js     801dc2 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  801daa:	83 ec 0c             	sub    $0xc,%esp
+  801dad:	ff 75 f4             	push   -0xc(%ebp)
+  801db0:	e8 82 f0 ff ff       	call   800e37 <fd2data>
+  801db5:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  801db7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dba:	e8 33 fd ff ff       	call   801af2 <_pipeisclosed>
+  801dbf:	83 c4 10             	add    $0x10,%esp
+}
+  801dc2:	c9                   	leave
+  801dc3:	c3                   	ret
+
+00801dc4 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  801dc4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dc9:	c3                   	ret
+
+00801dca <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  801dca:	55                   	push   %ebp
+  801dcb:	89 e5                	mov    %esp,%ebp
+  801dcd:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  801dd0:	68 0b 2a 80 00       	push   $0x802a0b
+  801dd5:	ff 75 0c             	push   0xc(%ebp)
+  801dd8:	e8 8b e9 ff ff       	call   800768 <strcpy>
+	return 0;
+}
+  801ddd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801de2:	c9                   	leave
+  801de3:	c3                   	ret
+
+00801de4 <devcons_write>:
+{
+  801de4:	55                   	push   %ebp
+  801de5:	89 e5                	mov    %esp,%ebp
+  801de7:	57                   	push   %edi
+  801de8:	56                   	push   %esi
+  801de9:	53                   	push   %ebx
+  801dea:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  801df0:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  801df5:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  801dfb:	eb 2e                	jmp    801e2b <devcons_write+0x47>
+		m = n - tot;
+  801dfd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801e00:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  801e02:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801e07:	39 c3                	cmp    %eax,%ebx
+  801e09:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  801e0c:	83 ec 04             	sub    $0x4,%esp
+  801e0f:	53                   	push   %ebx
+  801e10:	89 f0                	mov    %esi,%eax
+  801e12:	03 45 0c             	add    0xc(%ebp),%eax
+  801e15:	50                   	push   %eax
+  801e16:	57                   	push   %edi
+  801e17:	e8 d2 ea ff ff       	call   8008ee <memmove>
+		sys_cputs(buf, m);
+  801e1c:	83 c4 08             	add    $0x8,%esp
+  801e1f:	53                   	push   %ebx
+  801e20:	57                   	push   %edi
+  801e21:	e8 72 ec ff ff       	call   800a98 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  801e26:	01 de                	add    %ebx,%esi
+  801e28:	83 c4 10             	add    $0x10,%esp
+  801e2b:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801e2e:	72 cd                	jb     801dfd <devcons_write+0x19>
+}
+  801e30:	89 f0                	mov    %esi,%eax
+  801e32:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e35:	5b                   	pop    %ebx
+  801e36:	5e                   	pop    %esi
+  801e37:	5f                   	pop    %edi
+  801e38:	5d                   	pop    %ebp
+  801e39:	c3                   	ret
+
+00801e3a <devcons_read>:
+{
+  801e3a:	55                   	push   %ebp
+  801e3b:	89 e5                	mov    %esp,%ebp
+  801e3d:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  801e40:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e45:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801e49:	75 07                	jne    801e52 <devcons_read+0x18>
+  801e4b:	eb 1f                	jmp    801e6c <devcons_read+0x32>
+		sys_yield();
+  801e4d:	e8 e3 ec ff ff       	call   800b35 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  801e52:	e8 5f ec ff ff       	call   800ab6 <sys_cgetc>
+  801e57:	85 c0                	test   %eax,%eax
+  801e59:	74 f2                	je     801e4d <devcons_read+0x13>
+	if (c < 0)
+  801e5b:	78 0f                	js     801e6c <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  801e5d:	83 f8 04             	cmp    $0x4,%eax
+  801e60:	74 0c                	je     801e6e <devcons_read+0x34>
+	*(char*)vbuf = c;
+  801e62:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e65:	88 02                	mov    %al,(%edx)
+	return 1;
+  801e67:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  801e6c:	c9                   	leave
+  801e6d:	c3                   	ret
+		return 0;
+  801e6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e73:	eb f7                	jmp    801e6c <devcons_read+0x32>
+
+00801e75 <cputchar>:
+{
+  801e75:	55                   	push   %ebp
+  801e76:	89 e5                	mov    %esp,%ebp
+  801e78:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  801e7b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e7e:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  801e81:	6a 01                	push   $0x1
+  801e83:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801e86:	50                   	push   %eax
+  801e87:	e8 0c ec ff ff       	call   800a98 <sys_cputs>
+}
+  801e8c:	83 c4 10             	add    $0x10,%esp
+  801e8f:	c9                   	leave
+  801e90:	c3                   	ret
+
+00801e91 <getchar>:
+{
+  801e91:	55                   	push   %ebp
+  801e92:	89 e5                	mov    %esp,%ebp
+  801e94:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  801e97:	6a 01                	push   $0x1
+  801e99:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801e9c:	50                   	push   %eax
+  801e9d:	6a 00                	push   $0x0
+  801e9f:	e8 66 f2 ff ff       	call   80110a <read>
+	if (r < 0)
+  801ea4:	83 c4 10             	add    $0x10,%esp
+  801ea7:	85 c0                	test   %eax,%eax
+  801ea9:	78 06                	js     801eb1 <getchar+0x20>
+	if (r < 1)
+  801eab:	74 06                	je     801eb3 <getchar+0x22>
+	return c;
+  801ead:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  801eb1:	c9                   	leave
+  801eb2:	c3                   	ret
+		return -E_EOF;
+  801eb3:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  801eb8:	eb f7                	jmp    801eb1 <getchar+0x20>
+
+00801eba <iscons>:
+{
+  801eba:	55                   	push   %ebp
+  801ebb:	89 e5                	mov    %esp,%ebp
+  801ebd:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801ec0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ec3:	50                   	push   %eax
+  801ec4:	ff 75 08             	push   0x8(%ebp)
+  801ec7:	e8 d8 ef ff ff       	call   800ea4 <fd_lookup>
+  801ecc:	83 c4 10             	add    $0x10,%esp
+  801ecf:	85 c0                	test   %eax,%eax
+  801ed1:	78 11                	js     801ee4 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  801ed3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ed6:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  801edc:	39 10                	cmp    %edx,(%eax)
+  801ede:	0f 94 c0             	sete   %al
+  801ee1:	0f b6 c0             	movzbl %al,%eax
+}
+  801ee4:	c9                   	leave
+  801ee5:	c3                   	ret
+
+00801ee6 <opencons>:
+{
+  801ee6:	55                   	push   %ebp
+  801ee7:	89 e5                	mov    %esp,%ebp
+  801ee9:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  801eec:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801eef:	50                   	push   %eax
+  801ef0:	e8 59 ef ff ff       	call   800e4e <fd_alloc>
+  801ef5:	83 c4 10             	add    $0x10,%esp
+  801ef8:	85 c0                	test   %eax,%eax
+  801efa:	78 3a                	js     801f36 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  801efc:	83 ec 04             	sub    $0x4,%esp
+  801eff:	68 07 04 00 00       	push   $0x407
+  801f04:	ff 75 f4             	push   -0xc(%ebp)
+  801f07:	6a 00                	push   $0x0
+  801f09:	e8 46 ec ff ff       	call   800b54 <sys_page_alloc>
+  801f0e:	83 c4 10             	add    $0x10,%esp
+  801f11:	85 c0                	test   %eax,%eax
+  801f13:	78 21                	js     801f36 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  801f15:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f18:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  801f1e:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  801f20:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f23:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  801f2a:	83 ec 0c             	sub    $0xc,%esp
+  801f2d:	50                   	push   %eax
+  801f2e:	e8 f4 ee ff ff       	call   800e27 <fd2num>
+  801f33:	83 c4 10             	add    $0x10,%esp
+}
+  801f36:	c9                   	leave
+  801f37:	c3                   	ret
+
+00801f38 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  801f38:	55                   	push   %ebp
+  801f39:	89 e5                	mov    %esp,%ebp
+  801f3b:	56                   	push   %esi
+  801f3c:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  801f3d:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  801f40:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  801f46:	e8 cb eb ff ff       	call   800b16 <sys_getenvid>
+  801f4b:	83 ec 0c             	sub    $0xc,%esp
+  801f4e:	ff 75 0c             	push   0xc(%ebp)
+  801f51:	ff 75 08             	push   0x8(%ebp)
+  801f54:	56                   	push   %esi
+  801f55:	50                   	push   %eax
+  801f56:	68 18 2a 80 00       	push   $0x802a18
+  801f5b:	e8 4f e2 ff ff       	call   8001af <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  801f60:	83 c4 18             	add    $0x18,%esp
+  801f63:	53                   	push   %ebx
+  801f64:	ff 75 10             	push   0x10(%ebp)
+  801f67:	e8 f2 e1 ff ff       	call   80015e <vcprintf>
+	cprintf("\n");
+  801f6c:	c7 04 24 ad 25 80 00 	movl   $0x8025ad,(%esp)
+  801f73:	e8 37 e2 ff ff       	call   8001af <cprintf>
+  801f78:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  801f7b:	cc                   	int3
+	while (1)
+  801f7c:	eb fd                	jmp    801f7b <_panic+0x43>
+
+00801f7e <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  801f7e:	55                   	push   %ebp
+  801f7f:	89 e5                	mov    %esp,%ebp
+  801f81:	56                   	push   %esi
+  801f82:	53                   	push   %ebx
+  801f83:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f86:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f89:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  801f8c:	85 c0                	test   %eax,%eax
+  801f8e:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801f93:	0f 44 c2             	cmove  %edx,%eax
+  801f96:	83 ec 0c             	sub    $0xc,%esp
+  801f99:	50                   	push   %eax
+  801f9a:	e8 65 ed ff ff       	call   800d04 <sys_ipc_recv>
+
+  if (from_env_store)
+  801f9f:	83 c4 10             	add    $0x10,%esp
+  801fa2:	85 f6                	test   %esi,%esi
+  801fa4:	74 17                	je     801fbd <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  801fa6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fab:	85 c0                	test   %eax,%eax
+  801fad:	75 0c                	jne    801fbb <ipc_recv+0x3d>
+  801faf:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801fb5:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  801fbb:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  801fbd:	85 db                	test   %ebx,%ebx
+  801fbf:	74 2b                	je     801fec <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  801fc1:	85 c0                	test   %eax,%eax
+  801fc3:	74 0d                	je     801fd2 <ipc_recv+0x54>
+  801fc5:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  801fcb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fce:	5b                   	pop    %ebx
+  801fcf:	5e                   	pop    %esi
+  801fd0:	5d                   	pop    %ebp
+  801fd1:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  801fd2:	a1 08 40 80 00       	mov    0x804008,%eax
+  801fd7:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  801fdd:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  801fdf:	a1 08 40 80 00       	mov    0x804008,%eax
+  801fe4:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  801fea:	eb df                	jmp    801fcb <ipc_recv+0x4d>
+  801fec:	85 c0                	test   %eax,%eax
+  801fee:	75 db                	jne    801fcb <ipc_recv+0x4d>
+  801ff0:	eb ed                	jmp    801fdf <ipc_recv+0x61>
+
+00801ff2 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  801ff2:	55                   	push   %ebp
+  801ff3:	89 e5                	mov    %esp,%ebp
+  801ff5:	57                   	push   %edi
+  801ff6:	56                   	push   %esi
+  801ff7:	53                   	push   %ebx
+  801ff8:	83 ec 0c             	sub    $0xc,%esp
+  801ffb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801ffe:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802001:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  802004:	85 db                	test   %ebx,%ebx
+  802006:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80200b:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  80200e:	ff 75 14             	push   0x14(%ebp)
+  802011:	53                   	push   %ebx
+  802012:	56                   	push   %esi
+  802013:	57                   	push   %edi
+  802014:	e8 c8 ec ff ff       	call   800ce1 <sys_ipc_try_send>
+  802019:	83 c4 10             	add    $0x10,%esp
+  80201c:	85 c0                	test   %eax,%eax
+  80201e:	74 1e                	je     80203e <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  802020:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802023:	75 07                	jne    80202c <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  802025:	e8 0b eb ff ff       	call   800b35 <sys_yield>
+  80202a:	eb e2                	jmp    80200e <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  80202c:	50                   	push   %eax
+  80202d:	68 3b 2a 80 00       	push   $0x802a3b
+  802032:	6a 3c                	push   $0x3c
+  802034:	68 48 2a 80 00       	push   $0x802a48
+  802039:	e8 fa fe ff ff       	call   801f38 <_panic>
+  }
+
+#endif
+}
+  80203e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802041:	5b                   	pop    %ebx
+  802042:	5e                   	pop    %esi
+  802043:	5f                   	pop    %edi
+  802044:	5d                   	pop    %ebp
+  802045:	c3                   	ret
+
+00802046 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  802046:	55                   	push   %ebp
+  802047:	89 e5                	mov    %esp,%ebp
+  802049:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  80204c:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  802051:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802054:	c1 e0 04             	shl    $0x4,%eax
+  802057:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80205c:	8b 40 50             	mov    0x50(%eax),%eax
+  80205f:	39 c8                	cmp    %ecx,%eax
+  802061:	74 12                	je     802075 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  802063:	83 c2 01             	add    $0x1,%edx
+  802066:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  80206c:	75 e3                	jne    802051 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  80206e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802073:	eb 0e                	jmp    802083 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  802075:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802078:	c1 e0 04             	shl    $0x4,%eax
+  80207b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802080:	8b 40 48             	mov    0x48(%eax),%eax
+  802083:	5d                   	pop    %ebp
+  802084:	c3                   	ret
+
+00802085 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802085:	55                   	push   %ebp
+  802086:	89 e5                	mov    %esp,%ebp
+  802088:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80208b:	89 c2                	mov    %eax,%edx
+  80208d:	c1 ea 16             	shr    $0x16,%edx
+  802090:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802097:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80209c:	f6 c1 01             	test   $0x1,%cl
+  80209f:	74 1c                	je     8020bd <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  8020a1:	c1 e8 0c             	shr    $0xc,%eax
+  8020a4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8020ab:	a8 01                	test   $0x1,%al
+  8020ad:	74 0e                	je     8020bd <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8020af:	c1 e8 0c             	shr    $0xc,%eax
+  8020b2:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  8020b9:	ef 
+  8020ba:	0f b7 d2             	movzwl %dx,%edx
+}
+  8020bd:	89 d0                	mov    %edx,%eax
+  8020bf:	5d                   	pop    %ebp
+  8020c0:	c3                   	ret
+  8020c1:	66 90                	xchg   %ax,%ax
+  8020c3:	66 90                	xchg   %ax,%ax
+  8020c5:	66 90                	xchg   %ax,%ax
+  8020c7:	66 90                	xchg   %ax,%ax
+  8020c9:	66 90                	xchg   %ax,%ax
+  8020cb:	66 90                	xchg   %ax,%ax
+  8020cd:	66 90                	xchg   %ax,%ax
+  8020cf:	90                   	nop
+
+008020d0 <__udivmoddi4>:
+  8020d0:	55                   	push   %ebp
+  8020d1:	57                   	push   %edi
+  8020d2:	56                   	push   %esi
+  8020d3:	53                   	push   %ebx
+  8020d4:	83 ec 24             	sub    $0x24,%esp
+  8020d7:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8020db:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8020df:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  8020e3:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8020e7:	8b 54 24 44          	mov    0x44(%esp),%edx
+  8020eb:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8020ef:	8b 44 24 40          	mov    0x40(%esp),%eax
+  8020f3:	89 d3                	mov    %edx,%ebx
+  8020f5:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8020f9:	09 c3                	or     %eax,%ebx
+  8020fb:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8020ff:	0f 84 9c 00 00 00    	je     8021a1 <__udivmoddi4+0xd1>
+  802105:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80210c:	00 
+  80210d:	31 c0                	xor    %eax,%eax
+  80210f:	31 d2                	xor    %edx,%edx
+  802111:	89 fb                	mov    %edi,%ebx
+  802113:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80211a:	00 
+  80211b:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802120:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802124:	01 c0                	add    %eax,%eax
+  802126:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80212d:	00 
+  80212e:	89 c6                	mov    %eax,%esi
+  802130:	89 d7                	mov    %edx,%edi
+  802132:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802136:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80213a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80213d:	d3 ea                	shr    %cl,%edx
+  80213f:	f6 c1 20             	test   $0x20,%cl
+  802142:	0f 45 c2             	cmovne %edx,%eax
+  802145:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802149:	83 e0 01             	and    $0x1,%eax
+  80214c:	09 fa                	or     %edi,%edx
+  80214e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802152:	89 04 24             	mov    %eax,(%esp)
+  802155:	8b 04 24             	mov    (%esp),%eax
+  802158:	89 d5                	mov    %edx,%ebp
+  80215a:	09 f0                	or     %esi,%eax
+  80215c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802160:	39 f0                	cmp    %esi,%eax
+  802162:	19 fd                	sbb    %edi,%ebp
+  802164:	72 1d                	jb     802183 <__udivmoddi4+0xb3>
+  802166:	29 f0                	sub    %esi,%eax
+  802168:	19 fa                	sbb    %edi,%edx
+  80216a:	89 cf                	mov    %ecx,%edi
+  80216c:	c1 ef 05             	shr    $0x5,%edi
+  80216f:	83 e7 01             	and    $0x1,%edi
+  802172:	89 fe                	mov    %edi,%esi
+  802174:	d3 e7                	shl    %cl,%edi
+  802176:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80217a:	83 f6 01             	xor    $0x1,%esi
+  80217d:	d3 e6                	shl    %cl,%esi
+  80217f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802183:	83 e9 01             	sub    $0x1,%ecx
+  802186:	73 98                	jae    802120 <__udivmoddi4+0x50>
+  802188:	85 db                	test   %ebx,%ebx
+  80218a:	74 05                	je     802191 <__udivmoddi4+0xc1>
+  80218c:	89 03                	mov    %eax,(%ebx)
+  80218e:	89 53 04             	mov    %edx,0x4(%ebx)
+  802191:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802195:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802199:	83 c4 24             	add    $0x24,%esp
+  80219c:	5b                   	pop    %ebx
+  80219d:	5e                   	pop    %esi
+  80219e:	5f                   	pop    %edi
+  80219f:	5d                   	pop    %ebp
+  8021a0:	c3                   	ret
+  8021a1:	85 ff                	test   %edi,%edi
+  8021a3:	74 0d                	je     8021b2 <__udivmoddi4+0xe2>
+  8021a5:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  8021ab:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  8021b2:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8021b6:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8021ba:	89 44 24 18          	mov    %eax,0x18(%esp)
+  8021be:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8021c2:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  8021c6:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8021ca:	83 c4 24             	add    $0x24,%esp
+  8021cd:	5b                   	pop    %ebx
+  8021ce:	5e                   	pop    %esi
+  8021cf:	5f                   	pop    %edi
+  8021d0:	5d                   	pop    %ebp
+  8021d1:	c3                   	ret
+  8021d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8021d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+008021e0 <__udivdi3>:
+  8021e0:	57                   	push   %edi
+  8021e1:	56                   	push   %esi
+  8021e2:	53                   	push   %ebx
+  8021e3:	83 ec 20             	sub    $0x20,%esp
+  8021e6:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8021ea:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8021ee:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8021f2:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8021f6:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8021fa:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8021fe:	89 d1                	mov    %edx,%ecx
+  802200:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802204:	09 c1                	or     %eax,%ecx
+  802206:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80220a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80220e:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802212:	0f 84 88 00 00 00    	je     8022a0 <__udivdi3+0xc0>
+  802218:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80221f:	00 
+  802220:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802225:	31 c0                	xor    %eax,%eax
+  802227:	31 d2                	xor    %edx,%edx
+  802229:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802230:	00 
+  802231:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802238:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80223c:	01 c0                	add    %eax,%eax
+  80223e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802245:	00 
+  802246:	89 c6                	mov    %eax,%esi
+  802248:	89 d7                	mov    %edx,%edi
+  80224a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80224e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802252:	0f ad d0             	shrd   %cl,%edx,%eax
+  802255:	d3 ea                	shr    %cl,%edx
+  802257:	f6 c1 20             	test   $0x20,%cl
+  80225a:	0f 45 c2             	cmovne %edx,%eax
+  80225d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802261:	83 e0 01             	and    $0x1,%eax
+  802264:	09 fa                	or     %edi,%edx
+  802266:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80226a:	89 04 24             	mov    %eax,(%esp)
+  80226d:	8b 04 24             	mov    (%esp),%eax
+  802270:	89 d3                	mov    %edx,%ebx
+  802272:	09 f0                	or     %esi,%eax
+  802274:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802278:	39 f0                	cmp    %esi,%eax
+  80227a:	19 fb                	sbb    %edi,%ebx
+  80227c:	72 1d                	jb     80229b <__udivdi3+0xbb>
+  80227e:	29 f0                	sub    %esi,%eax
+  802280:	19 fa                	sbb    %edi,%edx
+  802282:	89 cf                	mov    %ecx,%edi
+  802284:	c1 ef 05             	shr    $0x5,%edi
+  802287:	83 e7 01             	and    $0x1,%edi
+  80228a:	89 fe                	mov    %edi,%esi
+  80228c:	d3 e7                	shl    %cl,%edi
+  80228e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802292:	83 f6 01             	xor    $0x1,%esi
+  802295:	d3 e6                	shl    %cl,%esi
+  802297:	09 74 24 18          	or     %esi,0x18(%esp)
+  80229b:	83 e9 01             	sub    $0x1,%ecx
+  80229e:	73 98                	jae    802238 <__udivdi3+0x58>
+  8022a0:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8022a4:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8022a8:	83 c4 20             	add    $0x20,%esp
+  8022ab:	5b                   	pop    %ebx
+  8022ac:	5e                   	pop    %esi
+  8022ad:	5f                   	pop    %edi
+  8022ae:	c3                   	ret
+  8022af:	90                   	nop
+
+008022b0 <__umoddi3>:
+  8022b0:	57                   	push   %edi
+  8022b1:	56                   	push   %esi
+  8022b2:	53                   	push   %ebx
+  8022b3:	83 ec 18             	sub    $0x18,%esp
+  8022b6:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8022ba:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8022be:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8022c2:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8022c6:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8022ca:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8022ce:	89 d1                	mov    %edx,%ecx
+  8022d0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8022d4:	09 c1                	or     %eax,%ecx
+  8022d6:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8022da:	74 5b                	je     802337 <__umoddi3+0x87>
+  8022dc:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8022e1:	31 c0                	xor    %eax,%eax
+  8022e3:	31 d2                	xor    %edx,%edx
+  8022e5:	8d 76 00             	lea    0x0(%esi),%esi
+  8022e8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8022ec:	01 c0                	add    %eax,%eax
+  8022ee:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8022f5:	00 
+  8022f6:	89 c6                	mov    %eax,%esi
+  8022f8:	89 d7                	mov    %edx,%edi
+  8022fa:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8022fe:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802302:	0f ad d0             	shrd   %cl,%edx,%eax
+  802305:	d3 ea                	shr    %cl,%edx
+  802307:	f6 c1 20             	test   $0x20,%cl
+  80230a:	0f 45 c2             	cmovne %edx,%eax
+  80230d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802311:	83 e0 01             	and    $0x1,%eax
+  802314:	09 fa                	or     %edi,%edx
+  802316:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80231a:	89 04 24             	mov    %eax,(%esp)
+  80231d:	8b 04 24             	mov    (%esp),%eax
+  802320:	89 d3                	mov    %edx,%ebx
+  802322:	09 f0                	or     %esi,%eax
+  802324:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802328:	39 f0                	cmp    %esi,%eax
+  80232a:	19 fb                	sbb    %edi,%ebx
+  80232c:	72 04                	jb     802332 <__umoddi3+0x82>
+  80232e:	29 f0                	sub    %esi,%eax
+  802330:	19 fa                	sbb    %edi,%edx
+  802332:	83 e9 01             	sub    $0x1,%ecx
+  802335:	73 b1                	jae    8022e8 <__umoddi3+0x38>
+  802337:	83 c4 18             	add    $0x18,%esp
+  80233a:	5b                   	pop    %ebx
+  80233b:	5e                   	pop    %esi
+  80233c:	5f                   	pop    %edi
+  80233d:	c3                   	ret
+  80233e:	66 90                	xchg   %ax,%ax
+
+00802340 <__divdi3>:
+  802340:	55                   	push   %ebp
+  802341:	57                   	push   %edi
+  802342:	56                   	push   %esi
+  802343:	53                   	push   %ebx
+  802344:	83 ec 24             	sub    $0x24,%esp
+  802347:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  80234b:	8b 74 24 44          	mov    0x44(%esp),%esi
+  80234f:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802353:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802357:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  80235b:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  80235f:	85 d2                	test   %edx,%edx
+  802361:	0f 88 e0 00 00 00    	js     802447 <__divdi3+0x107>
+  802367:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  80236b:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  80236f:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802373:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802377:	85 f6                	test   %esi,%esi
+  802379:	78 16                	js     802391 <__divdi3+0x51>
+  80237b:	89 f1                	mov    %esi,%ecx
+  80237d:	31 c0                	xor    %eax,%eax
+  80237f:	31 d2                	xor    %edx,%edx
+  802381:	09 d9                	or     %ebx,%ecx
+  802383:	0f 85 f3 00 00 00    	jne    80247c <__divdi3+0x13c>
+  802389:	83 c4 24             	add    $0x24,%esp
+  80238c:	5b                   	pop    %ebx
+  80238d:	5e                   	pop    %esi
+  80238e:	5f                   	pop    %edi
+  80238f:	5d                   	pop    %ebp
+  802390:	c3                   	ret
+  802391:	bf 01 00 00 00       	mov    $0x1,%edi
+  802396:	f7 5c 24 08          	negl   0x8(%esp)
+  80239a:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  80239f:	f7 5c 24 0c          	negl   0xc(%esp)
+  8023a3:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8023aa:	00 
+  8023ab:	31 c0                	xor    %eax,%eax
+  8023ad:	31 d2                	xor    %edx,%edx
+  8023af:	89 fb                	mov    %edi,%ebx
+  8023b1:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8023b8:	00 
+  8023b9:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8023be:	66 90                	xchg   %ax,%ax
+  8023c0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8023c4:	01 c0                	add    %eax,%eax
+  8023c6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8023cd:	00 
+  8023ce:	89 c6                	mov    %eax,%esi
+  8023d0:	89 d7                	mov    %edx,%edi
+  8023d2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8023d6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8023da:	0f ad d0             	shrd   %cl,%edx,%eax
+  8023dd:	d3 ea                	shr    %cl,%edx
+  8023df:	f6 c1 20             	test   $0x20,%cl
+  8023e2:	0f 45 c2             	cmovne %edx,%eax
+  8023e5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8023e9:	83 e0 01             	and    $0x1,%eax
+  8023ec:	09 fa                	or     %edi,%edx
+  8023ee:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8023f2:	89 04 24             	mov    %eax,(%esp)
+  8023f5:	8b 04 24             	mov    (%esp),%eax
+  8023f8:	89 d5                	mov    %edx,%ebp
+  8023fa:	09 f0                	or     %esi,%eax
+  8023fc:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802400:	39 f0                	cmp    %esi,%eax
+  802402:	19 fd                	sbb    %edi,%ebp
+  802404:	72 1d                	jb     802423 <__divdi3+0xe3>
+  802406:	29 f0                	sub    %esi,%eax
+  802408:	19 fa                	sbb    %edi,%edx
+  80240a:	89 cf                	mov    %ecx,%edi
+  80240c:	c1 ef 05             	shr    $0x5,%edi
+  80240f:	83 e7 01             	and    $0x1,%edi
+  802412:	89 fe                	mov    %edi,%esi
+  802414:	d3 e7                	shl    %cl,%edi
+  802416:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80241a:	83 f6 01             	xor    $0x1,%esi
+  80241d:	d3 e6                	shl    %cl,%esi
+  80241f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802423:	83 e9 01             	sub    $0x1,%ecx
+  802426:	73 98                	jae    8023c0 <__divdi3+0x80>
+  802428:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80242c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802430:	85 db                	test   %ebx,%ebx
+  802432:	0f 84 51 ff ff ff    	je     802389 <__divdi3+0x49>
+  802438:	f7 d8                	neg    %eax
+  80243a:	83 d2 00             	adc    $0x0,%edx
+  80243d:	83 c4 24             	add    $0x24,%esp
+  802440:	5b                   	pop    %ebx
+  802441:	f7 da                	neg    %edx
+  802443:	5e                   	pop    %esi
+  802444:	5f                   	pop    %edi
+  802445:	5d                   	pop    %ebp
+  802446:	c3                   	ret
+  802447:	f7 d8                	neg    %eax
+  802449:	83 d2 00             	adc    $0x0,%edx
+  80244c:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802450:	f7 da                	neg    %edx
+  802452:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802456:	85 f6                	test   %esi,%esi
+  802458:	78 1b                	js     802475 <__divdi3+0x135>
+  80245a:	89 f1                	mov    %esi,%ecx
+  80245c:	31 c0                	xor    %eax,%eax
+  80245e:	31 d2                	xor    %edx,%edx
+  802460:	bf 01 00 00 00       	mov    $0x1,%edi
+  802465:	09 d9                	or     %ebx,%ecx
+  802467:	0f 85 36 ff ff ff    	jne    8023a3 <__divdi3+0x63>
+  80246d:	83 c4 24             	add    $0x24,%esp
+  802470:	5b                   	pop    %ebx
+  802471:	5e                   	pop    %esi
+  802472:	5f                   	pop    %edi
+  802473:	5d                   	pop    %ebp
+  802474:	c3                   	ret
+  802475:	31 ff                	xor    %edi,%edi
+  802477:	e9 1a ff ff ff       	jmp    802396 <__divdi3+0x56>
+  80247c:	31 ff                	xor    %edi,%edi
+  80247e:	e9 20 ff ff ff       	jmp    8023a3 <__divdi3+0x63>
+  802483:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80248a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00802490 <__moddi3>:
+  802490:	55                   	push   %ebp
+  802491:	57                   	push   %edi
+  802492:	56                   	push   %esi
+  802493:	53                   	push   %ebx
+  802494:	83 ec 1c             	sub    $0x1c,%esp
+  802497:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  80249b:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  80249f:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  8024a3:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  8024a7:	89 c8                	mov    %ecx,%eax
+  8024a9:	89 f2                	mov    %esi,%edx
+  8024ab:	89 f3                	mov    %esi,%ebx
+  8024ad:	85 ed                	test   %ebp,%ebp
+  8024af:	0f 88 9d 00 00 00    	js     802552 <__moddi3+0xc2>
+  8024b5:	09 cb                	or     %ecx,%ebx
+  8024b7:	0f 84 8d 00 00 00    	je     80254a <__moddi3+0xba>
+  8024bd:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  8024c1:	31 db                	xor    %ebx,%ebx
+  8024c3:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  8024c7:	89 ca                	mov    %ecx,%edx
+  8024c9:	89 f0                	mov    %esi,%eax
+  8024cb:	89 dd                	mov    %ebx,%ebp
+  8024cd:	f7 da                	neg    %edx
+  8024cf:	83 d0 00             	adc    $0x0,%eax
+  8024d2:	f7 d8                	neg    %eax
+  8024d4:	0f 49 f0             	cmovns %eax,%esi
+  8024d7:	0f 49 ca             	cmovns %edx,%ecx
+  8024da:	31 c0                	xor    %eax,%eax
+  8024dc:	31 d2                	xor    %edx,%edx
+  8024de:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8024e2:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  8024e6:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8024eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  8024ef:	90                   	nop
+  8024f0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8024f4:	01 c0                	add    %eax,%eax
+  8024f6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8024fd:	00 
+  8024fe:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  802502:	89 c6                	mov    %eax,%esi
+  802504:	89 d7                	mov    %edx,%edi
+  802506:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80250a:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80250e:	0f ad d0             	shrd   %cl,%edx,%eax
+  802511:	d3 ea                	shr    %cl,%edx
+  802513:	f6 c1 20             	test   $0x20,%cl
+  802516:	0f 45 c2             	cmovne %edx,%eax
+  802519:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80251d:	83 e0 01             	and    $0x1,%eax
+  802520:	09 fa                	or     %edi,%edx
+  802522:	89 04 24             	mov    %eax,(%esp)
+  802525:	8b 04 24             	mov    (%esp),%eax
+  802528:	89 d7                	mov    %edx,%edi
+  80252a:	09 f0                	or     %esi,%eax
+  80252c:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  802530:	39 d8                	cmp    %ebx,%eax
+  802532:	19 f7                	sbb    %esi,%edi
+  802534:	72 04                	jb     80253a <__moddi3+0xaa>
+  802536:	29 d8                	sub    %ebx,%eax
+  802538:	19 f2                	sbb    %esi,%edx
+  80253a:	83 e9 01             	sub    $0x1,%ecx
+  80253d:	73 b1                	jae    8024f0 <__moddi3+0x60>
+  80253f:	85 ed                	test   %ebp,%ebp
+  802541:	74 07                	je     80254a <__moddi3+0xba>
+  802543:	f7 d8                	neg    %eax
+  802545:	83 d2 00             	adc    $0x0,%edx
+  802548:	f7 da                	neg    %edx
+  80254a:	83 c4 1c             	add    $0x1c,%esp
+  80254d:	5b                   	pop    %ebx
+  80254e:	5e                   	pop    %esi
+  80254f:	5f                   	pop    %edi
+  802550:	5d                   	pop    %ebp
+  802551:	c3                   	ret
+  802552:	09 cb                	or     %ecx,%ebx
+  802554:	74 f4                	je     80254a <__moddi3+0xba>
+  802556:	f7 df                	neg    %edi
+  802558:	bb 01 00 00 00       	mov    $0x1,%ebx
+  80255d:	83 d5 00             	adc    $0x0,%ebp
+  802560:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802564:	f7 dd                	neg    %ebp
+  802566:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  80256a:	e9 58 ff ff ff       	jmp    8024c7 <__moddi3+0x37>
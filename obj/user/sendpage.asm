@@ -0,0 +1,5827 @@
+
+obj/user/sendpage.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 73 01 00 00       	call   8001a4 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#define TEMP_ADDR	((char*)0xa00000)
+#define TEMP_ADDR_CHILD	((char*)0xb00000)
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 18             	sub    $0x18,%esp
+	envid_t who;
+
+	if ((who = fork()) == 0) {
+  800039:	e8 d1 0f 00 00       	call   80100f <fork>
+  80003e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  800041:	85 c0                	test   %eax,%eax
+  800043:	0f 84 a5 00 00 00    	je     8000ee <umain+0xbb>
+		ipc_send(who, 0, TEMP_ADDR_CHILD, PTE_P | PTE_W | PTE_U);
+		return;
+	}
+
+	// Parent
+	sys_page_alloc(thisenv->env_id, TEMP_ADDR, PTE_P | PTE_W | PTE_U);
+  800049:	a1 08 50 80 00       	mov    0x805008,%eax
+  80004e:	8b 40 48             	mov    0x48(%eax),%eax
+  800051:	83 ec 04             	sub    $0x4,%esp
+  800054:	6a 07                	push   $0x7
+  800056:	68 00 00 a0 00       	push   $0xa00000
+  80005b:	50                   	push   %eax
+  80005c:	e8 e0 0b 00 00       	call   800c41 <sys_page_alloc>
+	memcpy(TEMP_ADDR, str1, strlen(str1) + 1);
+  800061:	83 c4 04             	add    $0x4,%esp
+  800064:	ff 35 04 40 80 00    	push   0x804004
+  80006a:	e8 ab 07 00 00       	call   80081a <strlen>
+  80006f:	83 c4 0c             	add    $0xc,%esp
+  800072:	83 c0 01             	add    $0x1,%eax
+  800075:	50                   	push   %eax
+  800076:	ff 35 04 40 80 00    	push   0x804004
+  80007c:	68 00 00 a0 00       	push   $0xa00000
+  800081:	e8 b7 09 00 00       	call   800a3d <memcpy>
+	ipc_send(who, 0, TEMP_ADDR, PTE_P | PTE_W | PTE_U);
+  800086:	6a 07                	push   $0x7
+  800088:	68 00 00 a0 00       	push   $0xa00000
+  80008d:	6a 00                	push   $0x0
+  80008f:	ff 75 f4             	push   -0xc(%ebp)
+  800092:	e8 08 12 00 00       	call   80129f <ipc_send>
+
+	ipc_recv(&who, TEMP_ADDR, 0);
+  800097:	83 c4 1c             	add    $0x1c,%esp
+  80009a:	6a 00                	push   $0x0
+  80009c:	68 00 00 a0 00       	push   $0xa00000
+  8000a1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8000a4:	50                   	push   %eax
+  8000a5:	e8 81 11 00 00       	call   80122b <ipc_recv>
+	cprintf("%x got message: %s\n", who, TEMP_ADDR);
+  8000aa:	83 c4 0c             	add    $0xc,%esp
+  8000ad:	68 00 00 a0 00       	push   $0xa00000
+  8000b2:	ff 75 f4             	push   -0xc(%ebp)
+  8000b5:	68 00 2a 80 00       	push   $0x802a00
+  8000ba:	e8 dd 01 00 00       	call   80029c <cprintf>
+	if (strncmp(TEMP_ADDR, str2, strlen(str2)) == 0)
+  8000bf:	83 c4 04             	add    $0x4,%esp
+  8000c2:	ff 35 00 40 80 00    	push   0x804000
+  8000c8:	e8 4d 07 00 00       	call   80081a <strlen>
+  8000cd:	83 c4 0c             	add    $0xc,%esp
+  8000d0:	50                   	push   %eax
+  8000d1:	ff 35 00 40 80 00    	push   0x804000
+  8000d7:	68 00 00 a0 00       	push   $0xa00000
+  8000dc:	e8 4b 08 00 00       	call   80092c <strncmp>
+  8000e1:	83 c4 10             	add    $0x10,%esp
+  8000e4:	85 c0                	test   %eax,%eax
+  8000e6:	0f 84 a3 00 00 00    	je     80018f <umain+0x15c>
+		cprintf("parent received correct message\n");
+	return;
+}
+  8000ec:	c9                   	leave
+  8000ed:	c3                   	ret
+		ipc_recv(&who, TEMP_ADDR_CHILD, 0);
+  8000ee:	83 ec 04             	sub    $0x4,%esp
+  8000f1:	6a 00                	push   $0x0
+  8000f3:	68 00 00 b0 00       	push   $0xb00000
+  8000f8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8000fb:	50                   	push   %eax
+  8000fc:	e8 2a 11 00 00       	call   80122b <ipc_recv>
+		cprintf("%x got message: %s\n", who, TEMP_ADDR_CHILD);
+  800101:	83 c4 0c             	add    $0xc,%esp
+  800104:	68 00 00 b0 00       	push   $0xb00000
+  800109:	ff 75 f4             	push   -0xc(%ebp)
+  80010c:	68 00 2a 80 00       	push   $0x802a00
+  800111:	e8 86 01 00 00       	call   80029c <cprintf>
+		if (strncmp(TEMP_ADDR_CHILD, str1, strlen(str1)) == 0)
+  800116:	83 c4 04             	add    $0x4,%esp
+  800119:	ff 35 04 40 80 00    	push   0x804004
+  80011f:	e8 f6 06 00 00       	call   80081a <strlen>
+  800124:	83 c4 0c             	add    $0xc,%esp
+  800127:	50                   	push   %eax
+  800128:	ff 35 04 40 80 00    	push   0x804004
+  80012e:	68 00 00 b0 00       	push   $0xb00000
+  800133:	e8 f4 07 00 00       	call   80092c <strncmp>
+  800138:	83 c4 10             	add    $0x10,%esp
+  80013b:	85 c0                	test   %eax,%eax
+  80013d:	74 3e                	je     80017d <umain+0x14a>
+		memcpy(TEMP_ADDR_CHILD, str2, strlen(str2) + 1);
+  80013f:	83 ec 0c             	sub    $0xc,%esp
+  800142:	ff 35 00 40 80 00    	push   0x804000
+  800148:	e8 cd 06 00 00       	call   80081a <strlen>
+  80014d:	83 c4 0c             	add    $0xc,%esp
+  800150:	83 c0 01             	add    $0x1,%eax
+  800153:	50                   	push   %eax
+  800154:	ff 35 00 40 80 00    	push   0x804000
+  80015a:	68 00 00 b0 00       	push   $0xb00000
+  80015f:	e8 d9 08 00 00       	call   800a3d <memcpy>
+		ipc_send(who, 0, TEMP_ADDR_CHILD, PTE_P | PTE_W | PTE_U);
+  800164:	6a 07                	push   $0x7
+  800166:	68 00 00 b0 00       	push   $0xb00000
+  80016b:	6a 00                	push   $0x0
+  80016d:	ff 75 f4             	push   -0xc(%ebp)
+  800170:	e8 2a 11 00 00       	call   80129f <ipc_send>
+		return;
+  800175:	83 c4 20             	add    $0x20,%esp
+  800178:	e9 6f ff ff ff       	jmp    8000ec <umain+0xb9>
+			cprintf("child received correct message\n");
+  80017d:	83 ec 0c             	sub    $0xc,%esp
+  800180:	68 14 2a 80 00       	push   $0x802a14
+  800185:	e8 12 01 00 00       	call   80029c <cprintf>
+  80018a:	83 c4 10             	add    $0x10,%esp
+  80018d:	eb b0                	jmp    80013f <umain+0x10c>
+		cprintf("parent received correct message\n");
+  80018f:	83 ec 0c             	sub    $0xc,%esp
+  800192:	68 34 2a 80 00       	push   $0x802a34
+  800197:	e8 00 01 00 00       	call   80029c <cprintf>
+  80019c:	83 c4 10             	add    $0x10,%esp
+  80019f:	e9 48 ff ff ff       	jmp    8000ec <umain+0xb9>
+
+008001a4 <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  8001a4:	55                   	push   %ebp
+  8001a5:	89 e5                	mov    %esp,%ebp
+  8001a7:	56                   	push   %esi
+  8001a8:	53                   	push   %ebx
+  8001a9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001ac:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  8001af:	e8 4f 0a 00 00       	call   800c03 <sys_getenvid>
+  8001b4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001b9:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8001bc:	c1 e0 04             	shl    $0x4,%eax
+  8001bf:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001c4:	a3 08 50 80 00       	mov    %eax,0x805008
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8001c9:	85 db                	test   %ebx,%ebx
+  8001cb:	7e 07                	jle    8001d4 <libmain+0x30>
+    binaryname = argv[0];
+  8001cd:	8b 06                	mov    (%esi),%eax
+  8001cf:	a3 08 40 80 00       	mov    %eax,0x804008
+
+  // call user main routine
+  umain(argc, argv);
+  8001d4:	83 ec 08             	sub    $0x8,%esp
+  8001d7:	56                   	push   %esi
+  8001d8:	53                   	push   %ebx
+  8001d9:	e8 55 fe ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  8001de:	e8 0a 00 00 00       	call   8001ed <exit>
+}
+  8001e3:	83 c4 10             	add    $0x10,%esp
+  8001e6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8001e9:	5b                   	pop    %ebx
+  8001ea:	5e                   	pop    %esi
+  8001eb:	5d                   	pop    %ebp
+  8001ec:	c3                   	ret
+
+008001ed <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8001ed:	55                   	push   %ebp
+  8001ee:	89 e5                	mov    %esp,%ebp
+  8001f0:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8001f3:	e8 0e 13 00 00       	call   801506 <close_all>
+	sys_env_destroy(0);
+  8001f8:	83 ec 0c             	sub    $0xc,%esp
+  8001fb:	6a 00                	push   $0x0
+  8001fd:	e8 c0 09 00 00       	call   800bc2 <sys_env_destroy>
+}
+  800202:	83 c4 10             	add    $0x10,%esp
+  800205:	c9                   	leave
+  800206:	c3                   	ret
+
+00800207 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800207:	55                   	push   %ebp
+  800208:	89 e5                	mov    %esp,%ebp
+  80020a:	53                   	push   %ebx
+  80020b:	83 ec 04             	sub    $0x4,%esp
+  80020e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800211:	8b 13                	mov    (%ebx),%edx
+  800213:	8d 42 01             	lea    0x1(%edx),%eax
+  800216:	89 03                	mov    %eax,(%ebx)
+  800218:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80021b:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80021f:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800224:	74 09                	je     80022f <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800226:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80022a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80022d:	c9                   	leave
+  80022e:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80022f:	83 ec 08             	sub    $0x8,%esp
+  800232:	68 ff 00 00 00       	push   $0xff
+  800237:	8d 43 08             	lea    0x8(%ebx),%eax
+  80023a:	50                   	push   %eax
+  80023b:	e8 45 09 00 00       	call   800b85 <sys_cputs>
+		b->idx = 0;
+  800240:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800246:	83 c4 10             	add    $0x10,%esp
+  800249:	eb db                	jmp    800226 <putch+0x1f>
+
+0080024b <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80024b:	55                   	push   %ebp
+  80024c:	89 e5                	mov    %esp,%ebp
+  80024e:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800254:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80025b:	00 00 00 
+	b.cnt = 0;
+  80025e:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800265:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800268:	ff 75 0c             	push   0xc(%ebp)
+  80026b:	ff 75 08             	push   0x8(%ebp)
+  80026e:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800274:	50                   	push   %eax
+  800275:	68 07 02 80 00       	push   $0x800207
+  80027a:	e8 14 01 00 00       	call   800393 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80027f:	83 c4 08             	add    $0x8,%esp
+  800282:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800288:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80028e:	50                   	push   %eax
+  80028f:	e8 f1 08 00 00       	call   800b85 <sys_cputs>
+
+	return b.cnt;
+}
+  800294:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80029a:	c9                   	leave
+  80029b:	c3                   	ret
+
+0080029c <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80029c:	55                   	push   %ebp
+  80029d:	89 e5                	mov    %esp,%ebp
+  80029f:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8002a2:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8002a5:	50                   	push   %eax
+  8002a6:	ff 75 08             	push   0x8(%ebp)
+  8002a9:	e8 9d ff ff ff       	call   80024b <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8002ae:	c9                   	leave
+  8002af:	c3                   	ret
+
+008002b0 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8002b0:	55                   	push   %ebp
+  8002b1:	89 e5                	mov    %esp,%ebp
+  8002b3:	57                   	push   %edi
+  8002b4:	56                   	push   %esi
+  8002b5:	53                   	push   %ebx
+  8002b6:	83 ec 1c             	sub    $0x1c,%esp
+  8002b9:	89 c7                	mov    %eax,%edi
+  8002bb:	89 d6                	mov    %edx,%esi
+  8002bd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002c0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8002c3:	89 d1                	mov    %edx,%ecx
+  8002c5:	89 c2                	mov    %eax,%edx
+  8002c7:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8002ca:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8002cd:	8b 45 10             	mov    0x10(%ebp),%eax
+  8002d0:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8002d3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8002d6:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8002dd:	39 c2                	cmp    %eax,%edx
+  8002df:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8002e2:	72 3e                	jb     800322 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8002e4:	83 ec 0c             	sub    $0xc,%esp
+  8002e7:	ff 75 18             	push   0x18(%ebp)
+  8002ea:	83 eb 01             	sub    $0x1,%ebx
+  8002ed:	53                   	push   %ebx
+  8002ee:	50                   	push   %eax
+  8002ef:	83 ec 08             	sub    $0x8,%esp
+  8002f2:	ff 75 e4             	push   -0x1c(%ebp)
+  8002f5:	ff 75 e0             	push   -0x20(%ebp)
+  8002f8:	ff 75 dc             	push   -0x24(%ebp)
+  8002fb:	ff 75 d8             	push   -0x28(%ebp)
+  8002fe:	e8 6d 23 00 00       	call   802670 <__udivdi3>
+  800303:	83 c4 18             	add    $0x18,%esp
+  800306:	52                   	push   %edx
+  800307:	50                   	push   %eax
+  800308:	89 f2                	mov    %esi,%edx
+  80030a:	89 f8                	mov    %edi,%eax
+  80030c:	e8 9f ff ff ff       	call   8002b0 <printnum>
+  800311:	83 c4 20             	add    $0x20,%esp
+  800314:	eb 13                	jmp    800329 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800316:	83 ec 08             	sub    $0x8,%esp
+  800319:	56                   	push   %esi
+  80031a:	ff 75 18             	push   0x18(%ebp)
+  80031d:	ff d7                	call   *%edi
+  80031f:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800322:	83 eb 01             	sub    $0x1,%ebx
+  800325:	85 db                	test   %ebx,%ebx
+  800327:	7f ed                	jg     800316 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800329:	83 ec 08             	sub    $0x8,%esp
+  80032c:	56                   	push   %esi
+  80032d:	83 ec 04             	sub    $0x4,%esp
+  800330:	ff 75 e4             	push   -0x1c(%ebp)
+  800333:	ff 75 e0             	push   -0x20(%ebp)
+  800336:	ff 75 dc             	push   -0x24(%ebp)
+  800339:	ff 75 d8             	push   -0x28(%ebp)
+  80033c:	e8 ff 23 00 00       	call   802740 <__umoddi3>
+  800341:	83 c4 14             	add    $0x14,%esp
+  800344:	0f be 80 ac 2a 80 00 	movsbl 0x802aac(%eax),%eax
+  80034b:	50                   	push   %eax
+  80034c:	ff d7                	call   *%edi
+}
+  80034e:	83 c4 10             	add    $0x10,%esp
+  800351:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800354:	5b                   	pop    %ebx
+  800355:	5e                   	pop    %esi
+  800356:	5f                   	pop    %edi
+  800357:	5d                   	pop    %ebp
+  800358:	c3                   	ret
+
+00800359 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800359:	55                   	push   %ebp
+  80035a:	89 e5                	mov    %esp,%ebp
+  80035c:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80035f:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800363:	8b 10                	mov    (%eax),%edx
+  800365:	3b 50 04             	cmp    0x4(%eax),%edx
+  800368:	73 0a                	jae    800374 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80036a:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80036d:	89 08                	mov    %ecx,(%eax)
+  80036f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800372:	88 02                	mov    %al,(%edx)
+}
+  800374:	5d                   	pop    %ebp
+  800375:	c3                   	ret
+
+00800376 <printfmt>:
+{
+  800376:	55                   	push   %ebp
+  800377:	89 e5                	mov    %esp,%ebp
+  800379:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80037c:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80037f:	50                   	push   %eax
+  800380:	ff 75 10             	push   0x10(%ebp)
+  800383:	ff 75 0c             	push   0xc(%ebp)
+  800386:	ff 75 08             	push   0x8(%ebp)
+  800389:	e8 05 00 00 00       	call   800393 <vprintfmt>
+}
+  80038e:	83 c4 10             	add    $0x10,%esp
+  800391:	c9                   	leave
+  800392:	c3                   	ret
+
+00800393 <vprintfmt>:
+{
+  800393:	55                   	push   %ebp
+  800394:	89 e5                	mov    %esp,%ebp
+  800396:	57                   	push   %edi
+  800397:	56                   	push   %esi
+  800398:	53                   	push   %ebx
+  800399:	83 ec 2c             	sub    $0x2c,%esp
+  80039c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80039f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8003a2:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8003a5:	eb 0a                	jmp    8003b1 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8003a7:	83 ec 08             	sub    $0x8,%esp
+  8003aa:	53                   	push   %ebx
+  8003ab:	50                   	push   %eax
+  8003ac:	ff d6                	call   *%esi
+  8003ae:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8003b1:	83 c7 01             	add    $0x1,%edi
+  8003b4:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8003b8:	83 f8 25             	cmp    $0x25,%eax
+  8003bb:	74 0c                	je     8003c9 <vprintfmt+0x36>
+			if (ch == '\0')
+  8003bd:	85 c0                	test   %eax,%eax
+  8003bf:	75 e6                	jne    8003a7 <vprintfmt+0x14>
+}
+  8003c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003c4:	5b                   	pop    %ebx
+  8003c5:	5e                   	pop    %esi
+  8003c6:	5f                   	pop    %edi
+  8003c7:	5d                   	pop    %ebp
+  8003c8:	c3                   	ret
+		padc = ' ';
+  8003c9:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8003cd:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8003d4:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8003db:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8003e2:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003e7:	8d 47 01             	lea    0x1(%edi),%eax
+  8003ea:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003ed:	0f b6 17             	movzbl (%edi),%edx
+  8003f0:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8003f3:	3c 55                	cmp    $0x55,%al
+  8003f5:	0f 87 9a 03 00 00    	ja     800795 <vprintfmt+0x402>
+  8003fb:	0f b6 c0             	movzbl %al,%eax
+  8003fe:	ff 24 85 e0 2b 80 00 	jmp    *0x802be0(,%eax,4)
+  800405:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800408:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80040c:	eb d9                	jmp    8003e7 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80040e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800411:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800415:	eb d0                	jmp    8003e7 <vprintfmt+0x54>
+  800417:	0f b6 d2             	movzbl %dl,%edx
+  80041a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80041d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800422:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800425:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800428:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80042c:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80042f:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800432:	83 f9 09             	cmp    $0x9,%ecx
+  800435:	77 55                	ja     80048c <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800437:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  80043a:	eb e9                	jmp    800425 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  80043c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80043f:	8b 00                	mov    (%eax),%eax
+  800441:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800444:	8b 45 14             	mov    0x14(%ebp),%eax
+  800447:	8d 40 04             	lea    0x4(%eax),%eax
+  80044a:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80044d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800450:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800454:	79 91                	jns    8003e7 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800456:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800459:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80045c:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800463:	eb 82                	jmp    8003e7 <vprintfmt+0x54>
+			if (width < 0)
+  800465:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800468:	85 d2                	test   %edx,%edx
+  80046a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80046f:	0f 49 c2             	cmovns %edx,%eax
+  800472:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800475:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800478:	e9 6a ff ff ff       	jmp    8003e7 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80047d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800480:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800487:	e9 5b ff ff ff       	jmp    8003e7 <vprintfmt+0x54>
+  80048c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80048f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800492:	eb bc                	jmp    800450 <vprintfmt+0xbd>
+			lflag++;
+  800494:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800497:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80049a:	e9 48 ff ff ff       	jmp    8003e7 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80049f:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004a2:	8d 78 04             	lea    0x4(%eax),%edi
+  8004a5:	83 ec 08             	sub    $0x8,%esp
+  8004a8:	53                   	push   %ebx
+  8004a9:	ff 30                	push   (%eax)
+  8004ab:	ff d6                	call   *%esi
+			break;
+  8004ad:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8004b0:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8004b3:	e9 7c 02 00 00       	jmp    800734 <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  8004b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004bb:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8004be:	8b 10                	mov    (%eax),%edx
+  8004c0:	89 d0                	mov    %edx,%eax
+  8004c2:	f7 d8                	neg    %eax
+  8004c4:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8004c7:	83 f8 10             	cmp    $0x10,%eax
+  8004ca:	7f 23                	jg     8004ef <vprintfmt+0x15c>
+  8004cc:	8b 14 85 40 2d 80 00 	mov    0x802d40(,%eax,4),%edx
+  8004d3:	85 d2                	test   %edx,%edx
+  8004d5:	74 18                	je     8004ef <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8004d7:	52                   	push   %edx
+  8004d8:	68 9d 2f 80 00       	push   $0x802f9d
+  8004dd:	53                   	push   %ebx
+  8004de:	56                   	push   %esi
+  8004df:	e8 92 fe ff ff       	call   800376 <printfmt>
+  8004e4:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004e7:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8004ea:	e9 45 02 00 00       	jmp    800734 <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  8004ef:	50                   	push   %eax
+  8004f0:	68 c4 2a 80 00       	push   $0x802ac4
+  8004f5:	53                   	push   %ebx
+  8004f6:	56                   	push   %esi
+  8004f7:	e8 7a fe ff ff       	call   800376 <printfmt>
+  8004fc:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004ff:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800502:	e9 2d 02 00 00       	jmp    800734 <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800507:	8b 45 14             	mov    0x14(%ebp),%eax
+  80050a:	83 c0 04             	add    $0x4,%eax
+  80050d:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800510:	8b 45 14             	mov    0x14(%ebp),%eax
+  800513:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800515:	85 c9                	test   %ecx,%ecx
+  800517:	b8 bd 2a 80 00       	mov    $0x802abd,%eax
+  80051c:	0f 45 c1             	cmovne %ecx,%eax
+  80051f:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800522:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800526:	7e 06                	jle    80052e <vprintfmt+0x19b>
+  800528:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80052c:	75 0b                	jne    800539 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80052e:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800531:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800534:	89 75 08             	mov    %esi,0x8(%ebp)
+  800537:	eb 5c                	jmp    800595 <vprintfmt+0x202>
+  800539:	83 ec 08             	sub    $0x8,%esp
+  80053c:	ff 75 d0             	push   -0x30(%ebp)
+  80053f:	ff 75 cc             	push   -0x34(%ebp)
+  800542:	e8 eb 02 00 00       	call   800832 <strnlen>
+  800547:	89 c2                	mov    %eax,%edx
+  800549:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80054c:	29 d0                	sub    %edx,%eax
+  80054e:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800551:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800555:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800558:	89 75 08             	mov    %esi,0x8(%ebp)
+  80055b:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80055d:	eb 0e                	jmp    80056d <vprintfmt+0x1da>
+					putch(padc, putdat);
+  80055f:	83 ec 08             	sub    $0x8,%esp
+  800562:	53                   	push   %ebx
+  800563:	57                   	push   %edi
+  800564:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800567:	83 ee 01             	sub    $0x1,%esi
+  80056a:	83 c4 10             	add    $0x10,%esp
+  80056d:	85 f6                	test   %esi,%esi
+  80056f:	7f ee                	jg     80055f <vprintfmt+0x1cc>
+  800571:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800574:	8b 75 08             	mov    0x8(%ebp),%esi
+  800577:	85 c0                	test   %eax,%eax
+  800579:	ba 00 00 00 00       	mov    $0x0,%edx
+  80057e:	0f 49 d0             	cmovns %eax,%edx
+  800581:	29 d0                	sub    %edx,%eax
+  800583:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800586:	eb a6                	jmp    80052e <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800588:	83 ec 08             	sub    $0x8,%esp
+  80058b:	53                   	push   %ebx
+  80058c:	52                   	push   %edx
+  80058d:	ff 55 08             	call   *0x8(%ebp)
+  800590:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800593:	89 f1                	mov    %esi,%ecx
+  800595:	8d 71 01             	lea    0x1(%ecx),%esi
+  800598:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80059c:	0f be d0             	movsbl %al,%edx
+  80059f:	85 d2                	test   %edx,%edx
+  8005a1:	74 28                	je     8005cb <vprintfmt+0x238>
+  8005a3:	85 ff                	test   %edi,%edi
+  8005a5:	78 05                	js     8005ac <vprintfmt+0x219>
+  8005a7:	83 ef 01             	sub    $0x1,%edi
+  8005aa:	78 30                	js     8005dc <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8005ac:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8005b0:	74 d6                	je     800588 <vprintfmt+0x1f5>
+  8005b2:	0f be c0             	movsbl %al,%eax
+  8005b5:	83 e8 20             	sub    $0x20,%eax
+  8005b8:	83 f8 5e             	cmp    $0x5e,%eax
+  8005bb:	76 cb                	jbe    800588 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8005bd:	83 ec 08             	sub    $0x8,%esp
+  8005c0:	53                   	push   %ebx
+  8005c1:	6a 3f                	push   $0x3f
+  8005c3:	ff 55 08             	call   *0x8(%ebp)
+  8005c6:	83 c4 10             	add    $0x10,%esp
+  8005c9:	eb c8                	jmp    800593 <vprintfmt+0x200>
+  8005cb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005ce:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005d1:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8005d4:	01 d0                	add    %edx,%eax
+  8005d6:	29 c8                	sub    %ecx,%eax
+  8005d8:	89 c7                	mov    %eax,%edi
+  8005da:	eb 13                	jmp    8005ef <vprintfmt+0x25c>
+  8005dc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005df:	eb ed                	jmp    8005ce <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8005e1:	83 ec 08             	sub    $0x8,%esp
+  8005e4:	53                   	push   %ebx
+  8005e5:	6a 20                	push   $0x20
+  8005e7:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8005e9:	83 ef 01             	sub    $0x1,%edi
+  8005ec:	83 c4 10             	add    $0x10,%esp
+  8005ef:	85 ff                	test   %edi,%edi
+  8005f1:	7f ee                	jg     8005e1 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005f3:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8005f6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005f9:	e9 36 01 00 00       	jmp    800734 <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  8005fe:	83 f9 01             	cmp    $0x1,%ecx
+  800601:	7f 1f                	jg     800622 <vprintfmt+0x28f>
+	else if (lflag)
+  800603:	85 c9                	test   %ecx,%ecx
+  800605:	74 67                	je     80066e <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800607:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060a:	8b 00                	mov    (%eax),%eax
+  80060c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80060f:	89 c1                	mov    %eax,%ecx
+  800611:	c1 f9 1f             	sar    $0x1f,%ecx
+  800614:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800617:	8b 45 14             	mov    0x14(%ebp),%eax
+  80061a:	8d 40 04             	lea    0x4(%eax),%eax
+  80061d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800620:	eb 17                	jmp    800639 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800622:	8b 45 14             	mov    0x14(%ebp),%eax
+  800625:	8b 50 04             	mov    0x4(%eax),%edx
+  800628:	8b 00                	mov    (%eax),%eax
+  80062a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80062d:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800630:	8b 45 14             	mov    0x14(%ebp),%eax
+  800633:	8d 40 08             	lea    0x8(%eax),%eax
+  800636:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800639:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80063c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80063f:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800644:	85 c9                	test   %ecx,%ecx
+  800646:	0f 89 ce 00 00 00    	jns    80071a <vprintfmt+0x387>
+				putch('-', putdat);
+  80064c:	83 ec 08             	sub    $0x8,%esp
+  80064f:	53                   	push   %ebx
+  800650:	6a 2d                	push   $0x2d
+  800652:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800654:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800657:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80065a:	f7 da                	neg    %edx
+  80065c:	83 d1 00             	adc    $0x0,%ecx
+  80065f:	f7 d9                	neg    %ecx
+  800661:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800664:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800669:	e9 ac 00 00 00       	jmp    80071a <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  80066e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800671:	8b 00                	mov    (%eax),%eax
+  800673:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800676:	89 c1                	mov    %eax,%ecx
+  800678:	c1 f9 1f             	sar    $0x1f,%ecx
+  80067b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80067e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800681:	8d 40 04             	lea    0x4(%eax),%eax
+  800684:	89 45 14             	mov    %eax,0x14(%ebp)
+  800687:	eb b0                	jmp    800639 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800689:	83 f9 01             	cmp    $0x1,%ecx
+  80068c:	7f 1b                	jg     8006a9 <vprintfmt+0x316>
+	else if (lflag)
+  80068e:	85 c9                	test   %ecx,%ecx
+  800690:	74 2c                	je     8006be <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  800692:	8b 45 14             	mov    0x14(%ebp),%eax
+  800695:	8b 10                	mov    (%eax),%edx
+  800697:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80069c:	8d 40 04             	lea    0x4(%eax),%eax
+  80069f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006a2:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8006a7:	eb 71                	jmp    80071a <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  8006a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ac:	8b 10                	mov    (%eax),%edx
+  8006ae:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006b1:	8d 40 08             	lea    0x8(%eax),%eax
+  8006b4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006b7:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8006bc:	eb 5c                	jmp    80071a <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  8006be:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c1:	8b 10                	mov    (%eax),%edx
+  8006c3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006c8:	8d 40 04             	lea    0x4(%eax),%eax
+  8006cb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006ce:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8006d3:	eb 45                	jmp    80071a <vprintfmt+0x387>
+			putch('X', putdat);
+  8006d5:	83 ec 08             	sub    $0x8,%esp
+  8006d8:	53                   	push   %ebx
+  8006d9:	6a 58                	push   $0x58
+  8006db:	ff d6                	call   *%esi
+			putch('X', putdat);
+  8006dd:	83 c4 08             	add    $0x8,%esp
+  8006e0:	53                   	push   %ebx
+  8006e1:	6a 58                	push   $0x58
+  8006e3:	ff d6                	call   *%esi
+			putch('X', putdat);
+  8006e5:	83 c4 08             	add    $0x8,%esp
+  8006e8:	53                   	push   %ebx
+  8006e9:	6a 58                	push   $0x58
+  8006eb:	ff d6                	call   *%esi
+			break;
+  8006ed:	83 c4 10             	add    $0x10,%esp
+  8006f0:	eb 42                	jmp    800734 <vprintfmt+0x3a1>
+			putch('0', putdat);
+  8006f2:	83 ec 08             	sub    $0x8,%esp
+  8006f5:	53                   	push   %ebx
+  8006f6:	6a 30                	push   $0x30
+  8006f8:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8006fa:	83 c4 08             	add    $0x8,%esp
+  8006fd:	53                   	push   %ebx
+  8006fe:	6a 78                	push   $0x78
+  800700:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800702:	8b 45 14             	mov    0x14(%ebp),%eax
+  800705:	8b 10                	mov    (%eax),%edx
+  800707:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80070c:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80070f:	8d 40 04             	lea    0x4(%eax),%eax
+  800712:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800715:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80071a:	83 ec 0c             	sub    $0xc,%esp
+  80071d:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800721:	50                   	push   %eax
+  800722:	ff 75 e0             	push   -0x20(%ebp)
+  800725:	57                   	push   %edi
+  800726:	51                   	push   %ecx
+  800727:	52                   	push   %edx
+  800728:	89 da                	mov    %ebx,%edx
+  80072a:	89 f0                	mov    %esi,%eax
+  80072c:	e8 7f fb ff ff       	call   8002b0 <printnum>
+			break;
+  800731:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800734:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800737:	e9 75 fc ff ff       	jmp    8003b1 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  80073c:	83 f9 01             	cmp    $0x1,%ecx
+  80073f:	7f 1b                	jg     80075c <vprintfmt+0x3c9>
+	else if (lflag)
+  800741:	85 c9                	test   %ecx,%ecx
+  800743:	74 2c                	je     800771 <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  800745:	8b 45 14             	mov    0x14(%ebp),%eax
+  800748:	8b 10                	mov    (%eax),%edx
+  80074a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80074f:	8d 40 04             	lea    0x4(%eax),%eax
+  800752:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800755:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  80075a:	eb be                	jmp    80071a <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  80075c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80075f:	8b 10                	mov    (%eax),%edx
+  800761:	8b 48 04             	mov    0x4(%eax),%ecx
+  800764:	8d 40 08             	lea    0x8(%eax),%eax
+  800767:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80076a:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80076f:	eb a9                	jmp    80071a <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  800771:	8b 45 14             	mov    0x14(%ebp),%eax
+  800774:	8b 10                	mov    (%eax),%edx
+  800776:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80077b:	8d 40 04             	lea    0x4(%eax),%eax
+  80077e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800781:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800786:	eb 92                	jmp    80071a <vprintfmt+0x387>
+			putch(ch, putdat);
+  800788:	83 ec 08             	sub    $0x8,%esp
+  80078b:	53                   	push   %ebx
+  80078c:	6a 25                	push   $0x25
+  80078e:	ff d6                	call   *%esi
+			break;
+  800790:	83 c4 10             	add    $0x10,%esp
+  800793:	eb 9f                	jmp    800734 <vprintfmt+0x3a1>
+			putch('%', putdat);
+  800795:	83 ec 08             	sub    $0x8,%esp
+  800798:	53                   	push   %ebx
+  800799:	6a 25                	push   $0x25
+  80079b:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80079d:	83 c4 10             	add    $0x10,%esp
+  8007a0:	89 f8                	mov    %edi,%eax
+  8007a2:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8007a6:	74 05                	je     8007ad <vprintfmt+0x41a>
+  8007a8:	83 e8 01             	sub    $0x1,%eax
+  8007ab:	eb f5                	jmp    8007a2 <vprintfmt+0x40f>
+  8007ad:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8007b0:	eb 82                	jmp    800734 <vprintfmt+0x3a1>
+
+008007b2 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8007b2:	55                   	push   %ebp
+  8007b3:	89 e5                	mov    %esp,%ebp
+  8007b5:	83 ec 18             	sub    $0x18,%esp
+  8007b8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007bb:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8007be:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8007c1:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8007c5:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8007c8:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8007cf:	85 c0                	test   %eax,%eax
+  8007d1:	74 26                	je     8007f9 <vsnprintf+0x47>
+  8007d3:	85 d2                	test   %edx,%edx
+  8007d5:	7e 22                	jle    8007f9 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8007d7:	ff 75 14             	push   0x14(%ebp)
+  8007da:	ff 75 10             	push   0x10(%ebp)
+  8007dd:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8007e0:	50                   	push   %eax
+  8007e1:	68 59 03 80 00       	push   $0x800359
+  8007e6:	e8 a8 fb ff ff       	call   800393 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8007eb:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8007ee:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8007f1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007f4:	83 c4 10             	add    $0x10,%esp
+}
+  8007f7:	c9                   	leave
+  8007f8:	c3                   	ret
+		return -E_INVAL;
+  8007f9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007fe:	eb f7                	jmp    8007f7 <vsnprintf+0x45>
+
+00800800 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800800:	55                   	push   %ebp
+  800801:	89 e5                	mov    %esp,%ebp
+  800803:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800806:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800809:	50                   	push   %eax
+  80080a:	ff 75 10             	push   0x10(%ebp)
+  80080d:	ff 75 0c             	push   0xc(%ebp)
+  800810:	ff 75 08             	push   0x8(%ebp)
+  800813:	e8 9a ff ff ff       	call   8007b2 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800818:	c9                   	leave
+  800819:	c3                   	ret
+
+0080081a <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80081a:	55                   	push   %ebp
+  80081b:	89 e5                	mov    %esp,%ebp
+  80081d:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800820:	b8 00 00 00 00       	mov    $0x0,%eax
+  800825:	eb 03                	jmp    80082a <strlen+0x10>
+		n++;
+  800827:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80082a:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80082e:	75 f7                	jne    800827 <strlen+0xd>
+	return n;
+}
+  800830:	5d                   	pop    %ebp
+  800831:	c3                   	ret
+
+00800832 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800832:	55                   	push   %ebp
+  800833:	89 e5                	mov    %esp,%ebp
+  800835:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800838:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80083b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800840:	eb 03                	jmp    800845 <strnlen+0x13>
+		n++;
+  800842:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800845:	39 d0                	cmp    %edx,%eax
+  800847:	74 08                	je     800851 <strnlen+0x1f>
+  800849:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80084d:	75 f3                	jne    800842 <strnlen+0x10>
+  80084f:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800851:	89 d0                	mov    %edx,%eax
+  800853:	5d                   	pop    %ebp
+  800854:	c3                   	ret
+
+00800855 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800855:	55                   	push   %ebp
+  800856:	89 e5                	mov    %esp,%ebp
+  800858:	53                   	push   %ebx
+  800859:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80085c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80085f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800864:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800868:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80086b:	83 c0 01             	add    $0x1,%eax
+  80086e:	84 d2                	test   %dl,%dl
+  800870:	75 f2                	jne    800864 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800872:	89 c8                	mov    %ecx,%eax
+  800874:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800877:	c9                   	leave
+  800878:	c3                   	ret
+
+00800879 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800879:	55                   	push   %ebp
+  80087a:	89 e5                	mov    %esp,%ebp
+  80087c:	53                   	push   %ebx
+  80087d:	83 ec 10             	sub    $0x10,%esp
+  800880:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800883:	53                   	push   %ebx
+  800884:	e8 91 ff ff ff       	call   80081a <strlen>
+  800889:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80088c:	ff 75 0c             	push   0xc(%ebp)
+  80088f:	01 d8                	add    %ebx,%eax
+  800891:	50                   	push   %eax
+  800892:	e8 be ff ff ff       	call   800855 <strcpy>
+	return dst;
+}
+  800897:	89 d8                	mov    %ebx,%eax
+  800899:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80089c:	c9                   	leave
+  80089d:	c3                   	ret
+
+0080089e <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80089e:	55                   	push   %ebp
+  80089f:	89 e5                	mov    %esp,%ebp
+  8008a1:	56                   	push   %esi
+  8008a2:	53                   	push   %ebx
+  8008a3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008a6:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8008a9:	89 f3                	mov    %esi,%ebx
+  8008ab:	03 5d 10             	add    0x10(%ebp),%ebx
+  8008ae:	89 f0                	mov    %esi,%eax
+  8008b0:	eb 0f                	jmp    8008c1 <strncpy+0x23>
+		*dst++ = *src;
+  8008b2:	83 c0 01             	add    $0x1,%eax
+  8008b5:	0f b6 0a             	movzbl (%edx),%ecx
+  8008b8:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8008bb:	80 f9 01             	cmp    $0x1,%cl
+  8008be:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8008c1:	39 d8                	cmp    %ebx,%eax
+  8008c3:	75 ed                	jne    8008b2 <strncpy+0x14>
+	}
+	return ret;
+}
+  8008c5:	89 f0                	mov    %esi,%eax
+  8008c7:	5b                   	pop    %ebx
+  8008c8:	5e                   	pop    %esi
+  8008c9:	5d                   	pop    %ebp
+  8008ca:	c3                   	ret
+
+008008cb <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8008cb:	55                   	push   %ebp
+  8008cc:	89 e5                	mov    %esp,%ebp
+  8008ce:	56                   	push   %esi
+  8008cf:	53                   	push   %ebx
+  8008d0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008d3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008d6:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8008d9:	89 f0                	mov    %esi,%eax
+  8008db:	85 d2                	test   %edx,%edx
+  8008dd:	74 21                	je     800900 <strlcpy+0x35>
+  8008df:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8008e3:	89 f2                	mov    %esi,%edx
+  8008e5:	eb 09                	jmp    8008f0 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8008e7:	83 c1 01             	add    $0x1,%ecx
+  8008ea:	83 c2 01             	add    $0x1,%edx
+  8008ed:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8008f0:	39 c2                	cmp    %eax,%edx
+  8008f2:	74 09                	je     8008fd <strlcpy+0x32>
+  8008f4:	0f b6 19             	movzbl (%ecx),%ebx
+  8008f7:	84 db                	test   %bl,%bl
+  8008f9:	75 ec                	jne    8008e7 <strlcpy+0x1c>
+  8008fb:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8008fd:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800900:	29 f0                	sub    %esi,%eax
+}
+  800902:	5b                   	pop    %ebx
+  800903:	5e                   	pop    %esi
+  800904:	5d                   	pop    %ebp
+  800905:	c3                   	ret
+
+00800906 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800906:	55                   	push   %ebp
+  800907:	89 e5                	mov    %esp,%ebp
+  800909:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80090c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80090f:	eb 06                	jmp    800917 <strcmp+0x11>
+		p++, q++;
+  800911:	83 c1 01             	add    $0x1,%ecx
+  800914:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800917:	0f b6 01             	movzbl (%ecx),%eax
+  80091a:	84 c0                	test   %al,%al
+  80091c:	74 04                	je     800922 <strcmp+0x1c>
+  80091e:	3a 02                	cmp    (%edx),%al
+  800920:	74 ef                	je     800911 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800922:	0f b6 c0             	movzbl %al,%eax
+  800925:	0f b6 12             	movzbl (%edx),%edx
+  800928:	29 d0                	sub    %edx,%eax
+}
+  80092a:	5d                   	pop    %ebp
+  80092b:	c3                   	ret
+
+0080092c <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80092c:	55                   	push   %ebp
+  80092d:	89 e5                	mov    %esp,%ebp
+  80092f:	53                   	push   %ebx
+  800930:	8b 45 08             	mov    0x8(%ebp),%eax
+  800933:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800936:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800939:	eb 09                	jmp    800944 <strncmp+0x18>
+		n--, p++, q++;
+  80093b:	83 ea 01             	sub    $0x1,%edx
+  80093e:	83 c0 01             	add    $0x1,%eax
+  800941:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800944:	85 d2                	test   %edx,%edx
+  800946:	74 18                	je     800960 <strncmp+0x34>
+  800948:	0f b6 18             	movzbl (%eax),%ebx
+  80094b:	84 db                	test   %bl,%bl
+  80094d:	74 04                	je     800953 <strncmp+0x27>
+  80094f:	3a 19                	cmp    (%ecx),%bl
+  800951:	74 e8                	je     80093b <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800953:	0f b6 00             	movzbl (%eax),%eax
+  800956:	0f b6 11             	movzbl (%ecx),%edx
+  800959:	29 d0                	sub    %edx,%eax
+}
+  80095b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80095e:	c9                   	leave
+  80095f:	c3                   	ret
+		return 0;
+  800960:	b8 00 00 00 00       	mov    $0x0,%eax
+  800965:	eb f4                	jmp    80095b <strncmp+0x2f>
+
+00800967 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800967:	55                   	push   %ebp
+  800968:	89 e5                	mov    %esp,%ebp
+  80096a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80096d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800971:	eb 03                	jmp    800976 <strchr+0xf>
+  800973:	83 c0 01             	add    $0x1,%eax
+  800976:	0f b6 10             	movzbl (%eax),%edx
+  800979:	84 d2                	test   %dl,%dl
+  80097b:	74 06                	je     800983 <strchr+0x1c>
+		if (*s == c)
+  80097d:	38 ca                	cmp    %cl,%dl
+  80097f:	75 f2                	jne    800973 <strchr+0xc>
+  800981:	eb 05                	jmp    800988 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800983:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800988:	5d                   	pop    %ebp
+  800989:	c3                   	ret
+
+0080098a <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80098a:	55                   	push   %ebp
+  80098b:	89 e5                	mov    %esp,%ebp
+  80098d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800990:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800994:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800997:	38 ca                	cmp    %cl,%dl
+  800999:	74 09                	je     8009a4 <strfind+0x1a>
+  80099b:	84 d2                	test   %dl,%dl
+  80099d:	74 05                	je     8009a4 <strfind+0x1a>
+	for (; *s; s++)
+  80099f:	83 c0 01             	add    $0x1,%eax
+  8009a2:	eb f0                	jmp    800994 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8009a4:	5d                   	pop    %ebp
+  8009a5:	c3                   	ret
+
+008009a6 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8009a6:	55                   	push   %ebp
+  8009a7:	89 e5                	mov    %esp,%ebp
+  8009a9:	57                   	push   %edi
+  8009aa:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8009ad:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8009b0:	85 c9                	test   %ecx,%ecx
+  8009b2:	74 20                	je     8009d4 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8009b4:	89 f8                	mov    %edi,%eax
+  8009b6:	09 c8                	or     %ecx,%eax
+  8009b8:	a8 03                	test   $0x3,%al
+  8009ba:	75 12                	jne    8009ce <memset+0x28>
+		c &= 0xFF;
+  8009bc:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8009c0:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8009c6:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8009c9:	fc                   	cld
+  8009ca:	f3 ab                	rep stos %eax,%es:(%edi)
+  8009cc:	eb 06                	jmp    8009d4 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8009ce:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8009d1:	fc                   	cld
+  8009d2:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8009d4:	89 f8                	mov    %edi,%eax
+  8009d6:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8009d9:	c9                   	leave
+  8009da:	c3                   	ret
+
+008009db <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8009db:	55                   	push   %ebp
+  8009dc:	89 e5                	mov    %esp,%ebp
+  8009de:	57                   	push   %edi
+  8009df:	56                   	push   %esi
+  8009e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009e3:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8009e6:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8009e9:	39 c6                	cmp    %eax,%esi
+  8009eb:	73 32                	jae    800a1f <memmove+0x44>
+  8009ed:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8009f0:	39 d0                	cmp    %edx,%eax
+  8009f2:	73 2b                	jae    800a1f <memmove+0x44>
+		s += n;
+		d += n;
+  8009f4:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009f7:	89 d6                	mov    %edx,%esi
+  8009f9:	09 fe                	or     %edi,%esi
+  8009fb:	09 ce                	or     %ecx,%esi
+  8009fd:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a03:	75 0e                	jne    800a13 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a05:	83 ef 04             	sub    $0x4,%edi
+  800a08:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a0b:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a0e:	fd                   	std
+  800a0f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a11:	eb 09                	jmp    800a1c <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a13:	83 ef 01             	sub    $0x1,%edi
+  800a16:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800a19:	fd                   	std
+  800a1a:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a1c:	fc                   	cld
+  800a1d:	eb 1a                	jmp    800a39 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a1f:	89 f2                	mov    %esi,%edx
+  800a21:	09 c2                	or     %eax,%edx
+  800a23:	09 ca                	or     %ecx,%edx
+  800a25:	f6 c2 03             	test   $0x3,%dl
+  800a28:	75 0a                	jne    800a34 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a2a:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a2d:	89 c7                	mov    %eax,%edi
+  800a2f:	fc                   	cld
+  800a30:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a32:	eb 05                	jmp    800a39 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a34:	89 c7                	mov    %eax,%edi
+  800a36:	fc                   	cld
+  800a37:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a39:	5e                   	pop    %esi
+  800a3a:	5f                   	pop    %edi
+  800a3b:	5d                   	pop    %ebp
+  800a3c:	c3                   	ret
+
+00800a3d <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a3d:	55                   	push   %ebp
+  800a3e:	89 e5                	mov    %esp,%ebp
+  800a40:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a43:	ff 75 10             	push   0x10(%ebp)
+  800a46:	ff 75 0c             	push   0xc(%ebp)
+  800a49:	ff 75 08             	push   0x8(%ebp)
+  800a4c:	e8 8a ff ff ff       	call   8009db <memmove>
+}
+  800a51:	c9                   	leave
+  800a52:	c3                   	ret
+
+00800a53 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a53:	55                   	push   %ebp
+  800a54:	89 e5                	mov    %esp,%ebp
+  800a56:	56                   	push   %esi
+  800a57:	53                   	push   %ebx
+  800a58:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a5b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a5e:	89 c6                	mov    %eax,%esi
+  800a60:	03 75 10             	add    0x10(%ebp),%esi
+  800a63:	eb 06                	jmp    800a6b <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a65:	83 c0 01             	add    $0x1,%eax
+  800a68:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a6b:	39 f0                	cmp    %esi,%eax
+  800a6d:	74 14                	je     800a83 <memcmp+0x30>
+		if (*s1 != *s2)
+  800a6f:	0f b6 08             	movzbl (%eax),%ecx
+  800a72:	0f b6 1a             	movzbl (%edx),%ebx
+  800a75:	38 d9                	cmp    %bl,%cl
+  800a77:	74 ec                	je     800a65 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a79:	0f b6 c1             	movzbl %cl,%eax
+  800a7c:	0f b6 db             	movzbl %bl,%ebx
+  800a7f:	29 d8                	sub    %ebx,%eax
+  800a81:	eb 05                	jmp    800a88 <memcmp+0x35>
+	}
+
+	return 0;
+  800a83:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a88:	5b                   	pop    %ebx
+  800a89:	5e                   	pop    %esi
+  800a8a:	5d                   	pop    %ebp
+  800a8b:	c3                   	ret
+
+00800a8c <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a8c:	55                   	push   %ebp
+  800a8d:	89 e5                	mov    %esp,%ebp
+  800a8f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a92:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a95:	89 c2                	mov    %eax,%edx
+  800a97:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a9a:	eb 03                	jmp    800a9f <memfind+0x13>
+  800a9c:	83 c0 01             	add    $0x1,%eax
+  800a9f:	39 d0                	cmp    %edx,%eax
+  800aa1:	73 04                	jae    800aa7 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800aa3:	38 08                	cmp    %cl,(%eax)
+  800aa5:	75 f5                	jne    800a9c <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800aa7:	5d                   	pop    %ebp
+  800aa8:	c3                   	ret
+
+00800aa9 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800aa9:	55                   	push   %ebp
+  800aaa:	89 e5                	mov    %esp,%ebp
+  800aac:	57                   	push   %edi
+  800aad:	56                   	push   %esi
+  800aae:	53                   	push   %ebx
+  800aaf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ab2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800ab5:	eb 03                	jmp    800aba <strtol+0x11>
+		s++;
+  800ab7:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800aba:	0f b6 02             	movzbl (%edx),%eax
+  800abd:	3c 20                	cmp    $0x20,%al
+  800abf:	74 f6                	je     800ab7 <strtol+0xe>
+  800ac1:	3c 09                	cmp    $0x9,%al
+  800ac3:	74 f2                	je     800ab7 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800ac5:	3c 2b                	cmp    $0x2b,%al
+  800ac7:	74 2a                	je     800af3 <strtol+0x4a>
+	int neg = 0;
+  800ac9:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800ace:	3c 2d                	cmp    $0x2d,%al
+  800ad0:	74 2b                	je     800afd <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ad2:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800ad8:	75 0f                	jne    800ae9 <strtol+0x40>
+  800ada:	80 3a 30             	cmpb   $0x30,(%edx)
+  800add:	74 28                	je     800b07 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800adf:	85 db                	test   %ebx,%ebx
+  800ae1:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ae6:	0f 44 d8             	cmove  %eax,%ebx
+  800ae9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800aee:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800af1:	eb 46                	jmp    800b39 <strtol+0x90>
+		s++;
+  800af3:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800af6:	bf 00 00 00 00       	mov    $0x0,%edi
+  800afb:	eb d5                	jmp    800ad2 <strtol+0x29>
+		s++, neg = 1;
+  800afd:	83 c2 01             	add    $0x1,%edx
+  800b00:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b05:	eb cb                	jmp    800ad2 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b07:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b0b:	74 0e                	je     800b1b <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800b0d:	85 db                	test   %ebx,%ebx
+  800b0f:	75 d8                	jne    800ae9 <strtol+0x40>
+		s++, base = 8;
+  800b11:	83 c2 01             	add    $0x1,%edx
+  800b14:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b19:	eb ce                	jmp    800ae9 <strtol+0x40>
+		s += 2, base = 16;
+  800b1b:	83 c2 02             	add    $0x2,%edx
+  800b1e:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b23:	eb c4                	jmp    800ae9 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800b25:	0f be c0             	movsbl %al,%eax
+  800b28:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800b2b:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b2e:	7d 3a                	jge    800b6a <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800b30:	83 c2 01             	add    $0x1,%edx
+  800b33:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800b37:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800b39:	0f b6 02             	movzbl (%edx),%eax
+  800b3c:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b3f:	89 f3                	mov    %esi,%ebx
+  800b41:	80 fb 09             	cmp    $0x9,%bl
+  800b44:	76 df                	jbe    800b25 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800b46:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b49:	89 f3                	mov    %esi,%ebx
+  800b4b:	80 fb 19             	cmp    $0x19,%bl
+  800b4e:	77 08                	ja     800b58 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800b50:	0f be c0             	movsbl %al,%eax
+  800b53:	83 e8 57             	sub    $0x57,%eax
+  800b56:	eb d3                	jmp    800b2b <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b58:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b5b:	89 f3                	mov    %esi,%ebx
+  800b5d:	80 fb 19             	cmp    $0x19,%bl
+  800b60:	77 08                	ja     800b6a <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800b62:	0f be c0             	movsbl %al,%eax
+  800b65:	83 e8 37             	sub    $0x37,%eax
+  800b68:	eb c1                	jmp    800b2b <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b6a:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b6e:	74 05                	je     800b75 <strtol+0xcc>
+		*endptr = (char *) s;
+  800b70:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b73:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800b75:	89 c8                	mov    %ecx,%eax
+  800b77:	f7 d8                	neg    %eax
+  800b79:	85 ff                	test   %edi,%edi
+  800b7b:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b7e:	89 c8                	mov    %ecx,%eax
+  800b80:	5b                   	pop    %ebx
+  800b81:	5e                   	pop    %esi
+  800b82:	5f                   	pop    %edi
+  800b83:	5d                   	pop    %ebp
+  800b84:	c3                   	ret
+
+00800b85 <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800b85:	55                   	push   %ebp
+  800b86:	89 e5                	mov    %esp,%ebp
+  800b88:	57                   	push   %edi
+  800b89:	56                   	push   %esi
+  800b8a:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800b8b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b90:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b93:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b96:	89 c3                	mov    %eax,%ebx
+  800b98:	89 c7                	mov    %eax,%edi
+  800b9a:	89 c6                	mov    %eax,%esi
+  800b9c:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  800b9e:	5b                   	pop    %ebx
+  800b9f:	5e                   	pop    %esi
+  800ba0:	5f                   	pop    %edi
+  800ba1:	5d                   	pop    %ebp
+  800ba2:	c3                   	ret
+
+00800ba3 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800ba3:	55                   	push   %ebp
+  800ba4:	89 e5                	mov    %esp,%ebp
+  800ba6:	57                   	push   %edi
+  800ba7:	56                   	push   %esi
+  800ba8:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800ba9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bae:	b8 01 00 00 00       	mov    $0x1,%eax
+  800bb3:	89 d1                	mov    %edx,%ecx
+  800bb5:	89 d3                	mov    %edx,%ebx
+  800bb7:	89 d7                	mov    %edx,%edi
+  800bb9:	89 d6                	mov    %edx,%esi
+  800bbb:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800bbd:	5b                   	pop    %ebx
+  800bbe:	5e                   	pop    %esi
+  800bbf:	5f                   	pop    %edi
+  800bc0:	5d                   	pop    %ebp
+  800bc1:	c3                   	ret
+
+00800bc2 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800bc2:	55                   	push   %ebp
+  800bc3:	89 e5                	mov    %esp,%ebp
+  800bc5:	57                   	push   %edi
+  800bc6:	56                   	push   %esi
+  800bc7:	53                   	push   %ebx
+  800bc8:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800bcb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bd0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bd3:	b8 03 00 00 00       	mov    $0x3,%eax
+  800bd8:	89 cb                	mov    %ecx,%ebx
+  800bda:	89 cf                	mov    %ecx,%edi
+  800bdc:	89 ce                	mov    %ecx,%esi
+  800bde:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800be0:	85 c0                	test   %eax,%eax
+  800be2:	7f 08                	jg     800bec <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800be4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800be7:	5b                   	pop    %ebx
+  800be8:	5e                   	pop    %esi
+  800be9:	5f                   	pop    %edi
+  800bea:	5d                   	pop    %ebp
+  800beb:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800bec:	83 ec 0c             	sub    $0xc,%esp
+  800bef:	50                   	push   %eax
+  800bf0:	6a 03                	push   $0x3
+  800bf2:	68 a3 2d 80 00       	push   $0x802da3
+  800bf7:	6a 3e                	push   $0x3e
+  800bf9:	68 c0 2d 80 00       	push   $0x802dc0
+  800bfe:	e8 40 18 00 00       	call   802443 <_panic>
+
+00800c03 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800c03:	55                   	push   %ebp
+  800c04:	89 e5                	mov    %esp,%ebp
+  800c06:	57                   	push   %edi
+  800c07:	56                   	push   %esi
+  800c08:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800c09:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c0e:	b8 02 00 00 00       	mov    $0x2,%eax
+  800c13:	89 d1                	mov    %edx,%ecx
+  800c15:	89 d3                	mov    %edx,%ebx
+  800c17:	89 d7                	mov    %edx,%edi
+  800c19:	89 d6                	mov    %edx,%esi
+  800c1b:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800c1d:	5b                   	pop    %ebx
+  800c1e:	5e                   	pop    %esi
+  800c1f:	5f                   	pop    %edi
+  800c20:	5d                   	pop    %ebp
+  800c21:	c3                   	ret
+
+00800c22 <sys_yield>:
+
+void
+sys_yield(void) {
+  800c22:	55                   	push   %ebp
+  800c23:	89 e5                	mov    %esp,%ebp
+  800c25:	57                   	push   %edi
+  800c26:	56                   	push   %esi
+  800c27:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800c28:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c2d:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800c32:	89 d1                	mov    %edx,%ecx
+  800c34:	89 d3                	mov    %edx,%ebx
+  800c36:	89 d7                	mov    %edx,%edi
+  800c38:	89 d6                	mov    %edx,%esi
+  800c3a:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800c3c:	5b                   	pop    %ebx
+  800c3d:	5e                   	pop    %esi
+  800c3e:	5f                   	pop    %edi
+  800c3f:	5d                   	pop    %ebp
+  800c40:	c3                   	ret
+
+00800c41 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  800c41:	55                   	push   %ebp
+  800c42:	89 e5                	mov    %esp,%ebp
+  800c44:	57                   	push   %edi
+  800c45:	56                   	push   %esi
+  800c46:	53                   	push   %ebx
+  800c47:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c4a:	be 00 00 00 00       	mov    $0x0,%esi
+  800c4f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c52:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c55:	b8 04 00 00 00       	mov    $0x4,%eax
+  800c5a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c5d:	89 f7                	mov    %esi,%edi
+  800c5f:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c61:	85 c0                	test   %eax,%eax
+  800c63:	7f 08                	jg     800c6d <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800c65:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c68:	5b                   	pop    %ebx
+  800c69:	5e                   	pop    %esi
+  800c6a:	5f                   	pop    %edi
+  800c6b:	5d                   	pop    %ebp
+  800c6c:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c6d:	83 ec 0c             	sub    $0xc,%esp
+  800c70:	50                   	push   %eax
+  800c71:	6a 04                	push   $0x4
+  800c73:	68 a3 2d 80 00       	push   $0x802da3
+  800c78:	6a 3e                	push   $0x3e
+  800c7a:	68 c0 2d 80 00       	push   $0x802dc0
+  800c7f:	e8 bf 17 00 00       	call   802443 <_panic>
+
+00800c84 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  800c84:	55                   	push   %ebp
+  800c85:	89 e5                	mov    %esp,%ebp
+  800c87:	57                   	push   %edi
+  800c88:	56                   	push   %esi
+  800c89:	53                   	push   %ebx
+  800c8a:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c8d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c90:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c93:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c98:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c9b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c9e:	8b 75 18             	mov    0x18(%ebp),%esi
+  800ca1:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ca3:	85 c0                	test   %eax,%eax
+  800ca5:	7f 08                	jg     800caf <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800ca7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800caa:	5b                   	pop    %ebx
+  800cab:	5e                   	pop    %esi
+  800cac:	5f                   	pop    %edi
+  800cad:	5d                   	pop    %ebp
+  800cae:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800caf:	83 ec 0c             	sub    $0xc,%esp
+  800cb2:	50                   	push   %eax
+  800cb3:	6a 05                	push   $0x5
+  800cb5:	68 a3 2d 80 00       	push   $0x802da3
+  800cba:	6a 3e                	push   $0x3e
+  800cbc:	68 c0 2d 80 00       	push   $0x802dc0
+  800cc1:	e8 7d 17 00 00       	call   802443 <_panic>
+
+00800cc6 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  800cc6:	55                   	push   %ebp
+  800cc7:	89 e5                	mov    %esp,%ebp
+  800cc9:	57                   	push   %edi
+  800cca:	56                   	push   %esi
+  800ccb:	53                   	push   %ebx
+  800ccc:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800ccf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cd4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cd7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cda:	b8 06 00 00 00       	mov    $0x6,%eax
+  800cdf:	89 df                	mov    %ebx,%edi
+  800ce1:	89 de                	mov    %ebx,%esi
+  800ce3:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ce5:	85 c0                	test   %eax,%eax
+  800ce7:	7f 08                	jg     800cf1 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800ce9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cec:	5b                   	pop    %ebx
+  800ced:	5e                   	pop    %esi
+  800cee:	5f                   	pop    %edi
+  800cef:	5d                   	pop    %ebp
+  800cf0:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800cf1:	83 ec 0c             	sub    $0xc,%esp
+  800cf4:	50                   	push   %eax
+  800cf5:	6a 06                	push   $0x6
+  800cf7:	68 a3 2d 80 00       	push   $0x802da3
+  800cfc:	6a 3e                	push   $0x3e
+  800cfe:	68 c0 2d 80 00       	push   $0x802dc0
+  800d03:	e8 3b 17 00 00       	call   802443 <_panic>
+
+00800d08 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800d08:	55                   	push   %ebp
+  800d09:	89 e5                	mov    %esp,%ebp
+  800d0b:	57                   	push   %edi
+  800d0c:	56                   	push   %esi
+  800d0d:	53                   	push   %ebx
+  800d0e:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800d11:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d16:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d19:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d1c:	b8 08 00 00 00       	mov    $0x8,%eax
+  800d21:	89 df                	mov    %ebx,%edi
+  800d23:	89 de                	mov    %ebx,%esi
+  800d25:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d27:	85 c0                	test   %eax,%eax
+  800d29:	7f 08                	jg     800d33 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800d2b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d2e:	5b                   	pop    %ebx
+  800d2f:	5e                   	pop    %esi
+  800d30:	5f                   	pop    %edi
+  800d31:	5d                   	pop    %ebp
+  800d32:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d33:	83 ec 0c             	sub    $0xc,%esp
+  800d36:	50                   	push   %eax
+  800d37:	6a 08                	push   $0x8
+  800d39:	68 a3 2d 80 00       	push   $0x802da3
+  800d3e:	6a 3e                	push   $0x3e
+  800d40:	68 c0 2d 80 00       	push   $0x802dc0
+  800d45:	e8 f9 16 00 00       	call   802443 <_panic>
+
+00800d4a <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800d4a:	55                   	push   %ebp
+  800d4b:	89 e5                	mov    %esp,%ebp
+  800d4d:	57                   	push   %edi
+  800d4e:	56                   	push   %esi
+  800d4f:	53                   	push   %ebx
+  800d50:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800d53:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d58:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d5b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d5e:	b8 09 00 00 00       	mov    $0x9,%eax
+  800d63:	89 df                	mov    %ebx,%edi
+  800d65:	89 de                	mov    %ebx,%esi
+  800d67:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d69:	85 c0                	test   %eax,%eax
+  800d6b:	7f 08                	jg     800d75 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800d6d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d70:	5b                   	pop    %ebx
+  800d71:	5e                   	pop    %esi
+  800d72:	5f                   	pop    %edi
+  800d73:	5d                   	pop    %ebp
+  800d74:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d75:	83 ec 0c             	sub    $0xc,%esp
+  800d78:	50                   	push   %eax
+  800d79:	6a 09                	push   $0x9
+  800d7b:	68 a3 2d 80 00       	push   $0x802da3
+  800d80:	6a 3e                	push   $0x3e
+  800d82:	68 c0 2d 80 00       	push   $0x802dc0
+  800d87:	e8 b7 16 00 00       	call   802443 <_panic>
+
+00800d8c <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800d8c:	55                   	push   %ebp
+  800d8d:	89 e5                	mov    %esp,%ebp
+  800d8f:	57                   	push   %edi
+  800d90:	56                   	push   %esi
+  800d91:	53                   	push   %ebx
+  800d92:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800d95:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d9a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d9d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800da0:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800da5:	89 df                	mov    %ebx,%edi
+  800da7:	89 de                	mov    %ebx,%esi
+  800da9:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800dab:	85 c0                	test   %eax,%eax
+  800dad:	7f 08                	jg     800db7 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800daf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800db2:	5b                   	pop    %ebx
+  800db3:	5e                   	pop    %esi
+  800db4:	5f                   	pop    %edi
+  800db5:	5d                   	pop    %ebp
+  800db6:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800db7:	83 ec 0c             	sub    $0xc,%esp
+  800dba:	50                   	push   %eax
+  800dbb:	6a 0a                	push   $0xa
+  800dbd:	68 a3 2d 80 00       	push   $0x802da3
+  800dc2:	6a 3e                	push   $0x3e
+  800dc4:	68 c0 2d 80 00       	push   $0x802dc0
+  800dc9:	e8 75 16 00 00       	call   802443 <_panic>
+
+00800dce <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  800dce:	55                   	push   %ebp
+  800dcf:	89 e5                	mov    %esp,%ebp
+  800dd1:	57                   	push   %edi
+  800dd2:	56                   	push   %esi
+  800dd3:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800dd4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dda:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800ddf:	be 00 00 00 00       	mov    $0x0,%esi
+  800de4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800de7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dea:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800dec:	5b                   	pop    %ebx
+  800ded:	5e                   	pop    %esi
+  800dee:	5f                   	pop    %edi
+  800def:	5d                   	pop    %ebp
+  800df0:	c3                   	ret
+
+00800df1 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  800df1:	55                   	push   %ebp
+  800df2:	89 e5                	mov    %esp,%ebp
+  800df4:	57                   	push   %edi
+  800df5:	56                   	push   %esi
+  800df6:	53                   	push   %ebx
+  800df7:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800dfa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dff:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e02:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e07:	89 cb                	mov    %ecx,%ebx
+  800e09:	89 cf                	mov    %ecx,%edi
+  800e0b:	89 ce                	mov    %ecx,%esi
+  800e0d:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e0f:	85 c0                	test   %eax,%eax
+  800e11:	7f 08                	jg     800e1b <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  800e13:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e16:	5b                   	pop    %ebx
+  800e17:	5e                   	pop    %esi
+  800e18:	5f                   	pop    %edi
+  800e19:	5d                   	pop    %ebp
+  800e1a:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e1b:	83 ec 0c             	sub    $0xc,%esp
+  800e1e:	50                   	push   %eax
+  800e1f:	6a 0d                	push   $0xd
+  800e21:	68 a3 2d 80 00       	push   $0x802da3
+  800e26:	6a 3e                	push   $0x3e
+  800e28:	68 c0 2d 80 00       	push   $0x802dc0
+  800e2d:	e8 11 16 00 00       	call   802443 <_panic>
+
+00800e32 <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  800e32:	55                   	push   %ebp
+  800e33:	89 e5                	mov    %esp,%ebp
+  800e35:	57                   	push   %edi
+  800e36:	56                   	push   %esi
+  800e37:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e38:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e3d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e40:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e43:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800e48:	89 df                	mov    %ebx,%edi
+  800e4a:	89 de                	mov    %ebx,%esi
+  800e4c:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  800e4e:	5b                   	pop    %ebx
+  800e4f:	5e                   	pop    %esi
+  800e50:	5f                   	pop    %edi
+  800e51:	5d                   	pop    %ebp
+  800e52:	c3                   	ret
+
+00800e53 <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  800e53:	55                   	push   %ebp
+  800e54:	89 e5                	mov    %esp,%ebp
+  800e56:	57                   	push   %edi
+  800e57:	56                   	push   %esi
+  800e58:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e59:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e5e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e61:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800e66:	89 cb                	mov    %ecx,%ebx
+  800e68:	89 cf                	mov    %ecx,%edi
+  800e6a:	89 ce                	mov    %ecx,%esi
+  800e6c:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  800e6e:	5b                   	pop    %ebx
+  800e6f:	5e                   	pop    %esi
+  800e70:	5f                   	pop    %edi
+  800e71:	5d                   	pop    %ebp
+  800e72:	c3                   	ret
+
+00800e73 <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  800e73:	55                   	push   %ebp
+  800e74:	89 e5                	mov    %esp,%ebp
+  800e76:	57                   	push   %edi
+  800e77:	56                   	push   %esi
+  800e78:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e79:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e7e:	b8 10 00 00 00       	mov    $0x10,%eax
+  800e83:	89 d1                	mov    %edx,%ecx
+  800e85:	89 d3                	mov    %edx,%ebx
+  800e87:	89 d7                	mov    %edx,%edi
+  800e89:	89 d6                	mov    %edx,%esi
+  800e8b:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800e8d:	5b                   	pop    %ebx
+  800e8e:	5e                   	pop    %esi
+  800e8f:	5f                   	pop    %edi
+  800e90:	5d                   	pop    %ebp
+  800e91:	c3                   	ret
+
+00800e92 <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  800e92:	55                   	push   %ebp
+  800e93:	89 e5                	mov    %esp,%ebp
+  800e95:	57                   	push   %edi
+  800e96:	56                   	push   %esi
+  800e97:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e98:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e9d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ea0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ea3:	b8 11 00 00 00       	mov    $0x11,%eax
+  800ea8:	89 df                	mov    %ebx,%edi
+  800eaa:	89 de                	mov    %ebx,%esi
+  800eac:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800eae:	5b                   	pop    %ebx
+  800eaf:	5e                   	pop    %esi
+  800eb0:	5f                   	pop    %edi
+  800eb1:	5d                   	pop    %ebp
+  800eb2:	c3                   	ret
+
+00800eb3 <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  800eb3:	55                   	push   %ebp
+  800eb4:	89 e5                	mov    %esp,%ebp
+  800eb6:	57                   	push   %edi
+  800eb7:	56                   	push   %esi
+  800eb8:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800eb9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ebe:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec4:	b8 12 00 00 00       	mov    $0x12,%eax
+  800ec9:	89 df                	mov    %ebx,%edi
+  800ecb:	89 de                	mov    %ebx,%esi
+  800ecd:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800ecf:	5b                   	pop    %ebx
+  800ed0:	5e                   	pop    %esi
+  800ed1:	5f                   	pop    %edi
+  800ed2:	5d                   	pop    %ebp
+  800ed3:	c3                   	ret
+
+00800ed4 <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  800ed4:	55                   	push   %ebp
+  800ed5:	89 e5                	mov    %esp,%ebp
+  800ed7:	57                   	push   %edi
+  800ed8:	56                   	push   %esi
+  800ed9:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800eda:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800edf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee2:	b8 13 00 00 00       	mov    $0x13,%eax
+  800ee7:	89 cb                	mov    %ecx,%ebx
+  800ee9:	89 cf                	mov    %ecx,%edi
+  800eeb:	89 ce                	mov    %ecx,%esi
+  800eed:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  800eef:	5b                   	pop    %ebx
+  800ef0:	5e                   	pop    %esi
+  800ef1:	5f                   	pop    %edi
+  800ef2:	5d                   	pop    %ebp
+  800ef3:	c3                   	ret
+
+00800ef4 <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  800ef4:	55                   	push   %ebp
+  800ef5:	89 e5                	mov    %esp,%ebp
+  800ef7:	57                   	push   %edi
+  800ef8:	56                   	push   %esi
+  800ef9:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800efa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800eff:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f02:	b8 14 00 00 00       	mov    $0x14,%eax
+  800f07:	89 cb                	mov    %ecx,%ebx
+  800f09:	89 cf                	mov    %ecx,%edi
+  800f0b:	89 ce                	mov    %ecx,%esi
+  800f0d:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  800f0f:	5b                   	pop    %ebx
+  800f10:	5e                   	pop    %esi
+  800f11:	5f                   	pop    %edi
+  800f12:	5d                   	pop    %ebp
+  800f13:	c3                   	ret
+
+00800f14 <pgfault>:
+//
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf) {
+  800f14:	55                   	push   %ebp
+  800f15:	89 e5                	mov    %esp,%ebp
+  800f17:	53                   	push   %ebx
+  800f18:	83 ec 04             	sub    $0x4,%esp
+  800f1b:	8b 45 08             	mov    0x8(%ebp),%eax
+    void *addr = (void *) utf->utf_fault_va;
+  800f1e:	8b 18                	mov    (%eax),%ebx
+    // Hint:
+    //   Use the read-only page table mappings at uvpt
+    //   (see <inc/memlayout.h>).
+
+    // LAB 4: Your code here.
+    if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P) ||
+  800f20:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  800f24:	0f 84 95 00 00 00    	je     800fbf <pgfault+0xab>
+  800f2a:	89 d8                	mov    %ebx,%eax
+  800f2c:	c1 e8 16             	shr    $0x16,%eax
+  800f2f:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  800f36:	a8 01                	test   $0x1,%al
+  800f38:	0f 84 81 00 00 00    	je     800fbf <pgfault+0xab>
+        (uvpt[PGNUM(addr)] & (PTE_P | PTE_COW)) != (PTE_P | PTE_COW)) {
+  800f3e:	89 d8                	mov    %ebx,%eax
+  800f40:	c1 e8 0c             	shr    $0xc,%eax
+  800f43:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800f4a:	25 01 08 00 00       	and    $0x801,%eax
+    if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P) ||
+  800f4f:	3d 01 08 00 00       	cmp    $0x801,%eax
+  800f54:	75 69                	jne    800fbf <pgfault+0xab>
+    // Hint:
+    //   You should make three system calls.
+
+    // LAB 4: Your code here.
+
+    if (sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W))
+  800f56:	83 ec 04             	sub    $0x4,%esp
+  800f59:	6a 07                	push   $0x7
+  800f5b:	68 00 f0 7f 00       	push   $0x7ff000
+  800f60:	6a 00                	push   $0x0
+  800f62:	e8 da fc ff ff       	call   800c41 <sys_page_alloc>
+  800f67:	83 c4 10             	add    $0x10,%esp
+  800f6a:	85 c0                	test   %eax,%eax
+  800f6c:	75 65                	jne    800fd3 <pgfault+0xbf>
+        panic("sys_page_alloc failed");
+
+    addr = ROUNDDOWN(addr, PGSIZE);
+  800f6e:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+    memmove(PFTEMP, addr, PGSIZE);
+  800f74:	83 ec 04             	sub    $0x4,%esp
+  800f77:	68 00 10 00 00       	push   $0x1000
+  800f7c:	53                   	push   %ebx
+  800f7d:	68 00 f0 7f 00       	push   $0x7ff000
+  800f82:	e8 54 fa ff ff       	call   8009db <memmove>
+
+    if (sys_page_map(0, PFTEMP, 0, addr, PTE_P | PTE_U | PTE_W))
+  800f87:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  800f8e:	53                   	push   %ebx
+  800f8f:	6a 00                	push   $0x0
+  800f91:	68 00 f0 7f 00       	push   $0x7ff000
+  800f96:	6a 00                	push   $0x0
+  800f98:	e8 e7 fc ff ff       	call   800c84 <sys_page_map>
+  800f9d:	83 c4 20             	add    $0x20,%esp
+  800fa0:	85 c0                	test   %eax,%eax
+  800fa2:	75 43                	jne    800fe7 <pgfault+0xd3>
+        panic("sys_page_map failed");
+    if (sys_page_unmap(0, PFTEMP))
+  800fa4:	83 ec 08             	sub    $0x8,%esp
+  800fa7:	68 00 f0 7f 00       	push   $0x7ff000
+  800fac:	6a 00                	push   $0x0
+  800fae:	e8 13 fd ff ff       	call   800cc6 <sys_page_unmap>
+  800fb3:	83 c4 10             	add    $0x10,%esp
+  800fb6:	85 c0                	test   %eax,%eax
+  800fb8:	75 41                	jne    800ffb <pgfault+0xe7>
+        panic("sys_page_unmap failed");
+
+}
+  800fba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800fbd:	c9                   	leave
+  800fbe:	c3                   	ret
+        panic("pgfault: faulting access invalid");
+  800fbf:	83 ec 04             	sub    $0x4,%esp
+  800fc2:	68 d0 2d 80 00       	push   $0x802dd0
+  800fc7:	6a 1e                	push   $0x1e
+  800fc9:	68 3c 2e 80 00       	push   $0x802e3c
+  800fce:	e8 70 14 00 00       	call   802443 <_panic>
+        panic("sys_page_alloc failed");
+  800fd3:	83 ec 04             	sub    $0x4,%esp
+  800fd6:	68 af 2e 80 00       	push   $0x802eaf
+  800fdb:	6a 2a                	push   $0x2a
+  800fdd:	68 3c 2e 80 00       	push   $0x802e3c
+  800fe2:	e8 5c 14 00 00       	call   802443 <_panic>
+        panic("sys_page_map failed");
+  800fe7:	83 ec 04             	sub    $0x4,%esp
+  800fea:	68 47 2e 80 00       	push   $0x802e47
+  800fef:	6a 30                	push   $0x30
+  800ff1:	68 3c 2e 80 00       	push   $0x802e3c
+  800ff6:	e8 48 14 00 00       	call   802443 <_panic>
+        panic("sys_page_unmap failed");
+  800ffb:	83 ec 04             	sub    $0x4,%esp
+  800ffe:	68 5b 2e 80 00       	push   $0x802e5b
+  801003:	6a 32                	push   $0x32
+  801005:	68 3c 2e 80 00       	push   $0x802e3c
+  80100a:	e8 34 14 00 00       	call   802443 <_panic>
+
+0080100f <fork>:
+//   Remember to fix "thisenv" in the child process.
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void) {
+  80100f:	55                   	push   %ebp
+  801010:	89 e5                	mov    %esp,%ebp
+  801012:	57                   	push   %edi
+  801013:	56                   	push   %esi
+  801014:	53                   	push   %ebx
+  801015:	83 ec 18             	sub    $0x18,%esp
+    // LAB 4: Your code here.
+    set_pgfault_handler(pgfault);
+  801018:	68 14 0f 80 00       	push   $0x800f14
+  80101d:	e8 67 14 00 00       	call   802489 <set_pgfault_handler>
+
+// This must be inlined.  Exercise for reader: why?
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+  envid_t ret;
+  asm volatile("int %2"
+  801022:	b8 07 00 00 00       	mov    $0x7,%eax
+  801027:	cd 30                	int    $0x30
+  801029:	89 c6                	mov    %eax,%esi
+
+    envid_t envid = sys_exofork();
+    if (envid < 0)
+  80102b:	83 c4 10             	add    $0x10,%esp
+  80102e:	85 c0                	test   %eax,%eax
+  801030:	78 2a                	js     80105c <fork+0x4d>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+
+    uintptr_t addr;
+    for (addr = 0; addr < UTOP; addr += PGSIZE) {
+  801032:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (envid == 0) {
+  801037:	0f 85 a2 00 00 00    	jne    8010df <fork+0xd0>
+        thisenv = &envs[ENVX(sys_getenvid())];
+  80103d:	e8 c1 fb ff ff       	call   800c03 <sys_getenvid>
+  801042:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801047:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80104a:	c1 e0 04             	shl    $0x4,%eax
+  80104d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801052:	a3 08 50 80 00       	mov    %eax,0x805008
+        return 0;
+  801057:	e9 6c 01 00 00       	jmp    8011c8 <fork+0x1b9>
+        panic("fork: sys_exofork error: %e", envid);
+  80105c:	50                   	push   %eax
+  80105d:	68 71 2e 80 00       	push   $0x802e71
+  801062:	6a 6f                	push   $0x6f
+  801064:	68 3c 2e 80 00       	push   $0x802e3c
+  801069:	e8 d5 13 00 00       	call   802443 <_panic>
+        if ((r = sys_page_map(0, vptr, envid, vptr, uvpt[pn] & PTE_SYSCALL)) < 0)
+  80106e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801075:	83 ec 0c             	sub    $0xc,%esp
+  801078:	25 07 0e 00 00       	and    $0xe07,%eax
+  80107d:	50                   	push   %eax
+  80107e:	57                   	push   %edi
+  80107f:	56                   	push   %esi
+  801080:	57                   	push   %edi
+  801081:	6a 00                	push   $0x0
+  801083:	e8 fc fb ff ff       	call   800c84 <sys_page_map>
+  801088:	83 c4 20             	add    $0x20,%esp
+  80108b:	85 c0                	test   %eax,%eax
+  80108d:	79 3e                	jns    8010cd <fork+0xbe>
+            panic("duppage :in sys_page_map %e", r);
+  80108f:	50                   	push   %eax
+  801090:	68 8d 2e 80 00       	push   $0x802e8d
+  801095:	6a 49                	push   $0x49
+  801097:	68 3c 2e 80 00       	push   $0x802e3c
+  80109c:	e8 a2 13 00 00       	call   802443 <_panic>
+            panic("duppage :in sys_page_map %e", r);
+  8010a1:	50                   	push   %eax
+  8010a2:	68 8d 2e 80 00       	push   $0x802e8d
+  8010a7:	6a 4e                	push   $0x4e
+  8010a9:	68 3c 2e 80 00       	push   $0x802e3c
+  8010ae:	e8 90 13 00 00       	call   802443 <_panic>
+    } else if ((r = sys_page_map(0, vptr, envid, vptr, PTE_P | PTE_U)) < 0)
+  8010b3:	83 ec 0c             	sub    $0xc,%esp
+  8010b6:	6a 05                	push   $0x5
+  8010b8:	57                   	push   %edi
+  8010b9:	56                   	push   %esi
+  8010ba:	57                   	push   %edi
+  8010bb:	6a 00                	push   $0x0
+  8010bd:	e8 c2 fb ff ff       	call   800c84 <sys_page_map>
+  8010c2:	83 c4 20             	add    $0x20,%esp
+  8010c5:	85 c0                	test   %eax,%eax
+  8010c7:	0f 88 ab 00 00 00    	js     801178 <fork+0x169>
+    for (addr = 0; addr < UTOP; addr += PGSIZE) {
+  8010cd:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8010d3:	81 fb 00 00 c0 ee    	cmp    $0xeec00000,%ebx
+  8010d9:	0f 84 ab 00 00 00    	je     80118a <fork+0x17b>
+        if (uvpd[PDX(addr)] & PTE_P && uvpt[PGNUM(addr)] & PTE_P && addr != UXSTACKTOP - PGSIZE) {
+  8010df:	89 d8                	mov    %ebx,%eax
+  8010e1:	c1 e8 16             	shr    $0x16,%eax
+  8010e4:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8010eb:	a8 01                	test   $0x1,%al
+  8010ed:	74 de                	je     8010cd <fork+0xbe>
+  8010ef:	89 d8                	mov    %ebx,%eax
+  8010f1:	c1 e8 0c             	shr    $0xc,%eax
+  8010f4:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8010fb:	f6 c2 01             	test   $0x1,%dl
+  8010fe:	74 cd                	je     8010cd <fork+0xbe>
+  801100:	81 fb 00 f0 bf ee    	cmp    $0xeebff000,%ebx
+  801106:	74 c5                	je     8010cd <fork+0xbe>
+    void *vptr = (void *) (pn * PGSIZE);
+  801108:	89 c7                	mov    %eax,%edi
+  80110a:	c1 e7 0c             	shl    $0xc,%edi
+    if (uvpt[pn] & PTE_SHARE) {
+  80110d:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801114:	f6 c6 04             	test   $0x4,%dh
+  801117:	0f 85 51 ff ff ff    	jne    80106e <fork+0x5f>
+    } else if (uvpt[pn] & (PTE_W | PTE_COW)) {
+  80111d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801124:	a9 02 08 00 00       	test   $0x802,%eax
+  801129:	74 88                	je     8010b3 <fork+0xa4>
+        if ((r = sys_page_map(0, vptr, envid, vptr, PTE_P | PTE_U | PTE_COW)) < 0)
+  80112b:	83 ec 0c             	sub    $0xc,%esp
+  80112e:	68 05 08 00 00       	push   $0x805
+  801133:	57                   	push   %edi
+  801134:	56                   	push   %esi
+  801135:	57                   	push   %edi
+  801136:	6a 00                	push   $0x0
+  801138:	e8 47 fb ff ff       	call   800c84 <sys_page_map>
+  80113d:	83 c4 20             	add    $0x20,%esp
+  801140:	85 c0                	test   %eax,%eax
+  801142:	0f 88 59 ff ff ff    	js     8010a1 <fork+0x92>
+        if ((r = sys_page_map(0, vptr, 0, vptr, PTE_P | PTE_U | PTE_COW)) < 0)
+  801148:	83 ec 0c             	sub    $0xc,%esp
+  80114b:	68 05 08 00 00       	push   $0x805
+  801150:	57                   	push   %edi
+  801151:	6a 00                	push   $0x0
+  801153:	57                   	push   %edi
+  801154:	6a 00                	push   $0x0
+  801156:	e8 29 fb ff ff       	call   800c84 <sys_page_map>
+  80115b:	83 c4 20             	add    $0x20,%esp
+  80115e:	85 c0                	test   %eax,%eax
+  801160:	0f 89 67 ff ff ff    	jns    8010cd <fork+0xbe>
+            panic("duppage :in sys_page_map %e", r);
+  801166:	50                   	push   %eax
+  801167:	68 8d 2e 80 00       	push   $0x802e8d
+  80116c:	6a 50                	push   $0x50
+  80116e:	68 3c 2e 80 00       	push   $0x802e3c
+  801173:	e8 cb 12 00 00       	call   802443 <_panic>
+        panic("duppage :in sys_page_map %e", r);
+  801178:	50                   	push   %eax
+  801179:	68 8d 2e 80 00       	push   $0x802e8d
+  80117e:	6a 53                	push   $0x53
+  801180:	68 3c 2e 80 00       	push   $0x802e3c
+  801185:	e8 b9 12 00 00       	call   802443 <_panic>
+            duppage(envid, PGNUM(addr));
+        }
+    }
+    if (sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W))
+  80118a:	83 ec 04             	sub    $0x4,%esp
+  80118d:	6a 07                	push   $0x7
+  80118f:	68 00 f0 bf ee       	push   $0xeebff000
+  801194:	56                   	push   %esi
+  801195:	e8 a7 fa ff ff       	call   800c41 <sys_page_alloc>
+  80119a:	83 c4 10             	add    $0x10,%esp
+  80119d:	85 c0                	test   %eax,%eax
+  80119f:	75 31                	jne    8011d2 <fork+0x1c3>
+        panic("fork: sys_page_alloc failed");
+    if (sys_env_set_pgfault_upcall(envid, _pgfault_upcall))
+  8011a1:	83 ec 08             	sub    $0x8,%esp
+  8011a4:	68 f4 24 80 00       	push   $0x8024f4
+  8011a9:	56                   	push   %esi
+  8011aa:	e8 dd fb ff ff       	call   800d8c <sys_env_set_pgfault_upcall>
+  8011af:	83 c4 10             	add    $0x10,%esp
+  8011b2:	85 c0                	test   %eax,%eax
+  8011b4:	75 30                	jne    8011e6 <fork+0x1d7>
+        panic("fork: sys_env_set_pgfault_upcall failed");
+    if (sys_env_set_status(envid, ENV_RUNNABLE))
+  8011b6:	83 ec 08             	sub    $0x8,%esp
+  8011b9:	6a 02                	push   $0x2
+  8011bb:	56                   	push   %esi
+  8011bc:	e8 47 fb ff ff       	call   800d08 <sys_env_set_status>
+  8011c1:	83 c4 10             	add    $0x10,%esp
+  8011c4:	85 c0                	test   %eax,%eax
+  8011c6:	75 32                	jne    8011fa <fork+0x1eb>
+        panic("fork: sys_env_set_status failed");
+
+    return envid;
+
+}
+  8011c8:	89 f0                	mov    %esi,%eax
+  8011ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011cd:	5b                   	pop    %ebx
+  8011ce:	5e                   	pop    %esi
+  8011cf:	5f                   	pop    %edi
+  8011d0:	5d                   	pop    %ebp
+  8011d1:	c3                   	ret
+        panic("fork: sys_page_alloc failed");
+  8011d2:	83 ec 04             	sub    $0x4,%esp
+  8011d5:	68 a9 2e 80 00       	push   $0x802ea9
+  8011da:	6a 7d                	push   $0x7d
+  8011dc:	68 3c 2e 80 00       	push   $0x802e3c
+  8011e1:	e8 5d 12 00 00       	call   802443 <_panic>
+        panic("fork: sys_env_set_pgfault_upcall failed");
+  8011e6:	83 ec 04             	sub    $0x4,%esp
+  8011e9:	68 f4 2d 80 00       	push   $0x802df4
+  8011ee:	6a 7f                	push   $0x7f
+  8011f0:	68 3c 2e 80 00       	push   $0x802e3c
+  8011f5:	e8 49 12 00 00       	call   802443 <_panic>
+        panic("fork: sys_env_set_status failed");
+  8011fa:	83 ec 04             	sub    $0x4,%esp
+  8011fd:	68 1c 2e 80 00       	push   $0x802e1c
+  801202:	68 81 00 00 00       	push   $0x81
+  801207:	68 3c 2e 80 00       	push   $0x802e3c
+  80120c:	e8 32 12 00 00       	call   802443 <_panic>
+
+00801211 <sfork>:
+
+// Challenge!
+int
+sfork(void) {
+  801211:	55                   	push   %ebp
+  801212:	89 e5                	mov    %esp,%ebp
+  801214:	83 ec 0c             	sub    $0xc,%esp
+    panic("sfork not implemented");
+  801217:	68 c5 2e 80 00       	push   $0x802ec5
+  80121c:	68 8a 00 00 00       	push   $0x8a
+  801221:	68 3c 2e 80 00       	push   $0x802e3c
+  801226:	e8 18 12 00 00       	call   802443 <_panic>
+
+0080122b <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  80122b:	55                   	push   %ebp
+  80122c:	89 e5                	mov    %esp,%ebp
+  80122e:	56                   	push   %esi
+  80122f:	53                   	push   %ebx
+  801230:	8b 75 08             	mov    0x8(%ebp),%esi
+  801233:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801236:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  801239:	85 c0                	test   %eax,%eax
+  80123b:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801240:	0f 44 c2             	cmove  %edx,%eax
+  801243:	83 ec 0c             	sub    $0xc,%esp
+  801246:	50                   	push   %eax
+  801247:	e8 a5 fb ff ff       	call   800df1 <sys_ipc_recv>
+
+  if (from_env_store)
+  80124c:	83 c4 10             	add    $0x10,%esp
+  80124f:	85 f6                	test   %esi,%esi
+  801251:	74 17                	je     80126a <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  801253:	ba 00 00 00 00       	mov    $0x0,%edx
+  801258:	85 c0                	test   %eax,%eax
+  80125a:	75 0c                	jne    801268 <ipc_recv+0x3d>
+  80125c:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  801262:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  801268:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  80126a:	85 db                	test   %ebx,%ebx
+  80126c:	74 2b                	je     801299 <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  80126e:	85 c0                	test   %eax,%eax
+  801270:	74 0d                	je     80127f <ipc_recv+0x54>
+  801272:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  801278:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80127b:	5b                   	pop    %ebx
+  80127c:	5e                   	pop    %esi
+  80127d:	5d                   	pop    %ebp
+  80127e:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  80127f:	a1 08 50 80 00       	mov    0x805008,%eax
+  801284:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80128a:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  80128c:	a1 08 50 80 00       	mov    0x805008,%eax
+  801291:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  801297:	eb df                	jmp    801278 <ipc_recv+0x4d>
+  801299:	85 c0                	test   %eax,%eax
+  80129b:	75 db                	jne    801278 <ipc_recv+0x4d>
+  80129d:	eb ed                	jmp    80128c <ipc_recv+0x61>
+
+0080129f <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  80129f:	55                   	push   %ebp
+  8012a0:	89 e5                	mov    %esp,%ebp
+  8012a2:	57                   	push   %edi
+  8012a3:	56                   	push   %esi
+  8012a4:	53                   	push   %ebx
+  8012a5:	83 ec 0c             	sub    $0xc,%esp
+  8012a8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8012ab:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8012ae:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  8012b1:	85 db                	test   %ebx,%ebx
+  8012b3:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8012b8:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  8012bb:	ff 75 14             	push   0x14(%ebp)
+  8012be:	53                   	push   %ebx
+  8012bf:	56                   	push   %esi
+  8012c0:	57                   	push   %edi
+  8012c1:	e8 08 fb ff ff       	call   800dce <sys_ipc_try_send>
+  8012c6:	83 c4 10             	add    $0x10,%esp
+  8012c9:	85 c0                	test   %eax,%eax
+  8012cb:	74 1e                	je     8012eb <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  8012cd:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8012d0:	75 07                	jne    8012d9 <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  8012d2:	e8 4b f9 ff ff       	call   800c22 <sys_yield>
+  8012d7:	eb e2                	jmp    8012bb <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  8012d9:	50                   	push   %eax
+  8012da:	68 db 2e 80 00       	push   $0x802edb
+  8012df:	6a 3c                	push   $0x3c
+  8012e1:	68 e8 2e 80 00       	push   $0x802ee8
+  8012e6:	e8 58 11 00 00       	call   802443 <_panic>
+  }
+
+#endif
+}
+  8012eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012ee:	5b                   	pop    %ebx
+  8012ef:	5e                   	pop    %esi
+  8012f0:	5f                   	pop    %edi
+  8012f1:	5d                   	pop    %ebp
+  8012f2:	c3                   	ret
+
+008012f3 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  8012f3:	55                   	push   %ebp
+  8012f4:	89 e5                	mov    %esp,%ebp
+  8012f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  8012f9:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  8012fe:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  801301:	c1 e0 04             	shl    $0x4,%eax
+  801304:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801309:	8b 40 50             	mov    0x50(%eax),%eax
+  80130c:	39 c8                	cmp    %ecx,%eax
+  80130e:	74 12                	je     801322 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  801310:	83 c2 01             	add    $0x1,%edx
+  801313:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  801319:	75 e3                	jne    8012fe <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  80131b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801320:	eb 0e                	jmp    801330 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  801322:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  801325:	c1 e0 04             	shl    $0x4,%eax
+  801328:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80132d:	8b 40 48             	mov    0x48(%eax),%eax
+  801330:	5d                   	pop    %ebp
+  801331:	c3                   	ret
+
+00801332 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801332:	55                   	push   %ebp
+  801333:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801335:	8b 45 08             	mov    0x8(%ebp),%eax
+  801338:	05 00 00 00 30       	add    $0x30000000,%eax
+  80133d:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801340:	5d                   	pop    %ebp
+  801341:	c3                   	ret
+
+00801342 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801342:	55                   	push   %ebp
+  801343:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801345:	8b 45 08             	mov    0x8(%ebp),%eax
+  801348:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80134d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801352:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801357:	5d                   	pop    %ebp
+  801358:	c3                   	ret
+
+00801359 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801359:	55                   	push   %ebp
+  80135a:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80135c:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801361:	eb 02                	jmp    801365 <fd_alloc+0xc>
+  801363:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801365:	89 c2                	mov    %eax,%edx
+  801367:	c1 ea 16             	shr    $0x16,%edx
+  80136a:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801371:	f6 c2 01             	test   $0x1,%dl
+  801374:	74 2b                	je     8013a1 <fd_alloc+0x48>
+  801376:	89 c2                	mov    %eax,%edx
+  801378:	c1 ea 0c             	shr    $0xc,%edx
+  80137b:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801382:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801388:	f6 c1 01             	test   $0x1,%cl
+  80138b:	74 14                	je     8013a1 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80138d:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801393:	75 ce                	jne    801363 <fd_alloc+0xa>
+  801395:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80139a:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80139f:	eb 05                	jmp    8013a6 <fd_alloc+0x4d>
+			return 0;
+  8013a1:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8013a6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013a9:	89 02                	mov    %eax,(%edx)
+}
+  8013ab:	89 c8                	mov    %ecx,%eax
+  8013ad:	5d                   	pop    %ebp
+  8013ae:	c3                   	ret
+
+008013af <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8013af:	55                   	push   %ebp
+  8013b0:	89 e5                	mov    %esp,%ebp
+  8013b2:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8013b5:	83 f8 1f             	cmp    $0x1f,%eax
+  8013b8:	77 30                	ja     8013ea <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8013ba:	c1 e0 0c             	shl    $0xc,%eax
+  8013bd:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8013c2:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8013c8:	f6 c2 01             	test   $0x1,%dl
+  8013cb:	74 24                	je     8013f1 <fd_lookup+0x42>
+  8013cd:	89 c2                	mov    %eax,%edx
+  8013cf:	c1 ea 0c             	shr    $0xc,%edx
+  8013d2:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8013d9:	f6 c2 01             	test   $0x1,%dl
+  8013dc:	74 1a                	je     8013f8 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8013de:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8013e1:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8013e3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013e8:	5d                   	pop    %ebp
+  8013e9:	c3                   	ret
+		return -E_INVAL;
+  8013ea:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013ef:	eb f7                	jmp    8013e8 <fd_lookup+0x39>
+		return -E_INVAL;
+  8013f1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013f6:	eb f0                	jmp    8013e8 <fd_lookup+0x39>
+  8013f8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013fd:	eb e9                	jmp    8013e8 <fd_lookup+0x39>
+
+008013ff <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8013ff:	55                   	push   %ebp
+  801400:	89 e5                	mov    %esp,%ebp
+  801402:	53                   	push   %ebx
+  801403:	83 ec 04             	sub    $0x4,%esp
+  801406:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801409:	b8 00 00 00 00       	mov    $0x0,%eax
+  80140e:	eb 03                	jmp    801413 <dev_lookup+0x14>
+  801410:	83 c0 01             	add    $0x1,%eax
+  801413:	8b 1c 85 70 2f 80 00 	mov    0x802f70(,%eax,4),%ebx
+  80141a:	85 db                	test   %ebx,%ebx
+  80141c:	74 0b                	je     801429 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  80141e:	39 13                	cmp    %edx,(%ebx)
+  801420:	75 ee                	jne    801410 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801422:	b8 00 00 00 00       	mov    $0x0,%eax
+  801427:	eb 1f                	jmp    801448 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801429:	a1 08 50 80 00       	mov    0x805008,%eax
+  80142e:	8b 40 48             	mov    0x48(%eax),%eax
+  801431:	83 ec 04             	sub    $0x4,%esp
+  801434:	52                   	push   %edx
+  801435:	50                   	push   %eax
+  801436:	68 f4 2e 80 00       	push   $0x802ef4
+  80143b:	e8 5c ee ff ff       	call   80029c <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801440:	83 c4 10             	add    $0x10,%esp
+  801443:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801448:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80144b:	89 1a                	mov    %ebx,(%edx)
+}
+  80144d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801450:	c9                   	leave
+  801451:	c3                   	ret
+
+00801452 <fd_close>:
+{
+  801452:	55                   	push   %ebp
+  801453:	89 e5                	mov    %esp,%ebp
+  801455:	57                   	push   %edi
+  801456:	56                   	push   %esi
+  801457:	53                   	push   %ebx
+  801458:	83 ec 24             	sub    $0x24,%esp
+  80145b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80145e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801461:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801464:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801465:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80146b:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80146e:	50                   	push   %eax
+  80146f:	e8 3b ff ff ff       	call   8013af <fd_lookup>
+  801474:	89 c3                	mov    %eax,%ebx
+  801476:	83 c4 10             	add    $0x10,%esp
+  801479:	85 c0                	test   %eax,%eax
+  80147b:	78 05                	js     801482 <fd_close+0x30>
+	    || fd != fd2)
+  80147d:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801480:	74 16                	je     801498 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801482:	89 f8                	mov    %edi,%eax
+  801484:	84 c0                	test   %al,%al
+  801486:	b8 00 00 00 00       	mov    $0x0,%eax
+  80148b:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80148e:	89 d8                	mov    %ebx,%eax
+  801490:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801493:	5b                   	pop    %ebx
+  801494:	5e                   	pop    %esi
+  801495:	5f                   	pop    %edi
+  801496:	5d                   	pop    %ebp
+  801497:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801498:	83 ec 08             	sub    $0x8,%esp
+  80149b:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80149e:	50                   	push   %eax
+  80149f:	ff 36                	push   (%esi)
+  8014a1:	e8 59 ff ff ff       	call   8013ff <dev_lookup>
+  8014a6:	89 c3                	mov    %eax,%ebx
+  8014a8:	83 c4 10             	add    $0x10,%esp
+  8014ab:	85 c0                	test   %eax,%eax
+  8014ad:	78 1a                	js     8014c9 <fd_close+0x77>
+		if (dev->dev_close)
+  8014af:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8014b2:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8014b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8014ba:	85 c0                	test   %eax,%eax
+  8014bc:	74 0b                	je     8014c9 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8014be:	83 ec 0c             	sub    $0xc,%esp
+  8014c1:	56                   	push   %esi
+  8014c2:	ff d0                	call   *%eax
+  8014c4:	89 c3                	mov    %eax,%ebx
+  8014c6:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8014c9:	83 ec 08             	sub    $0x8,%esp
+  8014cc:	56                   	push   %esi
+  8014cd:	6a 00                	push   $0x0
+  8014cf:	e8 f2 f7 ff ff       	call   800cc6 <sys_page_unmap>
+	return r;
+  8014d4:	83 c4 10             	add    $0x10,%esp
+  8014d7:	eb b5                	jmp    80148e <fd_close+0x3c>
+
+008014d9 <close>:
+
+int
+close(int fdnum)
+{
+  8014d9:	55                   	push   %ebp
+  8014da:	89 e5                	mov    %esp,%ebp
+  8014dc:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8014df:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014e2:	50                   	push   %eax
+  8014e3:	ff 75 08             	push   0x8(%ebp)
+  8014e6:	e8 c4 fe ff ff       	call   8013af <fd_lookup>
+  8014eb:	83 c4 10             	add    $0x10,%esp
+  8014ee:	85 c0                	test   %eax,%eax
+  8014f0:	79 02                	jns    8014f4 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8014f2:	c9                   	leave
+  8014f3:	c3                   	ret
+		return fd_close(fd, 1);
+  8014f4:	83 ec 08             	sub    $0x8,%esp
+  8014f7:	6a 01                	push   $0x1
+  8014f9:	ff 75 f4             	push   -0xc(%ebp)
+  8014fc:	e8 51 ff ff ff       	call   801452 <fd_close>
+  801501:	83 c4 10             	add    $0x10,%esp
+  801504:	eb ec                	jmp    8014f2 <close+0x19>
+
+00801506 <close_all>:
+
+void
+close_all(void)
+{
+  801506:	55                   	push   %ebp
+  801507:	89 e5                	mov    %esp,%ebp
+  801509:	53                   	push   %ebx
+  80150a:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80150d:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801512:	83 ec 0c             	sub    $0xc,%esp
+  801515:	53                   	push   %ebx
+  801516:	e8 be ff ff ff       	call   8014d9 <close>
+	for (i = 0; i < MAXFD; i++)
+  80151b:	83 c3 01             	add    $0x1,%ebx
+  80151e:	83 c4 10             	add    $0x10,%esp
+  801521:	83 fb 20             	cmp    $0x20,%ebx
+  801524:	75 ec                	jne    801512 <close_all+0xc>
+}
+  801526:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801529:	c9                   	leave
+  80152a:	c3                   	ret
+
+0080152b <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80152b:	55                   	push   %ebp
+  80152c:	89 e5                	mov    %esp,%ebp
+  80152e:	57                   	push   %edi
+  80152f:	56                   	push   %esi
+  801530:	53                   	push   %ebx
+  801531:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801534:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801537:	50                   	push   %eax
+  801538:	ff 75 08             	push   0x8(%ebp)
+  80153b:	e8 6f fe ff ff       	call   8013af <fd_lookup>
+  801540:	89 c3                	mov    %eax,%ebx
+  801542:	83 c4 10             	add    $0x10,%esp
+  801545:	85 c0                	test   %eax,%eax
+  801547:	78 7f                	js     8015c8 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801549:	83 ec 0c             	sub    $0xc,%esp
+  80154c:	ff 75 0c             	push   0xc(%ebp)
+  80154f:	e8 85 ff ff ff       	call   8014d9 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801554:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801557:	c1 e6 0c             	shl    $0xc,%esi
+  80155a:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801560:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801563:	89 3c 24             	mov    %edi,(%esp)
+  801566:	e8 d7 fd ff ff       	call   801342 <fd2data>
+  80156b:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80156d:	89 34 24             	mov    %esi,(%esp)
+  801570:	e8 cd fd ff ff       	call   801342 <fd2data>
+  801575:	83 c4 10             	add    $0x10,%esp
+  801578:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80157b:	89 d8                	mov    %ebx,%eax
+  80157d:	c1 e8 16             	shr    $0x16,%eax
+  801580:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801587:	a8 01                	test   $0x1,%al
+  801589:	74 11                	je     80159c <dup+0x71>
+  80158b:	89 d8                	mov    %ebx,%eax
+  80158d:	c1 e8 0c             	shr    $0xc,%eax
+  801590:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801597:	f6 c2 01             	test   $0x1,%dl
+  80159a:	75 36                	jne    8015d2 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80159c:	89 f8                	mov    %edi,%eax
+  80159e:	c1 e8 0c             	shr    $0xc,%eax
+  8015a1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8015a8:	83 ec 0c             	sub    $0xc,%esp
+  8015ab:	25 07 0e 00 00       	and    $0xe07,%eax
+  8015b0:	50                   	push   %eax
+  8015b1:	56                   	push   %esi
+  8015b2:	6a 00                	push   $0x0
+  8015b4:	57                   	push   %edi
+  8015b5:	6a 00                	push   $0x0
+  8015b7:	e8 c8 f6 ff ff       	call   800c84 <sys_page_map>
+  8015bc:	89 c3                	mov    %eax,%ebx
+  8015be:	83 c4 20             	add    $0x20,%esp
+  8015c1:	85 c0                	test   %eax,%eax
+  8015c3:	78 33                	js     8015f8 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8015c5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8015c8:	89 d8                	mov    %ebx,%eax
+  8015ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015cd:	5b                   	pop    %ebx
+  8015ce:	5e                   	pop    %esi
+  8015cf:	5f                   	pop    %edi
+  8015d0:	5d                   	pop    %ebp
+  8015d1:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8015d2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8015d9:	83 ec 0c             	sub    $0xc,%esp
+  8015dc:	25 07 0e 00 00       	and    $0xe07,%eax
+  8015e1:	50                   	push   %eax
+  8015e2:	ff 75 d4             	push   -0x2c(%ebp)
+  8015e5:	6a 00                	push   $0x0
+  8015e7:	53                   	push   %ebx
+  8015e8:	6a 00                	push   $0x0
+  8015ea:	e8 95 f6 ff ff       	call   800c84 <sys_page_map>
+  8015ef:	89 c3                	mov    %eax,%ebx
+  8015f1:	83 c4 20             	add    $0x20,%esp
+  8015f4:	85 c0                	test   %eax,%eax
+  8015f6:	79 a4                	jns    80159c <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8015f8:	83 ec 08             	sub    $0x8,%esp
+  8015fb:	56                   	push   %esi
+  8015fc:	6a 00                	push   $0x0
+  8015fe:	e8 c3 f6 ff ff       	call   800cc6 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801603:	83 c4 08             	add    $0x8,%esp
+  801606:	ff 75 d4             	push   -0x2c(%ebp)
+  801609:	6a 00                	push   $0x0
+  80160b:	e8 b6 f6 ff ff       	call   800cc6 <sys_page_unmap>
+	return r;
+  801610:	83 c4 10             	add    $0x10,%esp
+  801613:	eb b3                	jmp    8015c8 <dup+0x9d>
+
+00801615 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801615:	55                   	push   %ebp
+  801616:	89 e5                	mov    %esp,%ebp
+  801618:	56                   	push   %esi
+  801619:	53                   	push   %ebx
+  80161a:	83 ec 18             	sub    $0x18,%esp
+  80161d:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801620:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801623:	50                   	push   %eax
+  801624:	56                   	push   %esi
+  801625:	e8 85 fd ff ff       	call   8013af <fd_lookup>
+  80162a:	83 c4 10             	add    $0x10,%esp
+  80162d:	85 c0                	test   %eax,%eax
+  80162f:	78 3c                	js     80166d <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801631:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801634:	83 ec 08             	sub    $0x8,%esp
+  801637:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80163a:	50                   	push   %eax
+  80163b:	ff 33                	push   (%ebx)
+  80163d:	e8 bd fd ff ff       	call   8013ff <dev_lookup>
+  801642:	83 c4 10             	add    $0x10,%esp
+  801645:	85 c0                	test   %eax,%eax
+  801647:	78 24                	js     80166d <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801649:	8b 43 08             	mov    0x8(%ebx),%eax
+  80164c:	83 e0 03             	and    $0x3,%eax
+  80164f:	83 f8 01             	cmp    $0x1,%eax
+  801652:	74 20                	je     801674 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801654:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801657:	8b 40 08             	mov    0x8(%eax),%eax
+  80165a:	85 c0                	test   %eax,%eax
+  80165c:	74 37                	je     801695 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80165e:	83 ec 04             	sub    $0x4,%esp
+  801661:	ff 75 10             	push   0x10(%ebp)
+  801664:	ff 75 0c             	push   0xc(%ebp)
+  801667:	53                   	push   %ebx
+  801668:	ff d0                	call   *%eax
+  80166a:	83 c4 10             	add    $0x10,%esp
+}
+  80166d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801670:	5b                   	pop    %ebx
+  801671:	5e                   	pop    %esi
+  801672:	5d                   	pop    %ebp
+  801673:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801674:	a1 08 50 80 00       	mov    0x805008,%eax
+  801679:	8b 40 48             	mov    0x48(%eax),%eax
+  80167c:	83 ec 04             	sub    $0x4,%esp
+  80167f:	56                   	push   %esi
+  801680:	50                   	push   %eax
+  801681:	68 35 2f 80 00       	push   $0x802f35
+  801686:	e8 11 ec ff ff       	call   80029c <cprintf>
+		return -E_INVAL;
+  80168b:	83 c4 10             	add    $0x10,%esp
+  80168e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801693:	eb d8                	jmp    80166d <read+0x58>
+		return -E_NOT_SUPP;
+  801695:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80169a:	eb d1                	jmp    80166d <read+0x58>
+
+0080169c <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80169c:	55                   	push   %ebp
+  80169d:	89 e5                	mov    %esp,%ebp
+  80169f:	57                   	push   %edi
+  8016a0:	56                   	push   %esi
+  8016a1:	53                   	push   %ebx
+  8016a2:	83 ec 0c             	sub    $0xc,%esp
+  8016a5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8016a8:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8016ab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016b0:	eb 02                	jmp    8016b4 <readn+0x18>
+  8016b2:	01 c3                	add    %eax,%ebx
+  8016b4:	39 f3                	cmp    %esi,%ebx
+  8016b6:	73 21                	jae    8016d9 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8016b8:	83 ec 04             	sub    $0x4,%esp
+  8016bb:	89 f0                	mov    %esi,%eax
+  8016bd:	29 d8                	sub    %ebx,%eax
+  8016bf:	50                   	push   %eax
+  8016c0:	89 d8                	mov    %ebx,%eax
+  8016c2:	03 45 0c             	add    0xc(%ebp),%eax
+  8016c5:	50                   	push   %eax
+  8016c6:	57                   	push   %edi
+  8016c7:	e8 49 ff ff ff       	call   801615 <read>
+		if (m < 0)
+  8016cc:	83 c4 10             	add    $0x10,%esp
+  8016cf:	85 c0                	test   %eax,%eax
+  8016d1:	78 04                	js     8016d7 <readn+0x3b>
+			return m;
+		if (m == 0)
+  8016d3:	75 dd                	jne    8016b2 <readn+0x16>
+  8016d5:	eb 02                	jmp    8016d9 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8016d7:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8016d9:	89 d8                	mov    %ebx,%eax
+  8016db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016de:	5b                   	pop    %ebx
+  8016df:	5e                   	pop    %esi
+  8016e0:	5f                   	pop    %edi
+  8016e1:	5d                   	pop    %ebp
+  8016e2:	c3                   	ret
+
+008016e3 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8016e3:	55                   	push   %ebp
+  8016e4:	89 e5                	mov    %esp,%ebp
+  8016e6:	56                   	push   %esi
+  8016e7:	53                   	push   %ebx
+  8016e8:	83 ec 18             	sub    $0x18,%esp
+  8016eb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016ee:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016f1:	50                   	push   %eax
+  8016f2:	53                   	push   %ebx
+  8016f3:	e8 b7 fc ff ff       	call   8013af <fd_lookup>
+  8016f8:	83 c4 10             	add    $0x10,%esp
+  8016fb:	85 c0                	test   %eax,%eax
+  8016fd:	78 37                	js     801736 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016ff:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801702:	83 ec 08             	sub    $0x8,%esp
+  801705:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801708:	50                   	push   %eax
+  801709:	ff 36                	push   (%esi)
+  80170b:	e8 ef fc ff ff       	call   8013ff <dev_lookup>
+  801710:	83 c4 10             	add    $0x10,%esp
+  801713:	85 c0                	test   %eax,%eax
+  801715:	78 1f                	js     801736 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801717:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80171b:	74 20                	je     80173d <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80171d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801720:	8b 40 0c             	mov    0xc(%eax),%eax
+  801723:	85 c0                	test   %eax,%eax
+  801725:	74 37                	je     80175e <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801727:	83 ec 04             	sub    $0x4,%esp
+  80172a:	ff 75 10             	push   0x10(%ebp)
+  80172d:	ff 75 0c             	push   0xc(%ebp)
+  801730:	56                   	push   %esi
+  801731:	ff d0                	call   *%eax
+  801733:	83 c4 10             	add    $0x10,%esp
+}
+  801736:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801739:	5b                   	pop    %ebx
+  80173a:	5e                   	pop    %esi
+  80173b:	5d                   	pop    %ebp
+  80173c:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80173d:	a1 08 50 80 00       	mov    0x805008,%eax
+  801742:	8b 40 48             	mov    0x48(%eax),%eax
+  801745:	83 ec 04             	sub    $0x4,%esp
+  801748:	53                   	push   %ebx
+  801749:	50                   	push   %eax
+  80174a:	68 51 2f 80 00       	push   $0x802f51
+  80174f:	e8 48 eb ff ff       	call   80029c <cprintf>
+		return -E_INVAL;
+  801754:	83 c4 10             	add    $0x10,%esp
+  801757:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80175c:	eb d8                	jmp    801736 <write+0x53>
+		return -E_NOT_SUPP;
+  80175e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801763:	eb d1                	jmp    801736 <write+0x53>
+
+00801765 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801765:	55                   	push   %ebp
+  801766:	89 e5                	mov    %esp,%ebp
+  801768:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80176b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80176e:	50                   	push   %eax
+  80176f:	ff 75 08             	push   0x8(%ebp)
+  801772:	e8 38 fc ff ff       	call   8013af <fd_lookup>
+  801777:	83 c4 10             	add    $0x10,%esp
+  80177a:	85 c0                	test   %eax,%eax
+  80177c:	78 0e                	js     80178c <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80177e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801781:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801784:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801787:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80178c:	c9                   	leave
+  80178d:	c3                   	ret
+
+0080178e <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80178e:	55                   	push   %ebp
+  80178f:	89 e5                	mov    %esp,%ebp
+  801791:	56                   	push   %esi
+  801792:	53                   	push   %ebx
+  801793:	83 ec 18             	sub    $0x18,%esp
+  801796:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801799:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80179c:	50                   	push   %eax
+  80179d:	53                   	push   %ebx
+  80179e:	e8 0c fc ff ff       	call   8013af <fd_lookup>
+  8017a3:	83 c4 10             	add    $0x10,%esp
+  8017a6:	85 c0                	test   %eax,%eax
+  8017a8:	78 34                	js     8017de <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017aa:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8017ad:	83 ec 08             	sub    $0x8,%esp
+  8017b0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017b3:	50                   	push   %eax
+  8017b4:	ff 36                	push   (%esi)
+  8017b6:	e8 44 fc ff ff       	call   8013ff <dev_lookup>
+  8017bb:	83 c4 10             	add    $0x10,%esp
+  8017be:	85 c0                	test   %eax,%eax
+  8017c0:	78 1c                	js     8017de <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8017c2:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8017c6:	74 1d                	je     8017e5 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8017c8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017cb:	8b 40 18             	mov    0x18(%eax),%eax
+  8017ce:	85 c0                	test   %eax,%eax
+  8017d0:	74 34                	je     801806 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8017d2:	83 ec 08             	sub    $0x8,%esp
+  8017d5:	ff 75 0c             	push   0xc(%ebp)
+  8017d8:	56                   	push   %esi
+  8017d9:	ff d0                	call   *%eax
+  8017db:	83 c4 10             	add    $0x10,%esp
+}
+  8017de:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017e1:	5b                   	pop    %ebx
+  8017e2:	5e                   	pop    %esi
+  8017e3:	5d                   	pop    %ebp
+  8017e4:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8017e5:	a1 08 50 80 00       	mov    0x805008,%eax
+  8017ea:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8017ed:	83 ec 04             	sub    $0x4,%esp
+  8017f0:	53                   	push   %ebx
+  8017f1:	50                   	push   %eax
+  8017f2:	68 14 2f 80 00       	push   $0x802f14
+  8017f7:	e8 a0 ea ff ff       	call   80029c <cprintf>
+		return -E_INVAL;
+  8017fc:	83 c4 10             	add    $0x10,%esp
+  8017ff:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801804:	eb d8                	jmp    8017de <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801806:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80180b:	eb d1                	jmp    8017de <ftruncate+0x50>
+
+0080180d <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80180d:	55                   	push   %ebp
+  80180e:	89 e5                	mov    %esp,%ebp
+  801810:	56                   	push   %esi
+  801811:	53                   	push   %ebx
+  801812:	83 ec 18             	sub    $0x18,%esp
+  801815:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801818:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80181b:	50                   	push   %eax
+  80181c:	ff 75 08             	push   0x8(%ebp)
+  80181f:	e8 8b fb ff ff       	call   8013af <fd_lookup>
+  801824:	83 c4 10             	add    $0x10,%esp
+  801827:	85 c0                	test   %eax,%eax
+  801829:	78 49                	js     801874 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80182b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80182e:	83 ec 08             	sub    $0x8,%esp
+  801831:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801834:	50                   	push   %eax
+  801835:	ff 36                	push   (%esi)
+  801837:	e8 c3 fb ff ff       	call   8013ff <dev_lookup>
+  80183c:	83 c4 10             	add    $0x10,%esp
+  80183f:	85 c0                	test   %eax,%eax
+  801841:	78 31                	js     801874 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801843:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801846:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80184a:	74 2f                	je     80187b <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80184c:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80184f:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801856:	00 00 00 
+	stat->st_isdir = 0;
+  801859:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801860:	00 00 00 
+	stat->st_dev = dev;
+  801863:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801869:	83 ec 08             	sub    $0x8,%esp
+  80186c:	53                   	push   %ebx
+  80186d:	56                   	push   %esi
+  80186e:	ff 50 14             	call   *0x14(%eax)
+  801871:	83 c4 10             	add    $0x10,%esp
+}
+  801874:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801877:	5b                   	pop    %ebx
+  801878:	5e                   	pop    %esi
+  801879:	5d                   	pop    %ebp
+  80187a:	c3                   	ret
+		return -E_NOT_SUPP;
+  80187b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801880:	eb f2                	jmp    801874 <fstat+0x67>
+
+00801882 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801882:	55                   	push   %ebp
+  801883:	89 e5                	mov    %esp,%ebp
+  801885:	56                   	push   %esi
+  801886:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801887:	83 ec 08             	sub    $0x8,%esp
+  80188a:	6a 00                	push   $0x0
+  80188c:	ff 75 08             	push   0x8(%ebp)
+  80188f:	e8 e4 01 00 00       	call   801a78 <open>
+  801894:	89 c3                	mov    %eax,%ebx
+  801896:	83 c4 10             	add    $0x10,%esp
+  801899:	85 c0                	test   %eax,%eax
+  80189b:	78 1b                	js     8018b8 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80189d:	83 ec 08             	sub    $0x8,%esp
+  8018a0:	ff 75 0c             	push   0xc(%ebp)
+  8018a3:	50                   	push   %eax
+  8018a4:	e8 64 ff ff ff       	call   80180d <fstat>
+  8018a9:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8018ab:	89 1c 24             	mov    %ebx,(%esp)
+  8018ae:	e8 26 fc ff ff       	call   8014d9 <close>
+	return r;
+  8018b3:	83 c4 10             	add    $0x10,%esp
+  8018b6:	89 f3                	mov    %esi,%ebx
+}
+  8018b8:	89 d8                	mov    %ebx,%eax
+  8018ba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018bd:	5b                   	pop    %ebx
+  8018be:	5e                   	pop    %esi
+  8018bf:	5d                   	pop    %ebp
+  8018c0:	c3                   	ret
+
+008018c1 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  8018c1:	55                   	push   %ebp
+  8018c2:	89 e5                	mov    %esp,%ebp
+  8018c4:	56                   	push   %esi
+  8018c5:	53                   	push   %ebx
+  8018c6:	89 c6                	mov    %eax,%esi
+  8018c8:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  8018ca:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  8018d1:	74 27                	je     8018fa <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8018d3:	6a 07                	push   $0x7
+  8018d5:	68 00 60 80 00       	push   $0x806000
+  8018da:	56                   	push   %esi
+  8018db:	ff 35 00 50 80 00    	push   0x805000
+  8018e1:	e8 b9 f9 ff ff       	call   80129f <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  8018e6:	83 c4 0c             	add    $0xc,%esp
+  8018e9:	6a 00                	push   $0x0
+  8018eb:	53                   	push   %ebx
+  8018ec:	6a 00                	push   $0x0
+  8018ee:	e8 38 f9 ff ff       	call   80122b <ipc_recv>
+}
+  8018f3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018f6:	5b                   	pop    %ebx
+  8018f7:	5e                   	pop    %esi
+  8018f8:	5d                   	pop    %ebp
+  8018f9:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  8018fa:	83 ec 0c             	sub    $0xc,%esp
+  8018fd:	6a 01                	push   $0x1
+  8018ff:	e8 ef f9 ff ff       	call   8012f3 <ipc_find_env>
+  801904:	a3 00 50 80 00       	mov    %eax,0x805000
+  801909:	83 c4 10             	add    $0x10,%esp
+  80190c:	eb c5                	jmp    8018d3 <fsipc+0x12>
+
+0080190e <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80190e:	55                   	push   %ebp
+  80190f:	89 e5                	mov    %esp,%ebp
+  801911:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801914:	8b 45 08             	mov    0x8(%ebp),%eax
+  801917:	8b 40 0c             	mov    0xc(%eax),%eax
+  80191a:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.set_size.req_size = newsize;
+  80191f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801922:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801927:	ba 00 00 00 00       	mov    $0x0,%edx
+  80192c:	b8 02 00 00 00       	mov    $0x2,%eax
+  801931:	e8 8b ff ff ff       	call   8018c1 <fsipc>
+}
+  801936:	c9                   	leave
+  801937:	c3                   	ret
+
+00801938 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801938:	55                   	push   %ebp
+  801939:	89 e5                	mov    %esp,%ebp
+  80193b:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80193e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801941:	8b 40 0c             	mov    0xc(%eax),%eax
+  801944:	a3 00 60 80 00       	mov    %eax,0x806000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801949:	ba 00 00 00 00       	mov    $0x0,%edx
+  80194e:	b8 06 00 00 00       	mov    $0x6,%eax
+  801953:	e8 69 ff ff ff       	call   8018c1 <fsipc>
+}
+  801958:	c9                   	leave
+  801959:	c3                   	ret
+
+0080195a <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80195a:	55                   	push   %ebp
+  80195b:	89 e5                	mov    %esp,%ebp
+  80195d:	53                   	push   %ebx
+  80195e:	83 ec 04             	sub    $0x4,%esp
+  801961:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801964:	8b 45 08             	mov    0x8(%ebp),%eax
+  801967:	8b 40 0c             	mov    0xc(%eax),%eax
+  80196a:	a3 00 60 80 00       	mov    %eax,0x806000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80196f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801974:	b8 05 00 00 00       	mov    $0x5,%eax
+  801979:	e8 43 ff ff ff       	call   8018c1 <fsipc>
+  80197e:	85 c0                	test   %eax,%eax
+  801980:	78 2c                	js     8019ae <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801982:	83 ec 08             	sub    $0x8,%esp
+  801985:	68 00 60 80 00       	push   $0x806000
+  80198a:	53                   	push   %ebx
+  80198b:	e8 c5 ee ff ff       	call   800855 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801990:	a1 80 60 80 00       	mov    0x806080,%eax
+  801995:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80199b:	a1 84 60 80 00       	mov    0x806084,%eax
+  8019a0:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  8019a6:	83 c4 10             	add    $0x10,%esp
+  8019a9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019b1:	c9                   	leave
+  8019b2:	c3                   	ret
+
+008019b3 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8019b3:	55                   	push   %ebp
+  8019b4:	89 e5                	mov    %esp,%ebp
+  8019b6:	83 ec 0c             	sub    $0xc,%esp
+  8019b9:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8019bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019bf:	8b 52 0c             	mov    0xc(%edx),%edx
+  8019c2:	89 15 00 60 80 00    	mov    %edx,0x806000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8019c8:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8019cd:	39 d0                	cmp    %edx,%eax
+  8019cf:	0f 47 c2             	cmova  %edx,%eax
+  8019d2:	a3 04 60 80 00       	mov    %eax,0x806004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  8019d7:	50                   	push   %eax
+  8019d8:	ff 75 0c             	push   0xc(%ebp)
+  8019db:	68 08 60 80 00       	push   $0x806008
+  8019e0:	e8 f6 ef ff ff       	call   8009db <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  8019e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019ea:	b8 04 00 00 00       	mov    $0x4,%eax
+  8019ef:	e8 cd fe ff ff       	call   8018c1 <fsipc>
+}
+  8019f4:	c9                   	leave
+  8019f5:	c3                   	ret
+
+008019f6 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8019f6:	55                   	push   %ebp
+  8019f7:	89 e5                	mov    %esp,%ebp
+  8019f9:	56                   	push   %esi
+  8019fa:	53                   	push   %ebx
+  8019fb:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8019fe:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a01:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a04:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read.req_n = n;
+  801a09:	89 35 04 60 80 00    	mov    %esi,0x806004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801a0f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a14:	b8 03 00 00 00       	mov    $0x3,%eax
+  801a19:	e8 a3 fe ff ff       	call   8018c1 <fsipc>
+  801a1e:	89 c3                	mov    %eax,%ebx
+  801a20:	85 c0                	test   %eax,%eax
+  801a22:	78 1f                	js     801a43 <devfile_read+0x4d>
+  assert(r <= n);
+  801a24:	39 c6                	cmp    %eax,%esi
+  801a26:	72 24                	jb     801a4c <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  801a28:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801a2d:	7f 33                	jg     801a62 <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801a2f:	83 ec 04             	sub    $0x4,%esp
+  801a32:	50                   	push   %eax
+  801a33:	68 00 60 80 00       	push   $0x806000
+  801a38:	ff 75 0c             	push   0xc(%ebp)
+  801a3b:	e8 9b ef ff ff       	call   8009db <memmove>
+  return r;
+  801a40:	83 c4 10             	add    $0x10,%esp
+}
+  801a43:	89 d8                	mov    %ebx,%eax
+  801a45:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a48:	5b                   	pop    %ebx
+  801a49:	5e                   	pop    %esi
+  801a4a:	5d                   	pop    %ebp
+  801a4b:	c3                   	ret
+  assert(r <= n);
+  801a4c:	68 84 2f 80 00       	push   $0x802f84
+  801a51:	68 8b 2f 80 00       	push   $0x802f8b
+  801a56:	6a 78                	push   $0x78
+  801a58:	68 a0 2f 80 00       	push   $0x802fa0
+  801a5d:	e8 e1 09 00 00       	call   802443 <_panic>
+  assert(r <= PGSIZE);
+  801a62:	68 ab 2f 80 00       	push   $0x802fab
+  801a67:	68 8b 2f 80 00       	push   $0x802f8b
+  801a6c:	6a 79                	push   $0x79
+  801a6e:	68 a0 2f 80 00       	push   $0x802fa0
+  801a73:	e8 cb 09 00 00       	call   802443 <_panic>
+
+00801a78 <open>:
+open(const char *path, int mode) {
+  801a78:	55                   	push   %ebp
+  801a79:	89 e5                	mov    %esp,%ebp
+  801a7b:	56                   	push   %esi
+  801a7c:	53                   	push   %ebx
+  801a7d:	83 ec 1c             	sub    $0x1c,%esp
+  801a80:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801a83:	56                   	push   %esi
+  801a84:	e8 91 ed ff ff       	call   80081a <strlen>
+  801a89:	83 c4 10             	add    $0x10,%esp
+  801a8c:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801a91:	7f 6c                	jg     801aff <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801a93:	83 ec 0c             	sub    $0xc,%esp
+  801a96:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a99:	50                   	push   %eax
+  801a9a:	e8 ba f8 ff ff       	call   801359 <fd_alloc>
+  801a9f:	89 c3                	mov    %eax,%ebx
+  801aa1:	83 c4 10             	add    $0x10,%esp
+  801aa4:	85 c0                	test   %eax,%eax
+  801aa6:	78 3c                	js     801ae4 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801aa8:	83 ec 08             	sub    $0x8,%esp
+  801aab:	56                   	push   %esi
+  801aac:	68 00 60 80 00       	push   $0x806000
+  801ab1:	e8 9f ed ff ff       	call   800855 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801ab6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ab9:	a3 00 64 80 00       	mov    %eax,0x806400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801abe:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801ac1:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ac6:	e8 f6 fd ff ff       	call   8018c1 <fsipc>
+  801acb:	89 c3                	mov    %eax,%ebx
+  801acd:	83 c4 10             	add    $0x10,%esp
+  801ad0:	85 c0                	test   %eax,%eax
+  801ad2:	78 19                	js     801aed <open+0x75>
+  return fd2num(fd);
+  801ad4:	83 ec 0c             	sub    $0xc,%esp
+  801ad7:	ff 75 f4             	push   -0xc(%ebp)
+  801ada:	e8 53 f8 ff ff       	call   801332 <fd2num>
+  801adf:	89 c3                	mov    %eax,%ebx
+  801ae1:	83 c4 10             	add    $0x10,%esp
+}
+  801ae4:	89 d8                	mov    %ebx,%eax
+  801ae6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ae9:	5b                   	pop    %ebx
+  801aea:	5e                   	pop    %esi
+  801aeb:	5d                   	pop    %ebp
+  801aec:	c3                   	ret
+    fd_close(fd, 0);
+  801aed:	83 ec 08             	sub    $0x8,%esp
+  801af0:	6a 00                	push   $0x0
+  801af2:	ff 75 f4             	push   -0xc(%ebp)
+  801af5:	e8 58 f9 ff ff       	call   801452 <fd_close>
+    return r;
+  801afa:	83 c4 10             	add    $0x10,%esp
+  801afd:	eb e5                	jmp    801ae4 <open+0x6c>
+    return -E_BAD_PATH;
+  801aff:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801b04:	eb de                	jmp    801ae4 <open+0x6c>
+
+00801b06 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  801b06:	55                   	push   %ebp
+  801b07:	89 e5                	mov    %esp,%ebp
+  801b09:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801b0c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b11:	b8 08 00 00 00       	mov    $0x8,%eax
+  801b16:	e8 a6 fd ff ff       	call   8018c1 <fsipc>
+}
+  801b1b:	c9                   	leave
+  801b1c:	c3                   	ret
+
+00801b1d <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801b1d:	55                   	push   %ebp
+  801b1e:	89 e5                	mov    %esp,%ebp
+  801b20:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801b23:	68 b7 2f 80 00       	push   $0x802fb7
+  801b28:	ff 75 0c             	push   0xc(%ebp)
+  801b2b:	e8 25 ed ff ff       	call   800855 <strcpy>
+	return 0;
+}
+  801b30:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b35:	c9                   	leave
+  801b36:	c3                   	ret
+
+00801b37 <devsock_close>:
+{
+  801b37:	55                   	push   %ebp
+  801b38:	89 e5                	mov    %esp,%ebp
+  801b3a:	53                   	push   %ebx
+  801b3b:	83 ec 10             	sub    $0x10,%esp
+  801b3e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801b41:	53                   	push   %ebx
+  801b42:	e8 d1 09 00 00       	call   802518 <pageref>
+  801b47:	89 c2                	mov    %eax,%edx
+  801b49:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801b4c:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801b51:	83 fa 01             	cmp    $0x1,%edx
+  801b54:	74 05                	je     801b5b <devsock_close+0x24>
+}
+  801b56:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b59:	c9                   	leave
+  801b5a:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801b5b:	83 ec 0c             	sub    $0xc,%esp
+  801b5e:	ff 73 0c             	push   0xc(%ebx)
+  801b61:	e8 b7 02 00 00       	call   801e1d <nsipc_close>
+  801b66:	83 c4 10             	add    $0x10,%esp
+  801b69:	eb eb                	jmp    801b56 <devsock_close+0x1f>
+
+00801b6b <devsock_write>:
+{
+  801b6b:	55                   	push   %ebp
+  801b6c:	89 e5                	mov    %esp,%ebp
+  801b6e:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801b71:	6a 00                	push   $0x0
+  801b73:	ff 75 10             	push   0x10(%ebp)
+  801b76:	ff 75 0c             	push   0xc(%ebp)
+  801b79:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b7c:	ff 70 0c             	push   0xc(%eax)
+  801b7f:	e8 79 03 00 00       	call   801efd <nsipc_send>
+}
+  801b84:	c9                   	leave
+  801b85:	c3                   	ret
+
+00801b86 <devsock_read>:
+{
+  801b86:	55                   	push   %ebp
+  801b87:	89 e5                	mov    %esp,%ebp
+  801b89:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801b8c:	6a 00                	push   $0x0
+  801b8e:	ff 75 10             	push   0x10(%ebp)
+  801b91:	ff 75 0c             	push   0xc(%ebp)
+  801b94:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b97:	ff 70 0c             	push   0xc(%eax)
+  801b9a:	e8 ef 02 00 00       	call   801e8e <nsipc_recv>
+}
+  801b9f:	c9                   	leave
+  801ba0:	c3                   	ret
+
+00801ba1 <fd2sockid>:
+{
+  801ba1:	55                   	push   %ebp
+  801ba2:	89 e5                	mov    %esp,%ebp
+  801ba4:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801ba7:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801baa:	52                   	push   %edx
+  801bab:	50                   	push   %eax
+  801bac:	e8 fe f7 ff ff       	call   8013af <fd_lookup>
+  801bb1:	83 c4 10             	add    $0x10,%esp
+  801bb4:	85 c0                	test   %eax,%eax
+  801bb6:	78 10                	js     801bc8 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801bb8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bbb:	8b 0d 28 40 80 00    	mov    0x804028,%ecx
+  801bc1:	39 08                	cmp    %ecx,(%eax)
+  801bc3:	75 05                	jne    801bca <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801bc5:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801bc8:	c9                   	leave
+  801bc9:	c3                   	ret
+		return -E_NOT_SUPP;
+  801bca:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801bcf:	eb f7                	jmp    801bc8 <fd2sockid+0x27>
+
+00801bd1 <alloc_sockfd>:
+{
+  801bd1:	55                   	push   %ebp
+  801bd2:	89 e5                	mov    %esp,%ebp
+  801bd4:	56                   	push   %esi
+  801bd5:	53                   	push   %ebx
+  801bd6:	83 ec 1c             	sub    $0x1c,%esp
+  801bd9:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801bdb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bde:	50                   	push   %eax
+  801bdf:	e8 75 f7 ff ff       	call   801359 <fd_alloc>
+  801be4:	89 c3                	mov    %eax,%ebx
+  801be6:	83 c4 10             	add    $0x10,%esp
+  801be9:	85 c0                	test   %eax,%eax
+  801beb:	78 43                	js     801c30 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801bed:	83 ec 04             	sub    $0x4,%esp
+  801bf0:	68 07 04 00 00       	push   $0x407
+  801bf5:	ff 75 f4             	push   -0xc(%ebp)
+  801bf8:	6a 00                	push   $0x0
+  801bfa:	e8 42 f0 ff ff       	call   800c41 <sys_page_alloc>
+  801bff:	89 c3                	mov    %eax,%ebx
+  801c01:	83 c4 10             	add    $0x10,%esp
+  801c04:	85 c0                	test   %eax,%eax
+  801c06:	78 28                	js     801c30 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801c08:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c0b:	8b 15 28 40 80 00    	mov    0x804028,%edx
+  801c11:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801c13:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c16:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801c1d:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801c20:	83 ec 0c             	sub    $0xc,%esp
+  801c23:	50                   	push   %eax
+  801c24:	e8 09 f7 ff ff       	call   801332 <fd2num>
+  801c29:	89 c3                	mov    %eax,%ebx
+  801c2b:	83 c4 10             	add    $0x10,%esp
+  801c2e:	eb 0c                	jmp    801c3c <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801c30:	83 ec 0c             	sub    $0xc,%esp
+  801c33:	56                   	push   %esi
+  801c34:	e8 e4 01 00 00       	call   801e1d <nsipc_close>
+		return r;
+  801c39:	83 c4 10             	add    $0x10,%esp
+}
+  801c3c:	89 d8                	mov    %ebx,%eax
+  801c3e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c41:	5b                   	pop    %ebx
+  801c42:	5e                   	pop    %esi
+  801c43:	5d                   	pop    %ebp
+  801c44:	c3                   	ret
+
+00801c45 <accept>:
+{
+  801c45:	55                   	push   %ebp
+  801c46:	89 e5                	mov    %esp,%ebp
+  801c48:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801c4b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c4e:	e8 4e ff ff ff       	call   801ba1 <fd2sockid>
+  801c53:	85 c0                	test   %eax,%eax
+  801c55:	78 1b                	js     801c72 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801c57:	83 ec 04             	sub    $0x4,%esp
+  801c5a:	ff 75 10             	push   0x10(%ebp)
+  801c5d:	ff 75 0c             	push   0xc(%ebp)
+  801c60:	50                   	push   %eax
+  801c61:	e8 0e 01 00 00       	call   801d74 <nsipc_accept>
+  801c66:	83 c4 10             	add    $0x10,%esp
+  801c69:	85 c0                	test   %eax,%eax
+  801c6b:	78 05                	js     801c72 <accept+0x2d>
+	return alloc_sockfd(r);
+  801c6d:	e8 5f ff ff ff       	call   801bd1 <alloc_sockfd>
+}
+  801c72:	c9                   	leave
+  801c73:	c3                   	ret
+
+00801c74 <bind>:
+{
+  801c74:	55                   	push   %ebp
+  801c75:	89 e5                	mov    %esp,%ebp
+  801c77:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801c7a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c7d:	e8 1f ff ff ff       	call   801ba1 <fd2sockid>
+  801c82:	85 c0                	test   %eax,%eax
+  801c84:	78 12                	js     801c98 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801c86:	83 ec 04             	sub    $0x4,%esp
+  801c89:	ff 75 10             	push   0x10(%ebp)
+  801c8c:	ff 75 0c             	push   0xc(%ebp)
+  801c8f:	50                   	push   %eax
+  801c90:	e8 31 01 00 00       	call   801dc6 <nsipc_bind>
+  801c95:	83 c4 10             	add    $0x10,%esp
+}
+  801c98:	c9                   	leave
+  801c99:	c3                   	ret
+
+00801c9a <shutdown>:
+{
+  801c9a:	55                   	push   %ebp
+  801c9b:	89 e5                	mov    %esp,%ebp
+  801c9d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801ca0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ca3:	e8 f9 fe ff ff       	call   801ba1 <fd2sockid>
+  801ca8:	85 c0                	test   %eax,%eax
+  801caa:	78 0f                	js     801cbb <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801cac:	83 ec 08             	sub    $0x8,%esp
+  801caf:	ff 75 0c             	push   0xc(%ebp)
+  801cb2:	50                   	push   %eax
+  801cb3:	e8 43 01 00 00       	call   801dfb <nsipc_shutdown>
+  801cb8:	83 c4 10             	add    $0x10,%esp
+}
+  801cbb:	c9                   	leave
+  801cbc:	c3                   	ret
+
+00801cbd <connect>:
+{
+  801cbd:	55                   	push   %ebp
+  801cbe:	89 e5                	mov    %esp,%ebp
+  801cc0:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801cc3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cc6:	e8 d6 fe ff ff       	call   801ba1 <fd2sockid>
+  801ccb:	85 c0                	test   %eax,%eax
+  801ccd:	78 12                	js     801ce1 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801ccf:	83 ec 04             	sub    $0x4,%esp
+  801cd2:	ff 75 10             	push   0x10(%ebp)
+  801cd5:	ff 75 0c             	push   0xc(%ebp)
+  801cd8:	50                   	push   %eax
+  801cd9:	e8 59 01 00 00       	call   801e37 <nsipc_connect>
+  801cde:	83 c4 10             	add    $0x10,%esp
+}
+  801ce1:	c9                   	leave
+  801ce2:	c3                   	ret
+
+00801ce3 <listen>:
+{
+  801ce3:	55                   	push   %ebp
+  801ce4:	89 e5                	mov    %esp,%ebp
+  801ce6:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801ce9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cec:	e8 b0 fe ff ff       	call   801ba1 <fd2sockid>
+  801cf1:	85 c0                	test   %eax,%eax
+  801cf3:	78 0f                	js     801d04 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801cf5:	83 ec 08             	sub    $0x8,%esp
+  801cf8:	ff 75 0c             	push   0xc(%ebp)
+  801cfb:	50                   	push   %eax
+  801cfc:	e8 6b 01 00 00       	call   801e6c <nsipc_listen>
+  801d01:	83 c4 10             	add    $0x10,%esp
+}
+  801d04:	c9                   	leave
+  801d05:	c3                   	ret
+
+00801d06 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801d06:	55                   	push   %ebp
+  801d07:	89 e5                	mov    %esp,%ebp
+  801d09:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801d0c:	ff 75 10             	push   0x10(%ebp)
+  801d0f:	ff 75 0c             	push   0xc(%ebp)
+  801d12:	ff 75 08             	push   0x8(%ebp)
+  801d15:	e8 41 02 00 00       	call   801f5b <nsipc_socket>
+  801d1a:	83 c4 10             	add    $0x10,%esp
+  801d1d:	85 c0                	test   %eax,%eax
+  801d1f:	78 05                	js     801d26 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801d21:	e8 ab fe ff ff       	call   801bd1 <alloc_sockfd>
+}
+  801d26:	c9                   	leave
+  801d27:	c3                   	ret
+
+00801d28 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801d28:	55                   	push   %ebp
+  801d29:	89 e5                	mov    %esp,%ebp
+  801d2b:	53                   	push   %ebx
+  801d2c:	83 ec 04             	sub    $0x4,%esp
+  801d2f:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801d31:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  801d38:	74 26                	je     801d60 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801d3a:	6a 07                	push   $0x7
+  801d3c:	68 00 70 80 00       	push   $0x807000
+  801d41:	53                   	push   %ebx
+  801d42:	ff 35 04 50 80 00    	push   0x805004
+  801d48:	e8 52 f5 ff ff       	call   80129f <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801d4d:	83 c4 0c             	add    $0xc,%esp
+  801d50:	6a 00                	push   $0x0
+  801d52:	6a 00                	push   $0x0
+  801d54:	6a 00                	push   $0x0
+  801d56:	e8 d0 f4 ff ff       	call   80122b <ipc_recv>
+}
+  801d5b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d5e:	c9                   	leave
+  801d5f:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801d60:	83 ec 0c             	sub    $0xc,%esp
+  801d63:	6a 02                	push   $0x2
+  801d65:	e8 89 f5 ff ff       	call   8012f3 <ipc_find_env>
+  801d6a:	a3 04 50 80 00       	mov    %eax,0x805004
+  801d6f:	83 c4 10             	add    $0x10,%esp
+  801d72:	eb c6                	jmp    801d3a <nsipc+0x12>
+
+00801d74 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801d74:	55                   	push   %ebp
+  801d75:	89 e5                	mov    %esp,%ebp
+  801d77:	56                   	push   %esi
+  801d78:	53                   	push   %ebx
+  801d79:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801d7c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d7f:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801d84:	8b 06                	mov    (%esi),%eax
+  801d86:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801d8b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d90:	e8 93 ff ff ff       	call   801d28 <nsipc>
+  801d95:	89 c3                	mov    %eax,%ebx
+  801d97:	85 c0                	test   %eax,%eax
+  801d99:	79 09                	jns    801da4 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801d9b:	89 d8                	mov    %ebx,%eax
+  801d9d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801da0:	5b                   	pop    %ebx
+  801da1:	5e                   	pop    %esi
+  801da2:	5d                   	pop    %ebp
+  801da3:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801da4:	83 ec 04             	sub    $0x4,%esp
+  801da7:	ff 35 10 70 80 00    	push   0x807010
+  801dad:	68 00 70 80 00       	push   $0x807000
+  801db2:	ff 75 0c             	push   0xc(%ebp)
+  801db5:	e8 21 ec ff ff       	call   8009db <memmove>
+		*addrlen = ret->ret_addrlen;
+  801dba:	a1 10 70 80 00       	mov    0x807010,%eax
+  801dbf:	89 06                	mov    %eax,(%esi)
+  801dc1:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801dc4:	eb d5                	jmp    801d9b <nsipc_accept+0x27>
+
+00801dc6 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801dc6:	55                   	push   %ebp
+  801dc7:	89 e5                	mov    %esp,%ebp
+  801dc9:	53                   	push   %ebx
+  801dca:	83 ec 08             	sub    $0x8,%esp
+  801dcd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801dd0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dd3:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801dd8:	53                   	push   %ebx
+  801dd9:	ff 75 0c             	push   0xc(%ebp)
+  801ddc:	68 04 70 80 00       	push   $0x807004
+  801de1:	e8 f5 eb ff ff       	call   8009db <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801de6:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  801dec:	b8 02 00 00 00       	mov    $0x2,%eax
+  801df1:	e8 32 ff ff ff       	call   801d28 <nsipc>
+}
+  801df6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801df9:	c9                   	leave
+  801dfa:	c3                   	ret
+
+00801dfb <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801dfb:	55                   	push   %ebp
+  801dfc:	89 e5                	mov    %esp,%ebp
+  801dfe:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801e01:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e04:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  801e09:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e0c:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  801e11:	b8 03 00 00 00       	mov    $0x3,%eax
+  801e16:	e8 0d ff ff ff       	call   801d28 <nsipc>
+}
+  801e1b:	c9                   	leave
+  801e1c:	c3                   	ret
+
+00801e1d <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801e1d:	55                   	push   %ebp
+  801e1e:	89 e5                	mov    %esp,%ebp
+  801e20:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801e23:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e26:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  801e2b:	b8 04 00 00 00       	mov    $0x4,%eax
+  801e30:	e8 f3 fe ff ff       	call   801d28 <nsipc>
+}
+  801e35:	c9                   	leave
+  801e36:	c3                   	ret
+
+00801e37 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801e37:	55                   	push   %ebp
+  801e38:	89 e5                	mov    %esp,%ebp
+  801e3a:	53                   	push   %ebx
+  801e3b:	83 ec 08             	sub    $0x8,%esp
+  801e3e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801e41:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e44:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801e49:	53                   	push   %ebx
+  801e4a:	ff 75 0c             	push   0xc(%ebp)
+  801e4d:	68 04 70 80 00       	push   $0x807004
+  801e52:	e8 84 eb ff ff       	call   8009db <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801e57:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  801e5d:	b8 05 00 00 00       	mov    $0x5,%eax
+  801e62:	e8 c1 fe ff ff       	call   801d28 <nsipc>
+}
+  801e67:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e6a:	c9                   	leave
+  801e6b:	c3                   	ret
+
+00801e6c <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801e6c:	55                   	push   %ebp
+  801e6d:	89 e5                	mov    %esp,%ebp
+  801e6f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801e72:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e75:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  801e7a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e7d:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  801e82:	b8 06 00 00 00       	mov    $0x6,%eax
+  801e87:	e8 9c fe ff ff       	call   801d28 <nsipc>
+}
+  801e8c:	c9                   	leave
+  801e8d:	c3                   	ret
+
+00801e8e <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801e8e:	55                   	push   %ebp
+  801e8f:	89 e5                	mov    %esp,%ebp
+  801e91:	56                   	push   %esi
+  801e92:	53                   	push   %ebx
+  801e93:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801e96:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e99:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  801e9e:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  801ea4:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ea7:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801eac:	b8 07 00 00 00       	mov    $0x7,%eax
+  801eb1:	e8 72 fe ff ff       	call   801d28 <nsipc>
+  801eb6:	89 c3                	mov    %eax,%ebx
+  801eb8:	85 c0                	test   %eax,%eax
+  801eba:	78 22                	js     801ede <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801ebc:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801ec1:	39 c6                	cmp    %eax,%esi
+  801ec3:	0f 4e c6             	cmovle %esi,%eax
+  801ec6:	39 c3                	cmp    %eax,%ebx
+  801ec8:	7f 1d                	jg     801ee7 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801eca:	83 ec 04             	sub    $0x4,%esp
+  801ecd:	53                   	push   %ebx
+  801ece:	68 00 70 80 00       	push   $0x807000
+  801ed3:	ff 75 0c             	push   0xc(%ebp)
+  801ed6:	e8 00 eb ff ff       	call   8009db <memmove>
+  801edb:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801ede:	89 d8                	mov    %ebx,%eax
+  801ee0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ee3:	5b                   	pop    %ebx
+  801ee4:	5e                   	pop    %esi
+  801ee5:	5d                   	pop    %ebp
+  801ee6:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801ee7:	68 c3 2f 80 00       	push   $0x802fc3
+  801eec:	68 8b 2f 80 00       	push   $0x802f8b
+  801ef1:	6a 62                	push   $0x62
+  801ef3:	68 d8 2f 80 00       	push   $0x802fd8
+  801ef8:	e8 46 05 00 00       	call   802443 <_panic>
+
+00801efd <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801efd:	55                   	push   %ebp
+  801efe:	89 e5                	mov    %esp,%ebp
+  801f00:	53                   	push   %ebx
+  801f01:	83 ec 04             	sub    $0x4,%esp
+  801f04:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801f07:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f0a:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  801f0f:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801f15:	7f 2e                	jg     801f45 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801f17:	83 ec 04             	sub    $0x4,%esp
+  801f1a:	53                   	push   %ebx
+  801f1b:	ff 75 0c             	push   0xc(%ebp)
+  801f1e:	68 0c 70 80 00       	push   $0x80700c
+  801f23:	e8 b3 ea ff ff       	call   8009db <memmove>
+	nsipcbuf.send.req_size = size;
+  801f28:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  801f2e:	8b 45 14             	mov    0x14(%ebp),%eax
+  801f31:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  801f36:	b8 08 00 00 00       	mov    $0x8,%eax
+  801f3b:	e8 e8 fd ff ff       	call   801d28 <nsipc>
+}
+  801f40:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f43:	c9                   	leave
+  801f44:	c3                   	ret
+	assert(size < 1600);
+  801f45:	68 e4 2f 80 00       	push   $0x802fe4
+  801f4a:	68 8b 2f 80 00       	push   $0x802f8b
+  801f4f:	6a 6d                	push   $0x6d
+  801f51:	68 d8 2f 80 00       	push   $0x802fd8
+  801f56:	e8 e8 04 00 00       	call   802443 <_panic>
+
+00801f5b <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801f5b:	55                   	push   %ebp
+  801f5c:	89 e5                	mov    %esp,%ebp
+  801f5e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801f61:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f64:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  801f69:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f6c:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  801f71:	8b 45 10             	mov    0x10(%ebp),%eax
+  801f74:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  801f79:	b8 09 00 00 00       	mov    $0x9,%eax
+  801f7e:	e8 a5 fd ff ff       	call   801d28 <nsipc>
+}
+  801f83:	c9                   	leave
+  801f84:	c3                   	ret
+
+00801f85 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801f85:	55                   	push   %ebp
+  801f86:	89 e5                	mov    %esp,%ebp
+  801f88:	56                   	push   %esi
+  801f89:	53                   	push   %ebx
+  801f8a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801f8d:	83 ec 0c             	sub    $0xc,%esp
+  801f90:	ff 75 08             	push   0x8(%ebp)
+  801f93:	e8 aa f3 ff ff       	call   801342 <fd2data>
+  801f98:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801f9a:	83 c4 08             	add    $0x8,%esp
+  801f9d:	68 f0 2f 80 00       	push   $0x802ff0
+  801fa2:	53                   	push   %ebx
+  801fa3:	e8 ad e8 ff ff       	call   800855 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801fa8:	8b 46 04             	mov    0x4(%esi),%eax
+  801fab:	2b 06                	sub    (%esi),%eax
+  801fad:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  801fb3:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801fba:	00 00 00 
+	stat->st_dev = &devpipe;
+  801fbd:	c7 83 88 00 00 00 44 	movl   $0x804044,0x88(%ebx)
+  801fc4:	40 80 00 
+	return 0;
+}
+  801fc7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fcc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fcf:	5b                   	pop    %ebx
+  801fd0:	5e                   	pop    %esi
+  801fd1:	5d                   	pop    %ebp
+  801fd2:	c3                   	ret
+
+00801fd3 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801fd3:	55                   	push   %ebp
+  801fd4:	89 e5                	mov    %esp,%ebp
+  801fd6:	53                   	push   %ebx
+  801fd7:	83 ec 0c             	sub    $0xc,%esp
+  801fda:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801fdd:	53                   	push   %ebx
+  801fde:	6a 00                	push   $0x0
+  801fe0:	e8 e1 ec ff ff       	call   800cc6 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801fe5:	89 1c 24             	mov    %ebx,(%esp)
+  801fe8:	e8 55 f3 ff ff       	call   801342 <fd2data>
+  801fed:	83 c4 08             	add    $0x8,%esp
+  801ff0:	50                   	push   %eax
+  801ff1:	6a 00                	push   $0x0
+  801ff3:	e8 ce ec ff ff       	call   800cc6 <sys_page_unmap>
+}
+  801ff8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ffb:	c9                   	leave
+  801ffc:	c3                   	ret
+
+00801ffd <_pipeisclosed>:
+{
+  801ffd:	55                   	push   %ebp
+  801ffe:	89 e5                	mov    %esp,%ebp
+  802000:	57                   	push   %edi
+  802001:	56                   	push   %esi
+  802002:	53                   	push   %ebx
+  802003:	83 ec 1c             	sub    $0x1c,%esp
+  802006:	89 c7                	mov    %eax,%edi
+  802008:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  80200a:	a1 08 50 80 00       	mov    0x805008,%eax
+  80200f:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802012:	83 ec 0c             	sub    $0xc,%esp
+  802015:	57                   	push   %edi
+  802016:	e8 fd 04 00 00       	call   802518 <pageref>
+  80201b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80201e:	89 34 24             	mov    %esi,(%esp)
+  802021:	e8 f2 04 00 00       	call   802518 <pageref>
+		nn = thisenv->env_runs;
+  802026:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  80202c:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  80202f:	83 c4 10             	add    $0x10,%esp
+  802032:	39 cb                	cmp    %ecx,%ebx
+  802034:	74 1b                	je     802051 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802036:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802039:	75 cf                	jne    80200a <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80203b:	8b 42 58             	mov    0x58(%edx),%eax
+  80203e:	6a 01                	push   $0x1
+  802040:	50                   	push   %eax
+  802041:	53                   	push   %ebx
+  802042:	68 f7 2f 80 00       	push   $0x802ff7
+  802047:	e8 50 e2 ff ff       	call   80029c <cprintf>
+  80204c:	83 c4 10             	add    $0x10,%esp
+  80204f:	eb b9                	jmp    80200a <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802051:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802054:	0f 94 c0             	sete   %al
+  802057:	0f b6 c0             	movzbl %al,%eax
+}
+  80205a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80205d:	5b                   	pop    %ebx
+  80205e:	5e                   	pop    %esi
+  80205f:	5f                   	pop    %edi
+  802060:	5d                   	pop    %ebp
+  802061:	c3                   	ret
+
+00802062 <devpipe_write>:
+{
+  802062:	55                   	push   %ebp
+  802063:	89 e5                	mov    %esp,%ebp
+  802065:	57                   	push   %edi
+  802066:	56                   	push   %esi
+  802067:	53                   	push   %ebx
+  802068:	83 ec 28             	sub    $0x28,%esp
+  80206b:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  80206e:	56                   	push   %esi
+  80206f:	e8 ce f2 ff ff       	call   801342 <fd2data>
+  802074:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802076:	83 c4 10             	add    $0x10,%esp
+  802079:	bf 00 00 00 00       	mov    $0x0,%edi
+  80207e:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802081:	75 09                	jne    80208c <devpipe_write+0x2a>
+	return i;
+  802083:	89 f8                	mov    %edi,%eax
+  802085:	eb 23                	jmp    8020aa <devpipe_write+0x48>
+			sys_yield();
+  802087:	e8 96 eb ff ff       	call   800c22 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80208c:	8b 43 04             	mov    0x4(%ebx),%eax
+  80208f:	8b 0b                	mov    (%ebx),%ecx
+  802091:	8d 51 20             	lea    0x20(%ecx),%edx
+  802094:	39 d0                	cmp    %edx,%eax
+  802096:	72 1a                	jb     8020b2 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802098:	89 da                	mov    %ebx,%edx
+  80209a:	89 f0                	mov    %esi,%eax
+  80209c:	e8 5c ff ff ff       	call   801ffd <_pipeisclosed>
+  8020a1:	85 c0                	test   %eax,%eax
+  8020a3:	74 e2                	je     802087 <devpipe_write+0x25>
+				return 0;
+  8020a5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020ad:	5b                   	pop    %ebx
+  8020ae:	5e                   	pop    %esi
+  8020af:	5f                   	pop    %edi
+  8020b0:	5d                   	pop    %ebp
+  8020b1:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8020b2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8020b5:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8020b9:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8020bc:	89 c2                	mov    %eax,%edx
+  8020be:	c1 fa 1f             	sar    $0x1f,%edx
+  8020c1:	89 d1                	mov    %edx,%ecx
+  8020c3:	c1 e9 1b             	shr    $0x1b,%ecx
+  8020c6:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8020c9:	83 e2 1f             	and    $0x1f,%edx
+  8020cc:	29 ca                	sub    %ecx,%edx
+  8020ce:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8020d2:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8020d6:	83 c0 01             	add    $0x1,%eax
+  8020d9:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8020dc:	83 c7 01             	add    $0x1,%edi
+  8020df:	eb 9d                	jmp    80207e <devpipe_write+0x1c>
+
+008020e1 <devpipe_read>:
+{
+  8020e1:	55                   	push   %ebp
+  8020e2:	89 e5                	mov    %esp,%ebp
+  8020e4:	57                   	push   %edi
+  8020e5:	56                   	push   %esi
+  8020e6:	53                   	push   %ebx
+  8020e7:	83 ec 18             	sub    $0x18,%esp
+  8020ea:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8020ed:	57                   	push   %edi
+  8020ee:	e8 4f f2 ff ff       	call   801342 <fd2data>
+  8020f3:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8020f5:	83 c4 10             	add    $0x10,%esp
+  8020f8:	be 00 00 00 00       	mov    $0x0,%esi
+  8020fd:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802100:	75 13                	jne    802115 <devpipe_read+0x34>
+	return i;
+  802102:	89 f0                	mov    %esi,%eax
+  802104:	eb 02                	jmp    802108 <devpipe_read+0x27>
+				return i;
+  802106:	89 f0                	mov    %esi,%eax
+}
+  802108:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80210b:	5b                   	pop    %ebx
+  80210c:	5e                   	pop    %esi
+  80210d:	5f                   	pop    %edi
+  80210e:	5d                   	pop    %ebp
+  80210f:	c3                   	ret
+			sys_yield();
+  802110:	e8 0d eb ff ff       	call   800c22 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802115:	8b 03                	mov    (%ebx),%eax
+  802117:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80211a:	75 18                	jne    802134 <devpipe_read+0x53>
+			if (i > 0)
+  80211c:	85 f6                	test   %esi,%esi
+  80211e:	75 e6                	jne    802106 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802120:	89 da                	mov    %ebx,%edx
+  802122:	89 f8                	mov    %edi,%eax
+  802124:	e8 d4 fe ff ff       	call   801ffd <_pipeisclosed>
+  802129:	85 c0                	test   %eax,%eax
+  80212b:	74 e3                	je     802110 <devpipe_read+0x2f>
+				return 0;
+  80212d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802132:	eb d4                	jmp    802108 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802134:	99                   	cltd
+  802135:	c1 ea 1b             	shr    $0x1b,%edx
+  802138:	01 d0                	add    %edx,%eax
+  80213a:	83 e0 1f             	and    $0x1f,%eax
+  80213d:	29 d0                	sub    %edx,%eax
+  80213f:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802144:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802147:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80214a:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80214d:	83 c6 01             	add    $0x1,%esi
+  802150:	eb ab                	jmp    8020fd <devpipe_read+0x1c>
+
+00802152 <pipe>:
+{
+  802152:	55                   	push   %ebp
+  802153:	89 e5                	mov    %esp,%ebp
+  802155:	56                   	push   %esi
+  802156:	53                   	push   %ebx
+  802157:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80215a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80215d:	50                   	push   %eax
+  80215e:	e8 f6 f1 ff ff       	call   801359 <fd_alloc>
+  802163:	89 c3                	mov    %eax,%ebx
+  802165:	83 c4 10             	add    $0x10,%esp
+  802168:	85 c0                	test   %eax,%eax
+  80216a:	0f 88 23 01 00 00    	js     802293 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802170:	83 ec 04             	sub    $0x4,%esp
+  802173:	68 07 04 00 00       	push   $0x407
+  802178:	ff 75 f4             	push   -0xc(%ebp)
+  80217b:	6a 00                	push   $0x0
+  80217d:	e8 bf ea ff ff       	call   800c41 <sys_page_alloc>
+  802182:	89 c3                	mov    %eax,%ebx
+  802184:	83 c4 10             	add    $0x10,%esp
+  802187:	85 c0                	test   %eax,%eax
+  802189:	0f 88 04 01 00 00    	js     802293 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80218f:	83 ec 0c             	sub    $0xc,%esp
+  802192:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802195:	50                   	push   %eax
+  802196:	e8 be f1 ff ff       	call   801359 <fd_alloc>
+  80219b:	89 c3                	mov    %eax,%ebx
+  80219d:	83 c4 10             	add    $0x10,%esp
+  8021a0:	85 c0                	test   %eax,%eax
+  8021a2:	0f 88 db 00 00 00    	js     802283 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8021a8:	83 ec 04             	sub    $0x4,%esp
+  8021ab:	68 07 04 00 00       	push   $0x407
+  8021b0:	ff 75 f0             	push   -0x10(%ebp)
+  8021b3:	6a 00                	push   $0x0
+  8021b5:	e8 87 ea ff ff       	call   800c41 <sys_page_alloc>
+  8021ba:	89 c3                	mov    %eax,%ebx
+  8021bc:	83 c4 10             	add    $0x10,%esp
+  8021bf:	85 c0                	test   %eax,%eax
+  8021c1:	0f 88 bc 00 00 00    	js     802283 <pipe+0x131>
+	va = fd2data(fd0);
+  8021c7:	83 ec 0c             	sub    $0xc,%esp
+  8021ca:	ff 75 f4             	push   -0xc(%ebp)
+  8021cd:	e8 70 f1 ff ff       	call   801342 <fd2data>
+  8021d2:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8021d4:	83 c4 0c             	add    $0xc,%esp
+  8021d7:	68 07 04 00 00       	push   $0x407
+  8021dc:	50                   	push   %eax
+  8021dd:	6a 00                	push   $0x0
+  8021df:	e8 5d ea ff ff       	call   800c41 <sys_page_alloc>
+  8021e4:	89 c3                	mov    %eax,%ebx
+  8021e6:	83 c4 10             	add    $0x10,%esp
+  8021e9:	85 c0                	test   %eax,%eax
+  8021eb:	0f 88 82 00 00 00    	js     802273 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8021f1:	83 ec 0c             	sub    $0xc,%esp
+  8021f4:	ff 75 f0             	push   -0x10(%ebp)
+  8021f7:	e8 46 f1 ff ff       	call   801342 <fd2data>
+  8021fc:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802203:	50                   	push   %eax
+  802204:	6a 00                	push   $0x0
+  802206:	56                   	push   %esi
+  802207:	6a 00                	push   $0x0
+  802209:	e8 76 ea ff ff       	call   800c84 <sys_page_map>
+  80220e:	89 c3                	mov    %eax,%ebx
+  802210:	83 c4 20             	add    $0x20,%esp
+  802213:	85 c0                	test   %eax,%eax
+  802215:	78 4e                	js     802265 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802217:	a1 44 40 80 00       	mov    0x804044,%eax
+  80221c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80221f:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802221:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802224:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80222b:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80222e:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802230:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802233:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80223a:	83 ec 0c             	sub    $0xc,%esp
+  80223d:	ff 75 f4             	push   -0xc(%ebp)
+  802240:	e8 ed f0 ff ff       	call   801332 <fd2num>
+  802245:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802248:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80224a:	83 c4 04             	add    $0x4,%esp
+  80224d:	ff 75 f0             	push   -0x10(%ebp)
+  802250:	e8 dd f0 ff ff       	call   801332 <fd2num>
+  802255:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802258:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80225b:	83 c4 10             	add    $0x10,%esp
+  80225e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802263:	eb 2e                	jmp    802293 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802265:	83 ec 08             	sub    $0x8,%esp
+  802268:	56                   	push   %esi
+  802269:	6a 00                	push   $0x0
+  80226b:	e8 56 ea ff ff       	call   800cc6 <sys_page_unmap>
+  802270:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802273:	83 ec 08             	sub    $0x8,%esp
+  802276:	ff 75 f0             	push   -0x10(%ebp)
+  802279:	6a 00                	push   $0x0
+  80227b:	e8 46 ea ff ff       	call   800cc6 <sys_page_unmap>
+  802280:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802283:	83 ec 08             	sub    $0x8,%esp
+  802286:	ff 75 f4             	push   -0xc(%ebp)
+  802289:	6a 00                	push   $0x0
+  80228b:	e8 36 ea ff ff       	call   800cc6 <sys_page_unmap>
+  802290:	83 c4 10             	add    $0x10,%esp
+}
+  802293:	89 d8                	mov    %ebx,%eax
+  802295:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802298:	5b                   	pop    %ebx
+  802299:	5e                   	pop    %esi
+  80229a:	5d                   	pop    %ebp
+  80229b:	c3                   	ret
+
+0080229c <pipeisclosed>:
+{
+  80229c:	55                   	push   %ebp
+  80229d:	89 e5                	mov    %esp,%ebp
+  80229f:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8022a2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022a5:	50                   	push   %eax
+  8022a6:	ff 75 08             	push   0x8(%ebp)
+  8022a9:	e8 01 f1 ff ff       	call   8013af <fd_lookup>
+  8022ae:	83 c4 10             	add    $0x10,%esp
+  8022b1:	85 c0                	test   %eax,%eax
+  8022b3:	78 18                	js     8022cd <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8022b5:	83 ec 0c             	sub    $0xc,%esp
+  8022b8:	ff 75 f4             	push   -0xc(%ebp)
+  8022bb:	e8 82 f0 ff ff       	call   801342 <fd2data>
+  8022c0:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8022c2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022c5:	e8 33 fd ff ff       	call   801ffd <_pipeisclosed>
+  8022ca:	83 c4 10             	add    $0x10,%esp
+}
+  8022cd:	c9                   	leave
+  8022ce:	c3                   	ret
+
+008022cf <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8022cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022d4:	c3                   	ret
+
+008022d5 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8022d5:	55                   	push   %ebp
+  8022d6:	89 e5                	mov    %esp,%ebp
+  8022d8:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8022db:	68 0f 30 80 00       	push   $0x80300f
+  8022e0:	ff 75 0c             	push   0xc(%ebp)
+  8022e3:	e8 6d e5 ff ff       	call   800855 <strcpy>
+	return 0;
+}
+  8022e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022ed:	c9                   	leave
+  8022ee:	c3                   	ret
+
+008022ef <devcons_write>:
+{
+  8022ef:	55                   	push   %ebp
+  8022f0:	89 e5                	mov    %esp,%ebp
+  8022f2:	57                   	push   %edi
+  8022f3:	56                   	push   %esi
+  8022f4:	53                   	push   %ebx
+  8022f5:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8022fb:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802300:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802306:	eb 2e                	jmp    802336 <devcons_write+0x47>
+		m = n - tot;
+  802308:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80230b:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80230d:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802312:	39 c3                	cmp    %eax,%ebx
+  802314:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802317:	83 ec 04             	sub    $0x4,%esp
+  80231a:	53                   	push   %ebx
+  80231b:	89 f0                	mov    %esi,%eax
+  80231d:	03 45 0c             	add    0xc(%ebp),%eax
+  802320:	50                   	push   %eax
+  802321:	57                   	push   %edi
+  802322:	e8 b4 e6 ff ff       	call   8009db <memmove>
+		sys_cputs(buf, m);
+  802327:	83 c4 08             	add    $0x8,%esp
+  80232a:	53                   	push   %ebx
+  80232b:	57                   	push   %edi
+  80232c:	e8 54 e8 ff ff       	call   800b85 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802331:	01 de                	add    %ebx,%esi
+  802333:	83 c4 10             	add    $0x10,%esp
+  802336:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802339:	72 cd                	jb     802308 <devcons_write+0x19>
+}
+  80233b:	89 f0                	mov    %esi,%eax
+  80233d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802340:	5b                   	pop    %ebx
+  802341:	5e                   	pop    %esi
+  802342:	5f                   	pop    %edi
+  802343:	5d                   	pop    %ebp
+  802344:	c3                   	ret
+
+00802345 <devcons_read>:
+{
+  802345:	55                   	push   %ebp
+  802346:	89 e5                	mov    %esp,%ebp
+  802348:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80234b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802350:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802354:	75 07                	jne    80235d <devcons_read+0x18>
+  802356:	eb 1f                	jmp    802377 <devcons_read+0x32>
+		sys_yield();
+  802358:	e8 c5 e8 ff ff       	call   800c22 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80235d:	e8 41 e8 ff ff       	call   800ba3 <sys_cgetc>
+  802362:	85 c0                	test   %eax,%eax
+  802364:	74 f2                	je     802358 <devcons_read+0x13>
+	if (c < 0)
+  802366:	78 0f                	js     802377 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802368:	83 f8 04             	cmp    $0x4,%eax
+  80236b:	74 0c                	je     802379 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80236d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802370:	88 02                	mov    %al,(%edx)
+	return 1;
+  802372:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802377:	c9                   	leave
+  802378:	c3                   	ret
+		return 0;
+  802379:	b8 00 00 00 00       	mov    $0x0,%eax
+  80237e:	eb f7                	jmp    802377 <devcons_read+0x32>
+
+00802380 <cputchar>:
+{
+  802380:	55                   	push   %ebp
+  802381:	89 e5                	mov    %esp,%ebp
+  802383:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802386:	8b 45 08             	mov    0x8(%ebp),%eax
+  802389:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80238c:	6a 01                	push   $0x1
+  80238e:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802391:	50                   	push   %eax
+  802392:	e8 ee e7 ff ff       	call   800b85 <sys_cputs>
+}
+  802397:	83 c4 10             	add    $0x10,%esp
+  80239a:	c9                   	leave
+  80239b:	c3                   	ret
+
+0080239c <getchar>:
+{
+  80239c:	55                   	push   %ebp
+  80239d:	89 e5                	mov    %esp,%ebp
+  80239f:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8023a2:	6a 01                	push   $0x1
+  8023a4:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8023a7:	50                   	push   %eax
+  8023a8:	6a 00                	push   $0x0
+  8023aa:	e8 66 f2 ff ff       	call   801615 <read>
+	if (r < 0)
+  8023af:	83 c4 10             	add    $0x10,%esp
+  8023b2:	85 c0                	test   %eax,%eax
+  8023b4:	78 06                	js     8023bc <getchar+0x20>
+	if (r < 1)
+  8023b6:	74 06                	je     8023be <getchar+0x22>
+	return c;
+  8023b8:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8023bc:	c9                   	leave
+  8023bd:	c3                   	ret
+		return -E_EOF;
+  8023be:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8023c3:	eb f7                	jmp    8023bc <getchar+0x20>
+
+008023c5 <iscons>:
+{
+  8023c5:	55                   	push   %ebp
+  8023c6:	89 e5                	mov    %esp,%ebp
+  8023c8:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8023cb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023ce:	50                   	push   %eax
+  8023cf:	ff 75 08             	push   0x8(%ebp)
+  8023d2:	e8 d8 ef ff ff       	call   8013af <fd_lookup>
+  8023d7:	83 c4 10             	add    $0x10,%esp
+  8023da:	85 c0                	test   %eax,%eax
+  8023dc:	78 11                	js     8023ef <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8023de:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023e1:	8b 15 60 40 80 00    	mov    0x804060,%edx
+  8023e7:	39 10                	cmp    %edx,(%eax)
+  8023e9:	0f 94 c0             	sete   %al
+  8023ec:	0f b6 c0             	movzbl %al,%eax
+}
+  8023ef:	c9                   	leave
+  8023f0:	c3                   	ret
+
+008023f1 <opencons>:
+{
+  8023f1:	55                   	push   %ebp
+  8023f2:	89 e5                	mov    %esp,%ebp
+  8023f4:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8023f7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023fa:	50                   	push   %eax
+  8023fb:	e8 59 ef ff ff       	call   801359 <fd_alloc>
+  802400:	83 c4 10             	add    $0x10,%esp
+  802403:	85 c0                	test   %eax,%eax
+  802405:	78 3a                	js     802441 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802407:	83 ec 04             	sub    $0x4,%esp
+  80240a:	68 07 04 00 00       	push   $0x407
+  80240f:	ff 75 f4             	push   -0xc(%ebp)
+  802412:	6a 00                	push   $0x0
+  802414:	e8 28 e8 ff ff       	call   800c41 <sys_page_alloc>
+  802419:	83 c4 10             	add    $0x10,%esp
+  80241c:	85 c0                	test   %eax,%eax
+  80241e:	78 21                	js     802441 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802420:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802423:	8b 15 60 40 80 00    	mov    0x804060,%edx
+  802429:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80242b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80242e:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802435:	83 ec 0c             	sub    $0xc,%esp
+  802438:	50                   	push   %eax
+  802439:	e8 f4 ee ff ff       	call   801332 <fd2num>
+  80243e:	83 c4 10             	add    $0x10,%esp
+}
+  802441:	c9                   	leave
+  802442:	c3                   	ret
+
+00802443 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  802443:	55                   	push   %ebp
+  802444:	89 e5                	mov    %esp,%ebp
+  802446:	56                   	push   %esi
+  802447:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  802448:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80244b:	8b 35 08 40 80 00    	mov    0x804008,%esi
+  802451:	e8 ad e7 ff ff       	call   800c03 <sys_getenvid>
+  802456:	83 ec 0c             	sub    $0xc,%esp
+  802459:	ff 75 0c             	push   0xc(%ebp)
+  80245c:	ff 75 08             	push   0x8(%ebp)
+  80245f:	56                   	push   %esi
+  802460:	50                   	push   %eax
+  802461:	68 1c 30 80 00       	push   $0x80301c
+  802466:	e8 31 de ff ff       	call   80029c <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80246b:	83 c4 18             	add    $0x18,%esp
+  80246e:	53                   	push   %ebx
+  80246f:	ff 75 10             	push   0x10(%ebp)
+  802472:	e8 d4 dd ff ff       	call   80024b <vcprintf>
+	cprintf("\n");
+  802477:	c7 04 24 08 30 80 00 	movl   $0x803008,(%esp)
+  80247e:	e8 19 de ff ff       	call   80029c <cprintf>
+  802483:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  802486:	cc                   	int3
+	while (1)
+  802487:	eb fd                	jmp    802486 <_panic+0x43>
+
+00802489 <set_pgfault_handler>:
+// allocate an exception stack (one page of memory with its top
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf)) {
+  802489:	55                   	push   %ebp
+  80248a:	89 e5                	mov    %esp,%ebp
+  80248c:	83 ec 08             	sub    $0x8,%esp
+  int r;
+
+  if (_pgfault_handler == 0) {
+  80248f:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  802496:	74 0a                	je     8024a2 <set_pgfault_handler+0x19>
+    if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)))
+      panic(" set_pgfault_handler sys_env_set_pgfault_upcall panic: %e\n", r);
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  802498:	8b 45 08             	mov    0x8(%ebp),%eax
+  80249b:	a3 00 80 80 00       	mov    %eax,0x808000
+
+
+}
+  8024a0:	c9                   	leave
+  8024a1:	c3                   	ret
+    if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)))
+  8024a2:	83 ec 04             	sub    $0x4,%esp
+  8024a5:	6a 07                	push   $0x7
+  8024a7:	68 00 f0 bf ee       	push   $0xeebff000
+  8024ac:	6a 00                	push   $0x0
+  8024ae:	e8 8e e7 ff ff       	call   800c41 <sys_page_alloc>
+  8024b3:	83 c4 10             	add    $0x10,%esp
+  8024b6:	85 c0                	test   %eax,%eax
+  8024b8:	75 28                	jne    8024e2 <set_pgfault_handler+0x59>
+    if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)))
+  8024ba:	83 ec 08             	sub    $0x8,%esp
+  8024bd:	68 f4 24 80 00       	push   $0x8024f4
+  8024c2:	6a 00                	push   $0x0
+  8024c4:	e8 c3 e8 ff ff       	call   800d8c <sys_env_set_pgfault_upcall>
+  8024c9:	83 c4 10             	add    $0x10,%esp
+  8024cc:	85 c0                	test   %eax,%eax
+  8024ce:	74 c8                	je     802498 <set_pgfault_handler+0xf>
+      panic(" set_pgfault_handler sys_env_set_pgfault_upcall panic: %e\n", r);
+  8024d0:	50                   	push   %eax
+  8024d1:	68 70 30 80 00       	push   $0x803070
+  8024d6:	6a 22                	push   $0x22
+  8024d8:	68 ab 30 80 00       	push   $0x8030ab
+  8024dd:	e8 61 ff ff ff       	call   802443 <_panic>
+      panic("set_pgfault_handler sys_page_alloc panic: %e\n", r);
+  8024e2:	50                   	push   %eax
+  8024e3:	68 40 30 80 00       	push   $0x803040
+  8024e8:	6a 20                	push   $0x20
+  8024ea:	68 ab 30 80 00       	push   $0x8030ab
+  8024ef:	e8 4f ff ff ff       	call   802443 <_panic>
+
+008024f4 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8024f4:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8024f5:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  8024fa:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8024fc:	83 c4 04             	add    $0x4,%esp
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	// push the trap-time %eip onto the trap-time stack
+    subl $0x4, 0x30(%esp) # for push eip
+  8024ff:	83 6c 24 30 04       	subl   $0x4,0x30(%esp)
+    movl 0x30(%esp), %ebx #regular esp
+  802504:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+    movl 0x28(%esp), %eax #eip
+  802508:	8b 44 24 28          	mov    0x28(%esp),%eax
+    movl %eax, (%ebx)
+  80250c:	89 03                	mov    %eax,(%ebx)
+
+    // Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+    addl $8, %esp
+  80250e:	83 c4 08             	add    $0x8,%esp
+    popal
+  802511:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  802512:	83 c4 04             	add    $0x4,%esp
+	popfl
+  802515:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  802516:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  802517:	c3                   	ret
+
+00802518 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802518:	55                   	push   %ebp
+  802519:	89 e5                	mov    %esp,%ebp
+  80251b:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80251e:	89 c2                	mov    %eax,%edx
+  802520:	c1 ea 16             	shr    $0x16,%edx
+  802523:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80252a:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80252f:	f6 c1 01             	test   $0x1,%cl
+  802532:	74 1c                	je     802550 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  802534:	c1 e8 0c             	shr    $0xc,%eax
+  802537:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80253e:	a8 01                	test   $0x1,%al
+  802540:	74 0e                	je     802550 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802542:	c1 e8 0c             	shr    $0xc,%eax
+  802545:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  80254c:	ef 
+  80254d:	0f b7 d2             	movzwl %dx,%edx
+}
+  802550:	89 d0                	mov    %edx,%eax
+  802552:	5d                   	pop    %ebp
+  802553:	c3                   	ret
+  802554:	66 90                	xchg   %ax,%ax
+  802556:	66 90                	xchg   %ax,%ax
+  802558:	66 90                	xchg   %ax,%ax
+  80255a:	66 90                	xchg   %ax,%ax
+  80255c:	66 90                	xchg   %ax,%ax
+  80255e:	66 90                	xchg   %ax,%ax
+
+00802560 <__udivmoddi4>:
+  802560:	55                   	push   %ebp
+  802561:	57                   	push   %edi
+  802562:	56                   	push   %esi
+  802563:	53                   	push   %ebx
+  802564:	83 ec 24             	sub    $0x24,%esp
+  802567:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80256b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80256f:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  802573:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802577:	8b 54 24 44          	mov    0x44(%esp),%edx
+  80257b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80257f:	8b 44 24 40          	mov    0x40(%esp),%eax
+  802583:	89 d3                	mov    %edx,%ebx
+  802585:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802589:	09 c3                	or     %eax,%ebx
+  80258b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80258f:	0f 84 9c 00 00 00    	je     802631 <__udivmoddi4+0xd1>
+  802595:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80259c:	00 
+  80259d:	31 c0                	xor    %eax,%eax
+  80259f:	31 d2                	xor    %edx,%edx
+  8025a1:	89 fb                	mov    %edi,%ebx
+  8025a3:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8025aa:	00 
+  8025ab:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8025b0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8025b4:	01 c0                	add    %eax,%eax
+  8025b6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8025bd:	00 
+  8025be:	89 c6                	mov    %eax,%esi
+  8025c0:	89 d7                	mov    %edx,%edi
+  8025c2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8025c6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8025ca:	0f ad d0             	shrd   %cl,%edx,%eax
+  8025cd:	d3 ea                	shr    %cl,%edx
+  8025cf:	f6 c1 20             	test   $0x20,%cl
+  8025d2:	0f 45 c2             	cmovne %edx,%eax
+  8025d5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8025d9:	83 e0 01             	and    $0x1,%eax
+  8025dc:	09 fa                	or     %edi,%edx
+  8025de:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8025e2:	89 04 24             	mov    %eax,(%esp)
+  8025e5:	8b 04 24             	mov    (%esp),%eax
+  8025e8:	89 d5                	mov    %edx,%ebp
+  8025ea:	09 f0                	or     %esi,%eax
+  8025ec:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8025f0:	39 f0                	cmp    %esi,%eax
+  8025f2:	19 fd                	sbb    %edi,%ebp
+  8025f4:	72 1d                	jb     802613 <__udivmoddi4+0xb3>
+  8025f6:	29 f0                	sub    %esi,%eax
+  8025f8:	19 fa                	sbb    %edi,%edx
+  8025fa:	89 cf                	mov    %ecx,%edi
+  8025fc:	c1 ef 05             	shr    $0x5,%edi
+  8025ff:	83 e7 01             	and    $0x1,%edi
+  802602:	89 fe                	mov    %edi,%esi
+  802604:	d3 e7                	shl    %cl,%edi
+  802606:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80260a:	83 f6 01             	xor    $0x1,%esi
+  80260d:	d3 e6                	shl    %cl,%esi
+  80260f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802613:	83 e9 01             	sub    $0x1,%ecx
+  802616:	73 98                	jae    8025b0 <__udivmoddi4+0x50>
+  802618:	85 db                	test   %ebx,%ebx
+  80261a:	74 05                	je     802621 <__udivmoddi4+0xc1>
+  80261c:	89 03                	mov    %eax,(%ebx)
+  80261e:	89 53 04             	mov    %edx,0x4(%ebx)
+  802621:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802625:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802629:	83 c4 24             	add    $0x24,%esp
+  80262c:	5b                   	pop    %ebx
+  80262d:	5e                   	pop    %esi
+  80262e:	5f                   	pop    %edi
+  80262f:	5d                   	pop    %ebp
+  802630:	c3                   	ret
+  802631:	85 ff                	test   %edi,%edi
+  802633:	74 0d                	je     802642 <__udivmoddi4+0xe2>
+  802635:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  80263b:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  802642:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802646:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80264a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80264e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802652:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802656:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80265a:	83 c4 24             	add    $0x24,%esp
+  80265d:	5b                   	pop    %ebx
+  80265e:	5e                   	pop    %esi
+  80265f:	5f                   	pop    %edi
+  802660:	5d                   	pop    %ebp
+  802661:	c3                   	ret
+  802662:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802669:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00802670 <__udivdi3>:
+  802670:	57                   	push   %edi
+  802671:	56                   	push   %esi
+  802672:	53                   	push   %ebx
+  802673:	83 ec 20             	sub    $0x20,%esp
+  802676:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80267a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80267e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802682:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802686:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80268a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80268e:	89 d1                	mov    %edx,%ecx
+  802690:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802694:	09 c1                	or     %eax,%ecx
+  802696:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80269a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80269e:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  8026a2:	0f 84 88 00 00 00    	je     802730 <__udivdi3+0xc0>
+  8026a8:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8026af:	00 
+  8026b0:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8026b5:	31 c0                	xor    %eax,%eax
+  8026b7:	31 d2                	xor    %edx,%edx
+  8026b9:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8026c0:	00 
+  8026c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8026c8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8026cc:	01 c0                	add    %eax,%eax
+  8026ce:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8026d5:	00 
+  8026d6:	89 c6                	mov    %eax,%esi
+  8026d8:	89 d7                	mov    %edx,%edi
+  8026da:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8026de:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8026e2:	0f ad d0             	shrd   %cl,%edx,%eax
+  8026e5:	d3 ea                	shr    %cl,%edx
+  8026e7:	f6 c1 20             	test   $0x20,%cl
+  8026ea:	0f 45 c2             	cmovne %edx,%eax
+  8026ed:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8026f1:	83 e0 01             	and    $0x1,%eax
+  8026f4:	09 fa                	or     %edi,%edx
+  8026f6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8026fa:	89 04 24             	mov    %eax,(%esp)
+  8026fd:	8b 04 24             	mov    (%esp),%eax
+  802700:	89 d3                	mov    %edx,%ebx
+  802702:	09 f0                	or     %esi,%eax
+  802704:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802708:	39 f0                	cmp    %esi,%eax
+  80270a:	19 fb                	sbb    %edi,%ebx
+  80270c:	72 1d                	jb     80272b <__udivdi3+0xbb>
+  80270e:	29 f0                	sub    %esi,%eax
+  802710:	19 fa                	sbb    %edi,%edx
+  802712:	89 cf                	mov    %ecx,%edi
+  802714:	c1 ef 05             	shr    $0x5,%edi
+  802717:	83 e7 01             	and    $0x1,%edi
+  80271a:	89 fe                	mov    %edi,%esi
+  80271c:	d3 e7                	shl    %cl,%edi
+  80271e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802722:	83 f6 01             	xor    $0x1,%esi
+  802725:	d3 e6                	shl    %cl,%esi
+  802727:	09 74 24 18          	or     %esi,0x18(%esp)
+  80272b:	83 e9 01             	sub    $0x1,%ecx
+  80272e:	73 98                	jae    8026c8 <__udivdi3+0x58>
+  802730:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802734:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802738:	83 c4 20             	add    $0x20,%esp
+  80273b:	5b                   	pop    %ebx
+  80273c:	5e                   	pop    %esi
+  80273d:	5f                   	pop    %edi
+  80273e:	c3                   	ret
+  80273f:	90                   	nop
+
+00802740 <__umoddi3>:
+  802740:	57                   	push   %edi
+  802741:	56                   	push   %esi
+  802742:	53                   	push   %ebx
+  802743:	83 ec 18             	sub    $0x18,%esp
+  802746:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80274a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80274e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802752:	8b 54 24 34          	mov    0x34(%esp),%edx
+  802756:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80275a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80275e:	89 d1                	mov    %edx,%ecx
+  802760:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802764:	09 c1                	or     %eax,%ecx
+  802766:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80276a:	74 5b                	je     8027c7 <__umoddi3+0x87>
+  80276c:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802771:	31 c0                	xor    %eax,%eax
+  802773:	31 d2                	xor    %edx,%edx
+  802775:	8d 76 00             	lea    0x0(%esi),%esi
+  802778:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80277c:	01 c0                	add    %eax,%eax
+  80277e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802785:	00 
+  802786:	89 c6                	mov    %eax,%esi
+  802788:	89 d7                	mov    %edx,%edi
+  80278a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80278e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802792:	0f ad d0             	shrd   %cl,%edx,%eax
+  802795:	d3 ea                	shr    %cl,%edx
+  802797:	f6 c1 20             	test   $0x20,%cl
+  80279a:	0f 45 c2             	cmovne %edx,%eax
+  80279d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8027a1:	83 e0 01             	and    $0x1,%eax
+  8027a4:	09 fa                	or     %edi,%edx
+  8027a6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8027aa:	89 04 24             	mov    %eax,(%esp)
+  8027ad:	8b 04 24             	mov    (%esp),%eax
+  8027b0:	89 d3                	mov    %edx,%ebx
+  8027b2:	09 f0                	or     %esi,%eax
+  8027b4:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8027b8:	39 f0                	cmp    %esi,%eax
+  8027ba:	19 fb                	sbb    %edi,%ebx
+  8027bc:	72 04                	jb     8027c2 <__umoddi3+0x82>
+  8027be:	29 f0                	sub    %esi,%eax
+  8027c0:	19 fa                	sbb    %edi,%edx
+  8027c2:	83 e9 01             	sub    $0x1,%ecx
+  8027c5:	73 b1                	jae    802778 <__umoddi3+0x38>
+  8027c7:	83 c4 18             	add    $0x18,%esp
+  8027ca:	5b                   	pop    %ebx
+  8027cb:	5e                   	pop    %esi
+  8027cc:	5f                   	pop    %edi
+  8027cd:	c3                   	ret
+  8027ce:	66 90                	xchg   %ax,%ax
+
+008027d0 <__divdi3>:
+  8027d0:	55                   	push   %ebp
+  8027d1:	57                   	push   %edi
+  8027d2:	56                   	push   %esi
+  8027d3:	53                   	push   %ebx
+  8027d4:	83 ec 24             	sub    $0x24,%esp
+  8027d7:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  8027db:	8b 74 24 44          	mov    0x44(%esp),%esi
+  8027df:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8027e3:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8027e7:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  8027eb:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8027ef:	85 d2                	test   %edx,%edx
+  8027f1:	0f 88 e0 00 00 00    	js     8028d7 <__divdi3+0x107>
+  8027f7:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  8027fb:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  8027ff:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802803:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802807:	85 f6                	test   %esi,%esi
+  802809:	78 16                	js     802821 <__divdi3+0x51>
+  80280b:	89 f1                	mov    %esi,%ecx
+  80280d:	31 c0                	xor    %eax,%eax
+  80280f:	31 d2                	xor    %edx,%edx
+  802811:	09 d9                	or     %ebx,%ecx
+  802813:	0f 85 f3 00 00 00    	jne    80290c <__divdi3+0x13c>
+  802819:	83 c4 24             	add    $0x24,%esp
+  80281c:	5b                   	pop    %ebx
+  80281d:	5e                   	pop    %esi
+  80281e:	5f                   	pop    %edi
+  80281f:	5d                   	pop    %ebp
+  802820:	c3                   	ret
+  802821:	bf 01 00 00 00       	mov    $0x1,%edi
+  802826:	f7 5c 24 08          	negl   0x8(%esp)
+  80282a:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  80282f:	f7 5c 24 0c          	negl   0xc(%esp)
+  802833:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80283a:	00 
+  80283b:	31 c0                	xor    %eax,%eax
+  80283d:	31 d2                	xor    %edx,%edx
+  80283f:	89 fb                	mov    %edi,%ebx
+  802841:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802848:	00 
+  802849:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80284e:	66 90                	xchg   %ax,%ax
+  802850:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802854:	01 c0                	add    %eax,%eax
+  802856:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80285d:	00 
+  80285e:	89 c6                	mov    %eax,%esi
+  802860:	89 d7                	mov    %edx,%edi
+  802862:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802866:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80286a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80286d:	d3 ea                	shr    %cl,%edx
+  80286f:	f6 c1 20             	test   $0x20,%cl
+  802872:	0f 45 c2             	cmovne %edx,%eax
+  802875:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802879:	83 e0 01             	and    $0x1,%eax
+  80287c:	09 fa                	or     %edi,%edx
+  80287e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802882:	89 04 24             	mov    %eax,(%esp)
+  802885:	8b 04 24             	mov    (%esp),%eax
+  802888:	89 d5                	mov    %edx,%ebp
+  80288a:	09 f0                	or     %esi,%eax
+  80288c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802890:	39 f0                	cmp    %esi,%eax
+  802892:	19 fd                	sbb    %edi,%ebp
+  802894:	72 1d                	jb     8028b3 <__divdi3+0xe3>
+  802896:	29 f0                	sub    %esi,%eax
+  802898:	19 fa                	sbb    %edi,%edx
+  80289a:	89 cf                	mov    %ecx,%edi
+  80289c:	c1 ef 05             	shr    $0x5,%edi
+  80289f:	83 e7 01             	and    $0x1,%edi
+  8028a2:	89 fe                	mov    %edi,%esi
+  8028a4:	d3 e7                	shl    %cl,%edi
+  8028a6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8028aa:	83 f6 01             	xor    $0x1,%esi
+  8028ad:	d3 e6                	shl    %cl,%esi
+  8028af:	09 74 24 18          	or     %esi,0x18(%esp)
+  8028b3:	83 e9 01             	sub    $0x1,%ecx
+  8028b6:	73 98                	jae    802850 <__divdi3+0x80>
+  8028b8:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8028bc:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8028c0:	85 db                	test   %ebx,%ebx
+  8028c2:	0f 84 51 ff ff ff    	je     802819 <__divdi3+0x49>
+  8028c8:	f7 d8                	neg    %eax
+  8028ca:	83 d2 00             	adc    $0x0,%edx
+  8028cd:	83 c4 24             	add    $0x24,%esp
+  8028d0:	5b                   	pop    %ebx
+  8028d1:	f7 da                	neg    %edx
+  8028d3:	5e                   	pop    %esi
+  8028d4:	5f                   	pop    %edi
+  8028d5:	5d                   	pop    %ebp
+  8028d6:	c3                   	ret
+  8028d7:	f7 d8                	neg    %eax
+  8028d9:	83 d2 00             	adc    $0x0,%edx
+  8028dc:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8028e0:	f7 da                	neg    %edx
+  8028e2:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8028e6:	85 f6                	test   %esi,%esi
+  8028e8:	78 1b                	js     802905 <__divdi3+0x135>
+  8028ea:	89 f1                	mov    %esi,%ecx
+  8028ec:	31 c0                	xor    %eax,%eax
+  8028ee:	31 d2                	xor    %edx,%edx
+  8028f0:	bf 01 00 00 00       	mov    $0x1,%edi
+  8028f5:	09 d9                	or     %ebx,%ecx
+  8028f7:	0f 85 36 ff ff ff    	jne    802833 <__divdi3+0x63>
+  8028fd:	83 c4 24             	add    $0x24,%esp
+  802900:	5b                   	pop    %ebx
+  802901:	5e                   	pop    %esi
+  802902:	5f                   	pop    %edi
+  802903:	5d                   	pop    %ebp
+  802904:	c3                   	ret
+  802905:	31 ff                	xor    %edi,%edi
+  802907:	e9 1a ff ff ff       	jmp    802826 <__divdi3+0x56>
+  80290c:	31 ff                	xor    %edi,%edi
+  80290e:	e9 20 ff ff ff       	jmp    802833 <__divdi3+0x63>
+  802913:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80291a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00802920 <__moddi3>:
+  802920:	55                   	push   %ebp
+  802921:	57                   	push   %edi
+  802922:	56                   	push   %esi
+  802923:	53                   	push   %ebx
+  802924:	83 ec 1c             	sub    $0x1c,%esp
+  802927:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  80292b:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  80292f:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  802933:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  802937:	89 c8                	mov    %ecx,%eax
+  802939:	89 f2                	mov    %esi,%edx
+  80293b:	89 f3                	mov    %esi,%ebx
+  80293d:	85 ed                	test   %ebp,%ebp
+  80293f:	0f 88 9d 00 00 00    	js     8029e2 <__moddi3+0xc2>
+  802945:	09 cb                	or     %ecx,%ebx
+  802947:	0f 84 8d 00 00 00    	je     8029da <__moddi3+0xba>
+  80294d:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802951:	31 db                	xor    %ebx,%ebx
+  802953:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802957:	89 ca                	mov    %ecx,%edx
+  802959:	89 f0                	mov    %esi,%eax
+  80295b:	89 dd                	mov    %ebx,%ebp
+  80295d:	f7 da                	neg    %edx
+  80295f:	83 d0 00             	adc    $0x0,%eax
+  802962:	f7 d8                	neg    %eax
+  802964:	0f 49 f0             	cmovns %eax,%esi
+  802967:	0f 49 ca             	cmovns %edx,%ecx
+  80296a:	31 c0                	xor    %eax,%eax
+  80296c:	31 d2                	xor    %edx,%edx
+  80296e:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802972:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802976:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80297b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80297f:	90                   	nop
+  802980:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802984:	01 c0                	add    %eax,%eax
+  802986:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80298d:	00 
+  80298e:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  802992:	89 c6                	mov    %eax,%esi
+  802994:	89 d7                	mov    %edx,%edi
+  802996:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80299a:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80299e:	0f ad d0             	shrd   %cl,%edx,%eax
+  8029a1:	d3 ea                	shr    %cl,%edx
+  8029a3:	f6 c1 20             	test   $0x20,%cl
+  8029a6:	0f 45 c2             	cmovne %edx,%eax
+  8029a9:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8029ad:	83 e0 01             	and    $0x1,%eax
+  8029b0:	09 fa                	or     %edi,%edx
+  8029b2:	89 04 24             	mov    %eax,(%esp)
+  8029b5:	8b 04 24             	mov    (%esp),%eax
+  8029b8:	89 d7                	mov    %edx,%edi
+  8029ba:	09 f0                	or     %esi,%eax
+  8029bc:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  8029c0:	39 d8                	cmp    %ebx,%eax
+  8029c2:	19 f7                	sbb    %esi,%edi
+  8029c4:	72 04                	jb     8029ca <__moddi3+0xaa>
+  8029c6:	29 d8                	sub    %ebx,%eax
+  8029c8:	19 f2                	sbb    %esi,%edx
+  8029ca:	83 e9 01             	sub    $0x1,%ecx
+  8029cd:	73 b1                	jae    802980 <__moddi3+0x60>
+  8029cf:	85 ed                	test   %ebp,%ebp
+  8029d1:	74 07                	je     8029da <__moddi3+0xba>
+  8029d3:	f7 d8                	neg    %eax
+  8029d5:	83 d2 00             	adc    $0x0,%edx
+  8029d8:	f7 da                	neg    %edx
+  8029da:	83 c4 1c             	add    $0x1c,%esp
+  8029dd:	5b                   	pop    %ebx
+  8029de:	5e                   	pop    %esi
+  8029df:	5f                   	pop    %edi
+  8029e0:	5d                   	pop    %ebp
+  8029e1:	c3                   	ret
+  8029e2:	09 cb                	or     %ecx,%ebx
+  8029e4:	74 f4                	je     8029da <__moddi3+0xba>
+  8029e6:	f7 df                	neg    %edi
+  8029e8:	bb 01 00 00 00       	mov    $0x1,%ebx
+  8029ed:	83 d5 00             	adc    $0x0,%ebp
+  8029f0:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  8029f4:	f7 dd                	neg    %ebp
+  8029f6:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  8029fa:	e9 58 ff ff ff       	jmp    802957 <__moddi3+0x37>
@@ -0,0 +1,7700 @@
+
+obj/user/sh.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 f2 09 00 00       	call   800a23 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <_gettoken>:
+// words get nul-terminated.
+#define WHITESPACE " \t\r\n"
+#define SYMBOLS "<|>&;()"
+
+int
+_gettoken(char *s, char **p1, char **p2) {
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 0c             	sub    $0xc,%esp
+  80003c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80003f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  int t;
+
+  if (s == 0) {
+  800042:	85 db                	test   %ebx,%ebx
+  800044:	74 1a                	je     800060 <_gettoken+0x2d>
+    if (debug > 1)
+      cprintf("GETTOKEN NULL\n");
+    return 0;
+  }
+
+  if (debug > 1)
+  800046:	83 3d 00 60 80 00 01 	cmpl   $0x1,0x806000
+  80004d:	7f 31                	jg     800080 <_gettoken+0x4d>
+    cprintf("GETTOKEN: %s\n", s);
+
+  *p1 = 0;
+  80004f:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  *p2 = 0;
+  800055:	8b 45 10             	mov    0x10(%ebp),%eax
+  800058:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+
+  while (strchr(WHITESPACE, *s))
+  80005e:	eb 3a                	jmp    80009a <_gettoken+0x67>
+    return 0;
+  800060:	be 00 00 00 00       	mov    $0x0,%esi
+    if (debug > 1)
+  800065:	83 3d 00 60 80 00 01 	cmpl   $0x1,0x806000
+  80006c:	7e 59                	jle    8000c7 <_gettoken+0x94>
+      cprintf("GETTOKEN NULL\n");
+  80006e:	83 ec 0c             	sub    $0xc,%esp
+  800071:	68 80 3a 80 00       	push   $0x803a80
+  800076:	e8 e6 0a 00 00       	call   800b61 <cprintf>
+  80007b:	83 c4 10             	add    $0x10,%esp
+  80007e:	eb 47                	jmp    8000c7 <_gettoken+0x94>
+    cprintf("GETTOKEN: %s\n", s);
+  800080:	83 ec 08             	sub    $0x8,%esp
+  800083:	53                   	push   %ebx
+  800084:	68 8f 3a 80 00       	push   $0x803a8f
+  800089:	e8 d3 0a 00 00       	call   800b61 <cprintf>
+  80008e:	83 c4 10             	add    $0x10,%esp
+  800091:	eb bc                	jmp    80004f <_gettoken+0x1c>
+    *s++ = 0;
+  800093:	83 c3 01             	add    $0x1,%ebx
+  800096:	c6 43 ff 00          	movb   $0x0,-0x1(%ebx)
+  while (strchr(WHITESPACE, *s))
+  80009a:	83 ec 08             	sub    $0x8,%esp
+  80009d:	0f be 03             	movsbl (%ebx),%eax
+  8000a0:	50                   	push   %eax
+  8000a1:	68 9d 3a 80 00       	push   $0x803a9d
+  8000a6:	e8 71 12 00 00       	call   80131c <strchr>
+  8000ab:	83 c4 10             	add    $0x10,%esp
+  8000ae:	85 c0                	test   %eax,%eax
+  8000b0:	75 e1                	jne    800093 <_gettoken+0x60>
+  if (*s == 0) {
+  8000b2:	0f b6 03             	movzbl (%ebx),%eax
+  8000b5:	84 c0                	test   %al,%al
+  8000b7:	75 2a                	jne    8000e3 <_gettoken+0xb0>
+    if (debug > 1)
+      cprintf("EOL\n");
+    return 0;
+  8000b9:	be 00 00 00 00       	mov    $0x0,%esi
+    if (debug > 1)
+  8000be:	83 3d 00 60 80 00 01 	cmpl   $0x1,0x806000
+  8000c5:	7f 0a                	jg     8000d1 <_gettoken+0x9e>
+    **p2 = 0;
+    cprintf("WORD: %s\n", *p1);
+    **p2 = t;
+  }
+  return 'w';
+}
+  8000c7:	89 f0                	mov    %esi,%eax
+  8000c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000cc:	5b                   	pop    %ebx
+  8000cd:	5e                   	pop    %esi
+  8000ce:	5f                   	pop    %edi
+  8000cf:	5d                   	pop    %ebp
+  8000d0:	c3                   	ret
+      cprintf("EOL\n");
+  8000d1:	83 ec 0c             	sub    $0xc,%esp
+  8000d4:	68 a2 3a 80 00       	push   $0x803aa2
+  8000d9:	e8 83 0a 00 00       	call   800b61 <cprintf>
+  8000de:	83 c4 10             	add    $0x10,%esp
+  8000e1:	eb e4                	jmp    8000c7 <_gettoken+0x94>
+  if (strchr(SYMBOLS, *s)) {
+  8000e3:	83 ec 08             	sub    $0x8,%esp
+  8000e6:	0f be c0             	movsbl %al,%eax
+  8000e9:	50                   	push   %eax
+  8000ea:	68 b3 3a 80 00       	push   $0x803ab3
+  8000ef:	e8 28 12 00 00       	call   80131c <strchr>
+  8000f4:	83 c4 10             	add    $0x10,%esp
+  8000f7:	85 c0                	test   %eax,%eax
+  8000f9:	74 2c                	je     800127 <_gettoken+0xf4>
+    t = *s;
+  8000fb:	0f be 33             	movsbl (%ebx),%esi
+    *p1 = s;
+  8000fe:	89 1f                	mov    %ebx,(%edi)
+    *s++ = 0;
+  800100:	c6 03 00             	movb   $0x0,(%ebx)
+  800103:	83 c3 01             	add    $0x1,%ebx
+  800106:	8b 45 10             	mov    0x10(%ebp),%eax
+  800109:	89 18                	mov    %ebx,(%eax)
+    if (debug > 1)
+  80010b:	83 3d 00 60 80 00 01 	cmpl   $0x1,0x806000
+  800112:	7e b3                	jle    8000c7 <_gettoken+0x94>
+      cprintf("TOK %c\n", t);
+  800114:	83 ec 08             	sub    $0x8,%esp
+  800117:	56                   	push   %esi
+  800118:	68 a7 3a 80 00       	push   $0x803aa7
+  80011d:	e8 3f 0a 00 00       	call   800b61 <cprintf>
+  800122:	83 c4 10             	add    $0x10,%esp
+  800125:	eb a0                	jmp    8000c7 <_gettoken+0x94>
+  *p1 = s;
+  800127:	89 1f                	mov    %ebx,(%edi)
+  while (*s && !strchr(WHITESPACE SYMBOLS, *s))
+  800129:	eb 03                	jmp    80012e <_gettoken+0xfb>
+    s++;
+  80012b:	83 c3 01             	add    $0x1,%ebx
+  while (*s && !strchr(WHITESPACE SYMBOLS, *s))
+  80012e:	0f b6 03             	movzbl (%ebx),%eax
+  800131:	84 c0                	test   %al,%al
+  800133:	74 18                	je     80014d <_gettoken+0x11a>
+  800135:	83 ec 08             	sub    $0x8,%esp
+  800138:	0f be c0             	movsbl %al,%eax
+  80013b:	50                   	push   %eax
+  80013c:	68 af 3a 80 00       	push   $0x803aaf
+  800141:	e8 d6 11 00 00       	call   80131c <strchr>
+  800146:	83 c4 10             	add    $0x10,%esp
+  800149:	85 c0                	test   %eax,%eax
+  80014b:	74 de                	je     80012b <_gettoken+0xf8>
+  *p2 = s;
+  80014d:	8b 45 10             	mov    0x10(%ebp),%eax
+  800150:	89 18                	mov    %ebx,(%eax)
+  return 'w';
+  800152:	be 77 00 00 00       	mov    $0x77,%esi
+  if (debug > 1) {
+  800157:	83 3d 00 60 80 00 01 	cmpl   $0x1,0x806000
+  80015e:	0f 8e 63 ff ff ff    	jle    8000c7 <_gettoken+0x94>
+    t = **p2;
+  800164:	0f b6 33             	movzbl (%ebx),%esi
+    **p2 = 0;
+  800167:	c6 03 00             	movb   $0x0,(%ebx)
+    cprintf("WORD: %s\n", *p1);
+  80016a:	83 ec 08             	sub    $0x8,%esp
+  80016d:	ff 37                	push   (%edi)
+  80016f:	68 bb 3a 80 00       	push   $0x803abb
+  800174:	e8 e8 09 00 00       	call   800b61 <cprintf>
+    **p2 = t;
+  800179:	8b 45 10             	mov    0x10(%ebp),%eax
+  80017c:	8b 00                	mov    (%eax),%eax
+  80017e:	89 f2                	mov    %esi,%edx
+  800180:	88 10                	mov    %dl,(%eax)
+  800182:	83 c4 10             	add    $0x10,%esp
+  return 'w';
+  800185:	be 77 00 00 00       	mov    $0x77,%esi
+  80018a:	e9 38 ff ff ff       	jmp    8000c7 <_gettoken+0x94>
+
+0080018f <gettoken>:
+
+int
+gettoken(char *s, char **p1) {
+  80018f:	55                   	push   %ebp
+  800190:	89 e5                	mov    %esp,%ebp
+  800192:	83 ec 08             	sub    $0x8,%esp
+  800195:	8b 45 08             	mov    0x8(%ebp),%eax
+  static int c, nc;
+  static char *np1, *np2;
+
+  if (s) {
+  800198:	85 c0                	test   %eax,%eax
+  80019a:	74 22                	je     8001be <gettoken+0x2f>
+    nc = _gettoken(s, &np1, &np2);
+  80019c:	83 ec 04             	sub    $0x4,%esp
+  80019f:	68 0c 60 80 00       	push   $0x80600c
+  8001a4:	68 10 60 80 00       	push   $0x806010
+  8001a9:	50                   	push   %eax
+  8001aa:	e8 84 fe ff ff       	call   800033 <_gettoken>
+  8001af:	a3 08 60 80 00       	mov    %eax,0x806008
+    return 0;
+  8001b4:	83 c4 10             	add    $0x10,%esp
+  8001b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  }
+  c = nc;
+  *p1 = np1;
+  nc = _gettoken(np2, &np1, &np2);
+  return c;
+}
+  8001bc:	c9                   	leave
+  8001bd:	c3                   	ret
+  c = nc;
+  8001be:	a1 08 60 80 00       	mov    0x806008,%eax
+  8001c3:	a3 04 60 80 00       	mov    %eax,0x806004
+  *p1 = np1;
+  8001c8:	8b 15 10 60 80 00    	mov    0x806010,%edx
+  8001ce:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8001d1:	89 10                	mov    %edx,(%eax)
+  nc = _gettoken(np2, &np1, &np2);
+  8001d3:	83 ec 04             	sub    $0x4,%esp
+  8001d6:	68 0c 60 80 00       	push   $0x80600c
+  8001db:	68 10 60 80 00       	push   $0x806010
+  8001e0:	ff 35 0c 60 80 00    	push   0x80600c
+  8001e6:	e8 48 fe ff ff       	call   800033 <_gettoken>
+  8001eb:	a3 08 60 80 00       	mov    %eax,0x806008
+  return c;
+  8001f0:	a1 04 60 80 00       	mov    0x806004,%eax
+  8001f5:	83 c4 10             	add    $0x10,%esp
+  8001f8:	eb c2                	jmp    8001bc <gettoken+0x2d>
+
+008001fa <runcmd>:
+runcmd(char *s) {
+  8001fa:	55                   	push   %ebp
+  8001fb:	89 e5                	mov    %esp,%ebp
+  8001fd:	57                   	push   %edi
+  8001fe:	56                   	push   %esi
+  8001ff:	53                   	push   %ebx
+  800200:	81 ec 74 04 00 00    	sub    $0x474,%esp
+  gettoken(s, 0);
+  800206:	6a 00                	push   $0x0
+  800208:	ff 75 08             	push   0x8(%ebp)
+  80020b:	e8 7f ff ff ff       	call   80018f <gettoken>
+  800210:	83 c4 10             	add    $0x10,%esp
+    switch ((c = gettoken(0, &t))) {
+  800213:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+  argc = 0;
+  800216:	bb 00 00 00 00       	mov    $0x0,%ebx
+    switch ((c = gettoken(0, &t))) {
+  80021b:	83 ec 08             	sub    $0x8,%esp
+  80021e:	56                   	push   %esi
+  80021f:	6a 00                	push   $0x0
+  800221:	e8 69 ff ff ff       	call   80018f <gettoken>
+  800226:	89 c7                	mov    %eax,%edi
+  800228:	83 c4 10             	add    $0x10,%esp
+  80022b:	83 f8 3e             	cmp    $0x3e,%eax
+  80022e:	0f 84 3f 01 00 00    	je     800373 <runcmd+0x179>
+  800234:	7f 53                	jg     800289 <runcmd+0x8f>
+  800236:	85 c0                	test   %eax,%eax
+  800238:	0f 84 36 02 00 00    	je     800474 <runcmd+0x27a>
+  80023e:	83 f8 3c             	cmp    $0x3c,%eax
+  800241:	0f 85 09 03 00 00    	jne    800550 <runcmd+0x356>
+        if (gettoken(0, &t) != 'w') {
+  800247:	83 ec 08             	sub    $0x8,%esp
+  80024a:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+  80024d:	50                   	push   %eax
+  80024e:	6a 00                	push   $0x0
+  800250:	e8 3a ff ff ff       	call   80018f <gettoken>
+  800255:	83 c4 10             	add    $0x10,%esp
+  800258:	83 f8 77             	cmp    $0x77,%eax
+  80025b:	0f 85 c1 00 00 00    	jne    800322 <runcmd+0x128>
+        if ((fd = open(t, O_RDONLY)) < 0) {
+  800261:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  800264:	89 85 94 fb ff ff    	mov    %eax,-0x46c(%ebp)
+  80026a:	83 ec 08             	sub    $0x8,%esp
+  80026d:	6a 00                	push   $0x0
+  80026f:	50                   	push   %eax
+  800270:	e8 00 22 00 00       	call   802475 <open>
+  800275:	89 c7                	mov    %eax,%edi
+  800277:	83 c4 10             	add    $0x10,%esp
+  80027a:	85 c0                	test   %eax,%eax
+  80027c:	0f 88 ba 00 00 00    	js     80033c <runcmd+0x142>
+        if (fd != 0) {
+  800282:	74 97                	je     80021b <runcmd+0x21>
+  800284:	e9 cf 00 00 00       	jmp    800358 <runcmd+0x15e>
+    switch ((c = gettoken(0, &t))) {
+  800289:	83 f8 77             	cmp    $0x77,%eax
+  80028c:	74 69                	je     8002f7 <runcmd+0xfd>
+  80028e:	83 f8 7c             	cmp    $0x7c,%eax
+  800291:	0f 85 b9 02 00 00    	jne    800550 <runcmd+0x356>
+        if ((r = pipe(p)) < 0) {
+  800297:	83 ec 0c             	sub    $0xc,%esp
+  80029a:	8d 85 9c fb ff ff    	lea    -0x464(%ebp),%eax
+  8002a0:	50                   	push   %eax
+  8002a1:	e8 9a 2f 00 00       	call   803240 <pipe>
+  8002a6:	83 c4 10             	add    $0x10,%esp
+  8002a9:	85 c0                	test   %eax,%eax
+  8002ab:	0f 88 51 01 00 00    	js     800402 <runcmd+0x208>
+        if (debug)
+  8002b1:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  8002b8:	0f 85 5f 01 00 00    	jne    80041d <runcmd+0x223>
+        if ((r = fork()) < 0) {
+  8002be:	e8 01 17 00 00       	call   8019c4 <fork>
+  8002c3:	89 c7                	mov    %eax,%edi
+  8002c5:	85 c0                	test   %eax,%eax
+  8002c7:	0f 88 71 01 00 00    	js     80043e <runcmd+0x244>
+        if (r == 0) {
+  8002cd:	0f 85 81 01 00 00    	jne    800454 <runcmd+0x25a>
+          if (p[0] != 0) {
+  8002d3:	8b 85 9c fb ff ff    	mov    -0x464(%ebp),%eax
+  8002d9:	85 c0                	test   %eax,%eax
+  8002db:	0f 85 2d 02 00 00    	jne    80050e <runcmd+0x314>
+          close(p[1]);
+  8002e1:	83 ec 0c             	sub    $0xc,%esp
+  8002e4:	ff b5 a0 fb ff ff    	push   -0x460(%ebp)
+  8002ea:	e8 e7 1b 00 00       	call   801ed6 <close>
+          goto again;
+  8002ef:	83 c4 10             	add    $0x10,%esp
+  8002f2:	e9 1f ff ff ff       	jmp    800216 <runcmd+0x1c>
+        if (argc == MAXARGS) {
+  8002f7:	83 fb 10             	cmp    $0x10,%ebx
+  8002fa:	74 0f                	je     80030b <runcmd+0x111>
+        argv[argc++] = t;
+  8002fc:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  8002ff:	89 44 9d a8          	mov    %eax,-0x58(%ebp,%ebx,4)
+  800303:	8d 5b 01             	lea    0x1(%ebx),%ebx
+        break;
+  800306:	e9 10 ff ff ff       	jmp    80021b <runcmd+0x21>
+          cprintf("too many arguments\n");
+  80030b:	83 ec 0c             	sub    $0xc,%esp
+  80030e:	68 c5 3a 80 00       	push   $0x803ac5
+  800313:	e8 49 08 00 00       	call   800b61 <cprintf>
+          exit();
+  800318:	e8 4f 07 00 00       	call   800a6c <exit>
+  80031d:	83 c4 10             	add    $0x10,%esp
+  800320:	eb da                	jmp    8002fc <runcmd+0x102>
+          cprintf("syntax error: < not followed by word\n");
+  800322:	83 ec 0c             	sub    $0xc,%esp
+  800325:	68 18 3c 80 00       	push   $0x803c18
+  80032a:	e8 32 08 00 00       	call   800b61 <cprintf>
+          exit();
+  80032f:	e8 38 07 00 00       	call   800a6c <exit>
+  800334:	83 c4 10             	add    $0x10,%esp
+  800337:	e9 25 ff ff ff       	jmp    800261 <runcmd+0x67>
+          cprintf("open %s for read: %e", t, fd);
+  80033c:	83 ec 04             	sub    $0x4,%esp
+  80033f:	50                   	push   %eax
+  800340:	ff b5 94 fb ff ff    	push   -0x46c(%ebp)
+  800346:	68 d9 3a 80 00       	push   $0x803ad9
+  80034b:	e8 11 08 00 00       	call   800b61 <cprintf>
+          exit();
+  800350:	e8 17 07 00 00       	call   800a6c <exit>
+  800355:	83 c4 10             	add    $0x10,%esp
+          dup(fd, 0);
+  800358:	83 ec 08             	sub    $0x8,%esp
+  80035b:	6a 00                	push   $0x0
+  80035d:	57                   	push   %edi
+  80035e:	e8 c5 1b 00 00       	call   801f28 <dup>
+          close(fd);
+  800363:	89 3c 24             	mov    %edi,(%esp)
+  800366:	e8 6b 1b 00 00       	call   801ed6 <close>
+  80036b:	83 c4 10             	add    $0x10,%esp
+  80036e:	e9 a8 fe ff ff       	jmp    80021b <runcmd+0x21>
+        if (gettoken(0, &t) != 'w') {
+  800373:	83 ec 08             	sub    $0x8,%esp
+  800376:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+  800379:	50                   	push   %eax
+  80037a:	6a 00                	push   $0x0
+  80037c:	e8 0e fe ff ff       	call   80018f <gettoken>
+  800381:	83 c4 10             	add    $0x10,%esp
+  800384:	83 f8 77             	cmp    $0x77,%eax
+  800387:	75 2b                	jne    8003b4 <runcmd+0x1ba>
+        if ((fd = open(t, O_WRONLY | O_CREAT | O_TRUNC)) < 0) {
+  800389:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  80038c:	89 85 94 fb ff ff    	mov    %eax,-0x46c(%ebp)
+  800392:	83 ec 08             	sub    $0x8,%esp
+  800395:	68 01 03 00 00       	push   $0x301
+  80039a:	50                   	push   %eax
+  80039b:	e8 d5 20 00 00       	call   802475 <open>
+  8003a0:	89 c7                	mov    %eax,%edi
+  8003a2:	83 c4 10             	add    $0x10,%esp
+  8003a5:	85 c0                	test   %eax,%eax
+  8003a7:	78 22                	js     8003cb <runcmd+0x1d1>
+        if (fd != 1) {
+  8003a9:	83 f8 01             	cmp    $0x1,%eax
+  8003ac:	0f 84 69 fe ff ff    	je     80021b <runcmd+0x21>
+  8003b2:	eb 33                	jmp    8003e7 <runcmd+0x1ed>
+          cprintf("syntax error: > not followed by word\n");
+  8003b4:	83 ec 0c             	sub    $0xc,%esp
+  8003b7:	68 40 3c 80 00       	push   $0x803c40
+  8003bc:	e8 a0 07 00 00       	call   800b61 <cprintf>
+          exit();
+  8003c1:	e8 a6 06 00 00       	call   800a6c <exit>
+  8003c6:	83 c4 10             	add    $0x10,%esp
+  8003c9:	eb be                	jmp    800389 <runcmd+0x18f>
+          cprintf("open %s for write: %e", t, fd);
+  8003cb:	83 ec 04             	sub    $0x4,%esp
+  8003ce:	50                   	push   %eax
+  8003cf:	ff b5 94 fb ff ff    	push   -0x46c(%ebp)
+  8003d5:	68 ee 3a 80 00       	push   $0x803aee
+  8003da:	e8 82 07 00 00       	call   800b61 <cprintf>
+          exit();
+  8003df:	e8 88 06 00 00       	call   800a6c <exit>
+  8003e4:	83 c4 10             	add    $0x10,%esp
+          dup(fd, 1);
+  8003e7:	83 ec 08             	sub    $0x8,%esp
+  8003ea:	6a 01                	push   $0x1
+  8003ec:	57                   	push   %edi
+  8003ed:	e8 36 1b 00 00       	call   801f28 <dup>
+          close(fd);
+  8003f2:	89 3c 24             	mov    %edi,(%esp)
+  8003f5:	e8 dc 1a 00 00       	call   801ed6 <close>
+  8003fa:	83 c4 10             	add    $0x10,%esp
+  8003fd:	e9 19 fe ff ff       	jmp    80021b <runcmd+0x21>
+          cprintf("pipe: %e", r);
+  800402:	83 ec 08             	sub    $0x8,%esp
+  800405:	50                   	push   %eax
+  800406:	68 04 3b 80 00       	push   $0x803b04
+  80040b:	e8 51 07 00 00       	call   800b61 <cprintf>
+          exit();
+  800410:	e8 57 06 00 00       	call   800a6c <exit>
+  800415:	83 c4 10             	add    $0x10,%esp
+  800418:	e9 94 fe ff ff       	jmp    8002b1 <runcmd+0xb7>
+          cprintf("PIPE: %d %d\n", p[0], p[1]);
+  80041d:	83 ec 04             	sub    $0x4,%esp
+  800420:	ff b5 a0 fb ff ff    	push   -0x460(%ebp)
+  800426:	ff b5 9c fb ff ff    	push   -0x464(%ebp)
+  80042c:	68 0d 3b 80 00       	push   $0x803b0d
+  800431:	e8 2b 07 00 00       	call   800b61 <cprintf>
+  800436:	83 c4 10             	add    $0x10,%esp
+  800439:	e9 80 fe ff ff       	jmp    8002be <runcmd+0xc4>
+          cprintf("fork: %e", r);
+  80043e:	83 ec 08             	sub    $0x8,%esp
+  800441:	50                   	push   %eax
+  800442:	68 1a 3b 80 00       	push   $0x803b1a
+  800447:	e8 15 07 00 00       	call   800b61 <cprintf>
+          exit();
+  80044c:	e8 1b 06 00 00       	call   800a6c <exit>
+  800451:	83 c4 10             	add    $0x10,%esp
+          if (p[1] != 1) {
+  800454:	8b 85 a0 fb ff ff    	mov    -0x460(%ebp),%eax
+  80045a:	83 f8 01             	cmp    $0x1,%eax
+  80045d:	0f 85 cc 00 00 00    	jne    80052f <runcmd+0x335>
+          close(p[0]);
+  800463:	83 ec 0c             	sub    $0xc,%esp
+  800466:	ff b5 9c fb ff ff    	push   -0x464(%ebp)
+  80046c:	e8 65 1a 00 00       	call   801ed6 <close>
+          goto runit;
+  800471:	83 c4 10             	add    $0x10,%esp
+  if (argc == 0) {
+  800474:	85 db                	test   %ebx,%ebx
+  800476:	0f 84 e6 00 00 00    	je     800562 <runcmd+0x368>
+  if (argv[0][0] != '/') {
+  80047c:	8b 45 a8             	mov    -0x58(%ebp),%eax
+  80047f:	80 38 2f             	cmpb   $0x2f,(%eax)
+  800482:	0f 85 f5 00 00 00    	jne    80057d <runcmd+0x383>
+  argv[argc] = 0;
+  800488:	c7 44 9d a8 00 00 00 	movl   $0x0,-0x58(%ebp,%ebx,4)
+  80048f:	00 
+  if (debug) {
+  800490:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  800497:	0f 85 08 01 00 00    	jne    8005a5 <runcmd+0x3ab>
+  if ((r = spawn(argv[0], (const char **) argv)) < 0)
+  80049d:	83 ec 08             	sub    $0x8,%esp
+  8004a0:	8d 45 a8             	lea    -0x58(%ebp),%eax
+  8004a3:	50                   	push   %eax
+  8004a4:	ff 75 a8             	push   -0x58(%ebp)
+  8004a7:	e8 82 21 00 00       	call   80262e <spawn>
+  8004ac:	89 c3                	mov    %eax,%ebx
+  8004ae:	83 c4 10             	add    $0x10,%esp
+  8004b1:	85 c0                	test   %eax,%eax
+  8004b3:	0f 88 3a 01 00 00    	js     8005f3 <runcmd+0x3f9>
+  close_all();
+  8004b9:	e8 45 1a 00 00       	call   801f03 <close_all>
+    if (debug)
+  8004be:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  8004c5:	0f 85 75 01 00 00    	jne    800640 <runcmd+0x446>
+    wait(r);
+  8004cb:	83 ec 0c             	sub    $0xc,%esp
+  8004ce:	53                   	push   %ebx
+  8004cf:	e8 e9 2e 00 00       	call   8033bd <wait>
+    if (debug)
+  8004d4:	83 c4 10             	add    $0x10,%esp
+  8004d7:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  8004de:	0f 85 7b 01 00 00    	jne    80065f <runcmd+0x465>
+  if (pipe_child) {
+  8004e4:	85 ff                	test   %edi,%edi
+  8004e6:	74 19                	je     800501 <runcmd+0x307>
+    wait(pipe_child);
+  8004e8:	83 ec 0c             	sub    $0xc,%esp
+  8004eb:	57                   	push   %edi
+  8004ec:	e8 cc 2e 00 00       	call   8033bd <wait>
+    if (debug)
+  8004f1:	83 c4 10             	add    $0x10,%esp
+  8004f4:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  8004fb:	0f 85 79 01 00 00    	jne    80067a <runcmd+0x480>
+  exit();
+  800501:	e8 66 05 00 00       	call   800a6c <exit>
+}
+  800506:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800509:	5b                   	pop    %ebx
+  80050a:	5e                   	pop    %esi
+  80050b:	5f                   	pop    %edi
+  80050c:	5d                   	pop    %ebp
+  80050d:	c3                   	ret
+            dup(p[0], 0);
+  80050e:	83 ec 08             	sub    $0x8,%esp
+  800511:	6a 00                	push   $0x0
+  800513:	50                   	push   %eax
+  800514:	e8 0f 1a 00 00       	call   801f28 <dup>
+            close(p[0]);
+  800519:	83 c4 04             	add    $0x4,%esp
+  80051c:	ff b5 9c fb ff ff    	push   -0x464(%ebp)
+  800522:	e8 af 19 00 00       	call   801ed6 <close>
+  800527:	83 c4 10             	add    $0x10,%esp
+  80052a:	e9 b2 fd ff ff       	jmp    8002e1 <runcmd+0xe7>
+            dup(p[1], 1);
+  80052f:	83 ec 08             	sub    $0x8,%esp
+  800532:	6a 01                	push   $0x1
+  800534:	50                   	push   %eax
+  800535:	e8 ee 19 00 00       	call   801f28 <dup>
+            close(p[1]);
+  80053a:	83 c4 04             	add    $0x4,%esp
+  80053d:	ff b5 a0 fb ff ff    	push   -0x460(%ebp)
+  800543:	e8 8e 19 00 00       	call   801ed6 <close>
+  800548:	83 c4 10             	add    $0x10,%esp
+  80054b:	e9 13 ff ff ff       	jmp    800463 <runcmd+0x269>
+        panic("bad return %d from gettoken", c);
+  800550:	57                   	push   %edi
+  800551:	68 23 3b 80 00       	push   $0x803b23
+  800556:	6a 75                	push   $0x75
+  800558:	68 3f 3b 80 00       	push   $0x803b3f
+  80055d:	e8 24 05 00 00       	call   800a86 <_panic>
+    if (debug)
+  800562:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  800569:	74 9b                	je     800506 <runcmd+0x30c>
+      cprintf("EMPTY COMMAND\n");
+  80056b:	83 ec 0c             	sub    $0xc,%esp
+  80056e:	68 49 3b 80 00       	push   $0x803b49
+  800573:	e8 e9 05 00 00       	call   800b61 <cprintf>
+  800578:	83 c4 10             	add    $0x10,%esp
+    return;
+  80057b:	eb 89                	jmp    800506 <runcmd+0x30c>
+    argv0buf[0] = '/';
+  80057d:	c6 85 a4 fb ff ff 2f 	movb   $0x2f,-0x45c(%ebp)
+    strcpy(argv0buf + 1, argv[0]);
+  800584:	83 ec 08             	sub    $0x8,%esp
+  800587:	50                   	push   %eax
+  800588:	8d b5 a4 fb ff ff    	lea    -0x45c(%ebp),%esi
+  80058e:	8d 85 a5 fb ff ff    	lea    -0x45b(%ebp),%eax
+  800594:	50                   	push   %eax
+  800595:	e8 70 0c 00 00       	call   80120a <strcpy>
+    argv[0] = argv0buf;
+  80059a:	89 75 a8             	mov    %esi,-0x58(%ebp)
+  80059d:	83 c4 10             	add    $0x10,%esp
+  8005a0:	e9 e3 fe ff ff       	jmp    800488 <runcmd+0x28e>
+    cprintf("[%08x] SPAWN:", thisenv->env_id);
+  8005a5:	a1 28 64 80 00       	mov    0x806428,%eax
+  8005aa:	8b 40 48             	mov    0x48(%eax),%eax
+  8005ad:	83 ec 08             	sub    $0x8,%esp
+  8005b0:	50                   	push   %eax
+  8005b1:	68 58 3b 80 00       	push   $0x803b58
+  8005b6:	e8 a6 05 00 00       	call   800b61 <cprintf>
+    for (i = 0; argv[i]; i++)
+  8005bb:	8d 5d a8             	lea    -0x58(%ebp),%ebx
+  8005be:	83 c4 10             	add    $0x10,%esp
+  8005c1:	eb 11                	jmp    8005d4 <runcmd+0x3da>
+      cprintf(" %s", argv[i]);
+  8005c3:	83 ec 08             	sub    $0x8,%esp
+  8005c6:	50                   	push   %eax
+  8005c7:	68 e0 3b 80 00       	push   $0x803be0
+  8005cc:	e8 90 05 00 00       	call   800b61 <cprintf>
+  8005d1:	83 c4 10             	add    $0x10,%esp
+    for (i = 0; argv[i]; i++)
+  8005d4:	83 c3 04             	add    $0x4,%ebx
+  8005d7:	8b 43 fc             	mov    -0x4(%ebx),%eax
+  8005da:	85 c0                	test   %eax,%eax
+  8005dc:	75 e5                	jne    8005c3 <runcmd+0x3c9>
+    cprintf("\n");
+  8005de:	83 ec 0c             	sub    $0xc,%esp
+  8005e1:	68 a0 3a 80 00       	push   $0x803aa0
+  8005e6:	e8 76 05 00 00       	call   800b61 <cprintf>
+  8005eb:	83 c4 10             	add    $0x10,%esp
+  8005ee:	e9 aa fe ff ff       	jmp    80049d <runcmd+0x2a3>
+    cprintf("spawn %s: %e\n", argv[0], r);
+  8005f3:	83 ec 04             	sub    $0x4,%esp
+  8005f6:	50                   	push   %eax
+  8005f7:	ff 75 a8             	push   -0x58(%ebp)
+  8005fa:	68 66 3b 80 00       	push   $0x803b66
+  8005ff:	e8 5d 05 00 00       	call   800b61 <cprintf>
+  close_all();
+  800604:	e8 fa 18 00 00       	call   801f03 <close_all>
+  if (r >= 0) {
+  800609:	83 c4 10             	add    $0x10,%esp
+  if (pipe_child) {
+  80060c:	85 ff                	test   %edi,%edi
+  80060e:	0f 84 ed fe ff ff    	je     800501 <runcmd+0x307>
+    if (debug)
+  800614:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  80061b:	0f 84 c7 fe ff ff    	je     8004e8 <runcmd+0x2ee>
+      cprintf("[%08x] WAIT pipe_child %08x\n", thisenv->env_id, pipe_child);
+  800621:	a1 28 64 80 00       	mov    0x806428,%eax
+  800626:	8b 40 48             	mov    0x48(%eax),%eax
+  800629:	83 ec 04             	sub    $0x4,%esp
+  80062c:	57                   	push   %edi
+  80062d:	50                   	push   %eax
+  80062e:	68 9f 3b 80 00       	push   $0x803b9f
+  800633:	e8 29 05 00 00       	call   800b61 <cprintf>
+  800638:	83 c4 10             	add    $0x10,%esp
+  80063b:	e9 a8 fe ff ff       	jmp    8004e8 <runcmd+0x2ee>
+      cprintf("[%08x] WAIT %s %08x\n", thisenv->env_id, argv[0], r);
+  800640:	a1 28 64 80 00       	mov    0x806428,%eax
+  800645:	8b 40 48             	mov    0x48(%eax),%eax
+  800648:	53                   	push   %ebx
+  800649:	ff 75 a8             	push   -0x58(%ebp)
+  80064c:	50                   	push   %eax
+  80064d:	68 74 3b 80 00       	push   $0x803b74
+  800652:	e8 0a 05 00 00       	call   800b61 <cprintf>
+  800657:	83 c4 10             	add    $0x10,%esp
+  80065a:	e9 6c fe ff ff       	jmp    8004cb <runcmd+0x2d1>
+      cprintf("[%08x] wait finished\n", thisenv->env_id);
+  80065f:	a1 28 64 80 00       	mov    0x806428,%eax
+  800664:	8b 40 48             	mov    0x48(%eax),%eax
+  800667:	83 ec 08             	sub    $0x8,%esp
+  80066a:	50                   	push   %eax
+  80066b:	68 89 3b 80 00       	push   $0x803b89
+  800670:	e8 ec 04 00 00       	call   800b61 <cprintf>
+  800675:	83 c4 10             	add    $0x10,%esp
+  800678:	eb 92                	jmp    80060c <runcmd+0x412>
+      cprintf("[%08x] wait finished\n", thisenv->env_id);
+  80067a:	a1 28 64 80 00       	mov    0x806428,%eax
+  80067f:	8b 40 48             	mov    0x48(%eax),%eax
+  800682:	83 ec 08             	sub    $0x8,%esp
+  800685:	50                   	push   %eax
+  800686:	68 89 3b 80 00       	push   $0x803b89
+  80068b:	e8 d1 04 00 00       	call   800b61 <cprintf>
+  800690:	83 c4 10             	add    $0x10,%esp
+  800693:	e9 69 fe ff ff       	jmp    800501 <runcmd+0x307>
+
+00800698 <usage>:
+
+
+void
+usage(void) {
+  800698:	55                   	push   %ebp
+  800699:	89 e5                	mov    %esp,%ebp
+  80069b:	83 ec 14             	sub    $0x14,%esp
+  cprintf("usage: sh [-dix] [command-file]\n");
+  80069e:	68 68 3c 80 00       	push   $0x803c68
+  8006a3:	e8 b9 04 00 00       	call   800b61 <cprintf>
+  exit();
+  8006a8:	e8 bf 03 00 00       	call   800a6c <exit>
+}
+  8006ad:	83 c4 10             	add    $0x10,%esp
+  8006b0:	c9                   	leave
+  8006b1:	c3                   	ret
+
+008006b2 <umain>:
+
+void
+umain(int argc, char **argv) {
+  8006b2:	55                   	push   %ebp
+  8006b3:	89 e5                	mov    %esp,%ebp
+  8006b5:	57                   	push   %edi
+  8006b6:	56                   	push   %esi
+  8006b7:	53                   	push   %ebx
+  8006b8:	83 ec 30             	sub    $0x30,%esp
+  int r, interactive, echocmds;
+  struct Argstate args;
+
+  interactive = '?';
+  echocmds = 0;
+  argstart(&argc, argv, &args);
+  8006bb:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  8006be:	50                   	push   %eax
+  8006bf:	ff 75 0c             	push   0xc(%ebp)
+  8006c2:	8d 45 08             	lea    0x8(%ebp),%eax
+  8006c5:	50                   	push   %eax
+  8006c6:	e8 15 15 00 00       	call   801be0 <argstart>
+  while ((r = argnext(&args)) >= 0)
+  8006cb:	83 c4 10             	add    $0x10,%esp
+  echocmds = 0;
+  8006ce:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  interactive = '?';
+  8006d5:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  while ((r = argnext(&args)) >= 0)
+  8006da:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    switch (r) {
+      case 'd':
+        debug++;
+        break;
+      case 'i':
+        interactive = 1;
+  8006dd:	be 01 00 00 00       	mov    $0x1,%esi
+  while ((r = argnext(&args)) >= 0)
+  8006e2:	eb 10                	jmp    8006f4 <umain+0x42>
+        debug++;
+  8006e4:	83 05 00 60 80 00 01 	addl   $0x1,0x806000
+        break;
+  8006eb:	eb 07                	jmp    8006f4 <umain+0x42>
+        interactive = 1;
+  8006ed:	89 f7                	mov    %esi,%edi
+  8006ef:	eb 03                	jmp    8006f4 <umain+0x42>
+    switch (r) {
+  8006f1:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  while ((r = argnext(&args)) >= 0)
+  8006f4:	83 ec 0c             	sub    $0xc,%esp
+  8006f7:	53                   	push   %ebx
+  8006f8:	e8 13 15 00 00       	call   801c10 <argnext>
+  8006fd:	83 c4 10             	add    $0x10,%esp
+  800700:	85 c0                	test   %eax,%eax
+  800702:	78 16                	js     80071a <umain+0x68>
+    switch (r) {
+  800704:	83 f8 69             	cmp    $0x69,%eax
+  800707:	74 e4                	je     8006ed <umain+0x3b>
+  800709:	83 f8 78             	cmp    $0x78,%eax
+  80070c:	74 e3                	je     8006f1 <umain+0x3f>
+  80070e:	83 f8 64             	cmp    $0x64,%eax
+  800711:	74 d1                	je     8006e4 <umain+0x32>
+        break;
+      case 'x':
+        echocmds = 1;
+        break;
+      default:
+        usage();
+  800713:	e8 80 ff ff ff       	call   800698 <usage>
+  800718:	eb da                	jmp    8006f4 <umain+0x42>
+    }
+
+  if (argc > 2)
+  80071a:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+  80071e:	7f 1f                	jg     80073f <umain+0x8d>
+    usage();
+  if (argc == 2) {
+  800720:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+  800724:	74 20                	je     800746 <umain+0x94>
+    close(0);
+    if ((r = open(argv[1], O_RDONLY)) < 0)
+      panic("open %s: %e", argv[1], r);
+    assert(r == 0);
+  }
+  if (interactive == '?')
+  800726:	83 ff 3f             	cmp    $0x3f,%edi
+  800729:	74 75                	je     8007a0 <umain+0xee>
+  80072b:	85 ff                	test   %edi,%edi
+  80072d:	bf e4 3b 80 00       	mov    $0x803be4,%edi
+  800732:	b8 00 00 00 00       	mov    $0x0,%eax
+  800737:	0f 44 f8             	cmove  %eax,%edi
+  80073a:	e9 06 01 00 00       	jmp    800845 <umain+0x193>
+    usage();
+  80073f:	e8 54 ff ff ff       	call   800698 <usage>
+  800744:	eb da                	jmp    800720 <umain+0x6e>
+    close(0);
+  800746:	83 ec 0c             	sub    $0xc,%esp
+  800749:	6a 00                	push   $0x0
+  80074b:	e8 86 17 00 00       	call   801ed6 <close>
+    if ((r = open(argv[1], O_RDONLY)) < 0)
+  800750:	83 c4 08             	add    $0x8,%esp
+  800753:	6a 00                	push   $0x0
+  800755:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800758:	ff 70 04             	push   0x4(%eax)
+  80075b:	e8 15 1d 00 00       	call   802475 <open>
+  800760:	83 c4 10             	add    $0x10,%esp
+  800763:	85 c0                	test   %eax,%eax
+  800765:	78 1b                	js     800782 <umain+0xd0>
+    assert(r == 0);
+  800767:	74 bd                	je     800726 <umain+0x74>
+  800769:	68 c8 3b 80 00       	push   $0x803bc8
+  80076e:	68 cf 3b 80 00       	push   $0x803bcf
+  800773:	68 22 01 00 00       	push   $0x122
+  800778:	68 3f 3b 80 00       	push   $0x803b3f
+  80077d:	e8 04 03 00 00       	call   800a86 <_panic>
+      panic("open %s: %e", argv[1], r);
+  800782:	83 ec 0c             	sub    $0xc,%esp
+  800785:	50                   	push   %eax
+  800786:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800789:	ff 70 04             	push   0x4(%eax)
+  80078c:	68 bc 3b 80 00       	push   $0x803bbc
+  800791:	68 21 01 00 00       	push   $0x121
+  800796:	68 3f 3b 80 00       	push   $0x803b3f
+  80079b:	e8 e6 02 00 00       	call   800a86 <_panic>
+    interactive = iscons(0);
+  8007a0:	83 ec 0c             	sub    $0xc,%esp
+  8007a3:	6a 00                	push   $0x0
+  8007a5:	e8 fb 01 00 00       	call   8009a5 <iscons>
+  8007aa:	89 c7                	mov    %eax,%edi
+  8007ac:	83 c4 10             	add    $0x10,%esp
+  8007af:	e9 77 ff ff ff       	jmp    80072b <umain+0x79>
+  while (1) {
+    char *buf;
+
+    buf = readline(interactive ? "$ " : NULL);
+    if (buf == NULL) {
+      if (debug)
+  8007b4:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  8007bb:	75 0a                	jne    8007c7 <umain+0x115>
+        cprintf("EXITING\n");
+      exit();  // end of file
+  8007bd:	e8 aa 02 00 00       	call   800a6c <exit>
+  8007c2:	e9 94 00 00 00       	jmp    80085b <umain+0x1a9>
+        cprintf("EXITING\n");
+  8007c7:	83 ec 0c             	sub    $0xc,%esp
+  8007ca:	68 e7 3b 80 00       	push   $0x803be7
+  8007cf:	e8 8d 03 00 00       	call   800b61 <cprintf>
+  8007d4:	83 c4 10             	add    $0x10,%esp
+  8007d7:	eb e4                	jmp    8007bd <umain+0x10b>
+    }
+    if (debug)
+      cprintf("LINE: %s\n", buf);
+  8007d9:	83 ec 08             	sub    $0x8,%esp
+  8007dc:	53                   	push   %ebx
+  8007dd:	68 f0 3b 80 00       	push   $0x803bf0
+  8007e2:	e8 7a 03 00 00       	call   800b61 <cprintf>
+  8007e7:	83 c4 10             	add    $0x10,%esp
+  8007ea:	eb 7c                	jmp    800868 <umain+0x1b6>
+    if (buf[0] == '#')
+      continue;
+    if (echocmds)
+      printf("# %s\n", buf);
+  8007ec:	83 ec 08             	sub    $0x8,%esp
+  8007ef:	53                   	push   %ebx
+  8007f0:	68 fa 3b 80 00       	push   $0x803bfa
+  8007f5:	e8 1e 1e 00 00       	call   802618 <printf>
+  8007fa:	83 c4 10             	add    $0x10,%esp
+  8007fd:	eb 78                	jmp    800877 <umain+0x1c5>
+    if (debug)
+      cprintf("BEFORE FORK\n");
+  8007ff:	83 ec 0c             	sub    $0xc,%esp
+  800802:	68 00 3c 80 00       	push   $0x803c00
+  800807:	e8 55 03 00 00       	call   800b61 <cprintf>
+  80080c:	83 c4 10             	add    $0x10,%esp
+  80080f:	eb 73                	jmp    800884 <umain+0x1d2>
+    if ((r = fork()) < 0)
+      panic("fork: %e", r);
+  800811:	50                   	push   %eax
+  800812:	68 1a 3b 80 00       	push   $0x803b1a
+  800817:	68 39 01 00 00       	push   $0x139
+  80081c:	68 3f 3b 80 00       	push   $0x803b3f
+  800821:	e8 60 02 00 00       	call   800a86 <_panic>
+    if (debug)
+      cprintf("FORK: %d\n", r);
+  800826:	83 ec 08             	sub    $0x8,%esp
+  800829:	50                   	push   %eax
+  80082a:	68 0d 3c 80 00       	push   $0x803c0d
+  80082f:	e8 2d 03 00 00       	call   800b61 <cprintf>
+  800834:	83 c4 10             	add    $0x10,%esp
+  800837:	eb 5f                	jmp    800898 <umain+0x1e6>
+    if (r == 0) {
+      runcmd(buf);
+      exit();
+    } else
+      wait(r);
+  800839:	83 ec 0c             	sub    $0xc,%esp
+  80083c:	56                   	push   %esi
+  80083d:	e8 7b 2b 00 00       	call   8033bd <wait>
+  800842:	83 c4 10             	add    $0x10,%esp
+    buf = readline(interactive ? "$ " : NULL);
+  800845:	83 ec 0c             	sub    $0xc,%esp
+  800848:	57                   	push   %edi
+  800849:	e8 91 08 00 00       	call   8010df <readline>
+  80084e:	89 c3                	mov    %eax,%ebx
+    if (buf == NULL) {
+  800850:	83 c4 10             	add    $0x10,%esp
+  800853:	85 c0                	test   %eax,%eax
+  800855:	0f 84 59 ff ff ff    	je     8007b4 <umain+0x102>
+    if (debug)
+  80085b:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  800862:	0f 85 71 ff ff ff    	jne    8007d9 <umain+0x127>
+    if (buf[0] == '#')
+  800868:	80 3b 23             	cmpb   $0x23,(%ebx)
+  80086b:	74 d8                	je     800845 <umain+0x193>
+    if (echocmds)
+  80086d:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  800871:	0f 85 75 ff ff ff    	jne    8007ec <umain+0x13a>
+    if (debug)
+  800877:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  80087e:	0f 85 7b ff ff ff    	jne    8007ff <umain+0x14d>
+    if ((r = fork()) < 0)
+  800884:	e8 3b 11 00 00       	call   8019c4 <fork>
+  800889:	89 c6                	mov    %eax,%esi
+  80088b:	85 c0                	test   %eax,%eax
+  80088d:	78 82                	js     800811 <umain+0x15f>
+    if (debug)
+  80088f:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  800896:	75 8e                	jne    800826 <umain+0x174>
+    if (r == 0) {
+  800898:	85 f6                	test   %esi,%esi
+  80089a:	75 9d                	jne    800839 <umain+0x187>
+      runcmd(buf);
+  80089c:	83 ec 0c             	sub    $0xc,%esp
+  80089f:	53                   	push   %ebx
+  8008a0:	e8 55 f9 ff ff       	call   8001fa <runcmd>
+      exit();
+  8008a5:	e8 c2 01 00 00       	call   800a6c <exit>
+  8008aa:	83 c4 10             	add    $0x10,%esp
+  8008ad:	eb 96                	jmp    800845 <umain+0x193>
+
+008008af <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8008af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008b4:	c3                   	ret
+
+008008b5 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8008b5:	55                   	push   %ebp
+  8008b6:	89 e5                	mov    %esp,%ebp
+  8008b8:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8008bb:	68 89 3c 80 00       	push   $0x803c89
+  8008c0:	ff 75 0c             	push   0xc(%ebp)
+  8008c3:	e8 42 09 00 00       	call   80120a <strcpy>
+	return 0;
+}
+  8008c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008cd:	c9                   	leave
+  8008ce:	c3                   	ret
+
+008008cf <devcons_write>:
+{
+  8008cf:	55                   	push   %ebp
+  8008d0:	89 e5                	mov    %esp,%ebp
+  8008d2:	57                   	push   %edi
+  8008d3:	56                   	push   %esi
+  8008d4:	53                   	push   %ebx
+  8008d5:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8008db:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8008e0:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8008e6:	eb 2e                	jmp    800916 <devcons_write+0x47>
+		m = n - tot;
+  8008e8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8008eb:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8008ed:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8008f2:	39 c3                	cmp    %eax,%ebx
+  8008f4:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8008f7:	83 ec 04             	sub    $0x4,%esp
+  8008fa:	53                   	push   %ebx
+  8008fb:	89 f0                	mov    %esi,%eax
+  8008fd:	03 45 0c             	add    0xc(%ebp),%eax
+  800900:	50                   	push   %eax
+  800901:	57                   	push   %edi
+  800902:	e8 89 0a 00 00       	call   801390 <memmove>
+		sys_cputs(buf, m);
+  800907:	83 c4 08             	add    $0x8,%esp
+  80090a:	53                   	push   %ebx
+  80090b:	57                   	push   %edi
+  80090c:	e8 29 0c 00 00       	call   80153a <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  800911:	01 de                	add    %ebx,%esi
+  800913:	83 c4 10             	add    $0x10,%esp
+  800916:	3b 75 10             	cmp    0x10(%ebp),%esi
+  800919:	72 cd                	jb     8008e8 <devcons_write+0x19>
+}
+  80091b:	89 f0                	mov    %esi,%eax
+  80091d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800920:	5b                   	pop    %ebx
+  800921:	5e                   	pop    %esi
+  800922:	5f                   	pop    %edi
+  800923:	5d                   	pop    %ebp
+  800924:	c3                   	ret
+
+00800925 <devcons_read>:
+{
+  800925:	55                   	push   %ebp
+  800926:	89 e5                	mov    %esp,%ebp
+  800928:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80092b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800930:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  800934:	75 07                	jne    80093d <devcons_read+0x18>
+  800936:	eb 1f                	jmp    800957 <devcons_read+0x32>
+		sys_yield();
+  800938:	e8 9a 0c 00 00       	call   8015d7 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80093d:	e8 16 0c 00 00       	call   801558 <sys_cgetc>
+  800942:	85 c0                	test   %eax,%eax
+  800944:	74 f2                	je     800938 <devcons_read+0x13>
+	if (c < 0)
+  800946:	78 0f                	js     800957 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  800948:	83 f8 04             	cmp    $0x4,%eax
+  80094b:	74 0c                	je     800959 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80094d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800950:	88 02                	mov    %al,(%edx)
+	return 1;
+  800952:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  800957:	c9                   	leave
+  800958:	c3                   	ret
+		return 0;
+  800959:	b8 00 00 00 00       	mov    $0x0,%eax
+  80095e:	eb f7                	jmp    800957 <devcons_read+0x32>
+
+00800960 <cputchar>:
+{
+  800960:	55                   	push   %ebp
+  800961:	89 e5                	mov    %esp,%ebp
+  800963:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  800966:	8b 45 08             	mov    0x8(%ebp),%eax
+  800969:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80096c:	6a 01                	push   $0x1
+  80096e:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  800971:	50                   	push   %eax
+  800972:	e8 c3 0b 00 00       	call   80153a <sys_cputs>
+}
+  800977:	83 c4 10             	add    $0x10,%esp
+  80097a:	c9                   	leave
+  80097b:	c3                   	ret
+
+0080097c <getchar>:
+{
+  80097c:	55                   	push   %ebp
+  80097d:	89 e5                	mov    %esp,%ebp
+  80097f:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  800982:	6a 01                	push   $0x1
+  800984:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  800987:	50                   	push   %eax
+  800988:	6a 00                	push   $0x0
+  80098a:	e8 83 16 00 00       	call   802012 <read>
+	if (r < 0)
+  80098f:	83 c4 10             	add    $0x10,%esp
+  800992:	85 c0                	test   %eax,%eax
+  800994:	78 06                	js     80099c <getchar+0x20>
+	if (r < 1)
+  800996:	74 06                	je     80099e <getchar+0x22>
+	return c;
+  800998:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80099c:	c9                   	leave
+  80099d:	c3                   	ret
+		return -E_EOF;
+  80099e:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8009a3:	eb f7                	jmp    80099c <getchar+0x20>
+
+008009a5 <iscons>:
+{
+  8009a5:	55                   	push   %ebp
+  8009a6:	89 e5                	mov    %esp,%ebp
+  8009a8:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8009ab:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8009ae:	50                   	push   %eax
+  8009af:	ff 75 08             	push   0x8(%ebp)
+  8009b2:	e8 f5 13 00 00       	call   801dac <fd_lookup>
+  8009b7:	83 c4 10             	add    $0x10,%esp
+  8009ba:	85 c0                	test   %eax,%eax
+  8009bc:	78 11                	js     8009cf <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8009be:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009c1:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  8009c7:	39 10                	cmp    %edx,(%eax)
+  8009c9:	0f 94 c0             	sete   %al
+  8009cc:	0f b6 c0             	movzbl %al,%eax
+}
+  8009cf:	c9                   	leave
+  8009d0:	c3                   	ret
+
+008009d1 <opencons>:
+{
+  8009d1:	55                   	push   %ebp
+  8009d2:	89 e5                	mov    %esp,%ebp
+  8009d4:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8009d7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8009da:	50                   	push   %eax
+  8009db:	e8 76 13 00 00       	call   801d56 <fd_alloc>
+  8009e0:	83 c4 10             	add    $0x10,%esp
+  8009e3:	85 c0                	test   %eax,%eax
+  8009e5:	78 3a                	js     800a21 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8009e7:	83 ec 04             	sub    $0x4,%esp
+  8009ea:	68 07 04 00 00       	push   $0x407
+  8009ef:	ff 75 f4             	push   -0xc(%ebp)
+  8009f2:	6a 00                	push   $0x0
+  8009f4:	e8 fd 0b 00 00       	call   8015f6 <sys_page_alloc>
+  8009f9:	83 c4 10             	add    $0x10,%esp
+  8009fc:	85 c0                	test   %eax,%eax
+  8009fe:	78 21                	js     800a21 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  800a00:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a03:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  800a09:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  800a0b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a0e:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  800a15:	83 ec 0c             	sub    $0xc,%esp
+  800a18:	50                   	push   %eax
+  800a19:	e8 11 13 00 00       	call   801d2f <fd2num>
+  800a1e:	83 c4 10             	add    $0x10,%esp
+}
+  800a21:	c9                   	leave
+  800a22:	c3                   	ret
+
+00800a23 <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  800a23:	55                   	push   %ebp
+  800a24:	89 e5                	mov    %esp,%ebp
+  800a26:	56                   	push   %esi
+  800a27:	53                   	push   %ebx
+  800a28:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800a2b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  800a2e:	e8 85 0b 00 00       	call   8015b8 <sys_getenvid>
+  800a33:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800a38:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800a3b:	c1 e0 04             	shl    $0x4,%eax
+  800a3e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800a43:	a3 28 64 80 00       	mov    %eax,0x806428
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800a48:	85 db                	test   %ebx,%ebx
+  800a4a:	7e 07                	jle    800a53 <libmain+0x30>
+    binaryname = argv[0];
+  800a4c:	8b 06                	mov    (%esi),%eax
+  800a4e:	a3 1c 50 80 00       	mov    %eax,0x80501c
+
+  // call user main routine
+  umain(argc, argv);
+  800a53:	83 ec 08             	sub    $0x8,%esp
+  800a56:	56                   	push   %esi
+  800a57:	53                   	push   %ebx
+  800a58:	e8 55 fc ff ff       	call   8006b2 <umain>
+
+  // exit gracefully
+  exit();
+  800a5d:	e8 0a 00 00 00       	call   800a6c <exit>
+}
+  800a62:	83 c4 10             	add    $0x10,%esp
+  800a65:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800a68:	5b                   	pop    %ebx
+  800a69:	5e                   	pop    %esi
+  800a6a:	5d                   	pop    %ebp
+  800a6b:	c3                   	ret
+
+00800a6c <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800a6c:	55                   	push   %ebp
+  800a6d:	89 e5                	mov    %esp,%ebp
+  800a6f:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800a72:	e8 8c 14 00 00       	call   801f03 <close_all>
+	sys_env_destroy(0);
+  800a77:	83 ec 0c             	sub    $0xc,%esp
+  800a7a:	6a 00                	push   $0x0
+  800a7c:	e8 f6 0a 00 00       	call   801577 <sys_env_destroy>
+}
+  800a81:	83 c4 10             	add    $0x10,%esp
+  800a84:	c9                   	leave
+  800a85:	c3                   	ret
+
+00800a86 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800a86:	55                   	push   %ebp
+  800a87:	89 e5                	mov    %esp,%ebp
+  800a89:	56                   	push   %esi
+  800a8a:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800a8b:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800a8e:	8b 35 1c 50 80 00    	mov    0x80501c,%esi
+  800a94:	e8 1f 0b 00 00       	call   8015b8 <sys_getenvid>
+  800a99:	83 ec 0c             	sub    $0xc,%esp
+  800a9c:	ff 75 0c             	push   0xc(%ebp)
+  800a9f:	ff 75 08             	push   0x8(%ebp)
+  800aa2:	56                   	push   %esi
+  800aa3:	50                   	push   %eax
+  800aa4:	68 a0 3c 80 00       	push   $0x803ca0
+  800aa9:	e8 b3 00 00 00       	call   800b61 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800aae:	83 c4 18             	add    $0x18,%esp
+  800ab1:	53                   	push   %ebx
+  800ab2:	ff 75 10             	push   0x10(%ebp)
+  800ab5:	e8 56 00 00 00       	call   800b10 <vcprintf>
+	cprintf("\n");
+  800aba:	c7 04 24 a0 3a 80 00 	movl   $0x803aa0,(%esp)
+  800ac1:	e8 9b 00 00 00       	call   800b61 <cprintf>
+  800ac6:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800ac9:	cc                   	int3
+	while (1)
+  800aca:	eb fd                	jmp    800ac9 <_panic+0x43>
+
+00800acc <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800acc:	55                   	push   %ebp
+  800acd:	89 e5                	mov    %esp,%ebp
+  800acf:	53                   	push   %ebx
+  800ad0:	83 ec 04             	sub    $0x4,%esp
+  800ad3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800ad6:	8b 13                	mov    (%ebx),%edx
+  800ad8:	8d 42 01             	lea    0x1(%edx),%eax
+  800adb:	89 03                	mov    %eax,(%ebx)
+  800add:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ae0:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800ae4:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800ae9:	74 09                	je     800af4 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800aeb:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800aef:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800af2:	c9                   	leave
+  800af3:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800af4:	83 ec 08             	sub    $0x8,%esp
+  800af7:	68 ff 00 00 00       	push   $0xff
+  800afc:	8d 43 08             	lea    0x8(%ebx),%eax
+  800aff:	50                   	push   %eax
+  800b00:	e8 35 0a 00 00       	call   80153a <sys_cputs>
+		b->idx = 0;
+  800b05:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800b0b:	83 c4 10             	add    $0x10,%esp
+  800b0e:	eb db                	jmp    800aeb <putch+0x1f>
+
+00800b10 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800b10:	55                   	push   %ebp
+  800b11:	89 e5                	mov    %esp,%ebp
+  800b13:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800b19:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800b20:	00 00 00 
+	b.cnt = 0;
+  800b23:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800b2a:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800b2d:	ff 75 0c             	push   0xc(%ebp)
+  800b30:	ff 75 08             	push   0x8(%ebp)
+  800b33:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800b39:	50                   	push   %eax
+  800b3a:	68 cc 0a 80 00       	push   $0x800acc
+  800b3f:	e8 14 01 00 00       	call   800c58 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800b44:	83 c4 08             	add    $0x8,%esp
+  800b47:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800b4d:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800b53:	50                   	push   %eax
+  800b54:	e8 e1 09 00 00       	call   80153a <sys_cputs>
+
+	return b.cnt;
+}
+  800b59:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800b5f:	c9                   	leave
+  800b60:	c3                   	ret
+
+00800b61 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800b61:	55                   	push   %ebp
+  800b62:	89 e5                	mov    %esp,%ebp
+  800b64:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800b67:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800b6a:	50                   	push   %eax
+  800b6b:	ff 75 08             	push   0x8(%ebp)
+  800b6e:	e8 9d ff ff ff       	call   800b10 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800b73:	c9                   	leave
+  800b74:	c3                   	ret
+
+00800b75 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800b75:	55                   	push   %ebp
+  800b76:	89 e5                	mov    %esp,%ebp
+  800b78:	57                   	push   %edi
+  800b79:	56                   	push   %esi
+  800b7a:	53                   	push   %ebx
+  800b7b:	83 ec 1c             	sub    $0x1c,%esp
+  800b7e:	89 c7                	mov    %eax,%edi
+  800b80:	89 d6                	mov    %edx,%esi
+  800b82:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b85:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b88:	89 d1                	mov    %edx,%ecx
+  800b8a:	89 c2                	mov    %eax,%edx
+  800b8c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800b8f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800b92:	8b 45 10             	mov    0x10(%ebp),%eax
+  800b95:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800b98:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800b9b:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800ba2:	39 c2                	cmp    %eax,%edx
+  800ba4:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800ba7:	72 3e                	jb     800be7 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800ba9:	83 ec 0c             	sub    $0xc,%esp
+  800bac:	ff 75 18             	push   0x18(%ebp)
+  800baf:	83 eb 01             	sub    $0x1,%ebx
+  800bb2:	53                   	push   %ebx
+  800bb3:	50                   	push   %eax
+  800bb4:	83 ec 08             	sub    $0x8,%esp
+  800bb7:	ff 75 e4             	push   -0x1c(%ebp)
+  800bba:	ff 75 e0             	push   -0x20(%ebp)
+  800bbd:	ff 75 dc             	push   -0x24(%ebp)
+  800bc0:	ff 75 d8             	push   -0x28(%ebp)
+  800bc3:	e8 28 2b 00 00       	call   8036f0 <__udivdi3>
+  800bc8:	83 c4 18             	add    $0x18,%esp
+  800bcb:	52                   	push   %edx
+  800bcc:	50                   	push   %eax
+  800bcd:	89 f2                	mov    %esi,%edx
+  800bcf:	89 f8                	mov    %edi,%eax
+  800bd1:	e8 9f ff ff ff       	call   800b75 <printnum>
+  800bd6:	83 c4 20             	add    $0x20,%esp
+  800bd9:	eb 13                	jmp    800bee <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800bdb:	83 ec 08             	sub    $0x8,%esp
+  800bde:	56                   	push   %esi
+  800bdf:	ff 75 18             	push   0x18(%ebp)
+  800be2:	ff d7                	call   *%edi
+  800be4:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800be7:	83 eb 01             	sub    $0x1,%ebx
+  800bea:	85 db                	test   %ebx,%ebx
+  800bec:	7f ed                	jg     800bdb <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800bee:	83 ec 08             	sub    $0x8,%esp
+  800bf1:	56                   	push   %esi
+  800bf2:	83 ec 04             	sub    $0x4,%esp
+  800bf5:	ff 75 e4             	push   -0x1c(%ebp)
+  800bf8:	ff 75 e0             	push   -0x20(%ebp)
+  800bfb:	ff 75 dc             	push   -0x24(%ebp)
+  800bfe:	ff 75 d8             	push   -0x28(%ebp)
+  800c01:	e8 ba 2b 00 00       	call   8037c0 <__umoddi3>
+  800c06:	83 c4 14             	add    $0x14,%esp
+  800c09:	0f be 80 c3 3c 80 00 	movsbl 0x803cc3(%eax),%eax
+  800c10:	50                   	push   %eax
+  800c11:	ff d7                	call   *%edi
+}
+  800c13:	83 c4 10             	add    $0x10,%esp
+  800c16:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c19:	5b                   	pop    %ebx
+  800c1a:	5e                   	pop    %esi
+  800c1b:	5f                   	pop    %edi
+  800c1c:	5d                   	pop    %ebp
+  800c1d:	c3                   	ret
+
+00800c1e <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800c1e:	55                   	push   %ebp
+  800c1f:	89 e5                	mov    %esp,%ebp
+  800c21:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800c24:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800c28:	8b 10                	mov    (%eax),%edx
+  800c2a:	3b 50 04             	cmp    0x4(%eax),%edx
+  800c2d:	73 0a                	jae    800c39 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800c2f:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800c32:	89 08                	mov    %ecx,(%eax)
+  800c34:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c37:	88 02                	mov    %al,(%edx)
+}
+  800c39:	5d                   	pop    %ebp
+  800c3a:	c3                   	ret
+
+00800c3b <printfmt>:
+{
+  800c3b:	55                   	push   %ebp
+  800c3c:	89 e5                	mov    %esp,%ebp
+  800c3e:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800c41:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800c44:	50                   	push   %eax
+  800c45:	ff 75 10             	push   0x10(%ebp)
+  800c48:	ff 75 0c             	push   0xc(%ebp)
+  800c4b:	ff 75 08             	push   0x8(%ebp)
+  800c4e:	e8 05 00 00 00       	call   800c58 <vprintfmt>
+}
+  800c53:	83 c4 10             	add    $0x10,%esp
+  800c56:	c9                   	leave
+  800c57:	c3                   	ret
+
+00800c58 <vprintfmt>:
+{
+  800c58:	55                   	push   %ebp
+  800c59:	89 e5                	mov    %esp,%ebp
+  800c5b:	57                   	push   %edi
+  800c5c:	56                   	push   %esi
+  800c5d:	53                   	push   %ebx
+  800c5e:	83 ec 2c             	sub    $0x2c,%esp
+  800c61:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c64:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800c67:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800c6a:	eb 0a                	jmp    800c76 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800c6c:	83 ec 08             	sub    $0x8,%esp
+  800c6f:	53                   	push   %ebx
+  800c70:	50                   	push   %eax
+  800c71:	ff d6                	call   *%esi
+  800c73:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800c76:	83 c7 01             	add    $0x1,%edi
+  800c79:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800c7d:	83 f8 25             	cmp    $0x25,%eax
+  800c80:	74 0c                	je     800c8e <vprintfmt+0x36>
+			if (ch == '\0')
+  800c82:	85 c0                	test   %eax,%eax
+  800c84:	75 e6                	jne    800c6c <vprintfmt+0x14>
+}
+  800c86:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c89:	5b                   	pop    %ebx
+  800c8a:	5e                   	pop    %esi
+  800c8b:	5f                   	pop    %edi
+  800c8c:	5d                   	pop    %ebp
+  800c8d:	c3                   	ret
+		padc = ' ';
+  800c8e:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800c92:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800c99:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800ca0:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800ca7:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800cac:	8d 47 01             	lea    0x1(%edi),%eax
+  800caf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800cb2:	0f b6 17             	movzbl (%edi),%edx
+  800cb5:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800cb8:	3c 55                	cmp    $0x55,%al
+  800cba:	0f 87 9a 03 00 00    	ja     80105a <vprintfmt+0x402>
+  800cc0:	0f b6 c0             	movzbl %al,%eax
+  800cc3:	ff 24 85 00 3e 80 00 	jmp    *0x803e00(,%eax,4)
+  800cca:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800ccd:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800cd1:	eb d9                	jmp    800cac <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800cd3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800cd6:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800cda:	eb d0                	jmp    800cac <vprintfmt+0x54>
+  800cdc:	0f b6 d2             	movzbl %dl,%edx
+  800cdf:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800ce2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ce7:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800cea:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800ced:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800cf1:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800cf4:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800cf7:	83 f9 09             	cmp    $0x9,%ecx
+  800cfa:	77 55                	ja     800d51 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800cfc:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800cff:	eb e9                	jmp    800cea <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800d01:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d04:	8b 00                	mov    (%eax),%eax
+  800d06:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800d09:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d0c:	8d 40 04             	lea    0x4(%eax),%eax
+  800d0f:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800d12:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800d15:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800d19:	79 91                	jns    800cac <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800d1b:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800d1e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800d21:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800d28:	eb 82                	jmp    800cac <vprintfmt+0x54>
+			if (width < 0)
+  800d2a:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800d2d:	85 d2                	test   %edx,%edx
+  800d2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d34:	0f 49 c2             	cmovns %edx,%eax
+  800d37:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800d3a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800d3d:	e9 6a ff ff ff       	jmp    800cac <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800d42:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800d45:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800d4c:	e9 5b ff ff ff       	jmp    800cac <vprintfmt+0x54>
+  800d51:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800d54:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800d57:	eb bc                	jmp    800d15 <vprintfmt+0xbd>
+			lflag++;
+  800d59:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800d5c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800d5f:	e9 48 ff ff ff       	jmp    800cac <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800d64:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d67:	8d 78 04             	lea    0x4(%eax),%edi
+  800d6a:	83 ec 08             	sub    $0x8,%esp
+  800d6d:	53                   	push   %ebx
+  800d6e:	ff 30                	push   (%eax)
+  800d70:	ff d6                	call   *%esi
+			break;
+  800d72:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800d75:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800d78:	e9 7c 02 00 00       	jmp    800ff9 <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  800d7d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d80:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800d83:	8b 10                	mov    (%eax),%edx
+  800d85:	89 d0                	mov    %edx,%eax
+  800d87:	f7 d8                	neg    %eax
+  800d89:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800d8c:	83 f8 10             	cmp    $0x10,%eax
+  800d8f:	7f 23                	jg     800db4 <vprintfmt+0x15c>
+  800d91:	8b 14 85 60 3f 80 00 	mov    0x803f60(,%eax,4),%edx
+  800d98:	85 d2                	test   %edx,%edx
+  800d9a:	74 18                	je     800db4 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800d9c:	52                   	push   %edx
+  800d9d:	68 e1 3b 80 00       	push   $0x803be1
+  800da2:	53                   	push   %ebx
+  800da3:	56                   	push   %esi
+  800da4:	e8 92 fe ff ff       	call   800c3b <printfmt>
+  800da9:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800dac:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800daf:	e9 45 02 00 00       	jmp    800ff9 <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  800db4:	50                   	push   %eax
+  800db5:	68 db 3c 80 00       	push   $0x803cdb
+  800dba:	53                   	push   %ebx
+  800dbb:	56                   	push   %esi
+  800dbc:	e8 7a fe ff ff       	call   800c3b <printfmt>
+  800dc1:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800dc4:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800dc7:	e9 2d 02 00 00       	jmp    800ff9 <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800dcc:	8b 45 14             	mov    0x14(%ebp),%eax
+  800dcf:	83 c0 04             	add    $0x4,%eax
+  800dd2:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800dd5:	8b 45 14             	mov    0x14(%ebp),%eax
+  800dd8:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800dda:	85 c9                	test   %ecx,%ecx
+  800ddc:	b8 d4 3c 80 00       	mov    $0x803cd4,%eax
+  800de1:	0f 45 c1             	cmovne %ecx,%eax
+  800de4:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800de7:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800deb:	7e 06                	jle    800df3 <vprintfmt+0x19b>
+  800ded:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800df1:	75 0b                	jne    800dfe <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800df3:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800df6:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800df9:	89 75 08             	mov    %esi,0x8(%ebp)
+  800dfc:	eb 5c                	jmp    800e5a <vprintfmt+0x202>
+  800dfe:	83 ec 08             	sub    $0x8,%esp
+  800e01:	ff 75 d0             	push   -0x30(%ebp)
+  800e04:	ff 75 cc             	push   -0x34(%ebp)
+  800e07:	e8 db 03 00 00       	call   8011e7 <strnlen>
+  800e0c:	89 c2                	mov    %eax,%edx
+  800e0e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800e11:	29 d0                	sub    %edx,%eax
+  800e13:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800e16:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800e1a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800e1d:	89 75 08             	mov    %esi,0x8(%ebp)
+  800e20:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800e22:	eb 0e                	jmp    800e32 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800e24:	83 ec 08             	sub    $0x8,%esp
+  800e27:	53                   	push   %ebx
+  800e28:	57                   	push   %edi
+  800e29:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800e2c:	83 ee 01             	sub    $0x1,%esi
+  800e2f:	83 c4 10             	add    $0x10,%esp
+  800e32:	85 f6                	test   %esi,%esi
+  800e34:	7f ee                	jg     800e24 <vprintfmt+0x1cc>
+  800e36:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800e39:	8b 75 08             	mov    0x8(%ebp),%esi
+  800e3c:	85 c0                	test   %eax,%eax
+  800e3e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e43:	0f 49 d0             	cmovns %eax,%edx
+  800e46:	29 d0                	sub    %edx,%eax
+  800e48:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800e4b:	eb a6                	jmp    800df3 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800e4d:	83 ec 08             	sub    $0x8,%esp
+  800e50:	53                   	push   %ebx
+  800e51:	52                   	push   %edx
+  800e52:	ff 55 08             	call   *0x8(%ebp)
+  800e55:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800e58:	89 f1                	mov    %esi,%ecx
+  800e5a:	8d 71 01             	lea    0x1(%ecx),%esi
+  800e5d:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800e61:	0f be d0             	movsbl %al,%edx
+  800e64:	85 d2                	test   %edx,%edx
+  800e66:	74 28                	je     800e90 <vprintfmt+0x238>
+  800e68:	85 ff                	test   %edi,%edi
+  800e6a:	78 05                	js     800e71 <vprintfmt+0x219>
+  800e6c:	83 ef 01             	sub    $0x1,%edi
+  800e6f:	78 30                	js     800ea1 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800e71:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800e75:	74 d6                	je     800e4d <vprintfmt+0x1f5>
+  800e77:	0f be c0             	movsbl %al,%eax
+  800e7a:	83 e8 20             	sub    $0x20,%eax
+  800e7d:	83 f8 5e             	cmp    $0x5e,%eax
+  800e80:	76 cb                	jbe    800e4d <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800e82:	83 ec 08             	sub    $0x8,%esp
+  800e85:	53                   	push   %ebx
+  800e86:	6a 3f                	push   $0x3f
+  800e88:	ff 55 08             	call   *0x8(%ebp)
+  800e8b:	83 c4 10             	add    $0x10,%esp
+  800e8e:	eb c8                	jmp    800e58 <vprintfmt+0x200>
+  800e90:	8b 75 08             	mov    0x8(%ebp),%esi
+  800e93:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800e96:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800e99:	01 d0                	add    %edx,%eax
+  800e9b:	29 c8                	sub    %ecx,%eax
+  800e9d:	89 c7                	mov    %eax,%edi
+  800e9f:	eb 13                	jmp    800eb4 <vprintfmt+0x25c>
+  800ea1:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ea4:	eb ed                	jmp    800e93 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800ea6:	83 ec 08             	sub    $0x8,%esp
+  800ea9:	53                   	push   %ebx
+  800eaa:	6a 20                	push   $0x20
+  800eac:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800eae:	83 ef 01             	sub    $0x1,%edi
+  800eb1:	83 c4 10             	add    $0x10,%esp
+  800eb4:	85 ff                	test   %edi,%edi
+  800eb6:	7f ee                	jg     800ea6 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800eb8:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800ebb:	89 45 14             	mov    %eax,0x14(%ebp)
+  800ebe:	e9 36 01 00 00       	jmp    800ff9 <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  800ec3:	83 f9 01             	cmp    $0x1,%ecx
+  800ec6:	7f 1f                	jg     800ee7 <vprintfmt+0x28f>
+	else if (lflag)
+  800ec8:	85 c9                	test   %ecx,%ecx
+  800eca:	74 67                	je     800f33 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800ecc:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ecf:	8b 00                	mov    (%eax),%eax
+  800ed1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800ed4:	89 c1                	mov    %eax,%ecx
+  800ed6:	c1 f9 1f             	sar    $0x1f,%ecx
+  800ed9:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800edc:	8b 45 14             	mov    0x14(%ebp),%eax
+  800edf:	8d 40 04             	lea    0x4(%eax),%eax
+  800ee2:	89 45 14             	mov    %eax,0x14(%ebp)
+  800ee5:	eb 17                	jmp    800efe <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800ee7:	8b 45 14             	mov    0x14(%ebp),%eax
+  800eea:	8b 50 04             	mov    0x4(%eax),%edx
+  800eed:	8b 00                	mov    (%eax),%eax
+  800eef:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800ef2:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800ef5:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ef8:	8d 40 08             	lea    0x8(%eax),%eax
+  800efb:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800efe:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800f01:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800f04:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800f09:	85 c9                	test   %ecx,%ecx
+  800f0b:	0f 89 ce 00 00 00    	jns    800fdf <vprintfmt+0x387>
+				putch('-', putdat);
+  800f11:	83 ec 08             	sub    $0x8,%esp
+  800f14:	53                   	push   %ebx
+  800f15:	6a 2d                	push   $0x2d
+  800f17:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800f19:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800f1c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800f1f:	f7 da                	neg    %edx
+  800f21:	83 d1 00             	adc    $0x0,%ecx
+  800f24:	f7 d9                	neg    %ecx
+  800f26:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800f29:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800f2e:	e9 ac 00 00 00       	jmp    800fdf <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  800f33:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f36:	8b 00                	mov    (%eax),%eax
+  800f38:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800f3b:	89 c1                	mov    %eax,%ecx
+  800f3d:	c1 f9 1f             	sar    $0x1f,%ecx
+  800f40:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800f43:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f46:	8d 40 04             	lea    0x4(%eax),%eax
+  800f49:	89 45 14             	mov    %eax,0x14(%ebp)
+  800f4c:	eb b0                	jmp    800efe <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800f4e:	83 f9 01             	cmp    $0x1,%ecx
+  800f51:	7f 1b                	jg     800f6e <vprintfmt+0x316>
+	else if (lflag)
+  800f53:	85 c9                	test   %ecx,%ecx
+  800f55:	74 2c                	je     800f83 <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  800f57:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f5a:	8b 10                	mov    (%eax),%edx
+  800f5c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f61:	8d 40 04             	lea    0x4(%eax),%eax
+  800f64:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800f67:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800f6c:	eb 71                	jmp    800fdf <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  800f6e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f71:	8b 10                	mov    (%eax),%edx
+  800f73:	8b 48 04             	mov    0x4(%eax),%ecx
+  800f76:	8d 40 08             	lea    0x8(%eax),%eax
+  800f79:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800f7c:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800f81:	eb 5c                	jmp    800fdf <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  800f83:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f86:	8b 10                	mov    (%eax),%edx
+  800f88:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f8d:	8d 40 04             	lea    0x4(%eax),%eax
+  800f90:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800f93:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800f98:	eb 45                	jmp    800fdf <vprintfmt+0x387>
+			putch('X', putdat);
+  800f9a:	83 ec 08             	sub    $0x8,%esp
+  800f9d:	53                   	push   %ebx
+  800f9e:	6a 58                	push   $0x58
+  800fa0:	ff d6                	call   *%esi
+			putch('X', putdat);
+  800fa2:	83 c4 08             	add    $0x8,%esp
+  800fa5:	53                   	push   %ebx
+  800fa6:	6a 58                	push   $0x58
+  800fa8:	ff d6                	call   *%esi
+			putch('X', putdat);
+  800faa:	83 c4 08             	add    $0x8,%esp
+  800fad:	53                   	push   %ebx
+  800fae:	6a 58                	push   $0x58
+  800fb0:	ff d6                	call   *%esi
+			break;
+  800fb2:	83 c4 10             	add    $0x10,%esp
+  800fb5:	eb 42                	jmp    800ff9 <vprintfmt+0x3a1>
+			putch('0', putdat);
+  800fb7:	83 ec 08             	sub    $0x8,%esp
+  800fba:	53                   	push   %ebx
+  800fbb:	6a 30                	push   $0x30
+  800fbd:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800fbf:	83 c4 08             	add    $0x8,%esp
+  800fc2:	53                   	push   %ebx
+  800fc3:	6a 78                	push   $0x78
+  800fc5:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800fc7:	8b 45 14             	mov    0x14(%ebp),%eax
+  800fca:	8b 10                	mov    (%eax),%edx
+  800fcc:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800fd1:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800fd4:	8d 40 04             	lea    0x4(%eax),%eax
+  800fd7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800fda:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800fdf:	83 ec 0c             	sub    $0xc,%esp
+  800fe2:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800fe6:	50                   	push   %eax
+  800fe7:	ff 75 e0             	push   -0x20(%ebp)
+  800fea:	57                   	push   %edi
+  800feb:	51                   	push   %ecx
+  800fec:	52                   	push   %edx
+  800fed:	89 da                	mov    %ebx,%edx
+  800fef:	89 f0                	mov    %esi,%eax
+  800ff1:	e8 7f fb ff ff       	call   800b75 <printnum>
+			break;
+  800ff6:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800ff9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800ffc:	e9 75 fc ff ff       	jmp    800c76 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  801001:	83 f9 01             	cmp    $0x1,%ecx
+  801004:	7f 1b                	jg     801021 <vprintfmt+0x3c9>
+	else if (lflag)
+  801006:	85 c9                	test   %ecx,%ecx
+  801008:	74 2c                	je     801036 <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  80100a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80100d:	8b 10                	mov    (%eax),%edx
+  80100f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801014:	8d 40 04             	lea    0x4(%eax),%eax
+  801017:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80101a:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  80101f:	eb be                	jmp    800fdf <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  801021:	8b 45 14             	mov    0x14(%ebp),%eax
+  801024:	8b 10                	mov    (%eax),%edx
+  801026:	8b 48 04             	mov    0x4(%eax),%ecx
+  801029:	8d 40 08             	lea    0x8(%eax),%eax
+  80102c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80102f:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  801034:	eb a9                	jmp    800fdf <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  801036:	8b 45 14             	mov    0x14(%ebp),%eax
+  801039:	8b 10                	mov    (%eax),%edx
+  80103b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801040:	8d 40 04             	lea    0x4(%eax),%eax
+  801043:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801046:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80104b:	eb 92                	jmp    800fdf <vprintfmt+0x387>
+			putch(ch, putdat);
+  80104d:	83 ec 08             	sub    $0x8,%esp
+  801050:	53                   	push   %ebx
+  801051:	6a 25                	push   $0x25
+  801053:	ff d6                	call   *%esi
+			break;
+  801055:	83 c4 10             	add    $0x10,%esp
+  801058:	eb 9f                	jmp    800ff9 <vprintfmt+0x3a1>
+			putch('%', putdat);
+  80105a:	83 ec 08             	sub    $0x8,%esp
+  80105d:	53                   	push   %ebx
+  80105e:	6a 25                	push   $0x25
+  801060:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801062:	83 c4 10             	add    $0x10,%esp
+  801065:	89 f8                	mov    %edi,%eax
+  801067:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80106b:	74 05                	je     801072 <vprintfmt+0x41a>
+  80106d:	83 e8 01             	sub    $0x1,%eax
+  801070:	eb f5                	jmp    801067 <vprintfmt+0x40f>
+  801072:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801075:	eb 82                	jmp    800ff9 <vprintfmt+0x3a1>
+
+00801077 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  801077:	55                   	push   %ebp
+  801078:	89 e5                	mov    %esp,%ebp
+  80107a:	83 ec 18             	sub    $0x18,%esp
+  80107d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801080:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  801083:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  801086:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80108a:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80108d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  801094:	85 c0                	test   %eax,%eax
+  801096:	74 26                	je     8010be <vsnprintf+0x47>
+  801098:	85 d2                	test   %edx,%edx
+  80109a:	7e 22                	jle    8010be <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80109c:	ff 75 14             	push   0x14(%ebp)
+  80109f:	ff 75 10             	push   0x10(%ebp)
+  8010a2:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8010a5:	50                   	push   %eax
+  8010a6:	68 1e 0c 80 00       	push   $0x800c1e
+  8010ab:	e8 a8 fb ff ff       	call   800c58 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8010b0:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8010b3:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8010b6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8010b9:	83 c4 10             	add    $0x10,%esp
+}
+  8010bc:	c9                   	leave
+  8010bd:	c3                   	ret
+		return -E_INVAL;
+  8010be:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8010c3:	eb f7                	jmp    8010bc <vsnprintf+0x45>
+
+008010c5 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8010c5:	55                   	push   %ebp
+  8010c6:	89 e5                	mov    %esp,%ebp
+  8010c8:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8010cb:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8010ce:	50                   	push   %eax
+  8010cf:	ff 75 10             	push   0x10(%ebp)
+  8010d2:	ff 75 0c             	push   0xc(%ebp)
+  8010d5:	ff 75 08             	push   0x8(%ebp)
+  8010d8:	e8 9a ff ff ff       	call   801077 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8010dd:	c9                   	leave
+  8010de:	c3                   	ret
+
+008010df <readline>:
+#define BUFLEN 1024
+static char buf[BUFLEN];
+
+char *
+readline(const char *prompt)
+{
+  8010df:	55                   	push   %ebp
+  8010e0:	89 e5                	mov    %esp,%ebp
+  8010e2:	57                   	push   %edi
+  8010e3:	56                   	push   %esi
+  8010e4:	53                   	push   %ebx
+  8010e5:	83 ec 0c             	sub    $0xc,%esp
+  8010e8:	8b 45 08             	mov    0x8(%ebp),%eax
+
+#if JOS_KERNEL
+	if (prompt != NULL)
+		cprintf("%s", prompt);
+#else
+	if (prompt != NULL)
+  8010eb:	85 c0                	test   %eax,%eax
+  8010ed:	74 13                	je     801102 <readline+0x23>
+		fprintf(1, "%s", prompt);
+  8010ef:	83 ec 04             	sub    $0x4,%esp
+  8010f2:	50                   	push   %eax
+  8010f3:	68 e1 3b 80 00       	push   $0x803be1
+  8010f8:	6a 01                	push   $0x1
+  8010fa:	e8 02 15 00 00       	call   802601 <fprintf>
+  8010ff:	83 c4 10             	add    $0x10,%esp
+#endif
+
+	i = 0;
+	echoing = iscons(0);
+  801102:	83 ec 0c             	sub    $0xc,%esp
+  801105:	6a 00                	push   $0x0
+  801107:	e8 99 f8 ff ff       	call   8009a5 <iscons>
+  80110c:	89 c7                	mov    %eax,%edi
+  80110e:	83 c4 10             	add    $0x10,%esp
+	i = 0;
+  801111:	be 00 00 00 00       	mov    $0x0,%esi
+  801116:	eb 4b                	jmp    801163 <readline+0x84>
+	while (1) {
+		c = getchar();
+		if (c < 0) {
+			if (c != -E_EOF)
+				cprintf("read error: %e\n", c);
+			return NULL;
+  801118:	b8 00 00 00 00       	mov    $0x0,%eax
+			if (c != -E_EOF)
+  80111d:	83 fb f8             	cmp    $0xfffffff8,%ebx
+  801120:	75 08                	jne    80112a <readline+0x4b>
+				cputchar('\n');
+			buf[i] = 0;
+			return buf;
+		}
+	}
+}
+  801122:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801125:	5b                   	pop    %ebx
+  801126:	5e                   	pop    %esi
+  801127:	5f                   	pop    %edi
+  801128:	5d                   	pop    %ebp
+  801129:	c3                   	ret
+				cprintf("read error: %e\n", c);
+  80112a:	83 ec 08             	sub    $0x8,%esp
+  80112d:	53                   	push   %ebx
+  80112e:	68 c3 3f 80 00       	push   $0x803fc3
+  801133:	e8 29 fa ff ff       	call   800b61 <cprintf>
+  801138:	83 c4 10             	add    $0x10,%esp
+			return NULL;
+  80113b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801140:	eb e0                	jmp    801122 <readline+0x43>
+			if (echoing)
+  801142:	85 ff                	test   %edi,%edi
+  801144:	75 05                	jne    80114b <readline+0x6c>
+			i--;
+  801146:	83 ee 01             	sub    $0x1,%esi
+  801149:	eb 18                	jmp    801163 <readline+0x84>
+				cputchar('\b');
+  80114b:	83 ec 0c             	sub    $0xc,%esp
+  80114e:	6a 08                	push   $0x8
+  801150:	e8 0b f8 ff ff       	call   800960 <cputchar>
+  801155:	83 c4 10             	add    $0x10,%esp
+  801158:	eb ec                	jmp    801146 <readline+0x67>
+			buf[i++] = c;
+  80115a:	88 9e 20 60 80 00    	mov    %bl,0x806020(%esi)
+  801160:	8d 76 01             	lea    0x1(%esi),%esi
+		c = getchar();
+  801163:	e8 14 f8 ff ff       	call   80097c <getchar>
+  801168:	89 c3                	mov    %eax,%ebx
+		if (c < 0) {
+  80116a:	85 c0                	test   %eax,%eax
+  80116c:	78 aa                	js     801118 <readline+0x39>
+		} else if ((c == '\b' || c == '\x7f') && i > 0) {
+  80116e:	83 f8 08             	cmp    $0x8,%eax
+  801171:	0f 94 c0             	sete   %al
+  801174:	83 fb 7f             	cmp    $0x7f,%ebx
+  801177:	0f 94 c2             	sete   %dl
+  80117a:	08 d0                	or     %dl,%al
+  80117c:	74 04                	je     801182 <readline+0xa3>
+  80117e:	85 f6                	test   %esi,%esi
+  801180:	7f c0                	jg     801142 <readline+0x63>
+		} else if (c >= ' ' && i < BUFLEN-1) {
+  801182:	83 fb 1f             	cmp    $0x1f,%ebx
+  801185:	7e 1a                	jle    8011a1 <readline+0xc2>
+  801187:	81 fe fe 03 00 00    	cmp    $0x3fe,%esi
+  80118d:	7f 12                	jg     8011a1 <readline+0xc2>
+			if (echoing)
+  80118f:	85 ff                	test   %edi,%edi
+  801191:	74 c7                	je     80115a <readline+0x7b>
+				cputchar(c);
+  801193:	83 ec 0c             	sub    $0xc,%esp
+  801196:	53                   	push   %ebx
+  801197:	e8 c4 f7 ff ff       	call   800960 <cputchar>
+  80119c:	83 c4 10             	add    $0x10,%esp
+  80119f:	eb b9                	jmp    80115a <readline+0x7b>
+		} else if (c == '\n' || c == '\r') {
+  8011a1:	83 fb 0a             	cmp    $0xa,%ebx
+  8011a4:	74 05                	je     8011ab <readline+0xcc>
+  8011a6:	83 fb 0d             	cmp    $0xd,%ebx
+  8011a9:	75 b8                	jne    801163 <readline+0x84>
+			if (echoing)
+  8011ab:	85 ff                	test   %edi,%edi
+  8011ad:	75 11                	jne    8011c0 <readline+0xe1>
+			buf[i] = 0;
+  8011af:	c6 86 20 60 80 00 00 	movb   $0x0,0x806020(%esi)
+			return buf;
+  8011b6:	b8 20 60 80 00       	mov    $0x806020,%eax
+  8011bb:	e9 62 ff ff ff       	jmp    801122 <readline+0x43>
+				cputchar('\n');
+  8011c0:	83 ec 0c             	sub    $0xc,%esp
+  8011c3:	6a 0a                	push   $0xa
+  8011c5:	e8 96 f7 ff ff       	call   800960 <cputchar>
+  8011ca:	83 c4 10             	add    $0x10,%esp
+  8011cd:	eb e0                	jmp    8011af <readline+0xd0>
+
+008011cf <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8011cf:	55                   	push   %ebp
+  8011d0:	89 e5                	mov    %esp,%ebp
+  8011d2:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8011d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011da:	eb 03                	jmp    8011df <strlen+0x10>
+		n++;
+  8011dc:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8011df:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8011e3:	75 f7                	jne    8011dc <strlen+0xd>
+	return n;
+}
+  8011e5:	5d                   	pop    %ebp
+  8011e6:	c3                   	ret
+
+008011e7 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8011e7:	55                   	push   %ebp
+  8011e8:	89 e5                	mov    %esp,%ebp
+  8011ea:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8011ed:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8011f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011f5:	eb 03                	jmp    8011fa <strnlen+0x13>
+		n++;
+  8011f7:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8011fa:	39 d0                	cmp    %edx,%eax
+  8011fc:	74 08                	je     801206 <strnlen+0x1f>
+  8011fe:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  801202:	75 f3                	jne    8011f7 <strnlen+0x10>
+  801204:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  801206:	89 d0                	mov    %edx,%eax
+  801208:	5d                   	pop    %ebp
+  801209:	c3                   	ret
+
+0080120a <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80120a:	55                   	push   %ebp
+  80120b:	89 e5                	mov    %esp,%ebp
+  80120d:	53                   	push   %ebx
+  80120e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801211:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  801214:	b8 00 00 00 00       	mov    $0x0,%eax
+  801219:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80121d:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  801220:	83 c0 01             	add    $0x1,%eax
+  801223:	84 d2                	test   %dl,%dl
+  801225:	75 f2                	jne    801219 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  801227:	89 c8                	mov    %ecx,%eax
+  801229:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80122c:	c9                   	leave
+  80122d:	c3                   	ret
+
+0080122e <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80122e:	55                   	push   %ebp
+  80122f:	89 e5                	mov    %esp,%ebp
+  801231:	53                   	push   %ebx
+  801232:	83 ec 10             	sub    $0x10,%esp
+  801235:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  801238:	53                   	push   %ebx
+  801239:	e8 91 ff ff ff       	call   8011cf <strlen>
+  80123e:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  801241:	ff 75 0c             	push   0xc(%ebp)
+  801244:	01 d8                	add    %ebx,%eax
+  801246:	50                   	push   %eax
+  801247:	e8 be ff ff ff       	call   80120a <strcpy>
+	return dst;
+}
+  80124c:	89 d8                	mov    %ebx,%eax
+  80124e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801251:	c9                   	leave
+  801252:	c3                   	ret
+
+00801253 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801253:	55                   	push   %ebp
+  801254:	89 e5                	mov    %esp,%ebp
+  801256:	56                   	push   %esi
+  801257:	53                   	push   %ebx
+  801258:	8b 75 08             	mov    0x8(%ebp),%esi
+  80125b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80125e:	89 f3                	mov    %esi,%ebx
+  801260:	03 5d 10             	add    0x10(%ebp),%ebx
+  801263:	89 f0                	mov    %esi,%eax
+  801265:	eb 0f                	jmp    801276 <strncpy+0x23>
+		*dst++ = *src;
+  801267:	83 c0 01             	add    $0x1,%eax
+  80126a:	0f b6 0a             	movzbl (%edx),%ecx
+  80126d:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  801270:	80 f9 01             	cmp    $0x1,%cl
+  801273:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  801276:	39 d8                	cmp    %ebx,%eax
+  801278:	75 ed                	jne    801267 <strncpy+0x14>
+	}
+	return ret;
+}
+  80127a:	89 f0                	mov    %esi,%eax
+  80127c:	5b                   	pop    %ebx
+  80127d:	5e                   	pop    %esi
+  80127e:	5d                   	pop    %ebp
+  80127f:	c3                   	ret
+
+00801280 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801280:	55                   	push   %ebp
+  801281:	89 e5                	mov    %esp,%ebp
+  801283:	56                   	push   %esi
+  801284:	53                   	push   %ebx
+  801285:	8b 75 08             	mov    0x8(%ebp),%esi
+  801288:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80128b:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80128e:	89 f0                	mov    %esi,%eax
+  801290:	85 d2                	test   %edx,%edx
+  801292:	74 21                	je     8012b5 <strlcpy+0x35>
+  801294:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  801298:	89 f2                	mov    %esi,%edx
+  80129a:	eb 09                	jmp    8012a5 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  80129c:	83 c1 01             	add    $0x1,%ecx
+  80129f:	83 c2 01             	add    $0x1,%edx
+  8012a2:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8012a5:	39 c2                	cmp    %eax,%edx
+  8012a7:	74 09                	je     8012b2 <strlcpy+0x32>
+  8012a9:	0f b6 19             	movzbl (%ecx),%ebx
+  8012ac:	84 db                	test   %bl,%bl
+  8012ae:	75 ec                	jne    80129c <strlcpy+0x1c>
+  8012b0:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8012b2:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8012b5:	29 f0                	sub    %esi,%eax
+}
+  8012b7:	5b                   	pop    %ebx
+  8012b8:	5e                   	pop    %esi
+  8012b9:	5d                   	pop    %ebp
+  8012ba:	c3                   	ret
+
+008012bb <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8012bb:	55                   	push   %ebp
+  8012bc:	89 e5                	mov    %esp,%ebp
+  8012be:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8012c1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8012c4:	eb 06                	jmp    8012cc <strcmp+0x11>
+		p++, q++;
+  8012c6:	83 c1 01             	add    $0x1,%ecx
+  8012c9:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8012cc:	0f b6 01             	movzbl (%ecx),%eax
+  8012cf:	84 c0                	test   %al,%al
+  8012d1:	74 04                	je     8012d7 <strcmp+0x1c>
+  8012d3:	3a 02                	cmp    (%edx),%al
+  8012d5:	74 ef                	je     8012c6 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8012d7:	0f b6 c0             	movzbl %al,%eax
+  8012da:	0f b6 12             	movzbl (%edx),%edx
+  8012dd:	29 d0                	sub    %edx,%eax
+}
+  8012df:	5d                   	pop    %ebp
+  8012e0:	c3                   	ret
+
+008012e1 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8012e1:	55                   	push   %ebp
+  8012e2:	89 e5                	mov    %esp,%ebp
+  8012e4:	53                   	push   %ebx
+  8012e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8012e8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012eb:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8012ee:	eb 09                	jmp    8012f9 <strncmp+0x18>
+		n--, p++, q++;
+  8012f0:	83 ea 01             	sub    $0x1,%edx
+  8012f3:	83 c0 01             	add    $0x1,%eax
+  8012f6:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8012f9:	85 d2                	test   %edx,%edx
+  8012fb:	74 18                	je     801315 <strncmp+0x34>
+  8012fd:	0f b6 18             	movzbl (%eax),%ebx
+  801300:	84 db                	test   %bl,%bl
+  801302:	74 04                	je     801308 <strncmp+0x27>
+  801304:	3a 19                	cmp    (%ecx),%bl
+  801306:	74 e8                	je     8012f0 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801308:	0f b6 00             	movzbl (%eax),%eax
+  80130b:	0f b6 11             	movzbl (%ecx),%edx
+  80130e:	29 d0                	sub    %edx,%eax
+}
+  801310:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801313:	c9                   	leave
+  801314:	c3                   	ret
+		return 0;
+  801315:	b8 00 00 00 00       	mov    $0x0,%eax
+  80131a:	eb f4                	jmp    801310 <strncmp+0x2f>
+
+0080131c <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80131c:	55                   	push   %ebp
+  80131d:	89 e5                	mov    %esp,%ebp
+  80131f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801322:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801326:	eb 03                	jmp    80132b <strchr+0xf>
+  801328:	83 c0 01             	add    $0x1,%eax
+  80132b:	0f b6 10             	movzbl (%eax),%edx
+  80132e:	84 d2                	test   %dl,%dl
+  801330:	74 06                	je     801338 <strchr+0x1c>
+		if (*s == c)
+  801332:	38 ca                	cmp    %cl,%dl
+  801334:	75 f2                	jne    801328 <strchr+0xc>
+  801336:	eb 05                	jmp    80133d <strchr+0x21>
+			return (char *) s;
+	return 0;
+  801338:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80133d:	5d                   	pop    %ebp
+  80133e:	c3                   	ret
+
+0080133f <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80133f:	55                   	push   %ebp
+  801340:	89 e5                	mov    %esp,%ebp
+  801342:	8b 45 08             	mov    0x8(%ebp),%eax
+  801345:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801349:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  80134c:	38 ca                	cmp    %cl,%dl
+  80134e:	74 09                	je     801359 <strfind+0x1a>
+  801350:	84 d2                	test   %dl,%dl
+  801352:	74 05                	je     801359 <strfind+0x1a>
+	for (; *s; s++)
+  801354:	83 c0 01             	add    $0x1,%eax
+  801357:	eb f0                	jmp    801349 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  801359:	5d                   	pop    %ebp
+  80135a:	c3                   	ret
+
+0080135b <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  80135b:	55                   	push   %ebp
+  80135c:	89 e5                	mov    %esp,%ebp
+  80135e:	57                   	push   %edi
+  80135f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801362:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  801365:	85 c9                	test   %ecx,%ecx
+  801367:	74 20                	je     801389 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  801369:	89 f8                	mov    %edi,%eax
+  80136b:	09 c8                	or     %ecx,%eax
+  80136d:	a8 03                	test   $0x3,%al
+  80136f:	75 12                	jne    801383 <memset+0x28>
+		c &= 0xFF;
+  801371:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  801375:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  80137b:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  80137e:	fc                   	cld
+  80137f:	f3 ab                	rep stos %eax,%es:(%edi)
+  801381:	eb 06                	jmp    801389 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801383:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801386:	fc                   	cld
+  801387:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  801389:	89 f8                	mov    %edi,%eax
+  80138b:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  80138e:	c9                   	leave
+  80138f:	c3                   	ret
+
+00801390 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801390:	55                   	push   %ebp
+  801391:	89 e5                	mov    %esp,%ebp
+  801393:	57                   	push   %edi
+  801394:	56                   	push   %esi
+  801395:	8b 45 08             	mov    0x8(%ebp),%eax
+  801398:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80139b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  80139e:	39 c6                	cmp    %eax,%esi
+  8013a0:	73 32                	jae    8013d4 <memmove+0x44>
+  8013a2:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8013a5:	39 d0                	cmp    %edx,%eax
+  8013a7:	73 2b                	jae    8013d4 <memmove+0x44>
+		s += n;
+		d += n;
+  8013a9:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8013ac:	89 d6                	mov    %edx,%esi
+  8013ae:	09 fe                	or     %edi,%esi
+  8013b0:	09 ce                	or     %ecx,%esi
+  8013b2:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8013b8:	75 0e                	jne    8013c8 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8013ba:	83 ef 04             	sub    $0x4,%edi
+  8013bd:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8013c0:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8013c3:	fd                   	std
+  8013c4:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8013c6:	eb 09                	jmp    8013d1 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8013c8:	83 ef 01             	sub    $0x1,%edi
+  8013cb:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8013ce:	fd                   	std
+  8013cf:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8013d1:	fc                   	cld
+  8013d2:	eb 1a                	jmp    8013ee <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8013d4:	89 f2                	mov    %esi,%edx
+  8013d6:	09 c2                	or     %eax,%edx
+  8013d8:	09 ca                	or     %ecx,%edx
+  8013da:	f6 c2 03             	test   $0x3,%dl
+  8013dd:	75 0a                	jne    8013e9 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8013df:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8013e2:	89 c7                	mov    %eax,%edi
+  8013e4:	fc                   	cld
+  8013e5:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8013e7:	eb 05                	jmp    8013ee <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8013e9:	89 c7                	mov    %eax,%edi
+  8013eb:	fc                   	cld
+  8013ec:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8013ee:	5e                   	pop    %esi
+  8013ef:	5f                   	pop    %edi
+  8013f0:	5d                   	pop    %ebp
+  8013f1:	c3                   	ret
+
+008013f2 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8013f2:	55                   	push   %ebp
+  8013f3:	89 e5                	mov    %esp,%ebp
+  8013f5:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8013f8:	ff 75 10             	push   0x10(%ebp)
+  8013fb:	ff 75 0c             	push   0xc(%ebp)
+  8013fe:	ff 75 08             	push   0x8(%ebp)
+  801401:	e8 8a ff ff ff       	call   801390 <memmove>
+}
+  801406:	c9                   	leave
+  801407:	c3                   	ret
+
+00801408 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801408:	55                   	push   %ebp
+  801409:	89 e5                	mov    %esp,%ebp
+  80140b:	56                   	push   %esi
+  80140c:	53                   	push   %ebx
+  80140d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801410:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  801413:	89 c6                	mov    %eax,%esi
+  801415:	03 75 10             	add    0x10(%ebp),%esi
+  801418:	eb 06                	jmp    801420 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  80141a:	83 c0 01             	add    $0x1,%eax
+  80141d:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  801420:	39 f0                	cmp    %esi,%eax
+  801422:	74 14                	je     801438 <memcmp+0x30>
+		if (*s1 != *s2)
+  801424:	0f b6 08             	movzbl (%eax),%ecx
+  801427:	0f b6 1a             	movzbl (%edx),%ebx
+  80142a:	38 d9                	cmp    %bl,%cl
+  80142c:	74 ec                	je     80141a <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  80142e:	0f b6 c1             	movzbl %cl,%eax
+  801431:	0f b6 db             	movzbl %bl,%ebx
+  801434:	29 d8                	sub    %ebx,%eax
+  801436:	eb 05                	jmp    80143d <memcmp+0x35>
+	}
+
+	return 0;
+  801438:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80143d:	5b                   	pop    %ebx
+  80143e:	5e                   	pop    %esi
+  80143f:	5d                   	pop    %ebp
+  801440:	c3                   	ret
+
+00801441 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801441:	55                   	push   %ebp
+  801442:	89 e5                	mov    %esp,%ebp
+  801444:	8b 45 08             	mov    0x8(%ebp),%eax
+  801447:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  80144a:	89 c2                	mov    %eax,%edx
+  80144c:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  80144f:	eb 03                	jmp    801454 <memfind+0x13>
+  801451:	83 c0 01             	add    $0x1,%eax
+  801454:	39 d0                	cmp    %edx,%eax
+  801456:	73 04                	jae    80145c <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801458:	38 08                	cmp    %cl,(%eax)
+  80145a:	75 f5                	jne    801451 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  80145c:	5d                   	pop    %ebp
+  80145d:	c3                   	ret
+
+0080145e <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  80145e:	55                   	push   %ebp
+  80145f:	89 e5                	mov    %esp,%ebp
+  801461:	57                   	push   %edi
+  801462:	56                   	push   %esi
+  801463:	53                   	push   %ebx
+  801464:	8b 55 08             	mov    0x8(%ebp),%edx
+  801467:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  80146a:	eb 03                	jmp    80146f <strtol+0x11>
+		s++;
+  80146c:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  80146f:	0f b6 02             	movzbl (%edx),%eax
+  801472:	3c 20                	cmp    $0x20,%al
+  801474:	74 f6                	je     80146c <strtol+0xe>
+  801476:	3c 09                	cmp    $0x9,%al
+  801478:	74 f2                	je     80146c <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  80147a:	3c 2b                	cmp    $0x2b,%al
+  80147c:	74 2a                	je     8014a8 <strtol+0x4a>
+	int neg = 0;
+  80147e:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  801483:	3c 2d                	cmp    $0x2d,%al
+  801485:	74 2b                	je     8014b2 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801487:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  80148d:	75 0f                	jne    80149e <strtol+0x40>
+  80148f:	80 3a 30             	cmpb   $0x30,(%edx)
+  801492:	74 28                	je     8014bc <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  801494:	85 db                	test   %ebx,%ebx
+  801496:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80149b:	0f 44 d8             	cmove  %eax,%ebx
+  80149e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014a3:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8014a6:	eb 46                	jmp    8014ee <strtol+0x90>
+		s++;
+  8014a8:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  8014ab:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014b0:	eb d5                	jmp    801487 <strtol+0x29>
+		s++, neg = 1;
+  8014b2:	83 c2 01             	add    $0x1,%edx
+  8014b5:	bf 01 00 00 00       	mov    $0x1,%edi
+  8014ba:	eb cb                	jmp    801487 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8014bc:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8014c0:	74 0e                	je     8014d0 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  8014c2:	85 db                	test   %ebx,%ebx
+  8014c4:	75 d8                	jne    80149e <strtol+0x40>
+		s++, base = 8;
+  8014c6:	83 c2 01             	add    $0x1,%edx
+  8014c9:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8014ce:	eb ce                	jmp    80149e <strtol+0x40>
+		s += 2, base = 16;
+  8014d0:	83 c2 02             	add    $0x2,%edx
+  8014d3:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8014d8:	eb c4                	jmp    80149e <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  8014da:	0f be c0             	movsbl %al,%eax
+  8014dd:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  8014e0:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8014e3:	7d 3a                	jge    80151f <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  8014e5:	83 c2 01             	add    $0x1,%edx
+  8014e8:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  8014ec:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  8014ee:	0f b6 02             	movzbl (%edx),%eax
+  8014f1:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8014f4:	89 f3                	mov    %esi,%ebx
+  8014f6:	80 fb 09             	cmp    $0x9,%bl
+  8014f9:	76 df                	jbe    8014da <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  8014fb:	8d 70 9f             	lea    -0x61(%eax),%esi
+  8014fe:	89 f3                	mov    %esi,%ebx
+  801500:	80 fb 19             	cmp    $0x19,%bl
+  801503:	77 08                	ja     80150d <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  801505:	0f be c0             	movsbl %al,%eax
+  801508:	83 e8 57             	sub    $0x57,%eax
+  80150b:	eb d3                	jmp    8014e0 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  80150d:	8d 70 bf             	lea    -0x41(%eax),%esi
+  801510:	89 f3                	mov    %esi,%ebx
+  801512:	80 fb 19             	cmp    $0x19,%bl
+  801515:	77 08                	ja     80151f <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  801517:	0f be c0             	movsbl %al,%eax
+  80151a:	83 e8 37             	sub    $0x37,%eax
+  80151d:	eb c1                	jmp    8014e0 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  80151f:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  801523:	74 05                	je     80152a <strtol+0xcc>
+		*endptr = (char *) s;
+  801525:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801528:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  80152a:	89 c8                	mov    %ecx,%eax
+  80152c:	f7 d8                	neg    %eax
+  80152e:	85 ff                	test   %edi,%edi
+  801530:	0f 45 c8             	cmovne %eax,%ecx
+}
+  801533:	89 c8                	mov    %ecx,%eax
+  801535:	5b                   	pop    %ebx
+  801536:	5e                   	pop    %esi
+  801537:	5f                   	pop    %edi
+  801538:	5d                   	pop    %ebp
+  801539:	c3                   	ret
+
+0080153a <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80153a:	55                   	push   %ebp
+  80153b:	89 e5                	mov    %esp,%ebp
+  80153d:	57                   	push   %edi
+  80153e:	56                   	push   %esi
+  80153f:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  801540:	b8 00 00 00 00       	mov    $0x0,%eax
+  801545:	8b 55 08             	mov    0x8(%ebp),%edx
+  801548:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80154b:	89 c3                	mov    %eax,%ebx
+  80154d:	89 c7                	mov    %eax,%edi
+  80154f:	89 c6                	mov    %eax,%esi
+  801551:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  801553:	5b                   	pop    %ebx
+  801554:	5e                   	pop    %esi
+  801555:	5f                   	pop    %edi
+  801556:	5d                   	pop    %ebp
+  801557:	c3                   	ret
+
+00801558 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801558:	55                   	push   %ebp
+  801559:	89 e5                	mov    %esp,%ebp
+  80155b:	57                   	push   %edi
+  80155c:	56                   	push   %esi
+  80155d:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80155e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801563:	b8 01 00 00 00       	mov    $0x1,%eax
+  801568:	89 d1                	mov    %edx,%ecx
+  80156a:	89 d3                	mov    %edx,%ebx
+  80156c:	89 d7                	mov    %edx,%edi
+  80156e:	89 d6                	mov    %edx,%esi
+  801570:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  801572:	5b                   	pop    %ebx
+  801573:	5e                   	pop    %esi
+  801574:	5f                   	pop    %edi
+  801575:	5d                   	pop    %ebp
+  801576:	c3                   	ret
+
+00801577 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801577:	55                   	push   %ebp
+  801578:	89 e5                	mov    %esp,%ebp
+  80157a:	57                   	push   %edi
+  80157b:	56                   	push   %esi
+  80157c:	53                   	push   %ebx
+  80157d:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  801580:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801585:	8b 55 08             	mov    0x8(%ebp),%edx
+  801588:	b8 03 00 00 00       	mov    $0x3,%eax
+  80158d:	89 cb                	mov    %ecx,%ebx
+  80158f:	89 cf                	mov    %ecx,%edi
+  801591:	89 ce                	mov    %ecx,%esi
+  801593:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801595:	85 c0                	test   %eax,%eax
+  801597:	7f 08                	jg     8015a1 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  801599:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80159c:	5b                   	pop    %ebx
+  80159d:	5e                   	pop    %esi
+  80159e:	5f                   	pop    %edi
+  80159f:	5d                   	pop    %ebp
+  8015a0:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8015a1:	83 ec 0c             	sub    $0xc,%esp
+  8015a4:	50                   	push   %eax
+  8015a5:	6a 03                	push   $0x3
+  8015a7:	68 d3 3f 80 00       	push   $0x803fd3
+  8015ac:	6a 3e                	push   $0x3e
+  8015ae:	68 f0 3f 80 00       	push   $0x803ff0
+  8015b3:	e8 ce f4 ff ff       	call   800a86 <_panic>
+
+008015b8 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8015b8:	55                   	push   %ebp
+  8015b9:	89 e5                	mov    %esp,%ebp
+  8015bb:	57                   	push   %edi
+  8015bc:	56                   	push   %esi
+  8015bd:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8015be:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015c3:	b8 02 00 00 00       	mov    $0x2,%eax
+  8015c8:	89 d1                	mov    %edx,%ecx
+  8015ca:	89 d3                	mov    %edx,%ebx
+  8015cc:	89 d7                	mov    %edx,%edi
+  8015ce:	89 d6                	mov    %edx,%esi
+  8015d0:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  8015d2:	5b                   	pop    %ebx
+  8015d3:	5e                   	pop    %esi
+  8015d4:	5f                   	pop    %edi
+  8015d5:	5d                   	pop    %ebp
+  8015d6:	c3                   	ret
+
+008015d7 <sys_yield>:
+
+void
+sys_yield(void) {
+  8015d7:	55                   	push   %ebp
+  8015d8:	89 e5                	mov    %esp,%ebp
+  8015da:	57                   	push   %edi
+  8015db:	56                   	push   %esi
+  8015dc:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8015dd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015e2:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8015e7:	89 d1                	mov    %edx,%ecx
+  8015e9:	89 d3                	mov    %edx,%ebx
+  8015eb:	89 d7                	mov    %edx,%edi
+  8015ed:	89 d6                	mov    %edx,%esi
+  8015ef:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  8015f1:	5b                   	pop    %ebx
+  8015f2:	5e                   	pop    %esi
+  8015f3:	5f                   	pop    %edi
+  8015f4:	5d                   	pop    %ebp
+  8015f5:	c3                   	ret
+
+008015f6 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  8015f6:	55                   	push   %ebp
+  8015f7:	89 e5                	mov    %esp,%ebp
+  8015f9:	57                   	push   %edi
+  8015fa:	56                   	push   %esi
+  8015fb:	53                   	push   %ebx
+  8015fc:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8015ff:	be 00 00 00 00       	mov    $0x0,%esi
+  801604:	8b 55 08             	mov    0x8(%ebp),%edx
+  801607:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80160a:	b8 04 00 00 00       	mov    $0x4,%eax
+  80160f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801612:	89 f7                	mov    %esi,%edi
+  801614:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801616:	85 c0                	test   %eax,%eax
+  801618:	7f 08                	jg     801622 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  80161a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80161d:	5b                   	pop    %ebx
+  80161e:	5e                   	pop    %esi
+  80161f:	5f                   	pop    %edi
+  801620:	5d                   	pop    %ebp
+  801621:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801622:	83 ec 0c             	sub    $0xc,%esp
+  801625:	50                   	push   %eax
+  801626:	6a 04                	push   $0x4
+  801628:	68 d3 3f 80 00       	push   $0x803fd3
+  80162d:	6a 3e                	push   $0x3e
+  80162f:	68 f0 3f 80 00       	push   $0x803ff0
+  801634:	e8 4d f4 ff ff       	call   800a86 <_panic>
+
+00801639 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  801639:	55                   	push   %ebp
+  80163a:	89 e5                	mov    %esp,%ebp
+  80163c:	57                   	push   %edi
+  80163d:	56                   	push   %esi
+  80163e:	53                   	push   %ebx
+  80163f:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  801642:	8b 55 08             	mov    0x8(%ebp),%edx
+  801645:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801648:	b8 05 00 00 00       	mov    $0x5,%eax
+  80164d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801650:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801653:	8b 75 18             	mov    0x18(%ebp),%esi
+  801656:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801658:	85 c0                	test   %eax,%eax
+  80165a:	7f 08                	jg     801664 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  80165c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80165f:	5b                   	pop    %ebx
+  801660:	5e                   	pop    %esi
+  801661:	5f                   	pop    %edi
+  801662:	5d                   	pop    %ebp
+  801663:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801664:	83 ec 0c             	sub    $0xc,%esp
+  801667:	50                   	push   %eax
+  801668:	6a 05                	push   $0x5
+  80166a:	68 d3 3f 80 00       	push   $0x803fd3
+  80166f:	6a 3e                	push   $0x3e
+  801671:	68 f0 3f 80 00       	push   $0x803ff0
+  801676:	e8 0b f4 ff ff       	call   800a86 <_panic>
+
+0080167b <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  80167b:	55                   	push   %ebp
+  80167c:	89 e5                	mov    %esp,%ebp
+  80167e:	57                   	push   %edi
+  80167f:	56                   	push   %esi
+  801680:	53                   	push   %ebx
+  801681:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  801684:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801689:	8b 55 08             	mov    0x8(%ebp),%edx
+  80168c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80168f:	b8 06 00 00 00       	mov    $0x6,%eax
+  801694:	89 df                	mov    %ebx,%edi
+  801696:	89 de                	mov    %ebx,%esi
+  801698:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80169a:	85 c0                	test   %eax,%eax
+  80169c:	7f 08                	jg     8016a6 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  80169e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016a1:	5b                   	pop    %ebx
+  8016a2:	5e                   	pop    %esi
+  8016a3:	5f                   	pop    %edi
+  8016a4:	5d                   	pop    %ebp
+  8016a5:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8016a6:	83 ec 0c             	sub    $0xc,%esp
+  8016a9:	50                   	push   %eax
+  8016aa:	6a 06                	push   $0x6
+  8016ac:	68 d3 3f 80 00       	push   $0x803fd3
+  8016b1:	6a 3e                	push   $0x3e
+  8016b3:	68 f0 3f 80 00       	push   $0x803ff0
+  8016b8:	e8 c9 f3 ff ff       	call   800a86 <_panic>
+
+008016bd <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8016bd:	55                   	push   %ebp
+  8016be:	89 e5                	mov    %esp,%ebp
+  8016c0:	57                   	push   %edi
+  8016c1:	56                   	push   %esi
+  8016c2:	53                   	push   %ebx
+  8016c3:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8016c6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016cb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016ce:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016d1:	b8 08 00 00 00       	mov    $0x8,%eax
+  8016d6:	89 df                	mov    %ebx,%edi
+  8016d8:	89 de                	mov    %ebx,%esi
+  8016da:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8016dc:	85 c0                	test   %eax,%eax
+  8016de:	7f 08                	jg     8016e8 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8016e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016e3:	5b                   	pop    %ebx
+  8016e4:	5e                   	pop    %esi
+  8016e5:	5f                   	pop    %edi
+  8016e6:	5d                   	pop    %ebp
+  8016e7:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8016e8:	83 ec 0c             	sub    $0xc,%esp
+  8016eb:	50                   	push   %eax
+  8016ec:	6a 08                	push   $0x8
+  8016ee:	68 d3 3f 80 00       	push   $0x803fd3
+  8016f3:	6a 3e                	push   $0x3e
+  8016f5:	68 f0 3f 80 00       	push   $0x803ff0
+  8016fa:	e8 87 f3 ff ff       	call   800a86 <_panic>
+
+008016ff <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8016ff:	55                   	push   %ebp
+  801700:	89 e5                	mov    %esp,%ebp
+  801702:	57                   	push   %edi
+  801703:	56                   	push   %esi
+  801704:	53                   	push   %ebx
+  801705:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  801708:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80170d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801710:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801713:	b8 09 00 00 00       	mov    $0x9,%eax
+  801718:	89 df                	mov    %ebx,%edi
+  80171a:	89 de                	mov    %ebx,%esi
+  80171c:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80171e:	85 c0                	test   %eax,%eax
+  801720:	7f 08                	jg     80172a <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801722:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801725:	5b                   	pop    %ebx
+  801726:	5e                   	pop    %esi
+  801727:	5f                   	pop    %edi
+  801728:	5d                   	pop    %ebp
+  801729:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80172a:	83 ec 0c             	sub    $0xc,%esp
+  80172d:	50                   	push   %eax
+  80172e:	6a 09                	push   $0x9
+  801730:	68 d3 3f 80 00       	push   $0x803fd3
+  801735:	6a 3e                	push   $0x3e
+  801737:	68 f0 3f 80 00       	push   $0x803ff0
+  80173c:	e8 45 f3 ff ff       	call   800a86 <_panic>
+
+00801741 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801741:	55                   	push   %ebp
+  801742:	89 e5                	mov    %esp,%ebp
+  801744:	57                   	push   %edi
+  801745:	56                   	push   %esi
+  801746:	53                   	push   %ebx
+  801747:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  80174a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80174f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801752:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801755:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80175a:	89 df                	mov    %ebx,%edi
+  80175c:	89 de                	mov    %ebx,%esi
+  80175e:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801760:	85 c0                	test   %eax,%eax
+  801762:	7f 08                	jg     80176c <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801764:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801767:	5b                   	pop    %ebx
+  801768:	5e                   	pop    %esi
+  801769:	5f                   	pop    %edi
+  80176a:	5d                   	pop    %ebp
+  80176b:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80176c:	83 ec 0c             	sub    $0xc,%esp
+  80176f:	50                   	push   %eax
+  801770:	6a 0a                	push   $0xa
+  801772:	68 d3 3f 80 00       	push   $0x803fd3
+  801777:	6a 3e                	push   $0x3e
+  801779:	68 f0 3f 80 00       	push   $0x803ff0
+  80177e:	e8 03 f3 ff ff       	call   800a86 <_panic>
+
+00801783 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  801783:	55                   	push   %ebp
+  801784:	89 e5                	mov    %esp,%ebp
+  801786:	57                   	push   %edi
+  801787:	56                   	push   %esi
+  801788:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  801789:	8b 55 08             	mov    0x8(%ebp),%edx
+  80178c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80178f:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801794:	be 00 00 00 00       	mov    $0x0,%esi
+  801799:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80179c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80179f:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8017a1:	5b                   	pop    %ebx
+  8017a2:	5e                   	pop    %esi
+  8017a3:	5f                   	pop    %edi
+  8017a4:	5d                   	pop    %ebp
+  8017a5:	c3                   	ret
+
+008017a6 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  8017a6:	55                   	push   %ebp
+  8017a7:	89 e5                	mov    %esp,%ebp
+  8017a9:	57                   	push   %edi
+  8017aa:	56                   	push   %esi
+  8017ab:	53                   	push   %ebx
+  8017ac:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8017af:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017b7:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8017bc:	89 cb                	mov    %ecx,%ebx
+  8017be:	89 cf                	mov    %ecx,%edi
+  8017c0:	89 ce                	mov    %ecx,%esi
+  8017c2:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8017c4:	85 c0                	test   %eax,%eax
+  8017c6:	7f 08                	jg     8017d0 <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  8017c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017cb:	5b                   	pop    %ebx
+  8017cc:	5e                   	pop    %esi
+  8017cd:	5f                   	pop    %edi
+  8017ce:	5d                   	pop    %ebp
+  8017cf:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8017d0:	83 ec 0c             	sub    $0xc,%esp
+  8017d3:	50                   	push   %eax
+  8017d4:	6a 0d                	push   $0xd
+  8017d6:	68 d3 3f 80 00       	push   $0x803fd3
+  8017db:	6a 3e                	push   $0x3e
+  8017dd:	68 f0 3f 80 00       	push   $0x803ff0
+  8017e2:	e8 9f f2 ff ff       	call   800a86 <_panic>
+
+008017e7 <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  8017e7:	55                   	push   %ebp
+  8017e8:	89 e5                	mov    %esp,%ebp
+  8017ea:	57                   	push   %edi
+  8017eb:	56                   	push   %esi
+  8017ec:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8017ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017f2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017f5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017f8:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8017fd:	89 df                	mov    %ebx,%edi
+  8017ff:	89 de                	mov    %ebx,%esi
+  801801:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  801803:	5b                   	pop    %ebx
+  801804:	5e                   	pop    %esi
+  801805:	5f                   	pop    %edi
+  801806:	5d                   	pop    %ebp
+  801807:	c3                   	ret
+
+00801808 <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  801808:	55                   	push   %ebp
+  801809:	89 e5                	mov    %esp,%ebp
+  80180b:	57                   	push   %edi
+  80180c:	56                   	push   %esi
+  80180d:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80180e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801813:	8b 55 08             	mov    0x8(%ebp),%edx
+  801816:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80181b:	89 cb                	mov    %ecx,%ebx
+  80181d:	89 cf                	mov    %ecx,%edi
+  80181f:	89 ce                	mov    %ecx,%esi
+  801821:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  801823:	5b                   	pop    %ebx
+  801824:	5e                   	pop    %esi
+  801825:	5f                   	pop    %edi
+  801826:	5d                   	pop    %ebp
+  801827:	c3                   	ret
+
+00801828 <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  801828:	55                   	push   %ebp
+  801829:	89 e5                	mov    %esp,%ebp
+  80182b:	57                   	push   %edi
+  80182c:	56                   	push   %esi
+  80182d:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80182e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801833:	b8 10 00 00 00       	mov    $0x10,%eax
+  801838:	89 d1                	mov    %edx,%ecx
+  80183a:	89 d3                	mov    %edx,%ebx
+  80183c:	89 d7                	mov    %edx,%edi
+  80183e:	89 d6                	mov    %edx,%esi
+  801840:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801842:	5b                   	pop    %ebx
+  801843:	5e                   	pop    %esi
+  801844:	5f                   	pop    %edi
+  801845:	5d                   	pop    %ebp
+  801846:	c3                   	ret
+
+00801847 <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  801847:	55                   	push   %ebp
+  801848:	89 e5                	mov    %esp,%ebp
+  80184a:	57                   	push   %edi
+  80184b:	56                   	push   %esi
+  80184c:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80184d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801852:	8b 55 08             	mov    0x8(%ebp),%edx
+  801855:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801858:	b8 11 00 00 00       	mov    $0x11,%eax
+  80185d:	89 df                	mov    %ebx,%edi
+  80185f:	89 de                	mov    %ebx,%esi
+  801861:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  801863:	5b                   	pop    %ebx
+  801864:	5e                   	pop    %esi
+  801865:	5f                   	pop    %edi
+  801866:	5d                   	pop    %ebp
+  801867:	c3                   	ret
+
+00801868 <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  801868:	55                   	push   %ebp
+  801869:	89 e5                	mov    %esp,%ebp
+  80186b:	57                   	push   %edi
+  80186c:	56                   	push   %esi
+  80186d:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80186e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801873:	8b 55 08             	mov    0x8(%ebp),%edx
+  801876:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801879:	b8 12 00 00 00       	mov    $0x12,%eax
+  80187e:	89 df                	mov    %ebx,%edi
+  801880:	89 de                	mov    %ebx,%esi
+  801882:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  801884:	5b                   	pop    %ebx
+  801885:	5e                   	pop    %esi
+  801886:	5f                   	pop    %edi
+  801887:	5d                   	pop    %ebp
+  801888:	c3                   	ret
+
+00801889 <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  801889:	55                   	push   %ebp
+  80188a:	89 e5                	mov    %esp,%ebp
+  80188c:	57                   	push   %edi
+  80188d:	56                   	push   %esi
+  80188e:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80188f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801894:	8b 55 08             	mov    0x8(%ebp),%edx
+  801897:	b8 13 00 00 00       	mov    $0x13,%eax
+  80189c:	89 cb                	mov    %ecx,%ebx
+  80189e:	89 cf                	mov    %ecx,%edi
+  8018a0:	89 ce                	mov    %ecx,%esi
+  8018a2:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  8018a4:	5b                   	pop    %ebx
+  8018a5:	5e                   	pop    %esi
+  8018a6:	5f                   	pop    %edi
+  8018a7:	5d                   	pop    %ebp
+  8018a8:	c3                   	ret
+
+008018a9 <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  8018a9:	55                   	push   %ebp
+  8018aa:	89 e5                	mov    %esp,%ebp
+  8018ac:	57                   	push   %edi
+  8018ad:	56                   	push   %esi
+  8018ae:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8018af:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018b7:	b8 14 00 00 00       	mov    $0x14,%eax
+  8018bc:	89 cb                	mov    %ecx,%ebx
+  8018be:	89 cf                	mov    %ecx,%edi
+  8018c0:	89 ce                	mov    %ecx,%esi
+  8018c2:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  8018c4:	5b                   	pop    %ebx
+  8018c5:	5e                   	pop    %esi
+  8018c6:	5f                   	pop    %edi
+  8018c7:	5d                   	pop    %ebp
+  8018c8:	c3                   	ret
+
+008018c9 <pgfault>:
+//
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf) {
+  8018c9:	55                   	push   %ebp
+  8018ca:	89 e5                	mov    %esp,%ebp
+  8018cc:	53                   	push   %ebx
+  8018cd:	83 ec 04             	sub    $0x4,%esp
+  8018d0:	8b 45 08             	mov    0x8(%ebp),%eax
+    void *addr = (void *) utf->utf_fault_va;
+  8018d3:	8b 18                	mov    (%eax),%ebx
+    // Hint:
+    //   Use the read-only page table mappings at uvpt
+    //   (see <inc/memlayout.h>).
+
+    // LAB 4: Your code here.
+    if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P) ||
+  8018d5:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  8018d9:	0f 84 95 00 00 00    	je     801974 <pgfault+0xab>
+  8018df:	89 d8                	mov    %ebx,%eax
+  8018e1:	c1 e8 16             	shr    $0x16,%eax
+  8018e4:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8018eb:	a8 01                	test   $0x1,%al
+  8018ed:	0f 84 81 00 00 00    	je     801974 <pgfault+0xab>
+        (uvpt[PGNUM(addr)] & (PTE_P | PTE_COW)) != (PTE_P | PTE_COW)) {
+  8018f3:	89 d8                	mov    %ebx,%eax
+  8018f5:	c1 e8 0c             	shr    $0xc,%eax
+  8018f8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8018ff:	25 01 08 00 00       	and    $0x801,%eax
+    if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P) ||
+  801904:	3d 01 08 00 00       	cmp    $0x801,%eax
+  801909:	75 69                	jne    801974 <pgfault+0xab>
+    // Hint:
+    //   You should make three system calls.
+
+    // LAB 4: Your code here.
+
+    if (sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W))
+  80190b:	83 ec 04             	sub    $0x4,%esp
+  80190e:	6a 07                	push   $0x7
+  801910:	68 00 f0 7f 00       	push   $0x7ff000
+  801915:	6a 00                	push   $0x0
+  801917:	e8 da fc ff ff       	call   8015f6 <sys_page_alloc>
+  80191c:	83 c4 10             	add    $0x10,%esp
+  80191f:	85 c0                	test   %eax,%eax
+  801921:	75 65                	jne    801988 <pgfault+0xbf>
+        panic("sys_page_alloc failed");
+
+    addr = ROUNDDOWN(addr, PGSIZE);
+  801923:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+    memmove(PFTEMP, addr, PGSIZE);
+  801929:	83 ec 04             	sub    $0x4,%esp
+  80192c:	68 00 10 00 00       	push   $0x1000
+  801931:	53                   	push   %ebx
+  801932:	68 00 f0 7f 00       	push   $0x7ff000
+  801937:	e8 54 fa ff ff       	call   801390 <memmove>
+
+    if (sys_page_map(0, PFTEMP, 0, addr, PTE_P | PTE_U | PTE_W))
+  80193c:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801943:	53                   	push   %ebx
+  801944:	6a 00                	push   $0x0
+  801946:	68 00 f0 7f 00       	push   $0x7ff000
+  80194b:	6a 00                	push   $0x0
+  80194d:	e8 e7 fc ff ff       	call   801639 <sys_page_map>
+  801952:	83 c4 20             	add    $0x20,%esp
+  801955:	85 c0                	test   %eax,%eax
+  801957:	75 43                	jne    80199c <pgfault+0xd3>
+        panic("sys_page_map failed");
+    if (sys_page_unmap(0, PFTEMP))
+  801959:	83 ec 08             	sub    $0x8,%esp
+  80195c:	68 00 f0 7f 00       	push   $0x7ff000
+  801961:	6a 00                	push   $0x0
+  801963:	e8 13 fd ff ff       	call   80167b <sys_page_unmap>
+  801968:	83 c4 10             	add    $0x10,%esp
+  80196b:	85 c0                	test   %eax,%eax
+  80196d:	75 41                	jne    8019b0 <pgfault+0xe7>
+        panic("sys_page_unmap failed");
+
+}
+  80196f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801972:	c9                   	leave
+  801973:	c3                   	ret
+        panic("pgfault: faulting access invalid");
+  801974:	83 ec 04             	sub    $0x4,%esp
+  801977:	68 00 40 80 00       	push   $0x804000
+  80197c:	6a 1e                	push   $0x1e
+  80197e:	68 6c 40 80 00       	push   $0x80406c
+  801983:	e8 fe f0 ff ff       	call   800a86 <_panic>
+        panic("sys_page_alloc failed");
+  801988:	83 ec 04             	sub    $0x4,%esp
+  80198b:	68 df 40 80 00       	push   $0x8040df
+  801990:	6a 2a                	push   $0x2a
+  801992:	68 6c 40 80 00       	push   $0x80406c
+  801997:	e8 ea f0 ff ff       	call   800a86 <_panic>
+        panic("sys_page_map failed");
+  80199c:	83 ec 04             	sub    $0x4,%esp
+  80199f:	68 77 40 80 00       	push   $0x804077
+  8019a4:	6a 30                	push   $0x30
+  8019a6:	68 6c 40 80 00       	push   $0x80406c
+  8019ab:	e8 d6 f0 ff ff       	call   800a86 <_panic>
+        panic("sys_page_unmap failed");
+  8019b0:	83 ec 04             	sub    $0x4,%esp
+  8019b3:	68 8b 40 80 00       	push   $0x80408b
+  8019b8:	6a 32                	push   $0x32
+  8019ba:	68 6c 40 80 00       	push   $0x80406c
+  8019bf:	e8 c2 f0 ff ff       	call   800a86 <_panic>
+
+008019c4 <fork>:
+//   Remember to fix "thisenv" in the child process.
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void) {
+  8019c4:	55                   	push   %ebp
+  8019c5:	89 e5                	mov    %esp,%ebp
+  8019c7:	57                   	push   %edi
+  8019c8:	56                   	push   %esi
+  8019c9:	53                   	push   %ebx
+  8019ca:	83 ec 18             	sub    $0x18,%esp
+    // LAB 4: Your code here.
+    set_pgfault_handler(pgfault);
+  8019cd:	68 c9 18 80 00       	push   $0x8018c9
+  8019d2:	e8 37 1a 00 00       	call   80340e <set_pgfault_handler>
+
+// This must be inlined.  Exercise for reader: why?
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+  envid_t ret;
+  asm volatile("int %2"
+  8019d7:	b8 07 00 00 00       	mov    $0x7,%eax
+  8019dc:	cd 30                	int    $0x30
+  8019de:	89 c6                	mov    %eax,%esi
+
+    envid_t envid = sys_exofork();
+    if (envid < 0)
+  8019e0:	83 c4 10             	add    $0x10,%esp
+  8019e3:	85 c0                	test   %eax,%eax
+  8019e5:	78 2a                	js     801a11 <fork+0x4d>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+
+    uintptr_t addr;
+    for (addr = 0; addr < UTOP; addr += PGSIZE) {
+  8019e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (envid == 0) {
+  8019ec:	0f 85 a2 00 00 00    	jne    801a94 <fork+0xd0>
+        thisenv = &envs[ENVX(sys_getenvid())];
+  8019f2:	e8 c1 fb ff ff       	call   8015b8 <sys_getenvid>
+  8019f7:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8019fc:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8019ff:	c1 e0 04             	shl    $0x4,%eax
+  801a02:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801a07:	a3 28 64 80 00       	mov    %eax,0x806428
+        return 0;
+  801a0c:	e9 6c 01 00 00       	jmp    801b7d <fork+0x1b9>
+        panic("fork: sys_exofork error: %e", envid);
+  801a11:	50                   	push   %eax
+  801a12:	68 a1 40 80 00       	push   $0x8040a1
+  801a17:	6a 6f                	push   $0x6f
+  801a19:	68 6c 40 80 00       	push   $0x80406c
+  801a1e:	e8 63 f0 ff ff       	call   800a86 <_panic>
+        if ((r = sys_page_map(0, vptr, envid, vptr, uvpt[pn] & PTE_SYSCALL)) < 0)
+  801a23:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a2a:	83 ec 0c             	sub    $0xc,%esp
+  801a2d:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a32:	50                   	push   %eax
+  801a33:	57                   	push   %edi
+  801a34:	56                   	push   %esi
+  801a35:	57                   	push   %edi
+  801a36:	6a 00                	push   $0x0
+  801a38:	e8 fc fb ff ff       	call   801639 <sys_page_map>
+  801a3d:	83 c4 20             	add    $0x20,%esp
+  801a40:	85 c0                	test   %eax,%eax
+  801a42:	79 3e                	jns    801a82 <fork+0xbe>
+            panic("duppage :in sys_page_map %e", r);
+  801a44:	50                   	push   %eax
+  801a45:	68 bd 40 80 00       	push   $0x8040bd
+  801a4a:	6a 49                	push   $0x49
+  801a4c:	68 6c 40 80 00       	push   $0x80406c
+  801a51:	e8 30 f0 ff ff       	call   800a86 <_panic>
+            panic("duppage :in sys_page_map %e", r);
+  801a56:	50                   	push   %eax
+  801a57:	68 bd 40 80 00       	push   $0x8040bd
+  801a5c:	6a 4e                	push   $0x4e
+  801a5e:	68 6c 40 80 00       	push   $0x80406c
+  801a63:	e8 1e f0 ff ff       	call   800a86 <_panic>
+    } else if ((r = sys_page_map(0, vptr, envid, vptr, PTE_P | PTE_U)) < 0)
+  801a68:	83 ec 0c             	sub    $0xc,%esp
+  801a6b:	6a 05                	push   $0x5
+  801a6d:	57                   	push   %edi
+  801a6e:	56                   	push   %esi
+  801a6f:	57                   	push   %edi
+  801a70:	6a 00                	push   $0x0
+  801a72:	e8 c2 fb ff ff       	call   801639 <sys_page_map>
+  801a77:	83 c4 20             	add    $0x20,%esp
+  801a7a:	85 c0                	test   %eax,%eax
+  801a7c:	0f 88 ab 00 00 00    	js     801b2d <fork+0x169>
+    for (addr = 0; addr < UTOP; addr += PGSIZE) {
+  801a82:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801a88:	81 fb 00 00 c0 ee    	cmp    $0xeec00000,%ebx
+  801a8e:	0f 84 ab 00 00 00    	je     801b3f <fork+0x17b>
+        if (uvpd[PDX(addr)] & PTE_P && uvpt[PGNUM(addr)] & PTE_P && addr != UXSTACKTOP - PGSIZE) {
+  801a94:	89 d8                	mov    %ebx,%eax
+  801a96:	c1 e8 16             	shr    $0x16,%eax
+  801a99:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801aa0:	a8 01                	test   $0x1,%al
+  801aa2:	74 de                	je     801a82 <fork+0xbe>
+  801aa4:	89 d8                	mov    %ebx,%eax
+  801aa6:	c1 e8 0c             	shr    $0xc,%eax
+  801aa9:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801ab0:	f6 c2 01             	test   $0x1,%dl
+  801ab3:	74 cd                	je     801a82 <fork+0xbe>
+  801ab5:	81 fb 00 f0 bf ee    	cmp    $0xeebff000,%ebx
+  801abb:	74 c5                	je     801a82 <fork+0xbe>
+    void *vptr = (void *) (pn * PGSIZE);
+  801abd:	89 c7                	mov    %eax,%edi
+  801abf:	c1 e7 0c             	shl    $0xc,%edi
+    if (uvpt[pn] & PTE_SHARE) {
+  801ac2:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801ac9:	f6 c6 04             	test   $0x4,%dh
+  801acc:	0f 85 51 ff ff ff    	jne    801a23 <fork+0x5f>
+    } else if (uvpt[pn] & (PTE_W | PTE_COW)) {
+  801ad2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801ad9:	a9 02 08 00 00       	test   $0x802,%eax
+  801ade:	74 88                	je     801a68 <fork+0xa4>
+        if ((r = sys_page_map(0, vptr, envid, vptr, PTE_P | PTE_U | PTE_COW)) < 0)
+  801ae0:	83 ec 0c             	sub    $0xc,%esp
+  801ae3:	68 05 08 00 00       	push   $0x805
+  801ae8:	57                   	push   %edi
+  801ae9:	56                   	push   %esi
+  801aea:	57                   	push   %edi
+  801aeb:	6a 00                	push   $0x0
+  801aed:	e8 47 fb ff ff       	call   801639 <sys_page_map>
+  801af2:	83 c4 20             	add    $0x20,%esp
+  801af5:	85 c0                	test   %eax,%eax
+  801af7:	0f 88 59 ff ff ff    	js     801a56 <fork+0x92>
+        if ((r = sys_page_map(0, vptr, 0, vptr, PTE_P | PTE_U | PTE_COW)) < 0)
+  801afd:	83 ec 0c             	sub    $0xc,%esp
+  801b00:	68 05 08 00 00       	push   $0x805
+  801b05:	57                   	push   %edi
+  801b06:	6a 00                	push   $0x0
+  801b08:	57                   	push   %edi
+  801b09:	6a 00                	push   $0x0
+  801b0b:	e8 29 fb ff ff       	call   801639 <sys_page_map>
+  801b10:	83 c4 20             	add    $0x20,%esp
+  801b13:	85 c0                	test   %eax,%eax
+  801b15:	0f 89 67 ff ff ff    	jns    801a82 <fork+0xbe>
+            panic("duppage :in sys_page_map %e", r);
+  801b1b:	50                   	push   %eax
+  801b1c:	68 bd 40 80 00       	push   $0x8040bd
+  801b21:	6a 50                	push   $0x50
+  801b23:	68 6c 40 80 00       	push   $0x80406c
+  801b28:	e8 59 ef ff ff       	call   800a86 <_panic>
+        panic("duppage :in sys_page_map %e", r);
+  801b2d:	50                   	push   %eax
+  801b2e:	68 bd 40 80 00       	push   $0x8040bd
+  801b33:	6a 53                	push   $0x53
+  801b35:	68 6c 40 80 00       	push   $0x80406c
+  801b3a:	e8 47 ef ff ff       	call   800a86 <_panic>
+            duppage(envid, PGNUM(addr));
+        }
+    }
+    if (sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W))
+  801b3f:	83 ec 04             	sub    $0x4,%esp
+  801b42:	6a 07                	push   $0x7
+  801b44:	68 00 f0 bf ee       	push   $0xeebff000
+  801b49:	56                   	push   %esi
+  801b4a:	e8 a7 fa ff ff       	call   8015f6 <sys_page_alloc>
+  801b4f:	83 c4 10             	add    $0x10,%esp
+  801b52:	85 c0                	test   %eax,%eax
+  801b54:	75 31                	jne    801b87 <fork+0x1c3>
+        panic("fork: sys_page_alloc failed");
+    if (sys_env_set_pgfault_upcall(envid, _pgfault_upcall))
+  801b56:	83 ec 08             	sub    $0x8,%esp
+  801b59:	68 79 34 80 00       	push   $0x803479
+  801b5e:	56                   	push   %esi
+  801b5f:	e8 dd fb ff ff       	call   801741 <sys_env_set_pgfault_upcall>
+  801b64:	83 c4 10             	add    $0x10,%esp
+  801b67:	85 c0                	test   %eax,%eax
+  801b69:	75 30                	jne    801b9b <fork+0x1d7>
+        panic("fork: sys_env_set_pgfault_upcall failed");
+    if (sys_env_set_status(envid, ENV_RUNNABLE))
+  801b6b:	83 ec 08             	sub    $0x8,%esp
+  801b6e:	6a 02                	push   $0x2
+  801b70:	56                   	push   %esi
+  801b71:	e8 47 fb ff ff       	call   8016bd <sys_env_set_status>
+  801b76:	83 c4 10             	add    $0x10,%esp
+  801b79:	85 c0                	test   %eax,%eax
+  801b7b:	75 32                	jne    801baf <fork+0x1eb>
+        panic("fork: sys_env_set_status failed");
+
+    return envid;
+
+}
+  801b7d:	89 f0                	mov    %esi,%eax
+  801b7f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b82:	5b                   	pop    %ebx
+  801b83:	5e                   	pop    %esi
+  801b84:	5f                   	pop    %edi
+  801b85:	5d                   	pop    %ebp
+  801b86:	c3                   	ret
+        panic("fork: sys_page_alloc failed");
+  801b87:	83 ec 04             	sub    $0x4,%esp
+  801b8a:	68 d9 40 80 00       	push   $0x8040d9
+  801b8f:	6a 7d                	push   $0x7d
+  801b91:	68 6c 40 80 00       	push   $0x80406c
+  801b96:	e8 eb ee ff ff       	call   800a86 <_panic>
+        panic("fork: sys_env_set_pgfault_upcall failed");
+  801b9b:	83 ec 04             	sub    $0x4,%esp
+  801b9e:	68 24 40 80 00       	push   $0x804024
+  801ba3:	6a 7f                	push   $0x7f
+  801ba5:	68 6c 40 80 00       	push   $0x80406c
+  801baa:	e8 d7 ee ff ff       	call   800a86 <_panic>
+        panic("fork: sys_env_set_status failed");
+  801baf:	83 ec 04             	sub    $0x4,%esp
+  801bb2:	68 4c 40 80 00       	push   $0x80404c
+  801bb7:	68 81 00 00 00       	push   $0x81
+  801bbc:	68 6c 40 80 00       	push   $0x80406c
+  801bc1:	e8 c0 ee ff ff       	call   800a86 <_panic>
+
+00801bc6 <sfork>:
+
+// Challenge!
+int
+sfork(void) {
+  801bc6:	55                   	push   %ebp
+  801bc7:	89 e5                	mov    %esp,%ebp
+  801bc9:	83 ec 0c             	sub    $0xc,%esp
+    panic("sfork not implemented");
+  801bcc:	68 f5 40 80 00       	push   $0x8040f5
+  801bd1:	68 8a 00 00 00       	push   $0x8a
+  801bd6:	68 6c 40 80 00       	push   $0x80406c
+  801bdb:	e8 a6 ee ff ff       	call   800a86 <_panic>
+
+00801be0 <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args)
+{
+  801be0:	55                   	push   %ebp
+  801be1:	89 e5                	mov    %esp,%ebp
+  801be3:	8b 55 08             	mov    0x8(%ebp),%edx
+  801be6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801be9:	8b 45 10             	mov    0x10(%ebp),%eax
+	args->argc = argc;
+  801bec:	89 10                	mov    %edx,(%eax)
+	args->argv = (const char **) argv;
+  801bee:	89 48 04             	mov    %ecx,0x4(%eax)
+	args->curarg = (*argc > 1 && argv ? "" : 0);
+  801bf1:	83 3a 01             	cmpl   $0x1,(%edx)
+  801bf4:	7e 09                	jle    801bff <argstart+0x1f>
+  801bf6:	ba a1 3a 80 00       	mov    $0x803aa1,%edx
+  801bfb:	85 c9                	test   %ecx,%ecx
+  801bfd:	75 05                	jne    801c04 <argstart+0x24>
+  801bff:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c04:	89 50 08             	mov    %edx,0x8(%eax)
+	args->argvalue = 0;
+  801c07:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+}
+  801c0e:	5d                   	pop    %ebp
+  801c0f:	c3                   	ret
+
+00801c10 <argnext>:
+
+int
+argnext(struct Argstate *args)
+{
+  801c10:	55                   	push   %ebp
+  801c11:	89 e5                	mov    %esp,%ebp
+  801c13:	53                   	push   %ebx
+  801c14:	83 ec 04             	sub    $0x4,%esp
+  801c17:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int arg;
+
+	args->argvalue = 0;
+  801c1a:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+
+	// Done processing arguments if args->curarg == 0
+	if (args->curarg == 0)
+  801c21:	8b 43 08             	mov    0x8(%ebx),%eax
+  801c24:	85 c0                	test   %eax,%eax
+  801c26:	74 74                	je     801c9c <argnext+0x8c>
+		return -1;
+
+	if (!*args->curarg) {
+  801c28:	80 38 00             	cmpb   $0x0,(%eax)
+  801c2b:	75 48                	jne    801c75 <argnext+0x65>
+		// Need to process the next argument
+		// Check for end of argument list
+		if (*args->argc == 1
+  801c2d:	8b 0b                	mov    (%ebx),%ecx
+  801c2f:	83 39 01             	cmpl   $0x1,(%ecx)
+  801c32:	74 5a                	je     801c8e <argnext+0x7e>
+		    || args->argv[1][0] != '-'
+  801c34:	8b 53 04             	mov    0x4(%ebx),%edx
+  801c37:	8b 42 04             	mov    0x4(%edx),%eax
+  801c3a:	80 38 2d             	cmpb   $0x2d,(%eax)
+  801c3d:	75 4f                	jne    801c8e <argnext+0x7e>
+		    || args->argv[1][1] == '\0')
+  801c3f:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  801c43:	74 49                	je     801c8e <argnext+0x7e>
+			goto endofargs;
+		// Shift arguments down one
+		args->curarg = args->argv[1] + 1;
+  801c45:	83 c0 01             	add    $0x1,%eax
+  801c48:	89 43 08             	mov    %eax,0x8(%ebx)
+		memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  801c4b:	83 ec 04             	sub    $0x4,%esp
+  801c4e:	8b 01                	mov    (%ecx),%eax
+  801c50:	8d 04 85 fc ff ff ff 	lea    -0x4(,%eax,4),%eax
+  801c57:	50                   	push   %eax
+  801c58:	8d 42 08             	lea    0x8(%edx),%eax
+  801c5b:	50                   	push   %eax
+  801c5c:	83 c2 04             	add    $0x4,%edx
+  801c5f:	52                   	push   %edx
+  801c60:	e8 2b f7 ff ff       	call   801390 <memmove>
+		(*args->argc)--;
+  801c65:	8b 03                	mov    (%ebx),%eax
+  801c67:	83 28 01             	subl   $0x1,(%eax)
+		// Check for "--": end of argument list
+		if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  801c6a:	8b 43 08             	mov    0x8(%ebx),%eax
+  801c6d:	83 c4 10             	add    $0x10,%esp
+  801c70:	80 38 2d             	cmpb   $0x2d,(%eax)
+  801c73:	74 13                	je     801c88 <argnext+0x78>
+			goto endofargs;
+	}
+
+	arg = (unsigned char) *args->curarg;
+  801c75:	8b 43 08             	mov    0x8(%ebx),%eax
+  801c78:	0f b6 10             	movzbl (%eax),%edx
+	args->curarg++;
+  801c7b:	83 c0 01             	add    $0x1,%eax
+  801c7e:	89 43 08             	mov    %eax,0x8(%ebx)
+	return arg;
+
+    endofargs:
+	args->curarg = 0;
+	return -1;
+}
+  801c81:	89 d0                	mov    %edx,%eax
+  801c83:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c86:	c9                   	leave
+  801c87:	c3                   	ret
+		if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  801c88:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  801c8c:	75 e7                	jne    801c75 <argnext+0x65>
+	args->curarg = 0;
+  801c8e:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+	return -1;
+  801c95:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  801c9a:	eb e5                	jmp    801c81 <argnext+0x71>
+		return -1;
+  801c9c:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  801ca1:	eb de                	jmp    801c81 <argnext+0x71>
+
+00801ca3 <argnextvalue>:
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+}
+
+char *
+argnextvalue(struct Argstate *args)
+{
+  801ca3:	55                   	push   %ebp
+  801ca4:	89 e5                	mov    %esp,%ebp
+  801ca6:	53                   	push   %ebx
+  801ca7:	83 ec 04             	sub    $0x4,%esp
+  801caa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!args->curarg)
+  801cad:	8b 43 08             	mov    0x8(%ebx),%eax
+  801cb0:	85 c0                	test   %eax,%eax
+  801cb2:	74 12                	je     801cc6 <argnextvalue+0x23>
+		return 0;
+	if (*args->curarg) {
+  801cb4:	80 38 00             	cmpb   $0x0,(%eax)
+  801cb7:	74 12                	je     801ccb <argnextvalue+0x28>
+		args->argvalue = args->curarg;
+  801cb9:	89 43 0c             	mov    %eax,0xc(%ebx)
+		args->curarg = "";
+  801cbc:	c7 43 08 a1 3a 80 00 	movl   $0x803aa1,0x8(%ebx)
+		(*args->argc)--;
+	} else {
+		args->argvalue = 0;
+		args->curarg = 0;
+	}
+	return (char*) args->argvalue;
+  801cc3:	8b 43 0c             	mov    0xc(%ebx),%eax
+}
+  801cc6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cc9:	c9                   	leave
+  801cca:	c3                   	ret
+	} else if (*args->argc > 1) {
+  801ccb:	8b 13                	mov    (%ebx),%edx
+  801ccd:	83 3a 01             	cmpl   $0x1,(%edx)
+  801cd0:	7f 10                	jg     801ce2 <argnextvalue+0x3f>
+		args->argvalue = 0;
+  801cd2:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		args->curarg = 0;
+  801cd9:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  801ce0:	eb e1                	jmp    801cc3 <argnextvalue+0x20>
+		args->argvalue = args->argv[1];
+  801ce2:	8b 43 04             	mov    0x4(%ebx),%eax
+  801ce5:	8b 48 04             	mov    0x4(%eax),%ecx
+  801ce8:	89 4b 0c             	mov    %ecx,0xc(%ebx)
+		memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  801ceb:	83 ec 04             	sub    $0x4,%esp
+  801cee:	8b 12                	mov    (%edx),%edx
+  801cf0:	8d 14 95 fc ff ff ff 	lea    -0x4(,%edx,4),%edx
+  801cf7:	52                   	push   %edx
+  801cf8:	8d 50 08             	lea    0x8(%eax),%edx
+  801cfb:	52                   	push   %edx
+  801cfc:	83 c0 04             	add    $0x4,%eax
+  801cff:	50                   	push   %eax
+  801d00:	e8 8b f6 ff ff       	call   801390 <memmove>
+		(*args->argc)--;
+  801d05:	8b 03                	mov    (%ebx),%eax
+  801d07:	83 28 01             	subl   $0x1,(%eax)
+  801d0a:	83 c4 10             	add    $0x10,%esp
+  801d0d:	eb b4                	jmp    801cc3 <argnextvalue+0x20>
+
+00801d0f <argvalue>:
+{
+  801d0f:	55                   	push   %ebp
+  801d10:	89 e5                	mov    %esp,%ebp
+  801d12:	83 ec 08             	sub    $0x8,%esp
+  801d15:	8b 55 08             	mov    0x8(%ebp),%edx
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+  801d18:	8b 42 0c             	mov    0xc(%edx),%eax
+  801d1b:	85 c0                	test   %eax,%eax
+  801d1d:	74 02                	je     801d21 <argvalue+0x12>
+}
+  801d1f:	c9                   	leave
+  801d20:	c3                   	ret
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+  801d21:	83 ec 0c             	sub    $0xc,%esp
+  801d24:	52                   	push   %edx
+  801d25:	e8 79 ff ff ff       	call   801ca3 <argnextvalue>
+  801d2a:	83 c4 10             	add    $0x10,%esp
+  801d2d:	eb f0                	jmp    801d1f <argvalue+0x10>
+
+00801d2f <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801d2f:	55                   	push   %ebp
+  801d30:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801d32:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d35:	05 00 00 00 30       	add    $0x30000000,%eax
+  801d3a:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801d3d:	5d                   	pop    %ebp
+  801d3e:	c3                   	ret
+
+00801d3f <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801d3f:	55                   	push   %ebp
+  801d40:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801d42:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d45:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801d4a:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801d4f:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801d54:	5d                   	pop    %ebp
+  801d55:	c3                   	ret
+
+00801d56 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801d56:	55                   	push   %ebp
+  801d57:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801d59:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801d5e:	eb 02                	jmp    801d62 <fd_alloc+0xc>
+  801d60:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801d62:	89 c2                	mov    %eax,%edx
+  801d64:	c1 ea 16             	shr    $0x16,%edx
+  801d67:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801d6e:	f6 c2 01             	test   $0x1,%dl
+  801d71:	74 2b                	je     801d9e <fd_alloc+0x48>
+  801d73:	89 c2                	mov    %eax,%edx
+  801d75:	c1 ea 0c             	shr    $0xc,%edx
+  801d78:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801d7f:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801d85:	f6 c1 01             	test   $0x1,%cl
+  801d88:	74 14                	je     801d9e <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801d8a:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801d90:	75 ce                	jne    801d60 <fd_alloc+0xa>
+  801d92:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801d97:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801d9c:	eb 05                	jmp    801da3 <fd_alloc+0x4d>
+			return 0;
+  801d9e:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801da3:	8b 55 08             	mov    0x8(%ebp),%edx
+  801da6:	89 02                	mov    %eax,(%edx)
+}
+  801da8:	89 c8                	mov    %ecx,%eax
+  801daa:	5d                   	pop    %ebp
+  801dab:	c3                   	ret
+
+00801dac <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801dac:	55                   	push   %ebp
+  801dad:	89 e5                	mov    %esp,%ebp
+  801daf:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801db2:	83 f8 1f             	cmp    $0x1f,%eax
+  801db5:	77 30                	ja     801de7 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801db7:	c1 e0 0c             	shl    $0xc,%eax
+  801dba:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801dbf:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801dc5:	f6 c2 01             	test   $0x1,%dl
+  801dc8:	74 24                	je     801dee <fd_lookup+0x42>
+  801dca:	89 c2                	mov    %eax,%edx
+  801dcc:	c1 ea 0c             	shr    $0xc,%edx
+  801dcf:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801dd6:	f6 c2 01             	test   $0x1,%dl
+  801dd9:	74 1a                	je     801df5 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801ddb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801dde:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801de0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801de5:	5d                   	pop    %ebp
+  801de6:	c3                   	ret
+		return -E_INVAL;
+  801de7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801dec:	eb f7                	jmp    801de5 <fd_lookup+0x39>
+		return -E_INVAL;
+  801dee:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801df3:	eb f0                	jmp    801de5 <fd_lookup+0x39>
+  801df5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801dfa:	eb e9                	jmp    801de5 <fd_lookup+0x39>
+
+00801dfc <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801dfc:	55                   	push   %ebp
+  801dfd:	89 e5                	mov    %esp,%ebp
+  801dff:	53                   	push   %ebx
+  801e00:	83 ec 04             	sub    $0x4,%esp
+  801e03:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801e06:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e0b:	eb 03                	jmp    801e10 <dev_lookup+0x14>
+  801e0d:	83 c0 01             	add    $0x1,%eax
+  801e10:	8b 1c 85 88 41 80 00 	mov    0x804188(,%eax,4),%ebx
+  801e17:	85 db                	test   %ebx,%ebx
+  801e19:	74 0b                	je     801e26 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801e1b:	39 13                	cmp    %edx,(%ebx)
+  801e1d:	75 ee                	jne    801e0d <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801e1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e24:	eb 1f                	jmp    801e45 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801e26:	a1 28 64 80 00       	mov    0x806428,%eax
+  801e2b:	8b 40 48             	mov    0x48(%eax),%eax
+  801e2e:	83 ec 04             	sub    $0x4,%esp
+  801e31:	52                   	push   %edx
+  801e32:	50                   	push   %eax
+  801e33:	68 0c 41 80 00       	push   $0x80410c
+  801e38:	e8 24 ed ff ff       	call   800b61 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801e3d:	83 c4 10             	add    $0x10,%esp
+  801e40:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801e45:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e48:	89 1a                	mov    %ebx,(%edx)
+}
+  801e4a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e4d:	c9                   	leave
+  801e4e:	c3                   	ret
+
+00801e4f <fd_close>:
+{
+  801e4f:	55                   	push   %ebp
+  801e50:	89 e5                	mov    %esp,%ebp
+  801e52:	57                   	push   %edi
+  801e53:	56                   	push   %esi
+  801e54:	53                   	push   %ebx
+  801e55:	83 ec 24             	sub    $0x24,%esp
+  801e58:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e5b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801e5e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801e61:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801e62:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801e68:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801e6b:	50                   	push   %eax
+  801e6c:	e8 3b ff ff ff       	call   801dac <fd_lookup>
+  801e71:	89 c3                	mov    %eax,%ebx
+  801e73:	83 c4 10             	add    $0x10,%esp
+  801e76:	85 c0                	test   %eax,%eax
+  801e78:	78 05                	js     801e7f <fd_close+0x30>
+	    || fd != fd2)
+  801e7a:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801e7d:	74 16                	je     801e95 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801e7f:	89 f8                	mov    %edi,%eax
+  801e81:	84 c0                	test   %al,%al
+  801e83:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e88:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801e8b:	89 d8                	mov    %ebx,%eax
+  801e8d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e90:	5b                   	pop    %ebx
+  801e91:	5e                   	pop    %esi
+  801e92:	5f                   	pop    %edi
+  801e93:	5d                   	pop    %ebp
+  801e94:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801e95:	83 ec 08             	sub    $0x8,%esp
+  801e98:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801e9b:	50                   	push   %eax
+  801e9c:	ff 36                	push   (%esi)
+  801e9e:	e8 59 ff ff ff       	call   801dfc <dev_lookup>
+  801ea3:	89 c3                	mov    %eax,%ebx
+  801ea5:	83 c4 10             	add    $0x10,%esp
+  801ea8:	85 c0                	test   %eax,%eax
+  801eaa:	78 1a                	js     801ec6 <fd_close+0x77>
+		if (dev->dev_close)
+  801eac:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801eaf:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801eb2:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801eb7:	85 c0                	test   %eax,%eax
+  801eb9:	74 0b                	je     801ec6 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801ebb:	83 ec 0c             	sub    $0xc,%esp
+  801ebe:	56                   	push   %esi
+  801ebf:	ff d0                	call   *%eax
+  801ec1:	89 c3                	mov    %eax,%ebx
+  801ec3:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801ec6:	83 ec 08             	sub    $0x8,%esp
+  801ec9:	56                   	push   %esi
+  801eca:	6a 00                	push   $0x0
+  801ecc:	e8 aa f7 ff ff       	call   80167b <sys_page_unmap>
+	return r;
+  801ed1:	83 c4 10             	add    $0x10,%esp
+  801ed4:	eb b5                	jmp    801e8b <fd_close+0x3c>
+
+00801ed6 <close>:
+
+int
+close(int fdnum)
+{
+  801ed6:	55                   	push   %ebp
+  801ed7:	89 e5                	mov    %esp,%ebp
+  801ed9:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801edc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801edf:	50                   	push   %eax
+  801ee0:	ff 75 08             	push   0x8(%ebp)
+  801ee3:	e8 c4 fe ff ff       	call   801dac <fd_lookup>
+  801ee8:	83 c4 10             	add    $0x10,%esp
+  801eeb:	85 c0                	test   %eax,%eax
+  801eed:	79 02                	jns    801ef1 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801eef:	c9                   	leave
+  801ef0:	c3                   	ret
+		return fd_close(fd, 1);
+  801ef1:	83 ec 08             	sub    $0x8,%esp
+  801ef4:	6a 01                	push   $0x1
+  801ef6:	ff 75 f4             	push   -0xc(%ebp)
+  801ef9:	e8 51 ff ff ff       	call   801e4f <fd_close>
+  801efe:	83 c4 10             	add    $0x10,%esp
+  801f01:	eb ec                	jmp    801eef <close+0x19>
+
+00801f03 <close_all>:
+
+void
+close_all(void)
+{
+  801f03:	55                   	push   %ebp
+  801f04:	89 e5                	mov    %esp,%ebp
+  801f06:	53                   	push   %ebx
+  801f07:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801f0a:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801f0f:	83 ec 0c             	sub    $0xc,%esp
+  801f12:	53                   	push   %ebx
+  801f13:	e8 be ff ff ff       	call   801ed6 <close>
+	for (i = 0; i < MAXFD; i++)
+  801f18:	83 c3 01             	add    $0x1,%ebx
+  801f1b:	83 c4 10             	add    $0x10,%esp
+  801f1e:	83 fb 20             	cmp    $0x20,%ebx
+  801f21:	75 ec                	jne    801f0f <close_all+0xc>
+}
+  801f23:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f26:	c9                   	leave
+  801f27:	c3                   	ret
+
+00801f28 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801f28:	55                   	push   %ebp
+  801f29:	89 e5                	mov    %esp,%ebp
+  801f2b:	57                   	push   %edi
+  801f2c:	56                   	push   %esi
+  801f2d:	53                   	push   %ebx
+  801f2e:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801f31:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801f34:	50                   	push   %eax
+  801f35:	ff 75 08             	push   0x8(%ebp)
+  801f38:	e8 6f fe ff ff       	call   801dac <fd_lookup>
+  801f3d:	89 c3                	mov    %eax,%ebx
+  801f3f:	83 c4 10             	add    $0x10,%esp
+  801f42:	85 c0                	test   %eax,%eax
+  801f44:	78 7f                	js     801fc5 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801f46:	83 ec 0c             	sub    $0xc,%esp
+  801f49:	ff 75 0c             	push   0xc(%ebp)
+  801f4c:	e8 85 ff ff ff       	call   801ed6 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801f51:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801f54:	c1 e6 0c             	shl    $0xc,%esi
+  801f57:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801f5d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801f60:	89 3c 24             	mov    %edi,(%esp)
+  801f63:	e8 d7 fd ff ff       	call   801d3f <fd2data>
+  801f68:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801f6a:	89 34 24             	mov    %esi,(%esp)
+  801f6d:	e8 cd fd ff ff       	call   801d3f <fd2data>
+  801f72:	83 c4 10             	add    $0x10,%esp
+  801f75:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801f78:	89 d8                	mov    %ebx,%eax
+  801f7a:	c1 e8 16             	shr    $0x16,%eax
+  801f7d:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801f84:	a8 01                	test   $0x1,%al
+  801f86:	74 11                	je     801f99 <dup+0x71>
+  801f88:	89 d8                	mov    %ebx,%eax
+  801f8a:	c1 e8 0c             	shr    $0xc,%eax
+  801f8d:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801f94:	f6 c2 01             	test   $0x1,%dl
+  801f97:	75 36                	jne    801fcf <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801f99:	89 f8                	mov    %edi,%eax
+  801f9b:	c1 e8 0c             	shr    $0xc,%eax
+  801f9e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801fa5:	83 ec 0c             	sub    $0xc,%esp
+  801fa8:	25 07 0e 00 00       	and    $0xe07,%eax
+  801fad:	50                   	push   %eax
+  801fae:	56                   	push   %esi
+  801faf:	6a 00                	push   $0x0
+  801fb1:	57                   	push   %edi
+  801fb2:	6a 00                	push   $0x0
+  801fb4:	e8 80 f6 ff ff       	call   801639 <sys_page_map>
+  801fb9:	89 c3                	mov    %eax,%ebx
+  801fbb:	83 c4 20             	add    $0x20,%esp
+  801fbe:	85 c0                	test   %eax,%eax
+  801fc0:	78 33                	js     801ff5 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801fc2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801fc5:	89 d8                	mov    %ebx,%eax
+  801fc7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fca:	5b                   	pop    %ebx
+  801fcb:	5e                   	pop    %esi
+  801fcc:	5f                   	pop    %edi
+  801fcd:	5d                   	pop    %ebp
+  801fce:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801fcf:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801fd6:	83 ec 0c             	sub    $0xc,%esp
+  801fd9:	25 07 0e 00 00       	and    $0xe07,%eax
+  801fde:	50                   	push   %eax
+  801fdf:	ff 75 d4             	push   -0x2c(%ebp)
+  801fe2:	6a 00                	push   $0x0
+  801fe4:	53                   	push   %ebx
+  801fe5:	6a 00                	push   $0x0
+  801fe7:	e8 4d f6 ff ff       	call   801639 <sys_page_map>
+  801fec:	89 c3                	mov    %eax,%ebx
+  801fee:	83 c4 20             	add    $0x20,%esp
+  801ff1:	85 c0                	test   %eax,%eax
+  801ff3:	79 a4                	jns    801f99 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801ff5:	83 ec 08             	sub    $0x8,%esp
+  801ff8:	56                   	push   %esi
+  801ff9:	6a 00                	push   $0x0
+  801ffb:	e8 7b f6 ff ff       	call   80167b <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  802000:	83 c4 08             	add    $0x8,%esp
+  802003:	ff 75 d4             	push   -0x2c(%ebp)
+  802006:	6a 00                	push   $0x0
+  802008:	e8 6e f6 ff ff       	call   80167b <sys_page_unmap>
+	return r;
+  80200d:	83 c4 10             	add    $0x10,%esp
+  802010:	eb b3                	jmp    801fc5 <dup+0x9d>
+
+00802012 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  802012:	55                   	push   %ebp
+  802013:	89 e5                	mov    %esp,%ebp
+  802015:	56                   	push   %esi
+  802016:	53                   	push   %ebx
+  802017:	83 ec 18             	sub    $0x18,%esp
+  80201a:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80201d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802020:	50                   	push   %eax
+  802021:	56                   	push   %esi
+  802022:	e8 85 fd ff ff       	call   801dac <fd_lookup>
+  802027:	83 c4 10             	add    $0x10,%esp
+  80202a:	85 c0                	test   %eax,%eax
+  80202c:	78 3c                	js     80206a <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80202e:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  802031:	83 ec 08             	sub    $0x8,%esp
+  802034:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802037:	50                   	push   %eax
+  802038:	ff 33                	push   (%ebx)
+  80203a:	e8 bd fd ff ff       	call   801dfc <dev_lookup>
+  80203f:	83 c4 10             	add    $0x10,%esp
+  802042:	85 c0                	test   %eax,%eax
+  802044:	78 24                	js     80206a <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802046:	8b 43 08             	mov    0x8(%ebx),%eax
+  802049:	83 e0 03             	and    $0x3,%eax
+  80204c:	83 f8 01             	cmp    $0x1,%eax
+  80204f:	74 20                	je     802071 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  802051:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802054:	8b 40 08             	mov    0x8(%eax),%eax
+  802057:	85 c0                	test   %eax,%eax
+  802059:	74 37                	je     802092 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80205b:	83 ec 04             	sub    $0x4,%esp
+  80205e:	ff 75 10             	push   0x10(%ebp)
+  802061:	ff 75 0c             	push   0xc(%ebp)
+  802064:	53                   	push   %ebx
+  802065:	ff d0                	call   *%eax
+  802067:	83 c4 10             	add    $0x10,%esp
+}
+  80206a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80206d:	5b                   	pop    %ebx
+  80206e:	5e                   	pop    %esi
+  80206f:	5d                   	pop    %ebp
+  802070:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802071:	a1 28 64 80 00       	mov    0x806428,%eax
+  802076:	8b 40 48             	mov    0x48(%eax),%eax
+  802079:	83 ec 04             	sub    $0x4,%esp
+  80207c:	56                   	push   %esi
+  80207d:	50                   	push   %eax
+  80207e:	68 4d 41 80 00       	push   $0x80414d
+  802083:	e8 d9 ea ff ff       	call   800b61 <cprintf>
+		return -E_INVAL;
+  802088:	83 c4 10             	add    $0x10,%esp
+  80208b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802090:	eb d8                	jmp    80206a <read+0x58>
+		return -E_NOT_SUPP;
+  802092:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802097:	eb d1                	jmp    80206a <read+0x58>
+
+00802099 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  802099:	55                   	push   %ebp
+  80209a:	89 e5                	mov    %esp,%ebp
+  80209c:	57                   	push   %edi
+  80209d:	56                   	push   %esi
+  80209e:	53                   	push   %ebx
+  80209f:	83 ec 0c             	sub    $0xc,%esp
+  8020a2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8020a5:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8020a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8020ad:	eb 02                	jmp    8020b1 <readn+0x18>
+  8020af:	01 c3                	add    %eax,%ebx
+  8020b1:	39 f3                	cmp    %esi,%ebx
+  8020b3:	73 21                	jae    8020d6 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8020b5:	83 ec 04             	sub    $0x4,%esp
+  8020b8:	89 f0                	mov    %esi,%eax
+  8020ba:	29 d8                	sub    %ebx,%eax
+  8020bc:	50                   	push   %eax
+  8020bd:	89 d8                	mov    %ebx,%eax
+  8020bf:	03 45 0c             	add    0xc(%ebp),%eax
+  8020c2:	50                   	push   %eax
+  8020c3:	57                   	push   %edi
+  8020c4:	e8 49 ff ff ff       	call   802012 <read>
+		if (m < 0)
+  8020c9:	83 c4 10             	add    $0x10,%esp
+  8020cc:	85 c0                	test   %eax,%eax
+  8020ce:	78 04                	js     8020d4 <readn+0x3b>
+			return m;
+		if (m == 0)
+  8020d0:	75 dd                	jne    8020af <readn+0x16>
+  8020d2:	eb 02                	jmp    8020d6 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8020d4:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8020d6:	89 d8                	mov    %ebx,%eax
+  8020d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020db:	5b                   	pop    %ebx
+  8020dc:	5e                   	pop    %esi
+  8020dd:	5f                   	pop    %edi
+  8020de:	5d                   	pop    %ebp
+  8020df:	c3                   	ret
+
+008020e0 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8020e0:	55                   	push   %ebp
+  8020e1:	89 e5                	mov    %esp,%ebp
+  8020e3:	56                   	push   %esi
+  8020e4:	53                   	push   %ebx
+  8020e5:	83 ec 18             	sub    $0x18,%esp
+  8020e8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8020eb:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8020ee:	50                   	push   %eax
+  8020ef:	53                   	push   %ebx
+  8020f0:	e8 b7 fc ff ff       	call   801dac <fd_lookup>
+  8020f5:	83 c4 10             	add    $0x10,%esp
+  8020f8:	85 c0                	test   %eax,%eax
+  8020fa:	78 37                	js     802133 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8020fc:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8020ff:	83 ec 08             	sub    $0x8,%esp
+  802102:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802105:	50                   	push   %eax
+  802106:	ff 36                	push   (%esi)
+  802108:	e8 ef fc ff ff       	call   801dfc <dev_lookup>
+  80210d:	83 c4 10             	add    $0x10,%esp
+  802110:	85 c0                	test   %eax,%eax
+  802112:	78 1f                	js     802133 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802114:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802118:	74 20                	je     80213a <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80211a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80211d:	8b 40 0c             	mov    0xc(%eax),%eax
+  802120:	85 c0                	test   %eax,%eax
+  802122:	74 37                	je     80215b <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  802124:	83 ec 04             	sub    $0x4,%esp
+  802127:	ff 75 10             	push   0x10(%ebp)
+  80212a:	ff 75 0c             	push   0xc(%ebp)
+  80212d:	56                   	push   %esi
+  80212e:	ff d0                	call   *%eax
+  802130:	83 c4 10             	add    $0x10,%esp
+}
+  802133:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802136:	5b                   	pop    %ebx
+  802137:	5e                   	pop    %esi
+  802138:	5d                   	pop    %ebp
+  802139:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80213a:	a1 28 64 80 00       	mov    0x806428,%eax
+  80213f:	8b 40 48             	mov    0x48(%eax),%eax
+  802142:	83 ec 04             	sub    $0x4,%esp
+  802145:	53                   	push   %ebx
+  802146:	50                   	push   %eax
+  802147:	68 69 41 80 00       	push   $0x804169
+  80214c:	e8 10 ea ff ff       	call   800b61 <cprintf>
+		return -E_INVAL;
+  802151:	83 c4 10             	add    $0x10,%esp
+  802154:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802159:	eb d8                	jmp    802133 <write+0x53>
+		return -E_NOT_SUPP;
+  80215b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802160:	eb d1                	jmp    802133 <write+0x53>
+
+00802162 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  802162:	55                   	push   %ebp
+  802163:	89 e5                	mov    %esp,%ebp
+  802165:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802168:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80216b:	50                   	push   %eax
+  80216c:	ff 75 08             	push   0x8(%ebp)
+  80216f:	e8 38 fc ff ff       	call   801dac <fd_lookup>
+  802174:	83 c4 10             	add    $0x10,%esp
+  802177:	85 c0                	test   %eax,%eax
+  802179:	78 0e                	js     802189 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80217b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80217e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802181:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  802184:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802189:	c9                   	leave
+  80218a:	c3                   	ret
+
+0080218b <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80218b:	55                   	push   %ebp
+  80218c:	89 e5                	mov    %esp,%ebp
+  80218e:	56                   	push   %esi
+  80218f:	53                   	push   %ebx
+  802190:	83 ec 18             	sub    $0x18,%esp
+  802193:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802196:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802199:	50                   	push   %eax
+  80219a:	53                   	push   %ebx
+  80219b:	e8 0c fc ff ff       	call   801dac <fd_lookup>
+  8021a0:	83 c4 10             	add    $0x10,%esp
+  8021a3:	85 c0                	test   %eax,%eax
+  8021a5:	78 34                	js     8021db <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8021a7:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8021aa:	83 ec 08             	sub    $0x8,%esp
+  8021ad:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021b0:	50                   	push   %eax
+  8021b1:	ff 36                	push   (%esi)
+  8021b3:	e8 44 fc ff ff       	call   801dfc <dev_lookup>
+  8021b8:	83 c4 10             	add    $0x10,%esp
+  8021bb:	85 c0                	test   %eax,%eax
+  8021bd:	78 1c                	js     8021db <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8021bf:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8021c3:	74 1d                	je     8021e2 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8021c5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021c8:	8b 40 18             	mov    0x18(%eax),%eax
+  8021cb:	85 c0                	test   %eax,%eax
+  8021cd:	74 34                	je     802203 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8021cf:	83 ec 08             	sub    $0x8,%esp
+  8021d2:	ff 75 0c             	push   0xc(%ebp)
+  8021d5:	56                   	push   %esi
+  8021d6:	ff d0                	call   *%eax
+  8021d8:	83 c4 10             	add    $0x10,%esp
+}
+  8021db:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021de:	5b                   	pop    %ebx
+  8021df:	5e                   	pop    %esi
+  8021e0:	5d                   	pop    %ebp
+  8021e1:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8021e2:	a1 28 64 80 00       	mov    0x806428,%eax
+  8021e7:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8021ea:	83 ec 04             	sub    $0x4,%esp
+  8021ed:	53                   	push   %ebx
+  8021ee:	50                   	push   %eax
+  8021ef:	68 2c 41 80 00       	push   $0x80412c
+  8021f4:	e8 68 e9 ff ff       	call   800b61 <cprintf>
+		return -E_INVAL;
+  8021f9:	83 c4 10             	add    $0x10,%esp
+  8021fc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802201:	eb d8                	jmp    8021db <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  802203:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802208:	eb d1                	jmp    8021db <ftruncate+0x50>
+
+0080220a <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80220a:	55                   	push   %ebp
+  80220b:	89 e5                	mov    %esp,%ebp
+  80220d:	56                   	push   %esi
+  80220e:	53                   	push   %ebx
+  80220f:	83 ec 18             	sub    $0x18,%esp
+  802212:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802215:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802218:	50                   	push   %eax
+  802219:	ff 75 08             	push   0x8(%ebp)
+  80221c:	e8 8b fb ff ff       	call   801dac <fd_lookup>
+  802221:	83 c4 10             	add    $0x10,%esp
+  802224:	85 c0                	test   %eax,%eax
+  802226:	78 49                	js     802271 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802228:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80222b:	83 ec 08             	sub    $0x8,%esp
+  80222e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802231:	50                   	push   %eax
+  802232:	ff 36                	push   (%esi)
+  802234:	e8 c3 fb ff ff       	call   801dfc <dev_lookup>
+  802239:	83 c4 10             	add    $0x10,%esp
+  80223c:	85 c0                	test   %eax,%eax
+  80223e:	78 31                	js     802271 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  802240:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802243:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  802247:	74 2f                	je     802278 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  802249:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80224c:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  802253:	00 00 00 
+	stat->st_isdir = 0;
+  802256:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80225d:	00 00 00 
+	stat->st_dev = dev;
+  802260:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  802266:	83 ec 08             	sub    $0x8,%esp
+  802269:	53                   	push   %ebx
+  80226a:	56                   	push   %esi
+  80226b:	ff 50 14             	call   *0x14(%eax)
+  80226e:	83 c4 10             	add    $0x10,%esp
+}
+  802271:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802274:	5b                   	pop    %ebx
+  802275:	5e                   	pop    %esi
+  802276:	5d                   	pop    %ebp
+  802277:	c3                   	ret
+		return -E_NOT_SUPP;
+  802278:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80227d:	eb f2                	jmp    802271 <fstat+0x67>
+
+0080227f <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80227f:	55                   	push   %ebp
+  802280:	89 e5                	mov    %esp,%ebp
+  802282:	56                   	push   %esi
+  802283:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  802284:	83 ec 08             	sub    $0x8,%esp
+  802287:	6a 00                	push   $0x0
+  802289:	ff 75 08             	push   0x8(%ebp)
+  80228c:	e8 e4 01 00 00       	call   802475 <open>
+  802291:	89 c3                	mov    %eax,%ebx
+  802293:	83 c4 10             	add    $0x10,%esp
+  802296:	85 c0                	test   %eax,%eax
+  802298:	78 1b                	js     8022b5 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80229a:	83 ec 08             	sub    $0x8,%esp
+  80229d:	ff 75 0c             	push   0xc(%ebp)
+  8022a0:	50                   	push   %eax
+  8022a1:	e8 64 ff ff ff       	call   80220a <fstat>
+  8022a6:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8022a8:	89 1c 24             	mov    %ebx,(%esp)
+  8022ab:	e8 26 fc ff ff       	call   801ed6 <close>
+	return r;
+  8022b0:	83 c4 10             	add    $0x10,%esp
+  8022b3:	89 f3                	mov    %esi,%ebx
+}
+  8022b5:	89 d8                	mov    %ebx,%eax
+  8022b7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022ba:	5b                   	pop    %ebx
+  8022bb:	5e                   	pop    %esi
+  8022bc:	5d                   	pop    %ebp
+  8022bd:	c3                   	ret
+
+008022be <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  8022be:	55                   	push   %ebp
+  8022bf:	89 e5                	mov    %esp,%ebp
+  8022c1:	56                   	push   %esi
+  8022c2:	53                   	push   %ebx
+  8022c3:	89 c6                	mov    %eax,%esi
+  8022c5:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  8022c7:	83 3d 20 64 80 00 00 	cmpl   $0x0,0x806420
+  8022ce:	74 27                	je     8022f7 <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8022d0:	6a 07                	push   $0x7
+  8022d2:	68 00 70 80 00       	push   $0x807000
+  8022d7:	56                   	push   %esi
+  8022d8:	ff 35 20 64 80 00    	push   0x806420
+  8022de:	e8 2e 12 00 00       	call   803511 <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  8022e3:	83 c4 0c             	add    $0xc,%esp
+  8022e6:	6a 00                	push   $0x0
+  8022e8:	53                   	push   %ebx
+  8022e9:	6a 00                	push   $0x0
+  8022eb:	e8 ad 11 00 00       	call   80349d <ipc_recv>
+}
+  8022f0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022f3:	5b                   	pop    %ebx
+  8022f4:	5e                   	pop    %esi
+  8022f5:	5d                   	pop    %ebp
+  8022f6:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  8022f7:	83 ec 0c             	sub    $0xc,%esp
+  8022fa:	6a 01                	push   $0x1
+  8022fc:	e8 64 12 00 00       	call   803565 <ipc_find_env>
+  802301:	a3 20 64 80 00       	mov    %eax,0x806420
+  802306:	83 c4 10             	add    $0x10,%esp
+  802309:	eb c5                	jmp    8022d0 <fsipc+0x12>
+
+0080230b <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80230b:	55                   	push   %ebp
+  80230c:	89 e5                	mov    %esp,%ebp
+  80230e:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802311:	8b 45 08             	mov    0x8(%ebp),%eax
+  802314:	8b 40 0c             	mov    0xc(%eax),%eax
+  802317:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.set_size.req_size = newsize;
+  80231c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80231f:	a3 04 70 80 00       	mov    %eax,0x807004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  802324:	ba 00 00 00 00       	mov    $0x0,%edx
+  802329:	b8 02 00 00 00       	mov    $0x2,%eax
+  80232e:	e8 8b ff ff ff       	call   8022be <fsipc>
+}
+  802333:	c9                   	leave
+  802334:	c3                   	ret
+
+00802335 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802335:	55                   	push   %ebp
+  802336:	89 e5                	mov    %esp,%ebp
+  802338:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80233b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80233e:	8b 40 0c             	mov    0xc(%eax),%eax
+  802341:	a3 00 70 80 00       	mov    %eax,0x807000
+  return fsipc(FSREQ_FLUSH, NULL);
+  802346:	ba 00 00 00 00       	mov    $0x0,%edx
+  80234b:	b8 06 00 00 00       	mov    $0x6,%eax
+  802350:	e8 69 ff ff ff       	call   8022be <fsipc>
+}
+  802355:	c9                   	leave
+  802356:	c3                   	ret
+
+00802357 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802357:	55                   	push   %ebp
+  802358:	89 e5                	mov    %esp,%ebp
+  80235a:	53                   	push   %ebx
+  80235b:	83 ec 04             	sub    $0x4,%esp
+  80235e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802361:	8b 45 08             	mov    0x8(%ebp),%eax
+  802364:	8b 40 0c             	mov    0xc(%eax),%eax
+  802367:	a3 00 70 80 00       	mov    %eax,0x807000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80236c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802371:	b8 05 00 00 00       	mov    $0x5,%eax
+  802376:	e8 43 ff ff ff       	call   8022be <fsipc>
+  80237b:	85 c0                	test   %eax,%eax
+  80237d:	78 2c                	js     8023ab <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80237f:	83 ec 08             	sub    $0x8,%esp
+  802382:	68 00 70 80 00       	push   $0x807000
+  802387:	53                   	push   %ebx
+  802388:	e8 7d ee ff ff       	call   80120a <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  80238d:	a1 80 70 80 00       	mov    0x807080,%eax
+  802392:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802398:	a1 84 70 80 00       	mov    0x807084,%eax
+  80239d:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  8023a3:	83 c4 10             	add    $0x10,%esp
+  8023a6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023ab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023ae:	c9                   	leave
+  8023af:	c3                   	ret
+
+008023b0 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8023b0:	55                   	push   %ebp
+  8023b1:	89 e5                	mov    %esp,%ebp
+  8023b3:	83 ec 0c             	sub    $0xc,%esp
+  8023b6:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8023b9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8023bc:	8b 52 0c             	mov    0xc(%edx),%edx
+  8023bf:	89 15 00 70 80 00    	mov    %edx,0x807000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8023c5:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8023ca:	39 d0                	cmp    %edx,%eax
+  8023cc:	0f 47 c2             	cmova  %edx,%eax
+  8023cf:	a3 04 70 80 00       	mov    %eax,0x807004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  8023d4:	50                   	push   %eax
+  8023d5:	ff 75 0c             	push   0xc(%ebp)
+  8023d8:	68 08 70 80 00       	push   $0x807008
+  8023dd:	e8 ae ef ff ff       	call   801390 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  8023e2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023e7:	b8 04 00 00 00       	mov    $0x4,%eax
+  8023ec:	e8 cd fe ff ff       	call   8022be <fsipc>
+}
+  8023f1:	c9                   	leave
+  8023f2:	c3                   	ret
+
+008023f3 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8023f3:	55                   	push   %ebp
+  8023f4:	89 e5                	mov    %esp,%ebp
+  8023f6:	56                   	push   %esi
+  8023f7:	53                   	push   %ebx
+  8023f8:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8023fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023fe:	8b 40 0c             	mov    0xc(%eax),%eax
+  802401:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.read.req_n = n;
+  802406:	89 35 04 70 80 00    	mov    %esi,0x807004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  80240c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802411:	b8 03 00 00 00       	mov    $0x3,%eax
+  802416:	e8 a3 fe ff ff       	call   8022be <fsipc>
+  80241b:	89 c3                	mov    %eax,%ebx
+  80241d:	85 c0                	test   %eax,%eax
+  80241f:	78 1f                	js     802440 <devfile_read+0x4d>
+  assert(r <= n);
+  802421:	39 c6                	cmp    %eax,%esi
+  802423:	72 24                	jb     802449 <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  802425:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80242a:	7f 33                	jg     80245f <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80242c:	83 ec 04             	sub    $0x4,%esp
+  80242f:	50                   	push   %eax
+  802430:	68 00 70 80 00       	push   $0x807000
+  802435:	ff 75 0c             	push   0xc(%ebp)
+  802438:	e8 53 ef ff ff       	call   801390 <memmove>
+  return r;
+  80243d:	83 c4 10             	add    $0x10,%esp
+}
+  802440:	89 d8                	mov    %ebx,%eax
+  802442:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802445:	5b                   	pop    %ebx
+  802446:	5e                   	pop    %esi
+  802447:	5d                   	pop    %ebp
+  802448:	c3                   	ret
+  assert(r <= n);
+  802449:	68 9c 41 80 00       	push   $0x80419c
+  80244e:	68 cf 3b 80 00       	push   $0x803bcf
+  802453:	6a 78                	push   $0x78
+  802455:	68 a3 41 80 00       	push   $0x8041a3
+  80245a:	e8 27 e6 ff ff       	call   800a86 <_panic>
+  assert(r <= PGSIZE);
+  80245f:	68 ae 41 80 00       	push   $0x8041ae
+  802464:	68 cf 3b 80 00       	push   $0x803bcf
+  802469:	6a 79                	push   $0x79
+  80246b:	68 a3 41 80 00       	push   $0x8041a3
+  802470:	e8 11 e6 ff ff       	call   800a86 <_panic>
+
+00802475 <open>:
+open(const char *path, int mode) {
+  802475:	55                   	push   %ebp
+  802476:	89 e5                	mov    %esp,%ebp
+  802478:	56                   	push   %esi
+  802479:	53                   	push   %ebx
+  80247a:	83 ec 1c             	sub    $0x1c,%esp
+  80247d:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  802480:	56                   	push   %esi
+  802481:	e8 49 ed ff ff       	call   8011cf <strlen>
+  802486:	83 c4 10             	add    $0x10,%esp
+  802489:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80248e:	7f 6c                	jg     8024fc <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  802490:	83 ec 0c             	sub    $0xc,%esp
+  802493:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802496:	50                   	push   %eax
+  802497:	e8 ba f8 ff ff       	call   801d56 <fd_alloc>
+  80249c:	89 c3                	mov    %eax,%ebx
+  80249e:	83 c4 10             	add    $0x10,%esp
+  8024a1:	85 c0                	test   %eax,%eax
+  8024a3:	78 3c                	js     8024e1 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  8024a5:	83 ec 08             	sub    $0x8,%esp
+  8024a8:	56                   	push   %esi
+  8024a9:	68 00 70 80 00       	push   $0x807000
+  8024ae:	e8 57 ed ff ff       	call   80120a <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  8024b3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024b6:	a3 00 74 80 00       	mov    %eax,0x807400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8024bb:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8024be:	b8 01 00 00 00       	mov    $0x1,%eax
+  8024c3:	e8 f6 fd ff ff       	call   8022be <fsipc>
+  8024c8:	89 c3                	mov    %eax,%ebx
+  8024ca:	83 c4 10             	add    $0x10,%esp
+  8024cd:	85 c0                	test   %eax,%eax
+  8024cf:	78 19                	js     8024ea <open+0x75>
+  return fd2num(fd);
+  8024d1:	83 ec 0c             	sub    $0xc,%esp
+  8024d4:	ff 75 f4             	push   -0xc(%ebp)
+  8024d7:	e8 53 f8 ff ff       	call   801d2f <fd2num>
+  8024dc:	89 c3                	mov    %eax,%ebx
+  8024de:	83 c4 10             	add    $0x10,%esp
+}
+  8024e1:	89 d8                	mov    %ebx,%eax
+  8024e3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024e6:	5b                   	pop    %ebx
+  8024e7:	5e                   	pop    %esi
+  8024e8:	5d                   	pop    %ebp
+  8024e9:	c3                   	ret
+    fd_close(fd, 0);
+  8024ea:	83 ec 08             	sub    $0x8,%esp
+  8024ed:	6a 00                	push   $0x0
+  8024ef:	ff 75 f4             	push   -0xc(%ebp)
+  8024f2:	e8 58 f9 ff ff       	call   801e4f <fd_close>
+    return r;
+  8024f7:	83 c4 10             	add    $0x10,%esp
+  8024fa:	eb e5                	jmp    8024e1 <open+0x6c>
+    return -E_BAD_PATH;
+  8024fc:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802501:	eb de                	jmp    8024e1 <open+0x6c>
+
+00802503 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  802503:	55                   	push   %ebp
+  802504:	89 e5                	mov    %esp,%ebp
+  802506:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  802509:	ba 00 00 00 00       	mov    $0x0,%edx
+  80250e:	b8 08 00 00 00       	mov    $0x8,%eax
+  802513:	e8 a6 fd ff ff       	call   8022be <fsipc>
+}
+  802518:	c9                   	leave
+  802519:	c3                   	ret
+
+0080251a <writebuf>:
+
+
+static void
+writebuf(struct printbuf *b)
+{
+	if (b->error > 0) {
+  80251a:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  80251e:	7f 01                	jg     802521 <writebuf+0x7>
+  802520:	c3                   	ret
+{
+  802521:	55                   	push   %ebp
+  802522:	89 e5                	mov    %esp,%ebp
+  802524:	53                   	push   %ebx
+  802525:	83 ec 08             	sub    $0x8,%esp
+  802528:	89 c3                	mov    %eax,%ebx
+		ssize_t result = write(b->fd, b->buf, b->idx);
+  80252a:	ff 70 04             	push   0x4(%eax)
+  80252d:	8d 40 10             	lea    0x10(%eax),%eax
+  802530:	50                   	push   %eax
+  802531:	ff 33                	push   (%ebx)
+  802533:	e8 a8 fb ff ff       	call   8020e0 <write>
+		if (result > 0)
+  802538:	83 c4 10             	add    $0x10,%esp
+  80253b:	85 c0                	test   %eax,%eax
+  80253d:	7e 03                	jle    802542 <writebuf+0x28>
+			b->result += result;
+  80253f:	01 43 08             	add    %eax,0x8(%ebx)
+		if (result != b->idx) // error, or wrote less than supplied
+  802542:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802545:	74 0d                	je     802554 <writebuf+0x3a>
+			b->error = (result < 0 ? result : 0);
+  802547:	85 c0                	test   %eax,%eax
+  802549:	ba 00 00 00 00       	mov    $0x0,%edx
+  80254e:	0f 4f c2             	cmovg  %edx,%eax
+  802551:	89 43 0c             	mov    %eax,0xc(%ebx)
+	}
+}
+  802554:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802557:	c9                   	leave
+  802558:	c3                   	ret
+
+00802559 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  802559:	55                   	push   %ebp
+  80255a:	89 e5                	mov    %esp,%ebp
+  80255c:	53                   	push   %ebx
+  80255d:	83 ec 04             	sub    $0x4,%esp
+  802560:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct printbuf *b = (struct printbuf *) thunk;
+	b->buf[b->idx++] = ch;
+  802563:	8b 53 04             	mov    0x4(%ebx),%edx
+  802566:	8d 42 01             	lea    0x1(%edx),%eax
+  802569:	89 43 04             	mov    %eax,0x4(%ebx)
+  80256c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80256f:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+	if (b->idx == 256) {
+  802573:	3d 00 01 00 00       	cmp    $0x100,%eax
+  802578:	74 05                	je     80257f <putch+0x26>
+		writebuf(b);
+		b->idx = 0;
+	}
+}
+  80257a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80257d:	c9                   	leave
+  80257e:	c3                   	ret
+		writebuf(b);
+  80257f:	89 d8                	mov    %ebx,%eax
+  802581:	e8 94 ff ff ff       	call   80251a <writebuf>
+		b->idx = 0;
+  802586:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+  80258d:	eb eb                	jmp    80257a <putch+0x21>
+
+0080258f <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  80258f:	55                   	push   %ebp
+  802590:	89 e5                	mov    %esp,%ebp
+  802592:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.fd = fd;
+  802598:	8b 45 08             	mov    0x8(%ebp),%eax
+  80259b:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+	b.idx = 0;
+  8025a1:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  8025a8:	00 00 00 
+	b.result = 0;
+  8025ab:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8025b2:	00 00 00 
+	b.error = 1;
+  8025b5:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  8025bc:	00 00 00 
+	vprintfmt(putch, &b, fmt, ap);
+  8025bf:	ff 75 10             	push   0x10(%ebp)
+  8025c2:	ff 75 0c             	push   0xc(%ebp)
+  8025c5:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  8025cb:	50                   	push   %eax
+  8025cc:	68 59 25 80 00       	push   $0x802559
+  8025d1:	e8 82 e6 ff ff       	call   800c58 <vprintfmt>
+	if (b.idx > 0)
+  8025d6:	83 c4 10             	add    $0x10,%esp
+  8025d9:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  8025e0:	7f 12                	jg     8025f4 <vfprintf+0x65>
+		writebuf(&b);
+
+	return (b.result ? b.result : b.error);
+  8025e2:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  8025e8:	85 c0                	test   %eax,%eax
+  8025ea:	75 06                	jne    8025f2 <vfprintf+0x63>
+  8025ec:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  8025f2:	c9                   	leave
+  8025f3:	c3                   	ret
+		writebuf(&b);
+  8025f4:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  8025fa:	e8 1b ff ff ff       	call   80251a <writebuf>
+  8025ff:	eb e1                	jmp    8025e2 <vfprintf+0x53>
+
+00802601 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  802601:	55                   	push   %ebp
+  802602:	89 e5                	mov    %esp,%ebp
+  802604:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  802607:	8d 45 10             	lea    0x10(%ebp),%eax
+	cnt = vfprintf(fd, fmt, ap);
+  80260a:	50                   	push   %eax
+  80260b:	ff 75 0c             	push   0xc(%ebp)
+  80260e:	ff 75 08             	push   0x8(%ebp)
+  802611:	e8 79 ff ff ff       	call   80258f <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  802616:	c9                   	leave
+  802617:	c3                   	ret
+
+00802618 <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  802618:	55                   	push   %ebp
+  802619:	89 e5                	mov    %esp,%ebp
+  80261b:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80261e:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vfprintf(1, fmt, ap);
+  802621:	50                   	push   %eax
+  802622:	ff 75 08             	push   0x8(%ebp)
+  802625:	6a 01                	push   $0x1
+  802627:	e8 63 ff ff ff       	call   80258f <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80262c:	c9                   	leave
+  80262d:	c3                   	ret
+
+0080262e <spawn>:
+// prog: the pathname of the program to run.
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv) {
+  80262e:	55                   	push   %ebp
+  80262f:	89 e5                	mov    %esp,%ebp
+  802631:	57                   	push   %edi
+  802632:	56                   	push   %esi
+  802633:	53                   	push   %ebx
+  802634:	81 ec 84 02 00 00    	sub    $0x284,%esp
+  //   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+  //     correct initial eip and esp values in the child.
+  //
+  //   - Start the child process running with sys_env_set_status().
+
+  if ((r = open(prog, O_RDONLY)) < 0)
+  80263a:	6a 00                	push   $0x0
+  80263c:	ff 75 08             	push   0x8(%ebp)
+  80263f:	e8 31 fe ff ff       	call   802475 <open>
+  802644:	89 85 8c fd ff ff    	mov    %eax,-0x274(%ebp)
+  80264a:	83 c4 10             	add    $0x10,%esp
+  80264d:	85 c0                	test   %eax,%eax
+  80264f:	0f 88 f8 04 00 00    	js     802b4d <spawn+0x51f>
+  802655:	89 c1                	mov    %eax,%ecx
+    return r;
+  fd = r;
+
+  // Read elf header
+  elf = (struct Elf *) elf_buf;
+  if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf)
+  802657:	83 ec 04             	sub    $0x4,%esp
+  80265a:	68 00 02 00 00       	push   $0x200
+  80265f:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  802665:	50                   	push   %eax
+  802666:	51                   	push   %ecx
+  802667:	e8 2d fa ff ff       	call   802099 <readn>
+  80266c:	83 c4 10             	add    $0x10,%esp
+  80266f:	3d 00 02 00 00       	cmp    $0x200,%eax
+  802674:	75 5a                	jne    8026d0 <spawn+0xa2>
+      || elf->e_magic != ELF_MAGIC) {
+  802676:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  80267d:	45 4c 46 
+  802680:	75 4e                	jne    8026d0 <spawn+0xa2>
+  802682:	b8 07 00 00 00       	mov    $0x7,%eax
+  802687:	cd 30                	int    $0x30
+  802689:	89 85 88 fd ff ff    	mov    %eax,-0x278(%ebp)
+    cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+    return -E_NOT_EXEC;
+  }
+
+  // Create new child environment
+  if ((r = sys_exofork()) < 0)
+  80268f:	85 c0                	test   %eax,%eax
+  802691:	0f 88 aa 04 00 00    	js     802b41 <spawn+0x513>
+    return r;
+  child = r;
+
+  // Set up trap frame, including initial stack.
+  child_tf = envs[ENVX(child)].env_tf;
+  802697:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80269c:	8d 34 c0             	lea    (%eax,%eax,8),%esi
+  80269f:	c1 e6 04             	shl    $0x4,%esi
+  8026a2:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  8026a8:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  8026ae:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8026b3:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  child_tf.tf_eip = elf->e_entry;
+  8026b5:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  8026bb:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  uintptr_t *argv_store;
+
+  // Count the number of arguments (argc)
+  // and the total amount of space needed for strings (string_size).
+  string_size = 0;
+  for (argc = 0; argv[argc] != 0; argc++)
+  8026c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  string_size = 0;
+  8026c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8026cb:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  for (argc = 0; argv[argc] != 0; argc++)
+  8026ce:	eb 4b                	jmp    80271b <spawn+0xed>
+    close(fd);
+  8026d0:	83 ec 0c             	sub    $0xc,%esp
+  8026d3:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  8026d9:	e8 f8 f7 ff ff       	call   801ed6 <close>
+    cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  8026de:	83 c4 0c             	add    $0xc,%esp
+  8026e1:	68 7f 45 4c 46       	push   $0x464c457f
+  8026e6:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  8026ec:	68 ba 41 80 00       	push   $0x8041ba
+  8026f1:	e8 6b e4 ff ff       	call   800b61 <cprintf>
+    return -E_NOT_EXEC;
+  8026f6:	83 c4 10             	add    $0x10,%esp
+  8026f9:	c7 85 8c fd ff ff f2 	movl   $0xfffffff2,-0x274(%ebp)
+  802700:	ff ff ff 
+  802703:	e9 45 04 00 00       	jmp    802b4d <spawn+0x51f>
+    string_size += strlen(argv[argc]) + 1;
+  802708:	83 ec 0c             	sub    $0xc,%esp
+  80270b:	50                   	push   %eax
+  80270c:	e8 be ea ff ff       	call   8011cf <strlen>
+  802711:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+  for (argc = 0; argv[argc] != 0; argc++)
+  802715:	83 c3 01             	add    $0x1,%ebx
+  802718:	83 c4 10             	add    $0x10,%esp
+  80271b:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  80271e:	85 c0                	test   %eax,%eax
+  802720:	75 e6                	jne    802708 <spawn+0xda>
+  // Determine where to place the strings and the argv array.
+  // Set up pointers into the temporary page 'UTEMP'; we'll map a page
+  // there later, then remap that page into the child environment
+  // at (USTACKTOP - PGSIZE).
+  // strings is the topmost thing on the stack.
+  string_store = (char *) UTEMP + PGSIZE - string_size;
+  802722:	89 9d 84 fd ff ff    	mov    %ebx,-0x27c(%ebp)
+  802728:	bf 00 10 40 00       	mov    $0x401000,%edi
+  80272d:	29 f7                	sub    %esi,%edi
+  // argv is below that.  There's one argument pointer per argument, plus
+  // a null pointer.
+  argv_store = (uintptr_t *) (ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  80272f:	89 fa                	mov    %edi,%edx
+  802731:	83 e2 fc             	and    $0xfffffffc,%edx
+  802734:	8d 04 9d 04 00 00 00 	lea    0x4(,%ebx,4),%eax
+  80273b:	29 c2                	sub    %eax,%edx
+  80273d:	89 95 94 fd ff ff    	mov    %edx,-0x26c(%ebp)
+
+  // Make sure that argv, strings, and the 2 words that hold 'argc'
+  // and 'argv' themselves will all fit in a single stack page.
+  if ((void *) (argv_store - 2) < (void *) UTEMP)
+  802743:	8d 42 f8             	lea    -0x8(%edx),%eax
+  802746:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  80274b:	0f 86 1f 04 00 00    	jbe    802b70 <spawn+0x542>
+    return -E_NO_MEM;
+
+  // Allocate the single stack page at UTEMP.
+  if ((r = sys_page_alloc(0, (void *) UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  802751:	83 ec 04             	sub    $0x4,%esp
+  802754:	6a 07                	push   $0x7
+  802756:	68 00 00 40 00       	push   $0x400000
+  80275b:	6a 00                	push   $0x0
+  80275d:	e8 94 ee ff ff       	call   8015f6 <sys_page_alloc>
+  802762:	83 c4 10             	add    $0x10,%esp
+  802765:	85 c0                	test   %eax,%eax
+  802767:	0f 88 08 04 00 00    	js     802b75 <spawn+0x547>
+  //	  (Again, argv should use an address valid in the child's
+  //	  environment.)
+  //
+  //	* Set *init_esp to the initial stack pointer for the child,
+  //	  (Again, use an address valid in the child's environment.)
+  for (i = 0; i < argc; i++) {
+  80276d:	be 00 00 00 00       	mov    $0x0,%esi
+  802772:	89 9d 90 fd ff ff    	mov    %ebx,-0x270(%ebp)
+  802778:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80277b:	39 b5 90 fd ff ff    	cmp    %esi,-0x270(%ebp)
+  802781:	7e 32                	jle    8027b5 <spawn+0x187>
+    argv_store[i] = UTEMP2USTACK(string_store);
+  802783:	8d 87 00 d0 7f ee    	lea    -0x11803000(%edi),%eax
+  802789:	8b 8d 94 fd ff ff    	mov    -0x26c(%ebp),%ecx
+  80278f:	89 04 b1             	mov    %eax,(%ecx,%esi,4)
+    strcpy(string_store, argv[i]);
+  802792:	83 ec 08             	sub    $0x8,%esp
+  802795:	ff 34 b3             	push   (%ebx,%esi,4)
+  802798:	57                   	push   %edi
+  802799:	e8 6c ea ff ff       	call   80120a <strcpy>
+    string_store += strlen(argv[i]) + 1;
+  80279e:	83 c4 04             	add    $0x4,%esp
+  8027a1:	ff 34 b3             	push   (%ebx,%esi,4)
+  8027a4:	e8 26 ea ff ff       	call   8011cf <strlen>
+  8027a9:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+  for (i = 0; i < argc; i++) {
+  8027ad:	83 c6 01             	add    $0x1,%esi
+  8027b0:	83 c4 10             	add    $0x10,%esp
+  8027b3:	eb c6                	jmp    80277b <spawn+0x14d>
+  }
+  argv_store[argc] = 0;
+  8027b5:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  8027bb:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  8027c1:	c7 04 88 00 00 00 00 	movl   $0x0,(%eax,%ecx,4)
+  assert(string_store == (char *) UTEMP + PGSIZE);
+  8027c8:	81 ff 00 10 40 00    	cmp    $0x401000,%edi
+  8027ce:	0f 85 87 00 00 00    	jne    80285b <spawn+0x22d>
+
+  argv_store[-1] = UTEMP2USTACK(argv_store);
+  8027d4:	8b 8d 94 fd ff ff    	mov    -0x26c(%ebp),%ecx
+  8027da:	8d 81 00 d0 7f ee    	lea    -0x11803000(%ecx),%eax
+  8027e0:	89 41 fc             	mov    %eax,-0x4(%ecx)
+  argv_store[-2] = argc;
+  8027e3:	89 c8                	mov    %ecx,%eax
+  8027e5:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  8027eb:	89 48 f8             	mov    %ecx,-0x8(%eax)
+
+  *init_esp = UTEMP2USTACK(&argv_store[-2]);
+  8027ee:	2d 08 30 80 11       	sub    $0x11803008,%eax
+  8027f3:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+
+  // After completing the stack, map it into the child's address space
+  // and unmap it from ours!
+  if ((r = sys_page_map(0, UTEMP, child, (void *) (USTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  8027f9:	83 ec 0c             	sub    $0xc,%esp
+  8027fc:	6a 07                	push   $0x7
+  8027fe:	68 00 d0 bf ee       	push   $0xeebfd000
+  802803:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  802809:	68 00 00 40 00       	push   $0x400000
+  80280e:	6a 00                	push   $0x0
+  802810:	e8 24 ee ff ff       	call   801639 <sys_page_map>
+  802815:	89 c3                	mov    %eax,%ebx
+  802817:	83 c4 20             	add    $0x20,%esp
+  80281a:	85 c0                	test   %eax,%eax
+  80281c:	0f 88 5b 03 00 00    	js     802b7d <spawn+0x54f>
+    goto error;
+  if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  802822:	83 ec 08             	sub    $0x8,%esp
+  802825:	68 00 00 40 00       	push   $0x400000
+  80282a:	6a 00                	push   $0x0
+  80282c:	e8 4a ee ff ff       	call   80167b <sys_page_unmap>
+  802831:	89 c3                	mov    %eax,%ebx
+  802833:	83 c4 10             	add    $0x10,%esp
+  802836:	85 c0                	test   %eax,%eax
+  802838:	0f 88 3f 03 00 00    	js     802b7d <spawn+0x54f>
+  ph = (struct Proghdr *) (elf_buf + elf->e_phoff);
+  80283e:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  802844:	8d 8c 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%ecx
+  for (i = 0; i < elf->e_phnum; i++, ph++) {
+  80284b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802850:	89 c8                	mov    %ecx,%eax
+  802852:	89 d1                	mov    %edx,%ecx
+  802854:	89 c2                	mov    %eax,%edx
+  802856:	e9 5a 01 00 00       	jmp    8029b5 <spawn+0x387>
+  assert(string_store == (char *) UTEMP + PGSIZE);
+  80285b:	68 30 42 80 00       	push   $0x804230
+  802860:	68 cf 3b 80 00       	push   $0x803bcf
+  802865:	68 52 01 00 00       	push   $0x152
+  80286a:	68 d4 41 80 00       	push   $0x8041d4
+  80286f:	e8 12 e2 ff ff       	call   800a86 <_panic>
+      // allocate a blank page
+      if ((r = sys_page_alloc(child, (void *) (va + i), perm)) < 0)
+        return r;
+    } else {
+      // from file
+      if ((r = sys_page_alloc(0, UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  802874:	83 ec 04             	sub    $0x4,%esp
+  802877:	6a 07                	push   $0x7
+  802879:	68 00 00 40 00       	push   $0x400000
+  80287e:	6a 00                	push   $0x0
+  802880:	e8 71 ed ff ff       	call   8015f6 <sys_page_alloc>
+  802885:	83 c4 10             	add    $0x10,%esp
+  802888:	85 c0                	test   %eax,%eax
+  80288a:	0f 88 cb 02 00 00    	js     802b5b <spawn+0x52d>
+        return r;
+      if ((r = seek(fd, fileoffset + i)) < 0)
+  802890:	83 ec 08             	sub    $0x8,%esp
+  802893:	8b 95 80 fd ff ff    	mov    -0x280(%ebp),%edx
+  802899:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  80289f:	01 d0                	add    %edx,%eax
+  8028a1:	50                   	push   %eax
+  8028a2:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  8028a8:	e8 b5 f8 ff ff       	call   802162 <seek>
+  8028ad:	83 c4 10             	add    $0x10,%esp
+  8028b0:	85 c0                	test   %eax,%eax
+  8028b2:	0f 88 aa 02 00 00    	js     802b62 <spawn+0x534>
+        return r;
+      if ((r = readn(fd, UTEMP, MIN(PGSIZE, filesz - i))) < 0)
+  8028b8:	83 ec 04             	sub    $0x4,%esp
+  8028bb:	89 fa                	mov    %edi,%edx
+  8028bd:	8b 8d 94 fd ff ff    	mov    -0x26c(%ebp),%ecx
+  8028c3:	29 ca                	sub    %ecx,%edx
+  8028c5:	89 d0                	mov    %edx,%eax
+  8028c7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028cc:	39 d0                	cmp    %edx,%eax
+  8028ce:	0f 47 c2             	cmova  %edx,%eax
+  8028d1:	50                   	push   %eax
+  8028d2:	68 00 00 40 00       	push   $0x400000
+  8028d7:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  8028dd:	e8 b7 f7 ff ff       	call   802099 <readn>
+  8028e2:	83 c4 10             	add    $0x10,%esp
+  8028e5:	85 c0                	test   %eax,%eax
+  8028e7:	0f 88 7c 02 00 00    	js     802b69 <spawn+0x53b>
+        return r;
+      if ((r = sys_page_map(0, UTEMP, child, (void *) (va + i), perm)) < 0)
+  8028ed:	83 ec 0c             	sub    $0xc,%esp
+  8028f0:	ff b5 84 fd ff ff    	push   -0x27c(%ebp)
+  8028f6:	56                   	push   %esi
+  8028f7:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  8028fd:	68 00 00 40 00       	push   $0x400000
+  802902:	6a 00                	push   $0x0
+  802904:	e8 30 ed ff ff       	call   801639 <sys_page_map>
+  802909:	83 c4 20             	add    $0x20,%esp
+  80290c:	85 c0                	test   %eax,%eax
+  80290e:	78 7e                	js     80298e <spawn+0x360>
+        panic("spawn: sys_page_map data: %e", r);
+      sys_page_unmap(0, UTEMP);
+  802910:	83 ec 08             	sub    $0x8,%esp
+  802913:	68 00 00 40 00       	push   $0x400000
+  802918:	6a 00                	push   $0x0
+  80291a:	e8 5c ed ff ff       	call   80167b <sys_page_unmap>
+  80291f:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < memsz; i += PGSIZE) {
+  802922:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802928:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80292e:	89 9d 94 fd ff ff    	mov    %ebx,-0x26c(%ebp)
+  802934:	8b 85 90 fd ff ff    	mov    -0x270(%ebp),%eax
+  80293a:	39 c3                	cmp    %eax,%ebx
+  80293c:	73 65                	jae    8029a3 <spawn+0x375>
+    if (i >= filesz) {
+  80293e:	39 fb                	cmp    %edi,%ebx
+  802940:	0f 82 2e ff ff ff    	jb     802874 <spawn+0x246>
+      if ((r = sys_page_alloc(child, (void *) (va + i), perm)) < 0)
+  802946:	83 ec 04             	sub    $0x4,%esp
+  802949:	ff b5 84 fd ff ff    	push   -0x27c(%ebp)
+  80294f:	56                   	push   %esi
+  802950:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  802956:	e8 9b ec ff ff       	call   8015f6 <sys_page_alloc>
+  80295b:	83 c4 10             	add    $0x10,%esp
+  80295e:	85 c0                	test   %eax,%eax
+  802960:	79 c0                	jns    802922 <spawn+0x2f4>
+  802962:	89 c7                	mov    %eax,%edi
+  sys_env_destroy(child);
+  802964:	83 ec 0c             	sub    $0xc,%esp
+  802967:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  80296d:	e8 05 ec ff ff       	call   801577 <sys_env_destroy>
+  close(fd);
+  802972:	83 c4 04             	add    $0x4,%esp
+  802975:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  80297b:	e8 56 f5 ff ff       	call   801ed6 <close>
+  return r;
+  802980:	83 c4 10             	add    $0x10,%esp
+  802983:	89 bd 8c fd ff ff    	mov    %edi,-0x274(%ebp)
+  802989:	e9 bf 01 00 00       	jmp    802b4d <spawn+0x51f>
+        panic("spawn: sys_page_map data: %e", r);
+  80298e:	50                   	push   %eax
+  80298f:	68 e0 41 80 00       	push   $0x8041e0
+  802994:	68 84 01 00 00       	push   $0x184
+  802999:	68 d4 41 80 00       	push   $0x8041d4
+  80299e:	e8 e3 e0 ff ff       	call   800a86 <_panic>
+  8029a3:	8b 8d 7c fd ff ff    	mov    -0x284(%ebp),%ecx
+  8029a9:	8b 95 78 fd ff ff    	mov    -0x288(%ebp),%edx
+  for (i = 0; i < elf->e_phnum; i++, ph++) {
+  8029af:	83 c1 01             	add    $0x1,%ecx
+  8029b2:	83 c2 20             	add    $0x20,%edx
+  8029b5:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  8029bc:	39 c8                	cmp    %ecx,%eax
+  8029be:	0f 8e 88 00 00 00    	jle    802a4c <spawn+0x41e>
+    if (ph->p_type != ELF_PROG_LOAD)
+  8029c4:	83 3a 01             	cmpl   $0x1,(%edx)
+  8029c7:	75 e6                	jne    8029af <spawn+0x381>
+    if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  8029c9:	8b 42 18             	mov    0x18(%edx),%eax
+  8029cc:	83 e0 02             	and    $0x2,%eax
+    perm = PTE_P | PTE_U;
+  8029cf:	83 f8 01             	cmp    $0x1,%eax
+  8029d2:	19 c0                	sbb    %eax,%eax
+  8029d4:	83 e0 fe             	and    $0xfffffffe,%eax
+  8029d7:	83 c0 07             	add    $0x7,%eax
+    if ((r = map_segment(child, ph->p_va, ph->p_memsz, fd, ph->p_filesz, ph->p_offset, perm)) < 0)
+  8029da:	8b 72 04             	mov    0x4(%edx),%esi
+  8029dd:	89 b5 80 fd ff ff    	mov    %esi,-0x280(%ebp)
+  8029e3:	8b 7a 10             	mov    0x10(%edx),%edi
+  8029e6:	89 bd 94 fd ff ff    	mov    %edi,-0x26c(%ebp)
+  8029ec:	8b 5a 14             	mov    0x14(%edx),%ebx
+  8029ef:	89 9d 90 fd ff ff    	mov    %ebx,-0x270(%ebp)
+  8029f5:	8b 7a 08             	mov    0x8(%edx),%edi
+  8029f8:	89 bd 84 fd ff ff    	mov    %edi,-0x27c(%ebp)
+  if ((i = PGOFF(va))) {
+  8029fe:	89 fb                	mov    %edi,%ebx
+  802a00:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  802a06:	74 1c                	je     802a24 <spawn+0x3f6>
+    va -= i;
+  802a08:	29 df                	sub    %ebx,%edi
+  802a0a:	89 bd 84 fd ff ff    	mov    %edi,-0x27c(%ebp)
+    memsz += i;
+  802a10:	01 9d 90 fd ff ff    	add    %ebx,-0x270(%ebp)
+    filesz += i;
+  802a16:	01 9d 94 fd ff ff    	add    %ebx,-0x26c(%ebp)
+    fileoffset -= i;
+  802a1c:	29 de                	sub    %ebx,%esi
+  802a1e:	89 b5 80 fd ff ff    	mov    %esi,-0x280(%ebp)
+  for (i = 0; i < memsz; i += PGSIZE) {
+  802a24:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a29:	8b bd 94 fd ff ff    	mov    -0x26c(%ebp),%edi
+  802a2f:	8b b5 84 fd ff ff    	mov    -0x27c(%ebp),%esi
+  802a35:	89 8d 7c fd ff ff    	mov    %ecx,-0x284(%ebp)
+  802a3b:	89 95 78 fd ff ff    	mov    %edx,-0x288(%ebp)
+  802a41:	89 85 84 fd ff ff    	mov    %eax,-0x27c(%ebp)
+  802a47:	e9 e2 fe ff ff       	jmp    80292e <spawn+0x300>
+  close(fd);
+  802a4c:	83 ec 0c             	sub    $0xc,%esp
+  802a4f:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  802a55:	e8 7c f4 ff ff       	call   801ed6 <close>
+  802a5a:	83 c4 10             	add    $0x10,%esp
+  // LAB 5: Your code here.
+  int r;
+  unsigned perm = PTE_P | PTE_U | PTE_SHARE;
+
+  uintptr_t addr;
+  for (addr = 0; addr < UTOP; addr += PGSIZE)
+  802a5d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a62:	8b b5 88 fd ff ff    	mov    -0x278(%ebp),%esi
+  802a68:	eb 0e                	jmp    802a78 <spawn+0x44a>
+  802a6a:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802a70:	81 fb 00 00 c0 ee    	cmp    $0xeec00000,%ebx
+  802a76:	74 5e                	je     802ad6 <spawn+0x4a8>
+    if ((uvpd[PDX(addr)] & PTE_P) && (uvpt[PGNUM(addr)] & perm) == perm) {
+  802a78:	89 d8                	mov    %ebx,%eax
+  802a7a:	c1 e8 16             	shr    $0x16,%eax
+  802a7d:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802a84:	a8 01                	test   $0x1,%al
+  802a86:	74 e2                	je     802a6a <spawn+0x43c>
+  802a88:	89 da                	mov    %ebx,%edx
+  802a8a:	c1 ea 0c             	shr    $0xc,%edx
+  802a8d:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  802a94:	25 05 04 00 00       	and    $0x405,%eax
+  802a99:	3d 05 04 00 00       	cmp    $0x405,%eax
+  802a9e:	75 ca                	jne    802a6a <spawn+0x43c>
+      if ((r = sys_page_map(0, (void *) addr, child, (void *) addr, uvpt[PGNUM(addr)] & PTE_SYSCALL)) < 0) {
+  802aa0:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  802aa7:	83 ec 0c             	sub    $0xc,%esp
+  802aaa:	25 07 0e 00 00       	and    $0xe07,%eax
+  802aaf:	50                   	push   %eax
+  802ab0:	53                   	push   %ebx
+  802ab1:	56                   	push   %esi
+  802ab2:	53                   	push   %ebx
+  802ab3:	6a 00                	push   $0x0
+  802ab5:	e8 7f eb ff ff       	call   801639 <sys_page_map>
+  802aba:	83 c4 20             	add    $0x20,%esp
+  802abd:	85 c0                	test   %eax,%eax
+  802abf:	79 a9                	jns    802a6a <spawn+0x43c>
+        panic("copy_shared_pages : sys_page_map: %e\n", r);
+  802ac1:	50                   	push   %eax
+  802ac2:	68 58 42 80 00       	push   $0x804258
+  802ac7:	68 96 01 00 00       	push   $0x196
+  802acc:	68 d4 41 80 00       	push   $0x8041d4
+  802ad1:	e8 b0 df ff ff       	call   800a86 <_panic>
+  if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  802ad6:	83 ec 08             	sub    $0x8,%esp
+  802ad9:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  802adf:	50                   	push   %eax
+  802ae0:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  802ae6:	e8 14 ec ff ff       	call   8016ff <sys_env_set_trapframe>
+  802aeb:	83 c4 10             	add    $0x10,%esp
+  802aee:	85 c0                	test   %eax,%eax
+  802af0:	78 25                	js     802b17 <spawn+0x4e9>
+  if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  802af2:	83 ec 08             	sub    $0x8,%esp
+  802af5:	6a 02                	push   $0x2
+  802af7:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  802afd:	e8 bb eb ff ff       	call   8016bd <sys_env_set_status>
+  802b02:	83 c4 10             	add    $0x10,%esp
+  802b05:	85 c0                	test   %eax,%eax
+  802b07:	78 23                	js     802b2c <spawn+0x4fe>
+  return child;
+  802b09:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  802b0f:	89 85 8c fd ff ff    	mov    %eax,-0x274(%ebp)
+  802b15:	eb 36                	jmp    802b4d <spawn+0x51f>
+    panic("sys_env_set_trapframe: %e", r);
+  802b17:	50                   	push   %eax
+  802b18:	68 fd 41 80 00       	push   $0x8041fd
+  802b1d:	68 86 00 00 00       	push   $0x86
+  802b22:	68 d4 41 80 00       	push   $0x8041d4
+  802b27:	e8 5a df ff ff       	call   800a86 <_panic>
+    panic("sys_env_set_status: %e", r);
+  802b2c:	50                   	push   %eax
+  802b2d:	68 17 42 80 00       	push   $0x804217
+  802b32:	68 89 00 00 00       	push   $0x89
+  802b37:	68 d4 41 80 00       	push   $0x8041d4
+  802b3c:	e8 45 df ff ff       	call   800a86 <_panic>
+    return r;
+  802b41:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  802b47:	89 85 8c fd ff ff    	mov    %eax,-0x274(%ebp)
+}
+  802b4d:	8b 85 8c fd ff ff    	mov    -0x274(%ebp),%eax
+  802b53:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b56:	5b                   	pop    %ebx
+  802b57:	5e                   	pop    %esi
+  802b58:	5f                   	pop    %edi
+  802b59:	5d                   	pop    %ebp
+  802b5a:	c3                   	ret
+  802b5b:	89 c7                	mov    %eax,%edi
+  802b5d:	e9 02 fe ff ff       	jmp    802964 <spawn+0x336>
+  802b62:	89 c7                	mov    %eax,%edi
+  802b64:	e9 fb fd ff ff       	jmp    802964 <spawn+0x336>
+  802b69:	89 c7                	mov    %eax,%edi
+  802b6b:	e9 f4 fd ff ff       	jmp    802964 <spawn+0x336>
+    return -E_NO_MEM;
+  802b70:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  return r;
+  802b75:	89 85 8c fd ff ff    	mov    %eax,-0x274(%ebp)
+  802b7b:	eb d0                	jmp    802b4d <spawn+0x51f>
+  sys_page_unmap(0, UTEMP);
+  802b7d:	83 ec 08             	sub    $0x8,%esp
+  802b80:	68 00 00 40 00       	push   $0x400000
+  802b85:	6a 00                	push   $0x0
+  802b87:	e8 ef ea ff ff       	call   80167b <sys_page_unmap>
+  802b8c:	83 c4 10             	add    $0x10,%esp
+  802b8f:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+  802b95:	eb b6                	jmp    802b4d <spawn+0x51f>
+
+00802b97 <spawnl>:
+spawnl(const char *prog, const char *arg0, ...) {
+  802b97:	55                   	push   %ebp
+  802b98:	89 e5                	mov    %esp,%ebp
+  802b9a:	56                   	push   %esi
+  802b9b:	53                   	push   %ebx
+  va_start(vl, arg0);
+  802b9c:	8d 55 10             	lea    0x10(%ebp),%edx
+  int argc = 0;
+  802b9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  while (va_arg(vl, void *) != NULL)
+  802ba4:	eb 05                	jmp    802bab <spawnl+0x14>
+    argc++;
+  802ba6:	83 c0 01             	add    $0x1,%eax
+  while (va_arg(vl, void *) != NULL)
+  802ba9:	89 ca                	mov    %ecx,%edx
+  802bab:	8d 4a 04             	lea    0x4(%edx),%ecx
+  802bae:	83 3a 00             	cmpl   $0x0,(%edx)
+  802bb1:	75 f3                	jne    802ba6 <spawnl+0xf>
+  const char *argv[argc + 2];
+  802bb3:	8d 14 85 17 00 00 00 	lea    0x17(,%eax,4),%edx
+  802bba:	83 e2 f0             	and    $0xfffffff0,%edx
+  802bbd:	29 d4                	sub    %edx,%esp
+  802bbf:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  802bc3:	89 da                	mov    %ebx,%edx
+  802bc5:	c1 ea 02             	shr    $0x2,%edx
+  802bc8:	83 e3 fc             	and    $0xfffffffc,%ebx
+  argv[0] = arg0;
+  802bcb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802bce:	89 0c 95 00 00 00 00 	mov    %ecx,0x0(,%edx,4)
+  argv[argc + 1] = NULL;
+  802bd5:	c7 44 83 04 00 00 00 	movl   $0x0,0x4(%ebx,%eax,4)
+  802bdc:	00 
+  va_start(vl, arg0);
+  802bdd:	8d 4d 10             	lea    0x10(%ebp),%ecx
+  for (i = 0; i < argc; i++)
+  802be0:	89 c2                	mov    %eax,%edx
+  802be2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802be7:	eb 0b                	jmp    802bf4 <spawnl+0x5d>
+    argv[i + 1] = va_arg(vl, const char *);
+  802be9:	83 c0 01             	add    $0x1,%eax
+  802bec:	8b 31                	mov    (%ecx),%esi
+  802bee:	89 34 83             	mov    %esi,(%ebx,%eax,4)
+  802bf1:	8d 49 04             	lea    0x4(%ecx),%ecx
+  for (i = 0; i < argc; i++)
+  802bf4:	39 d0                	cmp    %edx,%eax
+  802bf6:	75 f1                	jne    802be9 <spawnl+0x52>
+  return spawn(prog, argv);
+  802bf8:	83 ec 08             	sub    $0x8,%esp
+  802bfb:	53                   	push   %ebx
+  802bfc:	ff 75 08             	push   0x8(%ebp)
+  802bff:	e8 2a fa ff ff       	call   80262e <spawn>
+}
+  802c04:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c07:	5b                   	pop    %ebx
+  802c08:	5e                   	pop    %esi
+  802c09:	5d                   	pop    %ebp
+  802c0a:	c3                   	ret
+
+00802c0b <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802c0b:	55                   	push   %ebp
+  802c0c:	89 e5                	mov    %esp,%ebp
+  802c0e:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802c11:	68 7e 42 80 00       	push   $0x80427e
+  802c16:	ff 75 0c             	push   0xc(%ebp)
+  802c19:	e8 ec e5 ff ff       	call   80120a <strcpy>
+	return 0;
+}
+  802c1e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c23:	c9                   	leave
+  802c24:	c3                   	ret
+
+00802c25 <devsock_close>:
+{
+  802c25:	55                   	push   %ebp
+  802c26:	89 e5                	mov    %esp,%ebp
+  802c28:	53                   	push   %ebx
+  802c29:	83 ec 10             	sub    $0x10,%esp
+  802c2c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802c2f:	53                   	push   %ebx
+  802c30:	e8 6f 09 00 00       	call   8035a4 <pageref>
+  802c35:	89 c2                	mov    %eax,%edx
+  802c37:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802c3a:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802c3f:	83 fa 01             	cmp    $0x1,%edx
+  802c42:	74 05                	je     802c49 <devsock_close+0x24>
+}
+  802c44:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c47:	c9                   	leave
+  802c48:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802c49:	83 ec 0c             	sub    $0xc,%esp
+  802c4c:	ff 73 0c             	push   0xc(%ebx)
+  802c4f:	e8 b7 02 00 00       	call   802f0b <nsipc_close>
+  802c54:	83 c4 10             	add    $0x10,%esp
+  802c57:	eb eb                	jmp    802c44 <devsock_close+0x1f>
+
+00802c59 <devsock_write>:
+{
+  802c59:	55                   	push   %ebp
+  802c5a:	89 e5                	mov    %esp,%ebp
+  802c5c:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802c5f:	6a 00                	push   $0x0
+  802c61:	ff 75 10             	push   0x10(%ebp)
+  802c64:	ff 75 0c             	push   0xc(%ebp)
+  802c67:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c6a:	ff 70 0c             	push   0xc(%eax)
+  802c6d:	e8 79 03 00 00       	call   802feb <nsipc_send>
+}
+  802c72:	c9                   	leave
+  802c73:	c3                   	ret
+
+00802c74 <devsock_read>:
+{
+  802c74:	55                   	push   %ebp
+  802c75:	89 e5                	mov    %esp,%ebp
+  802c77:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802c7a:	6a 00                	push   $0x0
+  802c7c:	ff 75 10             	push   0x10(%ebp)
+  802c7f:	ff 75 0c             	push   0xc(%ebp)
+  802c82:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c85:	ff 70 0c             	push   0xc(%eax)
+  802c88:	e8 ef 02 00 00       	call   802f7c <nsipc_recv>
+}
+  802c8d:	c9                   	leave
+  802c8e:	c3                   	ret
+
+00802c8f <fd2sockid>:
+{
+  802c8f:	55                   	push   %ebp
+  802c90:	89 e5                	mov    %esp,%ebp
+  802c92:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802c95:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802c98:	52                   	push   %edx
+  802c99:	50                   	push   %eax
+  802c9a:	e8 0d f1 ff ff       	call   801dac <fd_lookup>
+  802c9f:	83 c4 10             	add    $0x10,%esp
+  802ca2:	85 c0                	test   %eax,%eax
+  802ca4:	78 10                	js     802cb6 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802ca6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ca9:	8b 0d 3c 50 80 00    	mov    0x80503c,%ecx
+  802caf:	39 08                	cmp    %ecx,(%eax)
+  802cb1:	75 05                	jne    802cb8 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802cb3:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802cb6:	c9                   	leave
+  802cb7:	c3                   	ret
+		return -E_NOT_SUPP;
+  802cb8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802cbd:	eb f7                	jmp    802cb6 <fd2sockid+0x27>
+
+00802cbf <alloc_sockfd>:
+{
+  802cbf:	55                   	push   %ebp
+  802cc0:	89 e5                	mov    %esp,%ebp
+  802cc2:	56                   	push   %esi
+  802cc3:	53                   	push   %ebx
+  802cc4:	83 ec 1c             	sub    $0x1c,%esp
+  802cc7:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802cc9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802ccc:	50                   	push   %eax
+  802ccd:	e8 84 f0 ff ff       	call   801d56 <fd_alloc>
+  802cd2:	89 c3                	mov    %eax,%ebx
+  802cd4:	83 c4 10             	add    $0x10,%esp
+  802cd7:	85 c0                	test   %eax,%eax
+  802cd9:	78 43                	js     802d1e <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802cdb:	83 ec 04             	sub    $0x4,%esp
+  802cde:	68 07 04 00 00       	push   $0x407
+  802ce3:	ff 75 f4             	push   -0xc(%ebp)
+  802ce6:	6a 00                	push   $0x0
+  802ce8:	e8 09 e9 ff ff       	call   8015f6 <sys_page_alloc>
+  802ced:	89 c3                	mov    %eax,%ebx
+  802cef:	83 c4 10             	add    $0x10,%esp
+  802cf2:	85 c0                	test   %eax,%eax
+  802cf4:	78 28                	js     802d1e <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802cf6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802cf9:	8b 15 3c 50 80 00    	mov    0x80503c,%edx
+  802cff:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802d01:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d04:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802d0b:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802d0e:	83 ec 0c             	sub    $0xc,%esp
+  802d11:	50                   	push   %eax
+  802d12:	e8 18 f0 ff ff       	call   801d2f <fd2num>
+  802d17:	89 c3                	mov    %eax,%ebx
+  802d19:	83 c4 10             	add    $0x10,%esp
+  802d1c:	eb 0c                	jmp    802d2a <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802d1e:	83 ec 0c             	sub    $0xc,%esp
+  802d21:	56                   	push   %esi
+  802d22:	e8 e4 01 00 00       	call   802f0b <nsipc_close>
+		return r;
+  802d27:	83 c4 10             	add    $0x10,%esp
+}
+  802d2a:	89 d8                	mov    %ebx,%eax
+  802d2c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d2f:	5b                   	pop    %ebx
+  802d30:	5e                   	pop    %esi
+  802d31:	5d                   	pop    %ebp
+  802d32:	c3                   	ret
+
+00802d33 <accept>:
+{
+  802d33:	55                   	push   %ebp
+  802d34:	89 e5                	mov    %esp,%ebp
+  802d36:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802d39:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d3c:	e8 4e ff ff ff       	call   802c8f <fd2sockid>
+  802d41:	85 c0                	test   %eax,%eax
+  802d43:	78 1b                	js     802d60 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802d45:	83 ec 04             	sub    $0x4,%esp
+  802d48:	ff 75 10             	push   0x10(%ebp)
+  802d4b:	ff 75 0c             	push   0xc(%ebp)
+  802d4e:	50                   	push   %eax
+  802d4f:	e8 0e 01 00 00       	call   802e62 <nsipc_accept>
+  802d54:	83 c4 10             	add    $0x10,%esp
+  802d57:	85 c0                	test   %eax,%eax
+  802d59:	78 05                	js     802d60 <accept+0x2d>
+	return alloc_sockfd(r);
+  802d5b:	e8 5f ff ff ff       	call   802cbf <alloc_sockfd>
+}
+  802d60:	c9                   	leave
+  802d61:	c3                   	ret
+
+00802d62 <bind>:
+{
+  802d62:	55                   	push   %ebp
+  802d63:	89 e5                	mov    %esp,%ebp
+  802d65:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802d68:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d6b:	e8 1f ff ff ff       	call   802c8f <fd2sockid>
+  802d70:	85 c0                	test   %eax,%eax
+  802d72:	78 12                	js     802d86 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802d74:	83 ec 04             	sub    $0x4,%esp
+  802d77:	ff 75 10             	push   0x10(%ebp)
+  802d7a:	ff 75 0c             	push   0xc(%ebp)
+  802d7d:	50                   	push   %eax
+  802d7e:	e8 31 01 00 00       	call   802eb4 <nsipc_bind>
+  802d83:	83 c4 10             	add    $0x10,%esp
+}
+  802d86:	c9                   	leave
+  802d87:	c3                   	ret
+
+00802d88 <shutdown>:
+{
+  802d88:	55                   	push   %ebp
+  802d89:	89 e5                	mov    %esp,%ebp
+  802d8b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802d8e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d91:	e8 f9 fe ff ff       	call   802c8f <fd2sockid>
+  802d96:	85 c0                	test   %eax,%eax
+  802d98:	78 0f                	js     802da9 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802d9a:	83 ec 08             	sub    $0x8,%esp
+  802d9d:	ff 75 0c             	push   0xc(%ebp)
+  802da0:	50                   	push   %eax
+  802da1:	e8 43 01 00 00       	call   802ee9 <nsipc_shutdown>
+  802da6:	83 c4 10             	add    $0x10,%esp
+}
+  802da9:	c9                   	leave
+  802daa:	c3                   	ret
+
+00802dab <connect>:
+{
+  802dab:	55                   	push   %ebp
+  802dac:	89 e5                	mov    %esp,%ebp
+  802dae:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802db1:	8b 45 08             	mov    0x8(%ebp),%eax
+  802db4:	e8 d6 fe ff ff       	call   802c8f <fd2sockid>
+  802db9:	85 c0                	test   %eax,%eax
+  802dbb:	78 12                	js     802dcf <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802dbd:	83 ec 04             	sub    $0x4,%esp
+  802dc0:	ff 75 10             	push   0x10(%ebp)
+  802dc3:	ff 75 0c             	push   0xc(%ebp)
+  802dc6:	50                   	push   %eax
+  802dc7:	e8 59 01 00 00       	call   802f25 <nsipc_connect>
+  802dcc:	83 c4 10             	add    $0x10,%esp
+}
+  802dcf:	c9                   	leave
+  802dd0:	c3                   	ret
+
+00802dd1 <listen>:
+{
+  802dd1:	55                   	push   %ebp
+  802dd2:	89 e5                	mov    %esp,%ebp
+  802dd4:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802dd7:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dda:	e8 b0 fe ff ff       	call   802c8f <fd2sockid>
+  802ddf:	85 c0                	test   %eax,%eax
+  802de1:	78 0f                	js     802df2 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802de3:	83 ec 08             	sub    $0x8,%esp
+  802de6:	ff 75 0c             	push   0xc(%ebp)
+  802de9:	50                   	push   %eax
+  802dea:	e8 6b 01 00 00       	call   802f5a <nsipc_listen>
+  802def:	83 c4 10             	add    $0x10,%esp
+}
+  802df2:	c9                   	leave
+  802df3:	c3                   	ret
+
+00802df4 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802df4:	55                   	push   %ebp
+  802df5:	89 e5                	mov    %esp,%ebp
+  802df7:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802dfa:	ff 75 10             	push   0x10(%ebp)
+  802dfd:	ff 75 0c             	push   0xc(%ebp)
+  802e00:	ff 75 08             	push   0x8(%ebp)
+  802e03:	e8 41 02 00 00       	call   803049 <nsipc_socket>
+  802e08:	83 c4 10             	add    $0x10,%esp
+  802e0b:	85 c0                	test   %eax,%eax
+  802e0d:	78 05                	js     802e14 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802e0f:	e8 ab fe ff ff       	call   802cbf <alloc_sockfd>
+}
+  802e14:	c9                   	leave
+  802e15:	c3                   	ret
+
+00802e16 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802e16:	55                   	push   %ebp
+  802e17:	89 e5                	mov    %esp,%ebp
+  802e19:	53                   	push   %ebx
+  802e1a:	83 ec 04             	sub    $0x4,%esp
+  802e1d:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802e1f:	83 3d 24 64 80 00 00 	cmpl   $0x0,0x806424
+  802e26:	74 26                	je     802e4e <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802e28:	6a 07                	push   $0x7
+  802e2a:	68 00 80 80 00       	push   $0x808000
+  802e2f:	53                   	push   %ebx
+  802e30:	ff 35 24 64 80 00    	push   0x806424
+  802e36:	e8 d6 06 00 00       	call   803511 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802e3b:	83 c4 0c             	add    $0xc,%esp
+  802e3e:	6a 00                	push   $0x0
+  802e40:	6a 00                	push   $0x0
+  802e42:	6a 00                	push   $0x0
+  802e44:	e8 54 06 00 00       	call   80349d <ipc_recv>
+}
+  802e49:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e4c:	c9                   	leave
+  802e4d:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802e4e:	83 ec 0c             	sub    $0xc,%esp
+  802e51:	6a 02                	push   $0x2
+  802e53:	e8 0d 07 00 00       	call   803565 <ipc_find_env>
+  802e58:	a3 24 64 80 00       	mov    %eax,0x806424
+  802e5d:	83 c4 10             	add    $0x10,%esp
+  802e60:	eb c6                	jmp    802e28 <nsipc+0x12>
+
+00802e62 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802e62:	55                   	push   %ebp
+  802e63:	89 e5                	mov    %esp,%ebp
+  802e65:	56                   	push   %esi
+  802e66:	53                   	push   %ebx
+  802e67:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802e6a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e6d:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802e72:	8b 06                	mov    (%esi),%eax
+  802e74:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802e79:	b8 01 00 00 00       	mov    $0x1,%eax
+  802e7e:	e8 93 ff ff ff       	call   802e16 <nsipc>
+  802e83:	89 c3                	mov    %eax,%ebx
+  802e85:	85 c0                	test   %eax,%eax
+  802e87:	79 09                	jns    802e92 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802e89:	89 d8                	mov    %ebx,%eax
+  802e8b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e8e:	5b                   	pop    %ebx
+  802e8f:	5e                   	pop    %esi
+  802e90:	5d                   	pop    %ebp
+  802e91:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802e92:	83 ec 04             	sub    $0x4,%esp
+  802e95:	ff 35 10 80 80 00    	push   0x808010
+  802e9b:	68 00 80 80 00       	push   $0x808000
+  802ea0:	ff 75 0c             	push   0xc(%ebp)
+  802ea3:	e8 e8 e4 ff ff       	call   801390 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802ea8:	a1 10 80 80 00       	mov    0x808010,%eax
+  802ead:	89 06                	mov    %eax,(%esi)
+  802eaf:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802eb2:	eb d5                	jmp    802e89 <nsipc_accept+0x27>
+
+00802eb4 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802eb4:	55                   	push   %ebp
+  802eb5:	89 e5                	mov    %esp,%ebp
+  802eb7:	53                   	push   %ebx
+  802eb8:	83 ec 08             	sub    $0x8,%esp
+  802ebb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802ebe:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ec1:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802ec6:	53                   	push   %ebx
+  802ec7:	ff 75 0c             	push   0xc(%ebp)
+  802eca:	68 04 80 80 00       	push   $0x808004
+  802ecf:	e8 bc e4 ff ff       	call   801390 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802ed4:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  802eda:	b8 02 00 00 00       	mov    $0x2,%eax
+  802edf:	e8 32 ff ff ff       	call   802e16 <nsipc>
+}
+  802ee4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ee7:	c9                   	leave
+  802ee8:	c3                   	ret
+
+00802ee9 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802ee9:	55                   	push   %ebp
+  802eea:	89 e5                	mov    %esp,%ebp
+  802eec:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802eef:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ef2:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  802ef7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802efa:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  802eff:	b8 03 00 00 00       	mov    $0x3,%eax
+  802f04:	e8 0d ff ff ff       	call   802e16 <nsipc>
+}
+  802f09:	c9                   	leave
+  802f0a:	c3                   	ret
+
+00802f0b <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802f0b:	55                   	push   %ebp
+  802f0c:	89 e5                	mov    %esp,%ebp
+  802f0e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802f11:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f14:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  802f19:	b8 04 00 00 00       	mov    $0x4,%eax
+  802f1e:	e8 f3 fe ff ff       	call   802e16 <nsipc>
+}
+  802f23:	c9                   	leave
+  802f24:	c3                   	ret
+
+00802f25 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802f25:	55                   	push   %ebp
+  802f26:	89 e5                	mov    %esp,%ebp
+  802f28:	53                   	push   %ebx
+  802f29:	83 ec 08             	sub    $0x8,%esp
+  802f2c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802f2f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f32:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802f37:	53                   	push   %ebx
+  802f38:	ff 75 0c             	push   0xc(%ebp)
+  802f3b:	68 04 80 80 00       	push   $0x808004
+  802f40:	e8 4b e4 ff ff       	call   801390 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802f45:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  802f4b:	b8 05 00 00 00       	mov    $0x5,%eax
+  802f50:	e8 c1 fe ff ff       	call   802e16 <nsipc>
+}
+  802f55:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f58:	c9                   	leave
+  802f59:	c3                   	ret
+
+00802f5a <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802f5a:	55                   	push   %ebp
+  802f5b:	89 e5                	mov    %esp,%ebp
+  802f5d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802f60:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f63:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  802f68:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f6b:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  802f70:	b8 06 00 00 00       	mov    $0x6,%eax
+  802f75:	e8 9c fe ff ff       	call   802e16 <nsipc>
+}
+  802f7a:	c9                   	leave
+  802f7b:	c3                   	ret
+
+00802f7c <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802f7c:	55                   	push   %ebp
+  802f7d:	89 e5                	mov    %esp,%ebp
+  802f7f:	56                   	push   %esi
+  802f80:	53                   	push   %ebx
+  802f81:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802f84:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f87:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  802f8c:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  802f92:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f95:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802f9a:	b8 07 00 00 00       	mov    $0x7,%eax
+  802f9f:	e8 72 fe ff ff       	call   802e16 <nsipc>
+  802fa4:	89 c3                	mov    %eax,%ebx
+  802fa6:	85 c0                	test   %eax,%eax
+  802fa8:	78 22                	js     802fcc <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802faa:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802faf:	39 c6                	cmp    %eax,%esi
+  802fb1:	0f 4e c6             	cmovle %esi,%eax
+  802fb4:	39 c3                	cmp    %eax,%ebx
+  802fb6:	7f 1d                	jg     802fd5 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802fb8:	83 ec 04             	sub    $0x4,%esp
+  802fbb:	53                   	push   %ebx
+  802fbc:	68 00 80 80 00       	push   $0x808000
+  802fc1:	ff 75 0c             	push   0xc(%ebp)
+  802fc4:	e8 c7 e3 ff ff       	call   801390 <memmove>
+  802fc9:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802fcc:	89 d8                	mov    %ebx,%eax
+  802fce:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802fd1:	5b                   	pop    %ebx
+  802fd2:	5e                   	pop    %esi
+  802fd3:	5d                   	pop    %ebp
+  802fd4:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802fd5:	68 8a 42 80 00       	push   $0x80428a
+  802fda:	68 cf 3b 80 00       	push   $0x803bcf
+  802fdf:	6a 62                	push   $0x62
+  802fe1:	68 9f 42 80 00       	push   $0x80429f
+  802fe6:	e8 9b da ff ff       	call   800a86 <_panic>
+
+00802feb <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802feb:	55                   	push   %ebp
+  802fec:	89 e5                	mov    %esp,%ebp
+  802fee:	53                   	push   %ebx
+  802fef:	83 ec 04             	sub    $0x4,%esp
+  802ff2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802ff5:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ff8:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802ffd:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  803003:	7f 2e                	jg     803033 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  803005:	83 ec 04             	sub    $0x4,%esp
+  803008:	53                   	push   %ebx
+  803009:	ff 75 0c             	push   0xc(%ebp)
+  80300c:	68 0c 80 80 00       	push   $0x80800c
+  803011:	e8 7a e3 ff ff       	call   801390 <memmove>
+	nsipcbuf.send.req_size = size;
+  803016:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  80301c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80301f:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  803024:	b8 08 00 00 00       	mov    $0x8,%eax
+  803029:	e8 e8 fd ff ff       	call   802e16 <nsipc>
+}
+  80302e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803031:	c9                   	leave
+  803032:	c3                   	ret
+	assert(size < 1600);
+  803033:	68 ab 42 80 00       	push   $0x8042ab
+  803038:	68 cf 3b 80 00       	push   $0x803bcf
+  80303d:	6a 6d                	push   $0x6d
+  80303f:	68 9f 42 80 00       	push   $0x80429f
+  803044:	e8 3d da ff ff       	call   800a86 <_panic>
+
+00803049 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  803049:	55                   	push   %ebp
+  80304a:	89 e5                	mov    %esp,%ebp
+  80304c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  80304f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803052:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  803057:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80305a:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  80305f:	8b 45 10             	mov    0x10(%ebp),%eax
+  803062:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  803067:	b8 09 00 00 00       	mov    $0x9,%eax
+  80306c:	e8 a5 fd ff ff       	call   802e16 <nsipc>
+}
+  803071:	c9                   	leave
+  803072:	c3                   	ret
+
+00803073 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  803073:	55                   	push   %ebp
+  803074:	89 e5                	mov    %esp,%ebp
+  803076:	56                   	push   %esi
+  803077:	53                   	push   %ebx
+  803078:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80307b:	83 ec 0c             	sub    $0xc,%esp
+  80307e:	ff 75 08             	push   0x8(%ebp)
+  803081:	e8 b9 ec ff ff       	call   801d3f <fd2data>
+  803086:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  803088:	83 c4 08             	add    $0x8,%esp
+  80308b:	68 b7 42 80 00       	push   $0x8042b7
+  803090:	53                   	push   %ebx
+  803091:	e8 74 e1 ff ff       	call   80120a <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  803096:	8b 46 04             	mov    0x4(%esi),%eax
+  803099:	2b 06                	sub    (%esi),%eax
+  80309b:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8030a1:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8030a8:	00 00 00 
+	stat->st_dev = &devpipe;
+  8030ab:	c7 83 88 00 00 00 58 	movl   $0x805058,0x88(%ebx)
+  8030b2:	50 80 00 
+	return 0;
+}
+  8030b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030ba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8030bd:	5b                   	pop    %ebx
+  8030be:	5e                   	pop    %esi
+  8030bf:	5d                   	pop    %ebp
+  8030c0:	c3                   	ret
+
+008030c1 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8030c1:	55                   	push   %ebp
+  8030c2:	89 e5                	mov    %esp,%ebp
+  8030c4:	53                   	push   %ebx
+  8030c5:	83 ec 0c             	sub    $0xc,%esp
+  8030c8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8030cb:	53                   	push   %ebx
+  8030cc:	6a 00                	push   $0x0
+  8030ce:	e8 a8 e5 ff ff       	call   80167b <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8030d3:	89 1c 24             	mov    %ebx,(%esp)
+  8030d6:	e8 64 ec ff ff       	call   801d3f <fd2data>
+  8030db:	83 c4 08             	add    $0x8,%esp
+  8030de:	50                   	push   %eax
+  8030df:	6a 00                	push   $0x0
+  8030e1:	e8 95 e5 ff ff       	call   80167b <sys_page_unmap>
+}
+  8030e6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8030e9:	c9                   	leave
+  8030ea:	c3                   	ret
+
+008030eb <_pipeisclosed>:
+{
+  8030eb:	55                   	push   %ebp
+  8030ec:	89 e5                	mov    %esp,%ebp
+  8030ee:	57                   	push   %edi
+  8030ef:	56                   	push   %esi
+  8030f0:	53                   	push   %ebx
+  8030f1:	83 ec 1c             	sub    $0x1c,%esp
+  8030f4:	89 c7                	mov    %eax,%edi
+  8030f6:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  8030f8:	a1 28 64 80 00       	mov    0x806428,%eax
+  8030fd:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  803100:	83 ec 0c             	sub    $0xc,%esp
+  803103:	57                   	push   %edi
+  803104:	e8 9b 04 00 00       	call   8035a4 <pageref>
+  803109:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80310c:	89 34 24             	mov    %esi,(%esp)
+  80310f:	e8 90 04 00 00       	call   8035a4 <pageref>
+		nn = thisenv->env_runs;
+  803114:	8b 15 28 64 80 00    	mov    0x806428,%edx
+  80311a:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  80311d:	83 c4 10             	add    $0x10,%esp
+  803120:	39 cb                	cmp    %ecx,%ebx
+  803122:	74 1b                	je     80313f <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  803124:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803127:	75 cf                	jne    8030f8 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  803129:	8b 42 58             	mov    0x58(%edx),%eax
+  80312c:	6a 01                	push   $0x1
+  80312e:	50                   	push   %eax
+  80312f:	53                   	push   %ebx
+  803130:	68 be 42 80 00       	push   $0x8042be
+  803135:	e8 27 da ff ff       	call   800b61 <cprintf>
+  80313a:	83 c4 10             	add    $0x10,%esp
+  80313d:	eb b9                	jmp    8030f8 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  80313f:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803142:	0f 94 c0             	sete   %al
+  803145:	0f b6 c0             	movzbl %al,%eax
+}
+  803148:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80314b:	5b                   	pop    %ebx
+  80314c:	5e                   	pop    %esi
+  80314d:	5f                   	pop    %edi
+  80314e:	5d                   	pop    %ebp
+  80314f:	c3                   	ret
+
+00803150 <devpipe_write>:
+{
+  803150:	55                   	push   %ebp
+  803151:	89 e5                	mov    %esp,%ebp
+  803153:	57                   	push   %edi
+  803154:	56                   	push   %esi
+  803155:	53                   	push   %ebx
+  803156:	83 ec 28             	sub    $0x28,%esp
+  803159:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  80315c:	56                   	push   %esi
+  80315d:	e8 dd eb ff ff       	call   801d3f <fd2data>
+  803162:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803164:	83 c4 10             	add    $0x10,%esp
+  803167:	bf 00 00 00 00       	mov    $0x0,%edi
+  80316c:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  80316f:	75 09                	jne    80317a <devpipe_write+0x2a>
+	return i;
+  803171:	89 f8                	mov    %edi,%eax
+  803173:	eb 23                	jmp    803198 <devpipe_write+0x48>
+			sys_yield();
+  803175:	e8 5d e4 ff ff       	call   8015d7 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80317a:	8b 43 04             	mov    0x4(%ebx),%eax
+  80317d:	8b 0b                	mov    (%ebx),%ecx
+  80317f:	8d 51 20             	lea    0x20(%ecx),%edx
+  803182:	39 d0                	cmp    %edx,%eax
+  803184:	72 1a                	jb     8031a0 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  803186:	89 da                	mov    %ebx,%edx
+  803188:	89 f0                	mov    %esi,%eax
+  80318a:	e8 5c ff ff ff       	call   8030eb <_pipeisclosed>
+  80318f:	85 c0                	test   %eax,%eax
+  803191:	74 e2                	je     803175 <devpipe_write+0x25>
+				return 0;
+  803193:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803198:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80319b:	5b                   	pop    %ebx
+  80319c:	5e                   	pop    %esi
+  80319d:	5f                   	pop    %edi
+  80319e:	5d                   	pop    %ebp
+  80319f:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8031a0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8031a3:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8031a7:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8031aa:	89 c2                	mov    %eax,%edx
+  8031ac:	c1 fa 1f             	sar    $0x1f,%edx
+  8031af:	89 d1                	mov    %edx,%ecx
+  8031b1:	c1 e9 1b             	shr    $0x1b,%ecx
+  8031b4:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8031b7:	83 e2 1f             	and    $0x1f,%edx
+  8031ba:	29 ca                	sub    %ecx,%edx
+  8031bc:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8031c0:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8031c4:	83 c0 01             	add    $0x1,%eax
+  8031c7:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8031ca:	83 c7 01             	add    $0x1,%edi
+  8031cd:	eb 9d                	jmp    80316c <devpipe_write+0x1c>
+
+008031cf <devpipe_read>:
+{
+  8031cf:	55                   	push   %ebp
+  8031d0:	89 e5                	mov    %esp,%ebp
+  8031d2:	57                   	push   %edi
+  8031d3:	56                   	push   %esi
+  8031d4:	53                   	push   %ebx
+  8031d5:	83 ec 18             	sub    $0x18,%esp
+  8031d8:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8031db:	57                   	push   %edi
+  8031dc:	e8 5e eb ff ff       	call   801d3f <fd2data>
+  8031e1:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8031e3:	83 c4 10             	add    $0x10,%esp
+  8031e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8031eb:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8031ee:	75 13                	jne    803203 <devpipe_read+0x34>
+	return i;
+  8031f0:	89 f0                	mov    %esi,%eax
+  8031f2:	eb 02                	jmp    8031f6 <devpipe_read+0x27>
+				return i;
+  8031f4:	89 f0                	mov    %esi,%eax
+}
+  8031f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8031f9:	5b                   	pop    %ebx
+  8031fa:	5e                   	pop    %esi
+  8031fb:	5f                   	pop    %edi
+  8031fc:	5d                   	pop    %ebp
+  8031fd:	c3                   	ret
+			sys_yield();
+  8031fe:	e8 d4 e3 ff ff       	call   8015d7 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  803203:	8b 03                	mov    (%ebx),%eax
+  803205:	3b 43 04             	cmp    0x4(%ebx),%eax
+  803208:	75 18                	jne    803222 <devpipe_read+0x53>
+			if (i > 0)
+  80320a:	85 f6                	test   %esi,%esi
+  80320c:	75 e6                	jne    8031f4 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  80320e:	89 da                	mov    %ebx,%edx
+  803210:	89 f8                	mov    %edi,%eax
+  803212:	e8 d4 fe ff ff       	call   8030eb <_pipeisclosed>
+  803217:	85 c0                	test   %eax,%eax
+  803219:	74 e3                	je     8031fe <devpipe_read+0x2f>
+				return 0;
+  80321b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803220:	eb d4                	jmp    8031f6 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803222:	99                   	cltd
+  803223:	c1 ea 1b             	shr    $0x1b,%edx
+  803226:	01 d0                	add    %edx,%eax
+  803228:	83 e0 1f             	and    $0x1f,%eax
+  80322b:	29 d0                	sub    %edx,%eax
+  80322d:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  803232:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803235:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  803238:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80323b:	83 c6 01             	add    $0x1,%esi
+  80323e:	eb ab                	jmp    8031eb <devpipe_read+0x1c>
+
+00803240 <pipe>:
+{
+  803240:	55                   	push   %ebp
+  803241:	89 e5                	mov    %esp,%ebp
+  803243:	56                   	push   %esi
+  803244:	53                   	push   %ebx
+  803245:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803248:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80324b:	50                   	push   %eax
+  80324c:	e8 05 eb ff ff       	call   801d56 <fd_alloc>
+  803251:	89 c3                	mov    %eax,%ebx
+  803253:	83 c4 10             	add    $0x10,%esp
+  803256:	85 c0                	test   %eax,%eax
+  803258:	0f 88 23 01 00 00    	js     803381 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80325e:	83 ec 04             	sub    $0x4,%esp
+  803261:	68 07 04 00 00       	push   $0x407
+  803266:	ff 75 f4             	push   -0xc(%ebp)
+  803269:	6a 00                	push   $0x0
+  80326b:	e8 86 e3 ff ff       	call   8015f6 <sys_page_alloc>
+  803270:	89 c3                	mov    %eax,%ebx
+  803272:	83 c4 10             	add    $0x10,%esp
+  803275:	85 c0                	test   %eax,%eax
+  803277:	0f 88 04 01 00 00    	js     803381 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80327d:	83 ec 0c             	sub    $0xc,%esp
+  803280:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803283:	50                   	push   %eax
+  803284:	e8 cd ea ff ff       	call   801d56 <fd_alloc>
+  803289:	89 c3                	mov    %eax,%ebx
+  80328b:	83 c4 10             	add    $0x10,%esp
+  80328e:	85 c0                	test   %eax,%eax
+  803290:	0f 88 db 00 00 00    	js     803371 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803296:	83 ec 04             	sub    $0x4,%esp
+  803299:	68 07 04 00 00       	push   $0x407
+  80329e:	ff 75 f0             	push   -0x10(%ebp)
+  8032a1:	6a 00                	push   $0x0
+  8032a3:	e8 4e e3 ff ff       	call   8015f6 <sys_page_alloc>
+  8032a8:	89 c3                	mov    %eax,%ebx
+  8032aa:	83 c4 10             	add    $0x10,%esp
+  8032ad:	85 c0                	test   %eax,%eax
+  8032af:	0f 88 bc 00 00 00    	js     803371 <pipe+0x131>
+	va = fd2data(fd0);
+  8032b5:	83 ec 0c             	sub    $0xc,%esp
+  8032b8:	ff 75 f4             	push   -0xc(%ebp)
+  8032bb:	e8 7f ea ff ff       	call   801d3f <fd2data>
+  8032c0:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8032c2:	83 c4 0c             	add    $0xc,%esp
+  8032c5:	68 07 04 00 00       	push   $0x407
+  8032ca:	50                   	push   %eax
+  8032cb:	6a 00                	push   $0x0
+  8032cd:	e8 24 e3 ff ff       	call   8015f6 <sys_page_alloc>
+  8032d2:	89 c3                	mov    %eax,%ebx
+  8032d4:	83 c4 10             	add    $0x10,%esp
+  8032d7:	85 c0                	test   %eax,%eax
+  8032d9:	0f 88 82 00 00 00    	js     803361 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8032df:	83 ec 0c             	sub    $0xc,%esp
+  8032e2:	ff 75 f0             	push   -0x10(%ebp)
+  8032e5:	e8 55 ea ff ff       	call   801d3f <fd2data>
+  8032ea:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8032f1:	50                   	push   %eax
+  8032f2:	6a 00                	push   $0x0
+  8032f4:	56                   	push   %esi
+  8032f5:	6a 00                	push   $0x0
+  8032f7:	e8 3d e3 ff ff       	call   801639 <sys_page_map>
+  8032fc:	89 c3                	mov    %eax,%ebx
+  8032fe:	83 c4 20             	add    $0x20,%esp
+  803301:	85 c0                	test   %eax,%eax
+  803303:	78 4e                	js     803353 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803305:	a1 58 50 80 00       	mov    0x805058,%eax
+  80330a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80330d:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80330f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803312:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803319:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80331c:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80331e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803321:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803328:	83 ec 0c             	sub    $0xc,%esp
+  80332b:	ff 75 f4             	push   -0xc(%ebp)
+  80332e:	e8 fc e9 ff ff       	call   801d2f <fd2num>
+  803333:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803336:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803338:	83 c4 04             	add    $0x4,%esp
+  80333b:	ff 75 f0             	push   -0x10(%ebp)
+  80333e:	e8 ec e9 ff ff       	call   801d2f <fd2num>
+  803343:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803346:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803349:	83 c4 10             	add    $0x10,%esp
+  80334c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803351:	eb 2e                	jmp    803381 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803353:	83 ec 08             	sub    $0x8,%esp
+  803356:	56                   	push   %esi
+  803357:	6a 00                	push   $0x0
+  803359:	e8 1d e3 ff ff       	call   80167b <sys_page_unmap>
+  80335e:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803361:	83 ec 08             	sub    $0x8,%esp
+  803364:	ff 75 f0             	push   -0x10(%ebp)
+  803367:	6a 00                	push   $0x0
+  803369:	e8 0d e3 ff ff       	call   80167b <sys_page_unmap>
+  80336e:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803371:	83 ec 08             	sub    $0x8,%esp
+  803374:	ff 75 f4             	push   -0xc(%ebp)
+  803377:	6a 00                	push   $0x0
+  803379:	e8 fd e2 ff ff       	call   80167b <sys_page_unmap>
+  80337e:	83 c4 10             	add    $0x10,%esp
+}
+  803381:	89 d8                	mov    %ebx,%eax
+  803383:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803386:	5b                   	pop    %ebx
+  803387:	5e                   	pop    %esi
+  803388:	5d                   	pop    %ebp
+  803389:	c3                   	ret
+
+0080338a <pipeisclosed>:
+{
+  80338a:	55                   	push   %ebp
+  80338b:	89 e5                	mov    %esp,%ebp
+  80338d:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803390:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803393:	50                   	push   %eax
+  803394:	ff 75 08             	push   0x8(%ebp)
+  803397:	e8 10 ea ff ff       	call   801dac <fd_lookup>
+  80339c:	83 c4 10             	add    $0x10,%esp
+  80339f:	85 c0                	test   %eax,%eax
+  8033a1:	78 18                	js     8033bb <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8033a3:	83 ec 0c             	sub    $0xc,%esp
+  8033a6:	ff 75 f4             	push   -0xc(%ebp)
+  8033a9:	e8 91 e9 ff ff       	call   801d3f <fd2data>
+  8033ae:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8033b0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8033b3:	e8 33 fd ff ff       	call   8030eb <_pipeisclosed>
+  8033b8:	83 c4 10             	add    $0x10,%esp
+}
+  8033bb:	c9                   	leave
+  8033bc:	c3                   	ret
+
+008033bd <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  8033bd:	55                   	push   %ebp
+  8033be:	89 e5                	mov    %esp,%ebp
+  8033c0:	56                   	push   %esi
+  8033c1:	53                   	push   %ebx
+  8033c2:	8b 75 08             	mov    0x8(%ebp),%esi
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  8033c5:	85 f6                	test   %esi,%esi
+  8033c7:	74 15                	je     8033de <wait+0x21>
+	e = &envs[ENVX(envid)];
+  8033c9:	89 f0                	mov    %esi,%eax
+  8033cb:	25 ff 03 00 00       	and    $0x3ff,%eax
+
+    while (e->env_id == envid && e->env_status != ENV_FREE) {
+  8033d0:	8d 1c c0             	lea    (%eax,%eax,8),%ebx
+  8033d3:	c1 e3 04             	shl    $0x4,%ebx
+  8033d6:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  8033dc:	eb 1b                	jmp    8033f9 <wait+0x3c>
+	assert(envid != 0);
+  8033de:	68 d6 42 80 00       	push   $0x8042d6
+  8033e3:	68 cf 3b 80 00       	push   $0x803bcf
+  8033e8:	6a 09                	push   $0x9
+  8033ea:	68 e1 42 80 00       	push   $0x8042e1
+  8033ef:	e8 92 d6 ff ff       	call   800a86 <_panic>
+        sys_yield();
+  8033f4:	e8 de e1 ff ff       	call   8015d7 <sys_yield>
+    while (e->env_id == envid && e->env_status != ENV_FREE) {
+  8033f9:	8b 43 48             	mov    0x48(%ebx),%eax
+  8033fc:	39 f0                	cmp    %esi,%eax
+  8033fe:	75 07                	jne    803407 <wait+0x4a>
+  803400:	8b 43 54             	mov    0x54(%ebx),%eax
+  803403:	85 c0                	test   %eax,%eax
+  803405:	75 ed                	jne    8033f4 <wait+0x37>
+    }
+}
+  803407:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80340a:	5b                   	pop    %ebx
+  80340b:	5e                   	pop    %esi
+  80340c:	5d                   	pop    %ebp
+  80340d:	c3                   	ret
+
+0080340e <set_pgfault_handler>:
+// allocate an exception stack (one page of memory with its top
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf)) {
+  80340e:	55                   	push   %ebp
+  80340f:	89 e5                	mov    %esp,%ebp
+  803411:	83 ec 08             	sub    $0x8,%esp
+  int r;
+
+  if (_pgfault_handler == 0) {
+  803414:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  80341b:	74 0a                	je     803427 <set_pgfault_handler+0x19>
+    if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)))
+      panic(" set_pgfault_handler sys_env_set_pgfault_upcall panic: %e\n", r);
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  80341d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803420:	a3 00 90 80 00       	mov    %eax,0x809000
+
+
+}
+  803425:	c9                   	leave
+  803426:	c3                   	ret
+    if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)))
+  803427:	83 ec 04             	sub    $0x4,%esp
+  80342a:	6a 07                	push   $0x7
+  80342c:	68 00 f0 bf ee       	push   $0xeebff000
+  803431:	6a 00                	push   $0x0
+  803433:	e8 be e1 ff ff       	call   8015f6 <sys_page_alloc>
+  803438:	83 c4 10             	add    $0x10,%esp
+  80343b:	85 c0                	test   %eax,%eax
+  80343d:	75 28                	jne    803467 <set_pgfault_handler+0x59>
+    if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)))
+  80343f:	83 ec 08             	sub    $0x8,%esp
+  803442:	68 79 34 80 00       	push   $0x803479
+  803447:	6a 00                	push   $0x0
+  803449:	e8 f3 e2 ff ff       	call   801741 <sys_env_set_pgfault_upcall>
+  80344e:	83 c4 10             	add    $0x10,%esp
+  803451:	85 c0                	test   %eax,%eax
+  803453:	74 c8                	je     80341d <set_pgfault_handler+0xf>
+      panic(" set_pgfault_handler sys_env_set_pgfault_upcall panic: %e\n", r);
+  803455:	50                   	push   %eax
+  803456:	68 1c 43 80 00       	push   $0x80431c
+  80345b:	6a 22                	push   $0x22
+  80345d:	68 57 43 80 00       	push   $0x804357
+  803462:	e8 1f d6 ff ff       	call   800a86 <_panic>
+      panic("set_pgfault_handler sys_page_alloc panic: %e\n", r);
+  803467:	50                   	push   %eax
+  803468:	68 ec 42 80 00       	push   $0x8042ec
+  80346d:	6a 20                	push   $0x20
+  80346f:	68 57 43 80 00       	push   $0x804357
+  803474:	e8 0d d6 ff ff       	call   800a86 <_panic>
+
+00803479 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  803479:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80347a:	a1 00 90 80 00       	mov    0x809000,%eax
+	call *%eax
+  80347f:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  803481:	83 c4 04             	add    $0x4,%esp
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	// push the trap-time %eip onto the trap-time stack
+    subl $0x4, 0x30(%esp) # for push eip
+  803484:	83 6c 24 30 04       	subl   $0x4,0x30(%esp)
+    movl 0x30(%esp), %ebx #regular esp
+  803489:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+    movl 0x28(%esp), %eax #eip
+  80348d:	8b 44 24 28          	mov    0x28(%esp),%eax
+    movl %eax, (%ebx)
+  803491:	89 03                	mov    %eax,(%ebx)
+
+    // Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+    addl $8, %esp
+  803493:	83 c4 08             	add    $0x8,%esp
+    popal
+  803496:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  803497:	83 c4 04             	add    $0x4,%esp
+	popfl
+  80349a:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  80349b:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  80349c:	c3                   	ret
+
+0080349d <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  80349d:	55                   	push   %ebp
+  80349e:	89 e5                	mov    %esp,%ebp
+  8034a0:	56                   	push   %esi
+  8034a1:	53                   	push   %ebx
+  8034a2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8034a5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8034a8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  8034ab:	85 c0                	test   %eax,%eax
+  8034ad:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8034b2:	0f 44 c2             	cmove  %edx,%eax
+  8034b5:	83 ec 0c             	sub    $0xc,%esp
+  8034b8:	50                   	push   %eax
+  8034b9:	e8 e8 e2 ff ff       	call   8017a6 <sys_ipc_recv>
+
+  if (from_env_store)
+  8034be:	83 c4 10             	add    $0x10,%esp
+  8034c1:	85 f6                	test   %esi,%esi
+  8034c3:	74 17                	je     8034dc <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  8034c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034ca:	85 c0                	test   %eax,%eax
+  8034cc:	75 0c                	jne    8034da <ipc_recv+0x3d>
+  8034ce:	8b 15 28 64 80 00    	mov    0x806428,%edx
+  8034d4:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  8034da:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  8034dc:	85 db                	test   %ebx,%ebx
+  8034de:	74 2b                	je     80350b <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  8034e0:	85 c0                	test   %eax,%eax
+  8034e2:	74 0d                	je     8034f1 <ipc_recv+0x54>
+  8034e4:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  8034ea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8034ed:	5b                   	pop    %ebx
+  8034ee:	5e                   	pop    %esi
+  8034ef:	5d                   	pop    %ebp
+  8034f0:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  8034f1:	a1 28 64 80 00       	mov    0x806428,%eax
+  8034f6:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8034fc:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  8034fe:	a1 28 64 80 00       	mov    0x806428,%eax
+  803503:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  803509:	eb df                	jmp    8034ea <ipc_recv+0x4d>
+  80350b:	85 c0                	test   %eax,%eax
+  80350d:	75 db                	jne    8034ea <ipc_recv+0x4d>
+  80350f:	eb ed                	jmp    8034fe <ipc_recv+0x61>
+
+00803511 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  803511:	55                   	push   %ebp
+  803512:	89 e5                	mov    %esp,%ebp
+  803514:	57                   	push   %edi
+  803515:	56                   	push   %esi
+  803516:	53                   	push   %ebx
+  803517:	83 ec 0c             	sub    $0xc,%esp
+  80351a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80351d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803520:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  803523:	85 db                	test   %ebx,%ebx
+  803525:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80352a:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  80352d:	ff 75 14             	push   0x14(%ebp)
+  803530:	53                   	push   %ebx
+  803531:	56                   	push   %esi
+  803532:	57                   	push   %edi
+  803533:	e8 4b e2 ff ff       	call   801783 <sys_ipc_try_send>
+  803538:	83 c4 10             	add    $0x10,%esp
+  80353b:	85 c0                	test   %eax,%eax
+  80353d:	74 1e                	je     80355d <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  80353f:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803542:	75 07                	jne    80354b <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  803544:	e8 8e e0 ff ff       	call   8015d7 <sys_yield>
+  803549:	eb e2                	jmp    80352d <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  80354b:	50                   	push   %eax
+  80354c:	68 65 43 80 00       	push   $0x804365
+  803551:	6a 3c                	push   $0x3c
+  803553:	68 72 43 80 00       	push   $0x804372
+  803558:	e8 29 d5 ff ff       	call   800a86 <_panic>
+  }
+
+#endif
+}
+  80355d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803560:	5b                   	pop    %ebx
+  803561:	5e                   	pop    %esi
+  803562:	5f                   	pop    %edi
+  803563:	5d                   	pop    %ebp
+  803564:	c3                   	ret
+
+00803565 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  803565:	55                   	push   %ebp
+  803566:	89 e5                	mov    %esp,%ebp
+  803568:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  80356b:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  803570:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803573:	c1 e0 04             	shl    $0x4,%eax
+  803576:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80357b:	8b 40 50             	mov    0x50(%eax),%eax
+  80357e:	39 c8                	cmp    %ecx,%eax
+  803580:	74 12                	je     803594 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  803582:	83 c2 01             	add    $0x1,%edx
+  803585:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  80358b:	75 e3                	jne    803570 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  80358d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803592:	eb 0e                	jmp    8035a2 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  803594:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803597:	c1 e0 04             	shl    $0x4,%eax
+  80359a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80359f:	8b 40 48             	mov    0x48(%eax),%eax
+  8035a2:	5d                   	pop    %ebp
+  8035a3:	c3                   	ret
+
+008035a4 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8035a4:	55                   	push   %ebp
+  8035a5:	89 e5                	mov    %esp,%ebp
+  8035a7:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8035aa:	89 c2                	mov    %eax,%edx
+  8035ac:	c1 ea 16             	shr    $0x16,%edx
+  8035af:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8035b6:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8035bb:	f6 c1 01             	test   $0x1,%cl
+  8035be:	74 1c                	je     8035dc <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  8035c0:	c1 e8 0c             	shr    $0xc,%eax
+  8035c3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8035ca:	a8 01                	test   $0x1,%al
+  8035cc:	74 0e                	je     8035dc <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8035ce:	c1 e8 0c             	shr    $0xc,%eax
+  8035d1:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  8035d8:	ef 
+  8035d9:	0f b7 d2             	movzwl %dx,%edx
+}
+  8035dc:	89 d0                	mov    %edx,%eax
+  8035de:	5d                   	pop    %ebp
+  8035df:	c3                   	ret
+
+008035e0 <__udivmoddi4>:
+  8035e0:	55                   	push   %ebp
+  8035e1:	57                   	push   %edi
+  8035e2:	56                   	push   %esi
+  8035e3:	53                   	push   %ebx
+  8035e4:	83 ec 24             	sub    $0x24,%esp
+  8035e7:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8035eb:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8035ef:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  8035f3:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8035f7:	8b 54 24 44          	mov    0x44(%esp),%edx
+  8035fb:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8035ff:	8b 44 24 40          	mov    0x40(%esp),%eax
+  803603:	89 d3                	mov    %edx,%ebx
+  803605:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803609:	09 c3                	or     %eax,%ebx
+  80360b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80360f:	0f 84 9c 00 00 00    	je     8036b1 <__udivmoddi4+0xd1>
+  803615:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80361c:	00 
+  80361d:	31 c0                	xor    %eax,%eax
+  80361f:	31 d2                	xor    %edx,%edx
+  803621:	89 fb                	mov    %edi,%ebx
+  803623:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80362a:	00 
+  80362b:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803630:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803634:	01 c0                	add    %eax,%eax
+  803636:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80363d:	00 
+  80363e:	89 c6                	mov    %eax,%esi
+  803640:	89 d7                	mov    %edx,%edi
+  803642:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803646:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80364a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80364d:	d3 ea                	shr    %cl,%edx
+  80364f:	f6 c1 20             	test   $0x20,%cl
+  803652:	0f 45 c2             	cmovne %edx,%eax
+  803655:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803659:	83 e0 01             	and    $0x1,%eax
+  80365c:	09 fa                	or     %edi,%edx
+  80365e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  803662:	89 04 24             	mov    %eax,(%esp)
+  803665:	8b 04 24             	mov    (%esp),%eax
+  803668:	89 d5                	mov    %edx,%ebp
+  80366a:	09 f0                	or     %esi,%eax
+  80366c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  803670:	39 f0                	cmp    %esi,%eax
+  803672:	19 fd                	sbb    %edi,%ebp
+  803674:	72 1d                	jb     803693 <__udivmoddi4+0xb3>
+  803676:	29 f0                	sub    %esi,%eax
+  803678:	19 fa                	sbb    %edi,%edx
+  80367a:	89 cf                	mov    %ecx,%edi
+  80367c:	c1 ef 05             	shr    $0x5,%edi
+  80367f:	83 e7 01             	and    $0x1,%edi
+  803682:	89 fe                	mov    %edi,%esi
+  803684:	d3 e7                	shl    %cl,%edi
+  803686:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80368a:	83 f6 01             	xor    $0x1,%esi
+  80368d:	d3 e6                	shl    %cl,%esi
+  80368f:	09 74 24 18          	or     %esi,0x18(%esp)
+  803693:	83 e9 01             	sub    $0x1,%ecx
+  803696:	73 98                	jae    803630 <__udivmoddi4+0x50>
+  803698:	85 db                	test   %ebx,%ebx
+  80369a:	74 05                	je     8036a1 <__udivmoddi4+0xc1>
+  80369c:	89 03                	mov    %eax,(%ebx)
+  80369e:	89 53 04             	mov    %edx,0x4(%ebx)
+  8036a1:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8036a5:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8036a9:	83 c4 24             	add    $0x24,%esp
+  8036ac:	5b                   	pop    %ebx
+  8036ad:	5e                   	pop    %esi
+  8036ae:	5f                   	pop    %edi
+  8036af:	5d                   	pop    %ebp
+  8036b0:	c3                   	ret
+  8036b1:	85 ff                	test   %edi,%edi
+  8036b3:	74 0d                	je     8036c2 <__udivmoddi4+0xe2>
+  8036b5:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  8036bb:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  8036c2:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8036c6:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8036ca:	89 44 24 18          	mov    %eax,0x18(%esp)
+  8036ce:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8036d2:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  8036d6:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8036da:	83 c4 24             	add    $0x24,%esp
+  8036dd:	5b                   	pop    %ebx
+  8036de:	5e                   	pop    %esi
+  8036df:	5f                   	pop    %edi
+  8036e0:	5d                   	pop    %ebp
+  8036e1:	c3                   	ret
+  8036e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8036e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+008036f0 <__udivdi3>:
+  8036f0:	57                   	push   %edi
+  8036f1:	56                   	push   %esi
+  8036f2:	53                   	push   %ebx
+  8036f3:	83 ec 20             	sub    $0x20,%esp
+  8036f6:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8036fa:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8036fe:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803702:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803706:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80370a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80370e:	89 d1                	mov    %edx,%ecx
+  803710:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803714:	09 c1                	or     %eax,%ecx
+  803716:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80371a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80371e:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  803722:	0f 84 88 00 00 00    	je     8037b0 <__udivdi3+0xc0>
+  803728:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80372f:	00 
+  803730:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803735:	31 c0                	xor    %eax,%eax
+  803737:	31 d2                	xor    %edx,%edx
+  803739:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803740:	00 
+  803741:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  803748:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80374c:	01 c0                	add    %eax,%eax
+  80374e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803755:	00 
+  803756:	89 c6                	mov    %eax,%esi
+  803758:	89 d7                	mov    %edx,%edi
+  80375a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80375e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803762:	0f ad d0             	shrd   %cl,%edx,%eax
+  803765:	d3 ea                	shr    %cl,%edx
+  803767:	f6 c1 20             	test   $0x20,%cl
+  80376a:	0f 45 c2             	cmovne %edx,%eax
+  80376d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803771:	83 e0 01             	and    $0x1,%eax
+  803774:	09 fa                	or     %edi,%edx
+  803776:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80377a:	89 04 24             	mov    %eax,(%esp)
+  80377d:	8b 04 24             	mov    (%esp),%eax
+  803780:	89 d3                	mov    %edx,%ebx
+  803782:	09 f0                	or     %esi,%eax
+  803784:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803788:	39 f0                	cmp    %esi,%eax
+  80378a:	19 fb                	sbb    %edi,%ebx
+  80378c:	72 1d                	jb     8037ab <__udivdi3+0xbb>
+  80378e:	29 f0                	sub    %esi,%eax
+  803790:	19 fa                	sbb    %edi,%edx
+  803792:	89 cf                	mov    %ecx,%edi
+  803794:	c1 ef 05             	shr    $0x5,%edi
+  803797:	83 e7 01             	and    $0x1,%edi
+  80379a:	89 fe                	mov    %edi,%esi
+  80379c:	d3 e7                	shl    %cl,%edi
+  80379e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8037a2:	83 f6 01             	xor    $0x1,%esi
+  8037a5:	d3 e6                	shl    %cl,%esi
+  8037a7:	09 74 24 18          	or     %esi,0x18(%esp)
+  8037ab:	83 e9 01             	sub    $0x1,%ecx
+  8037ae:	73 98                	jae    803748 <__udivdi3+0x58>
+  8037b0:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8037b4:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8037b8:	83 c4 20             	add    $0x20,%esp
+  8037bb:	5b                   	pop    %ebx
+  8037bc:	5e                   	pop    %esi
+  8037bd:	5f                   	pop    %edi
+  8037be:	c3                   	ret
+  8037bf:	90                   	nop
+
+008037c0 <__umoddi3>:
+  8037c0:	57                   	push   %edi
+  8037c1:	56                   	push   %esi
+  8037c2:	53                   	push   %ebx
+  8037c3:	83 ec 18             	sub    $0x18,%esp
+  8037c6:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8037ca:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8037ce:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8037d2:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8037d6:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8037da:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8037de:	89 d1                	mov    %edx,%ecx
+  8037e0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8037e4:	09 c1                	or     %eax,%ecx
+  8037e6:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8037ea:	74 5b                	je     803847 <__umoddi3+0x87>
+  8037ec:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8037f1:	31 c0                	xor    %eax,%eax
+  8037f3:	31 d2                	xor    %edx,%edx
+  8037f5:	8d 76 00             	lea    0x0(%esi),%esi
+  8037f8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8037fc:	01 c0                	add    %eax,%eax
+  8037fe:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803805:	00 
+  803806:	89 c6                	mov    %eax,%esi
+  803808:	89 d7                	mov    %edx,%edi
+  80380a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80380e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803812:	0f ad d0             	shrd   %cl,%edx,%eax
+  803815:	d3 ea                	shr    %cl,%edx
+  803817:	f6 c1 20             	test   $0x20,%cl
+  80381a:	0f 45 c2             	cmovne %edx,%eax
+  80381d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803821:	83 e0 01             	and    $0x1,%eax
+  803824:	09 fa                	or     %edi,%edx
+  803826:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80382a:	89 04 24             	mov    %eax,(%esp)
+  80382d:	8b 04 24             	mov    (%esp),%eax
+  803830:	89 d3                	mov    %edx,%ebx
+  803832:	09 f0                	or     %esi,%eax
+  803834:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803838:	39 f0                	cmp    %esi,%eax
+  80383a:	19 fb                	sbb    %edi,%ebx
+  80383c:	72 04                	jb     803842 <__umoddi3+0x82>
+  80383e:	29 f0                	sub    %esi,%eax
+  803840:	19 fa                	sbb    %edi,%edx
+  803842:	83 e9 01             	sub    $0x1,%ecx
+  803845:	73 b1                	jae    8037f8 <__umoddi3+0x38>
+  803847:	83 c4 18             	add    $0x18,%esp
+  80384a:	5b                   	pop    %ebx
+  80384b:	5e                   	pop    %esi
+  80384c:	5f                   	pop    %edi
+  80384d:	c3                   	ret
+  80384e:	66 90                	xchg   %ax,%ax
+
+00803850 <__divdi3>:
+  803850:	55                   	push   %ebp
+  803851:	57                   	push   %edi
+  803852:	56                   	push   %esi
+  803853:	53                   	push   %ebx
+  803854:	83 ec 24             	sub    $0x24,%esp
+  803857:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  80385b:	8b 74 24 44          	mov    0x44(%esp),%esi
+  80385f:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803863:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803867:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  80386b:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  80386f:	85 d2                	test   %edx,%edx
+  803871:	0f 88 e0 00 00 00    	js     803957 <__divdi3+0x107>
+  803877:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  80387b:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  80387f:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803883:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803887:	85 f6                	test   %esi,%esi
+  803889:	78 16                	js     8038a1 <__divdi3+0x51>
+  80388b:	89 f1                	mov    %esi,%ecx
+  80388d:	31 c0                	xor    %eax,%eax
+  80388f:	31 d2                	xor    %edx,%edx
+  803891:	09 d9                	or     %ebx,%ecx
+  803893:	0f 85 f3 00 00 00    	jne    80398c <__divdi3+0x13c>
+  803899:	83 c4 24             	add    $0x24,%esp
+  80389c:	5b                   	pop    %ebx
+  80389d:	5e                   	pop    %esi
+  80389e:	5f                   	pop    %edi
+  80389f:	5d                   	pop    %ebp
+  8038a0:	c3                   	ret
+  8038a1:	bf 01 00 00 00       	mov    $0x1,%edi
+  8038a6:	f7 5c 24 08          	negl   0x8(%esp)
+  8038aa:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  8038af:	f7 5c 24 0c          	negl   0xc(%esp)
+  8038b3:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8038ba:	00 
+  8038bb:	31 c0                	xor    %eax,%eax
+  8038bd:	31 d2                	xor    %edx,%edx
+  8038bf:	89 fb                	mov    %edi,%ebx
+  8038c1:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8038c8:	00 
+  8038c9:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8038ce:	66 90                	xchg   %ax,%ax
+  8038d0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8038d4:	01 c0                	add    %eax,%eax
+  8038d6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8038dd:	00 
+  8038de:	89 c6                	mov    %eax,%esi
+  8038e0:	89 d7                	mov    %edx,%edi
+  8038e2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8038e6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8038ea:	0f ad d0             	shrd   %cl,%edx,%eax
+  8038ed:	d3 ea                	shr    %cl,%edx
+  8038ef:	f6 c1 20             	test   $0x20,%cl
+  8038f2:	0f 45 c2             	cmovne %edx,%eax
+  8038f5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8038f9:	83 e0 01             	and    $0x1,%eax
+  8038fc:	09 fa                	or     %edi,%edx
+  8038fe:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  803902:	89 04 24             	mov    %eax,(%esp)
+  803905:	8b 04 24             	mov    (%esp),%eax
+  803908:	89 d5                	mov    %edx,%ebp
+  80390a:	09 f0                	or     %esi,%eax
+  80390c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  803910:	39 f0                	cmp    %esi,%eax
+  803912:	19 fd                	sbb    %edi,%ebp
+  803914:	72 1d                	jb     803933 <__divdi3+0xe3>
+  803916:	29 f0                	sub    %esi,%eax
+  803918:	19 fa                	sbb    %edi,%edx
+  80391a:	89 cf                	mov    %ecx,%edi
+  80391c:	c1 ef 05             	shr    $0x5,%edi
+  80391f:	83 e7 01             	and    $0x1,%edi
+  803922:	89 fe                	mov    %edi,%esi
+  803924:	d3 e7                	shl    %cl,%edi
+  803926:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80392a:	83 f6 01             	xor    $0x1,%esi
+  80392d:	d3 e6                	shl    %cl,%esi
+  80392f:	09 74 24 18          	or     %esi,0x18(%esp)
+  803933:	83 e9 01             	sub    $0x1,%ecx
+  803936:	73 98                	jae    8038d0 <__divdi3+0x80>
+  803938:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80393c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803940:	85 db                	test   %ebx,%ebx
+  803942:	0f 84 51 ff ff ff    	je     803899 <__divdi3+0x49>
+  803948:	f7 d8                	neg    %eax
+  80394a:	83 d2 00             	adc    $0x0,%edx
+  80394d:	83 c4 24             	add    $0x24,%esp
+  803950:	5b                   	pop    %ebx
+  803951:	f7 da                	neg    %edx
+  803953:	5e                   	pop    %esi
+  803954:	5f                   	pop    %edi
+  803955:	5d                   	pop    %ebp
+  803956:	c3                   	ret
+  803957:	f7 d8                	neg    %eax
+  803959:	83 d2 00             	adc    $0x0,%edx
+  80395c:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803960:	f7 da                	neg    %edx
+  803962:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803966:	85 f6                	test   %esi,%esi
+  803968:	78 1b                	js     803985 <__divdi3+0x135>
+  80396a:	89 f1                	mov    %esi,%ecx
+  80396c:	31 c0                	xor    %eax,%eax
+  80396e:	31 d2                	xor    %edx,%edx
+  803970:	bf 01 00 00 00       	mov    $0x1,%edi
+  803975:	09 d9                	or     %ebx,%ecx
+  803977:	0f 85 36 ff ff ff    	jne    8038b3 <__divdi3+0x63>
+  80397d:	83 c4 24             	add    $0x24,%esp
+  803980:	5b                   	pop    %ebx
+  803981:	5e                   	pop    %esi
+  803982:	5f                   	pop    %edi
+  803983:	5d                   	pop    %ebp
+  803984:	c3                   	ret
+  803985:	31 ff                	xor    %edi,%edi
+  803987:	e9 1a ff ff ff       	jmp    8038a6 <__divdi3+0x56>
+  80398c:	31 ff                	xor    %edi,%edi
+  80398e:	e9 20 ff ff ff       	jmp    8038b3 <__divdi3+0x63>
+  803993:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80399a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+008039a0 <__moddi3>:
+  8039a0:	55                   	push   %ebp
+  8039a1:	57                   	push   %edi
+  8039a2:	56                   	push   %esi
+  8039a3:	53                   	push   %ebx
+  8039a4:	83 ec 1c             	sub    $0x1c,%esp
+  8039a7:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  8039ab:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  8039af:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  8039b3:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  8039b7:	89 c8                	mov    %ecx,%eax
+  8039b9:	89 f2                	mov    %esi,%edx
+  8039bb:	89 f3                	mov    %esi,%ebx
+  8039bd:	85 ed                	test   %ebp,%ebp
+  8039bf:	0f 88 9d 00 00 00    	js     803a62 <__moddi3+0xc2>
+  8039c5:	09 cb                	or     %ecx,%ebx
+  8039c7:	0f 84 8d 00 00 00    	je     803a5a <__moddi3+0xba>
+  8039cd:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  8039d1:	31 db                	xor    %ebx,%ebx
+  8039d3:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  8039d7:	89 ca                	mov    %ecx,%edx
+  8039d9:	89 f0                	mov    %esi,%eax
+  8039db:	89 dd                	mov    %ebx,%ebp
+  8039dd:	f7 da                	neg    %edx
+  8039df:	83 d0 00             	adc    $0x0,%eax
+  8039e2:	f7 d8                	neg    %eax
+  8039e4:	0f 49 f0             	cmovns %eax,%esi
+  8039e7:	0f 49 ca             	cmovns %edx,%ecx
+  8039ea:	31 c0                	xor    %eax,%eax
+  8039ec:	31 d2                	xor    %edx,%edx
+  8039ee:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8039f2:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  8039f6:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8039fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  8039ff:	90                   	nop
+  803a00:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803a04:	01 c0                	add    %eax,%eax
+  803a06:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803a0d:	00 
+  803a0e:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  803a12:	89 c6                	mov    %eax,%esi
+  803a14:	89 d7                	mov    %edx,%edi
+  803a16:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803a1a:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803a1e:	0f ad d0             	shrd   %cl,%edx,%eax
+  803a21:	d3 ea                	shr    %cl,%edx
+  803a23:	f6 c1 20             	test   $0x20,%cl
+  803a26:	0f 45 c2             	cmovne %edx,%eax
+  803a29:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803a2d:	83 e0 01             	and    $0x1,%eax
+  803a30:	09 fa                	or     %edi,%edx
+  803a32:	89 04 24             	mov    %eax,(%esp)
+  803a35:	8b 04 24             	mov    (%esp),%eax
+  803a38:	89 d7                	mov    %edx,%edi
+  803a3a:	09 f0                	or     %esi,%eax
+  803a3c:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  803a40:	39 d8                	cmp    %ebx,%eax
+  803a42:	19 f7                	sbb    %esi,%edi
+  803a44:	72 04                	jb     803a4a <__moddi3+0xaa>
+  803a46:	29 d8                	sub    %ebx,%eax
+  803a48:	19 f2                	sbb    %esi,%edx
+  803a4a:	83 e9 01             	sub    $0x1,%ecx
+  803a4d:	73 b1                	jae    803a00 <__moddi3+0x60>
+  803a4f:	85 ed                	test   %ebp,%ebp
+  803a51:	74 07                	je     803a5a <__moddi3+0xba>
+  803a53:	f7 d8                	neg    %eax
+  803a55:	83 d2 00             	adc    $0x0,%edx
+  803a58:	f7 da                	neg    %edx
+  803a5a:	83 c4 1c             	add    $0x1c,%esp
+  803a5d:	5b                   	pop    %ebx
+  803a5e:	5e                   	pop    %esi
+  803a5f:	5f                   	pop    %edi
+  803a60:	5d                   	pop    %ebp
+  803a61:	c3                   	ret
+  803a62:	09 cb                	or     %ecx,%ebx
+  803a64:	74 f4                	je     803a5a <__moddi3+0xba>
+  803a66:	f7 df                	neg    %edi
+  803a68:	bb 01 00 00 00       	mov    $0x1,%ebx
+  803a6d:	83 d5 00             	adc    $0x0,%ebp
+  803a70:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  803a74:	f7 dd                	neg    %ebp
+  803a76:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  803a7a:	e9 58 ff ff ff       	jmp    8039d7 <__moddi3+0x37>
@@ -0,0 +1,5246 @@
+
+obj/user/softint.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 05 00 00 00       	call   800036 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+	asm volatile("int $14");	// page fault
+  800033:	cd 0e                	int    $0xe
+}
+  800035:	c3                   	ret
+
+00800036 <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  800036:	55                   	push   %ebp
+  800037:	89 e5                	mov    %esp,%ebp
+  800039:	56                   	push   %esi
+  80003a:	53                   	push   %ebx
+  80003b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80003e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  800041:	e8 d1 00 00 00       	call   800117 <sys_getenvid>
+  800046:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80004b:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80004e:	c1 e0 04             	shl    $0x4,%eax
+  800051:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800056:	a3 08 40 80 00       	mov    %eax,0x804008
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  80005b:	85 db                	test   %ebx,%ebx
+  80005d:	7e 07                	jle    800066 <libmain+0x30>
+    binaryname = argv[0];
+  80005f:	8b 06                	mov    (%esi),%eax
+  800061:	a3 00 30 80 00       	mov    %eax,0x803000
+
+  // call user main routine
+  umain(argc, argv);
+  800066:	83 ec 08             	sub    $0x8,%esp
+  800069:	56                   	push   %esi
+  80006a:	53                   	push   %ebx
+  80006b:	e8 c3 ff ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  800070:	e8 0a 00 00 00       	call   80007f <exit>
+}
+  800075:	83 c4 10             	add    $0x10,%esp
+  800078:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80007b:	5b                   	pop    %ebx
+  80007c:	5e                   	pop    %esi
+  80007d:	5d                   	pop    %ebp
+  80007e:	c3                   	ret
+
+0080007f <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80007f:	55                   	push   %ebp
+  800080:	89 e5                	mov    %esp,%ebp
+  800082:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800085:	e8 72 05 00 00       	call   8005fc <close_all>
+	sys_env_destroy(0);
+  80008a:	83 ec 0c             	sub    $0xc,%esp
+  80008d:	6a 00                	push   $0x0
+  80008f:	e8 42 00 00 00       	call   8000d6 <sys_env_destroy>
+}
+  800094:	83 c4 10             	add    $0x10,%esp
+  800097:	c9                   	leave
+  800098:	c3                   	ret
+
+00800099 <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800099:	55                   	push   %ebp
+  80009a:	89 e5                	mov    %esp,%ebp
+  80009c:	57                   	push   %edi
+  80009d:	56                   	push   %esi
+  80009e:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80009f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000aa:	89 c3                	mov    %eax,%ebx
+  8000ac:	89 c7                	mov    %eax,%edi
+  8000ae:	89 c6                	mov    %eax,%esi
+  8000b0:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  8000b2:	5b                   	pop    %ebx
+  8000b3:	5e                   	pop    %esi
+  8000b4:	5f                   	pop    %edi
+  8000b5:	5d                   	pop    %ebp
+  8000b6:	c3                   	ret
+
+008000b7 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8000b7:	55                   	push   %ebp
+  8000b8:	89 e5                	mov    %esp,%ebp
+  8000ba:	57                   	push   %edi
+  8000bb:	56                   	push   %esi
+  8000bc:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8000bd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000c2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000c7:	89 d1                	mov    %edx,%ecx
+  8000c9:	89 d3                	mov    %edx,%ebx
+  8000cb:	89 d7                	mov    %edx,%edi
+  8000cd:	89 d6                	mov    %edx,%esi
+  8000cf:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8000d1:	5b                   	pop    %ebx
+  8000d2:	5e                   	pop    %esi
+  8000d3:	5f                   	pop    %edi
+  8000d4:	5d                   	pop    %ebp
+  8000d5:	c3                   	ret
+
+008000d6 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8000d6:	55                   	push   %ebp
+  8000d7:	89 e5                	mov    %esp,%ebp
+  8000d9:	57                   	push   %edi
+  8000da:	56                   	push   %esi
+  8000db:	53                   	push   %ebx
+  8000dc:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8000df:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000e7:	b8 03 00 00 00       	mov    $0x3,%eax
+  8000ec:	89 cb                	mov    %ecx,%ebx
+  8000ee:	89 cf                	mov    %ecx,%edi
+  8000f0:	89 ce                	mov    %ecx,%esi
+  8000f2:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8000f4:	85 c0                	test   %eax,%eax
+  8000f6:	7f 08                	jg     800100 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  8000f8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000fb:	5b                   	pop    %ebx
+  8000fc:	5e                   	pop    %esi
+  8000fd:	5f                   	pop    %edi
+  8000fe:	5d                   	pop    %ebp
+  8000ff:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800100:	83 ec 0c             	sub    $0xc,%esp
+  800103:	50                   	push   %eax
+  800104:	6a 03                	push   $0x3
+  800106:	68 ea 24 80 00       	push   $0x8024ea
+  80010b:	6a 3e                	push   $0x3e
+  80010d:	68 07 25 80 00       	push   $0x802507
+  800112:	e8 22 14 00 00       	call   801539 <_panic>
+
+00800117 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800117:	55                   	push   %ebp
+  800118:	89 e5                	mov    %esp,%ebp
+  80011a:	57                   	push   %edi
+  80011b:	56                   	push   %esi
+  80011c:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80011d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800122:	b8 02 00 00 00       	mov    $0x2,%eax
+  800127:	89 d1                	mov    %edx,%ecx
+  800129:	89 d3                	mov    %edx,%ebx
+  80012b:	89 d7                	mov    %edx,%edi
+  80012d:	89 d6                	mov    %edx,%esi
+  80012f:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800131:	5b                   	pop    %ebx
+  800132:	5e                   	pop    %esi
+  800133:	5f                   	pop    %edi
+  800134:	5d                   	pop    %ebp
+  800135:	c3                   	ret
+
+00800136 <sys_yield>:
+
+void
+sys_yield(void) {
+  800136:	55                   	push   %ebp
+  800137:	89 e5                	mov    %esp,%ebp
+  800139:	57                   	push   %edi
+  80013a:	56                   	push   %esi
+  80013b:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80013c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800141:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800146:	89 d1                	mov    %edx,%ecx
+  800148:	89 d3                	mov    %edx,%ebx
+  80014a:	89 d7                	mov    %edx,%edi
+  80014c:	89 d6                	mov    %edx,%esi
+  80014e:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800150:	5b                   	pop    %ebx
+  800151:	5e                   	pop    %esi
+  800152:	5f                   	pop    %edi
+  800153:	5d                   	pop    %ebp
+  800154:	c3                   	ret
+
+00800155 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  800155:	55                   	push   %ebp
+  800156:	89 e5                	mov    %esp,%ebp
+  800158:	57                   	push   %edi
+  800159:	56                   	push   %esi
+  80015a:	53                   	push   %ebx
+  80015b:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  80015e:	be 00 00 00 00       	mov    $0x0,%esi
+  800163:	8b 55 08             	mov    0x8(%ebp),%edx
+  800166:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800169:	b8 04 00 00 00       	mov    $0x4,%eax
+  80016e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800171:	89 f7                	mov    %esi,%edi
+  800173:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800175:	85 c0                	test   %eax,%eax
+  800177:	7f 08                	jg     800181 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800179:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80017c:	5b                   	pop    %ebx
+  80017d:	5e                   	pop    %esi
+  80017e:	5f                   	pop    %edi
+  80017f:	5d                   	pop    %ebp
+  800180:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800181:	83 ec 0c             	sub    $0xc,%esp
+  800184:	50                   	push   %eax
+  800185:	6a 04                	push   $0x4
+  800187:	68 ea 24 80 00       	push   $0x8024ea
+  80018c:	6a 3e                	push   $0x3e
+  80018e:	68 07 25 80 00       	push   $0x802507
+  800193:	e8 a1 13 00 00       	call   801539 <_panic>
+
+00800198 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  800198:	55                   	push   %ebp
+  800199:	89 e5                	mov    %esp,%ebp
+  80019b:	57                   	push   %edi
+  80019c:	56                   	push   %esi
+  80019d:	53                   	push   %ebx
+  80019e:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8001a1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001a4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001a7:	b8 05 00 00 00       	mov    $0x5,%eax
+  8001ac:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001af:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8001b2:	8b 75 18             	mov    0x18(%ebp),%esi
+  8001b5:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8001b7:	85 c0                	test   %eax,%eax
+  8001b9:	7f 08                	jg     8001c3 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  8001bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001be:	5b                   	pop    %ebx
+  8001bf:	5e                   	pop    %esi
+  8001c0:	5f                   	pop    %edi
+  8001c1:	5d                   	pop    %ebp
+  8001c2:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8001c3:	83 ec 0c             	sub    $0xc,%esp
+  8001c6:	50                   	push   %eax
+  8001c7:	6a 05                	push   $0x5
+  8001c9:	68 ea 24 80 00       	push   $0x8024ea
+  8001ce:	6a 3e                	push   $0x3e
+  8001d0:	68 07 25 80 00       	push   $0x802507
+  8001d5:	e8 5f 13 00 00       	call   801539 <_panic>
+
+008001da <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  8001da:	55                   	push   %ebp
+  8001db:	89 e5                	mov    %esp,%ebp
+  8001dd:	57                   	push   %edi
+  8001de:	56                   	push   %esi
+  8001df:	53                   	push   %ebx
+  8001e0:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8001e3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001e8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001eb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001ee:	b8 06 00 00 00       	mov    $0x6,%eax
+  8001f3:	89 df                	mov    %ebx,%edi
+  8001f5:	89 de                	mov    %ebx,%esi
+  8001f7:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8001f9:	85 c0                	test   %eax,%eax
+  8001fb:	7f 08                	jg     800205 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  8001fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800200:	5b                   	pop    %ebx
+  800201:	5e                   	pop    %esi
+  800202:	5f                   	pop    %edi
+  800203:	5d                   	pop    %ebp
+  800204:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800205:	83 ec 0c             	sub    $0xc,%esp
+  800208:	50                   	push   %eax
+  800209:	6a 06                	push   $0x6
+  80020b:	68 ea 24 80 00       	push   $0x8024ea
+  800210:	6a 3e                	push   $0x3e
+  800212:	68 07 25 80 00       	push   $0x802507
+  800217:	e8 1d 13 00 00       	call   801539 <_panic>
+
+0080021c <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80021c:	55                   	push   %ebp
+  80021d:	89 e5                	mov    %esp,%ebp
+  80021f:	57                   	push   %edi
+  800220:	56                   	push   %esi
+  800221:	53                   	push   %ebx
+  800222:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800225:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80022a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80022d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800230:	b8 08 00 00 00       	mov    $0x8,%eax
+  800235:	89 df                	mov    %ebx,%edi
+  800237:	89 de                	mov    %ebx,%esi
+  800239:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80023b:	85 c0                	test   %eax,%eax
+  80023d:	7f 08                	jg     800247 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  80023f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800242:	5b                   	pop    %ebx
+  800243:	5e                   	pop    %esi
+  800244:	5f                   	pop    %edi
+  800245:	5d                   	pop    %ebp
+  800246:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800247:	83 ec 0c             	sub    $0xc,%esp
+  80024a:	50                   	push   %eax
+  80024b:	6a 08                	push   $0x8
+  80024d:	68 ea 24 80 00       	push   $0x8024ea
+  800252:	6a 3e                	push   $0x3e
+  800254:	68 07 25 80 00       	push   $0x802507
+  800259:	e8 db 12 00 00       	call   801539 <_panic>
+
+0080025e <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80025e:	55                   	push   %ebp
+  80025f:	89 e5                	mov    %esp,%ebp
+  800261:	57                   	push   %edi
+  800262:	56                   	push   %esi
+  800263:	53                   	push   %ebx
+  800264:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800267:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80026c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80026f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800272:	b8 09 00 00 00       	mov    $0x9,%eax
+  800277:	89 df                	mov    %ebx,%edi
+  800279:	89 de                	mov    %ebx,%esi
+  80027b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80027d:	85 c0                	test   %eax,%eax
+  80027f:	7f 08                	jg     800289 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800281:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800284:	5b                   	pop    %ebx
+  800285:	5e                   	pop    %esi
+  800286:	5f                   	pop    %edi
+  800287:	5d                   	pop    %ebp
+  800288:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800289:	83 ec 0c             	sub    $0xc,%esp
+  80028c:	50                   	push   %eax
+  80028d:	6a 09                	push   $0x9
+  80028f:	68 ea 24 80 00       	push   $0x8024ea
+  800294:	6a 3e                	push   $0x3e
+  800296:	68 07 25 80 00       	push   $0x802507
+  80029b:	e8 99 12 00 00       	call   801539 <_panic>
+
+008002a0 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8002a0:	55                   	push   %ebp
+  8002a1:	89 e5                	mov    %esp,%ebp
+  8002a3:	57                   	push   %edi
+  8002a4:	56                   	push   %esi
+  8002a5:	53                   	push   %ebx
+  8002a6:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8002a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002b1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002b4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8002b9:	89 df                	mov    %ebx,%edi
+  8002bb:	89 de                	mov    %ebx,%esi
+  8002bd:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8002bf:	85 c0                	test   %eax,%eax
+  8002c1:	7f 08                	jg     8002cb <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8002c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002c6:	5b                   	pop    %ebx
+  8002c7:	5e                   	pop    %esi
+  8002c8:	5f                   	pop    %edi
+  8002c9:	5d                   	pop    %ebp
+  8002ca:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8002cb:	83 ec 0c             	sub    $0xc,%esp
+  8002ce:	50                   	push   %eax
+  8002cf:	6a 0a                	push   $0xa
+  8002d1:	68 ea 24 80 00       	push   $0x8024ea
+  8002d6:	6a 3e                	push   $0x3e
+  8002d8:	68 07 25 80 00       	push   $0x802507
+  8002dd:	e8 57 12 00 00       	call   801539 <_panic>
+
+008002e2 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  8002e2:	55                   	push   %ebp
+  8002e3:	89 e5                	mov    %esp,%ebp
+  8002e5:	57                   	push   %edi
+  8002e6:	56                   	push   %esi
+  8002e7:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8002e8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002eb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002ee:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8002f3:	be 00 00 00 00       	mov    $0x0,%esi
+  8002f8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8002fb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8002fe:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800300:	5b                   	pop    %ebx
+  800301:	5e                   	pop    %esi
+  800302:	5f                   	pop    %edi
+  800303:	5d                   	pop    %ebp
+  800304:	c3                   	ret
+
+00800305 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  800305:	55                   	push   %ebp
+  800306:	89 e5                	mov    %esp,%ebp
+  800308:	57                   	push   %edi
+  800309:	56                   	push   %esi
+  80030a:	53                   	push   %ebx
+  80030b:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  80030e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800313:	8b 55 08             	mov    0x8(%ebp),%edx
+  800316:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80031b:	89 cb                	mov    %ecx,%ebx
+  80031d:	89 cf                	mov    %ecx,%edi
+  80031f:	89 ce                	mov    %ecx,%esi
+  800321:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800323:	85 c0                	test   %eax,%eax
+  800325:	7f 08                	jg     80032f <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  800327:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80032a:	5b                   	pop    %ebx
+  80032b:	5e                   	pop    %esi
+  80032c:	5f                   	pop    %edi
+  80032d:	5d                   	pop    %ebp
+  80032e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80032f:	83 ec 0c             	sub    $0xc,%esp
+  800332:	50                   	push   %eax
+  800333:	6a 0d                	push   $0xd
+  800335:	68 ea 24 80 00       	push   $0x8024ea
+  80033a:	6a 3e                	push   $0x3e
+  80033c:	68 07 25 80 00       	push   $0x802507
+  800341:	e8 f3 11 00 00       	call   801539 <_panic>
+
+00800346 <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  800346:	55                   	push   %ebp
+  800347:	89 e5                	mov    %esp,%ebp
+  800349:	57                   	push   %edi
+  80034a:	56                   	push   %esi
+  80034b:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80034c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800351:	8b 55 08             	mov    0x8(%ebp),%edx
+  800354:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800357:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80035c:	89 df                	mov    %ebx,%edi
+  80035e:	89 de                	mov    %ebx,%esi
+  800360:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  800362:	5b                   	pop    %ebx
+  800363:	5e                   	pop    %esi
+  800364:	5f                   	pop    %edi
+  800365:	5d                   	pop    %ebp
+  800366:	c3                   	ret
+
+00800367 <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  800367:	55                   	push   %ebp
+  800368:	89 e5                	mov    %esp,%ebp
+  80036a:	57                   	push   %edi
+  80036b:	56                   	push   %esi
+  80036c:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80036d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800372:	8b 55 08             	mov    0x8(%ebp),%edx
+  800375:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80037a:	89 cb                	mov    %ecx,%ebx
+  80037c:	89 cf                	mov    %ecx,%edi
+  80037e:	89 ce                	mov    %ecx,%esi
+  800380:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  800382:	5b                   	pop    %ebx
+  800383:	5e                   	pop    %esi
+  800384:	5f                   	pop    %edi
+  800385:	5d                   	pop    %ebp
+  800386:	c3                   	ret
+
+00800387 <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  800387:	55                   	push   %ebp
+  800388:	89 e5                	mov    %esp,%ebp
+  80038a:	57                   	push   %edi
+  80038b:	56                   	push   %esi
+  80038c:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80038d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800392:	b8 10 00 00 00       	mov    $0x10,%eax
+  800397:	89 d1                	mov    %edx,%ecx
+  800399:	89 d3                	mov    %edx,%ebx
+  80039b:	89 d7                	mov    %edx,%edi
+  80039d:	89 d6                	mov    %edx,%esi
+  80039f:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8003a1:	5b                   	pop    %ebx
+  8003a2:	5e                   	pop    %esi
+  8003a3:	5f                   	pop    %edi
+  8003a4:	5d                   	pop    %ebp
+  8003a5:	c3                   	ret
+
+008003a6 <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  8003a6:	55                   	push   %ebp
+  8003a7:	89 e5                	mov    %esp,%ebp
+  8003a9:	57                   	push   %edi
+  8003aa:	56                   	push   %esi
+  8003ab:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8003ac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003b1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003b4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003b7:	b8 11 00 00 00       	mov    $0x11,%eax
+  8003bc:	89 df                	mov    %ebx,%edi
+  8003be:	89 de                	mov    %ebx,%esi
+  8003c0:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  8003c2:	5b                   	pop    %ebx
+  8003c3:	5e                   	pop    %esi
+  8003c4:	5f                   	pop    %edi
+  8003c5:	5d                   	pop    %ebp
+  8003c6:	c3                   	ret
+
+008003c7 <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  8003c7:	55                   	push   %ebp
+  8003c8:	89 e5                	mov    %esp,%ebp
+  8003ca:	57                   	push   %edi
+  8003cb:	56                   	push   %esi
+  8003cc:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8003cd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003d2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003d5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003d8:	b8 12 00 00 00       	mov    $0x12,%eax
+  8003dd:	89 df                	mov    %ebx,%edi
+  8003df:	89 de                	mov    %ebx,%esi
+  8003e1:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  8003e3:	5b                   	pop    %ebx
+  8003e4:	5e                   	pop    %esi
+  8003e5:	5f                   	pop    %edi
+  8003e6:	5d                   	pop    %ebp
+  8003e7:	c3                   	ret
+
+008003e8 <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  8003e8:	55                   	push   %ebp
+  8003e9:	89 e5                	mov    %esp,%ebp
+  8003eb:	57                   	push   %edi
+  8003ec:	56                   	push   %esi
+  8003ed:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8003ee:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8003f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003f6:	b8 13 00 00 00       	mov    $0x13,%eax
+  8003fb:	89 cb                	mov    %ecx,%ebx
+  8003fd:	89 cf                	mov    %ecx,%edi
+  8003ff:	89 ce                	mov    %ecx,%esi
+  800401:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  800403:	5b                   	pop    %ebx
+  800404:	5e                   	pop    %esi
+  800405:	5f                   	pop    %edi
+  800406:	5d                   	pop    %ebp
+  800407:	c3                   	ret
+
+00800408 <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  800408:	55                   	push   %ebp
+  800409:	89 e5                	mov    %esp,%ebp
+  80040b:	57                   	push   %edi
+  80040c:	56                   	push   %esi
+  80040d:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80040e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800413:	8b 55 08             	mov    0x8(%ebp),%edx
+  800416:	b8 14 00 00 00       	mov    $0x14,%eax
+  80041b:	89 cb                	mov    %ecx,%ebx
+  80041d:	89 cf                	mov    %ecx,%edi
+  80041f:	89 ce                	mov    %ecx,%esi
+  800421:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  800423:	5b                   	pop    %ebx
+  800424:	5e                   	pop    %esi
+  800425:	5f                   	pop    %edi
+  800426:	5d                   	pop    %ebp
+  800427:	c3                   	ret
+
+00800428 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800428:	55                   	push   %ebp
+  800429:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80042b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80042e:	05 00 00 00 30       	add    $0x30000000,%eax
+  800433:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800436:	5d                   	pop    %ebp
+  800437:	c3                   	ret
+
+00800438 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800438:	55                   	push   %ebp
+  800439:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80043b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80043e:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800443:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800448:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80044d:	5d                   	pop    %ebp
+  80044e:	c3                   	ret
+
+0080044f <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80044f:	55                   	push   %ebp
+  800450:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  800452:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800457:	eb 02                	jmp    80045b <fd_alloc+0xc>
+  800459:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80045b:	89 c2                	mov    %eax,%edx
+  80045d:	c1 ea 16             	shr    $0x16,%edx
+  800460:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800467:	f6 c2 01             	test   $0x1,%dl
+  80046a:	74 2b                	je     800497 <fd_alloc+0x48>
+  80046c:	89 c2                	mov    %eax,%edx
+  80046e:	c1 ea 0c             	shr    $0xc,%edx
+  800471:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  800478:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80047e:	f6 c1 01             	test   $0x1,%cl
+  800481:	74 14                	je     800497 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  800483:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  800489:	75 ce                	jne    800459 <fd_alloc+0xa>
+  80048b:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  800490:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800495:	eb 05                	jmp    80049c <fd_alloc+0x4d>
+			return 0;
+  800497:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80049c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80049f:	89 02                	mov    %eax,(%edx)
+}
+  8004a1:	89 c8                	mov    %ecx,%eax
+  8004a3:	5d                   	pop    %ebp
+  8004a4:	c3                   	ret
+
+008004a5 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8004a5:	55                   	push   %ebp
+  8004a6:	89 e5                	mov    %esp,%ebp
+  8004a8:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8004ab:	83 f8 1f             	cmp    $0x1f,%eax
+  8004ae:	77 30                	ja     8004e0 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8004b0:	c1 e0 0c             	shl    $0xc,%eax
+  8004b3:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8004b8:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8004be:	f6 c2 01             	test   $0x1,%dl
+  8004c1:	74 24                	je     8004e7 <fd_lookup+0x42>
+  8004c3:	89 c2                	mov    %eax,%edx
+  8004c5:	c1 ea 0c             	shr    $0xc,%edx
+  8004c8:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8004cf:	f6 c2 01             	test   $0x1,%dl
+  8004d2:	74 1a                	je     8004ee <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8004d4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8004d7:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8004d9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8004de:	5d                   	pop    %ebp
+  8004df:	c3                   	ret
+		return -E_INVAL;
+  8004e0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8004e5:	eb f7                	jmp    8004de <fd_lookup+0x39>
+		return -E_INVAL;
+  8004e7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8004ec:	eb f0                	jmp    8004de <fd_lookup+0x39>
+  8004ee:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8004f3:	eb e9                	jmp    8004de <fd_lookup+0x39>
+
+008004f5 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8004f5:	55                   	push   %ebp
+  8004f6:	89 e5                	mov    %esp,%ebp
+  8004f8:	53                   	push   %ebx
+  8004f9:	83 ec 04             	sub    $0x4,%esp
+  8004fc:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8004ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  800504:	eb 03                	jmp    800509 <dev_lookup+0x14>
+  800506:	83 c0 01             	add    $0x1,%eax
+  800509:	8b 1c 85 94 25 80 00 	mov    0x802594(,%eax,4),%ebx
+  800510:	85 db                	test   %ebx,%ebx
+  800512:	74 0b                	je     80051f <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  800514:	39 13                	cmp    %edx,(%ebx)
+  800516:	75 ee                	jne    800506 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  800518:	b8 00 00 00 00       	mov    $0x0,%eax
+  80051d:	eb 1f                	jmp    80053e <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80051f:	a1 08 40 80 00       	mov    0x804008,%eax
+  800524:	8b 40 48             	mov    0x48(%eax),%eax
+  800527:	83 ec 04             	sub    $0x4,%esp
+  80052a:	52                   	push   %edx
+  80052b:	50                   	push   %eax
+  80052c:	68 18 25 80 00       	push   $0x802518
+  800531:	e8 de 10 00 00       	call   801614 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  800536:	83 c4 10             	add    $0x10,%esp
+  800539:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80053e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800541:	89 1a                	mov    %ebx,(%edx)
+}
+  800543:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800546:	c9                   	leave
+  800547:	c3                   	ret
+
+00800548 <fd_close>:
+{
+  800548:	55                   	push   %ebp
+  800549:	89 e5                	mov    %esp,%ebp
+  80054b:	57                   	push   %edi
+  80054c:	56                   	push   %esi
+  80054d:	53                   	push   %ebx
+  80054e:	83 ec 24             	sub    $0x24,%esp
+  800551:	8b 75 08             	mov    0x8(%ebp),%esi
+  800554:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800557:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80055a:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80055b:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800561:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800564:	50                   	push   %eax
+  800565:	e8 3b ff ff ff       	call   8004a5 <fd_lookup>
+  80056a:	89 c3                	mov    %eax,%ebx
+  80056c:	83 c4 10             	add    $0x10,%esp
+  80056f:	85 c0                	test   %eax,%eax
+  800571:	78 05                	js     800578 <fd_close+0x30>
+	    || fd != fd2)
+  800573:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  800576:	74 16                	je     80058e <fd_close+0x46>
+		return (must_exist ? r : 0);
+  800578:	89 f8                	mov    %edi,%eax
+  80057a:	84 c0                	test   %al,%al
+  80057c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800581:	0f 44 d8             	cmove  %eax,%ebx
+}
+  800584:	89 d8                	mov    %ebx,%eax
+  800586:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800589:	5b                   	pop    %ebx
+  80058a:	5e                   	pop    %esi
+  80058b:	5f                   	pop    %edi
+  80058c:	5d                   	pop    %ebp
+  80058d:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80058e:	83 ec 08             	sub    $0x8,%esp
+  800591:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800594:	50                   	push   %eax
+  800595:	ff 36                	push   (%esi)
+  800597:	e8 59 ff ff ff       	call   8004f5 <dev_lookup>
+  80059c:	89 c3                	mov    %eax,%ebx
+  80059e:	83 c4 10             	add    $0x10,%esp
+  8005a1:	85 c0                	test   %eax,%eax
+  8005a3:	78 1a                	js     8005bf <fd_close+0x77>
+		if (dev->dev_close)
+  8005a5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005a8:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8005ab:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8005b0:	85 c0                	test   %eax,%eax
+  8005b2:	74 0b                	je     8005bf <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8005b4:	83 ec 0c             	sub    $0xc,%esp
+  8005b7:	56                   	push   %esi
+  8005b8:	ff d0                	call   *%eax
+  8005ba:	89 c3                	mov    %eax,%ebx
+  8005bc:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8005bf:	83 ec 08             	sub    $0x8,%esp
+  8005c2:	56                   	push   %esi
+  8005c3:	6a 00                	push   $0x0
+  8005c5:	e8 10 fc ff ff       	call   8001da <sys_page_unmap>
+	return r;
+  8005ca:	83 c4 10             	add    $0x10,%esp
+  8005cd:	eb b5                	jmp    800584 <fd_close+0x3c>
+
+008005cf <close>:
+
+int
+close(int fdnum)
+{
+  8005cf:	55                   	push   %ebp
+  8005d0:	89 e5                	mov    %esp,%ebp
+  8005d2:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8005d5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8005d8:	50                   	push   %eax
+  8005d9:	ff 75 08             	push   0x8(%ebp)
+  8005dc:	e8 c4 fe ff ff       	call   8004a5 <fd_lookup>
+  8005e1:	83 c4 10             	add    $0x10,%esp
+  8005e4:	85 c0                	test   %eax,%eax
+  8005e6:	79 02                	jns    8005ea <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8005e8:	c9                   	leave
+  8005e9:	c3                   	ret
+		return fd_close(fd, 1);
+  8005ea:	83 ec 08             	sub    $0x8,%esp
+  8005ed:	6a 01                	push   $0x1
+  8005ef:	ff 75 f4             	push   -0xc(%ebp)
+  8005f2:	e8 51 ff ff ff       	call   800548 <fd_close>
+  8005f7:	83 c4 10             	add    $0x10,%esp
+  8005fa:	eb ec                	jmp    8005e8 <close+0x19>
+
+008005fc <close_all>:
+
+void
+close_all(void)
+{
+  8005fc:	55                   	push   %ebp
+  8005fd:	89 e5                	mov    %esp,%ebp
+  8005ff:	53                   	push   %ebx
+  800600:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  800603:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  800608:	83 ec 0c             	sub    $0xc,%esp
+  80060b:	53                   	push   %ebx
+  80060c:	e8 be ff ff ff       	call   8005cf <close>
+	for (i = 0; i < MAXFD; i++)
+  800611:	83 c3 01             	add    $0x1,%ebx
+  800614:	83 c4 10             	add    $0x10,%esp
+  800617:	83 fb 20             	cmp    $0x20,%ebx
+  80061a:	75 ec                	jne    800608 <close_all+0xc>
+}
+  80061c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80061f:	c9                   	leave
+  800620:	c3                   	ret
+
+00800621 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  800621:	55                   	push   %ebp
+  800622:	89 e5                	mov    %esp,%ebp
+  800624:	57                   	push   %edi
+  800625:	56                   	push   %esi
+  800626:	53                   	push   %ebx
+  800627:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80062a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80062d:	50                   	push   %eax
+  80062e:	ff 75 08             	push   0x8(%ebp)
+  800631:	e8 6f fe ff ff       	call   8004a5 <fd_lookup>
+  800636:	89 c3                	mov    %eax,%ebx
+  800638:	83 c4 10             	add    $0x10,%esp
+  80063b:	85 c0                	test   %eax,%eax
+  80063d:	78 7f                	js     8006be <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80063f:	83 ec 0c             	sub    $0xc,%esp
+  800642:	ff 75 0c             	push   0xc(%ebp)
+  800645:	e8 85 ff ff ff       	call   8005cf <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80064a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80064d:	c1 e6 0c             	shl    $0xc,%esi
+  800650:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  800656:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800659:	89 3c 24             	mov    %edi,(%esp)
+  80065c:	e8 d7 fd ff ff       	call   800438 <fd2data>
+  800661:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  800663:	89 34 24             	mov    %esi,(%esp)
+  800666:	e8 cd fd ff ff       	call   800438 <fd2data>
+  80066b:	83 c4 10             	add    $0x10,%esp
+  80066e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  800671:	89 d8                	mov    %ebx,%eax
+  800673:	c1 e8 16             	shr    $0x16,%eax
+  800676:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80067d:	a8 01                	test   $0x1,%al
+  80067f:	74 11                	je     800692 <dup+0x71>
+  800681:	89 d8                	mov    %ebx,%eax
+  800683:	c1 e8 0c             	shr    $0xc,%eax
+  800686:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80068d:	f6 c2 01             	test   $0x1,%dl
+  800690:	75 36                	jne    8006c8 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  800692:	89 f8                	mov    %edi,%eax
+  800694:	c1 e8 0c             	shr    $0xc,%eax
+  800697:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80069e:	83 ec 0c             	sub    $0xc,%esp
+  8006a1:	25 07 0e 00 00       	and    $0xe07,%eax
+  8006a6:	50                   	push   %eax
+  8006a7:	56                   	push   %esi
+  8006a8:	6a 00                	push   $0x0
+  8006aa:	57                   	push   %edi
+  8006ab:	6a 00                	push   $0x0
+  8006ad:	e8 e6 fa ff ff       	call   800198 <sys_page_map>
+  8006b2:	89 c3                	mov    %eax,%ebx
+  8006b4:	83 c4 20             	add    $0x20,%esp
+  8006b7:	85 c0                	test   %eax,%eax
+  8006b9:	78 33                	js     8006ee <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8006bb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8006be:	89 d8                	mov    %ebx,%eax
+  8006c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006c3:	5b                   	pop    %ebx
+  8006c4:	5e                   	pop    %esi
+  8006c5:	5f                   	pop    %edi
+  8006c6:	5d                   	pop    %ebp
+  8006c7:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8006c8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8006cf:	83 ec 0c             	sub    $0xc,%esp
+  8006d2:	25 07 0e 00 00       	and    $0xe07,%eax
+  8006d7:	50                   	push   %eax
+  8006d8:	ff 75 d4             	push   -0x2c(%ebp)
+  8006db:	6a 00                	push   $0x0
+  8006dd:	53                   	push   %ebx
+  8006de:	6a 00                	push   $0x0
+  8006e0:	e8 b3 fa ff ff       	call   800198 <sys_page_map>
+  8006e5:	89 c3                	mov    %eax,%ebx
+  8006e7:	83 c4 20             	add    $0x20,%esp
+  8006ea:	85 c0                	test   %eax,%eax
+  8006ec:	79 a4                	jns    800692 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8006ee:	83 ec 08             	sub    $0x8,%esp
+  8006f1:	56                   	push   %esi
+  8006f2:	6a 00                	push   $0x0
+  8006f4:	e8 e1 fa ff ff       	call   8001da <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8006f9:	83 c4 08             	add    $0x8,%esp
+  8006fc:	ff 75 d4             	push   -0x2c(%ebp)
+  8006ff:	6a 00                	push   $0x0
+  800701:	e8 d4 fa ff ff       	call   8001da <sys_page_unmap>
+	return r;
+  800706:	83 c4 10             	add    $0x10,%esp
+  800709:	eb b3                	jmp    8006be <dup+0x9d>
+
+0080070b <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80070b:	55                   	push   %ebp
+  80070c:	89 e5                	mov    %esp,%ebp
+  80070e:	56                   	push   %esi
+  80070f:	53                   	push   %ebx
+  800710:	83 ec 18             	sub    $0x18,%esp
+  800713:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800716:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800719:	50                   	push   %eax
+  80071a:	56                   	push   %esi
+  80071b:	e8 85 fd ff ff       	call   8004a5 <fd_lookup>
+  800720:	83 c4 10             	add    $0x10,%esp
+  800723:	85 c0                	test   %eax,%eax
+  800725:	78 3c                	js     800763 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800727:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80072a:	83 ec 08             	sub    $0x8,%esp
+  80072d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800730:	50                   	push   %eax
+  800731:	ff 33                	push   (%ebx)
+  800733:	e8 bd fd ff ff       	call   8004f5 <dev_lookup>
+  800738:	83 c4 10             	add    $0x10,%esp
+  80073b:	85 c0                	test   %eax,%eax
+  80073d:	78 24                	js     800763 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80073f:	8b 43 08             	mov    0x8(%ebx),%eax
+  800742:	83 e0 03             	and    $0x3,%eax
+  800745:	83 f8 01             	cmp    $0x1,%eax
+  800748:	74 20                	je     80076a <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80074a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80074d:	8b 40 08             	mov    0x8(%eax),%eax
+  800750:	85 c0                	test   %eax,%eax
+  800752:	74 37                	je     80078b <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  800754:	83 ec 04             	sub    $0x4,%esp
+  800757:	ff 75 10             	push   0x10(%ebp)
+  80075a:	ff 75 0c             	push   0xc(%ebp)
+  80075d:	53                   	push   %ebx
+  80075e:	ff d0                	call   *%eax
+  800760:	83 c4 10             	add    $0x10,%esp
+}
+  800763:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800766:	5b                   	pop    %ebx
+  800767:	5e                   	pop    %esi
+  800768:	5d                   	pop    %ebp
+  800769:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80076a:	a1 08 40 80 00       	mov    0x804008,%eax
+  80076f:	8b 40 48             	mov    0x48(%eax),%eax
+  800772:	83 ec 04             	sub    $0x4,%esp
+  800775:	56                   	push   %esi
+  800776:	50                   	push   %eax
+  800777:	68 59 25 80 00       	push   $0x802559
+  80077c:	e8 93 0e 00 00       	call   801614 <cprintf>
+		return -E_INVAL;
+  800781:	83 c4 10             	add    $0x10,%esp
+  800784:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800789:	eb d8                	jmp    800763 <read+0x58>
+		return -E_NOT_SUPP;
+  80078b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800790:	eb d1                	jmp    800763 <read+0x58>
+
+00800792 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  800792:	55                   	push   %ebp
+  800793:	89 e5                	mov    %esp,%ebp
+  800795:	57                   	push   %edi
+  800796:	56                   	push   %esi
+  800797:	53                   	push   %ebx
+  800798:	83 ec 0c             	sub    $0xc,%esp
+  80079b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80079e:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8007a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8007a6:	eb 02                	jmp    8007aa <readn+0x18>
+  8007a8:	01 c3                	add    %eax,%ebx
+  8007aa:	39 f3                	cmp    %esi,%ebx
+  8007ac:	73 21                	jae    8007cf <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8007ae:	83 ec 04             	sub    $0x4,%esp
+  8007b1:	89 f0                	mov    %esi,%eax
+  8007b3:	29 d8                	sub    %ebx,%eax
+  8007b5:	50                   	push   %eax
+  8007b6:	89 d8                	mov    %ebx,%eax
+  8007b8:	03 45 0c             	add    0xc(%ebp),%eax
+  8007bb:	50                   	push   %eax
+  8007bc:	57                   	push   %edi
+  8007bd:	e8 49 ff ff ff       	call   80070b <read>
+		if (m < 0)
+  8007c2:	83 c4 10             	add    $0x10,%esp
+  8007c5:	85 c0                	test   %eax,%eax
+  8007c7:	78 04                	js     8007cd <readn+0x3b>
+			return m;
+		if (m == 0)
+  8007c9:	75 dd                	jne    8007a8 <readn+0x16>
+  8007cb:	eb 02                	jmp    8007cf <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8007cd:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8007cf:	89 d8                	mov    %ebx,%eax
+  8007d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007d4:	5b                   	pop    %ebx
+  8007d5:	5e                   	pop    %esi
+  8007d6:	5f                   	pop    %edi
+  8007d7:	5d                   	pop    %ebp
+  8007d8:	c3                   	ret
+
+008007d9 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8007d9:	55                   	push   %ebp
+  8007da:	89 e5                	mov    %esp,%ebp
+  8007dc:	56                   	push   %esi
+  8007dd:	53                   	push   %ebx
+  8007de:	83 ec 18             	sub    $0x18,%esp
+  8007e1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8007e4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8007e7:	50                   	push   %eax
+  8007e8:	53                   	push   %ebx
+  8007e9:	e8 b7 fc ff ff       	call   8004a5 <fd_lookup>
+  8007ee:	83 c4 10             	add    $0x10,%esp
+  8007f1:	85 c0                	test   %eax,%eax
+  8007f3:	78 37                	js     80082c <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8007f5:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8007f8:	83 ec 08             	sub    $0x8,%esp
+  8007fb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8007fe:	50                   	push   %eax
+  8007ff:	ff 36                	push   (%esi)
+  800801:	e8 ef fc ff ff       	call   8004f5 <dev_lookup>
+  800806:	83 c4 10             	add    $0x10,%esp
+  800809:	85 c0                	test   %eax,%eax
+  80080b:	78 1f                	js     80082c <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80080d:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800811:	74 20                	je     800833 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  800813:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800816:	8b 40 0c             	mov    0xc(%eax),%eax
+  800819:	85 c0                	test   %eax,%eax
+  80081b:	74 37                	je     800854 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80081d:	83 ec 04             	sub    $0x4,%esp
+  800820:	ff 75 10             	push   0x10(%ebp)
+  800823:	ff 75 0c             	push   0xc(%ebp)
+  800826:	56                   	push   %esi
+  800827:	ff d0                	call   *%eax
+  800829:	83 c4 10             	add    $0x10,%esp
+}
+  80082c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80082f:	5b                   	pop    %ebx
+  800830:	5e                   	pop    %esi
+  800831:	5d                   	pop    %ebp
+  800832:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800833:	a1 08 40 80 00       	mov    0x804008,%eax
+  800838:	8b 40 48             	mov    0x48(%eax),%eax
+  80083b:	83 ec 04             	sub    $0x4,%esp
+  80083e:	53                   	push   %ebx
+  80083f:	50                   	push   %eax
+  800840:	68 75 25 80 00       	push   $0x802575
+  800845:	e8 ca 0d 00 00       	call   801614 <cprintf>
+		return -E_INVAL;
+  80084a:	83 c4 10             	add    $0x10,%esp
+  80084d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800852:	eb d8                	jmp    80082c <write+0x53>
+		return -E_NOT_SUPP;
+  800854:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800859:	eb d1                	jmp    80082c <write+0x53>
+
+0080085b <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80085b:	55                   	push   %ebp
+  80085c:	89 e5                	mov    %esp,%ebp
+  80085e:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800861:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800864:	50                   	push   %eax
+  800865:	ff 75 08             	push   0x8(%ebp)
+  800868:	e8 38 fc ff ff       	call   8004a5 <fd_lookup>
+  80086d:	83 c4 10             	add    $0x10,%esp
+  800870:	85 c0                	test   %eax,%eax
+  800872:	78 0e                	js     800882 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  800874:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800877:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80087a:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80087d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800882:	c9                   	leave
+  800883:	c3                   	ret
+
+00800884 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800884:	55                   	push   %ebp
+  800885:	89 e5                	mov    %esp,%ebp
+  800887:	56                   	push   %esi
+  800888:	53                   	push   %ebx
+  800889:	83 ec 18             	sub    $0x18,%esp
+  80088c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80088f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800892:	50                   	push   %eax
+  800893:	53                   	push   %ebx
+  800894:	e8 0c fc ff ff       	call   8004a5 <fd_lookup>
+  800899:	83 c4 10             	add    $0x10,%esp
+  80089c:	85 c0                	test   %eax,%eax
+  80089e:	78 34                	js     8008d4 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8008a0:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8008a3:	83 ec 08             	sub    $0x8,%esp
+  8008a6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8008a9:	50                   	push   %eax
+  8008aa:	ff 36                	push   (%esi)
+  8008ac:	e8 44 fc ff ff       	call   8004f5 <dev_lookup>
+  8008b1:	83 c4 10             	add    $0x10,%esp
+  8008b4:	85 c0                	test   %eax,%eax
+  8008b6:	78 1c                	js     8008d4 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8008b8:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8008bc:	74 1d                	je     8008db <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8008be:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008c1:	8b 40 18             	mov    0x18(%eax),%eax
+  8008c4:	85 c0                	test   %eax,%eax
+  8008c6:	74 34                	je     8008fc <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8008c8:	83 ec 08             	sub    $0x8,%esp
+  8008cb:	ff 75 0c             	push   0xc(%ebp)
+  8008ce:	56                   	push   %esi
+  8008cf:	ff d0                	call   *%eax
+  8008d1:	83 c4 10             	add    $0x10,%esp
+}
+  8008d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8008d7:	5b                   	pop    %ebx
+  8008d8:	5e                   	pop    %esi
+  8008d9:	5d                   	pop    %ebp
+  8008da:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8008db:	a1 08 40 80 00       	mov    0x804008,%eax
+  8008e0:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8008e3:	83 ec 04             	sub    $0x4,%esp
+  8008e6:	53                   	push   %ebx
+  8008e7:	50                   	push   %eax
+  8008e8:	68 38 25 80 00       	push   $0x802538
+  8008ed:	e8 22 0d 00 00       	call   801614 <cprintf>
+		return -E_INVAL;
+  8008f2:	83 c4 10             	add    $0x10,%esp
+  8008f5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008fa:	eb d8                	jmp    8008d4 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8008fc:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800901:	eb d1                	jmp    8008d4 <ftruncate+0x50>
+
+00800903 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800903:	55                   	push   %ebp
+  800904:	89 e5                	mov    %esp,%ebp
+  800906:	56                   	push   %esi
+  800907:	53                   	push   %ebx
+  800908:	83 ec 18             	sub    $0x18,%esp
+  80090b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80090e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800911:	50                   	push   %eax
+  800912:	ff 75 08             	push   0x8(%ebp)
+  800915:	e8 8b fb ff ff       	call   8004a5 <fd_lookup>
+  80091a:	83 c4 10             	add    $0x10,%esp
+  80091d:	85 c0                	test   %eax,%eax
+  80091f:	78 49                	js     80096a <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800921:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800924:	83 ec 08             	sub    $0x8,%esp
+  800927:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80092a:	50                   	push   %eax
+  80092b:	ff 36                	push   (%esi)
+  80092d:	e8 c3 fb ff ff       	call   8004f5 <dev_lookup>
+  800932:	83 c4 10             	add    $0x10,%esp
+  800935:	85 c0                	test   %eax,%eax
+  800937:	78 31                	js     80096a <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  800939:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80093c:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800940:	74 2f                	je     800971 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  800942:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  800945:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80094c:	00 00 00 
+	stat->st_isdir = 0;
+  80094f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800956:	00 00 00 
+	stat->st_dev = dev;
+  800959:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80095f:	83 ec 08             	sub    $0x8,%esp
+  800962:	53                   	push   %ebx
+  800963:	56                   	push   %esi
+  800964:	ff 50 14             	call   *0x14(%eax)
+  800967:	83 c4 10             	add    $0x10,%esp
+}
+  80096a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80096d:	5b                   	pop    %ebx
+  80096e:	5e                   	pop    %esi
+  80096f:	5d                   	pop    %ebp
+  800970:	c3                   	ret
+		return -E_NOT_SUPP;
+  800971:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800976:	eb f2                	jmp    80096a <fstat+0x67>
+
+00800978 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  800978:	55                   	push   %ebp
+  800979:	89 e5                	mov    %esp,%ebp
+  80097b:	56                   	push   %esi
+  80097c:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80097d:	83 ec 08             	sub    $0x8,%esp
+  800980:	6a 00                	push   $0x0
+  800982:	ff 75 08             	push   0x8(%ebp)
+  800985:	e8 e4 01 00 00       	call   800b6e <open>
+  80098a:	89 c3                	mov    %eax,%ebx
+  80098c:	83 c4 10             	add    $0x10,%esp
+  80098f:	85 c0                	test   %eax,%eax
+  800991:	78 1b                	js     8009ae <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  800993:	83 ec 08             	sub    $0x8,%esp
+  800996:	ff 75 0c             	push   0xc(%ebp)
+  800999:	50                   	push   %eax
+  80099a:	e8 64 ff ff ff       	call   800903 <fstat>
+  80099f:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8009a1:	89 1c 24             	mov    %ebx,(%esp)
+  8009a4:	e8 26 fc ff ff       	call   8005cf <close>
+	return r;
+  8009a9:	83 c4 10             	add    $0x10,%esp
+  8009ac:	89 f3                	mov    %esi,%ebx
+}
+  8009ae:	89 d8                	mov    %ebx,%eax
+  8009b0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8009b3:	5b                   	pop    %ebx
+  8009b4:	5e                   	pop    %esi
+  8009b5:	5d                   	pop    %ebp
+  8009b6:	c3                   	ret
+
+008009b7 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  8009b7:	55                   	push   %ebp
+  8009b8:	89 e5                	mov    %esp,%ebp
+  8009ba:	56                   	push   %esi
+  8009bb:	53                   	push   %ebx
+  8009bc:	89 c6                	mov    %eax,%esi
+  8009be:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  8009c0:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  8009c7:	74 27                	je     8009f0 <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8009c9:	6a 07                	push   $0x7
+  8009cb:	68 00 50 80 00       	push   $0x805000
+  8009d0:	56                   	push   %esi
+  8009d1:	ff 35 00 40 80 00    	push   0x804000
+  8009d7:	e8 95 15 00 00       	call   801f71 <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  8009dc:	83 c4 0c             	add    $0xc,%esp
+  8009df:	6a 00                	push   $0x0
+  8009e1:	53                   	push   %ebx
+  8009e2:	6a 00                	push   $0x0
+  8009e4:	e8 14 15 00 00       	call   801efd <ipc_recv>
+}
+  8009e9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8009ec:	5b                   	pop    %ebx
+  8009ed:	5e                   	pop    %esi
+  8009ee:	5d                   	pop    %ebp
+  8009ef:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  8009f0:	83 ec 0c             	sub    $0xc,%esp
+  8009f3:	6a 01                	push   $0x1
+  8009f5:	e8 cb 15 00 00       	call   801fc5 <ipc_find_env>
+  8009fa:	a3 00 40 80 00       	mov    %eax,0x804000
+  8009ff:	83 c4 10             	add    $0x10,%esp
+  800a02:	eb c5                	jmp    8009c9 <fsipc+0x12>
+
+00800a04 <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  800a04:	55                   	push   %ebp
+  800a05:	89 e5                	mov    %esp,%ebp
+  800a07:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800a0a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a0d:	8b 40 0c             	mov    0xc(%eax),%eax
+  800a10:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.set_size.req_size = newsize;
+  800a15:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a18:	a3 04 50 80 00       	mov    %eax,0x805004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  800a1d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a22:	b8 02 00 00 00       	mov    $0x2,%eax
+  800a27:	e8 8b ff ff ff       	call   8009b7 <fsipc>
+}
+  800a2c:	c9                   	leave
+  800a2d:	c3                   	ret
+
+00800a2e <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  800a2e:	55                   	push   %ebp
+  800a2f:	89 e5                	mov    %esp,%ebp
+  800a31:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800a34:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a37:	8b 40 0c             	mov    0xc(%eax),%eax
+  800a3a:	a3 00 50 80 00       	mov    %eax,0x805000
+  return fsipc(FSREQ_FLUSH, NULL);
+  800a3f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a44:	b8 06 00 00 00       	mov    $0x6,%eax
+  800a49:	e8 69 ff ff ff       	call   8009b7 <fsipc>
+}
+  800a4e:	c9                   	leave
+  800a4f:	c3                   	ret
+
+00800a50 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  800a50:	55                   	push   %ebp
+  800a51:	89 e5                	mov    %esp,%ebp
+  800a53:	53                   	push   %ebx
+  800a54:	83 ec 04             	sub    $0x4,%esp
+  800a57:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800a5a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a5d:	8b 40 0c             	mov    0xc(%eax),%eax
+  800a60:	a3 00 50 80 00       	mov    %eax,0x805000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  800a65:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a6a:	b8 05 00 00 00       	mov    $0x5,%eax
+  800a6f:	e8 43 ff ff ff       	call   8009b7 <fsipc>
+  800a74:	85 c0                	test   %eax,%eax
+  800a76:	78 2c                	js     800aa4 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800a78:	83 ec 08             	sub    $0x8,%esp
+  800a7b:	68 00 50 80 00       	push   $0x805000
+  800a80:	53                   	push   %ebx
+  800a81:	e8 47 11 00 00       	call   801bcd <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  800a86:	a1 80 50 80 00       	mov    0x805080,%eax
+  800a8b:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800a91:	a1 84 50 80 00       	mov    0x805084,%eax
+  800a96:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  800a9c:	83 c4 10             	add    $0x10,%esp
+  800a9f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800aa4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800aa7:	c9                   	leave
+  800aa8:	c3                   	ret
+
+00800aa9 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  800aa9:	55                   	push   %ebp
+  800aaa:	89 e5                	mov    %esp,%ebp
+  800aac:	83 ec 0c             	sub    $0xc,%esp
+  800aaf:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800ab2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ab5:	8b 52 0c             	mov    0xc(%edx),%edx
+  800ab8:	89 15 00 50 80 00    	mov    %edx,0x805000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  800abe:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  800ac3:	39 d0                	cmp    %edx,%eax
+  800ac5:	0f 47 c2             	cmova  %edx,%eax
+  800ac8:	a3 04 50 80 00       	mov    %eax,0x805004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  800acd:	50                   	push   %eax
+  800ace:	ff 75 0c             	push   0xc(%ebp)
+  800ad1:	68 08 50 80 00       	push   $0x805008
+  800ad6:	e8 78 12 00 00       	call   801d53 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  800adb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ae0:	b8 04 00 00 00       	mov    $0x4,%eax
+  800ae5:	e8 cd fe ff ff       	call   8009b7 <fsipc>
+}
+  800aea:	c9                   	leave
+  800aeb:	c3                   	ret
+
+00800aec <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  800aec:	55                   	push   %ebp
+  800aed:	89 e5                	mov    %esp,%ebp
+  800aef:	56                   	push   %esi
+  800af0:	53                   	push   %ebx
+  800af1:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800af4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800af7:	8b 40 0c             	mov    0xc(%eax),%eax
+  800afa:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.read.req_n = n;
+  800aff:	89 35 04 50 80 00    	mov    %esi,0x805004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  800b05:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b0a:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b0f:	e8 a3 fe ff ff       	call   8009b7 <fsipc>
+  800b14:	89 c3                	mov    %eax,%ebx
+  800b16:	85 c0                	test   %eax,%eax
+  800b18:	78 1f                	js     800b39 <devfile_read+0x4d>
+  assert(r <= n);
+  800b1a:	39 c6                	cmp    %eax,%esi
+  800b1c:	72 24                	jb     800b42 <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  800b1e:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800b23:	7f 33                	jg     800b58 <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  800b25:	83 ec 04             	sub    $0x4,%esp
+  800b28:	50                   	push   %eax
+  800b29:	68 00 50 80 00       	push   $0x805000
+  800b2e:	ff 75 0c             	push   0xc(%ebp)
+  800b31:	e8 1d 12 00 00       	call   801d53 <memmove>
+  return r;
+  800b36:	83 c4 10             	add    $0x10,%esp
+}
+  800b39:	89 d8                	mov    %ebx,%eax
+  800b3b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b3e:	5b                   	pop    %ebx
+  800b3f:	5e                   	pop    %esi
+  800b40:	5d                   	pop    %ebp
+  800b41:	c3                   	ret
+  assert(r <= n);
+  800b42:	68 a8 25 80 00       	push   $0x8025a8
+  800b47:	68 af 25 80 00       	push   $0x8025af
+  800b4c:	6a 78                	push   $0x78
+  800b4e:	68 c4 25 80 00       	push   $0x8025c4
+  800b53:	e8 e1 09 00 00       	call   801539 <_panic>
+  assert(r <= PGSIZE);
+  800b58:	68 cf 25 80 00       	push   $0x8025cf
+  800b5d:	68 af 25 80 00       	push   $0x8025af
+  800b62:	6a 79                	push   $0x79
+  800b64:	68 c4 25 80 00       	push   $0x8025c4
+  800b69:	e8 cb 09 00 00       	call   801539 <_panic>
+
+00800b6e <open>:
+open(const char *path, int mode) {
+  800b6e:	55                   	push   %ebp
+  800b6f:	89 e5                	mov    %esp,%ebp
+  800b71:	56                   	push   %esi
+  800b72:	53                   	push   %ebx
+  800b73:	83 ec 1c             	sub    $0x1c,%esp
+  800b76:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  800b79:	56                   	push   %esi
+  800b7a:	e8 13 10 00 00       	call   801b92 <strlen>
+  800b7f:	83 c4 10             	add    $0x10,%esp
+  800b82:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800b87:	7f 6c                	jg     800bf5 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  800b89:	83 ec 0c             	sub    $0xc,%esp
+  800b8c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b8f:	50                   	push   %eax
+  800b90:	e8 ba f8 ff ff       	call   80044f <fd_alloc>
+  800b95:	89 c3                	mov    %eax,%ebx
+  800b97:	83 c4 10             	add    $0x10,%esp
+  800b9a:	85 c0                	test   %eax,%eax
+  800b9c:	78 3c                	js     800bda <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  800b9e:	83 ec 08             	sub    $0x8,%esp
+  800ba1:	56                   	push   %esi
+  800ba2:	68 00 50 80 00       	push   $0x805000
+  800ba7:	e8 21 10 00 00       	call   801bcd <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  800bac:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800baf:	a3 00 54 80 00       	mov    %eax,0x805400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  800bb4:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  800bb7:	b8 01 00 00 00       	mov    $0x1,%eax
+  800bbc:	e8 f6 fd ff ff       	call   8009b7 <fsipc>
+  800bc1:	89 c3                	mov    %eax,%ebx
+  800bc3:	83 c4 10             	add    $0x10,%esp
+  800bc6:	85 c0                	test   %eax,%eax
+  800bc8:	78 19                	js     800be3 <open+0x75>
+  return fd2num(fd);
+  800bca:	83 ec 0c             	sub    $0xc,%esp
+  800bcd:	ff 75 f4             	push   -0xc(%ebp)
+  800bd0:	e8 53 f8 ff ff       	call   800428 <fd2num>
+  800bd5:	89 c3                	mov    %eax,%ebx
+  800bd7:	83 c4 10             	add    $0x10,%esp
+}
+  800bda:	89 d8                	mov    %ebx,%eax
+  800bdc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800bdf:	5b                   	pop    %ebx
+  800be0:	5e                   	pop    %esi
+  800be1:	5d                   	pop    %ebp
+  800be2:	c3                   	ret
+    fd_close(fd, 0);
+  800be3:	83 ec 08             	sub    $0x8,%esp
+  800be6:	6a 00                	push   $0x0
+  800be8:	ff 75 f4             	push   -0xc(%ebp)
+  800beb:	e8 58 f9 ff ff       	call   800548 <fd_close>
+    return r;
+  800bf0:	83 c4 10             	add    $0x10,%esp
+  800bf3:	eb e5                	jmp    800bda <open+0x6c>
+    return -E_BAD_PATH;
+  800bf5:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  800bfa:	eb de                	jmp    800bda <open+0x6c>
+
+00800bfc <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  800bfc:	55                   	push   %ebp
+  800bfd:	89 e5                	mov    %esp,%ebp
+  800bff:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  800c02:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c07:	b8 08 00 00 00       	mov    $0x8,%eax
+  800c0c:	e8 a6 fd ff ff       	call   8009b7 <fsipc>
+}
+  800c11:	c9                   	leave
+  800c12:	c3                   	ret
+
+00800c13 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  800c13:	55                   	push   %ebp
+  800c14:	89 e5                	mov    %esp,%ebp
+  800c16:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  800c19:	68 db 25 80 00       	push   $0x8025db
+  800c1e:	ff 75 0c             	push   0xc(%ebp)
+  800c21:	e8 a7 0f 00 00       	call   801bcd <strcpy>
+	return 0;
+}
+  800c26:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c2b:	c9                   	leave
+  800c2c:	c3                   	ret
+
+00800c2d <devsock_close>:
+{
+  800c2d:	55                   	push   %ebp
+  800c2e:	89 e5                	mov    %esp,%ebp
+  800c30:	53                   	push   %ebx
+  800c31:	83 ec 10             	sub    $0x10,%esp
+  800c34:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  800c37:	53                   	push   %ebx
+  800c38:	e8 c7 13 00 00       	call   802004 <pageref>
+  800c3d:	89 c2                	mov    %eax,%edx
+  800c3f:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  800c42:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  800c47:	83 fa 01             	cmp    $0x1,%edx
+  800c4a:	74 05                	je     800c51 <devsock_close+0x24>
+}
+  800c4c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c4f:	c9                   	leave
+  800c50:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  800c51:	83 ec 0c             	sub    $0xc,%esp
+  800c54:	ff 73 0c             	push   0xc(%ebx)
+  800c57:	e8 b7 02 00 00       	call   800f13 <nsipc_close>
+  800c5c:	83 c4 10             	add    $0x10,%esp
+  800c5f:	eb eb                	jmp    800c4c <devsock_close+0x1f>
+
+00800c61 <devsock_write>:
+{
+  800c61:	55                   	push   %ebp
+  800c62:	89 e5                	mov    %esp,%ebp
+  800c64:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  800c67:	6a 00                	push   $0x0
+  800c69:	ff 75 10             	push   0x10(%ebp)
+  800c6c:	ff 75 0c             	push   0xc(%ebp)
+  800c6f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c72:	ff 70 0c             	push   0xc(%eax)
+  800c75:	e8 79 03 00 00       	call   800ff3 <nsipc_send>
+}
+  800c7a:	c9                   	leave
+  800c7b:	c3                   	ret
+
+00800c7c <devsock_read>:
+{
+  800c7c:	55                   	push   %ebp
+  800c7d:	89 e5                	mov    %esp,%ebp
+  800c7f:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  800c82:	6a 00                	push   $0x0
+  800c84:	ff 75 10             	push   0x10(%ebp)
+  800c87:	ff 75 0c             	push   0xc(%ebp)
+  800c8a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c8d:	ff 70 0c             	push   0xc(%eax)
+  800c90:	e8 ef 02 00 00       	call   800f84 <nsipc_recv>
+}
+  800c95:	c9                   	leave
+  800c96:	c3                   	ret
+
+00800c97 <fd2sockid>:
+{
+  800c97:	55                   	push   %ebp
+  800c98:	89 e5                	mov    %esp,%ebp
+  800c9a:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  800c9d:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  800ca0:	52                   	push   %edx
+  800ca1:	50                   	push   %eax
+  800ca2:	e8 fe f7 ff ff       	call   8004a5 <fd_lookup>
+  800ca7:	83 c4 10             	add    $0x10,%esp
+  800caa:	85 c0                	test   %eax,%eax
+  800cac:	78 10                	js     800cbe <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  800cae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800cb1:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  800cb7:	39 08                	cmp    %ecx,(%eax)
+  800cb9:	75 05                	jne    800cc0 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  800cbb:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  800cbe:	c9                   	leave
+  800cbf:	c3                   	ret
+		return -E_NOT_SUPP;
+  800cc0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800cc5:	eb f7                	jmp    800cbe <fd2sockid+0x27>
+
+00800cc7 <alloc_sockfd>:
+{
+  800cc7:	55                   	push   %ebp
+  800cc8:	89 e5                	mov    %esp,%ebp
+  800cca:	56                   	push   %esi
+  800ccb:	53                   	push   %ebx
+  800ccc:	83 ec 1c             	sub    $0x1c,%esp
+  800ccf:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  800cd1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800cd4:	50                   	push   %eax
+  800cd5:	e8 75 f7 ff ff       	call   80044f <fd_alloc>
+  800cda:	89 c3                	mov    %eax,%ebx
+  800cdc:	83 c4 10             	add    $0x10,%esp
+  800cdf:	85 c0                	test   %eax,%eax
+  800ce1:	78 43                	js     800d26 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  800ce3:	83 ec 04             	sub    $0x4,%esp
+  800ce6:	68 07 04 00 00       	push   $0x407
+  800ceb:	ff 75 f4             	push   -0xc(%ebp)
+  800cee:	6a 00                	push   $0x0
+  800cf0:	e8 60 f4 ff ff       	call   800155 <sys_page_alloc>
+  800cf5:	89 c3                	mov    %eax,%ebx
+  800cf7:	83 c4 10             	add    $0x10,%esp
+  800cfa:	85 c0                	test   %eax,%eax
+  800cfc:	78 28                	js     800d26 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  800cfe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800d01:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  800d07:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  800d09:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800d0c:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  800d13:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  800d16:	83 ec 0c             	sub    $0xc,%esp
+  800d19:	50                   	push   %eax
+  800d1a:	e8 09 f7 ff ff       	call   800428 <fd2num>
+  800d1f:	89 c3                	mov    %eax,%ebx
+  800d21:	83 c4 10             	add    $0x10,%esp
+  800d24:	eb 0c                	jmp    800d32 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  800d26:	83 ec 0c             	sub    $0xc,%esp
+  800d29:	56                   	push   %esi
+  800d2a:	e8 e4 01 00 00       	call   800f13 <nsipc_close>
+		return r;
+  800d2f:	83 c4 10             	add    $0x10,%esp
+}
+  800d32:	89 d8                	mov    %ebx,%eax
+  800d34:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d37:	5b                   	pop    %ebx
+  800d38:	5e                   	pop    %esi
+  800d39:	5d                   	pop    %ebp
+  800d3a:	c3                   	ret
+
+00800d3b <accept>:
+{
+  800d3b:	55                   	push   %ebp
+  800d3c:	89 e5                	mov    %esp,%ebp
+  800d3e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800d41:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d44:	e8 4e ff ff ff       	call   800c97 <fd2sockid>
+  800d49:	85 c0                	test   %eax,%eax
+  800d4b:	78 1b                	js     800d68 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  800d4d:	83 ec 04             	sub    $0x4,%esp
+  800d50:	ff 75 10             	push   0x10(%ebp)
+  800d53:	ff 75 0c             	push   0xc(%ebp)
+  800d56:	50                   	push   %eax
+  800d57:	e8 0e 01 00 00       	call   800e6a <nsipc_accept>
+  800d5c:	83 c4 10             	add    $0x10,%esp
+  800d5f:	85 c0                	test   %eax,%eax
+  800d61:	78 05                	js     800d68 <accept+0x2d>
+	return alloc_sockfd(r);
+  800d63:	e8 5f ff ff ff       	call   800cc7 <alloc_sockfd>
+}
+  800d68:	c9                   	leave
+  800d69:	c3                   	ret
+
+00800d6a <bind>:
+{
+  800d6a:	55                   	push   %ebp
+  800d6b:	89 e5                	mov    %esp,%ebp
+  800d6d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800d70:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d73:	e8 1f ff ff ff       	call   800c97 <fd2sockid>
+  800d78:	85 c0                	test   %eax,%eax
+  800d7a:	78 12                	js     800d8e <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  800d7c:	83 ec 04             	sub    $0x4,%esp
+  800d7f:	ff 75 10             	push   0x10(%ebp)
+  800d82:	ff 75 0c             	push   0xc(%ebp)
+  800d85:	50                   	push   %eax
+  800d86:	e8 31 01 00 00       	call   800ebc <nsipc_bind>
+  800d8b:	83 c4 10             	add    $0x10,%esp
+}
+  800d8e:	c9                   	leave
+  800d8f:	c3                   	ret
+
+00800d90 <shutdown>:
+{
+  800d90:	55                   	push   %ebp
+  800d91:	89 e5                	mov    %esp,%ebp
+  800d93:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800d96:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d99:	e8 f9 fe ff ff       	call   800c97 <fd2sockid>
+  800d9e:	85 c0                	test   %eax,%eax
+  800da0:	78 0f                	js     800db1 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  800da2:	83 ec 08             	sub    $0x8,%esp
+  800da5:	ff 75 0c             	push   0xc(%ebp)
+  800da8:	50                   	push   %eax
+  800da9:	e8 43 01 00 00       	call   800ef1 <nsipc_shutdown>
+  800dae:	83 c4 10             	add    $0x10,%esp
+}
+  800db1:	c9                   	leave
+  800db2:	c3                   	ret
+
+00800db3 <connect>:
+{
+  800db3:	55                   	push   %ebp
+  800db4:	89 e5                	mov    %esp,%ebp
+  800db6:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800db9:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dbc:	e8 d6 fe ff ff       	call   800c97 <fd2sockid>
+  800dc1:	85 c0                	test   %eax,%eax
+  800dc3:	78 12                	js     800dd7 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  800dc5:	83 ec 04             	sub    $0x4,%esp
+  800dc8:	ff 75 10             	push   0x10(%ebp)
+  800dcb:	ff 75 0c             	push   0xc(%ebp)
+  800dce:	50                   	push   %eax
+  800dcf:	e8 59 01 00 00       	call   800f2d <nsipc_connect>
+  800dd4:	83 c4 10             	add    $0x10,%esp
+}
+  800dd7:	c9                   	leave
+  800dd8:	c3                   	ret
+
+00800dd9 <listen>:
+{
+  800dd9:	55                   	push   %ebp
+  800dda:	89 e5                	mov    %esp,%ebp
+  800ddc:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800ddf:	8b 45 08             	mov    0x8(%ebp),%eax
+  800de2:	e8 b0 fe ff ff       	call   800c97 <fd2sockid>
+  800de7:	85 c0                	test   %eax,%eax
+  800de9:	78 0f                	js     800dfa <listen+0x21>
+	return nsipc_listen(r, backlog);
+  800deb:	83 ec 08             	sub    $0x8,%esp
+  800dee:	ff 75 0c             	push   0xc(%ebp)
+  800df1:	50                   	push   %eax
+  800df2:	e8 6b 01 00 00       	call   800f62 <nsipc_listen>
+  800df7:	83 c4 10             	add    $0x10,%esp
+}
+  800dfa:	c9                   	leave
+  800dfb:	c3                   	ret
+
+00800dfc <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  800dfc:	55                   	push   %ebp
+  800dfd:	89 e5                	mov    %esp,%ebp
+  800dff:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  800e02:	ff 75 10             	push   0x10(%ebp)
+  800e05:	ff 75 0c             	push   0xc(%ebp)
+  800e08:	ff 75 08             	push   0x8(%ebp)
+  800e0b:	e8 41 02 00 00       	call   801051 <nsipc_socket>
+  800e10:	83 c4 10             	add    $0x10,%esp
+  800e13:	85 c0                	test   %eax,%eax
+  800e15:	78 05                	js     800e1c <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  800e17:	e8 ab fe ff ff       	call   800cc7 <alloc_sockfd>
+}
+  800e1c:	c9                   	leave
+  800e1d:	c3                   	ret
+
+00800e1e <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  800e1e:	55                   	push   %ebp
+  800e1f:	89 e5                	mov    %esp,%ebp
+  800e21:	53                   	push   %ebx
+  800e22:	83 ec 04             	sub    $0x4,%esp
+  800e25:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  800e27:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800e2e:	74 26                	je     800e56 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  800e30:	6a 07                	push   $0x7
+  800e32:	68 00 60 80 00       	push   $0x806000
+  800e37:	53                   	push   %ebx
+  800e38:	ff 35 04 40 80 00    	push   0x804004
+  800e3e:	e8 2e 11 00 00       	call   801f71 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  800e43:	83 c4 0c             	add    $0xc,%esp
+  800e46:	6a 00                	push   $0x0
+  800e48:	6a 00                	push   $0x0
+  800e4a:	6a 00                	push   $0x0
+  800e4c:	e8 ac 10 00 00       	call   801efd <ipc_recv>
+}
+  800e51:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e54:	c9                   	leave
+  800e55:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  800e56:	83 ec 0c             	sub    $0xc,%esp
+  800e59:	6a 02                	push   $0x2
+  800e5b:	e8 65 11 00 00       	call   801fc5 <ipc_find_env>
+  800e60:	a3 04 40 80 00       	mov    %eax,0x804004
+  800e65:	83 c4 10             	add    $0x10,%esp
+  800e68:	eb c6                	jmp    800e30 <nsipc+0x12>
+
+00800e6a <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  800e6a:	55                   	push   %ebp
+  800e6b:	89 e5                	mov    %esp,%ebp
+  800e6d:	56                   	push   %esi
+  800e6e:	53                   	push   %ebx
+  800e6f:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  800e72:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e75:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  800e7a:	8b 06                	mov    (%esi),%eax
+  800e7c:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  800e81:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e86:	e8 93 ff ff ff       	call   800e1e <nsipc>
+  800e8b:	89 c3                	mov    %eax,%ebx
+  800e8d:	85 c0                	test   %eax,%eax
+  800e8f:	79 09                	jns    800e9a <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  800e91:	89 d8                	mov    %ebx,%eax
+  800e93:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e96:	5b                   	pop    %ebx
+  800e97:	5e                   	pop    %esi
+  800e98:	5d                   	pop    %ebp
+  800e99:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  800e9a:	83 ec 04             	sub    $0x4,%esp
+  800e9d:	ff 35 10 60 80 00    	push   0x806010
+  800ea3:	68 00 60 80 00       	push   $0x806000
+  800ea8:	ff 75 0c             	push   0xc(%ebp)
+  800eab:	e8 a3 0e 00 00       	call   801d53 <memmove>
+		*addrlen = ret->ret_addrlen;
+  800eb0:	a1 10 60 80 00       	mov    0x806010,%eax
+  800eb5:	89 06                	mov    %eax,(%esi)
+  800eb7:	83 c4 10             	add    $0x10,%esp
+	return r;
+  800eba:	eb d5                	jmp    800e91 <nsipc_accept+0x27>
+
+00800ebc <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  800ebc:	55                   	push   %ebp
+  800ebd:	89 e5                	mov    %esp,%ebp
+  800ebf:	53                   	push   %ebx
+  800ec0:	83 ec 08             	sub    $0x8,%esp
+  800ec3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  800ec6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ec9:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  800ece:	53                   	push   %ebx
+  800ecf:	ff 75 0c             	push   0xc(%ebp)
+  800ed2:	68 04 60 80 00       	push   $0x806004
+  800ed7:	e8 77 0e 00 00       	call   801d53 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  800edc:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  800ee2:	b8 02 00 00 00       	mov    $0x2,%eax
+  800ee7:	e8 32 ff ff ff       	call   800e1e <nsipc>
+}
+  800eec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800eef:	c9                   	leave
+  800ef0:	c3                   	ret
+
+00800ef1 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  800ef1:	55                   	push   %ebp
+  800ef2:	89 e5                	mov    %esp,%ebp
+  800ef4:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  800ef7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800efa:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  800eff:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f02:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  800f07:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f0c:	e8 0d ff ff ff       	call   800e1e <nsipc>
+}
+  800f11:	c9                   	leave
+  800f12:	c3                   	ret
+
+00800f13 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  800f13:	55                   	push   %ebp
+  800f14:	89 e5                	mov    %esp,%ebp
+  800f16:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  800f19:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f1c:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  800f21:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f26:	e8 f3 fe ff ff       	call   800e1e <nsipc>
+}
+  800f2b:	c9                   	leave
+  800f2c:	c3                   	ret
+
+00800f2d <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  800f2d:	55                   	push   %ebp
+  800f2e:	89 e5                	mov    %esp,%ebp
+  800f30:	53                   	push   %ebx
+  800f31:	83 ec 08             	sub    $0x8,%esp
+  800f34:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  800f37:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f3a:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  800f3f:	53                   	push   %ebx
+  800f40:	ff 75 0c             	push   0xc(%ebp)
+  800f43:	68 04 60 80 00       	push   $0x806004
+  800f48:	e8 06 0e 00 00       	call   801d53 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  800f4d:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  800f53:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f58:	e8 c1 fe ff ff       	call   800e1e <nsipc>
+}
+  800f5d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f60:	c9                   	leave
+  800f61:	c3                   	ret
+
+00800f62 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  800f62:	55                   	push   %ebp
+  800f63:	89 e5                	mov    %esp,%ebp
+  800f65:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  800f68:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f6b:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  800f70:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f73:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  800f78:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f7d:	e8 9c fe ff ff       	call   800e1e <nsipc>
+}
+  800f82:	c9                   	leave
+  800f83:	c3                   	ret
+
+00800f84 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  800f84:	55                   	push   %ebp
+  800f85:	89 e5                	mov    %esp,%ebp
+  800f87:	56                   	push   %esi
+  800f88:	53                   	push   %ebx
+  800f89:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  800f8c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f8f:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  800f94:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  800f9a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f9d:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  800fa2:	b8 07 00 00 00       	mov    $0x7,%eax
+  800fa7:	e8 72 fe ff ff       	call   800e1e <nsipc>
+  800fac:	89 c3                	mov    %eax,%ebx
+  800fae:	85 c0                	test   %eax,%eax
+  800fb0:	78 22                	js     800fd4 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  800fb2:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  800fb7:	39 c6                	cmp    %eax,%esi
+  800fb9:	0f 4e c6             	cmovle %esi,%eax
+  800fbc:	39 c3                	cmp    %eax,%ebx
+  800fbe:	7f 1d                	jg     800fdd <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  800fc0:	83 ec 04             	sub    $0x4,%esp
+  800fc3:	53                   	push   %ebx
+  800fc4:	68 00 60 80 00       	push   $0x806000
+  800fc9:	ff 75 0c             	push   0xc(%ebp)
+  800fcc:	e8 82 0d 00 00       	call   801d53 <memmove>
+  800fd1:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  800fd4:	89 d8                	mov    %ebx,%eax
+  800fd6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fd9:	5b                   	pop    %ebx
+  800fda:	5e                   	pop    %esi
+  800fdb:	5d                   	pop    %ebp
+  800fdc:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  800fdd:	68 e7 25 80 00       	push   $0x8025e7
+  800fe2:	68 af 25 80 00       	push   $0x8025af
+  800fe7:	6a 62                	push   $0x62
+  800fe9:	68 fc 25 80 00       	push   $0x8025fc
+  800fee:	e8 46 05 00 00       	call   801539 <_panic>
+
+00800ff3 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  800ff3:	55                   	push   %ebp
+  800ff4:	89 e5                	mov    %esp,%ebp
+  800ff6:	53                   	push   %ebx
+  800ff7:	83 ec 04             	sub    $0x4,%esp
+  800ffa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  800ffd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801000:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  801005:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80100b:	7f 2e                	jg     80103b <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  80100d:	83 ec 04             	sub    $0x4,%esp
+  801010:	53                   	push   %ebx
+  801011:	ff 75 0c             	push   0xc(%ebp)
+  801014:	68 0c 60 80 00       	push   $0x80600c
+  801019:	e8 35 0d 00 00       	call   801d53 <memmove>
+	nsipcbuf.send.req_size = size;
+  80101e:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  801024:	8b 45 14             	mov    0x14(%ebp),%eax
+  801027:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  80102c:	b8 08 00 00 00       	mov    $0x8,%eax
+  801031:	e8 e8 fd ff ff       	call   800e1e <nsipc>
+}
+  801036:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801039:	c9                   	leave
+  80103a:	c3                   	ret
+	assert(size < 1600);
+  80103b:	68 08 26 80 00       	push   $0x802608
+  801040:	68 af 25 80 00       	push   $0x8025af
+  801045:	6a 6d                	push   $0x6d
+  801047:	68 fc 25 80 00       	push   $0x8025fc
+  80104c:	e8 e8 04 00 00       	call   801539 <_panic>
+
+00801051 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801051:	55                   	push   %ebp
+  801052:	89 e5                	mov    %esp,%ebp
+  801054:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801057:	8b 45 08             	mov    0x8(%ebp),%eax
+  80105a:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  80105f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801062:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  801067:	8b 45 10             	mov    0x10(%ebp),%eax
+  80106a:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  80106f:	b8 09 00 00 00       	mov    $0x9,%eax
+  801074:	e8 a5 fd ff ff       	call   800e1e <nsipc>
+}
+  801079:	c9                   	leave
+  80107a:	c3                   	ret
+
+0080107b <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80107b:	55                   	push   %ebp
+  80107c:	89 e5                	mov    %esp,%ebp
+  80107e:	56                   	push   %esi
+  80107f:	53                   	push   %ebx
+  801080:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801083:	83 ec 0c             	sub    $0xc,%esp
+  801086:	ff 75 08             	push   0x8(%ebp)
+  801089:	e8 aa f3 ff ff       	call   800438 <fd2data>
+  80108e:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801090:	83 c4 08             	add    $0x8,%esp
+  801093:	68 14 26 80 00       	push   $0x802614
+  801098:	53                   	push   %ebx
+  801099:	e8 2f 0b 00 00       	call   801bcd <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  80109e:	8b 46 04             	mov    0x4(%esi),%eax
+  8010a1:	2b 06                	sub    (%esi),%eax
+  8010a3:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8010a9:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8010b0:	00 00 00 
+	stat->st_dev = &devpipe;
+  8010b3:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  8010ba:	30 80 00 
+	return 0;
+}
+  8010bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010c2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8010c5:	5b                   	pop    %ebx
+  8010c6:	5e                   	pop    %esi
+  8010c7:	5d                   	pop    %ebp
+  8010c8:	c3                   	ret
+
+008010c9 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8010c9:	55                   	push   %ebp
+  8010ca:	89 e5                	mov    %esp,%ebp
+  8010cc:	53                   	push   %ebx
+  8010cd:	83 ec 0c             	sub    $0xc,%esp
+  8010d0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8010d3:	53                   	push   %ebx
+  8010d4:	6a 00                	push   $0x0
+  8010d6:	e8 ff f0 ff ff       	call   8001da <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8010db:	89 1c 24             	mov    %ebx,(%esp)
+  8010de:	e8 55 f3 ff ff       	call   800438 <fd2data>
+  8010e3:	83 c4 08             	add    $0x8,%esp
+  8010e6:	50                   	push   %eax
+  8010e7:	6a 00                	push   $0x0
+  8010e9:	e8 ec f0 ff ff       	call   8001da <sys_page_unmap>
+}
+  8010ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010f1:	c9                   	leave
+  8010f2:	c3                   	ret
+
+008010f3 <_pipeisclosed>:
+{
+  8010f3:	55                   	push   %ebp
+  8010f4:	89 e5                	mov    %esp,%ebp
+  8010f6:	57                   	push   %edi
+  8010f7:	56                   	push   %esi
+  8010f8:	53                   	push   %ebx
+  8010f9:	83 ec 1c             	sub    $0x1c,%esp
+  8010fc:	89 c7                	mov    %eax,%edi
+  8010fe:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801100:	a1 08 40 80 00       	mov    0x804008,%eax
+  801105:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801108:	83 ec 0c             	sub    $0xc,%esp
+  80110b:	57                   	push   %edi
+  80110c:	e8 f3 0e 00 00       	call   802004 <pageref>
+  801111:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801114:	89 34 24             	mov    %esi,(%esp)
+  801117:	e8 e8 0e 00 00       	call   802004 <pageref>
+		nn = thisenv->env_runs;
+  80111c:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801122:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801125:	83 c4 10             	add    $0x10,%esp
+  801128:	39 cb                	cmp    %ecx,%ebx
+  80112a:	74 1b                	je     801147 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  80112c:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80112f:	75 cf                	jne    801100 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801131:	8b 42 58             	mov    0x58(%edx),%eax
+  801134:	6a 01                	push   $0x1
+  801136:	50                   	push   %eax
+  801137:	53                   	push   %ebx
+  801138:	68 1b 26 80 00       	push   $0x80261b
+  80113d:	e8 d2 04 00 00       	call   801614 <cprintf>
+  801142:	83 c4 10             	add    $0x10,%esp
+  801145:	eb b9                	jmp    801100 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801147:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80114a:	0f 94 c0             	sete   %al
+  80114d:	0f b6 c0             	movzbl %al,%eax
+}
+  801150:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801153:	5b                   	pop    %ebx
+  801154:	5e                   	pop    %esi
+  801155:	5f                   	pop    %edi
+  801156:	5d                   	pop    %ebp
+  801157:	c3                   	ret
+
+00801158 <devpipe_write>:
+{
+  801158:	55                   	push   %ebp
+  801159:	89 e5                	mov    %esp,%ebp
+  80115b:	57                   	push   %edi
+  80115c:	56                   	push   %esi
+  80115d:	53                   	push   %ebx
+  80115e:	83 ec 28             	sub    $0x28,%esp
+  801161:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801164:	56                   	push   %esi
+  801165:	e8 ce f2 ff ff       	call   800438 <fd2data>
+  80116a:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80116c:	83 c4 10             	add    $0x10,%esp
+  80116f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801174:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801177:	75 09                	jne    801182 <devpipe_write+0x2a>
+	return i;
+  801179:	89 f8                	mov    %edi,%eax
+  80117b:	eb 23                	jmp    8011a0 <devpipe_write+0x48>
+			sys_yield();
+  80117d:	e8 b4 ef ff ff       	call   800136 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801182:	8b 43 04             	mov    0x4(%ebx),%eax
+  801185:	8b 0b                	mov    (%ebx),%ecx
+  801187:	8d 51 20             	lea    0x20(%ecx),%edx
+  80118a:	39 d0                	cmp    %edx,%eax
+  80118c:	72 1a                	jb     8011a8 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  80118e:	89 da                	mov    %ebx,%edx
+  801190:	89 f0                	mov    %esi,%eax
+  801192:	e8 5c ff ff ff       	call   8010f3 <_pipeisclosed>
+  801197:	85 c0                	test   %eax,%eax
+  801199:	74 e2                	je     80117d <devpipe_write+0x25>
+				return 0;
+  80119b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011a3:	5b                   	pop    %ebx
+  8011a4:	5e                   	pop    %esi
+  8011a5:	5f                   	pop    %edi
+  8011a6:	5d                   	pop    %ebp
+  8011a7:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8011a8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ab:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8011af:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8011b2:	89 c2                	mov    %eax,%edx
+  8011b4:	c1 fa 1f             	sar    $0x1f,%edx
+  8011b7:	89 d1                	mov    %edx,%ecx
+  8011b9:	c1 e9 1b             	shr    $0x1b,%ecx
+  8011bc:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8011bf:	83 e2 1f             	and    $0x1f,%edx
+  8011c2:	29 ca                	sub    %ecx,%edx
+  8011c4:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8011c8:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8011cc:	83 c0 01             	add    $0x1,%eax
+  8011cf:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8011d2:	83 c7 01             	add    $0x1,%edi
+  8011d5:	eb 9d                	jmp    801174 <devpipe_write+0x1c>
+
+008011d7 <devpipe_read>:
+{
+  8011d7:	55                   	push   %ebp
+  8011d8:	89 e5                	mov    %esp,%ebp
+  8011da:	57                   	push   %edi
+  8011db:	56                   	push   %esi
+  8011dc:	53                   	push   %ebx
+  8011dd:	83 ec 18             	sub    $0x18,%esp
+  8011e0:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8011e3:	57                   	push   %edi
+  8011e4:	e8 4f f2 ff ff       	call   800438 <fd2data>
+  8011e9:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8011eb:	83 c4 10             	add    $0x10,%esp
+  8011ee:	be 00 00 00 00       	mov    $0x0,%esi
+  8011f3:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8011f6:	75 13                	jne    80120b <devpipe_read+0x34>
+	return i;
+  8011f8:	89 f0                	mov    %esi,%eax
+  8011fa:	eb 02                	jmp    8011fe <devpipe_read+0x27>
+				return i;
+  8011fc:	89 f0                	mov    %esi,%eax
+}
+  8011fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801201:	5b                   	pop    %ebx
+  801202:	5e                   	pop    %esi
+  801203:	5f                   	pop    %edi
+  801204:	5d                   	pop    %ebp
+  801205:	c3                   	ret
+			sys_yield();
+  801206:	e8 2b ef ff ff       	call   800136 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  80120b:	8b 03                	mov    (%ebx),%eax
+  80120d:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801210:	75 18                	jne    80122a <devpipe_read+0x53>
+			if (i > 0)
+  801212:	85 f6                	test   %esi,%esi
+  801214:	75 e6                	jne    8011fc <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  801216:	89 da                	mov    %ebx,%edx
+  801218:	89 f8                	mov    %edi,%eax
+  80121a:	e8 d4 fe ff ff       	call   8010f3 <_pipeisclosed>
+  80121f:	85 c0                	test   %eax,%eax
+  801221:	74 e3                	je     801206 <devpipe_read+0x2f>
+				return 0;
+  801223:	b8 00 00 00 00       	mov    $0x0,%eax
+  801228:	eb d4                	jmp    8011fe <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80122a:	99                   	cltd
+  80122b:	c1 ea 1b             	shr    $0x1b,%edx
+  80122e:	01 d0                	add    %edx,%eax
+  801230:	83 e0 1f             	and    $0x1f,%eax
+  801233:	29 d0                	sub    %edx,%eax
+  801235:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  80123a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80123d:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  801240:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  801243:	83 c6 01             	add    $0x1,%esi
+  801246:	eb ab                	jmp    8011f3 <devpipe_read+0x1c>
+
+00801248 <pipe>:
+{
+  801248:	55                   	push   %ebp
+  801249:	89 e5                	mov    %esp,%ebp
+  80124b:	56                   	push   %esi
+  80124c:	53                   	push   %ebx
+  80124d:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801250:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801253:	50                   	push   %eax
+  801254:	e8 f6 f1 ff ff       	call   80044f <fd_alloc>
+  801259:	89 c3                	mov    %eax,%ebx
+  80125b:	83 c4 10             	add    $0x10,%esp
+  80125e:	85 c0                	test   %eax,%eax
+  801260:	0f 88 23 01 00 00    	js     801389 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801266:	83 ec 04             	sub    $0x4,%esp
+  801269:	68 07 04 00 00       	push   $0x407
+  80126e:	ff 75 f4             	push   -0xc(%ebp)
+  801271:	6a 00                	push   $0x0
+  801273:	e8 dd ee ff ff       	call   800155 <sys_page_alloc>
+  801278:	89 c3                	mov    %eax,%ebx
+  80127a:	83 c4 10             	add    $0x10,%esp
+  80127d:	85 c0                	test   %eax,%eax
+  80127f:	0f 88 04 01 00 00    	js     801389 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801285:	83 ec 0c             	sub    $0xc,%esp
+  801288:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80128b:	50                   	push   %eax
+  80128c:	e8 be f1 ff ff       	call   80044f <fd_alloc>
+  801291:	89 c3                	mov    %eax,%ebx
+  801293:	83 c4 10             	add    $0x10,%esp
+  801296:	85 c0                	test   %eax,%eax
+  801298:	0f 88 db 00 00 00    	js     801379 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80129e:	83 ec 04             	sub    $0x4,%esp
+  8012a1:	68 07 04 00 00       	push   $0x407
+  8012a6:	ff 75 f0             	push   -0x10(%ebp)
+  8012a9:	6a 00                	push   $0x0
+  8012ab:	e8 a5 ee ff ff       	call   800155 <sys_page_alloc>
+  8012b0:	89 c3                	mov    %eax,%ebx
+  8012b2:	83 c4 10             	add    $0x10,%esp
+  8012b5:	85 c0                	test   %eax,%eax
+  8012b7:	0f 88 bc 00 00 00    	js     801379 <pipe+0x131>
+	va = fd2data(fd0);
+  8012bd:	83 ec 0c             	sub    $0xc,%esp
+  8012c0:	ff 75 f4             	push   -0xc(%ebp)
+  8012c3:	e8 70 f1 ff ff       	call   800438 <fd2data>
+  8012c8:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8012ca:	83 c4 0c             	add    $0xc,%esp
+  8012cd:	68 07 04 00 00       	push   $0x407
+  8012d2:	50                   	push   %eax
+  8012d3:	6a 00                	push   $0x0
+  8012d5:	e8 7b ee ff ff       	call   800155 <sys_page_alloc>
+  8012da:	89 c3                	mov    %eax,%ebx
+  8012dc:	83 c4 10             	add    $0x10,%esp
+  8012df:	85 c0                	test   %eax,%eax
+  8012e1:	0f 88 82 00 00 00    	js     801369 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8012e7:	83 ec 0c             	sub    $0xc,%esp
+  8012ea:	ff 75 f0             	push   -0x10(%ebp)
+  8012ed:	e8 46 f1 ff ff       	call   800438 <fd2data>
+  8012f2:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8012f9:	50                   	push   %eax
+  8012fa:	6a 00                	push   $0x0
+  8012fc:	56                   	push   %esi
+  8012fd:	6a 00                	push   $0x0
+  8012ff:	e8 94 ee ff ff       	call   800198 <sys_page_map>
+  801304:	89 c3                	mov    %eax,%ebx
+  801306:	83 c4 20             	add    $0x20,%esp
+  801309:	85 c0                	test   %eax,%eax
+  80130b:	78 4e                	js     80135b <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80130d:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  801312:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801315:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  801317:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80131a:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  801321:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801324:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  801326:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801329:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  801330:	83 ec 0c             	sub    $0xc,%esp
+  801333:	ff 75 f4             	push   -0xc(%ebp)
+  801336:	e8 ed f0 ff ff       	call   800428 <fd2num>
+  80133b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80133e:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  801340:	83 c4 04             	add    $0x4,%esp
+  801343:	ff 75 f0             	push   -0x10(%ebp)
+  801346:	e8 dd f0 ff ff       	call   800428 <fd2num>
+  80134b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80134e:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  801351:	83 c4 10             	add    $0x10,%esp
+  801354:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801359:	eb 2e                	jmp    801389 <pipe+0x141>
+	sys_page_unmap(0, va);
+  80135b:	83 ec 08             	sub    $0x8,%esp
+  80135e:	56                   	push   %esi
+  80135f:	6a 00                	push   $0x0
+  801361:	e8 74 ee ff ff       	call   8001da <sys_page_unmap>
+  801366:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  801369:	83 ec 08             	sub    $0x8,%esp
+  80136c:	ff 75 f0             	push   -0x10(%ebp)
+  80136f:	6a 00                	push   $0x0
+  801371:	e8 64 ee ff ff       	call   8001da <sys_page_unmap>
+  801376:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  801379:	83 ec 08             	sub    $0x8,%esp
+  80137c:	ff 75 f4             	push   -0xc(%ebp)
+  80137f:	6a 00                	push   $0x0
+  801381:	e8 54 ee ff ff       	call   8001da <sys_page_unmap>
+  801386:	83 c4 10             	add    $0x10,%esp
+}
+  801389:	89 d8                	mov    %ebx,%eax
+  80138b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80138e:	5b                   	pop    %ebx
+  80138f:	5e                   	pop    %esi
+  801390:	5d                   	pop    %ebp
+  801391:	c3                   	ret
+
+00801392 <pipeisclosed>:
+{
+  801392:	55                   	push   %ebp
+  801393:	89 e5                	mov    %esp,%ebp
+  801395:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801398:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80139b:	50                   	push   %eax
+  80139c:	ff 75 08             	push   0x8(%ebp)
+  80139f:	e8 01 f1 ff ff       	call   8004a5 <fd_lookup>
+  8013a4:	83 c4 10             	add    $0x10,%esp
+  8013a7:	85 c0                	test   %eax,%eax
+  8013a9:	78 18                	js     8013c3 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8013ab:	83 ec 0c             	sub    $0xc,%esp
+  8013ae:	ff 75 f4             	push   -0xc(%ebp)
+  8013b1:	e8 82 f0 ff ff       	call   800438 <fd2data>
+  8013b6:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8013b8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013bb:	e8 33 fd ff ff       	call   8010f3 <_pipeisclosed>
+  8013c0:	83 c4 10             	add    $0x10,%esp
+}
+  8013c3:	c9                   	leave
+  8013c4:	c3                   	ret
+
+008013c5 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8013c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013ca:	c3                   	ret
+
+008013cb <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8013cb:	55                   	push   %ebp
+  8013cc:	89 e5                	mov    %esp,%ebp
+  8013ce:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8013d1:	68 33 26 80 00       	push   $0x802633
+  8013d6:	ff 75 0c             	push   0xc(%ebp)
+  8013d9:	e8 ef 07 00 00       	call   801bcd <strcpy>
+	return 0;
+}
+  8013de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013e3:	c9                   	leave
+  8013e4:	c3                   	ret
+
+008013e5 <devcons_write>:
+{
+  8013e5:	55                   	push   %ebp
+  8013e6:	89 e5                	mov    %esp,%ebp
+  8013e8:	57                   	push   %edi
+  8013e9:	56                   	push   %esi
+  8013ea:	53                   	push   %ebx
+  8013eb:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8013f1:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8013f6:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8013fc:	eb 2e                	jmp    80142c <devcons_write+0x47>
+		m = n - tot;
+  8013fe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801401:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  801403:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801408:	39 c3                	cmp    %eax,%ebx
+  80140a:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80140d:	83 ec 04             	sub    $0x4,%esp
+  801410:	53                   	push   %ebx
+  801411:	89 f0                	mov    %esi,%eax
+  801413:	03 45 0c             	add    0xc(%ebp),%eax
+  801416:	50                   	push   %eax
+  801417:	57                   	push   %edi
+  801418:	e8 36 09 00 00       	call   801d53 <memmove>
+		sys_cputs(buf, m);
+  80141d:	83 c4 08             	add    $0x8,%esp
+  801420:	53                   	push   %ebx
+  801421:	57                   	push   %edi
+  801422:	e8 72 ec ff ff       	call   800099 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  801427:	01 de                	add    %ebx,%esi
+  801429:	83 c4 10             	add    $0x10,%esp
+  80142c:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80142f:	72 cd                	jb     8013fe <devcons_write+0x19>
+}
+  801431:	89 f0                	mov    %esi,%eax
+  801433:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801436:	5b                   	pop    %ebx
+  801437:	5e                   	pop    %esi
+  801438:	5f                   	pop    %edi
+  801439:	5d                   	pop    %ebp
+  80143a:	c3                   	ret
+
+0080143b <devcons_read>:
+{
+  80143b:	55                   	push   %ebp
+  80143c:	89 e5                	mov    %esp,%ebp
+  80143e:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  801441:	b8 00 00 00 00       	mov    $0x0,%eax
+  801446:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80144a:	75 07                	jne    801453 <devcons_read+0x18>
+  80144c:	eb 1f                	jmp    80146d <devcons_read+0x32>
+		sys_yield();
+  80144e:	e8 e3 ec ff ff       	call   800136 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  801453:	e8 5f ec ff ff       	call   8000b7 <sys_cgetc>
+  801458:	85 c0                	test   %eax,%eax
+  80145a:	74 f2                	je     80144e <devcons_read+0x13>
+	if (c < 0)
+  80145c:	78 0f                	js     80146d <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80145e:	83 f8 04             	cmp    $0x4,%eax
+  801461:	74 0c                	je     80146f <devcons_read+0x34>
+	*(char*)vbuf = c;
+  801463:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801466:	88 02                	mov    %al,(%edx)
+	return 1;
+  801468:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80146d:	c9                   	leave
+  80146e:	c3                   	ret
+		return 0;
+  80146f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801474:	eb f7                	jmp    80146d <devcons_read+0x32>
+
+00801476 <cputchar>:
+{
+  801476:	55                   	push   %ebp
+  801477:	89 e5                	mov    %esp,%ebp
+  801479:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80147c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80147f:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  801482:	6a 01                	push   $0x1
+  801484:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801487:	50                   	push   %eax
+  801488:	e8 0c ec ff ff       	call   800099 <sys_cputs>
+}
+  80148d:	83 c4 10             	add    $0x10,%esp
+  801490:	c9                   	leave
+  801491:	c3                   	ret
+
+00801492 <getchar>:
+{
+  801492:	55                   	push   %ebp
+  801493:	89 e5                	mov    %esp,%ebp
+  801495:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  801498:	6a 01                	push   $0x1
+  80149a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80149d:	50                   	push   %eax
+  80149e:	6a 00                	push   $0x0
+  8014a0:	e8 66 f2 ff ff       	call   80070b <read>
+	if (r < 0)
+  8014a5:	83 c4 10             	add    $0x10,%esp
+  8014a8:	85 c0                	test   %eax,%eax
+  8014aa:	78 06                	js     8014b2 <getchar+0x20>
+	if (r < 1)
+  8014ac:	74 06                	je     8014b4 <getchar+0x22>
+	return c;
+  8014ae:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8014b2:	c9                   	leave
+  8014b3:	c3                   	ret
+		return -E_EOF;
+  8014b4:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8014b9:	eb f7                	jmp    8014b2 <getchar+0x20>
+
+008014bb <iscons>:
+{
+  8014bb:	55                   	push   %ebp
+  8014bc:	89 e5                	mov    %esp,%ebp
+  8014be:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8014c1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014c4:	50                   	push   %eax
+  8014c5:	ff 75 08             	push   0x8(%ebp)
+  8014c8:	e8 d8 ef ff ff       	call   8004a5 <fd_lookup>
+  8014cd:	83 c4 10             	add    $0x10,%esp
+  8014d0:	85 c0                	test   %eax,%eax
+  8014d2:	78 11                	js     8014e5 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8014d4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014d7:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  8014dd:	39 10                	cmp    %edx,(%eax)
+  8014df:	0f 94 c0             	sete   %al
+  8014e2:	0f b6 c0             	movzbl %al,%eax
+}
+  8014e5:	c9                   	leave
+  8014e6:	c3                   	ret
+
+008014e7 <opencons>:
+{
+  8014e7:	55                   	push   %ebp
+  8014e8:	89 e5                	mov    %esp,%ebp
+  8014ea:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8014ed:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014f0:	50                   	push   %eax
+  8014f1:	e8 59 ef ff ff       	call   80044f <fd_alloc>
+  8014f6:	83 c4 10             	add    $0x10,%esp
+  8014f9:	85 c0                	test   %eax,%eax
+  8014fb:	78 3a                	js     801537 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8014fd:	83 ec 04             	sub    $0x4,%esp
+  801500:	68 07 04 00 00       	push   $0x407
+  801505:	ff 75 f4             	push   -0xc(%ebp)
+  801508:	6a 00                	push   $0x0
+  80150a:	e8 46 ec ff ff       	call   800155 <sys_page_alloc>
+  80150f:	83 c4 10             	add    $0x10,%esp
+  801512:	85 c0                	test   %eax,%eax
+  801514:	78 21                	js     801537 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  801516:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801519:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  80151f:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  801521:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801524:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80152b:	83 ec 0c             	sub    $0xc,%esp
+  80152e:	50                   	push   %eax
+  80152f:	e8 f4 ee ff ff       	call   800428 <fd2num>
+  801534:	83 c4 10             	add    $0x10,%esp
+}
+  801537:	c9                   	leave
+  801538:	c3                   	ret
+
+00801539 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  801539:	55                   	push   %ebp
+  80153a:	89 e5                	mov    %esp,%ebp
+  80153c:	56                   	push   %esi
+  80153d:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80153e:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  801541:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  801547:	e8 cb eb ff ff       	call   800117 <sys_getenvid>
+  80154c:	83 ec 0c             	sub    $0xc,%esp
+  80154f:	ff 75 0c             	push   0xc(%ebp)
+  801552:	ff 75 08             	push   0x8(%ebp)
+  801555:	56                   	push   %esi
+  801556:	50                   	push   %eax
+  801557:	68 40 26 80 00       	push   $0x802640
+  80155c:	e8 b3 00 00 00       	call   801614 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  801561:	83 c4 18             	add    $0x18,%esp
+  801564:	53                   	push   %ebx
+  801565:	ff 75 10             	push   0x10(%ebp)
+  801568:	e8 56 00 00 00       	call   8015c3 <vcprintf>
+	cprintf("\n");
+  80156d:	c7 04 24 2c 26 80 00 	movl   $0x80262c,(%esp)
+  801574:	e8 9b 00 00 00       	call   801614 <cprintf>
+  801579:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80157c:	cc                   	int3
+	while (1)
+  80157d:	eb fd                	jmp    80157c <_panic+0x43>
+
+0080157f <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80157f:	55                   	push   %ebp
+  801580:	89 e5                	mov    %esp,%ebp
+  801582:	53                   	push   %ebx
+  801583:	83 ec 04             	sub    $0x4,%esp
+  801586:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  801589:	8b 13                	mov    (%ebx),%edx
+  80158b:	8d 42 01             	lea    0x1(%edx),%eax
+  80158e:	89 03                	mov    %eax,(%ebx)
+  801590:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801593:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  801597:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80159c:	74 09                	je     8015a7 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80159e:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8015a2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015a5:	c9                   	leave
+  8015a6:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8015a7:	83 ec 08             	sub    $0x8,%esp
+  8015aa:	68 ff 00 00 00       	push   $0xff
+  8015af:	8d 43 08             	lea    0x8(%ebx),%eax
+  8015b2:	50                   	push   %eax
+  8015b3:	e8 e1 ea ff ff       	call   800099 <sys_cputs>
+		b->idx = 0;
+  8015b8:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8015be:	83 c4 10             	add    $0x10,%esp
+  8015c1:	eb db                	jmp    80159e <putch+0x1f>
+
+008015c3 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8015c3:	55                   	push   %ebp
+  8015c4:	89 e5                	mov    %esp,%ebp
+  8015c6:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8015cc:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8015d3:	00 00 00 
+	b.cnt = 0;
+  8015d6:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8015dd:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8015e0:	ff 75 0c             	push   0xc(%ebp)
+  8015e3:	ff 75 08             	push   0x8(%ebp)
+  8015e6:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8015ec:	50                   	push   %eax
+  8015ed:	68 7f 15 80 00       	push   $0x80157f
+  8015f2:	e8 14 01 00 00       	call   80170b <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8015f7:	83 c4 08             	add    $0x8,%esp
+  8015fa:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  801600:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  801606:	50                   	push   %eax
+  801607:	e8 8d ea ff ff       	call   800099 <sys_cputs>
+
+	return b.cnt;
+}
+  80160c:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  801612:	c9                   	leave
+  801613:	c3                   	ret
+
+00801614 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  801614:	55                   	push   %ebp
+  801615:	89 e5                	mov    %esp,%ebp
+  801617:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80161a:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80161d:	50                   	push   %eax
+  80161e:	ff 75 08             	push   0x8(%ebp)
+  801621:	e8 9d ff ff ff       	call   8015c3 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  801626:	c9                   	leave
+  801627:	c3                   	ret
+
+00801628 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  801628:	55                   	push   %ebp
+  801629:	89 e5                	mov    %esp,%ebp
+  80162b:	57                   	push   %edi
+  80162c:	56                   	push   %esi
+  80162d:	53                   	push   %ebx
+  80162e:	83 ec 1c             	sub    $0x1c,%esp
+  801631:	89 c7                	mov    %eax,%edi
+  801633:	89 d6                	mov    %edx,%esi
+  801635:	8b 45 08             	mov    0x8(%ebp),%eax
+  801638:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80163b:	89 d1                	mov    %edx,%ecx
+  80163d:	89 c2                	mov    %eax,%edx
+  80163f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801642:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801645:	8b 45 10             	mov    0x10(%ebp),%eax
+  801648:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80164b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80164e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801655:	39 c2                	cmp    %eax,%edx
+  801657:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80165a:	72 3e                	jb     80169a <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80165c:	83 ec 0c             	sub    $0xc,%esp
+  80165f:	ff 75 18             	push   0x18(%ebp)
+  801662:	83 eb 01             	sub    $0x1,%ebx
+  801665:	53                   	push   %ebx
+  801666:	50                   	push   %eax
+  801667:	83 ec 08             	sub    $0x8,%esp
+  80166a:	ff 75 e4             	push   -0x1c(%ebp)
+  80166d:	ff 75 e0             	push   -0x20(%ebp)
+  801670:	ff 75 dc             	push   -0x24(%ebp)
+  801673:	ff 75 d8             	push   -0x28(%ebp)
+  801676:	e8 d5 0a 00 00       	call   802150 <__udivdi3>
+  80167b:	83 c4 18             	add    $0x18,%esp
+  80167e:	52                   	push   %edx
+  80167f:	50                   	push   %eax
+  801680:	89 f2                	mov    %esi,%edx
+  801682:	89 f8                	mov    %edi,%eax
+  801684:	e8 9f ff ff ff       	call   801628 <printnum>
+  801689:	83 c4 20             	add    $0x20,%esp
+  80168c:	eb 13                	jmp    8016a1 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80168e:	83 ec 08             	sub    $0x8,%esp
+  801691:	56                   	push   %esi
+  801692:	ff 75 18             	push   0x18(%ebp)
+  801695:	ff d7                	call   *%edi
+  801697:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80169a:	83 eb 01             	sub    $0x1,%ebx
+  80169d:	85 db                	test   %ebx,%ebx
+  80169f:	7f ed                	jg     80168e <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8016a1:	83 ec 08             	sub    $0x8,%esp
+  8016a4:	56                   	push   %esi
+  8016a5:	83 ec 04             	sub    $0x4,%esp
+  8016a8:	ff 75 e4             	push   -0x1c(%ebp)
+  8016ab:	ff 75 e0             	push   -0x20(%ebp)
+  8016ae:	ff 75 dc             	push   -0x24(%ebp)
+  8016b1:	ff 75 d8             	push   -0x28(%ebp)
+  8016b4:	e8 67 0b 00 00       	call   802220 <__umoddi3>
+  8016b9:	83 c4 14             	add    $0x14,%esp
+  8016bc:	0f be 80 63 26 80 00 	movsbl 0x802663(%eax),%eax
+  8016c3:	50                   	push   %eax
+  8016c4:	ff d7                	call   *%edi
+}
+  8016c6:	83 c4 10             	add    $0x10,%esp
+  8016c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016cc:	5b                   	pop    %ebx
+  8016cd:	5e                   	pop    %esi
+  8016ce:	5f                   	pop    %edi
+  8016cf:	5d                   	pop    %ebp
+  8016d0:	c3                   	ret
+
+008016d1 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8016d1:	55                   	push   %ebp
+  8016d2:	89 e5                	mov    %esp,%ebp
+  8016d4:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8016d7:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8016db:	8b 10                	mov    (%eax),%edx
+  8016dd:	3b 50 04             	cmp    0x4(%eax),%edx
+  8016e0:	73 0a                	jae    8016ec <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8016e2:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8016e5:	89 08                	mov    %ecx,(%eax)
+  8016e7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016ea:	88 02                	mov    %al,(%edx)
+}
+  8016ec:	5d                   	pop    %ebp
+  8016ed:	c3                   	ret
+
+008016ee <printfmt>:
+{
+  8016ee:	55                   	push   %ebp
+  8016ef:	89 e5                	mov    %esp,%ebp
+  8016f1:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8016f4:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8016f7:	50                   	push   %eax
+  8016f8:	ff 75 10             	push   0x10(%ebp)
+  8016fb:	ff 75 0c             	push   0xc(%ebp)
+  8016fe:	ff 75 08             	push   0x8(%ebp)
+  801701:	e8 05 00 00 00       	call   80170b <vprintfmt>
+}
+  801706:	83 c4 10             	add    $0x10,%esp
+  801709:	c9                   	leave
+  80170a:	c3                   	ret
+
+0080170b <vprintfmt>:
+{
+  80170b:	55                   	push   %ebp
+  80170c:	89 e5                	mov    %esp,%ebp
+  80170e:	57                   	push   %edi
+  80170f:	56                   	push   %esi
+  801710:	53                   	push   %ebx
+  801711:	83 ec 2c             	sub    $0x2c,%esp
+  801714:	8b 75 08             	mov    0x8(%ebp),%esi
+  801717:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80171a:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80171d:	eb 0a                	jmp    801729 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80171f:	83 ec 08             	sub    $0x8,%esp
+  801722:	53                   	push   %ebx
+  801723:	50                   	push   %eax
+  801724:	ff d6                	call   *%esi
+  801726:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801729:	83 c7 01             	add    $0x1,%edi
+  80172c:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  801730:	83 f8 25             	cmp    $0x25,%eax
+  801733:	74 0c                	je     801741 <vprintfmt+0x36>
+			if (ch == '\0')
+  801735:	85 c0                	test   %eax,%eax
+  801737:	75 e6                	jne    80171f <vprintfmt+0x14>
+}
+  801739:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80173c:	5b                   	pop    %ebx
+  80173d:	5e                   	pop    %esi
+  80173e:	5f                   	pop    %edi
+  80173f:	5d                   	pop    %ebp
+  801740:	c3                   	ret
+		padc = ' ';
+  801741:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  801745:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80174c:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  801753:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80175a:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80175f:	8d 47 01             	lea    0x1(%edi),%eax
+  801762:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801765:	0f b6 17             	movzbl (%edi),%edx
+  801768:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80176b:	3c 55                	cmp    $0x55,%al
+  80176d:	0f 87 9a 03 00 00    	ja     801b0d <vprintfmt+0x402>
+  801773:	0f b6 c0             	movzbl %al,%eax
+  801776:	ff 24 85 a0 27 80 00 	jmp    *0x8027a0(,%eax,4)
+  80177d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  801780:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  801784:	eb d9                	jmp    80175f <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  801786:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801789:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80178d:	eb d0                	jmp    80175f <vprintfmt+0x54>
+  80178f:	0f b6 d2             	movzbl %dl,%edx
+  801792:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  801795:	b8 00 00 00 00       	mov    $0x0,%eax
+  80179a:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80179d:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8017a0:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8017a4:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8017a7:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8017aa:	83 f9 09             	cmp    $0x9,%ecx
+  8017ad:	77 55                	ja     801804 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8017af:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8017b2:	eb e9                	jmp    80179d <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8017b4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8017b7:	8b 00                	mov    (%eax),%eax
+  8017b9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8017bc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8017bf:	8d 40 04             	lea    0x4(%eax),%eax
+  8017c2:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8017c5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8017c8:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8017cc:	79 91                	jns    80175f <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8017ce:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8017d1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8017d4:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8017db:	eb 82                	jmp    80175f <vprintfmt+0x54>
+			if (width < 0)
+  8017dd:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8017e0:	85 d2                	test   %edx,%edx
+  8017e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017e7:	0f 49 c2             	cmovns %edx,%eax
+  8017ea:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8017ed:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8017f0:	e9 6a ff ff ff       	jmp    80175f <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8017f5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8017f8:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8017ff:	e9 5b ff ff ff       	jmp    80175f <vprintfmt+0x54>
+  801804:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801807:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80180a:	eb bc                	jmp    8017c8 <vprintfmt+0xbd>
+			lflag++;
+  80180c:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80180f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  801812:	e9 48 ff ff ff       	jmp    80175f <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  801817:	8b 45 14             	mov    0x14(%ebp),%eax
+  80181a:	8d 78 04             	lea    0x4(%eax),%edi
+  80181d:	83 ec 08             	sub    $0x8,%esp
+  801820:	53                   	push   %ebx
+  801821:	ff 30                	push   (%eax)
+  801823:	ff d6                	call   *%esi
+			break;
+  801825:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  801828:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80182b:	e9 7c 02 00 00       	jmp    801aac <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  801830:	8b 45 14             	mov    0x14(%ebp),%eax
+  801833:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  801836:	8b 10                	mov    (%eax),%edx
+  801838:	89 d0                	mov    %edx,%eax
+  80183a:	f7 d8                	neg    %eax
+  80183c:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80183f:	83 f8 10             	cmp    $0x10,%eax
+  801842:	7f 23                	jg     801867 <vprintfmt+0x15c>
+  801844:	8b 14 85 00 29 80 00 	mov    0x802900(,%eax,4),%edx
+  80184b:	85 d2                	test   %edx,%edx
+  80184d:	74 18                	je     801867 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  80184f:	52                   	push   %edx
+  801850:	68 c1 25 80 00       	push   $0x8025c1
+  801855:	53                   	push   %ebx
+  801856:	56                   	push   %esi
+  801857:	e8 92 fe ff ff       	call   8016ee <printfmt>
+  80185c:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80185f:	89 7d 14             	mov    %edi,0x14(%ebp)
+  801862:	e9 45 02 00 00       	jmp    801aac <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  801867:	50                   	push   %eax
+  801868:	68 7b 26 80 00       	push   $0x80267b
+  80186d:	53                   	push   %ebx
+  80186e:	56                   	push   %esi
+  80186f:	e8 7a fe ff ff       	call   8016ee <printfmt>
+  801874:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801877:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80187a:	e9 2d 02 00 00       	jmp    801aac <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80187f:	8b 45 14             	mov    0x14(%ebp),%eax
+  801882:	83 c0 04             	add    $0x4,%eax
+  801885:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  801888:	8b 45 14             	mov    0x14(%ebp),%eax
+  80188b:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80188d:	85 c9                	test   %ecx,%ecx
+  80188f:	b8 74 26 80 00       	mov    $0x802674,%eax
+  801894:	0f 45 c1             	cmovne %ecx,%eax
+  801897:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80189a:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80189e:	7e 06                	jle    8018a6 <vprintfmt+0x19b>
+  8018a0:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8018a4:	75 0b                	jne    8018b1 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8018a6:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8018a9:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8018ac:	89 75 08             	mov    %esi,0x8(%ebp)
+  8018af:	eb 5c                	jmp    80190d <vprintfmt+0x202>
+  8018b1:	83 ec 08             	sub    $0x8,%esp
+  8018b4:	ff 75 d0             	push   -0x30(%ebp)
+  8018b7:	ff 75 cc             	push   -0x34(%ebp)
+  8018ba:	e8 eb 02 00 00       	call   801baa <strnlen>
+  8018bf:	89 c2                	mov    %eax,%edx
+  8018c1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8018c4:	29 d0                	sub    %edx,%eax
+  8018c6:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8018c9:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8018cd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8018d0:	89 75 08             	mov    %esi,0x8(%ebp)
+  8018d3:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8018d5:	eb 0e                	jmp    8018e5 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8018d7:	83 ec 08             	sub    $0x8,%esp
+  8018da:	53                   	push   %ebx
+  8018db:	57                   	push   %edi
+  8018dc:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8018df:	83 ee 01             	sub    $0x1,%esi
+  8018e2:	83 c4 10             	add    $0x10,%esp
+  8018e5:	85 f6                	test   %esi,%esi
+  8018e7:	7f ee                	jg     8018d7 <vprintfmt+0x1cc>
+  8018e9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8018ec:	8b 75 08             	mov    0x8(%ebp),%esi
+  8018ef:	85 c0                	test   %eax,%eax
+  8018f1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018f6:	0f 49 d0             	cmovns %eax,%edx
+  8018f9:	29 d0                	sub    %edx,%eax
+  8018fb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8018fe:	eb a6                	jmp    8018a6 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  801900:	83 ec 08             	sub    $0x8,%esp
+  801903:	53                   	push   %ebx
+  801904:	52                   	push   %edx
+  801905:	ff 55 08             	call   *0x8(%ebp)
+  801908:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80190b:	89 f1                	mov    %esi,%ecx
+  80190d:	8d 71 01             	lea    0x1(%ecx),%esi
+  801910:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  801914:	0f be d0             	movsbl %al,%edx
+  801917:	85 d2                	test   %edx,%edx
+  801919:	74 28                	je     801943 <vprintfmt+0x238>
+  80191b:	85 ff                	test   %edi,%edi
+  80191d:	78 05                	js     801924 <vprintfmt+0x219>
+  80191f:	83 ef 01             	sub    $0x1,%edi
+  801922:	78 30                	js     801954 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  801924:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  801928:	74 d6                	je     801900 <vprintfmt+0x1f5>
+  80192a:	0f be c0             	movsbl %al,%eax
+  80192d:	83 e8 20             	sub    $0x20,%eax
+  801930:	83 f8 5e             	cmp    $0x5e,%eax
+  801933:	76 cb                	jbe    801900 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  801935:	83 ec 08             	sub    $0x8,%esp
+  801938:	53                   	push   %ebx
+  801939:	6a 3f                	push   $0x3f
+  80193b:	ff 55 08             	call   *0x8(%ebp)
+  80193e:	83 c4 10             	add    $0x10,%esp
+  801941:	eb c8                	jmp    80190b <vprintfmt+0x200>
+  801943:	8b 75 08             	mov    0x8(%ebp),%esi
+  801946:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  801949:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80194c:	01 d0                	add    %edx,%eax
+  80194e:	29 c8                	sub    %ecx,%eax
+  801950:	89 c7                	mov    %eax,%edi
+  801952:	eb 13                	jmp    801967 <vprintfmt+0x25c>
+  801954:	8b 75 08             	mov    0x8(%ebp),%esi
+  801957:	eb ed                	jmp    801946 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  801959:	83 ec 08             	sub    $0x8,%esp
+  80195c:	53                   	push   %ebx
+  80195d:	6a 20                	push   $0x20
+  80195f:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  801961:	83 ef 01             	sub    $0x1,%edi
+  801964:	83 c4 10             	add    $0x10,%esp
+  801967:	85 ff                	test   %edi,%edi
+  801969:	7f ee                	jg     801959 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80196b:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80196e:	89 45 14             	mov    %eax,0x14(%ebp)
+  801971:	e9 36 01 00 00       	jmp    801aac <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  801976:	83 f9 01             	cmp    $0x1,%ecx
+  801979:	7f 1f                	jg     80199a <vprintfmt+0x28f>
+	else if (lflag)
+  80197b:	85 c9                	test   %ecx,%ecx
+  80197d:	74 67                	je     8019e6 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  80197f:	8b 45 14             	mov    0x14(%ebp),%eax
+  801982:	8b 00                	mov    (%eax),%eax
+  801984:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801987:	89 c1                	mov    %eax,%ecx
+  801989:	c1 f9 1f             	sar    $0x1f,%ecx
+  80198c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80198f:	8b 45 14             	mov    0x14(%ebp),%eax
+  801992:	8d 40 04             	lea    0x4(%eax),%eax
+  801995:	89 45 14             	mov    %eax,0x14(%ebp)
+  801998:	eb 17                	jmp    8019b1 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  80199a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80199d:	8b 50 04             	mov    0x4(%eax),%edx
+  8019a0:	8b 00                	mov    (%eax),%eax
+  8019a2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8019a5:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8019a8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019ab:	8d 40 08             	lea    0x8(%eax),%eax
+  8019ae:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8019b1:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8019b4:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8019b7:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8019bc:	85 c9                	test   %ecx,%ecx
+  8019be:	0f 89 ce 00 00 00    	jns    801a92 <vprintfmt+0x387>
+				putch('-', putdat);
+  8019c4:	83 ec 08             	sub    $0x8,%esp
+  8019c7:	53                   	push   %ebx
+  8019c8:	6a 2d                	push   $0x2d
+  8019ca:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8019cc:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8019cf:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8019d2:	f7 da                	neg    %edx
+  8019d4:	83 d1 00             	adc    $0x0,%ecx
+  8019d7:	f7 d9                	neg    %ecx
+  8019d9:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8019dc:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8019e1:	e9 ac 00 00 00       	jmp    801a92 <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  8019e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019e9:	8b 00                	mov    (%eax),%eax
+  8019eb:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8019ee:	89 c1                	mov    %eax,%ecx
+  8019f0:	c1 f9 1f             	sar    $0x1f,%ecx
+  8019f3:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8019f6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019f9:	8d 40 04             	lea    0x4(%eax),%eax
+  8019fc:	89 45 14             	mov    %eax,0x14(%ebp)
+  8019ff:	eb b0                	jmp    8019b1 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  801a01:	83 f9 01             	cmp    $0x1,%ecx
+  801a04:	7f 1b                	jg     801a21 <vprintfmt+0x316>
+	else if (lflag)
+  801a06:	85 c9                	test   %ecx,%ecx
+  801a08:	74 2c                	je     801a36 <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  801a0a:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a0d:	8b 10                	mov    (%eax),%edx
+  801a0f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a14:	8d 40 04             	lea    0x4(%eax),%eax
+  801a17:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801a1a:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  801a1f:	eb 71                	jmp    801a92 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  801a21:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a24:	8b 10                	mov    (%eax),%edx
+  801a26:	8b 48 04             	mov    0x4(%eax),%ecx
+  801a29:	8d 40 08             	lea    0x8(%eax),%eax
+  801a2c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801a2f:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  801a34:	eb 5c                	jmp    801a92 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  801a36:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a39:	8b 10                	mov    (%eax),%edx
+  801a3b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a40:	8d 40 04             	lea    0x4(%eax),%eax
+  801a43:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801a46:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  801a4b:	eb 45                	jmp    801a92 <vprintfmt+0x387>
+			putch('X', putdat);
+  801a4d:	83 ec 08             	sub    $0x8,%esp
+  801a50:	53                   	push   %ebx
+  801a51:	6a 58                	push   $0x58
+  801a53:	ff d6                	call   *%esi
+			putch('X', putdat);
+  801a55:	83 c4 08             	add    $0x8,%esp
+  801a58:	53                   	push   %ebx
+  801a59:	6a 58                	push   $0x58
+  801a5b:	ff d6                	call   *%esi
+			putch('X', putdat);
+  801a5d:	83 c4 08             	add    $0x8,%esp
+  801a60:	53                   	push   %ebx
+  801a61:	6a 58                	push   $0x58
+  801a63:	ff d6                	call   *%esi
+			break;
+  801a65:	83 c4 10             	add    $0x10,%esp
+  801a68:	eb 42                	jmp    801aac <vprintfmt+0x3a1>
+			putch('0', putdat);
+  801a6a:	83 ec 08             	sub    $0x8,%esp
+  801a6d:	53                   	push   %ebx
+  801a6e:	6a 30                	push   $0x30
+  801a70:	ff d6                	call   *%esi
+			putch('x', putdat);
+  801a72:	83 c4 08             	add    $0x8,%esp
+  801a75:	53                   	push   %ebx
+  801a76:	6a 78                	push   $0x78
+  801a78:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  801a7a:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a7d:	8b 10                	mov    (%eax),%edx
+  801a7f:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  801a84:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  801a87:	8d 40 04             	lea    0x4(%eax),%eax
+  801a8a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801a8d:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  801a92:	83 ec 0c             	sub    $0xc,%esp
+  801a95:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  801a99:	50                   	push   %eax
+  801a9a:	ff 75 e0             	push   -0x20(%ebp)
+  801a9d:	57                   	push   %edi
+  801a9e:	51                   	push   %ecx
+  801a9f:	52                   	push   %edx
+  801aa0:	89 da                	mov    %ebx,%edx
+  801aa2:	89 f0                	mov    %esi,%eax
+  801aa4:	e8 7f fb ff ff       	call   801628 <printnum>
+			break;
+  801aa9:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  801aac:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801aaf:	e9 75 fc ff ff       	jmp    801729 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  801ab4:	83 f9 01             	cmp    $0x1,%ecx
+  801ab7:	7f 1b                	jg     801ad4 <vprintfmt+0x3c9>
+	else if (lflag)
+  801ab9:	85 c9                	test   %ecx,%ecx
+  801abb:	74 2c                	je     801ae9 <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  801abd:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ac0:	8b 10                	mov    (%eax),%edx
+  801ac2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ac7:	8d 40 04             	lea    0x4(%eax),%eax
+  801aca:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801acd:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  801ad2:	eb be                	jmp    801a92 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  801ad4:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ad7:	8b 10                	mov    (%eax),%edx
+  801ad9:	8b 48 04             	mov    0x4(%eax),%ecx
+  801adc:	8d 40 08             	lea    0x8(%eax),%eax
+  801adf:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801ae2:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  801ae7:	eb a9                	jmp    801a92 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  801ae9:	8b 45 14             	mov    0x14(%ebp),%eax
+  801aec:	8b 10                	mov    (%eax),%edx
+  801aee:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801af3:	8d 40 04             	lea    0x4(%eax),%eax
+  801af6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801af9:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  801afe:	eb 92                	jmp    801a92 <vprintfmt+0x387>
+			putch(ch, putdat);
+  801b00:	83 ec 08             	sub    $0x8,%esp
+  801b03:	53                   	push   %ebx
+  801b04:	6a 25                	push   $0x25
+  801b06:	ff d6                	call   *%esi
+			break;
+  801b08:	83 c4 10             	add    $0x10,%esp
+  801b0b:	eb 9f                	jmp    801aac <vprintfmt+0x3a1>
+			putch('%', putdat);
+  801b0d:	83 ec 08             	sub    $0x8,%esp
+  801b10:	53                   	push   %ebx
+  801b11:	6a 25                	push   $0x25
+  801b13:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801b15:	83 c4 10             	add    $0x10,%esp
+  801b18:	89 f8                	mov    %edi,%eax
+  801b1a:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  801b1e:	74 05                	je     801b25 <vprintfmt+0x41a>
+  801b20:	83 e8 01             	sub    $0x1,%eax
+  801b23:	eb f5                	jmp    801b1a <vprintfmt+0x40f>
+  801b25:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801b28:	eb 82                	jmp    801aac <vprintfmt+0x3a1>
+
+00801b2a <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  801b2a:	55                   	push   %ebp
+  801b2b:	89 e5                	mov    %esp,%ebp
+  801b2d:	83 ec 18             	sub    $0x18,%esp
+  801b30:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b33:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  801b36:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  801b39:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  801b3d:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  801b40:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  801b47:	85 c0                	test   %eax,%eax
+  801b49:	74 26                	je     801b71 <vsnprintf+0x47>
+  801b4b:	85 d2                	test   %edx,%edx
+  801b4d:	7e 22                	jle    801b71 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  801b4f:	ff 75 14             	push   0x14(%ebp)
+  801b52:	ff 75 10             	push   0x10(%ebp)
+  801b55:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  801b58:	50                   	push   %eax
+  801b59:	68 d1 16 80 00       	push   $0x8016d1
+  801b5e:	e8 a8 fb ff ff       	call   80170b <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  801b63:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801b66:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  801b69:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b6c:	83 c4 10             	add    $0x10,%esp
+}
+  801b6f:	c9                   	leave
+  801b70:	c3                   	ret
+		return -E_INVAL;
+  801b71:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b76:	eb f7                	jmp    801b6f <vsnprintf+0x45>
+
+00801b78 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801b78:	55                   	push   %ebp
+  801b79:	89 e5                	mov    %esp,%ebp
+  801b7b:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  801b7e:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  801b81:	50                   	push   %eax
+  801b82:	ff 75 10             	push   0x10(%ebp)
+  801b85:	ff 75 0c             	push   0xc(%ebp)
+  801b88:	ff 75 08             	push   0x8(%ebp)
+  801b8b:	e8 9a ff ff ff       	call   801b2a <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  801b90:	c9                   	leave
+  801b91:	c3                   	ret
+
+00801b92 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  801b92:	55                   	push   %ebp
+  801b93:	89 e5                	mov    %esp,%ebp
+  801b95:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  801b98:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b9d:	eb 03                	jmp    801ba2 <strlen+0x10>
+		n++;
+  801b9f:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  801ba2:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  801ba6:	75 f7                	jne    801b9f <strlen+0xd>
+	return n;
+}
+  801ba8:	5d                   	pop    %ebp
+  801ba9:	c3                   	ret
+
+00801baa <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  801baa:	55                   	push   %ebp
+  801bab:	89 e5                	mov    %esp,%ebp
+  801bad:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801bb0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801bb3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bb8:	eb 03                	jmp    801bbd <strnlen+0x13>
+		n++;
+  801bba:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801bbd:	39 d0                	cmp    %edx,%eax
+  801bbf:	74 08                	je     801bc9 <strnlen+0x1f>
+  801bc1:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  801bc5:	75 f3                	jne    801bba <strnlen+0x10>
+  801bc7:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  801bc9:	89 d0                	mov    %edx,%eax
+  801bcb:	5d                   	pop    %ebp
+  801bcc:	c3                   	ret
+
+00801bcd <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801bcd:	55                   	push   %ebp
+  801bce:	89 e5                	mov    %esp,%ebp
+  801bd0:	53                   	push   %ebx
+  801bd1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801bd4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  801bd7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bdc:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  801be0:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  801be3:	83 c0 01             	add    $0x1,%eax
+  801be6:	84 d2                	test   %dl,%dl
+  801be8:	75 f2                	jne    801bdc <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  801bea:	89 c8                	mov    %ecx,%eax
+  801bec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bef:	c9                   	leave
+  801bf0:	c3                   	ret
+
+00801bf1 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801bf1:	55                   	push   %ebp
+  801bf2:	89 e5                	mov    %esp,%ebp
+  801bf4:	53                   	push   %ebx
+  801bf5:	83 ec 10             	sub    $0x10,%esp
+  801bf8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  801bfb:	53                   	push   %ebx
+  801bfc:	e8 91 ff ff ff       	call   801b92 <strlen>
+  801c01:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  801c04:	ff 75 0c             	push   0xc(%ebp)
+  801c07:	01 d8                	add    %ebx,%eax
+  801c09:	50                   	push   %eax
+  801c0a:	e8 be ff ff ff       	call   801bcd <strcpy>
+	return dst;
+}
+  801c0f:	89 d8                	mov    %ebx,%eax
+  801c11:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c14:	c9                   	leave
+  801c15:	c3                   	ret
+
+00801c16 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801c16:	55                   	push   %ebp
+  801c17:	89 e5                	mov    %esp,%ebp
+  801c19:	56                   	push   %esi
+  801c1a:	53                   	push   %ebx
+  801c1b:	8b 75 08             	mov    0x8(%ebp),%esi
+  801c1e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  801c21:	89 f3                	mov    %esi,%ebx
+  801c23:	03 5d 10             	add    0x10(%ebp),%ebx
+  801c26:	89 f0                	mov    %esi,%eax
+  801c28:	eb 0f                	jmp    801c39 <strncpy+0x23>
+		*dst++ = *src;
+  801c2a:	83 c0 01             	add    $0x1,%eax
+  801c2d:	0f b6 0a             	movzbl (%edx),%ecx
+  801c30:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  801c33:	80 f9 01             	cmp    $0x1,%cl
+  801c36:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  801c39:	39 d8                	cmp    %ebx,%eax
+  801c3b:	75 ed                	jne    801c2a <strncpy+0x14>
+	}
+	return ret;
+}
+  801c3d:	89 f0                	mov    %esi,%eax
+  801c3f:	5b                   	pop    %ebx
+  801c40:	5e                   	pop    %esi
+  801c41:	5d                   	pop    %ebp
+  801c42:	c3                   	ret
+
+00801c43 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801c43:	55                   	push   %ebp
+  801c44:	89 e5                	mov    %esp,%ebp
+  801c46:	56                   	push   %esi
+  801c47:	53                   	push   %ebx
+  801c48:	8b 75 08             	mov    0x8(%ebp),%esi
+  801c4b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c4e:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  801c51:	89 f0                	mov    %esi,%eax
+  801c53:	85 d2                	test   %edx,%edx
+  801c55:	74 21                	je     801c78 <strlcpy+0x35>
+  801c57:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  801c5b:	89 f2                	mov    %esi,%edx
+  801c5d:	eb 09                	jmp    801c68 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  801c5f:	83 c1 01             	add    $0x1,%ecx
+  801c62:	83 c2 01             	add    $0x1,%edx
+  801c65:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  801c68:	39 c2                	cmp    %eax,%edx
+  801c6a:	74 09                	je     801c75 <strlcpy+0x32>
+  801c6c:	0f b6 19             	movzbl (%ecx),%ebx
+  801c6f:	84 db                	test   %bl,%bl
+  801c71:	75 ec                	jne    801c5f <strlcpy+0x1c>
+  801c73:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  801c75:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  801c78:	29 f0                	sub    %esi,%eax
+}
+  801c7a:	5b                   	pop    %ebx
+  801c7b:	5e                   	pop    %esi
+  801c7c:	5d                   	pop    %ebp
+  801c7d:	c3                   	ret
+
+00801c7e <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  801c7e:	55                   	push   %ebp
+  801c7f:	89 e5                	mov    %esp,%ebp
+  801c81:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801c84:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  801c87:	eb 06                	jmp    801c8f <strcmp+0x11>
+		p++, q++;
+  801c89:	83 c1 01             	add    $0x1,%ecx
+  801c8c:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  801c8f:	0f b6 01             	movzbl (%ecx),%eax
+  801c92:	84 c0                	test   %al,%al
+  801c94:	74 04                	je     801c9a <strcmp+0x1c>
+  801c96:	3a 02                	cmp    (%edx),%al
+  801c98:	74 ef                	je     801c89 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801c9a:	0f b6 c0             	movzbl %al,%eax
+  801c9d:	0f b6 12             	movzbl (%edx),%edx
+  801ca0:	29 d0                	sub    %edx,%eax
+}
+  801ca2:	5d                   	pop    %ebp
+  801ca3:	c3                   	ret
+
+00801ca4 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801ca4:	55                   	push   %ebp
+  801ca5:	89 e5                	mov    %esp,%ebp
+  801ca7:	53                   	push   %ebx
+  801ca8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801cae:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  801cb1:	eb 09                	jmp    801cbc <strncmp+0x18>
+		n--, p++, q++;
+  801cb3:	83 ea 01             	sub    $0x1,%edx
+  801cb6:	83 c0 01             	add    $0x1,%eax
+  801cb9:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  801cbc:	85 d2                	test   %edx,%edx
+  801cbe:	74 18                	je     801cd8 <strncmp+0x34>
+  801cc0:	0f b6 18             	movzbl (%eax),%ebx
+  801cc3:	84 db                	test   %bl,%bl
+  801cc5:	74 04                	je     801ccb <strncmp+0x27>
+  801cc7:	3a 19                	cmp    (%ecx),%bl
+  801cc9:	74 e8                	je     801cb3 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801ccb:	0f b6 00             	movzbl (%eax),%eax
+  801cce:	0f b6 11             	movzbl (%ecx),%edx
+  801cd1:	29 d0                	sub    %edx,%eax
+}
+  801cd3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cd6:	c9                   	leave
+  801cd7:	c3                   	ret
+		return 0;
+  801cd8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cdd:	eb f4                	jmp    801cd3 <strncmp+0x2f>
+
+00801cdf <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801cdf:	55                   	push   %ebp
+  801ce0:	89 e5                	mov    %esp,%ebp
+  801ce2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ce5:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801ce9:	eb 03                	jmp    801cee <strchr+0xf>
+  801ceb:	83 c0 01             	add    $0x1,%eax
+  801cee:	0f b6 10             	movzbl (%eax),%edx
+  801cf1:	84 d2                	test   %dl,%dl
+  801cf3:	74 06                	je     801cfb <strchr+0x1c>
+		if (*s == c)
+  801cf5:	38 ca                	cmp    %cl,%dl
+  801cf7:	75 f2                	jne    801ceb <strchr+0xc>
+  801cf9:	eb 05                	jmp    801d00 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  801cfb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d00:	5d                   	pop    %ebp
+  801d01:	c3                   	ret
+
+00801d02 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801d02:	55                   	push   %ebp
+  801d03:	89 e5                	mov    %esp,%ebp
+  801d05:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d08:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801d0c:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  801d0f:	38 ca                	cmp    %cl,%dl
+  801d11:	74 09                	je     801d1c <strfind+0x1a>
+  801d13:	84 d2                	test   %dl,%dl
+  801d15:	74 05                	je     801d1c <strfind+0x1a>
+	for (; *s; s++)
+  801d17:	83 c0 01             	add    $0x1,%eax
+  801d1a:	eb f0                	jmp    801d0c <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  801d1c:	5d                   	pop    %ebp
+  801d1d:	c3                   	ret
+
+00801d1e <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801d1e:	55                   	push   %ebp
+  801d1f:	89 e5                	mov    %esp,%ebp
+  801d21:	57                   	push   %edi
+  801d22:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801d25:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  801d28:	85 c9                	test   %ecx,%ecx
+  801d2a:	74 20                	je     801d4c <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  801d2c:	89 f8                	mov    %edi,%eax
+  801d2e:	09 c8                	or     %ecx,%eax
+  801d30:	a8 03                	test   $0x3,%al
+  801d32:	75 12                	jne    801d46 <memset+0x28>
+		c &= 0xFF;
+  801d34:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  801d38:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  801d3e:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  801d41:	fc                   	cld
+  801d42:	f3 ab                	rep stos %eax,%es:(%edi)
+  801d44:	eb 06                	jmp    801d4c <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801d46:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d49:	fc                   	cld
+  801d4a:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  801d4c:	89 f8                	mov    %edi,%eax
+  801d4e:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  801d51:	c9                   	leave
+  801d52:	c3                   	ret
+
+00801d53 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801d53:	55                   	push   %ebp
+  801d54:	89 e5                	mov    %esp,%ebp
+  801d56:	57                   	push   %edi
+  801d57:	56                   	push   %esi
+  801d58:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d5b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801d5e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  801d61:	39 c6                	cmp    %eax,%esi
+  801d63:	73 32                	jae    801d97 <memmove+0x44>
+  801d65:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  801d68:	39 d0                	cmp    %edx,%eax
+  801d6a:	73 2b                	jae    801d97 <memmove+0x44>
+		s += n;
+		d += n;
+  801d6c:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801d6f:	89 d6                	mov    %edx,%esi
+  801d71:	09 fe                	or     %edi,%esi
+  801d73:	09 ce                	or     %ecx,%esi
+  801d75:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  801d7b:	75 0e                	jne    801d8b <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801d7d:	83 ef 04             	sub    $0x4,%edi
+  801d80:	8d 72 fc             	lea    -0x4(%edx),%esi
+  801d83:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  801d86:	fd                   	std
+  801d87:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801d89:	eb 09                	jmp    801d94 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801d8b:	83 ef 01             	sub    $0x1,%edi
+  801d8e:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  801d91:	fd                   	std
+  801d92:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801d94:	fc                   	cld
+  801d95:	eb 1a                	jmp    801db1 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801d97:	89 f2                	mov    %esi,%edx
+  801d99:	09 c2                	or     %eax,%edx
+  801d9b:	09 ca                	or     %ecx,%edx
+  801d9d:	f6 c2 03             	test   $0x3,%dl
+  801da0:	75 0a                	jne    801dac <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801da2:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  801da5:	89 c7                	mov    %eax,%edi
+  801da7:	fc                   	cld
+  801da8:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801daa:	eb 05                	jmp    801db1 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  801dac:	89 c7                	mov    %eax,%edi
+  801dae:	fc                   	cld
+  801daf:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  801db1:	5e                   	pop    %esi
+  801db2:	5f                   	pop    %edi
+  801db3:	5d                   	pop    %ebp
+  801db4:	c3                   	ret
+
+00801db5 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801db5:	55                   	push   %ebp
+  801db6:	89 e5                	mov    %esp,%ebp
+  801db8:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  801dbb:	ff 75 10             	push   0x10(%ebp)
+  801dbe:	ff 75 0c             	push   0xc(%ebp)
+  801dc1:	ff 75 08             	push   0x8(%ebp)
+  801dc4:	e8 8a ff ff ff       	call   801d53 <memmove>
+}
+  801dc9:	c9                   	leave
+  801dca:	c3                   	ret
+
+00801dcb <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801dcb:	55                   	push   %ebp
+  801dcc:	89 e5                	mov    %esp,%ebp
+  801dce:	56                   	push   %esi
+  801dcf:	53                   	push   %ebx
+  801dd0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dd3:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  801dd6:	89 c6                	mov    %eax,%esi
+  801dd8:	03 75 10             	add    0x10(%ebp),%esi
+  801ddb:	eb 06                	jmp    801de3 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  801ddd:	83 c0 01             	add    $0x1,%eax
+  801de0:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  801de3:	39 f0                	cmp    %esi,%eax
+  801de5:	74 14                	je     801dfb <memcmp+0x30>
+		if (*s1 != *s2)
+  801de7:	0f b6 08             	movzbl (%eax),%ecx
+  801dea:	0f b6 1a             	movzbl (%edx),%ebx
+  801ded:	38 d9                	cmp    %bl,%cl
+  801def:	74 ec                	je     801ddd <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  801df1:	0f b6 c1             	movzbl %cl,%eax
+  801df4:	0f b6 db             	movzbl %bl,%ebx
+  801df7:	29 d8                	sub    %ebx,%eax
+  801df9:	eb 05                	jmp    801e00 <memcmp+0x35>
+	}
+
+	return 0;
+  801dfb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e00:	5b                   	pop    %ebx
+  801e01:	5e                   	pop    %esi
+  801e02:	5d                   	pop    %ebp
+  801e03:	c3                   	ret
+
+00801e04 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801e04:	55                   	push   %ebp
+  801e05:	89 e5                	mov    %esp,%ebp
+  801e07:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e0a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  801e0d:	89 c2                	mov    %eax,%edx
+  801e0f:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  801e12:	eb 03                	jmp    801e17 <memfind+0x13>
+  801e14:	83 c0 01             	add    $0x1,%eax
+  801e17:	39 d0                	cmp    %edx,%eax
+  801e19:	73 04                	jae    801e1f <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801e1b:	38 08                	cmp    %cl,(%eax)
+  801e1d:	75 f5                	jne    801e14 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  801e1f:	5d                   	pop    %ebp
+  801e20:	c3                   	ret
+
+00801e21 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  801e21:	55                   	push   %ebp
+  801e22:	89 e5                	mov    %esp,%ebp
+  801e24:	57                   	push   %edi
+  801e25:	56                   	push   %esi
+  801e26:	53                   	push   %ebx
+  801e27:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e2a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801e2d:	eb 03                	jmp    801e32 <strtol+0x11>
+		s++;
+  801e2f:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  801e32:	0f b6 02             	movzbl (%edx),%eax
+  801e35:	3c 20                	cmp    $0x20,%al
+  801e37:	74 f6                	je     801e2f <strtol+0xe>
+  801e39:	3c 09                	cmp    $0x9,%al
+  801e3b:	74 f2                	je     801e2f <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  801e3d:	3c 2b                	cmp    $0x2b,%al
+  801e3f:	74 2a                	je     801e6b <strtol+0x4a>
+	int neg = 0;
+  801e41:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  801e46:	3c 2d                	cmp    $0x2d,%al
+  801e48:	74 2b                	je     801e75 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801e4a:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  801e50:	75 0f                	jne    801e61 <strtol+0x40>
+  801e52:	80 3a 30             	cmpb   $0x30,(%edx)
+  801e55:	74 28                	je     801e7f <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  801e57:	85 db                	test   %ebx,%ebx
+  801e59:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801e5e:	0f 44 d8             	cmove  %eax,%ebx
+  801e61:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e66:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  801e69:	eb 46                	jmp    801eb1 <strtol+0x90>
+		s++;
+  801e6b:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  801e6e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e73:	eb d5                	jmp    801e4a <strtol+0x29>
+		s++, neg = 1;
+  801e75:	83 c2 01             	add    $0x1,%edx
+  801e78:	bf 01 00 00 00       	mov    $0x1,%edi
+  801e7d:	eb cb                	jmp    801e4a <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801e7f:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  801e83:	74 0e                	je     801e93 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  801e85:	85 db                	test   %ebx,%ebx
+  801e87:	75 d8                	jne    801e61 <strtol+0x40>
+		s++, base = 8;
+  801e89:	83 c2 01             	add    $0x1,%edx
+  801e8c:	bb 08 00 00 00       	mov    $0x8,%ebx
+  801e91:	eb ce                	jmp    801e61 <strtol+0x40>
+		s += 2, base = 16;
+  801e93:	83 c2 02             	add    $0x2,%edx
+  801e96:	bb 10 00 00 00       	mov    $0x10,%ebx
+  801e9b:	eb c4                	jmp    801e61 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  801e9d:	0f be c0             	movsbl %al,%eax
+  801ea0:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  801ea3:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801ea6:	7d 3a                	jge    801ee2 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  801ea8:	83 c2 01             	add    $0x1,%edx
+  801eab:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  801eaf:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  801eb1:	0f b6 02             	movzbl (%edx),%eax
+  801eb4:	8d 70 d0             	lea    -0x30(%eax),%esi
+  801eb7:	89 f3                	mov    %esi,%ebx
+  801eb9:	80 fb 09             	cmp    $0x9,%bl
+  801ebc:	76 df                	jbe    801e9d <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  801ebe:	8d 70 9f             	lea    -0x61(%eax),%esi
+  801ec1:	89 f3                	mov    %esi,%ebx
+  801ec3:	80 fb 19             	cmp    $0x19,%bl
+  801ec6:	77 08                	ja     801ed0 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  801ec8:	0f be c0             	movsbl %al,%eax
+  801ecb:	83 e8 57             	sub    $0x57,%eax
+  801ece:	eb d3                	jmp    801ea3 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  801ed0:	8d 70 bf             	lea    -0x41(%eax),%esi
+  801ed3:	89 f3                	mov    %esi,%ebx
+  801ed5:	80 fb 19             	cmp    $0x19,%bl
+  801ed8:	77 08                	ja     801ee2 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  801eda:	0f be c0             	movsbl %al,%eax
+  801edd:	83 e8 37             	sub    $0x37,%eax
+  801ee0:	eb c1                	jmp    801ea3 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801ee2:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  801ee6:	74 05                	je     801eed <strtol+0xcc>
+		*endptr = (char *) s;
+  801ee8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801eeb:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  801eed:	89 c8                	mov    %ecx,%eax
+  801eef:	f7 d8                	neg    %eax
+  801ef1:	85 ff                	test   %edi,%edi
+  801ef3:	0f 45 c8             	cmovne %eax,%ecx
+}
+  801ef6:	89 c8                	mov    %ecx,%eax
+  801ef8:	5b                   	pop    %ebx
+  801ef9:	5e                   	pop    %esi
+  801efa:	5f                   	pop    %edi
+  801efb:	5d                   	pop    %ebp
+  801efc:	c3                   	ret
+
+00801efd <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  801efd:	55                   	push   %ebp
+  801efe:	89 e5                	mov    %esp,%ebp
+  801f00:	56                   	push   %esi
+  801f01:	53                   	push   %ebx
+  801f02:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f05:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f08:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  801f0b:	85 c0                	test   %eax,%eax
+  801f0d:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801f12:	0f 44 c2             	cmove  %edx,%eax
+  801f15:	83 ec 0c             	sub    $0xc,%esp
+  801f18:	50                   	push   %eax
+  801f19:	e8 e7 e3 ff ff       	call   800305 <sys_ipc_recv>
+
+  if (from_env_store)
+  801f1e:	83 c4 10             	add    $0x10,%esp
+  801f21:	85 f6                	test   %esi,%esi
+  801f23:	74 17                	je     801f3c <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  801f25:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f2a:	85 c0                	test   %eax,%eax
+  801f2c:	75 0c                	jne    801f3a <ipc_recv+0x3d>
+  801f2e:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801f34:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  801f3a:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  801f3c:	85 db                	test   %ebx,%ebx
+  801f3e:	74 2b                	je     801f6b <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  801f40:	85 c0                	test   %eax,%eax
+  801f42:	74 0d                	je     801f51 <ipc_recv+0x54>
+  801f44:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  801f4a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f4d:	5b                   	pop    %ebx
+  801f4e:	5e                   	pop    %esi
+  801f4f:	5d                   	pop    %ebp
+  801f50:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  801f51:	a1 08 40 80 00       	mov    0x804008,%eax
+  801f56:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  801f5c:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  801f5e:	a1 08 40 80 00       	mov    0x804008,%eax
+  801f63:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  801f69:	eb df                	jmp    801f4a <ipc_recv+0x4d>
+  801f6b:	85 c0                	test   %eax,%eax
+  801f6d:	75 db                	jne    801f4a <ipc_recv+0x4d>
+  801f6f:	eb ed                	jmp    801f5e <ipc_recv+0x61>
+
+00801f71 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  801f71:	55                   	push   %ebp
+  801f72:	89 e5                	mov    %esp,%ebp
+  801f74:	57                   	push   %edi
+  801f75:	56                   	push   %esi
+  801f76:	53                   	push   %ebx
+  801f77:	83 ec 0c             	sub    $0xc,%esp
+  801f7a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801f7d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801f80:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  801f83:	85 db                	test   %ebx,%ebx
+  801f85:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801f8a:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  801f8d:	ff 75 14             	push   0x14(%ebp)
+  801f90:	53                   	push   %ebx
+  801f91:	56                   	push   %esi
+  801f92:	57                   	push   %edi
+  801f93:	e8 4a e3 ff ff       	call   8002e2 <sys_ipc_try_send>
+  801f98:	83 c4 10             	add    $0x10,%esp
+  801f9b:	85 c0                	test   %eax,%eax
+  801f9d:	74 1e                	je     801fbd <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  801f9f:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801fa2:	75 07                	jne    801fab <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  801fa4:	e8 8d e1 ff ff       	call   800136 <sys_yield>
+  801fa9:	eb e2                	jmp    801f8d <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  801fab:	50                   	push   %eax
+  801fac:	68 63 29 80 00       	push   $0x802963
+  801fb1:	6a 3c                	push   $0x3c
+  801fb3:	68 70 29 80 00       	push   $0x802970
+  801fb8:	e8 7c f5 ff ff       	call   801539 <_panic>
+  }
+
+#endif
+}
+  801fbd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fc0:	5b                   	pop    %ebx
+  801fc1:	5e                   	pop    %esi
+  801fc2:	5f                   	pop    %edi
+  801fc3:	5d                   	pop    %ebp
+  801fc4:	c3                   	ret
+
+00801fc5 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  801fc5:	55                   	push   %ebp
+  801fc6:	89 e5                	mov    %esp,%ebp
+  801fc8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  801fcb:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  801fd0:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  801fd3:	c1 e0 04             	shl    $0x4,%eax
+  801fd6:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801fdb:	8b 40 50             	mov    0x50(%eax),%eax
+  801fde:	39 c8                	cmp    %ecx,%eax
+  801fe0:	74 12                	je     801ff4 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  801fe2:	83 c2 01             	add    $0x1,%edx
+  801fe5:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  801feb:	75 e3                	jne    801fd0 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  801fed:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ff2:	eb 0e                	jmp    802002 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  801ff4:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  801ff7:	c1 e0 04             	shl    $0x4,%eax
+  801ffa:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801fff:	8b 40 48             	mov    0x48(%eax),%eax
+  802002:	5d                   	pop    %ebp
+  802003:	c3                   	ret
+
+00802004 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802004:	55                   	push   %ebp
+  802005:	89 e5                	mov    %esp,%ebp
+  802007:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80200a:	89 c2                	mov    %eax,%edx
+  80200c:	c1 ea 16             	shr    $0x16,%edx
+  80200f:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802016:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80201b:	f6 c1 01             	test   $0x1,%cl
+  80201e:	74 1c                	je     80203c <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  802020:	c1 e8 0c             	shr    $0xc,%eax
+  802023:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80202a:	a8 01                	test   $0x1,%al
+  80202c:	74 0e                	je     80203c <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80202e:	c1 e8 0c             	shr    $0xc,%eax
+  802031:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802038:	ef 
+  802039:	0f b7 d2             	movzwl %dx,%edx
+}
+  80203c:	89 d0                	mov    %edx,%eax
+  80203e:	5d                   	pop    %ebp
+  80203f:	c3                   	ret
+
+00802040 <__udivmoddi4>:
+  802040:	55                   	push   %ebp
+  802041:	57                   	push   %edi
+  802042:	56                   	push   %esi
+  802043:	53                   	push   %ebx
+  802044:	83 ec 24             	sub    $0x24,%esp
+  802047:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80204b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80204f:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  802053:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802057:	8b 54 24 44          	mov    0x44(%esp),%edx
+  80205b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80205f:	8b 44 24 40          	mov    0x40(%esp),%eax
+  802063:	89 d3                	mov    %edx,%ebx
+  802065:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802069:	09 c3                	or     %eax,%ebx
+  80206b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80206f:	0f 84 9c 00 00 00    	je     802111 <__udivmoddi4+0xd1>
+  802075:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80207c:	00 
+  80207d:	31 c0                	xor    %eax,%eax
+  80207f:	31 d2                	xor    %edx,%edx
+  802081:	89 fb                	mov    %edi,%ebx
+  802083:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80208a:	00 
+  80208b:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802090:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802094:	01 c0                	add    %eax,%eax
+  802096:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80209d:	00 
+  80209e:	89 c6                	mov    %eax,%esi
+  8020a0:	89 d7                	mov    %edx,%edi
+  8020a2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8020a6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8020aa:	0f ad d0             	shrd   %cl,%edx,%eax
+  8020ad:	d3 ea                	shr    %cl,%edx
+  8020af:	f6 c1 20             	test   $0x20,%cl
+  8020b2:	0f 45 c2             	cmovne %edx,%eax
+  8020b5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8020b9:	83 e0 01             	and    $0x1,%eax
+  8020bc:	09 fa                	or     %edi,%edx
+  8020be:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8020c2:	89 04 24             	mov    %eax,(%esp)
+  8020c5:	8b 04 24             	mov    (%esp),%eax
+  8020c8:	89 d5                	mov    %edx,%ebp
+  8020ca:	09 f0                	or     %esi,%eax
+  8020cc:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8020d0:	39 f0                	cmp    %esi,%eax
+  8020d2:	19 fd                	sbb    %edi,%ebp
+  8020d4:	72 1d                	jb     8020f3 <__udivmoddi4+0xb3>
+  8020d6:	29 f0                	sub    %esi,%eax
+  8020d8:	19 fa                	sbb    %edi,%edx
+  8020da:	89 cf                	mov    %ecx,%edi
+  8020dc:	c1 ef 05             	shr    $0x5,%edi
+  8020df:	83 e7 01             	and    $0x1,%edi
+  8020e2:	89 fe                	mov    %edi,%esi
+  8020e4:	d3 e7                	shl    %cl,%edi
+  8020e6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8020ea:	83 f6 01             	xor    $0x1,%esi
+  8020ed:	d3 e6                	shl    %cl,%esi
+  8020ef:	09 74 24 18          	or     %esi,0x18(%esp)
+  8020f3:	83 e9 01             	sub    $0x1,%ecx
+  8020f6:	73 98                	jae    802090 <__udivmoddi4+0x50>
+  8020f8:	85 db                	test   %ebx,%ebx
+  8020fa:	74 05                	je     802101 <__udivmoddi4+0xc1>
+  8020fc:	89 03                	mov    %eax,(%ebx)
+  8020fe:	89 53 04             	mov    %edx,0x4(%ebx)
+  802101:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802105:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802109:	83 c4 24             	add    $0x24,%esp
+  80210c:	5b                   	pop    %ebx
+  80210d:	5e                   	pop    %esi
+  80210e:	5f                   	pop    %edi
+  80210f:	5d                   	pop    %ebp
+  802110:	c3                   	ret
+  802111:	85 ff                	test   %edi,%edi
+  802113:	74 0d                	je     802122 <__udivmoddi4+0xe2>
+  802115:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  80211b:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  802122:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802126:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80212a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80212e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802132:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802136:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80213a:	83 c4 24             	add    $0x24,%esp
+  80213d:	5b                   	pop    %ebx
+  80213e:	5e                   	pop    %esi
+  80213f:	5f                   	pop    %edi
+  802140:	5d                   	pop    %ebp
+  802141:	c3                   	ret
+  802142:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802149:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00802150 <__udivdi3>:
+  802150:	57                   	push   %edi
+  802151:	56                   	push   %esi
+  802152:	53                   	push   %ebx
+  802153:	83 ec 20             	sub    $0x20,%esp
+  802156:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80215a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80215e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802162:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802166:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80216a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80216e:	89 d1                	mov    %edx,%ecx
+  802170:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802174:	09 c1                	or     %eax,%ecx
+  802176:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80217a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80217e:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802182:	0f 84 88 00 00 00    	je     802210 <__udivdi3+0xc0>
+  802188:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80218f:	00 
+  802190:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802195:	31 c0                	xor    %eax,%eax
+  802197:	31 d2                	xor    %edx,%edx
+  802199:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8021a0:	00 
+  8021a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8021a8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8021ac:	01 c0                	add    %eax,%eax
+  8021ae:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8021b5:	00 
+  8021b6:	89 c6                	mov    %eax,%esi
+  8021b8:	89 d7                	mov    %edx,%edi
+  8021ba:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8021be:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8021c2:	0f ad d0             	shrd   %cl,%edx,%eax
+  8021c5:	d3 ea                	shr    %cl,%edx
+  8021c7:	f6 c1 20             	test   $0x20,%cl
+  8021ca:	0f 45 c2             	cmovne %edx,%eax
+  8021cd:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8021d1:	83 e0 01             	and    $0x1,%eax
+  8021d4:	09 fa                	or     %edi,%edx
+  8021d6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8021da:	89 04 24             	mov    %eax,(%esp)
+  8021dd:	8b 04 24             	mov    (%esp),%eax
+  8021e0:	89 d3                	mov    %edx,%ebx
+  8021e2:	09 f0                	or     %esi,%eax
+  8021e4:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8021e8:	39 f0                	cmp    %esi,%eax
+  8021ea:	19 fb                	sbb    %edi,%ebx
+  8021ec:	72 1d                	jb     80220b <__udivdi3+0xbb>
+  8021ee:	29 f0                	sub    %esi,%eax
+  8021f0:	19 fa                	sbb    %edi,%edx
+  8021f2:	89 cf                	mov    %ecx,%edi
+  8021f4:	c1 ef 05             	shr    $0x5,%edi
+  8021f7:	83 e7 01             	and    $0x1,%edi
+  8021fa:	89 fe                	mov    %edi,%esi
+  8021fc:	d3 e7                	shl    %cl,%edi
+  8021fe:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802202:	83 f6 01             	xor    $0x1,%esi
+  802205:	d3 e6                	shl    %cl,%esi
+  802207:	09 74 24 18          	or     %esi,0x18(%esp)
+  80220b:	83 e9 01             	sub    $0x1,%ecx
+  80220e:	73 98                	jae    8021a8 <__udivdi3+0x58>
+  802210:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802214:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802218:	83 c4 20             	add    $0x20,%esp
+  80221b:	5b                   	pop    %ebx
+  80221c:	5e                   	pop    %esi
+  80221d:	5f                   	pop    %edi
+  80221e:	c3                   	ret
+  80221f:	90                   	nop
+
+00802220 <__umoddi3>:
+  802220:	57                   	push   %edi
+  802221:	56                   	push   %esi
+  802222:	53                   	push   %ebx
+  802223:	83 ec 18             	sub    $0x18,%esp
+  802226:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80222a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80222e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802232:	8b 54 24 34          	mov    0x34(%esp),%edx
+  802236:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80223a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80223e:	89 d1                	mov    %edx,%ecx
+  802240:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802244:	09 c1                	or     %eax,%ecx
+  802246:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80224a:	74 5b                	je     8022a7 <__umoddi3+0x87>
+  80224c:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802251:	31 c0                	xor    %eax,%eax
+  802253:	31 d2                	xor    %edx,%edx
+  802255:	8d 76 00             	lea    0x0(%esi),%esi
+  802258:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80225c:	01 c0                	add    %eax,%eax
+  80225e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802265:	00 
+  802266:	89 c6                	mov    %eax,%esi
+  802268:	89 d7                	mov    %edx,%edi
+  80226a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80226e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802272:	0f ad d0             	shrd   %cl,%edx,%eax
+  802275:	d3 ea                	shr    %cl,%edx
+  802277:	f6 c1 20             	test   $0x20,%cl
+  80227a:	0f 45 c2             	cmovne %edx,%eax
+  80227d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802281:	83 e0 01             	and    $0x1,%eax
+  802284:	09 fa                	or     %edi,%edx
+  802286:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80228a:	89 04 24             	mov    %eax,(%esp)
+  80228d:	8b 04 24             	mov    (%esp),%eax
+  802290:	89 d3                	mov    %edx,%ebx
+  802292:	09 f0                	or     %esi,%eax
+  802294:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802298:	39 f0                	cmp    %esi,%eax
+  80229a:	19 fb                	sbb    %edi,%ebx
+  80229c:	72 04                	jb     8022a2 <__umoddi3+0x82>
+  80229e:	29 f0                	sub    %esi,%eax
+  8022a0:	19 fa                	sbb    %edi,%edx
+  8022a2:	83 e9 01             	sub    $0x1,%ecx
+  8022a5:	73 b1                	jae    802258 <__umoddi3+0x38>
+  8022a7:	83 c4 18             	add    $0x18,%esp
+  8022aa:	5b                   	pop    %ebx
+  8022ab:	5e                   	pop    %esi
+  8022ac:	5f                   	pop    %edi
+  8022ad:	c3                   	ret
+  8022ae:	66 90                	xchg   %ax,%ax
+
+008022b0 <__divdi3>:
+  8022b0:	55                   	push   %ebp
+  8022b1:	57                   	push   %edi
+  8022b2:	56                   	push   %esi
+  8022b3:	53                   	push   %ebx
+  8022b4:	83 ec 24             	sub    $0x24,%esp
+  8022b7:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  8022bb:	8b 74 24 44          	mov    0x44(%esp),%esi
+  8022bf:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8022c3:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8022c7:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  8022cb:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8022cf:	85 d2                	test   %edx,%edx
+  8022d1:	0f 88 e0 00 00 00    	js     8023b7 <__divdi3+0x107>
+  8022d7:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  8022db:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  8022df:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8022e3:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8022e7:	85 f6                	test   %esi,%esi
+  8022e9:	78 16                	js     802301 <__divdi3+0x51>
+  8022eb:	89 f1                	mov    %esi,%ecx
+  8022ed:	31 c0                	xor    %eax,%eax
+  8022ef:	31 d2                	xor    %edx,%edx
+  8022f1:	09 d9                	or     %ebx,%ecx
+  8022f3:	0f 85 f3 00 00 00    	jne    8023ec <__divdi3+0x13c>
+  8022f9:	83 c4 24             	add    $0x24,%esp
+  8022fc:	5b                   	pop    %ebx
+  8022fd:	5e                   	pop    %esi
+  8022fe:	5f                   	pop    %edi
+  8022ff:	5d                   	pop    %ebp
+  802300:	c3                   	ret
+  802301:	bf 01 00 00 00       	mov    $0x1,%edi
+  802306:	f7 5c 24 08          	negl   0x8(%esp)
+  80230a:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  80230f:	f7 5c 24 0c          	negl   0xc(%esp)
+  802313:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80231a:	00 
+  80231b:	31 c0                	xor    %eax,%eax
+  80231d:	31 d2                	xor    %edx,%edx
+  80231f:	89 fb                	mov    %edi,%ebx
+  802321:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802328:	00 
+  802329:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80232e:	66 90                	xchg   %ax,%ax
+  802330:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802334:	01 c0                	add    %eax,%eax
+  802336:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80233d:	00 
+  80233e:	89 c6                	mov    %eax,%esi
+  802340:	89 d7                	mov    %edx,%edi
+  802342:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802346:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80234a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80234d:	d3 ea                	shr    %cl,%edx
+  80234f:	f6 c1 20             	test   $0x20,%cl
+  802352:	0f 45 c2             	cmovne %edx,%eax
+  802355:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802359:	83 e0 01             	and    $0x1,%eax
+  80235c:	09 fa                	or     %edi,%edx
+  80235e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802362:	89 04 24             	mov    %eax,(%esp)
+  802365:	8b 04 24             	mov    (%esp),%eax
+  802368:	89 d5                	mov    %edx,%ebp
+  80236a:	09 f0                	or     %esi,%eax
+  80236c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802370:	39 f0                	cmp    %esi,%eax
+  802372:	19 fd                	sbb    %edi,%ebp
+  802374:	72 1d                	jb     802393 <__divdi3+0xe3>
+  802376:	29 f0                	sub    %esi,%eax
+  802378:	19 fa                	sbb    %edi,%edx
+  80237a:	89 cf                	mov    %ecx,%edi
+  80237c:	c1 ef 05             	shr    $0x5,%edi
+  80237f:	83 e7 01             	and    $0x1,%edi
+  802382:	89 fe                	mov    %edi,%esi
+  802384:	d3 e7                	shl    %cl,%edi
+  802386:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80238a:	83 f6 01             	xor    $0x1,%esi
+  80238d:	d3 e6                	shl    %cl,%esi
+  80238f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802393:	83 e9 01             	sub    $0x1,%ecx
+  802396:	73 98                	jae    802330 <__divdi3+0x80>
+  802398:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80239c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8023a0:	85 db                	test   %ebx,%ebx
+  8023a2:	0f 84 51 ff ff ff    	je     8022f9 <__divdi3+0x49>
+  8023a8:	f7 d8                	neg    %eax
+  8023aa:	83 d2 00             	adc    $0x0,%edx
+  8023ad:	83 c4 24             	add    $0x24,%esp
+  8023b0:	5b                   	pop    %ebx
+  8023b1:	f7 da                	neg    %edx
+  8023b3:	5e                   	pop    %esi
+  8023b4:	5f                   	pop    %edi
+  8023b5:	5d                   	pop    %ebp
+  8023b6:	c3                   	ret
+  8023b7:	f7 d8                	neg    %eax
+  8023b9:	83 d2 00             	adc    $0x0,%edx
+  8023bc:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8023c0:	f7 da                	neg    %edx
+  8023c2:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8023c6:	85 f6                	test   %esi,%esi
+  8023c8:	78 1b                	js     8023e5 <__divdi3+0x135>
+  8023ca:	89 f1                	mov    %esi,%ecx
+  8023cc:	31 c0                	xor    %eax,%eax
+  8023ce:	31 d2                	xor    %edx,%edx
+  8023d0:	bf 01 00 00 00       	mov    $0x1,%edi
+  8023d5:	09 d9                	or     %ebx,%ecx
+  8023d7:	0f 85 36 ff ff ff    	jne    802313 <__divdi3+0x63>
+  8023dd:	83 c4 24             	add    $0x24,%esp
+  8023e0:	5b                   	pop    %ebx
+  8023e1:	5e                   	pop    %esi
+  8023e2:	5f                   	pop    %edi
+  8023e3:	5d                   	pop    %ebp
+  8023e4:	c3                   	ret
+  8023e5:	31 ff                	xor    %edi,%edi
+  8023e7:	e9 1a ff ff ff       	jmp    802306 <__divdi3+0x56>
+  8023ec:	31 ff                	xor    %edi,%edi
+  8023ee:	e9 20 ff ff ff       	jmp    802313 <__divdi3+0x63>
+  8023f3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8023fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00802400 <__moddi3>:
+  802400:	55                   	push   %ebp
+  802401:	57                   	push   %edi
+  802402:	56                   	push   %esi
+  802403:	53                   	push   %ebx
+  802404:	83 ec 1c             	sub    $0x1c,%esp
+  802407:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  80240b:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  80240f:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  802413:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  802417:	89 c8                	mov    %ecx,%eax
+  802419:	89 f2                	mov    %esi,%edx
+  80241b:	89 f3                	mov    %esi,%ebx
+  80241d:	85 ed                	test   %ebp,%ebp
+  80241f:	0f 88 9d 00 00 00    	js     8024c2 <__moddi3+0xc2>
+  802425:	09 cb                	or     %ecx,%ebx
+  802427:	0f 84 8d 00 00 00    	je     8024ba <__moddi3+0xba>
+  80242d:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802431:	31 db                	xor    %ebx,%ebx
+  802433:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802437:	89 ca                	mov    %ecx,%edx
+  802439:	89 f0                	mov    %esi,%eax
+  80243b:	89 dd                	mov    %ebx,%ebp
+  80243d:	f7 da                	neg    %edx
+  80243f:	83 d0 00             	adc    $0x0,%eax
+  802442:	f7 d8                	neg    %eax
+  802444:	0f 49 f0             	cmovns %eax,%esi
+  802447:	0f 49 ca             	cmovns %edx,%ecx
+  80244a:	31 c0                	xor    %eax,%eax
+  80244c:	31 d2                	xor    %edx,%edx
+  80244e:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802452:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802456:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80245b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80245f:	90                   	nop
+  802460:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802464:	01 c0                	add    %eax,%eax
+  802466:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80246d:	00 
+  80246e:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  802472:	89 c6                	mov    %eax,%esi
+  802474:	89 d7                	mov    %edx,%edi
+  802476:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80247a:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80247e:	0f ad d0             	shrd   %cl,%edx,%eax
+  802481:	d3 ea                	shr    %cl,%edx
+  802483:	f6 c1 20             	test   $0x20,%cl
+  802486:	0f 45 c2             	cmovne %edx,%eax
+  802489:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80248d:	83 e0 01             	and    $0x1,%eax
+  802490:	09 fa                	or     %edi,%edx
+  802492:	89 04 24             	mov    %eax,(%esp)
+  802495:	8b 04 24             	mov    (%esp),%eax
+  802498:	89 d7                	mov    %edx,%edi
+  80249a:	09 f0                	or     %esi,%eax
+  80249c:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  8024a0:	39 d8                	cmp    %ebx,%eax
+  8024a2:	19 f7                	sbb    %esi,%edi
+  8024a4:	72 04                	jb     8024aa <__moddi3+0xaa>
+  8024a6:	29 d8                	sub    %ebx,%eax
+  8024a8:	19 f2                	sbb    %esi,%edx
+  8024aa:	83 e9 01             	sub    $0x1,%ecx
+  8024ad:	73 b1                	jae    802460 <__moddi3+0x60>
+  8024af:	85 ed                	test   %ebp,%ebp
+  8024b1:	74 07                	je     8024ba <__moddi3+0xba>
+  8024b3:	f7 d8                	neg    %eax
+  8024b5:	83 d2 00             	adc    $0x0,%edx
+  8024b8:	f7 da                	neg    %edx
+  8024ba:	83 c4 1c             	add    $0x1c,%esp
+  8024bd:	5b                   	pop    %ebx
+  8024be:	5e                   	pop    %esi
+  8024bf:	5f                   	pop    %edi
+  8024c0:	5d                   	pop    %ebp
+  8024c1:	c3                   	ret
+  8024c2:	09 cb                	or     %ecx,%ebx
+  8024c4:	74 f4                	je     8024ba <__moddi3+0xba>
+  8024c6:	f7 df                	neg    %edi
+  8024c8:	bb 01 00 00 00       	mov    $0x1,%ebx
+  8024cd:	83 d5 00             	adc    $0x0,%ebp
+  8024d0:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  8024d4:	f7 dd                	neg    %ebp
+  8024d6:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  8024da:	e9 58 ff ff ff       	jmp    802437 <__moddi3+0x37>
@@ -0,0 +1,5841 @@
+
+obj/user/spawnhello.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 4a 00 00 00       	call   80007b <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	int r;
+	cprintf("i am parent environment %08x\n", thisenv->env_id);
+  800039:	a1 08 50 80 00       	mov    0x805008,%eax
+  80003e:	8b 40 48             	mov    0x48(%eax),%eax
+  800041:	50                   	push   %eax
+  800042:	68 20 2b 80 00       	push   $0x802b20
+  800047:	e8 6d 01 00 00       	call   8001b9 <cprintf>
+	if ((r = spawnl("hello", "hello", 0)) < 0)
+  80004c:	83 c4 0c             	add    $0xc,%esp
+  80004f:	6a 00                	push   $0x0
+  800051:	68 3e 2b 80 00       	push   $0x802b3e
+  800056:	68 3e 2b 80 00       	push   $0x802b3e
+  80005b:	e8 25 1b 00 00       	call   801b85 <spawnl>
+  800060:	83 c4 10             	add    $0x10,%esp
+  800063:	85 c0                	test   %eax,%eax
+  800065:	78 02                	js     800069 <umain+0x36>
+		panic("spawn(hello) failed: %e", r);
+}
+  800067:	c9                   	leave
+  800068:	c3                   	ret
+		panic("spawn(hello) failed: %e", r);
+  800069:	50                   	push   %eax
+  80006a:	68 44 2b 80 00       	push   $0x802b44
+  80006f:	6a 09                	push   $0x9
+  800071:	68 5c 2b 80 00       	push   $0x802b5c
+  800076:	e8 63 00 00 00       	call   8000de <_panic>
+
+0080007b <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  80007b:	55                   	push   %ebp
+  80007c:	89 e5                	mov    %esp,%ebp
+  80007e:	56                   	push   %esi
+  80007f:	53                   	push   %ebx
+  800080:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800083:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  800086:	e8 95 0a 00 00       	call   800b20 <sys_getenvid>
+  80008b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800090:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800093:	c1 e0 04             	shl    $0x4,%eax
+  800096:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80009b:	a3 08 50 80 00       	mov    %eax,0x805008
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8000a0:	85 db                	test   %ebx,%ebx
+  8000a2:	7e 07                	jle    8000ab <libmain+0x30>
+    binaryname = argv[0];
+  8000a4:	8b 06                	mov    (%esi),%eax
+  8000a6:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  8000ab:	83 ec 08             	sub    $0x8,%esp
+  8000ae:	56                   	push   %esi
+  8000af:	53                   	push   %ebx
+  8000b0:	e8 7e ff ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  8000b5:	e8 0a 00 00 00       	call   8000c4 <exit>
+}
+  8000ba:	83 c4 10             	add    $0x10,%esp
+  8000bd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000c0:	5b                   	pop    %ebx
+  8000c1:	5e                   	pop    %esi
+  8000c2:	5d                   	pop    %ebp
+  8000c3:	c3                   	ret
+
+008000c4 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000c4:	55                   	push   %ebp
+  8000c5:	89 e5                	mov    %esp,%ebp
+  8000c7:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8000ca:	e8 36 0f 00 00       	call   801005 <close_all>
+	sys_env_destroy(0);
+  8000cf:	83 ec 0c             	sub    $0xc,%esp
+  8000d2:	6a 00                	push   $0x0
+  8000d4:	e8 06 0a 00 00       	call   800adf <sys_env_destroy>
+}
+  8000d9:	83 c4 10             	add    $0x10,%esp
+  8000dc:	c9                   	leave
+  8000dd:	c3                   	ret
+
+008000de <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8000de:	55                   	push   %ebp
+  8000df:	89 e5                	mov    %esp,%ebp
+  8000e1:	56                   	push   %esi
+  8000e2:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8000e3:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8000e6:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  8000ec:	e8 2f 0a 00 00       	call   800b20 <sys_getenvid>
+  8000f1:	83 ec 0c             	sub    $0xc,%esp
+  8000f4:	ff 75 0c             	push   0xc(%ebp)
+  8000f7:	ff 75 08             	push   0x8(%ebp)
+  8000fa:	56                   	push   %esi
+  8000fb:	50                   	push   %eax
+  8000fc:	68 78 2b 80 00       	push   $0x802b78
+  800101:	e8 b3 00 00 00       	call   8001b9 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800106:	83 c4 18             	add    $0x18,%esp
+  800109:	53                   	push   %ebx
+  80010a:	ff 75 10             	push   0x10(%ebp)
+  80010d:	e8 56 00 00 00       	call   800168 <vcprintf>
+	cprintf("\n");
+  800112:	c7 04 24 a7 30 80 00 	movl   $0x8030a7,(%esp)
+  800119:	e8 9b 00 00 00       	call   8001b9 <cprintf>
+  80011e:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800121:	cc                   	int3
+	while (1)
+  800122:	eb fd                	jmp    800121 <_panic+0x43>
+
+00800124 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800124:	55                   	push   %ebp
+  800125:	89 e5                	mov    %esp,%ebp
+  800127:	53                   	push   %ebx
+  800128:	83 ec 04             	sub    $0x4,%esp
+  80012b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80012e:	8b 13                	mov    (%ebx),%edx
+  800130:	8d 42 01             	lea    0x1(%edx),%eax
+  800133:	89 03                	mov    %eax,(%ebx)
+  800135:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800138:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80013c:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800141:	74 09                	je     80014c <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800143:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800147:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80014a:	c9                   	leave
+  80014b:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80014c:	83 ec 08             	sub    $0x8,%esp
+  80014f:	68 ff 00 00 00       	push   $0xff
+  800154:	8d 43 08             	lea    0x8(%ebx),%eax
+  800157:	50                   	push   %eax
+  800158:	e8 45 09 00 00       	call   800aa2 <sys_cputs>
+		b->idx = 0;
+  80015d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800163:	83 c4 10             	add    $0x10,%esp
+  800166:	eb db                	jmp    800143 <putch+0x1f>
+
+00800168 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800168:	55                   	push   %ebp
+  800169:	89 e5                	mov    %esp,%ebp
+  80016b:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800171:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800178:	00 00 00 
+	b.cnt = 0;
+  80017b:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800182:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800185:	ff 75 0c             	push   0xc(%ebp)
+  800188:	ff 75 08             	push   0x8(%ebp)
+  80018b:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800191:	50                   	push   %eax
+  800192:	68 24 01 80 00       	push   $0x800124
+  800197:	e8 14 01 00 00       	call   8002b0 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80019c:	83 c4 08             	add    $0x8,%esp
+  80019f:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001a5:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001ab:	50                   	push   %eax
+  8001ac:	e8 f1 08 00 00       	call   800aa2 <sys_cputs>
+
+	return b.cnt;
+}
+  8001b1:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001b7:	c9                   	leave
+  8001b8:	c3                   	ret
+
+008001b9 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001b9:	55                   	push   %ebp
+  8001ba:	89 e5                	mov    %esp,%ebp
+  8001bc:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8001bf:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8001c2:	50                   	push   %eax
+  8001c3:	ff 75 08             	push   0x8(%ebp)
+  8001c6:	e8 9d ff ff ff       	call   800168 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8001cb:	c9                   	leave
+  8001cc:	c3                   	ret
+
+008001cd <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8001cd:	55                   	push   %ebp
+  8001ce:	89 e5                	mov    %esp,%ebp
+  8001d0:	57                   	push   %edi
+  8001d1:	56                   	push   %esi
+  8001d2:	53                   	push   %ebx
+  8001d3:	83 ec 1c             	sub    $0x1c,%esp
+  8001d6:	89 c7                	mov    %eax,%edi
+  8001d8:	89 d6                	mov    %edx,%esi
+  8001da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001dd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001e0:	89 d1                	mov    %edx,%ecx
+  8001e2:	89 c2                	mov    %eax,%edx
+  8001e4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001e7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001ea:	8b 45 10             	mov    0x10(%ebp),%eax
+  8001ed:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8001f0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001f3:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8001fa:	39 c2                	cmp    %eax,%edx
+  8001fc:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8001ff:	72 3e                	jb     80023f <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800201:	83 ec 0c             	sub    $0xc,%esp
+  800204:	ff 75 18             	push   0x18(%ebp)
+  800207:	83 eb 01             	sub    $0x1,%ebx
+  80020a:	53                   	push   %ebx
+  80020b:	50                   	push   %eax
+  80020c:	83 ec 08             	sub    $0x8,%esp
+  80020f:	ff 75 e4             	push   -0x1c(%ebp)
+  800212:	ff 75 e0             	push   -0x20(%ebp)
+  800215:	ff 75 dc             	push   -0x24(%ebp)
+  800218:	ff 75 d8             	push   -0x28(%ebp)
+  80021b:	e8 60 25 00 00       	call   802780 <__udivdi3>
+  800220:	83 c4 18             	add    $0x18,%esp
+  800223:	52                   	push   %edx
+  800224:	50                   	push   %eax
+  800225:	89 f2                	mov    %esi,%edx
+  800227:	89 f8                	mov    %edi,%eax
+  800229:	e8 9f ff ff ff       	call   8001cd <printnum>
+  80022e:	83 c4 20             	add    $0x20,%esp
+  800231:	eb 13                	jmp    800246 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800233:	83 ec 08             	sub    $0x8,%esp
+  800236:	56                   	push   %esi
+  800237:	ff 75 18             	push   0x18(%ebp)
+  80023a:	ff d7                	call   *%edi
+  80023c:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80023f:	83 eb 01             	sub    $0x1,%ebx
+  800242:	85 db                	test   %ebx,%ebx
+  800244:	7f ed                	jg     800233 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800246:	83 ec 08             	sub    $0x8,%esp
+  800249:	56                   	push   %esi
+  80024a:	83 ec 04             	sub    $0x4,%esp
+  80024d:	ff 75 e4             	push   -0x1c(%ebp)
+  800250:	ff 75 e0             	push   -0x20(%ebp)
+  800253:	ff 75 dc             	push   -0x24(%ebp)
+  800256:	ff 75 d8             	push   -0x28(%ebp)
+  800259:	e8 f2 25 00 00       	call   802850 <__umoddi3>
+  80025e:	83 c4 14             	add    $0x14,%esp
+  800261:	0f be 80 9b 2b 80 00 	movsbl 0x802b9b(%eax),%eax
+  800268:	50                   	push   %eax
+  800269:	ff d7                	call   *%edi
+}
+  80026b:	83 c4 10             	add    $0x10,%esp
+  80026e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800271:	5b                   	pop    %ebx
+  800272:	5e                   	pop    %esi
+  800273:	5f                   	pop    %edi
+  800274:	5d                   	pop    %ebp
+  800275:	c3                   	ret
+
+00800276 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800276:	55                   	push   %ebp
+  800277:	89 e5                	mov    %esp,%ebp
+  800279:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80027c:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800280:	8b 10                	mov    (%eax),%edx
+  800282:	3b 50 04             	cmp    0x4(%eax),%edx
+  800285:	73 0a                	jae    800291 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800287:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80028a:	89 08                	mov    %ecx,(%eax)
+  80028c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80028f:	88 02                	mov    %al,(%edx)
+}
+  800291:	5d                   	pop    %ebp
+  800292:	c3                   	ret
+
+00800293 <printfmt>:
+{
+  800293:	55                   	push   %ebp
+  800294:	89 e5                	mov    %esp,%ebp
+  800296:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800299:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80029c:	50                   	push   %eax
+  80029d:	ff 75 10             	push   0x10(%ebp)
+  8002a0:	ff 75 0c             	push   0xc(%ebp)
+  8002a3:	ff 75 08             	push   0x8(%ebp)
+  8002a6:	e8 05 00 00 00       	call   8002b0 <vprintfmt>
+}
+  8002ab:	83 c4 10             	add    $0x10,%esp
+  8002ae:	c9                   	leave
+  8002af:	c3                   	ret
+
+008002b0 <vprintfmt>:
+{
+  8002b0:	55                   	push   %ebp
+  8002b1:	89 e5                	mov    %esp,%ebp
+  8002b3:	57                   	push   %edi
+  8002b4:	56                   	push   %esi
+  8002b5:	53                   	push   %ebx
+  8002b6:	83 ec 2c             	sub    $0x2c,%esp
+  8002b9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8002bc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8002bf:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8002c2:	eb 0a                	jmp    8002ce <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8002c4:	83 ec 08             	sub    $0x8,%esp
+  8002c7:	53                   	push   %ebx
+  8002c8:	50                   	push   %eax
+  8002c9:	ff d6                	call   *%esi
+  8002cb:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8002ce:	83 c7 01             	add    $0x1,%edi
+  8002d1:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8002d5:	83 f8 25             	cmp    $0x25,%eax
+  8002d8:	74 0c                	je     8002e6 <vprintfmt+0x36>
+			if (ch == '\0')
+  8002da:	85 c0                	test   %eax,%eax
+  8002dc:	75 e6                	jne    8002c4 <vprintfmt+0x14>
+}
+  8002de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002e1:	5b                   	pop    %ebx
+  8002e2:	5e                   	pop    %esi
+  8002e3:	5f                   	pop    %edi
+  8002e4:	5d                   	pop    %ebp
+  8002e5:	c3                   	ret
+		padc = ' ';
+  8002e6:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8002ea:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8002f1:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8002f8:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8002ff:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800304:	8d 47 01             	lea    0x1(%edi),%eax
+  800307:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80030a:	0f b6 17             	movzbl (%edi),%edx
+  80030d:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800310:	3c 55                	cmp    $0x55,%al
+  800312:	0f 87 9a 03 00 00    	ja     8006b2 <vprintfmt+0x402>
+  800318:	0f b6 c0             	movzbl %al,%eax
+  80031b:	ff 24 85 e0 2c 80 00 	jmp    *0x802ce0(,%eax,4)
+  800322:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800325:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800329:	eb d9                	jmp    800304 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80032b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80032e:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800332:	eb d0                	jmp    800304 <vprintfmt+0x54>
+  800334:	0f b6 d2             	movzbl %dl,%edx
+  800337:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80033a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80033f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800342:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800345:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800349:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80034c:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80034f:	83 f9 09             	cmp    $0x9,%ecx
+  800352:	77 55                	ja     8003a9 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800354:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800357:	eb e9                	jmp    800342 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800359:	8b 45 14             	mov    0x14(%ebp),%eax
+  80035c:	8b 00                	mov    (%eax),%eax
+  80035e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800361:	8b 45 14             	mov    0x14(%ebp),%eax
+  800364:	8d 40 04             	lea    0x4(%eax),%eax
+  800367:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80036a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80036d:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800371:	79 91                	jns    800304 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800373:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800376:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800379:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800380:	eb 82                	jmp    800304 <vprintfmt+0x54>
+			if (width < 0)
+  800382:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800385:	85 d2                	test   %edx,%edx
+  800387:	b8 00 00 00 00       	mov    $0x0,%eax
+  80038c:	0f 49 c2             	cmovns %edx,%eax
+  80038f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800392:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800395:	e9 6a ff ff ff       	jmp    800304 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80039a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80039d:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8003a4:	e9 5b ff ff ff       	jmp    800304 <vprintfmt+0x54>
+  8003a9:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003ac:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003af:	eb bc                	jmp    80036d <vprintfmt+0xbd>
+			lflag++;
+  8003b1:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003b4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003b7:	e9 48 ff ff ff       	jmp    800304 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8003bc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003bf:	8d 78 04             	lea    0x4(%eax),%edi
+  8003c2:	83 ec 08             	sub    $0x8,%esp
+  8003c5:	53                   	push   %ebx
+  8003c6:	ff 30                	push   (%eax)
+  8003c8:	ff d6                	call   *%esi
+			break;
+  8003ca:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8003cd:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8003d0:	e9 7c 02 00 00       	jmp    800651 <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  8003d5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003d8:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8003db:	8b 10                	mov    (%eax),%edx
+  8003dd:	89 d0                	mov    %edx,%eax
+  8003df:	f7 d8                	neg    %eax
+  8003e1:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8003e4:	83 f8 10             	cmp    $0x10,%eax
+  8003e7:	7f 23                	jg     80040c <vprintfmt+0x15c>
+  8003e9:	8b 14 85 40 2e 80 00 	mov    0x802e40(,%eax,4),%edx
+  8003f0:	85 d2                	test   %edx,%edx
+  8003f2:	74 18                	je     80040c <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8003f4:	52                   	push   %edx
+  8003f5:	68 79 2f 80 00       	push   $0x802f79
+  8003fa:	53                   	push   %ebx
+  8003fb:	56                   	push   %esi
+  8003fc:	e8 92 fe ff ff       	call   800293 <printfmt>
+  800401:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800404:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800407:	e9 45 02 00 00       	jmp    800651 <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  80040c:	50                   	push   %eax
+  80040d:	68 b3 2b 80 00       	push   $0x802bb3
+  800412:	53                   	push   %ebx
+  800413:	56                   	push   %esi
+  800414:	e8 7a fe ff ff       	call   800293 <printfmt>
+  800419:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80041c:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80041f:	e9 2d 02 00 00       	jmp    800651 <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800424:	8b 45 14             	mov    0x14(%ebp),%eax
+  800427:	83 c0 04             	add    $0x4,%eax
+  80042a:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80042d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800430:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800432:	85 c9                	test   %ecx,%ecx
+  800434:	b8 ac 2b 80 00       	mov    $0x802bac,%eax
+  800439:	0f 45 c1             	cmovne %ecx,%eax
+  80043c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80043f:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800443:	7e 06                	jle    80044b <vprintfmt+0x19b>
+  800445:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800449:	75 0b                	jne    800456 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80044b:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80044e:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800451:	89 75 08             	mov    %esi,0x8(%ebp)
+  800454:	eb 5c                	jmp    8004b2 <vprintfmt+0x202>
+  800456:	83 ec 08             	sub    $0x8,%esp
+  800459:	ff 75 d0             	push   -0x30(%ebp)
+  80045c:	ff 75 cc             	push   -0x34(%ebp)
+  80045f:	e8 eb 02 00 00       	call   80074f <strnlen>
+  800464:	89 c2                	mov    %eax,%edx
+  800466:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800469:	29 d0                	sub    %edx,%eax
+  80046b:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80046e:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800472:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800475:	89 75 08             	mov    %esi,0x8(%ebp)
+  800478:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80047a:	eb 0e                	jmp    80048a <vprintfmt+0x1da>
+					putch(padc, putdat);
+  80047c:	83 ec 08             	sub    $0x8,%esp
+  80047f:	53                   	push   %ebx
+  800480:	57                   	push   %edi
+  800481:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800484:	83 ee 01             	sub    $0x1,%esi
+  800487:	83 c4 10             	add    $0x10,%esp
+  80048a:	85 f6                	test   %esi,%esi
+  80048c:	7f ee                	jg     80047c <vprintfmt+0x1cc>
+  80048e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800491:	8b 75 08             	mov    0x8(%ebp),%esi
+  800494:	85 c0                	test   %eax,%eax
+  800496:	ba 00 00 00 00       	mov    $0x0,%edx
+  80049b:	0f 49 d0             	cmovns %eax,%edx
+  80049e:	29 d0                	sub    %edx,%eax
+  8004a0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004a3:	eb a6                	jmp    80044b <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8004a5:	83 ec 08             	sub    $0x8,%esp
+  8004a8:	53                   	push   %ebx
+  8004a9:	52                   	push   %edx
+  8004aa:	ff 55 08             	call   *0x8(%ebp)
+  8004ad:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004b0:	89 f1                	mov    %esi,%ecx
+  8004b2:	8d 71 01             	lea    0x1(%ecx),%esi
+  8004b5:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004b9:	0f be d0             	movsbl %al,%edx
+  8004bc:	85 d2                	test   %edx,%edx
+  8004be:	74 28                	je     8004e8 <vprintfmt+0x238>
+  8004c0:	85 ff                	test   %edi,%edi
+  8004c2:	78 05                	js     8004c9 <vprintfmt+0x219>
+  8004c4:	83 ef 01             	sub    $0x1,%edi
+  8004c7:	78 30                	js     8004f9 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8004c9:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8004cd:	74 d6                	je     8004a5 <vprintfmt+0x1f5>
+  8004cf:	0f be c0             	movsbl %al,%eax
+  8004d2:	83 e8 20             	sub    $0x20,%eax
+  8004d5:	83 f8 5e             	cmp    $0x5e,%eax
+  8004d8:	76 cb                	jbe    8004a5 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8004da:	83 ec 08             	sub    $0x8,%esp
+  8004dd:	53                   	push   %ebx
+  8004de:	6a 3f                	push   $0x3f
+  8004e0:	ff 55 08             	call   *0x8(%ebp)
+  8004e3:	83 c4 10             	add    $0x10,%esp
+  8004e6:	eb c8                	jmp    8004b0 <vprintfmt+0x200>
+  8004e8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004eb:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8004ee:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004f1:	01 d0                	add    %edx,%eax
+  8004f3:	29 c8                	sub    %ecx,%eax
+  8004f5:	89 c7                	mov    %eax,%edi
+  8004f7:	eb 13                	jmp    80050c <vprintfmt+0x25c>
+  8004f9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004fc:	eb ed                	jmp    8004eb <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8004fe:	83 ec 08             	sub    $0x8,%esp
+  800501:	53                   	push   %ebx
+  800502:	6a 20                	push   $0x20
+  800504:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800506:	83 ef 01             	sub    $0x1,%edi
+  800509:	83 c4 10             	add    $0x10,%esp
+  80050c:	85 ff                	test   %edi,%edi
+  80050e:	7f ee                	jg     8004fe <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800510:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800513:	89 45 14             	mov    %eax,0x14(%ebp)
+  800516:	e9 36 01 00 00       	jmp    800651 <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  80051b:	83 f9 01             	cmp    $0x1,%ecx
+  80051e:	7f 1f                	jg     80053f <vprintfmt+0x28f>
+	else if (lflag)
+  800520:	85 c9                	test   %ecx,%ecx
+  800522:	74 67                	je     80058b <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800524:	8b 45 14             	mov    0x14(%ebp),%eax
+  800527:	8b 00                	mov    (%eax),%eax
+  800529:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80052c:	89 c1                	mov    %eax,%ecx
+  80052e:	c1 f9 1f             	sar    $0x1f,%ecx
+  800531:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800534:	8b 45 14             	mov    0x14(%ebp),%eax
+  800537:	8d 40 04             	lea    0x4(%eax),%eax
+  80053a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80053d:	eb 17                	jmp    800556 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  80053f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800542:	8b 50 04             	mov    0x4(%eax),%edx
+  800545:	8b 00                	mov    (%eax),%eax
+  800547:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80054a:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80054d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800550:	8d 40 08             	lea    0x8(%eax),%eax
+  800553:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800556:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800559:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80055c:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800561:	85 c9                	test   %ecx,%ecx
+  800563:	0f 89 ce 00 00 00    	jns    800637 <vprintfmt+0x387>
+				putch('-', putdat);
+  800569:	83 ec 08             	sub    $0x8,%esp
+  80056c:	53                   	push   %ebx
+  80056d:	6a 2d                	push   $0x2d
+  80056f:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800571:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800574:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800577:	f7 da                	neg    %edx
+  800579:	83 d1 00             	adc    $0x0,%ecx
+  80057c:	f7 d9                	neg    %ecx
+  80057e:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800581:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800586:	e9 ac 00 00 00       	jmp    800637 <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  80058b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058e:	8b 00                	mov    (%eax),%eax
+  800590:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800593:	89 c1                	mov    %eax,%ecx
+  800595:	c1 f9 1f             	sar    $0x1f,%ecx
+  800598:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80059b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059e:	8d 40 04             	lea    0x4(%eax),%eax
+  8005a1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005a4:	eb b0                	jmp    800556 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8005a6:	83 f9 01             	cmp    $0x1,%ecx
+  8005a9:	7f 1b                	jg     8005c6 <vprintfmt+0x316>
+	else if (lflag)
+  8005ab:	85 c9                	test   %ecx,%ecx
+  8005ad:	74 2c                	je     8005db <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  8005af:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b2:	8b 10                	mov    (%eax),%edx
+  8005b4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005b9:	8d 40 04             	lea    0x4(%eax),%eax
+  8005bc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005bf:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8005c4:	eb 71                	jmp    800637 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  8005c6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c9:	8b 10                	mov    (%eax),%edx
+  8005cb:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005ce:	8d 40 08             	lea    0x8(%eax),%eax
+  8005d1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005d4:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8005d9:	eb 5c                	jmp    800637 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  8005db:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005de:	8b 10                	mov    (%eax),%edx
+  8005e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005e5:	8d 40 04             	lea    0x4(%eax),%eax
+  8005e8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005eb:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8005f0:	eb 45                	jmp    800637 <vprintfmt+0x387>
+			putch('X', putdat);
+  8005f2:	83 ec 08             	sub    $0x8,%esp
+  8005f5:	53                   	push   %ebx
+  8005f6:	6a 58                	push   $0x58
+  8005f8:	ff d6                	call   *%esi
+			putch('X', putdat);
+  8005fa:	83 c4 08             	add    $0x8,%esp
+  8005fd:	53                   	push   %ebx
+  8005fe:	6a 58                	push   $0x58
+  800600:	ff d6                	call   *%esi
+			putch('X', putdat);
+  800602:	83 c4 08             	add    $0x8,%esp
+  800605:	53                   	push   %ebx
+  800606:	6a 58                	push   $0x58
+  800608:	ff d6                	call   *%esi
+			break;
+  80060a:	83 c4 10             	add    $0x10,%esp
+  80060d:	eb 42                	jmp    800651 <vprintfmt+0x3a1>
+			putch('0', putdat);
+  80060f:	83 ec 08             	sub    $0x8,%esp
+  800612:	53                   	push   %ebx
+  800613:	6a 30                	push   $0x30
+  800615:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800617:	83 c4 08             	add    $0x8,%esp
+  80061a:	53                   	push   %ebx
+  80061b:	6a 78                	push   $0x78
+  80061d:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  80061f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800622:	8b 10                	mov    (%eax),%edx
+  800624:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800629:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80062c:	8d 40 04             	lea    0x4(%eax),%eax
+  80062f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800632:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800637:	83 ec 0c             	sub    $0xc,%esp
+  80063a:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80063e:	50                   	push   %eax
+  80063f:	ff 75 e0             	push   -0x20(%ebp)
+  800642:	57                   	push   %edi
+  800643:	51                   	push   %ecx
+  800644:	52                   	push   %edx
+  800645:	89 da                	mov    %ebx,%edx
+  800647:	89 f0                	mov    %esi,%eax
+  800649:	e8 7f fb ff ff       	call   8001cd <printnum>
+			break;
+  80064e:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800651:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800654:	e9 75 fc ff ff       	jmp    8002ce <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800659:	83 f9 01             	cmp    $0x1,%ecx
+  80065c:	7f 1b                	jg     800679 <vprintfmt+0x3c9>
+	else if (lflag)
+  80065e:	85 c9                	test   %ecx,%ecx
+  800660:	74 2c                	je     80068e <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  800662:	8b 45 14             	mov    0x14(%ebp),%eax
+  800665:	8b 10                	mov    (%eax),%edx
+  800667:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80066c:	8d 40 04             	lea    0x4(%eax),%eax
+  80066f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800672:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800677:	eb be                	jmp    800637 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  800679:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067c:	8b 10                	mov    (%eax),%edx
+  80067e:	8b 48 04             	mov    0x4(%eax),%ecx
+  800681:	8d 40 08             	lea    0x8(%eax),%eax
+  800684:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800687:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80068c:	eb a9                	jmp    800637 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  80068e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800691:	8b 10                	mov    (%eax),%edx
+  800693:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800698:	8d 40 04             	lea    0x4(%eax),%eax
+  80069b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80069e:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8006a3:	eb 92                	jmp    800637 <vprintfmt+0x387>
+			putch(ch, putdat);
+  8006a5:	83 ec 08             	sub    $0x8,%esp
+  8006a8:	53                   	push   %ebx
+  8006a9:	6a 25                	push   $0x25
+  8006ab:	ff d6                	call   *%esi
+			break;
+  8006ad:	83 c4 10             	add    $0x10,%esp
+  8006b0:	eb 9f                	jmp    800651 <vprintfmt+0x3a1>
+			putch('%', putdat);
+  8006b2:	83 ec 08             	sub    $0x8,%esp
+  8006b5:	53                   	push   %ebx
+  8006b6:	6a 25                	push   $0x25
+  8006b8:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8006ba:	83 c4 10             	add    $0x10,%esp
+  8006bd:	89 f8                	mov    %edi,%eax
+  8006bf:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8006c3:	74 05                	je     8006ca <vprintfmt+0x41a>
+  8006c5:	83 e8 01             	sub    $0x1,%eax
+  8006c8:	eb f5                	jmp    8006bf <vprintfmt+0x40f>
+  8006ca:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8006cd:	eb 82                	jmp    800651 <vprintfmt+0x3a1>
+
+008006cf <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8006cf:	55                   	push   %ebp
+  8006d0:	89 e5                	mov    %esp,%ebp
+  8006d2:	83 ec 18             	sub    $0x18,%esp
+  8006d5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006d8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8006db:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8006de:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8006e2:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8006e5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8006ec:	85 c0                	test   %eax,%eax
+  8006ee:	74 26                	je     800716 <vsnprintf+0x47>
+  8006f0:	85 d2                	test   %edx,%edx
+  8006f2:	7e 22                	jle    800716 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8006f4:	ff 75 14             	push   0x14(%ebp)
+  8006f7:	ff 75 10             	push   0x10(%ebp)
+  8006fa:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8006fd:	50                   	push   %eax
+  8006fe:	68 76 02 80 00       	push   $0x800276
+  800703:	e8 a8 fb ff ff       	call   8002b0 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800708:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80070b:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80070e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800711:	83 c4 10             	add    $0x10,%esp
+}
+  800714:	c9                   	leave
+  800715:	c3                   	ret
+		return -E_INVAL;
+  800716:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80071b:	eb f7                	jmp    800714 <vsnprintf+0x45>
+
+0080071d <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80071d:	55                   	push   %ebp
+  80071e:	89 e5                	mov    %esp,%ebp
+  800720:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800723:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800726:	50                   	push   %eax
+  800727:	ff 75 10             	push   0x10(%ebp)
+  80072a:	ff 75 0c             	push   0xc(%ebp)
+  80072d:	ff 75 08             	push   0x8(%ebp)
+  800730:	e8 9a ff ff ff       	call   8006cf <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800735:	c9                   	leave
+  800736:	c3                   	ret
+
+00800737 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800737:	55                   	push   %ebp
+  800738:	89 e5                	mov    %esp,%ebp
+  80073a:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80073d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800742:	eb 03                	jmp    800747 <strlen+0x10>
+		n++;
+  800744:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800747:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80074b:	75 f7                	jne    800744 <strlen+0xd>
+	return n;
+}
+  80074d:	5d                   	pop    %ebp
+  80074e:	c3                   	ret
+
+0080074f <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80074f:	55                   	push   %ebp
+  800750:	89 e5                	mov    %esp,%ebp
+  800752:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800755:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800758:	b8 00 00 00 00       	mov    $0x0,%eax
+  80075d:	eb 03                	jmp    800762 <strnlen+0x13>
+		n++;
+  80075f:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800762:	39 d0                	cmp    %edx,%eax
+  800764:	74 08                	je     80076e <strnlen+0x1f>
+  800766:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80076a:	75 f3                	jne    80075f <strnlen+0x10>
+  80076c:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80076e:	89 d0                	mov    %edx,%eax
+  800770:	5d                   	pop    %ebp
+  800771:	c3                   	ret
+
+00800772 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800772:	55                   	push   %ebp
+  800773:	89 e5                	mov    %esp,%ebp
+  800775:	53                   	push   %ebx
+  800776:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800779:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80077c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800781:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800785:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800788:	83 c0 01             	add    $0x1,%eax
+  80078b:	84 d2                	test   %dl,%dl
+  80078d:	75 f2                	jne    800781 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80078f:	89 c8                	mov    %ecx,%eax
+  800791:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800794:	c9                   	leave
+  800795:	c3                   	ret
+
+00800796 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800796:	55                   	push   %ebp
+  800797:	89 e5                	mov    %esp,%ebp
+  800799:	53                   	push   %ebx
+  80079a:	83 ec 10             	sub    $0x10,%esp
+  80079d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8007a0:	53                   	push   %ebx
+  8007a1:	e8 91 ff ff ff       	call   800737 <strlen>
+  8007a6:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8007a9:	ff 75 0c             	push   0xc(%ebp)
+  8007ac:	01 d8                	add    %ebx,%eax
+  8007ae:	50                   	push   %eax
+  8007af:	e8 be ff ff ff       	call   800772 <strcpy>
+	return dst;
+}
+  8007b4:	89 d8                	mov    %ebx,%eax
+  8007b6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007b9:	c9                   	leave
+  8007ba:	c3                   	ret
+
+008007bb <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8007bb:	55                   	push   %ebp
+  8007bc:	89 e5                	mov    %esp,%ebp
+  8007be:	56                   	push   %esi
+  8007bf:	53                   	push   %ebx
+  8007c0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007c3:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8007c6:	89 f3                	mov    %esi,%ebx
+  8007c8:	03 5d 10             	add    0x10(%ebp),%ebx
+  8007cb:	89 f0                	mov    %esi,%eax
+  8007cd:	eb 0f                	jmp    8007de <strncpy+0x23>
+		*dst++ = *src;
+  8007cf:	83 c0 01             	add    $0x1,%eax
+  8007d2:	0f b6 0a             	movzbl (%edx),%ecx
+  8007d5:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8007d8:	80 f9 01             	cmp    $0x1,%cl
+  8007db:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8007de:	39 d8                	cmp    %ebx,%eax
+  8007e0:	75 ed                	jne    8007cf <strncpy+0x14>
+	}
+	return ret;
+}
+  8007e2:	89 f0                	mov    %esi,%eax
+  8007e4:	5b                   	pop    %ebx
+  8007e5:	5e                   	pop    %esi
+  8007e6:	5d                   	pop    %ebp
+  8007e7:	c3                   	ret
+
+008007e8 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8007e8:	55                   	push   %ebp
+  8007e9:	89 e5                	mov    %esp,%ebp
+  8007eb:	56                   	push   %esi
+  8007ec:	53                   	push   %ebx
+  8007ed:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007f0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007f3:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8007f6:	89 f0                	mov    %esi,%eax
+  8007f8:	85 d2                	test   %edx,%edx
+  8007fa:	74 21                	je     80081d <strlcpy+0x35>
+  8007fc:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800800:	89 f2                	mov    %esi,%edx
+  800802:	eb 09                	jmp    80080d <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800804:	83 c1 01             	add    $0x1,%ecx
+  800807:	83 c2 01             	add    $0x1,%edx
+  80080a:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80080d:	39 c2                	cmp    %eax,%edx
+  80080f:	74 09                	je     80081a <strlcpy+0x32>
+  800811:	0f b6 19             	movzbl (%ecx),%ebx
+  800814:	84 db                	test   %bl,%bl
+  800816:	75 ec                	jne    800804 <strlcpy+0x1c>
+  800818:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80081a:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80081d:	29 f0                	sub    %esi,%eax
+}
+  80081f:	5b                   	pop    %ebx
+  800820:	5e                   	pop    %esi
+  800821:	5d                   	pop    %ebp
+  800822:	c3                   	ret
+
+00800823 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800823:	55                   	push   %ebp
+  800824:	89 e5                	mov    %esp,%ebp
+  800826:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800829:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80082c:	eb 06                	jmp    800834 <strcmp+0x11>
+		p++, q++;
+  80082e:	83 c1 01             	add    $0x1,%ecx
+  800831:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800834:	0f b6 01             	movzbl (%ecx),%eax
+  800837:	84 c0                	test   %al,%al
+  800839:	74 04                	je     80083f <strcmp+0x1c>
+  80083b:	3a 02                	cmp    (%edx),%al
+  80083d:	74 ef                	je     80082e <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80083f:	0f b6 c0             	movzbl %al,%eax
+  800842:	0f b6 12             	movzbl (%edx),%edx
+  800845:	29 d0                	sub    %edx,%eax
+}
+  800847:	5d                   	pop    %ebp
+  800848:	c3                   	ret
+
+00800849 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800849:	55                   	push   %ebp
+  80084a:	89 e5                	mov    %esp,%ebp
+  80084c:	53                   	push   %ebx
+  80084d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800850:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800853:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800856:	eb 09                	jmp    800861 <strncmp+0x18>
+		n--, p++, q++;
+  800858:	83 ea 01             	sub    $0x1,%edx
+  80085b:	83 c0 01             	add    $0x1,%eax
+  80085e:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800861:	85 d2                	test   %edx,%edx
+  800863:	74 18                	je     80087d <strncmp+0x34>
+  800865:	0f b6 18             	movzbl (%eax),%ebx
+  800868:	84 db                	test   %bl,%bl
+  80086a:	74 04                	je     800870 <strncmp+0x27>
+  80086c:	3a 19                	cmp    (%ecx),%bl
+  80086e:	74 e8                	je     800858 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800870:	0f b6 00             	movzbl (%eax),%eax
+  800873:	0f b6 11             	movzbl (%ecx),%edx
+  800876:	29 d0                	sub    %edx,%eax
+}
+  800878:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80087b:	c9                   	leave
+  80087c:	c3                   	ret
+		return 0;
+  80087d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800882:	eb f4                	jmp    800878 <strncmp+0x2f>
+
+00800884 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800884:	55                   	push   %ebp
+  800885:	89 e5                	mov    %esp,%ebp
+  800887:	8b 45 08             	mov    0x8(%ebp),%eax
+  80088a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80088e:	eb 03                	jmp    800893 <strchr+0xf>
+  800890:	83 c0 01             	add    $0x1,%eax
+  800893:	0f b6 10             	movzbl (%eax),%edx
+  800896:	84 d2                	test   %dl,%dl
+  800898:	74 06                	je     8008a0 <strchr+0x1c>
+		if (*s == c)
+  80089a:	38 ca                	cmp    %cl,%dl
+  80089c:	75 f2                	jne    800890 <strchr+0xc>
+  80089e:	eb 05                	jmp    8008a5 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8008a0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008a5:	5d                   	pop    %ebp
+  8008a6:	c3                   	ret
+
+008008a7 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8008a7:	55                   	push   %ebp
+  8008a8:	89 e5                	mov    %esp,%ebp
+  8008aa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008ad:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008b1:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8008b4:	38 ca                	cmp    %cl,%dl
+  8008b6:	74 09                	je     8008c1 <strfind+0x1a>
+  8008b8:	84 d2                	test   %dl,%dl
+  8008ba:	74 05                	je     8008c1 <strfind+0x1a>
+	for (; *s; s++)
+  8008bc:	83 c0 01             	add    $0x1,%eax
+  8008bf:	eb f0                	jmp    8008b1 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8008c1:	5d                   	pop    %ebp
+  8008c2:	c3                   	ret
+
+008008c3 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8008c3:	55                   	push   %ebp
+  8008c4:	89 e5                	mov    %esp,%ebp
+  8008c6:	57                   	push   %edi
+  8008c7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8008ca:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8008cd:	85 c9                	test   %ecx,%ecx
+  8008cf:	74 20                	je     8008f1 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8008d1:	89 f8                	mov    %edi,%eax
+  8008d3:	09 c8                	or     %ecx,%eax
+  8008d5:	a8 03                	test   $0x3,%al
+  8008d7:	75 12                	jne    8008eb <memset+0x28>
+		c &= 0xFF;
+  8008d9:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8008dd:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8008e3:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8008e6:	fc                   	cld
+  8008e7:	f3 ab                	rep stos %eax,%es:(%edi)
+  8008e9:	eb 06                	jmp    8008f1 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8008eb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8008ee:	fc                   	cld
+  8008ef:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8008f1:	89 f8                	mov    %edi,%eax
+  8008f3:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8008f6:	c9                   	leave
+  8008f7:	c3                   	ret
+
+008008f8 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8008f8:	55                   	push   %ebp
+  8008f9:	89 e5                	mov    %esp,%ebp
+  8008fb:	57                   	push   %edi
+  8008fc:	56                   	push   %esi
+  8008fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  800900:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800903:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800906:	39 c6                	cmp    %eax,%esi
+  800908:	73 32                	jae    80093c <memmove+0x44>
+  80090a:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80090d:	39 d0                	cmp    %edx,%eax
+  80090f:	73 2b                	jae    80093c <memmove+0x44>
+		s += n;
+		d += n;
+  800911:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800914:	89 d6                	mov    %edx,%esi
+  800916:	09 fe                	or     %edi,%esi
+  800918:	09 ce                	or     %ecx,%esi
+  80091a:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800920:	75 0e                	jne    800930 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800922:	83 ef 04             	sub    $0x4,%edi
+  800925:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800928:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  80092b:	fd                   	std
+  80092c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80092e:	eb 09                	jmp    800939 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800930:	83 ef 01             	sub    $0x1,%edi
+  800933:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800936:	fd                   	std
+  800937:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800939:	fc                   	cld
+  80093a:	eb 1a                	jmp    800956 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80093c:	89 f2                	mov    %esi,%edx
+  80093e:	09 c2                	or     %eax,%edx
+  800940:	09 ca                	or     %ecx,%edx
+  800942:	f6 c2 03             	test   $0x3,%dl
+  800945:	75 0a                	jne    800951 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800947:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  80094a:	89 c7                	mov    %eax,%edi
+  80094c:	fc                   	cld
+  80094d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80094f:	eb 05                	jmp    800956 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800951:	89 c7                	mov    %eax,%edi
+  800953:	fc                   	cld
+  800954:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800956:	5e                   	pop    %esi
+  800957:	5f                   	pop    %edi
+  800958:	5d                   	pop    %ebp
+  800959:	c3                   	ret
+
+0080095a <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  80095a:	55                   	push   %ebp
+  80095b:	89 e5                	mov    %esp,%ebp
+  80095d:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800960:	ff 75 10             	push   0x10(%ebp)
+  800963:	ff 75 0c             	push   0xc(%ebp)
+  800966:	ff 75 08             	push   0x8(%ebp)
+  800969:	e8 8a ff ff ff       	call   8008f8 <memmove>
+}
+  80096e:	c9                   	leave
+  80096f:	c3                   	ret
+
+00800970 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800970:	55                   	push   %ebp
+  800971:	89 e5                	mov    %esp,%ebp
+  800973:	56                   	push   %esi
+  800974:	53                   	push   %ebx
+  800975:	8b 45 08             	mov    0x8(%ebp),%eax
+  800978:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  80097b:	89 c6                	mov    %eax,%esi
+  80097d:	03 75 10             	add    0x10(%ebp),%esi
+  800980:	eb 06                	jmp    800988 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800982:	83 c0 01             	add    $0x1,%eax
+  800985:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800988:	39 f0                	cmp    %esi,%eax
+  80098a:	74 14                	je     8009a0 <memcmp+0x30>
+		if (*s1 != *s2)
+  80098c:	0f b6 08             	movzbl (%eax),%ecx
+  80098f:	0f b6 1a             	movzbl (%edx),%ebx
+  800992:	38 d9                	cmp    %bl,%cl
+  800994:	74 ec                	je     800982 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800996:	0f b6 c1             	movzbl %cl,%eax
+  800999:	0f b6 db             	movzbl %bl,%ebx
+  80099c:	29 d8                	sub    %ebx,%eax
+  80099e:	eb 05                	jmp    8009a5 <memcmp+0x35>
+	}
+
+	return 0;
+  8009a0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009a5:	5b                   	pop    %ebx
+  8009a6:	5e                   	pop    %esi
+  8009a7:	5d                   	pop    %ebp
+  8009a8:	c3                   	ret
+
+008009a9 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8009a9:	55                   	push   %ebp
+  8009aa:	89 e5                	mov    %esp,%ebp
+  8009ac:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009af:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8009b2:	89 c2                	mov    %eax,%edx
+  8009b4:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8009b7:	eb 03                	jmp    8009bc <memfind+0x13>
+  8009b9:	83 c0 01             	add    $0x1,%eax
+  8009bc:	39 d0                	cmp    %edx,%eax
+  8009be:	73 04                	jae    8009c4 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8009c0:	38 08                	cmp    %cl,(%eax)
+  8009c2:	75 f5                	jne    8009b9 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8009c4:	5d                   	pop    %ebp
+  8009c5:	c3                   	ret
+
+008009c6 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8009c6:	55                   	push   %ebp
+  8009c7:	89 e5                	mov    %esp,%ebp
+  8009c9:	57                   	push   %edi
+  8009ca:	56                   	push   %esi
+  8009cb:	53                   	push   %ebx
+  8009cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009cf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8009d2:	eb 03                	jmp    8009d7 <strtol+0x11>
+		s++;
+  8009d4:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  8009d7:	0f b6 02             	movzbl (%edx),%eax
+  8009da:	3c 20                	cmp    $0x20,%al
+  8009dc:	74 f6                	je     8009d4 <strtol+0xe>
+  8009de:	3c 09                	cmp    $0x9,%al
+  8009e0:	74 f2                	je     8009d4 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8009e2:	3c 2b                	cmp    $0x2b,%al
+  8009e4:	74 2a                	je     800a10 <strtol+0x4a>
+	int neg = 0;
+  8009e6:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8009eb:	3c 2d                	cmp    $0x2d,%al
+  8009ed:	74 2b                	je     800a1a <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009ef:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8009f5:	75 0f                	jne    800a06 <strtol+0x40>
+  8009f7:	80 3a 30             	cmpb   $0x30,(%edx)
+  8009fa:	74 28                	je     800a24 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8009fc:	85 db                	test   %ebx,%ebx
+  8009fe:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a03:	0f 44 d8             	cmove  %eax,%ebx
+  800a06:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a0b:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a0e:	eb 46                	jmp    800a56 <strtol+0x90>
+		s++;
+  800a10:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a13:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a18:	eb d5                	jmp    8009ef <strtol+0x29>
+		s++, neg = 1;
+  800a1a:	83 c2 01             	add    $0x1,%edx
+  800a1d:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a22:	eb cb                	jmp    8009ef <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a24:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a28:	74 0e                	je     800a38 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a2a:	85 db                	test   %ebx,%ebx
+  800a2c:	75 d8                	jne    800a06 <strtol+0x40>
+		s++, base = 8;
+  800a2e:	83 c2 01             	add    $0x1,%edx
+  800a31:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a36:	eb ce                	jmp    800a06 <strtol+0x40>
+		s += 2, base = 16;
+  800a38:	83 c2 02             	add    $0x2,%edx
+  800a3b:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a40:	eb c4                	jmp    800a06 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a42:	0f be c0             	movsbl %al,%eax
+  800a45:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a48:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a4b:	7d 3a                	jge    800a87 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a4d:	83 c2 01             	add    $0x1,%edx
+  800a50:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a54:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a56:	0f b6 02             	movzbl (%edx),%eax
+  800a59:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a5c:	89 f3                	mov    %esi,%ebx
+  800a5e:	80 fb 09             	cmp    $0x9,%bl
+  800a61:	76 df                	jbe    800a42 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a63:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a66:	89 f3                	mov    %esi,%ebx
+  800a68:	80 fb 19             	cmp    $0x19,%bl
+  800a6b:	77 08                	ja     800a75 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800a6d:	0f be c0             	movsbl %al,%eax
+  800a70:	83 e8 57             	sub    $0x57,%eax
+  800a73:	eb d3                	jmp    800a48 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800a75:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800a78:	89 f3                	mov    %esi,%ebx
+  800a7a:	80 fb 19             	cmp    $0x19,%bl
+  800a7d:	77 08                	ja     800a87 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800a7f:	0f be c0             	movsbl %al,%eax
+  800a82:	83 e8 37             	sub    $0x37,%eax
+  800a85:	eb c1                	jmp    800a48 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800a87:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800a8b:	74 05                	je     800a92 <strtol+0xcc>
+		*endptr = (char *) s;
+  800a8d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a90:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800a92:	89 c8                	mov    %ecx,%eax
+  800a94:	f7 d8                	neg    %eax
+  800a96:	85 ff                	test   %edi,%edi
+  800a98:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800a9b:	89 c8                	mov    %ecx,%eax
+  800a9d:	5b                   	pop    %ebx
+  800a9e:	5e                   	pop    %esi
+  800a9f:	5f                   	pop    %edi
+  800aa0:	5d                   	pop    %ebp
+  800aa1:	c3                   	ret
+
+00800aa2 <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800aa2:	55                   	push   %ebp
+  800aa3:	89 e5                	mov    %esp,%ebp
+  800aa5:	57                   	push   %edi
+  800aa6:	56                   	push   %esi
+  800aa7:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800aa8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aad:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ab0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ab3:	89 c3                	mov    %eax,%ebx
+  800ab5:	89 c7                	mov    %eax,%edi
+  800ab7:	89 c6                	mov    %eax,%esi
+  800ab9:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  800abb:	5b                   	pop    %ebx
+  800abc:	5e                   	pop    %esi
+  800abd:	5f                   	pop    %edi
+  800abe:	5d                   	pop    %ebp
+  800abf:	c3                   	ret
+
+00800ac0 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800ac0:	55                   	push   %ebp
+  800ac1:	89 e5                	mov    %esp,%ebp
+  800ac3:	57                   	push   %edi
+  800ac4:	56                   	push   %esi
+  800ac5:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800ac6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800acb:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ad0:	89 d1                	mov    %edx,%ecx
+  800ad2:	89 d3                	mov    %edx,%ebx
+  800ad4:	89 d7                	mov    %edx,%edi
+  800ad6:	89 d6                	mov    %edx,%esi
+  800ad8:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800ada:	5b                   	pop    %ebx
+  800adb:	5e                   	pop    %esi
+  800adc:	5f                   	pop    %edi
+  800add:	5d                   	pop    %ebp
+  800ade:	c3                   	ret
+
+00800adf <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800adf:	55                   	push   %ebp
+  800ae0:	89 e5                	mov    %esp,%ebp
+  800ae2:	57                   	push   %edi
+  800ae3:	56                   	push   %esi
+  800ae4:	53                   	push   %ebx
+  800ae5:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800ae8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800aed:	8b 55 08             	mov    0x8(%ebp),%edx
+  800af0:	b8 03 00 00 00       	mov    $0x3,%eax
+  800af5:	89 cb                	mov    %ecx,%ebx
+  800af7:	89 cf                	mov    %ecx,%edi
+  800af9:	89 ce                	mov    %ecx,%esi
+  800afb:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800afd:	85 c0                	test   %eax,%eax
+  800aff:	7f 08                	jg     800b09 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800b01:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b04:	5b                   	pop    %ebx
+  800b05:	5e                   	pop    %esi
+  800b06:	5f                   	pop    %edi
+  800b07:	5d                   	pop    %ebp
+  800b08:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800b09:	83 ec 0c             	sub    $0xc,%esp
+  800b0c:	50                   	push   %eax
+  800b0d:	6a 03                	push   $0x3
+  800b0f:	68 a3 2e 80 00       	push   $0x802ea3
+  800b14:	6a 3e                	push   $0x3e
+  800b16:	68 c0 2e 80 00       	push   $0x802ec0
+  800b1b:	e8 be f5 ff ff       	call   8000de <_panic>
+
+00800b20 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800b20:	55                   	push   %ebp
+  800b21:	89 e5                	mov    %esp,%ebp
+  800b23:	57                   	push   %edi
+  800b24:	56                   	push   %esi
+  800b25:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800b26:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b2b:	b8 02 00 00 00       	mov    $0x2,%eax
+  800b30:	89 d1                	mov    %edx,%ecx
+  800b32:	89 d3                	mov    %edx,%ebx
+  800b34:	89 d7                	mov    %edx,%edi
+  800b36:	89 d6                	mov    %edx,%esi
+  800b38:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800b3a:	5b                   	pop    %ebx
+  800b3b:	5e                   	pop    %esi
+  800b3c:	5f                   	pop    %edi
+  800b3d:	5d                   	pop    %ebp
+  800b3e:	c3                   	ret
+
+00800b3f <sys_yield>:
+
+void
+sys_yield(void) {
+  800b3f:	55                   	push   %ebp
+  800b40:	89 e5                	mov    %esp,%ebp
+  800b42:	57                   	push   %edi
+  800b43:	56                   	push   %esi
+  800b44:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800b45:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b4a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800b4f:	89 d1                	mov    %edx,%ecx
+  800b51:	89 d3                	mov    %edx,%ebx
+  800b53:	89 d7                	mov    %edx,%edi
+  800b55:	89 d6                	mov    %edx,%esi
+  800b57:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800b59:	5b                   	pop    %ebx
+  800b5a:	5e                   	pop    %esi
+  800b5b:	5f                   	pop    %edi
+  800b5c:	5d                   	pop    %ebp
+  800b5d:	c3                   	ret
+
+00800b5e <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  800b5e:	55                   	push   %ebp
+  800b5f:	89 e5                	mov    %esp,%ebp
+  800b61:	57                   	push   %edi
+  800b62:	56                   	push   %esi
+  800b63:	53                   	push   %ebx
+  800b64:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800b67:	be 00 00 00 00       	mov    $0x0,%esi
+  800b6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b6f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b72:	b8 04 00 00 00       	mov    $0x4,%eax
+  800b77:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b7a:	89 f7                	mov    %esi,%edi
+  800b7c:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800b7e:	85 c0                	test   %eax,%eax
+  800b80:	7f 08                	jg     800b8a <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800b82:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b85:	5b                   	pop    %ebx
+  800b86:	5e                   	pop    %esi
+  800b87:	5f                   	pop    %edi
+  800b88:	5d                   	pop    %ebp
+  800b89:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800b8a:	83 ec 0c             	sub    $0xc,%esp
+  800b8d:	50                   	push   %eax
+  800b8e:	6a 04                	push   $0x4
+  800b90:	68 a3 2e 80 00       	push   $0x802ea3
+  800b95:	6a 3e                	push   $0x3e
+  800b97:	68 c0 2e 80 00       	push   $0x802ec0
+  800b9c:	e8 3d f5 ff ff       	call   8000de <_panic>
+
+00800ba1 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  800ba1:	55                   	push   %ebp
+  800ba2:	89 e5                	mov    %esp,%ebp
+  800ba4:	57                   	push   %edi
+  800ba5:	56                   	push   %esi
+  800ba6:	53                   	push   %ebx
+  800ba7:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800baa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bb0:	b8 05 00 00 00       	mov    $0x5,%eax
+  800bb5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bb8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800bbb:	8b 75 18             	mov    0x18(%ebp),%esi
+  800bbe:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800bc0:	85 c0                	test   %eax,%eax
+  800bc2:	7f 08                	jg     800bcc <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800bc4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bc7:	5b                   	pop    %ebx
+  800bc8:	5e                   	pop    %esi
+  800bc9:	5f                   	pop    %edi
+  800bca:	5d                   	pop    %ebp
+  800bcb:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800bcc:	83 ec 0c             	sub    $0xc,%esp
+  800bcf:	50                   	push   %eax
+  800bd0:	6a 05                	push   $0x5
+  800bd2:	68 a3 2e 80 00       	push   $0x802ea3
+  800bd7:	6a 3e                	push   $0x3e
+  800bd9:	68 c0 2e 80 00       	push   $0x802ec0
+  800bde:	e8 fb f4 ff ff       	call   8000de <_panic>
+
+00800be3 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  800be3:	55                   	push   %ebp
+  800be4:	89 e5                	mov    %esp,%ebp
+  800be6:	57                   	push   %edi
+  800be7:	56                   	push   %esi
+  800be8:	53                   	push   %ebx
+  800be9:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800bec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800bf1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bf4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bf7:	b8 06 00 00 00       	mov    $0x6,%eax
+  800bfc:	89 df                	mov    %ebx,%edi
+  800bfe:	89 de                	mov    %ebx,%esi
+  800c00:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c02:	85 c0                	test   %eax,%eax
+  800c04:	7f 08                	jg     800c0e <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800c06:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c09:	5b                   	pop    %ebx
+  800c0a:	5e                   	pop    %esi
+  800c0b:	5f                   	pop    %edi
+  800c0c:	5d                   	pop    %ebp
+  800c0d:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c0e:	83 ec 0c             	sub    $0xc,%esp
+  800c11:	50                   	push   %eax
+  800c12:	6a 06                	push   $0x6
+  800c14:	68 a3 2e 80 00       	push   $0x802ea3
+  800c19:	6a 3e                	push   $0x3e
+  800c1b:	68 c0 2e 80 00       	push   $0x802ec0
+  800c20:	e8 b9 f4 ff ff       	call   8000de <_panic>
+
+00800c25 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800c25:	55                   	push   %ebp
+  800c26:	89 e5                	mov    %esp,%ebp
+  800c28:	57                   	push   %edi
+  800c29:	56                   	push   %esi
+  800c2a:	53                   	push   %ebx
+  800c2b:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c2e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c33:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c36:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c39:	b8 08 00 00 00       	mov    $0x8,%eax
+  800c3e:	89 df                	mov    %ebx,%edi
+  800c40:	89 de                	mov    %ebx,%esi
+  800c42:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c44:	85 c0                	test   %eax,%eax
+  800c46:	7f 08                	jg     800c50 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800c48:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c4b:	5b                   	pop    %ebx
+  800c4c:	5e                   	pop    %esi
+  800c4d:	5f                   	pop    %edi
+  800c4e:	5d                   	pop    %ebp
+  800c4f:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c50:	83 ec 0c             	sub    $0xc,%esp
+  800c53:	50                   	push   %eax
+  800c54:	6a 08                	push   $0x8
+  800c56:	68 a3 2e 80 00       	push   $0x802ea3
+  800c5b:	6a 3e                	push   $0x3e
+  800c5d:	68 c0 2e 80 00       	push   $0x802ec0
+  800c62:	e8 77 f4 ff ff       	call   8000de <_panic>
+
+00800c67 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800c67:	55                   	push   %ebp
+  800c68:	89 e5                	mov    %esp,%ebp
+  800c6a:	57                   	push   %edi
+  800c6b:	56                   	push   %esi
+  800c6c:	53                   	push   %ebx
+  800c6d:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c70:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c75:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c78:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c7b:	b8 09 00 00 00       	mov    $0x9,%eax
+  800c80:	89 df                	mov    %ebx,%edi
+  800c82:	89 de                	mov    %ebx,%esi
+  800c84:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c86:	85 c0                	test   %eax,%eax
+  800c88:	7f 08                	jg     800c92 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800c8a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c8d:	5b                   	pop    %ebx
+  800c8e:	5e                   	pop    %esi
+  800c8f:	5f                   	pop    %edi
+  800c90:	5d                   	pop    %ebp
+  800c91:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c92:	83 ec 0c             	sub    $0xc,%esp
+  800c95:	50                   	push   %eax
+  800c96:	6a 09                	push   $0x9
+  800c98:	68 a3 2e 80 00       	push   $0x802ea3
+  800c9d:	6a 3e                	push   $0x3e
+  800c9f:	68 c0 2e 80 00       	push   $0x802ec0
+  800ca4:	e8 35 f4 ff ff       	call   8000de <_panic>
+
+00800ca9 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800ca9:	55                   	push   %ebp
+  800caa:	89 e5                	mov    %esp,%ebp
+  800cac:	57                   	push   %edi
+  800cad:	56                   	push   %esi
+  800cae:	53                   	push   %ebx
+  800caf:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800cb2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cb7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cbd:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800cc2:	89 df                	mov    %ebx,%edi
+  800cc4:	89 de                	mov    %ebx,%esi
+  800cc6:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800cc8:	85 c0                	test   %eax,%eax
+  800cca:	7f 08                	jg     800cd4 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800ccc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ccf:	5b                   	pop    %ebx
+  800cd0:	5e                   	pop    %esi
+  800cd1:	5f                   	pop    %edi
+  800cd2:	5d                   	pop    %ebp
+  800cd3:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800cd4:	83 ec 0c             	sub    $0xc,%esp
+  800cd7:	50                   	push   %eax
+  800cd8:	6a 0a                	push   $0xa
+  800cda:	68 a3 2e 80 00       	push   $0x802ea3
+  800cdf:	6a 3e                	push   $0x3e
+  800ce1:	68 c0 2e 80 00       	push   $0x802ec0
+  800ce6:	e8 f3 f3 ff ff       	call   8000de <_panic>
+
+00800ceb <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  800ceb:	55                   	push   %ebp
+  800cec:	89 e5                	mov    %esp,%ebp
+  800cee:	57                   	push   %edi
+  800cef:	56                   	push   %esi
+  800cf0:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800cf1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cf4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cf7:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800cfc:	be 00 00 00 00       	mov    $0x0,%esi
+  800d01:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d04:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d07:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800d09:	5b                   	pop    %ebx
+  800d0a:	5e                   	pop    %esi
+  800d0b:	5f                   	pop    %edi
+  800d0c:	5d                   	pop    %ebp
+  800d0d:	c3                   	ret
+
+00800d0e <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  800d0e:	55                   	push   %ebp
+  800d0f:	89 e5                	mov    %esp,%ebp
+  800d11:	57                   	push   %edi
+  800d12:	56                   	push   %esi
+  800d13:	53                   	push   %ebx
+  800d14:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800d17:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d1c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d1f:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800d24:	89 cb                	mov    %ecx,%ebx
+  800d26:	89 cf                	mov    %ecx,%edi
+  800d28:	89 ce                	mov    %ecx,%esi
+  800d2a:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d2c:	85 c0                	test   %eax,%eax
+  800d2e:	7f 08                	jg     800d38 <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  800d30:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d33:	5b                   	pop    %ebx
+  800d34:	5e                   	pop    %esi
+  800d35:	5f                   	pop    %edi
+  800d36:	5d                   	pop    %ebp
+  800d37:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d38:	83 ec 0c             	sub    $0xc,%esp
+  800d3b:	50                   	push   %eax
+  800d3c:	6a 0d                	push   $0xd
+  800d3e:	68 a3 2e 80 00       	push   $0x802ea3
+  800d43:	6a 3e                	push   $0x3e
+  800d45:	68 c0 2e 80 00       	push   $0x802ec0
+  800d4a:	e8 8f f3 ff ff       	call   8000de <_panic>
+
+00800d4f <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  800d4f:	55                   	push   %ebp
+  800d50:	89 e5                	mov    %esp,%ebp
+  800d52:	57                   	push   %edi
+  800d53:	56                   	push   %esi
+  800d54:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d55:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d5a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d5d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d60:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800d65:	89 df                	mov    %ebx,%edi
+  800d67:	89 de                	mov    %ebx,%esi
+  800d69:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  800d6b:	5b                   	pop    %ebx
+  800d6c:	5e                   	pop    %esi
+  800d6d:	5f                   	pop    %edi
+  800d6e:	5d                   	pop    %ebp
+  800d6f:	c3                   	ret
+
+00800d70 <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  800d70:	55                   	push   %ebp
+  800d71:	89 e5                	mov    %esp,%ebp
+  800d73:	57                   	push   %edi
+  800d74:	56                   	push   %esi
+  800d75:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d76:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d7b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d7e:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800d83:	89 cb                	mov    %ecx,%ebx
+  800d85:	89 cf                	mov    %ecx,%edi
+  800d87:	89 ce                	mov    %ecx,%esi
+  800d89:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  800d8b:	5b                   	pop    %ebx
+  800d8c:	5e                   	pop    %esi
+  800d8d:	5f                   	pop    %edi
+  800d8e:	5d                   	pop    %ebp
+  800d8f:	c3                   	ret
+
+00800d90 <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  800d90:	55                   	push   %ebp
+  800d91:	89 e5                	mov    %esp,%ebp
+  800d93:	57                   	push   %edi
+  800d94:	56                   	push   %esi
+  800d95:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d96:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d9b:	b8 10 00 00 00       	mov    $0x10,%eax
+  800da0:	89 d1                	mov    %edx,%ecx
+  800da2:	89 d3                	mov    %edx,%ebx
+  800da4:	89 d7                	mov    %edx,%edi
+  800da6:	89 d6                	mov    %edx,%esi
+  800da8:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800daa:	5b                   	pop    %ebx
+  800dab:	5e                   	pop    %esi
+  800dac:	5f                   	pop    %edi
+  800dad:	5d                   	pop    %ebp
+  800dae:	c3                   	ret
+
+00800daf <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  800daf:	55                   	push   %ebp
+  800db0:	89 e5                	mov    %esp,%ebp
+  800db2:	57                   	push   %edi
+  800db3:	56                   	push   %esi
+  800db4:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800db5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dba:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dbd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dc0:	b8 11 00 00 00       	mov    $0x11,%eax
+  800dc5:	89 df                	mov    %ebx,%edi
+  800dc7:	89 de                	mov    %ebx,%esi
+  800dc9:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800dcb:	5b                   	pop    %ebx
+  800dcc:	5e                   	pop    %esi
+  800dcd:	5f                   	pop    %edi
+  800dce:	5d                   	pop    %ebp
+  800dcf:	c3                   	ret
+
+00800dd0 <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  800dd0:	55                   	push   %ebp
+  800dd1:	89 e5                	mov    %esp,%ebp
+  800dd3:	57                   	push   %edi
+  800dd4:	56                   	push   %esi
+  800dd5:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800dd6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ddb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dde:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800de1:	b8 12 00 00 00       	mov    $0x12,%eax
+  800de6:	89 df                	mov    %ebx,%edi
+  800de8:	89 de                	mov    %ebx,%esi
+  800dea:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800dec:	5b                   	pop    %ebx
+  800ded:	5e                   	pop    %esi
+  800dee:	5f                   	pop    %edi
+  800def:	5d                   	pop    %ebp
+  800df0:	c3                   	ret
+
+00800df1 <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  800df1:	55                   	push   %ebp
+  800df2:	89 e5                	mov    %esp,%ebp
+  800df4:	57                   	push   %edi
+  800df5:	56                   	push   %esi
+  800df6:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800df7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dfc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dff:	b8 13 00 00 00       	mov    $0x13,%eax
+  800e04:	89 cb                	mov    %ecx,%ebx
+  800e06:	89 cf                	mov    %ecx,%edi
+  800e08:	89 ce                	mov    %ecx,%esi
+  800e0a:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  800e0c:	5b                   	pop    %ebx
+  800e0d:	5e                   	pop    %esi
+  800e0e:	5f                   	pop    %edi
+  800e0f:	5d                   	pop    %ebp
+  800e10:	c3                   	ret
+
+00800e11 <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  800e11:	55                   	push   %ebp
+  800e12:	89 e5                	mov    %esp,%ebp
+  800e14:	57                   	push   %edi
+  800e15:	56                   	push   %esi
+  800e16:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e17:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e1c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e1f:	b8 14 00 00 00       	mov    $0x14,%eax
+  800e24:	89 cb                	mov    %ecx,%ebx
+  800e26:	89 cf                	mov    %ecx,%edi
+  800e28:	89 ce                	mov    %ecx,%esi
+  800e2a:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  800e2c:	5b                   	pop    %ebx
+  800e2d:	5e                   	pop    %esi
+  800e2e:	5f                   	pop    %edi
+  800e2f:	5d                   	pop    %ebp
+  800e30:	c3                   	ret
+
+00800e31 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800e31:	55                   	push   %ebp
+  800e32:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800e34:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e37:	05 00 00 00 30       	add    $0x30000000,%eax
+  800e3c:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800e3f:	5d                   	pop    %ebp
+  800e40:	c3                   	ret
+
+00800e41 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800e41:	55                   	push   %ebp
+  800e42:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800e44:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e47:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800e4c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800e51:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800e56:	5d                   	pop    %ebp
+  800e57:	c3                   	ret
+
+00800e58 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800e58:	55                   	push   %ebp
+  800e59:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  800e5b:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800e60:	eb 02                	jmp    800e64 <fd_alloc+0xc>
+  800e62:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800e64:	89 c2                	mov    %eax,%edx
+  800e66:	c1 ea 16             	shr    $0x16,%edx
+  800e69:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800e70:	f6 c2 01             	test   $0x1,%dl
+  800e73:	74 2b                	je     800ea0 <fd_alloc+0x48>
+  800e75:	89 c2                	mov    %eax,%edx
+  800e77:	c1 ea 0c             	shr    $0xc,%edx
+  800e7a:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  800e81:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  800e87:	f6 c1 01             	test   $0x1,%cl
+  800e8a:	74 14                	je     800ea0 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  800e8c:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  800e92:	75 ce                	jne    800e62 <fd_alloc+0xa>
+  800e94:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  800e99:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800e9e:	eb 05                	jmp    800ea5 <fd_alloc+0x4d>
+			return 0;
+  800ea0:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  800ea5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ea8:	89 02                	mov    %eax,(%edx)
+}
+  800eaa:	89 c8                	mov    %ecx,%eax
+  800eac:	5d                   	pop    %ebp
+  800ead:	c3                   	ret
+
+00800eae <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  800eae:	55                   	push   %ebp
+  800eaf:	89 e5                	mov    %esp,%ebp
+  800eb1:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  800eb4:	83 f8 1f             	cmp    $0x1f,%eax
+  800eb7:	77 30                	ja     800ee9 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  800eb9:	c1 e0 0c             	shl    $0xc,%eax
+  800ebc:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800ec1:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  800ec7:	f6 c2 01             	test   $0x1,%dl
+  800eca:	74 24                	je     800ef0 <fd_lookup+0x42>
+  800ecc:	89 c2                	mov    %eax,%edx
+  800ece:	c1 ea 0c             	shr    $0xc,%edx
+  800ed1:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800ed8:	f6 c2 01             	test   $0x1,%dl
+  800edb:	74 1a                	je     800ef7 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  800edd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ee0:	89 02                	mov    %eax,(%edx)
+	return 0;
+  800ee2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ee7:	5d                   	pop    %ebp
+  800ee8:	c3                   	ret
+		return -E_INVAL;
+  800ee9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800eee:	eb f7                	jmp    800ee7 <fd_lookup+0x39>
+		return -E_INVAL;
+  800ef0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ef5:	eb f0                	jmp    800ee7 <fd_lookup+0x39>
+  800ef7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800efc:	eb e9                	jmp    800ee7 <fd_lookup+0x39>
+
+00800efe <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  800efe:	55                   	push   %ebp
+  800eff:	89 e5                	mov    %esp,%ebp
+  800f01:	53                   	push   %ebx
+  800f02:	83 ec 04             	sub    $0x4,%esp
+  800f05:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  800f08:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f0d:	eb 03                	jmp    800f12 <dev_lookup+0x14>
+  800f0f:	83 c0 01             	add    $0x1,%eax
+  800f12:	8b 1c 85 4c 2f 80 00 	mov    0x802f4c(,%eax,4),%ebx
+  800f19:	85 db                	test   %ebx,%ebx
+  800f1b:	74 0b                	je     800f28 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  800f1d:	39 13                	cmp    %edx,(%ebx)
+  800f1f:	75 ee                	jne    800f0f <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  800f21:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f26:	eb 1f                	jmp    800f47 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800f28:	a1 08 50 80 00       	mov    0x805008,%eax
+  800f2d:	8b 40 48             	mov    0x48(%eax),%eax
+  800f30:	83 ec 04             	sub    $0x4,%esp
+  800f33:	52                   	push   %edx
+  800f34:	50                   	push   %eax
+  800f35:	68 d0 2e 80 00       	push   $0x802ed0
+  800f3a:	e8 7a f2 ff ff       	call   8001b9 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  800f3f:	83 c4 10             	add    $0x10,%esp
+  800f42:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  800f47:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800f4a:	89 1a                	mov    %ebx,(%edx)
+}
+  800f4c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f4f:	c9                   	leave
+  800f50:	c3                   	ret
+
+00800f51 <fd_close>:
+{
+  800f51:	55                   	push   %ebp
+  800f52:	89 e5                	mov    %esp,%ebp
+  800f54:	57                   	push   %edi
+  800f55:	56                   	push   %esi
+  800f56:	53                   	push   %ebx
+  800f57:	83 ec 24             	sub    $0x24,%esp
+  800f5a:	8b 75 08             	mov    0x8(%ebp),%esi
+  800f5d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800f60:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800f63:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800f64:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800f6a:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800f6d:	50                   	push   %eax
+  800f6e:	e8 3b ff ff ff       	call   800eae <fd_lookup>
+  800f73:	89 c3                	mov    %eax,%ebx
+  800f75:	83 c4 10             	add    $0x10,%esp
+  800f78:	85 c0                	test   %eax,%eax
+  800f7a:	78 05                	js     800f81 <fd_close+0x30>
+	    || fd != fd2)
+  800f7c:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  800f7f:	74 16                	je     800f97 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  800f81:	89 f8                	mov    %edi,%eax
+  800f83:	84 c0                	test   %al,%al
+  800f85:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f8a:	0f 44 d8             	cmove  %eax,%ebx
+}
+  800f8d:	89 d8                	mov    %ebx,%eax
+  800f8f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f92:	5b                   	pop    %ebx
+  800f93:	5e                   	pop    %esi
+  800f94:	5f                   	pop    %edi
+  800f95:	5d                   	pop    %ebp
+  800f96:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800f97:	83 ec 08             	sub    $0x8,%esp
+  800f9a:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800f9d:	50                   	push   %eax
+  800f9e:	ff 36                	push   (%esi)
+  800fa0:	e8 59 ff ff ff       	call   800efe <dev_lookup>
+  800fa5:	89 c3                	mov    %eax,%ebx
+  800fa7:	83 c4 10             	add    $0x10,%esp
+  800faa:	85 c0                	test   %eax,%eax
+  800fac:	78 1a                	js     800fc8 <fd_close+0x77>
+		if (dev->dev_close)
+  800fae:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800fb1:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  800fb4:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  800fb9:	85 c0                	test   %eax,%eax
+  800fbb:	74 0b                	je     800fc8 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  800fbd:	83 ec 0c             	sub    $0xc,%esp
+  800fc0:	56                   	push   %esi
+  800fc1:	ff d0                	call   *%eax
+  800fc3:	89 c3                	mov    %eax,%ebx
+  800fc5:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  800fc8:	83 ec 08             	sub    $0x8,%esp
+  800fcb:	56                   	push   %esi
+  800fcc:	6a 00                	push   $0x0
+  800fce:	e8 10 fc ff ff       	call   800be3 <sys_page_unmap>
+	return r;
+  800fd3:	83 c4 10             	add    $0x10,%esp
+  800fd6:	eb b5                	jmp    800f8d <fd_close+0x3c>
+
+00800fd8 <close>:
+
+int
+close(int fdnum)
+{
+  800fd8:	55                   	push   %ebp
+  800fd9:	89 e5                	mov    %esp,%ebp
+  800fdb:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800fde:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800fe1:	50                   	push   %eax
+  800fe2:	ff 75 08             	push   0x8(%ebp)
+  800fe5:	e8 c4 fe ff ff       	call   800eae <fd_lookup>
+  800fea:	83 c4 10             	add    $0x10,%esp
+  800fed:	85 c0                	test   %eax,%eax
+  800fef:	79 02                	jns    800ff3 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  800ff1:	c9                   	leave
+  800ff2:	c3                   	ret
+		return fd_close(fd, 1);
+  800ff3:	83 ec 08             	sub    $0x8,%esp
+  800ff6:	6a 01                	push   $0x1
+  800ff8:	ff 75 f4             	push   -0xc(%ebp)
+  800ffb:	e8 51 ff ff ff       	call   800f51 <fd_close>
+  801000:	83 c4 10             	add    $0x10,%esp
+  801003:	eb ec                	jmp    800ff1 <close+0x19>
+
+00801005 <close_all>:
+
+void
+close_all(void)
+{
+  801005:	55                   	push   %ebp
+  801006:	89 e5                	mov    %esp,%ebp
+  801008:	53                   	push   %ebx
+  801009:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80100c:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801011:	83 ec 0c             	sub    $0xc,%esp
+  801014:	53                   	push   %ebx
+  801015:	e8 be ff ff ff       	call   800fd8 <close>
+	for (i = 0; i < MAXFD; i++)
+  80101a:	83 c3 01             	add    $0x1,%ebx
+  80101d:	83 c4 10             	add    $0x10,%esp
+  801020:	83 fb 20             	cmp    $0x20,%ebx
+  801023:	75 ec                	jne    801011 <close_all+0xc>
+}
+  801025:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801028:	c9                   	leave
+  801029:	c3                   	ret
+
+0080102a <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80102a:	55                   	push   %ebp
+  80102b:	89 e5                	mov    %esp,%ebp
+  80102d:	57                   	push   %edi
+  80102e:	56                   	push   %esi
+  80102f:	53                   	push   %ebx
+  801030:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801033:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801036:	50                   	push   %eax
+  801037:	ff 75 08             	push   0x8(%ebp)
+  80103a:	e8 6f fe ff ff       	call   800eae <fd_lookup>
+  80103f:	89 c3                	mov    %eax,%ebx
+  801041:	83 c4 10             	add    $0x10,%esp
+  801044:	85 c0                	test   %eax,%eax
+  801046:	78 7f                	js     8010c7 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801048:	83 ec 0c             	sub    $0xc,%esp
+  80104b:	ff 75 0c             	push   0xc(%ebp)
+  80104e:	e8 85 ff ff ff       	call   800fd8 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801053:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801056:	c1 e6 0c             	shl    $0xc,%esi
+  801059:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80105f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801062:	89 3c 24             	mov    %edi,(%esp)
+  801065:	e8 d7 fd ff ff       	call   800e41 <fd2data>
+  80106a:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80106c:	89 34 24             	mov    %esi,(%esp)
+  80106f:	e8 cd fd ff ff       	call   800e41 <fd2data>
+  801074:	83 c4 10             	add    $0x10,%esp
+  801077:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80107a:	89 d8                	mov    %ebx,%eax
+  80107c:	c1 e8 16             	shr    $0x16,%eax
+  80107f:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801086:	a8 01                	test   $0x1,%al
+  801088:	74 11                	je     80109b <dup+0x71>
+  80108a:	89 d8                	mov    %ebx,%eax
+  80108c:	c1 e8 0c             	shr    $0xc,%eax
+  80108f:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801096:	f6 c2 01             	test   $0x1,%dl
+  801099:	75 36                	jne    8010d1 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80109b:	89 f8                	mov    %edi,%eax
+  80109d:	c1 e8 0c             	shr    $0xc,%eax
+  8010a0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8010a7:	83 ec 0c             	sub    $0xc,%esp
+  8010aa:	25 07 0e 00 00       	and    $0xe07,%eax
+  8010af:	50                   	push   %eax
+  8010b0:	56                   	push   %esi
+  8010b1:	6a 00                	push   $0x0
+  8010b3:	57                   	push   %edi
+  8010b4:	6a 00                	push   $0x0
+  8010b6:	e8 e6 fa ff ff       	call   800ba1 <sys_page_map>
+  8010bb:	89 c3                	mov    %eax,%ebx
+  8010bd:	83 c4 20             	add    $0x20,%esp
+  8010c0:	85 c0                	test   %eax,%eax
+  8010c2:	78 33                	js     8010f7 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8010c4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8010c7:	89 d8                	mov    %ebx,%eax
+  8010c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010cc:	5b                   	pop    %ebx
+  8010cd:	5e                   	pop    %esi
+  8010ce:	5f                   	pop    %edi
+  8010cf:	5d                   	pop    %ebp
+  8010d0:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8010d1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8010d8:	83 ec 0c             	sub    $0xc,%esp
+  8010db:	25 07 0e 00 00       	and    $0xe07,%eax
+  8010e0:	50                   	push   %eax
+  8010e1:	ff 75 d4             	push   -0x2c(%ebp)
+  8010e4:	6a 00                	push   $0x0
+  8010e6:	53                   	push   %ebx
+  8010e7:	6a 00                	push   $0x0
+  8010e9:	e8 b3 fa ff ff       	call   800ba1 <sys_page_map>
+  8010ee:	89 c3                	mov    %eax,%ebx
+  8010f0:	83 c4 20             	add    $0x20,%esp
+  8010f3:	85 c0                	test   %eax,%eax
+  8010f5:	79 a4                	jns    80109b <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8010f7:	83 ec 08             	sub    $0x8,%esp
+  8010fa:	56                   	push   %esi
+  8010fb:	6a 00                	push   $0x0
+  8010fd:	e8 e1 fa ff ff       	call   800be3 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801102:	83 c4 08             	add    $0x8,%esp
+  801105:	ff 75 d4             	push   -0x2c(%ebp)
+  801108:	6a 00                	push   $0x0
+  80110a:	e8 d4 fa ff ff       	call   800be3 <sys_page_unmap>
+	return r;
+  80110f:	83 c4 10             	add    $0x10,%esp
+  801112:	eb b3                	jmp    8010c7 <dup+0x9d>
+
+00801114 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801114:	55                   	push   %ebp
+  801115:	89 e5                	mov    %esp,%ebp
+  801117:	56                   	push   %esi
+  801118:	53                   	push   %ebx
+  801119:	83 ec 18             	sub    $0x18,%esp
+  80111c:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80111f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801122:	50                   	push   %eax
+  801123:	56                   	push   %esi
+  801124:	e8 85 fd ff ff       	call   800eae <fd_lookup>
+  801129:	83 c4 10             	add    $0x10,%esp
+  80112c:	85 c0                	test   %eax,%eax
+  80112e:	78 3c                	js     80116c <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801130:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801133:	83 ec 08             	sub    $0x8,%esp
+  801136:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801139:	50                   	push   %eax
+  80113a:	ff 33                	push   (%ebx)
+  80113c:	e8 bd fd ff ff       	call   800efe <dev_lookup>
+  801141:	83 c4 10             	add    $0x10,%esp
+  801144:	85 c0                	test   %eax,%eax
+  801146:	78 24                	js     80116c <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801148:	8b 43 08             	mov    0x8(%ebx),%eax
+  80114b:	83 e0 03             	and    $0x3,%eax
+  80114e:	83 f8 01             	cmp    $0x1,%eax
+  801151:	74 20                	je     801173 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801153:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801156:	8b 40 08             	mov    0x8(%eax),%eax
+  801159:	85 c0                	test   %eax,%eax
+  80115b:	74 37                	je     801194 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80115d:	83 ec 04             	sub    $0x4,%esp
+  801160:	ff 75 10             	push   0x10(%ebp)
+  801163:	ff 75 0c             	push   0xc(%ebp)
+  801166:	53                   	push   %ebx
+  801167:	ff d0                	call   *%eax
+  801169:	83 c4 10             	add    $0x10,%esp
+}
+  80116c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80116f:	5b                   	pop    %ebx
+  801170:	5e                   	pop    %esi
+  801171:	5d                   	pop    %ebp
+  801172:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801173:	a1 08 50 80 00       	mov    0x805008,%eax
+  801178:	8b 40 48             	mov    0x48(%eax),%eax
+  80117b:	83 ec 04             	sub    $0x4,%esp
+  80117e:	56                   	push   %esi
+  80117f:	50                   	push   %eax
+  801180:	68 11 2f 80 00       	push   $0x802f11
+  801185:	e8 2f f0 ff ff       	call   8001b9 <cprintf>
+		return -E_INVAL;
+  80118a:	83 c4 10             	add    $0x10,%esp
+  80118d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801192:	eb d8                	jmp    80116c <read+0x58>
+		return -E_NOT_SUPP;
+  801194:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801199:	eb d1                	jmp    80116c <read+0x58>
+
+0080119b <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80119b:	55                   	push   %ebp
+  80119c:	89 e5                	mov    %esp,%ebp
+  80119e:	57                   	push   %edi
+  80119f:	56                   	push   %esi
+  8011a0:	53                   	push   %ebx
+  8011a1:	83 ec 0c             	sub    $0xc,%esp
+  8011a4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8011a7:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8011aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011af:	eb 02                	jmp    8011b3 <readn+0x18>
+  8011b1:	01 c3                	add    %eax,%ebx
+  8011b3:	39 f3                	cmp    %esi,%ebx
+  8011b5:	73 21                	jae    8011d8 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8011b7:	83 ec 04             	sub    $0x4,%esp
+  8011ba:	89 f0                	mov    %esi,%eax
+  8011bc:	29 d8                	sub    %ebx,%eax
+  8011be:	50                   	push   %eax
+  8011bf:	89 d8                	mov    %ebx,%eax
+  8011c1:	03 45 0c             	add    0xc(%ebp),%eax
+  8011c4:	50                   	push   %eax
+  8011c5:	57                   	push   %edi
+  8011c6:	e8 49 ff ff ff       	call   801114 <read>
+		if (m < 0)
+  8011cb:	83 c4 10             	add    $0x10,%esp
+  8011ce:	85 c0                	test   %eax,%eax
+  8011d0:	78 04                	js     8011d6 <readn+0x3b>
+			return m;
+		if (m == 0)
+  8011d2:	75 dd                	jne    8011b1 <readn+0x16>
+  8011d4:	eb 02                	jmp    8011d8 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8011d6:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8011d8:	89 d8                	mov    %ebx,%eax
+  8011da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011dd:	5b                   	pop    %ebx
+  8011de:	5e                   	pop    %esi
+  8011df:	5f                   	pop    %edi
+  8011e0:	5d                   	pop    %ebp
+  8011e1:	c3                   	ret
+
+008011e2 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8011e2:	55                   	push   %ebp
+  8011e3:	89 e5                	mov    %esp,%ebp
+  8011e5:	56                   	push   %esi
+  8011e6:	53                   	push   %ebx
+  8011e7:	83 ec 18             	sub    $0x18,%esp
+  8011ea:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8011ed:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8011f0:	50                   	push   %eax
+  8011f1:	53                   	push   %ebx
+  8011f2:	e8 b7 fc ff ff       	call   800eae <fd_lookup>
+  8011f7:	83 c4 10             	add    $0x10,%esp
+  8011fa:	85 c0                	test   %eax,%eax
+  8011fc:	78 37                	js     801235 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8011fe:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801201:	83 ec 08             	sub    $0x8,%esp
+  801204:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801207:	50                   	push   %eax
+  801208:	ff 36                	push   (%esi)
+  80120a:	e8 ef fc ff ff       	call   800efe <dev_lookup>
+  80120f:	83 c4 10             	add    $0x10,%esp
+  801212:	85 c0                	test   %eax,%eax
+  801214:	78 1f                	js     801235 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801216:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80121a:	74 20                	je     80123c <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80121c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80121f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801222:	85 c0                	test   %eax,%eax
+  801224:	74 37                	je     80125d <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801226:	83 ec 04             	sub    $0x4,%esp
+  801229:	ff 75 10             	push   0x10(%ebp)
+  80122c:	ff 75 0c             	push   0xc(%ebp)
+  80122f:	56                   	push   %esi
+  801230:	ff d0                	call   *%eax
+  801232:	83 c4 10             	add    $0x10,%esp
+}
+  801235:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801238:	5b                   	pop    %ebx
+  801239:	5e                   	pop    %esi
+  80123a:	5d                   	pop    %ebp
+  80123b:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80123c:	a1 08 50 80 00       	mov    0x805008,%eax
+  801241:	8b 40 48             	mov    0x48(%eax),%eax
+  801244:	83 ec 04             	sub    $0x4,%esp
+  801247:	53                   	push   %ebx
+  801248:	50                   	push   %eax
+  801249:	68 2d 2f 80 00       	push   $0x802f2d
+  80124e:	e8 66 ef ff ff       	call   8001b9 <cprintf>
+		return -E_INVAL;
+  801253:	83 c4 10             	add    $0x10,%esp
+  801256:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80125b:	eb d8                	jmp    801235 <write+0x53>
+		return -E_NOT_SUPP;
+  80125d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801262:	eb d1                	jmp    801235 <write+0x53>
+
+00801264 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801264:	55                   	push   %ebp
+  801265:	89 e5                	mov    %esp,%ebp
+  801267:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80126a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80126d:	50                   	push   %eax
+  80126e:	ff 75 08             	push   0x8(%ebp)
+  801271:	e8 38 fc ff ff       	call   800eae <fd_lookup>
+  801276:	83 c4 10             	add    $0x10,%esp
+  801279:	85 c0                	test   %eax,%eax
+  80127b:	78 0e                	js     80128b <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80127d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801280:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801283:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801286:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80128b:	c9                   	leave
+  80128c:	c3                   	ret
+
+0080128d <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80128d:	55                   	push   %ebp
+  80128e:	89 e5                	mov    %esp,%ebp
+  801290:	56                   	push   %esi
+  801291:	53                   	push   %ebx
+  801292:	83 ec 18             	sub    $0x18,%esp
+  801295:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801298:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80129b:	50                   	push   %eax
+  80129c:	53                   	push   %ebx
+  80129d:	e8 0c fc ff ff       	call   800eae <fd_lookup>
+  8012a2:	83 c4 10             	add    $0x10,%esp
+  8012a5:	85 c0                	test   %eax,%eax
+  8012a7:	78 34                	js     8012dd <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8012a9:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8012ac:	83 ec 08             	sub    $0x8,%esp
+  8012af:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8012b2:	50                   	push   %eax
+  8012b3:	ff 36                	push   (%esi)
+  8012b5:	e8 44 fc ff ff       	call   800efe <dev_lookup>
+  8012ba:	83 c4 10             	add    $0x10,%esp
+  8012bd:	85 c0                	test   %eax,%eax
+  8012bf:	78 1c                	js     8012dd <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8012c1:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8012c5:	74 1d                	je     8012e4 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8012c7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8012ca:	8b 40 18             	mov    0x18(%eax),%eax
+  8012cd:	85 c0                	test   %eax,%eax
+  8012cf:	74 34                	je     801305 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8012d1:	83 ec 08             	sub    $0x8,%esp
+  8012d4:	ff 75 0c             	push   0xc(%ebp)
+  8012d7:	56                   	push   %esi
+  8012d8:	ff d0                	call   *%eax
+  8012da:	83 c4 10             	add    $0x10,%esp
+}
+  8012dd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8012e0:	5b                   	pop    %ebx
+  8012e1:	5e                   	pop    %esi
+  8012e2:	5d                   	pop    %ebp
+  8012e3:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8012e4:	a1 08 50 80 00       	mov    0x805008,%eax
+  8012e9:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8012ec:	83 ec 04             	sub    $0x4,%esp
+  8012ef:	53                   	push   %ebx
+  8012f0:	50                   	push   %eax
+  8012f1:	68 f0 2e 80 00       	push   $0x802ef0
+  8012f6:	e8 be ee ff ff       	call   8001b9 <cprintf>
+		return -E_INVAL;
+  8012fb:	83 c4 10             	add    $0x10,%esp
+  8012fe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801303:	eb d8                	jmp    8012dd <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801305:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80130a:	eb d1                	jmp    8012dd <ftruncate+0x50>
+
+0080130c <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80130c:	55                   	push   %ebp
+  80130d:	89 e5                	mov    %esp,%ebp
+  80130f:	56                   	push   %esi
+  801310:	53                   	push   %ebx
+  801311:	83 ec 18             	sub    $0x18,%esp
+  801314:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801317:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80131a:	50                   	push   %eax
+  80131b:	ff 75 08             	push   0x8(%ebp)
+  80131e:	e8 8b fb ff ff       	call   800eae <fd_lookup>
+  801323:	83 c4 10             	add    $0x10,%esp
+  801326:	85 c0                	test   %eax,%eax
+  801328:	78 49                	js     801373 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80132a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80132d:	83 ec 08             	sub    $0x8,%esp
+  801330:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801333:	50                   	push   %eax
+  801334:	ff 36                	push   (%esi)
+  801336:	e8 c3 fb ff ff       	call   800efe <dev_lookup>
+  80133b:	83 c4 10             	add    $0x10,%esp
+  80133e:	85 c0                	test   %eax,%eax
+  801340:	78 31                	js     801373 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801342:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801345:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801349:	74 2f                	je     80137a <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80134b:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80134e:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801355:	00 00 00 
+	stat->st_isdir = 0;
+  801358:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80135f:	00 00 00 
+	stat->st_dev = dev;
+  801362:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801368:	83 ec 08             	sub    $0x8,%esp
+  80136b:	53                   	push   %ebx
+  80136c:	56                   	push   %esi
+  80136d:	ff 50 14             	call   *0x14(%eax)
+  801370:	83 c4 10             	add    $0x10,%esp
+}
+  801373:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801376:	5b                   	pop    %ebx
+  801377:	5e                   	pop    %esi
+  801378:	5d                   	pop    %ebp
+  801379:	c3                   	ret
+		return -E_NOT_SUPP;
+  80137a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80137f:	eb f2                	jmp    801373 <fstat+0x67>
+
+00801381 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801381:	55                   	push   %ebp
+  801382:	89 e5                	mov    %esp,%ebp
+  801384:	56                   	push   %esi
+  801385:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801386:	83 ec 08             	sub    $0x8,%esp
+  801389:	6a 00                	push   $0x0
+  80138b:	ff 75 08             	push   0x8(%ebp)
+  80138e:	e8 e4 01 00 00       	call   801577 <open>
+  801393:	89 c3                	mov    %eax,%ebx
+  801395:	83 c4 10             	add    $0x10,%esp
+  801398:	85 c0                	test   %eax,%eax
+  80139a:	78 1b                	js     8013b7 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80139c:	83 ec 08             	sub    $0x8,%esp
+  80139f:	ff 75 0c             	push   0xc(%ebp)
+  8013a2:	50                   	push   %eax
+  8013a3:	e8 64 ff ff ff       	call   80130c <fstat>
+  8013a8:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8013aa:	89 1c 24             	mov    %ebx,(%esp)
+  8013ad:	e8 26 fc ff ff       	call   800fd8 <close>
+	return r;
+  8013b2:	83 c4 10             	add    $0x10,%esp
+  8013b5:	89 f3                	mov    %esi,%ebx
+}
+  8013b7:	89 d8                	mov    %ebx,%eax
+  8013b9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013bc:	5b                   	pop    %ebx
+  8013bd:	5e                   	pop    %esi
+  8013be:	5d                   	pop    %ebp
+  8013bf:	c3                   	ret
+
+008013c0 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  8013c0:	55                   	push   %ebp
+  8013c1:	89 e5                	mov    %esp,%ebp
+  8013c3:	56                   	push   %esi
+  8013c4:	53                   	push   %ebx
+  8013c5:	89 c6                	mov    %eax,%esi
+  8013c7:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  8013c9:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  8013d0:	74 27                	je     8013f9 <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8013d2:	6a 07                	push   $0x7
+  8013d4:	68 00 60 80 00       	push   $0x806000
+  8013d9:	56                   	push   %esi
+  8013da:	ff 35 00 50 80 00    	push   0x805000
+  8013e0:	e8 ae 11 00 00       	call   802593 <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  8013e5:	83 c4 0c             	add    $0xc,%esp
+  8013e8:	6a 00                	push   $0x0
+  8013ea:	53                   	push   %ebx
+  8013eb:	6a 00                	push   $0x0
+  8013ed:	e8 2d 11 00 00       	call   80251f <ipc_recv>
+}
+  8013f2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013f5:	5b                   	pop    %ebx
+  8013f6:	5e                   	pop    %esi
+  8013f7:	5d                   	pop    %ebp
+  8013f8:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  8013f9:	83 ec 0c             	sub    $0xc,%esp
+  8013fc:	6a 01                	push   $0x1
+  8013fe:	e8 e4 11 00 00       	call   8025e7 <ipc_find_env>
+  801403:	a3 00 50 80 00       	mov    %eax,0x805000
+  801408:	83 c4 10             	add    $0x10,%esp
+  80140b:	eb c5                	jmp    8013d2 <fsipc+0x12>
+
+0080140d <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80140d:	55                   	push   %ebp
+  80140e:	89 e5                	mov    %esp,%ebp
+  801410:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801413:	8b 45 08             	mov    0x8(%ebp),%eax
+  801416:	8b 40 0c             	mov    0xc(%eax),%eax
+  801419:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.set_size.req_size = newsize;
+  80141e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801421:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801426:	ba 00 00 00 00       	mov    $0x0,%edx
+  80142b:	b8 02 00 00 00       	mov    $0x2,%eax
+  801430:	e8 8b ff ff ff       	call   8013c0 <fsipc>
+}
+  801435:	c9                   	leave
+  801436:	c3                   	ret
+
+00801437 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801437:	55                   	push   %ebp
+  801438:	89 e5                	mov    %esp,%ebp
+  80143a:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80143d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801440:	8b 40 0c             	mov    0xc(%eax),%eax
+  801443:	a3 00 60 80 00       	mov    %eax,0x806000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801448:	ba 00 00 00 00       	mov    $0x0,%edx
+  80144d:	b8 06 00 00 00       	mov    $0x6,%eax
+  801452:	e8 69 ff ff ff       	call   8013c0 <fsipc>
+}
+  801457:	c9                   	leave
+  801458:	c3                   	ret
+
+00801459 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801459:	55                   	push   %ebp
+  80145a:	89 e5                	mov    %esp,%ebp
+  80145c:	53                   	push   %ebx
+  80145d:	83 ec 04             	sub    $0x4,%esp
+  801460:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801463:	8b 45 08             	mov    0x8(%ebp),%eax
+  801466:	8b 40 0c             	mov    0xc(%eax),%eax
+  801469:	a3 00 60 80 00       	mov    %eax,0x806000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80146e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801473:	b8 05 00 00 00       	mov    $0x5,%eax
+  801478:	e8 43 ff ff ff       	call   8013c0 <fsipc>
+  80147d:	85 c0                	test   %eax,%eax
+  80147f:	78 2c                	js     8014ad <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801481:	83 ec 08             	sub    $0x8,%esp
+  801484:	68 00 60 80 00       	push   $0x806000
+  801489:	53                   	push   %ebx
+  80148a:	e8 e3 f2 ff ff       	call   800772 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  80148f:	a1 80 60 80 00       	mov    0x806080,%eax
+  801494:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80149a:	a1 84 60 80 00       	mov    0x806084,%eax
+  80149f:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  8014a5:	83 c4 10             	add    $0x10,%esp
+  8014a8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8014ad:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014b0:	c9                   	leave
+  8014b1:	c3                   	ret
+
+008014b2 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8014b2:	55                   	push   %ebp
+  8014b3:	89 e5                	mov    %esp,%ebp
+  8014b5:	83 ec 0c             	sub    $0xc,%esp
+  8014b8:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8014bb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014be:	8b 52 0c             	mov    0xc(%edx),%edx
+  8014c1:	89 15 00 60 80 00    	mov    %edx,0x806000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8014c7:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8014cc:	39 d0                	cmp    %edx,%eax
+  8014ce:	0f 47 c2             	cmova  %edx,%eax
+  8014d1:	a3 04 60 80 00       	mov    %eax,0x806004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  8014d6:	50                   	push   %eax
+  8014d7:	ff 75 0c             	push   0xc(%ebp)
+  8014da:	68 08 60 80 00       	push   $0x806008
+  8014df:	e8 14 f4 ff ff       	call   8008f8 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  8014e4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014e9:	b8 04 00 00 00       	mov    $0x4,%eax
+  8014ee:	e8 cd fe ff ff       	call   8013c0 <fsipc>
+}
+  8014f3:	c9                   	leave
+  8014f4:	c3                   	ret
+
+008014f5 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8014f5:	55                   	push   %ebp
+  8014f6:	89 e5                	mov    %esp,%ebp
+  8014f8:	56                   	push   %esi
+  8014f9:	53                   	push   %ebx
+  8014fa:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8014fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801500:	8b 40 0c             	mov    0xc(%eax),%eax
+  801503:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read.req_n = n;
+  801508:	89 35 04 60 80 00    	mov    %esi,0x806004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  80150e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801513:	b8 03 00 00 00       	mov    $0x3,%eax
+  801518:	e8 a3 fe ff ff       	call   8013c0 <fsipc>
+  80151d:	89 c3                	mov    %eax,%ebx
+  80151f:	85 c0                	test   %eax,%eax
+  801521:	78 1f                	js     801542 <devfile_read+0x4d>
+  assert(r <= n);
+  801523:	39 c6                	cmp    %eax,%esi
+  801525:	72 24                	jb     80154b <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  801527:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80152c:	7f 33                	jg     801561 <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80152e:	83 ec 04             	sub    $0x4,%esp
+  801531:	50                   	push   %eax
+  801532:	68 00 60 80 00       	push   $0x806000
+  801537:	ff 75 0c             	push   0xc(%ebp)
+  80153a:	e8 b9 f3 ff ff       	call   8008f8 <memmove>
+  return r;
+  80153f:	83 c4 10             	add    $0x10,%esp
+}
+  801542:	89 d8                	mov    %ebx,%eax
+  801544:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801547:	5b                   	pop    %ebx
+  801548:	5e                   	pop    %esi
+  801549:	5d                   	pop    %ebp
+  80154a:	c3                   	ret
+  assert(r <= n);
+  80154b:	68 60 2f 80 00       	push   $0x802f60
+  801550:	68 67 2f 80 00       	push   $0x802f67
+  801555:	6a 78                	push   $0x78
+  801557:	68 7c 2f 80 00       	push   $0x802f7c
+  80155c:	e8 7d eb ff ff       	call   8000de <_panic>
+  assert(r <= PGSIZE);
+  801561:	68 87 2f 80 00       	push   $0x802f87
+  801566:	68 67 2f 80 00       	push   $0x802f67
+  80156b:	6a 79                	push   $0x79
+  80156d:	68 7c 2f 80 00       	push   $0x802f7c
+  801572:	e8 67 eb ff ff       	call   8000de <_panic>
+
+00801577 <open>:
+open(const char *path, int mode) {
+  801577:	55                   	push   %ebp
+  801578:	89 e5                	mov    %esp,%ebp
+  80157a:	56                   	push   %esi
+  80157b:	53                   	push   %ebx
+  80157c:	83 ec 1c             	sub    $0x1c,%esp
+  80157f:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801582:	56                   	push   %esi
+  801583:	e8 af f1 ff ff       	call   800737 <strlen>
+  801588:	83 c4 10             	add    $0x10,%esp
+  80158b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801590:	7f 6c                	jg     8015fe <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801592:	83 ec 0c             	sub    $0xc,%esp
+  801595:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801598:	50                   	push   %eax
+  801599:	e8 ba f8 ff ff       	call   800e58 <fd_alloc>
+  80159e:	89 c3                	mov    %eax,%ebx
+  8015a0:	83 c4 10             	add    $0x10,%esp
+  8015a3:	85 c0                	test   %eax,%eax
+  8015a5:	78 3c                	js     8015e3 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  8015a7:	83 ec 08             	sub    $0x8,%esp
+  8015aa:	56                   	push   %esi
+  8015ab:	68 00 60 80 00       	push   $0x806000
+  8015b0:	e8 bd f1 ff ff       	call   800772 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  8015b5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8015b8:	a3 00 64 80 00       	mov    %eax,0x806400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8015bd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8015c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8015c5:	e8 f6 fd ff ff       	call   8013c0 <fsipc>
+  8015ca:	89 c3                	mov    %eax,%ebx
+  8015cc:	83 c4 10             	add    $0x10,%esp
+  8015cf:	85 c0                	test   %eax,%eax
+  8015d1:	78 19                	js     8015ec <open+0x75>
+  return fd2num(fd);
+  8015d3:	83 ec 0c             	sub    $0xc,%esp
+  8015d6:	ff 75 f4             	push   -0xc(%ebp)
+  8015d9:	e8 53 f8 ff ff       	call   800e31 <fd2num>
+  8015de:	89 c3                	mov    %eax,%ebx
+  8015e0:	83 c4 10             	add    $0x10,%esp
+}
+  8015e3:	89 d8                	mov    %ebx,%eax
+  8015e5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015e8:	5b                   	pop    %ebx
+  8015e9:	5e                   	pop    %esi
+  8015ea:	5d                   	pop    %ebp
+  8015eb:	c3                   	ret
+    fd_close(fd, 0);
+  8015ec:	83 ec 08             	sub    $0x8,%esp
+  8015ef:	6a 00                	push   $0x0
+  8015f1:	ff 75 f4             	push   -0xc(%ebp)
+  8015f4:	e8 58 f9 ff ff       	call   800f51 <fd_close>
+    return r;
+  8015f9:	83 c4 10             	add    $0x10,%esp
+  8015fc:	eb e5                	jmp    8015e3 <open+0x6c>
+    return -E_BAD_PATH;
+  8015fe:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801603:	eb de                	jmp    8015e3 <open+0x6c>
+
+00801605 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  801605:	55                   	push   %ebp
+  801606:	89 e5                	mov    %esp,%ebp
+  801608:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  80160b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801610:	b8 08 00 00 00       	mov    $0x8,%eax
+  801615:	e8 a6 fd ff ff       	call   8013c0 <fsipc>
+}
+  80161a:	c9                   	leave
+  80161b:	c3                   	ret
+
+0080161c <spawn>:
+// prog: the pathname of the program to run.
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv) {
+  80161c:	55                   	push   %ebp
+  80161d:	89 e5                	mov    %esp,%ebp
+  80161f:	57                   	push   %edi
+  801620:	56                   	push   %esi
+  801621:	53                   	push   %ebx
+  801622:	81 ec 84 02 00 00    	sub    $0x284,%esp
+  //   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+  //     correct initial eip and esp values in the child.
+  //
+  //   - Start the child process running with sys_env_set_status().
+
+  if ((r = open(prog, O_RDONLY)) < 0)
+  801628:	6a 00                	push   $0x0
+  80162a:	ff 75 08             	push   0x8(%ebp)
+  80162d:	e8 45 ff ff ff       	call   801577 <open>
+  801632:	89 85 8c fd ff ff    	mov    %eax,-0x274(%ebp)
+  801638:	83 c4 10             	add    $0x10,%esp
+  80163b:	85 c0                	test   %eax,%eax
+  80163d:	0f 88 f8 04 00 00    	js     801b3b <spawn+0x51f>
+  801643:	89 c1                	mov    %eax,%ecx
+    return r;
+  fd = r;
+
+  // Read elf header
+  elf = (struct Elf *) elf_buf;
+  if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf)
+  801645:	83 ec 04             	sub    $0x4,%esp
+  801648:	68 00 02 00 00       	push   $0x200
+  80164d:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  801653:	50                   	push   %eax
+  801654:	51                   	push   %ecx
+  801655:	e8 41 fb ff ff       	call   80119b <readn>
+  80165a:	83 c4 10             	add    $0x10,%esp
+  80165d:	3d 00 02 00 00       	cmp    $0x200,%eax
+  801662:	75 5a                	jne    8016be <spawn+0xa2>
+      || elf->e_magic != ELF_MAGIC) {
+  801664:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  80166b:	45 4c 46 
+  80166e:	75 4e                	jne    8016be <spawn+0xa2>
+
+// This must be inlined.  Exercise for reader: why?
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+  envid_t ret;
+  asm volatile("int %2"
+  801670:	b8 07 00 00 00       	mov    $0x7,%eax
+  801675:	cd 30                	int    $0x30
+  801677:	89 85 88 fd ff ff    	mov    %eax,-0x278(%ebp)
+    cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+    return -E_NOT_EXEC;
+  }
+
+  // Create new child environment
+  if ((r = sys_exofork()) < 0)
+  80167d:	85 c0                	test   %eax,%eax
+  80167f:	0f 88 aa 04 00 00    	js     801b2f <spawn+0x513>
+    return r;
+  child = r;
+
+  // Set up trap frame, including initial stack.
+  child_tf = envs[ENVX(child)].env_tf;
+  801685:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80168a:	8d 34 c0             	lea    (%eax,%eax,8),%esi
+  80168d:	c1 e6 04             	shl    $0x4,%esi
+  801690:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  801696:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  80169c:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8016a1:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  child_tf.tf_eip = elf->e_entry;
+  8016a3:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  8016a9:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  uintptr_t *argv_store;
+
+  // Count the number of arguments (argc)
+  // and the total amount of space needed for strings (string_size).
+  string_size = 0;
+  for (argc = 0; argv[argc] != 0; argc++)
+  8016af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  string_size = 0;
+  8016b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8016b9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  for (argc = 0; argv[argc] != 0; argc++)
+  8016bc:	eb 4b                	jmp    801709 <spawn+0xed>
+    close(fd);
+  8016be:	83 ec 0c             	sub    $0xc,%esp
+  8016c1:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  8016c7:	e8 0c f9 ff ff       	call   800fd8 <close>
+    cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  8016cc:	83 c4 0c             	add    $0xc,%esp
+  8016cf:	68 7f 45 4c 46       	push   $0x464c457f
+  8016d4:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  8016da:	68 93 2f 80 00       	push   $0x802f93
+  8016df:	e8 d5 ea ff ff       	call   8001b9 <cprintf>
+    return -E_NOT_EXEC;
+  8016e4:	83 c4 10             	add    $0x10,%esp
+  8016e7:	c7 85 8c fd ff ff f2 	movl   $0xfffffff2,-0x274(%ebp)
+  8016ee:	ff ff ff 
+  8016f1:	e9 45 04 00 00       	jmp    801b3b <spawn+0x51f>
+    string_size += strlen(argv[argc]) + 1;
+  8016f6:	83 ec 0c             	sub    $0xc,%esp
+  8016f9:	50                   	push   %eax
+  8016fa:	e8 38 f0 ff ff       	call   800737 <strlen>
+  8016ff:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+  for (argc = 0; argv[argc] != 0; argc++)
+  801703:	83 c3 01             	add    $0x1,%ebx
+  801706:	83 c4 10             	add    $0x10,%esp
+  801709:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  80170c:	85 c0                	test   %eax,%eax
+  80170e:	75 e6                	jne    8016f6 <spawn+0xda>
+  // Determine where to place the strings and the argv array.
+  // Set up pointers into the temporary page 'UTEMP'; we'll map a page
+  // there later, then remap that page into the child environment
+  // at (USTACKTOP - PGSIZE).
+  // strings is the topmost thing on the stack.
+  string_store = (char *) UTEMP + PGSIZE - string_size;
+  801710:	89 9d 84 fd ff ff    	mov    %ebx,-0x27c(%ebp)
+  801716:	bf 00 10 40 00       	mov    $0x401000,%edi
+  80171b:	29 f7                	sub    %esi,%edi
+  // argv is below that.  There's one argument pointer per argument, plus
+  // a null pointer.
+  argv_store = (uintptr_t *) (ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  80171d:	89 fa                	mov    %edi,%edx
+  80171f:	83 e2 fc             	and    $0xfffffffc,%edx
+  801722:	8d 04 9d 04 00 00 00 	lea    0x4(,%ebx,4),%eax
+  801729:	29 c2                	sub    %eax,%edx
+  80172b:	89 95 94 fd ff ff    	mov    %edx,-0x26c(%ebp)
+
+  // Make sure that argv, strings, and the 2 words that hold 'argc'
+  // and 'argv' themselves will all fit in a single stack page.
+  if ((void *) (argv_store - 2) < (void *) UTEMP)
+  801731:	8d 42 f8             	lea    -0x8(%edx),%eax
+  801734:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  801739:	0f 86 1f 04 00 00    	jbe    801b5e <spawn+0x542>
+    return -E_NO_MEM;
+
+  // Allocate the single stack page at UTEMP.
+  if ((r = sys_page_alloc(0, (void *) UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  80173f:	83 ec 04             	sub    $0x4,%esp
+  801742:	6a 07                	push   $0x7
+  801744:	68 00 00 40 00       	push   $0x400000
+  801749:	6a 00                	push   $0x0
+  80174b:	e8 0e f4 ff ff       	call   800b5e <sys_page_alloc>
+  801750:	83 c4 10             	add    $0x10,%esp
+  801753:	85 c0                	test   %eax,%eax
+  801755:	0f 88 08 04 00 00    	js     801b63 <spawn+0x547>
+  //	  (Again, argv should use an address valid in the child's
+  //	  environment.)
+  //
+  //	* Set *init_esp to the initial stack pointer for the child,
+  //	  (Again, use an address valid in the child's environment.)
+  for (i = 0; i < argc; i++) {
+  80175b:	be 00 00 00 00       	mov    $0x0,%esi
+  801760:	89 9d 90 fd ff ff    	mov    %ebx,-0x270(%ebp)
+  801766:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801769:	39 b5 90 fd ff ff    	cmp    %esi,-0x270(%ebp)
+  80176f:	7e 32                	jle    8017a3 <spawn+0x187>
+    argv_store[i] = UTEMP2USTACK(string_store);
+  801771:	8d 87 00 d0 7f ee    	lea    -0x11803000(%edi),%eax
+  801777:	8b 8d 94 fd ff ff    	mov    -0x26c(%ebp),%ecx
+  80177d:	89 04 b1             	mov    %eax,(%ecx,%esi,4)
+    strcpy(string_store, argv[i]);
+  801780:	83 ec 08             	sub    $0x8,%esp
+  801783:	ff 34 b3             	push   (%ebx,%esi,4)
+  801786:	57                   	push   %edi
+  801787:	e8 e6 ef ff ff       	call   800772 <strcpy>
+    string_store += strlen(argv[i]) + 1;
+  80178c:	83 c4 04             	add    $0x4,%esp
+  80178f:	ff 34 b3             	push   (%ebx,%esi,4)
+  801792:	e8 a0 ef ff ff       	call   800737 <strlen>
+  801797:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+  for (i = 0; i < argc; i++) {
+  80179b:	83 c6 01             	add    $0x1,%esi
+  80179e:	83 c4 10             	add    $0x10,%esp
+  8017a1:	eb c6                	jmp    801769 <spawn+0x14d>
+  }
+  argv_store[argc] = 0;
+  8017a3:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  8017a9:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  8017af:	c7 04 88 00 00 00 00 	movl   $0x0,(%eax,%ecx,4)
+  assert(string_store == (char *) UTEMP + PGSIZE);
+  8017b6:	81 ff 00 10 40 00    	cmp    $0x401000,%edi
+  8017bc:	0f 85 87 00 00 00    	jne    801849 <spawn+0x22d>
+
+  argv_store[-1] = UTEMP2USTACK(argv_store);
+  8017c2:	8b 8d 94 fd ff ff    	mov    -0x26c(%ebp),%ecx
+  8017c8:	8d 81 00 d0 7f ee    	lea    -0x11803000(%ecx),%eax
+  8017ce:	89 41 fc             	mov    %eax,-0x4(%ecx)
+  argv_store[-2] = argc;
+  8017d1:	89 c8                	mov    %ecx,%eax
+  8017d3:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  8017d9:	89 48 f8             	mov    %ecx,-0x8(%eax)
+
+  *init_esp = UTEMP2USTACK(&argv_store[-2]);
+  8017dc:	2d 08 30 80 11       	sub    $0x11803008,%eax
+  8017e1:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+
+  // After completing the stack, map it into the child's address space
+  // and unmap it from ours!
+  if ((r = sys_page_map(0, UTEMP, child, (void *) (USTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  8017e7:	83 ec 0c             	sub    $0xc,%esp
+  8017ea:	6a 07                	push   $0x7
+  8017ec:	68 00 d0 bf ee       	push   $0xeebfd000
+  8017f1:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  8017f7:	68 00 00 40 00       	push   $0x400000
+  8017fc:	6a 00                	push   $0x0
+  8017fe:	e8 9e f3 ff ff       	call   800ba1 <sys_page_map>
+  801803:	89 c3                	mov    %eax,%ebx
+  801805:	83 c4 20             	add    $0x20,%esp
+  801808:	85 c0                	test   %eax,%eax
+  80180a:	0f 88 5b 03 00 00    	js     801b6b <spawn+0x54f>
+    goto error;
+  if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  801810:	83 ec 08             	sub    $0x8,%esp
+  801813:	68 00 00 40 00       	push   $0x400000
+  801818:	6a 00                	push   $0x0
+  80181a:	e8 c4 f3 ff ff       	call   800be3 <sys_page_unmap>
+  80181f:	89 c3                	mov    %eax,%ebx
+  801821:	83 c4 10             	add    $0x10,%esp
+  801824:	85 c0                	test   %eax,%eax
+  801826:	0f 88 3f 03 00 00    	js     801b6b <spawn+0x54f>
+  ph = (struct Proghdr *) (elf_buf + elf->e_phoff);
+  80182c:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  801832:	8d 8c 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%ecx
+  for (i = 0; i < elf->e_phnum; i++, ph++) {
+  801839:	ba 00 00 00 00       	mov    $0x0,%edx
+  80183e:	89 c8                	mov    %ecx,%eax
+  801840:	89 d1                	mov    %edx,%ecx
+  801842:	89 c2                	mov    %eax,%edx
+  801844:	e9 5a 01 00 00       	jmp    8019a3 <spawn+0x387>
+  assert(string_store == (char *) UTEMP + PGSIZE);
+  801849:	68 08 30 80 00       	push   $0x803008
+  80184e:	68 67 2f 80 00       	push   $0x802f67
+  801853:	68 52 01 00 00       	push   $0x152
+  801858:	68 ad 2f 80 00       	push   $0x802fad
+  80185d:	e8 7c e8 ff ff       	call   8000de <_panic>
+      // allocate a blank page
+      if ((r = sys_page_alloc(child, (void *) (va + i), perm)) < 0)
+        return r;
+    } else {
+      // from file
+      if ((r = sys_page_alloc(0, UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  801862:	83 ec 04             	sub    $0x4,%esp
+  801865:	6a 07                	push   $0x7
+  801867:	68 00 00 40 00       	push   $0x400000
+  80186c:	6a 00                	push   $0x0
+  80186e:	e8 eb f2 ff ff       	call   800b5e <sys_page_alloc>
+  801873:	83 c4 10             	add    $0x10,%esp
+  801876:	85 c0                	test   %eax,%eax
+  801878:	0f 88 cb 02 00 00    	js     801b49 <spawn+0x52d>
+        return r;
+      if ((r = seek(fd, fileoffset + i)) < 0)
+  80187e:	83 ec 08             	sub    $0x8,%esp
+  801881:	8b 95 80 fd ff ff    	mov    -0x280(%ebp),%edx
+  801887:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  80188d:	01 d0                	add    %edx,%eax
+  80188f:	50                   	push   %eax
+  801890:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  801896:	e8 c9 f9 ff ff       	call   801264 <seek>
+  80189b:	83 c4 10             	add    $0x10,%esp
+  80189e:	85 c0                	test   %eax,%eax
+  8018a0:	0f 88 aa 02 00 00    	js     801b50 <spawn+0x534>
+        return r;
+      if ((r = readn(fd, UTEMP, MIN(PGSIZE, filesz - i))) < 0)
+  8018a6:	83 ec 04             	sub    $0x4,%esp
+  8018a9:	89 fa                	mov    %edi,%edx
+  8018ab:	8b 8d 94 fd ff ff    	mov    -0x26c(%ebp),%ecx
+  8018b1:	29 ca                	sub    %ecx,%edx
+  8018b3:	89 d0                	mov    %edx,%eax
+  8018b5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8018ba:	39 d0                	cmp    %edx,%eax
+  8018bc:	0f 47 c2             	cmova  %edx,%eax
+  8018bf:	50                   	push   %eax
+  8018c0:	68 00 00 40 00       	push   $0x400000
+  8018c5:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  8018cb:	e8 cb f8 ff ff       	call   80119b <readn>
+  8018d0:	83 c4 10             	add    $0x10,%esp
+  8018d3:	85 c0                	test   %eax,%eax
+  8018d5:	0f 88 7c 02 00 00    	js     801b57 <spawn+0x53b>
+        return r;
+      if ((r = sys_page_map(0, UTEMP, child, (void *) (va + i), perm)) < 0)
+  8018db:	83 ec 0c             	sub    $0xc,%esp
+  8018de:	ff b5 84 fd ff ff    	push   -0x27c(%ebp)
+  8018e4:	56                   	push   %esi
+  8018e5:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  8018eb:	68 00 00 40 00       	push   $0x400000
+  8018f0:	6a 00                	push   $0x0
+  8018f2:	e8 aa f2 ff ff       	call   800ba1 <sys_page_map>
+  8018f7:	83 c4 20             	add    $0x20,%esp
+  8018fa:	85 c0                	test   %eax,%eax
+  8018fc:	78 7e                	js     80197c <spawn+0x360>
+        panic("spawn: sys_page_map data: %e", r);
+      sys_page_unmap(0, UTEMP);
+  8018fe:	83 ec 08             	sub    $0x8,%esp
+  801901:	68 00 00 40 00       	push   $0x400000
+  801906:	6a 00                	push   $0x0
+  801908:	e8 d6 f2 ff ff       	call   800be3 <sys_page_unmap>
+  80190d:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < memsz; i += PGSIZE) {
+  801910:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801916:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80191c:	89 9d 94 fd ff ff    	mov    %ebx,-0x26c(%ebp)
+  801922:	8b 85 90 fd ff ff    	mov    -0x270(%ebp),%eax
+  801928:	39 c3                	cmp    %eax,%ebx
+  80192a:	73 65                	jae    801991 <spawn+0x375>
+    if (i >= filesz) {
+  80192c:	39 fb                	cmp    %edi,%ebx
+  80192e:	0f 82 2e ff ff ff    	jb     801862 <spawn+0x246>
+      if ((r = sys_page_alloc(child, (void *) (va + i), perm)) < 0)
+  801934:	83 ec 04             	sub    $0x4,%esp
+  801937:	ff b5 84 fd ff ff    	push   -0x27c(%ebp)
+  80193d:	56                   	push   %esi
+  80193e:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  801944:	e8 15 f2 ff ff       	call   800b5e <sys_page_alloc>
+  801949:	83 c4 10             	add    $0x10,%esp
+  80194c:	85 c0                	test   %eax,%eax
+  80194e:	79 c0                	jns    801910 <spawn+0x2f4>
+  801950:	89 c7                	mov    %eax,%edi
+  sys_env_destroy(child);
+  801952:	83 ec 0c             	sub    $0xc,%esp
+  801955:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  80195b:	e8 7f f1 ff ff       	call   800adf <sys_env_destroy>
+  close(fd);
+  801960:	83 c4 04             	add    $0x4,%esp
+  801963:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  801969:	e8 6a f6 ff ff       	call   800fd8 <close>
+  return r;
+  80196e:	83 c4 10             	add    $0x10,%esp
+  801971:	89 bd 8c fd ff ff    	mov    %edi,-0x274(%ebp)
+  801977:	e9 bf 01 00 00       	jmp    801b3b <spawn+0x51f>
+        panic("spawn: sys_page_map data: %e", r);
+  80197c:	50                   	push   %eax
+  80197d:	68 b9 2f 80 00       	push   $0x802fb9
+  801982:	68 84 01 00 00       	push   $0x184
+  801987:	68 ad 2f 80 00       	push   $0x802fad
+  80198c:	e8 4d e7 ff ff       	call   8000de <_panic>
+  801991:	8b 8d 7c fd ff ff    	mov    -0x284(%ebp),%ecx
+  801997:	8b 95 78 fd ff ff    	mov    -0x288(%ebp),%edx
+  for (i = 0; i < elf->e_phnum; i++, ph++) {
+  80199d:	83 c1 01             	add    $0x1,%ecx
+  8019a0:	83 c2 20             	add    $0x20,%edx
+  8019a3:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  8019aa:	39 c8                	cmp    %ecx,%eax
+  8019ac:	0f 8e 88 00 00 00    	jle    801a3a <spawn+0x41e>
+    if (ph->p_type != ELF_PROG_LOAD)
+  8019b2:	83 3a 01             	cmpl   $0x1,(%edx)
+  8019b5:	75 e6                	jne    80199d <spawn+0x381>
+    if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  8019b7:	8b 42 18             	mov    0x18(%edx),%eax
+  8019ba:	83 e0 02             	and    $0x2,%eax
+    perm = PTE_P | PTE_U;
+  8019bd:	83 f8 01             	cmp    $0x1,%eax
+  8019c0:	19 c0                	sbb    %eax,%eax
+  8019c2:	83 e0 fe             	and    $0xfffffffe,%eax
+  8019c5:	83 c0 07             	add    $0x7,%eax
+    if ((r = map_segment(child, ph->p_va, ph->p_memsz, fd, ph->p_filesz, ph->p_offset, perm)) < 0)
+  8019c8:	8b 72 04             	mov    0x4(%edx),%esi
+  8019cb:	89 b5 80 fd ff ff    	mov    %esi,-0x280(%ebp)
+  8019d1:	8b 7a 10             	mov    0x10(%edx),%edi
+  8019d4:	89 bd 94 fd ff ff    	mov    %edi,-0x26c(%ebp)
+  8019da:	8b 5a 14             	mov    0x14(%edx),%ebx
+  8019dd:	89 9d 90 fd ff ff    	mov    %ebx,-0x270(%ebp)
+  8019e3:	8b 7a 08             	mov    0x8(%edx),%edi
+  8019e6:	89 bd 84 fd ff ff    	mov    %edi,-0x27c(%ebp)
+  if ((i = PGOFF(va))) {
+  8019ec:	89 fb                	mov    %edi,%ebx
+  8019ee:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  8019f4:	74 1c                	je     801a12 <spawn+0x3f6>
+    va -= i;
+  8019f6:	29 df                	sub    %ebx,%edi
+  8019f8:	89 bd 84 fd ff ff    	mov    %edi,-0x27c(%ebp)
+    memsz += i;
+  8019fe:	01 9d 90 fd ff ff    	add    %ebx,-0x270(%ebp)
+    filesz += i;
+  801a04:	01 9d 94 fd ff ff    	add    %ebx,-0x26c(%ebp)
+    fileoffset -= i;
+  801a0a:	29 de                	sub    %ebx,%esi
+  801a0c:	89 b5 80 fd ff ff    	mov    %esi,-0x280(%ebp)
+  for (i = 0; i < memsz; i += PGSIZE) {
+  801a12:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a17:	8b bd 94 fd ff ff    	mov    -0x26c(%ebp),%edi
+  801a1d:	8b b5 84 fd ff ff    	mov    -0x27c(%ebp),%esi
+  801a23:	89 8d 7c fd ff ff    	mov    %ecx,-0x284(%ebp)
+  801a29:	89 95 78 fd ff ff    	mov    %edx,-0x288(%ebp)
+  801a2f:	89 85 84 fd ff ff    	mov    %eax,-0x27c(%ebp)
+  801a35:	e9 e2 fe ff ff       	jmp    80191c <spawn+0x300>
+  close(fd);
+  801a3a:	83 ec 0c             	sub    $0xc,%esp
+  801a3d:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  801a43:	e8 90 f5 ff ff       	call   800fd8 <close>
+  801a48:	83 c4 10             	add    $0x10,%esp
+  // LAB 5: Your code here.
+  int r;
+  unsigned perm = PTE_P | PTE_U | PTE_SHARE;
+
+  uintptr_t addr;
+  for (addr = 0; addr < UTOP; addr += PGSIZE)
+  801a4b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a50:	8b b5 88 fd ff ff    	mov    -0x278(%ebp),%esi
+  801a56:	eb 0e                	jmp    801a66 <spawn+0x44a>
+  801a58:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801a5e:	81 fb 00 00 c0 ee    	cmp    $0xeec00000,%ebx
+  801a64:	74 5e                	je     801ac4 <spawn+0x4a8>
+    if ((uvpd[PDX(addr)] & PTE_P) && (uvpt[PGNUM(addr)] & perm) == perm) {
+  801a66:	89 d8                	mov    %ebx,%eax
+  801a68:	c1 e8 16             	shr    $0x16,%eax
+  801a6b:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801a72:	a8 01                	test   $0x1,%al
+  801a74:	74 e2                	je     801a58 <spawn+0x43c>
+  801a76:	89 da                	mov    %ebx,%edx
+  801a78:	c1 ea 0c             	shr    $0xc,%edx
+  801a7b:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  801a82:	25 05 04 00 00       	and    $0x405,%eax
+  801a87:	3d 05 04 00 00       	cmp    $0x405,%eax
+  801a8c:	75 ca                	jne    801a58 <spawn+0x43c>
+      if ((r = sys_page_map(0, (void *) addr, child, (void *) addr, uvpt[PGNUM(addr)] & PTE_SYSCALL)) < 0) {
+  801a8e:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  801a95:	83 ec 0c             	sub    $0xc,%esp
+  801a98:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a9d:	50                   	push   %eax
+  801a9e:	53                   	push   %ebx
+  801a9f:	56                   	push   %esi
+  801aa0:	53                   	push   %ebx
+  801aa1:	6a 00                	push   $0x0
+  801aa3:	e8 f9 f0 ff ff       	call   800ba1 <sys_page_map>
+  801aa8:	83 c4 20             	add    $0x20,%esp
+  801aab:	85 c0                	test   %eax,%eax
+  801aad:	79 a9                	jns    801a58 <spawn+0x43c>
+        panic("copy_shared_pages : sys_page_map: %e\n", r);
+  801aaf:	50                   	push   %eax
+  801ab0:	68 30 30 80 00       	push   $0x803030
+  801ab5:	68 96 01 00 00       	push   $0x196
+  801aba:	68 ad 2f 80 00       	push   $0x802fad
+  801abf:	e8 1a e6 ff ff       	call   8000de <_panic>
+  if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  801ac4:	83 ec 08             	sub    $0x8,%esp
+  801ac7:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  801acd:	50                   	push   %eax
+  801ace:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  801ad4:	e8 8e f1 ff ff       	call   800c67 <sys_env_set_trapframe>
+  801ad9:	83 c4 10             	add    $0x10,%esp
+  801adc:	85 c0                	test   %eax,%eax
+  801ade:	78 25                	js     801b05 <spawn+0x4e9>
+  if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  801ae0:	83 ec 08             	sub    $0x8,%esp
+  801ae3:	6a 02                	push   $0x2
+  801ae5:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  801aeb:	e8 35 f1 ff ff       	call   800c25 <sys_env_set_status>
+  801af0:	83 c4 10             	add    $0x10,%esp
+  801af3:	85 c0                	test   %eax,%eax
+  801af5:	78 23                	js     801b1a <spawn+0x4fe>
+  return child;
+  801af7:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  801afd:	89 85 8c fd ff ff    	mov    %eax,-0x274(%ebp)
+  801b03:	eb 36                	jmp    801b3b <spawn+0x51f>
+    panic("sys_env_set_trapframe: %e", r);
+  801b05:	50                   	push   %eax
+  801b06:	68 d6 2f 80 00       	push   $0x802fd6
+  801b0b:	68 86 00 00 00       	push   $0x86
+  801b10:	68 ad 2f 80 00       	push   $0x802fad
+  801b15:	e8 c4 e5 ff ff       	call   8000de <_panic>
+    panic("sys_env_set_status: %e", r);
+  801b1a:	50                   	push   %eax
+  801b1b:	68 f0 2f 80 00       	push   $0x802ff0
+  801b20:	68 89 00 00 00       	push   $0x89
+  801b25:	68 ad 2f 80 00       	push   $0x802fad
+  801b2a:	e8 af e5 ff ff       	call   8000de <_panic>
+    return r;
+  801b2f:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  801b35:	89 85 8c fd ff ff    	mov    %eax,-0x274(%ebp)
+}
+  801b3b:	8b 85 8c fd ff ff    	mov    -0x274(%ebp),%eax
+  801b41:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b44:	5b                   	pop    %ebx
+  801b45:	5e                   	pop    %esi
+  801b46:	5f                   	pop    %edi
+  801b47:	5d                   	pop    %ebp
+  801b48:	c3                   	ret
+  801b49:	89 c7                	mov    %eax,%edi
+  801b4b:	e9 02 fe ff ff       	jmp    801952 <spawn+0x336>
+  801b50:	89 c7                	mov    %eax,%edi
+  801b52:	e9 fb fd ff ff       	jmp    801952 <spawn+0x336>
+  801b57:	89 c7                	mov    %eax,%edi
+  801b59:	e9 f4 fd ff ff       	jmp    801952 <spawn+0x336>
+    return -E_NO_MEM;
+  801b5e:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  return r;
+  801b63:	89 85 8c fd ff ff    	mov    %eax,-0x274(%ebp)
+  801b69:	eb d0                	jmp    801b3b <spawn+0x51f>
+  sys_page_unmap(0, UTEMP);
+  801b6b:	83 ec 08             	sub    $0x8,%esp
+  801b6e:	68 00 00 40 00       	push   $0x400000
+  801b73:	6a 00                	push   $0x0
+  801b75:	e8 69 f0 ff ff       	call   800be3 <sys_page_unmap>
+  801b7a:	83 c4 10             	add    $0x10,%esp
+  801b7d:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+  801b83:	eb b6                	jmp    801b3b <spawn+0x51f>
+
+00801b85 <spawnl>:
+spawnl(const char *prog, const char *arg0, ...) {
+  801b85:	55                   	push   %ebp
+  801b86:	89 e5                	mov    %esp,%ebp
+  801b88:	56                   	push   %esi
+  801b89:	53                   	push   %ebx
+  va_start(vl, arg0);
+  801b8a:	8d 55 10             	lea    0x10(%ebp),%edx
+  int argc = 0;
+  801b8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  while (va_arg(vl, void *) != NULL)
+  801b92:	eb 05                	jmp    801b99 <spawnl+0x14>
+    argc++;
+  801b94:	83 c0 01             	add    $0x1,%eax
+  while (va_arg(vl, void *) != NULL)
+  801b97:	89 ca                	mov    %ecx,%edx
+  801b99:	8d 4a 04             	lea    0x4(%edx),%ecx
+  801b9c:	83 3a 00             	cmpl   $0x0,(%edx)
+  801b9f:	75 f3                	jne    801b94 <spawnl+0xf>
+  const char *argv[argc + 2];
+  801ba1:	8d 14 85 17 00 00 00 	lea    0x17(,%eax,4),%edx
+  801ba8:	83 e2 f0             	and    $0xfffffff0,%edx
+  801bab:	29 d4                	sub    %edx,%esp
+  801bad:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  801bb1:	89 da                	mov    %ebx,%edx
+  801bb3:	c1 ea 02             	shr    $0x2,%edx
+  801bb6:	83 e3 fc             	and    $0xfffffffc,%ebx
+  argv[0] = arg0;
+  801bb9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801bbc:	89 0c 95 00 00 00 00 	mov    %ecx,0x0(,%edx,4)
+  argv[argc + 1] = NULL;
+  801bc3:	c7 44 83 04 00 00 00 	movl   $0x0,0x4(%ebx,%eax,4)
+  801bca:	00 
+  va_start(vl, arg0);
+  801bcb:	8d 4d 10             	lea    0x10(%ebp),%ecx
+  for (i = 0; i < argc; i++)
+  801bce:	89 c2                	mov    %eax,%edx
+  801bd0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bd5:	eb 0b                	jmp    801be2 <spawnl+0x5d>
+    argv[i + 1] = va_arg(vl, const char *);
+  801bd7:	83 c0 01             	add    $0x1,%eax
+  801bda:	8b 31                	mov    (%ecx),%esi
+  801bdc:	89 34 83             	mov    %esi,(%ebx,%eax,4)
+  801bdf:	8d 49 04             	lea    0x4(%ecx),%ecx
+  for (i = 0; i < argc; i++)
+  801be2:	39 d0                	cmp    %edx,%eax
+  801be4:	75 f1                	jne    801bd7 <spawnl+0x52>
+  return spawn(prog, argv);
+  801be6:	83 ec 08             	sub    $0x8,%esp
+  801be9:	53                   	push   %ebx
+  801bea:	ff 75 08             	push   0x8(%ebp)
+  801bed:	e8 2a fa ff ff       	call   80161c <spawn>
+}
+  801bf2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bf5:	5b                   	pop    %ebx
+  801bf6:	5e                   	pop    %esi
+  801bf7:	5d                   	pop    %ebp
+  801bf8:	c3                   	ret
+
+00801bf9 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801bf9:	55                   	push   %ebp
+  801bfa:	89 e5                	mov    %esp,%ebp
+  801bfc:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801bff:	68 56 30 80 00       	push   $0x803056
+  801c04:	ff 75 0c             	push   0xc(%ebp)
+  801c07:	e8 66 eb ff ff       	call   800772 <strcpy>
+	return 0;
+}
+  801c0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c11:	c9                   	leave
+  801c12:	c3                   	ret
+
+00801c13 <devsock_close>:
+{
+  801c13:	55                   	push   %ebp
+  801c14:	89 e5                	mov    %esp,%ebp
+  801c16:	53                   	push   %ebx
+  801c17:	83 ec 10             	sub    $0x10,%esp
+  801c1a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801c1d:	53                   	push   %ebx
+  801c1e:	e8 03 0a 00 00       	call   802626 <pageref>
+  801c23:	89 c2                	mov    %eax,%edx
+  801c25:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801c28:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801c2d:	83 fa 01             	cmp    $0x1,%edx
+  801c30:	74 05                	je     801c37 <devsock_close+0x24>
+}
+  801c32:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c35:	c9                   	leave
+  801c36:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801c37:	83 ec 0c             	sub    $0xc,%esp
+  801c3a:	ff 73 0c             	push   0xc(%ebx)
+  801c3d:	e8 b7 02 00 00       	call   801ef9 <nsipc_close>
+  801c42:	83 c4 10             	add    $0x10,%esp
+  801c45:	eb eb                	jmp    801c32 <devsock_close+0x1f>
+
+00801c47 <devsock_write>:
+{
+  801c47:	55                   	push   %ebp
+  801c48:	89 e5                	mov    %esp,%ebp
+  801c4a:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801c4d:	6a 00                	push   $0x0
+  801c4f:	ff 75 10             	push   0x10(%ebp)
+  801c52:	ff 75 0c             	push   0xc(%ebp)
+  801c55:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c58:	ff 70 0c             	push   0xc(%eax)
+  801c5b:	e8 79 03 00 00       	call   801fd9 <nsipc_send>
+}
+  801c60:	c9                   	leave
+  801c61:	c3                   	ret
+
+00801c62 <devsock_read>:
+{
+  801c62:	55                   	push   %ebp
+  801c63:	89 e5                	mov    %esp,%ebp
+  801c65:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801c68:	6a 00                	push   $0x0
+  801c6a:	ff 75 10             	push   0x10(%ebp)
+  801c6d:	ff 75 0c             	push   0xc(%ebp)
+  801c70:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c73:	ff 70 0c             	push   0xc(%eax)
+  801c76:	e8 ef 02 00 00       	call   801f6a <nsipc_recv>
+}
+  801c7b:	c9                   	leave
+  801c7c:	c3                   	ret
+
+00801c7d <fd2sockid>:
+{
+  801c7d:	55                   	push   %ebp
+  801c7e:	89 e5                	mov    %esp,%ebp
+  801c80:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801c83:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801c86:	52                   	push   %edx
+  801c87:	50                   	push   %eax
+  801c88:	e8 21 f2 ff ff       	call   800eae <fd_lookup>
+  801c8d:	83 c4 10             	add    $0x10,%esp
+  801c90:	85 c0                	test   %eax,%eax
+  801c92:	78 10                	js     801ca4 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801c94:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c97:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  801c9d:	39 08                	cmp    %ecx,(%eax)
+  801c9f:	75 05                	jne    801ca6 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801ca1:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801ca4:	c9                   	leave
+  801ca5:	c3                   	ret
+		return -E_NOT_SUPP;
+  801ca6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801cab:	eb f7                	jmp    801ca4 <fd2sockid+0x27>
+
+00801cad <alloc_sockfd>:
+{
+  801cad:	55                   	push   %ebp
+  801cae:	89 e5                	mov    %esp,%ebp
+  801cb0:	56                   	push   %esi
+  801cb1:	53                   	push   %ebx
+  801cb2:	83 ec 1c             	sub    $0x1c,%esp
+  801cb5:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801cb7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cba:	50                   	push   %eax
+  801cbb:	e8 98 f1 ff ff       	call   800e58 <fd_alloc>
+  801cc0:	89 c3                	mov    %eax,%ebx
+  801cc2:	83 c4 10             	add    $0x10,%esp
+  801cc5:	85 c0                	test   %eax,%eax
+  801cc7:	78 43                	js     801d0c <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801cc9:	83 ec 04             	sub    $0x4,%esp
+  801ccc:	68 07 04 00 00       	push   $0x407
+  801cd1:	ff 75 f4             	push   -0xc(%ebp)
+  801cd4:	6a 00                	push   $0x0
+  801cd6:	e8 83 ee ff ff       	call   800b5e <sys_page_alloc>
+  801cdb:	89 c3                	mov    %eax,%ebx
+  801cdd:	83 c4 10             	add    $0x10,%esp
+  801ce0:	85 c0                	test   %eax,%eax
+  801ce2:	78 28                	js     801d0c <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801ce4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ce7:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801ced:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801cef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cf2:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801cf9:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801cfc:	83 ec 0c             	sub    $0xc,%esp
+  801cff:	50                   	push   %eax
+  801d00:	e8 2c f1 ff ff       	call   800e31 <fd2num>
+  801d05:	89 c3                	mov    %eax,%ebx
+  801d07:	83 c4 10             	add    $0x10,%esp
+  801d0a:	eb 0c                	jmp    801d18 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801d0c:	83 ec 0c             	sub    $0xc,%esp
+  801d0f:	56                   	push   %esi
+  801d10:	e8 e4 01 00 00       	call   801ef9 <nsipc_close>
+		return r;
+  801d15:	83 c4 10             	add    $0x10,%esp
+}
+  801d18:	89 d8                	mov    %ebx,%eax
+  801d1a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d1d:	5b                   	pop    %ebx
+  801d1e:	5e                   	pop    %esi
+  801d1f:	5d                   	pop    %ebp
+  801d20:	c3                   	ret
+
+00801d21 <accept>:
+{
+  801d21:	55                   	push   %ebp
+  801d22:	89 e5                	mov    %esp,%ebp
+  801d24:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d27:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d2a:	e8 4e ff ff ff       	call   801c7d <fd2sockid>
+  801d2f:	85 c0                	test   %eax,%eax
+  801d31:	78 1b                	js     801d4e <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801d33:	83 ec 04             	sub    $0x4,%esp
+  801d36:	ff 75 10             	push   0x10(%ebp)
+  801d39:	ff 75 0c             	push   0xc(%ebp)
+  801d3c:	50                   	push   %eax
+  801d3d:	e8 0e 01 00 00       	call   801e50 <nsipc_accept>
+  801d42:	83 c4 10             	add    $0x10,%esp
+  801d45:	85 c0                	test   %eax,%eax
+  801d47:	78 05                	js     801d4e <accept+0x2d>
+	return alloc_sockfd(r);
+  801d49:	e8 5f ff ff ff       	call   801cad <alloc_sockfd>
+}
+  801d4e:	c9                   	leave
+  801d4f:	c3                   	ret
+
+00801d50 <bind>:
+{
+  801d50:	55                   	push   %ebp
+  801d51:	89 e5                	mov    %esp,%ebp
+  801d53:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d56:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d59:	e8 1f ff ff ff       	call   801c7d <fd2sockid>
+  801d5e:	85 c0                	test   %eax,%eax
+  801d60:	78 12                	js     801d74 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801d62:	83 ec 04             	sub    $0x4,%esp
+  801d65:	ff 75 10             	push   0x10(%ebp)
+  801d68:	ff 75 0c             	push   0xc(%ebp)
+  801d6b:	50                   	push   %eax
+  801d6c:	e8 31 01 00 00       	call   801ea2 <nsipc_bind>
+  801d71:	83 c4 10             	add    $0x10,%esp
+}
+  801d74:	c9                   	leave
+  801d75:	c3                   	ret
+
+00801d76 <shutdown>:
+{
+  801d76:	55                   	push   %ebp
+  801d77:	89 e5                	mov    %esp,%ebp
+  801d79:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d7c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d7f:	e8 f9 fe ff ff       	call   801c7d <fd2sockid>
+  801d84:	85 c0                	test   %eax,%eax
+  801d86:	78 0f                	js     801d97 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801d88:	83 ec 08             	sub    $0x8,%esp
+  801d8b:	ff 75 0c             	push   0xc(%ebp)
+  801d8e:	50                   	push   %eax
+  801d8f:	e8 43 01 00 00       	call   801ed7 <nsipc_shutdown>
+  801d94:	83 c4 10             	add    $0x10,%esp
+}
+  801d97:	c9                   	leave
+  801d98:	c3                   	ret
+
+00801d99 <connect>:
+{
+  801d99:	55                   	push   %ebp
+  801d9a:	89 e5                	mov    %esp,%ebp
+  801d9c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d9f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801da2:	e8 d6 fe ff ff       	call   801c7d <fd2sockid>
+  801da7:	85 c0                	test   %eax,%eax
+  801da9:	78 12                	js     801dbd <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801dab:	83 ec 04             	sub    $0x4,%esp
+  801dae:	ff 75 10             	push   0x10(%ebp)
+  801db1:	ff 75 0c             	push   0xc(%ebp)
+  801db4:	50                   	push   %eax
+  801db5:	e8 59 01 00 00       	call   801f13 <nsipc_connect>
+  801dba:	83 c4 10             	add    $0x10,%esp
+}
+  801dbd:	c9                   	leave
+  801dbe:	c3                   	ret
+
+00801dbf <listen>:
+{
+  801dbf:	55                   	push   %ebp
+  801dc0:	89 e5                	mov    %esp,%ebp
+  801dc2:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801dc5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dc8:	e8 b0 fe ff ff       	call   801c7d <fd2sockid>
+  801dcd:	85 c0                	test   %eax,%eax
+  801dcf:	78 0f                	js     801de0 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801dd1:	83 ec 08             	sub    $0x8,%esp
+  801dd4:	ff 75 0c             	push   0xc(%ebp)
+  801dd7:	50                   	push   %eax
+  801dd8:	e8 6b 01 00 00       	call   801f48 <nsipc_listen>
+  801ddd:	83 c4 10             	add    $0x10,%esp
+}
+  801de0:	c9                   	leave
+  801de1:	c3                   	ret
+
+00801de2 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801de2:	55                   	push   %ebp
+  801de3:	89 e5                	mov    %esp,%ebp
+  801de5:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801de8:	ff 75 10             	push   0x10(%ebp)
+  801deb:	ff 75 0c             	push   0xc(%ebp)
+  801dee:	ff 75 08             	push   0x8(%ebp)
+  801df1:	e8 41 02 00 00       	call   802037 <nsipc_socket>
+  801df6:	83 c4 10             	add    $0x10,%esp
+  801df9:	85 c0                	test   %eax,%eax
+  801dfb:	78 05                	js     801e02 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801dfd:	e8 ab fe ff ff       	call   801cad <alloc_sockfd>
+}
+  801e02:	c9                   	leave
+  801e03:	c3                   	ret
+
+00801e04 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801e04:	55                   	push   %ebp
+  801e05:	89 e5                	mov    %esp,%ebp
+  801e07:	53                   	push   %ebx
+  801e08:	83 ec 04             	sub    $0x4,%esp
+  801e0b:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801e0d:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  801e14:	74 26                	je     801e3c <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801e16:	6a 07                	push   $0x7
+  801e18:	68 00 70 80 00       	push   $0x807000
+  801e1d:	53                   	push   %ebx
+  801e1e:	ff 35 04 50 80 00    	push   0x805004
+  801e24:	e8 6a 07 00 00       	call   802593 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801e29:	83 c4 0c             	add    $0xc,%esp
+  801e2c:	6a 00                	push   $0x0
+  801e2e:	6a 00                	push   $0x0
+  801e30:	6a 00                	push   $0x0
+  801e32:	e8 e8 06 00 00       	call   80251f <ipc_recv>
+}
+  801e37:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e3a:	c9                   	leave
+  801e3b:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801e3c:	83 ec 0c             	sub    $0xc,%esp
+  801e3f:	6a 02                	push   $0x2
+  801e41:	e8 a1 07 00 00       	call   8025e7 <ipc_find_env>
+  801e46:	a3 04 50 80 00       	mov    %eax,0x805004
+  801e4b:	83 c4 10             	add    $0x10,%esp
+  801e4e:	eb c6                	jmp    801e16 <nsipc+0x12>
+
+00801e50 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801e50:	55                   	push   %ebp
+  801e51:	89 e5                	mov    %esp,%ebp
+  801e53:	56                   	push   %esi
+  801e54:	53                   	push   %ebx
+  801e55:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801e58:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e5b:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801e60:	8b 06                	mov    (%esi),%eax
+  801e62:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801e67:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e6c:	e8 93 ff ff ff       	call   801e04 <nsipc>
+  801e71:	89 c3                	mov    %eax,%ebx
+  801e73:	85 c0                	test   %eax,%eax
+  801e75:	79 09                	jns    801e80 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801e77:	89 d8                	mov    %ebx,%eax
+  801e79:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e7c:	5b                   	pop    %ebx
+  801e7d:	5e                   	pop    %esi
+  801e7e:	5d                   	pop    %ebp
+  801e7f:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801e80:	83 ec 04             	sub    $0x4,%esp
+  801e83:	ff 35 10 70 80 00    	push   0x807010
+  801e89:	68 00 70 80 00       	push   $0x807000
+  801e8e:	ff 75 0c             	push   0xc(%ebp)
+  801e91:	e8 62 ea ff ff       	call   8008f8 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801e96:	a1 10 70 80 00       	mov    0x807010,%eax
+  801e9b:	89 06                	mov    %eax,(%esi)
+  801e9d:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801ea0:	eb d5                	jmp    801e77 <nsipc_accept+0x27>
+
+00801ea2 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801ea2:	55                   	push   %ebp
+  801ea3:	89 e5                	mov    %esp,%ebp
+  801ea5:	53                   	push   %ebx
+  801ea6:	83 ec 08             	sub    $0x8,%esp
+  801ea9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801eac:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eaf:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801eb4:	53                   	push   %ebx
+  801eb5:	ff 75 0c             	push   0xc(%ebp)
+  801eb8:	68 04 70 80 00       	push   $0x807004
+  801ebd:	e8 36 ea ff ff       	call   8008f8 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801ec2:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  801ec8:	b8 02 00 00 00       	mov    $0x2,%eax
+  801ecd:	e8 32 ff ff ff       	call   801e04 <nsipc>
+}
+  801ed2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ed5:	c9                   	leave
+  801ed6:	c3                   	ret
+
+00801ed7 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801ed7:	55                   	push   %ebp
+  801ed8:	89 e5                	mov    %esp,%ebp
+  801eda:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801edd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ee0:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  801ee5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ee8:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  801eed:	b8 03 00 00 00       	mov    $0x3,%eax
+  801ef2:	e8 0d ff ff ff       	call   801e04 <nsipc>
+}
+  801ef7:	c9                   	leave
+  801ef8:	c3                   	ret
+
+00801ef9 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801ef9:	55                   	push   %ebp
+  801efa:	89 e5                	mov    %esp,%ebp
+  801efc:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801eff:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f02:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  801f07:	b8 04 00 00 00       	mov    $0x4,%eax
+  801f0c:	e8 f3 fe ff ff       	call   801e04 <nsipc>
+}
+  801f11:	c9                   	leave
+  801f12:	c3                   	ret
+
+00801f13 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801f13:	55                   	push   %ebp
+  801f14:	89 e5                	mov    %esp,%ebp
+  801f16:	53                   	push   %ebx
+  801f17:	83 ec 08             	sub    $0x8,%esp
+  801f1a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801f1d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f20:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801f25:	53                   	push   %ebx
+  801f26:	ff 75 0c             	push   0xc(%ebp)
+  801f29:	68 04 70 80 00       	push   $0x807004
+  801f2e:	e8 c5 e9 ff ff       	call   8008f8 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801f33:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  801f39:	b8 05 00 00 00       	mov    $0x5,%eax
+  801f3e:	e8 c1 fe ff ff       	call   801e04 <nsipc>
+}
+  801f43:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f46:	c9                   	leave
+  801f47:	c3                   	ret
+
+00801f48 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801f48:	55                   	push   %ebp
+  801f49:	89 e5                	mov    %esp,%ebp
+  801f4b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801f4e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f51:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  801f56:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f59:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  801f5e:	b8 06 00 00 00       	mov    $0x6,%eax
+  801f63:	e8 9c fe ff ff       	call   801e04 <nsipc>
+}
+  801f68:	c9                   	leave
+  801f69:	c3                   	ret
+
+00801f6a <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801f6a:	55                   	push   %ebp
+  801f6b:	89 e5                	mov    %esp,%ebp
+  801f6d:	56                   	push   %esi
+  801f6e:	53                   	push   %ebx
+  801f6f:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801f72:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f75:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  801f7a:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  801f80:	8b 45 14             	mov    0x14(%ebp),%eax
+  801f83:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801f88:	b8 07 00 00 00       	mov    $0x7,%eax
+  801f8d:	e8 72 fe ff ff       	call   801e04 <nsipc>
+  801f92:	89 c3                	mov    %eax,%ebx
+  801f94:	85 c0                	test   %eax,%eax
+  801f96:	78 22                	js     801fba <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801f98:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801f9d:	39 c6                	cmp    %eax,%esi
+  801f9f:	0f 4e c6             	cmovle %esi,%eax
+  801fa2:	39 c3                	cmp    %eax,%ebx
+  801fa4:	7f 1d                	jg     801fc3 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801fa6:	83 ec 04             	sub    $0x4,%esp
+  801fa9:	53                   	push   %ebx
+  801faa:	68 00 70 80 00       	push   $0x807000
+  801faf:	ff 75 0c             	push   0xc(%ebp)
+  801fb2:	e8 41 e9 ff ff       	call   8008f8 <memmove>
+  801fb7:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801fba:	89 d8                	mov    %ebx,%eax
+  801fbc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fbf:	5b                   	pop    %ebx
+  801fc0:	5e                   	pop    %esi
+  801fc1:	5d                   	pop    %ebp
+  801fc2:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801fc3:	68 62 30 80 00       	push   $0x803062
+  801fc8:	68 67 2f 80 00       	push   $0x802f67
+  801fcd:	6a 62                	push   $0x62
+  801fcf:	68 77 30 80 00       	push   $0x803077
+  801fd4:	e8 05 e1 ff ff       	call   8000de <_panic>
+
+00801fd9 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801fd9:	55                   	push   %ebp
+  801fda:	89 e5                	mov    %esp,%ebp
+  801fdc:	53                   	push   %ebx
+  801fdd:	83 ec 04             	sub    $0x4,%esp
+  801fe0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801fe3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fe6:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  801feb:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801ff1:	7f 2e                	jg     802021 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801ff3:	83 ec 04             	sub    $0x4,%esp
+  801ff6:	53                   	push   %ebx
+  801ff7:	ff 75 0c             	push   0xc(%ebp)
+  801ffa:	68 0c 70 80 00       	push   $0x80700c
+  801fff:	e8 f4 e8 ff ff       	call   8008f8 <memmove>
+	nsipcbuf.send.req_size = size;
+  802004:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  80200a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80200d:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  802012:	b8 08 00 00 00       	mov    $0x8,%eax
+  802017:	e8 e8 fd ff ff       	call   801e04 <nsipc>
+}
+  80201c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80201f:	c9                   	leave
+  802020:	c3                   	ret
+	assert(size < 1600);
+  802021:	68 83 30 80 00       	push   $0x803083
+  802026:	68 67 2f 80 00       	push   $0x802f67
+  80202b:	6a 6d                	push   $0x6d
+  80202d:	68 77 30 80 00       	push   $0x803077
+  802032:	e8 a7 e0 ff ff       	call   8000de <_panic>
+
+00802037 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802037:	55                   	push   %ebp
+  802038:	89 e5                	mov    %esp,%ebp
+  80203a:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  80203d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802040:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  802045:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802048:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  80204d:	8b 45 10             	mov    0x10(%ebp),%eax
+  802050:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  802055:	b8 09 00 00 00       	mov    $0x9,%eax
+  80205a:	e8 a5 fd ff ff       	call   801e04 <nsipc>
+}
+  80205f:	c9                   	leave
+  802060:	c3                   	ret
+
+00802061 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802061:	55                   	push   %ebp
+  802062:	89 e5                	mov    %esp,%ebp
+  802064:	56                   	push   %esi
+  802065:	53                   	push   %ebx
+  802066:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802069:	83 ec 0c             	sub    $0xc,%esp
+  80206c:	ff 75 08             	push   0x8(%ebp)
+  80206f:	e8 cd ed ff ff       	call   800e41 <fd2data>
+  802074:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802076:	83 c4 08             	add    $0x8,%esp
+  802079:	68 8f 30 80 00       	push   $0x80308f
+  80207e:	53                   	push   %ebx
+  80207f:	e8 ee e6 ff ff       	call   800772 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802084:	8b 46 04             	mov    0x4(%esi),%eax
+  802087:	2b 06                	sub    (%esi),%eax
+  802089:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  80208f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802096:	00 00 00 
+	stat->st_dev = &devpipe;
+  802099:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  8020a0:	40 80 00 
+	return 0;
+}
+  8020a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020a8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020ab:	5b                   	pop    %ebx
+  8020ac:	5e                   	pop    %esi
+  8020ad:	5d                   	pop    %ebp
+  8020ae:	c3                   	ret
+
+008020af <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8020af:	55                   	push   %ebp
+  8020b0:	89 e5                	mov    %esp,%ebp
+  8020b2:	53                   	push   %ebx
+  8020b3:	83 ec 0c             	sub    $0xc,%esp
+  8020b6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8020b9:	53                   	push   %ebx
+  8020ba:	6a 00                	push   $0x0
+  8020bc:	e8 22 eb ff ff       	call   800be3 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8020c1:	89 1c 24             	mov    %ebx,(%esp)
+  8020c4:	e8 78 ed ff ff       	call   800e41 <fd2data>
+  8020c9:	83 c4 08             	add    $0x8,%esp
+  8020cc:	50                   	push   %eax
+  8020cd:	6a 00                	push   $0x0
+  8020cf:	e8 0f eb ff ff       	call   800be3 <sys_page_unmap>
+}
+  8020d4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020d7:	c9                   	leave
+  8020d8:	c3                   	ret
+
+008020d9 <_pipeisclosed>:
+{
+  8020d9:	55                   	push   %ebp
+  8020da:	89 e5                	mov    %esp,%ebp
+  8020dc:	57                   	push   %edi
+  8020dd:	56                   	push   %esi
+  8020de:	53                   	push   %ebx
+  8020df:	83 ec 1c             	sub    $0x1c,%esp
+  8020e2:	89 c7                	mov    %eax,%edi
+  8020e4:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  8020e6:	a1 08 50 80 00       	mov    0x805008,%eax
+  8020eb:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8020ee:	83 ec 0c             	sub    $0xc,%esp
+  8020f1:	57                   	push   %edi
+  8020f2:	e8 2f 05 00 00       	call   802626 <pageref>
+  8020f7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8020fa:	89 34 24             	mov    %esi,(%esp)
+  8020fd:	e8 24 05 00 00       	call   802626 <pageref>
+		nn = thisenv->env_runs;
+  802102:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  802108:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  80210b:	83 c4 10             	add    $0x10,%esp
+  80210e:	39 cb                	cmp    %ecx,%ebx
+  802110:	74 1b                	je     80212d <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802112:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802115:	75 cf                	jne    8020e6 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802117:	8b 42 58             	mov    0x58(%edx),%eax
+  80211a:	6a 01                	push   $0x1
+  80211c:	50                   	push   %eax
+  80211d:	53                   	push   %ebx
+  80211e:	68 96 30 80 00       	push   $0x803096
+  802123:	e8 91 e0 ff ff       	call   8001b9 <cprintf>
+  802128:	83 c4 10             	add    $0x10,%esp
+  80212b:	eb b9                	jmp    8020e6 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  80212d:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802130:	0f 94 c0             	sete   %al
+  802133:	0f b6 c0             	movzbl %al,%eax
+}
+  802136:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802139:	5b                   	pop    %ebx
+  80213a:	5e                   	pop    %esi
+  80213b:	5f                   	pop    %edi
+  80213c:	5d                   	pop    %ebp
+  80213d:	c3                   	ret
+
+0080213e <devpipe_write>:
+{
+  80213e:	55                   	push   %ebp
+  80213f:	89 e5                	mov    %esp,%ebp
+  802141:	57                   	push   %edi
+  802142:	56                   	push   %esi
+  802143:	53                   	push   %ebx
+  802144:	83 ec 28             	sub    $0x28,%esp
+  802147:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  80214a:	56                   	push   %esi
+  80214b:	e8 f1 ec ff ff       	call   800e41 <fd2data>
+  802150:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802152:	83 c4 10             	add    $0x10,%esp
+  802155:	bf 00 00 00 00       	mov    $0x0,%edi
+  80215a:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  80215d:	75 09                	jne    802168 <devpipe_write+0x2a>
+	return i;
+  80215f:	89 f8                	mov    %edi,%eax
+  802161:	eb 23                	jmp    802186 <devpipe_write+0x48>
+			sys_yield();
+  802163:	e8 d7 e9 ff ff       	call   800b3f <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802168:	8b 43 04             	mov    0x4(%ebx),%eax
+  80216b:	8b 0b                	mov    (%ebx),%ecx
+  80216d:	8d 51 20             	lea    0x20(%ecx),%edx
+  802170:	39 d0                	cmp    %edx,%eax
+  802172:	72 1a                	jb     80218e <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802174:	89 da                	mov    %ebx,%edx
+  802176:	89 f0                	mov    %esi,%eax
+  802178:	e8 5c ff ff ff       	call   8020d9 <_pipeisclosed>
+  80217d:	85 c0                	test   %eax,%eax
+  80217f:	74 e2                	je     802163 <devpipe_write+0x25>
+				return 0;
+  802181:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802186:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802189:	5b                   	pop    %ebx
+  80218a:	5e                   	pop    %esi
+  80218b:	5f                   	pop    %edi
+  80218c:	5d                   	pop    %ebp
+  80218d:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80218e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802191:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802195:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802198:	89 c2                	mov    %eax,%edx
+  80219a:	c1 fa 1f             	sar    $0x1f,%edx
+  80219d:	89 d1                	mov    %edx,%ecx
+  80219f:	c1 e9 1b             	shr    $0x1b,%ecx
+  8021a2:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8021a5:	83 e2 1f             	and    $0x1f,%edx
+  8021a8:	29 ca                	sub    %ecx,%edx
+  8021aa:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8021ae:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8021b2:	83 c0 01             	add    $0x1,%eax
+  8021b5:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8021b8:	83 c7 01             	add    $0x1,%edi
+  8021bb:	eb 9d                	jmp    80215a <devpipe_write+0x1c>
+
+008021bd <devpipe_read>:
+{
+  8021bd:	55                   	push   %ebp
+  8021be:	89 e5                	mov    %esp,%ebp
+  8021c0:	57                   	push   %edi
+  8021c1:	56                   	push   %esi
+  8021c2:	53                   	push   %ebx
+  8021c3:	83 ec 18             	sub    $0x18,%esp
+  8021c6:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8021c9:	57                   	push   %edi
+  8021ca:	e8 72 ec ff ff       	call   800e41 <fd2data>
+  8021cf:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8021d1:	83 c4 10             	add    $0x10,%esp
+  8021d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8021d9:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8021dc:	75 13                	jne    8021f1 <devpipe_read+0x34>
+	return i;
+  8021de:	89 f0                	mov    %esi,%eax
+  8021e0:	eb 02                	jmp    8021e4 <devpipe_read+0x27>
+				return i;
+  8021e2:	89 f0                	mov    %esi,%eax
+}
+  8021e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021e7:	5b                   	pop    %ebx
+  8021e8:	5e                   	pop    %esi
+  8021e9:	5f                   	pop    %edi
+  8021ea:	5d                   	pop    %ebp
+  8021eb:	c3                   	ret
+			sys_yield();
+  8021ec:	e8 4e e9 ff ff       	call   800b3f <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  8021f1:	8b 03                	mov    (%ebx),%eax
+  8021f3:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8021f6:	75 18                	jne    802210 <devpipe_read+0x53>
+			if (i > 0)
+  8021f8:	85 f6                	test   %esi,%esi
+  8021fa:	75 e6                	jne    8021e2 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  8021fc:	89 da                	mov    %ebx,%edx
+  8021fe:	89 f8                	mov    %edi,%eax
+  802200:	e8 d4 fe ff ff       	call   8020d9 <_pipeisclosed>
+  802205:	85 c0                	test   %eax,%eax
+  802207:	74 e3                	je     8021ec <devpipe_read+0x2f>
+				return 0;
+  802209:	b8 00 00 00 00       	mov    $0x0,%eax
+  80220e:	eb d4                	jmp    8021e4 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802210:	99                   	cltd
+  802211:	c1 ea 1b             	shr    $0x1b,%edx
+  802214:	01 d0                	add    %edx,%eax
+  802216:	83 e0 1f             	and    $0x1f,%eax
+  802219:	29 d0                	sub    %edx,%eax
+  80221b:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802220:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802223:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802226:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802229:	83 c6 01             	add    $0x1,%esi
+  80222c:	eb ab                	jmp    8021d9 <devpipe_read+0x1c>
+
+0080222e <pipe>:
+{
+  80222e:	55                   	push   %ebp
+  80222f:	89 e5                	mov    %esp,%ebp
+  802231:	56                   	push   %esi
+  802232:	53                   	push   %ebx
+  802233:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802236:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802239:	50                   	push   %eax
+  80223a:	e8 19 ec ff ff       	call   800e58 <fd_alloc>
+  80223f:	89 c3                	mov    %eax,%ebx
+  802241:	83 c4 10             	add    $0x10,%esp
+  802244:	85 c0                	test   %eax,%eax
+  802246:	0f 88 23 01 00 00    	js     80236f <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80224c:	83 ec 04             	sub    $0x4,%esp
+  80224f:	68 07 04 00 00       	push   $0x407
+  802254:	ff 75 f4             	push   -0xc(%ebp)
+  802257:	6a 00                	push   $0x0
+  802259:	e8 00 e9 ff ff       	call   800b5e <sys_page_alloc>
+  80225e:	89 c3                	mov    %eax,%ebx
+  802260:	83 c4 10             	add    $0x10,%esp
+  802263:	85 c0                	test   %eax,%eax
+  802265:	0f 88 04 01 00 00    	js     80236f <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80226b:	83 ec 0c             	sub    $0xc,%esp
+  80226e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802271:	50                   	push   %eax
+  802272:	e8 e1 eb ff ff       	call   800e58 <fd_alloc>
+  802277:	89 c3                	mov    %eax,%ebx
+  802279:	83 c4 10             	add    $0x10,%esp
+  80227c:	85 c0                	test   %eax,%eax
+  80227e:	0f 88 db 00 00 00    	js     80235f <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802284:	83 ec 04             	sub    $0x4,%esp
+  802287:	68 07 04 00 00       	push   $0x407
+  80228c:	ff 75 f0             	push   -0x10(%ebp)
+  80228f:	6a 00                	push   $0x0
+  802291:	e8 c8 e8 ff ff       	call   800b5e <sys_page_alloc>
+  802296:	89 c3                	mov    %eax,%ebx
+  802298:	83 c4 10             	add    $0x10,%esp
+  80229b:	85 c0                	test   %eax,%eax
+  80229d:	0f 88 bc 00 00 00    	js     80235f <pipe+0x131>
+	va = fd2data(fd0);
+  8022a3:	83 ec 0c             	sub    $0xc,%esp
+  8022a6:	ff 75 f4             	push   -0xc(%ebp)
+  8022a9:	e8 93 eb ff ff       	call   800e41 <fd2data>
+  8022ae:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8022b0:	83 c4 0c             	add    $0xc,%esp
+  8022b3:	68 07 04 00 00       	push   $0x407
+  8022b8:	50                   	push   %eax
+  8022b9:	6a 00                	push   $0x0
+  8022bb:	e8 9e e8 ff ff       	call   800b5e <sys_page_alloc>
+  8022c0:	89 c3                	mov    %eax,%ebx
+  8022c2:	83 c4 10             	add    $0x10,%esp
+  8022c5:	85 c0                	test   %eax,%eax
+  8022c7:	0f 88 82 00 00 00    	js     80234f <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8022cd:	83 ec 0c             	sub    $0xc,%esp
+  8022d0:	ff 75 f0             	push   -0x10(%ebp)
+  8022d3:	e8 69 eb ff ff       	call   800e41 <fd2data>
+  8022d8:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8022df:	50                   	push   %eax
+  8022e0:	6a 00                	push   $0x0
+  8022e2:	56                   	push   %esi
+  8022e3:	6a 00                	push   $0x0
+  8022e5:	e8 b7 e8 ff ff       	call   800ba1 <sys_page_map>
+  8022ea:	89 c3                	mov    %eax,%ebx
+  8022ec:	83 c4 20             	add    $0x20,%esp
+  8022ef:	85 c0                	test   %eax,%eax
+  8022f1:	78 4e                	js     802341 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8022f3:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  8022f8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8022fb:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8022fd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802300:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802307:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80230a:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80230c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80230f:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802316:	83 ec 0c             	sub    $0xc,%esp
+  802319:	ff 75 f4             	push   -0xc(%ebp)
+  80231c:	e8 10 eb ff ff       	call   800e31 <fd2num>
+  802321:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802324:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802326:	83 c4 04             	add    $0x4,%esp
+  802329:	ff 75 f0             	push   -0x10(%ebp)
+  80232c:	e8 00 eb ff ff       	call   800e31 <fd2num>
+  802331:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802334:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802337:	83 c4 10             	add    $0x10,%esp
+  80233a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80233f:	eb 2e                	jmp    80236f <pipe+0x141>
+	sys_page_unmap(0, va);
+  802341:	83 ec 08             	sub    $0x8,%esp
+  802344:	56                   	push   %esi
+  802345:	6a 00                	push   $0x0
+  802347:	e8 97 e8 ff ff       	call   800be3 <sys_page_unmap>
+  80234c:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80234f:	83 ec 08             	sub    $0x8,%esp
+  802352:	ff 75 f0             	push   -0x10(%ebp)
+  802355:	6a 00                	push   $0x0
+  802357:	e8 87 e8 ff ff       	call   800be3 <sys_page_unmap>
+  80235c:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80235f:	83 ec 08             	sub    $0x8,%esp
+  802362:	ff 75 f4             	push   -0xc(%ebp)
+  802365:	6a 00                	push   $0x0
+  802367:	e8 77 e8 ff ff       	call   800be3 <sys_page_unmap>
+  80236c:	83 c4 10             	add    $0x10,%esp
+}
+  80236f:	89 d8                	mov    %ebx,%eax
+  802371:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802374:	5b                   	pop    %ebx
+  802375:	5e                   	pop    %esi
+  802376:	5d                   	pop    %ebp
+  802377:	c3                   	ret
+
+00802378 <pipeisclosed>:
+{
+  802378:	55                   	push   %ebp
+  802379:	89 e5                	mov    %esp,%ebp
+  80237b:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80237e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802381:	50                   	push   %eax
+  802382:	ff 75 08             	push   0x8(%ebp)
+  802385:	e8 24 eb ff ff       	call   800eae <fd_lookup>
+  80238a:	83 c4 10             	add    $0x10,%esp
+  80238d:	85 c0                	test   %eax,%eax
+  80238f:	78 18                	js     8023a9 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802391:	83 ec 0c             	sub    $0xc,%esp
+  802394:	ff 75 f4             	push   -0xc(%ebp)
+  802397:	e8 a5 ea ff ff       	call   800e41 <fd2data>
+  80239c:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80239e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023a1:	e8 33 fd ff ff       	call   8020d9 <_pipeisclosed>
+  8023a6:	83 c4 10             	add    $0x10,%esp
+}
+  8023a9:	c9                   	leave
+  8023aa:	c3                   	ret
+
+008023ab <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8023ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023b0:	c3                   	ret
+
+008023b1 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8023b1:	55                   	push   %ebp
+  8023b2:	89 e5                	mov    %esp,%ebp
+  8023b4:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8023b7:	68 ae 30 80 00       	push   $0x8030ae
+  8023bc:	ff 75 0c             	push   0xc(%ebp)
+  8023bf:	e8 ae e3 ff ff       	call   800772 <strcpy>
+	return 0;
+}
+  8023c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023c9:	c9                   	leave
+  8023ca:	c3                   	ret
+
+008023cb <devcons_write>:
+{
+  8023cb:	55                   	push   %ebp
+  8023cc:	89 e5                	mov    %esp,%ebp
+  8023ce:	57                   	push   %edi
+  8023cf:	56                   	push   %esi
+  8023d0:	53                   	push   %ebx
+  8023d1:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8023d7:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8023dc:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8023e2:	eb 2e                	jmp    802412 <devcons_write+0x47>
+		m = n - tot;
+  8023e4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8023e7:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8023e9:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8023ee:	39 c3                	cmp    %eax,%ebx
+  8023f0:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8023f3:	83 ec 04             	sub    $0x4,%esp
+  8023f6:	53                   	push   %ebx
+  8023f7:	89 f0                	mov    %esi,%eax
+  8023f9:	03 45 0c             	add    0xc(%ebp),%eax
+  8023fc:	50                   	push   %eax
+  8023fd:	57                   	push   %edi
+  8023fe:	e8 f5 e4 ff ff       	call   8008f8 <memmove>
+		sys_cputs(buf, m);
+  802403:	83 c4 08             	add    $0x8,%esp
+  802406:	53                   	push   %ebx
+  802407:	57                   	push   %edi
+  802408:	e8 95 e6 ff ff       	call   800aa2 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80240d:	01 de                	add    %ebx,%esi
+  80240f:	83 c4 10             	add    $0x10,%esp
+  802412:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802415:	72 cd                	jb     8023e4 <devcons_write+0x19>
+}
+  802417:	89 f0                	mov    %esi,%eax
+  802419:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80241c:	5b                   	pop    %ebx
+  80241d:	5e                   	pop    %esi
+  80241e:	5f                   	pop    %edi
+  80241f:	5d                   	pop    %ebp
+  802420:	c3                   	ret
+
+00802421 <devcons_read>:
+{
+  802421:	55                   	push   %ebp
+  802422:	89 e5                	mov    %esp,%ebp
+  802424:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802427:	b8 00 00 00 00       	mov    $0x0,%eax
+  80242c:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802430:	75 07                	jne    802439 <devcons_read+0x18>
+  802432:	eb 1f                	jmp    802453 <devcons_read+0x32>
+		sys_yield();
+  802434:	e8 06 e7 ff ff       	call   800b3f <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802439:	e8 82 e6 ff ff       	call   800ac0 <sys_cgetc>
+  80243e:	85 c0                	test   %eax,%eax
+  802440:	74 f2                	je     802434 <devcons_read+0x13>
+	if (c < 0)
+  802442:	78 0f                	js     802453 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802444:	83 f8 04             	cmp    $0x4,%eax
+  802447:	74 0c                	je     802455 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802449:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80244c:	88 02                	mov    %al,(%edx)
+	return 1;
+  80244e:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802453:	c9                   	leave
+  802454:	c3                   	ret
+		return 0;
+  802455:	b8 00 00 00 00       	mov    $0x0,%eax
+  80245a:	eb f7                	jmp    802453 <devcons_read+0x32>
+
+0080245c <cputchar>:
+{
+  80245c:	55                   	push   %ebp
+  80245d:	89 e5                	mov    %esp,%ebp
+  80245f:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802462:	8b 45 08             	mov    0x8(%ebp),%eax
+  802465:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802468:	6a 01                	push   $0x1
+  80246a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80246d:	50                   	push   %eax
+  80246e:	e8 2f e6 ff ff       	call   800aa2 <sys_cputs>
+}
+  802473:	83 c4 10             	add    $0x10,%esp
+  802476:	c9                   	leave
+  802477:	c3                   	ret
+
+00802478 <getchar>:
+{
+  802478:	55                   	push   %ebp
+  802479:	89 e5                	mov    %esp,%ebp
+  80247b:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80247e:	6a 01                	push   $0x1
+  802480:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802483:	50                   	push   %eax
+  802484:	6a 00                	push   $0x0
+  802486:	e8 89 ec ff ff       	call   801114 <read>
+	if (r < 0)
+  80248b:	83 c4 10             	add    $0x10,%esp
+  80248e:	85 c0                	test   %eax,%eax
+  802490:	78 06                	js     802498 <getchar+0x20>
+	if (r < 1)
+  802492:	74 06                	je     80249a <getchar+0x22>
+	return c;
+  802494:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802498:	c9                   	leave
+  802499:	c3                   	ret
+		return -E_EOF;
+  80249a:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80249f:	eb f7                	jmp    802498 <getchar+0x20>
+
+008024a1 <iscons>:
+{
+  8024a1:	55                   	push   %ebp
+  8024a2:	89 e5                	mov    %esp,%ebp
+  8024a4:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8024a7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024aa:	50                   	push   %eax
+  8024ab:	ff 75 08             	push   0x8(%ebp)
+  8024ae:	e8 fb e9 ff ff       	call   800eae <fd_lookup>
+  8024b3:	83 c4 10             	add    $0x10,%esp
+  8024b6:	85 c0                	test   %eax,%eax
+  8024b8:	78 11                	js     8024cb <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8024ba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024bd:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  8024c3:	39 10                	cmp    %edx,(%eax)
+  8024c5:	0f 94 c0             	sete   %al
+  8024c8:	0f b6 c0             	movzbl %al,%eax
+}
+  8024cb:	c9                   	leave
+  8024cc:	c3                   	ret
+
+008024cd <opencons>:
+{
+  8024cd:	55                   	push   %ebp
+  8024ce:	89 e5                	mov    %esp,%ebp
+  8024d0:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8024d3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024d6:	50                   	push   %eax
+  8024d7:	e8 7c e9 ff ff       	call   800e58 <fd_alloc>
+  8024dc:	83 c4 10             	add    $0x10,%esp
+  8024df:	85 c0                	test   %eax,%eax
+  8024e1:	78 3a                	js     80251d <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8024e3:	83 ec 04             	sub    $0x4,%esp
+  8024e6:	68 07 04 00 00       	push   $0x407
+  8024eb:	ff 75 f4             	push   -0xc(%ebp)
+  8024ee:	6a 00                	push   $0x0
+  8024f0:	e8 69 e6 ff ff       	call   800b5e <sys_page_alloc>
+  8024f5:	83 c4 10             	add    $0x10,%esp
+  8024f8:	85 c0                	test   %eax,%eax
+  8024fa:	78 21                	js     80251d <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8024fc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024ff:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802505:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802507:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80250a:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802511:	83 ec 0c             	sub    $0xc,%esp
+  802514:	50                   	push   %eax
+  802515:	e8 17 e9 ff ff       	call   800e31 <fd2num>
+  80251a:	83 c4 10             	add    $0x10,%esp
+}
+  80251d:	c9                   	leave
+  80251e:	c3                   	ret
+
+0080251f <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  80251f:	55                   	push   %ebp
+  802520:	89 e5                	mov    %esp,%ebp
+  802522:	56                   	push   %esi
+  802523:	53                   	push   %ebx
+  802524:	8b 75 08             	mov    0x8(%ebp),%esi
+  802527:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80252a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  80252d:	85 c0                	test   %eax,%eax
+  80252f:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802534:	0f 44 c2             	cmove  %edx,%eax
+  802537:	83 ec 0c             	sub    $0xc,%esp
+  80253a:	50                   	push   %eax
+  80253b:	e8 ce e7 ff ff       	call   800d0e <sys_ipc_recv>
+
+  if (from_env_store)
+  802540:	83 c4 10             	add    $0x10,%esp
+  802543:	85 f6                	test   %esi,%esi
+  802545:	74 17                	je     80255e <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  802547:	ba 00 00 00 00       	mov    $0x0,%edx
+  80254c:	85 c0                	test   %eax,%eax
+  80254e:	75 0c                	jne    80255c <ipc_recv+0x3d>
+  802550:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  802556:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  80255c:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  80255e:	85 db                	test   %ebx,%ebx
+  802560:	74 2b                	je     80258d <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  802562:	85 c0                	test   %eax,%eax
+  802564:	74 0d                	je     802573 <ipc_recv+0x54>
+  802566:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  80256c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80256f:	5b                   	pop    %ebx
+  802570:	5e                   	pop    %esi
+  802571:	5d                   	pop    %ebp
+  802572:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  802573:	a1 08 50 80 00       	mov    0x805008,%eax
+  802578:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80257e:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  802580:	a1 08 50 80 00       	mov    0x805008,%eax
+  802585:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  80258b:	eb df                	jmp    80256c <ipc_recv+0x4d>
+  80258d:	85 c0                	test   %eax,%eax
+  80258f:	75 db                	jne    80256c <ipc_recv+0x4d>
+  802591:	eb ed                	jmp    802580 <ipc_recv+0x61>
+
+00802593 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  802593:	55                   	push   %ebp
+  802594:	89 e5                	mov    %esp,%ebp
+  802596:	57                   	push   %edi
+  802597:	56                   	push   %esi
+  802598:	53                   	push   %ebx
+  802599:	83 ec 0c             	sub    $0xc,%esp
+  80259c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80259f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8025a2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  8025a5:	85 db                	test   %ebx,%ebx
+  8025a7:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8025ac:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  8025af:	ff 75 14             	push   0x14(%ebp)
+  8025b2:	53                   	push   %ebx
+  8025b3:	56                   	push   %esi
+  8025b4:	57                   	push   %edi
+  8025b5:	e8 31 e7 ff ff       	call   800ceb <sys_ipc_try_send>
+  8025ba:	83 c4 10             	add    $0x10,%esp
+  8025bd:	85 c0                	test   %eax,%eax
+  8025bf:	74 1e                	je     8025df <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  8025c1:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8025c4:	75 07                	jne    8025cd <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  8025c6:	e8 74 e5 ff ff       	call   800b3f <sys_yield>
+  8025cb:	eb e2                	jmp    8025af <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  8025cd:	50                   	push   %eax
+  8025ce:	68 ba 30 80 00       	push   $0x8030ba
+  8025d3:	6a 3c                	push   $0x3c
+  8025d5:	68 c7 30 80 00       	push   $0x8030c7
+  8025da:	e8 ff da ff ff       	call   8000de <_panic>
+  }
+
+#endif
+}
+  8025df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025e2:	5b                   	pop    %ebx
+  8025e3:	5e                   	pop    %esi
+  8025e4:	5f                   	pop    %edi
+  8025e5:	5d                   	pop    %ebp
+  8025e6:	c3                   	ret
+
+008025e7 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  8025e7:	55                   	push   %ebp
+  8025e8:	89 e5                	mov    %esp,%ebp
+  8025ea:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  8025ed:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  8025f2:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8025f5:	c1 e0 04             	shl    $0x4,%eax
+  8025f8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8025fd:	8b 40 50             	mov    0x50(%eax),%eax
+  802600:	39 c8                	cmp    %ecx,%eax
+  802602:	74 12                	je     802616 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  802604:	83 c2 01             	add    $0x1,%edx
+  802607:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  80260d:	75 e3                	jne    8025f2 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  80260f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802614:	eb 0e                	jmp    802624 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  802616:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802619:	c1 e0 04             	shl    $0x4,%eax
+  80261c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802621:	8b 40 48             	mov    0x48(%eax),%eax
+  802624:	5d                   	pop    %ebp
+  802625:	c3                   	ret
+
+00802626 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802626:	55                   	push   %ebp
+  802627:	89 e5                	mov    %esp,%ebp
+  802629:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80262c:	89 c2                	mov    %eax,%edx
+  80262e:	c1 ea 16             	shr    $0x16,%edx
+  802631:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802638:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80263d:	f6 c1 01             	test   $0x1,%cl
+  802640:	74 1c                	je     80265e <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  802642:	c1 e8 0c             	shr    $0xc,%eax
+  802645:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80264c:	a8 01                	test   $0x1,%al
+  80264e:	74 0e                	je     80265e <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802650:	c1 e8 0c             	shr    $0xc,%eax
+  802653:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  80265a:	ef 
+  80265b:	0f b7 d2             	movzwl %dx,%edx
+}
+  80265e:	89 d0                	mov    %edx,%eax
+  802660:	5d                   	pop    %ebp
+  802661:	c3                   	ret
+  802662:	66 90                	xchg   %ax,%ax
+  802664:	66 90                	xchg   %ax,%ax
+  802666:	66 90                	xchg   %ax,%ax
+  802668:	66 90                	xchg   %ax,%ax
+  80266a:	66 90                	xchg   %ax,%ax
+  80266c:	66 90                	xchg   %ax,%ax
+  80266e:	66 90                	xchg   %ax,%ax
+
+00802670 <__udivmoddi4>:
+  802670:	55                   	push   %ebp
+  802671:	57                   	push   %edi
+  802672:	56                   	push   %esi
+  802673:	53                   	push   %ebx
+  802674:	83 ec 24             	sub    $0x24,%esp
+  802677:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80267b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80267f:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  802683:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802687:	8b 54 24 44          	mov    0x44(%esp),%edx
+  80268b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80268f:	8b 44 24 40          	mov    0x40(%esp),%eax
+  802693:	89 d3                	mov    %edx,%ebx
+  802695:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802699:	09 c3                	or     %eax,%ebx
+  80269b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80269f:	0f 84 9c 00 00 00    	je     802741 <__udivmoddi4+0xd1>
+  8026a5:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8026ac:	00 
+  8026ad:	31 c0                	xor    %eax,%eax
+  8026af:	31 d2                	xor    %edx,%edx
+  8026b1:	89 fb                	mov    %edi,%ebx
+  8026b3:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8026ba:	00 
+  8026bb:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8026c0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8026c4:	01 c0                	add    %eax,%eax
+  8026c6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8026cd:	00 
+  8026ce:	89 c6                	mov    %eax,%esi
+  8026d0:	89 d7                	mov    %edx,%edi
+  8026d2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8026d6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8026da:	0f ad d0             	shrd   %cl,%edx,%eax
+  8026dd:	d3 ea                	shr    %cl,%edx
+  8026df:	f6 c1 20             	test   $0x20,%cl
+  8026e2:	0f 45 c2             	cmovne %edx,%eax
+  8026e5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8026e9:	83 e0 01             	and    $0x1,%eax
+  8026ec:	09 fa                	or     %edi,%edx
+  8026ee:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8026f2:	89 04 24             	mov    %eax,(%esp)
+  8026f5:	8b 04 24             	mov    (%esp),%eax
+  8026f8:	89 d5                	mov    %edx,%ebp
+  8026fa:	09 f0                	or     %esi,%eax
+  8026fc:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802700:	39 f0                	cmp    %esi,%eax
+  802702:	19 fd                	sbb    %edi,%ebp
+  802704:	72 1d                	jb     802723 <__udivmoddi4+0xb3>
+  802706:	29 f0                	sub    %esi,%eax
+  802708:	19 fa                	sbb    %edi,%edx
+  80270a:	89 cf                	mov    %ecx,%edi
+  80270c:	c1 ef 05             	shr    $0x5,%edi
+  80270f:	83 e7 01             	and    $0x1,%edi
+  802712:	89 fe                	mov    %edi,%esi
+  802714:	d3 e7                	shl    %cl,%edi
+  802716:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80271a:	83 f6 01             	xor    $0x1,%esi
+  80271d:	d3 e6                	shl    %cl,%esi
+  80271f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802723:	83 e9 01             	sub    $0x1,%ecx
+  802726:	73 98                	jae    8026c0 <__udivmoddi4+0x50>
+  802728:	85 db                	test   %ebx,%ebx
+  80272a:	74 05                	je     802731 <__udivmoddi4+0xc1>
+  80272c:	89 03                	mov    %eax,(%ebx)
+  80272e:	89 53 04             	mov    %edx,0x4(%ebx)
+  802731:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802735:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802739:	83 c4 24             	add    $0x24,%esp
+  80273c:	5b                   	pop    %ebx
+  80273d:	5e                   	pop    %esi
+  80273e:	5f                   	pop    %edi
+  80273f:	5d                   	pop    %ebp
+  802740:	c3                   	ret
+  802741:	85 ff                	test   %edi,%edi
+  802743:	74 0d                	je     802752 <__udivmoddi4+0xe2>
+  802745:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  80274b:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  802752:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802756:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80275a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80275e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802762:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802766:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80276a:	83 c4 24             	add    $0x24,%esp
+  80276d:	5b                   	pop    %ebx
+  80276e:	5e                   	pop    %esi
+  80276f:	5f                   	pop    %edi
+  802770:	5d                   	pop    %ebp
+  802771:	c3                   	ret
+  802772:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802779:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00802780 <__udivdi3>:
+  802780:	57                   	push   %edi
+  802781:	56                   	push   %esi
+  802782:	53                   	push   %ebx
+  802783:	83 ec 20             	sub    $0x20,%esp
+  802786:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80278a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80278e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802792:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802796:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80279a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80279e:	89 d1                	mov    %edx,%ecx
+  8027a0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8027a4:	09 c1                	or     %eax,%ecx
+  8027a6:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8027aa:	89 44 24 18          	mov    %eax,0x18(%esp)
+  8027ae:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  8027b2:	0f 84 88 00 00 00    	je     802840 <__udivdi3+0xc0>
+  8027b8:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8027bf:	00 
+  8027c0:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8027c5:	31 c0                	xor    %eax,%eax
+  8027c7:	31 d2                	xor    %edx,%edx
+  8027c9:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8027d0:	00 
+  8027d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8027d8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8027dc:	01 c0                	add    %eax,%eax
+  8027de:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8027e5:	00 
+  8027e6:	89 c6                	mov    %eax,%esi
+  8027e8:	89 d7                	mov    %edx,%edi
+  8027ea:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8027ee:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8027f2:	0f ad d0             	shrd   %cl,%edx,%eax
+  8027f5:	d3 ea                	shr    %cl,%edx
+  8027f7:	f6 c1 20             	test   $0x20,%cl
+  8027fa:	0f 45 c2             	cmovne %edx,%eax
+  8027fd:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802801:	83 e0 01             	and    $0x1,%eax
+  802804:	09 fa                	or     %edi,%edx
+  802806:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80280a:	89 04 24             	mov    %eax,(%esp)
+  80280d:	8b 04 24             	mov    (%esp),%eax
+  802810:	89 d3                	mov    %edx,%ebx
+  802812:	09 f0                	or     %esi,%eax
+  802814:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802818:	39 f0                	cmp    %esi,%eax
+  80281a:	19 fb                	sbb    %edi,%ebx
+  80281c:	72 1d                	jb     80283b <__udivdi3+0xbb>
+  80281e:	29 f0                	sub    %esi,%eax
+  802820:	19 fa                	sbb    %edi,%edx
+  802822:	89 cf                	mov    %ecx,%edi
+  802824:	c1 ef 05             	shr    $0x5,%edi
+  802827:	83 e7 01             	and    $0x1,%edi
+  80282a:	89 fe                	mov    %edi,%esi
+  80282c:	d3 e7                	shl    %cl,%edi
+  80282e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802832:	83 f6 01             	xor    $0x1,%esi
+  802835:	d3 e6                	shl    %cl,%esi
+  802837:	09 74 24 18          	or     %esi,0x18(%esp)
+  80283b:	83 e9 01             	sub    $0x1,%ecx
+  80283e:	73 98                	jae    8027d8 <__udivdi3+0x58>
+  802840:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802844:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802848:	83 c4 20             	add    $0x20,%esp
+  80284b:	5b                   	pop    %ebx
+  80284c:	5e                   	pop    %esi
+  80284d:	5f                   	pop    %edi
+  80284e:	c3                   	ret
+  80284f:	90                   	nop
+
+00802850 <__umoddi3>:
+  802850:	57                   	push   %edi
+  802851:	56                   	push   %esi
+  802852:	53                   	push   %ebx
+  802853:	83 ec 18             	sub    $0x18,%esp
+  802856:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80285a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80285e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802862:	8b 54 24 34          	mov    0x34(%esp),%edx
+  802866:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80286a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80286e:	89 d1                	mov    %edx,%ecx
+  802870:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802874:	09 c1                	or     %eax,%ecx
+  802876:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80287a:	74 5b                	je     8028d7 <__umoddi3+0x87>
+  80287c:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802881:	31 c0                	xor    %eax,%eax
+  802883:	31 d2                	xor    %edx,%edx
+  802885:	8d 76 00             	lea    0x0(%esi),%esi
+  802888:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80288c:	01 c0                	add    %eax,%eax
+  80288e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802895:	00 
+  802896:	89 c6                	mov    %eax,%esi
+  802898:	89 d7                	mov    %edx,%edi
+  80289a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80289e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8028a2:	0f ad d0             	shrd   %cl,%edx,%eax
+  8028a5:	d3 ea                	shr    %cl,%edx
+  8028a7:	f6 c1 20             	test   $0x20,%cl
+  8028aa:	0f 45 c2             	cmovne %edx,%eax
+  8028ad:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8028b1:	83 e0 01             	and    $0x1,%eax
+  8028b4:	09 fa                	or     %edi,%edx
+  8028b6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8028ba:	89 04 24             	mov    %eax,(%esp)
+  8028bd:	8b 04 24             	mov    (%esp),%eax
+  8028c0:	89 d3                	mov    %edx,%ebx
+  8028c2:	09 f0                	or     %esi,%eax
+  8028c4:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8028c8:	39 f0                	cmp    %esi,%eax
+  8028ca:	19 fb                	sbb    %edi,%ebx
+  8028cc:	72 04                	jb     8028d2 <__umoddi3+0x82>
+  8028ce:	29 f0                	sub    %esi,%eax
+  8028d0:	19 fa                	sbb    %edi,%edx
+  8028d2:	83 e9 01             	sub    $0x1,%ecx
+  8028d5:	73 b1                	jae    802888 <__umoddi3+0x38>
+  8028d7:	83 c4 18             	add    $0x18,%esp
+  8028da:	5b                   	pop    %ebx
+  8028db:	5e                   	pop    %esi
+  8028dc:	5f                   	pop    %edi
+  8028dd:	c3                   	ret
+  8028de:	66 90                	xchg   %ax,%ax
+
+008028e0 <__divdi3>:
+  8028e0:	55                   	push   %ebp
+  8028e1:	57                   	push   %edi
+  8028e2:	56                   	push   %esi
+  8028e3:	53                   	push   %ebx
+  8028e4:	83 ec 24             	sub    $0x24,%esp
+  8028e7:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  8028eb:	8b 74 24 44          	mov    0x44(%esp),%esi
+  8028ef:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8028f3:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8028f7:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  8028fb:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8028ff:	85 d2                	test   %edx,%edx
+  802901:	0f 88 e0 00 00 00    	js     8029e7 <__divdi3+0x107>
+  802907:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  80290b:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  80290f:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802913:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802917:	85 f6                	test   %esi,%esi
+  802919:	78 16                	js     802931 <__divdi3+0x51>
+  80291b:	89 f1                	mov    %esi,%ecx
+  80291d:	31 c0                	xor    %eax,%eax
+  80291f:	31 d2                	xor    %edx,%edx
+  802921:	09 d9                	or     %ebx,%ecx
+  802923:	0f 85 f3 00 00 00    	jne    802a1c <__divdi3+0x13c>
+  802929:	83 c4 24             	add    $0x24,%esp
+  80292c:	5b                   	pop    %ebx
+  80292d:	5e                   	pop    %esi
+  80292e:	5f                   	pop    %edi
+  80292f:	5d                   	pop    %ebp
+  802930:	c3                   	ret
+  802931:	bf 01 00 00 00       	mov    $0x1,%edi
+  802936:	f7 5c 24 08          	negl   0x8(%esp)
+  80293a:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  80293f:	f7 5c 24 0c          	negl   0xc(%esp)
+  802943:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80294a:	00 
+  80294b:	31 c0                	xor    %eax,%eax
+  80294d:	31 d2                	xor    %edx,%edx
+  80294f:	89 fb                	mov    %edi,%ebx
+  802951:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802958:	00 
+  802959:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80295e:	66 90                	xchg   %ax,%ax
+  802960:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802964:	01 c0                	add    %eax,%eax
+  802966:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80296d:	00 
+  80296e:	89 c6                	mov    %eax,%esi
+  802970:	89 d7                	mov    %edx,%edi
+  802972:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802976:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80297a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80297d:	d3 ea                	shr    %cl,%edx
+  80297f:	f6 c1 20             	test   $0x20,%cl
+  802982:	0f 45 c2             	cmovne %edx,%eax
+  802985:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802989:	83 e0 01             	and    $0x1,%eax
+  80298c:	09 fa                	or     %edi,%edx
+  80298e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802992:	89 04 24             	mov    %eax,(%esp)
+  802995:	8b 04 24             	mov    (%esp),%eax
+  802998:	89 d5                	mov    %edx,%ebp
+  80299a:	09 f0                	or     %esi,%eax
+  80299c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8029a0:	39 f0                	cmp    %esi,%eax
+  8029a2:	19 fd                	sbb    %edi,%ebp
+  8029a4:	72 1d                	jb     8029c3 <__divdi3+0xe3>
+  8029a6:	29 f0                	sub    %esi,%eax
+  8029a8:	19 fa                	sbb    %edi,%edx
+  8029aa:	89 cf                	mov    %ecx,%edi
+  8029ac:	c1 ef 05             	shr    $0x5,%edi
+  8029af:	83 e7 01             	and    $0x1,%edi
+  8029b2:	89 fe                	mov    %edi,%esi
+  8029b4:	d3 e7                	shl    %cl,%edi
+  8029b6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8029ba:	83 f6 01             	xor    $0x1,%esi
+  8029bd:	d3 e6                	shl    %cl,%esi
+  8029bf:	09 74 24 18          	or     %esi,0x18(%esp)
+  8029c3:	83 e9 01             	sub    $0x1,%ecx
+  8029c6:	73 98                	jae    802960 <__divdi3+0x80>
+  8029c8:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8029cc:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8029d0:	85 db                	test   %ebx,%ebx
+  8029d2:	0f 84 51 ff ff ff    	je     802929 <__divdi3+0x49>
+  8029d8:	f7 d8                	neg    %eax
+  8029da:	83 d2 00             	adc    $0x0,%edx
+  8029dd:	83 c4 24             	add    $0x24,%esp
+  8029e0:	5b                   	pop    %ebx
+  8029e1:	f7 da                	neg    %edx
+  8029e3:	5e                   	pop    %esi
+  8029e4:	5f                   	pop    %edi
+  8029e5:	5d                   	pop    %ebp
+  8029e6:	c3                   	ret
+  8029e7:	f7 d8                	neg    %eax
+  8029e9:	83 d2 00             	adc    $0x0,%edx
+  8029ec:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8029f0:	f7 da                	neg    %edx
+  8029f2:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8029f6:	85 f6                	test   %esi,%esi
+  8029f8:	78 1b                	js     802a15 <__divdi3+0x135>
+  8029fa:	89 f1                	mov    %esi,%ecx
+  8029fc:	31 c0                	xor    %eax,%eax
+  8029fe:	31 d2                	xor    %edx,%edx
+  802a00:	bf 01 00 00 00       	mov    $0x1,%edi
+  802a05:	09 d9                	or     %ebx,%ecx
+  802a07:	0f 85 36 ff ff ff    	jne    802943 <__divdi3+0x63>
+  802a0d:	83 c4 24             	add    $0x24,%esp
+  802a10:	5b                   	pop    %ebx
+  802a11:	5e                   	pop    %esi
+  802a12:	5f                   	pop    %edi
+  802a13:	5d                   	pop    %ebp
+  802a14:	c3                   	ret
+  802a15:	31 ff                	xor    %edi,%edi
+  802a17:	e9 1a ff ff ff       	jmp    802936 <__divdi3+0x56>
+  802a1c:	31 ff                	xor    %edi,%edi
+  802a1e:	e9 20 ff ff ff       	jmp    802943 <__divdi3+0x63>
+  802a23:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802a2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00802a30 <__moddi3>:
+  802a30:	55                   	push   %ebp
+  802a31:	57                   	push   %edi
+  802a32:	56                   	push   %esi
+  802a33:	53                   	push   %ebx
+  802a34:	83 ec 1c             	sub    $0x1c,%esp
+  802a37:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  802a3b:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  802a3f:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  802a43:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  802a47:	89 c8                	mov    %ecx,%eax
+  802a49:	89 f2                	mov    %esi,%edx
+  802a4b:	89 f3                	mov    %esi,%ebx
+  802a4d:	85 ed                	test   %ebp,%ebp
+  802a4f:	0f 88 9d 00 00 00    	js     802af2 <__moddi3+0xc2>
+  802a55:	09 cb                	or     %ecx,%ebx
+  802a57:	0f 84 8d 00 00 00    	je     802aea <__moddi3+0xba>
+  802a5d:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802a61:	31 db                	xor    %ebx,%ebx
+  802a63:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802a67:	89 ca                	mov    %ecx,%edx
+  802a69:	89 f0                	mov    %esi,%eax
+  802a6b:	89 dd                	mov    %ebx,%ebp
+  802a6d:	f7 da                	neg    %edx
+  802a6f:	83 d0 00             	adc    $0x0,%eax
+  802a72:	f7 d8                	neg    %eax
+  802a74:	0f 49 f0             	cmovns %eax,%esi
+  802a77:	0f 49 ca             	cmovns %edx,%ecx
+  802a7a:	31 c0                	xor    %eax,%eax
+  802a7c:	31 d2                	xor    %edx,%edx
+  802a7e:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802a82:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802a86:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802a8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  802a8f:	90                   	nop
+  802a90:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802a94:	01 c0                	add    %eax,%eax
+  802a96:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802a9d:	00 
+  802a9e:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  802aa2:	89 c6                	mov    %eax,%esi
+  802aa4:	89 d7                	mov    %edx,%edi
+  802aa6:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802aaa:	8b 54 24 14          	mov    0x14(%esp),%edx
+  802aae:	0f ad d0             	shrd   %cl,%edx,%eax
+  802ab1:	d3 ea                	shr    %cl,%edx
+  802ab3:	f6 c1 20             	test   $0x20,%cl
+  802ab6:	0f 45 c2             	cmovne %edx,%eax
+  802ab9:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802abd:	83 e0 01             	and    $0x1,%eax
+  802ac0:	09 fa                	or     %edi,%edx
+  802ac2:	89 04 24             	mov    %eax,(%esp)
+  802ac5:	8b 04 24             	mov    (%esp),%eax
+  802ac8:	89 d7                	mov    %edx,%edi
+  802aca:	09 f0                	or     %esi,%eax
+  802acc:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  802ad0:	39 d8                	cmp    %ebx,%eax
+  802ad2:	19 f7                	sbb    %esi,%edi
+  802ad4:	72 04                	jb     802ada <__moddi3+0xaa>
+  802ad6:	29 d8                	sub    %ebx,%eax
+  802ad8:	19 f2                	sbb    %esi,%edx
+  802ada:	83 e9 01             	sub    $0x1,%ecx
+  802add:	73 b1                	jae    802a90 <__moddi3+0x60>
+  802adf:	85 ed                	test   %ebp,%ebp
+  802ae1:	74 07                	je     802aea <__moddi3+0xba>
+  802ae3:	f7 d8                	neg    %eax
+  802ae5:	83 d2 00             	adc    $0x0,%edx
+  802ae8:	f7 da                	neg    %edx
+  802aea:	83 c4 1c             	add    $0x1c,%esp
+  802aed:	5b                   	pop    %ebx
+  802aee:	5e                   	pop    %esi
+  802aef:	5f                   	pop    %edi
+  802af0:	5d                   	pop    %ebp
+  802af1:	c3                   	ret
+  802af2:	09 cb                	or     %ecx,%ebx
+  802af4:	74 f4                	je     802aea <__moddi3+0xba>
+  802af6:	f7 df                	neg    %edi
+  802af8:	bb 01 00 00 00       	mov    $0x1,%ebx
+  802afd:	83 d5 00             	adc    $0x0,%ebp
+  802b00:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802b04:	f7 dd                	neg    %ebp
+  802b06:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802b0a:	e9 58 ff ff ff       	jmp    802a67 <__moddi3+0x37>
@@ -0,0 +1,5758 @@
+
+obj/user/spin.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 84 00 00 00       	call   8000b5 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 10             	sub    $0x10,%esp
+	envid_t env;
+
+	cprintf("I am the parent.  Forking the child...\n");
+  80003a:	68 20 29 80 00       	push   $0x802920
+  80003f:	e8 69 01 00 00       	call   8001ad <cprintf>
+	if ((env = fork()) == 0) {
+  800044:	e8 d7 0e 00 00       	call   800f20 <fork>
+  800049:	83 c4 10             	add    $0x10,%esp
+  80004c:	85 c0                	test   %eax,%eax
+  80004e:	75 12                	jne    800062 <umain+0x2f>
+		cprintf("I am the child.  Spinning...\n");
+  800050:	83 ec 0c             	sub    $0xc,%esp
+  800053:	68 98 29 80 00       	push   $0x802998
+  800058:	e8 50 01 00 00       	call   8001ad <cprintf>
+  80005d:	83 c4 10             	add    $0x10,%esp
+		while (1)
+  800060:	eb fe                	jmp    800060 <umain+0x2d>
+  800062:	89 c3                	mov    %eax,%ebx
+			/* do nothing */;
+	}
+
+	cprintf("I am the parent.  Running the child...\n");
+  800064:	83 ec 0c             	sub    $0xc,%esp
+  800067:	68 48 29 80 00       	push   $0x802948
+  80006c:	e8 3c 01 00 00       	call   8001ad <cprintf>
+	sys_yield();
+  800071:	e8 bd 0a 00 00       	call   800b33 <sys_yield>
+	sys_yield();
+  800076:	e8 b8 0a 00 00       	call   800b33 <sys_yield>
+	sys_yield();
+  80007b:	e8 b3 0a 00 00       	call   800b33 <sys_yield>
+	sys_yield();
+  800080:	e8 ae 0a 00 00       	call   800b33 <sys_yield>
+	sys_yield();
+  800085:	e8 a9 0a 00 00       	call   800b33 <sys_yield>
+	sys_yield();
+  80008a:	e8 a4 0a 00 00       	call   800b33 <sys_yield>
+	sys_yield();
+  80008f:	e8 9f 0a 00 00       	call   800b33 <sys_yield>
+	sys_yield();
+  800094:	e8 9a 0a 00 00       	call   800b33 <sys_yield>
+
+	cprintf("I am the parent.  Killing the child...\n");
+  800099:	c7 04 24 70 29 80 00 	movl   $0x802970,(%esp)
+  8000a0:	e8 08 01 00 00       	call   8001ad <cprintf>
+	sys_env_destroy(env);
+  8000a5:	89 1c 24             	mov    %ebx,(%esp)
+  8000a8:	e8 26 0a 00 00       	call   800ad3 <sys_env_destroy>
+}
+  8000ad:	83 c4 10             	add    $0x10,%esp
+  8000b0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000b3:	c9                   	leave
+  8000b4:	c3                   	ret
+
+008000b5 <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  8000b5:	55                   	push   %ebp
+  8000b6:	89 e5                	mov    %esp,%ebp
+  8000b8:	56                   	push   %esi
+  8000b9:	53                   	push   %ebx
+  8000ba:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000bd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  8000c0:	e8 4f 0a 00 00       	call   800b14 <sys_getenvid>
+  8000c5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000ca:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8000cd:	c1 e0 04             	shl    $0x4,%eax
+  8000d0:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000d5:	a3 08 40 80 00       	mov    %eax,0x804008
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8000da:	85 db                	test   %ebx,%ebx
+  8000dc:	7e 07                	jle    8000e5 <libmain+0x30>
+    binaryname = argv[0];
+  8000de:	8b 06                	mov    (%esi),%eax
+  8000e0:	a3 00 30 80 00       	mov    %eax,0x803000
+
+  // call user main routine
+  umain(argc, argv);
+  8000e5:	83 ec 08             	sub    $0x8,%esp
+  8000e8:	56                   	push   %esi
+  8000e9:	53                   	push   %ebx
+  8000ea:	e8 44 ff ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  8000ef:	e8 0a 00 00 00       	call   8000fe <exit>
+}
+  8000f4:	83 c4 10             	add    $0x10,%esp
+  8000f7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000fa:	5b                   	pop    %ebx
+  8000fb:	5e                   	pop    %esi
+  8000fc:	5d                   	pop    %ebp
+  8000fd:	c3                   	ret
+
+008000fe <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000fe:	55                   	push   %ebp
+  8000ff:	89 e5                	mov    %esp,%ebp
+  800101:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800104:	e8 07 12 00 00       	call   801310 <close_all>
+	sys_env_destroy(0);
+  800109:	83 ec 0c             	sub    $0xc,%esp
+  80010c:	6a 00                	push   $0x0
+  80010e:	e8 c0 09 00 00       	call   800ad3 <sys_env_destroy>
+}
+  800113:	83 c4 10             	add    $0x10,%esp
+  800116:	c9                   	leave
+  800117:	c3                   	ret
+
+00800118 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800118:	55                   	push   %ebp
+  800119:	89 e5                	mov    %esp,%ebp
+  80011b:	53                   	push   %ebx
+  80011c:	83 ec 04             	sub    $0x4,%esp
+  80011f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800122:	8b 13                	mov    (%ebx),%edx
+  800124:	8d 42 01             	lea    0x1(%edx),%eax
+  800127:	89 03                	mov    %eax,(%ebx)
+  800129:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80012c:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800130:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800135:	74 09                	je     800140 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800137:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80013b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80013e:	c9                   	leave
+  80013f:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800140:	83 ec 08             	sub    $0x8,%esp
+  800143:	68 ff 00 00 00       	push   $0xff
+  800148:	8d 43 08             	lea    0x8(%ebx),%eax
+  80014b:	50                   	push   %eax
+  80014c:	e8 45 09 00 00       	call   800a96 <sys_cputs>
+		b->idx = 0;
+  800151:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800157:	83 c4 10             	add    $0x10,%esp
+  80015a:	eb db                	jmp    800137 <putch+0x1f>
+
+0080015c <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80015c:	55                   	push   %ebp
+  80015d:	89 e5                	mov    %esp,%ebp
+  80015f:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800165:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80016c:	00 00 00 
+	b.cnt = 0;
+  80016f:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800176:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800179:	ff 75 0c             	push   0xc(%ebp)
+  80017c:	ff 75 08             	push   0x8(%ebp)
+  80017f:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800185:	50                   	push   %eax
+  800186:	68 18 01 80 00       	push   $0x800118
+  80018b:	e8 14 01 00 00       	call   8002a4 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800190:	83 c4 08             	add    $0x8,%esp
+  800193:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800199:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80019f:	50                   	push   %eax
+  8001a0:	e8 f1 08 00 00       	call   800a96 <sys_cputs>
+
+	return b.cnt;
+}
+  8001a5:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001ab:	c9                   	leave
+  8001ac:	c3                   	ret
+
+008001ad <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001ad:	55                   	push   %ebp
+  8001ae:	89 e5                	mov    %esp,%ebp
+  8001b0:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8001b3:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8001b6:	50                   	push   %eax
+  8001b7:	ff 75 08             	push   0x8(%ebp)
+  8001ba:	e8 9d ff ff ff       	call   80015c <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8001bf:	c9                   	leave
+  8001c0:	c3                   	ret
+
+008001c1 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8001c1:	55                   	push   %ebp
+  8001c2:	89 e5                	mov    %esp,%ebp
+  8001c4:	57                   	push   %edi
+  8001c5:	56                   	push   %esi
+  8001c6:	53                   	push   %ebx
+  8001c7:	83 ec 1c             	sub    $0x1c,%esp
+  8001ca:	89 c7                	mov    %eax,%edi
+  8001cc:	89 d6                	mov    %edx,%esi
+  8001ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001d1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001d4:	89 d1                	mov    %edx,%ecx
+  8001d6:	89 c2                	mov    %eax,%edx
+  8001d8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001db:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001de:	8b 45 10             	mov    0x10(%ebp),%eax
+  8001e1:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8001e4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001e7:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8001ee:	39 c2                	cmp    %eax,%edx
+  8001f0:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8001f3:	72 3e                	jb     800233 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8001f5:	83 ec 0c             	sub    $0xc,%esp
+  8001f8:	ff 75 18             	push   0x18(%ebp)
+  8001fb:	83 eb 01             	sub    $0x1,%ebx
+  8001fe:	53                   	push   %ebx
+  8001ff:	50                   	push   %eax
+  800200:	83 ec 08             	sub    $0x8,%esp
+  800203:	ff 75 e4             	push   -0x1c(%ebp)
+  800206:	ff 75 e0             	push   -0x20(%ebp)
+  800209:	ff 75 dc             	push   -0x24(%ebp)
+  80020c:	ff 75 d8             	push   -0x28(%ebp)
+  80020f:	e8 6c 23 00 00       	call   802580 <__udivdi3>
+  800214:	83 c4 18             	add    $0x18,%esp
+  800217:	52                   	push   %edx
+  800218:	50                   	push   %eax
+  800219:	89 f2                	mov    %esi,%edx
+  80021b:	89 f8                	mov    %edi,%eax
+  80021d:	e8 9f ff ff ff       	call   8001c1 <printnum>
+  800222:	83 c4 20             	add    $0x20,%esp
+  800225:	eb 13                	jmp    80023a <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800227:	83 ec 08             	sub    $0x8,%esp
+  80022a:	56                   	push   %esi
+  80022b:	ff 75 18             	push   0x18(%ebp)
+  80022e:	ff d7                	call   *%edi
+  800230:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800233:	83 eb 01             	sub    $0x1,%ebx
+  800236:	85 db                	test   %ebx,%ebx
+  800238:	7f ed                	jg     800227 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80023a:	83 ec 08             	sub    $0x8,%esp
+  80023d:	56                   	push   %esi
+  80023e:	83 ec 04             	sub    $0x4,%esp
+  800241:	ff 75 e4             	push   -0x1c(%ebp)
+  800244:	ff 75 e0             	push   -0x20(%ebp)
+  800247:	ff 75 dc             	push   -0x24(%ebp)
+  80024a:	ff 75 d8             	push   -0x28(%ebp)
+  80024d:	e8 fe 23 00 00       	call   802650 <__umoddi3>
+  800252:	83 c4 14             	add    $0x14,%esp
+  800255:	0f be 80 c0 29 80 00 	movsbl 0x8029c0(%eax),%eax
+  80025c:	50                   	push   %eax
+  80025d:	ff d7                	call   *%edi
+}
+  80025f:	83 c4 10             	add    $0x10,%esp
+  800262:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800265:	5b                   	pop    %ebx
+  800266:	5e                   	pop    %esi
+  800267:	5f                   	pop    %edi
+  800268:	5d                   	pop    %ebp
+  800269:	c3                   	ret
+
+0080026a <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80026a:	55                   	push   %ebp
+  80026b:	89 e5                	mov    %esp,%ebp
+  80026d:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800270:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800274:	8b 10                	mov    (%eax),%edx
+  800276:	3b 50 04             	cmp    0x4(%eax),%edx
+  800279:	73 0a                	jae    800285 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80027b:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80027e:	89 08                	mov    %ecx,(%eax)
+  800280:	8b 45 08             	mov    0x8(%ebp),%eax
+  800283:	88 02                	mov    %al,(%edx)
+}
+  800285:	5d                   	pop    %ebp
+  800286:	c3                   	ret
+
+00800287 <printfmt>:
+{
+  800287:	55                   	push   %ebp
+  800288:	89 e5                	mov    %esp,%ebp
+  80028a:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80028d:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800290:	50                   	push   %eax
+  800291:	ff 75 10             	push   0x10(%ebp)
+  800294:	ff 75 0c             	push   0xc(%ebp)
+  800297:	ff 75 08             	push   0x8(%ebp)
+  80029a:	e8 05 00 00 00       	call   8002a4 <vprintfmt>
+}
+  80029f:	83 c4 10             	add    $0x10,%esp
+  8002a2:	c9                   	leave
+  8002a3:	c3                   	ret
+
+008002a4 <vprintfmt>:
+{
+  8002a4:	55                   	push   %ebp
+  8002a5:	89 e5                	mov    %esp,%ebp
+  8002a7:	57                   	push   %edi
+  8002a8:	56                   	push   %esi
+  8002a9:	53                   	push   %ebx
+  8002aa:	83 ec 2c             	sub    $0x2c,%esp
+  8002ad:	8b 75 08             	mov    0x8(%ebp),%esi
+  8002b0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8002b3:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8002b6:	eb 0a                	jmp    8002c2 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8002b8:	83 ec 08             	sub    $0x8,%esp
+  8002bb:	53                   	push   %ebx
+  8002bc:	50                   	push   %eax
+  8002bd:	ff d6                	call   *%esi
+  8002bf:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8002c2:	83 c7 01             	add    $0x1,%edi
+  8002c5:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8002c9:	83 f8 25             	cmp    $0x25,%eax
+  8002cc:	74 0c                	je     8002da <vprintfmt+0x36>
+			if (ch == '\0')
+  8002ce:	85 c0                	test   %eax,%eax
+  8002d0:	75 e6                	jne    8002b8 <vprintfmt+0x14>
+}
+  8002d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002d5:	5b                   	pop    %ebx
+  8002d6:	5e                   	pop    %esi
+  8002d7:	5f                   	pop    %edi
+  8002d8:	5d                   	pop    %ebp
+  8002d9:	c3                   	ret
+		padc = ' ';
+  8002da:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8002de:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8002e5:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8002ec:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8002f3:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8002f8:	8d 47 01             	lea    0x1(%edi),%eax
+  8002fb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8002fe:	0f b6 17             	movzbl (%edi),%edx
+  800301:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800304:	3c 55                	cmp    $0x55,%al
+  800306:	0f 87 9a 03 00 00    	ja     8006a6 <vprintfmt+0x402>
+  80030c:	0f b6 c0             	movzbl %al,%eax
+  80030f:	ff 24 85 00 2b 80 00 	jmp    *0x802b00(,%eax,4)
+  800316:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800319:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80031d:	eb d9                	jmp    8002f8 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80031f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800322:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800326:	eb d0                	jmp    8002f8 <vprintfmt+0x54>
+  800328:	0f b6 d2             	movzbl %dl,%edx
+  80032b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80032e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800333:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800336:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800339:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80033d:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800340:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800343:	83 f9 09             	cmp    $0x9,%ecx
+  800346:	77 55                	ja     80039d <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800348:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  80034b:	eb e9                	jmp    800336 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  80034d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800350:	8b 00                	mov    (%eax),%eax
+  800352:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800355:	8b 45 14             	mov    0x14(%ebp),%eax
+  800358:	8d 40 04             	lea    0x4(%eax),%eax
+  80035b:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80035e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800361:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800365:	79 91                	jns    8002f8 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800367:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80036a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80036d:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800374:	eb 82                	jmp    8002f8 <vprintfmt+0x54>
+			if (width < 0)
+  800376:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800379:	85 d2                	test   %edx,%edx
+  80037b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800380:	0f 49 c2             	cmovns %edx,%eax
+  800383:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800386:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800389:	e9 6a ff ff ff       	jmp    8002f8 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80038e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800391:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800398:	e9 5b ff ff ff       	jmp    8002f8 <vprintfmt+0x54>
+  80039d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003a0:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003a3:	eb bc                	jmp    800361 <vprintfmt+0xbd>
+			lflag++;
+  8003a5:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003a8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003ab:	e9 48 ff ff ff       	jmp    8002f8 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8003b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003b3:	8d 78 04             	lea    0x4(%eax),%edi
+  8003b6:	83 ec 08             	sub    $0x8,%esp
+  8003b9:	53                   	push   %ebx
+  8003ba:	ff 30                	push   (%eax)
+  8003bc:	ff d6                	call   *%esi
+			break;
+  8003be:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8003c1:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8003c4:	e9 7c 02 00 00       	jmp    800645 <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  8003c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003cc:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8003cf:	8b 10                	mov    (%eax),%edx
+  8003d1:	89 d0                	mov    %edx,%eax
+  8003d3:	f7 d8                	neg    %eax
+  8003d5:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8003d8:	83 f8 10             	cmp    $0x10,%eax
+  8003db:	7f 23                	jg     800400 <vprintfmt+0x15c>
+  8003dd:	8b 14 85 60 2c 80 00 	mov    0x802c60(,%eax,4),%edx
+  8003e4:	85 d2                	test   %edx,%edx
+  8003e6:	74 18                	je     800400 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8003e8:	52                   	push   %edx
+  8003e9:	68 a5 2e 80 00       	push   $0x802ea5
+  8003ee:	53                   	push   %ebx
+  8003ef:	56                   	push   %esi
+  8003f0:	e8 92 fe ff ff       	call   800287 <printfmt>
+  8003f5:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003f8:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8003fb:	e9 45 02 00 00       	jmp    800645 <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  800400:	50                   	push   %eax
+  800401:	68 d8 29 80 00       	push   $0x8029d8
+  800406:	53                   	push   %ebx
+  800407:	56                   	push   %esi
+  800408:	e8 7a fe ff ff       	call   800287 <printfmt>
+  80040d:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800410:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800413:	e9 2d 02 00 00       	jmp    800645 <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800418:	8b 45 14             	mov    0x14(%ebp),%eax
+  80041b:	83 c0 04             	add    $0x4,%eax
+  80041e:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800421:	8b 45 14             	mov    0x14(%ebp),%eax
+  800424:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800426:	85 c9                	test   %ecx,%ecx
+  800428:	b8 d1 29 80 00       	mov    $0x8029d1,%eax
+  80042d:	0f 45 c1             	cmovne %ecx,%eax
+  800430:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800433:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800437:	7e 06                	jle    80043f <vprintfmt+0x19b>
+  800439:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80043d:	75 0b                	jne    80044a <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80043f:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800442:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800445:	89 75 08             	mov    %esi,0x8(%ebp)
+  800448:	eb 5c                	jmp    8004a6 <vprintfmt+0x202>
+  80044a:	83 ec 08             	sub    $0x8,%esp
+  80044d:	ff 75 d0             	push   -0x30(%ebp)
+  800450:	ff 75 cc             	push   -0x34(%ebp)
+  800453:	e8 eb 02 00 00       	call   800743 <strnlen>
+  800458:	89 c2                	mov    %eax,%edx
+  80045a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80045d:	29 d0                	sub    %edx,%eax
+  80045f:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800462:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800466:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800469:	89 75 08             	mov    %esi,0x8(%ebp)
+  80046c:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80046e:	eb 0e                	jmp    80047e <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800470:	83 ec 08             	sub    $0x8,%esp
+  800473:	53                   	push   %ebx
+  800474:	57                   	push   %edi
+  800475:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800478:	83 ee 01             	sub    $0x1,%esi
+  80047b:	83 c4 10             	add    $0x10,%esp
+  80047e:	85 f6                	test   %esi,%esi
+  800480:	7f ee                	jg     800470 <vprintfmt+0x1cc>
+  800482:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800485:	8b 75 08             	mov    0x8(%ebp),%esi
+  800488:	85 c0                	test   %eax,%eax
+  80048a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80048f:	0f 49 d0             	cmovns %eax,%edx
+  800492:	29 d0                	sub    %edx,%eax
+  800494:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800497:	eb a6                	jmp    80043f <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800499:	83 ec 08             	sub    $0x8,%esp
+  80049c:	53                   	push   %ebx
+  80049d:	52                   	push   %edx
+  80049e:	ff 55 08             	call   *0x8(%ebp)
+  8004a1:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004a4:	89 f1                	mov    %esi,%ecx
+  8004a6:	8d 71 01             	lea    0x1(%ecx),%esi
+  8004a9:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004ad:	0f be d0             	movsbl %al,%edx
+  8004b0:	85 d2                	test   %edx,%edx
+  8004b2:	74 28                	je     8004dc <vprintfmt+0x238>
+  8004b4:	85 ff                	test   %edi,%edi
+  8004b6:	78 05                	js     8004bd <vprintfmt+0x219>
+  8004b8:	83 ef 01             	sub    $0x1,%edi
+  8004bb:	78 30                	js     8004ed <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8004bd:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8004c1:	74 d6                	je     800499 <vprintfmt+0x1f5>
+  8004c3:	0f be c0             	movsbl %al,%eax
+  8004c6:	83 e8 20             	sub    $0x20,%eax
+  8004c9:	83 f8 5e             	cmp    $0x5e,%eax
+  8004cc:	76 cb                	jbe    800499 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8004ce:	83 ec 08             	sub    $0x8,%esp
+  8004d1:	53                   	push   %ebx
+  8004d2:	6a 3f                	push   $0x3f
+  8004d4:	ff 55 08             	call   *0x8(%ebp)
+  8004d7:	83 c4 10             	add    $0x10,%esp
+  8004da:	eb c8                	jmp    8004a4 <vprintfmt+0x200>
+  8004dc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004df:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8004e2:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004e5:	01 d0                	add    %edx,%eax
+  8004e7:	29 c8                	sub    %ecx,%eax
+  8004e9:	89 c7                	mov    %eax,%edi
+  8004eb:	eb 13                	jmp    800500 <vprintfmt+0x25c>
+  8004ed:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004f0:	eb ed                	jmp    8004df <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8004f2:	83 ec 08             	sub    $0x8,%esp
+  8004f5:	53                   	push   %ebx
+  8004f6:	6a 20                	push   $0x20
+  8004f8:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8004fa:	83 ef 01             	sub    $0x1,%edi
+  8004fd:	83 c4 10             	add    $0x10,%esp
+  800500:	85 ff                	test   %edi,%edi
+  800502:	7f ee                	jg     8004f2 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800504:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800507:	89 45 14             	mov    %eax,0x14(%ebp)
+  80050a:	e9 36 01 00 00       	jmp    800645 <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  80050f:	83 f9 01             	cmp    $0x1,%ecx
+  800512:	7f 1f                	jg     800533 <vprintfmt+0x28f>
+	else if (lflag)
+  800514:	85 c9                	test   %ecx,%ecx
+  800516:	74 67                	je     80057f <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800518:	8b 45 14             	mov    0x14(%ebp),%eax
+  80051b:	8b 00                	mov    (%eax),%eax
+  80051d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800520:	89 c1                	mov    %eax,%ecx
+  800522:	c1 f9 1f             	sar    $0x1f,%ecx
+  800525:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800528:	8b 45 14             	mov    0x14(%ebp),%eax
+  80052b:	8d 40 04             	lea    0x4(%eax),%eax
+  80052e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800531:	eb 17                	jmp    80054a <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800533:	8b 45 14             	mov    0x14(%ebp),%eax
+  800536:	8b 50 04             	mov    0x4(%eax),%edx
+  800539:	8b 00                	mov    (%eax),%eax
+  80053b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80053e:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800541:	8b 45 14             	mov    0x14(%ebp),%eax
+  800544:	8d 40 08             	lea    0x8(%eax),%eax
+  800547:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80054a:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80054d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800550:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800555:	85 c9                	test   %ecx,%ecx
+  800557:	0f 89 ce 00 00 00    	jns    80062b <vprintfmt+0x387>
+				putch('-', putdat);
+  80055d:	83 ec 08             	sub    $0x8,%esp
+  800560:	53                   	push   %ebx
+  800561:	6a 2d                	push   $0x2d
+  800563:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800565:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800568:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80056b:	f7 da                	neg    %edx
+  80056d:	83 d1 00             	adc    $0x0,%ecx
+  800570:	f7 d9                	neg    %ecx
+  800572:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800575:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80057a:	e9 ac 00 00 00       	jmp    80062b <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  80057f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800582:	8b 00                	mov    (%eax),%eax
+  800584:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800587:	89 c1                	mov    %eax,%ecx
+  800589:	c1 f9 1f             	sar    $0x1f,%ecx
+  80058c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80058f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800592:	8d 40 04             	lea    0x4(%eax),%eax
+  800595:	89 45 14             	mov    %eax,0x14(%ebp)
+  800598:	eb b0                	jmp    80054a <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  80059a:	83 f9 01             	cmp    $0x1,%ecx
+  80059d:	7f 1b                	jg     8005ba <vprintfmt+0x316>
+	else if (lflag)
+  80059f:	85 c9                	test   %ecx,%ecx
+  8005a1:	74 2c                	je     8005cf <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  8005a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a6:	8b 10                	mov    (%eax),%edx
+  8005a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005ad:	8d 40 04             	lea    0x4(%eax),%eax
+  8005b0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005b3:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8005b8:	eb 71                	jmp    80062b <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  8005ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005bd:	8b 10                	mov    (%eax),%edx
+  8005bf:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005c2:	8d 40 08             	lea    0x8(%eax),%eax
+  8005c5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005c8:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8005cd:	eb 5c                	jmp    80062b <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  8005cf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d2:	8b 10                	mov    (%eax),%edx
+  8005d4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005d9:	8d 40 04             	lea    0x4(%eax),%eax
+  8005dc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005df:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8005e4:	eb 45                	jmp    80062b <vprintfmt+0x387>
+			putch('X', putdat);
+  8005e6:	83 ec 08             	sub    $0x8,%esp
+  8005e9:	53                   	push   %ebx
+  8005ea:	6a 58                	push   $0x58
+  8005ec:	ff d6                	call   *%esi
+			putch('X', putdat);
+  8005ee:	83 c4 08             	add    $0x8,%esp
+  8005f1:	53                   	push   %ebx
+  8005f2:	6a 58                	push   $0x58
+  8005f4:	ff d6                	call   *%esi
+			putch('X', putdat);
+  8005f6:	83 c4 08             	add    $0x8,%esp
+  8005f9:	53                   	push   %ebx
+  8005fa:	6a 58                	push   $0x58
+  8005fc:	ff d6                	call   *%esi
+			break;
+  8005fe:	83 c4 10             	add    $0x10,%esp
+  800601:	eb 42                	jmp    800645 <vprintfmt+0x3a1>
+			putch('0', putdat);
+  800603:	83 ec 08             	sub    $0x8,%esp
+  800606:	53                   	push   %ebx
+  800607:	6a 30                	push   $0x30
+  800609:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80060b:	83 c4 08             	add    $0x8,%esp
+  80060e:	53                   	push   %ebx
+  80060f:	6a 78                	push   $0x78
+  800611:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800613:	8b 45 14             	mov    0x14(%ebp),%eax
+  800616:	8b 10                	mov    (%eax),%edx
+  800618:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80061d:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800620:	8d 40 04             	lea    0x4(%eax),%eax
+  800623:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800626:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80062b:	83 ec 0c             	sub    $0xc,%esp
+  80062e:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800632:	50                   	push   %eax
+  800633:	ff 75 e0             	push   -0x20(%ebp)
+  800636:	57                   	push   %edi
+  800637:	51                   	push   %ecx
+  800638:	52                   	push   %edx
+  800639:	89 da                	mov    %ebx,%edx
+  80063b:	89 f0                	mov    %esi,%eax
+  80063d:	e8 7f fb ff ff       	call   8001c1 <printnum>
+			break;
+  800642:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800645:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800648:	e9 75 fc ff ff       	jmp    8002c2 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  80064d:	83 f9 01             	cmp    $0x1,%ecx
+  800650:	7f 1b                	jg     80066d <vprintfmt+0x3c9>
+	else if (lflag)
+  800652:	85 c9                	test   %ecx,%ecx
+  800654:	74 2c                	je     800682 <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  800656:	8b 45 14             	mov    0x14(%ebp),%eax
+  800659:	8b 10                	mov    (%eax),%edx
+  80065b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800660:	8d 40 04             	lea    0x4(%eax),%eax
+  800663:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800666:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  80066b:	eb be                	jmp    80062b <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  80066d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800670:	8b 10                	mov    (%eax),%edx
+  800672:	8b 48 04             	mov    0x4(%eax),%ecx
+  800675:	8d 40 08             	lea    0x8(%eax),%eax
+  800678:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80067b:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800680:	eb a9                	jmp    80062b <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  800682:	8b 45 14             	mov    0x14(%ebp),%eax
+  800685:	8b 10                	mov    (%eax),%edx
+  800687:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80068c:	8d 40 04             	lea    0x4(%eax),%eax
+  80068f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800692:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800697:	eb 92                	jmp    80062b <vprintfmt+0x387>
+			putch(ch, putdat);
+  800699:	83 ec 08             	sub    $0x8,%esp
+  80069c:	53                   	push   %ebx
+  80069d:	6a 25                	push   $0x25
+  80069f:	ff d6                	call   *%esi
+			break;
+  8006a1:	83 c4 10             	add    $0x10,%esp
+  8006a4:	eb 9f                	jmp    800645 <vprintfmt+0x3a1>
+			putch('%', putdat);
+  8006a6:	83 ec 08             	sub    $0x8,%esp
+  8006a9:	53                   	push   %ebx
+  8006aa:	6a 25                	push   $0x25
+  8006ac:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8006ae:	83 c4 10             	add    $0x10,%esp
+  8006b1:	89 f8                	mov    %edi,%eax
+  8006b3:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8006b7:	74 05                	je     8006be <vprintfmt+0x41a>
+  8006b9:	83 e8 01             	sub    $0x1,%eax
+  8006bc:	eb f5                	jmp    8006b3 <vprintfmt+0x40f>
+  8006be:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8006c1:	eb 82                	jmp    800645 <vprintfmt+0x3a1>
+
+008006c3 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8006c3:	55                   	push   %ebp
+  8006c4:	89 e5                	mov    %esp,%ebp
+  8006c6:	83 ec 18             	sub    $0x18,%esp
+  8006c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006cc:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8006cf:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8006d2:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8006d6:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8006d9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8006e0:	85 c0                	test   %eax,%eax
+  8006e2:	74 26                	je     80070a <vsnprintf+0x47>
+  8006e4:	85 d2                	test   %edx,%edx
+  8006e6:	7e 22                	jle    80070a <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8006e8:	ff 75 14             	push   0x14(%ebp)
+  8006eb:	ff 75 10             	push   0x10(%ebp)
+  8006ee:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8006f1:	50                   	push   %eax
+  8006f2:	68 6a 02 80 00       	push   $0x80026a
+  8006f7:	e8 a8 fb ff ff       	call   8002a4 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8006fc:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8006ff:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800702:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800705:	83 c4 10             	add    $0x10,%esp
+}
+  800708:	c9                   	leave
+  800709:	c3                   	ret
+		return -E_INVAL;
+  80070a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80070f:	eb f7                	jmp    800708 <vsnprintf+0x45>
+
+00800711 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800711:	55                   	push   %ebp
+  800712:	89 e5                	mov    %esp,%ebp
+  800714:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800717:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80071a:	50                   	push   %eax
+  80071b:	ff 75 10             	push   0x10(%ebp)
+  80071e:	ff 75 0c             	push   0xc(%ebp)
+  800721:	ff 75 08             	push   0x8(%ebp)
+  800724:	e8 9a ff ff ff       	call   8006c3 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800729:	c9                   	leave
+  80072a:	c3                   	ret
+
+0080072b <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80072b:	55                   	push   %ebp
+  80072c:	89 e5                	mov    %esp,%ebp
+  80072e:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800731:	b8 00 00 00 00       	mov    $0x0,%eax
+  800736:	eb 03                	jmp    80073b <strlen+0x10>
+		n++;
+  800738:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80073b:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80073f:	75 f7                	jne    800738 <strlen+0xd>
+	return n;
+}
+  800741:	5d                   	pop    %ebp
+  800742:	c3                   	ret
+
+00800743 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800743:	55                   	push   %ebp
+  800744:	89 e5                	mov    %esp,%ebp
+  800746:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800749:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80074c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800751:	eb 03                	jmp    800756 <strnlen+0x13>
+		n++;
+  800753:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800756:	39 d0                	cmp    %edx,%eax
+  800758:	74 08                	je     800762 <strnlen+0x1f>
+  80075a:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80075e:	75 f3                	jne    800753 <strnlen+0x10>
+  800760:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800762:	89 d0                	mov    %edx,%eax
+  800764:	5d                   	pop    %ebp
+  800765:	c3                   	ret
+
+00800766 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800766:	55                   	push   %ebp
+  800767:	89 e5                	mov    %esp,%ebp
+  800769:	53                   	push   %ebx
+  80076a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80076d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800770:	b8 00 00 00 00       	mov    $0x0,%eax
+  800775:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800779:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80077c:	83 c0 01             	add    $0x1,%eax
+  80077f:	84 d2                	test   %dl,%dl
+  800781:	75 f2                	jne    800775 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800783:	89 c8                	mov    %ecx,%eax
+  800785:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800788:	c9                   	leave
+  800789:	c3                   	ret
+
+0080078a <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80078a:	55                   	push   %ebp
+  80078b:	89 e5                	mov    %esp,%ebp
+  80078d:	53                   	push   %ebx
+  80078e:	83 ec 10             	sub    $0x10,%esp
+  800791:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800794:	53                   	push   %ebx
+  800795:	e8 91 ff ff ff       	call   80072b <strlen>
+  80079a:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80079d:	ff 75 0c             	push   0xc(%ebp)
+  8007a0:	01 d8                	add    %ebx,%eax
+  8007a2:	50                   	push   %eax
+  8007a3:	e8 be ff ff ff       	call   800766 <strcpy>
+	return dst;
+}
+  8007a8:	89 d8                	mov    %ebx,%eax
+  8007aa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007ad:	c9                   	leave
+  8007ae:	c3                   	ret
+
+008007af <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8007af:	55                   	push   %ebp
+  8007b0:	89 e5                	mov    %esp,%ebp
+  8007b2:	56                   	push   %esi
+  8007b3:	53                   	push   %ebx
+  8007b4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007b7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8007ba:	89 f3                	mov    %esi,%ebx
+  8007bc:	03 5d 10             	add    0x10(%ebp),%ebx
+  8007bf:	89 f0                	mov    %esi,%eax
+  8007c1:	eb 0f                	jmp    8007d2 <strncpy+0x23>
+		*dst++ = *src;
+  8007c3:	83 c0 01             	add    $0x1,%eax
+  8007c6:	0f b6 0a             	movzbl (%edx),%ecx
+  8007c9:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8007cc:	80 f9 01             	cmp    $0x1,%cl
+  8007cf:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8007d2:	39 d8                	cmp    %ebx,%eax
+  8007d4:	75 ed                	jne    8007c3 <strncpy+0x14>
+	}
+	return ret;
+}
+  8007d6:	89 f0                	mov    %esi,%eax
+  8007d8:	5b                   	pop    %ebx
+  8007d9:	5e                   	pop    %esi
+  8007da:	5d                   	pop    %ebp
+  8007db:	c3                   	ret
+
+008007dc <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8007dc:	55                   	push   %ebp
+  8007dd:	89 e5                	mov    %esp,%ebp
+  8007df:	56                   	push   %esi
+  8007e0:	53                   	push   %ebx
+  8007e1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007e4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007e7:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8007ea:	89 f0                	mov    %esi,%eax
+  8007ec:	85 d2                	test   %edx,%edx
+  8007ee:	74 21                	je     800811 <strlcpy+0x35>
+  8007f0:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8007f4:	89 f2                	mov    %esi,%edx
+  8007f6:	eb 09                	jmp    800801 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8007f8:	83 c1 01             	add    $0x1,%ecx
+  8007fb:	83 c2 01             	add    $0x1,%edx
+  8007fe:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800801:	39 c2                	cmp    %eax,%edx
+  800803:	74 09                	je     80080e <strlcpy+0x32>
+  800805:	0f b6 19             	movzbl (%ecx),%ebx
+  800808:	84 db                	test   %bl,%bl
+  80080a:	75 ec                	jne    8007f8 <strlcpy+0x1c>
+  80080c:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80080e:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800811:	29 f0                	sub    %esi,%eax
+}
+  800813:	5b                   	pop    %ebx
+  800814:	5e                   	pop    %esi
+  800815:	5d                   	pop    %ebp
+  800816:	c3                   	ret
+
+00800817 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800817:	55                   	push   %ebp
+  800818:	89 e5                	mov    %esp,%ebp
+  80081a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80081d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800820:	eb 06                	jmp    800828 <strcmp+0x11>
+		p++, q++;
+  800822:	83 c1 01             	add    $0x1,%ecx
+  800825:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800828:	0f b6 01             	movzbl (%ecx),%eax
+  80082b:	84 c0                	test   %al,%al
+  80082d:	74 04                	je     800833 <strcmp+0x1c>
+  80082f:	3a 02                	cmp    (%edx),%al
+  800831:	74 ef                	je     800822 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800833:	0f b6 c0             	movzbl %al,%eax
+  800836:	0f b6 12             	movzbl (%edx),%edx
+  800839:	29 d0                	sub    %edx,%eax
+}
+  80083b:	5d                   	pop    %ebp
+  80083c:	c3                   	ret
+
+0080083d <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80083d:	55                   	push   %ebp
+  80083e:	89 e5                	mov    %esp,%ebp
+  800840:	53                   	push   %ebx
+  800841:	8b 45 08             	mov    0x8(%ebp),%eax
+  800844:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800847:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80084a:	eb 09                	jmp    800855 <strncmp+0x18>
+		n--, p++, q++;
+  80084c:	83 ea 01             	sub    $0x1,%edx
+  80084f:	83 c0 01             	add    $0x1,%eax
+  800852:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800855:	85 d2                	test   %edx,%edx
+  800857:	74 18                	je     800871 <strncmp+0x34>
+  800859:	0f b6 18             	movzbl (%eax),%ebx
+  80085c:	84 db                	test   %bl,%bl
+  80085e:	74 04                	je     800864 <strncmp+0x27>
+  800860:	3a 19                	cmp    (%ecx),%bl
+  800862:	74 e8                	je     80084c <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800864:	0f b6 00             	movzbl (%eax),%eax
+  800867:	0f b6 11             	movzbl (%ecx),%edx
+  80086a:	29 d0                	sub    %edx,%eax
+}
+  80086c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80086f:	c9                   	leave
+  800870:	c3                   	ret
+		return 0;
+  800871:	b8 00 00 00 00       	mov    $0x0,%eax
+  800876:	eb f4                	jmp    80086c <strncmp+0x2f>
+
+00800878 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800878:	55                   	push   %ebp
+  800879:	89 e5                	mov    %esp,%ebp
+  80087b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80087e:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800882:	eb 03                	jmp    800887 <strchr+0xf>
+  800884:	83 c0 01             	add    $0x1,%eax
+  800887:	0f b6 10             	movzbl (%eax),%edx
+  80088a:	84 d2                	test   %dl,%dl
+  80088c:	74 06                	je     800894 <strchr+0x1c>
+		if (*s == c)
+  80088e:	38 ca                	cmp    %cl,%dl
+  800890:	75 f2                	jne    800884 <strchr+0xc>
+  800892:	eb 05                	jmp    800899 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800894:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800899:	5d                   	pop    %ebp
+  80089a:	c3                   	ret
+
+0080089b <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80089b:	55                   	push   %ebp
+  80089c:	89 e5                	mov    %esp,%ebp
+  80089e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008a1:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008a5:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8008a8:	38 ca                	cmp    %cl,%dl
+  8008aa:	74 09                	je     8008b5 <strfind+0x1a>
+  8008ac:	84 d2                	test   %dl,%dl
+  8008ae:	74 05                	je     8008b5 <strfind+0x1a>
+	for (; *s; s++)
+  8008b0:	83 c0 01             	add    $0x1,%eax
+  8008b3:	eb f0                	jmp    8008a5 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8008b5:	5d                   	pop    %ebp
+  8008b6:	c3                   	ret
+
+008008b7 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8008b7:	55                   	push   %ebp
+  8008b8:	89 e5                	mov    %esp,%ebp
+  8008ba:	57                   	push   %edi
+  8008bb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8008be:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8008c1:	85 c9                	test   %ecx,%ecx
+  8008c3:	74 20                	je     8008e5 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8008c5:	89 f8                	mov    %edi,%eax
+  8008c7:	09 c8                	or     %ecx,%eax
+  8008c9:	a8 03                	test   $0x3,%al
+  8008cb:	75 12                	jne    8008df <memset+0x28>
+		c &= 0xFF;
+  8008cd:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8008d1:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8008d7:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8008da:	fc                   	cld
+  8008db:	f3 ab                	rep stos %eax,%es:(%edi)
+  8008dd:	eb 06                	jmp    8008e5 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8008df:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8008e2:	fc                   	cld
+  8008e3:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8008e5:	89 f8                	mov    %edi,%eax
+  8008e7:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8008ea:	c9                   	leave
+  8008eb:	c3                   	ret
+
+008008ec <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8008ec:	55                   	push   %ebp
+  8008ed:	89 e5                	mov    %esp,%ebp
+  8008ef:	57                   	push   %edi
+  8008f0:	56                   	push   %esi
+  8008f1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008f4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8008f7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8008fa:	39 c6                	cmp    %eax,%esi
+  8008fc:	73 32                	jae    800930 <memmove+0x44>
+  8008fe:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800901:	39 d0                	cmp    %edx,%eax
+  800903:	73 2b                	jae    800930 <memmove+0x44>
+		s += n;
+		d += n;
+  800905:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800908:	89 d6                	mov    %edx,%esi
+  80090a:	09 fe                	or     %edi,%esi
+  80090c:	09 ce                	or     %ecx,%esi
+  80090e:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800914:	75 0e                	jne    800924 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800916:	83 ef 04             	sub    $0x4,%edi
+  800919:	8d 72 fc             	lea    -0x4(%edx),%esi
+  80091c:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  80091f:	fd                   	std
+  800920:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800922:	eb 09                	jmp    80092d <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800924:	83 ef 01             	sub    $0x1,%edi
+  800927:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  80092a:	fd                   	std
+  80092b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  80092d:	fc                   	cld
+  80092e:	eb 1a                	jmp    80094a <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800930:	89 f2                	mov    %esi,%edx
+  800932:	09 c2                	or     %eax,%edx
+  800934:	09 ca                	or     %ecx,%edx
+  800936:	f6 c2 03             	test   $0x3,%dl
+  800939:	75 0a                	jne    800945 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  80093b:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  80093e:	89 c7                	mov    %eax,%edi
+  800940:	fc                   	cld
+  800941:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800943:	eb 05                	jmp    80094a <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800945:	89 c7                	mov    %eax,%edi
+  800947:	fc                   	cld
+  800948:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  80094a:	5e                   	pop    %esi
+  80094b:	5f                   	pop    %edi
+  80094c:	5d                   	pop    %ebp
+  80094d:	c3                   	ret
+
+0080094e <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  80094e:	55                   	push   %ebp
+  80094f:	89 e5                	mov    %esp,%ebp
+  800951:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800954:	ff 75 10             	push   0x10(%ebp)
+  800957:	ff 75 0c             	push   0xc(%ebp)
+  80095a:	ff 75 08             	push   0x8(%ebp)
+  80095d:	e8 8a ff ff ff       	call   8008ec <memmove>
+}
+  800962:	c9                   	leave
+  800963:	c3                   	ret
+
+00800964 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800964:	55                   	push   %ebp
+  800965:	89 e5                	mov    %esp,%ebp
+  800967:	56                   	push   %esi
+  800968:	53                   	push   %ebx
+  800969:	8b 45 08             	mov    0x8(%ebp),%eax
+  80096c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  80096f:	89 c6                	mov    %eax,%esi
+  800971:	03 75 10             	add    0x10(%ebp),%esi
+  800974:	eb 06                	jmp    80097c <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800976:	83 c0 01             	add    $0x1,%eax
+  800979:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  80097c:	39 f0                	cmp    %esi,%eax
+  80097e:	74 14                	je     800994 <memcmp+0x30>
+		if (*s1 != *s2)
+  800980:	0f b6 08             	movzbl (%eax),%ecx
+  800983:	0f b6 1a             	movzbl (%edx),%ebx
+  800986:	38 d9                	cmp    %bl,%cl
+  800988:	74 ec                	je     800976 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  80098a:	0f b6 c1             	movzbl %cl,%eax
+  80098d:	0f b6 db             	movzbl %bl,%ebx
+  800990:	29 d8                	sub    %ebx,%eax
+  800992:	eb 05                	jmp    800999 <memcmp+0x35>
+	}
+
+	return 0;
+  800994:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800999:	5b                   	pop    %ebx
+  80099a:	5e                   	pop    %esi
+  80099b:	5d                   	pop    %ebp
+  80099c:	c3                   	ret
+
+0080099d <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  80099d:	55                   	push   %ebp
+  80099e:	89 e5                	mov    %esp,%ebp
+  8009a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009a3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8009a6:	89 c2                	mov    %eax,%edx
+  8009a8:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8009ab:	eb 03                	jmp    8009b0 <memfind+0x13>
+  8009ad:	83 c0 01             	add    $0x1,%eax
+  8009b0:	39 d0                	cmp    %edx,%eax
+  8009b2:	73 04                	jae    8009b8 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8009b4:	38 08                	cmp    %cl,(%eax)
+  8009b6:	75 f5                	jne    8009ad <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8009b8:	5d                   	pop    %ebp
+  8009b9:	c3                   	ret
+
+008009ba <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8009ba:	55                   	push   %ebp
+  8009bb:	89 e5                	mov    %esp,%ebp
+  8009bd:	57                   	push   %edi
+  8009be:	56                   	push   %esi
+  8009bf:	53                   	push   %ebx
+  8009c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009c3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8009c6:	eb 03                	jmp    8009cb <strtol+0x11>
+		s++;
+  8009c8:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  8009cb:	0f b6 02             	movzbl (%edx),%eax
+  8009ce:	3c 20                	cmp    $0x20,%al
+  8009d0:	74 f6                	je     8009c8 <strtol+0xe>
+  8009d2:	3c 09                	cmp    $0x9,%al
+  8009d4:	74 f2                	je     8009c8 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8009d6:	3c 2b                	cmp    $0x2b,%al
+  8009d8:	74 2a                	je     800a04 <strtol+0x4a>
+	int neg = 0;
+  8009da:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8009df:	3c 2d                	cmp    $0x2d,%al
+  8009e1:	74 2b                	je     800a0e <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009e3:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8009e9:	75 0f                	jne    8009fa <strtol+0x40>
+  8009eb:	80 3a 30             	cmpb   $0x30,(%edx)
+  8009ee:	74 28                	je     800a18 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8009f0:	85 db                	test   %ebx,%ebx
+  8009f2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8009f7:	0f 44 d8             	cmove  %eax,%ebx
+  8009fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009ff:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a02:	eb 46                	jmp    800a4a <strtol+0x90>
+		s++;
+  800a04:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a07:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a0c:	eb d5                	jmp    8009e3 <strtol+0x29>
+		s++, neg = 1;
+  800a0e:	83 c2 01             	add    $0x1,%edx
+  800a11:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a16:	eb cb                	jmp    8009e3 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a18:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a1c:	74 0e                	je     800a2c <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a1e:	85 db                	test   %ebx,%ebx
+  800a20:	75 d8                	jne    8009fa <strtol+0x40>
+		s++, base = 8;
+  800a22:	83 c2 01             	add    $0x1,%edx
+  800a25:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a2a:	eb ce                	jmp    8009fa <strtol+0x40>
+		s += 2, base = 16;
+  800a2c:	83 c2 02             	add    $0x2,%edx
+  800a2f:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a34:	eb c4                	jmp    8009fa <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a36:	0f be c0             	movsbl %al,%eax
+  800a39:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a3c:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a3f:	7d 3a                	jge    800a7b <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a41:	83 c2 01             	add    $0x1,%edx
+  800a44:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a48:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a4a:	0f b6 02             	movzbl (%edx),%eax
+  800a4d:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a50:	89 f3                	mov    %esi,%ebx
+  800a52:	80 fb 09             	cmp    $0x9,%bl
+  800a55:	76 df                	jbe    800a36 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a57:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a5a:	89 f3                	mov    %esi,%ebx
+  800a5c:	80 fb 19             	cmp    $0x19,%bl
+  800a5f:	77 08                	ja     800a69 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800a61:	0f be c0             	movsbl %al,%eax
+  800a64:	83 e8 57             	sub    $0x57,%eax
+  800a67:	eb d3                	jmp    800a3c <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800a69:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800a6c:	89 f3                	mov    %esi,%ebx
+  800a6e:	80 fb 19             	cmp    $0x19,%bl
+  800a71:	77 08                	ja     800a7b <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800a73:	0f be c0             	movsbl %al,%eax
+  800a76:	83 e8 37             	sub    $0x37,%eax
+  800a79:	eb c1                	jmp    800a3c <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800a7b:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800a7f:	74 05                	je     800a86 <strtol+0xcc>
+		*endptr = (char *) s;
+  800a81:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a84:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800a86:	89 c8                	mov    %ecx,%eax
+  800a88:	f7 d8                	neg    %eax
+  800a8a:	85 ff                	test   %edi,%edi
+  800a8c:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800a8f:	89 c8                	mov    %ecx,%eax
+  800a91:	5b                   	pop    %ebx
+  800a92:	5e                   	pop    %esi
+  800a93:	5f                   	pop    %edi
+  800a94:	5d                   	pop    %ebp
+  800a95:	c3                   	ret
+
+00800a96 <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800a96:	55                   	push   %ebp
+  800a97:	89 e5                	mov    %esp,%ebp
+  800a99:	57                   	push   %edi
+  800a9a:	56                   	push   %esi
+  800a9b:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800a9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aa1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800aa4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800aa7:	89 c3                	mov    %eax,%ebx
+  800aa9:	89 c7                	mov    %eax,%edi
+  800aab:	89 c6                	mov    %eax,%esi
+  800aad:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  800aaf:	5b                   	pop    %ebx
+  800ab0:	5e                   	pop    %esi
+  800ab1:	5f                   	pop    %edi
+  800ab2:	5d                   	pop    %ebp
+  800ab3:	c3                   	ret
+
+00800ab4 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800ab4:	55                   	push   %ebp
+  800ab5:	89 e5                	mov    %esp,%ebp
+  800ab7:	57                   	push   %edi
+  800ab8:	56                   	push   %esi
+  800ab9:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800aba:	ba 00 00 00 00       	mov    $0x0,%edx
+  800abf:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ac4:	89 d1                	mov    %edx,%ecx
+  800ac6:	89 d3                	mov    %edx,%ebx
+  800ac8:	89 d7                	mov    %edx,%edi
+  800aca:	89 d6                	mov    %edx,%esi
+  800acc:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800ace:	5b                   	pop    %ebx
+  800acf:	5e                   	pop    %esi
+  800ad0:	5f                   	pop    %edi
+  800ad1:	5d                   	pop    %ebp
+  800ad2:	c3                   	ret
+
+00800ad3 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800ad3:	55                   	push   %ebp
+  800ad4:	89 e5                	mov    %esp,%ebp
+  800ad6:	57                   	push   %edi
+  800ad7:	56                   	push   %esi
+  800ad8:	53                   	push   %ebx
+  800ad9:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800adc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ae1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ae4:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ae9:	89 cb                	mov    %ecx,%ebx
+  800aeb:	89 cf                	mov    %ecx,%edi
+  800aed:	89 ce                	mov    %ecx,%esi
+  800aef:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800af1:	85 c0                	test   %eax,%eax
+  800af3:	7f 08                	jg     800afd <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800af5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800af8:	5b                   	pop    %ebx
+  800af9:	5e                   	pop    %esi
+  800afa:	5f                   	pop    %edi
+  800afb:	5d                   	pop    %ebp
+  800afc:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800afd:	83 ec 0c             	sub    $0xc,%esp
+  800b00:	50                   	push   %eax
+  800b01:	6a 03                	push   $0x3
+  800b03:	68 c3 2c 80 00       	push   $0x802cc3
+  800b08:	6a 3e                	push   $0x3e
+  800b0a:	68 e0 2c 80 00       	push   $0x802ce0
+  800b0f:	e8 39 17 00 00       	call   80224d <_panic>
+
+00800b14 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800b14:	55                   	push   %ebp
+  800b15:	89 e5                	mov    %esp,%ebp
+  800b17:	57                   	push   %edi
+  800b18:	56                   	push   %esi
+  800b19:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800b1a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b1f:	b8 02 00 00 00       	mov    $0x2,%eax
+  800b24:	89 d1                	mov    %edx,%ecx
+  800b26:	89 d3                	mov    %edx,%ebx
+  800b28:	89 d7                	mov    %edx,%edi
+  800b2a:	89 d6                	mov    %edx,%esi
+  800b2c:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800b2e:	5b                   	pop    %ebx
+  800b2f:	5e                   	pop    %esi
+  800b30:	5f                   	pop    %edi
+  800b31:	5d                   	pop    %ebp
+  800b32:	c3                   	ret
+
+00800b33 <sys_yield>:
+
+void
+sys_yield(void) {
+  800b33:	55                   	push   %ebp
+  800b34:	89 e5                	mov    %esp,%ebp
+  800b36:	57                   	push   %edi
+  800b37:	56                   	push   %esi
+  800b38:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800b39:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b3e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800b43:	89 d1                	mov    %edx,%ecx
+  800b45:	89 d3                	mov    %edx,%ebx
+  800b47:	89 d7                	mov    %edx,%edi
+  800b49:	89 d6                	mov    %edx,%esi
+  800b4b:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800b4d:	5b                   	pop    %ebx
+  800b4e:	5e                   	pop    %esi
+  800b4f:	5f                   	pop    %edi
+  800b50:	5d                   	pop    %ebp
+  800b51:	c3                   	ret
+
+00800b52 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  800b52:	55                   	push   %ebp
+  800b53:	89 e5                	mov    %esp,%ebp
+  800b55:	57                   	push   %edi
+  800b56:	56                   	push   %esi
+  800b57:	53                   	push   %ebx
+  800b58:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800b5b:	be 00 00 00 00       	mov    $0x0,%esi
+  800b60:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b63:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b66:	b8 04 00 00 00       	mov    $0x4,%eax
+  800b6b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b6e:	89 f7                	mov    %esi,%edi
+  800b70:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800b72:	85 c0                	test   %eax,%eax
+  800b74:	7f 08                	jg     800b7e <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800b76:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b79:	5b                   	pop    %ebx
+  800b7a:	5e                   	pop    %esi
+  800b7b:	5f                   	pop    %edi
+  800b7c:	5d                   	pop    %ebp
+  800b7d:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800b7e:	83 ec 0c             	sub    $0xc,%esp
+  800b81:	50                   	push   %eax
+  800b82:	6a 04                	push   $0x4
+  800b84:	68 c3 2c 80 00       	push   $0x802cc3
+  800b89:	6a 3e                	push   $0x3e
+  800b8b:	68 e0 2c 80 00       	push   $0x802ce0
+  800b90:	e8 b8 16 00 00       	call   80224d <_panic>
+
+00800b95 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  800b95:	55                   	push   %ebp
+  800b96:	89 e5                	mov    %esp,%ebp
+  800b98:	57                   	push   %edi
+  800b99:	56                   	push   %esi
+  800b9a:	53                   	push   %ebx
+  800b9b:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800b9e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ba1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ba4:	b8 05 00 00 00       	mov    $0x5,%eax
+  800ba9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bac:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800baf:	8b 75 18             	mov    0x18(%ebp),%esi
+  800bb2:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800bb4:	85 c0                	test   %eax,%eax
+  800bb6:	7f 08                	jg     800bc0 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800bb8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bbb:	5b                   	pop    %ebx
+  800bbc:	5e                   	pop    %esi
+  800bbd:	5f                   	pop    %edi
+  800bbe:	5d                   	pop    %ebp
+  800bbf:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800bc0:	83 ec 0c             	sub    $0xc,%esp
+  800bc3:	50                   	push   %eax
+  800bc4:	6a 05                	push   $0x5
+  800bc6:	68 c3 2c 80 00       	push   $0x802cc3
+  800bcb:	6a 3e                	push   $0x3e
+  800bcd:	68 e0 2c 80 00       	push   $0x802ce0
+  800bd2:	e8 76 16 00 00       	call   80224d <_panic>
+
+00800bd7 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  800bd7:	55                   	push   %ebp
+  800bd8:	89 e5                	mov    %esp,%ebp
+  800bda:	57                   	push   %edi
+  800bdb:	56                   	push   %esi
+  800bdc:	53                   	push   %ebx
+  800bdd:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800be0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800be5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800be8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800beb:	b8 06 00 00 00       	mov    $0x6,%eax
+  800bf0:	89 df                	mov    %ebx,%edi
+  800bf2:	89 de                	mov    %ebx,%esi
+  800bf4:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800bf6:	85 c0                	test   %eax,%eax
+  800bf8:	7f 08                	jg     800c02 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800bfa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bfd:	5b                   	pop    %ebx
+  800bfe:	5e                   	pop    %esi
+  800bff:	5f                   	pop    %edi
+  800c00:	5d                   	pop    %ebp
+  800c01:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c02:	83 ec 0c             	sub    $0xc,%esp
+  800c05:	50                   	push   %eax
+  800c06:	6a 06                	push   $0x6
+  800c08:	68 c3 2c 80 00       	push   $0x802cc3
+  800c0d:	6a 3e                	push   $0x3e
+  800c0f:	68 e0 2c 80 00       	push   $0x802ce0
+  800c14:	e8 34 16 00 00       	call   80224d <_panic>
+
+00800c19 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800c19:	55                   	push   %ebp
+  800c1a:	89 e5                	mov    %esp,%ebp
+  800c1c:	57                   	push   %edi
+  800c1d:	56                   	push   %esi
+  800c1e:	53                   	push   %ebx
+  800c1f:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c22:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c27:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c2a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c2d:	b8 08 00 00 00       	mov    $0x8,%eax
+  800c32:	89 df                	mov    %ebx,%edi
+  800c34:	89 de                	mov    %ebx,%esi
+  800c36:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c38:	85 c0                	test   %eax,%eax
+  800c3a:	7f 08                	jg     800c44 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800c3c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c3f:	5b                   	pop    %ebx
+  800c40:	5e                   	pop    %esi
+  800c41:	5f                   	pop    %edi
+  800c42:	5d                   	pop    %ebp
+  800c43:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c44:	83 ec 0c             	sub    $0xc,%esp
+  800c47:	50                   	push   %eax
+  800c48:	6a 08                	push   $0x8
+  800c4a:	68 c3 2c 80 00       	push   $0x802cc3
+  800c4f:	6a 3e                	push   $0x3e
+  800c51:	68 e0 2c 80 00       	push   $0x802ce0
+  800c56:	e8 f2 15 00 00       	call   80224d <_panic>
+
+00800c5b <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800c5b:	55                   	push   %ebp
+  800c5c:	89 e5                	mov    %esp,%ebp
+  800c5e:	57                   	push   %edi
+  800c5f:	56                   	push   %esi
+  800c60:	53                   	push   %ebx
+  800c61:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c64:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c69:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c6c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c6f:	b8 09 00 00 00       	mov    $0x9,%eax
+  800c74:	89 df                	mov    %ebx,%edi
+  800c76:	89 de                	mov    %ebx,%esi
+  800c78:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c7a:	85 c0                	test   %eax,%eax
+  800c7c:	7f 08                	jg     800c86 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800c7e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c81:	5b                   	pop    %ebx
+  800c82:	5e                   	pop    %esi
+  800c83:	5f                   	pop    %edi
+  800c84:	5d                   	pop    %ebp
+  800c85:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c86:	83 ec 0c             	sub    $0xc,%esp
+  800c89:	50                   	push   %eax
+  800c8a:	6a 09                	push   $0x9
+  800c8c:	68 c3 2c 80 00       	push   $0x802cc3
+  800c91:	6a 3e                	push   $0x3e
+  800c93:	68 e0 2c 80 00       	push   $0x802ce0
+  800c98:	e8 b0 15 00 00       	call   80224d <_panic>
+
+00800c9d <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800c9d:	55                   	push   %ebp
+  800c9e:	89 e5                	mov    %esp,%ebp
+  800ca0:	57                   	push   %edi
+  800ca1:	56                   	push   %esi
+  800ca2:	53                   	push   %ebx
+  800ca3:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800ca6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cab:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cb1:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800cb6:	89 df                	mov    %ebx,%edi
+  800cb8:	89 de                	mov    %ebx,%esi
+  800cba:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800cbc:	85 c0                	test   %eax,%eax
+  800cbe:	7f 08                	jg     800cc8 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800cc0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cc3:	5b                   	pop    %ebx
+  800cc4:	5e                   	pop    %esi
+  800cc5:	5f                   	pop    %edi
+  800cc6:	5d                   	pop    %ebp
+  800cc7:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800cc8:	83 ec 0c             	sub    $0xc,%esp
+  800ccb:	50                   	push   %eax
+  800ccc:	6a 0a                	push   $0xa
+  800cce:	68 c3 2c 80 00       	push   $0x802cc3
+  800cd3:	6a 3e                	push   $0x3e
+  800cd5:	68 e0 2c 80 00       	push   $0x802ce0
+  800cda:	e8 6e 15 00 00       	call   80224d <_panic>
+
+00800cdf <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  800cdf:	55                   	push   %ebp
+  800ce0:	89 e5                	mov    %esp,%ebp
+  800ce2:	57                   	push   %edi
+  800ce3:	56                   	push   %esi
+  800ce4:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800ce5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ce8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ceb:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800cf0:	be 00 00 00 00       	mov    $0x0,%esi
+  800cf5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cf8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800cfb:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800cfd:	5b                   	pop    %ebx
+  800cfe:	5e                   	pop    %esi
+  800cff:	5f                   	pop    %edi
+  800d00:	5d                   	pop    %ebp
+  800d01:	c3                   	ret
+
+00800d02 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  800d02:	55                   	push   %ebp
+  800d03:	89 e5                	mov    %esp,%ebp
+  800d05:	57                   	push   %edi
+  800d06:	56                   	push   %esi
+  800d07:	53                   	push   %ebx
+  800d08:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800d0b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d10:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d13:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800d18:	89 cb                	mov    %ecx,%ebx
+  800d1a:	89 cf                	mov    %ecx,%edi
+  800d1c:	89 ce                	mov    %ecx,%esi
+  800d1e:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d20:	85 c0                	test   %eax,%eax
+  800d22:	7f 08                	jg     800d2c <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  800d24:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d27:	5b                   	pop    %ebx
+  800d28:	5e                   	pop    %esi
+  800d29:	5f                   	pop    %edi
+  800d2a:	5d                   	pop    %ebp
+  800d2b:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d2c:	83 ec 0c             	sub    $0xc,%esp
+  800d2f:	50                   	push   %eax
+  800d30:	6a 0d                	push   $0xd
+  800d32:	68 c3 2c 80 00       	push   $0x802cc3
+  800d37:	6a 3e                	push   $0x3e
+  800d39:	68 e0 2c 80 00       	push   $0x802ce0
+  800d3e:	e8 0a 15 00 00       	call   80224d <_panic>
+
+00800d43 <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  800d43:	55                   	push   %ebp
+  800d44:	89 e5                	mov    %esp,%ebp
+  800d46:	57                   	push   %edi
+  800d47:	56                   	push   %esi
+  800d48:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d49:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d4e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d51:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d54:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800d59:	89 df                	mov    %ebx,%edi
+  800d5b:	89 de                	mov    %ebx,%esi
+  800d5d:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  800d5f:	5b                   	pop    %ebx
+  800d60:	5e                   	pop    %esi
+  800d61:	5f                   	pop    %edi
+  800d62:	5d                   	pop    %ebp
+  800d63:	c3                   	ret
+
+00800d64 <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  800d64:	55                   	push   %ebp
+  800d65:	89 e5                	mov    %esp,%ebp
+  800d67:	57                   	push   %edi
+  800d68:	56                   	push   %esi
+  800d69:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d6a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d6f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d72:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800d77:	89 cb                	mov    %ecx,%ebx
+  800d79:	89 cf                	mov    %ecx,%edi
+  800d7b:	89 ce                	mov    %ecx,%esi
+  800d7d:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  800d7f:	5b                   	pop    %ebx
+  800d80:	5e                   	pop    %esi
+  800d81:	5f                   	pop    %edi
+  800d82:	5d                   	pop    %ebp
+  800d83:	c3                   	ret
+
+00800d84 <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  800d84:	55                   	push   %ebp
+  800d85:	89 e5                	mov    %esp,%ebp
+  800d87:	57                   	push   %edi
+  800d88:	56                   	push   %esi
+  800d89:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d8a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d8f:	b8 10 00 00 00       	mov    $0x10,%eax
+  800d94:	89 d1                	mov    %edx,%ecx
+  800d96:	89 d3                	mov    %edx,%ebx
+  800d98:	89 d7                	mov    %edx,%edi
+  800d9a:	89 d6                	mov    %edx,%esi
+  800d9c:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800d9e:	5b                   	pop    %ebx
+  800d9f:	5e                   	pop    %esi
+  800da0:	5f                   	pop    %edi
+  800da1:	5d                   	pop    %ebp
+  800da2:	c3                   	ret
+
+00800da3 <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  800da3:	55                   	push   %ebp
+  800da4:	89 e5                	mov    %esp,%ebp
+  800da6:	57                   	push   %edi
+  800da7:	56                   	push   %esi
+  800da8:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800da9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dae:	8b 55 08             	mov    0x8(%ebp),%edx
+  800db1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800db4:	b8 11 00 00 00       	mov    $0x11,%eax
+  800db9:	89 df                	mov    %ebx,%edi
+  800dbb:	89 de                	mov    %ebx,%esi
+  800dbd:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800dbf:	5b                   	pop    %ebx
+  800dc0:	5e                   	pop    %esi
+  800dc1:	5f                   	pop    %edi
+  800dc2:	5d                   	pop    %ebp
+  800dc3:	c3                   	ret
+
+00800dc4 <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  800dc4:	55                   	push   %ebp
+  800dc5:	89 e5                	mov    %esp,%ebp
+  800dc7:	57                   	push   %edi
+  800dc8:	56                   	push   %esi
+  800dc9:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800dca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dcf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dd5:	b8 12 00 00 00       	mov    $0x12,%eax
+  800dda:	89 df                	mov    %ebx,%edi
+  800ddc:	89 de                	mov    %ebx,%esi
+  800dde:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800de0:	5b                   	pop    %ebx
+  800de1:	5e                   	pop    %esi
+  800de2:	5f                   	pop    %edi
+  800de3:	5d                   	pop    %ebp
+  800de4:	c3                   	ret
+
+00800de5 <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  800de5:	55                   	push   %ebp
+  800de6:	89 e5                	mov    %esp,%ebp
+  800de8:	57                   	push   %edi
+  800de9:	56                   	push   %esi
+  800dea:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800deb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800df0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df3:	b8 13 00 00 00       	mov    $0x13,%eax
+  800df8:	89 cb                	mov    %ecx,%ebx
+  800dfa:	89 cf                	mov    %ecx,%edi
+  800dfc:	89 ce                	mov    %ecx,%esi
+  800dfe:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  800e00:	5b                   	pop    %ebx
+  800e01:	5e                   	pop    %esi
+  800e02:	5f                   	pop    %edi
+  800e03:	5d                   	pop    %ebp
+  800e04:	c3                   	ret
+
+00800e05 <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  800e05:	55                   	push   %ebp
+  800e06:	89 e5                	mov    %esp,%ebp
+  800e08:	57                   	push   %edi
+  800e09:	56                   	push   %esi
+  800e0a:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e0b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e10:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e13:	b8 14 00 00 00       	mov    $0x14,%eax
+  800e18:	89 cb                	mov    %ecx,%ebx
+  800e1a:	89 cf                	mov    %ecx,%edi
+  800e1c:	89 ce                	mov    %ecx,%esi
+  800e1e:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  800e20:	5b                   	pop    %ebx
+  800e21:	5e                   	pop    %esi
+  800e22:	5f                   	pop    %edi
+  800e23:	5d                   	pop    %ebp
+  800e24:	c3                   	ret
+
+00800e25 <pgfault>:
+//
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf) {
+  800e25:	55                   	push   %ebp
+  800e26:	89 e5                	mov    %esp,%ebp
+  800e28:	53                   	push   %ebx
+  800e29:	83 ec 04             	sub    $0x4,%esp
+  800e2c:	8b 45 08             	mov    0x8(%ebp),%eax
+    void *addr = (void *) utf->utf_fault_va;
+  800e2f:	8b 18                	mov    (%eax),%ebx
+    // Hint:
+    //   Use the read-only page table mappings at uvpt
+    //   (see <inc/memlayout.h>).
+
+    // LAB 4: Your code here.
+    if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P) ||
+  800e31:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  800e35:	0f 84 95 00 00 00    	je     800ed0 <pgfault+0xab>
+  800e3b:	89 d8                	mov    %ebx,%eax
+  800e3d:	c1 e8 16             	shr    $0x16,%eax
+  800e40:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  800e47:	a8 01                	test   $0x1,%al
+  800e49:	0f 84 81 00 00 00    	je     800ed0 <pgfault+0xab>
+        (uvpt[PGNUM(addr)] & (PTE_P | PTE_COW)) != (PTE_P | PTE_COW)) {
+  800e4f:	89 d8                	mov    %ebx,%eax
+  800e51:	c1 e8 0c             	shr    $0xc,%eax
+  800e54:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800e5b:	25 01 08 00 00       	and    $0x801,%eax
+    if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P) ||
+  800e60:	3d 01 08 00 00       	cmp    $0x801,%eax
+  800e65:	75 69                	jne    800ed0 <pgfault+0xab>
+    // Hint:
+    //   You should make three system calls.
+
+    // LAB 4: Your code here.
+
+    if (sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W))
+  800e67:	83 ec 04             	sub    $0x4,%esp
+  800e6a:	6a 07                	push   $0x7
+  800e6c:	68 00 f0 7f 00       	push   $0x7ff000
+  800e71:	6a 00                	push   $0x0
+  800e73:	e8 da fc ff ff       	call   800b52 <sys_page_alloc>
+  800e78:	83 c4 10             	add    $0x10,%esp
+  800e7b:	85 c0                	test   %eax,%eax
+  800e7d:	75 65                	jne    800ee4 <pgfault+0xbf>
+        panic("sys_page_alloc failed");
+
+    addr = ROUNDDOWN(addr, PGSIZE);
+  800e7f:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+    memmove(PFTEMP, addr, PGSIZE);
+  800e85:	83 ec 04             	sub    $0x4,%esp
+  800e88:	68 00 10 00 00       	push   $0x1000
+  800e8d:	53                   	push   %ebx
+  800e8e:	68 00 f0 7f 00       	push   $0x7ff000
+  800e93:	e8 54 fa ff ff       	call   8008ec <memmove>
+
+    if (sys_page_map(0, PFTEMP, 0, addr, PTE_P | PTE_U | PTE_W))
+  800e98:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  800e9f:	53                   	push   %ebx
+  800ea0:	6a 00                	push   $0x0
+  800ea2:	68 00 f0 7f 00       	push   $0x7ff000
+  800ea7:	6a 00                	push   $0x0
+  800ea9:	e8 e7 fc ff ff       	call   800b95 <sys_page_map>
+  800eae:	83 c4 20             	add    $0x20,%esp
+  800eb1:	85 c0                	test   %eax,%eax
+  800eb3:	75 43                	jne    800ef8 <pgfault+0xd3>
+        panic("sys_page_map failed");
+    if (sys_page_unmap(0, PFTEMP))
+  800eb5:	83 ec 08             	sub    $0x8,%esp
+  800eb8:	68 00 f0 7f 00       	push   $0x7ff000
+  800ebd:	6a 00                	push   $0x0
+  800ebf:	e8 13 fd ff ff       	call   800bd7 <sys_page_unmap>
+  800ec4:	83 c4 10             	add    $0x10,%esp
+  800ec7:	85 c0                	test   %eax,%eax
+  800ec9:	75 41                	jne    800f0c <pgfault+0xe7>
+        panic("sys_page_unmap failed");
+
+}
+  800ecb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ece:	c9                   	leave
+  800ecf:	c3                   	ret
+        panic("pgfault: faulting access invalid");
+  800ed0:	83 ec 04             	sub    $0x4,%esp
+  800ed3:	68 f0 2c 80 00       	push   $0x802cf0
+  800ed8:	6a 1e                	push   $0x1e
+  800eda:	68 5c 2d 80 00       	push   $0x802d5c
+  800edf:	e8 69 13 00 00       	call   80224d <_panic>
+        panic("sys_page_alloc failed");
+  800ee4:	83 ec 04             	sub    $0x4,%esp
+  800ee7:	68 cf 2d 80 00       	push   $0x802dcf
+  800eec:	6a 2a                	push   $0x2a
+  800eee:	68 5c 2d 80 00       	push   $0x802d5c
+  800ef3:	e8 55 13 00 00       	call   80224d <_panic>
+        panic("sys_page_map failed");
+  800ef8:	83 ec 04             	sub    $0x4,%esp
+  800efb:	68 67 2d 80 00       	push   $0x802d67
+  800f00:	6a 30                	push   $0x30
+  800f02:	68 5c 2d 80 00       	push   $0x802d5c
+  800f07:	e8 41 13 00 00       	call   80224d <_panic>
+        panic("sys_page_unmap failed");
+  800f0c:	83 ec 04             	sub    $0x4,%esp
+  800f0f:	68 7b 2d 80 00       	push   $0x802d7b
+  800f14:	6a 32                	push   $0x32
+  800f16:	68 5c 2d 80 00       	push   $0x802d5c
+  800f1b:	e8 2d 13 00 00       	call   80224d <_panic>
+
+00800f20 <fork>:
+//   Remember to fix "thisenv" in the child process.
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void) {
+  800f20:	55                   	push   %ebp
+  800f21:	89 e5                	mov    %esp,%ebp
+  800f23:	57                   	push   %edi
+  800f24:	56                   	push   %esi
+  800f25:	53                   	push   %ebx
+  800f26:	83 ec 18             	sub    $0x18,%esp
+    // LAB 4: Your code here.
+    set_pgfault_handler(pgfault);
+  800f29:	68 25 0e 80 00       	push   $0x800e25
+  800f2e:	e8 60 13 00 00       	call   802293 <set_pgfault_handler>
+
+// This must be inlined.  Exercise for reader: why?
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+  envid_t ret;
+  asm volatile("int %2"
+  800f33:	b8 07 00 00 00       	mov    $0x7,%eax
+  800f38:	cd 30                	int    $0x30
+  800f3a:	89 c6                	mov    %eax,%esi
+
+    envid_t envid = sys_exofork();
+    if (envid < 0)
+  800f3c:	83 c4 10             	add    $0x10,%esp
+  800f3f:	85 c0                	test   %eax,%eax
+  800f41:	78 2a                	js     800f6d <fork+0x4d>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+
+    uintptr_t addr;
+    for (addr = 0; addr < UTOP; addr += PGSIZE) {
+  800f43:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (envid == 0) {
+  800f48:	0f 85 a2 00 00 00    	jne    800ff0 <fork+0xd0>
+        thisenv = &envs[ENVX(sys_getenvid())];
+  800f4e:	e8 c1 fb ff ff       	call   800b14 <sys_getenvid>
+  800f53:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800f58:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800f5b:	c1 e0 04             	shl    $0x4,%eax
+  800f5e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800f63:	a3 08 40 80 00       	mov    %eax,0x804008
+        return 0;
+  800f68:	e9 6c 01 00 00       	jmp    8010d9 <fork+0x1b9>
+        panic("fork: sys_exofork error: %e", envid);
+  800f6d:	50                   	push   %eax
+  800f6e:	68 91 2d 80 00       	push   $0x802d91
+  800f73:	6a 6f                	push   $0x6f
+  800f75:	68 5c 2d 80 00       	push   $0x802d5c
+  800f7a:	e8 ce 12 00 00       	call   80224d <_panic>
+        if ((r = sys_page_map(0, vptr, envid, vptr, uvpt[pn] & PTE_SYSCALL)) < 0)
+  800f7f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800f86:	83 ec 0c             	sub    $0xc,%esp
+  800f89:	25 07 0e 00 00       	and    $0xe07,%eax
+  800f8e:	50                   	push   %eax
+  800f8f:	57                   	push   %edi
+  800f90:	56                   	push   %esi
+  800f91:	57                   	push   %edi
+  800f92:	6a 00                	push   $0x0
+  800f94:	e8 fc fb ff ff       	call   800b95 <sys_page_map>
+  800f99:	83 c4 20             	add    $0x20,%esp
+  800f9c:	85 c0                	test   %eax,%eax
+  800f9e:	79 3e                	jns    800fde <fork+0xbe>
+            panic("duppage :in sys_page_map %e", r);
+  800fa0:	50                   	push   %eax
+  800fa1:	68 ad 2d 80 00       	push   $0x802dad
+  800fa6:	6a 49                	push   $0x49
+  800fa8:	68 5c 2d 80 00       	push   $0x802d5c
+  800fad:	e8 9b 12 00 00       	call   80224d <_panic>
+            panic("duppage :in sys_page_map %e", r);
+  800fb2:	50                   	push   %eax
+  800fb3:	68 ad 2d 80 00       	push   $0x802dad
+  800fb8:	6a 4e                	push   $0x4e
+  800fba:	68 5c 2d 80 00       	push   $0x802d5c
+  800fbf:	e8 89 12 00 00       	call   80224d <_panic>
+    } else if ((r = sys_page_map(0, vptr, envid, vptr, PTE_P | PTE_U)) < 0)
+  800fc4:	83 ec 0c             	sub    $0xc,%esp
+  800fc7:	6a 05                	push   $0x5
+  800fc9:	57                   	push   %edi
+  800fca:	56                   	push   %esi
+  800fcb:	57                   	push   %edi
+  800fcc:	6a 00                	push   $0x0
+  800fce:	e8 c2 fb ff ff       	call   800b95 <sys_page_map>
+  800fd3:	83 c4 20             	add    $0x20,%esp
+  800fd6:	85 c0                	test   %eax,%eax
+  800fd8:	0f 88 ab 00 00 00    	js     801089 <fork+0x169>
+    for (addr = 0; addr < UTOP; addr += PGSIZE) {
+  800fde:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  800fe4:	81 fb 00 00 c0 ee    	cmp    $0xeec00000,%ebx
+  800fea:	0f 84 ab 00 00 00    	je     80109b <fork+0x17b>
+        if (uvpd[PDX(addr)] & PTE_P && uvpt[PGNUM(addr)] & PTE_P && addr != UXSTACKTOP - PGSIZE) {
+  800ff0:	89 d8                	mov    %ebx,%eax
+  800ff2:	c1 e8 16             	shr    $0x16,%eax
+  800ff5:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  800ffc:	a8 01                	test   $0x1,%al
+  800ffe:	74 de                	je     800fde <fork+0xbe>
+  801000:	89 d8                	mov    %ebx,%eax
+  801002:	c1 e8 0c             	shr    $0xc,%eax
+  801005:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80100c:	f6 c2 01             	test   $0x1,%dl
+  80100f:	74 cd                	je     800fde <fork+0xbe>
+  801011:	81 fb 00 f0 bf ee    	cmp    $0xeebff000,%ebx
+  801017:	74 c5                	je     800fde <fork+0xbe>
+    void *vptr = (void *) (pn * PGSIZE);
+  801019:	89 c7                	mov    %eax,%edi
+  80101b:	c1 e7 0c             	shl    $0xc,%edi
+    if (uvpt[pn] & PTE_SHARE) {
+  80101e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801025:	f6 c6 04             	test   $0x4,%dh
+  801028:	0f 85 51 ff ff ff    	jne    800f7f <fork+0x5f>
+    } else if (uvpt[pn] & (PTE_W | PTE_COW)) {
+  80102e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801035:	a9 02 08 00 00       	test   $0x802,%eax
+  80103a:	74 88                	je     800fc4 <fork+0xa4>
+        if ((r = sys_page_map(0, vptr, envid, vptr, PTE_P | PTE_U | PTE_COW)) < 0)
+  80103c:	83 ec 0c             	sub    $0xc,%esp
+  80103f:	68 05 08 00 00       	push   $0x805
+  801044:	57                   	push   %edi
+  801045:	56                   	push   %esi
+  801046:	57                   	push   %edi
+  801047:	6a 00                	push   $0x0
+  801049:	e8 47 fb ff ff       	call   800b95 <sys_page_map>
+  80104e:	83 c4 20             	add    $0x20,%esp
+  801051:	85 c0                	test   %eax,%eax
+  801053:	0f 88 59 ff ff ff    	js     800fb2 <fork+0x92>
+        if ((r = sys_page_map(0, vptr, 0, vptr, PTE_P | PTE_U | PTE_COW)) < 0)
+  801059:	83 ec 0c             	sub    $0xc,%esp
+  80105c:	68 05 08 00 00       	push   $0x805
+  801061:	57                   	push   %edi
+  801062:	6a 00                	push   $0x0
+  801064:	57                   	push   %edi
+  801065:	6a 00                	push   $0x0
+  801067:	e8 29 fb ff ff       	call   800b95 <sys_page_map>
+  80106c:	83 c4 20             	add    $0x20,%esp
+  80106f:	85 c0                	test   %eax,%eax
+  801071:	0f 89 67 ff ff ff    	jns    800fde <fork+0xbe>
+            panic("duppage :in sys_page_map %e", r);
+  801077:	50                   	push   %eax
+  801078:	68 ad 2d 80 00       	push   $0x802dad
+  80107d:	6a 50                	push   $0x50
+  80107f:	68 5c 2d 80 00       	push   $0x802d5c
+  801084:	e8 c4 11 00 00       	call   80224d <_panic>
+        panic("duppage :in sys_page_map %e", r);
+  801089:	50                   	push   %eax
+  80108a:	68 ad 2d 80 00       	push   $0x802dad
+  80108f:	6a 53                	push   $0x53
+  801091:	68 5c 2d 80 00       	push   $0x802d5c
+  801096:	e8 b2 11 00 00       	call   80224d <_panic>
+            duppage(envid, PGNUM(addr));
+        }
+    }
+    if (sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W))
+  80109b:	83 ec 04             	sub    $0x4,%esp
+  80109e:	6a 07                	push   $0x7
+  8010a0:	68 00 f0 bf ee       	push   $0xeebff000
+  8010a5:	56                   	push   %esi
+  8010a6:	e8 a7 fa ff ff       	call   800b52 <sys_page_alloc>
+  8010ab:	83 c4 10             	add    $0x10,%esp
+  8010ae:	85 c0                	test   %eax,%eax
+  8010b0:	75 31                	jne    8010e3 <fork+0x1c3>
+        panic("fork: sys_page_alloc failed");
+    if (sys_env_set_pgfault_upcall(envid, _pgfault_upcall))
+  8010b2:	83 ec 08             	sub    $0x8,%esp
+  8010b5:	68 fe 22 80 00       	push   $0x8022fe
+  8010ba:	56                   	push   %esi
+  8010bb:	e8 dd fb ff ff       	call   800c9d <sys_env_set_pgfault_upcall>
+  8010c0:	83 c4 10             	add    $0x10,%esp
+  8010c3:	85 c0                	test   %eax,%eax
+  8010c5:	75 30                	jne    8010f7 <fork+0x1d7>
+        panic("fork: sys_env_set_pgfault_upcall failed");
+    if (sys_env_set_status(envid, ENV_RUNNABLE))
+  8010c7:	83 ec 08             	sub    $0x8,%esp
+  8010ca:	6a 02                	push   $0x2
+  8010cc:	56                   	push   %esi
+  8010cd:	e8 47 fb ff ff       	call   800c19 <sys_env_set_status>
+  8010d2:	83 c4 10             	add    $0x10,%esp
+  8010d5:	85 c0                	test   %eax,%eax
+  8010d7:	75 32                	jne    80110b <fork+0x1eb>
+        panic("fork: sys_env_set_status failed");
+
+    return envid;
+
+}
+  8010d9:	89 f0                	mov    %esi,%eax
+  8010db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010de:	5b                   	pop    %ebx
+  8010df:	5e                   	pop    %esi
+  8010e0:	5f                   	pop    %edi
+  8010e1:	5d                   	pop    %ebp
+  8010e2:	c3                   	ret
+        panic("fork: sys_page_alloc failed");
+  8010e3:	83 ec 04             	sub    $0x4,%esp
+  8010e6:	68 c9 2d 80 00       	push   $0x802dc9
+  8010eb:	6a 7d                	push   $0x7d
+  8010ed:	68 5c 2d 80 00       	push   $0x802d5c
+  8010f2:	e8 56 11 00 00       	call   80224d <_panic>
+        panic("fork: sys_env_set_pgfault_upcall failed");
+  8010f7:	83 ec 04             	sub    $0x4,%esp
+  8010fa:	68 14 2d 80 00       	push   $0x802d14
+  8010ff:	6a 7f                	push   $0x7f
+  801101:	68 5c 2d 80 00       	push   $0x802d5c
+  801106:	e8 42 11 00 00       	call   80224d <_panic>
+        panic("fork: sys_env_set_status failed");
+  80110b:	83 ec 04             	sub    $0x4,%esp
+  80110e:	68 3c 2d 80 00       	push   $0x802d3c
+  801113:	68 81 00 00 00       	push   $0x81
+  801118:	68 5c 2d 80 00       	push   $0x802d5c
+  80111d:	e8 2b 11 00 00       	call   80224d <_panic>
+
+00801122 <sfork>:
+
+// Challenge!
+int
+sfork(void) {
+  801122:	55                   	push   %ebp
+  801123:	89 e5                	mov    %esp,%ebp
+  801125:	83 ec 0c             	sub    $0xc,%esp
+    panic("sfork not implemented");
+  801128:	68 e5 2d 80 00       	push   $0x802de5
+  80112d:	68 8a 00 00 00       	push   $0x8a
+  801132:	68 5c 2d 80 00       	push   $0x802d5c
+  801137:	e8 11 11 00 00       	call   80224d <_panic>
+
+0080113c <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80113c:	55                   	push   %ebp
+  80113d:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80113f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801142:	05 00 00 00 30       	add    $0x30000000,%eax
+  801147:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80114a:	5d                   	pop    %ebp
+  80114b:	c3                   	ret
+
+0080114c <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80114c:	55                   	push   %ebp
+  80114d:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80114f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801152:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801157:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80115c:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801161:	5d                   	pop    %ebp
+  801162:	c3                   	ret
+
+00801163 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801163:	55                   	push   %ebp
+  801164:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801166:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80116b:	eb 02                	jmp    80116f <fd_alloc+0xc>
+  80116d:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80116f:	89 c2                	mov    %eax,%edx
+  801171:	c1 ea 16             	shr    $0x16,%edx
+  801174:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80117b:	f6 c2 01             	test   $0x1,%dl
+  80117e:	74 2b                	je     8011ab <fd_alloc+0x48>
+  801180:	89 c2                	mov    %eax,%edx
+  801182:	c1 ea 0c             	shr    $0xc,%edx
+  801185:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80118c:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801192:	f6 c1 01             	test   $0x1,%cl
+  801195:	74 14                	je     8011ab <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801197:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80119d:	75 ce                	jne    80116d <fd_alloc+0xa>
+  80119f:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8011a4:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8011a9:	eb 05                	jmp    8011b0 <fd_alloc+0x4d>
+			return 0;
+  8011ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8011b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011b3:	89 02                	mov    %eax,(%edx)
+}
+  8011b5:	89 c8                	mov    %ecx,%eax
+  8011b7:	5d                   	pop    %ebp
+  8011b8:	c3                   	ret
+
+008011b9 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8011b9:	55                   	push   %ebp
+  8011ba:	89 e5                	mov    %esp,%ebp
+  8011bc:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8011bf:	83 f8 1f             	cmp    $0x1f,%eax
+  8011c2:	77 30                	ja     8011f4 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8011c4:	c1 e0 0c             	shl    $0xc,%eax
+  8011c7:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8011cc:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8011d2:	f6 c2 01             	test   $0x1,%dl
+  8011d5:	74 24                	je     8011fb <fd_lookup+0x42>
+  8011d7:	89 c2                	mov    %eax,%edx
+  8011d9:	c1 ea 0c             	shr    $0xc,%edx
+  8011dc:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8011e3:	f6 c2 01             	test   $0x1,%dl
+  8011e6:	74 1a                	je     801202 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8011e8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8011eb:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8011ed:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011f2:	5d                   	pop    %ebp
+  8011f3:	c3                   	ret
+		return -E_INVAL;
+  8011f4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011f9:	eb f7                	jmp    8011f2 <fd_lookup+0x39>
+		return -E_INVAL;
+  8011fb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801200:	eb f0                	jmp    8011f2 <fd_lookup+0x39>
+  801202:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801207:	eb e9                	jmp    8011f2 <fd_lookup+0x39>
+
+00801209 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801209:	55                   	push   %ebp
+  80120a:	89 e5                	mov    %esp,%ebp
+  80120c:	53                   	push   %ebx
+  80120d:	83 ec 04             	sub    $0x4,%esp
+  801210:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801213:	b8 00 00 00 00       	mov    $0x0,%eax
+  801218:	eb 03                	jmp    80121d <dev_lookup+0x14>
+  80121a:	83 c0 01             	add    $0x1,%eax
+  80121d:	8b 1c 85 78 2e 80 00 	mov    0x802e78(,%eax,4),%ebx
+  801224:	85 db                	test   %ebx,%ebx
+  801226:	74 0b                	je     801233 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801228:	39 13                	cmp    %edx,(%ebx)
+  80122a:	75 ee                	jne    80121a <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  80122c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801231:	eb 1f                	jmp    801252 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801233:	a1 08 40 80 00       	mov    0x804008,%eax
+  801238:	8b 40 48             	mov    0x48(%eax),%eax
+  80123b:	83 ec 04             	sub    $0x4,%esp
+  80123e:	52                   	push   %edx
+  80123f:	50                   	push   %eax
+  801240:	68 fc 2d 80 00       	push   $0x802dfc
+  801245:	e8 63 ef ff ff       	call   8001ad <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80124a:	83 c4 10             	add    $0x10,%esp
+  80124d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801252:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801255:	89 1a                	mov    %ebx,(%edx)
+}
+  801257:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80125a:	c9                   	leave
+  80125b:	c3                   	ret
+
+0080125c <fd_close>:
+{
+  80125c:	55                   	push   %ebp
+  80125d:	89 e5                	mov    %esp,%ebp
+  80125f:	57                   	push   %edi
+  801260:	56                   	push   %esi
+  801261:	53                   	push   %ebx
+  801262:	83 ec 24             	sub    $0x24,%esp
+  801265:	8b 75 08             	mov    0x8(%ebp),%esi
+  801268:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80126b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80126e:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80126f:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801275:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801278:	50                   	push   %eax
+  801279:	e8 3b ff ff ff       	call   8011b9 <fd_lookup>
+  80127e:	89 c3                	mov    %eax,%ebx
+  801280:	83 c4 10             	add    $0x10,%esp
+  801283:	85 c0                	test   %eax,%eax
+  801285:	78 05                	js     80128c <fd_close+0x30>
+	    || fd != fd2)
+  801287:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80128a:	74 16                	je     8012a2 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80128c:	89 f8                	mov    %edi,%eax
+  80128e:	84 c0                	test   %al,%al
+  801290:	b8 00 00 00 00       	mov    $0x0,%eax
+  801295:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801298:	89 d8                	mov    %ebx,%eax
+  80129a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80129d:	5b                   	pop    %ebx
+  80129e:	5e                   	pop    %esi
+  80129f:	5f                   	pop    %edi
+  8012a0:	5d                   	pop    %ebp
+  8012a1:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8012a2:	83 ec 08             	sub    $0x8,%esp
+  8012a5:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8012a8:	50                   	push   %eax
+  8012a9:	ff 36                	push   (%esi)
+  8012ab:	e8 59 ff ff ff       	call   801209 <dev_lookup>
+  8012b0:	89 c3                	mov    %eax,%ebx
+  8012b2:	83 c4 10             	add    $0x10,%esp
+  8012b5:	85 c0                	test   %eax,%eax
+  8012b7:	78 1a                	js     8012d3 <fd_close+0x77>
+		if (dev->dev_close)
+  8012b9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8012bc:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8012bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8012c4:	85 c0                	test   %eax,%eax
+  8012c6:	74 0b                	je     8012d3 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8012c8:	83 ec 0c             	sub    $0xc,%esp
+  8012cb:	56                   	push   %esi
+  8012cc:	ff d0                	call   *%eax
+  8012ce:	89 c3                	mov    %eax,%ebx
+  8012d0:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8012d3:	83 ec 08             	sub    $0x8,%esp
+  8012d6:	56                   	push   %esi
+  8012d7:	6a 00                	push   $0x0
+  8012d9:	e8 f9 f8 ff ff       	call   800bd7 <sys_page_unmap>
+	return r;
+  8012de:	83 c4 10             	add    $0x10,%esp
+  8012e1:	eb b5                	jmp    801298 <fd_close+0x3c>
+
+008012e3 <close>:
+
+int
+close(int fdnum)
+{
+  8012e3:	55                   	push   %ebp
+  8012e4:	89 e5                	mov    %esp,%ebp
+  8012e6:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8012e9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8012ec:	50                   	push   %eax
+  8012ed:	ff 75 08             	push   0x8(%ebp)
+  8012f0:	e8 c4 fe ff ff       	call   8011b9 <fd_lookup>
+  8012f5:	83 c4 10             	add    $0x10,%esp
+  8012f8:	85 c0                	test   %eax,%eax
+  8012fa:	79 02                	jns    8012fe <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8012fc:	c9                   	leave
+  8012fd:	c3                   	ret
+		return fd_close(fd, 1);
+  8012fe:	83 ec 08             	sub    $0x8,%esp
+  801301:	6a 01                	push   $0x1
+  801303:	ff 75 f4             	push   -0xc(%ebp)
+  801306:	e8 51 ff ff ff       	call   80125c <fd_close>
+  80130b:	83 c4 10             	add    $0x10,%esp
+  80130e:	eb ec                	jmp    8012fc <close+0x19>
+
+00801310 <close_all>:
+
+void
+close_all(void)
+{
+  801310:	55                   	push   %ebp
+  801311:	89 e5                	mov    %esp,%ebp
+  801313:	53                   	push   %ebx
+  801314:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801317:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80131c:	83 ec 0c             	sub    $0xc,%esp
+  80131f:	53                   	push   %ebx
+  801320:	e8 be ff ff ff       	call   8012e3 <close>
+	for (i = 0; i < MAXFD; i++)
+  801325:	83 c3 01             	add    $0x1,%ebx
+  801328:	83 c4 10             	add    $0x10,%esp
+  80132b:	83 fb 20             	cmp    $0x20,%ebx
+  80132e:	75 ec                	jne    80131c <close_all+0xc>
+}
+  801330:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801333:	c9                   	leave
+  801334:	c3                   	ret
+
+00801335 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801335:	55                   	push   %ebp
+  801336:	89 e5                	mov    %esp,%ebp
+  801338:	57                   	push   %edi
+  801339:	56                   	push   %esi
+  80133a:	53                   	push   %ebx
+  80133b:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80133e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801341:	50                   	push   %eax
+  801342:	ff 75 08             	push   0x8(%ebp)
+  801345:	e8 6f fe ff ff       	call   8011b9 <fd_lookup>
+  80134a:	89 c3                	mov    %eax,%ebx
+  80134c:	83 c4 10             	add    $0x10,%esp
+  80134f:	85 c0                	test   %eax,%eax
+  801351:	78 7f                	js     8013d2 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801353:	83 ec 0c             	sub    $0xc,%esp
+  801356:	ff 75 0c             	push   0xc(%ebp)
+  801359:	e8 85 ff ff ff       	call   8012e3 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80135e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801361:	c1 e6 0c             	shl    $0xc,%esi
+  801364:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80136a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80136d:	89 3c 24             	mov    %edi,(%esp)
+  801370:	e8 d7 fd ff ff       	call   80114c <fd2data>
+  801375:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801377:	89 34 24             	mov    %esi,(%esp)
+  80137a:	e8 cd fd ff ff       	call   80114c <fd2data>
+  80137f:	83 c4 10             	add    $0x10,%esp
+  801382:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801385:	89 d8                	mov    %ebx,%eax
+  801387:	c1 e8 16             	shr    $0x16,%eax
+  80138a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801391:	a8 01                	test   $0x1,%al
+  801393:	74 11                	je     8013a6 <dup+0x71>
+  801395:	89 d8                	mov    %ebx,%eax
+  801397:	c1 e8 0c             	shr    $0xc,%eax
+  80139a:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8013a1:	f6 c2 01             	test   $0x1,%dl
+  8013a4:	75 36                	jne    8013dc <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8013a6:	89 f8                	mov    %edi,%eax
+  8013a8:	c1 e8 0c             	shr    $0xc,%eax
+  8013ab:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8013b2:	83 ec 0c             	sub    $0xc,%esp
+  8013b5:	25 07 0e 00 00       	and    $0xe07,%eax
+  8013ba:	50                   	push   %eax
+  8013bb:	56                   	push   %esi
+  8013bc:	6a 00                	push   $0x0
+  8013be:	57                   	push   %edi
+  8013bf:	6a 00                	push   $0x0
+  8013c1:	e8 cf f7 ff ff       	call   800b95 <sys_page_map>
+  8013c6:	89 c3                	mov    %eax,%ebx
+  8013c8:	83 c4 20             	add    $0x20,%esp
+  8013cb:	85 c0                	test   %eax,%eax
+  8013cd:	78 33                	js     801402 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8013cf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8013d2:	89 d8                	mov    %ebx,%eax
+  8013d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013d7:	5b                   	pop    %ebx
+  8013d8:	5e                   	pop    %esi
+  8013d9:	5f                   	pop    %edi
+  8013da:	5d                   	pop    %ebp
+  8013db:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8013dc:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8013e3:	83 ec 0c             	sub    $0xc,%esp
+  8013e6:	25 07 0e 00 00       	and    $0xe07,%eax
+  8013eb:	50                   	push   %eax
+  8013ec:	ff 75 d4             	push   -0x2c(%ebp)
+  8013ef:	6a 00                	push   $0x0
+  8013f1:	53                   	push   %ebx
+  8013f2:	6a 00                	push   $0x0
+  8013f4:	e8 9c f7 ff ff       	call   800b95 <sys_page_map>
+  8013f9:	89 c3                	mov    %eax,%ebx
+  8013fb:	83 c4 20             	add    $0x20,%esp
+  8013fe:	85 c0                	test   %eax,%eax
+  801400:	79 a4                	jns    8013a6 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801402:	83 ec 08             	sub    $0x8,%esp
+  801405:	56                   	push   %esi
+  801406:	6a 00                	push   $0x0
+  801408:	e8 ca f7 ff ff       	call   800bd7 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  80140d:	83 c4 08             	add    $0x8,%esp
+  801410:	ff 75 d4             	push   -0x2c(%ebp)
+  801413:	6a 00                	push   $0x0
+  801415:	e8 bd f7 ff ff       	call   800bd7 <sys_page_unmap>
+	return r;
+  80141a:	83 c4 10             	add    $0x10,%esp
+  80141d:	eb b3                	jmp    8013d2 <dup+0x9d>
+
+0080141f <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80141f:	55                   	push   %ebp
+  801420:	89 e5                	mov    %esp,%ebp
+  801422:	56                   	push   %esi
+  801423:	53                   	push   %ebx
+  801424:	83 ec 18             	sub    $0x18,%esp
+  801427:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80142a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80142d:	50                   	push   %eax
+  80142e:	56                   	push   %esi
+  80142f:	e8 85 fd ff ff       	call   8011b9 <fd_lookup>
+  801434:	83 c4 10             	add    $0x10,%esp
+  801437:	85 c0                	test   %eax,%eax
+  801439:	78 3c                	js     801477 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80143b:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80143e:	83 ec 08             	sub    $0x8,%esp
+  801441:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801444:	50                   	push   %eax
+  801445:	ff 33                	push   (%ebx)
+  801447:	e8 bd fd ff ff       	call   801209 <dev_lookup>
+  80144c:	83 c4 10             	add    $0x10,%esp
+  80144f:	85 c0                	test   %eax,%eax
+  801451:	78 24                	js     801477 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801453:	8b 43 08             	mov    0x8(%ebx),%eax
+  801456:	83 e0 03             	and    $0x3,%eax
+  801459:	83 f8 01             	cmp    $0x1,%eax
+  80145c:	74 20                	je     80147e <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80145e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801461:	8b 40 08             	mov    0x8(%eax),%eax
+  801464:	85 c0                	test   %eax,%eax
+  801466:	74 37                	je     80149f <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801468:	83 ec 04             	sub    $0x4,%esp
+  80146b:	ff 75 10             	push   0x10(%ebp)
+  80146e:	ff 75 0c             	push   0xc(%ebp)
+  801471:	53                   	push   %ebx
+  801472:	ff d0                	call   *%eax
+  801474:	83 c4 10             	add    $0x10,%esp
+}
+  801477:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80147a:	5b                   	pop    %ebx
+  80147b:	5e                   	pop    %esi
+  80147c:	5d                   	pop    %ebp
+  80147d:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80147e:	a1 08 40 80 00       	mov    0x804008,%eax
+  801483:	8b 40 48             	mov    0x48(%eax),%eax
+  801486:	83 ec 04             	sub    $0x4,%esp
+  801489:	56                   	push   %esi
+  80148a:	50                   	push   %eax
+  80148b:	68 3d 2e 80 00       	push   $0x802e3d
+  801490:	e8 18 ed ff ff       	call   8001ad <cprintf>
+		return -E_INVAL;
+  801495:	83 c4 10             	add    $0x10,%esp
+  801498:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80149d:	eb d8                	jmp    801477 <read+0x58>
+		return -E_NOT_SUPP;
+  80149f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8014a4:	eb d1                	jmp    801477 <read+0x58>
+
+008014a6 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8014a6:	55                   	push   %ebp
+  8014a7:	89 e5                	mov    %esp,%ebp
+  8014a9:	57                   	push   %edi
+  8014aa:	56                   	push   %esi
+  8014ab:	53                   	push   %ebx
+  8014ac:	83 ec 0c             	sub    $0xc,%esp
+  8014af:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8014b2:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8014b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014ba:	eb 02                	jmp    8014be <readn+0x18>
+  8014bc:	01 c3                	add    %eax,%ebx
+  8014be:	39 f3                	cmp    %esi,%ebx
+  8014c0:	73 21                	jae    8014e3 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8014c2:	83 ec 04             	sub    $0x4,%esp
+  8014c5:	89 f0                	mov    %esi,%eax
+  8014c7:	29 d8                	sub    %ebx,%eax
+  8014c9:	50                   	push   %eax
+  8014ca:	89 d8                	mov    %ebx,%eax
+  8014cc:	03 45 0c             	add    0xc(%ebp),%eax
+  8014cf:	50                   	push   %eax
+  8014d0:	57                   	push   %edi
+  8014d1:	e8 49 ff ff ff       	call   80141f <read>
+		if (m < 0)
+  8014d6:	83 c4 10             	add    $0x10,%esp
+  8014d9:	85 c0                	test   %eax,%eax
+  8014db:	78 04                	js     8014e1 <readn+0x3b>
+			return m;
+		if (m == 0)
+  8014dd:	75 dd                	jne    8014bc <readn+0x16>
+  8014df:	eb 02                	jmp    8014e3 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8014e1:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8014e3:	89 d8                	mov    %ebx,%eax
+  8014e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014e8:	5b                   	pop    %ebx
+  8014e9:	5e                   	pop    %esi
+  8014ea:	5f                   	pop    %edi
+  8014eb:	5d                   	pop    %ebp
+  8014ec:	c3                   	ret
+
+008014ed <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8014ed:	55                   	push   %ebp
+  8014ee:	89 e5                	mov    %esp,%ebp
+  8014f0:	56                   	push   %esi
+  8014f1:	53                   	push   %ebx
+  8014f2:	83 ec 18             	sub    $0x18,%esp
+  8014f5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8014f8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8014fb:	50                   	push   %eax
+  8014fc:	53                   	push   %ebx
+  8014fd:	e8 b7 fc ff ff       	call   8011b9 <fd_lookup>
+  801502:	83 c4 10             	add    $0x10,%esp
+  801505:	85 c0                	test   %eax,%eax
+  801507:	78 37                	js     801540 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801509:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80150c:	83 ec 08             	sub    $0x8,%esp
+  80150f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801512:	50                   	push   %eax
+  801513:	ff 36                	push   (%esi)
+  801515:	e8 ef fc ff ff       	call   801209 <dev_lookup>
+  80151a:	83 c4 10             	add    $0x10,%esp
+  80151d:	85 c0                	test   %eax,%eax
+  80151f:	78 1f                	js     801540 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801521:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801525:	74 20                	je     801547 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801527:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80152a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80152d:	85 c0                	test   %eax,%eax
+  80152f:	74 37                	je     801568 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801531:	83 ec 04             	sub    $0x4,%esp
+  801534:	ff 75 10             	push   0x10(%ebp)
+  801537:	ff 75 0c             	push   0xc(%ebp)
+  80153a:	56                   	push   %esi
+  80153b:	ff d0                	call   *%eax
+  80153d:	83 c4 10             	add    $0x10,%esp
+}
+  801540:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801543:	5b                   	pop    %ebx
+  801544:	5e                   	pop    %esi
+  801545:	5d                   	pop    %ebp
+  801546:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801547:	a1 08 40 80 00       	mov    0x804008,%eax
+  80154c:	8b 40 48             	mov    0x48(%eax),%eax
+  80154f:	83 ec 04             	sub    $0x4,%esp
+  801552:	53                   	push   %ebx
+  801553:	50                   	push   %eax
+  801554:	68 59 2e 80 00       	push   $0x802e59
+  801559:	e8 4f ec ff ff       	call   8001ad <cprintf>
+		return -E_INVAL;
+  80155e:	83 c4 10             	add    $0x10,%esp
+  801561:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801566:	eb d8                	jmp    801540 <write+0x53>
+		return -E_NOT_SUPP;
+  801568:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80156d:	eb d1                	jmp    801540 <write+0x53>
+
+0080156f <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80156f:	55                   	push   %ebp
+  801570:	89 e5                	mov    %esp,%ebp
+  801572:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801575:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801578:	50                   	push   %eax
+  801579:	ff 75 08             	push   0x8(%ebp)
+  80157c:	e8 38 fc ff ff       	call   8011b9 <fd_lookup>
+  801581:	83 c4 10             	add    $0x10,%esp
+  801584:	85 c0                	test   %eax,%eax
+  801586:	78 0e                	js     801596 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801588:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80158b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80158e:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801591:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801596:	c9                   	leave
+  801597:	c3                   	ret
+
+00801598 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801598:	55                   	push   %ebp
+  801599:	89 e5                	mov    %esp,%ebp
+  80159b:	56                   	push   %esi
+  80159c:	53                   	push   %ebx
+  80159d:	83 ec 18             	sub    $0x18,%esp
+  8015a0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015a3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8015a6:	50                   	push   %eax
+  8015a7:	53                   	push   %ebx
+  8015a8:	e8 0c fc ff ff       	call   8011b9 <fd_lookup>
+  8015ad:	83 c4 10             	add    $0x10,%esp
+  8015b0:	85 c0                	test   %eax,%eax
+  8015b2:	78 34                	js     8015e8 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8015b4:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8015b7:	83 ec 08             	sub    $0x8,%esp
+  8015ba:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015bd:	50                   	push   %eax
+  8015be:	ff 36                	push   (%esi)
+  8015c0:	e8 44 fc ff ff       	call   801209 <dev_lookup>
+  8015c5:	83 c4 10             	add    $0x10,%esp
+  8015c8:	85 c0                	test   %eax,%eax
+  8015ca:	78 1c                	js     8015e8 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8015cc:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8015d0:	74 1d                	je     8015ef <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8015d2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015d5:	8b 40 18             	mov    0x18(%eax),%eax
+  8015d8:	85 c0                	test   %eax,%eax
+  8015da:	74 34                	je     801610 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8015dc:	83 ec 08             	sub    $0x8,%esp
+  8015df:	ff 75 0c             	push   0xc(%ebp)
+  8015e2:	56                   	push   %esi
+  8015e3:	ff d0                	call   *%eax
+  8015e5:	83 c4 10             	add    $0x10,%esp
+}
+  8015e8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015eb:	5b                   	pop    %ebx
+  8015ec:	5e                   	pop    %esi
+  8015ed:	5d                   	pop    %ebp
+  8015ee:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8015ef:	a1 08 40 80 00       	mov    0x804008,%eax
+  8015f4:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8015f7:	83 ec 04             	sub    $0x4,%esp
+  8015fa:	53                   	push   %ebx
+  8015fb:	50                   	push   %eax
+  8015fc:	68 1c 2e 80 00       	push   $0x802e1c
+  801601:	e8 a7 eb ff ff       	call   8001ad <cprintf>
+		return -E_INVAL;
+  801606:	83 c4 10             	add    $0x10,%esp
+  801609:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80160e:	eb d8                	jmp    8015e8 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801610:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801615:	eb d1                	jmp    8015e8 <ftruncate+0x50>
+
+00801617 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801617:	55                   	push   %ebp
+  801618:	89 e5                	mov    %esp,%ebp
+  80161a:	56                   	push   %esi
+  80161b:	53                   	push   %ebx
+  80161c:	83 ec 18             	sub    $0x18,%esp
+  80161f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801622:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801625:	50                   	push   %eax
+  801626:	ff 75 08             	push   0x8(%ebp)
+  801629:	e8 8b fb ff ff       	call   8011b9 <fd_lookup>
+  80162e:	83 c4 10             	add    $0x10,%esp
+  801631:	85 c0                	test   %eax,%eax
+  801633:	78 49                	js     80167e <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801635:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801638:	83 ec 08             	sub    $0x8,%esp
+  80163b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80163e:	50                   	push   %eax
+  80163f:	ff 36                	push   (%esi)
+  801641:	e8 c3 fb ff ff       	call   801209 <dev_lookup>
+  801646:	83 c4 10             	add    $0x10,%esp
+  801649:	85 c0                	test   %eax,%eax
+  80164b:	78 31                	js     80167e <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  80164d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801650:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801654:	74 2f                	je     801685 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801656:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801659:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801660:	00 00 00 
+	stat->st_isdir = 0;
+  801663:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80166a:	00 00 00 
+	stat->st_dev = dev;
+  80166d:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801673:	83 ec 08             	sub    $0x8,%esp
+  801676:	53                   	push   %ebx
+  801677:	56                   	push   %esi
+  801678:	ff 50 14             	call   *0x14(%eax)
+  80167b:	83 c4 10             	add    $0x10,%esp
+}
+  80167e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801681:	5b                   	pop    %ebx
+  801682:	5e                   	pop    %esi
+  801683:	5d                   	pop    %ebp
+  801684:	c3                   	ret
+		return -E_NOT_SUPP;
+  801685:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80168a:	eb f2                	jmp    80167e <fstat+0x67>
+
+0080168c <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80168c:	55                   	push   %ebp
+  80168d:	89 e5                	mov    %esp,%ebp
+  80168f:	56                   	push   %esi
+  801690:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801691:	83 ec 08             	sub    $0x8,%esp
+  801694:	6a 00                	push   $0x0
+  801696:	ff 75 08             	push   0x8(%ebp)
+  801699:	e8 e4 01 00 00       	call   801882 <open>
+  80169e:	89 c3                	mov    %eax,%ebx
+  8016a0:	83 c4 10             	add    $0x10,%esp
+  8016a3:	85 c0                	test   %eax,%eax
+  8016a5:	78 1b                	js     8016c2 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8016a7:	83 ec 08             	sub    $0x8,%esp
+  8016aa:	ff 75 0c             	push   0xc(%ebp)
+  8016ad:	50                   	push   %eax
+  8016ae:	e8 64 ff ff ff       	call   801617 <fstat>
+  8016b3:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8016b5:	89 1c 24             	mov    %ebx,(%esp)
+  8016b8:	e8 26 fc ff ff       	call   8012e3 <close>
+	return r;
+  8016bd:	83 c4 10             	add    $0x10,%esp
+  8016c0:	89 f3                	mov    %esi,%ebx
+}
+  8016c2:	89 d8                	mov    %ebx,%eax
+  8016c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016c7:	5b                   	pop    %ebx
+  8016c8:	5e                   	pop    %esi
+  8016c9:	5d                   	pop    %ebp
+  8016ca:	c3                   	ret
+
+008016cb <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  8016cb:	55                   	push   %ebp
+  8016cc:	89 e5                	mov    %esp,%ebp
+  8016ce:	56                   	push   %esi
+  8016cf:	53                   	push   %ebx
+  8016d0:	89 c6                	mov    %eax,%esi
+  8016d2:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  8016d4:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  8016db:	74 27                	je     801704 <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8016dd:	6a 07                	push   $0x7
+  8016df:	68 00 50 80 00       	push   $0x805000
+  8016e4:	56                   	push   %esi
+  8016e5:	ff 35 00 40 80 00    	push   0x804000
+  8016eb:	e8 a6 0c 00 00       	call   802396 <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  8016f0:	83 c4 0c             	add    $0xc,%esp
+  8016f3:	6a 00                	push   $0x0
+  8016f5:	53                   	push   %ebx
+  8016f6:	6a 00                	push   $0x0
+  8016f8:	e8 25 0c 00 00       	call   802322 <ipc_recv>
+}
+  8016fd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801700:	5b                   	pop    %ebx
+  801701:	5e                   	pop    %esi
+  801702:	5d                   	pop    %ebp
+  801703:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  801704:	83 ec 0c             	sub    $0xc,%esp
+  801707:	6a 01                	push   $0x1
+  801709:	e8 dc 0c 00 00       	call   8023ea <ipc_find_env>
+  80170e:	a3 00 40 80 00       	mov    %eax,0x804000
+  801713:	83 c4 10             	add    $0x10,%esp
+  801716:	eb c5                	jmp    8016dd <fsipc+0x12>
+
+00801718 <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801718:	55                   	push   %ebp
+  801719:	89 e5                	mov    %esp,%ebp
+  80171b:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80171e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801721:	8b 40 0c             	mov    0xc(%eax),%eax
+  801724:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.set_size.req_size = newsize;
+  801729:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80172c:	a3 04 50 80 00       	mov    %eax,0x805004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801731:	ba 00 00 00 00       	mov    $0x0,%edx
+  801736:	b8 02 00 00 00       	mov    $0x2,%eax
+  80173b:	e8 8b ff ff ff       	call   8016cb <fsipc>
+}
+  801740:	c9                   	leave
+  801741:	c3                   	ret
+
+00801742 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801742:	55                   	push   %ebp
+  801743:	89 e5                	mov    %esp,%ebp
+  801745:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801748:	8b 45 08             	mov    0x8(%ebp),%eax
+  80174b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80174e:	a3 00 50 80 00       	mov    %eax,0x805000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801753:	ba 00 00 00 00       	mov    $0x0,%edx
+  801758:	b8 06 00 00 00       	mov    $0x6,%eax
+  80175d:	e8 69 ff ff ff       	call   8016cb <fsipc>
+}
+  801762:	c9                   	leave
+  801763:	c3                   	ret
+
+00801764 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801764:	55                   	push   %ebp
+  801765:	89 e5                	mov    %esp,%ebp
+  801767:	53                   	push   %ebx
+  801768:	83 ec 04             	sub    $0x4,%esp
+  80176b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80176e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801771:	8b 40 0c             	mov    0xc(%eax),%eax
+  801774:	a3 00 50 80 00       	mov    %eax,0x805000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801779:	ba 00 00 00 00       	mov    $0x0,%edx
+  80177e:	b8 05 00 00 00       	mov    $0x5,%eax
+  801783:	e8 43 ff ff ff       	call   8016cb <fsipc>
+  801788:	85 c0                	test   %eax,%eax
+  80178a:	78 2c                	js     8017b8 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80178c:	83 ec 08             	sub    $0x8,%esp
+  80178f:	68 00 50 80 00       	push   $0x805000
+  801794:	53                   	push   %ebx
+  801795:	e8 cc ef ff ff       	call   800766 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  80179a:	a1 80 50 80 00       	mov    0x805080,%eax
+  80179f:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8017a5:	a1 84 50 80 00       	mov    0x805084,%eax
+  8017aa:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  8017b0:	83 c4 10             	add    $0x10,%esp
+  8017b3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017bb:	c9                   	leave
+  8017bc:	c3                   	ret
+
+008017bd <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8017bd:	55                   	push   %ebp
+  8017be:	89 e5                	mov    %esp,%ebp
+  8017c0:	83 ec 0c             	sub    $0xc,%esp
+  8017c3:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8017c6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017c9:	8b 52 0c             	mov    0xc(%edx),%edx
+  8017cc:	89 15 00 50 80 00    	mov    %edx,0x805000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8017d2:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8017d7:	39 d0                	cmp    %edx,%eax
+  8017d9:	0f 47 c2             	cmova  %edx,%eax
+  8017dc:	a3 04 50 80 00       	mov    %eax,0x805004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  8017e1:	50                   	push   %eax
+  8017e2:	ff 75 0c             	push   0xc(%ebp)
+  8017e5:	68 08 50 80 00       	push   $0x805008
+  8017ea:	e8 fd f0 ff ff       	call   8008ec <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  8017ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017f4:	b8 04 00 00 00       	mov    $0x4,%eax
+  8017f9:	e8 cd fe ff ff       	call   8016cb <fsipc>
+}
+  8017fe:	c9                   	leave
+  8017ff:	c3                   	ret
+
+00801800 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801800:	55                   	push   %ebp
+  801801:	89 e5                	mov    %esp,%ebp
+  801803:	56                   	push   %esi
+  801804:	53                   	push   %ebx
+  801805:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801808:	8b 45 08             	mov    0x8(%ebp),%eax
+  80180b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80180e:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.read.req_n = n;
+  801813:	89 35 04 50 80 00    	mov    %esi,0x805004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801819:	ba 00 00 00 00       	mov    $0x0,%edx
+  80181e:	b8 03 00 00 00       	mov    $0x3,%eax
+  801823:	e8 a3 fe ff ff       	call   8016cb <fsipc>
+  801828:	89 c3                	mov    %eax,%ebx
+  80182a:	85 c0                	test   %eax,%eax
+  80182c:	78 1f                	js     80184d <devfile_read+0x4d>
+  assert(r <= n);
+  80182e:	39 c6                	cmp    %eax,%esi
+  801830:	72 24                	jb     801856 <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  801832:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801837:	7f 33                	jg     80186c <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801839:	83 ec 04             	sub    $0x4,%esp
+  80183c:	50                   	push   %eax
+  80183d:	68 00 50 80 00       	push   $0x805000
+  801842:	ff 75 0c             	push   0xc(%ebp)
+  801845:	e8 a2 f0 ff ff       	call   8008ec <memmove>
+  return r;
+  80184a:	83 c4 10             	add    $0x10,%esp
+}
+  80184d:	89 d8                	mov    %ebx,%eax
+  80184f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801852:	5b                   	pop    %ebx
+  801853:	5e                   	pop    %esi
+  801854:	5d                   	pop    %ebp
+  801855:	c3                   	ret
+  assert(r <= n);
+  801856:	68 8c 2e 80 00       	push   $0x802e8c
+  80185b:	68 93 2e 80 00       	push   $0x802e93
+  801860:	6a 78                	push   $0x78
+  801862:	68 a8 2e 80 00       	push   $0x802ea8
+  801867:	e8 e1 09 00 00       	call   80224d <_panic>
+  assert(r <= PGSIZE);
+  80186c:	68 b3 2e 80 00       	push   $0x802eb3
+  801871:	68 93 2e 80 00       	push   $0x802e93
+  801876:	6a 79                	push   $0x79
+  801878:	68 a8 2e 80 00       	push   $0x802ea8
+  80187d:	e8 cb 09 00 00       	call   80224d <_panic>
+
+00801882 <open>:
+open(const char *path, int mode) {
+  801882:	55                   	push   %ebp
+  801883:	89 e5                	mov    %esp,%ebp
+  801885:	56                   	push   %esi
+  801886:	53                   	push   %ebx
+  801887:	83 ec 1c             	sub    $0x1c,%esp
+  80188a:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  80188d:	56                   	push   %esi
+  80188e:	e8 98 ee ff ff       	call   80072b <strlen>
+  801893:	83 c4 10             	add    $0x10,%esp
+  801896:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80189b:	7f 6c                	jg     801909 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  80189d:	83 ec 0c             	sub    $0xc,%esp
+  8018a0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018a3:	50                   	push   %eax
+  8018a4:	e8 ba f8 ff ff       	call   801163 <fd_alloc>
+  8018a9:	89 c3                	mov    %eax,%ebx
+  8018ab:	83 c4 10             	add    $0x10,%esp
+  8018ae:	85 c0                	test   %eax,%eax
+  8018b0:	78 3c                	js     8018ee <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  8018b2:	83 ec 08             	sub    $0x8,%esp
+  8018b5:	56                   	push   %esi
+  8018b6:	68 00 50 80 00       	push   $0x805000
+  8018bb:	e8 a6 ee ff ff       	call   800766 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  8018c0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8018c3:	a3 00 54 80 00       	mov    %eax,0x805400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8018c8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8018cb:	b8 01 00 00 00       	mov    $0x1,%eax
+  8018d0:	e8 f6 fd ff ff       	call   8016cb <fsipc>
+  8018d5:	89 c3                	mov    %eax,%ebx
+  8018d7:	83 c4 10             	add    $0x10,%esp
+  8018da:	85 c0                	test   %eax,%eax
+  8018dc:	78 19                	js     8018f7 <open+0x75>
+  return fd2num(fd);
+  8018de:	83 ec 0c             	sub    $0xc,%esp
+  8018e1:	ff 75 f4             	push   -0xc(%ebp)
+  8018e4:	e8 53 f8 ff ff       	call   80113c <fd2num>
+  8018e9:	89 c3                	mov    %eax,%ebx
+  8018eb:	83 c4 10             	add    $0x10,%esp
+}
+  8018ee:	89 d8                	mov    %ebx,%eax
+  8018f0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018f3:	5b                   	pop    %ebx
+  8018f4:	5e                   	pop    %esi
+  8018f5:	5d                   	pop    %ebp
+  8018f6:	c3                   	ret
+    fd_close(fd, 0);
+  8018f7:	83 ec 08             	sub    $0x8,%esp
+  8018fa:	6a 00                	push   $0x0
+  8018fc:	ff 75 f4             	push   -0xc(%ebp)
+  8018ff:	e8 58 f9 ff ff       	call   80125c <fd_close>
+    return r;
+  801904:	83 c4 10             	add    $0x10,%esp
+  801907:	eb e5                	jmp    8018ee <open+0x6c>
+    return -E_BAD_PATH;
+  801909:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80190e:	eb de                	jmp    8018ee <open+0x6c>
+
+00801910 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  801910:	55                   	push   %ebp
+  801911:	89 e5                	mov    %esp,%ebp
+  801913:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801916:	ba 00 00 00 00       	mov    $0x0,%edx
+  80191b:	b8 08 00 00 00       	mov    $0x8,%eax
+  801920:	e8 a6 fd ff ff       	call   8016cb <fsipc>
+}
+  801925:	c9                   	leave
+  801926:	c3                   	ret
+
+00801927 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801927:	55                   	push   %ebp
+  801928:	89 e5                	mov    %esp,%ebp
+  80192a:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  80192d:	68 bf 2e 80 00       	push   $0x802ebf
+  801932:	ff 75 0c             	push   0xc(%ebp)
+  801935:	e8 2c ee ff ff       	call   800766 <strcpy>
+	return 0;
+}
+  80193a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80193f:	c9                   	leave
+  801940:	c3                   	ret
+
+00801941 <devsock_close>:
+{
+  801941:	55                   	push   %ebp
+  801942:	89 e5                	mov    %esp,%ebp
+  801944:	53                   	push   %ebx
+  801945:	83 ec 10             	sub    $0x10,%esp
+  801948:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  80194b:	53                   	push   %ebx
+  80194c:	e8 d8 0a 00 00       	call   802429 <pageref>
+  801951:	89 c2                	mov    %eax,%edx
+  801953:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801956:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  80195b:	83 fa 01             	cmp    $0x1,%edx
+  80195e:	74 05                	je     801965 <devsock_close+0x24>
+}
+  801960:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801963:	c9                   	leave
+  801964:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801965:	83 ec 0c             	sub    $0xc,%esp
+  801968:	ff 73 0c             	push   0xc(%ebx)
+  80196b:	e8 b7 02 00 00       	call   801c27 <nsipc_close>
+  801970:	83 c4 10             	add    $0x10,%esp
+  801973:	eb eb                	jmp    801960 <devsock_close+0x1f>
+
+00801975 <devsock_write>:
+{
+  801975:	55                   	push   %ebp
+  801976:	89 e5                	mov    %esp,%ebp
+  801978:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  80197b:	6a 00                	push   $0x0
+  80197d:	ff 75 10             	push   0x10(%ebp)
+  801980:	ff 75 0c             	push   0xc(%ebp)
+  801983:	8b 45 08             	mov    0x8(%ebp),%eax
+  801986:	ff 70 0c             	push   0xc(%eax)
+  801989:	e8 79 03 00 00       	call   801d07 <nsipc_send>
+}
+  80198e:	c9                   	leave
+  80198f:	c3                   	ret
+
+00801990 <devsock_read>:
+{
+  801990:	55                   	push   %ebp
+  801991:	89 e5                	mov    %esp,%ebp
+  801993:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801996:	6a 00                	push   $0x0
+  801998:	ff 75 10             	push   0x10(%ebp)
+  80199b:	ff 75 0c             	push   0xc(%ebp)
+  80199e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019a1:	ff 70 0c             	push   0xc(%eax)
+  8019a4:	e8 ef 02 00 00       	call   801c98 <nsipc_recv>
+}
+  8019a9:	c9                   	leave
+  8019aa:	c3                   	ret
+
+008019ab <fd2sockid>:
+{
+  8019ab:	55                   	push   %ebp
+  8019ac:	89 e5                	mov    %esp,%ebp
+  8019ae:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8019b1:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8019b4:	52                   	push   %edx
+  8019b5:	50                   	push   %eax
+  8019b6:	e8 fe f7 ff ff       	call   8011b9 <fd_lookup>
+  8019bb:	83 c4 10             	add    $0x10,%esp
+  8019be:	85 c0                	test   %eax,%eax
+  8019c0:	78 10                	js     8019d2 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8019c2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019c5:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  8019cb:	39 08                	cmp    %ecx,(%eax)
+  8019cd:	75 05                	jne    8019d4 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8019cf:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8019d2:	c9                   	leave
+  8019d3:	c3                   	ret
+		return -E_NOT_SUPP;
+  8019d4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8019d9:	eb f7                	jmp    8019d2 <fd2sockid+0x27>
+
+008019db <alloc_sockfd>:
+{
+  8019db:	55                   	push   %ebp
+  8019dc:	89 e5                	mov    %esp,%ebp
+  8019de:	56                   	push   %esi
+  8019df:	53                   	push   %ebx
+  8019e0:	83 ec 1c             	sub    $0x1c,%esp
+  8019e3:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8019e5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019e8:	50                   	push   %eax
+  8019e9:	e8 75 f7 ff ff       	call   801163 <fd_alloc>
+  8019ee:	89 c3                	mov    %eax,%ebx
+  8019f0:	83 c4 10             	add    $0x10,%esp
+  8019f3:	85 c0                	test   %eax,%eax
+  8019f5:	78 43                	js     801a3a <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8019f7:	83 ec 04             	sub    $0x4,%esp
+  8019fa:	68 07 04 00 00       	push   $0x407
+  8019ff:	ff 75 f4             	push   -0xc(%ebp)
+  801a02:	6a 00                	push   $0x0
+  801a04:	e8 49 f1 ff ff       	call   800b52 <sys_page_alloc>
+  801a09:	89 c3                	mov    %eax,%ebx
+  801a0b:	83 c4 10             	add    $0x10,%esp
+  801a0e:	85 c0                	test   %eax,%eax
+  801a10:	78 28                	js     801a3a <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801a12:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a15:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  801a1b:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801a1d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a20:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801a27:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801a2a:	83 ec 0c             	sub    $0xc,%esp
+  801a2d:	50                   	push   %eax
+  801a2e:	e8 09 f7 ff ff       	call   80113c <fd2num>
+  801a33:	89 c3                	mov    %eax,%ebx
+  801a35:	83 c4 10             	add    $0x10,%esp
+  801a38:	eb 0c                	jmp    801a46 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801a3a:	83 ec 0c             	sub    $0xc,%esp
+  801a3d:	56                   	push   %esi
+  801a3e:	e8 e4 01 00 00       	call   801c27 <nsipc_close>
+		return r;
+  801a43:	83 c4 10             	add    $0x10,%esp
+}
+  801a46:	89 d8                	mov    %ebx,%eax
+  801a48:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a4b:	5b                   	pop    %ebx
+  801a4c:	5e                   	pop    %esi
+  801a4d:	5d                   	pop    %ebp
+  801a4e:	c3                   	ret
+
+00801a4f <accept>:
+{
+  801a4f:	55                   	push   %ebp
+  801a50:	89 e5                	mov    %esp,%ebp
+  801a52:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801a55:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a58:	e8 4e ff ff ff       	call   8019ab <fd2sockid>
+  801a5d:	85 c0                	test   %eax,%eax
+  801a5f:	78 1b                	js     801a7c <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801a61:	83 ec 04             	sub    $0x4,%esp
+  801a64:	ff 75 10             	push   0x10(%ebp)
+  801a67:	ff 75 0c             	push   0xc(%ebp)
+  801a6a:	50                   	push   %eax
+  801a6b:	e8 0e 01 00 00       	call   801b7e <nsipc_accept>
+  801a70:	83 c4 10             	add    $0x10,%esp
+  801a73:	85 c0                	test   %eax,%eax
+  801a75:	78 05                	js     801a7c <accept+0x2d>
+	return alloc_sockfd(r);
+  801a77:	e8 5f ff ff ff       	call   8019db <alloc_sockfd>
+}
+  801a7c:	c9                   	leave
+  801a7d:	c3                   	ret
+
+00801a7e <bind>:
+{
+  801a7e:	55                   	push   %ebp
+  801a7f:	89 e5                	mov    %esp,%ebp
+  801a81:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801a84:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a87:	e8 1f ff ff ff       	call   8019ab <fd2sockid>
+  801a8c:	85 c0                	test   %eax,%eax
+  801a8e:	78 12                	js     801aa2 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801a90:	83 ec 04             	sub    $0x4,%esp
+  801a93:	ff 75 10             	push   0x10(%ebp)
+  801a96:	ff 75 0c             	push   0xc(%ebp)
+  801a99:	50                   	push   %eax
+  801a9a:	e8 31 01 00 00       	call   801bd0 <nsipc_bind>
+  801a9f:	83 c4 10             	add    $0x10,%esp
+}
+  801aa2:	c9                   	leave
+  801aa3:	c3                   	ret
+
+00801aa4 <shutdown>:
+{
+  801aa4:	55                   	push   %ebp
+  801aa5:	89 e5                	mov    %esp,%ebp
+  801aa7:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801aaa:	8b 45 08             	mov    0x8(%ebp),%eax
+  801aad:	e8 f9 fe ff ff       	call   8019ab <fd2sockid>
+  801ab2:	85 c0                	test   %eax,%eax
+  801ab4:	78 0f                	js     801ac5 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801ab6:	83 ec 08             	sub    $0x8,%esp
+  801ab9:	ff 75 0c             	push   0xc(%ebp)
+  801abc:	50                   	push   %eax
+  801abd:	e8 43 01 00 00       	call   801c05 <nsipc_shutdown>
+  801ac2:	83 c4 10             	add    $0x10,%esp
+}
+  801ac5:	c9                   	leave
+  801ac6:	c3                   	ret
+
+00801ac7 <connect>:
+{
+  801ac7:	55                   	push   %ebp
+  801ac8:	89 e5                	mov    %esp,%ebp
+  801aca:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801acd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ad0:	e8 d6 fe ff ff       	call   8019ab <fd2sockid>
+  801ad5:	85 c0                	test   %eax,%eax
+  801ad7:	78 12                	js     801aeb <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801ad9:	83 ec 04             	sub    $0x4,%esp
+  801adc:	ff 75 10             	push   0x10(%ebp)
+  801adf:	ff 75 0c             	push   0xc(%ebp)
+  801ae2:	50                   	push   %eax
+  801ae3:	e8 59 01 00 00       	call   801c41 <nsipc_connect>
+  801ae8:	83 c4 10             	add    $0x10,%esp
+}
+  801aeb:	c9                   	leave
+  801aec:	c3                   	ret
+
+00801aed <listen>:
+{
+  801aed:	55                   	push   %ebp
+  801aee:	89 e5                	mov    %esp,%ebp
+  801af0:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801af3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801af6:	e8 b0 fe ff ff       	call   8019ab <fd2sockid>
+  801afb:	85 c0                	test   %eax,%eax
+  801afd:	78 0f                	js     801b0e <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801aff:	83 ec 08             	sub    $0x8,%esp
+  801b02:	ff 75 0c             	push   0xc(%ebp)
+  801b05:	50                   	push   %eax
+  801b06:	e8 6b 01 00 00       	call   801c76 <nsipc_listen>
+  801b0b:	83 c4 10             	add    $0x10,%esp
+}
+  801b0e:	c9                   	leave
+  801b0f:	c3                   	ret
+
+00801b10 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801b10:	55                   	push   %ebp
+  801b11:	89 e5                	mov    %esp,%ebp
+  801b13:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801b16:	ff 75 10             	push   0x10(%ebp)
+  801b19:	ff 75 0c             	push   0xc(%ebp)
+  801b1c:	ff 75 08             	push   0x8(%ebp)
+  801b1f:	e8 41 02 00 00       	call   801d65 <nsipc_socket>
+  801b24:	83 c4 10             	add    $0x10,%esp
+  801b27:	85 c0                	test   %eax,%eax
+  801b29:	78 05                	js     801b30 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801b2b:	e8 ab fe ff ff       	call   8019db <alloc_sockfd>
+}
+  801b30:	c9                   	leave
+  801b31:	c3                   	ret
+
+00801b32 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801b32:	55                   	push   %ebp
+  801b33:	89 e5                	mov    %esp,%ebp
+  801b35:	53                   	push   %ebx
+  801b36:	83 ec 04             	sub    $0x4,%esp
+  801b39:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801b3b:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801b42:	74 26                	je     801b6a <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801b44:	6a 07                	push   $0x7
+  801b46:	68 00 60 80 00       	push   $0x806000
+  801b4b:	53                   	push   %ebx
+  801b4c:	ff 35 04 40 80 00    	push   0x804004
+  801b52:	e8 3f 08 00 00       	call   802396 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801b57:	83 c4 0c             	add    $0xc,%esp
+  801b5a:	6a 00                	push   $0x0
+  801b5c:	6a 00                	push   $0x0
+  801b5e:	6a 00                	push   $0x0
+  801b60:	e8 bd 07 00 00       	call   802322 <ipc_recv>
+}
+  801b65:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b68:	c9                   	leave
+  801b69:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801b6a:	83 ec 0c             	sub    $0xc,%esp
+  801b6d:	6a 02                	push   $0x2
+  801b6f:	e8 76 08 00 00       	call   8023ea <ipc_find_env>
+  801b74:	a3 04 40 80 00       	mov    %eax,0x804004
+  801b79:	83 c4 10             	add    $0x10,%esp
+  801b7c:	eb c6                	jmp    801b44 <nsipc+0x12>
+
+00801b7e <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801b7e:	55                   	push   %ebp
+  801b7f:	89 e5                	mov    %esp,%ebp
+  801b81:	56                   	push   %esi
+  801b82:	53                   	push   %ebx
+  801b83:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801b86:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b89:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801b8e:	8b 06                	mov    (%esi),%eax
+  801b90:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801b95:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b9a:	e8 93 ff ff ff       	call   801b32 <nsipc>
+  801b9f:	89 c3                	mov    %eax,%ebx
+  801ba1:	85 c0                	test   %eax,%eax
+  801ba3:	79 09                	jns    801bae <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801ba5:	89 d8                	mov    %ebx,%eax
+  801ba7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801baa:	5b                   	pop    %ebx
+  801bab:	5e                   	pop    %esi
+  801bac:	5d                   	pop    %ebp
+  801bad:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801bae:	83 ec 04             	sub    $0x4,%esp
+  801bb1:	ff 35 10 60 80 00    	push   0x806010
+  801bb7:	68 00 60 80 00       	push   $0x806000
+  801bbc:	ff 75 0c             	push   0xc(%ebp)
+  801bbf:	e8 28 ed ff ff       	call   8008ec <memmove>
+		*addrlen = ret->ret_addrlen;
+  801bc4:	a1 10 60 80 00       	mov    0x806010,%eax
+  801bc9:	89 06                	mov    %eax,(%esi)
+  801bcb:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801bce:	eb d5                	jmp    801ba5 <nsipc_accept+0x27>
+
+00801bd0 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801bd0:	55                   	push   %ebp
+  801bd1:	89 e5                	mov    %esp,%ebp
+  801bd3:	53                   	push   %ebx
+  801bd4:	83 ec 08             	sub    $0x8,%esp
+  801bd7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801bda:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bdd:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801be2:	53                   	push   %ebx
+  801be3:	ff 75 0c             	push   0xc(%ebp)
+  801be6:	68 04 60 80 00       	push   $0x806004
+  801beb:	e8 fc ec ff ff       	call   8008ec <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801bf0:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  801bf6:	b8 02 00 00 00       	mov    $0x2,%eax
+  801bfb:	e8 32 ff ff ff       	call   801b32 <nsipc>
+}
+  801c00:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c03:	c9                   	leave
+  801c04:	c3                   	ret
+
+00801c05 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801c05:	55                   	push   %ebp
+  801c06:	89 e5                	mov    %esp,%ebp
+  801c08:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801c0b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c0e:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  801c13:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c16:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  801c1b:	b8 03 00 00 00       	mov    $0x3,%eax
+  801c20:	e8 0d ff ff ff       	call   801b32 <nsipc>
+}
+  801c25:	c9                   	leave
+  801c26:	c3                   	ret
+
+00801c27 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801c27:	55                   	push   %ebp
+  801c28:	89 e5                	mov    %esp,%ebp
+  801c2a:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801c2d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c30:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  801c35:	b8 04 00 00 00       	mov    $0x4,%eax
+  801c3a:	e8 f3 fe ff ff       	call   801b32 <nsipc>
+}
+  801c3f:	c9                   	leave
+  801c40:	c3                   	ret
+
+00801c41 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801c41:	55                   	push   %ebp
+  801c42:	89 e5                	mov    %esp,%ebp
+  801c44:	53                   	push   %ebx
+  801c45:	83 ec 08             	sub    $0x8,%esp
+  801c48:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801c4b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c4e:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801c53:	53                   	push   %ebx
+  801c54:	ff 75 0c             	push   0xc(%ebp)
+  801c57:	68 04 60 80 00       	push   $0x806004
+  801c5c:	e8 8b ec ff ff       	call   8008ec <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801c61:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  801c67:	b8 05 00 00 00       	mov    $0x5,%eax
+  801c6c:	e8 c1 fe ff ff       	call   801b32 <nsipc>
+}
+  801c71:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c74:	c9                   	leave
+  801c75:	c3                   	ret
+
+00801c76 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801c76:	55                   	push   %ebp
+  801c77:	89 e5                	mov    %esp,%ebp
+  801c79:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801c7c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c7f:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  801c84:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c87:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  801c8c:	b8 06 00 00 00       	mov    $0x6,%eax
+  801c91:	e8 9c fe ff ff       	call   801b32 <nsipc>
+}
+  801c96:	c9                   	leave
+  801c97:	c3                   	ret
+
+00801c98 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801c98:	55                   	push   %ebp
+  801c99:	89 e5                	mov    %esp,%ebp
+  801c9b:	56                   	push   %esi
+  801c9c:	53                   	push   %ebx
+  801c9d:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801ca0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ca3:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  801ca8:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  801cae:	8b 45 14             	mov    0x14(%ebp),%eax
+  801cb1:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801cb6:	b8 07 00 00 00       	mov    $0x7,%eax
+  801cbb:	e8 72 fe ff ff       	call   801b32 <nsipc>
+  801cc0:	89 c3                	mov    %eax,%ebx
+  801cc2:	85 c0                	test   %eax,%eax
+  801cc4:	78 22                	js     801ce8 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801cc6:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801ccb:	39 c6                	cmp    %eax,%esi
+  801ccd:	0f 4e c6             	cmovle %esi,%eax
+  801cd0:	39 c3                	cmp    %eax,%ebx
+  801cd2:	7f 1d                	jg     801cf1 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801cd4:	83 ec 04             	sub    $0x4,%esp
+  801cd7:	53                   	push   %ebx
+  801cd8:	68 00 60 80 00       	push   $0x806000
+  801cdd:	ff 75 0c             	push   0xc(%ebp)
+  801ce0:	e8 07 ec ff ff       	call   8008ec <memmove>
+  801ce5:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801ce8:	89 d8                	mov    %ebx,%eax
+  801cea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ced:	5b                   	pop    %ebx
+  801cee:	5e                   	pop    %esi
+  801cef:	5d                   	pop    %ebp
+  801cf0:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801cf1:	68 cb 2e 80 00       	push   $0x802ecb
+  801cf6:	68 93 2e 80 00       	push   $0x802e93
+  801cfb:	6a 62                	push   $0x62
+  801cfd:	68 e0 2e 80 00       	push   $0x802ee0
+  801d02:	e8 46 05 00 00       	call   80224d <_panic>
+
+00801d07 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801d07:	55                   	push   %ebp
+  801d08:	89 e5                	mov    %esp,%ebp
+  801d0a:	53                   	push   %ebx
+  801d0b:	83 ec 04             	sub    $0x4,%esp
+  801d0e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801d11:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d14:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  801d19:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801d1f:	7f 2e                	jg     801d4f <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801d21:	83 ec 04             	sub    $0x4,%esp
+  801d24:	53                   	push   %ebx
+  801d25:	ff 75 0c             	push   0xc(%ebp)
+  801d28:	68 0c 60 80 00       	push   $0x80600c
+  801d2d:	e8 ba eb ff ff       	call   8008ec <memmove>
+	nsipcbuf.send.req_size = size;
+  801d32:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  801d38:	8b 45 14             	mov    0x14(%ebp),%eax
+  801d3b:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  801d40:	b8 08 00 00 00       	mov    $0x8,%eax
+  801d45:	e8 e8 fd ff ff       	call   801b32 <nsipc>
+}
+  801d4a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d4d:	c9                   	leave
+  801d4e:	c3                   	ret
+	assert(size < 1600);
+  801d4f:	68 ec 2e 80 00       	push   $0x802eec
+  801d54:	68 93 2e 80 00       	push   $0x802e93
+  801d59:	6a 6d                	push   $0x6d
+  801d5b:	68 e0 2e 80 00       	push   $0x802ee0
+  801d60:	e8 e8 04 00 00       	call   80224d <_panic>
+
+00801d65 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801d65:	55                   	push   %ebp
+  801d66:	89 e5                	mov    %esp,%ebp
+  801d68:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801d6b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d6e:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  801d73:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d76:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  801d7b:	8b 45 10             	mov    0x10(%ebp),%eax
+  801d7e:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  801d83:	b8 09 00 00 00       	mov    $0x9,%eax
+  801d88:	e8 a5 fd ff ff       	call   801b32 <nsipc>
+}
+  801d8d:	c9                   	leave
+  801d8e:	c3                   	ret
+
+00801d8f <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801d8f:	55                   	push   %ebp
+  801d90:	89 e5                	mov    %esp,%ebp
+  801d92:	56                   	push   %esi
+  801d93:	53                   	push   %ebx
+  801d94:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801d97:	83 ec 0c             	sub    $0xc,%esp
+  801d9a:	ff 75 08             	push   0x8(%ebp)
+  801d9d:	e8 aa f3 ff ff       	call   80114c <fd2data>
+  801da2:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801da4:	83 c4 08             	add    $0x8,%esp
+  801da7:	68 f8 2e 80 00       	push   $0x802ef8
+  801dac:	53                   	push   %ebx
+  801dad:	e8 b4 e9 ff ff       	call   800766 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801db2:	8b 46 04             	mov    0x4(%esi),%eax
+  801db5:	2b 06                	sub    (%esi),%eax
+  801db7:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  801dbd:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801dc4:	00 00 00 
+	stat->st_dev = &devpipe;
+  801dc7:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  801dce:	30 80 00 
+	return 0;
+}
+  801dd1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dd6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dd9:	5b                   	pop    %ebx
+  801dda:	5e                   	pop    %esi
+  801ddb:	5d                   	pop    %ebp
+  801ddc:	c3                   	ret
+
+00801ddd <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801ddd:	55                   	push   %ebp
+  801dde:	89 e5                	mov    %esp,%ebp
+  801de0:	53                   	push   %ebx
+  801de1:	83 ec 0c             	sub    $0xc,%esp
+  801de4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801de7:	53                   	push   %ebx
+  801de8:	6a 00                	push   $0x0
+  801dea:	e8 e8 ed ff ff       	call   800bd7 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801def:	89 1c 24             	mov    %ebx,(%esp)
+  801df2:	e8 55 f3 ff ff       	call   80114c <fd2data>
+  801df7:	83 c4 08             	add    $0x8,%esp
+  801dfa:	50                   	push   %eax
+  801dfb:	6a 00                	push   $0x0
+  801dfd:	e8 d5 ed ff ff       	call   800bd7 <sys_page_unmap>
+}
+  801e02:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e05:	c9                   	leave
+  801e06:	c3                   	ret
+
+00801e07 <_pipeisclosed>:
+{
+  801e07:	55                   	push   %ebp
+  801e08:	89 e5                	mov    %esp,%ebp
+  801e0a:	57                   	push   %edi
+  801e0b:	56                   	push   %esi
+  801e0c:	53                   	push   %ebx
+  801e0d:	83 ec 1c             	sub    $0x1c,%esp
+  801e10:	89 c7                	mov    %eax,%edi
+  801e12:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801e14:	a1 08 40 80 00       	mov    0x804008,%eax
+  801e19:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801e1c:	83 ec 0c             	sub    $0xc,%esp
+  801e1f:	57                   	push   %edi
+  801e20:	e8 04 06 00 00       	call   802429 <pageref>
+  801e25:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801e28:	89 34 24             	mov    %esi,(%esp)
+  801e2b:	e8 f9 05 00 00       	call   802429 <pageref>
+		nn = thisenv->env_runs;
+  801e30:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801e36:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801e39:	83 c4 10             	add    $0x10,%esp
+  801e3c:	39 cb                	cmp    %ecx,%ebx
+  801e3e:	74 1b                	je     801e5b <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801e40:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801e43:	75 cf                	jne    801e14 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801e45:	8b 42 58             	mov    0x58(%edx),%eax
+  801e48:	6a 01                	push   $0x1
+  801e4a:	50                   	push   %eax
+  801e4b:	53                   	push   %ebx
+  801e4c:	68 ff 2e 80 00       	push   $0x802eff
+  801e51:	e8 57 e3 ff ff       	call   8001ad <cprintf>
+  801e56:	83 c4 10             	add    $0x10,%esp
+  801e59:	eb b9                	jmp    801e14 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801e5b:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801e5e:	0f 94 c0             	sete   %al
+  801e61:	0f b6 c0             	movzbl %al,%eax
+}
+  801e64:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e67:	5b                   	pop    %ebx
+  801e68:	5e                   	pop    %esi
+  801e69:	5f                   	pop    %edi
+  801e6a:	5d                   	pop    %ebp
+  801e6b:	c3                   	ret
+
+00801e6c <devpipe_write>:
+{
+  801e6c:	55                   	push   %ebp
+  801e6d:	89 e5                	mov    %esp,%ebp
+  801e6f:	57                   	push   %edi
+  801e70:	56                   	push   %esi
+  801e71:	53                   	push   %ebx
+  801e72:	83 ec 28             	sub    $0x28,%esp
+  801e75:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801e78:	56                   	push   %esi
+  801e79:	e8 ce f2 ff ff       	call   80114c <fd2data>
+  801e7e:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801e80:	83 c4 10             	add    $0x10,%esp
+  801e83:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e88:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801e8b:	75 09                	jne    801e96 <devpipe_write+0x2a>
+	return i;
+  801e8d:	89 f8                	mov    %edi,%eax
+  801e8f:	eb 23                	jmp    801eb4 <devpipe_write+0x48>
+			sys_yield();
+  801e91:	e8 9d ec ff ff       	call   800b33 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801e96:	8b 43 04             	mov    0x4(%ebx),%eax
+  801e99:	8b 0b                	mov    (%ebx),%ecx
+  801e9b:	8d 51 20             	lea    0x20(%ecx),%edx
+  801e9e:	39 d0                	cmp    %edx,%eax
+  801ea0:	72 1a                	jb     801ebc <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  801ea2:	89 da                	mov    %ebx,%edx
+  801ea4:	89 f0                	mov    %esi,%eax
+  801ea6:	e8 5c ff ff ff       	call   801e07 <_pipeisclosed>
+  801eab:	85 c0                	test   %eax,%eax
+  801ead:	74 e2                	je     801e91 <devpipe_write+0x25>
+				return 0;
+  801eaf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801eb4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801eb7:	5b                   	pop    %ebx
+  801eb8:	5e                   	pop    %esi
+  801eb9:	5f                   	pop    %edi
+  801eba:	5d                   	pop    %ebp
+  801ebb:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801ebc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ebf:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801ec3:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801ec6:	89 c2                	mov    %eax,%edx
+  801ec8:	c1 fa 1f             	sar    $0x1f,%edx
+  801ecb:	89 d1                	mov    %edx,%ecx
+  801ecd:	c1 e9 1b             	shr    $0x1b,%ecx
+  801ed0:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801ed3:	83 e2 1f             	and    $0x1f,%edx
+  801ed6:	29 ca                	sub    %ecx,%edx
+  801ed8:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801edc:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  801ee0:	83 c0 01             	add    $0x1,%eax
+  801ee3:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  801ee6:	83 c7 01             	add    $0x1,%edi
+  801ee9:	eb 9d                	jmp    801e88 <devpipe_write+0x1c>
+
+00801eeb <devpipe_read>:
+{
+  801eeb:	55                   	push   %ebp
+  801eec:	89 e5                	mov    %esp,%ebp
+  801eee:	57                   	push   %edi
+  801eef:	56                   	push   %esi
+  801ef0:	53                   	push   %ebx
+  801ef1:	83 ec 18             	sub    $0x18,%esp
+  801ef4:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  801ef7:	57                   	push   %edi
+  801ef8:	e8 4f f2 ff ff       	call   80114c <fd2data>
+  801efd:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801eff:	83 c4 10             	add    $0x10,%esp
+  801f02:	be 00 00 00 00       	mov    $0x0,%esi
+  801f07:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801f0a:	75 13                	jne    801f1f <devpipe_read+0x34>
+	return i;
+  801f0c:	89 f0                	mov    %esi,%eax
+  801f0e:	eb 02                	jmp    801f12 <devpipe_read+0x27>
+				return i;
+  801f10:	89 f0                	mov    %esi,%eax
+}
+  801f12:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f15:	5b                   	pop    %ebx
+  801f16:	5e                   	pop    %esi
+  801f17:	5f                   	pop    %edi
+  801f18:	5d                   	pop    %ebp
+  801f19:	c3                   	ret
+			sys_yield();
+  801f1a:	e8 14 ec ff ff       	call   800b33 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  801f1f:	8b 03                	mov    (%ebx),%eax
+  801f21:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801f24:	75 18                	jne    801f3e <devpipe_read+0x53>
+			if (i > 0)
+  801f26:	85 f6                	test   %esi,%esi
+  801f28:	75 e6                	jne    801f10 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  801f2a:	89 da                	mov    %ebx,%edx
+  801f2c:	89 f8                	mov    %edi,%eax
+  801f2e:	e8 d4 fe ff ff       	call   801e07 <_pipeisclosed>
+  801f33:	85 c0                	test   %eax,%eax
+  801f35:	74 e3                	je     801f1a <devpipe_read+0x2f>
+				return 0;
+  801f37:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f3c:	eb d4                	jmp    801f12 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801f3e:	99                   	cltd
+  801f3f:	c1 ea 1b             	shr    $0x1b,%edx
+  801f42:	01 d0                	add    %edx,%eax
+  801f44:	83 e0 1f             	and    $0x1f,%eax
+  801f47:	29 d0                	sub    %edx,%eax
+  801f49:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801f4e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f51:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  801f54:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  801f57:	83 c6 01             	add    $0x1,%esi
+  801f5a:	eb ab                	jmp    801f07 <devpipe_read+0x1c>
+
+00801f5c <pipe>:
+{
+  801f5c:	55                   	push   %ebp
+  801f5d:	89 e5                	mov    %esp,%ebp
+  801f5f:	56                   	push   %esi
+  801f60:	53                   	push   %ebx
+  801f61:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801f64:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f67:	50                   	push   %eax
+  801f68:	e8 f6 f1 ff ff       	call   801163 <fd_alloc>
+  801f6d:	89 c3                	mov    %eax,%ebx
+  801f6f:	83 c4 10             	add    $0x10,%esp
+  801f72:	85 c0                	test   %eax,%eax
+  801f74:	0f 88 23 01 00 00    	js     80209d <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801f7a:	83 ec 04             	sub    $0x4,%esp
+  801f7d:	68 07 04 00 00       	push   $0x407
+  801f82:	ff 75 f4             	push   -0xc(%ebp)
+  801f85:	6a 00                	push   $0x0
+  801f87:	e8 c6 eb ff ff       	call   800b52 <sys_page_alloc>
+  801f8c:	89 c3                	mov    %eax,%ebx
+  801f8e:	83 c4 10             	add    $0x10,%esp
+  801f91:	85 c0                	test   %eax,%eax
+  801f93:	0f 88 04 01 00 00    	js     80209d <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801f99:	83 ec 0c             	sub    $0xc,%esp
+  801f9c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801f9f:	50                   	push   %eax
+  801fa0:	e8 be f1 ff ff       	call   801163 <fd_alloc>
+  801fa5:	89 c3                	mov    %eax,%ebx
+  801fa7:	83 c4 10             	add    $0x10,%esp
+  801faa:	85 c0                	test   %eax,%eax
+  801fac:	0f 88 db 00 00 00    	js     80208d <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801fb2:	83 ec 04             	sub    $0x4,%esp
+  801fb5:	68 07 04 00 00       	push   $0x407
+  801fba:	ff 75 f0             	push   -0x10(%ebp)
+  801fbd:	6a 00                	push   $0x0
+  801fbf:	e8 8e eb ff ff       	call   800b52 <sys_page_alloc>
+  801fc4:	89 c3                	mov    %eax,%ebx
+  801fc6:	83 c4 10             	add    $0x10,%esp
+  801fc9:	85 c0                	test   %eax,%eax
+  801fcb:	0f 88 bc 00 00 00    	js     80208d <pipe+0x131>
+	va = fd2data(fd0);
+  801fd1:	83 ec 0c             	sub    $0xc,%esp
+  801fd4:	ff 75 f4             	push   -0xc(%ebp)
+  801fd7:	e8 70 f1 ff ff       	call   80114c <fd2data>
+  801fdc:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801fde:	83 c4 0c             	add    $0xc,%esp
+  801fe1:	68 07 04 00 00       	push   $0x407
+  801fe6:	50                   	push   %eax
+  801fe7:	6a 00                	push   $0x0
+  801fe9:	e8 64 eb ff ff       	call   800b52 <sys_page_alloc>
+  801fee:	89 c3                	mov    %eax,%ebx
+  801ff0:	83 c4 10             	add    $0x10,%esp
+  801ff3:	85 c0                	test   %eax,%eax
+  801ff5:	0f 88 82 00 00 00    	js     80207d <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801ffb:	83 ec 0c             	sub    $0xc,%esp
+  801ffe:	ff 75 f0             	push   -0x10(%ebp)
+  802001:	e8 46 f1 ff ff       	call   80114c <fd2data>
+  802006:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80200d:	50                   	push   %eax
+  80200e:	6a 00                	push   $0x0
+  802010:	56                   	push   %esi
+  802011:	6a 00                	push   $0x0
+  802013:	e8 7d eb ff ff       	call   800b95 <sys_page_map>
+  802018:	89 c3                	mov    %eax,%ebx
+  80201a:	83 c4 20             	add    $0x20,%esp
+  80201d:	85 c0                	test   %eax,%eax
+  80201f:	78 4e                	js     80206f <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802021:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  802026:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802029:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80202b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80202e:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802035:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802038:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80203a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80203d:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802044:	83 ec 0c             	sub    $0xc,%esp
+  802047:	ff 75 f4             	push   -0xc(%ebp)
+  80204a:	e8 ed f0 ff ff       	call   80113c <fd2num>
+  80204f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802052:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802054:	83 c4 04             	add    $0x4,%esp
+  802057:	ff 75 f0             	push   -0x10(%ebp)
+  80205a:	e8 dd f0 ff ff       	call   80113c <fd2num>
+  80205f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802062:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802065:	83 c4 10             	add    $0x10,%esp
+  802068:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80206d:	eb 2e                	jmp    80209d <pipe+0x141>
+	sys_page_unmap(0, va);
+  80206f:	83 ec 08             	sub    $0x8,%esp
+  802072:	56                   	push   %esi
+  802073:	6a 00                	push   $0x0
+  802075:	e8 5d eb ff ff       	call   800bd7 <sys_page_unmap>
+  80207a:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80207d:	83 ec 08             	sub    $0x8,%esp
+  802080:	ff 75 f0             	push   -0x10(%ebp)
+  802083:	6a 00                	push   $0x0
+  802085:	e8 4d eb ff ff       	call   800bd7 <sys_page_unmap>
+  80208a:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80208d:	83 ec 08             	sub    $0x8,%esp
+  802090:	ff 75 f4             	push   -0xc(%ebp)
+  802093:	6a 00                	push   $0x0
+  802095:	e8 3d eb ff ff       	call   800bd7 <sys_page_unmap>
+  80209a:	83 c4 10             	add    $0x10,%esp
+}
+  80209d:	89 d8                	mov    %ebx,%eax
+  80209f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020a2:	5b                   	pop    %ebx
+  8020a3:	5e                   	pop    %esi
+  8020a4:	5d                   	pop    %ebp
+  8020a5:	c3                   	ret
+
+008020a6 <pipeisclosed>:
+{
+  8020a6:	55                   	push   %ebp
+  8020a7:	89 e5                	mov    %esp,%ebp
+  8020a9:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8020ac:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020af:	50                   	push   %eax
+  8020b0:	ff 75 08             	push   0x8(%ebp)
+  8020b3:	e8 01 f1 ff ff       	call   8011b9 <fd_lookup>
+  8020b8:	83 c4 10             	add    $0x10,%esp
+  8020bb:	85 c0                	test   %eax,%eax
+  8020bd:	78 18                	js     8020d7 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8020bf:	83 ec 0c             	sub    $0xc,%esp
+  8020c2:	ff 75 f4             	push   -0xc(%ebp)
+  8020c5:	e8 82 f0 ff ff       	call   80114c <fd2data>
+  8020ca:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8020cc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020cf:	e8 33 fd ff ff       	call   801e07 <_pipeisclosed>
+  8020d4:	83 c4 10             	add    $0x10,%esp
+}
+  8020d7:	c9                   	leave
+  8020d8:	c3                   	ret
+
+008020d9 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8020d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020de:	c3                   	ret
+
+008020df <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8020df:	55                   	push   %ebp
+  8020e0:	89 e5                	mov    %esp,%ebp
+  8020e2:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8020e5:	68 17 2f 80 00       	push   $0x802f17
+  8020ea:	ff 75 0c             	push   0xc(%ebp)
+  8020ed:	e8 74 e6 ff ff       	call   800766 <strcpy>
+	return 0;
+}
+  8020f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020f7:	c9                   	leave
+  8020f8:	c3                   	ret
+
+008020f9 <devcons_write>:
+{
+  8020f9:	55                   	push   %ebp
+  8020fa:	89 e5                	mov    %esp,%ebp
+  8020fc:	57                   	push   %edi
+  8020fd:	56                   	push   %esi
+  8020fe:	53                   	push   %ebx
+  8020ff:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802105:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80210a:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802110:	eb 2e                	jmp    802140 <devcons_write+0x47>
+		m = n - tot;
+  802112:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802115:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802117:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80211c:	39 c3                	cmp    %eax,%ebx
+  80211e:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802121:	83 ec 04             	sub    $0x4,%esp
+  802124:	53                   	push   %ebx
+  802125:	89 f0                	mov    %esi,%eax
+  802127:	03 45 0c             	add    0xc(%ebp),%eax
+  80212a:	50                   	push   %eax
+  80212b:	57                   	push   %edi
+  80212c:	e8 bb e7 ff ff       	call   8008ec <memmove>
+		sys_cputs(buf, m);
+  802131:	83 c4 08             	add    $0x8,%esp
+  802134:	53                   	push   %ebx
+  802135:	57                   	push   %edi
+  802136:	e8 5b e9 ff ff       	call   800a96 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80213b:	01 de                	add    %ebx,%esi
+  80213d:	83 c4 10             	add    $0x10,%esp
+  802140:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802143:	72 cd                	jb     802112 <devcons_write+0x19>
+}
+  802145:	89 f0                	mov    %esi,%eax
+  802147:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80214a:	5b                   	pop    %ebx
+  80214b:	5e                   	pop    %esi
+  80214c:	5f                   	pop    %edi
+  80214d:	5d                   	pop    %ebp
+  80214e:	c3                   	ret
+
+0080214f <devcons_read>:
+{
+  80214f:	55                   	push   %ebp
+  802150:	89 e5                	mov    %esp,%ebp
+  802152:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802155:	b8 00 00 00 00       	mov    $0x0,%eax
+  80215a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80215e:	75 07                	jne    802167 <devcons_read+0x18>
+  802160:	eb 1f                	jmp    802181 <devcons_read+0x32>
+		sys_yield();
+  802162:	e8 cc e9 ff ff       	call   800b33 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802167:	e8 48 e9 ff ff       	call   800ab4 <sys_cgetc>
+  80216c:	85 c0                	test   %eax,%eax
+  80216e:	74 f2                	je     802162 <devcons_read+0x13>
+	if (c < 0)
+  802170:	78 0f                	js     802181 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802172:	83 f8 04             	cmp    $0x4,%eax
+  802175:	74 0c                	je     802183 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802177:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80217a:	88 02                	mov    %al,(%edx)
+	return 1;
+  80217c:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802181:	c9                   	leave
+  802182:	c3                   	ret
+		return 0;
+  802183:	b8 00 00 00 00       	mov    $0x0,%eax
+  802188:	eb f7                	jmp    802181 <devcons_read+0x32>
+
+0080218a <cputchar>:
+{
+  80218a:	55                   	push   %ebp
+  80218b:	89 e5                	mov    %esp,%ebp
+  80218d:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802190:	8b 45 08             	mov    0x8(%ebp),%eax
+  802193:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802196:	6a 01                	push   $0x1
+  802198:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80219b:	50                   	push   %eax
+  80219c:	e8 f5 e8 ff ff       	call   800a96 <sys_cputs>
+}
+  8021a1:	83 c4 10             	add    $0x10,%esp
+  8021a4:	c9                   	leave
+  8021a5:	c3                   	ret
+
+008021a6 <getchar>:
+{
+  8021a6:	55                   	push   %ebp
+  8021a7:	89 e5                	mov    %esp,%ebp
+  8021a9:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8021ac:	6a 01                	push   $0x1
+  8021ae:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8021b1:	50                   	push   %eax
+  8021b2:	6a 00                	push   $0x0
+  8021b4:	e8 66 f2 ff ff       	call   80141f <read>
+	if (r < 0)
+  8021b9:	83 c4 10             	add    $0x10,%esp
+  8021bc:	85 c0                	test   %eax,%eax
+  8021be:	78 06                	js     8021c6 <getchar+0x20>
+	if (r < 1)
+  8021c0:	74 06                	je     8021c8 <getchar+0x22>
+	return c;
+  8021c2:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8021c6:	c9                   	leave
+  8021c7:	c3                   	ret
+		return -E_EOF;
+  8021c8:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8021cd:	eb f7                	jmp    8021c6 <getchar+0x20>
+
+008021cf <iscons>:
+{
+  8021cf:	55                   	push   %ebp
+  8021d0:	89 e5                	mov    %esp,%ebp
+  8021d2:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8021d5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021d8:	50                   	push   %eax
+  8021d9:	ff 75 08             	push   0x8(%ebp)
+  8021dc:	e8 d8 ef ff ff       	call   8011b9 <fd_lookup>
+  8021e1:	83 c4 10             	add    $0x10,%esp
+  8021e4:	85 c0                	test   %eax,%eax
+  8021e6:	78 11                	js     8021f9 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8021e8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021eb:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  8021f1:	39 10                	cmp    %edx,(%eax)
+  8021f3:	0f 94 c0             	sete   %al
+  8021f6:	0f b6 c0             	movzbl %al,%eax
+}
+  8021f9:	c9                   	leave
+  8021fa:	c3                   	ret
+
+008021fb <opencons>:
+{
+  8021fb:	55                   	push   %ebp
+  8021fc:	89 e5                	mov    %esp,%ebp
+  8021fe:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802201:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802204:	50                   	push   %eax
+  802205:	e8 59 ef ff ff       	call   801163 <fd_alloc>
+  80220a:	83 c4 10             	add    $0x10,%esp
+  80220d:	85 c0                	test   %eax,%eax
+  80220f:	78 3a                	js     80224b <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802211:	83 ec 04             	sub    $0x4,%esp
+  802214:	68 07 04 00 00       	push   $0x407
+  802219:	ff 75 f4             	push   -0xc(%ebp)
+  80221c:	6a 00                	push   $0x0
+  80221e:	e8 2f e9 ff ff       	call   800b52 <sys_page_alloc>
+  802223:	83 c4 10             	add    $0x10,%esp
+  802226:	85 c0                	test   %eax,%eax
+  802228:	78 21                	js     80224b <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80222a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80222d:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  802233:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802235:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802238:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80223f:	83 ec 0c             	sub    $0xc,%esp
+  802242:	50                   	push   %eax
+  802243:	e8 f4 ee ff ff       	call   80113c <fd2num>
+  802248:	83 c4 10             	add    $0x10,%esp
+}
+  80224b:	c9                   	leave
+  80224c:	c3                   	ret
+
+0080224d <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80224d:	55                   	push   %ebp
+  80224e:	89 e5                	mov    %esp,%ebp
+  802250:	56                   	push   %esi
+  802251:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  802252:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  802255:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  80225b:	e8 b4 e8 ff ff       	call   800b14 <sys_getenvid>
+  802260:	83 ec 0c             	sub    $0xc,%esp
+  802263:	ff 75 0c             	push   0xc(%ebp)
+  802266:	ff 75 08             	push   0x8(%ebp)
+  802269:	56                   	push   %esi
+  80226a:	50                   	push   %eax
+  80226b:	68 24 2f 80 00       	push   $0x802f24
+  802270:	e8 38 df ff ff       	call   8001ad <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  802275:	83 c4 18             	add    $0x18,%esp
+  802278:	53                   	push   %ebx
+  802279:	ff 75 10             	push   0x10(%ebp)
+  80227c:	e8 db de ff ff       	call   80015c <vcprintf>
+	cprintf("\n");
+  802281:	c7 04 24 b4 29 80 00 	movl   $0x8029b4,(%esp)
+  802288:	e8 20 df ff ff       	call   8001ad <cprintf>
+  80228d:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  802290:	cc                   	int3
+	while (1)
+  802291:	eb fd                	jmp    802290 <_panic+0x43>
+
+00802293 <set_pgfault_handler>:
+// allocate an exception stack (one page of memory with its top
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf)) {
+  802293:	55                   	push   %ebp
+  802294:	89 e5                	mov    %esp,%ebp
+  802296:	83 ec 08             	sub    $0x8,%esp
+  int r;
+
+  if (_pgfault_handler == 0) {
+  802299:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  8022a0:	74 0a                	je     8022ac <set_pgfault_handler+0x19>
+    if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)))
+      panic(" set_pgfault_handler sys_env_set_pgfault_upcall panic: %e\n", r);
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  8022a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022a5:	a3 00 70 80 00       	mov    %eax,0x807000
+
+
+}
+  8022aa:	c9                   	leave
+  8022ab:	c3                   	ret
+    if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)))
+  8022ac:	83 ec 04             	sub    $0x4,%esp
+  8022af:	6a 07                	push   $0x7
+  8022b1:	68 00 f0 bf ee       	push   $0xeebff000
+  8022b6:	6a 00                	push   $0x0
+  8022b8:	e8 95 e8 ff ff       	call   800b52 <sys_page_alloc>
+  8022bd:	83 c4 10             	add    $0x10,%esp
+  8022c0:	85 c0                	test   %eax,%eax
+  8022c2:	75 28                	jne    8022ec <set_pgfault_handler+0x59>
+    if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)))
+  8022c4:	83 ec 08             	sub    $0x8,%esp
+  8022c7:	68 fe 22 80 00       	push   $0x8022fe
+  8022cc:	6a 00                	push   $0x0
+  8022ce:	e8 ca e9 ff ff       	call   800c9d <sys_env_set_pgfault_upcall>
+  8022d3:	83 c4 10             	add    $0x10,%esp
+  8022d6:	85 c0                	test   %eax,%eax
+  8022d8:	74 c8                	je     8022a2 <set_pgfault_handler+0xf>
+      panic(" set_pgfault_handler sys_env_set_pgfault_upcall panic: %e\n", r);
+  8022da:	50                   	push   %eax
+  8022db:	68 78 2f 80 00       	push   $0x802f78
+  8022e0:	6a 22                	push   $0x22
+  8022e2:	68 b3 2f 80 00       	push   $0x802fb3
+  8022e7:	e8 61 ff ff ff       	call   80224d <_panic>
+      panic("set_pgfault_handler sys_page_alloc panic: %e\n", r);
+  8022ec:	50                   	push   %eax
+  8022ed:	68 48 2f 80 00       	push   $0x802f48
+  8022f2:	6a 20                	push   $0x20
+  8022f4:	68 b3 2f 80 00       	push   $0x802fb3
+  8022f9:	e8 4f ff ff ff       	call   80224d <_panic>
+
+008022fe <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8022fe:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8022ff:	a1 00 70 80 00       	mov    0x807000,%eax
+	call *%eax
+  802304:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  802306:	83 c4 04             	add    $0x4,%esp
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	// push the trap-time %eip onto the trap-time stack
+    subl $0x4, 0x30(%esp) # for push eip
+  802309:	83 6c 24 30 04       	subl   $0x4,0x30(%esp)
+    movl 0x30(%esp), %ebx #regular esp
+  80230e:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+    movl 0x28(%esp), %eax #eip
+  802312:	8b 44 24 28          	mov    0x28(%esp),%eax
+    movl %eax, (%ebx)
+  802316:	89 03                	mov    %eax,(%ebx)
+
+    // Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+    addl $8, %esp
+  802318:	83 c4 08             	add    $0x8,%esp
+    popal
+  80231b:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  80231c:	83 c4 04             	add    $0x4,%esp
+	popfl
+  80231f:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  802320:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  802321:	c3                   	ret
+
+00802322 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  802322:	55                   	push   %ebp
+  802323:	89 e5                	mov    %esp,%ebp
+  802325:	56                   	push   %esi
+  802326:	53                   	push   %ebx
+  802327:	8b 75 08             	mov    0x8(%ebp),%esi
+  80232a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80232d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  802330:	85 c0                	test   %eax,%eax
+  802332:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802337:	0f 44 c2             	cmove  %edx,%eax
+  80233a:	83 ec 0c             	sub    $0xc,%esp
+  80233d:	50                   	push   %eax
+  80233e:	e8 bf e9 ff ff       	call   800d02 <sys_ipc_recv>
+
+  if (from_env_store)
+  802343:	83 c4 10             	add    $0x10,%esp
+  802346:	85 f6                	test   %esi,%esi
+  802348:	74 17                	je     802361 <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  80234a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80234f:	85 c0                	test   %eax,%eax
+  802351:	75 0c                	jne    80235f <ipc_recv+0x3d>
+  802353:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  802359:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  80235f:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  802361:	85 db                	test   %ebx,%ebx
+  802363:	74 2b                	je     802390 <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  802365:	85 c0                	test   %eax,%eax
+  802367:	74 0d                	je     802376 <ipc_recv+0x54>
+  802369:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  80236f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802372:	5b                   	pop    %ebx
+  802373:	5e                   	pop    %esi
+  802374:	5d                   	pop    %ebp
+  802375:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  802376:	a1 08 40 80 00       	mov    0x804008,%eax
+  80237b:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  802381:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  802383:	a1 08 40 80 00       	mov    0x804008,%eax
+  802388:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  80238e:	eb df                	jmp    80236f <ipc_recv+0x4d>
+  802390:	85 c0                	test   %eax,%eax
+  802392:	75 db                	jne    80236f <ipc_recv+0x4d>
+  802394:	eb ed                	jmp    802383 <ipc_recv+0x61>
+
+00802396 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  802396:	55                   	push   %ebp
+  802397:	89 e5                	mov    %esp,%ebp
+  802399:	57                   	push   %edi
+  80239a:	56                   	push   %esi
+  80239b:	53                   	push   %ebx
+  80239c:	83 ec 0c             	sub    $0xc,%esp
+  80239f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8023a2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8023a5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  8023a8:	85 db                	test   %ebx,%ebx
+  8023aa:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8023af:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  8023b2:	ff 75 14             	push   0x14(%ebp)
+  8023b5:	53                   	push   %ebx
+  8023b6:	56                   	push   %esi
+  8023b7:	57                   	push   %edi
+  8023b8:	e8 22 e9 ff ff       	call   800cdf <sys_ipc_try_send>
+  8023bd:	83 c4 10             	add    $0x10,%esp
+  8023c0:	85 c0                	test   %eax,%eax
+  8023c2:	74 1e                	je     8023e2 <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  8023c4:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8023c7:	75 07                	jne    8023d0 <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  8023c9:	e8 65 e7 ff ff       	call   800b33 <sys_yield>
+  8023ce:	eb e2                	jmp    8023b2 <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  8023d0:	50                   	push   %eax
+  8023d1:	68 c1 2f 80 00       	push   $0x802fc1
+  8023d6:	6a 3c                	push   $0x3c
+  8023d8:	68 ce 2f 80 00       	push   $0x802fce
+  8023dd:	e8 6b fe ff ff       	call   80224d <_panic>
+  }
+
+#endif
+}
+  8023e2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023e5:	5b                   	pop    %ebx
+  8023e6:	5e                   	pop    %esi
+  8023e7:	5f                   	pop    %edi
+  8023e8:	5d                   	pop    %ebp
+  8023e9:	c3                   	ret
+
+008023ea <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  8023ea:	55                   	push   %ebp
+  8023eb:	89 e5                	mov    %esp,%ebp
+  8023ed:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  8023f0:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  8023f5:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8023f8:	c1 e0 04             	shl    $0x4,%eax
+  8023fb:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802400:	8b 40 50             	mov    0x50(%eax),%eax
+  802403:	39 c8                	cmp    %ecx,%eax
+  802405:	74 12                	je     802419 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  802407:	83 c2 01             	add    $0x1,%edx
+  80240a:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802410:	75 e3                	jne    8023f5 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802412:	b8 00 00 00 00       	mov    $0x0,%eax
+  802417:	eb 0e                	jmp    802427 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  802419:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80241c:	c1 e0 04             	shl    $0x4,%eax
+  80241f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802424:	8b 40 48             	mov    0x48(%eax),%eax
+  802427:	5d                   	pop    %ebp
+  802428:	c3                   	ret
+
+00802429 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802429:	55                   	push   %ebp
+  80242a:	89 e5                	mov    %esp,%ebp
+  80242c:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80242f:	89 c2                	mov    %eax,%edx
+  802431:	c1 ea 16             	shr    $0x16,%edx
+  802434:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80243b:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802440:	f6 c1 01             	test   $0x1,%cl
+  802443:	74 1c                	je     802461 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  802445:	c1 e8 0c             	shr    $0xc,%eax
+  802448:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80244f:	a8 01                	test   $0x1,%al
+  802451:	74 0e                	je     802461 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802453:	c1 e8 0c             	shr    $0xc,%eax
+  802456:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  80245d:	ef 
+  80245e:	0f b7 d2             	movzwl %dx,%edx
+}
+  802461:	89 d0                	mov    %edx,%eax
+  802463:	5d                   	pop    %ebp
+  802464:	c3                   	ret
+  802465:	66 90                	xchg   %ax,%ax
+  802467:	66 90                	xchg   %ax,%ax
+  802469:	66 90                	xchg   %ax,%ax
+  80246b:	66 90                	xchg   %ax,%ax
+  80246d:	66 90                	xchg   %ax,%ax
+  80246f:	90                   	nop
+
+00802470 <__udivmoddi4>:
+  802470:	55                   	push   %ebp
+  802471:	57                   	push   %edi
+  802472:	56                   	push   %esi
+  802473:	53                   	push   %ebx
+  802474:	83 ec 24             	sub    $0x24,%esp
+  802477:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80247b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80247f:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  802483:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802487:	8b 54 24 44          	mov    0x44(%esp),%edx
+  80248b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80248f:	8b 44 24 40          	mov    0x40(%esp),%eax
+  802493:	89 d3                	mov    %edx,%ebx
+  802495:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802499:	09 c3                	or     %eax,%ebx
+  80249b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80249f:	0f 84 9c 00 00 00    	je     802541 <__udivmoddi4+0xd1>
+  8024a5:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8024ac:	00 
+  8024ad:	31 c0                	xor    %eax,%eax
+  8024af:	31 d2                	xor    %edx,%edx
+  8024b1:	89 fb                	mov    %edi,%ebx
+  8024b3:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8024ba:	00 
+  8024bb:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8024c0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8024c4:	01 c0                	add    %eax,%eax
+  8024c6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8024cd:	00 
+  8024ce:	89 c6                	mov    %eax,%esi
+  8024d0:	89 d7                	mov    %edx,%edi
+  8024d2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8024d6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8024da:	0f ad d0             	shrd   %cl,%edx,%eax
+  8024dd:	d3 ea                	shr    %cl,%edx
+  8024df:	f6 c1 20             	test   $0x20,%cl
+  8024e2:	0f 45 c2             	cmovne %edx,%eax
+  8024e5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8024e9:	83 e0 01             	and    $0x1,%eax
+  8024ec:	09 fa                	or     %edi,%edx
+  8024ee:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8024f2:	89 04 24             	mov    %eax,(%esp)
+  8024f5:	8b 04 24             	mov    (%esp),%eax
+  8024f8:	89 d5                	mov    %edx,%ebp
+  8024fa:	09 f0                	or     %esi,%eax
+  8024fc:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802500:	39 f0                	cmp    %esi,%eax
+  802502:	19 fd                	sbb    %edi,%ebp
+  802504:	72 1d                	jb     802523 <__udivmoddi4+0xb3>
+  802506:	29 f0                	sub    %esi,%eax
+  802508:	19 fa                	sbb    %edi,%edx
+  80250a:	89 cf                	mov    %ecx,%edi
+  80250c:	c1 ef 05             	shr    $0x5,%edi
+  80250f:	83 e7 01             	and    $0x1,%edi
+  802512:	89 fe                	mov    %edi,%esi
+  802514:	d3 e7                	shl    %cl,%edi
+  802516:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80251a:	83 f6 01             	xor    $0x1,%esi
+  80251d:	d3 e6                	shl    %cl,%esi
+  80251f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802523:	83 e9 01             	sub    $0x1,%ecx
+  802526:	73 98                	jae    8024c0 <__udivmoddi4+0x50>
+  802528:	85 db                	test   %ebx,%ebx
+  80252a:	74 05                	je     802531 <__udivmoddi4+0xc1>
+  80252c:	89 03                	mov    %eax,(%ebx)
+  80252e:	89 53 04             	mov    %edx,0x4(%ebx)
+  802531:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802535:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802539:	83 c4 24             	add    $0x24,%esp
+  80253c:	5b                   	pop    %ebx
+  80253d:	5e                   	pop    %esi
+  80253e:	5f                   	pop    %edi
+  80253f:	5d                   	pop    %ebp
+  802540:	c3                   	ret
+  802541:	85 ff                	test   %edi,%edi
+  802543:	74 0d                	je     802552 <__udivmoddi4+0xe2>
+  802545:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  80254b:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  802552:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802556:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80255a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80255e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802562:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802566:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80256a:	83 c4 24             	add    $0x24,%esp
+  80256d:	5b                   	pop    %ebx
+  80256e:	5e                   	pop    %esi
+  80256f:	5f                   	pop    %edi
+  802570:	5d                   	pop    %ebp
+  802571:	c3                   	ret
+  802572:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802579:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00802580 <__udivdi3>:
+  802580:	57                   	push   %edi
+  802581:	56                   	push   %esi
+  802582:	53                   	push   %ebx
+  802583:	83 ec 20             	sub    $0x20,%esp
+  802586:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80258a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80258e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802592:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802596:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80259a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80259e:	89 d1                	mov    %edx,%ecx
+  8025a0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8025a4:	09 c1                	or     %eax,%ecx
+  8025a6:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8025aa:	89 44 24 18          	mov    %eax,0x18(%esp)
+  8025ae:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  8025b2:	0f 84 88 00 00 00    	je     802640 <__udivdi3+0xc0>
+  8025b8:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8025bf:	00 
+  8025c0:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8025c5:	31 c0                	xor    %eax,%eax
+  8025c7:	31 d2                	xor    %edx,%edx
+  8025c9:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8025d0:	00 
+  8025d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8025d8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8025dc:	01 c0                	add    %eax,%eax
+  8025de:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8025e5:	00 
+  8025e6:	89 c6                	mov    %eax,%esi
+  8025e8:	89 d7                	mov    %edx,%edi
+  8025ea:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8025ee:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8025f2:	0f ad d0             	shrd   %cl,%edx,%eax
+  8025f5:	d3 ea                	shr    %cl,%edx
+  8025f7:	f6 c1 20             	test   $0x20,%cl
+  8025fa:	0f 45 c2             	cmovne %edx,%eax
+  8025fd:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802601:	83 e0 01             	and    $0x1,%eax
+  802604:	09 fa                	or     %edi,%edx
+  802606:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80260a:	89 04 24             	mov    %eax,(%esp)
+  80260d:	8b 04 24             	mov    (%esp),%eax
+  802610:	89 d3                	mov    %edx,%ebx
+  802612:	09 f0                	or     %esi,%eax
+  802614:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802618:	39 f0                	cmp    %esi,%eax
+  80261a:	19 fb                	sbb    %edi,%ebx
+  80261c:	72 1d                	jb     80263b <__udivdi3+0xbb>
+  80261e:	29 f0                	sub    %esi,%eax
+  802620:	19 fa                	sbb    %edi,%edx
+  802622:	89 cf                	mov    %ecx,%edi
+  802624:	c1 ef 05             	shr    $0x5,%edi
+  802627:	83 e7 01             	and    $0x1,%edi
+  80262a:	89 fe                	mov    %edi,%esi
+  80262c:	d3 e7                	shl    %cl,%edi
+  80262e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802632:	83 f6 01             	xor    $0x1,%esi
+  802635:	d3 e6                	shl    %cl,%esi
+  802637:	09 74 24 18          	or     %esi,0x18(%esp)
+  80263b:	83 e9 01             	sub    $0x1,%ecx
+  80263e:	73 98                	jae    8025d8 <__udivdi3+0x58>
+  802640:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802644:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802648:	83 c4 20             	add    $0x20,%esp
+  80264b:	5b                   	pop    %ebx
+  80264c:	5e                   	pop    %esi
+  80264d:	5f                   	pop    %edi
+  80264e:	c3                   	ret
+  80264f:	90                   	nop
+
+00802650 <__umoddi3>:
+  802650:	57                   	push   %edi
+  802651:	56                   	push   %esi
+  802652:	53                   	push   %ebx
+  802653:	83 ec 18             	sub    $0x18,%esp
+  802656:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80265a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80265e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802662:	8b 54 24 34          	mov    0x34(%esp),%edx
+  802666:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80266a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80266e:	89 d1                	mov    %edx,%ecx
+  802670:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802674:	09 c1                	or     %eax,%ecx
+  802676:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80267a:	74 5b                	je     8026d7 <__umoddi3+0x87>
+  80267c:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802681:	31 c0                	xor    %eax,%eax
+  802683:	31 d2                	xor    %edx,%edx
+  802685:	8d 76 00             	lea    0x0(%esi),%esi
+  802688:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80268c:	01 c0                	add    %eax,%eax
+  80268e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802695:	00 
+  802696:	89 c6                	mov    %eax,%esi
+  802698:	89 d7                	mov    %edx,%edi
+  80269a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80269e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8026a2:	0f ad d0             	shrd   %cl,%edx,%eax
+  8026a5:	d3 ea                	shr    %cl,%edx
+  8026a7:	f6 c1 20             	test   $0x20,%cl
+  8026aa:	0f 45 c2             	cmovne %edx,%eax
+  8026ad:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8026b1:	83 e0 01             	and    $0x1,%eax
+  8026b4:	09 fa                	or     %edi,%edx
+  8026b6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8026ba:	89 04 24             	mov    %eax,(%esp)
+  8026bd:	8b 04 24             	mov    (%esp),%eax
+  8026c0:	89 d3                	mov    %edx,%ebx
+  8026c2:	09 f0                	or     %esi,%eax
+  8026c4:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8026c8:	39 f0                	cmp    %esi,%eax
+  8026ca:	19 fb                	sbb    %edi,%ebx
+  8026cc:	72 04                	jb     8026d2 <__umoddi3+0x82>
+  8026ce:	29 f0                	sub    %esi,%eax
+  8026d0:	19 fa                	sbb    %edi,%edx
+  8026d2:	83 e9 01             	sub    $0x1,%ecx
+  8026d5:	73 b1                	jae    802688 <__umoddi3+0x38>
+  8026d7:	83 c4 18             	add    $0x18,%esp
+  8026da:	5b                   	pop    %ebx
+  8026db:	5e                   	pop    %esi
+  8026dc:	5f                   	pop    %edi
+  8026dd:	c3                   	ret
+  8026de:	66 90                	xchg   %ax,%ax
+
+008026e0 <__divdi3>:
+  8026e0:	55                   	push   %ebp
+  8026e1:	57                   	push   %edi
+  8026e2:	56                   	push   %esi
+  8026e3:	53                   	push   %ebx
+  8026e4:	83 ec 24             	sub    $0x24,%esp
+  8026e7:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  8026eb:	8b 74 24 44          	mov    0x44(%esp),%esi
+  8026ef:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8026f3:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8026f7:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  8026fb:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8026ff:	85 d2                	test   %edx,%edx
+  802701:	0f 88 e0 00 00 00    	js     8027e7 <__divdi3+0x107>
+  802707:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  80270b:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  80270f:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802713:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802717:	85 f6                	test   %esi,%esi
+  802719:	78 16                	js     802731 <__divdi3+0x51>
+  80271b:	89 f1                	mov    %esi,%ecx
+  80271d:	31 c0                	xor    %eax,%eax
+  80271f:	31 d2                	xor    %edx,%edx
+  802721:	09 d9                	or     %ebx,%ecx
+  802723:	0f 85 f3 00 00 00    	jne    80281c <__divdi3+0x13c>
+  802729:	83 c4 24             	add    $0x24,%esp
+  80272c:	5b                   	pop    %ebx
+  80272d:	5e                   	pop    %esi
+  80272e:	5f                   	pop    %edi
+  80272f:	5d                   	pop    %ebp
+  802730:	c3                   	ret
+  802731:	bf 01 00 00 00       	mov    $0x1,%edi
+  802736:	f7 5c 24 08          	negl   0x8(%esp)
+  80273a:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  80273f:	f7 5c 24 0c          	negl   0xc(%esp)
+  802743:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80274a:	00 
+  80274b:	31 c0                	xor    %eax,%eax
+  80274d:	31 d2                	xor    %edx,%edx
+  80274f:	89 fb                	mov    %edi,%ebx
+  802751:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802758:	00 
+  802759:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80275e:	66 90                	xchg   %ax,%ax
+  802760:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802764:	01 c0                	add    %eax,%eax
+  802766:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80276d:	00 
+  80276e:	89 c6                	mov    %eax,%esi
+  802770:	89 d7                	mov    %edx,%edi
+  802772:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802776:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80277a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80277d:	d3 ea                	shr    %cl,%edx
+  80277f:	f6 c1 20             	test   $0x20,%cl
+  802782:	0f 45 c2             	cmovne %edx,%eax
+  802785:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802789:	83 e0 01             	and    $0x1,%eax
+  80278c:	09 fa                	or     %edi,%edx
+  80278e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802792:	89 04 24             	mov    %eax,(%esp)
+  802795:	8b 04 24             	mov    (%esp),%eax
+  802798:	89 d5                	mov    %edx,%ebp
+  80279a:	09 f0                	or     %esi,%eax
+  80279c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8027a0:	39 f0                	cmp    %esi,%eax
+  8027a2:	19 fd                	sbb    %edi,%ebp
+  8027a4:	72 1d                	jb     8027c3 <__divdi3+0xe3>
+  8027a6:	29 f0                	sub    %esi,%eax
+  8027a8:	19 fa                	sbb    %edi,%edx
+  8027aa:	89 cf                	mov    %ecx,%edi
+  8027ac:	c1 ef 05             	shr    $0x5,%edi
+  8027af:	83 e7 01             	and    $0x1,%edi
+  8027b2:	89 fe                	mov    %edi,%esi
+  8027b4:	d3 e7                	shl    %cl,%edi
+  8027b6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8027ba:	83 f6 01             	xor    $0x1,%esi
+  8027bd:	d3 e6                	shl    %cl,%esi
+  8027bf:	09 74 24 18          	or     %esi,0x18(%esp)
+  8027c3:	83 e9 01             	sub    $0x1,%ecx
+  8027c6:	73 98                	jae    802760 <__divdi3+0x80>
+  8027c8:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8027cc:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8027d0:	85 db                	test   %ebx,%ebx
+  8027d2:	0f 84 51 ff ff ff    	je     802729 <__divdi3+0x49>
+  8027d8:	f7 d8                	neg    %eax
+  8027da:	83 d2 00             	adc    $0x0,%edx
+  8027dd:	83 c4 24             	add    $0x24,%esp
+  8027e0:	5b                   	pop    %ebx
+  8027e1:	f7 da                	neg    %edx
+  8027e3:	5e                   	pop    %esi
+  8027e4:	5f                   	pop    %edi
+  8027e5:	5d                   	pop    %ebp
+  8027e6:	c3                   	ret
+  8027e7:	f7 d8                	neg    %eax
+  8027e9:	83 d2 00             	adc    $0x0,%edx
+  8027ec:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8027f0:	f7 da                	neg    %edx
+  8027f2:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8027f6:	85 f6                	test   %esi,%esi
+  8027f8:	78 1b                	js     802815 <__divdi3+0x135>
+  8027fa:	89 f1                	mov    %esi,%ecx
+  8027fc:	31 c0                	xor    %eax,%eax
+  8027fe:	31 d2                	xor    %edx,%edx
+  802800:	bf 01 00 00 00       	mov    $0x1,%edi
+  802805:	09 d9                	or     %ebx,%ecx
+  802807:	0f 85 36 ff ff ff    	jne    802743 <__divdi3+0x63>
+  80280d:	83 c4 24             	add    $0x24,%esp
+  802810:	5b                   	pop    %ebx
+  802811:	5e                   	pop    %esi
+  802812:	5f                   	pop    %edi
+  802813:	5d                   	pop    %ebp
+  802814:	c3                   	ret
+  802815:	31 ff                	xor    %edi,%edi
+  802817:	e9 1a ff ff ff       	jmp    802736 <__divdi3+0x56>
+  80281c:	31 ff                	xor    %edi,%edi
+  80281e:	e9 20 ff ff ff       	jmp    802743 <__divdi3+0x63>
+  802823:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80282a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00802830 <__moddi3>:
+  802830:	55                   	push   %ebp
+  802831:	57                   	push   %edi
+  802832:	56                   	push   %esi
+  802833:	53                   	push   %ebx
+  802834:	83 ec 1c             	sub    $0x1c,%esp
+  802837:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  80283b:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  80283f:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  802843:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  802847:	89 c8                	mov    %ecx,%eax
+  802849:	89 f2                	mov    %esi,%edx
+  80284b:	89 f3                	mov    %esi,%ebx
+  80284d:	85 ed                	test   %ebp,%ebp
+  80284f:	0f 88 9d 00 00 00    	js     8028f2 <__moddi3+0xc2>
+  802855:	09 cb                	or     %ecx,%ebx
+  802857:	0f 84 8d 00 00 00    	je     8028ea <__moddi3+0xba>
+  80285d:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802861:	31 db                	xor    %ebx,%ebx
+  802863:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802867:	89 ca                	mov    %ecx,%edx
+  802869:	89 f0                	mov    %esi,%eax
+  80286b:	89 dd                	mov    %ebx,%ebp
+  80286d:	f7 da                	neg    %edx
+  80286f:	83 d0 00             	adc    $0x0,%eax
+  802872:	f7 d8                	neg    %eax
+  802874:	0f 49 f0             	cmovns %eax,%esi
+  802877:	0f 49 ca             	cmovns %edx,%ecx
+  80287a:	31 c0                	xor    %eax,%eax
+  80287c:	31 d2                	xor    %edx,%edx
+  80287e:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802882:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802886:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80288b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80288f:	90                   	nop
+  802890:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802894:	01 c0                	add    %eax,%eax
+  802896:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80289d:	00 
+  80289e:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  8028a2:	89 c6                	mov    %eax,%esi
+  8028a4:	89 d7                	mov    %edx,%edi
+  8028a6:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8028aa:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8028ae:	0f ad d0             	shrd   %cl,%edx,%eax
+  8028b1:	d3 ea                	shr    %cl,%edx
+  8028b3:	f6 c1 20             	test   $0x20,%cl
+  8028b6:	0f 45 c2             	cmovne %edx,%eax
+  8028b9:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8028bd:	83 e0 01             	and    $0x1,%eax
+  8028c0:	09 fa                	or     %edi,%edx
+  8028c2:	89 04 24             	mov    %eax,(%esp)
+  8028c5:	8b 04 24             	mov    (%esp),%eax
+  8028c8:	89 d7                	mov    %edx,%edi
+  8028ca:	09 f0                	or     %esi,%eax
+  8028cc:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  8028d0:	39 d8                	cmp    %ebx,%eax
+  8028d2:	19 f7                	sbb    %esi,%edi
+  8028d4:	72 04                	jb     8028da <__moddi3+0xaa>
+  8028d6:	29 d8                	sub    %ebx,%eax
+  8028d8:	19 f2                	sbb    %esi,%edx
+  8028da:	83 e9 01             	sub    $0x1,%ecx
+  8028dd:	73 b1                	jae    802890 <__moddi3+0x60>
+  8028df:	85 ed                	test   %ebp,%ebp
+  8028e1:	74 07                	je     8028ea <__moddi3+0xba>
+  8028e3:	f7 d8                	neg    %eax
+  8028e5:	83 d2 00             	adc    $0x0,%edx
+  8028e8:	f7 da                	neg    %edx
+  8028ea:	83 c4 1c             	add    $0x1c,%esp
+  8028ed:	5b                   	pop    %ebx
+  8028ee:	5e                   	pop    %esi
+  8028ef:	5f                   	pop    %edi
+  8028f0:	5d                   	pop    %ebp
+  8028f1:	c3                   	ret
+  8028f2:	09 cb                	or     %ecx,%ebx
+  8028f4:	74 f4                	je     8028ea <__moddi3+0xba>
+  8028f6:	f7 df                	neg    %edi
+  8028f8:	bb 01 00 00 00       	mov    $0x1,%ebx
+  8028fd:	83 d5 00             	adc    $0x0,%ebp
+  802900:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802904:	f7 dd                	neg    %ebp
+  802906:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  80290a:	e9 58 ff ff ff       	jmp    802867 <__moddi3+0x37>
@@ -0,0 +1,5796 @@
+
+obj/user/stresssched.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 ba 00 00 00       	call   8000eb <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+volatile int counter;
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+	int i, j;
+	int seen;
+	envid_t parent = sys_getenvid();
+  800038:	e8 53 0b 00 00       	call   800b90 <sys_getenvid>
+  80003d:	89 c6                	mov    %eax,%esi
+
+	// Fork several environments
+	for (i = 0; i < 20; i++)
+  80003f:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (fork() == 0)
+  800044:	e8 53 0f 00 00       	call   800f9c <fork>
+  800049:	85 c0                	test   %eax,%eax
+  80004b:	74 0f                	je     80005c <umain+0x29>
+	for (i = 0; i < 20; i++)
+  80004d:	83 c3 01             	add    $0x1,%ebx
+  800050:	83 fb 14             	cmp    $0x14,%ebx
+  800053:	75 ef                	jne    800044 <umain+0x11>
+			break;
+	if (i == 20) {
+		sys_yield();
+  800055:	e8 55 0b 00 00       	call   800baf <sys_yield>
+		return;
+  80005a:	eb 71                	jmp    8000cd <umain+0x9a>
+	}
+
+	// Wait for the parent to finish forking
+	while (envs[ENVX(parent)].env_status != ENV_FREE)
+  80005c:	89 f0                	mov    %esi,%eax
+  80005e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800063:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  800066:	c1 e2 04             	shl    $0x4,%edx
+  800069:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80006f:	eb 02                	jmp    800073 <umain+0x40>
+		asm volatile("pause");
+  800071:	f3 90                	pause
+	while (envs[ENVX(parent)].env_status != ENV_FREE)
+  800073:	8b 42 54             	mov    0x54(%edx),%eax
+  800076:	85 c0                	test   %eax,%eax
+  800078:	75 f7                	jne    800071 <umain+0x3e>
+  80007a:	bb 0b 00 00 00       	mov    $0xb,%ebx
+  80007f:	eb 12                	jmp    800093 <umain+0x60>
+
+	// Check that one environment doesn't run on two CPUs at once
+	for (i = 0; i < 10; i++) {
+		sys_yield();
+		for (j = 0; j < 10000; j++)
+			counter++;
+  800081:	a1 08 40 80 00       	mov    0x804008,%eax
+  800086:	83 c0 01             	add    $0x1,%eax
+  800089:	a3 08 40 80 00       	mov    %eax,0x804008
+		for (j = 0; j < 10000; j++)
+  80008e:	83 ea 01             	sub    $0x1,%edx
+  800091:	75 ee                	jne    800081 <umain+0x4e>
+	for (i = 0; i < 10; i++) {
+  800093:	83 eb 01             	sub    $0x1,%ebx
+  800096:	74 0c                	je     8000a4 <umain+0x71>
+		sys_yield();
+  800098:	e8 12 0b 00 00       	call   800baf <sys_yield>
+		for (j = 0; j < 10000; j++)
+  80009d:	ba 11 27 00 00       	mov    $0x2711,%edx
+  8000a2:	eb ea                	jmp    80008e <umain+0x5b>
+	}
+
+	if (counter != 10*10000)
+  8000a4:	a1 08 40 80 00       	mov    0x804008,%eax
+  8000a9:	3d a0 86 01 00       	cmp    $0x186a0,%eax
+  8000ae:	75 24                	jne    8000d4 <umain+0xa1>
+		panic("ran on two CPUs at once (counter is %d)", counter);
+
+	// Check that we see environments running on different CPUs
+	cprintf("[%08x] stresssched on CPU %d\n", thisenv->env_id, thisenv->env_cpunum);
+  8000b0:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  8000b5:	8b 50 5c             	mov    0x5c(%eax),%edx
+  8000b8:	8b 40 48             	mov    0x48(%eax),%eax
+  8000bb:	83 ec 04             	sub    $0x4,%esp
+  8000be:	52                   	push   %edx
+  8000bf:	50                   	push   %eax
+  8000c0:	68 7b 29 80 00       	push   $0x80297b
+  8000c5:	e8 5f 01 00 00       	call   800229 <cprintf>
+  8000ca:	83 c4 10             	add    $0x10,%esp
+
+}
+  8000cd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000d0:	5b                   	pop    %ebx
+  8000d1:	5e                   	pop    %esi
+  8000d2:	5d                   	pop    %ebp
+  8000d3:	c3                   	ret
+		panic("ran on two CPUs at once (counter is %d)", counter);
+  8000d4:	a1 08 40 80 00       	mov    0x804008,%eax
+  8000d9:	50                   	push   %eax
+  8000da:	68 40 29 80 00       	push   $0x802940
+  8000df:	6a 21                	push   $0x21
+  8000e1:	68 68 29 80 00       	push   $0x802968
+  8000e6:	e8 63 00 00 00       	call   80014e <_panic>
+
+008000eb <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  8000eb:	55                   	push   %ebp
+  8000ec:	89 e5                	mov    %esp,%ebp
+  8000ee:	56                   	push   %esi
+  8000ef:	53                   	push   %ebx
+  8000f0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000f3:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  8000f6:	e8 95 0a 00 00       	call   800b90 <sys_getenvid>
+  8000fb:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800100:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800103:	c1 e0 04             	shl    $0x4,%eax
+  800106:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80010b:	a3 0c 40 80 00       	mov    %eax,0x80400c
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800110:	85 db                	test   %ebx,%ebx
+  800112:	7e 07                	jle    80011b <libmain+0x30>
+    binaryname = argv[0];
+  800114:	8b 06                	mov    (%esi),%eax
+  800116:	a3 00 30 80 00       	mov    %eax,0x803000
+
+  // call user main routine
+  umain(argc, argv);
+  80011b:	83 ec 08             	sub    $0x8,%esp
+  80011e:	56                   	push   %esi
+  80011f:	53                   	push   %ebx
+  800120:	e8 0e ff ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  800125:	e8 0a 00 00 00       	call   800134 <exit>
+}
+  80012a:	83 c4 10             	add    $0x10,%esp
+  80012d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800130:	5b                   	pop    %ebx
+  800131:	5e                   	pop    %esi
+  800132:	5d                   	pop    %ebp
+  800133:	c3                   	ret
+
+00800134 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800134:	55                   	push   %ebp
+  800135:	89 e5                	mov    %esp,%ebp
+  800137:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80013a:	e8 4d 12 00 00       	call   80138c <close_all>
+	sys_env_destroy(0);
+  80013f:	83 ec 0c             	sub    $0xc,%esp
+  800142:	6a 00                	push   $0x0
+  800144:	e8 06 0a 00 00       	call   800b4f <sys_env_destroy>
+}
+  800149:	83 c4 10             	add    $0x10,%esp
+  80014c:	c9                   	leave
+  80014d:	c3                   	ret
+
+0080014e <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80014e:	55                   	push   %ebp
+  80014f:	89 e5                	mov    %esp,%ebp
+  800151:	56                   	push   %esi
+  800152:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800153:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800156:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  80015c:	e8 2f 0a 00 00       	call   800b90 <sys_getenvid>
+  800161:	83 ec 0c             	sub    $0xc,%esp
+  800164:	ff 75 0c             	push   0xc(%ebp)
+  800167:	ff 75 08             	push   0x8(%ebp)
+  80016a:	56                   	push   %esi
+  80016b:	50                   	push   %eax
+  80016c:	68 a4 29 80 00       	push   $0x8029a4
+  800171:	e8 b3 00 00 00       	call   800229 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800176:	83 c4 18             	add    $0x18,%esp
+  800179:	53                   	push   %ebx
+  80017a:	ff 75 10             	push   0x10(%ebp)
+  80017d:	e8 56 00 00 00       	call   8001d8 <vcprintf>
+	cprintf("\n");
+  800182:	c7 04 24 97 29 80 00 	movl   $0x802997,(%esp)
+  800189:	e8 9b 00 00 00       	call   800229 <cprintf>
+  80018e:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800191:	cc                   	int3
+	while (1)
+  800192:	eb fd                	jmp    800191 <_panic+0x43>
+
+00800194 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800194:	55                   	push   %ebp
+  800195:	89 e5                	mov    %esp,%ebp
+  800197:	53                   	push   %ebx
+  800198:	83 ec 04             	sub    $0x4,%esp
+  80019b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80019e:	8b 13                	mov    (%ebx),%edx
+  8001a0:	8d 42 01             	lea    0x1(%edx),%eax
+  8001a3:	89 03                	mov    %eax,(%ebx)
+  8001a5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001a8:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8001ac:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001b1:	74 09                	je     8001bc <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001b3:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001b7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001ba:	c9                   	leave
+  8001bb:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8001bc:	83 ec 08             	sub    $0x8,%esp
+  8001bf:	68 ff 00 00 00       	push   $0xff
+  8001c4:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001c7:	50                   	push   %eax
+  8001c8:	e8 45 09 00 00       	call   800b12 <sys_cputs>
+		b->idx = 0;
+  8001cd:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001d3:	83 c4 10             	add    $0x10,%esp
+  8001d6:	eb db                	jmp    8001b3 <putch+0x1f>
+
+008001d8 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001d8:	55                   	push   %ebp
+  8001d9:	89 e5                	mov    %esp,%ebp
+  8001db:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001e1:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001e8:	00 00 00 
+	b.cnt = 0;
+  8001eb:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001f2:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001f5:	ff 75 0c             	push   0xc(%ebp)
+  8001f8:	ff 75 08             	push   0x8(%ebp)
+  8001fb:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800201:	50                   	push   %eax
+  800202:	68 94 01 80 00       	push   $0x800194
+  800207:	e8 14 01 00 00       	call   800320 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80020c:	83 c4 08             	add    $0x8,%esp
+  80020f:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800215:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80021b:	50                   	push   %eax
+  80021c:	e8 f1 08 00 00       	call   800b12 <sys_cputs>
+
+	return b.cnt;
+}
+  800221:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800227:	c9                   	leave
+  800228:	c3                   	ret
+
+00800229 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800229:	55                   	push   %ebp
+  80022a:	89 e5                	mov    %esp,%ebp
+  80022c:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80022f:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800232:	50                   	push   %eax
+  800233:	ff 75 08             	push   0x8(%ebp)
+  800236:	e8 9d ff ff ff       	call   8001d8 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80023b:	c9                   	leave
+  80023c:	c3                   	ret
+
+0080023d <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80023d:	55                   	push   %ebp
+  80023e:	89 e5                	mov    %esp,%ebp
+  800240:	57                   	push   %edi
+  800241:	56                   	push   %esi
+  800242:	53                   	push   %ebx
+  800243:	83 ec 1c             	sub    $0x1c,%esp
+  800246:	89 c7                	mov    %eax,%edi
+  800248:	89 d6                	mov    %edx,%esi
+  80024a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80024d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800250:	89 d1                	mov    %edx,%ecx
+  800252:	89 c2                	mov    %eax,%edx
+  800254:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800257:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80025a:	8b 45 10             	mov    0x10(%ebp),%eax
+  80025d:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800260:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800263:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80026a:	39 c2                	cmp    %eax,%edx
+  80026c:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80026f:	72 3e                	jb     8002af <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800271:	83 ec 0c             	sub    $0xc,%esp
+  800274:	ff 75 18             	push   0x18(%ebp)
+  800277:	83 eb 01             	sub    $0x1,%ebx
+  80027a:	53                   	push   %ebx
+  80027b:	50                   	push   %eax
+  80027c:	83 ec 08             	sub    $0x8,%esp
+  80027f:	ff 75 e4             	push   -0x1c(%ebp)
+  800282:	ff 75 e0             	push   -0x20(%ebp)
+  800285:	ff 75 dc             	push   -0x24(%ebp)
+  800288:	ff 75 d8             	push   -0x28(%ebp)
+  80028b:	e8 20 23 00 00       	call   8025b0 <__udivdi3>
+  800290:	83 c4 18             	add    $0x18,%esp
+  800293:	52                   	push   %edx
+  800294:	50                   	push   %eax
+  800295:	89 f2                	mov    %esi,%edx
+  800297:	89 f8                	mov    %edi,%eax
+  800299:	e8 9f ff ff ff       	call   80023d <printnum>
+  80029e:	83 c4 20             	add    $0x20,%esp
+  8002a1:	eb 13                	jmp    8002b6 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8002a3:	83 ec 08             	sub    $0x8,%esp
+  8002a6:	56                   	push   %esi
+  8002a7:	ff 75 18             	push   0x18(%ebp)
+  8002aa:	ff d7                	call   *%edi
+  8002ac:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8002af:	83 eb 01             	sub    $0x1,%ebx
+  8002b2:	85 db                	test   %ebx,%ebx
+  8002b4:	7f ed                	jg     8002a3 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8002b6:	83 ec 08             	sub    $0x8,%esp
+  8002b9:	56                   	push   %esi
+  8002ba:	83 ec 04             	sub    $0x4,%esp
+  8002bd:	ff 75 e4             	push   -0x1c(%ebp)
+  8002c0:	ff 75 e0             	push   -0x20(%ebp)
+  8002c3:	ff 75 dc             	push   -0x24(%ebp)
+  8002c6:	ff 75 d8             	push   -0x28(%ebp)
+  8002c9:	e8 b2 23 00 00       	call   802680 <__umoddi3>
+  8002ce:	83 c4 14             	add    $0x14,%esp
+  8002d1:	0f be 80 c7 29 80 00 	movsbl 0x8029c7(%eax),%eax
+  8002d8:	50                   	push   %eax
+  8002d9:	ff d7                	call   *%edi
+}
+  8002db:	83 c4 10             	add    $0x10,%esp
+  8002de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002e1:	5b                   	pop    %ebx
+  8002e2:	5e                   	pop    %esi
+  8002e3:	5f                   	pop    %edi
+  8002e4:	5d                   	pop    %ebp
+  8002e5:	c3                   	ret
+
+008002e6 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002e6:	55                   	push   %ebp
+  8002e7:	89 e5                	mov    %esp,%ebp
+  8002e9:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8002ec:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002f0:	8b 10                	mov    (%eax),%edx
+  8002f2:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002f5:	73 0a                	jae    800301 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8002f7:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002fa:	89 08                	mov    %ecx,(%eax)
+  8002fc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002ff:	88 02                	mov    %al,(%edx)
+}
+  800301:	5d                   	pop    %ebp
+  800302:	c3                   	ret
+
+00800303 <printfmt>:
+{
+  800303:	55                   	push   %ebp
+  800304:	89 e5                	mov    %esp,%ebp
+  800306:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800309:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80030c:	50                   	push   %eax
+  80030d:	ff 75 10             	push   0x10(%ebp)
+  800310:	ff 75 0c             	push   0xc(%ebp)
+  800313:	ff 75 08             	push   0x8(%ebp)
+  800316:	e8 05 00 00 00       	call   800320 <vprintfmt>
+}
+  80031b:	83 c4 10             	add    $0x10,%esp
+  80031e:	c9                   	leave
+  80031f:	c3                   	ret
+
+00800320 <vprintfmt>:
+{
+  800320:	55                   	push   %ebp
+  800321:	89 e5                	mov    %esp,%ebp
+  800323:	57                   	push   %edi
+  800324:	56                   	push   %esi
+  800325:	53                   	push   %ebx
+  800326:	83 ec 2c             	sub    $0x2c,%esp
+  800329:	8b 75 08             	mov    0x8(%ebp),%esi
+  80032c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80032f:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800332:	eb 0a                	jmp    80033e <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800334:	83 ec 08             	sub    $0x8,%esp
+  800337:	53                   	push   %ebx
+  800338:	50                   	push   %eax
+  800339:	ff d6                	call   *%esi
+  80033b:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80033e:	83 c7 01             	add    $0x1,%edi
+  800341:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800345:	83 f8 25             	cmp    $0x25,%eax
+  800348:	74 0c                	je     800356 <vprintfmt+0x36>
+			if (ch == '\0')
+  80034a:	85 c0                	test   %eax,%eax
+  80034c:	75 e6                	jne    800334 <vprintfmt+0x14>
+}
+  80034e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800351:	5b                   	pop    %ebx
+  800352:	5e                   	pop    %esi
+  800353:	5f                   	pop    %edi
+  800354:	5d                   	pop    %ebp
+  800355:	c3                   	ret
+		padc = ' ';
+  800356:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80035a:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800361:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800368:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80036f:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800374:	8d 47 01             	lea    0x1(%edi),%eax
+  800377:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80037a:	0f b6 17             	movzbl (%edi),%edx
+  80037d:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800380:	3c 55                	cmp    $0x55,%al
+  800382:	0f 87 9a 03 00 00    	ja     800722 <vprintfmt+0x402>
+  800388:	0f b6 c0             	movzbl %al,%eax
+  80038b:	ff 24 85 00 2b 80 00 	jmp    *0x802b00(,%eax,4)
+  800392:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800395:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800399:	eb d9                	jmp    800374 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80039b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80039e:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8003a2:	eb d0                	jmp    800374 <vprintfmt+0x54>
+  8003a4:	0f b6 d2             	movzbl %dl,%edx
+  8003a7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8003aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003af:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8003b2:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003b5:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8003b9:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8003bc:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8003bf:	83 f9 09             	cmp    $0x9,%ecx
+  8003c2:	77 55                	ja     800419 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8003c4:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8003c7:	eb e9                	jmp    8003b2 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8003c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003cc:	8b 00                	mov    (%eax),%eax
+  8003ce:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003d4:	8d 40 04             	lea    0x4(%eax),%eax
+  8003d7:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003da:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8003dd:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003e1:	79 91                	jns    800374 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8003e3:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003e6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003e9:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003f0:	eb 82                	jmp    800374 <vprintfmt+0x54>
+			if (width < 0)
+  8003f2:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003f5:	85 d2                	test   %edx,%edx
+  8003f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003fc:	0f 49 c2             	cmovns %edx,%eax
+  8003ff:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800402:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800405:	e9 6a ff ff ff       	jmp    800374 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80040a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80040d:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800414:	e9 5b ff ff ff       	jmp    800374 <vprintfmt+0x54>
+  800419:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80041c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80041f:	eb bc                	jmp    8003dd <vprintfmt+0xbd>
+			lflag++;
+  800421:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800424:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800427:	e9 48 ff ff ff       	jmp    800374 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80042c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80042f:	8d 78 04             	lea    0x4(%eax),%edi
+  800432:	83 ec 08             	sub    $0x8,%esp
+  800435:	53                   	push   %ebx
+  800436:	ff 30                	push   (%eax)
+  800438:	ff d6                	call   *%esi
+			break;
+  80043a:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80043d:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800440:	e9 7c 02 00 00       	jmp    8006c1 <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  800445:	8b 45 14             	mov    0x14(%ebp),%eax
+  800448:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80044b:	8b 10                	mov    (%eax),%edx
+  80044d:	89 d0                	mov    %edx,%eax
+  80044f:	f7 d8                	neg    %eax
+  800451:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800454:	83 f8 10             	cmp    $0x10,%eax
+  800457:	7f 23                	jg     80047c <vprintfmt+0x15c>
+  800459:	8b 14 85 60 2c 80 00 	mov    0x802c60(,%eax,4),%edx
+  800460:	85 d2                	test   %edx,%edx
+  800462:	74 18                	je     80047c <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800464:	52                   	push   %edx
+  800465:	68 a5 2e 80 00       	push   $0x802ea5
+  80046a:	53                   	push   %ebx
+  80046b:	56                   	push   %esi
+  80046c:	e8 92 fe ff ff       	call   800303 <printfmt>
+  800471:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800474:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800477:	e9 45 02 00 00       	jmp    8006c1 <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  80047c:	50                   	push   %eax
+  80047d:	68 df 29 80 00       	push   $0x8029df
+  800482:	53                   	push   %ebx
+  800483:	56                   	push   %esi
+  800484:	e8 7a fe ff ff       	call   800303 <printfmt>
+  800489:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80048c:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80048f:	e9 2d 02 00 00       	jmp    8006c1 <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800494:	8b 45 14             	mov    0x14(%ebp),%eax
+  800497:	83 c0 04             	add    $0x4,%eax
+  80049a:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80049d:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004a0:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8004a2:	85 c9                	test   %ecx,%ecx
+  8004a4:	b8 d8 29 80 00       	mov    $0x8029d8,%eax
+  8004a9:	0f 45 c1             	cmovne %ecx,%eax
+  8004ac:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8004af:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004b3:	7e 06                	jle    8004bb <vprintfmt+0x19b>
+  8004b5:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8004b9:	75 0b                	jne    8004c6 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004bb:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8004be:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8004c1:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004c4:	eb 5c                	jmp    800522 <vprintfmt+0x202>
+  8004c6:	83 ec 08             	sub    $0x8,%esp
+  8004c9:	ff 75 d0             	push   -0x30(%ebp)
+  8004cc:	ff 75 cc             	push   -0x34(%ebp)
+  8004cf:	e8 eb 02 00 00       	call   8007bf <strnlen>
+  8004d4:	89 c2                	mov    %eax,%edx
+  8004d6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004d9:	29 d0                	sub    %edx,%eax
+  8004db:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8004de:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004e2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004e5:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004e8:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004ea:	eb 0e                	jmp    8004fa <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8004ec:	83 ec 08             	sub    $0x8,%esp
+  8004ef:	53                   	push   %ebx
+  8004f0:	57                   	push   %edi
+  8004f1:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004f4:	83 ee 01             	sub    $0x1,%esi
+  8004f7:	83 c4 10             	add    $0x10,%esp
+  8004fa:	85 f6                	test   %esi,%esi
+  8004fc:	7f ee                	jg     8004ec <vprintfmt+0x1cc>
+  8004fe:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800501:	8b 75 08             	mov    0x8(%ebp),%esi
+  800504:	85 c0                	test   %eax,%eax
+  800506:	ba 00 00 00 00       	mov    $0x0,%edx
+  80050b:	0f 49 d0             	cmovns %eax,%edx
+  80050e:	29 d0                	sub    %edx,%eax
+  800510:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800513:	eb a6                	jmp    8004bb <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800515:	83 ec 08             	sub    $0x8,%esp
+  800518:	53                   	push   %ebx
+  800519:	52                   	push   %edx
+  80051a:	ff 55 08             	call   *0x8(%ebp)
+  80051d:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800520:	89 f1                	mov    %esi,%ecx
+  800522:	8d 71 01             	lea    0x1(%ecx),%esi
+  800525:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800529:	0f be d0             	movsbl %al,%edx
+  80052c:	85 d2                	test   %edx,%edx
+  80052e:	74 28                	je     800558 <vprintfmt+0x238>
+  800530:	85 ff                	test   %edi,%edi
+  800532:	78 05                	js     800539 <vprintfmt+0x219>
+  800534:	83 ef 01             	sub    $0x1,%edi
+  800537:	78 30                	js     800569 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800539:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80053d:	74 d6                	je     800515 <vprintfmt+0x1f5>
+  80053f:	0f be c0             	movsbl %al,%eax
+  800542:	83 e8 20             	sub    $0x20,%eax
+  800545:	83 f8 5e             	cmp    $0x5e,%eax
+  800548:	76 cb                	jbe    800515 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80054a:	83 ec 08             	sub    $0x8,%esp
+  80054d:	53                   	push   %ebx
+  80054e:	6a 3f                	push   $0x3f
+  800550:	ff 55 08             	call   *0x8(%ebp)
+  800553:	83 c4 10             	add    $0x10,%esp
+  800556:	eb c8                	jmp    800520 <vprintfmt+0x200>
+  800558:	8b 75 08             	mov    0x8(%ebp),%esi
+  80055b:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80055e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800561:	01 d0                	add    %edx,%eax
+  800563:	29 c8                	sub    %ecx,%eax
+  800565:	89 c7                	mov    %eax,%edi
+  800567:	eb 13                	jmp    80057c <vprintfmt+0x25c>
+  800569:	8b 75 08             	mov    0x8(%ebp),%esi
+  80056c:	eb ed                	jmp    80055b <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80056e:	83 ec 08             	sub    $0x8,%esp
+  800571:	53                   	push   %ebx
+  800572:	6a 20                	push   $0x20
+  800574:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800576:	83 ef 01             	sub    $0x1,%edi
+  800579:	83 c4 10             	add    $0x10,%esp
+  80057c:	85 ff                	test   %edi,%edi
+  80057e:	7f ee                	jg     80056e <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800580:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800583:	89 45 14             	mov    %eax,0x14(%ebp)
+  800586:	e9 36 01 00 00       	jmp    8006c1 <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  80058b:	83 f9 01             	cmp    $0x1,%ecx
+  80058e:	7f 1f                	jg     8005af <vprintfmt+0x28f>
+	else if (lflag)
+  800590:	85 c9                	test   %ecx,%ecx
+  800592:	74 67                	je     8005fb <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800594:	8b 45 14             	mov    0x14(%ebp),%eax
+  800597:	8b 00                	mov    (%eax),%eax
+  800599:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80059c:	89 c1                	mov    %eax,%ecx
+  80059e:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005a1:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005a4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a7:	8d 40 04             	lea    0x4(%eax),%eax
+  8005aa:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005ad:	eb 17                	jmp    8005c6 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8005af:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b2:	8b 50 04             	mov    0x4(%eax),%edx
+  8005b5:	8b 00                	mov    (%eax),%eax
+  8005b7:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005ba:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c0:	8d 40 08             	lea    0x8(%eax),%eax
+  8005c3:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8005c6:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005c9:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8005cc:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8005d1:	85 c9                	test   %ecx,%ecx
+  8005d3:	0f 89 ce 00 00 00    	jns    8006a7 <vprintfmt+0x387>
+				putch('-', putdat);
+  8005d9:	83 ec 08             	sub    $0x8,%esp
+  8005dc:	53                   	push   %ebx
+  8005dd:	6a 2d                	push   $0x2d
+  8005df:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8005e1:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005e4:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005e7:	f7 da                	neg    %edx
+  8005e9:	83 d1 00             	adc    $0x0,%ecx
+  8005ec:	f7 d9                	neg    %ecx
+  8005ee:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8005f1:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005f6:	e9 ac 00 00 00       	jmp    8006a7 <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  8005fb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005fe:	8b 00                	mov    (%eax),%eax
+  800600:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800603:	89 c1                	mov    %eax,%ecx
+  800605:	c1 f9 1f             	sar    $0x1f,%ecx
+  800608:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80060b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060e:	8d 40 04             	lea    0x4(%eax),%eax
+  800611:	89 45 14             	mov    %eax,0x14(%ebp)
+  800614:	eb b0                	jmp    8005c6 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800616:	83 f9 01             	cmp    $0x1,%ecx
+  800619:	7f 1b                	jg     800636 <vprintfmt+0x316>
+	else if (lflag)
+  80061b:	85 c9                	test   %ecx,%ecx
+  80061d:	74 2c                	je     80064b <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  80061f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800622:	8b 10                	mov    (%eax),%edx
+  800624:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800629:	8d 40 04             	lea    0x4(%eax),%eax
+  80062c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80062f:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800634:	eb 71                	jmp    8006a7 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  800636:	8b 45 14             	mov    0x14(%ebp),%eax
+  800639:	8b 10                	mov    (%eax),%edx
+  80063b:	8b 48 04             	mov    0x4(%eax),%ecx
+  80063e:	8d 40 08             	lea    0x8(%eax),%eax
+  800641:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800644:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800649:	eb 5c                	jmp    8006a7 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  80064b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064e:	8b 10                	mov    (%eax),%edx
+  800650:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800655:	8d 40 04             	lea    0x4(%eax),%eax
+  800658:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80065b:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800660:	eb 45                	jmp    8006a7 <vprintfmt+0x387>
+			putch('X', putdat);
+  800662:	83 ec 08             	sub    $0x8,%esp
+  800665:	53                   	push   %ebx
+  800666:	6a 58                	push   $0x58
+  800668:	ff d6                	call   *%esi
+			putch('X', putdat);
+  80066a:	83 c4 08             	add    $0x8,%esp
+  80066d:	53                   	push   %ebx
+  80066e:	6a 58                	push   $0x58
+  800670:	ff d6                	call   *%esi
+			putch('X', putdat);
+  800672:	83 c4 08             	add    $0x8,%esp
+  800675:	53                   	push   %ebx
+  800676:	6a 58                	push   $0x58
+  800678:	ff d6                	call   *%esi
+			break;
+  80067a:	83 c4 10             	add    $0x10,%esp
+  80067d:	eb 42                	jmp    8006c1 <vprintfmt+0x3a1>
+			putch('0', putdat);
+  80067f:	83 ec 08             	sub    $0x8,%esp
+  800682:	53                   	push   %ebx
+  800683:	6a 30                	push   $0x30
+  800685:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800687:	83 c4 08             	add    $0x8,%esp
+  80068a:	53                   	push   %ebx
+  80068b:	6a 78                	push   $0x78
+  80068d:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  80068f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800692:	8b 10                	mov    (%eax),%edx
+  800694:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800699:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80069c:	8d 40 04             	lea    0x4(%eax),%eax
+  80069f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006a2:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8006a7:	83 ec 0c             	sub    $0xc,%esp
+  8006aa:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8006ae:	50                   	push   %eax
+  8006af:	ff 75 e0             	push   -0x20(%ebp)
+  8006b2:	57                   	push   %edi
+  8006b3:	51                   	push   %ecx
+  8006b4:	52                   	push   %edx
+  8006b5:	89 da                	mov    %ebx,%edx
+  8006b7:	89 f0                	mov    %esi,%eax
+  8006b9:	e8 7f fb ff ff       	call   80023d <printnum>
+			break;
+  8006be:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8006c1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8006c4:	e9 75 fc ff ff       	jmp    80033e <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8006c9:	83 f9 01             	cmp    $0x1,%ecx
+  8006cc:	7f 1b                	jg     8006e9 <vprintfmt+0x3c9>
+	else if (lflag)
+  8006ce:	85 c9                	test   %ecx,%ecx
+  8006d0:	74 2c                	je     8006fe <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  8006d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d5:	8b 10                	mov    (%eax),%edx
+  8006d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006dc:	8d 40 04             	lea    0x4(%eax),%eax
+  8006df:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006e2:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8006e7:	eb be                	jmp    8006a7 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  8006e9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ec:	8b 10                	mov    (%eax),%edx
+  8006ee:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006f1:	8d 40 08             	lea    0x8(%eax),%eax
+  8006f4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006f7:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8006fc:	eb a9                	jmp    8006a7 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  8006fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800701:	8b 10                	mov    (%eax),%edx
+  800703:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800708:	8d 40 04             	lea    0x4(%eax),%eax
+  80070b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80070e:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800713:	eb 92                	jmp    8006a7 <vprintfmt+0x387>
+			putch(ch, putdat);
+  800715:	83 ec 08             	sub    $0x8,%esp
+  800718:	53                   	push   %ebx
+  800719:	6a 25                	push   $0x25
+  80071b:	ff d6                	call   *%esi
+			break;
+  80071d:	83 c4 10             	add    $0x10,%esp
+  800720:	eb 9f                	jmp    8006c1 <vprintfmt+0x3a1>
+			putch('%', putdat);
+  800722:	83 ec 08             	sub    $0x8,%esp
+  800725:	53                   	push   %ebx
+  800726:	6a 25                	push   $0x25
+  800728:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80072a:	83 c4 10             	add    $0x10,%esp
+  80072d:	89 f8                	mov    %edi,%eax
+  80072f:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800733:	74 05                	je     80073a <vprintfmt+0x41a>
+  800735:	83 e8 01             	sub    $0x1,%eax
+  800738:	eb f5                	jmp    80072f <vprintfmt+0x40f>
+  80073a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80073d:	eb 82                	jmp    8006c1 <vprintfmt+0x3a1>
+
+0080073f <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80073f:	55                   	push   %ebp
+  800740:	89 e5                	mov    %esp,%ebp
+  800742:	83 ec 18             	sub    $0x18,%esp
+  800745:	8b 45 08             	mov    0x8(%ebp),%eax
+  800748:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80074b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80074e:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800752:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800755:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80075c:	85 c0                	test   %eax,%eax
+  80075e:	74 26                	je     800786 <vsnprintf+0x47>
+  800760:	85 d2                	test   %edx,%edx
+  800762:	7e 22                	jle    800786 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800764:	ff 75 14             	push   0x14(%ebp)
+  800767:	ff 75 10             	push   0x10(%ebp)
+  80076a:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80076d:	50                   	push   %eax
+  80076e:	68 e6 02 80 00       	push   $0x8002e6
+  800773:	e8 a8 fb ff ff       	call   800320 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800778:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80077b:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80077e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800781:	83 c4 10             	add    $0x10,%esp
+}
+  800784:	c9                   	leave
+  800785:	c3                   	ret
+		return -E_INVAL;
+  800786:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80078b:	eb f7                	jmp    800784 <vsnprintf+0x45>
+
+0080078d <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80078d:	55                   	push   %ebp
+  80078e:	89 e5                	mov    %esp,%ebp
+  800790:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800793:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800796:	50                   	push   %eax
+  800797:	ff 75 10             	push   0x10(%ebp)
+  80079a:	ff 75 0c             	push   0xc(%ebp)
+  80079d:	ff 75 08             	push   0x8(%ebp)
+  8007a0:	e8 9a ff ff ff       	call   80073f <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8007a5:	c9                   	leave
+  8007a6:	c3                   	ret
+
+008007a7 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007a7:	55                   	push   %ebp
+  8007a8:	89 e5                	mov    %esp,%ebp
+  8007aa:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8007ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007b2:	eb 03                	jmp    8007b7 <strlen+0x10>
+		n++;
+  8007b4:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8007b7:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007bb:	75 f7                	jne    8007b4 <strlen+0xd>
+	return n;
+}
+  8007bd:	5d                   	pop    %ebp
+  8007be:	c3                   	ret
+
+008007bf <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8007bf:	55                   	push   %ebp
+  8007c0:	89 e5                	mov    %esp,%ebp
+  8007c2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007c5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007cd:	eb 03                	jmp    8007d2 <strnlen+0x13>
+		n++;
+  8007cf:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007d2:	39 d0                	cmp    %edx,%eax
+  8007d4:	74 08                	je     8007de <strnlen+0x1f>
+  8007d6:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8007da:	75 f3                	jne    8007cf <strnlen+0x10>
+  8007dc:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8007de:	89 d0                	mov    %edx,%eax
+  8007e0:	5d                   	pop    %ebp
+  8007e1:	c3                   	ret
+
+008007e2 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8007e2:	55                   	push   %ebp
+  8007e3:	89 e5                	mov    %esp,%ebp
+  8007e5:	53                   	push   %ebx
+  8007e6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007e9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8007ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007f1:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8007f5:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8007f8:	83 c0 01             	add    $0x1,%eax
+  8007fb:	84 d2                	test   %dl,%dl
+  8007fd:	75 f2                	jne    8007f1 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8007ff:	89 c8                	mov    %ecx,%eax
+  800801:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800804:	c9                   	leave
+  800805:	c3                   	ret
+
+00800806 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800806:	55                   	push   %ebp
+  800807:	89 e5                	mov    %esp,%ebp
+  800809:	53                   	push   %ebx
+  80080a:	83 ec 10             	sub    $0x10,%esp
+  80080d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800810:	53                   	push   %ebx
+  800811:	e8 91 ff ff ff       	call   8007a7 <strlen>
+  800816:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800819:	ff 75 0c             	push   0xc(%ebp)
+  80081c:	01 d8                	add    %ebx,%eax
+  80081e:	50                   	push   %eax
+  80081f:	e8 be ff ff ff       	call   8007e2 <strcpy>
+	return dst;
+}
+  800824:	89 d8                	mov    %ebx,%eax
+  800826:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800829:	c9                   	leave
+  80082a:	c3                   	ret
+
+0080082b <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80082b:	55                   	push   %ebp
+  80082c:	89 e5                	mov    %esp,%ebp
+  80082e:	56                   	push   %esi
+  80082f:	53                   	push   %ebx
+  800830:	8b 75 08             	mov    0x8(%ebp),%esi
+  800833:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800836:	89 f3                	mov    %esi,%ebx
+  800838:	03 5d 10             	add    0x10(%ebp),%ebx
+  80083b:	89 f0                	mov    %esi,%eax
+  80083d:	eb 0f                	jmp    80084e <strncpy+0x23>
+		*dst++ = *src;
+  80083f:	83 c0 01             	add    $0x1,%eax
+  800842:	0f b6 0a             	movzbl (%edx),%ecx
+  800845:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800848:	80 f9 01             	cmp    $0x1,%cl
+  80084b:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80084e:	39 d8                	cmp    %ebx,%eax
+  800850:	75 ed                	jne    80083f <strncpy+0x14>
+	}
+	return ret;
+}
+  800852:	89 f0                	mov    %esi,%eax
+  800854:	5b                   	pop    %ebx
+  800855:	5e                   	pop    %esi
+  800856:	5d                   	pop    %ebp
+  800857:	c3                   	ret
+
+00800858 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800858:	55                   	push   %ebp
+  800859:	89 e5                	mov    %esp,%ebp
+  80085b:	56                   	push   %esi
+  80085c:	53                   	push   %ebx
+  80085d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800860:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800863:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800866:	89 f0                	mov    %esi,%eax
+  800868:	85 d2                	test   %edx,%edx
+  80086a:	74 21                	je     80088d <strlcpy+0x35>
+  80086c:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800870:	89 f2                	mov    %esi,%edx
+  800872:	eb 09                	jmp    80087d <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800874:	83 c1 01             	add    $0x1,%ecx
+  800877:	83 c2 01             	add    $0x1,%edx
+  80087a:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80087d:	39 c2                	cmp    %eax,%edx
+  80087f:	74 09                	je     80088a <strlcpy+0x32>
+  800881:	0f b6 19             	movzbl (%ecx),%ebx
+  800884:	84 db                	test   %bl,%bl
+  800886:	75 ec                	jne    800874 <strlcpy+0x1c>
+  800888:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80088a:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80088d:	29 f0                	sub    %esi,%eax
+}
+  80088f:	5b                   	pop    %ebx
+  800890:	5e                   	pop    %esi
+  800891:	5d                   	pop    %ebp
+  800892:	c3                   	ret
+
+00800893 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800893:	55                   	push   %ebp
+  800894:	89 e5                	mov    %esp,%ebp
+  800896:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800899:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80089c:	eb 06                	jmp    8008a4 <strcmp+0x11>
+		p++, q++;
+  80089e:	83 c1 01             	add    $0x1,%ecx
+  8008a1:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8008a4:	0f b6 01             	movzbl (%ecx),%eax
+  8008a7:	84 c0                	test   %al,%al
+  8008a9:	74 04                	je     8008af <strcmp+0x1c>
+  8008ab:	3a 02                	cmp    (%edx),%al
+  8008ad:	74 ef                	je     80089e <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008af:	0f b6 c0             	movzbl %al,%eax
+  8008b2:	0f b6 12             	movzbl (%edx),%edx
+  8008b5:	29 d0                	sub    %edx,%eax
+}
+  8008b7:	5d                   	pop    %ebp
+  8008b8:	c3                   	ret
+
+008008b9 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8008b9:	55                   	push   %ebp
+  8008ba:	89 e5                	mov    %esp,%ebp
+  8008bc:	53                   	push   %ebx
+  8008bd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008c0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008c3:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8008c6:	eb 09                	jmp    8008d1 <strncmp+0x18>
+		n--, p++, q++;
+  8008c8:	83 ea 01             	sub    $0x1,%edx
+  8008cb:	83 c0 01             	add    $0x1,%eax
+  8008ce:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8008d1:	85 d2                	test   %edx,%edx
+  8008d3:	74 18                	je     8008ed <strncmp+0x34>
+  8008d5:	0f b6 18             	movzbl (%eax),%ebx
+  8008d8:	84 db                	test   %bl,%bl
+  8008da:	74 04                	je     8008e0 <strncmp+0x27>
+  8008dc:	3a 19                	cmp    (%ecx),%bl
+  8008de:	74 e8                	je     8008c8 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008e0:	0f b6 00             	movzbl (%eax),%eax
+  8008e3:	0f b6 11             	movzbl (%ecx),%edx
+  8008e6:	29 d0                	sub    %edx,%eax
+}
+  8008e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008eb:	c9                   	leave
+  8008ec:	c3                   	ret
+		return 0;
+  8008ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008f2:	eb f4                	jmp    8008e8 <strncmp+0x2f>
+
+008008f4 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8008f4:	55                   	push   %ebp
+  8008f5:	89 e5                	mov    %esp,%ebp
+  8008f7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008fa:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008fe:	eb 03                	jmp    800903 <strchr+0xf>
+  800900:	83 c0 01             	add    $0x1,%eax
+  800903:	0f b6 10             	movzbl (%eax),%edx
+  800906:	84 d2                	test   %dl,%dl
+  800908:	74 06                	je     800910 <strchr+0x1c>
+		if (*s == c)
+  80090a:	38 ca                	cmp    %cl,%dl
+  80090c:	75 f2                	jne    800900 <strchr+0xc>
+  80090e:	eb 05                	jmp    800915 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800910:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800915:	5d                   	pop    %ebp
+  800916:	c3                   	ret
+
+00800917 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800917:	55                   	push   %ebp
+  800918:	89 e5                	mov    %esp,%ebp
+  80091a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80091d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800921:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800924:	38 ca                	cmp    %cl,%dl
+  800926:	74 09                	je     800931 <strfind+0x1a>
+  800928:	84 d2                	test   %dl,%dl
+  80092a:	74 05                	je     800931 <strfind+0x1a>
+	for (; *s; s++)
+  80092c:	83 c0 01             	add    $0x1,%eax
+  80092f:	eb f0                	jmp    800921 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800931:	5d                   	pop    %ebp
+  800932:	c3                   	ret
+
+00800933 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800933:	55                   	push   %ebp
+  800934:	89 e5                	mov    %esp,%ebp
+  800936:	57                   	push   %edi
+  800937:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80093a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  80093d:	85 c9                	test   %ecx,%ecx
+  80093f:	74 20                	je     800961 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800941:	89 f8                	mov    %edi,%eax
+  800943:	09 c8                	or     %ecx,%eax
+  800945:	a8 03                	test   $0x3,%al
+  800947:	75 12                	jne    80095b <memset+0x28>
+		c &= 0xFF;
+  800949:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80094d:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800953:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800956:	fc                   	cld
+  800957:	f3 ab                	rep stos %eax,%es:(%edi)
+  800959:	eb 06                	jmp    800961 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80095b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80095e:	fc                   	cld
+  80095f:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800961:	89 f8                	mov    %edi,%eax
+  800963:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800966:	c9                   	leave
+  800967:	c3                   	ret
+
+00800968 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800968:	55                   	push   %ebp
+  800969:	89 e5                	mov    %esp,%ebp
+  80096b:	57                   	push   %edi
+  80096c:	56                   	push   %esi
+  80096d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800970:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800973:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800976:	39 c6                	cmp    %eax,%esi
+  800978:	73 32                	jae    8009ac <memmove+0x44>
+  80097a:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80097d:	39 d0                	cmp    %edx,%eax
+  80097f:	73 2b                	jae    8009ac <memmove+0x44>
+		s += n;
+		d += n;
+  800981:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800984:	89 d6                	mov    %edx,%esi
+  800986:	09 fe                	or     %edi,%esi
+  800988:	09 ce                	or     %ecx,%esi
+  80098a:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800990:	75 0e                	jne    8009a0 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800992:	83 ef 04             	sub    $0x4,%edi
+  800995:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800998:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  80099b:	fd                   	std
+  80099c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80099e:	eb 09                	jmp    8009a9 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8009a0:	83 ef 01             	sub    $0x1,%edi
+  8009a3:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8009a6:	fd                   	std
+  8009a7:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8009a9:	fc                   	cld
+  8009aa:	eb 1a                	jmp    8009c6 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009ac:	89 f2                	mov    %esi,%edx
+  8009ae:	09 c2                	or     %eax,%edx
+  8009b0:	09 ca                	or     %ecx,%edx
+  8009b2:	f6 c2 03             	test   $0x3,%dl
+  8009b5:	75 0a                	jne    8009c1 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8009b7:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8009ba:	89 c7                	mov    %eax,%edi
+  8009bc:	fc                   	cld
+  8009bd:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009bf:	eb 05                	jmp    8009c6 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8009c1:	89 c7                	mov    %eax,%edi
+  8009c3:	fc                   	cld
+  8009c4:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8009c6:	5e                   	pop    %esi
+  8009c7:	5f                   	pop    %edi
+  8009c8:	5d                   	pop    %ebp
+  8009c9:	c3                   	ret
+
+008009ca <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8009ca:	55                   	push   %ebp
+  8009cb:	89 e5                	mov    %esp,%ebp
+  8009cd:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8009d0:	ff 75 10             	push   0x10(%ebp)
+  8009d3:	ff 75 0c             	push   0xc(%ebp)
+  8009d6:	ff 75 08             	push   0x8(%ebp)
+  8009d9:	e8 8a ff ff ff       	call   800968 <memmove>
+}
+  8009de:	c9                   	leave
+  8009df:	c3                   	ret
+
+008009e0 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8009e0:	55                   	push   %ebp
+  8009e1:	89 e5                	mov    %esp,%ebp
+  8009e3:	56                   	push   %esi
+  8009e4:	53                   	push   %ebx
+  8009e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009e8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8009eb:	89 c6                	mov    %eax,%esi
+  8009ed:	03 75 10             	add    0x10(%ebp),%esi
+  8009f0:	eb 06                	jmp    8009f8 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8009f2:	83 c0 01             	add    $0x1,%eax
+  8009f5:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  8009f8:	39 f0                	cmp    %esi,%eax
+  8009fa:	74 14                	je     800a10 <memcmp+0x30>
+		if (*s1 != *s2)
+  8009fc:	0f b6 08             	movzbl (%eax),%ecx
+  8009ff:	0f b6 1a             	movzbl (%edx),%ebx
+  800a02:	38 d9                	cmp    %bl,%cl
+  800a04:	74 ec                	je     8009f2 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a06:	0f b6 c1             	movzbl %cl,%eax
+  800a09:	0f b6 db             	movzbl %bl,%ebx
+  800a0c:	29 d8                	sub    %ebx,%eax
+  800a0e:	eb 05                	jmp    800a15 <memcmp+0x35>
+	}
+
+	return 0;
+  800a10:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a15:	5b                   	pop    %ebx
+  800a16:	5e                   	pop    %esi
+  800a17:	5d                   	pop    %ebp
+  800a18:	c3                   	ret
+
+00800a19 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a19:	55                   	push   %ebp
+  800a1a:	89 e5                	mov    %esp,%ebp
+  800a1c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a1f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a22:	89 c2                	mov    %eax,%edx
+  800a24:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a27:	eb 03                	jmp    800a2c <memfind+0x13>
+  800a29:	83 c0 01             	add    $0x1,%eax
+  800a2c:	39 d0                	cmp    %edx,%eax
+  800a2e:	73 04                	jae    800a34 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a30:	38 08                	cmp    %cl,(%eax)
+  800a32:	75 f5                	jne    800a29 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a34:	5d                   	pop    %ebp
+  800a35:	c3                   	ret
+
+00800a36 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a36:	55                   	push   %ebp
+  800a37:	89 e5                	mov    %esp,%ebp
+  800a39:	57                   	push   %edi
+  800a3a:	56                   	push   %esi
+  800a3b:	53                   	push   %ebx
+  800a3c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a3f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a42:	eb 03                	jmp    800a47 <strtol+0x11>
+		s++;
+  800a44:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a47:	0f b6 02             	movzbl (%edx),%eax
+  800a4a:	3c 20                	cmp    $0x20,%al
+  800a4c:	74 f6                	je     800a44 <strtol+0xe>
+  800a4e:	3c 09                	cmp    $0x9,%al
+  800a50:	74 f2                	je     800a44 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a52:	3c 2b                	cmp    $0x2b,%al
+  800a54:	74 2a                	je     800a80 <strtol+0x4a>
+	int neg = 0;
+  800a56:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a5b:	3c 2d                	cmp    $0x2d,%al
+  800a5d:	74 2b                	je     800a8a <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a5f:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a65:	75 0f                	jne    800a76 <strtol+0x40>
+  800a67:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a6a:	74 28                	je     800a94 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a6c:	85 db                	test   %ebx,%ebx
+  800a6e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a73:	0f 44 d8             	cmove  %eax,%ebx
+  800a76:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a7b:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a7e:	eb 46                	jmp    800ac6 <strtol+0x90>
+		s++;
+  800a80:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a83:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a88:	eb d5                	jmp    800a5f <strtol+0x29>
+		s++, neg = 1;
+  800a8a:	83 c2 01             	add    $0x1,%edx
+  800a8d:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a92:	eb cb                	jmp    800a5f <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a94:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a98:	74 0e                	je     800aa8 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a9a:	85 db                	test   %ebx,%ebx
+  800a9c:	75 d8                	jne    800a76 <strtol+0x40>
+		s++, base = 8;
+  800a9e:	83 c2 01             	add    $0x1,%edx
+  800aa1:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800aa6:	eb ce                	jmp    800a76 <strtol+0x40>
+		s += 2, base = 16;
+  800aa8:	83 c2 02             	add    $0x2,%edx
+  800aab:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800ab0:	eb c4                	jmp    800a76 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800ab2:	0f be c0             	movsbl %al,%eax
+  800ab5:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800ab8:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800abb:	7d 3a                	jge    800af7 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800abd:	83 c2 01             	add    $0x1,%edx
+  800ac0:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800ac4:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800ac6:	0f b6 02             	movzbl (%edx),%eax
+  800ac9:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800acc:	89 f3                	mov    %esi,%ebx
+  800ace:	80 fb 09             	cmp    $0x9,%bl
+  800ad1:	76 df                	jbe    800ab2 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800ad3:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800ad6:	89 f3                	mov    %esi,%ebx
+  800ad8:	80 fb 19             	cmp    $0x19,%bl
+  800adb:	77 08                	ja     800ae5 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800add:	0f be c0             	movsbl %al,%eax
+  800ae0:	83 e8 57             	sub    $0x57,%eax
+  800ae3:	eb d3                	jmp    800ab8 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800ae5:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800ae8:	89 f3                	mov    %esi,%ebx
+  800aea:	80 fb 19             	cmp    $0x19,%bl
+  800aed:	77 08                	ja     800af7 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800aef:	0f be c0             	movsbl %al,%eax
+  800af2:	83 e8 37             	sub    $0x37,%eax
+  800af5:	eb c1                	jmp    800ab8 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800af7:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800afb:	74 05                	je     800b02 <strtol+0xcc>
+		*endptr = (char *) s;
+  800afd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b00:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800b02:	89 c8                	mov    %ecx,%eax
+  800b04:	f7 d8                	neg    %eax
+  800b06:	85 ff                	test   %edi,%edi
+  800b08:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b0b:	89 c8                	mov    %ecx,%eax
+  800b0d:	5b                   	pop    %ebx
+  800b0e:	5e                   	pop    %esi
+  800b0f:	5f                   	pop    %edi
+  800b10:	5d                   	pop    %ebp
+  800b11:	c3                   	ret
+
+00800b12 <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800b12:	55                   	push   %ebp
+  800b13:	89 e5                	mov    %esp,%ebp
+  800b15:	57                   	push   %edi
+  800b16:	56                   	push   %esi
+  800b17:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800b18:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b1d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b20:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b23:	89 c3                	mov    %eax,%ebx
+  800b25:	89 c7                	mov    %eax,%edi
+  800b27:	89 c6                	mov    %eax,%esi
+  800b29:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  800b2b:	5b                   	pop    %ebx
+  800b2c:	5e                   	pop    %esi
+  800b2d:	5f                   	pop    %edi
+  800b2e:	5d                   	pop    %ebp
+  800b2f:	c3                   	ret
+
+00800b30 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800b30:	55                   	push   %ebp
+  800b31:	89 e5                	mov    %esp,%ebp
+  800b33:	57                   	push   %edi
+  800b34:	56                   	push   %esi
+  800b35:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800b36:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b3b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b40:	89 d1                	mov    %edx,%ecx
+  800b42:	89 d3                	mov    %edx,%ebx
+  800b44:	89 d7                	mov    %edx,%edi
+  800b46:	89 d6                	mov    %edx,%esi
+  800b48:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800b4a:	5b                   	pop    %ebx
+  800b4b:	5e                   	pop    %esi
+  800b4c:	5f                   	pop    %edi
+  800b4d:	5d                   	pop    %ebp
+  800b4e:	c3                   	ret
+
+00800b4f <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800b4f:	55                   	push   %ebp
+  800b50:	89 e5                	mov    %esp,%ebp
+  800b52:	57                   	push   %edi
+  800b53:	56                   	push   %esi
+  800b54:	53                   	push   %ebx
+  800b55:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800b58:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b5d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b60:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b65:	89 cb                	mov    %ecx,%ebx
+  800b67:	89 cf                	mov    %ecx,%edi
+  800b69:	89 ce                	mov    %ecx,%esi
+  800b6b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800b6d:	85 c0                	test   %eax,%eax
+  800b6f:	7f 08                	jg     800b79 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800b71:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b74:	5b                   	pop    %ebx
+  800b75:	5e                   	pop    %esi
+  800b76:	5f                   	pop    %edi
+  800b77:	5d                   	pop    %ebp
+  800b78:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800b79:	83 ec 0c             	sub    $0xc,%esp
+  800b7c:	50                   	push   %eax
+  800b7d:	6a 03                	push   $0x3
+  800b7f:	68 c3 2c 80 00       	push   $0x802cc3
+  800b84:	6a 3e                	push   $0x3e
+  800b86:	68 e0 2c 80 00       	push   $0x802ce0
+  800b8b:	e8 be f5 ff ff       	call   80014e <_panic>
+
+00800b90 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800b90:	55                   	push   %ebp
+  800b91:	89 e5                	mov    %esp,%ebp
+  800b93:	57                   	push   %edi
+  800b94:	56                   	push   %esi
+  800b95:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800b96:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b9b:	b8 02 00 00 00       	mov    $0x2,%eax
+  800ba0:	89 d1                	mov    %edx,%ecx
+  800ba2:	89 d3                	mov    %edx,%ebx
+  800ba4:	89 d7                	mov    %edx,%edi
+  800ba6:	89 d6                	mov    %edx,%esi
+  800ba8:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800baa:	5b                   	pop    %ebx
+  800bab:	5e                   	pop    %esi
+  800bac:	5f                   	pop    %edi
+  800bad:	5d                   	pop    %ebp
+  800bae:	c3                   	ret
+
+00800baf <sys_yield>:
+
+void
+sys_yield(void) {
+  800baf:	55                   	push   %ebp
+  800bb0:	89 e5                	mov    %esp,%ebp
+  800bb2:	57                   	push   %edi
+  800bb3:	56                   	push   %esi
+  800bb4:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800bb5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bba:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800bbf:	89 d1                	mov    %edx,%ecx
+  800bc1:	89 d3                	mov    %edx,%ebx
+  800bc3:	89 d7                	mov    %edx,%edi
+  800bc5:	89 d6                	mov    %edx,%esi
+  800bc7:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800bc9:	5b                   	pop    %ebx
+  800bca:	5e                   	pop    %esi
+  800bcb:	5f                   	pop    %edi
+  800bcc:	5d                   	pop    %ebp
+  800bcd:	c3                   	ret
+
+00800bce <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  800bce:	55                   	push   %ebp
+  800bcf:	89 e5                	mov    %esp,%ebp
+  800bd1:	57                   	push   %edi
+  800bd2:	56                   	push   %esi
+  800bd3:	53                   	push   %ebx
+  800bd4:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800bd7:	be 00 00 00 00       	mov    $0x0,%esi
+  800bdc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bdf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800be2:	b8 04 00 00 00       	mov    $0x4,%eax
+  800be7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bea:	89 f7                	mov    %esi,%edi
+  800bec:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800bee:	85 c0                	test   %eax,%eax
+  800bf0:	7f 08                	jg     800bfa <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800bf2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bf5:	5b                   	pop    %ebx
+  800bf6:	5e                   	pop    %esi
+  800bf7:	5f                   	pop    %edi
+  800bf8:	5d                   	pop    %ebp
+  800bf9:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800bfa:	83 ec 0c             	sub    $0xc,%esp
+  800bfd:	50                   	push   %eax
+  800bfe:	6a 04                	push   $0x4
+  800c00:	68 c3 2c 80 00       	push   $0x802cc3
+  800c05:	6a 3e                	push   $0x3e
+  800c07:	68 e0 2c 80 00       	push   $0x802ce0
+  800c0c:	e8 3d f5 ff ff       	call   80014e <_panic>
+
+00800c11 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  800c11:	55                   	push   %ebp
+  800c12:	89 e5                	mov    %esp,%ebp
+  800c14:	57                   	push   %edi
+  800c15:	56                   	push   %esi
+  800c16:	53                   	push   %ebx
+  800c17:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c1a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c1d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c20:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c25:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c28:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c2b:	8b 75 18             	mov    0x18(%ebp),%esi
+  800c2e:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c30:	85 c0                	test   %eax,%eax
+  800c32:	7f 08                	jg     800c3c <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800c34:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c37:	5b                   	pop    %ebx
+  800c38:	5e                   	pop    %esi
+  800c39:	5f                   	pop    %edi
+  800c3a:	5d                   	pop    %ebp
+  800c3b:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c3c:	83 ec 0c             	sub    $0xc,%esp
+  800c3f:	50                   	push   %eax
+  800c40:	6a 05                	push   $0x5
+  800c42:	68 c3 2c 80 00       	push   $0x802cc3
+  800c47:	6a 3e                	push   $0x3e
+  800c49:	68 e0 2c 80 00       	push   $0x802ce0
+  800c4e:	e8 fb f4 ff ff       	call   80014e <_panic>
+
+00800c53 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  800c53:	55                   	push   %ebp
+  800c54:	89 e5                	mov    %esp,%ebp
+  800c56:	57                   	push   %edi
+  800c57:	56                   	push   %esi
+  800c58:	53                   	push   %ebx
+  800c59:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c5c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c61:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c64:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c67:	b8 06 00 00 00       	mov    $0x6,%eax
+  800c6c:	89 df                	mov    %ebx,%edi
+  800c6e:	89 de                	mov    %ebx,%esi
+  800c70:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c72:	85 c0                	test   %eax,%eax
+  800c74:	7f 08                	jg     800c7e <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800c76:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c79:	5b                   	pop    %ebx
+  800c7a:	5e                   	pop    %esi
+  800c7b:	5f                   	pop    %edi
+  800c7c:	5d                   	pop    %ebp
+  800c7d:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c7e:	83 ec 0c             	sub    $0xc,%esp
+  800c81:	50                   	push   %eax
+  800c82:	6a 06                	push   $0x6
+  800c84:	68 c3 2c 80 00       	push   $0x802cc3
+  800c89:	6a 3e                	push   $0x3e
+  800c8b:	68 e0 2c 80 00       	push   $0x802ce0
+  800c90:	e8 b9 f4 ff ff       	call   80014e <_panic>
+
+00800c95 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800c95:	55                   	push   %ebp
+  800c96:	89 e5                	mov    %esp,%ebp
+  800c98:	57                   	push   %edi
+  800c99:	56                   	push   %esi
+  800c9a:	53                   	push   %ebx
+  800c9b:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c9e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ca3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ca6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ca9:	b8 08 00 00 00       	mov    $0x8,%eax
+  800cae:	89 df                	mov    %ebx,%edi
+  800cb0:	89 de                	mov    %ebx,%esi
+  800cb2:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800cb4:	85 c0                	test   %eax,%eax
+  800cb6:	7f 08                	jg     800cc0 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800cb8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cbb:	5b                   	pop    %ebx
+  800cbc:	5e                   	pop    %esi
+  800cbd:	5f                   	pop    %edi
+  800cbe:	5d                   	pop    %ebp
+  800cbf:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800cc0:	83 ec 0c             	sub    $0xc,%esp
+  800cc3:	50                   	push   %eax
+  800cc4:	6a 08                	push   $0x8
+  800cc6:	68 c3 2c 80 00       	push   $0x802cc3
+  800ccb:	6a 3e                	push   $0x3e
+  800ccd:	68 e0 2c 80 00       	push   $0x802ce0
+  800cd2:	e8 77 f4 ff ff       	call   80014e <_panic>
+
+00800cd7 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800cd7:	55                   	push   %ebp
+  800cd8:	89 e5                	mov    %esp,%ebp
+  800cda:	57                   	push   %edi
+  800cdb:	56                   	push   %esi
+  800cdc:	53                   	push   %ebx
+  800cdd:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800ce0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ce5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ce8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ceb:	b8 09 00 00 00       	mov    $0x9,%eax
+  800cf0:	89 df                	mov    %ebx,%edi
+  800cf2:	89 de                	mov    %ebx,%esi
+  800cf4:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800cf6:	85 c0                	test   %eax,%eax
+  800cf8:	7f 08                	jg     800d02 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800cfa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cfd:	5b                   	pop    %ebx
+  800cfe:	5e                   	pop    %esi
+  800cff:	5f                   	pop    %edi
+  800d00:	5d                   	pop    %ebp
+  800d01:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d02:	83 ec 0c             	sub    $0xc,%esp
+  800d05:	50                   	push   %eax
+  800d06:	6a 09                	push   $0x9
+  800d08:	68 c3 2c 80 00       	push   $0x802cc3
+  800d0d:	6a 3e                	push   $0x3e
+  800d0f:	68 e0 2c 80 00       	push   $0x802ce0
+  800d14:	e8 35 f4 ff ff       	call   80014e <_panic>
+
+00800d19 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800d19:	55                   	push   %ebp
+  800d1a:	89 e5                	mov    %esp,%ebp
+  800d1c:	57                   	push   %edi
+  800d1d:	56                   	push   %esi
+  800d1e:	53                   	push   %ebx
+  800d1f:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800d22:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d27:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d2a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d2d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d32:	89 df                	mov    %ebx,%edi
+  800d34:	89 de                	mov    %ebx,%esi
+  800d36:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d38:	85 c0                	test   %eax,%eax
+  800d3a:	7f 08                	jg     800d44 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800d3c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d3f:	5b                   	pop    %ebx
+  800d40:	5e                   	pop    %esi
+  800d41:	5f                   	pop    %edi
+  800d42:	5d                   	pop    %ebp
+  800d43:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d44:	83 ec 0c             	sub    $0xc,%esp
+  800d47:	50                   	push   %eax
+  800d48:	6a 0a                	push   $0xa
+  800d4a:	68 c3 2c 80 00       	push   $0x802cc3
+  800d4f:	6a 3e                	push   $0x3e
+  800d51:	68 e0 2c 80 00       	push   $0x802ce0
+  800d56:	e8 f3 f3 ff ff       	call   80014e <_panic>
+
+00800d5b <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  800d5b:	55                   	push   %ebp
+  800d5c:	89 e5                	mov    %esp,%ebp
+  800d5e:	57                   	push   %edi
+  800d5f:	56                   	push   %esi
+  800d60:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d61:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d64:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d67:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800d6c:	be 00 00 00 00       	mov    $0x0,%esi
+  800d71:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d74:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d77:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800d79:	5b                   	pop    %ebx
+  800d7a:	5e                   	pop    %esi
+  800d7b:	5f                   	pop    %edi
+  800d7c:	5d                   	pop    %ebp
+  800d7d:	c3                   	ret
+
+00800d7e <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  800d7e:	55                   	push   %ebp
+  800d7f:	89 e5                	mov    %esp,%ebp
+  800d81:	57                   	push   %edi
+  800d82:	56                   	push   %esi
+  800d83:	53                   	push   %ebx
+  800d84:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800d87:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d8c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d8f:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800d94:	89 cb                	mov    %ecx,%ebx
+  800d96:	89 cf                	mov    %ecx,%edi
+  800d98:	89 ce                	mov    %ecx,%esi
+  800d9a:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d9c:	85 c0                	test   %eax,%eax
+  800d9e:	7f 08                	jg     800da8 <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  800da0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800da3:	5b                   	pop    %ebx
+  800da4:	5e                   	pop    %esi
+  800da5:	5f                   	pop    %edi
+  800da6:	5d                   	pop    %ebp
+  800da7:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800da8:	83 ec 0c             	sub    $0xc,%esp
+  800dab:	50                   	push   %eax
+  800dac:	6a 0d                	push   $0xd
+  800dae:	68 c3 2c 80 00       	push   $0x802cc3
+  800db3:	6a 3e                	push   $0x3e
+  800db5:	68 e0 2c 80 00       	push   $0x802ce0
+  800dba:	e8 8f f3 ff ff       	call   80014e <_panic>
+
+00800dbf <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  800dbf:	55                   	push   %ebp
+  800dc0:	89 e5                	mov    %esp,%ebp
+  800dc2:	57                   	push   %edi
+  800dc3:	56                   	push   %esi
+  800dc4:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800dc5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dca:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dcd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dd0:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800dd5:	89 df                	mov    %ebx,%edi
+  800dd7:	89 de                	mov    %ebx,%esi
+  800dd9:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  800ddb:	5b                   	pop    %ebx
+  800ddc:	5e                   	pop    %esi
+  800ddd:	5f                   	pop    %edi
+  800dde:	5d                   	pop    %ebp
+  800ddf:	c3                   	ret
+
+00800de0 <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  800de0:	55                   	push   %ebp
+  800de1:	89 e5                	mov    %esp,%ebp
+  800de3:	57                   	push   %edi
+  800de4:	56                   	push   %esi
+  800de5:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800de6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800deb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dee:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800df3:	89 cb                	mov    %ecx,%ebx
+  800df5:	89 cf                	mov    %ecx,%edi
+  800df7:	89 ce                	mov    %ecx,%esi
+  800df9:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  800dfb:	5b                   	pop    %ebx
+  800dfc:	5e                   	pop    %esi
+  800dfd:	5f                   	pop    %edi
+  800dfe:	5d                   	pop    %ebp
+  800dff:	c3                   	ret
+
+00800e00 <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  800e00:	55                   	push   %ebp
+  800e01:	89 e5                	mov    %esp,%ebp
+  800e03:	57                   	push   %edi
+  800e04:	56                   	push   %esi
+  800e05:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e06:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e0b:	b8 10 00 00 00       	mov    $0x10,%eax
+  800e10:	89 d1                	mov    %edx,%ecx
+  800e12:	89 d3                	mov    %edx,%ebx
+  800e14:	89 d7                	mov    %edx,%edi
+  800e16:	89 d6                	mov    %edx,%esi
+  800e18:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800e1a:	5b                   	pop    %ebx
+  800e1b:	5e                   	pop    %esi
+  800e1c:	5f                   	pop    %edi
+  800e1d:	5d                   	pop    %ebp
+  800e1e:	c3                   	ret
+
+00800e1f <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  800e1f:	55                   	push   %ebp
+  800e20:	89 e5                	mov    %esp,%ebp
+  800e22:	57                   	push   %edi
+  800e23:	56                   	push   %esi
+  800e24:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e25:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e2a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e2d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e30:	b8 11 00 00 00       	mov    $0x11,%eax
+  800e35:	89 df                	mov    %ebx,%edi
+  800e37:	89 de                	mov    %ebx,%esi
+  800e39:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800e3b:	5b                   	pop    %ebx
+  800e3c:	5e                   	pop    %esi
+  800e3d:	5f                   	pop    %edi
+  800e3e:	5d                   	pop    %ebp
+  800e3f:	c3                   	ret
+
+00800e40 <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  800e40:	55                   	push   %ebp
+  800e41:	89 e5                	mov    %esp,%ebp
+  800e43:	57                   	push   %edi
+  800e44:	56                   	push   %esi
+  800e45:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e46:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e4b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e4e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e51:	b8 12 00 00 00       	mov    $0x12,%eax
+  800e56:	89 df                	mov    %ebx,%edi
+  800e58:	89 de                	mov    %ebx,%esi
+  800e5a:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800e5c:	5b                   	pop    %ebx
+  800e5d:	5e                   	pop    %esi
+  800e5e:	5f                   	pop    %edi
+  800e5f:	5d                   	pop    %ebp
+  800e60:	c3                   	ret
+
+00800e61 <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  800e61:	55                   	push   %ebp
+  800e62:	89 e5                	mov    %esp,%ebp
+  800e64:	57                   	push   %edi
+  800e65:	56                   	push   %esi
+  800e66:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e67:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e6f:	b8 13 00 00 00       	mov    $0x13,%eax
+  800e74:	89 cb                	mov    %ecx,%ebx
+  800e76:	89 cf                	mov    %ecx,%edi
+  800e78:	89 ce                	mov    %ecx,%esi
+  800e7a:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  800e7c:	5b                   	pop    %ebx
+  800e7d:	5e                   	pop    %esi
+  800e7e:	5f                   	pop    %edi
+  800e7f:	5d                   	pop    %ebp
+  800e80:	c3                   	ret
+
+00800e81 <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  800e81:	55                   	push   %ebp
+  800e82:	89 e5                	mov    %esp,%ebp
+  800e84:	57                   	push   %edi
+  800e85:	56                   	push   %esi
+  800e86:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e87:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e8c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e8f:	b8 14 00 00 00       	mov    $0x14,%eax
+  800e94:	89 cb                	mov    %ecx,%ebx
+  800e96:	89 cf                	mov    %ecx,%edi
+  800e98:	89 ce                	mov    %ecx,%esi
+  800e9a:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  800e9c:	5b                   	pop    %ebx
+  800e9d:	5e                   	pop    %esi
+  800e9e:	5f                   	pop    %edi
+  800e9f:	5d                   	pop    %ebp
+  800ea0:	c3                   	ret
+
+00800ea1 <pgfault>:
+//
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf) {
+  800ea1:	55                   	push   %ebp
+  800ea2:	89 e5                	mov    %esp,%ebp
+  800ea4:	53                   	push   %ebx
+  800ea5:	83 ec 04             	sub    $0x4,%esp
+  800ea8:	8b 45 08             	mov    0x8(%ebp),%eax
+    void *addr = (void *) utf->utf_fault_va;
+  800eab:	8b 18                	mov    (%eax),%ebx
+    // Hint:
+    //   Use the read-only page table mappings at uvpt
+    //   (see <inc/memlayout.h>).
+
+    // LAB 4: Your code here.
+    if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P) ||
+  800ead:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  800eb1:	0f 84 95 00 00 00    	je     800f4c <pgfault+0xab>
+  800eb7:	89 d8                	mov    %ebx,%eax
+  800eb9:	c1 e8 16             	shr    $0x16,%eax
+  800ebc:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  800ec3:	a8 01                	test   $0x1,%al
+  800ec5:	0f 84 81 00 00 00    	je     800f4c <pgfault+0xab>
+        (uvpt[PGNUM(addr)] & (PTE_P | PTE_COW)) != (PTE_P | PTE_COW)) {
+  800ecb:	89 d8                	mov    %ebx,%eax
+  800ecd:	c1 e8 0c             	shr    $0xc,%eax
+  800ed0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800ed7:	25 01 08 00 00       	and    $0x801,%eax
+    if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P) ||
+  800edc:	3d 01 08 00 00       	cmp    $0x801,%eax
+  800ee1:	75 69                	jne    800f4c <pgfault+0xab>
+    // Hint:
+    //   You should make three system calls.
+
+    // LAB 4: Your code here.
+
+    if (sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W))
+  800ee3:	83 ec 04             	sub    $0x4,%esp
+  800ee6:	6a 07                	push   $0x7
+  800ee8:	68 00 f0 7f 00       	push   $0x7ff000
+  800eed:	6a 00                	push   $0x0
+  800eef:	e8 da fc ff ff       	call   800bce <sys_page_alloc>
+  800ef4:	83 c4 10             	add    $0x10,%esp
+  800ef7:	85 c0                	test   %eax,%eax
+  800ef9:	75 65                	jne    800f60 <pgfault+0xbf>
+        panic("sys_page_alloc failed");
+
+    addr = ROUNDDOWN(addr, PGSIZE);
+  800efb:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+    memmove(PFTEMP, addr, PGSIZE);
+  800f01:	83 ec 04             	sub    $0x4,%esp
+  800f04:	68 00 10 00 00       	push   $0x1000
+  800f09:	53                   	push   %ebx
+  800f0a:	68 00 f0 7f 00       	push   $0x7ff000
+  800f0f:	e8 54 fa ff ff       	call   800968 <memmove>
+
+    if (sys_page_map(0, PFTEMP, 0, addr, PTE_P | PTE_U | PTE_W))
+  800f14:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  800f1b:	53                   	push   %ebx
+  800f1c:	6a 00                	push   $0x0
+  800f1e:	68 00 f0 7f 00       	push   $0x7ff000
+  800f23:	6a 00                	push   $0x0
+  800f25:	e8 e7 fc ff ff       	call   800c11 <sys_page_map>
+  800f2a:	83 c4 20             	add    $0x20,%esp
+  800f2d:	85 c0                	test   %eax,%eax
+  800f2f:	75 43                	jne    800f74 <pgfault+0xd3>
+        panic("sys_page_map failed");
+    if (sys_page_unmap(0, PFTEMP))
+  800f31:	83 ec 08             	sub    $0x8,%esp
+  800f34:	68 00 f0 7f 00       	push   $0x7ff000
+  800f39:	6a 00                	push   $0x0
+  800f3b:	e8 13 fd ff ff       	call   800c53 <sys_page_unmap>
+  800f40:	83 c4 10             	add    $0x10,%esp
+  800f43:	85 c0                	test   %eax,%eax
+  800f45:	75 41                	jne    800f88 <pgfault+0xe7>
+        panic("sys_page_unmap failed");
+
+}
+  800f47:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f4a:	c9                   	leave
+  800f4b:	c3                   	ret
+        panic("pgfault: faulting access invalid");
+  800f4c:	83 ec 04             	sub    $0x4,%esp
+  800f4f:	68 f0 2c 80 00       	push   $0x802cf0
+  800f54:	6a 1e                	push   $0x1e
+  800f56:	68 5c 2d 80 00       	push   $0x802d5c
+  800f5b:	e8 ee f1 ff ff       	call   80014e <_panic>
+        panic("sys_page_alloc failed");
+  800f60:	83 ec 04             	sub    $0x4,%esp
+  800f63:	68 cf 2d 80 00       	push   $0x802dcf
+  800f68:	6a 2a                	push   $0x2a
+  800f6a:	68 5c 2d 80 00       	push   $0x802d5c
+  800f6f:	e8 da f1 ff ff       	call   80014e <_panic>
+        panic("sys_page_map failed");
+  800f74:	83 ec 04             	sub    $0x4,%esp
+  800f77:	68 67 2d 80 00       	push   $0x802d67
+  800f7c:	6a 30                	push   $0x30
+  800f7e:	68 5c 2d 80 00       	push   $0x802d5c
+  800f83:	e8 c6 f1 ff ff       	call   80014e <_panic>
+        panic("sys_page_unmap failed");
+  800f88:	83 ec 04             	sub    $0x4,%esp
+  800f8b:	68 7b 2d 80 00       	push   $0x802d7b
+  800f90:	6a 32                	push   $0x32
+  800f92:	68 5c 2d 80 00       	push   $0x802d5c
+  800f97:	e8 b2 f1 ff ff       	call   80014e <_panic>
+
+00800f9c <fork>:
+//   Remember to fix "thisenv" in the child process.
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void) {
+  800f9c:	55                   	push   %ebp
+  800f9d:	89 e5                	mov    %esp,%ebp
+  800f9f:	57                   	push   %edi
+  800fa0:	56                   	push   %esi
+  800fa1:	53                   	push   %ebx
+  800fa2:	83 ec 18             	sub    $0x18,%esp
+    // LAB 4: Your code here.
+    set_pgfault_handler(pgfault);
+  800fa5:	68 a1 0e 80 00       	push   $0x800ea1
+  800faa:	e8 1a 13 00 00       	call   8022c9 <set_pgfault_handler>
+
+// This must be inlined.  Exercise for reader: why?
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+  envid_t ret;
+  asm volatile("int %2"
+  800faf:	b8 07 00 00 00       	mov    $0x7,%eax
+  800fb4:	cd 30                	int    $0x30
+  800fb6:	89 c6                	mov    %eax,%esi
+
+    envid_t envid = sys_exofork();
+    if (envid < 0)
+  800fb8:	83 c4 10             	add    $0x10,%esp
+  800fbb:	85 c0                	test   %eax,%eax
+  800fbd:	78 2a                	js     800fe9 <fork+0x4d>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+
+    uintptr_t addr;
+    for (addr = 0; addr < UTOP; addr += PGSIZE) {
+  800fbf:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (envid == 0) {
+  800fc4:	0f 85 a2 00 00 00    	jne    80106c <fork+0xd0>
+        thisenv = &envs[ENVX(sys_getenvid())];
+  800fca:	e8 c1 fb ff ff       	call   800b90 <sys_getenvid>
+  800fcf:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800fd4:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800fd7:	c1 e0 04             	shl    $0x4,%eax
+  800fda:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800fdf:	a3 0c 40 80 00       	mov    %eax,0x80400c
+        return 0;
+  800fe4:	e9 6c 01 00 00       	jmp    801155 <fork+0x1b9>
+        panic("fork: sys_exofork error: %e", envid);
+  800fe9:	50                   	push   %eax
+  800fea:	68 91 2d 80 00       	push   $0x802d91
+  800fef:	6a 6f                	push   $0x6f
+  800ff1:	68 5c 2d 80 00       	push   $0x802d5c
+  800ff6:	e8 53 f1 ff ff       	call   80014e <_panic>
+        if ((r = sys_page_map(0, vptr, envid, vptr, uvpt[pn] & PTE_SYSCALL)) < 0)
+  800ffb:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801002:	83 ec 0c             	sub    $0xc,%esp
+  801005:	25 07 0e 00 00       	and    $0xe07,%eax
+  80100a:	50                   	push   %eax
+  80100b:	57                   	push   %edi
+  80100c:	56                   	push   %esi
+  80100d:	57                   	push   %edi
+  80100e:	6a 00                	push   $0x0
+  801010:	e8 fc fb ff ff       	call   800c11 <sys_page_map>
+  801015:	83 c4 20             	add    $0x20,%esp
+  801018:	85 c0                	test   %eax,%eax
+  80101a:	79 3e                	jns    80105a <fork+0xbe>
+            panic("duppage :in sys_page_map %e", r);
+  80101c:	50                   	push   %eax
+  80101d:	68 ad 2d 80 00       	push   $0x802dad
+  801022:	6a 49                	push   $0x49
+  801024:	68 5c 2d 80 00       	push   $0x802d5c
+  801029:	e8 20 f1 ff ff       	call   80014e <_panic>
+            panic("duppage :in sys_page_map %e", r);
+  80102e:	50                   	push   %eax
+  80102f:	68 ad 2d 80 00       	push   $0x802dad
+  801034:	6a 4e                	push   $0x4e
+  801036:	68 5c 2d 80 00       	push   $0x802d5c
+  80103b:	e8 0e f1 ff ff       	call   80014e <_panic>
+    } else if ((r = sys_page_map(0, vptr, envid, vptr, PTE_P | PTE_U)) < 0)
+  801040:	83 ec 0c             	sub    $0xc,%esp
+  801043:	6a 05                	push   $0x5
+  801045:	57                   	push   %edi
+  801046:	56                   	push   %esi
+  801047:	57                   	push   %edi
+  801048:	6a 00                	push   $0x0
+  80104a:	e8 c2 fb ff ff       	call   800c11 <sys_page_map>
+  80104f:	83 c4 20             	add    $0x20,%esp
+  801052:	85 c0                	test   %eax,%eax
+  801054:	0f 88 ab 00 00 00    	js     801105 <fork+0x169>
+    for (addr = 0; addr < UTOP; addr += PGSIZE) {
+  80105a:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801060:	81 fb 00 00 c0 ee    	cmp    $0xeec00000,%ebx
+  801066:	0f 84 ab 00 00 00    	je     801117 <fork+0x17b>
+        if (uvpd[PDX(addr)] & PTE_P && uvpt[PGNUM(addr)] & PTE_P && addr != UXSTACKTOP - PGSIZE) {
+  80106c:	89 d8                	mov    %ebx,%eax
+  80106e:	c1 e8 16             	shr    $0x16,%eax
+  801071:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801078:	a8 01                	test   $0x1,%al
+  80107a:	74 de                	je     80105a <fork+0xbe>
+  80107c:	89 d8                	mov    %ebx,%eax
+  80107e:	c1 e8 0c             	shr    $0xc,%eax
+  801081:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801088:	f6 c2 01             	test   $0x1,%dl
+  80108b:	74 cd                	je     80105a <fork+0xbe>
+  80108d:	81 fb 00 f0 bf ee    	cmp    $0xeebff000,%ebx
+  801093:	74 c5                	je     80105a <fork+0xbe>
+    void *vptr = (void *) (pn * PGSIZE);
+  801095:	89 c7                	mov    %eax,%edi
+  801097:	c1 e7 0c             	shl    $0xc,%edi
+    if (uvpt[pn] & PTE_SHARE) {
+  80109a:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8010a1:	f6 c6 04             	test   $0x4,%dh
+  8010a4:	0f 85 51 ff ff ff    	jne    800ffb <fork+0x5f>
+    } else if (uvpt[pn] & (PTE_W | PTE_COW)) {
+  8010aa:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8010b1:	a9 02 08 00 00       	test   $0x802,%eax
+  8010b6:	74 88                	je     801040 <fork+0xa4>
+        if ((r = sys_page_map(0, vptr, envid, vptr, PTE_P | PTE_U | PTE_COW)) < 0)
+  8010b8:	83 ec 0c             	sub    $0xc,%esp
+  8010bb:	68 05 08 00 00       	push   $0x805
+  8010c0:	57                   	push   %edi
+  8010c1:	56                   	push   %esi
+  8010c2:	57                   	push   %edi
+  8010c3:	6a 00                	push   $0x0
+  8010c5:	e8 47 fb ff ff       	call   800c11 <sys_page_map>
+  8010ca:	83 c4 20             	add    $0x20,%esp
+  8010cd:	85 c0                	test   %eax,%eax
+  8010cf:	0f 88 59 ff ff ff    	js     80102e <fork+0x92>
+        if ((r = sys_page_map(0, vptr, 0, vptr, PTE_P | PTE_U | PTE_COW)) < 0)
+  8010d5:	83 ec 0c             	sub    $0xc,%esp
+  8010d8:	68 05 08 00 00       	push   $0x805
+  8010dd:	57                   	push   %edi
+  8010de:	6a 00                	push   $0x0
+  8010e0:	57                   	push   %edi
+  8010e1:	6a 00                	push   $0x0
+  8010e3:	e8 29 fb ff ff       	call   800c11 <sys_page_map>
+  8010e8:	83 c4 20             	add    $0x20,%esp
+  8010eb:	85 c0                	test   %eax,%eax
+  8010ed:	0f 89 67 ff ff ff    	jns    80105a <fork+0xbe>
+            panic("duppage :in sys_page_map %e", r);
+  8010f3:	50                   	push   %eax
+  8010f4:	68 ad 2d 80 00       	push   $0x802dad
+  8010f9:	6a 50                	push   $0x50
+  8010fb:	68 5c 2d 80 00       	push   $0x802d5c
+  801100:	e8 49 f0 ff ff       	call   80014e <_panic>
+        panic("duppage :in sys_page_map %e", r);
+  801105:	50                   	push   %eax
+  801106:	68 ad 2d 80 00       	push   $0x802dad
+  80110b:	6a 53                	push   $0x53
+  80110d:	68 5c 2d 80 00       	push   $0x802d5c
+  801112:	e8 37 f0 ff ff       	call   80014e <_panic>
+            duppage(envid, PGNUM(addr));
+        }
+    }
+    if (sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W))
+  801117:	83 ec 04             	sub    $0x4,%esp
+  80111a:	6a 07                	push   $0x7
+  80111c:	68 00 f0 bf ee       	push   $0xeebff000
+  801121:	56                   	push   %esi
+  801122:	e8 a7 fa ff ff       	call   800bce <sys_page_alloc>
+  801127:	83 c4 10             	add    $0x10,%esp
+  80112a:	85 c0                	test   %eax,%eax
+  80112c:	75 31                	jne    80115f <fork+0x1c3>
+        panic("fork: sys_page_alloc failed");
+    if (sys_env_set_pgfault_upcall(envid, _pgfault_upcall))
+  80112e:	83 ec 08             	sub    $0x8,%esp
+  801131:	68 34 23 80 00       	push   $0x802334
+  801136:	56                   	push   %esi
+  801137:	e8 dd fb ff ff       	call   800d19 <sys_env_set_pgfault_upcall>
+  80113c:	83 c4 10             	add    $0x10,%esp
+  80113f:	85 c0                	test   %eax,%eax
+  801141:	75 30                	jne    801173 <fork+0x1d7>
+        panic("fork: sys_env_set_pgfault_upcall failed");
+    if (sys_env_set_status(envid, ENV_RUNNABLE))
+  801143:	83 ec 08             	sub    $0x8,%esp
+  801146:	6a 02                	push   $0x2
+  801148:	56                   	push   %esi
+  801149:	e8 47 fb ff ff       	call   800c95 <sys_env_set_status>
+  80114e:	83 c4 10             	add    $0x10,%esp
+  801151:	85 c0                	test   %eax,%eax
+  801153:	75 32                	jne    801187 <fork+0x1eb>
+        panic("fork: sys_env_set_status failed");
+
+    return envid;
+
+}
+  801155:	89 f0                	mov    %esi,%eax
+  801157:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80115a:	5b                   	pop    %ebx
+  80115b:	5e                   	pop    %esi
+  80115c:	5f                   	pop    %edi
+  80115d:	5d                   	pop    %ebp
+  80115e:	c3                   	ret
+        panic("fork: sys_page_alloc failed");
+  80115f:	83 ec 04             	sub    $0x4,%esp
+  801162:	68 c9 2d 80 00       	push   $0x802dc9
+  801167:	6a 7d                	push   $0x7d
+  801169:	68 5c 2d 80 00       	push   $0x802d5c
+  80116e:	e8 db ef ff ff       	call   80014e <_panic>
+        panic("fork: sys_env_set_pgfault_upcall failed");
+  801173:	83 ec 04             	sub    $0x4,%esp
+  801176:	68 14 2d 80 00       	push   $0x802d14
+  80117b:	6a 7f                	push   $0x7f
+  80117d:	68 5c 2d 80 00       	push   $0x802d5c
+  801182:	e8 c7 ef ff ff       	call   80014e <_panic>
+        panic("fork: sys_env_set_status failed");
+  801187:	83 ec 04             	sub    $0x4,%esp
+  80118a:	68 3c 2d 80 00       	push   $0x802d3c
+  80118f:	68 81 00 00 00       	push   $0x81
+  801194:	68 5c 2d 80 00       	push   $0x802d5c
+  801199:	e8 b0 ef ff ff       	call   80014e <_panic>
+
+0080119e <sfork>:
+
+// Challenge!
+int
+sfork(void) {
+  80119e:	55                   	push   %ebp
+  80119f:	89 e5                	mov    %esp,%ebp
+  8011a1:	83 ec 0c             	sub    $0xc,%esp
+    panic("sfork not implemented");
+  8011a4:	68 e5 2d 80 00       	push   $0x802de5
+  8011a9:	68 8a 00 00 00       	push   $0x8a
+  8011ae:	68 5c 2d 80 00       	push   $0x802d5c
+  8011b3:	e8 96 ef ff ff       	call   80014e <_panic>
+
+008011b8 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8011b8:	55                   	push   %ebp
+  8011b9:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8011bb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011be:	05 00 00 00 30       	add    $0x30000000,%eax
+  8011c3:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8011c6:	5d                   	pop    %ebp
+  8011c7:	c3                   	ret
+
+008011c8 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8011c8:	55                   	push   %ebp
+  8011c9:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8011cb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011ce:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8011d3:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8011d8:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8011dd:	5d                   	pop    %ebp
+  8011de:	c3                   	ret
+
+008011df <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8011df:	55                   	push   %ebp
+  8011e0:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8011e2:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8011e7:	eb 02                	jmp    8011eb <fd_alloc+0xc>
+  8011e9:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8011eb:	89 c2                	mov    %eax,%edx
+  8011ed:	c1 ea 16             	shr    $0x16,%edx
+  8011f0:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8011f7:	f6 c2 01             	test   $0x1,%dl
+  8011fa:	74 2b                	je     801227 <fd_alloc+0x48>
+  8011fc:	89 c2                	mov    %eax,%edx
+  8011fe:	c1 ea 0c             	shr    $0xc,%edx
+  801201:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801208:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80120e:	f6 c1 01             	test   $0x1,%cl
+  801211:	74 14                	je     801227 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801213:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801219:	75 ce                	jne    8011e9 <fd_alloc+0xa>
+  80121b:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801220:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801225:	eb 05                	jmp    80122c <fd_alloc+0x4d>
+			return 0;
+  801227:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80122c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80122f:	89 02                	mov    %eax,(%edx)
+}
+  801231:	89 c8                	mov    %ecx,%eax
+  801233:	5d                   	pop    %ebp
+  801234:	c3                   	ret
+
+00801235 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801235:	55                   	push   %ebp
+  801236:	89 e5                	mov    %esp,%ebp
+  801238:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80123b:	83 f8 1f             	cmp    $0x1f,%eax
+  80123e:	77 30                	ja     801270 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801240:	c1 e0 0c             	shl    $0xc,%eax
+  801243:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801248:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80124e:	f6 c2 01             	test   $0x1,%dl
+  801251:	74 24                	je     801277 <fd_lookup+0x42>
+  801253:	89 c2                	mov    %eax,%edx
+  801255:	c1 ea 0c             	shr    $0xc,%edx
+  801258:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80125f:	f6 c2 01             	test   $0x1,%dl
+  801262:	74 1a                	je     80127e <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801264:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801267:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801269:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80126e:	5d                   	pop    %ebp
+  80126f:	c3                   	ret
+		return -E_INVAL;
+  801270:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801275:	eb f7                	jmp    80126e <fd_lookup+0x39>
+		return -E_INVAL;
+  801277:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80127c:	eb f0                	jmp    80126e <fd_lookup+0x39>
+  80127e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801283:	eb e9                	jmp    80126e <fd_lookup+0x39>
+
+00801285 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801285:	55                   	push   %ebp
+  801286:	89 e5                	mov    %esp,%ebp
+  801288:	53                   	push   %ebx
+  801289:	83 ec 04             	sub    $0x4,%esp
+  80128c:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80128f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801294:	eb 03                	jmp    801299 <dev_lookup+0x14>
+  801296:	83 c0 01             	add    $0x1,%eax
+  801299:	8b 1c 85 78 2e 80 00 	mov    0x802e78(,%eax,4),%ebx
+  8012a0:	85 db                	test   %ebx,%ebx
+  8012a2:	74 0b                	je     8012af <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8012a4:	39 13                	cmp    %edx,(%ebx)
+  8012a6:	75 ee                	jne    801296 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8012a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012ad:	eb 1f                	jmp    8012ce <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8012af:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  8012b4:	8b 40 48             	mov    0x48(%eax),%eax
+  8012b7:	83 ec 04             	sub    $0x4,%esp
+  8012ba:	52                   	push   %edx
+  8012bb:	50                   	push   %eax
+  8012bc:	68 fc 2d 80 00       	push   $0x802dfc
+  8012c1:	e8 63 ef ff ff       	call   800229 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8012c6:	83 c4 10             	add    $0x10,%esp
+  8012c9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8012ce:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012d1:	89 1a                	mov    %ebx,(%edx)
+}
+  8012d3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012d6:	c9                   	leave
+  8012d7:	c3                   	ret
+
+008012d8 <fd_close>:
+{
+  8012d8:	55                   	push   %ebp
+  8012d9:	89 e5                	mov    %esp,%ebp
+  8012db:	57                   	push   %edi
+  8012dc:	56                   	push   %esi
+  8012dd:	53                   	push   %ebx
+  8012de:	83 ec 24             	sub    $0x24,%esp
+  8012e1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8012e4:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8012e7:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8012ea:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8012eb:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8012f1:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8012f4:	50                   	push   %eax
+  8012f5:	e8 3b ff ff ff       	call   801235 <fd_lookup>
+  8012fa:	89 c3                	mov    %eax,%ebx
+  8012fc:	83 c4 10             	add    $0x10,%esp
+  8012ff:	85 c0                	test   %eax,%eax
+  801301:	78 05                	js     801308 <fd_close+0x30>
+	    || fd != fd2)
+  801303:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801306:	74 16                	je     80131e <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801308:	89 f8                	mov    %edi,%eax
+  80130a:	84 c0                	test   %al,%al
+  80130c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801311:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801314:	89 d8                	mov    %ebx,%eax
+  801316:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801319:	5b                   	pop    %ebx
+  80131a:	5e                   	pop    %esi
+  80131b:	5f                   	pop    %edi
+  80131c:	5d                   	pop    %ebp
+  80131d:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80131e:	83 ec 08             	sub    $0x8,%esp
+  801321:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801324:	50                   	push   %eax
+  801325:	ff 36                	push   (%esi)
+  801327:	e8 59 ff ff ff       	call   801285 <dev_lookup>
+  80132c:	89 c3                	mov    %eax,%ebx
+  80132e:	83 c4 10             	add    $0x10,%esp
+  801331:	85 c0                	test   %eax,%eax
+  801333:	78 1a                	js     80134f <fd_close+0x77>
+		if (dev->dev_close)
+  801335:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801338:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80133b:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801340:	85 c0                	test   %eax,%eax
+  801342:	74 0b                	je     80134f <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801344:	83 ec 0c             	sub    $0xc,%esp
+  801347:	56                   	push   %esi
+  801348:	ff d0                	call   *%eax
+  80134a:	89 c3                	mov    %eax,%ebx
+  80134c:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80134f:	83 ec 08             	sub    $0x8,%esp
+  801352:	56                   	push   %esi
+  801353:	6a 00                	push   $0x0
+  801355:	e8 f9 f8 ff ff       	call   800c53 <sys_page_unmap>
+	return r;
+  80135a:	83 c4 10             	add    $0x10,%esp
+  80135d:	eb b5                	jmp    801314 <fd_close+0x3c>
+
+0080135f <close>:
+
+int
+close(int fdnum)
+{
+  80135f:	55                   	push   %ebp
+  801360:	89 e5                	mov    %esp,%ebp
+  801362:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801365:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801368:	50                   	push   %eax
+  801369:	ff 75 08             	push   0x8(%ebp)
+  80136c:	e8 c4 fe ff ff       	call   801235 <fd_lookup>
+  801371:	83 c4 10             	add    $0x10,%esp
+  801374:	85 c0                	test   %eax,%eax
+  801376:	79 02                	jns    80137a <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801378:	c9                   	leave
+  801379:	c3                   	ret
+		return fd_close(fd, 1);
+  80137a:	83 ec 08             	sub    $0x8,%esp
+  80137d:	6a 01                	push   $0x1
+  80137f:	ff 75 f4             	push   -0xc(%ebp)
+  801382:	e8 51 ff ff ff       	call   8012d8 <fd_close>
+  801387:	83 c4 10             	add    $0x10,%esp
+  80138a:	eb ec                	jmp    801378 <close+0x19>
+
+0080138c <close_all>:
+
+void
+close_all(void)
+{
+  80138c:	55                   	push   %ebp
+  80138d:	89 e5                	mov    %esp,%ebp
+  80138f:	53                   	push   %ebx
+  801390:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801393:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801398:	83 ec 0c             	sub    $0xc,%esp
+  80139b:	53                   	push   %ebx
+  80139c:	e8 be ff ff ff       	call   80135f <close>
+	for (i = 0; i < MAXFD; i++)
+  8013a1:	83 c3 01             	add    $0x1,%ebx
+  8013a4:	83 c4 10             	add    $0x10,%esp
+  8013a7:	83 fb 20             	cmp    $0x20,%ebx
+  8013aa:	75 ec                	jne    801398 <close_all+0xc>
+}
+  8013ac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013af:	c9                   	leave
+  8013b0:	c3                   	ret
+
+008013b1 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8013b1:	55                   	push   %ebp
+  8013b2:	89 e5                	mov    %esp,%ebp
+  8013b4:	57                   	push   %edi
+  8013b5:	56                   	push   %esi
+  8013b6:	53                   	push   %ebx
+  8013b7:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8013ba:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8013bd:	50                   	push   %eax
+  8013be:	ff 75 08             	push   0x8(%ebp)
+  8013c1:	e8 6f fe ff ff       	call   801235 <fd_lookup>
+  8013c6:	89 c3                	mov    %eax,%ebx
+  8013c8:	83 c4 10             	add    $0x10,%esp
+  8013cb:	85 c0                	test   %eax,%eax
+  8013cd:	78 7f                	js     80144e <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8013cf:	83 ec 0c             	sub    $0xc,%esp
+  8013d2:	ff 75 0c             	push   0xc(%ebp)
+  8013d5:	e8 85 ff ff ff       	call   80135f <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8013da:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8013dd:	c1 e6 0c             	shl    $0xc,%esi
+  8013e0:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8013e6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8013e9:	89 3c 24             	mov    %edi,(%esp)
+  8013ec:	e8 d7 fd ff ff       	call   8011c8 <fd2data>
+  8013f1:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8013f3:	89 34 24             	mov    %esi,(%esp)
+  8013f6:	e8 cd fd ff ff       	call   8011c8 <fd2data>
+  8013fb:	83 c4 10             	add    $0x10,%esp
+  8013fe:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801401:	89 d8                	mov    %ebx,%eax
+  801403:	c1 e8 16             	shr    $0x16,%eax
+  801406:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80140d:	a8 01                	test   $0x1,%al
+  80140f:	74 11                	je     801422 <dup+0x71>
+  801411:	89 d8                	mov    %ebx,%eax
+  801413:	c1 e8 0c             	shr    $0xc,%eax
+  801416:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80141d:	f6 c2 01             	test   $0x1,%dl
+  801420:	75 36                	jne    801458 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801422:	89 f8                	mov    %edi,%eax
+  801424:	c1 e8 0c             	shr    $0xc,%eax
+  801427:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80142e:	83 ec 0c             	sub    $0xc,%esp
+  801431:	25 07 0e 00 00       	and    $0xe07,%eax
+  801436:	50                   	push   %eax
+  801437:	56                   	push   %esi
+  801438:	6a 00                	push   $0x0
+  80143a:	57                   	push   %edi
+  80143b:	6a 00                	push   $0x0
+  80143d:	e8 cf f7 ff ff       	call   800c11 <sys_page_map>
+  801442:	89 c3                	mov    %eax,%ebx
+  801444:	83 c4 20             	add    $0x20,%esp
+  801447:	85 c0                	test   %eax,%eax
+  801449:	78 33                	js     80147e <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80144b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80144e:	89 d8                	mov    %ebx,%eax
+  801450:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801453:	5b                   	pop    %ebx
+  801454:	5e                   	pop    %esi
+  801455:	5f                   	pop    %edi
+  801456:	5d                   	pop    %ebp
+  801457:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801458:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80145f:	83 ec 0c             	sub    $0xc,%esp
+  801462:	25 07 0e 00 00       	and    $0xe07,%eax
+  801467:	50                   	push   %eax
+  801468:	ff 75 d4             	push   -0x2c(%ebp)
+  80146b:	6a 00                	push   $0x0
+  80146d:	53                   	push   %ebx
+  80146e:	6a 00                	push   $0x0
+  801470:	e8 9c f7 ff ff       	call   800c11 <sys_page_map>
+  801475:	89 c3                	mov    %eax,%ebx
+  801477:	83 c4 20             	add    $0x20,%esp
+  80147a:	85 c0                	test   %eax,%eax
+  80147c:	79 a4                	jns    801422 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80147e:	83 ec 08             	sub    $0x8,%esp
+  801481:	56                   	push   %esi
+  801482:	6a 00                	push   $0x0
+  801484:	e8 ca f7 ff ff       	call   800c53 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801489:	83 c4 08             	add    $0x8,%esp
+  80148c:	ff 75 d4             	push   -0x2c(%ebp)
+  80148f:	6a 00                	push   $0x0
+  801491:	e8 bd f7 ff ff       	call   800c53 <sys_page_unmap>
+	return r;
+  801496:	83 c4 10             	add    $0x10,%esp
+  801499:	eb b3                	jmp    80144e <dup+0x9d>
+
+0080149b <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80149b:	55                   	push   %ebp
+  80149c:	89 e5                	mov    %esp,%ebp
+  80149e:	56                   	push   %esi
+  80149f:	53                   	push   %ebx
+  8014a0:	83 ec 18             	sub    $0x18,%esp
+  8014a3:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8014a6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8014a9:	50                   	push   %eax
+  8014aa:	56                   	push   %esi
+  8014ab:	e8 85 fd ff ff       	call   801235 <fd_lookup>
+  8014b0:	83 c4 10             	add    $0x10,%esp
+  8014b3:	85 c0                	test   %eax,%eax
+  8014b5:	78 3c                	js     8014f3 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8014b7:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8014ba:	83 ec 08             	sub    $0x8,%esp
+  8014bd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014c0:	50                   	push   %eax
+  8014c1:	ff 33                	push   (%ebx)
+  8014c3:	e8 bd fd ff ff       	call   801285 <dev_lookup>
+  8014c8:	83 c4 10             	add    $0x10,%esp
+  8014cb:	85 c0                	test   %eax,%eax
+  8014cd:	78 24                	js     8014f3 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8014cf:	8b 43 08             	mov    0x8(%ebx),%eax
+  8014d2:	83 e0 03             	and    $0x3,%eax
+  8014d5:	83 f8 01             	cmp    $0x1,%eax
+  8014d8:	74 20                	je     8014fa <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8014da:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014dd:	8b 40 08             	mov    0x8(%eax),%eax
+  8014e0:	85 c0                	test   %eax,%eax
+  8014e2:	74 37                	je     80151b <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8014e4:	83 ec 04             	sub    $0x4,%esp
+  8014e7:	ff 75 10             	push   0x10(%ebp)
+  8014ea:	ff 75 0c             	push   0xc(%ebp)
+  8014ed:	53                   	push   %ebx
+  8014ee:	ff d0                	call   *%eax
+  8014f0:	83 c4 10             	add    $0x10,%esp
+}
+  8014f3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014f6:	5b                   	pop    %ebx
+  8014f7:	5e                   	pop    %esi
+  8014f8:	5d                   	pop    %ebp
+  8014f9:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8014fa:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  8014ff:	8b 40 48             	mov    0x48(%eax),%eax
+  801502:	83 ec 04             	sub    $0x4,%esp
+  801505:	56                   	push   %esi
+  801506:	50                   	push   %eax
+  801507:	68 3d 2e 80 00       	push   $0x802e3d
+  80150c:	e8 18 ed ff ff       	call   800229 <cprintf>
+		return -E_INVAL;
+  801511:	83 c4 10             	add    $0x10,%esp
+  801514:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801519:	eb d8                	jmp    8014f3 <read+0x58>
+		return -E_NOT_SUPP;
+  80151b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801520:	eb d1                	jmp    8014f3 <read+0x58>
+
+00801522 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801522:	55                   	push   %ebp
+  801523:	89 e5                	mov    %esp,%ebp
+  801525:	57                   	push   %edi
+  801526:	56                   	push   %esi
+  801527:	53                   	push   %ebx
+  801528:	83 ec 0c             	sub    $0xc,%esp
+  80152b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80152e:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801531:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801536:	eb 02                	jmp    80153a <readn+0x18>
+  801538:	01 c3                	add    %eax,%ebx
+  80153a:	39 f3                	cmp    %esi,%ebx
+  80153c:	73 21                	jae    80155f <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80153e:	83 ec 04             	sub    $0x4,%esp
+  801541:	89 f0                	mov    %esi,%eax
+  801543:	29 d8                	sub    %ebx,%eax
+  801545:	50                   	push   %eax
+  801546:	89 d8                	mov    %ebx,%eax
+  801548:	03 45 0c             	add    0xc(%ebp),%eax
+  80154b:	50                   	push   %eax
+  80154c:	57                   	push   %edi
+  80154d:	e8 49 ff ff ff       	call   80149b <read>
+		if (m < 0)
+  801552:	83 c4 10             	add    $0x10,%esp
+  801555:	85 c0                	test   %eax,%eax
+  801557:	78 04                	js     80155d <readn+0x3b>
+			return m;
+		if (m == 0)
+  801559:	75 dd                	jne    801538 <readn+0x16>
+  80155b:	eb 02                	jmp    80155f <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80155d:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80155f:	89 d8                	mov    %ebx,%eax
+  801561:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801564:	5b                   	pop    %ebx
+  801565:	5e                   	pop    %esi
+  801566:	5f                   	pop    %edi
+  801567:	5d                   	pop    %ebp
+  801568:	c3                   	ret
+
+00801569 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801569:	55                   	push   %ebp
+  80156a:	89 e5                	mov    %esp,%ebp
+  80156c:	56                   	push   %esi
+  80156d:	53                   	push   %ebx
+  80156e:	83 ec 18             	sub    $0x18,%esp
+  801571:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801574:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801577:	50                   	push   %eax
+  801578:	53                   	push   %ebx
+  801579:	e8 b7 fc ff ff       	call   801235 <fd_lookup>
+  80157e:	83 c4 10             	add    $0x10,%esp
+  801581:	85 c0                	test   %eax,%eax
+  801583:	78 37                	js     8015bc <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801585:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801588:	83 ec 08             	sub    $0x8,%esp
+  80158b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80158e:	50                   	push   %eax
+  80158f:	ff 36                	push   (%esi)
+  801591:	e8 ef fc ff ff       	call   801285 <dev_lookup>
+  801596:	83 c4 10             	add    $0x10,%esp
+  801599:	85 c0                	test   %eax,%eax
+  80159b:	78 1f                	js     8015bc <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80159d:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8015a1:	74 20                	je     8015c3 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8015a3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015a6:	8b 40 0c             	mov    0xc(%eax),%eax
+  8015a9:	85 c0                	test   %eax,%eax
+  8015ab:	74 37                	je     8015e4 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8015ad:	83 ec 04             	sub    $0x4,%esp
+  8015b0:	ff 75 10             	push   0x10(%ebp)
+  8015b3:	ff 75 0c             	push   0xc(%ebp)
+  8015b6:	56                   	push   %esi
+  8015b7:	ff d0                	call   *%eax
+  8015b9:	83 c4 10             	add    $0x10,%esp
+}
+  8015bc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015bf:	5b                   	pop    %ebx
+  8015c0:	5e                   	pop    %esi
+  8015c1:	5d                   	pop    %ebp
+  8015c2:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8015c3:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  8015c8:	8b 40 48             	mov    0x48(%eax),%eax
+  8015cb:	83 ec 04             	sub    $0x4,%esp
+  8015ce:	53                   	push   %ebx
+  8015cf:	50                   	push   %eax
+  8015d0:	68 59 2e 80 00       	push   $0x802e59
+  8015d5:	e8 4f ec ff ff       	call   800229 <cprintf>
+		return -E_INVAL;
+  8015da:	83 c4 10             	add    $0x10,%esp
+  8015dd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015e2:	eb d8                	jmp    8015bc <write+0x53>
+		return -E_NOT_SUPP;
+  8015e4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015e9:	eb d1                	jmp    8015bc <write+0x53>
+
+008015eb <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8015eb:	55                   	push   %ebp
+  8015ec:	89 e5                	mov    %esp,%ebp
+  8015ee:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8015f1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015f4:	50                   	push   %eax
+  8015f5:	ff 75 08             	push   0x8(%ebp)
+  8015f8:	e8 38 fc ff ff       	call   801235 <fd_lookup>
+  8015fd:	83 c4 10             	add    $0x10,%esp
+  801600:	85 c0                	test   %eax,%eax
+  801602:	78 0e                	js     801612 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801604:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801607:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80160a:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80160d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801612:	c9                   	leave
+  801613:	c3                   	ret
+
+00801614 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801614:	55                   	push   %ebp
+  801615:	89 e5                	mov    %esp,%ebp
+  801617:	56                   	push   %esi
+  801618:	53                   	push   %ebx
+  801619:	83 ec 18             	sub    $0x18,%esp
+  80161c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80161f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801622:	50                   	push   %eax
+  801623:	53                   	push   %ebx
+  801624:	e8 0c fc ff ff       	call   801235 <fd_lookup>
+  801629:	83 c4 10             	add    $0x10,%esp
+  80162c:	85 c0                	test   %eax,%eax
+  80162e:	78 34                	js     801664 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801630:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801633:	83 ec 08             	sub    $0x8,%esp
+  801636:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801639:	50                   	push   %eax
+  80163a:	ff 36                	push   (%esi)
+  80163c:	e8 44 fc ff ff       	call   801285 <dev_lookup>
+  801641:	83 c4 10             	add    $0x10,%esp
+  801644:	85 c0                	test   %eax,%eax
+  801646:	78 1c                	js     801664 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801648:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80164c:	74 1d                	je     80166b <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80164e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801651:	8b 40 18             	mov    0x18(%eax),%eax
+  801654:	85 c0                	test   %eax,%eax
+  801656:	74 34                	je     80168c <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801658:	83 ec 08             	sub    $0x8,%esp
+  80165b:	ff 75 0c             	push   0xc(%ebp)
+  80165e:	56                   	push   %esi
+  80165f:	ff d0                	call   *%eax
+  801661:	83 c4 10             	add    $0x10,%esp
+}
+  801664:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801667:	5b                   	pop    %ebx
+  801668:	5e                   	pop    %esi
+  801669:	5d                   	pop    %ebp
+  80166a:	c3                   	ret
+			thisenv->env_id, fdnum);
+  80166b:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  801670:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801673:	83 ec 04             	sub    $0x4,%esp
+  801676:	53                   	push   %ebx
+  801677:	50                   	push   %eax
+  801678:	68 1c 2e 80 00       	push   $0x802e1c
+  80167d:	e8 a7 eb ff ff       	call   800229 <cprintf>
+		return -E_INVAL;
+  801682:	83 c4 10             	add    $0x10,%esp
+  801685:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80168a:	eb d8                	jmp    801664 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  80168c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801691:	eb d1                	jmp    801664 <ftruncate+0x50>
+
+00801693 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801693:	55                   	push   %ebp
+  801694:	89 e5                	mov    %esp,%ebp
+  801696:	56                   	push   %esi
+  801697:	53                   	push   %ebx
+  801698:	83 ec 18             	sub    $0x18,%esp
+  80169b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80169e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016a1:	50                   	push   %eax
+  8016a2:	ff 75 08             	push   0x8(%ebp)
+  8016a5:	e8 8b fb ff ff       	call   801235 <fd_lookup>
+  8016aa:	83 c4 10             	add    $0x10,%esp
+  8016ad:	85 c0                	test   %eax,%eax
+  8016af:	78 49                	js     8016fa <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016b1:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8016b4:	83 ec 08             	sub    $0x8,%esp
+  8016b7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016ba:	50                   	push   %eax
+  8016bb:	ff 36                	push   (%esi)
+  8016bd:	e8 c3 fb ff ff       	call   801285 <dev_lookup>
+  8016c2:	83 c4 10             	add    $0x10,%esp
+  8016c5:	85 c0                	test   %eax,%eax
+  8016c7:	78 31                	js     8016fa <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8016c9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016cc:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8016d0:	74 2f                	je     801701 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8016d2:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8016d5:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8016dc:	00 00 00 
+	stat->st_isdir = 0;
+  8016df:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8016e6:	00 00 00 
+	stat->st_dev = dev;
+  8016e9:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8016ef:	83 ec 08             	sub    $0x8,%esp
+  8016f2:	53                   	push   %ebx
+  8016f3:	56                   	push   %esi
+  8016f4:	ff 50 14             	call   *0x14(%eax)
+  8016f7:	83 c4 10             	add    $0x10,%esp
+}
+  8016fa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016fd:	5b                   	pop    %ebx
+  8016fe:	5e                   	pop    %esi
+  8016ff:	5d                   	pop    %ebp
+  801700:	c3                   	ret
+		return -E_NOT_SUPP;
+  801701:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801706:	eb f2                	jmp    8016fa <fstat+0x67>
+
+00801708 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801708:	55                   	push   %ebp
+  801709:	89 e5                	mov    %esp,%ebp
+  80170b:	56                   	push   %esi
+  80170c:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80170d:	83 ec 08             	sub    $0x8,%esp
+  801710:	6a 00                	push   $0x0
+  801712:	ff 75 08             	push   0x8(%ebp)
+  801715:	e8 e4 01 00 00       	call   8018fe <open>
+  80171a:	89 c3                	mov    %eax,%ebx
+  80171c:	83 c4 10             	add    $0x10,%esp
+  80171f:	85 c0                	test   %eax,%eax
+  801721:	78 1b                	js     80173e <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801723:	83 ec 08             	sub    $0x8,%esp
+  801726:	ff 75 0c             	push   0xc(%ebp)
+  801729:	50                   	push   %eax
+  80172a:	e8 64 ff ff ff       	call   801693 <fstat>
+  80172f:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801731:	89 1c 24             	mov    %ebx,(%esp)
+  801734:	e8 26 fc ff ff       	call   80135f <close>
+	return r;
+  801739:	83 c4 10             	add    $0x10,%esp
+  80173c:	89 f3                	mov    %esi,%ebx
+}
+  80173e:	89 d8                	mov    %ebx,%eax
+  801740:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801743:	5b                   	pop    %ebx
+  801744:	5e                   	pop    %esi
+  801745:	5d                   	pop    %ebp
+  801746:	c3                   	ret
+
+00801747 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  801747:	55                   	push   %ebp
+  801748:	89 e5                	mov    %esp,%ebp
+  80174a:	56                   	push   %esi
+  80174b:	53                   	push   %ebx
+  80174c:	89 c6                	mov    %eax,%esi
+  80174e:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  801750:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  801757:	74 27                	je     801780 <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801759:	6a 07                	push   $0x7
+  80175b:	68 00 50 80 00       	push   $0x805000
+  801760:	56                   	push   %esi
+  801761:	ff 35 00 40 80 00    	push   0x804000
+  801767:	e8 60 0c 00 00       	call   8023cc <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  80176c:	83 c4 0c             	add    $0xc,%esp
+  80176f:	6a 00                	push   $0x0
+  801771:	53                   	push   %ebx
+  801772:	6a 00                	push   $0x0
+  801774:	e8 df 0b 00 00       	call   802358 <ipc_recv>
+}
+  801779:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80177c:	5b                   	pop    %ebx
+  80177d:	5e                   	pop    %esi
+  80177e:	5d                   	pop    %ebp
+  80177f:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  801780:	83 ec 0c             	sub    $0xc,%esp
+  801783:	6a 01                	push   $0x1
+  801785:	e8 96 0c 00 00       	call   802420 <ipc_find_env>
+  80178a:	a3 00 40 80 00       	mov    %eax,0x804000
+  80178f:	83 c4 10             	add    $0x10,%esp
+  801792:	eb c5                	jmp    801759 <fsipc+0x12>
+
+00801794 <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801794:	55                   	push   %ebp
+  801795:	89 e5                	mov    %esp,%ebp
+  801797:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80179a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80179d:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017a0:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.set_size.req_size = newsize;
+  8017a5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8017a8:	a3 04 50 80 00       	mov    %eax,0x805004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  8017ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017b2:	b8 02 00 00 00       	mov    $0x2,%eax
+  8017b7:	e8 8b ff ff ff       	call   801747 <fsipc>
+}
+  8017bc:	c9                   	leave
+  8017bd:	c3                   	ret
+
+008017be <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8017be:	55                   	push   %ebp
+  8017bf:	89 e5                	mov    %esp,%ebp
+  8017c1:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8017c4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017c7:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017ca:	a3 00 50 80 00       	mov    %eax,0x805000
+  return fsipc(FSREQ_FLUSH, NULL);
+  8017cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017d4:	b8 06 00 00 00       	mov    $0x6,%eax
+  8017d9:	e8 69 ff ff ff       	call   801747 <fsipc>
+}
+  8017de:	c9                   	leave
+  8017df:	c3                   	ret
+
+008017e0 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8017e0:	55                   	push   %ebp
+  8017e1:	89 e5                	mov    %esp,%ebp
+  8017e3:	53                   	push   %ebx
+  8017e4:	83 ec 04             	sub    $0x4,%esp
+  8017e7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8017ea:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017ed:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017f0:	a3 00 50 80 00       	mov    %eax,0x805000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8017f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017fa:	b8 05 00 00 00       	mov    $0x5,%eax
+  8017ff:	e8 43 ff ff ff       	call   801747 <fsipc>
+  801804:	85 c0                	test   %eax,%eax
+  801806:	78 2c                	js     801834 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801808:	83 ec 08             	sub    $0x8,%esp
+  80180b:	68 00 50 80 00       	push   $0x805000
+  801810:	53                   	push   %ebx
+  801811:	e8 cc ef ff ff       	call   8007e2 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801816:	a1 80 50 80 00       	mov    0x805080,%eax
+  80181b:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801821:	a1 84 50 80 00       	mov    0x805084,%eax
+  801826:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  80182c:	83 c4 10             	add    $0x10,%esp
+  80182f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801834:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801837:	c9                   	leave
+  801838:	c3                   	ret
+
+00801839 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801839:	55                   	push   %ebp
+  80183a:	89 e5                	mov    %esp,%ebp
+  80183c:	83 ec 0c             	sub    $0xc,%esp
+  80183f:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801842:	8b 55 08             	mov    0x8(%ebp),%edx
+  801845:	8b 52 0c             	mov    0xc(%edx),%edx
+  801848:	89 15 00 50 80 00    	mov    %edx,0x805000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80184e:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801853:	39 d0                	cmp    %edx,%eax
+  801855:	0f 47 c2             	cmova  %edx,%eax
+  801858:	a3 04 50 80 00       	mov    %eax,0x805004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  80185d:	50                   	push   %eax
+  80185e:	ff 75 0c             	push   0xc(%ebp)
+  801861:	68 08 50 80 00       	push   $0x805008
+  801866:	e8 fd f0 ff ff       	call   800968 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  80186b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801870:	b8 04 00 00 00       	mov    $0x4,%eax
+  801875:	e8 cd fe ff ff       	call   801747 <fsipc>
+}
+  80187a:	c9                   	leave
+  80187b:	c3                   	ret
+
+0080187c <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80187c:	55                   	push   %ebp
+  80187d:	89 e5                	mov    %esp,%ebp
+  80187f:	56                   	push   %esi
+  801880:	53                   	push   %ebx
+  801881:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801884:	8b 45 08             	mov    0x8(%ebp),%eax
+  801887:	8b 40 0c             	mov    0xc(%eax),%eax
+  80188a:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.read.req_n = n;
+  80188f:	89 35 04 50 80 00    	mov    %esi,0x805004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801895:	ba 00 00 00 00       	mov    $0x0,%edx
+  80189a:	b8 03 00 00 00       	mov    $0x3,%eax
+  80189f:	e8 a3 fe ff ff       	call   801747 <fsipc>
+  8018a4:	89 c3                	mov    %eax,%ebx
+  8018a6:	85 c0                	test   %eax,%eax
+  8018a8:	78 1f                	js     8018c9 <devfile_read+0x4d>
+  assert(r <= n);
+  8018aa:	39 c6                	cmp    %eax,%esi
+  8018ac:	72 24                	jb     8018d2 <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  8018ae:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8018b3:	7f 33                	jg     8018e8 <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8018b5:	83 ec 04             	sub    $0x4,%esp
+  8018b8:	50                   	push   %eax
+  8018b9:	68 00 50 80 00       	push   $0x805000
+  8018be:	ff 75 0c             	push   0xc(%ebp)
+  8018c1:	e8 a2 f0 ff ff       	call   800968 <memmove>
+  return r;
+  8018c6:	83 c4 10             	add    $0x10,%esp
+}
+  8018c9:	89 d8                	mov    %ebx,%eax
+  8018cb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018ce:	5b                   	pop    %ebx
+  8018cf:	5e                   	pop    %esi
+  8018d0:	5d                   	pop    %ebp
+  8018d1:	c3                   	ret
+  assert(r <= n);
+  8018d2:	68 8c 2e 80 00       	push   $0x802e8c
+  8018d7:	68 93 2e 80 00       	push   $0x802e93
+  8018dc:	6a 78                	push   $0x78
+  8018de:	68 a8 2e 80 00       	push   $0x802ea8
+  8018e3:	e8 66 e8 ff ff       	call   80014e <_panic>
+  assert(r <= PGSIZE);
+  8018e8:	68 b3 2e 80 00       	push   $0x802eb3
+  8018ed:	68 93 2e 80 00       	push   $0x802e93
+  8018f2:	6a 79                	push   $0x79
+  8018f4:	68 a8 2e 80 00       	push   $0x802ea8
+  8018f9:	e8 50 e8 ff ff       	call   80014e <_panic>
+
+008018fe <open>:
+open(const char *path, int mode) {
+  8018fe:	55                   	push   %ebp
+  8018ff:	89 e5                	mov    %esp,%ebp
+  801901:	56                   	push   %esi
+  801902:	53                   	push   %ebx
+  801903:	83 ec 1c             	sub    $0x1c,%esp
+  801906:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801909:	56                   	push   %esi
+  80190a:	e8 98 ee ff ff       	call   8007a7 <strlen>
+  80190f:	83 c4 10             	add    $0x10,%esp
+  801912:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801917:	7f 6c                	jg     801985 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801919:	83 ec 0c             	sub    $0xc,%esp
+  80191c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80191f:	50                   	push   %eax
+  801920:	e8 ba f8 ff ff       	call   8011df <fd_alloc>
+  801925:	89 c3                	mov    %eax,%ebx
+  801927:	83 c4 10             	add    $0x10,%esp
+  80192a:	85 c0                	test   %eax,%eax
+  80192c:	78 3c                	js     80196a <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  80192e:	83 ec 08             	sub    $0x8,%esp
+  801931:	56                   	push   %esi
+  801932:	68 00 50 80 00       	push   $0x805000
+  801937:	e8 a6 ee ff ff       	call   8007e2 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  80193c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80193f:	a3 00 54 80 00       	mov    %eax,0x805400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801944:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801947:	b8 01 00 00 00       	mov    $0x1,%eax
+  80194c:	e8 f6 fd ff ff       	call   801747 <fsipc>
+  801951:	89 c3                	mov    %eax,%ebx
+  801953:	83 c4 10             	add    $0x10,%esp
+  801956:	85 c0                	test   %eax,%eax
+  801958:	78 19                	js     801973 <open+0x75>
+  return fd2num(fd);
+  80195a:	83 ec 0c             	sub    $0xc,%esp
+  80195d:	ff 75 f4             	push   -0xc(%ebp)
+  801960:	e8 53 f8 ff ff       	call   8011b8 <fd2num>
+  801965:	89 c3                	mov    %eax,%ebx
+  801967:	83 c4 10             	add    $0x10,%esp
+}
+  80196a:	89 d8                	mov    %ebx,%eax
+  80196c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80196f:	5b                   	pop    %ebx
+  801970:	5e                   	pop    %esi
+  801971:	5d                   	pop    %ebp
+  801972:	c3                   	ret
+    fd_close(fd, 0);
+  801973:	83 ec 08             	sub    $0x8,%esp
+  801976:	6a 00                	push   $0x0
+  801978:	ff 75 f4             	push   -0xc(%ebp)
+  80197b:	e8 58 f9 ff ff       	call   8012d8 <fd_close>
+    return r;
+  801980:	83 c4 10             	add    $0x10,%esp
+  801983:	eb e5                	jmp    80196a <open+0x6c>
+    return -E_BAD_PATH;
+  801985:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80198a:	eb de                	jmp    80196a <open+0x6c>
+
+0080198c <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  80198c:	55                   	push   %ebp
+  80198d:	89 e5                	mov    %esp,%ebp
+  80198f:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801992:	ba 00 00 00 00       	mov    $0x0,%edx
+  801997:	b8 08 00 00 00       	mov    $0x8,%eax
+  80199c:	e8 a6 fd ff ff       	call   801747 <fsipc>
+}
+  8019a1:	c9                   	leave
+  8019a2:	c3                   	ret
+
+008019a3 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8019a3:	55                   	push   %ebp
+  8019a4:	89 e5                	mov    %esp,%ebp
+  8019a6:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8019a9:	68 bf 2e 80 00       	push   $0x802ebf
+  8019ae:	ff 75 0c             	push   0xc(%ebp)
+  8019b1:	e8 2c ee ff ff       	call   8007e2 <strcpy>
+	return 0;
+}
+  8019b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019bb:	c9                   	leave
+  8019bc:	c3                   	ret
+
+008019bd <devsock_close>:
+{
+  8019bd:	55                   	push   %ebp
+  8019be:	89 e5                	mov    %esp,%ebp
+  8019c0:	53                   	push   %ebx
+  8019c1:	83 ec 10             	sub    $0x10,%esp
+  8019c4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8019c7:	53                   	push   %ebx
+  8019c8:	e8 92 0a 00 00       	call   80245f <pageref>
+  8019cd:	89 c2                	mov    %eax,%edx
+  8019cf:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8019d2:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8019d7:	83 fa 01             	cmp    $0x1,%edx
+  8019da:	74 05                	je     8019e1 <devsock_close+0x24>
+}
+  8019dc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019df:	c9                   	leave
+  8019e0:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8019e1:	83 ec 0c             	sub    $0xc,%esp
+  8019e4:	ff 73 0c             	push   0xc(%ebx)
+  8019e7:	e8 b7 02 00 00       	call   801ca3 <nsipc_close>
+  8019ec:	83 c4 10             	add    $0x10,%esp
+  8019ef:	eb eb                	jmp    8019dc <devsock_close+0x1f>
+
+008019f1 <devsock_write>:
+{
+  8019f1:	55                   	push   %ebp
+  8019f2:	89 e5                	mov    %esp,%ebp
+  8019f4:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8019f7:	6a 00                	push   $0x0
+  8019f9:	ff 75 10             	push   0x10(%ebp)
+  8019fc:	ff 75 0c             	push   0xc(%ebp)
+  8019ff:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a02:	ff 70 0c             	push   0xc(%eax)
+  801a05:	e8 79 03 00 00       	call   801d83 <nsipc_send>
+}
+  801a0a:	c9                   	leave
+  801a0b:	c3                   	ret
+
+00801a0c <devsock_read>:
+{
+  801a0c:	55                   	push   %ebp
+  801a0d:	89 e5                	mov    %esp,%ebp
+  801a0f:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801a12:	6a 00                	push   $0x0
+  801a14:	ff 75 10             	push   0x10(%ebp)
+  801a17:	ff 75 0c             	push   0xc(%ebp)
+  801a1a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a1d:	ff 70 0c             	push   0xc(%eax)
+  801a20:	e8 ef 02 00 00       	call   801d14 <nsipc_recv>
+}
+  801a25:	c9                   	leave
+  801a26:	c3                   	ret
+
+00801a27 <fd2sockid>:
+{
+  801a27:	55                   	push   %ebp
+  801a28:	89 e5                	mov    %esp,%ebp
+  801a2a:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801a2d:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801a30:	52                   	push   %edx
+  801a31:	50                   	push   %eax
+  801a32:	e8 fe f7 ff ff       	call   801235 <fd_lookup>
+  801a37:	83 c4 10             	add    $0x10,%esp
+  801a3a:	85 c0                	test   %eax,%eax
+  801a3c:	78 10                	js     801a4e <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801a3e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a41:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  801a47:	39 08                	cmp    %ecx,(%eax)
+  801a49:	75 05                	jne    801a50 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801a4b:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801a4e:	c9                   	leave
+  801a4f:	c3                   	ret
+		return -E_NOT_SUPP;
+  801a50:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a55:	eb f7                	jmp    801a4e <fd2sockid+0x27>
+
+00801a57 <alloc_sockfd>:
+{
+  801a57:	55                   	push   %ebp
+  801a58:	89 e5                	mov    %esp,%ebp
+  801a5a:	56                   	push   %esi
+  801a5b:	53                   	push   %ebx
+  801a5c:	83 ec 1c             	sub    $0x1c,%esp
+  801a5f:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801a61:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a64:	50                   	push   %eax
+  801a65:	e8 75 f7 ff ff       	call   8011df <fd_alloc>
+  801a6a:	89 c3                	mov    %eax,%ebx
+  801a6c:	83 c4 10             	add    $0x10,%esp
+  801a6f:	85 c0                	test   %eax,%eax
+  801a71:	78 43                	js     801ab6 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801a73:	83 ec 04             	sub    $0x4,%esp
+  801a76:	68 07 04 00 00       	push   $0x407
+  801a7b:	ff 75 f4             	push   -0xc(%ebp)
+  801a7e:	6a 00                	push   $0x0
+  801a80:	e8 49 f1 ff ff       	call   800bce <sys_page_alloc>
+  801a85:	89 c3                	mov    %eax,%ebx
+  801a87:	83 c4 10             	add    $0x10,%esp
+  801a8a:	85 c0                	test   %eax,%eax
+  801a8c:	78 28                	js     801ab6 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801a8e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a91:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  801a97:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801a99:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a9c:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801aa3:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801aa6:	83 ec 0c             	sub    $0xc,%esp
+  801aa9:	50                   	push   %eax
+  801aaa:	e8 09 f7 ff ff       	call   8011b8 <fd2num>
+  801aaf:	89 c3                	mov    %eax,%ebx
+  801ab1:	83 c4 10             	add    $0x10,%esp
+  801ab4:	eb 0c                	jmp    801ac2 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801ab6:	83 ec 0c             	sub    $0xc,%esp
+  801ab9:	56                   	push   %esi
+  801aba:	e8 e4 01 00 00       	call   801ca3 <nsipc_close>
+		return r;
+  801abf:	83 c4 10             	add    $0x10,%esp
+}
+  801ac2:	89 d8                	mov    %ebx,%eax
+  801ac4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ac7:	5b                   	pop    %ebx
+  801ac8:	5e                   	pop    %esi
+  801ac9:	5d                   	pop    %ebp
+  801aca:	c3                   	ret
+
+00801acb <accept>:
+{
+  801acb:	55                   	push   %ebp
+  801acc:	89 e5                	mov    %esp,%ebp
+  801ace:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801ad1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ad4:	e8 4e ff ff ff       	call   801a27 <fd2sockid>
+  801ad9:	85 c0                	test   %eax,%eax
+  801adb:	78 1b                	js     801af8 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801add:	83 ec 04             	sub    $0x4,%esp
+  801ae0:	ff 75 10             	push   0x10(%ebp)
+  801ae3:	ff 75 0c             	push   0xc(%ebp)
+  801ae6:	50                   	push   %eax
+  801ae7:	e8 0e 01 00 00       	call   801bfa <nsipc_accept>
+  801aec:	83 c4 10             	add    $0x10,%esp
+  801aef:	85 c0                	test   %eax,%eax
+  801af1:	78 05                	js     801af8 <accept+0x2d>
+	return alloc_sockfd(r);
+  801af3:	e8 5f ff ff ff       	call   801a57 <alloc_sockfd>
+}
+  801af8:	c9                   	leave
+  801af9:	c3                   	ret
+
+00801afa <bind>:
+{
+  801afa:	55                   	push   %ebp
+  801afb:	89 e5                	mov    %esp,%ebp
+  801afd:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801b00:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b03:	e8 1f ff ff ff       	call   801a27 <fd2sockid>
+  801b08:	85 c0                	test   %eax,%eax
+  801b0a:	78 12                	js     801b1e <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801b0c:	83 ec 04             	sub    $0x4,%esp
+  801b0f:	ff 75 10             	push   0x10(%ebp)
+  801b12:	ff 75 0c             	push   0xc(%ebp)
+  801b15:	50                   	push   %eax
+  801b16:	e8 31 01 00 00       	call   801c4c <nsipc_bind>
+  801b1b:	83 c4 10             	add    $0x10,%esp
+}
+  801b1e:	c9                   	leave
+  801b1f:	c3                   	ret
+
+00801b20 <shutdown>:
+{
+  801b20:	55                   	push   %ebp
+  801b21:	89 e5                	mov    %esp,%ebp
+  801b23:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801b26:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b29:	e8 f9 fe ff ff       	call   801a27 <fd2sockid>
+  801b2e:	85 c0                	test   %eax,%eax
+  801b30:	78 0f                	js     801b41 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801b32:	83 ec 08             	sub    $0x8,%esp
+  801b35:	ff 75 0c             	push   0xc(%ebp)
+  801b38:	50                   	push   %eax
+  801b39:	e8 43 01 00 00       	call   801c81 <nsipc_shutdown>
+  801b3e:	83 c4 10             	add    $0x10,%esp
+}
+  801b41:	c9                   	leave
+  801b42:	c3                   	ret
+
+00801b43 <connect>:
+{
+  801b43:	55                   	push   %ebp
+  801b44:	89 e5                	mov    %esp,%ebp
+  801b46:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801b49:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b4c:	e8 d6 fe ff ff       	call   801a27 <fd2sockid>
+  801b51:	85 c0                	test   %eax,%eax
+  801b53:	78 12                	js     801b67 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801b55:	83 ec 04             	sub    $0x4,%esp
+  801b58:	ff 75 10             	push   0x10(%ebp)
+  801b5b:	ff 75 0c             	push   0xc(%ebp)
+  801b5e:	50                   	push   %eax
+  801b5f:	e8 59 01 00 00       	call   801cbd <nsipc_connect>
+  801b64:	83 c4 10             	add    $0x10,%esp
+}
+  801b67:	c9                   	leave
+  801b68:	c3                   	ret
+
+00801b69 <listen>:
+{
+  801b69:	55                   	push   %ebp
+  801b6a:	89 e5                	mov    %esp,%ebp
+  801b6c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801b6f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b72:	e8 b0 fe ff ff       	call   801a27 <fd2sockid>
+  801b77:	85 c0                	test   %eax,%eax
+  801b79:	78 0f                	js     801b8a <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801b7b:	83 ec 08             	sub    $0x8,%esp
+  801b7e:	ff 75 0c             	push   0xc(%ebp)
+  801b81:	50                   	push   %eax
+  801b82:	e8 6b 01 00 00       	call   801cf2 <nsipc_listen>
+  801b87:	83 c4 10             	add    $0x10,%esp
+}
+  801b8a:	c9                   	leave
+  801b8b:	c3                   	ret
+
+00801b8c <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801b8c:	55                   	push   %ebp
+  801b8d:	89 e5                	mov    %esp,%ebp
+  801b8f:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801b92:	ff 75 10             	push   0x10(%ebp)
+  801b95:	ff 75 0c             	push   0xc(%ebp)
+  801b98:	ff 75 08             	push   0x8(%ebp)
+  801b9b:	e8 41 02 00 00       	call   801de1 <nsipc_socket>
+  801ba0:	83 c4 10             	add    $0x10,%esp
+  801ba3:	85 c0                	test   %eax,%eax
+  801ba5:	78 05                	js     801bac <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801ba7:	e8 ab fe ff ff       	call   801a57 <alloc_sockfd>
+}
+  801bac:	c9                   	leave
+  801bad:	c3                   	ret
+
+00801bae <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801bae:	55                   	push   %ebp
+  801baf:	89 e5                	mov    %esp,%ebp
+  801bb1:	53                   	push   %ebx
+  801bb2:	83 ec 04             	sub    $0x4,%esp
+  801bb5:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801bb7:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801bbe:	74 26                	je     801be6 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801bc0:	6a 07                	push   $0x7
+  801bc2:	68 00 60 80 00       	push   $0x806000
+  801bc7:	53                   	push   %ebx
+  801bc8:	ff 35 04 40 80 00    	push   0x804004
+  801bce:	e8 f9 07 00 00       	call   8023cc <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801bd3:	83 c4 0c             	add    $0xc,%esp
+  801bd6:	6a 00                	push   $0x0
+  801bd8:	6a 00                	push   $0x0
+  801bda:	6a 00                	push   $0x0
+  801bdc:	e8 77 07 00 00       	call   802358 <ipc_recv>
+}
+  801be1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801be4:	c9                   	leave
+  801be5:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801be6:	83 ec 0c             	sub    $0xc,%esp
+  801be9:	6a 02                	push   $0x2
+  801beb:	e8 30 08 00 00       	call   802420 <ipc_find_env>
+  801bf0:	a3 04 40 80 00       	mov    %eax,0x804004
+  801bf5:	83 c4 10             	add    $0x10,%esp
+  801bf8:	eb c6                	jmp    801bc0 <nsipc+0x12>
+
+00801bfa <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801bfa:	55                   	push   %ebp
+  801bfb:	89 e5                	mov    %esp,%ebp
+  801bfd:	56                   	push   %esi
+  801bfe:	53                   	push   %ebx
+  801bff:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801c02:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c05:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801c0a:	8b 06                	mov    (%esi),%eax
+  801c0c:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801c11:	b8 01 00 00 00       	mov    $0x1,%eax
+  801c16:	e8 93 ff ff ff       	call   801bae <nsipc>
+  801c1b:	89 c3                	mov    %eax,%ebx
+  801c1d:	85 c0                	test   %eax,%eax
+  801c1f:	79 09                	jns    801c2a <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801c21:	89 d8                	mov    %ebx,%eax
+  801c23:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c26:	5b                   	pop    %ebx
+  801c27:	5e                   	pop    %esi
+  801c28:	5d                   	pop    %ebp
+  801c29:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801c2a:	83 ec 04             	sub    $0x4,%esp
+  801c2d:	ff 35 10 60 80 00    	push   0x806010
+  801c33:	68 00 60 80 00       	push   $0x806000
+  801c38:	ff 75 0c             	push   0xc(%ebp)
+  801c3b:	e8 28 ed ff ff       	call   800968 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801c40:	a1 10 60 80 00       	mov    0x806010,%eax
+  801c45:	89 06                	mov    %eax,(%esi)
+  801c47:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801c4a:	eb d5                	jmp    801c21 <nsipc_accept+0x27>
+
+00801c4c <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801c4c:	55                   	push   %ebp
+  801c4d:	89 e5                	mov    %esp,%ebp
+  801c4f:	53                   	push   %ebx
+  801c50:	83 ec 08             	sub    $0x8,%esp
+  801c53:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801c56:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c59:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801c5e:	53                   	push   %ebx
+  801c5f:	ff 75 0c             	push   0xc(%ebp)
+  801c62:	68 04 60 80 00       	push   $0x806004
+  801c67:	e8 fc ec ff ff       	call   800968 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801c6c:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  801c72:	b8 02 00 00 00       	mov    $0x2,%eax
+  801c77:	e8 32 ff ff ff       	call   801bae <nsipc>
+}
+  801c7c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c7f:	c9                   	leave
+  801c80:	c3                   	ret
+
+00801c81 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801c81:	55                   	push   %ebp
+  801c82:	89 e5                	mov    %esp,%ebp
+  801c84:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801c87:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c8a:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  801c8f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c92:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  801c97:	b8 03 00 00 00       	mov    $0x3,%eax
+  801c9c:	e8 0d ff ff ff       	call   801bae <nsipc>
+}
+  801ca1:	c9                   	leave
+  801ca2:	c3                   	ret
+
+00801ca3 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801ca3:	55                   	push   %ebp
+  801ca4:	89 e5                	mov    %esp,%ebp
+  801ca6:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801ca9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cac:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  801cb1:	b8 04 00 00 00       	mov    $0x4,%eax
+  801cb6:	e8 f3 fe ff ff       	call   801bae <nsipc>
+}
+  801cbb:	c9                   	leave
+  801cbc:	c3                   	ret
+
+00801cbd <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801cbd:	55                   	push   %ebp
+  801cbe:	89 e5                	mov    %esp,%ebp
+  801cc0:	53                   	push   %ebx
+  801cc1:	83 ec 08             	sub    $0x8,%esp
+  801cc4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801cc7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cca:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801ccf:	53                   	push   %ebx
+  801cd0:	ff 75 0c             	push   0xc(%ebp)
+  801cd3:	68 04 60 80 00       	push   $0x806004
+  801cd8:	e8 8b ec ff ff       	call   800968 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801cdd:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  801ce3:	b8 05 00 00 00       	mov    $0x5,%eax
+  801ce8:	e8 c1 fe ff ff       	call   801bae <nsipc>
+}
+  801ced:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cf0:	c9                   	leave
+  801cf1:	c3                   	ret
+
+00801cf2 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801cf2:	55                   	push   %ebp
+  801cf3:	89 e5                	mov    %esp,%ebp
+  801cf5:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801cf8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cfb:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  801d00:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d03:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  801d08:	b8 06 00 00 00       	mov    $0x6,%eax
+  801d0d:	e8 9c fe ff ff       	call   801bae <nsipc>
+}
+  801d12:	c9                   	leave
+  801d13:	c3                   	ret
+
+00801d14 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801d14:	55                   	push   %ebp
+  801d15:	89 e5                	mov    %esp,%ebp
+  801d17:	56                   	push   %esi
+  801d18:	53                   	push   %ebx
+  801d19:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801d1c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d1f:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  801d24:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  801d2a:	8b 45 14             	mov    0x14(%ebp),%eax
+  801d2d:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801d32:	b8 07 00 00 00       	mov    $0x7,%eax
+  801d37:	e8 72 fe ff ff       	call   801bae <nsipc>
+  801d3c:	89 c3                	mov    %eax,%ebx
+  801d3e:	85 c0                	test   %eax,%eax
+  801d40:	78 22                	js     801d64 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801d42:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801d47:	39 c6                	cmp    %eax,%esi
+  801d49:	0f 4e c6             	cmovle %esi,%eax
+  801d4c:	39 c3                	cmp    %eax,%ebx
+  801d4e:	7f 1d                	jg     801d6d <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801d50:	83 ec 04             	sub    $0x4,%esp
+  801d53:	53                   	push   %ebx
+  801d54:	68 00 60 80 00       	push   $0x806000
+  801d59:	ff 75 0c             	push   0xc(%ebp)
+  801d5c:	e8 07 ec ff ff       	call   800968 <memmove>
+  801d61:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801d64:	89 d8                	mov    %ebx,%eax
+  801d66:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d69:	5b                   	pop    %ebx
+  801d6a:	5e                   	pop    %esi
+  801d6b:	5d                   	pop    %ebp
+  801d6c:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801d6d:	68 cb 2e 80 00       	push   $0x802ecb
+  801d72:	68 93 2e 80 00       	push   $0x802e93
+  801d77:	6a 62                	push   $0x62
+  801d79:	68 e0 2e 80 00       	push   $0x802ee0
+  801d7e:	e8 cb e3 ff ff       	call   80014e <_panic>
+
+00801d83 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801d83:	55                   	push   %ebp
+  801d84:	89 e5                	mov    %esp,%ebp
+  801d86:	53                   	push   %ebx
+  801d87:	83 ec 04             	sub    $0x4,%esp
+  801d8a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801d8d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d90:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  801d95:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801d9b:	7f 2e                	jg     801dcb <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801d9d:	83 ec 04             	sub    $0x4,%esp
+  801da0:	53                   	push   %ebx
+  801da1:	ff 75 0c             	push   0xc(%ebp)
+  801da4:	68 0c 60 80 00       	push   $0x80600c
+  801da9:	e8 ba eb ff ff       	call   800968 <memmove>
+	nsipcbuf.send.req_size = size;
+  801dae:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  801db4:	8b 45 14             	mov    0x14(%ebp),%eax
+  801db7:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  801dbc:	b8 08 00 00 00       	mov    $0x8,%eax
+  801dc1:	e8 e8 fd ff ff       	call   801bae <nsipc>
+}
+  801dc6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801dc9:	c9                   	leave
+  801dca:	c3                   	ret
+	assert(size < 1600);
+  801dcb:	68 ec 2e 80 00       	push   $0x802eec
+  801dd0:	68 93 2e 80 00       	push   $0x802e93
+  801dd5:	6a 6d                	push   $0x6d
+  801dd7:	68 e0 2e 80 00       	push   $0x802ee0
+  801ddc:	e8 6d e3 ff ff       	call   80014e <_panic>
+
+00801de1 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801de1:	55                   	push   %ebp
+  801de2:	89 e5                	mov    %esp,%ebp
+  801de4:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801de7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dea:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  801def:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801df2:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  801df7:	8b 45 10             	mov    0x10(%ebp),%eax
+  801dfa:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  801dff:	b8 09 00 00 00       	mov    $0x9,%eax
+  801e04:	e8 a5 fd ff ff       	call   801bae <nsipc>
+}
+  801e09:	c9                   	leave
+  801e0a:	c3                   	ret
+
+00801e0b <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801e0b:	55                   	push   %ebp
+  801e0c:	89 e5                	mov    %esp,%ebp
+  801e0e:	56                   	push   %esi
+  801e0f:	53                   	push   %ebx
+  801e10:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801e13:	83 ec 0c             	sub    $0xc,%esp
+  801e16:	ff 75 08             	push   0x8(%ebp)
+  801e19:	e8 aa f3 ff ff       	call   8011c8 <fd2data>
+  801e1e:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801e20:	83 c4 08             	add    $0x8,%esp
+  801e23:	68 f8 2e 80 00       	push   $0x802ef8
+  801e28:	53                   	push   %ebx
+  801e29:	e8 b4 e9 ff ff       	call   8007e2 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801e2e:	8b 46 04             	mov    0x4(%esi),%eax
+  801e31:	2b 06                	sub    (%esi),%eax
+  801e33:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  801e39:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801e40:	00 00 00 
+	stat->st_dev = &devpipe;
+  801e43:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  801e4a:	30 80 00 
+	return 0;
+}
+  801e4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e52:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e55:	5b                   	pop    %ebx
+  801e56:	5e                   	pop    %esi
+  801e57:	5d                   	pop    %ebp
+  801e58:	c3                   	ret
+
+00801e59 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801e59:	55                   	push   %ebp
+  801e5a:	89 e5                	mov    %esp,%ebp
+  801e5c:	53                   	push   %ebx
+  801e5d:	83 ec 0c             	sub    $0xc,%esp
+  801e60:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801e63:	53                   	push   %ebx
+  801e64:	6a 00                	push   $0x0
+  801e66:	e8 e8 ed ff ff       	call   800c53 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801e6b:	89 1c 24             	mov    %ebx,(%esp)
+  801e6e:	e8 55 f3 ff ff       	call   8011c8 <fd2data>
+  801e73:	83 c4 08             	add    $0x8,%esp
+  801e76:	50                   	push   %eax
+  801e77:	6a 00                	push   $0x0
+  801e79:	e8 d5 ed ff ff       	call   800c53 <sys_page_unmap>
+}
+  801e7e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e81:	c9                   	leave
+  801e82:	c3                   	ret
+
+00801e83 <_pipeisclosed>:
+{
+  801e83:	55                   	push   %ebp
+  801e84:	89 e5                	mov    %esp,%ebp
+  801e86:	57                   	push   %edi
+  801e87:	56                   	push   %esi
+  801e88:	53                   	push   %ebx
+  801e89:	83 ec 1c             	sub    $0x1c,%esp
+  801e8c:	89 c7                	mov    %eax,%edi
+  801e8e:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801e90:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  801e95:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801e98:	83 ec 0c             	sub    $0xc,%esp
+  801e9b:	57                   	push   %edi
+  801e9c:	e8 be 05 00 00       	call   80245f <pageref>
+  801ea1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801ea4:	89 34 24             	mov    %esi,(%esp)
+  801ea7:	e8 b3 05 00 00       	call   80245f <pageref>
+		nn = thisenv->env_runs;
+  801eac:	8b 15 0c 40 80 00    	mov    0x80400c,%edx
+  801eb2:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801eb5:	83 c4 10             	add    $0x10,%esp
+  801eb8:	39 cb                	cmp    %ecx,%ebx
+  801eba:	74 1b                	je     801ed7 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801ebc:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801ebf:	75 cf                	jne    801e90 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801ec1:	8b 42 58             	mov    0x58(%edx),%eax
+  801ec4:	6a 01                	push   $0x1
+  801ec6:	50                   	push   %eax
+  801ec7:	53                   	push   %ebx
+  801ec8:	68 ff 2e 80 00       	push   $0x802eff
+  801ecd:	e8 57 e3 ff ff       	call   800229 <cprintf>
+  801ed2:	83 c4 10             	add    $0x10,%esp
+  801ed5:	eb b9                	jmp    801e90 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801ed7:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801eda:	0f 94 c0             	sete   %al
+  801edd:	0f b6 c0             	movzbl %al,%eax
+}
+  801ee0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ee3:	5b                   	pop    %ebx
+  801ee4:	5e                   	pop    %esi
+  801ee5:	5f                   	pop    %edi
+  801ee6:	5d                   	pop    %ebp
+  801ee7:	c3                   	ret
+
+00801ee8 <devpipe_write>:
+{
+  801ee8:	55                   	push   %ebp
+  801ee9:	89 e5                	mov    %esp,%ebp
+  801eeb:	57                   	push   %edi
+  801eec:	56                   	push   %esi
+  801eed:	53                   	push   %ebx
+  801eee:	83 ec 28             	sub    $0x28,%esp
+  801ef1:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801ef4:	56                   	push   %esi
+  801ef5:	e8 ce f2 ff ff       	call   8011c8 <fd2data>
+  801efa:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801efc:	83 c4 10             	add    $0x10,%esp
+  801eff:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f04:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801f07:	75 09                	jne    801f12 <devpipe_write+0x2a>
+	return i;
+  801f09:	89 f8                	mov    %edi,%eax
+  801f0b:	eb 23                	jmp    801f30 <devpipe_write+0x48>
+			sys_yield();
+  801f0d:	e8 9d ec ff ff       	call   800baf <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801f12:	8b 43 04             	mov    0x4(%ebx),%eax
+  801f15:	8b 0b                	mov    (%ebx),%ecx
+  801f17:	8d 51 20             	lea    0x20(%ecx),%edx
+  801f1a:	39 d0                	cmp    %edx,%eax
+  801f1c:	72 1a                	jb     801f38 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  801f1e:	89 da                	mov    %ebx,%edx
+  801f20:	89 f0                	mov    %esi,%eax
+  801f22:	e8 5c ff ff ff       	call   801e83 <_pipeisclosed>
+  801f27:	85 c0                	test   %eax,%eax
+  801f29:	74 e2                	je     801f0d <devpipe_write+0x25>
+				return 0;
+  801f2b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f30:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f33:	5b                   	pop    %ebx
+  801f34:	5e                   	pop    %esi
+  801f35:	5f                   	pop    %edi
+  801f36:	5d                   	pop    %ebp
+  801f37:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801f38:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f3b:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801f3f:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801f42:	89 c2                	mov    %eax,%edx
+  801f44:	c1 fa 1f             	sar    $0x1f,%edx
+  801f47:	89 d1                	mov    %edx,%ecx
+  801f49:	c1 e9 1b             	shr    $0x1b,%ecx
+  801f4c:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801f4f:	83 e2 1f             	and    $0x1f,%edx
+  801f52:	29 ca                	sub    %ecx,%edx
+  801f54:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801f58:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  801f5c:	83 c0 01             	add    $0x1,%eax
+  801f5f:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  801f62:	83 c7 01             	add    $0x1,%edi
+  801f65:	eb 9d                	jmp    801f04 <devpipe_write+0x1c>
+
+00801f67 <devpipe_read>:
+{
+  801f67:	55                   	push   %ebp
+  801f68:	89 e5                	mov    %esp,%ebp
+  801f6a:	57                   	push   %edi
+  801f6b:	56                   	push   %esi
+  801f6c:	53                   	push   %ebx
+  801f6d:	83 ec 18             	sub    $0x18,%esp
+  801f70:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  801f73:	57                   	push   %edi
+  801f74:	e8 4f f2 ff ff       	call   8011c8 <fd2data>
+  801f79:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801f7b:	83 c4 10             	add    $0x10,%esp
+  801f7e:	be 00 00 00 00       	mov    $0x0,%esi
+  801f83:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801f86:	75 13                	jne    801f9b <devpipe_read+0x34>
+	return i;
+  801f88:	89 f0                	mov    %esi,%eax
+  801f8a:	eb 02                	jmp    801f8e <devpipe_read+0x27>
+				return i;
+  801f8c:	89 f0                	mov    %esi,%eax
+}
+  801f8e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f91:	5b                   	pop    %ebx
+  801f92:	5e                   	pop    %esi
+  801f93:	5f                   	pop    %edi
+  801f94:	5d                   	pop    %ebp
+  801f95:	c3                   	ret
+			sys_yield();
+  801f96:	e8 14 ec ff ff       	call   800baf <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  801f9b:	8b 03                	mov    (%ebx),%eax
+  801f9d:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801fa0:	75 18                	jne    801fba <devpipe_read+0x53>
+			if (i > 0)
+  801fa2:	85 f6                	test   %esi,%esi
+  801fa4:	75 e6                	jne    801f8c <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  801fa6:	89 da                	mov    %ebx,%edx
+  801fa8:	89 f8                	mov    %edi,%eax
+  801faa:	e8 d4 fe ff ff       	call   801e83 <_pipeisclosed>
+  801faf:	85 c0                	test   %eax,%eax
+  801fb1:	74 e3                	je     801f96 <devpipe_read+0x2f>
+				return 0;
+  801fb3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fb8:	eb d4                	jmp    801f8e <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801fba:	99                   	cltd
+  801fbb:	c1 ea 1b             	shr    $0x1b,%edx
+  801fbe:	01 d0                	add    %edx,%eax
+  801fc0:	83 e0 1f             	and    $0x1f,%eax
+  801fc3:	29 d0                	sub    %edx,%eax
+  801fc5:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801fca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801fcd:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  801fd0:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  801fd3:	83 c6 01             	add    $0x1,%esi
+  801fd6:	eb ab                	jmp    801f83 <devpipe_read+0x1c>
+
+00801fd8 <pipe>:
+{
+  801fd8:	55                   	push   %ebp
+  801fd9:	89 e5                	mov    %esp,%ebp
+  801fdb:	56                   	push   %esi
+  801fdc:	53                   	push   %ebx
+  801fdd:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801fe0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fe3:	50                   	push   %eax
+  801fe4:	e8 f6 f1 ff ff       	call   8011df <fd_alloc>
+  801fe9:	89 c3                	mov    %eax,%ebx
+  801feb:	83 c4 10             	add    $0x10,%esp
+  801fee:	85 c0                	test   %eax,%eax
+  801ff0:	0f 88 23 01 00 00    	js     802119 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801ff6:	83 ec 04             	sub    $0x4,%esp
+  801ff9:	68 07 04 00 00       	push   $0x407
+  801ffe:	ff 75 f4             	push   -0xc(%ebp)
+  802001:	6a 00                	push   $0x0
+  802003:	e8 c6 eb ff ff       	call   800bce <sys_page_alloc>
+  802008:	89 c3                	mov    %eax,%ebx
+  80200a:	83 c4 10             	add    $0x10,%esp
+  80200d:	85 c0                	test   %eax,%eax
+  80200f:	0f 88 04 01 00 00    	js     802119 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802015:	83 ec 0c             	sub    $0xc,%esp
+  802018:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80201b:	50                   	push   %eax
+  80201c:	e8 be f1 ff ff       	call   8011df <fd_alloc>
+  802021:	89 c3                	mov    %eax,%ebx
+  802023:	83 c4 10             	add    $0x10,%esp
+  802026:	85 c0                	test   %eax,%eax
+  802028:	0f 88 db 00 00 00    	js     802109 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80202e:	83 ec 04             	sub    $0x4,%esp
+  802031:	68 07 04 00 00       	push   $0x407
+  802036:	ff 75 f0             	push   -0x10(%ebp)
+  802039:	6a 00                	push   $0x0
+  80203b:	e8 8e eb ff ff       	call   800bce <sys_page_alloc>
+  802040:	89 c3                	mov    %eax,%ebx
+  802042:	83 c4 10             	add    $0x10,%esp
+  802045:	85 c0                	test   %eax,%eax
+  802047:	0f 88 bc 00 00 00    	js     802109 <pipe+0x131>
+	va = fd2data(fd0);
+  80204d:	83 ec 0c             	sub    $0xc,%esp
+  802050:	ff 75 f4             	push   -0xc(%ebp)
+  802053:	e8 70 f1 ff ff       	call   8011c8 <fd2data>
+  802058:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80205a:	83 c4 0c             	add    $0xc,%esp
+  80205d:	68 07 04 00 00       	push   $0x407
+  802062:	50                   	push   %eax
+  802063:	6a 00                	push   $0x0
+  802065:	e8 64 eb ff ff       	call   800bce <sys_page_alloc>
+  80206a:	89 c3                	mov    %eax,%ebx
+  80206c:	83 c4 10             	add    $0x10,%esp
+  80206f:	85 c0                	test   %eax,%eax
+  802071:	0f 88 82 00 00 00    	js     8020f9 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802077:	83 ec 0c             	sub    $0xc,%esp
+  80207a:	ff 75 f0             	push   -0x10(%ebp)
+  80207d:	e8 46 f1 ff ff       	call   8011c8 <fd2data>
+  802082:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802089:	50                   	push   %eax
+  80208a:	6a 00                	push   $0x0
+  80208c:	56                   	push   %esi
+  80208d:	6a 00                	push   $0x0
+  80208f:	e8 7d eb ff ff       	call   800c11 <sys_page_map>
+  802094:	89 c3                	mov    %eax,%ebx
+  802096:	83 c4 20             	add    $0x20,%esp
+  802099:	85 c0                	test   %eax,%eax
+  80209b:	78 4e                	js     8020eb <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80209d:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  8020a2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8020a5:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8020a7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8020aa:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8020b1:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8020b4:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8020b6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8020b9:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8020c0:	83 ec 0c             	sub    $0xc,%esp
+  8020c3:	ff 75 f4             	push   -0xc(%ebp)
+  8020c6:	e8 ed f0 ff ff       	call   8011b8 <fd2num>
+  8020cb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8020ce:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8020d0:	83 c4 04             	add    $0x4,%esp
+  8020d3:	ff 75 f0             	push   -0x10(%ebp)
+  8020d6:	e8 dd f0 ff ff       	call   8011b8 <fd2num>
+  8020db:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8020de:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8020e1:	83 c4 10             	add    $0x10,%esp
+  8020e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8020e9:	eb 2e                	jmp    802119 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8020eb:	83 ec 08             	sub    $0x8,%esp
+  8020ee:	56                   	push   %esi
+  8020ef:	6a 00                	push   $0x0
+  8020f1:	e8 5d eb ff ff       	call   800c53 <sys_page_unmap>
+  8020f6:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8020f9:	83 ec 08             	sub    $0x8,%esp
+  8020fc:	ff 75 f0             	push   -0x10(%ebp)
+  8020ff:	6a 00                	push   $0x0
+  802101:	e8 4d eb ff ff       	call   800c53 <sys_page_unmap>
+  802106:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802109:	83 ec 08             	sub    $0x8,%esp
+  80210c:	ff 75 f4             	push   -0xc(%ebp)
+  80210f:	6a 00                	push   $0x0
+  802111:	e8 3d eb ff ff       	call   800c53 <sys_page_unmap>
+  802116:	83 c4 10             	add    $0x10,%esp
+}
+  802119:	89 d8                	mov    %ebx,%eax
+  80211b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80211e:	5b                   	pop    %ebx
+  80211f:	5e                   	pop    %esi
+  802120:	5d                   	pop    %ebp
+  802121:	c3                   	ret
+
+00802122 <pipeisclosed>:
+{
+  802122:	55                   	push   %ebp
+  802123:	89 e5                	mov    %esp,%ebp
+  802125:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802128:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80212b:	50                   	push   %eax
+  80212c:	ff 75 08             	push   0x8(%ebp)
+  80212f:	e8 01 f1 ff ff       	call   801235 <fd_lookup>
+  802134:	83 c4 10             	add    $0x10,%esp
+  802137:	85 c0                	test   %eax,%eax
+  802139:	78 18                	js     802153 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80213b:	83 ec 0c             	sub    $0xc,%esp
+  80213e:	ff 75 f4             	push   -0xc(%ebp)
+  802141:	e8 82 f0 ff ff       	call   8011c8 <fd2data>
+  802146:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802148:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80214b:	e8 33 fd ff ff       	call   801e83 <_pipeisclosed>
+  802150:	83 c4 10             	add    $0x10,%esp
+}
+  802153:	c9                   	leave
+  802154:	c3                   	ret
+
+00802155 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802155:	b8 00 00 00 00       	mov    $0x0,%eax
+  80215a:	c3                   	ret
+
+0080215b <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80215b:	55                   	push   %ebp
+  80215c:	89 e5                	mov    %esp,%ebp
+  80215e:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802161:	68 17 2f 80 00       	push   $0x802f17
+  802166:	ff 75 0c             	push   0xc(%ebp)
+  802169:	e8 74 e6 ff ff       	call   8007e2 <strcpy>
+	return 0;
+}
+  80216e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802173:	c9                   	leave
+  802174:	c3                   	ret
+
+00802175 <devcons_write>:
+{
+  802175:	55                   	push   %ebp
+  802176:	89 e5                	mov    %esp,%ebp
+  802178:	57                   	push   %edi
+  802179:	56                   	push   %esi
+  80217a:	53                   	push   %ebx
+  80217b:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802181:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802186:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80218c:	eb 2e                	jmp    8021bc <devcons_write+0x47>
+		m = n - tot;
+  80218e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802191:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802193:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802198:	39 c3                	cmp    %eax,%ebx
+  80219a:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80219d:	83 ec 04             	sub    $0x4,%esp
+  8021a0:	53                   	push   %ebx
+  8021a1:	89 f0                	mov    %esi,%eax
+  8021a3:	03 45 0c             	add    0xc(%ebp),%eax
+  8021a6:	50                   	push   %eax
+  8021a7:	57                   	push   %edi
+  8021a8:	e8 bb e7 ff ff       	call   800968 <memmove>
+		sys_cputs(buf, m);
+  8021ad:	83 c4 08             	add    $0x8,%esp
+  8021b0:	53                   	push   %ebx
+  8021b1:	57                   	push   %edi
+  8021b2:	e8 5b e9 ff ff       	call   800b12 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8021b7:	01 de                	add    %ebx,%esi
+  8021b9:	83 c4 10             	add    $0x10,%esp
+  8021bc:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8021bf:	72 cd                	jb     80218e <devcons_write+0x19>
+}
+  8021c1:	89 f0                	mov    %esi,%eax
+  8021c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021c6:	5b                   	pop    %ebx
+  8021c7:	5e                   	pop    %esi
+  8021c8:	5f                   	pop    %edi
+  8021c9:	5d                   	pop    %ebp
+  8021ca:	c3                   	ret
+
+008021cb <devcons_read>:
+{
+  8021cb:	55                   	push   %ebp
+  8021cc:	89 e5                	mov    %esp,%ebp
+  8021ce:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8021d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021d6:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8021da:	75 07                	jne    8021e3 <devcons_read+0x18>
+  8021dc:	eb 1f                	jmp    8021fd <devcons_read+0x32>
+		sys_yield();
+  8021de:	e8 cc e9 ff ff       	call   800baf <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8021e3:	e8 48 e9 ff ff       	call   800b30 <sys_cgetc>
+  8021e8:	85 c0                	test   %eax,%eax
+  8021ea:	74 f2                	je     8021de <devcons_read+0x13>
+	if (c < 0)
+  8021ec:	78 0f                	js     8021fd <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8021ee:	83 f8 04             	cmp    $0x4,%eax
+  8021f1:	74 0c                	je     8021ff <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8021f3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8021f6:	88 02                	mov    %al,(%edx)
+	return 1;
+  8021f8:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8021fd:	c9                   	leave
+  8021fe:	c3                   	ret
+		return 0;
+  8021ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  802204:	eb f7                	jmp    8021fd <devcons_read+0x32>
+
+00802206 <cputchar>:
+{
+  802206:	55                   	push   %ebp
+  802207:	89 e5                	mov    %esp,%ebp
+  802209:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80220c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80220f:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802212:	6a 01                	push   $0x1
+  802214:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802217:	50                   	push   %eax
+  802218:	e8 f5 e8 ff ff       	call   800b12 <sys_cputs>
+}
+  80221d:	83 c4 10             	add    $0x10,%esp
+  802220:	c9                   	leave
+  802221:	c3                   	ret
+
+00802222 <getchar>:
+{
+  802222:	55                   	push   %ebp
+  802223:	89 e5                	mov    %esp,%ebp
+  802225:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802228:	6a 01                	push   $0x1
+  80222a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80222d:	50                   	push   %eax
+  80222e:	6a 00                	push   $0x0
+  802230:	e8 66 f2 ff ff       	call   80149b <read>
+	if (r < 0)
+  802235:	83 c4 10             	add    $0x10,%esp
+  802238:	85 c0                	test   %eax,%eax
+  80223a:	78 06                	js     802242 <getchar+0x20>
+	if (r < 1)
+  80223c:	74 06                	je     802244 <getchar+0x22>
+	return c;
+  80223e:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802242:	c9                   	leave
+  802243:	c3                   	ret
+		return -E_EOF;
+  802244:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802249:	eb f7                	jmp    802242 <getchar+0x20>
+
+0080224b <iscons>:
+{
+  80224b:	55                   	push   %ebp
+  80224c:	89 e5                	mov    %esp,%ebp
+  80224e:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802251:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802254:	50                   	push   %eax
+  802255:	ff 75 08             	push   0x8(%ebp)
+  802258:	e8 d8 ef ff ff       	call   801235 <fd_lookup>
+  80225d:	83 c4 10             	add    $0x10,%esp
+  802260:	85 c0                	test   %eax,%eax
+  802262:	78 11                	js     802275 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802264:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802267:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  80226d:	39 10                	cmp    %edx,(%eax)
+  80226f:	0f 94 c0             	sete   %al
+  802272:	0f b6 c0             	movzbl %al,%eax
+}
+  802275:	c9                   	leave
+  802276:	c3                   	ret
+
+00802277 <opencons>:
+{
+  802277:	55                   	push   %ebp
+  802278:	89 e5                	mov    %esp,%ebp
+  80227a:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80227d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802280:	50                   	push   %eax
+  802281:	e8 59 ef ff ff       	call   8011df <fd_alloc>
+  802286:	83 c4 10             	add    $0x10,%esp
+  802289:	85 c0                	test   %eax,%eax
+  80228b:	78 3a                	js     8022c7 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80228d:	83 ec 04             	sub    $0x4,%esp
+  802290:	68 07 04 00 00       	push   $0x407
+  802295:	ff 75 f4             	push   -0xc(%ebp)
+  802298:	6a 00                	push   $0x0
+  80229a:	e8 2f e9 ff ff       	call   800bce <sys_page_alloc>
+  80229f:	83 c4 10             	add    $0x10,%esp
+  8022a2:	85 c0                	test   %eax,%eax
+  8022a4:	78 21                	js     8022c7 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8022a6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022a9:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  8022af:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8022b1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022b4:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8022bb:	83 ec 0c             	sub    $0xc,%esp
+  8022be:	50                   	push   %eax
+  8022bf:	e8 f4 ee ff ff       	call   8011b8 <fd2num>
+  8022c4:	83 c4 10             	add    $0x10,%esp
+}
+  8022c7:	c9                   	leave
+  8022c8:	c3                   	ret
+
+008022c9 <set_pgfault_handler>:
+// allocate an exception stack (one page of memory with its top
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf)) {
+  8022c9:	55                   	push   %ebp
+  8022ca:	89 e5                	mov    %esp,%ebp
+  8022cc:	83 ec 08             	sub    $0x8,%esp
+  int r;
+
+  if (_pgfault_handler == 0) {
+  8022cf:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  8022d6:	74 0a                	je     8022e2 <set_pgfault_handler+0x19>
+    if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)))
+      panic(" set_pgfault_handler sys_env_set_pgfault_upcall panic: %e\n", r);
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  8022d8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022db:	a3 00 70 80 00       	mov    %eax,0x807000
+
+
+}
+  8022e0:	c9                   	leave
+  8022e1:	c3                   	ret
+    if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)))
+  8022e2:	83 ec 04             	sub    $0x4,%esp
+  8022e5:	6a 07                	push   $0x7
+  8022e7:	68 00 f0 bf ee       	push   $0xeebff000
+  8022ec:	6a 00                	push   $0x0
+  8022ee:	e8 db e8 ff ff       	call   800bce <sys_page_alloc>
+  8022f3:	83 c4 10             	add    $0x10,%esp
+  8022f6:	85 c0                	test   %eax,%eax
+  8022f8:	75 28                	jne    802322 <set_pgfault_handler+0x59>
+    if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)))
+  8022fa:	83 ec 08             	sub    $0x8,%esp
+  8022fd:	68 34 23 80 00       	push   $0x802334
+  802302:	6a 00                	push   $0x0
+  802304:	e8 10 ea ff ff       	call   800d19 <sys_env_set_pgfault_upcall>
+  802309:	83 c4 10             	add    $0x10,%esp
+  80230c:	85 c0                	test   %eax,%eax
+  80230e:	74 c8                	je     8022d8 <set_pgfault_handler+0xf>
+      panic(" set_pgfault_handler sys_env_set_pgfault_upcall panic: %e\n", r);
+  802310:	50                   	push   %eax
+  802311:	68 54 2f 80 00       	push   $0x802f54
+  802316:	6a 22                	push   $0x22
+  802318:	68 8f 2f 80 00       	push   $0x802f8f
+  80231d:	e8 2c de ff ff       	call   80014e <_panic>
+      panic("set_pgfault_handler sys_page_alloc panic: %e\n", r);
+  802322:	50                   	push   %eax
+  802323:	68 24 2f 80 00       	push   $0x802f24
+  802328:	6a 20                	push   $0x20
+  80232a:	68 8f 2f 80 00       	push   $0x802f8f
+  80232f:	e8 1a de ff ff       	call   80014e <_panic>
+
+00802334 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  802334:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  802335:	a1 00 70 80 00       	mov    0x807000,%eax
+	call *%eax
+  80233a:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80233c:	83 c4 04             	add    $0x4,%esp
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	// push the trap-time %eip onto the trap-time stack
+    subl $0x4, 0x30(%esp) # for push eip
+  80233f:	83 6c 24 30 04       	subl   $0x4,0x30(%esp)
+    movl 0x30(%esp), %ebx #regular esp
+  802344:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+    movl 0x28(%esp), %eax #eip
+  802348:	8b 44 24 28          	mov    0x28(%esp),%eax
+    movl %eax, (%ebx)
+  80234c:	89 03                	mov    %eax,(%ebx)
+
+    // Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+    addl $8, %esp
+  80234e:	83 c4 08             	add    $0x8,%esp
+    popal
+  802351:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  802352:	83 c4 04             	add    $0x4,%esp
+	popfl
+  802355:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  802356:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  802357:	c3                   	ret
+
+00802358 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  802358:	55                   	push   %ebp
+  802359:	89 e5                	mov    %esp,%ebp
+  80235b:	56                   	push   %esi
+  80235c:	53                   	push   %ebx
+  80235d:	8b 75 08             	mov    0x8(%ebp),%esi
+  802360:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802363:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  802366:	85 c0                	test   %eax,%eax
+  802368:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80236d:	0f 44 c2             	cmove  %edx,%eax
+  802370:	83 ec 0c             	sub    $0xc,%esp
+  802373:	50                   	push   %eax
+  802374:	e8 05 ea ff ff       	call   800d7e <sys_ipc_recv>
+
+  if (from_env_store)
+  802379:	83 c4 10             	add    $0x10,%esp
+  80237c:	85 f6                	test   %esi,%esi
+  80237e:	74 17                	je     802397 <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  802380:	ba 00 00 00 00       	mov    $0x0,%edx
+  802385:	85 c0                	test   %eax,%eax
+  802387:	75 0c                	jne    802395 <ipc_recv+0x3d>
+  802389:	8b 15 0c 40 80 00    	mov    0x80400c,%edx
+  80238f:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  802395:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  802397:	85 db                	test   %ebx,%ebx
+  802399:	74 2b                	je     8023c6 <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  80239b:	85 c0                	test   %eax,%eax
+  80239d:	74 0d                	je     8023ac <ipc_recv+0x54>
+  80239f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  8023a5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023a8:	5b                   	pop    %ebx
+  8023a9:	5e                   	pop    %esi
+  8023aa:	5d                   	pop    %ebp
+  8023ab:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  8023ac:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  8023b1:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8023b7:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  8023b9:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  8023be:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  8023c4:	eb df                	jmp    8023a5 <ipc_recv+0x4d>
+  8023c6:	85 c0                	test   %eax,%eax
+  8023c8:	75 db                	jne    8023a5 <ipc_recv+0x4d>
+  8023ca:	eb ed                	jmp    8023b9 <ipc_recv+0x61>
+
+008023cc <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  8023cc:	55                   	push   %ebp
+  8023cd:	89 e5                	mov    %esp,%ebp
+  8023cf:	57                   	push   %edi
+  8023d0:	56                   	push   %esi
+  8023d1:	53                   	push   %ebx
+  8023d2:	83 ec 0c             	sub    $0xc,%esp
+  8023d5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8023d8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8023db:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  8023de:	85 db                	test   %ebx,%ebx
+  8023e0:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8023e5:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  8023e8:	ff 75 14             	push   0x14(%ebp)
+  8023eb:	53                   	push   %ebx
+  8023ec:	56                   	push   %esi
+  8023ed:	57                   	push   %edi
+  8023ee:	e8 68 e9 ff ff       	call   800d5b <sys_ipc_try_send>
+  8023f3:	83 c4 10             	add    $0x10,%esp
+  8023f6:	85 c0                	test   %eax,%eax
+  8023f8:	74 1e                	je     802418 <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  8023fa:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8023fd:	75 07                	jne    802406 <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  8023ff:	e8 ab e7 ff ff       	call   800baf <sys_yield>
+  802404:	eb e2                	jmp    8023e8 <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  802406:	50                   	push   %eax
+  802407:	68 9d 2f 80 00       	push   $0x802f9d
+  80240c:	6a 3c                	push   $0x3c
+  80240e:	68 aa 2f 80 00       	push   $0x802faa
+  802413:	e8 36 dd ff ff       	call   80014e <_panic>
+  }
+
+#endif
+}
+  802418:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80241b:	5b                   	pop    %ebx
+  80241c:	5e                   	pop    %esi
+  80241d:	5f                   	pop    %edi
+  80241e:	5d                   	pop    %ebp
+  80241f:	c3                   	ret
+
+00802420 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  802420:	55                   	push   %ebp
+  802421:	89 e5                	mov    %esp,%ebp
+  802423:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  802426:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  80242b:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80242e:	c1 e0 04             	shl    $0x4,%eax
+  802431:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802436:	8b 40 50             	mov    0x50(%eax),%eax
+  802439:	39 c8                	cmp    %ecx,%eax
+  80243b:	74 12                	je     80244f <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  80243d:	83 c2 01             	add    $0x1,%edx
+  802440:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802446:	75 e3                	jne    80242b <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802448:	b8 00 00 00 00       	mov    $0x0,%eax
+  80244d:	eb 0e                	jmp    80245d <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  80244f:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802452:	c1 e0 04             	shl    $0x4,%eax
+  802455:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80245a:	8b 40 48             	mov    0x48(%eax),%eax
+  80245d:	5d                   	pop    %ebp
+  80245e:	c3                   	ret
+
+0080245f <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80245f:	55                   	push   %ebp
+  802460:	89 e5                	mov    %esp,%ebp
+  802462:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802465:	89 c2                	mov    %eax,%edx
+  802467:	c1 ea 16             	shr    $0x16,%edx
+  80246a:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802471:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802476:	f6 c1 01             	test   $0x1,%cl
+  802479:	74 1c                	je     802497 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  80247b:	c1 e8 0c             	shr    $0xc,%eax
+  80247e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802485:	a8 01                	test   $0x1,%al
+  802487:	74 0e                	je     802497 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802489:	c1 e8 0c             	shr    $0xc,%eax
+  80248c:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802493:	ef 
+  802494:	0f b7 d2             	movzwl %dx,%edx
+}
+  802497:	89 d0                	mov    %edx,%eax
+  802499:	5d                   	pop    %ebp
+  80249a:	c3                   	ret
+  80249b:	66 90                	xchg   %ax,%ax
+  80249d:	66 90                	xchg   %ax,%ax
+  80249f:	90                   	nop
+
+008024a0 <__udivmoddi4>:
+  8024a0:	55                   	push   %ebp
+  8024a1:	57                   	push   %edi
+  8024a2:	56                   	push   %esi
+  8024a3:	53                   	push   %ebx
+  8024a4:	83 ec 24             	sub    $0x24,%esp
+  8024a7:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8024ab:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8024af:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  8024b3:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8024b7:	8b 54 24 44          	mov    0x44(%esp),%edx
+  8024bb:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8024bf:	8b 44 24 40          	mov    0x40(%esp),%eax
+  8024c3:	89 d3                	mov    %edx,%ebx
+  8024c5:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8024c9:	09 c3                	or     %eax,%ebx
+  8024cb:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8024cf:	0f 84 9c 00 00 00    	je     802571 <__udivmoddi4+0xd1>
+  8024d5:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8024dc:	00 
+  8024dd:	31 c0                	xor    %eax,%eax
+  8024df:	31 d2                	xor    %edx,%edx
+  8024e1:	89 fb                	mov    %edi,%ebx
+  8024e3:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8024ea:	00 
+  8024eb:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8024f0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8024f4:	01 c0                	add    %eax,%eax
+  8024f6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8024fd:	00 
+  8024fe:	89 c6                	mov    %eax,%esi
+  802500:	89 d7                	mov    %edx,%edi
+  802502:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802506:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80250a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80250d:	d3 ea                	shr    %cl,%edx
+  80250f:	f6 c1 20             	test   $0x20,%cl
+  802512:	0f 45 c2             	cmovne %edx,%eax
+  802515:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802519:	83 e0 01             	and    $0x1,%eax
+  80251c:	09 fa                	or     %edi,%edx
+  80251e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802522:	89 04 24             	mov    %eax,(%esp)
+  802525:	8b 04 24             	mov    (%esp),%eax
+  802528:	89 d5                	mov    %edx,%ebp
+  80252a:	09 f0                	or     %esi,%eax
+  80252c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802530:	39 f0                	cmp    %esi,%eax
+  802532:	19 fd                	sbb    %edi,%ebp
+  802534:	72 1d                	jb     802553 <__udivmoddi4+0xb3>
+  802536:	29 f0                	sub    %esi,%eax
+  802538:	19 fa                	sbb    %edi,%edx
+  80253a:	89 cf                	mov    %ecx,%edi
+  80253c:	c1 ef 05             	shr    $0x5,%edi
+  80253f:	83 e7 01             	and    $0x1,%edi
+  802542:	89 fe                	mov    %edi,%esi
+  802544:	d3 e7                	shl    %cl,%edi
+  802546:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80254a:	83 f6 01             	xor    $0x1,%esi
+  80254d:	d3 e6                	shl    %cl,%esi
+  80254f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802553:	83 e9 01             	sub    $0x1,%ecx
+  802556:	73 98                	jae    8024f0 <__udivmoddi4+0x50>
+  802558:	85 db                	test   %ebx,%ebx
+  80255a:	74 05                	je     802561 <__udivmoddi4+0xc1>
+  80255c:	89 03                	mov    %eax,(%ebx)
+  80255e:	89 53 04             	mov    %edx,0x4(%ebx)
+  802561:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802565:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802569:	83 c4 24             	add    $0x24,%esp
+  80256c:	5b                   	pop    %ebx
+  80256d:	5e                   	pop    %esi
+  80256e:	5f                   	pop    %edi
+  80256f:	5d                   	pop    %ebp
+  802570:	c3                   	ret
+  802571:	85 ff                	test   %edi,%edi
+  802573:	74 0d                	je     802582 <__udivmoddi4+0xe2>
+  802575:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  80257b:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  802582:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802586:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80258a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80258e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802592:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802596:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80259a:	83 c4 24             	add    $0x24,%esp
+  80259d:	5b                   	pop    %ebx
+  80259e:	5e                   	pop    %esi
+  80259f:	5f                   	pop    %edi
+  8025a0:	5d                   	pop    %ebp
+  8025a1:	c3                   	ret
+  8025a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8025a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+008025b0 <__udivdi3>:
+  8025b0:	57                   	push   %edi
+  8025b1:	56                   	push   %esi
+  8025b2:	53                   	push   %ebx
+  8025b3:	83 ec 20             	sub    $0x20,%esp
+  8025b6:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8025ba:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8025be:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8025c2:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8025c6:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8025ca:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8025ce:	89 d1                	mov    %edx,%ecx
+  8025d0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8025d4:	09 c1                	or     %eax,%ecx
+  8025d6:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8025da:	89 44 24 18          	mov    %eax,0x18(%esp)
+  8025de:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  8025e2:	0f 84 88 00 00 00    	je     802670 <__udivdi3+0xc0>
+  8025e8:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8025ef:	00 
+  8025f0:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8025f5:	31 c0                	xor    %eax,%eax
+  8025f7:	31 d2                	xor    %edx,%edx
+  8025f9:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802600:	00 
+  802601:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802608:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80260c:	01 c0                	add    %eax,%eax
+  80260e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802615:	00 
+  802616:	89 c6                	mov    %eax,%esi
+  802618:	89 d7                	mov    %edx,%edi
+  80261a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80261e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802622:	0f ad d0             	shrd   %cl,%edx,%eax
+  802625:	d3 ea                	shr    %cl,%edx
+  802627:	f6 c1 20             	test   $0x20,%cl
+  80262a:	0f 45 c2             	cmovne %edx,%eax
+  80262d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802631:	83 e0 01             	and    $0x1,%eax
+  802634:	09 fa                	or     %edi,%edx
+  802636:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80263a:	89 04 24             	mov    %eax,(%esp)
+  80263d:	8b 04 24             	mov    (%esp),%eax
+  802640:	89 d3                	mov    %edx,%ebx
+  802642:	09 f0                	or     %esi,%eax
+  802644:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802648:	39 f0                	cmp    %esi,%eax
+  80264a:	19 fb                	sbb    %edi,%ebx
+  80264c:	72 1d                	jb     80266b <__udivdi3+0xbb>
+  80264e:	29 f0                	sub    %esi,%eax
+  802650:	19 fa                	sbb    %edi,%edx
+  802652:	89 cf                	mov    %ecx,%edi
+  802654:	c1 ef 05             	shr    $0x5,%edi
+  802657:	83 e7 01             	and    $0x1,%edi
+  80265a:	89 fe                	mov    %edi,%esi
+  80265c:	d3 e7                	shl    %cl,%edi
+  80265e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802662:	83 f6 01             	xor    $0x1,%esi
+  802665:	d3 e6                	shl    %cl,%esi
+  802667:	09 74 24 18          	or     %esi,0x18(%esp)
+  80266b:	83 e9 01             	sub    $0x1,%ecx
+  80266e:	73 98                	jae    802608 <__udivdi3+0x58>
+  802670:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802674:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802678:	83 c4 20             	add    $0x20,%esp
+  80267b:	5b                   	pop    %ebx
+  80267c:	5e                   	pop    %esi
+  80267d:	5f                   	pop    %edi
+  80267e:	c3                   	ret
+  80267f:	90                   	nop
+
+00802680 <__umoddi3>:
+  802680:	57                   	push   %edi
+  802681:	56                   	push   %esi
+  802682:	53                   	push   %ebx
+  802683:	83 ec 18             	sub    $0x18,%esp
+  802686:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80268a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80268e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802692:	8b 54 24 34          	mov    0x34(%esp),%edx
+  802696:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80269a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80269e:	89 d1                	mov    %edx,%ecx
+  8026a0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8026a4:	09 c1                	or     %eax,%ecx
+  8026a6:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8026aa:	74 5b                	je     802707 <__umoddi3+0x87>
+  8026ac:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8026b1:	31 c0                	xor    %eax,%eax
+  8026b3:	31 d2                	xor    %edx,%edx
+  8026b5:	8d 76 00             	lea    0x0(%esi),%esi
+  8026b8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8026bc:	01 c0                	add    %eax,%eax
+  8026be:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8026c5:	00 
+  8026c6:	89 c6                	mov    %eax,%esi
+  8026c8:	89 d7                	mov    %edx,%edi
+  8026ca:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8026ce:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8026d2:	0f ad d0             	shrd   %cl,%edx,%eax
+  8026d5:	d3 ea                	shr    %cl,%edx
+  8026d7:	f6 c1 20             	test   $0x20,%cl
+  8026da:	0f 45 c2             	cmovne %edx,%eax
+  8026dd:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8026e1:	83 e0 01             	and    $0x1,%eax
+  8026e4:	09 fa                	or     %edi,%edx
+  8026e6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8026ea:	89 04 24             	mov    %eax,(%esp)
+  8026ed:	8b 04 24             	mov    (%esp),%eax
+  8026f0:	89 d3                	mov    %edx,%ebx
+  8026f2:	09 f0                	or     %esi,%eax
+  8026f4:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8026f8:	39 f0                	cmp    %esi,%eax
+  8026fa:	19 fb                	sbb    %edi,%ebx
+  8026fc:	72 04                	jb     802702 <__umoddi3+0x82>
+  8026fe:	29 f0                	sub    %esi,%eax
+  802700:	19 fa                	sbb    %edi,%edx
+  802702:	83 e9 01             	sub    $0x1,%ecx
+  802705:	73 b1                	jae    8026b8 <__umoddi3+0x38>
+  802707:	83 c4 18             	add    $0x18,%esp
+  80270a:	5b                   	pop    %ebx
+  80270b:	5e                   	pop    %esi
+  80270c:	5f                   	pop    %edi
+  80270d:	c3                   	ret
+  80270e:	66 90                	xchg   %ax,%ax
+
+00802710 <__divdi3>:
+  802710:	55                   	push   %ebp
+  802711:	57                   	push   %edi
+  802712:	56                   	push   %esi
+  802713:	53                   	push   %ebx
+  802714:	83 ec 24             	sub    $0x24,%esp
+  802717:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  80271b:	8b 74 24 44          	mov    0x44(%esp),%esi
+  80271f:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802723:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802727:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  80272b:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  80272f:	85 d2                	test   %edx,%edx
+  802731:	0f 88 e0 00 00 00    	js     802817 <__divdi3+0x107>
+  802737:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  80273b:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  80273f:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802743:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802747:	85 f6                	test   %esi,%esi
+  802749:	78 16                	js     802761 <__divdi3+0x51>
+  80274b:	89 f1                	mov    %esi,%ecx
+  80274d:	31 c0                	xor    %eax,%eax
+  80274f:	31 d2                	xor    %edx,%edx
+  802751:	09 d9                	or     %ebx,%ecx
+  802753:	0f 85 f3 00 00 00    	jne    80284c <__divdi3+0x13c>
+  802759:	83 c4 24             	add    $0x24,%esp
+  80275c:	5b                   	pop    %ebx
+  80275d:	5e                   	pop    %esi
+  80275e:	5f                   	pop    %edi
+  80275f:	5d                   	pop    %ebp
+  802760:	c3                   	ret
+  802761:	bf 01 00 00 00       	mov    $0x1,%edi
+  802766:	f7 5c 24 08          	negl   0x8(%esp)
+  80276a:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  80276f:	f7 5c 24 0c          	negl   0xc(%esp)
+  802773:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80277a:	00 
+  80277b:	31 c0                	xor    %eax,%eax
+  80277d:	31 d2                	xor    %edx,%edx
+  80277f:	89 fb                	mov    %edi,%ebx
+  802781:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802788:	00 
+  802789:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80278e:	66 90                	xchg   %ax,%ax
+  802790:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802794:	01 c0                	add    %eax,%eax
+  802796:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80279d:	00 
+  80279e:	89 c6                	mov    %eax,%esi
+  8027a0:	89 d7                	mov    %edx,%edi
+  8027a2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8027a6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8027aa:	0f ad d0             	shrd   %cl,%edx,%eax
+  8027ad:	d3 ea                	shr    %cl,%edx
+  8027af:	f6 c1 20             	test   $0x20,%cl
+  8027b2:	0f 45 c2             	cmovne %edx,%eax
+  8027b5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8027b9:	83 e0 01             	and    $0x1,%eax
+  8027bc:	09 fa                	or     %edi,%edx
+  8027be:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8027c2:	89 04 24             	mov    %eax,(%esp)
+  8027c5:	8b 04 24             	mov    (%esp),%eax
+  8027c8:	89 d5                	mov    %edx,%ebp
+  8027ca:	09 f0                	or     %esi,%eax
+  8027cc:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8027d0:	39 f0                	cmp    %esi,%eax
+  8027d2:	19 fd                	sbb    %edi,%ebp
+  8027d4:	72 1d                	jb     8027f3 <__divdi3+0xe3>
+  8027d6:	29 f0                	sub    %esi,%eax
+  8027d8:	19 fa                	sbb    %edi,%edx
+  8027da:	89 cf                	mov    %ecx,%edi
+  8027dc:	c1 ef 05             	shr    $0x5,%edi
+  8027df:	83 e7 01             	and    $0x1,%edi
+  8027e2:	89 fe                	mov    %edi,%esi
+  8027e4:	d3 e7                	shl    %cl,%edi
+  8027e6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8027ea:	83 f6 01             	xor    $0x1,%esi
+  8027ed:	d3 e6                	shl    %cl,%esi
+  8027ef:	09 74 24 18          	or     %esi,0x18(%esp)
+  8027f3:	83 e9 01             	sub    $0x1,%ecx
+  8027f6:	73 98                	jae    802790 <__divdi3+0x80>
+  8027f8:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8027fc:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802800:	85 db                	test   %ebx,%ebx
+  802802:	0f 84 51 ff ff ff    	je     802759 <__divdi3+0x49>
+  802808:	f7 d8                	neg    %eax
+  80280a:	83 d2 00             	adc    $0x0,%edx
+  80280d:	83 c4 24             	add    $0x24,%esp
+  802810:	5b                   	pop    %ebx
+  802811:	f7 da                	neg    %edx
+  802813:	5e                   	pop    %esi
+  802814:	5f                   	pop    %edi
+  802815:	5d                   	pop    %ebp
+  802816:	c3                   	ret
+  802817:	f7 d8                	neg    %eax
+  802819:	83 d2 00             	adc    $0x0,%edx
+  80281c:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802820:	f7 da                	neg    %edx
+  802822:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802826:	85 f6                	test   %esi,%esi
+  802828:	78 1b                	js     802845 <__divdi3+0x135>
+  80282a:	89 f1                	mov    %esi,%ecx
+  80282c:	31 c0                	xor    %eax,%eax
+  80282e:	31 d2                	xor    %edx,%edx
+  802830:	bf 01 00 00 00       	mov    $0x1,%edi
+  802835:	09 d9                	or     %ebx,%ecx
+  802837:	0f 85 36 ff ff ff    	jne    802773 <__divdi3+0x63>
+  80283d:	83 c4 24             	add    $0x24,%esp
+  802840:	5b                   	pop    %ebx
+  802841:	5e                   	pop    %esi
+  802842:	5f                   	pop    %edi
+  802843:	5d                   	pop    %ebp
+  802844:	c3                   	ret
+  802845:	31 ff                	xor    %edi,%edi
+  802847:	e9 1a ff ff ff       	jmp    802766 <__divdi3+0x56>
+  80284c:	31 ff                	xor    %edi,%edi
+  80284e:	e9 20 ff ff ff       	jmp    802773 <__divdi3+0x63>
+  802853:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80285a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00802860 <__moddi3>:
+  802860:	55                   	push   %ebp
+  802861:	57                   	push   %edi
+  802862:	56                   	push   %esi
+  802863:	53                   	push   %ebx
+  802864:	83 ec 1c             	sub    $0x1c,%esp
+  802867:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  80286b:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  80286f:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  802873:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  802877:	89 c8                	mov    %ecx,%eax
+  802879:	89 f2                	mov    %esi,%edx
+  80287b:	89 f3                	mov    %esi,%ebx
+  80287d:	85 ed                	test   %ebp,%ebp
+  80287f:	0f 88 9d 00 00 00    	js     802922 <__moddi3+0xc2>
+  802885:	09 cb                	or     %ecx,%ebx
+  802887:	0f 84 8d 00 00 00    	je     80291a <__moddi3+0xba>
+  80288d:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802891:	31 db                	xor    %ebx,%ebx
+  802893:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802897:	89 ca                	mov    %ecx,%edx
+  802899:	89 f0                	mov    %esi,%eax
+  80289b:	89 dd                	mov    %ebx,%ebp
+  80289d:	f7 da                	neg    %edx
+  80289f:	83 d0 00             	adc    $0x0,%eax
+  8028a2:	f7 d8                	neg    %eax
+  8028a4:	0f 49 f0             	cmovns %eax,%esi
+  8028a7:	0f 49 ca             	cmovns %edx,%ecx
+  8028aa:	31 c0                	xor    %eax,%eax
+  8028ac:	31 d2                	xor    %edx,%edx
+  8028ae:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8028b2:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  8028b6:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8028bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  8028bf:	90                   	nop
+  8028c0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8028c4:	01 c0                	add    %eax,%eax
+  8028c6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8028cd:	00 
+  8028ce:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  8028d2:	89 c6                	mov    %eax,%esi
+  8028d4:	89 d7                	mov    %edx,%edi
+  8028d6:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8028da:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8028de:	0f ad d0             	shrd   %cl,%edx,%eax
+  8028e1:	d3 ea                	shr    %cl,%edx
+  8028e3:	f6 c1 20             	test   $0x20,%cl
+  8028e6:	0f 45 c2             	cmovne %edx,%eax
+  8028e9:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8028ed:	83 e0 01             	and    $0x1,%eax
+  8028f0:	09 fa                	or     %edi,%edx
+  8028f2:	89 04 24             	mov    %eax,(%esp)
+  8028f5:	8b 04 24             	mov    (%esp),%eax
+  8028f8:	89 d7                	mov    %edx,%edi
+  8028fa:	09 f0                	or     %esi,%eax
+  8028fc:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  802900:	39 d8                	cmp    %ebx,%eax
+  802902:	19 f7                	sbb    %esi,%edi
+  802904:	72 04                	jb     80290a <__moddi3+0xaa>
+  802906:	29 d8                	sub    %ebx,%eax
+  802908:	19 f2                	sbb    %esi,%edx
+  80290a:	83 e9 01             	sub    $0x1,%ecx
+  80290d:	73 b1                	jae    8028c0 <__moddi3+0x60>
+  80290f:	85 ed                	test   %ebp,%ebp
+  802911:	74 07                	je     80291a <__moddi3+0xba>
+  802913:	f7 d8                	neg    %eax
+  802915:	83 d2 00             	adc    $0x0,%edx
+  802918:	f7 da                	neg    %edx
+  80291a:	83 c4 1c             	add    $0x1c,%esp
+  80291d:	5b                   	pop    %ebx
+  80291e:	5e                   	pop    %esi
+  80291f:	5f                   	pop    %edi
+  802920:	5d                   	pop    %ebp
+  802921:	c3                   	ret
+  802922:	09 cb                	or     %ecx,%ebx
+  802924:	74 f4                	je     80291a <__moddi3+0xba>
+  802926:	f7 df                	neg    %edi
+  802928:	bb 01 00 00 00       	mov    $0x1,%ebx
+  80292d:	83 d5 00             	adc    $0x0,%ebp
+  802930:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802934:	f7 dd                	neg    %ebp
+  802936:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  80293a:	e9 58 ff ff ff       	jmp    802897 <__moddi3+0x37>
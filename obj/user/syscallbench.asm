@@ -0,0 +1,5351 @@
+
+obj/user/syscallbench.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 c9 00 00 00       	call   8000fa <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#define NCALL	100000
+#define NROUND	5
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t start, cycles, best = ~0ULL;
+	int i, round;
+
+	// Warm up the TLB and caches.
+	for (i = 0; i < 1000; i++)
+  80003c:	bb e9 03 00 00       	mov    $0x3e9,%ebx
+  800041:	eb 05                	jmp    800048 <umain+0x15>
+		sys_getenvid();
+  800043:	e8 11 0b 00 00       	call   800b59 <sys_getenvid>
+	for (i = 0; i < 1000; i++)
+  800048:	83 eb 01             	sub    $0x1,%ebx
+  80004b:	75 f6                	jne    800043 <umain+0x10>
+
+	for (round = 0; round < NROUND; round++) {
+  80004d:	bb 00 00 00 00       	mov    $0x0,%ebx
+	uint64_t start, cycles, best = ~0ULL;
+  800052:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+  800059:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  800060:	eb 5a                	jmp    8000bc <umain+0x89>
+		start = read_tsc();
+		for (i = 0; i < NCALL; i++)
+			sys_getenvid();
+  800062:	e8 f2 0a 00 00       	call   800b59 <sys_getenvid>
+		for (i = 0; i < NCALL; i++)
+  800067:	83 ee 01             	sub    $0x1,%esi
+  80006a:	75 f6                	jne    800062 <umain+0x2f>
+
+static inline uint64_t
+read_tsc(void)
+{
+	uint64_t tsc;
+	asm volatile("rdtsc" : "=A" (tsc));
+  80006c:	0f 31                	rdtsc
+		cycles = read_tsc() - start;
+  80006e:	2b 45 d8             	sub    -0x28(%ebp),%eax
+  800071:	1b 55 dc             	sbb    -0x24(%ebp),%edx
+  800074:	89 c6                	mov    %eax,%esi
+  800076:	89 d7                	mov    %edx,%edi
+		cprintf("round %d: %llu cycles per syscall\n",
+  800078:	6a 00                	push   $0x0
+  80007a:	68 a0 86 01 00       	push   $0x186a0
+  80007f:	52                   	push   %edx
+  800080:	50                   	push   %eax
+  800081:	e8 9a 21 00 00       	call   802220 <__udivdi3>
+  800086:	83 c4 10             	add    $0x10,%esp
+  800089:	52                   	push   %edx
+  80008a:	50                   	push   %eax
+  80008b:	53                   	push   %ebx
+  80008c:	68 c0 25 80 00       	push   $0x8025c0
+  800091:	e8 5c 01 00 00       	call   8001f2 <cprintf>
+			round, cycles / NCALL);
+		if (cycles < best)
+  800096:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800099:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80009c:	39 c6                	cmp    %eax,%esi
+  80009e:	89 f9                	mov    %edi,%ecx
+  8000a0:	19 d1                	sbb    %edx,%ecx
+  8000a2:	0f 42 c6             	cmovb  %esi,%eax
+  8000a5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8000a8:	89 f8                	mov    %edi,%eax
+  8000aa:	0f 43 45 e4          	cmovae -0x1c(%ebp),%eax
+  8000ae:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (round = 0; round < NROUND; round++) {
+  8000b1:	83 c3 01             	add    $0x1,%ebx
+  8000b4:	83 c4 10             	add    $0x10,%esp
+  8000b7:	83 fb 05             	cmp    $0x5,%ebx
+  8000ba:	74 0f                	je     8000cb <umain+0x98>
+  8000bc:	0f 31                	rdtsc
+  8000be:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8000c1:	89 55 dc             	mov    %edx,-0x24(%ebp)
+		for (i = 0; i < NCALL; i++)
+  8000c4:	be a1 86 01 00       	mov    $0x186a1,%esi
+  8000c9:	eb 9c                	jmp    800067 <umain+0x34>
+			best = cycles;
+	}
+	cprintf("syscallbench: best %llu cycles per null syscall\n",
+  8000cb:	83 ec 10             	sub    $0x10,%esp
+  8000ce:	6a 00                	push   $0x0
+  8000d0:	68 a0 86 01 00       	push   $0x186a0
+  8000d5:	ff 75 e4             	push   -0x1c(%ebp)
+  8000d8:	ff 75 e0             	push   -0x20(%ebp)
+  8000db:	e8 40 21 00 00       	call   802220 <__udivdi3>
+  8000e0:	83 c4 1c             	add    $0x1c,%esp
+  8000e3:	52                   	push   %edx
+  8000e4:	50                   	push   %eax
+  8000e5:	68 e4 25 80 00       	push   $0x8025e4
+  8000ea:	e8 03 01 00 00       	call   8001f2 <cprintf>
+		best / NCALL);
+}
+  8000ef:	83 c4 10             	add    $0x10,%esp
+  8000f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000f5:	5b                   	pop    %ebx
+  8000f6:	5e                   	pop    %esi
+  8000f7:	5f                   	pop    %edi
+  8000f8:	5d                   	pop    %ebp
+  8000f9:	c3                   	ret
+
+008000fa <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  8000fa:	55                   	push   %ebp
+  8000fb:	89 e5                	mov    %esp,%ebp
+  8000fd:	56                   	push   %esi
+  8000fe:	53                   	push   %ebx
+  8000ff:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800102:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  800105:	e8 4f 0a 00 00       	call   800b59 <sys_getenvid>
+  80010a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80010f:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800112:	c1 e0 04             	shl    $0x4,%eax
+  800115:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80011a:	a3 08 40 80 00       	mov    %eax,0x804008
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  80011f:	85 db                	test   %ebx,%ebx
+  800121:	7e 07                	jle    80012a <libmain+0x30>
+    binaryname = argv[0];
+  800123:	8b 06                	mov    (%esi),%eax
+  800125:	a3 00 30 80 00       	mov    %eax,0x803000
+
+  // call user main routine
+  umain(argc, argv);
+  80012a:	83 ec 08             	sub    $0x8,%esp
+  80012d:	56                   	push   %esi
+  80012e:	53                   	push   %ebx
+  80012f:	e8 ff fe ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  800134:	e8 0a 00 00 00       	call   800143 <exit>
+}
+  800139:	83 c4 10             	add    $0x10,%esp
+  80013c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80013f:	5b                   	pop    %ebx
+  800140:	5e                   	pop    %esi
+  800141:	5d                   	pop    %ebp
+  800142:	c3                   	ret
+
+00800143 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800143:	55                   	push   %ebp
+  800144:	89 e5                	mov    %esp,%ebp
+  800146:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800149:	e8 f0 0e 00 00       	call   80103e <close_all>
+	sys_env_destroy(0);
+  80014e:	83 ec 0c             	sub    $0xc,%esp
+  800151:	6a 00                	push   $0x0
+  800153:	e8 c0 09 00 00       	call   800b18 <sys_env_destroy>
+}
+  800158:	83 c4 10             	add    $0x10,%esp
+  80015b:	c9                   	leave
+  80015c:	c3                   	ret
+
+0080015d <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80015d:	55                   	push   %ebp
+  80015e:	89 e5                	mov    %esp,%ebp
+  800160:	53                   	push   %ebx
+  800161:	83 ec 04             	sub    $0x4,%esp
+  800164:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800167:	8b 13                	mov    (%ebx),%edx
+  800169:	8d 42 01             	lea    0x1(%edx),%eax
+  80016c:	89 03                	mov    %eax,(%ebx)
+  80016e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800171:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800175:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80017a:	74 09                	je     800185 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80017c:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800180:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800183:	c9                   	leave
+  800184:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800185:	83 ec 08             	sub    $0x8,%esp
+  800188:	68 ff 00 00 00       	push   $0xff
+  80018d:	8d 43 08             	lea    0x8(%ebx),%eax
+  800190:	50                   	push   %eax
+  800191:	e8 45 09 00 00       	call   800adb <sys_cputs>
+		b->idx = 0;
+  800196:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80019c:	83 c4 10             	add    $0x10,%esp
+  80019f:	eb db                	jmp    80017c <putch+0x1f>
+
+008001a1 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001a1:	55                   	push   %ebp
+  8001a2:	89 e5                	mov    %esp,%ebp
+  8001a4:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001aa:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001b1:	00 00 00 
+	b.cnt = 0;
+  8001b4:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001bb:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001be:	ff 75 0c             	push   0xc(%ebp)
+  8001c1:	ff 75 08             	push   0x8(%ebp)
+  8001c4:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001ca:	50                   	push   %eax
+  8001cb:	68 5d 01 80 00       	push   $0x80015d
+  8001d0:	e8 14 01 00 00       	call   8002e9 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8001d5:	83 c4 08             	add    $0x8,%esp
+  8001d8:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001de:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001e4:	50                   	push   %eax
+  8001e5:	e8 f1 08 00 00       	call   800adb <sys_cputs>
+
+	return b.cnt;
+}
+  8001ea:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001f0:	c9                   	leave
+  8001f1:	c3                   	ret
+
+008001f2 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001f2:	55                   	push   %ebp
+  8001f3:	89 e5                	mov    %esp,%ebp
+  8001f5:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8001f8:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8001fb:	50                   	push   %eax
+  8001fc:	ff 75 08             	push   0x8(%ebp)
+  8001ff:	e8 9d ff ff ff       	call   8001a1 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800204:	c9                   	leave
+  800205:	c3                   	ret
+
+00800206 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800206:	55                   	push   %ebp
+  800207:	89 e5                	mov    %esp,%ebp
+  800209:	57                   	push   %edi
+  80020a:	56                   	push   %esi
+  80020b:	53                   	push   %ebx
+  80020c:	83 ec 1c             	sub    $0x1c,%esp
+  80020f:	89 c7                	mov    %eax,%edi
+  800211:	89 d6                	mov    %edx,%esi
+  800213:	8b 45 08             	mov    0x8(%ebp),%eax
+  800216:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800219:	89 d1                	mov    %edx,%ecx
+  80021b:	89 c2                	mov    %eax,%edx
+  80021d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800220:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800223:	8b 45 10             	mov    0x10(%ebp),%eax
+  800226:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800229:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80022c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800233:	39 c2                	cmp    %eax,%edx
+  800235:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800238:	72 3e                	jb     800278 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80023a:	83 ec 0c             	sub    $0xc,%esp
+  80023d:	ff 75 18             	push   0x18(%ebp)
+  800240:	83 eb 01             	sub    $0x1,%ebx
+  800243:	53                   	push   %ebx
+  800244:	50                   	push   %eax
+  800245:	83 ec 08             	sub    $0x8,%esp
+  800248:	ff 75 e4             	push   -0x1c(%ebp)
+  80024b:	ff 75 e0             	push   -0x20(%ebp)
+  80024e:	ff 75 dc             	push   -0x24(%ebp)
+  800251:	ff 75 d8             	push   -0x28(%ebp)
+  800254:	e8 c7 1f 00 00       	call   802220 <__udivdi3>
+  800259:	83 c4 18             	add    $0x18,%esp
+  80025c:	52                   	push   %edx
+  80025d:	50                   	push   %eax
+  80025e:	89 f2                	mov    %esi,%edx
+  800260:	89 f8                	mov    %edi,%eax
+  800262:	e8 9f ff ff ff       	call   800206 <printnum>
+  800267:	83 c4 20             	add    $0x20,%esp
+  80026a:	eb 13                	jmp    80027f <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80026c:	83 ec 08             	sub    $0x8,%esp
+  80026f:	56                   	push   %esi
+  800270:	ff 75 18             	push   0x18(%ebp)
+  800273:	ff d7                	call   *%edi
+  800275:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800278:	83 eb 01             	sub    $0x1,%ebx
+  80027b:	85 db                	test   %ebx,%ebx
+  80027d:	7f ed                	jg     80026c <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80027f:	83 ec 08             	sub    $0x8,%esp
+  800282:	56                   	push   %esi
+  800283:	83 ec 04             	sub    $0x4,%esp
+  800286:	ff 75 e4             	push   -0x1c(%ebp)
+  800289:	ff 75 e0             	push   -0x20(%ebp)
+  80028c:	ff 75 dc             	push   -0x24(%ebp)
+  80028f:	ff 75 d8             	push   -0x28(%ebp)
+  800292:	e8 59 20 00 00       	call   8022f0 <__umoddi3>
+  800297:	83 c4 14             	add    $0x14,%esp
+  80029a:	0f be 80 1f 26 80 00 	movsbl 0x80261f(%eax),%eax
+  8002a1:	50                   	push   %eax
+  8002a2:	ff d7                	call   *%edi
+}
+  8002a4:	83 c4 10             	add    $0x10,%esp
+  8002a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002aa:	5b                   	pop    %ebx
+  8002ab:	5e                   	pop    %esi
+  8002ac:	5f                   	pop    %edi
+  8002ad:	5d                   	pop    %ebp
+  8002ae:	c3                   	ret
+
+008002af <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002af:	55                   	push   %ebp
+  8002b0:	89 e5                	mov    %esp,%ebp
+  8002b2:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8002b5:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002b9:	8b 10                	mov    (%eax),%edx
+  8002bb:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002be:	73 0a                	jae    8002ca <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8002c0:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002c3:	89 08                	mov    %ecx,(%eax)
+  8002c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002c8:	88 02                	mov    %al,(%edx)
+}
+  8002ca:	5d                   	pop    %ebp
+  8002cb:	c3                   	ret
+
+008002cc <printfmt>:
+{
+  8002cc:	55                   	push   %ebp
+  8002cd:	89 e5                	mov    %esp,%ebp
+  8002cf:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8002d2:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8002d5:	50                   	push   %eax
+  8002d6:	ff 75 10             	push   0x10(%ebp)
+  8002d9:	ff 75 0c             	push   0xc(%ebp)
+  8002dc:	ff 75 08             	push   0x8(%ebp)
+  8002df:	e8 05 00 00 00       	call   8002e9 <vprintfmt>
+}
+  8002e4:	83 c4 10             	add    $0x10,%esp
+  8002e7:	c9                   	leave
+  8002e8:	c3                   	ret
+
+008002e9 <vprintfmt>:
+{
+  8002e9:	55                   	push   %ebp
+  8002ea:	89 e5                	mov    %esp,%ebp
+  8002ec:	57                   	push   %edi
+  8002ed:	56                   	push   %esi
+  8002ee:	53                   	push   %ebx
+  8002ef:	83 ec 2c             	sub    $0x2c,%esp
+  8002f2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8002f5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8002f8:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8002fb:	eb 0a                	jmp    800307 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8002fd:	83 ec 08             	sub    $0x8,%esp
+  800300:	53                   	push   %ebx
+  800301:	50                   	push   %eax
+  800302:	ff d6                	call   *%esi
+  800304:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800307:	83 c7 01             	add    $0x1,%edi
+  80030a:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80030e:	83 f8 25             	cmp    $0x25,%eax
+  800311:	74 0c                	je     80031f <vprintfmt+0x36>
+			if (ch == '\0')
+  800313:	85 c0                	test   %eax,%eax
+  800315:	75 e6                	jne    8002fd <vprintfmt+0x14>
+}
+  800317:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80031a:	5b                   	pop    %ebx
+  80031b:	5e                   	pop    %esi
+  80031c:	5f                   	pop    %edi
+  80031d:	5d                   	pop    %ebp
+  80031e:	c3                   	ret
+		padc = ' ';
+  80031f:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800323:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80032a:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800331:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800338:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80033d:	8d 47 01             	lea    0x1(%edi),%eax
+  800340:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800343:	0f b6 17             	movzbl (%edi),%edx
+  800346:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800349:	3c 55                	cmp    $0x55,%al
+  80034b:	0f 87 9a 03 00 00    	ja     8006eb <vprintfmt+0x402>
+  800351:	0f b6 c0             	movzbl %al,%eax
+  800354:	ff 24 85 60 27 80 00 	jmp    *0x802760(,%eax,4)
+  80035b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  80035e:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800362:	eb d9                	jmp    80033d <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800364:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800367:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80036b:	eb d0                	jmp    80033d <vprintfmt+0x54>
+  80036d:	0f b6 d2             	movzbl %dl,%edx
+  800370:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800373:	b8 00 00 00 00       	mov    $0x0,%eax
+  800378:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80037b:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80037e:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800382:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800385:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800388:	83 f9 09             	cmp    $0x9,%ecx
+  80038b:	77 55                	ja     8003e2 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  80038d:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800390:	eb e9                	jmp    80037b <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800392:	8b 45 14             	mov    0x14(%ebp),%eax
+  800395:	8b 00                	mov    (%eax),%eax
+  800397:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80039a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80039d:	8d 40 04             	lea    0x4(%eax),%eax
+  8003a0:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003a3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8003a6:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003aa:	79 91                	jns    80033d <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8003ac:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003af:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003b2:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003b9:	eb 82                	jmp    80033d <vprintfmt+0x54>
+			if (width < 0)
+  8003bb:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003be:	85 d2                	test   %edx,%edx
+  8003c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003c5:	0f 49 c2             	cmovns %edx,%eax
+  8003c8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003cb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003ce:	e9 6a ff ff ff       	jmp    80033d <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003d3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8003d6:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8003dd:	e9 5b ff ff ff       	jmp    80033d <vprintfmt+0x54>
+  8003e2:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003e5:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003e8:	eb bc                	jmp    8003a6 <vprintfmt+0xbd>
+			lflag++;
+  8003ea:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003ed:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003f0:	e9 48 ff ff ff       	jmp    80033d <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8003f5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003f8:	8d 78 04             	lea    0x4(%eax),%edi
+  8003fb:	83 ec 08             	sub    $0x8,%esp
+  8003fe:	53                   	push   %ebx
+  8003ff:	ff 30                	push   (%eax)
+  800401:	ff d6                	call   *%esi
+			break;
+  800403:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800406:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800409:	e9 7c 02 00 00       	jmp    80068a <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  80040e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800411:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800414:	8b 10                	mov    (%eax),%edx
+  800416:	89 d0                	mov    %edx,%eax
+  800418:	f7 d8                	neg    %eax
+  80041a:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80041d:	83 f8 10             	cmp    $0x10,%eax
+  800420:	7f 23                	jg     800445 <vprintfmt+0x15c>
+  800422:	8b 14 85 c0 28 80 00 	mov    0x8028c0(,%eax,4),%edx
+  800429:	85 d2                	test   %edx,%edx
+  80042b:	74 18                	je     800445 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  80042d:	52                   	push   %edx
+  80042e:	68 f9 29 80 00       	push   $0x8029f9
+  800433:	53                   	push   %ebx
+  800434:	56                   	push   %esi
+  800435:	e8 92 fe ff ff       	call   8002cc <printfmt>
+  80043a:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80043d:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800440:	e9 45 02 00 00       	jmp    80068a <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  800445:	50                   	push   %eax
+  800446:	68 37 26 80 00       	push   $0x802637
+  80044b:	53                   	push   %ebx
+  80044c:	56                   	push   %esi
+  80044d:	e8 7a fe ff ff       	call   8002cc <printfmt>
+  800452:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800455:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800458:	e9 2d 02 00 00       	jmp    80068a <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80045d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800460:	83 c0 04             	add    $0x4,%eax
+  800463:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800466:	8b 45 14             	mov    0x14(%ebp),%eax
+  800469:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80046b:	85 c9                	test   %ecx,%ecx
+  80046d:	b8 30 26 80 00       	mov    $0x802630,%eax
+  800472:	0f 45 c1             	cmovne %ecx,%eax
+  800475:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800478:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80047c:	7e 06                	jle    800484 <vprintfmt+0x19b>
+  80047e:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800482:	75 0b                	jne    80048f <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800484:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800487:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80048a:	89 75 08             	mov    %esi,0x8(%ebp)
+  80048d:	eb 5c                	jmp    8004eb <vprintfmt+0x202>
+  80048f:	83 ec 08             	sub    $0x8,%esp
+  800492:	ff 75 d0             	push   -0x30(%ebp)
+  800495:	ff 75 cc             	push   -0x34(%ebp)
+  800498:	e8 eb 02 00 00       	call   800788 <strnlen>
+  80049d:	89 c2                	mov    %eax,%edx
+  80049f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004a2:	29 d0                	sub    %edx,%eax
+  8004a4:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8004a7:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004ab:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004ae:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004b1:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004b3:	eb 0e                	jmp    8004c3 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8004b5:	83 ec 08             	sub    $0x8,%esp
+  8004b8:	53                   	push   %ebx
+  8004b9:	57                   	push   %edi
+  8004ba:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004bd:	83 ee 01             	sub    $0x1,%esi
+  8004c0:	83 c4 10             	add    $0x10,%esp
+  8004c3:	85 f6                	test   %esi,%esi
+  8004c5:	7f ee                	jg     8004b5 <vprintfmt+0x1cc>
+  8004c7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004ca:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004cd:	85 c0                	test   %eax,%eax
+  8004cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004d4:	0f 49 d0             	cmovns %eax,%edx
+  8004d7:	29 d0                	sub    %edx,%eax
+  8004d9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004dc:	eb a6                	jmp    800484 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8004de:	83 ec 08             	sub    $0x8,%esp
+  8004e1:	53                   	push   %ebx
+  8004e2:	52                   	push   %edx
+  8004e3:	ff 55 08             	call   *0x8(%ebp)
+  8004e6:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004e9:	89 f1                	mov    %esi,%ecx
+  8004eb:	8d 71 01             	lea    0x1(%ecx),%esi
+  8004ee:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004f2:	0f be d0             	movsbl %al,%edx
+  8004f5:	85 d2                	test   %edx,%edx
+  8004f7:	74 28                	je     800521 <vprintfmt+0x238>
+  8004f9:	85 ff                	test   %edi,%edi
+  8004fb:	78 05                	js     800502 <vprintfmt+0x219>
+  8004fd:	83 ef 01             	sub    $0x1,%edi
+  800500:	78 30                	js     800532 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800502:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800506:	74 d6                	je     8004de <vprintfmt+0x1f5>
+  800508:	0f be c0             	movsbl %al,%eax
+  80050b:	83 e8 20             	sub    $0x20,%eax
+  80050e:	83 f8 5e             	cmp    $0x5e,%eax
+  800511:	76 cb                	jbe    8004de <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800513:	83 ec 08             	sub    $0x8,%esp
+  800516:	53                   	push   %ebx
+  800517:	6a 3f                	push   $0x3f
+  800519:	ff 55 08             	call   *0x8(%ebp)
+  80051c:	83 c4 10             	add    $0x10,%esp
+  80051f:	eb c8                	jmp    8004e9 <vprintfmt+0x200>
+  800521:	8b 75 08             	mov    0x8(%ebp),%esi
+  800524:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800527:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80052a:	01 d0                	add    %edx,%eax
+  80052c:	29 c8                	sub    %ecx,%eax
+  80052e:	89 c7                	mov    %eax,%edi
+  800530:	eb 13                	jmp    800545 <vprintfmt+0x25c>
+  800532:	8b 75 08             	mov    0x8(%ebp),%esi
+  800535:	eb ed                	jmp    800524 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800537:	83 ec 08             	sub    $0x8,%esp
+  80053a:	53                   	push   %ebx
+  80053b:	6a 20                	push   $0x20
+  80053d:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80053f:	83 ef 01             	sub    $0x1,%edi
+  800542:	83 c4 10             	add    $0x10,%esp
+  800545:	85 ff                	test   %edi,%edi
+  800547:	7f ee                	jg     800537 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800549:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80054c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80054f:	e9 36 01 00 00       	jmp    80068a <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  800554:	83 f9 01             	cmp    $0x1,%ecx
+  800557:	7f 1f                	jg     800578 <vprintfmt+0x28f>
+	else if (lflag)
+  800559:	85 c9                	test   %ecx,%ecx
+  80055b:	74 67                	je     8005c4 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  80055d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800560:	8b 00                	mov    (%eax),%eax
+  800562:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800565:	89 c1                	mov    %eax,%ecx
+  800567:	c1 f9 1f             	sar    $0x1f,%ecx
+  80056a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80056d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800570:	8d 40 04             	lea    0x4(%eax),%eax
+  800573:	89 45 14             	mov    %eax,0x14(%ebp)
+  800576:	eb 17                	jmp    80058f <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800578:	8b 45 14             	mov    0x14(%ebp),%eax
+  80057b:	8b 50 04             	mov    0x4(%eax),%edx
+  80057e:	8b 00                	mov    (%eax),%eax
+  800580:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800583:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800586:	8b 45 14             	mov    0x14(%ebp),%eax
+  800589:	8d 40 08             	lea    0x8(%eax),%eax
+  80058c:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80058f:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800592:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800595:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80059a:	85 c9                	test   %ecx,%ecx
+  80059c:	0f 89 ce 00 00 00    	jns    800670 <vprintfmt+0x387>
+				putch('-', putdat);
+  8005a2:	83 ec 08             	sub    $0x8,%esp
+  8005a5:	53                   	push   %ebx
+  8005a6:	6a 2d                	push   $0x2d
+  8005a8:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8005aa:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005ad:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005b0:	f7 da                	neg    %edx
+  8005b2:	83 d1 00             	adc    $0x0,%ecx
+  8005b5:	f7 d9                	neg    %ecx
+  8005b7:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8005ba:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005bf:	e9 ac 00 00 00       	jmp    800670 <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  8005c4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c7:	8b 00                	mov    (%eax),%eax
+  8005c9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005cc:	89 c1                	mov    %eax,%ecx
+  8005ce:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005d1:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005d4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d7:	8d 40 04             	lea    0x4(%eax),%eax
+  8005da:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005dd:	eb b0                	jmp    80058f <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8005df:	83 f9 01             	cmp    $0x1,%ecx
+  8005e2:	7f 1b                	jg     8005ff <vprintfmt+0x316>
+	else if (lflag)
+  8005e4:	85 c9                	test   %ecx,%ecx
+  8005e6:	74 2c                	je     800614 <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  8005e8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005eb:	8b 10                	mov    (%eax),%edx
+  8005ed:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005f2:	8d 40 04             	lea    0x4(%eax),%eax
+  8005f5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005f8:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8005fd:	eb 71                	jmp    800670 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  8005ff:	8b 45 14             	mov    0x14(%ebp),%eax
+  800602:	8b 10                	mov    (%eax),%edx
+  800604:	8b 48 04             	mov    0x4(%eax),%ecx
+  800607:	8d 40 08             	lea    0x8(%eax),%eax
+  80060a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80060d:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800612:	eb 5c                	jmp    800670 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  800614:	8b 45 14             	mov    0x14(%ebp),%eax
+  800617:	8b 10                	mov    (%eax),%edx
+  800619:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80061e:	8d 40 04             	lea    0x4(%eax),%eax
+  800621:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800624:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800629:	eb 45                	jmp    800670 <vprintfmt+0x387>
+			putch('X', putdat);
+  80062b:	83 ec 08             	sub    $0x8,%esp
+  80062e:	53                   	push   %ebx
+  80062f:	6a 58                	push   $0x58
+  800631:	ff d6                	call   *%esi
+			putch('X', putdat);
+  800633:	83 c4 08             	add    $0x8,%esp
+  800636:	53                   	push   %ebx
+  800637:	6a 58                	push   $0x58
+  800639:	ff d6                	call   *%esi
+			putch('X', putdat);
+  80063b:	83 c4 08             	add    $0x8,%esp
+  80063e:	53                   	push   %ebx
+  80063f:	6a 58                	push   $0x58
+  800641:	ff d6                	call   *%esi
+			break;
+  800643:	83 c4 10             	add    $0x10,%esp
+  800646:	eb 42                	jmp    80068a <vprintfmt+0x3a1>
+			putch('0', putdat);
+  800648:	83 ec 08             	sub    $0x8,%esp
+  80064b:	53                   	push   %ebx
+  80064c:	6a 30                	push   $0x30
+  80064e:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800650:	83 c4 08             	add    $0x8,%esp
+  800653:	53                   	push   %ebx
+  800654:	6a 78                	push   $0x78
+  800656:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800658:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065b:	8b 10                	mov    (%eax),%edx
+  80065d:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800662:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800665:	8d 40 04             	lea    0x4(%eax),%eax
+  800668:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80066b:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800670:	83 ec 0c             	sub    $0xc,%esp
+  800673:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800677:	50                   	push   %eax
+  800678:	ff 75 e0             	push   -0x20(%ebp)
+  80067b:	57                   	push   %edi
+  80067c:	51                   	push   %ecx
+  80067d:	52                   	push   %edx
+  80067e:	89 da                	mov    %ebx,%edx
+  800680:	89 f0                	mov    %esi,%eax
+  800682:	e8 7f fb ff ff       	call   800206 <printnum>
+			break;
+  800687:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80068a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80068d:	e9 75 fc ff ff       	jmp    800307 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800692:	83 f9 01             	cmp    $0x1,%ecx
+  800695:	7f 1b                	jg     8006b2 <vprintfmt+0x3c9>
+	else if (lflag)
+  800697:	85 c9                	test   %ecx,%ecx
+  800699:	74 2c                	je     8006c7 <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  80069b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069e:	8b 10                	mov    (%eax),%edx
+  8006a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006a5:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006ab:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8006b0:	eb be                	jmp    800670 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  8006b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b5:	8b 10                	mov    (%eax),%edx
+  8006b7:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006ba:	8d 40 08             	lea    0x8(%eax),%eax
+  8006bd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006c0:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8006c5:	eb a9                	jmp    800670 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  8006c7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ca:	8b 10                	mov    (%eax),%edx
+  8006cc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006d1:	8d 40 04             	lea    0x4(%eax),%eax
+  8006d4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006d7:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8006dc:	eb 92                	jmp    800670 <vprintfmt+0x387>
+			putch(ch, putdat);
+  8006de:	83 ec 08             	sub    $0x8,%esp
+  8006e1:	53                   	push   %ebx
+  8006e2:	6a 25                	push   $0x25
+  8006e4:	ff d6                	call   *%esi
+			break;
+  8006e6:	83 c4 10             	add    $0x10,%esp
+  8006e9:	eb 9f                	jmp    80068a <vprintfmt+0x3a1>
+			putch('%', putdat);
+  8006eb:	83 ec 08             	sub    $0x8,%esp
+  8006ee:	53                   	push   %ebx
+  8006ef:	6a 25                	push   $0x25
+  8006f1:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8006f3:	83 c4 10             	add    $0x10,%esp
+  8006f6:	89 f8                	mov    %edi,%eax
+  8006f8:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8006fc:	74 05                	je     800703 <vprintfmt+0x41a>
+  8006fe:	83 e8 01             	sub    $0x1,%eax
+  800701:	eb f5                	jmp    8006f8 <vprintfmt+0x40f>
+  800703:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800706:	eb 82                	jmp    80068a <vprintfmt+0x3a1>
+
+00800708 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800708:	55                   	push   %ebp
+  800709:	89 e5                	mov    %esp,%ebp
+  80070b:	83 ec 18             	sub    $0x18,%esp
+  80070e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800711:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800714:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800717:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80071b:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80071e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800725:	85 c0                	test   %eax,%eax
+  800727:	74 26                	je     80074f <vsnprintf+0x47>
+  800729:	85 d2                	test   %edx,%edx
+  80072b:	7e 22                	jle    80074f <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80072d:	ff 75 14             	push   0x14(%ebp)
+  800730:	ff 75 10             	push   0x10(%ebp)
+  800733:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800736:	50                   	push   %eax
+  800737:	68 af 02 80 00       	push   $0x8002af
+  80073c:	e8 a8 fb ff ff       	call   8002e9 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800741:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800744:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800747:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80074a:	83 c4 10             	add    $0x10,%esp
+}
+  80074d:	c9                   	leave
+  80074e:	c3                   	ret
+		return -E_INVAL;
+  80074f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800754:	eb f7                	jmp    80074d <vsnprintf+0x45>
+
+00800756 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800756:	55                   	push   %ebp
+  800757:	89 e5                	mov    %esp,%ebp
+  800759:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80075c:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80075f:	50                   	push   %eax
+  800760:	ff 75 10             	push   0x10(%ebp)
+  800763:	ff 75 0c             	push   0xc(%ebp)
+  800766:	ff 75 08             	push   0x8(%ebp)
+  800769:	e8 9a ff ff ff       	call   800708 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80076e:	c9                   	leave
+  80076f:	c3                   	ret
+
+00800770 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800770:	55                   	push   %ebp
+  800771:	89 e5                	mov    %esp,%ebp
+  800773:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800776:	b8 00 00 00 00       	mov    $0x0,%eax
+  80077b:	eb 03                	jmp    800780 <strlen+0x10>
+		n++;
+  80077d:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800780:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800784:	75 f7                	jne    80077d <strlen+0xd>
+	return n;
+}
+  800786:	5d                   	pop    %ebp
+  800787:	c3                   	ret
+
+00800788 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800788:	55                   	push   %ebp
+  800789:	89 e5                	mov    %esp,%ebp
+  80078b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80078e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800791:	b8 00 00 00 00       	mov    $0x0,%eax
+  800796:	eb 03                	jmp    80079b <strnlen+0x13>
+		n++;
+  800798:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80079b:	39 d0                	cmp    %edx,%eax
+  80079d:	74 08                	je     8007a7 <strnlen+0x1f>
+  80079f:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8007a3:	75 f3                	jne    800798 <strnlen+0x10>
+  8007a5:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8007a7:	89 d0                	mov    %edx,%eax
+  8007a9:	5d                   	pop    %ebp
+  8007aa:	c3                   	ret
+
+008007ab <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8007ab:	55                   	push   %ebp
+  8007ac:	89 e5                	mov    %esp,%ebp
+  8007ae:	53                   	push   %ebx
+  8007af:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007b2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8007b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ba:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8007be:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8007c1:	83 c0 01             	add    $0x1,%eax
+  8007c4:	84 d2                	test   %dl,%dl
+  8007c6:	75 f2                	jne    8007ba <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8007c8:	89 c8                	mov    %ecx,%eax
+  8007ca:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007cd:	c9                   	leave
+  8007ce:	c3                   	ret
+
+008007cf <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8007cf:	55                   	push   %ebp
+  8007d0:	89 e5                	mov    %esp,%ebp
+  8007d2:	53                   	push   %ebx
+  8007d3:	83 ec 10             	sub    $0x10,%esp
+  8007d6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8007d9:	53                   	push   %ebx
+  8007da:	e8 91 ff ff ff       	call   800770 <strlen>
+  8007df:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8007e2:	ff 75 0c             	push   0xc(%ebp)
+  8007e5:	01 d8                	add    %ebx,%eax
+  8007e7:	50                   	push   %eax
+  8007e8:	e8 be ff ff ff       	call   8007ab <strcpy>
+	return dst;
+}
+  8007ed:	89 d8                	mov    %ebx,%eax
+  8007ef:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007f2:	c9                   	leave
+  8007f3:	c3                   	ret
+
+008007f4 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8007f4:	55                   	push   %ebp
+  8007f5:	89 e5                	mov    %esp,%ebp
+  8007f7:	56                   	push   %esi
+  8007f8:	53                   	push   %ebx
+  8007f9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007fc:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8007ff:	89 f3                	mov    %esi,%ebx
+  800801:	03 5d 10             	add    0x10(%ebp),%ebx
+  800804:	89 f0                	mov    %esi,%eax
+  800806:	eb 0f                	jmp    800817 <strncpy+0x23>
+		*dst++ = *src;
+  800808:	83 c0 01             	add    $0x1,%eax
+  80080b:	0f b6 0a             	movzbl (%edx),%ecx
+  80080e:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800811:	80 f9 01             	cmp    $0x1,%cl
+  800814:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800817:	39 d8                	cmp    %ebx,%eax
+  800819:	75 ed                	jne    800808 <strncpy+0x14>
+	}
+	return ret;
+}
+  80081b:	89 f0                	mov    %esi,%eax
+  80081d:	5b                   	pop    %ebx
+  80081e:	5e                   	pop    %esi
+  80081f:	5d                   	pop    %ebp
+  800820:	c3                   	ret
+
+00800821 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800821:	55                   	push   %ebp
+  800822:	89 e5                	mov    %esp,%ebp
+  800824:	56                   	push   %esi
+  800825:	53                   	push   %ebx
+  800826:	8b 75 08             	mov    0x8(%ebp),%esi
+  800829:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80082c:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80082f:	89 f0                	mov    %esi,%eax
+  800831:	85 d2                	test   %edx,%edx
+  800833:	74 21                	je     800856 <strlcpy+0x35>
+  800835:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800839:	89 f2                	mov    %esi,%edx
+  80083b:	eb 09                	jmp    800846 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  80083d:	83 c1 01             	add    $0x1,%ecx
+  800840:	83 c2 01             	add    $0x1,%edx
+  800843:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800846:	39 c2                	cmp    %eax,%edx
+  800848:	74 09                	je     800853 <strlcpy+0x32>
+  80084a:	0f b6 19             	movzbl (%ecx),%ebx
+  80084d:	84 db                	test   %bl,%bl
+  80084f:	75 ec                	jne    80083d <strlcpy+0x1c>
+  800851:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800853:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800856:	29 f0                	sub    %esi,%eax
+}
+  800858:	5b                   	pop    %ebx
+  800859:	5e                   	pop    %esi
+  80085a:	5d                   	pop    %ebp
+  80085b:	c3                   	ret
+
+0080085c <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80085c:	55                   	push   %ebp
+  80085d:	89 e5                	mov    %esp,%ebp
+  80085f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800862:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800865:	eb 06                	jmp    80086d <strcmp+0x11>
+		p++, q++;
+  800867:	83 c1 01             	add    $0x1,%ecx
+  80086a:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  80086d:	0f b6 01             	movzbl (%ecx),%eax
+  800870:	84 c0                	test   %al,%al
+  800872:	74 04                	je     800878 <strcmp+0x1c>
+  800874:	3a 02                	cmp    (%edx),%al
+  800876:	74 ef                	je     800867 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800878:	0f b6 c0             	movzbl %al,%eax
+  80087b:	0f b6 12             	movzbl (%edx),%edx
+  80087e:	29 d0                	sub    %edx,%eax
+}
+  800880:	5d                   	pop    %ebp
+  800881:	c3                   	ret
+
+00800882 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800882:	55                   	push   %ebp
+  800883:	89 e5                	mov    %esp,%ebp
+  800885:	53                   	push   %ebx
+  800886:	8b 45 08             	mov    0x8(%ebp),%eax
+  800889:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80088c:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80088f:	eb 09                	jmp    80089a <strncmp+0x18>
+		n--, p++, q++;
+  800891:	83 ea 01             	sub    $0x1,%edx
+  800894:	83 c0 01             	add    $0x1,%eax
+  800897:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80089a:	85 d2                	test   %edx,%edx
+  80089c:	74 18                	je     8008b6 <strncmp+0x34>
+  80089e:	0f b6 18             	movzbl (%eax),%ebx
+  8008a1:	84 db                	test   %bl,%bl
+  8008a3:	74 04                	je     8008a9 <strncmp+0x27>
+  8008a5:	3a 19                	cmp    (%ecx),%bl
+  8008a7:	74 e8                	je     800891 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008a9:	0f b6 00             	movzbl (%eax),%eax
+  8008ac:	0f b6 11             	movzbl (%ecx),%edx
+  8008af:	29 d0                	sub    %edx,%eax
+}
+  8008b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008b4:	c9                   	leave
+  8008b5:	c3                   	ret
+		return 0;
+  8008b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008bb:	eb f4                	jmp    8008b1 <strncmp+0x2f>
+
+008008bd <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8008bd:	55                   	push   %ebp
+  8008be:	89 e5                	mov    %esp,%ebp
+  8008c0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008c3:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008c7:	eb 03                	jmp    8008cc <strchr+0xf>
+  8008c9:	83 c0 01             	add    $0x1,%eax
+  8008cc:	0f b6 10             	movzbl (%eax),%edx
+  8008cf:	84 d2                	test   %dl,%dl
+  8008d1:	74 06                	je     8008d9 <strchr+0x1c>
+		if (*s == c)
+  8008d3:	38 ca                	cmp    %cl,%dl
+  8008d5:	75 f2                	jne    8008c9 <strchr+0xc>
+  8008d7:	eb 05                	jmp    8008de <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8008d9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008de:	5d                   	pop    %ebp
+  8008df:	c3                   	ret
+
+008008e0 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8008e0:	55                   	push   %ebp
+  8008e1:	89 e5                	mov    %esp,%ebp
+  8008e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008e6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008ea:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8008ed:	38 ca                	cmp    %cl,%dl
+  8008ef:	74 09                	je     8008fa <strfind+0x1a>
+  8008f1:	84 d2                	test   %dl,%dl
+  8008f3:	74 05                	je     8008fa <strfind+0x1a>
+	for (; *s; s++)
+  8008f5:	83 c0 01             	add    $0x1,%eax
+  8008f8:	eb f0                	jmp    8008ea <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8008fa:	5d                   	pop    %ebp
+  8008fb:	c3                   	ret
+
+008008fc <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8008fc:	55                   	push   %ebp
+  8008fd:	89 e5                	mov    %esp,%ebp
+  8008ff:	57                   	push   %edi
+  800900:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800903:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800906:	85 c9                	test   %ecx,%ecx
+  800908:	74 20                	je     80092a <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  80090a:	89 f8                	mov    %edi,%eax
+  80090c:	09 c8                	or     %ecx,%eax
+  80090e:	a8 03                	test   $0x3,%al
+  800910:	75 12                	jne    800924 <memset+0x28>
+		c &= 0xFF;
+  800912:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800916:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  80091c:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  80091f:	fc                   	cld
+  800920:	f3 ab                	rep stos %eax,%es:(%edi)
+  800922:	eb 06                	jmp    80092a <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800924:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800927:	fc                   	cld
+  800928:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  80092a:	89 f8                	mov    %edi,%eax
+  80092c:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  80092f:	c9                   	leave
+  800930:	c3                   	ret
+
+00800931 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800931:	55                   	push   %ebp
+  800932:	89 e5                	mov    %esp,%ebp
+  800934:	57                   	push   %edi
+  800935:	56                   	push   %esi
+  800936:	8b 45 08             	mov    0x8(%ebp),%eax
+  800939:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80093c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  80093f:	39 c6                	cmp    %eax,%esi
+  800941:	73 32                	jae    800975 <memmove+0x44>
+  800943:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800946:	39 d0                	cmp    %edx,%eax
+  800948:	73 2b                	jae    800975 <memmove+0x44>
+		s += n;
+		d += n;
+  80094a:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80094d:	89 d6                	mov    %edx,%esi
+  80094f:	09 fe                	or     %edi,%esi
+  800951:	09 ce                	or     %ecx,%esi
+  800953:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800959:	75 0e                	jne    800969 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  80095b:	83 ef 04             	sub    $0x4,%edi
+  80095e:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800961:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800964:	fd                   	std
+  800965:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800967:	eb 09                	jmp    800972 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800969:	83 ef 01             	sub    $0x1,%edi
+  80096c:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  80096f:	fd                   	std
+  800970:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800972:	fc                   	cld
+  800973:	eb 1a                	jmp    80098f <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800975:	89 f2                	mov    %esi,%edx
+  800977:	09 c2                	or     %eax,%edx
+  800979:	09 ca                	or     %ecx,%edx
+  80097b:	f6 c2 03             	test   $0x3,%dl
+  80097e:	75 0a                	jne    80098a <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800980:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800983:	89 c7                	mov    %eax,%edi
+  800985:	fc                   	cld
+  800986:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800988:	eb 05                	jmp    80098f <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  80098a:	89 c7                	mov    %eax,%edi
+  80098c:	fc                   	cld
+  80098d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  80098f:	5e                   	pop    %esi
+  800990:	5f                   	pop    %edi
+  800991:	5d                   	pop    %ebp
+  800992:	c3                   	ret
+
+00800993 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800993:	55                   	push   %ebp
+  800994:	89 e5                	mov    %esp,%ebp
+  800996:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800999:	ff 75 10             	push   0x10(%ebp)
+  80099c:	ff 75 0c             	push   0xc(%ebp)
+  80099f:	ff 75 08             	push   0x8(%ebp)
+  8009a2:	e8 8a ff ff ff       	call   800931 <memmove>
+}
+  8009a7:	c9                   	leave
+  8009a8:	c3                   	ret
+
+008009a9 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8009a9:	55                   	push   %ebp
+  8009aa:	89 e5                	mov    %esp,%ebp
+  8009ac:	56                   	push   %esi
+  8009ad:	53                   	push   %ebx
+  8009ae:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009b1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8009b4:	89 c6                	mov    %eax,%esi
+  8009b6:	03 75 10             	add    0x10(%ebp),%esi
+  8009b9:	eb 06                	jmp    8009c1 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8009bb:	83 c0 01             	add    $0x1,%eax
+  8009be:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  8009c1:	39 f0                	cmp    %esi,%eax
+  8009c3:	74 14                	je     8009d9 <memcmp+0x30>
+		if (*s1 != *s2)
+  8009c5:	0f b6 08             	movzbl (%eax),%ecx
+  8009c8:	0f b6 1a             	movzbl (%edx),%ebx
+  8009cb:	38 d9                	cmp    %bl,%cl
+  8009cd:	74 ec                	je     8009bb <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  8009cf:	0f b6 c1             	movzbl %cl,%eax
+  8009d2:	0f b6 db             	movzbl %bl,%ebx
+  8009d5:	29 d8                	sub    %ebx,%eax
+  8009d7:	eb 05                	jmp    8009de <memcmp+0x35>
+	}
+
+	return 0;
+  8009d9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009de:	5b                   	pop    %ebx
+  8009df:	5e                   	pop    %esi
+  8009e0:	5d                   	pop    %ebp
+  8009e1:	c3                   	ret
+
+008009e2 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8009e2:	55                   	push   %ebp
+  8009e3:	89 e5                	mov    %esp,%ebp
+  8009e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009e8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8009eb:	89 c2                	mov    %eax,%edx
+  8009ed:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8009f0:	eb 03                	jmp    8009f5 <memfind+0x13>
+  8009f2:	83 c0 01             	add    $0x1,%eax
+  8009f5:	39 d0                	cmp    %edx,%eax
+  8009f7:	73 04                	jae    8009fd <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8009f9:	38 08                	cmp    %cl,(%eax)
+  8009fb:	75 f5                	jne    8009f2 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8009fd:	5d                   	pop    %ebp
+  8009fe:	c3                   	ret
+
+008009ff <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8009ff:	55                   	push   %ebp
+  800a00:	89 e5                	mov    %esp,%ebp
+  800a02:	57                   	push   %edi
+  800a03:	56                   	push   %esi
+  800a04:	53                   	push   %ebx
+  800a05:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a08:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a0b:	eb 03                	jmp    800a10 <strtol+0x11>
+		s++;
+  800a0d:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a10:	0f b6 02             	movzbl (%edx),%eax
+  800a13:	3c 20                	cmp    $0x20,%al
+  800a15:	74 f6                	je     800a0d <strtol+0xe>
+  800a17:	3c 09                	cmp    $0x9,%al
+  800a19:	74 f2                	je     800a0d <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a1b:	3c 2b                	cmp    $0x2b,%al
+  800a1d:	74 2a                	je     800a49 <strtol+0x4a>
+	int neg = 0;
+  800a1f:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a24:	3c 2d                	cmp    $0x2d,%al
+  800a26:	74 2b                	je     800a53 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a28:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a2e:	75 0f                	jne    800a3f <strtol+0x40>
+  800a30:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a33:	74 28                	je     800a5d <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a35:	85 db                	test   %ebx,%ebx
+  800a37:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a3c:	0f 44 d8             	cmove  %eax,%ebx
+  800a3f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a44:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a47:	eb 46                	jmp    800a8f <strtol+0x90>
+		s++;
+  800a49:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a4c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a51:	eb d5                	jmp    800a28 <strtol+0x29>
+		s++, neg = 1;
+  800a53:	83 c2 01             	add    $0x1,%edx
+  800a56:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a5b:	eb cb                	jmp    800a28 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a5d:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a61:	74 0e                	je     800a71 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a63:	85 db                	test   %ebx,%ebx
+  800a65:	75 d8                	jne    800a3f <strtol+0x40>
+		s++, base = 8;
+  800a67:	83 c2 01             	add    $0x1,%edx
+  800a6a:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a6f:	eb ce                	jmp    800a3f <strtol+0x40>
+		s += 2, base = 16;
+  800a71:	83 c2 02             	add    $0x2,%edx
+  800a74:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a79:	eb c4                	jmp    800a3f <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a7b:	0f be c0             	movsbl %al,%eax
+  800a7e:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a81:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a84:	7d 3a                	jge    800ac0 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a86:	83 c2 01             	add    $0x1,%edx
+  800a89:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a8d:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a8f:	0f b6 02             	movzbl (%edx),%eax
+  800a92:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a95:	89 f3                	mov    %esi,%ebx
+  800a97:	80 fb 09             	cmp    $0x9,%bl
+  800a9a:	76 df                	jbe    800a7b <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a9c:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a9f:	89 f3                	mov    %esi,%ebx
+  800aa1:	80 fb 19             	cmp    $0x19,%bl
+  800aa4:	77 08                	ja     800aae <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800aa6:	0f be c0             	movsbl %al,%eax
+  800aa9:	83 e8 57             	sub    $0x57,%eax
+  800aac:	eb d3                	jmp    800a81 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800aae:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800ab1:	89 f3                	mov    %esi,%ebx
+  800ab3:	80 fb 19             	cmp    $0x19,%bl
+  800ab6:	77 08                	ja     800ac0 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800ab8:	0f be c0             	movsbl %al,%eax
+  800abb:	83 e8 37             	sub    $0x37,%eax
+  800abe:	eb c1                	jmp    800a81 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800ac0:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800ac4:	74 05                	je     800acb <strtol+0xcc>
+		*endptr = (char *) s;
+  800ac6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ac9:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800acb:	89 c8                	mov    %ecx,%eax
+  800acd:	f7 d8                	neg    %eax
+  800acf:	85 ff                	test   %edi,%edi
+  800ad1:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800ad4:	89 c8                	mov    %ecx,%eax
+  800ad6:	5b                   	pop    %ebx
+  800ad7:	5e                   	pop    %esi
+  800ad8:	5f                   	pop    %edi
+  800ad9:	5d                   	pop    %ebp
+  800ada:	c3                   	ret
+
+00800adb <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800adb:	55                   	push   %ebp
+  800adc:	89 e5                	mov    %esp,%ebp
+  800ade:	57                   	push   %edi
+  800adf:	56                   	push   %esi
+  800ae0:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800ae1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ae6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ae9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800aec:	89 c3                	mov    %eax,%ebx
+  800aee:	89 c7                	mov    %eax,%edi
+  800af0:	89 c6                	mov    %eax,%esi
+  800af2:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  800af4:	5b                   	pop    %ebx
+  800af5:	5e                   	pop    %esi
+  800af6:	5f                   	pop    %edi
+  800af7:	5d                   	pop    %ebp
+  800af8:	c3                   	ret
+
+00800af9 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800af9:	55                   	push   %ebp
+  800afa:	89 e5                	mov    %esp,%ebp
+  800afc:	57                   	push   %edi
+  800afd:	56                   	push   %esi
+  800afe:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800aff:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b04:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b09:	89 d1                	mov    %edx,%ecx
+  800b0b:	89 d3                	mov    %edx,%ebx
+  800b0d:	89 d7                	mov    %edx,%edi
+  800b0f:	89 d6                	mov    %edx,%esi
+  800b11:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800b13:	5b                   	pop    %ebx
+  800b14:	5e                   	pop    %esi
+  800b15:	5f                   	pop    %edi
+  800b16:	5d                   	pop    %ebp
+  800b17:	c3                   	ret
+
+00800b18 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800b18:	55                   	push   %ebp
+  800b19:	89 e5                	mov    %esp,%ebp
+  800b1b:	57                   	push   %edi
+  800b1c:	56                   	push   %esi
+  800b1d:	53                   	push   %ebx
+  800b1e:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800b21:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b26:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b29:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b2e:	89 cb                	mov    %ecx,%ebx
+  800b30:	89 cf                	mov    %ecx,%edi
+  800b32:	89 ce                	mov    %ecx,%esi
+  800b34:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800b36:	85 c0                	test   %eax,%eax
+  800b38:	7f 08                	jg     800b42 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800b3a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b3d:	5b                   	pop    %ebx
+  800b3e:	5e                   	pop    %esi
+  800b3f:	5f                   	pop    %edi
+  800b40:	5d                   	pop    %ebp
+  800b41:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800b42:	83 ec 0c             	sub    $0xc,%esp
+  800b45:	50                   	push   %eax
+  800b46:	6a 03                	push   $0x3
+  800b48:	68 23 29 80 00       	push   $0x802923
+  800b4d:	6a 3e                	push   $0x3e
+  800b4f:	68 40 29 80 00       	push   $0x802940
+  800b54:	e8 22 14 00 00       	call   801f7b <_panic>
+
+00800b59 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800b59:	55                   	push   %ebp
+  800b5a:	89 e5                	mov    %esp,%ebp
+  800b5c:	57                   	push   %edi
+  800b5d:	56                   	push   %esi
+  800b5e:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800b5f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b64:	b8 02 00 00 00       	mov    $0x2,%eax
+  800b69:	89 d1                	mov    %edx,%ecx
+  800b6b:	89 d3                	mov    %edx,%ebx
+  800b6d:	89 d7                	mov    %edx,%edi
+  800b6f:	89 d6                	mov    %edx,%esi
+  800b71:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800b73:	5b                   	pop    %ebx
+  800b74:	5e                   	pop    %esi
+  800b75:	5f                   	pop    %edi
+  800b76:	5d                   	pop    %ebp
+  800b77:	c3                   	ret
+
+00800b78 <sys_yield>:
+
+void
+sys_yield(void) {
+  800b78:	55                   	push   %ebp
+  800b79:	89 e5                	mov    %esp,%ebp
+  800b7b:	57                   	push   %edi
+  800b7c:	56                   	push   %esi
+  800b7d:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800b7e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b83:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800b88:	89 d1                	mov    %edx,%ecx
+  800b8a:	89 d3                	mov    %edx,%ebx
+  800b8c:	89 d7                	mov    %edx,%edi
+  800b8e:	89 d6                	mov    %edx,%esi
+  800b90:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800b92:	5b                   	pop    %ebx
+  800b93:	5e                   	pop    %esi
+  800b94:	5f                   	pop    %edi
+  800b95:	5d                   	pop    %ebp
+  800b96:	c3                   	ret
+
+00800b97 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  800b97:	55                   	push   %ebp
+  800b98:	89 e5                	mov    %esp,%ebp
+  800b9a:	57                   	push   %edi
+  800b9b:	56                   	push   %esi
+  800b9c:	53                   	push   %ebx
+  800b9d:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800ba0:	be 00 00 00 00       	mov    $0x0,%esi
+  800ba5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ba8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bab:	b8 04 00 00 00       	mov    $0x4,%eax
+  800bb0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bb3:	89 f7                	mov    %esi,%edi
+  800bb5:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800bb7:	85 c0                	test   %eax,%eax
+  800bb9:	7f 08                	jg     800bc3 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800bbb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bbe:	5b                   	pop    %ebx
+  800bbf:	5e                   	pop    %esi
+  800bc0:	5f                   	pop    %edi
+  800bc1:	5d                   	pop    %ebp
+  800bc2:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800bc3:	83 ec 0c             	sub    $0xc,%esp
+  800bc6:	50                   	push   %eax
+  800bc7:	6a 04                	push   $0x4
+  800bc9:	68 23 29 80 00       	push   $0x802923
+  800bce:	6a 3e                	push   $0x3e
+  800bd0:	68 40 29 80 00       	push   $0x802940
+  800bd5:	e8 a1 13 00 00       	call   801f7b <_panic>
+
+00800bda <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  800bda:	55                   	push   %ebp
+  800bdb:	89 e5                	mov    %esp,%ebp
+  800bdd:	57                   	push   %edi
+  800bde:	56                   	push   %esi
+  800bdf:	53                   	push   %ebx
+  800be0:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800be3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800be6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800be9:	b8 05 00 00 00       	mov    $0x5,%eax
+  800bee:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bf1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800bf4:	8b 75 18             	mov    0x18(%ebp),%esi
+  800bf7:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800bf9:	85 c0                	test   %eax,%eax
+  800bfb:	7f 08                	jg     800c05 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800bfd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c00:	5b                   	pop    %ebx
+  800c01:	5e                   	pop    %esi
+  800c02:	5f                   	pop    %edi
+  800c03:	5d                   	pop    %ebp
+  800c04:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c05:	83 ec 0c             	sub    $0xc,%esp
+  800c08:	50                   	push   %eax
+  800c09:	6a 05                	push   $0x5
+  800c0b:	68 23 29 80 00       	push   $0x802923
+  800c10:	6a 3e                	push   $0x3e
+  800c12:	68 40 29 80 00       	push   $0x802940
+  800c17:	e8 5f 13 00 00       	call   801f7b <_panic>
+
+00800c1c <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  800c1c:	55                   	push   %ebp
+  800c1d:	89 e5                	mov    %esp,%ebp
+  800c1f:	57                   	push   %edi
+  800c20:	56                   	push   %esi
+  800c21:	53                   	push   %ebx
+  800c22:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c25:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c2a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c2d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c30:	b8 06 00 00 00       	mov    $0x6,%eax
+  800c35:	89 df                	mov    %ebx,%edi
+  800c37:	89 de                	mov    %ebx,%esi
+  800c39:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c3b:	85 c0                	test   %eax,%eax
+  800c3d:	7f 08                	jg     800c47 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800c3f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c42:	5b                   	pop    %ebx
+  800c43:	5e                   	pop    %esi
+  800c44:	5f                   	pop    %edi
+  800c45:	5d                   	pop    %ebp
+  800c46:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c47:	83 ec 0c             	sub    $0xc,%esp
+  800c4a:	50                   	push   %eax
+  800c4b:	6a 06                	push   $0x6
+  800c4d:	68 23 29 80 00       	push   $0x802923
+  800c52:	6a 3e                	push   $0x3e
+  800c54:	68 40 29 80 00       	push   $0x802940
+  800c59:	e8 1d 13 00 00       	call   801f7b <_panic>
+
+00800c5e <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800c5e:	55                   	push   %ebp
+  800c5f:	89 e5                	mov    %esp,%ebp
+  800c61:	57                   	push   %edi
+  800c62:	56                   	push   %esi
+  800c63:	53                   	push   %ebx
+  800c64:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c67:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c6f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c72:	b8 08 00 00 00       	mov    $0x8,%eax
+  800c77:	89 df                	mov    %ebx,%edi
+  800c79:	89 de                	mov    %ebx,%esi
+  800c7b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c7d:	85 c0                	test   %eax,%eax
+  800c7f:	7f 08                	jg     800c89 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800c81:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c84:	5b                   	pop    %ebx
+  800c85:	5e                   	pop    %esi
+  800c86:	5f                   	pop    %edi
+  800c87:	5d                   	pop    %ebp
+  800c88:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c89:	83 ec 0c             	sub    $0xc,%esp
+  800c8c:	50                   	push   %eax
+  800c8d:	6a 08                	push   $0x8
+  800c8f:	68 23 29 80 00       	push   $0x802923
+  800c94:	6a 3e                	push   $0x3e
+  800c96:	68 40 29 80 00       	push   $0x802940
+  800c9b:	e8 db 12 00 00       	call   801f7b <_panic>
+
+00800ca0 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800ca0:	55                   	push   %ebp
+  800ca1:	89 e5                	mov    %esp,%ebp
+  800ca3:	57                   	push   %edi
+  800ca4:	56                   	push   %esi
+  800ca5:	53                   	push   %ebx
+  800ca6:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800ca9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cae:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cb1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cb4:	b8 09 00 00 00       	mov    $0x9,%eax
+  800cb9:	89 df                	mov    %ebx,%edi
+  800cbb:	89 de                	mov    %ebx,%esi
+  800cbd:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800cbf:	85 c0                	test   %eax,%eax
+  800cc1:	7f 08                	jg     800ccb <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800cc3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cc6:	5b                   	pop    %ebx
+  800cc7:	5e                   	pop    %esi
+  800cc8:	5f                   	pop    %edi
+  800cc9:	5d                   	pop    %ebp
+  800cca:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ccb:	83 ec 0c             	sub    $0xc,%esp
+  800cce:	50                   	push   %eax
+  800ccf:	6a 09                	push   $0x9
+  800cd1:	68 23 29 80 00       	push   $0x802923
+  800cd6:	6a 3e                	push   $0x3e
+  800cd8:	68 40 29 80 00       	push   $0x802940
+  800cdd:	e8 99 12 00 00       	call   801f7b <_panic>
+
+00800ce2 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800ce2:	55                   	push   %ebp
+  800ce3:	89 e5                	mov    %esp,%ebp
+  800ce5:	57                   	push   %edi
+  800ce6:	56                   	push   %esi
+  800ce7:	53                   	push   %ebx
+  800ce8:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800ceb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cf0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cf3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cf6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800cfb:	89 df                	mov    %ebx,%edi
+  800cfd:	89 de                	mov    %ebx,%esi
+  800cff:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d01:	85 c0                	test   %eax,%eax
+  800d03:	7f 08                	jg     800d0d <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800d05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d08:	5b                   	pop    %ebx
+  800d09:	5e                   	pop    %esi
+  800d0a:	5f                   	pop    %edi
+  800d0b:	5d                   	pop    %ebp
+  800d0c:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d0d:	83 ec 0c             	sub    $0xc,%esp
+  800d10:	50                   	push   %eax
+  800d11:	6a 0a                	push   $0xa
+  800d13:	68 23 29 80 00       	push   $0x802923
+  800d18:	6a 3e                	push   $0x3e
+  800d1a:	68 40 29 80 00       	push   $0x802940
+  800d1f:	e8 57 12 00 00       	call   801f7b <_panic>
+
+00800d24 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  800d24:	55                   	push   %ebp
+  800d25:	89 e5                	mov    %esp,%ebp
+  800d27:	57                   	push   %edi
+  800d28:	56                   	push   %esi
+  800d29:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d2a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d2d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d30:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800d35:	be 00 00 00 00       	mov    $0x0,%esi
+  800d3a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d3d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d40:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800d42:	5b                   	pop    %ebx
+  800d43:	5e                   	pop    %esi
+  800d44:	5f                   	pop    %edi
+  800d45:	5d                   	pop    %ebp
+  800d46:	c3                   	ret
+
+00800d47 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  800d47:	55                   	push   %ebp
+  800d48:	89 e5                	mov    %esp,%ebp
+  800d4a:	57                   	push   %edi
+  800d4b:	56                   	push   %esi
+  800d4c:	53                   	push   %ebx
+  800d4d:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800d50:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d55:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d58:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800d5d:	89 cb                	mov    %ecx,%ebx
+  800d5f:	89 cf                	mov    %ecx,%edi
+  800d61:	89 ce                	mov    %ecx,%esi
+  800d63:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d65:	85 c0                	test   %eax,%eax
+  800d67:	7f 08                	jg     800d71 <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  800d69:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d6c:	5b                   	pop    %ebx
+  800d6d:	5e                   	pop    %esi
+  800d6e:	5f                   	pop    %edi
+  800d6f:	5d                   	pop    %ebp
+  800d70:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d71:	83 ec 0c             	sub    $0xc,%esp
+  800d74:	50                   	push   %eax
+  800d75:	6a 0d                	push   $0xd
+  800d77:	68 23 29 80 00       	push   $0x802923
+  800d7c:	6a 3e                	push   $0x3e
+  800d7e:	68 40 29 80 00       	push   $0x802940
+  800d83:	e8 f3 11 00 00       	call   801f7b <_panic>
+
+00800d88 <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  800d88:	55                   	push   %ebp
+  800d89:	89 e5                	mov    %esp,%ebp
+  800d8b:	57                   	push   %edi
+  800d8c:	56                   	push   %esi
+  800d8d:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d8e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d93:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d96:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d99:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800d9e:	89 df                	mov    %ebx,%edi
+  800da0:	89 de                	mov    %ebx,%esi
+  800da2:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  800da4:	5b                   	pop    %ebx
+  800da5:	5e                   	pop    %esi
+  800da6:	5f                   	pop    %edi
+  800da7:	5d                   	pop    %ebp
+  800da8:	c3                   	ret
+
+00800da9 <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  800da9:	55                   	push   %ebp
+  800daa:	89 e5                	mov    %esp,%ebp
+  800dac:	57                   	push   %edi
+  800dad:	56                   	push   %esi
+  800dae:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800daf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800db4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800db7:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800dbc:	89 cb                	mov    %ecx,%ebx
+  800dbe:	89 cf                	mov    %ecx,%edi
+  800dc0:	89 ce                	mov    %ecx,%esi
+  800dc2:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  800dc4:	5b                   	pop    %ebx
+  800dc5:	5e                   	pop    %esi
+  800dc6:	5f                   	pop    %edi
+  800dc7:	5d                   	pop    %ebp
+  800dc8:	c3                   	ret
+
+00800dc9 <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  800dc9:	55                   	push   %ebp
+  800dca:	89 e5                	mov    %esp,%ebp
+  800dcc:	57                   	push   %edi
+  800dcd:	56                   	push   %esi
+  800dce:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800dcf:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dd4:	b8 10 00 00 00       	mov    $0x10,%eax
+  800dd9:	89 d1                	mov    %edx,%ecx
+  800ddb:	89 d3                	mov    %edx,%ebx
+  800ddd:	89 d7                	mov    %edx,%edi
+  800ddf:	89 d6                	mov    %edx,%esi
+  800de1:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800de3:	5b                   	pop    %ebx
+  800de4:	5e                   	pop    %esi
+  800de5:	5f                   	pop    %edi
+  800de6:	5d                   	pop    %ebp
+  800de7:	c3                   	ret
+
+00800de8 <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  800de8:	55                   	push   %ebp
+  800de9:	89 e5                	mov    %esp,%ebp
+  800deb:	57                   	push   %edi
+  800dec:	56                   	push   %esi
+  800ded:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800dee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800df3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800df9:	b8 11 00 00 00       	mov    $0x11,%eax
+  800dfe:	89 df                	mov    %ebx,%edi
+  800e00:	89 de                	mov    %ebx,%esi
+  800e02:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800e04:	5b                   	pop    %ebx
+  800e05:	5e                   	pop    %esi
+  800e06:	5f                   	pop    %edi
+  800e07:	5d                   	pop    %ebp
+  800e08:	c3                   	ret
+
+00800e09 <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  800e09:	55                   	push   %ebp
+  800e0a:	89 e5                	mov    %esp,%ebp
+  800e0c:	57                   	push   %edi
+  800e0d:	56                   	push   %esi
+  800e0e:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e0f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e14:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e17:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e1a:	b8 12 00 00 00       	mov    $0x12,%eax
+  800e1f:	89 df                	mov    %ebx,%edi
+  800e21:	89 de                	mov    %ebx,%esi
+  800e23:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800e25:	5b                   	pop    %ebx
+  800e26:	5e                   	pop    %esi
+  800e27:	5f                   	pop    %edi
+  800e28:	5d                   	pop    %ebp
+  800e29:	c3                   	ret
+
+00800e2a <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  800e2a:	55                   	push   %ebp
+  800e2b:	89 e5                	mov    %esp,%ebp
+  800e2d:	57                   	push   %edi
+  800e2e:	56                   	push   %esi
+  800e2f:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e30:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e35:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e38:	b8 13 00 00 00       	mov    $0x13,%eax
+  800e3d:	89 cb                	mov    %ecx,%ebx
+  800e3f:	89 cf                	mov    %ecx,%edi
+  800e41:	89 ce                	mov    %ecx,%esi
+  800e43:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  800e45:	5b                   	pop    %ebx
+  800e46:	5e                   	pop    %esi
+  800e47:	5f                   	pop    %edi
+  800e48:	5d                   	pop    %ebp
+  800e49:	c3                   	ret
+
+00800e4a <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  800e4a:	55                   	push   %ebp
+  800e4b:	89 e5                	mov    %esp,%ebp
+  800e4d:	57                   	push   %edi
+  800e4e:	56                   	push   %esi
+  800e4f:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e50:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e55:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e58:	b8 14 00 00 00       	mov    $0x14,%eax
+  800e5d:	89 cb                	mov    %ecx,%ebx
+  800e5f:	89 cf                	mov    %ecx,%edi
+  800e61:	89 ce                	mov    %ecx,%esi
+  800e63:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  800e65:	5b                   	pop    %ebx
+  800e66:	5e                   	pop    %esi
+  800e67:	5f                   	pop    %edi
+  800e68:	5d                   	pop    %ebp
+  800e69:	c3                   	ret
+
+00800e6a <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800e6a:	55                   	push   %ebp
+  800e6b:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800e6d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e70:	05 00 00 00 30       	add    $0x30000000,%eax
+  800e75:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800e78:	5d                   	pop    %ebp
+  800e79:	c3                   	ret
+
+00800e7a <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800e7a:	55                   	push   %ebp
+  800e7b:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800e7d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e80:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800e85:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800e8a:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800e8f:	5d                   	pop    %ebp
+  800e90:	c3                   	ret
+
+00800e91 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800e91:	55                   	push   %ebp
+  800e92:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  800e94:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800e99:	eb 02                	jmp    800e9d <fd_alloc+0xc>
+  800e9b:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800e9d:	89 c2                	mov    %eax,%edx
+  800e9f:	c1 ea 16             	shr    $0x16,%edx
+  800ea2:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800ea9:	f6 c2 01             	test   $0x1,%dl
+  800eac:	74 2b                	je     800ed9 <fd_alloc+0x48>
+  800eae:	89 c2                	mov    %eax,%edx
+  800eb0:	c1 ea 0c             	shr    $0xc,%edx
+  800eb3:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  800eba:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  800ec0:	f6 c1 01             	test   $0x1,%cl
+  800ec3:	74 14                	je     800ed9 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  800ec5:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  800ecb:	75 ce                	jne    800e9b <fd_alloc+0xa>
+  800ecd:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  800ed2:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800ed7:	eb 05                	jmp    800ede <fd_alloc+0x4d>
+			return 0;
+  800ed9:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  800ede:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee1:	89 02                	mov    %eax,(%edx)
+}
+  800ee3:	89 c8                	mov    %ecx,%eax
+  800ee5:	5d                   	pop    %ebp
+  800ee6:	c3                   	ret
+
+00800ee7 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  800ee7:	55                   	push   %ebp
+  800ee8:	89 e5                	mov    %esp,%ebp
+  800eea:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  800eed:	83 f8 1f             	cmp    $0x1f,%eax
+  800ef0:	77 30                	ja     800f22 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  800ef2:	c1 e0 0c             	shl    $0xc,%eax
+  800ef5:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800efa:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  800f00:	f6 c2 01             	test   $0x1,%dl
+  800f03:	74 24                	je     800f29 <fd_lookup+0x42>
+  800f05:	89 c2                	mov    %eax,%edx
+  800f07:	c1 ea 0c             	shr    $0xc,%edx
+  800f0a:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800f11:	f6 c2 01             	test   $0x1,%dl
+  800f14:	74 1a                	je     800f30 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  800f16:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800f19:	89 02                	mov    %eax,(%edx)
+	return 0;
+  800f1b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f20:	5d                   	pop    %ebp
+  800f21:	c3                   	ret
+		return -E_INVAL;
+  800f22:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f27:	eb f7                	jmp    800f20 <fd_lookup+0x39>
+		return -E_INVAL;
+  800f29:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f2e:	eb f0                	jmp    800f20 <fd_lookup+0x39>
+  800f30:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f35:	eb e9                	jmp    800f20 <fd_lookup+0x39>
+
+00800f37 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  800f37:	55                   	push   %ebp
+  800f38:	89 e5                	mov    %esp,%ebp
+  800f3a:	53                   	push   %ebx
+  800f3b:	83 ec 04             	sub    $0x4,%esp
+  800f3e:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  800f41:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f46:	eb 03                	jmp    800f4b <dev_lookup+0x14>
+  800f48:	83 c0 01             	add    $0x1,%eax
+  800f4b:	8b 1c 85 cc 29 80 00 	mov    0x8029cc(,%eax,4),%ebx
+  800f52:	85 db                	test   %ebx,%ebx
+  800f54:	74 0b                	je     800f61 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  800f56:	39 13                	cmp    %edx,(%ebx)
+  800f58:	75 ee                	jne    800f48 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  800f5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f5f:	eb 1f                	jmp    800f80 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800f61:	a1 08 40 80 00       	mov    0x804008,%eax
+  800f66:	8b 40 48             	mov    0x48(%eax),%eax
+  800f69:	83 ec 04             	sub    $0x4,%esp
+  800f6c:	52                   	push   %edx
+  800f6d:	50                   	push   %eax
+  800f6e:	68 50 29 80 00       	push   $0x802950
+  800f73:	e8 7a f2 ff ff       	call   8001f2 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  800f78:	83 c4 10             	add    $0x10,%esp
+  800f7b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  800f80:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800f83:	89 1a                	mov    %ebx,(%edx)
+}
+  800f85:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f88:	c9                   	leave
+  800f89:	c3                   	ret
+
+00800f8a <fd_close>:
+{
+  800f8a:	55                   	push   %ebp
+  800f8b:	89 e5                	mov    %esp,%ebp
+  800f8d:	57                   	push   %edi
+  800f8e:	56                   	push   %esi
+  800f8f:	53                   	push   %ebx
+  800f90:	83 ec 24             	sub    $0x24,%esp
+  800f93:	8b 75 08             	mov    0x8(%ebp),%esi
+  800f96:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800f99:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800f9c:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800f9d:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800fa3:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800fa6:	50                   	push   %eax
+  800fa7:	e8 3b ff ff ff       	call   800ee7 <fd_lookup>
+  800fac:	89 c3                	mov    %eax,%ebx
+  800fae:	83 c4 10             	add    $0x10,%esp
+  800fb1:	85 c0                	test   %eax,%eax
+  800fb3:	78 05                	js     800fba <fd_close+0x30>
+	    || fd != fd2)
+  800fb5:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  800fb8:	74 16                	je     800fd0 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  800fba:	89 f8                	mov    %edi,%eax
+  800fbc:	84 c0                	test   %al,%al
+  800fbe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fc3:	0f 44 d8             	cmove  %eax,%ebx
+}
+  800fc6:	89 d8                	mov    %ebx,%eax
+  800fc8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fcb:	5b                   	pop    %ebx
+  800fcc:	5e                   	pop    %esi
+  800fcd:	5f                   	pop    %edi
+  800fce:	5d                   	pop    %ebp
+  800fcf:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800fd0:	83 ec 08             	sub    $0x8,%esp
+  800fd3:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800fd6:	50                   	push   %eax
+  800fd7:	ff 36                	push   (%esi)
+  800fd9:	e8 59 ff ff ff       	call   800f37 <dev_lookup>
+  800fde:	89 c3                	mov    %eax,%ebx
+  800fe0:	83 c4 10             	add    $0x10,%esp
+  800fe3:	85 c0                	test   %eax,%eax
+  800fe5:	78 1a                	js     801001 <fd_close+0x77>
+		if (dev->dev_close)
+  800fe7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800fea:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  800fed:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  800ff2:	85 c0                	test   %eax,%eax
+  800ff4:	74 0b                	je     801001 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  800ff6:	83 ec 0c             	sub    $0xc,%esp
+  800ff9:	56                   	push   %esi
+  800ffa:	ff d0                	call   *%eax
+  800ffc:	89 c3                	mov    %eax,%ebx
+  800ffe:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801001:	83 ec 08             	sub    $0x8,%esp
+  801004:	56                   	push   %esi
+  801005:	6a 00                	push   $0x0
+  801007:	e8 10 fc ff ff       	call   800c1c <sys_page_unmap>
+	return r;
+  80100c:	83 c4 10             	add    $0x10,%esp
+  80100f:	eb b5                	jmp    800fc6 <fd_close+0x3c>
+
+00801011 <close>:
+
+int
+close(int fdnum)
+{
+  801011:	55                   	push   %ebp
+  801012:	89 e5                	mov    %esp,%ebp
+  801014:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801017:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80101a:	50                   	push   %eax
+  80101b:	ff 75 08             	push   0x8(%ebp)
+  80101e:	e8 c4 fe ff ff       	call   800ee7 <fd_lookup>
+  801023:	83 c4 10             	add    $0x10,%esp
+  801026:	85 c0                	test   %eax,%eax
+  801028:	79 02                	jns    80102c <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80102a:	c9                   	leave
+  80102b:	c3                   	ret
+		return fd_close(fd, 1);
+  80102c:	83 ec 08             	sub    $0x8,%esp
+  80102f:	6a 01                	push   $0x1
+  801031:	ff 75 f4             	push   -0xc(%ebp)
+  801034:	e8 51 ff ff ff       	call   800f8a <fd_close>
+  801039:	83 c4 10             	add    $0x10,%esp
+  80103c:	eb ec                	jmp    80102a <close+0x19>
+
+0080103e <close_all>:
+
+void
+close_all(void)
+{
+  80103e:	55                   	push   %ebp
+  80103f:	89 e5                	mov    %esp,%ebp
+  801041:	53                   	push   %ebx
+  801042:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801045:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80104a:	83 ec 0c             	sub    $0xc,%esp
+  80104d:	53                   	push   %ebx
+  80104e:	e8 be ff ff ff       	call   801011 <close>
+	for (i = 0; i < MAXFD; i++)
+  801053:	83 c3 01             	add    $0x1,%ebx
+  801056:	83 c4 10             	add    $0x10,%esp
+  801059:	83 fb 20             	cmp    $0x20,%ebx
+  80105c:	75 ec                	jne    80104a <close_all+0xc>
+}
+  80105e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801061:	c9                   	leave
+  801062:	c3                   	ret
+
+00801063 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801063:	55                   	push   %ebp
+  801064:	89 e5                	mov    %esp,%ebp
+  801066:	57                   	push   %edi
+  801067:	56                   	push   %esi
+  801068:	53                   	push   %ebx
+  801069:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80106c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80106f:	50                   	push   %eax
+  801070:	ff 75 08             	push   0x8(%ebp)
+  801073:	e8 6f fe ff ff       	call   800ee7 <fd_lookup>
+  801078:	89 c3                	mov    %eax,%ebx
+  80107a:	83 c4 10             	add    $0x10,%esp
+  80107d:	85 c0                	test   %eax,%eax
+  80107f:	78 7f                	js     801100 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801081:	83 ec 0c             	sub    $0xc,%esp
+  801084:	ff 75 0c             	push   0xc(%ebp)
+  801087:	e8 85 ff ff ff       	call   801011 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80108c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80108f:	c1 e6 0c             	shl    $0xc,%esi
+  801092:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801098:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80109b:	89 3c 24             	mov    %edi,(%esp)
+  80109e:	e8 d7 fd ff ff       	call   800e7a <fd2data>
+  8010a3:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8010a5:	89 34 24             	mov    %esi,(%esp)
+  8010a8:	e8 cd fd ff ff       	call   800e7a <fd2data>
+  8010ad:	83 c4 10             	add    $0x10,%esp
+  8010b0:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8010b3:	89 d8                	mov    %ebx,%eax
+  8010b5:	c1 e8 16             	shr    $0x16,%eax
+  8010b8:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8010bf:	a8 01                	test   $0x1,%al
+  8010c1:	74 11                	je     8010d4 <dup+0x71>
+  8010c3:	89 d8                	mov    %ebx,%eax
+  8010c5:	c1 e8 0c             	shr    $0xc,%eax
+  8010c8:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8010cf:	f6 c2 01             	test   $0x1,%dl
+  8010d2:	75 36                	jne    80110a <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8010d4:	89 f8                	mov    %edi,%eax
+  8010d6:	c1 e8 0c             	shr    $0xc,%eax
+  8010d9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8010e0:	83 ec 0c             	sub    $0xc,%esp
+  8010e3:	25 07 0e 00 00       	and    $0xe07,%eax
+  8010e8:	50                   	push   %eax
+  8010e9:	56                   	push   %esi
+  8010ea:	6a 00                	push   $0x0
+  8010ec:	57                   	push   %edi
+  8010ed:	6a 00                	push   $0x0
+  8010ef:	e8 e6 fa ff ff       	call   800bda <sys_page_map>
+  8010f4:	89 c3                	mov    %eax,%ebx
+  8010f6:	83 c4 20             	add    $0x20,%esp
+  8010f9:	85 c0                	test   %eax,%eax
+  8010fb:	78 33                	js     801130 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8010fd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801100:	89 d8                	mov    %ebx,%eax
+  801102:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801105:	5b                   	pop    %ebx
+  801106:	5e                   	pop    %esi
+  801107:	5f                   	pop    %edi
+  801108:	5d                   	pop    %ebp
+  801109:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80110a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801111:	83 ec 0c             	sub    $0xc,%esp
+  801114:	25 07 0e 00 00       	and    $0xe07,%eax
+  801119:	50                   	push   %eax
+  80111a:	ff 75 d4             	push   -0x2c(%ebp)
+  80111d:	6a 00                	push   $0x0
+  80111f:	53                   	push   %ebx
+  801120:	6a 00                	push   $0x0
+  801122:	e8 b3 fa ff ff       	call   800bda <sys_page_map>
+  801127:	89 c3                	mov    %eax,%ebx
+  801129:	83 c4 20             	add    $0x20,%esp
+  80112c:	85 c0                	test   %eax,%eax
+  80112e:	79 a4                	jns    8010d4 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801130:	83 ec 08             	sub    $0x8,%esp
+  801133:	56                   	push   %esi
+  801134:	6a 00                	push   $0x0
+  801136:	e8 e1 fa ff ff       	call   800c1c <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  80113b:	83 c4 08             	add    $0x8,%esp
+  80113e:	ff 75 d4             	push   -0x2c(%ebp)
+  801141:	6a 00                	push   $0x0
+  801143:	e8 d4 fa ff ff       	call   800c1c <sys_page_unmap>
+	return r;
+  801148:	83 c4 10             	add    $0x10,%esp
+  80114b:	eb b3                	jmp    801100 <dup+0x9d>
+
+0080114d <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80114d:	55                   	push   %ebp
+  80114e:	89 e5                	mov    %esp,%ebp
+  801150:	56                   	push   %esi
+  801151:	53                   	push   %ebx
+  801152:	83 ec 18             	sub    $0x18,%esp
+  801155:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801158:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80115b:	50                   	push   %eax
+  80115c:	56                   	push   %esi
+  80115d:	e8 85 fd ff ff       	call   800ee7 <fd_lookup>
+  801162:	83 c4 10             	add    $0x10,%esp
+  801165:	85 c0                	test   %eax,%eax
+  801167:	78 3c                	js     8011a5 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801169:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80116c:	83 ec 08             	sub    $0x8,%esp
+  80116f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801172:	50                   	push   %eax
+  801173:	ff 33                	push   (%ebx)
+  801175:	e8 bd fd ff ff       	call   800f37 <dev_lookup>
+  80117a:	83 c4 10             	add    $0x10,%esp
+  80117d:	85 c0                	test   %eax,%eax
+  80117f:	78 24                	js     8011a5 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801181:	8b 43 08             	mov    0x8(%ebx),%eax
+  801184:	83 e0 03             	and    $0x3,%eax
+  801187:	83 f8 01             	cmp    $0x1,%eax
+  80118a:	74 20                	je     8011ac <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80118c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80118f:	8b 40 08             	mov    0x8(%eax),%eax
+  801192:	85 c0                	test   %eax,%eax
+  801194:	74 37                	je     8011cd <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801196:	83 ec 04             	sub    $0x4,%esp
+  801199:	ff 75 10             	push   0x10(%ebp)
+  80119c:	ff 75 0c             	push   0xc(%ebp)
+  80119f:	53                   	push   %ebx
+  8011a0:	ff d0                	call   *%eax
+  8011a2:	83 c4 10             	add    $0x10,%esp
+}
+  8011a5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8011a8:	5b                   	pop    %ebx
+  8011a9:	5e                   	pop    %esi
+  8011aa:	5d                   	pop    %ebp
+  8011ab:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8011ac:	a1 08 40 80 00       	mov    0x804008,%eax
+  8011b1:	8b 40 48             	mov    0x48(%eax),%eax
+  8011b4:	83 ec 04             	sub    $0x4,%esp
+  8011b7:	56                   	push   %esi
+  8011b8:	50                   	push   %eax
+  8011b9:	68 91 29 80 00       	push   $0x802991
+  8011be:	e8 2f f0 ff ff       	call   8001f2 <cprintf>
+		return -E_INVAL;
+  8011c3:	83 c4 10             	add    $0x10,%esp
+  8011c6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011cb:	eb d8                	jmp    8011a5 <read+0x58>
+		return -E_NOT_SUPP;
+  8011cd:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8011d2:	eb d1                	jmp    8011a5 <read+0x58>
+
+008011d4 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8011d4:	55                   	push   %ebp
+  8011d5:	89 e5                	mov    %esp,%ebp
+  8011d7:	57                   	push   %edi
+  8011d8:	56                   	push   %esi
+  8011d9:	53                   	push   %ebx
+  8011da:	83 ec 0c             	sub    $0xc,%esp
+  8011dd:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8011e0:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8011e3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011e8:	eb 02                	jmp    8011ec <readn+0x18>
+  8011ea:	01 c3                	add    %eax,%ebx
+  8011ec:	39 f3                	cmp    %esi,%ebx
+  8011ee:	73 21                	jae    801211 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8011f0:	83 ec 04             	sub    $0x4,%esp
+  8011f3:	89 f0                	mov    %esi,%eax
+  8011f5:	29 d8                	sub    %ebx,%eax
+  8011f7:	50                   	push   %eax
+  8011f8:	89 d8                	mov    %ebx,%eax
+  8011fa:	03 45 0c             	add    0xc(%ebp),%eax
+  8011fd:	50                   	push   %eax
+  8011fe:	57                   	push   %edi
+  8011ff:	e8 49 ff ff ff       	call   80114d <read>
+		if (m < 0)
+  801204:	83 c4 10             	add    $0x10,%esp
+  801207:	85 c0                	test   %eax,%eax
+  801209:	78 04                	js     80120f <readn+0x3b>
+			return m;
+		if (m == 0)
+  80120b:	75 dd                	jne    8011ea <readn+0x16>
+  80120d:	eb 02                	jmp    801211 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80120f:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801211:	89 d8                	mov    %ebx,%eax
+  801213:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801216:	5b                   	pop    %ebx
+  801217:	5e                   	pop    %esi
+  801218:	5f                   	pop    %edi
+  801219:	5d                   	pop    %ebp
+  80121a:	c3                   	ret
+
+0080121b <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80121b:	55                   	push   %ebp
+  80121c:	89 e5                	mov    %esp,%ebp
+  80121e:	56                   	push   %esi
+  80121f:	53                   	push   %ebx
+  801220:	83 ec 18             	sub    $0x18,%esp
+  801223:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801226:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801229:	50                   	push   %eax
+  80122a:	53                   	push   %ebx
+  80122b:	e8 b7 fc ff ff       	call   800ee7 <fd_lookup>
+  801230:	83 c4 10             	add    $0x10,%esp
+  801233:	85 c0                	test   %eax,%eax
+  801235:	78 37                	js     80126e <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801237:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80123a:	83 ec 08             	sub    $0x8,%esp
+  80123d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801240:	50                   	push   %eax
+  801241:	ff 36                	push   (%esi)
+  801243:	e8 ef fc ff ff       	call   800f37 <dev_lookup>
+  801248:	83 c4 10             	add    $0x10,%esp
+  80124b:	85 c0                	test   %eax,%eax
+  80124d:	78 1f                	js     80126e <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80124f:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801253:	74 20                	je     801275 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801255:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801258:	8b 40 0c             	mov    0xc(%eax),%eax
+  80125b:	85 c0                	test   %eax,%eax
+  80125d:	74 37                	je     801296 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80125f:	83 ec 04             	sub    $0x4,%esp
+  801262:	ff 75 10             	push   0x10(%ebp)
+  801265:	ff 75 0c             	push   0xc(%ebp)
+  801268:	56                   	push   %esi
+  801269:	ff d0                	call   *%eax
+  80126b:	83 c4 10             	add    $0x10,%esp
+}
+  80126e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801271:	5b                   	pop    %ebx
+  801272:	5e                   	pop    %esi
+  801273:	5d                   	pop    %ebp
+  801274:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801275:	a1 08 40 80 00       	mov    0x804008,%eax
+  80127a:	8b 40 48             	mov    0x48(%eax),%eax
+  80127d:	83 ec 04             	sub    $0x4,%esp
+  801280:	53                   	push   %ebx
+  801281:	50                   	push   %eax
+  801282:	68 ad 29 80 00       	push   $0x8029ad
+  801287:	e8 66 ef ff ff       	call   8001f2 <cprintf>
+		return -E_INVAL;
+  80128c:	83 c4 10             	add    $0x10,%esp
+  80128f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801294:	eb d8                	jmp    80126e <write+0x53>
+		return -E_NOT_SUPP;
+  801296:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80129b:	eb d1                	jmp    80126e <write+0x53>
+
+0080129d <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80129d:	55                   	push   %ebp
+  80129e:	89 e5                	mov    %esp,%ebp
+  8012a0:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8012a3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8012a6:	50                   	push   %eax
+  8012a7:	ff 75 08             	push   0x8(%ebp)
+  8012aa:	e8 38 fc ff ff       	call   800ee7 <fd_lookup>
+  8012af:	83 c4 10             	add    $0x10,%esp
+  8012b2:	85 c0                	test   %eax,%eax
+  8012b4:	78 0e                	js     8012c4 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8012b6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012b9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8012bc:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8012bf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8012c4:	c9                   	leave
+  8012c5:	c3                   	ret
+
+008012c6 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8012c6:	55                   	push   %ebp
+  8012c7:	89 e5                	mov    %esp,%ebp
+  8012c9:	56                   	push   %esi
+  8012ca:	53                   	push   %ebx
+  8012cb:	83 ec 18             	sub    $0x18,%esp
+  8012ce:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8012d1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8012d4:	50                   	push   %eax
+  8012d5:	53                   	push   %ebx
+  8012d6:	e8 0c fc ff ff       	call   800ee7 <fd_lookup>
+  8012db:	83 c4 10             	add    $0x10,%esp
+  8012de:	85 c0                	test   %eax,%eax
+  8012e0:	78 34                	js     801316 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8012e2:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8012e5:	83 ec 08             	sub    $0x8,%esp
+  8012e8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8012eb:	50                   	push   %eax
+  8012ec:	ff 36                	push   (%esi)
+  8012ee:	e8 44 fc ff ff       	call   800f37 <dev_lookup>
+  8012f3:	83 c4 10             	add    $0x10,%esp
+  8012f6:	85 c0                	test   %eax,%eax
+  8012f8:	78 1c                	js     801316 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8012fa:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8012fe:	74 1d                	je     80131d <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801300:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801303:	8b 40 18             	mov    0x18(%eax),%eax
+  801306:	85 c0                	test   %eax,%eax
+  801308:	74 34                	je     80133e <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80130a:	83 ec 08             	sub    $0x8,%esp
+  80130d:	ff 75 0c             	push   0xc(%ebp)
+  801310:	56                   	push   %esi
+  801311:	ff d0                	call   *%eax
+  801313:	83 c4 10             	add    $0x10,%esp
+}
+  801316:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801319:	5b                   	pop    %ebx
+  80131a:	5e                   	pop    %esi
+  80131b:	5d                   	pop    %ebp
+  80131c:	c3                   	ret
+			thisenv->env_id, fdnum);
+  80131d:	a1 08 40 80 00       	mov    0x804008,%eax
+  801322:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801325:	83 ec 04             	sub    $0x4,%esp
+  801328:	53                   	push   %ebx
+  801329:	50                   	push   %eax
+  80132a:	68 70 29 80 00       	push   $0x802970
+  80132f:	e8 be ee ff ff       	call   8001f2 <cprintf>
+		return -E_INVAL;
+  801334:	83 c4 10             	add    $0x10,%esp
+  801337:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80133c:	eb d8                	jmp    801316 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  80133e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801343:	eb d1                	jmp    801316 <ftruncate+0x50>
+
+00801345 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801345:	55                   	push   %ebp
+  801346:	89 e5                	mov    %esp,%ebp
+  801348:	56                   	push   %esi
+  801349:	53                   	push   %ebx
+  80134a:	83 ec 18             	sub    $0x18,%esp
+  80134d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801350:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801353:	50                   	push   %eax
+  801354:	ff 75 08             	push   0x8(%ebp)
+  801357:	e8 8b fb ff ff       	call   800ee7 <fd_lookup>
+  80135c:	83 c4 10             	add    $0x10,%esp
+  80135f:	85 c0                	test   %eax,%eax
+  801361:	78 49                	js     8013ac <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801363:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801366:	83 ec 08             	sub    $0x8,%esp
+  801369:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80136c:	50                   	push   %eax
+  80136d:	ff 36                	push   (%esi)
+  80136f:	e8 c3 fb ff ff       	call   800f37 <dev_lookup>
+  801374:	83 c4 10             	add    $0x10,%esp
+  801377:	85 c0                	test   %eax,%eax
+  801379:	78 31                	js     8013ac <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  80137b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80137e:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801382:	74 2f                	je     8013b3 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801384:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801387:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80138e:	00 00 00 
+	stat->st_isdir = 0;
+  801391:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801398:	00 00 00 
+	stat->st_dev = dev;
+  80139b:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8013a1:	83 ec 08             	sub    $0x8,%esp
+  8013a4:	53                   	push   %ebx
+  8013a5:	56                   	push   %esi
+  8013a6:	ff 50 14             	call   *0x14(%eax)
+  8013a9:	83 c4 10             	add    $0x10,%esp
+}
+  8013ac:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013af:	5b                   	pop    %ebx
+  8013b0:	5e                   	pop    %esi
+  8013b1:	5d                   	pop    %ebp
+  8013b2:	c3                   	ret
+		return -E_NOT_SUPP;
+  8013b3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8013b8:	eb f2                	jmp    8013ac <fstat+0x67>
+
+008013ba <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8013ba:	55                   	push   %ebp
+  8013bb:	89 e5                	mov    %esp,%ebp
+  8013bd:	56                   	push   %esi
+  8013be:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8013bf:	83 ec 08             	sub    $0x8,%esp
+  8013c2:	6a 00                	push   $0x0
+  8013c4:	ff 75 08             	push   0x8(%ebp)
+  8013c7:	e8 e4 01 00 00       	call   8015b0 <open>
+  8013cc:	89 c3                	mov    %eax,%ebx
+  8013ce:	83 c4 10             	add    $0x10,%esp
+  8013d1:	85 c0                	test   %eax,%eax
+  8013d3:	78 1b                	js     8013f0 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8013d5:	83 ec 08             	sub    $0x8,%esp
+  8013d8:	ff 75 0c             	push   0xc(%ebp)
+  8013db:	50                   	push   %eax
+  8013dc:	e8 64 ff ff ff       	call   801345 <fstat>
+  8013e1:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8013e3:	89 1c 24             	mov    %ebx,(%esp)
+  8013e6:	e8 26 fc ff ff       	call   801011 <close>
+	return r;
+  8013eb:	83 c4 10             	add    $0x10,%esp
+  8013ee:	89 f3                	mov    %esi,%ebx
+}
+  8013f0:	89 d8                	mov    %ebx,%eax
+  8013f2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013f5:	5b                   	pop    %ebx
+  8013f6:	5e                   	pop    %esi
+  8013f7:	5d                   	pop    %ebp
+  8013f8:	c3                   	ret
+
+008013f9 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  8013f9:	55                   	push   %ebp
+  8013fa:	89 e5                	mov    %esp,%ebp
+  8013fc:	56                   	push   %esi
+  8013fd:	53                   	push   %ebx
+  8013fe:	89 c6                	mov    %eax,%esi
+  801400:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  801402:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  801409:	74 27                	je     801432 <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80140b:	6a 07                	push   $0x7
+  80140d:	68 00 50 80 00       	push   $0x805000
+  801412:	56                   	push   %esi
+  801413:	ff 35 00 40 80 00    	push   0x804000
+  801419:	e8 17 0c 00 00       	call   802035 <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  80141e:	83 c4 0c             	add    $0xc,%esp
+  801421:	6a 00                	push   $0x0
+  801423:	53                   	push   %ebx
+  801424:	6a 00                	push   $0x0
+  801426:	e8 96 0b 00 00       	call   801fc1 <ipc_recv>
+}
+  80142b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80142e:	5b                   	pop    %ebx
+  80142f:	5e                   	pop    %esi
+  801430:	5d                   	pop    %ebp
+  801431:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  801432:	83 ec 0c             	sub    $0xc,%esp
+  801435:	6a 01                	push   $0x1
+  801437:	e8 4d 0c 00 00       	call   802089 <ipc_find_env>
+  80143c:	a3 00 40 80 00       	mov    %eax,0x804000
+  801441:	83 c4 10             	add    $0x10,%esp
+  801444:	eb c5                	jmp    80140b <fsipc+0x12>
+
+00801446 <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801446:	55                   	push   %ebp
+  801447:	89 e5                	mov    %esp,%ebp
+  801449:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80144c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80144f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801452:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.set_size.req_size = newsize;
+  801457:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80145a:	a3 04 50 80 00       	mov    %eax,0x805004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  80145f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801464:	b8 02 00 00 00       	mov    $0x2,%eax
+  801469:	e8 8b ff ff ff       	call   8013f9 <fsipc>
+}
+  80146e:	c9                   	leave
+  80146f:	c3                   	ret
+
+00801470 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801470:	55                   	push   %ebp
+  801471:	89 e5                	mov    %esp,%ebp
+  801473:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801476:	8b 45 08             	mov    0x8(%ebp),%eax
+  801479:	8b 40 0c             	mov    0xc(%eax),%eax
+  80147c:	a3 00 50 80 00       	mov    %eax,0x805000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801481:	ba 00 00 00 00       	mov    $0x0,%edx
+  801486:	b8 06 00 00 00       	mov    $0x6,%eax
+  80148b:	e8 69 ff ff ff       	call   8013f9 <fsipc>
+}
+  801490:	c9                   	leave
+  801491:	c3                   	ret
+
+00801492 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801492:	55                   	push   %ebp
+  801493:	89 e5                	mov    %esp,%ebp
+  801495:	53                   	push   %ebx
+  801496:	83 ec 04             	sub    $0x4,%esp
+  801499:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80149c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80149f:	8b 40 0c             	mov    0xc(%eax),%eax
+  8014a2:	a3 00 50 80 00       	mov    %eax,0x805000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8014a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014ac:	b8 05 00 00 00       	mov    $0x5,%eax
+  8014b1:	e8 43 ff ff ff       	call   8013f9 <fsipc>
+  8014b6:	85 c0                	test   %eax,%eax
+  8014b8:	78 2c                	js     8014e6 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8014ba:	83 ec 08             	sub    $0x8,%esp
+  8014bd:	68 00 50 80 00       	push   $0x805000
+  8014c2:	53                   	push   %ebx
+  8014c3:	e8 e3 f2 ff ff       	call   8007ab <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  8014c8:	a1 80 50 80 00       	mov    0x805080,%eax
+  8014cd:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8014d3:	a1 84 50 80 00       	mov    0x805084,%eax
+  8014d8:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  8014de:	83 c4 10             	add    $0x10,%esp
+  8014e1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8014e6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014e9:	c9                   	leave
+  8014ea:	c3                   	ret
+
+008014eb <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8014eb:	55                   	push   %ebp
+  8014ec:	89 e5                	mov    %esp,%ebp
+  8014ee:	83 ec 0c             	sub    $0xc,%esp
+  8014f1:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8014f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014f7:	8b 52 0c             	mov    0xc(%edx),%edx
+  8014fa:	89 15 00 50 80 00    	mov    %edx,0x805000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801500:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801505:	39 d0                	cmp    %edx,%eax
+  801507:	0f 47 c2             	cmova  %edx,%eax
+  80150a:	a3 04 50 80 00       	mov    %eax,0x805004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  80150f:	50                   	push   %eax
+  801510:	ff 75 0c             	push   0xc(%ebp)
+  801513:	68 08 50 80 00       	push   $0x805008
+  801518:	e8 14 f4 ff ff       	call   800931 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  80151d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801522:	b8 04 00 00 00       	mov    $0x4,%eax
+  801527:	e8 cd fe ff ff       	call   8013f9 <fsipc>
+}
+  80152c:	c9                   	leave
+  80152d:	c3                   	ret
+
+0080152e <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80152e:	55                   	push   %ebp
+  80152f:	89 e5                	mov    %esp,%ebp
+  801531:	56                   	push   %esi
+  801532:	53                   	push   %ebx
+  801533:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801536:	8b 45 08             	mov    0x8(%ebp),%eax
+  801539:	8b 40 0c             	mov    0xc(%eax),%eax
+  80153c:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.read.req_n = n;
+  801541:	89 35 04 50 80 00    	mov    %esi,0x805004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801547:	ba 00 00 00 00       	mov    $0x0,%edx
+  80154c:	b8 03 00 00 00       	mov    $0x3,%eax
+  801551:	e8 a3 fe ff ff       	call   8013f9 <fsipc>
+  801556:	89 c3                	mov    %eax,%ebx
+  801558:	85 c0                	test   %eax,%eax
+  80155a:	78 1f                	js     80157b <devfile_read+0x4d>
+  assert(r <= n);
+  80155c:	39 c6                	cmp    %eax,%esi
+  80155e:	72 24                	jb     801584 <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  801560:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801565:	7f 33                	jg     80159a <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801567:	83 ec 04             	sub    $0x4,%esp
+  80156a:	50                   	push   %eax
+  80156b:	68 00 50 80 00       	push   $0x805000
+  801570:	ff 75 0c             	push   0xc(%ebp)
+  801573:	e8 b9 f3 ff ff       	call   800931 <memmove>
+  return r;
+  801578:	83 c4 10             	add    $0x10,%esp
+}
+  80157b:	89 d8                	mov    %ebx,%eax
+  80157d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801580:	5b                   	pop    %ebx
+  801581:	5e                   	pop    %esi
+  801582:	5d                   	pop    %ebp
+  801583:	c3                   	ret
+  assert(r <= n);
+  801584:	68 e0 29 80 00       	push   $0x8029e0
+  801589:	68 e7 29 80 00       	push   $0x8029e7
+  80158e:	6a 78                	push   $0x78
+  801590:	68 fc 29 80 00       	push   $0x8029fc
+  801595:	e8 e1 09 00 00       	call   801f7b <_panic>
+  assert(r <= PGSIZE);
+  80159a:	68 07 2a 80 00       	push   $0x802a07
+  80159f:	68 e7 29 80 00       	push   $0x8029e7
+  8015a4:	6a 79                	push   $0x79
+  8015a6:	68 fc 29 80 00       	push   $0x8029fc
+  8015ab:	e8 cb 09 00 00       	call   801f7b <_panic>
+
+008015b0 <open>:
+open(const char *path, int mode) {
+  8015b0:	55                   	push   %ebp
+  8015b1:	89 e5                	mov    %esp,%ebp
+  8015b3:	56                   	push   %esi
+  8015b4:	53                   	push   %ebx
+  8015b5:	83 ec 1c             	sub    $0x1c,%esp
+  8015b8:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  8015bb:	56                   	push   %esi
+  8015bc:	e8 af f1 ff ff       	call   800770 <strlen>
+  8015c1:	83 c4 10             	add    $0x10,%esp
+  8015c4:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8015c9:	7f 6c                	jg     801637 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  8015cb:	83 ec 0c             	sub    $0xc,%esp
+  8015ce:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015d1:	50                   	push   %eax
+  8015d2:	e8 ba f8 ff ff       	call   800e91 <fd_alloc>
+  8015d7:	89 c3                	mov    %eax,%ebx
+  8015d9:	83 c4 10             	add    $0x10,%esp
+  8015dc:	85 c0                	test   %eax,%eax
+  8015de:	78 3c                	js     80161c <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  8015e0:	83 ec 08             	sub    $0x8,%esp
+  8015e3:	56                   	push   %esi
+  8015e4:	68 00 50 80 00       	push   $0x805000
+  8015e9:	e8 bd f1 ff ff       	call   8007ab <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  8015ee:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8015f1:	a3 00 54 80 00       	mov    %eax,0x805400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8015f6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8015f9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8015fe:	e8 f6 fd ff ff       	call   8013f9 <fsipc>
+  801603:	89 c3                	mov    %eax,%ebx
+  801605:	83 c4 10             	add    $0x10,%esp
+  801608:	85 c0                	test   %eax,%eax
+  80160a:	78 19                	js     801625 <open+0x75>
+  return fd2num(fd);
+  80160c:	83 ec 0c             	sub    $0xc,%esp
+  80160f:	ff 75 f4             	push   -0xc(%ebp)
+  801612:	e8 53 f8 ff ff       	call   800e6a <fd2num>
+  801617:	89 c3                	mov    %eax,%ebx
+  801619:	83 c4 10             	add    $0x10,%esp
+}
+  80161c:	89 d8                	mov    %ebx,%eax
+  80161e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801621:	5b                   	pop    %ebx
+  801622:	5e                   	pop    %esi
+  801623:	5d                   	pop    %ebp
+  801624:	c3                   	ret
+    fd_close(fd, 0);
+  801625:	83 ec 08             	sub    $0x8,%esp
+  801628:	6a 00                	push   $0x0
+  80162a:	ff 75 f4             	push   -0xc(%ebp)
+  80162d:	e8 58 f9 ff ff       	call   800f8a <fd_close>
+    return r;
+  801632:	83 c4 10             	add    $0x10,%esp
+  801635:	eb e5                	jmp    80161c <open+0x6c>
+    return -E_BAD_PATH;
+  801637:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80163c:	eb de                	jmp    80161c <open+0x6c>
+
+0080163e <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  80163e:	55                   	push   %ebp
+  80163f:	89 e5                	mov    %esp,%ebp
+  801641:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801644:	ba 00 00 00 00       	mov    $0x0,%edx
+  801649:	b8 08 00 00 00       	mov    $0x8,%eax
+  80164e:	e8 a6 fd ff ff       	call   8013f9 <fsipc>
+}
+  801653:	c9                   	leave
+  801654:	c3                   	ret
+
+00801655 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801655:	55                   	push   %ebp
+  801656:	89 e5                	mov    %esp,%ebp
+  801658:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  80165b:	68 13 2a 80 00       	push   $0x802a13
+  801660:	ff 75 0c             	push   0xc(%ebp)
+  801663:	e8 43 f1 ff ff       	call   8007ab <strcpy>
+	return 0;
+}
+  801668:	b8 00 00 00 00       	mov    $0x0,%eax
+  80166d:	c9                   	leave
+  80166e:	c3                   	ret
+
+0080166f <devsock_close>:
+{
+  80166f:	55                   	push   %ebp
+  801670:	89 e5                	mov    %esp,%ebp
+  801672:	53                   	push   %ebx
+  801673:	83 ec 10             	sub    $0x10,%esp
+  801676:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801679:	53                   	push   %ebx
+  80167a:	e8 49 0a 00 00       	call   8020c8 <pageref>
+  80167f:	89 c2                	mov    %eax,%edx
+  801681:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801684:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801689:	83 fa 01             	cmp    $0x1,%edx
+  80168c:	74 05                	je     801693 <devsock_close+0x24>
+}
+  80168e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801691:	c9                   	leave
+  801692:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801693:	83 ec 0c             	sub    $0xc,%esp
+  801696:	ff 73 0c             	push   0xc(%ebx)
+  801699:	e8 b7 02 00 00       	call   801955 <nsipc_close>
+  80169e:	83 c4 10             	add    $0x10,%esp
+  8016a1:	eb eb                	jmp    80168e <devsock_close+0x1f>
+
+008016a3 <devsock_write>:
+{
+  8016a3:	55                   	push   %ebp
+  8016a4:	89 e5                	mov    %esp,%ebp
+  8016a6:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8016a9:	6a 00                	push   $0x0
+  8016ab:	ff 75 10             	push   0x10(%ebp)
+  8016ae:	ff 75 0c             	push   0xc(%ebp)
+  8016b1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016b4:	ff 70 0c             	push   0xc(%eax)
+  8016b7:	e8 79 03 00 00       	call   801a35 <nsipc_send>
+}
+  8016bc:	c9                   	leave
+  8016bd:	c3                   	ret
+
+008016be <devsock_read>:
+{
+  8016be:	55                   	push   %ebp
+  8016bf:	89 e5                	mov    %esp,%ebp
+  8016c1:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8016c4:	6a 00                	push   $0x0
+  8016c6:	ff 75 10             	push   0x10(%ebp)
+  8016c9:	ff 75 0c             	push   0xc(%ebp)
+  8016cc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016cf:	ff 70 0c             	push   0xc(%eax)
+  8016d2:	e8 ef 02 00 00       	call   8019c6 <nsipc_recv>
+}
+  8016d7:	c9                   	leave
+  8016d8:	c3                   	ret
+
+008016d9 <fd2sockid>:
+{
+  8016d9:	55                   	push   %ebp
+  8016da:	89 e5                	mov    %esp,%ebp
+  8016dc:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8016df:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8016e2:	52                   	push   %edx
+  8016e3:	50                   	push   %eax
+  8016e4:	e8 fe f7 ff ff       	call   800ee7 <fd_lookup>
+  8016e9:	83 c4 10             	add    $0x10,%esp
+  8016ec:	85 c0                	test   %eax,%eax
+  8016ee:	78 10                	js     801700 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8016f0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016f3:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  8016f9:	39 08                	cmp    %ecx,(%eax)
+  8016fb:	75 05                	jne    801702 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8016fd:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801700:	c9                   	leave
+  801701:	c3                   	ret
+		return -E_NOT_SUPP;
+  801702:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801707:	eb f7                	jmp    801700 <fd2sockid+0x27>
+
+00801709 <alloc_sockfd>:
+{
+  801709:	55                   	push   %ebp
+  80170a:	89 e5                	mov    %esp,%ebp
+  80170c:	56                   	push   %esi
+  80170d:	53                   	push   %ebx
+  80170e:	83 ec 1c             	sub    $0x1c,%esp
+  801711:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801713:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801716:	50                   	push   %eax
+  801717:	e8 75 f7 ff ff       	call   800e91 <fd_alloc>
+  80171c:	89 c3                	mov    %eax,%ebx
+  80171e:	83 c4 10             	add    $0x10,%esp
+  801721:	85 c0                	test   %eax,%eax
+  801723:	78 43                	js     801768 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801725:	83 ec 04             	sub    $0x4,%esp
+  801728:	68 07 04 00 00       	push   $0x407
+  80172d:	ff 75 f4             	push   -0xc(%ebp)
+  801730:	6a 00                	push   $0x0
+  801732:	e8 60 f4 ff ff       	call   800b97 <sys_page_alloc>
+  801737:	89 c3                	mov    %eax,%ebx
+  801739:	83 c4 10             	add    $0x10,%esp
+  80173c:	85 c0                	test   %eax,%eax
+  80173e:	78 28                	js     801768 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801740:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801743:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  801749:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  80174b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80174e:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801755:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801758:	83 ec 0c             	sub    $0xc,%esp
+  80175b:	50                   	push   %eax
+  80175c:	e8 09 f7 ff ff       	call   800e6a <fd2num>
+  801761:	89 c3                	mov    %eax,%ebx
+  801763:	83 c4 10             	add    $0x10,%esp
+  801766:	eb 0c                	jmp    801774 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801768:	83 ec 0c             	sub    $0xc,%esp
+  80176b:	56                   	push   %esi
+  80176c:	e8 e4 01 00 00       	call   801955 <nsipc_close>
+		return r;
+  801771:	83 c4 10             	add    $0x10,%esp
+}
+  801774:	89 d8                	mov    %ebx,%eax
+  801776:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801779:	5b                   	pop    %ebx
+  80177a:	5e                   	pop    %esi
+  80177b:	5d                   	pop    %ebp
+  80177c:	c3                   	ret
+
+0080177d <accept>:
+{
+  80177d:	55                   	push   %ebp
+  80177e:	89 e5                	mov    %esp,%ebp
+  801780:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801783:	8b 45 08             	mov    0x8(%ebp),%eax
+  801786:	e8 4e ff ff ff       	call   8016d9 <fd2sockid>
+  80178b:	85 c0                	test   %eax,%eax
+  80178d:	78 1b                	js     8017aa <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  80178f:	83 ec 04             	sub    $0x4,%esp
+  801792:	ff 75 10             	push   0x10(%ebp)
+  801795:	ff 75 0c             	push   0xc(%ebp)
+  801798:	50                   	push   %eax
+  801799:	e8 0e 01 00 00       	call   8018ac <nsipc_accept>
+  80179e:	83 c4 10             	add    $0x10,%esp
+  8017a1:	85 c0                	test   %eax,%eax
+  8017a3:	78 05                	js     8017aa <accept+0x2d>
+	return alloc_sockfd(r);
+  8017a5:	e8 5f ff ff ff       	call   801709 <alloc_sockfd>
+}
+  8017aa:	c9                   	leave
+  8017ab:	c3                   	ret
+
+008017ac <bind>:
+{
+  8017ac:	55                   	push   %ebp
+  8017ad:	89 e5                	mov    %esp,%ebp
+  8017af:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8017b2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017b5:	e8 1f ff ff ff       	call   8016d9 <fd2sockid>
+  8017ba:	85 c0                	test   %eax,%eax
+  8017bc:	78 12                	js     8017d0 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8017be:	83 ec 04             	sub    $0x4,%esp
+  8017c1:	ff 75 10             	push   0x10(%ebp)
+  8017c4:	ff 75 0c             	push   0xc(%ebp)
+  8017c7:	50                   	push   %eax
+  8017c8:	e8 31 01 00 00       	call   8018fe <nsipc_bind>
+  8017cd:	83 c4 10             	add    $0x10,%esp
+}
+  8017d0:	c9                   	leave
+  8017d1:	c3                   	ret
+
+008017d2 <shutdown>:
+{
+  8017d2:	55                   	push   %ebp
+  8017d3:	89 e5                	mov    %esp,%ebp
+  8017d5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8017d8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017db:	e8 f9 fe ff ff       	call   8016d9 <fd2sockid>
+  8017e0:	85 c0                	test   %eax,%eax
+  8017e2:	78 0f                	js     8017f3 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8017e4:	83 ec 08             	sub    $0x8,%esp
+  8017e7:	ff 75 0c             	push   0xc(%ebp)
+  8017ea:	50                   	push   %eax
+  8017eb:	e8 43 01 00 00       	call   801933 <nsipc_shutdown>
+  8017f0:	83 c4 10             	add    $0x10,%esp
+}
+  8017f3:	c9                   	leave
+  8017f4:	c3                   	ret
+
+008017f5 <connect>:
+{
+  8017f5:	55                   	push   %ebp
+  8017f6:	89 e5                	mov    %esp,%ebp
+  8017f8:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8017fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017fe:	e8 d6 fe ff ff       	call   8016d9 <fd2sockid>
+  801803:	85 c0                	test   %eax,%eax
+  801805:	78 12                	js     801819 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801807:	83 ec 04             	sub    $0x4,%esp
+  80180a:	ff 75 10             	push   0x10(%ebp)
+  80180d:	ff 75 0c             	push   0xc(%ebp)
+  801810:	50                   	push   %eax
+  801811:	e8 59 01 00 00       	call   80196f <nsipc_connect>
+  801816:	83 c4 10             	add    $0x10,%esp
+}
+  801819:	c9                   	leave
+  80181a:	c3                   	ret
+
+0080181b <listen>:
+{
+  80181b:	55                   	push   %ebp
+  80181c:	89 e5                	mov    %esp,%ebp
+  80181e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801821:	8b 45 08             	mov    0x8(%ebp),%eax
+  801824:	e8 b0 fe ff ff       	call   8016d9 <fd2sockid>
+  801829:	85 c0                	test   %eax,%eax
+  80182b:	78 0f                	js     80183c <listen+0x21>
+	return nsipc_listen(r, backlog);
+  80182d:	83 ec 08             	sub    $0x8,%esp
+  801830:	ff 75 0c             	push   0xc(%ebp)
+  801833:	50                   	push   %eax
+  801834:	e8 6b 01 00 00       	call   8019a4 <nsipc_listen>
+  801839:	83 c4 10             	add    $0x10,%esp
+}
+  80183c:	c9                   	leave
+  80183d:	c3                   	ret
+
+0080183e <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80183e:	55                   	push   %ebp
+  80183f:	89 e5                	mov    %esp,%ebp
+  801841:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801844:	ff 75 10             	push   0x10(%ebp)
+  801847:	ff 75 0c             	push   0xc(%ebp)
+  80184a:	ff 75 08             	push   0x8(%ebp)
+  80184d:	e8 41 02 00 00       	call   801a93 <nsipc_socket>
+  801852:	83 c4 10             	add    $0x10,%esp
+  801855:	85 c0                	test   %eax,%eax
+  801857:	78 05                	js     80185e <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801859:	e8 ab fe ff ff       	call   801709 <alloc_sockfd>
+}
+  80185e:	c9                   	leave
+  80185f:	c3                   	ret
+
+00801860 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801860:	55                   	push   %ebp
+  801861:	89 e5                	mov    %esp,%ebp
+  801863:	53                   	push   %ebx
+  801864:	83 ec 04             	sub    $0x4,%esp
+  801867:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801869:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801870:	74 26                	je     801898 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801872:	6a 07                	push   $0x7
+  801874:	68 00 60 80 00       	push   $0x806000
+  801879:	53                   	push   %ebx
+  80187a:	ff 35 04 40 80 00    	push   0x804004
+  801880:	e8 b0 07 00 00       	call   802035 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801885:	83 c4 0c             	add    $0xc,%esp
+  801888:	6a 00                	push   $0x0
+  80188a:	6a 00                	push   $0x0
+  80188c:	6a 00                	push   $0x0
+  80188e:	e8 2e 07 00 00       	call   801fc1 <ipc_recv>
+}
+  801893:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801896:	c9                   	leave
+  801897:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801898:	83 ec 0c             	sub    $0xc,%esp
+  80189b:	6a 02                	push   $0x2
+  80189d:	e8 e7 07 00 00       	call   802089 <ipc_find_env>
+  8018a2:	a3 04 40 80 00       	mov    %eax,0x804004
+  8018a7:	83 c4 10             	add    $0x10,%esp
+  8018aa:	eb c6                	jmp    801872 <nsipc+0x12>
+
+008018ac <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8018ac:	55                   	push   %ebp
+  8018ad:	89 e5                	mov    %esp,%ebp
+  8018af:	56                   	push   %esi
+  8018b0:	53                   	push   %ebx
+  8018b1:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8018b4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018b7:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  8018bc:	8b 06                	mov    (%esi),%eax
+  8018be:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8018c3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8018c8:	e8 93 ff ff ff       	call   801860 <nsipc>
+  8018cd:	89 c3                	mov    %eax,%ebx
+  8018cf:	85 c0                	test   %eax,%eax
+  8018d1:	79 09                	jns    8018dc <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8018d3:	89 d8                	mov    %ebx,%eax
+  8018d5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018d8:	5b                   	pop    %ebx
+  8018d9:	5e                   	pop    %esi
+  8018da:	5d                   	pop    %ebp
+  8018db:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8018dc:	83 ec 04             	sub    $0x4,%esp
+  8018df:	ff 35 10 60 80 00    	push   0x806010
+  8018e5:	68 00 60 80 00       	push   $0x806000
+  8018ea:	ff 75 0c             	push   0xc(%ebp)
+  8018ed:	e8 3f f0 ff ff       	call   800931 <memmove>
+		*addrlen = ret->ret_addrlen;
+  8018f2:	a1 10 60 80 00       	mov    0x806010,%eax
+  8018f7:	89 06                	mov    %eax,(%esi)
+  8018f9:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8018fc:	eb d5                	jmp    8018d3 <nsipc_accept+0x27>
+
+008018fe <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8018fe:	55                   	push   %ebp
+  8018ff:	89 e5                	mov    %esp,%ebp
+  801901:	53                   	push   %ebx
+  801902:	83 ec 08             	sub    $0x8,%esp
+  801905:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801908:	8b 45 08             	mov    0x8(%ebp),%eax
+  80190b:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801910:	53                   	push   %ebx
+  801911:	ff 75 0c             	push   0xc(%ebp)
+  801914:	68 04 60 80 00       	push   $0x806004
+  801919:	e8 13 f0 ff ff       	call   800931 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  80191e:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  801924:	b8 02 00 00 00       	mov    $0x2,%eax
+  801929:	e8 32 ff ff ff       	call   801860 <nsipc>
+}
+  80192e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801931:	c9                   	leave
+  801932:	c3                   	ret
+
+00801933 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801933:	55                   	push   %ebp
+  801934:	89 e5                	mov    %esp,%ebp
+  801936:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801939:	8b 45 08             	mov    0x8(%ebp),%eax
+  80193c:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  801941:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801944:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  801949:	b8 03 00 00 00       	mov    $0x3,%eax
+  80194e:	e8 0d ff ff ff       	call   801860 <nsipc>
+}
+  801953:	c9                   	leave
+  801954:	c3                   	ret
+
+00801955 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801955:	55                   	push   %ebp
+  801956:	89 e5                	mov    %esp,%ebp
+  801958:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  80195b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80195e:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  801963:	b8 04 00 00 00       	mov    $0x4,%eax
+  801968:	e8 f3 fe ff ff       	call   801860 <nsipc>
+}
+  80196d:	c9                   	leave
+  80196e:	c3                   	ret
+
+0080196f <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80196f:	55                   	push   %ebp
+  801970:	89 e5                	mov    %esp,%ebp
+  801972:	53                   	push   %ebx
+  801973:	83 ec 08             	sub    $0x8,%esp
+  801976:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801979:	8b 45 08             	mov    0x8(%ebp),%eax
+  80197c:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801981:	53                   	push   %ebx
+  801982:	ff 75 0c             	push   0xc(%ebp)
+  801985:	68 04 60 80 00       	push   $0x806004
+  80198a:	e8 a2 ef ff ff       	call   800931 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  80198f:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  801995:	b8 05 00 00 00       	mov    $0x5,%eax
+  80199a:	e8 c1 fe ff ff       	call   801860 <nsipc>
+}
+  80199f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019a2:	c9                   	leave
+  8019a3:	c3                   	ret
+
+008019a4 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8019a4:	55                   	push   %ebp
+  8019a5:	89 e5                	mov    %esp,%ebp
+  8019a7:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8019aa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019ad:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  8019b2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019b5:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  8019ba:	b8 06 00 00 00       	mov    $0x6,%eax
+  8019bf:	e8 9c fe ff ff       	call   801860 <nsipc>
+}
+  8019c4:	c9                   	leave
+  8019c5:	c3                   	ret
+
+008019c6 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8019c6:	55                   	push   %ebp
+  8019c7:	89 e5                	mov    %esp,%ebp
+  8019c9:	56                   	push   %esi
+  8019ca:	53                   	push   %ebx
+  8019cb:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8019ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019d1:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  8019d6:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  8019dc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019df:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8019e4:	b8 07 00 00 00       	mov    $0x7,%eax
+  8019e9:	e8 72 fe ff ff       	call   801860 <nsipc>
+  8019ee:	89 c3                	mov    %eax,%ebx
+  8019f0:	85 c0                	test   %eax,%eax
+  8019f2:	78 22                	js     801a16 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8019f4:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8019f9:	39 c6                	cmp    %eax,%esi
+  8019fb:	0f 4e c6             	cmovle %esi,%eax
+  8019fe:	39 c3                	cmp    %eax,%ebx
+  801a00:	7f 1d                	jg     801a1f <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801a02:	83 ec 04             	sub    $0x4,%esp
+  801a05:	53                   	push   %ebx
+  801a06:	68 00 60 80 00       	push   $0x806000
+  801a0b:	ff 75 0c             	push   0xc(%ebp)
+  801a0e:	e8 1e ef ff ff       	call   800931 <memmove>
+  801a13:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801a16:	89 d8                	mov    %ebx,%eax
+  801a18:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a1b:	5b                   	pop    %ebx
+  801a1c:	5e                   	pop    %esi
+  801a1d:	5d                   	pop    %ebp
+  801a1e:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801a1f:	68 1f 2a 80 00       	push   $0x802a1f
+  801a24:	68 e7 29 80 00       	push   $0x8029e7
+  801a29:	6a 62                	push   $0x62
+  801a2b:	68 34 2a 80 00       	push   $0x802a34
+  801a30:	e8 46 05 00 00       	call   801f7b <_panic>
+
+00801a35 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801a35:	55                   	push   %ebp
+  801a36:	89 e5                	mov    %esp,%ebp
+  801a38:	53                   	push   %ebx
+  801a39:	83 ec 04             	sub    $0x4,%esp
+  801a3c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801a3f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a42:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  801a47:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801a4d:	7f 2e                	jg     801a7d <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801a4f:	83 ec 04             	sub    $0x4,%esp
+  801a52:	53                   	push   %ebx
+  801a53:	ff 75 0c             	push   0xc(%ebp)
+  801a56:	68 0c 60 80 00       	push   $0x80600c
+  801a5b:	e8 d1 ee ff ff       	call   800931 <memmove>
+	nsipcbuf.send.req_size = size;
+  801a60:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  801a66:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a69:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  801a6e:	b8 08 00 00 00       	mov    $0x8,%eax
+  801a73:	e8 e8 fd ff ff       	call   801860 <nsipc>
+}
+  801a78:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a7b:	c9                   	leave
+  801a7c:	c3                   	ret
+	assert(size < 1600);
+  801a7d:	68 40 2a 80 00       	push   $0x802a40
+  801a82:	68 e7 29 80 00       	push   $0x8029e7
+  801a87:	6a 6d                	push   $0x6d
+  801a89:	68 34 2a 80 00       	push   $0x802a34
+  801a8e:	e8 e8 04 00 00       	call   801f7b <_panic>
+
+00801a93 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801a93:	55                   	push   %ebp
+  801a94:	89 e5                	mov    %esp,%ebp
+  801a96:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801a99:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a9c:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  801aa1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801aa4:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  801aa9:	8b 45 10             	mov    0x10(%ebp),%eax
+  801aac:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  801ab1:	b8 09 00 00 00       	mov    $0x9,%eax
+  801ab6:	e8 a5 fd ff ff       	call   801860 <nsipc>
+}
+  801abb:	c9                   	leave
+  801abc:	c3                   	ret
+
+00801abd <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801abd:	55                   	push   %ebp
+  801abe:	89 e5                	mov    %esp,%ebp
+  801ac0:	56                   	push   %esi
+  801ac1:	53                   	push   %ebx
+  801ac2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801ac5:	83 ec 0c             	sub    $0xc,%esp
+  801ac8:	ff 75 08             	push   0x8(%ebp)
+  801acb:	e8 aa f3 ff ff       	call   800e7a <fd2data>
+  801ad0:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801ad2:	83 c4 08             	add    $0x8,%esp
+  801ad5:	68 4c 2a 80 00       	push   $0x802a4c
+  801ada:	53                   	push   %ebx
+  801adb:	e8 cb ec ff ff       	call   8007ab <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801ae0:	8b 46 04             	mov    0x4(%esi),%eax
+  801ae3:	2b 06                	sub    (%esi),%eax
+  801ae5:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  801aeb:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801af2:	00 00 00 
+	stat->st_dev = &devpipe;
+  801af5:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  801afc:	30 80 00 
+	return 0;
+}
+  801aff:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b04:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b07:	5b                   	pop    %ebx
+  801b08:	5e                   	pop    %esi
+  801b09:	5d                   	pop    %ebp
+  801b0a:	c3                   	ret
+
+00801b0b <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801b0b:	55                   	push   %ebp
+  801b0c:	89 e5                	mov    %esp,%ebp
+  801b0e:	53                   	push   %ebx
+  801b0f:	83 ec 0c             	sub    $0xc,%esp
+  801b12:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801b15:	53                   	push   %ebx
+  801b16:	6a 00                	push   $0x0
+  801b18:	e8 ff f0 ff ff       	call   800c1c <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801b1d:	89 1c 24             	mov    %ebx,(%esp)
+  801b20:	e8 55 f3 ff ff       	call   800e7a <fd2data>
+  801b25:	83 c4 08             	add    $0x8,%esp
+  801b28:	50                   	push   %eax
+  801b29:	6a 00                	push   $0x0
+  801b2b:	e8 ec f0 ff ff       	call   800c1c <sys_page_unmap>
+}
+  801b30:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b33:	c9                   	leave
+  801b34:	c3                   	ret
+
+00801b35 <_pipeisclosed>:
+{
+  801b35:	55                   	push   %ebp
+  801b36:	89 e5                	mov    %esp,%ebp
+  801b38:	57                   	push   %edi
+  801b39:	56                   	push   %esi
+  801b3a:	53                   	push   %ebx
+  801b3b:	83 ec 1c             	sub    $0x1c,%esp
+  801b3e:	89 c7                	mov    %eax,%edi
+  801b40:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801b42:	a1 08 40 80 00       	mov    0x804008,%eax
+  801b47:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801b4a:	83 ec 0c             	sub    $0xc,%esp
+  801b4d:	57                   	push   %edi
+  801b4e:	e8 75 05 00 00       	call   8020c8 <pageref>
+  801b53:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801b56:	89 34 24             	mov    %esi,(%esp)
+  801b59:	e8 6a 05 00 00       	call   8020c8 <pageref>
+		nn = thisenv->env_runs;
+  801b5e:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801b64:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801b67:	83 c4 10             	add    $0x10,%esp
+  801b6a:	39 cb                	cmp    %ecx,%ebx
+  801b6c:	74 1b                	je     801b89 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801b6e:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801b71:	75 cf                	jne    801b42 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801b73:	8b 42 58             	mov    0x58(%edx),%eax
+  801b76:	6a 01                	push   $0x1
+  801b78:	50                   	push   %eax
+  801b79:	53                   	push   %ebx
+  801b7a:	68 53 2a 80 00       	push   $0x802a53
+  801b7f:	e8 6e e6 ff ff       	call   8001f2 <cprintf>
+  801b84:	83 c4 10             	add    $0x10,%esp
+  801b87:	eb b9                	jmp    801b42 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801b89:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801b8c:	0f 94 c0             	sete   %al
+  801b8f:	0f b6 c0             	movzbl %al,%eax
+}
+  801b92:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b95:	5b                   	pop    %ebx
+  801b96:	5e                   	pop    %esi
+  801b97:	5f                   	pop    %edi
+  801b98:	5d                   	pop    %ebp
+  801b99:	c3                   	ret
+
+00801b9a <devpipe_write>:
+{
+  801b9a:	55                   	push   %ebp
+  801b9b:	89 e5                	mov    %esp,%ebp
+  801b9d:	57                   	push   %edi
+  801b9e:	56                   	push   %esi
+  801b9f:	53                   	push   %ebx
+  801ba0:	83 ec 28             	sub    $0x28,%esp
+  801ba3:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801ba6:	56                   	push   %esi
+  801ba7:	e8 ce f2 ff ff       	call   800e7a <fd2data>
+  801bac:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801bae:	83 c4 10             	add    $0x10,%esp
+  801bb1:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bb6:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801bb9:	75 09                	jne    801bc4 <devpipe_write+0x2a>
+	return i;
+  801bbb:	89 f8                	mov    %edi,%eax
+  801bbd:	eb 23                	jmp    801be2 <devpipe_write+0x48>
+			sys_yield();
+  801bbf:	e8 b4 ef ff ff       	call   800b78 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801bc4:	8b 43 04             	mov    0x4(%ebx),%eax
+  801bc7:	8b 0b                	mov    (%ebx),%ecx
+  801bc9:	8d 51 20             	lea    0x20(%ecx),%edx
+  801bcc:	39 d0                	cmp    %edx,%eax
+  801bce:	72 1a                	jb     801bea <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  801bd0:	89 da                	mov    %ebx,%edx
+  801bd2:	89 f0                	mov    %esi,%eax
+  801bd4:	e8 5c ff ff ff       	call   801b35 <_pipeisclosed>
+  801bd9:	85 c0                	test   %eax,%eax
+  801bdb:	74 e2                	je     801bbf <devpipe_write+0x25>
+				return 0;
+  801bdd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801be2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801be5:	5b                   	pop    %ebx
+  801be6:	5e                   	pop    %esi
+  801be7:	5f                   	pop    %edi
+  801be8:	5d                   	pop    %ebp
+  801be9:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801bea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801bed:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801bf1:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801bf4:	89 c2                	mov    %eax,%edx
+  801bf6:	c1 fa 1f             	sar    $0x1f,%edx
+  801bf9:	89 d1                	mov    %edx,%ecx
+  801bfb:	c1 e9 1b             	shr    $0x1b,%ecx
+  801bfe:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801c01:	83 e2 1f             	and    $0x1f,%edx
+  801c04:	29 ca                	sub    %ecx,%edx
+  801c06:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801c0a:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  801c0e:	83 c0 01             	add    $0x1,%eax
+  801c11:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  801c14:	83 c7 01             	add    $0x1,%edi
+  801c17:	eb 9d                	jmp    801bb6 <devpipe_write+0x1c>
+
+00801c19 <devpipe_read>:
+{
+  801c19:	55                   	push   %ebp
+  801c1a:	89 e5                	mov    %esp,%ebp
+  801c1c:	57                   	push   %edi
+  801c1d:	56                   	push   %esi
+  801c1e:	53                   	push   %ebx
+  801c1f:	83 ec 18             	sub    $0x18,%esp
+  801c22:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  801c25:	57                   	push   %edi
+  801c26:	e8 4f f2 ff ff       	call   800e7a <fd2data>
+  801c2b:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801c2d:	83 c4 10             	add    $0x10,%esp
+  801c30:	be 00 00 00 00       	mov    $0x0,%esi
+  801c35:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801c38:	75 13                	jne    801c4d <devpipe_read+0x34>
+	return i;
+  801c3a:	89 f0                	mov    %esi,%eax
+  801c3c:	eb 02                	jmp    801c40 <devpipe_read+0x27>
+				return i;
+  801c3e:	89 f0                	mov    %esi,%eax
+}
+  801c40:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c43:	5b                   	pop    %ebx
+  801c44:	5e                   	pop    %esi
+  801c45:	5f                   	pop    %edi
+  801c46:	5d                   	pop    %ebp
+  801c47:	c3                   	ret
+			sys_yield();
+  801c48:	e8 2b ef ff ff       	call   800b78 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  801c4d:	8b 03                	mov    (%ebx),%eax
+  801c4f:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801c52:	75 18                	jne    801c6c <devpipe_read+0x53>
+			if (i > 0)
+  801c54:	85 f6                	test   %esi,%esi
+  801c56:	75 e6                	jne    801c3e <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  801c58:	89 da                	mov    %ebx,%edx
+  801c5a:	89 f8                	mov    %edi,%eax
+  801c5c:	e8 d4 fe ff ff       	call   801b35 <_pipeisclosed>
+  801c61:	85 c0                	test   %eax,%eax
+  801c63:	74 e3                	je     801c48 <devpipe_read+0x2f>
+				return 0;
+  801c65:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c6a:	eb d4                	jmp    801c40 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801c6c:	99                   	cltd
+  801c6d:	c1 ea 1b             	shr    $0x1b,%edx
+  801c70:	01 d0                	add    %edx,%eax
+  801c72:	83 e0 1f             	and    $0x1f,%eax
+  801c75:	29 d0                	sub    %edx,%eax
+  801c77:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801c7c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c7f:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  801c82:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  801c85:	83 c6 01             	add    $0x1,%esi
+  801c88:	eb ab                	jmp    801c35 <devpipe_read+0x1c>
+
+00801c8a <pipe>:
+{
+  801c8a:	55                   	push   %ebp
+  801c8b:	89 e5                	mov    %esp,%ebp
+  801c8d:	56                   	push   %esi
+  801c8e:	53                   	push   %ebx
+  801c8f:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801c92:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c95:	50                   	push   %eax
+  801c96:	e8 f6 f1 ff ff       	call   800e91 <fd_alloc>
+  801c9b:	89 c3                	mov    %eax,%ebx
+  801c9d:	83 c4 10             	add    $0x10,%esp
+  801ca0:	85 c0                	test   %eax,%eax
+  801ca2:	0f 88 23 01 00 00    	js     801dcb <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801ca8:	83 ec 04             	sub    $0x4,%esp
+  801cab:	68 07 04 00 00       	push   $0x407
+  801cb0:	ff 75 f4             	push   -0xc(%ebp)
+  801cb3:	6a 00                	push   $0x0
+  801cb5:	e8 dd ee ff ff       	call   800b97 <sys_page_alloc>
+  801cba:	89 c3                	mov    %eax,%ebx
+  801cbc:	83 c4 10             	add    $0x10,%esp
+  801cbf:	85 c0                	test   %eax,%eax
+  801cc1:	0f 88 04 01 00 00    	js     801dcb <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801cc7:	83 ec 0c             	sub    $0xc,%esp
+  801cca:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ccd:	50                   	push   %eax
+  801cce:	e8 be f1 ff ff       	call   800e91 <fd_alloc>
+  801cd3:	89 c3                	mov    %eax,%ebx
+  801cd5:	83 c4 10             	add    $0x10,%esp
+  801cd8:	85 c0                	test   %eax,%eax
+  801cda:	0f 88 db 00 00 00    	js     801dbb <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801ce0:	83 ec 04             	sub    $0x4,%esp
+  801ce3:	68 07 04 00 00       	push   $0x407
+  801ce8:	ff 75 f0             	push   -0x10(%ebp)
+  801ceb:	6a 00                	push   $0x0
+  801ced:	e8 a5 ee ff ff       	call   800b97 <sys_page_alloc>
+  801cf2:	89 c3                	mov    %eax,%ebx
+  801cf4:	83 c4 10             	add    $0x10,%esp
+  801cf7:	85 c0                	test   %eax,%eax
+  801cf9:	0f 88 bc 00 00 00    	js     801dbb <pipe+0x131>
+	va = fd2data(fd0);
+  801cff:	83 ec 0c             	sub    $0xc,%esp
+  801d02:	ff 75 f4             	push   -0xc(%ebp)
+  801d05:	e8 70 f1 ff ff       	call   800e7a <fd2data>
+  801d0a:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801d0c:	83 c4 0c             	add    $0xc,%esp
+  801d0f:	68 07 04 00 00       	push   $0x407
+  801d14:	50                   	push   %eax
+  801d15:	6a 00                	push   $0x0
+  801d17:	e8 7b ee ff ff       	call   800b97 <sys_page_alloc>
+  801d1c:	89 c3                	mov    %eax,%ebx
+  801d1e:	83 c4 10             	add    $0x10,%esp
+  801d21:	85 c0                	test   %eax,%eax
+  801d23:	0f 88 82 00 00 00    	js     801dab <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801d29:	83 ec 0c             	sub    $0xc,%esp
+  801d2c:	ff 75 f0             	push   -0x10(%ebp)
+  801d2f:	e8 46 f1 ff ff       	call   800e7a <fd2data>
+  801d34:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801d3b:	50                   	push   %eax
+  801d3c:	6a 00                	push   $0x0
+  801d3e:	56                   	push   %esi
+  801d3f:	6a 00                	push   $0x0
+  801d41:	e8 94 ee ff ff       	call   800bda <sys_page_map>
+  801d46:	89 c3                	mov    %eax,%ebx
+  801d48:	83 c4 20             	add    $0x20,%esp
+  801d4b:	85 c0                	test   %eax,%eax
+  801d4d:	78 4e                	js     801d9d <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  801d4f:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  801d54:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801d57:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  801d59:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801d5c:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  801d63:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801d66:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  801d68:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801d6b:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  801d72:	83 ec 0c             	sub    $0xc,%esp
+  801d75:	ff 75 f4             	push   -0xc(%ebp)
+  801d78:	e8 ed f0 ff ff       	call   800e6a <fd2num>
+  801d7d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801d80:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  801d82:	83 c4 04             	add    $0x4,%esp
+  801d85:	ff 75 f0             	push   -0x10(%ebp)
+  801d88:	e8 dd f0 ff ff       	call   800e6a <fd2num>
+  801d8d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801d90:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  801d93:	83 c4 10             	add    $0x10,%esp
+  801d96:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d9b:	eb 2e                	jmp    801dcb <pipe+0x141>
+	sys_page_unmap(0, va);
+  801d9d:	83 ec 08             	sub    $0x8,%esp
+  801da0:	56                   	push   %esi
+  801da1:	6a 00                	push   $0x0
+  801da3:	e8 74 ee ff ff       	call   800c1c <sys_page_unmap>
+  801da8:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  801dab:	83 ec 08             	sub    $0x8,%esp
+  801dae:	ff 75 f0             	push   -0x10(%ebp)
+  801db1:	6a 00                	push   $0x0
+  801db3:	e8 64 ee ff ff       	call   800c1c <sys_page_unmap>
+  801db8:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  801dbb:	83 ec 08             	sub    $0x8,%esp
+  801dbe:	ff 75 f4             	push   -0xc(%ebp)
+  801dc1:	6a 00                	push   $0x0
+  801dc3:	e8 54 ee ff ff       	call   800c1c <sys_page_unmap>
+  801dc8:	83 c4 10             	add    $0x10,%esp
+}
+  801dcb:	89 d8                	mov    %ebx,%eax
+  801dcd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dd0:	5b                   	pop    %ebx
+  801dd1:	5e                   	pop    %esi
+  801dd2:	5d                   	pop    %ebp
+  801dd3:	c3                   	ret
+
+00801dd4 <pipeisclosed>:
+{
+  801dd4:	55                   	push   %ebp
+  801dd5:	89 e5                	mov    %esp,%ebp
+  801dd7:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801dda:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ddd:	50                   	push   %eax
+  801dde:	ff 75 08             	push   0x8(%ebp)
+  801de1:	e8 01 f1 ff ff       	call   800ee7 <fd_lookup>
+  801de6:	83 c4 10             	add    $0x10,%esp
+  801de9:	85 c0                	test   %eax,%eax
+  801deb:	78 18                	js     801e05 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  801ded:	83 ec 0c             	sub    $0xc,%esp
+  801df0:	ff 75 f4             	push   -0xc(%ebp)
+  801df3:	e8 82 f0 ff ff       	call   800e7a <fd2data>
+  801df8:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  801dfa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dfd:	e8 33 fd ff ff       	call   801b35 <_pipeisclosed>
+  801e02:	83 c4 10             	add    $0x10,%esp
+}
+  801e05:	c9                   	leave
+  801e06:	c3                   	ret
+
+00801e07 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  801e07:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e0c:	c3                   	ret
+
+00801e0d <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  801e0d:	55                   	push   %ebp
+  801e0e:	89 e5                	mov    %esp,%ebp
+  801e10:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  801e13:	68 6b 2a 80 00       	push   $0x802a6b
+  801e18:	ff 75 0c             	push   0xc(%ebp)
+  801e1b:	e8 8b e9 ff ff       	call   8007ab <strcpy>
+	return 0;
+}
+  801e20:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e25:	c9                   	leave
+  801e26:	c3                   	ret
+
+00801e27 <devcons_write>:
+{
+  801e27:	55                   	push   %ebp
+  801e28:	89 e5                	mov    %esp,%ebp
+  801e2a:	57                   	push   %edi
+  801e2b:	56                   	push   %esi
+  801e2c:	53                   	push   %ebx
+  801e2d:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  801e33:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  801e38:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  801e3e:	eb 2e                	jmp    801e6e <devcons_write+0x47>
+		m = n - tot;
+  801e40:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801e43:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  801e45:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801e4a:	39 c3                	cmp    %eax,%ebx
+  801e4c:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  801e4f:	83 ec 04             	sub    $0x4,%esp
+  801e52:	53                   	push   %ebx
+  801e53:	89 f0                	mov    %esi,%eax
+  801e55:	03 45 0c             	add    0xc(%ebp),%eax
+  801e58:	50                   	push   %eax
+  801e59:	57                   	push   %edi
+  801e5a:	e8 d2 ea ff ff       	call   800931 <memmove>
+		sys_cputs(buf, m);
+  801e5f:	83 c4 08             	add    $0x8,%esp
+  801e62:	53                   	push   %ebx
+  801e63:	57                   	push   %edi
+  801e64:	e8 72 ec ff ff       	call   800adb <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  801e69:	01 de                	add    %ebx,%esi
+  801e6b:	83 c4 10             	add    $0x10,%esp
+  801e6e:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801e71:	72 cd                	jb     801e40 <devcons_write+0x19>
+}
+  801e73:	89 f0                	mov    %esi,%eax
+  801e75:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e78:	5b                   	pop    %ebx
+  801e79:	5e                   	pop    %esi
+  801e7a:	5f                   	pop    %edi
+  801e7b:	5d                   	pop    %ebp
+  801e7c:	c3                   	ret
+
+00801e7d <devcons_read>:
+{
+  801e7d:	55                   	push   %ebp
+  801e7e:	89 e5                	mov    %esp,%ebp
+  801e80:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  801e83:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e88:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801e8c:	75 07                	jne    801e95 <devcons_read+0x18>
+  801e8e:	eb 1f                	jmp    801eaf <devcons_read+0x32>
+		sys_yield();
+  801e90:	e8 e3 ec ff ff       	call   800b78 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  801e95:	e8 5f ec ff ff       	call   800af9 <sys_cgetc>
+  801e9a:	85 c0                	test   %eax,%eax
+  801e9c:	74 f2                	je     801e90 <devcons_read+0x13>
+	if (c < 0)
+  801e9e:	78 0f                	js     801eaf <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  801ea0:	83 f8 04             	cmp    $0x4,%eax
+  801ea3:	74 0c                	je     801eb1 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  801ea5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ea8:	88 02                	mov    %al,(%edx)
+	return 1;
+  801eaa:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  801eaf:	c9                   	leave
+  801eb0:	c3                   	ret
+		return 0;
+  801eb1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eb6:	eb f7                	jmp    801eaf <devcons_read+0x32>
+
+00801eb8 <cputchar>:
+{
+  801eb8:	55                   	push   %ebp
+  801eb9:	89 e5                	mov    %esp,%ebp
+  801ebb:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  801ebe:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ec1:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  801ec4:	6a 01                	push   $0x1
+  801ec6:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801ec9:	50                   	push   %eax
+  801eca:	e8 0c ec ff ff       	call   800adb <sys_cputs>
+}
+  801ecf:	83 c4 10             	add    $0x10,%esp
+  801ed2:	c9                   	leave
+  801ed3:	c3                   	ret
+
+00801ed4 <getchar>:
+{
+  801ed4:	55                   	push   %ebp
+  801ed5:	89 e5                	mov    %esp,%ebp
+  801ed7:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  801eda:	6a 01                	push   $0x1
+  801edc:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801edf:	50                   	push   %eax
+  801ee0:	6a 00                	push   $0x0
+  801ee2:	e8 66 f2 ff ff       	call   80114d <read>
+	if (r < 0)
+  801ee7:	83 c4 10             	add    $0x10,%esp
+  801eea:	85 c0                	test   %eax,%eax
+  801eec:	78 06                	js     801ef4 <getchar+0x20>
+	if (r < 1)
+  801eee:	74 06                	je     801ef6 <getchar+0x22>
+	return c;
+  801ef0:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  801ef4:	c9                   	leave
+  801ef5:	c3                   	ret
+		return -E_EOF;
+  801ef6:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  801efb:	eb f7                	jmp    801ef4 <getchar+0x20>
+
+00801efd <iscons>:
+{
+  801efd:	55                   	push   %ebp
+  801efe:	89 e5                	mov    %esp,%ebp
+  801f00:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801f03:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f06:	50                   	push   %eax
+  801f07:	ff 75 08             	push   0x8(%ebp)
+  801f0a:	e8 d8 ef ff ff       	call   800ee7 <fd_lookup>
+  801f0f:	83 c4 10             	add    $0x10,%esp
+  801f12:	85 c0                	test   %eax,%eax
+  801f14:	78 11                	js     801f27 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  801f16:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f19:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  801f1f:	39 10                	cmp    %edx,(%eax)
+  801f21:	0f 94 c0             	sete   %al
+  801f24:	0f b6 c0             	movzbl %al,%eax
+}
+  801f27:	c9                   	leave
+  801f28:	c3                   	ret
+
+00801f29 <opencons>:
+{
+  801f29:	55                   	push   %ebp
+  801f2a:	89 e5                	mov    %esp,%ebp
+  801f2c:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  801f2f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f32:	50                   	push   %eax
+  801f33:	e8 59 ef ff ff       	call   800e91 <fd_alloc>
+  801f38:	83 c4 10             	add    $0x10,%esp
+  801f3b:	85 c0                	test   %eax,%eax
+  801f3d:	78 3a                	js     801f79 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  801f3f:	83 ec 04             	sub    $0x4,%esp
+  801f42:	68 07 04 00 00       	push   $0x407
+  801f47:	ff 75 f4             	push   -0xc(%ebp)
+  801f4a:	6a 00                	push   $0x0
+  801f4c:	e8 46 ec ff ff       	call   800b97 <sys_page_alloc>
+  801f51:	83 c4 10             	add    $0x10,%esp
+  801f54:	85 c0                	test   %eax,%eax
+  801f56:	78 21                	js     801f79 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  801f58:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f5b:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  801f61:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  801f63:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f66:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  801f6d:	83 ec 0c             	sub    $0xc,%esp
+  801f70:	50                   	push   %eax
+  801f71:	e8 f4 ee ff ff       	call   800e6a <fd2num>
+  801f76:	83 c4 10             	add    $0x10,%esp
+}
+  801f79:	c9                   	leave
+  801f7a:	c3                   	ret
+
+00801f7b <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  801f7b:	55                   	push   %ebp
+  801f7c:	89 e5                	mov    %esp,%ebp
+  801f7e:	56                   	push   %esi
+  801f7f:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  801f80:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  801f83:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  801f89:	e8 cb eb ff ff       	call   800b59 <sys_getenvid>
+  801f8e:	83 ec 0c             	sub    $0xc,%esp
+  801f91:	ff 75 0c             	push   0xc(%ebp)
+  801f94:	ff 75 08             	push   0x8(%ebp)
+  801f97:	56                   	push   %esi
+  801f98:	50                   	push   %eax
+  801f99:	68 78 2a 80 00       	push   $0x802a78
+  801f9e:	e8 4f e2 ff ff       	call   8001f2 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  801fa3:	83 c4 18             	add    $0x18,%esp
+  801fa6:	53                   	push   %ebx
+  801fa7:	ff 75 10             	push   0x10(%ebp)
+  801faa:	e8 f2 e1 ff ff       	call   8001a1 <vcprintf>
+	cprintf("\n");
+  801faf:	c7 04 24 64 2a 80 00 	movl   $0x802a64,(%esp)
+  801fb6:	e8 37 e2 ff ff       	call   8001f2 <cprintf>
+  801fbb:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  801fbe:	cc                   	int3
+	while (1)
+  801fbf:	eb fd                	jmp    801fbe <_panic+0x43>
+
+00801fc1 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  801fc1:	55                   	push   %ebp
+  801fc2:	89 e5                	mov    %esp,%ebp
+  801fc4:	56                   	push   %esi
+  801fc5:	53                   	push   %ebx
+  801fc6:	8b 75 08             	mov    0x8(%ebp),%esi
+  801fc9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fcc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  801fcf:	85 c0                	test   %eax,%eax
+  801fd1:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801fd6:	0f 44 c2             	cmove  %edx,%eax
+  801fd9:	83 ec 0c             	sub    $0xc,%esp
+  801fdc:	50                   	push   %eax
+  801fdd:	e8 65 ed ff ff       	call   800d47 <sys_ipc_recv>
+
+  if (from_env_store)
+  801fe2:	83 c4 10             	add    $0x10,%esp
+  801fe5:	85 f6                	test   %esi,%esi
+  801fe7:	74 17                	je     802000 <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  801fe9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fee:	85 c0                	test   %eax,%eax
+  801ff0:	75 0c                	jne    801ffe <ipc_recv+0x3d>
+  801ff2:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801ff8:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  801ffe:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  802000:	85 db                	test   %ebx,%ebx
+  802002:	74 2b                	je     80202f <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  802004:	85 c0                	test   %eax,%eax
+  802006:	74 0d                	je     802015 <ipc_recv+0x54>
+  802008:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  80200e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802011:	5b                   	pop    %ebx
+  802012:	5e                   	pop    %esi
+  802013:	5d                   	pop    %ebp
+  802014:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  802015:	a1 08 40 80 00       	mov    0x804008,%eax
+  80201a:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  802020:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  802022:	a1 08 40 80 00       	mov    0x804008,%eax
+  802027:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  80202d:	eb df                	jmp    80200e <ipc_recv+0x4d>
+  80202f:	85 c0                	test   %eax,%eax
+  802031:	75 db                	jne    80200e <ipc_recv+0x4d>
+  802033:	eb ed                	jmp    802022 <ipc_recv+0x61>
+
+00802035 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  802035:	55                   	push   %ebp
+  802036:	89 e5                	mov    %esp,%ebp
+  802038:	57                   	push   %edi
+  802039:	56                   	push   %esi
+  80203a:	53                   	push   %ebx
+  80203b:	83 ec 0c             	sub    $0xc,%esp
+  80203e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802041:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802044:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  802047:	85 db                	test   %ebx,%ebx
+  802049:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80204e:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  802051:	ff 75 14             	push   0x14(%ebp)
+  802054:	53                   	push   %ebx
+  802055:	56                   	push   %esi
+  802056:	57                   	push   %edi
+  802057:	e8 c8 ec ff ff       	call   800d24 <sys_ipc_try_send>
+  80205c:	83 c4 10             	add    $0x10,%esp
+  80205f:	85 c0                	test   %eax,%eax
+  802061:	74 1e                	je     802081 <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  802063:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802066:	75 07                	jne    80206f <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  802068:	e8 0b eb ff ff       	call   800b78 <sys_yield>
+  80206d:	eb e2                	jmp    802051 <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  80206f:	50                   	push   %eax
+  802070:	68 9b 2a 80 00       	push   $0x802a9b
+  802075:	6a 3c                	push   $0x3c
+  802077:	68 a8 2a 80 00       	push   $0x802aa8
+  80207c:	e8 fa fe ff ff       	call   801f7b <_panic>
+  }
+
+#endif
+}
+  802081:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802084:	5b                   	pop    %ebx
+  802085:	5e                   	pop    %esi
+  802086:	5f                   	pop    %edi
+  802087:	5d                   	pop    %ebp
+  802088:	c3                   	ret
+
+00802089 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  802089:	55                   	push   %ebp
+  80208a:	89 e5                	mov    %esp,%ebp
+  80208c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  80208f:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  802094:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802097:	c1 e0 04             	shl    $0x4,%eax
+  80209a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80209f:	8b 40 50             	mov    0x50(%eax),%eax
+  8020a2:	39 c8                	cmp    %ecx,%eax
+  8020a4:	74 12                	je     8020b8 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  8020a6:	83 c2 01             	add    $0x1,%edx
+  8020a9:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8020af:	75 e3                	jne    802094 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  8020b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020b6:	eb 0e                	jmp    8020c6 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  8020b8:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8020bb:	c1 e0 04             	shl    $0x4,%eax
+  8020be:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8020c3:	8b 40 48             	mov    0x48(%eax),%eax
+  8020c6:	5d                   	pop    %ebp
+  8020c7:	c3                   	ret
+
+008020c8 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8020c8:	55                   	push   %ebp
+  8020c9:	89 e5                	mov    %esp,%ebp
+  8020cb:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8020ce:	89 c2                	mov    %eax,%edx
+  8020d0:	c1 ea 16             	shr    $0x16,%edx
+  8020d3:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8020da:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8020df:	f6 c1 01             	test   $0x1,%cl
+  8020e2:	74 1c                	je     802100 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  8020e4:	c1 e8 0c             	shr    $0xc,%eax
+  8020e7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8020ee:	a8 01                	test   $0x1,%al
+  8020f0:	74 0e                	je     802100 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8020f2:	c1 e8 0c             	shr    $0xc,%eax
+  8020f5:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  8020fc:	ef 
+  8020fd:	0f b7 d2             	movzwl %dx,%edx
+}
+  802100:	89 d0                	mov    %edx,%eax
+  802102:	5d                   	pop    %ebp
+  802103:	c3                   	ret
+  802104:	66 90                	xchg   %ax,%ax
+  802106:	66 90                	xchg   %ax,%ax
+  802108:	66 90                	xchg   %ax,%ax
+  80210a:	66 90                	xchg   %ax,%ax
+  80210c:	66 90                	xchg   %ax,%ax
+  80210e:	66 90                	xchg   %ax,%ax
+
+00802110 <__udivmoddi4>:
+  802110:	55                   	push   %ebp
+  802111:	57                   	push   %edi
+  802112:	56                   	push   %esi
+  802113:	53                   	push   %ebx
+  802114:	83 ec 24             	sub    $0x24,%esp
+  802117:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80211b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80211f:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  802123:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802127:	8b 54 24 44          	mov    0x44(%esp),%edx
+  80212b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80212f:	8b 44 24 40          	mov    0x40(%esp),%eax
+  802133:	89 d3                	mov    %edx,%ebx
+  802135:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802139:	09 c3                	or     %eax,%ebx
+  80213b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80213f:	0f 84 9c 00 00 00    	je     8021e1 <__udivmoddi4+0xd1>
+  802145:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80214c:	00 
+  80214d:	31 c0                	xor    %eax,%eax
+  80214f:	31 d2                	xor    %edx,%edx
+  802151:	89 fb                	mov    %edi,%ebx
+  802153:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80215a:	00 
+  80215b:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802160:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802164:	01 c0                	add    %eax,%eax
+  802166:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80216d:	00 
+  80216e:	89 c6                	mov    %eax,%esi
+  802170:	89 d7                	mov    %edx,%edi
+  802172:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802176:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80217a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80217d:	d3 ea                	shr    %cl,%edx
+  80217f:	f6 c1 20             	test   $0x20,%cl
+  802182:	0f 45 c2             	cmovne %edx,%eax
+  802185:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802189:	83 e0 01             	and    $0x1,%eax
+  80218c:	09 fa                	or     %edi,%edx
+  80218e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802192:	89 04 24             	mov    %eax,(%esp)
+  802195:	8b 04 24             	mov    (%esp),%eax
+  802198:	89 d5                	mov    %edx,%ebp
+  80219a:	09 f0                	or     %esi,%eax
+  80219c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8021a0:	39 f0                	cmp    %esi,%eax
+  8021a2:	19 fd                	sbb    %edi,%ebp
+  8021a4:	72 1d                	jb     8021c3 <__udivmoddi4+0xb3>
+  8021a6:	29 f0                	sub    %esi,%eax
+  8021a8:	19 fa                	sbb    %edi,%edx
+  8021aa:	89 cf                	mov    %ecx,%edi
+  8021ac:	c1 ef 05             	shr    $0x5,%edi
+  8021af:	83 e7 01             	and    $0x1,%edi
+  8021b2:	89 fe                	mov    %edi,%esi
+  8021b4:	d3 e7                	shl    %cl,%edi
+  8021b6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8021ba:	83 f6 01             	xor    $0x1,%esi
+  8021bd:	d3 e6                	shl    %cl,%esi
+  8021bf:	09 74 24 18          	or     %esi,0x18(%esp)
+  8021c3:	83 e9 01             	sub    $0x1,%ecx
+  8021c6:	73 98                	jae    802160 <__udivmoddi4+0x50>
+  8021c8:	85 db                	test   %ebx,%ebx
+  8021ca:	74 05                	je     8021d1 <__udivmoddi4+0xc1>
+  8021cc:	89 03                	mov    %eax,(%ebx)
+  8021ce:	89 53 04             	mov    %edx,0x4(%ebx)
+  8021d1:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8021d5:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8021d9:	83 c4 24             	add    $0x24,%esp
+  8021dc:	5b                   	pop    %ebx
+  8021dd:	5e                   	pop    %esi
+  8021de:	5f                   	pop    %edi
+  8021df:	5d                   	pop    %ebp
+  8021e0:	c3                   	ret
+  8021e1:	85 ff                	test   %edi,%edi
+  8021e3:	74 0d                	je     8021f2 <__udivmoddi4+0xe2>
+  8021e5:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  8021eb:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  8021f2:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8021f6:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8021fa:	89 44 24 18          	mov    %eax,0x18(%esp)
+  8021fe:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802202:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802206:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80220a:	83 c4 24             	add    $0x24,%esp
+  80220d:	5b                   	pop    %ebx
+  80220e:	5e                   	pop    %esi
+  80220f:	5f                   	pop    %edi
+  802210:	5d                   	pop    %ebp
+  802211:	c3                   	ret
+  802212:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802219:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00802220 <__udivdi3>:
+  802220:	57                   	push   %edi
+  802221:	56                   	push   %esi
+  802222:	53                   	push   %ebx
+  802223:	83 ec 20             	sub    $0x20,%esp
+  802226:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80222a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80222e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802232:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802236:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80223a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80223e:	89 d1                	mov    %edx,%ecx
+  802240:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802244:	09 c1                	or     %eax,%ecx
+  802246:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80224a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80224e:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802252:	0f 84 88 00 00 00    	je     8022e0 <__udivdi3+0xc0>
+  802258:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80225f:	00 
+  802260:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802265:	31 c0                	xor    %eax,%eax
+  802267:	31 d2                	xor    %edx,%edx
+  802269:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802270:	00 
+  802271:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802278:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80227c:	01 c0                	add    %eax,%eax
+  80227e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802285:	00 
+  802286:	89 c6                	mov    %eax,%esi
+  802288:	89 d7                	mov    %edx,%edi
+  80228a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80228e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802292:	0f ad d0             	shrd   %cl,%edx,%eax
+  802295:	d3 ea                	shr    %cl,%edx
+  802297:	f6 c1 20             	test   $0x20,%cl
+  80229a:	0f 45 c2             	cmovne %edx,%eax
+  80229d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8022a1:	83 e0 01             	and    $0x1,%eax
+  8022a4:	09 fa                	or     %edi,%edx
+  8022a6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8022aa:	89 04 24             	mov    %eax,(%esp)
+  8022ad:	8b 04 24             	mov    (%esp),%eax
+  8022b0:	89 d3                	mov    %edx,%ebx
+  8022b2:	09 f0                	or     %esi,%eax
+  8022b4:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8022b8:	39 f0                	cmp    %esi,%eax
+  8022ba:	19 fb                	sbb    %edi,%ebx
+  8022bc:	72 1d                	jb     8022db <__udivdi3+0xbb>
+  8022be:	29 f0                	sub    %esi,%eax
+  8022c0:	19 fa                	sbb    %edi,%edx
+  8022c2:	89 cf                	mov    %ecx,%edi
+  8022c4:	c1 ef 05             	shr    $0x5,%edi
+  8022c7:	83 e7 01             	and    $0x1,%edi
+  8022ca:	89 fe                	mov    %edi,%esi
+  8022cc:	d3 e7                	shl    %cl,%edi
+  8022ce:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8022d2:	83 f6 01             	xor    $0x1,%esi
+  8022d5:	d3 e6                	shl    %cl,%esi
+  8022d7:	09 74 24 18          	or     %esi,0x18(%esp)
+  8022db:	83 e9 01             	sub    $0x1,%ecx
+  8022de:	73 98                	jae    802278 <__udivdi3+0x58>
+  8022e0:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8022e4:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8022e8:	83 c4 20             	add    $0x20,%esp
+  8022eb:	5b                   	pop    %ebx
+  8022ec:	5e                   	pop    %esi
+  8022ed:	5f                   	pop    %edi
+  8022ee:	c3                   	ret
+  8022ef:	90                   	nop
+
+008022f0 <__umoddi3>:
+  8022f0:	57                   	push   %edi
+  8022f1:	56                   	push   %esi
+  8022f2:	53                   	push   %ebx
+  8022f3:	83 ec 18             	sub    $0x18,%esp
+  8022f6:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8022fa:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8022fe:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802302:	8b 54 24 34          	mov    0x34(%esp),%edx
+  802306:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80230a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80230e:	89 d1                	mov    %edx,%ecx
+  802310:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802314:	09 c1                	or     %eax,%ecx
+  802316:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80231a:	74 5b                	je     802377 <__umoddi3+0x87>
+  80231c:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802321:	31 c0                	xor    %eax,%eax
+  802323:	31 d2                	xor    %edx,%edx
+  802325:	8d 76 00             	lea    0x0(%esi),%esi
+  802328:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80232c:	01 c0                	add    %eax,%eax
+  80232e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802335:	00 
+  802336:	89 c6                	mov    %eax,%esi
+  802338:	89 d7                	mov    %edx,%edi
+  80233a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80233e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802342:	0f ad d0             	shrd   %cl,%edx,%eax
+  802345:	d3 ea                	shr    %cl,%edx
+  802347:	f6 c1 20             	test   $0x20,%cl
+  80234a:	0f 45 c2             	cmovne %edx,%eax
+  80234d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802351:	83 e0 01             	and    $0x1,%eax
+  802354:	09 fa                	or     %edi,%edx
+  802356:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80235a:	89 04 24             	mov    %eax,(%esp)
+  80235d:	8b 04 24             	mov    (%esp),%eax
+  802360:	89 d3                	mov    %edx,%ebx
+  802362:	09 f0                	or     %esi,%eax
+  802364:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802368:	39 f0                	cmp    %esi,%eax
+  80236a:	19 fb                	sbb    %edi,%ebx
+  80236c:	72 04                	jb     802372 <__umoddi3+0x82>
+  80236e:	29 f0                	sub    %esi,%eax
+  802370:	19 fa                	sbb    %edi,%edx
+  802372:	83 e9 01             	sub    $0x1,%ecx
+  802375:	73 b1                	jae    802328 <__umoddi3+0x38>
+  802377:	83 c4 18             	add    $0x18,%esp
+  80237a:	5b                   	pop    %ebx
+  80237b:	5e                   	pop    %esi
+  80237c:	5f                   	pop    %edi
+  80237d:	c3                   	ret
+  80237e:	66 90                	xchg   %ax,%ax
+
+00802380 <__divdi3>:
+  802380:	55                   	push   %ebp
+  802381:	57                   	push   %edi
+  802382:	56                   	push   %esi
+  802383:	53                   	push   %ebx
+  802384:	83 ec 24             	sub    $0x24,%esp
+  802387:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  80238b:	8b 74 24 44          	mov    0x44(%esp),%esi
+  80238f:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802393:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802397:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  80239b:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  80239f:	85 d2                	test   %edx,%edx
+  8023a1:	0f 88 e0 00 00 00    	js     802487 <__divdi3+0x107>
+  8023a7:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  8023ab:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  8023af:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8023b3:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8023b7:	85 f6                	test   %esi,%esi
+  8023b9:	78 16                	js     8023d1 <__divdi3+0x51>
+  8023bb:	89 f1                	mov    %esi,%ecx
+  8023bd:	31 c0                	xor    %eax,%eax
+  8023bf:	31 d2                	xor    %edx,%edx
+  8023c1:	09 d9                	or     %ebx,%ecx
+  8023c3:	0f 85 f3 00 00 00    	jne    8024bc <__divdi3+0x13c>
+  8023c9:	83 c4 24             	add    $0x24,%esp
+  8023cc:	5b                   	pop    %ebx
+  8023cd:	5e                   	pop    %esi
+  8023ce:	5f                   	pop    %edi
+  8023cf:	5d                   	pop    %ebp
+  8023d0:	c3                   	ret
+  8023d1:	bf 01 00 00 00       	mov    $0x1,%edi
+  8023d6:	f7 5c 24 08          	negl   0x8(%esp)
+  8023da:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  8023df:	f7 5c 24 0c          	negl   0xc(%esp)
+  8023e3:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8023ea:	00 
+  8023eb:	31 c0                	xor    %eax,%eax
+  8023ed:	31 d2                	xor    %edx,%edx
+  8023ef:	89 fb                	mov    %edi,%ebx
+  8023f1:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8023f8:	00 
+  8023f9:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8023fe:	66 90                	xchg   %ax,%ax
+  802400:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802404:	01 c0                	add    %eax,%eax
+  802406:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80240d:	00 
+  80240e:	89 c6                	mov    %eax,%esi
+  802410:	89 d7                	mov    %edx,%edi
+  802412:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802416:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80241a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80241d:	d3 ea                	shr    %cl,%edx
+  80241f:	f6 c1 20             	test   $0x20,%cl
+  802422:	0f 45 c2             	cmovne %edx,%eax
+  802425:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802429:	83 e0 01             	and    $0x1,%eax
+  80242c:	09 fa                	or     %edi,%edx
+  80242e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802432:	89 04 24             	mov    %eax,(%esp)
+  802435:	8b 04 24             	mov    (%esp),%eax
+  802438:	89 d5                	mov    %edx,%ebp
+  80243a:	09 f0                	or     %esi,%eax
+  80243c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802440:	39 f0                	cmp    %esi,%eax
+  802442:	19 fd                	sbb    %edi,%ebp
+  802444:	72 1d                	jb     802463 <__divdi3+0xe3>
+  802446:	29 f0                	sub    %esi,%eax
+  802448:	19 fa                	sbb    %edi,%edx
+  80244a:	89 cf                	mov    %ecx,%edi
+  80244c:	c1 ef 05             	shr    $0x5,%edi
+  80244f:	83 e7 01             	and    $0x1,%edi
+  802452:	89 fe                	mov    %edi,%esi
+  802454:	d3 e7                	shl    %cl,%edi
+  802456:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80245a:	83 f6 01             	xor    $0x1,%esi
+  80245d:	d3 e6                	shl    %cl,%esi
+  80245f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802463:	83 e9 01             	sub    $0x1,%ecx
+  802466:	73 98                	jae    802400 <__divdi3+0x80>
+  802468:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80246c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802470:	85 db                	test   %ebx,%ebx
+  802472:	0f 84 51 ff ff ff    	je     8023c9 <__divdi3+0x49>
+  802478:	f7 d8                	neg    %eax
+  80247a:	83 d2 00             	adc    $0x0,%edx
+  80247d:	83 c4 24             	add    $0x24,%esp
+  802480:	5b                   	pop    %ebx
+  802481:	f7 da                	neg    %edx
+  802483:	5e                   	pop    %esi
+  802484:	5f                   	pop    %edi
+  802485:	5d                   	pop    %ebp
+  802486:	c3                   	ret
+  802487:	f7 d8                	neg    %eax
+  802489:	83 d2 00             	adc    $0x0,%edx
+  80248c:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802490:	f7 da                	neg    %edx
+  802492:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802496:	85 f6                	test   %esi,%esi
+  802498:	78 1b                	js     8024b5 <__divdi3+0x135>
+  80249a:	89 f1                	mov    %esi,%ecx
+  80249c:	31 c0                	xor    %eax,%eax
+  80249e:	31 d2                	xor    %edx,%edx
+  8024a0:	bf 01 00 00 00       	mov    $0x1,%edi
+  8024a5:	09 d9                	or     %ebx,%ecx
+  8024a7:	0f 85 36 ff ff ff    	jne    8023e3 <__divdi3+0x63>
+  8024ad:	83 c4 24             	add    $0x24,%esp
+  8024b0:	5b                   	pop    %ebx
+  8024b1:	5e                   	pop    %esi
+  8024b2:	5f                   	pop    %edi
+  8024b3:	5d                   	pop    %ebp
+  8024b4:	c3                   	ret
+  8024b5:	31 ff                	xor    %edi,%edi
+  8024b7:	e9 1a ff ff ff       	jmp    8023d6 <__divdi3+0x56>
+  8024bc:	31 ff                	xor    %edi,%edi
+  8024be:	e9 20 ff ff ff       	jmp    8023e3 <__divdi3+0x63>
+  8024c3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8024ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+008024d0 <__moddi3>:
+  8024d0:	55                   	push   %ebp
+  8024d1:	57                   	push   %edi
+  8024d2:	56                   	push   %esi
+  8024d3:	53                   	push   %ebx
+  8024d4:	83 ec 1c             	sub    $0x1c,%esp
+  8024d7:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  8024db:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  8024df:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  8024e3:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  8024e7:	89 c8                	mov    %ecx,%eax
+  8024e9:	89 f2                	mov    %esi,%edx
+  8024eb:	89 f3                	mov    %esi,%ebx
+  8024ed:	85 ed                	test   %ebp,%ebp
+  8024ef:	0f 88 9d 00 00 00    	js     802592 <__moddi3+0xc2>
+  8024f5:	09 cb                	or     %ecx,%ebx
+  8024f7:	0f 84 8d 00 00 00    	je     80258a <__moddi3+0xba>
+  8024fd:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802501:	31 db                	xor    %ebx,%ebx
+  802503:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802507:	89 ca                	mov    %ecx,%edx
+  802509:	89 f0                	mov    %esi,%eax
+  80250b:	89 dd                	mov    %ebx,%ebp
+  80250d:	f7 da                	neg    %edx
+  80250f:	83 d0 00             	adc    $0x0,%eax
+  802512:	f7 d8                	neg    %eax
+  802514:	0f 49 f0             	cmovns %eax,%esi
+  802517:	0f 49 ca             	cmovns %edx,%ecx
+  80251a:	31 c0                	xor    %eax,%eax
+  80251c:	31 d2                	xor    %edx,%edx
+  80251e:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802522:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802526:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80252b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80252f:	90                   	nop
+  802530:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802534:	01 c0                	add    %eax,%eax
+  802536:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80253d:	00 
+  80253e:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  802542:	89 c6                	mov    %eax,%esi
+  802544:	89 d7                	mov    %edx,%edi
+  802546:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80254a:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80254e:	0f ad d0             	shrd   %cl,%edx,%eax
+  802551:	d3 ea                	shr    %cl,%edx
+  802553:	f6 c1 20             	test   $0x20,%cl
+  802556:	0f 45 c2             	cmovne %edx,%eax
+  802559:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80255d:	83 e0 01             	and    $0x1,%eax
+  802560:	09 fa                	or     %edi,%edx
+  802562:	89 04 24             	mov    %eax,(%esp)
+  802565:	8b 04 24             	mov    (%esp),%eax
+  802568:	89 d7                	mov    %edx,%edi
+  80256a:	09 f0                	or     %esi,%eax
+  80256c:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  802570:	39 d8                	cmp    %ebx,%eax
+  802572:	19 f7                	sbb    %esi,%edi
+  802574:	72 04                	jb     80257a <__moddi3+0xaa>
+  802576:	29 d8                	sub    %ebx,%eax
+  802578:	19 f2                	sbb    %esi,%edx
+  80257a:	83 e9 01             	sub    $0x1,%ecx
+  80257d:	73 b1                	jae    802530 <__moddi3+0x60>
+  80257f:	85 ed                	test   %ebp,%ebp
+  802581:	74 07                	je     80258a <__moddi3+0xba>
+  802583:	f7 d8                	neg    %eax
+  802585:	83 d2 00             	adc    $0x0,%edx
+  802588:	f7 da                	neg    %edx
+  80258a:	83 c4 1c             	add    $0x1c,%esp
+  80258d:	5b                   	pop    %ebx
+  80258e:	5e                   	pop    %esi
+  80258f:	5f                   	pop    %edi
+  802590:	5d                   	pop    %ebp
+  802591:	c3                   	ret
+  802592:	09 cb                	or     %ecx,%ebx
+  802594:	74 f4                	je     80258a <__moddi3+0xba>
+  802596:	f7 df                	neg    %edi
+  802598:	bb 01 00 00 00       	mov    $0x1,%ebx
+  80259d:	83 d5 00             	adc    $0x0,%ebp
+  8025a0:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  8025a4:	f7 dd                	neg    %ebp
+  8025a6:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  8025aa:	e9 58 ff ff ff       	jmp    802507 <__moddi3+0x37>
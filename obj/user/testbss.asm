@@ -0,0 +1,5312 @@
+
+obj/user/testbss.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 ab 00 00 00       	call   8000dc <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+uint32_t bigarray[ARRAYSIZE];
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 14             	sub    $0x14,%esp
+	int i;
+
+	cprintf("Making sure bss works right...\n");
+  800039:	68 a0 25 80 00       	push   $0x8025a0
+  80003e:	e8 d7 01 00 00       	call   80021a <cprintf>
+  800043:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < ARRAYSIZE; i++)
+  800046:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (bigarray[i] != 0)
+  80004b:	83 3c 85 20 40 80 00 	cmpl   $0x0,0x804020(,%eax,4)
+  800052:	00 
+  800053:	75 63                	jne    8000b8 <umain+0x85>
+	for (i = 0; i < ARRAYSIZE; i++)
+  800055:	83 c0 01             	add    $0x1,%eax
+  800058:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80005d:	75 ec                	jne    80004b <umain+0x18>
+			panic("bigarray[%d] isn't cleared!\n", i);
+	for (i = 0; i < ARRAYSIZE; i++)
+  80005f:	b8 00 00 00 00       	mov    $0x0,%eax
+		bigarray[i] = i;
+  800064:	89 04 85 20 40 80 00 	mov    %eax,0x804020(,%eax,4)
+	for (i = 0; i < ARRAYSIZE; i++)
+  80006b:	83 c0 01             	add    $0x1,%eax
+  80006e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800073:	75 ef                	jne    800064 <umain+0x31>
+	for (i = 0; i < ARRAYSIZE; i++)
+  800075:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (bigarray[i] != i)
+  80007a:	39 04 85 20 40 80 00 	cmp    %eax,0x804020(,%eax,4)
+  800081:	75 47                	jne    8000ca <umain+0x97>
+	for (i = 0; i < ARRAYSIZE; i++)
+  800083:	83 c0 01             	add    $0x1,%eax
+  800086:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80008b:	75 ed                	jne    80007a <umain+0x47>
+			panic("bigarray[%d] didn't hold its value!\n", i);
+
+	cprintf("Yes, good.  Now doing a wild write off the end...\n");
+  80008d:	83 ec 0c             	sub    $0xc,%esp
+  800090:	68 e8 25 80 00       	push   $0x8025e8
+  800095:	e8 80 01 00 00       	call   80021a <cprintf>
+	bigarray[ARRAYSIZE+1024] = 0;
+  80009a:	c7 05 20 50 c0 00 00 	movl   $0x0,0xc05020
+  8000a1:	00 00 00 
+	panic("SHOULD HAVE TRAPPED!!!");
+  8000a4:	83 c4 0c             	add    $0xc,%esp
+  8000a7:	68 47 26 80 00       	push   $0x802647
+  8000ac:	6a 1a                	push   $0x1a
+  8000ae:	68 38 26 80 00       	push   $0x802638
+  8000b3:	e8 87 00 00 00       	call   80013f <_panic>
+			panic("bigarray[%d] isn't cleared!\n", i);
+  8000b8:	50                   	push   %eax
+  8000b9:	68 1b 26 80 00       	push   $0x80261b
+  8000be:	6a 11                	push   $0x11
+  8000c0:	68 38 26 80 00       	push   $0x802638
+  8000c5:	e8 75 00 00 00       	call   80013f <_panic>
+			panic("bigarray[%d] didn't hold its value!\n", i);
+  8000ca:	50                   	push   %eax
+  8000cb:	68 c0 25 80 00       	push   $0x8025c0
+  8000d0:	6a 16                	push   $0x16
+  8000d2:	68 38 26 80 00       	push   $0x802638
+  8000d7:	e8 63 00 00 00       	call   80013f <_panic>
+
+008000dc <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  8000dc:	55                   	push   %ebp
+  8000dd:	89 e5                	mov    %esp,%ebp
+  8000df:	56                   	push   %esi
+  8000e0:	53                   	push   %ebx
+  8000e1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000e4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  8000e7:	e8 95 0a 00 00       	call   800b81 <sys_getenvid>
+  8000ec:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000f1:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8000f4:	c1 e0 04             	shl    $0x4,%eax
+  8000f7:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000fc:	a3 20 40 c0 00       	mov    %eax,0xc04020
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800101:	85 db                	test   %ebx,%ebx
+  800103:	7e 07                	jle    80010c <libmain+0x30>
+    binaryname = argv[0];
+  800105:	8b 06                	mov    (%esi),%eax
+  800107:	a3 00 30 80 00       	mov    %eax,0x803000
+
+  // call user main routine
+  umain(argc, argv);
+  80010c:	83 ec 08             	sub    $0x8,%esp
+  80010f:	56                   	push   %esi
+  800110:	53                   	push   %ebx
+  800111:	e8 1d ff ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  800116:	e8 0a 00 00 00       	call   800125 <exit>
+}
+  80011b:	83 c4 10             	add    $0x10,%esp
+  80011e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800121:	5b                   	pop    %ebx
+  800122:	5e                   	pop    %esi
+  800123:	5d                   	pop    %ebp
+  800124:	c3                   	ret
+
+00800125 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800125:	55                   	push   %ebp
+  800126:	89 e5                	mov    %esp,%ebp
+  800128:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80012b:	e8 36 0f 00 00       	call   801066 <close_all>
+	sys_env_destroy(0);
+  800130:	83 ec 0c             	sub    $0xc,%esp
+  800133:	6a 00                	push   $0x0
+  800135:	e8 06 0a 00 00       	call   800b40 <sys_env_destroy>
+}
+  80013a:	83 c4 10             	add    $0x10,%esp
+  80013d:	c9                   	leave
+  80013e:	c3                   	ret
+
+0080013f <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80013f:	55                   	push   %ebp
+  800140:	89 e5                	mov    %esp,%ebp
+  800142:	56                   	push   %esi
+  800143:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800144:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800147:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  80014d:	e8 2f 0a 00 00       	call   800b81 <sys_getenvid>
+  800152:	83 ec 0c             	sub    $0xc,%esp
+  800155:	ff 75 0c             	push   0xc(%ebp)
+  800158:	ff 75 08             	push   0x8(%ebp)
+  80015b:	56                   	push   %esi
+  80015c:	50                   	push   %eax
+  80015d:	68 68 26 80 00       	push   $0x802668
+  800162:	e8 b3 00 00 00       	call   80021a <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800167:	83 c4 18             	add    $0x18,%esp
+  80016a:	53                   	push   %ebx
+  80016b:	ff 75 10             	push   0x10(%ebp)
+  80016e:	e8 56 00 00 00       	call   8001c9 <vcprintf>
+	cprintf("\n");
+  800173:	c7 04 24 36 26 80 00 	movl   $0x802636,(%esp)
+  80017a:	e8 9b 00 00 00       	call   80021a <cprintf>
+  80017f:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800182:	cc                   	int3
+	while (1)
+  800183:	eb fd                	jmp    800182 <_panic+0x43>
+
+00800185 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800185:	55                   	push   %ebp
+  800186:	89 e5                	mov    %esp,%ebp
+  800188:	53                   	push   %ebx
+  800189:	83 ec 04             	sub    $0x4,%esp
+  80018c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80018f:	8b 13                	mov    (%ebx),%edx
+  800191:	8d 42 01             	lea    0x1(%edx),%eax
+  800194:	89 03                	mov    %eax,(%ebx)
+  800196:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800199:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80019d:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001a2:	74 09                	je     8001ad <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001a4:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001ab:	c9                   	leave
+  8001ac:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8001ad:	83 ec 08             	sub    $0x8,%esp
+  8001b0:	68 ff 00 00 00       	push   $0xff
+  8001b5:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001b8:	50                   	push   %eax
+  8001b9:	e8 45 09 00 00       	call   800b03 <sys_cputs>
+		b->idx = 0;
+  8001be:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001c4:	83 c4 10             	add    $0x10,%esp
+  8001c7:	eb db                	jmp    8001a4 <putch+0x1f>
+
+008001c9 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001c9:	55                   	push   %ebp
+  8001ca:	89 e5                	mov    %esp,%ebp
+  8001cc:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001d2:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001d9:	00 00 00 
+	b.cnt = 0;
+  8001dc:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001e3:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001e6:	ff 75 0c             	push   0xc(%ebp)
+  8001e9:	ff 75 08             	push   0x8(%ebp)
+  8001ec:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001f2:	50                   	push   %eax
+  8001f3:	68 85 01 80 00       	push   $0x800185
+  8001f8:	e8 14 01 00 00       	call   800311 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8001fd:	83 c4 08             	add    $0x8,%esp
+  800200:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800206:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80020c:	50                   	push   %eax
+  80020d:	e8 f1 08 00 00       	call   800b03 <sys_cputs>
+
+	return b.cnt;
+}
+  800212:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800218:	c9                   	leave
+  800219:	c3                   	ret
+
+0080021a <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80021a:	55                   	push   %ebp
+  80021b:	89 e5                	mov    %esp,%ebp
+  80021d:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800220:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800223:	50                   	push   %eax
+  800224:	ff 75 08             	push   0x8(%ebp)
+  800227:	e8 9d ff ff ff       	call   8001c9 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80022c:	c9                   	leave
+  80022d:	c3                   	ret
+
+0080022e <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80022e:	55                   	push   %ebp
+  80022f:	89 e5                	mov    %esp,%ebp
+  800231:	57                   	push   %edi
+  800232:	56                   	push   %esi
+  800233:	53                   	push   %ebx
+  800234:	83 ec 1c             	sub    $0x1c,%esp
+  800237:	89 c7                	mov    %eax,%edi
+  800239:	89 d6                	mov    %edx,%esi
+  80023b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80023e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800241:	89 d1                	mov    %edx,%ecx
+  800243:	89 c2                	mov    %eax,%edx
+  800245:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800248:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80024b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80024e:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800251:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800254:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80025b:	39 c2                	cmp    %eax,%edx
+  80025d:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800260:	72 3e                	jb     8002a0 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800262:	83 ec 0c             	sub    $0xc,%esp
+  800265:	ff 75 18             	push   0x18(%ebp)
+  800268:	83 eb 01             	sub    $0x1,%ebx
+  80026b:	53                   	push   %ebx
+  80026c:	50                   	push   %eax
+  80026d:	83 ec 08             	sub    $0x8,%esp
+  800270:	ff 75 e4             	push   -0x1c(%ebp)
+  800273:	ff 75 e0             	push   -0x20(%ebp)
+  800276:	ff 75 dc             	push   -0x24(%ebp)
+  800279:	ff 75 d8             	push   -0x28(%ebp)
+  80027c:	e8 7f 1f 00 00       	call   802200 <__udivdi3>
+  800281:	83 c4 18             	add    $0x18,%esp
+  800284:	52                   	push   %edx
+  800285:	50                   	push   %eax
+  800286:	89 f2                	mov    %esi,%edx
+  800288:	89 f8                	mov    %edi,%eax
+  80028a:	e8 9f ff ff ff       	call   80022e <printnum>
+  80028f:	83 c4 20             	add    $0x20,%esp
+  800292:	eb 13                	jmp    8002a7 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800294:	83 ec 08             	sub    $0x8,%esp
+  800297:	56                   	push   %esi
+  800298:	ff 75 18             	push   0x18(%ebp)
+  80029b:	ff d7                	call   *%edi
+  80029d:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8002a0:	83 eb 01             	sub    $0x1,%ebx
+  8002a3:	85 db                	test   %ebx,%ebx
+  8002a5:	7f ed                	jg     800294 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8002a7:	83 ec 08             	sub    $0x8,%esp
+  8002aa:	56                   	push   %esi
+  8002ab:	83 ec 04             	sub    $0x4,%esp
+  8002ae:	ff 75 e4             	push   -0x1c(%ebp)
+  8002b1:	ff 75 e0             	push   -0x20(%ebp)
+  8002b4:	ff 75 dc             	push   -0x24(%ebp)
+  8002b7:	ff 75 d8             	push   -0x28(%ebp)
+  8002ba:	e8 11 20 00 00       	call   8022d0 <__umoddi3>
+  8002bf:	83 c4 14             	add    $0x14,%esp
+  8002c2:	0f be 80 8b 26 80 00 	movsbl 0x80268b(%eax),%eax
+  8002c9:	50                   	push   %eax
+  8002ca:	ff d7                	call   *%edi
+}
+  8002cc:	83 c4 10             	add    $0x10,%esp
+  8002cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002d2:	5b                   	pop    %ebx
+  8002d3:	5e                   	pop    %esi
+  8002d4:	5f                   	pop    %edi
+  8002d5:	5d                   	pop    %ebp
+  8002d6:	c3                   	ret
+
+008002d7 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002d7:	55                   	push   %ebp
+  8002d8:	89 e5                	mov    %esp,%ebp
+  8002da:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8002dd:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002e1:	8b 10                	mov    (%eax),%edx
+  8002e3:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002e6:	73 0a                	jae    8002f2 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8002e8:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002eb:	89 08                	mov    %ecx,(%eax)
+  8002ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002f0:	88 02                	mov    %al,(%edx)
+}
+  8002f2:	5d                   	pop    %ebp
+  8002f3:	c3                   	ret
+
+008002f4 <printfmt>:
+{
+  8002f4:	55                   	push   %ebp
+  8002f5:	89 e5                	mov    %esp,%ebp
+  8002f7:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8002fa:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8002fd:	50                   	push   %eax
+  8002fe:	ff 75 10             	push   0x10(%ebp)
+  800301:	ff 75 0c             	push   0xc(%ebp)
+  800304:	ff 75 08             	push   0x8(%ebp)
+  800307:	e8 05 00 00 00       	call   800311 <vprintfmt>
+}
+  80030c:	83 c4 10             	add    $0x10,%esp
+  80030f:	c9                   	leave
+  800310:	c3                   	ret
+
+00800311 <vprintfmt>:
+{
+  800311:	55                   	push   %ebp
+  800312:	89 e5                	mov    %esp,%ebp
+  800314:	57                   	push   %edi
+  800315:	56                   	push   %esi
+  800316:	53                   	push   %ebx
+  800317:	83 ec 2c             	sub    $0x2c,%esp
+  80031a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80031d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800320:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800323:	eb 0a                	jmp    80032f <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800325:	83 ec 08             	sub    $0x8,%esp
+  800328:	53                   	push   %ebx
+  800329:	50                   	push   %eax
+  80032a:	ff d6                	call   *%esi
+  80032c:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80032f:	83 c7 01             	add    $0x1,%edi
+  800332:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800336:	83 f8 25             	cmp    $0x25,%eax
+  800339:	74 0c                	je     800347 <vprintfmt+0x36>
+			if (ch == '\0')
+  80033b:	85 c0                	test   %eax,%eax
+  80033d:	75 e6                	jne    800325 <vprintfmt+0x14>
+}
+  80033f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800342:	5b                   	pop    %ebx
+  800343:	5e                   	pop    %esi
+  800344:	5f                   	pop    %edi
+  800345:	5d                   	pop    %ebp
+  800346:	c3                   	ret
+		padc = ' ';
+  800347:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80034b:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800352:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800359:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800360:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800365:	8d 47 01             	lea    0x1(%edi),%eax
+  800368:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80036b:	0f b6 17             	movzbl (%edi),%edx
+  80036e:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800371:	3c 55                	cmp    $0x55,%al
+  800373:	0f 87 9a 03 00 00    	ja     800713 <vprintfmt+0x402>
+  800379:	0f b6 c0             	movzbl %al,%eax
+  80037c:	ff 24 85 c0 27 80 00 	jmp    *0x8027c0(,%eax,4)
+  800383:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800386:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80038a:	eb d9                	jmp    800365 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80038c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80038f:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800393:	eb d0                	jmp    800365 <vprintfmt+0x54>
+  800395:	0f b6 d2             	movzbl %dl,%edx
+  800398:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80039b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003a0:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8003a3:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003a6:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8003aa:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8003ad:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8003b0:	83 f9 09             	cmp    $0x9,%ecx
+  8003b3:	77 55                	ja     80040a <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8003b5:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8003b8:	eb e9                	jmp    8003a3 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8003ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003bd:	8b 00                	mov    (%eax),%eax
+  8003bf:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003c2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003c5:	8d 40 04             	lea    0x4(%eax),%eax
+  8003c8:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003cb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8003ce:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003d2:	79 91                	jns    800365 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8003d4:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003d7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003da:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003e1:	eb 82                	jmp    800365 <vprintfmt+0x54>
+			if (width < 0)
+  8003e3:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003e6:	85 d2                	test   %edx,%edx
+  8003e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ed:	0f 49 c2             	cmovns %edx,%eax
+  8003f0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003f3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003f6:	e9 6a ff ff ff       	jmp    800365 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003fb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8003fe:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800405:	e9 5b ff ff ff       	jmp    800365 <vprintfmt+0x54>
+  80040a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80040d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800410:	eb bc                	jmp    8003ce <vprintfmt+0xbd>
+			lflag++;
+  800412:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800415:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800418:	e9 48 ff ff ff       	jmp    800365 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80041d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800420:	8d 78 04             	lea    0x4(%eax),%edi
+  800423:	83 ec 08             	sub    $0x8,%esp
+  800426:	53                   	push   %ebx
+  800427:	ff 30                	push   (%eax)
+  800429:	ff d6                	call   *%esi
+			break;
+  80042b:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80042e:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800431:	e9 7c 02 00 00       	jmp    8006b2 <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  800436:	8b 45 14             	mov    0x14(%ebp),%eax
+  800439:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80043c:	8b 10                	mov    (%eax),%edx
+  80043e:	89 d0                	mov    %edx,%eax
+  800440:	f7 d8                	neg    %eax
+  800442:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800445:	83 f8 10             	cmp    $0x10,%eax
+  800448:	7f 23                	jg     80046d <vprintfmt+0x15c>
+  80044a:	8b 14 85 20 29 80 00 	mov    0x802920(,%eax,4),%edx
+  800451:	85 d2                	test   %edx,%edx
+  800453:	74 18                	je     80046d <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800455:	52                   	push   %edx
+  800456:	68 59 2a 80 00       	push   $0x802a59
+  80045b:	53                   	push   %ebx
+  80045c:	56                   	push   %esi
+  80045d:	e8 92 fe ff ff       	call   8002f4 <printfmt>
+  800462:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800465:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800468:	e9 45 02 00 00       	jmp    8006b2 <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  80046d:	50                   	push   %eax
+  80046e:	68 a3 26 80 00       	push   $0x8026a3
+  800473:	53                   	push   %ebx
+  800474:	56                   	push   %esi
+  800475:	e8 7a fe ff ff       	call   8002f4 <printfmt>
+  80047a:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80047d:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800480:	e9 2d 02 00 00       	jmp    8006b2 <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800485:	8b 45 14             	mov    0x14(%ebp),%eax
+  800488:	83 c0 04             	add    $0x4,%eax
+  80048b:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80048e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800491:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800493:	85 c9                	test   %ecx,%ecx
+  800495:	b8 9c 26 80 00       	mov    $0x80269c,%eax
+  80049a:	0f 45 c1             	cmovne %ecx,%eax
+  80049d:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8004a0:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004a4:	7e 06                	jle    8004ac <vprintfmt+0x19b>
+  8004a6:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8004aa:	75 0b                	jne    8004b7 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004ac:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8004af:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8004b2:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004b5:	eb 5c                	jmp    800513 <vprintfmt+0x202>
+  8004b7:	83 ec 08             	sub    $0x8,%esp
+  8004ba:	ff 75 d0             	push   -0x30(%ebp)
+  8004bd:	ff 75 cc             	push   -0x34(%ebp)
+  8004c0:	e8 eb 02 00 00       	call   8007b0 <strnlen>
+  8004c5:	89 c2                	mov    %eax,%edx
+  8004c7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004ca:	29 d0                	sub    %edx,%eax
+  8004cc:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8004cf:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004d3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004d6:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004d9:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004db:	eb 0e                	jmp    8004eb <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8004dd:	83 ec 08             	sub    $0x8,%esp
+  8004e0:	53                   	push   %ebx
+  8004e1:	57                   	push   %edi
+  8004e2:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004e5:	83 ee 01             	sub    $0x1,%esi
+  8004e8:	83 c4 10             	add    $0x10,%esp
+  8004eb:	85 f6                	test   %esi,%esi
+  8004ed:	7f ee                	jg     8004dd <vprintfmt+0x1cc>
+  8004ef:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004f2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004f5:	85 c0                	test   %eax,%eax
+  8004f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004fc:	0f 49 d0             	cmovns %eax,%edx
+  8004ff:	29 d0                	sub    %edx,%eax
+  800501:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800504:	eb a6                	jmp    8004ac <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800506:	83 ec 08             	sub    $0x8,%esp
+  800509:	53                   	push   %ebx
+  80050a:	52                   	push   %edx
+  80050b:	ff 55 08             	call   *0x8(%ebp)
+  80050e:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800511:	89 f1                	mov    %esi,%ecx
+  800513:	8d 71 01             	lea    0x1(%ecx),%esi
+  800516:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80051a:	0f be d0             	movsbl %al,%edx
+  80051d:	85 d2                	test   %edx,%edx
+  80051f:	74 28                	je     800549 <vprintfmt+0x238>
+  800521:	85 ff                	test   %edi,%edi
+  800523:	78 05                	js     80052a <vprintfmt+0x219>
+  800525:	83 ef 01             	sub    $0x1,%edi
+  800528:	78 30                	js     80055a <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80052a:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80052e:	74 d6                	je     800506 <vprintfmt+0x1f5>
+  800530:	0f be c0             	movsbl %al,%eax
+  800533:	83 e8 20             	sub    $0x20,%eax
+  800536:	83 f8 5e             	cmp    $0x5e,%eax
+  800539:	76 cb                	jbe    800506 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80053b:	83 ec 08             	sub    $0x8,%esp
+  80053e:	53                   	push   %ebx
+  80053f:	6a 3f                	push   $0x3f
+  800541:	ff 55 08             	call   *0x8(%ebp)
+  800544:	83 c4 10             	add    $0x10,%esp
+  800547:	eb c8                	jmp    800511 <vprintfmt+0x200>
+  800549:	8b 75 08             	mov    0x8(%ebp),%esi
+  80054c:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80054f:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800552:	01 d0                	add    %edx,%eax
+  800554:	29 c8                	sub    %ecx,%eax
+  800556:	89 c7                	mov    %eax,%edi
+  800558:	eb 13                	jmp    80056d <vprintfmt+0x25c>
+  80055a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80055d:	eb ed                	jmp    80054c <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80055f:	83 ec 08             	sub    $0x8,%esp
+  800562:	53                   	push   %ebx
+  800563:	6a 20                	push   $0x20
+  800565:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800567:	83 ef 01             	sub    $0x1,%edi
+  80056a:	83 c4 10             	add    $0x10,%esp
+  80056d:	85 ff                	test   %edi,%edi
+  80056f:	7f ee                	jg     80055f <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800571:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800574:	89 45 14             	mov    %eax,0x14(%ebp)
+  800577:	e9 36 01 00 00       	jmp    8006b2 <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  80057c:	83 f9 01             	cmp    $0x1,%ecx
+  80057f:	7f 1f                	jg     8005a0 <vprintfmt+0x28f>
+	else if (lflag)
+  800581:	85 c9                	test   %ecx,%ecx
+  800583:	74 67                	je     8005ec <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800585:	8b 45 14             	mov    0x14(%ebp),%eax
+  800588:	8b 00                	mov    (%eax),%eax
+  80058a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80058d:	89 c1                	mov    %eax,%ecx
+  80058f:	c1 f9 1f             	sar    $0x1f,%ecx
+  800592:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800595:	8b 45 14             	mov    0x14(%ebp),%eax
+  800598:	8d 40 04             	lea    0x4(%eax),%eax
+  80059b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80059e:	eb 17                	jmp    8005b7 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8005a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a3:	8b 50 04             	mov    0x4(%eax),%edx
+  8005a6:	8b 00                	mov    (%eax),%eax
+  8005a8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005ab:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005ae:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b1:	8d 40 08             	lea    0x8(%eax),%eax
+  8005b4:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8005b7:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005ba:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8005bd:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8005c2:	85 c9                	test   %ecx,%ecx
+  8005c4:	0f 89 ce 00 00 00    	jns    800698 <vprintfmt+0x387>
+				putch('-', putdat);
+  8005ca:	83 ec 08             	sub    $0x8,%esp
+  8005cd:	53                   	push   %ebx
+  8005ce:	6a 2d                	push   $0x2d
+  8005d0:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8005d2:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005d5:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005d8:	f7 da                	neg    %edx
+  8005da:	83 d1 00             	adc    $0x0,%ecx
+  8005dd:	f7 d9                	neg    %ecx
+  8005df:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8005e2:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005e7:	e9 ac 00 00 00       	jmp    800698 <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  8005ec:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ef:	8b 00                	mov    (%eax),%eax
+  8005f1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005f4:	89 c1                	mov    %eax,%ecx
+  8005f6:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005f9:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005fc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ff:	8d 40 04             	lea    0x4(%eax),%eax
+  800602:	89 45 14             	mov    %eax,0x14(%ebp)
+  800605:	eb b0                	jmp    8005b7 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800607:	83 f9 01             	cmp    $0x1,%ecx
+  80060a:	7f 1b                	jg     800627 <vprintfmt+0x316>
+	else if (lflag)
+  80060c:	85 c9                	test   %ecx,%ecx
+  80060e:	74 2c                	je     80063c <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  800610:	8b 45 14             	mov    0x14(%ebp),%eax
+  800613:	8b 10                	mov    (%eax),%edx
+  800615:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80061a:	8d 40 04             	lea    0x4(%eax),%eax
+  80061d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800620:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800625:	eb 71                	jmp    800698 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  800627:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062a:	8b 10                	mov    (%eax),%edx
+  80062c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80062f:	8d 40 08             	lea    0x8(%eax),%eax
+  800632:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800635:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80063a:	eb 5c                	jmp    800698 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  80063c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063f:	8b 10                	mov    (%eax),%edx
+  800641:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800646:	8d 40 04             	lea    0x4(%eax),%eax
+  800649:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80064c:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800651:	eb 45                	jmp    800698 <vprintfmt+0x387>
+			putch('X', putdat);
+  800653:	83 ec 08             	sub    $0x8,%esp
+  800656:	53                   	push   %ebx
+  800657:	6a 58                	push   $0x58
+  800659:	ff d6                	call   *%esi
+			putch('X', putdat);
+  80065b:	83 c4 08             	add    $0x8,%esp
+  80065e:	53                   	push   %ebx
+  80065f:	6a 58                	push   $0x58
+  800661:	ff d6                	call   *%esi
+			putch('X', putdat);
+  800663:	83 c4 08             	add    $0x8,%esp
+  800666:	53                   	push   %ebx
+  800667:	6a 58                	push   $0x58
+  800669:	ff d6                	call   *%esi
+			break;
+  80066b:	83 c4 10             	add    $0x10,%esp
+  80066e:	eb 42                	jmp    8006b2 <vprintfmt+0x3a1>
+			putch('0', putdat);
+  800670:	83 ec 08             	sub    $0x8,%esp
+  800673:	53                   	push   %ebx
+  800674:	6a 30                	push   $0x30
+  800676:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800678:	83 c4 08             	add    $0x8,%esp
+  80067b:	53                   	push   %ebx
+  80067c:	6a 78                	push   $0x78
+  80067e:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800680:	8b 45 14             	mov    0x14(%ebp),%eax
+  800683:	8b 10                	mov    (%eax),%edx
+  800685:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80068a:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80068d:	8d 40 04             	lea    0x4(%eax),%eax
+  800690:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800693:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800698:	83 ec 0c             	sub    $0xc,%esp
+  80069b:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80069f:	50                   	push   %eax
+  8006a0:	ff 75 e0             	push   -0x20(%ebp)
+  8006a3:	57                   	push   %edi
+  8006a4:	51                   	push   %ecx
+  8006a5:	52                   	push   %edx
+  8006a6:	89 da                	mov    %ebx,%edx
+  8006a8:	89 f0                	mov    %esi,%eax
+  8006aa:	e8 7f fb ff ff       	call   80022e <printnum>
+			break;
+  8006af:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8006b2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8006b5:	e9 75 fc ff ff       	jmp    80032f <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8006ba:	83 f9 01             	cmp    $0x1,%ecx
+  8006bd:	7f 1b                	jg     8006da <vprintfmt+0x3c9>
+	else if (lflag)
+  8006bf:	85 c9                	test   %ecx,%ecx
+  8006c1:	74 2c                	je     8006ef <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  8006c3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c6:	8b 10                	mov    (%eax),%edx
+  8006c8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006cd:	8d 40 04             	lea    0x4(%eax),%eax
+  8006d0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006d3:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8006d8:	eb be                	jmp    800698 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  8006da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006dd:	8b 10                	mov    (%eax),%edx
+  8006df:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006e2:	8d 40 08             	lea    0x8(%eax),%eax
+  8006e5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006e8:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8006ed:	eb a9                	jmp    800698 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  8006ef:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f2:	8b 10                	mov    (%eax),%edx
+  8006f4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006f9:	8d 40 04             	lea    0x4(%eax),%eax
+  8006fc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006ff:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800704:	eb 92                	jmp    800698 <vprintfmt+0x387>
+			putch(ch, putdat);
+  800706:	83 ec 08             	sub    $0x8,%esp
+  800709:	53                   	push   %ebx
+  80070a:	6a 25                	push   $0x25
+  80070c:	ff d6                	call   *%esi
+			break;
+  80070e:	83 c4 10             	add    $0x10,%esp
+  800711:	eb 9f                	jmp    8006b2 <vprintfmt+0x3a1>
+			putch('%', putdat);
+  800713:	83 ec 08             	sub    $0x8,%esp
+  800716:	53                   	push   %ebx
+  800717:	6a 25                	push   $0x25
+  800719:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80071b:	83 c4 10             	add    $0x10,%esp
+  80071e:	89 f8                	mov    %edi,%eax
+  800720:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800724:	74 05                	je     80072b <vprintfmt+0x41a>
+  800726:	83 e8 01             	sub    $0x1,%eax
+  800729:	eb f5                	jmp    800720 <vprintfmt+0x40f>
+  80072b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80072e:	eb 82                	jmp    8006b2 <vprintfmt+0x3a1>
+
+00800730 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800730:	55                   	push   %ebp
+  800731:	89 e5                	mov    %esp,%ebp
+  800733:	83 ec 18             	sub    $0x18,%esp
+  800736:	8b 45 08             	mov    0x8(%ebp),%eax
+  800739:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80073c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80073f:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800743:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800746:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80074d:	85 c0                	test   %eax,%eax
+  80074f:	74 26                	je     800777 <vsnprintf+0x47>
+  800751:	85 d2                	test   %edx,%edx
+  800753:	7e 22                	jle    800777 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800755:	ff 75 14             	push   0x14(%ebp)
+  800758:	ff 75 10             	push   0x10(%ebp)
+  80075b:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80075e:	50                   	push   %eax
+  80075f:	68 d7 02 80 00       	push   $0x8002d7
+  800764:	e8 a8 fb ff ff       	call   800311 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800769:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80076c:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80076f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800772:	83 c4 10             	add    $0x10,%esp
+}
+  800775:	c9                   	leave
+  800776:	c3                   	ret
+		return -E_INVAL;
+  800777:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80077c:	eb f7                	jmp    800775 <vsnprintf+0x45>
+
+0080077e <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80077e:	55                   	push   %ebp
+  80077f:	89 e5                	mov    %esp,%ebp
+  800781:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800784:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800787:	50                   	push   %eax
+  800788:	ff 75 10             	push   0x10(%ebp)
+  80078b:	ff 75 0c             	push   0xc(%ebp)
+  80078e:	ff 75 08             	push   0x8(%ebp)
+  800791:	e8 9a ff ff ff       	call   800730 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800796:	c9                   	leave
+  800797:	c3                   	ret
+
+00800798 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800798:	55                   	push   %ebp
+  800799:	89 e5                	mov    %esp,%ebp
+  80079b:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80079e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007a3:	eb 03                	jmp    8007a8 <strlen+0x10>
+		n++;
+  8007a5:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8007a8:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007ac:	75 f7                	jne    8007a5 <strlen+0xd>
+	return n;
+}
+  8007ae:	5d                   	pop    %ebp
+  8007af:	c3                   	ret
+
+008007b0 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8007b0:	55                   	push   %ebp
+  8007b1:	89 e5                	mov    %esp,%ebp
+  8007b3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007b6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007be:	eb 03                	jmp    8007c3 <strnlen+0x13>
+		n++;
+  8007c0:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007c3:	39 d0                	cmp    %edx,%eax
+  8007c5:	74 08                	je     8007cf <strnlen+0x1f>
+  8007c7:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8007cb:	75 f3                	jne    8007c0 <strnlen+0x10>
+  8007cd:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8007cf:	89 d0                	mov    %edx,%eax
+  8007d1:	5d                   	pop    %ebp
+  8007d2:	c3                   	ret
+
+008007d3 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8007d3:	55                   	push   %ebp
+  8007d4:	89 e5                	mov    %esp,%ebp
+  8007d6:	53                   	push   %ebx
+  8007d7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007da:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8007dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007e2:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8007e6:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8007e9:	83 c0 01             	add    $0x1,%eax
+  8007ec:	84 d2                	test   %dl,%dl
+  8007ee:	75 f2                	jne    8007e2 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8007f0:	89 c8                	mov    %ecx,%eax
+  8007f2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007f5:	c9                   	leave
+  8007f6:	c3                   	ret
+
+008007f7 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8007f7:	55                   	push   %ebp
+  8007f8:	89 e5                	mov    %esp,%ebp
+  8007fa:	53                   	push   %ebx
+  8007fb:	83 ec 10             	sub    $0x10,%esp
+  8007fe:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800801:	53                   	push   %ebx
+  800802:	e8 91 ff ff ff       	call   800798 <strlen>
+  800807:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80080a:	ff 75 0c             	push   0xc(%ebp)
+  80080d:	01 d8                	add    %ebx,%eax
+  80080f:	50                   	push   %eax
+  800810:	e8 be ff ff ff       	call   8007d3 <strcpy>
+	return dst;
+}
+  800815:	89 d8                	mov    %ebx,%eax
+  800817:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80081a:	c9                   	leave
+  80081b:	c3                   	ret
+
+0080081c <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80081c:	55                   	push   %ebp
+  80081d:	89 e5                	mov    %esp,%ebp
+  80081f:	56                   	push   %esi
+  800820:	53                   	push   %ebx
+  800821:	8b 75 08             	mov    0x8(%ebp),%esi
+  800824:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800827:	89 f3                	mov    %esi,%ebx
+  800829:	03 5d 10             	add    0x10(%ebp),%ebx
+  80082c:	89 f0                	mov    %esi,%eax
+  80082e:	eb 0f                	jmp    80083f <strncpy+0x23>
+		*dst++ = *src;
+  800830:	83 c0 01             	add    $0x1,%eax
+  800833:	0f b6 0a             	movzbl (%edx),%ecx
+  800836:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800839:	80 f9 01             	cmp    $0x1,%cl
+  80083c:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80083f:	39 d8                	cmp    %ebx,%eax
+  800841:	75 ed                	jne    800830 <strncpy+0x14>
+	}
+	return ret;
+}
+  800843:	89 f0                	mov    %esi,%eax
+  800845:	5b                   	pop    %ebx
+  800846:	5e                   	pop    %esi
+  800847:	5d                   	pop    %ebp
+  800848:	c3                   	ret
+
+00800849 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800849:	55                   	push   %ebp
+  80084a:	89 e5                	mov    %esp,%ebp
+  80084c:	56                   	push   %esi
+  80084d:	53                   	push   %ebx
+  80084e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800851:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800854:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800857:	89 f0                	mov    %esi,%eax
+  800859:	85 d2                	test   %edx,%edx
+  80085b:	74 21                	je     80087e <strlcpy+0x35>
+  80085d:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800861:	89 f2                	mov    %esi,%edx
+  800863:	eb 09                	jmp    80086e <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800865:	83 c1 01             	add    $0x1,%ecx
+  800868:	83 c2 01             	add    $0x1,%edx
+  80086b:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80086e:	39 c2                	cmp    %eax,%edx
+  800870:	74 09                	je     80087b <strlcpy+0x32>
+  800872:	0f b6 19             	movzbl (%ecx),%ebx
+  800875:	84 db                	test   %bl,%bl
+  800877:	75 ec                	jne    800865 <strlcpy+0x1c>
+  800879:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80087b:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80087e:	29 f0                	sub    %esi,%eax
+}
+  800880:	5b                   	pop    %ebx
+  800881:	5e                   	pop    %esi
+  800882:	5d                   	pop    %ebp
+  800883:	c3                   	ret
+
+00800884 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800884:	55                   	push   %ebp
+  800885:	89 e5                	mov    %esp,%ebp
+  800887:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80088a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80088d:	eb 06                	jmp    800895 <strcmp+0x11>
+		p++, q++;
+  80088f:	83 c1 01             	add    $0x1,%ecx
+  800892:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800895:	0f b6 01             	movzbl (%ecx),%eax
+  800898:	84 c0                	test   %al,%al
+  80089a:	74 04                	je     8008a0 <strcmp+0x1c>
+  80089c:	3a 02                	cmp    (%edx),%al
+  80089e:	74 ef                	je     80088f <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008a0:	0f b6 c0             	movzbl %al,%eax
+  8008a3:	0f b6 12             	movzbl (%edx),%edx
+  8008a6:	29 d0                	sub    %edx,%eax
+}
+  8008a8:	5d                   	pop    %ebp
+  8008a9:	c3                   	ret
+
+008008aa <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8008aa:	55                   	push   %ebp
+  8008ab:	89 e5                	mov    %esp,%ebp
+  8008ad:	53                   	push   %ebx
+  8008ae:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008b1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008b4:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8008b7:	eb 09                	jmp    8008c2 <strncmp+0x18>
+		n--, p++, q++;
+  8008b9:	83 ea 01             	sub    $0x1,%edx
+  8008bc:	83 c0 01             	add    $0x1,%eax
+  8008bf:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8008c2:	85 d2                	test   %edx,%edx
+  8008c4:	74 18                	je     8008de <strncmp+0x34>
+  8008c6:	0f b6 18             	movzbl (%eax),%ebx
+  8008c9:	84 db                	test   %bl,%bl
+  8008cb:	74 04                	je     8008d1 <strncmp+0x27>
+  8008cd:	3a 19                	cmp    (%ecx),%bl
+  8008cf:	74 e8                	je     8008b9 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008d1:	0f b6 00             	movzbl (%eax),%eax
+  8008d4:	0f b6 11             	movzbl (%ecx),%edx
+  8008d7:	29 d0                	sub    %edx,%eax
+}
+  8008d9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008dc:	c9                   	leave
+  8008dd:	c3                   	ret
+		return 0;
+  8008de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008e3:	eb f4                	jmp    8008d9 <strncmp+0x2f>
+
+008008e5 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8008e5:	55                   	push   %ebp
+  8008e6:	89 e5                	mov    %esp,%ebp
+  8008e8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008eb:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008ef:	eb 03                	jmp    8008f4 <strchr+0xf>
+  8008f1:	83 c0 01             	add    $0x1,%eax
+  8008f4:	0f b6 10             	movzbl (%eax),%edx
+  8008f7:	84 d2                	test   %dl,%dl
+  8008f9:	74 06                	je     800901 <strchr+0x1c>
+		if (*s == c)
+  8008fb:	38 ca                	cmp    %cl,%dl
+  8008fd:	75 f2                	jne    8008f1 <strchr+0xc>
+  8008ff:	eb 05                	jmp    800906 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800901:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800906:	5d                   	pop    %ebp
+  800907:	c3                   	ret
+
+00800908 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800908:	55                   	push   %ebp
+  800909:	89 e5                	mov    %esp,%ebp
+  80090b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80090e:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800912:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800915:	38 ca                	cmp    %cl,%dl
+  800917:	74 09                	je     800922 <strfind+0x1a>
+  800919:	84 d2                	test   %dl,%dl
+  80091b:	74 05                	je     800922 <strfind+0x1a>
+	for (; *s; s++)
+  80091d:	83 c0 01             	add    $0x1,%eax
+  800920:	eb f0                	jmp    800912 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800922:	5d                   	pop    %ebp
+  800923:	c3                   	ret
+
+00800924 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800924:	55                   	push   %ebp
+  800925:	89 e5                	mov    %esp,%ebp
+  800927:	57                   	push   %edi
+  800928:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80092b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  80092e:	85 c9                	test   %ecx,%ecx
+  800930:	74 20                	je     800952 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800932:	89 f8                	mov    %edi,%eax
+  800934:	09 c8                	or     %ecx,%eax
+  800936:	a8 03                	test   $0x3,%al
+  800938:	75 12                	jne    80094c <memset+0x28>
+		c &= 0xFF;
+  80093a:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80093e:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800944:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800947:	fc                   	cld
+  800948:	f3 ab                	rep stos %eax,%es:(%edi)
+  80094a:	eb 06                	jmp    800952 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80094c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80094f:	fc                   	cld
+  800950:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800952:	89 f8                	mov    %edi,%eax
+  800954:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800957:	c9                   	leave
+  800958:	c3                   	ret
+
+00800959 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800959:	55                   	push   %ebp
+  80095a:	89 e5                	mov    %esp,%ebp
+  80095c:	57                   	push   %edi
+  80095d:	56                   	push   %esi
+  80095e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800961:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800964:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800967:	39 c6                	cmp    %eax,%esi
+  800969:	73 32                	jae    80099d <memmove+0x44>
+  80096b:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80096e:	39 d0                	cmp    %edx,%eax
+  800970:	73 2b                	jae    80099d <memmove+0x44>
+		s += n;
+		d += n;
+  800972:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800975:	89 d6                	mov    %edx,%esi
+  800977:	09 fe                	or     %edi,%esi
+  800979:	09 ce                	or     %ecx,%esi
+  80097b:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800981:	75 0e                	jne    800991 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800983:	83 ef 04             	sub    $0x4,%edi
+  800986:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800989:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  80098c:	fd                   	std
+  80098d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80098f:	eb 09                	jmp    80099a <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800991:	83 ef 01             	sub    $0x1,%edi
+  800994:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800997:	fd                   	std
+  800998:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  80099a:	fc                   	cld
+  80099b:	eb 1a                	jmp    8009b7 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80099d:	89 f2                	mov    %esi,%edx
+  80099f:	09 c2                	or     %eax,%edx
+  8009a1:	09 ca                	or     %ecx,%edx
+  8009a3:	f6 c2 03             	test   $0x3,%dl
+  8009a6:	75 0a                	jne    8009b2 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8009a8:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8009ab:	89 c7                	mov    %eax,%edi
+  8009ad:	fc                   	cld
+  8009ae:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009b0:	eb 05                	jmp    8009b7 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8009b2:	89 c7                	mov    %eax,%edi
+  8009b4:	fc                   	cld
+  8009b5:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8009b7:	5e                   	pop    %esi
+  8009b8:	5f                   	pop    %edi
+  8009b9:	5d                   	pop    %ebp
+  8009ba:	c3                   	ret
+
+008009bb <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8009bb:	55                   	push   %ebp
+  8009bc:	89 e5                	mov    %esp,%ebp
+  8009be:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8009c1:	ff 75 10             	push   0x10(%ebp)
+  8009c4:	ff 75 0c             	push   0xc(%ebp)
+  8009c7:	ff 75 08             	push   0x8(%ebp)
+  8009ca:	e8 8a ff ff ff       	call   800959 <memmove>
+}
+  8009cf:	c9                   	leave
+  8009d0:	c3                   	ret
+
+008009d1 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8009d1:	55                   	push   %ebp
+  8009d2:	89 e5                	mov    %esp,%ebp
+  8009d4:	56                   	push   %esi
+  8009d5:	53                   	push   %ebx
+  8009d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009d9:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8009dc:	89 c6                	mov    %eax,%esi
+  8009de:	03 75 10             	add    0x10(%ebp),%esi
+  8009e1:	eb 06                	jmp    8009e9 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8009e3:	83 c0 01             	add    $0x1,%eax
+  8009e6:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  8009e9:	39 f0                	cmp    %esi,%eax
+  8009eb:	74 14                	je     800a01 <memcmp+0x30>
+		if (*s1 != *s2)
+  8009ed:	0f b6 08             	movzbl (%eax),%ecx
+  8009f0:	0f b6 1a             	movzbl (%edx),%ebx
+  8009f3:	38 d9                	cmp    %bl,%cl
+  8009f5:	74 ec                	je     8009e3 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  8009f7:	0f b6 c1             	movzbl %cl,%eax
+  8009fa:	0f b6 db             	movzbl %bl,%ebx
+  8009fd:	29 d8                	sub    %ebx,%eax
+  8009ff:	eb 05                	jmp    800a06 <memcmp+0x35>
+	}
+
+	return 0;
+  800a01:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a06:	5b                   	pop    %ebx
+  800a07:	5e                   	pop    %esi
+  800a08:	5d                   	pop    %ebp
+  800a09:	c3                   	ret
+
+00800a0a <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a0a:	55                   	push   %ebp
+  800a0b:	89 e5                	mov    %esp,%ebp
+  800a0d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a10:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a13:	89 c2                	mov    %eax,%edx
+  800a15:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a18:	eb 03                	jmp    800a1d <memfind+0x13>
+  800a1a:	83 c0 01             	add    $0x1,%eax
+  800a1d:	39 d0                	cmp    %edx,%eax
+  800a1f:	73 04                	jae    800a25 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a21:	38 08                	cmp    %cl,(%eax)
+  800a23:	75 f5                	jne    800a1a <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a25:	5d                   	pop    %ebp
+  800a26:	c3                   	ret
+
+00800a27 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a27:	55                   	push   %ebp
+  800a28:	89 e5                	mov    %esp,%ebp
+  800a2a:	57                   	push   %edi
+  800a2b:	56                   	push   %esi
+  800a2c:	53                   	push   %ebx
+  800a2d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a30:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a33:	eb 03                	jmp    800a38 <strtol+0x11>
+		s++;
+  800a35:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a38:	0f b6 02             	movzbl (%edx),%eax
+  800a3b:	3c 20                	cmp    $0x20,%al
+  800a3d:	74 f6                	je     800a35 <strtol+0xe>
+  800a3f:	3c 09                	cmp    $0x9,%al
+  800a41:	74 f2                	je     800a35 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a43:	3c 2b                	cmp    $0x2b,%al
+  800a45:	74 2a                	je     800a71 <strtol+0x4a>
+	int neg = 0;
+  800a47:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a4c:	3c 2d                	cmp    $0x2d,%al
+  800a4e:	74 2b                	je     800a7b <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a50:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a56:	75 0f                	jne    800a67 <strtol+0x40>
+  800a58:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a5b:	74 28                	je     800a85 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a5d:	85 db                	test   %ebx,%ebx
+  800a5f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a64:	0f 44 d8             	cmove  %eax,%ebx
+  800a67:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a6c:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a6f:	eb 46                	jmp    800ab7 <strtol+0x90>
+		s++;
+  800a71:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a74:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a79:	eb d5                	jmp    800a50 <strtol+0x29>
+		s++, neg = 1;
+  800a7b:	83 c2 01             	add    $0x1,%edx
+  800a7e:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a83:	eb cb                	jmp    800a50 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a85:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a89:	74 0e                	je     800a99 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a8b:	85 db                	test   %ebx,%ebx
+  800a8d:	75 d8                	jne    800a67 <strtol+0x40>
+		s++, base = 8;
+  800a8f:	83 c2 01             	add    $0x1,%edx
+  800a92:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a97:	eb ce                	jmp    800a67 <strtol+0x40>
+		s += 2, base = 16;
+  800a99:	83 c2 02             	add    $0x2,%edx
+  800a9c:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800aa1:	eb c4                	jmp    800a67 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800aa3:	0f be c0             	movsbl %al,%eax
+  800aa6:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800aa9:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800aac:	7d 3a                	jge    800ae8 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800aae:	83 c2 01             	add    $0x1,%edx
+  800ab1:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800ab5:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800ab7:	0f b6 02             	movzbl (%edx),%eax
+  800aba:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800abd:	89 f3                	mov    %esi,%ebx
+  800abf:	80 fb 09             	cmp    $0x9,%bl
+  800ac2:	76 df                	jbe    800aa3 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800ac4:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800ac7:	89 f3                	mov    %esi,%ebx
+  800ac9:	80 fb 19             	cmp    $0x19,%bl
+  800acc:	77 08                	ja     800ad6 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800ace:	0f be c0             	movsbl %al,%eax
+  800ad1:	83 e8 57             	sub    $0x57,%eax
+  800ad4:	eb d3                	jmp    800aa9 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800ad6:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800ad9:	89 f3                	mov    %esi,%ebx
+  800adb:	80 fb 19             	cmp    $0x19,%bl
+  800ade:	77 08                	ja     800ae8 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800ae0:	0f be c0             	movsbl %al,%eax
+  800ae3:	83 e8 37             	sub    $0x37,%eax
+  800ae6:	eb c1                	jmp    800aa9 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800ae8:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800aec:	74 05                	je     800af3 <strtol+0xcc>
+		*endptr = (char *) s;
+  800aee:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800af1:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800af3:	89 c8                	mov    %ecx,%eax
+  800af5:	f7 d8                	neg    %eax
+  800af7:	85 ff                	test   %edi,%edi
+  800af9:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800afc:	89 c8                	mov    %ecx,%eax
+  800afe:	5b                   	pop    %ebx
+  800aff:	5e                   	pop    %esi
+  800b00:	5f                   	pop    %edi
+  800b01:	5d                   	pop    %ebp
+  800b02:	c3                   	ret
+
+00800b03 <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800b03:	55                   	push   %ebp
+  800b04:	89 e5                	mov    %esp,%ebp
+  800b06:	57                   	push   %edi
+  800b07:	56                   	push   %esi
+  800b08:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800b09:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b0e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b11:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b14:	89 c3                	mov    %eax,%ebx
+  800b16:	89 c7                	mov    %eax,%edi
+  800b18:	89 c6                	mov    %eax,%esi
+  800b1a:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  800b1c:	5b                   	pop    %ebx
+  800b1d:	5e                   	pop    %esi
+  800b1e:	5f                   	pop    %edi
+  800b1f:	5d                   	pop    %ebp
+  800b20:	c3                   	ret
+
+00800b21 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800b21:	55                   	push   %ebp
+  800b22:	89 e5                	mov    %esp,%ebp
+  800b24:	57                   	push   %edi
+  800b25:	56                   	push   %esi
+  800b26:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800b27:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b2c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b31:	89 d1                	mov    %edx,%ecx
+  800b33:	89 d3                	mov    %edx,%ebx
+  800b35:	89 d7                	mov    %edx,%edi
+  800b37:	89 d6                	mov    %edx,%esi
+  800b39:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800b3b:	5b                   	pop    %ebx
+  800b3c:	5e                   	pop    %esi
+  800b3d:	5f                   	pop    %edi
+  800b3e:	5d                   	pop    %ebp
+  800b3f:	c3                   	ret
+
+00800b40 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800b40:	55                   	push   %ebp
+  800b41:	89 e5                	mov    %esp,%ebp
+  800b43:	57                   	push   %edi
+  800b44:	56                   	push   %esi
+  800b45:	53                   	push   %ebx
+  800b46:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800b49:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b4e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b51:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b56:	89 cb                	mov    %ecx,%ebx
+  800b58:	89 cf                	mov    %ecx,%edi
+  800b5a:	89 ce                	mov    %ecx,%esi
+  800b5c:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800b5e:	85 c0                	test   %eax,%eax
+  800b60:	7f 08                	jg     800b6a <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800b62:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b65:	5b                   	pop    %ebx
+  800b66:	5e                   	pop    %esi
+  800b67:	5f                   	pop    %edi
+  800b68:	5d                   	pop    %ebp
+  800b69:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800b6a:	83 ec 0c             	sub    $0xc,%esp
+  800b6d:	50                   	push   %eax
+  800b6e:	6a 03                	push   $0x3
+  800b70:	68 83 29 80 00       	push   $0x802983
+  800b75:	6a 3e                	push   $0x3e
+  800b77:	68 a0 29 80 00       	push   $0x8029a0
+  800b7c:	e8 be f5 ff ff       	call   80013f <_panic>
+
+00800b81 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800b81:	55                   	push   %ebp
+  800b82:	89 e5                	mov    %esp,%ebp
+  800b84:	57                   	push   %edi
+  800b85:	56                   	push   %esi
+  800b86:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800b87:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b8c:	b8 02 00 00 00       	mov    $0x2,%eax
+  800b91:	89 d1                	mov    %edx,%ecx
+  800b93:	89 d3                	mov    %edx,%ebx
+  800b95:	89 d7                	mov    %edx,%edi
+  800b97:	89 d6                	mov    %edx,%esi
+  800b99:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800b9b:	5b                   	pop    %ebx
+  800b9c:	5e                   	pop    %esi
+  800b9d:	5f                   	pop    %edi
+  800b9e:	5d                   	pop    %ebp
+  800b9f:	c3                   	ret
+
+00800ba0 <sys_yield>:
+
+void
+sys_yield(void) {
+  800ba0:	55                   	push   %ebp
+  800ba1:	89 e5                	mov    %esp,%ebp
+  800ba3:	57                   	push   %edi
+  800ba4:	56                   	push   %esi
+  800ba5:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800ba6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bab:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800bb0:	89 d1                	mov    %edx,%ecx
+  800bb2:	89 d3                	mov    %edx,%ebx
+  800bb4:	89 d7                	mov    %edx,%edi
+  800bb6:	89 d6                	mov    %edx,%esi
+  800bb8:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800bba:	5b                   	pop    %ebx
+  800bbb:	5e                   	pop    %esi
+  800bbc:	5f                   	pop    %edi
+  800bbd:	5d                   	pop    %ebp
+  800bbe:	c3                   	ret
+
+00800bbf <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  800bbf:	55                   	push   %ebp
+  800bc0:	89 e5                	mov    %esp,%ebp
+  800bc2:	57                   	push   %edi
+  800bc3:	56                   	push   %esi
+  800bc4:	53                   	push   %ebx
+  800bc5:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800bc8:	be 00 00 00 00       	mov    $0x0,%esi
+  800bcd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bd0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bd3:	b8 04 00 00 00       	mov    $0x4,%eax
+  800bd8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bdb:	89 f7                	mov    %esi,%edi
+  800bdd:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800bdf:	85 c0                	test   %eax,%eax
+  800be1:	7f 08                	jg     800beb <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800be3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800be6:	5b                   	pop    %ebx
+  800be7:	5e                   	pop    %esi
+  800be8:	5f                   	pop    %edi
+  800be9:	5d                   	pop    %ebp
+  800bea:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800beb:	83 ec 0c             	sub    $0xc,%esp
+  800bee:	50                   	push   %eax
+  800bef:	6a 04                	push   $0x4
+  800bf1:	68 83 29 80 00       	push   $0x802983
+  800bf6:	6a 3e                	push   $0x3e
+  800bf8:	68 a0 29 80 00       	push   $0x8029a0
+  800bfd:	e8 3d f5 ff ff       	call   80013f <_panic>
+
+00800c02 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  800c02:	55                   	push   %ebp
+  800c03:	89 e5                	mov    %esp,%ebp
+  800c05:	57                   	push   %edi
+  800c06:	56                   	push   %esi
+  800c07:	53                   	push   %ebx
+  800c08:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c0b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c0e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c11:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c16:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c19:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c1c:	8b 75 18             	mov    0x18(%ebp),%esi
+  800c1f:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c21:	85 c0                	test   %eax,%eax
+  800c23:	7f 08                	jg     800c2d <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800c25:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c28:	5b                   	pop    %ebx
+  800c29:	5e                   	pop    %esi
+  800c2a:	5f                   	pop    %edi
+  800c2b:	5d                   	pop    %ebp
+  800c2c:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c2d:	83 ec 0c             	sub    $0xc,%esp
+  800c30:	50                   	push   %eax
+  800c31:	6a 05                	push   $0x5
+  800c33:	68 83 29 80 00       	push   $0x802983
+  800c38:	6a 3e                	push   $0x3e
+  800c3a:	68 a0 29 80 00       	push   $0x8029a0
+  800c3f:	e8 fb f4 ff ff       	call   80013f <_panic>
+
+00800c44 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  800c44:	55                   	push   %ebp
+  800c45:	89 e5                	mov    %esp,%ebp
+  800c47:	57                   	push   %edi
+  800c48:	56                   	push   %esi
+  800c49:	53                   	push   %ebx
+  800c4a:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c4d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c52:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c55:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c58:	b8 06 00 00 00       	mov    $0x6,%eax
+  800c5d:	89 df                	mov    %ebx,%edi
+  800c5f:	89 de                	mov    %ebx,%esi
+  800c61:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c63:	85 c0                	test   %eax,%eax
+  800c65:	7f 08                	jg     800c6f <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800c67:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c6a:	5b                   	pop    %ebx
+  800c6b:	5e                   	pop    %esi
+  800c6c:	5f                   	pop    %edi
+  800c6d:	5d                   	pop    %ebp
+  800c6e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c6f:	83 ec 0c             	sub    $0xc,%esp
+  800c72:	50                   	push   %eax
+  800c73:	6a 06                	push   $0x6
+  800c75:	68 83 29 80 00       	push   $0x802983
+  800c7a:	6a 3e                	push   $0x3e
+  800c7c:	68 a0 29 80 00       	push   $0x8029a0
+  800c81:	e8 b9 f4 ff ff       	call   80013f <_panic>
+
+00800c86 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800c86:	55                   	push   %ebp
+  800c87:	89 e5                	mov    %esp,%ebp
+  800c89:	57                   	push   %edi
+  800c8a:	56                   	push   %esi
+  800c8b:	53                   	push   %ebx
+  800c8c:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c8f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c94:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c97:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c9a:	b8 08 00 00 00       	mov    $0x8,%eax
+  800c9f:	89 df                	mov    %ebx,%edi
+  800ca1:	89 de                	mov    %ebx,%esi
+  800ca3:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ca5:	85 c0                	test   %eax,%eax
+  800ca7:	7f 08                	jg     800cb1 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800ca9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cac:	5b                   	pop    %ebx
+  800cad:	5e                   	pop    %esi
+  800cae:	5f                   	pop    %edi
+  800caf:	5d                   	pop    %ebp
+  800cb0:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800cb1:	83 ec 0c             	sub    $0xc,%esp
+  800cb4:	50                   	push   %eax
+  800cb5:	6a 08                	push   $0x8
+  800cb7:	68 83 29 80 00       	push   $0x802983
+  800cbc:	6a 3e                	push   $0x3e
+  800cbe:	68 a0 29 80 00       	push   $0x8029a0
+  800cc3:	e8 77 f4 ff ff       	call   80013f <_panic>
+
+00800cc8 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800cc8:	55                   	push   %ebp
+  800cc9:	89 e5                	mov    %esp,%ebp
+  800ccb:	57                   	push   %edi
+  800ccc:	56                   	push   %esi
+  800ccd:	53                   	push   %ebx
+  800cce:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800cd1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cd6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cd9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cdc:	b8 09 00 00 00       	mov    $0x9,%eax
+  800ce1:	89 df                	mov    %ebx,%edi
+  800ce3:	89 de                	mov    %ebx,%esi
+  800ce5:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ce7:	85 c0                	test   %eax,%eax
+  800ce9:	7f 08                	jg     800cf3 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800ceb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cee:	5b                   	pop    %ebx
+  800cef:	5e                   	pop    %esi
+  800cf0:	5f                   	pop    %edi
+  800cf1:	5d                   	pop    %ebp
+  800cf2:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800cf3:	83 ec 0c             	sub    $0xc,%esp
+  800cf6:	50                   	push   %eax
+  800cf7:	6a 09                	push   $0x9
+  800cf9:	68 83 29 80 00       	push   $0x802983
+  800cfe:	6a 3e                	push   $0x3e
+  800d00:	68 a0 29 80 00       	push   $0x8029a0
+  800d05:	e8 35 f4 ff ff       	call   80013f <_panic>
+
+00800d0a <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800d0a:	55                   	push   %ebp
+  800d0b:	89 e5                	mov    %esp,%ebp
+  800d0d:	57                   	push   %edi
+  800d0e:	56                   	push   %esi
+  800d0f:	53                   	push   %ebx
+  800d10:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800d13:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d18:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d1b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d1e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d23:	89 df                	mov    %ebx,%edi
+  800d25:	89 de                	mov    %ebx,%esi
+  800d27:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d29:	85 c0                	test   %eax,%eax
+  800d2b:	7f 08                	jg     800d35 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800d2d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d30:	5b                   	pop    %ebx
+  800d31:	5e                   	pop    %esi
+  800d32:	5f                   	pop    %edi
+  800d33:	5d                   	pop    %ebp
+  800d34:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d35:	83 ec 0c             	sub    $0xc,%esp
+  800d38:	50                   	push   %eax
+  800d39:	6a 0a                	push   $0xa
+  800d3b:	68 83 29 80 00       	push   $0x802983
+  800d40:	6a 3e                	push   $0x3e
+  800d42:	68 a0 29 80 00       	push   $0x8029a0
+  800d47:	e8 f3 f3 ff ff       	call   80013f <_panic>
+
+00800d4c <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  800d4c:	55                   	push   %ebp
+  800d4d:	89 e5                	mov    %esp,%ebp
+  800d4f:	57                   	push   %edi
+  800d50:	56                   	push   %esi
+  800d51:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d52:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d55:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d58:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800d5d:	be 00 00 00 00       	mov    $0x0,%esi
+  800d62:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d65:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d68:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800d6a:	5b                   	pop    %ebx
+  800d6b:	5e                   	pop    %esi
+  800d6c:	5f                   	pop    %edi
+  800d6d:	5d                   	pop    %ebp
+  800d6e:	c3                   	ret
+
+00800d6f <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  800d6f:	55                   	push   %ebp
+  800d70:	89 e5                	mov    %esp,%ebp
+  800d72:	57                   	push   %edi
+  800d73:	56                   	push   %esi
+  800d74:	53                   	push   %ebx
+  800d75:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800d78:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d7d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d80:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800d85:	89 cb                	mov    %ecx,%ebx
+  800d87:	89 cf                	mov    %ecx,%edi
+  800d89:	89 ce                	mov    %ecx,%esi
+  800d8b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d8d:	85 c0                	test   %eax,%eax
+  800d8f:	7f 08                	jg     800d99 <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  800d91:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d94:	5b                   	pop    %ebx
+  800d95:	5e                   	pop    %esi
+  800d96:	5f                   	pop    %edi
+  800d97:	5d                   	pop    %ebp
+  800d98:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d99:	83 ec 0c             	sub    $0xc,%esp
+  800d9c:	50                   	push   %eax
+  800d9d:	6a 0d                	push   $0xd
+  800d9f:	68 83 29 80 00       	push   $0x802983
+  800da4:	6a 3e                	push   $0x3e
+  800da6:	68 a0 29 80 00       	push   $0x8029a0
+  800dab:	e8 8f f3 ff ff       	call   80013f <_panic>
+
+00800db0 <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  800db0:	55                   	push   %ebp
+  800db1:	89 e5                	mov    %esp,%ebp
+  800db3:	57                   	push   %edi
+  800db4:	56                   	push   %esi
+  800db5:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800db6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dbb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dbe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dc1:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800dc6:	89 df                	mov    %ebx,%edi
+  800dc8:	89 de                	mov    %ebx,%esi
+  800dca:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  800dcc:	5b                   	pop    %ebx
+  800dcd:	5e                   	pop    %esi
+  800dce:	5f                   	pop    %edi
+  800dcf:	5d                   	pop    %ebp
+  800dd0:	c3                   	ret
+
+00800dd1 <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  800dd1:	55                   	push   %ebp
+  800dd2:	89 e5                	mov    %esp,%ebp
+  800dd4:	57                   	push   %edi
+  800dd5:	56                   	push   %esi
+  800dd6:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800dd7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ddc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ddf:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800de4:	89 cb                	mov    %ecx,%ebx
+  800de6:	89 cf                	mov    %ecx,%edi
+  800de8:	89 ce                	mov    %ecx,%esi
+  800dea:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  800dec:	5b                   	pop    %ebx
+  800ded:	5e                   	pop    %esi
+  800dee:	5f                   	pop    %edi
+  800def:	5d                   	pop    %ebp
+  800df0:	c3                   	ret
+
+00800df1 <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  800df1:	55                   	push   %ebp
+  800df2:	89 e5                	mov    %esp,%ebp
+  800df4:	57                   	push   %edi
+  800df5:	56                   	push   %esi
+  800df6:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800df7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dfc:	b8 10 00 00 00       	mov    $0x10,%eax
+  800e01:	89 d1                	mov    %edx,%ecx
+  800e03:	89 d3                	mov    %edx,%ebx
+  800e05:	89 d7                	mov    %edx,%edi
+  800e07:	89 d6                	mov    %edx,%esi
+  800e09:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800e0b:	5b                   	pop    %ebx
+  800e0c:	5e                   	pop    %esi
+  800e0d:	5f                   	pop    %edi
+  800e0e:	5d                   	pop    %ebp
+  800e0f:	c3                   	ret
+
+00800e10 <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  800e10:	55                   	push   %ebp
+  800e11:	89 e5                	mov    %esp,%ebp
+  800e13:	57                   	push   %edi
+  800e14:	56                   	push   %esi
+  800e15:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e16:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e1b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e1e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e21:	b8 11 00 00 00       	mov    $0x11,%eax
+  800e26:	89 df                	mov    %ebx,%edi
+  800e28:	89 de                	mov    %ebx,%esi
+  800e2a:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800e2c:	5b                   	pop    %ebx
+  800e2d:	5e                   	pop    %esi
+  800e2e:	5f                   	pop    %edi
+  800e2f:	5d                   	pop    %ebp
+  800e30:	c3                   	ret
+
+00800e31 <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  800e31:	55                   	push   %ebp
+  800e32:	89 e5                	mov    %esp,%ebp
+  800e34:	57                   	push   %edi
+  800e35:	56                   	push   %esi
+  800e36:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e37:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e3c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e3f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e42:	b8 12 00 00 00       	mov    $0x12,%eax
+  800e47:	89 df                	mov    %ebx,%edi
+  800e49:	89 de                	mov    %ebx,%esi
+  800e4b:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800e4d:	5b                   	pop    %ebx
+  800e4e:	5e                   	pop    %esi
+  800e4f:	5f                   	pop    %edi
+  800e50:	5d                   	pop    %ebp
+  800e51:	c3                   	ret
+
+00800e52 <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  800e52:	55                   	push   %ebp
+  800e53:	89 e5                	mov    %esp,%ebp
+  800e55:	57                   	push   %edi
+  800e56:	56                   	push   %esi
+  800e57:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e58:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e5d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e60:	b8 13 00 00 00       	mov    $0x13,%eax
+  800e65:	89 cb                	mov    %ecx,%ebx
+  800e67:	89 cf                	mov    %ecx,%edi
+  800e69:	89 ce                	mov    %ecx,%esi
+  800e6b:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  800e6d:	5b                   	pop    %ebx
+  800e6e:	5e                   	pop    %esi
+  800e6f:	5f                   	pop    %edi
+  800e70:	5d                   	pop    %ebp
+  800e71:	c3                   	ret
+
+00800e72 <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  800e72:	55                   	push   %ebp
+  800e73:	89 e5                	mov    %esp,%ebp
+  800e75:	57                   	push   %edi
+  800e76:	56                   	push   %esi
+  800e77:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e78:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e7d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e80:	b8 14 00 00 00       	mov    $0x14,%eax
+  800e85:	89 cb                	mov    %ecx,%ebx
+  800e87:	89 cf                	mov    %ecx,%edi
+  800e89:	89 ce                	mov    %ecx,%esi
+  800e8b:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  800e8d:	5b                   	pop    %ebx
+  800e8e:	5e                   	pop    %esi
+  800e8f:	5f                   	pop    %edi
+  800e90:	5d                   	pop    %ebp
+  800e91:	c3                   	ret
+
+00800e92 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800e92:	55                   	push   %ebp
+  800e93:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800e95:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e98:	05 00 00 00 30       	add    $0x30000000,%eax
+  800e9d:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800ea0:	5d                   	pop    %ebp
+  800ea1:	c3                   	ret
+
+00800ea2 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800ea2:	55                   	push   %ebp
+  800ea3:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800ea5:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ea8:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800ead:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800eb2:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800eb7:	5d                   	pop    %ebp
+  800eb8:	c3                   	ret
+
+00800eb9 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800eb9:	55                   	push   %ebp
+  800eba:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  800ebc:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800ec1:	eb 02                	jmp    800ec5 <fd_alloc+0xc>
+  800ec3:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800ec5:	89 c2                	mov    %eax,%edx
+  800ec7:	c1 ea 16             	shr    $0x16,%edx
+  800eca:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800ed1:	f6 c2 01             	test   $0x1,%dl
+  800ed4:	74 2b                	je     800f01 <fd_alloc+0x48>
+  800ed6:	89 c2                	mov    %eax,%edx
+  800ed8:	c1 ea 0c             	shr    $0xc,%edx
+  800edb:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  800ee2:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  800ee8:	f6 c1 01             	test   $0x1,%cl
+  800eeb:	74 14                	je     800f01 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  800eed:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  800ef3:	75 ce                	jne    800ec3 <fd_alloc+0xa>
+  800ef5:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  800efa:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800eff:	eb 05                	jmp    800f06 <fd_alloc+0x4d>
+			return 0;
+  800f01:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  800f06:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f09:	89 02                	mov    %eax,(%edx)
+}
+  800f0b:	89 c8                	mov    %ecx,%eax
+  800f0d:	5d                   	pop    %ebp
+  800f0e:	c3                   	ret
+
+00800f0f <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  800f0f:	55                   	push   %ebp
+  800f10:	89 e5                	mov    %esp,%ebp
+  800f12:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  800f15:	83 f8 1f             	cmp    $0x1f,%eax
+  800f18:	77 30                	ja     800f4a <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  800f1a:	c1 e0 0c             	shl    $0xc,%eax
+  800f1d:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800f22:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  800f28:	f6 c2 01             	test   $0x1,%dl
+  800f2b:	74 24                	je     800f51 <fd_lookup+0x42>
+  800f2d:	89 c2                	mov    %eax,%edx
+  800f2f:	c1 ea 0c             	shr    $0xc,%edx
+  800f32:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800f39:	f6 c2 01             	test   $0x1,%dl
+  800f3c:	74 1a                	je     800f58 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  800f3e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800f41:	89 02                	mov    %eax,(%edx)
+	return 0;
+  800f43:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f48:	5d                   	pop    %ebp
+  800f49:	c3                   	ret
+		return -E_INVAL;
+  800f4a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f4f:	eb f7                	jmp    800f48 <fd_lookup+0x39>
+		return -E_INVAL;
+  800f51:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f56:	eb f0                	jmp    800f48 <fd_lookup+0x39>
+  800f58:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f5d:	eb e9                	jmp    800f48 <fd_lookup+0x39>
+
+00800f5f <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  800f5f:	55                   	push   %ebp
+  800f60:	89 e5                	mov    %esp,%ebp
+  800f62:	53                   	push   %ebx
+  800f63:	83 ec 04             	sub    $0x4,%esp
+  800f66:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  800f69:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f6e:	eb 03                	jmp    800f73 <dev_lookup+0x14>
+  800f70:	83 c0 01             	add    $0x1,%eax
+  800f73:	8b 1c 85 2c 2a 80 00 	mov    0x802a2c(,%eax,4),%ebx
+  800f7a:	85 db                	test   %ebx,%ebx
+  800f7c:	74 0b                	je     800f89 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  800f7e:	39 13                	cmp    %edx,(%ebx)
+  800f80:	75 ee                	jne    800f70 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  800f82:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f87:	eb 1f                	jmp    800fa8 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800f89:	a1 20 40 c0 00       	mov    0xc04020,%eax
+  800f8e:	8b 40 48             	mov    0x48(%eax),%eax
+  800f91:	83 ec 04             	sub    $0x4,%esp
+  800f94:	52                   	push   %edx
+  800f95:	50                   	push   %eax
+  800f96:	68 b0 29 80 00       	push   $0x8029b0
+  800f9b:	e8 7a f2 ff ff       	call   80021a <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  800fa0:	83 c4 10             	add    $0x10,%esp
+  800fa3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  800fa8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800fab:	89 1a                	mov    %ebx,(%edx)
+}
+  800fad:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800fb0:	c9                   	leave
+  800fb1:	c3                   	ret
+
+00800fb2 <fd_close>:
+{
+  800fb2:	55                   	push   %ebp
+  800fb3:	89 e5                	mov    %esp,%ebp
+  800fb5:	57                   	push   %edi
+  800fb6:	56                   	push   %esi
+  800fb7:	53                   	push   %ebx
+  800fb8:	83 ec 24             	sub    $0x24,%esp
+  800fbb:	8b 75 08             	mov    0x8(%ebp),%esi
+  800fbe:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800fc1:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800fc4:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800fc5:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800fcb:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800fce:	50                   	push   %eax
+  800fcf:	e8 3b ff ff ff       	call   800f0f <fd_lookup>
+  800fd4:	89 c3                	mov    %eax,%ebx
+  800fd6:	83 c4 10             	add    $0x10,%esp
+  800fd9:	85 c0                	test   %eax,%eax
+  800fdb:	78 05                	js     800fe2 <fd_close+0x30>
+	    || fd != fd2)
+  800fdd:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  800fe0:	74 16                	je     800ff8 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  800fe2:	89 f8                	mov    %edi,%eax
+  800fe4:	84 c0                	test   %al,%al
+  800fe6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800feb:	0f 44 d8             	cmove  %eax,%ebx
+}
+  800fee:	89 d8                	mov    %ebx,%eax
+  800ff0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ff3:	5b                   	pop    %ebx
+  800ff4:	5e                   	pop    %esi
+  800ff5:	5f                   	pop    %edi
+  800ff6:	5d                   	pop    %ebp
+  800ff7:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800ff8:	83 ec 08             	sub    $0x8,%esp
+  800ffb:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800ffe:	50                   	push   %eax
+  800fff:	ff 36                	push   (%esi)
+  801001:	e8 59 ff ff ff       	call   800f5f <dev_lookup>
+  801006:	89 c3                	mov    %eax,%ebx
+  801008:	83 c4 10             	add    $0x10,%esp
+  80100b:	85 c0                	test   %eax,%eax
+  80100d:	78 1a                	js     801029 <fd_close+0x77>
+		if (dev->dev_close)
+  80100f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801012:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801015:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80101a:	85 c0                	test   %eax,%eax
+  80101c:	74 0b                	je     801029 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80101e:	83 ec 0c             	sub    $0xc,%esp
+  801021:	56                   	push   %esi
+  801022:	ff d0                	call   *%eax
+  801024:	89 c3                	mov    %eax,%ebx
+  801026:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801029:	83 ec 08             	sub    $0x8,%esp
+  80102c:	56                   	push   %esi
+  80102d:	6a 00                	push   $0x0
+  80102f:	e8 10 fc ff ff       	call   800c44 <sys_page_unmap>
+	return r;
+  801034:	83 c4 10             	add    $0x10,%esp
+  801037:	eb b5                	jmp    800fee <fd_close+0x3c>
+
+00801039 <close>:
+
+int
+close(int fdnum)
+{
+  801039:	55                   	push   %ebp
+  80103a:	89 e5                	mov    %esp,%ebp
+  80103c:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80103f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801042:	50                   	push   %eax
+  801043:	ff 75 08             	push   0x8(%ebp)
+  801046:	e8 c4 fe ff ff       	call   800f0f <fd_lookup>
+  80104b:	83 c4 10             	add    $0x10,%esp
+  80104e:	85 c0                	test   %eax,%eax
+  801050:	79 02                	jns    801054 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801052:	c9                   	leave
+  801053:	c3                   	ret
+		return fd_close(fd, 1);
+  801054:	83 ec 08             	sub    $0x8,%esp
+  801057:	6a 01                	push   $0x1
+  801059:	ff 75 f4             	push   -0xc(%ebp)
+  80105c:	e8 51 ff ff ff       	call   800fb2 <fd_close>
+  801061:	83 c4 10             	add    $0x10,%esp
+  801064:	eb ec                	jmp    801052 <close+0x19>
+
+00801066 <close_all>:
+
+void
+close_all(void)
+{
+  801066:	55                   	push   %ebp
+  801067:	89 e5                	mov    %esp,%ebp
+  801069:	53                   	push   %ebx
+  80106a:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80106d:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801072:	83 ec 0c             	sub    $0xc,%esp
+  801075:	53                   	push   %ebx
+  801076:	e8 be ff ff ff       	call   801039 <close>
+	for (i = 0; i < MAXFD; i++)
+  80107b:	83 c3 01             	add    $0x1,%ebx
+  80107e:	83 c4 10             	add    $0x10,%esp
+  801081:	83 fb 20             	cmp    $0x20,%ebx
+  801084:	75 ec                	jne    801072 <close_all+0xc>
+}
+  801086:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801089:	c9                   	leave
+  80108a:	c3                   	ret
+
+0080108b <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80108b:	55                   	push   %ebp
+  80108c:	89 e5                	mov    %esp,%ebp
+  80108e:	57                   	push   %edi
+  80108f:	56                   	push   %esi
+  801090:	53                   	push   %ebx
+  801091:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801094:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801097:	50                   	push   %eax
+  801098:	ff 75 08             	push   0x8(%ebp)
+  80109b:	e8 6f fe ff ff       	call   800f0f <fd_lookup>
+  8010a0:	89 c3                	mov    %eax,%ebx
+  8010a2:	83 c4 10             	add    $0x10,%esp
+  8010a5:	85 c0                	test   %eax,%eax
+  8010a7:	78 7f                	js     801128 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8010a9:	83 ec 0c             	sub    $0xc,%esp
+  8010ac:	ff 75 0c             	push   0xc(%ebp)
+  8010af:	e8 85 ff ff ff       	call   801039 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8010b4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8010b7:	c1 e6 0c             	shl    $0xc,%esi
+  8010ba:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8010c0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8010c3:	89 3c 24             	mov    %edi,(%esp)
+  8010c6:	e8 d7 fd ff ff       	call   800ea2 <fd2data>
+  8010cb:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8010cd:	89 34 24             	mov    %esi,(%esp)
+  8010d0:	e8 cd fd ff ff       	call   800ea2 <fd2data>
+  8010d5:	83 c4 10             	add    $0x10,%esp
+  8010d8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8010db:	89 d8                	mov    %ebx,%eax
+  8010dd:	c1 e8 16             	shr    $0x16,%eax
+  8010e0:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8010e7:	a8 01                	test   $0x1,%al
+  8010e9:	74 11                	je     8010fc <dup+0x71>
+  8010eb:	89 d8                	mov    %ebx,%eax
+  8010ed:	c1 e8 0c             	shr    $0xc,%eax
+  8010f0:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8010f7:	f6 c2 01             	test   $0x1,%dl
+  8010fa:	75 36                	jne    801132 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8010fc:	89 f8                	mov    %edi,%eax
+  8010fe:	c1 e8 0c             	shr    $0xc,%eax
+  801101:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801108:	83 ec 0c             	sub    $0xc,%esp
+  80110b:	25 07 0e 00 00       	and    $0xe07,%eax
+  801110:	50                   	push   %eax
+  801111:	56                   	push   %esi
+  801112:	6a 00                	push   $0x0
+  801114:	57                   	push   %edi
+  801115:	6a 00                	push   $0x0
+  801117:	e8 e6 fa ff ff       	call   800c02 <sys_page_map>
+  80111c:	89 c3                	mov    %eax,%ebx
+  80111e:	83 c4 20             	add    $0x20,%esp
+  801121:	85 c0                	test   %eax,%eax
+  801123:	78 33                	js     801158 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801125:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801128:	89 d8                	mov    %ebx,%eax
+  80112a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80112d:	5b                   	pop    %ebx
+  80112e:	5e                   	pop    %esi
+  80112f:	5f                   	pop    %edi
+  801130:	5d                   	pop    %ebp
+  801131:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801132:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801139:	83 ec 0c             	sub    $0xc,%esp
+  80113c:	25 07 0e 00 00       	and    $0xe07,%eax
+  801141:	50                   	push   %eax
+  801142:	ff 75 d4             	push   -0x2c(%ebp)
+  801145:	6a 00                	push   $0x0
+  801147:	53                   	push   %ebx
+  801148:	6a 00                	push   $0x0
+  80114a:	e8 b3 fa ff ff       	call   800c02 <sys_page_map>
+  80114f:	89 c3                	mov    %eax,%ebx
+  801151:	83 c4 20             	add    $0x20,%esp
+  801154:	85 c0                	test   %eax,%eax
+  801156:	79 a4                	jns    8010fc <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801158:	83 ec 08             	sub    $0x8,%esp
+  80115b:	56                   	push   %esi
+  80115c:	6a 00                	push   $0x0
+  80115e:	e8 e1 fa ff ff       	call   800c44 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801163:	83 c4 08             	add    $0x8,%esp
+  801166:	ff 75 d4             	push   -0x2c(%ebp)
+  801169:	6a 00                	push   $0x0
+  80116b:	e8 d4 fa ff ff       	call   800c44 <sys_page_unmap>
+	return r;
+  801170:	83 c4 10             	add    $0x10,%esp
+  801173:	eb b3                	jmp    801128 <dup+0x9d>
+
+00801175 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801175:	55                   	push   %ebp
+  801176:	89 e5                	mov    %esp,%ebp
+  801178:	56                   	push   %esi
+  801179:	53                   	push   %ebx
+  80117a:	83 ec 18             	sub    $0x18,%esp
+  80117d:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801180:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801183:	50                   	push   %eax
+  801184:	56                   	push   %esi
+  801185:	e8 85 fd ff ff       	call   800f0f <fd_lookup>
+  80118a:	83 c4 10             	add    $0x10,%esp
+  80118d:	85 c0                	test   %eax,%eax
+  80118f:	78 3c                	js     8011cd <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801191:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801194:	83 ec 08             	sub    $0x8,%esp
+  801197:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80119a:	50                   	push   %eax
+  80119b:	ff 33                	push   (%ebx)
+  80119d:	e8 bd fd ff ff       	call   800f5f <dev_lookup>
+  8011a2:	83 c4 10             	add    $0x10,%esp
+  8011a5:	85 c0                	test   %eax,%eax
+  8011a7:	78 24                	js     8011cd <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8011a9:	8b 43 08             	mov    0x8(%ebx),%eax
+  8011ac:	83 e0 03             	and    $0x3,%eax
+  8011af:	83 f8 01             	cmp    $0x1,%eax
+  8011b2:	74 20                	je     8011d4 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8011b4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8011b7:	8b 40 08             	mov    0x8(%eax),%eax
+  8011ba:	85 c0                	test   %eax,%eax
+  8011bc:	74 37                	je     8011f5 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8011be:	83 ec 04             	sub    $0x4,%esp
+  8011c1:	ff 75 10             	push   0x10(%ebp)
+  8011c4:	ff 75 0c             	push   0xc(%ebp)
+  8011c7:	53                   	push   %ebx
+  8011c8:	ff d0                	call   *%eax
+  8011ca:	83 c4 10             	add    $0x10,%esp
+}
+  8011cd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8011d0:	5b                   	pop    %ebx
+  8011d1:	5e                   	pop    %esi
+  8011d2:	5d                   	pop    %ebp
+  8011d3:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8011d4:	a1 20 40 c0 00       	mov    0xc04020,%eax
+  8011d9:	8b 40 48             	mov    0x48(%eax),%eax
+  8011dc:	83 ec 04             	sub    $0x4,%esp
+  8011df:	56                   	push   %esi
+  8011e0:	50                   	push   %eax
+  8011e1:	68 f1 29 80 00       	push   $0x8029f1
+  8011e6:	e8 2f f0 ff ff       	call   80021a <cprintf>
+		return -E_INVAL;
+  8011eb:	83 c4 10             	add    $0x10,%esp
+  8011ee:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011f3:	eb d8                	jmp    8011cd <read+0x58>
+		return -E_NOT_SUPP;
+  8011f5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8011fa:	eb d1                	jmp    8011cd <read+0x58>
+
+008011fc <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8011fc:	55                   	push   %ebp
+  8011fd:	89 e5                	mov    %esp,%ebp
+  8011ff:	57                   	push   %edi
+  801200:	56                   	push   %esi
+  801201:	53                   	push   %ebx
+  801202:	83 ec 0c             	sub    $0xc,%esp
+  801205:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801208:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80120b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801210:	eb 02                	jmp    801214 <readn+0x18>
+  801212:	01 c3                	add    %eax,%ebx
+  801214:	39 f3                	cmp    %esi,%ebx
+  801216:	73 21                	jae    801239 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801218:	83 ec 04             	sub    $0x4,%esp
+  80121b:	89 f0                	mov    %esi,%eax
+  80121d:	29 d8                	sub    %ebx,%eax
+  80121f:	50                   	push   %eax
+  801220:	89 d8                	mov    %ebx,%eax
+  801222:	03 45 0c             	add    0xc(%ebp),%eax
+  801225:	50                   	push   %eax
+  801226:	57                   	push   %edi
+  801227:	e8 49 ff ff ff       	call   801175 <read>
+		if (m < 0)
+  80122c:	83 c4 10             	add    $0x10,%esp
+  80122f:	85 c0                	test   %eax,%eax
+  801231:	78 04                	js     801237 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801233:	75 dd                	jne    801212 <readn+0x16>
+  801235:	eb 02                	jmp    801239 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801237:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801239:	89 d8                	mov    %ebx,%eax
+  80123b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80123e:	5b                   	pop    %ebx
+  80123f:	5e                   	pop    %esi
+  801240:	5f                   	pop    %edi
+  801241:	5d                   	pop    %ebp
+  801242:	c3                   	ret
+
+00801243 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801243:	55                   	push   %ebp
+  801244:	89 e5                	mov    %esp,%ebp
+  801246:	56                   	push   %esi
+  801247:	53                   	push   %ebx
+  801248:	83 ec 18             	sub    $0x18,%esp
+  80124b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80124e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801251:	50                   	push   %eax
+  801252:	53                   	push   %ebx
+  801253:	e8 b7 fc ff ff       	call   800f0f <fd_lookup>
+  801258:	83 c4 10             	add    $0x10,%esp
+  80125b:	85 c0                	test   %eax,%eax
+  80125d:	78 37                	js     801296 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80125f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801262:	83 ec 08             	sub    $0x8,%esp
+  801265:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801268:	50                   	push   %eax
+  801269:	ff 36                	push   (%esi)
+  80126b:	e8 ef fc ff ff       	call   800f5f <dev_lookup>
+  801270:	83 c4 10             	add    $0x10,%esp
+  801273:	85 c0                	test   %eax,%eax
+  801275:	78 1f                	js     801296 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801277:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80127b:	74 20                	je     80129d <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80127d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801280:	8b 40 0c             	mov    0xc(%eax),%eax
+  801283:	85 c0                	test   %eax,%eax
+  801285:	74 37                	je     8012be <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801287:	83 ec 04             	sub    $0x4,%esp
+  80128a:	ff 75 10             	push   0x10(%ebp)
+  80128d:	ff 75 0c             	push   0xc(%ebp)
+  801290:	56                   	push   %esi
+  801291:	ff d0                	call   *%eax
+  801293:	83 c4 10             	add    $0x10,%esp
+}
+  801296:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801299:	5b                   	pop    %ebx
+  80129a:	5e                   	pop    %esi
+  80129b:	5d                   	pop    %ebp
+  80129c:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80129d:	a1 20 40 c0 00       	mov    0xc04020,%eax
+  8012a2:	8b 40 48             	mov    0x48(%eax),%eax
+  8012a5:	83 ec 04             	sub    $0x4,%esp
+  8012a8:	53                   	push   %ebx
+  8012a9:	50                   	push   %eax
+  8012aa:	68 0d 2a 80 00       	push   $0x802a0d
+  8012af:	e8 66 ef ff ff       	call   80021a <cprintf>
+		return -E_INVAL;
+  8012b4:	83 c4 10             	add    $0x10,%esp
+  8012b7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012bc:	eb d8                	jmp    801296 <write+0x53>
+		return -E_NOT_SUPP;
+  8012be:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8012c3:	eb d1                	jmp    801296 <write+0x53>
+
+008012c5 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8012c5:	55                   	push   %ebp
+  8012c6:	89 e5                	mov    %esp,%ebp
+  8012c8:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8012cb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8012ce:	50                   	push   %eax
+  8012cf:	ff 75 08             	push   0x8(%ebp)
+  8012d2:	e8 38 fc ff ff       	call   800f0f <fd_lookup>
+  8012d7:	83 c4 10             	add    $0x10,%esp
+  8012da:	85 c0                	test   %eax,%eax
+  8012dc:	78 0e                	js     8012ec <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8012de:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012e1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8012e4:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8012e7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8012ec:	c9                   	leave
+  8012ed:	c3                   	ret
+
+008012ee <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8012ee:	55                   	push   %ebp
+  8012ef:	89 e5                	mov    %esp,%ebp
+  8012f1:	56                   	push   %esi
+  8012f2:	53                   	push   %ebx
+  8012f3:	83 ec 18             	sub    $0x18,%esp
+  8012f6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8012f9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8012fc:	50                   	push   %eax
+  8012fd:	53                   	push   %ebx
+  8012fe:	e8 0c fc ff ff       	call   800f0f <fd_lookup>
+  801303:	83 c4 10             	add    $0x10,%esp
+  801306:	85 c0                	test   %eax,%eax
+  801308:	78 34                	js     80133e <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80130a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80130d:	83 ec 08             	sub    $0x8,%esp
+  801310:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801313:	50                   	push   %eax
+  801314:	ff 36                	push   (%esi)
+  801316:	e8 44 fc ff ff       	call   800f5f <dev_lookup>
+  80131b:	83 c4 10             	add    $0x10,%esp
+  80131e:	85 c0                	test   %eax,%eax
+  801320:	78 1c                	js     80133e <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801322:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801326:	74 1d                	je     801345 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801328:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80132b:	8b 40 18             	mov    0x18(%eax),%eax
+  80132e:	85 c0                	test   %eax,%eax
+  801330:	74 34                	je     801366 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801332:	83 ec 08             	sub    $0x8,%esp
+  801335:	ff 75 0c             	push   0xc(%ebp)
+  801338:	56                   	push   %esi
+  801339:	ff d0                	call   *%eax
+  80133b:	83 c4 10             	add    $0x10,%esp
+}
+  80133e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801341:	5b                   	pop    %ebx
+  801342:	5e                   	pop    %esi
+  801343:	5d                   	pop    %ebp
+  801344:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801345:	a1 20 40 c0 00       	mov    0xc04020,%eax
+  80134a:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80134d:	83 ec 04             	sub    $0x4,%esp
+  801350:	53                   	push   %ebx
+  801351:	50                   	push   %eax
+  801352:	68 d0 29 80 00       	push   $0x8029d0
+  801357:	e8 be ee ff ff       	call   80021a <cprintf>
+		return -E_INVAL;
+  80135c:	83 c4 10             	add    $0x10,%esp
+  80135f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801364:	eb d8                	jmp    80133e <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801366:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80136b:	eb d1                	jmp    80133e <ftruncate+0x50>
+
+0080136d <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80136d:	55                   	push   %ebp
+  80136e:	89 e5                	mov    %esp,%ebp
+  801370:	56                   	push   %esi
+  801371:	53                   	push   %ebx
+  801372:	83 ec 18             	sub    $0x18,%esp
+  801375:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801378:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80137b:	50                   	push   %eax
+  80137c:	ff 75 08             	push   0x8(%ebp)
+  80137f:	e8 8b fb ff ff       	call   800f0f <fd_lookup>
+  801384:	83 c4 10             	add    $0x10,%esp
+  801387:	85 c0                	test   %eax,%eax
+  801389:	78 49                	js     8013d4 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80138b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80138e:	83 ec 08             	sub    $0x8,%esp
+  801391:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801394:	50                   	push   %eax
+  801395:	ff 36                	push   (%esi)
+  801397:	e8 c3 fb ff ff       	call   800f5f <dev_lookup>
+  80139c:	83 c4 10             	add    $0x10,%esp
+  80139f:	85 c0                	test   %eax,%eax
+  8013a1:	78 31                	js     8013d4 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8013a3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013a6:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8013aa:	74 2f                	je     8013db <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8013ac:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8013af:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8013b6:	00 00 00 
+	stat->st_isdir = 0;
+  8013b9:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8013c0:	00 00 00 
+	stat->st_dev = dev;
+  8013c3:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8013c9:	83 ec 08             	sub    $0x8,%esp
+  8013cc:	53                   	push   %ebx
+  8013cd:	56                   	push   %esi
+  8013ce:	ff 50 14             	call   *0x14(%eax)
+  8013d1:	83 c4 10             	add    $0x10,%esp
+}
+  8013d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013d7:	5b                   	pop    %ebx
+  8013d8:	5e                   	pop    %esi
+  8013d9:	5d                   	pop    %ebp
+  8013da:	c3                   	ret
+		return -E_NOT_SUPP;
+  8013db:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8013e0:	eb f2                	jmp    8013d4 <fstat+0x67>
+
+008013e2 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8013e2:	55                   	push   %ebp
+  8013e3:	89 e5                	mov    %esp,%ebp
+  8013e5:	56                   	push   %esi
+  8013e6:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8013e7:	83 ec 08             	sub    $0x8,%esp
+  8013ea:	6a 00                	push   $0x0
+  8013ec:	ff 75 08             	push   0x8(%ebp)
+  8013ef:	e8 e4 01 00 00       	call   8015d8 <open>
+  8013f4:	89 c3                	mov    %eax,%ebx
+  8013f6:	83 c4 10             	add    $0x10,%esp
+  8013f9:	85 c0                	test   %eax,%eax
+  8013fb:	78 1b                	js     801418 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8013fd:	83 ec 08             	sub    $0x8,%esp
+  801400:	ff 75 0c             	push   0xc(%ebp)
+  801403:	50                   	push   %eax
+  801404:	e8 64 ff ff ff       	call   80136d <fstat>
+  801409:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80140b:	89 1c 24             	mov    %ebx,(%esp)
+  80140e:	e8 26 fc ff ff       	call   801039 <close>
+	return r;
+  801413:	83 c4 10             	add    $0x10,%esp
+  801416:	89 f3                	mov    %esi,%ebx
+}
+  801418:	89 d8                	mov    %ebx,%eax
+  80141a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80141d:	5b                   	pop    %ebx
+  80141e:	5e                   	pop    %esi
+  80141f:	5d                   	pop    %ebp
+  801420:	c3                   	ret
+
+00801421 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  801421:	55                   	push   %ebp
+  801422:	89 e5                	mov    %esp,%ebp
+  801424:	56                   	push   %esi
+  801425:	53                   	push   %ebx
+  801426:	89 c6                	mov    %eax,%esi
+  801428:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  80142a:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  801431:	74 27                	je     80145a <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801433:	6a 07                	push   $0x7
+  801435:	68 00 50 c0 00       	push   $0xc05000
+  80143a:	56                   	push   %esi
+  80143b:	ff 35 00 40 80 00    	push   0x804000
+  801441:	e8 d1 0b 00 00       	call   802017 <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  801446:	83 c4 0c             	add    $0xc,%esp
+  801449:	6a 00                	push   $0x0
+  80144b:	53                   	push   %ebx
+  80144c:	6a 00                	push   $0x0
+  80144e:	e8 50 0b 00 00       	call   801fa3 <ipc_recv>
+}
+  801453:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801456:	5b                   	pop    %ebx
+  801457:	5e                   	pop    %esi
+  801458:	5d                   	pop    %ebp
+  801459:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  80145a:	83 ec 0c             	sub    $0xc,%esp
+  80145d:	6a 01                	push   $0x1
+  80145f:	e8 07 0c 00 00       	call   80206b <ipc_find_env>
+  801464:	a3 00 40 80 00       	mov    %eax,0x804000
+  801469:	83 c4 10             	add    $0x10,%esp
+  80146c:	eb c5                	jmp    801433 <fsipc+0x12>
+
+0080146e <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80146e:	55                   	push   %ebp
+  80146f:	89 e5                	mov    %esp,%ebp
+  801471:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801474:	8b 45 08             	mov    0x8(%ebp),%eax
+  801477:	8b 40 0c             	mov    0xc(%eax),%eax
+  80147a:	a3 00 50 c0 00       	mov    %eax,0xc05000
+  fsipcbuf.set_size.req_size = newsize;
+  80147f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801482:	a3 04 50 c0 00       	mov    %eax,0xc05004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801487:	ba 00 00 00 00       	mov    $0x0,%edx
+  80148c:	b8 02 00 00 00       	mov    $0x2,%eax
+  801491:	e8 8b ff ff ff       	call   801421 <fsipc>
+}
+  801496:	c9                   	leave
+  801497:	c3                   	ret
+
+00801498 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801498:	55                   	push   %ebp
+  801499:	89 e5                	mov    %esp,%ebp
+  80149b:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80149e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014a1:	8b 40 0c             	mov    0xc(%eax),%eax
+  8014a4:	a3 00 50 c0 00       	mov    %eax,0xc05000
+  return fsipc(FSREQ_FLUSH, NULL);
+  8014a9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014ae:	b8 06 00 00 00       	mov    $0x6,%eax
+  8014b3:	e8 69 ff ff ff       	call   801421 <fsipc>
+}
+  8014b8:	c9                   	leave
+  8014b9:	c3                   	ret
+
+008014ba <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8014ba:	55                   	push   %ebp
+  8014bb:	89 e5                	mov    %esp,%ebp
+  8014bd:	53                   	push   %ebx
+  8014be:	83 ec 04             	sub    $0x4,%esp
+  8014c1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8014c4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014c7:	8b 40 0c             	mov    0xc(%eax),%eax
+  8014ca:	a3 00 50 c0 00       	mov    %eax,0xc05000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8014cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014d4:	b8 05 00 00 00       	mov    $0x5,%eax
+  8014d9:	e8 43 ff ff ff       	call   801421 <fsipc>
+  8014de:	85 c0                	test   %eax,%eax
+  8014e0:	78 2c                	js     80150e <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8014e2:	83 ec 08             	sub    $0x8,%esp
+  8014e5:	68 00 50 c0 00       	push   $0xc05000
+  8014ea:	53                   	push   %ebx
+  8014eb:	e8 e3 f2 ff ff       	call   8007d3 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  8014f0:	a1 80 50 c0 00       	mov    0xc05080,%eax
+  8014f5:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8014fb:	a1 84 50 c0 00       	mov    0xc05084,%eax
+  801500:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801506:	83 c4 10             	add    $0x10,%esp
+  801509:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80150e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801511:	c9                   	leave
+  801512:	c3                   	ret
+
+00801513 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801513:	55                   	push   %ebp
+  801514:	89 e5                	mov    %esp,%ebp
+  801516:	83 ec 0c             	sub    $0xc,%esp
+  801519:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80151c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80151f:	8b 52 0c             	mov    0xc(%edx),%edx
+  801522:	89 15 00 50 c0 00    	mov    %edx,0xc05000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801528:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  80152d:	39 d0                	cmp    %edx,%eax
+  80152f:	0f 47 c2             	cmova  %edx,%eax
+  801532:	a3 04 50 c0 00       	mov    %eax,0xc05004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  801537:	50                   	push   %eax
+  801538:	ff 75 0c             	push   0xc(%ebp)
+  80153b:	68 08 50 c0 00       	push   $0xc05008
+  801540:	e8 14 f4 ff ff       	call   800959 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801545:	ba 00 00 00 00       	mov    $0x0,%edx
+  80154a:	b8 04 00 00 00       	mov    $0x4,%eax
+  80154f:	e8 cd fe ff ff       	call   801421 <fsipc>
+}
+  801554:	c9                   	leave
+  801555:	c3                   	ret
+
+00801556 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801556:	55                   	push   %ebp
+  801557:	89 e5                	mov    %esp,%ebp
+  801559:	56                   	push   %esi
+  80155a:	53                   	push   %ebx
+  80155b:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80155e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801561:	8b 40 0c             	mov    0xc(%eax),%eax
+  801564:	a3 00 50 c0 00       	mov    %eax,0xc05000
+  fsipcbuf.read.req_n = n;
+  801569:	89 35 04 50 c0 00    	mov    %esi,0xc05004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  80156f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801574:	b8 03 00 00 00       	mov    $0x3,%eax
+  801579:	e8 a3 fe ff ff       	call   801421 <fsipc>
+  80157e:	89 c3                	mov    %eax,%ebx
+  801580:	85 c0                	test   %eax,%eax
+  801582:	78 1f                	js     8015a3 <devfile_read+0x4d>
+  assert(r <= n);
+  801584:	39 c6                	cmp    %eax,%esi
+  801586:	72 24                	jb     8015ac <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  801588:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80158d:	7f 33                	jg     8015c2 <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80158f:	83 ec 04             	sub    $0x4,%esp
+  801592:	50                   	push   %eax
+  801593:	68 00 50 c0 00       	push   $0xc05000
+  801598:	ff 75 0c             	push   0xc(%ebp)
+  80159b:	e8 b9 f3 ff ff       	call   800959 <memmove>
+  return r;
+  8015a0:	83 c4 10             	add    $0x10,%esp
+}
+  8015a3:	89 d8                	mov    %ebx,%eax
+  8015a5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015a8:	5b                   	pop    %ebx
+  8015a9:	5e                   	pop    %esi
+  8015aa:	5d                   	pop    %ebp
+  8015ab:	c3                   	ret
+  assert(r <= n);
+  8015ac:	68 40 2a 80 00       	push   $0x802a40
+  8015b1:	68 47 2a 80 00       	push   $0x802a47
+  8015b6:	6a 78                	push   $0x78
+  8015b8:	68 5c 2a 80 00       	push   $0x802a5c
+  8015bd:	e8 7d eb ff ff       	call   80013f <_panic>
+  assert(r <= PGSIZE);
+  8015c2:	68 67 2a 80 00       	push   $0x802a67
+  8015c7:	68 47 2a 80 00       	push   $0x802a47
+  8015cc:	6a 79                	push   $0x79
+  8015ce:	68 5c 2a 80 00       	push   $0x802a5c
+  8015d3:	e8 67 eb ff ff       	call   80013f <_panic>
+
+008015d8 <open>:
+open(const char *path, int mode) {
+  8015d8:	55                   	push   %ebp
+  8015d9:	89 e5                	mov    %esp,%ebp
+  8015db:	56                   	push   %esi
+  8015dc:	53                   	push   %ebx
+  8015dd:	83 ec 1c             	sub    $0x1c,%esp
+  8015e0:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  8015e3:	56                   	push   %esi
+  8015e4:	e8 af f1 ff ff       	call   800798 <strlen>
+  8015e9:	83 c4 10             	add    $0x10,%esp
+  8015ec:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8015f1:	7f 6c                	jg     80165f <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  8015f3:	83 ec 0c             	sub    $0xc,%esp
+  8015f6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015f9:	50                   	push   %eax
+  8015fa:	e8 ba f8 ff ff       	call   800eb9 <fd_alloc>
+  8015ff:	89 c3                	mov    %eax,%ebx
+  801601:	83 c4 10             	add    $0x10,%esp
+  801604:	85 c0                	test   %eax,%eax
+  801606:	78 3c                	js     801644 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801608:	83 ec 08             	sub    $0x8,%esp
+  80160b:	56                   	push   %esi
+  80160c:	68 00 50 c0 00       	push   $0xc05000
+  801611:	e8 bd f1 ff ff       	call   8007d3 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801616:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801619:	a3 00 54 c0 00       	mov    %eax,0xc05400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80161e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801621:	b8 01 00 00 00       	mov    $0x1,%eax
+  801626:	e8 f6 fd ff ff       	call   801421 <fsipc>
+  80162b:	89 c3                	mov    %eax,%ebx
+  80162d:	83 c4 10             	add    $0x10,%esp
+  801630:	85 c0                	test   %eax,%eax
+  801632:	78 19                	js     80164d <open+0x75>
+  return fd2num(fd);
+  801634:	83 ec 0c             	sub    $0xc,%esp
+  801637:	ff 75 f4             	push   -0xc(%ebp)
+  80163a:	e8 53 f8 ff ff       	call   800e92 <fd2num>
+  80163f:	89 c3                	mov    %eax,%ebx
+  801641:	83 c4 10             	add    $0x10,%esp
+}
+  801644:	89 d8                	mov    %ebx,%eax
+  801646:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801649:	5b                   	pop    %ebx
+  80164a:	5e                   	pop    %esi
+  80164b:	5d                   	pop    %ebp
+  80164c:	c3                   	ret
+    fd_close(fd, 0);
+  80164d:	83 ec 08             	sub    $0x8,%esp
+  801650:	6a 00                	push   $0x0
+  801652:	ff 75 f4             	push   -0xc(%ebp)
+  801655:	e8 58 f9 ff ff       	call   800fb2 <fd_close>
+    return r;
+  80165a:	83 c4 10             	add    $0x10,%esp
+  80165d:	eb e5                	jmp    801644 <open+0x6c>
+    return -E_BAD_PATH;
+  80165f:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801664:	eb de                	jmp    801644 <open+0x6c>
+
+00801666 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  801666:	55                   	push   %ebp
+  801667:	89 e5                	mov    %esp,%ebp
+  801669:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  80166c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801671:	b8 08 00 00 00       	mov    $0x8,%eax
+  801676:	e8 a6 fd ff ff       	call   801421 <fsipc>
+}
+  80167b:	c9                   	leave
+  80167c:	c3                   	ret
+
+0080167d <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80167d:	55                   	push   %ebp
+  80167e:	89 e5                	mov    %esp,%ebp
+  801680:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801683:	68 73 2a 80 00       	push   $0x802a73
+  801688:	ff 75 0c             	push   0xc(%ebp)
+  80168b:	e8 43 f1 ff ff       	call   8007d3 <strcpy>
+	return 0;
+}
+  801690:	b8 00 00 00 00       	mov    $0x0,%eax
+  801695:	c9                   	leave
+  801696:	c3                   	ret
+
+00801697 <devsock_close>:
+{
+  801697:	55                   	push   %ebp
+  801698:	89 e5                	mov    %esp,%ebp
+  80169a:	53                   	push   %ebx
+  80169b:	83 ec 10             	sub    $0x10,%esp
+  80169e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8016a1:	53                   	push   %ebx
+  8016a2:	e8 03 0a 00 00       	call   8020aa <pageref>
+  8016a7:	89 c2                	mov    %eax,%edx
+  8016a9:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8016ac:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8016b1:	83 fa 01             	cmp    $0x1,%edx
+  8016b4:	74 05                	je     8016bb <devsock_close+0x24>
+}
+  8016b6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016b9:	c9                   	leave
+  8016ba:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8016bb:	83 ec 0c             	sub    $0xc,%esp
+  8016be:	ff 73 0c             	push   0xc(%ebx)
+  8016c1:	e8 b7 02 00 00       	call   80197d <nsipc_close>
+  8016c6:	83 c4 10             	add    $0x10,%esp
+  8016c9:	eb eb                	jmp    8016b6 <devsock_close+0x1f>
+
+008016cb <devsock_write>:
+{
+  8016cb:	55                   	push   %ebp
+  8016cc:	89 e5                	mov    %esp,%ebp
+  8016ce:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8016d1:	6a 00                	push   $0x0
+  8016d3:	ff 75 10             	push   0x10(%ebp)
+  8016d6:	ff 75 0c             	push   0xc(%ebp)
+  8016d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016dc:	ff 70 0c             	push   0xc(%eax)
+  8016df:	e8 79 03 00 00       	call   801a5d <nsipc_send>
+}
+  8016e4:	c9                   	leave
+  8016e5:	c3                   	ret
+
+008016e6 <devsock_read>:
+{
+  8016e6:	55                   	push   %ebp
+  8016e7:	89 e5                	mov    %esp,%ebp
+  8016e9:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8016ec:	6a 00                	push   $0x0
+  8016ee:	ff 75 10             	push   0x10(%ebp)
+  8016f1:	ff 75 0c             	push   0xc(%ebp)
+  8016f4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016f7:	ff 70 0c             	push   0xc(%eax)
+  8016fa:	e8 ef 02 00 00       	call   8019ee <nsipc_recv>
+}
+  8016ff:	c9                   	leave
+  801700:	c3                   	ret
+
+00801701 <fd2sockid>:
+{
+  801701:	55                   	push   %ebp
+  801702:	89 e5                	mov    %esp,%ebp
+  801704:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801707:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80170a:	52                   	push   %edx
+  80170b:	50                   	push   %eax
+  80170c:	e8 fe f7 ff ff       	call   800f0f <fd_lookup>
+  801711:	83 c4 10             	add    $0x10,%esp
+  801714:	85 c0                	test   %eax,%eax
+  801716:	78 10                	js     801728 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801718:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80171b:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  801721:	39 08                	cmp    %ecx,(%eax)
+  801723:	75 05                	jne    80172a <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801725:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801728:	c9                   	leave
+  801729:	c3                   	ret
+		return -E_NOT_SUPP;
+  80172a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80172f:	eb f7                	jmp    801728 <fd2sockid+0x27>
+
+00801731 <alloc_sockfd>:
+{
+  801731:	55                   	push   %ebp
+  801732:	89 e5                	mov    %esp,%ebp
+  801734:	56                   	push   %esi
+  801735:	53                   	push   %ebx
+  801736:	83 ec 1c             	sub    $0x1c,%esp
+  801739:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  80173b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80173e:	50                   	push   %eax
+  80173f:	e8 75 f7 ff ff       	call   800eb9 <fd_alloc>
+  801744:	89 c3                	mov    %eax,%ebx
+  801746:	83 c4 10             	add    $0x10,%esp
+  801749:	85 c0                	test   %eax,%eax
+  80174b:	78 43                	js     801790 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80174d:	83 ec 04             	sub    $0x4,%esp
+  801750:	68 07 04 00 00       	push   $0x407
+  801755:	ff 75 f4             	push   -0xc(%ebp)
+  801758:	6a 00                	push   $0x0
+  80175a:	e8 60 f4 ff ff       	call   800bbf <sys_page_alloc>
+  80175f:	89 c3                	mov    %eax,%ebx
+  801761:	83 c4 10             	add    $0x10,%esp
+  801764:	85 c0                	test   %eax,%eax
+  801766:	78 28                	js     801790 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801768:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80176b:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  801771:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801773:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801776:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  80177d:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801780:	83 ec 0c             	sub    $0xc,%esp
+  801783:	50                   	push   %eax
+  801784:	e8 09 f7 ff ff       	call   800e92 <fd2num>
+  801789:	89 c3                	mov    %eax,%ebx
+  80178b:	83 c4 10             	add    $0x10,%esp
+  80178e:	eb 0c                	jmp    80179c <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801790:	83 ec 0c             	sub    $0xc,%esp
+  801793:	56                   	push   %esi
+  801794:	e8 e4 01 00 00       	call   80197d <nsipc_close>
+		return r;
+  801799:	83 c4 10             	add    $0x10,%esp
+}
+  80179c:	89 d8                	mov    %ebx,%eax
+  80179e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017a1:	5b                   	pop    %ebx
+  8017a2:	5e                   	pop    %esi
+  8017a3:	5d                   	pop    %ebp
+  8017a4:	c3                   	ret
+
+008017a5 <accept>:
+{
+  8017a5:	55                   	push   %ebp
+  8017a6:	89 e5                	mov    %esp,%ebp
+  8017a8:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8017ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017ae:	e8 4e ff ff ff       	call   801701 <fd2sockid>
+  8017b3:	85 c0                	test   %eax,%eax
+  8017b5:	78 1b                	js     8017d2 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8017b7:	83 ec 04             	sub    $0x4,%esp
+  8017ba:	ff 75 10             	push   0x10(%ebp)
+  8017bd:	ff 75 0c             	push   0xc(%ebp)
+  8017c0:	50                   	push   %eax
+  8017c1:	e8 0e 01 00 00       	call   8018d4 <nsipc_accept>
+  8017c6:	83 c4 10             	add    $0x10,%esp
+  8017c9:	85 c0                	test   %eax,%eax
+  8017cb:	78 05                	js     8017d2 <accept+0x2d>
+	return alloc_sockfd(r);
+  8017cd:	e8 5f ff ff ff       	call   801731 <alloc_sockfd>
+}
+  8017d2:	c9                   	leave
+  8017d3:	c3                   	ret
+
+008017d4 <bind>:
+{
+  8017d4:	55                   	push   %ebp
+  8017d5:	89 e5                	mov    %esp,%ebp
+  8017d7:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8017da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017dd:	e8 1f ff ff ff       	call   801701 <fd2sockid>
+  8017e2:	85 c0                	test   %eax,%eax
+  8017e4:	78 12                	js     8017f8 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8017e6:	83 ec 04             	sub    $0x4,%esp
+  8017e9:	ff 75 10             	push   0x10(%ebp)
+  8017ec:	ff 75 0c             	push   0xc(%ebp)
+  8017ef:	50                   	push   %eax
+  8017f0:	e8 31 01 00 00       	call   801926 <nsipc_bind>
+  8017f5:	83 c4 10             	add    $0x10,%esp
+}
+  8017f8:	c9                   	leave
+  8017f9:	c3                   	ret
+
+008017fa <shutdown>:
+{
+  8017fa:	55                   	push   %ebp
+  8017fb:	89 e5                	mov    %esp,%ebp
+  8017fd:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801800:	8b 45 08             	mov    0x8(%ebp),%eax
+  801803:	e8 f9 fe ff ff       	call   801701 <fd2sockid>
+  801808:	85 c0                	test   %eax,%eax
+  80180a:	78 0f                	js     80181b <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  80180c:	83 ec 08             	sub    $0x8,%esp
+  80180f:	ff 75 0c             	push   0xc(%ebp)
+  801812:	50                   	push   %eax
+  801813:	e8 43 01 00 00       	call   80195b <nsipc_shutdown>
+  801818:	83 c4 10             	add    $0x10,%esp
+}
+  80181b:	c9                   	leave
+  80181c:	c3                   	ret
+
+0080181d <connect>:
+{
+  80181d:	55                   	push   %ebp
+  80181e:	89 e5                	mov    %esp,%ebp
+  801820:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801823:	8b 45 08             	mov    0x8(%ebp),%eax
+  801826:	e8 d6 fe ff ff       	call   801701 <fd2sockid>
+  80182b:	85 c0                	test   %eax,%eax
+  80182d:	78 12                	js     801841 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  80182f:	83 ec 04             	sub    $0x4,%esp
+  801832:	ff 75 10             	push   0x10(%ebp)
+  801835:	ff 75 0c             	push   0xc(%ebp)
+  801838:	50                   	push   %eax
+  801839:	e8 59 01 00 00       	call   801997 <nsipc_connect>
+  80183e:	83 c4 10             	add    $0x10,%esp
+}
+  801841:	c9                   	leave
+  801842:	c3                   	ret
+
+00801843 <listen>:
+{
+  801843:	55                   	push   %ebp
+  801844:	89 e5                	mov    %esp,%ebp
+  801846:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801849:	8b 45 08             	mov    0x8(%ebp),%eax
+  80184c:	e8 b0 fe ff ff       	call   801701 <fd2sockid>
+  801851:	85 c0                	test   %eax,%eax
+  801853:	78 0f                	js     801864 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801855:	83 ec 08             	sub    $0x8,%esp
+  801858:	ff 75 0c             	push   0xc(%ebp)
+  80185b:	50                   	push   %eax
+  80185c:	e8 6b 01 00 00       	call   8019cc <nsipc_listen>
+  801861:	83 c4 10             	add    $0x10,%esp
+}
+  801864:	c9                   	leave
+  801865:	c3                   	ret
+
+00801866 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801866:	55                   	push   %ebp
+  801867:	89 e5                	mov    %esp,%ebp
+  801869:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  80186c:	ff 75 10             	push   0x10(%ebp)
+  80186f:	ff 75 0c             	push   0xc(%ebp)
+  801872:	ff 75 08             	push   0x8(%ebp)
+  801875:	e8 41 02 00 00       	call   801abb <nsipc_socket>
+  80187a:	83 c4 10             	add    $0x10,%esp
+  80187d:	85 c0                	test   %eax,%eax
+  80187f:	78 05                	js     801886 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801881:	e8 ab fe ff ff       	call   801731 <alloc_sockfd>
+}
+  801886:	c9                   	leave
+  801887:	c3                   	ret
+
+00801888 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801888:	55                   	push   %ebp
+  801889:	89 e5                	mov    %esp,%ebp
+  80188b:	53                   	push   %ebx
+  80188c:	83 ec 04             	sub    $0x4,%esp
+  80188f:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801891:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801898:	74 26                	je     8018c0 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  80189a:	6a 07                	push   $0x7
+  80189c:	68 00 60 c0 00       	push   $0xc06000
+  8018a1:	53                   	push   %ebx
+  8018a2:	ff 35 04 40 80 00    	push   0x804004
+  8018a8:	e8 6a 07 00 00       	call   802017 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8018ad:	83 c4 0c             	add    $0xc,%esp
+  8018b0:	6a 00                	push   $0x0
+  8018b2:	6a 00                	push   $0x0
+  8018b4:	6a 00                	push   $0x0
+  8018b6:	e8 e8 06 00 00       	call   801fa3 <ipc_recv>
+}
+  8018bb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018be:	c9                   	leave
+  8018bf:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8018c0:	83 ec 0c             	sub    $0xc,%esp
+  8018c3:	6a 02                	push   $0x2
+  8018c5:	e8 a1 07 00 00       	call   80206b <ipc_find_env>
+  8018ca:	a3 04 40 80 00       	mov    %eax,0x804004
+  8018cf:	83 c4 10             	add    $0x10,%esp
+  8018d2:	eb c6                	jmp    80189a <nsipc+0x12>
+
+008018d4 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8018d4:	55                   	push   %ebp
+  8018d5:	89 e5                	mov    %esp,%ebp
+  8018d7:	56                   	push   %esi
+  8018d8:	53                   	push   %ebx
+  8018d9:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8018dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018df:	a3 00 60 c0 00       	mov    %eax,0xc06000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  8018e4:	8b 06                	mov    (%esi),%eax
+  8018e6:	a3 04 60 c0 00       	mov    %eax,0xc06004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8018eb:	b8 01 00 00 00       	mov    $0x1,%eax
+  8018f0:	e8 93 ff ff ff       	call   801888 <nsipc>
+  8018f5:	89 c3                	mov    %eax,%ebx
+  8018f7:	85 c0                	test   %eax,%eax
+  8018f9:	79 09                	jns    801904 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8018fb:	89 d8                	mov    %ebx,%eax
+  8018fd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801900:	5b                   	pop    %ebx
+  801901:	5e                   	pop    %esi
+  801902:	5d                   	pop    %ebp
+  801903:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801904:	83 ec 04             	sub    $0x4,%esp
+  801907:	ff 35 10 60 c0 00    	push   0xc06010
+  80190d:	68 00 60 c0 00       	push   $0xc06000
+  801912:	ff 75 0c             	push   0xc(%ebp)
+  801915:	e8 3f f0 ff ff       	call   800959 <memmove>
+		*addrlen = ret->ret_addrlen;
+  80191a:	a1 10 60 c0 00       	mov    0xc06010,%eax
+  80191f:	89 06                	mov    %eax,(%esi)
+  801921:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801924:	eb d5                	jmp    8018fb <nsipc_accept+0x27>
+
+00801926 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801926:	55                   	push   %ebp
+  801927:	89 e5                	mov    %esp,%ebp
+  801929:	53                   	push   %ebx
+  80192a:	83 ec 08             	sub    $0x8,%esp
+  80192d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801930:	8b 45 08             	mov    0x8(%ebp),%eax
+  801933:	a3 00 60 c0 00       	mov    %eax,0xc06000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801938:	53                   	push   %ebx
+  801939:	ff 75 0c             	push   0xc(%ebp)
+  80193c:	68 04 60 c0 00       	push   $0xc06004
+  801941:	e8 13 f0 ff ff       	call   800959 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801946:	89 1d 14 60 c0 00    	mov    %ebx,0xc06014
+	return nsipc(NSREQ_BIND);
+  80194c:	b8 02 00 00 00       	mov    $0x2,%eax
+  801951:	e8 32 ff ff ff       	call   801888 <nsipc>
+}
+  801956:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801959:	c9                   	leave
+  80195a:	c3                   	ret
+
+0080195b <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  80195b:	55                   	push   %ebp
+  80195c:	89 e5                	mov    %esp,%ebp
+  80195e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801961:	8b 45 08             	mov    0x8(%ebp),%eax
+  801964:	a3 00 60 c0 00       	mov    %eax,0xc06000
+	nsipcbuf.shutdown.req_how = how;
+  801969:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80196c:	a3 04 60 c0 00       	mov    %eax,0xc06004
+	return nsipc(NSREQ_SHUTDOWN);
+  801971:	b8 03 00 00 00       	mov    $0x3,%eax
+  801976:	e8 0d ff ff ff       	call   801888 <nsipc>
+}
+  80197b:	c9                   	leave
+  80197c:	c3                   	ret
+
+0080197d <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  80197d:	55                   	push   %ebp
+  80197e:	89 e5                	mov    %esp,%ebp
+  801980:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801983:	8b 45 08             	mov    0x8(%ebp),%eax
+  801986:	a3 00 60 c0 00       	mov    %eax,0xc06000
+	return nsipc(NSREQ_CLOSE);
+  80198b:	b8 04 00 00 00       	mov    $0x4,%eax
+  801990:	e8 f3 fe ff ff       	call   801888 <nsipc>
+}
+  801995:	c9                   	leave
+  801996:	c3                   	ret
+
+00801997 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801997:	55                   	push   %ebp
+  801998:	89 e5                	mov    %esp,%ebp
+  80199a:	53                   	push   %ebx
+  80199b:	83 ec 08             	sub    $0x8,%esp
+  80199e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8019a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019a4:	a3 00 60 c0 00       	mov    %eax,0xc06000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8019a9:	53                   	push   %ebx
+  8019aa:	ff 75 0c             	push   0xc(%ebp)
+  8019ad:	68 04 60 c0 00       	push   $0xc06004
+  8019b2:	e8 a2 ef ff ff       	call   800959 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8019b7:	89 1d 14 60 c0 00    	mov    %ebx,0xc06014
+	return nsipc(NSREQ_CONNECT);
+  8019bd:	b8 05 00 00 00       	mov    $0x5,%eax
+  8019c2:	e8 c1 fe ff ff       	call   801888 <nsipc>
+}
+  8019c7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019ca:	c9                   	leave
+  8019cb:	c3                   	ret
+
+008019cc <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8019cc:	55                   	push   %ebp
+  8019cd:	89 e5                	mov    %esp,%ebp
+  8019cf:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8019d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019d5:	a3 00 60 c0 00       	mov    %eax,0xc06000
+	nsipcbuf.listen.req_backlog = backlog;
+  8019da:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019dd:	a3 04 60 c0 00       	mov    %eax,0xc06004
+	return nsipc(NSREQ_LISTEN);
+  8019e2:	b8 06 00 00 00       	mov    $0x6,%eax
+  8019e7:	e8 9c fe ff ff       	call   801888 <nsipc>
+}
+  8019ec:	c9                   	leave
+  8019ed:	c3                   	ret
+
+008019ee <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8019ee:	55                   	push   %ebp
+  8019ef:	89 e5                	mov    %esp,%ebp
+  8019f1:	56                   	push   %esi
+  8019f2:	53                   	push   %ebx
+  8019f3:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8019f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019f9:	a3 00 60 c0 00       	mov    %eax,0xc06000
+	nsipcbuf.recv.req_len = len;
+  8019fe:	89 35 04 60 c0 00    	mov    %esi,0xc06004
+	nsipcbuf.recv.req_flags = flags;
+  801a04:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a07:	a3 08 60 c0 00       	mov    %eax,0xc06008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801a0c:	b8 07 00 00 00       	mov    $0x7,%eax
+  801a11:	e8 72 fe ff ff       	call   801888 <nsipc>
+  801a16:	89 c3                	mov    %eax,%ebx
+  801a18:	85 c0                	test   %eax,%eax
+  801a1a:	78 22                	js     801a3e <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801a1c:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801a21:	39 c6                	cmp    %eax,%esi
+  801a23:	0f 4e c6             	cmovle %esi,%eax
+  801a26:	39 c3                	cmp    %eax,%ebx
+  801a28:	7f 1d                	jg     801a47 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801a2a:	83 ec 04             	sub    $0x4,%esp
+  801a2d:	53                   	push   %ebx
+  801a2e:	68 00 60 c0 00       	push   $0xc06000
+  801a33:	ff 75 0c             	push   0xc(%ebp)
+  801a36:	e8 1e ef ff ff       	call   800959 <memmove>
+  801a3b:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801a3e:	89 d8                	mov    %ebx,%eax
+  801a40:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a43:	5b                   	pop    %ebx
+  801a44:	5e                   	pop    %esi
+  801a45:	5d                   	pop    %ebp
+  801a46:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801a47:	68 7f 2a 80 00       	push   $0x802a7f
+  801a4c:	68 47 2a 80 00       	push   $0x802a47
+  801a51:	6a 62                	push   $0x62
+  801a53:	68 94 2a 80 00       	push   $0x802a94
+  801a58:	e8 e2 e6 ff ff       	call   80013f <_panic>
+
+00801a5d <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801a5d:	55                   	push   %ebp
+  801a5e:	89 e5                	mov    %esp,%ebp
+  801a60:	53                   	push   %ebx
+  801a61:	83 ec 04             	sub    $0x4,%esp
+  801a64:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801a67:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a6a:	a3 00 60 c0 00       	mov    %eax,0xc06000
+	assert(size < 1600);
+  801a6f:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801a75:	7f 2e                	jg     801aa5 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801a77:	83 ec 04             	sub    $0x4,%esp
+  801a7a:	53                   	push   %ebx
+  801a7b:	ff 75 0c             	push   0xc(%ebp)
+  801a7e:	68 0c 60 c0 00       	push   $0xc0600c
+  801a83:	e8 d1 ee ff ff       	call   800959 <memmove>
+	nsipcbuf.send.req_size = size;
+  801a88:	89 1d 04 60 c0 00    	mov    %ebx,0xc06004
+	nsipcbuf.send.req_flags = flags;
+  801a8e:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a91:	a3 08 60 c0 00       	mov    %eax,0xc06008
+	return nsipc(NSREQ_SEND);
+  801a96:	b8 08 00 00 00       	mov    $0x8,%eax
+  801a9b:	e8 e8 fd ff ff       	call   801888 <nsipc>
+}
+  801aa0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801aa3:	c9                   	leave
+  801aa4:	c3                   	ret
+	assert(size < 1600);
+  801aa5:	68 a0 2a 80 00       	push   $0x802aa0
+  801aaa:	68 47 2a 80 00       	push   $0x802a47
+  801aaf:	6a 6d                	push   $0x6d
+  801ab1:	68 94 2a 80 00       	push   $0x802a94
+  801ab6:	e8 84 e6 ff ff       	call   80013f <_panic>
+
+00801abb <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801abb:	55                   	push   %ebp
+  801abc:	89 e5                	mov    %esp,%ebp
+  801abe:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801ac1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ac4:	a3 00 60 c0 00       	mov    %eax,0xc06000
+	nsipcbuf.socket.req_type = type;
+  801ac9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801acc:	a3 04 60 c0 00       	mov    %eax,0xc06004
+	nsipcbuf.socket.req_protocol = protocol;
+  801ad1:	8b 45 10             	mov    0x10(%ebp),%eax
+  801ad4:	a3 08 60 c0 00       	mov    %eax,0xc06008
+	return nsipc(NSREQ_SOCKET);
+  801ad9:	b8 09 00 00 00       	mov    $0x9,%eax
+  801ade:	e8 a5 fd ff ff       	call   801888 <nsipc>
+}
+  801ae3:	c9                   	leave
+  801ae4:	c3                   	ret
+
+00801ae5 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801ae5:	55                   	push   %ebp
+  801ae6:	89 e5                	mov    %esp,%ebp
+  801ae8:	56                   	push   %esi
+  801ae9:	53                   	push   %ebx
+  801aea:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801aed:	83 ec 0c             	sub    $0xc,%esp
+  801af0:	ff 75 08             	push   0x8(%ebp)
+  801af3:	e8 aa f3 ff ff       	call   800ea2 <fd2data>
+  801af8:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801afa:	83 c4 08             	add    $0x8,%esp
+  801afd:	68 ac 2a 80 00       	push   $0x802aac
+  801b02:	53                   	push   %ebx
+  801b03:	e8 cb ec ff ff       	call   8007d3 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801b08:	8b 46 04             	mov    0x4(%esi),%eax
+  801b0b:	2b 06                	sub    (%esi),%eax
+  801b0d:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  801b13:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801b1a:	00 00 00 
+	stat->st_dev = &devpipe;
+  801b1d:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  801b24:	30 80 00 
+	return 0;
+}
+  801b27:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b2c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b2f:	5b                   	pop    %ebx
+  801b30:	5e                   	pop    %esi
+  801b31:	5d                   	pop    %ebp
+  801b32:	c3                   	ret
+
+00801b33 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801b33:	55                   	push   %ebp
+  801b34:	89 e5                	mov    %esp,%ebp
+  801b36:	53                   	push   %ebx
+  801b37:	83 ec 0c             	sub    $0xc,%esp
+  801b3a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801b3d:	53                   	push   %ebx
+  801b3e:	6a 00                	push   $0x0
+  801b40:	e8 ff f0 ff ff       	call   800c44 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801b45:	89 1c 24             	mov    %ebx,(%esp)
+  801b48:	e8 55 f3 ff ff       	call   800ea2 <fd2data>
+  801b4d:	83 c4 08             	add    $0x8,%esp
+  801b50:	50                   	push   %eax
+  801b51:	6a 00                	push   $0x0
+  801b53:	e8 ec f0 ff ff       	call   800c44 <sys_page_unmap>
+}
+  801b58:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b5b:	c9                   	leave
+  801b5c:	c3                   	ret
+
+00801b5d <_pipeisclosed>:
+{
+  801b5d:	55                   	push   %ebp
+  801b5e:	89 e5                	mov    %esp,%ebp
+  801b60:	57                   	push   %edi
+  801b61:	56                   	push   %esi
+  801b62:	53                   	push   %ebx
+  801b63:	83 ec 1c             	sub    $0x1c,%esp
+  801b66:	89 c7                	mov    %eax,%edi
+  801b68:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801b6a:	a1 20 40 c0 00       	mov    0xc04020,%eax
+  801b6f:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801b72:	83 ec 0c             	sub    $0xc,%esp
+  801b75:	57                   	push   %edi
+  801b76:	e8 2f 05 00 00       	call   8020aa <pageref>
+  801b7b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801b7e:	89 34 24             	mov    %esi,(%esp)
+  801b81:	e8 24 05 00 00       	call   8020aa <pageref>
+		nn = thisenv->env_runs;
+  801b86:	8b 15 20 40 c0 00    	mov    0xc04020,%edx
+  801b8c:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801b8f:	83 c4 10             	add    $0x10,%esp
+  801b92:	39 cb                	cmp    %ecx,%ebx
+  801b94:	74 1b                	je     801bb1 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801b96:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801b99:	75 cf                	jne    801b6a <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801b9b:	8b 42 58             	mov    0x58(%edx),%eax
+  801b9e:	6a 01                	push   $0x1
+  801ba0:	50                   	push   %eax
+  801ba1:	53                   	push   %ebx
+  801ba2:	68 b3 2a 80 00       	push   $0x802ab3
+  801ba7:	e8 6e e6 ff ff       	call   80021a <cprintf>
+  801bac:	83 c4 10             	add    $0x10,%esp
+  801baf:	eb b9                	jmp    801b6a <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801bb1:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801bb4:	0f 94 c0             	sete   %al
+  801bb7:	0f b6 c0             	movzbl %al,%eax
+}
+  801bba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bbd:	5b                   	pop    %ebx
+  801bbe:	5e                   	pop    %esi
+  801bbf:	5f                   	pop    %edi
+  801bc0:	5d                   	pop    %ebp
+  801bc1:	c3                   	ret
+
+00801bc2 <devpipe_write>:
+{
+  801bc2:	55                   	push   %ebp
+  801bc3:	89 e5                	mov    %esp,%ebp
+  801bc5:	57                   	push   %edi
+  801bc6:	56                   	push   %esi
+  801bc7:	53                   	push   %ebx
+  801bc8:	83 ec 28             	sub    $0x28,%esp
+  801bcb:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801bce:	56                   	push   %esi
+  801bcf:	e8 ce f2 ff ff       	call   800ea2 <fd2data>
+  801bd4:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801bd6:	83 c4 10             	add    $0x10,%esp
+  801bd9:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bde:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801be1:	75 09                	jne    801bec <devpipe_write+0x2a>
+	return i;
+  801be3:	89 f8                	mov    %edi,%eax
+  801be5:	eb 23                	jmp    801c0a <devpipe_write+0x48>
+			sys_yield();
+  801be7:	e8 b4 ef ff ff       	call   800ba0 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801bec:	8b 43 04             	mov    0x4(%ebx),%eax
+  801bef:	8b 0b                	mov    (%ebx),%ecx
+  801bf1:	8d 51 20             	lea    0x20(%ecx),%edx
+  801bf4:	39 d0                	cmp    %edx,%eax
+  801bf6:	72 1a                	jb     801c12 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  801bf8:	89 da                	mov    %ebx,%edx
+  801bfa:	89 f0                	mov    %esi,%eax
+  801bfc:	e8 5c ff ff ff       	call   801b5d <_pipeisclosed>
+  801c01:	85 c0                	test   %eax,%eax
+  801c03:	74 e2                	je     801be7 <devpipe_write+0x25>
+				return 0;
+  801c05:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c0a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c0d:	5b                   	pop    %ebx
+  801c0e:	5e                   	pop    %esi
+  801c0f:	5f                   	pop    %edi
+  801c10:	5d                   	pop    %ebp
+  801c11:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801c12:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c15:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801c19:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801c1c:	89 c2                	mov    %eax,%edx
+  801c1e:	c1 fa 1f             	sar    $0x1f,%edx
+  801c21:	89 d1                	mov    %edx,%ecx
+  801c23:	c1 e9 1b             	shr    $0x1b,%ecx
+  801c26:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801c29:	83 e2 1f             	and    $0x1f,%edx
+  801c2c:	29 ca                	sub    %ecx,%edx
+  801c2e:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801c32:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  801c36:	83 c0 01             	add    $0x1,%eax
+  801c39:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  801c3c:	83 c7 01             	add    $0x1,%edi
+  801c3f:	eb 9d                	jmp    801bde <devpipe_write+0x1c>
+
+00801c41 <devpipe_read>:
+{
+  801c41:	55                   	push   %ebp
+  801c42:	89 e5                	mov    %esp,%ebp
+  801c44:	57                   	push   %edi
+  801c45:	56                   	push   %esi
+  801c46:	53                   	push   %ebx
+  801c47:	83 ec 18             	sub    $0x18,%esp
+  801c4a:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  801c4d:	57                   	push   %edi
+  801c4e:	e8 4f f2 ff ff       	call   800ea2 <fd2data>
+  801c53:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801c55:	83 c4 10             	add    $0x10,%esp
+  801c58:	be 00 00 00 00       	mov    $0x0,%esi
+  801c5d:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801c60:	75 13                	jne    801c75 <devpipe_read+0x34>
+	return i;
+  801c62:	89 f0                	mov    %esi,%eax
+  801c64:	eb 02                	jmp    801c68 <devpipe_read+0x27>
+				return i;
+  801c66:	89 f0                	mov    %esi,%eax
+}
+  801c68:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c6b:	5b                   	pop    %ebx
+  801c6c:	5e                   	pop    %esi
+  801c6d:	5f                   	pop    %edi
+  801c6e:	5d                   	pop    %ebp
+  801c6f:	c3                   	ret
+			sys_yield();
+  801c70:	e8 2b ef ff ff       	call   800ba0 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  801c75:	8b 03                	mov    (%ebx),%eax
+  801c77:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801c7a:	75 18                	jne    801c94 <devpipe_read+0x53>
+			if (i > 0)
+  801c7c:	85 f6                	test   %esi,%esi
+  801c7e:	75 e6                	jne    801c66 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  801c80:	89 da                	mov    %ebx,%edx
+  801c82:	89 f8                	mov    %edi,%eax
+  801c84:	e8 d4 fe ff ff       	call   801b5d <_pipeisclosed>
+  801c89:	85 c0                	test   %eax,%eax
+  801c8b:	74 e3                	je     801c70 <devpipe_read+0x2f>
+				return 0;
+  801c8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c92:	eb d4                	jmp    801c68 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801c94:	99                   	cltd
+  801c95:	c1 ea 1b             	shr    $0x1b,%edx
+  801c98:	01 d0                	add    %edx,%eax
+  801c9a:	83 e0 1f             	and    $0x1f,%eax
+  801c9d:	29 d0                	sub    %edx,%eax
+  801c9f:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801ca4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ca7:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  801caa:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  801cad:	83 c6 01             	add    $0x1,%esi
+  801cb0:	eb ab                	jmp    801c5d <devpipe_read+0x1c>
+
+00801cb2 <pipe>:
+{
+  801cb2:	55                   	push   %ebp
+  801cb3:	89 e5                	mov    %esp,%ebp
+  801cb5:	56                   	push   %esi
+  801cb6:	53                   	push   %ebx
+  801cb7:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801cba:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cbd:	50                   	push   %eax
+  801cbe:	e8 f6 f1 ff ff       	call   800eb9 <fd_alloc>
+  801cc3:	89 c3                	mov    %eax,%ebx
+  801cc5:	83 c4 10             	add    $0x10,%esp
+  801cc8:	85 c0                	test   %eax,%eax
+  801cca:	0f 88 23 01 00 00    	js     801df3 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801cd0:	83 ec 04             	sub    $0x4,%esp
+  801cd3:	68 07 04 00 00       	push   $0x407
+  801cd8:	ff 75 f4             	push   -0xc(%ebp)
+  801cdb:	6a 00                	push   $0x0
+  801cdd:	e8 dd ee ff ff       	call   800bbf <sys_page_alloc>
+  801ce2:	89 c3                	mov    %eax,%ebx
+  801ce4:	83 c4 10             	add    $0x10,%esp
+  801ce7:	85 c0                	test   %eax,%eax
+  801ce9:	0f 88 04 01 00 00    	js     801df3 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801cef:	83 ec 0c             	sub    $0xc,%esp
+  801cf2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801cf5:	50                   	push   %eax
+  801cf6:	e8 be f1 ff ff       	call   800eb9 <fd_alloc>
+  801cfb:	89 c3                	mov    %eax,%ebx
+  801cfd:	83 c4 10             	add    $0x10,%esp
+  801d00:	85 c0                	test   %eax,%eax
+  801d02:	0f 88 db 00 00 00    	js     801de3 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801d08:	83 ec 04             	sub    $0x4,%esp
+  801d0b:	68 07 04 00 00       	push   $0x407
+  801d10:	ff 75 f0             	push   -0x10(%ebp)
+  801d13:	6a 00                	push   $0x0
+  801d15:	e8 a5 ee ff ff       	call   800bbf <sys_page_alloc>
+  801d1a:	89 c3                	mov    %eax,%ebx
+  801d1c:	83 c4 10             	add    $0x10,%esp
+  801d1f:	85 c0                	test   %eax,%eax
+  801d21:	0f 88 bc 00 00 00    	js     801de3 <pipe+0x131>
+	va = fd2data(fd0);
+  801d27:	83 ec 0c             	sub    $0xc,%esp
+  801d2a:	ff 75 f4             	push   -0xc(%ebp)
+  801d2d:	e8 70 f1 ff ff       	call   800ea2 <fd2data>
+  801d32:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801d34:	83 c4 0c             	add    $0xc,%esp
+  801d37:	68 07 04 00 00       	push   $0x407
+  801d3c:	50                   	push   %eax
+  801d3d:	6a 00                	push   $0x0
+  801d3f:	e8 7b ee ff ff       	call   800bbf <sys_page_alloc>
+  801d44:	89 c3                	mov    %eax,%ebx
+  801d46:	83 c4 10             	add    $0x10,%esp
+  801d49:	85 c0                	test   %eax,%eax
+  801d4b:	0f 88 82 00 00 00    	js     801dd3 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801d51:	83 ec 0c             	sub    $0xc,%esp
+  801d54:	ff 75 f0             	push   -0x10(%ebp)
+  801d57:	e8 46 f1 ff ff       	call   800ea2 <fd2data>
+  801d5c:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801d63:	50                   	push   %eax
+  801d64:	6a 00                	push   $0x0
+  801d66:	56                   	push   %esi
+  801d67:	6a 00                	push   $0x0
+  801d69:	e8 94 ee ff ff       	call   800c02 <sys_page_map>
+  801d6e:	89 c3                	mov    %eax,%ebx
+  801d70:	83 c4 20             	add    $0x20,%esp
+  801d73:	85 c0                	test   %eax,%eax
+  801d75:	78 4e                	js     801dc5 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  801d77:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  801d7c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801d7f:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  801d81:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801d84:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  801d8b:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801d8e:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  801d90:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801d93:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  801d9a:	83 ec 0c             	sub    $0xc,%esp
+  801d9d:	ff 75 f4             	push   -0xc(%ebp)
+  801da0:	e8 ed f0 ff ff       	call   800e92 <fd2num>
+  801da5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801da8:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  801daa:	83 c4 04             	add    $0x4,%esp
+  801dad:	ff 75 f0             	push   -0x10(%ebp)
+  801db0:	e8 dd f0 ff ff       	call   800e92 <fd2num>
+  801db5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801db8:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  801dbb:	83 c4 10             	add    $0x10,%esp
+  801dbe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801dc3:	eb 2e                	jmp    801df3 <pipe+0x141>
+	sys_page_unmap(0, va);
+  801dc5:	83 ec 08             	sub    $0x8,%esp
+  801dc8:	56                   	push   %esi
+  801dc9:	6a 00                	push   $0x0
+  801dcb:	e8 74 ee ff ff       	call   800c44 <sys_page_unmap>
+  801dd0:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  801dd3:	83 ec 08             	sub    $0x8,%esp
+  801dd6:	ff 75 f0             	push   -0x10(%ebp)
+  801dd9:	6a 00                	push   $0x0
+  801ddb:	e8 64 ee ff ff       	call   800c44 <sys_page_unmap>
+  801de0:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  801de3:	83 ec 08             	sub    $0x8,%esp
+  801de6:	ff 75 f4             	push   -0xc(%ebp)
+  801de9:	6a 00                	push   $0x0
+  801deb:	e8 54 ee ff ff       	call   800c44 <sys_page_unmap>
+  801df0:	83 c4 10             	add    $0x10,%esp
+}
+  801df3:	89 d8                	mov    %ebx,%eax
+  801df5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801df8:	5b                   	pop    %ebx
+  801df9:	5e                   	pop    %esi
+  801dfa:	5d                   	pop    %ebp
+  801dfb:	c3                   	ret
+
+00801dfc <pipeisclosed>:
+{
+  801dfc:	55                   	push   %ebp
+  801dfd:	89 e5                	mov    %esp,%ebp
+  801dff:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801e02:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e05:	50                   	push   %eax
+  801e06:	ff 75 08             	push   0x8(%ebp)
+  801e09:	e8 01 f1 ff ff       	call   800f0f <fd_lookup>
+  801e0e:	83 c4 10             	add    $0x10,%esp
+  801e11:	85 c0                	test   %eax,%eax
+  801e13:	78 18                	js     801e2d <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  801e15:	83 ec 0c             	sub    $0xc,%esp
+  801e18:	ff 75 f4             	push   -0xc(%ebp)
+  801e1b:	e8 82 f0 ff ff       	call   800ea2 <fd2data>
+  801e20:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  801e22:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e25:	e8 33 fd ff ff       	call   801b5d <_pipeisclosed>
+  801e2a:	83 c4 10             	add    $0x10,%esp
+}
+  801e2d:	c9                   	leave
+  801e2e:	c3                   	ret
+
+00801e2f <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  801e2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e34:	c3                   	ret
+
+00801e35 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  801e35:	55                   	push   %ebp
+  801e36:	89 e5                	mov    %esp,%ebp
+  801e38:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  801e3b:	68 cb 2a 80 00       	push   $0x802acb
+  801e40:	ff 75 0c             	push   0xc(%ebp)
+  801e43:	e8 8b e9 ff ff       	call   8007d3 <strcpy>
+	return 0;
+}
+  801e48:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e4d:	c9                   	leave
+  801e4e:	c3                   	ret
+
+00801e4f <devcons_write>:
+{
+  801e4f:	55                   	push   %ebp
+  801e50:	89 e5                	mov    %esp,%ebp
+  801e52:	57                   	push   %edi
+  801e53:	56                   	push   %esi
+  801e54:	53                   	push   %ebx
+  801e55:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  801e5b:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  801e60:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  801e66:	eb 2e                	jmp    801e96 <devcons_write+0x47>
+		m = n - tot;
+  801e68:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801e6b:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  801e6d:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801e72:	39 c3                	cmp    %eax,%ebx
+  801e74:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  801e77:	83 ec 04             	sub    $0x4,%esp
+  801e7a:	53                   	push   %ebx
+  801e7b:	89 f0                	mov    %esi,%eax
+  801e7d:	03 45 0c             	add    0xc(%ebp),%eax
+  801e80:	50                   	push   %eax
+  801e81:	57                   	push   %edi
+  801e82:	e8 d2 ea ff ff       	call   800959 <memmove>
+		sys_cputs(buf, m);
+  801e87:	83 c4 08             	add    $0x8,%esp
+  801e8a:	53                   	push   %ebx
+  801e8b:	57                   	push   %edi
+  801e8c:	e8 72 ec ff ff       	call   800b03 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  801e91:	01 de                	add    %ebx,%esi
+  801e93:	83 c4 10             	add    $0x10,%esp
+  801e96:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801e99:	72 cd                	jb     801e68 <devcons_write+0x19>
+}
+  801e9b:	89 f0                	mov    %esi,%eax
+  801e9d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ea0:	5b                   	pop    %ebx
+  801ea1:	5e                   	pop    %esi
+  801ea2:	5f                   	pop    %edi
+  801ea3:	5d                   	pop    %ebp
+  801ea4:	c3                   	ret
+
+00801ea5 <devcons_read>:
+{
+  801ea5:	55                   	push   %ebp
+  801ea6:	89 e5                	mov    %esp,%ebp
+  801ea8:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  801eab:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eb0:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801eb4:	75 07                	jne    801ebd <devcons_read+0x18>
+  801eb6:	eb 1f                	jmp    801ed7 <devcons_read+0x32>
+		sys_yield();
+  801eb8:	e8 e3 ec ff ff       	call   800ba0 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  801ebd:	e8 5f ec ff ff       	call   800b21 <sys_cgetc>
+  801ec2:	85 c0                	test   %eax,%eax
+  801ec4:	74 f2                	je     801eb8 <devcons_read+0x13>
+	if (c < 0)
+  801ec6:	78 0f                	js     801ed7 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  801ec8:	83 f8 04             	cmp    $0x4,%eax
+  801ecb:	74 0c                	je     801ed9 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  801ecd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ed0:	88 02                	mov    %al,(%edx)
+	return 1;
+  801ed2:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  801ed7:	c9                   	leave
+  801ed8:	c3                   	ret
+		return 0;
+  801ed9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ede:	eb f7                	jmp    801ed7 <devcons_read+0x32>
+
+00801ee0 <cputchar>:
+{
+  801ee0:	55                   	push   %ebp
+  801ee1:	89 e5                	mov    %esp,%ebp
+  801ee3:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  801ee6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ee9:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  801eec:	6a 01                	push   $0x1
+  801eee:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801ef1:	50                   	push   %eax
+  801ef2:	e8 0c ec ff ff       	call   800b03 <sys_cputs>
+}
+  801ef7:	83 c4 10             	add    $0x10,%esp
+  801efa:	c9                   	leave
+  801efb:	c3                   	ret
+
+00801efc <getchar>:
+{
+  801efc:	55                   	push   %ebp
+  801efd:	89 e5                	mov    %esp,%ebp
+  801eff:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  801f02:	6a 01                	push   $0x1
+  801f04:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801f07:	50                   	push   %eax
+  801f08:	6a 00                	push   $0x0
+  801f0a:	e8 66 f2 ff ff       	call   801175 <read>
+	if (r < 0)
+  801f0f:	83 c4 10             	add    $0x10,%esp
+  801f12:	85 c0                	test   %eax,%eax
+  801f14:	78 06                	js     801f1c <getchar+0x20>
+	if (r < 1)
+  801f16:	74 06                	je     801f1e <getchar+0x22>
+	return c;
+  801f18:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  801f1c:	c9                   	leave
+  801f1d:	c3                   	ret
+		return -E_EOF;
+  801f1e:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  801f23:	eb f7                	jmp    801f1c <getchar+0x20>
+
+00801f25 <iscons>:
+{
+  801f25:	55                   	push   %ebp
+  801f26:	89 e5                	mov    %esp,%ebp
+  801f28:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801f2b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f2e:	50                   	push   %eax
+  801f2f:	ff 75 08             	push   0x8(%ebp)
+  801f32:	e8 d8 ef ff ff       	call   800f0f <fd_lookup>
+  801f37:	83 c4 10             	add    $0x10,%esp
+  801f3a:	85 c0                	test   %eax,%eax
+  801f3c:	78 11                	js     801f4f <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  801f3e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f41:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  801f47:	39 10                	cmp    %edx,(%eax)
+  801f49:	0f 94 c0             	sete   %al
+  801f4c:	0f b6 c0             	movzbl %al,%eax
+}
+  801f4f:	c9                   	leave
+  801f50:	c3                   	ret
+
+00801f51 <opencons>:
+{
+  801f51:	55                   	push   %ebp
+  801f52:	89 e5                	mov    %esp,%ebp
+  801f54:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  801f57:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f5a:	50                   	push   %eax
+  801f5b:	e8 59 ef ff ff       	call   800eb9 <fd_alloc>
+  801f60:	83 c4 10             	add    $0x10,%esp
+  801f63:	85 c0                	test   %eax,%eax
+  801f65:	78 3a                	js     801fa1 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  801f67:	83 ec 04             	sub    $0x4,%esp
+  801f6a:	68 07 04 00 00       	push   $0x407
+  801f6f:	ff 75 f4             	push   -0xc(%ebp)
+  801f72:	6a 00                	push   $0x0
+  801f74:	e8 46 ec ff ff       	call   800bbf <sys_page_alloc>
+  801f79:	83 c4 10             	add    $0x10,%esp
+  801f7c:	85 c0                	test   %eax,%eax
+  801f7e:	78 21                	js     801fa1 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  801f80:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f83:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  801f89:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  801f8b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f8e:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  801f95:	83 ec 0c             	sub    $0xc,%esp
+  801f98:	50                   	push   %eax
+  801f99:	e8 f4 ee ff ff       	call   800e92 <fd2num>
+  801f9e:	83 c4 10             	add    $0x10,%esp
+}
+  801fa1:	c9                   	leave
+  801fa2:	c3                   	ret
+
+00801fa3 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  801fa3:	55                   	push   %ebp
+  801fa4:	89 e5                	mov    %esp,%ebp
+  801fa6:	56                   	push   %esi
+  801fa7:	53                   	push   %ebx
+  801fa8:	8b 75 08             	mov    0x8(%ebp),%esi
+  801fab:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fae:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  801fb1:	85 c0                	test   %eax,%eax
+  801fb3:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801fb8:	0f 44 c2             	cmove  %edx,%eax
+  801fbb:	83 ec 0c             	sub    $0xc,%esp
+  801fbe:	50                   	push   %eax
+  801fbf:	e8 ab ed ff ff       	call   800d6f <sys_ipc_recv>
+
+  if (from_env_store)
+  801fc4:	83 c4 10             	add    $0x10,%esp
+  801fc7:	85 f6                	test   %esi,%esi
+  801fc9:	74 17                	je     801fe2 <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  801fcb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fd0:	85 c0                	test   %eax,%eax
+  801fd2:	75 0c                	jne    801fe0 <ipc_recv+0x3d>
+  801fd4:	8b 15 20 40 c0 00    	mov    0xc04020,%edx
+  801fda:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  801fe0:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  801fe2:	85 db                	test   %ebx,%ebx
+  801fe4:	74 2b                	je     802011 <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  801fe6:	85 c0                	test   %eax,%eax
+  801fe8:	74 0d                	je     801ff7 <ipc_recv+0x54>
+  801fea:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  801ff0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ff3:	5b                   	pop    %ebx
+  801ff4:	5e                   	pop    %esi
+  801ff5:	5d                   	pop    %ebp
+  801ff6:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  801ff7:	a1 20 40 c0 00       	mov    0xc04020,%eax
+  801ffc:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  802002:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  802004:	a1 20 40 c0 00       	mov    0xc04020,%eax
+  802009:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  80200f:	eb df                	jmp    801ff0 <ipc_recv+0x4d>
+  802011:	85 c0                	test   %eax,%eax
+  802013:	75 db                	jne    801ff0 <ipc_recv+0x4d>
+  802015:	eb ed                	jmp    802004 <ipc_recv+0x61>
+
+00802017 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  802017:	55                   	push   %ebp
+  802018:	89 e5                	mov    %esp,%ebp
+  80201a:	57                   	push   %edi
+  80201b:	56                   	push   %esi
+  80201c:	53                   	push   %ebx
+  80201d:	83 ec 0c             	sub    $0xc,%esp
+  802020:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802023:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802026:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  802029:	85 db                	test   %ebx,%ebx
+  80202b:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802030:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  802033:	ff 75 14             	push   0x14(%ebp)
+  802036:	53                   	push   %ebx
+  802037:	56                   	push   %esi
+  802038:	57                   	push   %edi
+  802039:	e8 0e ed ff ff       	call   800d4c <sys_ipc_try_send>
+  80203e:	83 c4 10             	add    $0x10,%esp
+  802041:	85 c0                	test   %eax,%eax
+  802043:	74 1e                	je     802063 <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  802045:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802048:	75 07                	jne    802051 <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  80204a:	e8 51 eb ff ff       	call   800ba0 <sys_yield>
+  80204f:	eb e2                	jmp    802033 <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  802051:	50                   	push   %eax
+  802052:	68 d7 2a 80 00       	push   $0x802ad7
+  802057:	6a 3c                	push   $0x3c
+  802059:	68 e4 2a 80 00       	push   $0x802ae4
+  80205e:	e8 dc e0 ff ff       	call   80013f <_panic>
+  }
+
+#endif
+}
+  802063:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802066:	5b                   	pop    %ebx
+  802067:	5e                   	pop    %esi
+  802068:	5f                   	pop    %edi
+  802069:	5d                   	pop    %ebp
+  80206a:	c3                   	ret
+
+0080206b <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  80206b:	55                   	push   %ebp
+  80206c:	89 e5                	mov    %esp,%ebp
+  80206e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  802071:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  802076:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802079:	c1 e0 04             	shl    $0x4,%eax
+  80207c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802081:	8b 40 50             	mov    0x50(%eax),%eax
+  802084:	39 c8                	cmp    %ecx,%eax
+  802086:	74 12                	je     80209a <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  802088:	83 c2 01             	add    $0x1,%edx
+  80208b:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802091:	75 e3                	jne    802076 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802093:	b8 00 00 00 00       	mov    $0x0,%eax
+  802098:	eb 0e                	jmp    8020a8 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  80209a:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80209d:	c1 e0 04             	shl    $0x4,%eax
+  8020a0:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8020a5:	8b 40 48             	mov    0x48(%eax),%eax
+  8020a8:	5d                   	pop    %ebp
+  8020a9:	c3                   	ret
+
+008020aa <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8020aa:	55                   	push   %ebp
+  8020ab:	89 e5                	mov    %esp,%ebp
+  8020ad:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8020b0:	89 c2                	mov    %eax,%edx
+  8020b2:	c1 ea 16             	shr    $0x16,%edx
+  8020b5:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8020bc:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8020c1:	f6 c1 01             	test   $0x1,%cl
+  8020c4:	74 1c                	je     8020e2 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  8020c6:	c1 e8 0c             	shr    $0xc,%eax
+  8020c9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8020d0:	a8 01                	test   $0x1,%al
+  8020d2:	74 0e                	je     8020e2 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8020d4:	c1 e8 0c             	shr    $0xc,%eax
+  8020d7:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  8020de:	ef 
+  8020df:	0f b7 d2             	movzwl %dx,%edx
+}
+  8020e2:	89 d0                	mov    %edx,%eax
+  8020e4:	5d                   	pop    %ebp
+  8020e5:	c3                   	ret
+  8020e6:	66 90                	xchg   %ax,%ax
+  8020e8:	66 90                	xchg   %ax,%ax
+  8020ea:	66 90                	xchg   %ax,%ax
+  8020ec:	66 90                	xchg   %ax,%ax
+  8020ee:	66 90                	xchg   %ax,%ax
+
+008020f0 <__udivmoddi4>:
+  8020f0:	55                   	push   %ebp
+  8020f1:	57                   	push   %edi
+  8020f2:	56                   	push   %esi
+  8020f3:	53                   	push   %ebx
+  8020f4:	83 ec 24             	sub    $0x24,%esp
+  8020f7:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8020fb:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8020ff:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  802103:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802107:	8b 54 24 44          	mov    0x44(%esp),%edx
+  80210b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80210f:	8b 44 24 40          	mov    0x40(%esp),%eax
+  802113:	89 d3                	mov    %edx,%ebx
+  802115:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802119:	09 c3                	or     %eax,%ebx
+  80211b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80211f:	0f 84 9c 00 00 00    	je     8021c1 <__udivmoddi4+0xd1>
+  802125:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80212c:	00 
+  80212d:	31 c0                	xor    %eax,%eax
+  80212f:	31 d2                	xor    %edx,%edx
+  802131:	89 fb                	mov    %edi,%ebx
+  802133:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80213a:	00 
+  80213b:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802140:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802144:	01 c0                	add    %eax,%eax
+  802146:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80214d:	00 
+  80214e:	89 c6                	mov    %eax,%esi
+  802150:	89 d7                	mov    %edx,%edi
+  802152:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802156:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80215a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80215d:	d3 ea                	shr    %cl,%edx
+  80215f:	f6 c1 20             	test   $0x20,%cl
+  802162:	0f 45 c2             	cmovne %edx,%eax
+  802165:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802169:	83 e0 01             	and    $0x1,%eax
+  80216c:	09 fa                	or     %edi,%edx
+  80216e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802172:	89 04 24             	mov    %eax,(%esp)
+  802175:	8b 04 24             	mov    (%esp),%eax
+  802178:	89 d5                	mov    %edx,%ebp
+  80217a:	09 f0                	or     %esi,%eax
+  80217c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802180:	39 f0                	cmp    %esi,%eax
+  802182:	19 fd                	sbb    %edi,%ebp
+  802184:	72 1d                	jb     8021a3 <__udivmoddi4+0xb3>
+  802186:	29 f0                	sub    %esi,%eax
+  802188:	19 fa                	sbb    %edi,%edx
+  80218a:	89 cf                	mov    %ecx,%edi
+  80218c:	c1 ef 05             	shr    $0x5,%edi
+  80218f:	83 e7 01             	and    $0x1,%edi
+  802192:	89 fe                	mov    %edi,%esi
+  802194:	d3 e7                	shl    %cl,%edi
+  802196:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80219a:	83 f6 01             	xor    $0x1,%esi
+  80219d:	d3 e6                	shl    %cl,%esi
+  80219f:	09 74 24 18          	or     %esi,0x18(%esp)
+  8021a3:	83 e9 01             	sub    $0x1,%ecx
+  8021a6:	73 98                	jae    802140 <__udivmoddi4+0x50>
+  8021a8:	85 db                	test   %ebx,%ebx
+  8021aa:	74 05                	je     8021b1 <__udivmoddi4+0xc1>
+  8021ac:	89 03                	mov    %eax,(%ebx)
+  8021ae:	89 53 04             	mov    %edx,0x4(%ebx)
+  8021b1:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8021b5:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8021b9:	83 c4 24             	add    $0x24,%esp
+  8021bc:	5b                   	pop    %ebx
+  8021bd:	5e                   	pop    %esi
+  8021be:	5f                   	pop    %edi
+  8021bf:	5d                   	pop    %ebp
+  8021c0:	c3                   	ret
+  8021c1:	85 ff                	test   %edi,%edi
+  8021c3:	74 0d                	je     8021d2 <__udivmoddi4+0xe2>
+  8021c5:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  8021cb:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  8021d2:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8021d6:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8021da:	89 44 24 18          	mov    %eax,0x18(%esp)
+  8021de:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8021e2:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  8021e6:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8021ea:	83 c4 24             	add    $0x24,%esp
+  8021ed:	5b                   	pop    %ebx
+  8021ee:	5e                   	pop    %esi
+  8021ef:	5f                   	pop    %edi
+  8021f0:	5d                   	pop    %ebp
+  8021f1:	c3                   	ret
+  8021f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8021f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00802200 <__udivdi3>:
+  802200:	57                   	push   %edi
+  802201:	56                   	push   %esi
+  802202:	53                   	push   %ebx
+  802203:	83 ec 20             	sub    $0x20,%esp
+  802206:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80220a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80220e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802212:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802216:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80221a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80221e:	89 d1                	mov    %edx,%ecx
+  802220:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802224:	09 c1                	or     %eax,%ecx
+  802226:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80222a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80222e:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802232:	0f 84 88 00 00 00    	je     8022c0 <__udivdi3+0xc0>
+  802238:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80223f:	00 
+  802240:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802245:	31 c0                	xor    %eax,%eax
+  802247:	31 d2                	xor    %edx,%edx
+  802249:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802250:	00 
+  802251:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802258:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80225c:	01 c0                	add    %eax,%eax
+  80225e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802265:	00 
+  802266:	89 c6                	mov    %eax,%esi
+  802268:	89 d7                	mov    %edx,%edi
+  80226a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80226e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802272:	0f ad d0             	shrd   %cl,%edx,%eax
+  802275:	d3 ea                	shr    %cl,%edx
+  802277:	f6 c1 20             	test   $0x20,%cl
+  80227a:	0f 45 c2             	cmovne %edx,%eax
+  80227d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802281:	83 e0 01             	and    $0x1,%eax
+  802284:	09 fa                	or     %edi,%edx
+  802286:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80228a:	89 04 24             	mov    %eax,(%esp)
+  80228d:	8b 04 24             	mov    (%esp),%eax
+  802290:	89 d3                	mov    %edx,%ebx
+  802292:	09 f0                	or     %esi,%eax
+  802294:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802298:	39 f0                	cmp    %esi,%eax
+  80229a:	19 fb                	sbb    %edi,%ebx
+  80229c:	72 1d                	jb     8022bb <__udivdi3+0xbb>
+  80229e:	29 f0                	sub    %esi,%eax
+  8022a0:	19 fa                	sbb    %edi,%edx
+  8022a2:	89 cf                	mov    %ecx,%edi
+  8022a4:	c1 ef 05             	shr    $0x5,%edi
+  8022a7:	83 e7 01             	and    $0x1,%edi
+  8022aa:	89 fe                	mov    %edi,%esi
+  8022ac:	d3 e7                	shl    %cl,%edi
+  8022ae:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8022b2:	83 f6 01             	xor    $0x1,%esi
+  8022b5:	d3 e6                	shl    %cl,%esi
+  8022b7:	09 74 24 18          	or     %esi,0x18(%esp)
+  8022bb:	83 e9 01             	sub    $0x1,%ecx
+  8022be:	73 98                	jae    802258 <__udivdi3+0x58>
+  8022c0:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8022c4:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8022c8:	83 c4 20             	add    $0x20,%esp
+  8022cb:	5b                   	pop    %ebx
+  8022cc:	5e                   	pop    %esi
+  8022cd:	5f                   	pop    %edi
+  8022ce:	c3                   	ret
+  8022cf:	90                   	nop
+
+008022d0 <__umoddi3>:
+  8022d0:	57                   	push   %edi
+  8022d1:	56                   	push   %esi
+  8022d2:	53                   	push   %ebx
+  8022d3:	83 ec 18             	sub    $0x18,%esp
+  8022d6:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8022da:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8022de:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8022e2:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8022e6:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8022ea:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8022ee:	89 d1                	mov    %edx,%ecx
+  8022f0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8022f4:	09 c1                	or     %eax,%ecx
+  8022f6:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8022fa:	74 5b                	je     802357 <__umoddi3+0x87>
+  8022fc:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802301:	31 c0                	xor    %eax,%eax
+  802303:	31 d2                	xor    %edx,%edx
+  802305:	8d 76 00             	lea    0x0(%esi),%esi
+  802308:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80230c:	01 c0                	add    %eax,%eax
+  80230e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802315:	00 
+  802316:	89 c6                	mov    %eax,%esi
+  802318:	89 d7                	mov    %edx,%edi
+  80231a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80231e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802322:	0f ad d0             	shrd   %cl,%edx,%eax
+  802325:	d3 ea                	shr    %cl,%edx
+  802327:	f6 c1 20             	test   $0x20,%cl
+  80232a:	0f 45 c2             	cmovne %edx,%eax
+  80232d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802331:	83 e0 01             	and    $0x1,%eax
+  802334:	09 fa                	or     %edi,%edx
+  802336:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80233a:	89 04 24             	mov    %eax,(%esp)
+  80233d:	8b 04 24             	mov    (%esp),%eax
+  802340:	89 d3                	mov    %edx,%ebx
+  802342:	09 f0                	or     %esi,%eax
+  802344:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802348:	39 f0                	cmp    %esi,%eax
+  80234a:	19 fb                	sbb    %edi,%ebx
+  80234c:	72 04                	jb     802352 <__umoddi3+0x82>
+  80234e:	29 f0                	sub    %esi,%eax
+  802350:	19 fa                	sbb    %edi,%edx
+  802352:	83 e9 01             	sub    $0x1,%ecx
+  802355:	73 b1                	jae    802308 <__umoddi3+0x38>
+  802357:	83 c4 18             	add    $0x18,%esp
+  80235a:	5b                   	pop    %ebx
+  80235b:	5e                   	pop    %esi
+  80235c:	5f                   	pop    %edi
+  80235d:	c3                   	ret
+  80235e:	66 90                	xchg   %ax,%ax
+
+00802360 <__divdi3>:
+  802360:	55                   	push   %ebp
+  802361:	57                   	push   %edi
+  802362:	56                   	push   %esi
+  802363:	53                   	push   %ebx
+  802364:	83 ec 24             	sub    $0x24,%esp
+  802367:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  80236b:	8b 74 24 44          	mov    0x44(%esp),%esi
+  80236f:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802373:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802377:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  80237b:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  80237f:	85 d2                	test   %edx,%edx
+  802381:	0f 88 e0 00 00 00    	js     802467 <__divdi3+0x107>
+  802387:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  80238b:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  80238f:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802393:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802397:	85 f6                	test   %esi,%esi
+  802399:	78 16                	js     8023b1 <__divdi3+0x51>
+  80239b:	89 f1                	mov    %esi,%ecx
+  80239d:	31 c0                	xor    %eax,%eax
+  80239f:	31 d2                	xor    %edx,%edx
+  8023a1:	09 d9                	or     %ebx,%ecx
+  8023a3:	0f 85 f3 00 00 00    	jne    80249c <__divdi3+0x13c>
+  8023a9:	83 c4 24             	add    $0x24,%esp
+  8023ac:	5b                   	pop    %ebx
+  8023ad:	5e                   	pop    %esi
+  8023ae:	5f                   	pop    %edi
+  8023af:	5d                   	pop    %ebp
+  8023b0:	c3                   	ret
+  8023b1:	bf 01 00 00 00       	mov    $0x1,%edi
+  8023b6:	f7 5c 24 08          	negl   0x8(%esp)
+  8023ba:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  8023bf:	f7 5c 24 0c          	negl   0xc(%esp)
+  8023c3:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8023ca:	00 
+  8023cb:	31 c0                	xor    %eax,%eax
+  8023cd:	31 d2                	xor    %edx,%edx
+  8023cf:	89 fb                	mov    %edi,%ebx
+  8023d1:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8023d8:	00 
+  8023d9:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8023de:	66 90                	xchg   %ax,%ax
+  8023e0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8023e4:	01 c0                	add    %eax,%eax
+  8023e6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8023ed:	00 
+  8023ee:	89 c6                	mov    %eax,%esi
+  8023f0:	89 d7                	mov    %edx,%edi
+  8023f2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8023f6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8023fa:	0f ad d0             	shrd   %cl,%edx,%eax
+  8023fd:	d3 ea                	shr    %cl,%edx
+  8023ff:	f6 c1 20             	test   $0x20,%cl
+  802402:	0f 45 c2             	cmovne %edx,%eax
+  802405:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802409:	83 e0 01             	and    $0x1,%eax
+  80240c:	09 fa                	or     %edi,%edx
+  80240e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802412:	89 04 24             	mov    %eax,(%esp)
+  802415:	8b 04 24             	mov    (%esp),%eax
+  802418:	89 d5                	mov    %edx,%ebp
+  80241a:	09 f0                	or     %esi,%eax
+  80241c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802420:	39 f0                	cmp    %esi,%eax
+  802422:	19 fd                	sbb    %edi,%ebp
+  802424:	72 1d                	jb     802443 <__divdi3+0xe3>
+  802426:	29 f0                	sub    %esi,%eax
+  802428:	19 fa                	sbb    %edi,%edx
+  80242a:	89 cf                	mov    %ecx,%edi
+  80242c:	c1 ef 05             	shr    $0x5,%edi
+  80242f:	83 e7 01             	and    $0x1,%edi
+  802432:	89 fe                	mov    %edi,%esi
+  802434:	d3 e7                	shl    %cl,%edi
+  802436:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80243a:	83 f6 01             	xor    $0x1,%esi
+  80243d:	d3 e6                	shl    %cl,%esi
+  80243f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802443:	83 e9 01             	sub    $0x1,%ecx
+  802446:	73 98                	jae    8023e0 <__divdi3+0x80>
+  802448:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80244c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802450:	85 db                	test   %ebx,%ebx
+  802452:	0f 84 51 ff ff ff    	je     8023a9 <__divdi3+0x49>
+  802458:	f7 d8                	neg    %eax
+  80245a:	83 d2 00             	adc    $0x0,%edx
+  80245d:	83 c4 24             	add    $0x24,%esp
+  802460:	5b                   	pop    %ebx
+  802461:	f7 da                	neg    %edx
+  802463:	5e                   	pop    %esi
+  802464:	5f                   	pop    %edi
+  802465:	5d                   	pop    %ebp
+  802466:	c3                   	ret
+  802467:	f7 d8                	neg    %eax
+  802469:	83 d2 00             	adc    $0x0,%edx
+  80246c:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802470:	f7 da                	neg    %edx
+  802472:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802476:	85 f6                	test   %esi,%esi
+  802478:	78 1b                	js     802495 <__divdi3+0x135>
+  80247a:	89 f1                	mov    %esi,%ecx
+  80247c:	31 c0                	xor    %eax,%eax
+  80247e:	31 d2                	xor    %edx,%edx
+  802480:	bf 01 00 00 00       	mov    $0x1,%edi
+  802485:	09 d9                	or     %ebx,%ecx
+  802487:	0f 85 36 ff ff ff    	jne    8023c3 <__divdi3+0x63>
+  80248d:	83 c4 24             	add    $0x24,%esp
+  802490:	5b                   	pop    %ebx
+  802491:	5e                   	pop    %esi
+  802492:	5f                   	pop    %edi
+  802493:	5d                   	pop    %ebp
+  802494:	c3                   	ret
+  802495:	31 ff                	xor    %edi,%edi
+  802497:	e9 1a ff ff ff       	jmp    8023b6 <__divdi3+0x56>
+  80249c:	31 ff                	xor    %edi,%edi
+  80249e:	e9 20 ff ff ff       	jmp    8023c3 <__divdi3+0x63>
+  8024a3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8024aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+008024b0 <__moddi3>:
+  8024b0:	55                   	push   %ebp
+  8024b1:	57                   	push   %edi
+  8024b2:	56                   	push   %esi
+  8024b3:	53                   	push   %ebx
+  8024b4:	83 ec 1c             	sub    $0x1c,%esp
+  8024b7:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  8024bb:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  8024bf:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  8024c3:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  8024c7:	89 c8                	mov    %ecx,%eax
+  8024c9:	89 f2                	mov    %esi,%edx
+  8024cb:	89 f3                	mov    %esi,%ebx
+  8024cd:	85 ed                	test   %ebp,%ebp
+  8024cf:	0f 88 9d 00 00 00    	js     802572 <__moddi3+0xc2>
+  8024d5:	09 cb                	or     %ecx,%ebx
+  8024d7:	0f 84 8d 00 00 00    	je     80256a <__moddi3+0xba>
+  8024dd:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  8024e1:	31 db                	xor    %ebx,%ebx
+  8024e3:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  8024e7:	89 ca                	mov    %ecx,%edx
+  8024e9:	89 f0                	mov    %esi,%eax
+  8024eb:	89 dd                	mov    %ebx,%ebp
+  8024ed:	f7 da                	neg    %edx
+  8024ef:	83 d0 00             	adc    $0x0,%eax
+  8024f2:	f7 d8                	neg    %eax
+  8024f4:	0f 49 f0             	cmovns %eax,%esi
+  8024f7:	0f 49 ca             	cmovns %edx,%ecx
+  8024fa:	31 c0                	xor    %eax,%eax
+  8024fc:	31 d2                	xor    %edx,%edx
+  8024fe:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802502:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802506:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80250b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80250f:	90                   	nop
+  802510:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802514:	01 c0                	add    %eax,%eax
+  802516:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80251d:	00 
+  80251e:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  802522:	89 c6                	mov    %eax,%esi
+  802524:	89 d7                	mov    %edx,%edi
+  802526:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80252a:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80252e:	0f ad d0             	shrd   %cl,%edx,%eax
+  802531:	d3 ea                	shr    %cl,%edx
+  802533:	f6 c1 20             	test   $0x20,%cl
+  802536:	0f 45 c2             	cmovne %edx,%eax
+  802539:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80253d:	83 e0 01             	and    $0x1,%eax
+  802540:	09 fa                	or     %edi,%edx
+  802542:	89 04 24             	mov    %eax,(%esp)
+  802545:	8b 04 24             	mov    (%esp),%eax
+  802548:	89 d7                	mov    %edx,%edi
+  80254a:	09 f0                	or     %esi,%eax
+  80254c:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  802550:	39 d8                	cmp    %ebx,%eax
+  802552:	19 f7                	sbb    %esi,%edi
+  802554:	72 04                	jb     80255a <__moddi3+0xaa>
+  802556:	29 d8                	sub    %ebx,%eax
+  802558:	19 f2                	sbb    %esi,%edx
+  80255a:	83 e9 01             	sub    $0x1,%ecx
+  80255d:	73 b1                	jae    802510 <__moddi3+0x60>
+  80255f:	85 ed                	test   %ebp,%ebp
+  802561:	74 07                	je     80256a <__moddi3+0xba>
+  802563:	f7 d8                	neg    %eax
+  802565:	83 d2 00             	adc    $0x0,%edx
+  802568:	f7 da                	neg    %edx
+  80256a:	83 c4 1c             	add    $0x1c,%esp
+  80256d:	5b                   	pop    %ebx
+  80256e:	5e                   	pop    %esi
+  80256f:	5f                   	pop    %edi
+  802570:	5d                   	pop    %ebp
+  802571:	c3                   	ret
+  802572:	09 cb                	or     %ecx,%ebx
+  802574:	74 f4                	je     80256a <__moddi3+0xba>
+  802576:	f7 df                	neg    %edi
+  802578:	bb 01 00 00 00       	mov    $0x1,%ebx
+  80257d:	83 d5 00             	adc    $0x0,%ebp
+  802580:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802584:	f7 dd                	neg    %ebp
+  802586:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  80258a:	e9 58 ff ff ff       	jmp    8024e7 <__moddi3+0x37>
@@ -0,0 +1,5245 @@
+
+obj/user/testexec.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 03 00 00 00       	call   800034 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  if ((r = execl("/init", "init", "initarg1", "initarg2", (char*)0)) < 0)
+    panic("testexec: exec /init: %e\n", r);
+
+  cprintf("SHOULD HAVE DIED\n");
+#endif
+}
+  800033:	c3                   	ret
+
+00800034 <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  800034:	55                   	push   %ebp
+  800035:	89 e5                	mov    %esp,%ebp
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80003c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  80003f:	e8 d1 00 00 00       	call   800115 <sys_getenvid>
+  800044:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800049:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80004c:	c1 e0 04             	shl    $0x4,%eax
+  80004f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800054:	a3 08 40 80 00       	mov    %eax,0x804008
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800059:	85 db                	test   %ebx,%ebx
+  80005b:	7e 07                	jle    800064 <libmain+0x30>
+    binaryname = argv[0];
+  80005d:	8b 06                	mov    (%esi),%eax
+  80005f:	a3 00 30 80 00       	mov    %eax,0x803000
+
+  // call user main routine
+  umain(argc, argv);
+  800064:	83 ec 08             	sub    $0x8,%esp
+  800067:	56                   	push   %esi
+  800068:	53                   	push   %ebx
+  800069:	e8 c5 ff ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  80006e:	e8 0a 00 00 00       	call   80007d <exit>
+}
+  800073:	83 c4 10             	add    $0x10,%esp
+  800076:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800079:	5b                   	pop    %ebx
+  80007a:	5e                   	pop    %esi
+  80007b:	5d                   	pop    %ebp
+  80007c:	c3                   	ret
+
+0080007d <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80007d:	55                   	push   %ebp
+  80007e:	89 e5                	mov    %esp,%ebp
+  800080:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800083:	e8 72 05 00 00       	call   8005fa <close_all>
+	sys_env_destroy(0);
+  800088:	83 ec 0c             	sub    $0xc,%esp
+  80008b:	6a 00                	push   $0x0
+  80008d:	e8 42 00 00 00       	call   8000d4 <sys_env_destroy>
+}
+  800092:	83 c4 10             	add    $0x10,%esp
+  800095:	c9                   	leave
+  800096:	c3                   	ret
+
+00800097 <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800097:	55                   	push   %ebp
+  800098:	89 e5                	mov    %esp,%ebp
+  80009a:	57                   	push   %edi
+  80009b:	56                   	push   %esi
+  80009c:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80009d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000a5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000a8:	89 c3                	mov    %eax,%ebx
+  8000aa:	89 c7                	mov    %eax,%edi
+  8000ac:	89 c6                	mov    %eax,%esi
+  8000ae:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  8000b0:	5b                   	pop    %ebx
+  8000b1:	5e                   	pop    %esi
+  8000b2:	5f                   	pop    %edi
+  8000b3:	5d                   	pop    %ebp
+  8000b4:	c3                   	ret
+
+008000b5 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8000b5:	55                   	push   %ebp
+  8000b6:	89 e5                	mov    %esp,%ebp
+  8000b8:	57                   	push   %edi
+  8000b9:	56                   	push   %esi
+  8000ba:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8000bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000c5:	89 d1                	mov    %edx,%ecx
+  8000c7:	89 d3                	mov    %edx,%ebx
+  8000c9:	89 d7                	mov    %edx,%edi
+  8000cb:	89 d6                	mov    %edx,%esi
+  8000cd:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8000cf:	5b                   	pop    %ebx
+  8000d0:	5e                   	pop    %esi
+  8000d1:	5f                   	pop    %edi
+  8000d2:	5d                   	pop    %ebp
+  8000d3:	c3                   	ret
+
+008000d4 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8000d4:	55                   	push   %ebp
+  8000d5:	89 e5                	mov    %esp,%ebp
+  8000d7:	57                   	push   %edi
+  8000d8:	56                   	push   %esi
+  8000d9:	53                   	push   %ebx
+  8000da:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8000dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000e5:	b8 03 00 00 00       	mov    $0x3,%eax
+  8000ea:	89 cb                	mov    %ecx,%ebx
+  8000ec:	89 cf                	mov    %ecx,%edi
+  8000ee:	89 ce                	mov    %ecx,%esi
+  8000f0:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8000f2:	85 c0                	test   %eax,%eax
+  8000f4:	7f 08                	jg     8000fe <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  8000f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000f9:	5b                   	pop    %ebx
+  8000fa:	5e                   	pop    %esi
+  8000fb:	5f                   	pop    %edi
+  8000fc:	5d                   	pop    %ebp
+  8000fd:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8000fe:	83 ec 0c             	sub    $0xc,%esp
+  800101:	50                   	push   %eax
+  800102:	6a 03                	push   $0x3
+  800104:	68 ea 24 80 00       	push   $0x8024ea
+  800109:	6a 3e                	push   $0x3e
+  80010b:	68 07 25 80 00       	push   $0x802507
+  800110:	e8 22 14 00 00       	call   801537 <_panic>
+
+00800115 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800115:	55                   	push   %ebp
+  800116:	89 e5                	mov    %esp,%ebp
+  800118:	57                   	push   %edi
+  800119:	56                   	push   %esi
+  80011a:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80011b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800120:	b8 02 00 00 00       	mov    $0x2,%eax
+  800125:	89 d1                	mov    %edx,%ecx
+  800127:	89 d3                	mov    %edx,%ebx
+  800129:	89 d7                	mov    %edx,%edi
+  80012b:	89 d6                	mov    %edx,%esi
+  80012d:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  80012f:	5b                   	pop    %ebx
+  800130:	5e                   	pop    %esi
+  800131:	5f                   	pop    %edi
+  800132:	5d                   	pop    %ebp
+  800133:	c3                   	ret
+
+00800134 <sys_yield>:
+
+void
+sys_yield(void) {
+  800134:	55                   	push   %ebp
+  800135:	89 e5                	mov    %esp,%ebp
+  800137:	57                   	push   %edi
+  800138:	56                   	push   %esi
+  800139:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80013a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80013f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800144:	89 d1                	mov    %edx,%ecx
+  800146:	89 d3                	mov    %edx,%ebx
+  800148:	89 d7                	mov    %edx,%edi
+  80014a:	89 d6                	mov    %edx,%esi
+  80014c:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  80014e:	5b                   	pop    %ebx
+  80014f:	5e                   	pop    %esi
+  800150:	5f                   	pop    %edi
+  800151:	5d                   	pop    %ebp
+  800152:	c3                   	ret
+
+00800153 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  800153:	55                   	push   %ebp
+  800154:	89 e5                	mov    %esp,%ebp
+  800156:	57                   	push   %edi
+  800157:	56                   	push   %esi
+  800158:	53                   	push   %ebx
+  800159:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  80015c:	be 00 00 00 00       	mov    $0x0,%esi
+  800161:	8b 55 08             	mov    0x8(%ebp),%edx
+  800164:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800167:	b8 04 00 00 00       	mov    $0x4,%eax
+  80016c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80016f:	89 f7                	mov    %esi,%edi
+  800171:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800173:	85 c0                	test   %eax,%eax
+  800175:	7f 08                	jg     80017f <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800177:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80017a:	5b                   	pop    %ebx
+  80017b:	5e                   	pop    %esi
+  80017c:	5f                   	pop    %edi
+  80017d:	5d                   	pop    %ebp
+  80017e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80017f:	83 ec 0c             	sub    $0xc,%esp
+  800182:	50                   	push   %eax
+  800183:	6a 04                	push   $0x4
+  800185:	68 ea 24 80 00       	push   $0x8024ea
+  80018a:	6a 3e                	push   $0x3e
+  80018c:	68 07 25 80 00       	push   $0x802507
+  800191:	e8 a1 13 00 00       	call   801537 <_panic>
+
+00800196 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  800196:	55                   	push   %ebp
+  800197:	89 e5                	mov    %esp,%ebp
+  800199:	57                   	push   %edi
+  80019a:	56                   	push   %esi
+  80019b:	53                   	push   %ebx
+  80019c:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  80019f:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001a2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001a5:	b8 05 00 00 00       	mov    $0x5,%eax
+  8001aa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001ad:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8001b0:	8b 75 18             	mov    0x18(%ebp),%esi
+  8001b3:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8001b5:	85 c0                	test   %eax,%eax
+  8001b7:	7f 08                	jg     8001c1 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  8001b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001bc:	5b                   	pop    %ebx
+  8001bd:	5e                   	pop    %esi
+  8001be:	5f                   	pop    %edi
+  8001bf:	5d                   	pop    %ebp
+  8001c0:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8001c1:	83 ec 0c             	sub    $0xc,%esp
+  8001c4:	50                   	push   %eax
+  8001c5:	6a 05                	push   $0x5
+  8001c7:	68 ea 24 80 00       	push   $0x8024ea
+  8001cc:	6a 3e                	push   $0x3e
+  8001ce:	68 07 25 80 00       	push   $0x802507
+  8001d3:	e8 5f 13 00 00       	call   801537 <_panic>
+
+008001d8 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  8001d8:	55                   	push   %ebp
+  8001d9:	89 e5                	mov    %esp,%ebp
+  8001db:	57                   	push   %edi
+  8001dc:	56                   	push   %esi
+  8001dd:	53                   	push   %ebx
+  8001de:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8001e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001ec:	b8 06 00 00 00       	mov    $0x6,%eax
+  8001f1:	89 df                	mov    %ebx,%edi
+  8001f3:	89 de                	mov    %ebx,%esi
+  8001f5:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8001f7:	85 c0                	test   %eax,%eax
+  8001f9:	7f 08                	jg     800203 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  8001fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001fe:	5b                   	pop    %ebx
+  8001ff:	5e                   	pop    %esi
+  800200:	5f                   	pop    %edi
+  800201:	5d                   	pop    %ebp
+  800202:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800203:	83 ec 0c             	sub    $0xc,%esp
+  800206:	50                   	push   %eax
+  800207:	6a 06                	push   $0x6
+  800209:	68 ea 24 80 00       	push   $0x8024ea
+  80020e:	6a 3e                	push   $0x3e
+  800210:	68 07 25 80 00       	push   $0x802507
+  800215:	e8 1d 13 00 00       	call   801537 <_panic>
+
+0080021a <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80021a:	55                   	push   %ebp
+  80021b:	89 e5                	mov    %esp,%ebp
+  80021d:	57                   	push   %edi
+  80021e:	56                   	push   %esi
+  80021f:	53                   	push   %ebx
+  800220:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800223:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800228:	8b 55 08             	mov    0x8(%ebp),%edx
+  80022b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80022e:	b8 08 00 00 00       	mov    $0x8,%eax
+  800233:	89 df                	mov    %ebx,%edi
+  800235:	89 de                	mov    %ebx,%esi
+  800237:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800239:	85 c0                	test   %eax,%eax
+  80023b:	7f 08                	jg     800245 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  80023d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800240:	5b                   	pop    %ebx
+  800241:	5e                   	pop    %esi
+  800242:	5f                   	pop    %edi
+  800243:	5d                   	pop    %ebp
+  800244:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800245:	83 ec 0c             	sub    $0xc,%esp
+  800248:	50                   	push   %eax
+  800249:	6a 08                	push   $0x8
+  80024b:	68 ea 24 80 00       	push   $0x8024ea
+  800250:	6a 3e                	push   $0x3e
+  800252:	68 07 25 80 00       	push   $0x802507
+  800257:	e8 db 12 00 00       	call   801537 <_panic>
+
+0080025c <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80025c:	55                   	push   %ebp
+  80025d:	89 e5                	mov    %esp,%ebp
+  80025f:	57                   	push   %edi
+  800260:	56                   	push   %esi
+  800261:	53                   	push   %ebx
+  800262:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800265:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80026a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80026d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800270:	b8 09 00 00 00       	mov    $0x9,%eax
+  800275:	89 df                	mov    %ebx,%edi
+  800277:	89 de                	mov    %ebx,%esi
+  800279:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80027b:	85 c0                	test   %eax,%eax
+  80027d:	7f 08                	jg     800287 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  80027f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800282:	5b                   	pop    %ebx
+  800283:	5e                   	pop    %esi
+  800284:	5f                   	pop    %edi
+  800285:	5d                   	pop    %ebp
+  800286:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800287:	83 ec 0c             	sub    $0xc,%esp
+  80028a:	50                   	push   %eax
+  80028b:	6a 09                	push   $0x9
+  80028d:	68 ea 24 80 00       	push   $0x8024ea
+  800292:	6a 3e                	push   $0x3e
+  800294:	68 07 25 80 00       	push   $0x802507
+  800299:	e8 99 12 00 00       	call   801537 <_panic>
+
+0080029e <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80029e:	55                   	push   %ebp
+  80029f:	89 e5                	mov    %esp,%ebp
+  8002a1:	57                   	push   %edi
+  8002a2:	56                   	push   %esi
+  8002a3:	53                   	push   %ebx
+  8002a4:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8002a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002af:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002b2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8002b7:	89 df                	mov    %ebx,%edi
+  8002b9:	89 de                	mov    %ebx,%esi
+  8002bb:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8002bd:	85 c0                	test   %eax,%eax
+  8002bf:	7f 08                	jg     8002c9 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8002c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002c4:	5b                   	pop    %ebx
+  8002c5:	5e                   	pop    %esi
+  8002c6:	5f                   	pop    %edi
+  8002c7:	5d                   	pop    %ebp
+  8002c8:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8002c9:	83 ec 0c             	sub    $0xc,%esp
+  8002cc:	50                   	push   %eax
+  8002cd:	6a 0a                	push   $0xa
+  8002cf:	68 ea 24 80 00       	push   $0x8024ea
+  8002d4:	6a 3e                	push   $0x3e
+  8002d6:	68 07 25 80 00       	push   $0x802507
+  8002db:	e8 57 12 00 00       	call   801537 <_panic>
+
+008002e0 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  8002e0:	55                   	push   %ebp
+  8002e1:	89 e5                	mov    %esp,%ebp
+  8002e3:	57                   	push   %edi
+  8002e4:	56                   	push   %esi
+  8002e5:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8002e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002ec:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8002f1:	be 00 00 00 00       	mov    $0x0,%esi
+  8002f6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8002f9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8002fc:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8002fe:	5b                   	pop    %ebx
+  8002ff:	5e                   	pop    %esi
+  800300:	5f                   	pop    %edi
+  800301:	5d                   	pop    %ebp
+  800302:	c3                   	ret
+
+00800303 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  800303:	55                   	push   %ebp
+  800304:	89 e5                	mov    %esp,%ebp
+  800306:	57                   	push   %edi
+  800307:	56                   	push   %esi
+  800308:	53                   	push   %ebx
+  800309:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  80030c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800311:	8b 55 08             	mov    0x8(%ebp),%edx
+  800314:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800319:	89 cb                	mov    %ecx,%ebx
+  80031b:	89 cf                	mov    %ecx,%edi
+  80031d:	89 ce                	mov    %ecx,%esi
+  80031f:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800321:	85 c0                	test   %eax,%eax
+  800323:	7f 08                	jg     80032d <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  800325:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800328:	5b                   	pop    %ebx
+  800329:	5e                   	pop    %esi
+  80032a:	5f                   	pop    %edi
+  80032b:	5d                   	pop    %ebp
+  80032c:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80032d:	83 ec 0c             	sub    $0xc,%esp
+  800330:	50                   	push   %eax
+  800331:	6a 0d                	push   $0xd
+  800333:	68 ea 24 80 00       	push   $0x8024ea
+  800338:	6a 3e                	push   $0x3e
+  80033a:	68 07 25 80 00       	push   $0x802507
+  80033f:	e8 f3 11 00 00       	call   801537 <_panic>
+
+00800344 <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  800344:	55                   	push   %ebp
+  800345:	89 e5                	mov    %esp,%ebp
+  800347:	57                   	push   %edi
+  800348:	56                   	push   %esi
+  800349:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80034a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80034f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800352:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800355:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80035a:	89 df                	mov    %ebx,%edi
+  80035c:	89 de                	mov    %ebx,%esi
+  80035e:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  800360:	5b                   	pop    %ebx
+  800361:	5e                   	pop    %esi
+  800362:	5f                   	pop    %edi
+  800363:	5d                   	pop    %ebp
+  800364:	c3                   	ret
+
+00800365 <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  800365:	55                   	push   %ebp
+  800366:	89 e5                	mov    %esp,%ebp
+  800368:	57                   	push   %edi
+  800369:	56                   	push   %esi
+  80036a:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80036b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800370:	8b 55 08             	mov    0x8(%ebp),%edx
+  800373:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800378:	89 cb                	mov    %ecx,%ebx
+  80037a:	89 cf                	mov    %ecx,%edi
+  80037c:	89 ce                	mov    %ecx,%esi
+  80037e:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  800380:	5b                   	pop    %ebx
+  800381:	5e                   	pop    %esi
+  800382:	5f                   	pop    %edi
+  800383:	5d                   	pop    %ebp
+  800384:	c3                   	ret
+
+00800385 <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  800385:	55                   	push   %ebp
+  800386:	89 e5                	mov    %esp,%ebp
+  800388:	57                   	push   %edi
+  800389:	56                   	push   %esi
+  80038a:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80038b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800390:	b8 10 00 00 00       	mov    $0x10,%eax
+  800395:	89 d1                	mov    %edx,%ecx
+  800397:	89 d3                	mov    %edx,%ebx
+  800399:	89 d7                	mov    %edx,%edi
+  80039b:	89 d6                	mov    %edx,%esi
+  80039d:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80039f:	5b                   	pop    %ebx
+  8003a0:	5e                   	pop    %esi
+  8003a1:	5f                   	pop    %edi
+  8003a2:	5d                   	pop    %ebp
+  8003a3:	c3                   	ret
+
+008003a4 <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  8003a4:	55                   	push   %ebp
+  8003a5:	89 e5                	mov    %esp,%ebp
+  8003a7:	57                   	push   %edi
+  8003a8:	56                   	push   %esi
+  8003a9:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8003aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003af:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003b2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003b5:	b8 11 00 00 00       	mov    $0x11,%eax
+  8003ba:	89 df                	mov    %ebx,%edi
+  8003bc:	89 de                	mov    %ebx,%esi
+  8003be:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  8003c0:	5b                   	pop    %ebx
+  8003c1:	5e                   	pop    %esi
+  8003c2:	5f                   	pop    %edi
+  8003c3:	5d                   	pop    %ebp
+  8003c4:	c3                   	ret
+
+008003c5 <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  8003c5:	55                   	push   %ebp
+  8003c6:	89 e5                	mov    %esp,%ebp
+  8003c8:	57                   	push   %edi
+  8003c9:	56                   	push   %esi
+  8003ca:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8003cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003d3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003d6:	b8 12 00 00 00       	mov    $0x12,%eax
+  8003db:	89 df                	mov    %ebx,%edi
+  8003dd:	89 de                	mov    %ebx,%esi
+  8003df:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  8003e1:	5b                   	pop    %ebx
+  8003e2:	5e                   	pop    %esi
+  8003e3:	5f                   	pop    %edi
+  8003e4:	5d                   	pop    %ebp
+  8003e5:	c3                   	ret
+
+008003e6 <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  8003e6:	55                   	push   %ebp
+  8003e7:	89 e5                	mov    %esp,%ebp
+  8003e9:	57                   	push   %edi
+  8003ea:	56                   	push   %esi
+  8003eb:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8003ec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8003f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003f4:	b8 13 00 00 00       	mov    $0x13,%eax
+  8003f9:	89 cb                	mov    %ecx,%ebx
+  8003fb:	89 cf                	mov    %ecx,%edi
+  8003fd:	89 ce                	mov    %ecx,%esi
+  8003ff:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  800401:	5b                   	pop    %ebx
+  800402:	5e                   	pop    %esi
+  800403:	5f                   	pop    %edi
+  800404:	5d                   	pop    %ebp
+  800405:	c3                   	ret
+
+00800406 <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  800406:	55                   	push   %ebp
+  800407:	89 e5                	mov    %esp,%ebp
+  800409:	57                   	push   %edi
+  80040a:	56                   	push   %esi
+  80040b:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80040c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800411:	8b 55 08             	mov    0x8(%ebp),%edx
+  800414:	b8 14 00 00 00       	mov    $0x14,%eax
+  800419:	89 cb                	mov    %ecx,%ebx
+  80041b:	89 cf                	mov    %ecx,%edi
+  80041d:	89 ce                	mov    %ecx,%esi
+  80041f:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  800421:	5b                   	pop    %ebx
+  800422:	5e                   	pop    %esi
+  800423:	5f                   	pop    %edi
+  800424:	5d                   	pop    %ebp
+  800425:	c3                   	ret
+
+00800426 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800426:	55                   	push   %ebp
+  800427:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800429:	8b 45 08             	mov    0x8(%ebp),%eax
+  80042c:	05 00 00 00 30       	add    $0x30000000,%eax
+  800431:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800434:	5d                   	pop    %ebp
+  800435:	c3                   	ret
+
+00800436 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800436:	55                   	push   %ebp
+  800437:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800439:	8b 45 08             	mov    0x8(%ebp),%eax
+  80043c:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800441:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800446:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80044b:	5d                   	pop    %ebp
+  80044c:	c3                   	ret
+
+0080044d <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80044d:	55                   	push   %ebp
+  80044e:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  800450:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800455:	eb 02                	jmp    800459 <fd_alloc+0xc>
+  800457:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800459:	89 c2                	mov    %eax,%edx
+  80045b:	c1 ea 16             	shr    $0x16,%edx
+  80045e:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800465:	f6 c2 01             	test   $0x1,%dl
+  800468:	74 2b                	je     800495 <fd_alloc+0x48>
+  80046a:	89 c2                	mov    %eax,%edx
+  80046c:	c1 ea 0c             	shr    $0xc,%edx
+  80046f:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  800476:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80047c:	f6 c1 01             	test   $0x1,%cl
+  80047f:	74 14                	je     800495 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  800481:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  800487:	75 ce                	jne    800457 <fd_alloc+0xa>
+  800489:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80048e:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800493:	eb 05                	jmp    80049a <fd_alloc+0x4d>
+			return 0;
+  800495:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80049a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80049d:	89 02                	mov    %eax,(%edx)
+}
+  80049f:	89 c8                	mov    %ecx,%eax
+  8004a1:	5d                   	pop    %ebp
+  8004a2:	c3                   	ret
+
+008004a3 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8004a3:	55                   	push   %ebp
+  8004a4:	89 e5                	mov    %esp,%ebp
+  8004a6:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8004a9:	83 f8 1f             	cmp    $0x1f,%eax
+  8004ac:	77 30                	ja     8004de <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8004ae:	c1 e0 0c             	shl    $0xc,%eax
+  8004b1:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8004b6:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8004bc:	f6 c2 01             	test   $0x1,%dl
+  8004bf:	74 24                	je     8004e5 <fd_lookup+0x42>
+  8004c1:	89 c2                	mov    %eax,%edx
+  8004c3:	c1 ea 0c             	shr    $0xc,%edx
+  8004c6:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8004cd:	f6 c2 01             	test   $0x1,%dl
+  8004d0:	74 1a                	je     8004ec <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8004d2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8004d5:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8004d7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8004dc:	5d                   	pop    %ebp
+  8004dd:	c3                   	ret
+		return -E_INVAL;
+  8004de:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8004e3:	eb f7                	jmp    8004dc <fd_lookup+0x39>
+		return -E_INVAL;
+  8004e5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8004ea:	eb f0                	jmp    8004dc <fd_lookup+0x39>
+  8004ec:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8004f1:	eb e9                	jmp    8004dc <fd_lookup+0x39>
+
+008004f3 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8004f3:	55                   	push   %ebp
+  8004f4:	89 e5                	mov    %esp,%ebp
+  8004f6:	53                   	push   %ebx
+  8004f7:	83 ec 04             	sub    $0x4,%esp
+  8004fa:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8004fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800502:	eb 03                	jmp    800507 <dev_lookup+0x14>
+  800504:	83 c0 01             	add    $0x1,%eax
+  800507:	8b 1c 85 94 25 80 00 	mov    0x802594(,%eax,4),%ebx
+  80050e:	85 db                	test   %ebx,%ebx
+  800510:	74 0b                	je     80051d <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  800512:	39 13                	cmp    %edx,(%ebx)
+  800514:	75 ee                	jne    800504 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  800516:	b8 00 00 00 00       	mov    $0x0,%eax
+  80051b:	eb 1f                	jmp    80053c <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80051d:	a1 08 40 80 00       	mov    0x804008,%eax
+  800522:	8b 40 48             	mov    0x48(%eax),%eax
+  800525:	83 ec 04             	sub    $0x4,%esp
+  800528:	52                   	push   %edx
+  800529:	50                   	push   %eax
+  80052a:	68 18 25 80 00       	push   $0x802518
+  80052f:	e8 de 10 00 00       	call   801612 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  800534:	83 c4 10             	add    $0x10,%esp
+  800537:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80053c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80053f:	89 1a                	mov    %ebx,(%edx)
+}
+  800541:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800544:	c9                   	leave
+  800545:	c3                   	ret
+
+00800546 <fd_close>:
+{
+  800546:	55                   	push   %ebp
+  800547:	89 e5                	mov    %esp,%ebp
+  800549:	57                   	push   %edi
+  80054a:	56                   	push   %esi
+  80054b:	53                   	push   %ebx
+  80054c:	83 ec 24             	sub    $0x24,%esp
+  80054f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800552:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800555:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800558:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800559:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80055f:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800562:	50                   	push   %eax
+  800563:	e8 3b ff ff ff       	call   8004a3 <fd_lookup>
+  800568:	89 c3                	mov    %eax,%ebx
+  80056a:	83 c4 10             	add    $0x10,%esp
+  80056d:	85 c0                	test   %eax,%eax
+  80056f:	78 05                	js     800576 <fd_close+0x30>
+	    || fd != fd2)
+  800571:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  800574:	74 16                	je     80058c <fd_close+0x46>
+		return (must_exist ? r : 0);
+  800576:	89 f8                	mov    %edi,%eax
+  800578:	84 c0                	test   %al,%al
+  80057a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80057f:	0f 44 d8             	cmove  %eax,%ebx
+}
+  800582:	89 d8                	mov    %ebx,%eax
+  800584:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800587:	5b                   	pop    %ebx
+  800588:	5e                   	pop    %esi
+  800589:	5f                   	pop    %edi
+  80058a:	5d                   	pop    %ebp
+  80058b:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80058c:	83 ec 08             	sub    $0x8,%esp
+  80058f:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800592:	50                   	push   %eax
+  800593:	ff 36                	push   (%esi)
+  800595:	e8 59 ff ff ff       	call   8004f3 <dev_lookup>
+  80059a:	89 c3                	mov    %eax,%ebx
+  80059c:	83 c4 10             	add    $0x10,%esp
+  80059f:	85 c0                	test   %eax,%eax
+  8005a1:	78 1a                	js     8005bd <fd_close+0x77>
+		if (dev->dev_close)
+  8005a3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005a6:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8005a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8005ae:	85 c0                	test   %eax,%eax
+  8005b0:	74 0b                	je     8005bd <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8005b2:	83 ec 0c             	sub    $0xc,%esp
+  8005b5:	56                   	push   %esi
+  8005b6:	ff d0                	call   *%eax
+  8005b8:	89 c3                	mov    %eax,%ebx
+  8005ba:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8005bd:	83 ec 08             	sub    $0x8,%esp
+  8005c0:	56                   	push   %esi
+  8005c1:	6a 00                	push   $0x0
+  8005c3:	e8 10 fc ff ff       	call   8001d8 <sys_page_unmap>
+	return r;
+  8005c8:	83 c4 10             	add    $0x10,%esp
+  8005cb:	eb b5                	jmp    800582 <fd_close+0x3c>
+
+008005cd <close>:
+
+int
+close(int fdnum)
+{
+  8005cd:	55                   	push   %ebp
+  8005ce:	89 e5                	mov    %esp,%ebp
+  8005d0:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8005d3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8005d6:	50                   	push   %eax
+  8005d7:	ff 75 08             	push   0x8(%ebp)
+  8005da:	e8 c4 fe ff ff       	call   8004a3 <fd_lookup>
+  8005df:	83 c4 10             	add    $0x10,%esp
+  8005e2:	85 c0                	test   %eax,%eax
+  8005e4:	79 02                	jns    8005e8 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8005e6:	c9                   	leave
+  8005e7:	c3                   	ret
+		return fd_close(fd, 1);
+  8005e8:	83 ec 08             	sub    $0x8,%esp
+  8005eb:	6a 01                	push   $0x1
+  8005ed:	ff 75 f4             	push   -0xc(%ebp)
+  8005f0:	e8 51 ff ff ff       	call   800546 <fd_close>
+  8005f5:	83 c4 10             	add    $0x10,%esp
+  8005f8:	eb ec                	jmp    8005e6 <close+0x19>
+
+008005fa <close_all>:
+
+void
+close_all(void)
+{
+  8005fa:	55                   	push   %ebp
+  8005fb:	89 e5                	mov    %esp,%ebp
+  8005fd:	53                   	push   %ebx
+  8005fe:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  800601:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  800606:	83 ec 0c             	sub    $0xc,%esp
+  800609:	53                   	push   %ebx
+  80060a:	e8 be ff ff ff       	call   8005cd <close>
+	for (i = 0; i < MAXFD; i++)
+  80060f:	83 c3 01             	add    $0x1,%ebx
+  800612:	83 c4 10             	add    $0x10,%esp
+  800615:	83 fb 20             	cmp    $0x20,%ebx
+  800618:	75 ec                	jne    800606 <close_all+0xc>
+}
+  80061a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80061d:	c9                   	leave
+  80061e:	c3                   	ret
+
+0080061f <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80061f:	55                   	push   %ebp
+  800620:	89 e5                	mov    %esp,%ebp
+  800622:	57                   	push   %edi
+  800623:	56                   	push   %esi
+  800624:	53                   	push   %ebx
+  800625:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800628:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80062b:	50                   	push   %eax
+  80062c:	ff 75 08             	push   0x8(%ebp)
+  80062f:	e8 6f fe ff ff       	call   8004a3 <fd_lookup>
+  800634:	89 c3                	mov    %eax,%ebx
+  800636:	83 c4 10             	add    $0x10,%esp
+  800639:	85 c0                	test   %eax,%eax
+  80063b:	78 7f                	js     8006bc <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80063d:	83 ec 0c             	sub    $0xc,%esp
+  800640:	ff 75 0c             	push   0xc(%ebp)
+  800643:	e8 85 ff ff ff       	call   8005cd <close>
+
+	newfd = INDEX2FD(newfdnum);
+  800648:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80064b:	c1 e6 0c             	shl    $0xc,%esi
+  80064e:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  800654:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800657:	89 3c 24             	mov    %edi,(%esp)
+  80065a:	e8 d7 fd ff ff       	call   800436 <fd2data>
+  80065f:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  800661:	89 34 24             	mov    %esi,(%esp)
+  800664:	e8 cd fd ff ff       	call   800436 <fd2data>
+  800669:	83 c4 10             	add    $0x10,%esp
+  80066c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80066f:	89 d8                	mov    %ebx,%eax
+  800671:	c1 e8 16             	shr    $0x16,%eax
+  800674:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80067b:	a8 01                	test   $0x1,%al
+  80067d:	74 11                	je     800690 <dup+0x71>
+  80067f:	89 d8                	mov    %ebx,%eax
+  800681:	c1 e8 0c             	shr    $0xc,%eax
+  800684:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80068b:	f6 c2 01             	test   $0x1,%dl
+  80068e:	75 36                	jne    8006c6 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  800690:	89 f8                	mov    %edi,%eax
+  800692:	c1 e8 0c             	shr    $0xc,%eax
+  800695:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80069c:	83 ec 0c             	sub    $0xc,%esp
+  80069f:	25 07 0e 00 00       	and    $0xe07,%eax
+  8006a4:	50                   	push   %eax
+  8006a5:	56                   	push   %esi
+  8006a6:	6a 00                	push   $0x0
+  8006a8:	57                   	push   %edi
+  8006a9:	6a 00                	push   $0x0
+  8006ab:	e8 e6 fa ff ff       	call   800196 <sys_page_map>
+  8006b0:	89 c3                	mov    %eax,%ebx
+  8006b2:	83 c4 20             	add    $0x20,%esp
+  8006b5:	85 c0                	test   %eax,%eax
+  8006b7:	78 33                	js     8006ec <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8006b9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8006bc:	89 d8                	mov    %ebx,%eax
+  8006be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006c1:	5b                   	pop    %ebx
+  8006c2:	5e                   	pop    %esi
+  8006c3:	5f                   	pop    %edi
+  8006c4:	5d                   	pop    %ebp
+  8006c5:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8006c6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8006cd:	83 ec 0c             	sub    $0xc,%esp
+  8006d0:	25 07 0e 00 00       	and    $0xe07,%eax
+  8006d5:	50                   	push   %eax
+  8006d6:	ff 75 d4             	push   -0x2c(%ebp)
+  8006d9:	6a 00                	push   $0x0
+  8006db:	53                   	push   %ebx
+  8006dc:	6a 00                	push   $0x0
+  8006de:	e8 b3 fa ff ff       	call   800196 <sys_page_map>
+  8006e3:	89 c3                	mov    %eax,%ebx
+  8006e5:	83 c4 20             	add    $0x20,%esp
+  8006e8:	85 c0                	test   %eax,%eax
+  8006ea:	79 a4                	jns    800690 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8006ec:	83 ec 08             	sub    $0x8,%esp
+  8006ef:	56                   	push   %esi
+  8006f0:	6a 00                	push   $0x0
+  8006f2:	e8 e1 fa ff ff       	call   8001d8 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8006f7:	83 c4 08             	add    $0x8,%esp
+  8006fa:	ff 75 d4             	push   -0x2c(%ebp)
+  8006fd:	6a 00                	push   $0x0
+  8006ff:	e8 d4 fa ff ff       	call   8001d8 <sys_page_unmap>
+	return r;
+  800704:	83 c4 10             	add    $0x10,%esp
+  800707:	eb b3                	jmp    8006bc <dup+0x9d>
+
+00800709 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  800709:	55                   	push   %ebp
+  80070a:	89 e5                	mov    %esp,%ebp
+  80070c:	56                   	push   %esi
+  80070d:	53                   	push   %ebx
+  80070e:	83 ec 18             	sub    $0x18,%esp
+  800711:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800714:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800717:	50                   	push   %eax
+  800718:	56                   	push   %esi
+  800719:	e8 85 fd ff ff       	call   8004a3 <fd_lookup>
+  80071e:	83 c4 10             	add    $0x10,%esp
+  800721:	85 c0                	test   %eax,%eax
+  800723:	78 3c                	js     800761 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800725:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  800728:	83 ec 08             	sub    $0x8,%esp
+  80072b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80072e:	50                   	push   %eax
+  80072f:	ff 33                	push   (%ebx)
+  800731:	e8 bd fd ff ff       	call   8004f3 <dev_lookup>
+  800736:	83 c4 10             	add    $0x10,%esp
+  800739:	85 c0                	test   %eax,%eax
+  80073b:	78 24                	js     800761 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80073d:	8b 43 08             	mov    0x8(%ebx),%eax
+  800740:	83 e0 03             	and    $0x3,%eax
+  800743:	83 f8 01             	cmp    $0x1,%eax
+  800746:	74 20                	je     800768 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  800748:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80074b:	8b 40 08             	mov    0x8(%eax),%eax
+  80074e:	85 c0                	test   %eax,%eax
+  800750:	74 37                	je     800789 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  800752:	83 ec 04             	sub    $0x4,%esp
+  800755:	ff 75 10             	push   0x10(%ebp)
+  800758:	ff 75 0c             	push   0xc(%ebp)
+  80075b:	53                   	push   %ebx
+  80075c:	ff d0                	call   *%eax
+  80075e:	83 c4 10             	add    $0x10,%esp
+}
+  800761:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800764:	5b                   	pop    %ebx
+  800765:	5e                   	pop    %esi
+  800766:	5d                   	pop    %ebp
+  800767:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800768:	a1 08 40 80 00       	mov    0x804008,%eax
+  80076d:	8b 40 48             	mov    0x48(%eax),%eax
+  800770:	83 ec 04             	sub    $0x4,%esp
+  800773:	56                   	push   %esi
+  800774:	50                   	push   %eax
+  800775:	68 59 25 80 00       	push   $0x802559
+  80077a:	e8 93 0e 00 00       	call   801612 <cprintf>
+		return -E_INVAL;
+  80077f:	83 c4 10             	add    $0x10,%esp
+  800782:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800787:	eb d8                	jmp    800761 <read+0x58>
+		return -E_NOT_SUPP;
+  800789:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80078e:	eb d1                	jmp    800761 <read+0x58>
+
+00800790 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  800790:	55                   	push   %ebp
+  800791:	89 e5                	mov    %esp,%ebp
+  800793:	57                   	push   %edi
+  800794:	56                   	push   %esi
+  800795:	53                   	push   %ebx
+  800796:	83 ec 0c             	sub    $0xc,%esp
+  800799:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80079c:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80079f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8007a4:	eb 02                	jmp    8007a8 <readn+0x18>
+  8007a6:	01 c3                	add    %eax,%ebx
+  8007a8:	39 f3                	cmp    %esi,%ebx
+  8007aa:	73 21                	jae    8007cd <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8007ac:	83 ec 04             	sub    $0x4,%esp
+  8007af:	89 f0                	mov    %esi,%eax
+  8007b1:	29 d8                	sub    %ebx,%eax
+  8007b3:	50                   	push   %eax
+  8007b4:	89 d8                	mov    %ebx,%eax
+  8007b6:	03 45 0c             	add    0xc(%ebp),%eax
+  8007b9:	50                   	push   %eax
+  8007ba:	57                   	push   %edi
+  8007bb:	e8 49 ff ff ff       	call   800709 <read>
+		if (m < 0)
+  8007c0:	83 c4 10             	add    $0x10,%esp
+  8007c3:	85 c0                	test   %eax,%eax
+  8007c5:	78 04                	js     8007cb <readn+0x3b>
+			return m;
+		if (m == 0)
+  8007c7:	75 dd                	jne    8007a6 <readn+0x16>
+  8007c9:	eb 02                	jmp    8007cd <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8007cb:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8007cd:	89 d8                	mov    %ebx,%eax
+  8007cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007d2:	5b                   	pop    %ebx
+  8007d3:	5e                   	pop    %esi
+  8007d4:	5f                   	pop    %edi
+  8007d5:	5d                   	pop    %ebp
+  8007d6:	c3                   	ret
+
+008007d7 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8007d7:	55                   	push   %ebp
+  8007d8:	89 e5                	mov    %esp,%ebp
+  8007da:	56                   	push   %esi
+  8007db:	53                   	push   %ebx
+  8007dc:	83 ec 18             	sub    $0x18,%esp
+  8007df:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8007e2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8007e5:	50                   	push   %eax
+  8007e6:	53                   	push   %ebx
+  8007e7:	e8 b7 fc ff ff       	call   8004a3 <fd_lookup>
+  8007ec:	83 c4 10             	add    $0x10,%esp
+  8007ef:	85 c0                	test   %eax,%eax
+  8007f1:	78 37                	js     80082a <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8007f3:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8007f6:	83 ec 08             	sub    $0x8,%esp
+  8007f9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8007fc:	50                   	push   %eax
+  8007fd:	ff 36                	push   (%esi)
+  8007ff:	e8 ef fc ff ff       	call   8004f3 <dev_lookup>
+  800804:	83 c4 10             	add    $0x10,%esp
+  800807:	85 c0                	test   %eax,%eax
+  800809:	78 1f                	js     80082a <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80080b:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80080f:	74 20                	je     800831 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  800811:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800814:	8b 40 0c             	mov    0xc(%eax),%eax
+  800817:	85 c0                	test   %eax,%eax
+  800819:	74 37                	je     800852 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80081b:	83 ec 04             	sub    $0x4,%esp
+  80081e:	ff 75 10             	push   0x10(%ebp)
+  800821:	ff 75 0c             	push   0xc(%ebp)
+  800824:	56                   	push   %esi
+  800825:	ff d0                	call   *%eax
+  800827:	83 c4 10             	add    $0x10,%esp
+}
+  80082a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80082d:	5b                   	pop    %ebx
+  80082e:	5e                   	pop    %esi
+  80082f:	5d                   	pop    %ebp
+  800830:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800831:	a1 08 40 80 00       	mov    0x804008,%eax
+  800836:	8b 40 48             	mov    0x48(%eax),%eax
+  800839:	83 ec 04             	sub    $0x4,%esp
+  80083c:	53                   	push   %ebx
+  80083d:	50                   	push   %eax
+  80083e:	68 75 25 80 00       	push   $0x802575
+  800843:	e8 ca 0d 00 00       	call   801612 <cprintf>
+		return -E_INVAL;
+  800848:	83 c4 10             	add    $0x10,%esp
+  80084b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800850:	eb d8                	jmp    80082a <write+0x53>
+		return -E_NOT_SUPP;
+  800852:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800857:	eb d1                	jmp    80082a <write+0x53>
+
+00800859 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  800859:	55                   	push   %ebp
+  80085a:	89 e5                	mov    %esp,%ebp
+  80085c:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80085f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800862:	50                   	push   %eax
+  800863:	ff 75 08             	push   0x8(%ebp)
+  800866:	e8 38 fc ff ff       	call   8004a3 <fd_lookup>
+  80086b:	83 c4 10             	add    $0x10,%esp
+  80086e:	85 c0                	test   %eax,%eax
+  800870:	78 0e                	js     800880 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  800872:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800875:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800878:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80087b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800880:	c9                   	leave
+  800881:	c3                   	ret
+
+00800882 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800882:	55                   	push   %ebp
+  800883:	89 e5                	mov    %esp,%ebp
+  800885:	56                   	push   %esi
+  800886:	53                   	push   %ebx
+  800887:	83 ec 18             	sub    $0x18,%esp
+  80088a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80088d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800890:	50                   	push   %eax
+  800891:	53                   	push   %ebx
+  800892:	e8 0c fc ff ff       	call   8004a3 <fd_lookup>
+  800897:	83 c4 10             	add    $0x10,%esp
+  80089a:	85 c0                	test   %eax,%eax
+  80089c:	78 34                	js     8008d2 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80089e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8008a1:	83 ec 08             	sub    $0x8,%esp
+  8008a4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8008a7:	50                   	push   %eax
+  8008a8:	ff 36                	push   (%esi)
+  8008aa:	e8 44 fc ff ff       	call   8004f3 <dev_lookup>
+  8008af:	83 c4 10             	add    $0x10,%esp
+  8008b2:	85 c0                	test   %eax,%eax
+  8008b4:	78 1c                	js     8008d2 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8008b6:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8008ba:	74 1d                	je     8008d9 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8008bc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008bf:	8b 40 18             	mov    0x18(%eax),%eax
+  8008c2:	85 c0                	test   %eax,%eax
+  8008c4:	74 34                	je     8008fa <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8008c6:	83 ec 08             	sub    $0x8,%esp
+  8008c9:	ff 75 0c             	push   0xc(%ebp)
+  8008cc:	56                   	push   %esi
+  8008cd:	ff d0                	call   *%eax
+  8008cf:	83 c4 10             	add    $0x10,%esp
+}
+  8008d2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8008d5:	5b                   	pop    %ebx
+  8008d6:	5e                   	pop    %esi
+  8008d7:	5d                   	pop    %ebp
+  8008d8:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8008d9:	a1 08 40 80 00       	mov    0x804008,%eax
+  8008de:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8008e1:	83 ec 04             	sub    $0x4,%esp
+  8008e4:	53                   	push   %ebx
+  8008e5:	50                   	push   %eax
+  8008e6:	68 38 25 80 00       	push   $0x802538
+  8008eb:	e8 22 0d 00 00       	call   801612 <cprintf>
+		return -E_INVAL;
+  8008f0:	83 c4 10             	add    $0x10,%esp
+  8008f3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008f8:	eb d8                	jmp    8008d2 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8008fa:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8008ff:	eb d1                	jmp    8008d2 <ftruncate+0x50>
+
+00800901 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800901:	55                   	push   %ebp
+  800902:	89 e5                	mov    %esp,%ebp
+  800904:	56                   	push   %esi
+  800905:	53                   	push   %ebx
+  800906:	83 ec 18             	sub    $0x18,%esp
+  800909:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80090c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80090f:	50                   	push   %eax
+  800910:	ff 75 08             	push   0x8(%ebp)
+  800913:	e8 8b fb ff ff       	call   8004a3 <fd_lookup>
+  800918:	83 c4 10             	add    $0x10,%esp
+  80091b:	85 c0                	test   %eax,%eax
+  80091d:	78 49                	js     800968 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80091f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800922:	83 ec 08             	sub    $0x8,%esp
+  800925:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800928:	50                   	push   %eax
+  800929:	ff 36                	push   (%esi)
+  80092b:	e8 c3 fb ff ff       	call   8004f3 <dev_lookup>
+  800930:	83 c4 10             	add    $0x10,%esp
+  800933:	85 c0                	test   %eax,%eax
+  800935:	78 31                	js     800968 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  800937:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80093a:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80093e:	74 2f                	je     80096f <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  800940:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  800943:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80094a:	00 00 00 
+	stat->st_isdir = 0;
+  80094d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800954:	00 00 00 
+	stat->st_dev = dev;
+  800957:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80095d:	83 ec 08             	sub    $0x8,%esp
+  800960:	53                   	push   %ebx
+  800961:	56                   	push   %esi
+  800962:	ff 50 14             	call   *0x14(%eax)
+  800965:	83 c4 10             	add    $0x10,%esp
+}
+  800968:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80096b:	5b                   	pop    %ebx
+  80096c:	5e                   	pop    %esi
+  80096d:	5d                   	pop    %ebp
+  80096e:	c3                   	ret
+		return -E_NOT_SUPP;
+  80096f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800974:	eb f2                	jmp    800968 <fstat+0x67>
+
+00800976 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  800976:	55                   	push   %ebp
+  800977:	89 e5                	mov    %esp,%ebp
+  800979:	56                   	push   %esi
+  80097a:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80097b:	83 ec 08             	sub    $0x8,%esp
+  80097e:	6a 00                	push   $0x0
+  800980:	ff 75 08             	push   0x8(%ebp)
+  800983:	e8 e4 01 00 00       	call   800b6c <open>
+  800988:	89 c3                	mov    %eax,%ebx
+  80098a:	83 c4 10             	add    $0x10,%esp
+  80098d:	85 c0                	test   %eax,%eax
+  80098f:	78 1b                	js     8009ac <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  800991:	83 ec 08             	sub    $0x8,%esp
+  800994:	ff 75 0c             	push   0xc(%ebp)
+  800997:	50                   	push   %eax
+  800998:	e8 64 ff ff ff       	call   800901 <fstat>
+  80099d:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80099f:	89 1c 24             	mov    %ebx,(%esp)
+  8009a2:	e8 26 fc ff ff       	call   8005cd <close>
+	return r;
+  8009a7:	83 c4 10             	add    $0x10,%esp
+  8009aa:	89 f3                	mov    %esi,%ebx
+}
+  8009ac:	89 d8                	mov    %ebx,%eax
+  8009ae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8009b1:	5b                   	pop    %ebx
+  8009b2:	5e                   	pop    %esi
+  8009b3:	5d                   	pop    %ebp
+  8009b4:	c3                   	ret
+
+008009b5 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  8009b5:	55                   	push   %ebp
+  8009b6:	89 e5                	mov    %esp,%ebp
+  8009b8:	56                   	push   %esi
+  8009b9:	53                   	push   %ebx
+  8009ba:	89 c6                	mov    %eax,%esi
+  8009bc:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  8009be:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  8009c5:	74 27                	je     8009ee <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8009c7:	6a 07                	push   $0x7
+  8009c9:	68 00 50 80 00       	push   $0x805000
+  8009ce:	56                   	push   %esi
+  8009cf:	ff 35 00 40 80 00    	push   0x804000
+  8009d5:	e8 95 15 00 00       	call   801f6f <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  8009da:	83 c4 0c             	add    $0xc,%esp
+  8009dd:	6a 00                	push   $0x0
+  8009df:	53                   	push   %ebx
+  8009e0:	6a 00                	push   $0x0
+  8009e2:	e8 14 15 00 00       	call   801efb <ipc_recv>
+}
+  8009e7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8009ea:	5b                   	pop    %ebx
+  8009eb:	5e                   	pop    %esi
+  8009ec:	5d                   	pop    %ebp
+  8009ed:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  8009ee:	83 ec 0c             	sub    $0xc,%esp
+  8009f1:	6a 01                	push   $0x1
+  8009f3:	e8 cb 15 00 00       	call   801fc3 <ipc_find_env>
+  8009f8:	a3 00 40 80 00       	mov    %eax,0x804000
+  8009fd:	83 c4 10             	add    $0x10,%esp
+  800a00:	eb c5                	jmp    8009c7 <fsipc+0x12>
+
+00800a02 <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  800a02:	55                   	push   %ebp
+  800a03:	89 e5                	mov    %esp,%ebp
+  800a05:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800a08:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a0b:	8b 40 0c             	mov    0xc(%eax),%eax
+  800a0e:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.set_size.req_size = newsize;
+  800a13:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a16:	a3 04 50 80 00       	mov    %eax,0x805004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  800a1b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a20:	b8 02 00 00 00       	mov    $0x2,%eax
+  800a25:	e8 8b ff ff ff       	call   8009b5 <fsipc>
+}
+  800a2a:	c9                   	leave
+  800a2b:	c3                   	ret
+
+00800a2c <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  800a2c:	55                   	push   %ebp
+  800a2d:	89 e5                	mov    %esp,%ebp
+  800a2f:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800a32:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a35:	8b 40 0c             	mov    0xc(%eax),%eax
+  800a38:	a3 00 50 80 00       	mov    %eax,0x805000
+  return fsipc(FSREQ_FLUSH, NULL);
+  800a3d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a42:	b8 06 00 00 00       	mov    $0x6,%eax
+  800a47:	e8 69 ff ff ff       	call   8009b5 <fsipc>
+}
+  800a4c:	c9                   	leave
+  800a4d:	c3                   	ret
+
+00800a4e <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  800a4e:	55                   	push   %ebp
+  800a4f:	89 e5                	mov    %esp,%ebp
+  800a51:	53                   	push   %ebx
+  800a52:	83 ec 04             	sub    $0x4,%esp
+  800a55:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800a58:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a5b:	8b 40 0c             	mov    0xc(%eax),%eax
+  800a5e:	a3 00 50 80 00       	mov    %eax,0x805000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  800a63:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a68:	b8 05 00 00 00       	mov    $0x5,%eax
+  800a6d:	e8 43 ff ff ff       	call   8009b5 <fsipc>
+  800a72:	85 c0                	test   %eax,%eax
+  800a74:	78 2c                	js     800aa2 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800a76:	83 ec 08             	sub    $0x8,%esp
+  800a79:	68 00 50 80 00       	push   $0x805000
+  800a7e:	53                   	push   %ebx
+  800a7f:	e8 47 11 00 00       	call   801bcb <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  800a84:	a1 80 50 80 00       	mov    0x805080,%eax
+  800a89:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800a8f:	a1 84 50 80 00       	mov    0x805084,%eax
+  800a94:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  800a9a:	83 c4 10             	add    $0x10,%esp
+  800a9d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800aa2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800aa5:	c9                   	leave
+  800aa6:	c3                   	ret
+
+00800aa7 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  800aa7:	55                   	push   %ebp
+  800aa8:	89 e5                	mov    %esp,%ebp
+  800aaa:	83 ec 0c             	sub    $0xc,%esp
+  800aad:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800ab0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ab3:	8b 52 0c             	mov    0xc(%edx),%edx
+  800ab6:	89 15 00 50 80 00    	mov    %edx,0x805000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  800abc:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  800ac1:	39 d0                	cmp    %edx,%eax
+  800ac3:	0f 47 c2             	cmova  %edx,%eax
+  800ac6:	a3 04 50 80 00       	mov    %eax,0x805004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  800acb:	50                   	push   %eax
+  800acc:	ff 75 0c             	push   0xc(%ebp)
+  800acf:	68 08 50 80 00       	push   $0x805008
+  800ad4:	e8 78 12 00 00       	call   801d51 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  800ad9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ade:	b8 04 00 00 00       	mov    $0x4,%eax
+  800ae3:	e8 cd fe ff ff       	call   8009b5 <fsipc>
+}
+  800ae8:	c9                   	leave
+  800ae9:	c3                   	ret
+
+00800aea <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  800aea:	55                   	push   %ebp
+  800aeb:	89 e5                	mov    %esp,%ebp
+  800aed:	56                   	push   %esi
+  800aee:	53                   	push   %ebx
+  800aef:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800af2:	8b 45 08             	mov    0x8(%ebp),%eax
+  800af5:	8b 40 0c             	mov    0xc(%eax),%eax
+  800af8:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.read.req_n = n;
+  800afd:	89 35 04 50 80 00    	mov    %esi,0x805004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  800b03:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b08:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b0d:	e8 a3 fe ff ff       	call   8009b5 <fsipc>
+  800b12:	89 c3                	mov    %eax,%ebx
+  800b14:	85 c0                	test   %eax,%eax
+  800b16:	78 1f                	js     800b37 <devfile_read+0x4d>
+  assert(r <= n);
+  800b18:	39 c6                	cmp    %eax,%esi
+  800b1a:	72 24                	jb     800b40 <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  800b1c:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800b21:	7f 33                	jg     800b56 <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  800b23:	83 ec 04             	sub    $0x4,%esp
+  800b26:	50                   	push   %eax
+  800b27:	68 00 50 80 00       	push   $0x805000
+  800b2c:	ff 75 0c             	push   0xc(%ebp)
+  800b2f:	e8 1d 12 00 00       	call   801d51 <memmove>
+  return r;
+  800b34:	83 c4 10             	add    $0x10,%esp
+}
+  800b37:	89 d8                	mov    %ebx,%eax
+  800b39:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b3c:	5b                   	pop    %ebx
+  800b3d:	5e                   	pop    %esi
+  800b3e:	5d                   	pop    %ebp
+  800b3f:	c3                   	ret
+  assert(r <= n);
+  800b40:	68 a8 25 80 00       	push   $0x8025a8
+  800b45:	68 af 25 80 00       	push   $0x8025af
+  800b4a:	6a 78                	push   $0x78
+  800b4c:	68 c4 25 80 00       	push   $0x8025c4
+  800b51:	e8 e1 09 00 00       	call   801537 <_panic>
+  assert(r <= PGSIZE);
+  800b56:	68 cf 25 80 00       	push   $0x8025cf
+  800b5b:	68 af 25 80 00       	push   $0x8025af
+  800b60:	6a 79                	push   $0x79
+  800b62:	68 c4 25 80 00       	push   $0x8025c4
+  800b67:	e8 cb 09 00 00       	call   801537 <_panic>
+
+00800b6c <open>:
+open(const char *path, int mode) {
+  800b6c:	55                   	push   %ebp
+  800b6d:	89 e5                	mov    %esp,%ebp
+  800b6f:	56                   	push   %esi
+  800b70:	53                   	push   %ebx
+  800b71:	83 ec 1c             	sub    $0x1c,%esp
+  800b74:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  800b77:	56                   	push   %esi
+  800b78:	e8 13 10 00 00       	call   801b90 <strlen>
+  800b7d:	83 c4 10             	add    $0x10,%esp
+  800b80:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800b85:	7f 6c                	jg     800bf3 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  800b87:	83 ec 0c             	sub    $0xc,%esp
+  800b8a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b8d:	50                   	push   %eax
+  800b8e:	e8 ba f8 ff ff       	call   80044d <fd_alloc>
+  800b93:	89 c3                	mov    %eax,%ebx
+  800b95:	83 c4 10             	add    $0x10,%esp
+  800b98:	85 c0                	test   %eax,%eax
+  800b9a:	78 3c                	js     800bd8 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  800b9c:	83 ec 08             	sub    $0x8,%esp
+  800b9f:	56                   	push   %esi
+  800ba0:	68 00 50 80 00       	push   $0x805000
+  800ba5:	e8 21 10 00 00       	call   801bcb <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  800baa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bad:	a3 00 54 80 00       	mov    %eax,0x805400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  800bb2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  800bb5:	b8 01 00 00 00       	mov    $0x1,%eax
+  800bba:	e8 f6 fd ff ff       	call   8009b5 <fsipc>
+  800bbf:	89 c3                	mov    %eax,%ebx
+  800bc1:	83 c4 10             	add    $0x10,%esp
+  800bc4:	85 c0                	test   %eax,%eax
+  800bc6:	78 19                	js     800be1 <open+0x75>
+  return fd2num(fd);
+  800bc8:	83 ec 0c             	sub    $0xc,%esp
+  800bcb:	ff 75 f4             	push   -0xc(%ebp)
+  800bce:	e8 53 f8 ff ff       	call   800426 <fd2num>
+  800bd3:	89 c3                	mov    %eax,%ebx
+  800bd5:	83 c4 10             	add    $0x10,%esp
+}
+  800bd8:	89 d8                	mov    %ebx,%eax
+  800bda:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800bdd:	5b                   	pop    %ebx
+  800bde:	5e                   	pop    %esi
+  800bdf:	5d                   	pop    %ebp
+  800be0:	c3                   	ret
+    fd_close(fd, 0);
+  800be1:	83 ec 08             	sub    $0x8,%esp
+  800be4:	6a 00                	push   $0x0
+  800be6:	ff 75 f4             	push   -0xc(%ebp)
+  800be9:	e8 58 f9 ff ff       	call   800546 <fd_close>
+    return r;
+  800bee:	83 c4 10             	add    $0x10,%esp
+  800bf1:	eb e5                	jmp    800bd8 <open+0x6c>
+    return -E_BAD_PATH;
+  800bf3:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  800bf8:	eb de                	jmp    800bd8 <open+0x6c>
+
+00800bfa <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  800bfa:	55                   	push   %ebp
+  800bfb:	89 e5                	mov    %esp,%ebp
+  800bfd:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  800c00:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c05:	b8 08 00 00 00       	mov    $0x8,%eax
+  800c0a:	e8 a6 fd ff ff       	call   8009b5 <fsipc>
+}
+  800c0f:	c9                   	leave
+  800c10:	c3                   	ret
+
+00800c11 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  800c11:	55                   	push   %ebp
+  800c12:	89 e5                	mov    %esp,%ebp
+  800c14:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  800c17:	68 db 25 80 00       	push   $0x8025db
+  800c1c:	ff 75 0c             	push   0xc(%ebp)
+  800c1f:	e8 a7 0f 00 00       	call   801bcb <strcpy>
+	return 0;
+}
+  800c24:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c29:	c9                   	leave
+  800c2a:	c3                   	ret
+
+00800c2b <devsock_close>:
+{
+  800c2b:	55                   	push   %ebp
+  800c2c:	89 e5                	mov    %esp,%ebp
+  800c2e:	53                   	push   %ebx
+  800c2f:	83 ec 10             	sub    $0x10,%esp
+  800c32:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  800c35:	53                   	push   %ebx
+  800c36:	e8 c7 13 00 00       	call   802002 <pageref>
+  800c3b:	89 c2                	mov    %eax,%edx
+  800c3d:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  800c40:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  800c45:	83 fa 01             	cmp    $0x1,%edx
+  800c48:	74 05                	je     800c4f <devsock_close+0x24>
+}
+  800c4a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c4d:	c9                   	leave
+  800c4e:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  800c4f:	83 ec 0c             	sub    $0xc,%esp
+  800c52:	ff 73 0c             	push   0xc(%ebx)
+  800c55:	e8 b7 02 00 00       	call   800f11 <nsipc_close>
+  800c5a:	83 c4 10             	add    $0x10,%esp
+  800c5d:	eb eb                	jmp    800c4a <devsock_close+0x1f>
+
+00800c5f <devsock_write>:
+{
+  800c5f:	55                   	push   %ebp
+  800c60:	89 e5                	mov    %esp,%ebp
+  800c62:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  800c65:	6a 00                	push   $0x0
+  800c67:	ff 75 10             	push   0x10(%ebp)
+  800c6a:	ff 75 0c             	push   0xc(%ebp)
+  800c6d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c70:	ff 70 0c             	push   0xc(%eax)
+  800c73:	e8 79 03 00 00       	call   800ff1 <nsipc_send>
+}
+  800c78:	c9                   	leave
+  800c79:	c3                   	ret
+
+00800c7a <devsock_read>:
+{
+  800c7a:	55                   	push   %ebp
+  800c7b:	89 e5                	mov    %esp,%ebp
+  800c7d:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  800c80:	6a 00                	push   $0x0
+  800c82:	ff 75 10             	push   0x10(%ebp)
+  800c85:	ff 75 0c             	push   0xc(%ebp)
+  800c88:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c8b:	ff 70 0c             	push   0xc(%eax)
+  800c8e:	e8 ef 02 00 00       	call   800f82 <nsipc_recv>
+}
+  800c93:	c9                   	leave
+  800c94:	c3                   	ret
+
+00800c95 <fd2sockid>:
+{
+  800c95:	55                   	push   %ebp
+  800c96:	89 e5                	mov    %esp,%ebp
+  800c98:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  800c9b:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  800c9e:	52                   	push   %edx
+  800c9f:	50                   	push   %eax
+  800ca0:	e8 fe f7 ff ff       	call   8004a3 <fd_lookup>
+  800ca5:	83 c4 10             	add    $0x10,%esp
+  800ca8:	85 c0                	test   %eax,%eax
+  800caa:	78 10                	js     800cbc <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  800cac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800caf:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  800cb5:	39 08                	cmp    %ecx,(%eax)
+  800cb7:	75 05                	jne    800cbe <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  800cb9:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  800cbc:	c9                   	leave
+  800cbd:	c3                   	ret
+		return -E_NOT_SUPP;
+  800cbe:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800cc3:	eb f7                	jmp    800cbc <fd2sockid+0x27>
+
+00800cc5 <alloc_sockfd>:
+{
+  800cc5:	55                   	push   %ebp
+  800cc6:	89 e5                	mov    %esp,%ebp
+  800cc8:	56                   	push   %esi
+  800cc9:	53                   	push   %ebx
+  800cca:	83 ec 1c             	sub    $0x1c,%esp
+  800ccd:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  800ccf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800cd2:	50                   	push   %eax
+  800cd3:	e8 75 f7 ff ff       	call   80044d <fd_alloc>
+  800cd8:	89 c3                	mov    %eax,%ebx
+  800cda:	83 c4 10             	add    $0x10,%esp
+  800cdd:	85 c0                	test   %eax,%eax
+  800cdf:	78 43                	js     800d24 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  800ce1:	83 ec 04             	sub    $0x4,%esp
+  800ce4:	68 07 04 00 00       	push   $0x407
+  800ce9:	ff 75 f4             	push   -0xc(%ebp)
+  800cec:	6a 00                	push   $0x0
+  800cee:	e8 60 f4 ff ff       	call   800153 <sys_page_alloc>
+  800cf3:	89 c3                	mov    %eax,%ebx
+  800cf5:	83 c4 10             	add    $0x10,%esp
+  800cf8:	85 c0                	test   %eax,%eax
+  800cfa:	78 28                	js     800d24 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  800cfc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800cff:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  800d05:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  800d07:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800d0a:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  800d11:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  800d14:	83 ec 0c             	sub    $0xc,%esp
+  800d17:	50                   	push   %eax
+  800d18:	e8 09 f7 ff ff       	call   800426 <fd2num>
+  800d1d:	89 c3                	mov    %eax,%ebx
+  800d1f:	83 c4 10             	add    $0x10,%esp
+  800d22:	eb 0c                	jmp    800d30 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  800d24:	83 ec 0c             	sub    $0xc,%esp
+  800d27:	56                   	push   %esi
+  800d28:	e8 e4 01 00 00       	call   800f11 <nsipc_close>
+		return r;
+  800d2d:	83 c4 10             	add    $0x10,%esp
+}
+  800d30:	89 d8                	mov    %ebx,%eax
+  800d32:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d35:	5b                   	pop    %ebx
+  800d36:	5e                   	pop    %esi
+  800d37:	5d                   	pop    %ebp
+  800d38:	c3                   	ret
+
+00800d39 <accept>:
+{
+  800d39:	55                   	push   %ebp
+  800d3a:	89 e5                	mov    %esp,%ebp
+  800d3c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800d3f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d42:	e8 4e ff ff ff       	call   800c95 <fd2sockid>
+  800d47:	85 c0                	test   %eax,%eax
+  800d49:	78 1b                	js     800d66 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  800d4b:	83 ec 04             	sub    $0x4,%esp
+  800d4e:	ff 75 10             	push   0x10(%ebp)
+  800d51:	ff 75 0c             	push   0xc(%ebp)
+  800d54:	50                   	push   %eax
+  800d55:	e8 0e 01 00 00       	call   800e68 <nsipc_accept>
+  800d5a:	83 c4 10             	add    $0x10,%esp
+  800d5d:	85 c0                	test   %eax,%eax
+  800d5f:	78 05                	js     800d66 <accept+0x2d>
+	return alloc_sockfd(r);
+  800d61:	e8 5f ff ff ff       	call   800cc5 <alloc_sockfd>
+}
+  800d66:	c9                   	leave
+  800d67:	c3                   	ret
+
+00800d68 <bind>:
+{
+  800d68:	55                   	push   %ebp
+  800d69:	89 e5                	mov    %esp,%ebp
+  800d6b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800d6e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d71:	e8 1f ff ff ff       	call   800c95 <fd2sockid>
+  800d76:	85 c0                	test   %eax,%eax
+  800d78:	78 12                	js     800d8c <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  800d7a:	83 ec 04             	sub    $0x4,%esp
+  800d7d:	ff 75 10             	push   0x10(%ebp)
+  800d80:	ff 75 0c             	push   0xc(%ebp)
+  800d83:	50                   	push   %eax
+  800d84:	e8 31 01 00 00       	call   800eba <nsipc_bind>
+  800d89:	83 c4 10             	add    $0x10,%esp
+}
+  800d8c:	c9                   	leave
+  800d8d:	c3                   	ret
+
+00800d8e <shutdown>:
+{
+  800d8e:	55                   	push   %ebp
+  800d8f:	89 e5                	mov    %esp,%ebp
+  800d91:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800d94:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d97:	e8 f9 fe ff ff       	call   800c95 <fd2sockid>
+  800d9c:	85 c0                	test   %eax,%eax
+  800d9e:	78 0f                	js     800daf <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  800da0:	83 ec 08             	sub    $0x8,%esp
+  800da3:	ff 75 0c             	push   0xc(%ebp)
+  800da6:	50                   	push   %eax
+  800da7:	e8 43 01 00 00       	call   800eef <nsipc_shutdown>
+  800dac:	83 c4 10             	add    $0x10,%esp
+}
+  800daf:	c9                   	leave
+  800db0:	c3                   	ret
+
+00800db1 <connect>:
+{
+  800db1:	55                   	push   %ebp
+  800db2:	89 e5                	mov    %esp,%ebp
+  800db4:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800db7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dba:	e8 d6 fe ff ff       	call   800c95 <fd2sockid>
+  800dbf:	85 c0                	test   %eax,%eax
+  800dc1:	78 12                	js     800dd5 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  800dc3:	83 ec 04             	sub    $0x4,%esp
+  800dc6:	ff 75 10             	push   0x10(%ebp)
+  800dc9:	ff 75 0c             	push   0xc(%ebp)
+  800dcc:	50                   	push   %eax
+  800dcd:	e8 59 01 00 00       	call   800f2b <nsipc_connect>
+  800dd2:	83 c4 10             	add    $0x10,%esp
+}
+  800dd5:	c9                   	leave
+  800dd6:	c3                   	ret
+
+00800dd7 <listen>:
+{
+  800dd7:	55                   	push   %ebp
+  800dd8:	89 e5                	mov    %esp,%ebp
+  800dda:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  800ddd:	8b 45 08             	mov    0x8(%ebp),%eax
+  800de0:	e8 b0 fe ff ff       	call   800c95 <fd2sockid>
+  800de5:	85 c0                	test   %eax,%eax
+  800de7:	78 0f                	js     800df8 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  800de9:	83 ec 08             	sub    $0x8,%esp
+  800dec:	ff 75 0c             	push   0xc(%ebp)
+  800def:	50                   	push   %eax
+  800df0:	e8 6b 01 00 00       	call   800f60 <nsipc_listen>
+  800df5:	83 c4 10             	add    $0x10,%esp
+}
+  800df8:	c9                   	leave
+  800df9:	c3                   	ret
+
+00800dfa <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  800dfa:	55                   	push   %ebp
+  800dfb:	89 e5                	mov    %esp,%ebp
+  800dfd:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  800e00:	ff 75 10             	push   0x10(%ebp)
+  800e03:	ff 75 0c             	push   0xc(%ebp)
+  800e06:	ff 75 08             	push   0x8(%ebp)
+  800e09:	e8 41 02 00 00       	call   80104f <nsipc_socket>
+  800e0e:	83 c4 10             	add    $0x10,%esp
+  800e11:	85 c0                	test   %eax,%eax
+  800e13:	78 05                	js     800e1a <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  800e15:	e8 ab fe ff ff       	call   800cc5 <alloc_sockfd>
+}
+  800e1a:	c9                   	leave
+  800e1b:	c3                   	ret
+
+00800e1c <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  800e1c:	55                   	push   %ebp
+  800e1d:	89 e5                	mov    %esp,%ebp
+  800e1f:	53                   	push   %ebx
+  800e20:	83 ec 04             	sub    $0x4,%esp
+  800e23:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  800e25:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  800e2c:	74 26                	je     800e54 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  800e2e:	6a 07                	push   $0x7
+  800e30:	68 00 60 80 00       	push   $0x806000
+  800e35:	53                   	push   %ebx
+  800e36:	ff 35 04 40 80 00    	push   0x804004
+  800e3c:	e8 2e 11 00 00       	call   801f6f <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  800e41:	83 c4 0c             	add    $0xc,%esp
+  800e44:	6a 00                	push   $0x0
+  800e46:	6a 00                	push   $0x0
+  800e48:	6a 00                	push   $0x0
+  800e4a:	e8 ac 10 00 00       	call   801efb <ipc_recv>
+}
+  800e4f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e52:	c9                   	leave
+  800e53:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  800e54:	83 ec 0c             	sub    $0xc,%esp
+  800e57:	6a 02                	push   $0x2
+  800e59:	e8 65 11 00 00       	call   801fc3 <ipc_find_env>
+  800e5e:	a3 04 40 80 00       	mov    %eax,0x804004
+  800e63:	83 c4 10             	add    $0x10,%esp
+  800e66:	eb c6                	jmp    800e2e <nsipc+0x12>
+
+00800e68 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  800e68:	55                   	push   %ebp
+  800e69:	89 e5                	mov    %esp,%ebp
+  800e6b:	56                   	push   %esi
+  800e6c:	53                   	push   %ebx
+  800e6d:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  800e70:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e73:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  800e78:	8b 06                	mov    (%esi),%eax
+  800e7a:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  800e7f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e84:	e8 93 ff ff ff       	call   800e1c <nsipc>
+  800e89:	89 c3                	mov    %eax,%ebx
+  800e8b:	85 c0                	test   %eax,%eax
+  800e8d:	79 09                	jns    800e98 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  800e8f:	89 d8                	mov    %ebx,%eax
+  800e91:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e94:	5b                   	pop    %ebx
+  800e95:	5e                   	pop    %esi
+  800e96:	5d                   	pop    %ebp
+  800e97:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  800e98:	83 ec 04             	sub    $0x4,%esp
+  800e9b:	ff 35 10 60 80 00    	push   0x806010
+  800ea1:	68 00 60 80 00       	push   $0x806000
+  800ea6:	ff 75 0c             	push   0xc(%ebp)
+  800ea9:	e8 a3 0e 00 00       	call   801d51 <memmove>
+		*addrlen = ret->ret_addrlen;
+  800eae:	a1 10 60 80 00       	mov    0x806010,%eax
+  800eb3:	89 06                	mov    %eax,(%esi)
+  800eb5:	83 c4 10             	add    $0x10,%esp
+	return r;
+  800eb8:	eb d5                	jmp    800e8f <nsipc_accept+0x27>
+
+00800eba <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  800eba:	55                   	push   %ebp
+  800ebb:	89 e5                	mov    %esp,%ebp
+  800ebd:	53                   	push   %ebx
+  800ebe:	83 ec 08             	sub    $0x8,%esp
+  800ec1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  800ec4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ec7:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  800ecc:	53                   	push   %ebx
+  800ecd:	ff 75 0c             	push   0xc(%ebp)
+  800ed0:	68 04 60 80 00       	push   $0x806004
+  800ed5:	e8 77 0e 00 00       	call   801d51 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  800eda:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  800ee0:	b8 02 00 00 00       	mov    $0x2,%eax
+  800ee5:	e8 32 ff ff ff       	call   800e1c <nsipc>
+}
+  800eea:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800eed:	c9                   	leave
+  800eee:	c3                   	ret
+
+00800eef <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  800eef:	55                   	push   %ebp
+  800ef0:	89 e5                	mov    %esp,%ebp
+  800ef2:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  800ef5:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ef8:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  800efd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f00:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  800f05:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f0a:	e8 0d ff ff ff       	call   800e1c <nsipc>
+}
+  800f0f:	c9                   	leave
+  800f10:	c3                   	ret
+
+00800f11 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  800f11:	55                   	push   %ebp
+  800f12:	89 e5                	mov    %esp,%ebp
+  800f14:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  800f17:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f1a:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  800f1f:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f24:	e8 f3 fe ff ff       	call   800e1c <nsipc>
+}
+  800f29:	c9                   	leave
+  800f2a:	c3                   	ret
+
+00800f2b <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  800f2b:	55                   	push   %ebp
+  800f2c:	89 e5                	mov    %esp,%ebp
+  800f2e:	53                   	push   %ebx
+  800f2f:	83 ec 08             	sub    $0x8,%esp
+  800f32:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  800f35:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f38:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  800f3d:	53                   	push   %ebx
+  800f3e:	ff 75 0c             	push   0xc(%ebp)
+  800f41:	68 04 60 80 00       	push   $0x806004
+  800f46:	e8 06 0e 00 00       	call   801d51 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  800f4b:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  800f51:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f56:	e8 c1 fe ff ff       	call   800e1c <nsipc>
+}
+  800f5b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f5e:	c9                   	leave
+  800f5f:	c3                   	ret
+
+00800f60 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  800f60:	55                   	push   %ebp
+  800f61:	89 e5                	mov    %esp,%ebp
+  800f63:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  800f66:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f69:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  800f6e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f71:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  800f76:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f7b:	e8 9c fe ff ff       	call   800e1c <nsipc>
+}
+  800f80:	c9                   	leave
+  800f81:	c3                   	ret
+
+00800f82 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  800f82:	55                   	push   %ebp
+  800f83:	89 e5                	mov    %esp,%ebp
+  800f85:	56                   	push   %esi
+  800f86:	53                   	push   %ebx
+  800f87:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  800f8a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f8d:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  800f92:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  800f98:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f9b:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  800fa0:	b8 07 00 00 00       	mov    $0x7,%eax
+  800fa5:	e8 72 fe ff ff       	call   800e1c <nsipc>
+  800faa:	89 c3                	mov    %eax,%ebx
+  800fac:	85 c0                	test   %eax,%eax
+  800fae:	78 22                	js     800fd2 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  800fb0:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  800fb5:	39 c6                	cmp    %eax,%esi
+  800fb7:	0f 4e c6             	cmovle %esi,%eax
+  800fba:	39 c3                	cmp    %eax,%ebx
+  800fbc:	7f 1d                	jg     800fdb <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  800fbe:	83 ec 04             	sub    $0x4,%esp
+  800fc1:	53                   	push   %ebx
+  800fc2:	68 00 60 80 00       	push   $0x806000
+  800fc7:	ff 75 0c             	push   0xc(%ebp)
+  800fca:	e8 82 0d 00 00       	call   801d51 <memmove>
+  800fcf:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  800fd2:	89 d8                	mov    %ebx,%eax
+  800fd4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fd7:	5b                   	pop    %ebx
+  800fd8:	5e                   	pop    %esi
+  800fd9:	5d                   	pop    %ebp
+  800fda:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  800fdb:	68 e7 25 80 00       	push   $0x8025e7
+  800fe0:	68 af 25 80 00       	push   $0x8025af
+  800fe5:	6a 62                	push   $0x62
+  800fe7:	68 fc 25 80 00       	push   $0x8025fc
+  800fec:	e8 46 05 00 00       	call   801537 <_panic>
+
+00800ff1 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  800ff1:	55                   	push   %ebp
+  800ff2:	89 e5                	mov    %esp,%ebp
+  800ff4:	53                   	push   %ebx
+  800ff5:	83 ec 04             	sub    $0x4,%esp
+  800ff8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  800ffb:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ffe:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  801003:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801009:	7f 2e                	jg     801039 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  80100b:	83 ec 04             	sub    $0x4,%esp
+  80100e:	53                   	push   %ebx
+  80100f:	ff 75 0c             	push   0xc(%ebp)
+  801012:	68 0c 60 80 00       	push   $0x80600c
+  801017:	e8 35 0d 00 00       	call   801d51 <memmove>
+	nsipcbuf.send.req_size = size;
+  80101c:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  801022:	8b 45 14             	mov    0x14(%ebp),%eax
+  801025:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  80102a:	b8 08 00 00 00       	mov    $0x8,%eax
+  80102f:	e8 e8 fd ff ff       	call   800e1c <nsipc>
+}
+  801034:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801037:	c9                   	leave
+  801038:	c3                   	ret
+	assert(size < 1600);
+  801039:	68 08 26 80 00       	push   $0x802608
+  80103e:	68 af 25 80 00       	push   $0x8025af
+  801043:	6a 6d                	push   $0x6d
+  801045:	68 fc 25 80 00       	push   $0x8025fc
+  80104a:	e8 e8 04 00 00       	call   801537 <_panic>
+
+0080104f <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80104f:	55                   	push   %ebp
+  801050:	89 e5                	mov    %esp,%ebp
+  801052:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801055:	8b 45 08             	mov    0x8(%ebp),%eax
+  801058:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  80105d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801060:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  801065:	8b 45 10             	mov    0x10(%ebp),%eax
+  801068:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  80106d:	b8 09 00 00 00       	mov    $0x9,%eax
+  801072:	e8 a5 fd ff ff       	call   800e1c <nsipc>
+}
+  801077:	c9                   	leave
+  801078:	c3                   	ret
+
+00801079 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801079:	55                   	push   %ebp
+  80107a:	89 e5                	mov    %esp,%ebp
+  80107c:	56                   	push   %esi
+  80107d:	53                   	push   %ebx
+  80107e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801081:	83 ec 0c             	sub    $0xc,%esp
+  801084:	ff 75 08             	push   0x8(%ebp)
+  801087:	e8 aa f3 ff ff       	call   800436 <fd2data>
+  80108c:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80108e:	83 c4 08             	add    $0x8,%esp
+  801091:	68 14 26 80 00       	push   $0x802614
+  801096:	53                   	push   %ebx
+  801097:	e8 2f 0b 00 00       	call   801bcb <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  80109c:	8b 46 04             	mov    0x4(%esi),%eax
+  80109f:	2b 06                	sub    (%esi),%eax
+  8010a1:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8010a7:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8010ae:	00 00 00 
+	stat->st_dev = &devpipe;
+  8010b1:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  8010b8:	30 80 00 
+	return 0;
+}
+  8010bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010c0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8010c3:	5b                   	pop    %ebx
+  8010c4:	5e                   	pop    %esi
+  8010c5:	5d                   	pop    %ebp
+  8010c6:	c3                   	ret
+
+008010c7 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8010c7:	55                   	push   %ebp
+  8010c8:	89 e5                	mov    %esp,%ebp
+  8010ca:	53                   	push   %ebx
+  8010cb:	83 ec 0c             	sub    $0xc,%esp
+  8010ce:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8010d1:	53                   	push   %ebx
+  8010d2:	6a 00                	push   $0x0
+  8010d4:	e8 ff f0 ff ff       	call   8001d8 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8010d9:	89 1c 24             	mov    %ebx,(%esp)
+  8010dc:	e8 55 f3 ff ff       	call   800436 <fd2data>
+  8010e1:	83 c4 08             	add    $0x8,%esp
+  8010e4:	50                   	push   %eax
+  8010e5:	6a 00                	push   $0x0
+  8010e7:	e8 ec f0 ff ff       	call   8001d8 <sys_page_unmap>
+}
+  8010ec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010ef:	c9                   	leave
+  8010f0:	c3                   	ret
+
+008010f1 <_pipeisclosed>:
+{
+  8010f1:	55                   	push   %ebp
+  8010f2:	89 e5                	mov    %esp,%ebp
+  8010f4:	57                   	push   %edi
+  8010f5:	56                   	push   %esi
+  8010f6:	53                   	push   %ebx
+  8010f7:	83 ec 1c             	sub    $0x1c,%esp
+  8010fa:	89 c7                	mov    %eax,%edi
+  8010fc:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  8010fe:	a1 08 40 80 00       	mov    0x804008,%eax
+  801103:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801106:	83 ec 0c             	sub    $0xc,%esp
+  801109:	57                   	push   %edi
+  80110a:	e8 f3 0e 00 00       	call   802002 <pageref>
+  80110f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801112:	89 34 24             	mov    %esi,(%esp)
+  801115:	e8 e8 0e 00 00       	call   802002 <pageref>
+		nn = thisenv->env_runs;
+  80111a:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801120:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801123:	83 c4 10             	add    $0x10,%esp
+  801126:	39 cb                	cmp    %ecx,%ebx
+  801128:	74 1b                	je     801145 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  80112a:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80112d:	75 cf                	jne    8010fe <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80112f:	8b 42 58             	mov    0x58(%edx),%eax
+  801132:	6a 01                	push   $0x1
+  801134:	50                   	push   %eax
+  801135:	53                   	push   %ebx
+  801136:	68 1b 26 80 00       	push   $0x80261b
+  80113b:	e8 d2 04 00 00       	call   801612 <cprintf>
+  801140:	83 c4 10             	add    $0x10,%esp
+  801143:	eb b9                	jmp    8010fe <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801145:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801148:	0f 94 c0             	sete   %al
+  80114b:	0f b6 c0             	movzbl %al,%eax
+}
+  80114e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801151:	5b                   	pop    %ebx
+  801152:	5e                   	pop    %esi
+  801153:	5f                   	pop    %edi
+  801154:	5d                   	pop    %ebp
+  801155:	c3                   	ret
+
+00801156 <devpipe_write>:
+{
+  801156:	55                   	push   %ebp
+  801157:	89 e5                	mov    %esp,%ebp
+  801159:	57                   	push   %edi
+  80115a:	56                   	push   %esi
+  80115b:	53                   	push   %ebx
+  80115c:	83 ec 28             	sub    $0x28,%esp
+  80115f:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801162:	56                   	push   %esi
+  801163:	e8 ce f2 ff ff       	call   800436 <fd2data>
+  801168:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80116a:	83 c4 10             	add    $0x10,%esp
+  80116d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801172:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801175:	75 09                	jne    801180 <devpipe_write+0x2a>
+	return i;
+  801177:	89 f8                	mov    %edi,%eax
+  801179:	eb 23                	jmp    80119e <devpipe_write+0x48>
+			sys_yield();
+  80117b:	e8 b4 ef ff ff       	call   800134 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801180:	8b 43 04             	mov    0x4(%ebx),%eax
+  801183:	8b 0b                	mov    (%ebx),%ecx
+  801185:	8d 51 20             	lea    0x20(%ecx),%edx
+  801188:	39 d0                	cmp    %edx,%eax
+  80118a:	72 1a                	jb     8011a6 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  80118c:	89 da                	mov    %ebx,%edx
+  80118e:	89 f0                	mov    %esi,%eax
+  801190:	e8 5c ff ff ff       	call   8010f1 <_pipeisclosed>
+  801195:	85 c0                	test   %eax,%eax
+  801197:	74 e2                	je     80117b <devpipe_write+0x25>
+				return 0;
+  801199:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80119e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011a1:	5b                   	pop    %ebx
+  8011a2:	5e                   	pop    %esi
+  8011a3:	5f                   	pop    %edi
+  8011a4:	5d                   	pop    %ebp
+  8011a5:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8011a6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011a9:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8011ad:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8011b0:	89 c2                	mov    %eax,%edx
+  8011b2:	c1 fa 1f             	sar    $0x1f,%edx
+  8011b5:	89 d1                	mov    %edx,%ecx
+  8011b7:	c1 e9 1b             	shr    $0x1b,%ecx
+  8011ba:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8011bd:	83 e2 1f             	and    $0x1f,%edx
+  8011c0:	29 ca                	sub    %ecx,%edx
+  8011c2:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8011c6:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8011ca:	83 c0 01             	add    $0x1,%eax
+  8011cd:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8011d0:	83 c7 01             	add    $0x1,%edi
+  8011d3:	eb 9d                	jmp    801172 <devpipe_write+0x1c>
+
+008011d5 <devpipe_read>:
+{
+  8011d5:	55                   	push   %ebp
+  8011d6:	89 e5                	mov    %esp,%ebp
+  8011d8:	57                   	push   %edi
+  8011d9:	56                   	push   %esi
+  8011da:	53                   	push   %ebx
+  8011db:	83 ec 18             	sub    $0x18,%esp
+  8011de:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8011e1:	57                   	push   %edi
+  8011e2:	e8 4f f2 ff ff       	call   800436 <fd2data>
+  8011e7:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8011e9:	83 c4 10             	add    $0x10,%esp
+  8011ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8011f1:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8011f4:	75 13                	jne    801209 <devpipe_read+0x34>
+	return i;
+  8011f6:	89 f0                	mov    %esi,%eax
+  8011f8:	eb 02                	jmp    8011fc <devpipe_read+0x27>
+				return i;
+  8011fa:	89 f0                	mov    %esi,%eax
+}
+  8011fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011ff:	5b                   	pop    %ebx
+  801200:	5e                   	pop    %esi
+  801201:	5f                   	pop    %edi
+  801202:	5d                   	pop    %ebp
+  801203:	c3                   	ret
+			sys_yield();
+  801204:	e8 2b ef ff ff       	call   800134 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  801209:	8b 03                	mov    (%ebx),%eax
+  80120b:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80120e:	75 18                	jne    801228 <devpipe_read+0x53>
+			if (i > 0)
+  801210:	85 f6                	test   %esi,%esi
+  801212:	75 e6                	jne    8011fa <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  801214:	89 da                	mov    %ebx,%edx
+  801216:	89 f8                	mov    %edi,%eax
+  801218:	e8 d4 fe ff ff       	call   8010f1 <_pipeisclosed>
+  80121d:	85 c0                	test   %eax,%eax
+  80121f:	74 e3                	je     801204 <devpipe_read+0x2f>
+				return 0;
+  801221:	b8 00 00 00 00       	mov    $0x0,%eax
+  801226:	eb d4                	jmp    8011fc <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801228:	99                   	cltd
+  801229:	c1 ea 1b             	shr    $0x1b,%edx
+  80122c:	01 d0                	add    %edx,%eax
+  80122e:	83 e0 1f             	and    $0x1f,%eax
+  801231:	29 d0                	sub    %edx,%eax
+  801233:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801238:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80123b:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80123e:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  801241:	83 c6 01             	add    $0x1,%esi
+  801244:	eb ab                	jmp    8011f1 <devpipe_read+0x1c>
+
+00801246 <pipe>:
+{
+  801246:	55                   	push   %ebp
+  801247:	89 e5                	mov    %esp,%ebp
+  801249:	56                   	push   %esi
+  80124a:	53                   	push   %ebx
+  80124b:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80124e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801251:	50                   	push   %eax
+  801252:	e8 f6 f1 ff ff       	call   80044d <fd_alloc>
+  801257:	89 c3                	mov    %eax,%ebx
+  801259:	83 c4 10             	add    $0x10,%esp
+  80125c:	85 c0                	test   %eax,%eax
+  80125e:	0f 88 23 01 00 00    	js     801387 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801264:	83 ec 04             	sub    $0x4,%esp
+  801267:	68 07 04 00 00       	push   $0x407
+  80126c:	ff 75 f4             	push   -0xc(%ebp)
+  80126f:	6a 00                	push   $0x0
+  801271:	e8 dd ee ff ff       	call   800153 <sys_page_alloc>
+  801276:	89 c3                	mov    %eax,%ebx
+  801278:	83 c4 10             	add    $0x10,%esp
+  80127b:	85 c0                	test   %eax,%eax
+  80127d:	0f 88 04 01 00 00    	js     801387 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801283:	83 ec 0c             	sub    $0xc,%esp
+  801286:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801289:	50                   	push   %eax
+  80128a:	e8 be f1 ff ff       	call   80044d <fd_alloc>
+  80128f:	89 c3                	mov    %eax,%ebx
+  801291:	83 c4 10             	add    $0x10,%esp
+  801294:	85 c0                	test   %eax,%eax
+  801296:	0f 88 db 00 00 00    	js     801377 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80129c:	83 ec 04             	sub    $0x4,%esp
+  80129f:	68 07 04 00 00       	push   $0x407
+  8012a4:	ff 75 f0             	push   -0x10(%ebp)
+  8012a7:	6a 00                	push   $0x0
+  8012a9:	e8 a5 ee ff ff       	call   800153 <sys_page_alloc>
+  8012ae:	89 c3                	mov    %eax,%ebx
+  8012b0:	83 c4 10             	add    $0x10,%esp
+  8012b3:	85 c0                	test   %eax,%eax
+  8012b5:	0f 88 bc 00 00 00    	js     801377 <pipe+0x131>
+	va = fd2data(fd0);
+  8012bb:	83 ec 0c             	sub    $0xc,%esp
+  8012be:	ff 75 f4             	push   -0xc(%ebp)
+  8012c1:	e8 70 f1 ff ff       	call   800436 <fd2data>
+  8012c6:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8012c8:	83 c4 0c             	add    $0xc,%esp
+  8012cb:	68 07 04 00 00       	push   $0x407
+  8012d0:	50                   	push   %eax
+  8012d1:	6a 00                	push   $0x0
+  8012d3:	e8 7b ee ff ff       	call   800153 <sys_page_alloc>
+  8012d8:	89 c3                	mov    %eax,%ebx
+  8012da:	83 c4 10             	add    $0x10,%esp
+  8012dd:	85 c0                	test   %eax,%eax
+  8012df:	0f 88 82 00 00 00    	js     801367 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8012e5:	83 ec 0c             	sub    $0xc,%esp
+  8012e8:	ff 75 f0             	push   -0x10(%ebp)
+  8012eb:	e8 46 f1 ff ff       	call   800436 <fd2data>
+  8012f0:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8012f7:	50                   	push   %eax
+  8012f8:	6a 00                	push   $0x0
+  8012fa:	56                   	push   %esi
+  8012fb:	6a 00                	push   $0x0
+  8012fd:	e8 94 ee ff ff       	call   800196 <sys_page_map>
+  801302:	89 c3                	mov    %eax,%ebx
+  801304:	83 c4 20             	add    $0x20,%esp
+  801307:	85 c0                	test   %eax,%eax
+  801309:	78 4e                	js     801359 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80130b:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  801310:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801313:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  801315:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801318:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80131f:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801322:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  801324:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801327:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80132e:	83 ec 0c             	sub    $0xc,%esp
+  801331:	ff 75 f4             	push   -0xc(%ebp)
+  801334:	e8 ed f0 ff ff       	call   800426 <fd2num>
+  801339:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80133c:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80133e:	83 c4 04             	add    $0x4,%esp
+  801341:	ff 75 f0             	push   -0x10(%ebp)
+  801344:	e8 dd f0 ff ff       	call   800426 <fd2num>
+  801349:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80134c:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80134f:	83 c4 10             	add    $0x10,%esp
+  801352:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801357:	eb 2e                	jmp    801387 <pipe+0x141>
+	sys_page_unmap(0, va);
+  801359:	83 ec 08             	sub    $0x8,%esp
+  80135c:	56                   	push   %esi
+  80135d:	6a 00                	push   $0x0
+  80135f:	e8 74 ee ff ff       	call   8001d8 <sys_page_unmap>
+  801364:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  801367:	83 ec 08             	sub    $0x8,%esp
+  80136a:	ff 75 f0             	push   -0x10(%ebp)
+  80136d:	6a 00                	push   $0x0
+  80136f:	e8 64 ee ff ff       	call   8001d8 <sys_page_unmap>
+  801374:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  801377:	83 ec 08             	sub    $0x8,%esp
+  80137a:	ff 75 f4             	push   -0xc(%ebp)
+  80137d:	6a 00                	push   $0x0
+  80137f:	e8 54 ee ff ff       	call   8001d8 <sys_page_unmap>
+  801384:	83 c4 10             	add    $0x10,%esp
+}
+  801387:	89 d8                	mov    %ebx,%eax
+  801389:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80138c:	5b                   	pop    %ebx
+  80138d:	5e                   	pop    %esi
+  80138e:	5d                   	pop    %ebp
+  80138f:	c3                   	ret
+
+00801390 <pipeisclosed>:
+{
+  801390:	55                   	push   %ebp
+  801391:	89 e5                	mov    %esp,%ebp
+  801393:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801396:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801399:	50                   	push   %eax
+  80139a:	ff 75 08             	push   0x8(%ebp)
+  80139d:	e8 01 f1 ff ff       	call   8004a3 <fd_lookup>
+  8013a2:	83 c4 10             	add    $0x10,%esp
+  8013a5:	85 c0                	test   %eax,%eax
+  8013a7:	78 18                	js     8013c1 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8013a9:	83 ec 0c             	sub    $0xc,%esp
+  8013ac:	ff 75 f4             	push   -0xc(%ebp)
+  8013af:	e8 82 f0 ff ff       	call   800436 <fd2data>
+  8013b4:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8013b6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013b9:	e8 33 fd ff ff       	call   8010f1 <_pipeisclosed>
+  8013be:	83 c4 10             	add    $0x10,%esp
+}
+  8013c1:	c9                   	leave
+  8013c2:	c3                   	ret
+
+008013c3 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8013c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013c8:	c3                   	ret
+
+008013c9 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8013c9:	55                   	push   %ebp
+  8013ca:	89 e5                	mov    %esp,%ebp
+  8013cc:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8013cf:	68 33 26 80 00       	push   $0x802633
+  8013d4:	ff 75 0c             	push   0xc(%ebp)
+  8013d7:	e8 ef 07 00 00       	call   801bcb <strcpy>
+	return 0;
+}
+  8013dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013e1:	c9                   	leave
+  8013e2:	c3                   	ret
+
+008013e3 <devcons_write>:
+{
+  8013e3:	55                   	push   %ebp
+  8013e4:	89 e5                	mov    %esp,%ebp
+  8013e6:	57                   	push   %edi
+  8013e7:	56                   	push   %esi
+  8013e8:	53                   	push   %ebx
+  8013e9:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8013ef:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8013f4:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8013fa:	eb 2e                	jmp    80142a <devcons_write+0x47>
+		m = n - tot;
+  8013fc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013ff:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  801401:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801406:	39 c3                	cmp    %eax,%ebx
+  801408:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80140b:	83 ec 04             	sub    $0x4,%esp
+  80140e:	53                   	push   %ebx
+  80140f:	89 f0                	mov    %esi,%eax
+  801411:	03 45 0c             	add    0xc(%ebp),%eax
+  801414:	50                   	push   %eax
+  801415:	57                   	push   %edi
+  801416:	e8 36 09 00 00       	call   801d51 <memmove>
+		sys_cputs(buf, m);
+  80141b:	83 c4 08             	add    $0x8,%esp
+  80141e:	53                   	push   %ebx
+  80141f:	57                   	push   %edi
+  801420:	e8 72 ec ff ff       	call   800097 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  801425:	01 de                	add    %ebx,%esi
+  801427:	83 c4 10             	add    $0x10,%esp
+  80142a:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80142d:	72 cd                	jb     8013fc <devcons_write+0x19>
+}
+  80142f:	89 f0                	mov    %esi,%eax
+  801431:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801434:	5b                   	pop    %ebx
+  801435:	5e                   	pop    %esi
+  801436:	5f                   	pop    %edi
+  801437:	5d                   	pop    %ebp
+  801438:	c3                   	ret
+
+00801439 <devcons_read>:
+{
+  801439:	55                   	push   %ebp
+  80143a:	89 e5                	mov    %esp,%ebp
+  80143c:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80143f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801444:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801448:	75 07                	jne    801451 <devcons_read+0x18>
+  80144a:	eb 1f                	jmp    80146b <devcons_read+0x32>
+		sys_yield();
+  80144c:	e8 e3 ec ff ff       	call   800134 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  801451:	e8 5f ec ff ff       	call   8000b5 <sys_cgetc>
+  801456:	85 c0                	test   %eax,%eax
+  801458:	74 f2                	je     80144c <devcons_read+0x13>
+	if (c < 0)
+  80145a:	78 0f                	js     80146b <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80145c:	83 f8 04             	cmp    $0x4,%eax
+  80145f:	74 0c                	je     80146d <devcons_read+0x34>
+	*(char*)vbuf = c;
+  801461:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801464:	88 02                	mov    %al,(%edx)
+	return 1;
+  801466:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80146b:	c9                   	leave
+  80146c:	c3                   	ret
+		return 0;
+  80146d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801472:	eb f7                	jmp    80146b <devcons_read+0x32>
+
+00801474 <cputchar>:
+{
+  801474:	55                   	push   %ebp
+  801475:	89 e5                	mov    %esp,%ebp
+  801477:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80147a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80147d:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  801480:	6a 01                	push   $0x1
+  801482:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801485:	50                   	push   %eax
+  801486:	e8 0c ec ff ff       	call   800097 <sys_cputs>
+}
+  80148b:	83 c4 10             	add    $0x10,%esp
+  80148e:	c9                   	leave
+  80148f:	c3                   	ret
+
+00801490 <getchar>:
+{
+  801490:	55                   	push   %ebp
+  801491:	89 e5                	mov    %esp,%ebp
+  801493:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  801496:	6a 01                	push   $0x1
+  801498:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80149b:	50                   	push   %eax
+  80149c:	6a 00                	push   $0x0
+  80149e:	e8 66 f2 ff ff       	call   800709 <read>
+	if (r < 0)
+  8014a3:	83 c4 10             	add    $0x10,%esp
+  8014a6:	85 c0                	test   %eax,%eax
+  8014a8:	78 06                	js     8014b0 <getchar+0x20>
+	if (r < 1)
+  8014aa:	74 06                	je     8014b2 <getchar+0x22>
+	return c;
+  8014ac:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8014b0:	c9                   	leave
+  8014b1:	c3                   	ret
+		return -E_EOF;
+  8014b2:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8014b7:	eb f7                	jmp    8014b0 <getchar+0x20>
+
+008014b9 <iscons>:
+{
+  8014b9:	55                   	push   %ebp
+  8014ba:	89 e5                	mov    %esp,%ebp
+  8014bc:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8014bf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014c2:	50                   	push   %eax
+  8014c3:	ff 75 08             	push   0x8(%ebp)
+  8014c6:	e8 d8 ef ff ff       	call   8004a3 <fd_lookup>
+  8014cb:	83 c4 10             	add    $0x10,%esp
+  8014ce:	85 c0                	test   %eax,%eax
+  8014d0:	78 11                	js     8014e3 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8014d2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014d5:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  8014db:	39 10                	cmp    %edx,(%eax)
+  8014dd:	0f 94 c0             	sete   %al
+  8014e0:	0f b6 c0             	movzbl %al,%eax
+}
+  8014e3:	c9                   	leave
+  8014e4:	c3                   	ret
+
+008014e5 <opencons>:
+{
+  8014e5:	55                   	push   %ebp
+  8014e6:	89 e5                	mov    %esp,%ebp
+  8014e8:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8014eb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014ee:	50                   	push   %eax
+  8014ef:	e8 59 ef ff ff       	call   80044d <fd_alloc>
+  8014f4:	83 c4 10             	add    $0x10,%esp
+  8014f7:	85 c0                	test   %eax,%eax
+  8014f9:	78 3a                	js     801535 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8014fb:	83 ec 04             	sub    $0x4,%esp
+  8014fe:	68 07 04 00 00       	push   $0x407
+  801503:	ff 75 f4             	push   -0xc(%ebp)
+  801506:	6a 00                	push   $0x0
+  801508:	e8 46 ec ff ff       	call   800153 <sys_page_alloc>
+  80150d:	83 c4 10             	add    $0x10,%esp
+  801510:	85 c0                	test   %eax,%eax
+  801512:	78 21                	js     801535 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  801514:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801517:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  80151d:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80151f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801522:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  801529:	83 ec 0c             	sub    $0xc,%esp
+  80152c:	50                   	push   %eax
+  80152d:	e8 f4 ee ff ff       	call   800426 <fd2num>
+  801532:	83 c4 10             	add    $0x10,%esp
+}
+  801535:	c9                   	leave
+  801536:	c3                   	ret
+
+00801537 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  801537:	55                   	push   %ebp
+  801538:	89 e5                	mov    %esp,%ebp
+  80153a:	56                   	push   %esi
+  80153b:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80153c:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80153f:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  801545:	e8 cb eb ff ff       	call   800115 <sys_getenvid>
+  80154a:	83 ec 0c             	sub    $0xc,%esp
+  80154d:	ff 75 0c             	push   0xc(%ebp)
+  801550:	ff 75 08             	push   0x8(%ebp)
+  801553:	56                   	push   %esi
+  801554:	50                   	push   %eax
+  801555:	68 40 26 80 00       	push   $0x802640
+  80155a:	e8 b3 00 00 00       	call   801612 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80155f:	83 c4 18             	add    $0x18,%esp
+  801562:	53                   	push   %ebx
+  801563:	ff 75 10             	push   0x10(%ebp)
+  801566:	e8 56 00 00 00       	call   8015c1 <vcprintf>
+	cprintf("\n");
+  80156b:	c7 04 24 2c 26 80 00 	movl   $0x80262c,(%esp)
+  801572:	e8 9b 00 00 00       	call   801612 <cprintf>
+  801577:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80157a:	cc                   	int3
+	while (1)
+  80157b:	eb fd                	jmp    80157a <_panic+0x43>
+
+0080157d <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80157d:	55                   	push   %ebp
+  80157e:	89 e5                	mov    %esp,%ebp
+  801580:	53                   	push   %ebx
+  801581:	83 ec 04             	sub    $0x4,%esp
+  801584:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  801587:	8b 13                	mov    (%ebx),%edx
+  801589:	8d 42 01             	lea    0x1(%edx),%eax
+  80158c:	89 03                	mov    %eax,(%ebx)
+  80158e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801591:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  801595:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80159a:	74 09                	je     8015a5 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80159c:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8015a0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015a3:	c9                   	leave
+  8015a4:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8015a5:	83 ec 08             	sub    $0x8,%esp
+  8015a8:	68 ff 00 00 00       	push   $0xff
+  8015ad:	8d 43 08             	lea    0x8(%ebx),%eax
+  8015b0:	50                   	push   %eax
+  8015b1:	e8 e1 ea ff ff       	call   800097 <sys_cputs>
+		b->idx = 0;
+  8015b6:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8015bc:	83 c4 10             	add    $0x10,%esp
+  8015bf:	eb db                	jmp    80159c <putch+0x1f>
+
+008015c1 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8015c1:	55                   	push   %ebp
+  8015c2:	89 e5                	mov    %esp,%ebp
+  8015c4:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8015ca:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8015d1:	00 00 00 
+	b.cnt = 0;
+  8015d4:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8015db:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8015de:	ff 75 0c             	push   0xc(%ebp)
+  8015e1:	ff 75 08             	push   0x8(%ebp)
+  8015e4:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8015ea:	50                   	push   %eax
+  8015eb:	68 7d 15 80 00       	push   $0x80157d
+  8015f0:	e8 14 01 00 00       	call   801709 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8015f5:	83 c4 08             	add    $0x8,%esp
+  8015f8:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8015fe:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  801604:	50                   	push   %eax
+  801605:	e8 8d ea ff ff       	call   800097 <sys_cputs>
+
+	return b.cnt;
+}
+  80160a:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  801610:	c9                   	leave
+  801611:	c3                   	ret
+
+00801612 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  801612:	55                   	push   %ebp
+  801613:	89 e5                	mov    %esp,%ebp
+  801615:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  801618:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80161b:	50                   	push   %eax
+  80161c:	ff 75 08             	push   0x8(%ebp)
+  80161f:	e8 9d ff ff ff       	call   8015c1 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  801624:	c9                   	leave
+  801625:	c3                   	ret
+
+00801626 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  801626:	55                   	push   %ebp
+  801627:	89 e5                	mov    %esp,%ebp
+  801629:	57                   	push   %edi
+  80162a:	56                   	push   %esi
+  80162b:	53                   	push   %ebx
+  80162c:	83 ec 1c             	sub    $0x1c,%esp
+  80162f:	89 c7                	mov    %eax,%edi
+  801631:	89 d6                	mov    %edx,%esi
+  801633:	8b 45 08             	mov    0x8(%ebp),%eax
+  801636:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801639:	89 d1                	mov    %edx,%ecx
+  80163b:	89 c2                	mov    %eax,%edx
+  80163d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801640:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801643:	8b 45 10             	mov    0x10(%ebp),%eax
+  801646:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  801649:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80164c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801653:	39 c2                	cmp    %eax,%edx
+  801655:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  801658:	72 3e                	jb     801698 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80165a:	83 ec 0c             	sub    $0xc,%esp
+  80165d:	ff 75 18             	push   0x18(%ebp)
+  801660:	83 eb 01             	sub    $0x1,%ebx
+  801663:	53                   	push   %ebx
+  801664:	50                   	push   %eax
+  801665:	83 ec 08             	sub    $0x8,%esp
+  801668:	ff 75 e4             	push   -0x1c(%ebp)
+  80166b:	ff 75 e0             	push   -0x20(%ebp)
+  80166e:	ff 75 dc             	push   -0x24(%ebp)
+  801671:	ff 75 d8             	push   -0x28(%ebp)
+  801674:	e8 d7 0a 00 00       	call   802150 <__udivdi3>
+  801679:	83 c4 18             	add    $0x18,%esp
+  80167c:	52                   	push   %edx
+  80167d:	50                   	push   %eax
+  80167e:	89 f2                	mov    %esi,%edx
+  801680:	89 f8                	mov    %edi,%eax
+  801682:	e8 9f ff ff ff       	call   801626 <printnum>
+  801687:	83 c4 20             	add    $0x20,%esp
+  80168a:	eb 13                	jmp    80169f <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80168c:	83 ec 08             	sub    $0x8,%esp
+  80168f:	56                   	push   %esi
+  801690:	ff 75 18             	push   0x18(%ebp)
+  801693:	ff d7                	call   *%edi
+  801695:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  801698:	83 eb 01             	sub    $0x1,%ebx
+  80169b:	85 db                	test   %ebx,%ebx
+  80169d:	7f ed                	jg     80168c <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80169f:	83 ec 08             	sub    $0x8,%esp
+  8016a2:	56                   	push   %esi
+  8016a3:	83 ec 04             	sub    $0x4,%esp
+  8016a6:	ff 75 e4             	push   -0x1c(%ebp)
+  8016a9:	ff 75 e0             	push   -0x20(%ebp)
+  8016ac:	ff 75 dc             	push   -0x24(%ebp)
+  8016af:	ff 75 d8             	push   -0x28(%ebp)
+  8016b2:	e8 69 0b 00 00       	call   802220 <__umoddi3>
+  8016b7:	83 c4 14             	add    $0x14,%esp
+  8016ba:	0f be 80 63 26 80 00 	movsbl 0x802663(%eax),%eax
+  8016c1:	50                   	push   %eax
+  8016c2:	ff d7                	call   *%edi
+}
+  8016c4:	83 c4 10             	add    $0x10,%esp
+  8016c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016ca:	5b                   	pop    %ebx
+  8016cb:	5e                   	pop    %esi
+  8016cc:	5f                   	pop    %edi
+  8016cd:	5d                   	pop    %ebp
+  8016ce:	c3                   	ret
+
+008016cf <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8016cf:	55                   	push   %ebp
+  8016d0:	89 e5                	mov    %esp,%ebp
+  8016d2:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8016d5:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8016d9:	8b 10                	mov    (%eax),%edx
+  8016db:	3b 50 04             	cmp    0x4(%eax),%edx
+  8016de:	73 0a                	jae    8016ea <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8016e0:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8016e3:	89 08                	mov    %ecx,(%eax)
+  8016e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016e8:	88 02                	mov    %al,(%edx)
+}
+  8016ea:	5d                   	pop    %ebp
+  8016eb:	c3                   	ret
+
+008016ec <printfmt>:
+{
+  8016ec:	55                   	push   %ebp
+  8016ed:	89 e5                	mov    %esp,%ebp
+  8016ef:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8016f2:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8016f5:	50                   	push   %eax
+  8016f6:	ff 75 10             	push   0x10(%ebp)
+  8016f9:	ff 75 0c             	push   0xc(%ebp)
+  8016fc:	ff 75 08             	push   0x8(%ebp)
+  8016ff:	e8 05 00 00 00       	call   801709 <vprintfmt>
+}
+  801704:	83 c4 10             	add    $0x10,%esp
+  801707:	c9                   	leave
+  801708:	c3                   	ret
+
+00801709 <vprintfmt>:
+{
+  801709:	55                   	push   %ebp
+  80170a:	89 e5                	mov    %esp,%ebp
+  80170c:	57                   	push   %edi
+  80170d:	56                   	push   %esi
+  80170e:	53                   	push   %ebx
+  80170f:	83 ec 2c             	sub    $0x2c,%esp
+  801712:	8b 75 08             	mov    0x8(%ebp),%esi
+  801715:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801718:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80171b:	eb 0a                	jmp    801727 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80171d:	83 ec 08             	sub    $0x8,%esp
+  801720:	53                   	push   %ebx
+  801721:	50                   	push   %eax
+  801722:	ff d6                	call   *%esi
+  801724:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801727:	83 c7 01             	add    $0x1,%edi
+  80172a:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80172e:	83 f8 25             	cmp    $0x25,%eax
+  801731:	74 0c                	je     80173f <vprintfmt+0x36>
+			if (ch == '\0')
+  801733:	85 c0                	test   %eax,%eax
+  801735:	75 e6                	jne    80171d <vprintfmt+0x14>
+}
+  801737:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80173a:	5b                   	pop    %ebx
+  80173b:	5e                   	pop    %esi
+  80173c:	5f                   	pop    %edi
+  80173d:	5d                   	pop    %ebp
+  80173e:	c3                   	ret
+		padc = ' ';
+  80173f:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  801743:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80174a:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  801751:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  801758:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80175d:	8d 47 01             	lea    0x1(%edi),%eax
+  801760:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801763:	0f b6 17             	movzbl (%edi),%edx
+  801766:	8d 42 dd             	lea    -0x23(%edx),%eax
+  801769:	3c 55                	cmp    $0x55,%al
+  80176b:	0f 87 9a 03 00 00    	ja     801b0b <vprintfmt+0x402>
+  801771:	0f b6 c0             	movzbl %al,%eax
+  801774:	ff 24 85 a0 27 80 00 	jmp    *0x8027a0(,%eax,4)
+  80177b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  80177e:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  801782:	eb d9                	jmp    80175d <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  801784:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801787:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80178b:	eb d0                	jmp    80175d <vprintfmt+0x54>
+  80178d:	0f b6 d2             	movzbl %dl,%edx
+  801790:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  801793:	b8 00 00 00 00       	mov    $0x0,%eax
+  801798:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80179b:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80179e:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8017a2:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8017a5:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8017a8:	83 f9 09             	cmp    $0x9,%ecx
+  8017ab:	77 55                	ja     801802 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8017ad:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8017b0:	eb e9                	jmp    80179b <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8017b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8017b5:	8b 00                	mov    (%eax),%eax
+  8017b7:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8017ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8017bd:	8d 40 04             	lea    0x4(%eax),%eax
+  8017c0:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8017c3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8017c6:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8017ca:	79 91                	jns    80175d <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8017cc:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8017cf:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8017d2:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8017d9:	eb 82                	jmp    80175d <vprintfmt+0x54>
+			if (width < 0)
+  8017db:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8017de:	85 d2                	test   %edx,%edx
+  8017e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017e5:	0f 49 c2             	cmovns %edx,%eax
+  8017e8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8017eb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8017ee:	e9 6a ff ff ff       	jmp    80175d <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8017f3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8017f6:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8017fd:	e9 5b ff ff ff       	jmp    80175d <vprintfmt+0x54>
+  801802:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801805:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801808:	eb bc                	jmp    8017c6 <vprintfmt+0xbd>
+			lflag++;
+  80180a:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80180d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  801810:	e9 48 ff ff ff       	jmp    80175d <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  801815:	8b 45 14             	mov    0x14(%ebp),%eax
+  801818:	8d 78 04             	lea    0x4(%eax),%edi
+  80181b:	83 ec 08             	sub    $0x8,%esp
+  80181e:	53                   	push   %ebx
+  80181f:	ff 30                	push   (%eax)
+  801821:	ff d6                	call   *%esi
+			break;
+  801823:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  801826:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  801829:	e9 7c 02 00 00       	jmp    801aaa <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  80182e:	8b 45 14             	mov    0x14(%ebp),%eax
+  801831:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  801834:	8b 10                	mov    (%eax),%edx
+  801836:	89 d0                	mov    %edx,%eax
+  801838:	f7 d8                	neg    %eax
+  80183a:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80183d:	83 f8 10             	cmp    $0x10,%eax
+  801840:	7f 23                	jg     801865 <vprintfmt+0x15c>
+  801842:	8b 14 85 00 29 80 00 	mov    0x802900(,%eax,4),%edx
+  801849:	85 d2                	test   %edx,%edx
+  80184b:	74 18                	je     801865 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  80184d:	52                   	push   %edx
+  80184e:	68 c1 25 80 00       	push   $0x8025c1
+  801853:	53                   	push   %ebx
+  801854:	56                   	push   %esi
+  801855:	e8 92 fe ff ff       	call   8016ec <printfmt>
+  80185a:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80185d:	89 7d 14             	mov    %edi,0x14(%ebp)
+  801860:	e9 45 02 00 00       	jmp    801aaa <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  801865:	50                   	push   %eax
+  801866:	68 7b 26 80 00       	push   $0x80267b
+  80186b:	53                   	push   %ebx
+  80186c:	56                   	push   %esi
+  80186d:	e8 7a fe ff ff       	call   8016ec <printfmt>
+  801872:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801875:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  801878:	e9 2d 02 00 00       	jmp    801aaa <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80187d:	8b 45 14             	mov    0x14(%ebp),%eax
+  801880:	83 c0 04             	add    $0x4,%eax
+  801883:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  801886:	8b 45 14             	mov    0x14(%ebp),%eax
+  801889:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80188b:	85 c9                	test   %ecx,%ecx
+  80188d:	b8 74 26 80 00       	mov    $0x802674,%eax
+  801892:	0f 45 c1             	cmovne %ecx,%eax
+  801895:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  801898:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80189c:	7e 06                	jle    8018a4 <vprintfmt+0x19b>
+  80189e:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8018a2:	75 0b                	jne    8018af <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8018a4:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8018a7:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8018aa:	89 75 08             	mov    %esi,0x8(%ebp)
+  8018ad:	eb 5c                	jmp    80190b <vprintfmt+0x202>
+  8018af:	83 ec 08             	sub    $0x8,%esp
+  8018b2:	ff 75 d0             	push   -0x30(%ebp)
+  8018b5:	ff 75 cc             	push   -0x34(%ebp)
+  8018b8:	e8 eb 02 00 00       	call   801ba8 <strnlen>
+  8018bd:	89 c2                	mov    %eax,%edx
+  8018bf:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8018c2:	29 d0                	sub    %edx,%eax
+  8018c4:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8018c7:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8018cb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8018ce:	89 75 08             	mov    %esi,0x8(%ebp)
+  8018d1:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8018d3:	eb 0e                	jmp    8018e3 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8018d5:	83 ec 08             	sub    $0x8,%esp
+  8018d8:	53                   	push   %ebx
+  8018d9:	57                   	push   %edi
+  8018da:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8018dd:	83 ee 01             	sub    $0x1,%esi
+  8018e0:	83 c4 10             	add    $0x10,%esp
+  8018e3:	85 f6                	test   %esi,%esi
+  8018e5:	7f ee                	jg     8018d5 <vprintfmt+0x1cc>
+  8018e7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8018ea:	8b 75 08             	mov    0x8(%ebp),%esi
+  8018ed:	85 c0                	test   %eax,%eax
+  8018ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018f4:	0f 49 d0             	cmovns %eax,%edx
+  8018f7:	29 d0                	sub    %edx,%eax
+  8018f9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8018fc:	eb a6                	jmp    8018a4 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8018fe:	83 ec 08             	sub    $0x8,%esp
+  801901:	53                   	push   %ebx
+  801902:	52                   	push   %edx
+  801903:	ff 55 08             	call   *0x8(%ebp)
+  801906:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801909:	89 f1                	mov    %esi,%ecx
+  80190b:	8d 71 01             	lea    0x1(%ecx),%esi
+  80190e:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  801912:	0f be d0             	movsbl %al,%edx
+  801915:	85 d2                	test   %edx,%edx
+  801917:	74 28                	je     801941 <vprintfmt+0x238>
+  801919:	85 ff                	test   %edi,%edi
+  80191b:	78 05                	js     801922 <vprintfmt+0x219>
+  80191d:	83 ef 01             	sub    $0x1,%edi
+  801920:	78 30                	js     801952 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  801922:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  801926:	74 d6                	je     8018fe <vprintfmt+0x1f5>
+  801928:	0f be c0             	movsbl %al,%eax
+  80192b:	83 e8 20             	sub    $0x20,%eax
+  80192e:	83 f8 5e             	cmp    $0x5e,%eax
+  801931:	76 cb                	jbe    8018fe <vprintfmt+0x1f5>
+					putch('?', putdat);
+  801933:	83 ec 08             	sub    $0x8,%esp
+  801936:	53                   	push   %ebx
+  801937:	6a 3f                	push   $0x3f
+  801939:	ff 55 08             	call   *0x8(%ebp)
+  80193c:	83 c4 10             	add    $0x10,%esp
+  80193f:	eb c8                	jmp    801909 <vprintfmt+0x200>
+  801941:	8b 75 08             	mov    0x8(%ebp),%esi
+  801944:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  801947:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80194a:	01 d0                	add    %edx,%eax
+  80194c:	29 c8                	sub    %ecx,%eax
+  80194e:	89 c7                	mov    %eax,%edi
+  801950:	eb 13                	jmp    801965 <vprintfmt+0x25c>
+  801952:	8b 75 08             	mov    0x8(%ebp),%esi
+  801955:	eb ed                	jmp    801944 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  801957:	83 ec 08             	sub    $0x8,%esp
+  80195a:	53                   	push   %ebx
+  80195b:	6a 20                	push   $0x20
+  80195d:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80195f:	83 ef 01             	sub    $0x1,%edi
+  801962:	83 c4 10             	add    $0x10,%esp
+  801965:	85 ff                	test   %edi,%edi
+  801967:	7f ee                	jg     801957 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801969:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80196c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80196f:	e9 36 01 00 00       	jmp    801aaa <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  801974:	83 f9 01             	cmp    $0x1,%ecx
+  801977:	7f 1f                	jg     801998 <vprintfmt+0x28f>
+	else if (lflag)
+  801979:	85 c9                	test   %ecx,%ecx
+  80197b:	74 67                	je     8019e4 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  80197d:	8b 45 14             	mov    0x14(%ebp),%eax
+  801980:	8b 00                	mov    (%eax),%eax
+  801982:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801985:	89 c1                	mov    %eax,%ecx
+  801987:	c1 f9 1f             	sar    $0x1f,%ecx
+  80198a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80198d:	8b 45 14             	mov    0x14(%ebp),%eax
+  801990:	8d 40 04             	lea    0x4(%eax),%eax
+  801993:	89 45 14             	mov    %eax,0x14(%ebp)
+  801996:	eb 17                	jmp    8019af <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  801998:	8b 45 14             	mov    0x14(%ebp),%eax
+  80199b:	8b 50 04             	mov    0x4(%eax),%edx
+  80199e:	8b 00                	mov    (%eax),%eax
+  8019a0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8019a3:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8019a6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019a9:	8d 40 08             	lea    0x8(%eax),%eax
+  8019ac:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8019af:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8019b2:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8019b5:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8019ba:	85 c9                	test   %ecx,%ecx
+  8019bc:	0f 89 ce 00 00 00    	jns    801a90 <vprintfmt+0x387>
+				putch('-', putdat);
+  8019c2:	83 ec 08             	sub    $0x8,%esp
+  8019c5:	53                   	push   %ebx
+  8019c6:	6a 2d                	push   $0x2d
+  8019c8:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8019ca:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8019cd:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8019d0:	f7 da                	neg    %edx
+  8019d2:	83 d1 00             	adc    $0x0,%ecx
+  8019d5:	f7 d9                	neg    %ecx
+  8019d7:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8019da:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8019df:	e9 ac 00 00 00       	jmp    801a90 <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  8019e4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019e7:	8b 00                	mov    (%eax),%eax
+  8019e9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8019ec:	89 c1                	mov    %eax,%ecx
+  8019ee:	c1 f9 1f             	sar    $0x1f,%ecx
+  8019f1:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8019f4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019f7:	8d 40 04             	lea    0x4(%eax),%eax
+  8019fa:	89 45 14             	mov    %eax,0x14(%ebp)
+  8019fd:	eb b0                	jmp    8019af <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8019ff:	83 f9 01             	cmp    $0x1,%ecx
+  801a02:	7f 1b                	jg     801a1f <vprintfmt+0x316>
+	else if (lflag)
+  801a04:	85 c9                	test   %ecx,%ecx
+  801a06:	74 2c                	je     801a34 <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  801a08:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a0b:	8b 10                	mov    (%eax),%edx
+  801a0d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a12:	8d 40 04             	lea    0x4(%eax),%eax
+  801a15:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801a18:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  801a1d:	eb 71                	jmp    801a90 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  801a1f:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a22:	8b 10                	mov    (%eax),%edx
+  801a24:	8b 48 04             	mov    0x4(%eax),%ecx
+  801a27:	8d 40 08             	lea    0x8(%eax),%eax
+  801a2a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801a2d:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  801a32:	eb 5c                	jmp    801a90 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  801a34:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a37:	8b 10                	mov    (%eax),%edx
+  801a39:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a3e:	8d 40 04             	lea    0x4(%eax),%eax
+  801a41:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801a44:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  801a49:	eb 45                	jmp    801a90 <vprintfmt+0x387>
+			putch('X', putdat);
+  801a4b:	83 ec 08             	sub    $0x8,%esp
+  801a4e:	53                   	push   %ebx
+  801a4f:	6a 58                	push   $0x58
+  801a51:	ff d6                	call   *%esi
+			putch('X', putdat);
+  801a53:	83 c4 08             	add    $0x8,%esp
+  801a56:	53                   	push   %ebx
+  801a57:	6a 58                	push   $0x58
+  801a59:	ff d6                	call   *%esi
+			putch('X', putdat);
+  801a5b:	83 c4 08             	add    $0x8,%esp
+  801a5e:	53                   	push   %ebx
+  801a5f:	6a 58                	push   $0x58
+  801a61:	ff d6                	call   *%esi
+			break;
+  801a63:	83 c4 10             	add    $0x10,%esp
+  801a66:	eb 42                	jmp    801aaa <vprintfmt+0x3a1>
+			putch('0', putdat);
+  801a68:	83 ec 08             	sub    $0x8,%esp
+  801a6b:	53                   	push   %ebx
+  801a6c:	6a 30                	push   $0x30
+  801a6e:	ff d6                	call   *%esi
+			putch('x', putdat);
+  801a70:	83 c4 08             	add    $0x8,%esp
+  801a73:	53                   	push   %ebx
+  801a74:	6a 78                	push   $0x78
+  801a76:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  801a78:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a7b:	8b 10                	mov    (%eax),%edx
+  801a7d:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  801a82:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  801a85:	8d 40 04             	lea    0x4(%eax),%eax
+  801a88:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801a8b:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  801a90:	83 ec 0c             	sub    $0xc,%esp
+  801a93:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  801a97:	50                   	push   %eax
+  801a98:	ff 75 e0             	push   -0x20(%ebp)
+  801a9b:	57                   	push   %edi
+  801a9c:	51                   	push   %ecx
+  801a9d:	52                   	push   %edx
+  801a9e:	89 da                	mov    %ebx,%edx
+  801aa0:	89 f0                	mov    %esi,%eax
+  801aa2:	e8 7f fb ff ff       	call   801626 <printnum>
+			break;
+  801aa7:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  801aaa:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801aad:	e9 75 fc ff ff       	jmp    801727 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  801ab2:	83 f9 01             	cmp    $0x1,%ecx
+  801ab5:	7f 1b                	jg     801ad2 <vprintfmt+0x3c9>
+	else if (lflag)
+  801ab7:	85 c9                	test   %ecx,%ecx
+  801ab9:	74 2c                	je     801ae7 <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  801abb:	8b 45 14             	mov    0x14(%ebp),%eax
+  801abe:	8b 10                	mov    (%eax),%edx
+  801ac0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ac5:	8d 40 04             	lea    0x4(%eax),%eax
+  801ac8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801acb:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  801ad0:	eb be                	jmp    801a90 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  801ad2:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ad5:	8b 10                	mov    (%eax),%edx
+  801ad7:	8b 48 04             	mov    0x4(%eax),%ecx
+  801ada:	8d 40 08             	lea    0x8(%eax),%eax
+  801add:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801ae0:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  801ae5:	eb a9                	jmp    801a90 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  801ae7:	8b 45 14             	mov    0x14(%ebp),%eax
+  801aea:	8b 10                	mov    (%eax),%edx
+  801aec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801af1:	8d 40 04             	lea    0x4(%eax),%eax
+  801af4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801af7:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  801afc:	eb 92                	jmp    801a90 <vprintfmt+0x387>
+			putch(ch, putdat);
+  801afe:	83 ec 08             	sub    $0x8,%esp
+  801b01:	53                   	push   %ebx
+  801b02:	6a 25                	push   $0x25
+  801b04:	ff d6                	call   *%esi
+			break;
+  801b06:	83 c4 10             	add    $0x10,%esp
+  801b09:	eb 9f                	jmp    801aaa <vprintfmt+0x3a1>
+			putch('%', putdat);
+  801b0b:	83 ec 08             	sub    $0x8,%esp
+  801b0e:	53                   	push   %ebx
+  801b0f:	6a 25                	push   $0x25
+  801b11:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801b13:	83 c4 10             	add    $0x10,%esp
+  801b16:	89 f8                	mov    %edi,%eax
+  801b18:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  801b1c:	74 05                	je     801b23 <vprintfmt+0x41a>
+  801b1e:	83 e8 01             	sub    $0x1,%eax
+  801b21:	eb f5                	jmp    801b18 <vprintfmt+0x40f>
+  801b23:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801b26:	eb 82                	jmp    801aaa <vprintfmt+0x3a1>
+
+00801b28 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  801b28:	55                   	push   %ebp
+  801b29:	89 e5                	mov    %esp,%ebp
+  801b2b:	83 ec 18             	sub    $0x18,%esp
+  801b2e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b31:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  801b34:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  801b37:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  801b3b:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  801b3e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  801b45:	85 c0                	test   %eax,%eax
+  801b47:	74 26                	je     801b6f <vsnprintf+0x47>
+  801b49:	85 d2                	test   %edx,%edx
+  801b4b:	7e 22                	jle    801b6f <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  801b4d:	ff 75 14             	push   0x14(%ebp)
+  801b50:	ff 75 10             	push   0x10(%ebp)
+  801b53:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  801b56:	50                   	push   %eax
+  801b57:	68 cf 16 80 00       	push   $0x8016cf
+  801b5c:	e8 a8 fb ff ff       	call   801709 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  801b61:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801b64:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  801b67:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b6a:	83 c4 10             	add    $0x10,%esp
+}
+  801b6d:	c9                   	leave
+  801b6e:	c3                   	ret
+		return -E_INVAL;
+  801b6f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b74:	eb f7                	jmp    801b6d <vsnprintf+0x45>
+
+00801b76 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801b76:	55                   	push   %ebp
+  801b77:	89 e5                	mov    %esp,%ebp
+  801b79:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  801b7c:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  801b7f:	50                   	push   %eax
+  801b80:	ff 75 10             	push   0x10(%ebp)
+  801b83:	ff 75 0c             	push   0xc(%ebp)
+  801b86:	ff 75 08             	push   0x8(%ebp)
+  801b89:	e8 9a ff ff ff       	call   801b28 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  801b8e:	c9                   	leave
+  801b8f:	c3                   	ret
+
+00801b90 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  801b90:	55                   	push   %ebp
+  801b91:	89 e5                	mov    %esp,%ebp
+  801b93:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  801b96:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b9b:	eb 03                	jmp    801ba0 <strlen+0x10>
+		n++;
+  801b9d:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  801ba0:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  801ba4:	75 f7                	jne    801b9d <strlen+0xd>
+	return n;
+}
+  801ba6:	5d                   	pop    %ebp
+  801ba7:	c3                   	ret
+
+00801ba8 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  801ba8:	55                   	push   %ebp
+  801ba9:	89 e5                	mov    %esp,%ebp
+  801bab:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801bae:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801bb1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bb6:	eb 03                	jmp    801bbb <strnlen+0x13>
+		n++;
+  801bb8:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801bbb:	39 d0                	cmp    %edx,%eax
+  801bbd:	74 08                	je     801bc7 <strnlen+0x1f>
+  801bbf:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  801bc3:	75 f3                	jne    801bb8 <strnlen+0x10>
+  801bc5:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  801bc7:	89 d0                	mov    %edx,%eax
+  801bc9:	5d                   	pop    %ebp
+  801bca:	c3                   	ret
+
+00801bcb <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801bcb:	55                   	push   %ebp
+  801bcc:	89 e5                	mov    %esp,%ebp
+  801bce:	53                   	push   %ebx
+  801bcf:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801bd2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  801bd5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bda:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  801bde:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  801be1:	83 c0 01             	add    $0x1,%eax
+  801be4:	84 d2                	test   %dl,%dl
+  801be6:	75 f2                	jne    801bda <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  801be8:	89 c8                	mov    %ecx,%eax
+  801bea:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bed:	c9                   	leave
+  801bee:	c3                   	ret
+
+00801bef <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801bef:	55                   	push   %ebp
+  801bf0:	89 e5                	mov    %esp,%ebp
+  801bf2:	53                   	push   %ebx
+  801bf3:	83 ec 10             	sub    $0x10,%esp
+  801bf6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  801bf9:	53                   	push   %ebx
+  801bfa:	e8 91 ff ff ff       	call   801b90 <strlen>
+  801bff:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  801c02:	ff 75 0c             	push   0xc(%ebp)
+  801c05:	01 d8                	add    %ebx,%eax
+  801c07:	50                   	push   %eax
+  801c08:	e8 be ff ff ff       	call   801bcb <strcpy>
+	return dst;
+}
+  801c0d:	89 d8                	mov    %ebx,%eax
+  801c0f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c12:	c9                   	leave
+  801c13:	c3                   	ret
+
+00801c14 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801c14:	55                   	push   %ebp
+  801c15:	89 e5                	mov    %esp,%ebp
+  801c17:	56                   	push   %esi
+  801c18:	53                   	push   %ebx
+  801c19:	8b 75 08             	mov    0x8(%ebp),%esi
+  801c1c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  801c1f:	89 f3                	mov    %esi,%ebx
+  801c21:	03 5d 10             	add    0x10(%ebp),%ebx
+  801c24:	89 f0                	mov    %esi,%eax
+  801c26:	eb 0f                	jmp    801c37 <strncpy+0x23>
+		*dst++ = *src;
+  801c28:	83 c0 01             	add    $0x1,%eax
+  801c2b:	0f b6 0a             	movzbl (%edx),%ecx
+  801c2e:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  801c31:	80 f9 01             	cmp    $0x1,%cl
+  801c34:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  801c37:	39 d8                	cmp    %ebx,%eax
+  801c39:	75 ed                	jne    801c28 <strncpy+0x14>
+	}
+	return ret;
+}
+  801c3b:	89 f0                	mov    %esi,%eax
+  801c3d:	5b                   	pop    %ebx
+  801c3e:	5e                   	pop    %esi
+  801c3f:	5d                   	pop    %ebp
+  801c40:	c3                   	ret
+
+00801c41 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801c41:	55                   	push   %ebp
+  801c42:	89 e5                	mov    %esp,%ebp
+  801c44:	56                   	push   %esi
+  801c45:	53                   	push   %ebx
+  801c46:	8b 75 08             	mov    0x8(%ebp),%esi
+  801c49:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c4c:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  801c4f:	89 f0                	mov    %esi,%eax
+  801c51:	85 d2                	test   %edx,%edx
+  801c53:	74 21                	je     801c76 <strlcpy+0x35>
+  801c55:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  801c59:	89 f2                	mov    %esi,%edx
+  801c5b:	eb 09                	jmp    801c66 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  801c5d:	83 c1 01             	add    $0x1,%ecx
+  801c60:	83 c2 01             	add    $0x1,%edx
+  801c63:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  801c66:	39 c2                	cmp    %eax,%edx
+  801c68:	74 09                	je     801c73 <strlcpy+0x32>
+  801c6a:	0f b6 19             	movzbl (%ecx),%ebx
+  801c6d:	84 db                	test   %bl,%bl
+  801c6f:	75 ec                	jne    801c5d <strlcpy+0x1c>
+  801c71:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  801c73:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  801c76:	29 f0                	sub    %esi,%eax
+}
+  801c78:	5b                   	pop    %ebx
+  801c79:	5e                   	pop    %esi
+  801c7a:	5d                   	pop    %ebp
+  801c7b:	c3                   	ret
+
+00801c7c <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  801c7c:	55                   	push   %ebp
+  801c7d:	89 e5                	mov    %esp,%ebp
+  801c7f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801c82:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  801c85:	eb 06                	jmp    801c8d <strcmp+0x11>
+		p++, q++;
+  801c87:	83 c1 01             	add    $0x1,%ecx
+  801c8a:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  801c8d:	0f b6 01             	movzbl (%ecx),%eax
+  801c90:	84 c0                	test   %al,%al
+  801c92:	74 04                	je     801c98 <strcmp+0x1c>
+  801c94:	3a 02                	cmp    (%edx),%al
+  801c96:	74 ef                	je     801c87 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801c98:	0f b6 c0             	movzbl %al,%eax
+  801c9b:	0f b6 12             	movzbl (%edx),%edx
+  801c9e:	29 d0                	sub    %edx,%eax
+}
+  801ca0:	5d                   	pop    %ebp
+  801ca1:	c3                   	ret
+
+00801ca2 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801ca2:	55                   	push   %ebp
+  801ca3:	89 e5                	mov    %esp,%ebp
+  801ca5:	53                   	push   %ebx
+  801ca6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ca9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801cac:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  801caf:	eb 09                	jmp    801cba <strncmp+0x18>
+		n--, p++, q++;
+  801cb1:	83 ea 01             	sub    $0x1,%edx
+  801cb4:	83 c0 01             	add    $0x1,%eax
+  801cb7:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  801cba:	85 d2                	test   %edx,%edx
+  801cbc:	74 18                	je     801cd6 <strncmp+0x34>
+  801cbe:	0f b6 18             	movzbl (%eax),%ebx
+  801cc1:	84 db                	test   %bl,%bl
+  801cc3:	74 04                	je     801cc9 <strncmp+0x27>
+  801cc5:	3a 19                	cmp    (%ecx),%bl
+  801cc7:	74 e8                	je     801cb1 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801cc9:	0f b6 00             	movzbl (%eax),%eax
+  801ccc:	0f b6 11             	movzbl (%ecx),%edx
+  801ccf:	29 d0                	sub    %edx,%eax
+}
+  801cd1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cd4:	c9                   	leave
+  801cd5:	c3                   	ret
+		return 0;
+  801cd6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cdb:	eb f4                	jmp    801cd1 <strncmp+0x2f>
+
+00801cdd <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801cdd:	55                   	push   %ebp
+  801cde:	89 e5                	mov    %esp,%ebp
+  801ce0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ce3:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801ce7:	eb 03                	jmp    801cec <strchr+0xf>
+  801ce9:	83 c0 01             	add    $0x1,%eax
+  801cec:	0f b6 10             	movzbl (%eax),%edx
+  801cef:	84 d2                	test   %dl,%dl
+  801cf1:	74 06                	je     801cf9 <strchr+0x1c>
+		if (*s == c)
+  801cf3:	38 ca                	cmp    %cl,%dl
+  801cf5:	75 f2                	jne    801ce9 <strchr+0xc>
+  801cf7:	eb 05                	jmp    801cfe <strchr+0x21>
+			return (char *) s;
+	return 0;
+  801cf9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801cfe:	5d                   	pop    %ebp
+  801cff:	c3                   	ret
+
+00801d00 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801d00:	55                   	push   %ebp
+  801d01:	89 e5                	mov    %esp,%ebp
+  801d03:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d06:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801d0a:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  801d0d:	38 ca                	cmp    %cl,%dl
+  801d0f:	74 09                	je     801d1a <strfind+0x1a>
+  801d11:	84 d2                	test   %dl,%dl
+  801d13:	74 05                	je     801d1a <strfind+0x1a>
+	for (; *s; s++)
+  801d15:	83 c0 01             	add    $0x1,%eax
+  801d18:	eb f0                	jmp    801d0a <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  801d1a:	5d                   	pop    %ebp
+  801d1b:	c3                   	ret
+
+00801d1c <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801d1c:	55                   	push   %ebp
+  801d1d:	89 e5                	mov    %esp,%ebp
+  801d1f:	57                   	push   %edi
+  801d20:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801d23:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  801d26:	85 c9                	test   %ecx,%ecx
+  801d28:	74 20                	je     801d4a <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  801d2a:	89 f8                	mov    %edi,%eax
+  801d2c:	09 c8                	or     %ecx,%eax
+  801d2e:	a8 03                	test   $0x3,%al
+  801d30:	75 12                	jne    801d44 <memset+0x28>
+		c &= 0xFF;
+  801d32:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  801d36:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  801d3c:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  801d3f:	fc                   	cld
+  801d40:	f3 ab                	rep stos %eax,%es:(%edi)
+  801d42:	eb 06                	jmp    801d4a <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801d44:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d47:	fc                   	cld
+  801d48:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  801d4a:	89 f8                	mov    %edi,%eax
+  801d4c:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  801d4f:	c9                   	leave
+  801d50:	c3                   	ret
+
+00801d51 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801d51:	55                   	push   %ebp
+  801d52:	89 e5                	mov    %esp,%ebp
+  801d54:	57                   	push   %edi
+  801d55:	56                   	push   %esi
+  801d56:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d59:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801d5c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  801d5f:	39 c6                	cmp    %eax,%esi
+  801d61:	73 32                	jae    801d95 <memmove+0x44>
+  801d63:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  801d66:	39 d0                	cmp    %edx,%eax
+  801d68:	73 2b                	jae    801d95 <memmove+0x44>
+		s += n;
+		d += n;
+  801d6a:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801d6d:	89 d6                	mov    %edx,%esi
+  801d6f:	09 fe                	or     %edi,%esi
+  801d71:	09 ce                	or     %ecx,%esi
+  801d73:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  801d79:	75 0e                	jne    801d89 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801d7b:	83 ef 04             	sub    $0x4,%edi
+  801d7e:	8d 72 fc             	lea    -0x4(%edx),%esi
+  801d81:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  801d84:	fd                   	std
+  801d85:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801d87:	eb 09                	jmp    801d92 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801d89:	83 ef 01             	sub    $0x1,%edi
+  801d8c:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  801d8f:	fd                   	std
+  801d90:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801d92:	fc                   	cld
+  801d93:	eb 1a                	jmp    801daf <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801d95:	89 f2                	mov    %esi,%edx
+  801d97:	09 c2                	or     %eax,%edx
+  801d99:	09 ca                	or     %ecx,%edx
+  801d9b:	f6 c2 03             	test   $0x3,%dl
+  801d9e:	75 0a                	jne    801daa <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801da0:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  801da3:	89 c7                	mov    %eax,%edi
+  801da5:	fc                   	cld
+  801da6:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801da8:	eb 05                	jmp    801daf <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  801daa:	89 c7                	mov    %eax,%edi
+  801dac:	fc                   	cld
+  801dad:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  801daf:	5e                   	pop    %esi
+  801db0:	5f                   	pop    %edi
+  801db1:	5d                   	pop    %ebp
+  801db2:	c3                   	ret
+
+00801db3 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801db3:	55                   	push   %ebp
+  801db4:	89 e5                	mov    %esp,%ebp
+  801db6:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  801db9:	ff 75 10             	push   0x10(%ebp)
+  801dbc:	ff 75 0c             	push   0xc(%ebp)
+  801dbf:	ff 75 08             	push   0x8(%ebp)
+  801dc2:	e8 8a ff ff ff       	call   801d51 <memmove>
+}
+  801dc7:	c9                   	leave
+  801dc8:	c3                   	ret
+
+00801dc9 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801dc9:	55                   	push   %ebp
+  801dca:	89 e5                	mov    %esp,%ebp
+  801dcc:	56                   	push   %esi
+  801dcd:	53                   	push   %ebx
+  801dce:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dd1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  801dd4:	89 c6                	mov    %eax,%esi
+  801dd6:	03 75 10             	add    0x10(%ebp),%esi
+  801dd9:	eb 06                	jmp    801de1 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  801ddb:	83 c0 01             	add    $0x1,%eax
+  801dde:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  801de1:	39 f0                	cmp    %esi,%eax
+  801de3:	74 14                	je     801df9 <memcmp+0x30>
+		if (*s1 != *s2)
+  801de5:	0f b6 08             	movzbl (%eax),%ecx
+  801de8:	0f b6 1a             	movzbl (%edx),%ebx
+  801deb:	38 d9                	cmp    %bl,%cl
+  801ded:	74 ec                	je     801ddb <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  801def:	0f b6 c1             	movzbl %cl,%eax
+  801df2:	0f b6 db             	movzbl %bl,%ebx
+  801df5:	29 d8                	sub    %ebx,%eax
+  801df7:	eb 05                	jmp    801dfe <memcmp+0x35>
+	}
+
+	return 0;
+  801df9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801dfe:	5b                   	pop    %ebx
+  801dff:	5e                   	pop    %esi
+  801e00:	5d                   	pop    %ebp
+  801e01:	c3                   	ret
+
+00801e02 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801e02:	55                   	push   %ebp
+  801e03:	89 e5                	mov    %esp,%ebp
+  801e05:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e08:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  801e0b:	89 c2                	mov    %eax,%edx
+  801e0d:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  801e10:	eb 03                	jmp    801e15 <memfind+0x13>
+  801e12:	83 c0 01             	add    $0x1,%eax
+  801e15:	39 d0                	cmp    %edx,%eax
+  801e17:	73 04                	jae    801e1d <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801e19:	38 08                	cmp    %cl,(%eax)
+  801e1b:	75 f5                	jne    801e12 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  801e1d:	5d                   	pop    %ebp
+  801e1e:	c3                   	ret
+
+00801e1f <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  801e1f:	55                   	push   %ebp
+  801e20:	89 e5                	mov    %esp,%ebp
+  801e22:	57                   	push   %edi
+  801e23:	56                   	push   %esi
+  801e24:	53                   	push   %ebx
+  801e25:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e28:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801e2b:	eb 03                	jmp    801e30 <strtol+0x11>
+		s++;
+  801e2d:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  801e30:	0f b6 02             	movzbl (%edx),%eax
+  801e33:	3c 20                	cmp    $0x20,%al
+  801e35:	74 f6                	je     801e2d <strtol+0xe>
+  801e37:	3c 09                	cmp    $0x9,%al
+  801e39:	74 f2                	je     801e2d <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  801e3b:	3c 2b                	cmp    $0x2b,%al
+  801e3d:	74 2a                	je     801e69 <strtol+0x4a>
+	int neg = 0;
+  801e3f:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  801e44:	3c 2d                	cmp    $0x2d,%al
+  801e46:	74 2b                	je     801e73 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801e48:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  801e4e:	75 0f                	jne    801e5f <strtol+0x40>
+  801e50:	80 3a 30             	cmpb   $0x30,(%edx)
+  801e53:	74 28                	je     801e7d <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  801e55:	85 db                	test   %ebx,%ebx
+  801e57:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801e5c:	0f 44 d8             	cmove  %eax,%ebx
+  801e5f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e64:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  801e67:	eb 46                	jmp    801eaf <strtol+0x90>
+		s++;
+  801e69:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  801e6c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e71:	eb d5                	jmp    801e48 <strtol+0x29>
+		s++, neg = 1;
+  801e73:	83 c2 01             	add    $0x1,%edx
+  801e76:	bf 01 00 00 00       	mov    $0x1,%edi
+  801e7b:	eb cb                	jmp    801e48 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801e7d:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  801e81:	74 0e                	je     801e91 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  801e83:	85 db                	test   %ebx,%ebx
+  801e85:	75 d8                	jne    801e5f <strtol+0x40>
+		s++, base = 8;
+  801e87:	83 c2 01             	add    $0x1,%edx
+  801e8a:	bb 08 00 00 00       	mov    $0x8,%ebx
+  801e8f:	eb ce                	jmp    801e5f <strtol+0x40>
+		s += 2, base = 16;
+  801e91:	83 c2 02             	add    $0x2,%edx
+  801e94:	bb 10 00 00 00       	mov    $0x10,%ebx
+  801e99:	eb c4                	jmp    801e5f <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  801e9b:	0f be c0             	movsbl %al,%eax
+  801e9e:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  801ea1:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801ea4:	7d 3a                	jge    801ee0 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  801ea6:	83 c2 01             	add    $0x1,%edx
+  801ea9:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  801ead:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  801eaf:	0f b6 02             	movzbl (%edx),%eax
+  801eb2:	8d 70 d0             	lea    -0x30(%eax),%esi
+  801eb5:	89 f3                	mov    %esi,%ebx
+  801eb7:	80 fb 09             	cmp    $0x9,%bl
+  801eba:	76 df                	jbe    801e9b <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  801ebc:	8d 70 9f             	lea    -0x61(%eax),%esi
+  801ebf:	89 f3                	mov    %esi,%ebx
+  801ec1:	80 fb 19             	cmp    $0x19,%bl
+  801ec4:	77 08                	ja     801ece <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  801ec6:	0f be c0             	movsbl %al,%eax
+  801ec9:	83 e8 57             	sub    $0x57,%eax
+  801ecc:	eb d3                	jmp    801ea1 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  801ece:	8d 70 bf             	lea    -0x41(%eax),%esi
+  801ed1:	89 f3                	mov    %esi,%ebx
+  801ed3:	80 fb 19             	cmp    $0x19,%bl
+  801ed6:	77 08                	ja     801ee0 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  801ed8:	0f be c0             	movsbl %al,%eax
+  801edb:	83 e8 37             	sub    $0x37,%eax
+  801ede:	eb c1                	jmp    801ea1 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801ee0:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  801ee4:	74 05                	je     801eeb <strtol+0xcc>
+		*endptr = (char *) s;
+  801ee6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ee9:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  801eeb:	89 c8                	mov    %ecx,%eax
+  801eed:	f7 d8                	neg    %eax
+  801eef:	85 ff                	test   %edi,%edi
+  801ef1:	0f 45 c8             	cmovne %eax,%ecx
+}
+  801ef4:	89 c8                	mov    %ecx,%eax
+  801ef6:	5b                   	pop    %ebx
+  801ef7:	5e                   	pop    %esi
+  801ef8:	5f                   	pop    %edi
+  801ef9:	5d                   	pop    %ebp
+  801efa:	c3                   	ret
+
+00801efb <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  801efb:	55                   	push   %ebp
+  801efc:	89 e5                	mov    %esp,%ebp
+  801efe:	56                   	push   %esi
+  801eff:	53                   	push   %ebx
+  801f00:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f03:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f06:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  801f09:	85 c0                	test   %eax,%eax
+  801f0b:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801f10:	0f 44 c2             	cmove  %edx,%eax
+  801f13:	83 ec 0c             	sub    $0xc,%esp
+  801f16:	50                   	push   %eax
+  801f17:	e8 e7 e3 ff ff       	call   800303 <sys_ipc_recv>
+
+  if (from_env_store)
+  801f1c:	83 c4 10             	add    $0x10,%esp
+  801f1f:	85 f6                	test   %esi,%esi
+  801f21:	74 17                	je     801f3a <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  801f23:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f28:	85 c0                	test   %eax,%eax
+  801f2a:	75 0c                	jne    801f38 <ipc_recv+0x3d>
+  801f2c:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801f32:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  801f38:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  801f3a:	85 db                	test   %ebx,%ebx
+  801f3c:	74 2b                	je     801f69 <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  801f3e:	85 c0                	test   %eax,%eax
+  801f40:	74 0d                	je     801f4f <ipc_recv+0x54>
+  801f42:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  801f48:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f4b:	5b                   	pop    %ebx
+  801f4c:	5e                   	pop    %esi
+  801f4d:	5d                   	pop    %ebp
+  801f4e:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  801f4f:	a1 08 40 80 00       	mov    0x804008,%eax
+  801f54:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  801f5a:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  801f5c:	a1 08 40 80 00       	mov    0x804008,%eax
+  801f61:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  801f67:	eb df                	jmp    801f48 <ipc_recv+0x4d>
+  801f69:	85 c0                	test   %eax,%eax
+  801f6b:	75 db                	jne    801f48 <ipc_recv+0x4d>
+  801f6d:	eb ed                	jmp    801f5c <ipc_recv+0x61>
+
+00801f6f <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  801f6f:	55                   	push   %ebp
+  801f70:	89 e5                	mov    %esp,%ebp
+  801f72:	57                   	push   %edi
+  801f73:	56                   	push   %esi
+  801f74:	53                   	push   %ebx
+  801f75:	83 ec 0c             	sub    $0xc,%esp
+  801f78:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801f7b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801f7e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  801f81:	85 db                	test   %ebx,%ebx
+  801f83:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801f88:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  801f8b:	ff 75 14             	push   0x14(%ebp)
+  801f8e:	53                   	push   %ebx
+  801f8f:	56                   	push   %esi
+  801f90:	57                   	push   %edi
+  801f91:	e8 4a e3 ff ff       	call   8002e0 <sys_ipc_try_send>
+  801f96:	83 c4 10             	add    $0x10,%esp
+  801f99:	85 c0                	test   %eax,%eax
+  801f9b:	74 1e                	je     801fbb <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  801f9d:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801fa0:	75 07                	jne    801fa9 <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  801fa2:	e8 8d e1 ff ff       	call   800134 <sys_yield>
+  801fa7:	eb e2                	jmp    801f8b <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  801fa9:	50                   	push   %eax
+  801faa:	68 63 29 80 00       	push   $0x802963
+  801faf:	6a 3c                	push   $0x3c
+  801fb1:	68 70 29 80 00       	push   $0x802970
+  801fb6:	e8 7c f5 ff ff       	call   801537 <_panic>
+  }
+
+#endif
+}
+  801fbb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fbe:	5b                   	pop    %ebx
+  801fbf:	5e                   	pop    %esi
+  801fc0:	5f                   	pop    %edi
+  801fc1:	5d                   	pop    %ebp
+  801fc2:	c3                   	ret
+
+00801fc3 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  801fc3:	55                   	push   %ebp
+  801fc4:	89 e5                	mov    %esp,%ebp
+  801fc6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  801fc9:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  801fce:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  801fd1:	c1 e0 04             	shl    $0x4,%eax
+  801fd4:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801fd9:	8b 40 50             	mov    0x50(%eax),%eax
+  801fdc:	39 c8                	cmp    %ecx,%eax
+  801fde:	74 12                	je     801ff2 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  801fe0:	83 c2 01             	add    $0x1,%edx
+  801fe3:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  801fe9:	75 e3                	jne    801fce <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  801feb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ff0:	eb 0e                	jmp    802000 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  801ff2:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  801ff5:	c1 e0 04             	shl    $0x4,%eax
+  801ff8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801ffd:	8b 40 48             	mov    0x48(%eax),%eax
+  802000:	5d                   	pop    %ebp
+  802001:	c3                   	ret
+
+00802002 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802002:	55                   	push   %ebp
+  802003:	89 e5                	mov    %esp,%ebp
+  802005:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802008:	89 c2                	mov    %eax,%edx
+  80200a:	c1 ea 16             	shr    $0x16,%edx
+  80200d:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802014:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802019:	f6 c1 01             	test   $0x1,%cl
+  80201c:	74 1c                	je     80203a <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  80201e:	c1 e8 0c             	shr    $0xc,%eax
+  802021:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802028:	a8 01                	test   $0x1,%al
+  80202a:	74 0e                	je     80203a <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80202c:	c1 e8 0c             	shr    $0xc,%eax
+  80202f:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802036:	ef 
+  802037:	0f b7 d2             	movzwl %dx,%edx
+}
+  80203a:	89 d0                	mov    %edx,%eax
+  80203c:	5d                   	pop    %ebp
+  80203d:	c3                   	ret
+  80203e:	66 90                	xchg   %ax,%ax
+
+00802040 <__udivmoddi4>:
+  802040:	55                   	push   %ebp
+  802041:	57                   	push   %edi
+  802042:	56                   	push   %esi
+  802043:	53                   	push   %ebx
+  802044:	83 ec 24             	sub    $0x24,%esp
+  802047:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80204b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80204f:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  802053:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802057:	8b 54 24 44          	mov    0x44(%esp),%edx
+  80205b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80205f:	8b 44 24 40          	mov    0x40(%esp),%eax
+  802063:	89 d3                	mov    %edx,%ebx
+  802065:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802069:	09 c3                	or     %eax,%ebx
+  80206b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80206f:	0f 84 9c 00 00 00    	je     802111 <__udivmoddi4+0xd1>
+  802075:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80207c:	00 
+  80207d:	31 c0                	xor    %eax,%eax
+  80207f:	31 d2                	xor    %edx,%edx
+  802081:	89 fb                	mov    %edi,%ebx
+  802083:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80208a:	00 
+  80208b:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802090:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802094:	01 c0                	add    %eax,%eax
+  802096:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80209d:	00 
+  80209e:	89 c6                	mov    %eax,%esi
+  8020a0:	89 d7                	mov    %edx,%edi
+  8020a2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8020a6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8020aa:	0f ad d0             	shrd   %cl,%edx,%eax
+  8020ad:	d3 ea                	shr    %cl,%edx
+  8020af:	f6 c1 20             	test   $0x20,%cl
+  8020b2:	0f 45 c2             	cmovne %edx,%eax
+  8020b5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8020b9:	83 e0 01             	and    $0x1,%eax
+  8020bc:	09 fa                	or     %edi,%edx
+  8020be:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8020c2:	89 04 24             	mov    %eax,(%esp)
+  8020c5:	8b 04 24             	mov    (%esp),%eax
+  8020c8:	89 d5                	mov    %edx,%ebp
+  8020ca:	09 f0                	or     %esi,%eax
+  8020cc:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8020d0:	39 f0                	cmp    %esi,%eax
+  8020d2:	19 fd                	sbb    %edi,%ebp
+  8020d4:	72 1d                	jb     8020f3 <__udivmoddi4+0xb3>
+  8020d6:	29 f0                	sub    %esi,%eax
+  8020d8:	19 fa                	sbb    %edi,%edx
+  8020da:	89 cf                	mov    %ecx,%edi
+  8020dc:	c1 ef 05             	shr    $0x5,%edi
+  8020df:	83 e7 01             	and    $0x1,%edi
+  8020e2:	89 fe                	mov    %edi,%esi
+  8020e4:	d3 e7                	shl    %cl,%edi
+  8020e6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8020ea:	83 f6 01             	xor    $0x1,%esi
+  8020ed:	d3 e6                	shl    %cl,%esi
+  8020ef:	09 74 24 18          	or     %esi,0x18(%esp)
+  8020f3:	83 e9 01             	sub    $0x1,%ecx
+  8020f6:	73 98                	jae    802090 <__udivmoddi4+0x50>
+  8020f8:	85 db                	test   %ebx,%ebx
+  8020fa:	74 05                	je     802101 <__udivmoddi4+0xc1>
+  8020fc:	89 03                	mov    %eax,(%ebx)
+  8020fe:	89 53 04             	mov    %edx,0x4(%ebx)
+  802101:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802105:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802109:	83 c4 24             	add    $0x24,%esp
+  80210c:	5b                   	pop    %ebx
+  80210d:	5e                   	pop    %esi
+  80210e:	5f                   	pop    %edi
+  80210f:	5d                   	pop    %ebp
+  802110:	c3                   	ret
+  802111:	85 ff                	test   %edi,%edi
+  802113:	74 0d                	je     802122 <__udivmoddi4+0xe2>
+  802115:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  80211b:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  802122:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802126:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80212a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80212e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802132:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802136:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80213a:	83 c4 24             	add    $0x24,%esp
+  80213d:	5b                   	pop    %ebx
+  80213e:	5e                   	pop    %esi
+  80213f:	5f                   	pop    %edi
+  802140:	5d                   	pop    %ebp
+  802141:	c3                   	ret
+  802142:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802149:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00802150 <__udivdi3>:
+  802150:	57                   	push   %edi
+  802151:	56                   	push   %esi
+  802152:	53                   	push   %ebx
+  802153:	83 ec 20             	sub    $0x20,%esp
+  802156:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80215a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80215e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802162:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802166:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80216a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80216e:	89 d1                	mov    %edx,%ecx
+  802170:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802174:	09 c1                	or     %eax,%ecx
+  802176:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80217a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80217e:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802182:	0f 84 88 00 00 00    	je     802210 <__udivdi3+0xc0>
+  802188:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80218f:	00 
+  802190:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802195:	31 c0                	xor    %eax,%eax
+  802197:	31 d2                	xor    %edx,%edx
+  802199:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8021a0:	00 
+  8021a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8021a8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8021ac:	01 c0                	add    %eax,%eax
+  8021ae:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8021b5:	00 
+  8021b6:	89 c6                	mov    %eax,%esi
+  8021b8:	89 d7                	mov    %edx,%edi
+  8021ba:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8021be:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8021c2:	0f ad d0             	shrd   %cl,%edx,%eax
+  8021c5:	d3 ea                	shr    %cl,%edx
+  8021c7:	f6 c1 20             	test   $0x20,%cl
+  8021ca:	0f 45 c2             	cmovne %edx,%eax
+  8021cd:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8021d1:	83 e0 01             	and    $0x1,%eax
+  8021d4:	09 fa                	or     %edi,%edx
+  8021d6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8021da:	89 04 24             	mov    %eax,(%esp)
+  8021dd:	8b 04 24             	mov    (%esp),%eax
+  8021e0:	89 d3                	mov    %edx,%ebx
+  8021e2:	09 f0                	or     %esi,%eax
+  8021e4:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8021e8:	39 f0                	cmp    %esi,%eax
+  8021ea:	19 fb                	sbb    %edi,%ebx
+  8021ec:	72 1d                	jb     80220b <__udivdi3+0xbb>
+  8021ee:	29 f0                	sub    %esi,%eax
+  8021f0:	19 fa                	sbb    %edi,%edx
+  8021f2:	89 cf                	mov    %ecx,%edi
+  8021f4:	c1 ef 05             	shr    $0x5,%edi
+  8021f7:	83 e7 01             	and    $0x1,%edi
+  8021fa:	89 fe                	mov    %edi,%esi
+  8021fc:	d3 e7                	shl    %cl,%edi
+  8021fe:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802202:	83 f6 01             	xor    $0x1,%esi
+  802205:	d3 e6                	shl    %cl,%esi
+  802207:	09 74 24 18          	or     %esi,0x18(%esp)
+  80220b:	83 e9 01             	sub    $0x1,%ecx
+  80220e:	73 98                	jae    8021a8 <__udivdi3+0x58>
+  802210:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802214:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802218:	83 c4 20             	add    $0x20,%esp
+  80221b:	5b                   	pop    %ebx
+  80221c:	5e                   	pop    %esi
+  80221d:	5f                   	pop    %edi
+  80221e:	c3                   	ret
+  80221f:	90                   	nop
+
+00802220 <__umoddi3>:
+  802220:	57                   	push   %edi
+  802221:	56                   	push   %esi
+  802222:	53                   	push   %ebx
+  802223:	83 ec 18             	sub    $0x18,%esp
+  802226:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80222a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80222e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802232:	8b 54 24 34          	mov    0x34(%esp),%edx
+  802236:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80223a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80223e:	89 d1                	mov    %edx,%ecx
+  802240:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802244:	09 c1                	or     %eax,%ecx
+  802246:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80224a:	74 5b                	je     8022a7 <__umoddi3+0x87>
+  80224c:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802251:	31 c0                	xor    %eax,%eax
+  802253:	31 d2                	xor    %edx,%edx
+  802255:	8d 76 00             	lea    0x0(%esi),%esi
+  802258:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80225c:	01 c0                	add    %eax,%eax
+  80225e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802265:	00 
+  802266:	89 c6                	mov    %eax,%esi
+  802268:	89 d7                	mov    %edx,%edi
+  80226a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80226e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802272:	0f ad d0             	shrd   %cl,%edx,%eax
+  802275:	d3 ea                	shr    %cl,%edx
+  802277:	f6 c1 20             	test   $0x20,%cl
+  80227a:	0f 45 c2             	cmovne %edx,%eax
+  80227d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802281:	83 e0 01             	and    $0x1,%eax
+  802284:	09 fa                	or     %edi,%edx
+  802286:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80228a:	89 04 24             	mov    %eax,(%esp)
+  80228d:	8b 04 24             	mov    (%esp),%eax
+  802290:	89 d3                	mov    %edx,%ebx
+  802292:	09 f0                	or     %esi,%eax
+  802294:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802298:	39 f0                	cmp    %esi,%eax
+  80229a:	19 fb                	sbb    %edi,%ebx
+  80229c:	72 04                	jb     8022a2 <__umoddi3+0x82>
+  80229e:	29 f0                	sub    %esi,%eax
+  8022a0:	19 fa                	sbb    %edi,%edx
+  8022a2:	83 e9 01             	sub    $0x1,%ecx
+  8022a5:	73 b1                	jae    802258 <__umoddi3+0x38>
+  8022a7:	83 c4 18             	add    $0x18,%esp
+  8022aa:	5b                   	pop    %ebx
+  8022ab:	5e                   	pop    %esi
+  8022ac:	5f                   	pop    %edi
+  8022ad:	c3                   	ret
+  8022ae:	66 90                	xchg   %ax,%ax
+
+008022b0 <__divdi3>:
+  8022b0:	55                   	push   %ebp
+  8022b1:	57                   	push   %edi
+  8022b2:	56                   	push   %esi
+  8022b3:	53                   	push   %ebx
+  8022b4:	83 ec 24             	sub    $0x24,%esp
+  8022b7:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  8022bb:	8b 74 24 44          	mov    0x44(%esp),%esi
+  8022bf:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8022c3:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8022c7:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  8022cb:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8022cf:	85 d2                	test   %edx,%edx
+  8022d1:	0f 88 e0 00 00 00    	js     8023b7 <__divdi3+0x107>
+  8022d7:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  8022db:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  8022df:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8022e3:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8022e7:	85 f6                	test   %esi,%esi
+  8022e9:	78 16                	js     802301 <__divdi3+0x51>
+  8022eb:	89 f1                	mov    %esi,%ecx
+  8022ed:	31 c0                	xor    %eax,%eax
+  8022ef:	31 d2                	xor    %edx,%edx
+  8022f1:	09 d9                	or     %ebx,%ecx
+  8022f3:	0f 85 f3 00 00 00    	jne    8023ec <__divdi3+0x13c>
+  8022f9:	83 c4 24             	add    $0x24,%esp
+  8022fc:	5b                   	pop    %ebx
+  8022fd:	5e                   	pop    %esi
+  8022fe:	5f                   	pop    %edi
+  8022ff:	5d                   	pop    %ebp
+  802300:	c3                   	ret
+  802301:	bf 01 00 00 00       	mov    $0x1,%edi
+  802306:	f7 5c 24 08          	negl   0x8(%esp)
+  80230a:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  80230f:	f7 5c 24 0c          	negl   0xc(%esp)
+  802313:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80231a:	00 
+  80231b:	31 c0                	xor    %eax,%eax
+  80231d:	31 d2                	xor    %edx,%edx
+  80231f:	89 fb                	mov    %edi,%ebx
+  802321:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802328:	00 
+  802329:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80232e:	66 90                	xchg   %ax,%ax
+  802330:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802334:	01 c0                	add    %eax,%eax
+  802336:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80233d:	00 
+  80233e:	89 c6                	mov    %eax,%esi
+  802340:	89 d7                	mov    %edx,%edi
+  802342:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802346:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80234a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80234d:	d3 ea                	shr    %cl,%edx
+  80234f:	f6 c1 20             	test   $0x20,%cl
+  802352:	0f 45 c2             	cmovne %edx,%eax
+  802355:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802359:	83 e0 01             	and    $0x1,%eax
+  80235c:	09 fa                	or     %edi,%edx
+  80235e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802362:	89 04 24             	mov    %eax,(%esp)
+  802365:	8b 04 24             	mov    (%esp),%eax
+  802368:	89 d5                	mov    %edx,%ebp
+  80236a:	09 f0                	or     %esi,%eax
+  80236c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802370:	39 f0                	cmp    %esi,%eax
+  802372:	19 fd                	sbb    %edi,%ebp
+  802374:	72 1d                	jb     802393 <__divdi3+0xe3>
+  802376:	29 f0                	sub    %esi,%eax
+  802378:	19 fa                	sbb    %edi,%edx
+  80237a:	89 cf                	mov    %ecx,%edi
+  80237c:	c1 ef 05             	shr    $0x5,%edi
+  80237f:	83 e7 01             	and    $0x1,%edi
+  802382:	89 fe                	mov    %edi,%esi
+  802384:	d3 e7                	shl    %cl,%edi
+  802386:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80238a:	83 f6 01             	xor    $0x1,%esi
+  80238d:	d3 e6                	shl    %cl,%esi
+  80238f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802393:	83 e9 01             	sub    $0x1,%ecx
+  802396:	73 98                	jae    802330 <__divdi3+0x80>
+  802398:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80239c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8023a0:	85 db                	test   %ebx,%ebx
+  8023a2:	0f 84 51 ff ff ff    	je     8022f9 <__divdi3+0x49>
+  8023a8:	f7 d8                	neg    %eax
+  8023aa:	83 d2 00             	adc    $0x0,%edx
+  8023ad:	83 c4 24             	add    $0x24,%esp
+  8023b0:	5b                   	pop    %ebx
+  8023b1:	f7 da                	neg    %edx
+  8023b3:	5e                   	pop    %esi
+  8023b4:	5f                   	pop    %edi
+  8023b5:	5d                   	pop    %ebp
+  8023b6:	c3                   	ret
+  8023b7:	f7 d8                	neg    %eax
+  8023b9:	83 d2 00             	adc    $0x0,%edx
+  8023bc:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8023c0:	f7 da                	neg    %edx
+  8023c2:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8023c6:	85 f6                	test   %esi,%esi
+  8023c8:	78 1b                	js     8023e5 <__divdi3+0x135>
+  8023ca:	89 f1                	mov    %esi,%ecx
+  8023cc:	31 c0                	xor    %eax,%eax
+  8023ce:	31 d2                	xor    %edx,%edx
+  8023d0:	bf 01 00 00 00       	mov    $0x1,%edi
+  8023d5:	09 d9                	or     %ebx,%ecx
+  8023d7:	0f 85 36 ff ff ff    	jne    802313 <__divdi3+0x63>
+  8023dd:	83 c4 24             	add    $0x24,%esp
+  8023e0:	5b                   	pop    %ebx
+  8023e1:	5e                   	pop    %esi
+  8023e2:	5f                   	pop    %edi
+  8023e3:	5d                   	pop    %ebp
+  8023e4:	c3                   	ret
+  8023e5:	31 ff                	xor    %edi,%edi
+  8023e7:	e9 1a ff ff ff       	jmp    802306 <__divdi3+0x56>
+  8023ec:	31 ff                	xor    %edi,%edi
+  8023ee:	e9 20 ff ff ff       	jmp    802313 <__divdi3+0x63>
+  8023f3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8023fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00802400 <__moddi3>:
+  802400:	55                   	push   %ebp
+  802401:	57                   	push   %edi
+  802402:	56                   	push   %esi
+  802403:	53                   	push   %ebx
+  802404:	83 ec 1c             	sub    $0x1c,%esp
+  802407:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  80240b:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  80240f:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  802413:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  802417:	89 c8                	mov    %ecx,%eax
+  802419:	89 f2                	mov    %esi,%edx
+  80241b:	89 f3                	mov    %esi,%ebx
+  80241d:	85 ed                	test   %ebp,%ebp
+  80241f:	0f 88 9d 00 00 00    	js     8024c2 <__moddi3+0xc2>
+  802425:	09 cb                	or     %ecx,%ebx
+  802427:	0f 84 8d 00 00 00    	je     8024ba <__moddi3+0xba>
+  80242d:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802431:	31 db                	xor    %ebx,%ebx
+  802433:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802437:	89 ca                	mov    %ecx,%edx
+  802439:	89 f0                	mov    %esi,%eax
+  80243b:	89 dd                	mov    %ebx,%ebp
+  80243d:	f7 da                	neg    %edx
+  80243f:	83 d0 00             	adc    $0x0,%eax
+  802442:	f7 d8                	neg    %eax
+  802444:	0f 49 f0             	cmovns %eax,%esi
+  802447:	0f 49 ca             	cmovns %edx,%ecx
+  80244a:	31 c0                	xor    %eax,%eax
+  80244c:	31 d2                	xor    %edx,%edx
+  80244e:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802452:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802456:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80245b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80245f:	90                   	nop
+  802460:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802464:	01 c0                	add    %eax,%eax
+  802466:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80246d:	00 
+  80246e:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  802472:	89 c6                	mov    %eax,%esi
+  802474:	89 d7                	mov    %edx,%edi
+  802476:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80247a:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80247e:	0f ad d0             	shrd   %cl,%edx,%eax
+  802481:	d3 ea                	shr    %cl,%edx
+  802483:	f6 c1 20             	test   $0x20,%cl
+  802486:	0f 45 c2             	cmovne %edx,%eax
+  802489:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80248d:	83 e0 01             	and    $0x1,%eax
+  802490:	09 fa                	or     %edi,%edx
+  802492:	89 04 24             	mov    %eax,(%esp)
+  802495:	8b 04 24             	mov    (%esp),%eax
+  802498:	89 d7                	mov    %edx,%edi
+  80249a:	09 f0                	or     %esi,%eax
+  80249c:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  8024a0:	39 d8                	cmp    %ebx,%eax
+  8024a2:	19 f7                	sbb    %esi,%edi
+  8024a4:	72 04                	jb     8024aa <__moddi3+0xaa>
+  8024a6:	29 d8                	sub    %ebx,%eax
+  8024a8:	19 f2                	sbb    %esi,%edx
+  8024aa:	83 e9 01             	sub    $0x1,%ecx
+  8024ad:	73 b1                	jae    802460 <__moddi3+0x60>
+  8024af:	85 ed                	test   %ebp,%ebp
+  8024b1:	74 07                	je     8024ba <__moddi3+0xba>
+  8024b3:	f7 d8                	neg    %eax
+  8024b5:	83 d2 00             	adc    $0x0,%edx
+  8024b8:	f7 da                	neg    %edx
+  8024ba:	83 c4 1c             	add    $0x1c,%esp
+  8024bd:	5b                   	pop    %ebx
+  8024be:	5e                   	pop    %esi
+  8024bf:	5f                   	pop    %edi
+  8024c0:	5d                   	pop    %ebp
+  8024c1:	c3                   	ret
+  8024c2:	09 cb                	or     %ecx,%ebx
+  8024c4:	74 f4                	je     8024ba <__moddi3+0xba>
+  8024c6:	f7 df                	neg    %edi
+  8024c8:	bb 01 00 00 00       	mov    $0x1,%ebx
+  8024cd:	83 d5 00             	adc    $0x0,%ebp
+  8024d0:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  8024d4:	f7 dd                	neg    %ebp
+  8024d6:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  8024da:	e9 58 ff ff ff       	jmp    802437 <__moddi3+0x37>
@@ -0,0 +1,5911 @@
+
+obj/user/testfdsharing.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 99 01 00 00       	call   8001ca <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+char buf[512], buf2[512];
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 14             	sub    $0x14,%esp
+	int fd, r, n, n2;
+
+	if ((fd = open("motd", O_RDONLY)) < 0)
+  80003c:	6a 00                	push   $0x0
+  80003e:	68 80 2a 80 00       	push   $0x802a80
+  800043:	e8 95 19 00 00       	call   8019dd <open>
+  800048:	89 c3                	mov    %eax,%ebx
+  80004a:	83 c4 10             	add    $0x10,%esp
+  80004d:	85 c0                	test   %eax,%eax
+  80004f:	0f 88 ff 00 00 00    	js     800154 <umain+0x121>
+		panic("open motd: %e", fd);
+	seek(fd, 0);
+  800055:	83 ec 08             	sub    $0x8,%esp
+  800058:	6a 00                	push   $0x0
+  80005a:	50                   	push   %eax
+  80005b:	e8 6a 16 00 00       	call   8016ca <seek>
+	if ((n = readn(fd, buf, sizeof buf)) <= 0)
+  800060:	83 c4 0c             	add    $0xc,%esp
+  800063:	68 00 02 00 00       	push   $0x200
+  800068:	68 20 52 80 00       	push   $0x805220
+  80006d:	53                   	push   %ebx
+  80006e:	e8 8e 15 00 00       	call   801601 <readn>
+  800073:	89 c6                	mov    %eax,%esi
+  800075:	83 c4 10             	add    $0x10,%esp
+  800078:	85 c0                	test   %eax,%eax
+  80007a:	0f 8e e6 00 00 00    	jle    800166 <umain+0x133>
+		panic("readn: %e", n);
+
+	if ((r = fork()) < 0)
+  800080:	e8 f6 0f 00 00       	call   80107b <fork>
+  800085:	89 c7                	mov    %eax,%edi
+  800087:	85 c0                	test   %eax,%eax
+  800089:	0f 88 e9 00 00 00    	js     800178 <umain+0x145>
+		panic("fork: %e", r);
+	if (r == 0) {
+  80008f:	75 7b                	jne    80010c <umain+0xd9>
+		seek(fd, 0);
+  800091:	83 ec 08             	sub    $0x8,%esp
+  800094:	6a 00                	push   $0x0
+  800096:	53                   	push   %ebx
+  800097:	e8 2e 16 00 00       	call   8016ca <seek>
+		cprintf("going to read in child (might page fault if your sharing is buggy)\n");
+  80009c:	c7 04 24 f0 2a 80 00 	movl   $0x802af0,(%esp)
+  8000a3:	e8 60 02 00 00       	call   800308 <cprintf>
+		if ((n2 = readn(fd, buf2, sizeof buf2)) != n)
+  8000a8:	83 c4 0c             	add    $0xc,%esp
+  8000ab:	68 00 02 00 00       	push   $0x200
+  8000b0:	68 20 50 80 00       	push   $0x805020
+  8000b5:	53                   	push   %ebx
+  8000b6:	e8 46 15 00 00       	call   801601 <readn>
+  8000bb:	83 c4 10             	add    $0x10,%esp
+  8000be:	39 c6                	cmp    %eax,%esi
+  8000c0:	0f 85 c4 00 00 00    	jne    80018a <umain+0x157>
+			panic("read in parent got %d, read in child got %d", n, n2);
+		if (memcmp(buf, buf2, n) != 0)
+  8000c6:	83 ec 04             	sub    $0x4,%esp
+  8000c9:	56                   	push   %esi
+  8000ca:	68 20 50 80 00       	push   $0x805020
+  8000cf:	68 20 52 80 00       	push   $0x805220
+  8000d4:	e8 e6 09 00 00       	call   800abf <memcmp>
+  8000d9:	83 c4 10             	add    $0x10,%esp
+  8000dc:	85 c0                	test   %eax,%eax
+  8000de:	0f 85 bc 00 00 00    	jne    8001a0 <umain+0x16d>
+			panic("read in parent got different bytes from read in child");
+		cprintf("read in child succeeded\n");
+  8000e4:	83 ec 0c             	sub    $0xc,%esp
+  8000e7:	68 bb 2a 80 00       	push   $0x802abb
+  8000ec:	e8 17 02 00 00       	call   800308 <cprintf>
+		seek(fd, 0);
+  8000f1:	83 c4 08             	add    $0x8,%esp
+  8000f4:	6a 00                	push   $0x0
+  8000f6:	53                   	push   %ebx
+  8000f7:	e8 ce 15 00 00       	call   8016ca <seek>
+		close(fd);
+  8000fc:	89 1c 24             	mov    %ebx,(%esp)
+  8000ff:	e8 3a 13 00 00       	call   80143e <close>
+		exit();
+  800104:	e8 0a 01 00 00       	call   800213 <exit>
+  800109:	83 c4 10             	add    $0x10,%esp
+	}
+	wait(r);
+  80010c:	83 ec 0c             	sub    $0xc,%esp
+  80010f:	57                   	push   %edi
+  800110:	e8 1f 21 00 00       	call   802234 <wait>
+	if ((n2 = readn(fd, buf2, sizeof buf2)) != n)
+  800115:	83 c4 0c             	add    $0xc,%esp
+  800118:	68 00 02 00 00       	push   $0x200
+  80011d:	68 20 50 80 00       	push   $0x805020
+  800122:	53                   	push   %ebx
+  800123:	e8 d9 14 00 00       	call   801601 <readn>
+  800128:	83 c4 10             	add    $0x10,%esp
+  80012b:	39 c6                	cmp    %eax,%esi
+  80012d:	0f 85 81 00 00 00    	jne    8001b4 <umain+0x181>
+		panic("read in parent got %d, then got %d", n, n2);
+	cprintf("read in parent succeeded\n");
+  800133:	83 ec 0c             	sub    $0xc,%esp
+  800136:	68 d4 2a 80 00       	push   $0x802ad4
+  80013b:	e8 c8 01 00 00       	call   800308 <cprintf>
+	close(fd);
+  800140:	89 1c 24             	mov    %ebx,(%esp)
+  800143:	e8 f6 12 00 00       	call   80143e <close>
+#include <inc/types.h>
+
+static inline void
+breakpoint(void)
+{
+	asm volatile("int3");
+  800148:	cc                   	int3
+
+	breakpoint();
+}
+  800149:	83 c4 10             	add    $0x10,%esp
+  80014c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80014f:	5b                   	pop    %ebx
+  800150:	5e                   	pop    %esi
+  800151:	5f                   	pop    %edi
+  800152:	5d                   	pop    %ebp
+  800153:	c3                   	ret
+		panic("open motd: %e", fd);
+  800154:	50                   	push   %eax
+  800155:	68 85 2a 80 00       	push   $0x802a85
+  80015a:	6a 0c                	push   $0xc
+  80015c:	68 93 2a 80 00       	push   $0x802a93
+  800161:	e8 c7 00 00 00       	call   80022d <_panic>
+		panic("readn: %e", n);
+  800166:	50                   	push   %eax
+  800167:	68 a8 2a 80 00       	push   $0x802aa8
+  80016c:	6a 0f                	push   $0xf
+  80016e:	68 93 2a 80 00       	push   $0x802a93
+  800173:	e8 b5 00 00 00       	call   80022d <_panic>
+		panic("fork: %e", r);
+  800178:	50                   	push   %eax
+  800179:	68 b2 2a 80 00       	push   $0x802ab2
+  80017e:	6a 12                	push   $0x12
+  800180:	68 93 2a 80 00       	push   $0x802a93
+  800185:	e8 a3 00 00 00       	call   80022d <_panic>
+			panic("read in parent got %d, read in child got %d", n, n2);
+  80018a:	83 ec 0c             	sub    $0xc,%esp
+  80018d:	50                   	push   %eax
+  80018e:	56                   	push   %esi
+  80018f:	68 34 2b 80 00       	push   $0x802b34
+  800194:	6a 17                	push   $0x17
+  800196:	68 93 2a 80 00       	push   $0x802a93
+  80019b:	e8 8d 00 00 00       	call   80022d <_panic>
+			panic("read in parent got different bytes from read in child");
+  8001a0:	83 ec 04             	sub    $0x4,%esp
+  8001a3:	68 60 2b 80 00       	push   $0x802b60
+  8001a8:	6a 19                	push   $0x19
+  8001aa:	68 93 2a 80 00       	push   $0x802a93
+  8001af:	e8 79 00 00 00       	call   80022d <_panic>
+		panic("read in parent got %d, then got %d", n, n2);
+  8001b4:	83 ec 0c             	sub    $0xc,%esp
+  8001b7:	50                   	push   %eax
+  8001b8:	56                   	push   %esi
+  8001b9:	68 98 2b 80 00       	push   $0x802b98
+  8001be:	6a 21                	push   $0x21
+  8001c0:	68 93 2a 80 00       	push   $0x802a93
+  8001c5:	e8 63 00 00 00       	call   80022d <_panic>
+
+008001ca <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  8001ca:	55                   	push   %ebp
+  8001cb:	89 e5                	mov    %esp,%ebp
+  8001cd:	56                   	push   %esi
+  8001ce:	53                   	push   %ebx
+  8001cf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001d2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  8001d5:	e8 95 0a 00 00       	call   800c6f <sys_getenvid>
+  8001da:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001df:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8001e2:	c1 e0 04             	shl    $0x4,%eax
+  8001e5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001ea:	a3 20 54 80 00       	mov    %eax,0x805420
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8001ef:	85 db                	test   %ebx,%ebx
+  8001f1:	7e 07                	jle    8001fa <libmain+0x30>
+    binaryname = argv[0];
+  8001f3:	8b 06                	mov    (%esi),%eax
+  8001f5:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  8001fa:	83 ec 08             	sub    $0x8,%esp
+  8001fd:	56                   	push   %esi
+  8001fe:	53                   	push   %ebx
+  8001ff:	e8 2f fe ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  800204:	e8 0a 00 00 00       	call   800213 <exit>
+}
+  800209:	83 c4 10             	add    $0x10,%esp
+  80020c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80020f:	5b                   	pop    %ebx
+  800210:	5e                   	pop    %esi
+  800211:	5d                   	pop    %ebp
+  800212:	c3                   	ret
+
+00800213 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800213:	55                   	push   %ebp
+  800214:	89 e5                	mov    %esp,%ebp
+  800216:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800219:	e8 4d 12 00 00       	call   80146b <close_all>
+	sys_env_destroy(0);
+  80021e:	83 ec 0c             	sub    $0xc,%esp
+  800221:	6a 00                	push   $0x0
+  800223:	e8 06 0a 00 00       	call   800c2e <sys_env_destroy>
+}
+  800228:	83 c4 10             	add    $0x10,%esp
+  80022b:	c9                   	leave
+  80022c:	c3                   	ret
+
+0080022d <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80022d:	55                   	push   %ebp
+  80022e:	89 e5                	mov    %esp,%ebp
+  800230:	56                   	push   %esi
+  800231:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800232:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800235:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  80023b:	e8 2f 0a 00 00       	call   800c6f <sys_getenvid>
+  800240:	83 ec 0c             	sub    $0xc,%esp
+  800243:	ff 75 0c             	push   0xc(%ebp)
+  800246:	ff 75 08             	push   0x8(%ebp)
+  800249:	56                   	push   %esi
+  80024a:	50                   	push   %eax
+  80024b:	68 c8 2b 80 00       	push   $0x802bc8
+  800250:	e8 b3 00 00 00       	call   800308 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800255:	83 c4 18             	add    $0x18,%esp
+  800258:	53                   	push   %ebx
+  800259:	ff 75 10             	push   0x10(%ebp)
+  80025c:	e8 56 00 00 00       	call   8002b7 <vcprintf>
+	cprintf("\n");
+  800261:	c7 04 24 d2 2a 80 00 	movl   $0x802ad2,(%esp)
+  800268:	e8 9b 00 00 00       	call   800308 <cprintf>
+  80026d:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800270:	cc                   	int3
+	while (1)
+  800271:	eb fd                	jmp    800270 <_panic+0x43>
+
+00800273 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800273:	55                   	push   %ebp
+  800274:	89 e5                	mov    %esp,%ebp
+  800276:	53                   	push   %ebx
+  800277:	83 ec 04             	sub    $0x4,%esp
+  80027a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80027d:	8b 13                	mov    (%ebx),%edx
+  80027f:	8d 42 01             	lea    0x1(%edx),%eax
+  800282:	89 03                	mov    %eax,(%ebx)
+  800284:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800287:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80028b:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800290:	74 09                	je     80029b <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800292:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800296:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800299:	c9                   	leave
+  80029a:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80029b:	83 ec 08             	sub    $0x8,%esp
+  80029e:	68 ff 00 00 00       	push   $0xff
+  8002a3:	8d 43 08             	lea    0x8(%ebx),%eax
+  8002a6:	50                   	push   %eax
+  8002a7:	e8 45 09 00 00       	call   800bf1 <sys_cputs>
+		b->idx = 0;
+  8002ac:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8002b2:	83 c4 10             	add    $0x10,%esp
+  8002b5:	eb db                	jmp    800292 <putch+0x1f>
+
+008002b7 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8002b7:	55                   	push   %ebp
+  8002b8:	89 e5                	mov    %esp,%ebp
+  8002ba:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8002c0:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8002c7:	00 00 00 
+	b.cnt = 0;
+  8002ca:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8002d1:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8002d4:	ff 75 0c             	push   0xc(%ebp)
+  8002d7:	ff 75 08             	push   0x8(%ebp)
+  8002da:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8002e0:	50                   	push   %eax
+  8002e1:	68 73 02 80 00       	push   $0x800273
+  8002e6:	e8 14 01 00 00       	call   8003ff <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8002eb:	83 c4 08             	add    $0x8,%esp
+  8002ee:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8002f4:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8002fa:	50                   	push   %eax
+  8002fb:	e8 f1 08 00 00       	call   800bf1 <sys_cputs>
+
+	return b.cnt;
+}
+  800300:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800306:	c9                   	leave
+  800307:	c3                   	ret
+
+00800308 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800308:	55                   	push   %ebp
+  800309:	89 e5                	mov    %esp,%ebp
+  80030b:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80030e:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800311:	50                   	push   %eax
+  800312:	ff 75 08             	push   0x8(%ebp)
+  800315:	e8 9d ff ff ff       	call   8002b7 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80031a:	c9                   	leave
+  80031b:	c3                   	ret
+
+0080031c <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80031c:	55                   	push   %ebp
+  80031d:	89 e5                	mov    %esp,%ebp
+  80031f:	57                   	push   %edi
+  800320:	56                   	push   %esi
+  800321:	53                   	push   %ebx
+  800322:	83 ec 1c             	sub    $0x1c,%esp
+  800325:	89 c7                	mov    %eax,%edi
+  800327:	89 d6                	mov    %edx,%esi
+  800329:	8b 45 08             	mov    0x8(%ebp),%eax
+  80032c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80032f:	89 d1                	mov    %edx,%ecx
+  800331:	89 c2                	mov    %eax,%edx
+  800333:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800336:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800339:	8b 45 10             	mov    0x10(%ebp),%eax
+  80033c:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80033f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800342:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800349:	39 c2                	cmp    %eax,%edx
+  80034b:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80034e:	72 3e                	jb     80038e <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800350:	83 ec 0c             	sub    $0xc,%esp
+  800353:	ff 75 18             	push   0x18(%ebp)
+  800356:	83 eb 01             	sub    $0x1,%ebx
+  800359:	53                   	push   %ebx
+  80035a:	50                   	push   %eax
+  80035b:	83 ec 08             	sub    $0x8,%esp
+  80035e:	ff 75 e4             	push   -0x1c(%ebp)
+  800361:	ff 75 e0             	push   -0x20(%ebp)
+  800364:	ff 75 dc             	push   -0x24(%ebp)
+  800367:	ff 75 d8             	push   -0x28(%ebp)
+  80036a:	e8 71 23 00 00       	call   8026e0 <__udivdi3>
+  80036f:	83 c4 18             	add    $0x18,%esp
+  800372:	52                   	push   %edx
+  800373:	50                   	push   %eax
+  800374:	89 f2                	mov    %esi,%edx
+  800376:	89 f8                	mov    %edi,%eax
+  800378:	e8 9f ff ff ff       	call   80031c <printnum>
+  80037d:	83 c4 20             	add    $0x20,%esp
+  800380:	eb 13                	jmp    800395 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800382:	83 ec 08             	sub    $0x8,%esp
+  800385:	56                   	push   %esi
+  800386:	ff 75 18             	push   0x18(%ebp)
+  800389:	ff d7                	call   *%edi
+  80038b:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80038e:	83 eb 01             	sub    $0x1,%ebx
+  800391:	85 db                	test   %ebx,%ebx
+  800393:	7f ed                	jg     800382 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800395:	83 ec 08             	sub    $0x8,%esp
+  800398:	56                   	push   %esi
+  800399:	83 ec 04             	sub    $0x4,%esp
+  80039c:	ff 75 e4             	push   -0x1c(%ebp)
+  80039f:	ff 75 e0             	push   -0x20(%ebp)
+  8003a2:	ff 75 dc             	push   -0x24(%ebp)
+  8003a5:	ff 75 d8             	push   -0x28(%ebp)
+  8003a8:	e8 03 24 00 00       	call   8027b0 <__umoddi3>
+  8003ad:	83 c4 14             	add    $0x14,%esp
+  8003b0:	0f be 80 eb 2b 80 00 	movsbl 0x802beb(%eax),%eax
+  8003b7:	50                   	push   %eax
+  8003b8:	ff d7                	call   *%edi
+}
+  8003ba:	83 c4 10             	add    $0x10,%esp
+  8003bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003c0:	5b                   	pop    %ebx
+  8003c1:	5e                   	pop    %esi
+  8003c2:	5f                   	pop    %edi
+  8003c3:	5d                   	pop    %ebp
+  8003c4:	c3                   	ret
+
+008003c5 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8003c5:	55                   	push   %ebp
+  8003c6:	89 e5                	mov    %esp,%ebp
+  8003c8:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8003cb:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8003cf:	8b 10                	mov    (%eax),%edx
+  8003d1:	3b 50 04             	cmp    0x4(%eax),%edx
+  8003d4:	73 0a                	jae    8003e0 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8003d6:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8003d9:	89 08                	mov    %ecx,(%eax)
+  8003db:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003de:	88 02                	mov    %al,(%edx)
+}
+  8003e0:	5d                   	pop    %ebp
+  8003e1:	c3                   	ret
+
+008003e2 <printfmt>:
+{
+  8003e2:	55                   	push   %ebp
+  8003e3:	89 e5                	mov    %esp,%ebp
+  8003e5:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8003e8:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8003eb:	50                   	push   %eax
+  8003ec:	ff 75 10             	push   0x10(%ebp)
+  8003ef:	ff 75 0c             	push   0xc(%ebp)
+  8003f2:	ff 75 08             	push   0x8(%ebp)
+  8003f5:	e8 05 00 00 00       	call   8003ff <vprintfmt>
+}
+  8003fa:	83 c4 10             	add    $0x10,%esp
+  8003fd:	c9                   	leave
+  8003fe:	c3                   	ret
+
+008003ff <vprintfmt>:
+{
+  8003ff:	55                   	push   %ebp
+  800400:	89 e5                	mov    %esp,%ebp
+  800402:	57                   	push   %edi
+  800403:	56                   	push   %esi
+  800404:	53                   	push   %ebx
+  800405:	83 ec 2c             	sub    $0x2c,%esp
+  800408:	8b 75 08             	mov    0x8(%ebp),%esi
+  80040b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80040e:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800411:	eb 0a                	jmp    80041d <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800413:	83 ec 08             	sub    $0x8,%esp
+  800416:	53                   	push   %ebx
+  800417:	50                   	push   %eax
+  800418:	ff d6                	call   *%esi
+  80041a:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80041d:	83 c7 01             	add    $0x1,%edi
+  800420:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800424:	83 f8 25             	cmp    $0x25,%eax
+  800427:	74 0c                	je     800435 <vprintfmt+0x36>
+			if (ch == '\0')
+  800429:	85 c0                	test   %eax,%eax
+  80042b:	75 e6                	jne    800413 <vprintfmt+0x14>
+}
+  80042d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800430:	5b                   	pop    %ebx
+  800431:	5e                   	pop    %esi
+  800432:	5f                   	pop    %edi
+  800433:	5d                   	pop    %ebp
+  800434:	c3                   	ret
+		padc = ' ';
+  800435:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800439:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800440:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800447:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80044e:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800453:	8d 47 01             	lea    0x1(%edi),%eax
+  800456:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800459:	0f b6 17             	movzbl (%edi),%edx
+  80045c:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80045f:	3c 55                	cmp    $0x55,%al
+  800461:	0f 87 9a 03 00 00    	ja     800801 <vprintfmt+0x402>
+  800467:	0f b6 c0             	movzbl %al,%eax
+  80046a:	ff 24 85 20 2d 80 00 	jmp    *0x802d20(,%eax,4)
+  800471:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800474:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800478:	eb d9                	jmp    800453 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80047a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80047d:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800481:	eb d0                	jmp    800453 <vprintfmt+0x54>
+  800483:	0f b6 d2             	movzbl %dl,%edx
+  800486:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800489:	b8 00 00 00 00       	mov    $0x0,%eax
+  80048e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800491:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800494:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800498:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80049b:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80049e:	83 f9 09             	cmp    $0x9,%ecx
+  8004a1:	77 55                	ja     8004f8 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8004a3:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8004a6:	eb e9                	jmp    800491 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8004a8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004ab:	8b 00                	mov    (%eax),%eax
+  8004ad:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004b3:	8d 40 04             	lea    0x4(%eax),%eax
+  8004b6:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004b9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8004bc:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004c0:	79 91                	jns    800453 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8004c2:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004c5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004c8:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8004cf:	eb 82                	jmp    800453 <vprintfmt+0x54>
+			if (width < 0)
+  8004d1:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004d4:	85 d2                	test   %edx,%edx
+  8004d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004db:	0f 49 c2             	cmovns %edx,%eax
+  8004de:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004e1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8004e4:	e9 6a ff ff ff       	jmp    800453 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004e9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8004ec:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8004f3:	e9 5b ff ff ff       	jmp    800453 <vprintfmt+0x54>
+  8004f8:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8004fb:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004fe:	eb bc                	jmp    8004bc <vprintfmt+0xbd>
+			lflag++;
+  800500:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800503:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800506:	e9 48 ff ff ff       	jmp    800453 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80050b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80050e:	8d 78 04             	lea    0x4(%eax),%edi
+  800511:	83 ec 08             	sub    $0x8,%esp
+  800514:	53                   	push   %ebx
+  800515:	ff 30                	push   (%eax)
+  800517:	ff d6                	call   *%esi
+			break;
+  800519:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80051c:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80051f:	e9 7c 02 00 00       	jmp    8007a0 <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  800524:	8b 45 14             	mov    0x14(%ebp),%eax
+  800527:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80052a:	8b 10                	mov    (%eax),%edx
+  80052c:	89 d0                	mov    %edx,%eax
+  80052e:	f7 d8                	neg    %eax
+  800530:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800533:	83 f8 10             	cmp    $0x10,%eax
+  800536:	7f 23                	jg     80055b <vprintfmt+0x15c>
+  800538:	8b 14 85 80 2e 80 00 	mov    0x802e80(,%eax,4),%edx
+  80053f:	85 d2                	test   %edx,%edx
+  800541:	74 18                	je     80055b <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800543:	52                   	push   %edx
+  800544:	68 c5 30 80 00       	push   $0x8030c5
+  800549:	53                   	push   %ebx
+  80054a:	56                   	push   %esi
+  80054b:	e8 92 fe ff ff       	call   8003e2 <printfmt>
+  800550:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800553:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800556:	e9 45 02 00 00       	jmp    8007a0 <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  80055b:	50                   	push   %eax
+  80055c:	68 03 2c 80 00       	push   $0x802c03
+  800561:	53                   	push   %ebx
+  800562:	56                   	push   %esi
+  800563:	e8 7a fe ff ff       	call   8003e2 <printfmt>
+  800568:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80056b:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80056e:	e9 2d 02 00 00       	jmp    8007a0 <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800573:	8b 45 14             	mov    0x14(%ebp),%eax
+  800576:	83 c0 04             	add    $0x4,%eax
+  800579:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80057c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80057f:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800581:	85 c9                	test   %ecx,%ecx
+  800583:	b8 fc 2b 80 00       	mov    $0x802bfc,%eax
+  800588:	0f 45 c1             	cmovne %ecx,%eax
+  80058b:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80058e:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800592:	7e 06                	jle    80059a <vprintfmt+0x19b>
+  800594:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800598:	75 0b                	jne    8005a5 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80059a:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80059d:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8005a0:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005a3:	eb 5c                	jmp    800601 <vprintfmt+0x202>
+  8005a5:	83 ec 08             	sub    $0x8,%esp
+  8005a8:	ff 75 d0             	push   -0x30(%ebp)
+  8005ab:	ff 75 cc             	push   -0x34(%ebp)
+  8005ae:	e8 eb 02 00 00       	call   80089e <strnlen>
+  8005b3:	89 c2                	mov    %eax,%edx
+  8005b5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005b8:	29 d0                	sub    %edx,%eax
+  8005ba:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8005bd:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8005c1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005c4:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005c7:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005c9:	eb 0e                	jmp    8005d9 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8005cb:	83 ec 08             	sub    $0x8,%esp
+  8005ce:	53                   	push   %ebx
+  8005cf:	57                   	push   %edi
+  8005d0:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005d3:	83 ee 01             	sub    $0x1,%esi
+  8005d6:	83 c4 10             	add    $0x10,%esp
+  8005d9:	85 f6                	test   %esi,%esi
+  8005db:	7f ee                	jg     8005cb <vprintfmt+0x1cc>
+  8005dd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005e0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005e3:	85 c0                	test   %eax,%eax
+  8005e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005ea:	0f 49 d0             	cmovns %eax,%edx
+  8005ed:	29 d0                	sub    %edx,%eax
+  8005ef:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005f2:	eb a6                	jmp    80059a <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8005f4:	83 ec 08             	sub    $0x8,%esp
+  8005f7:	53                   	push   %ebx
+  8005f8:	52                   	push   %edx
+  8005f9:	ff 55 08             	call   *0x8(%ebp)
+  8005fc:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005ff:	89 f1                	mov    %esi,%ecx
+  800601:	8d 71 01             	lea    0x1(%ecx),%esi
+  800604:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800608:	0f be d0             	movsbl %al,%edx
+  80060b:	85 d2                	test   %edx,%edx
+  80060d:	74 28                	je     800637 <vprintfmt+0x238>
+  80060f:	85 ff                	test   %edi,%edi
+  800611:	78 05                	js     800618 <vprintfmt+0x219>
+  800613:	83 ef 01             	sub    $0x1,%edi
+  800616:	78 30                	js     800648 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800618:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80061c:	74 d6                	je     8005f4 <vprintfmt+0x1f5>
+  80061e:	0f be c0             	movsbl %al,%eax
+  800621:	83 e8 20             	sub    $0x20,%eax
+  800624:	83 f8 5e             	cmp    $0x5e,%eax
+  800627:	76 cb                	jbe    8005f4 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800629:	83 ec 08             	sub    $0x8,%esp
+  80062c:	53                   	push   %ebx
+  80062d:	6a 3f                	push   $0x3f
+  80062f:	ff 55 08             	call   *0x8(%ebp)
+  800632:	83 c4 10             	add    $0x10,%esp
+  800635:	eb c8                	jmp    8005ff <vprintfmt+0x200>
+  800637:	8b 75 08             	mov    0x8(%ebp),%esi
+  80063a:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80063d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800640:	01 d0                	add    %edx,%eax
+  800642:	29 c8                	sub    %ecx,%eax
+  800644:	89 c7                	mov    %eax,%edi
+  800646:	eb 13                	jmp    80065b <vprintfmt+0x25c>
+  800648:	8b 75 08             	mov    0x8(%ebp),%esi
+  80064b:	eb ed                	jmp    80063a <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80064d:	83 ec 08             	sub    $0x8,%esp
+  800650:	53                   	push   %ebx
+  800651:	6a 20                	push   $0x20
+  800653:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800655:	83 ef 01             	sub    $0x1,%edi
+  800658:	83 c4 10             	add    $0x10,%esp
+  80065b:	85 ff                	test   %edi,%edi
+  80065d:	7f ee                	jg     80064d <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80065f:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800662:	89 45 14             	mov    %eax,0x14(%ebp)
+  800665:	e9 36 01 00 00       	jmp    8007a0 <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  80066a:	83 f9 01             	cmp    $0x1,%ecx
+  80066d:	7f 1f                	jg     80068e <vprintfmt+0x28f>
+	else if (lflag)
+  80066f:	85 c9                	test   %ecx,%ecx
+  800671:	74 67                	je     8006da <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800673:	8b 45 14             	mov    0x14(%ebp),%eax
+  800676:	8b 00                	mov    (%eax),%eax
+  800678:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80067b:	89 c1                	mov    %eax,%ecx
+  80067d:	c1 f9 1f             	sar    $0x1f,%ecx
+  800680:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800683:	8b 45 14             	mov    0x14(%ebp),%eax
+  800686:	8d 40 04             	lea    0x4(%eax),%eax
+  800689:	89 45 14             	mov    %eax,0x14(%ebp)
+  80068c:	eb 17                	jmp    8006a5 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  80068e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800691:	8b 50 04             	mov    0x4(%eax),%edx
+  800694:	8b 00                	mov    (%eax),%eax
+  800696:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800699:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80069c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069f:	8d 40 08             	lea    0x8(%eax),%eax
+  8006a2:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8006a5:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006a8:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8006ab:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8006b0:	85 c9                	test   %ecx,%ecx
+  8006b2:	0f 89 ce 00 00 00    	jns    800786 <vprintfmt+0x387>
+				putch('-', putdat);
+  8006b8:	83 ec 08             	sub    $0x8,%esp
+  8006bb:	53                   	push   %ebx
+  8006bc:	6a 2d                	push   $0x2d
+  8006be:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8006c0:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006c3:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8006c6:	f7 da                	neg    %edx
+  8006c8:	83 d1 00             	adc    $0x0,%ecx
+  8006cb:	f7 d9                	neg    %ecx
+  8006cd:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8006d0:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8006d5:	e9 ac 00 00 00       	jmp    800786 <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  8006da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006dd:	8b 00                	mov    (%eax),%eax
+  8006df:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006e2:	89 c1                	mov    %eax,%ecx
+  8006e4:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006e7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006ea:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ed:	8d 40 04             	lea    0x4(%eax),%eax
+  8006f0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006f3:	eb b0                	jmp    8006a5 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8006f5:	83 f9 01             	cmp    $0x1,%ecx
+  8006f8:	7f 1b                	jg     800715 <vprintfmt+0x316>
+	else if (lflag)
+  8006fa:	85 c9                	test   %ecx,%ecx
+  8006fc:	74 2c                	je     80072a <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  8006fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800701:	8b 10                	mov    (%eax),%edx
+  800703:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800708:	8d 40 04             	lea    0x4(%eax),%eax
+  80070b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80070e:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800713:	eb 71                	jmp    800786 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  800715:	8b 45 14             	mov    0x14(%ebp),%eax
+  800718:	8b 10                	mov    (%eax),%edx
+  80071a:	8b 48 04             	mov    0x4(%eax),%ecx
+  80071d:	8d 40 08             	lea    0x8(%eax),%eax
+  800720:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800723:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800728:	eb 5c                	jmp    800786 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  80072a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80072d:	8b 10                	mov    (%eax),%edx
+  80072f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800734:	8d 40 04             	lea    0x4(%eax),%eax
+  800737:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80073a:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80073f:	eb 45                	jmp    800786 <vprintfmt+0x387>
+			putch('X', putdat);
+  800741:	83 ec 08             	sub    $0x8,%esp
+  800744:	53                   	push   %ebx
+  800745:	6a 58                	push   $0x58
+  800747:	ff d6                	call   *%esi
+			putch('X', putdat);
+  800749:	83 c4 08             	add    $0x8,%esp
+  80074c:	53                   	push   %ebx
+  80074d:	6a 58                	push   $0x58
+  80074f:	ff d6                	call   *%esi
+			putch('X', putdat);
+  800751:	83 c4 08             	add    $0x8,%esp
+  800754:	53                   	push   %ebx
+  800755:	6a 58                	push   $0x58
+  800757:	ff d6                	call   *%esi
+			break;
+  800759:	83 c4 10             	add    $0x10,%esp
+  80075c:	eb 42                	jmp    8007a0 <vprintfmt+0x3a1>
+			putch('0', putdat);
+  80075e:	83 ec 08             	sub    $0x8,%esp
+  800761:	53                   	push   %ebx
+  800762:	6a 30                	push   $0x30
+  800764:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800766:	83 c4 08             	add    $0x8,%esp
+  800769:	53                   	push   %ebx
+  80076a:	6a 78                	push   $0x78
+  80076c:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  80076e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800771:	8b 10                	mov    (%eax),%edx
+  800773:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800778:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80077b:	8d 40 04             	lea    0x4(%eax),%eax
+  80077e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800781:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800786:	83 ec 0c             	sub    $0xc,%esp
+  800789:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80078d:	50                   	push   %eax
+  80078e:	ff 75 e0             	push   -0x20(%ebp)
+  800791:	57                   	push   %edi
+  800792:	51                   	push   %ecx
+  800793:	52                   	push   %edx
+  800794:	89 da                	mov    %ebx,%edx
+  800796:	89 f0                	mov    %esi,%eax
+  800798:	e8 7f fb ff ff       	call   80031c <printnum>
+			break;
+  80079d:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8007a0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8007a3:	e9 75 fc ff ff       	jmp    80041d <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8007a8:	83 f9 01             	cmp    $0x1,%ecx
+  8007ab:	7f 1b                	jg     8007c8 <vprintfmt+0x3c9>
+	else if (lflag)
+  8007ad:	85 c9                	test   %ecx,%ecx
+  8007af:	74 2c                	je     8007dd <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  8007b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b4:	8b 10                	mov    (%eax),%edx
+  8007b6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007bb:	8d 40 04             	lea    0x4(%eax),%eax
+  8007be:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007c1:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8007c6:	eb be                	jmp    800786 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  8007c8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007cb:	8b 10                	mov    (%eax),%edx
+  8007cd:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007d0:	8d 40 08             	lea    0x8(%eax),%eax
+  8007d3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007d6:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8007db:	eb a9                	jmp    800786 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  8007dd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e0:	8b 10                	mov    (%eax),%edx
+  8007e2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007e7:	8d 40 04             	lea    0x4(%eax),%eax
+  8007ea:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007ed:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8007f2:	eb 92                	jmp    800786 <vprintfmt+0x387>
+			putch(ch, putdat);
+  8007f4:	83 ec 08             	sub    $0x8,%esp
+  8007f7:	53                   	push   %ebx
+  8007f8:	6a 25                	push   $0x25
+  8007fa:	ff d6                	call   *%esi
+			break;
+  8007fc:	83 c4 10             	add    $0x10,%esp
+  8007ff:	eb 9f                	jmp    8007a0 <vprintfmt+0x3a1>
+			putch('%', putdat);
+  800801:	83 ec 08             	sub    $0x8,%esp
+  800804:	53                   	push   %ebx
+  800805:	6a 25                	push   $0x25
+  800807:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800809:	83 c4 10             	add    $0x10,%esp
+  80080c:	89 f8                	mov    %edi,%eax
+  80080e:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800812:	74 05                	je     800819 <vprintfmt+0x41a>
+  800814:	83 e8 01             	sub    $0x1,%eax
+  800817:	eb f5                	jmp    80080e <vprintfmt+0x40f>
+  800819:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80081c:	eb 82                	jmp    8007a0 <vprintfmt+0x3a1>
+
+0080081e <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80081e:	55                   	push   %ebp
+  80081f:	89 e5                	mov    %esp,%ebp
+  800821:	83 ec 18             	sub    $0x18,%esp
+  800824:	8b 45 08             	mov    0x8(%ebp),%eax
+  800827:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80082a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80082d:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800831:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800834:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80083b:	85 c0                	test   %eax,%eax
+  80083d:	74 26                	je     800865 <vsnprintf+0x47>
+  80083f:	85 d2                	test   %edx,%edx
+  800841:	7e 22                	jle    800865 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800843:	ff 75 14             	push   0x14(%ebp)
+  800846:	ff 75 10             	push   0x10(%ebp)
+  800849:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80084c:	50                   	push   %eax
+  80084d:	68 c5 03 80 00       	push   $0x8003c5
+  800852:	e8 a8 fb ff ff       	call   8003ff <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800857:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80085a:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80085d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800860:	83 c4 10             	add    $0x10,%esp
+}
+  800863:	c9                   	leave
+  800864:	c3                   	ret
+		return -E_INVAL;
+  800865:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80086a:	eb f7                	jmp    800863 <vsnprintf+0x45>
+
+0080086c <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80086c:	55                   	push   %ebp
+  80086d:	89 e5                	mov    %esp,%ebp
+  80086f:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800872:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800875:	50                   	push   %eax
+  800876:	ff 75 10             	push   0x10(%ebp)
+  800879:	ff 75 0c             	push   0xc(%ebp)
+  80087c:	ff 75 08             	push   0x8(%ebp)
+  80087f:	e8 9a ff ff ff       	call   80081e <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800884:	c9                   	leave
+  800885:	c3                   	ret
+
+00800886 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800886:	55                   	push   %ebp
+  800887:	89 e5                	mov    %esp,%ebp
+  800889:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80088c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800891:	eb 03                	jmp    800896 <strlen+0x10>
+		n++;
+  800893:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800896:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80089a:	75 f7                	jne    800893 <strlen+0xd>
+	return n;
+}
+  80089c:	5d                   	pop    %ebp
+  80089d:	c3                   	ret
+
+0080089e <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80089e:	55                   	push   %ebp
+  80089f:	89 e5                	mov    %esp,%ebp
+  8008a1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008a4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008ac:	eb 03                	jmp    8008b1 <strnlen+0x13>
+		n++;
+  8008ae:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008b1:	39 d0                	cmp    %edx,%eax
+  8008b3:	74 08                	je     8008bd <strnlen+0x1f>
+  8008b5:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008b9:	75 f3                	jne    8008ae <strnlen+0x10>
+  8008bb:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8008bd:	89 d0                	mov    %edx,%eax
+  8008bf:	5d                   	pop    %ebp
+  8008c0:	c3                   	ret
+
+008008c1 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8008c1:	55                   	push   %ebp
+  8008c2:	89 e5                	mov    %esp,%ebp
+  8008c4:	53                   	push   %ebx
+  8008c5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008c8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8008cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8008d4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8008d7:	83 c0 01             	add    $0x1,%eax
+  8008da:	84 d2                	test   %dl,%dl
+  8008dc:	75 f2                	jne    8008d0 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8008de:	89 c8                	mov    %ecx,%eax
+  8008e0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008e3:	c9                   	leave
+  8008e4:	c3                   	ret
+
+008008e5 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8008e5:	55                   	push   %ebp
+  8008e6:	89 e5                	mov    %esp,%ebp
+  8008e8:	53                   	push   %ebx
+  8008e9:	83 ec 10             	sub    $0x10,%esp
+  8008ec:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8008ef:	53                   	push   %ebx
+  8008f0:	e8 91 ff ff ff       	call   800886 <strlen>
+  8008f5:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8008f8:	ff 75 0c             	push   0xc(%ebp)
+  8008fb:	01 d8                	add    %ebx,%eax
+  8008fd:	50                   	push   %eax
+  8008fe:	e8 be ff ff ff       	call   8008c1 <strcpy>
+	return dst;
+}
+  800903:	89 d8                	mov    %ebx,%eax
+  800905:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800908:	c9                   	leave
+  800909:	c3                   	ret
+
+0080090a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80090a:	55                   	push   %ebp
+  80090b:	89 e5                	mov    %esp,%ebp
+  80090d:	56                   	push   %esi
+  80090e:	53                   	push   %ebx
+  80090f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800912:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800915:	89 f3                	mov    %esi,%ebx
+  800917:	03 5d 10             	add    0x10(%ebp),%ebx
+  80091a:	89 f0                	mov    %esi,%eax
+  80091c:	eb 0f                	jmp    80092d <strncpy+0x23>
+		*dst++ = *src;
+  80091e:	83 c0 01             	add    $0x1,%eax
+  800921:	0f b6 0a             	movzbl (%edx),%ecx
+  800924:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800927:	80 f9 01             	cmp    $0x1,%cl
+  80092a:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80092d:	39 d8                	cmp    %ebx,%eax
+  80092f:	75 ed                	jne    80091e <strncpy+0x14>
+	}
+	return ret;
+}
+  800931:	89 f0                	mov    %esi,%eax
+  800933:	5b                   	pop    %ebx
+  800934:	5e                   	pop    %esi
+  800935:	5d                   	pop    %ebp
+  800936:	c3                   	ret
+
+00800937 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800937:	55                   	push   %ebp
+  800938:	89 e5                	mov    %esp,%ebp
+  80093a:	56                   	push   %esi
+  80093b:	53                   	push   %ebx
+  80093c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80093f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800942:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800945:	89 f0                	mov    %esi,%eax
+  800947:	85 d2                	test   %edx,%edx
+  800949:	74 21                	je     80096c <strlcpy+0x35>
+  80094b:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80094f:	89 f2                	mov    %esi,%edx
+  800951:	eb 09                	jmp    80095c <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800953:	83 c1 01             	add    $0x1,%ecx
+  800956:	83 c2 01             	add    $0x1,%edx
+  800959:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80095c:	39 c2                	cmp    %eax,%edx
+  80095e:	74 09                	je     800969 <strlcpy+0x32>
+  800960:	0f b6 19             	movzbl (%ecx),%ebx
+  800963:	84 db                	test   %bl,%bl
+  800965:	75 ec                	jne    800953 <strlcpy+0x1c>
+  800967:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800969:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80096c:	29 f0                	sub    %esi,%eax
+}
+  80096e:	5b                   	pop    %ebx
+  80096f:	5e                   	pop    %esi
+  800970:	5d                   	pop    %ebp
+  800971:	c3                   	ret
+
+00800972 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800972:	55                   	push   %ebp
+  800973:	89 e5                	mov    %esp,%ebp
+  800975:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800978:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80097b:	eb 06                	jmp    800983 <strcmp+0x11>
+		p++, q++;
+  80097d:	83 c1 01             	add    $0x1,%ecx
+  800980:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800983:	0f b6 01             	movzbl (%ecx),%eax
+  800986:	84 c0                	test   %al,%al
+  800988:	74 04                	je     80098e <strcmp+0x1c>
+  80098a:	3a 02                	cmp    (%edx),%al
+  80098c:	74 ef                	je     80097d <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80098e:	0f b6 c0             	movzbl %al,%eax
+  800991:	0f b6 12             	movzbl (%edx),%edx
+  800994:	29 d0                	sub    %edx,%eax
+}
+  800996:	5d                   	pop    %ebp
+  800997:	c3                   	ret
+
+00800998 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800998:	55                   	push   %ebp
+  800999:	89 e5                	mov    %esp,%ebp
+  80099b:	53                   	push   %ebx
+  80099c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80099f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009a2:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8009a5:	eb 09                	jmp    8009b0 <strncmp+0x18>
+		n--, p++, q++;
+  8009a7:	83 ea 01             	sub    $0x1,%edx
+  8009aa:	83 c0 01             	add    $0x1,%eax
+  8009ad:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8009b0:	85 d2                	test   %edx,%edx
+  8009b2:	74 18                	je     8009cc <strncmp+0x34>
+  8009b4:	0f b6 18             	movzbl (%eax),%ebx
+  8009b7:	84 db                	test   %bl,%bl
+  8009b9:	74 04                	je     8009bf <strncmp+0x27>
+  8009bb:	3a 19                	cmp    (%ecx),%bl
+  8009bd:	74 e8                	je     8009a7 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009bf:	0f b6 00             	movzbl (%eax),%eax
+  8009c2:	0f b6 11             	movzbl (%ecx),%edx
+  8009c5:	29 d0                	sub    %edx,%eax
+}
+  8009c7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009ca:	c9                   	leave
+  8009cb:	c3                   	ret
+		return 0;
+  8009cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009d1:	eb f4                	jmp    8009c7 <strncmp+0x2f>
+
+008009d3 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8009d3:	55                   	push   %ebp
+  8009d4:	89 e5                	mov    %esp,%ebp
+  8009d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009d9:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009dd:	eb 03                	jmp    8009e2 <strchr+0xf>
+  8009df:	83 c0 01             	add    $0x1,%eax
+  8009e2:	0f b6 10             	movzbl (%eax),%edx
+  8009e5:	84 d2                	test   %dl,%dl
+  8009e7:	74 06                	je     8009ef <strchr+0x1c>
+		if (*s == c)
+  8009e9:	38 ca                	cmp    %cl,%dl
+  8009eb:	75 f2                	jne    8009df <strchr+0xc>
+  8009ed:	eb 05                	jmp    8009f4 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8009ef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009f4:	5d                   	pop    %ebp
+  8009f5:	c3                   	ret
+
+008009f6 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8009f6:	55                   	push   %ebp
+  8009f7:	89 e5                	mov    %esp,%ebp
+  8009f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009fc:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a00:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a03:	38 ca                	cmp    %cl,%dl
+  800a05:	74 09                	je     800a10 <strfind+0x1a>
+  800a07:	84 d2                	test   %dl,%dl
+  800a09:	74 05                	je     800a10 <strfind+0x1a>
+	for (; *s; s++)
+  800a0b:	83 c0 01             	add    $0x1,%eax
+  800a0e:	eb f0                	jmp    800a00 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800a10:	5d                   	pop    %ebp
+  800a11:	c3                   	ret
+
+00800a12 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a12:	55                   	push   %ebp
+  800a13:	89 e5                	mov    %esp,%ebp
+  800a15:	57                   	push   %edi
+  800a16:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a19:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a1c:	85 c9                	test   %ecx,%ecx
+  800a1e:	74 20                	je     800a40 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a20:	89 f8                	mov    %edi,%eax
+  800a22:	09 c8                	or     %ecx,%eax
+  800a24:	a8 03                	test   $0x3,%al
+  800a26:	75 12                	jne    800a3a <memset+0x28>
+		c &= 0xFF;
+  800a28:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a2c:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a32:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a35:	fc                   	cld
+  800a36:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a38:	eb 06                	jmp    800a40 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a3a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a3d:	fc                   	cld
+  800a3e:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a40:	89 f8                	mov    %edi,%eax
+  800a42:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a45:	c9                   	leave
+  800a46:	c3                   	ret
+
+00800a47 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a47:	55                   	push   %ebp
+  800a48:	89 e5                	mov    %esp,%ebp
+  800a4a:	57                   	push   %edi
+  800a4b:	56                   	push   %esi
+  800a4c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a4f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a52:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a55:	39 c6                	cmp    %eax,%esi
+  800a57:	73 32                	jae    800a8b <memmove+0x44>
+  800a59:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a5c:	39 d0                	cmp    %edx,%eax
+  800a5e:	73 2b                	jae    800a8b <memmove+0x44>
+		s += n;
+		d += n;
+  800a60:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a63:	89 d6                	mov    %edx,%esi
+  800a65:	09 fe                	or     %edi,%esi
+  800a67:	09 ce                	or     %ecx,%esi
+  800a69:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a6f:	75 0e                	jne    800a7f <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a71:	83 ef 04             	sub    $0x4,%edi
+  800a74:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a77:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a7a:	fd                   	std
+  800a7b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a7d:	eb 09                	jmp    800a88 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a7f:	83 ef 01             	sub    $0x1,%edi
+  800a82:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800a85:	fd                   	std
+  800a86:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a88:	fc                   	cld
+  800a89:	eb 1a                	jmp    800aa5 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a8b:	89 f2                	mov    %esi,%edx
+  800a8d:	09 c2                	or     %eax,%edx
+  800a8f:	09 ca                	or     %ecx,%edx
+  800a91:	f6 c2 03             	test   $0x3,%dl
+  800a94:	75 0a                	jne    800aa0 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a96:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a99:	89 c7                	mov    %eax,%edi
+  800a9b:	fc                   	cld
+  800a9c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a9e:	eb 05                	jmp    800aa5 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800aa0:	89 c7                	mov    %eax,%edi
+  800aa2:	fc                   	cld
+  800aa3:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800aa5:	5e                   	pop    %esi
+  800aa6:	5f                   	pop    %edi
+  800aa7:	5d                   	pop    %ebp
+  800aa8:	c3                   	ret
+
+00800aa9 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800aa9:	55                   	push   %ebp
+  800aaa:	89 e5                	mov    %esp,%ebp
+  800aac:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800aaf:	ff 75 10             	push   0x10(%ebp)
+  800ab2:	ff 75 0c             	push   0xc(%ebp)
+  800ab5:	ff 75 08             	push   0x8(%ebp)
+  800ab8:	e8 8a ff ff ff       	call   800a47 <memmove>
+}
+  800abd:	c9                   	leave
+  800abe:	c3                   	ret
+
+00800abf <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800abf:	55                   	push   %ebp
+  800ac0:	89 e5                	mov    %esp,%ebp
+  800ac2:	56                   	push   %esi
+  800ac3:	53                   	push   %ebx
+  800ac4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ac7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800aca:	89 c6                	mov    %eax,%esi
+  800acc:	03 75 10             	add    0x10(%ebp),%esi
+  800acf:	eb 06                	jmp    800ad7 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800ad1:	83 c0 01             	add    $0x1,%eax
+  800ad4:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800ad7:	39 f0                	cmp    %esi,%eax
+  800ad9:	74 14                	je     800aef <memcmp+0x30>
+		if (*s1 != *s2)
+  800adb:	0f b6 08             	movzbl (%eax),%ecx
+  800ade:	0f b6 1a             	movzbl (%edx),%ebx
+  800ae1:	38 d9                	cmp    %bl,%cl
+  800ae3:	74 ec                	je     800ad1 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800ae5:	0f b6 c1             	movzbl %cl,%eax
+  800ae8:	0f b6 db             	movzbl %bl,%ebx
+  800aeb:	29 d8                	sub    %ebx,%eax
+  800aed:	eb 05                	jmp    800af4 <memcmp+0x35>
+	}
+
+	return 0;
+  800aef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800af4:	5b                   	pop    %ebx
+  800af5:	5e                   	pop    %esi
+  800af6:	5d                   	pop    %ebp
+  800af7:	c3                   	ret
+
+00800af8 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800af8:	55                   	push   %ebp
+  800af9:	89 e5                	mov    %esp,%ebp
+  800afb:	8b 45 08             	mov    0x8(%ebp),%eax
+  800afe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b01:	89 c2                	mov    %eax,%edx
+  800b03:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b06:	eb 03                	jmp    800b0b <memfind+0x13>
+  800b08:	83 c0 01             	add    $0x1,%eax
+  800b0b:	39 d0                	cmp    %edx,%eax
+  800b0d:	73 04                	jae    800b13 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b0f:	38 08                	cmp    %cl,(%eax)
+  800b11:	75 f5                	jne    800b08 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800b13:	5d                   	pop    %ebp
+  800b14:	c3                   	ret
+
+00800b15 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800b15:	55                   	push   %ebp
+  800b16:	89 e5                	mov    %esp,%ebp
+  800b18:	57                   	push   %edi
+  800b19:	56                   	push   %esi
+  800b1a:	53                   	push   %ebx
+  800b1b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b1e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b21:	eb 03                	jmp    800b26 <strtol+0x11>
+		s++;
+  800b23:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800b26:	0f b6 02             	movzbl (%edx),%eax
+  800b29:	3c 20                	cmp    $0x20,%al
+  800b2b:	74 f6                	je     800b23 <strtol+0xe>
+  800b2d:	3c 09                	cmp    $0x9,%al
+  800b2f:	74 f2                	je     800b23 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b31:	3c 2b                	cmp    $0x2b,%al
+  800b33:	74 2a                	je     800b5f <strtol+0x4a>
+	int neg = 0;
+  800b35:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800b3a:	3c 2d                	cmp    $0x2d,%al
+  800b3c:	74 2b                	je     800b69 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b3e:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b44:	75 0f                	jne    800b55 <strtol+0x40>
+  800b46:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b49:	74 28                	je     800b73 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b4b:	85 db                	test   %ebx,%ebx
+  800b4d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b52:	0f 44 d8             	cmove  %eax,%ebx
+  800b55:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b5a:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b5d:	eb 46                	jmp    800ba5 <strtol+0x90>
+		s++;
+  800b5f:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800b62:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b67:	eb d5                	jmp    800b3e <strtol+0x29>
+		s++, neg = 1;
+  800b69:	83 c2 01             	add    $0x1,%edx
+  800b6c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b71:	eb cb                	jmp    800b3e <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b73:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b77:	74 0e                	je     800b87 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800b79:	85 db                	test   %ebx,%ebx
+  800b7b:	75 d8                	jne    800b55 <strtol+0x40>
+		s++, base = 8;
+  800b7d:	83 c2 01             	add    $0x1,%edx
+  800b80:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b85:	eb ce                	jmp    800b55 <strtol+0x40>
+		s += 2, base = 16;
+  800b87:	83 c2 02             	add    $0x2,%edx
+  800b8a:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b8f:	eb c4                	jmp    800b55 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800b91:	0f be c0             	movsbl %al,%eax
+  800b94:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800b97:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b9a:	7d 3a                	jge    800bd6 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800b9c:	83 c2 01             	add    $0x1,%edx
+  800b9f:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800ba3:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800ba5:	0f b6 02             	movzbl (%edx),%eax
+  800ba8:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800bab:	89 f3                	mov    %esi,%ebx
+  800bad:	80 fb 09             	cmp    $0x9,%bl
+  800bb0:	76 df                	jbe    800b91 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800bb2:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800bb5:	89 f3                	mov    %esi,%ebx
+  800bb7:	80 fb 19             	cmp    $0x19,%bl
+  800bba:	77 08                	ja     800bc4 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800bbc:	0f be c0             	movsbl %al,%eax
+  800bbf:	83 e8 57             	sub    $0x57,%eax
+  800bc2:	eb d3                	jmp    800b97 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800bc4:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800bc7:	89 f3                	mov    %esi,%ebx
+  800bc9:	80 fb 19             	cmp    $0x19,%bl
+  800bcc:	77 08                	ja     800bd6 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800bce:	0f be c0             	movsbl %al,%eax
+  800bd1:	83 e8 37             	sub    $0x37,%eax
+  800bd4:	eb c1                	jmp    800b97 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800bd6:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800bda:	74 05                	je     800be1 <strtol+0xcc>
+		*endptr = (char *) s;
+  800bdc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bdf:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800be1:	89 c8                	mov    %ecx,%eax
+  800be3:	f7 d8                	neg    %eax
+  800be5:	85 ff                	test   %edi,%edi
+  800be7:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800bea:	89 c8                	mov    %ecx,%eax
+  800bec:	5b                   	pop    %ebx
+  800bed:	5e                   	pop    %esi
+  800bee:	5f                   	pop    %edi
+  800bef:	5d                   	pop    %ebp
+  800bf0:	c3                   	ret
+
+00800bf1 <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800bf1:	55                   	push   %ebp
+  800bf2:	89 e5                	mov    %esp,%ebp
+  800bf4:	57                   	push   %edi
+  800bf5:	56                   	push   %esi
+  800bf6:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800bf7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bfc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c02:	89 c3                	mov    %eax,%ebx
+  800c04:	89 c7                	mov    %eax,%edi
+  800c06:	89 c6                	mov    %eax,%esi
+  800c08:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  800c0a:	5b                   	pop    %ebx
+  800c0b:	5e                   	pop    %esi
+  800c0c:	5f                   	pop    %edi
+  800c0d:	5d                   	pop    %ebp
+  800c0e:	c3                   	ret
+
+00800c0f <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800c0f:	55                   	push   %ebp
+  800c10:	89 e5                	mov    %esp,%ebp
+  800c12:	57                   	push   %edi
+  800c13:	56                   	push   %esi
+  800c14:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800c15:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c1a:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c1f:	89 d1                	mov    %edx,%ecx
+  800c21:	89 d3                	mov    %edx,%ebx
+  800c23:	89 d7                	mov    %edx,%edi
+  800c25:	89 d6                	mov    %edx,%esi
+  800c27:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c29:	5b                   	pop    %ebx
+  800c2a:	5e                   	pop    %esi
+  800c2b:	5f                   	pop    %edi
+  800c2c:	5d                   	pop    %ebp
+  800c2d:	c3                   	ret
+
+00800c2e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800c2e:	55                   	push   %ebp
+  800c2f:	89 e5                	mov    %esp,%ebp
+  800c31:	57                   	push   %edi
+  800c32:	56                   	push   %esi
+  800c33:	53                   	push   %ebx
+  800c34:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c37:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c3c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c3f:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c44:	89 cb                	mov    %ecx,%ebx
+  800c46:	89 cf                	mov    %ecx,%edi
+  800c48:	89 ce                	mov    %ecx,%esi
+  800c4a:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c4c:	85 c0                	test   %eax,%eax
+  800c4e:	7f 08                	jg     800c58 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c50:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c53:	5b                   	pop    %ebx
+  800c54:	5e                   	pop    %esi
+  800c55:	5f                   	pop    %edi
+  800c56:	5d                   	pop    %ebp
+  800c57:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c58:	83 ec 0c             	sub    $0xc,%esp
+  800c5b:	50                   	push   %eax
+  800c5c:	6a 03                	push   $0x3
+  800c5e:	68 e3 2e 80 00       	push   $0x802ee3
+  800c63:	6a 3e                	push   $0x3e
+  800c65:	68 00 2f 80 00       	push   $0x802f00
+  800c6a:	e8 be f5 ff ff       	call   80022d <_panic>
+
+00800c6f <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800c6f:	55                   	push   %ebp
+  800c70:	89 e5                	mov    %esp,%ebp
+  800c72:	57                   	push   %edi
+  800c73:	56                   	push   %esi
+  800c74:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800c75:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c7a:	b8 02 00 00 00       	mov    $0x2,%eax
+  800c7f:	89 d1                	mov    %edx,%ecx
+  800c81:	89 d3                	mov    %edx,%ebx
+  800c83:	89 d7                	mov    %edx,%edi
+  800c85:	89 d6                	mov    %edx,%esi
+  800c87:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800c89:	5b                   	pop    %ebx
+  800c8a:	5e                   	pop    %esi
+  800c8b:	5f                   	pop    %edi
+  800c8c:	5d                   	pop    %ebp
+  800c8d:	c3                   	ret
+
+00800c8e <sys_yield>:
+
+void
+sys_yield(void) {
+  800c8e:	55                   	push   %ebp
+  800c8f:	89 e5                	mov    %esp,%ebp
+  800c91:	57                   	push   %edi
+  800c92:	56                   	push   %esi
+  800c93:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800c94:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c99:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800c9e:	89 d1                	mov    %edx,%ecx
+  800ca0:	89 d3                	mov    %edx,%ebx
+  800ca2:	89 d7                	mov    %edx,%edi
+  800ca4:	89 d6                	mov    %edx,%esi
+  800ca6:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800ca8:	5b                   	pop    %ebx
+  800ca9:	5e                   	pop    %esi
+  800caa:	5f                   	pop    %edi
+  800cab:	5d                   	pop    %ebp
+  800cac:	c3                   	ret
+
+00800cad <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  800cad:	55                   	push   %ebp
+  800cae:	89 e5                	mov    %esp,%ebp
+  800cb0:	57                   	push   %edi
+  800cb1:	56                   	push   %esi
+  800cb2:	53                   	push   %ebx
+  800cb3:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800cb6:	be 00 00 00 00       	mov    $0x0,%esi
+  800cbb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cbe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cc1:	b8 04 00 00 00       	mov    $0x4,%eax
+  800cc6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cc9:	89 f7                	mov    %esi,%edi
+  800ccb:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ccd:	85 c0                	test   %eax,%eax
+  800ccf:	7f 08                	jg     800cd9 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800cd1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cd4:	5b                   	pop    %ebx
+  800cd5:	5e                   	pop    %esi
+  800cd6:	5f                   	pop    %edi
+  800cd7:	5d                   	pop    %ebp
+  800cd8:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800cd9:	83 ec 0c             	sub    $0xc,%esp
+  800cdc:	50                   	push   %eax
+  800cdd:	6a 04                	push   $0x4
+  800cdf:	68 e3 2e 80 00       	push   $0x802ee3
+  800ce4:	6a 3e                	push   $0x3e
+  800ce6:	68 00 2f 80 00       	push   $0x802f00
+  800ceb:	e8 3d f5 ff ff       	call   80022d <_panic>
+
+00800cf0 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  800cf0:	55                   	push   %ebp
+  800cf1:	89 e5                	mov    %esp,%ebp
+  800cf3:	57                   	push   %edi
+  800cf4:	56                   	push   %esi
+  800cf5:	53                   	push   %ebx
+  800cf6:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800cf9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cfc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cff:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d04:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d07:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d0a:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d0d:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d0f:	85 c0                	test   %eax,%eax
+  800d11:	7f 08                	jg     800d1b <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800d13:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d16:	5b                   	pop    %ebx
+  800d17:	5e                   	pop    %esi
+  800d18:	5f                   	pop    %edi
+  800d19:	5d                   	pop    %ebp
+  800d1a:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d1b:	83 ec 0c             	sub    $0xc,%esp
+  800d1e:	50                   	push   %eax
+  800d1f:	6a 05                	push   $0x5
+  800d21:	68 e3 2e 80 00       	push   $0x802ee3
+  800d26:	6a 3e                	push   $0x3e
+  800d28:	68 00 2f 80 00       	push   $0x802f00
+  800d2d:	e8 fb f4 ff ff       	call   80022d <_panic>
+
+00800d32 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  800d32:	55                   	push   %ebp
+  800d33:	89 e5                	mov    %esp,%ebp
+  800d35:	57                   	push   %edi
+  800d36:	56                   	push   %esi
+  800d37:	53                   	push   %ebx
+  800d38:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800d3b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d40:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d43:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d46:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d4b:	89 df                	mov    %ebx,%edi
+  800d4d:	89 de                	mov    %ebx,%esi
+  800d4f:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d51:	85 c0                	test   %eax,%eax
+  800d53:	7f 08                	jg     800d5d <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800d55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d58:	5b                   	pop    %ebx
+  800d59:	5e                   	pop    %esi
+  800d5a:	5f                   	pop    %edi
+  800d5b:	5d                   	pop    %ebp
+  800d5c:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d5d:	83 ec 0c             	sub    $0xc,%esp
+  800d60:	50                   	push   %eax
+  800d61:	6a 06                	push   $0x6
+  800d63:	68 e3 2e 80 00       	push   $0x802ee3
+  800d68:	6a 3e                	push   $0x3e
+  800d6a:	68 00 2f 80 00       	push   $0x802f00
+  800d6f:	e8 b9 f4 ff ff       	call   80022d <_panic>
+
+00800d74 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800d74:	55                   	push   %ebp
+  800d75:	89 e5                	mov    %esp,%ebp
+  800d77:	57                   	push   %edi
+  800d78:	56                   	push   %esi
+  800d79:	53                   	push   %ebx
+  800d7a:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800d7d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d82:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d85:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d88:	b8 08 00 00 00       	mov    $0x8,%eax
+  800d8d:	89 df                	mov    %ebx,%edi
+  800d8f:	89 de                	mov    %ebx,%esi
+  800d91:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d93:	85 c0                	test   %eax,%eax
+  800d95:	7f 08                	jg     800d9f <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800d97:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d9a:	5b                   	pop    %ebx
+  800d9b:	5e                   	pop    %esi
+  800d9c:	5f                   	pop    %edi
+  800d9d:	5d                   	pop    %ebp
+  800d9e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d9f:	83 ec 0c             	sub    $0xc,%esp
+  800da2:	50                   	push   %eax
+  800da3:	6a 08                	push   $0x8
+  800da5:	68 e3 2e 80 00       	push   $0x802ee3
+  800daa:	6a 3e                	push   $0x3e
+  800dac:	68 00 2f 80 00       	push   $0x802f00
+  800db1:	e8 77 f4 ff ff       	call   80022d <_panic>
+
+00800db6 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800db6:	55                   	push   %ebp
+  800db7:	89 e5                	mov    %esp,%ebp
+  800db9:	57                   	push   %edi
+  800dba:	56                   	push   %esi
+  800dbb:	53                   	push   %ebx
+  800dbc:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800dbf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dc4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dca:	b8 09 00 00 00       	mov    $0x9,%eax
+  800dcf:	89 df                	mov    %ebx,%edi
+  800dd1:	89 de                	mov    %ebx,%esi
+  800dd3:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800dd5:	85 c0                	test   %eax,%eax
+  800dd7:	7f 08                	jg     800de1 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800dd9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ddc:	5b                   	pop    %ebx
+  800ddd:	5e                   	pop    %esi
+  800dde:	5f                   	pop    %edi
+  800ddf:	5d                   	pop    %ebp
+  800de0:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800de1:	83 ec 0c             	sub    $0xc,%esp
+  800de4:	50                   	push   %eax
+  800de5:	6a 09                	push   $0x9
+  800de7:	68 e3 2e 80 00       	push   $0x802ee3
+  800dec:	6a 3e                	push   $0x3e
+  800dee:	68 00 2f 80 00       	push   $0x802f00
+  800df3:	e8 35 f4 ff ff       	call   80022d <_panic>
+
+00800df8 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800df8:	55                   	push   %ebp
+  800df9:	89 e5                	mov    %esp,%ebp
+  800dfb:	57                   	push   %edi
+  800dfc:	56                   	push   %esi
+  800dfd:	53                   	push   %ebx
+  800dfe:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800e01:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e06:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e09:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e0c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e11:	89 df                	mov    %ebx,%edi
+  800e13:	89 de                	mov    %ebx,%esi
+  800e15:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e17:	85 c0                	test   %eax,%eax
+  800e19:	7f 08                	jg     800e23 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800e1b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e1e:	5b                   	pop    %ebx
+  800e1f:	5e                   	pop    %esi
+  800e20:	5f                   	pop    %edi
+  800e21:	5d                   	pop    %ebp
+  800e22:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e23:	83 ec 0c             	sub    $0xc,%esp
+  800e26:	50                   	push   %eax
+  800e27:	6a 0a                	push   $0xa
+  800e29:	68 e3 2e 80 00       	push   $0x802ee3
+  800e2e:	6a 3e                	push   $0x3e
+  800e30:	68 00 2f 80 00       	push   $0x802f00
+  800e35:	e8 f3 f3 ff ff       	call   80022d <_panic>
+
+00800e3a <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  800e3a:	55                   	push   %ebp
+  800e3b:	89 e5                	mov    %esp,%ebp
+  800e3d:	57                   	push   %edi
+  800e3e:	56                   	push   %esi
+  800e3f:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e40:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e43:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e46:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800e4b:	be 00 00 00 00       	mov    $0x0,%esi
+  800e50:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e53:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e56:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800e58:	5b                   	pop    %ebx
+  800e59:	5e                   	pop    %esi
+  800e5a:	5f                   	pop    %edi
+  800e5b:	5d                   	pop    %ebp
+  800e5c:	c3                   	ret
+
+00800e5d <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  800e5d:	55                   	push   %ebp
+  800e5e:	89 e5                	mov    %esp,%ebp
+  800e60:	57                   	push   %edi
+  800e61:	56                   	push   %esi
+  800e62:	53                   	push   %ebx
+  800e63:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800e66:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e6b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e6e:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e73:	89 cb                	mov    %ecx,%ebx
+  800e75:	89 cf                	mov    %ecx,%edi
+  800e77:	89 ce                	mov    %ecx,%esi
+  800e79:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e7b:	85 c0                	test   %eax,%eax
+  800e7d:	7f 08                	jg     800e87 <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  800e7f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e82:	5b                   	pop    %ebx
+  800e83:	5e                   	pop    %esi
+  800e84:	5f                   	pop    %edi
+  800e85:	5d                   	pop    %ebp
+  800e86:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e87:	83 ec 0c             	sub    $0xc,%esp
+  800e8a:	50                   	push   %eax
+  800e8b:	6a 0d                	push   $0xd
+  800e8d:	68 e3 2e 80 00       	push   $0x802ee3
+  800e92:	6a 3e                	push   $0x3e
+  800e94:	68 00 2f 80 00       	push   $0x802f00
+  800e99:	e8 8f f3 ff ff       	call   80022d <_panic>
+
+00800e9e <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  800e9e:	55                   	push   %ebp
+  800e9f:	89 e5                	mov    %esp,%ebp
+  800ea1:	57                   	push   %edi
+  800ea2:	56                   	push   %esi
+  800ea3:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800ea4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ea9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eaf:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800eb4:	89 df                	mov    %ebx,%edi
+  800eb6:	89 de                	mov    %ebx,%esi
+  800eb8:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  800eba:	5b                   	pop    %ebx
+  800ebb:	5e                   	pop    %esi
+  800ebc:	5f                   	pop    %edi
+  800ebd:	5d                   	pop    %ebp
+  800ebe:	c3                   	ret
+
+00800ebf <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  800ebf:	55                   	push   %ebp
+  800ec0:	89 e5                	mov    %esp,%ebp
+  800ec2:	57                   	push   %edi
+  800ec3:	56                   	push   %esi
+  800ec4:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800ec5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800eca:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ecd:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800ed2:	89 cb                	mov    %ecx,%ebx
+  800ed4:	89 cf                	mov    %ecx,%edi
+  800ed6:	89 ce                	mov    %ecx,%esi
+  800ed8:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  800eda:	5b                   	pop    %ebx
+  800edb:	5e                   	pop    %esi
+  800edc:	5f                   	pop    %edi
+  800edd:	5d                   	pop    %ebp
+  800ede:	c3                   	ret
+
+00800edf <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  800edf:	55                   	push   %ebp
+  800ee0:	89 e5                	mov    %esp,%ebp
+  800ee2:	57                   	push   %edi
+  800ee3:	56                   	push   %esi
+  800ee4:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800ee5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eea:	b8 10 00 00 00       	mov    $0x10,%eax
+  800eef:	89 d1                	mov    %edx,%ecx
+  800ef1:	89 d3                	mov    %edx,%ebx
+  800ef3:	89 d7                	mov    %edx,%edi
+  800ef5:	89 d6                	mov    %edx,%esi
+  800ef7:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800ef9:	5b                   	pop    %ebx
+  800efa:	5e                   	pop    %esi
+  800efb:	5f                   	pop    %edi
+  800efc:	5d                   	pop    %ebp
+  800efd:	c3                   	ret
+
+00800efe <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  800efe:	55                   	push   %ebp
+  800eff:	89 e5                	mov    %esp,%ebp
+  800f01:	57                   	push   %edi
+  800f02:	56                   	push   %esi
+  800f03:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800f04:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f09:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f0c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f0f:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f14:	89 df                	mov    %ebx,%edi
+  800f16:	89 de                	mov    %ebx,%esi
+  800f18:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800f1a:	5b                   	pop    %ebx
+  800f1b:	5e                   	pop    %esi
+  800f1c:	5f                   	pop    %edi
+  800f1d:	5d                   	pop    %ebp
+  800f1e:	c3                   	ret
+
+00800f1f <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  800f1f:	55                   	push   %ebp
+  800f20:	89 e5                	mov    %esp,%ebp
+  800f22:	57                   	push   %edi
+  800f23:	56                   	push   %esi
+  800f24:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800f25:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f2a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f2d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f30:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f35:	89 df                	mov    %ebx,%edi
+  800f37:	89 de                	mov    %ebx,%esi
+  800f39:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800f3b:	5b                   	pop    %ebx
+  800f3c:	5e                   	pop    %esi
+  800f3d:	5f                   	pop    %edi
+  800f3e:	5d                   	pop    %ebp
+  800f3f:	c3                   	ret
+
+00800f40 <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  800f40:	55                   	push   %ebp
+  800f41:	89 e5                	mov    %esp,%ebp
+  800f43:	57                   	push   %edi
+  800f44:	56                   	push   %esi
+  800f45:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800f46:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f4b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f4e:	b8 13 00 00 00       	mov    $0x13,%eax
+  800f53:	89 cb                	mov    %ecx,%ebx
+  800f55:	89 cf                	mov    %ecx,%edi
+  800f57:	89 ce                	mov    %ecx,%esi
+  800f59:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  800f5b:	5b                   	pop    %ebx
+  800f5c:	5e                   	pop    %esi
+  800f5d:	5f                   	pop    %edi
+  800f5e:	5d                   	pop    %ebp
+  800f5f:	c3                   	ret
+
+00800f60 <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  800f60:	55                   	push   %ebp
+  800f61:	89 e5                	mov    %esp,%ebp
+  800f63:	57                   	push   %edi
+  800f64:	56                   	push   %esi
+  800f65:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800f66:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f6b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f6e:	b8 14 00 00 00       	mov    $0x14,%eax
+  800f73:	89 cb                	mov    %ecx,%ebx
+  800f75:	89 cf                	mov    %ecx,%edi
+  800f77:	89 ce                	mov    %ecx,%esi
+  800f79:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  800f7b:	5b                   	pop    %ebx
+  800f7c:	5e                   	pop    %esi
+  800f7d:	5f                   	pop    %edi
+  800f7e:	5d                   	pop    %ebp
+  800f7f:	c3                   	ret
+
+00800f80 <pgfault>:
+//
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf) {
+  800f80:	55                   	push   %ebp
+  800f81:	89 e5                	mov    %esp,%ebp
+  800f83:	53                   	push   %ebx
+  800f84:	83 ec 04             	sub    $0x4,%esp
+  800f87:	8b 45 08             	mov    0x8(%ebp),%eax
+    void *addr = (void *) utf->utf_fault_va;
+  800f8a:	8b 18                	mov    (%eax),%ebx
+    // Hint:
+    //   Use the read-only page table mappings at uvpt
+    //   (see <inc/memlayout.h>).
+
+    // LAB 4: Your code here.
+    if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P) ||
+  800f8c:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  800f90:	0f 84 95 00 00 00    	je     80102b <pgfault+0xab>
+  800f96:	89 d8                	mov    %ebx,%eax
+  800f98:	c1 e8 16             	shr    $0x16,%eax
+  800f9b:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  800fa2:	a8 01                	test   $0x1,%al
+  800fa4:	0f 84 81 00 00 00    	je     80102b <pgfault+0xab>
+        (uvpt[PGNUM(addr)] & (PTE_P | PTE_COW)) != (PTE_P | PTE_COW)) {
+  800faa:	89 d8                	mov    %ebx,%eax
+  800fac:	c1 e8 0c             	shr    $0xc,%eax
+  800faf:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800fb6:	25 01 08 00 00       	and    $0x801,%eax
+    if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P) ||
+  800fbb:	3d 01 08 00 00       	cmp    $0x801,%eax
+  800fc0:	75 69                	jne    80102b <pgfault+0xab>
+    // Hint:
+    //   You should make three system calls.
+
+    // LAB 4: Your code here.
+
+    if (sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W))
+  800fc2:	83 ec 04             	sub    $0x4,%esp
+  800fc5:	6a 07                	push   $0x7
+  800fc7:	68 00 f0 7f 00       	push   $0x7ff000
+  800fcc:	6a 00                	push   $0x0
+  800fce:	e8 da fc ff ff       	call   800cad <sys_page_alloc>
+  800fd3:	83 c4 10             	add    $0x10,%esp
+  800fd6:	85 c0                	test   %eax,%eax
+  800fd8:	75 65                	jne    80103f <pgfault+0xbf>
+        panic("sys_page_alloc failed");
+
+    addr = ROUNDDOWN(addr, PGSIZE);
+  800fda:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+    memmove(PFTEMP, addr, PGSIZE);
+  800fe0:	83 ec 04             	sub    $0x4,%esp
+  800fe3:	68 00 10 00 00       	push   $0x1000
+  800fe8:	53                   	push   %ebx
+  800fe9:	68 00 f0 7f 00       	push   $0x7ff000
+  800fee:	e8 54 fa ff ff       	call   800a47 <memmove>
+
+    if (sys_page_map(0, PFTEMP, 0, addr, PTE_P | PTE_U | PTE_W))
+  800ff3:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  800ffa:	53                   	push   %ebx
+  800ffb:	6a 00                	push   $0x0
+  800ffd:	68 00 f0 7f 00       	push   $0x7ff000
+  801002:	6a 00                	push   $0x0
+  801004:	e8 e7 fc ff ff       	call   800cf0 <sys_page_map>
+  801009:	83 c4 20             	add    $0x20,%esp
+  80100c:	85 c0                	test   %eax,%eax
+  80100e:	75 43                	jne    801053 <pgfault+0xd3>
+        panic("sys_page_map failed");
+    if (sys_page_unmap(0, PFTEMP))
+  801010:	83 ec 08             	sub    $0x8,%esp
+  801013:	68 00 f0 7f 00       	push   $0x7ff000
+  801018:	6a 00                	push   $0x0
+  80101a:	e8 13 fd ff ff       	call   800d32 <sys_page_unmap>
+  80101f:	83 c4 10             	add    $0x10,%esp
+  801022:	85 c0                	test   %eax,%eax
+  801024:	75 41                	jne    801067 <pgfault+0xe7>
+        panic("sys_page_unmap failed");
+
+}
+  801026:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801029:	c9                   	leave
+  80102a:	c3                   	ret
+        panic("pgfault: faulting access invalid");
+  80102b:	83 ec 04             	sub    $0x4,%esp
+  80102e:	68 10 2f 80 00       	push   $0x802f10
+  801033:	6a 1e                	push   $0x1e
+  801035:	68 7c 2f 80 00       	push   $0x802f7c
+  80103a:	e8 ee f1 ff ff       	call   80022d <_panic>
+        panic("sys_page_alloc failed");
+  80103f:	83 ec 04             	sub    $0x4,%esp
+  801042:	68 ef 2f 80 00       	push   $0x802fef
+  801047:	6a 2a                	push   $0x2a
+  801049:	68 7c 2f 80 00       	push   $0x802f7c
+  80104e:	e8 da f1 ff ff       	call   80022d <_panic>
+        panic("sys_page_map failed");
+  801053:	83 ec 04             	sub    $0x4,%esp
+  801056:	68 87 2f 80 00       	push   $0x802f87
+  80105b:	6a 30                	push   $0x30
+  80105d:	68 7c 2f 80 00       	push   $0x802f7c
+  801062:	e8 c6 f1 ff ff       	call   80022d <_panic>
+        panic("sys_page_unmap failed");
+  801067:	83 ec 04             	sub    $0x4,%esp
+  80106a:	68 9b 2f 80 00       	push   $0x802f9b
+  80106f:	6a 32                	push   $0x32
+  801071:	68 7c 2f 80 00       	push   $0x802f7c
+  801076:	e8 b2 f1 ff ff       	call   80022d <_panic>
+
+0080107b <fork>:
+//   Remember to fix "thisenv" in the child process.
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void) {
+  80107b:	55                   	push   %ebp
+  80107c:	89 e5                	mov    %esp,%ebp
+  80107e:	57                   	push   %edi
+  80107f:	56                   	push   %esi
+  801080:	53                   	push   %ebx
+  801081:	83 ec 18             	sub    $0x18,%esp
+    // LAB 4: Your code here.
+    set_pgfault_handler(pgfault);
+  801084:	68 80 0f 80 00       	push   $0x800f80
+  801089:	e8 6b 13 00 00       	call   8023f9 <set_pgfault_handler>
+
+// This must be inlined.  Exercise for reader: why?
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+  envid_t ret;
+  asm volatile("int %2"
+  80108e:	b8 07 00 00 00       	mov    $0x7,%eax
+  801093:	cd 30                	int    $0x30
+  801095:	89 c6                	mov    %eax,%esi
+
+    envid_t envid = sys_exofork();
+    if (envid < 0)
+  801097:	83 c4 10             	add    $0x10,%esp
+  80109a:	85 c0                	test   %eax,%eax
+  80109c:	78 2a                	js     8010c8 <fork+0x4d>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+
+    uintptr_t addr;
+    for (addr = 0; addr < UTOP; addr += PGSIZE) {
+  80109e:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (envid == 0) {
+  8010a3:	0f 85 a2 00 00 00    	jne    80114b <fork+0xd0>
+        thisenv = &envs[ENVX(sys_getenvid())];
+  8010a9:	e8 c1 fb ff ff       	call   800c6f <sys_getenvid>
+  8010ae:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8010b3:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8010b6:	c1 e0 04             	shl    $0x4,%eax
+  8010b9:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8010be:	a3 20 54 80 00       	mov    %eax,0x805420
+        return 0;
+  8010c3:	e9 6c 01 00 00       	jmp    801234 <fork+0x1b9>
+        panic("fork: sys_exofork error: %e", envid);
+  8010c8:	50                   	push   %eax
+  8010c9:	68 b1 2f 80 00       	push   $0x802fb1
+  8010ce:	6a 6f                	push   $0x6f
+  8010d0:	68 7c 2f 80 00       	push   $0x802f7c
+  8010d5:	e8 53 f1 ff ff       	call   80022d <_panic>
+        if ((r = sys_page_map(0, vptr, envid, vptr, uvpt[pn] & PTE_SYSCALL)) < 0)
+  8010da:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8010e1:	83 ec 0c             	sub    $0xc,%esp
+  8010e4:	25 07 0e 00 00       	and    $0xe07,%eax
+  8010e9:	50                   	push   %eax
+  8010ea:	57                   	push   %edi
+  8010eb:	56                   	push   %esi
+  8010ec:	57                   	push   %edi
+  8010ed:	6a 00                	push   $0x0
+  8010ef:	e8 fc fb ff ff       	call   800cf0 <sys_page_map>
+  8010f4:	83 c4 20             	add    $0x20,%esp
+  8010f7:	85 c0                	test   %eax,%eax
+  8010f9:	79 3e                	jns    801139 <fork+0xbe>
+            panic("duppage :in sys_page_map %e", r);
+  8010fb:	50                   	push   %eax
+  8010fc:	68 cd 2f 80 00       	push   $0x802fcd
+  801101:	6a 49                	push   $0x49
+  801103:	68 7c 2f 80 00       	push   $0x802f7c
+  801108:	e8 20 f1 ff ff       	call   80022d <_panic>
+            panic("duppage :in sys_page_map %e", r);
+  80110d:	50                   	push   %eax
+  80110e:	68 cd 2f 80 00       	push   $0x802fcd
+  801113:	6a 4e                	push   $0x4e
+  801115:	68 7c 2f 80 00       	push   $0x802f7c
+  80111a:	e8 0e f1 ff ff       	call   80022d <_panic>
+    } else if ((r = sys_page_map(0, vptr, envid, vptr, PTE_P | PTE_U)) < 0)
+  80111f:	83 ec 0c             	sub    $0xc,%esp
+  801122:	6a 05                	push   $0x5
+  801124:	57                   	push   %edi
+  801125:	56                   	push   %esi
+  801126:	57                   	push   %edi
+  801127:	6a 00                	push   $0x0
+  801129:	e8 c2 fb ff ff       	call   800cf0 <sys_page_map>
+  80112e:	83 c4 20             	add    $0x20,%esp
+  801131:	85 c0                	test   %eax,%eax
+  801133:	0f 88 ab 00 00 00    	js     8011e4 <fork+0x169>
+    for (addr = 0; addr < UTOP; addr += PGSIZE) {
+  801139:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80113f:	81 fb 00 00 c0 ee    	cmp    $0xeec00000,%ebx
+  801145:	0f 84 ab 00 00 00    	je     8011f6 <fork+0x17b>
+        if (uvpd[PDX(addr)] & PTE_P && uvpt[PGNUM(addr)] & PTE_P && addr != UXSTACKTOP - PGSIZE) {
+  80114b:	89 d8                	mov    %ebx,%eax
+  80114d:	c1 e8 16             	shr    $0x16,%eax
+  801150:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801157:	a8 01                	test   $0x1,%al
+  801159:	74 de                	je     801139 <fork+0xbe>
+  80115b:	89 d8                	mov    %ebx,%eax
+  80115d:	c1 e8 0c             	shr    $0xc,%eax
+  801160:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801167:	f6 c2 01             	test   $0x1,%dl
+  80116a:	74 cd                	je     801139 <fork+0xbe>
+  80116c:	81 fb 00 f0 bf ee    	cmp    $0xeebff000,%ebx
+  801172:	74 c5                	je     801139 <fork+0xbe>
+    void *vptr = (void *) (pn * PGSIZE);
+  801174:	89 c7                	mov    %eax,%edi
+  801176:	c1 e7 0c             	shl    $0xc,%edi
+    if (uvpt[pn] & PTE_SHARE) {
+  801179:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801180:	f6 c6 04             	test   $0x4,%dh
+  801183:	0f 85 51 ff ff ff    	jne    8010da <fork+0x5f>
+    } else if (uvpt[pn] & (PTE_W | PTE_COW)) {
+  801189:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801190:	a9 02 08 00 00       	test   $0x802,%eax
+  801195:	74 88                	je     80111f <fork+0xa4>
+        if ((r = sys_page_map(0, vptr, envid, vptr, PTE_P | PTE_U | PTE_COW)) < 0)
+  801197:	83 ec 0c             	sub    $0xc,%esp
+  80119a:	68 05 08 00 00       	push   $0x805
+  80119f:	57                   	push   %edi
+  8011a0:	56                   	push   %esi
+  8011a1:	57                   	push   %edi
+  8011a2:	6a 00                	push   $0x0
+  8011a4:	e8 47 fb ff ff       	call   800cf0 <sys_page_map>
+  8011a9:	83 c4 20             	add    $0x20,%esp
+  8011ac:	85 c0                	test   %eax,%eax
+  8011ae:	0f 88 59 ff ff ff    	js     80110d <fork+0x92>
+        if ((r = sys_page_map(0, vptr, 0, vptr, PTE_P | PTE_U | PTE_COW)) < 0)
+  8011b4:	83 ec 0c             	sub    $0xc,%esp
+  8011b7:	68 05 08 00 00       	push   $0x805
+  8011bc:	57                   	push   %edi
+  8011bd:	6a 00                	push   $0x0
+  8011bf:	57                   	push   %edi
+  8011c0:	6a 00                	push   $0x0
+  8011c2:	e8 29 fb ff ff       	call   800cf0 <sys_page_map>
+  8011c7:	83 c4 20             	add    $0x20,%esp
+  8011ca:	85 c0                	test   %eax,%eax
+  8011cc:	0f 89 67 ff ff ff    	jns    801139 <fork+0xbe>
+            panic("duppage :in sys_page_map %e", r);
+  8011d2:	50                   	push   %eax
+  8011d3:	68 cd 2f 80 00       	push   $0x802fcd
+  8011d8:	6a 50                	push   $0x50
+  8011da:	68 7c 2f 80 00       	push   $0x802f7c
+  8011df:	e8 49 f0 ff ff       	call   80022d <_panic>
+        panic("duppage :in sys_page_map %e", r);
+  8011e4:	50                   	push   %eax
+  8011e5:	68 cd 2f 80 00       	push   $0x802fcd
+  8011ea:	6a 53                	push   $0x53
+  8011ec:	68 7c 2f 80 00       	push   $0x802f7c
+  8011f1:	e8 37 f0 ff ff       	call   80022d <_panic>
+            duppage(envid, PGNUM(addr));
+        }
+    }
+    if (sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W))
+  8011f6:	83 ec 04             	sub    $0x4,%esp
+  8011f9:	6a 07                	push   $0x7
+  8011fb:	68 00 f0 bf ee       	push   $0xeebff000
+  801200:	56                   	push   %esi
+  801201:	e8 a7 fa ff ff       	call   800cad <sys_page_alloc>
+  801206:	83 c4 10             	add    $0x10,%esp
+  801209:	85 c0                	test   %eax,%eax
+  80120b:	75 31                	jne    80123e <fork+0x1c3>
+        panic("fork: sys_page_alloc failed");
+    if (sys_env_set_pgfault_upcall(envid, _pgfault_upcall))
+  80120d:	83 ec 08             	sub    $0x8,%esp
+  801210:	68 64 24 80 00       	push   $0x802464
+  801215:	56                   	push   %esi
+  801216:	e8 dd fb ff ff       	call   800df8 <sys_env_set_pgfault_upcall>
+  80121b:	83 c4 10             	add    $0x10,%esp
+  80121e:	85 c0                	test   %eax,%eax
+  801220:	75 30                	jne    801252 <fork+0x1d7>
+        panic("fork: sys_env_set_pgfault_upcall failed");
+    if (sys_env_set_status(envid, ENV_RUNNABLE))
+  801222:	83 ec 08             	sub    $0x8,%esp
+  801225:	6a 02                	push   $0x2
+  801227:	56                   	push   %esi
+  801228:	e8 47 fb ff ff       	call   800d74 <sys_env_set_status>
+  80122d:	83 c4 10             	add    $0x10,%esp
+  801230:	85 c0                	test   %eax,%eax
+  801232:	75 32                	jne    801266 <fork+0x1eb>
+        panic("fork: sys_env_set_status failed");
+
+    return envid;
+
+}
+  801234:	89 f0                	mov    %esi,%eax
+  801236:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801239:	5b                   	pop    %ebx
+  80123a:	5e                   	pop    %esi
+  80123b:	5f                   	pop    %edi
+  80123c:	5d                   	pop    %ebp
+  80123d:	c3                   	ret
+        panic("fork: sys_page_alloc failed");
+  80123e:	83 ec 04             	sub    $0x4,%esp
+  801241:	68 e9 2f 80 00       	push   $0x802fe9
+  801246:	6a 7d                	push   $0x7d
+  801248:	68 7c 2f 80 00       	push   $0x802f7c
+  80124d:	e8 db ef ff ff       	call   80022d <_panic>
+        panic("fork: sys_env_set_pgfault_upcall failed");
+  801252:	83 ec 04             	sub    $0x4,%esp
+  801255:	68 34 2f 80 00       	push   $0x802f34
+  80125a:	6a 7f                	push   $0x7f
+  80125c:	68 7c 2f 80 00       	push   $0x802f7c
+  801261:	e8 c7 ef ff ff       	call   80022d <_panic>
+        panic("fork: sys_env_set_status failed");
+  801266:	83 ec 04             	sub    $0x4,%esp
+  801269:	68 5c 2f 80 00       	push   $0x802f5c
+  80126e:	68 81 00 00 00       	push   $0x81
+  801273:	68 7c 2f 80 00       	push   $0x802f7c
+  801278:	e8 b0 ef ff ff       	call   80022d <_panic>
+
+0080127d <sfork>:
+
+// Challenge!
+int
+sfork(void) {
+  80127d:	55                   	push   %ebp
+  80127e:	89 e5                	mov    %esp,%ebp
+  801280:	83 ec 0c             	sub    $0xc,%esp
+    panic("sfork not implemented");
+  801283:	68 05 30 80 00       	push   $0x803005
+  801288:	68 8a 00 00 00       	push   $0x8a
+  80128d:	68 7c 2f 80 00       	push   $0x802f7c
+  801292:	e8 96 ef ff ff       	call   80022d <_panic>
+
+00801297 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801297:	55                   	push   %ebp
+  801298:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80129a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80129d:	05 00 00 00 30       	add    $0x30000000,%eax
+  8012a2:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8012a5:	5d                   	pop    %ebp
+  8012a6:	c3                   	ret
+
+008012a7 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8012a7:	55                   	push   %ebp
+  8012a8:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8012aa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8012ad:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8012b2:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8012b7:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8012bc:	5d                   	pop    %ebp
+  8012bd:	c3                   	ret
+
+008012be <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8012be:	55                   	push   %ebp
+  8012bf:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8012c1:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8012c6:	eb 02                	jmp    8012ca <fd_alloc+0xc>
+  8012c8:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8012ca:	89 c2                	mov    %eax,%edx
+  8012cc:	c1 ea 16             	shr    $0x16,%edx
+  8012cf:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8012d6:	f6 c2 01             	test   $0x1,%dl
+  8012d9:	74 2b                	je     801306 <fd_alloc+0x48>
+  8012db:	89 c2                	mov    %eax,%edx
+  8012dd:	c1 ea 0c             	shr    $0xc,%edx
+  8012e0:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8012e7:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8012ed:	f6 c1 01             	test   $0x1,%cl
+  8012f0:	74 14                	je     801306 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8012f2:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8012f8:	75 ce                	jne    8012c8 <fd_alloc+0xa>
+  8012fa:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8012ff:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801304:	eb 05                	jmp    80130b <fd_alloc+0x4d>
+			return 0;
+  801306:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80130b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80130e:	89 02                	mov    %eax,(%edx)
+}
+  801310:	89 c8                	mov    %ecx,%eax
+  801312:	5d                   	pop    %ebp
+  801313:	c3                   	ret
+
+00801314 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801314:	55                   	push   %ebp
+  801315:	89 e5                	mov    %esp,%ebp
+  801317:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80131a:	83 f8 1f             	cmp    $0x1f,%eax
+  80131d:	77 30                	ja     80134f <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80131f:	c1 e0 0c             	shl    $0xc,%eax
+  801322:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801327:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80132d:	f6 c2 01             	test   $0x1,%dl
+  801330:	74 24                	je     801356 <fd_lookup+0x42>
+  801332:	89 c2                	mov    %eax,%edx
+  801334:	c1 ea 0c             	shr    $0xc,%edx
+  801337:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80133e:	f6 c2 01             	test   $0x1,%dl
+  801341:	74 1a                	je     80135d <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801343:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801346:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801348:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80134d:	5d                   	pop    %ebp
+  80134e:	c3                   	ret
+		return -E_INVAL;
+  80134f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801354:	eb f7                	jmp    80134d <fd_lookup+0x39>
+		return -E_INVAL;
+  801356:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80135b:	eb f0                	jmp    80134d <fd_lookup+0x39>
+  80135d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801362:	eb e9                	jmp    80134d <fd_lookup+0x39>
+
+00801364 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801364:	55                   	push   %ebp
+  801365:	89 e5                	mov    %esp,%ebp
+  801367:	53                   	push   %ebx
+  801368:	83 ec 04             	sub    $0x4,%esp
+  80136b:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80136e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801373:	eb 03                	jmp    801378 <dev_lookup+0x14>
+  801375:	83 c0 01             	add    $0x1,%eax
+  801378:	8b 1c 85 98 30 80 00 	mov    0x803098(,%eax,4),%ebx
+  80137f:	85 db                	test   %ebx,%ebx
+  801381:	74 0b                	je     80138e <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801383:	39 13                	cmp    %edx,(%ebx)
+  801385:	75 ee                	jne    801375 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801387:	b8 00 00 00 00       	mov    $0x0,%eax
+  80138c:	eb 1f                	jmp    8013ad <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80138e:	a1 20 54 80 00       	mov    0x805420,%eax
+  801393:	8b 40 48             	mov    0x48(%eax),%eax
+  801396:	83 ec 04             	sub    $0x4,%esp
+  801399:	52                   	push   %edx
+  80139a:	50                   	push   %eax
+  80139b:	68 1c 30 80 00       	push   $0x80301c
+  8013a0:	e8 63 ef ff ff       	call   800308 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8013a5:	83 c4 10             	add    $0x10,%esp
+  8013a8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8013ad:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8013b0:	89 1a                	mov    %ebx,(%edx)
+}
+  8013b2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013b5:	c9                   	leave
+  8013b6:	c3                   	ret
+
+008013b7 <fd_close>:
+{
+  8013b7:	55                   	push   %ebp
+  8013b8:	89 e5                	mov    %esp,%ebp
+  8013ba:	57                   	push   %edi
+  8013bb:	56                   	push   %esi
+  8013bc:	53                   	push   %ebx
+  8013bd:	83 ec 24             	sub    $0x24,%esp
+  8013c0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8013c3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8013c6:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8013c9:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8013ca:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8013d0:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8013d3:	50                   	push   %eax
+  8013d4:	e8 3b ff ff ff       	call   801314 <fd_lookup>
+  8013d9:	89 c3                	mov    %eax,%ebx
+  8013db:	83 c4 10             	add    $0x10,%esp
+  8013de:	85 c0                	test   %eax,%eax
+  8013e0:	78 05                	js     8013e7 <fd_close+0x30>
+	    || fd != fd2)
+  8013e2:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8013e5:	74 16                	je     8013fd <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8013e7:	89 f8                	mov    %edi,%eax
+  8013e9:	84 c0                	test   %al,%al
+  8013eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013f0:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8013f3:	89 d8                	mov    %ebx,%eax
+  8013f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013f8:	5b                   	pop    %ebx
+  8013f9:	5e                   	pop    %esi
+  8013fa:	5f                   	pop    %edi
+  8013fb:	5d                   	pop    %ebp
+  8013fc:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8013fd:	83 ec 08             	sub    $0x8,%esp
+  801400:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801403:	50                   	push   %eax
+  801404:	ff 36                	push   (%esi)
+  801406:	e8 59 ff ff ff       	call   801364 <dev_lookup>
+  80140b:	89 c3                	mov    %eax,%ebx
+  80140d:	83 c4 10             	add    $0x10,%esp
+  801410:	85 c0                	test   %eax,%eax
+  801412:	78 1a                	js     80142e <fd_close+0x77>
+		if (dev->dev_close)
+  801414:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801417:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80141a:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80141f:	85 c0                	test   %eax,%eax
+  801421:	74 0b                	je     80142e <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801423:	83 ec 0c             	sub    $0xc,%esp
+  801426:	56                   	push   %esi
+  801427:	ff d0                	call   *%eax
+  801429:	89 c3                	mov    %eax,%ebx
+  80142b:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80142e:	83 ec 08             	sub    $0x8,%esp
+  801431:	56                   	push   %esi
+  801432:	6a 00                	push   $0x0
+  801434:	e8 f9 f8 ff ff       	call   800d32 <sys_page_unmap>
+	return r;
+  801439:	83 c4 10             	add    $0x10,%esp
+  80143c:	eb b5                	jmp    8013f3 <fd_close+0x3c>
+
+0080143e <close>:
+
+int
+close(int fdnum)
+{
+  80143e:	55                   	push   %ebp
+  80143f:	89 e5                	mov    %esp,%ebp
+  801441:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801444:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801447:	50                   	push   %eax
+  801448:	ff 75 08             	push   0x8(%ebp)
+  80144b:	e8 c4 fe ff ff       	call   801314 <fd_lookup>
+  801450:	83 c4 10             	add    $0x10,%esp
+  801453:	85 c0                	test   %eax,%eax
+  801455:	79 02                	jns    801459 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801457:	c9                   	leave
+  801458:	c3                   	ret
+		return fd_close(fd, 1);
+  801459:	83 ec 08             	sub    $0x8,%esp
+  80145c:	6a 01                	push   $0x1
+  80145e:	ff 75 f4             	push   -0xc(%ebp)
+  801461:	e8 51 ff ff ff       	call   8013b7 <fd_close>
+  801466:	83 c4 10             	add    $0x10,%esp
+  801469:	eb ec                	jmp    801457 <close+0x19>
+
+0080146b <close_all>:
+
+void
+close_all(void)
+{
+  80146b:	55                   	push   %ebp
+  80146c:	89 e5                	mov    %esp,%ebp
+  80146e:	53                   	push   %ebx
+  80146f:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801472:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801477:	83 ec 0c             	sub    $0xc,%esp
+  80147a:	53                   	push   %ebx
+  80147b:	e8 be ff ff ff       	call   80143e <close>
+	for (i = 0; i < MAXFD; i++)
+  801480:	83 c3 01             	add    $0x1,%ebx
+  801483:	83 c4 10             	add    $0x10,%esp
+  801486:	83 fb 20             	cmp    $0x20,%ebx
+  801489:	75 ec                	jne    801477 <close_all+0xc>
+}
+  80148b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80148e:	c9                   	leave
+  80148f:	c3                   	ret
+
+00801490 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801490:	55                   	push   %ebp
+  801491:	89 e5                	mov    %esp,%ebp
+  801493:	57                   	push   %edi
+  801494:	56                   	push   %esi
+  801495:	53                   	push   %ebx
+  801496:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801499:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80149c:	50                   	push   %eax
+  80149d:	ff 75 08             	push   0x8(%ebp)
+  8014a0:	e8 6f fe ff ff       	call   801314 <fd_lookup>
+  8014a5:	89 c3                	mov    %eax,%ebx
+  8014a7:	83 c4 10             	add    $0x10,%esp
+  8014aa:	85 c0                	test   %eax,%eax
+  8014ac:	78 7f                	js     80152d <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8014ae:	83 ec 0c             	sub    $0xc,%esp
+  8014b1:	ff 75 0c             	push   0xc(%ebp)
+  8014b4:	e8 85 ff ff ff       	call   80143e <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8014b9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8014bc:	c1 e6 0c             	shl    $0xc,%esi
+  8014bf:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8014c5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8014c8:	89 3c 24             	mov    %edi,(%esp)
+  8014cb:	e8 d7 fd ff ff       	call   8012a7 <fd2data>
+  8014d0:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8014d2:	89 34 24             	mov    %esi,(%esp)
+  8014d5:	e8 cd fd ff ff       	call   8012a7 <fd2data>
+  8014da:	83 c4 10             	add    $0x10,%esp
+  8014dd:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8014e0:	89 d8                	mov    %ebx,%eax
+  8014e2:	c1 e8 16             	shr    $0x16,%eax
+  8014e5:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8014ec:	a8 01                	test   $0x1,%al
+  8014ee:	74 11                	je     801501 <dup+0x71>
+  8014f0:	89 d8                	mov    %ebx,%eax
+  8014f2:	c1 e8 0c             	shr    $0xc,%eax
+  8014f5:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8014fc:	f6 c2 01             	test   $0x1,%dl
+  8014ff:	75 36                	jne    801537 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801501:	89 f8                	mov    %edi,%eax
+  801503:	c1 e8 0c             	shr    $0xc,%eax
+  801506:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80150d:	83 ec 0c             	sub    $0xc,%esp
+  801510:	25 07 0e 00 00       	and    $0xe07,%eax
+  801515:	50                   	push   %eax
+  801516:	56                   	push   %esi
+  801517:	6a 00                	push   $0x0
+  801519:	57                   	push   %edi
+  80151a:	6a 00                	push   $0x0
+  80151c:	e8 cf f7 ff ff       	call   800cf0 <sys_page_map>
+  801521:	89 c3                	mov    %eax,%ebx
+  801523:	83 c4 20             	add    $0x20,%esp
+  801526:	85 c0                	test   %eax,%eax
+  801528:	78 33                	js     80155d <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80152a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80152d:	89 d8                	mov    %ebx,%eax
+  80152f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801532:	5b                   	pop    %ebx
+  801533:	5e                   	pop    %esi
+  801534:	5f                   	pop    %edi
+  801535:	5d                   	pop    %ebp
+  801536:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801537:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80153e:	83 ec 0c             	sub    $0xc,%esp
+  801541:	25 07 0e 00 00       	and    $0xe07,%eax
+  801546:	50                   	push   %eax
+  801547:	ff 75 d4             	push   -0x2c(%ebp)
+  80154a:	6a 00                	push   $0x0
+  80154c:	53                   	push   %ebx
+  80154d:	6a 00                	push   $0x0
+  80154f:	e8 9c f7 ff ff       	call   800cf0 <sys_page_map>
+  801554:	89 c3                	mov    %eax,%ebx
+  801556:	83 c4 20             	add    $0x20,%esp
+  801559:	85 c0                	test   %eax,%eax
+  80155b:	79 a4                	jns    801501 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80155d:	83 ec 08             	sub    $0x8,%esp
+  801560:	56                   	push   %esi
+  801561:	6a 00                	push   $0x0
+  801563:	e8 ca f7 ff ff       	call   800d32 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801568:	83 c4 08             	add    $0x8,%esp
+  80156b:	ff 75 d4             	push   -0x2c(%ebp)
+  80156e:	6a 00                	push   $0x0
+  801570:	e8 bd f7 ff ff       	call   800d32 <sys_page_unmap>
+	return r;
+  801575:	83 c4 10             	add    $0x10,%esp
+  801578:	eb b3                	jmp    80152d <dup+0x9d>
+
+0080157a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80157a:	55                   	push   %ebp
+  80157b:	89 e5                	mov    %esp,%ebp
+  80157d:	56                   	push   %esi
+  80157e:	53                   	push   %ebx
+  80157f:	83 ec 18             	sub    $0x18,%esp
+  801582:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801585:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801588:	50                   	push   %eax
+  801589:	56                   	push   %esi
+  80158a:	e8 85 fd ff ff       	call   801314 <fd_lookup>
+  80158f:	83 c4 10             	add    $0x10,%esp
+  801592:	85 c0                	test   %eax,%eax
+  801594:	78 3c                	js     8015d2 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801596:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801599:	83 ec 08             	sub    $0x8,%esp
+  80159c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80159f:	50                   	push   %eax
+  8015a0:	ff 33                	push   (%ebx)
+  8015a2:	e8 bd fd ff ff       	call   801364 <dev_lookup>
+  8015a7:	83 c4 10             	add    $0x10,%esp
+  8015aa:	85 c0                	test   %eax,%eax
+  8015ac:	78 24                	js     8015d2 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8015ae:	8b 43 08             	mov    0x8(%ebx),%eax
+  8015b1:	83 e0 03             	and    $0x3,%eax
+  8015b4:	83 f8 01             	cmp    $0x1,%eax
+  8015b7:	74 20                	je     8015d9 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8015b9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015bc:	8b 40 08             	mov    0x8(%eax),%eax
+  8015bf:	85 c0                	test   %eax,%eax
+  8015c1:	74 37                	je     8015fa <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8015c3:	83 ec 04             	sub    $0x4,%esp
+  8015c6:	ff 75 10             	push   0x10(%ebp)
+  8015c9:	ff 75 0c             	push   0xc(%ebp)
+  8015cc:	53                   	push   %ebx
+  8015cd:	ff d0                	call   *%eax
+  8015cf:	83 c4 10             	add    $0x10,%esp
+}
+  8015d2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015d5:	5b                   	pop    %ebx
+  8015d6:	5e                   	pop    %esi
+  8015d7:	5d                   	pop    %ebp
+  8015d8:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8015d9:	a1 20 54 80 00       	mov    0x805420,%eax
+  8015de:	8b 40 48             	mov    0x48(%eax),%eax
+  8015e1:	83 ec 04             	sub    $0x4,%esp
+  8015e4:	56                   	push   %esi
+  8015e5:	50                   	push   %eax
+  8015e6:	68 5d 30 80 00       	push   $0x80305d
+  8015eb:	e8 18 ed ff ff       	call   800308 <cprintf>
+		return -E_INVAL;
+  8015f0:	83 c4 10             	add    $0x10,%esp
+  8015f3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015f8:	eb d8                	jmp    8015d2 <read+0x58>
+		return -E_NOT_SUPP;
+  8015fa:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015ff:	eb d1                	jmp    8015d2 <read+0x58>
+
+00801601 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801601:	55                   	push   %ebp
+  801602:	89 e5                	mov    %esp,%ebp
+  801604:	57                   	push   %edi
+  801605:	56                   	push   %esi
+  801606:	53                   	push   %ebx
+  801607:	83 ec 0c             	sub    $0xc,%esp
+  80160a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80160d:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801610:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801615:	eb 02                	jmp    801619 <readn+0x18>
+  801617:	01 c3                	add    %eax,%ebx
+  801619:	39 f3                	cmp    %esi,%ebx
+  80161b:	73 21                	jae    80163e <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80161d:	83 ec 04             	sub    $0x4,%esp
+  801620:	89 f0                	mov    %esi,%eax
+  801622:	29 d8                	sub    %ebx,%eax
+  801624:	50                   	push   %eax
+  801625:	89 d8                	mov    %ebx,%eax
+  801627:	03 45 0c             	add    0xc(%ebp),%eax
+  80162a:	50                   	push   %eax
+  80162b:	57                   	push   %edi
+  80162c:	e8 49 ff ff ff       	call   80157a <read>
+		if (m < 0)
+  801631:	83 c4 10             	add    $0x10,%esp
+  801634:	85 c0                	test   %eax,%eax
+  801636:	78 04                	js     80163c <readn+0x3b>
+			return m;
+		if (m == 0)
+  801638:	75 dd                	jne    801617 <readn+0x16>
+  80163a:	eb 02                	jmp    80163e <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80163c:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80163e:	89 d8                	mov    %ebx,%eax
+  801640:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801643:	5b                   	pop    %ebx
+  801644:	5e                   	pop    %esi
+  801645:	5f                   	pop    %edi
+  801646:	5d                   	pop    %ebp
+  801647:	c3                   	ret
+
+00801648 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801648:	55                   	push   %ebp
+  801649:	89 e5                	mov    %esp,%ebp
+  80164b:	56                   	push   %esi
+  80164c:	53                   	push   %ebx
+  80164d:	83 ec 18             	sub    $0x18,%esp
+  801650:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801653:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801656:	50                   	push   %eax
+  801657:	53                   	push   %ebx
+  801658:	e8 b7 fc ff ff       	call   801314 <fd_lookup>
+  80165d:	83 c4 10             	add    $0x10,%esp
+  801660:	85 c0                	test   %eax,%eax
+  801662:	78 37                	js     80169b <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801664:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801667:	83 ec 08             	sub    $0x8,%esp
+  80166a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80166d:	50                   	push   %eax
+  80166e:	ff 36                	push   (%esi)
+  801670:	e8 ef fc ff ff       	call   801364 <dev_lookup>
+  801675:	83 c4 10             	add    $0x10,%esp
+  801678:	85 c0                	test   %eax,%eax
+  80167a:	78 1f                	js     80169b <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80167c:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801680:	74 20                	je     8016a2 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801682:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801685:	8b 40 0c             	mov    0xc(%eax),%eax
+  801688:	85 c0                	test   %eax,%eax
+  80168a:	74 37                	je     8016c3 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80168c:	83 ec 04             	sub    $0x4,%esp
+  80168f:	ff 75 10             	push   0x10(%ebp)
+  801692:	ff 75 0c             	push   0xc(%ebp)
+  801695:	56                   	push   %esi
+  801696:	ff d0                	call   *%eax
+  801698:	83 c4 10             	add    $0x10,%esp
+}
+  80169b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80169e:	5b                   	pop    %ebx
+  80169f:	5e                   	pop    %esi
+  8016a0:	5d                   	pop    %ebp
+  8016a1:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8016a2:	a1 20 54 80 00       	mov    0x805420,%eax
+  8016a7:	8b 40 48             	mov    0x48(%eax),%eax
+  8016aa:	83 ec 04             	sub    $0x4,%esp
+  8016ad:	53                   	push   %ebx
+  8016ae:	50                   	push   %eax
+  8016af:	68 79 30 80 00       	push   $0x803079
+  8016b4:	e8 4f ec ff ff       	call   800308 <cprintf>
+		return -E_INVAL;
+  8016b9:	83 c4 10             	add    $0x10,%esp
+  8016bc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016c1:	eb d8                	jmp    80169b <write+0x53>
+		return -E_NOT_SUPP;
+  8016c3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016c8:	eb d1                	jmp    80169b <write+0x53>
+
+008016ca <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8016ca:	55                   	push   %ebp
+  8016cb:	89 e5                	mov    %esp,%ebp
+  8016cd:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8016d0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016d3:	50                   	push   %eax
+  8016d4:	ff 75 08             	push   0x8(%ebp)
+  8016d7:	e8 38 fc ff ff       	call   801314 <fd_lookup>
+  8016dc:	83 c4 10             	add    $0x10,%esp
+  8016df:	85 c0                	test   %eax,%eax
+  8016e1:	78 0e                	js     8016f1 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8016e3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8016e6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016e9:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8016ec:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8016f1:	c9                   	leave
+  8016f2:	c3                   	ret
+
+008016f3 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8016f3:	55                   	push   %ebp
+  8016f4:	89 e5                	mov    %esp,%ebp
+  8016f6:	56                   	push   %esi
+  8016f7:	53                   	push   %ebx
+  8016f8:	83 ec 18             	sub    $0x18,%esp
+  8016fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016fe:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801701:	50                   	push   %eax
+  801702:	53                   	push   %ebx
+  801703:	e8 0c fc ff ff       	call   801314 <fd_lookup>
+  801708:	83 c4 10             	add    $0x10,%esp
+  80170b:	85 c0                	test   %eax,%eax
+  80170d:	78 34                	js     801743 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80170f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801712:	83 ec 08             	sub    $0x8,%esp
+  801715:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801718:	50                   	push   %eax
+  801719:	ff 36                	push   (%esi)
+  80171b:	e8 44 fc ff ff       	call   801364 <dev_lookup>
+  801720:	83 c4 10             	add    $0x10,%esp
+  801723:	85 c0                	test   %eax,%eax
+  801725:	78 1c                	js     801743 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801727:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80172b:	74 1d                	je     80174a <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80172d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801730:	8b 40 18             	mov    0x18(%eax),%eax
+  801733:	85 c0                	test   %eax,%eax
+  801735:	74 34                	je     80176b <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801737:	83 ec 08             	sub    $0x8,%esp
+  80173a:	ff 75 0c             	push   0xc(%ebp)
+  80173d:	56                   	push   %esi
+  80173e:	ff d0                	call   *%eax
+  801740:	83 c4 10             	add    $0x10,%esp
+}
+  801743:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801746:	5b                   	pop    %ebx
+  801747:	5e                   	pop    %esi
+  801748:	5d                   	pop    %ebp
+  801749:	c3                   	ret
+			thisenv->env_id, fdnum);
+  80174a:	a1 20 54 80 00       	mov    0x805420,%eax
+  80174f:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801752:	83 ec 04             	sub    $0x4,%esp
+  801755:	53                   	push   %ebx
+  801756:	50                   	push   %eax
+  801757:	68 3c 30 80 00       	push   $0x80303c
+  80175c:	e8 a7 eb ff ff       	call   800308 <cprintf>
+		return -E_INVAL;
+  801761:	83 c4 10             	add    $0x10,%esp
+  801764:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801769:	eb d8                	jmp    801743 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  80176b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801770:	eb d1                	jmp    801743 <ftruncate+0x50>
+
+00801772 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801772:	55                   	push   %ebp
+  801773:	89 e5                	mov    %esp,%ebp
+  801775:	56                   	push   %esi
+  801776:	53                   	push   %ebx
+  801777:	83 ec 18             	sub    $0x18,%esp
+  80177a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80177d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801780:	50                   	push   %eax
+  801781:	ff 75 08             	push   0x8(%ebp)
+  801784:	e8 8b fb ff ff       	call   801314 <fd_lookup>
+  801789:	83 c4 10             	add    $0x10,%esp
+  80178c:	85 c0                	test   %eax,%eax
+  80178e:	78 49                	js     8017d9 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801790:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801793:	83 ec 08             	sub    $0x8,%esp
+  801796:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801799:	50                   	push   %eax
+  80179a:	ff 36                	push   (%esi)
+  80179c:	e8 c3 fb ff ff       	call   801364 <dev_lookup>
+  8017a1:	83 c4 10             	add    $0x10,%esp
+  8017a4:	85 c0                	test   %eax,%eax
+  8017a6:	78 31                	js     8017d9 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8017a8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017ab:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8017af:	74 2f                	je     8017e0 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8017b1:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8017b4:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8017bb:	00 00 00 
+	stat->st_isdir = 0;
+  8017be:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8017c5:	00 00 00 
+	stat->st_dev = dev;
+  8017c8:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8017ce:	83 ec 08             	sub    $0x8,%esp
+  8017d1:	53                   	push   %ebx
+  8017d2:	56                   	push   %esi
+  8017d3:	ff 50 14             	call   *0x14(%eax)
+  8017d6:	83 c4 10             	add    $0x10,%esp
+}
+  8017d9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017dc:	5b                   	pop    %ebx
+  8017dd:	5e                   	pop    %esi
+  8017de:	5d                   	pop    %ebp
+  8017df:	c3                   	ret
+		return -E_NOT_SUPP;
+  8017e0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017e5:	eb f2                	jmp    8017d9 <fstat+0x67>
+
+008017e7 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8017e7:	55                   	push   %ebp
+  8017e8:	89 e5                	mov    %esp,%ebp
+  8017ea:	56                   	push   %esi
+  8017eb:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8017ec:	83 ec 08             	sub    $0x8,%esp
+  8017ef:	6a 00                	push   $0x0
+  8017f1:	ff 75 08             	push   0x8(%ebp)
+  8017f4:	e8 e4 01 00 00       	call   8019dd <open>
+  8017f9:	89 c3                	mov    %eax,%ebx
+  8017fb:	83 c4 10             	add    $0x10,%esp
+  8017fe:	85 c0                	test   %eax,%eax
+  801800:	78 1b                	js     80181d <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801802:	83 ec 08             	sub    $0x8,%esp
+  801805:	ff 75 0c             	push   0xc(%ebp)
+  801808:	50                   	push   %eax
+  801809:	e8 64 ff ff ff       	call   801772 <fstat>
+  80180e:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801810:	89 1c 24             	mov    %ebx,(%esp)
+  801813:	e8 26 fc ff ff       	call   80143e <close>
+	return r;
+  801818:	83 c4 10             	add    $0x10,%esp
+  80181b:	89 f3                	mov    %esi,%ebx
+}
+  80181d:	89 d8                	mov    %ebx,%eax
+  80181f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801822:	5b                   	pop    %ebx
+  801823:	5e                   	pop    %esi
+  801824:	5d                   	pop    %ebp
+  801825:	c3                   	ret
+
+00801826 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  801826:	55                   	push   %ebp
+  801827:	89 e5                	mov    %esp,%ebp
+  801829:	56                   	push   %esi
+  80182a:	53                   	push   %ebx
+  80182b:	89 c6                	mov    %eax,%esi
+  80182d:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  80182f:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  801836:	74 27                	je     80185f <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801838:	6a 07                	push   $0x7
+  80183a:	68 00 60 80 00       	push   $0x806000
+  80183f:	56                   	push   %esi
+  801840:	ff 35 00 50 80 00    	push   0x805000
+  801846:	e8 b1 0c 00 00       	call   8024fc <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  80184b:	83 c4 0c             	add    $0xc,%esp
+  80184e:	6a 00                	push   $0x0
+  801850:	53                   	push   %ebx
+  801851:	6a 00                	push   $0x0
+  801853:	e8 30 0c 00 00       	call   802488 <ipc_recv>
+}
+  801858:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80185b:	5b                   	pop    %ebx
+  80185c:	5e                   	pop    %esi
+  80185d:	5d                   	pop    %ebp
+  80185e:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  80185f:	83 ec 0c             	sub    $0xc,%esp
+  801862:	6a 01                	push   $0x1
+  801864:	e8 e7 0c 00 00       	call   802550 <ipc_find_env>
+  801869:	a3 00 50 80 00       	mov    %eax,0x805000
+  80186e:	83 c4 10             	add    $0x10,%esp
+  801871:	eb c5                	jmp    801838 <fsipc+0x12>
+
+00801873 <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801873:	55                   	push   %ebp
+  801874:	89 e5                	mov    %esp,%ebp
+  801876:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801879:	8b 45 08             	mov    0x8(%ebp),%eax
+  80187c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80187f:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.set_size.req_size = newsize;
+  801884:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801887:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  80188c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801891:	b8 02 00 00 00       	mov    $0x2,%eax
+  801896:	e8 8b ff ff ff       	call   801826 <fsipc>
+}
+  80189b:	c9                   	leave
+  80189c:	c3                   	ret
+
+0080189d <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80189d:	55                   	push   %ebp
+  80189e:	89 e5                	mov    %esp,%ebp
+  8018a0:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8018a3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018a6:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018a9:	a3 00 60 80 00       	mov    %eax,0x806000
+  return fsipc(FSREQ_FLUSH, NULL);
+  8018ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018b3:	b8 06 00 00 00       	mov    $0x6,%eax
+  8018b8:	e8 69 ff ff ff       	call   801826 <fsipc>
+}
+  8018bd:	c9                   	leave
+  8018be:	c3                   	ret
+
+008018bf <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8018bf:	55                   	push   %ebp
+  8018c0:	89 e5                	mov    %esp,%ebp
+  8018c2:	53                   	push   %ebx
+  8018c3:	83 ec 04             	sub    $0x4,%esp
+  8018c6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8018c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018cc:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018cf:	a3 00 60 80 00       	mov    %eax,0x806000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8018d4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018d9:	b8 05 00 00 00       	mov    $0x5,%eax
+  8018de:	e8 43 ff ff ff       	call   801826 <fsipc>
+  8018e3:	85 c0                	test   %eax,%eax
+  8018e5:	78 2c                	js     801913 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8018e7:	83 ec 08             	sub    $0x8,%esp
+  8018ea:	68 00 60 80 00       	push   $0x806000
+  8018ef:	53                   	push   %ebx
+  8018f0:	e8 cc ef ff ff       	call   8008c1 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  8018f5:	a1 80 60 80 00       	mov    0x806080,%eax
+  8018fa:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801900:	a1 84 60 80 00       	mov    0x806084,%eax
+  801905:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  80190b:	83 c4 10             	add    $0x10,%esp
+  80190e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801913:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801916:	c9                   	leave
+  801917:	c3                   	ret
+
+00801918 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801918:	55                   	push   %ebp
+  801919:	89 e5                	mov    %esp,%ebp
+  80191b:	83 ec 0c             	sub    $0xc,%esp
+  80191e:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801921:	8b 55 08             	mov    0x8(%ebp),%edx
+  801924:	8b 52 0c             	mov    0xc(%edx),%edx
+  801927:	89 15 00 60 80 00    	mov    %edx,0x806000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80192d:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801932:	39 d0                	cmp    %edx,%eax
+  801934:	0f 47 c2             	cmova  %edx,%eax
+  801937:	a3 04 60 80 00       	mov    %eax,0x806004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  80193c:	50                   	push   %eax
+  80193d:	ff 75 0c             	push   0xc(%ebp)
+  801940:	68 08 60 80 00       	push   $0x806008
+  801945:	e8 fd f0 ff ff       	call   800a47 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  80194a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80194f:	b8 04 00 00 00       	mov    $0x4,%eax
+  801954:	e8 cd fe ff ff       	call   801826 <fsipc>
+}
+  801959:	c9                   	leave
+  80195a:	c3                   	ret
+
+0080195b <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80195b:	55                   	push   %ebp
+  80195c:	89 e5                	mov    %esp,%ebp
+  80195e:	56                   	push   %esi
+  80195f:	53                   	push   %ebx
+  801960:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801963:	8b 45 08             	mov    0x8(%ebp),%eax
+  801966:	8b 40 0c             	mov    0xc(%eax),%eax
+  801969:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read.req_n = n;
+  80196e:	89 35 04 60 80 00    	mov    %esi,0x806004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801974:	ba 00 00 00 00       	mov    $0x0,%edx
+  801979:	b8 03 00 00 00       	mov    $0x3,%eax
+  80197e:	e8 a3 fe ff ff       	call   801826 <fsipc>
+  801983:	89 c3                	mov    %eax,%ebx
+  801985:	85 c0                	test   %eax,%eax
+  801987:	78 1f                	js     8019a8 <devfile_read+0x4d>
+  assert(r <= n);
+  801989:	39 c6                	cmp    %eax,%esi
+  80198b:	72 24                	jb     8019b1 <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  80198d:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801992:	7f 33                	jg     8019c7 <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801994:	83 ec 04             	sub    $0x4,%esp
+  801997:	50                   	push   %eax
+  801998:	68 00 60 80 00       	push   $0x806000
+  80199d:	ff 75 0c             	push   0xc(%ebp)
+  8019a0:	e8 a2 f0 ff ff       	call   800a47 <memmove>
+  return r;
+  8019a5:	83 c4 10             	add    $0x10,%esp
+}
+  8019a8:	89 d8                	mov    %ebx,%eax
+  8019aa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019ad:	5b                   	pop    %ebx
+  8019ae:	5e                   	pop    %esi
+  8019af:	5d                   	pop    %ebp
+  8019b0:	c3                   	ret
+  assert(r <= n);
+  8019b1:	68 ac 30 80 00       	push   $0x8030ac
+  8019b6:	68 b3 30 80 00       	push   $0x8030b3
+  8019bb:	6a 78                	push   $0x78
+  8019bd:	68 c8 30 80 00       	push   $0x8030c8
+  8019c2:	e8 66 e8 ff ff       	call   80022d <_panic>
+  assert(r <= PGSIZE);
+  8019c7:	68 d3 30 80 00       	push   $0x8030d3
+  8019cc:	68 b3 30 80 00       	push   $0x8030b3
+  8019d1:	6a 79                	push   $0x79
+  8019d3:	68 c8 30 80 00       	push   $0x8030c8
+  8019d8:	e8 50 e8 ff ff       	call   80022d <_panic>
+
+008019dd <open>:
+open(const char *path, int mode) {
+  8019dd:	55                   	push   %ebp
+  8019de:	89 e5                	mov    %esp,%ebp
+  8019e0:	56                   	push   %esi
+  8019e1:	53                   	push   %ebx
+  8019e2:	83 ec 1c             	sub    $0x1c,%esp
+  8019e5:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  8019e8:	56                   	push   %esi
+  8019e9:	e8 98 ee ff ff       	call   800886 <strlen>
+  8019ee:	83 c4 10             	add    $0x10,%esp
+  8019f1:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8019f6:	7f 6c                	jg     801a64 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  8019f8:	83 ec 0c             	sub    $0xc,%esp
+  8019fb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019fe:	50                   	push   %eax
+  8019ff:	e8 ba f8 ff ff       	call   8012be <fd_alloc>
+  801a04:	89 c3                	mov    %eax,%ebx
+  801a06:	83 c4 10             	add    $0x10,%esp
+  801a09:	85 c0                	test   %eax,%eax
+  801a0b:	78 3c                	js     801a49 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801a0d:	83 ec 08             	sub    $0x8,%esp
+  801a10:	56                   	push   %esi
+  801a11:	68 00 60 80 00       	push   $0x806000
+  801a16:	e8 a6 ee ff ff       	call   8008c1 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801a1b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a1e:	a3 00 64 80 00       	mov    %eax,0x806400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801a23:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801a26:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a2b:	e8 f6 fd ff ff       	call   801826 <fsipc>
+  801a30:	89 c3                	mov    %eax,%ebx
+  801a32:	83 c4 10             	add    $0x10,%esp
+  801a35:	85 c0                	test   %eax,%eax
+  801a37:	78 19                	js     801a52 <open+0x75>
+  return fd2num(fd);
+  801a39:	83 ec 0c             	sub    $0xc,%esp
+  801a3c:	ff 75 f4             	push   -0xc(%ebp)
+  801a3f:	e8 53 f8 ff ff       	call   801297 <fd2num>
+  801a44:	89 c3                	mov    %eax,%ebx
+  801a46:	83 c4 10             	add    $0x10,%esp
+}
+  801a49:	89 d8                	mov    %ebx,%eax
+  801a4b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a4e:	5b                   	pop    %ebx
+  801a4f:	5e                   	pop    %esi
+  801a50:	5d                   	pop    %ebp
+  801a51:	c3                   	ret
+    fd_close(fd, 0);
+  801a52:	83 ec 08             	sub    $0x8,%esp
+  801a55:	6a 00                	push   $0x0
+  801a57:	ff 75 f4             	push   -0xc(%ebp)
+  801a5a:	e8 58 f9 ff ff       	call   8013b7 <fd_close>
+    return r;
+  801a5f:	83 c4 10             	add    $0x10,%esp
+  801a62:	eb e5                	jmp    801a49 <open+0x6c>
+    return -E_BAD_PATH;
+  801a64:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801a69:	eb de                	jmp    801a49 <open+0x6c>
+
+00801a6b <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  801a6b:	55                   	push   %ebp
+  801a6c:	89 e5                	mov    %esp,%ebp
+  801a6e:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801a71:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a76:	b8 08 00 00 00       	mov    $0x8,%eax
+  801a7b:	e8 a6 fd ff ff       	call   801826 <fsipc>
+}
+  801a80:	c9                   	leave
+  801a81:	c3                   	ret
+
+00801a82 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801a82:	55                   	push   %ebp
+  801a83:	89 e5                	mov    %esp,%ebp
+  801a85:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801a88:	68 df 30 80 00       	push   $0x8030df
+  801a8d:	ff 75 0c             	push   0xc(%ebp)
+  801a90:	e8 2c ee ff ff       	call   8008c1 <strcpy>
+	return 0;
+}
+  801a95:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a9a:	c9                   	leave
+  801a9b:	c3                   	ret
+
+00801a9c <devsock_close>:
+{
+  801a9c:	55                   	push   %ebp
+  801a9d:	89 e5                	mov    %esp,%ebp
+  801a9f:	53                   	push   %ebx
+  801aa0:	83 ec 10             	sub    $0x10,%esp
+  801aa3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801aa6:	53                   	push   %ebx
+  801aa7:	e8 e3 0a 00 00       	call   80258f <pageref>
+  801aac:	89 c2                	mov    %eax,%edx
+  801aae:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801ab1:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801ab6:	83 fa 01             	cmp    $0x1,%edx
+  801ab9:	74 05                	je     801ac0 <devsock_close+0x24>
+}
+  801abb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801abe:	c9                   	leave
+  801abf:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801ac0:	83 ec 0c             	sub    $0xc,%esp
+  801ac3:	ff 73 0c             	push   0xc(%ebx)
+  801ac6:	e8 b7 02 00 00       	call   801d82 <nsipc_close>
+  801acb:	83 c4 10             	add    $0x10,%esp
+  801ace:	eb eb                	jmp    801abb <devsock_close+0x1f>
+
+00801ad0 <devsock_write>:
+{
+  801ad0:	55                   	push   %ebp
+  801ad1:	89 e5                	mov    %esp,%ebp
+  801ad3:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801ad6:	6a 00                	push   $0x0
+  801ad8:	ff 75 10             	push   0x10(%ebp)
+  801adb:	ff 75 0c             	push   0xc(%ebp)
+  801ade:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ae1:	ff 70 0c             	push   0xc(%eax)
+  801ae4:	e8 79 03 00 00       	call   801e62 <nsipc_send>
+}
+  801ae9:	c9                   	leave
+  801aea:	c3                   	ret
+
+00801aeb <devsock_read>:
+{
+  801aeb:	55                   	push   %ebp
+  801aec:	89 e5                	mov    %esp,%ebp
+  801aee:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801af1:	6a 00                	push   $0x0
+  801af3:	ff 75 10             	push   0x10(%ebp)
+  801af6:	ff 75 0c             	push   0xc(%ebp)
+  801af9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801afc:	ff 70 0c             	push   0xc(%eax)
+  801aff:	e8 ef 02 00 00       	call   801df3 <nsipc_recv>
+}
+  801b04:	c9                   	leave
+  801b05:	c3                   	ret
+
+00801b06 <fd2sockid>:
+{
+  801b06:	55                   	push   %ebp
+  801b07:	89 e5                	mov    %esp,%ebp
+  801b09:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801b0c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801b0f:	52                   	push   %edx
+  801b10:	50                   	push   %eax
+  801b11:	e8 fe f7 ff ff       	call   801314 <fd_lookup>
+  801b16:	83 c4 10             	add    $0x10,%esp
+  801b19:	85 c0                	test   %eax,%eax
+  801b1b:	78 10                	js     801b2d <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801b1d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b20:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  801b26:	39 08                	cmp    %ecx,(%eax)
+  801b28:	75 05                	jne    801b2f <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801b2a:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801b2d:	c9                   	leave
+  801b2e:	c3                   	ret
+		return -E_NOT_SUPP;
+  801b2f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b34:	eb f7                	jmp    801b2d <fd2sockid+0x27>
+
+00801b36 <alloc_sockfd>:
+{
+  801b36:	55                   	push   %ebp
+  801b37:	89 e5                	mov    %esp,%ebp
+  801b39:	56                   	push   %esi
+  801b3a:	53                   	push   %ebx
+  801b3b:	83 ec 1c             	sub    $0x1c,%esp
+  801b3e:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801b40:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b43:	50                   	push   %eax
+  801b44:	e8 75 f7 ff ff       	call   8012be <fd_alloc>
+  801b49:	89 c3                	mov    %eax,%ebx
+  801b4b:	83 c4 10             	add    $0x10,%esp
+  801b4e:	85 c0                	test   %eax,%eax
+  801b50:	78 43                	js     801b95 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801b52:	83 ec 04             	sub    $0x4,%esp
+  801b55:	68 07 04 00 00       	push   $0x407
+  801b5a:	ff 75 f4             	push   -0xc(%ebp)
+  801b5d:	6a 00                	push   $0x0
+  801b5f:	e8 49 f1 ff ff       	call   800cad <sys_page_alloc>
+  801b64:	89 c3                	mov    %eax,%ebx
+  801b66:	83 c4 10             	add    $0x10,%esp
+  801b69:	85 c0                	test   %eax,%eax
+  801b6b:	78 28                	js     801b95 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801b6d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b70:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801b76:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801b78:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b7b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801b82:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801b85:	83 ec 0c             	sub    $0xc,%esp
+  801b88:	50                   	push   %eax
+  801b89:	e8 09 f7 ff ff       	call   801297 <fd2num>
+  801b8e:	89 c3                	mov    %eax,%ebx
+  801b90:	83 c4 10             	add    $0x10,%esp
+  801b93:	eb 0c                	jmp    801ba1 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801b95:	83 ec 0c             	sub    $0xc,%esp
+  801b98:	56                   	push   %esi
+  801b99:	e8 e4 01 00 00       	call   801d82 <nsipc_close>
+		return r;
+  801b9e:	83 c4 10             	add    $0x10,%esp
+}
+  801ba1:	89 d8                	mov    %ebx,%eax
+  801ba3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ba6:	5b                   	pop    %ebx
+  801ba7:	5e                   	pop    %esi
+  801ba8:	5d                   	pop    %ebp
+  801ba9:	c3                   	ret
+
+00801baa <accept>:
+{
+  801baa:	55                   	push   %ebp
+  801bab:	89 e5                	mov    %esp,%ebp
+  801bad:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801bb0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bb3:	e8 4e ff ff ff       	call   801b06 <fd2sockid>
+  801bb8:	85 c0                	test   %eax,%eax
+  801bba:	78 1b                	js     801bd7 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801bbc:	83 ec 04             	sub    $0x4,%esp
+  801bbf:	ff 75 10             	push   0x10(%ebp)
+  801bc2:	ff 75 0c             	push   0xc(%ebp)
+  801bc5:	50                   	push   %eax
+  801bc6:	e8 0e 01 00 00       	call   801cd9 <nsipc_accept>
+  801bcb:	83 c4 10             	add    $0x10,%esp
+  801bce:	85 c0                	test   %eax,%eax
+  801bd0:	78 05                	js     801bd7 <accept+0x2d>
+	return alloc_sockfd(r);
+  801bd2:	e8 5f ff ff ff       	call   801b36 <alloc_sockfd>
+}
+  801bd7:	c9                   	leave
+  801bd8:	c3                   	ret
+
+00801bd9 <bind>:
+{
+  801bd9:	55                   	push   %ebp
+  801bda:	89 e5                	mov    %esp,%ebp
+  801bdc:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801bdf:	8b 45 08             	mov    0x8(%ebp),%eax
+  801be2:	e8 1f ff ff ff       	call   801b06 <fd2sockid>
+  801be7:	85 c0                	test   %eax,%eax
+  801be9:	78 12                	js     801bfd <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801beb:	83 ec 04             	sub    $0x4,%esp
+  801bee:	ff 75 10             	push   0x10(%ebp)
+  801bf1:	ff 75 0c             	push   0xc(%ebp)
+  801bf4:	50                   	push   %eax
+  801bf5:	e8 31 01 00 00       	call   801d2b <nsipc_bind>
+  801bfa:	83 c4 10             	add    $0x10,%esp
+}
+  801bfd:	c9                   	leave
+  801bfe:	c3                   	ret
+
+00801bff <shutdown>:
+{
+  801bff:	55                   	push   %ebp
+  801c00:	89 e5                	mov    %esp,%ebp
+  801c02:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801c05:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c08:	e8 f9 fe ff ff       	call   801b06 <fd2sockid>
+  801c0d:	85 c0                	test   %eax,%eax
+  801c0f:	78 0f                	js     801c20 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801c11:	83 ec 08             	sub    $0x8,%esp
+  801c14:	ff 75 0c             	push   0xc(%ebp)
+  801c17:	50                   	push   %eax
+  801c18:	e8 43 01 00 00       	call   801d60 <nsipc_shutdown>
+  801c1d:	83 c4 10             	add    $0x10,%esp
+}
+  801c20:	c9                   	leave
+  801c21:	c3                   	ret
+
+00801c22 <connect>:
+{
+  801c22:	55                   	push   %ebp
+  801c23:	89 e5                	mov    %esp,%ebp
+  801c25:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801c28:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c2b:	e8 d6 fe ff ff       	call   801b06 <fd2sockid>
+  801c30:	85 c0                	test   %eax,%eax
+  801c32:	78 12                	js     801c46 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801c34:	83 ec 04             	sub    $0x4,%esp
+  801c37:	ff 75 10             	push   0x10(%ebp)
+  801c3a:	ff 75 0c             	push   0xc(%ebp)
+  801c3d:	50                   	push   %eax
+  801c3e:	e8 59 01 00 00       	call   801d9c <nsipc_connect>
+  801c43:	83 c4 10             	add    $0x10,%esp
+}
+  801c46:	c9                   	leave
+  801c47:	c3                   	ret
+
+00801c48 <listen>:
+{
+  801c48:	55                   	push   %ebp
+  801c49:	89 e5                	mov    %esp,%ebp
+  801c4b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801c4e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c51:	e8 b0 fe ff ff       	call   801b06 <fd2sockid>
+  801c56:	85 c0                	test   %eax,%eax
+  801c58:	78 0f                	js     801c69 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801c5a:	83 ec 08             	sub    $0x8,%esp
+  801c5d:	ff 75 0c             	push   0xc(%ebp)
+  801c60:	50                   	push   %eax
+  801c61:	e8 6b 01 00 00       	call   801dd1 <nsipc_listen>
+  801c66:	83 c4 10             	add    $0x10,%esp
+}
+  801c69:	c9                   	leave
+  801c6a:	c3                   	ret
+
+00801c6b <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801c6b:	55                   	push   %ebp
+  801c6c:	89 e5                	mov    %esp,%ebp
+  801c6e:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801c71:	ff 75 10             	push   0x10(%ebp)
+  801c74:	ff 75 0c             	push   0xc(%ebp)
+  801c77:	ff 75 08             	push   0x8(%ebp)
+  801c7a:	e8 41 02 00 00       	call   801ec0 <nsipc_socket>
+  801c7f:	83 c4 10             	add    $0x10,%esp
+  801c82:	85 c0                	test   %eax,%eax
+  801c84:	78 05                	js     801c8b <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801c86:	e8 ab fe ff ff       	call   801b36 <alloc_sockfd>
+}
+  801c8b:	c9                   	leave
+  801c8c:	c3                   	ret
+
+00801c8d <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801c8d:	55                   	push   %ebp
+  801c8e:	89 e5                	mov    %esp,%ebp
+  801c90:	53                   	push   %ebx
+  801c91:	83 ec 04             	sub    $0x4,%esp
+  801c94:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801c96:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  801c9d:	74 26                	je     801cc5 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801c9f:	6a 07                	push   $0x7
+  801ca1:	68 00 70 80 00       	push   $0x807000
+  801ca6:	53                   	push   %ebx
+  801ca7:	ff 35 04 50 80 00    	push   0x805004
+  801cad:	e8 4a 08 00 00       	call   8024fc <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801cb2:	83 c4 0c             	add    $0xc,%esp
+  801cb5:	6a 00                	push   $0x0
+  801cb7:	6a 00                	push   $0x0
+  801cb9:	6a 00                	push   $0x0
+  801cbb:	e8 c8 07 00 00       	call   802488 <ipc_recv>
+}
+  801cc0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cc3:	c9                   	leave
+  801cc4:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801cc5:	83 ec 0c             	sub    $0xc,%esp
+  801cc8:	6a 02                	push   $0x2
+  801cca:	e8 81 08 00 00       	call   802550 <ipc_find_env>
+  801ccf:	a3 04 50 80 00       	mov    %eax,0x805004
+  801cd4:	83 c4 10             	add    $0x10,%esp
+  801cd7:	eb c6                	jmp    801c9f <nsipc+0x12>
+
+00801cd9 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801cd9:	55                   	push   %ebp
+  801cda:	89 e5                	mov    %esp,%ebp
+  801cdc:	56                   	push   %esi
+  801cdd:	53                   	push   %ebx
+  801cde:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801ce1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ce4:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801ce9:	8b 06                	mov    (%esi),%eax
+  801ceb:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801cf0:	b8 01 00 00 00       	mov    $0x1,%eax
+  801cf5:	e8 93 ff ff ff       	call   801c8d <nsipc>
+  801cfa:	89 c3                	mov    %eax,%ebx
+  801cfc:	85 c0                	test   %eax,%eax
+  801cfe:	79 09                	jns    801d09 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801d00:	89 d8                	mov    %ebx,%eax
+  801d02:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d05:	5b                   	pop    %ebx
+  801d06:	5e                   	pop    %esi
+  801d07:	5d                   	pop    %ebp
+  801d08:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801d09:	83 ec 04             	sub    $0x4,%esp
+  801d0c:	ff 35 10 70 80 00    	push   0x807010
+  801d12:	68 00 70 80 00       	push   $0x807000
+  801d17:	ff 75 0c             	push   0xc(%ebp)
+  801d1a:	e8 28 ed ff ff       	call   800a47 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801d1f:	a1 10 70 80 00       	mov    0x807010,%eax
+  801d24:	89 06                	mov    %eax,(%esi)
+  801d26:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801d29:	eb d5                	jmp    801d00 <nsipc_accept+0x27>
+
+00801d2b <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801d2b:	55                   	push   %ebp
+  801d2c:	89 e5                	mov    %esp,%ebp
+  801d2e:	53                   	push   %ebx
+  801d2f:	83 ec 08             	sub    $0x8,%esp
+  801d32:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801d35:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d38:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801d3d:	53                   	push   %ebx
+  801d3e:	ff 75 0c             	push   0xc(%ebp)
+  801d41:	68 04 70 80 00       	push   $0x807004
+  801d46:	e8 fc ec ff ff       	call   800a47 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801d4b:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  801d51:	b8 02 00 00 00       	mov    $0x2,%eax
+  801d56:	e8 32 ff ff ff       	call   801c8d <nsipc>
+}
+  801d5b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d5e:	c9                   	leave
+  801d5f:	c3                   	ret
+
+00801d60 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801d60:	55                   	push   %ebp
+  801d61:	89 e5                	mov    %esp,%ebp
+  801d63:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801d66:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d69:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  801d6e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d71:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  801d76:	b8 03 00 00 00       	mov    $0x3,%eax
+  801d7b:	e8 0d ff ff ff       	call   801c8d <nsipc>
+}
+  801d80:	c9                   	leave
+  801d81:	c3                   	ret
+
+00801d82 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801d82:	55                   	push   %ebp
+  801d83:	89 e5                	mov    %esp,%ebp
+  801d85:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801d88:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d8b:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  801d90:	b8 04 00 00 00       	mov    $0x4,%eax
+  801d95:	e8 f3 fe ff ff       	call   801c8d <nsipc>
+}
+  801d9a:	c9                   	leave
+  801d9b:	c3                   	ret
+
+00801d9c <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801d9c:	55                   	push   %ebp
+  801d9d:	89 e5                	mov    %esp,%ebp
+  801d9f:	53                   	push   %ebx
+  801da0:	83 ec 08             	sub    $0x8,%esp
+  801da3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801da6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801da9:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801dae:	53                   	push   %ebx
+  801daf:	ff 75 0c             	push   0xc(%ebp)
+  801db2:	68 04 70 80 00       	push   $0x807004
+  801db7:	e8 8b ec ff ff       	call   800a47 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801dbc:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  801dc2:	b8 05 00 00 00       	mov    $0x5,%eax
+  801dc7:	e8 c1 fe ff ff       	call   801c8d <nsipc>
+}
+  801dcc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801dcf:	c9                   	leave
+  801dd0:	c3                   	ret
+
+00801dd1 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801dd1:	55                   	push   %ebp
+  801dd2:	89 e5                	mov    %esp,%ebp
+  801dd4:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801dd7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dda:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  801ddf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801de2:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  801de7:	b8 06 00 00 00       	mov    $0x6,%eax
+  801dec:	e8 9c fe ff ff       	call   801c8d <nsipc>
+}
+  801df1:	c9                   	leave
+  801df2:	c3                   	ret
+
+00801df3 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801df3:	55                   	push   %ebp
+  801df4:	89 e5                	mov    %esp,%ebp
+  801df6:	56                   	push   %esi
+  801df7:	53                   	push   %ebx
+  801df8:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801dfb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dfe:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  801e03:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  801e09:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e0c:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801e11:	b8 07 00 00 00       	mov    $0x7,%eax
+  801e16:	e8 72 fe ff ff       	call   801c8d <nsipc>
+  801e1b:	89 c3                	mov    %eax,%ebx
+  801e1d:	85 c0                	test   %eax,%eax
+  801e1f:	78 22                	js     801e43 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801e21:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801e26:	39 c6                	cmp    %eax,%esi
+  801e28:	0f 4e c6             	cmovle %esi,%eax
+  801e2b:	39 c3                	cmp    %eax,%ebx
+  801e2d:	7f 1d                	jg     801e4c <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801e2f:	83 ec 04             	sub    $0x4,%esp
+  801e32:	53                   	push   %ebx
+  801e33:	68 00 70 80 00       	push   $0x807000
+  801e38:	ff 75 0c             	push   0xc(%ebp)
+  801e3b:	e8 07 ec ff ff       	call   800a47 <memmove>
+  801e40:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801e43:	89 d8                	mov    %ebx,%eax
+  801e45:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e48:	5b                   	pop    %ebx
+  801e49:	5e                   	pop    %esi
+  801e4a:	5d                   	pop    %ebp
+  801e4b:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801e4c:	68 eb 30 80 00       	push   $0x8030eb
+  801e51:	68 b3 30 80 00       	push   $0x8030b3
+  801e56:	6a 62                	push   $0x62
+  801e58:	68 00 31 80 00       	push   $0x803100
+  801e5d:	e8 cb e3 ff ff       	call   80022d <_panic>
+
+00801e62 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801e62:	55                   	push   %ebp
+  801e63:	89 e5                	mov    %esp,%ebp
+  801e65:	53                   	push   %ebx
+  801e66:	83 ec 04             	sub    $0x4,%esp
+  801e69:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801e6c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e6f:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  801e74:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801e7a:	7f 2e                	jg     801eaa <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801e7c:	83 ec 04             	sub    $0x4,%esp
+  801e7f:	53                   	push   %ebx
+  801e80:	ff 75 0c             	push   0xc(%ebp)
+  801e83:	68 0c 70 80 00       	push   $0x80700c
+  801e88:	e8 ba eb ff ff       	call   800a47 <memmove>
+	nsipcbuf.send.req_size = size;
+  801e8d:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  801e93:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e96:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  801e9b:	b8 08 00 00 00       	mov    $0x8,%eax
+  801ea0:	e8 e8 fd ff ff       	call   801c8d <nsipc>
+}
+  801ea5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ea8:	c9                   	leave
+  801ea9:	c3                   	ret
+	assert(size < 1600);
+  801eaa:	68 0c 31 80 00       	push   $0x80310c
+  801eaf:	68 b3 30 80 00       	push   $0x8030b3
+  801eb4:	6a 6d                	push   $0x6d
+  801eb6:	68 00 31 80 00       	push   $0x803100
+  801ebb:	e8 6d e3 ff ff       	call   80022d <_panic>
+
+00801ec0 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801ec0:	55                   	push   %ebp
+  801ec1:	89 e5                	mov    %esp,%ebp
+  801ec3:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801ec6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ec9:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  801ece:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ed1:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  801ed6:	8b 45 10             	mov    0x10(%ebp),%eax
+  801ed9:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  801ede:	b8 09 00 00 00       	mov    $0x9,%eax
+  801ee3:	e8 a5 fd ff ff       	call   801c8d <nsipc>
+}
+  801ee8:	c9                   	leave
+  801ee9:	c3                   	ret
+
+00801eea <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801eea:	55                   	push   %ebp
+  801eeb:	89 e5                	mov    %esp,%ebp
+  801eed:	56                   	push   %esi
+  801eee:	53                   	push   %ebx
+  801eef:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801ef2:	83 ec 0c             	sub    $0xc,%esp
+  801ef5:	ff 75 08             	push   0x8(%ebp)
+  801ef8:	e8 aa f3 ff ff       	call   8012a7 <fd2data>
+  801efd:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801eff:	83 c4 08             	add    $0x8,%esp
+  801f02:	68 18 31 80 00       	push   $0x803118
+  801f07:	53                   	push   %ebx
+  801f08:	e8 b4 e9 ff ff       	call   8008c1 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801f0d:	8b 46 04             	mov    0x4(%esi),%eax
+  801f10:	2b 06                	sub    (%esi),%eax
+  801f12:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  801f18:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801f1f:	00 00 00 
+	stat->st_dev = &devpipe;
+  801f22:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  801f29:	40 80 00 
+	return 0;
+}
+  801f2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f31:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f34:	5b                   	pop    %ebx
+  801f35:	5e                   	pop    %esi
+  801f36:	5d                   	pop    %ebp
+  801f37:	c3                   	ret
+
+00801f38 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801f38:	55                   	push   %ebp
+  801f39:	89 e5                	mov    %esp,%ebp
+  801f3b:	53                   	push   %ebx
+  801f3c:	83 ec 0c             	sub    $0xc,%esp
+  801f3f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801f42:	53                   	push   %ebx
+  801f43:	6a 00                	push   $0x0
+  801f45:	e8 e8 ed ff ff       	call   800d32 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801f4a:	89 1c 24             	mov    %ebx,(%esp)
+  801f4d:	e8 55 f3 ff ff       	call   8012a7 <fd2data>
+  801f52:	83 c4 08             	add    $0x8,%esp
+  801f55:	50                   	push   %eax
+  801f56:	6a 00                	push   $0x0
+  801f58:	e8 d5 ed ff ff       	call   800d32 <sys_page_unmap>
+}
+  801f5d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f60:	c9                   	leave
+  801f61:	c3                   	ret
+
+00801f62 <_pipeisclosed>:
+{
+  801f62:	55                   	push   %ebp
+  801f63:	89 e5                	mov    %esp,%ebp
+  801f65:	57                   	push   %edi
+  801f66:	56                   	push   %esi
+  801f67:	53                   	push   %ebx
+  801f68:	83 ec 1c             	sub    $0x1c,%esp
+  801f6b:	89 c7                	mov    %eax,%edi
+  801f6d:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801f6f:	a1 20 54 80 00       	mov    0x805420,%eax
+  801f74:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801f77:	83 ec 0c             	sub    $0xc,%esp
+  801f7a:	57                   	push   %edi
+  801f7b:	e8 0f 06 00 00       	call   80258f <pageref>
+  801f80:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801f83:	89 34 24             	mov    %esi,(%esp)
+  801f86:	e8 04 06 00 00       	call   80258f <pageref>
+		nn = thisenv->env_runs;
+  801f8b:	8b 15 20 54 80 00    	mov    0x805420,%edx
+  801f91:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801f94:	83 c4 10             	add    $0x10,%esp
+  801f97:	39 cb                	cmp    %ecx,%ebx
+  801f99:	74 1b                	je     801fb6 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801f9b:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801f9e:	75 cf                	jne    801f6f <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801fa0:	8b 42 58             	mov    0x58(%edx),%eax
+  801fa3:	6a 01                	push   $0x1
+  801fa5:	50                   	push   %eax
+  801fa6:	53                   	push   %ebx
+  801fa7:	68 1f 31 80 00       	push   $0x80311f
+  801fac:	e8 57 e3 ff ff       	call   800308 <cprintf>
+  801fb1:	83 c4 10             	add    $0x10,%esp
+  801fb4:	eb b9                	jmp    801f6f <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801fb6:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801fb9:	0f 94 c0             	sete   %al
+  801fbc:	0f b6 c0             	movzbl %al,%eax
+}
+  801fbf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fc2:	5b                   	pop    %ebx
+  801fc3:	5e                   	pop    %esi
+  801fc4:	5f                   	pop    %edi
+  801fc5:	5d                   	pop    %ebp
+  801fc6:	c3                   	ret
+
+00801fc7 <devpipe_write>:
+{
+  801fc7:	55                   	push   %ebp
+  801fc8:	89 e5                	mov    %esp,%ebp
+  801fca:	57                   	push   %edi
+  801fcb:	56                   	push   %esi
+  801fcc:	53                   	push   %ebx
+  801fcd:	83 ec 28             	sub    $0x28,%esp
+  801fd0:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801fd3:	56                   	push   %esi
+  801fd4:	e8 ce f2 ff ff       	call   8012a7 <fd2data>
+  801fd9:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801fdb:	83 c4 10             	add    $0x10,%esp
+  801fde:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fe3:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801fe6:	75 09                	jne    801ff1 <devpipe_write+0x2a>
+	return i;
+  801fe8:	89 f8                	mov    %edi,%eax
+  801fea:	eb 23                	jmp    80200f <devpipe_write+0x48>
+			sys_yield();
+  801fec:	e8 9d ec ff ff       	call   800c8e <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801ff1:	8b 43 04             	mov    0x4(%ebx),%eax
+  801ff4:	8b 0b                	mov    (%ebx),%ecx
+  801ff6:	8d 51 20             	lea    0x20(%ecx),%edx
+  801ff9:	39 d0                	cmp    %edx,%eax
+  801ffb:	72 1a                	jb     802017 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  801ffd:	89 da                	mov    %ebx,%edx
+  801fff:	89 f0                	mov    %esi,%eax
+  802001:	e8 5c ff ff ff       	call   801f62 <_pipeisclosed>
+  802006:	85 c0                	test   %eax,%eax
+  802008:	74 e2                	je     801fec <devpipe_write+0x25>
+				return 0;
+  80200a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80200f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802012:	5b                   	pop    %ebx
+  802013:	5e                   	pop    %esi
+  802014:	5f                   	pop    %edi
+  802015:	5d                   	pop    %ebp
+  802016:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802017:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80201a:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  80201e:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802021:	89 c2                	mov    %eax,%edx
+  802023:	c1 fa 1f             	sar    $0x1f,%edx
+  802026:	89 d1                	mov    %edx,%ecx
+  802028:	c1 e9 1b             	shr    $0x1b,%ecx
+  80202b:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80202e:	83 e2 1f             	and    $0x1f,%edx
+  802031:	29 ca                	sub    %ecx,%edx
+  802033:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802037:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  80203b:	83 c0 01             	add    $0x1,%eax
+  80203e:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802041:	83 c7 01             	add    $0x1,%edi
+  802044:	eb 9d                	jmp    801fe3 <devpipe_write+0x1c>
+
+00802046 <devpipe_read>:
+{
+  802046:	55                   	push   %ebp
+  802047:	89 e5                	mov    %esp,%ebp
+  802049:	57                   	push   %edi
+  80204a:	56                   	push   %esi
+  80204b:	53                   	push   %ebx
+  80204c:	83 ec 18             	sub    $0x18,%esp
+  80204f:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802052:	57                   	push   %edi
+  802053:	e8 4f f2 ff ff       	call   8012a7 <fd2data>
+  802058:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80205a:	83 c4 10             	add    $0x10,%esp
+  80205d:	be 00 00 00 00       	mov    $0x0,%esi
+  802062:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802065:	75 13                	jne    80207a <devpipe_read+0x34>
+	return i;
+  802067:	89 f0                	mov    %esi,%eax
+  802069:	eb 02                	jmp    80206d <devpipe_read+0x27>
+				return i;
+  80206b:	89 f0                	mov    %esi,%eax
+}
+  80206d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802070:	5b                   	pop    %ebx
+  802071:	5e                   	pop    %esi
+  802072:	5f                   	pop    %edi
+  802073:	5d                   	pop    %ebp
+  802074:	c3                   	ret
+			sys_yield();
+  802075:	e8 14 ec ff ff       	call   800c8e <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  80207a:	8b 03                	mov    (%ebx),%eax
+  80207c:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80207f:	75 18                	jne    802099 <devpipe_read+0x53>
+			if (i > 0)
+  802081:	85 f6                	test   %esi,%esi
+  802083:	75 e6                	jne    80206b <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802085:	89 da                	mov    %ebx,%edx
+  802087:	89 f8                	mov    %edi,%eax
+  802089:	e8 d4 fe ff ff       	call   801f62 <_pipeisclosed>
+  80208e:	85 c0                	test   %eax,%eax
+  802090:	74 e3                	je     802075 <devpipe_read+0x2f>
+				return 0;
+  802092:	b8 00 00 00 00       	mov    $0x0,%eax
+  802097:	eb d4                	jmp    80206d <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802099:	99                   	cltd
+  80209a:	c1 ea 1b             	shr    $0x1b,%edx
+  80209d:	01 d0                	add    %edx,%eax
+  80209f:	83 e0 1f             	and    $0x1f,%eax
+  8020a2:	29 d0                	sub    %edx,%eax
+  8020a4:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8020a9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8020ac:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8020af:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8020b2:	83 c6 01             	add    $0x1,%esi
+  8020b5:	eb ab                	jmp    802062 <devpipe_read+0x1c>
+
+008020b7 <pipe>:
+{
+  8020b7:	55                   	push   %ebp
+  8020b8:	89 e5                	mov    %esp,%ebp
+  8020ba:	56                   	push   %esi
+  8020bb:	53                   	push   %ebx
+  8020bc:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8020bf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020c2:	50                   	push   %eax
+  8020c3:	e8 f6 f1 ff ff       	call   8012be <fd_alloc>
+  8020c8:	89 c3                	mov    %eax,%ebx
+  8020ca:	83 c4 10             	add    $0x10,%esp
+  8020cd:	85 c0                	test   %eax,%eax
+  8020cf:	0f 88 23 01 00 00    	js     8021f8 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8020d5:	83 ec 04             	sub    $0x4,%esp
+  8020d8:	68 07 04 00 00       	push   $0x407
+  8020dd:	ff 75 f4             	push   -0xc(%ebp)
+  8020e0:	6a 00                	push   $0x0
+  8020e2:	e8 c6 eb ff ff       	call   800cad <sys_page_alloc>
+  8020e7:	89 c3                	mov    %eax,%ebx
+  8020e9:	83 c4 10             	add    $0x10,%esp
+  8020ec:	85 c0                	test   %eax,%eax
+  8020ee:	0f 88 04 01 00 00    	js     8021f8 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8020f4:	83 ec 0c             	sub    $0xc,%esp
+  8020f7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8020fa:	50                   	push   %eax
+  8020fb:	e8 be f1 ff ff       	call   8012be <fd_alloc>
+  802100:	89 c3                	mov    %eax,%ebx
+  802102:	83 c4 10             	add    $0x10,%esp
+  802105:	85 c0                	test   %eax,%eax
+  802107:	0f 88 db 00 00 00    	js     8021e8 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80210d:	83 ec 04             	sub    $0x4,%esp
+  802110:	68 07 04 00 00       	push   $0x407
+  802115:	ff 75 f0             	push   -0x10(%ebp)
+  802118:	6a 00                	push   $0x0
+  80211a:	e8 8e eb ff ff       	call   800cad <sys_page_alloc>
+  80211f:	89 c3                	mov    %eax,%ebx
+  802121:	83 c4 10             	add    $0x10,%esp
+  802124:	85 c0                	test   %eax,%eax
+  802126:	0f 88 bc 00 00 00    	js     8021e8 <pipe+0x131>
+	va = fd2data(fd0);
+  80212c:	83 ec 0c             	sub    $0xc,%esp
+  80212f:	ff 75 f4             	push   -0xc(%ebp)
+  802132:	e8 70 f1 ff ff       	call   8012a7 <fd2data>
+  802137:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802139:	83 c4 0c             	add    $0xc,%esp
+  80213c:	68 07 04 00 00       	push   $0x407
+  802141:	50                   	push   %eax
+  802142:	6a 00                	push   $0x0
+  802144:	e8 64 eb ff ff       	call   800cad <sys_page_alloc>
+  802149:	89 c3                	mov    %eax,%ebx
+  80214b:	83 c4 10             	add    $0x10,%esp
+  80214e:	85 c0                	test   %eax,%eax
+  802150:	0f 88 82 00 00 00    	js     8021d8 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802156:	83 ec 0c             	sub    $0xc,%esp
+  802159:	ff 75 f0             	push   -0x10(%ebp)
+  80215c:	e8 46 f1 ff ff       	call   8012a7 <fd2data>
+  802161:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802168:	50                   	push   %eax
+  802169:	6a 00                	push   $0x0
+  80216b:	56                   	push   %esi
+  80216c:	6a 00                	push   $0x0
+  80216e:	e8 7d eb ff ff       	call   800cf0 <sys_page_map>
+  802173:	89 c3                	mov    %eax,%ebx
+  802175:	83 c4 20             	add    $0x20,%esp
+  802178:	85 c0                	test   %eax,%eax
+  80217a:	78 4e                	js     8021ca <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80217c:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  802181:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802184:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802186:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802189:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802190:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802193:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802195:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802198:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80219f:	83 ec 0c             	sub    $0xc,%esp
+  8021a2:	ff 75 f4             	push   -0xc(%ebp)
+  8021a5:	e8 ed f0 ff ff       	call   801297 <fd2num>
+  8021aa:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8021ad:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8021af:	83 c4 04             	add    $0x4,%esp
+  8021b2:	ff 75 f0             	push   -0x10(%ebp)
+  8021b5:	e8 dd f0 ff ff       	call   801297 <fd2num>
+  8021ba:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8021bd:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8021c0:	83 c4 10             	add    $0x10,%esp
+  8021c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8021c8:	eb 2e                	jmp    8021f8 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8021ca:	83 ec 08             	sub    $0x8,%esp
+  8021cd:	56                   	push   %esi
+  8021ce:	6a 00                	push   $0x0
+  8021d0:	e8 5d eb ff ff       	call   800d32 <sys_page_unmap>
+  8021d5:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8021d8:	83 ec 08             	sub    $0x8,%esp
+  8021db:	ff 75 f0             	push   -0x10(%ebp)
+  8021de:	6a 00                	push   $0x0
+  8021e0:	e8 4d eb ff ff       	call   800d32 <sys_page_unmap>
+  8021e5:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8021e8:	83 ec 08             	sub    $0x8,%esp
+  8021eb:	ff 75 f4             	push   -0xc(%ebp)
+  8021ee:	6a 00                	push   $0x0
+  8021f0:	e8 3d eb ff ff       	call   800d32 <sys_page_unmap>
+  8021f5:	83 c4 10             	add    $0x10,%esp
+}
+  8021f8:	89 d8                	mov    %ebx,%eax
+  8021fa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021fd:	5b                   	pop    %ebx
+  8021fe:	5e                   	pop    %esi
+  8021ff:	5d                   	pop    %ebp
+  802200:	c3                   	ret
+
+00802201 <pipeisclosed>:
+{
+  802201:	55                   	push   %ebp
+  802202:	89 e5                	mov    %esp,%ebp
+  802204:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802207:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80220a:	50                   	push   %eax
+  80220b:	ff 75 08             	push   0x8(%ebp)
+  80220e:	e8 01 f1 ff ff       	call   801314 <fd_lookup>
+  802213:	83 c4 10             	add    $0x10,%esp
+  802216:	85 c0                	test   %eax,%eax
+  802218:	78 18                	js     802232 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80221a:	83 ec 0c             	sub    $0xc,%esp
+  80221d:	ff 75 f4             	push   -0xc(%ebp)
+  802220:	e8 82 f0 ff ff       	call   8012a7 <fd2data>
+  802225:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802227:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80222a:	e8 33 fd ff ff       	call   801f62 <_pipeisclosed>
+  80222f:	83 c4 10             	add    $0x10,%esp
+}
+  802232:	c9                   	leave
+  802233:	c3                   	ret
+
+00802234 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  802234:	55                   	push   %ebp
+  802235:	89 e5                	mov    %esp,%ebp
+  802237:	56                   	push   %esi
+  802238:	53                   	push   %ebx
+  802239:	8b 75 08             	mov    0x8(%ebp),%esi
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  80223c:	85 f6                	test   %esi,%esi
+  80223e:	74 15                	je     802255 <wait+0x21>
+	e = &envs[ENVX(envid)];
+  802240:	89 f0                	mov    %esi,%eax
+  802242:	25 ff 03 00 00       	and    $0x3ff,%eax
+
+    while (e->env_id == envid && e->env_status != ENV_FREE) {
+  802247:	8d 1c c0             	lea    (%eax,%eax,8),%ebx
+  80224a:	c1 e3 04             	shl    $0x4,%ebx
+  80224d:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  802253:	eb 1b                	jmp    802270 <wait+0x3c>
+	assert(envid != 0);
+  802255:	68 37 31 80 00       	push   $0x803137
+  80225a:	68 b3 30 80 00       	push   $0x8030b3
+  80225f:	6a 09                	push   $0x9
+  802261:	68 42 31 80 00       	push   $0x803142
+  802266:	e8 c2 df ff ff       	call   80022d <_panic>
+        sys_yield();
+  80226b:	e8 1e ea ff ff       	call   800c8e <sys_yield>
+    while (e->env_id == envid && e->env_status != ENV_FREE) {
+  802270:	8b 43 48             	mov    0x48(%ebx),%eax
+  802273:	39 f0                	cmp    %esi,%eax
+  802275:	75 07                	jne    80227e <wait+0x4a>
+  802277:	8b 43 54             	mov    0x54(%ebx),%eax
+  80227a:	85 c0                	test   %eax,%eax
+  80227c:	75 ed                	jne    80226b <wait+0x37>
+    }
+}
+  80227e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802281:	5b                   	pop    %ebx
+  802282:	5e                   	pop    %esi
+  802283:	5d                   	pop    %ebp
+  802284:	c3                   	ret
+
+00802285 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802285:	b8 00 00 00 00       	mov    $0x0,%eax
+  80228a:	c3                   	ret
+
+0080228b <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80228b:	55                   	push   %ebp
+  80228c:	89 e5                	mov    %esp,%ebp
+  80228e:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802291:	68 4d 31 80 00       	push   $0x80314d
+  802296:	ff 75 0c             	push   0xc(%ebp)
+  802299:	e8 23 e6 ff ff       	call   8008c1 <strcpy>
+	return 0;
+}
+  80229e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022a3:	c9                   	leave
+  8022a4:	c3                   	ret
+
+008022a5 <devcons_write>:
+{
+  8022a5:	55                   	push   %ebp
+  8022a6:	89 e5                	mov    %esp,%ebp
+  8022a8:	57                   	push   %edi
+  8022a9:	56                   	push   %esi
+  8022aa:	53                   	push   %ebx
+  8022ab:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8022b1:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8022b6:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8022bc:	eb 2e                	jmp    8022ec <devcons_write+0x47>
+		m = n - tot;
+  8022be:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8022c1:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8022c3:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8022c8:	39 c3                	cmp    %eax,%ebx
+  8022ca:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8022cd:	83 ec 04             	sub    $0x4,%esp
+  8022d0:	53                   	push   %ebx
+  8022d1:	89 f0                	mov    %esi,%eax
+  8022d3:	03 45 0c             	add    0xc(%ebp),%eax
+  8022d6:	50                   	push   %eax
+  8022d7:	57                   	push   %edi
+  8022d8:	e8 6a e7 ff ff       	call   800a47 <memmove>
+		sys_cputs(buf, m);
+  8022dd:	83 c4 08             	add    $0x8,%esp
+  8022e0:	53                   	push   %ebx
+  8022e1:	57                   	push   %edi
+  8022e2:	e8 0a e9 ff ff       	call   800bf1 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8022e7:	01 de                	add    %ebx,%esi
+  8022e9:	83 c4 10             	add    $0x10,%esp
+  8022ec:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8022ef:	72 cd                	jb     8022be <devcons_write+0x19>
+}
+  8022f1:	89 f0                	mov    %esi,%eax
+  8022f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022f6:	5b                   	pop    %ebx
+  8022f7:	5e                   	pop    %esi
+  8022f8:	5f                   	pop    %edi
+  8022f9:	5d                   	pop    %ebp
+  8022fa:	c3                   	ret
+
+008022fb <devcons_read>:
+{
+  8022fb:	55                   	push   %ebp
+  8022fc:	89 e5                	mov    %esp,%ebp
+  8022fe:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802301:	b8 00 00 00 00       	mov    $0x0,%eax
+  802306:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80230a:	75 07                	jne    802313 <devcons_read+0x18>
+  80230c:	eb 1f                	jmp    80232d <devcons_read+0x32>
+		sys_yield();
+  80230e:	e8 7b e9 ff ff       	call   800c8e <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802313:	e8 f7 e8 ff ff       	call   800c0f <sys_cgetc>
+  802318:	85 c0                	test   %eax,%eax
+  80231a:	74 f2                	je     80230e <devcons_read+0x13>
+	if (c < 0)
+  80231c:	78 0f                	js     80232d <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80231e:	83 f8 04             	cmp    $0x4,%eax
+  802321:	74 0c                	je     80232f <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802323:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802326:	88 02                	mov    %al,(%edx)
+	return 1;
+  802328:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80232d:	c9                   	leave
+  80232e:	c3                   	ret
+		return 0;
+  80232f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802334:	eb f7                	jmp    80232d <devcons_read+0x32>
+
+00802336 <cputchar>:
+{
+  802336:	55                   	push   %ebp
+  802337:	89 e5                	mov    %esp,%ebp
+  802339:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80233c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80233f:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802342:	6a 01                	push   $0x1
+  802344:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802347:	50                   	push   %eax
+  802348:	e8 a4 e8 ff ff       	call   800bf1 <sys_cputs>
+}
+  80234d:	83 c4 10             	add    $0x10,%esp
+  802350:	c9                   	leave
+  802351:	c3                   	ret
+
+00802352 <getchar>:
+{
+  802352:	55                   	push   %ebp
+  802353:	89 e5                	mov    %esp,%ebp
+  802355:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802358:	6a 01                	push   $0x1
+  80235a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80235d:	50                   	push   %eax
+  80235e:	6a 00                	push   $0x0
+  802360:	e8 15 f2 ff ff       	call   80157a <read>
+	if (r < 0)
+  802365:	83 c4 10             	add    $0x10,%esp
+  802368:	85 c0                	test   %eax,%eax
+  80236a:	78 06                	js     802372 <getchar+0x20>
+	if (r < 1)
+  80236c:	74 06                	je     802374 <getchar+0x22>
+	return c;
+  80236e:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802372:	c9                   	leave
+  802373:	c3                   	ret
+		return -E_EOF;
+  802374:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802379:	eb f7                	jmp    802372 <getchar+0x20>
+
+0080237b <iscons>:
+{
+  80237b:	55                   	push   %ebp
+  80237c:	89 e5                	mov    %esp,%ebp
+  80237e:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802381:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802384:	50                   	push   %eax
+  802385:	ff 75 08             	push   0x8(%ebp)
+  802388:	e8 87 ef ff ff       	call   801314 <fd_lookup>
+  80238d:	83 c4 10             	add    $0x10,%esp
+  802390:	85 c0                	test   %eax,%eax
+  802392:	78 11                	js     8023a5 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802394:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802397:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  80239d:	39 10                	cmp    %edx,(%eax)
+  80239f:	0f 94 c0             	sete   %al
+  8023a2:	0f b6 c0             	movzbl %al,%eax
+}
+  8023a5:	c9                   	leave
+  8023a6:	c3                   	ret
+
+008023a7 <opencons>:
+{
+  8023a7:	55                   	push   %ebp
+  8023a8:	89 e5                	mov    %esp,%ebp
+  8023aa:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8023ad:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023b0:	50                   	push   %eax
+  8023b1:	e8 08 ef ff ff       	call   8012be <fd_alloc>
+  8023b6:	83 c4 10             	add    $0x10,%esp
+  8023b9:	85 c0                	test   %eax,%eax
+  8023bb:	78 3a                	js     8023f7 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8023bd:	83 ec 04             	sub    $0x4,%esp
+  8023c0:	68 07 04 00 00       	push   $0x407
+  8023c5:	ff 75 f4             	push   -0xc(%ebp)
+  8023c8:	6a 00                	push   $0x0
+  8023ca:	e8 de e8 ff ff       	call   800cad <sys_page_alloc>
+  8023cf:	83 c4 10             	add    $0x10,%esp
+  8023d2:	85 c0                	test   %eax,%eax
+  8023d4:	78 21                	js     8023f7 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8023d6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023d9:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  8023df:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8023e1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023e4:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8023eb:	83 ec 0c             	sub    $0xc,%esp
+  8023ee:	50                   	push   %eax
+  8023ef:	e8 a3 ee ff ff       	call   801297 <fd2num>
+  8023f4:	83 c4 10             	add    $0x10,%esp
+}
+  8023f7:	c9                   	leave
+  8023f8:	c3                   	ret
+
+008023f9 <set_pgfault_handler>:
+// allocate an exception stack (one page of memory with its top
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf)) {
+  8023f9:	55                   	push   %ebp
+  8023fa:	89 e5                	mov    %esp,%ebp
+  8023fc:	83 ec 08             	sub    $0x8,%esp
+  int r;
+
+  if (_pgfault_handler == 0) {
+  8023ff:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  802406:	74 0a                	je     802412 <set_pgfault_handler+0x19>
+    if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)))
+      panic(" set_pgfault_handler sys_env_set_pgfault_upcall panic: %e\n", r);
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  802408:	8b 45 08             	mov    0x8(%ebp),%eax
+  80240b:	a3 00 80 80 00       	mov    %eax,0x808000
+
+
+}
+  802410:	c9                   	leave
+  802411:	c3                   	ret
+    if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)))
+  802412:	83 ec 04             	sub    $0x4,%esp
+  802415:	6a 07                	push   $0x7
+  802417:	68 00 f0 bf ee       	push   $0xeebff000
+  80241c:	6a 00                	push   $0x0
+  80241e:	e8 8a e8 ff ff       	call   800cad <sys_page_alloc>
+  802423:	83 c4 10             	add    $0x10,%esp
+  802426:	85 c0                	test   %eax,%eax
+  802428:	75 28                	jne    802452 <set_pgfault_handler+0x59>
+    if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)))
+  80242a:	83 ec 08             	sub    $0x8,%esp
+  80242d:	68 64 24 80 00       	push   $0x802464
+  802432:	6a 00                	push   $0x0
+  802434:	e8 bf e9 ff ff       	call   800df8 <sys_env_set_pgfault_upcall>
+  802439:	83 c4 10             	add    $0x10,%esp
+  80243c:	85 c0                	test   %eax,%eax
+  80243e:	74 c8                	je     802408 <set_pgfault_handler+0xf>
+      panic(" set_pgfault_handler sys_env_set_pgfault_upcall panic: %e\n", r);
+  802440:	50                   	push   %eax
+  802441:	68 8c 31 80 00       	push   $0x80318c
+  802446:	6a 22                	push   $0x22
+  802448:	68 c7 31 80 00       	push   $0x8031c7
+  80244d:	e8 db dd ff ff       	call   80022d <_panic>
+      panic("set_pgfault_handler sys_page_alloc panic: %e\n", r);
+  802452:	50                   	push   %eax
+  802453:	68 5c 31 80 00       	push   $0x80315c
+  802458:	6a 20                	push   $0x20
+  80245a:	68 c7 31 80 00       	push   $0x8031c7
+  80245f:	e8 c9 dd ff ff       	call   80022d <_panic>
+
+00802464 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  802464:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  802465:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  80246a:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80246c:	83 c4 04             	add    $0x4,%esp
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	// push the trap-time %eip onto the trap-time stack
+    subl $0x4, 0x30(%esp) # for push eip
+  80246f:	83 6c 24 30 04       	subl   $0x4,0x30(%esp)
+    movl 0x30(%esp), %ebx #regular esp
+  802474:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+    movl 0x28(%esp), %eax #eip
+  802478:	8b 44 24 28          	mov    0x28(%esp),%eax
+    movl %eax, (%ebx)
+  80247c:	89 03                	mov    %eax,(%ebx)
+
+    // Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+    addl $8, %esp
+  80247e:	83 c4 08             	add    $0x8,%esp
+    popal
+  802481:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  802482:	83 c4 04             	add    $0x4,%esp
+	popfl
+  802485:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  802486:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  802487:	c3                   	ret
+
+00802488 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  802488:	55                   	push   %ebp
+  802489:	89 e5                	mov    %esp,%ebp
+  80248b:	56                   	push   %esi
+  80248c:	53                   	push   %ebx
+  80248d:	8b 75 08             	mov    0x8(%ebp),%esi
+  802490:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802493:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  802496:	85 c0                	test   %eax,%eax
+  802498:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80249d:	0f 44 c2             	cmove  %edx,%eax
+  8024a0:	83 ec 0c             	sub    $0xc,%esp
+  8024a3:	50                   	push   %eax
+  8024a4:	e8 b4 e9 ff ff       	call   800e5d <sys_ipc_recv>
+
+  if (from_env_store)
+  8024a9:	83 c4 10             	add    $0x10,%esp
+  8024ac:	85 f6                	test   %esi,%esi
+  8024ae:	74 17                	je     8024c7 <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  8024b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024b5:	85 c0                	test   %eax,%eax
+  8024b7:	75 0c                	jne    8024c5 <ipc_recv+0x3d>
+  8024b9:	8b 15 20 54 80 00    	mov    0x805420,%edx
+  8024bf:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  8024c5:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  8024c7:	85 db                	test   %ebx,%ebx
+  8024c9:	74 2b                	je     8024f6 <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  8024cb:	85 c0                	test   %eax,%eax
+  8024cd:	74 0d                	je     8024dc <ipc_recv+0x54>
+  8024cf:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  8024d5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024d8:	5b                   	pop    %ebx
+  8024d9:	5e                   	pop    %esi
+  8024da:	5d                   	pop    %ebp
+  8024db:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  8024dc:	a1 20 54 80 00       	mov    0x805420,%eax
+  8024e1:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8024e7:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  8024e9:	a1 20 54 80 00       	mov    0x805420,%eax
+  8024ee:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  8024f4:	eb df                	jmp    8024d5 <ipc_recv+0x4d>
+  8024f6:	85 c0                	test   %eax,%eax
+  8024f8:	75 db                	jne    8024d5 <ipc_recv+0x4d>
+  8024fa:	eb ed                	jmp    8024e9 <ipc_recv+0x61>
+
+008024fc <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  8024fc:	55                   	push   %ebp
+  8024fd:	89 e5                	mov    %esp,%ebp
+  8024ff:	57                   	push   %edi
+  802500:	56                   	push   %esi
+  802501:	53                   	push   %ebx
+  802502:	83 ec 0c             	sub    $0xc,%esp
+  802505:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802508:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80250b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  80250e:	85 db                	test   %ebx,%ebx
+  802510:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802515:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  802518:	ff 75 14             	push   0x14(%ebp)
+  80251b:	53                   	push   %ebx
+  80251c:	56                   	push   %esi
+  80251d:	57                   	push   %edi
+  80251e:	e8 17 e9 ff ff       	call   800e3a <sys_ipc_try_send>
+  802523:	83 c4 10             	add    $0x10,%esp
+  802526:	85 c0                	test   %eax,%eax
+  802528:	74 1e                	je     802548 <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  80252a:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80252d:	75 07                	jne    802536 <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  80252f:	e8 5a e7 ff ff       	call   800c8e <sys_yield>
+  802534:	eb e2                	jmp    802518 <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  802536:	50                   	push   %eax
+  802537:	68 d5 31 80 00       	push   $0x8031d5
+  80253c:	6a 3c                	push   $0x3c
+  80253e:	68 e2 31 80 00       	push   $0x8031e2
+  802543:	e8 e5 dc ff ff       	call   80022d <_panic>
+  }
+
+#endif
+}
+  802548:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80254b:	5b                   	pop    %ebx
+  80254c:	5e                   	pop    %esi
+  80254d:	5f                   	pop    %edi
+  80254e:	5d                   	pop    %ebp
+  80254f:	c3                   	ret
+
+00802550 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  802550:	55                   	push   %ebp
+  802551:	89 e5                	mov    %esp,%ebp
+  802553:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  802556:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  80255b:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80255e:	c1 e0 04             	shl    $0x4,%eax
+  802561:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802566:	8b 40 50             	mov    0x50(%eax),%eax
+  802569:	39 c8                	cmp    %ecx,%eax
+  80256b:	74 12                	je     80257f <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  80256d:	83 c2 01             	add    $0x1,%edx
+  802570:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802576:	75 e3                	jne    80255b <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802578:	b8 00 00 00 00       	mov    $0x0,%eax
+  80257d:	eb 0e                	jmp    80258d <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  80257f:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802582:	c1 e0 04             	shl    $0x4,%eax
+  802585:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80258a:	8b 40 48             	mov    0x48(%eax),%eax
+  80258d:	5d                   	pop    %ebp
+  80258e:	c3                   	ret
+
+0080258f <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80258f:	55                   	push   %ebp
+  802590:	89 e5                	mov    %esp,%ebp
+  802592:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802595:	89 c2                	mov    %eax,%edx
+  802597:	c1 ea 16             	shr    $0x16,%edx
+  80259a:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8025a1:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8025a6:	f6 c1 01             	test   $0x1,%cl
+  8025a9:	74 1c                	je     8025c7 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  8025ab:	c1 e8 0c             	shr    $0xc,%eax
+  8025ae:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8025b5:	a8 01                	test   $0x1,%al
+  8025b7:	74 0e                	je     8025c7 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8025b9:	c1 e8 0c             	shr    $0xc,%eax
+  8025bc:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  8025c3:	ef 
+  8025c4:	0f b7 d2             	movzwl %dx,%edx
+}
+  8025c7:	89 d0                	mov    %edx,%eax
+  8025c9:	5d                   	pop    %ebp
+  8025ca:	c3                   	ret
+  8025cb:	66 90                	xchg   %ax,%ax
+  8025cd:	66 90                	xchg   %ax,%ax
+  8025cf:	90                   	nop
+
+008025d0 <__udivmoddi4>:
+  8025d0:	55                   	push   %ebp
+  8025d1:	57                   	push   %edi
+  8025d2:	56                   	push   %esi
+  8025d3:	53                   	push   %ebx
+  8025d4:	83 ec 24             	sub    $0x24,%esp
+  8025d7:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8025db:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8025df:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  8025e3:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8025e7:	8b 54 24 44          	mov    0x44(%esp),%edx
+  8025eb:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8025ef:	8b 44 24 40          	mov    0x40(%esp),%eax
+  8025f3:	89 d3                	mov    %edx,%ebx
+  8025f5:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8025f9:	09 c3                	or     %eax,%ebx
+  8025fb:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8025ff:	0f 84 9c 00 00 00    	je     8026a1 <__udivmoddi4+0xd1>
+  802605:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80260c:	00 
+  80260d:	31 c0                	xor    %eax,%eax
+  80260f:	31 d2                	xor    %edx,%edx
+  802611:	89 fb                	mov    %edi,%ebx
+  802613:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80261a:	00 
+  80261b:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802620:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802624:	01 c0                	add    %eax,%eax
+  802626:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80262d:	00 
+  80262e:	89 c6                	mov    %eax,%esi
+  802630:	89 d7                	mov    %edx,%edi
+  802632:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802636:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80263a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80263d:	d3 ea                	shr    %cl,%edx
+  80263f:	f6 c1 20             	test   $0x20,%cl
+  802642:	0f 45 c2             	cmovne %edx,%eax
+  802645:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802649:	83 e0 01             	and    $0x1,%eax
+  80264c:	09 fa                	or     %edi,%edx
+  80264e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802652:	89 04 24             	mov    %eax,(%esp)
+  802655:	8b 04 24             	mov    (%esp),%eax
+  802658:	89 d5                	mov    %edx,%ebp
+  80265a:	09 f0                	or     %esi,%eax
+  80265c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802660:	39 f0                	cmp    %esi,%eax
+  802662:	19 fd                	sbb    %edi,%ebp
+  802664:	72 1d                	jb     802683 <__udivmoddi4+0xb3>
+  802666:	29 f0                	sub    %esi,%eax
+  802668:	19 fa                	sbb    %edi,%edx
+  80266a:	89 cf                	mov    %ecx,%edi
+  80266c:	c1 ef 05             	shr    $0x5,%edi
+  80266f:	83 e7 01             	and    $0x1,%edi
+  802672:	89 fe                	mov    %edi,%esi
+  802674:	d3 e7                	shl    %cl,%edi
+  802676:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80267a:	83 f6 01             	xor    $0x1,%esi
+  80267d:	d3 e6                	shl    %cl,%esi
+  80267f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802683:	83 e9 01             	sub    $0x1,%ecx
+  802686:	73 98                	jae    802620 <__udivmoddi4+0x50>
+  802688:	85 db                	test   %ebx,%ebx
+  80268a:	74 05                	je     802691 <__udivmoddi4+0xc1>
+  80268c:	89 03                	mov    %eax,(%ebx)
+  80268e:	89 53 04             	mov    %edx,0x4(%ebx)
+  802691:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802695:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802699:	83 c4 24             	add    $0x24,%esp
+  80269c:	5b                   	pop    %ebx
+  80269d:	5e                   	pop    %esi
+  80269e:	5f                   	pop    %edi
+  80269f:	5d                   	pop    %ebp
+  8026a0:	c3                   	ret
+  8026a1:	85 ff                	test   %edi,%edi
+  8026a3:	74 0d                	je     8026b2 <__udivmoddi4+0xe2>
+  8026a5:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  8026ab:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  8026b2:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8026b6:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8026ba:	89 44 24 18          	mov    %eax,0x18(%esp)
+  8026be:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8026c2:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  8026c6:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8026ca:	83 c4 24             	add    $0x24,%esp
+  8026cd:	5b                   	pop    %ebx
+  8026ce:	5e                   	pop    %esi
+  8026cf:	5f                   	pop    %edi
+  8026d0:	5d                   	pop    %ebp
+  8026d1:	c3                   	ret
+  8026d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8026d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+008026e0 <__udivdi3>:
+  8026e0:	57                   	push   %edi
+  8026e1:	56                   	push   %esi
+  8026e2:	53                   	push   %ebx
+  8026e3:	83 ec 20             	sub    $0x20,%esp
+  8026e6:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8026ea:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8026ee:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8026f2:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8026f6:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8026fa:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8026fe:	89 d1                	mov    %edx,%ecx
+  802700:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802704:	09 c1                	or     %eax,%ecx
+  802706:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80270a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80270e:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802712:	0f 84 88 00 00 00    	je     8027a0 <__udivdi3+0xc0>
+  802718:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80271f:	00 
+  802720:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802725:	31 c0                	xor    %eax,%eax
+  802727:	31 d2                	xor    %edx,%edx
+  802729:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802730:	00 
+  802731:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802738:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80273c:	01 c0                	add    %eax,%eax
+  80273e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802745:	00 
+  802746:	89 c6                	mov    %eax,%esi
+  802748:	89 d7                	mov    %edx,%edi
+  80274a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80274e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802752:	0f ad d0             	shrd   %cl,%edx,%eax
+  802755:	d3 ea                	shr    %cl,%edx
+  802757:	f6 c1 20             	test   $0x20,%cl
+  80275a:	0f 45 c2             	cmovne %edx,%eax
+  80275d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802761:	83 e0 01             	and    $0x1,%eax
+  802764:	09 fa                	or     %edi,%edx
+  802766:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80276a:	89 04 24             	mov    %eax,(%esp)
+  80276d:	8b 04 24             	mov    (%esp),%eax
+  802770:	89 d3                	mov    %edx,%ebx
+  802772:	09 f0                	or     %esi,%eax
+  802774:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802778:	39 f0                	cmp    %esi,%eax
+  80277a:	19 fb                	sbb    %edi,%ebx
+  80277c:	72 1d                	jb     80279b <__udivdi3+0xbb>
+  80277e:	29 f0                	sub    %esi,%eax
+  802780:	19 fa                	sbb    %edi,%edx
+  802782:	89 cf                	mov    %ecx,%edi
+  802784:	c1 ef 05             	shr    $0x5,%edi
+  802787:	83 e7 01             	and    $0x1,%edi
+  80278a:	89 fe                	mov    %edi,%esi
+  80278c:	d3 e7                	shl    %cl,%edi
+  80278e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802792:	83 f6 01             	xor    $0x1,%esi
+  802795:	d3 e6                	shl    %cl,%esi
+  802797:	09 74 24 18          	or     %esi,0x18(%esp)
+  80279b:	83 e9 01             	sub    $0x1,%ecx
+  80279e:	73 98                	jae    802738 <__udivdi3+0x58>
+  8027a0:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8027a4:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8027a8:	83 c4 20             	add    $0x20,%esp
+  8027ab:	5b                   	pop    %ebx
+  8027ac:	5e                   	pop    %esi
+  8027ad:	5f                   	pop    %edi
+  8027ae:	c3                   	ret
+  8027af:	90                   	nop
+
+008027b0 <__umoddi3>:
+  8027b0:	57                   	push   %edi
+  8027b1:	56                   	push   %esi
+  8027b2:	53                   	push   %ebx
+  8027b3:	83 ec 18             	sub    $0x18,%esp
+  8027b6:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8027ba:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8027be:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8027c2:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8027c6:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8027ca:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8027ce:	89 d1                	mov    %edx,%ecx
+  8027d0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8027d4:	09 c1                	or     %eax,%ecx
+  8027d6:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8027da:	74 5b                	je     802837 <__umoddi3+0x87>
+  8027dc:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8027e1:	31 c0                	xor    %eax,%eax
+  8027e3:	31 d2                	xor    %edx,%edx
+  8027e5:	8d 76 00             	lea    0x0(%esi),%esi
+  8027e8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8027ec:	01 c0                	add    %eax,%eax
+  8027ee:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8027f5:	00 
+  8027f6:	89 c6                	mov    %eax,%esi
+  8027f8:	89 d7                	mov    %edx,%edi
+  8027fa:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8027fe:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802802:	0f ad d0             	shrd   %cl,%edx,%eax
+  802805:	d3 ea                	shr    %cl,%edx
+  802807:	f6 c1 20             	test   $0x20,%cl
+  80280a:	0f 45 c2             	cmovne %edx,%eax
+  80280d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802811:	83 e0 01             	and    $0x1,%eax
+  802814:	09 fa                	or     %edi,%edx
+  802816:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80281a:	89 04 24             	mov    %eax,(%esp)
+  80281d:	8b 04 24             	mov    (%esp),%eax
+  802820:	89 d3                	mov    %edx,%ebx
+  802822:	09 f0                	or     %esi,%eax
+  802824:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802828:	39 f0                	cmp    %esi,%eax
+  80282a:	19 fb                	sbb    %edi,%ebx
+  80282c:	72 04                	jb     802832 <__umoddi3+0x82>
+  80282e:	29 f0                	sub    %esi,%eax
+  802830:	19 fa                	sbb    %edi,%edx
+  802832:	83 e9 01             	sub    $0x1,%ecx
+  802835:	73 b1                	jae    8027e8 <__umoddi3+0x38>
+  802837:	83 c4 18             	add    $0x18,%esp
+  80283a:	5b                   	pop    %ebx
+  80283b:	5e                   	pop    %esi
+  80283c:	5f                   	pop    %edi
+  80283d:	c3                   	ret
+  80283e:	66 90                	xchg   %ax,%ax
+
+00802840 <__divdi3>:
+  802840:	55                   	push   %ebp
+  802841:	57                   	push   %edi
+  802842:	56                   	push   %esi
+  802843:	53                   	push   %ebx
+  802844:	83 ec 24             	sub    $0x24,%esp
+  802847:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  80284b:	8b 74 24 44          	mov    0x44(%esp),%esi
+  80284f:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802853:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802857:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  80285b:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  80285f:	85 d2                	test   %edx,%edx
+  802861:	0f 88 e0 00 00 00    	js     802947 <__divdi3+0x107>
+  802867:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  80286b:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  80286f:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802873:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802877:	85 f6                	test   %esi,%esi
+  802879:	78 16                	js     802891 <__divdi3+0x51>
+  80287b:	89 f1                	mov    %esi,%ecx
+  80287d:	31 c0                	xor    %eax,%eax
+  80287f:	31 d2                	xor    %edx,%edx
+  802881:	09 d9                	or     %ebx,%ecx
+  802883:	0f 85 f3 00 00 00    	jne    80297c <__divdi3+0x13c>
+  802889:	83 c4 24             	add    $0x24,%esp
+  80288c:	5b                   	pop    %ebx
+  80288d:	5e                   	pop    %esi
+  80288e:	5f                   	pop    %edi
+  80288f:	5d                   	pop    %ebp
+  802890:	c3                   	ret
+  802891:	bf 01 00 00 00       	mov    $0x1,%edi
+  802896:	f7 5c 24 08          	negl   0x8(%esp)
+  80289a:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  80289f:	f7 5c 24 0c          	negl   0xc(%esp)
+  8028a3:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8028aa:	00 
+  8028ab:	31 c0                	xor    %eax,%eax
+  8028ad:	31 d2                	xor    %edx,%edx
+  8028af:	89 fb                	mov    %edi,%ebx
+  8028b1:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8028b8:	00 
+  8028b9:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8028be:	66 90                	xchg   %ax,%ax
+  8028c0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8028c4:	01 c0                	add    %eax,%eax
+  8028c6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8028cd:	00 
+  8028ce:	89 c6                	mov    %eax,%esi
+  8028d0:	89 d7                	mov    %edx,%edi
+  8028d2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8028d6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8028da:	0f ad d0             	shrd   %cl,%edx,%eax
+  8028dd:	d3 ea                	shr    %cl,%edx
+  8028df:	f6 c1 20             	test   $0x20,%cl
+  8028e2:	0f 45 c2             	cmovne %edx,%eax
+  8028e5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8028e9:	83 e0 01             	and    $0x1,%eax
+  8028ec:	09 fa                	or     %edi,%edx
+  8028ee:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8028f2:	89 04 24             	mov    %eax,(%esp)
+  8028f5:	8b 04 24             	mov    (%esp),%eax
+  8028f8:	89 d5                	mov    %edx,%ebp
+  8028fa:	09 f0                	or     %esi,%eax
+  8028fc:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802900:	39 f0                	cmp    %esi,%eax
+  802902:	19 fd                	sbb    %edi,%ebp
+  802904:	72 1d                	jb     802923 <__divdi3+0xe3>
+  802906:	29 f0                	sub    %esi,%eax
+  802908:	19 fa                	sbb    %edi,%edx
+  80290a:	89 cf                	mov    %ecx,%edi
+  80290c:	c1 ef 05             	shr    $0x5,%edi
+  80290f:	83 e7 01             	and    $0x1,%edi
+  802912:	89 fe                	mov    %edi,%esi
+  802914:	d3 e7                	shl    %cl,%edi
+  802916:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80291a:	83 f6 01             	xor    $0x1,%esi
+  80291d:	d3 e6                	shl    %cl,%esi
+  80291f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802923:	83 e9 01             	sub    $0x1,%ecx
+  802926:	73 98                	jae    8028c0 <__divdi3+0x80>
+  802928:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80292c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802930:	85 db                	test   %ebx,%ebx
+  802932:	0f 84 51 ff ff ff    	je     802889 <__divdi3+0x49>
+  802938:	f7 d8                	neg    %eax
+  80293a:	83 d2 00             	adc    $0x0,%edx
+  80293d:	83 c4 24             	add    $0x24,%esp
+  802940:	5b                   	pop    %ebx
+  802941:	f7 da                	neg    %edx
+  802943:	5e                   	pop    %esi
+  802944:	5f                   	pop    %edi
+  802945:	5d                   	pop    %ebp
+  802946:	c3                   	ret
+  802947:	f7 d8                	neg    %eax
+  802949:	83 d2 00             	adc    $0x0,%edx
+  80294c:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802950:	f7 da                	neg    %edx
+  802952:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802956:	85 f6                	test   %esi,%esi
+  802958:	78 1b                	js     802975 <__divdi3+0x135>
+  80295a:	89 f1                	mov    %esi,%ecx
+  80295c:	31 c0                	xor    %eax,%eax
+  80295e:	31 d2                	xor    %edx,%edx
+  802960:	bf 01 00 00 00       	mov    $0x1,%edi
+  802965:	09 d9                	or     %ebx,%ecx
+  802967:	0f 85 36 ff ff ff    	jne    8028a3 <__divdi3+0x63>
+  80296d:	83 c4 24             	add    $0x24,%esp
+  802970:	5b                   	pop    %ebx
+  802971:	5e                   	pop    %esi
+  802972:	5f                   	pop    %edi
+  802973:	5d                   	pop    %ebp
+  802974:	c3                   	ret
+  802975:	31 ff                	xor    %edi,%edi
+  802977:	e9 1a ff ff ff       	jmp    802896 <__divdi3+0x56>
+  80297c:	31 ff                	xor    %edi,%edi
+  80297e:	e9 20 ff ff ff       	jmp    8028a3 <__divdi3+0x63>
+  802983:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80298a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00802990 <__moddi3>:
+  802990:	55                   	push   %ebp
+  802991:	57                   	push   %edi
+  802992:	56                   	push   %esi
+  802993:	53                   	push   %ebx
+  802994:	83 ec 1c             	sub    $0x1c,%esp
+  802997:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  80299b:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  80299f:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  8029a3:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  8029a7:	89 c8                	mov    %ecx,%eax
+  8029a9:	89 f2                	mov    %esi,%edx
+  8029ab:	89 f3                	mov    %esi,%ebx
+  8029ad:	85 ed                	test   %ebp,%ebp
+  8029af:	0f 88 9d 00 00 00    	js     802a52 <__moddi3+0xc2>
+  8029b5:	09 cb                	or     %ecx,%ebx
+  8029b7:	0f 84 8d 00 00 00    	je     802a4a <__moddi3+0xba>
+  8029bd:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  8029c1:	31 db                	xor    %ebx,%ebx
+  8029c3:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  8029c7:	89 ca                	mov    %ecx,%edx
+  8029c9:	89 f0                	mov    %esi,%eax
+  8029cb:	89 dd                	mov    %ebx,%ebp
+  8029cd:	f7 da                	neg    %edx
+  8029cf:	83 d0 00             	adc    $0x0,%eax
+  8029d2:	f7 d8                	neg    %eax
+  8029d4:	0f 49 f0             	cmovns %eax,%esi
+  8029d7:	0f 49 ca             	cmovns %edx,%ecx
+  8029da:	31 c0                	xor    %eax,%eax
+  8029dc:	31 d2                	xor    %edx,%edx
+  8029de:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8029e2:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  8029e6:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8029eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  8029ef:	90                   	nop
+  8029f0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8029f4:	01 c0                	add    %eax,%eax
+  8029f6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8029fd:	00 
+  8029fe:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  802a02:	89 c6                	mov    %eax,%esi
+  802a04:	89 d7                	mov    %edx,%edi
+  802a06:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802a0a:	8b 54 24 14          	mov    0x14(%esp),%edx
+  802a0e:	0f ad d0             	shrd   %cl,%edx,%eax
+  802a11:	d3 ea                	shr    %cl,%edx
+  802a13:	f6 c1 20             	test   $0x20,%cl
+  802a16:	0f 45 c2             	cmovne %edx,%eax
+  802a19:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802a1d:	83 e0 01             	and    $0x1,%eax
+  802a20:	09 fa                	or     %edi,%edx
+  802a22:	89 04 24             	mov    %eax,(%esp)
+  802a25:	8b 04 24             	mov    (%esp),%eax
+  802a28:	89 d7                	mov    %edx,%edi
+  802a2a:	09 f0                	or     %esi,%eax
+  802a2c:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  802a30:	39 d8                	cmp    %ebx,%eax
+  802a32:	19 f7                	sbb    %esi,%edi
+  802a34:	72 04                	jb     802a3a <__moddi3+0xaa>
+  802a36:	29 d8                	sub    %ebx,%eax
+  802a38:	19 f2                	sbb    %esi,%edx
+  802a3a:	83 e9 01             	sub    $0x1,%ecx
+  802a3d:	73 b1                	jae    8029f0 <__moddi3+0x60>
+  802a3f:	85 ed                	test   %ebp,%ebp
+  802a41:	74 07                	je     802a4a <__moddi3+0xba>
+  802a43:	f7 d8                	neg    %eax
+  802a45:	83 d2 00             	adc    $0x0,%edx
+  802a48:	f7 da                	neg    %edx
+  802a4a:	83 c4 1c             	add    $0x1c,%esp
+  802a4d:	5b                   	pop    %ebx
+  802a4e:	5e                   	pop    %esi
+  802a4f:	5f                   	pop    %edi
+  802a50:	5d                   	pop    %ebp
+  802a51:	c3                   	ret
+  802a52:	09 cb                	or     %ecx,%ebx
+  802a54:	74 f4                	je     802a4a <__moddi3+0xba>
+  802a56:	f7 df                	neg    %edi
+  802a58:	bb 01 00 00 00       	mov    $0x1,%ebx
+  802a5d:	83 d5 00             	adc    $0x0,%ebp
+  802a60:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802a64:	f7 dd                	neg    %ebp
+  802a66:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802a6a:	e9 58 ff ff ff       	jmp    8029c7 <__moddi3+0x37>
@@ -0,0 +1,5816 @@
+
+obj/user/testfile.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 4e 06 00 00       	call   80067f <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <xopen>:
+
+#define FVA ((struct Fd*)0xCCCCC000)
+
+static int
+xopen(const char *path, int mode)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 0c             	sub    $0xc,%esp
+  80003a:	89 d3                	mov    %edx,%ebx
+	extern union Fsipc fsipcbuf;
+	envid_t fsenv;
+	
+	strcpy(fsipcbuf.open.req_path, path);
+  80003c:	50                   	push   %eax
+  80003d:	68 00 60 80 00       	push   $0x806000
+  800042:	e8 2f 0d 00 00       	call   800d76 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  800047:	89 1d 00 64 80 00    	mov    %ebx,0x806400
+
+	fsenv = ipc_find_env(ENV_TYPE_FS);
+  80004d:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  800054:	e8 a4 14 00 00       	call   8014fd <ipc_find_env>
+	ipc_send(fsenv, FSREQ_OPEN, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800059:	6a 07                	push   $0x7
+  80005b:	68 00 60 80 00       	push   $0x806000
+  800060:	6a 01                	push   $0x1
+  800062:	50                   	push   %eax
+  800063:	e8 41 14 00 00       	call   8014a9 <ipc_send>
+	return ipc_recv(NULL, FVA, NULL);
+  800068:	83 c4 1c             	add    $0x1c,%esp
+  80006b:	6a 00                	push   $0x0
+  80006d:	68 00 c0 cc cc       	push   $0xccccc000
+  800072:	6a 00                	push   $0x0
+  800074:	e8 bc 13 00 00       	call   801435 <ipc_recv>
+}
+  800079:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80007c:	c9                   	leave
+  80007d:	c3                   	ret
+
+0080007e <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  80007e:	55                   	push   %ebp
+  80007f:	89 e5                	mov    %esp,%ebp
+  800081:	57                   	push   %edi
+  800082:	56                   	push   %esi
+  800083:	53                   	push   %ebx
+  800084:	81 ec ac 02 00 00    	sub    $0x2ac,%esp
+	struct Fd fdcopy;
+	struct Stat st;
+	char buf[512];
+
+	// We open files manually first, to avoid the FD layer
+	if ((r = xopen("/not-found", O_RDONLY)) < 0 && r != -E_NOT_FOUND)
+  80008a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80008f:	b8 40 2b 80 00       	mov    $0x802b40,%eax
+  800094:	e8 9a ff ff ff       	call   800033 <xopen>
+  800099:	85 c0                	test   %eax,%eax
+  80009b:	0f 89 fa 03 00 00    	jns    80049b <umain+0x41d>
+  8000a1:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8000a4:	0f 85 df 03 00 00    	jne    800489 <umain+0x40b>
+		panic("serve_open /not-found: %e", r);
+	else if (r >= 0)
+		panic("serve_open /not-found succeeded!");
+
+	if ((r = xopen("/newmotd", O_RDONLY)) < 0)
+  8000aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000af:	b8 75 2b 80 00       	mov    $0x802b75,%eax
+  8000b4:	e8 7a ff ff ff       	call   800033 <xopen>
+  8000b9:	85 c0                	test   %eax,%eax
+  8000bb:	0f 88 ee 03 00 00    	js     8004af <umain+0x431>
+		panic("serve_open /newmotd: %e", r);
+	if (FVA->fd_dev_id != 'f' || FVA->fd_offset != 0 || FVA->fd_omode != O_RDONLY)
+  8000c1:	83 3d 00 c0 cc cc 66 	cmpl   $0x66,0xccccc000
+  8000c8:	0f 85 f3 03 00 00    	jne    8004c1 <umain+0x443>
+  8000ce:	83 3d 04 c0 cc cc 00 	cmpl   $0x0,0xccccc004
+  8000d5:	0f 85 e6 03 00 00    	jne    8004c1 <umain+0x443>
+  8000db:	83 3d 08 c0 cc cc 00 	cmpl   $0x0,0xccccc008
+  8000e2:	0f 85 d9 03 00 00    	jne    8004c1 <umain+0x443>
+		panic("serve_open did not fill struct Fd correctly\n");
+	cprintf("serve_open is good\n");
+  8000e8:	83 ec 0c             	sub    $0xc,%esp
+  8000eb:	68 96 2b 80 00       	push   $0x802b96
+  8000f0:	e8 c8 06 00 00       	call   8007bd <cprintf>
+
+	if ((r = devfile.dev_stat(FVA, &st)) < 0)
+  8000f5:	83 c4 08             	add    $0x8,%esp
+  8000f8:	8d 85 4c ff ff ff    	lea    -0xb4(%ebp),%eax
+  8000fe:	50                   	push   %eax
+  8000ff:	68 00 c0 cc cc       	push   $0xccccc000
+  800104:	ff 15 1c 40 80 00    	call   *0x80401c
+  80010a:	83 c4 10             	add    $0x10,%esp
+  80010d:	85 c0                	test   %eax,%eax
+  80010f:	0f 88 c0 03 00 00    	js     8004d5 <umain+0x457>
+		panic("file_stat: %e", r);
+	if (strlen(msg) != st.st_size)
+  800115:	83 ec 0c             	sub    $0xc,%esp
+  800118:	ff 35 00 40 80 00    	push   0x804000
+  80011e:	e8 18 0c 00 00       	call   800d3b <strlen>
+  800123:	83 c4 10             	add    $0x10,%esp
+  800126:	3b 45 cc             	cmp    -0x34(%ebp),%eax
+  800129:	0f 85 b8 03 00 00    	jne    8004e7 <umain+0x469>
+		panic("file_stat returned size %d wanted %d\n", st.st_size, strlen(msg));
+	cprintf("file_stat is good\n");
+  80012f:	83 ec 0c             	sub    $0xc,%esp
+  800132:	68 b8 2b 80 00       	push   $0x802bb8
+  800137:	e8 81 06 00 00       	call   8007bd <cprintf>
+
+	memset(buf, 0, sizeof buf);
+  80013c:	83 c4 0c             	add    $0xc,%esp
+  80013f:	68 00 02 00 00       	push   $0x200
+  800144:	6a 00                	push   $0x0
+  800146:	8d 9d 4c fd ff ff    	lea    -0x2b4(%ebp),%ebx
+  80014c:	53                   	push   %ebx
+  80014d:	e8 75 0d 00 00       	call   800ec7 <memset>
+	if ((r = devfile.dev_read(FVA, buf, sizeof buf)) < 0)
+  800152:	83 c4 0c             	add    $0xc,%esp
+  800155:	68 00 02 00 00       	push   $0x200
+  80015a:	53                   	push   %ebx
+  80015b:	68 00 c0 cc cc       	push   $0xccccc000
+  800160:	ff 15 10 40 80 00    	call   *0x804010
+  800166:	83 c4 10             	add    $0x10,%esp
+  800169:	85 c0                	test   %eax,%eax
+  80016b:	0f 88 9b 03 00 00    	js     80050c <umain+0x48e>
+		panic("file_read: %e", r);
+	if (strcmp(buf, msg) != 0)
+  800171:	83 ec 08             	sub    $0x8,%esp
+  800174:	ff 35 00 40 80 00    	push   0x804000
+  80017a:	8d 85 4c fd ff ff    	lea    -0x2b4(%ebp),%eax
+  800180:	50                   	push   %eax
+  800181:	e8 a1 0c 00 00       	call   800e27 <strcmp>
+  800186:	83 c4 10             	add    $0x10,%esp
+  800189:	85 c0                	test   %eax,%eax
+  80018b:	0f 85 8d 03 00 00    	jne    80051e <umain+0x4a0>
+		panic("file_read returned wrong data");
+	cprintf("file_read is good\n");
+  800191:	83 ec 0c             	sub    $0xc,%esp
+  800194:	68 f7 2b 80 00       	push   $0x802bf7
+  800199:	e8 1f 06 00 00       	call   8007bd <cprintf>
+
+	if ((r = devfile.dev_close(FVA)) < 0)
+  80019e:	c7 04 24 00 c0 cc cc 	movl   $0xccccc000,(%esp)
+  8001a5:	ff 15 18 40 80 00    	call   *0x804018
+  8001ab:	83 c4 10             	add    $0x10,%esp
+  8001ae:	85 c0                	test   %eax,%eax
+  8001b0:	0f 88 7c 03 00 00    	js     800532 <umain+0x4b4>
+		panic("file_close: %e", r);
+	cprintf("file_close is good\n");
+  8001b6:	83 ec 0c             	sub    $0xc,%esp
+  8001b9:	68 19 2c 80 00       	push   $0x802c19
+  8001be:	e8 fa 05 00 00       	call   8007bd <cprintf>
+
+	// We're about to unmap the FD, but still need a way to get
+	// the stale filenum to serve_read, so we make a local copy.
+	// The file server won't think it's stale until we unmap the
+	// FD page.
+	fdcopy = *FVA;
+  8001c3:	a1 00 c0 cc cc       	mov    0xccccc000,%eax
+  8001c8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001cb:	a1 04 c0 cc cc       	mov    0xccccc004,%eax
+  8001d0:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8001d3:	a1 08 c0 cc cc       	mov    0xccccc008,%eax
+  8001d8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001db:	a1 0c c0 cc cc       	mov    0xccccc00c,%eax
+  8001e0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	sys_page_unmap(0, FVA);
+  8001e3:	83 c4 08             	add    $0x8,%esp
+  8001e6:	68 00 c0 cc cc       	push   $0xccccc000
+  8001eb:	6a 00                	push   $0x0
+  8001ed:	e8 f5 0f 00 00       	call   8011e7 <sys_page_unmap>
+
+	if ((r = devfile.dev_read(&fdcopy, buf, sizeof buf)) != -E_INVAL)
+  8001f2:	83 c4 0c             	add    $0xc,%esp
+  8001f5:	68 00 02 00 00       	push   $0x200
+  8001fa:	8d 85 4c fd ff ff    	lea    -0x2b4(%ebp),%eax
+  800200:	50                   	push   %eax
+  800201:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  800204:	50                   	push   %eax
+  800205:	ff 15 10 40 80 00    	call   *0x804010
+  80020b:	83 c4 10             	add    $0x10,%esp
+  80020e:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  800211:	0f 85 2d 03 00 00    	jne    800544 <umain+0x4c6>
+		panic("serve_read does not handle stale fileids correctly: %e", r);
+	cprintf("stale fileid is good\n");
+  800217:	83 ec 0c             	sub    $0xc,%esp
+  80021a:	68 2d 2c 80 00       	push   $0x802c2d
+  80021f:	e8 99 05 00 00       	call   8007bd <cprintf>
+
+	// Try writing
+	if ((r = xopen("/new-file", O_RDWR|O_CREAT)) < 0)
+  800224:	ba 02 01 00 00       	mov    $0x102,%edx
+  800229:	b8 43 2c 80 00       	mov    $0x802c43,%eax
+  80022e:	e8 00 fe ff ff       	call   800033 <xopen>
+  800233:	83 c4 10             	add    $0x10,%esp
+  800236:	85 c0                	test   %eax,%eax
+  800238:	0f 88 18 03 00 00    	js     800556 <umain+0x4d8>
+		panic("serve_open /new-file: %e", r);
+
+	if ((r = devfile.dev_write(FVA, msg, strlen(msg))) != strlen(msg))
+  80023e:	8b 1d 14 40 80 00    	mov    0x804014,%ebx
+  800244:	83 ec 0c             	sub    $0xc,%esp
+  800247:	ff 35 00 40 80 00    	push   0x804000
+  80024d:	e8 e9 0a 00 00       	call   800d3b <strlen>
+  800252:	83 c4 0c             	add    $0xc,%esp
+  800255:	50                   	push   %eax
+  800256:	ff 35 00 40 80 00    	push   0x804000
+  80025c:	68 00 c0 cc cc       	push   $0xccccc000
+  800261:	ff d3                	call   *%ebx
+  800263:	89 c3                	mov    %eax,%ebx
+  800265:	83 c4 04             	add    $0x4,%esp
+  800268:	ff 35 00 40 80 00    	push   0x804000
+  80026e:	e8 c8 0a 00 00       	call   800d3b <strlen>
+  800273:	83 c4 10             	add    $0x10,%esp
+  800276:	39 d8                	cmp    %ebx,%eax
+  800278:	0f 85 ea 02 00 00    	jne    800568 <umain+0x4ea>
+		panic("file_write: %e", r);
+	cprintf("file_write is good\n");
+  80027e:	83 ec 0c             	sub    $0xc,%esp
+  800281:	68 75 2c 80 00       	push   $0x802c75
+  800286:	e8 32 05 00 00       	call   8007bd <cprintf>
+
+	FVA->fd_offset = 0;
+  80028b:	c7 05 04 c0 cc cc 00 	movl   $0x0,0xccccc004
+  800292:	00 00 00 
+	memset(buf, 0, sizeof buf);
+  800295:	83 c4 0c             	add    $0xc,%esp
+  800298:	68 00 02 00 00       	push   $0x200
+  80029d:	6a 00                	push   $0x0
+  80029f:	8d 9d 4c fd ff ff    	lea    -0x2b4(%ebp),%ebx
+  8002a5:	53                   	push   %ebx
+  8002a6:	e8 1c 0c 00 00       	call   800ec7 <memset>
+	if ((r = devfile.dev_read(FVA, buf, sizeof buf)) < 0)
+  8002ab:	83 c4 0c             	add    $0xc,%esp
+  8002ae:	68 00 02 00 00       	push   $0x200
+  8002b3:	53                   	push   %ebx
+  8002b4:	68 00 c0 cc cc       	push   $0xccccc000
+  8002b9:	ff 15 10 40 80 00    	call   *0x804010
+  8002bf:	89 c3                	mov    %eax,%ebx
+  8002c1:	83 c4 10             	add    $0x10,%esp
+  8002c4:	85 c0                	test   %eax,%eax
+  8002c6:	0f 88 ae 02 00 00    	js     80057a <umain+0x4fc>
+		panic("file_read after file_write: %e", r);
+	if (r != strlen(msg))
+  8002cc:	83 ec 0c             	sub    $0xc,%esp
+  8002cf:	ff 35 00 40 80 00    	push   0x804000
+  8002d5:	e8 61 0a 00 00       	call   800d3b <strlen>
+  8002da:	83 c4 10             	add    $0x10,%esp
+  8002dd:	39 d8                	cmp    %ebx,%eax
+  8002df:	0f 85 a7 02 00 00    	jne    80058c <umain+0x50e>
+		panic("file_read after file_write returned wrong length: %d", r);
+	if (strcmp(buf, msg) != 0)
+  8002e5:	83 ec 08             	sub    $0x8,%esp
+  8002e8:	ff 35 00 40 80 00    	push   0x804000
+  8002ee:	8d 85 4c fd ff ff    	lea    -0x2b4(%ebp),%eax
+  8002f4:	50                   	push   %eax
+  8002f5:	e8 2d 0b 00 00       	call   800e27 <strcmp>
+  8002fa:	83 c4 10             	add    $0x10,%esp
+  8002fd:	85 c0                	test   %eax,%eax
+  8002ff:	0f 85 99 02 00 00    	jne    80059e <umain+0x520>
+		panic("file_read after file_write returned wrong data");
+	cprintf("file_read after file_write is good\n");
+  800305:	83 ec 0c             	sub    $0xc,%esp
+  800308:	68 3c 2e 80 00       	push   $0x802e3c
+  80030d:	e8 ab 04 00 00       	call   8007bd <cprintf>
+
+	// Now we'll try out open
+	if ((r = open("/not-found", O_RDONLY)) < 0 && r != -E_NOT_FOUND)
+  800312:	83 c4 08             	add    $0x8,%esp
+  800315:	6a 00                	push   $0x0
+  800317:	68 40 2b 80 00       	push   $0x802b40
+  80031c:	e8 61 19 00 00       	call   801c82 <open>
+  800321:	83 c4 10             	add    $0x10,%esp
+  800324:	85 c0                	test   %eax,%eax
+  800326:	0f 89 98 02 00 00    	jns    8005c4 <umain+0x546>
+  80032c:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80032f:	0f 85 7d 02 00 00    	jne    8005b2 <umain+0x534>
+		panic("open /not-found: %e", r);
+	else if (r >= 0)
+		panic("open /not-found succeeded!");
+
+	if ((r = open("/newmotd", O_RDONLY)) < 0)
+  800335:	83 ec 08             	sub    $0x8,%esp
+  800338:	6a 00                	push   $0x0
+  80033a:	68 75 2b 80 00       	push   $0x802b75
+  80033f:	e8 3e 19 00 00       	call   801c82 <open>
+  800344:	83 c4 10             	add    $0x10,%esp
+  800347:	85 c0                	test   %eax,%eax
+  800349:	0f 88 89 02 00 00    	js     8005d8 <umain+0x55a>
+		panic("open /newmotd: %e", r);
+	fd = (struct Fd*) (0xD0000000 + r*PGSIZE);
+  80034f:	c1 e0 0c             	shl    $0xc,%eax
+	if (fd->fd_dev_id != 'f' || fd->fd_offset != 0 || fd->fd_omode != O_RDONLY)
+  800352:	83 b8 00 00 00 d0 66 	cmpl   $0x66,-0x30000000(%eax)
+  800359:	0f 85 8b 02 00 00    	jne    8005ea <umain+0x56c>
+  80035f:	83 b8 04 00 00 d0 00 	cmpl   $0x0,-0x2ffffffc(%eax)
+  800366:	0f 85 7e 02 00 00    	jne    8005ea <umain+0x56c>
+  80036c:	8b 98 08 00 00 d0    	mov    -0x2ffffff8(%eax),%ebx
+  800372:	85 db                	test   %ebx,%ebx
+  800374:	0f 85 70 02 00 00    	jne    8005ea <umain+0x56c>
+		panic("open did not fill struct Fd correctly\n");
+	cprintf("open is good\n");
+  80037a:	83 ec 0c             	sub    $0xc,%esp
+  80037d:	68 9c 2b 80 00       	push   $0x802b9c
+  800382:	e8 36 04 00 00       	call   8007bd <cprintf>
+
+	// Try files with indirect blocks
+	if ((f = open("/big", O_WRONLY|O_CREAT)) < 0)
+  800387:	83 c4 08             	add    $0x8,%esp
+  80038a:	68 01 01 00 00       	push   $0x101
+  80038f:	68 a4 2c 80 00       	push   $0x802ca4
+  800394:	e8 e9 18 00 00       	call   801c82 <open>
+  800399:	89 c7                	mov    %eax,%edi
+  80039b:	83 c4 10             	add    $0x10,%esp
+  80039e:	85 c0                	test   %eax,%eax
+  8003a0:	0f 88 58 02 00 00    	js     8005fe <umain+0x580>
+		panic("creat /big: %e", f);
+	memset(buf, 0, sizeof(buf));
+  8003a6:	83 ec 04             	sub    $0x4,%esp
+  8003a9:	68 00 02 00 00       	push   $0x200
+  8003ae:	6a 00                	push   $0x0
+  8003b0:	8d 85 4c fd ff ff    	lea    -0x2b4(%ebp),%eax
+  8003b6:	50                   	push   %eax
+  8003b7:	e8 0b 0b 00 00       	call   800ec7 <memset>
+  8003bc:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < (NDIRECT*3)*BLKSIZE; i += sizeof(buf)) {
+  8003bf:	89 de                	mov    %ebx,%esi
+		*(int*)buf = i;
+  8003c1:	89 b5 4c fd ff ff    	mov    %esi,-0x2b4(%ebp)
+		if ((r = write(f, buf, sizeof(buf))) < 0)
+  8003c7:	83 ec 04             	sub    $0x4,%esp
+  8003ca:	68 00 02 00 00       	push   $0x200
+  8003cf:	8d 85 4c fd ff ff    	lea    -0x2b4(%ebp),%eax
+  8003d5:	50                   	push   %eax
+  8003d6:	57                   	push   %edi
+  8003d7:	e8 11 15 00 00       	call   8018ed <write>
+  8003dc:	83 c4 10             	add    $0x10,%esp
+  8003df:	85 c0                	test   %eax,%eax
+  8003e1:	0f 88 29 02 00 00    	js     800610 <umain+0x592>
+	for (i = 0; i < (NDIRECT*3)*BLKSIZE; i += sizeof(buf)) {
+  8003e7:	8d 86 00 02 00 00    	lea    0x200(%esi),%eax
+  8003ed:	89 c6                	mov    %eax,%esi
+  8003ef:	3d 00 e0 01 00       	cmp    $0x1e000,%eax
+  8003f4:	75 cb                	jne    8003c1 <umain+0x343>
+			panic("write /big@%d: %e", i, r);
+	}
+	close(f);
+  8003f6:	83 ec 0c             	sub    $0xc,%esp
+  8003f9:	57                   	push   %edi
+  8003fa:	e8 e4 12 00 00       	call   8016e3 <close>
+
+	if ((f = open("/big", O_RDONLY)) < 0)
+  8003ff:	83 c4 08             	add    $0x8,%esp
+  800402:	6a 00                	push   $0x0
+  800404:	68 a4 2c 80 00       	push   $0x802ca4
+  800409:	e8 74 18 00 00       	call   801c82 <open>
+  80040e:	89 c6                	mov    %eax,%esi
+  800410:	83 c4 10             	add    $0x10,%esp
+  800413:	85 c0                	test   %eax,%eax
+  800415:	0f 88 0b 02 00 00    	js     800626 <umain+0x5a8>
+		panic("open /big: %e", f);
+	for (i = 0; i < (NDIRECT*3)*BLKSIZE; i += sizeof(buf)) {
+		*(int*)buf = i;
+		if ((r = readn(f, buf, sizeof(buf))) < 0)
+  80041b:	8d bd 4c fd ff ff    	lea    -0x2b4(%ebp),%edi
+		*(int*)buf = i;
+  800421:	89 9d 4c fd ff ff    	mov    %ebx,-0x2b4(%ebp)
+		if ((r = readn(f, buf, sizeof(buf))) < 0)
+  800427:	83 ec 04             	sub    $0x4,%esp
+  80042a:	68 00 02 00 00       	push   $0x200
+  80042f:	57                   	push   %edi
+  800430:	56                   	push   %esi
+  800431:	e8 70 14 00 00       	call   8018a6 <readn>
+  800436:	83 c4 10             	add    $0x10,%esp
+  800439:	85 c0                	test   %eax,%eax
+  80043b:	0f 88 f7 01 00 00    	js     800638 <umain+0x5ba>
+			panic("read /big@%d: %e", i, r);
+		if (r != sizeof(buf))
+  800441:	3d 00 02 00 00       	cmp    $0x200,%eax
+  800446:	0f 85 02 02 00 00    	jne    80064e <umain+0x5d0>
+			panic("read /big from %d returned %d < %d bytes",
+			      i, r, sizeof(buf));
+		if (*(int*)buf != i)
+  80044c:	8b 85 4c fd ff ff    	mov    -0x2b4(%ebp),%eax
+  800452:	39 d8                	cmp    %ebx,%eax
+  800454:	0f 85 0f 02 00 00    	jne    800669 <umain+0x5eb>
+	for (i = 0; i < (NDIRECT*3)*BLKSIZE; i += sizeof(buf)) {
+  80045a:	8d 83 00 02 00 00    	lea    0x200(%ebx),%eax
+  800460:	89 c3                	mov    %eax,%ebx
+  800462:	3d 00 e0 01 00       	cmp    $0x1e000,%eax
+  800467:	75 b8                	jne    800421 <umain+0x3a3>
+			panic("read /big from %d returned bad data %d",
+			      i, *(int*)buf);
+	}
+	close(f);
+  800469:	83 ec 0c             	sub    $0xc,%esp
+  80046c:	56                   	push   %esi
+  80046d:	e8 71 12 00 00       	call   8016e3 <close>
+	cprintf("large file is good\n");
+  800472:	c7 04 24 e9 2c 80 00 	movl   $0x802ce9,(%esp)
+  800479:	e8 3f 03 00 00       	call   8007bd <cprintf>
+}
+  80047e:	83 c4 10             	add    $0x10,%esp
+  800481:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800484:	5b                   	pop    %ebx
+  800485:	5e                   	pop    %esi
+  800486:	5f                   	pop    %edi
+  800487:	5d                   	pop    %ebp
+  800488:	c3                   	ret
+		panic("serve_open /not-found: %e", r);
+  800489:	50                   	push   %eax
+  80048a:	68 4b 2b 80 00       	push   $0x802b4b
+  80048f:	6a 20                	push   $0x20
+  800491:	68 65 2b 80 00       	push   $0x802b65
+  800496:	e8 47 02 00 00       	call   8006e2 <_panic>
+		panic("serve_open /not-found succeeded!");
+  80049b:	83 ec 04             	sub    $0x4,%esp
+  80049e:	68 00 2d 80 00       	push   $0x802d00
+  8004a3:	6a 22                	push   $0x22
+  8004a5:	68 65 2b 80 00       	push   $0x802b65
+  8004aa:	e8 33 02 00 00       	call   8006e2 <_panic>
+		panic("serve_open /newmotd: %e", r);
+  8004af:	50                   	push   %eax
+  8004b0:	68 7e 2b 80 00       	push   $0x802b7e
+  8004b5:	6a 25                	push   $0x25
+  8004b7:	68 65 2b 80 00       	push   $0x802b65
+  8004bc:	e8 21 02 00 00       	call   8006e2 <_panic>
+		panic("serve_open did not fill struct Fd correctly\n");
+  8004c1:	83 ec 04             	sub    $0x4,%esp
+  8004c4:	68 24 2d 80 00       	push   $0x802d24
+  8004c9:	6a 27                	push   $0x27
+  8004cb:	68 65 2b 80 00       	push   $0x802b65
+  8004d0:	e8 0d 02 00 00       	call   8006e2 <_panic>
+		panic("file_stat: %e", r);
+  8004d5:	50                   	push   %eax
+  8004d6:	68 aa 2b 80 00       	push   $0x802baa
+  8004db:	6a 2b                	push   $0x2b
+  8004dd:	68 65 2b 80 00       	push   $0x802b65
+  8004e2:	e8 fb 01 00 00       	call   8006e2 <_panic>
+		panic("file_stat returned size %d wanted %d\n", st.st_size, strlen(msg));
+  8004e7:	83 ec 0c             	sub    $0xc,%esp
+  8004ea:	ff 35 00 40 80 00    	push   0x804000
+  8004f0:	e8 46 08 00 00       	call   800d3b <strlen>
+  8004f5:	89 04 24             	mov    %eax,(%esp)
+  8004f8:	ff 75 cc             	push   -0x34(%ebp)
+  8004fb:	68 54 2d 80 00       	push   $0x802d54
+  800500:	6a 2d                	push   $0x2d
+  800502:	68 65 2b 80 00       	push   $0x802b65
+  800507:	e8 d6 01 00 00       	call   8006e2 <_panic>
+		panic("file_read: %e", r);
+  80050c:	50                   	push   %eax
+  80050d:	68 cb 2b 80 00       	push   $0x802bcb
+  800512:	6a 32                	push   $0x32
+  800514:	68 65 2b 80 00       	push   $0x802b65
+  800519:	e8 c4 01 00 00       	call   8006e2 <_panic>
+		panic("file_read returned wrong data");
+  80051e:	83 ec 04             	sub    $0x4,%esp
+  800521:	68 d9 2b 80 00       	push   $0x802bd9
+  800526:	6a 34                	push   $0x34
+  800528:	68 65 2b 80 00       	push   $0x802b65
+  80052d:	e8 b0 01 00 00       	call   8006e2 <_panic>
+		panic("file_close: %e", r);
+  800532:	50                   	push   %eax
+  800533:	68 0a 2c 80 00       	push   $0x802c0a
+  800538:	6a 38                	push   $0x38
+  80053a:	68 65 2b 80 00       	push   $0x802b65
+  80053f:	e8 9e 01 00 00       	call   8006e2 <_panic>
+		panic("serve_read does not handle stale fileids correctly: %e", r);
+  800544:	50                   	push   %eax
+  800545:	68 7c 2d 80 00       	push   $0x802d7c
+  80054a:	6a 43                	push   $0x43
+  80054c:	68 65 2b 80 00       	push   $0x802b65
+  800551:	e8 8c 01 00 00       	call   8006e2 <_panic>
+		panic("serve_open /new-file: %e", r);
+  800556:	50                   	push   %eax
+  800557:	68 4d 2c 80 00       	push   $0x802c4d
+  80055c:	6a 48                	push   $0x48
+  80055e:	68 65 2b 80 00       	push   $0x802b65
+  800563:	e8 7a 01 00 00       	call   8006e2 <_panic>
+		panic("file_write: %e", r);
+  800568:	53                   	push   %ebx
+  800569:	68 66 2c 80 00       	push   $0x802c66
+  80056e:	6a 4b                	push   $0x4b
+  800570:	68 65 2b 80 00       	push   $0x802b65
+  800575:	e8 68 01 00 00       	call   8006e2 <_panic>
+		panic("file_read after file_write: %e", r);
+  80057a:	50                   	push   %eax
+  80057b:	68 b4 2d 80 00       	push   $0x802db4
+  800580:	6a 51                	push   $0x51
+  800582:	68 65 2b 80 00       	push   $0x802b65
+  800587:	e8 56 01 00 00       	call   8006e2 <_panic>
+		panic("file_read after file_write returned wrong length: %d", r);
+  80058c:	53                   	push   %ebx
+  80058d:	68 d4 2d 80 00       	push   $0x802dd4
+  800592:	6a 53                	push   $0x53
+  800594:	68 65 2b 80 00       	push   $0x802b65
+  800599:	e8 44 01 00 00       	call   8006e2 <_panic>
+		panic("file_read after file_write returned wrong data");
+  80059e:	83 ec 04             	sub    $0x4,%esp
+  8005a1:	68 0c 2e 80 00       	push   $0x802e0c
+  8005a6:	6a 55                	push   $0x55
+  8005a8:	68 65 2b 80 00       	push   $0x802b65
+  8005ad:	e8 30 01 00 00       	call   8006e2 <_panic>
+		panic("open /not-found: %e", r);
+  8005b2:	50                   	push   %eax
+  8005b3:	68 51 2b 80 00       	push   $0x802b51
+  8005b8:	6a 5a                	push   $0x5a
+  8005ba:	68 65 2b 80 00       	push   $0x802b65
+  8005bf:	e8 1e 01 00 00       	call   8006e2 <_panic>
+		panic("open /not-found succeeded!");
+  8005c4:	83 ec 04             	sub    $0x4,%esp
+  8005c7:	68 89 2c 80 00       	push   $0x802c89
+  8005cc:	6a 5c                	push   $0x5c
+  8005ce:	68 65 2b 80 00       	push   $0x802b65
+  8005d3:	e8 0a 01 00 00       	call   8006e2 <_panic>
+		panic("open /newmotd: %e", r);
+  8005d8:	50                   	push   %eax
+  8005d9:	68 84 2b 80 00       	push   $0x802b84
+  8005de:	6a 5f                	push   $0x5f
+  8005e0:	68 65 2b 80 00       	push   $0x802b65
+  8005e5:	e8 f8 00 00 00       	call   8006e2 <_panic>
+		panic("open did not fill struct Fd correctly\n");
+  8005ea:	83 ec 04             	sub    $0x4,%esp
+  8005ed:	68 60 2e 80 00       	push   $0x802e60
+  8005f2:	6a 62                	push   $0x62
+  8005f4:	68 65 2b 80 00       	push   $0x802b65
+  8005f9:	e8 e4 00 00 00       	call   8006e2 <_panic>
+		panic("creat /big: %e", f);
+  8005fe:	50                   	push   %eax
+  8005ff:	68 a9 2c 80 00       	push   $0x802ca9
+  800604:	6a 67                	push   $0x67
+  800606:	68 65 2b 80 00       	push   $0x802b65
+  80060b:	e8 d2 00 00 00       	call   8006e2 <_panic>
+			panic("write /big@%d: %e", i, r);
+  800610:	83 ec 0c             	sub    $0xc,%esp
+  800613:	50                   	push   %eax
+  800614:	56                   	push   %esi
+  800615:	68 b8 2c 80 00       	push   $0x802cb8
+  80061a:	6a 6c                	push   $0x6c
+  80061c:	68 65 2b 80 00       	push   $0x802b65
+  800621:	e8 bc 00 00 00       	call   8006e2 <_panic>
+		panic("open /big: %e", f);
+  800626:	50                   	push   %eax
+  800627:	68 ca 2c 80 00       	push   $0x802cca
+  80062c:	6a 71                	push   $0x71
+  80062e:	68 65 2b 80 00       	push   $0x802b65
+  800633:	e8 aa 00 00 00       	call   8006e2 <_panic>
+			panic("read /big@%d: %e", i, r);
+  800638:	83 ec 0c             	sub    $0xc,%esp
+  80063b:	50                   	push   %eax
+  80063c:	53                   	push   %ebx
+  80063d:	68 d8 2c 80 00       	push   $0x802cd8
+  800642:	6a 75                	push   $0x75
+  800644:	68 65 2b 80 00       	push   $0x802b65
+  800649:	e8 94 00 00 00       	call   8006e2 <_panic>
+			panic("read /big from %d returned %d < %d bytes",
+  80064e:	83 ec 08             	sub    $0x8,%esp
+  800651:	68 00 02 00 00       	push   $0x200
+  800656:	50                   	push   %eax
+  800657:	53                   	push   %ebx
+  800658:	68 88 2e 80 00       	push   $0x802e88
+  80065d:	6a 77                	push   $0x77
+  80065f:	68 65 2b 80 00       	push   $0x802b65
+  800664:	e8 79 00 00 00       	call   8006e2 <_panic>
+			panic("read /big from %d returned bad data %d",
+  800669:	83 ec 0c             	sub    $0xc,%esp
+  80066c:	50                   	push   %eax
+  80066d:	53                   	push   %ebx
+  80066e:	68 b4 2e 80 00       	push   $0x802eb4
+  800673:	6a 7a                	push   $0x7a
+  800675:	68 65 2b 80 00       	push   $0x802b65
+  80067a:	e8 63 00 00 00       	call   8006e2 <_panic>
+
+0080067f <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  80067f:	55                   	push   %ebp
+  800680:	89 e5                	mov    %esp,%ebp
+  800682:	56                   	push   %esi
+  800683:	53                   	push   %ebx
+  800684:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800687:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  80068a:	e8 95 0a 00 00       	call   801124 <sys_getenvid>
+  80068f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800694:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800697:	c1 e0 04             	shl    $0x4,%eax
+  80069a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80069f:	a3 08 50 80 00       	mov    %eax,0x805008
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8006a4:	85 db                	test   %ebx,%ebx
+  8006a6:	7e 07                	jle    8006af <libmain+0x30>
+    binaryname = argv[0];
+  8006a8:	8b 06                	mov    (%esi),%eax
+  8006aa:	a3 04 40 80 00       	mov    %eax,0x804004
+
+  // call user main routine
+  umain(argc, argv);
+  8006af:	83 ec 08             	sub    $0x8,%esp
+  8006b2:	56                   	push   %esi
+  8006b3:	53                   	push   %ebx
+  8006b4:	e8 c5 f9 ff ff       	call   80007e <umain>
+
+  // exit gracefully
+  exit();
+  8006b9:	e8 0a 00 00 00       	call   8006c8 <exit>
+}
+  8006be:	83 c4 10             	add    $0x10,%esp
+  8006c1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8006c4:	5b                   	pop    %ebx
+  8006c5:	5e                   	pop    %esi
+  8006c6:	5d                   	pop    %ebp
+  8006c7:	c3                   	ret
+
+008006c8 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8006c8:	55                   	push   %ebp
+  8006c9:	89 e5                	mov    %esp,%ebp
+  8006cb:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8006ce:	e8 3d 10 00 00       	call   801710 <close_all>
+	sys_env_destroy(0);
+  8006d3:	83 ec 0c             	sub    $0xc,%esp
+  8006d6:	6a 00                	push   $0x0
+  8006d8:	e8 06 0a 00 00       	call   8010e3 <sys_env_destroy>
+}
+  8006dd:	83 c4 10             	add    $0x10,%esp
+  8006e0:	c9                   	leave
+  8006e1:	c3                   	ret
+
+008006e2 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8006e2:	55                   	push   %ebp
+  8006e3:	89 e5                	mov    %esp,%ebp
+  8006e5:	56                   	push   %esi
+  8006e6:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8006e7:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8006ea:	8b 35 04 40 80 00    	mov    0x804004,%esi
+  8006f0:	e8 2f 0a 00 00       	call   801124 <sys_getenvid>
+  8006f5:	83 ec 0c             	sub    $0xc,%esp
+  8006f8:	ff 75 0c             	push   0xc(%ebp)
+  8006fb:	ff 75 08             	push   0x8(%ebp)
+  8006fe:	56                   	push   %esi
+  8006ff:	50                   	push   %eax
+  800700:	68 0c 2f 80 00       	push   $0x802f0c
+  800705:	e8 b3 00 00 00       	call   8007bd <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80070a:	83 c4 18             	add    $0x18,%esp
+  80070d:	53                   	push   %ebx
+  80070e:	ff 75 10             	push   0x10(%ebp)
+  800711:	e8 56 00 00 00       	call   80076c <vcprintf>
+	cprintf("\n");
+  800716:	c7 04 24 9c 33 80 00 	movl   $0x80339c,(%esp)
+  80071d:	e8 9b 00 00 00       	call   8007bd <cprintf>
+  800722:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800725:	cc                   	int3
+	while (1)
+  800726:	eb fd                	jmp    800725 <_panic+0x43>
+
+00800728 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800728:	55                   	push   %ebp
+  800729:	89 e5                	mov    %esp,%ebp
+  80072b:	53                   	push   %ebx
+  80072c:	83 ec 04             	sub    $0x4,%esp
+  80072f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800732:	8b 13                	mov    (%ebx),%edx
+  800734:	8d 42 01             	lea    0x1(%edx),%eax
+  800737:	89 03                	mov    %eax,(%ebx)
+  800739:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80073c:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800740:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800745:	74 09                	je     800750 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800747:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80074b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80074e:	c9                   	leave
+  80074f:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800750:	83 ec 08             	sub    $0x8,%esp
+  800753:	68 ff 00 00 00       	push   $0xff
+  800758:	8d 43 08             	lea    0x8(%ebx),%eax
+  80075b:	50                   	push   %eax
+  80075c:	e8 45 09 00 00       	call   8010a6 <sys_cputs>
+		b->idx = 0;
+  800761:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800767:	83 c4 10             	add    $0x10,%esp
+  80076a:	eb db                	jmp    800747 <putch+0x1f>
+
+0080076c <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80076c:	55                   	push   %ebp
+  80076d:	89 e5                	mov    %esp,%ebp
+  80076f:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800775:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80077c:	00 00 00 
+	b.cnt = 0;
+  80077f:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800786:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800789:	ff 75 0c             	push   0xc(%ebp)
+  80078c:	ff 75 08             	push   0x8(%ebp)
+  80078f:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800795:	50                   	push   %eax
+  800796:	68 28 07 80 00       	push   $0x800728
+  80079b:	e8 14 01 00 00       	call   8008b4 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8007a0:	83 c4 08             	add    $0x8,%esp
+  8007a3:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8007a9:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8007af:	50                   	push   %eax
+  8007b0:	e8 f1 08 00 00       	call   8010a6 <sys_cputs>
+
+	return b.cnt;
+}
+  8007b5:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8007bb:	c9                   	leave
+  8007bc:	c3                   	ret
+
+008007bd <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8007bd:	55                   	push   %ebp
+  8007be:	89 e5                	mov    %esp,%ebp
+  8007c0:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8007c3:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8007c6:	50                   	push   %eax
+  8007c7:	ff 75 08             	push   0x8(%ebp)
+  8007ca:	e8 9d ff ff ff       	call   80076c <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8007cf:	c9                   	leave
+  8007d0:	c3                   	ret
+
+008007d1 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8007d1:	55                   	push   %ebp
+  8007d2:	89 e5                	mov    %esp,%ebp
+  8007d4:	57                   	push   %edi
+  8007d5:	56                   	push   %esi
+  8007d6:	53                   	push   %ebx
+  8007d7:	83 ec 1c             	sub    $0x1c,%esp
+  8007da:	89 c7                	mov    %eax,%edi
+  8007dc:	89 d6                	mov    %edx,%esi
+  8007de:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007e1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007e4:	89 d1                	mov    %edx,%ecx
+  8007e6:	89 c2                	mov    %eax,%edx
+  8007e8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007eb:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8007ee:	8b 45 10             	mov    0x10(%ebp),%eax
+  8007f1:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8007f4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8007f7:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8007fe:	39 c2                	cmp    %eax,%edx
+  800800:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800803:	72 3e                	jb     800843 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800805:	83 ec 0c             	sub    $0xc,%esp
+  800808:	ff 75 18             	push   0x18(%ebp)
+  80080b:	83 eb 01             	sub    $0x1,%ebx
+  80080e:	53                   	push   %ebx
+  80080f:	50                   	push   %eax
+  800810:	83 ec 08             	sub    $0x8,%esp
+  800813:	ff 75 e4             	push   -0x1c(%ebp)
+  800816:	ff 75 e0             	push   -0x20(%ebp)
+  800819:	ff 75 dc             	push   -0x24(%ebp)
+  80081c:	ff 75 d8             	push   -0x28(%ebp)
+  80081f:	e8 7c 1f 00 00       	call   8027a0 <__udivdi3>
+  800824:	83 c4 18             	add    $0x18,%esp
+  800827:	52                   	push   %edx
+  800828:	50                   	push   %eax
+  800829:	89 f2                	mov    %esi,%edx
+  80082b:	89 f8                	mov    %edi,%eax
+  80082d:	e8 9f ff ff ff       	call   8007d1 <printnum>
+  800832:	83 c4 20             	add    $0x20,%esp
+  800835:	eb 13                	jmp    80084a <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800837:	83 ec 08             	sub    $0x8,%esp
+  80083a:	56                   	push   %esi
+  80083b:	ff 75 18             	push   0x18(%ebp)
+  80083e:	ff d7                	call   *%edi
+  800840:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800843:	83 eb 01             	sub    $0x1,%ebx
+  800846:	85 db                	test   %ebx,%ebx
+  800848:	7f ed                	jg     800837 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80084a:	83 ec 08             	sub    $0x8,%esp
+  80084d:	56                   	push   %esi
+  80084e:	83 ec 04             	sub    $0x4,%esp
+  800851:	ff 75 e4             	push   -0x1c(%ebp)
+  800854:	ff 75 e0             	push   -0x20(%ebp)
+  800857:	ff 75 dc             	push   -0x24(%ebp)
+  80085a:	ff 75 d8             	push   -0x28(%ebp)
+  80085d:	e8 0e 20 00 00       	call   802870 <__umoddi3>
+  800862:	83 c4 14             	add    $0x14,%esp
+  800865:	0f be 80 2f 2f 80 00 	movsbl 0x802f2f(%eax),%eax
+  80086c:	50                   	push   %eax
+  80086d:	ff d7                	call   *%edi
+}
+  80086f:	83 c4 10             	add    $0x10,%esp
+  800872:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800875:	5b                   	pop    %ebx
+  800876:	5e                   	pop    %esi
+  800877:	5f                   	pop    %edi
+  800878:	5d                   	pop    %ebp
+  800879:	c3                   	ret
+
+0080087a <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80087a:	55                   	push   %ebp
+  80087b:	89 e5                	mov    %esp,%ebp
+  80087d:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800880:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800884:	8b 10                	mov    (%eax),%edx
+  800886:	3b 50 04             	cmp    0x4(%eax),%edx
+  800889:	73 0a                	jae    800895 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80088b:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80088e:	89 08                	mov    %ecx,(%eax)
+  800890:	8b 45 08             	mov    0x8(%ebp),%eax
+  800893:	88 02                	mov    %al,(%edx)
+}
+  800895:	5d                   	pop    %ebp
+  800896:	c3                   	ret
+
+00800897 <printfmt>:
+{
+  800897:	55                   	push   %ebp
+  800898:	89 e5                	mov    %esp,%ebp
+  80089a:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80089d:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8008a0:	50                   	push   %eax
+  8008a1:	ff 75 10             	push   0x10(%ebp)
+  8008a4:	ff 75 0c             	push   0xc(%ebp)
+  8008a7:	ff 75 08             	push   0x8(%ebp)
+  8008aa:	e8 05 00 00 00       	call   8008b4 <vprintfmt>
+}
+  8008af:	83 c4 10             	add    $0x10,%esp
+  8008b2:	c9                   	leave
+  8008b3:	c3                   	ret
+
+008008b4 <vprintfmt>:
+{
+  8008b4:	55                   	push   %ebp
+  8008b5:	89 e5                	mov    %esp,%ebp
+  8008b7:	57                   	push   %edi
+  8008b8:	56                   	push   %esi
+  8008b9:	53                   	push   %ebx
+  8008ba:	83 ec 2c             	sub    $0x2c,%esp
+  8008bd:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008c0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8008c3:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8008c6:	eb 0a                	jmp    8008d2 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8008c8:	83 ec 08             	sub    $0x8,%esp
+  8008cb:	53                   	push   %ebx
+  8008cc:	50                   	push   %eax
+  8008cd:	ff d6                	call   *%esi
+  8008cf:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8008d2:	83 c7 01             	add    $0x1,%edi
+  8008d5:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8008d9:	83 f8 25             	cmp    $0x25,%eax
+  8008dc:	74 0c                	je     8008ea <vprintfmt+0x36>
+			if (ch == '\0')
+  8008de:	85 c0                	test   %eax,%eax
+  8008e0:	75 e6                	jne    8008c8 <vprintfmt+0x14>
+}
+  8008e2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8008e5:	5b                   	pop    %ebx
+  8008e6:	5e                   	pop    %esi
+  8008e7:	5f                   	pop    %edi
+  8008e8:	5d                   	pop    %ebp
+  8008e9:	c3                   	ret
+		padc = ' ';
+  8008ea:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8008ee:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8008f5:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8008fc:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800903:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800908:	8d 47 01             	lea    0x1(%edi),%eax
+  80090b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80090e:	0f b6 17             	movzbl (%edi),%edx
+  800911:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800914:	3c 55                	cmp    $0x55,%al
+  800916:	0f 87 9a 03 00 00    	ja     800cb6 <vprintfmt+0x402>
+  80091c:	0f b6 c0             	movzbl %al,%eax
+  80091f:	ff 24 85 80 30 80 00 	jmp    *0x803080(,%eax,4)
+  800926:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800929:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80092d:	eb d9                	jmp    800908 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80092f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800932:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800936:	eb d0                	jmp    800908 <vprintfmt+0x54>
+  800938:	0f b6 d2             	movzbl %dl,%edx
+  80093b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80093e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800943:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800946:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800949:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80094d:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800950:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800953:	83 f9 09             	cmp    $0x9,%ecx
+  800956:	77 55                	ja     8009ad <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800958:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  80095b:	eb e9                	jmp    800946 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  80095d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800960:	8b 00                	mov    (%eax),%eax
+  800962:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800965:	8b 45 14             	mov    0x14(%ebp),%eax
+  800968:	8d 40 04             	lea    0x4(%eax),%eax
+  80096b:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80096e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800971:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800975:	79 91                	jns    800908 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800977:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80097a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80097d:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800984:	eb 82                	jmp    800908 <vprintfmt+0x54>
+			if (width < 0)
+  800986:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800989:	85 d2                	test   %edx,%edx
+  80098b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800990:	0f 49 c2             	cmovns %edx,%eax
+  800993:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800996:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800999:	e9 6a ff ff ff       	jmp    800908 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80099e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8009a1:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8009a8:	e9 5b ff ff ff       	jmp    800908 <vprintfmt+0x54>
+  8009ad:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8009b0:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8009b3:	eb bc                	jmp    800971 <vprintfmt+0xbd>
+			lflag++;
+  8009b5:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8009b8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8009bb:	e9 48 ff ff ff       	jmp    800908 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8009c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009c3:	8d 78 04             	lea    0x4(%eax),%edi
+  8009c6:	83 ec 08             	sub    $0x8,%esp
+  8009c9:	53                   	push   %ebx
+  8009ca:	ff 30                	push   (%eax)
+  8009cc:	ff d6                	call   *%esi
+			break;
+  8009ce:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8009d1:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8009d4:	e9 7c 02 00 00       	jmp    800c55 <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  8009d9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009dc:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8009df:	8b 10                	mov    (%eax),%edx
+  8009e1:	89 d0                	mov    %edx,%eax
+  8009e3:	f7 d8                	neg    %eax
+  8009e5:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8009e8:	83 f8 10             	cmp    $0x10,%eax
+  8009eb:	7f 23                	jg     800a10 <vprintfmt+0x15c>
+  8009ed:	8b 14 85 e0 31 80 00 	mov    0x8031e0(,%eax,4),%edx
+  8009f4:	85 d2                	test   %edx,%edx
+  8009f6:	74 18                	je     800a10 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8009f8:	52                   	push   %edx
+  8009f9:	68 31 33 80 00       	push   $0x803331
+  8009fe:	53                   	push   %ebx
+  8009ff:	56                   	push   %esi
+  800a00:	e8 92 fe ff ff       	call   800897 <printfmt>
+  800a05:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800a08:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800a0b:	e9 45 02 00 00       	jmp    800c55 <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  800a10:	50                   	push   %eax
+  800a11:	68 47 2f 80 00       	push   $0x802f47
+  800a16:	53                   	push   %ebx
+  800a17:	56                   	push   %esi
+  800a18:	e8 7a fe ff ff       	call   800897 <printfmt>
+  800a1d:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800a20:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800a23:	e9 2d 02 00 00       	jmp    800c55 <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800a28:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a2b:	83 c0 04             	add    $0x4,%eax
+  800a2e:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800a31:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a34:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800a36:	85 c9                	test   %ecx,%ecx
+  800a38:	b8 40 2f 80 00       	mov    $0x802f40,%eax
+  800a3d:	0f 45 c1             	cmovne %ecx,%eax
+  800a40:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800a43:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800a47:	7e 06                	jle    800a4f <vprintfmt+0x19b>
+  800a49:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800a4d:	75 0b                	jne    800a5a <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800a4f:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800a52:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800a55:	89 75 08             	mov    %esi,0x8(%ebp)
+  800a58:	eb 5c                	jmp    800ab6 <vprintfmt+0x202>
+  800a5a:	83 ec 08             	sub    $0x8,%esp
+  800a5d:	ff 75 d0             	push   -0x30(%ebp)
+  800a60:	ff 75 cc             	push   -0x34(%ebp)
+  800a63:	e8 eb 02 00 00       	call   800d53 <strnlen>
+  800a68:	89 c2                	mov    %eax,%edx
+  800a6a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800a6d:	29 d0                	sub    %edx,%eax
+  800a6f:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800a72:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800a76:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800a79:	89 75 08             	mov    %esi,0x8(%ebp)
+  800a7c:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800a7e:	eb 0e                	jmp    800a8e <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800a80:	83 ec 08             	sub    $0x8,%esp
+  800a83:	53                   	push   %ebx
+  800a84:	57                   	push   %edi
+  800a85:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800a88:	83 ee 01             	sub    $0x1,%esi
+  800a8b:	83 c4 10             	add    $0x10,%esp
+  800a8e:	85 f6                	test   %esi,%esi
+  800a90:	7f ee                	jg     800a80 <vprintfmt+0x1cc>
+  800a92:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800a95:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a98:	85 c0                	test   %eax,%eax
+  800a9a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a9f:	0f 49 d0             	cmovns %eax,%edx
+  800aa2:	29 d0                	sub    %edx,%eax
+  800aa4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800aa7:	eb a6                	jmp    800a4f <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800aa9:	83 ec 08             	sub    $0x8,%esp
+  800aac:	53                   	push   %ebx
+  800aad:	52                   	push   %edx
+  800aae:	ff 55 08             	call   *0x8(%ebp)
+  800ab1:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800ab4:	89 f1                	mov    %esi,%ecx
+  800ab6:	8d 71 01             	lea    0x1(%ecx),%esi
+  800ab9:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800abd:	0f be d0             	movsbl %al,%edx
+  800ac0:	85 d2                	test   %edx,%edx
+  800ac2:	74 28                	je     800aec <vprintfmt+0x238>
+  800ac4:	85 ff                	test   %edi,%edi
+  800ac6:	78 05                	js     800acd <vprintfmt+0x219>
+  800ac8:	83 ef 01             	sub    $0x1,%edi
+  800acb:	78 30                	js     800afd <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800acd:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800ad1:	74 d6                	je     800aa9 <vprintfmt+0x1f5>
+  800ad3:	0f be c0             	movsbl %al,%eax
+  800ad6:	83 e8 20             	sub    $0x20,%eax
+  800ad9:	83 f8 5e             	cmp    $0x5e,%eax
+  800adc:	76 cb                	jbe    800aa9 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800ade:	83 ec 08             	sub    $0x8,%esp
+  800ae1:	53                   	push   %ebx
+  800ae2:	6a 3f                	push   $0x3f
+  800ae4:	ff 55 08             	call   *0x8(%ebp)
+  800ae7:	83 c4 10             	add    $0x10,%esp
+  800aea:	eb c8                	jmp    800ab4 <vprintfmt+0x200>
+  800aec:	8b 75 08             	mov    0x8(%ebp),%esi
+  800aef:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800af2:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800af5:	01 d0                	add    %edx,%eax
+  800af7:	29 c8                	sub    %ecx,%eax
+  800af9:	89 c7                	mov    %eax,%edi
+  800afb:	eb 13                	jmp    800b10 <vprintfmt+0x25c>
+  800afd:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b00:	eb ed                	jmp    800aef <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800b02:	83 ec 08             	sub    $0x8,%esp
+  800b05:	53                   	push   %ebx
+  800b06:	6a 20                	push   $0x20
+  800b08:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800b0a:	83 ef 01             	sub    $0x1,%edi
+  800b0d:	83 c4 10             	add    $0x10,%esp
+  800b10:	85 ff                	test   %edi,%edi
+  800b12:	7f ee                	jg     800b02 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800b14:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800b17:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b1a:	e9 36 01 00 00       	jmp    800c55 <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  800b1f:	83 f9 01             	cmp    $0x1,%ecx
+  800b22:	7f 1f                	jg     800b43 <vprintfmt+0x28f>
+	else if (lflag)
+  800b24:	85 c9                	test   %ecx,%ecx
+  800b26:	74 67                	je     800b8f <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800b28:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b2b:	8b 00                	mov    (%eax),%eax
+  800b2d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800b30:	89 c1                	mov    %eax,%ecx
+  800b32:	c1 f9 1f             	sar    $0x1f,%ecx
+  800b35:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800b38:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b3b:	8d 40 04             	lea    0x4(%eax),%eax
+  800b3e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b41:	eb 17                	jmp    800b5a <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800b43:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b46:	8b 50 04             	mov    0x4(%eax),%edx
+  800b49:	8b 00                	mov    (%eax),%eax
+  800b4b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800b4e:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800b51:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b54:	8d 40 08             	lea    0x8(%eax),%eax
+  800b57:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800b5a:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800b5d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800b60:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800b65:	85 c9                	test   %ecx,%ecx
+  800b67:	0f 89 ce 00 00 00    	jns    800c3b <vprintfmt+0x387>
+				putch('-', putdat);
+  800b6d:	83 ec 08             	sub    $0x8,%esp
+  800b70:	53                   	push   %ebx
+  800b71:	6a 2d                	push   $0x2d
+  800b73:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800b75:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800b78:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800b7b:	f7 da                	neg    %edx
+  800b7d:	83 d1 00             	adc    $0x0,%ecx
+  800b80:	f7 d9                	neg    %ecx
+  800b82:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800b85:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800b8a:	e9 ac 00 00 00       	jmp    800c3b <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  800b8f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b92:	8b 00                	mov    (%eax),%eax
+  800b94:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800b97:	89 c1                	mov    %eax,%ecx
+  800b99:	c1 f9 1f             	sar    $0x1f,%ecx
+  800b9c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800b9f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ba2:	8d 40 04             	lea    0x4(%eax),%eax
+  800ba5:	89 45 14             	mov    %eax,0x14(%ebp)
+  800ba8:	eb b0                	jmp    800b5a <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800baa:	83 f9 01             	cmp    $0x1,%ecx
+  800bad:	7f 1b                	jg     800bca <vprintfmt+0x316>
+	else if (lflag)
+  800baf:	85 c9                	test   %ecx,%ecx
+  800bb1:	74 2c                	je     800bdf <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  800bb3:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bb6:	8b 10                	mov    (%eax),%edx
+  800bb8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bbd:	8d 40 04             	lea    0x4(%eax),%eax
+  800bc0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800bc3:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800bc8:	eb 71                	jmp    800c3b <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  800bca:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bcd:	8b 10                	mov    (%eax),%edx
+  800bcf:	8b 48 04             	mov    0x4(%eax),%ecx
+  800bd2:	8d 40 08             	lea    0x8(%eax),%eax
+  800bd5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800bd8:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800bdd:	eb 5c                	jmp    800c3b <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  800bdf:	8b 45 14             	mov    0x14(%ebp),%eax
+  800be2:	8b 10                	mov    (%eax),%edx
+  800be4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800be9:	8d 40 04             	lea    0x4(%eax),%eax
+  800bec:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800bef:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800bf4:	eb 45                	jmp    800c3b <vprintfmt+0x387>
+			putch('X', putdat);
+  800bf6:	83 ec 08             	sub    $0x8,%esp
+  800bf9:	53                   	push   %ebx
+  800bfa:	6a 58                	push   $0x58
+  800bfc:	ff d6                	call   *%esi
+			putch('X', putdat);
+  800bfe:	83 c4 08             	add    $0x8,%esp
+  800c01:	53                   	push   %ebx
+  800c02:	6a 58                	push   $0x58
+  800c04:	ff d6                	call   *%esi
+			putch('X', putdat);
+  800c06:	83 c4 08             	add    $0x8,%esp
+  800c09:	53                   	push   %ebx
+  800c0a:	6a 58                	push   $0x58
+  800c0c:	ff d6                	call   *%esi
+			break;
+  800c0e:	83 c4 10             	add    $0x10,%esp
+  800c11:	eb 42                	jmp    800c55 <vprintfmt+0x3a1>
+			putch('0', putdat);
+  800c13:	83 ec 08             	sub    $0x8,%esp
+  800c16:	53                   	push   %ebx
+  800c17:	6a 30                	push   $0x30
+  800c19:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800c1b:	83 c4 08             	add    $0x8,%esp
+  800c1e:	53                   	push   %ebx
+  800c1f:	6a 78                	push   $0x78
+  800c21:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800c23:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c26:	8b 10                	mov    (%eax),%edx
+  800c28:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800c2d:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800c30:	8d 40 04             	lea    0x4(%eax),%eax
+  800c33:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800c36:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800c3b:	83 ec 0c             	sub    $0xc,%esp
+  800c3e:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800c42:	50                   	push   %eax
+  800c43:	ff 75 e0             	push   -0x20(%ebp)
+  800c46:	57                   	push   %edi
+  800c47:	51                   	push   %ecx
+  800c48:	52                   	push   %edx
+  800c49:	89 da                	mov    %ebx,%edx
+  800c4b:	89 f0                	mov    %esi,%eax
+  800c4d:	e8 7f fb ff ff       	call   8007d1 <printnum>
+			break;
+  800c52:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800c55:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800c58:	e9 75 fc ff ff       	jmp    8008d2 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800c5d:	83 f9 01             	cmp    $0x1,%ecx
+  800c60:	7f 1b                	jg     800c7d <vprintfmt+0x3c9>
+	else if (lflag)
+  800c62:	85 c9                	test   %ecx,%ecx
+  800c64:	74 2c                	je     800c92 <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  800c66:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c69:	8b 10                	mov    (%eax),%edx
+  800c6b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c70:	8d 40 04             	lea    0x4(%eax),%eax
+  800c73:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800c76:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800c7b:	eb be                	jmp    800c3b <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  800c7d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c80:	8b 10                	mov    (%eax),%edx
+  800c82:	8b 48 04             	mov    0x4(%eax),%ecx
+  800c85:	8d 40 08             	lea    0x8(%eax),%eax
+  800c88:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800c8b:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800c90:	eb a9                	jmp    800c3b <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  800c92:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c95:	8b 10                	mov    (%eax),%edx
+  800c97:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c9c:	8d 40 04             	lea    0x4(%eax),%eax
+  800c9f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800ca2:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800ca7:	eb 92                	jmp    800c3b <vprintfmt+0x387>
+			putch(ch, putdat);
+  800ca9:	83 ec 08             	sub    $0x8,%esp
+  800cac:	53                   	push   %ebx
+  800cad:	6a 25                	push   $0x25
+  800caf:	ff d6                	call   *%esi
+			break;
+  800cb1:	83 c4 10             	add    $0x10,%esp
+  800cb4:	eb 9f                	jmp    800c55 <vprintfmt+0x3a1>
+			putch('%', putdat);
+  800cb6:	83 ec 08             	sub    $0x8,%esp
+  800cb9:	53                   	push   %ebx
+  800cba:	6a 25                	push   $0x25
+  800cbc:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800cbe:	83 c4 10             	add    $0x10,%esp
+  800cc1:	89 f8                	mov    %edi,%eax
+  800cc3:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800cc7:	74 05                	je     800cce <vprintfmt+0x41a>
+  800cc9:	83 e8 01             	sub    $0x1,%eax
+  800ccc:	eb f5                	jmp    800cc3 <vprintfmt+0x40f>
+  800cce:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800cd1:	eb 82                	jmp    800c55 <vprintfmt+0x3a1>
+
+00800cd3 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800cd3:	55                   	push   %ebp
+  800cd4:	89 e5                	mov    %esp,%ebp
+  800cd6:	83 ec 18             	sub    $0x18,%esp
+  800cd9:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cdc:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800cdf:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800ce2:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800ce6:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800ce9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800cf0:	85 c0                	test   %eax,%eax
+  800cf2:	74 26                	je     800d1a <vsnprintf+0x47>
+  800cf4:	85 d2                	test   %edx,%edx
+  800cf6:	7e 22                	jle    800d1a <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800cf8:	ff 75 14             	push   0x14(%ebp)
+  800cfb:	ff 75 10             	push   0x10(%ebp)
+  800cfe:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800d01:	50                   	push   %eax
+  800d02:	68 7a 08 80 00       	push   $0x80087a
+  800d07:	e8 a8 fb ff ff       	call   8008b4 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800d0c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800d0f:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800d12:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800d15:	83 c4 10             	add    $0x10,%esp
+}
+  800d18:	c9                   	leave
+  800d19:	c3                   	ret
+		return -E_INVAL;
+  800d1a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d1f:	eb f7                	jmp    800d18 <vsnprintf+0x45>
+
+00800d21 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800d21:	55                   	push   %ebp
+  800d22:	89 e5                	mov    %esp,%ebp
+  800d24:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800d27:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800d2a:	50                   	push   %eax
+  800d2b:	ff 75 10             	push   0x10(%ebp)
+  800d2e:	ff 75 0c             	push   0xc(%ebp)
+  800d31:	ff 75 08             	push   0x8(%ebp)
+  800d34:	e8 9a ff ff ff       	call   800cd3 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800d39:	c9                   	leave
+  800d3a:	c3                   	ret
+
+00800d3b <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800d3b:	55                   	push   %ebp
+  800d3c:	89 e5                	mov    %esp,%ebp
+  800d3e:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800d41:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d46:	eb 03                	jmp    800d4b <strlen+0x10>
+		n++;
+  800d48:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800d4b:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800d4f:	75 f7                	jne    800d48 <strlen+0xd>
+	return n;
+}
+  800d51:	5d                   	pop    %ebp
+  800d52:	c3                   	ret
+
+00800d53 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800d53:	55                   	push   %ebp
+  800d54:	89 e5                	mov    %esp,%ebp
+  800d56:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800d59:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800d5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d61:	eb 03                	jmp    800d66 <strnlen+0x13>
+		n++;
+  800d63:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800d66:	39 d0                	cmp    %edx,%eax
+  800d68:	74 08                	je     800d72 <strnlen+0x1f>
+  800d6a:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800d6e:	75 f3                	jne    800d63 <strnlen+0x10>
+  800d70:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800d72:	89 d0                	mov    %edx,%eax
+  800d74:	5d                   	pop    %ebp
+  800d75:	c3                   	ret
+
+00800d76 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800d76:	55                   	push   %ebp
+  800d77:	89 e5                	mov    %esp,%ebp
+  800d79:	53                   	push   %ebx
+  800d7a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800d7d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800d80:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d85:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800d89:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800d8c:	83 c0 01             	add    $0x1,%eax
+  800d8f:	84 d2                	test   %dl,%dl
+  800d91:	75 f2                	jne    800d85 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800d93:	89 c8                	mov    %ecx,%eax
+  800d95:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d98:	c9                   	leave
+  800d99:	c3                   	ret
+
+00800d9a <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800d9a:	55                   	push   %ebp
+  800d9b:	89 e5                	mov    %esp,%ebp
+  800d9d:	53                   	push   %ebx
+  800d9e:	83 ec 10             	sub    $0x10,%esp
+  800da1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800da4:	53                   	push   %ebx
+  800da5:	e8 91 ff ff ff       	call   800d3b <strlen>
+  800daa:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800dad:	ff 75 0c             	push   0xc(%ebp)
+  800db0:	01 d8                	add    %ebx,%eax
+  800db2:	50                   	push   %eax
+  800db3:	e8 be ff ff ff       	call   800d76 <strcpy>
+	return dst;
+}
+  800db8:	89 d8                	mov    %ebx,%eax
+  800dba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800dbd:	c9                   	leave
+  800dbe:	c3                   	ret
+
+00800dbf <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800dbf:	55                   	push   %ebp
+  800dc0:	89 e5                	mov    %esp,%ebp
+  800dc2:	56                   	push   %esi
+  800dc3:	53                   	push   %ebx
+  800dc4:	8b 75 08             	mov    0x8(%ebp),%esi
+  800dc7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800dca:	89 f3                	mov    %esi,%ebx
+  800dcc:	03 5d 10             	add    0x10(%ebp),%ebx
+  800dcf:	89 f0                	mov    %esi,%eax
+  800dd1:	eb 0f                	jmp    800de2 <strncpy+0x23>
+		*dst++ = *src;
+  800dd3:	83 c0 01             	add    $0x1,%eax
+  800dd6:	0f b6 0a             	movzbl (%edx),%ecx
+  800dd9:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800ddc:	80 f9 01             	cmp    $0x1,%cl
+  800ddf:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800de2:	39 d8                	cmp    %ebx,%eax
+  800de4:	75 ed                	jne    800dd3 <strncpy+0x14>
+	}
+	return ret;
+}
+  800de6:	89 f0                	mov    %esi,%eax
+  800de8:	5b                   	pop    %ebx
+  800de9:	5e                   	pop    %esi
+  800dea:	5d                   	pop    %ebp
+  800deb:	c3                   	ret
+
+00800dec <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800dec:	55                   	push   %ebp
+  800ded:	89 e5                	mov    %esp,%ebp
+  800def:	56                   	push   %esi
+  800df0:	53                   	push   %ebx
+  800df1:	8b 75 08             	mov    0x8(%ebp),%esi
+  800df4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800df7:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800dfa:	89 f0                	mov    %esi,%eax
+  800dfc:	85 d2                	test   %edx,%edx
+  800dfe:	74 21                	je     800e21 <strlcpy+0x35>
+  800e00:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800e04:	89 f2                	mov    %esi,%edx
+  800e06:	eb 09                	jmp    800e11 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800e08:	83 c1 01             	add    $0x1,%ecx
+  800e0b:	83 c2 01             	add    $0x1,%edx
+  800e0e:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800e11:	39 c2                	cmp    %eax,%edx
+  800e13:	74 09                	je     800e1e <strlcpy+0x32>
+  800e15:	0f b6 19             	movzbl (%ecx),%ebx
+  800e18:	84 db                	test   %bl,%bl
+  800e1a:	75 ec                	jne    800e08 <strlcpy+0x1c>
+  800e1c:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800e1e:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800e21:	29 f0                	sub    %esi,%eax
+}
+  800e23:	5b                   	pop    %ebx
+  800e24:	5e                   	pop    %esi
+  800e25:	5d                   	pop    %ebp
+  800e26:	c3                   	ret
+
+00800e27 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800e27:	55                   	push   %ebp
+  800e28:	89 e5                	mov    %esp,%ebp
+  800e2a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800e2d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800e30:	eb 06                	jmp    800e38 <strcmp+0x11>
+		p++, q++;
+  800e32:	83 c1 01             	add    $0x1,%ecx
+  800e35:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800e38:	0f b6 01             	movzbl (%ecx),%eax
+  800e3b:	84 c0                	test   %al,%al
+  800e3d:	74 04                	je     800e43 <strcmp+0x1c>
+  800e3f:	3a 02                	cmp    (%edx),%al
+  800e41:	74 ef                	je     800e32 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800e43:	0f b6 c0             	movzbl %al,%eax
+  800e46:	0f b6 12             	movzbl (%edx),%edx
+  800e49:	29 d0                	sub    %edx,%eax
+}
+  800e4b:	5d                   	pop    %ebp
+  800e4c:	c3                   	ret
+
+00800e4d <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800e4d:	55                   	push   %ebp
+  800e4e:	89 e5                	mov    %esp,%ebp
+  800e50:	53                   	push   %ebx
+  800e51:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e54:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e57:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800e5a:	eb 09                	jmp    800e65 <strncmp+0x18>
+		n--, p++, q++;
+  800e5c:	83 ea 01             	sub    $0x1,%edx
+  800e5f:	83 c0 01             	add    $0x1,%eax
+  800e62:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800e65:	85 d2                	test   %edx,%edx
+  800e67:	74 18                	je     800e81 <strncmp+0x34>
+  800e69:	0f b6 18             	movzbl (%eax),%ebx
+  800e6c:	84 db                	test   %bl,%bl
+  800e6e:	74 04                	je     800e74 <strncmp+0x27>
+  800e70:	3a 19                	cmp    (%ecx),%bl
+  800e72:	74 e8                	je     800e5c <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800e74:	0f b6 00             	movzbl (%eax),%eax
+  800e77:	0f b6 11             	movzbl (%ecx),%edx
+  800e7a:	29 d0                	sub    %edx,%eax
+}
+  800e7c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e7f:	c9                   	leave
+  800e80:	c3                   	ret
+		return 0;
+  800e81:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e86:	eb f4                	jmp    800e7c <strncmp+0x2f>
+
+00800e88 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800e88:	55                   	push   %ebp
+  800e89:	89 e5                	mov    %esp,%ebp
+  800e8b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e8e:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800e92:	eb 03                	jmp    800e97 <strchr+0xf>
+  800e94:	83 c0 01             	add    $0x1,%eax
+  800e97:	0f b6 10             	movzbl (%eax),%edx
+  800e9a:	84 d2                	test   %dl,%dl
+  800e9c:	74 06                	je     800ea4 <strchr+0x1c>
+		if (*s == c)
+  800e9e:	38 ca                	cmp    %cl,%dl
+  800ea0:	75 f2                	jne    800e94 <strchr+0xc>
+  800ea2:	eb 05                	jmp    800ea9 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800ea4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ea9:	5d                   	pop    %ebp
+  800eaa:	c3                   	ret
+
+00800eab <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800eab:	55                   	push   %ebp
+  800eac:	89 e5                	mov    %esp,%ebp
+  800eae:	8b 45 08             	mov    0x8(%ebp),%eax
+  800eb1:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800eb5:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800eb8:	38 ca                	cmp    %cl,%dl
+  800eba:	74 09                	je     800ec5 <strfind+0x1a>
+  800ebc:	84 d2                	test   %dl,%dl
+  800ebe:	74 05                	je     800ec5 <strfind+0x1a>
+	for (; *s; s++)
+  800ec0:	83 c0 01             	add    $0x1,%eax
+  800ec3:	eb f0                	jmp    800eb5 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800ec5:	5d                   	pop    %ebp
+  800ec6:	c3                   	ret
+
+00800ec7 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800ec7:	55                   	push   %ebp
+  800ec8:	89 e5                	mov    %esp,%ebp
+  800eca:	57                   	push   %edi
+  800ecb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800ece:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800ed1:	85 c9                	test   %ecx,%ecx
+  800ed3:	74 20                	je     800ef5 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800ed5:	89 f8                	mov    %edi,%eax
+  800ed7:	09 c8                	or     %ecx,%eax
+  800ed9:	a8 03                	test   $0x3,%al
+  800edb:	75 12                	jne    800eef <memset+0x28>
+		c &= 0xFF;
+  800edd:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800ee1:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800ee7:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800eea:	fc                   	cld
+  800eeb:	f3 ab                	rep stos %eax,%es:(%edi)
+  800eed:	eb 06                	jmp    800ef5 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800eef:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ef2:	fc                   	cld
+  800ef3:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800ef5:	89 f8                	mov    %edi,%eax
+  800ef7:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800efa:	c9                   	leave
+  800efb:	c3                   	ret
+
+00800efc <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800efc:	55                   	push   %ebp
+  800efd:	89 e5                	mov    %esp,%ebp
+  800eff:	57                   	push   %edi
+  800f00:	56                   	push   %esi
+  800f01:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f04:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800f07:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800f0a:	39 c6                	cmp    %eax,%esi
+  800f0c:	73 32                	jae    800f40 <memmove+0x44>
+  800f0e:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800f11:	39 d0                	cmp    %edx,%eax
+  800f13:	73 2b                	jae    800f40 <memmove+0x44>
+		s += n;
+		d += n;
+  800f15:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800f18:	89 d6                	mov    %edx,%esi
+  800f1a:	09 fe                	or     %edi,%esi
+  800f1c:	09 ce                	or     %ecx,%esi
+  800f1e:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800f24:	75 0e                	jne    800f34 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800f26:	83 ef 04             	sub    $0x4,%edi
+  800f29:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800f2c:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800f2f:	fd                   	std
+  800f30:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800f32:	eb 09                	jmp    800f3d <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800f34:	83 ef 01             	sub    $0x1,%edi
+  800f37:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800f3a:	fd                   	std
+  800f3b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800f3d:	fc                   	cld
+  800f3e:	eb 1a                	jmp    800f5a <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800f40:	89 f2                	mov    %esi,%edx
+  800f42:	09 c2                	or     %eax,%edx
+  800f44:	09 ca                	or     %ecx,%edx
+  800f46:	f6 c2 03             	test   $0x3,%dl
+  800f49:	75 0a                	jne    800f55 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800f4b:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800f4e:	89 c7                	mov    %eax,%edi
+  800f50:	fc                   	cld
+  800f51:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800f53:	eb 05                	jmp    800f5a <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800f55:	89 c7                	mov    %eax,%edi
+  800f57:	fc                   	cld
+  800f58:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800f5a:	5e                   	pop    %esi
+  800f5b:	5f                   	pop    %edi
+  800f5c:	5d                   	pop    %ebp
+  800f5d:	c3                   	ret
+
+00800f5e <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800f5e:	55                   	push   %ebp
+  800f5f:	89 e5                	mov    %esp,%ebp
+  800f61:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800f64:	ff 75 10             	push   0x10(%ebp)
+  800f67:	ff 75 0c             	push   0xc(%ebp)
+  800f6a:	ff 75 08             	push   0x8(%ebp)
+  800f6d:	e8 8a ff ff ff       	call   800efc <memmove>
+}
+  800f72:	c9                   	leave
+  800f73:	c3                   	ret
+
+00800f74 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800f74:	55                   	push   %ebp
+  800f75:	89 e5                	mov    %esp,%ebp
+  800f77:	56                   	push   %esi
+  800f78:	53                   	push   %ebx
+  800f79:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f7c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800f7f:	89 c6                	mov    %eax,%esi
+  800f81:	03 75 10             	add    0x10(%ebp),%esi
+  800f84:	eb 06                	jmp    800f8c <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800f86:	83 c0 01             	add    $0x1,%eax
+  800f89:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800f8c:	39 f0                	cmp    %esi,%eax
+  800f8e:	74 14                	je     800fa4 <memcmp+0x30>
+		if (*s1 != *s2)
+  800f90:	0f b6 08             	movzbl (%eax),%ecx
+  800f93:	0f b6 1a             	movzbl (%edx),%ebx
+  800f96:	38 d9                	cmp    %bl,%cl
+  800f98:	74 ec                	je     800f86 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800f9a:	0f b6 c1             	movzbl %cl,%eax
+  800f9d:	0f b6 db             	movzbl %bl,%ebx
+  800fa0:	29 d8                	sub    %ebx,%eax
+  800fa2:	eb 05                	jmp    800fa9 <memcmp+0x35>
+	}
+
+	return 0;
+  800fa4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fa9:	5b                   	pop    %ebx
+  800faa:	5e                   	pop    %esi
+  800fab:	5d                   	pop    %ebp
+  800fac:	c3                   	ret
+
+00800fad <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800fad:	55                   	push   %ebp
+  800fae:	89 e5                	mov    %esp,%ebp
+  800fb0:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fb3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800fb6:	89 c2                	mov    %eax,%edx
+  800fb8:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800fbb:	eb 03                	jmp    800fc0 <memfind+0x13>
+  800fbd:	83 c0 01             	add    $0x1,%eax
+  800fc0:	39 d0                	cmp    %edx,%eax
+  800fc2:	73 04                	jae    800fc8 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800fc4:	38 08                	cmp    %cl,(%eax)
+  800fc6:	75 f5                	jne    800fbd <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800fc8:	5d                   	pop    %ebp
+  800fc9:	c3                   	ret
+
+00800fca <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800fca:	55                   	push   %ebp
+  800fcb:	89 e5                	mov    %esp,%ebp
+  800fcd:	57                   	push   %edi
+  800fce:	56                   	push   %esi
+  800fcf:	53                   	push   %ebx
+  800fd0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fd3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800fd6:	eb 03                	jmp    800fdb <strtol+0x11>
+		s++;
+  800fd8:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800fdb:	0f b6 02             	movzbl (%edx),%eax
+  800fde:	3c 20                	cmp    $0x20,%al
+  800fe0:	74 f6                	je     800fd8 <strtol+0xe>
+  800fe2:	3c 09                	cmp    $0x9,%al
+  800fe4:	74 f2                	je     800fd8 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800fe6:	3c 2b                	cmp    $0x2b,%al
+  800fe8:	74 2a                	je     801014 <strtol+0x4a>
+	int neg = 0;
+  800fea:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800fef:	3c 2d                	cmp    $0x2d,%al
+  800ff1:	74 2b                	je     80101e <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ff3:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800ff9:	75 0f                	jne    80100a <strtol+0x40>
+  800ffb:	80 3a 30             	cmpb   $0x30,(%edx)
+  800ffe:	74 28                	je     801028 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  801000:	85 db                	test   %ebx,%ebx
+  801002:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801007:	0f 44 d8             	cmove  %eax,%ebx
+  80100a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80100f:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  801012:	eb 46                	jmp    80105a <strtol+0x90>
+		s++;
+  801014:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  801017:	bf 00 00 00 00       	mov    $0x0,%edi
+  80101c:	eb d5                	jmp    800ff3 <strtol+0x29>
+		s++, neg = 1;
+  80101e:	83 c2 01             	add    $0x1,%edx
+  801021:	bf 01 00 00 00       	mov    $0x1,%edi
+  801026:	eb cb                	jmp    800ff3 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801028:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  80102c:	74 0e                	je     80103c <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  80102e:	85 db                	test   %ebx,%ebx
+  801030:	75 d8                	jne    80100a <strtol+0x40>
+		s++, base = 8;
+  801032:	83 c2 01             	add    $0x1,%edx
+  801035:	bb 08 00 00 00       	mov    $0x8,%ebx
+  80103a:	eb ce                	jmp    80100a <strtol+0x40>
+		s += 2, base = 16;
+  80103c:	83 c2 02             	add    $0x2,%edx
+  80103f:	bb 10 00 00 00       	mov    $0x10,%ebx
+  801044:	eb c4                	jmp    80100a <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  801046:	0f be c0             	movsbl %al,%eax
+  801049:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  80104c:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80104f:	7d 3a                	jge    80108b <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  801051:	83 c2 01             	add    $0x1,%edx
+  801054:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  801058:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  80105a:	0f b6 02             	movzbl (%edx),%eax
+  80105d:	8d 70 d0             	lea    -0x30(%eax),%esi
+  801060:	89 f3                	mov    %esi,%ebx
+  801062:	80 fb 09             	cmp    $0x9,%bl
+  801065:	76 df                	jbe    801046 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  801067:	8d 70 9f             	lea    -0x61(%eax),%esi
+  80106a:	89 f3                	mov    %esi,%ebx
+  80106c:	80 fb 19             	cmp    $0x19,%bl
+  80106f:	77 08                	ja     801079 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  801071:	0f be c0             	movsbl %al,%eax
+  801074:	83 e8 57             	sub    $0x57,%eax
+  801077:	eb d3                	jmp    80104c <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  801079:	8d 70 bf             	lea    -0x41(%eax),%esi
+  80107c:	89 f3                	mov    %esi,%ebx
+  80107e:	80 fb 19             	cmp    $0x19,%bl
+  801081:	77 08                	ja     80108b <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  801083:	0f be c0             	movsbl %al,%eax
+  801086:	83 e8 37             	sub    $0x37,%eax
+  801089:	eb c1                	jmp    80104c <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  80108b:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80108f:	74 05                	je     801096 <strtol+0xcc>
+		*endptr = (char *) s;
+  801091:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801094:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  801096:	89 c8                	mov    %ecx,%eax
+  801098:	f7 d8                	neg    %eax
+  80109a:	85 ff                	test   %edi,%edi
+  80109c:	0f 45 c8             	cmovne %eax,%ecx
+}
+  80109f:	89 c8                	mov    %ecx,%eax
+  8010a1:	5b                   	pop    %ebx
+  8010a2:	5e                   	pop    %esi
+  8010a3:	5f                   	pop    %edi
+  8010a4:	5d                   	pop    %ebp
+  8010a5:	c3                   	ret
+
+008010a6 <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8010a6:	55                   	push   %ebp
+  8010a7:	89 e5                	mov    %esp,%ebp
+  8010a9:	57                   	push   %edi
+  8010aa:	56                   	push   %esi
+  8010ab:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8010ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010b1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b7:	89 c3                	mov    %eax,%ebx
+  8010b9:	89 c7                	mov    %eax,%edi
+  8010bb:	89 c6                	mov    %eax,%esi
+  8010bd:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  8010bf:	5b                   	pop    %ebx
+  8010c0:	5e                   	pop    %esi
+  8010c1:	5f                   	pop    %edi
+  8010c2:	5d                   	pop    %ebp
+  8010c3:	c3                   	ret
+
+008010c4 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8010c4:	55                   	push   %ebp
+  8010c5:	89 e5                	mov    %esp,%ebp
+  8010c7:	57                   	push   %edi
+  8010c8:	56                   	push   %esi
+  8010c9:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8010ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010cf:	b8 01 00 00 00       	mov    $0x1,%eax
+  8010d4:	89 d1                	mov    %edx,%ecx
+  8010d6:	89 d3                	mov    %edx,%ebx
+  8010d8:	89 d7                	mov    %edx,%edi
+  8010da:	89 d6                	mov    %edx,%esi
+  8010dc:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8010de:	5b                   	pop    %ebx
+  8010df:	5e                   	pop    %esi
+  8010e0:	5f                   	pop    %edi
+  8010e1:	5d                   	pop    %ebp
+  8010e2:	c3                   	ret
+
+008010e3 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8010e3:	55                   	push   %ebp
+  8010e4:	89 e5                	mov    %esp,%ebp
+  8010e6:	57                   	push   %edi
+  8010e7:	56                   	push   %esi
+  8010e8:	53                   	push   %ebx
+  8010e9:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8010ec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f4:	b8 03 00 00 00       	mov    $0x3,%eax
+  8010f9:	89 cb                	mov    %ecx,%ebx
+  8010fb:	89 cf                	mov    %ecx,%edi
+  8010fd:	89 ce                	mov    %ecx,%esi
+  8010ff:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801101:	85 c0                	test   %eax,%eax
+  801103:	7f 08                	jg     80110d <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  801105:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801108:	5b                   	pop    %ebx
+  801109:	5e                   	pop    %esi
+  80110a:	5f                   	pop    %edi
+  80110b:	5d                   	pop    %ebp
+  80110c:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80110d:	83 ec 0c             	sub    $0xc,%esp
+  801110:	50                   	push   %eax
+  801111:	6a 03                	push   $0x3
+  801113:	68 43 32 80 00       	push   $0x803243
+  801118:	6a 3e                	push   $0x3e
+  80111a:	68 60 32 80 00       	push   $0x803260
+  80111f:	e8 be f5 ff ff       	call   8006e2 <_panic>
+
+00801124 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801124:	55                   	push   %ebp
+  801125:	89 e5                	mov    %esp,%ebp
+  801127:	57                   	push   %edi
+  801128:	56                   	push   %esi
+  801129:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80112a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80112f:	b8 02 00 00 00       	mov    $0x2,%eax
+  801134:	89 d1                	mov    %edx,%ecx
+  801136:	89 d3                	mov    %edx,%ebx
+  801138:	89 d7                	mov    %edx,%edi
+  80113a:	89 d6                	mov    %edx,%esi
+  80113c:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  80113e:	5b                   	pop    %ebx
+  80113f:	5e                   	pop    %esi
+  801140:	5f                   	pop    %edi
+  801141:	5d                   	pop    %ebp
+  801142:	c3                   	ret
+
+00801143 <sys_yield>:
+
+void
+sys_yield(void) {
+  801143:	55                   	push   %ebp
+  801144:	89 e5                	mov    %esp,%ebp
+  801146:	57                   	push   %edi
+  801147:	56                   	push   %esi
+  801148:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  801149:	ba 00 00 00 00       	mov    $0x0,%edx
+  80114e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801153:	89 d1                	mov    %edx,%ecx
+  801155:	89 d3                	mov    %edx,%ebx
+  801157:	89 d7                	mov    %edx,%edi
+  801159:	89 d6                	mov    %edx,%esi
+  80115b:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  80115d:	5b                   	pop    %ebx
+  80115e:	5e                   	pop    %esi
+  80115f:	5f                   	pop    %edi
+  801160:	5d                   	pop    %ebp
+  801161:	c3                   	ret
+
+00801162 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  801162:	55                   	push   %ebp
+  801163:	89 e5                	mov    %esp,%ebp
+  801165:	57                   	push   %edi
+  801166:	56                   	push   %esi
+  801167:	53                   	push   %ebx
+  801168:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  80116b:	be 00 00 00 00       	mov    $0x0,%esi
+  801170:	8b 55 08             	mov    0x8(%ebp),%edx
+  801173:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801176:	b8 04 00 00 00       	mov    $0x4,%eax
+  80117b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80117e:	89 f7                	mov    %esi,%edi
+  801180:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801182:	85 c0                	test   %eax,%eax
+  801184:	7f 08                	jg     80118e <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  801186:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801189:	5b                   	pop    %ebx
+  80118a:	5e                   	pop    %esi
+  80118b:	5f                   	pop    %edi
+  80118c:	5d                   	pop    %ebp
+  80118d:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80118e:	83 ec 0c             	sub    $0xc,%esp
+  801191:	50                   	push   %eax
+  801192:	6a 04                	push   $0x4
+  801194:	68 43 32 80 00       	push   $0x803243
+  801199:	6a 3e                	push   $0x3e
+  80119b:	68 60 32 80 00       	push   $0x803260
+  8011a0:	e8 3d f5 ff ff       	call   8006e2 <_panic>
+
+008011a5 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  8011a5:	55                   	push   %ebp
+  8011a6:	89 e5                	mov    %esp,%ebp
+  8011a8:	57                   	push   %edi
+  8011a9:	56                   	push   %esi
+  8011aa:	53                   	push   %ebx
+  8011ab:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8011ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011b1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011b4:	b8 05 00 00 00       	mov    $0x5,%eax
+  8011b9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011bc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011bf:	8b 75 18             	mov    0x18(%ebp),%esi
+  8011c2:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8011c4:	85 c0                	test   %eax,%eax
+  8011c6:	7f 08                	jg     8011d0 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  8011c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011cb:	5b                   	pop    %ebx
+  8011cc:	5e                   	pop    %esi
+  8011cd:	5f                   	pop    %edi
+  8011ce:	5d                   	pop    %ebp
+  8011cf:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8011d0:	83 ec 0c             	sub    $0xc,%esp
+  8011d3:	50                   	push   %eax
+  8011d4:	6a 05                	push   $0x5
+  8011d6:	68 43 32 80 00       	push   $0x803243
+  8011db:	6a 3e                	push   $0x3e
+  8011dd:	68 60 32 80 00       	push   $0x803260
+  8011e2:	e8 fb f4 ff ff       	call   8006e2 <_panic>
+
+008011e7 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  8011e7:	55                   	push   %ebp
+  8011e8:	89 e5                	mov    %esp,%ebp
+  8011ea:	57                   	push   %edi
+  8011eb:	56                   	push   %esi
+  8011ec:	53                   	push   %ebx
+  8011ed:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8011f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011f5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011f8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011fb:	b8 06 00 00 00       	mov    $0x6,%eax
+  801200:	89 df                	mov    %ebx,%edi
+  801202:	89 de                	mov    %ebx,%esi
+  801204:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801206:	85 c0                	test   %eax,%eax
+  801208:	7f 08                	jg     801212 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  80120a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80120d:	5b                   	pop    %ebx
+  80120e:	5e                   	pop    %esi
+  80120f:	5f                   	pop    %edi
+  801210:	5d                   	pop    %ebp
+  801211:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801212:	83 ec 0c             	sub    $0xc,%esp
+  801215:	50                   	push   %eax
+  801216:	6a 06                	push   $0x6
+  801218:	68 43 32 80 00       	push   $0x803243
+  80121d:	6a 3e                	push   $0x3e
+  80121f:	68 60 32 80 00       	push   $0x803260
+  801224:	e8 b9 f4 ff ff       	call   8006e2 <_panic>
+
+00801229 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801229:	55                   	push   %ebp
+  80122a:	89 e5                	mov    %esp,%ebp
+  80122c:	57                   	push   %edi
+  80122d:	56                   	push   %esi
+  80122e:	53                   	push   %ebx
+  80122f:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  801232:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801237:	8b 55 08             	mov    0x8(%ebp),%edx
+  80123a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80123d:	b8 08 00 00 00       	mov    $0x8,%eax
+  801242:	89 df                	mov    %ebx,%edi
+  801244:	89 de                	mov    %ebx,%esi
+  801246:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801248:	85 c0                	test   %eax,%eax
+  80124a:	7f 08                	jg     801254 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  80124c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80124f:	5b                   	pop    %ebx
+  801250:	5e                   	pop    %esi
+  801251:	5f                   	pop    %edi
+  801252:	5d                   	pop    %ebp
+  801253:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801254:	83 ec 0c             	sub    $0xc,%esp
+  801257:	50                   	push   %eax
+  801258:	6a 08                	push   $0x8
+  80125a:	68 43 32 80 00       	push   $0x803243
+  80125f:	6a 3e                	push   $0x3e
+  801261:	68 60 32 80 00       	push   $0x803260
+  801266:	e8 77 f4 ff ff       	call   8006e2 <_panic>
+
+0080126b <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80126b:	55                   	push   %ebp
+  80126c:	89 e5                	mov    %esp,%ebp
+  80126e:	57                   	push   %edi
+  80126f:	56                   	push   %esi
+  801270:	53                   	push   %ebx
+  801271:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  801274:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801279:	8b 55 08             	mov    0x8(%ebp),%edx
+  80127c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80127f:	b8 09 00 00 00       	mov    $0x9,%eax
+  801284:	89 df                	mov    %ebx,%edi
+  801286:	89 de                	mov    %ebx,%esi
+  801288:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80128a:	85 c0                	test   %eax,%eax
+  80128c:	7f 08                	jg     801296 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  80128e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801291:	5b                   	pop    %ebx
+  801292:	5e                   	pop    %esi
+  801293:	5f                   	pop    %edi
+  801294:	5d                   	pop    %ebp
+  801295:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801296:	83 ec 0c             	sub    $0xc,%esp
+  801299:	50                   	push   %eax
+  80129a:	6a 09                	push   $0x9
+  80129c:	68 43 32 80 00       	push   $0x803243
+  8012a1:	6a 3e                	push   $0x3e
+  8012a3:	68 60 32 80 00       	push   $0x803260
+  8012a8:	e8 35 f4 ff ff       	call   8006e2 <_panic>
+
+008012ad <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8012ad:	55                   	push   %ebp
+  8012ae:	89 e5                	mov    %esp,%ebp
+  8012b0:	57                   	push   %edi
+  8012b1:	56                   	push   %esi
+  8012b2:	53                   	push   %ebx
+  8012b3:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8012b6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012bb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012be:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012c1:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8012c6:	89 df                	mov    %ebx,%edi
+  8012c8:	89 de                	mov    %ebx,%esi
+  8012ca:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8012cc:	85 c0                	test   %eax,%eax
+  8012ce:	7f 08                	jg     8012d8 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8012d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012d3:	5b                   	pop    %ebx
+  8012d4:	5e                   	pop    %esi
+  8012d5:	5f                   	pop    %edi
+  8012d6:	5d                   	pop    %ebp
+  8012d7:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8012d8:	83 ec 0c             	sub    $0xc,%esp
+  8012db:	50                   	push   %eax
+  8012dc:	6a 0a                	push   $0xa
+  8012de:	68 43 32 80 00       	push   $0x803243
+  8012e3:	6a 3e                	push   $0x3e
+  8012e5:	68 60 32 80 00       	push   $0x803260
+  8012ea:	e8 f3 f3 ff ff       	call   8006e2 <_panic>
+
+008012ef <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  8012ef:	55                   	push   %ebp
+  8012f0:	89 e5                	mov    %esp,%ebp
+  8012f2:	57                   	push   %edi
+  8012f3:	56                   	push   %esi
+  8012f4:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8012f5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012f8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012fb:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801300:	be 00 00 00 00       	mov    $0x0,%esi
+  801305:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801308:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80130b:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  80130d:	5b                   	pop    %ebx
+  80130e:	5e                   	pop    %esi
+  80130f:	5f                   	pop    %edi
+  801310:	5d                   	pop    %ebp
+  801311:	c3                   	ret
+
+00801312 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  801312:	55                   	push   %ebp
+  801313:	89 e5                	mov    %esp,%ebp
+  801315:	57                   	push   %edi
+  801316:	56                   	push   %esi
+  801317:	53                   	push   %ebx
+  801318:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  80131b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801320:	8b 55 08             	mov    0x8(%ebp),%edx
+  801323:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801328:	89 cb                	mov    %ecx,%ebx
+  80132a:	89 cf                	mov    %ecx,%edi
+  80132c:	89 ce                	mov    %ecx,%esi
+  80132e:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801330:	85 c0                	test   %eax,%eax
+  801332:	7f 08                	jg     80133c <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  801334:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801337:	5b                   	pop    %ebx
+  801338:	5e                   	pop    %esi
+  801339:	5f                   	pop    %edi
+  80133a:	5d                   	pop    %ebp
+  80133b:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80133c:	83 ec 0c             	sub    $0xc,%esp
+  80133f:	50                   	push   %eax
+  801340:	6a 0d                	push   $0xd
+  801342:	68 43 32 80 00       	push   $0x803243
+  801347:	6a 3e                	push   $0x3e
+  801349:	68 60 32 80 00       	push   $0x803260
+  80134e:	e8 8f f3 ff ff       	call   8006e2 <_panic>
+
+00801353 <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  801353:	55                   	push   %ebp
+  801354:	89 e5                	mov    %esp,%ebp
+  801356:	57                   	push   %edi
+  801357:	56                   	push   %esi
+  801358:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  801359:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80135e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801361:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801364:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801369:	89 df                	mov    %ebx,%edi
+  80136b:	89 de                	mov    %ebx,%esi
+  80136d:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  80136f:	5b                   	pop    %ebx
+  801370:	5e                   	pop    %esi
+  801371:	5f                   	pop    %edi
+  801372:	5d                   	pop    %ebp
+  801373:	c3                   	ret
+
+00801374 <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  801374:	55                   	push   %ebp
+  801375:	89 e5                	mov    %esp,%ebp
+  801377:	57                   	push   %edi
+  801378:	56                   	push   %esi
+  801379:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80137a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80137f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801382:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801387:	89 cb                	mov    %ecx,%ebx
+  801389:	89 cf                	mov    %ecx,%edi
+  80138b:	89 ce                	mov    %ecx,%esi
+  80138d:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  80138f:	5b                   	pop    %ebx
+  801390:	5e                   	pop    %esi
+  801391:	5f                   	pop    %edi
+  801392:	5d                   	pop    %ebp
+  801393:	c3                   	ret
+
+00801394 <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  801394:	55                   	push   %ebp
+  801395:	89 e5                	mov    %esp,%ebp
+  801397:	57                   	push   %edi
+  801398:	56                   	push   %esi
+  801399:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80139a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80139f:	b8 10 00 00 00       	mov    $0x10,%eax
+  8013a4:	89 d1                	mov    %edx,%ecx
+  8013a6:	89 d3                	mov    %edx,%ebx
+  8013a8:	89 d7                	mov    %edx,%edi
+  8013aa:	89 d6                	mov    %edx,%esi
+  8013ac:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8013ae:	5b                   	pop    %ebx
+  8013af:	5e                   	pop    %esi
+  8013b0:	5f                   	pop    %edi
+  8013b1:	5d                   	pop    %ebp
+  8013b2:	c3                   	ret
+
+008013b3 <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  8013b3:	55                   	push   %ebp
+  8013b4:	89 e5                	mov    %esp,%ebp
+  8013b6:	57                   	push   %edi
+  8013b7:	56                   	push   %esi
+  8013b8:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8013b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013be:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013c1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013c4:	b8 11 00 00 00       	mov    $0x11,%eax
+  8013c9:	89 df                	mov    %ebx,%edi
+  8013cb:	89 de                	mov    %ebx,%esi
+  8013cd:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  8013cf:	5b                   	pop    %ebx
+  8013d0:	5e                   	pop    %esi
+  8013d1:	5f                   	pop    %edi
+  8013d2:	5d                   	pop    %ebp
+  8013d3:	c3                   	ret
+
+008013d4 <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  8013d4:	55                   	push   %ebp
+  8013d5:	89 e5                	mov    %esp,%ebp
+  8013d7:	57                   	push   %edi
+  8013d8:	56                   	push   %esi
+  8013d9:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8013da:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013df:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013e2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013e5:	b8 12 00 00 00       	mov    $0x12,%eax
+  8013ea:	89 df                	mov    %ebx,%edi
+  8013ec:	89 de                	mov    %ebx,%esi
+  8013ee:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  8013f0:	5b                   	pop    %ebx
+  8013f1:	5e                   	pop    %esi
+  8013f2:	5f                   	pop    %edi
+  8013f3:	5d                   	pop    %ebp
+  8013f4:	c3                   	ret
+
+008013f5 <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  8013f5:	55                   	push   %ebp
+  8013f6:	89 e5                	mov    %esp,%ebp
+  8013f8:	57                   	push   %edi
+  8013f9:	56                   	push   %esi
+  8013fa:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8013fb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801400:	8b 55 08             	mov    0x8(%ebp),%edx
+  801403:	b8 13 00 00 00       	mov    $0x13,%eax
+  801408:	89 cb                	mov    %ecx,%ebx
+  80140a:	89 cf                	mov    %ecx,%edi
+  80140c:	89 ce                	mov    %ecx,%esi
+  80140e:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  801410:	5b                   	pop    %ebx
+  801411:	5e                   	pop    %esi
+  801412:	5f                   	pop    %edi
+  801413:	5d                   	pop    %ebp
+  801414:	c3                   	ret
+
+00801415 <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  801415:	55                   	push   %ebp
+  801416:	89 e5                	mov    %esp,%ebp
+  801418:	57                   	push   %edi
+  801419:	56                   	push   %esi
+  80141a:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80141b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801420:	8b 55 08             	mov    0x8(%ebp),%edx
+  801423:	b8 14 00 00 00       	mov    $0x14,%eax
+  801428:	89 cb                	mov    %ecx,%ebx
+  80142a:	89 cf                	mov    %ecx,%edi
+  80142c:	89 ce                	mov    %ecx,%esi
+  80142e:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  801430:	5b                   	pop    %ebx
+  801431:	5e                   	pop    %esi
+  801432:	5f                   	pop    %edi
+  801433:	5d                   	pop    %ebp
+  801434:	c3                   	ret
+
+00801435 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  801435:	55                   	push   %ebp
+  801436:	89 e5                	mov    %esp,%ebp
+  801438:	56                   	push   %esi
+  801439:	53                   	push   %ebx
+  80143a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80143d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801440:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  801443:	85 c0                	test   %eax,%eax
+  801445:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80144a:	0f 44 c2             	cmove  %edx,%eax
+  80144d:	83 ec 0c             	sub    $0xc,%esp
+  801450:	50                   	push   %eax
+  801451:	e8 bc fe ff ff       	call   801312 <sys_ipc_recv>
+
+  if (from_env_store)
+  801456:	83 c4 10             	add    $0x10,%esp
+  801459:	85 f6                	test   %esi,%esi
+  80145b:	74 17                	je     801474 <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  80145d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801462:	85 c0                	test   %eax,%eax
+  801464:	75 0c                	jne    801472 <ipc_recv+0x3d>
+  801466:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  80146c:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  801472:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  801474:	85 db                	test   %ebx,%ebx
+  801476:	74 2b                	je     8014a3 <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  801478:	85 c0                	test   %eax,%eax
+  80147a:	74 0d                	je     801489 <ipc_recv+0x54>
+  80147c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  801482:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801485:	5b                   	pop    %ebx
+  801486:	5e                   	pop    %esi
+  801487:	5d                   	pop    %ebp
+  801488:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  801489:	a1 08 50 80 00       	mov    0x805008,%eax
+  80148e:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  801494:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  801496:	a1 08 50 80 00       	mov    0x805008,%eax
+  80149b:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  8014a1:	eb df                	jmp    801482 <ipc_recv+0x4d>
+  8014a3:	85 c0                	test   %eax,%eax
+  8014a5:	75 db                	jne    801482 <ipc_recv+0x4d>
+  8014a7:	eb ed                	jmp    801496 <ipc_recv+0x61>
+
+008014a9 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  8014a9:	55                   	push   %ebp
+  8014aa:	89 e5                	mov    %esp,%ebp
+  8014ac:	57                   	push   %edi
+  8014ad:	56                   	push   %esi
+  8014ae:	53                   	push   %ebx
+  8014af:	83 ec 0c             	sub    $0xc,%esp
+  8014b2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8014b5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8014b8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  8014bb:	85 db                	test   %ebx,%ebx
+  8014bd:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8014c2:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  8014c5:	ff 75 14             	push   0x14(%ebp)
+  8014c8:	53                   	push   %ebx
+  8014c9:	56                   	push   %esi
+  8014ca:	57                   	push   %edi
+  8014cb:	e8 1f fe ff ff       	call   8012ef <sys_ipc_try_send>
+  8014d0:	83 c4 10             	add    $0x10,%esp
+  8014d3:	85 c0                	test   %eax,%eax
+  8014d5:	74 1e                	je     8014f5 <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  8014d7:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8014da:	75 07                	jne    8014e3 <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  8014dc:	e8 62 fc ff ff       	call   801143 <sys_yield>
+  8014e1:	eb e2                	jmp    8014c5 <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  8014e3:	50                   	push   %eax
+  8014e4:	68 6e 32 80 00       	push   $0x80326e
+  8014e9:	6a 3c                	push   $0x3c
+  8014eb:	68 7b 32 80 00       	push   $0x80327b
+  8014f0:	e8 ed f1 ff ff       	call   8006e2 <_panic>
+  }
+
+#endif
+}
+  8014f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014f8:	5b                   	pop    %ebx
+  8014f9:	5e                   	pop    %esi
+  8014fa:	5f                   	pop    %edi
+  8014fb:	5d                   	pop    %ebp
+  8014fc:	c3                   	ret
+
+008014fd <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  8014fd:	55                   	push   %ebp
+  8014fe:	89 e5                	mov    %esp,%ebp
+  801500:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  801503:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  801508:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80150b:	c1 e0 04             	shl    $0x4,%eax
+  80150e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801513:	8b 40 50             	mov    0x50(%eax),%eax
+  801516:	39 c8                	cmp    %ecx,%eax
+  801518:	74 12                	je     80152c <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  80151a:	83 c2 01             	add    $0x1,%edx
+  80151d:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  801523:	75 e3                	jne    801508 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  801525:	b8 00 00 00 00       	mov    $0x0,%eax
+  80152a:	eb 0e                	jmp    80153a <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  80152c:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80152f:	c1 e0 04             	shl    $0x4,%eax
+  801532:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801537:	8b 40 48             	mov    0x48(%eax),%eax
+  80153a:	5d                   	pop    %ebp
+  80153b:	c3                   	ret
+
+0080153c <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80153c:	55                   	push   %ebp
+  80153d:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80153f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801542:	05 00 00 00 30       	add    $0x30000000,%eax
+  801547:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80154a:	5d                   	pop    %ebp
+  80154b:	c3                   	ret
+
+0080154c <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80154c:	55                   	push   %ebp
+  80154d:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80154f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801552:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801557:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80155c:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801561:	5d                   	pop    %ebp
+  801562:	c3                   	ret
+
+00801563 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801563:	55                   	push   %ebp
+  801564:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801566:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80156b:	eb 02                	jmp    80156f <fd_alloc+0xc>
+  80156d:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80156f:	89 c2                	mov    %eax,%edx
+  801571:	c1 ea 16             	shr    $0x16,%edx
+  801574:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80157b:	f6 c2 01             	test   $0x1,%dl
+  80157e:	74 2b                	je     8015ab <fd_alloc+0x48>
+  801580:	89 c2                	mov    %eax,%edx
+  801582:	c1 ea 0c             	shr    $0xc,%edx
+  801585:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80158c:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801592:	f6 c1 01             	test   $0x1,%cl
+  801595:	74 14                	je     8015ab <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801597:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80159d:	75 ce                	jne    80156d <fd_alloc+0xa>
+  80159f:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8015a4:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8015a9:	eb 05                	jmp    8015b0 <fd_alloc+0x4d>
+			return 0;
+  8015ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8015b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015b3:	89 02                	mov    %eax,(%edx)
+}
+  8015b5:	89 c8                	mov    %ecx,%eax
+  8015b7:	5d                   	pop    %ebp
+  8015b8:	c3                   	ret
+
+008015b9 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8015b9:	55                   	push   %ebp
+  8015ba:	89 e5                	mov    %esp,%ebp
+  8015bc:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8015bf:	83 f8 1f             	cmp    $0x1f,%eax
+  8015c2:	77 30                	ja     8015f4 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8015c4:	c1 e0 0c             	shl    $0xc,%eax
+  8015c7:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8015cc:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8015d2:	f6 c2 01             	test   $0x1,%dl
+  8015d5:	74 24                	je     8015fb <fd_lookup+0x42>
+  8015d7:	89 c2                	mov    %eax,%edx
+  8015d9:	c1 ea 0c             	shr    $0xc,%edx
+  8015dc:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8015e3:	f6 c2 01             	test   $0x1,%dl
+  8015e6:	74 1a                	je     801602 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8015e8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8015eb:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8015ed:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015f2:	5d                   	pop    %ebp
+  8015f3:	c3                   	ret
+		return -E_INVAL;
+  8015f4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015f9:	eb f7                	jmp    8015f2 <fd_lookup+0x39>
+		return -E_INVAL;
+  8015fb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801600:	eb f0                	jmp    8015f2 <fd_lookup+0x39>
+  801602:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801607:	eb e9                	jmp    8015f2 <fd_lookup+0x39>
+
+00801609 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801609:	55                   	push   %ebp
+  80160a:	89 e5                	mov    %esp,%ebp
+  80160c:	53                   	push   %ebx
+  80160d:	83 ec 04             	sub    $0x4,%esp
+  801610:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801613:	b8 00 00 00 00       	mov    $0x0,%eax
+  801618:	eb 03                	jmp    80161d <dev_lookup+0x14>
+  80161a:	83 c0 01             	add    $0x1,%eax
+  80161d:	8b 1c 85 04 33 80 00 	mov    0x803304(,%eax,4),%ebx
+  801624:	85 db                	test   %ebx,%ebx
+  801626:	74 0b                	je     801633 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801628:	39 13                	cmp    %edx,(%ebx)
+  80162a:	75 ee                	jne    80161a <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  80162c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801631:	eb 1f                	jmp    801652 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801633:	a1 08 50 80 00       	mov    0x805008,%eax
+  801638:	8b 40 48             	mov    0x48(%eax),%eax
+  80163b:	83 ec 04             	sub    $0x4,%esp
+  80163e:	52                   	push   %edx
+  80163f:	50                   	push   %eax
+  801640:	68 88 32 80 00       	push   $0x803288
+  801645:	e8 73 f1 ff ff       	call   8007bd <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80164a:	83 c4 10             	add    $0x10,%esp
+  80164d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801652:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801655:	89 1a                	mov    %ebx,(%edx)
+}
+  801657:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80165a:	c9                   	leave
+  80165b:	c3                   	ret
+
+0080165c <fd_close>:
+{
+  80165c:	55                   	push   %ebp
+  80165d:	89 e5                	mov    %esp,%ebp
+  80165f:	57                   	push   %edi
+  801660:	56                   	push   %esi
+  801661:	53                   	push   %ebx
+  801662:	83 ec 24             	sub    $0x24,%esp
+  801665:	8b 75 08             	mov    0x8(%ebp),%esi
+  801668:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80166b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80166e:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80166f:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801675:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801678:	50                   	push   %eax
+  801679:	e8 3b ff ff ff       	call   8015b9 <fd_lookup>
+  80167e:	89 c3                	mov    %eax,%ebx
+  801680:	83 c4 10             	add    $0x10,%esp
+  801683:	85 c0                	test   %eax,%eax
+  801685:	78 05                	js     80168c <fd_close+0x30>
+	    || fd != fd2)
+  801687:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80168a:	74 16                	je     8016a2 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80168c:	89 f8                	mov    %edi,%eax
+  80168e:	84 c0                	test   %al,%al
+  801690:	b8 00 00 00 00       	mov    $0x0,%eax
+  801695:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801698:	89 d8                	mov    %ebx,%eax
+  80169a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80169d:	5b                   	pop    %ebx
+  80169e:	5e                   	pop    %esi
+  80169f:	5f                   	pop    %edi
+  8016a0:	5d                   	pop    %ebp
+  8016a1:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8016a2:	83 ec 08             	sub    $0x8,%esp
+  8016a5:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8016a8:	50                   	push   %eax
+  8016a9:	ff 36                	push   (%esi)
+  8016ab:	e8 59 ff ff ff       	call   801609 <dev_lookup>
+  8016b0:	89 c3                	mov    %eax,%ebx
+  8016b2:	83 c4 10             	add    $0x10,%esp
+  8016b5:	85 c0                	test   %eax,%eax
+  8016b7:	78 1a                	js     8016d3 <fd_close+0x77>
+		if (dev->dev_close)
+  8016b9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8016bc:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8016bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8016c4:	85 c0                	test   %eax,%eax
+  8016c6:	74 0b                	je     8016d3 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8016c8:	83 ec 0c             	sub    $0xc,%esp
+  8016cb:	56                   	push   %esi
+  8016cc:	ff d0                	call   *%eax
+  8016ce:	89 c3                	mov    %eax,%ebx
+  8016d0:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8016d3:	83 ec 08             	sub    $0x8,%esp
+  8016d6:	56                   	push   %esi
+  8016d7:	6a 00                	push   $0x0
+  8016d9:	e8 09 fb ff ff       	call   8011e7 <sys_page_unmap>
+	return r;
+  8016de:	83 c4 10             	add    $0x10,%esp
+  8016e1:	eb b5                	jmp    801698 <fd_close+0x3c>
+
+008016e3 <close>:
+
+int
+close(int fdnum)
+{
+  8016e3:	55                   	push   %ebp
+  8016e4:	89 e5                	mov    %esp,%ebp
+  8016e6:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8016e9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016ec:	50                   	push   %eax
+  8016ed:	ff 75 08             	push   0x8(%ebp)
+  8016f0:	e8 c4 fe ff ff       	call   8015b9 <fd_lookup>
+  8016f5:	83 c4 10             	add    $0x10,%esp
+  8016f8:	85 c0                	test   %eax,%eax
+  8016fa:	79 02                	jns    8016fe <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8016fc:	c9                   	leave
+  8016fd:	c3                   	ret
+		return fd_close(fd, 1);
+  8016fe:	83 ec 08             	sub    $0x8,%esp
+  801701:	6a 01                	push   $0x1
+  801703:	ff 75 f4             	push   -0xc(%ebp)
+  801706:	e8 51 ff ff ff       	call   80165c <fd_close>
+  80170b:	83 c4 10             	add    $0x10,%esp
+  80170e:	eb ec                	jmp    8016fc <close+0x19>
+
+00801710 <close_all>:
+
+void
+close_all(void)
+{
+  801710:	55                   	push   %ebp
+  801711:	89 e5                	mov    %esp,%ebp
+  801713:	53                   	push   %ebx
+  801714:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801717:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80171c:	83 ec 0c             	sub    $0xc,%esp
+  80171f:	53                   	push   %ebx
+  801720:	e8 be ff ff ff       	call   8016e3 <close>
+	for (i = 0; i < MAXFD; i++)
+  801725:	83 c3 01             	add    $0x1,%ebx
+  801728:	83 c4 10             	add    $0x10,%esp
+  80172b:	83 fb 20             	cmp    $0x20,%ebx
+  80172e:	75 ec                	jne    80171c <close_all+0xc>
+}
+  801730:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801733:	c9                   	leave
+  801734:	c3                   	ret
+
+00801735 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801735:	55                   	push   %ebp
+  801736:	89 e5                	mov    %esp,%ebp
+  801738:	57                   	push   %edi
+  801739:	56                   	push   %esi
+  80173a:	53                   	push   %ebx
+  80173b:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80173e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801741:	50                   	push   %eax
+  801742:	ff 75 08             	push   0x8(%ebp)
+  801745:	e8 6f fe ff ff       	call   8015b9 <fd_lookup>
+  80174a:	89 c3                	mov    %eax,%ebx
+  80174c:	83 c4 10             	add    $0x10,%esp
+  80174f:	85 c0                	test   %eax,%eax
+  801751:	78 7f                	js     8017d2 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801753:	83 ec 0c             	sub    $0xc,%esp
+  801756:	ff 75 0c             	push   0xc(%ebp)
+  801759:	e8 85 ff ff ff       	call   8016e3 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80175e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801761:	c1 e6 0c             	shl    $0xc,%esi
+  801764:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80176a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80176d:	89 3c 24             	mov    %edi,(%esp)
+  801770:	e8 d7 fd ff ff       	call   80154c <fd2data>
+  801775:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801777:	89 34 24             	mov    %esi,(%esp)
+  80177a:	e8 cd fd ff ff       	call   80154c <fd2data>
+  80177f:	83 c4 10             	add    $0x10,%esp
+  801782:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801785:	89 d8                	mov    %ebx,%eax
+  801787:	c1 e8 16             	shr    $0x16,%eax
+  80178a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801791:	a8 01                	test   $0x1,%al
+  801793:	74 11                	je     8017a6 <dup+0x71>
+  801795:	89 d8                	mov    %ebx,%eax
+  801797:	c1 e8 0c             	shr    $0xc,%eax
+  80179a:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8017a1:	f6 c2 01             	test   $0x1,%dl
+  8017a4:	75 36                	jne    8017dc <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8017a6:	89 f8                	mov    %edi,%eax
+  8017a8:	c1 e8 0c             	shr    $0xc,%eax
+  8017ab:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8017b2:	83 ec 0c             	sub    $0xc,%esp
+  8017b5:	25 07 0e 00 00       	and    $0xe07,%eax
+  8017ba:	50                   	push   %eax
+  8017bb:	56                   	push   %esi
+  8017bc:	6a 00                	push   $0x0
+  8017be:	57                   	push   %edi
+  8017bf:	6a 00                	push   $0x0
+  8017c1:	e8 df f9 ff ff       	call   8011a5 <sys_page_map>
+  8017c6:	89 c3                	mov    %eax,%ebx
+  8017c8:	83 c4 20             	add    $0x20,%esp
+  8017cb:	85 c0                	test   %eax,%eax
+  8017cd:	78 33                	js     801802 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8017cf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8017d2:	89 d8                	mov    %ebx,%eax
+  8017d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017d7:	5b                   	pop    %ebx
+  8017d8:	5e                   	pop    %esi
+  8017d9:	5f                   	pop    %edi
+  8017da:	5d                   	pop    %ebp
+  8017db:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8017dc:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8017e3:	83 ec 0c             	sub    $0xc,%esp
+  8017e6:	25 07 0e 00 00       	and    $0xe07,%eax
+  8017eb:	50                   	push   %eax
+  8017ec:	ff 75 d4             	push   -0x2c(%ebp)
+  8017ef:	6a 00                	push   $0x0
+  8017f1:	53                   	push   %ebx
+  8017f2:	6a 00                	push   $0x0
+  8017f4:	e8 ac f9 ff ff       	call   8011a5 <sys_page_map>
+  8017f9:	89 c3                	mov    %eax,%ebx
+  8017fb:	83 c4 20             	add    $0x20,%esp
+  8017fe:	85 c0                	test   %eax,%eax
+  801800:	79 a4                	jns    8017a6 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801802:	83 ec 08             	sub    $0x8,%esp
+  801805:	56                   	push   %esi
+  801806:	6a 00                	push   $0x0
+  801808:	e8 da f9 ff ff       	call   8011e7 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  80180d:	83 c4 08             	add    $0x8,%esp
+  801810:	ff 75 d4             	push   -0x2c(%ebp)
+  801813:	6a 00                	push   $0x0
+  801815:	e8 cd f9 ff ff       	call   8011e7 <sys_page_unmap>
+	return r;
+  80181a:	83 c4 10             	add    $0x10,%esp
+  80181d:	eb b3                	jmp    8017d2 <dup+0x9d>
+
+0080181f <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80181f:	55                   	push   %ebp
+  801820:	89 e5                	mov    %esp,%ebp
+  801822:	56                   	push   %esi
+  801823:	53                   	push   %ebx
+  801824:	83 ec 18             	sub    $0x18,%esp
+  801827:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80182a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80182d:	50                   	push   %eax
+  80182e:	56                   	push   %esi
+  80182f:	e8 85 fd ff ff       	call   8015b9 <fd_lookup>
+  801834:	83 c4 10             	add    $0x10,%esp
+  801837:	85 c0                	test   %eax,%eax
+  801839:	78 3c                	js     801877 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80183b:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80183e:	83 ec 08             	sub    $0x8,%esp
+  801841:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801844:	50                   	push   %eax
+  801845:	ff 33                	push   (%ebx)
+  801847:	e8 bd fd ff ff       	call   801609 <dev_lookup>
+  80184c:	83 c4 10             	add    $0x10,%esp
+  80184f:	85 c0                	test   %eax,%eax
+  801851:	78 24                	js     801877 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801853:	8b 43 08             	mov    0x8(%ebx),%eax
+  801856:	83 e0 03             	and    $0x3,%eax
+  801859:	83 f8 01             	cmp    $0x1,%eax
+  80185c:	74 20                	je     80187e <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80185e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801861:	8b 40 08             	mov    0x8(%eax),%eax
+  801864:	85 c0                	test   %eax,%eax
+  801866:	74 37                	je     80189f <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801868:	83 ec 04             	sub    $0x4,%esp
+  80186b:	ff 75 10             	push   0x10(%ebp)
+  80186e:	ff 75 0c             	push   0xc(%ebp)
+  801871:	53                   	push   %ebx
+  801872:	ff d0                	call   *%eax
+  801874:	83 c4 10             	add    $0x10,%esp
+}
+  801877:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80187a:	5b                   	pop    %ebx
+  80187b:	5e                   	pop    %esi
+  80187c:	5d                   	pop    %ebp
+  80187d:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80187e:	a1 08 50 80 00       	mov    0x805008,%eax
+  801883:	8b 40 48             	mov    0x48(%eax),%eax
+  801886:	83 ec 04             	sub    $0x4,%esp
+  801889:	56                   	push   %esi
+  80188a:	50                   	push   %eax
+  80188b:	68 c9 32 80 00       	push   $0x8032c9
+  801890:	e8 28 ef ff ff       	call   8007bd <cprintf>
+		return -E_INVAL;
+  801895:	83 c4 10             	add    $0x10,%esp
+  801898:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80189d:	eb d8                	jmp    801877 <read+0x58>
+		return -E_NOT_SUPP;
+  80189f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8018a4:	eb d1                	jmp    801877 <read+0x58>
+
+008018a6 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8018a6:	55                   	push   %ebp
+  8018a7:	89 e5                	mov    %esp,%ebp
+  8018a9:	57                   	push   %edi
+  8018aa:	56                   	push   %esi
+  8018ab:	53                   	push   %ebx
+  8018ac:	83 ec 0c             	sub    $0xc,%esp
+  8018af:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8018b2:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8018b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018ba:	eb 02                	jmp    8018be <readn+0x18>
+  8018bc:	01 c3                	add    %eax,%ebx
+  8018be:	39 f3                	cmp    %esi,%ebx
+  8018c0:	73 21                	jae    8018e3 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8018c2:	83 ec 04             	sub    $0x4,%esp
+  8018c5:	89 f0                	mov    %esi,%eax
+  8018c7:	29 d8                	sub    %ebx,%eax
+  8018c9:	50                   	push   %eax
+  8018ca:	89 d8                	mov    %ebx,%eax
+  8018cc:	03 45 0c             	add    0xc(%ebp),%eax
+  8018cf:	50                   	push   %eax
+  8018d0:	57                   	push   %edi
+  8018d1:	e8 49 ff ff ff       	call   80181f <read>
+		if (m < 0)
+  8018d6:	83 c4 10             	add    $0x10,%esp
+  8018d9:	85 c0                	test   %eax,%eax
+  8018db:	78 04                	js     8018e1 <readn+0x3b>
+			return m;
+		if (m == 0)
+  8018dd:	75 dd                	jne    8018bc <readn+0x16>
+  8018df:	eb 02                	jmp    8018e3 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8018e1:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8018e3:	89 d8                	mov    %ebx,%eax
+  8018e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018e8:	5b                   	pop    %ebx
+  8018e9:	5e                   	pop    %esi
+  8018ea:	5f                   	pop    %edi
+  8018eb:	5d                   	pop    %ebp
+  8018ec:	c3                   	ret
+
+008018ed <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8018ed:	55                   	push   %ebp
+  8018ee:	89 e5                	mov    %esp,%ebp
+  8018f0:	56                   	push   %esi
+  8018f1:	53                   	push   %ebx
+  8018f2:	83 ec 18             	sub    $0x18,%esp
+  8018f5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018f8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018fb:	50                   	push   %eax
+  8018fc:	53                   	push   %ebx
+  8018fd:	e8 b7 fc ff ff       	call   8015b9 <fd_lookup>
+  801902:	83 c4 10             	add    $0x10,%esp
+  801905:	85 c0                	test   %eax,%eax
+  801907:	78 37                	js     801940 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801909:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80190c:	83 ec 08             	sub    $0x8,%esp
+  80190f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801912:	50                   	push   %eax
+  801913:	ff 36                	push   (%esi)
+  801915:	e8 ef fc ff ff       	call   801609 <dev_lookup>
+  80191a:	83 c4 10             	add    $0x10,%esp
+  80191d:	85 c0                	test   %eax,%eax
+  80191f:	78 1f                	js     801940 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801921:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801925:	74 20                	je     801947 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801927:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80192a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80192d:	85 c0                	test   %eax,%eax
+  80192f:	74 37                	je     801968 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801931:	83 ec 04             	sub    $0x4,%esp
+  801934:	ff 75 10             	push   0x10(%ebp)
+  801937:	ff 75 0c             	push   0xc(%ebp)
+  80193a:	56                   	push   %esi
+  80193b:	ff d0                	call   *%eax
+  80193d:	83 c4 10             	add    $0x10,%esp
+}
+  801940:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801943:	5b                   	pop    %ebx
+  801944:	5e                   	pop    %esi
+  801945:	5d                   	pop    %ebp
+  801946:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801947:	a1 08 50 80 00       	mov    0x805008,%eax
+  80194c:	8b 40 48             	mov    0x48(%eax),%eax
+  80194f:	83 ec 04             	sub    $0x4,%esp
+  801952:	53                   	push   %ebx
+  801953:	50                   	push   %eax
+  801954:	68 e5 32 80 00       	push   $0x8032e5
+  801959:	e8 5f ee ff ff       	call   8007bd <cprintf>
+		return -E_INVAL;
+  80195e:	83 c4 10             	add    $0x10,%esp
+  801961:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801966:	eb d8                	jmp    801940 <write+0x53>
+		return -E_NOT_SUPP;
+  801968:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80196d:	eb d1                	jmp    801940 <write+0x53>
+
+0080196f <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80196f:	55                   	push   %ebp
+  801970:	89 e5                	mov    %esp,%ebp
+  801972:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801975:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801978:	50                   	push   %eax
+  801979:	ff 75 08             	push   0x8(%ebp)
+  80197c:	e8 38 fc ff ff       	call   8015b9 <fd_lookup>
+  801981:	83 c4 10             	add    $0x10,%esp
+  801984:	85 c0                	test   %eax,%eax
+  801986:	78 0e                	js     801996 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801988:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80198b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80198e:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801991:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801996:	c9                   	leave
+  801997:	c3                   	ret
+
+00801998 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801998:	55                   	push   %ebp
+  801999:	89 e5                	mov    %esp,%ebp
+  80199b:	56                   	push   %esi
+  80199c:	53                   	push   %ebx
+  80199d:	83 ec 18             	sub    $0x18,%esp
+  8019a0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8019a3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8019a6:	50                   	push   %eax
+  8019a7:	53                   	push   %ebx
+  8019a8:	e8 0c fc ff ff       	call   8015b9 <fd_lookup>
+  8019ad:	83 c4 10             	add    $0x10,%esp
+  8019b0:	85 c0                	test   %eax,%eax
+  8019b2:	78 34                	js     8019e8 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8019b4:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8019b7:	83 ec 08             	sub    $0x8,%esp
+  8019ba:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019bd:	50                   	push   %eax
+  8019be:	ff 36                	push   (%esi)
+  8019c0:	e8 44 fc ff ff       	call   801609 <dev_lookup>
+  8019c5:	83 c4 10             	add    $0x10,%esp
+  8019c8:	85 c0                	test   %eax,%eax
+  8019ca:	78 1c                	js     8019e8 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8019cc:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8019d0:	74 1d                	je     8019ef <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8019d2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019d5:	8b 40 18             	mov    0x18(%eax),%eax
+  8019d8:	85 c0                	test   %eax,%eax
+  8019da:	74 34                	je     801a10 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8019dc:	83 ec 08             	sub    $0x8,%esp
+  8019df:	ff 75 0c             	push   0xc(%ebp)
+  8019e2:	56                   	push   %esi
+  8019e3:	ff d0                	call   *%eax
+  8019e5:	83 c4 10             	add    $0x10,%esp
+}
+  8019e8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019eb:	5b                   	pop    %ebx
+  8019ec:	5e                   	pop    %esi
+  8019ed:	5d                   	pop    %ebp
+  8019ee:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8019ef:	a1 08 50 80 00       	mov    0x805008,%eax
+  8019f4:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8019f7:	83 ec 04             	sub    $0x4,%esp
+  8019fa:	53                   	push   %ebx
+  8019fb:	50                   	push   %eax
+  8019fc:	68 a8 32 80 00       	push   $0x8032a8
+  801a01:	e8 b7 ed ff ff       	call   8007bd <cprintf>
+		return -E_INVAL;
+  801a06:	83 c4 10             	add    $0x10,%esp
+  801a09:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a0e:	eb d8                	jmp    8019e8 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801a10:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a15:	eb d1                	jmp    8019e8 <ftruncate+0x50>
+
+00801a17 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801a17:	55                   	push   %ebp
+  801a18:	89 e5                	mov    %esp,%ebp
+  801a1a:	56                   	push   %esi
+  801a1b:	53                   	push   %ebx
+  801a1c:	83 ec 18             	sub    $0x18,%esp
+  801a1f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a22:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a25:	50                   	push   %eax
+  801a26:	ff 75 08             	push   0x8(%ebp)
+  801a29:	e8 8b fb ff ff       	call   8015b9 <fd_lookup>
+  801a2e:	83 c4 10             	add    $0x10,%esp
+  801a31:	85 c0                	test   %eax,%eax
+  801a33:	78 49                	js     801a7e <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801a35:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a38:	83 ec 08             	sub    $0x8,%esp
+  801a3b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a3e:	50                   	push   %eax
+  801a3f:	ff 36                	push   (%esi)
+  801a41:	e8 c3 fb ff ff       	call   801609 <dev_lookup>
+  801a46:	83 c4 10             	add    $0x10,%esp
+  801a49:	85 c0                	test   %eax,%eax
+  801a4b:	78 31                	js     801a7e <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801a4d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a50:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801a54:	74 2f                	je     801a85 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801a56:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801a59:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801a60:	00 00 00 
+	stat->st_isdir = 0;
+  801a63:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801a6a:	00 00 00 
+	stat->st_dev = dev;
+  801a6d:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801a73:	83 ec 08             	sub    $0x8,%esp
+  801a76:	53                   	push   %ebx
+  801a77:	56                   	push   %esi
+  801a78:	ff 50 14             	call   *0x14(%eax)
+  801a7b:	83 c4 10             	add    $0x10,%esp
+}
+  801a7e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a81:	5b                   	pop    %ebx
+  801a82:	5e                   	pop    %esi
+  801a83:	5d                   	pop    %ebp
+  801a84:	c3                   	ret
+		return -E_NOT_SUPP;
+  801a85:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a8a:	eb f2                	jmp    801a7e <fstat+0x67>
+
+00801a8c <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801a8c:	55                   	push   %ebp
+  801a8d:	89 e5                	mov    %esp,%ebp
+  801a8f:	56                   	push   %esi
+  801a90:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801a91:	83 ec 08             	sub    $0x8,%esp
+  801a94:	6a 00                	push   $0x0
+  801a96:	ff 75 08             	push   0x8(%ebp)
+  801a99:	e8 e4 01 00 00       	call   801c82 <open>
+  801a9e:	89 c3                	mov    %eax,%ebx
+  801aa0:	83 c4 10             	add    $0x10,%esp
+  801aa3:	85 c0                	test   %eax,%eax
+  801aa5:	78 1b                	js     801ac2 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801aa7:	83 ec 08             	sub    $0x8,%esp
+  801aaa:	ff 75 0c             	push   0xc(%ebp)
+  801aad:	50                   	push   %eax
+  801aae:	e8 64 ff ff ff       	call   801a17 <fstat>
+  801ab3:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801ab5:	89 1c 24             	mov    %ebx,(%esp)
+  801ab8:	e8 26 fc ff ff       	call   8016e3 <close>
+	return r;
+  801abd:	83 c4 10             	add    $0x10,%esp
+  801ac0:	89 f3                	mov    %esi,%ebx
+}
+  801ac2:	89 d8                	mov    %ebx,%eax
+  801ac4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ac7:	5b                   	pop    %ebx
+  801ac8:	5e                   	pop    %esi
+  801ac9:	5d                   	pop    %ebp
+  801aca:	c3                   	ret
+
+00801acb <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  801acb:	55                   	push   %ebp
+  801acc:	89 e5                	mov    %esp,%ebp
+  801ace:	56                   	push   %esi
+  801acf:	53                   	push   %ebx
+  801ad0:	89 c6                	mov    %eax,%esi
+  801ad2:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  801ad4:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  801adb:	74 27                	je     801b04 <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801add:	6a 07                	push   $0x7
+  801adf:	68 00 60 80 00       	push   $0x806000
+  801ae4:	56                   	push   %esi
+  801ae5:	ff 35 00 50 80 00    	push   0x805000
+  801aeb:	e8 b9 f9 ff ff       	call   8014a9 <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  801af0:	83 c4 0c             	add    $0xc,%esp
+  801af3:	6a 00                	push   $0x0
+  801af5:	53                   	push   %ebx
+  801af6:	6a 00                	push   $0x0
+  801af8:	e8 38 f9 ff ff       	call   801435 <ipc_recv>
+}
+  801afd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b00:	5b                   	pop    %ebx
+  801b01:	5e                   	pop    %esi
+  801b02:	5d                   	pop    %ebp
+  801b03:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  801b04:	83 ec 0c             	sub    $0xc,%esp
+  801b07:	6a 01                	push   $0x1
+  801b09:	e8 ef f9 ff ff       	call   8014fd <ipc_find_env>
+  801b0e:	a3 00 50 80 00       	mov    %eax,0x805000
+  801b13:	83 c4 10             	add    $0x10,%esp
+  801b16:	eb c5                	jmp    801add <fsipc+0x12>
+
+00801b18 <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801b18:	55                   	push   %ebp
+  801b19:	89 e5                	mov    %esp,%ebp
+  801b1b:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801b1e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b21:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b24:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.set_size.req_size = newsize;
+  801b29:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b2c:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801b31:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b36:	b8 02 00 00 00       	mov    $0x2,%eax
+  801b3b:	e8 8b ff ff ff       	call   801acb <fsipc>
+}
+  801b40:	c9                   	leave
+  801b41:	c3                   	ret
+
+00801b42 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801b42:	55                   	push   %ebp
+  801b43:	89 e5                	mov    %esp,%ebp
+  801b45:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801b48:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b4b:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b4e:	a3 00 60 80 00       	mov    %eax,0x806000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801b53:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b58:	b8 06 00 00 00       	mov    $0x6,%eax
+  801b5d:	e8 69 ff ff ff       	call   801acb <fsipc>
+}
+  801b62:	c9                   	leave
+  801b63:	c3                   	ret
+
+00801b64 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801b64:	55                   	push   %ebp
+  801b65:	89 e5                	mov    %esp,%ebp
+  801b67:	53                   	push   %ebx
+  801b68:	83 ec 04             	sub    $0x4,%esp
+  801b6b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801b6e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b71:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b74:	a3 00 60 80 00       	mov    %eax,0x806000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801b79:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b7e:	b8 05 00 00 00       	mov    $0x5,%eax
+  801b83:	e8 43 ff ff ff       	call   801acb <fsipc>
+  801b88:	85 c0                	test   %eax,%eax
+  801b8a:	78 2c                	js     801bb8 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801b8c:	83 ec 08             	sub    $0x8,%esp
+  801b8f:	68 00 60 80 00       	push   $0x806000
+  801b94:	53                   	push   %ebx
+  801b95:	e8 dc f1 ff ff       	call   800d76 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801b9a:	a1 80 60 80 00       	mov    0x806080,%eax
+  801b9f:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801ba5:	a1 84 60 80 00       	mov    0x806084,%eax
+  801baa:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801bb0:	83 c4 10             	add    $0x10,%esp
+  801bb3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801bb8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bbb:	c9                   	leave
+  801bbc:	c3                   	ret
+
+00801bbd <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801bbd:	55                   	push   %ebp
+  801bbe:	89 e5                	mov    %esp,%ebp
+  801bc0:	83 ec 0c             	sub    $0xc,%esp
+  801bc3:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801bc6:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bc9:	8b 52 0c             	mov    0xc(%edx),%edx
+  801bcc:	89 15 00 60 80 00    	mov    %edx,0x806000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801bd2:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801bd7:	39 d0                	cmp    %edx,%eax
+  801bd9:	0f 47 c2             	cmova  %edx,%eax
+  801bdc:	a3 04 60 80 00       	mov    %eax,0x806004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  801be1:	50                   	push   %eax
+  801be2:	ff 75 0c             	push   0xc(%ebp)
+  801be5:	68 08 60 80 00       	push   $0x806008
+  801bea:	e8 0d f3 ff ff       	call   800efc <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801bef:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bf4:	b8 04 00 00 00       	mov    $0x4,%eax
+  801bf9:	e8 cd fe ff ff       	call   801acb <fsipc>
+}
+  801bfe:	c9                   	leave
+  801bff:	c3                   	ret
+
+00801c00 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801c00:	55                   	push   %ebp
+  801c01:	89 e5                	mov    %esp,%ebp
+  801c03:	56                   	push   %esi
+  801c04:	53                   	push   %ebx
+  801c05:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801c08:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c0b:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c0e:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read.req_n = n;
+  801c13:	89 35 04 60 80 00    	mov    %esi,0x806004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801c19:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c1e:	b8 03 00 00 00       	mov    $0x3,%eax
+  801c23:	e8 a3 fe ff ff       	call   801acb <fsipc>
+  801c28:	89 c3                	mov    %eax,%ebx
+  801c2a:	85 c0                	test   %eax,%eax
+  801c2c:	78 1f                	js     801c4d <devfile_read+0x4d>
+  assert(r <= n);
+  801c2e:	39 c6                	cmp    %eax,%esi
+  801c30:	72 24                	jb     801c56 <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  801c32:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801c37:	7f 33                	jg     801c6c <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801c39:	83 ec 04             	sub    $0x4,%esp
+  801c3c:	50                   	push   %eax
+  801c3d:	68 00 60 80 00       	push   $0x806000
+  801c42:	ff 75 0c             	push   0xc(%ebp)
+  801c45:	e8 b2 f2 ff ff       	call   800efc <memmove>
+  return r;
+  801c4a:	83 c4 10             	add    $0x10,%esp
+}
+  801c4d:	89 d8                	mov    %ebx,%eax
+  801c4f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c52:	5b                   	pop    %ebx
+  801c53:	5e                   	pop    %esi
+  801c54:	5d                   	pop    %ebp
+  801c55:	c3                   	ret
+  assert(r <= n);
+  801c56:	68 18 33 80 00       	push   $0x803318
+  801c5b:	68 1f 33 80 00       	push   $0x80331f
+  801c60:	6a 78                	push   $0x78
+  801c62:	68 34 33 80 00       	push   $0x803334
+  801c67:	e8 76 ea ff ff       	call   8006e2 <_panic>
+  assert(r <= PGSIZE);
+  801c6c:	68 3f 33 80 00       	push   $0x80333f
+  801c71:	68 1f 33 80 00       	push   $0x80331f
+  801c76:	6a 79                	push   $0x79
+  801c78:	68 34 33 80 00       	push   $0x803334
+  801c7d:	e8 60 ea ff ff       	call   8006e2 <_panic>
+
+00801c82 <open>:
+open(const char *path, int mode) {
+  801c82:	55                   	push   %ebp
+  801c83:	89 e5                	mov    %esp,%ebp
+  801c85:	56                   	push   %esi
+  801c86:	53                   	push   %ebx
+  801c87:	83 ec 1c             	sub    $0x1c,%esp
+  801c8a:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801c8d:	56                   	push   %esi
+  801c8e:	e8 a8 f0 ff ff       	call   800d3b <strlen>
+  801c93:	83 c4 10             	add    $0x10,%esp
+  801c96:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801c9b:	7f 6c                	jg     801d09 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801c9d:	83 ec 0c             	sub    $0xc,%esp
+  801ca0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ca3:	50                   	push   %eax
+  801ca4:	e8 ba f8 ff ff       	call   801563 <fd_alloc>
+  801ca9:	89 c3                	mov    %eax,%ebx
+  801cab:	83 c4 10             	add    $0x10,%esp
+  801cae:	85 c0                	test   %eax,%eax
+  801cb0:	78 3c                	js     801cee <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801cb2:	83 ec 08             	sub    $0x8,%esp
+  801cb5:	56                   	push   %esi
+  801cb6:	68 00 60 80 00       	push   $0x806000
+  801cbb:	e8 b6 f0 ff ff       	call   800d76 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801cc0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801cc3:	a3 00 64 80 00       	mov    %eax,0x806400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801cc8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801ccb:	b8 01 00 00 00       	mov    $0x1,%eax
+  801cd0:	e8 f6 fd ff ff       	call   801acb <fsipc>
+  801cd5:	89 c3                	mov    %eax,%ebx
+  801cd7:	83 c4 10             	add    $0x10,%esp
+  801cda:	85 c0                	test   %eax,%eax
+  801cdc:	78 19                	js     801cf7 <open+0x75>
+  return fd2num(fd);
+  801cde:	83 ec 0c             	sub    $0xc,%esp
+  801ce1:	ff 75 f4             	push   -0xc(%ebp)
+  801ce4:	e8 53 f8 ff ff       	call   80153c <fd2num>
+  801ce9:	89 c3                	mov    %eax,%ebx
+  801ceb:	83 c4 10             	add    $0x10,%esp
+}
+  801cee:	89 d8                	mov    %ebx,%eax
+  801cf0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cf3:	5b                   	pop    %ebx
+  801cf4:	5e                   	pop    %esi
+  801cf5:	5d                   	pop    %ebp
+  801cf6:	c3                   	ret
+    fd_close(fd, 0);
+  801cf7:	83 ec 08             	sub    $0x8,%esp
+  801cfa:	6a 00                	push   $0x0
+  801cfc:	ff 75 f4             	push   -0xc(%ebp)
+  801cff:	e8 58 f9 ff ff       	call   80165c <fd_close>
+    return r;
+  801d04:	83 c4 10             	add    $0x10,%esp
+  801d07:	eb e5                	jmp    801cee <open+0x6c>
+    return -E_BAD_PATH;
+  801d09:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801d0e:	eb de                	jmp    801cee <open+0x6c>
+
+00801d10 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  801d10:	55                   	push   %ebp
+  801d11:	89 e5                	mov    %esp,%ebp
+  801d13:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801d16:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d1b:	b8 08 00 00 00       	mov    $0x8,%eax
+  801d20:	e8 a6 fd ff ff       	call   801acb <fsipc>
+}
+  801d25:	c9                   	leave
+  801d26:	c3                   	ret
+
+00801d27 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801d27:	55                   	push   %ebp
+  801d28:	89 e5                	mov    %esp,%ebp
+  801d2a:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801d2d:	68 4b 33 80 00       	push   $0x80334b
+  801d32:	ff 75 0c             	push   0xc(%ebp)
+  801d35:	e8 3c f0 ff ff       	call   800d76 <strcpy>
+	return 0;
+}
+  801d3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d3f:	c9                   	leave
+  801d40:	c3                   	ret
+
+00801d41 <devsock_close>:
+{
+  801d41:	55                   	push   %ebp
+  801d42:	89 e5                	mov    %esp,%ebp
+  801d44:	53                   	push   %ebx
+  801d45:	83 ec 10             	sub    $0x10,%esp
+  801d48:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801d4b:	53                   	push   %ebx
+  801d4c:	e8 fc 08 00 00       	call   80264d <pageref>
+  801d51:	89 c2                	mov    %eax,%edx
+  801d53:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801d56:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801d5b:	83 fa 01             	cmp    $0x1,%edx
+  801d5e:	74 05                	je     801d65 <devsock_close+0x24>
+}
+  801d60:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d63:	c9                   	leave
+  801d64:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801d65:	83 ec 0c             	sub    $0xc,%esp
+  801d68:	ff 73 0c             	push   0xc(%ebx)
+  801d6b:	e8 b7 02 00 00       	call   802027 <nsipc_close>
+  801d70:	83 c4 10             	add    $0x10,%esp
+  801d73:	eb eb                	jmp    801d60 <devsock_close+0x1f>
+
+00801d75 <devsock_write>:
+{
+  801d75:	55                   	push   %ebp
+  801d76:	89 e5                	mov    %esp,%ebp
+  801d78:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801d7b:	6a 00                	push   $0x0
+  801d7d:	ff 75 10             	push   0x10(%ebp)
+  801d80:	ff 75 0c             	push   0xc(%ebp)
+  801d83:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d86:	ff 70 0c             	push   0xc(%eax)
+  801d89:	e8 79 03 00 00       	call   802107 <nsipc_send>
+}
+  801d8e:	c9                   	leave
+  801d8f:	c3                   	ret
+
+00801d90 <devsock_read>:
+{
+  801d90:	55                   	push   %ebp
+  801d91:	89 e5                	mov    %esp,%ebp
+  801d93:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801d96:	6a 00                	push   $0x0
+  801d98:	ff 75 10             	push   0x10(%ebp)
+  801d9b:	ff 75 0c             	push   0xc(%ebp)
+  801d9e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801da1:	ff 70 0c             	push   0xc(%eax)
+  801da4:	e8 ef 02 00 00       	call   802098 <nsipc_recv>
+}
+  801da9:	c9                   	leave
+  801daa:	c3                   	ret
+
+00801dab <fd2sockid>:
+{
+  801dab:	55                   	push   %ebp
+  801dac:	89 e5                	mov    %esp,%ebp
+  801dae:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801db1:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801db4:	52                   	push   %edx
+  801db5:	50                   	push   %eax
+  801db6:	e8 fe f7 ff ff       	call   8015b9 <fd_lookup>
+  801dbb:	83 c4 10             	add    $0x10,%esp
+  801dbe:	85 c0                	test   %eax,%eax
+  801dc0:	78 10                	js     801dd2 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801dc2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dc5:	8b 0d 24 40 80 00    	mov    0x804024,%ecx
+  801dcb:	39 08                	cmp    %ecx,(%eax)
+  801dcd:	75 05                	jne    801dd4 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801dcf:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801dd2:	c9                   	leave
+  801dd3:	c3                   	ret
+		return -E_NOT_SUPP;
+  801dd4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801dd9:	eb f7                	jmp    801dd2 <fd2sockid+0x27>
+
+00801ddb <alloc_sockfd>:
+{
+  801ddb:	55                   	push   %ebp
+  801ddc:	89 e5                	mov    %esp,%ebp
+  801dde:	56                   	push   %esi
+  801ddf:	53                   	push   %ebx
+  801de0:	83 ec 1c             	sub    $0x1c,%esp
+  801de3:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801de5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801de8:	50                   	push   %eax
+  801de9:	e8 75 f7 ff ff       	call   801563 <fd_alloc>
+  801dee:	89 c3                	mov    %eax,%ebx
+  801df0:	83 c4 10             	add    $0x10,%esp
+  801df3:	85 c0                	test   %eax,%eax
+  801df5:	78 43                	js     801e3a <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801df7:	83 ec 04             	sub    $0x4,%esp
+  801dfa:	68 07 04 00 00       	push   $0x407
+  801dff:	ff 75 f4             	push   -0xc(%ebp)
+  801e02:	6a 00                	push   $0x0
+  801e04:	e8 59 f3 ff ff       	call   801162 <sys_page_alloc>
+  801e09:	89 c3                	mov    %eax,%ebx
+  801e0b:	83 c4 10             	add    $0x10,%esp
+  801e0e:	85 c0                	test   %eax,%eax
+  801e10:	78 28                	js     801e3a <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801e12:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e15:	8b 15 24 40 80 00    	mov    0x804024,%edx
+  801e1b:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801e1d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e20:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801e27:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801e2a:	83 ec 0c             	sub    $0xc,%esp
+  801e2d:	50                   	push   %eax
+  801e2e:	e8 09 f7 ff ff       	call   80153c <fd2num>
+  801e33:	89 c3                	mov    %eax,%ebx
+  801e35:	83 c4 10             	add    $0x10,%esp
+  801e38:	eb 0c                	jmp    801e46 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801e3a:	83 ec 0c             	sub    $0xc,%esp
+  801e3d:	56                   	push   %esi
+  801e3e:	e8 e4 01 00 00       	call   802027 <nsipc_close>
+		return r;
+  801e43:	83 c4 10             	add    $0x10,%esp
+}
+  801e46:	89 d8                	mov    %ebx,%eax
+  801e48:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e4b:	5b                   	pop    %ebx
+  801e4c:	5e                   	pop    %esi
+  801e4d:	5d                   	pop    %ebp
+  801e4e:	c3                   	ret
+
+00801e4f <accept>:
+{
+  801e4f:	55                   	push   %ebp
+  801e50:	89 e5                	mov    %esp,%ebp
+  801e52:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e55:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e58:	e8 4e ff ff ff       	call   801dab <fd2sockid>
+  801e5d:	85 c0                	test   %eax,%eax
+  801e5f:	78 1b                	js     801e7c <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801e61:	83 ec 04             	sub    $0x4,%esp
+  801e64:	ff 75 10             	push   0x10(%ebp)
+  801e67:	ff 75 0c             	push   0xc(%ebp)
+  801e6a:	50                   	push   %eax
+  801e6b:	e8 0e 01 00 00       	call   801f7e <nsipc_accept>
+  801e70:	83 c4 10             	add    $0x10,%esp
+  801e73:	85 c0                	test   %eax,%eax
+  801e75:	78 05                	js     801e7c <accept+0x2d>
+	return alloc_sockfd(r);
+  801e77:	e8 5f ff ff ff       	call   801ddb <alloc_sockfd>
+}
+  801e7c:	c9                   	leave
+  801e7d:	c3                   	ret
+
+00801e7e <bind>:
+{
+  801e7e:	55                   	push   %ebp
+  801e7f:	89 e5                	mov    %esp,%ebp
+  801e81:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e84:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e87:	e8 1f ff ff ff       	call   801dab <fd2sockid>
+  801e8c:	85 c0                	test   %eax,%eax
+  801e8e:	78 12                	js     801ea2 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801e90:	83 ec 04             	sub    $0x4,%esp
+  801e93:	ff 75 10             	push   0x10(%ebp)
+  801e96:	ff 75 0c             	push   0xc(%ebp)
+  801e99:	50                   	push   %eax
+  801e9a:	e8 31 01 00 00       	call   801fd0 <nsipc_bind>
+  801e9f:	83 c4 10             	add    $0x10,%esp
+}
+  801ea2:	c9                   	leave
+  801ea3:	c3                   	ret
+
+00801ea4 <shutdown>:
+{
+  801ea4:	55                   	push   %ebp
+  801ea5:	89 e5                	mov    %esp,%ebp
+  801ea7:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801eaa:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ead:	e8 f9 fe ff ff       	call   801dab <fd2sockid>
+  801eb2:	85 c0                	test   %eax,%eax
+  801eb4:	78 0f                	js     801ec5 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801eb6:	83 ec 08             	sub    $0x8,%esp
+  801eb9:	ff 75 0c             	push   0xc(%ebp)
+  801ebc:	50                   	push   %eax
+  801ebd:	e8 43 01 00 00       	call   802005 <nsipc_shutdown>
+  801ec2:	83 c4 10             	add    $0x10,%esp
+}
+  801ec5:	c9                   	leave
+  801ec6:	c3                   	ret
+
+00801ec7 <connect>:
+{
+  801ec7:	55                   	push   %ebp
+  801ec8:	89 e5                	mov    %esp,%ebp
+  801eca:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801ecd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ed0:	e8 d6 fe ff ff       	call   801dab <fd2sockid>
+  801ed5:	85 c0                	test   %eax,%eax
+  801ed7:	78 12                	js     801eeb <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801ed9:	83 ec 04             	sub    $0x4,%esp
+  801edc:	ff 75 10             	push   0x10(%ebp)
+  801edf:	ff 75 0c             	push   0xc(%ebp)
+  801ee2:	50                   	push   %eax
+  801ee3:	e8 59 01 00 00       	call   802041 <nsipc_connect>
+  801ee8:	83 c4 10             	add    $0x10,%esp
+}
+  801eeb:	c9                   	leave
+  801eec:	c3                   	ret
+
+00801eed <listen>:
+{
+  801eed:	55                   	push   %ebp
+  801eee:	89 e5                	mov    %esp,%ebp
+  801ef0:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801ef3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ef6:	e8 b0 fe ff ff       	call   801dab <fd2sockid>
+  801efb:	85 c0                	test   %eax,%eax
+  801efd:	78 0f                	js     801f0e <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801eff:	83 ec 08             	sub    $0x8,%esp
+  801f02:	ff 75 0c             	push   0xc(%ebp)
+  801f05:	50                   	push   %eax
+  801f06:	e8 6b 01 00 00       	call   802076 <nsipc_listen>
+  801f0b:	83 c4 10             	add    $0x10,%esp
+}
+  801f0e:	c9                   	leave
+  801f0f:	c3                   	ret
+
+00801f10 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801f10:	55                   	push   %ebp
+  801f11:	89 e5                	mov    %esp,%ebp
+  801f13:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801f16:	ff 75 10             	push   0x10(%ebp)
+  801f19:	ff 75 0c             	push   0xc(%ebp)
+  801f1c:	ff 75 08             	push   0x8(%ebp)
+  801f1f:	e8 41 02 00 00       	call   802165 <nsipc_socket>
+  801f24:	83 c4 10             	add    $0x10,%esp
+  801f27:	85 c0                	test   %eax,%eax
+  801f29:	78 05                	js     801f30 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801f2b:	e8 ab fe ff ff       	call   801ddb <alloc_sockfd>
+}
+  801f30:	c9                   	leave
+  801f31:	c3                   	ret
+
+00801f32 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801f32:	55                   	push   %ebp
+  801f33:	89 e5                	mov    %esp,%ebp
+  801f35:	53                   	push   %ebx
+  801f36:	83 ec 04             	sub    $0x4,%esp
+  801f39:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801f3b:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  801f42:	74 26                	je     801f6a <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801f44:	6a 07                	push   $0x7
+  801f46:	68 00 70 80 00       	push   $0x807000
+  801f4b:	53                   	push   %ebx
+  801f4c:	ff 35 04 50 80 00    	push   0x805004
+  801f52:	e8 52 f5 ff ff       	call   8014a9 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801f57:	83 c4 0c             	add    $0xc,%esp
+  801f5a:	6a 00                	push   $0x0
+  801f5c:	6a 00                	push   $0x0
+  801f5e:	6a 00                	push   $0x0
+  801f60:	e8 d0 f4 ff ff       	call   801435 <ipc_recv>
+}
+  801f65:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f68:	c9                   	leave
+  801f69:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801f6a:	83 ec 0c             	sub    $0xc,%esp
+  801f6d:	6a 02                	push   $0x2
+  801f6f:	e8 89 f5 ff ff       	call   8014fd <ipc_find_env>
+  801f74:	a3 04 50 80 00       	mov    %eax,0x805004
+  801f79:	83 c4 10             	add    $0x10,%esp
+  801f7c:	eb c6                	jmp    801f44 <nsipc+0x12>
+
+00801f7e <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801f7e:	55                   	push   %ebp
+  801f7f:	89 e5                	mov    %esp,%ebp
+  801f81:	56                   	push   %esi
+  801f82:	53                   	push   %ebx
+  801f83:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801f86:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f89:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801f8e:	8b 06                	mov    (%esi),%eax
+  801f90:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801f95:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f9a:	e8 93 ff ff ff       	call   801f32 <nsipc>
+  801f9f:	89 c3                	mov    %eax,%ebx
+  801fa1:	85 c0                	test   %eax,%eax
+  801fa3:	79 09                	jns    801fae <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801fa5:	89 d8                	mov    %ebx,%eax
+  801fa7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801faa:	5b                   	pop    %ebx
+  801fab:	5e                   	pop    %esi
+  801fac:	5d                   	pop    %ebp
+  801fad:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801fae:	83 ec 04             	sub    $0x4,%esp
+  801fb1:	ff 35 10 70 80 00    	push   0x807010
+  801fb7:	68 00 70 80 00       	push   $0x807000
+  801fbc:	ff 75 0c             	push   0xc(%ebp)
+  801fbf:	e8 38 ef ff ff       	call   800efc <memmove>
+		*addrlen = ret->ret_addrlen;
+  801fc4:	a1 10 70 80 00       	mov    0x807010,%eax
+  801fc9:	89 06                	mov    %eax,(%esi)
+  801fcb:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801fce:	eb d5                	jmp    801fa5 <nsipc_accept+0x27>
+
+00801fd0 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801fd0:	55                   	push   %ebp
+  801fd1:	89 e5                	mov    %esp,%ebp
+  801fd3:	53                   	push   %ebx
+  801fd4:	83 ec 08             	sub    $0x8,%esp
+  801fd7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801fda:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fdd:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801fe2:	53                   	push   %ebx
+  801fe3:	ff 75 0c             	push   0xc(%ebp)
+  801fe6:	68 04 70 80 00       	push   $0x807004
+  801feb:	e8 0c ef ff ff       	call   800efc <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801ff0:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  801ff6:	b8 02 00 00 00       	mov    $0x2,%eax
+  801ffb:	e8 32 ff ff ff       	call   801f32 <nsipc>
+}
+  802000:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802003:	c9                   	leave
+  802004:	c3                   	ret
+
+00802005 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802005:	55                   	push   %ebp
+  802006:	89 e5                	mov    %esp,%ebp
+  802008:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  80200b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80200e:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  802013:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802016:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  80201b:	b8 03 00 00 00       	mov    $0x3,%eax
+  802020:	e8 0d ff ff ff       	call   801f32 <nsipc>
+}
+  802025:	c9                   	leave
+  802026:	c3                   	ret
+
+00802027 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802027:	55                   	push   %ebp
+  802028:	89 e5                	mov    %esp,%ebp
+  80202a:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  80202d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802030:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  802035:	b8 04 00 00 00       	mov    $0x4,%eax
+  80203a:	e8 f3 fe ff ff       	call   801f32 <nsipc>
+}
+  80203f:	c9                   	leave
+  802040:	c3                   	ret
+
+00802041 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802041:	55                   	push   %ebp
+  802042:	89 e5                	mov    %esp,%ebp
+  802044:	53                   	push   %ebx
+  802045:	83 ec 08             	sub    $0x8,%esp
+  802048:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  80204b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80204e:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802053:	53                   	push   %ebx
+  802054:	ff 75 0c             	push   0xc(%ebp)
+  802057:	68 04 70 80 00       	push   $0x807004
+  80205c:	e8 9b ee ff ff       	call   800efc <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802061:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  802067:	b8 05 00 00 00       	mov    $0x5,%eax
+  80206c:	e8 c1 fe ff ff       	call   801f32 <nsipc>
+}
+  802071:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802074:	c9                   	leave
+  802075:	c3                   	ret
+
+00802076 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802076:	55                   	push   %ebp
+  802077:	89 e5                	mov    %esp,%ebp
+  802079:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  80207c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80207f:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  802084:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802087:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  80208c:	b8 06 00 00 00       	mov    $0x6,%eax
+  802091:	e8 9c fe ff ff       	call   801f32 <nsipc>
+}
+  802096:	c9                   	leave
+  802097:	c3                   	ret
+
+00802098 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802098:	55                   	push   %ebp
+  802099:	89 e5                	mov    %esp,%ebp
+  80209b:	56                   	push   %esi
+  80209c:	53                   	push   %ebx
+  80209d:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8020a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020a3:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  8020a8:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  8020ae:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020b1:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8020b6:	b8 07 00 00 00       	mov    $0x7,%eax
+  8020bb:	e8 72 fe ff ff       	call   801f32 <nsipc>
+  8020c0:	89 c3                	mov    %eax,%ebx
+  8020c2:	85 c0                	test   %eax,%eax
+  8020c4:	78 22                	js     8020e8 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8020c6:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8020cb:	39 c6                	cmp    %eax,%esi
+  8020cd:	0f 4e c6             	cmovle %esi,%eax
+  8020d0:	39 c3                	cmp    %eax,%ebx
+  8020d2:	7f 1d                	jg     8020f1 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8020d4:	83 ec 04             	sub    $0x4,%esp
+  8020d7:	53                   	push   %ebx
+  8020d8:	68 00 70 80 00       	push   $0x807000
+  8020dd:	ff 75 0c             	push   0xc(%ebp)
+  8020e0:	e8 17 ee ff ff       	call   800efc <memmove>
+  8020e5:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8020e8:	89 d8                	mov    %ebx,%eax
+  8020ea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020ed:	5b                   	pop    %ebx
+  8020ee:	5e                   	pop    %esi
+  8020ef:	5d                   	pop    %ebp
+  8020f0:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8020f1:	68 57 33 80 00       	push   $0x803357
+  8020f6:	68 1f 33 80 00       	push   $0x80331f
+  8020fb:	6a 62                	push   $0x62
+  8020fd:	68 6c 33 80 00       	push   $0x80336c
+  802102:	e8 db e5 ff ff       	call   8006e2 <_panic>
+
+00802107 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802107:	55                   	push   %ebp
+  802108:	89 e5                	mov    %esp,%ebp
+  80210a:	53                   	push   %ebx
+  80210b:	83 ec 04             	sub    $0x4,%esp
+  80210e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802111:	8b 45 08             	mov    0x8(%ebp),%eax
+  802114:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  802119:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80211f:	7f 2e                	jg     80214f <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802121:	83 ec 04             	sub    $0x4,%esp
+  802124:	53                   	push   %ebx
+  802125:	ff 75 0c             	push   0xc(%ebp)
+  802128:	68 0c 70 80 00       	push   $0x80700c
+  80212d:	e8 ca ed ff ff       	call   800efc <memmove>
+	nsipcbuf.send.req_size = size;
+  802132:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  802138:	8b 45 14             	mov    0x14(%ebp),%eax
+  80213b:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  802140:	b8 08 00 00 00       	mov    $0x8,%eax
+  802145:	e8 e8 fd ff ff       	call   801f32 <nsipc>
+}
+  80214a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80214d:	c9                   	leave
+  80214e:	c3                   	ret
+	assert(size < 1600);
+  80214f:	68 78 33 80 00       	push   $0x803378
+  802154:	68 1f 33 80 00       	push   $0x80331f
+  802159:	6a 6d                	push   $0x6d
+  80215b:	68 6c 33 80 00       	push   $0x80336c
+  802160:	e8 7d e5 ff ff       	call   8006e2 <_panic>
+
+00802165 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802165:	55                   	push   %ebp
+  802166:	89 e5                	mov    %esp,%ebp
+  802168:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  80216b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80216e:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  802173:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802176:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  80217b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80217e:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  802183:	b8 09 00 00 00       	mov    $0x9,%eax
+  802188:	e8 a5 fd ff ff       	call   801f32 <nsipc>
+}
+  80218d:	c9                   	leave
+  80218e:	c3                   	ret
+
+0080218f <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80218f:	55                   	push   %ebp
+  802190:	89 e5                	mov    %esp,%ebp
+  802192:	56                   	push   %esi
+  802193:	53                   	push   %ebx
+  802194:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802197:	83 ec 0c             	sub    $0xc,%esp
+  80219a:	ff 75 08             	push   0x8(%ebp)
+  80219d:	e8 aa f3 ff ff       	call   80154c <fd2data>
+  8021a2:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8021a4:	83 c4 08             	add    $0x8,%esp
+  8021a7:	68 84 33 80 00       	push   $0x803384
+  8021ac:	53                   	push   %ebx
+  8021ad:	e8 c4 eb ff ff       	call   800d76 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8021b2:	8b 46 04             	mov    0x4(%esi),%eax
+  8021b5:	2b 06                	sub    (%esi),%eax
+  8021b7:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8021bd:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8021c4:	00 00 00 
+	stat->st_dev = &devpipe;
+  8021c7:	c7 83 88 00 00 00 40 	movl   $0x804040,0x88(%ebx)
+  8021ce:	40 80 00 
+	return 0;
+}
+  8021d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021d6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021d9:	5b                   	pop    %ebx
+  8021da:	5e                   	pop    %esi
+  8021db:	5d                   	pop    %ebp
+  8021dc:	c3                   	ret
+
+008021dd <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8021dd:	55                   	push   %ebp
+  8021de:	89 e5                	mov    %esp,%ebp
+  8021e0:	53                   	push   %ebx
+  8021e1:	83 ec 0c             	sub    $0xc,%esp
+  8021e4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8021e7:	53                   	push   %ebx
+  8021e8:	6a 00                	push   $0x0
+  8021ea:	e8 f8 ef ff ff       	call   8011e7 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8021ef:	89 1c 24             	mov    %ebx,(%esp)
+  8021f2:	e8 55 f3 ff ff       	call   80154c <fd2data>
+  8021f7:	83 c4 08             	add    $0x8,%esp
+  8021fa:	50                   	push   %eax
+  8021fb:	6a 00                	push   $0x0
+  8021fd:	e8 e5 ef ff ff       	call   8011e7 <sys_page_unmap>
+}
+  802202:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802205:	c9                   	leave
+  802206:	c3                   	ret
+
+00802207 <_pipeisclosed>:
+{
+  802207:	55                   	push   %ebp
+  802208:	89 e5                	mov    %esp,%ebp
+  80220a:	57                   	push   %edi
+  80220b:	56                   	push   %esi
+  80220c:	53                   	push   %ebx
+  80220d:	83 ec 1c             	sub    $0x1c,%esp
+  802210:	89 c7                	mov    %eax,%edi
+  802212:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  802214:	a1 08 50 80 00       	mov    0x805008,%eax
+  802219:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  80221c:	83 ec 0c             	sub    $0xc,%esp
+  80221f:	57                   	push   %edi
+  802220:	e8 28 04 00 00       	call   80264d <pageref>
+  802225:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802228:	89 34 24             	mov    %esi,(%esp)
+  80222b:	e8 1d 04 00 00       	call   80264d <pageref>
+		nn = thisenv->env_runs;
+  802230:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  802236:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  802239:	83 c4 10             	add    $0x10,%esp
+  80223c:	39 cb                	cmp    %ecx,%ebx
+  80223e:	74 1b                	je     80225b <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802240:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802243:	75 cf                	jne    802214 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802245:	8b 42 58             	mov    0x58(%edx),%eax
+  802248:	6a 01                	push   $0x1
+  80224a:	50                   	push   %eax
+  80224b:	53                   	push   %ebx
+  80224c:	68 8b 33 80 00       	push   $0x80338b
+  802251:	e8 67 e5 ff ff       	call   8007bd <cprintf>
+  802256:	83 c4 10             	add    $0x10,%esp
+  802259:	eb b9                	jmp    802214 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  80225b:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80225e:	0f 94 c0             	sete   %al
+  802261:	0f b6 c0             	movzbl %al,%eax
+}
+  802264:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802267:	5b                   	pop    %ebx
+  802268:	5e                   	pop    %esi
+  802269:	5f                   	pop    %edi
+  80226a:	5d                   	pop    %ebp
+  80226b:	c3                   	ret
+
+0080226c <devpipe_write>:
+{
+  80226c:	55                   	push   %ebp
+  80226d:	89 e5                	mov    %esp,%ebp
+  80226f:	57                   	push   %edi
+  802270:	56                   	push   %esi
+  802271:	53                   	push   %ebx
+  802272:	83 ec 28             	sub    $0x28,%esp
+  802275:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802278:	56                   	push   %esi
+  802279:	e8 ce f2 ff ff       	call   80154c <fd2data>
+  80227e:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802280:	83 c4 10             	add    $0x10,%esp
+  802283:	bf 00 00 00 00       	mov    $0x0,%edi
+  802288:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  80228b:	75 09                	jne    802296 <devpipe_write+0x2a>
+	return i;
+  80228d:	89 f8                	mov    %edi,%eax
+  80228f:	eb 23                	jmp    8022b4 <devpipe_write+0x48>
+			sys_yield();
+  802291:	e8 ad ee ff ff       	call   801143 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802296:	8b 43 04             	mov    0x4(%ebx),%eax
+  802299:	8b 0b                	mov    (%ebx),%ecx
+  80229b:	8d 51 20             	lea    0x20(%ecx),%edx
+  80229e:	39 d0                	cmp    %edx,%eax
+  8022a0:	72 1a                	jb     8022bc <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8022a2:	89 da                	mov    %ebx,%edx
+  8022a4:	89 f0                	mov    %esi,%eax
+  8022a6:	e8 5c ff ff ff       	call   802207 <_pipeisclosed>
+  8022ab:	85 c0                	test   %eax,%eax
+  8022ad:	74 e2                	je     802291 <devpipe_write+0x25>
+				return 0;
+  8022af:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022b7:	5b                   	pop    %ebx
+  8022b8:	5e                   	pop    %esi
+  8022b9:	5f                   	pop    %edi
+  8022ba:	5d                   	pop    %ebp
+  8022bb:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8022bc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8022bf:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8022c3:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8022c6:	89 c2                	mov    %eax,%edx
+  8022c8:	c1 fa 1f             	sar    $0x1f,%edx
+  8022cb:	89 d1                	mov    %edx,%ecx
+  8022cd:	c1 e9 1b             	shr    $0x1b,%ecx
+  8022d0:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8022d3:	83 e2 1f             	and    $0x1f,%edx
+  8022d6:	29 ca                	sub    %ecx,%edx
+  8022d8:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8022dc:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8022e0:	83 c0 01             	add    $0x1,%eax
+  8022e3:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8022e6:	83 c7 01             	add    $0x1,%edi
+  8022e9:	eb 9d                	jmp    802288 <devpipe_write+0x1c>
+
+008022eb <devpipe_read>:
+{
+  8022eb:	55                   	push   %ebp
+  8022ec:	89 e5                	mov    %esp,%ebp
+  8022ee:	57                   	push   %edi
+  8022ef:	56                   	push   %esi
+  8022f0:	53                   	push   %ebx
+  8022f1:	83 ec 18             	sub    $0x18,%esp
+  8022f4:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8022f7:	57                   	push   %edi
+  8022f8:	e8 4f f2 ff ff       	call   80154c <fd2data>
+  8022fd:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8022ff:	83 c4 10             	add    $0x10,%esp
+  802302:	be 00 00 00 00       	mov    $0x0,%esi
+  802307:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80230a:	75 13                	jne    80231f <devpipe_read+0x34>
+	return i;
+  80230c:	89 f0                	mov    %esi,%eax
+  80230e:	eb 02                	jmp    802312 <devpipe_read+0x27>
+				return i;
+  802310:	89 f0                	mov    %esi,%eax
+}
+  802312:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802315:	5b                   	pop    %ebx
+  802316:	5e                   	pop    %esi
+  802317:	5f                   	pop    %edi
+  802318:	5d                   	pop    %ebp
+  802319:	c3                   	ret
+			sys_yield();
+  80231a:	e8 24 ee ff ff       	call   801143 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  80231f:	8b 03                	mov    (%ebx),%eax
+  802321:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802324:	75 18                	jne    80233e <devpipe_read+0x53>
+			if (i > 0)
+  802326:	85 f6                	test   %esi,%esi
+  802328:	75 e6                	jne    802310 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  80232a:	89 da                	mov    %ebx,%edx
+  80232c:	89 f8                	mov    %edi,%eax
+  80232e:	e8 d4 fe ff ff       	call   802207 <_pipeisclosed>
+  802333:	85 c0                	test   %eax,%eax
+  802335:	74 e3                	je     80231a <devpipe_read+0x2f>
+				return 0;
+  802337:	b8 00 00 00 00       	mov    $0x0,%eax
+  80233c:	eb d4                	jmp    802312 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80233e:	99                   	cltd
+  80233f:	c1 ea 1b             	shr    $0x1b,%edx
+  802342:	01 d0                	add    %edx,%eax
+  802344:	83 e0 1f             	and    $0x1f,%eax
+  802347:	29 d0                	sub    %edx,%eax
+  802349:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  80234e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802351:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802354:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802357:	83 c6 01             	add    $0x1,%esi
+  80235a:	eb ab                	jmp    802307 <devpipe_read+0x1c>
+
+0080235c <pipe>:
+{
+  80235c:	55                   	push   %ebp
+  80235d:	89 e5                	mov    %esp,%ebp
+  80235f:	56                   	push   %esi
+  802360:	53                   	push   %ebx
+  802361:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802364:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802367:	50                   	push   %eax
+  802368:	e8 f6 f1 ff ff       	call   801563 <fd_alloc>
+  80236d:	89 c3                	mov    %eax,%ebx
+  80236f:	83 c4 10             	add    $0x10,%esp
+  802372:	85 c0                	test   %eax,%eax
+  802374:	0f 88 23 01 00 00    	js     80249d <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80237a:	83 ec 04             	sub    $0x4,%esp
+  80237d:	68 07 04 00 00       	push   $0x407
+  802382:	ff 75 f4             	push   -0xc(%ebp)
+  802385:	6a 00                	push   $0x0
+  802387:	e8 d6 ed ff ff       	call   801162 <sys_page_alloc>
+  80238c:	89 c3                	mov    %eax,%ebx
+  80238e:	83 c4 10             	add    $0x10,%esp
+  802391:	85 c0                	test   %eax,%eax
+  802393:	0f 88 04 01 00 00    	js     80249d <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802399:	83 ec 0c             	sub    $0xc,%esp
+  80239c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80239f:	50                   	push   %eax
+  8023a0:	e8 be f1 ff ff       	call   801563 <fd_alloc>
+  8023a5:	89 c3                	mov    %eax,%ebx
+  8023a7:	83 c4 10             	add    $0x10,%esp
+  8023aa:	85 c0                	test   %eax,%eax
+  8023ac:	0f 88 db 00 00 00    	js     80248d <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8023b2:	83 ec 04             	sub    $0x4,%esp
+  8023b5:	68 07 04 00 00       	push   $0x407
+  8023ba:	ff 75 f0             	push   -0x10(%ebp)
+  8023bd:	6a 00                	push   $0x0
+  8023bf:	e8 9e ed ff ff       	call   801162 <sys_page_alloc>
+  8023c4:	89 c3                	mov    %eax,%ebx
+  8023c6:	83 c4 10             	add    $0x10,%esp
+  8023c9:	85 c0                	test   %eax,%eax
+  8023cb:	0f 88 bc 00 00 00    	js     80248d <pipe+0x131>
+	va = fd2data(fd0);
+  8023d1:	83 ec 0c             	sub    $0xc,%esp
+  8023d4:	ff 75 f4             	push   -0xc(%ebp)
+  8023d7:	e8 70 f1 ff ff       	call   80154c <fd2data>
+  8023dc:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8023de:	83 c4 0c             	add    $0xc,%esp
+  8023e1:	68 07 04 00 00       	push   $0x407
+  8023e6:	50                   	push   %eax
+  8023e7:	6a 00                	push   $0x0
+  8023e9:	e8 74 ed ff ff       	call   801162 <sys_page_alloc>
+  8023ee:	89 c3                	mov    %eax,%ebx
+  8023f0:	83 c4 10             	add    $0x10,%esp
+  8023f3:	85 c0                	test   %eax,%eax
+  8023f5:	0f 88 82 00 00 00    	js     80247d <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8023fb:	83 ec 0c             	sub    $0xc,%esp
+  8023fe:	ff 75 f0             	push   -0x10(%ebp)
+  802401:	e8 46 f1 ff ff       	call   80154c <fd2data>
+  802406:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80240d:	50                   	push   %eax
+  80240e:	6a 00                	push   $0x0
+  802410:	56                   	push   %esi
+  802411:	6a 00                	push   $0x0
+  802413:	e8 8d ed ff ff       	call   8011a5 <sys_page_map>
+  802418:	89 c3                	mov    %eax,%ebx
+  80241a:	83 c4 20             	add    $0x20,%esp
+  80241d:	85 c0                	test   %eax,%eax
+  80241f:	78 4e                	js     80246f <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802421:	a1 40 40 80 00       	mov    0x804040,%eax
+  802426:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802429:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80242b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80242e:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802435:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802438:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80243a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80243d:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802444:	83 ec 0c             	sub    $0xc,%esp
+  802447:	ff 75 f4             	push   -0xc(%ebp)
+  80244a:	e8 ed f0 ff ff       	call   80153c <fd2num>
+  80244f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802452:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802454:	83 c4 04             	add    $0x4,%esp
+  802457:	ff 75 f0             	push   -0x10(%ebp)
+  80245a:	e8 dd f0 ff ff       	call   80153c <fd2num>
+  80245f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802462:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802465:	83 c4 10             	add    $0x10,%esp
+  802468:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80246d:	eb 2e                	jmp    80249d <pipe+0x141>
+	sys_page_unmap(0, va);
+  80246f:	83 ec 08             	sub    $0x8,%esp
+  802472:	56                   	push   %esi
+  802473:	6a 00                	push   $0x0
+  802475:	e8 6d ed ff ff       	call   8011e7 <sys_page_unmap>
+  80247a:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80247d:	83 ec 08             	sub    $0x8,%esp
+  802480:	ff 75 f0             	push   -0x10(%ebp)
+  802483:	6a 00                	push   $0x0
+  802485:	e8 5d ed ff ff       	call   8011e7 <sys_page_unmap>
+  80248a:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80248d:	83 ec 08             	sub    $0x8,%esp
+  802490:	ff 75 f4             	push   -0xc(%ebp)
+  802493:	6a 00                	push   $0x0
+  802495:	e8 4d ed ff ff       	call   8011e7 <sys_page_unmap>
+  80249a:	83 c4 10             	add    $0x10,%esp
+}
+  80249d:	89 d8                	mov    %ebx,%eax
+  80249f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024a2:	5b                   	pop    %ebx
+  8024a3:	5e                   	pop    %esi
+  8024a4:	5d                   	pop    %ebp
+  8024a5:	c3                   	ret
+
+008024a6 <pipeisclosed>:
+{
+  8024a6:	55                   	push   %ebp
+  8024a7:	89 e5                	mov    %esp,%ebp
+  8024a9:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8024ac:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024af:	50                   	push   %eax
+  8024b0:	ff 75 08             	push   0x8(%ebp)
+  8024b3:	e8 01 f1 ff ff       	call   8015b9 <fd_lookup>
+  8024b8:	83 c4 10             	add    $0x10,%esp
+  8024bb:	85 c0                	test   %eax,%eax
+  8024bd:	78 18                	js     8024d7 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8024bf:	83 ec 0c             	sub    $0xc,%esp
+  8024c2:	ff 75 f4             	push   -0xc(%ebp)
+  8024c5:	e8 82 f0 ff ff       	call   80154c <fd2data>
+  8024ca:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8024cc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024cf:	e8 33 fd ff ff       	call   802207 <_pipeisclosed>
+  8024d4:	83 c4 10             	add    $0x10,%esp
+}
+  8024d7:	c9                   	leave
+  8024d8:	c3                   	ret
+
+008024d9 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8024d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024de:	c3                   	ret
+
+008024df <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8024df:	55                   	push   %ebp
+  8024e0:	89 e5                	mov    %esp,%ebp
+  8024e2:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8024e5:	68 a3 33 80 00       	push   $0x8033a3
+  8024ea:	ff 75 0c             	push   0xc(%ebp)
+  8024ed:	e8 84 e8 ff ff       	call   800d76 <strcpy>
+	return 0;
+}
+  8024f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024f7:	c9                   	leave
+  8024f8:	c3                   	ret
+
+008024f9 <devcons_write>:
+{
+  8024f9:	55                   	push   %ebp
+  8024fa:	89 e5                	mov    %esp,%ebp
+  8024fc:	57                   	push   %edi
+  8024fd:	56                   	push   %esi
+  8024fe:	53                   	push   %ebx
+  8024ff:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802505:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80250a:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802510:	eb 2e                	jmp    802540 <devcons_write+0x47>
+		m = n - tot;
+  802512:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802515:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802517:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80251c:	39 c3                	cmp    %eax,%ebx
+  80251e:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802521:	83 ec 04             	sub    $0x4,%esp
+  802524:	53                   	push   %ebx
+  802525:	89 f0                	mov    %esi,%eax
+  802527:	03 45 0c             	add    0xc(%ebp),%eax
+  80252a:	50                   	push   %eax
+  80252b:	57                   	push   %edi
+  80252c:	e8 cb e9 ff ff       	call   800efc <memmove>
+		sys_cputs(buf, m);
+  802531:	83 c4 08             	add    $0x8,%esp
+  802534:	53                   	push   %ebx
+  802535:	57                   	push   %edi
+  802536:	e8 6b eb ff ff       	call   8010a6 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80253b:	01 de                	add    %ebx,%esi
+  80253d:	83 c4 10             	add    $0x10,%esp
+  802540:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802543:	72 cd                	jb     802512 <devcons_write+0x19>
+}
+  802545:	89 f0                	mov    %esi,%eax
+  802547:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80254a:	5b                   	pop    %ebx
+  80254b:	5e                   	pop    %esi
+  80254c:	5f                   	pop    %edi
+  80254d:	5d                   	pop    %ebp
+  80254e:	c3                   	ret
+
+0080254f <devcons_read>:
+{
+  80254f:	55                   	push   %ebp
+  802550:	89 e5                	mov    %esp,%ebp
+  802552:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802555:	b8 00 00 00 00       	mov    $0x0,%eax
+  80255a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80255e:	75 07                	jne    802567 <devcons_read+0x18>
+  802560:	eb 1f                	jmp    802581 <devcons_read+0x32>
+		sys_yield();
+  802562:	e8 dc eb ff ff       	call   801143 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802567:	e8 58 eb ff ff       	call   8010c4 <sys_cgetc>
+  80256c:	85 c0                	test   %eax,%eax
+  80256e:	74 f2                	je     802562 <devcons_read+0x13>
+	if (c < 0)
+  802570:	78 0f                	js     802581 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802572:	83 f8 04             	cmp    $0x4,%eax
+  802575:	74 0c                	je     802583 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802577:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80257a:	88 02                	mov    %al,(%edx)
+	return 1;
+  80257c:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802581:	c9                   	leave
+  802582:	c3                   	ret
+		return 0;
+  802583:	b8 00 00 00 00       	mov    $0x0,%eax
+  802588:	eb f7                	jmp    802581 <devcons_read+0x32>
+
+0080258a <cputchar>:
+{
+  80258a:	55                   	push   %ebp
+  80258b:	89 e5                	mov    %esp,%ebp
+  80258d:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802590:	8b 45 08             	mov    0x8(%ebp),%eax
+  802593:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802596:	6a 01                	push   $0x1
+  802598:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80259b:	50                   	push   %eax
+  80259c:	e8 05 eb ff ff       	call   8010a6 <sys_cputs>
+}
+  8025a1:	83 c4 10             	add    $0x10,%esp
+  8025a4:	c9                   	leave
+  8025a5:	c3                   	ret
+
+008025a6 <getchar>:
+{
+  8025a6:	55                   	push   %ebp
+  8025a7:	89 e5                	mov    %esp,%ebp
+  8025a9:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8025ac:	6a 01                	push   $0x1
+  8025ae:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8025b1:	50                   	push   %eax
+  8025b2:	6a 00                	push   $0x0
+  8025b4:	e8 66 f2 ff ff       	call   80181f <read>
+	if (r < 0)
+  8025b9:	83 c4 10             	add    $0x10,%esp
+  8025bc:	85 c0                	test   %eax,%eax
+  8025be:	78 06                	js     8025c6 <getchar+0x20>
+	if (r < 1)
+  8025c0:	74 06                	je     8025c8 <getchar+0x22>
+	return c;
+  8025c2:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8025c6:	c9                   	leave
+  8025c7:	c3                   	ret
+		return -E_EOF;
+  8025c8:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8025cd:	eb f7                	jmp    8025c6 <getchar+0x20>
+
+008025cf <iscons>:
+{
+  8025cf:	55                   	push   %ebp
+  8025d0:	89 e5                	mov    %esp,%ebp
+  8025d2:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8025d5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8025d8:	50                   	push   %eax
+  8025d9:	ff 75 08             	push   0x8(%ebp)
+  8025dc:	e8 d8 ef ff ff       	call   8015b9 <fd_lookup>
+  8025e1:	83 c4 10             	add    $0x10,%esp
+  8025e4:	85 c0                	test   %eax,%eax
+  8025e6:	78 11                	js     8025f9 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8025e8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025eb:	8b 15 5c 40 80 00    	mov    0x80405c,%edx
+  8025f1:	39 10                	cmp    %edx,(%eax)
+  8025f3:	0f 94 c0             	sete   %al
+  8025f6:	0f b6 c0             	movzbl %al,%eax
+}
+  8025f9:	c9                   	leave
+  8025fa:	c3                   	ret
+
+008025fb <opencons>:
+{
+  8025fb:	55                   	push   %ebp
+  8025fc:	89 e5                	mov    %esp,%ebp
+  8025fe:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802601:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802604:	50                   	push   %eax
+  802605:	e8 59 ef ff ff       	call   801563 <fd_alloc>
+  80260a:	83 c4 10             	add    $0x10,%esp
+  80260d:	85 c0                	test   %eax,%eax
+  80260f:	78 3a                	js     80264b <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802611:	83 ec 04             	sub    $0x4,%esp
+  802614:	68 07 04 00 00       	push   $0x407
+  802619:	ff 75 f4             	push   -0xc(%ebp)
+  80261c:	6a 00                	push   $0x0
+  80261e:	e8 3f eb ff ff       	call   801162 <sys_page_alloc>
+  802623:	83 c4 10             	add    $0x10,%esp
+  802626:	85 c0                	test   %eax,%eax
+  802628:	78 21                	js     80264b <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80262a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80262d:	8b 15 5c 40 80 00    	mov    0x80405c,%edx
+  802633:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802635:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802638:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80263f:	83 ec 0c             	sub    $0xc,%esp
+  802642:	50                   	push   %eax
+  802643:	e8 f4 ee ff ff       	call   80153c <fd2num>
+  802648:	83 c4 10             	add    $0x10,%esp
+}
+  80264b:	c9                   	leave
+  80264c:	c3                   	ret
+
+0080264d <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80264d:	55                   	push   %ebp
+  80264e:	89 e5                	mov    %esp,%ebp
+  802650:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802653:	89 c2                	mov    %eax,%edx
+  802655:	c1 ea 16             	shr    $0x16,%edx
+  802658:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80265f:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802664:	f6 c1 01             	test   $0x1,%cl
+  802667:	74 1c                	je     802685 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  802669:	c1 e8 0c             	shr    $0xc,%eax
+  80266c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802673:	a8 01                	test   $0x1,%al
+  802675:	74 0e                	je     802685 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802677:	c1 e8 0c             	shr    $0xc,%eax
+  80267a:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802681:	ef 
+  802682:	0f b7 d2             	movzwl %dx,%edx
+}
+  802685:	89 d0                	mov    %edx,%eax
+  802687:	5d                   	pop    %ebp
+  802688:	c3                   	ret
+  802689:	66 90                	xchg   %ax,%ax
+  80268b:	66 90                	xchg   %ax,%ax
+  80268d:	66 90                	xchg   %ax,%ax
+  80268f:	90                   	nop
+
+00802690 <__udivmoddi4>:
+  802690:	55                   	push   %ebp
+  802691:	57                   	push   %edi
+  802692:	56                   	push   %esi
+  802693:	53                   	push   %ebx
+  802694:	83 ec 24             	sub    $0x24,%esp
+  802697:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80269b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80269f:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  8026a3:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8026a7:	8b 54 24 44          	mov    0x44(%esp),%edx
+  8026ab:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8026af:	8b 44 24 40          	mov    0x40(%esp),%eax
+  8026b3:	89 d3                	mov    %edx,%ebx
+  8026b5:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8026b9:	09 c3                	or     %eax,%ebx
+  8026bb:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8026bf:	0f 84 9c 00 00 00    	je     802761 <__udivmoddi4+0xd1>
+  8026c5:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8026cc:	00 
+  8026cd:	31 c0                	xor    %eax,%eax
+  8026cf:	31 d2                	xor    %edx,%edx
+  8026d1:	89 fb                	mov    %edi,%ebx
+  8026d3:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8026da:	00 
+  8026db:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8026e0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8026e4:	01 c0                	add    %eax,%eax
+  8026e6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8026ed:	00 
+  8026ee:	89 c6                	mov    %eax,%esi
+  8026f0:	89 d7                	mov    %edx,%edi
+  8026f2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8026f6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8026fa:	0f ad d0             	shrd   %cl,%edx,%eax
+  8026fd:	d3 ea                	shr    %cl,%edx
+  8026ff:	f6 c1 20             	test   $0x20,%cl
+  802702:	0f 45 c2             	cmovne %edx,%eax
+  802705:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802709:	83 e0 01             	and    $0x1,%eax
+  80270c:	09 fa                	or     %edi,%edx
+  80270e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802712:	89 04 24             	mov    %eax,(%esp)
+  802715:	8b 04 24             	mov    (%esp),%eax
+  802718:	89 d5                	mov    %edx,%ebp
+  80271a:	09 f0                	or     %esi,%eax
+  80271c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802720:	39 f0                	cmp    %esi,%eax
+  802722:	19 fd                	sbb    %edi,%ebp
+  802724:	72 1d                	jb     802743 <__udivmoddi4+0xb3>
+  802726:	29 f0                	sub    %esi,%eax
+  802728:	19 fa                	sbb    %edi,%edx
+  80272a:	89 cf                	mov    %ecx,%edi
+  80272c:	c1 ef 05             	shr    $0x5,%edi
+  80272f:	83 e7 01             	and    $0x1,%edi
+  802732:	89 fe                	mov    %edi,%esi
+  802734:	d3 e7                	shl    %cl,%edi
+  802736:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80273a:	83 f6 01             	xor    $0x1,%esi
+  80273d:	d3 e6                	shl    %cl,%esi
+  80273f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802743:	83 e9 01             	sub    $0x1,%ecx
+  802746:	73 98                	jae    8026e0 <__udivmoddi4+0x50>
+  802748:	85 db                	test   %ebx,%ebx
+  80274a:	74 05                	je     802751 <__udivmoddi4+0xc1>
+  80274c:	89 03                	mov    %eax,(%ebx)
+  80274e:	89 53 04             	mov    %edx,0x4(%ebx)
+  802751:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802755:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802759:	83 c4 24             	add    $0x24,%esp
+  80275c:	5b                   	pop    %ebx
+  80275d:	5e                   	pop    %esi
+  80275e:	5f                   	pop    %edi
+  80275f:	5d                   	pop    %ebp
+  802760:	c3                   	ret
+  802761:	85 ff                	test   %edi,%edi
+  802763:	74 0d                	je     802772 <__udivmoddi4+0xe2>
+  802765:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  80276b:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  802772:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802776:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80277a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80277e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802782:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802786:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80278a:	83 c4 24             	add    $0x24,%esp
+  80278d:	5b                   	pop    %ebx
+  80278e:	5e                   	pop    %esi
+  80278f:	5f                   	pop    %edi
+  802790:	5d                   	pop    %ebp
+  802791:	c3                   	ret
+  802792:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802799:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+008027a0 <__udivdi3>:
+  8027a0:	57                   	push   %edi
+  8027a1:	56                   	push   %esi
+  8027a2:	53                   	push   %ebx
+  8027a3:	83 ec 20             	sub    $0x20,%esp
+  8027a6:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8027aa:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8027ae:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8027b2:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8027b6:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8027ba:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8027be:	89 d1                	mov    %edx,%ecx
+  8027c0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8027c4:	09 c1                	or     %eax,%ecx
+  8027c6:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8027ca:	89 44 24 18          	mov    %eax,0x18(%esp)
+  8027ce:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  8027d2:	0f 84 88 00 00 00    	je     802860 <__udivdi3+0xc0>
+  8027d8:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8027df:	00 
+  8027e0:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8027e5:	31 c0                	xor    %eax,%eax
+  8027e7:	31 d2                	xor    %edx,%edx
+  8027e9:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8027f0:	00 
+  8027f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8027f8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8027fc:	01 c0                	add    %eax,%eax
+  8027fe:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802805:	00 
+  802806:	89 c6                	mov    %eax,%esi
+  802808:	89 d7                	mov    %edx,%edi
+  80280a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80280e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802812:	0f ad d0             	shrd   %cl,%edx,%eax
+  802815:	d3 ea                	shr    %cl,%edx
+  802817:	f6 c1 20             	test   $0x20,%cl
+  80281a:	0f 45 c2             	cmovne %edx,%eax
+  80281d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802821:	83 e0 01             	and    $0x1,%eax
+  802824:	09 fa                	or     %edi,%edx
+  802826:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80282a:	89 04 24             	mov    %eax,(%esp)
+  80282d:	8b 04 24             	mov    (%esp),%eax
+  802830:	89 d3                	mov    %edx,%ebx
+  802832:	09 f0                	or     %esi,%eax
+  802834:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802838:	39 f0                	cmp    %esi,%eax
+  80283a:	19 fb                	sbb    %edi,%ebx
+  80283c:	72 1d                	jb     80285b <__udivdi3+0xbb>
+  80283e:	29 f0                	sub    %esi,%eax
+  802840:	19 fa                	sbb    %edi,%edx
+  802842:	89 cf                	mov    %ecx,%edi
+  802844:	c1 ef 05             	shr    $0x5,%edi
+  802847:	83 e7 01             	and    $0x1,%edi
+  80284a:	89 fe                	mov    %edi,%esi
+  80284c:	d3 e7                	shl    %cl,%edi
+  80284e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802852:	83 f6 01             	xor    $0x1,%esi
+  802855:	d3 e6                	shl    %cl,%esi
+  802857:	09 74 24 18          	or     %esi,0x18(%esp)
+  80285b:	83 e9 01             	sub    $0x1,%ecx
+  80285e:	73 98                	jae    8027f8 <__udivdi3+0x58>
+  802860:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802864:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802868:	83 c4 20             	add    $0x20,%esp
+  80286b:	5b                   	pop    %ebx
+  80286c:	5e                   	pop    %esi
+  80286d:	5f                   	pop    %edi
+  80286e:	c3                   	ret
+  80286f:	90                   	nop
+
+00802870 <__umoddi3>:
+  802870:	57                   	push   %edi
+  802871:	56                   	push   %esi
+  802872:	53                   	push   %ebx
+  802873:	83 ec 18             	sub    $0x18,%esp
+  802876:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80287a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80287e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802882:	8b 54 24 34          	mov    0x34(%esp),%edx
+  802886:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80288a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80288e:	89 d1                	mov    %edx,%ecx
+  802890:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802894:	09 c1                	or     %eax,%ecx
+  802896:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80289a:	74 5b                	je     8028f7 <__umoddi3+0x87>
+  80289c:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8028a1:	31 c0                	xor    %eax,%eax
+  8028a3:	31 d2                	xor    %edx,%edx
+  8028a5:	8d 76 00             	lea    0x0(%esi),%esi
+  8028a8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8028ac:	01 c0                	add    %eax,%eax
+  8028ae:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8028b5:	00 
+  8028b6:	89 c6                	mov    %eax,%esi
+  8028b8:	89 d7                	mov    %edx,%edi
+  8028ba:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8028be:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8028c2:	0f ad d0             	shrd   %cl,%edx,%eax
+  8028c5:	d3 ea                	shr    %cl,%edx
+  8028c7:	f6 c1 20             	test   $0x20,%cl
+  8028ca:	0f 45 c2             	cmovne %edx,%eax
+  8028cd:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8028d1:	83 e0 01             	and    $0x1,%eax
+  8028d4:	09 fa                	or     %edi,%edx
+  8028d6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8028da:	89 04 24             	mov    %eax,(%esp)
+  8028dd:	8b 04 24             	mov    (%esp),%eax
+  8028e0:	89 d3                	mov    %edx,%ebx
+  8028e2:	09 f0                	or     %esi,%eax
+  8028e4:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8028e8:	39 f0                	cmp    %esi,%eax
+  8028ea:	19 fb                	sbb    %edi,%ebx
+  8028ec:	72 04                	jb     8028f2 <__umoddi3+0x82>
+  8028ee:	29 f0                	sub    %esi,%eax
+  8028f0:	19 fa                	sbb    %edi,%edx
+  8028f2:	83 e9 01             	sub    $0x1,%ecx
+  8028f5:	73 b1                	jae    8028a8 <__umoddi3+0x38>
+  8028f7:	83 c4 18             	add    $0x18,%esp
+  8028fa:	5b                   	pop    %ebx
+  8028fb:	5e                   	pop    %esi
+  8028fc:	5f                   	pop    %edi
+  8028fd:	c3                   	ret
+  8028fe:	66 90                	xchg   %ax,%ax
+
+00802900 <__divdi3>:
+  802900:	55                   	push   %ebp
+  802901:	57                   	push   %edi
+  802902:	56                   	push   %esi
+  802903:	53                   	push   %ebx
+  802904:	83 ec 24             	sub    $0x24,%esp
+  802907:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  80290b:	8b 74 24 44          	mov    0x44(%esp),%esi
+  80290f:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802913:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802917:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  80291b:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  80291f:	85 d2                	test   %edx,%edx
+  802921:	0f 88 e0 00 00 00    	js     802a07 <__divdi3+0x107>
+  802927:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  80292b:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  80292f:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802933:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802937:	85 f6                	test   %esi,%esi
+  802939:	78 16                	js     802951 <__divdi3+0x51>
+  80293b:	89 f1                	mov    %esi,%ecx
+  80293d:	31 c0                	xor    %eax,%eax
+  80293f:	31 d2                	xor    %edx,%edx
+  802941:	09 d9                	or     %ebx,%ecx
+  802943:	0f 85 f3 00 00 00    	jne    802a3c <__divdi3+0x13c>
+  802949:	83 c4 24             	add    $0x24,%esp
+  80294c:	5b                   	pop    %ebx
+  80294d:	5e                   	pop    %esi
+  80294e:	5f                   	pop    %edi
+  80294f:	5d                   	pop    %ebp
+  802950:	c3                   	ret
+  802951:	bf 01 00 00 00       	mov    $0x1,%edi
+  802956:	f7 5c 24 08          	negl   0x8(%esp)
+  80295a:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  80295f:	f7 5c 24 0c          	negl   0xc(%esp)
+  802963:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80296a:	00 
+  80296b:	31 c0                	xor    %eax,%eax
+  80296d:	31 d2                	xor    %edx,%edx
+  80296f:	89 fb                	mov    %edi,%ebx
+  802971:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802978:	00 
+  802979:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80297e:	66 90                	xchg   %ax,%ax
+  802980:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802984:	01 c0                	add    %eax,%eax
+  802986:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80298d:	00 
+  80298e:	89 c6                	mov    %eax,%esi
+  802990:	89 d7                	mov    %edx,%edi
+  802992:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802996:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80299a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80299d:	d3 ea                	shr    %cl,%edx
+  80299f:	f6 c1 20             	test   $0x20,%cl
+  8029a2:	0f 45 c2             	cmovne %edx,%eax
+  8029a5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8029a9:	83 e0 01             	and    $0x1,%eax
+  8029ac:	09 fa                	or     %edi,%edx
+  8029ae:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8029b2:	89 04 24             	mov    %eax,(%esp)
+  8029b5:	8b 04 24             	mov    (%esp),%eax
+  8029b8:	89 d5                	mov    %edx,%ebp
+  8029ba:	09 f0                	or     %esi,%eax
+  8029bc:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8029c0:	39 f0                	cmp    %esi,%eax
+  8029c2:	19 fd                	sbb    %edi,%ebp
+  8029c4:	72 1d                	jb     8029e3 <__divdi3+0xe3>
+  8029c6:	29 f0                	sub    %esi,%eax
+  8029c8:	19 fa                	sbb    %edi,%edx
+  8029ca:	89 cf                	mov    %ecx,%edi
+  8029cc:	c1 ef 05             	shr    $0x5,%edi
+  8029cf:	83 e7 01             	and    $0x1,%edi
+  8029d2:	89 fe                	mov    %edi,%esi
+  8029d4:	d3 e7                	shl    %cl,%edi
+  8029d6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8029da:	83 f6 01             	xor    $0x1,%esi
+  8029dd:	d3 e6                	shl    %cl,%esi
+  8029df:	09 74 24 18          	or     %esi,0x18(%esp)
+  8029e3:	83 e9 01             	sub    $0x1,%ecx
+  8029e6:	73 98                	jae    802980 <__divdi3+0x80>
+  8029e8:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8029ec:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8029f0:	85 db                	test   %ebx,%ebx
+  8029f2:	0f 84 51 ff ff ff    	je     802949 <__divdi3+0x49>
+  8029f8:	f7 d8                	neg    %eax
+  8029fa:	83 d2 00             	adc    $0x0,%edx
+  8029fd:	83 c4 24             	add    $0x24,%esp
+  802a00:	5b                   	pop    %ebx
+  802a01:	f7 da                	neg    %edx
+  802a03:	5e                   	pop    %esi
+  802a04:	5f                   	pop    %edi
+  802a05:	5d                   	pop    %ebp
+  802a06:	c3                   	ret
+  802a07:	f7 d8                	neg    %eax
+  802a09:	83 d2 00             	adc    $0x0,%edx
+  802a0c:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802a10:	f7 da                	neg    %edx
+  802a12:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802a16:	85 f6                	test   %esi,%esi
+  802a18:	78 1b                	js     802a35 <__divdi3+0x135>
+  802a1a:	89 f1                	mov    %esi,%ecx
+  802a1c:	31 c0                	xor    %eax,%eax
+  802a1e:	31 d2                	xor    %edx,%edx
+  802a20:	bf 01 00 00 00       	mov    $0x1,%edi
+  802a25:	09 d9                	or     %ebx,%ecx
+  802a27:	0f 85 36 ff ff ff    	jne    802963 <__divdi3+0x63>
+  802a2d:	83 c4 24             	add    $0x24,%esp
+  802a30:	5b                   	pop    %ebx
+  802a31:	5e                   	pop    %esi
+  802a32:	5f                   	pop    %edi
+  802a33:	5d                   	pop    %ebp
+  802a34:	c3                   	ret
+  802a35:	31 ff                	xor    %edi,%edi
+  802a37:	e9 1a ff ff ff       	jmp    802956 <__divdi3+0x56>
+  802a3c:	31 ff                	xor    %edi,%edi
+  802a3e:	e9 20 ff ff ff       	jmp    802963 <__divdi3+0x63>
+  802a43:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802a4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00802a50 <__moddi3>:
+  802a50:	55                   	push   %ebp
+  802a51:	57                   	push   %edi
+  802a52:	56                   	push   %esi
+  802a53:	53                   	push   %ebx
+  802a54:	83 ec 1c             	sub    $0x1c,%esp
+  802a57:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  802a5b:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  802a5f:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  802a63:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  802a67:	89 c8                	mov    %ecx,%eax
+  802a69:	89 f2                	mov    %esi,%edx
+  802a6b:	89 f3                	mov    %esi,%ebx
+  802a6d:	85 ed                	test   %ebp,%ebp
+  802a6f:	0f 88 9d 00 00 00    	js     802b12 <__moddi3+0xc2>
+  802a75:	09 cb                	or     %ecx,%ebx
+  802a77:	0f 84 8d 00 00 00    	je     802b0a <__moddi3+0xba>
+  802a7d:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802a81:	31 db                	xor    %ebx,%ebx
+  802a83:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802a87:	89 ca                	mov    %ecx,%edx
+  802a89:	89 f0                	mov    %esi,%eax
+  802a8b:	89 dd                	mov    %ebx,%ebp
+  802a8d:	f7 da                	neg    %edx
+  802a8f:	83 d0 00             	adc    $0x0,%eax
+  802a92:	f7 d8                	neg    %eax
+  802a94:	0f 49 f0             	cmovns %eax,%esi
+  802a97:	0f 49 ca             	cmovns %edx,%ecx
+  802a9a:	31 c0                	xor    %eax,%eax
+  802a9c:	31 d2                	xor    %edx,%edx
+  802a9e:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802aa2:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802aa6:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802aab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  802aaf:	90                   	nop
+  802ab0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802ab4:	01 c0                	add    %eax,%eax
+  802ab6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802abd:	00 
+  802abe:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  802ac2:	89 c6                	mov    %eax,%esi
+  802ac4:	89 d7                	mov    %edx,%edi
+  802ac6:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802aca:	8b 54 24 14          	mov    0x14(%esp),%edx
+  802ace:	0f ad d0             	shrd   %cl,%edx,%eax
+  802ad1:	d3 ea                	shr    %cl,%edx
+  802ad3:	f6 c1 20             	test   $0x20,%cl
+  802ad6:	0f 45 c2             	cmovne %edx,%eax
+  802ad9:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802add:	83 e0 01             	and    $0x1,%eax
+  802ae0:	09 fa                	or     %edi,%edx
+  802ae2:	89 04 24             	mov    %eax,(%esp)
+  802ae5:	8b 04 24             	mov    (%esp),%eax
+  802ae8:	89 d7                	mov    %edx,%edi
+  802aea:	09 f0                	or     %esi,%eax
+  802aec:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  802af0:	39 d8                	cmp    %ebx,%eax
+  802af2:	19 f7                	sbb    %esi,%edi
+  802af4:	72 04                	jb     802afa <__moddi3+0xaa>
+  802af6:	29 d8                	sub    %ebx,%eax
+  802af8:	19 f2                	sbb    %esi,%edx
+  802afa:	83 e9 01             	sub    $0x1,%ecx
+  802afd:	73 b1                	jae    802ab0 <__moddi3+0x60>
+  802aff:	85 ed                	test   %ebp,%ebp
+  802b01:	74 07                	je     802b0a <__moddi3+0xba>
+  802b03:	f7 d8                	neg    %eax
+  802b05:	83 d2 00             	adc    $0x0,%edx
+  802b08:	f7 da                	neg    %edx
+  802b0a:	83 c4 1c             	add    $0x1c,%esp
+  802b0d:	5b                   	pop    %ebx
+  802b0e:	5e                   	pop    %esi
+  802b0f:	5f                   	pop    %edi
+  802b10:	5d                   	pop    %ebp
+  802b11:	c3                   	ret
+  802b12:	09 cb                	or     %ecx,%ebx
+  802b14:	74 f4                	je     802b0a <__moddi3+0xba>
+  802b16:	f7 df                	neg    %edi
+  802b18:	bb 01 00 00 00       	mov    $0x1,%ebx
+  802b1d:	83 d5 00             	adc    $0x0,%ebp
+  802b20:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802b24:	f7 dd                	neg    %ebp
+  802b26:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802b2a:	e9 58 ff ff ff       	jmp    802a87 <__moddi3+0x37>
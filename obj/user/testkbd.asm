@@ -0,0 +1,5642 @@
+
+obj/user/testkbd.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 2a 02 00 00       	call   80025b <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 04             	sub    $0x4,%esp
+	int i, r;
+
+	// Spin for a bit to let the console quiet
+	for (i = 0; i < 10; ++i)
+  80003a:	bb 0b 00 00 00       	mov    $0xb,%ebx
+  80003f:	eb 05                	jmp    800046 <umain+0x13>
+		sys_yield();
+  800041:	e8 c9 0d 00 00       	call   800e0f <sys_yield>
+	for (i = 0; i < 10; ++i)
+  800046:	83 eb 01             	sub    $0x1,%ebx
+  800049:	75 f6                	jne    800041 <umain+0xe>
+
+	close(0);
+  80004b:	83 ec 0c             	sub    $0xc,%esp
+  80004e:	6a 00                	push   $0x0
+  800050:	e8 53 12 00 00       	call   8012a8 <close>
+	if ((r = opencons()) < 0)
+  800055:	e8 af 01 00 00       	call   800209 <opencons>
+  80005a:	83 c4 10             	add    $0x10,%esp
+  80005d:	85 c0                	test   %eax,%eax
+  80005f:	78 14                	js     800075 <umain+0x42>
+		panic("opencons: %e", r);
+	if (r != 0)
+  800061:	74 24                	je     800087 <umain+0x54>
+		panic("first opencons used fd %d", r);
+  800063:	50                   	push   %eax
+  800064:	68 bc 27 80 00       	push   $0x8027bc
+  800069:	6a 11                	push   $0x11
+  80006b:	68 ad 27 80 00       	push   $0x8027ad
+  800070:	e8 49 02 00 00       	call   8002be <_panic>
+		panic("opencons: %e", r);
+  800075:	50                   	push   %eax
+  800076:	68 a0 27 80 00       	push   $0x8027a0
+  80007b:	6a 0f                	push   $0xf
+  80007d:	68 ad 27 80 00       	push   $0x8027ad
+  800082:	e8 37 02 00 00       	call   8002be <_panic>
+	if ((r = dup(0, 1)) < 0)
+  800087:	83 ec 08             	sub    $0x8,%esp
+  80008a:	6a 01                	push   $0x1
+  80008c:	6a 00                	push   $0x0
+  80008e:	e8 67 12 00 00       	call   8012fa <dup>
+  800093:	83 c4 10             	add    $0x10,%esp
+  800096:	85 c0                	test   %eax,%eax
+  800098:	79 25                	jns    8000bf <umain+0x8c>
+		panic("dup: %e", r);
+  80009a:	50                   	push   %eax
+  80009b:	68 d6 27 80 00       	push   $0x8027d6
+  8000a0:	6a 13                	push   $0x13
+  8000a2:	68 ad 27 80 00       	push   $0x8027ad
+  8000a7:	e8 12 02 00 00       	call   8002be <_panic>
+	for(;;){
+		char *buf;
+
+		buf = readline("Type a line: ");
+		if (buf != NULL)
+			fprintf(1, "%s\n", buf);
+  8000ac:	83 ec 04             	sub    $0x4,%esp
+  8000af:	50                   	push   %eax
+  8000b0:	68 ec 27 80 00       	push   $0x8027ec
+  8000b5:	6a 01                	push   $0x1
+  8000b7:	e8 17 19 00 00       	call   8019d3 <fprintf>
+  8000bc:	83 c4 10             	add    $0x10,%esp
+		buf = readline("Type a line: ");
+  8000bf:	83 ec 0c             	sub    $0xc,%esp
+  8000c2:	68 de 27 80 00       	push   $0x8027de
+  8000c7:	e8 4b 08 00 00       	call   800917 <readline>
+		if (buf != NULL)
+  8000cc:	83 c4 10             	add    $0x10,%esp
+  8000cf:	85 c0                	test   %eax,%eax
+  8000d1:	75 d9                	jne    8000ac <umain+0x79>
+		else
+			fprintf(1, "(end of file received)\n");
+  8000d3:	83 ec 08             	sub    $0x8,%esp
+  8000d6:	68 f0 27 80 00       	push   $0x8027f0
+  8000db:	6a 01                	push   $0x1
+  8000dd:	e8 f1 18 00 00       	call   8019d3 <fprintf>
+  8000e2:	83 c4 10             	add    $0x10,%esp
+  8000e5:	eb d8                	jmp    8000bf <umain+0x8c>
+
+008000e7 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8000e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ec:	c3                   	ret
+
+008000ed <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8000ed:	55                   	push   %ebp
+  8000ee:	89 e5                	mov    %esp,%ebp
+  8000f0:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8000f3:	68 08 28 80 00       	push   $0x802808
+  8000f8:	ff 75 0c             	push   0xc(%ebp)
+  8000fb:	e8 42 09 00 00       	call   800a42 <strcpy>
+	return 0;
+}
+  800100:	b8 00 00 00 00       	mov    $0x0,%eax
+  800105:	c9                   	leave
+  800106:	c3                   	ret
+
+00800107 <devcons_write>:
+{
+  800107:	55                   	push   %ebp
+  800108:	89 e5                	mov    %esp,%ebp
+  80010a:	57                   	push   %edi
+  80010b:	56                   	push   %esi
+  80010c:	53                   	push   %ebx
+  80010d:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  800113:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  800118:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80011e:	eb 2e                	jmp    80014e <devcons_write+0x47>
+		m = n - tot;
+  800120:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800123:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  800125:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80012a:	39 c3                	cmp    %eax,%ebx
+  80012c:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80012f:	83 ec 04             	sub    $0x4,%esp
+  800132:	53                   	push   %ebx
+  800133:	89 f0                	mov    %esi,%eax
+  800135:	03 45 0c             	add    0xc(%ebp),%eax
+  800138:	50                   	push   %eax
+  800139:	57                   	push   %edi
+  80013a:	e8 89 0a 00 00       	call   800bc8 <memmove>
+		sys_cputs(buf, m);
+  80013f:	83 c4 08             	add    $0x8,%esp
+  800142:	53                   	push   %ebx
+  800143:	57                   	push   %edi
+  800144:	e8 29 0c 00 00       	call   800d72 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  800149:	01 de                	add    %ebx,%esi
+  80014b:	83 c4 10             	add    $0x10,%esp
+  80014e:	3b 75 10             	cmp    0x10(%ebp),%esi
+  800151:	72 cd                	jb     800120 <devcons_write+0x19>
+}
+  800153:	89 f0                	mov    %esi,%eax
+  800155:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800158:	5b                   	pop    %ebx
+  800159:	5e                   	pop    %esi
+  80015a:	5f                   	pop    %edi
+  80015b:	5d                   	pop    %ebp
+  80015c:	c3                   	ret
+
+0080015d <devcons_read>:
+{
+  80015d:	55                   	push   %ebp
+  80015e:	89 e5                	mov    %esp,%ebp
+  800160:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  800163:	b8 00 00 00 00       	mov    $0x0,%eax
+  800168:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80016c:	75 07                	jne    800175 <devcons_read+0x18>
+  80016e:	eb 1f                	jmp    80018f <devcons_read+0x32>
+		sys_yield();
+  800170:	e8 9a 0c 00 00       	call   800e0f <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  800175:	e8 16 0c 00 00       	call   800d90 <sys_cgetc>
+  80017a:	85 c0                	test   %eax,%eax
+  80017c:	74 f2                	je     800170 <devcons_read+0x13>
+	if (c < 0)
+  80017e:	78 0f                	js     80018f <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  800180:	83 f8 04             	cmp    $0x4,%eax
+  800183:	74 0c                	je     800191 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  800185:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800188:	88 02                	mov    %al,(%edx)
+	return 1;
+  80018a:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80018f:	c9                   	leave
+  800190:	c3                   	ret
+		return 0;
+  800191:	b8 00 00 00 00       	mov    $0x0,%eax
+  800196:	eb f7                	jmp    80018f <devcons_read+0x32>
+
+00800198 <cputchar>:
+{
+  800198:	55                   	push   %ebp
+  800199:	89 e5                	mov    %esp,%ebp
+  80019b:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80019e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001a1:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8001a4:	6a 01                	push   $0x1
+  8001a6:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8001a9:	50                   	push   %eax
+  8001aa:	e8 c3 0b 00 00       	call   800d72 <sys_cputs>
+}
+  8001af:	83 c4 10             	add    $0x10,%esp
+  8001b2:	c9                   	leave
+  8001b3:	c3                   	ret
+
+008001b4 <getchar>:
+{
+  8001b4:	55                   	push   %ebp
+  8001b5:	89 e5                	mov    %esp,%ebp
+  8001b7:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8001ba:	6a 01                	push   $0x1
+  8001bc:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8001bf:	50                   	push   %eax
+  8001c0:	6a 00                	push   $0x0
+  8001c2:	e8 1d 12 00 00       	call   8013e4 <read>
+	if (r < 0)
+  8001c7:	83 c4 10             	add    $0x10,%esp
+  8001ca:	85 c0                	test   %eax,%eax
+  8001cc:	78 06                	js     8001d4 <getchar+0x20>
+	if (r < 1)
+  8001ce:	74 06                	je     8001d6 <getchar+0x22>
+	return c;
+  8001d0:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8001d4:	c9                   	leave
+  8001d5:	c3                   	ret
+		return -E_EOF;
+  8001d6:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8001db:	eb f7                	jmp    8001d4 <getchar+0x20>
+
+008001dd <iscons>:
+{
+  8001dd:	55                   	push   %ebp
+  8001de:	89 e5                	mov    %esp,%ebp
+  8001e0:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8001e3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8001e6:	50                   	push   %eax
+  8001e7:	ff 75 08             	push   0x8(%ebp)
+  8001ea:	e8 8f 0f 00 00       	call   80117e <fd_lookup>
+  8001ef:	83 c4 10             	add    $0x10,%esp
+  8001f2:	85 c0                	test   %eax,%eax
+  8001f4:	78 11                	js     800207 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8001f6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8001f9:	8b 15 00 30 80 00    	mov    0x803000,%edx
+  8001ff:	39 10                	cmp    %edx,(%eax)
+  800201:	0f 94 c0             	sete   %al
+  800204:	0f b6 c0             	movzbl %al,%eax
+}
+  800207:	c9                   	leave
+  800208:	c3                   	ret
+
+00800209 <opencons>:
+{
+  800209:	55                   	push   %ebp
+  80020a:	89 e5                	mov    %esp,%ebp
+  80020c:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80020f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800212:	50                   	push   %eax
+  800213:	e8 10 0f 00 00       	call   801128 <fd_alloc>
+  800218:	83 c4 10             	add    $0x10,%esp
+  80021b:	85 c0                	test   %eax,%eax
+  80021d:	78 3a                	js     800259 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80021f:	83 ec 04             	sub    $0x4,%esp
+  800222:	68 07 04 00 00       	push   $0x407
+  800227:	ff 75 f4             	push   -0xc(%ebp)
+  80022a:	6a 00                	push   $0x0
+  80022c:	e8 fd 0b 00 00       	call   800e2e <sys_page_alloc>
+  800231:	83 c4 10             	add    $0x10,%esp
+  800234:	85 c0                	test   %eax,%eax
+  800236:	78 21                	js     800259 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  800238:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80023b:	8b 15 00 30 80 00    	mov    0x803000,%edx
+  800241:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  800243:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800246:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80024d:	83 ec 0c             	sub    $0xc,%esp
+  800250:	50                   	push   %eax
+  800251:	e8 ab 0e 00 00       	call   801101 <fd2num>
+  800256:	83 c4 10             	add    $0x10,%esp
+}
+  800259:	c9                   	leave
+  80025a:	c3                   	ret
+
+0080025b <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  80025b:	55                   	push   %ebp
+  80025c:	89 e5                	mov    %esp,%ebp
+  80025e:	56                   	push   %esi
+  80025f:	53                   	push   %ebx
+  800260:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800263:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  800266:	e8 85 0b 00 00       	call   800df0 <sys_getenvid>
+  80026b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800270:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800273:	c1 e0 04             	shl    $0x4,%eax
+  800276:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80027b:	a3 08 44 80 00       	mov    %eax,0x804408
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800280:	85 db                	test   %ebx,%ebx
+  800282:	7e 07                	jle    80028b <libmain+0x30>
+    binaryname = argv[0];
+  800284:	8b 06                	mov    (%esi),%eax
+  800286:	a3 1c 30 80 00       	mov    %eax,0x80301c
+
+  // call user main routine
+  umain(argc, argv);
+  80028b:	83 ec 08             	sub    $0x8,%esp
+  80028e:	56                   	push   %esi
+  80028f:	53                   	push   %ebx
+  800290:	e8 9e fd ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  800295:	e8 0a 00 00 00       	call   8002a4 <exit>
+}
+  80029a:	83 c4 10             	add    $0x10,%esp
+  80029d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8002a0:	5b                   	pop    %ebx
+  8002a1:	5e                   	pop    %esi
+  8002a2:	5d                   	pop    %ebp
+  8002a3:	c3                   	ret
+
+008002a4 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8002a4:	55                   	push   %ebp
+  8002a5:	89 e5                	mov    %esp,%ebp
+  8002a7:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8002aa:	e8 26 10 00 00       	call   8012d5 <close_all>
+	sys_env_destroy(0);
+  8002af:	83 ec 0c             	sub    $0xc,%esp
+  8002b2:	6a 00                	push   $0x0
+  8002b4:	e8 f6 0a 00 00       	call   800daf <sys_env_destroy>
+}
+  8002b9:	83 c4 10             	add    $0x10,%esp
+  8002bc:	c9                   	leave
+  8002bd:	c3                   	ret
+
+008002be <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8002be:	55                   	push   %ebp
+  8002bf:	89 e5                	mov    %esp,%ebp
+  8002c1:	56                   	push   %esi
+  8002c2:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8002c3:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8002c6:	8b 35 1c 30 80 00    	mov    0x80301c,%esi
+  8002cc:	e8 1f 0b 00 00       	call   800df0 <sys_getenvid>
+  8002d1:	83 ec 0c             	sub    $0xc,%esp
+  8002d4:	ff 75 0c             	push   0xc(%ebp)
+  8002d7:	ff 75 08             	push   0x8(%ebp)
+  8002da:	56                   	push   %esi
+  8002db:	50                   	push   %eax
+  8002dc:	68 20 28 80 00       	push   $0x802820
+  8002e1:	e8 b3 00 00 00       	call   800399 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8002e6:	83 c4 18             	add    $0x18,%esp
+  8002e9:	53                   	push   %ebx
+  8002ea:	ff 75 10             	push   0x10(%ebp)
+  8002ed:	e8 56 00 00 00       	call   800348 <vcprintf>
+	cprintf("\n");
+  8002f2:	c7 04 24 06 28 80 00 	movl   $0x802806,(%esp)
+  8002f9:	e8 9b 00 00 00       	call   800399 <cprintf>
+  8002fe:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800301:	cc                   	int3
+	while (1)
+  800302:	eb fd                	jmp    800301 <_panic+0x43>
+
+00800304 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800304:	55                   	push   %ebp
+  800305:	89 e5                	mov    %esp,%ebp
+  800307:	53                   	push   %ebx
+  800308:	83 ec 04             	sub    $0x4,%esp
+  80030b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80030e:	8b 13                	mov    (%ebx),%edx
+  800310:	8d 42 01             	lea    0x1(%edx),%eax
+  800313:	89 03                	mov    %eax,(%ebx)
+  800315:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800318:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80031c:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800321:	74 09                	je     80032c <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800323:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800327:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80032a:	c9                   	leave
+  80032b:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80032c:	83 ec 08             	sub    $0x8,%esp
+  80032f:	68 ff 00 00 00       	push   $0xff
+  800334:	8d 43 08             	lea    0x8(%ebx),%eax
+  800337:	50                   	push   %eax
+  800338:	e8 35 0a 00 00       	call   800d72 <sys_cputs>
+		b->idx = 0;
+  80033d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800343:	83 c4 10             	add    $0x10,%esp
+  800346:	eb db                	jmp    800323 <putch+0x1f>
+
+00800348 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800348:	55                   	push   %ebp
+  800349:	89 e5                	mov    %esp,%ebp
+  80034b:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800351:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800358:	00 00 00 
+	b.cnt = 0;
+  80035b:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800362:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800365:	ff 75 0c             	push   0xc(%ebp)
+  800368:	ff 75 08             	push   0x8(%ebp)
+  80036b:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800371:	50                   	push   %eax
+  800372:	68 04 03 80 00       	push   $0x800304
+  800377:	e8 14 01 00 00       	call   800490 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80037c:	83 c4 08             	add    $0x8,%esp
+  80037f:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800385:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80038b:	50                   	push   %eax
+  80038c:	e8 e1 09 00 00       	call   800d72 <sys_cputs>
+
+	return b.cnt;
+}
+  800391:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800397:	c9                   	leave
+  800398:	c3                   	ret
+
+00800399 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800399:	55                   	push   %ebp
+  80039a:	89 e5                	mov    %esp,%ebp
+  80039c:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80039f:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8003a2:	50                   	push   %eax
+  8003a3:	ff 75 08             	push   0x8(%ebp)
+  8003a6:	e8 9d ff ff ff       	call   800348 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8003ab:	c9                   	leave
+  8003ac:	c3                   	ret
+
+008003ad <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8003ad:	55                   	push   %ebp
+  8003ae:	89 e5                	mov    %esp,%ebp
+  8003b0:	57                   	push   %edi
+  8003b1:	56                   	push   %esi
+  8003b2:	53                   	push   %ebx
+  8003b3:	83 ec 1c             	sub    $0x1c,%esp
+  8003b6:	89 c7                	mov    %eax,%edi
+  8003b8:	89 d6                	mov    %edx,%esi
+  8003ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003bd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8003c0:	89 d1                	mov    %edx,%ecx
+  8003c2:	89 c2                	mov    %eax,%edx
+  8003c4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8003c7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8003ca:	8b 45 10             	mov    0x10(%ebp),%eax
+  8003cd:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8003d0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003d3:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8003da:	39 c2                	cmp    %eax,%edx
+  8003dc:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8003df:	72 3e                	jb     80041f <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8003e1:	83 ec 0c             	sub    $0xc,%esp
+  8003e4:	ff 75 18             	push   0x18(%ebp)
+  8003e7:	83 eb 01             	sub    $0x1,%ebx
+  8003ea:	53                   	push   %ebx
+  8003eb:	50                   	push   %eax
+  8003ec:	83 ec 08             	sub    $0x8,%esp
+  8003ef:	ff 75 e4             	push   -0x1c(%ebp)
+  8003f2:	ff 75 e0             	push   -0x20(%ebp)
+  8003f5:	ff 75 dc             	push   -0x24(%ebp)
+  8003f8:	ff 75 d8             	push   -0x28(%ebp)
+  8003fb:	e8 10 20 00 00       	call   802410 <__udivdi3>
+  800400:	83 c4 18             	add    $0x18,%esp
+  800403:	52                   	push   %edx
+  800404:	50                   	push   %eax
+  800405:	89 f2                	mov    %esi,%edx
+  800407:	89 f8                	mov    %edi,%eax
+  800409:	e8 9f ff ff ff       	call   8003ad <printnum>
+  80040e:	83 c4 20             	add    $0x20,%esp
+  800411:	eb 13                	jmp    800426 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800413:	83 ec 08             	sub    $0x8,%esp
+  800416:	56                   	push   %esi
+  800417:	ff 75 18             	push   0x18(%ebp)
+  80041a:	ff d7                	call   *%edi
+  80041c:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80041f:	83 eb 01             	sub    $0x1,%ebx
+  800422:	85 db                	test   %ebx,%ebx
+  800424:	7f ed                	jg     800413 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800426:	83 ec 08             	sub    $0x8,%esp
+  800429:	56                   	push   %esi
+  80042a:	83 ec 04             	sub    $0x4,%esp
+  80042d:	ff 75 e4             	push   -0x1c(%ebp)
+  800430:	ff 75 e0             	push   -0x20(%ebp)
+  800433:	ff 75 dc             	push   -0x24(%ebp)
+  800436:	ff 75 d8             	push   -0x28(%ebp)
+  800439:	e8 a2 20 00 00       	call   8024e0 <__umoddi3>
+  80043e:	83 c4 14             	add    $0x14,%esp
+  800441:	0f be 80 43 28 80 00 	movsbl 0x802843(%eax),%eax
+  800448:	50                   	push   %eax
+  800449:	ff d7                	call   *%edi
+}
+  80044b:	83 c4 10             	add    $0x10,%esp
+  80044e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800451:	5b                   	pop    %ebx
+  800452:	5e                   	pop    %esi
+  800453:	5f                   	pop    %edi
+  800454:	5d                   	pop    %ebp
+  800455:	c3                   	ret
+
+00800456 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800456:	55                   	push   %ebp
+  800457:	89 e5                	mov    %esp,%ebp
+  800459:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80045c:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800460:	8b 10                	mov    (%eax),%edx
+  800462:	3b 50 04             	cmp    0x4(%eax),%edx
+  800465:	73 0a                	jae    800471 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800467:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80046a:	89 08                	mov    %ecx,(%eax)
+  80046c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80046f:	88 02                	mov    %al,(%edx)
+}
+  800471:	5d                   	pop    %ebp
+  800472:	c3                   	ret
+
+00800473 <printfmt>:
+{
+  800473:	55                   	push   %ebp
+  800474:	89 e5                	mov    %esp,%ebp
+  800476:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800479:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80047c:	50                   	push   %eax
+  80047d:	ff 75 10             	push   0x10(%ebp)
+  800480:	ff 75 0c             	push   0xc(%ebp)
+  800483:	ff 75 08             	push   0x8(%ebp)
+  800486:	e8 05 00 00 00       	call   800490 <vprintfmt>
+}
+  80048b:	83 c4 10             	add    $0x10,%esp
+  80048e:	c9                   	leave
+  80048f:	c3                   	ret
+
+00800490 <vprintfmt>:
+{
+  800490:	55                   	push   %ebp
+  800491:	89 e5                	mov    %esp,%ebp
+  800493:	57                   	push   %edi
+  800494:	56                   	push   %esi
+  800495:	53                   	push   %ebx
+  800496:	83 ec 2c             	sub    $0x2c,%esp
+  800499:	8b 75 08             	mov    0x8(%ebp),%esi
+  80049c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80049f:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8004a2:	eb 0a                	jmp    8004ae <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8004a4:	83 ec 08             	sub    $0x8,%esp
+  8004a7:	53                   	push   %ebx
+  8004a8:	50                   	push   %eax
+  8004a9:	ff d6                	call   *%esi
+  8004ab:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8004ae:	83 c7 01             	add    $0x1,%edi
+  8004b1:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8004b5:	83 f8 25             	cmp    $0x25,%eax
+  8004b8:	74 0c                	je     8004c6 <vprintfmt+0x36>
+			if (ch == '\0')
+  8004ba:	85 c0                	test   %eax,%eax
+  8004bc:	75 e6                	jne    8004a4 <vprintfmt+0x14>
+}
+  8004be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004c1:	5b                   	pop    %ebx
+  8004c2:	5e                   	pop    %esi
+  8004c3:	5f                   	pop    %edi
+  8004c4:	5d                   	pop    %ebp
+  8004c5:	c3                   	ret
+		padc = ' ';
+  8004c6:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8004ca:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8004d1:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8004d8:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8004df:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8004e4:	8d 47 01             	lea    0x1(%edi),%eax
+  8004e7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8004ea:	0f b6 17             	movzbl (%edi),%edx
+  8004ed:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8004f0:	3c 55                	cmp    $0x55,%al
+  8004f2:	0f 87 9a 03 00 00    	ja     800892 <vprintfmt+0x402>
+  8004f8:	0f b6 c0             	movzbl %al,%eax
+  8004fb:	ff 24 85 80 29 80 00 	jmp    *0x802980(,%eax,4)
+  800502:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800505:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800509:	eb d9                	jmp    8004e4 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80050b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80050e:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800512:	eb d0                	jmp    8004e4 <vprintfmt+0x54>
+  800514:	0f b6 d2             	movzbl %dl,%edx
+  800517:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80051a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80051f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800522:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800525:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800529:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80052c:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80052f:	83 f9 09             	cmp    $0x9,%ecx
+  800532:	77 55                	ja     800589 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800534:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800537:	eb e9                	jmp    800522 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800539:	8b 45 14             	mov    0x14(%ebp),%eax
+  80053c:	8b 00                	mov    (%eax),%eax
+  80053e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800541:	8b 45 14             	mov    0x14(%ebp),%eax
+  800544:	8d 40 04             	lea    0x4(%eax),%eax
+  800547:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80054a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80054d:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800551:	79 91                	jns    8004e4 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800553:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800556:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800559:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800560:	eb 82                	jmp    8004e4 <vprintfmt+0x54>
+			if (width < 0)
+  800562:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800565:	85 d2                	test   %edx,%edx
+  800567:	b8 00 00 00 00       	mov    $0x0,%eax
+  80056c:	0f 49 c2             	cmovns %edx,%eax
+  80056f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800572:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800575:	e9 6a ff ff ff       	jmp    8004e4 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80057a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80057d:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800584:	e9 5b ff ff ff       	jmp    8004e4 <vprintfmt+0x54>
+  800589:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80058c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80058f:	eb bc                	jmp    80054d <vprintfmt+0xbd>
+			lflag++;
+  800591:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800594:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800597:	e9 48 ff ff ff       	jmp    8004e4 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80059c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059f:	8d 78 04             	lea    0x4(%eax),%edi
+  8005a2:	83 ec 08             	sub    $0x8,%esp
+  8005a5:	53                   	push   %ebx
+  8005a6:	ff 30                	push   (%eax)
+  8005a8:	ff d6                	call   *%esi
+			break;
+  8005aa:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8005ad:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8005b0:	e9 7c 02 00 00       	jmp    800831 <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  8005b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b8:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8005bb:	8b 10                	mov    (%eax),%edx
+  8005bd:	89 d0                	mov    %edx,%eax
+  8005bf:	f7 d8                	neg    %eax
+  8005c1:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8005c4:	83 f8 10             	cmp    $0x10,%eax
+  8005c7:	7f 23                	jg     8005ec <vprintfmt+0x15c>
+  8005c9:	8b 14 85 e0 2a 80 00 	mov    0x802ae0(,%eax,4),%edx
+  8005d0:	85 d2                	test   %edx,%edx
+  8005d2:	74 18                	je     8005ec <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8005d4:	52                   	push   %edx
+  8005d5:	68 29 2c 80 00       	push   $0x802c29
+  8005da:	53                   	push   %ebx
+  8005db:	56                   	push   %esi
+  8005dc:	e8 92 fe ff ff       	call   800473 <printfmt>
+  8005e1:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005e4:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8005e7:	e9 45 02 00 00       	jmp    800831 <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  8005ec:	50                   	push   %eax
+  8005ed:	68 5b 28 80 00       	push   $0x80285b
+  8005f2:	53                   	push   %ebx
+  8005f3:	56                   	push   %esi
+  8005f4:	e8 7a fe ff ff       	call   800473 <printfmt>
+  8005f9:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005fc:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8005ff:	e9 2d 02 00 00       	jmp    800831 <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800604:	8b 45 14             	mov    0x14(%ebp),%eax
+  800607:	83 c0 04             	add    $0x4,%eax
+  80060a:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80060d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800610:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800612:	85 c9                	test   %ecx,%ecx
+  800614:	b8 54 28 80 00       	mov    $0x802854,%eax
+  800619:	0f 45 c1             	cmovne %ecx,%eax
+  80061c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80061f:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800623:	7e 06                	jle    80062b <vprintfmt+0x19b>
+  800625:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800629:	75 0b                	jne    800636 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80062b:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80062e:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800631:	89 75 08             	mov    %esi,0x8(%ebp)
+  800634:	eb 5c                	jmp    800692 <vprintfmt+0x202>
+  800636:	83 ec 08             	sub    $0x8,%esp
+  800639:	ff 75 d0             	push   -0x30(%ebp)
+  80063c:	ff 75 cc             	push   -0x34(%ebp)
+  80063f:	e8 db 03 00 00       	call   800a1f <strnlen>
+  800644:	89 c2                	mov    %eax,%edx
+  800646:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800649:	29 d0                	sub    %edx,%eax
+  80064b:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80064e:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800652:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800655:	89 75 08             	mov    %esi,0x8(%ebp)
+  800658:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80065a:	eb 0e                	jmp    80066a <vprintfmt+0x1da>
+					putch(padc, putdat);
+  80065c:	83 ec 08             	sub    $0x8,%esp
+  80065f:	53                   	push   %ebx
+  800660:	57                   	push   %edi
+  800661:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800664:	83 ee 01             	sub    $0x1,%esi
+  800667:	83 c4 10             	add    $0x10,%esp
+  80066a:	85 f6                	test   %esi,%esi
+  80066c:	7f ee                	jg     80065c <vprintfmt+0x1cc>
+  80066e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800671:	8b 75 08             	mov    0x8(%ebp),%esi
+  800674:	85 c0                	test   %eax,%eax
+  800676:	ba 00 00 00 00       	mov    $0x0,%edx
+  80067b:	0f 49 d0             	cmovns %eax,%edx
+  80067e:	29 d0                	sub    %edx,%eax
+  800680:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800683:	eb a6                	jmp    80062b <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800685:	83 ec 08             	sub    $0x8,%esp
+  800688:	53                   	push   %ebx
+  800689:	52                   	push   %edx
+  80068a:	ff 55 08             	call   *0x8(%ebp)
+  80068d:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800690:	89 f1                	mov    %esi,%ecx
+  800692:	8d 71 01             	lea    0x1(%ecx),%esi
+  800695:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800699:	0f be d0             	movsbl %al,%edx
+  80069c:	85 d2                	test   %edx,%edx
+  80069e:	74 28                	je     8006c8 <vprintfmt+0x238>
+  8006a0:	85 ff                	test   %edi,%edi
+  8006a2:	78 05                	js     8006a9 <vprintfmt+0x219>
+  8006a4:	83 ef 01             	sub    $0x1,%edi
+  8006a7:	78 30                	js     8006d9 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8006a9:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8006ad:	74 d6                	je     800685 <vprintfmt+0x1f5>
+  8006af:	0f be c0             	movsbl %al,%eax
+  8006b2:	83 e8 20             	sub    $0x20,%eax
+  8006b5:	83 f8 5e             	cmp    $0x5e,%eax
+  8006b8:	76 cb                	jbe    800685 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8006ba:	83 ec 08             	sub    $0x8,%esp
+  8006bd:	53                   	push   %ebx
+  8006be:	6a 3f                	push   $0x3f
+  8006c0:	ff 55 08             	call   *0x8(%ebp)
+  8006c3:	83 c4 10             	add    $0x10,%esp
+  8006c6:	eb c8                	jmp    800690 <vprintfmt+0x200>
+  8006c8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006cb:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8006ce:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8006d1:	01 d0                	add    %edx,%eax
+  8006d3:	29 c8                	sub    %ecx,%eax
+  8006d5:	89 c7                	mov    %eax,%edi
+  8006d7:	eb 13                	jmp    8006ec <vprintfmt+0x25c>
+  8006d9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006dc:	eb ed                	jmp    8006cb <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8006de:	83 ec 08             	sub    $0x8,%esp
+  8006e1:	53                   	push   %ebx
+  8006e2:	6a 20                	push   $0x20
+  8006e4:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8006e6:	83 ef 01             	sub    $0x1,%edi
+  8006e9:	83 c4 10             	add    $0x10,%esp
+  8006ec:	85 ff                	test   %edi,%edi
+  8006ee:	7f ee                	jg     8006de <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8006f0:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8006f3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006f6:	e9 36 01 00 00       	jmp    800831 <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  8006fb:	83 f9 01             	cmp    $0x1,%ecx
+  8006fe:	7f 1f                	jg     80071f <vprintfmt+0x28f>
+	else if (lflag)
+  800700:	85 c9                	test   %ecx,%ecx
+  800702:	74 67                	je     80076b <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800704:	8b 45 14             	mov    0x14(%ebp),%eax
+  800707:	8b 00                	mov    (%eax),%eax
+  800709:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80070c:	89 c1                	mov    %eax,%ecx
+  80070e:	c1 f9 1f             	sar    $0x1f,%ecx
+  800711:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800714:	8b 45 14             	mov    0x14(%ebp),%eax
+  800717:	8d 40 04             	lea    0x4(%eax),%eax
+  80071a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80071d:	eb 17                	jmp    800736 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  80071f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800722:	8b 50 04             	mov    0x4(%eax),%edx
+  800725:	8b 00                	mov    (%eax),%eax
+  800727:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80072a:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80072d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800730:	8d 40 08             	lea    0x8(%eax),%eax
+  800733:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800736:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800739:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80073c:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800741:	85 c9                	test   %ecx,%ecx
+  800743:	0f 89 ce 00 00 00    	jns    800817 <vprintfmt+0x387>
+				putch('-', putdat);
+  800749:	83 ec 08             	sub    $0x8,%esp
+  80074c:	53                   	push   %ebx
+  80074d:	6a 2d                	push   $0x2d
+  80074f:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800751:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800754:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800757:	f7 da                	neg    %edx
+  800759:	83 d1 00             	adc    $0x0,%ecx
+  80075c:	f7 d9                	neg    %ecx
+  80075e:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800761:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800766:	e9 ac 00 00 00       	jmp    800817 <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  80076b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80076e:	8b 00                	mov    (%eax),%eax
+  800770:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800773:	89 c1                	mov    %eax,%ecx
+  800775:	c1 f9 1f             	sar    $0x1f,%ecx
+  800778:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80077b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077e:	8d 40 04             	lea    0x4(%eax),%eax
+  800781:	89 45 14             	mov    %eax,0x14(%ebp)
+  800784:	eb b0                	jmp    800736 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800786:	83 f9 01             	cmp    $0x1,%ecx
+  800789:	7f 1b                	jg     8007a6 <vprintfmt+0x316>
+	else if (lflag)
+  80078b:	85 c9                	test   %ecx,%ecx
+  80078d:	74 2c                	je     8007bb <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  80078f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800792:	8b 10                	mov    (%eax),%edx
+  800794:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800799:	8d 40 04             	lea    0x4(%eax),%eax
+  80079c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80079f:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8007a4:	eb 71                	jmp    800817 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  8007a6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a9:	8b 10                	mov    (%eax),%edx
+  8007ab:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007ae:	8d 40 08             	lea    0x8(%eax),%eax
+  8007b1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007b4:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8007b9:	eb 5c                	jmp    800817 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  8007bb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007be:	8b 10                	mov    (%eax),%edx
+  8007c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007c5:	8d 40 04             	lea    0x4(%eax),%eax
+  8007c8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007cb:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8007d0:	eb 45                	jmp    800817 <vprintfmt+0x387>
+			putch('X', putdat);
+  8007d2:	83 ec 08             	sub    $0x8,%esp
+  8007d5:	53                   	push   %ebx
+  8007d6:	6a 58                	push   $0x58
+  8007d8:	ff d6                	call   *%esi
+			putch('X', putdat);
+  8007da:	83 c4 08             	add    $0x8,%esp
+  8007dd:	53                   	push   %ebx
+  8007de:	6a 58                	push   $0x58
+  8007e0:	ff d6                	call   *%esi
+			putch('X', putdat);
+  8007e2:	83 c4 08             	add    $0x8,%esp
+  8007e5:	53                   	push   %ebx
+  8007e6:	6a 58                	push   $0x58
+  8007e8:	ff d6                	call   *%esi
+			break;
+  8007ea:	83 c4 10             	add    $0x10,%esp
+  8007ed:	eb 42                	jmp    800831 <vprintfmt+0x3a1>
+			putch('0', putdat);
+  8007ef:	83 ec 08             	sub    $0x8,%esp
+  8007f2:	53                   	push   %ebx
+  8007f3:	6a 30                	push   $0x30
+  8007f5:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8007f7:	83 c4 08             	add    $0x8,%esp
+  8007fa:	53                   	push   %ebx
+  8007fb:	6a 78                	push   $0x78
+  8007fd:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8007ff:	8b 45 14             	mov    0x14(%ebp),%eax
+  800802:	8b 10                	mov    (%eax),%edx
+  800804:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800809:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80080c:	8d 40 04             	lea    0x4(%eax),%eax
+  80080f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800812:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800817:	83 ec 0c             	sub    $0xc,%esp
+  80081a:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80081e:	50                   	push   %eax
+  80081f:	ff 75 e0             	push   -0x20(%ebp)
+  800822:	57                   	push   %edi
+  800823:	51                   	push   %ecx
+  800824:	52                   	push   %edx
+  800825:	89 da                	mov    %ebx,%edx
+  800827:	89 f0                	mov    %esi,%eax
+  800829:	e8 7f fb ff ff       	call   8003ad <printnum>
+			break;
+  80082e:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800831:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800834:	e9 75 fc ff ff       	jmp    8004ae <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800839:	83 f9 01             	cmp    $0x1,%ecx
+  80083c:	7f 1b                	jg     800859 <vprintfmt+0x3c9>
+	else if (lflag)
+  80083e:	85 c9                	test   %ecx,%ecx
+  800840:	74 2c                	je     80086e <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  800842:	8b 45 14             	mov    0x14(%ebp),%eax
+  800845:	8b 10                	mov    (%eax),%edx
+  800847:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80084c:	8d 40 04             	lea    0x4(%eax),%eax
+  80084f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800852:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800857:	eb be                	jmp    800817 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  800859:	8b 45 14             	mov    0x14(%ebp),%eax
+  80085c:	8b 10                	mov    (%eax),%edx
+  80085e:	8b 48 04             	mov    0x4(%eax),%ecx
+  800861:	8d 40 08             	lea    0x8(%eax),%eax
+  800864:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800867:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80086c:	eb a9                	jmp    800817 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  80086e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800871:	8b 10                	mov    (%eax),%edx
+  800873:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800878:	8d 40 04             	lea    0x4(%eax),%eax
+  80087b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80087e:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800883:	eb 92                	jmp    800817 <vprintfmt+0x387>
+			putch(ch, putdat);
+  800885:	83 ec 08             	sub    $0x8,%esp
+  800888:	53                   	push   %ebx
+  800889:	6a 25                	push   $0x25
+  80088b:	ff d6                	call   *%esi
+			break;
+  80088d:	83 c4 10             	add    $0x10,%esp
+  800890:	eb 9f                	jmp    800831 <vprintfmt+0x3a1>
+			putch('%', putdat);
+  800892:	83 ec 08             	sub    $0x8,%esp
+  800895:	53                   	push   %ebx
+  800896:	6a 25                	push   $0x25
+  800898:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80089a:	83 c4 10             	add    $0x10,%esp
+  80089d:	89 f8                	mov    %edi,%eax
+  80089f:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8008a3:	74 05                	je     8008aa <vprintfmt+0x41a>
+  8008a5:	83 e8 01             	sub    $0x1,%eax
+  8008a8:	eb f5                	jmp    80089f <vprintfmt+0x40f>
+  8008aa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8008ad:	eb 82                	jmp    800831 <vprintfmt+0x3a1>
+
+008008af <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8008af:	55                   	push   %ebp
+  8008b0:	89 e5                	mov    %esp,%ebp
+  8008b2:	83 ec 18             	sub    $0x18,%esp
+  8008b5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008b8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8008bb:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8008be:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8008c2:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8008c5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8008cc:	85 c0                	test   %eax,%eax
+  8008ce:	74 26                	je     8008f6 <vsnprintf+0x47>
+  8008d0:	85 d2                	test   %edx,%edx
+  8008d2:	7e 22                	jle    8008f6 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8008d4:	ff 75 14             	push   0x14(%ebp)
+  8008d7:	ff 75 10             	push   0x10(%ebp)
+  8008da:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8008dd:	50                   	push   %eax
+  8008de:	68 56 04 80 00       	push   $0x800456
+  8008e3:	e8 a8 fb ff ff       	call   800490 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8008e8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8008eb:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8008ee:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008f1:	83 c4 10             	add    $0x10,%esp
+}
+  8008f4:	c9                   	leave
+  8008f5:	c3                   	ret
+		return -E_INVAL;
+  8008f6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008fb:	eb f7                	jmp    8008f4 <vsnprintf+0x45>
+
+008008fd <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8008fd:	55                   	push   %ebp
+  8008fe:	89 e5                	mov    %esp,%ebp
+  800900:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800903:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800906:	50                   	push   %eax
+  800907:	ff 75 10             	push   0x10(%ebp)
+  80090a:	ff 75 0c             	push   0xc(%ebp)
+  80090d:	ff 75 08             	push   0x8(%ebp)
+  800910:	e8 9a ff ff ff       	call   8008af <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800915:	c9                   	leave
+  800916:	c3                   	ret
+
+00800917 <readline>:
+#define BUFLEN 1024
+static char buf[BUFLEN];
+
+char *
+readline(const char *prompt)
+{
+  800917:	55                   	push   %ebp
+  800918:	89 e5                	mov    %esp,%ebp
+  80091a:	57                   	push   %edi
+  80091b:	56                   	push   %esi
+  80091c:	53                   	push   %ebx
+  80091d:	83 ec 0c             	sub    $0xc,%esp
+  800920:	8b 45 08             	mov    0x8(%ebp),%eax
+
+#if JOS_KERNEL
+	if (prompt != NULL)
+		cprintf("%s", prompt);
+#else
+	if (prompt != NULL)
+  800923:	85 c0                	test   %eax,%eax
+  800925:	74 13                	je     80093a <readline+0x23>
+		fprintf(1, "%s", prompt);
+  800927:	83 ec 04             	sub    $0x4,%esp
+  80092a:	50                   	push   %eax
+  80092b:	68 29 2c 80 00       	push   $0x802c29
+  800930:	6a 01                	push   $0x1
+  800932:	e8 9c 10 00 00       	call   8019d3 <fprintf>
+  800937:	83 c4 10             	add    $0x10,%esp
+#endif
+
+	i = 0;
+	echoing = iscons(0);
+  80093a:	83 ec 0c             	sub    $0xc,%esp
+  80093d:	6a 00                	push   $0x0
+  80093f:	e8 99 f8 ff ff       	call   8001dd <iscons>
+  800944:	89 c7                	mov    %eax,%edi
+  800946:	83 c4 10             	add    $0x10,%esp
+	i = 0;
+  800949:	be 00 00 00 00       	mov    $0x0,%esi
+  80094e:	eb 4b                	jmp    80099b <readline+0x84>
+	while (1) {
+		c = getchar();
+		if (c < 0) {
+			if (c != -E_EOF)
+				cprintf("read error: %e\n", c);
+			return NULL;
+  800950:	b8 00 00 00 00       	mov    $0x0,%eax
+			if (c != -E_EOF)
+  800955:	83 fb f8             	cmp    $0xfffffff8,%ebx
+  800958:	75 08                	jne    800962 <readline+0x4b>
+				cputchar('\n');
+			buf[i] = 0;
+			return buf;
+		}
+	}
+}
+  80095a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80095d:	5b                   	pop    %ebx
+  80095e:	5e                   	pop    %esi
+  80095f:	5f                   	pop    %edi
+  800960:	5d                   	pop    %ebp
+  800961:	c3                   	ret
+				cprintf("read error: %e\n", c);
+  800962:	83 ec 08             	sub    $0x8,%esp
+  800965:	53                   	push   %ebx
+  800966:	68 43 2b 80 00       	push   $0x802b43
+  80096b:	e8 29 fa ff ff       	call   800399 <cprintf>
+  800970:	83 c4 10             	add    $0x10,%esp
+			return NULL;
+  800973:	b8 00 00 00 00       	mov    $0x0,%eax
+  800978:	eb e0                	jmp    80095a <readline+0x43>
+			if (echoing)
+  80097a:	85 ff                	test   %edi,%edi
+  80097c:	75 05                	jne    800983 <readline+0x6c>
+			i--;
+  80097e:	83 ee 01             	sub    $0x1,%esi
+  800981:	eb 18                	jmp    80099b <readline+0x84>
+				cputchar('\b');
+  800983:	83 ec 0c             	sub    $0xc,%esp
+  800986:	6a 08                	push   $0x8
+  800988:	e8 0b f8 ff ff       	call   800198 <cputchar>
+  80098d:	83 c4 10             	add    $0x10,%esp
+  800990:	eb ec                	jmp    80097e <readline+0x67>
+			buf[i++] = c;
+  800992:	88 9e 00 40 80 00    	mov    %bl,0x804000(%esi)
+  800998:	8d 76 01             	lea    0x1(%esi),%esi
+		c = getchar();
+  80099b:	e8 14 f8 ff ff       	call   8001b4 <getchar>
+  8009a0:	89 c3                	mov    %eax,%ebx
+		if (c < 0) {
+  8009a2:	85 c0                	test   %eax,%eax
+  8009a4:	78 aa                	js     800950 <readline+0x39>
+		} else if ((c == '\b' || c == '\x7f') && i > 0) {
+  8009a6:	83 f8 08             	cmp    $0x8,%eax
+  8009a9:	0f 94 c0             	sete   %al
+  8009ac:	83 fb 7f             	cmp    $0x7f,%ebx
+  8009af:	0f 94 c2             	sete   %dl
+  8009b2:	08 d0                	or     %dl,%al
+  8009b4:	74 04                	je     8009ba <readline+0xa3>
+  8009b6:	85 f6                	test   %esi,%esi
+  8009b8:	7f c0                	jg     80097a <readline+0x63>
+		} else if (c >= ' ' && i < BUFLEN-1) {
+  8009ba:	83 fb 1f             	cmp    $0x1f,%ebx
+  8009bd:	7e 1a                	jle    8009d9 <readline+0xc2>
+  8009bf:	81 fe fe 03 00 00    	cmp    $0x3fe,%esi
+  8009c5:	7f 12                	jg     8009d9 <readline+0xc2>
+			if (echoing)
+  8009c7:	85 ff                	test   %edi,%edi
+  8009c9:	74 c7                	je     800992 <readline+0x7b>
+				cputchar(c);
+  8009cb:	83 ec 0c             	sub    $0xc,%esp
+  8009ce:	53                   	push   %ebx
+  8009cf:	e8 c4 f7 ff ff       	call   800198 <cputchar>
+  8009d4:	83 c4 10             	add    $0x10,%esp
+  8009d7:	eb b9                	jmp    800992 <readline+0x7b>
+		} else if (c == '\n' || c == '\r') {
+  8009d9:	83 fb 0a             	cmp    $0xa,%ebx
+  8009dc:	74 05                	je     8009e3 <readline+0xcc>
+  8009de:	83 fb 0d             	cmp    $0xd,%ebx
+  8009e1:	75 b8                	jne    80099b <readline+0x84>
+			if (echoing)
+  8009e3:	85 ff                	test   %edi,%edi
+  8009e5:	75 11                	jne    8009f8 <readline+0xe1>
+			buf[i] = 0;
+  8009e7:	c6 86 00 40 80 00 00 	movb   $0x0,0x804000(%esi)
+			return buf;
+  8009ee:	b8 00 40 80 00       	mov    $0x804000,%eax
+  8009f3:	e9 62 ff ff ff       	jmp    80095a <readline+0x43>
+				cputchar('\n');
+  8009f8:	83 ec 0c             	sub    $0xc,%esp
+  8009fb:	6a 0a                	push   $0xa
+  8009fd:	e8 96 f7 ff ff       	call   800198 <cputchar>
+  800a02:	83 c4 10             	add    $0x10,%esp
+  800a05:	eb e0                	jmp    8009e7 <readline+0xd0>
+
+00800a07 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800a07:	55                   	push   %ebp
+  800a08:	89 e5                	mov    %esp,%ebp
+  800a0a:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800a0d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a12:	eb 03                	jmp    800a17 <strlen+0x10>
+		n++;
+  800a14:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800a17:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800a1b:	75 f7                	jne    800a14 <strlen+0xd>
+	return n;
+}
+  800a1d:	5d                   	pop    %ebp
+  800a1e:	c3                   	ret
+
+00800a1f <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800a1f:	55                   	push   %ebp
+  800a20:	89 e5                	mov    %esp,%ebp
+  800a22:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a25:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a28:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a2d:	eb 03                	jmp    800a32 <strnlen+0x13>
+		n++;
+  800a2f:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a32:	39 d0                	cmp    %edx,%eax
+  800a34:	74 08                	je     800a3e <strnlen+0x1f>
+  800a36:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800a3a:	75 f3                	jne    800a2f <strnlen+0x10>
+  800a3c:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800a3e:	89 d0                	mov    %edx,%eax
+  800a40:	5d                   	pop    %ebp
+  800a41:	c3                   	ret
+
+00800a42 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800a42:	55                   	push   %ebp
+  800a43:	89 e5                	mov    %esp,%ebp
+  800a45:	53                   	push   %ebx
+  800a46:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a49:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800a4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a51:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800a55:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800a58:	83 c0 01             	add    $0x1,%eax
+  800a5b:	84 d2                	test   %dl,%dl
+  800a5d:	75 f2                	jne    800a51 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800a5f:	89 c8                	mov    %ecx,%eax
+  800a61:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a64:	c9                   	leave
+  800a65:	c3                   	ret
+
+00800a66 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800a66:	55                   	push   %ebp
+  800a67:	89 e5                	mov    %esp,%ebp
+  800a69:	53                   	push   %ebx
+  800a6a:	83 ec 10             	sub    $0x10,%esp
+  800a6d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800a70:	53                   	push   %ebx
+  800a71:	e8 91 ff ff ff       	call   800a07 <strlen>
+  800a76:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800a79:	ff 75 0c             	push   0xc(%ebp)
+  800a7c:	01 d8                	add    %ebx,%eax
+  800a7e:	50                   	push   %eax
+  800a7f:	e8 be ff ff ff       	call   800a42 <strcpy>
+	return dst;
+}
+  800a84:	89 d8                	mov    %ebx,%eax
+  800a86:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a89:	c9                   	leave
+  800a8a:	c3                   	ret
+
+00800a8b <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800a8b:	55                   	push   %ebp
+  800a8c:	89 e5                	mov    %esp,%ebp
+  800a8e:	56                   	push   %esi
+  800a8f:	53                   	push   %ebx
+  800a90:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a93:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800a96:	89 f3                	mov    %esi,%ebx
+  800a98:	03 5d 10             	add    0x10(%ebp),%ebx
+  800a9b:	89 f0                	mov    %esi,%eax
+  800a9d:	eb 0f                	jmp    800aae <strncpy+0x23>
+		*dst++ = *src;
+  800a9f:	83 c0 01             	add    $0x1,%eax
+  800aa2:	0f b6 0a             	movzbl (%edx),%ecx
+  800aa5:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800aa8:	80 f9 01             	cmp    $0x1,%cl
+  800aab:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800aae:	39 d8                	cmp    %ebx,%eax
+  800ab0:	75 ed                	jne    800a9f <strncpy+0x14>
+	}
+	return ret;
+}
+  800ab2:	89 f0                	mov    %esi,%eax
+  800ab4:	5b                   	pop    %ebx
+  800ab5:	5e                   	pop    %esi
+  800ab6:	5d                   	pop    %ebp
+  800ab7:	c3                   	ret
+
+00800ab8 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800ab8:	55                   	push   %ebp
+  800ab9:	89 e5                	mov    %esp,%ebp
+  800abb:	56                   	push   %esi
+  800abc:	53                   	push   %ebx
+  800abd:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ac0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ac3:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800ac6:	89 f0                	mov    %esi,%eax
+  800ac8:	85 d2                	test   %edx,%edx
+  800aca:	74 21                	je     800aed <strlcpy+0x35>
+  800acc:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800ad0:	89 f2                	mov    %esi,%edx
+  800ad2:	eb 09                	jmp    800add <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800ad4:	83 c1 01             	add    $0x1,%ecx
+  800ad7:	83 c2 01             	add    $0x1,%edx
+  800ada:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800add:	39 c2                	cmp    %eax,%edx
+  800adf:	74 09                	je     800aea <strlcpy+0x32>
+  800ae1:	0f b6 19             	movzbl (%ecx),%ebx
+  800ae4:	84 db                	test   %bl,%bl
+  800ae6:	75 ec                	jne    800ad4 <strlcpy+0x1c>
+  800ae8:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800aea:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800aed:	29 f0                	sub    %esi,%eax
+}
+  800aef:	5b                   	pop    %ebx
+  800af0:	5e                   	pop    %esi
+  800af1:	5d                   	pop    %ebp
+  800af2:	c3                   	ret
+
+00800af3 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800af3:	55                   	push   %ebp
+  800af4:	89 e5                	mov    %esp,%ebp
+  800af6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800af9:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800afc:	eb 06                	jmp    800b04 <strcmp+0x11>
+		p++, q++;
+  800afe:	83 c1 01             	add    $0x1,%ecx
+  800b01:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800b04:	0f b6 01             	movzbl (%ecx),%eax
+  800b07:	84 c0                	test   %al,%al
+  800b09:	74 04                	je     800b0f <strcmp+0x1c>
+  800b0b:	3a 02                	cmp    (%edx),%al
+  800b0d:	74 ef                	je     800afe <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b0f:	0f b6 c0             	movzbl %al,%eax
+  800b12:	0f b6 12             	movzbl (%edx),%edx
+  800b15:	29 d0                	sub    %edx,%eax
+}
+  800b17:	5d                   	pop    %ebp
+  800b18:	c3                   	ret
+
+00800b19 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800b19:	55                   	push   %ebp
+  800b1a:	89 e5                	mov    %esp,%ebp
+  800b1c:	53                   	push   %ebx
+  800b1d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b20:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b23:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800b26:	eb 09                	jmp    800b31 <strncmp+0x18>
+		n--, p++, q++;
+  800b28:	83 ea 01             	sub    $0x1,%edx
+  800b2b:	83 c0 01             	add    $0x1,%eax
+  800b2e:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800b31:	85 d2                	test   %edx,%edx
+  800b33:	74 18                	je     800b4d <strncmp+0x34>
+  800b35:	0f b6 18             	movzbl (%eax),%ebx
+  800b38:	84 db                	test   %bl,%bl
+  800b3a:	74 04                	je     800b40 <strncmp+0x27>
+  800b3c:	3a 19                	cmp    (%ecx),%bl
+  800b3e:	74 e8                	je     800b28 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b40:	0f b6 00             	movzbl (%eax),%eax
+  800b43:	0f b6 11             	movzbl (%ecx),%edx
+  800b46:	29 d0                	sub    %edx,%eax
+}
+  800b48:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b4b:	c9                   	leave
+  800b4c:	c3                   	ret
+		return 0;
+  800b4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b52:	eb f4                	jmp    800b48 <strncmp+0x2f>
+
+00800b54 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800b54:	55                   	push   %ebp
+  800b55:	89 e5                	mov    %esp,%ebp
+  800b57:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b5a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b5e:	eb 03                	jmp    800b63 <strchr+0xf>
+  800b60:	83 c0 01             	add    $0x1,%eax
+  800b63:	0f b6 10             	movzbl (%eax),%edx
+  800b66:	84 d2                	test   %dl,%dl
+  800b68:	74 06                	je     800b70 <strchr+0x1c>
+		if (*s == c)
+  800b6a:	38 ca                	cmp    %cl,%dl
+  800b6c:	75 f2                	jne    800b60 <strchr+0xc>
+  800b6e:	eb 05                	jmp    800b75 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800b70:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b75:	5d                   	pop    %ebp
+  800b76:	c3                   	ret
+
+00800b77 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800b77:	55                   	push   %ebp
+  800b78:	89 e5                	mov    %esp,%ebp
+  800b7a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b7d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b81:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800b84:	38 ca                	cmp    %cl,%dl
+  800b86:	74 09                	je     800b91 <strfind+0x1a>
+  800b88:	84 d2                	test   %dl,%dl
+  800b8a:	74 05                	je     800b91 <strfind+0x1a>
+	for (; *s; s++)
+  800b8c:	83 c0 01             	add    $0x1,%eax
+  800b8f:	eb f0                	jmp    800b81 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800b91:	5d                   	pop    %ebp
+  800b92:	c3                   	ret
+
+00800b93 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800b93:	55                   	push   %ebp
+  800b94:	89 e5                	mov    %esp,%ebp
+  800b96:	57                   	push   %edi
+  800b97:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b9a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800b9d:	85 c9                	test   %ecx,%ecx
+  800b9f:	74 20                	je     800bc1 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800ba1:	89 f8                	mov    %edi,%eax
+  800ba3:	09 c8                	or     %ecx,%eax
+  800ba5:	a8 03                	test   $0x3,%al
+  800ba7:	75 12                	jne    800bbb <memset+0x28>
+		c &= 0xFF;
+  800ba9:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800bad:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800bb3:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800bb6:	fc                   	cld
+  800bb7:	f3 ab                	rep stos %eax,%es:(%edi)
+  800bb9:	eb 06                	jmp    800bc1 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800bbb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bbe:	fc                   	cld
+  800bbf:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800bc1:	89 f8                	mov    %edi,%eax
+  800bc3:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800bc6:	c9                   	leave
+  800bc7:	c3                   	ret
+
+00800bc8 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800bc8:	55                   	push   %ebp
+  800bc9:	89 e5                	mov    %esp,%ebp
+  800bcb:	57                   	push   %edi
+  800bcc:	56                   	push   %esi
+  800bcd:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bd0:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800bd3:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800bd6:	39 c6                	cmp    %eax,%esi
+  800bd8:	73 32                	jae    800c0c <memmove+0x44>
+  800bda:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800bdd:	39 d0                	cmp    %edx,%eax
+  800bdf:	73 2b                	jae    800c0c <memmove+0x44>
+		s += n;
+		d += n;
+  800be1:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800be4:	89 d6                	mov    %edx,%esi
+  800be6:	09 fe                	or     %edi,%esi
+  800be8:	09 ce                	or     %ecx,%esi
+  800bea:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800bf0:	75 0e                	jne    800c00 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800bf2:	83 ef 04             	sub    $0x4,%edi
+  800bf5:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800bf8:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800bfb:	fd                   	std
+  800bfc:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800bfe:	eb 09                	jmp    800c09 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800c00:	83 ef 01             	sub    $0x1,%edi
+  800c03:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800c06:	fd                   	std
+  800c07:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800c09:	fc                   	cld
+  800c0a:	eb 1a                	jmp    800c26 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c0c:	89 f2                	mov    %esi,%edx
+  800c0e:	09 c2                	or     %eax,%edx
+  800c10:	09 ca                	or     %ecx,%edx
+  800c12:	f6 c2 03             	test   $0x3,%dl
+  800c15:	75 0a                	jne    800c21 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800c17:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800c1a:	89 c7                	mov    %eax,%edi
+  800c1c:	fc                   	cld
+  800c1d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c1f:	eb 05                	jmp    800c26 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800c21:	89 c7                	mov    %eax,%edi
+  800c23:	fc                   	cld
+  800c24:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800c26:	5e                   	pop    %esi
+  800c27:	5f                   	pop    %edi
+  800c28:	5d                   	pop    %ebp
+  800c29:	c3                   	ret
+
+00800c2a <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800c2a:	55                   	push   %ebp
+  800c2b:	89 e5                	mov    %esp,%ebp
+  800c2d:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800c30:	ff 75 10             	push   0x10(%ebp)
+  800c33:	ff 75 0c             	push   0xc(%ebp)
+  800c36:	ff 75 08             	push   0x8(%ebp)
+  800c39:	e8 8a ff ff ff       	call   800bc8 <memmove>
+}
+  800c3e:	c9                   	leave
+  800c3f:	c3                   	ret
+
+00800c40 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800c40:	55                   	push   %ebp
+  800c41:	89 e5                	mov    %esp,%ebp
+  800c43:	56                   	push   %esi
+  800c44:	53                   	push   %ebx
+  800c45:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c48:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800c4b:	89 c6                	mov    %eax,%esi
+  800c4d:	03 75 10             	add    0x10(%ebp),%esi
+  800c50:	eb 06                	jmp    800c58 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800c52:	83 c0 01             	add    $0x1,%eax
+  800c55:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800c58:	39 f0                	cmp    %esi,%eax
+  800c5a:	74 14                	je     800c70 <memcmp+0x30>
+		if (*s1 != *s2)
+  800c5c:	0f b6 08             	movzbl (%eax),%ecx
+  800c5f:	0f b6 1a             	movzbl (%edx),%ebx
+  800c62:	38 d9                	cmp    %bl,%cl
+  800c64:	74 ec                	je     800c52 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800c66:	0f b6 c1             	movzbl %cl,%eax
+  800c69:	0f b6 db             	movzbl %bl,%ebx
+  800c6c:	29 d8                	sub    %ebx,%eax
+  800c6e:	eb 05                	jmp    800c75 <memcmp+0x35>
+	}
+
+	return 0;
+  800c70:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c75:	5b                   	pop    %ebx
+  800c76:	5e                   	pop    %esi
+  800c77:	5d                   	pop    %ebp
+  800c78:	c3                   	ret
+
+00800c79 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800c79:	55                   	push   %ebp
+  800c7a:	89 e5                	mov    %esp,%ebp
+  800c7c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c7f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800c82:	89 c2                	mov    %eax,%edx
+  800c84:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800c87:	eb 03                	jmp    800c8c <memfind+0x13>
+  800c89:	83 c0 01             	add    $0x1,%eax
+  800c8c:	39 d0                	cmp    %edx,%eax
+  800c8e:	73 04                	jae    800c94 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800c90:	38 08                	cmp    %cl,(%eax)
+  800c92:	75 f5                	jne    800c89 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800c94:	5d                   	pop    %ebp
+  800c95:	c3                   	ret
+
+00800c96 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800c96:	55                   	push   %ebp
+  800c97:	89 e5                	mov    %esp,%ebp
+  800c99:	57                   	push   %edi
+  800c9a:	56                   	push   %esi
+  800c9b:	53                   	push   %ebx
+  800c9c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c9f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800ca2:	eb 03                	jmp    800ca7 <strtol+0x11>
+		s++;
+  800ca4:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800ca7:	0f b6 02             	movzbl (%edx),%eax
+  800caa:	3c 20                	cmp    $0x20,%al
+  800cac:	74 f6                	je     800ca4 <strtol+0xe>
+  800cae:	3c 09                	cmp    $0x9,%al
+  800cb0:	74 f2                	je     800ca4 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800cb2:	3c 2b                	cmp    $0x2b,%al
+  800cb4:	74 2a                	je     800ce0 <strtol+0x4a>
+	int neg = 0;
+  800cb6:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800cbb:	3c 2d                	cmp    $0x2d,%al
+  800cbd:	74 2b                	je     800cea <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800cbf:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800cc5:	75 0f                	jne    800cd6 <strtol+0x40>
+  800cc7:	80 3a 30             	cmpb   $0x30,(%edx)
+  800cca:	74 28                	je     800cf4 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800ccc:	85 db                	test   %ebx,%ebx
+  800cce:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800cd3:	0f 44 d8             	cmove  %eax,%ebx
+  800cd6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cdb:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800cde:	eb 46                	jmp    800d26 <strtol+0x90>
+		s++;
+  800ce0:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800ce3:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ce8:	eb d5                	jmp    800cbf <strtol+0x29>
+		s++, neg = 1;
+  800cea:	83 c2 01             	add    $0x1,%edx
+  800ced:	bf 01 00 00 00       	mov    $0x1,%edi
+  800cf2:	eb cb                	jmp    800cbf <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800cf4:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800cf8:	74 0e                	je     800d08 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800cfa:	85 db                	test   %ebx,%ebx
+  800cfc:	75 d8                	jne    800cd6 <strtol+0x40>
+		s++, base = 8;
+  800cfe:	83 c2 01             	add    $0x1,%edx
+  800d01:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800d06:	eb ce                	jmp    800cd6 <strtol+0x40>
+		s += 2, base = 16;
+  800d08:	83 c2 02             	add    $0x2,%edx
+  800d0b:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800d10:	eb c4                	jmp    800cd6 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800d12:	0f be c0             	movsbl %al,%eax
+  800d15:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800d18:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800d1b:	7d 3a                	jge    800d57 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800d1d:	83 c2 01             	add    $0x1,%edx
+  800d20:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800d24:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800d26:	0f b6 02             	movzbl (%edx),%eax
+  800d29:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800d2c:	89 f3                	mov    %esi,%ebx
+  800d2e:	80 fb 09             	cmp    $0x9,%bl
+  800d31:	76 df                	jbe    800d12 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800d33:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800d36:	89 f3                	mov    %esi,%ebx
+  800d38:	80 fb 19             	cmp    $0x19,%bl
+  800d3b:	77 08                	ja     800d45 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800d3d:	0f be c0             	movsbl %al,%eax
+  800d40:	83 e8 57             	sub    $0x57,%eax
+  800d43:	eb d3                	jmp    800d18 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800d45:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800d48:	89 f3                	mov    %esi,%ebx
+  800d4a:	80 fb 19             	cmp    $0x19,%bl
+  800d4d:	77 08                	ja     800d57 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800d4f:	0f be c0             	movsbl %al,%eax
+  800d52:	83 e8 37             	sub    $0x37,%eax
+  800d55:	eb c1                	jmp    800d18 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800d57:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d5b:	74 05                	je     800d62 <strtol+0xcc>
+		*endptr = (char *) s;
+  800d5d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d60:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800d62:	89 c8                	mov    %ecx,%eax
+  800d64:	f7 d8                	neg    %eax
+  800d66:	85 ff                	test   %edi,%edi
+  800d68:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800d6b:	89 c8                	mov    %ecx,%eax
+  800d6d:	5b                   	pop    %ebx
+  800d6e:	5e                   	pop    %esi
+  800d6f:	5f                   	pop    %edi
+  800d70:	5d                   	pop    %ebp
+  800d71:	c3                   	ret
+
+00800d72 <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800d72:	55                   	push   %ebp
+  800d73:	89 e5                	mov    %esp,%ebp
+  800d75:	57                   	push   %edi
+  800d76:	56                   	push   %esi
+  800d77:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d78:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d7d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d80:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d83:	89 c3                	mov    %eax,%ebx
+  800d85:	89 c7                	mov    %eax,%edi
+  800d87:	89 c6                	mov    %eax,%esi
+  800d89:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  800d8b:	5b                   	pop    %ebx
+  800d8c:	5e                   	pop    %esi
+  800d8d:	5f                   	pop    %edi
+  800d8e:	5d                   	pop    %ebp
+  800d8f:	c3                   	ret
+
+00800d90 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800d90:	55                   	push   %ebp
+  800d91:	89 e5                	mov    %esp,%ebp
+  800d93:	57                   	push   %edi
+  800d94:	56                   	push   %esi
+  800d95:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d96:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d9b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800da0:	89 d1                	mov    %edx,%ecx
+  800da2:	89 d3                	mov    %edx,%ebx
+  800da4:	89 d7                	mov    %edx,%edi
+  800da6:	89 d6                	mov    %edx,%esi
+  800da8:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800daa:	5b                   	pop    %ebx
+  800dab:	5e                   	pop    %esi
+  800dac:	5f                   	pop    %edi
+  800dad:	5d                   	pop    %ebp
+  800dae:	c3                   	ret
+
+00800daf <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800daf:	55                   	push   %ebp
+  800db0:	89 e5                	mov    %esp,%ebp
+  800db2:	57                   	push   %edi
+  800db3:	56                   	push   %esi
+  800db4:	53                   	push   %ebx
+  800db5:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800db8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dbd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc0:	b8 03 00 00 00       	mov    $0x3,%eax
+  800dc5:	89 cb                	mov    %ecx,%ebx
+  800dc7:	89 cf                	mov    %ecx,%edi
+  800dc9:	89 ce                	mov    %ecx,%esi
+  800dcb:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800dcd:	85 c0                	test   %eax,%eax
+  800dcf:	7f 08                	jg     800dd9 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800dd1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dd4:	5b                   	pop    %ebx
+  800dd5:	5e                   	pop    %esi
+  800dd6:	5f                   	pop    %edi
+  800dd7:	5d                   	pop    %ebp
+  800dd8:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800dd9:	83 ec 0c             	sub    $0xc,%esp
+  800ddc:	50                   	push   %eax
+  800ddd:	6a 03                	push   $0x3
+  800ddf:	68 53 2b 80 00       	push   $0x802b53
+  800de4:	6a 3e                	push   $0x3e
+  800de6:	68 70 2b 80 00       	push   $0x802b70
+  800deb:	e8 ce f4 ff ff       	call   8002be <_panic>
+
+00800df0 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800df0:	55                   	push   %ebp
+  800df1:	89 e5                	mov    %esp,%ebp
+  800df3:	57                   	push   %edi
+  800df4:	56                   	push   %esi
+  800df5:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800df6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dfb:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e00:	89 d1                	mov    %edx,%ecx
+  800e02:	89 d3                	mov    %edx,%ebx
+  800e04:	89 d7                	mov    %edx,%edi
+  800e06:	89 d6                	mov    %edx,%esi
+  800e08:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800e0a:	5b                   	pop    %ebx
+  800e0b:	5e                   	pop    %esi
+  800e0c:	5f                   	pop    %edi
+  800e0d:	5d                   	pop    %ebp
+  800e0e:	c3                   	ret
+
+00800e0f <sys_yield>:
+
+void
+sys_yield(void) {
+  800e0f:	55                   	push   %ebp
+  800e10:	89 e5                	mov    %esp,%ebp
+  800e12:	57                   	push   %edi
+  800e13:	56                   	push   %esi
+  800e14:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e15:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e1a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e1f:	89 d1                	mov    %edx,%ecx
+  800e21:	89 d3                	mov    %edx,%ebx
+  800e23:	89 d7                	mov    %edx,%edi
+  800e25:	89 d6                	mov    %edx,%esi
+  800e27:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800e29:	5b                   	pop    %ebx
+  800e2a:	5e                   	pop    %esi
+  800e2b:	5f                   	pop    %edi
+  800e2c:	5d                   	pop    %ebp
+  800e2d:	c3                   	ret
+
+00800e2e <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  800e2e:	55                   	push   %ebp
+  800e2f:	89 e5                	mov    %esp,%ebp
+  800e31:	57                   	push   %edi
+  800e32:	56                   	push   %esi
+  800e33:	53                   	push   %ebx
+  800e34:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800e37:	be 00 00 00 00       	mov    $0x0,%esi
+  800e3c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e3f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e42:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e47:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e4a:	89 f7                	mov    %esi,%edi
+  800e4c:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e4e:	85 c0                	test   %eax,%eax
+  800e50:	7f 08                	jg     800e5a <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800e52:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e55:	5b                   	pop    %ebx
+  800e56:	5e                   	pop    %esi
+  800e57:	5f                   	pop    %edi
+  800e58:	5d                   	pop    %ebp
+  800e59:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e5a:	83 ec 0c             	sub    $0xc,%esp
+  800e5d:	50                   	push   %eax
+  800e5e:	6a 04                	push   $0x4
+  800e60:	68 53 2b 80 00       	push   $0x802b53
+  800e65:	6a 3e                	push   $0x3e
+  800e67:	68 70 2b 80 00       	push   $0x802b70
+  800e6c:	e8 4d f4 ff ff       	call   8002be <_panic>
+
+00800e71 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  800e71:	55                   	push   %ebp
+  800e72:	89 e5                	mov    %esp,%ebp
+  800e74:	57                   	push   %edi
+  800e75:	56                   	push   %esi
+  800e76:	53                   	push   %ebx
+  800e77:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800e7a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e7d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e80:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e85:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e88:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e8b:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e8e:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e90:	85 c0                	test   %eax,%eax
+  800e92:	7f 08                	jg     800e9c <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800e94:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e97:	5b                   	pop    %ebx
+  800e98:	5e                   	pop    %esi
+  800e99:	5f                   	pop    %edi
+  800e9a:	5d                   	pop    %ebp
+  800e9b:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e9c:	83 ec 0c             	sub    $0xc,%esp
+  800e9f:	50                   	push   %eax
+  800ea0:	6a 05                	push   $0x5
+  800ea2:	68 53 2b 80 00       	push   $0x802b53
+  800ea7:	6a 3e                	push   $0x3e
+  800ea9:	68 70 2b 80 00       	push   $0x802b70
+  800eae:	e8 0b f4 ff ff       	call   8002be <_panic>
+
+00800eb3 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  800eb3:	55                   	push   %ebp
+  800eb4:	89 e5                	mov    %esp,%ebp
+  800eb6:	57                   	push   %edi
+  800eb7:	56                   	push   %esi
+  800eb8:	53                   	push   %ebx
+  800eb9:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800ebc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ec1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec7:	b8 06 00 00 00       	mov    $0x6,%eax
+  800ecc:	89 df                	mov    %ebx,%edi
+  800ece:	89 de                	mov    %ebx,%esi
+  800ed0:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ed2:	85 c0                	test   %eax,%eax
+  800ed4:	7f 08                	jg     800ede <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800ed6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ed9:	5b                   	pop    %ebx
+  800eda:	5e                   	pop    %esi
+  800edb:	5f                   	pop    %edi
+  800edc:	5d                   	pop    %ebp
+  800edd:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ede:	83 ec 0c             	sub    $0xc,%esp
+  800ee1:	50                   	push   %eax
+  800ee2:	6a 06                	push   $0x6
+  800ee4:	68 53 2b 80 00       	push   $0x802b53
+  800ee9:	6a 3e                	push   $0x3e
+  800eeb:	68 70 2b 80 00       	push   $0x802b70
+  800ef0:	e8 c9 f3 ff ff       	call   8002be <_panic>
+
+00800ef5 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800ef5:	55                   	push   %ebp
+  800ef6:	89 e5                	mov    %esp,%ebp
+  800ef8:	57                   	push   %edi
+  800ef9:	56                   	push   %esi
+  800efa:	53                   	push   %ebx
+  800efb:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800efe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f03:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f06:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f09:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f0e:	89 df                	mov    %ebx,%edi
+  800f10:	89 de                	mov    %ebx,%esi
+  800f12:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f14:	85 c0                	test   %eax,%eax
+  800f16:	7f 08                	jg     800f20 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800f18:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f1b:	5b                   	pop    %ebx
+  800f1c:	5e                   	pop    %esi
+  800f1d:	5f                   	pop    %edi
+  800f1e:	5d                   	pop    %ebp
+  800f1f:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f20:	83 ec 0c             	sub    $0xc,%esp
+  800f23:	50                   	push   %eax
+  800f24:	6a 08                	push   $0x8
+  800f26:	68 53 2b 80 00       	push   $0x802b53
+  800f2b:	6a 3e                	push   $0x3e
+  800f2d:	68 70 2b 80 00       	push   $0x802b70
+  800f32:	e8 87 f3 ff ff       	call   8002be <_panic>
+
+00800f37 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800f37:	55                   	push   %ebp
+  800f38:	89 e5                	mov    %esp,%ebp
+  800f3a:	57                   	push   %edi
+  800f3b:	56                   	push   %esi
+  800f3c:	53                   	push   %ebx
+  800f3d:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800f40:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f45:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f48:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f4b:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f50:	89 df                	mov    %ebx,%edi
+  800f52:	89 de                	mov    %ebx,%esi
+  800f54:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f56:	85 c0                	test   %eax,%eax
+  800f58:	7f 08                	jg     800f62 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800f5a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f5d:	5b                   	pop    %ebx
+  800f5e:	5e                   	pop    %esi
+  800f5f:	5f                   	pop    %edi
+  800f60:	5d                   	pop    %ebp
+  800f61:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f62:	83 ec 0c             	sub    $0xc,%esp
+  800f65:	50                   	push   %eax
+  800f66:	6a 09                	push   $0x9
+  800f68:	68 53 2b 80 00       	push   $0x802b53
+  800f6d:	6a 3e                	push   $0x3e
+  800f6f:	68 70 2b 80 00       	push   $0x802b70
+  800f74:	e8 45 f3 ff ff       	call   8002be <_panic>
+
+00800f79 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800f79:	55                   	push   %ebp
+  800f7a:	89 e5                	mov    %esp,%ebp
+  800f7c:	57                   	push   %edi
+  800f7d:	56                   	push   %esi
+  800f7e:	53                   	push   %ebx
+  800f7f:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800f82:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f87:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f8a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f8d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f92:	89 df                	mov    %ebx,%edi
+  800f94:	89 de                	mov    %ebx,%esi
+  800f96:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f98:	85 c0                	test   %eax,%eax
+  800f9a:	7f 08                	jg     800fa4 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800f9c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f9f:	5b                   	pop    %ebx
+  800fa0:	5e                   	pop    %esi
+  800fa1:	5f                   	pop    %edi
+  800fa2:	5d                   	pop    %ebp
+  800fa3:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800fa4:	83 ec 0c             	sub    $0xc,%esp
+  800fa7:	50                   	push   %eax
+  800fa8:	6a 0a                	push   $0xa
+  800faa:	68 53 2b 80 00       	push   $0x802b53
+  800faf:	6a 3e                	push   $0x3e
+  800fb1:	68 70 2b 80 00       	push   $0x802b70
+  800fb6:	e8 03 f3 ff ff       	call   8002be <_panic>
+
+00800fbb <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  800fbb:	55                   	push   %ebp
+  800fbc:	89 e5                	mov    %esp,%ebp
+  800fbe:	57                   	push   %edi
+  800fbf:	56                   	push   %esi
+  800fc0:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800fc1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fc7:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800fcc:	be 00 00 00 00       	mov    $0x0,%esi
+  800fd1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fd4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fd7:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800fd9:	5b                   	pop    %ebx
+  800fda:	5e                   	pop    %esi
+  800fdb:	5f                   	pop    %edi
+  800fdc:	5d                   	pop    %ebp
+  800fdd:	c3                   	ret
+
+00800fde <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  800fde:	55                   	push   %ebp
+  800fdf:	89 e5                	mov    %esp,%ebp
+  800fe1:	57                   	push   %edi
+  800fe2:	56                   	push   %esi
+  800fe3:	53                   	push   %ebx
+  800fe4:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800fe7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fec:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fef:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800ff4:	89 cb                	mov    %ecx,%ebx
+  800ff6:	89 cf                	mov    %ecx,%edi
+  800ff8:	89 ce                	mov    %ecx,%esi
+  800ffa:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ffc:	85 c0                	test   %eax,%eax
+  800ffe:	7f 08                	jg     801008 <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  801000:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801003:	5b                   	pop    %ebx
+  801004:	5e                   	pop    %esi
+  801005:	5f                   	pop    %edi
+  801006:	5d                   	pop    %ebp
+  801007:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801008:	83 ec 0c             	sub    $0xc,%esp
+  80100b:	50                   	push   %eax
+  80100c:	6a 0d                	push   $0xd
+  80100e:	68 53 2b 80 00       	push   $0x802b53
+  801013:	6a 3e                	push   $0x3e
+  801015:	68 70 2b 80 00       	push   $0x802b70
+  80101a:	e8 9f f2 ff ff       	call   8002be <_panic>
+
+0080101f <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  80101f:	55                   	push   %ebp
+  801020:	89 e5                	mov    %esp,%ebp
+  801022:	57                   	push   %edi
+  801023:	56                   	push   %esi
+  801024:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  801025:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80102a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80102d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801030:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801035:	89 df                	mov    %ebx,%edi
+  801037:	89 de                	mov    %ebx,%esi
+  801039:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  80103b:	5b                   	pop    %ebx
+  80103c:	5e                   	pop    %esi
+  80103d:	5f                   	pop    %edi
+  80103e:	5d                   	pop    %ebp
+  80103f:	c3                   	ret
+
+00801040 <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  801040:	55                   	push   %ebp
+  801041:	89 e5                	mov    %esp,%ebp
+  801043:	57                   	push   %edi
+  801044:	56                   	push   %esi
+  801045:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  801046:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80104b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80104e:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801053:	89 cb                	mov    %ecx,%ebx
+  801055:	89 cf                	mov    %ecx,%edi
+  801057:	89 ce                	mov    %ecx,%esi
+  801059:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  80105b:	5b                   	pop    %ebx
+  80105c:	5e                   	pop    %esi
+  80105d:	5f                   	pop    %edi
+  80105e:	5d                   	pop    %ebp
+  80105f:	c3                   	ret
+
+00801060 <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  801060:	55                   	push   %ebp
+  801061:	89 e5                	mov    %esp,%ebp
+  801063:	57                   	push   %edi
+  801064:	56                   	push   %esi
+  801065:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  801066:	ba 00 00 00 00       	mov    $0x0,%edx
+  80106b:	b8 10 00 00 00       	mov    $0x10,%eax
+  801070:	89 d1                	mov    %edx,%ecx
+  801072:	89 d3                	mov    %edx,%ebx
+  801074:	89 d7                	mov    %edx,%edi
+  801076:	89 d6                	mov    %edx,%esi
+  801078:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80107a:	5b                   	pop    %ebx
+  80107b:	5e                   	pop    %esi
+  80107c:	5f                   	pop    %edi
+  80107d:	5d                   	pop    %ebp
+  80107e:	c3                   	ret
+
+0080107f <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  80107f:	55                   	push   %ebp
+  801080:	89 e5                	mov    %esp,%ebp
+  801082:	57                   	push   %edi
+  801083:	56                   	push   %esi
+  801084:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  801085:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80108a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80108d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801090:	b8 11 00 00 00       	mov    $0x11,%eax
+  801095:	89 df                	mov    %ebx,%edi
+  801097:	89 de                	mov    %ebx,%esi
+  801099:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  80109b:	5b                   	pop    %ebx
+  80109c:	5e                   	pop    %esi
+  80109d:	5f                   	pop    %edi
+  80109e:	5d                   	pop    %ebp
+  80109f:	c3                   	ret
+
+008010a0 <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  8010a0:	55                   	push   %ebp
+  8010a1:	89 e5                	mov    %esp,%ebp
+  8010a3:	57                   	push   %edi
+  8010a4:	56                   	push   %esi
+  8010a5:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8010a6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010ab:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b1:	b8 12 00 00 00       	mov    $0x12,%eax
+  8010b6:	89 df                	mov    %ebx,%edi
+  8010b8:	89 de                	mov    %ebx,%esi
+  8010ba:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  8010bc:	5b                   	pop    %ebx
+  8010bd:	5e                   	pop    %esi
+  8010be:	5f                   	pop    %edi
+  8010bf:	5d                   	pop    %ebp
+  8010c0:	c3                   	ret
+
+008010c1 <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  8010c1:	55                   	push   %ebp
+  8010c2:	89 e5                	mov    %esp,%ebp
+  8010c4:	57                   	push   %edi
+  8010c5:	56                   	push   %esi
+  8010c6:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8010c7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010cf:	b8 13 00 00 00       	mov    $0x13,%eax
+  8010d4:	89 cb                	mov    %ecx,%ebx
+  8010d6:	89 cf                	mov    %ecx,%edi
+  8010d8:	89 ce                	mov    %ecx,%esi
+  8010da:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  8010dc:	5b                   	pop    %ebx
+  8010dd:	5e                   	pop    %esi
+  8010de:	5f                   	pop    %edi
+  8010df:	5d                   	pop    %ebp
+  8010e0:	c3                   	ret
+
+008010e1 <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  8010e1:	55                   	push   %ebp
+  8010e2:	89 e5                	mov    %esp,%ebp
+  8010e4:	57                   	push   %edi
+  8010e5:	56                   	push   %esi
+  8010e6:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8010e7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ef:	b8 14 00 00 00       	mov    $0x14,%eax
+  8010f4:	89 cb                	mov    %ecx,%ebx
+  8010f6:	89 cf                	mov    %ecx,%edi
+  8010f8:	89 ce                	mov    %ecx,%esi
+  8010fa:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  8010fc:	5b                   	pop    %ebx
+  8010fd:	5e                   	pop    %esi
+  8010fe:	5f                   	pop    %edi
+  8010ff:	5d                   	pop    %ebp
+  801100:	c3                   	ret
+
+00801101 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801101:	55                   	push   %ebp
+  801102:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801104:	8b 45 08             	mov    0x8(%ebp),%eax
+  801107:	05 00 00 00 30       	add    $0x30000000,%eax
+  80110c:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80110f:	5d                   	pop    %ebp
+  801110:	c3                   	ret
+
+00801111 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801111:	55                   	push   %ebp
+  801112:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801114:	8b 45 08             	mov    0x8(%ebp),%eax
+  801117:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80111c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801121:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801126:	5d                   	pop    %ebp
+  801127:	c3                   	ret
+
+00801128 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801128:	55                   	push   %ebp
+  801129:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80112b:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801130:	eb 02                	jmp    801134 <fd_alloc+0xc>
+  801132:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801134:	89 c2                	mov    %eax,%edx
+  801136:	c1 ea 16             	shr    $0x16,%edx
+  801139:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801140:	f6 c2 01             	test   $0x1,%dl
+  801143:	74 2b                	je     801170 <fd_alloc+0x48>
+  801145:	89 c2                	mov    %eax,%edx
+  801147:	c1 ea 0c             	shr    $0xc,%edx
+  80114a:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801151:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801157:	f6 c1 01             	test   $0x1,%cl
+  80115a:	74 14                	je     801170 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80115c:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801162:	75 ce                	jne    801132 <fd_alloc+0xa>
+  801164:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801169:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80116e:	eb 05                	jmp    801175 <fd_alloc+0x4d>
+			return 0;
+  801170:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801175:	8b 55 08             	mov    0x8(%ebp),%edx
+  801178:	89 02                	mov    %eax,(%edx)
+}
+  80117a:	89 c8                	mov    %ecx,%eax
+  80117c:	5d                   	pop    %ebp
+  80117d:	c3                   	ret
+
+0080117e <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80117e:	55                   	push   %ebp
+  80117f:	89 e5                	mov    %esp,%ebp
+  801181:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801184:	83 f8 1f             	cmp    $0x1f,%eax
+  801187:	77 30                	ja     8011b9 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801189:	c1 e0 0c             	shl    $0xc,%eax
+  80118c:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801191:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801197:	f6 c2 01             	test   $0x1,%dl
+  80119a:	74 24                	je     8011c0 <fd_lookup+0x42>
+  80119c:	89 c2                	mov    %eax,%edx
+  80119e:	c1 ea 0c             	shr    $0xc,%edx
+  8011a1:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8011a8:	f6 c2 01             	test   $0x1,%dl
+  8011ab:	74 1a                	je     8011c7 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8011ad:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8011b0:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8011b2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011b7:	5d                   	pop    %ebp
+  8011b8:	c3                   	ret
+		return -E_INVAL;
+  8011b9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011be:	eb f7                	jmp    8011b7 <fd_lookup+0x39>
+		return -E_INVAL;
+  8011c0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011c5:	eb f0                	jmp    8011b7 <fd_lookup+0x39>
+  8011c7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011cc:	eb e9                	jmp    8011b7 <fd_lookup+0x39>
+
+008011ce <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8011ce:	55                   	push   %ebp
+  8011cf:	89 e5                	mov    %esp,%ebp
+  8011d1:	53                   	push   %ebx
+  8011d2:	83 ec 04             	sub    $0x4,%esp
+  8011d5:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8011d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011dd:	eb 03                	jmp    8011e2 <dev_lookup+0x14>
+  8011df:	83 c0 01             	add    $0x1,%eax
+  8011e2:	8b 1c 85 fc 2b 80 00 	mov    0x802bfc(,%eax,4),%ebx
+  8011e9:	85 db                	test   %ebx,%ebx
+  8011eb:	74 0b                	je     8011f8 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8011ed:	39 13                	cmp    %edx,(%ebx)
+  8011ef:	75 ee                	jne    8011df <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8011f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011f6:	eb 1f                	jmp    801217 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8011f8:	a1 08 44 80 00       	mov    0x804408,%eax
+  8011fd:	8b 40 48             	mov    0x48(%eax),%eax
+  801200:	83 ec 04             	sub    $0x4,%esp
+  801203:	52                   	push   %edx
+  801204:	50                   	push   %eax
+  801205:	68 80 2b 80 00       	push   $0x802b80
+  80120a:	e8 8a f1 ff ff       	call   800399 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80120f:	83 c4 10             	add    $0x10,%esp
+  801212:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801217:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80121a:	89 1a                	mov    %ebx,(%edx)
+}
+  80121c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80121f:	c9                   	leave
+  801220:	c3                   	ret
+
+00801221 <fd_close>:
+{
+  801221:	55                   	push   %ebp
+  801222:	89 e5                	mov    %esp,%ebp
+  801224:	57                   	push   %edi
+  801225:	56                   	push   %esi
+  801226:	53                   	push   %ebx
+  801227:	83 ec 24             	sub    $0x24,%esp
+  80122a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80122d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801230:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801233:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801234:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80123a:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80123d:	50                   	push   %eax
+  80123e:	e8 3b ff ff ff       	call   80117e <fd_lookup>
+  801243:	89 c3                	mov    %eax,%ebx
+  801245:	83 c4 10             	add    $0x10,%esp
+  801248:	85 c0                	test   %eax,%eax
+  80124a:	78 05                	js     801251 <fd_close+0x30>
+	    || fd != fd2)
+  80124c:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80124f:	74 16                	je     801267 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801251:	89 f8                	mov    %edi,%eax
+  801253:	84 c0                	test   %al,%al
+  801255:	b8 00 00 00 00       	mov    $0x0,%eax
+  80125a:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80125d:	89 d8                	mov    %ebx,%eax
+  80125f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801262:	5b                   	pop    %ebx
+  801263:	5e                   	pop    %esi
+  801264:	5f                   	pop    %edi
+  801265:	5d                   	pop    %ebp
+  801266:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801267:	83 ec 08             	sub    $0x8,%esp
+  80126a:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80126d:	50                   	push   %eax
+  80126e:	ff 36                	push   (%esi)
+  801270:	e8 59 ff ff ff       	call   8011ce <dev_lookup>
+  801275:	89 c3                	mov    %eax,%ebx
+  801277:	83 c4 10             	add    $0x10,%esp
+  80127a:	85 c0                	test   %eax,%eax
+  80127c:	78 1a                	js     801298 <fd_close+0x77>
+		if (dev->dev_close)
+  80127e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801281:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801284:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801289:	85 c0                	test   %eax,%eax
+  80128b:	74 0b                	je     801298 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80128d:	83 ec 0c             	sub    $0xc,%esp
+  801290:	56                   	push   %esi
+  801291:	ff d0                	call   *%eax
+  801293:	89 c3                	mov    %eax,%ebx
+  801295:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801298:	83 ec 08             	sub    $0x8,%esp
+  80129b:	56                   	push   %esi
+  80129c:	6a 00                	push   $0x0
+  80129e:	e8 10 fc ff ff       	call   800eb3 <sys_page_unmap>
+	return r;
+  8012a3:	83 c4 10             	add    $0x10,%esp
+  8012a6:	eb b5                	jmp    80125d <fd_close+0x3c>
+
+008012a8 <close>:
+
+int
+close(int fdnum)
+{
+  8012a8:	55                   	push   %ebp
+  8012a9:	89 e5                	mov    %esp,%ebp
+  8012ab:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8012ae:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8012b1:	50                   	push   %eax
+  8012b2:	ff 75 08             	push   0x8(%ebp)
+  8012b5:	e8 c4 fe ff ff       	call   80117e <fd_lookup>
+  8012ba:	83 c4 10             	add    $0x10,%esp
+  8012bd:	85 c0                	test   %eax,%eax
+  8012bf:	79 02                	jns    8012c3 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8012c1:	c9                   	leave
+  8012c2:	c3                   	ret
+		return fd_close(fd, 1);
+  8012c3:	83 ec 08             	sub    $0x8,%esp
+  8012c6:	6a 01                	push   $0x1
+  8012c8:	ff 75 f4             	push   -0xc(%ebp)
+  8012cb:	e8 51 ff ff ff       	call   801221 <fd_close>
+  8012d0:	83 c4 10             	add    $0x10,%esp
+  8012d3:	eb ec                	jmp    8012c1 <close+0x19>
+
+008012d5 <close_all>:
+
+void
+close_all(void)
+{
+  8012d5:	55                   	push   %ebp
+  8012d6:	89 e5                	mov    %esp,%ebp
+  8012d8:	53                   	push   %ebx
+  8012d9:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8012dc:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8012e1:	83 ec 0c             	sub    $0xc,%esp
+  8012e4:	53                   	push   %ebx
+  8012e5:	e8 be ff ff ff       	call   8012a8 <close>
+	for (i = 0; i < MAXFD; i++)
+  8012ea:	83 c3 01             	add    $0x1,%ebx
+  8012ed:	83 c4 10             	add    $0x10,%esp
+  8012f0:	83 fb 20             	cmp    $0x20,%ebx
+  8012f3:	75 ec                	jne    8012e1 <close_all+0xc>
+}
+  8012f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012f8:	c9                   	leave
+  8012f9:	c3                   	ret
+
+008012fa <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8012fa:	55                   	push   %ebp
+  8012fb:	89 e5                	mov    %esp,%ebp
+  8012fd:	57                   	push   %edi
+  8012fe:	56                   	push   %esi
+  8012ff:	53                   	push   %ebx
+  801300:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801303:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801306:	50                   	push   %eax
+  801307:	ff 75 08             	push   0x8(%ebp)
+  80130a:	e8 6f fe ff ff       	call   80117e <fd_lookup>
+  80130f:	89 c3                	mov    %eax,%ebx
+  801311:	83 c4 10             	add    $0x10,%esp
+  801314:	85 c0                	test   %eax,%eax
+  801316:	78 7f                	js     801397 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801318:	83 ec 0c             	sub    $0xc,%esp
+  80131b:	ff 75 0c             	push   0xc(%ebp)
+  80131e:	e8 85 ff ff ff       	call   8012a8 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801323:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801326:	c1 e6 0c             	shl    $0xc,%esi
+  801329:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80132f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801332:	89 3c 24             	mov    %edi,(%esp)
+  801335:	e8 d7 fd ff ff       	call   801111 <fd2data>
+  80133a:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80133c:	89 34 24             	mov    %esi,(%esp)
+  80133f:	e8 cd fd ff ff       	call   801111 <fd2data>
+  801344:	83 c4 10             	add    $0x10,%esp
+  801347:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80134a:	89 d8                	mov    %ebx,%eax
+  80134c:	c1 e8 16             	shr    $0x16,%eax
+  80134f:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801356:	a8 01                	test   $0x1,%al
+  801358:	74 11                	je     80136b <dup+0x71>
+  80135a:	89 d8                	mov    %ebx,%eax
+  80135c:	c1 e8 0c             	shr    $0xc,%eax
+  80135f:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801366:	f6 c2 01             	test   $0x1,%dl
+  801369:	75 36                	jne    8013a1 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80136b:	89 f8                	mov    %edi,%eax
+  80136d:	c1 e8 0c             	shr    $0xc,%eax
+  801370:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801377:	83 ec 0c             	sub    $0xc,%esp
+  80137a:	25 07 0e 00 00       	and    $0xe07,%eax
+  80137f:	50                   	push   %eax
+  801380:	56                   	push   %esi
+  801381:	6a 00                	push   $0x0
+  801383:	57                   	push   %edi
+  801384:	6a 00                	push   $0x0
+  801386:	e8 e6 fa ff ff       	call   800e71 <sys_page_map>
+  80138b:	89 c3                	mov    %eax,%ebx
+  80138d:	83 c4 20             	add    $0x20,%esp
+  801390:	85 c0                	test   %eax,%eax
+  801392:	78 33                	js     8013c7 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801394:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801397:	89 d8                	mov    %ebx,%eax
+  801399:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80139c:	5b                   	pop    %ebx
+  80139d:	5e                   	pop    %esi
+  80139e:	5f                   	pop    %edi
+  80139f:	5d                   	pop    %ebp
+  8013a0:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8013a1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8013a8:	83 ec 0c             	sub    $0xc,%esp
+  8013ab:	25 07 0e 00 00       	and    $0xe07,%eax
+  8013b0:	50                   	push   %eax
+  8013b1:	ff 75 d4             	push   -0x2c(%ebp)
+  8013b4:	6a 00                	push   $0x0
+  8013b6:	53                   	push   %ebx
+  8013b7:	6a 00                	push   $0x0
+  8013b9:	e8 b3 fa ff ff       	call   800e71 <sys_page_map>
+  8013be:	89 c3                	mov    %eax,%ebx
+  8013c0:	83 c4 20             	add    $0x20,%esp
+  8013c3:	85 c0                	test   %eax,%eax
+  8013c5:	79 a4                	jns    80136b <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8013c7:	83 ec 08             	sub    $0x8,%esp
+  8013ca:	56                   	push   %esi
+  8013cb:	6a 00                	push   $0x0
+  8013cd:	e8 e1 fa ff ff       	call   800eb3 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8013d2:	83 c4 08             	add    $0x8,%esp
+  8013d5:	ff 75 d4             	push   -0x2c(%ebp)
+  8013d8:	6a 00                	push   $0x0
+  8013da:	e8 d4 fa ff ff       	call   800eb3 <sys_page_unmap>
+	return r;
+  8013df:	83 c4 10             	add    $0x10,%esp
+  8013e2:	eb b3                	jmp    801397 <dup+0x9d>
+
+008013e4 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8013e4:	55                   	push   %ebp
+  8013e5:	89 e5                	mov    %esp,%ebp
+  8013e7:	56                   	push   %esi
+  8013e8:	53                   	push   %ebx
+  8013e9:	83 ec 18             	sub    $0x18,%esp
+  8013ec:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8013ef:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8013f2:	50                   	push   %eax
+  8013f3:	56                   	push   %esi
+  8013f4:	e8 85 fd ff ff       	call   80117e <fd_lookup>
+  8013f9:	83 c4 10             	add    $0x10,%esp
+  8013fc:	85 c0                	test   %eax,%eax
+  8013fe:	78 3c                	js     80143c <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801400:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801403:	83 ec 08             	sub    $0x8,%esp
+  801406:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801409:	50                   	push   %eax
+  80140a:	ff 33                	push   (%ebx)
+  80140c:	e8 bd fd ff ff       	call   8011ce <dev_lookup>
+  801411:	83 c4 10             	add    $0x10,%esp
+  801414:	85 c0                	test   %eax,%eax
+  801416:	78 24                	js     80143c <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801418:	8b 43 08             	mov    0x8(%ebx),%eax
+  80141b:	83 e0 03             	and    $0x3,%eax
+  80141e:	83 f8 01             	cmp    $0x1,%eax
+  801421:	74 20                	je     801443 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801423:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801426:	8b 40 08             	mov    0x8(%eax),%eax
+  801429:	85 c0                	test   %eax,%eax
+  80142b:	74 37                	je     801464 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80142d:	83 ec 04             	sub    $0x4,%esp
+  801430:	ff 75 10             	push   0x10(%ebp)
+  801433:	ff 75 0c             	push   0xc(%ebp)
+  801436:	53                   	push   %ebx
+  801437:	ff d0                	call   *%eax
+  801439:	83 c4 10             	add    $0x10,%esp
+}
+  80143c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80143f:	5b                   	pop    %ebx
+  801440:	5e                   	pop    %esi
+  801441:	5d                   	pop    %ebp
+  801442:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801443:	a1 08 44 80 00       	mov    0x804408,%eax
+  801448:	8b 40 48             	mov    0x48(%eax),%eax
+  80144b:	83 ec 04             	sub    $0x4,%esp
+  80144e:	56                   	push   %esi
+  80144f:	50                   	push   %eax
+  801450:	68 c1 2b 80 00       	push   $0x802bc1
+  801455:	e8 3f ef ff ff       	call   800399 <cprintf>
+		return -E_INVAL;
+  80145a:	83 c4 10             	add    $0x10,%esp
+  80145d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801462:	eb d8                	jmp    80143c <read+0x58>
+		return -E_NOT_SUPP;
+  801464:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801469:	eb d1                	jmp    80143c <read+0x58>
+
+0080146b <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80146b:	55                   	push   %ebp
+  80146c:	89 e5                	mov    %esp,%ebp
+  80146e:	57                   	push   %edi
+  80146f:	56                   	push   %esi
+  801470:	53                   	push   %ebx
+  801471:	83 ec 0c             	sub    $0xc,%esp
+  801474:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801477:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80147a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80147f:	eb 02                	jmp    801483 <readn+0x18>
+  801481:	01 c3                	add    %eax,%ebx
+  801483:	39 f3                	cmp    %esi,%ebx
+  801485:	73 21                	jae    8014a8 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801487:	83 ec 04             	sub    $0x4,%esp
+  80148a:	89 f0                	mov    %esi,%eax
+  80148c:	29 d8                	sub    %ebx,%eax
+  80148e:	50                   	push   %eax
+  80148f:	89 d8                	mov    %ebx,%eax
+  801491:	03 45 0c             	add    0xc(%ebp),%eax
+  801494:	50                   	push   %eax
+  801495:	57                   	push   %edi
+  801496:	e8 49 ff ff ff       	call   8013e4 <read>
+		if (m < 0)
+  80149b:	83 c4 10             	add    $0x10,%esp
+  80149e:	85 c0                	test   %eax,%eax
+  8014a0:	78 04                	js     8014a6 <readn+0x3b>
+			return m;
+		if (m == 0)
+  8014a2:	75 dd                	jne    801481 <readn+0x16>
+  8014a4:	eb 02                	jmp    8014a8 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8014a6:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8014a8:	89 d8                	mov    %ebx,%eax
+  8014aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014ad:	5b                   	pop    %ebx
+  8014ae:	5e                   	pop    %esi
+  8014af:	5f                   	pop    %edi
+  8014b0:	5d                   	pop    %ebp
+  8014b1:	c3                   	ret
+
+008014b2 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8014b2:	55                   	push   %ebp
+  8014b3:	89 e5                	mov    %esp,%ebp
+  8014b5:	56                   	push   %esi
+  8014b6:	53                   	push   %ebx
+  8014b7:	83 ec 18             	sub    $0x18,%esp
+  8014ba:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8014bd:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8014c0:	50                   	push   %eax
+  8014c1:	53                   	push   %ebx
+  8014c2:	e8 b7 fc ff ff       	call   80117e <fd_lookup>
+  8014c7:	83 c4 10             	add    $0x10,%esp
+  8014ca:	85 c0                	test   %eax,%eax
+  8014cc:	78 37                	js     801505 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8014ce:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8014d1:	83 ec 08             	sub    $0x8,%esp
+  8014d4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014d7:	50                   	push   %eax
+  8014d8:	ff 36                	push   (%esi)
+  8014da:	e8 ef fc ff ff       	call   8011ce <dev_lookup>
+  8014df:	83 c4 10             	add    $0x10,%esp
+  8014e2:	85 c0                	test   %eax,%eax
+  8014e4:	78 1f                	js     801505 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8014e6:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8014ea:	74 20                	je     80150c <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8014ec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014ef:	8b 40 0c             	mov    0xc(%eax),%eax
+  8014f2:	85 c0                	test   %eax,%eax
+  8014f4:	74 37                	je     80152d <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8014f6:	83 ec 04             	sub    $0x4,%esp
+  8014f9:	ff 75 10             	push   0x10(%ebp)
+  8014fc:	ff 75 0c             	push   0xc(%ebp)
+  8014ff:	56                   	push   %esi
+  801500:	ff d0                	call   *%eax
+  801502:	83 c4 10             	add    $0x10,%esp
+}
+  801505:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801508:	5b                   	pop    %ebx
+  801509:	5e                   	pop    %esi
+  80150a:	5d                   	pop    %ebp
+  80150b:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80150c:	a1 08 44 80 00       	mov    0x804408,%eax
+  801511:	8b 40 48             	mov    0x48(%eax),%eax
+  801514:	83 ec 04             	sub    $0x4,%esp
+  801517:	53                   	push   %ebx
+  801518:	50                   	push   %eax
+  801519:	68 dd 2b 80 00       	push   $0x802bdd
+  80151e:	e8 76 ee ff ff       	call   800399 <cprintf>
+		return -E_INVAL;
+  801523:	83 c4 10             	add    $0x10,%esp
+  801526:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80152b:	eb d8                	jmp    801505 <write+0x53>
+		return -E_NOT_SUPP;
+  80152d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801532:	eb d1                	jmp    801505 <write+0x53>
+
+00801534 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801534:	55                   	push   %ebp
+  801535:	89 e5                	mov    %esp,%ebp
+  801537:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80153a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80153d:	50                   	push   %eax
+  80153e:	ff 75 08             	push   0x8(%ebp)
+  801541:	e8 38 fc ff ff       	call   80117e <fd_lookup>
+  801546:	83 c4 10             	add    $0x10,%esp
+  801549:	85 c0                	test   %eax,%eax
+  80154b:	78 0e                	js     80155b <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80154d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801550:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801553:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801556:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80155b:	c9                   	leave
+  80155c:	c3                   	ret
+
+0080155d <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80155d:	55                   	push   %ebp
+  80155e:	89 e5                	mov    %esp,%ebp
+  801560:	56                   	push   %esi
+  801561:	53                   	push   %ebx
+  801562:	83 ec 18             	sub    $0x18,%esp
+  801565:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801568:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80156b:	50                   	push   %eax
+  80156c:	53                   	push   %ebx
+  80156d:	e8 0c fc ff ff       	call   80117e <fd_lookup>
+  801572:	83 c4 10             	add    $0x10,%esp
+  801575:	85 c0                	test   %eax,%eax
+  801577:	78 34                	js     8015ad <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801579:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80157c:	83 ec 08             	sub    $0x8,%esp
+  80157f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801582:	50                   	push   %eax
+  801583:	ff 36                	push   (%esi)
+  801585:	e8 44 fc ff ff       	call   8011ce <dev_lookup>
+  80158a:	83 c4 10             	add    $0x10,%esp
+  80158d:	85 c0                	test   %eax,%eax
+  80158f:	78 1c                	js     8015ad <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801591:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801595:	74 1d                	je     8015b4 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801597:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80159a:	8b 40 18             	mov    0x18(%eax),%eax
+  80159d:	85 c0                	test   %eax,%eax
+  80159f:	74 34                	je     8015d5 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8015a1:	83 ec 08             	sub    $0x8,%esp
+  8015a4:	ff 75 0c             	push   0xc(%ebp)
+  8015a7:	56                   	push   %esi
+  8015a8:	ff d0                	call   *%eax
+  8015aa:	83 c4 10             	add    $0x10,%esp
+}
+  8015ad:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015b0:	5b                   	pop    %ebx
+  8015b1:	5e                   	pop    %esi
+  8015b2:	5d                   	pop    %ebp
+  8015b3:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8015b4:	a1 08 44 80 00       	mov    0x804408,%eax
+  8015b9:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8015bc:	83 ec 04             	sub    $0x4,%esp
+  8015bf:	53                   	push   %ebx
+  8015c0:	50                   	push   %eax
+  8015c1:	68 a0 2b 80 00       	push   $0x802ba0
+  8015c6:	e8 ce ed ff ff       	call   800399 <cprintf>
+		return -E_INVAL;
+  8015cb:	83 c4 10             	add    $0x10,%esp
+  8015ce:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015d3:	eb d8                	jmp    8015ad <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8015d5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015da:	eb d1                	jmp    8015ad <ftruncate+0x50>
+
+008015dc <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8015dc:	55                   	push   %ebp
+  8015dd:	89 e5                	mov    %esp,%ebp
+  8015df:	56                   	push   %esi
+  8015e0:	53                   	push   %ebx
+  8015e1:	83 ec 18             	sub    $0x18,%esp
+  8015e4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015e7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8015ea:	50                   	push   %eax
+  8015eb:	ff 75 08             	push   0x8(%ebp)
+  8015ee:	e8 8b fb ff ff       	call   80117e <fd_lookup>
+  8015f3:	83 c4 10             	add    $0x10,%esp
+  8015f6:	85 c0                	test   %eax,%eax
+  8015f8:	78 49                	js     801643 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8015fa:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8015fd:	83 ec 08             	sub    $0x8,%esp
+  801600:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801603:	50                   	push   %eax
+  801604:	ff 36                	push   (%esi)
+  801606:	e8 c3 fb ff ff       	call   8011ce <dev_lookup>
+  80160b:	83 c4 10             	add    $0x10,%esp
+  80160e:	85 c0                	test   %eax,%eax
+  801610:	78 31                	js     801643 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801612:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801615:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801619:	74 2f                	je     80164a <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80161b:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80161e:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801625:	00 00 00 
+	stat->st_isdir = 0;
+  801628:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80162f:	00 00 00 
+	stat->st_dev = dev;
+  801632:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801638:	83 ec 08             	sub    $0x8,%esp
+  80163b:	53                   	push   %ebx
+  80163c:	56                   	push   %esi
+  80163d:	ff 50 14             	call   *0x14(%eax)
+  801640:	83 c4 10             	add    $0x10,%esp
+}
+  801643:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801646:	5b                   	pop    %ebx
+  801647:	5e                   	pop    %esi
+  801648:	5d                   	pop    %ebp
+  801649:	c3                   	ret
+		return -E_NOT_SUPP;
+  80164a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80164f:	eb f2                	jmp    801643 <fstat+0x67>
+
+00801651 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801651:	55                   	push   %ebp
+  801652:	89 e5                	mov    %esp,%ebp
+  801654:	56                   	push   %esi
+  801655:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801656:	83 ec 08             	sub    $0x8,%esp
+  801659:	6a 00                	push   $0x0
+  80165b:	ff 75 08             	push   0x8(%ebp)
+  80165e:	e8 e4 01 00 00       	call   801847 <open>
+  801663:	89 c3                	mov    %eax,%ebx
+  801665:	83 c4 10             	add    $0x10,%esp
+  801668:	85 c0                	test   %eax,%eax
+  80166a:	78 1b                	js     801687 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80166c:	83 ec 08             	sub    $0x8,%esp
+  80166f:	ff 75 0c             	push   0xc(%ebp)
+  801672:	50                   	push   %eax
+  801673:	e8 64 ff ff ff       	call   8015dc <fstat>
+  801678:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80167a:	89 1c 24             	mov    %ebx,(%esp)
+  80167d:	e8 26 fc ff ff       	call   8012a8 <close>
+	return r;
+  801682:	83 c4 10             	add    $0x10,%esp
+  801685:	89 f3                	mov    %esi,%ebx
+}
+  801687:	89 d8                	mov    %ebx,%eax
+  801689:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80168c:	5b                   	pop    %ebx
+  80168d:	5e                   	pop    %esi
+  80168e:	5d                   	pop    %ebp
+  80168f:	c3                   	ret
+
+00801690 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  801690:	55                   	push   %ebp
+  801691:	89 e5                	mov    %esp,%ebp
+  801693:	56                   	push   %esi
+  801694:	53                   	push   %ebx
+  801695:	89 c6                	mov    %eax,%esi
+  801697:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  801699:	83 3d 00 44 80 00 00 	cmpl   $0x0,0x804400
+  8016a0:	74 27                	je     8016c9 <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8016a2:	6a 07                	push   $0x7
+  8016a4:	68 00 50 80 00       	push   $0x805000
+  8016a9:	56                   	push   %esi
+  8016aa:	ff 35 00 44 80 00    	push   0x804400
+  8016b0:	e8 71 0b 00 00       	call   802226 <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  8016b5:	83 c4 0c             	add    $0xc,%esp
+  8016b8:	6a 00                	push   $0x0
+  8016ba:	53                   	push   %ebx
+  8016bb:	6a 00                	push   $0x0
+  8016bd:	e8 f0 0a 00 00       	call   8021b2 <ipc_recv>
+}
+  8016c2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016c5:	5b                   	pop    %ebx
+  8016c6:	5e                   	pop    %esi
+  8016c7:	5d                   	pop    %ebp
+  8016c8:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  8016c9:	83 ec 0c             	sub    $0xc,%esp
+  8016cc:	6a 01                	push   $0x1
+  8016ce:	e8 a7 0b 00 00       	call   80227a <ipc_find_env>
+  8016d3:	a3 00 44 80 00       	mov    %eax,0x804400
+  8016d8:	83 c4 10             	add    $0x10,%esp
+  8016db:	eb c5                	jmp    8016a2 <fsipc+0x12>
+
+008016dd <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8016dd:	55                   	push   %ebp
+  8016de:	89 e5                	mov    %esp,%ebp
+  8016e0:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8016e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016e6:	8b 40 0c             	mov    0xc(%eax),%eax
+  8016e9:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.set_size.req_size = newsize;
+  8016ee:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8016f1:	a3 04 50 80 00       	mov    %eax,0x805004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  8016f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016fb:	b8 02 00 00 00       	mov    $0x2,%eax
+  801700:	e8 8b ff ff ff       	call   801690 <fsipc>
+}
+  801705:	c9                   	leave
+  801706:	c3                   	ret
+
+00801707 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801707:	55                   	push   %ebp
+  801708:	89 e5                	mov    %esp,%ebp
+  80170a:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80170d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801710:	8b 40 0c             	mov    0xc(%eax),%eax
+  801713:	a3 00 50 80 00       	mov    %eax,0x805000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801718:	ba 00 00 00 00       	mov    $0x0,%edx
+  80171d:	b8 06 00 00 00       	mov    $0x6,%eax
+  801722:	e8 69 ff ff ff       	call   801690 <fsipc>
+}
+  801727:	c9                   	leave
+  801728:	c3                   	ret
+
+00801729 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801729:	55                   	push   %ebp
+  80172a:	89 e5                	mov    %esp,%ebp
+  80172c:	53                   	push   %ebx
+  80172d:	83 ec 04             	sub    $0x4,%esp
+  801730:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801733:	8b 45 08             	mov    0x8(%ebp),%eax
+  801736:	8b 40 0c             	mov    0xc(%eax),%eax
+  801739:	a3 00 50 80 00       	mov    %eax,0x805000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80173e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801743:	b8 05 00 00 00       	mov    $0x5,%eax
+  801748:	e8 43 ff ff ff       	call   801690 <fsipc>
+  80174d:	85 c0                	test   %eax,%eax
+  80174f:	78 2c                	js     80177d <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801751:	83 ec 08             	sub    $0x8,%esp
+  801754:	68 00 50 80 00       	push   $0x805000
+  801759:	53                   	push   %ebx
+  80175a:	e8 e3 f2 ff ff       	call   800a42 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  80175f:	a1 80 50 80 00       	mov    0x805080,%eax
+  801764:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80176a:	a1 84 50 80 00       	mov    0x805084,%eax
+  80176f:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801775:	83 c4 10             	add    $0x10,%esp
+  801778:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80177d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801780:	c9                   	leave
+  801781:	c3                   	ret
+
+00801782 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801782:	55                   	push   %ebp
+  801783:	89 e5                	mov    %esp,%ebp
+  801785:	83 ec 0c             	sub    $0xc,%esp
+  801788:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80178b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80178e:	8b 52 0c             	mov    0xc(%edx),%edx
+  801791:	89 15 00 50 80 00    	mov    %edx,0x805000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801797:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  80179c:	39 d0                	cmp    %edx,%eax
+  80179e:	0f 47 c2             	cmova  %edx,%eax
+  8017a1:	a3 04 50 80 00       	mov    %eax,0x805004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  8017a6:	50                   	push   %eax
+  8017a7:	ff 75 0c             	push   0xc(%ebp)
+  8017aa:	68 08 50 80 00       	push   $0x805008
+  8017af:	e8 14 f4 ff ff       	call   800bc8 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  8017b4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017b9:	b8 04 00 00 00       	mov    $0x4,%eax
+  8017be:	e8 cd fe ff ff       	call   801690 <fsipc>
+}
+  8017c3:	c9                   	leave
+  8017c4:	c3                   	ret
+
+008017c5 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8017c5:	55                   	push   %ebp
+  8017c6:	89 e5                	mov    %esp,%ebp
+  8017c8:	56                   	push   %esi
+  8017c9:	53                   	push   %ebx
+  8017ca:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8017cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017d0:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017d3:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.read.req_n = n;
+  8017d8:	89 35 04 50 80 00    	mov    %esi,0x805004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8017de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017e3:	b8 03 00 00 00       	mov    $0x3,%eax
+  8017e8:	e8 a3 fe ff ff       	call   801690 <fsipc>
+  8017ed:	89 c3                	mov    %eax,%ebx
+  8017ef:	85 c0                	test   %eax,%eax
+  8017f1:	78 1f                	js     801812 <devfile_read+0x4d>
+  assert(r <= n);
+  8017f3:	39 c6                	cmp    %eax,%esi
+  8017f5:	72 24                	jb     80181b <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  8017f7:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8017fc:	7f 33                	jg     801831 <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8017fe:	83 ec 04             	sub    $0x4,%esp
+  801801:	50                   	push   %eax
+  801802:	68 00 50 80 00       	push   $0x805000
+  801807:	ff 75 0c             	push   0xc(%ebp)
+  80180a:	e8 b9 f3 ff ff       	call   800bc8 <memmove>
+  return r;
+  80180f:	83 c4 10             	add    $0x10,%esp
+}
+  801812:	89 d8                	mov    %ebx,%eax
+  801814:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801817:	5b                   	pop    %ebx
+  801818:	5e                   	pop    %esi
+  801819:	5d                   	pop    %ebp
+  80181a:	c3                   	ret
+  assert(r <= n);
+  80181b:	68 10 2c 80 00       	push   $0x802c10
+  801820:	68 17 2c 80 00       	push   $0x802c17
+  801825:	6a 78                	push   $0x78
+  801827:	68 2c 2c 80 00       	push   $0x802c2c
+  80182c:	e8 8d ea ff ff       	call   8002be <_panic>
+  assert(r <= PGSIZE);
+  801831:	68 37 2c 80 00       	push   $0x802c37
+  801836:	68 17 2c 80 00       	push   $0x802c17
+  80183b:	6a 79                	push   $0x79
+  80183d:	68 2c 2c 80 00       	push   $0x802c2c
+  801842:	e8 77 ea ff ff       	call   8002be <_panic>
+
+00801847 <open>:
+open(const char *path, int mode) {
+  801847:	55                   	push   %ebp
+  801848:	89 e5                	mov    %esp,%ebp
+  80184a:	56                   	push   %esi
+  80184b:	53                   	push   %ebx
+  80184c:	83 ec 1c             	sub    $0x1c,%esp
+  80184f:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801852:	56                   	push   %esi
+  801853:	e8 af f1 ff ff       	call   800a07 <strlen>
+  801858:	83 c4 10             	add    $0x10,%esp
+  80185b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801860:	7f 6c                	jg     8018ce <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801862:	83 ec 0c             	sub    $0xc,%esp
+  801865:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801868:	50                   	push   %eax
+  801869:	e8 ba f8 ff ff       	call   801128 <fd_alloc>
+  80186e:	89 c3                	mov    %eax,%ebx
+  801870:	83 c4 10             	add    $0x10,%esp
+  801873:	85 c0                	test   %eax,%eax
+  801875:	78 3c                	js     8018b3 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801877:	83 ec 08             	sub    $0x8,%esp
+  80187a:	56                   	push   %esi
+  80187b:	68 00 50 80 00       	push   $0x805000
+  801880:	e8 bd f1 ff ff       	call   800a42 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801885:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801888:	a3 00 54 80 00       	mov    %eax,0x805400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80188d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801890:	b8 01 00 00 00       	mov    $0x1,%eax
+  801895:	e8 f6 fd ff ff       	call   801690 <fsipc>
+  80189a:	89 c3                	mov    %eax,%ebx
+  80189c:	83 c4 10             	add    $0x10,%esp
+  80189f:	85 c0                	test   %eax,%eax
+  8018a1:	78 19                	js     8018bc <open+0x75>
+  return fd2num(fd);
+  8018a3:	83 ec 0c             	sub    $0xc,%esp
+  8018a6:	ff 75 f4             	push   -0xc(%ebp)
+  8018a9:	e8 53 f8 ff ff       	call   801101 <fd2num>
+  8018ae:	89 c3                	mov    %eax,%ebx
+  8018b0:	83 c4 10             	add    $0x10,%esp
+}
+  8018b3:	89 d8                	mov    %ebx,%eax
+  8018b5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018b8:	5b                   	pop    %ebx
+  8018b9:	5e                   	pop    %esi
+  8018ba:	5d                   	pop    %ebp
+  8018bb:	c3                   	ret
+    fd_close(fd, 0);
+  8018bc:	83 ec 08             	sub    $0x8,%esp
+  8018bf:	6a 00                	push   $0x0
+  8018c1:	ff 75 f4             	push   -0xc(%ebp)
+  8018c4:	e8 58 f9 ff ff       	call   801221 <fd_close>
+    return r;
+  8018c9:	83 c4 10             	add    $0x10,%esp
+  8018cc:	eb e5                	jmp    8018b3 <open+0x6c>
+    return -E_BAD_PATH;
+  8018ce:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8018d3:	eb de                	jmp    8018b3 <open+0x6c>
+
+008018d5 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  8018d5:	55                   	push   %ebp
+  8018d6:	89 e5                	mov    %esp,%ebp
+  8018d8:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  8018db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018e0:	b8 08 00 00 00       	mov    $0x8,%eax
+  8018e5:	e8 a6 fd ff ff       	call   801690 <fsipc>
+}
+  8018ea:	c9                   	leave
+  8018eb:	c3                   	ret
+
+008018ec <writebuf>:
+
+
+static void
+writebuf(struct printbuf *b)
+{
+	if (b->error > 0) {
+  8018ec:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8018f0:	7f 01                	jg     8018f3 <writebuf+0x7>
+  8018f2:	c3                   	ret
+{
+  8018f3:	55                   	push   %ebp
+  8018f4:	89 e5                	mov    %esp,%ebp
+  8018f6:	53                   	push   %ebx
+  8018f7:	83 ec 08             	sub    $0x8,%esp
+  8018fa:	89 c3                	mov    %eax,%ebx
+		ssize_t result = write(b->fd, b->buf, b->idx);
+  8018fc:	ff 70 04             	push   0x4(%eax)
+  8018ff:	8d 40 10             	lea    0x10(%eax),%eax
+  801902:	50                   	push   %eax
+  801903:	ff 33                	push   (%ebx)
+  801905:	e8 a8 fb ff ff       	call   8014b2 <write>
+		if (result > 0)
+  80190a:	83 c4 10             	add    $0x10,%esp
+  80190d:	85 c0                	test   %eax,%eax
+  80190f:	7e 03                	jle    801914 <writebuf+0x28>
+			b->result += result;
+  801911:	01 43 08             	add    %eax,0x8(%ebx)
+		if (result != b->idx) // error, or wrote less than supplied
+  801914:	39 43 04             	cmp    %eax,0x4(%ebx)
+  801917:	74 0d                	je     801926 <writebuf+0x3a>
+			b->error = (result < 0 ? result : 0);
+  801919:	85 c0                	test   %eax,%eax
+  80191b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801920:	0f 4f c2             	cmovg  %edx,%eax
+  801923:	89 43 0c             	mov    %eax,0xc(%ebx)
+	}
+}
+  801926:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801929:	c9                   	leave
+  80192a:	c3                   	ret
+
+0080192b <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  80192b:	55                   	push   %ebp
+  80192c:	89 e5                	mov    %esp,%ebp
+  80192e:	53                   	push   %ebx
+  80192f:	83 ec 04             	sub    $0x4,%esp
+  801932:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct printbuf *b = (struct printbuf *) thunk;
+	b->buf[b->idx++] = ch;
+  801935:	8b 53 04             	mov    0x4(%ebx),%edx
+  801938:	8d 42 01             	lea    0x1(%edx),%eax
+  80193b:	89 43 04             	mov    %eax,0x4(%ebx)
+  80193e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801941:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+	if (b->idx == 256) {
+  801945:	3d 00 01 00 00       	cmp    $0x100,%eax
+  80194a:	74 05                	je     801951 <putch+0x26>
+		writebuf(b);
+		b->idx = 0;
+	}
+}
+  80194c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80194f:	c9                   	leave
+  801950:	c3                   	ret
+		writebuf(b);
+  801951:	89 d8                	mov    %ebx,%eax
+  801953:	e8 94 ff ff ff       	call   8018ec <writebuf>
+		b->idx = 0;
+  801958:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+  80195f:	eb eb                	jmp    80194c <putch+0x21>
+
+00801961 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  801961:	55                   	push   %ebp
+  801962:	89 e5                	mov    %esp,%ebp
+  801964:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.fd = fd;
+  80196a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80196d:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+	b.idx = 0;
+  801973:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  80197a:	00 00 00 
+	b.result = 0;
+  80197d:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  801984:	00 00 00 
+	b.error = 1;
+  801987:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  80198e:	00 00 00 
+	vprintfmt(putch, &b, fmt, ap);
+  801991:	ff 75 10             	push   0x10(%ebp)
+  801994:	ff 75 0c             	push   0xc(%ebp)
+  801997:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  80199d:	50                   	push   %eax
+  80199e:	68 2b 19 80 00       	push   $0x80192b
+  8019a3:	e8 e8 ea ff ff       	call   800490 <vprintfmt>
+	if (b.idx > 0)
+  8019a8:	83 c4 10             	add    $0x10,%esp
+  8019ab:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  8019b2:	7f 12                	jg     8019c6 <vfprintf+0x65>
+		writebuf(&b);
+
+	return (b.result ? b.result : b.error);
+  8019b4:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  8019ba:	85 c0                	test   %eax,%eax
+  8019bc:	75 06                	jne    8019c4 <vfprintf+0x63>
+  8019be:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  8019c4:	c9                   	leave
+  8019c5:	c3                   	ret
+		writebuf(&b);
+  8019c6:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  8019cc:	e8 1b ff ff ff       	call   8018ec <writebuf>
+  8019d1:	eb e1                	jmp    8019b4 <vfprintf+0x53>
+
+008019d3 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  8019d3:	55                   	push   %ebp
+  8019d4:	89 e5                	mov    %esp,%ebp
+  8019d6:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8019d9:	8d 45 10             	lea    0x10(%ebp),%eax
+	cnt = vfprintf(fd, fmt, ap);
+  8019dc:	50                   	push   %eax
+  8019dd:	ff 75 0c             	push   0xc(%ebp)
+  8019e0:	ff 75 08             	push   0x8(%ebp)
+  8019e3:	e8 79 ff ff ff       	call   801961 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8019e8:	c9                   	leave
+  8019e9:	c3                   	ret
+
+008019ea <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  8019ea:	55                   	push   %ebp
+  8019eb:	89 e5                	mov    %esp,%ebp
+  8019ed:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8019f0:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vfprintf(1, fmt, ap);
+  8019f3:	50                   	push   %eax
+  8019f4:	ff 75 08             	push   0x8(%ebp)
+  8019f7:	6a 01                	push   $0x1
+  8019f9:	e8 63 ff ff ff       	call   801961 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8019fe:	c9                   	leave
+  8019ff:	c3                   	ret
+
+00801a00 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801a00:	55                   	push   %ebp
+  801a01:	89 e5                	mov    %esp,%ebp
+  801a03:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801a06:	68 43 2c 80 00       	push   $0x802c43
+  801a0b:	ff 75 0c             	push   0xc(%ebp)
+  801a0e:	e8 2f f0 ff ff       	call   800a42 <strcpy>
+	return 0;
+}
+  801a13:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a18:	c9                   	leave
+  801a19:	c3                   	ret
+
+00801a1a <devsock_close>:
+{
+  801a1a:	55                   	push   %ebp
+  801a1b:	89 e5                	mov    %esp,%ebp
+  801a1d:	53                   	push   %ebx
+  801a1e:	83 ec 10             	sub    $0x10,%esp
+  801a21:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801a24:	53                   	push   %ebx
+  801a25:	e8 8f 08 00 00       	call   8022b9 <pageref>
+  801a2a:	89 c2                	mov    %eax,%edx
+  801a2c:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801a2f:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801a34:	83 fa 01             	cmp    $0x1,%edx
+  801a37:	74 05                	je     801a3e <devsock_close+0x24>
+}
+  801a39:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a3c:	c9                   	leave
+  801a3d:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801a3e:	83 ec 0c             	sub    $0xc,%esp
+  801a41:	ff 73 0c             	push   0xc(%ebx)
+  801a44:	e8 b7 02 00 00       	call   801d00 <nsipc_close>
+  801a49:	83 c4 10             	add    $0x10,%esp
+  801a4c:	eb eb                	jmp    801a39 <devsock_close+0x1f>
+
+00801a4e <devsock_write>:
+{
+  801a4e:	55                   	push   %ebp
+  801a4f:	89 e5                	mov    %esp,%ebp
+  801a51:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801a54:	6a 00                	push   $0x0
+  801a56:	ff 75 10             	push   0x10(%ebp)
+  801a59:	ff 75 0c             	push   0xc(%ebp)
+  801a5c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a5f:	ff 70 0c             	push   0xc(%eax)
+  801a62:	e8 79 03 00 00       	call   801de0 <nsipc_send>
+}
+  801a67:	c9                   	leave
+  801a68:	c3                   	ret
+
+00801a69 <devsock_read>:
+{
+  801a69:	55                   	push   %ebp
+  801a6a:	89 e5                	mov    %esp,%ebp
+  801a6c:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801a6f:	6a 00                	push   $0x0
+  801a71:	ff 75 10             	push   0x10(%ebp)
+  801a74:	ff 75 0c             	push   0xc(%ebp)
+  801a77:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a7a:	ff 70 0c             	push   0xc(%eax)
+  801a7d:	e8 ef 02 00 00       	call   801d71 <nsipc_recv>
+}
+  801a82:	c9                   	leave
+  801a83:	c3                   	ret
+
+00801a84 <fd2sockid>:
+{
+  801a84:	55                   	push   %ebp
+  801a85:	89 e5                	mov    %esp,%ebp
+  801a87:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801a8a:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801a8d:	52                   	push   %edx
+  801a8e:	50                   	push   %eax
+  801a8f:	e8 ea f6 ff ff       	call   80117e <fd_lookup>
+  801a94:	83 c4 10             	add    $0x10,%esp
+  801a97:	85 c0                	test   %eax,%eax
+  801a99:	78 10                	js     801aab <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801a9b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a9e:	8b 0d 3c 30 80 00    	mov    0x80303c,%ecx
+  801aa4:	39 08                	cmp    %ecx,(%eax)
+  801aa6:	75 05                	jne    801aad <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801aa8:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801aab:	c9                   	leave
+  801aac:	c3                   	ret
+		return -E_NOT_SUPP;
+  801aad:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ab2:	eb f7                	jmp    801aab <fd2sockid+0x27>
+
+00801ab4 <alloc_sockfd>:
+{
+  801ab4:	55                   	push   %ebp
+  801ab5:	89 e5                	mov    %esp,%ebp
+  801ab7:	56                   	push   %esi
+  801ab8:	53                   	push   %ebx
+  801ab9:	83 ec 1c             	sub    $0x1c,%esp
+  801abc:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801abe:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ac1:	50                   	push   %eax
+  801ac2:	e8 61 f6 ff ff       	call   801128 <fd_alloc>
+  801ac7:	89 c3                	mov    %eax,%ebx
+  801ac9:	83 c4 10             	add    $0x10,%esp
+  801acc:	85 c0                	test   %eax,%eax
+  801ace:	78 43                	js     801b13 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801ad0:	83 ec 04             	sub    $0x4,%esp
+  801ad3:	68 07 04 00 00       	push   $0x407
+  801ad8:	ff 75 f4             	push   -0xc(%ebp)
+  801adb:	6a 00                	push   $0x0
+  801add:	e8 4c f3 ff ff       	call   800e2e <sys_page_alloc>
+  801ae2:	89 c3                	mov    %eax,%ebx
+  801ae4:	83 c4 10             	add    $0x10,%esp
+  801ae7:	85 c0                	test   %eax,%eax
+  801ae9:	78 28                	js     801b13 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801aeb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801aee:	8b 15 3c 30 80 00    	mov    0x80303c,%edx
+  801af4:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801af6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801af9:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801b00:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801b03:	83 ec 0c             	sub    $0xc,%esp
+  801b06:	50                   	push   %eax
+  801b07:	e8 f5 f5 ff ff       	call   801101 <fd2num>
+  801b0c:	89 c3                	mov    %eax,%ebx
+  801b0e:	83 c4 10             	add    $0x10,%esp
+  801b11:	eb 0c                	jmp    801b1f <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801b13:	83 ec 0c             	sub    $0xc,%esp
+  801b16:	56                   	push   %esi
+  801b17:	e8 e4 01 00 00       	call   801d00 <nsipc_close>
+		return r;
+  801b1c:	83 c4 10             	add    $0x10,%esp
+}
+  801b1f:	89 d8                	mov    %ebx,%eax
+  801b21:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b24:	5b                   	pop    %ebx
+  801b25:	5e                   	pop    %esi
+  801b26:	5d                   	pop    %ebp
+  801b27:	c3                   	ret
+
+00801b28 <accept>:
+{
+  801b28:	55                   	push   %ebp
+  801b29:	89 e5                	mov    %esp,%ebp
+  801b2b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801b2e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b31:	e8 4e ff ff ff       	call   801a84 <fd2sockid>
+  801b36:	85 c0                	test   %eax,%eax
+  801b38:	78 1b                	js     801b55 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801b3a:	83 ec 04             	sub    $0x4,%esp
+  801b3d:	ff 75 10             	push   0x10(%ebp)
+  801b40:	ff 75 0c             	push   0xc(%ebp)
+  801b43:	50                   	push   %eax
+  801b44:	e8 0e 01 00 00       	call   801c57 <nsipc_accept>
+  801b49:	83 c4 10             	add    $0x10,%esp
+  801b4c:	85 c0                	test   %eax,%eax
+  801b4e:	78 05                	js     801b55 <accept+0x2d>
+	return alloc_sockfd(r);
+  801b50:	e8 5f ff ff ff       	call   801ab4 <alloc_sockfd>
+}
+  801b55:	c9                   	leave
+  801b56:	c3                   	ret
+
+00801b57 <bind>:
+{
+  801b57:	55                   	push   %ebp
+  801b58:	89 e5                	mov    %esp,%ebp
+  801b5a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801b5d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b60:	e8 1f ff ff ff       	call   801a84 <fd2sockid>
+  801b65:	85 c0                	test   %eax,%eax
+  801b67:	78 12                	js     801b7b <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801b69:	83 ec 04             	sub    $0x4,%esp
+  801b6c:	ff 75 10             	push   0x10(%ebp)
+  801b6f:	ff 75 0c             	push   0xc(%ebp)
+  801b72:	50                   	push   %eax
+  801b73:	e8 31 01 00 00       	call   801ca9 <nsipc_bind>
+  801b78:	83 c4 10             	add    $0x10,%esp
+}
+  801b7b:	c9                   	leave
+  801b7c:	c3                   	ret
+
+00801b7d <shutdown>:
+{
+  801b7d:	55                   	push   %ebp
+  801b7e:	89 e5                	mov    %esp,%ebp
+  801b80:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801b83:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b86:	e8 f9 fe ff ff       	call   801a84 <fd2sockid>
+  801b8b:	85 c0                	test   %eax,%eax
+  801b8d:	78 0f                	js     801b9e <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801b8f:	83 ec 08             	sub    $0x8,%esp
+  801b92:	ff 75 0c             	push   0xc(%ebp)
+  801b95:	50                   	push   %eax
+  801b96:	e8 43 01 00 00       	call   801cde <nsipc_shutdown>
+  801b9b:	83 c4 10             	add    $0x10,%esp
+}
+  801b9e:	c9                   	leave
+  801b9f:	c3                   	ret
+
+00801ba0 <connect>:
+{
+  801ba0:	55                   	push   %ebp
+  801ba1:	89 e5                	mov    %esp,%ebp
+  801ba3:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801ba6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ba9:	e8 d6 fe ff ff       	call   801a84 <fd2sockid>
+  801bae:	85 c0                	test   %eax,%eax
+  801bb0:	78 12                	js     801bc4 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801bb2:	83 ec 04             	sub    $0x4,%esp
+  801bb5:	ff 75 10             	push   0x10(%ebp)
+  801bb8:	ff 75 0c             	push   0xc(%ebp)
+  801bbb:	50                   	push   %eax
+  801bbc:	e8 59 01 00 00       	call   801d1a <nsipc_connect>
+  801bc1:	83 c4 10             	add    $0x10,%esp
+}
+  801bc4:	c9                   	leave
+  801bc5:	c3                   	ret
+
+00801bc6 <listen>:
+{
+  801bc6:	55                   	push   %ebp
+  801bc7:	89 e5                	mov    %esp,%ebp
+  801bc9:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801bcc:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bcf:	e8 b0 fe ff ff       	call   801a84 <fd2sockid>
+  801bd4:	85 c0                	test   %eax,%eax
+  801bd6:	78 0f                	js     801be7 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801bd8:	83 ec 08             	sub    $0x8,%esp
+  801bdb:	ff 75 0c             	push   0xc(%ebp)
+  801bde:	50                   	push   %eax
+  801bdf:	e8 6b 01 00 00       	call   801d4f <nsipc_listen>
+  801be4:	83 c4 10             	add    $0x10,%esp
+}
+  801be7:	c9                   	leave
+  801be8:	c3                   	ret
+
+00801be9 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801be9:	55                   	push   %ebp
+  801bea:	89 e5                	mov    %esp,%ebp
+  801bec:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801bef:	ff 75 10             	push   0x10(%ebp)
+  801bf2:	ff 75 0c             	push   0xc(%ebp)
+  801bf5:	ff 75 08             	push   0x8(%ebp)
+  801bf8:	e8 41 02 00 00       	call   801e3e <nsipc_socket>
+  801bfd:	83 c4 10             	add    $0x10,%esp
+  801c00:	85 c0                	test   %eax,%eax
+  801c02:	78 05                	js     801c09 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801c04:	e8 ab fe ff ff       	call   801ab4 <alloc_sockfd>
+}
+  801c09:	c9                   	leave
+  801c0a:	c3                   	ret
+
+00801c0b <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801c0b:	55                   	push   %ebp
+  801c0c:	89 e5                	mov    %esp,%ebp
+  801c0e:	53                   	push   %ebx
+  801c0f:	83 ec 04             	sub    $0x4,%esp
+  801c12:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801c14:	83 3d 04 44 80 00 00 	cmpl   $0x0,0x804404
+  801c1b:	74 26                	je     801c43 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801c1d:	6a 07                	push   $0x7
+  801c1f:	68 00 60 80 00       	push   $0x806000
+  801c24:	53                   	push   %ebx
+  801c25:	ff 35 04 44 80 00    	push   0x804404
+  801c2b:	e8 f6 05 00 00       	call   802226 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801c30:	83 c4 0c             	add    $0xc,%esp
+  801c33:	6a 00                	push   $0x0
+  801c35:	6a 00                	push   $0x0
+  801c37:	6a 00                	push   $0x0
+  801c39:	e8 74 05 00 00       	call   8021b2 <ipc_recv>
+}
+  801c3e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c41:	c9                   	leave
+  801c42:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801c43:	83 ec 0c             	sub    $0xc,%esp
+  801c46:	6a 02                	push   $0x2
+  801c48:	e8 2d 06 00 00       	call   80227a <ipc_find_env>
+  801c4d:	a3 04 44 80 00       	mov    %eax,0x804404
+  801c52:	83 c4 10             	add    $0x10,%esp
+  801c55:	eb c6                	jmp    801c1d <nsipc+0x12>
+
+00801c57 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801c57:	55                   	push   %ebp
+  801c58:	89 e5                	mov    %esp,%ebp
+  801c5a:	56                   	push   %esi
+  801c5b:	53                   	push   %ebx
+  801c5c:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801c5f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c62:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801c67:	8b 06                	mov    (%esi),%eax
+  801c69:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801c6e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801c73:	e8 93 ff ff ff       	call   801c0b <nsipc>
+  801c78:	89 c3                	mov    %eax,%ebx
+  801c7a:	85 c0                	test   %eax,%eax
+  801c7c:	79 09                	jns    801c87 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801c7e:	89 d8                	mov    %ebx,%eax
+  801c80:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c83:	5b                   	pop    %ebx
+  801c84:	5e                   	pop    %esi
+  801c85:	5d                   	pop    %ebp
+  801c86:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801c87:	83 ec 04             	sub    $0x4,%esp
+  801c8a:	ff 35 10 60 80 00    	push   0x806010
+  801c90:	68 00 60 80 00       	push   $0x806000
+  801c95:	ff 75 0c             	push   0xc(%ebp)
+  801c98:	e8 2b ef ff ff       	call   800bc8 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801c9d:	a1 10 60 80 00       	mov    0x806010,%eax
+  801ca2:	89 06                	mov    %eax,(%esi)
+  801ca4:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801ca7:	eb d5                	jmp    801c7e <nsipc_accept+0x27>
+
+00801ca9 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801ca9:	55                   	push   %ebp
+  801caa:	89 e5                	mov    %esp,%ebp
+  801cac:	53                   	push   %ebx
+  801cad:	83 ec 08             	sub    $0x8,%esp
+  801cb0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801cb3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cb6:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801cbb:	53                   	push   %ebx
+  801cbc:	ff 75 0c             	push   0xc(%ebp)
+  801cbf:	68 04 60 80 00       	push   $0x806004
+  801cc4:	e8 ff ee ff ff       	call   800bc8 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801cc9:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  801ccf:	b8 02 00 00 00       	mov    $0x2,%eax
+  801cd4:	e8 32 ff ff ff       	call   801c0b <nsipc>
+}
+  801cd9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cdc:	c9                   	leave
+  801cdd:	c3                   	ret
+
+00801cde <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801cde:	55                   	push   %ebp
+  801cdf:	89 e5                	mov    %esp,%ebp
+  801ce1:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801ce4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ce7:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  801cec:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801cef:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  801cf4:	b8 03 00 00 00       	mov    $0x3,%eax
+  801cf9:	e8 0d ff ff ff       	call   801c0b <nsipc>
+}
+  801cfe:	c9                   	leave
+  801cff:	c3                   	ret
+
+00801d00 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801d00:	55                   	push   %ebp
+  801d01:	89 e5                	mov    %esp,%ebp
+  801d03:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801d06:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d09:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  801d0e:	b8 04 00 00 00       	mov    $0x4,%eax
+  801d13:	e8 f3 fe ff ff       	call   801c0b <nsipc>
+}
+  801d18:	c9                   	leave
+  801d19:	c3                   	ret
+
+00801d1a <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801d1a:	55                   	push   %ebp
+  801d1b:	89 e5                	mov    %esp,%ebp
+  801d1d:	53                   	push   %ebx
+  801d1e:	83 ec 08             	sub    $0x8,%esp
+  801d21:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801d24:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d27:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801d2c:	53                   	push   %ebx
+  801d2d:	ff 75 0c             	push   0xc(%ebp)
+  801d30:	68 04 60 80 00       	push   $0x806004
+  801d35:	e8 8e ee ff ff       	call   800bc8 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801d3a:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  801d40:	b8 05 00 00 00       	mov    $0x5,%eax
+  801d45:	e8 c1 fe ff ff       	call   801c0b <nsipc>
+}
+  801d4a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d4d:	c9                   	leave
+  801d4e:	c3                   	ret
+
+00801d4f <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801d4f:	55                   	push   %ebp
+  801d50:	89 e5                	mov    %esp,%ebp
+  801d52:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801d55:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d58:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  801d5d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d60:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  801d65:	b8 06 00 00 00       	mov    $0x6,%eax
+  801d6a:	e8 9c fe ff ff       	call   801c0b <nsipc>
+}
+  801d6f:	c9                   	leave
+  801d70:	c3                   	ret
+
+00801d71 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801d71:	55                   	push   %ebp
+  801d72:	89 e5                	mov    %esp,%ebp
+  801d74:	56                   	push   %esi
+  801d75:	53                   	push   %ebx
+  801d76:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801d79:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d7c:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  801d81:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  801d87:	8b 45 14             	mov    0x14(%ebp),%eax
+  801d8a:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801d8f:	b8 07 00 00 00       	mov    $0x7,%eax
+  801d94:	e8 72 fe ff ff       	call   801c0b <nsipc>
+  801d99:	89 c3                	mov    %eax,%ebx
+  801d9b:	85 c0                	test   %eax,%eax
+  801d9d:	78 22                	js     801dc1 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801d9f:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801da4:	39 c6                	cmp    %eax,%esi
+  801da6:	0f 4e c6             	cmovle %esi,%eax
+  801da9:	39 c3                	cmp    %eax,%ebx
+  801dab:	7f 1d                	jg     801dca <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801dad:	83 ec 04             	sub    $0x4,%esp
+  801db0:	53                   	push   %ebx
+  801db1:	68 00 60 80 00       	push   $0x806000
+  801db6:	ff 75 0c             	push   0xc(%ebp)
+  801db9:	e8 0a ee ff ff       	call   800bc8 <memmove>
+  801dbe:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801dc1:	89 d8                	mov    %ebx,%eax
+  801dc3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dc6:	5b                   	pop    %ebx
+  801dc7:	5e                   	pop    %esi
+  801dc8:	5d                   	pop    %ebp
+  801dc9:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801dca:	68 4f 2c 80 00       	push   $0x802c4f
+  801dcf:	68 17 2c 80 00       	push   $0x802c17
+  801dd4:	6a 62                	push   $0x62
+  801dd6:	68 64 2c 80 00       	push   $0x802c64
+  801ddb:	e8 de e4 ff ff       	call   8002be <_panic>
+
+00801de0 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801de0:	55                   	push   %ebp
+  801de1:	89 e5                	mov    %esp,%ebp
+  801de3:	53                   	push   %ebx
+  801de4:	83 ec 04             	sub    $0x4,%esp
+  801de7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801dea:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ded:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  801df2:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801df8:	7f 2e                	jg     801e28 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801dfa:	83 ec 04             	sub    $0x4,%esp
+  801dfd:	53                   	push   %ebx
+  801dfe:	ff 75 0c             	push   0xc(%ebp)
+  801e01:	68 0c 60 80 00       	push   $0x80600c
+  801e06:	e8 bd ed ff ff       	call   800bc8 <memmove>
+	nsipcbuf.send.req_size = size;
+  801e0b:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  801e11:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e14:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  801e19:	b8 08 00 00 00       	mov    $0x8,%eax
+  801e1e:	e8 e8 fd ff ff       	call   801c0b <nsipc>
+}
+  801e23:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e26:	c9                   	leave
+  801e27:	c3                   	ret
+	assert(size < 1600);
+  801e28:	68 70 2c 80 00       	push   $0x802c70
+  801e2d:	68 17 2c 80 00       	push   $0x802c17
+  801e32:	6a 6d                	push   $0x6d
+  801e34:	68 64 2c 80 00       	push   $0x802c64
+  801e39:	e8 80 e4 ff ff       	call   8002be <_panic>
+
+00801e3e <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801e3e:	55                   	push   %ebp
+  801e3f:	89 e5                	mov    %esp,%ebp
+  801e41:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801e44:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e47:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  801e4c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e4f:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  801e54:	8b 45 10             	mov    0x10(%ebp),%eax
+  801e57:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  801e5c:	b8 09 00 00 00       	mov    $0x9,%eax
+  801e61:	e8 a5 fd ff ff       	call   801c0b <nsipc>
+}
+  801e66:	c9                   	leave
+  801e67:	c3                   	ret
+
+00801e68 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801e68:	55                   	push   %ebp
+  801e69:	89 e5                	mov    %esp,%ebp
+  801e6b:	56                   	push   %esi
+  801e6c:	53                   	push   %ebx
+  801e6d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801e70:	83 ec 0c             	sub    $0xc,%esp
+  801e73:	ff 75 08             	push   0x8(%ebp)
+  801e76:	e8 96 f2 ff ff       	call   801111 <fd2data>
+  801e7b:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801e7d:	83 c4 08             	add    $0x8,%esp
+  801e80:	68 7c 2c 80 00       	push   $0x802c7c
+  801e85:	53                   	push   %ebx
+  801e86:	e8 b7 eb ff ff       	call   800a42 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801e8b:	8b 46 04             	mov    0x4(%esi),%eax
+  801e8e:	2b 06                	sub    (%esi),%eax
+  801e90:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  801e96:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801e9d:	00 00 00 
+	stat->st_dev = &devpipe;
+  801ea0:	c7 83 88 00 00 00 58 	movl   $0x803058,0x88(%ebx)
+  801ea7:	30 80 00 
+	return 0;
+}
+  801eaa:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eaf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801eb2:	5b                   	pop    %ebx
+  801eb3:	5e                   	pop    %esi
+  801eb4:	5d                   	pop    %ebp
+  801eb5:	c3                   	ret
+
+00801eb6 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801eb6:	55                   	push   %ebp
+  801eb7:	89 e5                	mov    %esp,%ebp
+  801eb9:	53                   	push   %ebx
+  801eba:	83 ec 0c             	sub    $0xc,%esp
+  801ebd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801ec0:	53                   	push   %ebx
+  801ec1:	6a 00                	push   $0x0
+  801ec3:	e8 eb ef ff ff       	call   800eb3 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801ec8:	89 1c 24             	mov    %ebx,(%esp)
+  801ecb:	e8 41 f2 ff ff       	call   801111 <fd2data>
+  801ed0:	83 c4 08             	add    $0x8,%esp
+  801ed3:	50                   	push   %eax
+  801ed4:	6a 00                	push   $0x0
+  801ed6:	e8 d8 ef ff ff       	call   800eb3 <sys_page_unmap>
+}
+  801edb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ede:	c9                   	leave
+  801edf:	c3                   	ret
+
+00801ee0 <_pipeisclosed>:
+{
+  801ee0:	55                   	push   %ebp
+  801ee1:	89 e5                	mov    %esp,%ebp
+  801ee3:	57                   	push   %edi
+  801ee4:	56                   	push   %esi
+  801ee5:	53                   	push   %ebx
+  801ee6:	83 ec 1c             	sub    $0x1c,%esp
+  801ee9:	89 c7                	mov    %eax,%edi
+  801eeb:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801eed:	a1 08 44 80 00       	mov    0x804408,%eax
+  801ef2:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801ef5:	83 ec 0c             	sub    $0xc,%esp
+  801ef8:	57                   	push   %edi
+  801ef9:	e8 bb 03 00 00       	call   8022b9 <pageref>
+  801efe:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801f01:	89 34 24             	mov    %esi,(%esp)
+  801f04:	e8 b0 03 00 00       	call   8022b9 <pageref>
+		nn = thisenv->env_runs;
+  801f09:	8b 15 08 44 80 00    	mov    0x804408,%edx
+  801f0f:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801f12:	83 c4 10             	add    $0x10,%esp
+  801f15:	39 cb                	cmp    %ecx,%ebx
+  801f17:	74 1b                	je     801f34 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801f19:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801f1c:	75 cf                	jne    801eed <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801f1e:	8b 42 58             	mov    0x58(%edx),%eax
+  801f21:	6a 01                	push   $0x1
+  801f23:	50                   	push   %eax
+  801f24:	53                   	push   %ebx
+  801f25:	68 83 2c 80 00       	push   $0x802c83
+  801f2a:	e8 6a e4 ff ff       	call   800399 <cprintf>
+  801f2f:	83 c4 10             	add    $0x10,%esp
+  801f32:	eb b9                	jmp    801eed <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801f34:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801f37:	0f 94 c0             	sete   %al
+  801f3a:	0f b6 c0             	movzbl %al,%eax
+}
+  801f3d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f40:	5b                   	pop    %ebx
+  801f41:	5e                   	pop    %esi
+  801f42:	5f                   	pop    %edi
+  801f43:	5d                   	pop    %ebp
+  801f44:	c3                   	ret
+
+00801f45 <devpipe_write>:
+{
+  801f45:	55                   	push   %ebp
+  801f46:	89 e5                	mov    %esp,%ebp
+  801f48:	57                   	push   %edi
+  801f49:	56                   	push   %esi
+  801f4a:	53                   	push   %ebx
+  801f4b:	83 ec 28             	sub    $0x28,%esp
+  801f4e:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801f51:	56                   	push   %esi
+  801f52:	e8 ba f1 ff ff       	call   801111 <fd2data>
+  801f57:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801f59:	83 c4 10             	add    $0x10,%esp
+  801f5c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f61:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801f64:	75 09                	jne    801f6f <devpipe_write+0x2a>
+	return i;
+  801f66:	89 f8                	mov    %edi,%eax
+  801f68:	eb 23                	jmp    801f8d <devpipe_write+0x48>
+			sys_yield();
+  801f6a:	e8 a0 ee ff ff       	call   800e0f <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801f6f:	8b 43 04             	mov    0x4(%ebx),%eax
+  801f72:	8b 0b                	mov    (%ebx),%ecx
+  801f74:	8d 51 20             	lea    0x20(%ecx),%edx
+  801f77:	39 d0                	cmp    %edx,%eax
+  801f79:	72 1a                	jb     801f95 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  801f7b:	89 da                	mov    %ebx,%edx
+  801f7d:	89 f0                	mov    %esi,%eax
+  801f7f:	e8 5c ff ff ff       	call   801ee0 <_pipeisclosed>
+  801f84:	85 c0                	test   %eax,%eax
+  801f86:	74 e2                	je     801f6a <devpipe_write+0x25>
+				return 0;
+  801f88:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f8d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f90:	5b                   	pop    %ebx
+  801f91:	5e                   	pop    %esi
+  801f92:	5f                   	pop    %edi
+  801f93:	5d                   	pop    %ebp
+  801f94:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801f95:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f98:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801f9c:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801f9f:	89 c2                	mov    %eax,%edx
+  801fa1:	c1 fa 1f             	sar    $0x1f,%edx
+  801fa4:	89 d1                	mov    %edx,%ecx
+  801fa6:	c1 e9 1b             	shr    $0x1b,%ecx
+  801fa9:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801fac:	83 e2 1f             	and    $0x1f,%edx
+  801faf:	29 ca                	sub    %ecx,%edx
+  801fb1:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801fb5:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  801fb9:	83 c0 01             	add    $0x1,%eax
+  801fbc:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  801fbf:	83 c7 01             	add    $0x1,%edi
+  801fc2:	eb 9d                	jmp    801f61 <devpipe_write+0x1c>
+
+00801fc4 <devpipe_read>:
+{
+  801fc4:	55                   	push   %ebp
+  801fc5:	89 e5                	mov    %esp,%ebp
+  801fc7:	57                   	push   %edi
+  801fc8:	56                   	push   %esi
+  801fc9:	53                   	push   %ebx
+  801fca:	83 ec 18             	sub    $0x18,%esp
+  801fcd:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  801fd0:	57                   	push   %edi
+  801fd1:	e8 3b f1 ff ff       	call   801111 <fd2data>
+  801fd6:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801fd8:	83 c4 10             	add    $0x10,%esp
+  801fdb:	be 00 00 00 00       	mov    $0x0,%esi
+  801fe0:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801fe3:	75 13                	jne    801ff8 <devpipe_read+0x34>
+	return i;
+  801fe5:	89 f0                	mov    %esi,%eax
+  801fe7:	eb 02                	jmp    801feb <devpipe_read+0x27>
+				return i;
+  801fe9:	89 f0                	mov    %esi,%eax
+}
+  801feb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fee:	5b                   	pop    %ebx
+  801fef:	5e                   	pop    %esi
+  801ff0:	5f                   	pop    %edi
+  801ff1:	5d                   	pop    %ebp
+  801ff2:	c3                   	ret
+			sys_yield();
+  801ff3:	e8 17 ee ff ff       	call   800e0f <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  801ff8:	8b 03                	mov    (%ebx),%eax
+  801ffa:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801ffd:	75 18                	jne    802017 <devpipe_read+0x53>
+			if (i > 0)
+  801fff:	85 f6                	test   %esi,%esi
+  802001:	75 e6                	jne    801fe9 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802003:	89 da                	mov    %ebx,%edx
+  802005:	89 f8                	mov    %edi,%eax
+  802007:	e8 d4 fe ff ff       	call   801ee0 <_pipeisclosed>
+  80200c:	85 c0                	test   %eax,%eax
+  80200e:	74 e3                	je     801ff3 <devpipe_read+0x2f>
+				return 0;
+  802010:	b8 00 00 00 00       	mov    $0x0,%eax
+  802015:	eb d4                	jmp    801feb <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802017:	99                   	cltd
+  802018:	c1 ea 1b             	shr    $0x1b,%edx
+  80201b:	01 d0                	add    %edx,%eax
+  80201d:	83 e0 1f             	and    $0x1f,%eax
+  802020:	29 d0                	sub    %edx,%eax
+  802022:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802027:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80202a:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80202d:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802030:	83 c6 01             	add    $0x1,%esi
+  802033:	eb ab                	jmp    801fe0 <devpipe_read+0x1c>
+
+00802035 <pipe>:
+{
+  802035:	55                   	push   %ebp
+  802036:	89 e5                	mov    %esp,%ebp
+  802038:	56                   	push   %esi
+  802039:	53                   	push   %ebx
+  80203a:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80203d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802040:	50                   	push   %eax
+  802041:	e8 e2 f0 ff ff       	call   801128 <fd_alloc>
+  802046:	89 c3                	mov    %eax,%ebx
+  802048:	83 c4 10             	add    $0x10,%esp
+  80204b:	85 c0                	test   %eax,%eax
+  80204d:	0f 88 23 01 00 00    	js     802176 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802053:	83 ec 04             	sub    $0x4,%esp
+  802056:	68 07 04 00 00       	push   $0x407
+  80205b:	ff 75 f4             	push   -0xc(%ebp)
+  80205e:	6a 00                	push   $0x0
+  802060:	e8 c9 ed ff ff       	call   800e2e <sys_page_alloc>
+  802065:	89 c3                	mov    %eax,%ebx
+  802067:	83 c4 10             	add    $0x10,%esp
+  80206a:	85 c0                	test   %eax,%eax
+  80206c:	0f 88 04 01 00 00    	js     802176 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802072:	83 ec 0c             	sub    $0xc,%esp
+  802075:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802078:	50                   	push   %eax
+  802079:	e8 aa f0 ff ff       	call   801128 <fd_alloc>
+  80207e:	89 c3                	mov    %eax,%ebx
+  802080:	83 c4 10             	add    $0x10,%esp
+  802083:	85 c0                	test   %eax,%eax
+  802085:	0f 88 db 00 00 00    	js     802166 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80208b:	83 ec 04             	sub    $0x4,%esp
+  80208e:	68 07 04 00 00       	push   $0x407
+  802093:	ff 75 f0             	push   -0x10(%ebp)
+  802096:	6a 00                	push   $0x0
+  802098:	e8 91 ed ff ff       	call   800e2e <sys_page_alloc>
+  80209d:	89 c3                	mov    %eax,%ebx
+  80209f:	83 c4 10             	add    $0x10,%esp
+  8020a2:	85 c0                	test   %eax,%eax
+  8020a4:	0f 88 bc 00 00 00    	js     802166 <pipe+0x131>
+	va = fd2data(fd0);
+  8020aa:	83 ec 0c             	sub    $0xc,%esp
+  8020ad:	ff 75 f4             	push   -0xc(%ebp)
+  8020b0:	e8 5c f0 ff ff       	call   801111 <fd2data>
+  8020b5:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8020b7:	83 c4 0c             	add    $0xc,%esp
+  8020ba:	68 07 04 00 00       	push   $0x407
+  8020bf:	50                   	push   %eax
+  8020c0:	6a 00                	push   $0x0
+  8020c2:	e8 67 ed ff ff       	call   800e2e <sys_page_alloc>
+  8020c7:	89 c3                	mov    %eax,%ebx
+  8020c9:	83 c4 10             	add    $0x10,%esp
+  8020cc:	85 c0                	test   %eax,%eax
+  8020ce:	0f 88 82 00 00 00    	js     802156 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8020d4:	83 ec 0c             	sub    $0xc,%esp
+  8020d7:	ff 75 f0             	push   -0x10(%ebp)
+  8020da:	e8 32 f0 ff ff       	call   801111 <fd2data>
+  8020df:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8020e6:	50                   	push   %eax
+  8020e7:	6a 00                	push   $0x0
+  8020e9:	56                   	push   %esi
+  8020ea:	6a 00                	push   $0x0
+  8020ec:	e8 80 ed ff ff       	call   800e71 <sys_page_map>
+  8020f1:	89 c3                	mov    %eax,%ebx
+  8020f3:	83 c4 20             	add    $0x20,%esp
+  8020f6:	85 c0                	test   %eax,%eax
+  8020f8:	78 4e                	js     802148 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8020fa:	a1 58 30 80 00       	mov    0x803058,%eax
+  8020ff:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802102:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802104:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802107:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80210e:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802111:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802113:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802116:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80211d:	83 ec 0c             	sub    $0xc,%esp
+  802120:	ff 75 f4             	push   -0xc(%ebp)
+  802123:	e8 d9 ef ff ff       	call   801101 <fd2num>
+  802128:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80212b:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80212d:	83 c4 04             	add    $0x4,%esp
+  802130:	ff 75 f0             	push   -0x10(%ebp)
+  802133:	e8 c9 ef ff ff       	call   801101 <fd2num>
+  802138:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80213b:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80213e:	83 c4 10             	add    $0x10,%esp
+  802141:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802146:	eb 2e                	jmp    802176 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802148:	83 ec 08             	sub    $0x8,%esp
+  80214b:	56                   	push   %esi
+  80214c:	6a 00                	push   $0x0
+  80214e:	e8 60 ed ff ff       	call   800eb3 <sys_page_unmap>
+  802153:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802156:	83 ec 08             	sub    $0x8,%esp
+  802159:	ff 75 f0             	push   -0x10(%ebp)
+  80215c:	6a 00                	push   $0x0
+  80215e:	e8 50 ed ff ff       	call   800eb3 <sys_page_unmap>
+  802163:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802166:	83 ec 08             	sub    $0x8,%esp
+  802169:	ff 75 f4             	push   -0xc(%ebp)
+  80216c:	6a 00                	push   $0x0
+  80216e:	e8 40 ed ff ff       	call   800eb3 <sys_page_unmap>
+  802173:	83 c4 10             	add    $0x10,%esp
+}
+  802176:	89 d8                	mov    %ebx,%eax
+  802178:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80217b:	5b                   	pop    %ebx
+  80217c:	5e                   	pop    %esi
+  80217d:	5d                   	pop    %ebp
+  80217e:	c3                   	ret
+
+0080217f <pipeisclosed>:
+{
+  80217f:	55                   	push   %ebp
+  802180:	89 e5                	mov    %esp,%ebp
+  802182:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802185:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802188:	50                   	push   %eax
+  802189:	ff 75 08             	push   0x8(%ebp)
+  80218c:	e8 ed ef ff ff       	call   80117e <fd_lookup>
+  802191:	83 c4 10             	add    $0x10,%esp
+  802194:	85 c0                	test   %eax,%eax
+  802196:	78 18                	js     8021b0 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802198:	83 ec 0c             	sub    $0xc,%esp
+  80219b:	ff 75 f4             	push   -0xc(%ebp)
+  80219e:	e8 6e ef ff ff       	call   801111 <fd2data>
+  8021a3:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8021a5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021a8:	e8 33 fd ff ff       	call   801ee0 <_pipeisclosed>
+  8021ad:	83 c4 10             	add    $0x10,%esp
+}
+  8021b0:	c9                   	leave
+  8021b1:	c3                   	ret
+
+008021b2 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  8021b2:	55                   	push   %ebp
+  8021b3:	89 e5                	mov    %esp,%ebp
+  8021b5:	56                   	push   %esi
+  8021b6:	53                   	push   %ebx
+  8021b7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8021ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021bd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  8021c0:	85 c0                	test   %eax,%eax
+  8021c2:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8021c7:	0f 44 c2             	cmove  %edx,%eax
+  8021ca:	83 ec 0c             	sub    $0xc,%esp
+  8021cd:	50                   	push   %eax
+  8021ce:	e8 0b ee ff ff       	call   800fde <sys_ipc_recv>
+
+  if (from_env_store)
+  8021d3:	83 c4 10             	add    $0x10,%esp
+  8021d6:	85 f6                	test   %esi,%esi
+  8021d8:	74 17                	je     8021f1 <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  8021da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021df:	85 c0                	test   %eax,%eax
+  8021e1:	75 0c                	jne    8021ef <ipc_recv+0x3d>
+  8021e3:	8b 15 08 44 80 00    	mov    0x804408,%edx
+  8021e9:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  8021ef:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  8021f1:	85 db                	test   %ebx,%ebx
+  8021f3:	74 2b                	je     802220 <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  8021f5:	85 c0                	test   %eax,%eax
+  8021f7:	74 0d                	je     802206 <ipc_recv+0x54>
+  8021f9:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  8021ff:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802202:	5b                   	pop    %ebx
+  802203:	5e                   	pop    %esi
+  802204:	5d                   	pop    %ebp
+  802205:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  802206:	a1 08 44 80 00       	mov    0x804408,%eax
+  80220b:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  802211:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  802213:	a1 08 44 80 00       	mov    0x804408,%eax
+  802218:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  80221e:	eb df                	jmp    8021ff <ipc_recv+0x4d>
+  802220:	85 c0                	test   %eax,%eax
+  802222:	75 db                	jne    8021ff <ipc_recv+0x4d>
+  802224:	eb ed                	jmp    802213 <ipc_recv+0x61>
+
+00802226 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  802226:	55                   	push   %ebp
+  802227:	89 e5                	mov    %esp,%ebp
+  802229:	57                   	push   %edi
+  80222a:	56                   	push   %esi
+  80222b:	53                   	push   %ebx
+  80222c:	83 ec 0c             	sub    $0xc,%esp
+  80222f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802232:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802235:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  802238:	85 db                	test   %ebx,%ebx
+  80223a:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80223f:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  802242:	ff 75 14             	push   0x14(%ebp)
+  802245:	53                   	push   %ebx
+  802246:	56                   	push   %esi
+  802247:	57                   	push   %edi
+  802248:	e8 6e ed ff ff       	call   800fbb <sys_ipc_try_send>
+  80224d:	83 c4 10             	add    $0x10,%esp
+  802250:	85 c0                	test   %eax,%eax
+  802252:	74 1e                	je     802272 <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  802254:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802257:	75 07                	jne    802260 <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  802259:	e8 b1 eb ff ff       	call   800e0f <sys_yield>
+  80225e:	eb e2                	jmp    802242 <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  802260:	50                   	push   %eax
+  802261:	68 9b 2c 80 00       	push   $0x802c9b
+  802266:	6a 3c                	push   $0x3c
+  802268:	68 a8 2c 80 00       	push   $0x802ca8
+  80226d:	e8 4c e0 ff ff       	call   8002be <_panic>
+  }
+
+#endif
+}
+  802272:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802275:	5b                   	pop    %ebx
+  802276:	5e                   	pop    %esi
+  802277:	5f                   	pop    %edi
+  802278:	5d                   	pop    %ebp
+  802279:	c3                   	ret
+
+0080227a <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  80227a:	55                   	push   %ebp
+  80227b:	89 e5                	mov    %esp,%ebp
+  80227d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  802280:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  802285:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802288:	c1 e0 04             	shl    $0x4,%eax
+  80228b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802290:	8b 40 50             	mov    0x50(%eax),%eax
+  802293:	39 c8                	cmp    %ecx,%eax
+  802295:	74 12                	je     8022a9 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  802297:	83 c2 01             	add    $0x1,%edx
+  80229a:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8022a0:	75 e3                	jne    802285 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  8022a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022a7:	eb 0e                	jmp    8022b7 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  8022a9:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8022ac:	c1 e0 04             	shl    $0x4,%eax
+  8022af:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8022b4:	8b 40 48             	mov    0x48(%eax),%eax
+  8022b7:	5d                   	pop    %ebp
+  8022b8:	c3                   	ret
+
+008022b9 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8022b9:	55                   	push   %ebp
+  8022ba:	89 e5                	mov    %esp,%ebp
+  8022bc:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8022bf:	89 c2                	mov    %eax,%edx
+  8022c1:	c1 ea 16             	shr    $0x16,%edx
+  8022c4:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8022cb:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8022d0:	f6 c1 01             	test   $0x1,%cl
+  8022d3:	74 1c                	je     8022f1 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  8022d5:	c1 e8 0c             	shr    $0xc,%eax
+  8022d8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8022df:	a8 01                	test   $0x1,%al
+  8022e1:	74 0e                	je     8022f1 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8022e3:	c1 e8 0c             	shr    $0xc,%eax
+  8022e6:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  8022ed:	ef 
+  8022ee:	0f b7 d2             	movzwl %dx,%edx
+}
+  8022f1:	89 d0                	mov    %edx,%eax
+  8022f3:	5d                   	pop    %ebp
+  8022f4:	c3                   	ret
+  8022f5:	66 90                	xchg   %ax,%ax
+  8022f7:	66 90                	xchg   %ax,%ax
+  8022f9:	66 90                	xchg   %ax,%ax
+  8022fb:	66 90                	xchg   %ax,%ax
+  8022fd:	66 90                	xchg   %ax,%ax
+  8022ff:	90                   	nop
+
+00802300 <__udivmoddi4>:
+  802300:	55                   	push   %ebp
+  802301:	57                   	push   %edi
+  802302:	56                   	push   %esi
+  802303:	53                   	push   %ebx
+  802304:	83 ec 24             	sub    $0x24,%esp
+  802307:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80230b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80230f:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  802313:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802317:	8b 54 24 44          	mov    0x44(%esp),%edx
+  80231b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80231f:	8b 44 24 40          	mov    0x40(%esp),%eax
+  802323:	89 d3                	mov    %edx,%ebx
+  802325:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802329:	09 c3                	or     %eax,%ebx
+  80232b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80232f:	0f 84 9c 00 00 00    	je     8023d1 <__udivmoddi4+0xd1>
+  802335:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80233c:	00 
+  80233d:	31 c0                	xor    %eax,%eax
+  80233f:	31 d2                	xor    %edx,%edx
+  802341:	89 fb                	mov    %edi,%ebx
+  802343:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80234a:	00 
+  80234b:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802350:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802354:	01 c0                	add    %eax,%eax
+  802356:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80235d:	00 
+  80235e:	89 c6                	mov    %eax,%esi
+  802360:	89 d7                	mov    %edx,%edi
+  802362:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802366:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80236a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80236d:	d3 ea                	shr    %cl,%edx
+  80236f:	f6 c1 20             	test   $0x20,%cl
+  802372:	0f 45 c2             	cmovne %edx,%eax
+  802375:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802379:	83 e0 01             	and    $0x1,%eax
+  80237c:	09 fa                	or     %edi,%edx
+  80237e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802382:	89 04 24             	mov    %eax,(%esp)
+  802385:	8b 04 24             	mov    (%esp),%eax
+  802388:	89 d5                	mov    %edx,%ebp
+  80238a:	09 f0                	or     %esi,%eax
+  80238c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802390:	39 f0                	cmp    %esi,%eax
+  802392:	19 fd                	sbb    %edi,%ebp
+  802394:	72 1d                	jb     8023b3 <__udivmoddi4+0xb3>
+  802396:	29 f0                	sub    %esi,%eax
+  802398:	19 fa                	sbb    %edi,%edx
+  80239a:	89 cf                	mov    %ecx,%edi
+  80239c:	c1 ef 05             	shr    $0x5,%edi
+  80239f:	83 e7 01             	and    $0x1,%edi
+  8023a2:	89 fe                	mov    %edi,%esi
+  8023a4:	d3 e7                	shl    %cl,%edi
+  8023a6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8023aa:	83 f6 01             	xor    $0x1,%esi
+  8023ad:	d3 e6                	shl    %cl,%esi
+  8023af:	09 74 24 18          	or     %esi,0x18(%esp)
+  8023b3:	83 e9 01             	sub    $0x1,%ecx
+  8023b6:	73 98                	jae    802350 <__udivmoddi4+0x50>
+  8023b8:	85 db                	test   %ebx,%ebx
+  8023ba:	74 05                	je     8023c1 <__udivmoddi4+0xc1>
+  8023bc:	89 03                	mov    %eax,(%ebx)
+  8023be:	89 53 04             	mov    %edx,0x4(%ebx)
+  8023c1:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8023c5:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8023c9:	83 c4 24             	add    $0x24,%esp
+  8023cc:	5b                   	pop    %ebx
+  8023cd:	5e                   	pop    %esi
+  8023ce:	5f                   	pop    %edi
+  8023cf:	5d                   	pop    %ebp
+  8023d0:	c3                   	ret
+  8023d1:	85 ff                	test   %edi,%edi
+  8023d3:	74 0d                	je     8023e2 <__udivmoddi4+0xe2>
+  8023d5:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  8023db:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  8023e2:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8023e6:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8023ea:	89 44 24 18          	mov    %eax,0x18(%esp)
+  8023ee:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8023f2:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  8023f6:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8023fa:	83 c4 24             	add    $0x24,%esp
+  8023fd:	5b                   	pop    %ebx
+  8023fe:	5e                   	pop    %esi
+  8023ff:	5f                   	pop    %edi
+  802400:	5d                   	pop    %ebp
+  802401:	c3                   	ret
+  802402:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802409:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00802410 <__udivdi3>:
+  802410:	57                   	push   %edi
+  802411:	56                   	push   %esi
+  802412:	53                   	push   %ebx
+  802413:	83 ec 20             	sub    $0x20,%esp
+  802416:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80241a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80241e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802422:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802426:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80242a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80242e:	89 d1                	mov    %edx,%ecx
+  802430:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802434:	09 c1                	or     %eax,%ecx
+  802436:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80243a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80243e:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802442:	0f 84 88 00 00 00    	je     8024d0 <__udivdi3+0xc0>
+  802448:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80244f:	00 
+  802450:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802455:	31 c0                	xor    %eax,%eax
+  802457:	31 d2                	xor    %edx,%edx
+  802459:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802460:	00 
+  802461:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802468:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80246c:	01 c0                	add    %eax,%eax
+  80246e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802475:	00 
+  802476:	89 c6                	mov    %eax,%esi
+  802478:	89 d7                	mov    %edx,%edi
+  80247a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80247e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802482:	0f ad d0             	shrd   %cl,%edx,%eax
+  802485:	d3 ea                	shr    %cl,%edx
+  802487:	f6 c1 20             	test   $0x20,%cl
+  80248a:	0f 45 c2             	cmovne %edx,%eax
+  80248d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802491:	83 e0 01             	and    $0x1,%eax
+  802494:	09 fa                	or     %edi,%edx
+  802496:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80249a:	89 04 24             	mov    %eax,(%esp)
+  80249d:	8b 04 24             	mov    (%esp),%eax
+  8024a0:	89 d3                	mov    %edx,%ebx
+  8024a2:	09 f0                	or     %esi,%eax
+  8024a4:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8024a8:	39 f0                	cmp    %esi,%eax
+  8024aa:	19 fb                	sbb    %edi,%ebx
+  8024ac:	72 1d                	jb     8024cb <__udivdi3+0xbb>
+  8024ae:	29 f0                	sub    %esi,%eax
+  8024b0:	19 fa                	sbb    %edi,%edx
+  8024b2:	89 cf                	mov    %ecx,%edi
+  8024b4:	c1 ef 05             	shr    $0x5,%edi
+  8024b7:	83 e7 01             	and    $0x1,%edi
+  8024ba:	89 fe                	mov    %edi,%esi
+  8024bc:	d3 e7                	shl    %cl,%edi
+  8024be:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8024c2:	83 f6 01             	xor    $0x1,%esi
+  8024c5:	d3 e6                	shl    %cl,%esi
+  8024c7:	09 74 24 18          	or     %esi,0x18(%esp)
+  8024cb:	83 e9 01             	sub    $0x1,%ecx
+  8024ce:	73 98                	jae    802468 <__udivdi3+0x58>
+  8024d0:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8024d4:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8024d8:	83 c4 20             	add    $0x20,%esp
+  8024db:	5b                   	pop    %ebx
+  8024dc:	5e                   	pop    %esi
+  8024dd:	5f                   	pop    %edi
+  8024de:	c3                   	ret
+  8024df:	90                   	nop
+
+008024e0 <__umoddi3>:
+  8024e0:	57                   	push   %edi
+  8024e1:	56                   	push   %esi
+  8024e2:	53                   	push   %ebx
+  8024e3:	83 ec 18             	sub    $0x18,%esp
+  8024e6:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8024ea:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8024ee:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8024f2:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8024f6:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8024fa:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8024fe:	89 d1                	mov    %edx,%ecx
+  802500:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802504:	09 c1                	or     %eax,%ecx
+  802506:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80250a:	74 5b                	je     802567 <__umoddi3+0x87>
+  80250c:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802511:	31 c0                	xor    %eax,%eax
+  802513:	31 d2                	xor    %edx,%edx
+  802515:	8d 76 00             	lea    0x0(%esi),%esi
+  802518:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80251c:	01 c0                	add    %eax,%eax
+  80251e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802525:	00 
+  802526:	89 c6                	mov    %eax,%esi
+  802528:	89 d7                	mov    %edx,%edi
+  80252a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80252e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802532:	0f ad d0             	shrd   %cl,%edx,%eax
+  802535:	d3 ea                	shr    %cl,%edx
+  802537:	f6 c1 20             	test   $0x20,%cl
+  80253a:	0f 45 c2             	cmovne %edx,%eax
+  80253d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802541:	83 e0 01             	and    $0x1,%eax
+  802544:	09 fa                	or     %edi,%edx
+  802546:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80254a:	89 04 24             	mov    %eax,(%esp)
+  80254d:	8b 04 24             	mov    (%esp),%eax
+  802550:	89 d3                	mov    %edx,%ebx
+  802552:	09 f0                	or     %esi,%eax
+  802554:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802558:	39 f0                	cmp    %esi,%eax
+  80255a:	19 fb                	sbb    %edi,%ebx
+  80255c:	72 04                	jb     802562 <__umoddi3+0x82>
+  80255e:	29 f0                	sub    %esi,%eax
+  802560:	19 fa                	sbb    %edi,%edx
+  802562:	83 e9 01             	sub    $0x1,%ecx
+  802565:	73 b1                	jae    802518 <__umoddi3+0x38>
+  802567:	83 c4 18             	add    $0x18,%esp
+  80256a:	5b                   	pop    %ebx
+  80256b:	5e                   	pop    %esi
+  80256c:	5f                   	pop    %edi
+  80256d:	c3                   	ret
+  80256e:	66 90                	xchg   %ax,%ax
+
+00802570 <__divdi3>:
+  802570:	55                   	push   %ebp
+  802571:	57                   	push   %edi
+  802572:	56                   	push   %esi
+  802573:	53                   	push   %ebx
+  802574:	83 ec 24             	sub    $0x24,%esp
+  802577:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  80257b:	8b 74 24 44          	mov    0x44(%esp),%esi
+  80257f:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802583:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802587:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  80258b:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  80258f:	85 d2                	test   %edx,%edx
+  802591:	0f 88 e0 00 00 00    	js     802677 <__divdi3+0x107>
+  802597:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  80259b:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  80259f:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8025a3:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8025a7:	85 f6                	test   %esi,%esi
+  8025a9:	78 16                	js     8025c1 <__divdi3+0x51>
+  8025ab:	89 f1                	mov    %esi,%ecx
+  8025ad:	31 c0                	xor    %eax,%eax
+  8025af:	31 d2                	xor    %edx,%edx
+  8025b1:	09 d9                	or     %ebx,%ecx
+  8025b3:	0f 85 f3 00 00 00    	jne    8026ac <__divdi3+0x13c>
+  8025b9:	83 c4 24             	add    $0x24,%esp
+  8025bc:	5b                   	pop    %ebx
+  8025bd:	5e                   	pop    %esi
+  8025be:	5f                   	pop    %edi
+  8025bf:	5d                   	pop    %ebp
+  8025c0:	c3                   	ret
+  8025c1:	bf 01 00 00 00       	mov    $0x1,%edi
+  8025c6:	f7 5c 24 08          	negl   0x8(%esp)
+  8025ca:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  8025cf:	f7 5c 24 0c          	negl   0xc(%esp)
+  8025d3:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8025da:	00 
+  8025db:	31 c0                	xor    %eax,%eax
+  8025dd:	31 d2                	xor    %edx,%edx
+  8025df:	89 fb                	mov    %edi,%ebx
+  8025e1:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8025e8:	00 
+  8025e9:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8025ee:	66 90                	xchg   %ax,%ax
+  8025f0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8025f4:	01 c0                	add    %eax,%eax
+  8025f6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8025fd:	00 
+  8025fe:	89 c6                	mov    %eax,%esi
+  802600:	89 d7                	mov    %edx,%edi
+  802602:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802606:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80260a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80260d:	d3 ea                	shr    %cl,%edx
+  80260f:	f6 c1 20             	test   $0x20,%cl
+  802612:	0f 45 c2             	cmovne %edx,%eax
+  802615:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802619:	83 e0 01             	and    $0x1,%eax
+  80261c:	09 fa                	or     %edi,%edx
+  80261e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802622:	89 04 24             	mov    %eax,(%esp)
+  802625:	8b 04 24             	mov    (%esp),%eax
+  802628:	89 d5                	mov    %edx,%ebp
+  80262a:	09 f0                	or     %esi,%eax
+  80262c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802630:	39 f0                	cmp    %esi,%eax
+  802632:	19 fd                	sbb    %edi,%ebp
+  802634:	72 1d                	jb     802653 <__divdi3+0xe3>
+  802636:	29 f0                	sub    %esi,%eax
+  802638:	19 fa                	sbb    %edi,%edx
+  80263a:	89 cf                	mov    %ecx,%edi
+  80263c:	c1 ef 05             	shr    $0x5,%edi
+  80263f:	83 e7 01             	and    $0x1,%edi
+  802642:	89 fe                	mov    %edi,%esi
+  802644:	d3 e7                	shl    %cl,%edi
+  802646:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80264a:	83 f6 01             	xor    $0x1,%esi
+  80264d:	d3 e6                	shl    %cl,%esi
+  80264f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802653:	83 e9 01             	sub    $0x1,%ecx
+  802656:	73 98                	jae    8025f0 <__divdi3+0x80>
+  802658:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80265c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802660:	85 db                	test   %ebx,%ebx
+  802662:	0f 84 51 ff ff ff    	je     8025b9 <__divdi3+0x49>
+  802668:	f7 d8                	neg    %eax
+  80266a:	83 d2 00             	adc    $0x0,%edx
+  80266d:	83 c4 24             	add    $0x24,%esp
+  802670:	5b                   	pop    %ebx
+  802671:	f7 da                	neg    %edx
+  802673:	5e                   	pop    %esi
+  802674:	5f                   	pop    %edi
+  802675:	5d                   	pop    %ebp
+  802676:	c3                   	ret
+  802677:	f7 d8                	neg    %eax
+  802679:	83 d2 00             	adc    $0x0,%edx
+  80267c:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802680:	f7 da                	neg    %edx
+  802682:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802686:	85 f6                	test   %esi,%esi
+  802688:	78 1b                	js     8026a5 <__divdi3+0x135>
+  80268a:	89 f1                	mov    %esi,%ecx
+  80268c:	31 c0                	xor    %eax,%eax
+  80268e:	31 d2                	xor    %edx,%edx
+  802690:	bf 01 00 00 00       	mov    $0x1,%edi
+  802695:	09 d9                	or     %ebx,%ecx
+  802697:	0f 85 36 ff ff ff    	jne    8025d3 <__divdi3+0x63>
+  80269d:	83 c4 24             	add    $0x24,%esp
+  8026a0:	5b                   	pop    %ebx
+  8026a1:	5e                   	pop    %esi
+  8026a2:	5f                   	pop    %edi
+  8026a3:	5d                   	pop    %ebp
+  8026a4:	c3                   	ret
+  8026a5:	31 ff                	xor    %edi,%edi
+  8026a7:	e9 1a ff ff ff       	jmp    8025c6 <__divdi3+0x56>
+  8026ac:	31 ff                	xor    %edi,%edi
+  8026ae:	e9 20 ff ff ff       	jmp    8025d3 <__divdi3+0x63>
+  8026b3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8026ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+008026c0 <__moddi3>:
+  8026c0:	55                   	push   %ebp
+  8026c1:	57                   	push   %edi
+  8026c2:	56                   	push   %esi
+  8026c3:	53                   	push   %ebx
+  8026c4:	83 ec 1c             	sub    $0x1c,%esp
+  8026c7:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  8026cb:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  8026cf:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  8026d3:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  8026d7:	89 c8                	mov    %ecx,%eax
+  8026d9:	89 f2                	mov    %esi,%edx
+  8026db:	89 f3                	mov    %esi,%ebx
+  8026dd:	85 ed                	test   %ebp,%ebp
+  8026df:	0f 88 9d 00 00 00    	js     802782 <__moddi3+0xc2>
+  8026e5:	09 cb                	or     %ecx,%ebx
+  8026e7:	0f 84 8d 00 00 00    	je     80277a <__moddi3+0xba>
+  8026ed:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  8026f1:	31 db                	xor    %ebx,%ebx
+  8026f3:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  8026f7:	89 ca                	mov    %ecx,%edx
+  8026f9:	89 f0                	mov    %esi,%eax
+  8026fb:	89 dd                	mov    %ebx,%ebp
+  8026fd:	f7 da                	neg    %edx
+  8026ff:	83 d0 00             	adc    $0x0,%eax
+  802702:	f7 d8                	neg    %eax
+  802704:	0f 49 f0             	cmovns %eax,%esi
+  802707:	0f 49 ca             	cmovns %edx,%ecx
+  80270a:	31 c0                	xor    %eax,%eax
+  80270c:	31 d2                	xor    %edx,%edx
+  80270e:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802712:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802716:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80271b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80271f:	90                   	nop
+  802720:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802724:	01 c0                	add    %eax,%eax
+  802726:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80272d:	00 
+  80272e:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  802732:	89 c6                	mov    %eax,%esi
+  802734:	89 d7                	mov    %edx,%edi
+  802736:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80273a:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80273e:	0f ad d0             	shrd   %cl,%edx,%eax
+  802741:	d3 ea                	shr    %cl,%edx
+  802743:	f6 c1 20             	test   $0x20,%cl
+  802746:	0f 45 c2             	cmovne %edx,%eax
+  802749:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80274d:	83 e0 01             	and    $0x1,%eax
+  802750:	09 fa                	or     %edi,%edx
+  802752:	89 04 24             	mov    %eax,(%esp)
+  802755:	8b 04 24             	mov    (%esp),%eax
+  802758:	89 d7                	mov    %edx,%edi
+  80275a:	09 f0                	or     %esi,%eax
+  80275c:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  802760:	39 d8                	cmp    %ebx,%eax
+  802762:	19 f7                	sbb    %esi,%edi
+  802764:	72 04                	jb     80276a <__moddi3+0xaa>
+  802766:	29 d8                	sub    %ebx,%eax
+  802768:	19 f2                	sbb    %esi,%edx
+  80276a:	83 e9 01             	sub    $0x1,%ecx
+  80276d:	73 b1                	jae    802720 <__moddi3+0x60>
+  80276f:	85 ed                	test   %ebp,%ebp
+  802771:	74 07                	je     80277a <__moddi3+0xba>
+  802773:	f7 d8                	neg    %eax
+  802775:	83 d2 00             	adc    $0x0,%edx
+  802778:	f7 da                	neg    %edx
+  80277a:	83 c4 1c             	add    $0x1c,%esp
+  80277d:	5b                   	pop    %ebx
+  80277e:	5e                   	pop    %esi
+  80277f:	5f                   	pop    %edi
+  802780:	5d                   	pop    %ebp
+  802781:	c3                   	ret
+  802782:	09 cb                	or     %ecx,%ebx
+  802784:	74 f4                	je     80277a <__moddi3+0xba>
+  802786:	f7 df                	neg    %edi
+  802788:	bb 01 00 00 00       	mov    $0x1,%ebx
+  80278d:	83 d5 00             	adc    $0x0,%ebp
+  802790:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802794:	f7 dd                	neg    %ebp
+  802796:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  80279a:	e9 58 ff ff ff       	jmp    8026f7 <__moddi3+0x37>
@@ -0,0 +1,6007 @@
+
+obj/user/testpipe.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 a1 02 00 00       	call   8002d2 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+char *msg = "Now is the time for all good men to come to the aid of their party.";
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	83 ec 7c             	sub    $0x7c,%esp
+	char buf[100];
+	int i, pid, p[2];
+
+	binaryname = "pipereadeof";
+  80003b:	c7 05 04 40 80 00 80 	movl   $0x802b80,0x804004
+  800042:	2b 80 00 
+
+	if ((i = pipe(p)) < 0)
+  800045:	8d 45 8c             	lea    -0x74(%ebp),%eax
+  800048:	50                   	push   %eax
+  800049:	e8 71 21 00 00       	call   8021bf <pipe>
+  80004e:	89 c6                	mov    %eax,%esi
+  800050:	83 c4 10             	add    $0x10,%esp
+  800053:	85 c0                	test   %eax,%eax
+  800055:	0f 88 1b 01 00 00    	js     800176 <umain+0x143>
+		panic("pipe: %e", i);
+
+	if ((pid = fork()) < 0)
+  80005b:	e8 23 11 00 00       	call   801183 <fork>
+  800060:	89 c3                	mov    %eax,%ebx
+  800062:	85 c0                	test   %eax,%eax
+  800064:	0f 88 1e 01 00 00    	js     800188 <umain+0x155>
+		panic("fork: %e", i);
+
+	if (pid == 0) {
+  80006a:	0f 85 56 01 00 00    	jne    8001c6 <umain+0x193>
+		cprintf("[%08x] pipereadeof close %d\n", thisenv->env_id, p[1]);
+  800070:	a1 08 50 80 00       	mov    0x805008,%eax
+  800075:	8b 40 48             	mov    0x48(%eax),%eax
+  800078:	83 ec 04             	sub    $0x4,%esp
+  80007b:	ff 75 90             	push   -0x70(%ebp)
+  80007e:	50                   	push   %eax
+  80007f:	68 ae 2b 80 00       	push   $0x802bae
+  800084:	e8 87 03 00 00       	call   800410 <cprintf>
+		close(p[1]);
+  800089:	83 c4 04             	add    $0x4,%esp
+  80008c:	ff 75 90             	push   -0x70(%ebp)
+  80008f:	e8 b2 14 00 00       	call   801546 <close>
+		cprintf("[%08x] pipereadeof readn %d\n", thisenv->env_id, p[0]);
+  800094:	a1 08 50 80 00       	mov    0x805008,%eax
+  800099:	8b 40 48             	mov    0x48(%eax),%eax
+  80009c:	83 c4 0c             	add    $0xc,%esp
+  80009f:	ff 75 8c             	push   -0x74(%ebp)
+  8000a2:	50                   	push   %eax
+  8000a3:	68 cb 2b 80 00       	push   $0x802bcb
+  8000a8:	e8 63 03 00 00       	call   800410 <cprintf>
+		i = readn(p[0], buf, sizeof buf-1);
+  8000ad:	83 c4 0c             	add    $0xc,%esp
+  8000b0:	6a 63                	push   $0x63
+  8000b2:	8d 45 94             	lea    -0x6c(%ebp),%eax
+  8000b5:	50                   	push   %eax
+  8000b6:	ff 75 8c             	push   -0x74(%ebp)
+  8000b9:	e8 4b 16 00 00       	call   801709 <readn>
+  8000be:	89 c6                	mov    %eax,%esi
+		if (i < 0)
+  8000c0:	83 c4 10             	add    $0x10,%esp
+  8000c3:	85 c0                	test   %eax,%eax
+  8000c5:	0f 88 cf 00 00 00    	js     80019a <umain+0x167>
+			panic("read: %e", i);
+		buf[i] = 0;
+  8000cb:	c6 44 05 94 00       	movb   $0x0,-0x6c(%ebp,%eax,1)
+		if (strcmp(buf, msg) == 0)
+  8000d0:	83 ec 08             	sub    $0x8,%esp
+  8000d3:	ff 35 00 40 80 00    	push   0x804000
+  8000d9:	8d 45 94             	lea    -0x6c(%ebp),%eax
+  8000dc:	50                   	push   %eax
+  8000dd:	e8 98 09 00 00       	call   800a7a <strcmp>
+  8000e2:	83 c4 10             	add    $0x10,%esp
+  8000e5:	85 c0                	test   %eax,%eax
+  8000e7:	0f 85 bf 00 00 00    	jne    8001ac <umain+0x179>
+			cprintf("\npipe read closed properly\n");
+  8000ed:	83 ec 0c             	sub    $0xc,%esp
+  8000f0:	68 f1 2b 80 00       	push   $0x802bf1
+  8000f5:	e8 16 03 00 00       	call   800410 <cprintf>
+  8000fa:	83 c4 10             	add    $0x10,%esp
+		else
+			cprintf("\ngot %d bytes: %s\n", i, buf);
+		exit();
+  8000fd:	e8 19 02 00 00       	call   80031b <exit>
+		cprintf("[%08x] pipereadeof write %d\n", thisenv->env_id, p[1]);
+		if ((i = write(p[1], msg, strlen(msg))) != strlen(msg))
+			panic("write: %e", i);
+		close(p[1]);
+	}
+	wait(pid);
+  800102:	83 ec 0c             	sub    $0xc,%esp
+  800105:	53                   	push   %ebx
+  800106:	e8 31 22 00 00       	call   80233c <wait>
+
+	binaryname = "pipewriteeof";
+  80010b:	c7 05 04 40 80 00 47 	movl   $0x802c47,0x804004
+  800112:	2c 80 00 
+	if ((i = pipe(p)) < 0)
+  800115:	8d 45 8c             	lea    -0x74(%ebp),%eax
+  800118:	89 04 24             	mov    %eax,(%esp)
+  80011b:	e8 9f 20 00 00       	call   8021bf <pipe>
+  800120:	89 c6                	mov    %eax,%esi
+  800122:	83 c4 10             	add    $0x10,%esp
+  800125:	85 c0                	test   %eax,%eax
+  800127:	0f 88 32 01 00 00    	js     80025f <umain+0x22c>
+		panic("pipe: %e", i);
+
+	if ((pid = fork()) < 0)
+  80012d:	e8 51 10 00 00       	call   801183 <fork>
+  800132:	89 c3                	mov    %eax,%ebx
+  800134:	85 c0                	test   %eax,%eax
+  800136:	0f 88 35 01 00 00    	js     800271 <umain+0x23e>
+		panic("fork: %e", i);
+
+	if (pid == 0) {
+  80013c:	0f 84 41 01 00 00    	je     800283 <umain+0x250>
+				break;
+		}
+		cprintf("\npipe write closed properly\n");
+		exit();
+	}
+	close(p[0]);
+  800142:	83 ec 0c             	sub    $0xc,%esp
+  800145:	ff 75 8c             	push   -0x74(%ebp)
+  800148:	e8 f9 13 00 00       	call   801546 <close>
+	close(p[1]);
+  80014d:	83 c4 04             	add    $0x4,%esp
+  800150:	ff 75 90             	push   -0x70(%ebp)
+  800153:	e8 ee 13 00 00       	call   801546 <close>
+	wait(pid);
+  800158:	89 1c 24             	mov    %ebx,(%esp)
+  80015b:	e8 dc 21 00 00       	call   80233c <wait>
+
+	cprintf("pipe tests passed\n");
+  800160:	c7 04 24 75 2c 80 00 	movl   $0x802c75,(%esp)
+  800167:	e8 a4 02 00 00       	call   800410 <cprintf>
+}
+  80016c:	83 c4 10             	add    $0x10,%esp
+  80016f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800172:	5b                   	pop    %ebx
+  800173:	5e                   	pop    %esi
+  800174:	5d                   	pop    %ebp
+  800175:	c3                   	ret
+		panic("pipe: %e", i);
+  800176:	50                   	push   %eax
+  800177:	68 8c 2b 80 00       	push   $0x802b8c
+  80017c:	6a 0e                	push   $0xe
+  80017e:	68 95 2b 80 00       	push   $0x802b95
+  800183:	e8 ad 01 00 00       	call   800335 <_panic>
+		panic("fork: %e", i);
+  800188:	56                   	push   %esi
+  800189:	68 a5 2b 80 00       	push   $0x802ba5
+  80018e:	6a 11                	push   $0x11
+  800190:	68 95 2b 80 00       	push   $0x802b95
+  800195:	e8 9b 01 00 00       	call   800335 <_panic>
+			panic("read: %e", i);
+  80019a:	50                   	push   %eax
+  80019b:	68 e8 2b 80 00       	push   $0x802be8
+  8001a0:	6a 19                	push   $0x19
+  8001a2:	68 95 2b 80 00       	push   $0x802b95
+  8001a7:	e8 89 01 00 00       	call   800335 <_panic>
+			cprintf("\ngot %d bytes: %s\n", i, buf);
+  8001ac:	83 ec 04             	sub    $0x4,%esp
+  8001af:	8d 45 94             	lea    -0x6c(%ebp),%eax
+  8001b2:	50                   	push   %eax
+  8001b3:	56                   	push   %esi
+  8001b4:	68 0d 2c 80 00       	push   $0x802c0d
+  8001b9:	e8 52 02 00 00       	call   800410 <cprintf>
+  8001be:	83 c4 10             	add    $0x10,%esp
+  8001c1:	e9 37 ff ff ff       	jmp    8000fd <umain+0xca>
+		cprintf("[%08x] pipereadeof close %d\n", thisenv->env_id, p[0]);
+  8001c6:	a1 08 50 80 00       	mov    0x805008,%eax
+  8001cb:	8b 40 48             	mov    0x48(%eax),%eax
+  8001ce:	83 ec 04             	sub    $0x4,%esp
+  8001d1:	ff 75 8c             	push   -0x74(%ebp)
+  8001d4:	50                   	push   %eax
+  8001d5:	68 ae 2b 80 00       	push   $0x802bae
+  8001da:	e8 31 02 00 00       	call   800410 <cprintf>
+		close(p[0]);
+  8001df:	83 c4 04             	add    $0x4,%esp
+  8001e2:	ff 75 8c             	push   -0x74(%ebp)
+  8001e5:	e8 5c 13 00 00       	call   801546 <close>
+		cprintf("[%08x] pipereadeof write %d\n", thisenv->env_id, p[1]);
+  8001ea:	a1 08 50 80 00       	mov    0x805008,%eax
+  8001ef:	8b 40 48             	mov    0x48(%eax),%eax
+  8001f2:	83 c4 0c             	add    $0xc,%esp
+  8001f5:	ff 75 90             	push   -0x70(%ebp)
+  8001f8:	50                   	push   %eax
+  8001f9:	68 20 2c 80 00       	push   $0x802c20
+  8001fe:	e8 0d 02 00 00       	call   800410 <cprintf>
+		if ((i = write(p[1], msg, strlen(msg))) != strlen(msg))
+  800203:	83 c4 04             	add    $0x4,%esp
+  800206:	ff 35 00 40 80 00    	push   0x804000
+  80020c:	e8 7d 07 00 00       	call   80098e <strlen>
+  800211:	83 c4 0c             	add    $0xc,%esp
+  800214:	50                   	push   %eax
+  800215:	ff 35 00 40 80 00    	push   0x804000
+  80021b:	ff 75 90             	push   -0x70(%ebp)
+  80021e:	e8 2d 15 00 00       	call   801750 <write>
+  800223:	89 c6                	mov    %eax,%esi
+  800225:	83 c4 04             	add    $0x4,%esp
+  800228:	ff 35 00 40 80 00    	push   0x804000
+  80022e:	e8 5b 07 00 00       	call   80098e <strlen>
+  800233:	83 c4 10             	add    $0x10,%esp
+  800236:	39 f0                	cmp    %esi,%eax
+  800238:	75 13                	jne    80024d <umain+0x21a>
+		close(p[1]);
+  80023a:	83 ec 0c             	sub    $0xc,%esp
+  80023d:	ff 75 90             	push   -0x70(%ebp)
+  800240:	e8 01 13 00 00       	call   801546 <close>
+  800245:	83 c4 10             	add    $0x10,%esp
+  800248:	e9 b5 fe ff ff       	jmp    800102 <umain+0xcf>
+			panic("write: %e", i);
+  80024d:	56                   	push   %esi
+  80024e:	68 3d 2c 80 00       	push   $0x802c3d
+  800253:	6a 25                	push   $0x25
+  800255:	68 95 2b 80 00       	push   $0x802b95
+  80025a:	e8 d6 00 00 00       	call   800335 <_panic>
+		panic("pipe: %e", i);
+  80025f:	50                   	push   %eax
+  800260:	68 8c 2b 80 00       	push   $0x802b8c
+  800265:	6a 2c                	push   $0x2c
+  800267:	68 95 2b 80 00       	push   $0x802b95
+  80026c:	e8 c4 00 00 00       	call   800335 <_panic>
+		panic("fork: %e", i);
+  800271:	56                   	push   %esi
+  800272:	68 a5 2b 80 00       	push   $0x802ba5
+  800277:	6a 2f                	push   $0x2f
+  800279:	68 95 2b 80 00       	push   $0x802b95
+  80027e:	e8 b2 00 00 00       	call   800335 <_panic>
+		close(p[0]);
+  800283:	83 ec 0c             	sub    $0xc,%esp
+  800286:	ff 75 8c             	push   -0x74(%ebp)
+  800289:	e8 b8 12 00 00       	call   801546 <close>
+  80028e:	83 c4 10             	add    $0x10,%esp
+			cprintf(".");
+  800291:	83 ec 0c             	sub    $0xc,%esp
+  800294:	68 54 2c 80 00       	push   $0x802c54
+  800299:	e8 72 01 00 00       	call   800410 <cprintf>
+			if (write(p[1], "x", 1) != 1)
+  80029e:	83 c4 0c             	add    $0xc,%esp
+  8002a1:	6a 01                	push   $0x1
+  8002a3:	68 56 2c 80 00       	push   $0x802c56
+  8002a8:	ff 75 90             	push   -0x70(%ebp)
+  8002ab:	e8 a0 14 00 00       	call   801750 <write>
+  8002b0:	83 c4 10             	add    $0x10,%esp
+  8002b3:	83 f8 01             	cmp    $0x1,%eax
+  8002b6:	74 d9                	je     800291 <umain+0x25e>
+		cprintf("\npipe write closed properly\n");
+  8002b8:	83 ec 0c             	sub    $0xc,%esp
+  8002bb:	68 58 2c 80 00       	push   $0x802c58
+  8002c0:	e8 4b 01 00 00       	call   800410 <cprintf>
+		exit();
+  8002c5:	e8 51 00 00 00       	call   80031b <exit>
+  8002ca:	83 c4 10             	add    $0x10,%esp
+  8002cd:	e9 70 fe ff ff       	jmp    800142 <umain+0x10f>
+
+008002d2 <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  8002d2:	55                   	push   %ebp
+  8002d3:	89 e5                	mov    %esp,%ebp
+  8002d5:	56                   	push   %esi
+  8002d6:	53                   	push   %ebx
+  8002d7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8002da:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  8002dd:	e8 95 0a 00 00       	call   800d77 <sys_getenvid>
+  8002e2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8002e7:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8002ea:	c1 e0 04             	shl    $0x4,%eax
+  8002ed:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8002f2:	a3 08 50 80 00       	mov    %eax,0x805008
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8002f7:	85 db                	test   %ebx,%ebx
+  8002f9:	7e 07                	jle    800302 <libmain+0x30>
+    binaryname = argv[0];
+  8002fb:	8b 06                	mov    (%esi),%eax
+  8002fd:	a3 04 40 80 00       	mov    %eax,0x804004
+
+  // call user main routine
+  umain(argc, argv);
+  800302:	83 ec 08             	sub    $0x8,%esp
+  800305:	56                   	push   %esi
+  800306:	53                   	push   %ebx
+  800307:	e8 27 fd ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  80030c:	e8 0a 00 00 00       	call   80031b <exit>
+}
+  800311:	83 c4 10             	add    $0x10,%esp
+  800314:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800317:	5b                   	pop    %ebx
+  800318:	5e                   	pop    %esi
+  800319:	5d                   	pop    %ebp
+  80031a:	c3                   	ret
+
+0080031b <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80031b:	55                   	push   %ebp
+  80031c:	89 e5                	mov    %esp,%ebp
+  80031e:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800321:	e8 4d 12 00 00       	call   801573 <close_all>
+	sys_env_destroy(0);
+  800326:	83 ec 0c             	sub    $0xc,%esp
+  800329:	6a 00                	push   $0x0
+  80032b:	e8 06 0a 00 00       	call   800d36 <sys_env_destroy>
+}
+  800330:	83 c4 10             	add    $0x10,%esp
+  800333:	c9                   	leave
+  800334:	c3                   	ret
+
+00800335 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800335:	55                   	push   %ebp
+  800336:	89 e5                	mov    %esp,%ebp
+  800338:	56                   	push   %esi
+  800339:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80033a:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80033d:	8b 35 04 40 80 00    	mov    0x804004,%esi
+  800343:	e8 2f 0a 00 00       	call   800d77 <sys_getenvid>
+  800348:	83 ec 0c             	sub    $0xc,%esp
+  80034b:	ff 75 0c             	push   0xc(%ebp)
+  80034e:	ff 75 08             	push   0x8(%ebp)
+  800351:	56                   	push   %esi
+  800352:	50                   	push   %eax
+  800353:	68 d8 2c 80 00       	push   $0x802cd8
+  800358:	e8 b3 00 00 00       	call   800410 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80035d:	83 c4 18             	add    $0x18,%esp
+  800360:	53                   	push   %ebx
+  800361:	ff 75 10             	push   0x10(%ebp)
+  800364:	e8 56 00 00 00       	call   8003bf <vcprintf>
+	cprintf("\n");
+  800369:	c7 04 24 c9 2b 80 00 	movl   $0x802bc9,(%esp)
+  800370:	e8 9b 00 00 00       	call   800410 <cprintf>
+  800375:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800378:	cc                   	int3
+	while (1)
+  800379:	eb fd                	jmp    800378 <_panic+0x43>
+
+0080037b <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80037b:	55                   	push   %ebp
+  80037c:	89 e5                	mov    %esp,%ebp
+  80037e:	53                   	push   %ebx
+  80037f:	83 ec 04             	sub    $0x4,%esp
+  800382:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800385:	8b 13                	mov    (%ebx),%edx
+  800387:	8d 42 01             	lea    0x1(%edx),%eax
+  80038a:	89 03                	mov    %eax,(%ebx)
+  80038c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80038f:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800393:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800398:	74 09                	je     8003a3 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80039a:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80039e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8003a1:	c9                   	leave
+  8003a2:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8003a3:	83 ec 08             	sub    $0x8,%esp
+  8003a6:	68 ff 00 00 00       	push   $0xff
+  8003ab:	8d 43 08             	lea    0x8(%ebx),%eax
+  8003ae:	50                   	push   %eax
+  8003af:	e8 45 09 00 00       	call   800cf9 <sys_cputs>
+		b->idx = 0;
+  8003b4:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8003ba:	83 c4 10             	add    $0x10,%esp
+  8003bd:	eb db                	jmp    80039a <putch+0x1f>
+
+008003bf <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8003bf:	55                   	push   %ebp
+  8003c0:	89 e5                	mov    %esp,%ebp
+  8003c2:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8003c8:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8003cf:	00 00 00 
+	b.cnt = 0;
+  8003d2:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8003d9:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8003dc:	ff 75 0c             	push   0xc(%ebp)
+  8003df:	ff 75 08             	push   0x8(%ebp)
+  8003e2:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8003e8:	50                   	push   %eax
+  8003e9:	68 7b 03 80 00       	push   $0x80037b
+  8003ee:	e8 14 01 00 00       	call   800507 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8003f3:	83 c4 08             	add    $0x8,%esp
+  8003f6:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8003fc:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800402:	50                   	push   %eax
+  800403:	e8 f1 08 00 00       	call   800cf9 <sys_cputs>
+
+	return b.cnt;
+}
+  800408:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80040e:	c9                   	leave
+  80040f:	c3                   	ret
+
+00800410 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800410:	55                   	push   %ebp
+  800411:	89 e5                	mov    %esp,%ebp
+  800413:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800416:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800419:	50                   	push   %eax
+  80041a:	ff 75 08             	push   0x8(%ebp)
+  80041d:	e8 9d ff ff ff       	call   8003bf <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800422:	c9                   	leave
+  800423:	c3                   	ret
+
+00800424 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800424:	55                   	push   %ebp
+  800425:	89 e5                	mov    %esp,%ebp
+  800427:	57                   	push   %edi
+  800428:	56                   	push   %esi
+  800429:	53                   	push   %ebx
+  80042a:	83 ec 1c             	sub    $0x1c,%esp
+  80042d:	89 c7                	mov    %eax,%edi
+  80042f:	89 d6                	mov    %edx,%esi
+  800431:	8b 45 08             	mov    0x8(%ebp),%eax
+  800434:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800437:	89 d1                	mov    %edx,%ecx
+  800439:	89 c2                	mov    %eax,%edx
+  80043b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80043e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800441:	8b 45 10             	mov    0x10(%ebp),%eax
+  800444:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800447:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80044a:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800451:	39 c2                	cmp    %eax,%edx
+  800453:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800456:	72 3e                	jb     800496 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800458:	83 ec 0c             	sub    $0xc,%esp
+  80045b:	ff 75 18             	push   0x18(%ebp)
+  80045e:	83 eb 01             	sub    $0x1,%ebx
+  800461:	53                   	push   %ebx
+  800462:	50                   	push   %eax
+  800463:	83 ec 08             	sub    $0x8,%esp
+  800466:	ff 75 e4             	push   -0x1c(%ebp)
+  800469:	ff 75 e0             	push   -0x20(%ebp)
+  80046c:	ff 75 dc             	push   -0x24(%ebp)
+  80046f:	ff 75 d8             	push   -0x28(%ebp)
+  800472:	e8 79 23 00 00       	call   8027f0 <__udivdi3>
+  800477:	83 c4 18             	add    $0x18,%esp
+  80047a:	52                   	push   %edx
+  80047b:	50                   	push   %eax
+  80047c:	89 f2                	mov    %esi,%edx
+  80047e:	89 f8                	mov    %edi,%eax
+  800480:	e8 9f ff ff ff       	call   800424 <printnum>
+  800485:	83 c4 20             	add    $0x20,%esp
+  800488:	eb 13                	jmp    80049d <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80048a:	83 ec 08             	sub    $0x8,%esp
+  80048d:	56                   	push   %esi
+  80048e:	ff 75 18             	push   0x18(%ebp)
+  800491:	ff d7                	call   *%edi
+  800493:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800496:	83 eb 01             	sub    $0x1,%ebx
+  800499:	85 db                	test   %ebx,%ebx
+  80049b:	7f ed                	jg     80048a <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80049d:	83 ec 08             	sub    $0x8,%esp
+  8004a0:	56                   	push   %esi
+  8004a1:	83 ec 04             	sub    $0x4,%esp
+  8004a4:	ff 75 e4             	push   -0x1c(%ebp)
+  8004a7:	ff 75 e0             	push   -0x20(%ebp)
+  8004aa:	ff 75 dc             	push   -0x24(%ebp)
+  8004ad:	ff 75 d8             	push   -0x28(%ebp)
+  8004b0:	e8 0b 24 00 00       	call   8028c0 <__umoddi3>
+  8004b5:	83 c4 14             	add    $0x14,%esp
+  8004b8:	0f be 80 fb 2c 80 00 	movsbl 0x802cfb(%eax),%eax
+  8004bf:	50                   	push   %eax
+  8004c0:	ff d7                	call   *%edi
+}
+  8004c2:	83 c4 10             	add    $0x10,%esp
+  8004c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004c8:	5b                   	pop    %ebx
+  8004c9:	5e                   	pop    %esi
+  8004ca:	5f                   	pop    %edi
+  8004cb:	5d                   	pop    %ebp
+  8004cc:	c3                   	ret
+
+008004cd <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8004cd:	55                   	push   %ebp
+  8004ce:	89 e5                	mov    %esp,%ebp
+  8004d0:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8004d3:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8004d7:	8b 10                	mov    (%eax),%edx
+  8004d9:	3b 50 04             	cmp    0x4(%eax),%edx
+  8004dc:	73 0a                	jae    8004e8 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8004de:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8004e1:	89 08                	mov    %ecx,(%eax)
+  8004e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8004e6:	88 02                	mov    %al,(%edx)
+}
+  8004e8:	5d                   	pop    %ebp
+  8004e9:	c3                   	ret
+
+008004ea <printfmt>:
+{
+  8004ea:	55                   	push   %ebp
+  8004eb:	89 e5                	mov    %esp,%ebp
+  8004ed:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8004f0:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8004f3:	50                   	push   %eax
+  8004f4:	ff 75 10             	push   0x10(%ebp)
+  8004f7:	ff 75 0c             	push   0xc(%ebp)
+  8004fa:	ff 75 08             	push   0x8(%ebp)
+  8004fd:	e8 05 00 00 00       	call   800507 <vprintfmt>
+}
+  800502:	83 c4 10             	add    $0x10,%esp
+  800505:	c9                   	leave
+  800506:	c3                   	ret
+
+00800507 <vprintfmt>:
+{
+  800507:	55                   	push   %ebp
+  800508:	89 e5                	mov    %esp,%ebp
+  80050a:	57                   	push   %edi
+  80050b:	56                   	push   %esi
+  80050c:	53                   	push   %ebx
+  80050d:	83 ec 2c             	sub    $0x2c,%esp
+  800510:	8b 75 08             	mov    0x8(%ebp),%esi
+  800513:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800516:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800519:	eb 0a                	jmp    800525 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80051b:	83 ec 08             	sub    $0x8,%esp
+  80051e:	53                   	push   %ebx
+  80051f:	50                   	push   %eax
+  800520:	ff d6                	call   *%esi
+  800522:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800525:	83 c7 01             	add    $0x1,%edi
+  800528:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80052c:	83 f8 25             	cmp    $0x25,%eax
+  80052f:	74 0c                	je     80053d <vprintfmt+0x36>
+			if (ch == '\0')
+  800531:	85 c0                	test   %eax,%eax
+  800533:	75 e6                	jne    80051b <vprintfmt+0x14>
+}
+  800535:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800538:	5b                   	pop    %ebx
+  800539:	5e                   	pop    %esi
+  80053a:	5f                   	pop    %edi
+  80053b:	5d                   	pop    %ebp
+  80053c:	c3                   	ret
+		padc = ' ';
+  80053d:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800541:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800548:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80054f:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800556:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80055b:	8d 47 01             	lea    0x1(%edi),%eax
+  80055e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800561:	0f b6 17             	movzbl (%edi),%edx
+  800564:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800567:	3c 55                	cmp    $0x55,%al
+  800569:	0f 87 9a 03 00 00    	ja     800909 <vprintfmt+0x402>
+  80056f:	0f b6 c0             	movzbl %al,%eax
+  800572:	ff 24 85 40 2e 80 00 	jmp    *0x802e40(,%eax,4)
+  800579:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  80057c:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800580:	eb d9                	jmp    80055b <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800582:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800585:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800589:	eb d0                	jmp    80055b <vprintfmt+0x54>
+  80058b:	0f b6 d2             	movzbl %dl,%edx
+  80058e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800591:	b8 00 00 00 00       	mov    $0x0,%eax
+  800596:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800599:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80059c:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8005a0:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8005a3:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8005a6:	83 f9 09             	cmp    $0x9,%ecx
+  8005a9:	77 55                	ja     800600 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8005ab:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8005ae:	eb e9                	jmp    800599 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8005b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b3:	8b 00                	mov    (%eax),%eax
+  8005b5:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8005b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005bb:	8d 40 04             	lea    0x4(%eax),%eax
+  8005be:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8005c1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8005c4:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005c8:	79 91                	jns    80055b <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8005ca:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8005cd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005d0:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8005d7:	eb 82                	jmp    80055b <vprintfmt+0x54>
+			if (width < 0)
+  8005d9:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8005dc:	85 d2                	test   %edx,%edx
+  8005de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005e3:	0f 49 c2             	cmovns %edx,%eax
+  8005e6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8005e9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8005ec:	e9 6a ff ff ff       	jmp    80055b <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8005f1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8005f4:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8005fb:	e9 5b ff ff ff       	jmp    80055b <vprintfmt+0x54>
+  800600:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800603:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800606:	eb bc                	jmp    8005c4 <vprintfmt+0xbd>
+			lflag++;
+  800608:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80060b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80060e:	e9 48 ff ff ff       	jmp    80055b <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800613:	8b 45 14             	mov    0x14(%ebp),%eax
+  800616:	8d 78 04             	lea    0x4(%eax),%edi
+  800619:	83 ec 08             	sub    $0x8,%esp
+  80061c:	53                   	push   %ebx
+  80061d:	ff 30                	push   (%eax)
+  80061f:	ff d6                	call   *%esi
+			break;
+  800621:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800624:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800627:	e9 7c 02 00 00       	jmp    8008a8 <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  80062c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062f:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800632:	8b 10                	mov    (%eax),%edx
+  800634:	89 d0                	mov    %edx,%eax
+  800636:	f7 d8                	neg    %eax
+  800638:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80063b:	83 f8 10             	cmp    $0x10,%eax
+  80063e:	7f 23                	jg     800663 <vprintfmt+0x15c>
+  800640:	8b 14 85 a0 2f 80 00 	mov    0x802fa0(,%eax,4),%edx
+  800647:	85 d2                	test   %edx,%edx
+  800649:	74 18                	je     800663 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  80064b:	52                   	push   %edx
+  80064c:	68 e5 31 80 00       	push   $0x8031e5
+  800651:	53                   	push   %ebx
+  800652:	56                   	push   %esi
+  800653:	e8 92 fe ff ff       	call   8004ea <printfmt>
+  800658:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80065b:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80065e:	e9 45 02 00 00       	jmp    8008a8 <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  800663:	50                   	push   %eax
+  800664:	68 13 2d 80 00       	push   $0x802d13
+  800669:	53                   	push   %ebx
+  80066a:	56                   	push   %esi
+  80066b:	e8 7a fe ff ff       	call   8004ea <printfmt>
+  800670:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800673:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800676:	e9 2d 02 00 00       	jmp    8008a8 <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80067b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067e:	83 c0 04             	add    $0x4,%eax
+  800681:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800684:	8b 45 14             	mov    0x14(%ebp),%eax
+  800687:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800689:	85 c9                	test   %ecx,%ecx
+  80068b:	b8 0c 2d 80 00       	mov    $0x802d0c,%eax
+  800690:	0f 45 c1             	cmovne %ecx,%eax
+  800693:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800696:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80069a:	7e 06                	jle    8006a2 <vprintfmt+0x19b>
+  80069c:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8006a0:	75 0b                	jne    8006ad <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8006a2:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8006a5:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8006a8:	89 75 08             	mov    %esi,0x8(%ebp)
+  8006ab:	eb 5c                	jmp    800709 <vprintfmt+0x202>
+  8006ad:	83 ec 08             	sub    $0x8,%esp
+  8006b0:	ff 75 d0             	push   -0x30(%ebp)
+  8006b3:	ff 75 cc             	push   -0x34(%ebp)
+  8006b6:	e8 eb 02 00 00       	call   8009a6 <strnlen>
+  8006bb:	89 c2                	mov    %eax,%edx
+  8006bd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006c0:	29 d0                	sub    %edx,%eax
+  8006c2:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8006c5:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8006c9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006cc:	89 75 08             	mov    %esi,0x8(%ebp)
+  8006cf:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8006d1:	eb 0e                	jmp    8006e1 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8006d3:	83 ec 08             	sub    $0x8,%esp
+  8006d6:	53                   	push   %ebx
+  8006d7:	57                   	push   %edi
+  8006d8:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8006db:	83 ee 01             	sub    $0x1,%esi
+  8006de:	83 c4 10             	add    $0x10,%esp
+  8006e1:	85 f6                	test   %esi,%esi
+  8006e3:	7f ee                	jg     8006d3 <vprintfmt+0x1cc>
+  8006e5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006e8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006eb:	85 c0                	test   %eax,%eax
+  8006ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006f2:	0f 49 d0             	cmovns %eax,%edx
+  8006f5:	29 d0                	sub    %edx,%eax
+  8006f7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006fa:	eb a6                	jmp    8006a2 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8006fc:	83 ec 08             	sub    $0x8,%esp
+  8006ff:	53                   	push   %ebx
+  800700:	52                   	push   %edx
+  800701:	ff 55 08             	call   *0x8(%ebp)
+  800704:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800707:	89 f1                	mov    %esi,%ecx
+  800709:	8d 71 01             	lea    0x1(%ecx),%esi
+  80070c:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800710:	0f be d0             	movsbl %al,%edx
+  800713:	85 d2                	test   %edx,%edx
+  800715:	74 28                	je     80073f <vprintfmt+0x238>
+  800717:	85 ff                	test   %edi,%edi
+  800719:	78 05                	js     800720 <vprintfmt+0x219>
+  80071b:	83 ef 01             	sub    $0x1,%edi
+  80071e:	78 30                	js     800750 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800720:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800724:	74 d6                	je     8006fc <vprintfmt+0x1f5>
+  800726:	0f be c0             	movsbl %al,%eax
+  800729:	83 e8 20             	sub    $0x20,%eax
+  80072c:	83 f8 5e             	cmp    $0x5e,%eax
+  80072f:	76 cb                	jbe    8006fc <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800731:	83 ec 08             	sub    $0x8,%esp
+  800734:	53                   	push   %ebx
+  800735:	6a 3f                	push   $0x3f
+  800737:	ff 55 08             	call   *0x8(%ebp)
+  80073a:	83 c4 10             	add    $0x10,%esp
+  80073d:	eb c8                	jmp    800707 <vprintfmt+0x200>
+  80073f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800742:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800745:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800748:	01 d0                	add    %edx,%eax
+  80074a:	29 c8                	sub    %ecx,%eax
+  80074c:	89 c7                	mov    %eax,%edi
+  80074e:	eb 13                	jmp    800763 <vprintfmt+0x25c>
+  800750:	8b 75 08             	mov    0x8(%ebp),%esi
+  800753:	eb ed                	jmp    800742 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800755:	83 ec 08             	sub    $0x8,%esp
+  800758:	53                   	push   %ebx
+  800759:	6a 20                	push   $0x20
+  80075b:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80075d:	83 ef 01             	sub    $0x1,%edi
+  800760:	83 c4 10             	add    $0x10,%esp
+  800763:	85 ff                	test   %edi,%edi
+  800765:	7f ee                	jg     800755 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800767:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80076a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80076d:	e9 36 01 00 00       	jmp    8008a8 <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  800772:	83 f9 01             	cmp    $0x1,%ecx
+  800775:	7f 1f                	jg     800796 <vprintfmt+0x28f>
+	else if (lflag)
+  800777:	85 c9                	test   %ecx,%ecx
+  800779:	74 67                	je     8007e2 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  80077b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077e:	8b 00                	mov    (%eax),%eax
+  800780:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800783:	89 c1                	mov    %eax,%ecx
+  800785:	c1 f9 1f             	sar    $0x1f,%ecx
+  800788:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80078b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80078e:	8d 40 04             	lea    0x4(%eax),%eax
+  800791:	89 45 14             	mov    %eax,0x14(%ebp)
+  800794:	eb 17                	jmp    8007ad <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800796:	8b 45 14             	mov    0x14(%ebp),%eax
+  800799:	8b 50 04             	mov    0x4(%eax),%edx
+  80079c:	8b 00                	mov    (%eax),%eax
+  80079e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007a1:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8007a4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a7:	8d 40 08             	lea    0x8(%eax),%eax
+  8007aa:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8007ad:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007b0:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8007b3:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8007b8:	85 c9                	test   %ecx,%ecx
+  8007ba:	0f 89 ce 00 00 00    	jns    80088e <vprintfmt+0x387>
+				putch('-', putdat);
+  8007c0:	83 ec 08             	sub    $0x8,%esp
+  8007c3:	53                   	push   %ebx
+  8007c4:	6a 2d                	push   $0x2d
+  8007c6:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8007c8:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007cb:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8007ce:	f7 da                	neg    %edx
+  8007d0:	83 d1 00             	adc    $0x0,%ecx
+  8007d3:	f7 d9                	neg    %ecx
+  8007d5:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8007d8:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8007dd:	e9 ac 00 00 00       	jmp    80088e <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  8007e2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e5:	8b 00                	mov    (%eax),%eax
+  8007e7:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007ea:	89 c1                	mov    %eax,%ecx
+  8007ec:	c1 f9 1f             	sar    $0x1f,%ecx
+  8007ef:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8007f2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007f5:	8d 40 04             	lea    0x4(%eax),%eax
+  8007f8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007fb:	eb b0                	jmp    8007ad <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8007fd:	83 f9 01             	cmp    $0x1,%ecx
+  800800:	7f 1b                	jg     80081d <vprintfmt+0x316>
+	else if (lflag)
+  800802:	85 c9                	test   %ecx,%ecx
+  800804:	74 2c                	je     800832 <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  800806:	8b 45 14             	mov    0x14(%ebp),%eax
+  800809:	8b 10                	mov    (%eax),%edx
+  80080b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800810:	8d 40 04             	lea    0x4(%eax),%eax
+  800813:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800816:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80081b:	eb 71                	jmp    80088e <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  80081d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800820:	8b 10                	mov    (%eax),%edx
+  800822:	8b 48 04             	mov    0x4(%eax),%ecx
+  800825:	8d 40 08             	lea    0x8(%eax),%eax
+  800828:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80082b:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800830:	eb 5c                	jmp    80088e <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  800832:	8b 45 14             	mov    0x14(%ebp),%eax
+  800835:	8b 10                	mov    (%eax),%edx
+  800837:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80083c:	8d 40 04             	lea    0x4(%eax),%eax
+  80083f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800842:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800847:	eb 45                	jmp    80088e <vprintfmt+0x387>
+			putch('X', putdat);
+  800849:	83 ec 08             	sub    $0x8,%esp
+  80084c:	53                   	push   %ebx
+  80084d:	6a 58                	push   $0x58
+  80084f:	ff d6                	call   *%esi
+			putch('X', putdat);
+  800851:	83 c4 08             	add    $0x8,%esp
+  800854:	53                   	push   %ebx
+  800855:	6a 58                	push   $0x58
+  800857:	ff d6                	call   *%esi
+			putch('X', putdat);
+  800859:	83 c4 08             	add    $0x8,%esp
+  80085c:	53                   	push   %ebx
+  80085d:	6a 58                	push   $0x58
+  80085f:	ff d6                	call   *%esi
+			break;
+  800861:	83 c4 10             	add    $0x10,%esp
+  800864:	eb 42                	jmp    8008a8 <vprintfmt+0x3a1>
+			putch('0', putdat);
+  800866:	83 ec 08             	sub    $0x8,%esp
+  800869:	53                   	push   %ebx
+  80086a:	6a 30                	push   $0x30
+  80086c:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80086e:	83 c4 08             	add    $0x8,%esp
+  800871:	53                   	push   %ebx
+  800872:	6a 78                	push   $0x78
+  800874:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800876:	8b 45 14             	mov    0x14(%ebp),%eax
+  800879:	8b 10                	mov    (%eax),%edx
+  80087b:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800880:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800883:	8d 40 04             	lea    0x4(%eax),%eax
+  800886:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800889:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80088e:	83 ec 0c             	sub    $0xc,%esp
+  800891:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800895:	50                   	push   %eax
+  800896:	ff 75 e0             	push   -0x20(%ebp)
+  800899:	57                   	push   %edi
+  80089a:	51                   	push   %ecx
+  80089b:	52                   	push   %edx
+  80089c:	89 da                	mov    %ebx,%edx
+  80089e:	89 f0                	mov    %esi,%eax
+  8008a0:	e8 7f fb ff ff       	call   800424 <printnum>
+			break;
+  8008a5:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8008a8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8008ab:	e9 75 fc ff ff       	jmp    800525 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8008b0:	83 f9 01             	cmp    $0x1,%ecx
+  8008b3:	7f 1b                	jg     8008d0 <vprintfmt+0x3c9>
+	else if (lflag)
+  8008b5:	85 c9                	test   %ecx,%ecx
+  8008b7:	74 2c                	je     8008e5 <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  8008b9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008bc:	8b 10                	mov    (%eax),%edx
+  8008be:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008c3:	8d 40 04             	lea    0x4(%eax),%eax
+  8008c6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008c9:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8008ce:	eb be                	jmp    80088e <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  8008d0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008d3:	8b 10                	mov    (%eax),%edx
+  8008d5:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008d8:	8d 40 08             	lea    0x8(%eax),%eax
+  8008db:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008de:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8008e3:	eb a9                	jmp    80088e <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  8008e5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008e8:	8b 10                	mov    (%eax),%edx
+  8008ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008ef:	8d 40 04             	lea    0x4(%eax),%eax
+  8008f2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008f5:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8008fa:	eb 92                	jmp    80088e <vprintfmt+0x387>
+			putch(ch, putdat);
+  8008fc:	83 ec 08             	sub    $0x8,%esp
+  8008ff:	53                   	push   %ebx
+  800900:	6a 25                	push   $0x25
+  800902:	ff d6                	call   *%esi
+			break;
+  800904:	83 c4 10             	add    $0x10,%esp
+  800907:	eb 9f                	jmp    8008a8 <vprintfmt+0x3a1>
+			putch('%', putdat);
+  800909:	83 ec 08             	sub    $0x8,%esp
+  80090c:	53                   	push   %ebx
+  80090d:	6a 25                	push   $0x25
+  80090f:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800911:	83 c4 10             	add    $0x10,%esp
+  800914:	89 f8                	mov    %edi,%eax
+  800916:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80091a:	74 05                	je     800921 <vprintfmt+0x41a>
+  80091c:	83 e8 01             	sub    $0x1,%eax
+  80091f:	eb f5                	jmp    800916 <vprintfmt+0x40f>
+  800921:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800924:	eb 82                	jmp    8008a8 <vprintfmt+0x3a1>
+
+00800926 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800926:	55                   	push   %ebp
+  800927:	89 e5                	mov    %esp,%ebp
+  800929:	83 ec 18             	sub    $0x18,%esp
+  80092c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80092f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800932:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800935:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800939:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80093c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800943:	85 c0                	test   %eax,%eax
+  800945:	74 26                	je     80096d <vsnprintf+0x47>
+  800947:	85 d2                	test   %edx,%edx
+  800949:	7e 22                	jle    80096d <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80094b:	ff 75 14             	push   0x14(%ebp)
+  80094e:	ff 75 10             	push   0x10(%ebp)
+  800951:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800954:	50                   	push   %eax
+  800955:	68 cd 04 80 00       	push   $0x8004cd
+  80095a:	e8 a8 fb ff ff       	call   800507 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80095f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800962:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800965:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800968:	83 c4 10             	add    $0x10,%esp
+}
+  80096b:	c9                   	leave
+  80096c:	c3                   	ret
+		return -E_INVAL;
+  80096d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800972:	eb f7                	jmp    80096b <vsnprintf+0x45>
+
+00800974 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800974:	55                   	push   %ebp
+  800975:	89 e5                	mov    %esp,%ebp
+  800977:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80097a:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80097d:	50                   	push   %eax
+  80097e:	ff 75 10             	push   0x10(%ebp)
+  800981:	ff 75 0c             	push   0xc(%ebp)
+  800984:	ff 75 08             	push   0x8(%ebp)
+  800987:	e8 9a ff ff ff       	call   800926 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80098c:	c9                   	leave
+  80098d:	c3                   	ret
+
+0080098e <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80098e:	55                   	push   %ebp
+  80098f:	89 e5                	mov    %esp,%ebp
+  800991:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800994:	b8 00 00 00 00       	mov    $0x0,%eax
+  800999:	eb 03                	jmp    80099e <strlen+0x10>
+		n++;
+  80099b:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80099e:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8009a2:	75 f7                	jne    80099b <strlen+0xd>
+	return n;
+}
+  8009a4:	5d                   	pop    %ebp
+  8009a5:	c3                   	ret
+
+008009a6 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8009a6:	55                   	push   %ebp
+  8009a7:	89 e5                	mov    %esp,%ebp
+  8009a9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009ac:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009b4:	eb 03                	jmp    8009b9 <strnlen+0x13>
+		n++;
+  8009b6:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009b9:	39 d0                	cmp    %edx,%eax
+  8009bb:	74 08                	je     8009c5 <strnlen+0x1f>
+  8009bd:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8009c1:	75 f3                	jne    8009b6 <strnlen+0x10>
+  8009c3:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8009c5:	89 d0                	mov    %edx,%eax
+  8009c7:	5d                   	pop    %ebp
+  8009c8:	c3                   	ret
+
+008009c9 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8009c9:	55                   	push   %ebp
+  8009ca:	89 e5                	mov    %esp,%ebp
+  8009cc:	53                   	push   %ebx
+  8009cd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009d0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8009d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009d8:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8009dc:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8009df:	83 c0 01             	add    $0x1,%eax
+  8009e2:	84 d2                	test   %dl,%dl
+  8009e4:	75 f2                	jne    8009d8 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8009e6:	89 c8                	mov    %ecx,%eax
+  8009e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009eb:	c9                   	leave
+  8009ec:	c3                   	ret
+
+008009ed <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8009ed:	55                   	push   %ebp
+  8009ee:	89 e5                	mov    %esp,%ebp
+  8009f0:	53                   	push   %ebx
+  8009f1:	83 ec 10             	sub    $0x10,%esp
+  8009f4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8009f7:	53                   	push   %ebx
+  8009f8:	e8 91 ff ff ff       	call   80098e <strlen>
+  8009fd:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800a00:	ff 75 0c             	push   0xc(%ebp)
+  800a03:	01 d8                	add    %ebx,%eax
+  800a05:	50                   	push   %eax
+  800a06:	e8 be ff ff ff       	call   8009c9 <strcpy>
+	return dst;
+}
+  800a0b:	89 d8                	mov    %ebx,%eax
+  800a0d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a10:	c9                   	leave
+  800a11:	c3                   	ret
+
+00800a12 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800a12:	55                   	push   %ebp
+  800a13:	89 e5                	mov    %esp,%ebp
+  800a15:	56                   	push   %esi
+  800a16:	53                   	push   %ebx
+  800a17:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a1a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800a1d:	89 f3                	mov    %esi,%ebx
+  800a1f:	03 5d 10             	add    0x10(%ebp),%ebx
+  800a22:	89 f0                	mov    %esi,%eax
+  800a24:	eb 0f                	jmp    800a35 <strncpy+0x23>
+		*dst++ = *src;
+  800a26:	83 c0 01             	add    $0x1,%eax
+  800a29:	0f b6 0a             	movzbl (%edx),%ecx
+  800a2c:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800a2f:	80 f9 01             	cmp    $0x1,%cl
+  800a32:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800a35:	39 d8                	cmp    %ebx,%eax
+  800a37:	75 ed                	jne    800a26 <strncpy+0x14>
+	}
+	return ret;
+}
+  800a39:	89 f0                	mov    %esi,%eax
+  800a3b:	5b                   	pop    %ebx
+  800a3c:	5e                   	pop    %esi
+  800a3d:	5d                   	pop    %ebp
+  800a3e:	c3                   	ret
+
+00800a3f <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800a3f:	55                   	push   %ebp
+  800a40:	89 e5                	mov    %esp,%ebp
+  800a42:	56                   	push   %esi
+  800a43:	53                   	push   %ebx
+  800a44:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a47:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a4a:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800a4d:	89 f0                	mov    %esi,%eax
+  800a4f:	85 d2                	test   %edx,%edx
+  800a51:	74 21                	je     800a74 <strlcpy+0x35>
+  800a53:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800a57:	89 f2                	mov    %esi,%edx
+  800a59:	eb 09                	jmp    800a64 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800a5b:	83 c1 01             	add    $0x1,%ecx
+  800a5e:	83 c2 01             	add    $0x1,%edx
+  800a61:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800a64:	39 c2                	cmp    %eax,%edx
+  800a66:	74 09                	je     800a71 <strlcpy+0x32>
+  800a68:	0f b6 19             	movzbl (%ecx),%ebx
+  800a6b:	84 db                	test   %bl,%bl
+  800a6d:	75 ec                	jne    800a5b <strlcpy+0x1c>
+  800a6f:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800a71:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800a74:	29 f0                	sub    %esi,%eax
+}
+  800a76:	5b                   	pop    %ebx
+  800a77:	5e                   	pop    %esi
+  800a78:	5d                   	pop    %ebp
+  800a79:	c3                   	ret
+
+00800a7a <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800a7a:	55                   	push   %ebp
+  800a7b:	89 e5                	mov    %esp,%ebp
+  800a7d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a80:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800a83:	eb 06                	jmp    800a8b <strcmp+0x11>
+		p++, q++;
+  800a85:	83 c1 01             	add    $0x1,%ecx
+  800a88:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800a8b:	0f b6 01             	movzbl (%ecx),%eax
+  800a8e:	84 c0                	test   %al,%al
+  800a90:	74 04                	je     800a96 <strcmp+0x1c>
+  800a92:	3a 02                	cmp    (%edx),%al
+  800a94:	74 ef                	je     800a85 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a96:	0f b6 c0             	movzbl %al,%eax
+  800a99:	0f b6 12             	movzbl (%edx),%edx
+  800a9c:	29 d0                	sub    %edx,%eax
+}
+  800a9e:	5d                   	pop    %ebp
+  800a9f:	c3                   	ret
+
+00800aa0 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800aa0:	55                   	push   %ebp
+  800aa1:	89 e5                	mov    %esp,%ebp
+  800aa3:	53                   	push   %ebx
+  800aa4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aa7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800aaa:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800aad:	eb 09                	jmp    800ab8 <strncmp+0x18>
+		n--, p++, q++;
+  800aaf:	83 ea 01             	sub    $0x1,%edx
+  800ab2:	83 c0 01             	add    $0x1,%eax
+  800ab5:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800ab8:	85 d2                	test   %edx,%edx
+  800aba:	74 18                	je     800ad4 <strncmp+0x34>
+  800abc:	0f b6 18             	movzbl (%eax),%ebx
+  800abf:	84 db                	test   %bl,%bl
+  800ac1:	74 04                	je     800ac7 <strncmp+0x27>
+  800ac3:	3a 19                	cmp    (%ecx),%bl
+  800ac5:	74 e8                	je     800aaf <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800ac7:	0f b6 00             	movzbl (%eax),%eax
+  800aca:	0f b6 11             	movzbl (%ecx),%edx
+  800acd:	29 d0                	sub    %edx,%eax
+}
+  800acf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ad2:	c9                   	leave
+  800ad3:	c3                   	ret
+		return 0;
+  800ad4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ad9:	eb f4                	jmp    800acf <strncmp+0x2f>
+
+00800adb <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800adb:	55                   	push   %ebp
+  800adc:	89 e5                	mov    %esp,%ebp
+  800ade:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ae1:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800ae5:	eb 03                	jmp    800aea <strchr+0xf>
+  800ae7:	83 c0 01             	add    $0x1,%eax
+  800aea:	0f b6 10             	movzbl (%eax),%edx
+  800aed:	84 d2                	test   %dl,%dl
+  800aef:	74 06                	je     800af7 <strchr+0x1c>
+		if (*s == c)
+  800af1:	38 ca                	cmp    %cl,%dl
+  800af3:	75 f2                	jne    800ae7 <strchr+0xc>
+  800af5:	eb 05                	jmp    800afc <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800af7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800afc:	5d                   	pop    %ebp
+  800afd:	c3                   	ret
+
+00800afe <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800afe:	55                   	push   %ebp
+  800aff:	89 e5                	mov    %esp,%ebp
+  800b01:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b04:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b08:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800b0b:	38 ca                	cmp    %cl,%dl
+  800b0d:	74 09                	je     800b18 <strfind+0x1a>
+  800b0f:	84 d2                	test   %dl,%dl
+  800b11:	74 05                	je     800b18 <strfind+0x1a>
+	for (; *s; s++)
+  800b13:	83 c0 01             	add    $0x1,%eax
+  800b16:	eb f0                	jmp    800b08 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800b18:	5d                   	pop    %ebp
+  800b19:	c3                   	ret
+
+00800b1a <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800b1a:	55                   	push   %ebp
+  800b1b:	89 e5                	mov    %esp,%ebp
+  800b1d:	57                   	push   %edi
+  800b1e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b21:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800b24:	85 c9                	test   %ecx,%ecx
+  800b26:	74 20                	je     800b48 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800b28:	89 f8                	mov    %edi,%eax
+  800b2a:	09 c8                	or     %ecx,%eax
+  800b2c:	a8 03                	test   $0x3,%al
+  800b2e:	75 12                	jne    800b42 <memset+0x28>
+		c &= 0xFF;
+  800b30:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800b34:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800b3a:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800b3d:	fc                   	cld
+  800b3e:	f3 ab                	rep stos %eax,%es:(%edi)
+  800b40:	eb 06                	jmp    800b48 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800b42:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b45:	fc                   	cld
+  800b46:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800b48:	89 f8                	mov    %edi,%eax
+  800b4a:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800b4d:	c9                   	leave
+  800b4e:	c3                   	ret
+
+00800b4f <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800b4f:	55                   	push   %ebp
+  800b50:	89 e5                	mov    %esp,%ebp
+  800b52:	57                   	push   %edi
+  800b53:	56                   	push   %esi
+  800b54:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b57:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b5a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800b5d:	39 c6                	cmp    %eax,%esi
+  800b5f:	73 32                	jae    800b93 <memmove+0x44>
+  800b61:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800b64:	39 d0                	cmp    %edx,%eax
+  800b66:	73 2b                	jae    800b93 <memmove+0x44>
+		s += n;
+		d += n;
+  800b68:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b6b:	89 d6                	mov    %edx,%esi
+  800b6d:	09 fe                	or     %edi,%esi
+  800b6f:	09 ce                	or     %ecx,%esi
+  800b71:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800b77:	75 0e                	jne    800b87 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800b79:	83 ef 04             	sub    $0x4,%edi
+  800b7c:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800b7f:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800b82:	fd                   	std
+  800b83:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b85:	eb 09                	jmp    800b90 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800b87:	83 ef 01             	sub    $0x1,%edi
+  800b8a:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800b8d:	fd                   	std
+  800b8e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800b90:	fc                   	cld
+  800b91:	eb 1a                	jmp    800bad <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b93:	89 f2                	mov    %esi,%edx
+  800b95:	09 c2                	or     %eax,%edx
+  800b97:	09 ca                	or     %ecx,%edx
+  800b99:	f6 c2 03             	test   $0x3,%dl
+  800b9c:	75 0a                	jne    800ba8 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800b9e:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800ba1:	89 c7                	mov    %eax,%edi
+  800ba3:	fc                   	cld
+  800ba4:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ba6:	eb 05                	jmp    800bad <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800ba8:	89 c7                	mov    %eax,%edi
+  800baa:	fc                   	cld
+  800bab:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800bad:	5e                   	pop    %esi
+  800bae:	5f                   	pop    %edi
+  800baf:	5d                   	pop    %ebp
+  800bb0:	c3                   	ret
+
+00800bb1 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800bb1:	55                   	push   %ebp
+  800bb2:	89 e5                	mov    %esp,%ebp
+  800bb4:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800bb7:	ff 75 10             	push   0x10(%ebp)
+  800bba:	ff 75 0c             	push   0xc(%ebp)
+  800bbd:	ff 75 08             	push   0x8(%ebp)
+  800bc0:	e8 8a ff ff ff       	call   800b4f <memmove>
+}
+  800bc5:	c9                   	leave
+  800bc6:	c3                   	ret
+
+00800bc7 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800bc7:	55                   	push   %ebp
+  800bc8:	89 e5                	mov    %esp,%ebp
+  800bca:	56                   	push   %esi
+  800bcb:	53                   	push   %ebx
+  800bcc:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bcf:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800bd2:	89 c6                	mov    %eax,%esi
+  800bd4:	03 75 10             	add    0x10(%ebp),%esi
+  800bd7:	eb 06                	jmp    800bdf <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800bd9:	83 c0 01             	add    $0x1,%eax
+  800bdc:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800bdf:	39 f0                	cmp    %esi,%eax
+  800be1:	74 14                	je     800bf7 <memcmp+0x30>
+		if (*s1 != *s2)
+  800be3:	0f b6 08             	movzbl (%eax),%ecx
+  800be6:	0f b6 1a             	movzbl (%edx),%ebx
+  800be9:	38 d9                	cmp    %bl,%cl
+  800beb:	74 ec                	je     800bd9 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800bed:	0f b6 c1             	movzbl %cl,%eax
+  800bf0:	0f b6 db             	movzbl %bl,%ebx
+  800bf3:	29 d8                	sub    %ebx,%eax
+  800bf5:	eb 05                	jmp    800bfc <memcmp+0x35>
+	}
+
+	return 0;
+  800bf7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800bfc:	5b                   	pop    %ebx
+  800bfd:	5e                   	pop    %esi
+  800bfe:	5d                   	pop    %ebp
+  800bff:	c3                   	ret
+
+00800c00 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800c00:	55                   	push   %ebp
+  800c01:	89 e5                	mov    %esp,%ebp
+  800c03:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c06:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800c09:	89 c2                	mov    %eax,%edx
+  800c0b:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800c0e:	eb 03                	jmp    800c13 <memfind+0x13>
+  800c10:	83 c0 01             	add    $0x1,%eax
+  800c13:	39 d0                	cmp    %edx,%eax
+  800c15:	73 04                	jae    800c1b <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800c17:	38 08                	cmp    %cl,(%eax)
+  800c19:	75 f5                	jne    800c10 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800c1b:	5d                   	pop    %ebp
+  800c1c:	c3                   	ret
+
+00800c1d <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800c1d:	55                   	push   %ebp
+  800c1e:	89 e5                	mov    %esp,%ebp
+  800c20:	57                   	push   %edi
+  800c21:	56                   	push   %esi
+  800c22:	53                   	push   %ebx
+  800c23:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c26:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800c29:	eb 03                	jmp    800c2e <strtol+0x11>
+		s++;
+  800c2b:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800c2e:	0f b6 02             	movzbl (%edx),%eax
+  800c31:	3c 20                	cmp    $0x20,%al
+  800c33:	74 f6                	je     800c2b <strtol+0xe>
+  800c35:	3c 09                	cmp    $0x9,%al
+  800c37:	74 f2                	je     800c2b <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800c39:	3c 2b                	cmp    $0x2b,%al
+  800c3b:	74 2a                	je     800c67 <strtol+0x4a>
+	int neg = 0;
+  800c3d:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800c42:	3c 2d                	cmp    $0x2d,%al
+  800c44:	74 2b                	je     800c71 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c46:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800c4c:	75 0f                	jne    800c5d <strtol+0x40>
+  800c4e:	80 3a 30             	cmpb   $0x30,(%edx)
+  800c51:	74 28                	je     800c7b <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800c53:	85 db                	test   %ebx,%ebx
+  800c55:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c5a:	0f 44 d8             	cmove  %eax,%ebx
+  800c5d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c62:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800c65:	eb 46                	jmp    800cad <strtol+0x90>
+		s++;
+  800c67:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800c6a:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c6f:	eb d5                	jmp    800c46 <strtol+0x29>
+		s++, neg = 1;
+  800c71:	83 c2 01             	add    $0x1,%edx
+  800c74:	bf 01 00 00 00       	mov    $0x1,%edi
+  800c79:	eb cb                	jmp    800c46 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c7b:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800c7f:	74 0e                	je     800c8f <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800c81:	85 db                	test   %ebx,%ebx
+  800c83:	75 d8                	jne    800c5d <strtol+0x40>
+		s++, base = 8;
+  800c85:	83 c2 01             	add    $0x1,%edx
+  800c88:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800c8d:	eb ce                	jmp    800c5d <strtol+0x40>
+		s += 2, base = 16;
+  800c8f:	83 c2 02             	add    $0x2,%edx
+  800c92:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800c97:	eb c4                	jmp    800c5d <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800c99:	0f be c0             	movsbl %al,%eax
+  800c9c:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800c9f:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800ca2:	7d 3a                	jge    800cde <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800ca4:	83 c2 01             	add    $0x1,%edx
+  800ca7:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800cab:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800cad:	0f b6 02             	movzbl (%edx),%eax
+  800cb0:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800cb3:	89 f3                	mov    %esi,%ebx
+  800cb5:	80 fb 09             	cmp    $0x9,%bl
+  800cb8:	76 df                	jbe    800c99 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800cba:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800cbd:	89 f3                	mov    %esi,%ebx
+  800cbf:	80 fb 19             	cmp    $0x19,%bl
+  800cc2:	77 08                	ja     800ccc <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800cc4:	0f be c0             	movsbl %al,%eax
+  800cc7:	83 e8 57             	sub    $0x57,%eax
+  800cca:	eb d3                	jmp    800c9f <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800ccc:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800ccf:	89 f3                	mov    %esi,%ebx
+  800cd1:	80 fb 19             	cmp    $0x19,%bl
+  800cd4:	77 08                	ja     800cde <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800cd6:	0f be c0             	movsbl %al,%eax
+  800cd9:	83 e8 37             	sub    $0x37,%eax
+  800cdc:	eb c1                	jmp    800c9f <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800cde:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800ce2:	74 05                	je     800ce9 <strtol+0xcc>
+		*endptr = (char *) s;
+  800ce4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ce7:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800ce9:	89 c8                	mov    %ecx,%eax
+  800ceb:	f7 d8                	neg    %eax
+  800ced:	85 ff                	test   %edi,%edi
+  800cef:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800cf2:	89 c8                	mov    %ecx,%eax
+  800cf4:	5b                   	pop    %ebx
+  800cf5:	5e                   	pop    %esi
+  800cf6:	5f                   	pop    %edi
+  800cf7:	5d                   	pop    %ebp
+  800cf8:	c3                   	ret
+
+00800cf9 <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800cf9:	55                   	push   %ebp
+  800cfa:	89 e5                	mov    %esp,%ebp
+  800cfc:	57                   	push   %edi
+  800cfd:	56                   	push   %esi
+  800cfe:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800cff:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d04:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d07:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d0a:	89 c3                	mov    %eax,%ebx
+  800d0c:	89 c7                	mov    %eax,%edi
+  800d0e:	89 c6                	mov    %eax,%esi
+  800d10:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  800d12:	5b                   	pop    %ebx
+  800d13:	5e                   	pop    %esi
+  800d14:	5f                   	pop    %edi
+  800d15:	5d                   	pop    %ebp
+  800d16:	c3                   	ret
+
+00800d17 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800d17:	55                   	push   %ebp
+  800d18:	89 e5                	mov    %esp,%ebp
+  800d1a:	57                   	push   %edi
+  800d1b:	56                   	push   %esi
+  800d1c:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d1d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d22:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d27:	89 d1                	mov    %edx,%ecx
+  800d29:	89 d3                	mov    %edx,%ebx
+  800d2b:	89 d7                	mov    %edx,%edi
+  800d2d:	89 d6                	mov    %edx,%esi
+  800d2f:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800d31:	5b                   	pop    %ebx
+  800d32:	5e                   	pop    %esi
+  800d33:	5f                   	pop    %edi
+  800d34:	5d                   	pop    %ebp
+  800d35:	c3                   	ret
+
+00800d36 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800d36:	55                   	push   %ebp
+  800d37:	89 e5                	mov    %esp,%ebp
+  800d39:	57                   	push   %edi
+  800d3a:	56                   	push   %esi
+  800d3b:	53                   	push   %ebx
+  800d3c:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800d3f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d44:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d47:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d4c:	89 cb                	mov    %ecx,%ebx
+  800d4e:	89 cf                	mov    %ecx,%edi
+  800d50:	89 ce                	mov    %ecx,%esi
+  800d52:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d54:	85 c0                	test   %eax,%eax
+  800d56:	7f 08                	jg     800d60 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800d58:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d5b:	5b                   	pop    %ebx
+  800d5c:	5e                   	pop    %esi
+  800d5d:	5f                   	pop    %edi
+  800d5e:	5d                   	pop    %ebp
+  800d5f:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d60:	83 ec 0c             	sub    $0xc,%esp
+  800d63:	50                   	push   %eax
+  800d64:	6a 03                	push   $0x3
+  800d66:	68 03 30 80 00       	push   $0x803003
+  800d6b:	6a 3e                	push   $0x3e
+  800d6d:	68 20 30 80 00       	push   $0x803020
+  800d72:	e8 be f5 ff ff       	call   800335 <_panic>
+
+00800d77 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800d77:	55                   	push   %ebp
+  800d78:	89 e5                	mov    %esp,%ebp
+  800d7a:	57                   	push   %edi
+  800d7b:	56                   	push   %esi
+  800d7c:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d7d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d82:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d87:	89 d1                	mov    %edx,%ecx
+  800d89:	89 d3                	mov    %edx,%ebx
+  800d8b:	89 d7                	mov    %edx,%edi
+  800d8d:	89 d6                	mov    %edx,%esi
+  800d8f:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800d91:	5b                   	pop    %ebx
+  800d92:	5e                   	pop    %esi
+  800d93:	5f                   	pop    %edi
+  800d94:	5d                   	pop    %ebp
+  800d95:	c3                   	ret
+
+00800d96 <sys_yield>:
+
+void
+sys_yield(void) {
+  800d96:	55                   	push   %ebp
+  800d97:	89 e5                	mov    %esp,%ebp
+  800d99:	57                   	push   %edi
+  800d9a:	56                   	push   %esi
+  800d9b:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d9c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800da1:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800da6:	89 d1                	mov    %edx,%ecx
+  800da8:	89 d3                	mov    %edx,%ebx
+  800daa:	89 d7                	mov    %edx,%edi
+  800dac:	89 d6                	mov    %edx,%esi
+  800dae:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800db0:	5b                   	pop    %ebx
+  800db1:	5e                   	pop    %esi
+  800db2:	5f                   	pop    %edi
+  800db3:	5d                   	pop    %ebp
+  800db4:	c3                   	ret
+
+00800db5 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  800db5:	55                   	push   %ebp
+  800db6:	89 e5                	mov    %esp,%ebp
+  800db8:	57                   	push   %edi
+  800db9:	56                   	push   %esi
+  800dba:	53                   	push   %ebx
+  800dbb:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800dbe:	be 00 00 00 00       	mov    $0x0,%esi
+  800dc3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dc9:	b8 04 00 00 00       	mov    $0x4,%eax
+  800dce:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dd1:	89 f7                	mov    %esi,%edi
+  800dd3:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800dd5:	85 c0                	test   %eax,%eax
+  800dd7:	7f 08                	jg     800de1 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800dd9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ddc:	5b                   	pop    %ebx
+  800ddd:	5e                   	pop    %esi
+  800dde:	5f                   	pop    %edi
+  800ddf:	5d                   	pop    %ebp
+  800de0:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800de1:	83 ec 0c             	sub    $0xc,%esp
+  800de4:	50                   	push   %eax
+  800de5:	6a 04                	push   $0x4
+  800de7:	68 03 30 80 00       	push   $0x803003
+  800dec:	6a 3e                	push   $0x3e
+  800dee:	68 20 30 80 00       	push   $0x803020
+  800df3:	e8 3d f5 ff ff       	call   800335 <_panic>
+
+00800df8 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  800df8:	55                   	push   %ebp
+  800df9:	89 e5                	mov    %esp,%ebp
+  800dfb:	57                   	push   %edi
+  800dfc:	56                   	push   %esi
+  800dfd:	53                   	push   %ebx
+  800dfe:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800e01:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e04:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e07:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e0c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e0f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e12:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e15:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e17:	85 c0                	test   %eax,%eax
+  800e19:	7f 08                	jg     800e23 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800e1b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e1e:	5b                   	pop    %ebx
+  800e1f:	5e                   	pop    %esi
+  800e20:	5f                   	pop    %edi
+  800e21:	5d                   	pop    %ebp
+  800e22:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e23:	83 ec 0c             	sub    $0xc,%esp
+  800e26:	50                   	push   %eax
+  800e27:	6a 05                	push   $0x5
+  800e29:	68 03 30 80 00       	push   $0x803003
+  800e2e:	6a 3e                	push   $0x3e
+  800e30:	68 20 30 80 00       	push   $0x803020
+  800e35:	e8 fb f4 ff ff       	call   800335 <_panic>
+
+00800e3a <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  800e3a:	55                   	push   %ebp
+  800e3b:	89 e5                	mov    %esp,%ebp
+  800e3d:	57                   	push   %edi
+  800e3e:	56                   	push   %esi
+  800e3f:	53                   	push   %ebx
+  800e40:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800e43:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e48:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e4b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e4e:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e53:	89 df                	mov    %ebx,%edi
+  800e55:	89 de                	mov    %ebx,%esi
+  800e57:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e59:	85 c0                	test   %eax,%eax
+  800e5b:	7f 08                	jg     800e65 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e5d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e60:	5b                   	pop    %ebx
+  800e61:	5e                   	pop    %esi
+  800e62:	5f                   	pop    %edi
+  800e63:	5d                   	pop    %ebp
+  800e64:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e65:	83 ec 0c             	sub    $0xc,%esp
+  800e68:	50                   	push   %eax
+  800e69:	6a 06                	push   $0x6
+  800e6b:	68 03 30 80 00       	push   $0x803003
+  800e70:	6a 3e                	push   $0x3e
+  800e72:	68 20 30 80 00       	push   $0x803020
+  800e77:	e8 b9 f4 ff ff       	call   800335 <_panic>
+
+00800e7c <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800e7c:	55                   	push   %ebp
+  800e7d:	89 e5                	mov    %esp,%ebp
+  800e7f:	57                   	push   %edi
+  800e80:	56                   	push   %esi
+  800e81:	53                   	push   %ebx
+  800e82:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800e85:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e8a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e8d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e90:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e95:	89 df                	mov    %ebx,%edi
+  800e97:	89 de                	mov    %ebx,%esi
+  800e99:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e9b:	85 c0                	test   %eax,%eax
+  800e9d:	7f 08                	jg     800ea7 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800e9f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ea2:	5b                   	pop    %ebx
+  800ea3:	5e                   	pop    %esi
+  800ea4:	5f                   	pop    %edi
+  800ea5:	5d                   	pop    %ebp
+  800ea6:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ea7:	83 ec 0c             	sub    $0xc,%esp
+  800eaa:	50                   	push   %eax
+  800eab:	6a 08                	push   $0x8
+  800ead:	68 03 30 80 00       	push   $0x803003
+  800eb2:	6a 3e                	push   $0x3e
+  800eb4:	68 20 30 80 00       	push   $0x803020
+  800eb9:	e8 77 f4 ff ff       	call   800335 <_panic>
+
+00800ebe <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800ebe:	55                   	push   %ebp
+  800ebf:	89 e5                	mov    %esp,%ebp
+  800ec1:	57                   	push   %edi
+  800ec2:	56                   	push   %esi
+  800ec3:	53                   	push   %ebx
+  800ec4:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800ec7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ecc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ecf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ed2:	b8 09 00 00 00       	mov    $0x9,%eax
+  800ed7:	89 df                	mov    %ebx,%edi
+  800ed9:	89 de                	mov    %ebx,%esi
+  800edb:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800edd:	85 c0                	test   %eax,%eax
+  800edf:	7f 08                	jg     800ee9 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800ee1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ee4:	5b                   	pop    %ebx
+  800ee5:	5e                   	pop    %esi
+  800ee6:	5f                   	pop    %edi
+  800ee7:	5d                   	pop    %ebp
+  800ee8:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ee9:	83 ec 0c             	sub    $0xc,%esp
+  800eec:	50                   	push   %eax
+  800eed:	6a 09                	push   $0x9
+  800eef:	68 03 30 80 00       	push   $0x803003
+  800ef4:	6a 3e                	push   $0x3e
+  800ef6:	68 20 30 80 00       	push   $0x803020
+  800efb:	e8 35 f4 ff ff       	call   800335 <_panic>
+
+00800f00 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800f00:	55                   	push   %ebp
+  800f01:	89 e5                	mov    %esp,%ebp
+  800f03:	57                   	push   %edi
+  800f04:	56                   	push   %esi
+  800f05:	53                   	push   %ebx
+  800f06:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800f09:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f0e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f11:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f14:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f19:	89 df                	mov    %ebx,%edi
+  800f1b:	89 de                	mov    %ebx,%esi
+  800f1d:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f1f:	85 c0                	test   %eax,%eax
+  800f21:	7f 08                	jg     800f2b <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800f23:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f26:	5b                   	pop    %ebx
+  800f27:	5e                   	pop    %esi
+  800f28:	5f                   	pop    %edi
+  800f29:	5d                   	pop    %ebp
+  800f2a:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f2b:	83 ec 0c             	sub    $0xc,%esp
+  800f2e:	50                   	push   %eax
+  800f2f:	6a 0a                	push   $0xa
+  800f31:	68 03 30 80 00       	push   $0x803003
+  800f36:	6a 3e                	push   $0x3e
+  800f38:	68 20 30 80 00       	push   $0x803020
+  800f3d:	e8 f3 f3 ff ff       	call   800335 <_panic>
+
+00800f42 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  800f42:	55                   	push   %ebp
+  800f43:	89 e5                	mov    %esp,%ebp
+  800f45:	57                   	push   %edi
+  800f46:	56                   	push   %esi
+  800f47:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800f48:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f4b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f4e:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f53:	be 00 00 00 00       	mov    $0x0,%esi
+  800f58:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f5b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f5e:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800f60:	5b                   	pop    %ebx
+  800f61:	5e                   	pop    %esi
+  800f62:	5f                   	pop    %edi
+  800f63:	5d                   	pop    %ebp
+  800f64:	c3                   	ret
+
+00800f65 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  800f65:	55                   	push   %ebp
+  800f66:	89 e5                	mov    %esp,%ebp
+  800f68:	57                   	push   %edi
+  800f69:	56                   	push   %esi
+  800f6a:	53                   	push   %ebx
+  800f6b:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800f6e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f73:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f76:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f7b:	89 cb                	mov    %ecx,%ebx
+  800f7d:	89 cf                	mov    %ecx,%edi
+  800f7f:	89 ce                	mov    %ecx,%esi
+  800f81:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f83:	85 c0                	test   %eax,%eax
+  800f85:	7f 08                	jg     800f8f <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  800f87:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f8a:	5b                   	pop    %ebx
+  800f8b:	5e                   	pop    %esi
+  800f8c:	5f                   	pop    %edi
+  800f8d:	5d                   	pop    %ebp
+  800f8e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f8f:	83 ec 0c             	sub    $0xc,%esp
+  800f92:	50                   	push   %eax
+  800f93:	6a 0d                	push   $0xd
+  800f95:	68 03 30 80 00       	push   $0x803003
+  800f9a:	6a 3e                	push   $0x3e
+  800f9c:	68 20 30 80 00       	push   $0x803020
+  800fa1:	e8 8f f3 ff ff       	call   800335 <_panic>
+
+00800fa6 <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  800fa6:	55                   	push   %ebp
+  800fa7:	89 e5                	mov    %esp,%ebp
+  800fa9:	57                   	push   %edi
+  800faa:	56                   	push   %esi
+  800fab:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800fac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fb1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fb7:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800fbc:	89 df                	mov    %ebx,%edi
+  800fbe:	89 de                	mov    %ebx,%esi
+  800fc0:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  800fc2:	5b                   	pop    %ebx
+  800fc3:	5e                   	pop    %esi
+  800fc4:	5f                   	pop    %edi
+  800fc5:	5d                   	pop    %ebp
+  800fc6:	c3                   	ret
+
+00800fc7 <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  800fc7:	55                   	push   %ebp
+  800fc8:	89 e5                	mov    %esp,%ebp
+  800fca:	57                   	push   %edi
+  800fcb:	56                   	push   %esi
+  800fcc:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800fcd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fd2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fd5:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800fda:	89 cb                	mov    %ecx,%ebx
+  800fdc:	89 cf                	mov    %ecx,%edi
+  800fde:	89 ce                	mov    %ecx,%esi
+  800fe0:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  800fe2:	5b                   	pop    %ebx
+  800fe3:	5e                   	pop    %esi
+  800fe4:	5f                   	pop    %edi
+  800fe5:	5d                   	pop    %ebp
+  800fe6:	c3                   	ret
+
+00800fe7 <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  800fe7:	55                   	push   %ebp
+  800fe8:	89 e5                	mov    %esp,%ebp
+  800fea:	57                   	push   %edi
+  800feb:	56                   	push   %esi
+  800fec:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800fed:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ff2:	b8 10 00 00 00       	mov    $0x10,%eax
+  800ff7:	89 d1                	mov    %edx,%ecx
+  800ff9:	89 d3                	mov    %edx,%ebx
+  800ffb:	89 d7                	mov    %edx,%edi
+  800ffd:	89 d6                	mov    %edx,%esi
+  800fff:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801001:	5b                   	pop    %ebx
+  801002:	5e                   	pop    %esi
+  801003:	5f                   	pop    %edi
+  801004:	5d                   	pop    %ebp
+  801005:	c3                   	ret
+
+00801006 <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  801006:	55                   	push   %ebp
+  801007:	89 e5                	mov    %esp,%ebp
+  801009:	57                   	push   %edi
+  80100a:	56                   	push   %esi
+  80100b:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80100c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801011:	8b 55 08             	mov    0x8(%ebp),%edx
+  801014:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801017:	b8 11 00 00 00       	mov    $0x11,%eax
+  80101c:	89 df                	mov    %ebx,%edi
+  80101e:	89 de                	mov    %ebx,%esi
+  801020:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  801022:	5b                   	pop    %ebx
+  801023:	5e                   	pop    %esi
+  801024:	5f                   	pop    %edi
+  801025:	5d                   	pop    %ebp
+  801026:	c3                   	ret
+
+00801027 <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  801027:	55                   	push   %ebp
+  801028:	89 e5                	mov    %esp,%ebp
+  80102a:	57                   	push   %edi
+  80102b:	56                   	push   %esi
+  80102c:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80102d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801032:	8b 55 08             	mov    0x8(%ebp),%edx
+  801035:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801038:	b8 12 00 00 00       	mov    $0x12,%eax
+  80103d:	89 df                	mov    %ebx,%edi
+  80103f:	89 de                	mov    %ebx,%esi
+  801041:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  801043:	5b                   	pop    %ebx
+  801044:	5e                   	pop    %esi
+  801045:	5f                   	pop    %edi
+  801046:	5d                   	pop    %ebp
+  801047:	c3                   	ret
+
+00801048 <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  801048:	55                   	push   %ebp
+  801049:	89 e5                	mov    %esp,%ebp
+  80104b:	57                   	push   %edi
+  80104c:	56                   	push   %esi
+  80104d:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80104e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801053:	8b 55 08             	mov    0x8(%ebp),%edx
+  801056:	b8 13 00 00 00       	mov    $0x13,%eax
+  80105b:	89 cb                	mov    %ecx,%ebx
+  80105d:	89 cf                	mov    %ecx,%edi
+  80105f:	89 ce                	mov    %ecx,%esi
+  801061:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  801063:	5b                   	pop    %ebx
+  801064:	5e                   	pop    %esi
+  801065:	5f                   	pop    %edi
+  801066:	5d                   	pop    %ebp
+  801067:	c3                   	ret
+
+00801068 <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  801068:	55                   	push   %ebp
+  801069:	89 e5                	mov    %esp,%ebp
+  80106b:	57                   	push   %edi
+  80106c:	56                   	push   %esi
+  80106d:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80106e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801073:	8b 55 08             	mov    0x8(%ebp),%edx
+  801076:	b8 14 00 00 00       	mov    $0x14,%eax
+  80107b:	89 cb                	mov    %ecx,%ebx
+  80107d:	89 cf                	mov    %ecx,%edi
+  80107f:	89 ce                	mov    %ecx,%esi
+  801081:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  801083:	5b                   	pop    %ebx
+  801084:	5e                   	pop    %esi
+  801085:	5f                   	pop    %edi
+  801086:	5d                   	pop    %ebp
+  801087:	c3                   	ret
+
+00801088 <pgfault>:
+//
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf) {
+  801088:	55                   	push   %ebp
+  801089:	89 e5                	mov    %esp,%ebp
+  80108b:	53                   	push   %ebx
+  80108c:	83 ec 04             	sub    $0x4,%esp
+  80108f:	8b 45 08             	mov    0x8(%ebp),%eax
+    void *addr = (void *) utf->utf_fault_va;
+  801092:	8b 18                	mov    (%eax),%ebx
+    // Hint:
+    //   Use the read-only page table mappings at uvpt
+    //   (see <inc/memlayout.h>).
+
+    // LAB 4: Your code here.
+    if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P) ||
+  801094:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  801098:	0f 84 95 00 00 00    	je     801133 <pgfault+0xab>
+  80109e:	89 d8                	mov    %ebx,%eax
+  8010a0:	c1 e8 16             	shr    $0x16,%eax
+  8010a3:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8010aa:	a8 01                	test   $0x1,%al
+  8010ac:	0f 84 81 00 00 00    	je     801133 <pgfault+0xab>
+        (uvpt[PGNUM(addr)] & (PTE_P | PTE_COW)) != (PTE_P | PTE_COW)) {
+  8010b2:	89 d8                	mov    %ebx,%eax
+  8010b4:	c1 e8 0c             	shr    $0xc,%eax
+  8010b7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8010be:	25 01 08 00 00       	and    $0x801,%eax
+    if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P) ||
+  8010c3:	3d 01 08 00 00       	cmp    $0x801,%eax
+  8010c8:	75 69                	jne    801133 <pgfault+0xab>
+    // Hint:
+    //   You should make three system calls.
+
+    // LAB 4: Your code here.
+
+    if (sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W))
+  8010ca:	83 ec 04             	sub    $0x4,%esp
+  8010cd:	6a 07                	push   $0x7
+  8010cf:	68 00 f0 7f 00       	push   $0x7ff000
+  8010d4:	6a 00                	push   $0x0
+  8010d6:	e8 da fc ff ff       	call   800db5 <sys_page_alloc>
+  8010db:	83 c4 10             	add    $0x10,%esp
+  8010de:	85 c0                	test   %eax,%eax
+  8010e0:	75 65                	jne    801147 <pgfault+0xbf>
+        panic("sys_page_alloc failed");
+
+    addr = ROUNDDOWN(addr, PGSIZE);
+  8010e2:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+    memmove(PFTEMP, addr, PGSIZE);
+  8010e8:	83 ec 04             	sub    $0x4,%esp
+  8010eb:	68 00 10 00 00       	push   $0x1000
+  8010f0:	53                   	push   %ebx
+  8010f1:	68 00 f0 7f 00       	push   $0x7ff000
+  8010f6:	e8 54 fa ff ff       	call   800b4f <memmove>
+
+    if (sys_page_map(0, PFTEMP, 0, addr, PTE_P | PTE_U | PTE_W))
+  8010fb:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801102:	53                   	push   %ebx
+  801103:	6a 00                	push   $0x0
+  801105:	68 00 f0 7f 00       	push   $0x7ff000
+  80110a:	6a 00                	push   $0x0
+  80110c:	e8 e7 fc ff ff       	call   800df8 <sys_page_map>
+  801111:	83 c4 20             	add    $0x20,%esp
+  801114:	85 c0                	test   %eax,%eax
+  801116:	75 43                	jne    80115b <pgfault+0xd3>
+        panic("sys_page_map failed");
+    if (sys_page_unmap(0, PFTEMP))
+  801118:	83 ec 08             	sub    $0x8,%esp
+  80111b:	68 00 f0 7f 00       	push   $0x7ff000
+  801120:	6a 00                	push   $0x0
+  801122:	e8 13 fd ff ff       	call   800e3a <sys_page_unmap>
+  801127:	83 c4 10             	add    $0x10,%esp
+  80112a:	85 c0                	test   %eax,%eax
+  80112c:	75 41                	jne    80116f <pgfault+0xe7>
+        panic("sys_page_unmap failed");
+
+}
+  80112e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801131:	c9                   	leave
+  801132:	c3                   	ret
+        panic("pgfault: faulting access invalid");
+  801133:	83 ec 04             	sub    $0x4,%esp
+  801136:	68 30 30 80 00       	push   $0x803030
+  80113b:	6a 1e                	push   $0x1e
+  80113d:	68 9c 30 80 00       	push   $0x80309c
+  801142:	e8 ee f1 ff ff       	call   800335 <_panic>
+        panic("sys_page_alloc failed");
+  801147:	83 ec 04             	sub    $0x4,%esp
+  80114a:	68 0f 31 80 00       	push   $0x80310f
+  80114f:	6a 2a                	push   $0x2a
+  801151:	68 9c 30 80 00       	push   $0x80309c
+  801156:	e8 da f1 ff ff       	call   800335 <_panic>
+        panic("sys_page_map failed");
+  80115b:	83 ec 04             	sub    $0x4,%esp
+  80115e:	68 a7 30 80 00       	push   $0x8030a7
+  801163:	6a 30                	push   $0x30
+  801165:	68 9c 30 80 00       	push   $0x80309c
+  80116a:	e8 c6 f1 ff ff       	call   800335 <_panic>
+        panic("sys_page_unmap failed");
+  80116f:	83 ec 04             	sub    $0x4,%esp
+  801172:	68 bb 30 80 00       	push   $0x8030bb
+  801177:	6a 32                	push   $0x32
+  801179:	68 9c 30 80 00       	push   $0x80309c
+  80117e:	e8 b2 f1 ff ff       	call   800335 <_panic>
+
+00801183 <fork>:
+//   Remember to fix "thisenv" in the child process.
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void) {
+  801183:	55                   	push   %ebp
+  801184:	89 e5                	mov    %esp,%ebp
+  801186:	57                   	push   %edi
+  801187:	56                   	push   %esi
+  801188:	53                   	push   %ebx
+  801189:	83 ec 18             	sub    $0x18,%esp
+    // LAB 4: Your code here.
+    set_pgfault_handler(pgfault);
+  80118c:	68 88 10 80 00       	push   $0x801088
+  801191:	e8 6b 13 00 00       	call   802501 <set_pgfault_handler>
+
+// This must be inlined.  Exercise for reader: why?
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+  envid_t ret;
+  asm volatile("int %2"
+  801196:	b8 07 00 00 00       	mov    $0x7,%eax
+  80119b:	cd 30                	int    $0x30
+  80119d:	89 c6                	mov    %eax,%esi
+
+    envid_t envid = sys_exofork();
+    if (envid < 0)
+  80119f:	83 c4 10             	add    $0x10,%esp
+  8011a2:	85 c0                	test   %eax,%eax
+  8011a4:	78 2a                	js     8011d0 <fork+0x4d>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+
+    uintptr_t addr;
+    for (addr = 0; addr < UTOP; addr += PGSIZE) {
+  8011a6:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (envid == 0) {
+  8011ab:	0f 85 a2 00 00 00    	jne    801253 <fork+0xd0>
+        thisenv = &envs[ENVX(sys_getenvid())];
+  8011b1:	e8 c1 fb ff ff       	call   800d77 <sys_getenvid>
+  8011b6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8011bb:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8011be:	c1 e0 04             	shl    $0x4,%eax
+  8011c1:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8011c6:	a3 08 50 80 00       	mov    %eax,0x805008
+        return 0;
+  8011cb:	e9 6c 01 00 00       	jmp    80133c <fork+0x1b9>
+        panic("fork: sys_exofork error: %e", envid);
+  8011d0:	50                   	push   %eax
+  8011d1:	68 d1 30 80 00       	push   $0x8030d1
+  8011d6:	6a 6f                	push   $0x6f
+  8011d8:	68 9c 30 80 00       	push   $0x80309c
+  8011dd:	e8 53 f1 ff ff       	call   800335 <_panic>
+        if ((r = sys_page_map(0, vptr, envid, vptr, uvpt[pn] & PTE_SYSCALL)) < 0)
+  8011e2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8011e9:	83 ec 0c             	sub    $0xc,%esp
+  8011ec:	25 07 0e 00 00       	and    $0xe07,%eax
+  8011f1:	50                   	push   %eax
+  8011f2:	57                   	push   %edi
+  8011f3:	56                   	push   %esi
+  8011f4:	57                   	push   %edi
+  8011f5:	6a 00                	push   $0x0
+  8011f7:	e8 fc fb ff ff       	call   800df8 <sys_page_map>
+  8011fc:	83 c4 20             	add    $0x20,%esp
+  8011ff:	85 c0                	test   %eax,%eax
+  801201:	79 3e                	jns    801241 <fork+0xbe>
+            panic("duppage :in sys_page_map %e", r);
+  801203:	50                   	push   %eax
+  801204:	68 ed 30 80 00       	push   $0x8030ed
+  801209:	6a 49                	push   $0x49
+  80120b:	68 9c 30 80 00       	push   $0x80309c
+  801210:	e8 20 f1 ff ff       	call   800335 <_panic>
+            panic("duppage :in sys_page_map %e", r);
+  801215:	50                   	push   %eax
+  801216:	68 ed 30 80 00       	push   $0x8030ed
+  80121b:	6a 4e                	push   $0x4e
+  80121d:	68 9c 30 80 00       	push   $0x80309c
+  801222:	e8 0e f1 ff ff       	call   800335 <_panic>
+    } else if ((r = sys_page_map(0, vptr, envid, vptr, PTE_P | PTE_U)) < 0)
+  801227:	83 ec 0c             	sub    $0xc,%esp
+  80122a:	6a 05                	push   $0x5
+  80122c:	57                   	push   %edi
+  80122d:	56                   	push   %esi
+  80122e:	57                   	push   %edi
+  80122f:	6a 00                	push   $0x0
+  801231:	e8 c2 fb ff ff       	call   800df8 <sys_page_map>
+  801236:	83 c4 20             	add    $0x20,%esp
+  801239:	85 c0                	test   %eax,%eax
+  80123b:	0f 88 ab 00 00 00    	js     8012ec <fork+0x169>
+    for (addr = 0; addr < UTOP; addr += PGSIZE) {
+  801241:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801247:	81 fb 00 00 c0 ee    	cmp    $0xeec00000,%ebx
+  80124d:	0f 84 ab 00 00 00    	je     8012fe <fork+0x17b>
+        if (uvpd[PDX(addr)] & PTE_P && uvpt[PGNUM(addr)] & PTE_P && addr != UXSTACKTOP - PGSIZE) {
+  801253:	89 d8                	mov    %ebx,%eax
+  801255:	c1 e8 16             	shr    $0x16,%eax
+  801258:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80125f:	a8 01                	test   $0x1,%al
+  801261:	74 de                	je     801241 <fork+0xbe>
+  801263:	89 d8                	mov    %ebx,%eax
+  801265:	c1 e8 0c             	shr    $0xc,%eax
+  801268:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80126f:	f6 c2 01             	test   $0x1,%dl
+  801272:	74 cd                	je     801241 <fork+0xbe>
+  801274:	81 fb 00 f0 bf ee    	cmp    $0xeebff000,%ebx
+  80127a:	74 c5                	je     801241 <fork+0xbe>
+    void *vptr = (void *) (pn * PGSIZE);
+  80127c:	89 c7                	mov    %eax,%edi
+  80127e:	c1 e7 0c             	shl    $0xc,%edi
+    if (uvpt[pn] & PTE_SHARE) {
+  801281:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801288:	f6 c6 04             	test   $0x4,%dh
+  80128b:	0f 85 51 ff ff ff    	jne    8011e2 <fork+0x5f>
+    } else if (uvpt[pn] & (PTE_W | PTE_COW)) {
+  801291:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801298:	a9 02 08 00 00       	test   $0x802,%eax
+  80129d:	74 88                	je     801227 <fork+0xa4>
+        if ((r = sys_page_map(0, vptr, envid, vptr, PTE_P | PTE_U | PTE_COW)) < 0)
+  80129f:	83 ec 0c             	sub    $0xc,%esp
+  8012a2:	68 05 08 00 00       	push   $0x805
+  8012a7:	57                   	push   %edi
+  8012a8:	56                   	push   %esi
+  8012a9:	57                   	push   %edi
+  8012aa:	6a 00                	push   $0x0
+  8012ac:	e8 47 fb ff ff       	call   800df8 <sys_page_map>
+  8012b1:	83 c4 20             	add    $0x20,%esp
+  8012b4:	85 c0                	test   %eax,%eax
+  8012b6:	0f 88 59 ff ff ff    	js     801215 <fork+0x92>
+        if ((r = sys_page_map(0, vptr, 0, vptr, PTE_P | PTE_U | PTE_COW)) < 0)
+  8012bc:	83 ec 0c             	sub    $0xc,%esp
+  8012bf:	68 05 08 00 00       	push   $0x805
+  8012c4:	57                   	push   %edi
+  8012c5:	6a 00                	push   $0x0
+  8012c7:	57                   	push   %edi
+  8012c8:	6a 00                	push   $0x0
+  8012ca:	e8 29 fb ff ff       	call   800df8 <sys_page_map>
+  8012cf:	83 c4 20             	add    $0x20,%esp
+  8012d2:	85 c0                	test   %eax,%eax
+  8012d4:	0f 89 67 ff ff ff    	jns    801241 <fork+0xbe>
+            panic("duppage :in sys_page_map %e", r);
+  8012da:	50                   	push   %eax
+  8012db:	68 ed 30 80 00       	push   $0x8030ed
+  8012e0:	6a 50                	push   $0x50
+  8012e2:	68 9c 30 80 00       	push   $0x80309c
+  8012e7:	e8 49 f0 ff ff       	call   800335 <_panic>
+        panic("duppage :in sys_page_map %e", r);
+  8012ec:	50                   	push   %eax
+  8012ed:	68 ed 30 80 00       	push   $0x8030ed
+  8012f2:	6a 53                	push   $0x53
+  8012f4:	68 9c 30 80 00       	push   $0x80309c
+  8012f9:	e8 37 f0 ff ff       	call   800335 <_panic>
+            duppage(envid, PGNUM(addr));
+        }
+    }
+    if (sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W))
+  8012fe:	83 ec 04             	sub    $0x4,%esp
+  801301:	6a 07                	push   $0x7
+  801303:	68 00 f0 bf ee       	push   $0xeebff000
+  801308:	56                   	push   %esi
+  801309:	e8 a7 fa ff ff       	call   800db5 <sys_page_alloc>
+  80130e:	83 c4 10             	add    $0x10,%esp
+  801311:	85 c0                	test   %eax,%eax
+  801313:	75 31                	jne    801346 <fork+0x1c3>
+        panic("fork: sys_page_alloc failed");
+    if (sys_env_set_pgfault_upcall(envid, _pgfault_upcall))
+  801315:	83 ec 08             	sub    $0x8,%esp
+  801318:	68 6c 25 80 00       	push   $0x80256c
+  80131d:	56                   	push   %esi
+  80131e:	e8 dd fb ff ff       	call   800f00 <sys_env_set_pgfault_upcall>
+  801323:	83 c4 10             	add    $0x10,%esp
+  801326:	85 c0                	test   %eax,%eax
+  801328:	75 30                	jne    80135a <fork+0x1d7>
+        panic("fork: sys_env_set_pgfault_upcall failed");
+    if (sys_env_set_status(envid, ENV_RUNNABLE))
+  80132a:	83 ec 08             	sub    $0x8,%esp
+  80132d:	6a 02                	push   $0x2
+  80132f:	56                   	push   %esi
+  801330:	e8 47 fb ff ff       	call   800e7c <sys_env_set_status>
+  801335:	83 c4 10             	add    $0x10,%esp
+  801338:	85 c0                	test   %eax,%eax
+  80133a:	75 32                	jne    80136e <fork+0x1eb>
+        panic("fork: sys_env_set_status failed");
+
+    return envid;
+
+}
+  80133c:	89 f0                	mov    %esi,%eax
+  80133e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801341:	5b                   	pop    %ebx
+  801342:	5e                   	pop    %esi
+  801343:	5f                   	pop    %edi
+  801344:	5d                   	pop    %ebp
+  801345:	c3                   	ret
+        panic("fork: sys_page_alloc failed");
+  801346:	83 ec 04             	sub    $0x4,%esp
+  801349:	68 09 31 80 00       	push   $0x803109
+  80134e:	6a 7d                	push   $0x7d
+  801350:	68 9c 30 80 00       	push   $0x80309c
+  801355:	e8 db ef ff ff       	call   800335 <_panic>
+        panic("fork: sys_env_set_pgfault_upcall failed");
+  80135a:	83 ec 04             	sub    $0x4,%esp
+  80135d:	68 54 30 80 00       	push   $0x803054
+  801362:	6a 7f                	push   $0x7f
+  801364:	68 9c 30 80 00       	push   $0x80309c
+  801369:	e8 c7 ef ff ff       	call   800335 <_panic>
+        panic("fork: sys_env_set_status failed");
+  80136e:	83 ec 04             	sub    $0x4,%esp
+  801371:	68 7c 30 80 00       	push   $0x80307c
+  801376:	68 81 00 00 00       	push   $0x81
+  80137b:	68 9c 30 80 00       	push   $0x80309c
+  801380:	e8 b0 ef ff ff       	call   800335 <_panic>
+
+00801385 <sfork>:
+
+// Challenge!
+int
+sfork(void) {
+  801385:	55                   	push   %ebp
+  801386:	89 e5                	mov    %esp,%ebp
+  801388:	83 ec 0c             	sub    $0xc,%esp
+    panic("sfork not implemented");
+  80138b:	68 25 31 80 00       	push   $0x803125
+  801390:	68 8a 00 00 00       	push   $0x8a
+  801395:	68 9c 30 80 00       	push   $0x80309c
+  80139a:	e8 96 ef ff ff       	call   800335 <_panic>
+
+0080139f <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80139f:	55                   	push   %ebp
+  8013a0:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8013a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013a5:	05 00 00 00 30       	add    $0x30000000,%eax
+  8013aa:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8013ad:	5d                   	pop    %ebp
+  8013ae:	c3                   	ret
+
+008013af <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8013af:	55                   	push   %ebp
+  8013b0:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8013b2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013b5:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8013ba:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8013bf:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8013c4:	5d                   	pop    %ebp
+  8013c5:	c3                   	ret
+
+008013c6 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8013c6:	55                   	push   %ebp
+  8013c7:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8013c9:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8013ce:	eb 02                	jmp    8013d2 <fd_alloc+0xc>
+  8013d0:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8013d2:	89 c2                	mov    %eax,%edx
+  8013d4:	c1 ea 16             	shr    $0x16,%edx
+  8013d7:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8013de:	f6 c2 01             	test   $0x1,%dl
+  8013e1:	74 2b                	je     80140e <fd_alloc+0x48>
+  8013e3:	89 c2                	mov    %eax,%edx
+  8013e5:	c1 ea 0c             	shr    $0xc,%edx
+  8013e8:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8013ef:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8013f5:	f6 c1 01             	test   $0x1,%cl
+  8013f8:	74 14                	je     80140e <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8013fa:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801400:	75 ce                	jne    8013d0 <fd_alloc+0xa>
+  801402:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801407:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80140c:	eb 05                	jmp    801413 <fd_alloc+0x4d>
+			return 0;
+  80140e:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801413:	8b 55 08             	mov    0x8(%ebp),%edx
+  801416:	89 02                	mov    %eax,(%edx)
+}
+  801418:	89 c8                	mov    %ecx,%eax
+  80141a:	5d                   	pop    %ebp
+  80141b:	c3                   	ret
+
+0080141c <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80141c:	55                   	push   %ebp
+  80141d:	89 e5                	mov    %esp,%ebp
+  80141f:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801422:	83 f8 1f             	cmp    $0x1f,%eax
+  801425:	77 30                	ja     801457 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801427:	c1 e0 0c             	shl    $0xc,%eax
+  80142a:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80142f:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801435:	f6 c2 01             	test   $0x1,%dl
+  801438:	74 24                	je     80145e <fd_lookup+0x42>
+  80143a:	89 c2                	mov    %eax,%edx
+  80143c:	c1 ea 0c             	shr    $0xc,%edx
+  80143f:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801446:	f6 c2 01             	test   $0x1,%dl
+  801449:	74 1a                	je     801465 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80144b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80144e:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801450:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801455:	5d                   	pop    %ebp
+  801456:	c3                   	ret
+		return -E_INVAL;
+  801457:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80145c:	eb f7                	jmp    801455 <fd_lookup+0x39>
+		return -E_INVAL;
+  80145e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801463:	eb f0                	jmp    801455 <fd_lookup+0x39>
+  801465:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80146a:	eb e9                	jmp    801455 <fd_lookup+0x39>
+
+0080146c <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80146c:	55                   	push   %ebp
+  80146d:	89 e5                	mov    %esp,%ebp
+  80146f:	53                   	push   %ebx
+  801470:	83 ec 04             	sub    $0x4,%esp
+  801473:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801476:	b8 00 00 00 00       	mov    $0x0,%eax
+  80147b:	eb 03                	jmp    801480 <dev_lookup+0x14>
+  80147d:	83 c0 01             	add    $0x1,%eax
+  801480:	8b 1c 85 b8 31 80 00 	mov    0x8031b8(,%eax,4),%ebx
+  801487:	85 db                	test   %ebx,%ebx
+  801489:	74 0b                	je     801496 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  80148b:	39 13                	cmp    %edx,(%ebx)
+  80148d:	75 ee                	jne    80147d <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  80148f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801494:	eb 1f                	jmp    8014b5 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801496:	a1 08 50 80 00       	mov    0x805008,%eax
+  80149b:	8b 40 48             	mov    0x48(%eax),%eax
+  80149e:	83 ec 04             	sub    $0x4,%esp
+  8014a1:	52                   	push   %edx
+  8014a2:	50                   	push   %eax
+  8014a3:	68 3c 31 80 00       	push   $0x80313c
+  8014a8:	e8 63 ef ff ff       	call   800410 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8014ad:	83 c4 10             	add    $0x10,%esp
+  8014b0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8014b5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8014b8:	89 1a                	mov    %ebx,(%edx)
+}
+  8014ba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014bd:	c9                   	leave
+  8014be:	c3                   	ret
+
+008014bf <fd_close>:
+{
+  8014bf:	55                   	push   %ebp
+  8014c0:	89 e5                	mov    %esp,%ebp
+  8014c2:	57                   	push   %edi
+  8014c3:	56                   	push   %esi
+  8014c4:	53                   	push   %ebx
+  8014c5:	83 ec 24             	sub    $0x24,%esp
+  8014c8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8014cb:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8014ce:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8014d1:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8014d2:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8014d8:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8014db:	50                   	push   %eax
+  8014dc:	e8 3b ff ff ff       	call   80141c <fd_lookup>
+  8014e1:	89 c3                	mov    %eax,%ebx
+  8014e3:	83 c4 10             	add    $0x10,%esp
+  8014e6:	85 c0                	test   %eax,%eax
+  8014e8:	78 05                	js     8014ef <fd_close+0x30>
+	    || fd != fd2)
+  8014ea:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8014ed:	74 16                	je     801505 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8014ef:	89 f8                	mov    %edi,%eax
+  8014f1:	84 c0                	test   %al,%al
+  8014f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014f8:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8014fb:	89 d8                	mov    %ebx,%eax
+  8014fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801500:	5b                   	pop    %ebx
+  801501:	5e                   	pop    %esi
+  801502:	5f                   	pop    %edi
+  801503:	5d                   	pop    %ebp
+  801504:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801505:	83 ec 08             	sub    $0x8,%esp
+  801508:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80150b:	50                   	push   %eax
+  80150c:	ff 36                	push   (%esi)
+  80150e:	e8 59 ff ff ff       	call   80146c <dev_lookup>
+  801513:	89 c3                	mov    %eax,%ebx
+  801515:	83 c4 10             	add    $0x10,%esp
+  801518:	85 c0                	test   %eax,%eax
+  80151a:	78 1a                	js     801536 <fd_close+0x77>
+		if (dev->dev_close)
+  80151c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80151f:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801522:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801527:	85 c0                	test   %eax,%eax
+  801529:	74 0b                	je     801536 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80152b:	83 ec 0c             	sub    $0xc,%esp
+  80152e:	56                   	push   %esi
+  80152f:	ff d0                	call   *%eax
+  801531:	89 c3                	mov    %eax,%ebx
+  801533:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801536:	83 ec 08             	sub    $0x8,%esp
+  801539:	56                   	push   %esi
+  80153a:	6a 00                	push   $0x0
+  80153c:	e8 f9 f8 ff ff       	call   800e3a <sys_page_unmap>
+	return r;
+  801541:	83 c4 10             	add    $0x10,%esp
+  801544:	eb b5                	jmp    8014fb <fd_close+0x3c>
+
+00801546 <close>:
+
+int
+close(int fdnum)
+{
+  801546:	55                   	push   %ebp
+  801547:	89 e5                	mov    %esp,%ebp
+  801549:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80154c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80154f:	50                   	push   %eax
+  801550:	ff 75 08             	push   0x8(%ebp)
+  801553:	e8 c4 fe ff ff       	call   80141c <fd_lookup>
+  801558:	83 c4 10             	add    $0x10,%esp
+  80155b:	85 c0                	test   %eax,%eax
+  80155d:	79 02                	jns    801561 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80155f:	c9                   	leave
+  801560:	c3                   	ret
+		return fd_close(fd, 1);
+  801561:	83 ec 08             	sub    $0x8,%esp
+  801564:	6a 01                	push   $0x1
+  801566:	ff 75 f4             	push   -0xc(%ebp)
+  801569:	e8 51 ff ff ff       	call   8014bf <fd_close>
+  80156e:	83 c4 10             	add    $0x10,%esp
+  801571:	eb ec                	jmp    80155f <close+0x19>
+
+00801573 <close_all>:
+
+void
+close_all(void)
+{
+  801573:	55                   	push   %ebp
+  801574:	89 e5                	mov    %esp,%ebp
+  801576:	53                   	push   %ebx
+  801577:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80157a:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80157f:	83 ec 0c             	sub    $0xc,%esp
+  801582:	53                   	push   %ebx
+  801583:	e8 be ff ff ff       	call   801546 <close>
+	for (i = 0; i < MAXFD; i++)
+  801588:	83 c3 01             	add    $0x1,%ebx
+  80158b:	83 c4 10             	add    $0x10,%esp
+  80158e:	83 fb 20             	cmp    $0x20,%ebx
+  801591:	75 ec                	jne    80157f <close_all+0xc>
+}
+  801593:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801596:	c9                   	leave
+  801597:	c3                   	ret
+
+00801598 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801598:	55                   	push   %ebp
+  801599:	89 e5                	mov    %esp,%ebp
+  80159b:	57                   	push   %edi
+  80159c:	56                   	push   %esi
+  80159d:	53                   	push   %ebx
+  80159e:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8015a1:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8015a4:	50                   	push   %eax
+  8015a5:	ff 75 08             	push   0x8(%ebp)
+  8015a8:	e8 6f fe ff ff       	call   80141c <fd_lookup>
+  8015ad:	89 c3                	mov    %eax,%ebx
+  8015af:	83 c4 10             	add    $0x10,%esp
+  8015b2:	85 c0                	test   %eax,%eax
+  8015b4:	78 7f                	js     801635 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8015b6:	83 ec 0c             	sub    $0xc,%esp
+  8015b9:	ff 75 0c             	push   0xc(%ebp)
+  8015bc:	e8 85 ff ff ff       	call   801546 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8015c1:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8015c4:	c1 e6 0c             	shl    $0xc,%esi
+  8015c7:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8015cd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8015d0:	89 3c 24             	mov    %edi,(%esp)
+  8015d3:	e8 d7 fd ff ff       	call   8013af <fd2data>
+  8015d8:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8015da:	89 34 24             	mov    %esi,(%esp)
+  8015dd:	e8 cd fd ff ff       	call   8013af <fd2data>
+  8015e2:	83 c4 10             	add    $0x10,%esp
+  8015e5:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8015e8:	89 d8                	mov    %ebx,%eax
+  8015ea:	c1 e8 16             	shr    $0x16,%eax
+  8015ed:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8015f4:	a8 01                	test   $0x1,%al
+  8015f6:	74 11                	je     801609 <dup+0x71>
+  8015f8:	89 d8                	mov    %ebx,%eax
+  8015fa:	c1 e8 0c             	shr    $0xc,%eax
+  8015fd:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801604:	f6 c2 01             	test   $0x1,%dl
+  801607:	75 36                	jne    80163f <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801609:	89 f8                	mov    %edi,%eax
+  80160b:	c1 e8 0c             	shr    $0xc,%eax
+  80160e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801615:	83 ec 0c             	sub    $0xc,%esp
+  801618:	25 07 0e 00 00       	and    $0xe07,%eax
+  80161d:	50                   	push   %eax
+  80161e:	56                   	push   %esi
+  80161f:	6a 00                	push   $0x0
+  801621:	57                   	push   %edi
+  801622:	6a 00                	push   $0x0
+  801624:	e8 cf f7 ff ff       	call   800df8 <sys_page_map>
+  801629:	89 c3                	mov    %eax,%ebx
+  80162b:	83 c4 20             	add    $0x20,%esp
+  80162e:	85 c0                	test   %eax,%eax
+  801630:	78 33                	js     801665 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801632:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801635:	89 d8                	mov    %ebx,%eax
+  801637:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80163a:	5b                   	pop    %ebx
+  80163b:	5e                   	pop    %esi
+  80163c:	5f                   	pop    %edi
+  80163d:	5d                   	pop    %ebp
+  80163e:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80163f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801646:	83 ec 0c             	sub    $0xc,%esp
+  801649:	25 07 0e 00 00       	and    $0xe07,%eax
+  80164e:	50                   	push   %eax
+  80164f:	ff 75 d4             	push   -0x2c(%ebp)
+  801652:	6a 00                	push   $0x0
+  801654:	53                   	push   %ebx
+  801655:	6a 00                	push   $0x0
+  801657:	e8 9c f7 ff ff       	call   800df8 <sys_page_map>
+  80165c:	89 c3                	mov    %eax,%ebx
+  80165e:	83 c4 20             	add    $0x20,%esp
+  801661:	85 c0                	test   %eax,%eax
+  801663:	79 a4                	jns    801609 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801665:	83 ec 08             	sub    $0x8,%esp
+  801668:	56                   	push   %esi
+  801669:	6a 00                	push   $0x0
+  80166b:	e8 ca f7 ff ff       	call   800e3a <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801670:	83 c4 08             	add    $0x8,%esp
+  801673:	ff 75 d4             	push   -0x2c(%ebp)
+  801676:	6a 00                	push   $0x0
+  801678:	e8 bd f7 ff ff       	call   800e3a <sys_page_unmap>
+	return r;
+  80167d:	83 c4 10             	add    $0x10,%esp
+  801680:	eb b3                	jmp    801635 <dup+0x9d>
+
+00801682 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801682:	55                   	push   %ebp
+  801683:	89 e5                	mov    %esp,%ebp
+  801685:	56                   	push   %esi
+  801686:	53                   	push   %ebx
+  801687:	83 ec 18             	sub    $0x18,%esp
+  80168a:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80168d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801690:	50                   	push   %eax
+  801691:	56                   	push   %esi
+  801692:	e8 85 fd ff ff       	call   80141c <fd_lookup>
+  801697:	83 c4 10             	add    $0x10,%esp
+  80169a:	85 c0                	test   %eax,%eax
+  80169c:	78 3c                	js     8016da <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80169e:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8016a1:	83 ec 08             	sub    $0x8,%esp
+  8016a4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016a7:	50                   	push   %eax
+  8016a8:	ff 33                	push   (%ebx)
+  8016aa:	e8 bd fd ff ff       	call   80146c <dev_lookup>
+  8016af:	83 c4 10             	add    $0x10,%esp
+  8016b2:	85 c0                	test   %eax,%eax
+  8016b4:	78 24                	js     8016da <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8016b6:	8b 43 08             	mov    0x8(%ebx),%eax
+  8016b9:	83 e0 03             	and    $0x3,%eax
+  8016bc:	83 f8 01             	cmp    $0x1,%eax
+  8016bf:	74 20                	je     8016e1 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8016c1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016c4:	8b 40 08             	mov    0x8(%eax),%eax
+  8016c7:	85 c0                	test   %eax,%eax
+  8016c9:	74 37                	je     801702 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8016cb:	83 ec 04             	sub    $0x4,%esp
+  8016ce:	ff 75 10             	push   0x10(%ebp)
+  8016d1:	ff 75 0c             	push   0xc(%ebp)
+  8016d4:	53                   	push   %ebx
+  8016d5:	ff d0                	call   *%eax
+  8016d7:	83 c4 10             	add    $0x10,%esp
+}
+  8016da:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016dd:	5b                   	pop    %ebx
+  8016de:	5e                   	pop    %esi
+  8016df:	5d                   	pop    %ebp
+  8016e0:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8016e1:	a1 08 50 80 00       	mov    0x805008,%eax
+  8016e6:	8b 40 48             	mov    0x48(%eax),%eax
+  8016e9:	83 ec 04             	sub    $0x4,%esp
+  8016ec:	56                   	push   %esi
+  8016ed:	50                   	push   %eax
+  8016ee:	68 7d 31 80 00       	push   $0x80317d
+  8016f3:	e8 18 ed ff ff       	call   800410 <cprintf>
+		return -E_INVAL;
+  8016f8:	83 c4 10             	add    $0x10,%esp
+  8016fb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801700:	eb d8                	jmp    8016da <read+0x58>
+		return -E_NOT_SUPP;
+  801702:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801707:	eb d1                	jmp    8016da <read+0x58>
+
+00801709 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801709:	55                   	push   %ebp
+  80170a:	89 e5                	mov    %esp,%ebp
+  80170c:	57                   	push   %edi
+  80170d:	56                   	push   %esi
+  80170e:	53                   	push   %ebx
+  80170f:	83 ec 0c             	sub    $0xc,%esp
+  801712:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801715:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801718:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80171d:	eb 02                	jmp    801721 <readn+0x18>
+  80171f:	01 c3                	add    %eax,%ebx
+  801721:	39 f3                	cmp    %esi,%ebx
+  801723:	73 21                	jae    801746 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801725:	83 ec 04             	sub    $0x4,%esp
+  801728:	89 f0                	mov    %esi,%eax
+  80172a:	29 d8                	sub    %ebx,%eax
+  80172c:	50                   	push   %eax
+  80172d:	89 d8                	mov    %ebx,%eax
+  80172f:	03 45 0c             	add    0xc(%ebp),%eax
+  801732:	50                   	push   %eax
+  801733:	57                   	push   %edi
+  801734:	e8 49 ff ff ff       	call   801682 <read>
+		if (m < 0)
+  801739:	83 c4 10             	add    $0x10,%esp
+  80173c:	85 c0                	test   %eax,%eax
+  80173e:	78 04                	js     801744 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801740:	75 dd                	jne    80171f <readn+0x16>
+  801742:	eb 02                	jmp    801746 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801744:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801746:	89 d8                	mov    %ebx,%eax
+  801748:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80174b:	5b                   	pop    %ebx
+  80174c:	5e                   	pop    %esi
+  80174d:	5f                   	pop    %edi
+  80174e:	5d                   	pop    %ebp
+  80174f:	c3                   	ret
+
+00801750 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801750:	55                   	push   %ebp
+  801751:	89 e5                	mov    %esp,%ebp
+  801753:	56                   	push   %esi
+  801754:	53                   	push   %ebx
+  801755:	83 ec 18             	sub    $0x18,%esp
+  801758:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80175b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80175e:	50                   	push   %eax
+  80175f:	53                   	push   %ebx
+  801760:	e8 b7 fc ff ff       	call   80141c <fd_lookup>
+  801765:	83 c4 10             	add    $0x10,%esp
+  801768:	85 c0                	test   %eax,%eax
+  80176a:	78 37                	js     8017a3 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80176c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80176f:	83 ec 08             	sub    $0x8,%esp
+  801772:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801775:	50                   	push   %eax
+  801776:	ff 36                	push   (%esi)
+  801778:	e8 ef fc ff ff       	call   80146c <dev_lookup>
+  80177d:	83 c4 10             	add    $0x10,%esp
+  801780:	85 c0                	test   %eax,%eax
+  801782:	78 1f                	js     8017a3 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801784:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801788:	74 20                	je     8017aa <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80178a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80178d:	8b 40 0c             	mov    0xc(%eax),%eax
+  801790:	85 c0                	test   %eax,%eax
+  801792:	74 37                	je     8017cb <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801794:	83 ec 04             	sub    $0x4,%esp
+  801797:	ff 75 10             	push   0x10(%ebp)
+  80179a:	ff 75 0c             	push   0xc(%ebp)
+  80179d:	56                   	push   %esi
+  80179e:	ff d0                	call   *%eax
+  8017a0:	83 c4 10             	add    $0x10,%esp
+}
+  8017a3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017a6:	5b                   	pop    %ebx
+  8017a7:	5e                   	pop    %esi
+  8017a8:	5d                   	pop    %ebp
+  8017a9:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8017aa:	a1 08 50 80 00       	mov    0x805008,%eax
+  8017af:	8b 40 48             	mov    0x48(%eax),%eax
+  8017b2:	83 ec 04             	sub    $0x4,%esp
+  8017b5:	53                   	push   %ebx
+  8017b6:	50                   	push   %eax
+  8017b7:	68 99 31 80 00       	push   $0x803199
+  8017bc:	e8 4f ec ff ff       	call   800410 <cprintf>
+		return -E_INVAL;
+  8017c1:	83 c4 10             	add    $0x10,%esp
+  8017c4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017c9:	eb d8                	jmp    8017a3 <write+0x53>
+		return -E_NOT_SUPP;
+  8017cb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017d0:	eb d1                	jmp    8017a3 <write+0x53>
+
+008017d2 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8017d2:	55                   	push   %ebp
+  8017d3:	89 e5                	mov    %esp,%ebp
+  8017d5:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8017d8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017db:	50                   	push   %eax
+  8017dc:	ff 75 08             	push   0x8(%ebp)
+  8017df:	e8 38 fc ff ff       	call   80141c <fd_lookup>
+  8017e4:	83 c4 10             	add    $0x10,%esp
+  8017e7:	85 c0                	test   %eax,%eax
+  8017e9:	78 0e                	js     8017f9 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8017eb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8017ee:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017f1:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8017f4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017f9:	c9                   	leave
+  8017fa:	c3                   	ret
+
+008017fb <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8017fb:	55                   	push   %ebp
+  8017fc:	89 e5                	mov    %esp,%ebp
+  8017fe:	56                   	push   %esi
+  8017ff:	53                   	push   %ebx
+  801800:	83 ec 18             	sub    $0x18,%esp
+  801803:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801806:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801809:	50                   	push   %eax
+  80180a:	53                   	push   %ebx
+  80180b:	e8 0c fc ff ff       	call   80141c <fd_lookup>
+  801810:	83 c4 10             	add    $0x10,%esp
+  801813:	85 c0                	test   %eax,%eax
+  801815:	78 34                	js     80184b <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801817:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80181a:	83 ec 08             	sub    $0x8,%esp
+  80181d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801820:	50                   	push   %eax
+  801821:	ff 36                	push   (%esi)
+  801823:	e8 44 fc ff ff       	call   80146c <dev_lookup>
+  801828:	83 c4 10             	add    $0x10,%esp
+  80182b:	85 c0                	test   %eax,%eax
+  80182d:	78 1c                	js     80184b <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80182f:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801833:	74 1d                	je     801852 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801835:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801838:	8b 40 18             	mov    0x18(%eax),%eax
+  80183b:	85 c0                	test   %eax,%eax
+  80183d:	74 34                	je     801873 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80183f:	83 ec 08             	sub    $0x8,%esp
+  801842:	ff 75 0c             	push   0xc(%ebp)
+  801845:	56                   	push   %esi
+  801846:	ff d0                	call   *%eax
+  801848:	83 c4 10             	add    $0x10,%esp
+}
+  80184b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80184e:	5b                   	pop    %ebx
+  80184f:	5e                   	pop    %esi
+  801850:	5d                   	pop    %ebp
+  801851:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801852:	a1 08 50 80 00       	mov    0x805008,%eax
+  801857:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80185a:	83 ec 04             	sub    $0x4,%esp
+  80185d:	53                   	push   %ebx
+  80185e:	50                   	push   %eax
+  80185f:	68 5c 31 80 00       	push   $0x80315c
+  801864:	e8 a7 eb ff ff       	call   800410 <cprintf>
+		return -E_INVAL;
+  801869:	83 c4 10             	add    $0x10,%esp
+  80186c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801871:	eb d8                	jmp    80184b <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801873:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801878:	eb d1                	jmp    80184b <ftruncate+0x50>
+
+0080187a <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80187a:	55                   	push   %ebp
+  80187b:	89 e5                	mov    %esp,%ebp
+  80187d:	56                   	push   %esi
+  80187e:	53                   	push   %ebx
+  80187f:	83 ec 18             	sub    $0x18,%esp
+  801882:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801885:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801888:	50                   	push   %eax
+  801889:	ff 75 08             	push   0x8(%ebp)
+  80188c:	e8 8b fb ff ff       	call   80141c <fd_lookup>
+  801891:	83 c4 10             	add    $0x10,%esp
+  801894:	85 c0                	test   %eax,%eax
+  801896:	78 49                	js     8018e1 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801898:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80189b:	83 ec 08             	sub    $0x8,%esp
+  80189e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018a1:	50                   	push   %eax
+  8018a2:	ff 36                	push   (%esi)
+  8018a4:	e8 c3 fb ff ff       	call   80146c <dev_lookup>
+  8018a9:	83 c4 10             	add    $0x10,%esp
+  8018ac:	85 c0                	test   %eax,%eax
+  8018ae:	78 31                	js     8018e1 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8018b0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018b3:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8018b7:	74 2f                	je     8018e8 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8018b9:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8018bc:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8018c3:	00 00 00 
+	stat->st_isdir = 0;
+  8018c6:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8018cd:	00 00 00 
+	stat->st_dev = dev;
+  8018d0:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8018d6:	83 ec 08             	sub    $0x8,%esp
+  8018d9:	53                   	push   %ebx
+  8018da:	56                   	push   %esi
+  8018db:	ff 50 14             	call   *0x14(%eax)
+  8018de:	83 c4 10             	add    $0x10,%esp
+}
+  8018e1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018e4:	5b                   	pop    %ebx
+  8018e5:	5e                   	pop    %esi
+  8018e6:	5d                   	pop    %ebp
+  8018e7:	c3                   	ret
+		return -E_NOT_SUPP;
+  8018e8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8018ed:	eb f2                	jmp    8018e1 <fstat+0x67>
+
+008018ef <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8018ef:	55                   	push   %ebp
+  8018f0:	89 e5                	mov    %esp,%ebp
+  8018f2:	56                   	push   %esi
+  8018f3:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8018f4:	83 ec 08             	sub    $0x8,%esp
+  8018f7:	6a 00                	push   $0x0
+  8018f9:	ff 75 08             	push   0x8(%ebp)
+  8018fc:	e8 e4 01 00 00       	call   801ae5 <open>
+  801901:	89 c3                	mov    %eax,%ebx
+  801903:	83 c4 10             	add    $0x10,%esp
+  801906:	85 c0                	test   %eax,%eax
+  801908:	78 1b                	js     801925 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80190a:	83 ec 08             	sub    $0x8,%esp
+  80190d:	ff 75 0c             	push   0xc(%ebp)
+  801910:	50                   	push   %eax
+  801911:	e8 64 ff ff ff       	call   80187a <fstat>
+  801916:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801918:	89 1c 24             	mov    %ebx,(%esp)
+  80191b:	e8 26 fc ff ff       	call   801546 <close>
+	return r;
+  801920:	83 c4 10             	add    $0x10,%esp
+  801923:	89 f3                	mov    %esi,%ebx
+}
+  801925:	89 d8                	mov    %ebx,%eax
+  801927:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80192a:	5b                   	pop    %ebx
+  80192b:	5e                   	pop    %esi
+  80192c:	5d                   	pop    %ebp
+  80192d:	c3                   	ret
+
+0080192e <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  80192e:	55                   	push   %ebp
+  80192f:	89 e5                	mov    %esp,%ebp
+  801931:	56                   	push   %esi
+  801932:	53                   	push   %ebx
+  801933:	89 c6                	mov    %eax,%esi
+  801935:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  801937:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  80193e:	74 27                	je     801967 <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801940:	6a 07                	push   $0x7
+  801942:	68 00 60 80 00       	push   $0x806000
+  801947:	56                   	push   %esi
+  801948:	ff 35 00 50 80 00    	push   0x805000
+  80194e:	e8 b1 0c 00 00       	call   802604 <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  801953:	83 c4 0c             	add    $0xc,%esp
+  801956:	6a 00                	push   $0x0
+  801958:	53                   	push   %ebx
+  801959:	6a 00                	push   $0x0
+  80195b:	e8 30 0c 00 00       	call   802590 <ipc_recv>
+}
+  801960:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801963:	5b                   	pop    %ebx
+  801964:	5e                   	pop    %esi
+  801965:	5d                   	pop    %ebp
+  801966:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  801967:	83 ec 0c             	sub    $0xc,%esp
+  80196a:	6a 01                	push   $0x1
+  80196c:	e8 e7 0c 00 00       	call   802658 <ipc_find_env>
+  801971:	a3 00 50 80 00       	mov    %eax,0x805000
+  801976:	83 c4 10             	add    $0x10,%esp
+  801979:	eb c5                	jmp    801940 <fsipc+0x12>
+
+0080197b <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80197b:	55                   	push   %ebp
+  80197c:	89 e5                	mov    %esp,%ebp
+  80197e:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801981:	8b 45 08             	mov    0x8(%ebp),%eax
+  801984:	8b 40 0c             	mov    0xc(%eax),%eax
+  801987:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.set_size.req_size = newsize;
+  80198c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80198f:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801994:	ba 00 00 00 00       	mov    $0x0,%edx
+  801999:	b8 02 00 00 00       	mov    $0x2,%eax
+  80199e:	e8 8b ff ff ff       	call   80192e <fsipc>
+}
+  8019a3:	c9                   	leave
+  8019a4:	c3                   	ret
+
+008019a5 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8019a5:	55                   	push   %ebp
+  8019a6:	89 e5                	mov    %esp,%ebp
+  8019a8:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8019ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019ae:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019b1:	a3 00 60 80 00       	mov    %eax,0x806000
+  return fsipc(FSREQ_FLUSH, NULL);
+  8019b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019bb:	b8 06 00 00 00       	mov    $0x6,%eax
+  8019c0:	e8 69 ff ff ff       	call   80192e <fsipc>
+}
+  8019c5:	c9                   	leave
+  8019c6:	c3                   	ret
+
+008019c7 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8019c7:	55                   	push   %ebp
+  8019c8:	89 e5                	mov    %esp,%ebp
+  8019ca:	53                   	push   %ebx
+  8019cb:	83 ec 04             	sub    $0x4,%esp
+  8019ce:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8019d1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019d4:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019d7:	a3 00 60 80 00       	mov    %eax,0x806000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8019dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019e1:	b8 05 00 00 00       	mov    $0x5,%eax
+  8019e6:	e8 43 ff ff ff       	call   80192e <fsipc>
+  8019eb:	85 c0                	test   %eax,%eax
+  8019ed:	78 2c                	js     801a1b <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8019ef:	83 ec 08             	sub    $0x8,%esp
+  8019f2:	68 00 60 80 00       	push   $0x806000
+  8019f7:	53                   	push   %ebx
+  8019f8:	e8 cc ef ff ff       	call   8009c9 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  8019fd:	a1 80 60 80 00       	mov    0x806080,%eax
+  801a02:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801a08:	a1 84 60 80 00       	mov    0x806084,%eax
+  801a0d:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801a13:	83 c4 10             	add    $0x10,%esp
+  801a16:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a1b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a1e:	c9                   	leave
+  801a1f:	c3                   	ret
+
+00801a20 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801a20:	55                   	push   %ebp
+  801a21:	89 e5                	mov    %esp,%ebp
+  801a23:	83 ec 0c             	sub    $0xc,%esp
+  801a26:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801a29:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a2c:	8b 52 0c             	mov    0xc(%edx),%edx
+  801a2f:	89 15 00 60 80 00    	mov    %edx,0x806000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801a35:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801a3a:	39 d0                	cmp    %edx,%eax
+  801a3c:	0f 47 c2             	cmova  %edx,%eax
+  801a3f:	a3 04 60 80 00       	mov    %eax,0x806004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  801a44:	50                   	push   %eax
+  801a45:	ff 75 0c             	push   0xc(%ebp)
+  801a48:	68 08 60 80 00       	push   $0x806008
+  801a4d:	e8 fd f0 ff ff       	call   800b4f <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801a52:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a57:	b8 04 00 00 00       	mov    $0x4,%eax
+  801a5c:	e8 cd fe ff ff       	call   80192e <fsipc>
+}
+  801a61:	c9                   	leave
+  801a62:	c3                   	ret
+
+00801a63 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801a63:	55                   	push   %ebp
+  801a64:	89 e5                	mov    %esp,%ebp
+  801a66:	56                   	push   %esi
+  801a67:	53                   	push   %ebx
+  801a68:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801a6b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a6e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a71:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read.req_n = n;
+  801a76:	89 35 04 60 80 00    	mov    %esi,0x806004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801a7c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a81:	b8 03 00 00 00       	mov    $0x3,%eax
+  801a86:	e8 a3 fe ff ff       	call   80192e <fsipc>
+  801a8b:	89 c3                	mov    %eax,%ebx
+  801a8d:	85 c0                	test   %eax,%eax
+  801a8f:	78 1f                	js     801ab0 <devfile_read+0x4d>
+  assert(r <= n);
+  801a91:	39 c6                	cmp    %eax,%esi
+  801a93:	72 24                	jb     801ab9 <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  801a95:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801a9a:	7f 33                	jg     801acf <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801a9c:	83 ec 04             	sub    $0x4,%esp
+  801a9f:	50                   	push   %eax
+  801aa0:	68 00 60 80 00       	push   $0x806000
+  801aa5:	ff 75 0c             	push   0xc(%ebp)
+  801aa8:	e8 a2 f0 ff ff       	call   800b4f <memmove>
+  return r;
+  801aad:	83 c4 10             	add    $0x10,%esp
+}
+  801ab0:	89 d8                	mov    %ebx,%eax
+  801ab2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ab5:	5b                   	pop    %ebx
+  801ab6:	5e                   	pop    %esi
+  801ab7:	5d                   	pop    %ebp
+  801ab8:	c3                   	ret
+  assert(r <= n);
+  801ab9:	68 cc 31 80 00       	push   $0x8031cc
+  801abe:	68 d3 31 80 00       	push   $0x8031d3
+  801ac3:	6a 78                	push   $0x78
+  801ac5:	68 e8 31 80 00       	push   $0x8031e8
+  801aca:	e8 66 e8 ff ff       	call   800335 <_panic>
+  assert(r <= PGSIZE);
+  801acf:	68 f3 31 80 00       	push   $0x8031f3
+  801ad4:	68 d3 31 80 00       	push   $0x8031d3
+  801ad9:	6a 79                	push   $0x79
+  801adb:	68 e8 31 80 00       	push   $0x8031e8
+  801ae0:	e8 50 e8 ff ff       	call   800335 <_panic>
+
+00801ae5 <open>:
+open(const char *path, int mode) {
+  801ae5:	55                   	push   %ebp
+  801ae6:	89 e5                	mov    %esp,%ebp
+  801ae8:	56                   	push   %esi
+  801ae9:	53                   	push   %ebx
+  801aea:	83 ec 1c             	sub    $0x1c,%esp
+  801aed:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801af0:	56                   	push   %esi
+  801af1:	e8 98 ee ff ff       	call   80098e <strlen>
+  801af6:	83 c4 10             	add    $0x10,%esp
+  801af9:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801afe:	7f 6c                	jg     801b6c <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801b00:	83 ec 0c             	sub    $0xc,%esp
+  801b03:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b06:	50                   	push   %eax
+  801b07:	e8 ba f8 ff ff       	call   8013c6 <fd_alloc>
+  801b0c:	89 c3                	mov    %eax,%ebx
+  801b0e:	83 c4 10             	add    $0x10,%esp
+  801b11:	85 c0                	test   %eax,%eax
+  801b13:	78 3c                	js     801b51 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801b15:	83 ec 08             	sub    $0x8,%esp
+  801b18:	56                   	push   %esi
+  801b19:	68 00 60 80 00       	push   $0x806000
+  801b1e:	e8 a6 ee ff ff       	call   8009c9 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801b23:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b26:	a3 00 64 80 00       	mov    %eax,0x806400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801b2b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801b2e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b33:	e8 f6 fd ff ff       	call   80192e <fsipc>
+  801b38:	89 c3                	mov    %eax,%ebx
+  801b3a:	83 c4 10             	add    $0x10,%esp
+  801b3d:	85 c0                	test   %eax,%eax
+  801b3f:	78 19                	js     801b5a <open+0x75>
+  return fd2num(fd);
+  801b41:	83 ec 0c             	sub    $0xc,%esp
+  801b44:	ff 75 f4             	push   -0xc(%ebp)
+  801b47:	e8 53 f8 ff ff       	call   80139f <fd2num>
+  801b4c:	89 c3                	mov    %eax,%ebx
+  801b4e:	83 c4 10             	add    $0x10,%esp
+}
+  801b51:	89 d8                	mov    %ebx,%eax
+  801b53:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b56:	5b                   	pop    %ebx
+  801b57:	5e                   	pop    %esi
+  801b58:	5d                   	pop    %ebp
+  801b59:	c3                   	ret
+    fd_close(fd, 0);
+  801b5a:	83 ec 08             	sub    $0x8,%esp
+  801b5d:	6a 00                	push   $0x0
+  801b5f:	ff 75 f4             	push   -0xc(%ebp)
+  801b62:	e8 58 f9 ff ff       	call   8014bf <fd_close>
+    return r;
+  801b67:	83 c4 10             	add    $0x10,%esp
+  801b6a:	eb e5                	jmp    801b51 <open+0x6c>
+    return -E_BAD_PATH;
+  801b6c:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801b71:	eb de                	jmp    801b51 <open+0x6c>
+
+00801b73 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  801b73:	55                   	push   %ebp
+  801b74:	89 e5                	mov    %esp,%ebp
+  801b76:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801b79:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b7e:	b8 08 00 00 00       	mov    $0x8,%eax
+  801b83:	e8 a6 fd ff ff       	call   80192e <fsipc>
+}
+  801b88:	c9                   	leave
+  801b89:	c3                   	ret
+
+00801b8a <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801b8a:	55                   	push   %ebp
+  801b8b:	89 e5                	mov    %esp,%ebp
+  801b8d:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801b90:	68 ff 31 80 00       	push   $0x8031ff
+  801b95:	ff 75 0c             	push   0xc(%ebp)
+  801b98:	e8 2c ee ff ff       	call   8009c9 <strcpy>
+	return 0;
+}
+  801b9d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ba2:	c9                   	leave
+  801ba3:	c3                   	ret
+
+00801ba4 <devsock_close>:
+{
+  801ba4:	55                   	push   %ebp
+  801ba5:	89 e5                	mov    %esp,%ebp
+  801ba7:	53                   	push   %ebx
+  801ba8:	83 ec 10             	sub    $0x10,%esp
+  801bab:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801bae:	53                   	push   %ebx
+  801baf:	e8 e3 0a 00 00       	call   802697 <pageref>
+  801bb4:	89 c2                	mov    %eax,%edx
+  801bb6:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801bb9:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801bbe:	83 fa 01             	cmp    $0x1,%edx
+  801bc1:	74 05                	je     801bc8 <devsock_close+0x24>
+}
+  801bc3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bc6:	c9                   	leave
+  801bc7:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801bc8:	83 ec 0c             	sub    $0xc,%esp
+  801bcb:	ff 73 0c             	push   0xc(%ebx)
+  801bce:	e8 b7 02 00 00       	call   801e8a <nsipc_close>
+  801bd3:	83 c4 10             	add    $0x10,%esp
+  801bd6:	eb eb                	jmp    801bc3 <devsock_close+0x1f>
+
+00801bd8 <devsock_write>:
+{
+  801bd8:	55                   	push   %ebp
+  801bd9:	89 e5                	mov    %esp,%ebp
+  801bdb:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801bde:	6a 00                	push   $0x0
+  801be0:	ff 75 10             	push   0x10(%ebp)
+  801be3:	ff 75 0c             	push   0xc(%ebp)
+  801be6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801be9:	ff 70 0c             	push   0xc(%eax)
+  801bec:	e8 79 03 00 00       	call   801f6a <nsipc_send>
+}
+  801bf1:	c9                   	leave
+  801bf2:	c3                   	ret
+
+00801bf3 <devsock_read>:
+{
+  801bf3:	55                   	push   %ebp
+  801bf4:	89 e5                	mov    %esp,%ebp
+  801bf6:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801bf9:	6a 00                	push   $0x0
+  801bfb:	ff 75 10             	push   0x10(%ebp)
+  801bfe:	ff 75 0c             	push   0xc(%ebp)
+  801c01:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c04:	ff 70 0c             	push   0xc(%eax)
+  801c07:	e8 ef 02 00 00       	call   801efb <nsipc_recv>
+}
+  801c0c:	c9                   	leave
+  801c0d:	c3                   	ret
+
+00801c0e <fd2sockid>:
+{
+  801c0e:	55                   	push   %ebp
+  801c0f:	89 e5                	mov    %esp,%ebp
+  801c11:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801c14:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801c17:	52                   	push   %edx
+  801c18:	50                   	push   %eax
+  801c19:	e8 fe f7 ff ff       	call   80141c <fd_lookup>
+  801c1e:	83 c4 10             	add    $0x10,%esp
+  801c21:	85 c0                	test   %eax,%eax
+  801c23:	78 10                	js     801c35 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801c25:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c28:	8b 0d 24 40 80 00    	mov    0x804024,%ecx
+  801c2e:	39 08                	cmp    %ecx,(%eax)
+  801c30:	75 05                	jne    801c37 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801c32:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801c35:	c9                   	leave
+  801c36:	c3                   	ret
+		return -E_NOT_SUPP;
+  801c37:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c3c:	eb f7                	jmp    801c35 <fd2sockid+0x27>
+
+00801c3e <alloc_sockfd>:
+{
+  801c3e:	55                   	push   %ebp
+  801c3f:	89 e5                	mov    %esp,%ebp
+  801c41:	56                   	push   %esi
+  801c42:	53                   	push   %ebx
+  801c43:	83 ec 1c             	sub    $0x1c,%esp
+  801c46:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801c48:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c4b:	50                   	push   %eax
+  801c4c:	e8 75 f7 ff ff       	call   8013c6 <fd_alloc>
+  801c51:	89 c3                	mov    %eax,%ebx
+  801c53:	83 c4 10             	add    $0x10,%esp
+  801c56:	85 c0                	test   %eax,%eax
+  801c58:	78 43                	js     801c9d <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801c5a:	83 ec 04             	sub    $0x4,%esp
+  801c5d:	68 07 04 00 00       	push   $0x407
+  801c62:	ff 75 f4             	push   -0xc(%ebp)
+  801c65:	6a 00                	push   $0x0
+  801c67:	e8 49 f1 ff ff       	call   800db5 <sys_page_alloc>
+  801c6c:	89 c3                	mov    %eax,%ebx
+  801c6e:	83 c4 10             	add    $0x10,%esp
+  801c71:	85 c0                	test   %eax,%eax
+  801c73:	78 28                	js     801c9d <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801c75:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c78:	8b 15 24 40 80 00    	mov    0x804024,%edx
+  801c7e:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801c80:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c83:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801c8a:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801c8d:	83 ec 0c             	sub    $0xc,%esp
+  801c90:	50                   	push   %eax
+  801c91:	e8 09 f7 ff ff       	call   80139f <fd2num>
+  801c96:	89 c3                	mov    %eax,%ebx
+  801c98:	83 c4 10             	add    $0x10,%esp
+  801c9b:	eb 0c                	jmp    801ca9 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801c9d:	83 ec 0c             	sub    $0xc,%esp
+  801ca0:	56                   	push   %esi
+  801ca1:	e8 e4 01 00 00       	call   801e8a <nsipc_close>
+		return r;
+  801ca6:	83 c4 10             	add    $0x10,%esp
+}
+  801ca9:	89 d8                	mov    %ebx,%eax
+  801cab:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cae:	5b                   	pop    %ebx
+  801caf:	5e                   	pop    %esi
+  801cb0:	5d                   	pop    %ebp
+  801cb1:	c3                   	ret
+
+00801cb2 <accept>:
+{
+  801cb2:	55                   	push   %ebp
+  801cb3:	89 e5                	mov    %esp,%ebp
+  801cb5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801cb8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cbb:	e8 4e ff ff ff       	call   801c0e <fd2sockid>
+  801cc0:	85 c0                	test   %eax,%eax
+  801cc2:	78 1b                	js     801cdf <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801cc4:	83 ec 04             	sub    $0x4,%esp
+  801cc7:	ff 75 10             	push   0x10(%ebp)
+  801cca:	ff 75 0c             	push   0xc(%ebp)
+  801ccd:	50                   	push   %eax
+  801cce:	e8 0e 01 00 00       	call   801de1 <nsipc_accept>
+  801cd3:	83 c4 10             	add    $0x10,%esp
+  801cd6:	85 c0                	test   %eax,%eax
+  801cd8:	78 05                	js     801cdf <accept+0x2d>
+	return alloc_sockfd(r);
+  801cda:	e8 5f ff ff ff       	call   801c3e <alloc_sockfd>
+}
+  801cdf:	c9                   	leave
+  801ce0:	c3                   	ret
+
+00801ce1 <bind>:
+{
+  801ce1:	55                   	push   %ebp
+  801ce2:	89 e5                	mov    %esp,%ebp
+  801ce4:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801ce7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cea:	e8 1f ff ff ff       	call   801c0e <fd2sockid>
+  801cef:	85 c0                	test   %eax,%eax
+  801cf1:	78 12                	js     801d05 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801cf3:	83 ec 04             	sub    $0x4,%esp
+  801cf6:	ff 75 10             	push   0x10(%ebp)
+  801cf9:	ff 75 0c             	push   0xc(%ebp)
+  801cfc:	50                   	push   %eax
+  801cfd:	e8 31 01 00 00       	call   801e33 <nsipc_bind>
+  801d02:	83 c4 10             	add    $0x10,%esp
+}
+  801d05:	c9                   	leave
+  801d06:	c3                   	ret
+
+00801d07 <shutdown>:
+{
+  801d07:	55                   	push   %ebp
+  801d08:	89 e5                	mov    %esp,%ebp
+  801d0a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d0d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d10:	e8 f9 fe ff ff       	call   801c0e <fd2sockid>
+  801d15:	85 c0                	test   %eax,%eax
+  801d17:	78 0f                	js     801d28 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801d19:	83 ec 08             	sub    $0x8,%esp
+  801d1c:	ff 75 0c             	push   0xc(%ebp)
+  801d1f:	50                   	push   %eax
+  801d20:	e8 43 01 00 00       	call   801e68 <nsipc_shutdown>
+  801d25:	83 c4 10             	add    $0x10,%esp
+}
+  801d28:	c9                   	leave
+  801d29:	c3                   	ret
+
+00801d2a <connect>:
+{
+  801d2a:	55                   	push   %ebp
+  801d2b:	89 e5                	mov    %esp,%ebp
+  801d2d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d30:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d33:	e8 d6 fe ff ff       	call   801c0e <fd2sockid>
+  801d38:	85 c0                	test   %eax,%eax
+  801d3a:	78 12                	js     801d4e <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801d3c:	83 ec 04             	sub    $0x4,%esp
+  801d3f:	ff 75 10             	push   0x10(%ebp)
+  801d42:	ff 75 0c             	push   0xc(%ebp)
+  801d45:	50                   	push   %eax
+  801d46:	e8 59 01 00 00       	call   801ea4 <nsipc_connect>
+  801d4b:	83 c4 10             	add    $0x10,%esp
+}
+  801d4e:	c9                   	leave
+  801d4f:	c3                   	ret
+
+00801d50 <listen>:
+{
+  801d50:	55                   	push   %ebp
+  801d51:	89 e5                	mov    %esp,%ebp
+  801d53:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d56:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d59:	e8 b0 fe ff ff       	call   801c0e <fd2sockid>
+  801d5e:	85 c0                	test   %eax,%eax
+  801d60:	78 0f                	js     801d71 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801d62:	83 ec 08             	sub    $0x8,%esp
+  801d65:	ff 75 0c             	push   0xc(%ebp)
+  801d68:	50                   	push   %eax
+  801d69:	e8 6b 01 00 00       	call   801ed9 <nsipc_listen>
+  801d6e:	83 c4 10             	add    $0x10,%esp
+}
+  801d71:	c9                   	leave
+  801d72:	c3                   	ret
+
+00801d73 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801d73:	55                   	push   %ebp
+  801d74:	89 e5                	mov    %esp,%ebp
+  801d76:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801d79:	ff 75 10             	push   0x10(%ebp)
+  801d7c:	ff 75 0c             	push   0xc(%ebp)
+  801d7f:	ff 75 08             	push   0x8(%ebp)
+  801d82:	e8 41 02 00 00       	call   801fc8 <nsipc_socket>
+  801d87:	83 c4 10             	add    $0x10,%esp
+  801d8a:	85 c0                	test   %eax,%eax
+  801d8c:	78 05                	js     801d93 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801d8e:	e8 ab fe ff ff       	call   801c3e <alloc_sockfd>
+}
+  801d93:	c9                   	leave
+  801d94:	c3                   	ret
+
+00801d95 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801d95:	55                   	push   %ebp
+  801d96:	89 e5                	mov    %esp,%ebp
+  801d98:	53                   	push   %ebx
+  801d99:	83 ec 04             	sub    $0x4,%esp
+  801d9c:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801d9e:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  801da5:	74 26                	je     801dcd <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801da7:	6a 07                	push   $0x7
+  801da9:	68 00 70 80 00       	push   $0x807000
+  801dae:	53                   	push   %ebx
+  801daf:	ff 35 04 50 80 00    	push   0x805004
+  801db5:	e8 4a 08 00 00       	call   802604 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801dba:	83 c4 0c             	add    $0xc,%esp
+  801dbd:	6a 00                	push   $0x0
+  801dbf:	6a 00                	push   $0x0
+  801dc1:	6a 00                	push   $0x0
+  801dc3:	e8 c8 07 00 00       	call   802590 <ipc_recv>
+}
+  801dc8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801dcb:	c9                   	leave
+  801dcc:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801dcd:	83 ec 0c             	sub    $0xc,%esp
+  801dd0:	6a 02                	push   $0x2
+  801dd2:	e8 81 08 00 00       	call   802658 <ipc_find_env>
+  801dd7:	a3 04 50 80 00       	mov    %eax,0x805004
+  801ddc:	83 c4 10             	add    $0x10,%esp
+  801ddf:	eb c6                	jmp    801da7 <nsipc+0x12>
+
+00801de1 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801de1:	55                   	push   %ebp
+  801de2:	89 e5                	mov    %esp,%ebp
+  801de4:	56                   	push   %esi
+  801de5:	53                   	push   %ebx
+  801de6:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801de9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dec:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801df1:	8b 06                	mov    (%esi),%eax
+  801df3:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801df8:	b8 01 00 00 00       	mov    $0x1,%eax
+  801dfd:	e8 93 ff ff ff       	call   801d95 <nsipc>
+  801e02:	89 c3                	mov    %eax,%ebx
+  801e04:	85 c0                	test   %eax,%eax
+  801e06:	79 09                	jns    801e11 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801e08:	89 d8                	mov    %ebx,%eax
+  801e0a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e0d:	5b                   	pop    %ebx
+  801e0e:	5e                   	pop    %esi
+  801e0f:	5d                   	pop    %ebp
+  801e10:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801e11:	83 ec 04             	sub    $0x4,%esp
+  801e14:	ff 35 10 70 80 00    	push   0x807010
+  801e1a:	68 00 70 80 00       	push   $0x807000
+  801e1f:	ff 75 0c             	push   0xc(%ebp)
+  801e22:	e8 28 ed ff ff       	call   800b4f <memmove>
+		*addrlen = ret->ret_addrlen;
+  801e27:	a1 10 70 80 00       	mov    0x807010,%eax
+  801e2c:	89 06                	mov    %eax,(%esi)
+  801e2e:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801e31:	eb d5                	jmp    801e08 <nsipc_accept+0x27>
+
+00801e33 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801e33:	55                   	push   %ebp
+  801e34:	89 e5                	mov    %esp,%ebp
+  801e36:	53                   	push   %ebx
+  801e37:	83 ec 08             	sub    $0x8,%esp
+  801e3a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801e3d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e40:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801e45:	53                   	push   %ebx
+  801e46:	ff 75 0c             	push   0xc(%ebp)
+  801e49:	68 04 70 80 00       	push   $0x807004
+  801e4e:	e8 fc ec ff ff       	call   800b4f <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801e53:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  801e59:	b8 02 00 00 00       	mov    $0x2,%eax
+  801e5e:	e8 32 ff ff ff       	call   801d95 <nsipc>
+}
+  801e63:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e66:	c9                   	leave
+  801e67:	c3                   	ret
+
+00801e68 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801e68:	55                   	push   %ebp
+  801e69:	89 e5                	mov    %esp,%ebp
+  801e6b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801e6e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e71:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  801e76:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e79:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  801e7e:	b8 03 00 00 00       	mov    $0x3,%eax
+  801e83:	e8 0d ff ff ff       	call   801d95 <nsipc>
+}
+  801e88:	c9                   	leave
+  801e89:	c3                   	ret
+
+00801e8a <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801e8a:	55                   	push   %ebp
+  801e8b:	89 e5                	mov    %esp,%ebp
+  801e8d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801e90:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e93:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  801e98:	b8 04 00 00 00       	mov    $0x4,%eax
+  801e9d:	e8 f3 fe ff ff       	call   801d95 <nsipc>
+}
+  801ea2:	c9                   	leave
+  801ea3:	c3                   	ret
+
+00801ea4 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801ea4:	55                   	push   %ebp
+  801ea5:	89 e5                	mov    %esp,%ebp
+  801ea7:	53                   	push   %ebx
+  801ea8:	83 ec 08             	sub    $0x8,%esp
+  801eab:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801eae:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eb1:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801eb6:	53                   	push   %ebx
+  801eb7:	ff 75 0c             	push   0xc(%ebp)
+  801eba:	68 04 70 80 00       	push   $0x807004
+  801ebf:	e8 8b ec ff ff       	call   800b4f <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801ec4:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  801eca:	b8 05 00 00 00       	mov    $0x5,%eax
+  801ecf:	e8 c1 fe ff ff       	call   801d95 <nsipc>
+}
+  801ed4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ed7:	c9                   	leave
+  801ed8:	c3                   	ret
+
+00801ed9 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801ed9:	55                   	push   %ebp
+  801eda:	89 e5                	mov    %esp,%ebp
+  801edc:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801edf:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ee2:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  801ee7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801eea:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  801eef:	b8 06 00 00 00       	mov    $0x6,%eax
+  801ef4:	e8 9c fe ff ff       	call   801d95 <nsipc>
+}
+  801ef9:	c9                   	leave
+  801efa:	c3                   	ret
+
+00801efb <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801efb:	55                   	push   %ebp
+  801efc:	89 e5                	mov    %esp,%ebp
+  801efe:	56                   	push   %esi
+  801eff:	53                   	push   %ebx
+  801f00:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801f03:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f06:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  801f0b:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  801f11:	8b 45 14             	mov    0x14(%ebp),%eax
+  801f14:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801f19:	b8 07 00 00 00       	mov    $0x7,%eax
+  801f1e:	e8 72 fe ff ff       	call   801d95 <nsipc>
+  801f23:	89 c3                	mov    %eax,%ebx
+  801f25:	85 c0                	test   %eax,%eax
+  801f27:	78 22                	js     801f4b <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801f29:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801f2e:	39 c6                	cmp    %eax,%esi
+  801f30:	0f 4e c6             	cmovle %esi,%eax
+  801f33:	39 c3                	cmp    %eax,%ebx
+  801f35:	7f 1d                	jg     801f54 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801f37:	83 ec 04             	sub    $0x4,%esp
+  801f3a:	53                   	push   %ebx
+  801f3b:	68 00 70 80 00       	push   $0x807000
+  801f40:	ff 75 0c             	push   0xc(%ebp)
+  801f43:	e8 07 ec ff ff       	call   800b4f <memmove>
+  801f48:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801f4b:	89 d8                	mov    %ebx,%eax
+  801f4d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f50:	5b                   	pop    %ebx
+  801f51:	5e                   	pop    %esi
+  801f52:	5d                   	pop    %ebp
+  801f53:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801f54:	68 0b 32 80 00       	push   $0x80320b
+  801f59:	68 d3 31 80 00       	push   $0x8031d3
+  801f5e:	6a 62                	push   $0x62
+  801f60:	68 20 32 80 00       	push   $0x803220
+  801f65:	e8 cb e3 ff ff       	call   800335 <_panic>
+
+00801f6a <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801f6a:	55                   	push   %ebp
+  801f6b:	89 e5                	mov    %esp,%ebp
+  801f6d:	53                   	push   %ebx
+  801f6e:	83 ec 04             	sub    $0x4,%esp
+  801f71:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801f74:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f77:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  801f7c:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801f82:	7f 2e                	jg     801fb2 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801f84:	83 ec 04             	sub    $0x4,%esp
+  801f87:	53                   	push   %ebx
+  801f88:	ff 75 0c             	push   0xc(%ebp)
+  801f8b:	68 0c 70 80 00       	push   $0x80700c
+  801f90:	e8 ba eb ff ff       	call   800b4f <memmove>
+	nsipcbuf.send.req_size = size;
+  801f95:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  801f9b:	8b 45 14             	mov    0x14(%ebp),%eax
+  801f9e:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  801fa3:	b8 08 00 00 00       	mov    $0x8,%eax
+  801fa8:	e8 e8 fd ff ff       	call   801d95 <nsipc>
+}
+  801fad:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fb0:	c9                   	leave
+  801fb1:	c3                   	ret
+	assert(size < 1600);
+  801fb2:	68 2c 32 80 00       	push   $0x80322c
+  801fb7:	68 d3 31 80 00       	push   $0x8031d3
+  801fbc:	6a 6d                	push   $0x6d
+  801fbe:	68 20 32 80 00       	push   $0x803220
+  801fc3:	e8 6d e3 ff ff       	call   800335 <_panic>
+
+00801fc8 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801fc8:	55                   	push   %ebp
+  801fc9:	89 e5                	mov    %esp,%ebp
+  801fcb:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801fce:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fd1:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  801fd6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fd9:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  801fde:	8b 45 10             	mov    0x10(%ebp),%eax
+  801fe1:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  801fe6:	b8 09 00 00 00       	mov    $0x9,%eax
+  801feb:	e8 a5 fd ff ff       	call   801d95 <nsipc>
+}
+  801ff0:	c9                   	leave
+  801ff1:	c3                   	ret
+
+00801ff2 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801ff2:	55                   	push   %ebp
+  801ff3:	89 e5                	mov    %esp,%ebp
+  801ff5:	56                   	push   %esi
+  801ff6:	53                   	push   %ebx
+  801ff7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801ffa:	83 ec 0c             	sub    $0xc,%esp
+  801ffd:	ff 75 08             	push   0x8(%ebp)
+  802000:	e8 aa f3 ff ff       	call   8013af <fd2data>
+  802005:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802007:	83 c4 08             	add    $0x8,%esp
+  80200a:	68 38 32 80 00       	push   $0x803238
+  80200f:	53                   	push   %ebx
+  802010:	e8 b4 e9 ff ff       	call   8009c9 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802015:	8b 46 04             	mov    0x4(%esi),%eax
+  802018:	2b 06                	sub    (%esi),%eax
+  80201a:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802020:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802027:	00 00 00 
+	stat->st_dev = &devpipe;
+  80202a:	c7 83 88 00 00 00 40 	movl   $0x804040,0x88(%ebx)
+  802031:	40 80 00 
+	return 0;
+}
+  802034:	b8 00 00 00 00       	mov    $0x0,%eax
+  802039:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80203c:	5b                   	pop    %ebx
+  80203d:	5e                   	pop    %esi
+  80203e:	5d                   	pop    %ebp
+  80203f:	c3                   	ret
+
+00802040 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802040:	55                   	push   %ebp
+  802041:	89 e5                	mov    %esp,%ebp
+  802043:	53                   	push   %ebx
+  802044:	83 ec 0c             	sub    $0xc,%esp
+  802047:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  80204a:	53                   	push   %ebx
+  80204b:	6a 00                	push   $0x0
+  80204d:	e8 e8 ed ff ff       	call   800e3a <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802052:	89 1c 24             	mov    %ebx,(%esp)
+  802055:	e8 55 f3 ff ff       	call   8013af <fd2data>
+  80205a:	83 c4 08             	add    $0x8,%esp
+  80205d:	50                   	push   %eax
+  80205e:	6a 00                	push   $0x0
+  802060:	e8 d5 ed ff ff       	call   800e3a <sys_page_unmap>
+}
+  802065:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802068:	c9                   	leave
+  802069:	c3                   	ret
+
+0080206a <_pipeisclosed>:
+{
+  80206a:	55                   	push   %ebp
+  80206b:	89 e5                	mov    %esp,%ebp
+  80206d:	57                   	push   %edi
+  80206e:	56                   	push   %esi
+  80206f:	53                   	push   %ebx
+  802070:	83 ec 1c             	sub    $0x1c,%esp
+  802073:	89 c7                	mov    %eax,%edi
+  802075:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  802077:	a1 08 50 80 00       	mov    0x805008,%eax
+  80207c:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  80207f:	83 ec 0c             	sub    $0xc,%esp
+  802082:	57                   	push   %edi
+  802083:	e8 0f 06 00 00       	call   802697 <pageref>
+  802088:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80208b:	89 34 24             	mov    %esi,(%esp)
+  80208e:	e8 04 06 00 00       	call   802697 <pageref>
+		nn = thisenv->env_runs;
+  802093:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  802099:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  80209c:	83 c4 10             	add    $0x10,%esp
+  80209f:	39 cb                	cmp    %ecx,%ebx
+  8020a1:	74 1b                	je     8020be <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  8020a3:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8020a6:	75 cf                	jne    802077 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8020a8:	8b 42 58             	mov    0x58(%edx),%eax
+  8020ab:	6a 01                	push   $0x1
+  8020ad:	50                   	push   %eax
+  8020ae:	53                   	push   %ebx
+  8020af:	68 3f 32 80 00       	push   $0x80323f
+  8020b4:	e8 57 e3 ff ff       	call   800410 <cprintf>
+  8020b9:	83 c4 10             	add    $0x10,%esp
+  8020bc:	eb b9                	jmp    802077 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  8020be:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8020c1:	0f 94 c0             	sete   %al
+  8020c4:	0f b6 c0             	movzbl %al,%eax
+}
+  8020c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020ca:	5b                   	pop    %ebx
+  8020cb:	5e                   	pop    %esi
+  8020cc:	5f                   	pop    %edi
+  8020cd:	5d                   	pop    %ebp
+  8020ce:	c3                   	ret
+
+008020cf <devpipe_write>:
+{
+  8020cf:	55                   	push   %ebp
+  8020d0:	89 e5                	mov    %esp,%ebp
+  8020d2:	57                   	push   %edi
+  8020d3:	56                   	push   %esi
+  8020d4:	53                   	push   %ebx
+  8020d5:	83 ec 28             	sub    $0x28,%esp
+  8020d8:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  8020db:	56                   	push   %esi
+  8020dc:	e8 ce f2 ff ff       	call   8013af <fd2data>
+  8020e1:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8020e3:	83 c4 10             	add    $0x10,%esp
+  8020e6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020eb:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8020ee:	75 09                	jne    8020f9 <devpipe_write+0x2a>
+	return i;
+  8020f0:	89 f8                	mov    %edi,%eax
+  8020f2:	eb 23                	jmp    802117 <devpipe_write+0x48>
+			sys_yield();
+  8020f4:	e8 9d ec ff ff       	call   800d96 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8020f9:	8b 43 04             	mov    0x4(%ebx),%eax
+  8020fc:	8b 0b                	mov    (%ebx),%ecx
+  8020fe:	8d 51 20             	lea    0x20(%ecx),%edx
+  802101:	39 d0                	cmp    %edx,%eax
+  802103:	72 1a                	jb     80211f <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802105:	89 da                	mov    %ebx,%edx
+  802107:	89 f0                	mov    %esi,%eax
+  802109:	e8 5c ff ff ff       	call   80206a <_pipeisclosed>
+  80210e:	85 c0                	test   %eax,%eax
+  802110:	74 e2                	je     8020f4 <devpipe_write+0x25>
+				return 0;
+  802112:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802117:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80211a:	5b                   	pop    %ebx
+  80211b:	5e                   	pop    %esi
+  80211c:	5f                   	pop    %edi
+  80211d:	5d                   	pop    %ebp
+  80211e:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80211f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802122:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802126:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802129:	89 c2                	mov    %eax,%edx
+  80212b:	c1 fa 1f             	sar    $0x1f,%edx
+  80212e:	89 d1                	mov    %edx,%ecx
+  802130:	c1 e9 1b             	shr    $0x1b,%ecx
+  802133:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802136:	83 e2 1f             	and    $0x1f,%edx
+  802139:	29 ca                	sub    %ecx,%edx
+  80213b:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80213f:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802143:	83 c0 01             	add    $0x1,%eax
+  802146:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802149:	83 c7 01             	add    $0x1,%edi
+  80214c:	eb 9d                	jmp    8020eb <devpipe_write+0x1c>
+
+0080214e <devpipe_read>:
+{
+  80214e:	55                   	push   %ebp
+  80214f:	89 e5                	mov    %esp,%ebp
+  802151:	57                   	push   %edi
+  802152:	56                   	push   %esi
+  802153:	53                   	push   %ebx
+  802154:	83 ec 18             	sub    $0x18,%esp
+  802157:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  80215a:	57                   	push   %edi
+  80215b:	e8 4f f2 ff ff       	call   8013af <fd2data>
+  802160:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802162:	83 c4 10             	add    $0x10,%esp
+  802165:	be 00 00 00 00       	mov    $0x0,%esi
+  80216a:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80216d:	75 13                	jne    802182 <devpipe_read+0x34>
+	return i;
+  80216f:	89 f0                	mov    %esi,%eax
+  802171:	eb 02                	jmp    802175 <devpipe_read+0x27>
+				return i;
+  802173:	89 f0                	mov    %esi,%eax
+}
+  802175:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802178:	5b                   	pop    %ebx
+  802179:	5e                   	pop    %esi
+  80217a:	5f                   	pop    %edi
+  80217b:	5d                   	pop    %ebp
+  80217c:	c3                   	ret
+			sys_yield();
+  80217d:	e8 14 ec ff ff       	call   800d96 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802182:	8b 03                	mov    (%ebx),%eax
+  802184:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802187:	75 18                	jne    8021a1 <devpipe_read+0x53>
+			if (i > 0)
+  802189:	85 f6                	test   %esi,%esi
+  80218b:	75 e6                	jne    802173 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  80218d:	89 da                	mov    %ebx,%edx
+  80218f:	89 f8                	mov    %edi,%eax
+  802191:	e8 d4 fe ff ff       	call   80206a <_pipeisclosed>
+  802196:	85 c0                	test   %eax,%eax
+  802198:	74 e3                	je     80217d <devpipe_read+0x2f>
+				return 0;
+  80219a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80219f:	eb d4                	jmp    802175 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8021a1:	99                   	cltd
+  8021a2:	c1 ea 1b             	shr    $0x1b,%edx
+  8021a5:	01 d0                	add    %edx,%eax
+  8021a7:	83 e0 1f             	and    $0x1f,%eax
+  8021aa:	29 d0                	sub    %edx,%eax
+  8021ac:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8021b1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8021b4:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8021b7:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8021ba:	83 c6 01             	add    $0x1,%esi
+  8021bd:	eb ab                	jmp    80216a <devpipe_read+0x1c>
+
+008021bf <pipe>:
+{
+  8021bf:	55                   	push   %ebp
+  8021c0:	89 e5                	mov    %esp,%ebp
+  8021c2:	56                   	push   %esi
+  8021c3:	53                   	push   %ebx
+  8021c4:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8021c7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021ca:	50                   	push   %eax
+  8021cb:	e8 f6 f1 ff ff       	call   8013c6 <fd_alloc>
+  8021d0:	89 c3                	mov    %eax,%ebx
+  8021d2:	83 c4 10             	add    $0x10,%esp
+  8021d5:	85 c0                	test   %eax,%eax
+  8021d7:	0f 88 23 01 00 00    	js     802300 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8021dd:	83 ec 04             	sub    $0x4,%esp
+  8021e0:	68 07 04 00 00       	push   $0x407
+  8021e5:	ff 75 f4             	push   -0xc(%ebp)
+  8021e8:	6a 00                	push   $0x0
+  8021ea:	e8 c6 eb ff ff       	call   800db5 <sys_page_alloc>
+  8021ef:	89 c3                	mov    %eax,%ebx
+  8021f1:	83 c4 10             	add    $0x10,%esp
+  8021f4:	85 c0                	test   %eax,%eax
+  8021f6:	0f 88 04 01 00 00    	js     802300 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8021fc:	83 ec 0c             	sub    $0xc,%esp
+  8021ff:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802202:	50                   	push   %eax
+  802203:	e8 be f1 ff ff       	call   8013c6 <fd_alloc>
+  802208:	89 c3                	mov    %eax,%ebx
+  80220a:	83 c4 10             	add    $0x10,%esp
+  80220d:	85 c0                	test   %eax,%eax
+  80220f:	0f 88 db 00 00 00    	js     8022f0 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802215:	83 ec 04             	sub    $0x4,%esp
+  802218:	68 07 04 00 00       	push   $0x407
+  80221d:	ff 75 f0             	push   -0x10(%ebp)
+  802220:	6a 00                	push   $0x0
+  802222:	e8 8e eb ff ff       	call   800db5 <sys_page_alloc>
+  802227:	89 c3                	mov    %eax,%ebx
+  802229:	83 c4 10             	add    $0x10,%esp
+  80222c:	85 c0                	test   %eax,%eax
+  80222e:	0f 88 bc 00 00 00    	js     8022f0 <pipe+0x131>
+	va = fd2data(fd0);
+  802234:	83 ec 0c             	sub    $0xc,%esp
+  802237:	ff 75 f4             	push   -0xc(%ebp)
+  80223a:	e8 70 f1 ff ff       	call   8013af <fd2data>
+  80223f:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802241:	83 c4 0c             	add    $0xc,%esp
+  802244:	68 07 04 00 00       	push   $0x407
+  802249:	50                   	push   %eax
+  80224a:	6a 00                	push   $0x0
+  80224c:	e8 64 eb ff ff       	call   800db5 <sys_page_alloc>
+  802251:	89 c3                	mov    %eax,%ebx
+  802253:	83 c4 10             	add    $0x10,%esp
+  802256:	85 c0                	test   %eax,%eax
+  802258:	0f 88 82 00 00 00    	js     8022e0 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80225e:	83 ec 0c             	sub    $0xc,%esp
+  802261:	ff 75 f0             	push   -0x10(%ebp)
+  802264:	e8 46 f1 ff ff       	call   8013af <fd2data>
+  802269:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802270:	50                   	push   %eax
+  802271:	6a 00                	push   $0x0
+  802273:	56                   	push   %esi
+  802274:	6a 00                	push   $0x0
+  802276:	e8 7d eb ff ff       	call   800df8 <sys_page_map>
+  80227b:	89 c3                	mov    %eax,%ebx
+  80227d:	83 c4 20             	add    $0x20,%esp
+  802280:	85 c0                	test   %eax,%eax
+  802282:	78 4e                	js     8022d2 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802284:	a1 40 40 80 00       	mov    0x804040,%eax
+  802289:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80228c:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80228e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802291:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802298:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80229b:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80229d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8022a0:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8022a7:	83 ec 0c             	sub    $0xc,%esp
+  8022aa:	ff 75 f4             	push   -0xc(%ebp)
+  8022ad:	e8 ed f0 ff ff       	call   80139f <fd2num>
+  8022b2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8022b5:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8022b7:	83 c4 04             	add    $0x4,%esp
+  8022ba:	ff 75 f0             	push   -0x10(%ebp)
+  8022bd:	e8 dd f0 ff ff       	call   80139f <fd2num>
+  8022c2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8022c5:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8022c8:	83 c4 10             	add    $0x10,%esp
+  8022cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8022d0:	eb 2e                	jmp    802300 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8022d2:	83 ec 08             	sub    $0x8,%esp
+  8022d5:	56                   	push   %esi
+  8022d6:	6a 00                	push   $0x0
+  8022d8:	e8 5d eb ff ff       	call   800e3a <sys_page_unmap>
+  8022dd:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8022e0:	83 ec 08             	sub    $0x8,%esp
+  8022e3:	ff 75 f0             	push   -0x10(%ebp)
+  8022e6:	6a 00                	push   $0x0
+  8022e8:	e8 4d eb ff ff       	call   800e3a <sys_page_unmap>
+  8022ed:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8022f0:	83 ec 08             	sub    $0x8,%esp
+  8022f3:	ff 75 f4             	push   -0xc(%ebp)
+  8022f6:	6a 00                	push   $0x0
+  8022f8:	e8 3d eb ff ff       	call   800e3a <sys_page_unmap>
+  8022fd:	83 c4 10             	add    $0x10,%esp
+}
+  802300:	89 d8                	mov    %ebx,%eax
+  802302:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802305:	5b                   	pop    %ebx
+  802306:	5e                   	pop    %esi
+  802307:	5d                   	pop    %ebp
+  802308:	c3                   	ret
+
+00802309 <pipeisclosed>:
+{
+  802309:	55                   	push   %ebp
+  80230a:	89 e5                	mov    %esp,%ebp
+  80230c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80230f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802312:	50                   	push   %eax
+  802313:	ff 75 08             	push   0x8(%ebp)
+  802316:	e8 01 f1 ff ff       	call   80141c <fd_lookup>
+  80231b:	83 c4 10             	add    $0x10,%esp
+  80231e:	85 c0                	test   %eax,%eax
+  802320:	78 18                	js     80233a <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802322:	83 ec 0c             	sub    $0xc,%esp
+  802325:	ff 75 f4             	push   -0xc(%ebp)
+  802328:	e8 82 f0 ff ff       	call   8013af <fd2data>
+  80232d:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80232f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802332:	e8 33 fd ff ff       	call   80206a <_pipeisclosed>
+  802337:	83 c4 10             	add    $0x10,%esp
+}
+  80233a:	c9                   	leave
+  80233b:	c3                   	ret
+
+0080233c <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  80233c:	55                   	push   %ebp
+  80233d:	89 e5                	mov    %esp,%ebp
+  80233f:	56                   	push   %esi
+  802340:	53                   	push   %ebx
+  802341:	8b 75 08             	mov    0x8(%ebp),%esi
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  802344:	85 f6                	test   %esi,%esi
+  802346:	74 15                	je     80235d <wait+0x21>
+	e = &envs[ENVX(envid)];
+  802348:	89 f0                	mov    %esi,%eax
+  80234a:	25 ff 03 00 00       	and    $0x3ff,%eax
+
+    while (e->env_id == envid && e->env_status != ENV_FREE) {
+  80234f:	8d 1c c0             	lea    (%eax,%eax,8),%ebx
+  802352:	c1 e3 04             	shl    $0x4,%ebx
+  802355:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  80235b:	eb 1b                	jmp    802378 <wait+0x3c>
+	assert(envid != 0);
+  80235d:	68 57 32 80 00       	push   $0x803257
+  802362:	68 d3 31 80 00       	push   $0x8031d3
+  802367:	6a 09                	push   $0x9
+  802369:	68 62 32 80 00       	push   $0x803262
+  80236e:	e8 c2 df ff ff       	call   800335 <_panic>
+        sys_yield();
+  802373:	e8 1e ea ff ff       	call   800d96 <sys_yield>
+    while (e->env_id == envid && e->env_status != ENV_FREE) {
+  802378:	8b 43 48             	mov    0x48(%ebx),%eax
+  80237b:	39 f0                	cmp    %esi,%eax
+  80237d:	75 07                	jne    802386 <wait+0x4a>
+  80237f:	8b 43 54             	mov    0x54(%ebx),%eax
+  802382:	85 c0                	test   %eax,%eax
+  802384:	75 ed                	jne    802373 <wait+0x37>
+    }
+}
+  802386:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802389:	5b                   	pop    %ebx
+  80238a:	5e                   	pop    %esi
+  80238b:	5d                   	pop    %ebp
+  80238c:	c3                   	ret
+
+0080238d <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80238d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802392:	c3                   	ret
+
+00802393 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802393:	55                   	push   %ebp
+  802394:	89 e5                	mov    %esp,%ebp
+  802396:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802399:	68 6d 32 80 00       	push   $0x80326d
+  80239e:	ff 75 0c             	push   0xc(%ebp)
+  8023a1:	e8 23 e6 ff ff       	call   8009c9 <strcpy>
+	return 0;
+}
+  8023a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023ab:	c9                   	leave
+  8023ac:	c3                   	ret
+
+008023ad <devcons_write>:
+{
+  8023ad:	55                   	push   %ebp
+  8023ae:	89 e5                	mov    %esp,%ebp
+  8023b0:	57                   	push   %edi
+  8023b1:	56                   	push   %esi
+  8023b2:	53                   	push   %ebx
+  8023b3:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8023b9:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8023be:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8023c4:	eb 2e                	jmp    8023f4 <devcons_write+0x47>
+		m = n - tot;
+  8023c6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8023c9:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8023cb:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8023d0:	39 c3                	cmp    %eax,%ebx
+  8023d2:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8023d5:	83 ec 04             	sub    $0x4,%esp
+  8023d8:	53                   	push   %ebx
+  8023d9:	89 f0                	mov    %esi,%eax
+  8023db:	03 45 0c             	add    0xc(%ebp),%eax
+  8023de:	50                   	push   %eax
+  8023df:	57                   	push   %edi
+  8023e0:	e8 6a e7 ff ff       	call   800b4f <memmove>
+		sys_cputs(buf, m);
+  8023e5:	83 c4 08             	add    $0x8,%esp
+  8023e8:	53                   	push   %ebx
+  8023e9:	57                   	push   %edi
+  8023ea:	e8 0a e9 ff ff       	call   800cf9 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8023ef:	01 de                	add    %ebx,%esi
+  8023f1:	83 c4 10             	add    $0x10,%esp
+  8023f4:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8023f7:	72 cd                	jb     8023c6 <devcons_write+0x19>
+}
+  8023f9:	89 f0                	mov    %esi,%eax
+  8023fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023fe:	5b                   	pop    %ebx
+  8023ff:	5e                   	pop    %esi
+  802400:	5f                   	pop    %edi
+  802401:	5d                   	pop    %ebp
+  802402:	c3                   	ret
+
+00802403 <devcons_read>:
+{
+  802403:	55                   	push   %ebp
+  802404:	89 e5                	mov    %esp,%ebp
+  802406:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802409:	b8 00 00 00 00       	mov    $0x0,%eax
+  80240e:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802412:	75 07                	jne    80241b <devcons_read+0x18>
+  802414:	eb 1f                	jmp    802435 <devcons_read+0x32>
+		sys_yield();
+  802416:	e8 7b e9 ff ff       	call   800d96 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80241b:	e8 f7 e8 ff ff       	call   800d17 <sys_cgetc>
+  802420:	85 c0                	test   %eax,%eax
+  802422:	74 f2                	je     802416 <devcons_read+0x13>
+	if (c < 0)
+  802424:	78 0f                	js     802435 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802426:	83 f8 04             	cmp    $0x4,%eax
+  802429:	74 0c                	je     802437 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80242b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80242e:	88 02                	mov    %al,(%edx)
+	return 1;
+  802430:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802435:	c9                   	leave
+  802436:	c3                   	ret
+		return 0;
+  802437:	b8 00 00 00 00       	mov    $0x0,%eax
+  80243c:	eb f7                	jmp    802435 <devcons_read+0x32>
+
+0080243e <cputchar>:
+{
+  80243e:	55                   	push   %ebp
+  80243f:	89 e5                	mov    %esp,%ebp
+  802441:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802444:	8b 45 08             	mov    0x8(%ebp),%eax
+  802447:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80244a:	6a 01                	push   $0x1
+  80244c:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80244f:	50                   	push   %eax
+  802450:	e8 a4 e8 ff ff       	call   800cf9 <sys_cputs>
+}
+  802455:	83 c4 10             	add    $0x10,%esp
+  802458:	c9                   	leave
+  802459:	c3                   	ret
+
+0080245a <getchar>:
+{
+  80245a:	55                   	push   %ebp
+  80245b:	89 e5                	mov    %esp,%ebp
+  80245d:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802460:	6a 01                	push   $0x1
+  802462:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802465:	50                   	push   %eax
+  802466:	6a 00                	push   $0x0
+  802468:	e8 15 f2 ff ff       	call   801682 <read>
+	if (r < 0)
+  80246d:	83 c4 10             	add    $0x10,%esp
+  802470:	85 c0                	test   %eax,%eax
+  802472:	78 06                	js     80247a <getchar+0x20>
+	if (r < 1)
+  802474:	74 06                	je     80247c <getchar+0x22>
+	return c;
+  802476:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80247a:	c9                   	leave
+  80247b:	c3                   	ret
+		return -E_EOF;
+  80247c:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802481:	eb f7                	jmp    80247a <getchar+0x20>
+
+00802483 <iscons>:
+{
+  802483:	55                   	push   %ebp
+  802484:	89 e5                	mov    %esp,%ebp
+  802486:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802489:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80248c:	50                   	push   %eax
+  80248d:	ff 75 08             	push   0x8(%ebp)
+  802490:	e8 87 ef ff ff       	call   80141c <fd_lookup>
+  802495:	83 c4 10             	add    $0x10,%esp
+  802498:	85 c0                	test   %eax,%eax
+  80249a:	78 11                	js     8024ad <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80249c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80249f:	8b 15 5c 40 80 00    	mov    0x80405c,%edx
+  8024a5:	39 10                	cmp    %edx,(%eax)
+  8024a7:	0f 94 c0             	sete   %al
+  8024aa:	0f b6 c0             	movzbl %al,%eax
+}
+  8024ad:	c9                   	leave
+  8024ae:	c3                   	ret
+
+008024af <opencons>:
+{
+  8024af:	55                   	push   %ebp
+  8024b0:	89 e5                	mov    %esp,%ebp
+  8024b2:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8024b5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024b8:	50                   	push   %eax
+  8024b9:	e8 08 ef ff ff       	call   8013c6 <fd_alloc>
+  8024be:	83 c4 10             	add    $0x10,%esp
+  8024c1:	85 c0                	test   %eax,%eax
+  8024c3:	78 3a                	js     8024ff <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8024c5:	83 ec 04             	sub    $0x4,%esp
+  8024c8:	68 07 04 00 00       	push   $0x407
+  8024cd:	ff 75 f4             	push   -0xc(%ebp)
+  8024d0:	6a 00                	push   $0x0
+  8024d2:	e8 de e8 ff ff       	call   800db5 <sys_page_alloc>
+  8024d7:	83 c4 10             	add    $0x10,%esp
+  8024da:	85 c0                	test   %eax,%eax
+  8024dc:	78 21                	js     8024ff <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8024de:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024e1:	8b 15 5c 40 80 00    	mov    0x80405c,%edx
+  8024e7:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8024e9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024ec:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8024f3:	83 ec 0c             	sub    $0xc,%esp
+  8024f6:	50                   	push   %eax
+  8024f7:	e8 a3 ee ff ff       	call   80139f <fd2num>
+  8024fc:	83 c4 10             	add    $0x10,%esp
+}
+  8024ff:	c9                   	leave
+  802500:	c3                   	ret
+
+00802501 <set_pgfault_handler>:
+// allocate an exception stack (one page of memory with its top
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf)) {
+  802501:	55                   	push   %ebp
+  802502:	89 e5                	mov    %esp,%ebp
+  802504:	83 ec 08             	sub    $0x8,%esp
+  int r;
+
+  if (_pgfault_handler == 0) {
+  802507:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  80250e:	74 0a                	je     80251a <set_pgfault_handler+0x19>
+    if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)))
+      panic(" set_pgfault_handler sys_env_set_pgfault_upcall panic: %e\n", r);
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  802510:	8b 45 08             	mov    0x8(%ebp),%eax
+  802513:	a3 00 80 80 00       	mov    %eax,0x808000
+
+
+}
+  802518:	c9                   	leave
+  802519:	c3                   	ret
+    if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)))
+  80251a:	83 ec 04             	sub    $0x4,%esp
+  80251d:	6a 07                	push   $0x7
+  80251f:	68 00 f0 bf ee       	push   $0xeebff000
+  802524:	6a 00                	push   $0x0
+  802526:	e8 8a e8 ff ff       	call   800db5 <sys_page_alloc>
+  80252b:	83 c4 10             	add    $0x10,%esp
+  80252e:	85 c0                	test   %eax,%eax
+  802530:	75 28                	jne    80255a <set_pgfault_handler+0x59>
+    if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)))
+  802532:	83 ec 08             	sub    $0x8,%esp
+  802535:	68 6c 25 80 00       	push   $0x80256c
+  80253a:	6a 00                	push   $0x0
+  80253c:	e8 bf e9 ff ff       	call   800f00 <sys_env_set_pgfault_upcall>
+  802541:	83 c4 10             	add    $0x10,%esp
+  802544:	85 c0                	test   %eax,%eax
+  802546:	74 c8                	je     802510 <set_pgfault_handler+0xf>
+      panic(" set_pgfault_handler sys_env_set_pgfault_upcall panic: %e\n", r);
+  802548:	50                   	push   %eax
+  802549:	68 ac 32 80 00       	push   $0x8032ac
+  80254e:	6a 22                	push   $0x22
+  802550:	68 e7 32 80 00       	push   $0x8032e7
+  802555:	e8 db dd ff ff       	call   800335 <_panic>
+      panic("set_pgfault_handler sys_page_alloc panic: %e\n", r);
+  80255a:	50                   	push   %eax
+  80255b:	68 7c 32 80 00       	push   $0x80327c
+  802560:	6a 20                	push   $0x20
+  802562:	68 e7 32 80 00       	push   $0x8032e7
+  802567:	e8 c9 dd ff ff       	call   800335 <_panic>
+
+0080256c <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80256c:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80256d:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  802572:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  802574:	83 c4 04             	add    $0x4,%esp
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	// push the trap-time %eip onto the trap-time stack
+    subl $0x4, 0x30(%esp) # for push eip
+  802577:	83 6c 24 30 04       	subl   $0x4,0x30(%esp)
+    movl 0x30(%esp), %ebx #regular esp
+  80257c:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+    movl 0x28(%esp), %eax #eip
+  802580:	8b 44 24 28          	mov    0x28(%esp),%eax
+    movl %eax, (%ebx)
+  802584:	89 03                	mov    %eax,(%ebx)
+
+    // Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+    addl $8, %esp
+  802586:	83 c4 08             	add    $0x8,%esp
+    popal
+  802589:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  80258a:	83 c4 04             	add    $0x4,%esp
+	popfl
+  80258d:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  80258e:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  80258f:	c3                   	ret
+
+00802590 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  802590:	55                   	push   %ebp
+  802591:	89 e5                	mov    %esp,%ebp
+  802593:	56                   	push   %esi
+  802594:	53                   	push   %ebx
+  802595:	8b 75 08             	mov    0x8(%ebp),%esi
+  802598:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80259b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  80259e:	85 c0                	test   %eax,%eax
+  8025a0:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8025a5:	0f 44 c2             	cmove  %edx,%eax
+  8025a8:	83 ec 0c             	sub    $0xc,%esp
+  8025ab:	50                   	push   %eax
+  8025ac:	e8 b4 e9 ff ff       	call   800f65 <sys_ipc_recv>
+
+  if (from_env_store)
+  8025b1:	83 c4 10             	add    $0x10,%esp
+  8025b4:	85 f6                	test   %esi,%esi
+  8025b6:	74 17                	je     8025cf <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  8025b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025bd:	85 c0                	test   %eax,%eax
+  8025bf:	75 0c                	jne    8025cd <ipc_recv+0x3d>
+  8025c1:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  8025c7:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  8025cd:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  8025cf:	85 db                	test   %ebx,%ebx
+  8025d1:	74 2b                	je     8025fe <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  8025d3:	85 c0                	test   %eax,%eax
+  8025d5:	74 0d                	je     8025e4 <ipc_recv+0x54>
+  8025d7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  8025dd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025e0:	5b                   	pop    %ebx
+  8025e1:	5e                   	pop    %esi
+  8025e2:	5d                   	pop    %ebp
+  8025e3:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  8025e4:	a1 08 50 80 00       	mov    0x805008,%eax
+  8025e9:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8025ef:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  8025f1:	a1 08 50 80 00       	mov    0x805008,%eax
+  8025f6:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  8025fc:	eb df                	jmp    8025dd <ipc_recv+0x4d>
+  8025fe:	85 c0                	test   %eax,%eax
+  802600:	75 db                	jne    8025dd <ipc_recv+0x4d>
+  802602:	eb ed                	jmp    8025f1 <ipc_recv+0x61>
+
+00802604 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  802604:	55                   	push   %ebp
+  802605:	89 e5                	mov    %esp,%ebp
+  802607:	57                   	push   %edi
+  802608:	56                   	push   %esi
+  802609:	53                   	push   %ebx
+  80260a:	83 ec 0c             	sub    $0xc,%esp
+  80260d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802610:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802613:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  802616:	85 db                	test   %ebx,%ebx
+  802618:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80261d:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  802620:	ff 75 14             	push   0x14(%ebp)
+  802623:	53                   	push   %ebx
+  802624:	56                   	push   %esi
+  802625:	57                   	push   %edi
+  802626:	e8 17 e9 ff ff       	call   800f42 <sys_ipc_try_send>
+  80262b:	83 c4 10             	add    $0x10,%esp
+  80262e:	85 c0                	test   %eax,%eax
+  802630:	74 1e                	je     802650 <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  802632:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802635:	75 07                	jne    80263e <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  802637:	e8 5a e7 ff ff       	call   800d96 <sys_yield>
+  80263c:	eb e2                	jmp    802620 <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  80263e:	50                   	push   %eax
+  80263f:	68 f5 32 80 00       	push   $0x8032f5
+  802644:	6a 3c                	push   $0x3c
+  802646:	68 02 33 80 00       	push   $0x803302
+  80264b:	e8 e5 dc ff ff       	call   800335 <_panic>
+  }
+
+#endif
+}
+  802650:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802653:	5b                   	pop    %ebx
+  802654:	5e                   	pop    %esi
+  802655:	5f                   	pop    %edi
+  802656:	5d                   	pop    %ebp
+  802657:	c3                   	ret
+
+00802658 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  802658:	55                   	push   %ebp
+  802659:	89 e5                	mov    %esp,%ebp
+  80265b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  80265e:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  802663:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802666:	c1 e0 04             	shl    $0x4,%eax
+  802669:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80266e:	8b 40 50             	mov    0x50(%eax),%eax
+  802671:	39 c8                	cmp    %ecx,%eax
+  802673:	74 12                	je     802687 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  802675:	83 c2 01             	add    $0x1,%edx
+  802678:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  80267e:	75 e3                	jne    802663 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802680:	b8 00 00 00 00       	mov    $0x0,%eax
+  802685:	eb 0e                	jmp    802695 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  802687:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80268a:	c1 e0 04             	shl    $0x4,%eax
+  80268d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802692:	8b 40 48             	mov    0x48(%eax),%eax
+  802695:	5d                   	pop    %ebp
+  802696:	c3                   	ret
+
+00802697 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802697:	55                   	push   %ebp
+  802698:	89 e5                	mov    %esp,%ebp
+  80269a:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80269d:	89 c2                	mov    %eax,%edx
+  80269f:	c1 ea 16             	shr    $0x16,%edx
+  8026a2:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8026a9:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8026ae:	f6 c1 01             	test   $0x1,%cl
+  8026b1:	74 1c                	je     8026cf <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  8026b3:	c1 e8 0c             	shr    $0xc,%eax
+  8026b6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8026bd:	a8 01                	test   $0x1,%al
+  8026bf:	74 0e                	je     8026cf <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8026c1:	c1 e8 0c             	shr    $0xc,%eax
+  8026c4:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  8026cb:	ef 
+  8026cc:	0f b7 d2             	movzwl %dx,%edx
+}
+  8026cf:	89 d0                	mov    %edx,%eax
+  8026d1:	5d                   	pop    %ebp
+  8026d2:	c3                   	ret
+  8026d3:	66 90                	xchg   %ax,%ax
+  8026d5:	66 90                	xchg   %ax,%ax
+  8026d7:	66 90                	xchg   %ax,%ax
+  8026d9:	66 90                	xchg   %ax,%ax
+  8026db:	66 90                	xchg   %ax,%ax
+  8026dd:	66 90                	xchg   %ax,%ax
+  8026df:	90                   	nop
+
+008026e0 <__udivmoddi4>:
+  8026e0:	55                   	push   %ebp
+  8026e1:	57                   	push   %edi
+  8026e2:	56                   	push   %esi
+  8026e3:	53                   	push   %ebx
+  8026e4:	83 ec 24             	sub    $0x24,%esp
+  8026e7:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8026eb:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8026ef:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  8026f3:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8026f7:	8b 54 24 44          	mov    0x44(%esp),%edx
+  8026fb:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8026ff:	8b 44 24 40          	mov    0x40(%esp),%eax
+  802703:	89 d3                	mov    %edx,%ebx
+  802705:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802709:	09 c3                	or     %eax,%ebx
+  80270b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80270f:	0f 84 9c 00 00 00    	je     8027b1 <__udivmoddi4+0xd1>
+  802715:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80271c:	00 
+  80271d:	31 c0                	xor    %eax,%eax
+  80271f:	31 d2                	xor    %edx,%edx
+  802721:	89 fb                	mov    %edi,%ebx
+  802723:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80272a:	00 
+  80272b:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802730:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802734:	01 c0                	add    %eax,%eax
+  802736:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80273d:	00 
+  80273e:	89 c6                	mov    %eax,%esi
+  802740:	89 d7                	mov    %edx,%edi
+  802742:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802746:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80274a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80274d:	d3 ea                	shr    %cl,%edx
+  80274f:	f6 c1 20             	test   $0x20,%cl
+  802752:	0f 45 c2             	cmovne %edx,%eax
+  802755:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802759:	83 e0 01             	and    $0x1,%eax
+  80275c:	09 fa                	or     %edi,%edx
+  80275e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802762:	89 04 24             	mov    %eax,(%esp)
+  802765:	8b 04 24             	mov    (%esp),%eax
+  802768:	89 d5                	mov    %edx,%ebp
+  80276a:	09 f0                	or     %esi,%eax
+  80276c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802770:	39 f0                	cmp    %esi,%eax
+  802772:	19 fd                	sbb    %edi,%ebp
+  802774:	72 1d                	jb     802793 <__udivmoddi4+0xb3>
+  802776:	29 f0                	sub    %esi,%eax
+  802778:	19 fa                	sbb    %edi,%edx
+  80277a:	89 cf                	mov    %ecx,%edi
+  80277c:	c1 ef 05             	shr    $0x5,%edi
+  80277f:	83 e7 01             	and    $0x1,%edi
+  802782:	89 fe                	mov    %edi,%esi
+  802784:	d3 e7                	shl    %cl,%edi
+  802786:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80278a:	83 f6 01             	xor    $0x1,%esi
+  80278d:	d3 e6                	shl    %cl,%esi
+  80278f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802793:	83 e9 01             	sub    $0x1,%ecx
+  802796:	73 98                	jae    802730 <__udivmoddi4+0x50>
+  802798:	85 db                	test   %ebx,%ebx
+  80279a:	74 05                	je     8027a1 <__udivmoddi4+0xc1>
+  80279c:	89 03                	mov    %eax,(%ebx)
+  80279e:	89 53 04             	mov    %edx,0x4(%ebx)
+  8027a1:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8027a5:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8027a9:	83 c4 24             	add    $0x24,%esp
+  8027ac:	5b                   	pop    %ebx
+  8027ad:	5e                   	pop    %esi
+  8027ae:	5f                   	pop    %edi
+  8027af:	5d                   	pop    %ebp
+  8027b0:	c3                   	ret
+  8027b1:	85 ff                	test   %edi,%edi
+  8027b3:	74 0d                	je     8027c2 <__udivmoddi4+0xe2>
+  8027b5:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  8027bb:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  8027c2:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8027c6:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8027ca:	89 44 24 18          	mov    %eax,0x18(%esp)
+  8027ce:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8027d2:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  8027d6:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8027da:	83 c4 24             	add    $0x24,%esp
+  8027dd:	5b                   	pop    %ebx
+  8027de:	5e                   	pop    %esi
+  8027df:	5f                   	pop    %edi
+  8027e0:	5d                   	pop    %ebp
+  8027e1:	c3                   	ret
+  8027e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8027e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+008027f0 <__udivdi3>:
+  8027f0:	57                   	push   %edi
+  8027f1:	56                   	push   %esi
+  8027f2:	53                   	push   %ebx
+  8027f3:	83 ec 20             	sub    $0x20,%esp
+  8027f6:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8027fa:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8027fe:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802802:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802806:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80280a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80280e:	89 d1                	mov    %edx,%ecx
+  802810:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802814:	09 c1                	or     %eax,%ecx
+  802816:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80281a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80281e:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802822:	0f 84 88 00 00 00    	je     8028b0 <__udivdi3+0xc0>
+  802828:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80282f:	00 
+  802830:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802835:	31 c0                	xor    %eax,%eax
+  802837:	31 d2                	xor    %edx,%edx
+  802839:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802840:	00 
+  802841:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802848:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80284c:	01 c0                	add    %eax,%eax
+  80284e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802855:	00 
+  802856:	89 c6                	mov    %eax,%esi
+  802858:	89 d7                	mov    %edx,%edi
+  80285a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80285e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802862:	0f ad d0             	shrd   %cl,%edx,%eax
+  802865:	d3 ea                	shr    %cl,%edx
+  802867:	f6 c1 20             	test   $0x20,%cl
+  80286a:	0f 45 c2             	cmovne %edx,%eax
+  80286d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802871:	83 e0 01             	and    $0x1,%eax
+  802874:	09 fa                	or     %edi,%edx
+  802876:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80287a:	89 04 24             	mov    %eax,(%esp)
+  80287d:	8b 04 24             	mov    (%esp),%eax
+  802880:	89 d3                	mov    %edx,%ebx
+  802882:	09 f0                	or     %esi,%eax
+  802884:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802888:	39 f0                	cmp    %esi,%eax
+  80288a:	19 fb                	sbb    %edi,%ebx
+  80288c:	72 1d                	jb     8028ab <__udivdi3+0xbb>
+  80288e:	29 f0                	sub    %esi,%eax
+  802890:	19 fa                	sbb    %edi,%edx
+  802892:	89 cf                	mov    %ecx,%edi
+  802894:	c1 ef 05             	shr    $0x5,%edi
+  802897:	83 e7 01             	and    $0x1,%edi
+  80289a:	89 fe                	mov    %edi,%esi
+  80289c:	d3 e7                	shl    %cl,%edi
+  80289e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8028a2:	83 f6 01             	xor    $0x1,%esi
+  8028a5:	d3 e6                	shl    %cl,%esi
+  8028a7:	09 74 24 18          	or     %esi,0x18(%esp)
+  8028ab:	83 e9 01             	sub    $0x1,%ecx
+  8028ae:	73 98                	jae    802848 <__udivdi3+0x58>
+  8028b0:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8028b4:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8028b8:	83 c4 20             	add    $0x20,%esp
+  8028bb:	5b                   	pop    %ebx
+  8028bc:	5e                   	pop    %esi
+  8028bd:	5f                   	pop    %edi
+  8028be:	c3                   	ret
+  8028bf:	90                   	nop
+
+008028c0 <__umoddi3>:
+  8028c0:	57                   	push   %edi
+  8028c1:	56                   	push   %esi
+  8028c2:	53                   	push   %ebx
+  8028c3:	83 ec 18             	sub    $0x18,%esp
+  8028c6:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8028ca:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8028ce:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8028d2:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8028d6:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8028da:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8028de:	89 d1                	mov    %edx,%ecx
+  8028e0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8028e4:	09 c1                	or     %eax,%ecx
+  8028e6:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8028ea:	74 5b                	je     802947 <__umoddi3+0x87>
+  8028ec:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8028f1:	31 c0                	xor    %eax,%eax
+  8028f3:	31 d2                	xor    %edx,%edx
+  8028f5:	8d 76 00             	lea    0x0(%esi),%esi
+  8028f8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8028fc:	01 c0                	add    %eax,%eax
+  8028fe:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802905:	00 
+  802906:	89 c6                	mov    %eax,%esi
+  802908:	89 d7                	mov    %edx,%edi
+  80290a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80290e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802912:	0f ad d0             	shrd   %cl,%edx,%eax
+  802915:	d3 ea                	shr    %cl,%edx
+  802917:	f6 c1 20             	test   $0x20,%cl
+  80291a:	0f 45 c2             	cmovne %edx,%eax
+  80291d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802921:	83 e0 01             	and    $0x1,%eax
+  802924:	09 fa                	or     %edi,%edx
+  802926:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80292a:	89 04 24             	mov    %eax,(%esp)
+  80292d:	8b 04 24             	mov    (%esp),%eax
+  802930:	89 d3                	mov    %edx,%ebx
+  802932:	09 f0                	or     %esi,%eax
+  802934:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802938:	39 f0                	cmp    %esi,%eax
+  80293a:	19 fb                	sbb    %edi,%ebx
+  80293c:	72 04                	jb     802942 <__umoddi3+0x82>
+  80293e:	29 f0                	sub    %esi,%eax
+  802940:	19 fa                	sbb    %edi,%edx
+  802942:	83 e9 01             	sub    $0x1,%ecx
+  802945:	73 b1                	jae    8028f8 <__umoddi3+0x38>
+  802947:	83 c4 18             	add    $0x18,%esp
+  80294a:	5b                   	pop    %ebx
+  80294b:	5e                   	pop    %esi
+  80294c:	5f                   	pop    %edi
+  80294d:	c3                   	ret
+  80294e:	66 90                	xchg   %ax,%ax
+
+00802950 <__divdi3>:
+  802950:	55                   	push   %ebp
+  802951:	57                   	push   %edi
+  802952:	56                   	push   %esi
+  802953:	53                   	push   %ebx
+  802954:	83 ec 24             	sub    $0x24,%esp
+  802957:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  80295b:	8b 74 24 44          	mov    0x44(%esp),%esi
+  80295f:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802963:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802967:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  80296b:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  80296f:	85 d2                	test   %edx,%edx
+  802971:	0f 88 e0 00 00 00    	js     802a57 <__divdi3+0x107>
+  802977:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  80297b:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  80297f:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802983:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802987:	85 f6                	test   %esi,%esi
+  802989:	78 16                	js     8029a1 <__divdi3+0x51>
+  80298b:	89 f1                	mov    %esi,%ecx
+  80298d:	31 c0                	xor    %eax,%eax
+  80298f:	31 d2                	xor    %edx,%edx
+  802991:	09 d9                	or     %ebx,%ecx
+  802993:	0f 85 f3 00 00 00    	jne    802a8c <__divdi3+0x13c>
+  802999:	83 c4 24             	add    $0x24,%esp
+  80299c:	5b                   	pop    %ebx
+  80299d:	5e                   	pop    %esi
+  80299e:	5f                   	pop    %edi
+  80299f:	5d                   	pop    %ebp
+  8029a0:	c3                   	ret
+  8029a1:	bf 01 00 00 00       	mov    $0x1,%edi
+  8029a6:	f7 5c 24 08          	negl   0x8(%esp)
+  8029aa:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  8029af:	f7 5c 24 0c          	negl   0xc(%esp)
+  8029b3:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8029ba:	00 
+  8029bb:	31 c0                	xor    %eax,%eax
+  8029bd:	31 d2                	xor    %edx,%edx
+  8029bf:	89 fb                	mov    %edi,%ebx
+  8029c1:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8029c8:	00 
+  8029c9:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8029ce:	66 90                	xchg   %ax,%ax
+  8029d0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8029d4:	01 c0                	add    %eax,%eax
+  8029d6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8029dd:	00 
+  8029de:	89 c6                	mov    %eax,%esi
+  8029e0:	89 d7                	mov    %edx,%edi
+  8029e2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8029e6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8029ea:	0f ad d0             	shrd   %cl,%edx,%eax
+  8029ed:	d3 ea                	shr    %cl,%edx
+  8029ef:	f6 c1 20             	test   $0x20,%cl
+  8029f2:	0f 45 c2             	cmovne %edx,%eax
+  8029f5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8029f9:	83 e0 01             	and    $0x1,%eax
+  8029fc:	09 fa                	or     %edi,%edx
+  8029fe:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802a02:	89 04 24             	mov    %eax,(%esp)
+  802a05:	8b 04 24             	mov    (%esp),%eax
+  802a08:	89 d5                	mov    %edx,%ebp
+  802a0a:	09 f0                	or     %esi,%eax
+  802a0c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802a10:	39 f0                	cmp    %esi,%eax
+  802a12:	19 fd                	sbb    %edi,%ebp
+  802a14:	72 1d                	jb     802a33 <__divdi3+0xe3>
+  802a16:	29 f0                	sub    %esi,%eax
+  802a18:	19 fa                	sbb    %edi,%edx
+  802a1a:	89 cf                	mov    %ecx,%edi
+  802a1c:	c1 ef 05             	shr    $0x5,%edi
+  802a1f:	83 e7 01             	and    $0x1,%edi
+  802a22:	89 fe                	mov    %edi,%esi
+  802a24:	d3 e7                	shl    %cl,%edi
+  802a26:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802a2a:	83 f6 01             	xor    $0x1,%esi
+  802a2d:	d3 e6                	shl    %cl,%esi
+  802a2f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802a33:	83 e9 01             	sub    $0x1,%ecx
+  802a36:	73 98                	jae    8029d0 <__divdi3+0x80>
+  802a38:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802a3c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802a40:	85 db                	test   %ebx,%ebx
+  802a42:	0f 84 51 ff ff ff    	je     802999 <__divdi3+0x49>
+  802a48:	f7 d8                	neg    %eax
+  802a4a:	83 d2 00             	adc    $0x0,%edx
+  802a4d:	83 c4 24             	add    $0x24,%esp
+  802a50:	5b                   	pop    %ebx
+  802a51:	f7 da                	neg    %edx
+  802a53:	5e                   	pop    %esi
+  802a54:	5f                   	pop    %edi
+  802a55:	5d                   	pop    %ebp
+  802a56:	c3                   	ret
+  802a57:	f7 d8                	neg    %eax
+  802a59:	83 d2 00             	adc    $0x0,%edx
+  802a5c:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802a60:	f7 da                	neg    %edx
+  802a62:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802a66:	85 f6                	test   %esi,%esi
+  802a68:	78 1b                	js     802a85 <__divdi3+0x135>
+  802a6a:	89 f1                	mov    %esi,%ecx
+  802a6c:	31 c0                	xor    %eax,%eax
+  802a6e:	31 d2                	xor    %edx,%edx
+  802a70:	bf 01 00 00 00       	mov    $0x1,%edi
+  802a75:	09 d9                	or     %ebx,%ecx
+  802a77:	0f 85 36 ff ff ff    	jne    8029b3 <__divdi3+0x63>
+  802a7d:	83 c4 24             	add    $0x24,%esp
+  802a80:	5b                   	pop    %ebx
+  802a81:	5e                   	pop    %esi
+  802a82:	5f                   	pop    %edi
+  802a83:	5d                   	pop    %ebp
+  802a84:	c3                   	ret
+  802a85:	31 ff                	xor    %edi,%edi
+  802a87:	e9 1a ff ff ff       	jmp    8029a6 <__divdi3+0x56>
+  802a8c:	31 ff                	xor    %edi,%edi
+  802a8e:	e9 20 ff ff ff       	jmp    8029b3 <__divdi3+0x63>
+  802a93:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802a9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00802aa0 <__moddi3>:
+  802aa0:	55                   	push   %ebp
+  802aa1:	57                   	push   %edi
+  802aa2:	56                   	push   %esi
+  802aa3:	53                   	push   %ebx
+  802aa4:	83 ec 1c             	sub    $0x1c,%esp
+  802aa7:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  802aab:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  802aaf:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  802ab3:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  802ab7:	89 c8                	mov    %ecx,%eax
+  802ab9:	89 f2                	mov    %esi,%edx
+  802abb:	89 f3                	mov    %esi,%ebx
+  802abd:	85 ed                	test   %ebp,%ebp
+  802abf:	0f 88 9d 00 00 00    	js     802b62 <__moddi3+0xc2>
+  802ac5:	09 cb                	or     %ecx,%ebx
+  802ac7:	0f 84 8d 00 00 00    	je     802b5a <__moddi3+0xba>
+  802acd:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802ad1:	31 db                	xor    %ebx,%ebx
+  802ad3:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802ad7:	89 ca                	mov    %ecx,%edx
+  802ad9:	89 f0                	mov    %esi,%eax
+  802adb:	89 dd                	mov    %ebx,%ebp
+  802add:	f7 da                	neg    %edx
+  802adf:	83 d0 00             	adc    $0x0,%eax
+  802ae2:	f7 d8                	neg    %eax
+  802ae4:	0f 49 f0             	cmovns %eax,%esi
+  802ae7:	0f 49 ca             	cmovns %edx,%ecx
+  802aea:	31 c0                	xor    %eax,%eax
+  802aec:	31 d2                	xor    %edx,%edx
+  802aee:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802af2:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802af6:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802afb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  802aff:	90                   	nop
+  802b00:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802b04:	01 c0                	add    %eax,%eax
+  802b06:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802b0d:	00 
+  802b0e:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  802b12:	89 c6                	mov    %eax,%esi
+  802b14:	89 d7                	mov    %edx,%edi
+  802b16:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802b1a:	8b 54 24 14          	mov    0x14(%esp),%edx
+  802b1e:	0f ad d0             	shrd   %cl,%edx,%eax
+  802b21:	d3 ea                	shr    %cl,%edx
+  802b23:	f6 c1 20             	test   $0x20,%cl
+  802b26:	0f 45 c2             	cmovne %edx,%eax
+  802b29:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802b2d:	83 e0 01             	and    $0x1,%eax
+  802b30:	09 fa                	or     %edi,%edx
+  802b32:	89 04 24             	mov    %eax,(%esp)
+  802b35:	8b 04 24             	mov    (%esp),%eax
+  802b38:	89 d7                	mov    %edx,%edi
+  802b3a:	09 f0                	or     %esi,%eax
+  802b3c:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  802b40:	39 d8                	cmp    %ebx,%eax
+  802b42:	19 f7                	sbb    %esi,%edi
+  802b44:	72 04                	jb     802b4a <__moddi3+0xaa>
+  802b46:	29 d8                	sub    %ebx,%eax
+  802b48:	19 f2                	sbb    %esi,%edx
+  802b4a:	83 e9 01             	sub    $0x1,%ecx
+  802b4d:	73 b1                	jae    802b00 <__moddi3+0x60>
+  802b4f:	85 ed                	test   %ebp,%ebp
+  802b51:	74 07                	je     802b5a <__moddi3+0xba>
+  802b53:	f7 d8                	neg    %eax
+  802b55:	83 d2 00             	adc    $0x0,%edx
+  802b58:	f7 da                	neg    %edx
+  802b5a:	83 c4 1c             	add    $0x1c,%esp
+  802b5d:	5b                   	pop    %ebx
+  802b5e:	5e                   	pop    %esi
+  802b5f:	5f                   	pop    %edi
+  802b60:	5d                   	pop    %ebp
+  802b61:	c3                   	ret
+  802b62:	09 cb                	or     %ecx,%ebx
+  802b64:	74 f4                	je     802b5a <__moddi3+0xba>
+  802b66:	f7 df                	neg    %edi
+  802b68:	bb 01 00 00 00       	mov    $0x1,%ebx
+  802b6d:	83 d5 00             	adc    $0x0,%ebp
+  802b70:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802b74:	f7 dd                	neg    %ebp
+  802b76:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802b7a:	e9 58 ff ff ff       	jmp    802ad7 <__moddi3+0x37>
@@ -0,0 +1,5880 @@
+
+obj/user/testpiperace.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 bd 01 00 00       	call   8001ee <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	83 ec 1c             	sub    $0x1c,%esp
+	int p[2], r, pid, i, max;
+	void *va;
+	struct Fd *fd;
+	const volatile struct Env *kid;
+
+	cprintf("testing for dup race...\n");
+  80003b:	68 40 2a 80 00       	push   $0x802a40
+  800040:	e8 e7 02 00 00       	call   80032c <cprintf>
+	if ((r = pipe(p)) < 0)
+  800045:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800048:	89 04 24             	mov    %eax,(%esp)
+  80004b:	e8 ce 21 00 00       	call   80221e <pipe>
+  800050:	83 c4 10             	add    $0x10,%esp
+  800053:	85 c0                	test   %eax,%eax
+  800055:	78 59                	js     8000b0 <umain+0x7d>
+		panic("pipe: %e", r);
+	max = 200;
+	if ((r = fork()) < 0)
+  800057:	e8 43 10 00 00       	call   80109f <fork>
+  80005c:	89 c6                	mov    %eax,%esi
+  80005e:	85 c0                	test   %eax,%eax
+  800060:	78 60                	js     8000c2 <umain+0x8f>
+		panic("fork: %e", r);
+	if (r == 0) {
+  800062:	74 70                	je     8000d4 <umain+0xa1>
+		}
+		// do something to be not runnable besides exiting
+		ipc_recv(0,0,0);
+	}
+	pid = r;
+	cprintf("pid is %d\n", pid);
+  800064:	83 ec 08             	sub    $0x8,%esp
+  800067:	56                   	push   %esi
+  800068:	68 9a 2a 80 00       	push   $0x802a9a
+  80006d:	e8 ba 02 00 00       	call   80032c <cprintf>
+	va = 0;
+	kid = &envs[ENVX(pid)];
+  800072:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	cprintf("kid is %d\n", kid-envs);
+  800078:	83 c4 08             	add    $0x8,%esp
+  80007b:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  80007e:	69 c0 39 8e e3 38    	imul   $0x38e38e39,%eax,%eax
+  800084:	50                   	push   %eax
+  800085:	68 a5 2a 80 00       	push   $0x802aa5
+  80008a:	e8 9d 02 00 00       	call   80032c <cprintf>
+	dup(p[0], 10);
+  80008f:	83 c4 08             	add    $0x8,%esp
+  800092:	6a 0a                	push   $0xa
+  800094:	ff 75 f0             	push   -0x10(%ebp)
+  800097:	e8 1f 15 00 00       	call   8015bb <dup>
+	while (kid->env_status == ENV_RUNNABLE)
+  80009c:	83 c4 10             	add    $0x10,%esp
+  80009f:	8d 1c f6             	lea    (%esi,%esi,8),%ebx
+  8000a2:	c1 e3 04             	shl    $0x4,%ebx
+  8000a5:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  8000ab:	e9 92 00 00 00       	jmp    800142 <umain+0x10f>
+		panic("pipe: %e", r);
+  8000b0:	50                   	push   %eax
+  8000b1:	68 59 2a 80 00       	push   $0x802a59
+  8000b6:	6a 0d                	push   $0xd
+  8000b8:	68 62 2a 80 00       	push   $0x802a62
+  8000bd:	e8 8f 01 00 00       	call   800251 <_panic>
+		panic("fork: %e", r);
+  8000c2:	50                   	push   %eax
+  8000c3:	68 76 2a 80 00       	push   $0x802a76
+  8000c8:	6a 10                	push   $0x10
+  8000ca:	68 62 2a 80 00       	push   $0x802a62
+  8000cf:	e8 7d 01 00 00       	call   800251 <_panic>
+		close(p[1]);
+  8000d4:	83 ec 0c             	sub    $0xc,%esp
+  8000d7:	ff 75 f4             	push   -0xc(%ebp)
+  8000da:	e8 8a 14 00 00       	call   801569 <close>
+		for (i=0; i<max; i++) {
+  8000df:	83 c4 10             	add    $0x10,%esp
+  8000e2:	bb c9 00 00 00       	mov    $0xc9,%ebx
+  8000e7:	eb 05                	jmp    8000ee <umain+0xbb>
+			sys_yield();
+  8000e9:	e8 c4 0b 00 00       	call   800cb2 <sys_yield>
+		for (i=0; i<max; i++) {
+  8000ee:	83 eb 01             	sub    $0x1,%ebx
+  8000f1:	74 29                	je     80011c <umain+0xe9>
+			if(pipeisclosed(p[0])){
+  8000f3:	83 ec 0c             	sub    $0xc,%esp
+  8000f6:	ff 75 f0             	push   -0x10(%ebp)
+  8000f9:	e8 6a 22 00 00       	call   802368 <pipeisclosed>
+  8000fe:	83 c4 10             	add    $0x10,%esp
+  800101:	85 c0                	test   %eax,%eax
+  800103:	74 e4                	je     8000e9 <umain+0xb6>
+				cprintf("RACE: pipe appears closed\n");
+  800105:	83 ec 0c             	sub    $0xc,%esp
+  800108:	68 7f 2a 80 00       	push   $0x802a7f
+  80010d:	e8 1a 02 00 00       	call   80032c <cprintf>
+				exit();
+  800112:	e8 20 01 00 00       	call   800237 <exit>
+  800117:	83 c4 10             	add    $0x10,%esp
+  80011a:	eb cd                	jmp    8000e9 <umain+0xb6>
+		ipc_recv(0,0,0);
+  80011c:	83 ec 04             	sub    $0x4,%esp
+  80011f:	6a 00                	push   $0x0
+  800121:	6a 00                	push   $0x0
+  800123:	6a 00                	push   $0x0
+  800125:	e8 91 11 00 00       	call   8012bb <ipc_recv>
+  80012a:	83 c4 10             	add    $0x10,%esp
+  80012d:	e9 32 ff ff ff       	jmp    800064 <umain+0x31>
+		dup(p[0], 10);
+  800132:	83 ec 08             	sub    $0x8,%esp
+  800135:	6a 0a                	push   $0xa
+  800137:	ff 75 f0             	push   -0x10(%ebp)
+  80013a:	e8 7c 14 00 00       	call   8015bb <dup>
+  80013f:	83 c4 10             	add    $0x10,%esp
+	while (kid->env_status == ENV_RUNNABLE)
+  800142:	8b 43 54             	mov    0x54(%ebx),%eax
+  800145:	83 f8 02             	cmp    $0x2,%eax
+  800148:	74 e8                	je     800132 <umain+0xff>
+
+	cprintf("child done with loop\n");
+  80014a:	83 ec 0c             	sub    $0xc,%esp
+  80014d:	68 b0 2a 80 00       	push   $0x802ab0
+  800152:	e8 d5 01 00 00       	call   80032c <cprintf>
+	if (pipeisclosed(p[0]))
+  800157:	83 c4 04             	add    $0x4,%esp
+  80015a:	ff 75 f0             	push   -0x10(%ebp)
+  80015d:	e8 06 22 00 00       	call   802368 <pipeisclosed>
+  800162:	83 c4 10             	add    $0x10,%esp
+  800165:	85 c0                	test   %eax,%eax
+  800167:	75 48                	jne    8001b1 <umain+0x17e>
+		panic("somehow the other end of p[0] got closed!");
+	if ((r = fd_lookup(p[0], &fd)) < 0)
+  800169:	83 ec 08             	sub    $0x8,%esp
+  80016c:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80016f:	50                   	push   %eax
+  800170:	ff 75 f0             	push   -0x10(%ebp)
+  800173:	e8 c7 12 00 00       	call   80143f <fd_lookup>
+  800178:	83 c4 10             	add    $0x10,%esp
+  80017b:	85 c0                	test   %eax,%eax
+  80017d:	78 46                	js     8001c5 <umain+0x192>
+		panic("cannot look up p[0]: %e", r);
+	va = fd2data(fd);
+  80017f:	83 ec 0c             	sub    $0xc,%esp
+  800182:	ff 75 ec             	push   -0x14(%ebp)
+  800185:	e8 48 12 00 00       	call   8013d2 <fd2data>
+	if (pageref(va) != 3+1)
+  80018a:	89 04 24             	mov    %eax,(%esp)
+  80018d:	e8 1b 1a 00 00       	call   801bad <pageref>
+  800192:	83 c4 10             	add    $0x10,%esp
+  800195:	83 f8 04             	cmp    $0x4,%eax
+  800198:	74 3d                	je     8001d7 <umain+0x1a4>
+		cprintf("\nchild detected race\n");
+  80019a:	83 ec 0c             	sub    $0xc,%esp
+  80019d:	68 de 2a 80 00       	push   $0x802ade
+  8001a2:	e8 85 01 00 00       	call   80032c <cprintf>
+  8001a7:	83 c4 10             	add    $0x10,%esp
+	else
+		cprintf("\nrace didn't happen\n", max);
+}
+  8001aa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8001ad:	5b                   	pop    %ebx
+  8001ae:	5e                   	pop    %esi
+  8001af:	5d                   	pop    %ebp
+  8001b0:	c3                   	ret
+		panic("somehow the other end of p[0] got closed!");
+  8001b1:	83 ec 04             	sub    $0x4,%esp
+  8001b4:	68 0c 2b 80 00       	push   $0x802b0c
+  8001b9:	6a 3a                	push   $0x3a
+  8001bb:	68 62 2a 80 00       	push   $0x802a62
+  8001c0:	e8 8c 00 00 00       	call   800251 <_panic>
+		panic("cannot look up p[0]: %e", r);
+  8001c5:	50                   	push   %eax
+  8001c6:	68 c6 2a 80 00       	push   $0x802ac6
+  8001cb:	6a 3c                	push   $0x3c
+  8001cd:	68 62 2a 80 00       	push   $0x802a62
+  8001d2:	e8 7a 00 00 00       	call   800251 <_panic>
+		cprintf("\nrace didn't happen\n", max);
+  8001d7:	83 ec 08             	sub    $0x8,%esp
+  8001da:	68 c8 00 00 00       	push   $0xc8
+  8001df:	68 f4 2a 80 00       	push   $0x802af4
+  8001e4:	e8 43 01 00 00       	call   80032c <cprintf>
+  8001e9:	83 c4 10             	add    $0x10,%esp
+}
+  8001ec:	eb bc                	jmp    8001aa <umain+0x177>
+
+008001ee <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  8001ee:	55                   	push   %ebp
+  8001ef:	89 e5                	mov    %esp,%ebp
+  8001f1:	56                   	push   %esi
+  8001f2:	53                   	push   %ebx
+  8001f3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001f6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  8001f9:	e8 95 0a 00 00       	call   800c93 <sys_getenvid>
+  8001fe:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800203:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800206:	c1 e0 04             	shl    $0x4,%eax
+  800209:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80020e:	a3 08 50 80 00       	mov    %eax,0x805008
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800213:	85 db                	test   %ebx,%ebx
+  800215:	7e 07                	jle    80021e <libmain+0x30>
+    binaryname = argv[0];
+  800217:	8b 06                	mov    (%esi),%eax
+  800219:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  80021e:	83 ec 08             	sub    $0x8,%esp
+  800221:	56                   	push   %esi
+  800222:	53                   	push   %ebx
+  800223:	e8 0b fe ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  800228:	e8 0a 00 00 00       	call   800237 <exit>
+}
+  80022d:	83 c4 10             	add    $0x10,%esp
+  800230:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800233:	5b                   	pop    %ebx
+  800234:	5e                   	pop    %esi
+  800235:	5d                   	pop    %ebp
+  800236:	c3                   	ret
+
+00800237 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800237:	55                   	push   %ebp
+  800238:	89 e5                	mov    %esp,%ebp
+  80023a:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80023d:	e8 54 13 00 00       	call   801596 <close_all>
+	sys_env_destroy(0);
+  800242:	83 ec 0c             	sub    $0xc,%esp
+  800245:	6a 00                	push   $0x0
+  800247:	e8 06 0a 00 00       	call   800c52 <sys_env_destroy>
+}
+  80024c:	83 c4 10             	add    $0x10,%esp
+  80024f:	c9                   	leave
+  800250:	c3                   	ret
+
+00800251 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800251:	55                   	push   %ebp
+  800252:	89 e5                	mov    %esp,%ebp
+  800254:	56                   	push   %esi
+  800255:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800256:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800259:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  80025f:	e8 2f 0a 00 00       	call   800c93 <sys_getenvid>
+  800264:	83 ec 0c             	sub    $0xc,%esp
+  800267:	ff 75 0c             	push   0xc(%ebp)
+  80026a:	ff 75 08             	push   0x8(%ebp)
+  80026d:	56                   	push   %esi
+  80026e:	50                   	push   %eax
+  80026f:	68 40 2b 80 00       	push   $0x802b40
+  800274:	e8 b3 00 00 00       	call   80032c <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800279:	83 c4 18             	add    $0x18,%esp
+  80027c:	53                   	push   %ebx
+  80027d:	ff 75 10             	push   0x10(%ebp)
+  800280:	e8 56 00 00 00       	call   8002db <vcprintf>
+	cprintf("\n");
+  800285:	c7 04 24 57 2a 80 00 	movl   $0x802a57,(%esp)
+  80028c:	e8 9b 00 00 00       	call   80032c <cprintf>
+  800291:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800294:	cc                   	int3
+	while (1)
+  800295:	eb fd                	jmp    800294 <_panic+0x43>
+
+00800297 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800297:	55                   	push   %ebp
+  800298:	89 e5                	mov    %esp,%ebp
+  80029a:	53                   	push   %ebx
+  80029b:	83 ec 04             	sub    $0x4,%esp
+  80029e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8002a1:	8b 13                	mov    (%ebx),%edx
+  8002a3:	8d 42 01             	lea    0x1(%edx),%eax
+  8002a6:	89 03                	mov    %eax,(%ebx)
+  8002a8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8002ab:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8002af:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8002b4:	74 09                	je     8002bf <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8002b6:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8002ba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8002bd:	c9                   	leave
+  8002be:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8002bf:	83 ec 08             	sub    $0x8,%esp
+  8002c2:	68 ff 00 00 00       	push   $0xff
+  8002c7:	8d 43 08             	lea    0x8(%ebx),%eax
+  8002ca:	50                   	push   %eax
+  8002cb:	e8 45 09 00 00       	call   800c15 <sys_cputs>
+		b->idx = 0;
+  8002d0:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8002d6:	83 c4 10             	add    $0x10,%esp
+  8002d9:	eb db                	jmp    8002b6 <putch+0x1f>
+
+008002db <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8002db:	55                   	push   %ebp
+  8002dc:	89 e5                	mov    %esp,%ebp
+  8002de:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8002e4:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8002eb:	00 00 00 
+	b.cnt = 0;
+  8002ee:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8002f5:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8002f8:	ff 75 0c             	push   0xc(%ebp)
+  8002fb:	ff 75 08             	push   0x8(%ebp)
+  8002fe:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800304:	50                   	push   %eax
+  800305:	68 97 02 80 00       	push   $0x800297
+  80030a:	e8 14 01 00 00       	call   800423 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80030f:	83 c4 08             	add    $0x8,%esp
+  800312:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800318:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80031e:	50                   	push   %eax
+  80031f:	e8 f1 08 00 00       	call   800c15 <sys_cputs>
+
+	return b.cnt;
+}
+  800324:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80032a:	c9                   	leave
+  80032b:	c3                   	ret
+
+0080032c <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80032c:	55                   	push   %ebp
+  80032d:	89 e5                	mov    %esp,%ebp
+  80032f:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800332:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800335:	50                   	push   %eax
+  800336:	ff 75 08             	push   0x8(%ebp)
+  800339:	e8 9d ff ff ff       	call   8002db <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80033e:	c9                   	leave
+  80033f:	c3                   	ret
+
+00800340 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800340:	55                   	push   %ebp
+  800341:	89 e5                	mov    %esp,%ebp
+  800343:	57                   	push   %edi
+  800344:	56                   	push   %esi
+  800345:	53                   	push   %ebx
+  800346:	83 ec 1c             	sub    $0x1c,%esp
+  800349:	89 c7                	mov    %eax,%edi
+  80034b:	89 d6                	mov    %edx,%esi
+  80034d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800350:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800353:	89 d1                	mov    %edx,%ecx
+  800355:	89 c2                	mov    %eax,%edx
+  800357:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80035a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80035d:	8b 45 10             	mov    0x10(%ebp),%eax
+  800360:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800363:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800366:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80036d:	39 c2                	cmp    %eax,%edx
+  80036f:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800372:	72 3e                	jb     8003b2 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800374:	83 ec 0c             	sub    $0xc,%esp
+  800377:	ff 75 18             	push   0x18(%ebp)
+  80037a:	83 eb 01             	sub    $0x1,%ebx
+  80037d:	53                   	push   %ebx
+  80037e:	50                   	push   %eax
+  80037f:	83 ec 08             	sub    $0x8,%esp
+  800382:	ff 75 e4             	push   -0x1c(%ebp)
+  800385:	ff 75 e0             	push   -0x20(%ebp)
+  800388:	ff 75 dc             	push   -0x24(%ebp)
+  80038b:	ff 75 d8             	push   -0x28(%ebp)
+  80038e:	e8 1d 23 00 00       	call   8026b0 <__udivdi3>
+  800393:	83 c4 18             	add    $0x18,%esp
+  800396:	52                   	push   %edx
+  800397:	50                   	push   %eax
+  800398:	89 f2                	mov    %esi,%edx
+  80039a:	89 f8                	mov    %edi,%eax
+  80039c:	e8 9f ff ff ff       	call   800340 <printnum>
+  8003a1:	83 c4 20             	add    $0x20,%esp
+  8003a4:	eb 13                	jmp    8003b9 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8003a6:	83 ec 08             	sub    $0x8,%esp
+  8003a9:	56                   	push   %esi
+  8003aa:	ff 75 18             	push   0x18(%ebp)
+  8003ad:	ff d7                	call   *%edi
+  8003af:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8003b2:	83 eb 01             	sub    $0x1,%ebx
+  8003b5:	85 db                	test   %ebx,%ebx
+  8003b7:	7f ed                	jg     8003a6 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8003b9:	83 ec 08             	sub    $0x8,%esp
+  8003bc:	56                   	push   %esi
+  8003bd:	83 ec 04             	sub    $0x4,%esp
+  8003c0:	ff 75 e4             	push   -0x1c(%ebp)
+  8003c3:	ff 75 e0             	push   -0x20(%ebp)
+  8003c6:	ff 75 dc             	push   -0x24(%ebp)
+  8003c9:	ff 75 d8             	push   -0x28(%ebp)
+  8003cc:	e8 af 23 00 00       	call   802780 <__umoddi3>
+  8003d1:	83 c4 14             	add    $0x14,%esp
+  8003d4:	0f be 80 63 2b 80 00 	movsbl 0x802b63(%eax),%eax
+  8003db:	50                   	push   %eax
+  8003dc:	ff d7                	call   *%edi
+}
+  8003de:	83 c4 10             	add    $0x10,%esp
+  8003e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003e4:	5b                   	pop    %ebx
+  8003e5:	5e                   	pop    %esi
+  8003e6:	5f                   	pop    %edi
+  8003e7:	5d                   	pop    %ebp
+  8003e8:	c3                   	ret
+
+008003e9 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8003e9:	55                   	push   %ebp
+  8003ea:	89 e5                	mov    %esp,%ebp
+  8003ec:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8003ef:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8003f3:	8b 10                	mov    (%eax),%edx
+  8003f5:	3b 50 04             	cmp    0x4(%eax),%edx
+  8003f8:	73 0a                	jae    800404 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8003fa:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8003fd:	89 08                	mov    %ecx,(%eax)
+  8003ff:	8b 45 08             	mov    0x8(%ebp),%eax
+  800402:	88 02                	mov    %al,(%edx)
+}
+  800404:	5d                   	pop    %ebp
+  800405:	c3                   	ret
+
+00800406 <printfmt>:
+{
+  800406:	55                   	push   %ebp
+  800407:	89 e5                	mov    %esp,%ebp
+  800409:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80040c:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80040f:	50                   	push   %eax
+  800410:	ff 75 10             	push   0x10(%ebp)
+  800413:	ff 75 0c             	push   0xc(%ebp)
+  800416:	ff 75 08             	push   0x8(%ebp)
+  800419:	e8 05 00 00 00       	call   800423 <vprintfmt>
+}
+  80041e:	83 c4 10             	add    $0x10,%esp
+  800421:	c9                   	leave
+  800422:	c3                   	ret
+
+00800423 <vprintfmt>:
+{
+  800423:	55                   	push   %ebp
+  800424:	89 e5                	mov    %esp,%ebp
+  800426:	57                   	push   %edi
+  800427:	56                   	push   %esi
+  800428:	53                   	push   %ebx
+  800429:	83 ec 2c             	sub    $0x2c,%esp
+  80042c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80042f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800432:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800435:	eb 0a                	jmp    800441 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800437:	83 ec 08             	sub    $0x8,%esp
+  80043a:	53                   	push   %ebx
+  80043b:	50                   	push   %eax
+  80043c:	ff d6                	call   *%esi
+  80043e:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800441:	83 c7 01             	add    $0x1,%edi
+  800444:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800448:	83 f8 25             	cmp    $0x25,%eax
+  80044b:	74 0c                	je     800459 <vprintfmt+0x36>
+			if (ch == '\0')
+  80044d:	85 c0                	test   %eax,%eax
+  80044f:	75 e6                	jne    800437 <vprintfmt+0x14>
+}
+  800451:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800454:	5b                   	pop    %ebx
+  800455:	5e                   	pop    %esi
+  800456:	5f                   	pop    %edi
+  800457:	5d                   	pop    %ebp
+  800458:	c3                   	ret
+		padc = ' ';
+  800459:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80045d:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800464:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80046b:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800472:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800477:	8d 47 01             	lea    0x1(%edi),%eax
+  80047a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80047d:	0f b6 17             	movzbl (%edi),%edx
+  800480:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800483:	3c 55                	cmp    $0x55,%al
+  800485:	0f 87 9a 03 00 00    	ja     800825 <vprintfmt+0x402>
+  80048b:	0f b6 c0             	movzbl %al,%eax
+  80048e:	ff 24 85 a0 2c 80 00 	jmp    *0x802ca0(,%eax,4)
+  800495:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800498:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80049c:	eb d9                	jmp    800477 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80049e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8004a1:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8004a5:	eb d0                	jmp    800477 <vprintfmt+0x54>
+  8004a7:	0f b6 d2             	movzbl %dl,%edx
+  8004aa:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8004ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004b2:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8004b5:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8004b8:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8004bc:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8004bf:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8004c2:	83 f9 09             	cmp    $0x9,%ecx
+  8004c5:	77 55                	ja     80051c <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8004c7:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8004ca:	eb e9                	jmp    8004b5 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8004cc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004cf:	8b 00                	mov    (%eax),%eax
+  8004d1:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004d4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004d7:	8d 40 04             	lea    0x4(%eax),%eax
+  8004da:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004dd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8004e0:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004e4:	79 91                	jns    800477 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8004e6:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004e9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004ec:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8004f3:	eb 82                	jmp    800477 <vprintfmt+0x54>
+			if (width < 0)
+  8004f5:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004f8:	85 d2                	test   %edx,%edx
+  8004fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004ff:	0f 49 c2             	cmovns %edx,%eax
+  800502:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800505:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800508:	e9 6a ff ff ff       	jmp    800477 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80050d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800510:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800517:	e9 5b ff ff ff       	jmp    800477 <vprintfmt+0x54>
+  80051c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80051f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800522:	eb bc                	jmp    8004e0 <vprintfmt+0xbd>
+			lflag++;
+  800524:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800527:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80052a:	e9 48 ff ff ff       	jmp    800477 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80052f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800532:	8d 78 04             	lea    0x4(%eax),%edi
+  800535:	83 ec 08             	sub    $0x8,%esp
+  800538:	53                   	push   %ebx
+  800539:	ff 30                	push   (%eax)
+  80053b:	ff d6                	call   *%esi
+			break;
+  80053d:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800540:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800543:	e9 7c 02 00 00       	jmp    8007c4 <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  800548:	8b 45 14             	mov    0x14(%ebp),%eax
+  80054b:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80054e:	8b 10                	mov    (%eax),%edx
+  800550:	89 d0                	mov    %edx,%eax
+  800552:	f7 d8                	neg    %eax
+  800554:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800557:	83 f8 10             	cmp    $0x10,%eax
+  80055a:	7f 23                	jg     80057f <vprintfmt+0x15c>
+  80055c:	8b 14 85 00 2e 80 00 	mov    0x802e00(,%eax,4),%edx
+  800563:	85 d2                	test   %edx,%edx
+  800565:	74 18                	je     80057f <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800567:	52                   	push   %edx
+  800568:	68 5d 30 80 00       	push   $0x80305d
+  80056d:	53                   	push   %ebx
+  80056e:	56                   	push   %esi
+  80056f:	e8 92 fe ff ff       	call   800406 <printfmt>
+  800574:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800577:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80057a:	e9 45 02 00 00       	jmp    8007c4 <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  80057f:	50                   	push   %eax
+  800580:	68 7b 2b 80 00       	push   $0x802b7b
+  800585:	53                   	push   %ebx
+  800586:	56                   	push   %esi
+  800587:	e8 7a fe ff ff       	call   800406 <printfmt>
+  80058c:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80058f:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800592:	e9 2d 02 00 00       	jmp    8007c4 <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800597:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059a:	83 c0 04             	add    $0x4,%eax
+  80059d:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8005a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a3:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8005a5:	85 c9                	test   %ecx,%ecx
+  8005a7:	b8 74 2b 80 00       	mov    $0x802b74,%eax
+  8005ac:	0f 45 c1             	cmovne %ecx,%eax
+  8005af:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8005b2:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005b6:	7e 06                	jle    8005be <vprintfmt+0x19b>
+  8005b8:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8005bc:	75 0b                	jne    8005c9 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005be:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8005c1:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8005c4:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005c7:	eb 5c                	jmp    800625 <vprintfmt+0x202>
+  8005c9:	83 ec 08             	sub    $0x8,%esp
+  8005cc:	ff 75 d0             	push   -0x30(%ebp)
+  8005cf:	ff 75 cc             	push   -0x34(%ebp)
+  8005d2:	e8 eb 02 00 00       	call   8008c2 <strnlen>
+  8005d7:	89 c2                	mov    %eax,%edx
+  8005d9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005dc:	29 d0                	sub    %edx,%eax
+  8005de:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8005e1:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8005e5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005e8:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005eb:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005ed:	eb 0e                	jmp    8005fd <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8005ef:	83 ec 08             	sub    $0x8,%esp
+  8005f2:	53                   	push   %ebx
+  8005f3:	57                   	push   %edi
+  8005f4:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005f7:	83 ee 01             	sub    $0x1,%esi
+  8005fa:	83 c4 10             	add    $0x10,%esp
+  8005fd:	85 f6                	test   %esi,%esi
+  8005ff:	7f ee                	jg     8005ef <vprintfmt+0x1cc>
+  800601:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800604:	8b 75 08             	mov    0x8(%ebp),%esi
+  800607:	85 c0                	test   %eax,%eax
+  800609:	ba 00 00 00 00       	mov    $0x0,%edx
+  80060e:	0f 49 d0             	cmovns %eax,%edx
+  800611:	29 d0                	sub    %edx,%eax
+  800613:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800616:	eb a6                	jmp    8005be <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800618:	83 ec 08             	sub    $0x8,%esp
+  80061b:	53                   	push   %ebx
+  80061c:	52                   	push   %edx
+  80061d:	ff 55 08             	call   *0x8(%ebp)
+  800620:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800623:	89 f1                	mov    %esi,%ecx
+  800625:	8d 71 01             	lea    0x1(%ecx),%esi
+  800628:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80062c:	0f be d0             	movsbl %al,%edx
+  80062f:	85 d2                	test   %edx,%edx
+  800631:	74 28                	je     80065b <vprintfmt+0x238>
+  800633:	85 ff                	test   %edi,%edi
+  800635:	78 05                	js     80063c <vprintfmt+0x219>
+  800637:	83 ef 01             	sub    $0x1,%edi
+  80063a:	78 30                	js     80066c <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80063c:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800640:	74 d6                	je     800618 <vprintfmt+0x1f5>
+  800642:	0f be c0             	movsbl %al,%eax
+  800645:	83 e8 20             	sub    $0x20,%eax
+  800648:	83 f8 5e             	cmp    $0x5e,%eax
+  80064b:	76 cb                	jbe    800618 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80064d:	83 ec 08             	sub    $0x8,%esp
+  800650:	53                   	push   %ebx
+  800651:	6a 3f                	push   $0x3f
+  800653:	ff 55 08             	call   *0x8(%ebp)
+  800656:	83 c4 10             	add    $0x10,%esp
+  800659:	eb c8                	jmp    800623 <vprintfmt+0x200>
+  80065b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80065e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800661:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800664:	01 d0                	add    %edx,%eax
+  800666:	29 c8                	sub    %ecx,%eax
+  800668:	89 c7                	mov    %eax,%edi
+  80066a:	eb 13                	jmp    80067f <vprintfmt+0x25c>
+  80066c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80066f:	eb ed                	jmp    80065e <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800671:	83 ec 08             	sub    $0x8,%esp
+  800674:	53                   	push   %ebx
+  800675:	6a 20                	push   $0x20
+  800677:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800679:	83 ef 01             	sub    $0x1,%edi
+  80067c:	83 c4 10             	add    $0x10,%esp
+  80067f:	85 ff                	test   %edi,%edi
+  800681:	7f ee                	jg     800671 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800683:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800686:	89 45 14             	mov    %eax,0x14(%ebp)
+  800689:	e9 36 01 00 00       	jmp    8007c4 <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  80068e:	83 f9 01             	cmp    $0x1,%ecx
+  800691:	7f 1f                	jg     8006b2 <vprintfmt+0x28f>
+	else if (lflag)
+  800693:	85 c9                	test   %ecx,%ecx
+  800695:	74 67                	je     8006fe <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800697:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069a:	8b 00                	mov    (%eax),%eax
+  80069c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80069f:	89 c1                	mov    %eax,%ecx
+  8006a1:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006a4:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006a7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006aa:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ad:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006b0:	eb 17                	jmp    8006c9 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8006b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b5:	8b 50 04             	mov    0x4(%eax),%edx
+  8006b8:	8b 00                	mov    (%eax),%eax
+  8006ba:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006bd:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8006c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c3:	8d 40 08             	lea    0x8(%eax),%eax
+  8006c6:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8006c9:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006cc:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8006cf:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8006d4:	85 c9                	test   %ecx,%ecx
+  8006d6:	0f 89 ce 00 00 00    	jns    8007aa <vprintfmt+0x387>
+				putch('-', putdat);
+  8006dc:	83 ec 08             	sub    $0x8,%esp
+  8006df:	53                   	push   %ebx
+  8006e0:	6a 2d                	push   $0x2d
+  8006e2:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8006e4:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006e7:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8006ea:	f7 da                	neg    %edx
+  8006ec:	83 d1 00             	adc    $0x0,%ecx
+  8006ef:	f7 d9                	neg    %ecx
+  8006f1:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8006f4:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8006f9:	e9 ac 00 00 00       	jmp    8007aa <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  8006fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800701:	8b 00                	mov    (%eax),%eax
+  800703:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800706:	89 c1                	mov    %eax,%ecx
+  800708:	c1 f9 1f             	sar    $0x1f,%ecx
+  80070b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80070e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800711:	8d 40 04             	lea    0x4(%eax),%eax
+  800714:	89 45 14             	mov    %eax,0x14(%ebp)
+  800717:	eb b0                	jmp    8006c9 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800719:	83 f9 01             	cmp    $0x1,%ecx
+  80071c:	7f 1b                	jg     800739 <vprintfmt+0x316>
+	else if (lflag)
+  80071e:	85 c9                	test   %ecx,%ecx
+  800720:	74 2c                	je     80074e <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  800722:	8b 45 14             	mov    0x14(%ebp),%eax
+  800725:	8b 10                	mov    (%eax),%edx
+  800727:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80072c:	8d 40 04             	lea    0x4(%eax),%eax
+  80072f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800732:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800737:	eb 71                	jmp    8007aa <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  800739:	8b 45 14             	mov    0x14(%ebp),%eax
+  80073c:	8b 10                	mov    (%eax),%edx
+  80073e:	8b 48 04             	mov    0x4(%eax),%ecx
+  800741:	8d 40 08             	lea    0x8(%eax),%eax
+  800744:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800747:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80074c:	eb 5c                	jmp    8007aa <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  80074e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800751:	8b 10                	mov    (%eax),%edx
+  800753:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800758:	8d 40 04             	lea    0x4(%eax),%eax
+  80075b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80075e:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800763:	eb 45                	jmp    8007aa <vprintfmt+0x387>
+			putch('X', putdat);
+  800765:	83 ec 08             	sub    $0x8,%esp
+  800768:	53                   	push   %ebx
+  800769:	6a 58                	push   $0x58
+  80076b:	ff d6                	call   *%esi
+			putch('X', putdat);
+  80076d:	83 c4 08             	add    $0x8,%esp
+  800770:	53                   	push   %ebx
+  800771:	6a 58                	push   $0x58
+  800773:	ff d6                	call   *%esi
+			putch('X', putdat);
+  800775:	83 c4 08             	add    $0x8,%esp
+  800778:	53                   	push   %ebx
+  800779:	6a 58                	push   $0x58
+  80077b:	ff d6                	call   *%esi
+			break;
+  80077d:	83 c4 10             	add    $0x10,%esp
+  800780:	eb 42                	jmp    8007c4 <vprintfmt+0x3a1>
+			putch('0', putdat);
+  800782:	83 ec 08             	sub    $0x8,%esp
+  800785:	53                   	push   %ebx
+  800786:	6a 30                	push   $0x30
+  800788:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80078a:	83 c4 08             	add    $0x8,%esp
+  80078d:	53                   	push   %ebx
+  80078e:	6a 78                	push   $0x78
+  800790:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800792:	8b 45 14             	mov    0x14(%ebp),%eax
+  800795:	8b 10                	mov    (%eax),%edx
+  800797:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80079c:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80079f:	8d 40 04             	lea    0x4(%eax),%eax
+  8007a2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007a5:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8007aa:	83 ec 0c             	sub    $0xc,%esp
+  8007ad:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8007b1:	50                   	push   %eax
+  8007b2:	ff 75 e0             	push   -0x20(%ebp)
+  8007b5:	57                   	push   %edi
+  8007b6:	51                   	push   %ecx
+  8007b7:	52                   	push   %edx
+  8007b8:	89 da                	mov    %ebx,%edx
+  8007ba:	89 f0                	mov    %esi,%eax
+  8007bc:	e8 7f fb ff ff       	call   800340 <printnum>
+			break;
+  8007c1:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8007c4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8007c7:	e9 75 fc ff ff       	jmp    800441 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8007cc:	83 f9 01             	cmp    $0x1,%ecx
+  8007cf:	7f 1b                	jg     8007ec <vprintfmt+0x3c9>
+	else if (lflag)
+  8007d1:	85 c9                	test   %ecx,%ecx
+  8007d3:	74 2c                	je     800801 <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  8007d5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d8:	8b 10                	mov    (%eax),%edx
+  8007da:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007df:	8d 40 04             	lea    0x4(%eax),%eax
+  8007e2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007e5:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8007ea:	eb be                	jmp    8007aa <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  8007ec:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ef:	8b 10                	mov    (%eax),%edx
+  8007f1:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007f4:	8d 40 08             	lea    0x8(%eax),%eax
+  8007f7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007fa:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8007ff:	eb a9                	jmp    8007aa <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  800801:	8b 45 14             	mov    0x14(%ebp),%eax
+  800804:	8b 10                	mov    (%eax),%edx
+  800806:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80080b:	8d 40 04             	lea    0x4(%eax),%eax
+  80080e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800811:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800816:	eb 92                	jmp    8007aa <vprintfmt+0x387>
+			putch(ch, putdat);
+  800818:	83 ec 08             	sub    $0x8,%esp
+  80081b:	53                   	push   %ebx
+  80081c:	6a 25                	push   $0x25
+  80081e:	ff d6                	call   *%esi
+			break;
+  800820:	83 c4 10             	add    $0x10,%esp
+  800823:	eb 9f                	jmp    8007c4 <vprintfmt+0x3a1>
+			putch('%', putdat);
+  800825:	83 ec 08             	sub    $0x8,%esp
+  800828:	53                   	push   %ebx
+  800829:	6a 25                	push   $0x25
+  80082b:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80082d:	83 c4 10             	add    $0x10,%esp
+  800830:	89 f8                	mov    %edi,%eax
+  800832:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800836:	74 05                	je     80083d <vprintfmt+0x41a>
+  800838:	83 e8 01             	sub    $0x1,%eax
+  80083b:	eb f5                	jmp    800832 <vprintfmt+0x40f>
+  80083d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800840:	eb 82                	jmp    8007c4 <vprintfmt+0x3a1>
+
+00800842 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800842:	55                   	push   %ebp
+  800843:	89 e5                	mov    %esp,%ebp
+  800845:	83 ec 18             	sub    $0x18,%esp
+  800848:	8b 45 08             	mov    0x8(%ebp),%eax
+  80084b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80084e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800851:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800855:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800858:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80085f:	85 c0                	test   %eax,%eax
+  800861:	74 26                	je     800889 <vsnprintf+0x47>
+  800863:	85 d2                	test   %edx,%edx
+  800865:	7e 22                	jle    800889 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800867:	ff 75 14             	push   0x14(%ebp)
+  80086a:	ff 75 10             	push   0x10(%ebp)
+  80086d:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800870:	50                   	push   %eax
+  800871:	68 e9 03 80 00       	push   $0x8003e9
+  800876:	e8 a8 fb ff ff       	call   800423 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80087b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80087e:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800881:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800884:	83 c4 10             	add    $0x10,%esp
+}
+  800887:	c9                   	leave
+  800888:	c3                   	ret
+		return -E_INVAL;
+  800889:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80088e:	eb f7                	jmp    800887 <vsnprintf+0x45>
+
+00800890 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800890:	55                   	push   %ebp
+  800891:	89 e5                	mov    %esp,%ebp
+  800893:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800896:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800899:	50                   	push   %eax
+  80089a:	ff 75 10             	push   0x10(%ebp)
+  80089d:	ff 75 0c             	push   0xc(%ebp)
+  8008a0:	ff 75 08             	push   0x8(%ebp)
+  8008a3:	e8 9a ff ff ff       	call   800842 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8008a8:	c9                   	leave
+  8008a9:	c3                   	ret
+
+008008aa <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8008aa:	55                   	push   %ebp
+  8008ab:	89 e5                	mov    %esp,%ebp
+  8008ad:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8008b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008b5:	eb 03                	jmp    8008ba <strlen+0x10>
+		n++;
+  8008b7:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8008ba:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8008be:	75 f7                	jne    8008b7 <strlen+0xd>
+	return n;
+}
+  8008c0:	5d                   	pop    %ebp
+  8008c1:	c3                   	ret
+
+008008c2 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8008c2:	55                   	push   %ebp
+  8008c3:	89 e5                	mov    %esp,%ebp
+  8008c5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008c8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d0:	eb 03                	jmp    8008d5 <strnlen+0x13>
+		n++;
+  8008d2:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008d5:	39 d0                	cmp    %edx,%eax
+  8008d7:	74 08                	je     8008e1 <strnlen+0x1f>
+  8008d9:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008dd:	75 f3                	jne    8008d2 <strnlen+0x10>
+  8008df:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8008e1:	89 d0                	mov    %edx,%eax
+  8008e3:	5d                   	pop    %ebp
+  8008e4:	c3                   	ret
+
+008008e5 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8008e5:	55                   	push   %ebp
+  8008e6:	89 e5                	mov    %esp,%ebp
+  8008e8:	53                   	push   %ebx
+  8008e9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008ec:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8008ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008f4:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8008f8:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8008fb:	83 c0 01             	add    $0x1,%eax
+  8008fe:	84 d2                	test   %dl,%dl
+  800900:	75 f2                	jne    8008f4 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800902:	89 c8                	mov    %ecx,%eax
+  800904:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800907:	c9                   	leave
+  800908:	c3                   	ret
+
+00800909 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800909:	55                   	push   %ebp
+  80090a:	89 e5                	mov    %esp,%ebp
+  80090c:	53                   	push   %ebx
+  80090d:	83 ec 10             	sub    $0x10,%esp
+  800910:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800913:	53                   	push   %ebx
+  800914:	e8 91 ff ff ff       	call   8008aa <strlen>
+  800919:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80091c:	ff 75 0c             	push   0xc(%ebp)
+  80091f:	01 d8                	add    %ebx,%eax
+  800921:	50                   	push   %eax
+  800922:	e8 be ff ff ff       	call   8008e5 <strcpy>
+	return dst;
+}
+  800927:	89 d8                	mov    %ebx,%eax
+  800929:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80092c:	c9                   	leave
+  80092d:	c3                   	ret
+
+0080092e <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80092e:	55                   	push   %ebp
+  80092f:	89 e5                	mov    %esp,%ebp
+  800931:	56                   	push   %esi
+  800932:	53                   	push   %ebx
+  800933:	8b 75 08             	mov    0x8(%ebp),%esi
+  800936:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800939:	89 f3                	mov    %esi,%ebx
+  80093b:	03 5d 10             	add    0x10(%ebp),%ebx
+  80093e:	89 f0                	mov    %esi,%eax
+  800940:	eb 0f                	jmp    800951 <strncpy+0x23>
+		*dst++ = *src;
+  800942:	83 c0 01             	add    $0x1,%eax
+  800945:	0f b6 0a             	movzbl (%edx),%ecx
+  800948:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80094b:	80 f9 01             	cmp    $0x1,%cl
+  80094e:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800951:	39 d8                	cmp    %ebx,%eax
+  800953:	75 ed                	jne    800942 <strncpy+0x14>
+	}
+	return ret;
+}
+  800955:	89 f0                	mov    %esi,%eax
+  800957:	5b                   	pop    %ebx
+  800958:	5e                   	pop    %esi
+  800959:	5d                   	pop    %ebp
+  80095a:	c3                   	ret
+
+0080095b <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80095b:	55                   	push   %ebp
+  80095c:	89 e5                	mov    %esp,%ebp
+  80095e:	56                   	push   %esi
+  80095f:	53                   	push   %ebx
+  800960:	8b 75 08             	mov    0x8(%ebp),%esi
+  800963:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800966:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800969:	89 f0                	mov    %esi,%eax
+  80096b:	85 d2                	test   %edx,%edx
+  80096d:	74 21                	je     800990 <strlcpy+0x35>
+  80096f:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800973:	89 f2                	mov    %esi,%edx
+  800975:	eb 09                	jmp    800980 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800977:	83 c1 01             	add    $0x1,%ecx
+  80097a:	83 c2 01             	add    $0x1,%edx
+  80097d:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800980:	39 c2                	cmp    %eax,%edx
+  800982:	74 09                	je     80098d <strlcpy+0x32>
+  800984:	0f b6 19             	movzbl (%ecx),%ebx
+  800987:	84 db                	test   %bl,%bl
+  800989:	75 ec                	jne    800977 <strlcpy+0x1c>
+  80098b:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80098d:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800990:	29 f0                	sub    %esi,%eax
+}
+  800992:	5b                   	pop    %ebx
+  800993:	5e                   	pop    %esi
+  800994:	5d                   	pop    %ebp
+  800995:	c3                   	ret
+
+00800996 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800996:	55                   	push   %ebp
+  800997:	89 e5                	mov    %esp,%ebp
+  800999:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80099c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80099f:	eb 06                	jmp    8009a7 <strcmp+0x11>
+		p++, q++;
+  8009a1:	83 c1 01             	add    $0x1,%ecx
+  8009a4:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8009a7:	0f b6 01             	movzbl (%ecx),%eax
+  8009aa:	84 c0                	test   %al,%al
+  8009ac:	74 04                	je     8009b2 <strcmp+0x1c>
+  8009ae:	3a 02                	cmp    (%edx),%al
+  8009b0:	74 ef                	je     8009a1 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009b2:	0f b6 c0             	movzbl %al,%eax
+  8009b5:	0f b6 12             	movzbl (%edx),%edx
+  8009b8:	29 d0                	sub    %edx,%eax
+}
+  8009ba:	5d                   	pop    %ebp
+  8009bb:	c3                   	ret
+
+008009bc <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8009bc:	55                   	push   %ebp
+  8009bd:	89 e5                	mov    %esp,%ebp
+  8009bf:	53                   	push   %ebx
+  8009c0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009c3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009c6:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8009c9:	eb 09                	jmp    8009d4 <strncmp+0x18>
+		n--, p++, q++;
+  8009cb:	83 ea 01             	sub    $0x1,%edx
+  8009ce:	83 c0 01             	add    $0x1,%eax
+  8009d1:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8009d4:	85 d2                	test   %edx,%edx
+  8009d6:	74 18                	je     8009f0 <strncmp+0x34>
+  8009d8:	0f b6 18             	movzbl (%eax),%ebx
+  8009db:	84 db                	test   %bl,%bl
+  8009dd:	74 04                	je     8009e3 <strncmp+0x27>
+  8009df:	3a 19                	cmp    (%ecx),%bl
+  8009e1:	74 e8                	je     8009cb <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009e3:	0f b6 00             	movzbl (%eax),%eax
+  8009e6:	0f b6 11             	movzbl (%ecx),%edx
+  8009e9:	29 d0                	sub    %edx,%eax
+}
+  8009eb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009ee:	c9                   	leave
+  8009ef:	c3                   	ret
+		return 0;
+  8009f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009f5:	eb f4                	jmp    8009eb <strncmp+0x2f>
+
+008009f7 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8009f7:	55                   	push   %ebp
+  8009f8:	89 e5                	mov    %esp,%ebp
+  8009fa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009fd:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a01:	eb 03                	jmp    800a06 <strchr+0xf>
+  800a03:	83 c0 01             	add    $0x1,%eax
+  800a06:	0f b6 10             	movzbl (%eax),%edx
+  800a09:	84 d2                	test   %dl,%dl
+  800a0b:	74 06                	je     800a13 <strchr+0x1c>
+		if (*s == c)
+  800a0d:	38 ca                	cmp    %cl,%dl
+  800a0f:	75 f2                	jne    800a03 <strchr+0xc>
+  800a11:	eb 05                	jmp    800a18 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800a13:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a18:	5d                   	pop    %ebp
+  800a19:	c3                   	ret
+
+00800a1a <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a1a:	55                   	push   %ebp
+  800a1b:	89 e5                	mov    %esp,%ebp
+  800a1d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a20:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a24:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a27:	38 ca                	cmp    %cl,%dl
+  800a29:	74 09                	je     800a34 <strfind+0x1a>
+  800a2b:	84 d2                	test   %dl,%dl
+  800a2d:	74 05                	je     800a34 <strfind+0x1a>
+	for (; *s; s++)
+  800a2f:	83 c0 01             	add    $0x1,%eax
+  800a32:	eb f0                	jmp    800a24 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800a34:	5d                   	pop    %ebp
+  800a35:	c3                   	ret
+
+00800a36 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a36:	55                   	push   %ebp
+  800a37:	89 e5                	mov    %esp,%ebp
+  800a39:	57                   	push   %edi
+  800a3a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a3d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a40:	85 c9                	test   %ecx,%ecx
+  800a42:	74 20                	je     800a64 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a44:	89 f8                	mov    %edi,%eax
+  800a46:	09 c8                	or     %ecx,%eax
+  800a48:	a8 03                	test   $0x3,%al
+  800a4a:	75 12                	jne    800a5e <memset+0x28>
+		c &= 0xFF;
+  800a4c:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a50:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a56:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a59:	fc                   	cld
+  800a5a:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a5c:	eb 06                	jmp    800a64 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a5e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a61:	fc                   	cld
+  800a62:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a64:	89 f8                	mov    %edi,%eax
+  800a66:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a69:	c9                   	leave
+  800a6a:	c3                   	ret
+
+00800a6b <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a6b:	55                   	push   %ebp
+  800a6c:	89 e5                	mov    %esp,%ebp
+  800a6e:	57                   	push   %edi
+  800a6f:	56                   	push   %esi
+  800a70:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a73:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a76:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a79:	39 c6                	cmp    %eax,%esi
+  800a7b:	73 32                	jae    800aaf <memmove+0x44>
+  800a7d:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a80:	39 d0                	cmp    %edx,%eax
+  800a82:	73 2b                	jae    800aaf <memmove+0x44>
+		s += n;
+		d += n;
+  800a84:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a87:	89 d6                	mov    %edx,%esi
+  800a89:	09 fe                	or     %edi,%esi
+  800a8b:	09 ce                	or     %ecx,%esi
+  800a8d:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a93:	75 0e                	jne    800aa3 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a95:	83 ef 04             	sub    $0x4,%edi
+  800a98:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a9b:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a9e:	fd                   	std
+  800a9f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800aa1:	eb 09                	jmp    800aac <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800aa3:	83 ef 01             	sub    $0x1,%edi
+  800aa6:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800aa9:	fd                   	std
+  800aaa:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800aac:	fc                   	cld
+  800aad:	eb 1a                	jmp    800ac9 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800aaf:	89 f2                	mov    %esi,%edx
+  800ab1:	09 c2                	or     %eax,%edx
+  800ab3:	09 ca                	or     %ecx,%edx
+  800ab5:	f6 c2 03             	test   $0x3,%dl
+  800ab8:	75 0a                	jne    800ac4 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800aba:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800abd:	89 c7                	mov    %eax,%edi
+  800abf:	fc                   	cld
+  800ac0:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ac2:	eb 05                	jmp    800ac9 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800ac4:	89 c7                	mov    %eax,%edi
+  800ac6:	fc                   	cld
+  800ac7:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800ac9:	5e                   	pop    %esi
+  800aca:	5f                   	pop    %edi
+  800acb:	5d                   	pop    %ebp
+  800acc:	c3                   	ret
+
+00800acd <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800acd:	55                   	push   %ebp
+  800ace:	89 e5                	mov    %esp,%ebp
+  800ad0:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800ad3:	ff 75 10             	push   0x10(%ebp)
+  800ad6:	ff 75 0c             	push   0xc(%ebp)
+  800ad9:	ff 75 08             	push   0x8(%ebp)
+  800adc:	e8 8a ff ff ff       	call   800a6b <memmove>
+}
+  800ae1:	c9                   	leave
+  800ae2:	c3                   	ret
+
+00800ae3 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800ae3:	55                   	push   %ebp
+  800ae4:	89 e5                	mov    %esp,%ebp
+  800ae6:	56                   	push   %esi
+  800ae7:	53                   	push   %ebx
+  800ae8:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aeb:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800aee:	89 c6                	mov    %eax,%esi
+  800af0:	03 75 10             	add    0x10(%ebp),%esi
+  800af3:	eb 06                	jmp    800afb <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800af5:	83 c0 01             	add    $0x1,%eax
+  800af8:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800afb:	39 f0                	cmp    %esi,%eax
+  800afd:	74 14                	je     800b13 <memcmp+0x30>
+		if (*s1 != *s2)
+  800aff:	0f b6 08             	movzbl (%eax),%ecx
+  800b02:	0f b6 1a             	movzbl (%edx),%ebx
+  800b05:	38 d9                	cmp    %bl,%cl
+  800b07:	74 ec                	je     800af5 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800b09:	0f b6 c1             	movzbl %cl,%eax
+  800b0c:	0f b6 db             	movzbl %bl,%ebx
+  800b0f:	29 d8                	sub    %ebx,%eax
+  800b11:	eb 05                	jmp    800b18 <memcmp+0x35>
+	}
+
+	return 0;
+  800b13:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b18:	5b                   	pop    %ebx
+  800b19:	5e                   	pop    %esi
+  800b1a:	5d                   	pop    %ebp
+  800b1b:	c3                   	ret
+
+00800b1c <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b1c:	55                   	push   %ebp
+  800b1d:	89 e5                	mov    %esp,%ebp
+  800b1f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b22:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b25:	89 c2                	mov    %eax,%edx
+  800b27:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b2a:	eb 03                	jmp    800b2f <memfind+0x13>
+  800b2c:	83 c0 01             	add    $0x1,%eax
+  800b2f:	39 d0                	cmp    %edx,%eax
+  800b31:	73 04                	jae    800b37 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b33:	38 08                	cmp    %cl,(%eax)
+  800b35:	75 f5                	jne    800b2c <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800b37:	5d                   	pop    %ebp
+  800b38:	c3                   	ret
+
+00800b39 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800b39:	55                   	push   %ebp
+  800b3a:	89 e5                	mov    %esp,%ebp
+  800b3c:	57                   	push   %edi
+  800b3d:	56                   	push   %esi
+  800b3e:	53                   	push   %ebx
+  800b3f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b42:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b45:	eb 03                	jmp    800b4a <strtol+0x11>
+		s++;
+  800b47:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800b4a:	0f b6 02             	movzbl (%edx),%eax
+  800b4d:	3c 20                	cmp    $0x20,%al
+  800b4f:	74 f6                	je     800b47 <strtol+0xe>
+  800b51:	3c 09                	cmp    $0x9,%al
+  800b53:	74 f2                	je     800b47 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b55:	3c 2b                	cmp    $0x2b,%al
+  800b57:	74 2a                	je     800b83 <strtol+0x4a>
+	int neg = 0;
+  800b59:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800b5e:	3c 2d                	cmp    $0x2d,%al
+  800b60:	74 2b                	je     800b8d <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b62:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b68:	75 0f                	jne    800b79 <strtol+0x40>
+  800b6a:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b6d:	74 28                	je     800b97 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b6f:	85 db                	test   %ebx,%ebx
+  800b71:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b76:	0f 44 d8             	cmove  %eax,%ebx
+  800b79:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b7e:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b81:	eb 46                	jmp    800bc9 <strtol+0x90>
+		s++;
+  800b83:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800b86:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b8b:	eb d5                	jmp    800b62 <strtol+0x29>
+		s++, neg = 1;
+  800b8d:	83 c2 01             	add    $0x1,%edx
+  800b90:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b95:	eb cb                	jmp    800b62 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b97:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b9b:	74 0e                	je     800bab <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800b9d:	85 db                	test   %ebx,%ebx
+  800b9f:	75 d8                	jne    800b79 <strtol+0x40>
+		s++, base = 8;
+  800ba1:	83 c2 01             	add    $0x1,%edx
+  800ba4:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800ba9:	eb ce                	jmp    800b79 <strtol+0x40>
+		s += 2, base = 16;
+  800bab:	83 c2 02             	add    $0x2,%edx
+  800bae:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800bb3:	eb c4                	jmp    800b79 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800bb5:	0f be c0             	movsbl %al,%eax
+  800bb8:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800bbb:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800bbe:	7d 3a                	jge    800bfa <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800bc0:	83 c2 01             	add    $0x1,%edx
+  800bc3:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800bc7:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800bc9:	0f b6 02             	movzbl (%edx),%eax
+  800bcc:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800bcf:	89 f3                	mov    %esi,%ebx
+  800bd1:	80 fb 09             	cmp    $0x9,%bl
+  800bd4:	76 df                	jbe    800bb5 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800bd6:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800bd9:	89 f3                	mov    %esi,%ebx
+  800bdb:	80 fb 19             	cmp    $0x19,%bl
+  800bde:	77 08                	ja     800be8 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800be0:	0f be c0             	movsbl %al,%eax
+  800be3:	83 e8 57             	sub    $0x57,%eax
+  800be6:	eb d3                	jmp    800bbb <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800be8:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800beb:	89 f3                	mov    %esi,%ebx
+  800bed:	80 fb 19             	cmp    $0x19,%bl
+  800bf0:	77 08                	ja     800bfa <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800bf2:	0f be c0             	movsbl %al,%eax
+  800bf5:	83 e8 37             	sub    $0x37,%eax
+  800bf8:	eb c1                	jmp    800bbb <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800bfa:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800bfe:	74 05                	je     800c05 <strtol+0xcc>
+		*endptr = (char *) s;
+  800c00:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c03:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800c05:	89 c8                	mov    %ecx,%eax
+  800c07:	f7 d8                	neg    %eax
+  800c09:	85 ff                	test   %edi,%edi
+  800c0b:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800c0e:	89 c8                	mov    %ecx,%eax
+  800c10:	5b                   	pop    %ebx
+  800c11:	5e                   	pop    %esi
+  800c12:	5f                   	pop    %edi
+  800c13:	5d                   	pop    %ebp
+  800c14:	c3                   	ret
+
+00800c15 <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800c15:	55                   	push   %ebp
+  800c16:	89 e5                	mov    %esp,%ebp
+  800c18:	57                   	push   %edi
+  800c19:	56                   	push   %esi
+  800c1a:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800c1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c20:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c23:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c26:	89 c3                	mov    %eax,%ebx
+  800c28:	89 c7                	mov    %eax,%edi
+  800c2a:	89 c6                	mov    %eax,%esi
+  800c2c:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  800c2e:	5b                   	pop    %ebx
+  800c2f:	5e                   	pop    %esi
+  800c30:	5f                   	pop    %edi
+  800c31:	5d                   	pop    %ebp
+  800c32:	c3                   	ret
+
+00800c33 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800c33:	55                   	push   %ebp
+  800c34:	89 e5                	mov    %esp,%ebp
+  800c36:	57                   	push   %edi
+  800c37:	56                   	push   %esi
+  800c38:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800c39:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c3e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c43:	89 d1                	mov    %edx,%ecx
+  800c45:	89 d3                	mov    %edx,%ebx
+  800c47:	89 d7                	mov    %edx,%edi
+  800c49:	89 d6                	mov    %edx,%esi
+  800c4b:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c4d:	5b                   	pop    %ebx
+  800c4e:	5e                   	pop    %esi
+  800c4f:	5f                   	pop    %edi
+  800c50:	5d                   	pop    %ebp
+  800c51:	c3                   	ret
+
+00800c52 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800c52:	55                   	push   %ebp
+  800c53:	89 e5                	mov    %esp,%ebp
+  800c55:	57                   	push   %edi
+  800c56:	56                   	push   %esi
+  800c57:	53                   	push   %ebx
+  800c58:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c5b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c60:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c63:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c68:	89 cb                	mov    %ecx,%ebx
+  800c6a:	89 cf                	mov    %ecx,%edi
+  800c6c:	89 ce                	mov    %ecx,%esi
+  800c6e:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c70:	85 c0                	test   %eax,%eax
+  800c72:	7f 08                	jg     800c7c <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c74:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c77:	5b                   	pop    %ebx
+  800c78:	5e                   	pop    %esi
+  800c79:	5f                   	pop    %edi
+  800c7a:	5d                   	pop    %ebp
+  800c7b:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c7c:	83 ec 0c             	sub    $0xc,%esp
+  800c7f:	50                   	push   %eax
+  800c80:	6a 03                	push   $0x3
+  800c82:	68 63 2e 80 00       	push   $0x802e63
+  800c87:	6a 3e                	push   $0x3e
+  800c89:	68 80 2e 80 00       	push   $0x802e80
+  800c8e:	e8 be f5 ff ff       	call   800251 <_panic>
+
+00800c93 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800c93:	55                   	push   %ebp
+  800c94:	89 e5                	mov    %esp,%ebp
+  800c96:	57                   	push   %edi
+  800c97:	56                   	push   %esi
+  800c98:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800c99:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c9e:	b8 02 00 00 00       	mov    $0x2,%eax
+  800ca3:	89 d1                	mov    %edx,%ecx
+  800ca5:	89 d3                	mov    %edx,%ebx
+  800ca7:	89 d7                	mov    %edx,%edi
+  800ca9:	89 d6                	mov    %edx,%esi
+  800cab:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800cad:	5b                   	pop    %ebx
+  800cae:	5e                   	pop    %esi
+  800caf:	5f                   	pop    %edi
+  800cb0:	5d                   	pop    %ebp
+  800cb1:	c3                   	ret
+
+00800cb2 <sys_yield>:
+
+void
+sys_yield(void) {
+  800cb2:	55                   	push   %ebp
+  800cb3:	89 e5                	mov    %esp,%ebp
+  800cb5:	57                   	push   %edi
+  800cb6:	56                   	push   %esi
+  800cb7:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800cb8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cbd:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800cc2:	89 d1                	mov    %edx,%ecx
+  800cc4:	89 d3                	mov    %edx,%ebx
+  800cc6:	89 d7                	mov    %edx,%edi
+  800cc8:	89 d6                	mov    %edx,%esi
+  800cca:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800ccc:	5b                   	pop    %ebx
+  800ccd:	5e                   	pop    %esi
+  800cce:	5f                   	pop    %edi
+  800ccf:	5d                   	pop    %ebp
+  800cd0:	c3                   	ret
+
+00800cd1 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  800cd1:	55                   	push   %ebp
+  800cd2:	89 e5                	mov    %esp,%ebp
+  800cd4:	57                   	push   %edi
+  800cd5:	56                   	push   %esi
+  800cd6:	53                   	push   %ebx
+  800cd7:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800cda:	be 00 00 00 00       	mov    $0x0,%esi
+  800cdf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ce2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ce5:	b8 04 00 00 00       	mov    $0x4,%eax
+  800cea:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ced:	89 f7                	mov    %esi,%edi
+  800cef:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800cf1:	85 c0                	test   %eax,%eax
+  800cf3:	7f 08                	jg     800cfd <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800cf5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cf8:	5b                   	pop    %ebx
+  800cf9:	5e                   	pop    %esi
+  800cfa:	5f                   	pop    %edi
+  800cfb:	5d                   	pop    %ebp
+  800cfc:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800cfd:	83 ec 0c             	sub    $0xc,%esp
+  800d00:	50                   	push   %eax
+  800d01:	6a 04                	push   $0x4
+  800d03:	68 63 2e 80 00       	push   $0x802e63
+  800d08:	6a 3e                	push   $0x3e
+  800d0a:	68 80 2e 80 00       	push   $0x802e80
+  800d0f:	e8 3d f5 ff ff       	call   800251 <_panic>
+
+00800d14 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  800d14:	55                   	push   %ebp
+  800d15:	89 e5                	mov    %esp,%ebp
+  800d17:	57                   	push   %edi
+  800d18:	56                   	push   %esi
+  800d19:	53                   	push   %ebx
+  800d1a:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800d1d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d20:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d23:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d28:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d2b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d2e:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d31:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d33:	85 c0                	test   %eax,%eax
+  800d35:	7f 08                	jg     800d3f <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800d37:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d3a:	5b                   	pop    %ebx
+  800d3b:	5e                   	pop    %esi
+  800d3c:	5f                   	pop    %edi
+  800d3d:	5d                   	pop    %ebp
+  800d3e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d3f:	83 ec 0c             	sub    $0xc,%esp
+  800d42:	50                   	push   %eax
+  800d43:	6a 05                	push   $0x5
+  800d45:	68 63 2e 80 00       	push   $0x802e63
+  800d4a:	6a 3e                	push   $0x3e
+  800d4c:	68 80 2e 80 00       	push   $0x802e80
+  800d51:	e8 fb f4 ff ff       	call   800251 <_panic>
+
+00800d56 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  800d56:	55                   	push   %ebp
+  800d57:	89 e5                	mov    %esp,%ebp
+  800d59:	57                   	push   %edi
+  800d5a:	56                   	push   %esi
+  800d5b:	53                   	push   %ebx
+  800d5c:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800d5f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d64:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d67:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d6a:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d6f:	89 df                	mov    %ebx,%edi
+  800d71:	89 de                	mov    %ebx,%esi
+  800d73:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d75:	85 c0                	test   %eax,%eax
+  800d77:	7f 08                	jg     800d81 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800d79:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d7c:	5b                   	pop    %ebx
+  800d7d:	5e                   	pop    %esi
+  800d7e:	5f                   	pop    %edi
+  800d7f:	5d                   	pop    %ebp
+  800d80:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d81:	83 ec 0c             	sub    $0xc,%esp
+  800d84:	50                   	push   %eax
+  800d85:	6a 06                	push   $0x6
+  800d87:	68 63 2e 80 00       	push   $0x802e63
+  800d8c:	6a 3e                	push   $0x3e
+  800d8e:	68 80 2e 80 00       	push   $0x802e80
+  800d93:	e8 b9 f4 ff ff       	call   800251 <_panic>
+
+00800d98 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800d98:	55                   	push   %ebp
+  800d99:	89 e5                	mov    %esp,%ebp
+  800d9b:	57                   	push   %edi
+  800d9c:	56                   	push   %esi
+  800d9d:	53                   	push   %ebx
+  800d9e:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800da1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800da6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800da9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dac:	b8 08 00 00 00       	mov    $0x8,%eax
+  800db1:	89 df                	mov    %ebx,%edi
+  800db3:	89 de                	mov    %ebx,%esi
+  800db5:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800db7:	85 c0                	test   %eax,%eax
+  800db9:	7f 08                	jg     800dc3 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800dbb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dbe:	5b                   	pop    %ebx
+  800dbf:	5e                   	pop    %esi
+  800dc0:	5f                   	pop    %edi
+  800dc1:	5d                   	pop    %ebp
+  800dc2:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800dc3:	83 ec 0c             	sub    $0xc,%esp
+  800dc6:	50                   	push   %eax
+  800dc7:	6a 08                	push   $0x8
+  800dc9:	68 63 2e 80 00       	push   $0x802e63
+  800dce:	6a 3e                	push   $0x3e
+  800dd0:	68 80 2e 80 00       	push   $0x802e80
+  800dd5:	e8 77 f4 ff ff       	call   800251 <_panic>
+
+00800dda <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800dda:	55                   	push   %ebp
+  800ddb:	89 e5                	mov    %esp,%ebp
+  800ddd:	57                   	push   %edi
+  800dde:	56                   	push   %esi
+  800ddf:	53                   	push   %ebx
+  800de0:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800de3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800de8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800deb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dee:	b8 09 00 00 00       	mov    $0x9,%eax
+  800df3:	89 df                	mov    %ebx,%edi
+  800df5:	89 de                	mov    %ebx,%esi
+  800df7:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800df9:	85 c0                	test   %eax,%eax
+  800dfb:	7f 08                	jg     800e05 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800dfd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e00:	5b                   	pop    %ebx
+  800e01:	5e                   	pop    %esi
+  800e02:	5f                   	pop    %edi
+  800e03:	5d                   	pop    %ebp
+  800e04:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e05:	83 ec 0c             	sub    $0xc,%esp
+  800e08:	50                   	push   %eax
+  800e09:	6a 09                	push   $0x9
+  800e0b:	68 63 2e 80 00       	push   $0x802e63
+  800e10:	6a 3e                	push   $0x3e
+  800e12:	68 80 2e 80 00       	push   $0x802e80
+  800e17:	e8 35 f4 ff ff       	call   800251 <_panic>
+
+00800e1c <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800e1c:	55                   	push   %ebp
+  800e1d:	89 e5                	mov    %esp,%ebp
+  800e1f:	57                   	push   %edi
+  800e20:	56                   	push   %esi
+  800e21:	53                   	push   %ebx
+  800e22:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800e25:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e2a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e2d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e30:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e35:	89 df                	mov    %ebx,%edi
+  800e37:	89 de                	mov    %ebx,%esi
+  800e39:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e3b:	85 c0                	test   %eax,%eax
+  800e3d:	7f 08                	jg     800e47 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800e3f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e42:	5b                   	pop    %ebx
+  800e43:	5e                   	pop    %esi
+  800e44:	5f                   	pop    %edi
+  800e45:	5d                   	pop    %ebp
+  800e46:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e47:	83 ec 0c             	sub    $0xc,%esp
+  800e4a:	50                   	push   %eax
+  800e4b:	6a 0a                	push   $0xa
+  800e4d:	68 63 2e 80 00       	push   $0x802e63
+  800e52:	6a 3e                	push   $0x3e
+  800e54:	68 80 2e 80 00       	push   $0x802e80
+  800e59:	e8 f3 f3 ff ff       	call   800251 <_panic>
+
+00800e5e <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  800e5e:	55                   	push   %ebp
+  800e5f:	89 e5                	mov    %esp,%ebp
+  800e61:	57                   	push   %edi
+  800e62:	56                   	push   %esi
+  800e63:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e64:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e67:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e6a:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800e6f:	be 00 00 00 00       	mov    $0x0,%esi
+  800e74:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e77:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e7a:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800e7c:	5b                   	pop    %ebx
+  800e7d:	5e                   	pop    %esi
+  800e7e:	5f                   	pop    %edi
+  800e7f:	5d                   	pop    %ebp
+  800e80:	c3                   	ret
+
+00800e81 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  800e81:	55                   	push   %ebp
+  800e82:	89 e5                	mov    %esp,%ebp
+  800e84:	57                   	push   %edi
+  800e85:	56                   	push   %esi
+  800e86:	53                   	push   %ebx
+  800e87:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800e8a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e8f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e92:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e97:	89 cb                	mov    %ecx,%ebx
+  800e99:	89 cf                	mov    %ecx,%edi
+  800e9b:	89 ce                	mov    %ecx,%esi
+  800e9d:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e9f:	85 c0                	test   %eax,%eax
+  800ea1:	7f 08                	jg     800eab <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  800ea3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ea6:	5b                   	pop    %ebx
+  800ea7:	5e                   	pop    %esi
+  800ea8:	5f                   	pop    %edi
+  800ea9:	5d                   	pop    %ebp
+  800eaa:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800eab:	83 ec 0c             	sub    $0xc,%esp
+  800eae:	50                   	push   %eax
+  800eaf:	6a 0d                	push   $0xd
+  800eb1:	68 63 2e 80 00       	push   $0x802e63
+  800eb6:	6a 3e                	push   $0x3e
+  800eb8:	68 80 2e 80 00       	push   $0x802e80
+  800ebd:	e8 8f f3 ff ff       	call   800251 <_panic>
+
+00800ec2 <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  800ec2:	55                   	push   %ebp
+  800ec3:	89 e5                	mov    %esp,%ebp
+  800ec5:	57                   	push   %edi
+  800ec6:	56                   	push   %esi
+  800ec7:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800ec8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ecd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ed3:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800ed8:	89 df                	mov    %ebx,%edi
+  800eda:	89 de                	mov    %ebx,%esi
+  800edc:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  800ede:	5b                   	pop    %ebx
+  800edf:	5e                   	pop    %esi
+  800ee0:	5f                   	pop    %edi
+  800ee1:	5d                   	pop    %ebp
+  800ee2:	c3                   	ret
+
+00800ee3 <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  800ee3:	55                   	push   %ebp
+  800ee4:	89 e5                	mov    %esp,%ebp
+  800ee6:	57                   	push   %edi
+  800ee7:	56                   	push   %esi
+  800ee8:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800ee9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800eee:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef1:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800ef6:	89 cb                	mov    %ecx,%ebx
+  800ef8:	89 cf                	mov    %ecx,%edi
+  800efa:	89 ce                	mov    %ecx,%esi
+  800efc:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  800efe:	5b                   	pop    %ebx
+  800eff:	5e                   	pop    %esi
+  800f00:	5f                   	pop    %edi
+  800f01:	5d                   	pop    %ebp
+  800f02:	c3                   	ret
+
+00800f03 <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  800f03:	55                   	push   %ebp
+  800f04:	89 e5                	mov    %esp,%ebp
+  800f06:	57                   	push   %edi
+  800f07:	56                   	push   %esi
+  800f08:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800f09:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f0e:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f13:	89 d1                	mov    %edx,%ecx
+  800f15:	89 d3                	mov    %edx,%ebx
+  800f17:	89 d7                	mov    %edx,%edi
+  800f19:	89 d6                	mov    %edx,%esi
+  800f1b:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800f1d:	5b                   	pop    %ebx
+  800f1e:	5e                   	pop    %esi
+  800f1f:	5f                   	pop    %edi
+  800f20:	5d                   	pop    %ebp
+  800f21:	c3                   	ret
+
+00800f22 <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  800f22:	55                   	push   %ebp
+  800f23:	89 e5                	mov    %esp,%ebp
+  800f25:	57                   	push   %edi
+  800f26:	56                   	push   %esi
+  800f27:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800f28:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f2d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f30:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f33:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f38:	89 df                	mov    %ebx,%edi
+  800f3a:	89 de                	mov    %ebx,%esi
+  800f3c:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800f3e:	5b                   	pop    %ebx
+  800f3f:	5e                   	pop    %esi
+  800f40:	5f                   	pop    %edi
+  800f41:	5d                   	pop    %ebp
+  800f42:	c3                   	ret
+
+00800f43 <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  800f43:	55                   	push   %ebp
+  800f44:	89 e5                	mov    %esp,%ebp
+  800f46:	57                   	push   %edi
+  800f47:	56                   	push   %esi
+  800f48:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800f49:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f4e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f51:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f54:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f59:	89 df                	mov    %ebx,%edi
+  800f5b:	89 de                	mov    %ebx,%esi
+  800f5d:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800f5f:	5b                   	pop    %ebx
+  800f60:	5e                   	pop    %esi
+  800f61:	5f                   	pop    %edi
+  800f62:	5d                   	pop    %ebp
+  800f63:	c3                   	ret
+
+00800f64 <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  800f64:	55                   	push   %ebp
+  800f65:	89 e5                	mov    %esp,%ebp
+  800f67:	57                   	push   %edi
+  800f68:	56                   	push   %esi
+  800f69:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800f6a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f6f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f72:	b8 13 00 00 00       	mov    $0x13,%eax
+  800f77:	89 cb                	mov    %ecx,%ebx
+  800f79:	89 cf                	mov    %ecx,%edi
+  800f7b:	89 ce                	mov    %ecx,%esi
+  800f7d:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  800f7f:	5b                   	pop    %ebx
+  800f80:	5e                   	pop    %esi
+  800f81:	5f                   	pop    %edi
+  800f82:	5d                   	pop    %ebp
+  800f83:	c3                   	ret
+
+00800f84 <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  800f84:	55                   	push   %ebp
+  800f85:	89 e5                	mov    %esp,%ebp
+  800f87:	57                   	push   %edi
+  800f88:	56                   	push   %esi
+  800f89:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800f8a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f8f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f92:	b8 14 00 00 00       	mov    $0x14,%eax
+  800f97:	89 cb                	mov    %ecx,%ebx
+  800f99:	89 cf                	mov    %ecx,%edi
+  800f9b:	89 ce                	mov    %ecx,%esi
+  800f9d:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  800f9f:	5b                   	pop    %ebx
+  800fa0:	5e                   	pop    %esi
+  800fa1:	5f                   	pop    %edi
+  800fa2:	5d                   	pop    %ebp
+  800fa3:	c3                   	ret
+
+00800fa4 <pgfault>:
+//
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf) {
+  800fa4:	55                   	push   %ebp
+  800fa5:	89 e5                	mov    %esp,%ebp
+  800fa7:	53                   	push   %ebx
+  800fa8:	83 ec 04             	sub    $0x4,%esp
+  800fab:	8b 45 08             	mov    0x8(%ebp),%eax
+    void *addr = (void *) utf->utf_fault_va;
+  800fae:	8b 18                	mov    (%eax),%ebx
+    // Hint:
+    //   Use the read-only page table mappings at uvpt
+    //   (see <inc/memlayout.h>).
+
+    // LAB 4: Your code here.
+    if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P) ||
+  800fb0:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  800fb4:	0f 84 95 00 00 00    	je     80104f <pgfault+0xab>
+  800fba:	89 d8                	mov    %ebx,%eax
+  800fbc:	c1 e8 16             	shr    $0x16,%eax
+  800fbf:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  800fc6:	a8 01                	test   $0x1,%al
+  800fc8:	0f 84 81 00 00 00    	je     80104f <pgfault+0xab>
+        (uvpt[PGNUM(addr)] & (PTE_P | PTE_COW)) != (PTE_P | PTE_COW)) {
+  800fce:	89 d8                	mov    %ebx,%eax
+  800fd0:	c1 e8 0c             	shr    $0xc,%eax
+  800fd3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800fda:	25 01 08 00 00       	and    $0x801,%eax
+    if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P) ||
+  800fdf:	3d 01 08 00 00       	cmp    $0x801,%eax
+  800fe4:	75 69                	jne    80104f <pgfault+0xab>
+    // Hint:
+    //   You should make three system calls.
+
+    // LAB 4: Your code here.
+
+    if (sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W))
+  800fe6:	83 ec 04             	sub    $0x4,%esp
+  800fe9:	6a 07                	push   $0x7
+  800feb:	68 00 f0 7f 00       	push   $0x7ff000
+  800ff0:	6a 00                	push   $0x0
+  800ff2:	e8 da fc ff ff       	call   800cd1 <sys_page_alloc>
+  800ff7:	83 c4 10             	add    $0x10,%esp
+  800ffa:	85 c0                	test   %eax,%eax
+  800ffc:	75 65                	jne    801063 <pgfault+0xbf>
+        panic("sys_page_alloc failed");
+
+    addr = ROUNDDOWN(addr, PGSIZE);
+  800ffe:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+    memmove(PFTEMP, addr, PGSIZE);
+  801004:	83 ec 04             	sub    $0x4,%esp
+  801007:	68 00 10 00 00       	push   $0x1000
+  80100c:	53                   	push   %ebx
+  80100d:	68 00 f0 7f 00       	push   $0x7ff000
+  801012:	e8 54 fa ff ff       	call   800a6b <memmove>
+
+    if (sys_page_map(0, PFTEMP, 0, addr, PTE_P | PTE_U | PTE_W))
+  801017:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80101e:	53                   	push   %ebx
+  80101f:	6a 00                	push   $0x0
+  801021:	68 00 f0 7f 00       	push   $0x7ff000
+  801026:	6a 00                	push   $0x0
+  801028:	e8 e7 fc ff ff       	call   800d14 <sys_page_map>
+  80102d:	83 c4 20             	add    $0x20,%esp
+  801030:	85 c0                	test   %eax,%eax
+  801032:	75 43                	jne    801077 <pgfault+0xd3>
+        panic("sys_page_map failed");
+    if (sys_page_unmap(0, PFTEMP))
+  801034:	83 ec 08             	sub    $0x8,%esp
+  801037:	68 00 f0 7f 00       	push   $0x7ff000
+  80103c:	6a 00                	push   $0x0
+  80103e:	e8 13 fd ff ff       	call   800d56 <sys_page_unmap>
+  801043:	83 c4 10             	add    $0x10,%esp
+  801046:	85 c0                	test   %eax,%eax
+  801048:	75 41                	jne    80108b <pgfault+0xe7>
+        panic("sys_page_unmap failed");
+
+}
+  80104a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80104d:	c9                   	leave
+  80104e:	c3                   	ret
+        panic("pgfault: faulting access invalid");
+  80104f:	83 ec 04             	sub    $0x4,%esp
+  801052:	68 90 2e 80 00       	push   $0x802e90
+  801057:	6a 1e                	push   $0x1e
+  801059:	68 fc 2e 80 00       	push   $0x802efc
+  80105e:	e8 ee f1 ff ff       	call   800251 <_panic>
+        panic("sys_page_alloc failed");
+  801063:	83 ec 04             	sub    $0x4,%esp
+  801066:	68 6f 2f 80 00       	push   $0x802f6f
+  80106b:	6a 2a                	push   $0x2a
+  80106d:	68 fc 2e 80 00       	push   $0x802efc
+  801072:	e8 da f1 ff ff       	call   800251 <_panic>
+        panic("sys_page_map failed");
+  801077:	83 ec 04             	sub    $0x4,%esp
+  80107a:	68 07 2f 80 00       	push   $0x802f07
+  80107f:	6a 30                	push   $0x30
+  801081:	68 fc 2e 80 00       	push   $0x802efc
+  801086:	e8 c6 f1 ff ff       	call   800251 <_panic>
+        panic("sys_page_unmap failed");
+  80108b:	83 ec 04             	sub    $0x4,%esp
+  80108e:	68 1b 2f 80 00       	push   $0x802f1b
+  801093:	6a 32                	push   $0x32
+  801095:	68 fc 2e 80 00       	push   $0x802efc
+  80109a:	e8 b2 f1 ff ff       	call   800251 <_panic>
+
+0080109f <fork>:
+//   Remember to fix "thisenv" in the child process.
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void) {
+  80109f:	55                   	push   %ebp
+  8010a0:	89 e5                	mov    %esp,%ebp
+  8010a2:	57                   	push   %edi
+  8010a3:	56                   	push   %esi
+  8010a4:	53                   	push   %ebx
+  8010a5:	83 ec 18             	sub    $0x18,%esp
+    // LAB 4: Your code here.
+    set_pgfault_handler(pgfault);
+  8010a8:	68 a4 0f 80 00       	push   $0x800fa4
+  8010ad:	e8 5d 14 00 00       	call   80250f <set_pgfault_handler>
+
+// This must be inlined.  Exercise for reader: why?
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+  envid_t ret;
+  asm volatile("int %2"
+  8010b2:	b8 07 00 00 00       	mov    $0x7,%eax
+  8010b7:	cd 30                	int    $0x30
+  8010b9:	89 c6                	mov    %eax,%esi
+
+    envid_t envid = sys_exofork();
+    if (envid < 0)
+  8010bb:	83 c4 10             	add    $0x10,%esp
+  8010be:	85 c0                	test   %eax,%eax
+  8010c0:	78 2a                	js     8010ec <fork+0x4d>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+
+    uintptr_t addr;
+    for (addr = 0; addr < UTOP; addr += PGSIZE) {
+  8010c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (envid == 0) {
+  8010c7:	0f 85 a2 00 00 00    	jne    80116f <fork+0xd0>
+        thisenv = &envs[ENVX(sys_getenvid())];
+  8010cd:	e8 c1 fb ff ff       	call   800c93 <sys_getenvid>
+  8010d2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8010d7:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8010da:	c1 e0 04             	shl    $0x4,%eax
+  8010dd:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8010e2:	a3 08 50 80 00       	mov    %eax,0x805008
+        return 0;
+  8010e7:	e9 6c 01 00 00       	jmp    801258 <fork+0x1b9>
+        panic("fork: sys_exofork error: %e", envid);
+  8010ec:	50                   	push   %eax
+  8010ed:	68 31 2f 80 00       	push   $0x802f31
+  8010f2:	6a 6f                	push   $0x6f
+  8010f4:	68 fc 2e 80 00       	push   $0x802efc
+  8010f9:	e8 53 f1 ff ff       	call   800251 <_panic>
+        if ((r = sys_page_map(0, vptr, envid, vptr, uvpt[pn] & PTE_SYSCALL)) < 0)
+  8010fe:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801105:	83 ec 0c             	sub    $0xc,%esp
+  801108:	25 07 0e 00 00       	and    $0xe07,%eax
+  80110d:	50                   	push   %eax
+  80110e:	57                   	push   %edi
+  80110f:	56                   	push   %esi
+  801110:	57                   	push   %edi
+  801111:	6a 00                	push   $0x0
+  801113:	e8 fc fb ff ff       	call   800d14 <sys_page_map>
+  801118:	83 c4 20             	add    $0x20,%esp
+  80111b:	85 c0                	test   %eax,%eax
+  80111d:	79 3e                	jns    80115d <fork+0xbe>
+            panic("duppage :in sys_page_map %e", r);
+  80111f:	50                   	push   %eax
+  801120:	68 4d 2f 80 00       	push   $0x802f4d
+  801125:	6a 49                	push   $0x49
+  801127:	68 fc 2e 80 00       	push   $0x802efc
+  80112c:	e8 20 f1 ff ff       	call   800251 <_panic>
+            panic("duppage :in sys_page_map %e", r);
+  801131:	50                   	push   %eax
+  801132:	68 4d 2f 80 00       	push   $0x802f4d
+  801137:	6a 4e                	push   $0x4e
+  801139:	68 fc 2e 80 00       	push   $0x802efc
+  80113e:	e8 0e f1 ff ff       	call   800251 <_panic>
+    } else if ((r = sys_page_map(0, vptr, envid, vptr, PTE_P | PTE_U)) < 0)
+  801143:	83 ec 0c             	sub    $0xc,%esp
+  801146:	6a 05                	push   $0x5
+  801148:	57                   	push   %edi
+  801149:	56                   	push   %esi
+  80114a:	57                   	push   %edi
+  80114b:	6a 00                	push   $0x0
+  80114d:	e8 c2 fb ff ff       	call   800d14 <sys_page_map>
+  801152:	83 c4 20             	add    $0x20,%esp
+  801155:	85 c0                	test   %eax,%eax
+  801157:	0f 88 ab 00 00 00    	js     801208 <fork+0x169>
+    for (addr = 0; addr < UTOP; addr += PGSIZE) {
+  80115d:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801163:	81 fb 00 00 c0 ee    	cmp    $0xeec00000,%ebx
+  801169:	0f 84 ab 00 00 00    	je     80121a <fork+0x17b>
+        if (uvpd[PDX(addr)] & PTE_P && uvpt[PGNUM(addr)] & PTE_P && addr != UXSTACKTOP - PGSIZE) {
+  80116f:	89 d8                	mov    %ebx,%eax
+  801171:	c1 e8 16             	shr    $0x16,%eax
+  801174:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80117b:	a8 01                	test   $0x1,%al
+  80117d:	74 de                	je     80115d <fork+0xbe>
+  80117f:	89 d8                	mov    %ebx,%eax
+  801181:	c1 e8 0c             	shr    $0xc,%eax
+  801184:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80118b:	f6 c2 01             	test   $0x1,%dl
+  80118e:	74 cd                	je     80115d <fork+0xbe>
+  801190:	81 fb 00 f0 bf ee    	cmp    $0xeebff000,%ebx
+  801196:	74 c5                	je     80115d <fork+0xbe>
+    void *vptr = (void *) (pn * PGSIZE);
+  801198:	89 c7                	mov    %eax,%edi
+  80119a:	c1 e7 0c             	shl    $0xc,%edi
+    if (uvpt[pn] & PTE_SHARE) {
+  80119d:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8011a4:	f6 c6 04             	test   $0x4,%dh
+  8011a7:	0f 85 51 ff ff ff    	jne    8010fe <fork+0x5f>
+    } else if (uvpt[pn] & (PTE_W | PTE_COW)) {
+  8011ad:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8011b4:	a9 02 08 00 00       	test   $0x802,%eax
+  8011b9:	74 88                	je     801143 <fork+0xa4>
+        if ((r = sys_page_map(0, vptr, envid, vptr, PTE_P | PTE_U | PTE_COW)) < 0)
+  8011bb:	83 ec 0c             	sub    $0xc,%esp
+  8011be:	68 05 08 00 00       	push   $0x805
+  8011c3:	57                   	push   %edi
+  8011c4:	56                   	push   %esi
+  8011c5:	57                   	push   %edi
+  8011c6:	6a 00                	push   $0x0
+  8011c8:	e8 47 fb ff ff       	call   800d14 <sys_page_map>
+  8011cd:	83 c4 20             	add    $0x20,%esp
+  8011d0:	85 c0                	test   %eax,%eax
+  8011d2:	0f 88 59 ff ff ff    	js     801131 <fork+0x92>
+        if ((r = sys_page_map(0, vptr, 0, vptr, PTE_P | PTE_U | PTE_COW)) < 0)
+  8011d8:	83 ec 0c             	sub    $0xc,%esp
+  8011db:	68 05 08 00 00       	push   $0x805
+  8011e0:	57                   	push   %edi
+  8011e1:	6a 00                	push   $0x0
+  8011e3:	57                   	push   %edi
+  8011e4:	6a 00                	push   $0x0
+  8011e6:	e8 29 fb ff ff       	call   800d14 <sys_page_map>
+  8011eb:	83 c4 20             	add    $0x20,%esp
+  8011ee:	85 c0                	test   %eax,%eax
+  8011f0:	0f 89 67 ff ff ff    	jns    80115d <fork+0xbe>
+            panic("duppage :in sys_page_map %e", r);
+  8011f6:	50                   	push   %eax
+  8011f7:	68 4d 2f 80 00       	push   $0x802f4d
+  8011fc:	6a 50                	push   $0x50
+  8011fe:	68 fc 2e 80 00       	push   $0x802efc
+  801203:	e8 49 f0 ff ff       	call   800251 <_panic>
+        panic("duppage :in sys_page_map %e", r);
+  801208:	50                   	push   %eax
+  801209:	68 4d 2f 80 00       	push   $0x802f4d
+  80120e:	6a 53                	push   $0x53
+  801210:	68 fc 2e 80 00       	push   $0x802efc
+  801215:	e8 37 f0 ff ff       	call   800251 <_panic>
+            duppage(envid, PGNUM(addr));
+        }
+    }
+    if (sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W))
+  80121a:	83 ec 04             	sub    $0x4,%esp
+  80121d:	6a 07                	push   $0x7
+  80121f:	68 00 f0 bf ee       	push   $0xeebff000
+  801224:	56                   	push   %esi
+  801225:	e8 a7 fa ff ff       	call   800cd1 <sys_page_alloc>
+  80122a:	83 c4 10             	add    $0x10,%esp
+  80122d:	85 c0                	test   %eax,%eax
+  80122f:	75 31                	jne    801262 <fork+0x1c3>
+        panic("fork: sys_page_alloc failed");
+    if (sys_env_set_pgfault_upcall(envid, _pgfault_upcall))
+  801231:	83 ec 08             	sub    $0x8,%esp
+  801234:	68 7a 25 80 00       	push   $0x80257a
+  801239:	56                   	push   %esi
+  80123a:	e8 dd fb ff ff       	call   800e1c <sys_env_set_pgfault_upcall>
+  80123f:	83 c4 10             	add    $0x10,%esp
+  801242:	85 c0                	test   %eax,%eax
+  801244:	75 30                	jne    801276 <fork+0x1d7>
+        panic("fork: sys_env_set_pgfault_upcall failed");
+    if (sys_env_set_status(envid, ENV_RUNNABLE))
+  801246:	83 ec 08             	sub    $0x8,%esp
+  801249:	6a 02                	push   $0x2
+  80124b:	56                   	push   %esi
+  80124c:	e8 47 fb ff ff       	call   800d98 <sys_env_set_status>
+  801251:	83 c4 10             	add    $0x10,%esp
+  801254:	85 c0                	test   %eax,%eax
+  801256:	75 32                	jne    80128a <fork+0x1eb>
+        panic("fork: sys_env_set_status failed");
+
+    return envid;
+
+}
+  801258:	89 f0                	mov    %esi,%eax
+  80125a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80125d:	5b                   	pop    %ebx
+  80125e:	5e                   	pop    %esi
+  80125f:	5f                   	pop    %edi
+  801260:	5d                   	pop    %ebp
+  801261:	c3                   	ret
+        panic("fork: sys_page_alloc failed");
+  801262:	83 ec 04             	sub    $0x4,%esp
+  801265:	68 69 2f 80 00       	push   $0x802f69
+  80126a:	6a 7d                	push   $0x7d
+  80126c:	68 fc 2e 80 00       	push   $0x802efc
+  801271:	e8 db ef ff ff       	call   800251 <_panic>
+        panic("fork: sys_env_set_pgfault_upcall failed");
+  801276:	83 ec 04             	sub    $0x4,%esp
+  801279:	68 b4 2e 80 00       	push   $0x802eb4
+  80127e:	6a 7f                	push   $0x7f
+  801280:	68 fc 2e 80 00       	push   $0x802efc
+  801285:	e8 c7 ef ff ff       	call   800251 <_panic>
+        panic("fork: sys_env_set_status failed");
+  80128a:	83 ec 04             	sub    $0x4,%esp
+  80128d:	68 dc 2e 80 00       	push   $0x802edc
+  801292:	68 81 00 00 00       	push   $0x81
+  801297:	68 fc 2e 80 00       	push   $0x802efc
+  80129c:	e8 b0 ef ff ff       	call   800251 <_panic>
+
+008012a1 <sfork>:
+
+// Challenge!
+int
+sfork(void) {
+  8012a1:	55                   	push   %ebp
+  8012a2:	89 e5                	mov    %esp,%ebp
+  8012a4:	83 ec 0c             	sub    $0xc,%esp
+    panic("sfork not implemented");
+  8012a7:	68 85 2f 80 00       	push   $0x802f85
+  8012ac:	68 8a 00 00 00       	push   $0x8a
+  8012b1:	68 fc 2e 80 00       	push   $0x802efc
+  8012b6:	e8 96 ef ff ff       	call   800251 <_panic>
+
+008012bb <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  8012bb:	55                   	push   %ebp
+  8012bc:	89 e5                	mov    %esp,%ebp
+  8012be:	56                   	push   %esi
+  8012bf:	53                   	push   %ebx
+  8012c0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8012c3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8012c6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  8012c9:	85 c0                	test   %eax,%eax
+  8012cb:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8012d0:	0f 44 c2             	cmove  %edx,%eax
+  8012d3:	83 ec 0c             	sub    $0xc,%esp
+  8012d6:	50                   	push   %eax
+  8012d7:	e8 a5 fb ff ff       	call   800e81 <sys_ipc_recv>
+
+  if (from_env_store)
+  8012dc:	83 c4 10             	add    $0x10,%esp
+  8012df:	85 f6                	test   %esi,%esi
+  8012e1:	74 17                	je     8012fa <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  8012e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012e8:	85 c0                	test   %eax,%eax
+  8012ea:	75 0c                	jne    8012f8 <ipc_recv+0x3d>
+  8012ec:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  8012f2:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  8012f8:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  8012fa:	85 db                	test   %ebx,%ebx
+  8012fc:	74 2b                	je     801329 <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  8012fe:	85 c0                	test   %eax,%eax
+  801300:	74 0d                	je     80130f <ipc_recv+0x54>
+  801302:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  801308:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80130b:	5b                   	pop    %ebx
+  80130c:	5e                   	pop    %esi
+  80130d:	5d                   	pop    %ebp
+  80130e:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  80130f:	a1 08 50 80 00       	mov    0x805008,%eax
+  801314:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80131a:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  80131c:	a1 08 50 80 00       	mov    0x805008,%eax
+  801321:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  801327:	eb df                	jmp    801308 <ipc_recv+0x4d>
+  801329:	85 c0                	test   %eax,%eax
+  80132b:	75 db                	jne    801308 <ipc_recv+0x4d>
+  80132d:	eb ed                	jmp    80131c <ipc_recv+0x61>
+
+0080132f <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  80132f:	55                   	push   %ebp
+  801330:	89 e5                	mov    %esp,%ebp
+  801332:	57                   	push   %edi
+  801333:	56                   	push   %esi
+  801334:	53                   	push   %ebx
+  801335:	83 ec 0c             	sub    $0xc,%esp
+  801338:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80133b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80133e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  801341:	85 db                	test   %ebx,%ebx
+  801343:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801348:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  80134b:	ff 75 14             	push   0x14(%ebp)
+  80134e:	53                   	push   %ebx
+  80134f:	56                   	push   %esi
+  801350:	57                   	push   %edi
+  801351:	e8 08 fb ff ff       	call   800e5e <sys_ipc_try_send>
+  801356:	83 c4 10             	add    $0x10,%esp
+  801359:	85 c0                	test   %eax,%eax
+  80135b:	74 1e                	je     80137b <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  80135d:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801360:	75 07                	jne    801369 <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  801362:	e8 4b f9 ff ff       	call   800cb2 <sys_yield>
+  801367:	eb e2                	jmp    80134b <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  801369:	50                   	push   %eax
+  80136a:	68 9b 2f 80 00       	push   $0x802f9b
+  80136f:	6a 3c                	push   $0x3c
+  801371:	68 a8 2f 80 00       	push   $0x802fa8
+  801376:	e8 d6 ee ff ff       	call   800251 <_panic>
+  }
+
+#endif
+}
+  80137b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80137e:	5b                   	pop    %ebx
+  80137f:	5e                   	pop    %esi
+  801380:	5f                   	pop    %edi
+  801381:	5d                   	pop    %ebp
+  801382:	c3                   	ret
+
+00801383 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  801383:	55                   	push   %ebp
+  801384:	89 e5                	mov    %esp,%ebp
+  801386:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  801389:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  80138e:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  801391:	c1 e0 04             	shl    $0x4,%eax
+  801394:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801399:	8b 40 50             	mov    0x50(%eax),%eax
+  80139c:	39 c8                	cmp    %ecx,%eax
+  80139e:	74 12                	je     8013b2 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  8013a0:	83 c2 01             	add    $0x1,%edx
+  8013a3:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8013a9:	75 e3                	jne    80138e <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  8013ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013b0:	eb 0e                	jmp    8013c0 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  8013b2:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8013b5:	c1 e0 04             	shl    $0x4,%eax
+  8013b8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8013bd:	8b 40 48             	mov    0x48(%eax),%eax
+  8013c0:	5d                   	pop    %ebp
+  8013c1:	c3                   	ret
+
+008013c2 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8013c2:	55                   	push   %ebp
+  8013c3:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8013c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013c8:	05 00 00 00 30       	add    $0x30000000,%eax
+  8013cd:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8013d0:	5d                   	pop    %ebp
+  8013d1:	c3                   	ret
+
+008013d2 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8013d2:	55                   	push   %ebp
+  8013d3:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8013d5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013d8:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8013dd:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8013e2:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8013e7:	5d                   	pop    %ebp
+  8013e8:	c3                   	ret
+
+008013e9 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8013e9:	55                   	push   %ebp
+  8013ea:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8013ec:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8013f1:	eb 02                	jmp    8013f5 <fd_alloc+0xc>
+  8013f3:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8013f5:	89 c2                	mov    %eax,%edx
+  8013f7:	c1 ea 16             	shr    $0x16,%edx
+  8013fa:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801401:	f6 c2 01             	test   $0x1,%dl
+  801404:	74 2b                	je     801431 <fd_alloc+0x48>
+  801406:	89 c2                	mov    %eax,%edx
+  801408:	c1 ea 0c             	shr    $0xc,%edx
+  80140b:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801412:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801418:	f6 c1 01             	test   $0x1,%cl
+  80141b:	74 14                	je     801431 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80141d:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801423:	75 ce                	jne    8013f3 <fd_alloc+0xa>
+  801425:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80142a:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80142f:	eb 05                	jmp    801436 <fd_alloc+0x4d>
+			return 0;
+  801431:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801436:	8b 55 08             	mov    0x8(%ebp),%edx
+  801439:	89 02                	mov    %eax,(%edx)
+}
+  80143b:	89 c8                	mov    %ecx,%eax
+  80143d:	5d                   	pop    %ebp
+  80143e:	c3                   	ret
+
+0080143f <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80143f:	55                   	push   %ebp
+  801440:	89 e5                	mov    %esp,%ebp
+  801442:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801445:	83 f8 1f             	cmp    $0x1f,%eax
+  801448:	77 30                	ja     80147a <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80144a:	c1 e0 0c             	shl    $0xc,%eax
+  80144d:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801452:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801458:	f6 c2 01             	test   $0x1,%dl
+  80145b:	74 24                	je     801481 <fd_lookup+0x42>
+  80145d:	89 c2                	mov    %eax,%edx
+  80145f:	c1 ea 0c             	shr    $0xc,%edx
+  801462:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801469:	f6 c2 01             	test   $0x1,%dl
+  80146c:	74 1a                	je     801488 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80146e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801471:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801473:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801478:	5d                   	pop    %ebp
+  801479:	c3                   	ret
+		return -E_INVAL;
+  80147a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80147f:	eb f7                	jmp    801478 <fd_lookup+0x39>
+		return -E_INVAL;
+  801481:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801486:	eb f0                	jmp    801478 <fd_lookup+0x39>
+  801488:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80148d:	eb e9                	jmp    801478 <fd_lookup+0x39>
+
+0080148f <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80148f:	55                   	push   %ebp
+  801490:	89 e5                	mov    %esp,%ebp
+  801492:	53                   	push   %ebx
+  801493:	83 ec 04             	sub    $0x4,%esp
+  801496:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801499:	b8 00 00 00 00       	mov    $0x0,%eax
+  80149e:	eb 03                	jmp    8014a3 <dev_lookup+0x14>
+  8014a0:	83 c0 01             	add    $0x1,%eax
+  8014a3:	8b 1c 85 30 30 80 00 	mov    0x803030(,%eax,4),%ebx
+  8014aa:	85 db                	test   %ebx,%ebx
+  8014ac:	74 0b                	je     8014b9 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8014ae:	39 13                	cmp    %edx,(%ebx)
+  8014b0:	75 ee                	jne    8014a0 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8014b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014b7:	eb 1f                	jmp    8014d8 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8014b9:	a1 08 50 80 00       	mov    0x805008,%eax
+  8014be:	8b 40 48             	mov    0x48(%eax),%eax
+  8014c1:	83 ec 04             	sub    $0x4,%esp
+  8014c4:	52                   	push   %edx
+  8014c5:	50                   	push   %eax
+  8014c6:	68 b4 2f 80 00       	push   $0x802fb4
+  8014cb:	e8 5c ee ff ff       	call   80032c <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8014d0:	83 c4 10             	add    $0x10,%esp
+  8014d3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8014d8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8014db:	89 1a                	mov    %ebx,(%edx)
+}
+  8014dd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014e0:	c9                   	leave
+  8014e1:	c3                   	ret
+
+008014e2 <fd_close>:
+{
+  8014e2:	55                   	push   %ebp
+  8014e3:	89 e5                	mov    %esp,%ebp
+  8014e5:	57                   	push   %edi
+  8014e6:	56                   	push   %esi
+  8014e7:	53                   	push   %ebx
+  8014e8:	83 ec 24             	sub    $0x24,%esp
+  8014eb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8014ee:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8014f1:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8014f4:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8014f5:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8014fb:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8014fe:	50                   	push   %eax
+  8014ff:	e8 3b ff ff ff       	call   80143f <fd_lookup>
+  801504:	89 c3                	mov    %eax,%ebx
+  801506:	83 c4 10             	add    $0x10,%esp
+  801509:	85 c0                	test   %eax,%eax
+  80150b:	78 05                	js     801512 <fd_close+0x30>
+	    || fd != fd2)
+  80150d:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801510:	74 16                	je     801528 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801512:	89 f8                	mov    %edi,%eax
+  801514:	84 c0                	test   %al,%al
+  801516:	b8 00 00 00 00       	mov    $0x0,%eax
+  80151b:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80151e:	89 d8                	mov    %ebx,%eax
+  801520:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801523:	5b                   	pop    %ebx
+  801524:	5e                   	pop    %esi
+  801525:	5f                   	pop    %edi
+  801526:	5d                   	pop    %ebp
+  801527:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801528:	83 ec 08             	sub    $0x8,%esp
+  80152b:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80152e:	50                   	push   %eax
+  80152f:	ff 36                	push   (%esi)
+  801531:	e8 59 ff ff ff       	call   80148f <dev_lookup>
+  801536:	89 c3                	mov    %eax,%ebx
+  801538:	83 c4 10             	add    $0x10,%esp
+  80153b:	85 c0                	test   %eax,%eax
+  80153d:	78 1a                	js     801559 <fd_close+0x77>
+		if (dev->dev_close)
+  80153f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801542:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801545:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80154a:	85 c0                	test   %eax,%eax
+  80154c:	74 0b                	je     801559 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80154e:	83 ec 0c             	sub    $0xc,%esp
+  801551:	56                   	push   %esi
+  801552:	ff d0                	call   *%eax
+  801554:	89 c3                	mov    %eax,%ebx
+  801556:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801559:	83 ec 08             	sub    $0x8,%esp
+  80155c:	56                   	push   %esi
+  80155d:	6a 00                	push   $0x0
+  80155f:	e8 f2 f7 ff ff       	call   800d56 <sys_page_unmap>
+	return r;
+  801564:	83 c4 10             	add    $0x10,%esp
+  801567:	eb b5                	jmp    80151e <fd_close+0x3c>
+
+00801569 <close>:
+
+int
+close(int fdnum)
+{
+  801569:	55                   	push   %ebp
+  80156a:	89 e5                	mov    %esp,%ebp
+  80156c:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80156f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801572:	50                   	push   %eax
+  801573:	ff 75 08             	push   0x8(%ebp)
+  801576:	e8 c4 fe ff ff       	call   80143f <fd_lookup>
+  80157b:	83 c4 10             	add    $0x10,%esp
+  80157e:	85 c0                	test   %eax,%eax
+  801580:	79 02                	jns    801584 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801582:	c9                   	leave
+  801583:	c3                   	ret
+		return fd_close(fd, 1);
+  801584:	83 ec 08             	sub    $0x8,%esp
+  801587:	6a 01                	push   $0x1
+  801589:	ff 75 f4             	push   -0xc(%ebp)
+  80158c:	e8 51 ff ff ff       	call   8014e2 <fd_close>
+  801591:	83 c4 10             	add    $0x10,%esp
+  801594:	eb ec                	jmp    801582 <close+0x19>
+
+00801596 <close_all>:
+
+void
+close_all(void)
+{
+  801596:	55                   	push   %ebp
+  801597:	89 e5                	mov    %esp,%ebp
+  801599:	53                   	push   %ebx
+  80159a:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80159d:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8015a2:	83 ec 0c             	sub    $0xc,%esp
+  8015a5:	53                   	push   %ebx
+  8015a6:	e8 be ff ff ff       	call   801569 <close>
+	for (i = 0; i < MAXFD; i++)
+  8015ab:	83 c3 01             	add    $0x1,%ebx
+  8015ae:	83 c4 10             	add    $0x10,%esp
+  8015b1:	83 fb 20             	cmp    $0x20,%ebx
+  8015b4:	75 ec                	jne    8015a2 <close_all+0xc>
+}
+  8015b6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015b9:	c9                   	leave
+  8015ba:	c3                   	ret
+
+008015bb <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8015bb:	55                   	push   %ebp
+  8015bc:	89 e5                	mov    %esp,%ebp
+  8015be:	57                   	push   %edi
+  8015bf:	56                   	push   %esi
+  8015c0:	53                   	push   %ebx
+  8015c1:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8015c4:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8015c7:	50                   	push   %eax
+  8015c8:	ff 75 08             	push   0x8(%ebp)
+  8015cb:	e8 6f fe ff ff       	call   80143f <fd_lookup>
+  8015d0:	89 c3                	mov    %eax,%ebx
+  8015d2:	83 c4 10             	add    $0x10,%esp
+  8015d5:	85 c0                	test   %eax,%eax
+  8015d7:	78 7f                	js     801658 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8015d9:	83 ec 0c             	sub    $0xc,%esp
+  8015dc:	ff 75 0c             	push   0xc(%ebp)
+  8015df:	e8 85 ff ff ff       	call   801569 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8015e4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8015e7:	c1 e6 0c             	shl    $0xc,%esi
+  8015ea:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8015f0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8015f3:	89 3c 24             	mov    %edi,(%esp)
+  8015f6:	e8 d7 fd ff ff       	call   8013d2 <fd2data>
+  8015fb:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8015fd:	89 34 24             	mov    %esi,(%esp)
+  801600:	e8 cd fd ff ff       	call   8013d2 <fd2data>
+  801605:	83 c4 10             	add    $0x10,%esp
+  801608:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80160b:	89 d8                	mov    %ebx,%eax
+  80160d:	c1 e8 16             	shr    $0x16,%eax
+  801610:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801617:	a8 01                	test   $0x1,%al
+  801619:	74 11                	je     80162c <dup+0x71>
+  80161b:	89 d8                	mov    %ebx,%eax
+  80161d:	c1 e8 0c             	shr    $0xc,%eax
+  801620:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801627:	f6 c2 01             	test   $0x1,%dl
+  80162a:	75 36                	jne    801662 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80162c:	89 f8                	mov    %edi,%eax
+  80162e:	c1 e8 0c             	shr    $0xc,%eax
+  801631:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801638:	83 ec 0c             	sub    $0xc,%esp
+  80163b:	25 07 0e 00 00       	and    $0xe07,%eax
+  801640:	50                   	push   %eax
+  801641:	56                   	push   %esi
+  801642:	6a 00                	push   $0x0
+  801644:	57                   	push   %edi
+  801645:	6a 00                	push   $0x0
+  801647:	e8 c8 f6 ff ff       	call   800d14 <sys_page_map>
+  80164c:	89 c3                	mov    %eax,%ebx
+  80164e:	83 c4 20             	add    $0x20,%esp
+  801651:	85 c0                	test   %eax,%eax
+  801653:	78 33                	js     801688 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801655:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801658:	89 d8                	mov    %ebx,%eax
+  80165a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80165d:	5b                   	pop    %ebx
+  80165e:	5e                   	pop    %esi
+  80165f:	5f                   	pop    %edi
+  801660:	5d                   	pop    %ebp
+  801661:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801662:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801669:	83 ec 0c             	sub    $0xc,%esp
+  80166c:	25 07 0e 00 00       	and    $0xe07,%eax
+  801671:	50                   	push   %eax
+  801672:	ff 75 d4             	push   -0x2c(%ebp)
+  801675:	6a 00                	push   $0x0
+  801677:	53                   	push   %ebx
+  801678:	6a 00                	push   $0x0
+  80167a:	e8 95 f6 ff ff       	call   800d14 <sys_page_map>
+  80167f:	89 c3                	mov    %eax,%ebx
+  801681:	83 c4 20             	add    $0x20,%esp
+  801684:	85 c0                	test   %eax,%eax
+  801686:	79 a4                	jns    80162c <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801688:	83 ec 08             	sub    $0x8,%esp
+  80168b:	56                   	push   %esi
+  80168c:	6a 00                	push   $0x0
+  80168e:	e8 c3 f6 ff ff       	call   800d56 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801693:	83 c4 08             	add    $0x8,%esp
+  801696:	ff 75 d4             	push   -0x2c(%ebp)
+  801699:	6a 00                	push   $0x0
+  80169b:	e8 b6 f6 ff ff       	call   800d56 <sys_page_unmap>
+	return r;
+  8016a0:	83 c4 10             	add    $0x10,%esp
+  8016a3:	eb b3                	jmp    801658 <dup+0x9d>
+
+008016a5 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8016a5:	55                   	push   %ebp
+  8016a6:	89 e5                	mov    %esp,%ebp
+  8016a8:	56                   	push   %esi
+  8016a9:	53                   	push   %ebx
+  8016aa:	83 ec 18             	sub    $0x18,%esp
+  8016ad:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016b0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016b3:	50                   	push   %eax
+  8016b4:	56                   	push   %esi
+  8016b5:	e8 85 fd ff ff       	call   80143f <fd_lookup>
+  8016ba:	83 c4 10             	add    $0x10,%esp
+  8016bd:	85 c0                	test   %eax,%eax
+  8016bf:	78 3c                	js     8016fd <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016c1:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8016c4:	83 ec 08             	sub    $0x8,%esp
+  8016c7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016ca:	50                   	push   %eax
+  8016cb:	ff 33                	push   (%ebx)
+  8016cd:	e8 bd fd ff ff       	call   80148f <dev_lookup>
+  8016d2:	83 c4 10             	add    $0x10,%esp
+  8016d5:	85 c0                	test   %eax,%eax
+  8016d7:	78 24                	js     8016fd <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8016d9:	8b 43 08             	mov    0x8(%ebx),%eax
+  8016dc:	83 e0 03             	and    $0x3,%eax
+  8016df:	83 f8 01             	cmp    $0x1,%eax
+  8016e2:	74 20                	je     801704 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8016e4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016e7:	8b 40 08             	mov    0x8(%eax),%eax
+  8016ea:	85 c0                	test   %eax,%eax
+  8016ec:	74 37                	je     801725 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8016ee:	83 ec 04             	sub    $0x4,%esp
+  8016f1:	ff 75 10             	push   0x10(%ebp)
+  8016f4:	ff 75 0c             	push   0xc(%ebp)
+  8016f7:	53                   	push   %ebx
+  8016f8:	ff d0                	call   *%eax
+  8016fa:	83 c4 10             	add    $0x10,%esp
+}
+  8016fd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801700:	5b                   	pop    %ebx
+  801701:	5e                   	pop    %esi
+  801702:	5d                   	pop    %ebp
+  801703:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801704:	a1 08 50 80 00       	mov    0x805008,%eax
+  801709:	8b 40 48             	mov    0x48(%eax),%eax
+  80170c:	83 ec 04             	sub    $0x4,%esp
+  80170f:	56                   	push   %esi
+  801710:	50                   	push   %eax
+  801711:	68 f5 2f 80 00       	push   $0x802ff5
+  801716:	e8 11 ec ff ff       	call   80032c <cprintf>
+		return -E_INVAL;
+  80171b:	83 c4 10             	add    $0x10,%esp
+  80171e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801723:	eb d8                	jmp    8016fd <read+0x58>
+		return -E_NOT_SUPP;
+  801725:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80172a:	eb d1                	jmp    8016fd <read+0x58>
+
+0080172c <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80172c:	55                   	push   %ebp
+  80172d:	89 e5                	mov    %esp,%ebp
+  80172f:	57                   	push   %edi
+  801730:	56                   	push   %esi
+  801731:	53                   	push   %ebx
+  801732:	83 ec 0c             	sub    $0xc,%esp
+  801735:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801738:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80173b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801740:	eb 02                	jmp    801744 <readn+0x18>
+  801742:	01 c3                	add    %eax,%ebx
+  801744:	39 f3                	cmp    %esi,%ebx
+  801746:	73 21                	jae    801769 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801748:	83 ec 04             	sub    $0x4,%esp
+  80174b:	89 f0                	mov    %esi,%eax
+  80174d:	29 d8                	sub    %ebx,%eax
+  80174f:	50                   	push   %eax
+  801750:	89 d8                	mov    %ebx,%eax
+  801752:	03 45 0c             	add    0xc(%ebp),%eax
+  801755:	50                   	push   %eax
+  801756:	57                   	push   %edi
+  801757:	e8 49 ff ff ff       	call   8016a5 <read>
+		if (m < 0)
+  80175c:	83 c4 10             	add    $0x10,%esp
+  80175f:	85 c0                	test   %eax,%eax
+  801761:	78 04                	js     801767 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801763:	75 dd                	jne    801742 <readn+0x16>
+  801765:	eb 02                	jmp    801769 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801767:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801769:	89 d8                	mov    %ebx,%eax
+  80176b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80176e:	5b                   	pop    %ebx
+  80176f:	5e                   	pop    %esi
+  801770:	5f                   	pop    %edi
+  801771:	5d                   	pop    %ebp
+  801772:	c3                   	ret
+
+00801773 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801773:	55                   	push   %ebp
+  801774:	89 e5                	mov    %esp,%ebp
+  801776:	56                   	push   %esi
+  801777:	53                   	push   %ebx
+  801778:	83 ec 18             	sub    $0x18,%esp
+  80177b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80177e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801781:	50                   	push   %eax
+  801782:	53                   	push   %ebx
+  801783:	e8 b7 fc ff ff       	call   80143f <fd_lookup>
+  801788:	83 c4 10             	add    $0x10,%esp
+  80178b:	85 c0                	test   %eax,%eax
+  80178d:	78 37                	js     8017c6 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80178f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801792:	83 ec 08             	sub    $0x8,%esp
+  801795:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801798:	50                   	push   %eax
+  801799:	ff 36                	push   (%esi)
+  80179b:	e8 ef fc ff ff       	call   80148f <dev_lookup>
+  8017a0:	83 c4 10             	add    $0x10,%esp
+  8017a3:	85 c0                	test   %eax,%eax
+  8017a5:	78 1f                	js     8017c6 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8017a7:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8017ab:	74 20                	je     8017cd <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8017ad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017b0:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017b3:	85 c0                	test   %eax,%eax
+  8017b5:	74 37                	je     8017ee <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8017b7:	83 ec 04             	sub    $0x4,%esp
+  8017ba:	ff 75 10             	push   0x10(%ebp)
+  8017bd:	ff 75 0c             	push   0xc(%ebp)
+  8017c0:	56                   	push   %esi
+  8017c1:	ff d0                	call   *%eax
+  8017c3:	83 c4 10             	add    $0x10,%esp
+}
+  8017c6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017c9:	5b                   	pop    %ebx
+  8017ca:	5e                   	pop    %esi
+  8017cb:	5d                   	pop    %ebp
+  8017cc:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8017cd:	a1 08 50 80 00       	mov    0x805008,%eax
+  8017d2:	8b 40 48             	mov    0x48(%eax),%eax
+  8017d5:	83 ec 04             	sub    $0x4,%esp
+  8017d8:	53                   	push   %ebx
+  8017d9:	50                   	push   %eax
+  8017da:	68 11 30 80 00       	push   $0x803011
+  8017df:	e8 48 eb ff ff       	call   80032c <cprintf>
+		return -E_INVAL;
+  8017e4:	83 c4 10             	add    $0x10,%esp
+  8017e7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017ec:	eb d8                	jmp    8017c6 <write+0x53>
+		return -E_NOT_SUPP;
+  8017ee:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017f3:	eb d1                	jmp    8017c6 <write+0x53>
+
+008017f5 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8017f5:	55                   	push   %ebp
+  8017f6:	89 e5                	mov    %esp,%ebp
+  8017f8:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8017fb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017fe:	50                   	push   %eax
+  8017ff:	ff 75 08             	push   0x8(%ebp)
+  801802:	e8 38 fc ff ff       	call   80143f <fd_lookup>
+  801807:	83 c4 10             	add    $0x10,%esp
+  80180a:	85 c0                	test   %eax,%eax
+  80180c:	78 0e                	js     80181c <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80180e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801811:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801814:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801817:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80181c:	c9                   	leave
+  80181d:	c3                   	ret
+
+0080181e <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80181e:	55                   	push   %ebp
+  80181f:	89 e5                	mov    %esp,%ebp
+  801821:	56                   	push   %esi
+  801822:	53                   	push   %ebx
+  801823:	83 ec 18             	sub    $0x18,%esp
+  801826:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801829:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80182c:	50                   	push   %eax
+  80182d:	53                   	push   %ebx
+  80182e:	e8 0c fc ff ff       	call   80143f <fd_lookup>
+  801833:	83 c4 10             	add    $0x10,%esp
+  801836:	85 c0                	test   %eax,%eax
+  801838:	78 34                	js     80186e <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80183a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80183d:	83 ec 08             	sub    $0x8,%esp
+  801840:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801843:	50                   	push   %eax
+  801844:	ff 36                	push   (%esi)
+  801846:	e8 44 fc ff ff       	call   80148f <dev_lookup>
+  80184b:	83 c4 10             	add    $0x10,%esp
+  80184e:	85 c0                	test   %eax,%eax
+  801850:	78 1c                	js     80186e <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801852:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801856:	74 1d                	je     801875 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801858:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80185b:	8b 40 18             	mov    0x18(%eax),%eax
+  80185e:	85 c0                	test   %eax,%eax
+  801860:	74 34                	je     801896 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801862:	83 ec 08             	sub    $0x8,%esp
+  801865:	ff 75 0c             	push   0xc(%ebp)
+  801868:	56                   	push   %esi
+  801869:	ff d0                	call   *%eax
+  80186b:	83 c4 10             	add    $0x10,%esp
+}
+  80186e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801871:	5b                   	pop    %ebx
+  801872:	5e                   	pop    %esi
+  801873:	5d                   	pop    %ebp
+  801874:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801875:	a1 08 50 80 00       	mov    0x805008,%eax
+  80187a:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80187d:	83 ec 04             	sub    $0x4,%esp
+  801880:	53                   	push   %ebx
+  801881:	50                   	push   %eax
+  801882:	68 d4 2f 80 00       	push   $0x802fd4
+  801887:	e8 a0 ea ff ff       	call   80032c <cprintf>
+		return -E_INVAL;
+  80188c:	83 c4 10             	add    $0x10,%esp
+  80188f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801894:	eb d8                	jmp    80186e <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801896:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80189b:	eb d1                	jmp    80186e <ftruncate+0x50>
+
+0080189d <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80189d:	55                   	push   %ebp
+  80189e:	89 e5                	mov    %esp,%ebp
+  8018a0:	56                   	push   %esi
+  8018a1:	53                   	push   %ebx
+  8018a2:	83 ec 18             	sub    $0x18,%esp
+  8018a5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018a8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018ab:	50                   	push   %eax
+  8018ac:	ff 75 08             	push   0x8(%ebp)
+  8018af:	e8 8b fb ff ff       	call   80143f <fd_lookup>
+  8018b4:	83 c4 10             	add    $0x10,%esp
+  8018b7:	85 c0                	test   %eax,%eax
+  8018b9:	78 49                	js     801904 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8018bb:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8018be:	83 ec 08             	sub    $0x8,%esp
+  8018c1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018c4:	50                   	push   %eax
+  8018c5:	ff 36                	push   (%esi)
+  8018c7:	e8 c3 fb ff ff       	call   80148f <dev_lookup>
+  8018cc:	83 c4 10             	add    $0x10,%esp
+  8018cf:	85 c0                	test   %eax,%eax
+  8018d1:	78 31                	js     801904 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8018d3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018d6:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8018da:	74 2f                	je     80190b <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8018dc:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8018df:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8018e6:	00 00 00 
+	stat->st_isdir = 0;
+  8018e9:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8018f0:	00 00 00 
+	stat->st_dev = dev;
+  8018f3:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8018f9:	83 ec 08             	sub    $0x8,%esp
+  8018fc:	53                   	push   %ebx
+  8018fd:	56                   	push   %esi
+  8018fe:	ff 50 14             	call   *0x14(%eax)
+  801901:	83 c4 10             	add    $0x10,%esp
+}
+  801904:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801907:	5b                   	pop    %ebx
+  801908:	5e                   	pop    %esi
+  801909:	5d                   	pop    %ebp
+  80190a:	c3                   	ret
+		return -E_NOT_SUPP;
+  80190b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801910:	eb f2                	jmp    801904 <fstat+0x67>
+
+00801912 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801912:	55                   	push   %ebp
+  801913:	89 e5                	mov    %esp,%ebp
+  801915:	56                   	push   %esi
+  801916:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801917:	83 ec 08             	sub    $0x8,%esp
+  80191a:	6a 00                	push   $0x0
+  80191c:	ff 75 08             	push   0x8(%ebp)
+  80191f:	e8 e4 01 00 00       	call   801b08 <open>
+  801924:	89 c3                	mov    %eax,%ebx
+  801926:	83 c4 10             	add    $0x10,%esp
+  801929:	85 c0                	test   %eax,%eax
+  80192b:	78 1b                	js     801948 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80192d:	83 ec 08             	sub    $0x8,%esp
+  801930:	ff 75 0c             	push   0xc(%ebp)
+  801933:	50                   	push   %eax
+  801934:	e8 64 ff ff ff       	call   80189d <fstat>
+  801939:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80193b:	89 1c 24             	mov    %ebx,(%esp)
+  80193e:	e8 26 fc ff ff       	call   801569 <close>
+	return r;
+  801943:	83 c4 10             	add    $0x10,%esp
+  801946:	89 f3                	mov    %esi,%ebx
+}
+  801948:	89 d8                	mov    %ebx,%eax
+  80194a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80194d:	5b                   	pop    %ebx
+  80194e:	5e                   	pop    %esi
+  80194f:	5d                   	pop    %ebp
+  801950:	c3                   	ret
+
+00801951 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  801951:	55                   	push   %ebp
+  801952:	89 e5                	mov    %esp,%ebp
+  801954:	56                   	push   %esi
+  801955:	53                   	push   %ebx
+  801956:	89 c6                	mov    %eax,%esi
+  801958:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  80195a:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  801961:	74 27                	je     80198a <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801963:	6a 07                	push   $0x7
+  801965:	68 00 60 80 00       	push   $0x806000
+  80196a:	56                   	push   %esi
+  80196b:	ff 35 00 50 80 00    	push   0x805000
+  801971:	e8 b9 f9 ff ff       	call   80132f <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  801976:	83 c4 0c             	add    $0xc,%esp
+  801979:	6a 00                	push   $0x0
+  80197b:	53                   	push   %ebx
+  80197c:	6a 00                	push   $0x0
+  80197e:	e8 38 f9 ff ff       	call   8012bb <ipc_recv>
+}
+  801983:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801986:	5b                   	pop    %ebx
+  801987:	5e                   	pop    %esi
+  801988:	5d                   	pop    %ebp
+  801989:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  80198a:	83 ec 0c             	sub    $0xc,%esp
+  80198d:	6a 01                	push   $0x1
+  80198f:	e8 ef f9 ff ff       	call   801383 <ipc_find_env>
+  801994:	a3 00 50 80 00       	mov    %eax,0x805000
+  801999:	83 c4 10             	add    $0x10,%esp
+  80199c:	eb c5                	jmp    801963 <fsipc+0x12>
+
+0080199e <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80199e:	55                   	push   %ebp
+  80199f:	89 e5                	mov    %esp,%ebp
+  8019a1:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8019a4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019a7:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019aa:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.set_size.req_size = newsize;
+  8019af:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019b2:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  8019b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019bc:	b8 02 00 00 00       	mov    $0x2,%eax
+  8019c1:	e8 8b ff ff ff       	call   801951 <fsipc>
+}
+  8019c6:	c9                   	leave
+  8019c7:	c3                   	ret
+
+008019c8 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8019c8:	55                   	push   %ebp
+  8019c9:	89 e5                	mov    %esp,%ebp
+  8019cb:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8019ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019d1:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019d4:	a3 00 60 80 00       	mov    %eax,0x806000
+  return fsipc(FSREQ_FLUSH, NULL);
+  8019d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019de:	b8 06 00 00 00       	mov    $0x6,%eax
+  8019e3:	e8 69 ff ff ff       	call   801951 <fsipc>
+}
+  8019e8:	c9                   	leave
+  8019e9:	c3                   	ret
+
+008019ea <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8019ea:	55                   	push   %ebp
+  8019eb:	89 e5                	mov    %esp,%ebp
+  8019ed:	53                   	push   %ebx
+  8019ee:	83 ec 04             	sub    $0x4,%esp
+  8019f1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8019f4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019f7:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019fa:	a3 00 60 80 00       	mov    %eax,0x806000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8019ff:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a04:	b8 05 00 00 00       	mov    $0x5,%eax
+  801a09:	e8 43 ff ff ff       	call   801951 <fsipc>
+  801a0e:	85 c0                	test   %eax,%eax
+  801a10:	78 2c                	js     801a3e <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801a12:	83 ec 08             	sub    $0x8,%esp
+  801a15:	68 00 60 80 00       	push   $0x806000
+  801a1a:	53                   	push   %ebx
+  801a1b:	e8 c5 ee ff ff       	call   8008e5 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801a20:	a1 80 60 80 00       	mov    0x806080,%eax
+  801a25:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801a2b:	a1 84 60 80 00       	mov    0x806084,%eax
+  801a30:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801a36:	83 c4 10             	add    $0x10,%esp
+  801a39:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a3e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a41:	c9                   	leave
+  801a42:	c3                   	ret
+
+00801a43 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801a43:	55                   	push   %ebp
+  801a44:	89 e5                	mov    %esp,%ebp
+  801a46:	83 ec 0c             	sub    $0xc,%esp
+  801a49:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801a4c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a4f:	8b 52 0c             	mov    0xc(%edx),%edx
+  801a52:	89 15 00 60 80 00    	mov    %edx,0x806000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801a58:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801a5d:	39 d0                	cmp    %edx,%eax
+  801a5f:	0f 47 c2             	cmova  %edx,%eax
+  801a62:	a3 04 60 80 00       	mov    %eax,0x806004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  801a67:	50                   	push   %eax
+  801a68:	ff 75 0c             	push   0xc(%ebp)
+  801a6b:	68 08 60 80 00       	push   $0x806008
+  801a70:	e8 f6 ef ff ff       	call   800a6b <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801a75:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a7a:	b8 04 00 00 00       	mov    $0x4,%eax
+  801a7f:	e8 cd fe ff ff       	call   801951 <fsipc>
+}
+  801a84:	c9                   	leave
+  801a85:	c3                   	ret
+
+00801a86 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801a86:	55                   	push   %ebp
+  801a87:	89 e5                	mov    %esp,%ebp
+  801a89:	56                   	push   %esi
+  801a8a:	53                   	push   %ebx
+  801a8b:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801a8e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a91:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a94:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read.req_n = n;
+  801a99:	89 35 04 60 80 00    	mov    %esi,0x806004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801a9f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801aa4:	b8 03 00 00 00       	mov    $0x3,%eax
+  801aa9:	e8 a3 fe ff ff       	call   801951 <fsipc>
+  801aae:	89 c3                	mov    %eax,%ebx
+  801ab0:	85 c0                	test   %eax,%eax
+  801ab2:	78 1f                	js     801ad3 <devfile_read+0x4d>
+  assert(r <= n);
+  801ab4:	39 c6                	cmp    %eax,%esi
+  801ab6:	72 24                	jb     801adc <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  801ab8:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801abd:	7f 33                	jg     801af2 <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801abf:	83 ec 04             	sub    $0x4,%esp
+  801ac2:	50                   	push   %eax
+  801ac3:	68 00 60 80 00       	push   $0x806000
+  801ac8:	ff 75 0c             	push   0xc(%ebp)
+  801acb:	e8 9b ef ff ff       	call   800a6b <memmove>
+  return r;
+  801ad0:	83 c4 10             	add    $0x10,%esp
+}
+  801ad3:	89 d8                	mov    %ebx,%eax
+  801ad5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ad8:	5b                   	pop    %ebx
+  801ad9:	5e                   	pop    %esi
+  801ada:	5d                   	pop    %ebp
+  801adb:	c3                   	ret
+  assert(r <= n);
+  801adc:	68 44 30 80 00       	push   $0x803044
+  801ae1:	68 4b 30 80 00       	push   $0x80304b
+  801ae6:	6a 78                	push   $0x78
+  801ae8:	68 60 30 80 00       	push   $0x803060
+  801aed:	e8 5f e7 ff ff       	call   800251 <_panic>
+  assert(r <= PGSIZE);
+  801af2:	68 6b 30 80 00       	push   $0x80306b
+  801af7:	68 4b 30 80 00       	push   $0x80304b
+  801afc:	6a 79                	push   $0x79
+  801afe:	68 60 30 80 00       	push   $0x803060
+  801b03:	e8 49 e7 ff ff       	call   800251 <_panic>
+
+00801b08 <open>:
+open(const char *path, int mode) {
+  801b08:	55                   	push   %ebp
+  801b09:	89 e5                	mov    %esp,%ebp
+  801b0b:	56                   	push   %esi
+  801b0c:	53                   	push   %ebx
+  801b0d:	83 ec 1c             	sub    $0x1c,%esp
+  801b10:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801b13:	56                   	push   %esi
+  801b14:	e8 91 ed ff ff       	call   8008aa <strlen>
+  801b19:	83 c4 10             	add    $0x10,%esp
+  801b1c:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801b21:	7f 6c                	jg     801b8f <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801b23:	83 ec 0c             	sub    $0xc,%esp
+  801b26:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b29:	50                   	push   %eax
+  801b2a:	e8 ba f8 ff ff       	call   8013e9 <fd_alloc>
+  801b2f:	89 c3                	mov    %eax,%ebx
+  801b31:	83 c4 10             	add    $0x10,%esp
+  801b34:	85 c0                	test   %eax,%eax
+  801b36:	78 3c                	js     801b74 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801b38:	83 ec 08             	sub    $0x8,%esp
+  801b3b:	56                   	push   %esi
+  801b3c:	68 00 60 80 00       	push   $0x806000
+  801b41:	e8 9f ed ff ff       	call   8008e5 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801b46:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b49:	a3 00 64 80 00       	mov    %eax,0x806400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801b4e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801b51:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b56:	e8 f6 fd ff ff       	call   801951 <fsipc>
+  801b5b:	89 c3                	mov    %eax,%ebx
+  801b5d:	83 c4 10             	add    $0x10,%esp
+  801b60:	85 c0                	test   %eax,%eax
+  801b62:	78 19                	js     801b7d <open+0x75>
+  return fd2num(fd);
+  801b64:	83 ec 0c             	sub    $0xc,%esp
+  801b67:	ff 75 f4             	push   -0xc(%ebp)
+  801b6a:	e8 53 f8 ff ff       	call   8013c2 <fd2num>
+  801b6f:	89 c3                	mov    %eax,%ebx
+  801b71:	83 c4 10             	add    $0x10,%esp
+}
+  801b74:	89 d8                	mov    %ebx,%eax
+  801b76:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b79:	5b                   	pop    %ebx
+  801b7a:	5e                   	pop    %esi
+  801b7b:	5d                   	pop    %ebp
+  801b7c:	c3                   	ret
+    fd_close(fd, 0);
+  801b7d:	83 ec 08             	sub    $0x8,%esp
+  801b80:	6a 00                	push   $0x0
+  801b82:	ff 75 f4             	push   -0xc(%ebp)
+  801b85:	e8 58 f9 ff ff       	call   8014e2 <fd_close>
+    return r;
+  801b8a:	83 c4 10             	add    $0x10,%esp
+  801b8d:	eb e5                	jmp    801b74 <open+0x6c>
+    return -E_BAD_PATH;
+  801b8f:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801b94:	eb de                	jmp    801b74 <open+0x6c>
+
+00801b96 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  801b96:	55                   	push   %ebp
+  801b97:	89 e5                	mov    %esp,%ebp
+  801b99:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801b9c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ba1:	b8 08 00 00 00       	mov    $0x8,%eax
+  801ba6:	e8 a6 fd ff ff       	call   801951 <fsipc>
+}
+  801bab:	c9                   	leave
+  801bac:	c3                   	ret
+
+00801bad <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  801bad:	55                   	push   %ebp
+  801bae:	89 e5                	mov    %esp,%ebp
+  801bb0:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  801bb3:	89 c2                	mov    %eax,%edx
+  801bb5:	c1 ea 16             	shr    $0x16,%edx
+  801bb8:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  801bbf:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  801bc4:	f6 c1 01             	test   $0x1,%cl
+  801bc7:	74 1c                	je     801be5 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  801bc9:	c1 e8 0c             	shr    $0xc,%eax
+  801bcc:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  801bd3:	a8 01                	test   $0x1,%al
+  801bd5:	74 0e                	je     801be5 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  801bd7:	c1 e8 0c             	shr    $0xc,%eax
+  801bda:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  801be1:	ef 
+  801be2:	0f b7 d2             	movzwl %dx,%edx
+}
+  801be5:	89 d0                	mov    %edx,%eax
+  801be7:	5d                   	pop    %ebp
+  801be8:	c3                   	ret
+
+00801be9 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801be9:	55                   	push   %ebp
+  801bea:	89 e5                	mov    %esp,%ebp
+  801bec:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801bef:	68 77 30 80 00       	push   $0x803077
+  801bf4:	ff 75 0c             	push   0xc(%ebp)
+  801bf7:	e8 e9 ec ff ff       	call   8008e5 <strcpy>
+	return 0;
+}
+  801bfc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c01:	c9                   	leave
+  801c02:	c3                   	ret
+
+00801c03 <devsock_close>:
+{
+  801c03:	55                   	push   %ebp
+  801c04:	89 e5                	mov    %esp,%ebp
+  801c06:	53                   	push   %ebx
+  801c07:	83 ec 10             	sub    $0x10,%esp
+  801c0a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801c0d:	53                   	push   %ebx
+  801c0e:	e8 9a ff ff ff       	call   801bad <pageref>
+  801c13:	89 c2                	mov    %eax,%edx
+  801c15:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801c18:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801c1d:	83 fa 01             	cmp    $0x1,%edx
+  801c20:	74 05                	je     801c27 <devsock_close+0x24>
+}
+  801c22:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c25:	c9                   	leave
+  801c26:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801c27:	83 ec 0c             	sub    $0xc,%esp
+  801c2a:	ff 73 0c             	push   0xc(%ebx)
+  801c2d:	e8 b7 02 00 00       	call   801ee9 <nsipc_close>
+  801c32:	83 c4 10             	add    $0x10,%esp
+  801c35:	eb eb                	jmp    801c22 <devsock_close+0x1f>
+
+00801c37 <devsock_write>:
+{
+  801c37:	55                   	push   %ebp
+  801c38:	89 e5                	mov    %esp,%ebp
+  801c3a:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801c3d:	6a 00                	push   $0x0
+  801c3f:	ff 75 10             	push   0x10(%ebp)
+  801c42:	ff 75 0c             	push   0xc(%ebp)
+  801c45:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c48:	ff 70 0c             	push   0xc(%eax)
+  801c4b:	e8 79 03 00 00       	call   801fc9 <nsipc_send>
+}
+  801c50:	c9                   	leave
+  801c51:	c3                   	ret
+
+00801c52 <devsock_read>:
+{
+  801c52:	55                   	push   %ebp
+  801c53:	89 e5                	mov    %esp,%ebp
+  801c55:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801c58:	6a 00                	push   $0x0
+  801c5a:	ff 75 10             	push   0x10(%ebp)
+  801c5d:	ff 75 0c             	push   0xc(%ebp)
+  801c60:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c63:	ff 70 0c             	push   0xc(%eax)
+  801c66:	e8 ef 02 00 00       	call   801f5a <nsipc_recv>
+}
+  801c6b:	c9                   	leave
+  801c6c:	c3                   	ret
+
+00801c6d <fd2sockid>:
+{
+  801c6d:	55                   	push   %ebp
+  801c6e:	89 e5                	mov    %esp,%ebp
+  801c70:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801c73:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801c76:	52                   	push   %edx
+  801c77:	50                   	push   %eax
+  801c78:	e8 c2 f7 ff ff       	call   80143f <fd_lookup>
+  801c7d:	83 c4 10             	add    $0x10,%esp
+  801c80:	85 c0                	test   %eax,%eax
+  801c82:	78 10                	js     801c94 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801c84:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c87:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  801c8d:	39 08                	cmp    %ecx,(%eax)
+  801c8f:	75 05                	jne    801c96 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801c91:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801c94:	c9                   	leave
+  801c95:	c3                   	ret
+		return -E_NOT_SUPP;
+  801c96:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c9b:	eb f7                	jmp    801c94 <fd2sockid+0x27>
+
+00801c9d <alloc_sockfd>:
+{
+  801c9d:	55                   	push   %ebp
+  801c9e:	89 e5                	mov    %esp,%ebp
+  801ca0:	56                   	push   %esi
+  801ca1:	53                   	push   %ebx
+  801ca2:	83 ec 1c             	sub    $0x1c,%esp
+  801ca5:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801ca7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801caa:	50                   	push   %eax
+  801cab:	e8 39 f7 ff ff       	call   8013e9 <fd_alloc>
+  801cb0:	89 c3                	mov    %eax,%ebx
+  801cb2:	83 c4 10             	add    $0x10,%esp
+  801cb5:	85 c0                	test   %eax,%eax
+  801cb7:	78 43                	js     801cfc <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801cb9:	83 ec 04             	sub    $0x4,%esp
+  801cbc:	68 07 04 00 00       	push   $0x407
+  801cc1:	ff 75 f4             	push   -0xc(%ebp)
+  801cc4:	6a 00                	push   $0x0
+  801cc6:	e8 06 f0 ff ff       	call   800cd1 <sys_page_alloc>
+  801ccb:	89 c3                	mov    %eax,%ebx
+  801ccd:	83 c4 10             	add    $0x10,%esp
+  801cd0:	85 c0                	test   %eax,%eax
+  801cd2:	78 28                	js     801cfc <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801cd4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cd7:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801cdd:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801cdf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ce2:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801ce9:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801cec:	83 ec 0c             	sub    $0xc,%esp
+  801cef:	50                   	push   %eax
+  801cf0:	e8 cd f6 ff ff       	call   8013c2 <fd2num>
+  801cf5:	89 c3                	mov    %eax,%ebx
+  801cf7:	83 c4 10             	add    $0x10,%esp
+  801cfa:	eb 0c                	jmp    801d08 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801cfc:	83 ec 0c             	sub    $0xc,%esp
+  801cff:	56                   	push   %esi
+  801d00:	e8 e4 01 00 00       	call   801ee9 <nsipc_close>
+		return r;
+  801d05:	83 c4 10             	add    $0x10,%esp
+}
+  801d08:	89 d8                	mov    %ebx,%eax
+  801d0a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d0d:	5b                   	pop    %ebx
+  801d0e:	5e                   	pop    %esi
+  801d0f:	5d                   	pop    %ebp
+  801d10:	c3                   	ret
+
+00801d11 <accept>:
+{
+  801d11:	55                   	push   %ebp
+  801d12:	89 e5                	mov    %esp,%ebp
+  801d14:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d17:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d1a:	e8 4e ff ff ff       	call   801c6d <fd2sockid>
+  801d1f:	85 c0                	test   %eax,%eax
+  801d21:	78 1b                	js     801d3e <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801d23:	83 ec 04             	sub    $0x4,%esp
+  801d26:	ff 75 10             	push   0x10(%ebp)
+  801d29:	ff 75 0c             	push   0xc(%ebp)
+  801d2c:	50                   	push   %eax
+  801d2d:	e8 0e 01 00 00       	call   801e40 <nsipc_accept>
+  801d32:	83 c4 10             	add    $0x10,%esp
+  801d35:	85 c0                	test   %eax,%eax
+  801d37:	78 05                	js     801d3e <accept+0x2d>
+	return alloc_sockfd(r);
+  801d39:	e8 5f ff ff ff       	call   801c9d <alloc_sockfd>
+}
+  801d3e:	c9                   	leave
+  801d3f:	c3                   	ret
+
+00801d40 <bind>:
+{
+  801d40:	55                   	push   %ebp
+  801d41:	89 e5                	mov    %esp,%ebp
+  801d43:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d46:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d49:	e8 1f ff ff ff       	call   801c6d <fd2sockid>
+  801d4e:	85 c0                	test   %eax,%eax
+  801d50:	78 12                	js     801d64 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801d52:	83 ec 04             	sub    $0x4,%esp
+  801d55:	ff 75 10             	push   0x10(%ebp)
+  801d58:	ff 75 0c             	push   0xc(%ebp)
+  801d5b:	50                   	push   %eax
+  801d5c:	e8 31 01 00 00       	call   801e92 <nsipc_bind>
+  801d61:	83 c4 10             	add    $0x10,%esp
+}
+  801d64:	c9                   	leave
+  801d65:	c3                   	ret
+
+00801d66 <shutdown>:
+{
+  801d66:	55                   	push   %ebp
+  801d67:	89 e5                	mov    %esp,%ebp
+  801d69:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d6c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d6f:	e8 f9 fe ff ff       	call   801c6d <fd2sockid>
+  801d74:	85 c0                	test   %eax,%eax
+  801d76:	78 0f                	js     801d87 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801d78:	83 ec 08             	sub    $0x8,%esp
+  801d7b:	ff 75 0c             	push   0xc(%ebp)
+  801d7e:	50                   	push   %eax
+  801d7f:	e8 43 01 00 00       	call   801ec7 <nsipc_shutdown>
+  801d84:	83 c4 10             	add    $0x10,%esp
+}
+  801d87:	c9                   	leave
+  801d88:	c3                   	ret
+
+00801d89 <connect>:
+{
+  801d89:	55                   	push   %ebp
+  801d8a:	89 e5                	mov    %esp,%ebp
+  801d8c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d8f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d92:	e8 d6 fe ff ff       	call   801c6d <fd2sockid>
+  801d97:	85 c0                	test   %eax,%eax
+  801d99:	78 12                	js     801dad <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801d9b:	83 ec 04             	sub    $0x4,%esp
+  801d9e:	ff 75 10             	push   0x10(%ebp)
+  801da1:	ff 75 0c             	push   0xc(%ebp)
+  801da4:	50                   	push   %eax
+  801da5:	e8 59 01 00 00       	call   801f03 <nsipc_connect>
+  801daa:	83 c4 10             	add    $0x10,%esp
+}
+  801dad:	c9                   	leave
+  801dae:	c3                   	ret
+
+00801daf <listen>:
+{
+  801daf:	55                   	push   %ebp
+  801db0:	89 e5                	mov    %esp,%ebp
+  801db2:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801db5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801db8:	e8 b0 fe ff ff       	call   801c6d <fd2sockid>
+  801dbd:	85 c0                	test   %eax,%eax
+  801dbf:	78 0f                	js     801dd0 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801dc1:	83 ec 08             	sub    $0x8,%esp
+  801dc4:	ff 75 0c             	push   0xc(%ebp)
+  801dc7:	50                   	push   %eax
+  801dc8:	e8 6b 01 00 00       	call   801f38 <nsipc_listen>
+  801dcd:	83 c4 10             	add    $0x10,%esp
+}
+  801dd0:	c9                   	leave
+  801dd1:	c3                   	ret
+
+00801dd2 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801dd2:	55                   	push   %ebp
+  801dd3:	89 e5                	mov    %esp,%ebp
+  801dd5:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801dd8:	ff 75 10             	push   0x10(%ebp)
+  801ddb:	ff 75 0c             	push   0xc(%ebp)
+  801dde:	ff 75 08             	push   0x8(%ebp)
+  801de1:	e8 41 02 00 00       	call   802027 <nsipc_socket>
+  801de6:	83 c4 10             	add    $0x10,%esp
+  801de9:	85 c0                	test   %eax,%eax
+  801deb:	78 05                	js     801df2 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801ded:	e8 ab fe ff ff       	call   801c9d <alloc_sockfd>
+}
+  801df2:	c9                   	leave
+  801df3:	c3                   	ret
+
+00801df4 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801df4:	55                   	push   %ebp
+  801df5:	89 e5                	mov    %esp,%ebp
+  801df7:	53                   	push   %ebx
+  801df8:	83 ec 04             	sub    $0x4,%esp
+  801dfb:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801dfd:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  801e04:	74 26                	je     801e2c <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801e06:	6a 07                	push   $0x7
+  801e08:	68 00 70 80 00       	push   $0x807000
+  801e0d:	53                   	push   %ebx
+  801e0e:	ff 35 04 50 80 00    	push   0x805004
+  801e14:	e8 16 f5 ff ff       	call   80132f <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801e19:	83 c4 0c             	add    $0xc,%esp
+  801e1c:	6a 00                	push   $0x0
+  801e1e:	6a 00                	push   $0x0
+  801e20:	6a 00                	push   $0x0
+  801e22:	e8 94 f4 ff ff       	call   8012bb <ipc_recv>
+}
+  801e27:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e2a:	c9                   	leave
+  801e2b:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801e2c:	83 ec 0c             	sub    $0xc,%esp
+  801e2f:	6a 02                	push   $0x2
+  801e31:	e8 4d f5 ff ff       	call   801383 <ipc_find_env>
+  801e36:	a3 04 50 80 00       	mov    %eax,0x805004
+  801e3b:	83 c4 10             	add    $0x10,%esp
+  801e3e:	eb c6                	jmp    801e06 <nsipc+0x12>
+
+00801e40 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801e40:	55                   	push   %ebp
+  801e41:	89 e5                	mov    %esp,%ebp
+  801e43:	56                   	push   %esi
+  801e44:	53                   	push   %ebx
+  801e45:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801e48:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e4b:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801e50:	8b 06                	mov    (%esi),%eax
+  801e52:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801e57:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e5c:	e8 93 ff ff ff       	call   801df4 <nsipc>
+  801e61:	89 c3                	mov    %eax,%ebx
+  801e63:	85 c0                	test   %eax,%eax
+  801e65:	79 09                	jns    801e70 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801e67:	89 d8                	mov    %ebx,%eax
+  801e69:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e6c:	5b                   	pop    %ebx
+  801e6d:	5e                   	pop    %esi
+  801e6e:	5d                   	pop    %ebp
+  801e6f:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801e70:	83 ec 04             	sub    $0x4,%esp
+  801e73:	ff 35 10 70 80 00    	push   0x807010
+  801e79:	68 00 70 80 00       	push   $0x807000
+  801e7e:	ff 75 0c             	push   0xc(%ebp)
+  801e81:	e8 e5 eb ff ff       	call   800a6b <memmove>
+		*addrlen = ret->ret_addrlen;
+  801e86:	a1 10 70 80 00       	mov    0x807010,%eax
+  801e8b:	89 06                	mov    %eax,(%esi)
+  801e8d:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801e90:	eb d5                	jmp    801e67 <nsipc_accept+0x27>
+
+00801e92 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801e92:	55                   	push   %ebp
+  801e93:	89 e5                	mov    %esp,%ebp
+  801e95:	53                   	push   %ebx
+  801e96:	83 ec 08             	sub    $0x8,%esp
+  801e99:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801e9c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e9f:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801ea4:	53                   	push   %ebx
+  801ea5:	ff 75 0c             	push   0xc(%ebp)
+  801ea8:	68 04 70 80 00       	push   $0x807004
+  801ead:	e8 b9 eb ff ff       	call   800a6b <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801eb2:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  801eb8:	b8 02 00 00 00       	mov    $0x2,%eax
+  801ebd:	e8 32 ff ff ff       	call   801df4 <nsipc>
+}
+  801ec2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ec5:	c9                   	leave
+  801ec6:	c3                   	ret
+
+00801ec7 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801ec7:	55                   	push   %ebp
+  801ec8:	89 e5                	mov    %esp,%ebp
+  801eca:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801ecd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ed0:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  801ed5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ed8:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  801edd:	b8 03 00 00 00       	mov    $0x3,%eax
+  801ee2:	e8 0d ff ff ff       	call   801df4 <nsipc>
+}
+  801ee7:	c9                   	leave
+  801ee8:	c3                   	ret
+
+00801ee9 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801ee9:	55                   	push   %ebp
+  801eea:	89 e5                	mov    %esp,%ebp
+  801eec:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801eef:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ef2:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  801ef7:	b8 04 00 00 00       	mov    $0x4,%eax
+  801efc:	e8 f3 fe ff ff       	call   801df4 <nsipc>
+}
+  801f01:	c9                   	leave
+  801f02:	c3                   	ret
+
+00801f03 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801f03:	55                   	push   %ebp
+  801f04:	89 e5                	mov    %esp,%ebp
+  801f06:	53                   	push   %ebx
+  801f07:	83 ec 08             	sub    $0x8,%esp
+  801f0a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801f0d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f10:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801f15:	53                   	push   %ebx
+  801f16:	ff 75 0c             	push   0xc(%ebp)
+  801f19:	68 04 70 80 00       	push   $0x807004
+  801f1e:	e8 48 eb ff ff       	call   800a6b <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801f23:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  801f29:	b8 05 00 00 00       	mov    $0x5,%eax
+  801f2e:	e8 c1 fe ff ff       	call   801df4 <nsipc>
+}
+  801f33:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f36:	c9                   	leave
+  801f37:	c3                   	ret
+
+00801f38 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801f38:	55                   	push   %ebp
+  801f39:	89 e5                	mov    %esp,%ebp
+  801f3b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801f3e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f41:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  801f46:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f49:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  801f4e:	b8 06 00 00 00       	mov    $0x6,%eax
+  801f53:	e8 9c fe ff ff       	call   801df4 <nsipc>
+}
+  801f58:	c9                   	leave
+  801f59:	c3                   	ret
+
+00801f5a <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801f5a:	55                   	push   %ebp
+  801f5b:	89 e5                	mov    %esp,%ebp
+  801f5d:	56                   	push   %esi
+  801f5e:	53                   	push   %ebx
+  801f5f:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801f62:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f65:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  801f6a:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  801f70:	8b 45 14             	mov    0x14(%ebp),%eax
+  801f73:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801f78:	b8 07 00 00 00       	mov    $0x7,%eax
+  801f7d:	e8 72 fe ff ff       	call   801df4 <nsipc>
+  801f82:	89 c3                	mov    %eax,%ebx
+  801f84:	85 c0                	test   %eax,%eax
+  801f86:	78 22                	js     801faa <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801f88:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801f8d:	39 c6                	cmp    %eax,%esi
+  801f8f:	0f 4e c6             	cmovle %esi,%eax
+  801f92:	39 c3                	cmp    %eax,%ebx
+  801f94:	7f 1d                	jg     801fb3 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801f96:	83 ec 04             	sub    $0x4,%esp
+  801f99:	53                   	push   %ebx
+  801f9a:	68 00 70 80 00       	push   $0x807000
+  801f9f:	ff 75 0c             	push   0xc(%ebp)
+  801fa2:	e8 c4 ea ff ff       	call   800a6b <memmove>
+  801fa7:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801faa:	89 d8                	mov    %ebx,%eax
+  801fac:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801faf:	5b                   	pop    %ebx
+  801fb0:	5e                   	pop    %esi
+  801fb1:	5d                   	pop    %ebp
+  801fb2:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801fb3:	68 83 30 80 00       	push   $0x803083
+  801fb8:	68 4b 30 80 00       	push   $0x80304b
+  801fbd:	6a 62                	push   $0x62
+  801fbf:	68 98 30 80 00       	push   $0x803098
+  801fc4:	e8 88 e2 ff ff       	call   800251 <_panic>
+
+00801fc9 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801fc9:	55                   	push   %ebp
+  801fca:	89 e5                	mov    %esp,%ebp
+  801fcc:	53                   	push   %ebx
+  801fcd:	83 ec 04             	sub    $0x4,%esp
+  801fd0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801fd3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fd6:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  801fdb:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801fe1:	7f 2e                	jg     802011 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801fe3:	83 ec 04             	sub    $0x4,%esp
+  801fe6:	53                   	push   %ebx
+  801fe7:	ff 75 0c             	push   0xc(%ebp)
+  801fea:	68 0c 70 80 00       	push   $0x80700c
+  801fef:	e8 77 ea ff ff       	call   800a6b <memmove>
+	nsipcbuf.send.req_size = size;
+  801ff4:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  801ffa:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ffd:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  802002:	b8 08 00 00 00       	mov    $0x8,%eax
+  802007:	e8 e8 fd ff ff       	call   801df4 <nsipc>
+}
+  80200c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80200f:	c9                   	leave
+  802010:	c3                   	ret
+	assert(size < 1600);
+  802011:	68 a4 30 80 00       	push   $0x8030a4
+  802016:	68 4b 30 80 00       	push   $0x80304b
+  80201b:	6a 6d                	push   $0x6d
+  80201d:	68 98 30 80 00       	push   $0x803098
+  802022:	e8 2a e2 ff ff       	call   800251 <_panic>
+
+00802027 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802027:	55                   	push   %ebp
+  802028:	89 e5                	mov    %esp,%ebp
+  80202a:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  80202d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802030:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  802035:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802038:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  80203d:	8b 45 10             	mov    0x10(%ebp),%eax
+  802040:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  802045:	b8 09 00 00 00       	mov    $0x9,%eax
+  80204a:	e8 a5 fd ff ff       	call   801df4 <nsipc>
+}
+  80204f:	c9                   	leave
+  802050:	c3                   	ret
+
+00802051 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802051:	55                   	push   %ebp
+  802052:	89 e5                	mov    %esp,%ebp
+  802054:	56                   	push   %esi
+  802055:	53                   	push   %ebx
+  802056:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802059:	83 ec 0c             	sub    $0xc,%esp
+  80205c:	ff 75 08             	push   0x8(%ebp)
+  80205f:	e8 6e f3 ff ff       	call   8013d2 <fd2data>
+  802064:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802066:	83 c4 08             	add    $0x8,%esp
+  802069:	68 b0 30 80 00       	push   $0x8030b0
+  80206e:	53                   	push   %ebx
+  80206f:	e8 71 e8 ff ff       	call   8008e5 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802074:	8b 46 04             	mov    0x4(%esi),%eax
+  802077:	2b 06                	sub    (%esi),%eax
+  802079:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  80207f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802086:	00 00 00 
+	stat->st_dev = &devpipe;
+  802089:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  802090:	40 80 00 
+	return 0;
+}
+  802093:	b8 00 00 00 00       	mov    $0x0,%eax
+  802098:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80209b:	5b                   	pop    %ebx
+  80209c:	5e                   	pop    %esi
+  80209d:	5d                   	pop    %ebp
+  80209e:	c3                   	ret
+
+0080209f <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80209f:	55                   	push   %ebp
+  8020a0:	89 e5                	mov    %esp,%ebp
+  8020a2:	53                   	push   %ebx
+  8020a3:	83 ec 0c             	sub    $0xc,%esp
+  8020a6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8020a9:	53                   	push   %ebx
+  8020aa:	6a 00                	push   $0x0
+  8020ac:	e8 a5 ec ff ff       	call   800d56 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8020b1:	89 1c 24             	mov    %ebx,(%esp)
+  8020b4:	e8 19 f3 ff ff       	call   8013d2 <fd2data>
+  8020b9:	83 c4 08             	add    $0x8,%esp
+  8020bc:	50                   	push   %eax
+  8020bd:	6a 00                	push   $0x0
+  8020bf:	e8 92 ec ff ff       	call   800d56 <sys_page_unmap>
+}
+  8020c4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020c7:	c9                   	leave
+  8020c8:	c3                   	ret
+
+008020c9 <_pipeisclosed>:
+{
+  8020c9:	55                   	push   %ebp
+  8020ca:	89 e5                	mov    %esp,%ebp
+  8020cc:	57                   	push   %edi
+  8020cd:	56                   	push   %esi
+  8020ce:	53                   	push   %ebx
+  8020cf:	83 ec 1c             	sub    $0x1c,%esp
+  8020d2:	89 c7                	mov    %eax,%edi
+  8020d4:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  8020d6:	a1 08 50 80 00       	mov    0x805008,%eax
+  8020db:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8020de:	83 ec 0c             	sub    $0xc,%esp
+  8020e1:	57                   	push   %edi
+  8020e2:	e8 c6 fa ff ff       	call   801bad <pageref>
+  8020e7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8020ea:	89 34 24             	mov    %esi,(%esp)
+  8020ed:	e8 bb fa ff ff       	call   801bad <pageref>
+		nn = thisenv->env_runs;
+  8020f2:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  8020f8:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  8020fb:	83 c4 10             	add    $0x10,%esp
+  8020fe:	39 cb                	cmp    %ecx,%ebx
+  802100:	74 1b                	je     80211d <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802102:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802105:	75 cf                	jne    8020d6 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802107:	8b 42 58             	mov    0x58(%edx),%eax
+  80210a:	6a 01                	push   $0x1
+  80210c:	50                   	push   %eax
+  80210d:	53                   	push   %ebx
+  80210e:	68 b7 30 80 00       	push   $0x8030b7
+  802113:	e8 14 e2 ff ff       	call   80032c <cprintf>
+  802118:	83 c4 10             	add    $0x10,%esp
+  80211b:	eb b9                	jmp    8020d6 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  80211d:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802120:	0f 94 c0             	sete   %al
+  802123:	0f b6 c0             	movzbl %al,%eax
+}
+  802126:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802129:	5b                   	pop    %ebx
+  80212a:	5e                   	pop    %esi
+  80212b:	5f                   	pop    %edi
+  80212c:	5d                   	pop    %ebp
+  80212d:	c3                   	ret
+
+0080212e <devpipe_write>:
+{
+  80212e:	55                   	push   %ebp
+  80212f:	89 e5                	mov    %esp,%ebp
+  802131:	57                   	push   %edi
+  802132:	56                   	push   %esi
+  802133:	53                   	push   %ebx
+  802134:	83 ec 28             	sub    $0x28,%esp
+  802137:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  80213a:	56                   	push   %esi
+  80213b:	e8 92 f2 ff ff       	call   8013d2 <fd2data>
+  802140:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802142:	83 c4 10             	add    $0x10,%esp
+  802145:	bf 00 00 00 00       	mov    $0x0,%edi
+  80214a:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  80214d:	75 09                	jne    802158 <devpipe_write+0x2a>
+	return i;
+  80214f:	89 f8                	mov    %edi,%eax
+  802151:	eb 23                	jmp    802176 <devpipe_write+0x48>
+			sys_yield();
+  802153:	e8 5a eb ff ff       	call   800cb2 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802158:	8b 43 04             	mov    0x4(%ebx),%eax
+  80215b:	8b 0b                	mov    (%ebx),%ecx
+  80215d:	8d 51 20             	lea    0x20(%ecx),%edx
+  802160:	39 d0                	cmp    %edx,%eax
+  802162:	72 1a                	jb     80217e <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802164:	89 da                	mov    %ebx,%edx
+  802166:	89 f0                	mov    %esi,%eax
+  802168:	e8 5c ff ff ff       	call   8020c9 <_pipeisclosed>
+  80216d:	85 c0                	test   %eax,%eax
+  80216f:	74 e2                	je     802153 <devpipe_write+0x25>
+				return 0;
+  802171:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802176:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802179:	5b                   	pop    %ebx
+  80217a:	5e                   	pop    %esi
+  80217b:	5f                   	pop    %edi
+  80217c:	5d                   	pop    %ebp
+  80217d:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80217e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802181:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802185:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802188:	89 c2                	mov    %eax,%edx
+  80218a:	c1 fa 1f             	sar    $0x1f,%edx
+  80218d:	89 d1                	mov    %edx,%ecx
+  80218f:	c1 e9 1b             	shr    $0x1b,%ecx
+  802192:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802195:	83 e2 1f             	and    $0x1f,%edx
+  802198:	29 ca                	sub    %ecx,%edx
+  80219a:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80219e:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8021a2:	83 c0 01             	add    $0x1,%eax
+  8021a5:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8021a8:	83 c7 01             	add    $0x1,%edi
+  8021ab:	eb 9d                	jmp    80214a <devpipe_write+0x1c>
+
+008021ad <devpipe_read>:
+{
+  8021ad:	55                   	push   %ebp
+  8021ae:	89 e5                	mov    %esp,%ebp
+  8021b0:	57                   	push   %edi
+  8021b1:	56                   	push   %esi
+  8021b2:	53                   	push   %ebx
+  8021b3:	83 ec 18             	sub    $0x18,%esp
+  8021b6:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8021b9:	57                   	push   %edi
+  8021ba:	e8 13 f2 ff ff       	call   8013d2 <fd2data>
+  8021bf:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8021c1:	83 c4 10             	add    $0x10,%esp
+  8021c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8021c9:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8021cc:	75 13                	jne    8021e1 <devpipe_read+0x34>
+	return i;
+  8021ce:	89 f0                	mov    %esi,%eax
+  8021d0:	eb 02                	jmp    8021d4 <devpipe_read+0x27>
+				return i;
+  8021d2:	89 f0                	mov    %esi,%eax
+}
+  8021d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021d7:	5b                   	pop    %ebx
+  8021d8:	5e                   	pop    %esi
+  8021d9:	5f                   	pop    %edi
+  8021da:	5d                   	pop    %ebp
+  8021db:	c3                   	ret
+			sys_yield();
+  8021dc:	e8 d1 ea ff ff       	call   800cb2 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  8021e1:	8b 03                	mov    (%ebx),%eax
+  8021e3:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8021e6:	75 18                	jne    802200 <devpipe_read+0x53>
+			if (i > 0)
+  8021e8:	85 f6                	test   %esi,%esi
+  8021ea:	75 e6                	jne    8021d2 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  8021ec:	89 da                	mov    %ebx,%edx
+  8021ee:	89 f8                	mov    %edi,%eax
+  8021f0:	e8 d4 fe ff ff       	call   8020c9 <_pipeisclosed>
+  8021f5:	85 c0                	test   %eax,%eax
+  8021f7:	74 e3                	je     8021dc <devpipe_read+0x2f>
+				return 0;
+  8021f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021fe:	eb d4                	jmp    8021d4 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802200:	99                   	cltd
+  802201:	c1 ea 1b             	shr    $0x1b,%edx
+  802204:	01 d0                	add    %edx,%eax
+  802206:	83 e0 1f             	and    $0x1f,%eax
+  802209:	29 d0                	sub    %edx,%eax
+  80220b:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802210:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802213:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802216:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802219:	83 c6 01             	add    $0x1,%esi
+  80221c:	eb ab                	jmp    8021c9 <devpipe_read+0x1c>
+
+0080221e <pipe>:
+{
+  80221e:	55                   	push   %ebp
+  80221f:	89 e5                	mov    %esp,%ebp
+  802221:	56                   	push   %esi
+  802222:	53                   	push   %ebx
+  802223:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802226:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802229:	50                   	push   %eax
+  80222a:	e8 ba f1 ff ff       	call   8013e9 <fd_alloc>
+  80222f:	89 c3                	mov    %eax,%ebx
+  802231:	83 c4 10             	add    $0x10,%esp
+  802234:	85 c0                	test   %eax,%eax
+  802236:	0f 88 23 01 00 00    	js     80235f <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80223c:	83 ec 04             	sub    $0x4,%esp
+  80223f:	68 07 04 00 00       	push   $0x407
+  802244:	ff 75 f4             	push   -0xc(%ebp)
+  802247:	6a 00                	push   $0x0
+  802249:	e8 83 ea ff ff       	call   800cd1 <sys_page_alloc>
+  80224e:	89 c3                	mov    %eax,%ebx
+  802250:	83 c4 10             	add    $0x10,%esp
+  802253:	85 c0                	test   %eax,%eax
+  802255:	0f 88 04 01 00 00    	js     80235f <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80225b:	83 ec 0c             	sub    $0xc,%esp
+  80225e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802261:	50                   	push   %eax
+  802262:	e8 82 f1 ff ff       	call   8013e9 <fd_alloc>
+  802267:	89 c3                	mov    %eax,%ebx
+  802269:	83 c4 10             	add    $0x10,%esp
+  80226c:	85 c0                	test   %eax,%eax
+  80226e:	0f 88 db 00 00 00    	js     80234f <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802274:	83 ec 04             	sub    $0x4,%esp
+  802277:	68 07 04 00 00       	push   $0x407
+  80227c:	ff 75 f0             	push   -0x10(%ebp)
+  80227f:	6a 00                	push   $0x0
+  802281:	e8 4b ea ff ff       	call   800cd1 <sys_page_alloc>
+  802286:	89 c3                	mov    %eax,%ebx
+  802288:	83 c4 10             	add    $0x10,%esp
+  80228b:	85 c0                	test   %eax,%eax
+  80228d:	0f 88 bc 00 00 00    	js     80234f <pipe+0x131>
+	va = fd2data(fd0);
+  802293:	83 ec 0c             	sub    $0xc,%esp
+  802296:	ff 75 f4             	push   -0xc(%ebp)
+  802299:	e8 34 f1 ff ff       	call   8013d2 <fd2data>
+  80229e:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8022a0:	83 c4 0c             	add    $0xc,%esp
+  8022a3:	68 07 04 00 00       	push   $0x407
+  8022a8:	50                   	push   %eax
+  8022a9:	6a 00                	push   $0x0
+  8022ab:	e8 21 ea ff ff       	call   800cd1 <sys_page_alloc>
+  8022b0:	89 c3                	mov    %eax,%ebx
+  8022b2:	83 c4 10             	add    $0x10,%esp
+  8022b5:	85 c0                	test   %eax,%eax
+  8022b7:	0f 88 82 00 00 00    	js     80233f <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8022bd:	83 ec 0c             	sub    $0xc,%esp
+  8022c0:	ff 75 f0             	push   -0x10(%ebp)
+  8022c3:	e8 0a f1 ff ff       	call   8013d2 <fd2data>
+  8022c8:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8022cf:	50                   	push   %eax
+  8022d0:	6a 00                	push   $0x0
+  8022d2:	56                   	push   %esi
+  8022d3:	6a 00                	push   $0x0
+  8022d5:	e8 3a ea ff ff       	call   800d14 <sys_page_map>
+  8022da:	89 c3                	mov    %eax,%ebx
+  8022dc:	83 c4 20             	add    $0x20,%esp
+  8022df:	85 c0                	test   %eax,%eax
+  8022e1:	78 4e                	js     802331 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8022e3:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  8022e8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8022eb:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8022ed:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8022f0:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8022f7:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8022fa:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8022fc:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8022ff:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802306:	83 ec 0c             	sub    $0xc,%esp
+  802309:	ff 75 f4             	push   -0xc(%ebp)
+  80230c:	e8 b1 f0 ff ff       	call   8013c2 <fd2num>
+  802311:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802314:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802316:	83 c4 04             	add    $0x4,%esp
+  802319:	ff 75 f0             	push   -0x10(%ebp)
+  80231c:	e8 a1 f0 ff ff       	call   8013c2 <fd2num>
+  802321:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802324:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802327:	83 c4 10             	add    $0x10,%esp
+  80232a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80232f:	eb 2e                	jmp    80235f <pipe+0x141>
+	sys_page_unmap(0, va);
+  802331:	83 ec 08             	sub    $0x8,%esp
+  802334:	56                   	push   %esi
+  802335:	6a 00                	push   $0x0
+  802337:	e8 1a ea ff ff       	call   800d56 <sys_page_unmap>
+  80233c:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80233f:	83 ec 08             	sub    $0x8,%esp
+  802342:	ff 75 f0             	push   -0x10(%ebp)
+  802345:	6a 00                	push   $0x0
+  802347:	e8 0a ea ff ff       	call   800d56 <sys_page_unmap>
+  80234c:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80234f:	83 ec 08             	sub    $0x8,%esp
+  802352:	ff 75 f4             	push   -0xc(%ebp)
+  802355:	6a 00                	push   $0x0
+  802357:	e8 fa e9 ff ff       	call   800d56 <sys_page_unmap>
+  80235c:	83 c4 10             	add    $0x10,%esp
+}
+  80235f:	89 d8                	mov    %ebx,%eax
+  802361:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802364:	5b                   	pop    %ebx
+  802365:	5e                   	pop    %esi
+  802366:	5d                   	pop    %ebp
+  802367:	c3                   	ret
+
+00802368 <pipeisclosed>:
+{
+  802368:	55                   	push   %ebp
+  802369:	89 e5                	mov    %esp,%ebp
+  80236b:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80236e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802371:	50                   	push   %eax
+  802372:	ff 75 08             	push   0x8(%ebp)
+  802375:	e8 c5 f0 ff ff       	call   80143f <fd_lookup>
+  80237a:	83 c4 10             	add    $0x10,%esp
+  80237d:	85 c0                	test   %eax,%eax
+  80237f:	78 18                	js     802399 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802381:	83 ec 0c             	sub    $0xc,%esp
+  802384:	ff 75 f4             	push   -0xc(%ebp)
+  802387:	e8 46 f0 ff ff       	call   8013d2 <fd2data>
+  80238c:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80238e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802391:	e8 33 fd ff ff       	call   8020c9 <_pipeisclosed>
+  802396:	83 c4 10             	add    $0x10,%esp
+}
+  802399:	c9                   	leave
+  80239a:	c3                   	ret
+
+0080239b <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80239b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023a0:	c3                   	ret
+
+008023a1 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8023a1:	55                   	push   %ebp
+  8023a2:	89 e5                	mov    %esp,%ebp
+  8023a4:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8023a7:	68 cf 30 80 00       	push   $0x8030cf
+  8023ac:	ff 75 0c             	push   0xc(%ebp)
+  8023af:	e8 31 e5 ff ff       	call   8008e5 <strcpy>
+	return 0;
+}
+  8023b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023b9:	c9                   	leave
+  8023ba:	c3                   	ret
+
+008023bb <devcons_write>:
+{
+  8023bb:	55                   	push   %ebp
+  8023bc:	89 e5                	mov    %esp,%ebp
+  8023be:	57                   	push   %edi
+  8023bf:	56                   	push   %esi
+  8023c0:	53                   	push   %ebx
+  8023c1:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8023c7:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8023cc:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8023d2:	eb 2e                	jmp    802402 <devcons_write+0x47>
+		m = n - tot;
+  8023d4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8023d7:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8023d9:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8023de:	39 c3                	cmp    %eax,%ebx
+  8023e0:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8023e3:	83 ec 04             	sub    $0x4,%esp
+  8023e6:	53                   	push   %ebx
+  8023e7:	89 f0                	mov    %esi,%eax
+  8023e9:	03 45 0c             	add    0xc(%ebp),%eax
+  8023ec:	50                   	push   %eax
+  8023ed:	57                   	push   %edi
+  8023ee:	e8 78 e6 ff ff       	call   800a6b <memmove>
+		sys_cputs(buf, m);
+  8023f3:	83 c4 08             	add    $0x8,%esp
+  8023f6:	53                   	push   %ebx
+  8023f7:	57                   	push   %edi
+  8023f8:	e8 18 e8 ff ff       	call   800c15 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8023fd:	01 de                	add    %ebx,%esi
+  8023ff:	83 c4 10             	add    $0x10,%esp
+  802402:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802405:	72 cd                	jb     8023d4 <devcons_write+0x19>
+}
+  802407:	89 f0                	mov    %esi,%eax
+  802409:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80240c:	5b                   	pop    %ebx
+  80240d:	5e                   	pop    %esi
+  80240e:	5f                   	pop    %edi
+  80240f:	5d                   	pop    %ebp
+  802410:	c3                   	ret
+
+00802411 <devcons_read>:
+{
+  802411:	55                   	push   %ebp
+  802412:	89 e5                	mov    %esp,%ebp
+  802414:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802417:	b8 00 00 00 00       	mov    $0x0,%eax
+  80241c:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802420:	75 07                	jne    802429 <devcons_read+0x18>
+  802422:	eb 1f                	jmp    802443 <devcons_read+0x32>
+		sys_yield();
+  802424:	e8 89 e8 ff ff       	call   800cb2 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802429:	e8 05 e8 ff ff       	call   800c33 <sys_cgetc>
+  80242e:	85 c0                	test   %eax,%eax
+  802430:	74 f2                	je     802424 <devcons_read+0x13>
+	if (c < 0)
+  802432:	78 0f                	js     802443 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802434:	83 f8 04             	cmp    $0x4,%eax
+  802437:	74 0c                	je     802445 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802439:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80243c:	88 02                	mov    %al,(%edx)
+	return 1;
+  80243e:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802443:	c9                   	leave
+  802444:	c3                   	ret
+		return 0;
+  802445:	b8 00 00 00 00       	mov    $0x0,%eax
+  80244a:	eb f7                	jmp    802443 <devcons_read+0x32>
+
+0080244c <cputchar>:
+{
+  80244c:	55                   	push   %ebp
+  80244d:	89 e5                	mov    %esp,%ebp
+  80244f:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802452:	8b 45 08             	mov    0x8(%ebp),%eax
+  802455:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802458:	6a 01                	push   $0x1
+  80245a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80245d:	50                   	push   %eax
+  80245e:	e8 b2 e7 ff ff       	call   800c15 <sys_cputs>
+}
+  802463:	83 c4 10             	add    $0x10,%esp
+  802466:	c9                   	leave
+  802467:	c3                   	ret
+
+00802468 <getchar>:
+{
+  802468:	55                   	push   %ebp
+  802469:	89 e5                	mov    %esp,%ebp
+  80246b:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80246e:	6a 01                	push   $0x1
+  802470:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802473:	50                   	push   %eax
+  802474:	6a 00                	push   $0x0
+  802476:	e8 2a f2 ff ff       	call   8016a5 <read>
+	if (r < 0)
+  80247b:	83 c4 10             	add    $0x10,%esp
+  80247e:	85 c0                	test   %eax,%eax
+  802480:	78 06                	js     802488 <getchar+0x20>
+	if (r < 1)
+  802482:	74 06                	je     80248a <getchar+0x22>
+	return c;
+  802484:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802488:	c9                   	leave
+  802489:	c3                   	ret
+		return -E_EOF;
+  80248a:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80248f:	eb f7                	jmp    802488 <getchar+0x20>
+
+00802491 <iscons>:
+{
+  802491:	55                   	push   %ebp
+  802492:	89 e5                	mov    %esp,%ebp
+  802494:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802497:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80249a:	50                   	push   %eax
+  80249b:	ff 75 08             	push   0x8(%ebp)
+  80249e:	e8 9c ef ff ff       	call   80143f <fd_lookup>
+  8024a3:	83 c4 10             	add    $0x10,%esp
+  8024a6:	85 c0                	test   %eax,%eax
+  8024a8:	78 11                	js     8024bb <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8024aa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024ad:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  8024b3:	39 10                	cmp    %edx,(%eax)
+  8024b5:	0f 94 c0             	sete   %al
+  8024b8:	0f b6 c0             	movzbl %al,%eax
+}
+  8024bb:	c9                   	leave
+  8024bc:	c3                   	ret
+
+008024bd <opencons>:
+{
+  8024bd:	55                   	push   %ebp
+  8024be:	89 e5                	mov    %esp,%ebp
+  8024c0:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8024c3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024c6:	50                   	push   %eax
+  8024c7:	e8 1d ef ff ff       	call   8013e9 <fd_alloc>
+  8024cc:	83 c4 10             	add    $0x10,%esp
+  8024cf:	85 c0                	test   %eax,%eax
+  8024d1:	78 3a                	js     80250d <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8024d3:	83 ec 04             	sub    $0x4,%esp
+  8024d6:	68 07 04 00 00       	push   $0x407
+  8024db:	ff 75 f4             	push   -0xc(%ebp)
+  8024de:	6a 00                	push   $0x0
+  8024e0:	e8 ec e7 ff ff       	call   800cd1 <sys_page_alloc>
+  8024e5:	83 c4 10             	add    $0x10,%esp
+  8024e8:	85 c0                	test   %eax,%eax
+  8024ea:	78 21                	js     80250d <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8024ec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024ef:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  8024f5:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8024f7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024fa:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802501:	83 ec 0c             	sub    $0xc,%esp
+  802504:	50                   	push   %eax
+  802505:	e8 b8 ee ff ff       	call   8013c2 <fd2num>
+  80250a:	83 c4 10             	add    $0x10,%esp
+}
+  80250d:	c9                   	leave
+  80250e:	c3                   	ret
+
+0080250f <set_pgfault_handler>:
+// allocate an exception stack (one page of memory with its top
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf)) {
+  80250f:	55                   	push   %ebp
+  802510:	89 e5                	mov    %esp,%ebp
+  802512:	83 ec 08             	sub    $0x8,%esp
+  int r;
+
+  if (_pgfault_handler == 0) {
+  802515:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  80251c:	74 0a                	je     802528 <set_pgfault_handler+0x19>
+    if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)))
+      panic(" set_pgfault_handler sys_env_set_pgfault_upcall panic: %e\n", r);
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  80251e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802521:	a3 00 80 80 00       	mov    %eax,0x808000
+
+
+}
+  802526:	c9                   	leave
+  802527:	c3                   	ret
+    if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)))
+  802528:	83 ec 04             	sub    $0x4,%esp
+  80252b:	6a 07                	push   $0x7
+  80252d:	68 00 f0 bf ee       	push   $0xeebff000
+  802532:	6a 00                	push   $0x0
+  802534:	e8 98 e7 ff ff       	call   800cd1 <sys_page_alloc>
+  802539:	83 c4 10             	add    $0x10,%esp
+  80253c:	85 c0                	test   %eax,%eax
+  80253e:	75 28                	jne    802568 <set_pgfault_handler+0x59>
+    if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)))
+  802540:	83 ec 08             	sub    $0x8,%esp
+  802543:	68 7a 25 80 00       	push   $0x80257a
+  802548:	6a 00                	push   $0x0
+  80254a:	e8 cd e8 ff ff       	call   800e1c <sys_env_set_pgfault_upcall>
+  80254f:	83 c4 10             	add    $0x10,%esp
+  802552:	85 c0                	test   %eax,%eax
+  802554:	74 c8                	je     80251e <set_pgfault_handler+0xf>
+      panic(" set_pgfault_handler sys_env_set_pgfault_upcall panic: %e\n", r);
+  802556:	50                   	push   %eax
+  802557:	68 0c 31 80 00       	push   $0x80310c
+  80255c:	6a 22                	push   $0x22
+  80255e:	68 47 31 80 00       	push   $0x803147
+  802563:	e8 e9 dc ff ff       	call   800251 <_panic>
+      panic("set_pgfault_handler sys_page_alloc panic: %e\n", r);
+  802568:	50                   	push   %eax
+  802569:	68 dc 30 80 00       	push   $0x8030dc
+  80256e:	6a 20                	push   $0x20
+  802570:	68 47 31 80 00       	push   $0x803147
+  802575:	e8 d7 dc ff ff       	call   800251 <_panic>
+
+0080257a <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80257a:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80257b:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  802580:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  802582:	83 c4 04             	add    $0x4,%esp
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	// push the trap-time %eip onto the trap-time stack
+    subl $0x4, 0x30(%esp) # for push eip
+  802585:	83 6c 24 30 04       	subl   $0x4,0x30(%esp)
+    movl 0x30(%esp), %ebx #regular esp
+  80258a:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+    movl 0x28(%esp), %eax #eip
+  80258e:	8b 44 24 28          	mov    0x28(%esp),%eax
+    movl %eax, (%ebx)
+  802592:	89 03                	mov    %eax,(%ebx)
+
+    // Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+    addl $8, %esp
+  802594:	83 c4 08             	add    $0x8,%esp
+    popal
+  802597:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  802598:	83 c4 04             	add    $0x4,%esp
+	popfl
+  80259b:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  80259c:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  80259d:	c3                   	ret
+  80259e:	66 90                	xchg   %ax,%ax
+
+008025a0 <__udivmoddi4>:
+  8025a0:	55                   	push   %ebp
+  8025a1:	57                   	push   %edi
+  8025a2:	56                   	push   %esi
+  8025a3:	53                   	push   %ebx
+  8025a4:	83 ec 24             	sub    $0x24,%esp
+  8025a7:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8025ab:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8025af:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  8025b3:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8025b7:	8b 54 24 44          	mov    0x44(%esp),%edx
+  8025bb:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8025bf:	8b 44 24 40          	mov    0x40(%esp),%eax
+  8025c3:	89 d3                	mov    %edx,%ebx
+  8025c5:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8025c9:	09 c3                	or     %eax,%ebx
+  8025cb:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8025cf:	0f 84 9c 00 00 00    	je     802671 <__udivmoddi4+0xd1>
+  8025d5:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8025dc:	00 
+  8025dd:	31 c0                	xor    %eax,%eax
+  8025df:	31 d2                	xor    %edx,%edx
+  8025e1:	89 fb                	mov    %edi,%ebx
+  8025e3:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8025ea:	00 
+  8025eb:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8025f0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8025f4:	01 c0                	add    %eax,%eax
+  8025f6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8025fd:	00 
+  8025fe:	89 c6                	mov    %eax,%esi
+  802600:	89 d7                	mov    %edx,%edi
+  802602:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802606:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80260a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80260d:	d3 ea                	shr    %cl,%edx
+  80260f:	f6 c1 20             	test   $0x20,%cl
+  802612:	0f 45 c2             	cmovne %edx,%eax
+  802615:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802619:	83 e0 01             	and    $0x1,%eax
+  80261c:	09 fa                	or     %edi,%edx
+  80261e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802622:	89 04 24             	mov    %eax,(%esp)
+  802625:	8b 04 24             	mov    (%esp),%eax
+  802628:	89 d5                	mov    %edx,%ebp
+  80262a:	09 f0                	or     %esi,%eax
+  80262c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802630:	39 f0                	cmp    %esi,%eax
+  802632:	19 fd                	sbb    %edi,%ebp
+  802634:	72 1d                	jb     802653 <__udivmoddi4+0xb3>
+  802636:	29 f0                	sub    %esi,%eax
+  802638:	19 fa                	sbb    %edi,%edx
+  80263a:	89 cf                	mov    %ecx,%edi
+  80263c:	c1 ef 05             	shr    $0x5,%edi
+  80263f:	83 e7 01             	and    $0x1,%edi
+  802642:	89 fe                	mov    %edi,%esi
+  802644:	d3 e7                	shl    %cl,%edi
+  802646:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80264a:	83 f6 01             	xor    $0x1,%esi
+  80264d:	d3 e6                	shl    %cl,%esi
+  80264f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802653:	83 e9 01             	sub    $0x1,%ecx
+  802656:	73 98                	jae    8025f0 <__udivmoddi4+0x50>
+  802658:	85 db                	test   %ebx,%ebx
+  80265a:	74 05                	je     802661 <__udivmoddi4+0xc1>
+  80265c:	89 03                	mov    %eax,(%ebx)
+  80265e:	89 53 04             	mov    %edx,0x4(%ebx)
+  802661:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802665:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802669:	83 c4 24             	add    $0x24,%esp
+  80266c:	5b                   	pop    %ebx
+  80266d:	5e                   	pop    %esi
+  80266e:	5f                   	pop    %edi
+  80266f:	5d                   	pop    %ebp
+  802670:	c3                   	ret
+  802671:	85 ff                	test   %edi,%edi
+  802673:	74 0d                	je     802682 <__udivmoddi4+0xe2>
+  802675:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  80267b:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  802682:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802686:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80268a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80268e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802692:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802696:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80269a:	83 c4 24             	add    $0x24,%esp
+  80269d:	5b                   	pop    %ebx
+  80269e:	5e                   	pop    %esi
+  80269f:	5f                   	pop    %edi
+  8026a0:	5d                   	pop    %ebp
+  8026a1:	c3                   	ret
+  8026a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8026a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+008026b0 <__udivdi3>:
+  8026b0:	57                   	push   %edi
+  8026b1:	56                   	push   %esi
+  8026b2:	53                   	push   %ebx
+  8026b3:	83 ec 20             	sub    $0x20,%esp
+  8026b6:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8026ba:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8026be:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8026c2:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8026c6:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8026ca:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8026ce:	89 d1                	mov    %edx,%ecx
+  8026d0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8026d4:	09 c1                	or     %eax,%ecx
+  8026d6:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8026da:	89 44 24 18          	mov    %eax,0x18(%esp)
+  8026de:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  8026e2:	0f 84 88 00 00 00    	je     802770 <__udivdi3+0xc0>
+  8026e8:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8026ef:	00 
+  8026f0:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8026f5:	31 c0                	xor    %eax,%eax
+  8026f7:	31 d2                	xor    %edx,%edx
+  8026f9:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802700:	00 
+  802701:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802708:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80270c:	01 c0                	add    %eax,%eax
+  80270e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802715:	00 
+  802716:	89 c6                	mov    %eax,%esi
+  802718:	89 d7                	mov    %edx,%edi
+  80271a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80271e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802722:	0f ad d0             	shrd   %cl,%edx,%eax
+  802725:	d3 ea                	shr    %cl,%edx
+  802727:	f6 c1 20             	test   $0x20,%cl
+  80272a:	0f 45 c2             	cmovne %edx,%eax
+  80272d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802731:	83 e0 01             	and    $0x1,%eax
+  802734:	09 fa                	or     %edi,%edx
+  802736:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80273a:	89 04 24             	mov    %eax,(%esp)
+  80273d:	8b 04 24             	mov    (%esp),%eax
+  802740:	89 d3                	mov    %edx,%ebx
+  802742:	09 f0                	or     %esi,%eax
+  802744:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802748:	39 f0                	cmp    %esi,%eax
+  80274a:	19 fb                	sbb    %edi,%ebx
+  80274c:	72 1d                	jb     80276b <__udivdi3+0xbb>
+  80274e:	29 f0                	sub    %esi,%eax
+  802750:	19 fa                	sbb    %edi,%edx
+  802752:	89 cf                	mov    %ecx,%edi
+  802754:	c1 ef 05             	shr    $0x5,%edi
+  802757:	83 e7 01             	and    $0x1,%edi
+  80275a:	89 fe                	mov    %edi,%esi
+  80275c:	d3 e7                	shl    %cl,%edi
+  80275e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802762:	83 f6 01             	xor    $0x1,%esi
+  802765:	d3 e6                	shl    %cl,%esi
+  802767:	09 74 24 18          	or     %esi,0x18(%esp)
+  80276b:	83 e9 01             	sub    $0x1,%ecx
+  80276e:	73 98                	jae    802708 <__udivdi3+0x58>
+  802770:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802774:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802778:	83 c4 20             	add    $0x20,%esp
+  80277b:	5b                   	pop    %ebx
+  80277c:	5e                   	pop    %esi
+  80277d:	5f                   	pop    %edi
+  80277e:	c3                   	ret
+  80277f:	90                   	nop
+
+00802780 <__umoddi3>:
+  802780:	57                   	push   %edi
+  802781:	56                   	push   %esi
+  802782:	53                   	push   %ebx
+  802783:	83 ec 18             	sub    $0x18,%esp
+  802786:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80278a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80278e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802792:	8b 54 24 34          	mov    0x34(%esp),%edx
+  802796:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80279a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80279e:	89 d1                	mov    %edx,%ecx
+  8027a0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8027a4:	09 c1                	or     %eax,%ecx
+  8027a6:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8027aa:	74 5b                	je     802807 <__umoddi3+0x87>
+  8027ac:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8027b1:	31 c0                	xor    %eax,%eax
+  8027b3:	31 d2                	xor    %edx,%edx
+  8027b5:	8d 76 00             	lea    0x0(%esi),%esi
+  8027b8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8027bc:	01 c0                	add    %eax,%eax
+  8027be:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8027c5:	00 
+  8027c6:	89 c6                	mov    %eax,%esi
+  8027c8:	89 d7                	mov    %edx,%edi
+  8027ca:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8027ce:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8027d2:	0f ad d0             	shrd   %cl,%edx,%eax
+  8027d5:	d3 ea                	shr    %cl,%edx
+  8027d7:	f6 c1 20             	test   $0x20,%cl
+  8027da:	0f 45 c2             	cmovne %edx,%eax
+  8027dd:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8027e1:	83 e0 01             	and    $0x1,%eax
+  8027e4:	09 fa                	or     %edi,%edx
+  8027e6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8027ea:	89 04 24             	mov    %eax,(%esp)
+  8027ed:	8b 04 24             	mov    (%esp),%eax
+  8027f0:	89 d3                	mov    %edx,%ebx
+  8027f2:	09 f0                	or     %esi,%eax
+  8027f4:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8027f8:	39 f0                	cmp    %esi,%eax
+  8027fa:	19 fb                	sbb    %edi,%ebx
+  8027fc:	72 04                	jb     802802 <__umoddi3+0x82>
+  8027fe:	29 f0                	sub    %esi,%eax
+  802800:	19 fa                	sbb    %edi,%edx
+  802802:	83 e9 01             	sub    $0x1,%ecx
+  802805:	73 b1                	jae    8027b8 <__umoddi3+0x38>
+  802807:	83 c4 18             	add    $0x18,%esp
+  80280a:	5b                   	pop    %ebx
+  80280b:	5e                   	pop    %esi
+  80280c:	5f                   	pop    %edi
+  80280d:	c3                   	ret
+  80280e:	66 90                	xchg   %ax,%ax
+
+00802810 <__divdi3>:
+  802810:	55                   	push   %ebp
+  802811:	57                   	push   %edi
+  802812:	56                   	push   %esi
+  802813:	53                   	push   %ebx
+  802814:	83 ec 24             	sub    $0x24,%esp
+  802817:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  80281b:	8b 74 24 44          	mov    0x44(%esp),%esi
+  80281f:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802823:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802827:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  80282b:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  80282f:	85 d2                	test   %edx,%edx
+  802831:	0f 88 e0 00 00 00    	js     802917 <__divdi3+0x107>
+  802837:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  80283b:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  80283f:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802843:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802847:	85 f6                	test   %esi,%esi
+  802849:	78 16                	js     802861 <__divdi3+0x51>
+  80284b:	89 f1                	mov    %esi,%ecx
+  80284d:	31 c0                	xor    %eax,%eax
+  80284f:	31 d2                	xor    %edx,%edx
+  802851:	09 d9                	or     %ebx,%ecx
+  802853:	0f 85 f3 00 00 00    	jne    80294c <__divdi3+0x13c>
+  802859:	83 c4 24             	add    $0x24,%esp
+  80285c:	5b                   	pop    %ebx
+  80285d:	5e                   	pop    %esi
+  80285e:	5f                   	pop    %edi
+  80285f:	5d                   	pop    %ebp
+  802860:	c3                   	ret
+  802861:	bf 01 00 00 00       	mov    $0x1,%edi
+  802866:	f7 5c 24 08          	negl   0x8(%esp)
+  80286a:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  80286f:	f7 5c 24 0c          	negl   0xc(%esp)
+  802873:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80287a:	00 
+  80287b:	31 c0                	xor    %eax,%eax
+  80287d:	31 d2                	xor    %edx,%edx
+  80287f:	89 fb                	mov    %edi,%ebx
+  802881:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802888:	00 
+  802889:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80288e:	66 90                	xchg   %ax,%ax
+  802890:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802894:	01 c0                	add    %eax,%eax
+  802896:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80289d:	00 
+  80289e:	89 c6                	mov    %eax,%esi
+  8028a0:	89 d7                	mov    %edx,%edi
+  8028a2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8028a6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8028aa:	0f ad d0             	shrd   %cl,%edx,%eax
+  8028ad:	d3 ea                	shr    %cl,%edx
+  8028af:	f6 c1 20             	test   $0x20,%cl
+  8028b2:	0f 45 c2             	cmovne %edx,%eax
+  8028b5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8028b9:	83 e0 01             	and    $0x1,%eax
+  8028bc:	09 fa                	or     %edi,%edx
+  8028be:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8028c2:	89 04 24             	mov    %eax,(%esp)
+  8028c5:	8b 04 24             	mov    (%esp),%eax
+  8028c8:	89 d5                	mov    %edx,%ebp
+  8028ca:	09 f0                	or     %esi,%eax
+  8028cc:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8028d0:	39 f0                	cmp    %esi,%eax
+  8028d2:	19 fd                	sbb    %edi,%ebp
+  8028d4:	72 1d                	jb     8028f3 <__divdi3+0xe3>
+  8028d6:	29 f0                	sub    %esi,%eax
+  8028d8:	19 fa                	sbb    %edi,%edx
+  8028da:	89 cf                	mov    %ecx,%edi
+  8028dc:	c1 ef 05             	shr    $0x5,%edi
+  8028df:	83 e7 01             	and    $0x1,%edi
+  8028e2:	89 fe                	mov    %edi,%esi
+  8028e4:	d3 e7                	shl    %cl,%edi
+  8028e6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8028ea:	83 f6 01             	xor    $0x1,%esi
+  8028ed:	d3 e6                	shl    %cl,%esi
+  8028ef:	09 74 24 18          	or     %esi,0x18(%esp)
+  8028f3:	83 e9 01             	sub    $0x1,%ecx
+  8028f6:	73 98                	jae    802890 <__divdi3+0x80>
+  8028f8:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8028fc:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802900:	85 db                	test   %ebx,%ebx
+  802902:	0f 84 51 ff ff ff    	je     802859 <__divdi3+0x49>
+  802908:	f7 d8                	neg    %eax
+  80290a:	83 d2 00             	adc    $0x0,%edx
+  80290d:	83 c4 24             	add    $0x24,%esp
+  802910:	5b                   	pop    %ebx
+  802911:	f7 da                	neg    %edx
+  802913:	5e                   	pop    %esi
+  802914:	5f                   	pop    %edi
+  802915:	5d                   	pop    %ebp
+  802916:	c3                   	ret
+  802917:	f7 d8                	neg    %eax
+  802919:	83 d2 00             	adc    $0x0,%edx
+  80291c:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802920:	f7 da                	neg    %edx
+  802922:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802926:	85 f6                	test   %esi,%esi
+  802928:	78 1b                	js     802945 <__divdi3+0x135>
+  80292a:	89 f1                	mov    %esi,%ecx
+  80292c:	31 c0                	xor    %eax,%eax
+  80292e:	31 d2                	xor    %edx,%edx
+  802930:	bf 01 00 00 00       	mov    $0x1,%edi
+  802935:	09 d9                	or     %ebx,%ecx
+  802937:	0f 85 36 ff ff ff    	jne    802873 <__divdi3+0x63>
+  80293d:	83 c4 24             	add    $0x24,%esp
+  802940:	5b                   	pop    %ebx
+  802941:	5e                   	pop    %esi
+  802942:	5f                   	pop    %edi
+  802943:	5d                   	pop    %ebp
+  802944:	c3                   	ret
+  802945:	31 ff                	xor    %edi,%edi
+  802947:	e9 1a ff ff ff       	jmp    802866 <__divdi3+0x56>
+  80294c:	31 ff                	xor    %edi,%edi
+  80294e:	e9 20 ff ff ff       	jmp    802873 <__divdi3+0x63>
+  802953:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80295a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00802960 <__moddi3>:
+  802960:	55                   	push   %ebp
+  802961:	57                   	push   %edi
+  802962:	56                   	push   %esi
+  802963:	53                   	push   %ebx
+  802964:	83 ec 1c             	sub    $0x1c,%esp
+  802967:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  80296b:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  80296f:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  802973:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  802977:	89 c8                	mov    %ecx,%eax
+  802979:	89 f2                	mov    %esi,%edx
+  80297b:	89 f3                	mov    %esi,%ebx
+  80297d:	85 ed                	test   %ebp,%ebp
+  80297f:	0f 88 9d 00 00 00    	js     802a22 <__moddi3+0xc2>
+  802985:	09 cb                	or     %ecx,%ebx
+  802987:	0f 84 8d 00 00 00    	je     802a1a <__moddi3+0xba>
+  80298d:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802991:	31 db                	xor    %ebx,%ebx
+  802993:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802997:	89 ca                	mov    %ecx,%edx
+  802999:	89 f0                	mov    %esi,%eax
+  80299b:	89 dd                	mov    %ebx,%ebp
+  80299d:	f7 da                	neg    %edx
+  80299f:	83 d0 00             	adc    $0x0,%eax
+  8029a2:	f7 d8                	neg    %eax
+  8029a4:	0f 49 f0             	cmovns %eax,%esi
+  8029a7:	0f 49 ca             	cmovns %edx,%ecx
+  8029aa:	31 c0                	xor    %eax,%eax
+  8029ac:	31 d2                	xor    %edx,%edx
+  8029ae:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8029b2:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  8029b6:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8029bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  8029bf:	90                   	nop
+  8029c0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8029c4:	01 c0                	add    %eax,%eax
+  8029c6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8029cd:	00 
+  8029ce:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  8029d2:	89 c6                	mov    %eax,%esi
+  8029d4:	89 d7                	mov    %edx,%edi
+  8029d6:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8029da:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8029de:	0f ad d0             	shrd   %cl,%edx,%eax
+  8029e1:	d3 ea                	shr    %cl,%edx
+  8029e3:	f6 c1 20             	test   $0x20,%cl
+  8029e6:	0f 45 c2             	cmovne %edx,%eax
+  8029e9:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8029ed:	83 e0 01             	and    $0x1,%eax
+  8029f0:	09 fa                	or     %edi,%edx
+  8029f2:	89 04 24             	mov    %eax,(%esp)
+  8029f5:	8b 04 24             	mov    (%esp),%eax
+  8029f8:	89 d7                	mov    %edx,%edi
+  8029fa:	09 f0                	or     %esi,%eax
+  8029fc:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  802a00:	39 d8                	cmp    %ebx,%eax
+  802a02:	19 f7                	sbb    %esi,%edi
+  802a04:	72 04                	jb     802a0a <__moddi3+0xaa>
+  802a06:	29 d8                	sub    %ebx,%eax
+  802a08:	19 f2                	sbb    %esi,%edx
+  802a0a:	83 e9 01             	sub    $0x1,%ecx
+  802a0d:	73 b1                	jae    8029c0 <__moddi3+0x60>
+  802a0f:	85 ed                	test   %ebp,%ebp
+  802a11:	74 07                	je     802a1a <__moddi3+0xba>
+  802a13:	f7 d8                	neg    %eax
+  802a15:	83 d2 00             	adc    $0x0,%edx
+  802a18:	f7 da                	neg    %edx
+  802a1a:	83 c4 1c             	add    $0x1c,%esp
+  802a1d:	5b                   	pop    %ebx
+  802a1e:	5e                   	pop    %esi
+  802a1f:	5f                   	pop    %edi
+  802a20:	5d                   	pop    %ebp
+  802a21:	c3                   	ret
+  802a22:	09 cb                	or     %ecx,%ebx
+  802a24:	74 f4                	je     802a1a <__moddi3+0xba>
+  802a26:	f7 df                	neg    %edi
+  802a28:	bb 01 00 00 00       	mov    $0x1,%ebx
+  802a2d:	83 d5 00             	adc    $0x0,%ebp
+  802a30:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802a34:	f7 dd                	neg    %ebp
+  802a36:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802a3a:	e9 58 ff ff ff       	jmp    802997 <__moddi3+0x37>
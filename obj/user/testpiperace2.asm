@@ -0,0 +1,5874 @@
+
+obj/user/testpiperace2.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 a1 01 00 00       	call   8001d2 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 28             	sub    $0x28,%esp
+	int p[2], r, i;
+	struct Fd *fd;
+	const volatile struct Env *kid;
+
+	cprintf("testing for pipeisclosed race...\n");
+  80003c:	68 40 2a 80 00       	push   $0x802a40
+  800041:	e8 ca 02 00 00       	call   800310 <cprintf>
+	if ((r = pipe(p)) < 0)
+  800046:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800049:	89 04 24             	mov    %eax,(%esp)
+  80004c:	e8 6e 20 00 00       	call   8020bf <pipe>
+  800051:	83 c4 10             	add    $0x10,%esp
+  800054:	85 c0                	test   %eax,%eax
+  800056:	78 5d                	js     8000b5 <umain+0x82>
+		panic("pipe: %e", r);
+	if ((r = fork()) < 0)
+  800058:	e8 26 10 00 00       	call   801083 <fork>
+  80005d:	89 c7                	mov    %eax,%edi
+  80005f:	85 c0                	test   %eax,%eax
+  800061:	78 64                	js     8000c7 <umain+0x94>
+		panic("fork: %e", r);
+	if (r == 0) {
+  800063:	74 74                	je     8000d9 <umain+0xa6>
+	// pageref(p[0]) and gets 3, then it will return true when
+	// it shouldn't.
+	//
+	// So either way, pipeisclosed is going give a wrong answer.
+	//
+	kid = &envs[ENVX(r)];
+  800065:	89 f8                	mov    %edi,%eax
+  800067:	25 ff 03 00 00       	and    $0x3ff,%eax
+	while (kid->env_status == ENV_RUNNABLE)
+  80006c:	8d 1c c0             	lea    (%eax,%eax,8),%ebx
+  80006f:	c1 e3 04             	shl    $0x4,%ebx
+  800072:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  800078:	8b 43 54             	mov    0x54(%ebx),%eax
+  80007b:	83 f8 02             	cmp    $0x2,%eax
+  80007e:	0f 85 d1 00 00 00    	jne    800155 <umain+0x122>
+		if (pipeisclosed(p[0]) != 0) {
+  800084:	83 ec 0c             	sub    $0xc,%esp
+  800087:	ff 75 e0             	push   -0x20(%ebp)
+  80008a:	e8 7a 21 00 00       	call   802209 <pipeisclosed>
+  80008f:	83 c4 10             	add    $0x10,%esp
+  800092:	85 c0                	test   %eax,%eax
+  800094:	74 e2                	je     800078 <umain+0x45>
+			cprintf("\nRACE: pipe appears closed\n");
+  800096:	83 ec 0c             	sub    $0xc,%esp
+  800099:	68 b9 2a 80 00       	push   $0x802ab9
+  80009e:	e8 6d 02 00 00       	call   800310 <cprintf>
+			sys_env_destroy(r);
+  8000a3:	89 3c 24             	mov    %edi,(%esp)
+  8000a6:	e8 8b 0b 00 00       	call   800c36 <sys_env_destroy>
+			exit();
+  8000ab:	e8 6b 01 00 00       	call   80021b <exit>
+  8000b0:	83 c4 10             	add    $0x10,%esp
+  8000b3:	eb c3                	jmp    800078 <umain+0x45>
+		panic("pipe: %e", r);
+  8000b5:	50                   	push   %eax
+  8000b6:	68 8e 2a 80 00       	push   $0x802a8e
+  8000bb:	6a 0d                	push   $0xd
+  8000bd:	68 97 2a 80 00       	push   $0x802a97
+  8000c2:	e8 6e 01 00 00       	call   800235 <_panic>
+		panic("fork: %e", r);
+  8000c7:	50                   	push   %eax
+  8000c8:	68 ac 2a 80 00       	push   $0x802aac
+  8000cd:	6a 0f                	push   $0xf
+  8000cf:	68 97 2a 80 00       	push   $0x802a97
+  8000d4:	e8 5c 01 00 00       	call   800235 <_panic>
+		close(p[1]);
+  8000d9:	83 ec 0c             	sub    $0xc,%esp
+  8000dc:	ff 75 e4             	push   -0x1c(%ebp)
+  8000df:	e8 62 13 00 00       	call   801446 <close>
+  8000e4:	83 c4 10             	add    $0x10,%esp
+		for (i = 0; i < 200; i++) {
+  8000e7:	89 fb                	mov    %edi,%ebx
+			if (i % 10 == 0)
+  8000e9:	be 67 66 66 66       	mov    $0x66666667,%esi
+  8000ee:	eb 31                	jmp    800121 <umain+0xee>
+			dup(p[0], 10);
+  8000f0:	83 ec 08             	sub    $0x8,%esp
+  8000f3:	6a 0a                	push   $0xa
+  8000f5:	ff 75 e0             	push   -0x20(%ebp)
+  8000f8:	e8 9b 13 00 00       	call   801498 <dup>
+			sys_yield();
+  8000fd:	e8 94 0b 00 00       	call   800c96 <sys_yield>
+			close(10);
+  800102:	c7 04 24 0a 00 00 00 	movl   $0xa,(%esp)
+  800109:	e8 38 13 00 00       	call   801446 <close>
+			sys_yield();
+  80010e:	e8 83 0b 00 00       	call   800c96 <sys_yield>
+		for (i = 0; i < 200; i++) {
+  800113:	83 c3 01             	add    $0x1,%ebx
+  800116:	83 c4 10             	add    $0x10,%esp
+  800119:	81 fb c8 00 00 00    	cmp    $0xc8,%ebx
+  80011f:	74 2a                	je     80014b <umain+0x118>
+			if (i % 10 == 0)
+  800121:	89 d8                	mov    %ebx,%eax
+  800123:	f7 ee                	imul   %esi
+  800125:	c1 fa 02             	sar    $0x2,%edx
+  800128:	89 d8                	mov    %ebx,%eax
+  80012a:	c1 f8 1f             	sar    $0x1f,%eax
+  80012d:	29 c2                	sub    %eax,%edx
+  80012f:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  800132:	01 c0                	add    %eax,%eax
+  800134:	39 c3                	cmp    %eax,%ebx
+  800136:	75 b8                	jne    8000f0 <umain+0xbd>
+				cprintf("%d.", i);
+  800138:	83 ec 08             	sub    $0x8,%esp
+  80013b:	53                   	push   %ebx
+  80013c:	68 b5 2a 80 00       	push   $0x802ab5
+  800141:	e8 ca 01 00 00       	call   800310 <cprintf>
+  800146:	83 c4 10             	add    $0x10,%esp
+  800149:	eb a5                	jmp    8000f0 <umain+0xbd>
+		exit();
+  80014b:	e8 cb 00 00 00       	call   80021b <exit>
+  800150:	e9 10 ff ff ff       	jmp    800065 <umain+0x32>
+		}
+	cprintf("child done with loop\n");
+  800155:	83 ec 0c             	sub    $0xc,%esp
+  800158:	68 d5 2a 80 00       	push   $0x802ad5
+  80015d:	e8 ae 01 00 00       	call   800310 <cprintf>
+	if (pipeisclosed(p[0]))
+  800162:	83 c4 04             	add    $0x4,%esp
+  800165:	ff 75 e0             	push   -0x20(%ebp)
+  800168:	e8 9c 20 00 00       	call   802209 <pipeisclosed>
+  80016d:	83 c4 10             	add    $0x10,%esp
+  800170:	85 c0                	test   %eax,%eax
+  800172:	75 38                	jne    8001ac <umain+0x179>
+		panic("somehow the other end of p[0] got closed!");
+	if ((r = fd_lookup(p[0], &fd)) < 0)
+  800174:	83 ec 08             	sub    $0x8,%esp
+  800177:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  80017a:	50                   	push   %eax
+  80017b:	ff 75 e0             	push   -0x20(%ebp)
+  80017e:	e8 99 11 00 00       	call   80131c <fd_lookup>
+  800183:	83 c4 10             	add    $0x10,%esp
+  800186:	85 c0                	test   %eax,%eax
+  800188:	78 36                	js     8001c0 <umain+0x18d>
+		panic("cannot look up p[0]: %e", r);
+	(void) fd2data(fd);
+  80018a:	83 ec 0c             	sub    $0xc,%esp
+  80018d:	ff 75 dc             	push   -0x24(%ebp)
+  800190:	e8 1a 11 00 00       	call   8012af <fd2data>
+	cprintf("race didn't happen\n");
+  800195:	c7 04 24 03 2b 80 00 	movl   $0x802b03,(%esp)
+  80019c:	e8 6f 01 00 00       	call   800310 <cprintf>
+}
+  8001a1:	83 c4 10             	add    $0x10,%esp
+  8001a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001a7:	5b                   	pop    %ebx
+  8001a8:	5e                   	pop    %esi
+  8001a9:	5f                   	pop    %edi
+  8001aa:	5d                   	pop    %ebp
+  8001ab:	c3                   	ret
+		panic("somehow the other end of p[0] got closed!");
+  8001ac:	83 ec 04             	sub    $0x4,%esp
+  8001af:	68 64 2a 80 00       	push   $0x802a64
+  8001b4:	6a 40                	push   $0x40
+  8001b6:	68 97 2a 80 00       	push   $0x802a97
+  8001bb:	e8 75 00 00 00       	call   800235 <_panic>
+		panic("cannot look up p[0]: %e", r);
+  8001c0:	50                   	push   %eax
+  8001c1:	68 eb 2a 80 00       	push   $0x802aeb
+  8001c6:	6a 42                	push   $0x42
+  8001c8:	68 97 2a 80 00       	push   $0x802a97
+  8001cd:	e8 63 00 00 00       	call   800235 <_panic>
+
+008001d2 <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  8001d2:	55                   	push   %ebp
+  8001d3:	89 e5                	mov    %esp,%ebp
+  8001d5:	56                   	push   %esi
+  8001d6:	53                   	push   %ebx
+  8001d7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001da:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  8001dd:	e8 95 0a 00 00       	call   800c77 <sys_getenvid>
+  8001e2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001e7:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8001ea:	c1 e0 04             	shl    $0x4,%eax
+  8001ed:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001f2:	a3 08 50 80 00       	mov    %eax,0x805008
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8001f7:	85 db                	test   %ebx,%ebx
+  8001f9:	7e 07                	jle    800202 <libmain+0x30>
+    binaryname = argv[0];
+  8001fb:	8b 06                	mov    (%esi),%eax
+  8001fd:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  800202:	83 ec 08             	sub    $0x8,%esp
+  800205:	56                   	push   %esi
+  800206:	53                   	push   %ebx
+  800207:	e8 27 fe ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  80020c:	e8 0a 00 00 00       	call   80021b <exit>
+}
+  800211:	83 c4 10             	add    $0x10,%esp
+  800214:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800217:	5b                   	pop    %ebx
+  800218:	5e                   	pop    %esi
+  800219:	5d                   	pop    %ebp
+  80021a:	c3                   	ret
+
+0080021b <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80021b:	55                   	push   %ebp
+  80021c:	89 e5                	mov    %esp,%ebp
+  80021e:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800221:	e8 4d 12 00 00       	call   801473 <close_all>
+	sys_env_destroy(0);
+  800226:	83 ec 0c             	sub    $0xc,%esp
+  800229:	6a 00                	push   $0x0
+  80022b:	e8 06 0a 00 00       	call   800c36 <sys_env_destroy>
+}
+  800230:	83 c4 10             	add    $0x10,%esp
+  800233:	c9                   	leave
+  800234:	c3                   	ret
+
+00800235 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800235:	55                   	push   %ebp
+  800236:	89 e5                	mov    %esp,%ebp
+  800238:	56                   	push   %esi
+  800239:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80023a:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80023d:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800243:	e8 2f 0a 00 00       	call   800c77 <sys_getenvid>
+  800248:	83 ec 0c             	sub    $0xc,%esp
+  80024b:	ff 75 0c             	push   0xc(%ebp)
+  80024e:	ff 75 08             	push   0x8(%ebp)
+  800251:	56                   	push   %esi
+  800252:	50                   	push   %eax
+  800253:	68 24 2b 80 00       	push   $0x802b24
+  800258:	e8 b3 00 00 00       	call   800310 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80025d:	83 c4 18             	add    $0x18,%esp
+  800260:	53                   	push   %ebx
+  800261:	ff 75 10             	push   0x10(%ebp)
+  800264:	e8 56 00 00 00       	call   8002bf <vcprintf>
+	cprintf("\n");
+  800269:	c7 04 24 90 30 80 00 	movl   $0x803090,(%esp)
+  800270:	e8 9b 00 00 00       	call   800310 <cprintf>
+  800275:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800278:	cc                   	int3
+	while (1)
+  800279:	eb fd                	jmp    800278 <_panic+0x43>
+
+0080027b <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80027b:	55                   	push   %ebp
+  80027c:	89 e5                	mov    %esp,%ebp
+  80027e:	53                   	push   %ebx
+  80027f:	83 ec 04             	sub    $0x4,%esp
+  800282:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800285:	8b 13                	mov    (%ebx),%edx
+  800287:	8d 42 01             	lea    0x1(%edx),%eax
+  80028a:	89 03                	mov    %eax,(%ebx)
+  80028c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80028f:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800293:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800298:	74 09                	je     8002a3 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80029a:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80029e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8002a1:	c9                   	leave
+  8002a2:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8002a3:	83 ec 08             	sub    $0x8,%esp
+  8002a6:	68 ff 00 00 00       	push   $0xff
+  8002ab:	8d 43 08             	lea    0x8(%ebx),%eax
+  8002ae:	50                   	push   %eax
+  8002af:	e8 45 09 00 00       	call   800bf9 <sys_cputs>
+		b->idx = 0;
+  8002b4:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8002ba:	83 c4 10             	add    $0x10,%esp
+  8002bd:	eb db                	jmp    80029a <putch+0x1f>
+
+008002bf <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8002bf:	55                   	push   %ebp
+  8002c0:	89 e5                	mov    %esp,%ebp
+  8002c2:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8002c8:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8002cf:	00 00 00 
+	b.cnt = 0;
+  8002d2:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8002d9:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8002dc:	ff 75 0c             	push   0xc(%ebp)
+  8002df:	ff 75 08             	push   0x8(%ebp)
+  8002e2:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8002e8:	50                   	push   %eax
+  8002e9:	68 7b 02 80 00       	push   $0x80027b
+  8002ee:	e8 14 01 00 00       	call   800407 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8002f3:	83 c4 08             	add    $0x8,%esp
+  8002f6:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8002fc:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800302:	50                   	push   %eax
+  800303:	e8 f1 08 00 00       	call   800bf9 <sys_cputs>
+
+	return b.cnt;
+}
+  800308:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80030e:	c9                   	leave
+  80030f:	c3                   	ret
+
+00800310 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800310:	55                   	push   %ebp
+  800311:	89 e5                	mov    %esp,%ebp
+  800313:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800316:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800319:	50                   	push   %eax
+  80031a:	ff 75 08             	push   0x8(%ebp)
+  80031d:	e8 9d ff ff ff       	call   8002bf <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800322:	c9                   	leave
+  800323:	c3                   	ret
+
+00800324 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800324:	55                   	push   %ebp
+  800325:	89 e5                	mov    %esp,%ebp
+  800327:	57                   	push   %edi
+  800328:	56                   	push   %esi
+  800329:	53                   	push   %ebx
+  80032a:	83 ec 1c             	sub    $0x1c,%esp
+  80032d:	89 c7                	mov    %eax,%edi
+  80032f:	89 d6                	mov    %edx,%esi
+  800331:	8b 45 08             	mov    0x8(%ebp),%eax
+  800334:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800337:	89 d1                	mov    %edx,%ecx
+  800339:	89 c2                	mov    %eax,%edx
+  80033b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80033e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800341:	8b 45 10             	mov    0x10(%ebp),%eax
+  800344:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800347:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80034a:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800351:	39 c2                	cmp    %eax,%edx
+  800353:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800356:	72 3e                	jb     800396 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800358:	83 ec 0c             	sub    $0xc,%esp
+  80035b:	ff 75 18             	push   0x18(%ebp)
+  80035e:	83 eb 01             	sub    $0x1,%ebx
+  800361:	53                   	push   %ebx
+  800362:	50                   	push   %eax
+  800363:	83 ec 08             	sub    $0x8,%esp
+  800366:	ff 75 e4             	push   -0x1c(%ebp)
+  800369:	ff 75 e0             	push   -0x20(%ebp)
+  80036c:	ff 75 dc             	push   -0x24(%ebp)
+  80036f:	ff 75 d8             	push   -0x28(%ebp)
+  800372:	e8 29 23 00 00       	call   8026a0 <__udivdi3>
+  800377:	83 c4 18             	add    $0x18,%esp
+  80037a:	52                   	push   %edx
+  80037b:	50                   	push   %eax
+  80037c:	89 f2                	mov    %esi,%edx
+  80037e:	89 f8                	mov    %edi,%eax
+  800380:	e8 9f ff ff ff       	call   800324 <printnum>
+  800385:	83 c4 20             	add    $0x20,%esp
+  800388:	eb 13                	jmp    80039d <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80038a:	83 ec 08             	sub    $0x8,%esp
+  80038d:	56                   	push   %esi
+  80038e:	ff 75 18             	push   0x18(%ebp)
+  800391:	ff d7                	call   *%edi
+  800393:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800396:	83 eb 01             	sub    $0x1,%ebx
+  800399:	85 db                	test   %ebx,%ebx
+  80039b:	7f ed                	jg     80038a <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80039d:	83 ec 08             	sub    $0x8,%esp
+  8003a0:	56                   	push   %esi
+  8003a1:	83 ec 04             	sub    $0x4,%esp
+  8003a4:	ff 75 e4             	push   -0x1c(%ebp)
+  8003a7:	ff 75 e0             	push   -0x20(%ebp)
+  8003aa:	ff 75 dc             	push   -0x24(%ebp)
+  8003ad:	ff 75 d8             	push   -0x28(%ebp)
+  8003b0:	e8 bb 23 00 00       	call   802770 <__umoddi3>
+  8003b5:	83 c4 14             	add    $0x14,%esp
+  8003b8:	0f be 80 47 2b 80 00 	movsbl 0x802b47(%eax),%eax
+  8003bf:	50                   	push   %eax
+  8003c0:	ff d7                	call   *%edi
+}
+  8003c2:	83 c4 10             	add    $0x10,%esp
+  8003c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003c8:	5b                   	pop    %ebx
+  8003c9:	5e                   	pop    %esi
+  8003ca:	5f                   	pop    %edi
+  8003cb:	5d                   	pop    %ebp
+  8003cc:	c3                   	ret
+
+008003cd <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8003cd:	55                   	push   %ebp
+  8003ce:	89 e5                	mov    %esp,%ebp
+  8003d0:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8003d3:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8003d7:	8b 10                	mov    (%eax),%edx
+  8003d9:	3b 50 04             	cmp    0x4(%eax),%edx
+  8003dc:	73 0a                	jae    8003e8 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8003de:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8003e1:	89 08                	mov    %ecx,(%eax)
+  8003e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003e6:	88 02                	mov    %al,(%edx)
+}
+  8003e8:	5d                   	pop    %ebp
+  8003e9:	c3                   	ret
+
+008003ea <printfmt>:
+{
+  8003ea:	55                   	push   %ebp
+  8003eb:	89 e5                	mov    %esp,%ebp
+  8003ed:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8003f0:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8003f3:	50                   	push   %eax
+  8003f4:	ff 75 10             	push   0x10(%ebp)
+  8003f7:	ff 75 0c             	push   0xc(%ebp)
+  8003fa:	ff 75 08             	push   0x8(%ebp)
+  8003fd:	e8 05 00 00 00       	call   800407 <vprintfmt>
+}
+  800402:	83 c4 10             	add    $0x10,%esp
+  800405:	c9                   	leave
+  800406:	c3                   	ret
+
+00800407 <vprintfmt>:
+{
+  800407:	55                   	push   %ebp
+  800408:	89 e5                	mov    %esp,%ebp
+  80040a:	57                   	push   %edi
+  80040b:	56                   	push   %esi
+  80040c:	53                   	push   %ebx
+  80040d:	83 ec 2c             	sub    $0x2c,%esp
+  800410:	8b 75 08             	mov    0x8(%ebp),%esi
+  800413:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800416:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800419:	eb 0a                	jmp    800425 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80041b:	83 ec 08             	sub    $0x8,%esp
+  80041e:	53                   	push   %ebx
+  80041f:	50                   	push   %eax
+  800420:	ff d6                	call   *%esi
+  800422:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800425:	83 c7 01             	add    $0x1,%edi
+  800428:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80042c:	83 f8 25             	cmp    $0x25,%eax
+  80042f:	74 0c                	je     80043d <vprintfmt+0x36>
+			if (ch == '\0')
+  800431:	85 c0                	test   %eax,%eax
+  800433:	75 e6                	jne    80041b <vprintfmt+0x14>
+}
+  800435:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800438:	5b                   	pop    %ebx
+  800439:	5e                   	pop    %esi
+  80043a:	5f                   	pop    %edi
+  80043b:	5d                   	pop    %ebp
+  80043c:	c3                   	ret
+		padc = ' ';
+  80043d:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800441:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800448:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80044f:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800456:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80045b:	8d 47 01             	lea    0x1(%edi),%eax
+  80045e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800461:	0f b6 17             	movzbl (%edi),%edx
+  800464:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800467:	3c 55                	cmp    $0x55,%al
+  800469:	0f 87 9a 03 00 00    	ja     800809 <vprintfmt+0x402>
+  80046f:	0f b6 c0             	movzbl %al,%eax
+  800472:	ff 24 85 80 2c 80 00 	jmp    *0x802c80(,%eax,4)
+  800479:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  80047c:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800480:	eb d9                	jmp    80045b <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800482:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800485:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800489:	eb d0                	jmp    80045b <vprintfmt+0x54>
+  80048b:	0f b6 d2             	movzbl %dl,%edx
+  80048e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800491:	b8 00 00 00 00       	mov    $0x0,%eax
+  800496:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800499:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80049c:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8004a0:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8004a3:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8004a6:	83 f9 09             	cmp    $0x9,%ecx
+  8004a9:	77 55                	ja     800500 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8004ab:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8004ae:	eb e9                	jmp    800499 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8004b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004b3:	8b 00                	mov    (%eax),%eax
+  8004b5:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004bb:	8d 40 04             	lea    0x4(%eax),%eax
+  8004be:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004c1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8004c4:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004c8:	79 91                	jns    80045b <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8004ca:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004cd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004d0:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8004d7:	eb 82                	jmp    80045b <vprintfmt+0x54>
+			if (width < 0)
+  8004d9:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004dc:	85 d2                	test   %edx,%edx
+  8004de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e3:	0f 49 c2             	cmovns %edx,%eax
+  8004e6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004e9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8004ec:	e9 6a ff ff ff       	jmp    80045b <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004f1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8004f4:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8004fb:	e9 5b ff ff ff       	jmp    80045b <vprintfmt+0x54>
+  800500:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800503:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800506:	eb bc                	jmp    8004c4 <vprintfmt+0xbd>
+			lflag++;
+  800508:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80050b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80050e:	e9 48 ff ff ff       	jmp    80045b <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800513:	8b 45 14             	mov    0x14(%ebp),%eax
+  800516:	8d 78 04             	lea    0x4(%eax),%edi
+  800519:	83 ec 08             	sub    $0x8,%esp
+  80051c:	53                   	push   %ebx
+  80051d:	ff 30                	push   (%eax)
+  80051f:	ff d6                	call   *%esi
+			break;
+  800521:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800524:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800527:	e9 7c 02 00 00       	jmp    8007a8 <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  80052c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80052f:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800532:	8b 10                	mov    (%eax),%edx
+  800534:	89 d0                	mov    %edx,%eax
+  800536:	f7 d8                	neg    %eax
+  800538:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80053b:	83 f8 10             	cmp    $0x10,%eax
+  80053e:	7f 23                	jg     800563 <vprintfmt+0x15c>
+  800540:	8b 14 85 e0 2d 80 00 	mov    0x802de0(,%eax,4),%edx
+  800547:	85 d2                	test   %edx,%edx
+  800549:	74 18                	je     800563 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  80054b:	52                   	push   %edx
+  80054c:	68 25 30 80 00       	push   $0x803025
+  800551:	53                   	push   %ebx
+  800552:	56                   	push   %esi
+  800553:	e8 92 fe ff ff       	call   8003ea <printfmt>
+  800558:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80055b:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80055e:	e9 45 02 00 00       	jmp    8007a8 <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  800563:	50                   	push   %eax
+  800564:	68 5f 2b 80 00       	push   $0x802b5f
+  800569:	53                   	push   %ebx
+  80056a:	56                   	push   %esi
+  80056b:	e8 7a fe ff ff       	call   8003ea <printfmt>
+  800570:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800573:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800576:	e9 2d 02 00 00       	jmp    8007a8 <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80057b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80057e:	83 c0 04             	add    $0x4,%eax
+  800581:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800584:	8b 45 14             	mov    0x14(%ebp),%eax
+  800587:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800589:	85 c9                	test   %ecx,%ecx
+  80058b:	b8 58 2b 80 00       	mov    $0x802b58,%eax
+  800590:	0f 45 c1             	cmovne %ecx,%eax
+  800593:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800596:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80059a:	7e 06                	jle    8005a2 <vprintfmt+0x19b>
+  80059c:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8005a0:	75 0b                	jne    8005ad <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005a2:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8005a5:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8005a8:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005ab:	eb 5c                	jmp    800609 <vprintfmt+0x202>
+  8005ad:	83 ec 08             	sub    $0x8,%esp
+  8005b0:	ff 75 d0             	push   -0x30(%ebp)
+  8005b3:	ff 75 cc             	push   -0x34(%ebp)
+  8005b6:	e8 eb 02 00 00       	call   8008a6 <strnlen>
+  8005bb:	89 c2                	mov    %eax,%edx
+  8005bd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005c0:	29 d0                	sub    %edx,%eax
+  8005c2:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8005c5:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8005c9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005cc:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005cf:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005d1:	eb 0e                	jmp    8005e1 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8005d3:	83 ec 08             	sub    $0x8,%esp
+  8005d6:	53                   	push   %ebx
+  8005d7:	57                   	push   %edi
+  8005d8:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005db:	83 ee 01             	sub    $0x1,%esi
+  8005de:	83 c4 10             	add    $0x10,%esp
+  8005e1:	85 f6                	test   %esi,%esi
+  8005e3:	7f ee                	jg     8005d3 <vprintfmt+0x1cc>
+  8005e5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005e8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005eb:	85 c0                	test   %eax,%eax
+  8005ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005f2:	0f 49 d0             	cmovns %eax,%edx
+  8005f5:	29 d0                	sub    %edx,%eax
+  8005f7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005fa:	eb a6                	jmp    8005a2 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8005fc:	83 ec 08             	sub    $0x8,%esp
+  8005ff:	53                   	push   %ebx
+  800600:	52                   	push   %edx
+  800601:	ff 55 08             	call   *0x8(%ebp)
+  800604:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800607:	89 f1                	mov    %esi,%ecx
+  800609:	8d 71 01             	lea    0x1(%ecx),%esi
+  80060c:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800610:	0f be d0             	movsbl %al,%edx
+  800613:	85 d2                	test   %edx,%edx
+  800615:	74 28                	je     80063f <vprintfmt+0x238>
+  800617:	85 ff                	test   %edi,%edi
+  800619:	78 05                	js     800620 <vprintfmt+0x219>
+  80061b:	83 ef 01             	sub    $0x1,%edi
+  80061e:	78 30                	js     800650 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800620:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800624:	74 d6                	je     8005fc <vprintfmt+0x1f5>
+  800626:	0f be c0             	movsbl %al,%eax
+  800629:	83 e8 20             	sub    $0x20,%eax
+  80062c:	83 f8 5e             	cmp    $0x5e,%eax
+  80062f:	76 cb                	jbe    8005fc <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800631:	83 ec 08             	sub    $0x8,%esp
+  800634:	53                   	push   %ebx
+  800635:	6a 3f                	push   $0x3f
+  800637:	ff 55 08             	call   *0x8(%ebp)
+  80063a:	83 c4 10             	add    $0x10,%esp
+  80063d:	eb c8                	jmp    800607 <vprintfmt+0x200>
+  80063f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800642:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800645:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800648:	01 d0                	add    %edx,%eax
+  80064a:	29 c8                	sub    %ecx,%eax
+  80064c:	89 c7                	mov    %eax,%edi
+  80064e:	eb 13                	jmp    800663 <vprintfmt+0x25c>
+  800650:	8b 75 08             	mov    0x8(%ebp),%esi
+  800653:	eb ed                	jmp    800642 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800655:	83 ec 08             	sub    $0x8,%esp
+  800658:	53                   	push   %ebx
+  800659:	6a 20                	push   $0x20
+  80065b:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80065d:	83 ef 01             	sub    $0x1,%edi
+  800660:	83 c4 10             	add    $0x10,%esp
+  800663:	85 ff                	test   %edi,%edi
+  800665:	7f ee                	jg     800655 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800667:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80066a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80066d:	e9 36 01 00 00       	jmp    8007a8 <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  800672:	83 f9 01             	cmp    $0x1,%ecx
+  800675:	7f 1f                	jg     800696 <vprintfmt+0x28f>
+	else if (lflag)
+  800677:	85 c9                	test   %ecx,%ecx
+  800679:	74 67                	je     8006e2 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  80067b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067e:	8b 00                	mov    (%eax),%eax
+  800680:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800683:	89 c1                	mov    %eax,%ecx
+  800685:	c1 f9 1f             	sar    $0x1f,%ecx
+  800688:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80068b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068e:	8d 40 04             	lea    0x4(%eax),%eax
+  800691:	89 45 14             	mov    %eax,0x14(%ebp)
+  800694:	eb 17                	jmp    8006ad <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800696:	8b 45 14             	mov    0x14(%ebp),%eax
+  800699:	8b 50 04             	mov    0x4(%eax),%edx
+  80069c:	8b 00                	mov    (%eax),%eax
+  80069e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006a1:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8006a4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a7:	8d 40 08             	lea    0x8(%eax),%eax
+  8006aa:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8006ad:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006b0:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8006b3:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8006b8:	85 c9                	test   %ecx,%ecx
+  8006ba:	0f 89 ce 00 00 00    	jns    80078e <vprintfmt+0x387>
+				putch('-', putdat);
+  8006c0:	83 ec 08             	sub    $0x8,%esp
+  8006c3:	53                   	push   %ebx
+  8006c4:	6a 2d                	push   $0x2d
+  8006c6:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8006c8:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006cb:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8006ce:	f7 da                	neg    %edx
+  8006d0:	83 d1 00             	adc    $0x0,%ecx
+  8006d3:	f7 d9                	neg    %ecx
+  8006d5:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8006d8:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8006dd:	e9 ac 00 00 00       	jmp    80078e <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  8006e2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e5:	8b 00                	mov    (%eax),%eax
+  8006e7:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006ea:	89 c1                	mov    %eax,%ecx
+  8006ec:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006ef:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006f2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f5:	8d 40 04             	lea    0x4(%eax),%eax
+  8006f8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006fb:	eb b0                	jmp    8006ad <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8006fd:	83 f9 01             	cmp    $0x1,%ecx
+  800700:	7f 1b                	jg     80071d <vprintfmt+0x316>
+	else if (lflag)
+  800702:	85 c9                	test   %ecx,%ecx
+  800704:	74 2c                	je     800732 <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  800706:	8b 45 14             	mov    0x14(%ebp),%eax
+  800709:	8b 10                	mov    (%eax),%edx
+  80070b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800710:	8d 40 04             	lea    0x4(%eax),%eax
+  800713:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800716:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80071b:	eb 71                	jmp    80078e <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  80071d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800720:	8b 10                	mov    (%eax),%edx
+  800722:	8b 48 04             	mov    0x4(%eax),%ecx
+  800725:	8d 40 08             	lea    0x8(%eax),%eax
+  800728:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80072b:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800730:	eb 5c                	jmp    80078e <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  800732:	8b 45 14             	mov    0x14(%ebp),%eax
+  800735:	8b 10                	mov    (%eax),%edx
+  800737:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80073c:	8d 40 04             	lea    0x4(%eax),%eax
+  80073f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800742:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800747:	eb 45                	jmp    80078e <vprintfmt+0x387>
+			putch('X', putdat);
+  800749:	83 ec 08             	sub    $0x8,%esp
+  80074c:	53                   	push   %ebx
+  80074d:	6a 58                	push   $0x58
+  80074f:	ff d6                	call   *%esi
+			putch('X', putdat);
+  800751:	83 c4 08             	add    $0x8,%esp
+  800754:	53                   	push   %ebx
+  800755:	6a 58                	push   $0x58
+  800757:	ff d6                	call   *%esi
+			putch('X', putdat);
+  800759:	83 c4 08             	add    $0x8,%esp
+  80075c:	53                   	push   %ebx
+  80075d:	6a 58                	push   $0x58
+  80075f:	ff d6                	call   *%esi
+			break;
+  800761:	83 c4 10             	add    $0x10,%esp
+  800764:	eb 42                	jmp    8007a8 <vprintfmt+0x3a1>
+			putch('0', putdat);
+  800766:	83 ec 08             	sub    $0x8,%esp
+  800769:	53                   	push   %ebx
+  80076a:	6a 30                	push   $0x30
+  80076c:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80076e:	83 c4 08             	add    $0x8,%esp
+  800771:	53                   	push   %ebx
+  800772:	6a 78                	push   $0x78
+  800774:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800776:	8b 45 14             	mov    0x14(%ebp),%eax
+  800779:	8b 10                	mov    (%eax),%edx
+  80077b:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800780:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800783:	8d 40 04             	lea    0x4(%eax),%eax
+  800786:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800789:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80078e:	83 ec 0c             	sub    $0xc,%esp
+  800791:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800795:	50                   	push   %eax
+  800796:	ff 75 e0             	push   -0x20(%ebp)
+  800799:	57                   	push   %edi
+  80079a:	51                   	push   %ecx
+  80079b:	52                   	push   %edx
+  80079c:	89 da                	mov    %ebx,%edx
+  80079e:	89 f0                	mov    %esi,%eax
+  8007a0:	e8 7f fb ff ff       	call   800324 <printnum>
+			break;
+  8007a5:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8007a8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8007ab:	e9 75 fc ff ff       	jmp    800425 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8007b0:	83 f9 01             	cmp    $0x1,%ecx
+  8007b3:	7f 1b                	jg     8007d0 <vprintfmt+0x3c9>
+	else if (lflag)
+  8007b5:	85 c9                	test   %ecx,%ecx
+  8007b7:	74 2c                	je     8007e5 <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  8007b9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007bc:	8b 10                	mov    (%eax),%edx
+  8007be:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007c3:	8d 40 04             	lea    0x4(%eax),%eax
+  8007c6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007c9:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8007ce:	eb be                	jmp    80078e <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  8007d0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d3:	8b 10                	mov    (%eax),%edx
+  8007d5:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007d8:	8d 40 08             	lea    0x8(%eax),%eax
+  8007db:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007de:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8007e3:	eb a9                	jmp    80078e <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  8007e5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e8:	8b 10                	mov    (%eax),%edx
+  8007ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007ef:	8d 40 04             	lea    0x4(%eax),%eax
+  8007f2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007f5:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8007fa:	eb 92                	jmp    80078e <vprintfmt+0x387>
+			putch(ch, putdat);
+  8007fc:	83 ec 08             	sub    $0x8,%esp
+  8007ff:	53                   	push   %ebx
+  800800:	6a 25                	push   $0x25
+  800802:	ff d6                	call   *%esi
+			break;
+  800804:	83 c4 10             	add    $0x10,%esp
+  800807:	eb 9f                	jmp    8007a8 <vprintfmt+0x3a1>
+			putch('%', putdat);
+  800809:	83 ec 08             	sub    $0x8,%esp
+  80080c:	53                   	push   %ebx
+  80080d:	6a 25                	push   $0x25
+  80080f:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800811:	83 c4 10             	add    $0x10,%esp
+  800814:	89 f8                	mov    %edi,%eax
+  800816:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80081a:	74 05                	je     800821 <vprintfmt+0x41a>
+  80081c:	83 e8 01             	sub    $0x1,%eax
+  80081f:	eb f5                	jmp    800816 <vprintfmt+0x40f>
+  800821:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800824:	eb 82                	jmp    8007a8 <vprintfmt+0x3a1>
+
+00800826 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800826:	55                   	push   %ebp
+  800827:	89 e5                	mov    %esp,%ebp
+  800829:	83 ec 18             	sub    $0x18,%esp
+  80082c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80082f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800832:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800835:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800839:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80083c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800843:	85 c0                	test   %eax,%eax
+  800845:	74 26                	je     80086d <vsnprintf+0x47>
+  800847:	85 d2                	test   %edx,%edx
+  800849:	7e 22                	jle    80086d <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80084b:	ff 75 14             	push   0x14(%ebp)
+  80084e:	ff 75 10             	push   0x10(%ebp)
+  800851:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800854:	50                   	push   %eax
+  800855:	68 cd 03 80 00       	push   $0x8003cd
+  80085a:	e8 a8 fb ff ff       	call   800407 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80085f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800862:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800865:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800868:	83 c4 10             	add    $0x10,%esp
+}
+  80086b:	c9                   	leave
+  80086c:	c3                   	ret
+		return -E_INVAL;
+  80086d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800872:	eb f7                	jmp    80086b <vsnprintf+0x45>
+
+00800874 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800874:	55                   	push   %ebp
+  800875:	89 e5                	mov    %esp,%ebp
+  800877:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80087a:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80087d:	50                   	push   %eax
+  80087e:	ff 75 10             	push   0x10(%ebp)
+  800881:	ff 75 0c             	push   0xc(%ebp)
+  800884:	ff 75 08             	push   0x8(%ebp)
+  800887:	e8 9a ff ff ff       	call   800826 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80088c:	c9                   	leave
+  80088d:	c3                   	ret
+
+0080088e <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80088e:	55                   	push   %ebp
+  80088f:	89 e5                	mov    %esp,%ebp
+  800891:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800894:	b8 00 00 00 00       	mov    $0x0,%eax
+  800899:	eb 03                	jmp    80089e <strlen+0x10>
+		n++;
+  80089b:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80089e:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8008a2:	75 f7                	jne    80089b <strlen+0xd>
+	return n;
+}
+  8008a4:	5d                   	pop    %ebp
+  8008a5:	c3                   	ret
+
+008008a6 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8008a6:	55                   	push   %ebp
+  8008a7:	89 e5                	mov    %esp,%ebp
+  8008a9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008ac:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008b4:	eb 03                	jmp    8008b9 <strnlen+0x13>
+		n++;
+  8008b6:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008b9:	39 d0                	cmp    %edx,%eax
+  8008bb:	74 08                	je     8008c5 <strnlen+0x1f>
+  8008bd:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008c1:	75 f3                	jne    8008b6 <strnlen+0x10>
+  8008c3:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8008c5:	89 d0                	mov    %edx,%eax
+  8008c7:	5d                   	pop    %ebp
+  8008c8:	c3                   	ret
+
+008008c9 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8008c9:	55                   	push   %ebp
+  8008ca:	89 e5                	mov    %esp,%ebp
+  8008cc:	53                   	push   %ebx
+  8008cd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008d0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8008d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d8:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8008dc:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8008df:	83 c0 01             	add    $0x1,%eax
+  8008e2:	84 d2                	test   %dl,%dl
+  8008e4:	75 f2                	jne    8008d8 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8008e6:	89 c8                	mov    %ecx,%eax
+  8008e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008eb:	c9                   	leave
+  8008ec:	c3                   	ret
+
+008008ed <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8008ed:	55                   	push   %ebp
+  8008ee:	89 e5                	mov    %esp,%ebp
+  8008f0:	53                   	push   %ebx
+  8008f1:	83 ec 10             	sub    $0x10,%esp
+  8008f4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8008f7:	53                   	push   %ebx
+  8008f8:	e8 91 ff ff ff       	call   80088e <strlen>
+  8008fd:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800900:	ff 75 0c             	push   0xc(%ebp)
+  800903:	01 d8                	add    %ebx,%eax
+  800905:	50                   	push   %eax
+  800906:	e8 be ff ff ff       	call   8008c9 <strcpy>
+	return dst;
+}
+  80090b:	89 d8                	mov    %ebx,%eax
+  80090d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800910:	c9                   	leave
+  800911:	c3                   	ret
+
+00800912 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800912:	55                   	push   %ebp
+  800913:	89 e5                	mov    %esp,%ebp
+  800915:	56                   	push   %esi
+  800916:	53                   	push   %ebx
+  800917:	8b 75 08             	mov    0x8(%ebp),%esi
+  80091a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80091d:	89 f3                	mov    %esi,%ebx
+  80091f:	03 5d 10             	add    0x10(%ebp),%ebx
+  800922:	89 f0                	mov    %esi,%eax
+  800924:	eb 0f                	jmp    800935 <strncpy+0x23>
+		*dst++ = *src;
+  800926:	83 c0 01             	add    $0x1,%eax
+  800929:	0f b6 0a             	movzbl (%edx),%ecx
+  80092c:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80092f:	80 f9 01             	cmp    $0x1,%cl
+  800932:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800935:	39 d8                	cmp    %ebx,%eax
+  800937:	75 ed                	jne    800926 <strncpy+0x14>
+	}
+	return ret;
+}
+  800939:	89 f0                	mov    %esi,%eax
+  80093b:	5b                   	pop    %ebx
+  80093c:	5e                   	pop    %esi
+  80093d:	5d                   	pop    %ebp
+  80093e:	c3                   	ret
+
+0080093f <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80093f:	55                   	push   %ebp
+  800940:	89 e5                	mov    %esp,%ebp
+  800942:	56                   	push   %esi
+  800943:	53                   	push   %ebx
+  800944:	8b 75 08             	mov    0x8(%ebp),%esi
+  800947:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80094a:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80094d:	89 f0                	mov    %esi,%eax
+  80094f:	85 d2                	test   %edx,%edx
+  800951:	74 21                	je     800974 <strlcpy+0x35>
+  800953:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800957:	89 f2                	mov    %esi,%edx
+  800959:	eb 09                	jmp    800964 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  80095b:	83 c1 01             	add    $0x1,%ecx
+  80095e:	83 c2 01             	add    $0x1,%edx
+  800961:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800964:	39 c2                	cmp    %eax,%edx
+  800966:	74 09                	je     800971 <strlcpy+0x32>
+  800968:	0f b6 19             	movzbl (%ecx),%ebx
+  80096b:	84 db                	test   %bl,%bl
+  80096d:	75 ec                	jne    80095b <strlcpy+0x1c>
+  80096f:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800971:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800974:	29 f0                	sub    %esi,%eax
+}
+  800976:	5b                   	pop    %ebx
+  800977:	5e                   	pop    %esi
+  800978:	5d                   	pop    %ebp
+  800979:	c3                   	ret
+
+0080097a <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80097a:	55                   	push   %ebp
+  80097b:	89 e5                	mov    %esp,%ebp
+  80097d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800980:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800983:	eb 06                	jmp    80098b <strcmp+0x11>
+		p++, q++;
+  800985:	83 c1 01             	add    $0x1,%ecx
+  800988:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  80098b:	0f b6 01             	movzbl (%ecx),%eax
+  80098e:	84 c0                	test   %al,%al
+  800990:	74 04                	je     800996 <strcmp+0x1c>
+  800992:	3a 02                	cmp    (%edx),%al
+  800994:	74 ef                	je     800985 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800996:	0f b6 c0             	movzbl %al,%eax
+  800999:	0f b6 12             	movzbl (%edx),%edx
+  80099c:	29 d0                	sub    %edx,%eax
+}
+  80099e:	5d                   	pop    %ebp
+  80099f:	c3                   	ret
+
+008009a0 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8009a0:	55                   	push   %ebp
+  8009a1:	89 e5                	mov    %esp,%ebp
+  8009a3:	53                   	push   %ebx
+  8009a4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009aa:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8009ad:	eb 09                	jmp    8009b8 <strncmp+0x18>
+		n--, p++, q++;
+  8009af:	83 ea 01             	sub    $0x1,%edx
+  8009b2:	83 c0 01             	add    $0x1,%eax
+  8009b5:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8009b8:	85 d2                	test   %edx,%edx
+  8009ba:	74 18                	je     8009d4 <strncmp+0x34>
+  8009bc:	0f b6 18             	movzbl (%eax),%ebx
+  8009bf:	84 db                	test   %bl,%bl
+  8009c1:	74 04                	je     8009c7 <strncmp+0x27>
+  8009c3:	3a 19                	cmp    (%ecx),%bl
+  8009c5:	74 e8                	je     8009af <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009c7:	0f b6 00             	movzbl (%eax),%eax
+  8009ca:	0f b6 11             	movzbl (%ecx),%edx
+  8009cd:	29 d0                	sub    %edx,%eax
+}
+  8009cf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009d2:	c9                   	leave
+  8009d3:	c3                   	ret
+		return 0;
+  8009d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009d9:	eb f4                	jmp    8009cf <strncmp+0x2f>
+
+008009db <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8009db:	55                   	push   %ebp
+  8009dc:	89 e5                	mov    %esp,%ebp
+  8009de:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009e1:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009e5:	eb 03                	jmp    8009ea <strchr+0xf>
+  8009e7:	83 c0 01             	add    $0x1,%eax
+  8009ea:	0f b6 10             	movzbl (%eax),%edx
+  8009ed:	84 d2                	test   %dl,%dl
+  8009ef:	74 06                	je     8009f7 <strchr+0x1c>
+		if (*s == c)
+  8009f1:	38 ca                	cmp    %cl,%dl
+  8009f3:	75 f2                	jne    8009e7 <strchr+0xc>
+  8009f5:	eb 05                	jmp    8009fc <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8009f7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009fc:	5d                   	pop    %ebp
+  8009fd:	c3                   	ret
+
+008009fe <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8009fe:	55                   	push   %ebp
+  8009ff:	89 e5                	mov    %esp,%ebp
+  800a01:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a04:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a08:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a0b:	38 ca                	cmp    %cl,%dl
+  800a0d:	74 09                	je     800a18 <strfind+0x1a>
+  800a0f:	84 d2                	test   %dl,%dl
+  800a11:	74 05                	je     800a18 <strfind+0x1a>
+	for (; *s; s++)
+  800a13:	83 c0 01             	add    $0x1,%eax
+  800a16:	eb f0                	jmp    800a08 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800a18:	5d                   	pop    %ebp
+  800a19:	c3                   	ret
+
+00800a1a <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a1a:	55                   	push   %ebp
+  800a1b:	89 e5                	mov    %esp,%ebp
+  800a1d:	57                   	push   %edi
+  800a1e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a21:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a24:	85 c9                	test   %ecx,%ecx
+  800a26:	74 20                	je     800a48 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a28:	89 f8                	mov    %edi,%eax
+  800a2a:	09 c8                	or     %ecx,%eax
+  800a2c:	a8 03                	test   $0x3,%al
+  800a2e:	75 12                	jne    800a42 <memset+0x28>
+		c &= 0xFF;
+  800a30:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a34:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a3a:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a3d:	fc                   	cld
+  800a3e:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a40:	eb 06                	jmp    800a48 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a42:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a45:	fc                   	cld
+  800a46:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a48:	89 f8                	mov    %edi,%eax
+  800a4a:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a4d:	c9                   	leave
+  800a4e:	c3                   	ret
+
+00800a4f <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a4f:	55                   	push   %ebp
+  800a50:	89 e5                	mov    %esp,%ebp
+  800a52:	57                   	push   %edi
+  800a53:	56                   	push   %esi
+  800a54:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a57:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a5a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a5d:	39 c6                	cmp    %eax,%esi
+  800a5f:	73 32                	jae    800a93 <memmove+0x44>
+  800a61:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a64:	39 d0                	cmp    %edx,%eax
+  800a66:	73 2b                	jae    800a93 <memmove+0x44>
+		s += n;
+		d += n;
+  800a68:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a6b:	89 d6                	mov    %edx,%esi
+  800a6d:	09 fe                	or     %edi,%esi
+  800a6f:	09 ce                	or     %ecx,%esi
+  800a71:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a77:	75 0e                	jne    800a87 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a79:	83 ef 04             	sub    $0x4,%edi
+  800a7c:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a7f:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a82:	fd                   	std
+  800a83:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a85:	eb 09                	jmp    800a90 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a87:	83 ef 01             	sub    $0x1,%edi
+  800a8a:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800a8d:	fd                   	std
+  800a8e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a90:	fc                   	cld
+  800a91:	eb 1a                	jmp    800aad <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a93:	89 f2                	mov    %esi,%edx
+  800a95:	09 c2                	or     %eax,%edx
+  800a97:	09 ca                	or     %ecx,%edx
+  800a99:	f6 c2 03             	test   $0x3,%dl
+  800a9c:	75 0a                	jne    800aa8 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a9e:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800aa1:	89 c7                	mov    %eax,%edi
+  800aa3:	fc                   	cld
+  800aa4:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800aa6:	eb 05                	jmp    800aad <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800aa8:	89 c7                	mov    %eax,%edi
+  800aaa:	fc                   	cld
+  800aab:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800aad:	5e                   	pop    %esi
+  800aae:	5f                   	pop    %edi
+  800aaf:	5d                   	pop    %ebp
+  800ab0:	c3                   	ret
+
+00800ab1 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800ab1:	55                   	push   %ebp
+  800ab2:	89 e5                	mov    %esp,%ebp
+  800ab4:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800ab7:	ff 75 10             	push   0x10(%ebp)
+  800aba:	ff 75 0c             	push   0xc(%ebp)
+  800abd:	ff 75 08             	push   0x8(%ebp)
+  800ac0:	e8 8a ff ff ff       	call   800a4f <memmove>
+}
+  800ac5:	c9                   	leave
+  800ac6:	c3                   	ret
+
+00800ac7 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800ac7:	55                   	push   %ebp
+  800ac8:	89 e5                	mov    %esp,%ebp
+  800aca:	56                   	push   %esi
+  800acb:	53                   	push   %ebx
+  800acc:	8b 45 08             	mov    0x8(%ebp),%eax
+  800acf:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800ad2:	89 c6                	mov    %eax,%esi
+  800ad4:	03 75 10             	add    0x10(%ebp),%esi
+  800ad7:	eb 06                	jmp    800adf <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800ad9:	83 c0 01             	add    $0x1,%eax
+  800adc:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800adf:	39 f0                	cmp    %esi,%eax
+  800ae1:	74 14                	je     800af7 <memcmp+0x30>
+		if (*s1 != *s2)
+  800ae3:	0f b6 08             	movzbl (%eax),%ecx
+  800ae6:	0f b6 1a             	movzbl (%edx),%ebx
+  800ae9:	38 d9                	cmp    %bl,%cl
+  800aeb:	74 ec                	je     800ad9 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800aed:	0f b6 c1             	movzbl %cl,%eax
+  800af0:	0f b6 db             	movzbl %bl,%ebx
+  800af3:	29 d8                	sub    %ebx,%eax
+  800af5:	eb 05                	jmp    800afc <memcmp+0x35>
+	}
+
+	return 0;
+  800af7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800afc:	5b                   	pop    %ebx
+  800afd:	5e                   	pop    %esi
+  800afe:	5d                   	pop    %ebp
+  800aff:	c3                   	ret
+
+00800b00 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b00:	55                   	push   %ebp
+  800b01:	89 e5                	mov    %esp,%ebp
+  800b03:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b06:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b09:	89 c2                	mov    %eax,%edx
+  800b0b:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b0e:	eb 03                	jmp    800b13 <memfind+0x13>
+  800b10:	83 c0 01             	add    $0x1,%eax
+  800b13:	39 d0                	cmp    %edx,%eax
+  800b15:	73 04                	jae    800b1b <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b17:	38 08                	cmp    %cl,(%eax)
+  800b19:	75 f5                	jne    800b10 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800b1b:	5d                   	pop    %ebp
+  800b1c:	c3                   	ret
+
+00800b1d <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800b1d:	55                   	push   %ebp
+  800b1e:	89 e5                	mov    %esp,%ebp
+  800b20:	57                   	push   %edi
+  800b21:	56                   	push   %esi
+  800b22:	53                   	push   %ebx
+  800b23:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b26:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b29:	eb 03                	jmp    800b2e <strtol+0x11>
+		s++;
+  800b2b:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800b2e:	0f b6 02             	movzbl (%edx),%eax
+  800b31:	3c 20                	cmp    $0x20,%al
+  800b33:	74 f6                	je     800b2b <strtol+0xe>
+  800b35:	3c 09                	cmp    $0x9,%al
+  800b37:	74 f2                	je     800b2b <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b39:	3c 2b                	cmp    $0x2b,%al
+  800b3b:	74 2a                	je     800b67 <strtol+0x4a>
+	int neg = 0;
+  800b3d:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800b42:	3c 2d                	cmp    $0x2d,%al
+  800b44:	74 2b                	je     800b71 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b46:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b4c:	75 0f                	jne    800b5d <strtol+0x40>
+  800b4e:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b51:	74 28                	je     800b7b <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b53:	85 db                	test   %ebx,%ebx
+  800b55:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b5a:	0f 44 d8             	cmove  %eax,%ebx
+  800b5d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b62:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b65:	eb 46                	jmp    800bad <strtol+0x90>
+		s++;
+  800b67:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800b6a:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b6f:	eb d5                	jmp    800b46 <strtol+0x29>
+		s++, neg = 1;
+  800b71:	83 c2 01             	add    $0x1,%edx
+  800b74:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b79:	eb cb                	jmp    800b46 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b7b:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b7f:	74 0e                	je     800b8f <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800b81:	85 db                	test   %ebx,%ebx
+  800b83:	75 d8                	jne    800b5d <strtol+0x40>
+		s++, base = 8;
+  800b85:	83 c2 01             	add    $0x1,%edx
+  800b88:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b8d:	eb ce                	jmp    800b5d <strtol+0x40>
+		s += 2, base = 16;
+  800b8f:	83 c2 02             	add    $0x2,%edx
+  800b92:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b97:	eb c4                	jmp    800b5d <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800b99:	0f be c0             	movsbl %al,%eax
+  800b9c:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800b9f:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800ba2:	7d 3a                	jge    800bde <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800ba4:	83 c2 01             	add    $0x1,%edx
+  800ba7:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800bab:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800bad:	0f b6 02             	movzbl (%edx),%eax
+  800bb0:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800bb3:	89 f3                	mov    %esi,%ebx
+  800bb5:	80 fb 09             	cmp    $0x9,%bl
+  800bb8:	76 df                	jbe    800b99 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800bba:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800bbd:	89 f3                	mov    %esi,%ebx
+  800bbf:	80 fb 19             	cmp    $0x19,%bl
+  800bc2:	77 08                	ja     800bcc <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800bc4:	0f be c0             	movsbl %al,%eax
+  800bc7:	83 e8 57             	sub    $0x57,%eax
+  800bca:	eb d3                	jmp    800b9f <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800bcc:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800bcf:	89 f3                	mov    %esi,%ebx
+  800bd1:	80 fb 19             	cmp    $0x19,%bl
+  800bd4:	77 08                	ja     800bde <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800bd6:	0f be c0             	movsbl %al,%eax
+  800bd9:	83 e8 37             	sub    $0x37,%eax
+  800bdc:	eb c1                	jmp    800b9f <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800bde:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800be2:	74 05                	je     800be9 <strtol+0xcc>
+		*endptr = (char *) s;
+  800be4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800be7:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800be9:	89 c8                	mov    %ecx,%eax
+  800beb:	f7 d8                	neg    %eax
+  800bed:	85 ff                	test   %edi,%edi
+  800bef:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800bf2:	89 c8                	mov    %ecx,%eax
+  800bf4:	5b                   	pop    %ebx
+  800bf5:	5e                   	pop    %esi
+  800bf6:	5f                   	pop    %edi
+  800bf7:	5d                   	pop    %ebp
+  800bf8:	c3                   	ret
+
+00800bf9 <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800bf9:	55                   	push   %ebp
+  800bfa:	89 e5                	mov    %esp,%ebp
+  800bfc:	57                   	push   %edi
+  800bfd:	56                   	push   %esi
+  800bfe:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800bff:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c04:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c07:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c0a:	89 c3                	mov    %eax,%ebx
+  800c0c:	89 c7                	mov    %eax,%edi
+  800c0e:	89 c6                	mov    %eax,%esi
+  800c10:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  800c12:	5b                   	pop    %ebx
+  800c13:	5e                   	pop    %esi
+  800c14:	5f                   	pop    %edi
+  800c15:	5d                   	pop    %ebp
+  800c16:	c3                   	ret
+
+00800c17 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800c17:	55                   	push   %ebp
+  800c18:	89 e5                	mov    %esp,%ebp
+  800c1a:	57                   	push   %edi
+  800c1b:	56                   	push   %esi
+  800c1c:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800c1d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c22:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c27:	89 d1                	mov    %edx,%ecx
+  800c29:	89 d3                	mov    %edx,%ebx
+  800c2b:	89 d7                	mov    %edx,%edi
+  800c2d:	89 d6                	mov    %edx,%esi
+  800c2f:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c31:	5b                   	pop    %ebx
+  800c32:	5e                   	pop    %esi
+  800c33:	5f                   	pop    %edi
+  800c34:	5d                   	pop    %ebp
+  800c35:	c3                   	ret
+
+00800c36 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800c36:	55                   	push   %ebp
+  800c37:	89 e5                	mov    %esp,%ebp
+  800c39:	57                   	push   %edi
+  800c3a:	56                   	push   %esi
+  800c3b:	53                   	push   %ebx
+  800c3c:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c3f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c44:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c47:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c4c:	89 cb                	mov    %ecx,%ebx
+  800c4e:	89 cf                	mov    %ecx,%edi
+  800c50:	89 ce                	mov    %ecx,%esi
+  800c52:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c54:	85 c0                	test   %eax,%eax
+  800c56:	7f 08                	jg     800c60 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c58:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c5b:	5b                   	pop    %ebx
+  800c5c:	5e                   	pop    %esi
+  800c5d:	5f                   	pop    %edi
+  800c5e:	5d                   	pop    %ebp
+  800c5f:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c60:	83 ec 0c             	sub    $0xc,%esp
+  800c63:	50                   	push   %eax
+  800c64:	6a 03                	push   $0x3
+  800c66:	68 43 2e 80 00       	push   $0x802e43
+  800c6b:	6a 3e                	push   $0x3e
+  800c6d:	68 60 2e 80 00       	push   $0x802e60
+  800c72:	e8 be f5 ff ff       	call   800235 <_panic>
+
+00800c77 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800c77:	55                   	push   %ebp
+  800c78:	89 e5                	mov    %esp,%ebp
+  800c7a:	57                   	push   %edi
+  800c7b:	56                   	push   %esi
+  800c7c:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800c7d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c82:	b8 02 00 00 00       	mov    $0x2,%eax
+  800c87:	89 d1                	mov    %edx,%ecx
+  800c89:	89 d3                	mov    %edx,%ebx
+  800c8b:	89 d7                	mov    %edx,%edi
+  800c8d:	89 d6                	mov    %edx,%esi
+  800c8f:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800c91:	5b                   	pop    %ebx
+  800c92:	5e                   	pop    %esi
+  800c93:	5f                   	pop    %edi
+  800c94:	5d                   	pop    %ebp
+  800c95:	c3                   	ret
+
+00800c96 <sys_yield>:
+
+void
+sys_yield(void) {
+  800c96:	55                   	push   %ebp
+  800c97:	89 e5                	mov    %esp,%ebp
+  800c99:	57                   	push   %edi
+  800c9a:	56                   	push   %esi
+  800c9b:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800c9c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ca1:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800ca6:	89 d1                	mov    %edx,%ecx
+  800ca8:	89 d3                	mov    %edx,%ebx
+  800caa:	89 d7                	mov    %edx,%edi
+  800cac:	89 d6                	mov    %edx,%esi
+  800cae:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800cb0:	5b                   	pop    %ebx
+  800cb1:	5e                   	pop    %esi
+  800cb2:	5f                   	pop    %edi
+  800cb3:	5d                   	pop    %ebp
+  800cb4:	c3                   	ret
+
+00800cb5 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  800cb5:	55                   	push   %ebp
+  800cb6:	89 e5                	mov    %esp,%ebp
+  800cb8:	57                   	push   %edi
+  800cb9:	56                   	push   %esi
+  800cba:	53                   	push   %ebx
+  800cbb:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800cbe:	be 00 00 00 00       	mov    $0x0,%esi
+  800cc3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cc6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cc9:	b8 04 00 00 00       	mov    $0x4,%eax
+  800cce:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cd1:	89 f7                	mov    %esi,%edi
+  800cd3:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800cd5:	85 c0                	test   %eax,%eax
+  800cd7:	7f 08                	jg     800ce1 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800cd9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cdc:	5b                   	pop    %ebx
+  800cdd:	5e                   	pop    %esi
+  800cde:	5f                   	pop    %edi
+  800cdf:	5d                   	pop    %ebp
+  800ce0:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ce1:	83 ec 0c             	sub    $0xc,%esp
+  800ce4:	50                   	push   %eax
+  800ce5:	6a 04                	push   $0x4
+  800ce7:	68 43 2e 80 00       	push   $0x802e43
+  800cec:	6a 3e                	push   $0x3e
+  800cee:	68 60 2e 80 00       	push   $0x802e60
+  800cf3:	e8 3d f5 ff ff       	call   800235 <_panic>
+
+00800cf8 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  800cf8:	55                   	push   %ebp
+  800cf9:	89 e5                	mov    %esp,%ebp
+  800cfb:	57                   	push   %edi
+  800cfc:	56                   	push   %esi
+  800cfd:	53                   	push   %ebx
+  800cfe:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800d01:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d04:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d07:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d0c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d0f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d12:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d15:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d17:	85 c0                	test   %eax,%eax
+  800d19:	7f 08                	jg     800d23 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800d1b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d1e:	5b                   	pop    %ebx
+  800d1f:	5e                   	pop    %esi
+  800d20:	5f                   	pop    %edi
+  800d21:	5d                   	pop    %ebp
+  800d22:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d23:	83 ec 0c             	sub    $0xc,%esp
+  800d26:	50                   	push   %eax
+  800d27:	6a 05                	push   $0x5
+  800d29:	68 43 2e 80 00       	push   $0x802e43
+  800d2e:	6a 3e                	push   $0x3e
+  800d30:	68 60 2e 80 00       	push   $0x802e60
+  800d35:	e8 fb f4 ff ff       	call   800235 <_panic>
+
+00800d3a <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  800d3a:	55                   	push   %ebp
+  800d3b:	89 e5                	mov    %esp,%ebp
+  800d3d:	57                   	push   %edi
+  800d3e:	56                   	push   %esi
+  800d3f:	53                   	push   %ebx
+  800d40:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800d43:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d48:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d4b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d4e:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d53:	89 df                	mov    %ebx,%edi
+  800d55:	89 de                	mov    %ebx,%esi
+  800d57:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d59:	85 c0                	test   %eax,%eax
+  800d5b:	7f 08                	jg     800d65 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800d5d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d60:	5b                   	pop    %ebx
+  800d61:	5e                   	pop    %esi
+  800d62:	5f                   	pop    %edi
+  800d63:	5d                   	pop    %ebp
+  800d64:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d65:	83 ec 0c             	sub    $0xc,%esp
+  800d68:	50                   	push   %eax
+  800d69:	6a 06                	push   $0x6
+  800d6b:	68 43 2e 80 00       	push   $0x802e43
+  800d70:	6a 3e                	push   $0x3e
+  800d72:	68 60 2e 80 00       	push   $0x802e60
+  800d77:	e8 b9 f4 ff ff       	call   800235 <_panic>
+
+00800d7c <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800d7c:	55                   	push   %ebp
+  800d7d:	89 e5                	mov    %esp,%ebp
+  800d7f:	57                   	push   %edi
+  800d80:	56                   	push   %esi
+  800d81:	53                   	push   %ebx
+  800d82:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800d85:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d8a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d8d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d90:	b8 08 00 00 00       	mov    $0x8,%eax
+  800d95:	89 df                	mov    %ebx,%edi
+  800d97:	89 de                	mov    %ebx,%esi
+  800d99:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d9b:	85 c0                	test   %eax,%eax
+  800d9d:	7f 08                	jg     800da7 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800d9f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800da2:	5b                   	pop    %ebx
+  800da3:	5e                   	pop    %esi
+  800da4:	5f                   	pop    %edi
+  800da5:	5d                   	pop    %ebp
+  800da6:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800da7:	83 ec 0c             	sub    $0xc,%esp
+  800daa:	50                   	push   %eax
+  800dab:	6a 08                	push   $0x8
+  800dad:	68 43 2e 80 00       	push   $0x802e43
+  800db2:	6a 3e                	push   $0x3e
+  800db4:	68 60 2e 80 00       	push   $0x802e60
+  800db9:	e8 77 f4 ff ff       	call   800235 <_panic>
+
+00800dbe <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800dbe:	55                   	push   %ebp
+  800dbf:	89 e5                	mov    %esp,%ebp
+  800dc1:	57                   	push   %edi
+  800dc2:	56                   	push   %esi
+  800dc3:	53                   	push   %ebx
+  800dc4:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800dc7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dcc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dcf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dd2:	b8 09 00 00 00       	mov    $0x9,%eax
+  800dd7:	89 df                	mov    %ebx,%edi
+  800dd9:	89 de                	mov    %ebx,%esi
+  800ddb:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ddd:	85 c0                	test   %eax,%eax
+  800ddf:	7f 08                	jg     800de9 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800de1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800de4:	5b                   	pop    %ebx
+  800de5:	5e                   	pop    %esi
+  800de6:	5f                   	pop    %edi
+  800de7:	5d                   	pop    %ebp
+  800de8:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800de9:	83 ec 0c             	sub    $0xc,%esp
+  800dec:	50                   	push   %eax
+  800ded:	6a 09                	push   $0x9
+  800def:	68 43 2e 80 00       	push   $0x802e43
+  800df4:	6a 3e                	push   $0x3e
+  800df6:	68 60 2e 80 00       	push   $0x802e60
+  800dfb:	e8 35 f4 ff ff       	call   800235 <_panic>
+
+00800e00 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800e00:	55                   	push   %ebp
+  800e01:	89 e5                	mov    %esp,%ebp
+  800e03:	57                   	push   %edi
+  800e04:	56                   	push   %esi
+  800e05:	53                   	push   %ebx
+  800e06:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800e09:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e0e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e11:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e14:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e19:	89 df                	mov    %ebx,%edi
+  800e1b:	89 de                	mov    %ebx,%esi
+  800e1d:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e1f:	85 c0                	test   %eax,%eax
+  800e21:	7f 08                	jg     800e2b <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800e23:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e26:	5b                   	pop    %ebx
+  800e27:	5e                   	pop    %esi
+  800e28:	5f                   	pop    %edi
+  800e29:	5d                   	pop    %ebp
+  800e2a:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e2b:	83 ec 0c             	sub    $0xc,%esp
+  800e2e:	50                   	push   %eax
+  800e2f:	6a 0a                	push   $0xa
+  800e31:	68 43 2e 80 00       	push   $0x802e43
+  800e36:	6a 3e                	push   $0x3e
+  800e38:	68 60 2e 80 00       	push   $0x802e60
+  800e3d:	e8 f3 f3 ff ff       	call   800235 <_panic>
+
+00800e42 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  800e42:	55                   	push   %ebp
+  800e43:	89 e5                	mov    %esp,%ebp
+  800e45:	57                   	push   %edi
+  800e46:	56                   	push   %esi
+  800e47:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e48:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e4b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e4e:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800e53:	be 00 00 00 00       	mov    $0x0,%esi
+  800e58:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e5b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e5e:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800e60:	5b                   	pop    %ebx
+  800e61:	5e                   	pop    %esi
+  800e62:	5f                   	pop    %edi
+  800e63:	5d                   	pop    %ebp
+  800e64:	c3                   	ret
+
+00800e65 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  800e65:	55                   	push   %ebp
+  800e66:	89 e5                	mov    %esp,%ebp
+  800e68:	57                   	push   %edi
+  800e69:	56                   	push   %esi
+  800e6a:	53                   	push   %ebx
+  800e6b:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800e6e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e73:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e76:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e7b:	89 cb                	mov    %ecx,%ebx
+  800e7d:	89 cf                	mov    %ecx,%edi
+  800e7f:	89 ce                	mov    %ecx,%esi
+  800e81:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e83:	85 c0                	test   %eax,%eax
+  800e85:	7f 08                	jg     800e8f <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  800e87:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e8a:	5b                   	pop    %ebx
+  800e8b:	5e                   	pop    %esi
+  800e8c:	5f                   	pop    %edi
+  800e8d:	5d                   	pop    %ebp
+  800e8e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e8f:	83 ec 0c             	sub    $0xc,%esp
+  800e92:	50                   	push   %eax
+  800e93:	6a 0d                	push   $0xd
+  800e95:	68 43 2e 80 00       	push   $0x802e43
+  800e9a:	6a 3e                	push   $0x3e
+  800e9c:	68 60 2e 80 00       	push   $0x802e60
+  800ea1:	e8 8f f3 ff ff       	call   800235 <_panic>
+
+00800ea6 <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  800ea6:	55                   	push   %ebp
+  800ea7:	89 e5                	mov    %esp,%ebp
+  800ea9:	57                   	push   %edi
+  800eaa:	56                   	push   %esi
+  800eab:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800eac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eb1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb7:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800ebc:	89 df                	mov    %ebx,%edi
+  800ebe:	89 de                	mov    %ebx,%esi
+  800ec0:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  800ec2:	5b                   	pop    %ebx
+  800ec3:	5e                   	pop    %esi
+  800ec4:	5f                   	pop    %edi
+  800ec5:	5d                   	pop    %ebp
+  800ec6:	c3                   	ret
+
+00800ec7 <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  800ec7:	55                   	push   %ebp
+  800ec8:	89 e5                	mov    %esp,%ebp
+  800eca:	57                   	push   %edi
+  800ecb:	56                   	push   %esi
+  800ecc:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800ecd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ed2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed5:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800eda:	89 cb                	mov    %ecx,%ebx
+  800edc:	89 cf                	mov    %ecx,%edi
+  800ede:	89 ce                	mov    %ecx,%esi
+  800ee0:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  800ee2:	5b                   	pop    %ebx
+  800ee3:	5e                   	pop    %esi
+  800ee4:	5f                   	pop    %edi
+  800ee5:	5d                   	pop    %ebp
+  800ee6:	c3                   	ret
+
+00800ee7 <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  800ee7:	55                   	push   %ebp
+  800ee8:	89 e5                	mov    %esp,%ebp
+  800eea:	57                   	push   %edi
+  800eeb:	56                   	push   %esi
+  800eec:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800eed:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ef2:	b8 10 00 00 00       	mov    $0x10,%eax
+  800ef7:	89 d1                	mov    %edx,%ecx
+  800ef9:	89 d3                	mov    %edx,%ebx
+  800efb:	89 d7                	mov    %edx,%edi
+  800efd:	89 d6                	mov    %edx,%esi
+  800eff:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800f01:	5b                   	pop    %ebx
+  800f02:	5e                   	pop    %esi
+  800f03:	5f                   	pop    %edi
+  800f04:	5d                   	pop    %ebp
+  800f05:	c3                   	ret
+
+00800f06 <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  800f06:	55                   	push   %ebp
+  800f07:	89 e5                	mov    %esp,%ebp
+  800f09:	57                   	push   %edi
+  800f0a:	56                   	push   %esi
+  800f0b:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800f0c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f11:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f14:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f17:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f1c:	89 df                	mov    %ebx,%edi
+  800f1e:	89 de                	mov    %ebx,%esi
+  800f20:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800f22:	5b                   	pop    %ebx
+  800f23:	5e                   	pop    %esi
+  800f24:	5f                   	pop    %edi
+  800f25:	5d                   	pop    %ebp
+  800f26:	c3                   	ret
+
+00800f27 <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  800f27:	55                   	push   %ebp
+  800f28:	89 e5                	mov    %esp,%ebp
+  800f2a:	57                   	push   %edi
+  800f2b:	56                   	push   %esi
+  800f2c:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800f2d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f32:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f35:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f38:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f3d:	89 df                	mov    %ebx,%edi
+  800f3f:	89 de                	mov    %ebx,%esi
+  800f41:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800f43:	5b                   	pop    %ebx
+  800f44:	5e                   	pop    %esi
+  800f45:	5f                   	pop    %edi
+  800f46:	5d                   	pop    %ebp
+  800f47:	c3                   	ret
+
+00800f48 <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  800f48:	55                   	push   %ebp
+  800f49:	89 e5                	mov    %esp,%ebp
+  800f4b:	57                   	push   %edi
+  800f4c:	56                   	push   %esi
+  800f4d:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800f4e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f53:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f56:	b8 13 00 00 00       	mov    $0x13,%eax
+  800f5b:	89 cb                	mov    %ecx,%ebx
+  800f5d:	89 cf                	mov    %ecx,%edi
+  800f5f:	89 ce                	mov    %ecx,%esi
+  800f61:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  800f63:	5b                   	pop    %ebx
+  800f64:	5e                   	pop    %esi
+  800f65:	5f                   	pop    %edi
+  800f66:	5d                   	pop    %ebp
+  800f67:	c3                   	ret
+
+00800f68 <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  800f68:	55                   	push   %ebp
+  800f69:	89 e5                	mov    %esp,%ebp
+  800f6b:	57                   	push   %edi
+  800f6c:	56                   	push   %esi
+  800f6d:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800f6e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f73:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f76:	b8 14 00 00 00       	mov    $0x14,%eax
+  800f7b:	89 cb                	mov    %ecx,%ebx
+  800f7d:	89 cf                	mov    %ecx,%edi
+  800f7f:	89 ce                	mov    %ecx,%esi
+  800f81:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  800f83:	5b                   	pop    %ebx
+  800f84:	5e                   	pop    %esi
+  800f85:	5f                   	pop    %edi
+  800f86:	5d                   	pop    %ebp
+  800f87:	c3                   	ret
+
+00800f88 <pgfault>:
+//
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf) {
+  800f88:	55                   	push   %ebp
+  800f89:	89 e5                	mov    %esp,%ebp
+  800f8b:	53                   	push   %ebx
+  800f8c:	83 ec 04             	sub    $0x4,%esp
+  800f8f:	8b 45 08             	mov    0x8(%ebp),%eax
+    void *addr = (void *) utf->utf_fault_va;
+  800f92:	8b 18                	mov    (%eax),%ebx
+    // Hint:
+    //   Use the read-only page table mappings at uvpt
+    //   (see <inc/memlayout.h>).
+
+    // LAB 4: Your code here.
+    if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P) ||
+  800f94:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  800f98:	0f 84 95 00 00 00    	je     801033 <pgfault+0xab>
+  800f9e:	89 d8                	mov    %ebx,%eax
+  800fa0:	c1 e8 16             	shr    $0x16,%eax
+  800fa3:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  800faa:	a8 01                	test   $0x1,%al
+  800fac:	0f 84 81 00 00 00    	je     801033 <pgfault+0xab>
+        (uvpt[PGNUM(addr)] & (PTE_P | PTE_COW)) != (PTE_P | PTE_COW)) {
+  800fb2:	89 d8                	mov    %ebx,%eax
+  800fb4:	c1 e8 0c             	shr    $0xc,%eax
+  800fb7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800fbe:	25 01 08 00 00       	and    $0x801,%eax
+    if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P) ||
+  800fc3:	3d 01 08 00 00       	cmp    $0x801,%eax
+  800fc8:	75 69                	jne    801033 <pgfault+0xab>
+    // Hint:
+    //   You should make three system calls.
+
+    // LAB 4: Your code here.
+
+    if (sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W))
+  800fca:	83 ec 04             	sub    $0x4,%esp
+  800fcd:	6a 07                	push   $0x7
+  800fcf:	68 00 f0 7f 00       	push   $0x7ff000
+  800fd4:	6a 00                	push   $0x0
+  800fd6:	e8 da fc ff ff       	call   800cb5 <sys_page_alloc>
+  800fdb:	83 c4 10             	add    $0x10,%esp
+  800fde:	85 c0                	test   %eax,%eax
+  800fe0:	75 65                	jne    801047 <pgfault+0xbf>
+        panic("sys_page_alloc failed");
+
+    addr = ROUNDDOWN(addr, PGSIZE);
+  800fe2:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+    memmove(PFTEMP, addr, PGSIZE);
+  800fe8:	83 ec 04             	sub    $0x4,%esp
+  800feb:	68 00 10 00 00       	push   $0x1000
+  800ff0:	53                   	push   %ebx
+  800ff1:	68 00 f0 7f 00       	push   $0x7ff000
+  800ff6:	e8 54 fa ff ff       	call   800a4f <memmove>
+
+    if (sys_page_map(0, PFTEMP, 0, addr, PTE_P | PTE_U | PTE_W))
+  800ffb:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801002:	53                   	push   %ebx
+  801003:	6a 00                	push   $0x0
+  801005:	68 00 f0 7f 00       	push   $0x7ff000
+  80100a:	6a 00                	push   $0x0
+  80100c:	e8 e7 fc ff ff       	call   800cf8 <sys_page_map>
+  801011:	83 c4 20             	add    $0x20,%esp
+  801014:	85 c0                	test   %eax,%eax
+  801016:	75 43                	jne    80105b <pgfault+0xd3>
+        panic("sys_page_map failed");
+    if (sys_page_unmap(0, PFTEMP))
+  801018:	83 ec 08             	sub    $0x8,%esp
+  80101b:	68 00 f0 7f 00       	push   $0x7ff000
+  801020:	6a 00                	push   $0x0
+  801022:	e8 13 fd ff ff       	call   800d3a <sys_page_unmap>
+  801027:	83 c4 10             	add    $0x10,%esp
+  80102a:	85 c0                	test   %eax,%eax
+  80102c:	75 41                	jne    80106f <pgfault+0xe7>
+        panic("sys_page_unmap failed");
+
+}
+  80102e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801031:	c9                   	leave
+  801032:	c3                   	ret
+        panic("pgfault: faulting access invalid");
+  801033:	83 ec 04             	sub    $0x4,%esp
+  801036:	68 70 2e 80 00       	push   $0x802e70
+  80103b:	6a 1e                	push   $0x1e
+  80103d:	68 dc 2e 80 00       	push   $0x802edc
+  801042:	e8 ee f1 ff ff       	call   800235 <_panic>
+        panic("sys_page_alloc failed");
+  801047:	83 ec 04             	sub    $0x4,%esp
+  80104a:	68 4f 2f 80 00       	push   $0x802f4f
+  80104f:	6a 2a                	push   $0x2a
+  801051:	68 dc 2e 80 00       	push   $0x802edc
+  801056:	e8 da f1 ff ff       	call   800235 <_panic>
+        panic("sys_page_map failed");
+  80105b:	83 ec 04             	sub    $0x4,%esp
+  80105e:	68 e7 2e 80 00       	push   $0x802ee7
+  801063:	6a 30                	push   $0x30
+  801065:	68 dc 2e 80 00       	push   $0x802edc
+  80106a:	e8 c6 f1 ff ff       	call   800235 <_panic>
+        panic("sys_page_unmap failed");
+  80106f:	83 ec 04             	sub    $0x4,%esp
+  801072:	68 fb 2e 80 00       	push   $0x802efb
+  801077:	6a 32                	push   $0x32
+  801079:	68 dc 2e 80 00       	push   $0x802edc
+  80107e:	e8 b2 f1 ff ff       	call   800235 <_panic>
+
+00801083 <fork>:
+//   Remember to fix "thisenv" in the child process.
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void) {
+  801083:	55                   	push   %ebp
+  801084:	89 e5                	mov    %esp,%ebp
+  801086:	57                   	push   %edi
+  801087:	56                   	push   %esi
+  801088:	53                   	push   %ebx
+  801089:	83 ec 18             	sub    $0x18,%esp
+    // LAB 4: Your code here.
+    set_pgfault_handler(pgfault);
+  80108c:	68 88 0f 80 00       	push   $0x800f88
+  801091:	e8 1a 13 00 00       	call   8023b0 <set_pgfault_handler>
+
+// This must be inlined.  Exercise for reader: why?
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+  envid_t ret;
+  asm volatile("int %2"
+  801096:	b8 07 00 00 00       	mov    $0x7,%eax
+  80109b:	cd 30                	int    $0x30
+  80109d:	89 c6                	mov    %eax,%esi
+
+    envid_t envid = sys_exofork();
+    if (envid < 0)
+  80109f:	83 c4 10             	add    $0x10,%esp
+  8010a2:	85 c0                	test   %eax,%eax
+  8010a4:	78 2a                	js     8010d0 <fork+0x4d>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+
+    uintptr_t addr;
+    for (addr = 0; addr < UTOP; addr += PGSIZE) {
+  8010a6:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (envid == 0) {
+  8010ab:	0f 85 a2 00 00 00    	jne    801153 <fork+0xd0>
+        thisenv = &envs[ENVX(sys_getenvid())];
+  8010b1:	e8 c1 fb ff ff       	call   800c77 <sys_getenvid>
+  8010b6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8010bb:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8010be:	c1 e0 04             	shl    $0x4,%eax
+  8010c1:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8010c6:	a3 08 50 80 00       	mov    %eax,0x805008
+        return 0;
+  8010cb:	e9 6c 01 00 00       	jmp    80123c <fork+0x1b9>
+        panic("fork: sys_exofork error: %e", envid);
+  8010d0:	50                   	push   %eax
+  8010d1:	68 11 2f 80 00       	push   $0x802f11
+  8010d6:	6a 6f                	push   $0x6f
+  8010d8:	68 dc 2e 80 00       	push   $0x802edc
+  8010dd:	e8 53 f1 ff ff       	call   800235 <_panic>
+        if ((r = sys_page_map(0, vptr, envid, vptr, uvpt[pn] & PTE_SYSCALL)) < 0)
+  8010e2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8010e9:	83 ec 0c             	sub    $0xc,%esp
+  8010ec:	25 07 0e 00 00       	and    $0xe07,%eax
+  8010f1:	50                   	push   %eax
+  8010f2:	57                   	push   %edi
+  8010f3:	56                   	push   %esi
+  8010f4:	57                   	push   %edi
+  8010f5:	6a 00                	push   $0x0
+  8010f7:	e8 fc fb ff ff       	call   800cf8 <sys_page_map>
+  8010fc:	83 c4 20             	add    $0x20,%esp
+  8010ff:	85 c0                	test   %eax,%eax
+  801101:	79 3e                	jns    801141 <fork+0xbe>
+            panic("duppage :in sys_page_map %e", r);
+  801103:	50                   	push   %eax
+  801104:	68 2d 2f 80 00       	push   $0x802f2d
+  801109:	6a 49                	push   $0x49
+  80110b:	68 dc 2e 80 00       	push   $0x802edc
+  801110:	e8 20 f1 ff ff       	call   800235 <_panic>
+            panic("duppage :in sys_page_map %e", r);
+  801115:	50                   	push   %eax
+  801116:	68 2d 2f 80 00       	push   $0x802f2d
+  80111b:	6a 4e                	push   $0x4e
+  80111d:	68 dc 2e 80 00       	push   $0x802edc
+  801122:	e8 0e f1 ff ff       	call   800235 <_panic>
+    } else if ((r = sys_page_map(0, vptr, envid, vptr, PTE_P | PTE_U)) < 0)
+  801127:	83 ec 0c             	sub    $0xc,%esp
+  80112a:	6a 05                	push   $0x5
+  80112c:	57                   	push   %edi
+  80112d:	56                   	push   %esi
+  80112e:	57                   	push   %edi
+  80112f:	6a 00                	push   $0x0
+  801131:	e8 c2 fb ff ff       	call   800cf8 <sys_page_map>
+  801136:	83 c4 20             	add    $0x20,%esp
+  801139:	85 c0                	test   %eax,%eax
+  80113b:	0f 88 ab 00 00 00    	js     8011ec <fork+0x169>
+    for (addr = 0; addr < UTOP; addr += PGSIZE) {
+  801141:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801147:	81 fb 00 00 c0 ee    	cmp    $0xeec00000,%ebx
+  80114d:	0f 84 ab 00 00 00    	je     8011fe <fork+0x17b>
+        if (uvpd[PDX(addr)] & PTE_P && uvpt[PGNUM(addr)] & PTE_P && addr != UXSTACKTOP - PGSIZE) {
+  801153:	89 d8                	mov    %ebx,%eax
+  801155:	c1 e8 16             	shr    $0x16,%eax
+  801158:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80115f:	a8 01                	test   $0x1,%al
+  801161:	74 de                	je     801141 <fork+0xbe>
+  801163:	89 d8                	mov    %ebx,%eax
+  801165:	c1 e8 0c             	shr    $0xc,%eax
+  801168:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80116f:	f6 c2 01             	test   $0x1,%dl
+  801172:	74 cd                	je     801141 <fork+0xbe>
+  801174:	81 fb 00 f0 bf ee    	cmp    $0xeebff000,%ebx
+  80117a:	74 c5                	je     801141 <fork+0xbe>
+    void *vptr = (void *) (pn * PGSIZE);
+  80117c:	89 c7                	mov    %eax,%edi
+  80117e:	c1 e7 0c             	shl    $0xc,%edi
+    if (uvpt[pn] & PTE_SHARE) {
+  801181:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801188:	f6 c6 04             	test   $0x4,%dh
+  80118b:	0f 85 51 ff ff ff    	jne    8010e2 <fork+0x5f>
+    } else if (uvpt[pn] & (PTE_W | PTE_COW)) {
+  801191:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801198:	a9 02 08 00 00       	test   $0x802,%eax
+  80119d:	74 88                	je     801127 <fork+0xa4>
+        if ((r = sys_page_map(0, vptr, envid, vptr, PTE_P | PTE_U | PTE_COW)) < 0)
+  80119f:	83 ec 0c             	sub    $0xc,%esp
+  8011a2:	68 05 08 00 00       	push   $0x805
+  8011a7:	57                   	push   %edi
+  8011a8:	56                   	push   %esi
+  8011a9:	57                   	push   %edi
+  8011aa:	6a 00                	push   $0x0
+  8011ac:	e8 47 fb ff ff       	call   800cf8 <sys_page_map>
+  8011b1:	83 c4 20             	add    $0x20,%esp
+  8011b4:	85 c0                	test   %eax,%eax
+  8011b6:	0f 88 59 ff ff ff    	js     801115 <fork+0x92>
+        if ((r = sys_page_map(0, vptr, 0, vptr, PTE_P | PTE_U | PTE_COW)) < 0)
+  8011bc:	83 ec 0c             	sub    $0xc,%esp
+  8011bf:	68 05 08 00 00       	push   $0x805
+  8011c4:	57                   	push   %edi
+  8011c5:	6a 00                	push   $0x0
+  8011c7:	57                   	push   %edi
+  8011c8:	6a 00                	push   $0x0
+  8011ca:	e8 29 fb ff ff       	call   800cf8 <sys_page_map>
+  8011cf:	83 c4 20             	add    $0x20,%esp
+  8011d2:	85 c0                	test   %eax,%eax
+  8011d4:	0f 89 67 ff ff ff    	jns    801141 <fork+0xbe>
+            panic("duppage :in sys_page_map %e", r);
+  8011da:	50                   	push   %eax
+  8011db:	68 2d 2f 80 00       	push   $0x802f2d
+  8011e0:	6a 50                	push   $0x50
+  8011e2:	68 dc 2e 80 00       	push   $0x802edc
+  8011e7:	e8 49 f0 ff ff       	call   800235 <_panic>
+        panic("duppage :in sys_page_map %e", r);
+  8011ec:	50                   	push   %eax
+  8011ed:	68 2d 2f 80 00       	push   $0x802f2d
+  8011f2:	6a 53                	push   $0x53
+  8011f4:	68 dc 2e 80 00       	push   $0x802edc
+  8011f9:	e8 37 f0 ff ff       	call   800235 <_panic>
+            duppage(envid, PGNUM(addr));
+        }
+    }
+    if (sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W))
+  8011fe:	83 ec 04             	sub    $0x4,%esp
+  801201:	6a 07                	push   $0x7
+  801203:	68 00 f0 bf ee       	push   $0xeebff000
+  801208:	56                   	push   %esi
+  801209:	e8 a7 fa ff ff       	call   800cb5 <sys_page_alloc>
+  80120e:	83 c4 10             	add    $0x10,%esp
+  801211:	85 c0                	test   %eax,%eax
+  801213:	75 31                	jne    801246 <fork+0x1c3>
+        panic("fork: sys_page_alloc failed");
+    if (sys_env_set_pgfault_upcall(envid, _pgfault_upcall))
+  801215:	83 ec 08             	sub    $0x8,%esp
+  801218:	68 1b 24 80 00       	push   $0x80241b
+  80121d:	56                   	push   %esi
+  80121e:	e8 dd fb ff ff       	call   800e00 <sys_env_set_pgfault_upcall>
+  801223:	83 c4 10             	add    $0x10,%esp
+  801226:	85 c0                	test   %eax,%eax
+  801228:	75 30                	jne    80125a <fork+0x1d7>
+        panic("fork: sys_env_set_pgfault_upcall failed");
+    if (sys_env_set_status(envid, ENV_RUNNABLE))
+  80122a:	83 ec 08             	sub    $0x8,%esp
+  80122d:	6a 02                	push   $0x2
+  80122f:	56                   	push   %esi
+  801230:	e8 47 fb ff ff       	call   800d7c <sys_env_set_status>
+  801235:	83 c4 10             	add    $0x10,%esp
+  801238:	85 c0                	test   %eax,%eax
+  80123a:	75 32                	jne    80126e <fork+0x1eb>
+        panic("fork: sys_env_set_status failed");
+
+    return envid;
+
+}
+  80123c:	89 f0                	mov    %esi,%eax
+  80123e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801241:	5b                   	pop    %ebx
+  801242:	5e                   	pop    %esi
+  801243:	5f                   	pop    %edi
+  801244:	5d                   	pop    %ebp
+  801245:	c3                   	ret
+        panic("fork: sys_page_alloc failed");
+  801246:	83 ec 04             	sub    $0x4,%esp
+  801249:	68 49 2f 80 00       	push   $0x802f49
+  80124e:	6a 7d                	push   $0x7d
+  801250:	68 dc 2e 80 00       	push   $0x802edc
+  801255:	e8 db ef ff ff       	call   800235 <_panic>
+        panic("fork: sys_env_set_pgfault_upcall failed");
+  80125a:	83 ec 04             	sub    $0x4,%esp
+  80125d:	68 94 2e 80 00       	push   $0x802e94
+  801262:	6a 7f                	push   $0x7f
+  801264:	68 dc 2e 80 00       	push   $0x802edc
+  801269:	e8 c7 ef ff ff       	call   800235 <_panic>
+        panic("fork: sys_env_set_status failed");
+  80126e:	83 ec 04             	sub    $0x4,%esp
+  801271:	68 bc 2e 80 00       	push   $0x802ebc
+  801276:	68 81 00 00 00       	push   $0x81
+  80127b:	68 dc 2e 80 00       	push   $0x802edc
+  801280:	e8 b0 ef ff ff       	call   800235 <_panic>
+
+00801285 <sfork>:
+
+// Challenge!
+int
+sfork(void) {
+  801285:	55                   	push   %ebp
+  801286:	89 e5                	mov    %esp,%ebp
+  801288:	83 ec 0c             	sub    $0xc,%esp
+    panic("sfork not implemented");
+  80128b:	68 65 2f 80 00       	push   $0x802f65
+  801290:	68 8a 00 00 00       	push   $0x8a
+  801295:	68 dc 2e 80 00       	push   $0x802edc
+  80129a:	e8 96 ef ff ff       	call   800235 <_panic>
+
+0080129f <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80129f:	55                   	push   %ebp
+  8012a0:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8012a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8012a5:	05 00 00 00 30       	add    $0x30000000,%eax
+  8012aa:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8012ad:	5d                   	pop    %ebp
+  8012ae:	c3                   	ret
+
+008012af <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8012af:	55                   	push   %ebp
+  8012b0:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8012b2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8012b5:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8012ba:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8012bf:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8012c4:	5d                   	pop    %ebp
+  8012c5:	c3                   	ret
+
+008012c6 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8012c6:	55                   	push   %ebp
+  8012c7:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8012c9:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8012ce:	eb 02                	jmp    8012d2 <fd_alloc+0xc>
+  8012d0:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8012d2:	89 c2                	mov    %eax,%edx
+  8012d4:	c1 ea 16             	shr    $0x16,%edx
+  8012d7:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8012de:	f6 c2 01             	test   $0x1,%dl
+  8012e1:	74 2b                	je     80130e <fd_alloc+0x48>
+  8012e3:	89 c2                	mov    %eax,%edx
+  8012e5:	c1 ea 0c             	shr    $0xc,%edx
+  8012e8:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8012ef:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8012f5:	f6 c1 01             	test   $0x1,%cl
+  8012f8:	74 14                	je     80130e <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8012fa:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801300:	75 ce                	jne    8012d0 <fd_alloc+0xa>
+  801302:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801307:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80130c:	eb 05                	jmp    801313 <fd_alloc+0x4d>
+			return 0;
+  80130e:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801313:	8b 55 08             	mov    0x8(%ebp),%edx
+  801316:	89 02                	mov    %eax,(%edx)
+}
+  801318:	89 c8                	mov    %ecx,%eax
+  80131a:	5d                   	pop    %ebp
+  80131b:	c3                   	ret
+
+0080131c <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80131c:	55                   	push   %ebp
+  80131d:	89 e5                	mov    %esp,%ebp
+  80131f:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801322:	83 f8 1f             	cmp    $0x1f,%eax
+  801325:	77 30                	ja     801357 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801327:	c1 e0 0c             	shl    $0xc,%eax
+  80132a:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80132f:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801335:	f6 c2 01             	test   $0x1,%dl
+  801338:	74 24                	je     80135e <fd_lookup+0x42>
+  80133a:	89 c2                	mov    %eax,%edx
+  80133c:	c1 ea 0c             	shr    $0xc,%edx
+  80133f:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801346:	f6 c2 01             	test   $0x1,%dl
+  801349:	74 1a                	je     801365 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80134b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80134e:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801350:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801355:	5d                   	pop    %ebp
+  801356:	c3                   	ret
+		return -E_INVAL;
+  801357:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80135c:	eb f7                	jmp    801355 <fd_lookup+0x39>
+		return -E_INVAL;
+  80135e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801363:	eb f0                	jmp    801355 <fd_lookup+0x39>
+  801365:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80136a:	eb e9                	jmp    801355 <fd_lookup+0x39>
+
+0080136c <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80136c:	55                   	push   %ebp
+  80136d:	89 e5                	mov    %esp,%ebp
+  80136f:	53                   	push   %ebx
+  801370:	83 ec 04             	sub    $0x4,%esp
+  801373:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801376:	b8 00 00 00 00       	mov    $0x0,%eax
+  80137b:	eb 03                	jmp    801380 <dev_lookup+0x14>
+  80137d:	83 c0 01             	add    $0x1,%eax
+  801380:	8b 1c 85 f8 2f 80 00 	mov    0x802ff8(,%eax,4),%ebx
+  801387:	85 db                	test   %ebx,%ebx
+  801389:	74 0b                	je     801396 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  80138b:	39 13                	cmp    %edx,(%ebx)
+  80138d:	75 ee                	jne    80137d <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  80138f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801394:	eb 1f                	jmp    8013b5 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801396:	a1 08 50 80 00       	mov    0x805008,%eax
+  80139b:	8b 40 48             	mov    0x48(%eax),%eax
+  80139e:	83 ec 04             	sub    $0x4,%esp
+  8013a1:	52                   	push   %edx
+  8013a2:	50                   	push   %eax
+  8013a3:	68 7c 2f 80 00       	push   $0x802f7c
+  8013a8:	e8 63 ef ff ff       	call   800310 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8013ad:	83 c4 10             	add    $0x10,%esp
+  8013b0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8013b5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8013b8:	89 1a                	mov    %ebx,(%edx)
+}
+  8013ba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013bd:	c9                   	leave
+  8013be:	c3                   	ret
+
+008013bf <fd_close>:
+{
+  8013bf:	55                   	push   %ebp
+  8013c0:	89 e5                	mov    %esp,%ebp
+  8013c2:	57                   	push   %edi
+  8013c3:	56                   	push   %esi
+  8013c4:	53                   	push   %ebx
+  8013c5:	83 ec 24             	sub    $0x24,%esp
+  8013c8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8013cb:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8013ce:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8013d1:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8013d2:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8013d8:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8013db:	50                   	push   %eax
+  8013dc:	e8 3b ff ff ff       	call   80131c <fd_lookup>
+  8013e1:	89 c3                	mov    %eax,%ebx
+  8013e3:	83 c4 10             	add    $0x10,%esp
+  8013e6:	85 c0                	test   %eax,%eax
+  8013e8:	78 05                	js     8013ef <fd_close+0x30>
+	    || fd != fd2)
+  8013ea:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8013ed:	74 16                	je     801405 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8013ef:	89 f8                	mov    %edi,%eax
+  8013f1:	84 c0                	test   %al,%al
+  8013f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013f8:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8013fb:	89 d8                	mov    %ebx,%eax
+  8013fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801400:	5b                   	pop    %ebx
+  801401:	5e                   	pop    %esi
+  801402:	5f                   	pop    %edi
+  801403:	5d                   	pop    %ebp
+  801404:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801405:	83 ec 08             	sub    $0x8,%esp
+  801408:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80140b:	50                   	push   %eax
+  80140c:	ff 36                	push   (%esi)
+  80140e:	e8 59 ff ff ff       	call   80136c <dev_lookup>
+  801413:	89 c3                	mov    %eax,%ebx
+  801415:	83 c4 10             	add    $0x10,%esp
+  801418:	85 c0                	test   %eax,%eax
+  80141a:	78 1a                	js     801436 <fd_close+0x77>
+		if (dev->dev_close)
+  80141c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80141f:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801422:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801427:	85 c0                	test   %eax,%eax
+  801429:	74 0b                	je     801436 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80142b:	83 ec 0c             	sub    $0xc,%esp
+  80142e:	56                   	push   %esi
+  80142f:	ff d0                	call   *%eax
+  801431:	89 c3                	mov    %eax,%ebx
+  801433:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801436:	83 ec 08             	sub    $0x8,%esp
+  801439:	56                   	push   %esi
+  80143a:	6a 00                	push   $0x0
+  80143c:	e8 f9 f8 ff ff       	call   800d3a <sys_page_unmap>
+	return r;
+  801441:	83 c4 10             	add    $0x10,%esp
+  801444:	eb b5                	jmp    8013fb <fd_close+0x3c>
+
+00801446 <close>:
+
+int
+close(int fdnum)
+{
+  801446:	55                   	push   %ebp
+  801447:	89 e5                	mov    %esp,%ebp
+  801449:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80144c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80144f:	50                   	push   %eax
+  801450:	ff 75 08             	push   0x8(%ebp)
+  801453:	e8 c4 fe ff ff       	call   80131c <fd_lookup>
+  801458:	83 c4 10             	add    $0x10,%esp
+  80145b:	85 c0                	test   %eax,%eax
+  80145d:	79 02                	jns    801461 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80145f:	c9                   	leave
+  801460:	c3                   	ret
+		return fd_close(fd, 1);
+  801461:	83 ec 08             	sub    $0x8,%esp
+  801464:	6a 01                	push   $0x1
+  801466:	ff 75 f4             	push   -0xc(%ebp)
+  801469:	e8 51 ff ff ff       	call   8013bf <fd_close>
+  80146e:	83 c4 10             	add    $0x10,%esp
+  801471:	eb ec                	jmp    80145f <close+0x19>
+
+00801473 <close_all>:
+
+void
+close_all(void)
+{
+  801473:	55                   	push   %ebp
+  801474:	89 e5                	mov    %esp,%ebp
+  801476:	53                   	push   %ebx
+  801477:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80147a:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80147f:	83 ec 0c             	sub    $0xc,%esp
+  801482:	53                   	push   %ebx
+  801483:	e8 be ff ff ff       	call   801446 <close>
+	for (i = 0; i < MAXFD; i++)
+  801488:	83 c3 01             	add    $0x1,%ebx
+  80148b:	83 c4 10             	add    $0x10,%esp
+  80148e:	83 fb 20             	cmp    $0x20,%ebx
+  801491:	75 ec                	jne    80147f <close_all+0xc>
+}
+  801493:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801496:	c9                   	leave
+  801497:	c3                   	ret
+
+00801498 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801498:	55                   	push   %ebp
+  801499:	89 e5                	mov    %esp,%ebp
+  80149b:	57                   	push   %edi
+  80149c:	56                   	push   %esi
+  80149d:	53                   	push   %ebx
+  80149e:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8014a1:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8014a4:	50                   	push   %eax
+  8014a5:	ff 75 08             	push   0x8(%ebp)
+  8014a8:	e8 6f fe ff ff       	call   80131c <fd_lookup>
+  8014ad:	89 c3                	mov    %eax,%ebx
+  8014af:	83 c4 10             	add    $0x10,%esp
+  8014b2:	85 c0                	test   %eax,%eax
+  8014b4:	78 7f                	js     801535 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8014b6:	83 ec 0c             	sub    $0xc,%esp
+  8014b9:	ff 75 0c             	push   0xc(%ebp)
+  8014bc:	e8 85 ff ff ff       	call   801446 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8014c1:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8014c4:	c1 e6 0c             	shl    $0xc,%esi
+  8014c7:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8014cd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8014d0:	89 3c 24             	mov    %edi,(%esp)
+  8014d3:	e8 d7 fd ff ff       	call   8012af <fd2data>
+  8014d8:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8014da:	89 34 24             	mov    %esi,(%esp)
+  8014dd:	e8 cd fd ff ff       	call   8012af <fd2data>
+  8014e2:	83 c4 10             	add    $0x10,%esp
+  8014e5:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8014e8:	89 d8                	mov    %ebx,%eax
+  8014ea:	c1 e8 16             	shr    $0x16,%eax
+  8014ed:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8014f4:	a8 01                	test   $0x1,%al
+  8014f6:	74 11                	je     801509 <dup+0x71>
+  8014f8:	89 d8                	mov    %ebx,%eax
+  8014fa:	c1 e8 0c             	shr    $0xc,%eax
+  8014fd:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801504:	f6 c2 01             	test   $0x1,%dl
+  801507:	75 36                	jne    80153f <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801509:	89 f8                	mov    %edi,%eax
+  80150b:	c1 e8 0c             	shr    $0xc,%eax
+  80150e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801515:	83 ec 0c             	sub    $0xc,%esp
+  801518:	25 07 0e 00 00       	and    $0xe07,%eax
+  80151d:	50                   	push   %eax
+  80151e:	56                   	push   %esi
+  80151f:	6a 00                	push   $0x0
+  801521:	57                   	push   %edi
+  801522:	6a 00                	push   $0x0
+  801524:	e8 cf f7 ff ff       	call   800cf8 <sys_page_map>
+  801529:	89 c3                	mov    %eax,%ebx
+  80152b:	83 c4 20             	add    $0x20,%esp
+  80152e:	85 c0                	test   %eax,%eax
+  801530:	78 33                	js     801565 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801532:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801535:	89 d8                	mov    %ebx,%eax
+  801537:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80153a:	5b                   	pop    %ebx
+  80153b:	5e                   	pop    %esi
+  80153c:	5f                   	pop    %edi
+  80153d:	5d                   	pop    %ebp
+  80153e:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80153f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801546:	83 ec 0c             	sub    $0xc,%esp
+  801549:	25 07 0e 00 00       	and    $0xe07,%eax
+  80154e:	50                   	push   %eax
+  80154f:	ff 75 d4             	push   -0x2c(%ebp)
+  801552:	6a 00                	push   $0x0
+  801554:	53                   	push   %ebx
+  801555:	6a 00                	push   $0x0
+  801557:	e8 9c f7 ff ff       	call   800cf8 <sys_page_map>
+  80155c:	89 c3                	mov    %eax,%ebx
+  80155e:	83 c4 20             	add    $0x20,%esp
+  801561:	85 c0                	test   %eax,%eax
+  801563:	79 a4                	jns    801509 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801565:	83 ec 08             	sub    $0x8,%esp
+  801568:	56                   	push   %esi
+  801569:	6a 00                	push   $0x0
+  80156b:	e8 ca f7 ff ff       	call   800d3a <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801570:	83 c4 08             	add    $0x8,%esp
+  801573:	ff 75 d4             	push   -0x2c(%ebp)
+  801576:	6a 00                	push   $0x0
+  801578:	e8 bd f7 ff ff       	call   800d3a <sys_page_unmap>
+	return r;
+  80157d:	83 c4 10             	add    $0x10,%esp
+  801580:	eb b3                	jmp    801535 <dup+0x9d>
+
+00801582 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801582:	55                   	push   %ebp
+  801583:	89 e5                	mov    %esp,%ebp
+  801585:	56                   	push   %esi
+  801586:	53                   	push   %ebx
+  801587:	83 ec 18             	sub    $0x18,%esp
+  80158a:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80158d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801590:	50                   	push   %eax
+  801591:	56                   	push   %esi
+  801592:	e8 85 fd ff ff       	call   80131c <fd_lookup>
+  801597:	83 c4 10             	add    $0x10,%esp
+  80159a:	85 c0                	test   %eax,%eax
+  80159c:	78 3c                	js     8015da <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80159e:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8015a1:	83 ec 08             	sub    $0x8,%esp
+  8015a4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015a7:	50                   	push   %eax
+  8015a8:	ff 33                	push   (%ebx)
+  8015aa:	e8 bd fd ff ff       	call   80136c <dev_lookup>
+  8015af:	83 c4 10             	add    $0x10,%esp
+  8015b2:	85 c0                	test   %eax,%eax
+  8015b4:	78 24                	js     8015da <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8015b6:	8b 43 08             	mov    0x8(%ebx),%eax
+  8015b9:	83 e0 03             	and    $0x3,%eax
+  8015bc:	83 f8 01             	cmp    $0x1,%eax
+  8015bf:	74 20                	je     8015e1 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8015c1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015c4:	8b 40 08             	mov    0x8(%eax),%eax
+  8015c7:	85 c0                	test   %eax,%eax
+  8015c9:	74 37                	je     801602 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8015cb:	83 ec 04             	sub    $0x4,%esp
+  8015ce:	ff 75 10             	push   0x10(%ebp)
+  8015d1:	ff 75 0c             	push   0xc(%ebp)
+  8015d4:	53                   	push   %ebx
+  8015d5:	ff d0                	call   *%eax
+  8015d7:	83 c4 10             	add    $0x10,%esp
+}
+  8015da:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015dd:	5b                   	pop    %ebx
+  8015de:	5e                   	pop    %esi
+  8015df:	5d                   	pop    %ebp
+  8015e0:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8015e1:	a1 08 50 80 00       	mov    0x805008,%eax
+  8015e6:	8b 40 48             	mov    0x48(%eax),%eax
+  8015e9:	83 ec 04             	sub    $0x4,%esp
+  8015ec:	56                   	push   %esi
+  8015ed:	50                   	push   %eax
+  8015ee:	68 bd 2f 80 00       	push   $0x802fbd
+  8015f3:	e8 18 ed ff ff       	call   800310 <cprintf>
+		return -E_INVAL;
+  8015f8:	83 c4 10             	add    $0x10,%esp
+  8015fb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801600:	eb d8                	jmp    8015da <read+0x58>
+		return -E_NOT_SUPP;
+  801602:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801607:	eb d1                	jmp    8015da <read+0x58>
+
+00801609 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801609:	55                   	push   %ebp
+  80160a:	89 e5                	mov    %esp,%ebp
+  80160c:	57                   	push   %edi
+  80160d:	56                   	push   %esi
+  80160e:	53                   	push   %ebx
+  80160f:	83 ec 0c             	sub    $0xc,%esp
+  801612:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801615:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801618:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80161d:	eb 02                	jmp    801621 <readn+0x18>
+  80161f:	01 c3                	add    %eax,%ebx
+  801621:	39 f3                	cmp    %esi,%ebx
+  801623:	73 21                	jae    801646 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801625:	83 ec 04             	sub    $0x4,%esp
+  801628:	89 f0                	mov    %esi,%eax
+  80162a:	29 d8                	sub    %ebx,%eax
+  80162c:	50                   	push   %eax
+  80162d:	89 d8                	mov    %ebx,%eax
+  80162f:	03 45 0c             	add    0xc(%ebp),%eax
+  801632:	50                   	push   %eax
+  801633:	57                   	push   %edi
+  801634:	e8 49 ff ff ff       	call   801582 <read>
+		if (m < 0)
+  801639:	83 c4 10             	add    $0x10,%esp
+  80163c:	85 c0                	test   %eax,%eax
+  80163e:	78 04                	js     801644 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801640:	75 dd                	jne    80161f <readn+0x16>
+  801642:	eb 02                	jmp    801646 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801644:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801646:	89 d8                	mov    %ebx,%eax
+  801648:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80164b:	5b                   	pop    %ebx
+  80164c:	5e                   	pop    %esi
+  80164d:	5f                   	pop    %edi
+  80164e:	5d                   	pop    %ebp
+  80164f:	c3                   	ret
+
+00801650 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801650:	55                   	push   %ebp
+  801651:	89 e5                	mov    %esp,%ebp
+  801653:	56                   	push   %esi
+  801654:	53                   	push   %ebx
+  801655:	83 ec 18             	sub    $0x18,%esp
+  801658:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80165b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80165e:	50                   	push   %eax
+  80165f:	53                   	push   %ebx
+  801660:	e8 b7 fc ff ff       	call   80131c <fd_lookup>
+  801665:	83 c4 10             	add    $0x10,%esp
+  801668:	85 c0                	test   %eax,%eax
+  80166a:	78 37                	js     8016a3 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80166c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80166f:	83 ec 08             	sub    $0x8,%esp
+  801672:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801675:	50                   	push   %eax
+  801676:	ff 36                	push   (%esi)
+  801678:	e8 ef fc ff ff       	call   80136c <dev_lookup>
+  80167d:	83 c4 10             	add    $0x10,%esp
+  801680:	85 c0                	test   %eax,%eax
+  801682:	78 1f                	js     8016a3 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801684:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801688:	74 20                	je     8016aa <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80168a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80168d:	8b 40 0c             	mov    0xc(%eax),%eax
+  801690:	85 c0                	test   %eax,%eax
+  801692:	74 37                	je     8016cb <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801694:	83 ec 04             	sub    $0x4,%esp
+  801697:	ff 75 10             	push   0x10(%ebp)
+  80169a:	ff 75 0c             	push   0xc(%ebp)
+  80169d:	56                   	push   %esi
+  80169e:	ff d0                	call   *%eax
+  8016a0:	83 c4 10             	add    $0x10,%esp
+}
+  8016a3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016a6:	5b                   	pop    %ebx
+  8016a7:	5e                   	pop    %esi
+  8016a8:	5d                   	pop    %ebp
+  8016a9:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8016aa:	a1 08 50 80 00       	mov    0x805008,%eax
+  8016af:	8b 40 48             	mov    0x48(%eax),%eax
+  8016b2:	83 ec 04             	sub    $0x4,%esp
+  8016b5:	53                   	push   %ebx
+  8016b6:	50                   	push   %eax
+  8016b7:	68 d9 2f 80 00       	push   $0x802fd9
+  8016bc:	e8 4f ec ff ff       	call   800310 <cprintf>
+		return -E_INVAL;
+  8016c1:	83 c4 10             	add    $0x10,%esp
+  8016c4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016c9:	eb d8                	jmp    8016a3 <write+0x53>
+		return -E_NOT_SUPP;
+  8016cb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016d0:	eb d1                	jmp    8016a3 <write+0x53>
+
+008016d2 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8016d2:	55                   	push   %ebp
+  8016d3:	89 e5                	mov    %esp,%ebp
+  8016d5:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8016d8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016db:	50                   	push   %eax
+  8016dc:	ff 75 08             	push   0x8(%ebp)
+  8016df:	e8 38 fc ff ff       	call   80131c <fd_lookup>
+  8016e4:	83 c4 10             	add    $0x10,%esp
+  8016e7:	85 c0                	test   %eax,%eax
+  8016e9:	78 0e                	js     8016f9 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8016eb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8016ee:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016f1:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8016f4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8016f9:	c9                   	leave
+  8016fa:	c3                   	ret
+
+008016fb <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8016fb:	55                   	push   %ebp
+  8016fc:	89 e5                	mov    %esp,%ebp
+  8016fe:	56                   	push   %esi
+  8016ff:	53                   	push   %ebx
+  801700:	83 ec 18             	sub    $0x18,%esp
+  801703:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801706:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801709:	50                   	push   %eax
+  80170a:	53                   	push   %ebx
+  80170b:	e8 0c fc ff ff       	call   80131c <fd_lookup>
+  801710:	83 c4 10             	add    $0x10,%esp
+  801713:	85 c0                	test   %eax,%eax
+  801715:	78 34                	js     80174b <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801717:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80171a:	83 ec 08             	sub    $0x8,%esp
+  80171d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801720:	50                   	push   %eax
+  801721:	ff 36                	push   (%esi)
+  801723:	e8 44 fc ff ff       	call   80136c <dev_lookup>
+  801728:	83 c4 10             	add    $0x10,%esp
+  80172b:	85 c0                	test   %eax,%eax
+  80172d:	78 1c                	js     80174b <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80172f:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801733:	74 1d                	je     801752 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801735:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801738:	8b 40 18             	mov    0x18(%eax),%eax
+  80173b:	85 c0                	test   %eax,%eax
+  80173d:	74 34                	je     801773 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80173f:	83 ec 08             	sub    $0x8,%esp
+  801742:	ff 75 0c             	push   0xc(%ebp)
+  801745:	56                   	push   %esi
+  801746:	ff d0                	call   *%eax
+  801748:	83 c4 10             	add    $0x10,%esp
+}
+  80174b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80174e:	5b                   	pop    %ebx
+  80174f:	5e                   	pop    %esi
+  801750:	5d                   	pop    %ebp
+  801751:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801752:	a1 08 50 80 00       	mov    0x805008,%eax
+  801757:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80175a:	83 ec 04             	sub    $0x4,%esp
+  80175d:	53                   	push   %ebx
+  80175e:	50                   	push   %eax
+  80175f:	68 9c 2f 80 00       	push   $0x802f9c
+  801764:	e8 a7 eb ff ff       	call   800310 <cprintf>
+		return -E_INVAL;
+  801769:	83 c4 10             	add    $0x10,%esp
+  80176c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801771:	eb d8                	jmp    80174b <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801773:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801778:	eb d1                	jmp    80174b <ftruncate+0x50>
+
+0080177a <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80177a:	55                   	push   %ebp
+  80177b:	89 e5                	mov    %esp,%ebp
+  80177d:	56                   	push   %esi
+  80177e:	53                   	push   %ebx
+  80177f:	83 ec 18             	sub    $0x18,%esp
+  801782:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801785:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801788:	50                   	push   %eax
+  801789:	ff 75 08             	push   0x8(%ebp)
+  80178c:	e8 8b fb ff ff       	call   80131c <fd_lookup>
+  801791:	83 c4 10             	add    $0x10,%esp
+  801794:	85 c0                	test   %eax,%eax
+  801796:	78 49                	js     8017e1 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801798:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80179b:	83 ec 08             	sub    $0x8,%esp
+  80179e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017a1:	50                   	push   %eax
+  8017a2:	ff 36                	push   (%esi)
+  8017a4:	e8 c3 fb ff ff       	call   80136c <dev_lookup>
+  8017a9:	83 c4 10             	add    $0x10,%esp
+  8017ac:	85 c0                	test   %eax,%eax
+  8017ae:	78 31                	js     8017e1 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8017b0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017b3:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8017b7:	74 2f                	je     8017e8 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8017b9:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8017bc:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8017c3:	00 00 00 
+	stat->st_isdir = 0;
+  8017c6:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8017cd:	00 00 00 
+	stat->st_dev = dev;
+  8017d0:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8017d6:	83 ec 08             	sub    $0x8,%esp
+  8017d9:	53                   	push   %ebx
+  8017da:	56                   	push   %esi
+  8017db:	ff 50 14             	call   *0x14(%eax)
+  8017de:	83 c4 10             	add    $0x10,%esp
+}
+  8017e1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017e4:	5b                   	pop    %ebx
+  8017e5:	5e                   	pop    %esi
+  8017e6:	5d                   	pop    %ebp
+  8017e7:	c3                   	ret
+		return -E_NOT_SUPP;
+  8017e8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017ed:	eb f2                	jmp    8017e1 <fstat+0x67>
+
+008017ef <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8017ef:	55                   	push   %ebp
+  8017f0:	89 e5                	mov    %esp,%ebp
+  8017f2:	56                   	push   %esi
+  8017f3:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8017f4:	83 ec 08             	sub    $0x8,%esp
+  8017f7:	6a 00                	push   $0x0
+  8017f9:	ff 75 08             	push   0x8(%ebp)
+  8017fc:	e8 e4 01 00 00       	call   8019e5 <open>
+  801801:	89 c3                	mov    %eax,%ebx
+  801803:	83 c4 10             	add    $0x10,%esp
+  801806:	85 c0                	test   %eax,%eax
+  801808:	78 1b                	js     801825 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80180a:	83 ec 08             	sub    $0x8,%esp
+  80180d:	ff 75 0c             	push   0xc(%ebp)
+  801810:	50                   	push   %eax
+  801811:	e8 64 ff ff ff       	call   80177a <fstat>
+  801816:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801818:	89 1c 24             	mov    %ebx,(%esp)
+  80181b:	e8 26 fc ff ff       	call   801446 <close>
+	return r;
+  801820:	83 c4 10             	add    $0x10,%esp
+  801823:	89 f3                	mov    %esi,%ebx
+}
+  801825:	89 d8                	mov    %ebx,%eax
+  801827:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80182a:	5b                   	pop    %ebx
+  80182b:	5e                   	pop    %esi
+  80182c:	5d                   	pop    %ebp
+  80182d:	c3                   	ret
+
+0080182e <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  80182e:	55                   	push   %ebp
+  80182f:	89 e5                	mov    %esp,%ebp
+  801831:	56                   	push   %esi
+  801832:	53                   	push   %ebx
+  801833:	89 c6                	mov    %eax,%esi
+  801835:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  801837:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  80183e:	74 27                	je     801867 <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801840:	6a 07                	push   $0x7
+  801842:	68 00 60 80 00       	push   $0x806000
+  801847:	56                   	push   %esi
+  801848:	ff 35 00 50 80 00    	push   0x805000
+  80184e:	e8 60 0c 00 00       	call   8024b3 <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  801853:	83 c4 0c             	add    $0xc,%esp
+  801856:	6a 00                	push   $0x0
+  801858:	53                   	push   %ebx
+  801859:	6a 00                	push   $0x0
+  80185b:	e8 df 0b 00 00       	call   80243f <ipc_recv>
+}
+  801860:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801863:	5b                   	pop    %ebx
+  801864:	5e                   	pop    %esi
+  801865:	5d                   	pop    %ebp
+  801866:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  801867:	83 ec 0c             	sub    $0xc,%esp
+  80186a:	6a 01                	push   $0x1
+  80186c:	e8 96 0c 00 00       	call   802507 <ipc_find_env>
+  801871:	a3 00 50 80 00       	mov    %eax,0x805000
+  801876:	83 c4 10             	add    $0x10,%esp
+  801879:	eb c5                	jmp    801840 <fsipc+0x12>
+
+0080187b <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80187b:	55                   	push   %ebp
+  80187c:	89 e5                	mov    %esp,%ebp
+  80187e:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801881:	8b 45 08             	mov    0x8(%ebp),%eax
+  801884:	8b 40 0c             	mov    0xc(%eax),%eax
+  801887:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.set_size.req_size = newsize;
+  80188c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80188f:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801894:	ba 00 00 00 00       	mov    $0x0,%edx
+  801899:	b8 02 00 00 00       	mov    $0x2,%eax
+  80189e:	e8 8b ff ff ff       	call   80182e <fsipc>
+}
+  8018a3:	c9                   	leave
+  8018a4:	c3                   	ret
+
+008018a5 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8018a5:	55                   	push   %ebp
+  8018a6:	89 e5                	mov    %esp,%ebp
+  8018a8:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8018ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018ae:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018b1:	a3 00 60 80 00       	mov    %eax,0x806000
+  return fsipc(FSREQ_FLUSH, NULL);
+  8018b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018bb:	b8 06 00 00 00       	mov    $0x6,%eax
+  8018c0:	e8 69 ff ff ff       	call   80182e <fsipc>
+}
+  8018c5:	c9                   	leave
+  8018c6:	c3                   	ret
+
+008018c7 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8018c7:	55                   	push   %ebp
+  8018c8:	89 e5                	mov    %esp,%ebp
+  8018ca:	53                   	push   %ebx
+  8018cb:	83 ec 04             	sub    $0x4,%esp
+  8018ce:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8018d1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018d4:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018d7:	a3 00 60 80 00       	mov    %eax,0x806000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8018dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018e1:	b8 05 00 00 00       	mov    $0x5,%eax
+  8018e6:	e8 43 ff ff ff       	call   80182e <fsipc>
+  8018eb:	85 c0                	test   %eax,%eax
+  8018ed:	78 2c                	js     80191b <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8018ef:	83 ec 08             	sub    $0x8,%esp
+  8018f2:	68 00 60 80 00       	push   $0x806000
+  8018f7:	53                   	push   %ebx
+  8018f8:	e8 cc ef ff ff       	call   8008c9 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  8018fd:	a1 80 60 80 00       	mov    0x806080,%eax
+  801902:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801908:	a1 84 60 80 00       	mov    0x806084,%eax
+  80190d:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801913:	83 c4 10             	add    $0x10,%esp
+  801916:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80191b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80191e:	c9                   	leave
+  80191f:	c3                   	ret
+
+00801920 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801920:	55                   	push   %ebp
+  801921:	89 e5                	mov    %esp,%ebp
+  801923:	83 ec 0c             	sub    $0xc,%esp
+  801926:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801929:	8b 55 08             	mov    0x8(%ebp),%edx
+  80192c:	8b 52 0c             	mov    0xc(%edx),%edx
+  80192f:	89 15 00 60 80 00    	mov    %edx,0x806000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801935:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  80193a:	39 d0                	cmp    %edx,%eax
+  80193c:	0f 47 c2             	cmova  %edx,%eax
+  80193f:	a3 04 60 80 00       	mov    %eax,0x806004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  801944:	50                   	push   %eax
+  801945:	ff 75 0c             	push   0xc(%ebp)
+  801948:	68 08 60 80 00       	push   $0x806008
+  80194d:	e8 fd f0 ff ff       	call   800a4f <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801952:	ba 00 00 00 00       	mov    $0x0,%edx
+  801957:	b8 04 00 00 00       	mov    $0x4,%eax
+  80195c:	e8 cd fe ff ff       	call   80182e <fsipc>
+}
+  801961:	c9                   	leave
+  801962:	c3                   	ret
+
+00801963 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801963:	55                   	push   %ebp
+  801964:	89 e5                	mov    %esp,%ebp
+  801966:	56                   	push   %esi
+  801967:	53                   	push   %ebx
+  801968:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80196b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80196e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801971:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read.req_n = n;
+  801976:	89 35 04 60 80 00    	mov    %esi,0x806004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  80197c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801981:	b8 03 00 00 00       	mov    $0x3,%eax
+  801986:	e8 a3 fe ff ff       	call   80182e <fsipc>
+  80198b:	89 c3                	mov    %eax,%ebx
+  80198d:	85 c0                	test   %eax,%eax
+  80198f:	78 1f                	js     8019b0 <devfile_read+0x4d>
+  assert(r <= n);
+  801991:	39 c6                	cmp    %eax,%esi
+  801993:	72 24                	jb     8019b9 <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  801995:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80199a:	7f 33                	jg     8019cf <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80199c:	83 ec 04             	sub    $0x4,%esp
+  80199f:	50                   	push   %eax
+  8019a0:	68 00 60 80 00       	push   $0x806000
+  8019a5:	ff 75 0c             	push   0xc(%ebp)
+  8019a8:	e8 a2 f0 ff ff       	call   800a4f <memmove>
+  return r;
+  8019ad:	83 c4 10             	add    $0x10,%esp
+}
+  8019b0:	89 d8                	mov    %ebx,%eax
+  8019b2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019b5:	5b                   	pop    %ebx
+  8019b6:	5e                   	pop    %esi
+  8019b7:	5d                   	pop    %ebp
+  8019b8:	c3                   	ret
+  assert(r <= n);
+  8019b9:	68 0c 30 80 00       	push   $0x80300c
+  8019be:	68 13 30 80 00       	push   $0x803013
+  8019c3:	6a 78                	push   $0x78
+  8019c5:	68 28 30 80 00       	push   $0x803028
+  8019ca:	e8 66 e8 ff ff       	call   800235 <_panic>
+  assert(r <= PGSIZE);
+  8019cf:	68 33 30 80 00       	push   $0x803033
+  8019d4:	68 13 30 80 00       	push   $0x803013
+  8019d9:	6a 79                	push   $0x79
+  8019db:	68 28 30 80 00       	push   $0x803028
+  8019e0:	e8 50 e8 ff ff       	call   800235 <_panic>
+
+008019e5 <open>:
+open(const char *path, int mode) {
+  8019e5:	55                   	push   %ebp
+  8019e6:	89 e5                	mov    %esp,%ebp
+  8019e8:	56                   	push   %esi
+  8019e9:	53                   	push   %ebx
+  8019ea:	83 ec 1c             	sub    $0x1c,%esp
+  8019ed:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  8019f0:	56                   	push   %esi
+  8019f1:	e8 98 ee ff ff       	call   80088e <strlen>
+  8019f6:	83 c4 10             	add    $0x10,%esp
+  8019f9:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8019fe:	7f 6c                	jg     801a6c <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801a00:	83 ec 0c             	sub    $0xc,%esp
+  801a03:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a06:	50                   	push   %eax
+  801a07:	e8 ba f8 ff ff       	call   8012c6 <fd_alloc>
+  801a0c:	89 c3                	mov    %eax,%ebx
+  801a0e:	83 c4 10             	add    $0x10,%esp
+  801a11:	85 c0                	test   %eax,%eax
+  801a13:	78 3c                	js     801a51 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801a15:	83 ec 08             	sub    $0x8,%esp
+  801a18:	56                   	push   %esi
+  801a19:	68 00 60 80 00       	push   $0x806000
+  801a1e:	e8 a6 ee ff ff       	call   8008c9 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801a23:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a26:	a3 00 64 80 00       	mov    %eax,0x806400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801a2b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801a2e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a33:	e8 f6 fd ff ff       	call   80182e <fsipc>
+  801a38:	89 c3                	mov    %eax,%ebx
+  801a3a:	83 c4 10             	add    $0x10,%esp
+  801a3d:	85 c0                	test   %eax,%eax
+  801a3f:	78 19                	js     801a5a <open+0x75>
+  return fd2num(fd);
+  801a41:	83 ec 0c             	sub    $0xc,%esp
+  801a44:	ff 75 f4             	push   -0xc(%ebp)
+  801a47:	e8 53 f8 ff ff       	call   80129f <fd2num>
+  801a4c:	89 c3                	mov    %eax,%ebx
+  801a4e:	83 c4 10             	add    $0x10,%esp
+}
+  801a51:	89 d8                	mov    %ebx,%eax
+  801a53:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a56:	5b                   	pop    %ebx
+  801a57:	5e                   	pop    %esi
+  801a58:	5d                   	pop    %ebp
+  801a59:	c3                   	ret
+    fd_close(fd, 0);
+  801a5a:	83 ec 08             	sub    $0x8,%esp
+  801a5d:	6a 00                	push   $0x0
+  801a5f:	ff 75 f4             	push   -0xc(%ebp)
+  801a62:	e8 58 f9 ff ff       	call   8013bf <fd_close>
+    return r;
+  801a67:	83 c4 10             	add    $0x10,%esp
+  801a6a:	eb e5                	jmp    801a51 <open+0x6c>
+    return -E_BAD_PATH;
+  801a6c:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801a71:	eb de                	jmp    801a51 <open+0x6c>
+
+00801a73 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  801a73:	55                   	push   %ebp
+  801a74:	89 e5                	mov    %esp,%ebp
+  801a76:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801a79:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a7e:	b8 08 00 00 00       	mov    $0x8,%eax
+  801a83:	e8 a6 fd ff ff       	call   80182e <fsipc>
+}
+  801a88:	c9                   	leave
+  801a89:	c3                   	ret
+
+00801a8a <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801a8a:	55                   	push   %ebp
+  801a8b:	89 e5                	mov    %esp,%ebp
+  801a8d:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801a90:	68 3f 30 80 00       	push   $0x80303f
+  801a95:	ff 75 0c             	push   0xc(%ebp)
+  801a98:	e8 2c ee ff ff       	call   8008c9 <strcpy>
+	return 0;
+}
+  801a9d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aa2:	c9                   	leave
+  801aa3:	c3                   	ret
+
+00801aa4 <devsock_close>:
+{
+  801aa4:	55                   	push   %ebp
+  801aa5:	89 e5                	mov    %esp,%ebp
+  801aa7:	53                   	push   %ebx
+  801aa8:	83 ec 10             	sub    $0x10,%esp
+  801aab:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801aae:	53                   	push   %ebx
+  801aaf:	e8 92 0a 00 00       	call   802546 <pageref>
+  801ab4:	89 c2                	mov    %eax,%edx
+  801ab6:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801ab9:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801abe:	83 fa 01             	cmp    $0x1,%edx
+  801ac1:	74 05                	je     801ac8 <devsock_close+0x24>
+}
+  801ac3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ac6:	c9                   	leave
+  801ac7:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801ac8:	83 ec 0c             	sub    $0xc,%esp
+  801acb:	ff 73 0c             	push   0xc(%ebx)
+  801ace:	e8 b7 02 00 00       	call   801d8a <nsipc_close>
+  801ad3:	83 c4 10             	add    $0x10,%esp
+  801ad6:	eb eb                	jmp    801ac3 <devsock_close+0x1f>
+
+00801ad8 <devsock_write>:
+{
+  801ad8:	55                   	push   %ebp
+  801ad9:	89 e5                	mov    %esp,%ebp
+  801adb:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801ade:	6a 00                	push   $0x0
+  801ae0:	ff 75 10             	push   0x10(%ebp)
+  801ae3:	ff 75 0c             	push   0xc(%ebp)
+  801ae6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ae9:	ff 70 0c             	push   0xc(%eax)
+  801aec:	e8 79 03 00 00       	call   801e6a <nsipc_send>
+}
+  801af1:	c9                   	leave
+  801af2:	c3                   	ret
+
+00801af3 <devsock_read>:
+{
+  801af3:	55                   	push   %ebp
+  801af4:	89 e5                	mov    %esp,%ebp
+  801af6:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801af9:	6a 00                	push   $0x0
+  801afb:	ff 75 10             	push   0x10(%ebp)
+  801afe:	ff 75 0c             	push   0xc(%ebp)
+  801b01:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b04:	ff 70 0c             	push   0xc(%eax)
+  801b07:	e8 ef 02 00 00       	call   801dfb <nsipc_recv>
+}
+  801b0c:	c9                   	leave
+  801b0d:	c3                   	ret
+
+00801b0e <fd2sockid>:
+{
+  801b0e:	55                   	push   %ebp
+  801b0f:	89 e5                	mov    %esp,%ebp
+  801b11:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801b14:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801b17:	52                   	push   %edx
+  801b18:	50                   	push   %eax
+  801b19:	e8 fe f7 ff ff       	call   80131c <fd_lookup>
+  801b1e:	83 c4 10             	add    $0x10,%esp
+  801b21:	85 c0                	test   %eax,%eax
+  801b23:	78 10                	js     801b35 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801b25:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b28:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  801b2e:	39 08                	cmp    %ecx,(%eax)
+  801b30:	75 05                	jne    801b37 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801b32:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801b35:	c9                   	leave
+  801b36:	c3                   	ret
+		return -E_NOT_SUPP;
+  801b37:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b3c:	eb f7                	jmp    801b35 <fd2sockid+0x27>
+
+00801b3e <alloc_sockfd>:
+{
+  801b3e:	55                   	push   %ebp
+  801b3f:	89 e5                	mov    %esp,%ebp
+  801b41:	56                   	push   %esi
+  801b42:	53                   	push   %ebx
+  801b43:	83 ec 1c             	sub    $0x1c,%esp
+  801b46:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801b48:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b4b:	50                   	push   %eax
+  801b4c:	e8 75 f7 ff ff       	call   8012c6 <fd_alloc>
+  801b51:	89 c3                	mov    %eax,%ebx
+  801b53:	83 c4 10             	add    $0x10,%esp
+  801b56:	85 c0                	test   %eax,%eax
+  801b58:	78 43                	js     801b9d <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801b5a:	83 ec 04             	sub    $0x4,%esp
+  801b5d:	68 07 04 00 00       	push   $0x407
+  801b62:	ff 75 f4             	push   -0xc(%ebp)
+  801b65:	6a 00                	push   $0x0
+  801b67:	e8 49 f1 ff ff       	call   800cb5 <sys_page_alloc>
+  801b6c:	89 c3                	mov    %eax,%ebx
+  801b6e:	83 c4 10             	add    $0x10,%esp
+  801b71:	85 c0                	test   %eax,%eax
+  801b73:	78 28                	js     801b9d <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801b75:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b78:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801b7e:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801b80:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b83:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801b8a:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801b8d:	83 ec 0c             	sub    $0xc,%esp
+  801b90:	50                   	push   %eax
+  801b91:	e8 09 f7 ff ff       	call   80129f <fd2num>
+  801b96:	89 c3                	mov    %eax,%ebx
+  801b98:	83 c4 10             	add    $0x10,%esp
+  801b9b:	eb 0c                	jmp    801ba9 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801b9d:	83 ec 0c             	sub    $0xc,%esp
+  801ba0:	56                   	push   %esi
+  801ba1:	e8 e4 01 00 00       	call   801d8a <nsipc_close>
+		return r;
+  801ba6:	83 c4 10             	add    $0x10,%esp
+}
+  801ba9:	89 d8                	mov    %ebx,%eax
+  801bab:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bae:	5b                   	pop    %ebx
+  801baf:	5e                   	pop    %esi
+  801bb0:	5d                   	pop    %ebp
+  801bb1:	c3                   	ret
+
+00801bb2 <accept>:
+{
+  801bb2:	55                   	push   %ebp
+  801bb3:	89 e5                	mov    %esp,%ebp
+  801bb5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801bb8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bbb:	e8 4e ff ff ff       	call   801b0e <fd2sockid>
+  801bc0:	85 c0                	test   %eax,%eax
+  801bc2:	78 1b                	js     801bdf <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801bc4:	83 ec 04             	sub    $0x4,%esp
+  801bc7:	ff 75 10             	push   0x10(%ebp)
+  801bca:	ff 75 0c             	push   0xc(%ebp)
+  801bcd:	50                   	push   %eax
+  801bce:	e8 0e 01 00 00       	call   801ce1 <nsipc_accept>
+  801bd3:	83 c4 10             	add    $0x10,%esp
+  801bd6:	85 c0                	test   %eax,%eax
+  801bd8:	78 05                	js     801bdf <accept+0x2d>
+	return alloc_sockfd(r);
+  801bda:	e8 5f ff ff ff       	call   801b3e <alloc_sockfd>
+}
+  801bdf:	c9                   	leave
+  801be0:	c3                   	ret
+
+00801be1 <bind>:
+{
+  801be1:	55                   	push   %ebp
+  801be2:	89 e5                	mov    %esp,%ebp
+  801be4:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801be7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bea:	e8 1f ff ff ff       	call   801b0e <fd2sockid>
+  801bef:	85 c0                	test   %eax,%eax
+  801bf1:	78 12                	js     801c05 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801bf3:	83 ec 04             	sub    $0x4,%esp
+  801bf6:	ff 75 10             	push   0x10(%ebp)
+  801bf9:	ff 75 0c             	push   0xc(%ebp)
+  801bfc:	50                   	push   %eax
+  801bfd:	e8 31 01 00 00       	call   801d33 <nsipc_bind>
+  801c02:	83 c4 10             	add    $0x10,%esp
+}
+  801c05:	c9                   	leave
+  801c06:	c3                   	ret
+
+00801c07 <shutdown>:
+{
+  801c07:	55                   	push   %ebp
+  801c08:	89 e5                	mov    %esp,%ebp
+  801c0a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801c0d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c10:	e8 f9 fe ff ff       	call   801b0e <fd2sockid>
+  801c15:	85 c0                	test   %eax,%eax
+  801c17:	78 0f                	js     801c28 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801c19:	83 ec 08             	sub    $0x8,%esp
+  801c1c:	ff 75 0c             	push   0xc(%ebp)
+  801c1f:	50                   	push   %eax
+  801c20:	e8 43 01 00 00       	call   801d68 <nsipc_shutdown>
+  801c25:	83 c4 10             	add    $0x10,%esp
+}
+  801c28:	c9                   	leave
+  801c29:	c3                   	ret
+
+00801c2a <connect>:
+{
+  801c2a:	55                   	push   %ebp
+  801c2b:	89 e5                	mov    %esp,%ebp
+  801c2d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801c30:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c33:	e8 d6 fe ff ff       	call   801b0e <fd2sockid>
+  801c38:	85 c0                	test   %eax,%eax
+  801c3a:	78 12                	js     801c4e <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801c3c:	83 ec 04             	sub    $0x4,%esp
+  801c3f:	ff 75 10             	push   0x10(%ebp)
+  801c42:	ff 75 0c             	push   0xc(%ebp)
+  801c45:	50                   	push   %eax
+  801c46:	e8 59 01 00 00       	call   801da4 <nsipc_connect>
+  801c4b:	83 c4 10             	add    $0x10,%esp
+}
+  801c4e:	c9                   	leave
+  801c4f:	c3                   	ret
+
+00801c50 <listen>:
+{
+  801c50:	55                   	push   %ebp
+  801c51:	89 e5                	mov    %esp,%ebp
+  801c53:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801c56:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c59:	e8 b0 fe ff ff       	call   801b0e <fd2sockid>
+  801c5e:	85 c0                	test   %eax,%eax
+  801c60:	78 0f                	js     801c71 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801c62:	83 ec 08             	sub    $0x8,%esp
+  801c65:	ff 75 0c             	push   0xc(%ebp)
+  801c68:	50                   	push   %eax
+  801c69:	e8 6b 01 00 00       	call   801dd9 <nsipc_listen>
+  801c6e:	83 c4 10             	add    $0x10,%esp
+}
+  801c71:	c9                   	leave
+  801c72:	c3                   	ret
+
+00801c73 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801c73:	55                   	push   %ebp
+  801c74:	89 e5                	mov    %esp,%ebp
+  801c76:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801c79:	ff 75 10             	push   0x10(%ebp)
+  801c7c:	ff 75 0c             	push   0xc(%ebp)
+  801c7f:	ff 75 08             	push   0x8(%ebp)
+  801c82:	e8 41 02 00 00       	call   801ec8 <nsipc_socket>
+  801c87:	83 c4 10             	add    $0x10,%esp
+  801c8a:	85 c0                	test   %eax,%eax
+  801c8c:	78 05                	js     801c93 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801c8e:	e8 ab fe ff ff       	call   801b3e <alloc_sockfd>
+}
+  801c93:	c9                   	leave
+  801c94:	c3                   	ret
+
+00801c95 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801c95:	55                   	push   %ebp
+  801c96:	89 e5                	mov    %esp,%ebp
+  801c98:	53                   	push   %ebx
+  801c99:	83 ec 04             	sub    $0x4,%esp
+  801c9c:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801c9e:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  801ca5:	74 26                	je     801ccd <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801ca7:	6a 07                	push   $0x7
+  801ca9:	68 00 70 80 00       	push   $0x807000
+  801cae:	53                   	push   %ebx
+  801caf:	ff 35 04 50 80 00    	push   0x805004
+  801cb5:	e8 f9 07 00 00       	call   8024b3 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801cba:	83 c4 0c             	add    $0xc,%esp
+  801cbd:	6a 00                	push   $0x0
+  801cbf:	6a 00                	push   $0x0
+  801cc1:	6a 00                	push   $0x0
+  801cc3:	e8 77 07 00 00       	call   80243f <ipc_recv>
+}
+  801cc8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ccb:	c9                   	leave
+  801ccc:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801ccd:	83 ec 0c             	sub    $0xc,%esp
+  801cd0:	6a 02                	push   $0x2
+  801cd2:	e8 30 08 00 00       	call   802507 <ipc_find_env>
+  801cd7:	a3 04 50 80 00       	mov    %eax,0x805004
+  801cdc:	83 c4 10             	add    $0x10,%esp
+  801cdf:	eb c6                	jmp    801ca7 <nsipc+0x12>
+
+00801ce1 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801ce1:	55                   	push   %ebp
+  801ce2:	89 e5                	mov    %esp,%ebp
+  801ce4:	56                   	push   %esi
+  801ce5:	53                   	push   %ebx
+  801ce6:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801ce9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cec:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801cf1:	8b 06                	mov    (%esi),%eax
+  801cf3:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801cf8:	b8 01 00 00 00       	mov    $0x1,%eax
+  801cfd:	e8 93 ff ff ff       	call   801c95 <nsipc>
+  801d02:	89 c3                	mov    %eax,%ebx
+  801d04:	85 c0                	test   %eax,%eax
+  801d06:	79 09                	jns    801d11 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801d08:	89 d8                	mov    %ebx,%eax
+  801d0a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d0d:	5b                   	pop    %ebx
+  801d0e:	5e                   	pop    %esi
+  801d0f:	5d                   	pop    %ebp
+  801d10:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801d11:	83 ec 04             	sub    $0x4,%esp
+  801d14:	ff 35 10 70 80 00    	push   0x807010
+  801d1a:	68 00 70 80 00       	push   $0x807000
+  801d1f:	ff 75 0c             	push   0xc(%ebp)
+  801d22:	e8 28 ed ff ff       	call   800a4f <memmove>
+		*addrlen = ret->ret_addrlen;
+  801d27:	a1 10 70 80 00       	mov    0x807010,%eax
+  801d2c:	89 06                	mov    %eax,(%esi)
+  801d2e:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801d31:	eb d5                	jmp    801d08 <nsipc_accept+0x27>
+
+00801d33 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801d33:	55                   	push   %ebp
+  801d34:	89 e5                	mov    %esp,%ebp
+  801d36:	53                   	push   %ebx
+  801d37:	83 ec 08             	sub    $0x8,%esp
+  801d3a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801d3d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d40:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801d45:	53                   	push   %ebx
+  801d46:	ff 75 0c             	push   0xc(%ebp)
+  801d49:	68 04 70 80 00       	push   $0x807004
+  801d4e:	e8 fc ec ff ff       	call   800a4f <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801d53:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  801d59:	b8 02 00 00 00       	mov    $0x2,%eax
+  801d5e:	e8 32 ff ff ff       	call   801c95 <nsipc>
+}
+  801d63:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d66:	c9                   	leave
+  801d67:	c3                   	ret
+
+00801d68 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801d68:	55                   	push   %ebp
+  801d69:	89 e5                	mov    %esp,%ebp
+  801d6b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801d6e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d71:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  801d76:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d79:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  801d7e:	b8 03 00 00 00       	mov    $0x3,%eax
+  801d83:	e8 0d ff ff ff       	call   801c95 <nsipc>
+}
+  801d88:	c9                   	leave
+  801d89:	c3                   	ret
+
+00801d8a <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801d8a:	55                   	push   %ebp
+  801d8b:	89 e5                	mov    %esp,%ebp
+  801d8d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801d90:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d93:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  801d98:	b8 04 00 00 00       	mov    $0x4,%eax
+  801d9d:	e8 f3 fe ff ff       	call   801c95 <nsipc>
+}
+  801da2:	c9                   	leave
+  801da3:	c3                   	ret
+
+00801da4 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801da4:	55                   	push   %ebp
+  801da5:	89 e5                	mov    %esp,%ebp
+  801da7:	53                   	push   %ebx
+  801da8:	83 ec 08             	sub    $0x8,%esp
+  801dab:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801dae:	8b 45 08             	mov    0x8(%ebp),%eax
+  801db1:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801db6:	53                   	push   %ebx
+  801db7:	ff 75 0c             	push   0xc(%ebp)
+  801dba:	68 04 70 80 00       	push   $0x807004
+  801dbf:	e8 8b ec ff ff       	call   800a4f <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801dc4:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  801dca:	b8 05 00 00 00       	mov    $0x5,%eax
+  801dcf:	e8 c1 fe ff ff       	call   801c95 <nsipc>
+}
+  801dd4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801dd7:	c9                   	leave
+  801dd8:	c3                   	ret
+
+00801dd9 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801dd9:	55                   	push   %ebp
+  801dda:	89 e5                	mov    %esp,%ebp
+  801ddc:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801ddf:	8b 45 08             	mov    0x8(%ebp),%eax
+  801de2:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  801de7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801dea:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  801def:	b8 06 00 00 00       	mov    $0x6,%eax
+  801df4:	e8 9c fe ff ff       	call   801c95 <nsipc>
+}
+  801df9:	c9                   	leave
+  801dfa:	c3                   	ret
+
+00801dfb <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801dfb:	55                   	push   %ebp
+  801dfc:	89 e5                	mov    %esp,%ebp
+  801dfe:	56                   	push   %esi
+  801dff:	53                   	push   %ebx
+  801e00:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801e03:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e06:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  801e0b:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  801e11:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e14:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801e19:	b8 07 00 00 00       	mov    $0x7,%eax
+  801e1e:	e8 72 fe ff ff       	call   801c95 <nsipc>
+  801e23:	89 c3                	mov    %eax,%ebx
+  801e25:	85 c0                	test   %eax,%eax
+  801e27:	78 22                	js     801e4b <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801e29:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801e2e:	39 c6                	cmp    %eax,%esi
+  801e30:	0f 4e c6             	cmovle %esi,%eax
+  801e33:	39 c3                	cmp    %eax,%ebx
+  801e35:	7f 1d                	jg     801e54 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801e37:	83 ec 04             	sub    $0x4,%esp
+  801e3a:	53                   	push   %ebx
+  801e3b:	68 00 70 80 00       	push   $0x807000
+  801e40:	ff 75 0c             	push   0xc(%ebp)
+  801e43:	e8 07 ec ff ff       	call   800a4f <memmove>
+  801e48:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801e4b:	89 d8                	mov    %ebx,%eax
+  801e4d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e50:	5b                   	pop    %ebx
+  801e51:	5e                   	pop    %esi
+  801e52:	5d                   	pop    %ebp
+  801e53:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801e54:	68 4b 30 80 00       	push   $0x80304b
+  801e59:	68 13 30 80 00       	push   $0x803013
+  801e5e:	6a 62                	push   $0x62
+  801e60:	68 60 30 80 00       	push   $0x803060
+  801e65:	e8 cb e3 ff ff       	call   800235 <_panic>
+
+00801e6a <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801e6a:	55                   	push   %ebp
+  801e6b:	89 e5                	mov    %esp,%ebp
+  801e6d:	53                   	push   %ebx
+  801e6e:	83 ec 04             	sub    $0x4,%esp
+  801e71:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801e74:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e77:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  801e7c:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801e82:	7f 2e                	jg     801eb2 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801e84:	83 ec 04             	sub    $0x4,%esp
+  801e87:	53                   	push   %ebx
+  801e88:	ff 75 0c             	push   0xc(%ebp)
+  801e8b:	68 0c 70 80 00       	push   $0x80700c
+  801e90:	e8 ba eb ff ff       	call   800a4f <memmove>
+	nsipcbuf.send.req_size = size;
+  801e95:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  801e9b:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e9e:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  801ea3:	b8 08 00 00 00       	mov    $0x8,%eax
+  801ea8:	e8 e8 fd ff ff       	call   801c95 <nsipc>
+}
+  801ead:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801eb0:	c9                   	leave
+  801eb1:	c3                   	ret
+	assert(size < 1600);
+  801eb2:	68 6c 30 80 00       	push   $0x80306c
+  801eb7:	68 13 30 80 00       	push   $0x803013
+  801ebc:	6a 6d                	push   $0x6d
+  801ebe:	68 60 30 80 00       	push   $0x803060
+  801ec3:	e8 6d e3 ff ff       	call   800235 <_panic>
+
+00801ec8 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801ec8:	55                   	push   %ebp
+  801ec9:	89 e5                	mov    %esp,%ebp
+  801ecb:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801ece:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ed1:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  801ed6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ed9:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  801ede:	8b 45 10             	mov    0x10(%ebp),%eax
+  801ee1:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  801ee6:	b8 09 00 00 00       	mov    $0x9,%eax
+  801eeb:	e8 a5 fd ff ff       	call   801c95 <nsipc>
+}
+  801ef0:	c9                   	leave
+  801ef1:	c3                   	ret
+
+00801ef2 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801ef2:	55                   	push   %ebp
+  801ef3:	89 e5                	mov    %esp,%ebp
+  801ef5:	56                   	push   %esi
+  801ef6:	53                   	push   %ebx
+  801ef7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801efa:	83 ec 0c             	sub    $0xc,%esp
+  801efd:	ff 75 08             	push   0x8(%ebp)
+  801f00:	e8 aa f3 ff ff       	call   8012af <fd2data>
+  801f05:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801f07:	83 c4 08             	add    $0x8,%esp
+  801f0a:	68 78 30 80 00       	push   $0x803078
+  801f0f:	53                   	push   %ebx
+  801f10:	e8 b4 e9 ff ff       	call   8008c9 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801f15:	8b 46 04             	mov    0x4(%esi),%eax
+  801f18:	2b 06                	sub    (%esi),%eax
+  801f1a:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  801f20:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801f27:	00 00 00 
+	stat->st_dev = &devpipe;
+  801f2a:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  801f31:	40 80 00 
+	return 0;
+}
+  801f34:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f39:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f3c:	5b                   	pop    %ebx
+  801f3d:	5e                   	pop    %esi
+  801f3e:	5d                   	pop    %ebp
+  801f3f:	c3                   	ret
+
+00801f40 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801f40:	55                   	push   %ebp
+  801f41:	89 e5                	mov    %esp,%ebp
+  801f43:	53                   	push   %ebx
+  801f44:	83 ec 0c             	sub    $0xc,%esp
+  801f47:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801f4a:	53                   	push   %ebx
+  801f4b:	6a 00                	push   $0x0
+  801f4d:	e8 e8 ed ff ff       	call   800d3a <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801f52:	89 1c 24             	mov    %ebx,(%esp)
+  801f55:	e8 55 f3 ff ff       	call   8012af <fd2data>
+  801f5a:	83 c4 08             	add    $0x8,%esp
+  801f5d:	50                   	push   %eax
+  801f5e:	6a 00                	push   $0x0
+  801f60:	e8 d5 ed ff ff       	call   800d3a <sys_page_unmap>
+}
+  801f65:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f68:	c9                   	leave
+  801f69:	c3                   	ret
+
+00801f6a <_pipeisclosed>:
+{
+  801f6a:	55                   	push   %ebp
+  801f6b:	89 e5                	mov    %esp,%ebp
+  801f6d:	57                   	push   %edi
+  801f6e:	56                   	push   %esi
+  801f6f:	53                   	push   %ebx
+  801f70:	83 ec 1c             	sub    $0x1c,%esp
+  801f73:	89 c7                	mov    %eax,%edi
+  801f75:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801f77:	a1 08 50 80 00       	mov    0x805008,%eax
+  801f7c:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801f7f:	83 ec 0c             	sub    $0xc,%esp
+  801f82:	57                   	push   %edi
+  801f83:	e8 be 05 00 00       	call   802546 <pageref>
+  801f88:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801f8b:	89 34 24             	mov    %esi,(%esp)
+  801f8e:	e8 b3 05 00 00       	call   802546 <pageref>
+		nn = thisenv->env_runs;
+  801f93:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  801f99:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801f9c:	83 c4 10             	add    $0x10,%esp
+  801f9f:	39 cb                	cmp    %ecx,%ebx
+  801fa1:	74 1b                	je     801fbe <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801fa3:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801fa6:	75 cf                	jne    801f77 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801fa8:	8b 42 58             	mov    0x58(%edx),%eax
+  801fab:	6a 01                	push   $0x1
+  801fad:	50                   	push   %eax
+  801fae:	53                   	push   %ebx
+  801faf:	68 7f 30 80 00       	push   $0x80307f
+  801fb4:	e8 57 e3 ff ff       	call   800310 <cprintf>
+  801fb9:	83 c4 10             	add    $0x10,%esp
+  801fbc:	eb b9                	jmp    801f77 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801fbe:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801fc1:	0f 94 c0             	sete   %al
+  801fc4:	0f b6 c0             	movzbl %al,%eax
+}
+  801fc7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fca:	5b                   	pop    %ebx
+  801fcb:	5e                   	pop    %esi
+  801fcc:	5f                   	pop    %edi
+  801fcd:	5d                   	pop    %ebp
+  801fce:	c3                   	ret
+
+00801fcf <devpipe_write>:
+{
+  801fcf:	55                   	push   %ebp
+  801fd0:	89 e5                	mov    %esp,%ebp
+  801fd2:	57                   	push   %edi
+  801fd3:	56                   	push   %esi
+  801fd4:	53                   	push   %ebx
+  801fd5:	83 ec 28             	sub    $0x28,%esp
+  801fd8:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801fdb:	56                   	push   %esi
+  801fdc:	e8 ce f2 ff ff       	call   8012af <fd2data>
+  801fe1:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801fe3:	83 c4 10             	add    $0x10,%esp
+  801fe6:	bf 00 00 00 00       	mov    $0x0,%edi
+  801feb:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801fee:	75 09                	jne    801ff9 <devpipe_write+0x2a>
+	return i;
+  801ff0:	89 f8                	mov    %edi,%eax
+  801ff2:	eb 23                	jmp    802017 <devpipe_write+0x48>
+			sys_yield();
+  801ff4:	e8 9d ec ff ff       	call   800c96 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801ff9:	8b 43 04             	mov    0x4(%ebx),%eax
+  801ffc:	8b 0b                	mov    (%ebx),%ecx
+  801ffe:	8d 51 20             	lea    0x20(%ecx),%edx
+  802001:	39 d0                	cmp    %edx,%eax
+  802003:	72 1a                	jb     80201f <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802005:	89 da                	mov    %ebx,%edx
+  802007:	89 f0                	mov    %esi,%eax
+  802009:	e8 5c ff ff ff       	call   801f6a <_pipeisclosed>
+  80200e:	85 c0                	test   %eax,%eax
+  802010:	74 e2                	je     801ff4 <devpipe_write+0x25>
+				return 0;
+  802012:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802017:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80201a:	5b                   	pop    %ebx
+  80201b:	5e                   	pop    %esi
+  80201c:	5f                   	pop    %edi
+  80201d:	5d                   	pop    %ebp
+  80201e:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80201f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802022:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802026:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802029:	89 c2                	mov    %eax,%edx
+  80202b:	c1 fa 1f             	sar    $0x1f,%edx
+  80202e:	89 d1                	mov    %edx,%ecx
+  802030:	c1 e9 1b             	shr    $0x1b,%ecx
+  802033:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802036:	83 e2 1f             	and    $0x1f,%edx
+  802039:	29 ca                	sub    %ecx,%edx
+  80203b:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80203f:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802043:	83 c0 01             	add    $0x1,%eax
+  802046:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802049:	83 c7 01             	add    $0x1,%edi
+  80204c:	eb 9d                	jmp    801feb <devpipe_write+0x1c>
+
+0080204e <devpipe_read>:
+{
+  80204e:	55                   	push   %ebp
+  80204f:	89 e5                	mov    %esp,%ebp
+  802051:	57                   	push   %edi
+  802052:	56                   	push   %esi
+  802053:	53                   	push   %ebx
+  802054:	83 ec 18             	sub    $0x18,%esp
+  802057:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  80205a:	57                   	push   %edi
+  80205b:	e8 4f f2 ff ff       	call   8012af <fd2data>
+  802060:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802062:	83 c4 10             	add    $0x10,%esp
+  802065:	be 00 00 00 00       	mov    $0x0,%esi
+  80206a:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80206d:	75 13                	jne    802082 <devpipe_read+0x34>
+	return i;
+  80206f:	89 f0                	mov    %esi,%eax
+  802071:	eb 02                	jmp    802075 <devpipe_read+0x27>
+				return i;
+  802073:	89 f0                	mov    %esi,%eax
+}
+  802075:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802078:	5b                   	pop    %ebx
+  802079:	5e                   	pop    %esi
+  80207a:	5f                   	pop    %edi
+  80207b:	5d                   	pop    %ebp
+  80207c:	c3                   	ret
+			sys_yield();
+  80207d:	e8 14 ec ff ff       	call   800c96 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802082:	8b 03                	mov    (%ebx),%eax
+  802084:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802087:	75 18                	jne    8020a1 <devpipe_read+0x53>
+			if (i > 0)
+  802089:	85 f6                	test   %esi,%esi
+  80208b:	75 e6                	jne    802073 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  80208d:	89 da                	mov    %ebx,%edx
+  80208f:	89 f8                	mov    %edi,%eax
+  802091:	e8 d4 fe ff ff       	call   801f6a <_pipeisclosed>
+  802096:	85 c0                	test   %eax,%eax
+  802098:	74 e3                	je     80207d <devpipe_read+0x2f>
+				return 0;
+  80209a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80209f:	eb d4                	jmp    802075 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8020a1:	99                   	cltd
+  8020a2:	c1 ea 1b             	shr    $0x1b,%edx
+  8020a5:	01 d0                	add    %edx,%eax
+  8020a7:	83 e0 1f             	and    $0x1f,%eax
+  8020aa:	29 d0                	sub    %edx,%eax
+  8020ac:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8020b1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8020b4:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8020b7:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8020ba:	83 c6 01             	add    $0x1,%esi
+  8020bd:	eb ab                	jmp    80206a <devpipe_read+0x1c>
+
+008020bf <pipe>:
+{
+  8020bf:	55                   	push   %ebp
+  8020c0:	89 e5                	mov    %esp,%ebp
+  8020c2:	56                   	push   %esi
+  8020c3:	53                   	push   %ebx
+  8020c4:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8020c7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020ca:	50                   	push   %eax
+  8020cb:	e8 f6 f1 ff ff       	call   8012c6 <fd_alloc>
+  8020d0:	89 c3                	mov    %eax,%ebx
+  8020d2:	83 c4 10             	add    $0x10,%esp
+  8020d5:	85 c0                	test   %eax,%eax
+  8020d7:	0f 88 23 01 00 00    	js     802200 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8020dd:	83 ec 04             	sub    $0x4,%esp
+  8020e0:	68 07 04 00 00       	push   $0x407
+  8020e5:	ff 75 f4             	push   -0xc(%ebp)
+  8020e8:	6a 00                	push   $0x0
+  8020ea:	e8 c6 eb ff ff       	call   800cb5 <sys_page_alloc>
+  8020ef:	89 c3                	mov    %eax,%ebx
+  8020f1:	83 c4 10             	add    $0x10,%esp
+  8020f4:	85 c0                	test   %eax,%eax
+  8020f6:	0f 88 04 01 00 00    	js     802200 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8020fc:	83 ec 0c             	sub    $0xc,%esp
+  8020ff:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802102:	50                   	push   %eax
+  802103:	e8 be f1 ff ff       	call   8012c6 <fd_alloc>
+  802108:	89 c3                	mov    %eax,%ebx
+  80210a:	83 c4 10             	add    $0x10,%esp
+  80210d:	85 c0                	test   %eax,%eax
+  80210f:	0f 88 db 00 00 00    	js     8021f0 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802115:	83 ec 04             	sub    $0x4,%esp
+  802118:	68 07 04 00 00       	push   $0x407
+  80211d:	ff 75 f0             	push   -0x10(%ebp)
+  802120:	6a 00                	push   $0x0
+  802122:	e8 8e eb ff ff       	call   800cb5 <sys_page_alloc>
+  802127:	89 c3                	mov    %eax,%ebx
+  802129:	83 c4 10             	add    $0x10,%esp
+  80212c:	85 c0                	test   %eax,%eax
+  80212e:	0f 88 bc 00 00 00    	js     8021f0 <pipe+0x131>
+	va = fd2data(fd0);
+  802134:	83 ec 0c             	sub    $0xc,%esp
+  802137:	ff 75 f4             	push   -0xc(%ebp)
+  80213a:	e8 70 f1 ff ff       	call   8012af <fd2data>
+  80213f:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802141:	83 c4 0c             	add    $0xc,%esp
+  802144:	68 07 04 00 00       	push   $0x407
+  802149:	50                   	push   %eax
+  80214a:	6a 00                	push   $0x0
+  80214c:	e8 64 eb ff ff       	call   800cb5 <sys_page_alloc>
+  802151:	89 c3                	mov    %eax,%ebx
+  802153:	83 c4 10             	add    $0x10,%esp
+  802156:	85 c0                	test   %eax,%eax
+  802158:	0f 88 82 00 00 00    	js     8021e0 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80215e:	83 ec 0c             	sub    $0xc,%esp
+  802161:	ff 75 f0             	push   -0x10(%ebp)
+  802164:	e8 46 f1 ff ff       	call   8012af <fd2data>
+  802169:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802170:	50                   	push   %eax
+  802171:	6a 00                	push   $0x0
+  802173:	56                   	push   %esi
+  802174:	6a 00                	push   $0x0
+  802176:	e8 7d eb ff ff       	call   800cf8 <sys_page_map>
+  80217b:	89 c3                	mov    %eax,%ebx
+  80217d:	83 c4 20             	add    $0x20,%esp
+  802180:	85 c0                	test   %eax,%eax
+  802182:	78 4e                	js     8021d2 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802184:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  802189:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80218c:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80218e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802191:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802198:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80219b:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80219d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8021a0:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8021a7:	83 ec 0c             	sub    $0xc,%esp
+  8021aa:	ff 75 f4             	push   -0xc(%ebp)
+  8021ad:	e8 ed f0 ff ff       	call   80129f <fd2num>
+  8021b2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8021b5:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8021b7:	83 c4 04             	add    $0x4,%esp
+  8021ba:	ff 75 f0             	push   -0x10(%ebp)
+  8021bd:	e8 dd f0 ff ff       	call   80129f <fd2num>
+  8021c2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8021c5:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8021c8:	83 c4 10             	add    $0x10,%esp
+  8021cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8021d0:	eb 2e                	jmp    802200 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8021d2:	83 ec 08             	sub    $0x8,%esp
+  8021d5:	56                   	push   %esi
+  8021d6:	6a 00                	push   $0x0
+  8021d8:	e8 5d eb ff ff       	call   800d3a <sys_page_unmap>
+  8021dd:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8021e0:	83 ec 08             	sub    $0x8,%esp
+  8021e3:	ff 75 f0             	push   -0x10(%ebp)
+  8021e6:	6a 00                	push   $0x0
+  8021e8:	e8 4d eb ff ff       	call   800d3a <sys_page_unmap>
+  8021ed:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8021f0:	83 ec 08             	sub    $0x8,%esp
+  8021f3:	ff 75 f4             	push   -0xc(%ebp)
+  8021f6:	6a 00                	push   $0x0
+  8021f8:	e8 3d eb ff ff       	call   800d3a <sys_page_unmap>
+  8021fd:	83 c4 10             	add    $0x10,%esp
+}
+  802200:	89 d8                	mov    %ebx,%eax
+  802202:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802205:	5b                   	pop    %ebx
+  802206:	5e                   	pop    %esi
+  802207:	5d                   	pop    %ebp
+  802208:	c3                   	ret
+
+00802209 <pipeisclosed>:
+{
+  802209:	55                   	push   %ebp
+  80220a:	89 e5                	mov    %esp,%ebp
+  80220c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80220f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802212:	50                   	push   %eax
+  802213:	ff 75 08             	push   0x8(%ebp)
+  802216:	e8 01 f1 ff ff       	call   80131c <fd_lookup>
+  80221b:	83 c4 10             	add    $0x10,%esp
+  80221e:	85 c0                	test   %eax,%eax
+  802220:	78 18                	js     80223a <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802222:	83 ec 0c             	sub    $0xc,%esp
+  802225:	ff 75 f4             	push   -0xc(%ebp)
+  802228:	e8 82 f0 ff ff       	call   8012af <fd2data>
+  80222d:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80222f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802232:	e8 33 fd ff ff       	call   801f6a <_pipeisclosed>
+  802237:	83 c4 10             	add    $0x10,%esp
+}
+  80223a:	c9                   	leave
+  80223b:	c3                   	ret
+
+0080223c <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80223c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802241:	c3                   	ret
+
+00802242 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802242:	55                   	push   %ebp
+  802243:	89 e5                	mov    %esp,%ebp
+  802245:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802248:	68 97 30 80 00       	push   $0x803097
+  80224d:	ff 75 0c             	push   0xc(%ebp)
+  802250:	e8 74 e6 ff ff       	call   8008c9 <strcpy>
+	return 0;
+}
+  802255:	b8 00 00 00 00       	mov    $0x0,%eax
+  80225a:	c9                   	leave
+  80225b:	c3                   	ret
+
+0080225c <devcons_write>:
+{
+  80225c:	55                   	push   %ebp
+  80225d:	89 e5                	mov    %esp,%ebp
+  80225f:	57                   	push   %edi
+  802260:	56                   	push   %esi
+  802261:	53                   	push   %ebx
+  802262:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802268:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80226d:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802273:	eb 2e                	jmp    8022a3 <devcons_write+0x47>
+		m = n - tot;
+  802275:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802278:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80227a:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80227f:	39 c3                	cmp    %eax,%ebx
+  802281:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802284:	83 ec 04             	sub    $0x4,%esp
+  802287:	53                   	push   %ebx
+  802288:	89 f0                	mov    %esi,%eax
+  80228a:	03 45 0c             	add    0xc(%ebp),%eax
+  80228d:	50                   	push   %eax
+  80228e:	57                   	push   %edi
+  80228f:	e8 bb e7 ff ff       	call   800a4f <memmove>
+		sys_cputs(buf, m);
+  802294:	83 c4 08             	add    $0x8,%esp
+  802297:	53                   	push   %ebx
+  802298:	57                   	push   %edi
+  802299:	e8 5b e9 ff ff       	call   800bf9 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80229e:	01 de                	add    %ebx,%esi
+  8022a0:	83 c4 10             	add    $0x10,%esp
+  8022a3:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8022a6:	72 cd                	jb     802275 <devcons_write+0x19>
+}
+  8022a8:	89 f0                	mov    %esi,%eax
+  8022aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022ad:	5b                   	pop    %ebx
+  8022ae:	5e                   	pop    %esi
+  8022af:	5f                   	pop    %edi
+  8022b0:	5d                   	pop    %ebp
+  8022b1:	c3                   	ret
+
+008022b2 <devcons_read>:
+{
+  8022b2:	55                   	push   %ebp
+  8022b3:	89 e5                	mov    %esp,%ebp
+  8022b5:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8022b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022bd:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8022c1:	75 07                	jne    8022ca <devcons_read+0x18>
+  8022c3:	eb 1f                	jmp    8022e4 <devcons_read+0x32>
+		sys_yield();
+  8022c5:	e8 cc e9 ff ff       	call   800c96 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8022ca:	e8 48 e9 ff ff       	call   800c17 <sys_cgetc>
+  8022cf:	85 c0                	test   %eax,%eax
+  8022d1:	74 f2                	je     8022c5 <devcons_read+0x13>
+	if (c < 0)
+  8022d3:	78 0f                	js     8022e4 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8022d5:	83 f8 04             	cmp    $0x4,%eax
+  8022d8:	74 0c                	je     8022e6 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8022da:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8022dd:	88 02                	mov    %al,(%edx)
+	return 1;
+  8022df:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8022e4:	c9                   	leave
+  8022e5:	c3                   	ret
+		return 0;
+  8022e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022eb:	eb f7                	jmp    8022e4 <devcons_read+0x32>
+
+008022ed <cputchar>:
+{
+  8022ed:	55                   	push   %ebp
+  8022ee:	89 e5                	mov    %esp,%ebp
+  8022f0:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8022f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022f6:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8022f9:	6a 01                	push   $0x1
+  8022fb:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8022fe:	50                   	push   %eax
+  8022ff:	e8 f5 e8 ff ff       	call   800bf9 <sys_cputs>
+}
+  802304:	83 c4 10             	add    $0x10,%esp
+  802307:	c9                   	leave
+  802308:	c3                   	ret
+
+00802309 <getchar>:
+{
+  802309:	55                   	push   %ebp
+  80230a:	89 e5                	mov    %esp,%ebp
+  80230c:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80230f:	6a 01                	push   $0x1
+  802311:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802314:	50                   	push   %eax
+  802315:	6a 00                	push   $0x0
+  802317:	e8 66 f2 ff ff       	call   801582 <read>
+	if (r < 0)
+  80231c:	83 c4 10             	add    $0x10,%esp
+  80231f:	85 c0                	test   %eax,%eax
+  802321:	78 06                	js     802329 <getchar+0x20>
+	if (r < 1)
+  802323:	74 06                	je     80232b <getchar+0x22>
+	return c;
+  802325:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802329:	c9                   	leave
+  80232a:	c3                   	ret
+		return -E_EOF;
+  80232b:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802330:	eb f7                	jmp    802329 <getchar+0x20>
+
+00802332 <iscons>:
+{
+  802332:	55                   	push   %ebp
+  802333:	89 e5                	mov    %esp,%ebp
+  802335:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802338:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80233b:	50                   	push   %eax
+  80233c:	ff 75 08             	push   0x8(%ebp)
+  80233f:	e8 d8 ef ff ff       	call   80131c <fd_lookup>
+  802344:	83 c4 10             	add    $0x10,%esp
+  802347:	85 c0                	test   %eax,%eax
+  802349:	78 11                	js     80235c <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80234b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80234e:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802354:	39 10                	cmp    %edx,(%eax)
+  802356:	0f 94 c0             	sete   %al
+  802359:	0f b6 c0             	movzbl %al,%eax
+}
+  80235c:	c9                   	leave
+  80235d:	c3                   	ret
+
+0080235e <opencons>:
+{
+  80235e:	55                   	push   %ebp
+  80235f:	89 e5                	mov    %esp,%ebp
+  802361:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802364:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802367:	50                   	push   %eax
+  802368:	e8 59 ef ff ff       	call   8012c6 <fd_alloc>
+  80236d:	83 c4 10             	add    $0x10,%esp
+  802370:	85 c0                	test   %eax,%eax
+  802372:	78 3a                	js     8023ae <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802374:	83 ec 04             	sub    $0x4,%esp
+  802377:	68 07 04 00 00       	push   $0x407
+  80237c:	ff 75 f4             	push   -0xc(%ebp)
+  80237f:	6a 00                	push   $0x0
+  802381:	e8 2f e9 ff ff       	call   800cb5 <sys_page_alloc>
+  802386:	83 c4 10             	add    $0x10,%esp
+  802389:	85 c0                	test   %eax,%eax
+  80238b:	78 21                	js     8023ae <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80238d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802390:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802396:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802398:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80239b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8023a2:	83 ec 0c             	sub    $0xc,%esp
+  8023a5:	50                   	push   %eax
+  8023a6:	e8 f4 ee ff ff       	call   80129f <fd2num>
+  8023ab:	83 c4 10             	add    $0x10,%esp
+}
+  8023ae:	c9                   	leave
+  8023af:	c3                   	ret
+
+008023b0 <set_pgfault_handler>:
+// allocate an exception stack (one page of memory with its top
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf)) {
+  8023b0:	55                   	push   %ebp
+  8023b1:	89 e5                	mov    %esp,%ebp
+  8023b3:	83 ec 08             	sub    $0x8,%esp
+  int r;
+
+  if (_pgfault_handler == 0) {
+  8023b6:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  8023bd:	74 0a                	je     8023c9 <set_pgfault_handler+0x19>
+    if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)))
+      panic(" set_pgfault_handler sys_env_set_pgfault_upcall panic: %e\n", r);
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  8023bf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023c2:	a3 00 80 80 00       	mov    %eax,0x808000
+
+
+}
+  8023c7:	c9                   	leave
+  8023c8:	c3                   	ret
+    if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)))
+  8023c9:	83 ec 04             	sub    $0x4,%esp
+  8023cc:	6a 07                	push   $0x7
+  8023ce:	68 00 f0 bf ee       	push   $0xeebff000
+  8023d3:	6a 00                	push   $0x0
+  8023d5:	e8 db e8 ff ff       	call   800cb5 <sys_page_alloc>
+  8023da:	83 c4 10             	add    $0x10,%esp
+  8023dd:	85 c0                	test   %eax,%eax
+  8023df:	75 28                	jne    802409 <set_pgfault_handler+0x59>
+    if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)))
+  8023e1:	83 ec 08             	sub    $0x8,%esp
+  8023e4:	68 1b 24 80 00       	push   $0x80241b
+  8023e9:	6a 00                	push   $0x0
+  8023eb:	e8 10 ea ff ff       	call   800e00 <sys_env_set_pgfault_upcall>
+  8023f0:	83 c4 10             	add    $0x10,%esp
+  8023f3:	85 c0                	test   %eax,%eax
+  8023f5:	74 c8                	je     8023bf <set_pgfault_handler+0xf>
+      panic(" set_pgfault_handler sys_env_set_pgfault_upcall panic: %e\n", r);
+  8023f7:	50                   	push   %eax
+  8023f8:	68 d4 30 80 00       	push   $0x8030d4
+  8023fd:	6a 22                	push   $0x22
+  8023ff:	68 0f 31 80 00       	push   $0x80310f
+  802404:	e8 2c de ff ff       	call   800235 <_panic>
+      panic("set_pgfault_handler sys_page_alloc panic: %e\n", r);
+  802409:	50                   	push   %eax
+  80240a:	68 a4 30 80 00       	push   $0x8030a4
+  80240f:	6a 20                	push   $0x20
+  802411:	68 0f 31 80 00       	push   $0x80310f
+  802416:	e8 1a de ff ff       	call   800235 <_panic>
+
+0080241b <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80241b:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80241c:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  802421:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  802423:	83 c4 04             	add    $0x4,%esp
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	// push the trap-time %eip onto the trap-time stack
+    subl $0x4, 0x30(%esp) # for push eip
+  802426:	83 6c 24 30 04       	subl   $0x4,0x30(%esp)
+    movl 0x30(%esp), %ebx #regular esp
+  80242b:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+    movl 0x28(%esp), %eax #eip
+  80242f:	8b 44 24 28          	mov    0x28(%esp),%eax
+    movl %eax, (%ebx)
+  802433:	89 03                	mov    %eax,(%ebx)
+
+    // Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+    addl $8, %esp
+  802435:	83 c4 08             	add    $0x8,%esp
+    popal
+  802438:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  802439:	83 c4 04             	add    $0x4,%esp
+	popfl
+  80243c:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  80243d:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  80243e:	c3                   	ret
+
+0080243f <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  80243f:	55                   	push   %ebp
+  802440:	89 e5                	mov    %esp,%ebp
+  802442:	56                   	push   %esi
+  802443:	53                   	push   %ebx
+  802444:	8b 75 08             	mov    0x8(%ebp),%esi
+  802447:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80244a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  80244d:	85 c0                	test   %eax,%eax
+  80244f:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802454:	0f 44 c2             	cmove  %edx,%eax
+  802457:	83 ec 0c             	sub    $0xc,%esp
+  80245a:	50                   	push   %eax
+  80245b:	e8 05 ea ff ff       	call   800e65 <sys_ipc_recv>
+
+  if (from_env_store)
+  802460:	83 c4 10             	add    $0x10,%esp
+  802463:	85 f6                	test   %esi,%esi
+  802465:	74 17                	je     80247e <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  802467:	ba 00 00 00 00       	mov    $0x0,%edx
+  80246c:	85 c0                	test   %eax,%eax
+  80246e:	75 0c                	jne    80247c <ipc_recv+0x3d>
+  802470:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  802476:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  80247c:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  80247e:	85 db                	test   %ebx,%ebx
+  802480:	74 2b                	je     8024ad <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  802482:	85 c0                	test   %eax,%eax
+  802484:	74 0d                	je     802493 <ipc_recv+0x54>
+  802486:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  80248c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80248f:	5b                   	pop    %ebx
+  802490:	5e                   	pop    %esi
+  802491:	5d                   	pop    %ebp
+  802492:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  802493:	a1 08 50 80 00       	mov    0x805008,%eax
+  802498:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80249e:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  8024a0:	a1 08 50 80 00       	mov    0x805008,%eax
+  8024a5:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  8024ab:	eb df                	jmp    80248c <ipc_recv+0x4d>
+  8024ad:	85 c0                	test   %eax,%eax
+  8024af:	75 db                	jne    80248c <ipc_recv+0x4d>
+  8024b1:	eb ed                	jmp    8024a0 <ipc_recv+0x61>
+
+008024b3 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  8024b3:	55                   	push   %ebp
+  8024b4:	89 e5                	mov    %esp,%ebp
+  8024b6:	57                   	push   %edi
+  8024b7:	56                   	push   %esi
+  8024b8:	53                   	push   %ebx
+  8024b9:	83 ec 0c             	sub    $0xc,%esp
+  8024bc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8024bf:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8024c2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  8024c5:	85 db                	test   %ebx,%ebx
+  8024c7:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8024cc:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  8024cf:	ff 75 14             	push   0x14(%ebp)
+  8024d2:	53                   	push   %ebx
+  8024d3:	56                   	push   %esi
+  8024d4:	57                   	push   %edi
+  8024d5:	e8 68 e9 ff ff       	call   800e42 <sys_ipc_try_send>
+  8024da:	83 c4 10             	add    $0x10,%esp
+  8024dd:	85 c0                	test   %eax,%eax
+  8024df:	74 1e                	je     8024ff <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  8024e1:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8024e4:	75 07                	jne    8024ed <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  8024e6:	e8 ab e7 ff ff       	call   800c96 <sys_yield>
+  8024eb:	eb e2                	jmp    8024cf <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  8024ed:	50                   	push   %eax
+  8024ee:	68 1d 31 80 00       	push   $0x80311d
+  8024f3:	6a 3c                	push   $0x3c
+  8024f5:	68 2a 31 80 00       	push   $0x80312a
+  8024fa:	e8 36 dd ff ff       	call   800235 <_panic>
+  }
+
+#endif
+}
+  8024ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802502:	5b                   	pop    %ebx
+  802503:	5e                   	pop    %esi
+  802504:	5f                   	pop    %edi
+  802505:	5d                   	pop    %ebp
+  802506:	c3                   	ret
+
+00802507 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  802507:	55                   	push   %ebp
+  802508:	89 e5                	mov    %esp,%ebp
+  80250a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  80250d:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  802512:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802515:	c1 e0 04             	shl    $0x4,%eax
+  802518:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80251d:	8b 40 50             	mov    0x50(%eax),%eax
+  802520:	39 c8                	cmp    %ecx,%eax
+  802522:	74 12                	je     802536 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  802524:	83 c2 01             	add    $0x1,%edx
+  802527:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  80252d:	75 e3                	jne    802512 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  80252f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802534:	eb 0e                	jmp    802544 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  802536:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802539:	c1 e0 04             	shl    $0x4,%eax
+  80253c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802541:	8b 40 48             	mov    0x48(%eax),%eax
+  802544:	5d                   	pop    %ebp
+  802545:	c3                   	ret
+
+00802546 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802546:	55                   	push   %ebp
+  802547:	89 e5                	mov    %esp,%ebp
+  802549:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80254c:	89 c2                	mov    %eax,%edx
+  80254e:	c1 ea 16             	shr    $0x16,%edx
+  802551:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802558:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80255d:	f6 c1 01             	test   $0x1,%cl
+  802560:	74 1c                	je     80257e <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  802562:	c1 e8 0c             	shr    $0xc,%eax
+  802565:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80256c:	a8 01                	test   $0x1,%al
+  80256e:	74 0e                	je     80257e <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802570:	c1 e8 0c             	shr    $0xc,%eax
+  802573:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  80257a:	ef 
+  80257b:	0f b7 d2             	movzwl %dx,%edx
+}
+  80257e:	89 d0                	mov    %edx,%eax
+  802580:	5d                   	pop    %ebp
+  802581:	c3                   	ret
+  802582:	66 90                	xchg   %ax,%ax
+  802584:	66 90                	xchg   %ax,%ax
+  802586:	66 90                	xchg   %ax,%ax
+  802588:	66 90                	xchg   %ax,%ax
+  80258a:	66 90                	xchg   %ax,%ax
+  80258c:	66 90                	xchg   %ax,%ax
+  80258e:	66 90                	xchg   %ax,%ax
+
+00802590 <__udivmoddi4>:
+  802590:	55                   	push   %ebp
+  802591:	57                   	push   %edi
+  802592:	56                   	push   %esi
+  802593:	53                   	push   %ebx
+  802594:	83 ec 24             	sub    $0x24,%esp
+  802597:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80259b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80259f:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  8025a3:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8025a7:	8b 54 24 44          	mov    0x44(%esp),%edx
+  8025ab:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8025af:	8b 44 24 40          	mov    0x40(%esp),%eax
+  8025b3:	89 d3                	mov    %edx,%ebx
+  8025b5:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8025b9:	09 c3                	or     %eax,%ebx
+  8025bb:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8025bf:	0f 84 9c 00 00 00    	je     802661 <__udivmoddi4+0xd1>
+  8025c5:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8025cc:	00 
+  8025cd:	31 c0                	xor    %eax,%eax
+  8025cf:	31 d2                	xor    %edx,%edx
+  8025d1:	89 fb                	mov    %edi,%ebx
+  8025d3:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8025da:	00 
+  8025db:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8025e0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8025e4:	01 c0                	add    %eax,%eax
+  8025e6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8025ed:	00 
+  8025ee:	89 c6                	mov    %eax,%esi
+  8025f0:	89 d7                	mov    %edx,%edi
+  8025f2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8025f6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8025fa:	0f ad d0             	shrd   %cl,%edx,%eax
+  8025fd:	d3 ea                	shr    %cl,%edx
+  8025ff:	f6 c1 20             	test   $0x20,%cl
+  802602:	0f 45 c2             	cmovne %edx,%eax
+  802605:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802609:	83 e0 01             	and    $0x1,%eax
+  80260c:	09 fa                	or     %edi,%edx
+  80260e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802612:	89 04 24             	mov    %eax,(%esp)
+  802615:	8b 04 24             	mov    (%esp),%eax
+  802618:	89 d5                	mov    %edx,%ebp
+  80261a:	09 f0                	or     %esi,%eax
+  80261c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802620:	39 f0                	cmp    %esi,%eax
+  802622:	19 fd                	sbb    %edi,%ebp
+  802624:	72 1d                	jb     802643 <__udivmoddi4+0xb3>
+  802626:	29 f0                	sub    %esi,%eax
+  802628:	19 fa                	sbb    %edi,%edx
+  80262a:	89 cf                	mov    %ecx,%edi
+  80262c:	c1 ef 05             	shr    $0x5,%edi
+  80262f:	83 e7 01             	and    $0x1,%edi
+  802632:	89 fe                	mov    %edi,%esi
+  802634:	d3 e7                	shl    %cl,%edi
+  802636:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80263a:	83 f6 01             	xor    $0x1,%esi
+  80263d:	d3 e6                	shl    %cl,%esi
+  80263f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802643:	83 e9 01             	sub    $0x1,%ecx
+  802646:	73 98                	jae    8025e0 <__udivmoddi4+0x50>
+  802648:	85 db                	test   %ebx,%ebx
+  80264a:	74 05                	je     802651 <__udivmoddi4+0xc1>
+  80264c:	89 03                	mov    %eax,(%ebx)
+  80264e:	89 53 04             	mov    %edx,0x4(%ebx)
+  802651:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802655:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802659:	83 c4 24             	add    $0x24,%esp
+  80265c:	5b                   	pop    %ebx
+  80265d:	5e                   	pop    %esi
+  80265e:	5f                   	pop    %edi
+  80265f:	5d                   	pop    %ebp
+  802660:	c3                   	ret
+  802661:	85 ff                	test   %edi,%edi
+  802663:	74 0d                	je     802672 <__udivmoddi4+0xe2>
+  802665:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  80266b:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  802672:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802676:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80267a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80267e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802682:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802686:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80268a:	83 c4 24             	add    $0x24,%esp
+  80268d:	5b                   	pop    %ebx
+  80268e:	5e                   	pop    %esi
+  80268f:	5f                   	pop    %edi
+  802690:	5d                   	pop    %ebp
+  802691:	c3                   	ret
+  802692:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802699:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+008026a0 <__udivdi3>:
+  8026a0:	57                   	push   %edi
+  8026a1:	56                   	push   %esi
+  8026a2:	53                   	push   %ebx
+  8026a3:	83 ec 20             	sub    $0x20,%esp
+  8026a6:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8026aa:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8026ae:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8026b2:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8026b6:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8026ba:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8026be:	89 d1                	mov    %edx,%ecx
+  8026c0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8026c4:	09 c1                	or     %eax,%ecx
+  8026c6:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8026ca:	89 44 24 18          	mov    %eax,0x18(%esp)
+  8026ce:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  8026d2:	0f 84 88 00 00 00    	je     802760 <__udivdi3+0xc0>
+  8026d8:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8026df:	00 
+  8026e0:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8026e5:	31 c0                	xor    %eax,%eax
+  8026e7:	31 d2                	xor    %edx,%edx
+  8026e9:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8026f0:	00 
+  8026f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8026f8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8026fc:	01 c0                	add    %eax,%eax
+  8026fe:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802705:	00 
+  802706:	89 c6                	mov    %eax,%esi
+  802708:	89 d7                	mov    %edx,%edi
+  80270a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80270e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802712:	0f ad d0             	shrd   %cl,%edx,%eax
+  802715:	d3 ea                	shr    %cl,%edx
+  802717:	f6 c1 20             	test   $0x20,%cl
+  80271a:	0f 45 c2             	cmovne %edx,%eax
+  80271d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802721:	83 e0 01             	and    $0x1,%eax
+  802724:	09 fa                	or     %edi,%edx
+  802726:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80272a:	89 04 24             	mov    %eax,(%esp)
+  80272d:	8b 04 24             	mov    (%esp),%eax
+  802730:	89 d3                	mov    %edx,%ebx
+  802732:	09 f0                	or     %esi,%eax
+  802734:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802738:	39 f0                	cmp    %esi,%eax
+  80273a:	19 fb                	sbb    %edi,%ebx
+  80273c:	72 1d                	jb     80275b <__udivdi3+0xbb>
+  80273e:	29 f0                	sub    %esi,%eax
+  802740:	19 fa                	sbb    %edi,%edx
+  802742:	89 cf                	mov    %ecx,%edi
+  802744:	c1 ef 05             	shr    $0x5,%edi
+  802747:	83 e7 01             	and    $0x1,%edi
+  80274a:	89 fe                	mov    %edi,%esi
+  80274c:	d3 e7                	shl    %cl,%edi
+  80274e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802752:	83 f6 01             	xor    $0x1,%esi
+  802755:	d3 e6                	shl    %cl,%esi
+  802757:	09 74 24 18          	or     %esi,0x18(%esp)
+  80275b:	83 e9 01             	sub    $0x1,%ecx
+  80275e:	73 98                	jae    8026f8 <__udivdi3+0x58>
+  802760:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802764:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802768:	83 c4 20             	add    $0x20,%esp
+  80276b:	5b                   	pop    %ebx
+  80276c:	5e                   	pop    %esi
+  80276d:	5f                   	pop    %edi
+  80276e:	c3                   	ret
+  80276f:	90                   	nop
+
+00802770 <__umoddi3>:
+  802770:	57                   	push   %edi
+  802771:	56                   	push   %esi
+  802772:	53                   	push   %ebx
+  802773:	83 ec 18             	sub    $0x18,%esp
+  802776:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80277a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80277e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802782:	8b 54 24 34          	mov    0x34(%esp),%edx
+  802786:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80278a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80278e:	89 d1                	mov    %edx,%ecx
+  802790:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802794:	09 c1                	or     %eax,%ecx
+  802796:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80279a:	74 5b                	je     8027f7 <__umoddi3+0x87>
+  80279c:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8027a1:	31 c0                	xor    %eax,%eax
+  8027a3:	31 d2                	xor    %edx,%edx
+  8027a5:	8d 76 00             	lea    0x0(%esi),%esi
+  8027a8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8027ac:	01 c0                	add    %eax,%eax
+  8027ae:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8027b5:	00 
+  8027b6:	89 c6                	mov    %eax,%esi
+  8027b8:	89 d7                	mov    %edx,%edi
+  8027ba:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8027be:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8027c2:	0f ad d0             	shrd   %cl,%edx,%eax
+  8027c5:	d3 ea                	shr    %cl,%edx
+  8027c7:	f6 c1 20             	test   $0x20,%cl
+  8027ca:	0f 45 c2             	cmovne %edx,%eax
+  8027cd:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8027d1:	83 e0 01             	and    $0x1,%eax
+  8027d4:	09 fa                	or     %edi,%edx
+  8027d6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8027da:	89 04 24             	mov    %eax,(%esp)
+  8027dd:	8b 04 24             	mov    (%esp),%eax
+  8027e0:	89 d3                	mov    %edx,%ebx
+  8027e2:	09 f0                	or     %esi,%eax
+  8027e4:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8027e8:	39 f0                	cmp    %esi,%eax
+  8027ea:	19 fb                	sbb    %edi,%ebx
+  8027ec:	72 04                	jb     8027f2 <__umoddi3+0x82>
+  8027ee:	29 f0                	sub    %esi,%eax
+  8027f0:	19 fa                	sbb    %edi,%edx
+  8027f2:	83 e9 01             	sub    $0x1,%ecx
+  8027f5:	73 b1                	jae    8027a8 <__umoddi3+0x38>
+  8027f7:	83 c4 18             	add    $0x18,%esp
+  8027fa:	5b                   	pop    %ebx
+  8027fb:	5e                   	pop    %esi
+  8027fc:	5f                   	pop    %edi
+  8027fd:	c3                   	ret
+  8027fe:	66 90                	xchg   %ax,%ax
+
+00802800 <__divdi3>:
+  802800:	55                   	push   %ebp
+  802801:	57                   	push   %edi
+  802802:	56                   	push   %esi
+  802803:	53                   	push   %ebx
+  802804:	83 ec 24             	sub    $0x24,%esp
+  802807:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  80280b:	8b 74 24 44          	mov    0x44(%esp),%esi
+  80280f:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802813:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802817:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  80281b:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  80281f:	85 d2                	test   %edx,%edx
+  802821:	0f 88 e0 00 00 00    	js     802907 <__divdi3+0x107>
+  802827:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  80282b:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  80282f:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802833:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802837:	85 f6                	test   %esi,%esi
+  802839:	78 16                	js     802851 <__divdi3+0x51>
+  80283b:	89 f1                	mov    %esi,%ecx
+  80283d:	31 c0                	xor    %eax,%eax
+  80283f:	31 d2                	xor    %edx,%edx
+  802841:	09 d9                	or     %ebx,%ecx
+  802843:	0f 85 f3 00 00 00    	jne    80293c <__divdi3+0x13c>
+  802849:	83 c4 24             	add    $0x24,%esp
+  80284c:	5b                   	pop    %ebx
+  80284d:	5e                   	pop    %esi
+  80284e:	5f                   	pop    %edi
+  80284f:	5d                   	pop    %ebp
+  802850:	c3                   	ret
+  802851:	bf 01 00 00 00       	mov    $0x1,%edi
+  802856:	f7 5c 24 08          	negl   0x8(%esp)
+  80285a:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  80285f:	f7 5c 24 0c          	negl   0xc(%esp)
+  802863:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80286a:	00 
+  80286b:	31 c0                	xor    %eax,%eax
+  80286d:	31 d2                	xor    %edx,%edx
+  80286f:	89 fb                	mov    %edi,%ebx
+  802871:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802878:	00 
+  802879:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80287e:	66 90                	xchg   %ax,%ax
+  802880:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802884:	01 c0                	add    %eax,%eax
+  802886:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80288d:	00 
+  80288e:	89 c6                	mov    %eax,%esi
+  802890:	89 d7                	mov    %edx,%edi
+  802892:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802896:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80289a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80289d:	d3 ea                	shr    %cl,%edx
+  80289f:	f6 c1 20             	test   $0x20,%cl
+  8028a2:	0f 45 c2             	cmovne %edx,%eax
+  8028a5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8028a9:	83 e0 01             	and    $0x1,%eax
+  8028ac:	09 fa                	or     %edi,%edx
+  8028ae:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8028b2:	89 04 24             	mov    %eax,(%esp)
+  8028b5:	8b 04 24             	mov    (%esp),%eax
+  8028b8:	89 d5                	mov    %edx,%ebp
+  8028ba:	09 f0                	or     %esi,%eax
+  8028bc:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8028c0:	39 f0                	cmp    %esi,%eax
+  8028c2:	19 fd                	sbb    %edi,%ebp
+  8028c4:	72 1d                	jb     8028e3 <__divdi3+0xe3>
+  8028c6:	29 f0                	sub    %esi,%eax
+  8028c8:	19 fa                	sbb    %edi,%edx
+  8028ca:	89 cf                	mov    %ecx,%edi
+  8028cc:	c1 ef 05             	shr    $0x5,%edi
+  8028cf:	83 e7 01             	and    $0x1,%edi
+  8028d2:	89 fe                	mov    %edi,%esi
+  8028d4:	d3 e7                	shl    %cl,%edi
+  8028d6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8028da:	83 f6 01             	xor    $0x1,%esi
+  8028dd:	d3 e6                	shl    %cl,%esi
+  8028df:	09 74 24 18          	or     %esi,0x18(%esp)
+  8028e3:	83 e9 01             	sub    $0x1,%ecx
+  8028e6:	73 98                	jae    802880 <__divdi3+0x80>
+  8028e8:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8028ec:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8028f0:	85 db                	test   %ebx,%ebx
+  8028f2:	0f 84 51 ff ff ff    	je     802849 <__divdi3+0x49>
+  8028f8:	f7 d8                	neg    %eax
+  8028fa:	83 d2 00             	adc    $0x0,%edx
+  8028fd:	83 c4 24             	add    $0x24,%esp
+  802900:	5b                   	pop    %ebx
+  802901:	f7 da                	neg    %edx
+  802903:	5e                   	pop    %esi
+  802904:	5f                   	pop    %edi
+  802905:	5d                   	pop    %ebp
+  802906:	c3                   	ret
+  802907:	f7 d8                	neg    %eax
+  802909:	83 d2 00             	adc    $0x0,%edx
+  80290c:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802910:	f7 da                	neg    %edx
+  802912:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802916:	85 f6                	test   %esi,%esi
+  802918:	78 1b                	js     802935 <__divdi3+0x135>
+  80291a:	89 f1                	mov    %esi,%ecx
+  80291c:	31 c0                	xor    %eax,%eax
+  80291e:	31 d2                	xor    %edx,%edx
+  802920:	bf 01 00 00 00       	mov    $0x1,%edi
+  802925:	09 d9                	or     %ebx,%ecx
+  802927:	0f 85 36 ff ff ff    	jne    802863 <__divdi3+0x63>
+  80292d:	83 c4 24             	add    $0x24,%esp
+  802930:	5b                   	pop    %ebx
+  802931:	5e                   	pop    %esi
+  802932:	5f                   	pop    %edi
+  802933:	5d                   	pop    %ebp
+  802934:	c3                   	ret
+  802935:	31 ff                	xor    %edi,%edi
+  802937:	e9 1a ff ff ff       	jmp    802856 <__divdi3+0x56>
+  80293c:	31 ff                	xor    %edi,%edi
+  80293e:	e9 20 ff ff ff       	jmp    802863 <__divdi3+0x63>
+  802943:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80294a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00802950 <__moddi3>:
+  802950:	55                   	push   %ebp
+  802951:	57                   	push   %edi
+  802952:	56                   	push   %esi
+  802953:	53                   	push   %ebx
+  802954:	83 ec 1c             	sub    $0x1c,%esp
+  802957:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  80295b:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  80295f:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  802963:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  802967:	89 c8                	mov    %ecx,%eax
+  802969:	89 f2                	mov    %esi,%edx
+  80296b:	89 f3                	mov    %esi,%ebx
+  80296d:	85 ed                	test   %ebp,%ebp
+  80296f:	0f 88 9d 00 00 00    	js     802a12 <__moddi3+0xc2>
+  802975:	09 cb                	or     %ecx,%ebx
+  802977:	0f 84 8d 00 00 00    	je     802a0a <__moddi3+0xba>
+  80297d:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802981:	31 db                	xor    %ebx,%ebx
+  802983:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802987:	89 ca                	mov    %ecx,%edx
+  802989:	89 f0                	mov    %esi,%eax
+  80298b:	89 dd                	mov    %ebx,%ebp
+  80298d:	f7 da                	neg    %edx
+  80298f:	83 d0 00             	adc    $0x0,%eax
+  802992:	f7 d8                	neg    %eax
+  802994:	0f 49 f0             	cmovns %eax,%esi
+  802997:	0f 49 ca             	cmovns %edx,%ecx
+  80299a:	31 c0                	xor    %eax,%eax
+  80299c:	31 d2                	xor    %edx,%edx
+  80299e:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8029a2:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  8029a6:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8029ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  8029af:	90                   	nop
+  8029b0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8029b4:	01 c0                	add    %eax,%eax
+  8029b6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8029bd:	00 
+  8029be:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  8029c2:	89 c6                	mov    %eax,%esi
+  8029c4:	89 d7                	mov    %edx,%edi
+  8029c6:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8029ca:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8029ce:	0f ad d0             	shrd   %cl,%edx,%eax
+  8029d1:	d3 ea                	shr    %cl,%edx
+  8029d3:	f6 c1 20             	test   $0x20,%cl
+  8029d6:	0f 45 c2             	cmovne %edx,%eax
+  8029d9:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8029dd:	83 e0 01             	and    $0x1,%eax
+  8029e0:	09 fa                	or     %edi,%edx
+  8029e2:	89 04 24             	mov    %eax,(%esp)
+  8029e5:	8b 04 24             	mov    (%esp),%eax
+  8029e8:	89 d7                	mov    %edx,%edi
+  8029ea:	09 f0                	or     %esi,%eax
+  8029ec:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  8029f0:	39 d8                	cmp    %ebx,%eax
+  8029f2:	19 f7                	sbb    %esi,%edi
+  8029f4:	72 04                	jb     8029fa <__moddi3+0xaa>
+  8029f6:	29 d8                	sub    %ebx,%eax
+  8029f8:	19 f2                	sbb    %esi,%edx
+  8029fa:	83 e9 01             	sub    $0x1,%ecx
+  8029fd:	73 b1                	jae    8029b0 <__moddi3+0x60>
+  8029ff:	85 ed                	test   %ebp,%ebp
+  802a01:	74 07                	je     802a0a <__moddi3+0xba>
+  802a03:	f7 d8                	neg    %eax
+  802a05:	83 d2 00             	adc    $0x0,%edx
+  802a08:	f7 da                	neg    %edx
+  802a0a:	83 c4 1c             	add    $0x1c,%esp
+  802a0d:	5b                   	pop    %ebx
+  802a0e:	5e                   	pop    %esi
+  802a0f:	5f                   	pop    %edi
+  802a10:	5d                   	pop    %ebp
+  802a11:	c3                   	ret
+  802a12:	09 cb                	or     %ecx,%ebx
+  802a14:	74 f4                	je     802a0a <__moddi3+0xba>
+  802a16:	f7 df                	neg    %edi
+  802a18:	bb 01 00 00 00       	mov    $0x1,%ebx
+  802a1d:	83 d5 00             	adc    $0x0,%ebp
+  802a20:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802a24:	f7 dd                	neg    %ebp
+  802a26:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802a2a:	e9 58 ff ff ff       	jmp    802987 <__moddi3+0x37>
@@ -0,0 +1,6432 @@
+
+obj/user/testpteshare.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 63 01 00 00       	call   800194 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <childofspawn>:
+	breakpoint();
+}
+
+void
+childofspawn(void)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	strcpy(VA, msg2);
+  800039:	ff 35 00 40 80 00    	push   0x804000
+  80003f:	68 00 00 00 a0       	push   $0xa0000000
+  800044:	e8 42 08 00 00       	call   80088b <strcpy>
+	exit();
+  800049:	e8 8f 01 00 00       	call   8001dd <exit>
+}
+  80004e:	83 c4 10             	add    $0x10,%esp
+  800051:	c9                   	leave
+  800052:	c3                   	ret
+
+00800053 <umain>:
+{
+  800053:	55                   	push   %ebp
+  800054:	89 e5                	mov    %esp,%ebp
+  800056:	53                   	push   %ebx
+  800057:	83 ec 04             	sub    $0x4,%esp
+	if (argc != 0)
+  80005a:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  80005e:	0f 85 d0 00 00 00    	jne    800134 <umain+0xe1>
+	if ((r = sys_page_alloc(0, VA, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  800064:	83 ec 04             	sub    $0x4,%esp
+  800067:	68 07 04 00 00       	push   $0x407
+  80006c:	68 00 00 00 a0       	push   $0xa0000000
+  800071:	6a 00                	push   $0x0
+  800073:	e8 ff 0b 00 00       	call   800c77 <sys_page_alloc>
+  800078:	83 c4 10             	add    $0x10,%esp
+  80007b:	85 c0                	test   %eax,%eax
+  80007d:	0f 88 bb 00 00 00    	js     80013e <umain+0xeb>
+	if ((r = fork()) < 0)
+  800083:	e8 bd 0f 00 00       	call   801045 <fork>
+  800088:	89 c3                	mov    %eax,%ebx
+  80008a:	85 c0                	test   %eax,%eax
+  80008c:	0f 88 be 00 00 00    	js     800150 <umain+0xfd>
+	if (r == 0) {
+  800092:	0f 84 ca 00 00 00    	je     800162 <umain+0x10f>
+	wait(r);
+  800098:	83 ec 0c             	sub    $0xc,%esp
+  80009b:	53                   	push   %ebx
+  80009c:	e8 3a 27 00 00       	call   8027db <wait>
+	cprintf("fork handles PTE_SHARE %s\n", strcmp(VA, msg) == 0 ? "right" : "wrong");
+  8000a1:	83 c4 08             	add    $0x8,%esp
+  8000a4:	ff 35 04 40 80 00    	push   0x804004
+  8000aa:	68 00 00 00 a0       	push   $0xa0000000
+  8000af:	e8 88 08 00 00       	call   80093c <strcmp>
+  8000b4:	83 c4 08             	add    $0x8,%esp
+  8000b7:	85 c0                	test   %eax,%eax
+  8000b9:	b8 26 30 80 00       	mov    $0x803026,%eax
+  8000be:	ba 20 30 80 00       	mov    $0x803020,%edx
+  8000c3:	0f 44 c2             	cmove  %edx,%eax
+  8000c6:	50                   	push   %eax
+  8000c7:	68 5c 30 80 00       	push   $0x80305c
+  8000cc:	e8 01 02 00 00       	call   8002d2 <cprintf>
+	if ((r = spawnl("/testpteshare", "testpteshare", "arg", 0)) < 0)
+  8000d1:	6a 00                	push   $0x0
+  8000d3:	68 77 30 80 00       	push   $0x803077
+  8000d8:	68 7c 30 80 00       	push   $0x80307c
+  8000dd:	68 7b 30 80 00       	push   $0x80307b
+  8000e2:	e8 ce 1e 00 00       	call   801fb5 <spawnl>
+  8000e7:	83 c4 20             	add    $0x20,%esp
+  8000ea:	85 c0                	test   %eax,%eax
+  8000ec:	0f 88 90 00 00 00    	js     800182 <umain+0x12f>
+	wait(r);
+  8000f2:	83 ec 0c             	sub    $0xc,%esp
+  8000f5:	50                   	push   %eax
+  8000f6:	e8 e0 26 00 00       	call   8027db <wait>
+	cprintf("spawn handles PTE_SHARE %s\n", strcmp(VA, msg2) == 0 ? "right" : "wrong");
+  8000fb:	83 c4 08             	add    $0x8,%esp
+  8000fe:	ff 35 00 40 80 00    	push   0x804000
+  800104:	68 00 00 00 a0       	push   $0xa0000000
+  800109:	e8 2e 08 00 00       	call   80093c <strcmp>
+  80010e:	83 c4 08             	add    $0x8,%esp
+  800111:	85 c0                	test   %eax,%eax
+  800113:	b8 26 30 80 00       	mov    $0x803026,%eax
+  800118:	ba 20 30 80 00       	mov    $0x803020,%edx
+  80011d:	0f 44 c2             	cmove  %edx,%eax
+  800120:	50                   	push   %eax
+  800121:	68 93 30 80 00       	push   $0x803093
+  800126:	e8 a7 01 00 00       	call   8002d2 <cprintf>
+#include <inc/types.h>
+
+static inline void
+breakpoint(void)
+{
+	asm volatile("int3");
+  80012b:	cc                   	int3
+}
+  80012c:	83 c4 10             	add    $0x10,%esp
+  80012f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800132:	c9                   	leave
+  800133:	c3                   	ret
+		childofspawn();
+  800134:	e8 fa fe ff ff       	call   800033 <childofspawn>
+  800139:	e9 26 ff ff ff       	jmp    800064 <umain+0x11>
+		panic("sys_page_alloc: %e", r);
+  80013e:	50                   	push   %eax
+  80013f:	68 2c 30 80 00       	push   $0x80302c
+  800144:	6a 13                	push   $0x13
+  800146:	68 3f 30 80 00       	push   $0x80303f
+  80014b:	e8 a7 00 00 00       	call   8001f7 <_panic>
+		panic("fork: %e", r);
+  800150:	50                   	push   %eax
+  800151:	68 53 30 80 00       	push   $0x803053
+  800156:	6a 17                	push   $0x17
+  800158:	68 3f 30 80 00       	push   $0x80303f
+  80015d:	e8 95 00 00 00       	call   8001f7 <_panic>
+		strcpy(VA, msg);
+  800162:	83 ec 08             	sub    $0x8,%esp
+  800165:	ff 35 04 40 80 00    	push   0x804004
+  80016b:	68 00 00 00 a0       	push   $0xa0000000
+  800170:	e8 16 07 00 00       	call   80088b <strcpy>
+		exit();
+  800175:	e8 63 00 00 00       	call   8001dd <exit>
+  80017a:	83 c4 10             	add    $0x10,%esp
+  80017d:	e9 16 ff ff ff       	jmp    800098 <umain+0x45>
+		panic("spawn: %e", r);
+  800182:	50                   	push   %eax
+  800183:	68 89 30 80 00       	push   $0x803089
+  800188:	6a 21                	push   $0x21
+  80018a:	68 3f 30 80 00       	push   $0x80303f
+  80018f:	e8 63 00 00 00       	call   8001f7 <_panic>
+
+00800194 <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  800194:	55                   	push   %ebp
+  800195:	89 e5                	mov    %esp,%ebp
+  800197:	56                   	push   %esi
+  800198:	53                   	push   %ebx
+  800199:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80019c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  80019f:	e8 95 0a 00 00       	call   800c39 <sys_getenvid>
+  8001a4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001a9:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8001ac:	c1 e0 04             	shl    $0x4,%eax
+  8001af:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001b4:	a3 08 50 80 00       	mov    %eax,0x805008
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8001b9:	85 db                	test   %ebx,%ebx
+  8001bb:	7e 07                	jle    8001c4 <libmain+0x30>
+    binaryname = argv[0];
+  8001bd:	8b 06                	mov    (%esi),%eax
+  8001bf:	a3 08 40 80 00       	mov    %eax,0x804008
+
+  // call user main routine
+  umain(argc, argv);
+  8001c4:	83 ec 08             	sub    $0x8,%esp
+  8001c7:	56                   	push   %esi
+  8001c8:	53                   	push   %ebx
+  8001c9:	e8 85 fe ff ff       	call   800053 <umain>
+
+  // exit gracefully
+  exit();
+  8001ce:	e8 0a 00 00 00       	call   8001dd <exit>
+}
+  8001d3:	83 c4 10             	add    $0x10,%esp
+  8001d6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8001d9:	5b                   	pop    %ebx
+  8001da:	5e                   	pop    %esi
+  8001db:	5d                   	pop    %ebp
+  8001dc:	c3                   	ret
+
+008001dd <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8001dd:	55                   	push   %ebp
+  8001de:	89 e5                	mov    %esp,%ebp
+  8001e0:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8001e3:	e8 4d 12 00 00       	call   801435 <close_all>
+	sys_env_destroy(0);
+  8001e8:	83 ec 0c             	sub    $0xc,%esp
+  8001eb:	6a 00                	push   $0x0
+  8001ed:	e8 06 0a 00 00       	call   800bf8 <sys_env_destroy>
+}
+  8001f2:	83 c4 10             	add    $0x10,%esp
+  8001f5:	c9                   	leave
+  8001f6:	c3                   	ret
+
+008001f7 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8001f7:	55                   	push   %ebp
+  8001f8:	89 e5                	mov    %esp,%ebp
+  8001fa:	56                   	push   %esi
+  8001fb:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8001fc:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8001ff:	8b 35 08 40 80 00    	mov    0x804008,%esi
+  800205:	e8 2f 0a 00 00       	call   800c39 <sys_getenvid>
+  80020a:	83 ec 0c             	sub    $0xc,%esp
+  80020d:	ff 75 0c             	push   0xc(%ebp)
+  800210:	ff 75 08             	push   0x8(%ebp)
+  800213:	56                   	push   %esi
+  800214:	50                   	push   %eax
+  800215:	68 d8 30 80 00       	push   $0x8030d8
+  80021a:	e8 b3 00 00 00       	call   8002d2 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80021f:	83 c4 18             	add    $0x18,%esp
+  800222:	53                   	push   %ebx
+  800223:	ff 75 10             	push   0x10(%ebp)
+  800226:	e8 56 00 00 00       	call   800281 <vcprintf>
+	cprintf("\n");
+  80022b:	c7 04 24 13 37 80 00 	movl   $0x803713,(%esp)
+  800232:	e8 9b 00 00 00       	call   8002d2 <cprintf>
+  800237:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80023a:	cc                   	int3
+	while (1)
+  80023b:	eb fd                	jmp    80023a <_panic+0x43>
+
+0080023d <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80023d:	55                   	push   %ebp
+  80023e:	89 e5                	mov    %esp,%ebp
+  800240:	53                   	push   %ebx
+  800241:	83 ec 04             	sub    $0x4,%esp
+  800244:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800247:	8b 13                	mov    (%ebx),%edx
+  800249:	8d 42 01             	lea    0x1(%edx),%eax
+  80024c:	89 03                	mov    %eax,(%ebx)
+  80024e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800251:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800255:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80025a:	74 09                	je     800265 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80025c:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800260:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800263:	c9                   	leave
+  800264:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800265:	83 ec 08             	sub    $0x8,%esp
+  800268:	68 ff 00 00 00       	push   $0xff
+  80026d:	8d 43 08             	lea    0x8(%ebx),%eax
+  800270:	50                   	push   %eax
+  800271:	e8 45 09 00 00       	call   800bbb <sys_cputs>
+		b->idx = 0;
+  800276:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80027c:	83 c4 10             	add    $0x10,%esp
+  80027f:	eb db                	jmp    80025c <putch+0x1f>
+
+00800281 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800281:	55                   	push   %ebp
+  800282:	89 e5                	mov    %esp,%ebp
+  800284:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80028a:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800291:	00 00 00 
+	b.cnt = 0;
+  800294:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80029b:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80029e:	ff 75 0c             	push   0xc(%ebp)
+  8002a1:	ff 75 08             	push   0x8(%ebp)
+  8002a4:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8002aa:	50                   	push   %eax
+  8002ab:	68 3d 02 80 00       	push   $0x80023d
+  8002b0:	e8 14 01 00 00       	call   8003c9 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8002b5:	83 c4 08             	add    $0x8,%esp
+  8002b8:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8002be:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8002c4:	50                   	push   %eax
+  8002c5:	e8 f1 08 00 00       	call   800bbb <sys_cputs>
+
+	return b.cnt;
+}
+  8002ca:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8002d0:	c9                   	leave
+  8002d1:	c3                   	ret
+
+008002d2 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8002d2:	55                   	push   %ebp
+  8002d3:	89 e5                	mov    %esp,%ebp
+  8002d5:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8002d8:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8002db:	50                   	push   %eax
+  8002dc:	ff 75 08             	push   0x8(%ebp)
+  8002df:	e8 9d ff ff ff       	call   800281 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8002e4:	c9                   	leave
+  8002e5:	c3                   	ret
+
+008002e6 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8002e6:	55                   	push   %ebp
+  8002e7:	89 e5                	mov    %esp,%ebp
+  8002e9:	57                   	push   %edi
+  8002ea:	56                   	push   %esi
+  8002eb:	53                   	push   %ebx
+  8002ec:	83 ec 1c             	sub    $0x1c,%esp
+  8002ef:	89 c7                	mov    %eax,%edi
+  8002f1:	89 d6                	mov    %edx,%esi
+  8002f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002f6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8002f9:	89 d1                	mov    %edx,%ecx
+  8002fb:	89 c2                	mov    %eax,%edx
+  8002fd:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800300:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800303:	8b 45 10             	mov    0x10(%ebp),%eax
+  800306:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800309:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80030c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800313:	39 c2                	cmp    %eax,%edx
+  800315:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800318:	72 3e                	jb     800358 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80031a:	83 ec 0c             	sub    $0xc,%esp
+  80031d:	ff 75 18             	push   0x18(%ebp)
+  800320:	83 eb 01             	sub    $0x1,%ebx
+  800323:	53                   	push   %ebx
+  800324:	50                   	push   %eax
+  800325:	83 ec 08             	sub    $0x8,%esp
+  800328:	ff 75 e4             	push   -0x1c(%ebp)
+  80032b:	ff 75 e0             	push   -0x20(%ebp)
+  80032e:	ff 75 dc             	push   -0x24(%ebp)
+  800331:	ff 75 d8             	push   -0x28(%ebp)
+  800334:	e8 57 29 00 00       	call   802c90 <__udivdi3>
+  800339:	83 c4 18             	add    $0x18,%esp
+  80033c:	52                   	push   %edx
+  80033d:	50                   	push   %eax
+  80033e:	89 f2                	mov    %esi,%edx
+  800340:	89 f8                	mov    %edi,%eax
+  800342:	e8 9f ff ff ff       	call   8002e6 <printnum>
+  800347:	83 c4 20             	add    $0x20,%esp
+  80034a:	eb 13                	jmp    80035f <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80034c:	83 ec 08             	sub    $0x8,%esp
+  80034f:	56                   	push   %esi
+  800350:	ff 75 18             	push   0x18(%ebp)
+  800353:	ff d7                	call   *%edi
+  800355:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800358:	83 eb 01             	sub    $0x1,%ebx
+  80035b:	85 db                	test   %ebx,%ebx
+  80035d:	7f ed                	jg     80034c <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80035f:	83 ec 08             	sub    $0x8,%esp
+  800362:	56                   	push   %esi
+  800363:	83 ec 04             	sub    $0x4,%esp
+  800366:	ff 75 e4             	push   -0x1c(%ebp)
+  800369:	ff 75 e0             	push   -0x20(%ebp)
+  80036c:	ff 75 dc             	push   -0x24(%ebp)
+  80036f:	ff 75 d8             	push   -0x28(%ebp)
+  800372:	e8 e9 29 00 00       	call   802d60 <__umoddi3>
+  800377:	83 c4 14             	add    $0x14,%esp
+  80037a:	0f be 80 fb 30 80 00 	movsbl 0x8030fb(%eax),%eax
+  800381:	50                   	push   %eax
+  800382:	ff d7                	call   *%edi
+}
+  800384:	83 c4 10             	add    $0x10,%esp
+  800387:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80038a:	5b                   	pop    %ebx
+  80038b:	5e                   	pop    %esi
+  80038c:	5f                   	pop    %edi
+  80038d:	5d                   	pop    %ebp
+  80038e:	c3                   	ret
+
+0080038f <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80038f:	55                   	push   %ebp
+  800390:	89 e5                	mov    %esp,%ebp
+  800392:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800395:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800399:	8b 10                	mov    (%eax),%edx
+  80039b:	3b 50 04             	cmp    0x4(%eax),%edx
+  80039e:	73 0a                	jae    8003aa <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8003a0:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8003a3:	89 08                	mov    %ecx,(%eax)
+  8003a5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003a8:	88 02                	mov    %al,(%edx)
+}
+  8003aa:	5d                   	pop    %ebp
+  8003ab:	c3                   	ret
+
+008003ac <printfmt>:
+{
+  8003ac:	55                   	push   %ebp
+  8003ad:	89 e5                	mov    %esp,%ebp
+  8003af:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8003b2:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8003b5:	50                   	push   %eax
+  8003b6:	ff 75 10             	push   0x10(%ebp)
+  8003b9:	ff 75 0c             	push   0xc(%ebp)
+  8003bc:	ff 75 08             	push   0x8(%ebp)
+  8003bf:	e8 05 00 00 00       	call   8003c9 <vprintfmt>
+}
+  8003c4:	83 c4 10             	add    $0x10,%esp
+  8003c7:	c9                   	leave
+  8003c8:	c3                   	ret
+
+008003c9 <vprintfmt>:
+{
+  8003c9:	55                   	push   %ebp
+  8003ca:	89 e5                	mov    %esp,%ebp
+  8003cc:	57                   	push   %edi
+  8003cd:	56                   	push   %esi
+  8003ce:	53                   	push   %ebx
+  8003cf:	83 ec 2c             	sub    $0x2c,%esp
+  8003d2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8003d5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8003d8:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8003db:	eb 0a                	jmp    8003e7 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8003dd:	83 ec 08             	sub    $0x8,%esp
+  8003e0:	53                   	push   %ebx
+  8003e1:	50                   	push   %eax
+  8003e2:	ff d6                	call   *%esi
+  8003e4:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8003e7:	83 c7 01             	add    $0x1,%edi
+  8003ea:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8003ee:	83 f8 25             	cmp    $0x25,%eax
+  8003f1:	74 0c                	je     8003ff <vprintfmt+0x36>
+			if (ch == '\0')
+  8003f3:	85 c0                	test   %eax,%eax
+  8003f5:	75 e6                	jne    8003dd <vprintfmt+0x14>
+}
+  8003f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003fa:	5b                   	pop    %ebx
+  8003fb:	5e                   	pop    %esi
+  8003fc:	5f                   	pop    %edi
+  8003fd:	5d                   	pop    %ebp
+  8003fe:	c3                   	ret
+		padc = ' ';
+  8003ff:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800403:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80040a:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800411:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800418:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80041d:	8d 47 01             	lea    0x1(%edi),%eax
+  800420:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800423:	0f b6 17             	movzbl (%edi),%edx
+  800426:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800429:	3c 55                	cmp    $0x55,%al
+  80042b:	0f 87 9a 03 00 00    	ja     8007cb <vprintfmt+0x402>
+  800431:	0f b6 c0             	movzbl %al,%eax
+  800434:	ff 24 85 40 32 80 00 	jmp    *0x803240(,%eax,4)
+  80043b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  80043e:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800442:	eb d9                	jmp    80041d <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800444:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800447:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80044b:	eb d0                	jmp    80041d <vprintfmt+0x54>
+  80044d:	0f b6 d2             	movzbl %dl,%edx
+  800450:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800453:	b8 00 00 00 00       	mov    $0x0,%eax
+  800458:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80045b:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80045e:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800462:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800465:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800468:	83 f9 09             	cmp    $0x9,%ecx
+  80046b:	77 55                	ja     8004c2 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  80046d:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800470:	eb e9                	jmp    80045b <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800472:	8b 45 14             	mov    0x14(%ebp),%eax
+  800475:	8b 00                	mov    (%eax),%eax
+  800477:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80047a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80047d:	8d 40 04             	lea    0x4(%eax),%eax
+  800480:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800483:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800486:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80048a:	79 91                	jns    80041d <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80048c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80048f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800492:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800499:	eb 82                	jmp    80041d <vprintfmt+0x54>
+			if (width < 0)
+  80049b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80049e:	85 d2                	test   %edx,%edx
+  8004a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004a5:	0f 49 c2             	cmovns %edx,%eax
+  8004a8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004ab:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8004ae:	e9 6a ff ff ff       	jmp    80041d <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004b3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8004b6:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8004bd:	e9 5b ff ff ff       	jmp    80041d <vprintfmt+0x54>
+  8004c2:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8004c5:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004c8:	eb bc                	jmp    800486 <vprintfmt+0xbd>
+			lflag++;
+  8004ca:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8004cd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8004d0:	e9 48 ff ff ff       	jmp    80041d <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8004d5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004d8:	8d 78 04             	lea    0x4(%eax),%edi
+  8004db:	83 ec 08             	sub    $0x8,%esp
+  8004de:	53                   	push   %ebx
+  8004df:	ff 30                	push   (%eax)
+  8004e1:	ff d6                	call   *%esi
+			break;
+  8004e3:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8004e6:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8004e9:	e9 7c 02 00 00       	jmp    80076a <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  8004ee:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004f1:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8004f4:	8b 10                	mov    (%eax),%edx
+  8004f6:	89 d0                	mov    %edx,%eax
+  8004f8:	f7 d8                	neg    %eax
+  8004fa:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8004fd:	83 f8 10             	cmp    $0x10,%eax
+  800500:	7f 23                	jg     800525 <vprintfmt+0x15c>
+  800502:	8b 14 85 a0 33 80 00 	mov    0x8033a0(,%eax,4),%edx
+  800509:	85 d2                	test   %edx,%edx
+  80050b:	74 18                	je     800525 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  80050d:	52                   	push   %edx
+  80050e:	68 e5 35 80 00       	push   $0x8035e5
+  800513:	53                   	push   %ebx
+  800514:	56                   	push   %esi
+  800515:	e8 92 fe ff ff       	call   8003ac <printfmt>
+  80051a:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80051d:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800520:	e9 45 02 00 00       	jmp    80076a <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  800525:	50                   	push   %eax
+  800526:	68 13 31 80 00       	push   $0x803113
+  80052b:	53                   	push   %ebx
+  80052c:	56                   	push   %esi
+  80052d:	e8 7a fe ff ff       	call   8003ac <printfmt>
+  800532:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800535:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800538:	e9 2d 02 00 00       	jmp    80076a <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80053d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800540:	83 c0 04             	add    $0x4,%eax
+  800543:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800546:	8b 45 14             	mov    0x14(%ebp),%eax
+  800549:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80054b:	85 c9                	test   %ecx,%ecx
+  80054d:	b8 0c 31 80 00       	mov    $0x80310c,%eax
+  800552:	0f 45 c1             	cmovne %ecx,%eax
+  800555:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800558:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80055c:	7e 06                	jle    800564 <vprintfmt+0x19b>
+  80055e:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800562:	75 0b                	jne    80056f <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800564:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800567:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80056a:	89 75 08             	mov    %esi,0x8(%ebp)
+  80056d:	eb 5c                	jmp    8005cb <vprintfmt+0x202>
+  80056f:	83 ec 08             	sub    $0x8,%esp
+  800572:	ff 75 d0             	push   -0x30(%ebp)
+  800575:	ff 75 cc             	push   -0x34(%ebp)
+  800578:	e8 eb 02 00 00       	call   800868 <strnlen>
+  80057d:	89 c2                	mov    %eax,%edx
+  80057f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800582:	29 d0                	sub    %edx,%eax
+  800584:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800587:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80058b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80058e:	89 75 08             	mov    %esi,0x8(%ebp)
+  800591:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800593:	eb 0e                	jmp    8005a3 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800595:	83 ec 08             	sub    $0x8,%esp
+  800598:	53                   	push   %ebx
+  800599:	57                   	push   %edi
+  80059a:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80059d:	83 ee 01             	sub    $0x1,%esi
+  8005a0:	83 c4 10             	add    $0x10,%esp
+  8005a3:	85 f6                	test   %esi,%esi
+  8005a5:	7f ee                	jg     800595 <vprintfmt+0x1cc>
+  8005a7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005aa:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005ad:	85 c0                	test   %eax,%eax
+  8005af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005b4:	0f 49 d0             	cmovns %eax,%edx
+  8005b7:	29 d0                	sub    %edx,%eax
+  8005b9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005bc:	eb a6                	jmp    800564 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8005be:	83 ec 08             	sub    $0x8,%esp
+  8005c1:	53                   	push   %ebx
+  8005c2:	52                   	push   %edx
+  8005c3:	ff 55 08             	call   *0x8(%ebp)
+  8005c6:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005c9:	89 f1                	mov    %esi,%ecx
+  8005cb:	8d 71 01             	lea    0x1(%ecx),%esi
+  8005ce:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8005d2:	0f be d0             	movsbl %al,%edx
+  8005d5:	85 d2                	test   %edx,%edx
+  8005d7:	74 28                	je     800601 <vprintfmt+0x238>
+  8005d9:	85 ff                	test   %edi,%edi
+  8005db:	78 05                	js     8005e2 <vprintfmt+0x219>
+  8005dd:	83 ef 01             	sub    $0x1,%edi
+  8005e0:	78 30                	js     800612 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8005e2:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8005e6:	74 d6                	je     8005be <vprintfmt+0x1f5>
+  8005e8:	0f be c0             	movsbl %al,%eax
+  8005eb:	83 e8 20             	sub    $0x20,%eax
+  8005ee:	83 f8 5e             	cmp    $0x5e,%eax
+  8005f1:	76 cb                	jbe    8005be <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8005f3:	83 ec 08             	sub    $0x8,%esp
+  8005f6:	53                   	push   %ebx
+  8005f7:	6a 3f                	push   $0x3f
+  8005f9:	ff 55 08             	call   *0x8(%ebp)
+  8005fc:	83 c4 10             	add    $0x10,%esp
+  8005ff:	eb c8                	jmp    8005c9 <vprintfmt+0x200>
+  800601:	8b 75 08             	mov    0x8(%ebp),%esi
+  800604:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800607:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80060a:	01 d0                	add    %edx,%eax
+  80060c:	29 c8                	sub    %ecx,%eax
+  80060e:	89 c7                	mov    %eax,%edi
+  800610:	eb 13                	jmp    800625 <vprintfmt+0x25c>
+  800612:	8b 75 08             	mov    0x8(%ebp),%esi
+  800615:	eb ed                	jmp    800604 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800617:	83 ec 08             	sub    $0x8,%esp
+  80061a:	53                   	push   %ebx
+  80061b:	6a 20                	push   $0x20
+  80061d:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80061f:	83 ef 01             	sub    $0x1,%edi
+  800622:	83 c4 10             	add    $0x10,%esp
+  800625:	85 ff                	test   %edi,%edi
+  800627:	7f ee                	jg     800617 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800629:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80062c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80062f:	e9 36 01 00 00       	jmp    80076a <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  800634:	83 f9 01             	cmp    $0x1,%ecx
+  800637:	7f 1f                	jg     800658 <vprintfmt+0x28f>
+	else if (lflag)
+  800639:	85 c9                	test   %ecx,%ecx
+  80063b:	74 67                	je     8006a4 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  80063d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800640:	8b 00                	mov    (%eax),%eax
+  800642:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800645:	89 c1                	mov    %eax,%ecx
+  800647:	c1 f9 1f             	sar    $0x1f,%ecx
+  80064a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80064d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800650:	8d 40 04             	lea    0x4(%eax),%eax
+  800653:	89 45 14             	mov    %eax,0x14(%ebp)
+  800656:	eb 17                	jmp    80066f <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800658:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065b:	8b 50 04             	mov    0x4(%eax),%edx
+  80065e:	8b 00                	mov    (%eax),%eax
+  800660:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800663:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800666:	8b 45 14             	mov    0x14(%ebp),%eax
+  800669:	8d 40 08             	lea    0x8(%eax),%eax
+  80066c:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80066f:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800672:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800675:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80067a:	85 c9                	test   %ecx,%ecx
+  80067c:	0f 89 ce 00 00 00    	jns    800750 <vprintfmt+0x387>
+				putch('-', putdat);
+  800682:	83 ec 08             	sub    $0x8,%esp
+  800685:	53                   	push   %ebx
+  800686:	6a 2d                	push   $0x2d
+  800688:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80068a:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80068d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800690:	f7 da                	neg    %edx
+  800692:	83 d1 00             	adc    $0x0,%ecx
+  800695:	f7 d9                	neg    %ecx
+  800697:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80069a:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80069f:	e9 ac 00 00 00       	jmp    800750 <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  8006a4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a7:	8b 00                	mov    (%eax),%eax
+  8006a9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006ac:	89 c1                	mov    %eax,%ecx
+  8006ae:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006b1:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006b4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b7:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ba:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006bd:	eb b0                	jmp    80066f <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8006bf:	83 f9 01             	cmp    $0x1,%ecx
+  8006c2:	7f 1b                	jg     8006df <vprintfmt+0x316>
+	else if (lflag)
+  8006c4:	85 c9                	test   %ecx,%ecx
+  8006c6:	74 2c                	je     8006f4 <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  8006c8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006cb:	8b 10                	mov    (%eax),%edx
+  8006cd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006d2:	8d 40 04             	lea    0x4(%eax),%eax
+  8006d5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006d8:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8006dd:	eb 71                	jmp    800750 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  8006df:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e2:	8b 10                	mov    (%eax),%edx
+  8006e4:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006e7:	8d 40 08             	lea    0x8(%eax),%eax
+  8006ea:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006ed:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8006f2:	eb 5c                	jmp    800750 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  8006f4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f7:	8b 10                	mov    (%eax),%edx
+  8006f9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006fe:	8d 40 04             	lea    0x4(%eax),%eax
+  800701:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800704:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800709:	eb 45                	jmp    800750 <vprintfmt+0x387>
+			putch('X', putdat);
+  80070b:	83 ec 08             	sub    $0x8,%esp
+  80070e:	53                   	push   %ebx
+  80070f:	6a 58                	push   $0x58
+  800711:	ff d6                	call   *%esi
+			putch('X', putdat);
+  800713:	83 c4 08             	add    $0x8,%esp
+  800716:	53                   	push   %ebx
+  800717:	6a 58                	push   $0x58
+  800719:	ff d6                	call   *%esi
+			putch('X', putdat);
+  80071b:	83 c4 08             	add    $0x8,%esp
+  80071e:	53                   	push   %ebx
+  80071f:	6a 58                	push   $0x58
+  800721:	ff d6                	call   *%esi
+			break;
+  800723:	83 c4 10             	add    $0x10,%esp
+  800726:	eb 42                	jmp    80076a <vprintfmt+0x3a1>
+			putch('0', putdat);
+  800728:	83 ec 08             	sub    $0x8,%esp
+  80072b:	53                   	push   %ebx
+  80072c:	6a 30                	push   $0x30
+  80072e:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800730:	83 c4 08             	add    $0x8,%esp
+  800733:	53                   	push   %ebx
+  800734:	6a 78                	push   $0x78
+  800736:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800738:	8b 45 14             	mov    0x14(%ebp),%eax
+  80073b:	8b 10                	mov    (%eax),%edx
+  80073d:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800742:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800745:	8d 40 04             	lea    0x4(%eax),%eax
+  800748:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80074b:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800750:	83 ec 0c             	sub    $0xc,%esp
+  800753:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800757:	50                   	push   %eax
+  800758:	ff 75 e0             	push   -0x20(%ebp)
+  80075b:	57                   	push   %edi
+  80075c:	51                   	push   %ecx
+  80075d:	52                   	push   %edx
+  80075e:	89 da                	mov    %ebx,%edx
+  800760:	89 f0                	mov    %esi,%eax
+  800762:	e8 7f fb ff ff       	call   8002e6 <printnum>
+			break;
+  800767:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80076a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80076d:	e9 75 fc ff ff       	jmp    8003e7 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800772:	83 f9 01             	cmp    $0x1,%ecx
+  800775:	7f 1b                	jg     800792 <vprintfmt+0x3c9>
+	else if (lflag)
+  800777:	85 c9                	test   %ecx,%ecx
+  800779:	74 2c                	je     8007a7 <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  80077b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077e:	8b 10                	mov    (%eax),%edx
+  800780:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800785:	8d 40 04             	lea    0x4(%eax),%eax
+  800788:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80078b:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800790:	eb be                	jmp    800750 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  800792:	8b 45 14             	mov    0x14(%ebp),%eax
+  800795:	8b 10                	mov    (%eax),%edx
+  800797:	8b 48 04             	mov    0x4(%eax),%ecx
+  80079a:	8d 40 08             	lea    0x8(%eax),%eax
+  80079d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007a0:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8007a5:	eb a9                	jmp    800750 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  8007a7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007aa:	8b 10                	mov    (%eax),%edx
+  8007ac:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007b1:	8d 40 04             	lea    0x4(%eax),%eax
+  8007b4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007b7:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8007bc:	eb 92                	jmp    800750 <vprintfmt+0x387>
+			putch(ch, putdat);
+  8007be:	83 ec 08             	sub    $0x8,%esp
+  8007c1:	53                   	push   %ebx
+  8007c2:	6a 25                	push   $0x25
+  8007c4:	ff d6                	call   *%esi
+			break;
+  8007c6:	83 c4 10             	add    $0x10,%esp
+  8007c9:	eb 9f                	jmp    80076a <vprintfmt+0x3a1>
+			putch('%', putdat);
+  8007cb:	83 ec 08             	sub    $0x8,%esp
+  8007ce:	53                   	push   %ebx
+  8007cf:	6a 25                	push   $0x25
+  8007d1:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8007d3:	83 c4 10             	add    $0x10,%esp
+  8007d6:	89 f8                	mov    %edi,%eax
+  8007d8:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8007dc:	74 05                	je     8007e3 <vprintfmt+0x41a>
+  8007de:	83 e8 01             	sub    $0x1,%eax
+  8007e1:	eb f5                	jmp    8007d8 <vprintfmt+0x40f>
+  8007e3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8007e6:	eb 82                	jmp    80076a <vprintfmt+0x3a1>
+
+008007e8 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8007e8:	55                   	push   %ebp
+  8007e9:	89 e5                	mov    %esp,%ebp
+  8007eb:	83 ec 18             	sub    $0x18,%esp
+  8007ee:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007f1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8007f4:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8007f7:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8007fb:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8007fe:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800805:	85 c0                	test   %eax,%eax
+  800807:	74 26                	je     80082f <vsnprintf+0x47>
+  800809:	85 d2                	test   %edx,%edx
+  80080b:	7e 22                	jle    80082f <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80080d:	ff 75 14             	push   0x14(%ebp)
+  800810:	ff 75 10             	push   0x10(%ebp)
+  800813:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800816:	50                   	push   %eax
+  800817:	68 8f 03 80 00       	push   $0x80038f
+  80081c:	e8 a8 fb ff ff       	call   8003c9 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800821:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800824:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800827:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80082a:	83 c4 10             	add    $0x10,%esp
+}
+  80082d:	c9                   	leave
+  80082e:	c3                   	ret
+		return -E_INVAL;
+  80082f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800834:	eb f7                	jmp    80082d <vsnprintf+0x45>
+
+00800836 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800836:	55                   	push   %ebp
+  800837:	89 e5                	mov    %esp,%ebp
+  800839:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80083c:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80083f:	50                   	push   %eax
+  800840:	ff 75 10             	push   0x10(%ebp)
+  800843:	ff 75 0c             	push   0xc(%ebp)
+  800846:	ff 75 08             	push   0x8(%ebp)
+  800849:	e8 9a ff ff ff       	call   8007e8 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80084e:	c9                   	leave
+  80084f:	c3                   	ret
+
+00800850 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800850:	55                   	push   %ebp
+  800851:	89 e5                	mov    %esp,%ebp
+  800853:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800856:	b8 00 00 00 00       	mov    $0x0,%eax
+  80085b:	eb 03                	jmp    800860 <strlen+0x10>
+		n++;
+  80085d:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800860:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800864:	75 f7                	jne    80085d <strlen+0xd>
+	return n;
+}
+  800866:	5d                   	pop    %ebp
+  800867:	c3                   	ret
+
+00800868 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800868:	55                   	push   %ebp
+  800869:	89 e5                	mov    %esp,%ebp
+  80086b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80086e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800871:	b8 00 00 00 00       	mov    $0x0,%eax
+  800876:	eb 03                	jmp    80087b <strnlen+0x13>
+		n++;
+  800878:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80087b:	39 d0                	cmp    %edx,%eax
+  80087d:	74 08                	je     800887 <strnlen+0x1f>
+  80087f:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800883:	75 f3                	jne    800878 <strnlen+0x10>
+  800885:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800887:	89 d0                	mov    %edx,%eax
+  800889:	5d                   	pop    %ebp
+  80088a:	c3                   	ret
+
+0080088b <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80088b:	55                   	push   %ebp
+  80088c:	89 e5                	mov    %esp,%ebp
+  80088e:	53                   	push   %ebx
+  80088f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800892:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800895:	b8 00 00 00 00       	mov    $0x0,%eax
+  80089a:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80089e:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8008a1:	83 c0 01             	add    $0x1,%eax
+  8008a4:	84 d2                	test   %dl,%dl
+  8008a6:	75 f2                	jne    80089a <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8008a8:	89 c8                	mov    %ecx,%eax
+  8008aa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008ad:	c9                   	leave
+  8008ae:	c3                   	ret
+
+008008af <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8008af:	55                   	push   %ebp
+  8008b0:	89 e5                	mov    %esp,%ebp
+  8008b2:	53                   	push   %ebx
+  8008b3:	83 ec 10             	sub    $0x10,%esp
+  8008b6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8008b9:	53                   	push   %ebx
+  8008ba:	e8 91 ff ff ff       	call   800850 <strlen>
+  8008bf:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8008c2:	ff 75 0c             	push   0xc(%ebp)
+  8008c5:	01 d8                	add    %ebx,%eax
+  8008c7:	50                   	push   %eax
+  8008c8:	e8 be ff ff ff       	call   80088b <strcpy>
+	return dst;
+}
+  8008cd:	89 d8                	mov    %ebx,%eax
+  8008cf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008d2:	c9                   	leave
+  8008d3:	c3                   	ret
+
+008008d4 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8008d4:	55                   	push   %ebp
+  8008d5:	89 e5                	mov    %esp,%ebp
+  8008d7:	56                   	push   %esi
+  8008d8:	53                   	push   %ebx
+  8008d9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008dc:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8008df:	89 f3                	mov    %esi,%ebx
+  8008e1:	03 5d 10             	add    0x10(%ebp),%ebx
+  8008e4:	89 f0                	mov    %esi,%eax
+  8008e6:	eb 0f                	jmp    8008f7 <strncpy+0x23>
+		*dst++ = *src;
+  8008e8:	83 c0 01             	add    $0x1,%eax
+  8008eb:	0f b6 0a             	movzbl (%edx),%ecx
+  8008ee:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8008f1:	80 f9 01             	cmp    $0x1,%cl
+  8008f4:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8008f7:	39 d8                	cmp    %ebx,%eax
+  8008f9:	75 ed                	jne    8008e8 <strncpy+0x14>
+	}
+	return ret;
+}
+  8008fb:	89 f0                	mov    %esi,%eax
+  8008fd:	5b                   	pop    %ebx
+  8008fe:	5e                   	pop    %esi
+  8008ff:	5d                   	pop    %ebp
+  800900:	c3                   	ret
+
+00800901 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800901:	55                   	push   %ebp
+  800902:	89 e5                	mov    %esp,%ebp
+  800904:	56                   	push   %esi
+  800905:	53                   	push   %ebx
+  800906:	8b 75 08             	mov    0x8(%ebp),%esi
+  800909:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80090c:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80090f:	89 f0                	mov    %esi,%eax
+  800911:	85 d2                	test   %edx,%edx
+  800913:	74 21                	je     800936 <strlcpy+0x35>
+  800915:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800919:	89 f2                	mov    %esi,%edx
+  80091b:	eb 09                	jmp    800926 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  80091d:	83 c1 01             	add    $0x1,%ecx
+  800920:	83 c2 01             	add    $0x1,%edx
+  800923:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800926:	39 c2                	cmp    %eax,%edx
+  800928:	74 09                	je     800933 <strlcpy+0x32>
+  80092a:	0f b6 19             	movzbl (%ecx),%ebx
+  80092d:	84 db                	test   %bl,%bl
+  80092f:	75 ec                	jne    80091d <strlcpy+0x1c>
+  800931:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800933:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800936:	29 f0                	sub    %esi,%eax
+}
+  800938:	5b                   	pop    %ebx
+  800939:	5e                   	pop    %esi
+  80093a:	5d                   	pop    %ebp
+  80093b:	c3                   	ret
+
+0080093c <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80093c:	55                   	push   %ebp
+  80093d:	89 e5                	mov    %esp,%ebp
+  80093f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800942:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800945:	eb 06                	jmp    80094d <strcmp+0x11>
+		p++, q++;
+  800947:	83 c1 01             	add    $0x1,%ecx
+  80094a:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  80094d:	0f b6 01             	movzbl (%ecx),%eax
+  800950:	84 c0                	test   %al,%al
+  800952:	74 04                	je     800958 <strcmp+0x1c>
+  800954:	3a 02                	cmp    (%edx),%al
+  800956:	74 ef                	je     800947 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800958:	0f b6 c0             	movzbl %al,%eax
+  80095b:	0f b6 12             	movzbl (%edx),%edx
+  80095e:	29 d0                	sub    %edx,%eax
+}
+  800960:	5d                   	pop    %ebp
+  800961:	c3                   	ret
+
+00800962 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800962:	55                   	push   %ebp
+  800963:	89 e5                	mov    %esp,%ebp
+  800965:	53                   	push   %ebx
+  800966:	8b 45 08             	mov    0x8(%ebp),%eax
+  800969:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80096c:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80096f:	eb 09                	jmp    80097a <strncmp+0x18>
+		n--, p++, q++;
+  800971:	83 ea 01             	sub    $0x1,%edx
+  800974:	83 c0 01             	add    $0x1,%eax
+  800977:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80097a:	85 d2                	test   %edx,%edx
+  80097c:	74 18                	je     800996 <strncmp+0x34>
+  80097e:	0f b6 18             	movzbl (%eax),%ebx
+  800981:	84 db                	test   %bl,%bl
+  800983:	74 04                	je     800989 <strncmp+0x27>
+  800985:	3a 19                	cmp    (%ecx),%bl
+  800987:	74 e8                	je     800971 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800989:	0f b6 00             	movzbl (%eax),%eax
+  80098c:	0f b6 11             	movzbl (%ecx),%edx
+  80098f:	29 d0                	sub    %edx,%eax
+}
+  800991:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800994:	c9                   	leave
+  800995:	c3                   	ret
+		return 0;
+  800996:	b8 00 00 00 00       	mov    $0x0,%eax
+  80099b:	eb f4                	jmp    800991 <strncmp+0x2f>
+
+0080099d <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80099d:	55                   	push   %ebp
+  80099e:	89 e5                	mov    %esp,%ebp
+  8009a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009a3:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009a7:	eb 03                	jmp    8009ac <strchr+0xf>
+  8009a9:	83 c0 01             	add    $0x1,%eax
+  8009ac:	0f b6 10             	movzbl (%eax),%edx
+  8009af:	84 d2                	test   %dl,%dl
+  8009b1:	74 06                	je     8009b9 <strchr+0x1c>
+		if (*s == c)
+  8009b3:	38 ca                	cmp    %cl,%dl
+  8009b5:	75 f2                	jne    8009a9 <strchr+0xc>
+  8009b7:	eb 05                	jmp    8009be <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8009b9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009be:	5d                   	pop    %ebp
+  8009bf:	c3                   	ret
+
+008009c0 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8009c0:	55                   	push   %ebp
+  8009c1:	89 e5                	mov    %esp,%ebp
+  8009c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009c6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009ca:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8009cd:	38 ca                	cmp    %cl,%dl
+  8009cf:	74 09                	je     8009da <strfind+0x1a>
+  8009d1:	84 d2                	test   %dl,%dl
+  8009d3:	74 05                	je     8009da <strfind+0x1a>
+	for (; *s; s++)
+  8009d5:	83 c0 01             	add    $0x1,%eax
+  8009d8:	eb f0                	jmp    8009ca <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8009da:	5d                   	pop    %ebp
+  8009db:	c3                   	ret
+
+008009dc <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8009dc:	55                   	push   %ebp
+  8009dd:	89 e5                	mov    %esp,%ebp
+  8009df:	57                   	push   %edi
+  8009e0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8009e3:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8009e6:	85 c9                	test   %ecx,%ecx
+  8009e8:	74 20                	je     800a0a <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8009ea:	89 f8                	mov    %edi,%eax
+  8009ec:	09 c8                	or     %ecx,%eax
+  8009ee:	a8 03                	test   $0x3,%al
+  8009f0:	75 12                	jne    800a04 <memset+0x28>
+		c &= 0xFF;
+  8009f2:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8009f6:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8009fc:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8009ff:	fc                   	cld
+  800a00:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a02:	eb 06                	jmp    800a0a <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a04:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a07:	fc                   	cld
+  800a08:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a0a:	89 f8                	mov    %edi,%eax
+  800a0c:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a0f:	c9                   	leave
+  800a10:	c3                   	ret
+
+00800a11 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a11:	55                   	push   %ebp
+  800a12:	89 e5                	mov    %esp,%ebp
+  800a14:	57                   	push   %edi
+  800a15:	56                   	push   %esi
+  800a16:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a19:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a1c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a1f:	39 c6                	cmp    %eax,%esi
+  800a21:	73 32                	jae    800a55 <memmove+0x44>
+  800a23:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a26:	39 d0                	cmp    %edx,%eax
+  800a28:	73 2b                	jae    800a55 <memmove+0x44>
+		s += n;
+		d += n;
+  800a2a:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a2d:	89 d6                	mov    %edx,%esi
+  800a2f:	09 fe                	or     %edi,%esi
+  800a31:	09 ce                	or     %ecx,%esi
+  800a33:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a39:	75 0e                	jne    800a49 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a3b:	83 ef 04             	sub    $0x4,%edi
+  800a3e:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a41:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a44:	fd                   	std
+  800a45:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a47:	eb 09                	jmp    800a52 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a49:	83 ef 01             	sub    $0x1,%edi
+  800a4c:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800a4f:	fd                   	std
+  800a50:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a52:	fc                   	cld
+  800a53:	eb 1a                	jmp    800a6f <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a55:	89 f2                	mov    %esi,%edx
+  800a57:	09 c2                	or     %eax,%edx
+  800a59:	09 ca                	or     %ecx,%edx
+  800a5b:	f6 c2 03             	test   $0x3,%dl
+  800a5e:	75 0a                	jne    800a6a <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a60:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a63:	89 c7                	mov    %eax,%edi
+  800a65:	fc                   	cld
+  800a66:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a68:	eb 05                	jmp    800a6f <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a6a:	89 c7                	mov    %eax,%edi
+  800a6c:	fc                   	cld
+  800a6d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a6f:	5e                   	pop    %esi
+  800a70:	5f                   	pop    %edi
+  800a71:	5d                   	pop    %ebp
+  800a72:	c3                   	ret
+
+00800a73 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a73:	55                   	push   %ebp
+  800a74:	89 e5                	mov    %esp,%ebp
+  800a76:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a79:	ff 75 10             	push   0x10(%ebp)
+  800a7c:	ff 75 0c             	push   0xc(%ebp)
+  800a7f:	ff 75 08             	push   0x8(%ebp)
+  800a82:	e8 8a ff ff ff       	call   800a11 <memmove>
+}
+  800a87:	c9                   	leave
+  800a88:	c3                   	ret
+
+00800a89 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a89:	55                   	push   %ebp
+  800a8a:	89 e5                	mov    %esp,%ebp
+  800a8c:	56                   	push   %esi
+  800a8d:	53                   	push   %ebx
+  800a8e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a91:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a94:	89 c6                	mov    %eax,%esi
+  800a96:	03 75 10             	add    0x10(%ebp),%esi
+  800a99:	eb 06                	jmp    800aa1 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a9b:	83 c0 01             	add    $0x1,%eax
+  800a9e:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800aa1:	39 f0                	cmp    %esi,%eax
+  800aa3:	74 14                	je     800ab9 <memcmp+0x30>
+		if (*s1 != *s2)
+  800aa5:	0f b6 08             	movzbl (%eax),%ecx
+  800aa8:	0f b6 1a             	movzbl (%edx),%ebx
+  800aab:	38 d9                	cmp    %bl,%cl
+  800aad:	74 ec                	je     800a9b <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800aaf:	0f b6 c1             	movzbl %cl,%eax
+  800ab2:	0f b6 db             	movzbl %bl,%ebx
+  800ab5:	29 d8                	sub    %ebx,%eax
+  800ab7:	eb 05                	jmp    800abe <memcmp+0x35>
+	}
+
+	return 0;
+  800ab9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800abe:	5b                   	pop    %ebx
+  800abf:	5e                   	pop    %esi
+  800ac0:	5d                   	pop    %ebp
+  800ac1:	c3                   	ret
+
+00800ac2 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800ac2:	55                   	push   %ebp
+  800ac3:	89 e5                	mov    %esp,%ebp
+  800ac5:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ac8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800acb:	89 c2                	mov    %eax,%edx
+  800acd:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800ad0:	eb 03                	jmp    800ad5 <memfind+0x13>
+  800ad2:	83 c0 01             	add    $0x1,%eax
+  800ad5:	39 d0                	cmp    %edx,%eax
+  800ad7:	73 04                	jae    800add <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800ad9:	38 08                	cmp    %cl,(%eax)
+  800adb:	75 f5                	jne    800ad2 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800add:	5d                   	pop    %ebp
+  800ade:	c3                   	ret
+
+00800adf <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800adf:	55                   	push   %ebp
+  800ae0:	89 e5                	mov    %esp,%ebp
+  800ae2:	57                   	push   %edi
+  800ae3:	56                   	push   %esi
+  800ae4:	53                   	push   %ebx
+  800ae5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ae8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800aeb:	eb 03                	jmp    800af0 <strtol+0x11>
+		s++;
+  800aed:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800af0:	0f b6 02             	movzbl (%edx),%eax
+  800af3:	3c 20                	cmp    $0x20,%al
+  800af5:	74 f6                	je     800aed <strtol+0xe>
+  800af7:	3c 09                	cmp    $0x9,%al
+  800af9:	74 f2                	je     800aed <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800afb:	3c 2b                	cmp    $0x2b,%al
+  800afd:	74 2a                	je     800b29 <strtol+0x4a>
+	int neg = 0;
+  800aff:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800b04:	3c 2d                	cmp    $0x2d,%al
+  800b06:	74 2b                	je     800b33 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b08:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b0e:	75 0f                	jne    800b1f <strtol+0x40>
+  800b10:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b13:	74 28                	je     800b3d <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b15:	85 db                	test   %ebx,%ebx
+  800b17:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b1c:	0f 44 d8             	cmove  %eax,%ebx
+  800b1f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b24:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b27:	eb 46                	jmp    800b6f <strtol+0x90>
+		s++;
+  800b29:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800b2c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b31:	eb d5                	jmp    800b08 <strtol+0x29>
+		s++, neg = 1;
+  800b33:	83 c2 01             	add    $0x1,%edx
+  800b36:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b3b:	eb cb                	jmp    800b08 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b3d:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b41:	74 0e                	je     800b51 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800b43:	85 db                	test   %ebx,%ebx
+  800b45:	75 d8                	jne    800b1f <strtol+0x40>
+		s++, base = 8;
+  800b47:	83 c2 01             	add    $0x1,%edx
+  800b4a:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b4f:	eb ce                	jmp    800b1f <strtol+0x40>
+		s += 2, base = 16;
+  800b51:	83 c2 02             	add    $0x2,%edx
+  800b54:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b59:	eb c4                	jmp    800b1f <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800b5b:	0f be c0             	movsbl %al,%eax
+  800b5e:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800b61:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b64:	7d 3a                	jge    800ba0 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800b66:	83 c2 01             	add    $0x1,%edx
+  800b69:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800b6d:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800b6f:	0f b6 02             	movzbl (%edx),%eax
+  800b72:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b75:	89 f3                	mov    %esi,%ebx
+  800b77:	80 fb 09             	cmp    $0x9,%bl
+  800b7a:	76 df                	jbe    800b5b <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800b7c:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b7f:	89 f3                	mov    %esi,%ebx
+  800b81:	80 fb 19             	cmp    $0x19,%bl
+  800b84:	77 08                	ja     800b8e <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800b86:	0f be c0             	movsbl %al,%eax
+  800b89:	83 e8 57             	sub    $0x57,%eax
+  800b8c:	eb d3                	jmp    800b61 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b8e:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b91:	89 f3                	mov    %esi,%ebx
+  800b93:	80 fb 19             	cmp    $0x19,%bl
+  800b96:	77 08                	ja     800ba0 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800b98:	0f be c0             	movsbl %al,%eax
+  800b9b:	83 e8 37             	sub    $0x37,%eax
+  800b9e:	eb c1                	jmp    800b61 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800ba0:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800ba4:	74 05                	je     800bab <strtol+0xcc>
+		*endptr = (char *) s;
+  800ba6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ba9:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800bab:	89 c8                	mov    %ecx,%eax
+  800bad:	f7 d8                	neg    %eax
+  800baf:	85 ff                	test   %edi,%edi
+  800bb1:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800bb4:	89 c8                	mov    %ecx,%eax
+  800bb6:	5b                   	pop    %ebx
+  800bb7:	5e                   	pop    %esi
+  800bb8:	5f                   	pop    %edi
+  800bb9:	5d                   	pop    %ebp
+  800bba:	c3                   	ret
+
+00800bbb <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800bbb:	55                   	push   %ebp
+  800bbc:	89 e5                	mov    %esp,%ebp
+  800bbe:	57                   	push   %edi
+  800bbf:	56                   	push   %esi
+  800bc0:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800bc1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bc6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bc9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bcc:	89 c3                	mov    %eax,%ebx
+  800bce:	89 c7                	mov    %eax,%edi
+  800bd0:	89 c6                	mov    %eax,%esi
+  800bd2:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  800bd4:	5b                   	pop    %ebx
+  800bd5:	5e                   	pop    %esi
+  800bd6:	5f                   	pop    %edi
+  800bd7:	5d                   	pop    %ebp
+  800bd8:	c3                   	ret
+
+00800bd9 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800bd9:	55                   	push   %ebp
+  800bda:	89 e5                	mov    %esp,%ebp
+  800bdc:	57                   	push   %edi
+  800bdd:	56                   	push   %esi
+  800bde:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800bdf:	ba 00 00 00 00       	mov    $0x0,%edx
+  800be4:	b8 01 00 00 00       	mov    $0x1,%eax
+  800be9:	89 d1                	mov    %edx,%ecx
+  800beb:	89 d3                	mov    %edx,%ebx
+  800bed:	89 d7                	mov    %edx,%edi
+  800bef:	89 d6                	mov    %edx,%esi
+  800bf1:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800bf3:	5b                   	pop    %ebx
+  800bf4:	5e                   	pop    %esi
+  800bf5:	5f                   	pop    %edi
+  800bf6:	5d                   	pop    %ebp
+  800bf7:	c3                   	ret
+
+00800bf8 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800bf8:	55                   	push   %ebp
+  800bf9:	89 e5                	mov    %esp,%ebp
+  800bfb:	57                   	push   %edi
+  800bfc:	56                   	push   %esi
+  800bfd:	53                   	push   %ebx
+  800bfe:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c01:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c06:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c09:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c0e:	89 cb                	mov    %ecx,%ebx
+  800c10:	89 cf                	mov    %ecx,%edi
+  800c12:	89 ce                	mov    %ecx,%esi
+  800c14:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c16:	85 c0                	test   %eax,%eax
+  800c18:	7f 08                	jg     800c22 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c1a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c1d:	5b                   	pop    %ebx
+  800c1e:	5e                   	pop    %esi
+  800c1f:	5f                   	pop    %edi
+  800c20:	5d                   	pop    %ebp
+  800c21:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c22:	83 ec 0c             	sub    $0xc,%esp
+  800c25:	50                   	push   %eax
+  800c26:	6a 03                	push   $0x3
+  800c28:	68 03 34 80 00       	push   $0x803403
+  800c2d:	6a 3e                	push   $0x3e
+  800c2f:	68 20 34 80 00       	push   $0x803420
+  800c34:	e8 be f5 ff ff       	call   8001f7 <_panic>
+
+00800c39 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800c39:	55                   	push   %ebp
+  800c3a:	89 e5                	mov    %esp,%ebp
+  800c3c:	57                   	push   %edi
+  800c3d:	56                   	push   %esi
+  800c3e:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800c3f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c44:	b8 02 00 00 00       	mov    $0x2,%eax
+  800c49:	89 d1                	mov    %edx,%ecx
+  800c4b:	89 d3                	mov    %edx,%ebx
+  800c4d:	89 d7                	mov    %edx,%edi
+  800c4f:	89 d6                	mov    %edx,%esi
+  800c51:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800c53:	5b                   	pop    %ebx
+  800c54:	5e                   	pop    %esi
+  800c55:	5f                   	pop    %edi
+  800c56:	5d                   	pop    %ebp
+  800c57:	c3                   	ret
+
+00800c58 <sys_yield>:
+
+void
+sys_yield(void) {
+  800c58:	55                   	push   %ebp
+  800c59:	89 e5                	mov    %esp,%ebp
+  800c5b:	57                   	push   %edi
+  800c5c:	56                   	push   %esi
+  800c5d:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800c5e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c63:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800c68:	89 d1                	mov    %edx,%ecx
+  800c6a:	89 d3                	mov    %edx,%ebx
+  800c6c:	89 d7                	mov    %edx,%edi
+  800c6e:	89 d6                	mov    %edx,%esi
+  800c70:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800c72:	5b                   	pop    %ebx
+  800c73:	5e                   	pop    %esi
+  800c74:	5f                   	pop    %edi
+  800c75:	5d                   	pop    %ebp
+  800c76:	c3                   	ret
+
+00800c77 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  800c77:	55                   	push   %ebp
+  800c78:	89 e5                	mov    %esp,%ebp
+  800c7a:	57                   	push   %edi
+  800c7b:	56                   	push   %esi
+  800c7c:	53                   	push   %ebx
+  800c7d:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c80:	be 00 00 00 00       	mov    $0x0,%esi
+  800c85:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c88:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c8b:	b8 04 00 00 00       	mov    $0x4,%eax
+  800c90:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c93:	89 f7                	mov    %esi,%edi
+  800c95:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c97:	85 c0                	test   %eax,%eax
+  800c99:	7f 08                	jg     800ca3 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800c9b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c9e:	5b                   	pop    %ebx
+  800c9f:	5e                   	pop    %esi
+  800ca0:	5f                   	pop    %edi
+  800ca1:	5d                   	pop    %ebp
+  800ca2:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ca3:	83 ec 0c             	sub    $0xc,%esp
+  800ca6:	50                   	push   %eax
+  800ca7:	6a 04                	push   $0x4
+  800ca9:	68 03 34 80 00       	push   $0x803403
+  800cae:	6a 3e                	push   $0x3e
+  800cb0:	68 20 34 80 00       	push   $0x803420
+  800cb5:	e8 3d f5 ff ff       	call   8001f7 <_panic>
+
+00800cba <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  800cba:	55                   	push   %ebp
+  800cbb:	89 e5                	mov    %esp,%ebp
+  800cbd:	57                   	push   %edi
+  800cbe:	56                   	push   %esi
+  800cbf:	53                   	push   %ebx
+  800cc0:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800cc3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cc6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cc9:	b8 05 00 00 00       	mov    $0x5,%eax
+  800cce:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cd1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800cd4:	8b 75 18             	mov    0x18(%ebp),%esi
+  800cd7:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800cd9:	85 c0                	test   %eax,%eax
+  800cdb:	7f 08                	jg     800ce5 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800cdd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ce0:	5b                   	pop    %ebx
+  800ce1:	5e                   	pop    %esi
+  800ce2:	5f                   	pop    %edi
+  800ce3:	5d                   	pop    %ebp
+  800ce4:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ce5:	83 ec 0c             	sub    $0xc,%esp
+  800ce8:	50                   	push   %eax
+  800ce9:	6a 05                	push   $0x5
+  800ceb:	68 03 34 80 00       	push   $0x803403
+  800cf0:	6a 3e                	push   $0x3e
+  800cf2:	68 20 34 80 00       	push   $0x803420
+  800cf7:	e8 fb f4 ff ff       	call   8001f7 <_panic>
+
+00800cfc <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  800cfc:	55                   	push   %ebp
+  800cfd:	89 e5                	mov    %esp,%ebp
+  800cff:	57                   	push   %edi
+  800d00:	56                   	push   %esi
+  800d01:	53                   	push   %ebx
+  800d02:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800d05:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d0a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d0d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d10:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d15:	89 df                	mov    %ebx,%edi
+  800d17:	89 de                	mov    %ebx,%esi
+  800d19:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d1b:	85 c0                	test   %eax,%eax
+  800d1d:	7f 08                	jg     800d27 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800d1f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d22:	5b                   	pop    %ebx
+  800d23:	5e                   	pop    %esi
+  800d24:	5f                   	pop    %edi
+  800d25:	5d                   	pop    %ebp
+  800d26:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d27:	83 ec 0c             	sub    $0xc,%esp
+  800d2a:	50                   	push   %eax
+  800d2b:	6a 06                	push   $0x6
+  800d2d:	68 03 34 80 00       	push   $0x803403
+  800d32:	6a 3e                	push   $0x3e
+  800d34:	68 20 34 80 00       	push   $0x803420
+  800d39:	e8 b9 f4 ff ff       	call   8001f7 <_panic>
+
+00800d3e <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800d3e:	55                   	push   %ebp
+  800d3f:	89 e5                	mov    %esp,%ebp
+  800d41:	57                   	push   %edi
+  800d42:	56                   	push   %esi
+  800d43:	53                   	push   %ebx
+  800d44:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800d47:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d4c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d4f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d52:	b8 08 00 00 00       	mov    $0x8,%eax
+  800d57:	89 df                	mov    %ebx,%edi
+  800d59:	89 de                	mov    %ebx,%esi
+  800d5b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d5d:	85 c0                	test   %eax,%eax
+  800d5f:	7f 08                	jg     800d69 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800d61:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d64:	5b                   	pop    %ebx
+  800d65:	5e                   	pop    %esi
+  800d66:	5f                   	pop    %edi
+  800d67:	5d                   	pop    %ebp
+  800d68:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d69:	83 ec 0c             	sub    $0xc,%esp
+  800d6c:	50                   	push   %eax
+  800d6d:	6a 08                	push   $0x8
+  800d6f:	68 03 34 80 00       	push   $0x803403
+  800d74:	6a 3e                	push   $0x3e
+  800d76:	68 20 34 80 00       	push   $0x803420
+  800d7b:	e8 77 f4 ff ff       	call   8001f7 <_panic>
+
+00800d80 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800d80:	55                   	push   %ebp
+  800d81:	89 e5                	mov    %esp,%ebp
+  800d83:	57                   	push   %edi
+  800d84:	56                   	push   %esi
+  800d85:	53                   	push   %ebx
+  800d86:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800d89:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d8e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d91:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d94:	b8 09 00 00 00       	mov    $0x9,%eax
+  800d99:	89 df                	mov    %ebx,%edi
+  800d9b:	89 de                	mov    %ebx,%esi
+  800d9d:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d9f:	85 c0                	test   %eax,%eax
+  800da1:	7f 08                	jg     800dab <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800da3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800da6:	5b                   	pop    %ebx
+  800da7:	5e                   	pop    %esi
+  800da8:	5f                   	pop    %edi
+  800da9:	5d                   	pop    %ebp
+  800daa:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800dab:	83 ec 0c             	sub    $0xc,%esp
+  800dae:	50                   	push   %eax
+  800daf:	6a 09                	push   $0x9
+  800db1:	68 03 34 80 00       	push   $0x803403
+  800db6:	6a 3e                	push   $0x3e
+  800db8:	68 20 34 80 00       	push   $0x803420
+  800dbd:	e8 35 f4 ff ff       	call   8001f7 <_panic>
+
+00800dc2 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800dc2:	55                   	push   %ebp
+  800dc3:	89 e5                	mov    %esp,%ebp
+  800dc5:	57                   	push   %edi
+  800dc6:	56                   	push   %esi
+  800dc7:	53                   	push   %ebx
+  800dc8:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800dcb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dd0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dd6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ddb:	89 df                	mov    %ebx,%edi
+  800ddd:	89 de                	mov    %ebx,%esi
+  800ddf:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800de1:	85 c0                	test   %eax,%eax
+  800de3:	7f 08                	jg     800ded <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800de5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800de8:	5b                   	pop    %ebx
+  800de9:	5e                   	pop    %esi
+  800dea:	5f                   	pop    %edi
+  800deb:	5d                   	pop    %ebp
+  800dec:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ded:	83 ec 0c             	sub    $0xc,%esp
+  800df0:	50                   	push   %eax
+  800df1:	6a 0a                	push   $0xa
+  800df3:	68 03 34 80 00       	push   $0x803403
+  800df8:	6a 3e                	push   $0x3e
+  800dfa:	68 20 34 80 00       	push   $0x803420
+  800dff:	e8 f3 f3 ff ff       	call   8001f7 <_panic>
+
+00800e04 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  800e04:	55                   	push   %ebp
+  800e05:	89 e5                	mov    %esp,%ebp
+  800e07:	57                   	push   %edi
+  800e08:	56                   	push   %esi
+  800e09:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e0a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e0d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e10:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800e15:	be 00 00 00 00       	mov    $0x0,%esi
+  800e1a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e1d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e20:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800e22:	5b                   	pop    %ebx
+  800e23:	5e                   	pop    %esi
+  800e24:	5f                   	pop    %edi
+  800e25:	5d                   	pop    %ebp
+  800e26:	c3                   	ret
+
+00800e27 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  800e27:	55                   	push   %ebp
+  800e28:	89 e5                	mov    %esp,%ebp
+  800e2a:	57                   	push   %edi
+  800e2b:	56                   	push   %esi
+  800e2c:	53                   	push   %ebx
+  800e2d:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800e30:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e35:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e38:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e3d:	89 cb                	mov    %ecx,%ebx
+  800e3f:	89 cf                	mov    %ecx,%edi
+  800e41:	89 ce                	mov    %ecx,%esi
+  800e43:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e45:	85 c0                	test   %eax,%eax
+  800e47:	7f 08                	jg     800e51 <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  800e49:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e4c:	5b                   	pop    %ebx
+  800e4d:	5e                   	pop    %esi
+  800e4e:	5f                   	pop    %edi
+  800e4f:	5d                   	pop    %ebp
+  800e50:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e51:	83 ec 0c             	sub    $0xc,%esp
+  800e54:	50                   	push   %eax
+  800e55:	6a 0d                	push   $0xd
+  800e57:	68 03 34 80 00       	push   $0x803403
+  800e5c:	6a 3e                	push   $0x3e
+  800e5e:	68 20 34 80 00       	push   $0x803420
+  800e63:	e8 8f f3 ff ff       	call   8001f7 <_panic>
+
+00800e68 <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  800e68:	55                   	push   %ebp
+  800e69:	89 e5                	mov    %esp,%ebp
+  800e6b:	57                   	push   %edi
+  800e6c:	56                   	push   %esi
+  800e6d:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e6e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e73:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e76:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e79:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800e7e:	89 df                	mov    %ebx,%edi
+  800e80:	89 de                	mov    %ebx,%esi
+  800e82:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  800e84:	5b                   	pop    %ebx
+  800e85:	5e                   	pop    %esi
+  800e86:	5f                   	pop    %edi
+  800e87:	5d                   	pop    %ebp
+  800e88:	c3                   	ret
+
+00800e89 <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  800e89:	55                   	push   %ebp
+  800e8a:	89 e5                	mov    %esp,%ebp
+  800e8c:	57                   	push   %edi
+  800e8d:	56                   	push   %esi
+  800e8e:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e8f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e94:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e97:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800e9c:	89 cb                	mov    %ecx,%ebx
+  800e9e:	89 cf                	mov    %ecx,%edi
+  800ea0:	89 ce                	mov    %ecx,%esi
+  800ea2:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  800ea4:	5b                   	pop    %ebx
+  800ea5:	5e                   	pop    %esi
+  800ea6:	5f                   	pop    %edi
+  800ea7:	5d                   	pop    %ebp
+  800ea8:	c3                   	ret
+
+00800ea9 <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  800ea9:	55                   	push   %ebp
+  800eaa:	89 e5                	mov    %esp,%ebp
+  800eac:	57                   	push   %edi
+  800ead:	56                   	push   %esi
+  800eae:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800eaf:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eb4:	b8 10 00 00 00       	mov    $0x10,%eax
+  800eb9:	89 d1                	mov    %edx,%ecx
+  800ebb:	89 d3                	mov    %edx,%ebx
+  800ebd:	89 d7                	mov    %edx,%edi
+  800ebf:	89 d6                	mov    %edx,%esi
+  800ec1:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800ec3:	5b                   	pop    %ebx
+  800ec4:	5e                   	pop    %esi
+  800ec5:	5f                   	pop    %edi
+  800ec6:	5d                   	pop    %ebp
+  800ec7:	c3                   	ret
+
+00800ec8 <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  800ec8:	55                   	push   %ebp
+  800ec9:	89 e5                	mov    %esp,%ebp
+  800ecb:	57                   	push   %edi
+  800ecc:	56                   	push   %esi
+  800ecd:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800ece:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ed3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ed9:	b8 11 00 00 00       	mov    $0x11,%eax
+  800ede:	89 df                	mov    %ebx,%edi
+  800ee0:	89 de                	mov    %ebx,%esi
+  800ee2:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800ee4:	5b                   	pop    %ebx
+  800ee5:	5e                   	pop    %esi
+  800ee6:	5f                   	pop    %edi
+  800ee7:	5d                   	pop    %ebp
+  800ee8:	c3                   	ret
+
+00800ee9 <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  800ee9:	55                   	push   %ebp
+  800eea:	89 e5                	mov    %esp,%ebp
+  800eec:	57                   	push   %edi
+  800eed:	56                   	push   %esi
+  800eee:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800eef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ef4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800efa:	b8 12 00 00 00       	mov    $0x12,%eax
+  800eff:	89 df                	mov    %ebx,%edi
+  800f01:	89 de                	mov    %ebx,%esi
+  800f03:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800f05:	5b                   	pop    %ebx
+  800f06:	5e                   	pop    %esi
+  800f07:	5f                   	pop    %edi
+  800f08:	5d                   	pop    %ebp
+  800f09:	c3                   	ret
+
+00800f0a <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  800f0a:	55                   	push   %ebp
+  800f0b:	89 e5                	mov    %esp,%ebp
+  800f0d:	57                   	push   %edi
+  800f0e:	56                   	push   %esi
+  800f0f:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800f10:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f15:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f18:	b8 13 00 00 00       	mov    $0x13,%eax
+  800f1d:	89 cb                	mov    %ecx,%ebx
+  800f1f:	89 cf                	mov    %ecx,%edi
+  800f21:	89 ce                	mov    %ecx,%esi
+  800f23:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  800f25:	5b                   	pop    %ebx
+  800f26:	5e                   	pop    %esi
+  800f27:	5f                   	pop    %edi
+  800f28:	5d                   	pop    %ebp
+  800f29:	c3                   	ret
+
+00800f2a <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  800f2a:	55                   	push   %ebp
+  800f2b:	89 e5                	mov    %esp,%ebp
+  800f2d:	57                   	push   %edi
+  800f2e:	56                   	push   %esi
+  800f2f:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800f30:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f35:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f38:	b8 14 00 00 00       	mov    $0x14,%eax
+  800f3d:	89 cb                	mov    %ecx,%ebx
+  800f3f:	89 cf                	mov    %ecx,%edi
+  800f41:	89 ce                	mov    %ecx,%esi
+  800f43:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  800f45:	5b                   	pop    %ebx
+  800f46:	5e                   	pop    %esi
+  800f47:	5f                   	pop    %edi
+  800f48:	5d                   	pop    %ebp
+  800f49:	c3                   	ret
+
+00800f4a <pgfault>:
+//
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf) {
+  800f4a:	55                   	push   %ebp
+  800f4b:	89 e5                	mov    %esp,%ebp
+  800f4d:	53                   	push   %ebx
+  800f4e:	83 ec 04             	sub    $0x4,%esp
+  800f51:	8b 45 08             	mov    0x8(%ebp),%eax
+    void *addr = (void *) utf->utf_fault_va;
+  800f54:	8b 18                	mov    (%eax),%ebx
+    // Hint:
+    //   Use the read-only page table mappings at uvpt
+    //   (see <inc/memlayout.h>).
+
+    // LAB 4: Your code here.
+    if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P) ||
+  800f56:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  800f5a:	0f 84 95 00 00 00    	je     800ff5 <pgfault+0xab>
+  800f60:	89 d8                	mov    %ebx,%eax
+  800f62:	c1 e8 16             	shr    $0x16,%eax
+  800f65:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  800f6c:	a8 01                	test   $0x1,%al
+  800f6e:	0f 84 81 00 00 00    	je     800ff5 <pgfault+0xab>
+        (uvpt[PGNUM(addr)] & (PTE_P | PTE_COW)) != (PTE_P | PTE_COW)) {
+  800f74:	89 d8                	mov    %ebx,%eax
+  800f76:	c1 e8 0c             	shr    $0xc,%eax
+  800f79:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800f80:	25 01 08 00 00       	and    $0x801,%eax
+    if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P) ||
+  800f85:	3d 01 08 00 00       	cmp    $0x801,%eax
+  800f8a:	75 69                	jne    800ff5 <pgfault+0xab>
+    // Hint:
+    //   You should make three system calls.
+
+    // LAB 4: Your code here.
+
+    if (sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W))
+  800f8c:	83 ec 04             	sub    $0x4,%esp
+  800f8f:	6a 07                	push   $0x7
+  800f91:	68 00 f0 7f 00       	push   $0x7ff000
+  800f96:	6a 00                	push   $0x0
+  800f98:	e8 da fc ff ff       	call   800c77 <sys_page_alloc>
+  800f9d:	83 c4 10             	add    $0x10,%esp
+  800fa0:	85 c0                	test   %eax,%eax
+  800fa2:	75 65                	jne    801009 <pgfault+0xbf>
+        panic("sys_page_alloc failed");
+
+    addr = ROUNDDOWN(addr, PGSIZE);
+  800fa4:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+    memmove(PFTEMP, addr, PGSIZE);
+  800faa:	83 ec 04             	sub    $0x4,%esp
+  800fad:	68 00 10 00 00       	push   $0x1000
+  800fb2:	53                   	push   %ebx
+  800fb3:	68 00 f0 7f 00       	push   $0x7ff000
+  800fb8:	e8 54 fa ff ff       	call   800a11 <memmove>
+
+    if (sys_page_map(0, PFTEMP, 0, addr, PTE_P | PTE_U | PTE_W))
+  800fbd:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  800fc4:	53                   	push   %ebx
+  800fc5:	6a 00                	push   $0x0
+  800fc7:	68 00 f0 7f 00       	push   $0x7ff000
+  800fcc:	6a 00                	push   $0x0
+  800fce:	e8 e7 fc ff ff       	call   800cba <sys_page_map>
+  800fd3:	83 c4 20             	add    $0x20,%esp
+  800fd6:	85 c0                	test   %eax,%eax
+  800fd8:	75 43                	jne    80101d <pgfault+0xd3>
+        panic("sys_page_map failed");
+    if (sys_page_unmap(0, PFTEMP))
+  800fda:	83 ec 08             	sub    $0x8,%esp
+  800fdd:	68 00 f0 7f 00       	push   $0x7ff000
+  800fe2:	6a 00                	push   $0x0
+  800fe4:	e8 13 fd ff ff       	call   800cfc <sys_page_unmap>
+  800fe9:	83 c4 10             	add    $0x10,%esp
+  800fec:	85 c0                	test   %eax,%eax
+  800fee:	75 41                	jne    801031 <pgfault+0xe7>
+        panic("sys_page_unmap failed");
+
+}
+  800ff0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ff3:	c9                   	leave
+  800ff4:	c3                   	ret
+        panic("pgfault: faulting access invalid");
+  800ff5:	83 ec 04             	sub    $0x4,%esp
+  800ff8:	68 30 34 80 00       	push   $0x803430
+  800ffd:	6a 1e                	push   $0x1e
+  800fff:	68 9c 34 80 00       	push   $0x80349c
+  801004:	e8 ee f1 ff ff       	call   8001f7 <_panic>
+        panic("sys_page_alloc failed");
+  801009:	83 ec 04             	sub    $0x4,%esp
+  80100c:	68 0f 35 80 00       	push   $0x80350f
+  801011:	6a 2a                	push   $0x2a
+  801013:	68 9c 34 80 00       	push   $0x80349c
+  801018:	e8 da f1 ff ff       	call   8001f7 <_panic>
+        panic("sys_page_map failed");
+  80101d:	83 ec 04             	sub    $0x4,%esp
+  801020:	68 a7 34 80 00       	push   $0x8034a7
+  801025:	6a 30                	push   $0x30
+  801027:	68 9c 34 80 00       	push   $0x80349c
+  80102c:	e8 c6 f1 ff ff       	call   8001f7 <_panic>
+        panic("sys_page_unmap failed");
+  801031:	83 ec 04             	sub    $0x4,%esp
+  801034:	68 bb 34 80 00       	push   $0x8034bb
+  801039:	6a 32                	push   $0x32
+  80103b:	68 9c 34 80 00       	push   $0x80349c
+  801040:	e8 b2 f1 ff ff       	call   8001f7 <_panic>
+
+00801045 <fork>:
+//   Remember to fix "thisenv" in the child process.
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void) {
+  801045:	55                   	push   %ebp
+  801046:	89 e5                	mov    %esp,%ebp
+  801048:	57                   	push   %edi
+  801049:	56                   	push   %esi
+  80104a:	53                   	push   %ebx
+  80104b:	83 ec 18             	sub    $0x18,%esp
+    // LAB 4: Your code here.
+    set_pgfault_handler(pgfault);
+  80104e:	68 4a 0f 80 00       	push   $0x800f4a
+  801053:	e8 48 19 00 00       	call   8029a0 <set_pgfault_handler>
+
+// This must be inlined.  Exercise for reader: why?
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+  envid_t ret;
+  asm volatile("int %2"
+  801058:	b8 07 00 00 00       	mov    $0x7,%eax
+  80105d:	cd 30                	int    $0x30
+  80105f:	89 c6                	mov    %eax,%esi
+
+    envid_t envid = sys_exofork();
+    if (envid < 0)
+  801061:	83 c4 10             	add    $0x10,%esp
+  801064:	85 c0                	test   %eax,%eax
+  801066:	78 2a                	js     801092 <fork+0x4d>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+
+    uintptr_t addr;
+    for (addr = 0; addr < UTOP; addr += PGSIZE) {
+  801068:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (envid == 0) {
+  80106d:	0f 85 a2 00 00 00    	jne    801115 <fork+0xd0>
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801073:	e8 c1 fb ff ff       	call   800c39 <sys_getenvid>
+  801078:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80107d:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  801080:	c1 e0 04             	shl    $0x4,%eax
+  801083:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801088:	a3 08 50 80 00       	mov    %eax,0x805008
+        return 0;
+  80108d:	e9 6c 01 00 00       	jmp    8011fe <fork+0x1b9>
+        panic("fork: sys_exofork error: %e", envid);
+  801092:	50                   	push   %eax
+  801093:	68 d1 34 80 00       	push   $0x8034d1
+  801098:	6a 6f                	push   $0x6f
+  80109a:	68 9c 34 80 00       	push   $0x80349c
+  80109f:	e8 53 f1 ff ff       	call   8001f7 <_panic>
+        if ((r = sys_page_map(0, vptr, envid, vptr, uvpt[pn] & PTE_SYSCALL)) < 0)
+  8010a4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8010ab:	83 ec 0c             	sub    $0xc,%esp
+  8010ae:	25 07 0e 00 00       	and    $0xe07,%eax
+  8010b3:	50                   	push   %eax
+  8010b4:	57                   	push   %edi
+  8010b5:	56                   	push   %esi
+  8010b6:	57                   	push   %edi
+  8010b7:	6a 00                	push   $0x0
+  8010b9:	e8 fc fb ff ff       	call   800cba <sys_page_map>
+  8010be:	83 c4 20             	add    $0x20,%esp
+  8010c1:	85 c0                	test   %eax,%eax
+  8010c3:	79 3e                	jns    801103 <fork+0xbe>
+            panic("duppage :in sys_page_map %e", r);
+  8010c5:	50                   	push   %eax
+  8010c6:	68 ed 34 80 00       	push   $0x8034ed
+  8010cb:	6a 49                	push   $0x49
+  8010cd:	68 9c 34 80 00       	push   $0x80349c
+  8010d2:	e8 20 f1 ff ff       	call   8001f7 <_panic>
+            panic("duppage :in sys_page_map %e", r);
+  8010d7:	50                   	push   %eax
+  8010d8:	68 ed 34 80 00       	push   $0x8034ed
+  8010dd:	6a 4e                	push   $0x4e
+  8010df:	68 9c 34 80 00       	push   $0x80349c
+  8010e4:	e8 0e f1 ff ff       	call   8001f7 <_panic>
+    } else if ((r = sys_page_map(0, vptr, envid, vptr, PTE_P | PTE_U)) < 0)
+  8010e9:	83 ec 0c             	sub    $0xc,%esp
+  8010ec:	6a 05                	push   $0x5
+  8010ee:	57                   	push   %edi
+  8010ef:	56                   	push   %esi
+  8010f0:	57                   	push   %edi
+  8010f1:	6a 00                	push   $0x0
+  8010f3:	e8 c2 fb ff ff       	call   800cba <sys_page_map>
+  8010f8:	83 c4 20             	add    $0x20,%esp
+  8010fb:	85 c0                	test   %eax,%eax
+  8010fd:	0f 88 ab 00 00 00    	js     8011ae <fork+0x169>
+    for (addr = 0; addr < UTOP; addr += PGSIZE) {
+  801103:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801109:	81 fb 00 00 c0 ee    	cmp    $0xeec00000,%ebx
+  80110f:	0f 84 ab 00 00 00    	je     8011c0 <fork+0x17b>
+        if (uvpd[PDX(addr)] & PTE_P && uvpt[PGNUM(addr)] & PTE_P && addr != UXSTACKTOP - PGSIZE) {
+  801115:	89 d8                	mov    %ebx,%eax
+  801117:	c1 e8 16             	shr    $0x16,%eax
+  80111a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801121:	a8 01                	test   $0x1,%al
+  801123:	74 de                	je     801103 <fork+0xbe>
+  801125:	89 d8                	mov    %ebx,%eax
+  801127:	c1 e8 0c             	shr    $0xc,%eax
+  80112a:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801131:	f6 c2 01             	test   $0x1,%dl
+  801134:	74 cd                	je     801103 <fork+0xbe>
+  801136:	81 fb 00 f0 bf ee    	cmp    $0xeebff000,%ebx
+  80113c:	74 c5                	je     801103 <fork+0xbe>
+    void *vptr = (void *) (pn * PGSIZE);
+  80113e:	89 c7                	mov    %eax,%edi
+  801140:	c1 e7 0c             	shl    $0xc,%edi
+    if (uvpt[pn] & PTE_SHARE) {
+  801143:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80114a:	f6 c6 04             	test   $0x4,%dh
+  80114d:	0f 85 51 ff ff ff    	jne    8010a4 <fork+0x5f>
+    } else if (uvpt[pn] & (PTE_W | PTE_COW)) {
+  801153:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80115a:	a9 02 08 00 00       	test   $0x802,%eax
+  80115f:	74 88                	je     8010e9 <fork+0xa4>
+        if ((r = sys_page_map(0, vptr, envid, vptr, PTE_P | PTE_U | PTE_COW)) < 0)
+  801161:	83 ec 0c             	sub    $0xc,%esp
+  801164:	68 05 08 00 00       	push   $0x805
+  801169:	57                   	push   %edi
+  80116a:	56                   	push   %esi
+  80116b:	57                   	push   %edi
+  80116c:	6a 00                	push   $0x0
+  80116e:	e8 47 fb ff ff       	call   800cba <sys_page_map>
+  801173:	83 c4 20             	add    $0x20,%esp
+  801176:	85 c0                	test   %eax,%eax
+  801178:	0f 88 59 ff ff ff    	js     8010d7 <fork+0x92>
+        if ((r = sys_page_map(0, vptr, 0, vptr, PTE_P | PTE_U | PTE_COW)) < 0)
+  80117e:	83 ec 0c             	sub    $0xc,%esp
+  801181:	68 05 08 00 00       	push   $0x805
+  801186:	57                   	push   %edi
+  801187:	6a 00                	push   $0x0
+  801189:	57                   	push   %edi
+  80118a:	6a 00                	push   $0x0
+  80118c:	e8 29 fb ff ff       	call   800cba <sys_page_map>
+  801191:	83 c4 20             	add    $0x20,%esp
+  801194:	85 c0                	test   %eax,%eax
+  801196:	0f 89 67 ff ff ff    	jns    801103 <fork+0xbe>
+            panic("duppage :in sys_page_map %e", r);
+  80119c:	50                   	push   %eax
+  80119d:	68 ed 34 80 00       	push   $0x8034ed
+  8011a2:	6a 50                	push   $0x50
+  8011a4:	68 9c 34 80 00       	push   $0x80349c
+  8011a9:	e8 49 f0 ff ff       	call   8001f7 <_panic>
+        panic("duppage :in sys_page_map %e", r);
+  8011ae:	50                   	push   %eax
+  8011af:	68 ed 34 80 00       	push   $0x8034ed
+  8011b4:	6a 53                	push   $0x53
+  8011b6:	68 9c 34 80 00       	push   $0x80349c
+  8011bb:	e8 37 f0 ff ff       	call   8001f7 <_panic>
+            duppage(envid, PGNUM(addr));
+        }
+    }
+    if (sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W))
+  8011c0:	83 ec 04             	sub    $0x4,%esp
+  8011c3:	6a 07                	push   $0x7
+  8011c5:	68 00 f0 bf ee       	push   $0xeebff000
+  8011ca:	56                   	push   %esi
+  8011cb:	e8 a7 fa ff ff       	call   800c77 <sys_page_alloc>
+  8011d0:	83 c4 10             	add    $0x10,%esp
+  8011d3:	85 c0                	test   %eax,%eax
+  8011d5:	75 31                	jne    801208 <fork+0x1c3>
+        panic("fork: sys_page_alloc failed");
+    if (sys_env_set_pgfault_upcall(envid, _pgfault_upcall))
+  8011d7:	83 ec 08             	sub    $0x8,%esp
+  8011da:	68 0b 2a 80 00       	push   $0x802a0b
+  8011df:	56                   	push   %esi
+  8011e0:	e8 dd fb ff ff       	call   800dc2 <sys_env_set_pgfault_upcall>
+  8011e5:	83 c4 10             	add    $0x10,%esp
+  8011e8:	85 c0                	test   %eax,%eax
+  8011ea:	75 30                	jne    80121c <fork+0x1d7>
+        panic("fork: sys_env_set_pgfault_upcall failed");
+    if (sys_env_set_status(envid, ENV_RUNNABLE))
+  8011ec:	83 ec 08             	sub    $0x8,%esp
+  8011ef:	6a 02                	push   $0x2
+  8011f1:	56                   	push   %esi
+  8011f2:	e8 47 fb ff ff       	call   800d3e <sys_env_set_status>
+  8011f7:	83 c4 10             	add    $0x10,%esp
+  8011fa:	85 c0                	test   %eax,%eax
+  8011fc:	75 32                	jne    801230 <fork+0x1eb>
+        panic("fork: sys_env_set_status failed");
+
+    return envid;
+
+}
+  8011fe:	89 f0                	mov    %esi,%eax
+  801200:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801203:	5b                   	pop    %ebx
+  801204:	5e                   	pop    %esi
+  801205:	5f                   	pop    %edi
+  801206:	5d                   	pop    %ebp
+  801207:	c3                   	ret
+        panic("fork: sys_page_alloc failed");
+  801208:	83 ec 04             	sub    $0x4,%esp
+  80120b:	68 09 35 80 00       	push   $0x803509
+  801210:	6a 7d                	push   $0x7d
+  801212:	68 9c 34 80 00       	push   $0x80349c
+  801217:	e8 db ef ff ff       	call   8001f7 <_panic>
+        panic("fork: sys_env_set_pgfault_upcall failed");
+  80121c:	83 ec 04             	sub    $0x4,%esp
+  80121f:	68 54 34 80 00       	push   $0x803454
+  801224:	6a 7f                	push   $0x7f
+  801226:	68 9c 34 80 00       	push   $0x80349c
+  80122b:	e8 c7 ef ff ff       	call   8001f7 <_panic>
+        panic("fork: sys_env_set_status failed");
+  801230:	83 ec 04             	sub    $0x4,%esp
+  801233:	68 7c 34 80 00       	push   $0x80347c
+  801238:	68 81 00 00 00       	push   $0x81
+  80123d:	68 9c 34 80 00       	push   $0x80349c
+  801242:	e8 b0 ef ff ff       	call   8001f7 <_panic>
+
+00801247 <sfork>:
+
+// Challenge!
+int
+sfork(void) {
+  801247:	55                   	push   %ebp
+  801248:	89 e5                	mov    %esp,%ebp
+  80124a:	83 ec 0c             	sub    $0xc,%esp
+    panic("sfork not implemented");
+  80124d:	68 25 35 80 00       	push   $0x803525
+  801252:	68 8a 00 00 00       	push   $0x8a
+  801257:	68 9c 34 80 00       	push   $0x80349c
+  80125c:	e8 96 ef ff ff       	call   8001f7 <_panic>
+
+00801261 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801261:	55                   	push   %ebp
+  801262:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801264:	8b 45 08             	mov    0x8(%ebp),%eax
+  801267:	05 00 00 00 30       	add    $0x30000000,%eax
+  80126c:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80126f:	5d                   	pop    %ebp
+  801270:	c3                   	ret
+
+00801271 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801271:	55                   	push   %ebp
+  801272:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801274:	8b 45 08             	mov    0x8(%ebp),%eax
+  801277:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80127c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801281:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801286:	5d                   	pop    %ebp
+  801287:	c3                   	ret
+
+00801288 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801288:	55                   	push   %ebp
+  801289:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80128b:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801290:	eb 02                	jmp    801294 <fd_alloc+0xc>
+  801292:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801294:	89 c2                	mov    %eax,%edx
+  801296:	c1 ea 16             	shr    $0x16,%edx
+  801299:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8012a0:	f6 c2 01             	test   $0x1,%dl
+  8012a3:	74 2b                	je     8012d0 <fd_alloc+0x48>
+  8012a5:	89 c2                	mov    %eax,%edx
+  8012a7:	c1 ea 0c             	shr    $0xc,%edx
+  8012aa:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8012b1:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8012b7:	f6 c1 01             	test   $0x1,%cl
+  8012ba:	74 14                	je     8012d0 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8012bc:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8012c2:	75 ce                	jne    801292 <fd_alloc+0xa>
+  8012c4:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8012c9:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8012ce:	eb 05                	jmp    8012d5 <fd_alloc+0x4d>
+			return 0;
+  8012d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8012d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012d8:	89 02                	mov    %eax,(%edx)
+}
+  8012da:	89 c8                	mov    %ecx,%eax
+  8012dc:	5d                   	pop    %ebp
+  8012dd:	c3                   	ret
+
+008012de <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8012de:	55                   	push   %ebp
+  8012df:	89 e5                	mov    %esp,%ebp
+  8012e1:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8012e4:	83 f8 1f             	cmp    $0x1f,%eax
+  8012e7:	77 30                	ja     801319 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8012e9:	c1 e0 0c             	shl    $0xc,%eax
+  8012ec:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8012f1:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8012f7:	f6 c2 01             	test   $0x1,%dl
+  8012fa:	74 24                	je     801320 <fd_lookup+0x42>
+  8012fc:	89 c2                	mov    %eax,%edx
+  8012fe:	c1 ea 0c             	shr    $0xc,%edx
+  801301:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801308:	f6 c2 01             	test   $0x1,%dl
+  80130b:	74 1a                	je     801327 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80130d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801310:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801312:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801317:	5d                   	pop    %ebp
+  801318:	c3                   	ret
+		return -E_INVAL;
+  801319:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80131e:	eb f7                	jmp    801317 <fd_lookup+0x39>
+		return -E_INVAL;
+  801320:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801325:	eb f0                	jmp    801317 <fd_lookup+0x39>
+  801327:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80132c:	eb e9                	jmp    801317 <fd_lookup+0x39>
+
+0080132e <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80132e:	55                   	push   %ebp
+  80132f:	89 e5                	mov    %esp,%ebp
+  801331:	53                   	push   %ebx
+  801332:	83 ec 04             	sub    $0x4,%esp
+  801335:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801338:	b8 00 00 00 00       	mov    $0x0,%eax
+  80133d:	eb 03                	jmp    801342 <dev_lookup+0x14>
+  80133f:	83 c0 01             	add    $0x1,%eax
+  801342:	8b 1c 85 b8 35 80 00 	mov    0x8035b8(,%eax,4),%ebx
+  801349:	85 db                	test   %ebx,%ebx
+  80134b:	74 0b                	je     801358 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  80134d:	39 13                	cmp    %edx,(%ebx)
+  80134f:	75 ee                	jne    80133f <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801351:	b8 00 00 00 00       	mov    $0x0,%eax
+  801356:	eb 1f                	jmp    801377 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801358:	a1 08 50 80 00       	mov    0x805008,%eax
+  80135d:	8b 40 48             	mov    0x48(%eax),%eax
+  801360:	83 ec 04             	sub    $0x4,%esp
+  801363:	52                   	push   %edx
+  801364:	50                   	push   %eax
+  801365:	68 3c 35 80 00       	push   $0x80353c
+  80136a:	e8 63 ef ff ff       	call   8002d2 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80136f:	83 c4 10             	add    $0x10,%esp
+  801372:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801377:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80137a:	89 1a                	mov    %ebx,(%edx)
+}
+  80137c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80137f:	c9                   	leave
+  801380:	c3                   	ret
+
+00801381 <fd_close>:
+{
+  801381:	55                   	push   %ebp
+  801382:	89 e5                	mov    %esp,%ebp
+  801384:	57                   	push   %edi
+  801385:	56                   	push   %esi
+  801386:	53                   	push   %ebx
+  801387:	83 ec 24             	sub    $0x24,%esp
+  80138a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80138d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801390:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801393:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801394:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80139a:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80139d:	50                   	push   %eax
+  80139e:	e8 3b ff ff ff       	call   8012de <fd_lookup>
+  8013a3:	89 c3                	mov    %eax,%ebx
+  8013a5:	83 c4 10             	add    $0x10,%esp
+  8013a8:	85 c0                	test   %eax,%eax
+  8013aa:	78 05                	js     8013b1 <fd_close+0x30>
+	    || fd != fd2)
+  8013ac:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8013af:	74 16                	je     8013c7 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8013b1:	89 f8                	mov    %edi,%eax
+  8013b3:	84 c0                	test   %al,%al
+  8013b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013ba:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8013bd:	89 d8                	mov    %ebx,%eax
+  8013bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013c2:	5b                   	pop    %ebx
+  8013c3:	5e                   	pop    %esi
+  8013c4:	5f                   	pop    %edi
+  8013c5:	5d                   	pop    %ebp
+  8013c6:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8013c7:	83 ec 08             	sub    $0x8,%esp
+  8013ca:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8013cd:	50                   	push   %eax
+  8013ce:	ff 36                	push   (%esi)
+  8013d0:	e8 59 ff ff ff       	call   80132e <dev_lookup>
+  8013d5:	89 c3                	mov    %eax,%ebx
+  8013d7:	83 c4 10             	add    $0x10,%esp
+  8013da:	85 c0                	test   %eax,%eax
+  8013dc:	78 1a                	js     8013f8 <fd_close+0x77>
+		if (dev->dev_close)
+  8013de:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8013e1:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8013e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8013e9:	85 c0                	test   %eax,%eax
+  8013eb:	74 0b                	je     8013f8 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8013ed:	83 ec 0c             	sub    $0xc,%esp
+  8013f0:	56                   	push   %esi
+  8013f1:	ff d0                	call   *%eax
+  8013f3:	89 c3                	mov    %eax,%ebx
+  8013f5:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8013f8:	83 ec 08             	sub    $0x8,%esp
+  8013fb:	56                   	push   %esi
+  8013fc:	6a 00                	push   $0x0
+  8013fe:	e8 f9 f8 ff ff       	call   800cfc <sys_page_unmap>
+	return r;
+  801403:	83 c4 10             	add    $0x10,%esp
+  801406:	eb b5                	jmp    8013bd <fd_close+0x3c>
+
+00801408 <close>:
+
+int
+close(int fdnum)
+{
+  801408:	55                   	push   %ebp
+  801409:	89 e5                	mov    %esp,%ebp
+  80140b:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80140e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801411:	50                   	push   %eax
+  801412:	ff 75 08             	push   0x8(%ebp)
+  801415:	e8 c4 fe ff ff       	call   8012de <fd_lookup>
+  80141a:	83 c4 10             	add    $0x10,%esp
+  80141d:	85 c0                	test   %eax,%eax
+  80141f:	79 02                	jns    801423 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801421:	c9                   	leave
+  801422:	c3                   	ret
+		return fd_close(fd, 1);
+  801423:	83 ec 08             	sub    $0x8,%esp
+  801426:	6a 01                	push   $0x1
+  801428:	ff 75 f4             	push   -0xc(%ebp)
+  80142b:	e8 51 ff ff ff       	call   801381 <fd_close>
+  801430:	83 c4 10             	add    $0x10,%esp
+  801433:	eb ec                	jmp    801421 <close+0x19>
+
+00801435 <close_all>:
+
+void
+close_all(void)
+{
+  801435:	55                   	push   %ebp
+  801436:	89 e5                	mov    %esp,%ebp
+  801438:	53                   	push   %ebx
+  801439:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80143c:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801441:	83 ec 0c             	sub    $0xc,%esp
+  801444:	53                   	push   %ebx
+  801445:	e8 be ff ff ff       	call   801408 <close>
+	for (i = 0; i < MAXFD; i++)
+  80144a:	83 c3 01             	add    $0x1,%ebx
+  80144d:	83 c4 10             	add    $0x10,%esp
+  801450:	83 fb 20             	cmp    $0x20,%ebx
+  801453:	75 ec                	jne    801441 <close_all+0xc>
+}
+  801455:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801458:	c9                   	leave
+  801459:	c3                   	ret
+
+0080145a <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80145a:	55                   	push   %ebp
+  80145b:	89 e5                	mov    %esp,%ebp
+  80145d:	57                   	push   %edi
+  80145e:	56                   	push   %esi
+  80145f:	53                   	push   %ebx
+  801460:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801463:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801466:	50                   	push   %eax
+  801467:	ff 75 08             	push   0x8(%ebp)
+  80146a:	e8 6f fe ff ff       	call   8012de <fd_lookup>
+  80146f:	89 c3                	mov    %eax,%ebx
+  801471:	83 c4 10             	add    $0x10,%esp
+  801474:	85 c0                	test   %eax,%eax
+  801476:	78 7f                	js     8014f7 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801478:	83 ec 0c             	sub    $0xc,%esp
+  80147b:	ff 75 0c             	push   0xc(%ebp)
+  80147e:	e8 85 ff ff ff       	call   801408 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801483:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801486:	c1 e6 0c             	shl    $0xc,%esi
+  801489:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80148f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801492:	89 3c 24             	mov    %edi,(%esp)
+  801495:	e8 d7 fd ff ff       	call   801271 <fd2data>
+  80149a:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80149c:	89 34 24             	mov    %esi,(%esp)
+  80149f:	e8 cd fd ff ff       	call   801271 <fd2data>
+  8014a4:	83 c4 10             	add    $0x10,%esp
+  8014a7:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8014aa:	89 d8                	mov    %ebx,%eax
+  8014ac:	c1 e8 16             	shr    $0x16,%eax
+  8014af:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8014b6:	a8 01                	test   $0x1,%al
+  8014b8:	74 11                	je     8014cb <dup+0x71>
+  8014ba:	89 d8                	mov    %ebx,%eax
+  8014bc:	c1 e8 0c             	shr    $0xc,%eax
+  8014bf:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8014c6:	f6 c2 01             	test   $0x1,%dl
+  8014c9:	75 36                	jne    801501 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8014cb:	89 f8                	mov    %edi,%eax
+  8014cd:	c1 e8 0c             	shr    $0xc,%eax
+  8014d0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8014d7:	83 ec 0c             	sub    $0xc,%esp
+  8014da:	25 07 0e 00 00       	and    $0xe07,%eax
+  8014df:	50                   	push   %eax
+  8014e0:	56                   	push   %esi
+  8014e1:	6a 00                	push   $0x0
+  8014e3:	57                   	push   %edi
+  8014e4:	6a 00                	push   $0x0
+  8014e6:	e8 cf f7 ff ff       	call   800cba <sys_page_map>
+  8014eb:	89 c3                	mov    %eax,%ebx
+  8014ed:	83 c4 20             	add    $0x20,%esp
+  8014f0:	85 c0                	test   %eax,%eax
+  8014f2:	78 33                	js     801527 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8014f4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8014f7:	89 d8                	mov    %ebx,%eax
+  8014f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014fc:	5b                   	pop    %ebx
+  8014fd:	5e                   	pop    %esi
+  8014fe:	5f                   	pop    %edi
+  8014ff:	5d                   	pop    %ebp
+  801500:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801501:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801508:	83 ec 0c             	sub    $0xc,%esp
+  80150b:	25 07 0e 00 00       	and    $0xe07,%eax
+  801510:	50                   	push   %eax
+  801511:	ff 75 d4             	push   -0x2c(%ebp)
+  801514:	6a 00                	push   $0x0
+  801516:	53                   	push   %ebx
+  801517:	6a 00                	push   $0x0
+  801519:	e8 9c f7 ff ff       	call   800cba <sys_page_map>
+  80151e:	89 c3                	mov    %eax,%ebx
+  801520:	83 c4 20             	add    $0x20,%esp
+  801523:	85 c0                	test   %eax,%eax
+  801525:	79 a4                	jns    8014cb <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801527:	83 ec 08             	sub    $0x8,%esp
+  80152a:	56                   	push   %esi
+  80152b:	6a 00                	push   $0x0
+  80152d:	e8 ca f7 ff ff       	call   800cfc <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801532:	83 c4 08             	add    $0x8,%esp
+  801535:	ff 75 d4             	push   -0x2c(%ebp)
+  801538:	6a 00                	push   $0x0
+  80153a:	e8 bd f7 ff ff       	call   800cfc <sys_page_unmap>
+	return r;
+  80153f:	83 c4 10             	add    $0x10,%esp
+  801542:	eb b3                	jmp    8014f7 <dup+0x9d>
+
+00801544 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801544:	55                   	push   %ebp
+  801545:	89 e5                	mov    %esp,%ebp
+  801547:	56                   	push   %esi
+  801548:	53                   	push   %ebx
+  801549:	83 ec 18             	sub    $0x18,%esp
+  80154c:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80154f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801552:	50                   	push   %eax
+  801553:	56                   	push   %esi
+  801554:	e8 85 fd ff ff       	call   8012de <fd_lookup>
+  801559:	83 c4 10             	add    $0x10,%esp
+  80155c:	85 c0                	test   %eax,%eax
+  80155e:	78 3c                	js     80159c <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801560:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801563:	83 ec 08             	sub    $0x8,%esp
+  801566:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801569:	50                   	push   %eax
+  80156a:	ff 33                	push   (%ebx)
+  80156c:	e8 bd fd ff ff       	call   80132e <dev_lookup>
+  801571:	83 c4 10             	add    $0x10,%esp
+  801574:	85 c0                	test   %eax,%eax
+  801576:	78 24                	js     80159c <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801578:	8b 43 08             	mov    0x8(%ebx),%eax
+  80157b:	83 e0 03             	and    $0x3,%eax
+  80157e:	83 f8 01             	cmp    $0x1,%eax
+  801581:	74 20                	je     8015a3 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801583:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801586:	8b 40 08             	mov    0x8(%eax),%eax
+  801589:	85 c0                	test   %eax,%eax
+  80158b:	74 37                	je     8015c4 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80158d:	83 ec 04             	sub    $0x4,%esp
+  801590:	ff 75 10             	push   0x10(%ebp)
+  801593:	ff 75 0c             	push   0xc(%ebp)
+  801596:	53                   	push   %ebx
+  801597:	ff d0                	call   *%eax
+  801599:	83 c4 10             	add    $0x10,%esp
+}
+  80159c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80159f:	5b                   	pop    %ebx
+  8015a0:	5e                   	pop    %esi
+  8015a1:	5d                   	pop    %ebp
+  8015a2:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8015a3:	a1 08 50 80 00       	mov    0x805008,%eax
+  8015a8:	8b 40 48             	mov    0x48(%eax),%eax
+  8015ab:	83 ec 04             	sub    $0x4,%esp
+  8015ae:	56                   	push   %esi
+  8015af:	50                   	push   %eax
+  8015b0:	68 7d 35 80 00       	push   $0x80357d
+  8015b5:	e8 18 ed ff ff       	call   8002d2 <cprintf>
+		return -E_INVAL;
+  8015ba:	83 c4 10             	add    $0x10,%esp
+  8015bd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015c2:	eb d8                	jmp    80159c <read+0x58>
+		return -E_NOT_SUPP;
+  8015c4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015c9:	eb d1                	jmp    80159c <read+0x58>
+
+008015cb <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8015cb:	55                   	push   %ebp
+  8015cc:	89 e5                	mov    %esp,%ebp
+  8015ce:	57                   	push   %edi
+  8015cf:	56                   	push   %esi
+  8015d0:	53                   	push   %ebx
+  8015d1:	83 ec 0c             	sub    $0xc,%esp
+  8015d4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8015d7:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8015da:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015df:	eb 02                	jmp    8015e3 <readn+0x18>
+  8015e1:	01 c3                	add    %eax,%ebx
+  8015e3:	39 f3                	cmp    %esi,%ebx
+  8015e5:	73 21                	jae    801608 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8015e7:	83 ec 04             	sub    $0x4,%esp
+  8015ea:	89 f0                	mov    %esi,%eax
+  8015ec:	29 d8                	sub    %ebx,%eax
+  8015ee:	50                   	push   %eax
+  8015ef:	89 d8                	mov    %ebx,%eax
+  8015f1:	03 45 0c             	add    0xc(%ebp),%eax
+  8015f4:	50                   	push   %eax
+  8015f5:	57                   	push   %edi
+  8015f6:	e8 49 ff ff ff       	call   801544 <read>
+		if (m < 0)
+  8015fb:	83 c4 10             	add    $0x10,%esp
+  8015fe:	85 c0                	test   %eax,%eax
+  801600:	78 04                	js     801606 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801602:	75 dd                	jne    8015e1 <readn+0x16>
+  801604:	eb 02                	jmp    801608 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801606:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801608:	89 d8                	mov    %ebx,%eax
+  80160a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80160d:	5b                   	pop    %ebx
+  80160e:	5e                   	pop    %esi
+  80160f:	5f                   	pop    %edi
+  801610:	5d                   	pop    %ebp
+  801611:	c3                   	ret
+
+00801612 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801612:	55                   	push   %ebp
+  801613:	89 e5                	mov    %esp,%ebp
+  801615:	56                   	push   %esi
+  801616:	53                   	push   %ebx
+  801617:	83 ec 18             	sub    $0x18,%esp
+  80161a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80161d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801620:	50                   	push   %eax
+  801621:	53                   	push   %ebx
+  801622:	e8 b7 fc ff ff       	call   8012de <fd_lookup>
+  801627:	83 c4 10             	add    $0x10,%esp
+  80162a:	85 c0                	test   %eax,%eax
+  80162c:	78 37                	js     801665 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80162e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801631:	83 ec 08             	sub    $0x8,%esp
+  801634:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801637:	50                   	push   %eax
+  801638:	ff 36                	push   (%esi)
+  80163a:	e8 ef fc ff ff       	call   80132e <dev_lookup>
+  80163f:	83 c4 10             	add    $0x10,%esp
+  801642:	85 c0                	test   %eax,%eax
+  801644:	78 1f                	js     801665 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801646:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80164a:	74 20                	je     80166c <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80164c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80164f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801652:	85 c0                	test   %eax,%eax
+  801654:	74 37                	je     80168d <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801656:	83 ec 04             	sub    $0x4,%esp
+  801659:	ff 75 10             	push   0x10(%ebp)
+  80165c:	ff 75 0c             	push   0xc(%ebp)
+  80165f:	56                   	push   %esi
+  801660:	ff d0                	call   *%eax
+  801662:	83 c4 10             	add    $0x10,%esp
+}
+  801665:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801668:	5b                   	pop    %ebx
+  801669:	5e                   	pop    %esi
+  80166a:	5d                   	pop    %ebp
+  80166b:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80166c:	a1 08 50 80 00       	mov    0x805008,%eax
+  801671:	8b 40 48             	mov    0x48(%eax),%eax
+  801674:	83 ec 04             	sub    $0x4,%esp
+  801677:	53                   	push   %ebx
+  801678:	50                   	push   %eax
+  801679:	68 99 35 80 00       	push   $0x803599
+  80167e:	e8 4f ec ff ff       	call   8002d2 <cprintf>
+		return -E_INVAL;
+  801683:	83 c4 10             	add    $0x10,%esp
+  801686:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80168b:	eb d8                	jmp    801665 <write+0x53>
+		return -E_NOT_SUPP;
+  80168d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801692:	eb d1                	jmp    801665 <write+0x53>
+
+00801694 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801694:	55                   	push   %ebp
+  801695:	89 e5                	mov    %esp,%ebp
+  801697:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80169a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80169d:	50                   	push   %eax
+  80169e:	ff 75 08             	push   0x8(%ebp)
+  8016a1:	e8 38 fc ff ff       	call   8012de <fd_lookup>
+  8016a6:	83 c4 10             	add    $0x10,%esp
+  8016a9:	85 c0                	test   %eax,%eax
+  8016ab:	78 0e                	js     8016bb <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8016ad:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8016b0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016b3:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8016b6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8016bb:	c9                   	leave
+  8016bc:	c3                   	ret
+
+008016bd <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8016bd:	55                   	push   %ebp
+  8016be:	89 e5                	mov    %esp,%ebp
+  8016c0:	56                   	push   %esi
+  8016c1:	53                   	push   %ebx
+  8016c2:	83 ec 18             	sub    $0x18,%esp
+  8016c5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016c8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016cb:	50                   	push   %eax
+  8016cc:	53                   	push   %ebx
+  8016cd:	e8 0c fc ff ff       	call   8012de <fd_lookup>
+  8016d2:	83 c4 10             	add    $0x10,%esp
+  8016d5:	85 c0                	test   %eax,%eax
+  8016d7:	78 34                	js     80170d <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016d9:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8016dc:	83 ec 08             	sub    $0x8,%esp
+  8016df:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016e2:	50                   	push   %eax
+  8016e3:	ff 36                	push   (%esi)
+  8016e5:	e8 44 fc ff ff       	call   80132e <dev_lookup>
+  8016ea:	83 c4 10             	add    $0x10,%esp
+  8016ed:	85 c0                	test   %eax,%eax
+  8016ef:	78 1c                	js     80170d <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8016f1:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8016f5:	74 1d                	je     801714 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8016f7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016fa:	8b 40 18             	mov    0x18(%eax),%eax
+  8016fd:	85 c0                	test   %eax,%eax
+  8016ff:	74 34                	je     801735 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801701:	83 ec 08             	sub    $0x8,%esp
+  801704:	ff 75 0c             	push   0xc(%ebp)
+  801707:	56                   	push   %esi
+  801708:	ff d0                	call   *%eax
+  80170a:	83 c4 10             	add    $0x10,%esp
+}
+  80170d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801710:	5b                   	pop    %ebx
+  801711:	5e                   	pop    %esi
+  801712:	5d                   	pop    %ebp
+  801713:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801714:	a1 08 50 80 00       	mov    0x805008,%eax
+  801719:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80171c:	83 ec 04             	sub    $0x4,%esp
+  80171f:	53                   	push   %ebx
+  801720:	50                   	push   %eax
+  801721:	68 5c 35 80 00       	push   $0x80355c
+  801726:	e8 a7 eb ff ff       	call   8002d2 <cprintf>
+		return -E_INVAL;
+  80172b:	83 c4 10             	add    $0x10,%esp
+  80172e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801733:	eb d8                	jmp    80170d <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801735:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80173a:	eb d1                	jmp    80170d <ftruncate+0x50>
+
+0080173c <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80173c:	55                   	push   %ebp
+  80173d:	89 e5                	mov    %esp,%ebp
+  80173f:	56                   	push   %esi
+  801740:	53                   	push   %ebx
+  801741:	83 ec 18             	sub    $0x18,%esp
+  801744:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801747:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80174a:	50                   	push   %eax
+  80174b:	ff 75 08             	push   0x8(%ebp)
+  80174e:	e8 8b fb ff ff       	call   8012de <fd_lookup>
+  801753:	83 c4 10             	add    $0x10,%esp
+  801756:	85 c0                	test   %eax,%eax
+  801758:	78 49                	js     8017a3 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80175a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80175d:	83 ec 08             	sub    $0x8,%esp
+  801760:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801763:	50                   	push   %eax
+  801764:	ff 36                	push   (%esi)
+  801766:	e8 c3 fb ff ff       	call   80132e <dev_lookup>
+  80176b:	83 c4 10             	add    $0x10,%esp
+  80176e:	85 c0                	test   %eax,%eax
+  801770:	78 31                	js     8017a3 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801772:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801775:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801779:	74 2f                	je     8017aa <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80177b:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80177e:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801785:	00 00 00 
+	stat->st_isdir = 0;
+  801788:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80178f:	00 00 00 
+	stat->st_dev = dev;
+  801792:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801798:	83 ec 08             	sub    $0x8,%esp
+  80179b:	53                   	push   %ebx
+  80179c:	56                   	push   %esi
+  80179d:	ff 50 14             	call   *0x14(%eax)
+  8017a0:	83 c4 10             	add    $0x10,%esp
+}
+  8017a3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017a6:	5b                   	pop    %ebx
+  8017a7:	5e                   	pop    %esi
+  8017a8:	5d                   	pop    %ebp
+  8017a9:	c3                   	ret
+		return -E_NOT_SUPP;
+  8017aa:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017af:	eb f2                	jmp    8017a3 <fstat+0x67>
+
+008017b1 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8017b1:	55                   	push   %ebp
+  8017b2:	89 e5                	mov    %esp,%ebp
+  8017b4:	56                   	push   %esi
+  8017b5:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8017b6:	83 ec 08             	sub    $0x8,%esp
+  8017b9:	6a 00                	push   $0x0
+  8017bb:	ff 75 08             	push   0x8(%ebp)
+  8017be:	e8 e4 01 00 00       	call   8019a7 <open>
+  8017c3:	89 c3                	mov    %eax,%ebx
+  8017c5:	83 c4 10             	add    $0x10,%esp
+  8017c8:	85 c0                	test   %eax,%eax
+  8017ca:	78 1b                	js     8017e7 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8017cc:	83 ec 08             	sub    $0x8,%esp
+  8017cf:	ff 75 0c             	push   0xc(%ebp)
+  8017d2:	50                   	push   %eax
+  8017d3:	e8 64 ff ff ff       	call   80173c <fstat>
+  8017d8:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8017da:	89 1c 24             	mov    %ebx,(%esp)
+  8017dd:	e8 26 fc ff ff       	call   801408 <close>
+	return r;
+  8017e2:	83 c4 10             	add    $0x10,%esp
+  8017e5:	89 f3                	mov    %esi,%ebx
+}
+  8017e7:	89 d8                	mov    %ebx,%eax
+  8017e9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017ec:	5b                   	pop    %ebx
+  8017ed:	5e                   	pop    %esi
+  8017ee:	5d                   	pop    %ebp
+  8017ef:	c3                   	ret
+
+008017f0 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  8017f0:	55                   	push   %ebp
+  8017f1:	89 e5                	mov    %esp,%ebp
+  8017f3:	56                   	push   %esi
+  8017f4:	53                   	push   %ebx
+  8017f5:	89 c6                	mov    %eax,%esi
+  8017f7:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  8017f9:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  801800:	74 27                	je     801829 <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801802:	6a 07                	push   $0x7
+  801804:	68 00 60 80 00       	push   $0x806000
+  801809:	56                   	push   %esi
+  80180a:	ff 35 00 50 80 00    	push   0x805000
+  801810:	e8 8e 12 00 00       	call   802aa3 <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  801815:	83 c4 0c             	add    $0xc,%esp
+  801818:	6a 00                	push   $0x0
+  80181a:	53                   	push   %ebx
+  80181b:	6a 00                	push   $0x0
+  80181d:	e8 0d 12 00 00       	call   802a2f <ipc_recv>
+}
+  801822:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801825:	5b                   	pop    %ebx
+  801826:	5e                   	pop    %esi
+  801827:	5d                   	pop    %ebp
+  801828:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  801829:	83 ec 0c             	sub    $0xc,%esp
+  80182c:	6a 01                	push   $0x1
+  80182e:	e8 c4 12 00 00       	call   802af7 <ipc_find_env>
+  801833:	a3 00 50 80 00       	mov    %eax,0x805000
+  801838:	83 c4 10             	add    $0x10,%esp
+  80183b:	eb c5                	jmp    801802 <fsipc+0x12>
+
+0080183d <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80183d:	55                   	push   %ebp
+  80183e:	89 e5                	mov    %esp,%ebp
+  801840:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801843:	8b 45 08             	mov    0x8(%ebp),%eax
+  801846:	8b 40 0c             	mov    0xc(%eax),%eax
+  801849:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.set_size.req_size = newsize;
+  80184e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801851:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801856:	ba 00 00 00 00       	mov    $0x0,%edx
+  80185b:	b8 02 00 00 00       	mov    $0x2,%eax
+  801860:	e8 8b ff ff ff       	call   8017f0 <fsipc>
+}
+  801865:	c9                   	leave
+  801866:	c3                   	ret
+
+00801867 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801867:	55                   	push   %ebp
+  801868:	89 e5                	mov    %esp,%ebp
+  80186a:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80186d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801870:	8b 40 0c             	mov    0xc(%eax),%eax
+  801873:	a3 00 60 80 00       	mov    %eax,0x806000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801878:	ba 00 00 00 00       	mov    $0x0,%edx
+  80187d:	b8 06 00 00 00       	mov    $0x6,%eax
+  801882:	e8 69 ff ff ff       	call   8017f0 <fsipc>
+}
+  801887:	c9                   	leave
+  801888:	c3                   	ret
+
+00801889 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801889:	55                   	push   %ebp
+  80188a:	89 e5                	mov    %esp,%ebp
+  80188c:	53                   	push   %ebx
+  80188d:	83 ec 04             	sub    $0x4,%esp
+  801890:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801893:	8b 45 08             	mov    0x8(%ebp),%eax
+  801896:	8b 40 0c             	mov    0xc(%eax),%eax
+  801899:	a3 00 60 80 00       	mov    %eax,0x806000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80189e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018a3:	b8 05 00 00 00       	mov    $0x5,%eax
+  8018a8:	e8 43 ff ff ff       	call   8017f0 <fsipc>
+  8018ad:	85 c0                	test   %eax,%eax
+  8018af:	78 2c                	js     8018dd <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8018b1:	83 ec 08             	sub    $0x8,%esp
+  8018b4:	68 00 60 80 00       	push   $0x806000
+  8018b9:	53                   	push   %ebx
+  8018ba:	e8 cc ef ff ff       	call   80088b <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  8018bf:	a1 80 60 80 00       	mov    0x806080,%eax
+  8018c4:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8018ca:	a1 84 60 80 00       	mov    0x806084,%eax
+  8018cf:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  8018d5:	83 c4 10             	add    $0x10,%esp
+  8018d8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018dd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018e0:	c9                   	leave
+  8018e1:	c3                   	ret
+
+008018e2 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8018e2:	55                   	push   %ebp
+  8018e3:	89 e5                	mov    %esp,%ebp
+  8018e5:	83 ec 0c             	sub    $0xc,%esp
+  8018e8:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8018eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018ee:	8b 52 0c             	mov    0xc(%edx),%edx
+  8018f1:	89 15 00 60 80 00    	mov    %edx,0x806000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8018f7:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8018fc:	39 d0                	cmp    %edx,%eax
+  8018fe:	0f 47 c2             	cmova  %edx,%eax
+  801901:	a3 04 60 80 00       	mov    %eax,0x806004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  801906:	50                   	push   %eax
+  801907:	ff 75 0c             	push   0xc(%ebp)
+  80190a:	68 08 60 80 00       	push   $0x806008
+  80190f:	e8 fd f0 ff ff       	call   800a11 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801914:	ba 00 00 00 00       	mov    $0x0,%edx
+  801919:	b8 04 00 00 00       	mov    $0x4,%eax
+  80191e:	e8 cd fe ff ff       	call   8017f0 <fsipc>
+}
+  801923:	c9                   	leave
+  801924:	c3                   	ret
+
+00801925 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801925:	55                   	push   %ebp
+  801926:	89 e5                	mov    %esp,%ebp
+  801928:	56                   	push   %esi
+  801929:	53                   	push   %ebx
+  80192a:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80192d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801930:	8b 40 0c             	mov    0xc(%eax),%eax
+  801933:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read.req_n = n;
+  801938:	89 35 04 60 80 00    	mov    %esi,0x806004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  80193e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801943:	b8 03 00 00 00       	mov    $0x3,%eax
+  801948:	e8 a3 fe ff ff       	call   8017f0 <fsipc>
+  80194d:	89 c3                	mov    %eax,%ebx
+  80194f:	85 c0                	test   %eax,%eax
+  801951:	78 1f                	js     801972 <devfile_read+0x4d>
+  assert(r <= n);
+  801953:	39 c6                	cmp    %eax,%esi
+  801955:	72 24                	jb     80197b <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  801957:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80195c:	7f 33                	jg     801991 <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80195e:	83 ec 04             	sub    $0x4,%esp
+  801961:	50                   	push   %eax
+  801962:	68 00 60 80 00       	push   $0x806000
+  801967:	ff 75 0c             	push   0xc(%ebp)
+  80196a:	e8 a2 f0 ff ff       	call   800a11 <memmove>
+  return r;
+  80196f:	83 c4 10             	add    $0x10,%esp
+}
+  801972:	89 d8                	mov    %ebx,%eax
+  801974:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801977:	5b                   	pop    %ebx
+  801978:	5e                   	pop    %esi
+  801979:	5d                   	pop    %ebp
+  80197a:	c3                   	ret
+  assert(r <= n);
+  80197b:	68 cc 35 80 00       	push   $0x8035cc
+  801980:	68 d3 35 80 00       	push   $0x8035d3
+  801985:	6a 78                	push   $0x78
+  801987:	68 e8 35 80 00       	push   $0x8035e8
+  80198c:	e8 66 e8 ff ff       	call   8001f7 <_panic>
+  assert(r <= PGSIZE);
+  801991:	68 f3 35 80 00       	push   $0x8035f3
+  801996:	68 d3 35 80 00       	push   $0x8035d3
+  80199b:	6a 79                	push   $0x79
+  80199d:	68 e8 35 80 00       	push   $0x8035e8
+  8019a2:	e8 50 e8 ff ff       	call   8001f7 <_panic>
+
+008019a7 <open>:
+open(const char *path, int mode) {
+  8019a7:	55                   	push   %ebp
+  8019a8:	89 e5                	mov    %esp,%ebp
+  8019aa:	56                   	push   %esi
+  8019ab:	53                   	push   %ebx
+  8019ac:	83 ec 1c             	sub    $0x1c,%esp
+  8019af:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  8019b2:	56                   	push   %esi
+  8019b3:	e8 98 ee ff ff       	call   800850 <strlen>
+  8019b8:	83 c4 10             	add    $0x10,%esp
+  8019bb:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8019c0:	7f 6c                	jg     801a2e <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  8019c2:	83 ec 0c             	sub    $0xc,%esp
+  8019c5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019c8:	50                   	push   %eax
+  8019c9:	e8 ba f8 ff ff       	call   801288 <fd_alloc>
+  8019ce:	89 c3                	mov    %eax,%ebx
+  8019d0:	83 c4 10             	add    $0x10,%esp
+  8019d3:	85 c0                	test   %eax,%eax
+  8019d5:	78 3c                	js     801a13 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  8019d7:	83 ec 08             	sub    $0x8,%esp
+  8019da:	56                   	push   %esi
+  8019db:	68 00 60 80 00       	push   $0x806000
+  8019e0:	e8 a6 ee ff ff       	call   80088b <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  8019e5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019e8:	a3 00 64 80 00       	mov    %eax,0x806400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8019ed:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8019f0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8019f5:	e8 f6 fd ff ff       	call   8017f0 <fsipc>
+  8019fa:	89 c3                	mov    %eax,%ebx
+  8019fc:	83 c4 10             	add    $0x10,%esp
+  8019ff:	85 c0                	test   %eax,%eax
+  801a01:	78 19                	js     801a1c <open+0x75>
+  return fd2num(fd);
+  801a03:	83 ec 0c             	sub    $0xc,%esp
+  801a06:	ff 75 f4             	push   -0xc(%ebp)
+  801a09:	e8 53 f8 ff ff       	call   801261 <fd2num>
+  801a0e:	89 c3                	mov    %eax,%ebx
+  801a10:	83 c4 10             	add    $0x10,%esp
+}
+  801a13:	89 d8                	mov    %ebx,%eax
+  801a15:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a18:	5b                   	pop    %ebx
+  801a19:	5e                   	pop    %esi
+  801a1a:	5d                   	pop    %ebp
+  801a1b:	c3                   	ret
+    fd_close(fd, 0);
+  801a1c:	83 ec 08             	sub    $0x8,%esp
+  801a1f:	6a 00                	push   $0x0
+  801a21:	ff 75 f4             	push   -0xc(%ebp)
+  801a24:	e8 58 f9 ff ff       	call   801381 <fd_close>
+    return r;
+  801a29:	83 c4 10             	add    $0x10,%esp
+  801a2c:	eb e5                	jmp    801a13 <open+0x6c>
+    return -E_BAD_PATH;
+  801a2e:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801a33:	eb de                	jmp    801a13 <open+0x6c>
+
+00801a35 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  801a35:	55                   	push   %ebp
+  801a36:	89 e5                	mov    %esp,%ebp
+  801a38:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801a3b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a40:	b8 08 00 00 00       	mov    $0x8,%eax
+  801a45:	e8 a6 fd ff ff       	call   8017f0 <fsipc>
+}
+  801a4a:	c9                   	leave
+  801a4b:	c3                   	ret
+
+00801a4c <spawn>:
+// prog: the pathname of the program to run.
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv) {
+  801a4c:	55                   	push   %ebp
+  801a4d:	89 e5                	mov    %esp,%ebp
+  801a4f:	57                   	push   %edi
+  801a50:	56                   	push   %esi
+  801a51:	53                   	push   %ebx
+  801a52:	81 ec 84 02 00 00    	sub    $0x284,%esp
+  //   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+  //     correct initial eip and esp values in the child.
+  //
+  //   - Start the child process running with sys_env_set_status().
+
+  if ((r = open(prog, O_RDONLY)) < 0)
+  801a58:	6a 00                	push   $0x0
+  801a5a:	ff 75 08             	push   0x8(%ebp)
+  801a5d:	e8 45 ff ff ff       	call   8019a7 <open>
+  801a62:	89 85 8c fd ff ff    	mov    %eax,-0x274(%ebp)
+  801a68:	83 c4 10             	add    $0x10,%esp
+  801a6b:	85 c0                	test   %eax,%eax
+  801a6d:	0f 88 f8 04 00 00    	js     801f6b <spawn+0x51f>
+  801a73:	89 c1                	mov    %eax,%ecx
+    return r;
+  fd = r;
+
+  // Read elf header
+  elf = (struct Elf *) elf_buf;
+  if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf)
+  801a75:	83 ec 04             	sub    $0x4,%esp
+  801a78:	68 00 02 00 00       	push   $0x200
+  801a7d:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  801a83:	50                   	push   %eax
+  801a84:	51                   	push   %ecx
+  801a85:	e8 41 fb ff ff       	call   8015cb <readn>
+  801a8a:	83 c4 10             	add    $0x10,%esp
+  801a8d:	3d 00 02 00 00       	cmp    $0x200,%eax
+  801a92:	75 5a                	jne    801aee <spawn+0xa2>
+      || elf->e_magic != ELF_MAGIC) {
+  801a94:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  801a9b:	45 4c 46 
+  801a9e:	75 4e                	jne    801aee <spawn+0xa2>
+  801aa0:	b8 07 00 00 00       	mov    $0x7,%eax
+  801aa5:	cd 30                	int    $0x30
+  801aa7:	89 85 88 fd ff ff    	mov    %eax,-0x278(%ebp)
+    cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+    return -E_NOT_EXEC;
+  }
+
+  // Create new child environment
+  if ((r = sys_exofork()) < 0)
+  801aad:	85 c0                	test   %eax,%eax
+  801aaf:	0f 88 aa 04 00 00    	js     801f5f <spawn+0x513>
+    return r;
+  child = r;
+
+  // Set up trap frame, including initial stack.
+  child_tf = envs[ENVX(child)].env_tf;
+  801ab5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801aba:	8d 34 c0             	lea    (%eax,%eax,8),%esi
+  801abd:	c1 e6 04             	shl    $0x4,%esi
+  801ac0:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  801ac6:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  801acc:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801ad1:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  child_tf.tf_eip = elf->e_entry;
+  801ad3:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  801ad9:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  uintptr_t *argv_store;
+
+  // Count the number of arguments (argc)
+  // and the total amount of space needed for strings (string_size).
+  string_size = 0;
+  for (argc = 0; argv[argc] != 0; argc++)
+  801adf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  string_size = 0;
+  801ae4:	be 00 00 00 00       	mov    $0x0,%esi
+  801ae9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  for (argc = 0; argv[argc] != 0; argc++)
+  801aec:	eb 4b                	jmp    801b39 <spawn+0xed>
+    close(fd);
+  801aee:	83 ec 0c             	sub    $0xc,%esp
+  801af1:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  801af7:	e8 0c f9 ff ff       	call   801408 <close>
+    cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  801afc:	83 c4 0c             	add    $0xc,%esp
+  801aff:	68 7f 45 4c 46       	push   $0x464c457f
+  801b04:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  801b0a:	68 ff 35 80 00       	push   $0x8035ff
+  801b0f:	e8 be e7 ff ff       	call   8002d2 <cprintf>
+    return -E_NOT_EXEC;
+  801b14:	83 c4 10             	add    $0x10,%esp
+  801b17:	c7 85 8c fd ff ff f2 	movl   $0xfffffff2,-0x274(%ebp)
+  801b1e:	ff ff ff 
+  801b21:	e9 45 04 00 00       	jmp    801f6b <spawn+0x51f>
+    string_size += strlen(argv[argc]) + 1;
+  801b26:	83 ec 0c             	sub    $0xc,%esp
+  801b29:	50                   	push   %eax
+  801b2a:	e8 21 ed ff ff       	call   800850 <strlen>
+  801b2f:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+  for (argc = 0; argv[argc] != 0; argc++)
+  801b33:	83 c3 01             	add    $0x1,%ebx
+  801b36:	83 c4 10             	add    $0x10,%esp
+  801b39:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  801b3c:	85 c0                	test   %eax,%eax
+  801b3e:	75 e6                	jne    801b26 <spawn+0xda>
+  // Determine where to place the strings and the argv array.
+  // Set up pointers into the temporary page 'UTEMP'; we'll map a page
+  // there later, then remap that page into the child environment
+  // at (USTACKTOP - PGSIZE).
+  // strings is the topmost thing on the stack.
+  string_store = (char *) UTEMP + PGSIZE - string_size;
+  801b40:	89 9d 84 fd ff ff    	mov    %ebx,-0x27c(%ebp)
+  801b46:	bf 00 10 40 00       	mov    $0x401000,%edi
+  801b4b:	29 f7                	sub    %esi,%edi
+  // argv is below that.  There's one argument pointer per argument, plus
+  // a null pointer.
+  argv_store = (uintptr_t *) (ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  801b4d:	89 fa                	mov    %edi,%edx
+  801b4f:	83 e2 fc             	and    $0xfffffffc,%edx
+  801b52:	8d 04 9d 04 00 00 00 	lea    0x4(,%ebx,4),%eax
+  801b59:	29 c2                	sub    %eax,%edx
+  801b5b:	89 95 94 fd ff ff    	mov    %edx,-0x26c(%ebp)
+
+  // Make sure that argv, strings, and the 2 words that hold 'argc'
+  // and 'argv' themselves will all fit in a single stack page.
+  if ((void *) (argv_store - 2) < (void *) UTEMP)
+  801b61:	8d 42 f8             	lea    -0x8(%edx),%eax
+  801b64:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  801b69:	0f 86 1f 04 00 00    	jbe    801f8e <spawn+0x542>
+    return -E_NO_MEM;
+
+  // Allocate the single stack page at UTEMP.
+  if ((r = sys_page_alloc(0, (void *) UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  801b6f:	83 ec 04             	sub    $0x4,%esp
+  801b72:	6a 07                	push   $0x7
+  801b74:	68 00 00 40 00       	push   $0x400000
+  801b79:	6a 00                	push   $0x0
+  801b7b:	e8 f7 f0 ff ff       	call   800c77 <sys_page_alloc>
+  801b80:	83 c4 10             	add    $0x10,%esp
+  801b83:	85 c0                	test   %eax,%eax
+  801b85:	0f 88 08 04 00 00    	js     801f93 <spawn+0x547>
+  //	  (Again, argv should use an address valid in the child's
+  //	  environment.)
+  //
+  //	* Set *init_esp to the initial stack pointer for the child,
+  //	  (Again, use an address valid in the child's environment.)
+  for (i = 0; i < argc; i++) {
+  801b8b:	be 00 00 00 00       	mov    $0x0,%esi
+  801b90:	89 9d 90 fd ff ff    	mov    %ebx,-0x270(%ebp)
+  801b96:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801b99:	39 b5 90 fd ff ff    	cmp    %esi,-0x270(%ebp)
+  801b9f:	7e 32                	jle    801bd3 <spawn+0x187>
+    argv_store[i] = UTEMP2USTACK(string_store);
+  801ba1:	8d 87 00 d0 7f ee    	lea    -0x11803000(%edi),%eax
+  801ba7:	8b 8d 94 fd ff ff    	mov    -0x26c(%ebp),%ecx
+  801bad:	89 04 b1             	mov    %eax,(%ecx,%esi,4)
+    strcpy(string_store, argv[i]);
+  801bb0:	83 ec 08             	sub    $0x8,%esp
+  801bb3:	ff 34 b3             	push   (%ebx,%esi,4)
+  801bb6:	57                   	push   %edi
+  801bb7:	e8 cf ec ff ff       	call   80088b <strcpy>
+    string_store += strlen(argv[i]) + 1;
+  801bbc:	83 c4 04             	add    $0x4,%esp
+  801bbf:	ff 34 b3             	push   (%ebx,%esi,4)
+  801bc2:	e8 89 ec ff ff       	call   800850 <strlen>
+  801bc7:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+  for (i = 0; i < argc; i++) {
+  801bcb:	83 c6 01             	add    $0x1,%esi
+  801bce:	83 c4 10             	add    $0x10,%esp
+  801bd1:	eb c6                	jmp    801b99 <spawn+0x14d>
+  }
+  argv_store[argc] = 0;
+  801bd3:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  801bd9:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  801bdf:	c7 04 88 00 00 00 00 	movl   $0x0,(%eax,%ecx,4)
+  assert(string_store == (char *) UTEMP + PGSIZE);
+  801be6:	81 ff 00 10 40 00    	cmp    $0x401000,%edi
+  801bec:	0f 85 87 00 00 00    	jne    801c79 <spawn+0x22d>
+
+  argv_store[-1] = UTEMP2USTACK(argv_store);
+  801bf2:	8b 8d 94 fd ff ff    	mov    -0x26c(%ebp),%ecx
+  801bf8:	8d 81 00 d0 7f ee    	lea    -0x11803000(%ecx),%eax
+  801bfe:	89 41 fc             	mov    %eax,-0x4(%ecx)
+  argv_store[-2] = argc;
+  801c01:	89 c8                	mov    %ecx,%eax
+  801c03:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  801c09:	89 48 f8             	mov    %ecx,-0x8(%eax)
+
+  *init_esp = UTEMP2USTACK(&argv_store[-2]);
+  801c0c:	2d 08 30 80 11       	sub    $0x11803008,%eax
+  801c11:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+
+  // After completing the stack, map it into the child's address space
+  // and unmap it from ours!
+  if ((r = sys_page_map(0, UTEMP, child, (void *) (USTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  801c17:	83 ec 0c             	sub    $0xc,%esp
+  801c1a:	6a 07                	push   $0x7
+  801c1c:	68 00 d0 bf ee       	push   $0xeebfd000
+  801c21:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  801c27:	68 00 00 40 00       	push   $0x400000
+  801c2c:	6a 00                	push   $0x0
+  801c2e:	e8 87 f0 ff ff       	call   800cba <sys_page_map>
+  801c33:	89 c3                	mov    %eax,%ebx
+  801c35:	83 c4 20             	add    $0x20,%esp
+  801c38:	85 c0                	test   %eax,%eax
+  801c3a:	0f 88 5b 03 00 00    	js     801f9b <spawn+0x54f>
+    goto error;
+  if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  801c40:	83 ec 08             	sub    $0x8,%esp
+  801c43:	68 00 00 40 00       	push   $0x400000
+  801c48:	6a 00                	push   $0x0
+  801c4a:	e8 ad f0 ff ff       	call   800cfc <sys_page_unmap>
+  801c4f:	89 c3                	mov    %eax,%ebx
+  801c51:	83 c4 10             	add    $0x10,%esp
+  801c54:	85 c0                	test   %eax,%eax
+  801c56:	0f 88 3f 03 00 00    	js     801f9b <spawn+0x54f>
+  ph = (struct Proghdr *) (elf_buf + elf->e_phoff);
+  801c5c:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  801c62:	8d 8c 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%ecx
+  for (i = 0; i < elf->e_phnum; i++, ph++) {
+  801c69:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c6e:	89 c8                	mov    %ecx,%eax
+  801c70:	89 d1                	mov    %edx,%ecx
+  801c72:	89 c2                	mov    %eax,%edx
+  801c74:	e9 5a 01 00 00       	jmp    801dd3 <spawn+0x387>
+  assert(string_store == (char *) UTEMP + PGSIZE);
+  801c79:	68 74 36 80 00       	push   $0x803674
+  801c7e:	68 d3 35 80 00       	push   $0x8035d3
+  801c83:	68 52 01 00 00       	push   $0x152
+  801c88:	68 19 36 80 00       	push   $0x803619
+  801c8d:	e8 65 e5 ff ff       	call   8001f7 <_panic>
+      // allocate a blank page
+      if ((r = sys_page_alloc(child, (void *) (va + i), perm)) < 0)
+        return r;
+    } else {
+      // from file
+      if ((r = sys_page_alloc(0, UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  801c92:	83 ec 04             	sub    $0x4,%esp
+  801c95:	6a 07                	push   $0x7
+  801c97:	68 00 00 40 00       	push   $0x400000
+  801c9c:	6a 00                	push   $0x0
+  801c9e:	e8 d4 ef ff ff       	call   800c77 <sys_page_alloc>
+  801ca3:	83 c4 10             	add    $0x10,%esp
+  801ca6:	85 c0                	test   %eax,%eax
+  801ca8:	0f 88 cb 02 00 00    	js     801f79 <spawn+0x52d>
+        return r;
+      if ((r = seek(fd, fileoffset + i)) < 0)
+  801cae:	83 ec 08             	sub    $0x8,%esp
+  801cb1:	8b 95 80 fd ff ff    	mov    -0x280(%ebp),%edx
+  801cb7:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  801cbd:	01 d0                	add    %edx,%eax
+  801cbf:	50                   	push   %eax
+  801cc0:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  801cc6:	e8 c9 f9 ff ff       	call   801694 <seek>
+  801ccb:	83 c4 10             	add    $0x10,%esp
+  801cce:	85 c0                	test   %eax,%eax
+  801cd0:	0f 88 aa 02 00 00    	js     801f80 <spawn+0x534>
+        return r;
+      if ((r = readn(fd, UTEMP, MIN(PGSIZE, filesz - i))) < 0)
+  801cd6:	83 ec 04             	sub    $0x4,%esp
+  801cd9:	89 fa                	mov    %edi,%edx
+  801cdb:	8b 8d 94 fd ff ff    	mov    -0x26c(%ebp),%ecx
+  801ce1:	29 ca                	sub    %ecx,%edx
+  801ce3:	89 d0                	mov    %edx,%eax
+  801ce5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801cea:	39 d0                	cmp    %edx,%eax
+  801cec:	0f 47 c2             	cmova  %edx,%eax
+  801cef:	50                   	push   %eax
+  801cf0:	68 00 00 40 00       	push   $0x400000
+  801cf5:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  801cfb:	e8 cb f8 ff ff       	call   8015cb <readn>
+  801d00:	83 c4 10             	add    $0x10,%esp
+  801d03:	85 c0                	test   %eax,%eax
+  801d05:	0f 88 7c 02 00 00    	js     801f87 <spawn+0x53b>
+        return r;
+      if ((r = sys_page_map(0, UTEMP, child, (void *) (va + i), perm)) < 0)
+  801d0b:	83 ec 0c             	sub    $0xc,%esp
+  801d0e:	ff b5 84 fd ff ff    	push   -0x27c(%ebp)
+  801d14:	56                   	push   %esi
+  801d15:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  801d1b:	68 00 00 40 00       	push   $0x400000
+  801d20:	6a 00                	push   $0x0
+  801d22:	e8 93 ef ff ff       	call   800cba <sys_page_map>
+  801d27:	83 c4 20             	add    $0x20,%esp
+  801d2a:	85 c0                	test   %eax,%eax
+  801d2c:	78 7e                	js     801dac <spawn+0x360>
+        panic("spawn: sys_page_map data: %e", r);
+      sys_page_unmap(0, UTEMP);
+  801d2e:	83 ec 08             	sub    $0x8,%esp
+  801d31:	68 00 00 40 00       	push   $0x400000
+  801d36:	6a 00                	push   $0x0
+  801d38:	e8 bf ef ff ff       	call   800cfc <sys_page_unmap>
+  801d3d:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < memsz; i += PGSIZE) {
+  801d40:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801d46:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801d4c:	89 9d 94 fd ff ff    	mov    %ebx,-0x26c(%ebp)
+  801d52:	8b 85 90 fd ff ff    	mov    -0x270(%ebp),%eax
+  801d58:	39 c3                	cmp    %eax,%ebx
+  801d5a:	73 65                	jae    801dc1 <spawn+0x375>
+    if (i >= filesz) {
+  801d5c:	39 fb                	cmp    %edi,%ebx
+  801d5e:	0f 82 2e ff ff ff    	jb     801c92 <spawn+0x246>
+      if ((r = sys_page_alloc(child, (void *) (va + i), perm)) < 0)
+  801d64:	83 ec 04             	sub    $0x4,%esp
+  801d67:	ff b5 84 fd ff ff    	push   -0x27c(%ebp)
+  801d6d:	56                   	push   %esi
+  801d6e:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  801d74:	e8 fe ee ff ff       	call   800c77 <sys_page_alloc>
+  801d79:	83 c4 10             	add    $0x10,%esp
+  801d7c:	85 c0                	test   %eax,%eax
+  801d7e:	79 c0                	jns    801d40 <spawn+0x2f4>
+  801d80:	89 c7                	mov    %eax,%edi
+  sys_env_destroy(child);
+  801d82:	83 ec 0c             	sub    $0xc,%esp
+  801d85:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  801d8b:	e8 68 ee ff ff       	call   800bf8 <sys_env_destroy>
+  close(fd);
+  801d90:	83 c4 04             	add    $0x4,%esp
+  801d93:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  801d99:	e8 6a f6 ff ff       	call   801408 <close>
+  return r;
+  801d9e:	83 c4 10             	add    $0x10,%esp
+  801da1:	89 bd 8c fd ff ff    	mov    %edi,-0x274(%ebp)
+  801da7:	e9 bf 01 00 00       	jmp    801f6b <spawn+0x51f>
+        panic("spawn: sys_page_map data: %e", r);
+  801dac:	50                   	push   %eax
+  801dad:	68 25 36 80 00       	push   $0x803625
+  801db2:	68 84 01 00 00       	push   $0x184
+  801db7:	68 19 36 80 00       	push   $0x803619
+  801dbc:	e8 36 e4 ff ff       	call   8001f7 <_panic>
+  801dc1:	8b 8d 7c fd ff ff    	mov    -0x284(%ebp),%ecx
+  801dc7:	8b 95 78 fd ff ff    	mov    -0x288(%ebp),%edx
+  for (i = 0; i < elf->e_phnum; i++, ph++) {
+  801dcd:	83 c1 01             	add    $0x1,%ecx
+  801dd0:	83 c2 20             	add    $0x20,%edx
+  801dd3:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  801dda:	39 c8                	cmp    %ecx,%eax
+  801ddc:	0f 8e 88 00 00 00    	jle    801e6a <spawn+0x41e>
+    if (ph->p_type != ELF_PROG_LOAD)
+  801de2:	83 3a 01             	cmpl   $0x1,(%edx)
+  801de5:	75 e6                	jne    801dcd <spawn+0x381>
+    if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  801de7:	8b 42 18             	mov    0x18(%edx),%eax
+  801dea:	83 e0 02             	and    $0x2,%eax
+    perm = PTE_P | PTE_U;
+  801ded:	83 f8 01             	cmp    $0x1,%eax
+  801df0:	19 c0                	sbb    %eax,%eax
+  801df2:	83 e0 fe             	and    $0xfffffffe,%eax
+  801df5:	83 c0 07             	add    $0x7,%eax
+    if ((r = map_segment(child, ph->p_va, ph->p_memsz, fd, ph->p_filesz, ph->p_offset, perm)) < 0)
+  801df8:	8b 72 04             	mov    0x4(%edx),%esi
+  801dfb:	89 b5 80 fd ff ff    	mov    %esi,-0x280(%ebp)
+  801e01:	8b 7a 10             	mov    0x10(%edx),%edi
+  801e04:	89 bd 94 fd ff ff    	mov    %edi,-0x26c(%ebp)
+  801e0a:	8b 5a 14             	mov    0x14(%edx),%ebx
+  801e0d:	89 9d 90 fd ff ff    	mov    %ebx,-0x270(%ebp)
+  801e13:	8b 7a 08             	mov    0x8(%edx),%edi
+  801e16:	89 bd 84 fd ff ff    	mov    %edi,-0x27c(%ebp)
+  if ((i = PGOFF(va))) {
+  801e1c:	89 fb                	mov    %edi,%ebx
+  801e1e:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  801e24:	74 1c                	je     801e42 <spawn+0x3f6>
+    va -= i;
+  801e26:	29 df                	sub    %ebx,%edi
+  801e28:	89 bd 84 fd ff ff    	mov    %edi,-0x27c(%ebp)
+    memsz += i;
+  801e2e:	01 9d 90 fd ff ff    	add    %ebx,-0x270(%ebp)
+    filesz += i;
+  801e34:	01 9d 94 fd ff ff    	add    %ebx,-0x26c(%ebp)
+    fileoffset -= i;
+  801e3a:	29 de                	sub    %ebx,%esi
+  801e3c:	89 b5 80 fd ff ff    	mov    %esi,-0x280(%ebp)
+  for (i = 0; i < memsz; i += PGSIZE) {
+  801e42:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e47:	8b bd 94 fd ff ff    	mov    -0x26c(%ebp),%edi
+  801e4d:	8b b5 84 fd ff ff    	mov    -0x27c(%ebp),%esi
+  801e53:	89 8d 7c fd ff ff    	mov    %ecx,-0x284(%ebp)
+  801e59:	89 95 78 fd ff ff    	mov    %edx,-0x288(%ebp)
+  801e5f:	89 85 84 fd ff ff    	mov    %eax,-0x27c(%ebp)
+  801e65:	e9 e2 fe ff ff       	jmp    801d4c <spawn+0x300>
+  close(fd);
+  801e6a:	83 ec 0c             	sub    $0xc,%esp
+  801e6d:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  801e73:	e8 90 f5 ff ff       	call   801408 <close>
+  801e78:	83 c4 10             	add    $0x10,%esp
+  // LAB 5: Your code here.
+  int r;
+  unsigned perm = PTE_P | PTE_U | PTE_SHARE;
+
+  uintptr_t addr;
+  for (addr = 0; addr < UTOP; addr += PGSIZE)
+  801e7b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e80:	8b b5 88 fd ff ff    	mov    -0x278(%ebp),%esi
+  801e86:	eb 0e                	jmp    801e96 <spawn+0x44a>
+  801e88:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801e8e:	81 fb 00 00 c0 ee    	cmp    $0xeec00000,%ebx
+  801e94:	74 5e                	je     801ef4 <spawn+0x4a8>
+    if ((uvpd[PDX(addr)] & PTE_P) && (uvpt[PGNUM(addr)] & perm) == perm) {
+  801e96:	89 d8                	mov    %ebx,%eax
+  801e98:	c1 e8 16             	shr    $0x16,%eax
+  801e9b:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801ea2:	a8 01                	test   $0x1,%al
+  801ea4:	74 e2                	je     801e88 <spawn+0x43c>
+  801ea6:	89 da                	mov    %ebx,%edx
+  801ea8:	c1 ea 0c             	shr    $0xc,%edx
+  801eab:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  801eb2:	25 05 04 00 00       	and    $0x405,%eax
+  801eb7:	3d 05 04 00 00       	cmp    $0x405,%eax
+  801ebc:	75 ca                	jne    801e88 <spawn+0x43c>
+      if ((r = sys_page_map(0, (void *) addr, child, (void *) addr, uvpt[PGNUM(addr)] & PTE_SYSCALL)) < 0) {
+  801ebe:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  801ec5:	83 ec 0c             	sub    $0xc,%esp
+  801ec8:	25 07 0e 00 00       	and    $0xe07,%eax
+  801ecd:	50                   	push   %eax
+  801ece:	53                   	push   %ebx
+  801ecf:	56                   	push   %esi
+  801ed0:	53                   	push   %ebx
+  801ed1:	6a 00                	push   $0x0
+  801ed3:	e8 e2 ed ff ff       	call   800cba <sys_page_map>
+  801ed8:	83 c4 20             	add    $0x20,%esp
+  801edb:	85 c0                	test   %eax,%eax
+  801edd:	79 a9                	jns    801e88 <spawn+0x43c>
+        panic("copy_shared_pages : sys_page_map: %e\n", r);
+  801edf:	50                   	push   %eax
+  801ee0:	68 9c 36 80 00       	push   $0x80369c
+  801ee5:	68 96 01 00 00       	push   $0x196
+  801eea:	68 19 36 80 00       	push   $0x803619
+  801eef:	e8 03 e3 ff ff       	call   8001f7 <_panic>
+  if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  801ef4:	83 ec 08             	sub    $0x8,%esp
+  801ef7:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  801efd:	50                   	push   %eax
+  801efe:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  801f04:	e8 77 ee ff ff       	call   800d80 <sys_env_set_trapframe>
+  801f09:	83 c4 10             	add    $0x10,%esp
+  801f0c:	85 c0                	test   %eax,%eax
+  801f0e:	78 25                	js     801f35 <spawn+0x4e9>
+  if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  801f10:	83 ec 08             	sub    $0x8,%esp
+  801f13:	6a 02                	push   $0x2
+  801f15:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  801f1b:	e8 1e ee ff ff       	call   800d3e <sys_env_set_status>
+  801f20:	83 c4 10             	add    $0x10,%esp
+  801f23:	85 c0                	test   %eax,%eax
+  801f25:	78 23                	js     801f4a <spawn+0x4fe>
+  return child;
+  801f27:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  801f2d:	89 85 8c fd ff ff    	mov    %eax,-0x274(%ebp)
+  801f33:	eb 36                	jmp    801f6b <spawn+0x51f>
+    panic("sys_env_set_trapframe: %e", r);
+  801f35:	50                   	push   %eax
+  801f36:	68 42 36 80 00       	push   $0x803642
+  801f3b:	68 86 00 00 00       	push   $0x86
+  801f40:	68 19 36 80 00       	push   $0x803619
+  801f45:	e8 ad e2 ff ff       	call   8001f7 <_panic>
+    panic("sys_env_set_status: %e", r);
+  801f4a:	50                   	push   %eax
+  801f4b:	68 5c 36 80 00       	push   $0x80365c
+  801f50:	68 89 00 00 00       	push   $0x89
+  801f55:	68 19 36 80 00       	push   $0x803619
+  801f5a:	e8 98 e2 ff ff       	call   8001f7 <_panic>
+    return r;
+  801f5f:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  801f65:	89 85 8c fd ff ff    	mov    %eax,-0x274(%ebp)
+}
+  801f6b:	8b 85 8c fd ff ff    	mov    -0x274(%ebp),%eax
+  801f71:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f74:	5b                   	pop    %ebx
+  801f75:	5e                   	pop    %esi
+  801f76:	5f                   	pop    %edi
+  801f77:	5d                   	pop    %ebp
+  801f78:	c3                   	ret
+  801f79:	89 c7                	mov    %eax,%edi
+  801f7b:	e9 02 fe ff ff       	jmp    801d82 <spawn+0x336>
+  801f80:	89 c7                	mov    %eax,%edi
+  801f82:	e9 fb fd ff ff       	jmp    801d82 <spawn+0x336>
+  801f87:	89 c7                	mov    %eax,%edi
+  801f89:	e9 f4 fd ff ff       	jmp    801d82 <spawn+0x336>
+    return -E_NO_MEM;
+  801f8e:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  return r;
+  801f93:	89 85 8c fd ff ff    	mov    %eax,-0x274(%ebp)
+  801f99:	eb d0                	jmp    801f6b <spawn+0x51f>
+  sys_page_unmap(0, UTEMP);
+  801f9b:	83 ec 08             	sub    $0x8,%esp
+  801f9e:	68 00 00 40 00       	push   $0x400000
+  801fa3:	6a 00                	push   $0x0
+  801fa5:	e8 52 ed ff ff       	call   800cfc <sys_page_unmap>
+  801faa:	83 c4 10             	add    $0x10,%esp
+  801fad:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+  801fb3:	eb b6                	jmp    801f6b <spawn+0x51f>
+
+00801fb5 <spawnl>:
+spawnl(const char *prog, const char *arg0, ...) {
+  801fb5:	55                   	push   %ebp
+  801fb6:	89 e5                	mov    %esp,%ebp
+  801fb8:	56                   	push   %esi
+  801fb9:	53                   	push   %ebx
+  va_start(vl, arg0);
+  801fba:	8d 55 10             	lea    0x10(%ebp),%edx
+  int argc = 0;
+  801fbd:	b8 00 00 00 00       	mov    $0x0,%eax
+  while (va_arg(vl, void *) != NULL)
+  801fc2:	eb 05                	jmp    801fc9 <spawnl+0x14>
+    argc++;
+  801fc4:	83 c0 01             	add    $0x1,%eax
+  while (va_arg(vl, void *) != NULL)
+  801fc7:	89 ca                	mov    %ecx,%edx
+  801fc9:	8d 4a 04             	lea    0x4(%edx),%ecx
+  801fcc:	83 3a 00             	cmpl   $0x0,(%edx)
+  801fcf:	75 f3                	jne    801fc4 <spawnl+0xf>
+  const char *argv[argc + 2];
+  801fd1:	8d 14 85 17 00 00 00 	lea    0x17(,%eax,4),%edx
+  801fd8:	83 e2 f0             	and    $0xfffffff0,%edx
+  801fdb:	29 d4                	sub    %edx,%esp
+  801fdd:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  801fe1:	89 da                	mov    %ebx,%edx
+  801fe3:	c1 ea 02             	shr    $0x2,%edx
+  801fe6:	83 e3 fc             	and    $0xfffffffc,%ebx
+  argv[0] = arg0;
+  801fe9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801fec:	89 0c 95 00 00 00 00 	mov    %ecx,0x0(,%edx,4)
+  argv[argc + 1] = NULL;
+  801ff3:	c7 44 83 04 00 00 00 	movl   $0x0,0x4(%ebx,%eax,4)
+  801ffa:	00 
+  va_start(vl, arg0);
+  801ffb:	8d 4d 10             	lea    0x10(%ebp),%ecx
+  for (i = 0; i < argc; i++)
+  801ffe:	89 c2                	mov    %eax,%edx
+  802000:	b8 00 00 00 00       	mov    $0x0,%eax
+  802005:	eb 0b                	jmp    802012 <spawnl+0x5d>
+    argv[i + 1] = va_arg(vl, const char *);
+  802007:	83 c0 01             	add    $0x1,%eax
+  80200a:	8b 31                	mov    (%ecx),%esi
+  80200c:	89 34 83             	mov    %esi,(%ebx,%eax,4)
+  80200f:	8d 49 04             	lea    0x4(%ecx),%ecx
+  for (i = 0; i < argc; i++)
+  802012:	39 d0                	cmp    %edx,%eax
+  802014:	75 f1                	jne    802007 <spawnl+0x52>
+  return spawn(prog, argv);
+  802016:	83 ec 08             	sub    $0x8,%esp
+  802019:	53                   	push   %ebx
+  80201a:	ff 75 08             	push   0x8(%ebp)
+  80201d:	e8 2a fa ff ff       	call   801a4c <spawn>
+}
+  802022:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802025:	5b                   	pop    %ebx
+  802026:	5e                   	pop    %esi
+  802027:	5d                   	pop    %ebp
+  802028:	c3                   	ret
+
+00802029 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802029:	55                   	push   %ebp
+  80202a:	89 e5                	mov    %esp,%ebp
+  80202c:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  80202f:	68 c2 36 80 00       	push   $0x8036c2
+  802034:	ff 75 0c             	push   0xc(%ebp)
+  802037:	e8 4f e8 ff ff       	call   80088b <strcpy>
+	return 0;
+}
+  80203c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802041:	c9                   	leave
+  802042:	c3                   	ret
+
+00802043 <devsock_close>:
+{
+  802043:	55                   	push   %ebp
+  802044:	89 e5                	mov    %esp,%ebp
+  802046:	53                   	push   %ebx
+  802047:	83 ec 10             	sub    $0x10,%esp
+  80204a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  80204d:	53                   	push   %ebx
+  80204e:	e8 e3 0a 00 00       	call   802b36 <pageref>
+  802053:	89 c2                	mov    %eax,%edx
+  802055:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802058:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  80205d:	83 fa 01             	cmp    $0x1,%edx
+  802060:	74 05                	je     802067 <devsock_close+0x24>
+}
+  802062:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802065:	c9                   	leave
+  802066:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802067:	83 ec 0c             	sub    $0xc,%esp
+  80206a:	ff 73 0c             	push   0xc(%ebx)
+  80206d:	e8 b7 02 00 00       	call   802329 <nsipc_close>
+  802072:	83 c4 10             	add    $0x10,%esp
+  802075:	eb eb                	jmp    802062 <devsock_close+0x1f>
+
+00802077 <devsock_write>:
+{
+  802077:	55                   	push   %ebp
+  802078:	89 e5                	mov    %esp,%ebp
+  80207a:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  80207d:	6a 00                	push   $0x0
+  80207f:	ff 75 10             	push   0x10(%ebp)
+  802082:	ff 75 0c             	push   0xc(%ebp)
+  802085:	8b 45 08             	mov    0x8(%ebp),%eax
+  802088:	ff 70 0c             	push   0xc(%eax)
+  80208b:	e8 79 03 00 00       	call   802409 <nsipc_send>
+}
+  802090:	c9                   	leave
+  802091:	c3                   	ret
+
+00802092 <devsock_read>:
+{
+  802092:	55                   	push   %ebp
+  802093:	89 e5                	mov    %esp,%ebp
+  802095:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802098:	6a 00                	push   $0x0
+  80209a:	ff 75 10             	push   0x10(%ebp)
+  80209d:	ff 75 0c             	push   0xc(%ebp)
+  8020a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020a3:	ff 70 0c             	push   0xc(%eax)
+  8020a6:	e8 ef 02 00 00       	call   80239a <nsipc_recv>
+}
+  8020ab:	c9                   	leave
+  8020ac:	c3                   	ret
+
+008020ad <fd2sockid>:
+{
+  8020ad:	55                   	push   %ebp
+  8020ae:	89 e5                	mov    %esp,%ebp
+  8020b0:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8020b3:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8020b6:	52                   	push   %edx
+  8020b7:	50                   	push   %eax
+  8020b8:	e8 21 f2 ff ff       	call   8012de <fd_lookup>
+  8020bd:	83 c4 10             	add    $0x10,%esp
+  8020c0:	85 c0                	test   %eax,%eax
+  8020c2:	78 10                	js     8020d4 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8020c4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020c7:	8b 0d 28 40 80 00    	mov    0x804028,%ecx
+  8020cd:	39 08                	cmp    %ecx,(%eax)
+  8020cf:	75 05                	jne    8020d6 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8020d1:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8020d4:	c9                   	leave
+  8020d5:	c3                   	ret
+		return -E_NOT_SUPP;
+  8020d6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8020db:	eb f7                	jmp    8020d4 <fd2sockid+0x27>
+
+008020dd <alloc_sockfd>:
+{
+  8020dd:	55                   	push   %ebp
+  8020de:	89 e5                	mov    %esp,%ebp
+  8020e0:	56                   	push   %esi
+  8020e1:	53                   	push   %ebx
+  8020e2:	83 ec 1c             	sub    $0x1c,%esp
+  8020e5:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8020e7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020ea:	50                   	push   %eax
+  8020eb:	e8 98 f1 ff ff       	call   801288 <fd_alloc>
+  8020f0:	89 c3                	mov    %eax,%ebx
+  8020f2:	83 c4 10             	add    $0x10,%esp
+  8020f5:	85 c0                	test   %eax,%eax
+  8020f7:	78 43                	js     80213c <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8020f9:	83 ec 04             	sub    $0x4,%esp
+  8020fc:	68 07 04 00 00       	push   $0x407
+  802101:	ff 75 f4             	push   -0xc(%ebp)
+  802104:	6a 00                	push   $0x0
+  802106:	e8 6c eb ff ff       	call   800c77 <sys_page_alloc>
+  80210b:	89 c3                	mov    %eax,%ebx
+  80210d:	83 c4 10             	add    $0x10,%esp
+  802110:	85 c0                	test   %eax,%eax
+  802112:	78 28                	js     80213c <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802114:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802117:	8b 15 28 40 80 00    	mov    0x804028,%edx
+  80211d:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  80211f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802122:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802129:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  80212c:	83 ec 0c             	sub    $0xc,%esp
+  80212f:	50                   	push   %eax
+  802130:	e8 2c f1 ff ff       	call   801261 <fd2num>
+  802135:	89 c3                	mov    %eax,%ebx
+  802137:	83 c4 10             	add    $0x10,%esp
+  80213a:	eb 0c                	jmp    802148 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  80213c:	83 ec 0c             	sub    $0xc,%esp
+  80213f:	56                   	push   %esi
+  802140:	e8 e4 01 00 00       	call   802329 <nsipc_close>
+		return r;
+  802145:	83 c4 10             	add    $0x10,%esp
+}
+  802148:	89 d8                	mov    %ebx,%eax
+  80214a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80214d:	5b                   	pop    %ebx
+  80214e:	5e                   	pop    %esi
+  80214f:	5d                   	pop    %ebp
+  802150:	c3                   	ret
+
+00802151 <accept>:
+{
+  802151:	55                   	push   %ebp
+  802152:	89 e5                	mov    %esp,%ebp
+  802154:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802157:	8b 45 08             	mov    0x8(%ebp),%eax
+  80215a:	e8 4e ff ff ff       	call   8020ad <fd2sockid>
+  80215f:	85 c0                	test   %eax,%eax
+  802161:	78 1b                	js     80217e <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802163:	83 ec 04             	sub    $0x4,%esp
+  802166:	ff 75 10             	push   0x10(%ebp)
+  802169:	ff 75 0c             	push   0xc(%ebp)
+  80216c:	50                   	push   %eax
+  80216d:	e8 0e 01 00 00       	call   802280 <nsipc_accept>
+  802172:	83 c4 10             	add    $0x10,%esp
+  802175:	85 c0                	test   %eax,%eax
+  802177:	78 05                	js     80217e <accept+0x2d>
+	return alloc_sockfd(r);
+  802179:	e8 5f ff ff ff       	call   8020dd <alloc_sockfd>
+}
+  80217e:	c9                   	leave
+  80217f:	c3                   	ret
+
+00802180 <bind>:
+{
+  802180:	55                   	push   %ebp
+  802181:	89 e5                	mov    %esp,%ebp
+  802183:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802186:	8b 45 08             	mov    0x8(%ebp),%eax
+  802189:	e8 1f ff ff ff       	call   8020ad <fd2sockid>
+  80218e:	85 c0                	test   %eax,%eax
+  802190:	78 12                	js     8021a4 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802192:	83 ec 04             	sub    $0x4,%esp
+  802195:	ff 75 10             	push   0x10(%ebp)
+  802198:	ff 75 0c             	push   0xc(%ebp)
+  80219b:	50                   	push   %eax
+  80219c:	e8 31 01 00 00       	call   8022d2 <nsipc_bind>
+  8021a1:	83 c4 10             	add    $0x10,%esp
+}
+  8021a4:	c9                   	leave
+  8021a5:	c3                   	ret
+
+008021a6 <shutdown>:
+{
+  8021a6:	55                   	push   %ebp
+  8021a7:	89 e5                	mov    %esp,%ebp
+  8021a9:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8021ac:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021af:	e8 f9 fe ff ff       	call   8020ad <fd2sockid>
+  8021b4:	85 c0                	test   %eax,%eax
+  8021b6:	78 0f                	js     8021c7 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8021b8:	83 ec 08             	sub    $0x8,%esp
+  8021bb:	ff 75 0c             	push   0xc(%ebp)
+  8021be:	50                   	push   %eax
+  8021bf:	e8 43 01 00 00       	call   802307 <nsipc_shutdown>
+  8021c4:	83 c4 10             	add    $0x10,%esp
+}
+  8021c7:	c9                   	leave
+  8021c8:	c3                   	ret
+
+008021c9 <connect>:
+{
+  8021c9:	55                   	push   %ebp
+  8021ca:	89 e5                	mov    %esp,%ebp
+  8021cc:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8021cf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021d2:	e8 d6 fe ff ff       	call   8020ad <fd2sockid>
+  8021d7:	85 c0                	test   %eax,%eax
+  8021d9:	78 12                	js     8021ed <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8021db:	83 ec 04             	sub    $0x4,%esp
+  8021de:	ff 75 10             	push   0x10(%ebp)
+  8021e1:	ff 75 0c             	push   0xc(%ebp)
+  8021e4:	50                   	push   %eax
+  8021e5:	e8 59 01 00 00       	call   802343 <nsipc_connect>
+  8021ea:	83 c4 10             	add    $0x10,%esp
+}
+  8021ed:	c9                   	leave
+  8021ee:	c3                   	ret
+
+008021ef <listen>:
+{
+  8021ef:	55                   	push   %ebp
+  8021f0:	89 e5                	mov    %esp,%ebp
+  8021f2:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8021f5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021f8:	e8 b0 fe ff ff       	call   8020ad <fd2sockid>
+  8021fd:	85 c0                	test   %eax,%eax
+  8021ff:	78 0f                	js     802210 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802201:	83 ec 08             	sub    $0x8,%esp
+  802204:	ff 75 0c             	push   0xc(%ebp)
+  802207:	50                   	push   %eax
+  802208:	e8 6b 01 00 00       	call   802378 <nsipc_listen>
+  80220d:	83 c4 10             	add    $0x10,%esp
+}
+  802210:	c9                   	leave
+  802211:	c3                   	ret
+
+00802212 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802212:	55                   	push   %ebp
+  802213:	89 e5                	mov    %esp,%ebp
+  802215:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802218:	ff 75 10             	push   0x10(%ebp)
+  80221b:	ff 75 0c             	push   0xc(%ebp)
+  80221e:	ff 75 08             	push   0x8(%ebp)
+  802221:	e8 41 02 00 00       	call   802467 <nsipc_socket>
+  802226:	83 c4 10             	add    $0x10,%esp
+  802229:	85 c0                	test   %eax,%eax
+  80222b:	78 05                	js     802232 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  80222d:	e8 ab fe ff ff       	call   8020dd <alloc_sockfd>
+}
+  802232:	c9                   	leave
+  802233:	c3                   	ret
+
+00802234 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802234:	55                   	push   %ebp
+  802235:	89 e5                	mov    %esp,%ebp
+  802237:	53                   	push   %ebx
+  802238:	83 ec 04             	sub    $0x4,%esp
+  80223b:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  80223d:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  802244:	74 26                	je     80226c <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802246:	6a 07                	push   $0x7
+  802248:	68 00 70 80 00       	push   $0x807000
+  80224d:	53                   	push   %ebx
+  80224e:	ff 35 04 50 80 00    	push   0x805004
+  802254:	e8 4a 08 00 00       	call   802aa3 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802259:	83 c4 0c             	add    $0xc,%esp
+  80225c:	6a 00                	push   $0x0
+  80225e:	6a 00                	push   $0x0
+  802260:	6a 00                	push   $0x0
+  802262:	e8 c8 07 00 00       	call   802a2f <ipc_recv>
+}
+  802267:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80226a:	c9                   	leave
+  80226b:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80226c:	83 ec 0c             	sub    $0xc,%esp
+  80226f:	6a 02                	push   $0x2
+  802271:	e8 81 08 00 00       	call   802af7 <ipc_find_env>
+  802276:	a3 04 50 80 00       	mov    %eax,0x805004
+  80227b:	83 c4 10             	add    $0x10,%esp
+  80227e:	eb c6                	jmp    802246 <nsipc+0x12>
+
+00802280 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802280:	55                   	push   %ebp
+  802281:	89 e5                	mov    %esp,%ebp
+  802283:	56                   	push   %esi
+  802284:	53                   	push   %ebx
+  802285:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802288:	8b 45 08             	mov    0x8(%ebp),%eax
+  80228b:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802290:	8b 06                	mov    (%esi),%eax
+  802292:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802297:	b8 01 00 00 00       	mov    $0x1,%eax
+  80229c:	e8 93 ff ff ff       	call   802234 <nsipc>
+  8022a1:	89 c3                	mov    %eax,%ebx
+  8022a3:	85 c0                	test   %eax,%eax
+  8022a5:	79 09                	jns    8022b0 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8022a7:	89 d8                	mov    %ebx,%eax
+  8022a9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022ac:	5b                   	pop    %ebx
+  8022ad:	5e                   	pop    %esi
+  8022ae:	5d                   	pop    %ebp
+  8022af:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8022b0:	83 ec 04             	sub    $0x4,%esp
+  8022b3:	ff 35 10 70 80 00    	push   0x807010
+  8022b9:	68 00 70 80 00       	push   $0x807000
+  8022be:	ff 75 0c             	push   0xc(%ebp)
+  8022c1:	e8 4b e7 ff ff       	call   800a11 <memmove>
+		*addrlen = ret->ret_addrlen;
+  8022c6:	a1 10 70 80 00       	mov    0x807010,%eax
+  8022cb:	89 06                	mov    %eax,(%esi)
+  8022cd:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8022d0:	eb d5                	jmp    8022a7 <nsipc_accept+0x27>
+
+008022d2 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8022d2:	55                   	push   %ebp
+  8022d3:	89 e5                	mov    %esp,%ebp
+  8022d5:	53                   	push   %ebx
+  8022d6:	83 ec 08             	sub    $0x8,%esp
+  8022d9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8022dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022df:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8022e4:	53                   	push   %ebx
+  8022e5:	ff 75 0c             	push   0xc(%ebp)
+  8022e8:	68 04 70 80 00       	push   $0x807004
+  8022ed:	e8 1f e7 ff ff       	call   800a11 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8022f2:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  8022f8:	b8 02 00 00 00       	mov    $0x2,%eax
+  8022fd:	e8 32 ff ff ff       	call   802234 <nsipc>
+}
+  802302:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802305:	c9                   	leave
+  802306:	c3                   	ret
+
+00802307 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802307:	55                   	push   %ebp
+  802308:	89 e5                	mov    %esp,%ebp
+  80230a:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  80230d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802310:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  802315:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802318:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  80231d:	b8 03 00 00 00       	mov    $0x3,%eax
+  802322:	e8 0d ff ff ff       	call   802234 <nsipc>
+}
+  802327:	c9                   	leave
+  802328:	c3                   	ret
+
+00802329 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802329:	55                   	push   %ebp
+  80232a:	89 e5                	mov    %esp,%ebp
+  80232c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  80232f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802332:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  802337:	b8 04 00 00 00       	mov    $0x4,%eax
+  80233c:	e8 f3 fe ff ff       	call   802234 <nsipc>
+}
+  802341:	c9                   	leave
+  802342:	c3                   	ret
+
+00802343 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802343:	55                   	push   %ebp
+  802344:	89 e5                	mov    %esp,%ebp
+  802346:	53                   	push   %ebx
+  802347:	83 ec 08             	sub    $0x8,%esp
+  80234a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  80234d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802350:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802355:	53                   	push   %ebx
+  802356:	ff 75 0c             	push   0xc(%ebp)
+  802359:	68 04 70 80 00       	push   $0x807004
+  80235e:	e8 ae e6 ff ff       	call   800a11 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802363:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  802369:	b8 05 00 00 00       	mov    $0x5,%eax
+  80236e:	e8 c1 fe ff ff       	call   802234 <nsipc>
+}
+  802373:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802376:	c9                   	leave
+  802377:	c3                   	ret
+
+00802378 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802378:	55                   	push   %ebp
+  802379:	89 e5                	mov    %esp,%ebp
+  80237b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  80237e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802381:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  802386:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802389:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  80238e:	b8 06 00 00 00       	mov    $0x6,%eax
+  802393:	e8 9c fe ff ff       	call   802234 <nsipc>
+}
+  802398:	c9                   	leave
+  802399:	c3                   	ret
+
+0080239a <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  80239a:	55                   	push   %ebp
+  80239b:	89 e5                	mov    %esp,%ebp
+  80239d:	56                   	push   %esi
+  80239e:	53                   	push   %ebx
+  80239f:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8023a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023a5:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  8023aa:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  8023b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8023b3:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8023b8:	b8 07 00 00 00       	mov    $0x7,%eax
+  8023bd:	e8 72 fe ff ff       	call   802234 <nsipc>
+  8023c2:	89 c3                	mov    %eax,%ebx
+  8023c4:	85 c0                	test   %eax,%eax
+  8023c6:	78 22                	js     8023ea <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8023c8:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8023cd:	39 c6                	cmp    %eax,%esi
+  8023cf:	0f 4e c6             	cmovle %esi,%eax
+  8023d2:	39 c3                	cmp    %eax,%ebx
+  8023d4:	7f 1d                	jg     8023f3 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8023d6:	83 ec 04             	sub    $0x4,%esp
+  8023d9:	53                   	push   %ebx
+  8023da:	68 00 70 80 00       	push   $0x807000
+  8023df:	ff 75 0c             	push   0xc(%ebp)
+  8023e2:	e8 2a e6 ff ff       	call   800a11 <memmove>
+  8023e7:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8023ea:	89 d8                	mov    %ebx,%eax
+  8023ec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023ef:	5b                   	pop    %ebx
+  8023f0:	5e                   	pop    %esi
+  8023f1:	5d                   	pop    %ebp
+  8023f2:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8023f3:	68 ce 36 80 00       	push   $0x8036ce
+  8023f8:	68 d3 35 80 00       	push   $0x8035d3
+  8023fd:	6a 62                	push   $0x62
+  8023ff:	68 e3 36 80 00       	push   $0x8036e3
+  802404:	e8 ee dd ff ff       	call   8001f7 <_panic>
+
+00802409 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802409:	55                   	push   %ebp
+  80240a:	89 e5                	mov    %esp,%ebp
+  80240c:	53                   	push   %ebx
+  80240d:	83 ec 04             	sub    $0x4,%esp
+  802410:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802413:	8b 45 08             	mov    0x8(%ebp),%eax
+  802416:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  80241b:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802421:	7f 2e                	jg     802451 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802423:	83 ec 04             	sub    $0x4,%esp
+  802426:	53                   	push   %ebx
+  802427:	ff 75 0c             	push   0xc(%ebp)
+  80242a:	68 0c 70 80 00       	push   $0x80700c
+  80242f:	e8 dd e5 ff ff       	call   800a11 <memmove>
+	nsipcbuf.send.req_size = size;
+  802434:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  80243a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80243d:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  802442:	b8 08 00 00 00       	mov    $0x8,%eax
+  802447:	e8 e8 fd ff ff       	call   802234 <nsipc>
+}
+  80244c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80244f:	c9                   	leave
+  802450:	c3                   	ret
+	assert(size < 1600);
+  802451:	68 ef 36 80 00       	push   $0x8036ef
+  802456:	68 d3 35 80 00       	push   $0x8035d3
+  80245b:	6a 6d                	push   $0x6d
+  80245d:	68 e3 36 80 00       	push   $0x8036e3
+  802462:	e8 90 dd ff ff       	call   8001f7 <_panic>
+
+00802467 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802467:	55                   	push   %ebp
+  802468:	89 e5                	mov    %esp,%ebp
+  80246a:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  80246d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802470:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  802475:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802478:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  80247d:	8b 45 10             	mov    0x10(%ebp),%eax
+  802480:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  802485:	b8 09 00 00 00       	mov    $0x9,%eax
+  80248a:	e8 a5 fd ff ff       	call   802234 <nsipc>
+}
+  80248f:	c9                   	leave
+  802490:	c3                   	ret
+
+00802491 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802491:	55                   	push   %ebp
+  802492:	89 e5                	mov    %esp,%ebp
+  802494:	56                   	push   %esi
+  802495:	53                   	push   %ebx
+  802496:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802499:	83 ec 0c             	sub    $0xc,%esp
+  80249c:	ff 75 08             	push   0x8(%ebp)
+  80249f:	e8 cd ed ff ff       	call   801271 <fd2data>
+  8024a4:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8024a6:	83 c4 08             	add    $0x8,%esp
+  8024a9:	68 fb 36 80 00       	push   $0x8036fb
+  8024ae:	53                   	push   %ebx
+  8024af:	e8 d7 e3 ff ff       	call   80088b <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8024b4:	8b 46 04             	mov    0x4(%esi),%eax
+  8024b7:	2b 06                	sub    (%esi),%eax
+  8024b9:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8024bf:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8024c6:	00 00 00 
+	stat->st_dev = &devpipe;
+  8024c9:	c7 83 88 00 00 00 44 	movl   $0x804044,0x88(%ebx)
+  8024d0:	40 80 00 
+	return 0;
+}
+  8024d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024d8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024db:	5b                   	pop    %ebx
+  8024dc:	5e                   	pop    %esi
+  8024dd:	5d                   	pop    %ebp
+  8024de:	c3                   	ret
+
+008024df <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8024df:	55                   	push   %ebp
+  8024e0:	89 e5                	mov    %esp,%ebp
+  8024e2:	53                   	push   %ebx
+  8024e3:	83 ec 0c             	sub    $0xc,%esp
+  8024e6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8024e9:	53                   	push   %ebx
+  8024ea:	6a 00                	push   $0x0
+  8024ec:	e8 0b e8 ff ff       	call   800cfc <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8024f1:	89 1c 24             	mov    %ebx,(%esp)
+  8024f4:	e8 78 ed ff ff       	call   801271 <fd2data>
+  8024f9:	83 c4 08             	add    $0x8,%esp
+  8024fc:	50                   	push   %eax
+  8024fd:	6a 00                	push   $0x0
+  8024ff:	e8 f8 e7 ff ff       	call   800cfc <sys_page_unmap>
+}
+  802504:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802507:	c9                   	leave
+  802508:	c3                   	ret
+
+00802509 <_pipeisclosed>:
+{
+  802509:	55                   	push   %ebp
+  80250a:	89 e5                	mov    %esp,%ebp
+  80250c:	57                   	push   %edi
+  80250d:	56                   	push   %esi
+  80250e:	53                   	push   %ebx
+  80250f:	83 ec 1c             	sub    $0x1c,%esp
+  802512:	89 c7                	mov    %eax,%edi
+  802514:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  802516:	a1 08 50 80 00       	mov    0x805008,%eax
+  80251b:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  80251e:	83 ec 0c             	sub    $0xc,%esp
+  802521:	57                   	push   %edi
+  802522:	e8 0f 06 00 00       	call   802b36 <pageref>
+  802527:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80252a:	89 34 24             	mov    %esi,(%esp)
+  80252d:	e8 04 06 00 00       	call   802b36 <pageref>
+		nn = thisenv->env_runs;
+  802532:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  802538:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  80253b:	83 c4 10             	add    $0x10,%esp
+  80253e:	39 cb                	cmp    %ecx,%ebx
+  802540:	74 1b                	je     80255d <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802542:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802545:	75 cf                	jne    802516 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802547:	8b 42 58             	mov    0x58(%edx),%eax
+  80254a:	6a 01                	push   $0x1
+  80254c:	50                   	push   %eax
+  80254d:	53                   	push   %ebx
+  80254e:	68 02 37 80 00       	push   $0x803702
+  802553:	e8 7a dd ff ff       	call   8002d2 <cprintf>
+  802558:	83 c4 10             	add    $0x10,%esp
+  80255b:	eb b9                	jmp    802516 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  80255d:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802560:	0f 94 c0             	sete   %al
+  802563:	0f b6 c0             	movzbl %al,%eax
+}
+  802566:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802569:	5b                   	pop    %ebx
+  80256a:	5e                   	pop    %esi
+  80256b:	5f                   	pop    %edi
+  80256c:	5d                   	pop    %ebp
+  80256d:	c3                   	ret
+
+0080256e <devpipe_write>:
+{
+  80256e:	55                   	push   %ebp
+  80256f:	89 e5                	mov    %esp,%ebp
+  802571:	57                   	push   %edi
+  802572:	56                   	push   %esi
+  802573:	53                   	push   %ebx
+  802574:	83 ec 28             	sub    $0x28,%esp
+  802577:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  80257a:	56                   	push   %esi
+  80257b:	e8 f1 ec ff ff       	call   801271 <fd2data>
+  802580:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802582:	83 c4 10             	add    $0x10,%esp
+  802585:	bf 00 00 00 00       	mov    $0x0,%edi
+  80258a:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  80258d:	75 09                	jne    802598 <devpipe_write+0x2a>
+	return i;
+  80258f:	89 f8                	mov    %edi,%eax
+  802591:	eb 23                	jmp    8025b6 <devpipe_write+0x48>
+			sys_yield();
+  802593:	e8 c0 e6 ff ff       	call   800c58 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802598:	8b 43 04             	mov    0x4(%ebx),%eax
+  80259b:	8b 0b                	mov    (%ebx),%ecx
+  80259d:	8d 51 20             	lea    0x20(%ecx),%edx
+  8025a0:	39 d0                	cmp    %edx,%eax
+  8025a2:	72 1a                	jb     8025be <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8025a4:	89 da                	mov    %ebx,%edx
+  8025a6:	89 f0                	mov    %esi,%eax
+  8025a8:	e8 5c ff ff ff       	call   802509 <_pipeisclosed>
+  8025ad:	85 c0                	test   %eax,%eax
+  8025af:	74 e2                	je     802593 <devpipe_write+0x25>
+				return 0;
+  8025b1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025b6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025b9:	5b                   	pop    %ebx
+  8025ba:	5e                   	pop    %esi
+  8025bb:	5f                   	pop    %edi
+  8025bc:	5d                   	pop    %ebp
+  8025bd:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8025be:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8025c1:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8025c5:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8025c8:	89 c2                	mov    %eax,%edx
+  8025ca:	c1 fa 1f             	sar    $0x1f,%edx
+  8025cd:	89 d1                	mov    %edx,%ecx
+  8025cf:	c1 e9 1b             	shr    $0x1b,%ecx
+  8025d2:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8025d5:	83 e2 1f             	and    $0x1f,%edx
+  8025d8:	29 ca                	sub    %ecx,%edx
+  8025da:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8025de:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8025e2:	83 c0 01             	add    $0x1,%eax
+  8025e5:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8025e8:	83 c7 01             	add    $0x1,%edi
+  8025eb:	eb 9d                	jmp    80258a <devpipe_write+0x1c>
+
+008025ed <devpipe_read>:
+{
+  8025ed:	55                   	push   %ebp
+  8025ee:	89 e5                	mov    %esp,%ebp
+  8025f0:	57                   	push   %edi
+  8025f1:	56                   	push   %esi
+  8025f2:	53                   	push   %ebx
+  8025f3:	83 ec 18             	sub    $0x18,%esp
+  8025f6:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8025f9:	57                   	push   %edi
+  8025fa:	e8 72 ec ff ff       	call   801271 <fd2data>
+  8025ff:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802601:	83 c4 10             	add    $0x10,%esp
+  802604:	be 00 00 00 00       	mov    $0x0,%esi
+  802609:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80260c:	75 13                	jne    802621 <devpipe_read+0x34>
+	return i;
+  80260e:	89 f0                	mov    %esi,%eax
+  802610:	eb 02                	jmp    802614 <devpipe_read+0x27>
+				return i;
+  802612:	89 f0                	mov    %esi,%eax
+}
+  802614:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802617:	5b                   	pop    %ebx
+  802618:	5e                   	pop    %esi
+  802619:	5f                   	pop    %edi
+  80261a:	5d                   	pop    %ebp
+  80261b:	c3                   	ret
+			sys_yield();
+  80261c:	e8 37 e6 ff ff       	call   800c58 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802621:	8b 03                	mov    (%ebx),%eax
+  802623:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802626:	75 18                	jne    802640 <devpipe_read+0x53>
+			if (i > 0)
+  802628:	85 f6                	test   %esi,%esi
+  80262a:	75 e6                	jne    802612 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  80262c:	89 da                	mov    %ebx,%edx
+  80262e:	89 f8                	mov    %edi,%eax
+  802630:	e8 d4 fe ff ff       	call   802509 <_pipeisclosed>
+  802635:	85 c0                	test   %eax,%eax
+  802637:	74 e3                	je     80261c <devpipe_read+0x2f>
+				return 0;
+  802639:	b8 00 00 00 00       	mov    $0x0,%eax
+  80263e:	eb d4                	jmp    802614 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802640:	99                   	cltd
+  802641:	c1 ea 1b             	shr    $0x1b,%edx
+  802644:	01 d0                	add    %edx,%eax
+  802646:	83 e0 1f             	and    $0x1f,%eax
+  802649:	29 d0                	sub    %edx,%eax
+  80264b:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802650:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802653:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802656:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802659:	83 c6 01             	add    $0x1,%esi
+  80265c:	eb ab                	jmp    802609 <devpipe_read+0x1c>
+
+0080265e <pipe>:
+{
+  80265e:	55                   	push   %ebp
+  80265f:	89 e5                	mov    %esp,%ebp
+  802661:	56                   	push   %esi
+  802662:	53                   	push   %ebx
+  802663:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802666:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802669:	50                   	push   %eax
+  80266a:	e8 19 ec ff ff       	call   801288 <fd_alloc>
+  80266f:	89 c3                	mov    %eax,%ebx
+  802671:	83 c4 10             	add    $0x10,%esp
+  802674:	85 c0                	test   %eax,%eax
+  802676:	0f 88 23 01 00 00    	js     80279f <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80267c:	83 ec 04             	sub    $0x4,%esp
+  80267f:	68 07 04 00 00       	push   $0x407
+  802684:	ff 75 f4             	push   -0xc(%ebp)
+  802687:	6a 00                	push   $0x0
+  802689:	e8 e9 e5 ff ff       	call   800c77 <sys_page_alloc>
+  80268e:	89 c3                	mov    %eax,%ebx
+  802690:	83 c4 10             	add    $0x10,%esp
+  802693:	85 c0                	test   %eax,%eax
+  802695:	0f 88 04 01 00 00    	js     80279f <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80269b:	83 ec 0c             	sub    $0xc,%esp
+  80269e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8026a1:	50                   	push   %eax
+  8026a2:	e8 e1 eb ff ff       	call   801288 <fd_alloc>
+  8026a7:	89 c3                	mov    %eax,%ebx
+  8026a9:	83 c4 10             	add    $0x10,%esp
+  8026ac:	85 c0                	test   %eax,%eax
+  8026ae:	0f 88 db 00 00 00    	js     80278f <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8026b4:	83 ec 04             	sub    $0x4,%esp
+  8026b7:	68 07 04 00 00       	push   $0x407
+  8026bc:	ff 75 f0             	push   -0x10(%ebp)
+  8026bf:	6a 00                	push   $0x0
+  8026c1:	e8 b1 e5 ff ff       	call   800c77 <sys_page_alloc>
+  8026c6:	89 c3                	mov    %eax,%ebx
+  8026c8:	83 c4 10             	add    $0x10,%esp
+  8026cb:	85 c0                	test   %eax,%eax
+  8026cd:	0f 88 bc 00 00 00    	js     80278f <pipe+0x131>
+	va = fd2data(fd0);
+  8026d3:	83 ec 0c             	sub    $0xc,%esp
+  8026d6:	ff 75 f4             	push   -0xc(%ebp)
+  8026d9:	e8 93 eb ff ff       	call   801271 <fd2data>
+  8026de:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8026e0:	83 c4 0c             	add    $0xc,%esp
+  8026e3:	68 07 04 00 00       	push   $0x407
+  8026e8:	50                   	push   %eax
+  8026e9:	6a 00                	push   $0x0
+  8026eb:	e8 87 e5 ff ff       	call   800c77 <sys_page_alloc>
+  8026f0:	89 c3                	mov    %eax,%ebx
+  8026f2:	83 c4 10             	add    $0x10,%esp
+  8026f5:	85 c0                	test   %eax,%eax
+  8026f7:	0f 88 82 00 00 00    	js     80277f <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8026fd:	83 ec 0c             	sub    $0xc,%esp
+  802700:	ff 75 f0             	push   -0x10(%ebp)
+  802703:	e8 69 eb ff ff       	call   801271 <fd2data>
+  802708:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80270f:	50                   	push   %eax
+  802710:	6a 00                	push   $0x0
+  802712:	56                   	push   %esi
+  802713:	6a 00                	push   $0x0
+  802715:	e8 a0 e5 ff ff       	call   800cba <sys_page_map>
+  80271a:	89 c3                	mov    %eax,%ebx
+  80271c:	83 c4 20             	add    $0x20,%esp
+  80271f:	85 c0                	test   %eax,%eax
+  802721:	78 4e                	js     802771 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802723:	a1 44 40 80 00       	mov    0x804044,%eax
+  802728:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80272b:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80272d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802730:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802737:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80273a:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80273c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80273f:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802746:	83 ec 0c             	sub    $0xc,%esp
+  802749:	ff 75 f4             	push   -0xc(%ebp)
+  80274c:	e8 10 eb ff ff       	call   801261 <fd2num>
+  802751:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802754:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802756:	83 c4 04             	add    $0x4,%esp
+  802759:	ff 75 f0             	push   -0x10(%ebp)
+  80275c:	e8 00 eb ff ff       	call   801261 <fd2num>
+  802761:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802764:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802767:	83 c4 10             	add    $0x10,%esp
+  80276a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80276f:	eb 2e                	jmp    80279f <pipe+0x141>
+	sys_page_unmap(0, va);
+  802771:	83 ec 08             	sub    $0x8,%esp
+  802774:	56                   	push   %esi
+  802775:	6a 00                	push   $0x0
+  802777:	e8 80 e5 ff ff       	call   800cfc <sys_page_unmap>
+  80277c:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80277f:	83 ec 08             	sub    $0x8,%esp
+  802782:	ff 75 f0             	push   -0x10(%ebp)
+  802785:	6a 00                	push   $0x0
+  802787:	e8 70 e5 ff ff       	call   800cfc <sys_page_unmap>
+  80278c:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80278f:	83 ec 08             	sub    $0x8,%esp
+  802792:	ff 75 f4             	push   -0xc(%ebp)
+  802795:	6a 00                	push   $0x0
+  802797:	e8 60 e5 ff ff       	call   800cfc <sys_page_unmap>
+  80279c:	83 c4 10             	add    $0x10,%esp
+}
+  80279f:	89 d8                	mov    %ebx,%eax
+  8027a1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027a4:	5b                   	pop    %ebx
+  8027a5:	5e                   	pop    %esi
+  8027a6:	5d                   	pop    %ebp
+  8027a7:	c3                   	ret
+
+008027a8 <pipeisclosed>:
+{
+  8027a8:	55                   	push   %ebp
+  8027a9:	89 e5                	mov    %esp,%ebp
+  8027ab:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8027ae:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8027b1:	50                   	push   %eax
+  8027b2:	ff 75 08             	push   0x8(%ebp)
+  8027b5:	e8 24 eb ff ff       	call   8012de <fd_lookup>
+  8027ba:	83 c4 10             	add    $0x10,%esp
+  8027bd:	85 c0                	test   %eax,%eax
+  8027bf:	78 18                	js     8027d9 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8027c1:	83 ec 0c             	sub    $0xc,%esp
+  8027c4:	ff 75 f4             	push   -0xc(%ebp)
+  8027c7:	e8 a5 ea ff ff       	call   801271 <fd2data>
+  8027cc:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8027ce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027d1:	e8 33 fd ff ff       	call   802509 <_pipeisclosed>
+  8027d6:	83 c4 10             	add    $0x10,%esp
+}
+  8027d9:	c9                   	leave
+  8027da:	c3                   	ret
+
+008027db <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  8027db:	55                   	push   %ebp
+  8027dc:	89 e5                	mov    %esp,%ebp
+  8027de:	56                   	push   %esi
+  8027df:	53                   	push   %ebx
+  8027e0:	8b 75 08             	mov    0x8(%ebp),%esi
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  8027e3:	85 f6                	test   %esi,%esi
+  8027e5:	74 15                	je     8027fc <wait+0x21>
+	e = &envs[ENVX(envid)];
+  8027e7:	89 f0                	mov    %esi,%eax
+  8027e9:	25 ff 03 00 00       	and    $0x3ff,%eax
+
+    while (e->env_id == envid && e->env_status != ENV_FREE) {
+  8027ee:	8d 1c c0             	lea    (%eax,%eax,8),%ebx
+  8027f1:	c1 e3 04             	shl    $0x4,%ebx
+  8027f4:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  8027fa:	eb 1b                	jmp    802817 <wait+0x3c>
+	assert(envid != 0);
+  8027fc:	68 1a 37 80 00       	push   $0x80371a
+  802801:	68 d3 35 80 00       	push   $0x8035d3
+  802806:	6a 09                	push   $0x9
+  802808:	68 25 37 80 00       	push   $0x803725
+  80280d:	e8 e5 d9 ff ff       	call   8001f7 <_panic>
+        sys_yield();
+  802812:	e8 41 e4 ff ff       	call   800c58 <sys_yield>
+    while (e->env_id == envid && e->env_status != ENV_FREE) {
+  802817:	8b 43 48             	mov    0x48(%ebx),%eax
+  80281a:	39 f0                	cmp    %esi,%eax
+  80281c:	75 07                	jne    802825 <wait+0x4a>
+  80281e:	8b 43 54             	mov    0x54(%ebx),%eax
+  802821:	85 c0                	test   %eax,%eax
+  802823:	75 ed                	jne    802812 <wait+0x37>
+    }
+}
+  802825:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802828:	5b                   	pop    %ebx
+  802829:	5e                   	pop    %esi
+  80282a:	5d                   	pop    %ebp
+  80282b:	c3                   	ret
+
+0080282c <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80282c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802831:	c3                   	ret
+
+00802832 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802832:	55                   	push   %ebp
+  802833:	89 e5                	mov    %esp,%ebp
+  802835:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802838:	68 30 37 80 00       	push   $0x803730
+  80283d:	ff 75 0c             	push   0xc(%ebp)
+  802840:	e8 46 e0 ff ff       	call   80088b <strcpy>
+	return 0;
+}
+  802845:	b8 00 00 00 00       	mov    $0x0,%eax
+  80284a:	c9                   	leave
+  80284b:	c3                   	ret
+
+0080284c <devcons_write>:
+{
+  80284c:	55                   	push   %ebp
+  80284d:	89 e5                	mov    %esp,%ebp
+  80284f:	57                   	push   %edi
+  802850:	56                   	push   %esi
+  802851:	53                   	push   %ebx
+  802852:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802858:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80285d:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802863:	eb 2e                	jmp    802893 <devcons_write+0x47>
+		m = n - tot;
+  802865:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802868:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80286a:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80286f:	39 c3                	cmp    %eax,%ebx
+  802871:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802874:	83 ec 04             	sub    $0x4,%esp
+  802877:	53                   	push   %ebx
+  802878:	89 f0                	mov    %esi,%eax
+  80287a:	03 45 0c             	add    0xc(%ebp),%eax
+  80287d:	50                   	push   %eax
+  80287e:	57                   	push   %edi
+  80287f:	e8 8d e1 ff ff       	call   800a11 <memmove>
+		sys_cputs(buf, m);
+  802884:	83 c4 08             	add    $0x8,%esp
+  802887:	53                   	push   %ebx
+  802888:	57                   	push   %edi
+  802889:	e8 2d e3 ff ff       	call   800bbb <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80288e:	01 de                	add    %ebx,%esi
+  802890:	83 c4 10             	add    $0x10,%esp
+  802893:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802896:	72 cd                	jb     802865 <devcons_write+0x19>
+}
+  802898:	89 f0                	mov    %esi,%eax
+  80289a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80289d:	5b                   	pop    %ebx
+  80289e:	5e                   	pop    %esi
+  80289f:	5f                   	pop    %edi
+  8028a0:	5d                   	pop    %ebp
+  8028a1:	c3                   	ret
+
+008028a2 <devcons_read>:
+{
+  8028a2:	55                   	push   %ebp
+  8028a3:	89 e5                	mov    %esp,%ebp
+  8028a5:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8028a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028ad:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8028b1:	75 07                	jne    8028ba <devcons_read+0x18>
+  8028b3:	eb 1f                	jmp    8028d4 <devcons_read+0x32>
+		sys_yield();
+  8028b5:	e8 9e e3 ff ff       	call   800c58 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8028ba:	e8 1a e3 ff ff       	call   800bd9 <sys_cgetc>
+  8028bf:	85 c0                	test   %eax,%eax
+  8028c1:	74 f2                	je     8028b5 <devcons_read+0x13>
+	if (c < 0)
+  8028c3:	78 0f                	js     8028d4 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8028c5:	83 f8 04             	cmp    $0x4,%eax
+  8028c8:	74 0c                	je     8028d6 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8028ca:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8028cd:	88 02                	mov    %al,(%edx)
+	return 1;
+  8028cf:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8028d4:	c9                   	leave
+  8028d5:	c3                   	ret
+		return 0;
+  8028d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028db:	eb f7                	jmp    8028d4 <devcons_read+0x32>
+
+008028dd <cputchar>:
+{
+  8028dd:	55                   	push   %ebp
+  8028de:	89 e5                	mov    %esp,%ebp
+  8028e0:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8028e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028e6:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8028e9:	6a 01                	push   $0x1
+  8028eb:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8028ee:	50                   	push   %eax
+  8028ef:	e8 c7 e2 ff ff       	call   800bbb <sys_cputs>
+}
+  8028f4:	83 c4 10             	add    $0x10,%esp
+  8028f7:	c9                   	leave
+  8028f8:	c3                   	ret
+
+008028f9 <getchar>:
+{
+  8028f9:	55                   	push   %ebp
+  8028fa:	89 e5                	mov    %esp,%ebp
+  8028fc:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8028ff:	6a 01                	push   $0x1
+  802901:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802904:	50                   	push   %eax
+  802905:	6a 00                	push   $0x0
+  802907:	e8 38 ec ff ff       	call   801544 <read>
+	if (r < 0)
+  80290c:	83 c4 10             	add    $0x10,%esp
+  80290f:	85 c0                	test   %eax,%eax
+  802911:	78 06                	js     802919 <getchar+0x20>
+	if (r < 1)
+  802913:	74 06                	je     80291b <getchar+0x22>
+	return c;
+  802915:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802919:	c9                   	leave
+  80291a:	c3                   	ret
+		return -E_EOF;
+  80291b:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802920:	eb f7                	jmp    802919 <getchar+0x20>
+
+00802922 <iscons>:
+{
+  802922:	55                   	push   %ebp
+  802923:	89 e5                	mov    %esp,%ebp
+  802925:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802928:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80292b:	50                   	push   %eax
+  80292c:	ff 75 08             	push   0x8(%ebp)
+  80292f:	e8 aa e9 ff ff       	call   8012de <fd_lookup>
+  802934:	83 c4 10             	add    $0x10,%esp
+  802937:	85 c0                	test   %eax,%eax
+  802939:	78 11                	js     80294c <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80293b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80293e:	8b 15 60 40 80 00    	mov    0x804060,%edx
+  802944:	39 10                	cmp    %edx,(%eax)
+  802946:	0f 94 c0             	sete   %al
+  802949:	0f b6 c0             	movzbl %al,%eax
+}
+  80294c:	c9                   	leave
+  80294d:	c3                   	ret
+
+0080294e <opencons>:
+{
+  80294e:	55                   	push   %ebp
+  80294f:	89 e5                	mov    %esp,%ebp
+  802951:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802954:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802957:	50                   	push   %eax
+  802958:	e8 2b e9 ff ff       	call   801288 <fd_alloc>
+  80295d:	83 c4 10             	add    $0x10,%esp
+  802960:	85 c0                	test   %eax,%eax
+  802962:	78 3a                	js     80299e <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802964:	83 ec 04             	sub    $0x4,%esp
+  802967:	68 07 04 00 00       	push   $0x407
+  80296c:	ff 75 f4             	push   -0xc(%ebp)
+  80296f:	6a 00                	push   $0x0
+  802971:	e8 01 e3 ff ff       	call   800c77 <sys_page_alloc>
+  802976:	83 c4 10             	add    $0x10,%esp
+  802979:	85 c0                	test   %eax,%eax
+  80297b:	78 21                	js     80299e <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80297d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802980:	8b 15 60 40 80 00    	mov    0x804060,%edx
+  802986:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802988:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80298b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802992:	83 ec 0c             	sub    $0xc,%esp
+  802995:	50                   	push   %eax
+  802996:	e8 c6 e8 ff ff       	call   801261 <fd2num>
+  80299b:	83 c4 10             	add    $0x10,%esp
+}
+  80299e:	c9                   	leave
+  80299f:	c3                   	ret
+
+008029a0 <set_pgfault_handler>:
+// allocate an exception stack (one page of memory with its top
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf)) {
+  8029a0:	55                   	push   %ebp
+  8029a1:	89 e5                	mov    %esp,%ebp
+  8029a3:	83 ec 08             	sub    $0x8,%esp
+  int r;
+
+  if (_pgfault_handler == 0) {
+  8029a6:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  8029ad:	74 0a                	je     8029b9 <set_pgfault_handler+0x19>
+    if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)))
+      panic(" set_pgfault_handler sys_env_set_pgfault_upcall panic: %e\n", r);
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  8029af:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029b2:	a3 00 80 80 00       	mov    %eax,0x808000
+
+
+}
+  8029b7:	c9                   	leave
+  8029b8:	c3                   	ret
+    if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)))
+  8029b9:	83 ec 04             	sub    $0x4,%esp
+  8029bc:	6a 07                	push   $0x7
+  8029be:	68 00 f0 bf ee       	push   $0xeebff000
+  8029c3:	6a 00                	push   $0x0
+  8029c5:	e8 ad e2 ff ff       	call   800c77 <sys_page_alloc>
+  8029ca:	83 c4 10             	add    $0x10,%esp
+  8029cd:	85 c0                	test   %eax,%eax
+  8029cf:	75 28                	jne    8029f9 <set_pgfault_handler+0x59>
+    if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)))
+  8029d1:	83 ec 08             	sub    $0x8,%esp
+  8029d4:	68 0b 2a 80 00       	push   $0x802a0b
+  8029d9:	6a 00                	push   $0x0
+  8029db:	e8 e2 e3 ff ff       	call   800dc2 <sys_env_set_pgfault_upcall>
+  8029e0:	83 c4 10             	add    $0x10,%esp
+  8029e3:	85 c0                	test   %eax,%eax
+  8029e5:	74 c8                	je     8029af <set_pgfault_handler+0xf>
+      panic(" set_pgfault_handler sys_env_set_pgfault_upcall panic: %e\n", r);
+  8029e7:	50                   	push   %eax
+  8029e8:	68 6c 37 80 00       	push   $0x80376c
+  8029ed:	6a 22                	push   $0x22
+  8029ef:	68 a7 37 80 00       	push   $0x8037a7
+  8029f4:	e8 fe d7 ff ff       	call   8001f7 <_panic>
+      panic("set_pgfault_handler sys_page_alloc panic: %e\n", r);
+  8029f9:	50                   	push   %eax
+  8029fa:	68 3c 37 80 00       	push   $0x80373c
+  8029ff:	6a 20                	push   $0x20
+  802a01:	68 a7 37 80 00       	push   $0x8037a7
+  802a06:	e8 ec d7 ff ff       	call   8001f7 <_panic>
+
+00802a0b <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  802a0b:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  802a0c:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  802a11:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  802a13:	83 c4 04             	add    $0x4,%esp
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	// push the trap-time %eip onto the trap-time stack
+    subl $0x4, 0x30(%esp) # for push eip
+  802a16:	83 6c 24 30 04       	subl   $0x4,0x30(%esp)
+    movl 0x30(%esp), %ebx #regular esp
+  802a1b:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+    movl 0x28(%esp), %eax #eip
+  802a1f:	8b 44 24 28          	mov    0x28(%esp),%eax
+    movl %eax, (%ebx)
+  802a23:	89 03                	mov    %eax,(%ebx)
+
+    // Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+    addl $8, %esp
+  802a25:	83 c4 08             	add    $0x8,%esp
+    popal
+  802a28:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  802a29:	83 c4 04             	add    $0x4,%esp
+	popfl
+  802a2c:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  802a2d:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  802a2e:	c3                   	ret
+
+00802a2f <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  802a2f:	55                   	push   %ebp
+  802a30:	89 e5                	mov    %esp,%ebp
+  802a32:	56                   	push   %esi
+  802a33:	53                   	push   %ebx
+  802a34:	8b 75 08             	mov    0x8(%ebp),%esi
+  802a37:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a3a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  802a3d:	85 c0                	test   %eax,%eax
+  802a3f:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802a44:	0f 44 c2             	cmove  %edx,%eax
+  802a47:	83 ec 0c             	sub    $0xc,%esp
+  802a4a:	50                   	push   %eax
+  802a4b:	e8 d7 e3 ff ff       	call   800e27 <sys_ipc_recv>
+
+  if (from_env_store)
+  802a50:	83 c4 10             	add    $0x10,%esp
+  802a53:	85 f6                	test   %esi,%esi
+  802a55:	74 17                	je     802a6e <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  802a57:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a5c:	85 c0                	test   %eax,%eax
+  802a5e:	75 0c                	jne    802a6c <ipc_recv+0x3d>
+  802a60:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  802a66:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  802a6c:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  802a6e:	85 db                	test   %ebx,%ebx
+  802a70:	74 2b                	je     802a9d <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  802a72:	85 c0                	test   %eax,%eax
+  802a74:	74 0d                	je     802a83 <ipc_recv+0x54>
+  802a76:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  802a7c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a7f:	5b                   	pop    %ebx
+  802a80:	5e                   	pop    %esi
+  802a81:	5d                   	pop    %ebp
+  802a82:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  802a83:	a1 08 50 80 00       	mov    0x805008,%eax
+  802a88:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  802a8e:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  802a90:	a1 08 50 80 00       	mov    0x805008,%eax
+  802a95:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  802a9b:	eb df                	jmp    802a7c <ipc_recv+0x4d>
+  802a9d:	85 c0                	test   %eax,%eax
+  802a9f:	75 db                	jne    802a7c <ipc_recv+0x4d>
+  802aa1:	eb ed                	jmp    802a90 <ipc_recv+0x61>
+
+00802aa3 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  802aa3:	55                   	push   %ebp
+  802aa4:	89 e5                	mov    %esp,%ebp
+  802aa6:	57                   	push   %edi
+  802aa7:	56                   	push   %esi
+  802aa8:	53                   	push   %ebx
+  802aa9:	83 ec 0c             	sub    $0xc,%esp
+  802aac:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802aaf:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802ab2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  802ab5:	85 db                	test   %ebx,%ebx
+  802ab7:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802abc:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  802abf:	ff 75 14             	push   0x14(%ebp)
+  802ac2:	53                   	push   %ebx
+  802ac3:	56                   	push   %esi
+  802ac4:	57                   	push   %edi
+  802ac5:	e8 3a e3 ff ff       	call   800e04 <sys_ipc_try_send>
+  802aca:	83 c4 10             	add    $0x10,%esp
+  802acd:	85 c0                	test   %eax,%eax
+  802acf:	74 1e                	je     802aef <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  802ad1:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802ad4:	75 07                	jne    802add <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  802ad6:	e8 7d e1 ff ff       	call   800c58 <sys_yield>
+  802adb:	eb e2                	jmp    802abf <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  802add:	50                   	push   %eax
+  802ade:	68 b5 37 80 00       	push   $0x8037b5
+  802ae3:	6a 3c                	push   $0x3c
+  802ae5:	68 c2 37 80 00       	push   $0x8037c2
+  802aea:	e8 08 d7 ff ff       	call   8001f7 <_panic>
+  }
+
+#endif
+}
+  802aef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802af2:	5b                   	pop    %ebx
+  802af3:	5e                   	pop    %esi
+  802af4:	5f                   	pop    %edi
+  802af5:	5d                   	pop    %ebp
+  802af6:	c3                   	ret
+
+00802af7 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  802af7:	55                   	push   %ebp
+  802af8:	89 e5                	mov    %esp,%ebp
+  802afa:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  802afd:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  802b02:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802b05:	c1 e0 04             	shl    $0x4,%eax
+  802b08:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802b0d:	8b 40 50             	mov    0x50(%eax),%eax
+  802b10:	39 c8                	cmp    %ecx,%eax
+  802b12:	74 12                	je     802b26 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  802b14:	83 c2 01             	add    $0x1,%edx
+  802b17:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802b1d:	75 e3                	jne    802b02 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802b1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b24:	eb 0e                	jmp    802b34 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  802b26:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802b29:	c1 e0 04             	shl    $0x4,%eax
+  802b2c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802b31:	8b 40 48             	mov    0x48(%eax),%eax
+  802b34:	5d                   	pop    %ebp
+  802b35:	c3                   	ret
+
+00802b36 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802b36:	55                   	push   %ebp
+  802b37:	89 e5                	mov    %esp,%ebp
+  802b39:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802b3c:	89 c2                	mov    %eax,%edx
+  802b3e:	c1 ea 16             	shr    $0x16,%edx
+  802b41:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802b48:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802b4d:	f6 c1 01             	test   $0x1,%cl
+  802b50:	74 1c                	je     802b6e <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  802b52:	c1 e8 0c             	shr    $0xc,%eax
+  802b55:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802b5c:	a8 01                	test   $0x1,%al
+  802b5e:	74 0e                	je     802b6e <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802b60:	c1 e8 0c             	shr    $0xc,%eax
+  802b63:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802b6a:	ef 
+  802b6b:	0f b7 d2             	movzwl %dx,%edx
+}
+  802b6e:	89 d0                	mov    %edx,%eax
+  802b70:	5d                   	pop    %ebp
+  802b71:	c3                   	ret
+  802b72:	66 90                	xchg   %ax,%ax
+  802b74:	66 90                	xchg   %ax,%ax
+  802b76:	66 90                	xchg   %ax,%ax
+  802b78:	66 90                	xchg   %ax,%ax
+  802b7a:	66 90                	xchg   %ax,%ax
+  802b7c:	66 90                	xchg   %ax,%ax
+  802b7e:	66 90                	xchg   %ax,%ax
+
+00802b80 <__udivmoddi4>:
+  802b80:	55                   	push   %ebp
+  802b81:	57                   	push   %edi
+  802b82:	56                   	push   %esi
+  802b83:	53                   	push   %ebx
+  802b84:	83 ec 24             	sub    $0x24,%esp
+  802b87:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802b8b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802b8f:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  802b93:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802b97:	8b 54 24 44          	mov    0x44(%esp),%edx
+  802b9b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802b9f:	8b 44 24 40          	mov    0x40(%esp),%eax
+  802ba3:	89 d3                	mov    %edx,%ebx
+  802ba5:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802ba9:	09 c3                	or     %eax,%ebx
+  802bab:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802baf:	0f 84 9c 00 00 00    	je     802c51 <__udivmoddi4+0xd1>
+  802bb5:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802bbc:	00 
+  802bbd:	31 c0                	xor    %eax,%eax
+  802bbf:	31 d2                	xor    %edx,%edx
+  802bc1:	89 fb                	mov    %edi,%ebx
+  802bc3:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802bca:	00 
+  802bcb:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802bd0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802bd4:	01 c0                	add    %eax,%eax
+  802bd6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802bdd:	00 
+  802bde:	89 c6                	mov    %eax,%esi
+  802be0:	89 d7                	mov    %edx,%edi
+  802be2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802be6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  802bea:	0f ad d0             	shrd   %cl,%edx,%eax
+  802bed:	d3 ea                	shr    %cl,%edx
+  802bef:	f6 c1 20             	test   $0x20,%cl
+  802bf2:	0f 45 c2             	cmovne %edx,%eax
+  802bf5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802bf9:	83 e0 01             	and    $0x1,%eax
+  802bfc:	09 fa                	or     %edi,%edx
+  802bfe:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802c02:	89 04 24             	mov    %eax,(%esp)
+  802c05:	8b 04 24             	mov    (%esp),%eax
+  802c08:	89 d5                	mov    %edx,%ebp
+  802c0a:	09 f0                	or     %esi,%eax
+  802c0c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802c10:	39 f0                	cmp    %esi,%eax
+  802c12:	19 fd                	sbb    %edi,%ebp
+  802c14:	72 1d                	jb     802c33 <__udivmoddi4+0xb3>
+  802c16:	29 f0                	sub    %esi,%eax
+  802c18:	19 fa                	sbb    %edi,%edx
+  802c1a:	89 cf                	mov    %ecx,%edi
+  802c1c:	c1 ef 05             	shr    $0x5,%edi
+  802c1f:	83 e7 01             	and    $0x1,%edi
+  802c22:	89 fe                	mov    %edi,%esi
+  802c24:	d3 e7                	shl    %cl,%edi
+  802c26:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802c2a:	83 f6 01             	xor    $0x1,%esi
+  802c2d:	d3 e6                	shl    %cl,%esi
+  802c2f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802c33:	83 e9 01             	sub    $0x1,%ecx
+  802c36:	73 98                	jae    802bd0 <__udivmoddi4+0x50>
+  802c38:	85 db                	test   %ebx,%ebx
+  802c3a:	74 05                	je     802c41 <__udivmoddi4+0xc1>
+  802c3c:	89 03                	mov    %eax,(%ebx)
+  802c3e:	89 53 04             	mov    %edx,0x4(%ebx)
+  802c41:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802c45:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802c49:	83 c4 24             	add    $0x24,%esp
+  802c4c:	5b                   	pop    %ebx
+  802c4d:	5e                   	pop    %esi
+  802c4e:	5f                   	pop    %edi
+  802c4f:	5d                   	pop    %ebp
+  802c50:	c3                   	ret
+  802c51:	85 ff                	test   %edi,%edi
+  802c53:	74 0d                	je     802c62 <__udivmoddi4+0xe2>
+  802c55:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  802c5b:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  802c62:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802c66:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802c6a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  802c6e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802c72:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802c76:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802c7a:	83 c4 24             	add    $0x24,%esp
+  802c7d:	5b                   	pop    %ebx
+  802c7e:	5e                   	pop    %esi
+  802c7f:	5f                   	pop    %edi
+  802c80:	5d                   	pop    %ebp
+  802c81:	c3                   	ret
+  802c82:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802c89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00802c90 <__udivdi3>:
+  802c90:	57                   	push   %edi
+  802c91:	56                   	push   %esi
+  802c92:	53                   	push   %ebx
+  802c93:	83 ec 20             	sub    $0x20,%esp
+  802c96:	8b 54 24 34          	mov    0x34(%esp),%edx
+  802c9a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  802c9e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802ca2:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802ca6:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802caa:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802cae:	89 d1                	mov    %edx,%ecx
+  802cb0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802cb4:	09 c1                	or     %eax,%ecx
+  802cb6:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802cba:	89 44 24 18          	mov    %eax,0x18(%esp)
+  802cbe:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802cc2:	0f 84 88 00 00 00    	je     802d50 <__udivdi3+0xc0>
+  802cc8:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802ccf:	00 
+  802cd0:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802cd5:	31 c0                	xor    %eax,%eax
+  802cd7:	31 d2                	xor    %edx,%edx
+  802cd9:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802ce0:	00 
+  802ce1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802ce8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802cec:	01 c0                	add    %eax,%eax
+  802cee:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802cf5:	00 
+  802cf6:	89 c6                	mov    %eax,%esi
+  802cf8:	89 d7                	mov    %edx,%edi
+  802cfa:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802cfe:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802d02:	0f ad d0             	shrd   %cl,%edx,%eax
+  802d05:	d3 ea                	shr    %cl,%edx
+  802d07:	f6 c1 20             	test   $0x20,%cl
+  802d0a:	0f 45 c2             	cmovne %edx,%eax
+  802d0d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802d11:	83 e0 01             	and    $0x1,%eax
+  802d14:	09 fa                	or     %edi,%edx
+  802d16:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802d1a:	89 04 24             	mov    %eax,(%esp)
+  802d1d:	8b 04 24             	mov    (%esp),%eax
+  802d20:	89 d3                	mov    %edx,%ebx
+  802d22:	09 f0                	or     %esi,%eax
+  802d24:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802d28:	39 f0                	cmp    %esi,%eax
+  802d2a:	19 fb                	sbb    %edi,%ebx
+  802d2c:	72 1d                	jb     802d4b <__udivdi3+0xbb>
+  802d2e:	29 f0                	sub    %esi,%eax
+  802d30:	19 fa                	sbb    %edi,%edx
+  802d32:	89 cf                	mov    %ecx,%edi
+  802d34:	c1 ef 05             	shr    $0x5,%edi
+  802d37:	83 e7 01             	and    $0x1,%edi
+  802d3a:	89 fe                	mov    %edi,%esi
+  802d3c:	d3 e7                	shl    %cl,%edi
+  802d3e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802d42:	83 f6 01             	xor    $0x1,%esi
+  802d45:	d3 e6                	shl    %cl,%esi
+  802d47:	09 74 24 18          	or     %esi,0x18(%esp)
+  802d4b:	83 e9 01             	sub    $0x1,%ecx
+  802d4e:	73 98                	jae    802ce8 <__udivdi3+0x58>
+  802d50:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802d54:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802d58:	83 c4 20             	add    $0x20,%esp
+  802d5b:	5b                   	pop    %ebx
+  802d5c:	5e                   	pop    %esi
+  802d5d:	5f                   	pop    %edi
+  802d5e:	c3                   	ret
+  802d5f:	90                   	nop
+
+00802d60 <__umoddi3>:
+  802d60:	57                   	push   %edi
+  802d61:	56                   	push   %esi
+  802d62:	53                   	push   %ebx
+  802d63:	83 ec 18             	sub    $0x18,%esp
+  802d66:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802d6a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802d6e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802d72:	8b 54 24 34          	mov    0x34(%esp),%edx
+  802d76:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802d7a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  802d7e:	89 d1                	mov    %edx,%ecx
+  802d80:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802d84:	09 c1                	or     %eax,%ecx
+  802d86:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802d8a:	74 5b                	je     802de7 <__umoddi3+0x87>
+  802d8c:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802d91:	31 c0                	xor    %eax,%eax
+  802d93:	31 d2                	xor    %edx,%edx
+  802d95:	8d 76 00             	lea    0x0(%esi),%esi
+  802d98:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802d9c:	01 c0                	add    %eax,%eax
+  802d9e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802da5:	00 
+  802da6:	89 c6                	mov    %eax,%esi
+  802da8:	89 d7                	mov    %edx,%edi
+  802daa:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802dae:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802db2:	0f ad d0             	shrd   %cl,%edx,%eax
+  802db5:	d3 ea                	shr    %cl,%edx
+  802db7:	f6 c1 20             	test   $0x20,%cl
+  802dba:	0f 45 c2             	cmovne %edx,%eax
+  802dbd:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802dc1:	83 e0 01             	and    $0x1,%eax
+  802dc4:	09 fa                	or     %edi,%edx
+  802dc6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802dca:	89 04 24             	mov    %eax,(%esp)
+  802dcd:	8b 04 24             	mov    (%esp),%eax
+  802dd0:	89 d3                	mov    %edx,%ebx
+  802dd2:	09 f0                	or     %esi,%eax
+  802dd4:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802dd8:	39 f0                	cmp    %esi,%eax
+  802dda:	19 fb                	sbb    %edi,%ebx
+  802ddc:	72 04                	jb     802de2 <__umoddi3+0x82>
+  802dde:	29 f0                	sub    %esi,%eax
+  802de0:	19 fa                	sbb    %edi,%edx
+  802de2:	83 e9 01             	sub    $0x1,%ecx
+  802de5:	73 b1                	jae    802d98 <__umoddi3+0x38>
+  802de7:	83 c4 18             	add    $0x18,%esp
+  802dea:	5b                   	pop    %ebx
+  802deb:	5e                   	pop    %esi
+  802dec:	5f                   	pop    %edi
+  802ded:	c3                   	ret
+  802dee:	66 90                	xchg   %ax,%ax
+
+00802df0 <__divdi3>:
+  802df0:	55                   	push   %ebp
+  802df1:	57                   	push   %edi
+  802df2:	56                   	push   %esi
+  802df3:	53                   	push   %ebx
+  802df4:	83 ec 24             	sub    $0x24,%esp
+  802df7:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  802dfb:	8b 74 24 44          	mov    0x44(%esp),%esi
+  802dff:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802e03:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802e07:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  802e0b:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802e0f:	85 d2                	test   %edx,%edx
+  802e11:	0f 88 e0 00 00 00    	js     802ef7 <__divdi3+0x107>
+  802e17:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  802e1b:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  802e1f:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802e23:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802e27:	85 f6                	test   %esi,%esi
+  802e29:	78 16                	js     802e41 <__divdi3+0x51>
+  802e2b:	89 f1                	mov    %esi,%ecx
+  802e2d:	31 c0                	xor    %eax,%eax
+  802e2f:	31 d2                	xor    %edx,%edx
+  802e31:	09 d9                	or     %ebx,%ecx
+  802e33:	0f 85 f3 00 00 00    	jne    802f2c <__divdi3+0x13c>
+  802e39:	83 c4 24             	add    $0x24,%esp
+  802e3c:	5b                   	pop    %ebx
+  802e3d:	5e                   	pop    %esi
+  802e3e:	5f                   	pop    %edi
+  802e3f:	5d                   	pop    %ebp
+  802e40:	c3                   	ret
+  802e41:	bf 01 00 00 00       	mov    $0x1,%edi
+  802e46:	f7 5c 24 08          	negl   0x8(%esp)
+  802e4a:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  802e4f:	f7 5c 24 0c          	negl   0xc(%esp)
+  802e53:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802e5a:	00 
+  802e5b:	31 c0                	xor    %eax,%eax
+  802e5d:	31 d2                	xor    %edx,%edx
+  802e5f:	89 fb                	mov    %edi,%ebx
+  802e61:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802e68:	00 
+  802e69:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802e6e:	66 90                	xchg   %ax,%ax
+  802e70:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802e74:	01 c0                	add    %eax,%eax
+  802e76:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802e7d:	00 
+  802e7e:	89 c6                	mov    %eax,%esi
+  802e80:	89 d7                	mov    %edx,%edi
+  802e82:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802e86:	8b 54 24 14          	mov    0x14(%esp),%edx
+  802e8a:	0f ad d0             	shrd   %cl,%edx,%eax
+  802e8d:	d3 ea                	shr    %cl,%edx
+  802e8f:	f6 c1 20             	test   $0x20,%cl
+  802e92:	0f 45 c2             	cmovne %edx,%eax
+  802e95:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802e99:	83 e0 01             	and    $0x1,%eax
+  802e9c:	09 fa                	or     %edi,%edx
+  802e9e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802ea2:	89 04 24             	mov    %eax,(%esp)
+  802ea5:	8b 04 24             	mov    (%esp),%eax
+  802ea8:	89 d5                	mov    %edx,%ebp
+  802eaa:	09 f0                	or     %esi,%eax
+  802eac:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802eb0:	39 f0                	cmp    %esi,%eax
+  802eb2:	19 fd                	sbb    %edi,%ebp
+  802eb4:	72 1d                	jb     802ed3 <__divdi3+0xe3>
+  802eb6:	29 f0                	sub    %esi,%eax
+  802eb8:	19 fa                	sbb    %edi,%edx
+  802eba:	89 cf                	mov    %ecx,%edi
+  802ebc:	c1 ef 05             	shr    $0x5,%edi
+  802ebf:	83 e7 01             	and    $0x1,%edi
+  802ec2:	89 fe                	mov    %edi,%esi
+  802ec4:	d3 e7                	shl    %cl,%edi
+  802ec6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802eca:	83 f6 01             	xor    $0x1,%esi
+  802ecd:	d3 e6                	shl    %cl,%esi
+  802ecf:	09 74 24 18          	or     %esi,0x18(%esp)
+  802ed3:	83 e9 01             	sub    $0x1,%ecx
+  802ed6:	73 98                	jae    802e70 <__divdi3+0x80>
+  802ed8:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802edc:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802ee0:	85 db                	test   %ebx,%ebx
+  802ee2:	0f 84 51 ff ff ff    	je     802e39 <__divdi3+0x49>
+  802ee8:	f7 d8                	neg    %eax
+  802eea:	83 d2 00             	adc    $0x0,%edx
+  802eed:	83 c4 24             	add    $0x24,%esp
+  802ef0:	5b                   	pop    %ebx
+  802ef1:	f7 da                	neg    %edx
+  802ef3:	5e                   	pop    %esi
+  802ef4:	5f                   	pop    %edi
+  802ef5:	5d                   	pop    %ebp
+  802ef6:	c3                   	ret
+  802ef7:	f7 d8                	neg    %eax
+  802ef9:	83 d2 00             	adc    $0x0,%edx
+  802efc:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802f00:	f7 da                	neg    %edx
+  802f02:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802f06:	85 f6                	test   %esi,%esi
+  802f08:	78 1b                	js     802f25 <__divdi3+0x135>
+  802f0a:	89 f1                	mov    %esi,%ecx
+  802f0c:	31 c0                	xor    %eax,%eax
+  802f0e:	31 d2                	xor    %edx,%edx
+  802f10:	bf 01 00 00 00       	mov    $0x1,%edi
+  802f15:	09 d9                	or     %ebx,%ecx
+  802f17:	0f 85 36 ff ff ff    	jne    802e53 <__divdi3+0x63>
+  802f1d:	83 c4 24             	add    $0x24,%esp
+  802f20:	5b                   	pop    %ebx
+  802f21:	5e                   	pop    %esi
+  802f22:	5f                   	pop    %edi
+  802f23:	5d                   	pop    %ebp
+  802f24:	c3                   	ret
+  802f25:	31 ff                	xor    %edi,%edi
+  802f27:	e9 1a ff ff ff       	jmp    802e46 <__divdi3+0x56>
+  802f2c:	31 ff                	xor    %edi,%edi
+  802f2e:	e9 20 ff ff ff       	jmp    802e53 <__divdi3+0x63>
+  802f33:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802f3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00802f40 <__moddi3>:
+  802f40:	55                   	push   %ebp
+  802f41:	57                   	push   %edi
+  802f42:	56                   	push   %esi
+  802f43:	53                   	push   %ebx
+  802f44:	83 ec 1c             	sub    $0x1c,%esp
+  802f47:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  802f4b:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  802f4f:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  802f53:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  802f57:	89 c8                	mov    %ecx,%eax
+  802f59:	89 f2                	mov    %esi,%edx
+  802f5b:	89 f3                	mov    %esi,%ebx
+  802f5d:	85 ed                	test   %ebp,%ebp
+  802f5f:	0f 88 9d 00 00 00    	js     803002 <__moddi3+0xc2>
+  802f65:	09 cb                	or     %ecx,%ebx
+  802f67:	0f 84 8d 00 00 00    	je     802ffa <__moddi3+0xba>
+  802f6d:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802f71:	31 db                	xor    %ebx,%ebx
+  802f73:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  802f77:	89 ca                	mov    %ecx,%edx
+  802f79:	89 f0                	mov    %esi,%eax
+  802f7b:	89 dd                	mov    %ebx,%ebp
+  802f7d:	f7 da                	neg    %edx
+  802f7f:	83 d0 00             	adc    $0x0,%eax
+  802f82:	f7 d8                	neg    %eax
+  802f84:	0f 49 f0             	cmovns %eax,%esi
+  802f87:	0f 49 ca             	cmovns %edx,%ecx
+  802f8a:	31 c0                	xor    %eax,%eax
+  802f8c:	31 d2                	xor    %edx,%edx
+  802f8e:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802f92:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802f96:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802f9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  802f9f:	90                   	nop
+  802fa0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802fa4:	01 c0                	add    %eax,%eax
+  802fa6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802fad:	00 
+  802fae:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  802fb2:	89 c6                	mov    %eax,%esi
+  802fb4:	89 d7                	mov    %edx,%edi
+  802fb6:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802fba:	8b 54 24 14          	mov    0x14(%esp),%edx
+  802fbe:	0f ad d0             	shrd   %cl,%edx,%eax
+  802fc1:	d3 ea                	shr    %cl,%edx
+  802fc3:	f6 c1 20             	test   $0x20,%cl
+  802fc6:	0f 45 c2             	cmovne %edx,%eax
+  802fc9:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802fcd:	83 e0 01             	and    $0x1,%eax
+  802fd0:	09 fa                	or     %edi,%edx
+  802fd2:	89 04 24             	mov    %eax,(%esp)
+  802fd5:	8b 04 24             	mov    (%esp),%eax
+  802fd8:	89 d7                	mov    %edx,%edi
+  802fda:	09 f0                	or     %esi,%eax
+  802fdc:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  802fe0:	39 d8                	cmp    %ebx,%eax
+  802fe2:	19 f7                	sbb    %esi,%edi
+  802fe4:	72 04                	jb     802fea <__moddi3+0xaa>
+  802fe6:	29 d8                	sub    %ebx,%eax
+  802fe8:	19 f2                	sbb    %esi,%edx
+  802fea:	83 e9 01             	sub    $0x1,%ecx
+  802fed:	73 b1                	jae    802fa0 <__moddi3+0x60>
+  802fef:	85 ed                	test   %ebp,%ebp
+  802ff1:	74 07                	je     802ffa <__moddi3+0xba>
+  802ff3:	f7 d8                	neg    %eax
+  802ff5:	83 d2 00             	adc    $0x0,%edx
+  802ff8:	f7 da                	neg    %edx
+  802ffa:	83 c4 1c             	add    $0x1c,%esp
+  802ffd:	5b                   	pop    %ebx
+  802ffe:	5e                   	pop    %esi
+  802fff:	5f                   	pop    %edi
+  803000:	5d                   	pop    %ebp
+  803001:	c3                   	ret
+  803002:	09 cb                	or     %ecx,%ebx
+  803004:	74 f4                	je     802ffa <__moddi3+0xba>
+  803006:	f7 df                	neg    %edi
+  803008:	bb 01 00 00 00       	mov    $0x1,%ebx
+  80300d:	83 d5 00             	adc    $0x0,%ebp
+  803010:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  803014:	f7 dd                	neg    %ebp
+  803016:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  80301a:	e9 58 ff ff ff       	jmp    802f77 <__moddi3+0x37>
@@ -0,0 +1,6606 @@
+
+obj/user/testshell.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 54 04 00 00       	call   800485 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <wrong>:
+	breakpoint();
+}
+
+void
+wrong(int rfd, int kfd, int off)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	81 ec 84 00 00 00    	sub    $0x84,%esp
+  80003f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800042:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800045:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char buf[100];
+	int n;
+
+	seek(rfd, off);
+  800048:	53                   	push   %ebx
+  800049:	56                   	push   %esi
+  80004a:	e8 36 19 00 00       	call   801985 <seek>
+	seek(kfd, off);
+  80004f:	83 c4 08             	add    $0x8,%esp
+  800052:	53                   	push   %ebx
+  800053:	57                   	push   %edi
+  800054:	e8 2c 19 00 00       	call   801985 <seek>
+
+	cprintf("shell produced incorrect output.\n");
+  800059:	c7 04 24 a0 31 80 00 	movl   $0x8031a0,(%esp)
+  800060:	e8 5e 05 00 00       	call   8005c3 <cprintf>
+	cprintf("expected:\n===\n");
+  800065:	c7 04 24 0b 32 80 00 	movl   $0x80320b,(%esp)
+  80006c:	e8 52 05 00 00       	call   8005c3 <cprintf>
+	while ((n = read(kfd, buf, sizeof buf-1)) > 0)
+  800071:	83 c4 10             	add    $0x10,%esp
+  800074:	8d 5d 84             	lea    -0x7c(%ebp),%ebx
+  800077:	eb 0d                	jmp    800086 <wrong+0x53>
+		sys_cputs(buf, n);
+  800079:	83 ec 08             	sub    $0x8,%esp
+  80007c:	50                   	push   %eax
+  80007d:	53                   	push   %ebx
+  80007e:	e8 29 0e 00 00       	call   800eac <sys_cputs>
+  800083:	83 c4 10             	add    $0x10,%esp
+	while ((n = read(kfd, buf, sizeof buf-1)) > 0)
+  800086:	83 ec 04             	sub    $0x4,%esp
+  800089:	6a 63                	push   $0x63
+  80008b:	53                   	push   %ebx
+  80008c:	57                   	push   %edi
+  80008d:	e8 a3 17 00 00       	call   801835 <read>
+  800092:	83 c4 10             	add    $0x10,%esp
+  800095:	85 c0                	test   %eax,%eax
+  800097:	7f e0                	jg     800079 <wrong+0x46>
+	cprintf("===\ngot:\n===\n");
+  800099:	83 ec 0c             	sub    $0xc,%esp
+  80009c:	68 1a 32 80 00       	push   $0x80321a
+  8000a1:	e8 1d 05 00 00       	call   8005c3 <cprintf>
+	while ((n = read(rfd, buf, sizeof buf-1)) > 0)
+  8000a6:	83 c4 10             	add    $0x10,%esp
+  8000a9:	8d 5d 84             	lea    -0x7c(%ebp),%ebx
+  8000ac:	eb 0d                	jmp    8000bb <wrong+0x88>
+		sys_cputs(buf, n);
+  8000ae:	83 ec 08             	sub    $0x8,%esp
+  8000b1:	50                   	push   %eax
+  8000b2:	53                   	push   %ebx
+  8000b3:	e8 f4 0d 00 00       	call   800eac <sys_cputs>
+  8000b8:	83 c4 10             	add    $0x10,%esp
+	while ((n = read(rfd, buf, sizeof buf-1)) > 0)
+  8000bb:	83 ec 04             	sub    $0x4,%esp
+  8000be:	6a 63                	push   $0x63
+  8000c0:	53                   	push   %ebx
+  8000c1:	56                   	push   %esi
+  8000c2:	e8 6e 17 00 00       	call   801835 <read>
+  8000c7:	83 c4 10             	add    $0x10,%esp
+  8000ca:	85 c0                	test   %eax,%eax
+  8000cc:	7f e0                	jg     8000ae <wrong+0x7b>
+	cprintf("===\n");
+  8000ce:	83 ec 0c             	sub    $0xc,%esp
+  8000d1:	68 15 32 80 00       	push   $0x803215
+  8000d6:	e8 e8 04 00 00       	call   8005c3 <cprintf>
+	exit();
+  8000db:	e8 ee 03 00 00       	call   8004ce <exit>
+}
+  8000e0:	83 c4 10             	add    $0x10,%esp
+  8000e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000e6:	5b                   	pop    %ebx
+  8000e7:	5e                   	pop    %esi
+  8000e8:	5f                   	pop    %edi
+  8000e9:	5d                   	pop    %ebp
+  8000ea:	c3                   	ret
+
+008000eb <umain>:
+{
+  8000eb:	55                   	push   %ebp
+  8000ec:	89 e5                	mov    %esp,%ebp
+  8000ee:	57                   	push   %edi
+  8000ef:	56                   	push   %esi
+  8000f0:	53                   	push   %ebx
+  8000f1:	83 ec 38             	sub    $0x38,%esp
+	close(0);
+  8000f4:	6a 00                	push   $0x0
+  8000f6:	e8 fe 15 00 00       	call   8016f9 <close>
+	close(1);
+  8000fb:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  800102:	e8 f2 15 00 00       	call   8016f9 <close>
+	opencons();
+  800107:	e8 27 03 00 00       	call   800433 <opencons>
+	opencons();
+  80010c:	e8 22 03 00 00       	call   800433 <opencons>
+	if ((rfd = open("testshell.sh", O_RDONLY)) < 0)
+  800111:	83 c4 08             	add    $0x8,%esp
+  800114:	6a 00                	push   $0x0
+  800116:	68 28 32 80 00       	push   $0x803228
+  80011b:	e8 78 1b 00 00       	call   801c98 <open>
+  800120:	89 c3                	mov    %eax,%ebx
+  800122:	83 c4 10             	add    $0x10,%esp
+  800125:	85 c0                	test   %eax,%eax
+  800127:	0f 88 e7 00 00 00    	js     800214 <umain+0x129>
+	if ((wfd = pipe(pfds)) < 0)
+  80012d:	83 ec 0c             	sub    $0xc,%esp
+  800130:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  800133:	50                   	push   %eax
+  800134:	e8 16 28 00 00       	call   80294f <pipe>
+  800139:	83 c4 10             	add    $0x10,%esp
+  80013c:	85 c0                	test   %eax,%eax
+  80013e:	0f 88 e2 00 00 00    	js     800226 <umain+0x13b>
+	wfd = pfds[1];
+  800144:	8b 75 e0             	mov    -0x20(%ebp),%esi
+	cprintf("running sh -x < testshell.sh | cat\n");
+  800147:	83 ec 0c             	sub    $0xc,%esp
+  80014a:	68 c4 31 80 00       	push   $0x8031c4
+  80014f:	e8 6f 04 00 00       	call   8005c3 <cprintf>
+	if ((r = fork()) < 0)
+  800154:	e8 dd 11 00 00       	call   801336 <fork>
+  800159:	83 c4 10             	add    $0x10,%esp
+  80015c:	85 c0                	test   %eax,%eax
+  80015e:	0f 88 d4 00 00 00    	js     800238 <umain+0x14d>
+	if (r == 0) {
+  800164:	75 6f                	jne    8001d5 <umain+0xea>
+		dup(rfd, 0);
+  800166:	83 ec 08             	sub    $0x8,%esp
+  800169:	6a 00                	push   $0x0
+  80016b:	53                   	push   %ebx
+  80016c:	e8 da 15 00 00       	call   80174b <dup>
+		dup(wfd, 1);
+  800171:	83 c4 08             	add    $0x8,%esp
+  800174:	6a 01                	push   $0x1
+  800176:	56                   	push   %esi
+  800177:	e8 cf 15 00 00       	call   80174b <dup>
+		close(rfd);
+  80017c:	89 1c 24             	mov    %ebx,(%esp)
+  80017f:	e8 75 15 00 00       	call   8016f9 <close>
+		close(wfd);
+  800184:	89 34 24             	mov    %esi,(%esp)
+  800187:	e8 6d 15 00 00       	call   8016f9 <close>
+		if ((r = spawnl("/sh", "sh", "-x", 0)) < 0)
+  80018c:	6a 00                	push   $0x0
+  80018e:	68 6e 32 80 00       	push   $0x80326e
+  800193:	68 32 32 80 00       	push   $0x803232
+  800198:	68 71 32 80 00       	push   $0x803271
+  80019d:	e8 04 21 00 00       	call   8022a6 <spawnl>
+  8001a2:	89 c7                	mov    %eax,%edi
+  8001a4:	83 c4 20             	add    $0x20,%esp
+  8001a7:	85 c0                	test   %eax,%eax
+  8001a9:	0f 88 9b 00 00 00    	js     80024a <umain+0x15f>
+		close(0);
+  8001af:	83 ec 0c             	sub    $0xc,%esp
+  8001b2:	6a 00                	push   $0x0
+  8001b4:	e8 40 15 00 00       	call   8016f9 <close>
+		close(1);
+  8001b9:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  8001c0:	e8 34 15 00 00       	call   8016f9 <close>
+		wait(r);
+  8001c5:	89 3c 24             	mov    %edi,(%esp)
+  8001c8:	e8 ff 28 00 00       	call   802acc <wait>
+		exit();
+  8001cd:	e8 fc 02 00 00       	call   8004ce <exit>
+  8001d2:	83 c4 10             	add    $0x10,%esp
+	close(rfd);
+  8001d5:	83 ec 0c             	sub    $0xc,%esp
+  8001d8:	53                   	push   %ebx
+  8001d9:	e8 1b 15 00 00       	call   8016f9 <close>
+	close(wfd);
+  8001de:	89 34 24             	mov    %esi,(%esp)
+  8001e1:	e8 13 15 00 00       	call   8016f9 <close>
+	rfd = pfds[0];
+  8001e6:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8001e9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+	if ((kfd = open("testshell.key", O_RDONLY)) < 0)
+  8001ec:	83 c4 08             	add    $0x8,%esp
+  8001ef:	6a 00                	push   $0x0
+  8001f1:	68 7f 32 80 00       	push   $0x80327f
+  8001f6:	e8 9d 1a 00 00       	call   801c98 <open>
+  8001fb:	83 c4 10             	add    $0x10,%esp
+  8001fe:	85 c0                	test   %eax,%eax
+  800200:	78 5a                	js     80025c <umain+0x171>
+  800202:	be 01 00 00 00       	mov    $0x1,%esi
+	nloff = 0;
+  800207:	bf 00 00 00 00       	mov    $0x0,%edi
+		n2 = read(kfd, &c2, 1);
+  80020c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80020f:	e9 9a 00 00 00       	jmp    8002ae <umain+0x1c3>
+		panic("open testshell.sh: %e", rfd);
+  800214:	50                   	push   %eax
+  800215:	68 35 32 80 00       	push   $0x803235
+  80021a:	6a 13                	push   $0x13
+  80021c:	68 4b 32 80 00       	push   $0x80324b
+  800221:	e8 c2 02 00 00       	call   8004e8 <_panic>
+		panic("pipe: %e", wfd);
+  800226:	50                   	push   %eax
+  800227:	68 5c 32 80 00       	push   $0x80325c
+  80022c:	6a 15                	push   $0x15
+  80022e:	68 4b 32 80 00       	push   $0x80324b
+  800233:	e8 b0 02 00 00       	call   8004e8 <_panic>
+		panic("fork: %e", r);
+  800238:	50                   	push   %eax
+  800239:	68 65 32 80 00       	push   $0x803265
+  80023e:	6a 1a                	push   $0x1a
+  800240:	68 4b 32 80 00       	push   $0x80324b
+  800245:	e8 9e 02 00 00       	call   8004e8 <_panic>
+			panic("spawn: %e", r);
+  80024a:	50                   	push   %eax
+  80024b:	68 75 32 80 00       	push   $0x803275
+  800250:	6a 21                	push   $0x21
+  800252:	68 4b 32 80 00       	push   $0x80324b
+  800257:	e8 8c 02 00 00       	call   8004e8 <_panic>
+		panic("open testshell.key for reading: %e", kfd);
+  80025c:	50                   	push   %eax
+  80025d:	68 e8 31 80 00       	push   $0x8031e8
+  800262:	6a 2c                	push   $0x2c
+  800264:	68 4b 32 80 00       	push   $0x80324b
+  800269:	e8 7a 02 00 00       	call   8004e8 <_panic>
+			panic("reading testshell.out: %e", n1);
+  80026e:	53                   	push   %ebx
+  80026f:	68 8d 32 80 00       	push   $0x80328d
+  800274:	6a 33                	push   $0x33
+  800276:	68 4b 32 80 00       	push   $0x80324b
+  80027b:	e8 68 02 00 00       	call   8004e8 <_panic>
+			panic("reading testshell.key: %e", n2);
+  800280:	50                   	push   %eax
+  800281:	68 a7 32 80 00       	push   $0x8032a7
+  800286:	6a 35                	push   $0x35
+  800288:	68 4b 32 80 00       	push   $0x80324b
+  80028d:	e8 56 02 00 00       	call   8004e8 <_panic>
+			wrong(rfd, kfd, nloff);
+  800292:	83 ec 04             	sub    $0x4,%esp
+  800295:	57                   	push   %edi
+  800296:	ff 75 d0             	push   -0x30(%ebp)
+  800299:	ff 75 d4             	push   -0x2c(%ebp)
+  80029c:	e8 92 fd ff ff       	call   800033 <wrong>
+  8002a1:	83 c4 10             	add    $0x10,%esp
+			nloff = off+1;
+  8002a4:	80 7d e7 0a          	cmpb   $0xa,-0x19(%ebp)
+  8002a8:	0f 44 fe             	cmove  %esi,%edi
+	for (off=0;; off++) {
+  8002ab:	83 c6 01             	add    $0x1,%esi
+		n1 = read(rfd, &c1, 1);
+  8002ae:	83 ec 04             	sub    $0x4,%esp
+  8002b1:	6a 01                	push   $0x1
+  8002b3:	8d 45 e7             	lea    -0x19(%ebp),%eax
+  8002b6:	50                   	push   %eax
+  8002b7:	ff 75 d4             	push   -0x2c(%ebp)
+  8002ba:	e8 76 15 00 00       	call   801835 <read>
+  8002bf:	89 c3                	mov    %eax,%ebx
+		n2 = read(kfd, &c2, 1);
+  8002c1:	83 c4 0c             	add    $0xc,%esp
+  8002c4:	6a 01                	push   $0x1
+  8002c6:	8d 45 e6             	lea    -0x1a(%ebp),%eax
+  8002c9:	50                   	push   %eax
+  8002ca:	ff 75 d0             	push   -0x30(%ebp)
+  8002cd:	e8 63 15 00 00       	call   801835 <read>
+		if (n1 < 0)
+  8002d2:	83 c4 10             	add    $0x10,%esp
+  8002d5:	85 db                	test   %ebx,%ebx
+  8002d7:	78 95                	js     80026e <umain+0x183>
+		if (n2 < 0)
+  8002d9:	85 c0                	test   %eax,%eax
+  8002db:	78 a3                	js     800280 <umain+0x195>
+		if (n1 == 0 && n2 == 0)
+  8002dd:	89 d9                	mov    %ebx,%ecx
+  8002df:	09 c1                	or     %eax,%ecx
+  8002e1:	74 15                	je     8002f8 <umain+0x20d>
+		if (n1 != 1 || n2 != 1 || c1 != c2)
+  8002e3:	83 fb 01             	cmp    $0x1,%ebx
+  8002e6:	75 aa                	jne    800292 <umain+0x1a7>
+  8002e8:	83 f8 01             	cmp    $0x1,%eax
+  8002eb:	75 a5                	jne    800292 <umain+0x1a7>
+  8002ed:	0f b6 45 e6          	movzbl -0x1a(%ebp),%eax
+  8002f1:	38 45 e7             	cmp    %al,-0x19(%ebp)
+  8002f4:	75 9c                	jne    800292 <umain+0x1a7>
+  8002f6:	eb ac                	jmp    8002a4 <umain+0x1b9>
+	cprintf("shell ran correctly\n");
+  8002f8:	83 ec 0c             	sub    $0xc,%esp
+  8002fb:	68 c1 32 80 00       	push   $0x8032c1
+  800300:	e8 be 02 00 00       	call   8005c3 <cprintf>
+#include <inc/types.h>
+
+static inline void
+breakpoint(void)
+{
+	asm volatile("int3");
+  800305:	cc                   	int3
+}
+  800306:	83 c4 10             	add    $0x10,%esp
+  800309:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80030c:	5b                   	pop    %ebx
+  80030d:	5e                   	pop    %esi
+  80030e:	5f                   	pop    %edi
+  80030f:	5d                   	pop    %ebp
+  800310:	c3                   	ret
+
+00800311 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  800311:	b8 00 00 00 00       	mov    $0x0,%eax
+  800316:	c3                   	ret
+
+00800317 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  800317:	55                   	push   %ebp
+  800318:	89 e5                	mov    %esp,%ebp
+  80031a:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80031d:	68 d6 32 80 00       	push   $0x8032d6
+  800322:	ff 75 0c             	push   0xc(%ebp)
+  800325:	e8 52 08 00 00       	call   800b7c <strcpy>
+	return 0;
+}
+  80032a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80032f:	c9                   	leave
+  800330:	c3                   	ret
+
+00800331 <devcons_write>:
+{
+  800331:	55                   	push   %ebp
+  800332:	89 e5                	mov    %esp,%ebp
+  800334:	57                   	push   %edi
+  800335:	56                   	push   %esi
+  800336:	53                   	push   %ebx
+  800337:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80033d:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  800342:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  800348:	eb 2e                	jmp    800378 <devcons_write+0x47>
+		m = n - tot;
+  80034a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80034d:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80034f:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  800354:	39 c3                	cmp    %eax,%ebx
+  800356:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  800359:	83 ec 04             	sub    $0x4,%esp
+  80035c:	53                   	push   %ebx
+  80035d:	89 f0                	mov    %esi,%eax
+  80035f:	03 45 0c             	add    0xc(%ebp),%eax
+  800362:	50                   	push   %eax
+  800363:	57                   	push   %edi
+  800364:	e8 99 09 00 00       	call   800d02 <memmove>
+		sys_cputs(buf, m);
+  800369:	83 c4 08             	add    $0x8,%esp
+  80036c:	53                   	push   %ebx
+  80036d:	57                   	push   %edi
+  80036e:	e8 39 0b 00 00       	call   800eac <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  800373:	01 de                	add    %ebx,%esi
+  800375:	83 c4 10             	add    $0x10,%esp
+  800378:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80037b:	72 cd                	jb     80034a <devcons_write+0x19>
+}
+  80037d:	89 f0                	mov    %esi,%eax
+  80037f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800382:	5b                   	pop    %ebx
+  800383:	5e                   	pop    %esi
+  800384:	5f                   	pop    %edi
+  800385:	5d                   	pop    %ebp
+  800386:	c3                   	ret
+
+00800387 <devcons_read>:
+{
+  800387:	55                   	push   %ebp
+  800388:	89 e5                	mov    %esp,%ebp
+  80038a:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80038d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800392:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  800396:	75 07                	jne    80039f <devcons_read+0x18>
+  800398:	eb 1f                	jmp    8003b9 <devcons_read+0x32>
+		sys_yield();
+  80039a:	e8 aa 0b 00 00       	call   800f49 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80039f:	e8 26 0b 00 00       	call   800eca <sys_cgetc>
+  8003a4:	85 c0                	test   %eax,%eax
+  8003a6:	74 f2                	je     80039a <devcons_read+0x13>
+	if (c < 0)
+  8003a8:	78 0f                	js     8003b9 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8003aa:	83 f8 04             	cmp    $0x4,%eax
+  8003ad:	74 0c                	je     8003bb <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8003af:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8003b2:	88 02                	mov    %al,(%edx)
+	return 1;
+  8003b4:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8003b9:	c9                   	leave
+  8003ba:	c3                   	ret
+		return 0;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003c0:	eb f7                	jmp    8003b9 <devcons_read+0x32>
+
+008003c2 <cputchar>:
+{
+  8003c2:	55                   	push   %ebp
+  8003c3:	89 e5                	mov    %esp,%ebp
+  8003c5:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8003c8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003cb:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8003ce:	6a 01                	push   $0x1
+  8003d0:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8003d3:	50                   	push   %eax
+  8003d4:	e8 d3 0a 00 00       	call   800eac <sys_cputs>
+}
+  8003d9:	83 c4 10             	add    $0x10,%esp
+  8003dc:	c9                   	leave
+  8003dd:	c3                   	ret
+
+008003de <getchar>:
+{
+  8003de:	55                   	push   %ebp
+  8003df:	89 e5                	mov    %esp,%ebp
+  8003e1:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8003e4:	6a 01                	push   $0x1
+  8003e6:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8003e9:	50                   	push   %eax
+  8003ea:	6a 00                	push   $0x0
+  8003ec:	e8 44 14 00 00       	call   801835 <read>
+	if (r < 0)
+  8003f1:	83 c4 10             	add    $0x10,%esp
+  8003f4:	85 c0                	test   %eax,%eax
+  8003f6:	78 06                	js     8003fe <getchar+0x20>
+	if (r < 1)
+  8003f8:	74 06                	je     800400 <getchar+0x22>
+	return c;
+  8003fa:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8003fe:	c9                   	leave
+  8003ff:	c3                   	ret
+		return -E_EOF;
+  800400:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  800405:	eb f7                	jmp    8003fe <getchar+0x20>
+
+00800407 <iscons>:
+{
+  800407:	55                   	push   %ebp
+  800408:	89 e5                	mov    %esp,%ebp
+  80040a:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80040d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800410:	50                   	push   %eax
+  800411:	ff 75 08             	push   0x8(%ebp)
+  800414:	e8 b6 11 00 00       	call   8015cf <fd_lookup>
+  800419:	83 c4 10             	add    $0x10,%esp
+  80041c:	85 c0                	test   %eax,%eax
+  80041e:	78 11                	js     800431 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  800420:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800423:	8b 15 00 40 80 00    	mov    0x804000,%edx
+  800429:	39 10                	cmp    %edx,(%eax)
+  80042b:	0f 94 c0             	sete   %al
+  80042e:	0f b6 c0             	movzbl %al,%eax
+}
+  800431:	c9                   	leave
+  800432:	c3                   	ret
+
+00800433 <opencons>:
+{
+  800433:	55                   	push   %ebp
+  800434:	89 e5                	mov    %esp,%ebp
+  800436:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  800439:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80043c:	50                   	push   %eax
+  80043d:	e8 37 11 00 00       	call   801579 <fd_alloc>
+  800442:	83 c4 10             	add    $0x10,%esp
+  800445:	85 c0                	test   %eax,%eax
+  800447:	78 3a                	js     800483 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  800449:	83 ec 04             	sub    $0x4,%esp
+  80044c:	68 07 04 00 00       	push   $0x407
+  800451:	ff 75 f4             	push   -0xc(%ebp)
+  800454:	6a 00                	push   $0x0
+  800456:	e8 0d 0b 00 00       	call   800f68 <sys_page_alloc>
+  80045b:	83 c4 10             	add    $0x10,%esp
+  80045e:	85 c0                	test   %eax,%eax
+  800460:	78 21                	js     800483 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  800462:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800465:	8b 15 00 40 80 00    	mov    0x804000,%edx
+  80046b:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80046d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800470:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  800477:	83 ec 0c             	sub    $0xc,%esp
+  80047a:	50                   	push   %eax
+  80047b:	e8 d2 10 00 00       	call   801552 <fd2num>
+  800480:	83 c4 10             	add    $0x10,%esp
+}
+  800483:	c9                   	leave
+  800484:	c3                   	ret
+
+00800485 <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  800485:	55                   	push   %ebp
+  800486:	89 e5                	mov    %esp,%ebp
+  800488:	56                   	push   %esi
+  800489:	53                   	push   %ebx
+  80048a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80048d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  800490:	e8 95 0a 00 00       	call   800f2a <sys_getenvid>
+  800495:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80049a:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80049d:	c1 e0 04             	shl    $0x4,%eax
+  8004a0:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8004a5:	a3 08 50 80 00       	mov    %eax,0x805008
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8004aa:	85 db                	test   %ebx,%ebx
+  8004ac:	7e 07                	jle    8004b5 <libmain+0x30>
+    binaryname = argv[0];
+  8004ae:	8b 06                	mov    (%esi),%eax
+  8004b0:	a3 1c 40 80 00       	mov    %eax,0x80401c
+
+  // call user main routine
+  umain(argc, argv);
+  8004b5:	83 ec 08             	sub    $0x8,%esp
+  8004b8:	56                   	push   %esi
+  8004b9:	53                   	push   %ebx
+  8004ba:	e8 2c fc ff ff       	call   8000eb <umain>
+
+  // exit gracefully
+  exit();
+  8004bf:	e8 0a 00 00 00       	call   8004ce <exit>
+}
+  8004c4:	83 c4 10             	add    $0x10,%esp
+  8004c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8004ca:	5b                   	pop    %ebx
+  8004cb:	5e                   	pop    %esi
+  8004cc:	5d                   	pop    %ebp
+  8004cd:	c3                   	ret
+
+008004ce <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8004ce:	55                   	push   %ebp
+  8004cf:	89 e5                	mov    %esp,%ebp
+  8004d1:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8004d4:	e8 4d 12 00 00       	call   801726 <close_all>
+	sys_env_destroy(0);
+  8004d9:	83 ec 0c             	sub    $0xc,%esp
+  8004dc:	6a 00                	push   $0x0
+  8004de:	e8 06 0a 00 00       	call   800ee9 <sys_env_destroy>
+}
+  8004e3:	83 c4 10             	add    $0x10,%esp
+  8004e6:	c9                   	leave
+  8004e7:	c3                   	ret
+
+008004e8 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8004e8:	55                   	push   %ebp
+  8004e9:	89 e5                	mov    %esp,%ebp
+  8004eb:	56                   	push   %esi
+  8004ec:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8004ed:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8004f0:	8b 35 1c 40 80 00    	mov    0x80401c,%esi
+  8004f6:	e8 2f 0a 00 00       	call   800f2a <sys_getenvid>
+  8004fb:	83 ec 0c             	sub    $0xc,%esp
+  8004fe:	ff 75 0c             	push   0xc(%ebp)
+  800501:	ff 75 08             	push   0x8(%ebp)
+  800504:	56                   	push   %esi
+  800505:	50                   	push   %eax
+  800506:	68 ec 32 80 00       	push   $0x8032ec
+  80050b:	e8 b3 00 00 00       	call   8005c3 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800510:	83 c4 18             	add    $0x18,%esp
+  800513:	53                   	push   %ebx
+  800514:	ff 75 10             	push   0x10(%ebp)
+  800517:	e8 56 00 00 00       	call   800572 <vcprintf>
+	cprintf("\n");
+  80051c:	c7 04 24 18 32 80 00 	movl   $0x803218,(%esp)
+  800523:	e8 9b 00 00 00       	call   8005c3 <cprintf>
+  800528:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80052b:	cc                   	int3
+	while (1)
+  80052c:	eb fd                	jmp    80052b <_panic+0x43>
+
+0080052e <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80052e:	55                   	push   %ebp
+  80052f:	89 e5                	mov    %esp,%ebp
+  800531:	53                   	push   %ebx
+  800532:	83 ec 04             	sub    $0x4,%esp
+  800535:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800538:	8b 13                	mov    (%ebx),%edx
+  80053a:	8d 42 01             	lea    0x1(%edx),%eax
+  80053d:	89 03                	mov    %eax,(%ebx)
+  80053f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800542:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800546:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80054b:	74 09                	je     800556 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80054d:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800551:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800554:	c9                   	leave
+  800555:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800556:	83 ec 08             	sub    $0x8,%esp
+  800559:	68 ff 00 00 00       	push   $0xff
+  80055e:	8d 43 08             	lea    0x8(%ebx),%eax
+  800561:	50                   	push   %eax
+  800562:	e8 45 09 00 00       	call   800eac <sys_cputs>
+		b->idx = 0;
+  800567:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80056d:	83 c4 10             	add    $0x10,%esp
+  800570:	eb db                	jmp    80054d <putch+0x1f>
+
+00800572 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800572:	55                   	push   %ebp
+  800573:	89 e5                	mov    %esp,%ebp
+  800575:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80057b:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800582:	00 00 00 
+	b.cnt = 0;
+  800585:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80058c:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80058f:	ff 75 0c             	push   0xc(%ebp)
+  800592:	ff 75 08             	push   0x8(%ebp)
+  800595:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80059b:	50                   	push   %eax
+  80059c:	68 2e 05 80 00       	push   $0x80052e
+  8005a1:	e8 14 01 00 00       	call   8006ba <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8005a6:	83 c4 08             	add    $0x8,%esp
+  8005a9:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8005af:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8005b5:	50                   	push   %eax
+  8005b6:	e8 f1 08 00 00       	call   800eac <sys_cputs>
+
+	return b.cnt;
+}
+  8005bb:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8005c1:	c9                   	leave
+  8005c2:	c3                   	ret
+
+008005c3 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8005c3:	55                   	push   %ebp
+  8005c4:	89 e5                	mov    %esp,%ebp
+  8005c6:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8005c9:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8005cc:	50                   	push   %eax
+  8005cd:	ff 75 08             	push   0x8(%ebp)
+  8005d0:	e8 9d ff ff ff       	call   800572 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8005d5:	c9                   	leave
+  8005d6:	c3                   	ret
+
+008005d7 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8005d7:	55                   	push   %ebp
+  8005d8:	89 e5                	mov    %esp,%ebp
+  8005da:	57                   	push   %edi
+  8005db:	56                   	push   %esi
+  8005dc:	53                   	push   %ebx
+  8005dd:	83 ec 1c             	sub    $0x1c,%esp
+  8005e0:	89 c7                	mov    %eax,%edi
+  8005e2:	89 d6                	mov    %edx,%esi
+  8005e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8005e7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8005ea:	89 d1                	mov    %edx,%ecx
+  8005ec:	89 c2                	mov    %eax,%edx
+  8005ee:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005f1:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005f4:	8b 45 10             	mov    0x10(%ebp),%eax
+  8005f7:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8005fa:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005fd:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800604:	39 c2                	cmp    %eax,%edx
+  800606:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800609:	72 3e                	jb     800649 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80060b:	83 ec 0c             	sub    $0xc,%esp
+  80060e:	ff 75 18             	push   0x18(%ebp)
+  800611:	83 eb 01             	sub    $0x1,%ebx
+  800614:	53                   	push   %ebx
+  800615:	50                   	push   %eax
+  800616:	83 ec 08             	sub    $0x8,%esp
+  800619:	ff 75 e4             	push   -0x1c(%ebp)
+  80061c:	ff 75 e0             	push   -0x20(%ebp)
+  80061f:	ff 75 dc             	push   -0x24(%ebp)
+  800622:	ff 75 d8             	push   -0x28(%ebp)
+  800625:	e8 d6 27 00 00       	call   802e00 <__udivdi3>
+  80062a:	83 c4 18             	add    $0x18,%esp
+  80062d:	52                   	push   %edx
+  80062e:	50                   	push   %eax
+  80062f:	89 f2                	mov    %esi,%edx
+  800631:	89 f8                	mov    %edi,%eax
+  800633:	e8 9f ff ff ff       	call   8005d7 <printnum>
+  800638:	83 c4 20             	add    $0x20,%esp
+  80063b:	eb 13                	jmp    800650 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80063d:	83 ec 08             	sub    $0x8,%esp
+  800640:	56                   	push   %esi
+  800641:	ff 75 18             	push   0x18(%ebp)
+  800644:	ff d7                	call   *%edi
+  800646:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800649:	83 eb 01             	sub    $0x1,%ebx
+  80064c:	85 db                	test   %ebx,%ebx
+  80064e:	7f ed                	jg     80063d <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800650:	83 ec 08             	sub    $0x8,%esp
+  800653:	56                   	push   %esi
+  800654:	83 ec 04             	sub    $0x4,%esp
+  800657:	ff 75 e4             	push   -0x1c(%ebp)
+  80065a:	ff 75 e0             	push   -0x20(%ebp)
+  80065d:	ff 75 dc             	push   -0x24(%ebp)
+  800660:	ff 75 d8             	push   -0x28(%ebp)
+  800663:	e8 68 28 00 00       	call   802ed0 <__umoddi3>
+  800668:	83 c4 14             	add    $0x14,%esp
+  80066b:	0f be 80 0f 33 80 00 	movsbl 0x80330f(%eax),%eax
+  800672:	50                   	push   %eax
+  800673:	ff d7                	call   *%edi
+}
+  800675:	83 c4 10             	add    $0x10,%esp
+  800678:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80067b:	5b                   	pop    %ebx
+  80067c:	5e                   	pop    %esi
+  80067d:	5f                   	pop    %edi
+  80067e:	5d                   	pop    %ebp
+  80067f:	c3                   	ret
+
+00800680 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800680:	55                   	push   %ebp
+  800681:	89 e5                	mov    %esp,%ebp
+  800683:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800686:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80068a:	8b 10                	mov    (%eax),%edx
+  80068c:	3b 50 04             	cmp    0x4(%eax),%edx
+  80068f:	73 0a                	jae    80069b <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800691:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800694:	89 08                	mov    %ecx,(%eax)
+  800696:	8b 45 08             	mov    0x8(%ebp),%eax
+  800699:	88 02                	mov    %al,(%edx)
+}
+  80069b:	5d                   	pop    %ebp
+  80069c:	c3                   	ret
+
+0080069d <printfmt>:
+{
+  80069d:	55                   	push   %ebp
+  80069e:	89 e5                	mov    %esp,%ebp
+  8006a0:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8006a3:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8006a6:	50                   	push   %eax
+  8006a7:	ff 75 10             	push   0x10(%ebp)
+  8006aa:	ff 75 0c             	push   0xc(%ebp)
+  8006ad:	ff 75 08             	push   0x8(%ebp)
+  8006b0:	e8 05 00 00 00       	call   8006ba <vprintfmt>
+}
+  8006b5:	83 c4 10             	add    $0x10,%esp
+  8006b8:	c9                   	leave
+  8006b9:	c3                   	ret
+
+008006ba <vprintfmt>:
+{
+  8006ba:	55                   	push   %ebp
+  8006bb:	89 e5                	mov    %esp,%ebp
+  8006bd:	57                   	push   %edi
+  8006be:	56                   	push   %esi
+  8006bf:	53                   	push   %ebx
+  8006c0:	83 ec 2c             	sub    $0x2c,%esp
+  8006c3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006c6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8006c9:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8006cc:	eb 0a                	jmp    8006d8 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8006ce:	83 ec 08             	sub    $0x8,%esp
+  8006d1:	53                   	push   %ebx
+  8006d2:	50                   	push   %eax
+  8006d3:	ff d6                	call   *%esi
+  8006d5:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8006d8:	83 c7 01             	add    $0x1,%edi
+  8006db:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8006df:	83 f8 25             	cmp    $0x25,%eax
+  8006e2:	74 0c                	je     8006f0 <vprintfmt+0x36>
+			if (ch == '\0')
+  8006e4:	85 c0                	test   %eax,%eax
+  8006e6:	75 e6                	jne    8006ce <vprintfmt+0x14>
+}
+  8006e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006eb:	5b                   	pop    %ebx
+  8006ec:	5e                   	pop    %esi
+  8006ed:	5f                   	pop    %edi
+  8006ee:	5d                   	pop    %ebp
+  8006ef:	c3                   	ret
+		padc = ' ';
+  8006f0:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8006f4:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8006fb:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800702:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800709:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80070e:	8d 47 01             	lea    0x1(%edi),%eax
+  800711:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800714:	0f b6 17             	movzbl (%edi),%edx
+  800717:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80071a:	3c 55                	cmp    $0x55,%al
+  80071c:	0f 87 9a 03 00 00    	ja     800abc <vprintfmt+0x402>
+  800722:	0f b6 c0             	movzbl %al,%eax
+  800725:	ff 24 85 60 34 80 00 	jmp    *0x803460(,%eax,4)
+  80072c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  80072f:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800733:	eb d9                	jmp    80070e <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800735:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800738:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80073c:	eb d0                	jmp    80070e <vprintfmt+0x54>
+  80073e:	0f b6 d2             	movzbl %dl,%edx
+  800741:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800744:	b8 00 00 00 00       	mov    $0x0,%eax
+  800749:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80074c:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80074f:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800753:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800756:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800759:	83 f9 09             	cmp    $0x9,%ecx
+  80075c:	77 55                	ja     8007b3 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  80075e:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800761:	eb e9                	jmp    80074c <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800763:	8b 45 14             	mov    0x14(%ebp),%eax
+  800766:	8b 00                	mov    (%eax),%eax
+  800768:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80076b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80076e:	8d 40 04             	lea    0x4(%eax),%eax
+  800771:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800774:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800777:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80077b:	79 91                	jns    80070e <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80077d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800780:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800783:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80078a:	eb 82                	jmp    80070e <vprintfmt+0x54>
+			if (width < 0)
+  80078c:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80078f:	85 d2                	test   %edx,%edx
+  800791:	b8 00 00 00 00       	mov    $0x0,%eax
+  800796:	0f 49 c2             	cmovns %edx,%eax
+  800799:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80079c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80079f:	e9 6a ff ff ff       	jmp    80070e <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8007a4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8007a7:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8007ae:	e9 5b ff ff ff       	jmp    80070e <vprintfmt+0x54>
+  8007b3:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8007b6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8007b9:	eb bc                	jmp    800777 <vprintfmt+0xbd>
+			lflag++;
+  8007bb:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8007be:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8007c1:	e9 48 ff ff ff       	jmp    80070e <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8007c6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c9:	8d 78 04             	lea    0x4(%eax),%edi
+  8007cc:	83 ec 08             	sub    $0x8,%esp
+  8007cf:	53                   	push   %ebx
+  8007d0:	ff 30                	push   (%eax)
+  8007d2:	ff d6                	call   *%esi
+			break;
+  8007d4:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8007d7:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8007da:	e9 7c 02 00 00       	jmp    800a5b <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  8007df:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e2:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8007e5:	8b 10                	mov    (%eax),%edx
+  8007e7:	89 d0                	mov    %edx,%eax
+  8007e9:	f7 d8                	neg    %eax
+  8007eb:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8007ee:	83 f8 10             	cmp    $0x10,%eax
+  8007f1:	7f 23                	jg     800816 <vprintfmt+0x15c>
+  8007f3:	8b 14 85 c0 35 80 00 	mov    0x8035c0(,%eax,4),%edx
+  8007fa:	85 d2                	test   %edx,%edx
+  8007fc:	74 18                	je     800816 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8007fe:	52                   	push   %edx
+  8007ff:	68 05 38 80 00       	push   $0x803805
+  800804:	53                   	push   %ebx
+  800805:	56                   	push   %esi
+  800806:	e8 92 fe ff ff       	call   80069d <printfmt>
+  80080b:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80080e:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800811:	e9 45 02 00 00       	jmp    800a5b <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  800816:	50                   	push   %eax
+  800817:	68 27 33 80 00       	push   $0x803327
+  80081c:	53                   	push   %ebx
+  80081d:	56                   	push   %esi
+  80081e:	e8 7a fe ff ff       	call   80069d <printfmt>
+  800823:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800826:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800829:	e9 2d 02 00 00       	jmp    800a5b <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80082e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800831:	83 c0 04             	add    $0x4,%eax
+  800834:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800837:	8b 45 14             	mov    0x14(%ebp),%eax
+  80083a:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80083c:	85 c9                	test   %ecx,%ecx
+  80083e:	b8 20 33 80 00       	mov    $0x803320,%eax
+  800843:	0f 45 c1             	cmovne %ecx,%eax
+  800846:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800849:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80084d:	7e 06                	jle    800855 <vprintfmt+0x19b>
+  80084f:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800853:	75 0b                	jne    800860 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800855:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800858:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80085b:	89 75 08             	mov    %esi,0x8(%ebp)
+  80085e:	eb 5c                	jmp    8008bc <vprintfmt+0x202>
+  800860:	83 ec 08             	sub    $0x8,%esp
+  800863:	ff 75 d0             	push   -0x30(%ebp)
+  800866:	ff 75 cc             	push   -0x34(%ebp)
+  800869:	e8 eb 02 00 00       	call   800b59 <strnlen>
+  80086e:	89 c2                	mov    %eax,%edx
+  800870:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800873:	29 d0                	sub    %edx,%eax
+  800875:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800878:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80087c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80087f:	89 75 08             	mov    %esi,0x8(%ebp)
+  800882:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800884:	eb 0e                	jmp    800894 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800886:	83 ec 08             	sub    $0x8,%esp
+  800889:	53                   	push   %ebx
+  80088a:	57                   	push   %edi
+  80088b:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80088e:	83 ee 01             	sub    $0x1,%esi
+  800891:	83 c4 10             	add    $0x10,%esp
+  800894:	85 f6                	test   %esi,%esi
+  800896:	7f ee                	jg     800886 <vprintfmt+0x1cc>
+  800898:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80089b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80089e:	85 c0                	test   %eax,%eax
+  8008a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008a5:	0f 49 d0             	cmovns %eax,%edx
+  8008a8:	29 d0                	sub    %edx,%eax
+  8008aa:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8008ad:	eb a6                	jmp    800855 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8008af:	83 ec 08             	sub    $0x8,%esp
+  8008b2:	53                   	push   %ebx
+  8008b3:	52                   	push   %edx
+  8008b4:	ff 55 08             	call   *0x8(%ebp)
+  8008b7:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8008ba:	89 f1                	mov    %esi,%ecx
+  8008bc:	8d 71 01             	lea    0x1(%ecx),%esi
+  8008bf:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8008c3:	0f be d0             	movsbl %al,%edx
+  8008c6:	85 d2                	test   %edx,%edx
+  8008c8:	74 28                	je     8008f2 <vprintfmt+0x238>
+  8008ca:	85 ff                	test   %edi,%edi
+  8008cc:	78 05                	js     8008d3 <vprintfmt+0x219>
+  8008ce:	83 ef 01             	sub    $0x1,%edi
+  8008d1:	78 30                	js     800903 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8008d3:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8008d7:	74 d6                	je     8008af <vprintfmt+0x1f5>
+  8008d9:	0f be c0             	movsbl %al,%eax
+  8008dc:	83 e8 20             	sub    $0x20,%eax
+  8008df:	83 f8 5e             	cmp    $0x5e,%eax
+  8008e2:	76 cb                	jbe    8008af <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8008e4:	83 ec 08             	sub    $0x8,%esp
+  8008e7:	53                   	push   %ebx
+  8008e8:	6a 3f                	push   $0x3f
+  8008ea:	ff 55 08             	call   *0x8(%ebp)
+  8008ed:	83 c4 10             	add    $0x10,%esp
+  8008f0:	eb c8                	jmp    8008ba <vprintfmt+0x200>
+  8008f2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008f5:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8008f8:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8008fb:	01 d0                	add    %edx,%eax
+  8008fd:	29 c8                	sub    %ecx,%eax
+  8008ff:	89 c7                	mov    %eax,%edi
+  800901:	eb 13                	jmp    800916 <vprintfmt+0x25c>
+  800903:	8b 75 08             	mov    0x8(%ebp),%esi
+  800906:	eb ed                	jmp    8008f5 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800908:	83 ec 08             	sub    $0x8,%esp
+  80090b:	53                   	push   %ebx
+  80090c:	6a 20                	push   $0x20
+  80090e:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800910:	83 ef 01             	sub    $0x1,%edi
+  800913:	83 c4 10             	add    $0x10,%esp
+  800916:	85 ff                	test   %edi,%edi
+  800918:	7f ee                	jg     800908 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80091a:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80091d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800920:	e9 36 01 00 00       	jmp    800a5b <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  800925:	83 f9 01             	cmp    $0x1,%ecx
+  800928:	7f 1f                	jg     800949 <vprintfmt+0x28f>
+	else if (lflag)
+  80092a:	85 c9                	test   %ecx,%ecx
+  80092c:	74 67                	je     800995 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  80092e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800931:	8b 00                	mov    (%eax),%eax
+  800933:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800936:	89 c1                	mov    %eax,%ecx
+  800938:	c1 f9 1f             	sar    $0x1f,%ecx
+  80093b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80093e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800941:	8d 40 04             	lea    0x4(%eax),%eax
+  800944:	89 45 14             	mov    %eax,0x14(%ebp)
+  800947:	eb 17                	jmp    800960 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800949:	8b 45 14             	mov    0x14(%ebp),%eax
+  80094c:	8b 50 04             	mov    0x4(%eax),%edx
+  80094f:	8b 00                	mov    (%eax),%eax
+  800951:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800954:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800957:	8b 45 14             	mov    0x14(%ebp),%eax
+  80095a:	8d 40 08             	lea    0x8(%eax),%eax
+  80095d:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800960:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800963:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800966:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80096b:	85 c9                	test   %ecx,%ecx
+  80096d:	0f 89 ce 00 00 00    	jns    800a41 <vprintfmt+0x387>
+				putch('-', putdat);
+  800973:	83 ec 08             	sub    $0x8,%esp
+  800976:	53                   	push   %ebx
+  800977:	6a 2d                	push   $0x2d
+  800979:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80097b:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80097e:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800981:	f7 da                	neg    %edx
+  800983:	83 d1 00             	adc    $0x0,%ecx
+  800986:	f7 d9                	neg    %ecx
+  800988:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80098b:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800990:	e9 ac 00 00 00       	jmp    800a41 <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  800995:	8b 45 14             	mov    0x14(%ebp),%eax
+  800998:	8b 00                	mov    (%eax),%eax
+  80099a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80099d:	89 c1                	mov    %eax,%ecx
+  80099f:	c1 f9 1f             	sar    $0x1f,%ecx
+  8009a2:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8009a5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009a8:	8d 40 04             	lea    0x4(%eax),%eax
+  8009ab:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009ae:	eb b0                	jmp    800960 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8009b0:	83 f9 01             	cmp    $0x1,%ecx
+  8009b3:	7f 1b                	jg     8009d0 <vprintfmt+0x316>
+	else if (lflag)
+  8009b5:	85 c9                	test   %ecx,%ecx
+  8009b7:	74 2c                	je     8009e5 <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  8009b9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009bc:	8b 10                	mov    (%eax),%edx
+  8009be:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009c3:	8d 40 04             	lea    0x4(%eax),%eax
+  8009c6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8009c9:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8009ce:	eb 71                	jmp    800a41 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  8009d0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009d3:	8b 10                	mov    (%eax),%edx
+  8009d5:	8b 48 04             	mov    0x4(%eax),%ecx
+  8009d8:	8d 40 08             	lea    0x8(%eax),%eax
+  8009db:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8009de:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8009e3:	eb 5c                	jmp    800a41 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  8009e5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009e8:	8b 10                	mov    (%eax),%edx
+  8009ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009ef:	8d 40 04             	lea    0x4(%eax),%eax
+  8009f2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8009f5:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8009fa:	eb 45                	jmp    800a41 <vprintfmt+0x387>
+			putch('X', putdat);
+  8009fc:	83 ec 08             	sub    $0x8,%esp
+  8009ff:	53                   	push   %ebx
+  800a00:	6a 58                	push   $0x58
+  800a02:	ff d6                	call   *%esi
+			putch('X', putdat);
+  800a04:	83 c4 08             	add    $0x8,%esp
+  800a07:	53                   	push   %ebx
+  800a08:	6a 58                	push   $0x58
+  800a0a:	ff d6                	call   *%esi
+			putch('X', putdat);
+  800a0c:	83 c4 08             	add    $0x8,%esp
+  800a0f:	53                   	push   %ebx
+  800a10:	6a 58                	push   $0x58
+  800a12:	ff d6                	call   *%esi
+			break;
+  800a14:	83 c4 10             	add    $0x10,%esp
+  800a17:	eb 42                	jmp    800a5b <vprintfmt+0x3a1>
+			putch('0', putdat);
+  800a19:	83 ec 08             	sub    $0x8,%esp
+  800a1c:	53                   	push   %ebx
+  800a1d:	6a 30                	push   $0x30
+  800a1f:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800a21:	83 c4 08             	add    $0x8,%esp
+  800a24:	53                   	push   %ebx
+  800a25:	6a 78                	push   $0x78
+  800a27:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800a29:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a2c:	8b 10                	mov    (%eax),%edx
+  800a2e:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800a33:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800a36:	8d 40 04             	lea    0x4(%eax),%eax
+  800a39:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a3c:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800a41:	83 ec 0c             	sub    $0xc,%esp
+  800a44:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800a48:	50                   	push   %eax
+  800a49:	ff 75 e0             	push   -0x20(%ebp)
+  800a4c:	57                   	push   %edi
+  800a4d:	51                   	push   %ecx
+  800a4e:	52                   	push   %edx
+  800a4f:	89 da                	mov    %ebx,%edx
+  800a51:	89 f0                	mov    %esi,%eax
+  800a53:	e8 7f fb ff ff       	call   8005d7 <printnum>
+			break;
+  800a58:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800a5b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800a5e:	e9 75 fc ff ff       	jmp    8006d8 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800a63:	83 f9 01             	cmp    $0x1,%ecx
+  800a66:	7f 1b                	jg     800a83 <vprintfmt+0x3c9>
+	else if (lflag)
+  800a68:	85 c9                	test   %ecx,%ecx
+  800a6a:	74 2c                	je     800a98 <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  800a6c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a6f:	8b 10                	mov    (%eax),%edx
+  800a71:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a76:	8d 40 04             	lea    0x4(%eax),%eax
+  800a79:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a7c:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800a81:	eb be                	jmp    800a41 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  800a83:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a86:	8b 10                	mov    (%eax),%edx
+  800a88:	8b 48 04             	mov    0x4(%eax),%ecx
+  800a8b:	8d 40 08             	lea    0x8(%eax),%eax
+  800a8e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a91:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800a96:	eb a9                	jmp    800a41 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  800a98:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a9b:	8b 10                	mov    (%eax),%edx
+  800a9d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800aa2:	8d 40 04             	lea    0x4(%eax),%eax
+  800aa5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800aa8:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800aad:	eb 92                	jmp    800a41 <vprintfmt+0x387>
+			putch(ch, putdat);
+  800aaf:	83 ec 08             	sub    $0x8,%esp
+  800ab2:	53                   	push   %ebx
+  800ab3:	6a 25                	push   $0x25
+  800ab5:	ff d6                	call   *%esi
+			break;
+  800ab7:	83 c4 10             	add    $0x10,%esp
+  800aba:	eb 9f                	jmp    800a5b <vprintfmt+0x3a1>
+			putch('%', putdat);
+  800abc:	83 ec 08             	sub    $0x8,%esp
+  800abf:	53                   	push   %ebx
+  800ac0:	6a 25                	push   $0x25
+  800ac2:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800ac4:	83 c4 10             	add    $0x10,%esp
+  800ac7:	89 f8                	mov    %edi,%eax
+  800ac9:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800acd:	74 05                	je     800ad4 <vprintfmt+0x41a>
+  800acf:	83 e8 01             	sub    $0x1,%eax
+  800ad2:	eb f5                	jmp    800ac9 <vprintfmt+0x40f>
+  800ad4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800ad7:	eb 82                	jmp    800a5b <vprintfmt+0x3a1>
+
+00800ad9 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800ad9:	55                   	push   %ebp
+  800ada:	89 e5                	mov    %esp,%ebp
+  800adc:	83 ec 18             	sub    $0x18,%esp
+  800adf:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ae2:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800ae5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800ae8:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800aec:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800aef:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800af6:	85 c0                	test   %eax,%eax
+  800af8:	74 26                	je     800b20 <vsnprintf+0x47>
+  800afa:	85 d2                	test   %edx,%edx
+  800afc:	7e 22                	jle    800b20 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800afe:	ff 75 14             	push   0x14(%ebp)
+  800b01:	ff 75 10             	push   0x10(%ebp)
+  800b04:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800b07:	50                   	push   %eax
+  800b08:	68 80 06 80 00       	push   $0x800680
+  800b0d:	e8 a8 fb ff ff       	call   8006ba <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800b12:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800b15:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800b18:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b1b:	83 c4 10             	add    $0x10,%esp
+}
+  800b1e:	c9                   	leave
+  800b1f:	c3                   	ret
+		return -E_INVAL;
+  800b20:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b25:	eb f7                	jmp    800b1e <vsnprintf+0x45>
+
+00800b27 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800b27:	55                   	push   %ebp
+  800b28:	89 e5                	mov    %esp,%ebp
+  800b2a:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800b2d:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800b30:	50                   	push   %eax
+  800b31:	ff 75 10             	push   0x10(%ebp)
+  800b34:	ff 75 0c             	push   0xc(%ebp)
+  800b37:	ff 75 08             	push   0x8(%ebp)
+  800b3a:	e8 9a ff ff ff       	call   800ad9 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800b3f:	c9                   	leave
+  800b40:	c3                   	ret
+
+00800b41 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800b41:	55                   	push   %ebp
+  800b42:	89 e5                	mov    %esp,%ebp
+  800b44:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800b47:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b4c:	eb 03                	jmp    800b51 <strlen+0x10>
+		n++;
+  800b4e:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800b51:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800b55:	75 f7                	jne    800b4e <strlen+0xd>
+	return n;
+}
+  800b57:	5d                   	pop    %ebp
+  800b58:	c3                   	ret
+
+00800b59 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800b59:	55                   	push   %ebp
+  800b5a:	89 e5                	mov    %esp,%ebp
+  800b5c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b5f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b62:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b67:	eb 03                	jmp    800b6c <strnlen+0x13>
+		n++;
+  800b69:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b6c:	39 d0                	cmp    %edx,%eax
+  800b6e:	74 08                	je     800b78 <strnlen+0x1f>
+  800b70:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800b74:	75 f3                	jne    800b69 <strnlen+0x10>
+  800b76:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800b78:	89 d0                	mov    %edx,%eax
+  800b7a:	5d                   	pop    %ebp
+  800b7b:	c3                   	ret
+
+00800b7c <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800b7c:	55                   	push   %ebp
+  800b7d:	89 e5                	mov    %esp,%ebp
+  800b7f:	53                   	push   %ebx
+  800b80:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b83:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800b86:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b8b:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800b8f:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800b92:	83 c0 01             	add    $0x1,%eax
+  800b95:	84 d2                	test   %dl,%dl
+  800b97:	75 f2                	jne    800b8b <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800b99:	89 c8                	mov    %ecx,%eax
+  800b9b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b9e:	c9                   	leave
+  800b9f:	c3                   	ret
+
+00800ba0 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800ba0:	55                   	push   %ebp
+  800ba1:	89 e5                	mov    %esp,%ebp
+  800ba3:	53                   	push   %ebx
+  800ba4:	83 ec 10             	sub    $0x10,%esp
+  800ba7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800baa:	53                   	push   %ebx
+  800bab:	e8 91 ff ff ff       	call   800b41 <strlen>
+  800bb0:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800bb3:	ff 75 0c             	push   0xc(%ebp)
+  800bb6:	01 d8                	add    %ebx,%eax
+  800bb8:	50                   	push   %eax
+  800bb9:	e8 be ff ff ff       	call   800b7c <strcpy>
+	return dst;
+}
+  800bbe:	89 d8                	mov    %ebx,%eax
+  800bc0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bc3:	c9                   	leave
+  800bc4:	c3                   	ret
+
+00800bc5 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800bc5:	55                   	push   %ebp
+  800bc6:	89 e5                	mov    %esp,%ebp
+  800bc8:	56                   	push   %esi
+  800bc9:	53                   	push   %ebx
+  800bca:	8b 75 08             	mov    0x8(%ebp),%esi
+  800bcd:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800bd0:	89 f3                	mov    %esi,%ebx
+  800bd2:	03 5d 10             	add    0x10(%ebp),%ebx
+  800bd5:	89 f0                	mov    %esi,%eax
+  800bd7:	eb 0f                	jmp    800be8 <strncpy+0x23>
+		*dst++ = *src;
+  800bd9:	83 c0 01             	add    $0x1,%eax
+  800bdc:	0f b6 0a             	movzbl (%edx),%ecx
+  800bdf:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800be2:	80 f9 01             	cmp    $0x1,%cl
+  800be5:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800be8:	39 d8                	cmp    %ebx,%eax
+  800bea:	75 ed                	jne    800bd9 <strncpy+0x14>
+	}
+	return ret;
+}
+  800bec:	89 f0                	mov    %esi,%eax
+  800bee:	5b                   	pop    %ebx
+  800bef:	5e                   	pop    %esi
+  800bf0:	5d                   	pop    %ebp
+  800bf1:	c3                   	ret
+
+00800bf2 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800bf2:	55                   	push   %ebp
+  800bf3:	89 e5                	mov    %esp,%ebp
+  800bf5:	56                   	push   %esi
+  800bf6:	53                   	push   %ebx
+  800bf7:	8b 75 08             	mov    0x8(%ebp),%esi
+  800bfa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bfd:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800c00:	89 f0                	mov    %esi,%eax
+  800c02:	85 d2                	test   %edx,%edx
+  800c04:	74 21                	je     800c27 <strlcpy+0x35>
+  800c06:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800c0a:	89 f2                	mov    %esi,%edx
+  800c0c:	eb 09                	jmp    800c17 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800c0e:	83 c1 01             	add    $0x1,%ecx
+  800c11:	83 c2 01             	add    $0x1,%edx
+  800c14:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800c17:	39 c2                	cmp    %eax,%edx
+  800c19:	74 09                	je     800c24 <strlcpy+0x32>
+  800c1b:	0f b6 19             	movzbl (%ecx),%ebx
+  800c1e:	84 db                	test   %bl,%bl
+  800c20:	75 ec                	jne    800c0e <strlcpy+0x1c>
+  800c22:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800c24:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800c27:	29 f0                	sub    %esi,%eax
+}
+  800c29:	5b                   	pop    %ebx
+  800c2a:	5e                   	pop    %esi
+  800c2b:	5d                   	pop    %ebp
+  800c2c:	c3                   	ret
+
+00800c2d <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800c2d:	55                   	push   %ebp
+  800c2e:	89 e5                	mov    %esp,%ebp
+  800c30:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c33:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800c36:	eb 06                	jmp    800c3e <strcmp+0x11>
+		p++, q++;
+  800c38:	83 c1 01             	add    $0x1,%ecx
+  800c3b:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800c3e:	0f b6 01             	movzbl (%ecx),%eax
+  800c41:	84 c0                	test   %al,%al
+  800c43:	74 04                	je     800c49 <strcmp+0x1c>
+  800c45:	3a 02                	cmp    (%edx),%al
+  800c47:	74 ef                	je     800c38 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800c49:	0f b6 c0             	movzbl %al,%eax
+  800c4c:	0f b6 12             	movzbl (%edx),%edx
+  800c4f:	29 d0                	sub    %edx,%eax
+}
+  800c51:	5d                   	pop    %ebp
+  800c52:	c3                   	ret
+
+00800c53 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800c53:	55                   	push   %ebp
+  800c54:	89 e5                	mov    %esp,%ebp
+  800c56:	53                   	push   %ebx
+  800c57:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c5a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c5d:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800c60:	eb 09                	jmp    800c6b <strncmp+0x18>
+		n--, p++, q++;
+  800c62:	83 ea 01             	sub    $0x1,%edx
+  800c65:	83 c0 01             	add    $0x1,%eax
+  800c68:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800c6b:	85 d2                	test   %edx,%edx
+  800c6d:	74 18                	je     800c87 <strncmp+0x34>
+  800c6f:	0f b6 18             	movzbl (%eax),%ebx
+  800c72:	84 db                	test   %bl,%bl
+  800c74:	74 04                	je     800c7a <strncmp+0x27>
+  800c76:	3a 19                	cmp    (%ecx),%bl
+  800c78:	74 e8                	je     800c62 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800c7a:	0f b6 00             	movzbl (%eax),%eax
+  800c7d:	0f b6 11             	movzbl (%ecx),%edx
+  800c80:	29 d0                	sub    %edx,%eax
+}
+  800c82:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c85:	c9                   	leave
+  800c86:	c3                   	ret
+		return 0;
+  800c87:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c8c:	eb f4                	jmp    800c82 <strncmp+0x2f>
+
+00800c8e <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800c8e:	55                   	push   %ebp
+  800c8f:	89 e5                	mov    %esp,%ebp
+  800c91:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c94:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800c98:	eb 03                	jmp    800c9d <strchr+0xf>
+  800c9a:	83 c0 01             	add    $0x1,%eax
+  800c9d:	0f b6 10             	movzbl (%eax),%edx
+  800ca0:	84 d2                	test   %dl,%dl
+  800ca2:	74 06                	je     800caa <strchr+0x1c>
+		if (*s == c)
+  800ca4:	38 ca                	cmp    %cl,%dl
+  800ca6:	75 f2                	jne    800c9a <strchr+0xc>
+  800ca8:	eb 05                	jmp    800caf <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800caa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800caf:	5d                   	pop    %ebp
+  800cb0:	c3                   	ret
+
+00800cb1 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800cb1:	55                   	push   %ebp
+  800cb2:	89 e5                	mov    %esp,%ebp
+  800cb4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cb7:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800cbb:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800cbe:	38 ca                	cmp    %cl,%dl
+  800cc0:	74 09                	je     800ccb <strfind+0x1a>
+  800cc2:	84 d2                	test   %dl,%dl
+  800cc4:	74 05                	je     800ccb <strfind+0x1a>
+	for (; *s; s++)
+  800cc6:	83 c0 01             	add    $0x1,%eax
+  800cc9:	eb f0                	jmp    800cbb <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800ccb:	5d                   	pop    %ebp
+  800ccc:	c3                   	ret
+
+00800ccd <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800ccd:	55                   	push   %ebp
+  800cce:	89 e5                	mov    %esp,%ebp
+  800cd0:	57                   	push   %edi
+  800cd1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800cd4:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800cd7:	85 c9                	test   %ecx,%ecx
+  800cd9:	74 20                	je     800cfb <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800cdb:	89 f8                	mov    %edi,%eax
+  800cdd:	09 c8                	or     %ecx,%eax
+  800cdf:	a8 03                	test   $0x3,%al
+  800ce1:	75 12                	jne    800cf5 <memset+0x28>
+		c &= 0xFF;
+  800ce3:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800ce7:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800ced:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800cf0:	fc                   	cld
+  800cf1:	f3 ab                	rep stos %eax,%es:(%edi)
+  800cf3:	eb 06                	jmp    800cfb <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800cf5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800cf8:	fc                   	cld
+  800cf9:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800cfb:	89 f8                	mov    %edi,%eax
+  800cfd:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800d00:	c9                   	leave
+  800d01:	c3                   	ret
+
+00800d02 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800d02:	55                   	push   %ebp
+  800d03:	89 e5                	mov    %esp,%ebp
+  800d05:	57                   	push   %edi
+  800d06:	56                   	push   %esi
+  800d07:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d0a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800d0d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800d10:	39 c6                	cmp    %eax,%esi
+  800d12:	73 32                	jae    800d46 <memmove+0x44>
+  800d14:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800d17:	39 d0                	cmp    %edx,%eax
+  800d19:	73 2b                	jae    800d46 <memmove+0x44>
+		s += n;
+		d += n;
+  800d1b:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d1e:	89 d6                	mov    %edx,%esi
+  800d20:	09 fe                	or     %edi,%esi
+  800d22:	09 ce                	or     %ecx,%esi
+  800d24:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800d2a:	75 0e                	jne    800d3a <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800d2c:	83 ef 04             	sub    $0x4,%edi
+  800d2f:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800d32:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800d35:	fd                   	std
+  800d36:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d38:	eb 09                	jmp    800d43 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800d3a:	83 ef 01             	sub    $0x1,%edi
+  800d3d:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800d40:	fd                   	std
+  800d41:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800d43:	fc                   	cld
+  800d44:	eb 1a                	jmp    800d60 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d46:	89 f2                	mov    %esi,%edx
+  800d48:	09 c2                	or     %eax,%edx
+  800d4a:	09 ca                	or     %ecx,%edx
+  800d4c:	f6 c2 03             	test   $0x3,%dl
+  800d4f:	75 0a                	jne    800d5b <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800d51:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800d54:	89 c7                	mov    %eax,%edi
+  800d56:	fc                   	cld
+  800d57:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d59:	eb 05                	jmp    800d60 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800d5b:	89 c7                	mov    %eax,%edi
+  800d5d:	fc                   	cld
+  800d5e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800d60:	5e                   	pop    %esi
+  800d61:	5f                   	pop    %edi
+  800d62:	5d                   	pop    %ebp
+  800d63:	c3                   	ret
+
+00800d64 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800d64:	55                   	push   %ebp
+  800d65:	89 e5                	mov    %esp,%ebp
+  800d67:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800d6a:	ff 75 10             	push   0x10(%ebp)
+  800d6d:	ff 75 0c             	push   0xc(%ebp)
+  800d70:	ff 75 08             	push   0x8(%ebp)
+  800d73:	e8 8a ff ff ff       	call   800d02 <memmove>
+}
+  800d78:	c9                   	leave
+  800d79:	c3                   	ret
+
+00800d7a <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800d7a:	55                   	push   %ebp
+  800d7b:	89 e5                	mov    %esp,%ebp
+  800d7d:	56                   	push   %esi
+  800d7e:	53                   	push   %ebx
+  800d7f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d82:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800d85:	89 c6                	mov    %eax,%esi
+  800d87:	03 75 10             	add    0x10(%ebp),%esi
+  800d8a:	eb 06                	jmp    800d92 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800d8c:	83 c0 01             	add    $0x1,%eax
+  800d8f:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800d92:	39 f0                	cmp    %esi,%eax
+  800d94:	74 14                	je     800daa <memcmp+0x30>
+		if (*s1 != *s2)
+  800d96:	0f b6 08             	movzbl (%eax),%ecx
+  800d99:	0f b6 1a             	movzbl (%edx),%ebx
+  800d9c:	38 d9                	cmp    %bl,%cl
+  800d9e:	74 ec                	je     800d8c <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800da0:	0f b6 c1             	movzbl %cl,%eax
+  800da3:	0f b6 db             	movzbl %bl,%ebx
+  800da6:	29 d8                	sub    %ebx,%eax
+  800da8:	eb 05                	jmp    800daf <memcmp+0x35>
+	}
+
+	return 0;
+  800daa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800daf:	5b                   	pop    %ebx
+  800db0:	5e                   	pop    %esi
+  800db1:	5d                   	pop    %ebp
+  800db2:	c3                   	ret
+
+00800db3 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800db3:	55                   	push   %ebp
+  800db4:	89 e5                	mov    %esp,%ebp
+  800db6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800db9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800dbc:	89 c2                	mov    %eax,%edx
+  800dbe:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800dc1:	eb 03                	jmp    800dc6 <memfind+0x13>
+  800dc3:	83 c0 01             	add    $0x1,%eax
+  800dc6:	39 d0                	cmp    %edx,%eax
+  800dc8:	73 04                	jae    800dce <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800dca:	38 08                	cmp    %cl,(%eax)
+  800dcc:	75 f5                	jne    800dc3 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800dce:	5d                   	pop    %ebp
+  800dcf:	c3                   	ret
+
+00800dd0 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800dd0:	55                   	push   %ebp
+  800dd1:	89 e5                	mov    %esp,%ebp
+  800dd3:	57                   	push   %edi
+  800dd4:	56                   	push   %esi
+  800dd5:	53                   	push   %ebx
+  800dd6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800ddc:	eb 03                	jmp    800de1 <strtol+0x11>
+		s++;
+  800dde:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800de1:	0f b6 02             	movzbl (%edx),%eax
+  800de4:	3c 20                	cmp    $0x20,%al
+  800de6:	74 f6                	je     800dde <strtol+0xe>
+  800de8:	3c 09                	cmp    $0x9,%al
+  800dea:	74 f2                	je     800dde <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800dec:	3c 2b                	cmp    $0x2b,%al
+  800dee:	74 2a                	je     800e1a <strtol+0x4a>
+	int neg = 0;
+  800df0:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800df5:	3c 2d                	cmp    $0x2d,%al
+  800df7:	74 2b                	je     800e24 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800df9:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800dff:	75 0f                	jne    800e10 <strtol+0x40>
+  800e01:	80 3a 30             	cmpb   $0x30,(%edx)
+  800e04:	74 28                	je     800e2e <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800e06:	85 db                	test   %ebx,%ebx
+  800e08:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e0d:	0f 44 d8             	cmove  %eax,%ebx
+  800e10:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e15:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800e18:	eb 46                	jmp    800e60 <strtol+0x90>
+		s++;
+  800e1a:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800e1d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e22:	eb d5                	jmp    800df9 <strtol+0x29>
+		s++, neg = 1;
+  800e24:	83 c2 01             	add    $0x1,%edx
+  800e27:	bf 01 00 00 00       	mov    $0x1,%edi
+  800e2c:	eb cb                	jmp    800df9 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e2e:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800e32:	74 0e                	je     800e42 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800e34:	85 db                	test   %ebx,%ebx
+  800e36:	75 d8                	jne    800e10 <strtol+0x40>
+		s++, base = 8;
+  800e38:	83 c2 01             	add    $0x1,%edx
+  800e3b:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800e40:	eb ce                	jmp    800e10 <strtol+0x40>
+		s += 2, base = 16;
+  800e42:	83 c2 02             	add    $0x2,%edx
+  800e45:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800e4a:	eb c4                	jmp    800e10 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800e4c:	0f be c0             	movsbl %al,%eax
+  800e4f:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800e52:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800e55:	7d 3a                	jge    800e91 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800e57:	83 c2 01             	add    $0x1,%edx
+  800e5a:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800e5e:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800e60:	0f b6 02             	movzbl (%edx),%eax
+  800e63:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800e66:	89 f3                	mov    %esi,%ebx
+  800e68:	80 fb 09             	cmp    $0x9,%bl
+  800e6b:	76 df                	jbe    800e4c <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800e6d:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800e70:	89 f3                	mov    %esi,%ebx
+  800e72:	80 fb 19             	cmp    $0x19,%bl
+  800e75:	77 08                	ja     800e7f <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800e77:	0f be c0             	movsbl %al,%eax
+  800e7a:	83 e8 57             	sub    $0x57,%eax
+  800e7d:	eb d3                	jmp    800e52 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800e7f:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800e82:	89 f3                	mov    %esi,%ebx
+  800e84:	80 fb 19             	cmp    $0x19,%bl
+  800e87:	77 08                	ja     800e91 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800e89:	0f be c0             	movsbl %al,%eax
+  800e8c:	83 e8 37             	sub    $0x37,%eax
+  800e8f:	eb c1                	jmp    800e52 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800e91:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800e95:	74 05                	je     800e9c <strtol+0xcc>
+		*endptr = (char *) s;
+  800e97:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e9a:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800e9c:	89 c8                	mov    %ecx,%eax
+  800e9e:	f7 d8                	neg    %eax
+  800ea0:	85 ff                	test   %edi,%edi
+  800ea2:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800ea5:	89 c8                	mov    %ecx,%eax
+  800ea7:	5b                   	pop    %ebx
+  800ea8:	5e                   	pop    %esi
+  800ea9:	5f                   	pop    %edi
+  800eaa:	5d                   	pop    %ebp
+  800eab:	c3                   	ret
+
+00800eac <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800eac:	55                   	push   %ebp
+  800ead:	89 e5                	mov    %esp,%ebp
+  800eaf:	57                   	push   %edi
+  800eb0:	56                   	push   %esi
+  800eb1:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800eb2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800eb7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ebd:	89 c3                	mov    %eax,%ebx
+  800ebf:	89 c7                	mov    %eax,%edi
+  800ec1:	89 c6                	mov    %eax,%esi
+  800ec3:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  800ec5:	5b                   	pop    %ebx
+  800ec6:	5e                   	pop    %esi
+  800ec7:	5f                   	pop    %edi
+  800ec8:	5d                   	pop    %ebp
+  800ec9:	c3                   	ret
+
+00800eca <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800eca:	55                   	push   %ebp
+  800ecb:	89 e5                	mov    %esp,%ebp
+  800ecd:	57                   	push   %edi
+  800ece:	56                   	push   %esi
+  800ecf:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800ed0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ed5:	b8 01 00 00 00       	mov    $0x1,%eax
+  800eda:	89 d1                	mov    %edx,%ecx
+  800edc:	89 d3                	mov    %edx,%ebx
+  800ede:	89 d7                	mov    %edx,%edi
+  800ee0:	89 d6                	mov    %edx,%esi
+  800ee2:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800ee4:	5b                   	pop    %ebx
+  800ee5:	5e                   	pop    %esi
+  800ee6:	5f                   	pop    %edi
+  800ee7:	5d                   	pop    %ebp
+  800ee8:	c3                   	ret
+
+00800ee9 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800ee9:	55                   	push   %ebp
+  800eea:	89 e5                	mov    %esp,%ebp
+  800eec:	57                   	push   %edi
+  800eed:	56                   	push   %esi
+  800eee:	53                   	push   %ebx
+  800eef:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800ef2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ef7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800efa:	b8 03 00 00 00       	mov    $0x3,%eax
+  800eff:	89 cb                	mov    %ecx,%ebx
+  800f01:	89 cf                	mov    %ecx,%edi
+  800f03:	89 ce                	mov    %ecx,%esi
+  800f05:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f07:	85 c0                	test   %eax,%eax
+  800f09:	7f 08                	jg     800f13 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800f0b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f0e:	5b                   	pop    %ebx
+  800f0f:	5e                   	pop    %esi
+  800f10:	5f                   	pop    %edi
+  800f11:	5d                   	pop    %ebp
+  800f12:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f13:	83 ec 0c             	sub    $0xc,%esp
+  800f16:	50                   	push   %eax
+  800f17:	6a 03                	push   $0x3
+  800f19:	68 23 36 80 00       	push   $0x803623
+  800f1e:	6a 3e                	push   $0x3e
+  800f20:	68 40 36 80 00       	push   $0x803640
+  800f25:	e8 be f5 ff ff       	call   8004e8 <_panic>
+
+00800f2a <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800f2a:	55                   	push   %ebp
+  800f2b:	89 e5                	mov    %esp,%ebp
+  800f2d:	57                   	push   %edi
+  800f2e:	56                   	push   %esi
+  800f2f:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800f30:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f35:	b8 02 00 00 00       	mov    $0x2,%eax
+  800f3a:	89 d1                	mov    %edx,%ecx
+  800f3c:	89 d3                	mov    %edx,%ebx
+  800f3e:	89 d7                	mov    %edx,%edi
+  800f40:	89 d6                	mov    %edx,%esi
+  800f42:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800f44:	5b                   	pop    %ebx
+  800f45:	5e                   	pop    %esi
+  800f46:	5f                   	pop    %edi
+  800f47:	5d                   	pop    %ebp
+  800f48:	c3                   	ret
+
+00800f49 <sys_yield>:
+
+void
+sys_yield(void) {
+  800f49:	55                   	push   %ebp
+  800f4a:	89 e5                	mov    %esp,%ebp
+  800f4c:	57                   	push   %edi
+  800f4d:	56                   	push   %esi
+  800f4e:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800f4f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f54:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800f59:	89 d1                	mov    %edx,%ecx
+  800f5b:	89 d3                	mov    %edx,%ebx
+  800f5d:	89 d7                	mov    %edx,%edi
+  800f5f:	89 d6                	mov    %edx,%esi
+  800f61:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800f63:	5b                   	pop    %ebx
+  800f64:	5e                   	pop    %esi
+  800f65:	5f                   	pop    %edi
+  800f66:	5d                   	pop    %ebp
+  800f67:	c3                   	ret
+
+00800f68 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  800f68:	55                   	push   %ebp
+  800f69:	89 e5                	mov    %esp,%ebp
+  800f6b:	57                   	push   %edi
+  800f6c:	56                   	push   %esi
+  800f6d:	53                   	push   %ebx
+  800f6e:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800f71:	be 00 00 00 00       	mov    $0x0,%esi
+  800f76:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f79:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f7c:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f81:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f84:	89 f7                	mov    %esi,%edi
+  800f86:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f88:	85 c0                	test   %eax,%eax
+  800f8a:	7f 08                	jg     800f94 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800f8c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f8f:	5b                   	pop    %ebx
+  800f90:	5e                   	pop    %esi
+  800f91:	5f                   	pop    %edi
+  800f92:	5d                   	pop    %ebp
+  800f93:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f94:	83 ec 0c             	sub    $0xc,%esp
+  800f97:	50                   	push   %eax
+  800f98:	6a 04                	push   $0x4
+  800f9a:	68 23 36 80 00       	push   $0x803623
+  800f9f:	6a 3e                	push   $0x3e
+  800fa1:	68 40 36 80 00       	push   $0x803640
+  800fa6:	e8 3d f5 ff ff       	call   8004e8 <_panic>
+
+00800fab <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  800fab:	55                   	push   %ebp
+  800fac:	89 e5                	mov    %esp,%ebp
+  800fae:	57                   	push   %edi
+  800faf:	56                   	push   %esi
+  800fb0:	53                   	push   %ebx
+  800fb1:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800fb4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fba:	b8 05 00 00 00       	mov    $0x5,%eax
+  800fbf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fc2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fc5:	8b 75 18             	mov    0x18(%ebp),%esi
+  800fc8:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800fca:	85 c0                	test   %eax,%eax
+  800fcc:	7f 08                	jg     800fd6 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800fce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fd1:	5b                   	pop    %ebx
+  800fd2:	5e                   	pop    %esi
+  800fd3:	5f                   	pop    %edi
+  800fd4:	5d                   	pop    %ebp
+  800fd5:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800fd6:	83 ec 0c             	sub    $0xc,%esp
+  800fd9:	50                   	push   %eax
+  800fda:	6a 05                	push   $0x5
+  800fdc:	68 23 36 80 00       	push   $0x803623
+  800fe1:	6a 3e                	push   $0x3e
+  800fe3:	68 40 36 80 00       	push   $0x803640
+  800fe8:	e8 fb f4 ff ff       	call   8004e8 <_panic>
+
+00800fed <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  800fed:	55                   	push   %ebp
+  800fee:	89 e5                	mov    %esp,%ebp
+  800ff0:	57                   	push   %edi
+  800ff1:	56                   	push   %esi
+  800ff2:	53                   	push   %ebx
+  800ff3:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800ff6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ffb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ffe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801001:	b8 06 00 00 00       	mov    $0x6,%eax
+  801006:	89 df                	mov    %ebx,%edi
+  801008:	89 de                	mov    %ebx,%esi
+  80100a:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80100c:	85 c0                	test   %eax,%eax
+  80100e:	7f 08                	jg     801018 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  801010:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801013:	5b                   	pop    %ebx
+  801014:	5e                   	pop    %esi
+  801015:	5f                   	pop    %edi
+  801016:	5d                   	pop    %ebp
+  801017:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801018:	83 ec 0c             	sub    $0xc,%esp
+  80101b:	50                   	push   %eax
+  80101c:	6a 06                	push   $0x6
+  80101e:	68 23 36 80 00       	push   $0x803623
+  801023:	6a 3e                	push   $0x3e
+  801025:	68 40 36 80 00       	push   $0x803640
+  80102a:	e8 b9 f4 ff ff       	call   8004e8 <_panic>
+
+0080102f <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80102f:	55                   	push   %ebp
+  801030:	89 e5                	mov    %esp,%ebp
+  801032:	57                   	push   %edi
+  801033:	56                   	push   %esi
+  801034:	53                   	push   %ebx
+  801035:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  801038:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80103d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801040:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801043:	b8 08 00 00 00       	mov    $0x8,%eax
+  801048:	89 df                	mov    %ebx,%edi
+  80104a:	89 de                	mov    %ebx,%esi
+  80104c:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80104e:	85 c0                	test   %eax,%eax
+  801050:	7f 08                	jg     80105a <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801052:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801055:	5b                   	pop    %ebx
+  801056:	5e                   	pop    %esi
+  801057:	5f                   	pop    %edi
+  801058:	5d                   	pop    %ebp
+  801059:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80105a:	83 ec 0c             	sub    $0xc,%esp
+  80105d:	50                   	push   %eax
+  80105e:	6a 08                	push   $0x8
+  801060:	68 23 36 80 00       	push   $0x803623
+  801065:	6a 3e                	push   $0x3e
+  801067:	68 40 36 80 00       	push   $0x803640
+  80106c:	e8 77 f4 ff ff       	call   8004e8 <_panic>
+
+00801071 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801071:	55                   	push   %ebp
+  801072:	89 e5                	mov    %esp,%ebp
+  801074:	57                   	push   %edi
+  801075:	56                   	push   %esi
+  801076:	53                   	push   %ebx
+  801077:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  80107a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80107f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801082:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801085:	b8 09 00 00 00       	mov    $0x9,%eax
+  80108a:	89 df                	mov    %ebx,%edi
+  80108c:	89 de                	mov    %ebx,%esi
+  80108e:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801090:	85 c0                	test   %eax,%eax
+  801092:	7f 08                	jg     80109c <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801094:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801097:	5b                   	pop    %ebx
+  801098:	5e                   	pop    %esi
+  801099:	5f                   	pop    %edi
+  80109a:	5d                   	pop    %ebp
+  80109b:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80109c:	83 ec 0c             	sub    $0xc,%esp
+  80109f:	50                   	push   %eax
+  8010a0:	6a 09                	push   $0x9
+  8010a2:	68 23 36 80 00       	push   $0x803623
+  8010a7:	6a 3e                	push   $0x3e
+  8010a9:	68 40 36 80 00       	push   $0x803640
+  8010ae:	e8 35 f4 ff ff       	call   8004e8 <_panic>
+
+008010b3 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8010b3:	55                   	push   %ebp
+  8010b4:	89 e5                	mov    %esp,%ebp
+  8010b6:	57                   	push   %edi
+  8010b7:	56                   	push   %esi
+  8010b8:	53                   	push   %ebx
+  8010b9:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  8010bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c7:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010cc:	89 df                	mov    %ebx,%edi
+  8010ce:	89 de                	mov    %ebx,%esi
+  8010d0:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8010d2:	85 c0                	test   %eax,%eax
+  8010d4:	7f 08                	jg     8010de <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8010d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010d9:	5b                   	pop    %ebx
+  8010da:	5e                   	pop    %esi
+  8010db:	5f                   	pop    %edi
+  8010dc:	5d                   	pop    %ebp
+  8010dd:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8010de:	83 ec 0c             	sub    $0xc,%esp
+  8010e1:	50                   	push   %eax
+  8010e2:	6a 0a                	push   $0xa
+  8010e4:	68 23 36 80 00       	push   $0x803623
+  8010e9:	6a 3e                	push   $0x3e
+  8010eb:	68 40 36 80 00       	push   $0x803640
+  8010f0:	e8 f3 f3 ff ff       	call   8004e8 <_panic>
+
+008010f5 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  8010f5:	55                   	push   %ebp
+  8010f6:	89 e5                	mov    %esp,%ebp
+  8010f8:	57                   	push   %edi
+  8010f9:	56                   	push   %esi
+  8010fa:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8010fb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010fe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801101:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801106:	be 00 00 00 00       	mov    $0x0,%esi
+  80110b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80110e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801111:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801113:	5b                   	pop    %ebx
+  801114:	5e                   	pop    %esi
+  801115:	5f                   	pop    %edi
+  801116:	5d                   	pop    %ebp
+  801117:	c3                   	ret
+
+00801118 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  801118:	55                   	push   %ebp
+  801119:	89 e5                	mov    %esp,%ebp
+  80111b:	57                   	push   %edi
+  80111c:	56                   	push   %esi
+  80111d:	53                   	push   %ebx
+  80111e:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  801121:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801126:	8b 55 08             	mov    0x8(%ebp),%edx
+  801129:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80112e:	89 cb                	mov    %ecx,%ebx
+  801130:	89 cf                	mov    %ecx,%edi
+  801132:	89 ce                	mov    %ecx,%esi
+  801134:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801136:	85 c0                	test   %eax,%eax
+  801138:	7f 08                	jg     801142 <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  80113a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80113d:	5b                   	pop    %ebx
+  80113e:	5e                   	pop    %esi
+  80113f:	5f                   	pop    %edi
+  801140:	5d                   	pop    %ebp
+  801141:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801142:	83 ec 0c             	sub    $0xc,%esp
+  801145:	50                   	push   %eax
+  801146:	6a 0d                	push   $0xd
+  801148:	68 23 36 80 00       	push   $0x803623
+  80114d:	6a 3e                	push   $0x3e
+  80114f:	68 40 36 80 00       	push   $0x803640
+  801154:	e8 8f f3 ff ff       	call   8004e8 <_panic>
+
+00801159 <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  801159:	55                   	push   %ebp
+  80115a:	89 e5                	mov    %esp,%ebp
+  80115c:	57                   	push   %edi
+  80115d:	56                   	push   %esi
+  80115e:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  80115f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801164:	8b 55 08             	mov    0x8(%ebp),%edx
+  801167:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80116a:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80116f:	89 df                	mov    %ebx,%edi
+  801171:	89 de                	mov    %ebx,%esi
+  801173:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  801175:	5b                   	pop    %ebx
+  801176:	5e                   	pop    %esi
+  801177:	5f                   	pop    %edi
+  801178:	5d                   	pop    %ebp
+  801179:	c3                   	ret
+
+0080117a <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  80117a:	55                   	push   %ebp
+  80117b:	89 e5                	mov    %esp,%ebp
+  80117d:	57                   	push   %edi
+  80117e:	56                   	push   %esi
+  80117f:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  801180:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801185:	8b 55 08             	mov    0x8(%ebp),%edx
+  801188:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80118d:	89 cb                	mov    %ecx,%ebx
+  80118f:	89 cf                	mov    %ecx,%edi
+  801191:	89 ce                	mov    %ecx,%esi
+  801193:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  801195:	5b                   	pop    %ebx
+  801196:	5e                   	pop    %esi
+  801197:	5f                   	pop    %edi
+  801198:	5d                   	pop    %ebp
+  801199:	c3                   	ret
+
+0080119a <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  80119a:	55                   	push   %ebp
+  80119b:	89 e5                	mov    %esp,%ebp
+  80119d:	57                   	push   %edi
+  80119e:	56                   	push   %esi
+  80119f:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8011a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011a5:	b8 10 00 00 00       	mov    $0x10,%eax
+  8011aa:	89 d1                	mov    %edx,%ecx
+  8011ac:	89 d3                	mov    %edx,%ebx
+  8011ae:	89 d7                	mov    %edx,%edi
+  8011b0:	89 d6                	mov    %edx,%esi
+  8011b2:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8011b4:	5b                   	pop    %ebx
+  8011b5:	5e                   	pop    %esi
+  8011b6:	5f                   	pop    %edi
+  8011b7:	5d                   	pop    %ebp
+  8011b8:	c3                   	ret
+
+008011b9 <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  8011b9:	55                   	push   %ebp
+  8011ba:	89 e5                	mov    %esp,%ebp
+  8011bc:	57                   	push   %edi
+  8011bd:	56                   	push   %esi
+  8011be:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8011bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ca:	b8 11 00 00 00       	mov    $0x11,%eax
+  8011cf:	89 df                	mov    %ebx,%edi
+  8011d1:	89 de                	mov    %ebx,%esi
+  8011d3:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  8011d5:	5b                   	pop    %ebx
+  8011d6:	5e                   	pop    %esi
+  8011d7:	5f                   	pop    %edi
+  8011d8:	5d                   	pop    %ebp
+  8011d9:	c3                   	ret
+
+008011da <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  8011da:	55                   	push   %ebp
+  8011db:	89 e5                	mov    %esp,%ebp
+  8011dd:	57                   	push   %edi
+  8011de:	56                   	push   %esi
+  8011df:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  8011e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011e5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011e8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011eb:	b8 12 00 00 00       	mov    $0x12,%eax
+  8011f0:	89 df                	mov    %ebx,%edi
+  8011f2:	89 de                	mov    %ebx,%esi
+  8011f4:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  8011f6:	5b                   	pop    %ebx
+  8011f7:	5e                   	pop    %esi
+  8011f8:	5f                   	pop    %edi
+  8011f9:	5d                   	pop    %ebp
+  8011fa:	c3                   	ret
+
+008011fb <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  8011fb:	55                   	push   %ebp
+  8011fc:	89 e5                	mov    %esp,%ebp
+  8011fe:	57                   	push   %edi
+  8011ff:	56                   	push   %esi
+  801200:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  801201:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801206:	8b 55 08             	mov    0x8(%ebp),%edx
+  801209:	b8 13 00 00 00       	mov    $0x13,%eax
+  80120e:	89 cb                	mov    %ecx,%ebx
+  801210:	89 cf                	mov    %ecx,%edi
+  801212:	89 ce                	mov    %ecx,%esi
+  801214:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  801216:	5b                   	pop    %ebx
+  801217:	5e                   	pop    %esi
+  801218:	5f                   	pop    %edi
+  801219:	5d                   	pop    %ebp
+  80121a:	c3                   	ret
+
+0080121b <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  80121b:	55                   	push   %ebp
+  80121c:	89 e5                	mov    %esp,%ebp
+  80121e:	57                   	push   %edi
+  80121f:	56                   	push   %esi
+  801220:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  801221:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801226:	8b 55 08             	mov    0x8(%ebp),%edx
+  801229:	b8 14 00 00 00       	mov    $0x14,%eax
+  80122e:	89 cb                	mov    %ecx,%ebx
+  801230:	89 cf                	mov    %ecx,%edi
+  801232:	89 ce                	mov    %ecx,%esi
+  801234:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  801236:	5b                   	pop    %ebx
+  801237:	5e                   	pop    %esi
+  801238:	5f                   	pop    %edi
+  801239:	5d                   	pop    %ebp
+  80123a:	c3                   	ret
+
+0080123b <pgfault>:
+//
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf) {
+  80123b:	55                   	push   %ebp
+  80123c:	89 e5                	mov    %esp,%ebp
+  80123e:	53                   	push   %ebx
+  80123f:	83 ec 04             	sub    $0x4,%esp
+  801242:	8b 45 08             	mov    0x8(%ebp),%eax
+    void *addr = (void *) utf->utf_fault_va;
+  801245:	8b 18                	mov    (%eax),%ebx
+    // Hint:
+    //   Use the read-only page table mappings at uvpt
+    //   (see <inc/memlayout.h>).
+
+    // LAB 4: Your code here.
+    if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P) ||
+  801247:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  80124b:	0f 84 95 00 00 00    	je     8012e6 <pgfault+0xab>
+  801251:	89 d8                	mov    %ebx,%eax
+  801253:	c1 e8 16             	shr    $0x16,%eax
+  801256:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80125d:	a8 01                	test   $0x1,%al
+  80125f:	0f 84 81 00 00 00    	je     8012e6 <pgfault+0xab>
+        (uvpt[PGNUM(addr)] & (PTE_P | PTE_COW)) != (PTE_P | PTE_COW)) {
+  801265:	89 d8                	mov    %ebx,%eax
+  801267:	c1 e8 0c             	shr    $0xc,%eax
+  80126a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801271:	25 01 08 00 00       	and    $0x801,%eax
+    if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P) ||
+  801276:	3d 01 08 00 00       	cmp    $0x801,%eax
+  80127b:	75 69                	jne    8012e6 <pgfault+0xab>
+    // Hint:
+    //   You should make three system calls.
+
+    // LAB 4: Your code here.
+
+    if (sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W))
+  80127d:	83 ec 04             	sub    $0x4,%esp
+  801280:	6a 07                	push   $0x7
+  801282:	68 00 f0 7f 00       	push   $0x7ff000
+  801287:	6a 00                	push   $0x0
+  801289:	e8 da fc ff ff       	call   800f68 <sys_page_alloc>
+  80128e:	83 c4 10             	add    $0x10,%esp
+  801291:	85 c0                	test   %eax,%eax
+  801293:	75 65                	jne    8012fa <pgfault+0xbf>
+        panic("sys_page_alloc failed");
+
+    addr = ROUNDDOWN(addr, PGSIZE);
+  801295:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+    memmove(PFTEMP, addr, PGSIZE);
+  80129b:	83 ec 04             	sub    $0x4,%esp
+  80129e:	68 00 10 00 00       	push   $0x1000
+  8012a3:	53                   	push   %ebx
+  8012a4:	68 00 f0 7f 00       	push   $0x7ff000
+  8012a9:	e8 54 fa ff ff       	call   800d02 <memmove>
+
+    if (sys_page_map(0, PFTEMP, 0, addr, PTE_P | PTE_U | PTE_W))
+  8012ae:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8012b5:	53                   	push   %ebx
+  8012b6:	6a 00                	push   $0x0
+  8012b8:	68 00 f0 7f 00       	push   $0x7ff000
+  8012bd:	6a 00                	push   $0x0
+  8012bf:	e8 e7 fc ff ff       	call   800fab <sys_page_map>
+  8012c4:	83 c4 20             	add    $0x20,%esp
+  8012c7:	85 c0                	test   %eax,%eax
+  8012c9:	75 43                	jne    80130e <pgfault+0xd3>
+        panic("sys_page_map failed");
+    if (sys_page_unmap(0, PFTEMP))
+  8012cb:	83 ec 08             	sub    $0x8,%esp
+  8012ce:	68 00 f0 7f 00       	push   $0x7ff000
+  8012d3:	6a 00                	push   $0x0
+  8012d5:	e8 13 fd ff ff       	call   800fed <sys_page_unmap>
+  8012da:	83 c4 10             	add    $0x10,%esp
+  8012dd:	85 c0                	test   %eax,%eax
+  8012df:	75 41                	jne    801322 <pgfault+0xe7>
+        panic("sys_page_unmap failed");
+
+}
+  8012e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012e4:	c9                   	leave
+  8012e5:	c3                   	ret
+        panic("pgfault: faulting access invalid");
+  8012e6:	83 ec 04             	sub    $0x4,%esp
+  8012e9:	68 50 36 80 00       	push   $0x803650
+  8012ee:	6a 1e                	push   $0x1e
+  8012f0:	68 bc 36 80 00       	push   $0x8036bc
+  8012f5:	e8 ee f1 ff ff       	call   8004e8 <_panic>
+        panic("sys_page_alloc failed");
+  8012fa:	83 ec 04             	sub    $0x4,%esp
+  8012fd:	68 2f 37 80 00       	push   $0x80372f
+  801302:	6a 2a                	push   $0x2a
+  801304:	68 bc 36 80 00       	push   $0x8036bc
+  801309:	e8 da f1 ff ff       	call   8004e8 <_panic>
+        panic("sys_page_map failed");
+  80130e:	83 ec 04             	sub    $0x4,%esp
+  801311:	68 c7 36 80 00       	push   $0x8036c7
+  801316:	6a 30                	push   $0x30
+  801318:	68 bc 36 80 00       	push   $0x8036bc
+  80131d:	e8 c6 f1 ff ff       	call   8004e8 <_panic>
+        panic("sys_page_unmap failed");
+  801322:	83 ec 04             	sub    $0x4,%esp
+  801325:	68 db 36 80 00       	push   $0x8036db
+  80132a:	6a 32                	push   $0x32
+  80132c:	68 bc 36 80 00       	push   $0x8036bc
+  801331:	e8 b2 f1 ff ff       	call   8004e8 <_panic>
+
+00801336 <fork>:
+//   Remember to fix "thisenv" in the child process.
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void) {
+  801336:	55                   	push   %ebp
+  801337:	89 e5                	mov    %esp,%ebp
+  801339:	57                   	push   %edi
+  80133a:	56                   	push   %esi
+  80133b:	53                   	push   %ebx
+  80133c:	83 ec 18             	sub    $0x18,%esp
+    // LAB 4: Your code here.
+    set_pgfault_handler(pgfault);
+  80133f:	68 3b 12 80 00       	push   $0x80123b
+  801344:	e8 d4 17 00 00       	call   802b1d <set_pgfault_handler>
+
+// This must be inlined.  Exercise for reader: why?
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+  envid_t ret;
+  asm volatile("int %2"
+  801349:	b8 07 00 00 00       	mov    $0x7,%eax
+  80134e:	cd 30                	int    $0x30
+  801350:	89 c6                	mov    %eax,%esi
+
+    envid_t envid = sys_exofork();
+    if (envid < 0)
+  801352:	83 c4 10             	add    $0x10,%esp
+  801355:	85 c0                	test   %eax,%eax
+  801357:	78 2a                	js     801383 <fork+0x4d>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+
+    uintptr_t addr;
+    for (addr = 0; addr < UTOP; addr += PGSIZE) {
+  801359:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (envid == 0) {
+  80135e:	0f 85 a2 00 00 00    	jne    801406 <fork+0xd0>
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801364:	e8 c1 fb ff ff       	call   800f2a <sys_getenvid>
+  801369:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80136e:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  801371:	c1 e0 04             	shl    $0x4,%eax
+  801374:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801379:	a3 08 50 80 00       	mov    %eax,0x805008
+        return 0;
+  80137e:	e9 6c 01 00 00       	jmp    8014ef <fork+0x1b9>
+        panic("fork: sys_exofork error: %e", envid);
+  801383:	50                   	push   %eax
+  801384:	68 f1 36 80 00       	push   $0x8036f1
+  801389:	6a 6f                	push   $0x6f
+  80138b:	68 bc 36 80 00       	push   $0x8036bc
+  801390:	e8 53 f1 ff ff       	call   8004e8 <_panic>
+        if ((r = sys_page_map(0, vptr, envid, vptr, uvpt[pn] & PTE_SYSCALL)) < 0)
+  801395:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80139c:	83 ec 0c             	sub    $0xc,%esp
+  80139f:	25 07 0e 00 00       	and    $0xe07,%eax
+  8013a4:	50                   	push   %eax
+  8013a5:	57                   	push   %edi
+  8013a6:	56                   	push   %esi
+  8013a7:	57                   	push   %edi
+  8013a8:	6a 00                	push   $0x0
+  8013aa:	e8 fc fb ff ff       	call   800fab <sys_page_map>
+  8013af:	83 c4 20             	add    $0x20,%esp
+  8013b2:	85 c0                	test   %eax,%eax
+  8013b4:	79 3e                	jns    8013f4 <fork+0xbe>
+            panic("duppage :in sys_page_map %e", r);
+  8013b6:	50                   	push   %eax
+  8013b7:	68 0d 37 80 00       	push   $0x80370d
+  8013bc:	6a 49                	push   $0x49
+  8013be:	68 bc 36 80 00       	push   $0x8036bc
+  8013c3:	e8 20 f1 ff ff       	call   8004e8 <_panic>
+            panic("duppage :in sys_page_map %e", r);
+  8013c8:	50                   	push   %eax
+  8013c9:	68 0d 37 80 00       	push   $0x80370d
+  8013ce:	6a 4e                	push   $0x4e
+  8013d0:	68 bc 36 80 00       	push   $0x8036bc
+  8013d5:	e8 0e f1 ff ff       	call   8004e8 <_panic>
+    } else if ((r = sys_page_map(0, vptr, envid, vptr, PTE_P | PTE_U)) < 0)
+  8013da:	83 ec 0c             	sub    $0xc,%esp
+  8013dd:	6a 05                	push   $0x5
+  8013df:	57                   	push   %edi
+  8013e0:	56                   	push   %esi
+  8013e1:	57                   	push   %edi
+  8013e2:	6a 00                	push   $0x0
+  8013e4:	e8 c2 fb ff ff       	call   800fab <sys_page_map>
+  8013e9:	83 c4 20             	add    $0x20,%esp
+  8013ec:	85 c0                	test   %eax,%eax
+  8013ee:	0f 88 ab 00 00 00    	js     80149f <fork+0x169>
+    for (addr = 0; addr < UTOP; addr += PGSIZE) {
+  8013f4:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8013fa:	81 fb 00 00 c0 ee    	cmp    $0xeec00000,%ebx
+  801400:	0f 84 ab 00 00 00    	je     8014b1 <fork+0x17b>
+        if (uvpd[PDX(addr)] & PTE_P && uvpt[PGNUM(addr)] & PTE_P && addr != UXSTACKTOP - PGSIZE) {
+  801406:	89 d8                	mov    %ebx,%eax
+  801408:	c1 e8 16             	shr    $0x16,%eax
+  80140b:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801412:	a8 01                	test   $0x1,%al
+  801414:	74 de                	je     8013f4 <fork+0xbe>
+  801416:	89 d8                	mov    %ebx,%eax
+  801418:	c1 e8 0c             	shr    $0xc,%eax
+  80141b:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801422:	f6 c2 01             	test   $0x1,%dl
+  801425:	74 cd                	je     8013f4 <fork+0xbe>
+  801427:	81 fb 00 f0 bf ee    	cmp    $0xeebff000,%ebx
+  80142d:	74 c5                	je     8013f4 <fork+0xbe>
+    void *vptr = (void *) (pn * PGSIZE);
+  80142f:	89 c7                	mov    %eax,%edi
+  801431:	c1 e7 0c             	shl    $0xc,%edi
+    if (uvpt[pn] & PTE_SHARE) {
+  801434:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80143b:	f6 c6 04             	test   $0x4,%dh
+  80143e:	0f 85 51 ff ff ff    	jne    801395 <fork+0x5f>
+    } else if (uvpt[pn] & (PTE_W | PTE_COW)) {
+  801444:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80144b:	a9 02 08 00 00       	test   $0x802,%eax
+  801450:	74 88                	je     8013da <fork+0xa4>
+        if ((r = sys_page_map(0, vptr, envid, vptr, PTE_P | PTE_U | PTE_COW)) < 0)
+  801452:	83 ec 0c             	sub    $0xc,%esp
+  801455:	68 05 08 00 00       	push   $0x805
+  80145a:	57                   	push   %edi
+  80145b:	56                   	push   %esi
+  80145c:	57                   	push   %edi
+  80145d:	6a 00                	push   $0x0
+  80145f:	e8 47 fb ff ff       	call   800fab <sys_page_map>
+  801464:	83 c4 20             	add    $0x20,%esp
+  801467:	85 c0                	test   %eax,%eax
+  801469:	0f 88 59 ff ff ff    	js     8013c8 <fork+0x92>
+        if ((r = sys_page_map(0, vptr, 0, vptr, PTE_P | PTE_U | PTE_COW)) < 0)
+  80146f:	83 ec 0c             	sub    $0xc,%esp
+  801472:	68 05 08 00 00       	push   $0x805
+  801477:	57                   	push   %edi
+  801478:	6a 00                	push   $0x0
+  80147a:	57                   	push   %edi
+  80147b:	6a 00                	push   $0x0
+  80147d:	e8 29 fb ff ff       	call   800fab <sys_page_map>
+  801482:	83 c4 20             	add    $0x20,%esp
+  801485:	85 c0                	test   %eax,%eax
+  801487:	0f 89 67 ff ff ff    	jns    8013f4 <fork+0xbe>
+            panic("duppage :in sys_page_map %e", r);
+  80148d:	50                   	push   %eax
+  80148e:	68 0d 37 80 00       	push   $0x80370d
+  801493:	6a 50                	push   $0x50
+  801495:	68 bc 36 80 00       	push   $0x8036bc
+  80149a:	e8 49 f0 ff ff       	call   8004e8 <_panic>
+        panic("duppage :in sys_page_map %e", r);
+  80149f:	50                   	push   %eax
+  8014a0:	68 0d 37 80 00       	push   $0x80370d
+  8014a5:	6a 53                	push   $0x53
+  8014a7:	68 bc 36 80 00       	push   $0x8036bc
+  8014ac:	e8 37 f0 ff ff       	call   8004e8 <_panic>
+            duppage(envid, PGNUM(addr));
+        }
+    }
+    if (sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W))
+  8014b1:	83 ec 04             	sub    $0x4,%esp
+  8014b4:	6a 07                	push   $0x7
+  8014b6:	68 00 f0 bf ee       	push   $0xeebff000
+  8014bb:	56                   	push   %esi
+  8014bc:	e8 a7 fa ff ff       	call   800f68 <sys_page_alloc>
+  8014c1:	83 c4 10             	add    $0x10,%esp
+  8014c4:	85 c0                	test   %eax,%eax
+  8014c6:	75 31                	jne    8014f9 <fork+0x1c3>
+        panic("fork: sys_page_alloc failed");
+    if (sys_env_set_pgfault_upcall(envid, _pgfault_upcall))
+  8014c8:	83 ec 08             	sub    $0x8,%esp
+  8014cb:	68 88 2b 80 00       	push   $0x802b88
+  8014d0:	56                   	push   %esi
+  8014d1:	e8 dd fb ff ff       	call   8010b3 <sys_env_set_pgfault_upcall>
+  8014d6:	83 c4 10             	add    $0x10,%esp
+  8014d9:	85 c0                	test   %eax,%eax
+  8014db:	75 30                	jne    80150d <fork+0x1d7>
+        panic("fork: sys_env_set_pgfault_upcall failed");
+    if (sys_env_set_status(envid, ENV_RUNNABLE))
+  8014dd:	83 ec 08             	sub    $0x8,%esp
+  8014e0:	6a 02                	push   $0x2
+  8014e2:	56                   	push   %esi
+  8014e3:	e8 47 fb ff ff       	call   80102f <sys_env_set_status>
+  8014e8:	83 c4 10             	add    $0x10,%esp
+  8014eb:	85 c0                	test   %eax,%eax
+  8014ed:	75 32                	jne    801521 <fork+0x1eb>
+        panic("fork: sys_env_set_status failed");
+
+    return envid;
+
+}
+  8014ef:	89 f0                	mov    %esi,%eax
+  8014f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014f4:	5b                   	pop    %ebx
+  8014f5:	5e                   	pop    %esi
+  8014f6:	5f                   	pop    %edi
+  8014f7:	5d                   	pop    %ebp
+  8014f8:	c3                   	ret
+        panic("fork: sys_page_alloc failed");
+  8014f9:	83 ec 04             	sub    $0x4,%esp
+  8014fc:	68 29 37 80 00       	push   $0x803729
+  801501:	6a 7d                	push   $0x7d
+  801503:	68 bc 36 80 00       	push   $0x8036bc
+  801508:	e8 db ef ff ff       	call   8004e8 <_panic>
+        panic("fork: sys_env_set_pgfault_upcall failed");
+  80150d:	83 ec 04             	sub    $0x4,%esp
+  801510:	68 74 36 80 00       	push   $0x803674
+  801515:	6a 7f                	push   $0x7f
+  801517:	68 bc 36 80 00       	push   $0x8036bc
+  80151c:	e8 c7 ef ff ff       	call   8004e8 <_panic>
+        panic("fork: sys_env_set_status failed");
+  801521:	83 ec 04             	sub    $0x4,%esp
+  801524:	68 9c 36 80 00       	push   $0x80369c
+  801529:	68 81 00 00 00       	push   $0x81
+  80152e:	68 bc 36 80 00       	push   $0x8036bc
+  801533:	e8 b0 ef ff ff       	call   8004e8 <_panic>
+
+00801538 <sfork>:
+
+// Challenge!
+int
+sfork(void) {
+  801538:	55                   	push   %ebp
+  801539:	89 e5                	mov    %esp,%ebp
+  80153b:	83 ec 0c             	sub    $0xc,%esp
+    panic("sfork not implemented");
+  80153e:	68 45 37 80 00       	push   $0x803745
+  801543:	68 8a 00 00 00       	push   $0x8a
+  801548:	68 bc 36 80 00       	push   $0x8036bc
+  80154d:	e8 96 ef ff ff       	call   8004e8 <_panic>
+
+00801552 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801552:	55                   	push   %ebp
+  801553:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801555:	8b 45 08             	mov    0x8(%ebp),%eax
+  801558:	05 00 00 00 30       	add    $0x30000000,%eax
+  80155d:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801560:	5d                   	pop    %ebp
+  801561:	c3                   	ret
+
+00801562 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801562:	55                   	push   %ebp
+  801563:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801565:	8b 45 08             	mov    0x8(%ebp),%eax
+  801568:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80156d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801572:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801577:	5d                   	pop    %ebp
+  801578:	c3                   	ret
+
+00801579 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801579:	55                   	push   %ebp
+  80157a:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80157c:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801581:	eb 02                	jmp    801585 <fd_alloc+0xc>
+  801583:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801585:	89 c2                	mov    %eax,%edx
+  801587:	c1 ea 16             	shr    $0x16,%edx
+  80158a:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801591:	f6 c2 01             	test   $0x1,%dl
+  801594:	74 2b                	je     8015c1 <fd_alloc+0x48>
+  801596:	89 c2                	mov    %eax,%edx
+  801598:	c1 ea 0c             	shr    $0xc,%edx
+  80159b:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8015a2:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8015a8:	f6 c1 01             	test   $0x1,%cl
+  8015ab:	74 14                	je     8015c1 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8015ad:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8015b3:	75 ce                	jne    801583 <fd_alloc+0xa>
+  8015b5:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8015ba:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8015bf:	eb 05                	jmp    8015c6 <fd_alloc+0x4d>
+			return 0;
+  8015c1:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8015c6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015c9:	89 02                	mov    %eax,(%edx)
+}
+  8015cb:	89 c8                	mov    %ecx,%eax
+  8015cd:	5d                   	pop    %ebp
+  8015ce:	c3                   	ret
+
+008015cf <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8015cf:	55                   	push   %ebp
+  8015d0:	89 e5                	mov    %esp,%ebp
+  8015d2:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8015d5:	83 f8 1f             	cmp    $0x1f,%eax
+  8015d8:	77 30                	ja     80160a <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8015da:	c1 e0 0c             	shl    $0xc,%eax
+  8015dd:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8015e2:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8015e8:	f6 c2 01             	test   $0x1,%dl
+  8015eb:	74 24                	je     801611 <fd_lookup+0x42>
+  8015ed:	89 c2                	mov    %eax,%edx
+  8015ef:	c1 ea 0c             	shr    $0xc,%edx
+  8015f2:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8015f9:	f6 c2 01             	test   $0x1,%dl
+  8015fc:	74 1a                	je     801618 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8015fe:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801601:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801603:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801608:	5d                   	pop    %ebp
+  801609:	c3                   	ret
+		return -E_INVAL;
+  80160a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80160f:	eb f7                	jmp    801608 <fd_lookup+0x39>
+		return -E_INVAL;
+  801611:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801616:	eb f0                	jmp    801608 <fd_lookup+0x39>
+  801618:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80161d:	eb e9                	jmp    801608 <fd_lookup+0x39>
+
+0080161f <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80161f:	55                   	push   %ebp
+  801620:	89 e5                	mov    %esp,%ebp
+  801622:	53                   	push   %ebx
+  801623:	83 ec 04             	sub    $0x4,%esp
+  801626:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801629:	b8 00 00 00 00       	mov    $0x0,%eax
+  80162e:	eb 03                	jmp    801633 <dev_lookup+0x14>
+  801630:	83 c0 01             	add    $0x1,%eax
+  801633:	8b 1c 85 d8 37 80 00 	mov    0x8037d8(,%eax,4),%ebx
+  80163a:	85 db                	test   %ebx,%ebx
+  80163c:	74 0b                	je     801649 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  80163e:	39 13                	cmp    %edx,(%ebx)
+  801640:	75 ee                	jne    801630 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801642:	b8 00 00 00 00       	mov    $0x0,%eax
+  801647:	eb 1f                	jmp    801668 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801649:	a1 08 50 80 00       	mov    0x805008,%eax
+  80164e:	8b 40 48             	mov    0x48(%eax),%eax
+  801651:	83 ec 04             	sub    $0x4,%esp
+  801654:	52                   	push   %edx
+  801655:	50                   	push   %eax
+  801656:	68 5c 37 80 00       	push   $0x80375c
+  80165b:	e8 63 ef ff ff       	call   8005c3 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801660:	83 c4 10             	add    $0x10,%esp
+  801663:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801668:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80166b:	89 1a                	mov    %ebx,(%edx)
+}
+  80166d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801670:	c9                   	leave
+  801671:	c3                   	ret
+
+00801672 <fd_close>:
+{
+  801672:	55                   	push   %ebp
+  801673:	89 e5                	mov    %esp,%ebp
+  801675:	57                   	push   %edi
+  801676:	56                   	push   %esi
+  801677:	53                   	push   %ebx
+  801678:	83 ec 24             	sub    $0x24,%esp
+  80167b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80167e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801681:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801684:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801685:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80168b:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80168e:	50                   	push   %eax
+  80168f:	e8 3b ff ff ff       	call   8015cf <fd_lookup>
+  801694:	89 c3                	mov    %eax,%ebx
+  801696:	83 c4 10             	add    $0x10,%esp
+  801699:	85 c0                	test   %eax,%eax
+  80169b:	78 05                	js     8016a2 <fd_close+0x30>
+	    || fd != fd2)
+  80169d:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8016a0:	74 16                	je     8016b8 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8016a2:	89 f8                	mov    %edi,%eax
+  8016a4:	84 c0                	test   %al,%al
+  8016a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016ab:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8016ae:	89 d8                	mov    %ebx,%eax
+  8016b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016b3:	5b                   	pop    %ebx
+  8016b4:	5e                   	pop    %esi
+  8016b5:	5f                   	pop    %edi
+  8016b6:	5d                   	pop    %ebp
+  8016b7:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8016b8:	83 ec 08             	sub    $0x8,%esp
+  8016bb:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8016be:	50                   	push   %eax
+  8016bf:	ff 36                	push   (%esi)
+  8016c1:	e8 59 ff ff ff       	call   80161f <dev_lookup>
+  8016c6:	89 c3                	mov    %eax,%ebx
+  8016c8:	83 c4 10             	add    $0x10,%esp
+  8016cb:	85 c0                	test   %eax,%eax
+  8016cd:	78 1a                	js     8016e9 <fd_close+0x77>
+		if (dev->dev_close)
+  8016cf:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8016d2:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8016d5:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8016da:	85 c0                	test   %eax,%eax
+  8016dc:	74 0b                	je     8016e9 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8016de:	83 ec 0c             	sub    $0xc,%esp
+  8016e1:	56                   	push   %esi
+  8016e2:	ff d0                	call   *%eax
+  8016e4:	89 c3                	mov    %eax,%ebx
+  8016e6:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8016e9:	83 ec 08             	sub    $0x8,%esp
+  8016ec:	56                   	push   %esi
+  8016ed:	6a 00                	push   $0x0
+  8016ef:	e8 f9 f8 ff ff       	call   800fed <sys_page_unmap>
+	return r;
+  8016f4:	83 c4 10             	add    $0x10,%esp
+  8016f7:	eb b5                	jmp    8016ae <fd_close+0x3c>
+
+008016f9 <close>:
+
+int
+close(int fdnum)
+{
+  8016f9:	55                   	push   %ebp
+  8016fa:	89 e5                	mov    %esp,%ebp
+  8016fc:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8016ff:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801702:	50                   	push   %eax
+  801703:	ff 75 08             	push   0x8(%ebp)
+  801706:	e8 c4 fe ff ff       	call   8015cf <fd_lookup>
+  80170b:	83 c4 10             	add    $0x10,%esp
+  80170e:	85 c0                	test   %eax,%eax
+  801710:	79 02                	jns    801714 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801712:	c9                   	leave
+  801713:	c3                   	ret
+		return fd_close(fd, 1);
+  801714:	83 ec 08             	sub    $0x8,%esp
+  801717:	6a 01                	push   $0x1
+  801719:	ff 75 f4             	push   -0xc(%ebp)
+  80171c:	e8 51 ff ff ff       	call   801672 <fd_close>
+  801721:	83 c4 10             	add    $0x10,%esp
+  801724:	eb ec                	jmp    801712 <close+0x19>
+
+00801726 <close_all>:
+
+void
+close_all(void)
+{
+  801726:	55                   	push   %ebp
+  801727:	89 e5                	mov    %esp,%ebp
+  801729:	53                   	push   %ebx
+  80172a:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80172d:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801732:	83 ec 0c             	sub    $0xc,%esp
+  801735:	53                   	push   %ebx
+  801736:	e8 be ff ff ff       	call   8016f9 <close>
+	for (i = 0; i < MAXFD; i++)
+  80173b:	83 c3 01             	add    $0x1,%ebx
+  80173e:	83 c4 10             	add    $0x10,%esp
+  801741:	83 fb 20             	cmp    $0x20,%ebx
+  801744:	75 ec                	jne    801732 <close_all+0xc>
+}
+  801746:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801749:	c9                   	leave
+  80174a:	c3                   	ret
+
+0080174b <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80174b:	55                   	push   %ebp
+  80174c:	89 e5                	mov    %esp,%ebp
+  80174e:	57                   	push   %edi
+  80174f:	56                   	push   %esi
+  801750:	53                   	push   %ebx
+  801751:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801754:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801757:	50                   	push   %eax
+  801758:	ff 75 08             	push   0x8(%ebp)
+  80175b:	e8 6f fe ff ff       	call   8015cf <fd_lookup>
+  801760:	89 c3                	mov    %eax,%ebx
+  801762:	83 c4 10             	add    $0x10,%esp
+  801765:	85 c0                	test   %eax,%eax
+  801767:	78 7f                	js     8017e8 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801769:	83 ec 0c             	sub    $0xc,%esp
+  80176c:	ff 75 0c             	push   0xc(%ebp)
+  80176f:	e8 85 ff ff ff       	call   8016f9 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801774:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801777:	c1 e6 0c             	shl    $0xc,%esi
+  80177a:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801780:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801783:	89 3c 24             	mov    %edi,(%esp)
+  801786:	e8 d7 fd ff ff       	call   801562 <fd2data>
+  80178b:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80178d:	89 34 24             	mov    %esi,(%esp)
+  801790:	e8 cd fd ff ff       	call   801562 <fd2data>
+  801795:	83 c4 10             	add    $0x10,%esp
+  801798:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80179b:	89 d8                	mov    %ebx,%eax
+  80179d:	c1 e8 16             	shr    $0x16,%eax
+  8017a0:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8017a7:	a8 01                	test   $0x1,%al
+  8017a9:	74 11                	je     8017bc <dup+0x71>
+  8017ab:	89 d8                	mov    %ebx,%eax
+  8017ad:	c1 e8 0c             	shr    $0xc,%eax
+  8017b0:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8017b7:	f6 c2 01             	test   $0x1,%dl
+  8017ba:	75 36                	jne    8017f2 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8017bc:	89 f8                	mov    %edi,%eax
+  8017be:	c1 e8 0c             	shr    $0xc,%eax
+  8017c1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8017c8:	83 ec 0c             	sub    $0xc,%esp
+  8017cb:	25 07 0e 00 00       	and    $0xe07,%eax
+  8017d0:	50                   	push   %eax
+  8017d1:	56                   	push   %esi
+  8017d2:	6a 00                	push   $0x0
+  8017d4:	57                   	push   %edi
+  8017d5:	6a 00                	push   $0x0
+  8017d7:	e8 cf f7 ff ff       	call   800fab <sys_page_map>
+  8017dc:	89 c3                	mov    %eax,%ebx
+  8017de:	83 c4 20             	add    $0x20,%esp
+  8017e1:	85 c0                	test   %eax,%eax
+  8017e3:	78 33                	js     801818 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8017e5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8017e8:	89 d8                	mov    %ebx,%eax
+  8017ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017ed:	5b                   	pop    %ebx
+  8017ee:	5e                   	pop    %esi
+  8017ef:	5f                   	pop    %edi
+  8017f0:	5d                   	pop    %ebp
+  8017f1:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8017f2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8017f9:	83 ec 0c             	sub    $0xc,%esp
+  8017fc:	25 07 0e 00 00       	and    $0xe07,%eax
+  801801:	50                   	push   %eax
+  801802:	ff 75 d4             	push   -0x2c(%ebp)
+  801805:	6a 00                	push   $0x0
+  801807:	53                   	push   %ebx
+  801808:	6a 00                	push   $0x0
+  80180a:	e8 9c f7 ff ff       	call   800fab <sys_page_map>
+  80180f:	89 c3                	mov    %eax,%ebx
+  801811:	83 c4 20             	add    $0x20,%esp
+  801814:	85 c0                	test   %eax,%eax
+  801816:	79 a4                	jns    8017bc <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801818:	83 ec 08             	sub    $0x8,%esp
+  80181b:	56                   	push   %esi
+  80181c:	6a 00                	push   $0x0
+  80181e:	e8 ca f7 ff ff       	call   800fed <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801823:	83 c4 08             	add    $0x8,%esp
+  801826:	ff 75 d4             	push   -0x2c(%ebp)
+  801829:	6a 00                	push   $0x0
+  80182b:	e8 bd f7 ff ff       	call   800fed <sys_page_unmap>
+	return r;
+  801830:	83 c4 10             	add    $0x10,%esp
+  801833:	eb b3                	jmp    8017e8 <dup+0x9d>
+
+00801835 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801835:	55                   	push   %ebp
+  801836:	89 e5                	mov    %esp,%ebp
+  801838:	56                   	push   %esi
+  801839:	53                   	push   %ebx
+  80183a:	83 ec 18             	sub    $0x18,%esp
+  80183d:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801840:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801843:	50                   	push   %eax
+  801844:	56                   	push   %esi
+  801845:	e8 85 fd ff ff       	call   8015cf <fd_lookup>
+  80184a:	83 c4 10             	add    $0x10,%esp
+  80184d:	85 c0                	test   %eax,%eax
+  80184f:	78 3c                	js     80188d <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801851:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801854:	83 ec 08             	sub    $0x8,%esp
+  801857:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80185a:	50                   	push   %eax
+  80185b:	ff 33                	push   (%ebx)
+  80185d:	e8 bd fd ff ff       	call   80161f <dev_lookup>
+  801862:	83 c4 10             	add    $0x10,%esp
+  801865:	85 c0                	test   %eax,%eax
+  801867:	78 24                	js     80188d <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801869:	8b 43 08             	mov    0x8(%ebx),%eax
+  80186c:	83 e0 03             	and    $0x3,%eax
+  80186f:	83 f8 01             	cmp    $0x1,%eax
+  801872:	74 20                	je     801894 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801874:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801877:	8b 40 08             	mov    0x8(%eax),%eax
+  80187a:	85 c0                	test   %eax,%eax
+  80187c:	74 37                	je     8018b5 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80187e:	83 ec 04             	sub    $0x4,%esp
+  801881:	ff 75 10             	push   0x10(%ebp)
+  801884:	ff 75 0c             	push   0xc(%ebp)
+  801887:	53                   	push   %ebx
+  801888:	ff d0                	call   *%eax
+  80188a:	83 c4 10             	add    $0x10,%esp
+}
+  80188d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801890:	5b                   	pop    %ebx
+  801891:	5e                   	pop    %esi
+  801892:	5d                   	pop    %ebp
+  801893:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801894:	a1 08 50 80 00       	mov    0x805008,%eax
+  801899:	8b 40 48             	mov    0x48(%eax),%eax
+  80189c:	83 ec 04             	sub    $0x4,%esp
+  80189f:	56                   	push   %esi
+  8018a0:	50                   	push   %eax
+  8018a1:	68 9d 37 80 00       	push   $0x80379d
+  8018a6:	e8 18 ed ff ff       	call   8005c3 <cprintf>
+		return -E_INVAL;
+  8018ab:	83 c4 10             	add    $0x10,%esp
+  8018ae:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018b3:	eb d8                	jmp    80188d <read+0x58>
+		return -E_NOT_SUPP;
+  8018b5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8018ba:	eb d1                	jmp    80188d <read+0x58>
+
+008018bc <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8018bc:	55                   	push   %ebp
+  8018bd:	89 e5                	mov    %esp,%ebp
+  8018bf:	57                   	push   %edi
+  8018c0:	56                   	push   %esi
+  8018c1:	53                   	push   %ebx
+  8018c2:	83 ec 0c             	sub    $0xc,%esp
+  8018c5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8018c8:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8018cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018d0:	eb 02                	jmp    8018d4 <readn+0x18>
+  8018d2:	01 c3                	add    %eax,%ebx
+  8018d4:	39 f3                	cmp    %esi,%ebx
+  8018d6:	73 21                	jae    8018f9 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8018d8:	83 ec 04             	sub    $0x4,%esp
+  8018db:	89 f0                	mov    %esi,%eax
+  8018dd:	29 d8                	sub    %ebx,%eax
+  8018df:	50                   	push   %eax
+  8018e0:	89 d8                	mov    %ebx,%eax
+  8018e2:	03 45 0c             	add    0xc(%ebp),%eax
+  8018e5:	50                   	push   %eax
+  8018e6:	57                   	push   %edi
+  8018e7:	e8 49 ff ff ff       	call   801835 <read>
+		if (m < 0)
+  8018ec:	83 c4 10             	add    $0x10,%esp
+  8018ef:	85 c0                	test   %eax,%eax
+  8018f1:	78 04                	js     8018f7 <readn+0x3b>
+			return m;
+		if (m == 0)
+  8018f3:	75 dd                	jne    8018d2 <readn+0x16>
+  8018f5:	eb 02                	jmp    8018f9 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8018f7:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8018f9:	89 d8                	mov    %ebx,%eax
+  8018fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018fe:	5b                   	pop    %ebx
+  8018ff:	5e                   	pop    %esi
+  801900:	5f                   	pop    %edi
+  801901:	5d                   	pop    %ebp
+  801902:	c3                   	ret
+
+00801903 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801903:	55                   	push   %ebp
+  801904:	89 e5                	mov    %esp,%ebp
+  801906:	56                   	push   %esi
+  801907:	53                   	push   %ebx
+  801908:	83 ec 18             	sub    $0x18,%esp
+  80190b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80190e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801911:	50                   	push   %eax
+  801912:	53                   	push   %ebx
+  801913:	e8 b7 fc ff ff       	call   8015cf <fd_lookup>
+  801918:	83 c4 10             	add    $0x10,%esp
+  80191b:	85 c0                	test   %eax,%eax
+  80191d:	78 37                	js     801956 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80191f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801922:	83 ec 08             	sub    $0x8,%esp
+  801925:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801928:	50                   	push   %eax
+  801929:	ff 36                	push   (%esi)
+  80192b:	e8 ef fc ff ff       	call   80161f <dev_lookup>
+  801930:	83 c4 10             	add    $0x10,%esp
+  801933:	85 c0                	test   %eax,%eax
+  801935:	78 1f                	js     801956 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801937:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80193b:	74 20                	je     80195d <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80193d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801940:	8b 40 0c             	mov    0xc(%eax),%eax
+  801943:	85 c0                	test   %eax,%eax
+  801945:	74 37                	je     80197e <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801947:	83 ec 04             	sub    $0x4,%esp
+  80194a:	ff 75 10             	push   0x10(%ebp)
+  80194d:	ff 75 0c             	push   0xc(%ebp)
+  801950:	56                   	push   %esi
+  801951:	ff d0                	call   *%eax
+  801953:	83 c4 10             	add    $0x10,%esp
+}
+  801956:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801959:	5b                   	pop    %ebx
+  80195a:	5e                   	pop    %esi
+  80195b:	5d                   	pop    %ebp
+  80195c:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80195d:	a1 08 50 80 00       	mov    0x805008,%eax
+  801962:	8b 40 48             	mov    0x48(%eax),%eax
+  801965:	83 ec 04             	sub    $0x4,%esp
+  801968:	53                   	push   %ebx
+  801969:	50                   	push   %eax
+  80196a:	68 b9 37 80 00       	push   $0x8037b9
+  80196f:	e8 4f ec ff ff       	call   8005c3 <cprintf>
+		return -E_INVAL;
+  801974:	83 c4 10             	add    $0x10,%esp
+  801977:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80197c:	eb d8                	jmp    801956 <write+0x53>
+		return -E_NOT_SUPP;
+  80197e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801983:	eb d1                	jmp    801956 <write+0x53>
+
+00801985 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801985:	55                   	push   %ebp
+  801986:	89 e5                	mov    %esp,%ebp
+  801988:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80198b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80198e:	50                   	push   %eax
+  80198f:	ff 75 08             	push   0x8(%ebp)
+  801992:	e8 38 fc ff ff       	call   8015cf <fd_lookup>
+  801997:	83 c4 10             	add    $0x10,%esp
+  80199a:	85 c0                	test   %eax,%eax
+  80199c:	78 0e                	js     8019ac <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80199e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8019a1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019a4:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8019a7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019ac:	c9                   	leave
+  8019ad:	c3                   	ret
+
+008019ae <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8019ae:	55                   	push   %ebp
+  8019af:	89 e5                	mov    %esp,%ebp
+  8019b1:	56                   	push   %esi
+  8019b2:	53                   	push   %ebx
+  8019b3:	83 ec 18             	sub    $0x18,%esp
+  8019b6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8019b9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8019bc:	50                   	push   %eax
+  8019bd:	53                   	push   %ebx
+  8019be:	e8 0c fc ff ff       	call   8015cf <fd_lookup>
+  8019c3:	83 c4 10             	add    $0x10,%esp
+  8019c6:	85 c0                	test   %eax,%eax
+  8019c8:	78 34                	js     8019fe <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8019ca:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8019cd:	83 ec 08             	sub    $0x8,%esp
+  8019d0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019d3:	50                   	push   %eax
+  8019d4:	ff 36                	push   (%esi)
+  8019d6:	e8 44 fc ff ff       	call   80161f <dev_lookup>
+  8019db:	83 c4 10             	add    $0x10,%esp
+  8019de:	85 c0                	test   %eax,%eax
+  8019e0:	78 1c                	js     8019fe <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8019e2:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8019e6:	74 1d                	je     801a05 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8019e8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019eb:	8b 40 18             	mov    0x18(%eax),%eax
+  8019ee:	85 c0                	test   %eax,%eax
+  8019f0:	74 34                	je     801a26 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8019f2:	83 ec 08             	sub    $0x8,%esp
+  8019f5:	ff 75 0c             	push   0xc(%ebp)
+  8019f8:	56                   	push   %esi
+  8019f9:	ff d0                	call   *%eax
+  8019fb:	83 c4 10             	add    $0x10,%esp
+}
+  8019fe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a01:	5b                   	pop    %ebx
+  801a02:	5e                   	pop    %esi
+  801a03:	5d                   	pop    %ebp
+  801a04:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801a05:	a1 08 50 80 00       	mov    0x805008,%eax
+  801a0a:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801a0d:	83 ec 04             	sub    $0x4,%esp
+  801a10:	53                   	push   %ebx
+  801a11:	50                   	push   %eax
+  801a12:	68 7c 37 80 00       	push   $0x80377c
+  801a17:	e8 a7 eb ff ff       	call   8005c3 <cprintf>
+		return -E_INVAL;
+  801a1c:	83 c4 10             	add    $0x10,%esp
+  801a1f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a24:	eb d8                	jmp    8019fe <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801a26:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a2b:	eb d1                	jmp    8019fe <ftruncate+0x50>
+
+00801a2d <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801a2d:	55                   	push   %ebp
+  801a2e:	89 e5                	mov    %esp,%ebp
+  801a30:	56                   	push   %esi
+  801a31:	53                   	push   %ebx
+  801a32:	83 ec 18             	sub    $0x18,%esp
+  801a35:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a38:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a3b:	50                   	push   %eax
+  801a3c:	ff 75 08             	push   0x8(%ebp)
+  801a3f:	e8 8b fb ff ff       	call   8015cf <fd_lookup>
+  801a44:	83 c4 10             	add    $0x10,%esp
+  801a47:	85 c0                	test   %eax,%eax
+  801a49:	78 49                	js     801a94 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801a4b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a4e:	83 ec 08             	sub    $0x8,%esp
+  801a51:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a54:	50                   	push   %eax
+  801a55:	ff 36                	push   (%esi)
+  801a57:	e8 c3 fb ff ff       	call   80161f <dev_lookup>
+  801a5c:	83 c4 10             	add    $0x10,%esp
+  801a5f:	85 c0                	test   %eax,%eax
+  801a61:	78 31                	js     801a94 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801a63:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a66:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801a6a:	74 2f                	je     801a9b <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801a6c:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801a6f:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801a76:	00 00 00 
+	stat->st_isdir = 0;
+  801a79:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801a80:	00 00 00 
+	stat->st_dev = dev;
+  801a83:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801a89:	83 ec 08             	sub    $0x8,%esp
+  801a8c:	53                   	push   %ebx
+  801a8d:	56                   	push   %esi
+  801a8e:	ff 50 14             	call   *0x14(%eax)
+  801a91:	83 c4 10             	add    $0x10,%esp
+}
+  801a94:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a97:	5b                   	pop    %ebx
+  801a98:	5e                   	pop    %esi
+  801a99:	5d                   	pop    %ebp
+  801a9a:	c3                   	ret
+		return -E_NOT_SUPP;
+  801a9b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801aa0:	eb f2                	jmp    801a94 <fstat+0x67>
+
+00801aa2 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801aa2:	55                   	push   %ebp
+  801aa3:	89 e5                	mov    %esp,%ebp
+  801aa5:	56                   	push   %esi
+  801aa6:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801aa7:	83 ec 08             	sub    $0x8,%esp
+  801aaa:	6a 00                	push   $0x0
+  801aac:	ff 75 08             	push   0x8(%ebp)
+  801aaf:	e8 e4 01 00 00       	call   801c98 <open>
+  801ab4:	89 c3                	mov    %eax,%ebx
+  801ab6:	83 c4 10             	add    $0x10,%esp
+  801ab9:	85 c0                	test   %eax,%eax
+  801abb:	78 1b                	js     801ad8 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801abd:	83 ec 08             	sub    $0x8,%esp
+  801ac0:	ff 75 0c             	push   0xc(%ebp)
+  801ac3:	50                   	push   %eax
+  801ac4:	e8 64 ff ff ff       	call   801a2d <fstat>
+  801ac9:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801acb:	89 1c 24             	mov    %ebx,(%esp)
+  801ace:	e8 26 fc ff ff       	call   8016f9 <close>
+	return r;
+  801ad3:	83 c4 10             	add    $0x10,%esp
+  801ad6:	89 f3                	mov    %esi,%ebx
+}
+  801ad8:	89 d8                	mov    %ebx,%eax
+  801ada:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801add:	5b                   	pop    %ebx
+  801ade:	5e                   	pop    %esi
+  801adf:	5d                   	pop    %ebp
+  801ae0:	c3                   	ret
+
+00801ae1 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  801ae1:	55                   	push   %ebp
+  801ae2:	89 e5                	mov    %esp,%ebp
+  801ae4:	56                   	push   %esi
+  801ae5:	53                   	push   %ebx
+  801ae6:	89 c6                	mov    %eax,%esi
+  801ae8:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  801aea:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  801af1:	74 27                	je     801b1a <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801af3:	6a 07                	push   $0x7
+  801af5:	68 00 60 80 00       	push   $0x806000
+  801afa:	56                   	push   %esi
+  801afb:	ff 35 00 50 80 00    	push   0x805000
+  801b01:	e8 1a 11 00 00       	call   802c20 <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  801b06:	83 c4 0c             	add    $0xc,%esp
+  801b09:	6a 00                	push   $0x0
+  801b0b:	53                   	push   %ebx
+  801b0c:	6a 00                	push   $0x0
+  801b0e:	e8 99 10 00 00       	call   802bac <ipc_recv>
+}
+  801b13:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b16:	5b                   	pop    %ebx
+  801b17:	5e                   	pop    %esi
+  801b18:	5d                   	pop    %ebp
+  801b19:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  801b1a:	83 ec 0c             	sub    $0xc,%esp
+  801b1d:	6a 01                	push   $0x1
+  801b1f:	e8 50 11 00 00       	call   802c74 <ipc_find_env>
+  801b24:	a3 00 50 80 00       	mov    %eax,0x805000
+  801b29:	83 c4 10             	add    $0x10,%esp
+  801b2c:	eb c5                	jmp    801af3 <fsipc+0x12>
+
+00801b2e <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801b2e:	55                   	push   %ebp
+  801b2f:	89 e5                	mov    %esp,%ebp
+  801b31:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801b34:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b37:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b3a:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.set_size.req_size = newsize;
+  801b3f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b42:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801b47:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b4c:	b8 02 00 00 00       	mov    $0x2,%eax
+  801b51:	e8 8b ff ff ff       	call   801ae1 <fsipc>
+}
+  801b56:	c9                   	leave
+  801b57:	c3                   	ret
+
+00801b58 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801b58:	55                   	push   %ebp
+  801b59:	89 e5                	mov    %esp,%ebp
+  801b5b:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801b5e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b61:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b64:	a3 00 60 80 00       	mov    %eax,0x806000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801b69:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b6e:	b8 06 00 00 00       	mov    $0x6,%eax
+  801b73:	e8 69 ff ff ff       	call   801ae1 <fsipc>
+}
+  801b78:	c9                   	leave
+  801b79:	c3                   	ret
+
+00801b7a <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801b7a:	55                   	push   %ebp
+  801b7b:	89 e5                	mov    %esp,%ebp
+  801b7d:	53                   	push   %ebx
+  801b7e:	83 ec 04             	sub    $0x4,%esp
+  801b81:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801b84:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b87:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b8a:	a3 00 60 80 00       	mov    %eax,0x806000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801b8f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b94:	b8 05 00 00 00       	mov    $0x5,%eax
+  801b99:	e8 43 ff ff ff       	call   801ae1 <fsipc>
+  801b9e:	85 c0                	test   %eax,%eax
+  801ba0:	78 2c                	js     801bce <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801ba2:	83 ec 08             	sub    $0x8,%esp
+  801ba5:	68 00 60 80 00       	push   $0x806000
+  801baa:	53                   	push   %ebx
+  801bab:	e8 cc ef ff ff       	call   800b7c <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801bb0:	a1 80 60 80 00       	mov    0x806080,%eax
+  801bb5:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801bbb:	a1 84 60 80 00       	mov    0x806084,%eax
+  801bc0:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801bc6:	83 c4 10             	add    $0x10,%esp
+  801bc9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801bce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bd1:	c9                   	leave
+  801bd2:	c3                   	ret
+
+00801bd3 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801bd3:	55                   	push   %ebp
+  801bd4:	89 e5                	mov    %esp,%ebp
+  801bd6:	83 ec 0c             	sub    $0xc,%esp
+  801bd9:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801bdc:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bdf:	8b 52 0c             	mov    0xc(%edx),%edx
+  801be2:	89 15 00 60 80 00    	mov    %edx,0x806000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801be8:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801bed:	39 d0                	cmp    %edx,%eax
+  801bef:	0f 47 c2             	cmova  %edx,%eax
+  801bf2:	a3 04 60 80 00       	mov    %eax,0x806004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  801bf7:	50                   	push   %eax
+  801bf8:	ff 75 0c             	push   0xc(%ebp)
+  801bfb:	68 08 60 80 00       	push   $0x806008
+  801c00:	e8 fd f0 ff ff       	call   800d02 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801c05:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c0a:	b8 04 00 00 00       	mov    $0x4,%eax
+  801c0f:	e8 cd fe ff ff       	call   801ae1 <fsipc>
+}
+  801c14:	c9                   	leave
+  801c15:	c3                   	ret
+
+00801c16 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801c16:	55                   	push   %ebp
+  801c17:	89 e5                	mov    %esp,%ebp
+  801c19:	56                   	push   %esi
+  801c1a:	53                   	push   %ebx
+  801c1b:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801c1e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c21:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c24:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read.req_n = n;
+  801c29:	89 35 04 60 80 00    	mov    %esi,0x806004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801c2f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c34:	b8 03 00 00 00       	mov    $0x3,%eax
+  801c39:	e8 a3 fe ff ff       	call   801ae1 <fsipc>
+  801c3e:	89 c3                	mov    %eax,%ebx
+  801c40:	85 c0                	test   %eax,%eax
+  801c42:	78 1f                	js     801c63 <devfile_read+0x4d>
+  assert(r <= n);
+  801c44:	39 c6                	cmp    %eax,%esi
+  801c46:	72 24                	jb     801c6c <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  801c48:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801c4d:	7f 33                	jg     801c82 <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801c4f:	83 ec 04             	sub    $0x4,%esp
+  801c52:	50                   	push   %eax
+  801c53:	68 00 60 80 00       	push   $0x806000
+  801c58:	ff 75 0c             	push   0xc(%ebp)
+  801c5b:	e8 a2 f0 ff ff       	call   800d02 <memmove>
+  return r;
+  801c60:	83 c4 10             	add    $0x10,%esp
+}
+  801c63:	89 d8                	mov    %ebx,%eax
+  801c65:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c68:	5b                   	pop    %ebx
+  801c69:	5e                   	pop    %esi
+  801c6a:	5d                   	pop    %ebp
+  801c6b:	c3                   	ret
+  assert(r <= n);
+  801c6c:	68 ec 37 80 00       	push   $0x8037ec
+  801c71:	68 f3 37 80 00       	push   $0x8037f3
+  801c76:	6a 78                	push   $0x78
+  801c78:	68 08 38 80 00       	push   $0x803808
+  801c7d:	e8 66 e8 ff ff       	call   8004e8 <_panic>
+  assert(r <= PGSIZE);
+  801c82:	68 13 38 80 00       	push   $0x803813
+  801c87:	68 f3 37 80 00       	push   $0x8037f3
+  801c8c:	6a 79                	push   $0x79
+  801c8e:	68 08 38 80 00       	push   $0x803808
+  801c93:	e8 50 e8 ff ff       	call   8004e8 <_panic>
+
+00801c98 <open>:
+open(const char *path, int mode) {
+  801c98:	55                   	push   %ebp
+  801c99:	89 e5                	mov    %esp,%ebp
+  801c9b:	56                   	push   %esi
+  801c9c:	53                   	push   %ebx
+  801c9d:	83 ec 1c             	sub    $0x1c,%esp
+  801ca0:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801ca3:	56                   	push   %esi
+  801ca4:	e8 98 ee ff ff       	call   800b41 <strlen>
+  801ca9:	83 c4 10             	add    $0x10,%esp
+  801cac:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801cb1:	7f 6c                	jg     801d1f <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801cb3:	83 ec 0c             	sub    $0xc,%esp
+  801cb6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cb9:	50                   	push   %eax
+  801cba:	e8 ba f8 ff ff       	call   801579 <fd_alloc>
+  801cbf:	89 c3                	mov    %eax,%ebx
+  801cc1:	83 c4 10             	add    $0x10,%esp
+  801cc4:	85 c0                	test   %eax,%eax
+  801cc6:	78 3c                	js     801d04 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801cc8:	83 ec 08             	sub    $0x8,%esp
+  801ccb:	56                   	push   %esi
+  801ccc:	68 00 60 80 00       	push   $0x806000
+  801cd1:	e8 a6 ee ff ff       	call   800b7c <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801cd6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801cd9:	a3 00 64 80 00       	mov    %eax,0x806400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801cde:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801ce1:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ce6:	e8 f6 fd ff ff       	call   801ae1 <fsipc>
+  801ceb:	89 c3                	mov    %eax,%ebx
+  801ced:	83 c4 10             	add    $0x10,%esp
+  801cf0:	85 c0                	test   %eax,%eax
+  801cf2:	78 19                	js     801d0d <open+0x75>
+  return fd2num(fd);
+  801cf4:	83 ec 0c             	sub    $0xc,%esp
+  801cf7:	ff 75 f4             	push   -0xc(%ebp)
+  801cfa:	e8 53 f8 ff ff       	call   801552 <fd2num>
+  801cff:	89 c3                	mov    %eax,%ebx
+  801d01:	83 c4 10             	add    $0x10,%esp
+}
+  801d04:	89 d8                	mov    %ebx,%eax
+  801d06:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d09:	5b                   	pop    %ebx
+  801d0a:	5e                   	pop    %esi
+  801d0b:	5d                   	pop    %ebp
+  801d0c:	c3                   	ret
+    fd_close(fd, 0);
+  801d0d:	83 ec 08             	sub    $0x8,%esp
+  801d10:	6a 00                	push   $0x0
+  801d12:	ff 75 f4             	push   -0xc(%ebp)
+  801d15:	e8 58 f9 ff ff       	call   801672 <fd_close>
+    return r;
+  801d1a:	83 c4 10             	add    $0x10,%esp
+  801d1d:	eb e5                	jmp    801d04 <open+0x6c>
+    return -E_BAD_PATH;
+  801d1f:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801d24:	eb de                	jmp    801d04 <open+0x6c>
+
+00801d26 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  801d26:	55                   	push   %ebp
+  801d27:	89 e5                	mov    %esp,%ebp
+  801d29:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801d2c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d31:	b8 08 00 00 00       	mov    $0x8,%eax
+  801d36:	e8 a6 fd ff ff       	call   801ae1 <fsipc>
+}
+  801d3b:	c9                   	leave
+  801d3c:	c3                   	ret
+
+00801d3d <spawn>:
+// prog: the pathname of the program to run.
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv) {
+  801d3d:	55                   	push   %ebp
+  801d3e:	89 e5                	mov    %esp,%ebp
+  801d40:	57                   	push   %edi
+  801d41:	56                   	push   %esi
+  801d42:	53                   	push   %ebx
+  801d43:	81 ec 84 02 00 00    	sub    $0x284,%esp
+  //   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+  //     correct initial eip and esp values in the child.
+  //
+  //   - Start the child process running with sys_env_set_status().
+
+  if ((r = open(prog, O_RDONLY)) < 0)
+  801d49:	6a 00                	push   $0x0
+  801d4b:	ff 75 08             	push   0x8(%ebp)
+  801d4e:	e8 45 ff ff ff       	call   801c98 <open>
+  801d53:	89 85 8c fd ff ff    	mov    %eax,-0x274(%ebp)
+  801d59:	83 c4 10             	add    $0x10,%esp
+  801d5c:	85 c0                	test   %eax,%eax
+  801d5e:	0f 88 f8 04 00 00    	js     80225c <spawn+0x51f>
+  801d64:	89 c1                	mov    %eax,%ecx
+    return r;
+  fd = r;
+
+  // Read elf header
+  elf = (struct Elf *) elf_buf;
+  if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf)
+  801d66:	83 ec 04             	sub    $0x4,%esp
+  801d69:	68 00 02 00 00       	push   $0x200
+  801d6e:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  801d74:	50                   	push   %eax
+  801d75:	51                   	push   %ecx
+  801d76:	e8 41 fb ff ff       	call   8018bc <readn>
+  801d7b:	83 c4 10             	add    $0x10,%esp
+  801d7e:	3d 00 02 00 00       	cmp    $0x200,%eax
+  801d83:	75 5a                	jne    801ddf <spawn+0xa2>
+      || elf->e_magic != ELF_MAGIC) {
+  801d85:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  801d8c:	45 4c 46 
+  801d8f:	75 4e                	jne    801ddf <spawn+0xa2>
+  801d91:	b8 07 00 00 00       	mov    $0x7,%eax
+  801d96:	cd 30                	int    $0x30
+  801d98:	89 85 88 fd ff ff    	mov    %eax,-0x278(%ebp)
+    cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+    return -E_NOT_EXEC;
+  }
+
+  // Create new child environment
+  if ((r = sys_exofork()) < 0)
+  801d9e:	85 c0                	test   %eax,%eax
+  801da0:	0f 88 aa 04 00 00    	js     802250 <spawn+0x513>
+    return r;
+  child = r;
+
+  // Set up trap frame, including initial stack.
+  child_tf = envs[ENVX(child)].env_tf;
+  801da6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801dab:	8d 34 c0             	lea    (%eax,%eax,8),%esi
+  801dae:	c1 e6 04             	shl    $0x4,%esi
+  801db1:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  801db7:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  801dbd:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801dc2:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  child_tf.tf_eip = elf->e_entry;
+  801dc4:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  801dca:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  uintptr_t *argv_store;
+
+  // Count the number of arguments (argc)
+  // and the total amount of space needed for strings (string_size).
+  string_size = 0;
+  for (argc = 0; argv[argc] != 0; argc++)
+  801dd0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  string_size = 0;
+  801dd5:	be 00 00 00 00       	mov    $0x0,%esi
+  801dda:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  for (argc = 0; argv[argc] != 0; argc++)
+  801ddd:	eb 4b                	jmp    801e2a <spawn+0xed>
+    close(fd);
+  801ddf:	83 ec 0c             	sub    $0xc,%esp
+  801de2:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  801de8:	e8 0c f9 ff ff       	call   8016f9 <close>
+    cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  801ded:	83 c4 0c             	add    $0xc,%esp
+  801df0:	68 7f 45 4c 46       	push   $0x464c457f
+  801df5:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  801dfb:	68 1f 38 80 00       	push   $0x80381f
+  801e00:	e8 be e7 ff ff       	call   8005c3 <cprintf>
+    return -E_NOT_EXEC;
+  801e05:	83 c4 10             	add    $0x10,%esp
+  801e08:	c7 85 8c fd ff ff f2 	movl   $0xfffffff2,-0x274(%ebp)
+  801e0f:	ff ff ff 
+  801e12:	e9 45 04 00 00       	jmp    80225c <spawn+0x51f>
+    string_size += strlen(argv[argc]) + 1;
+  801e17:	83 ec 0c             	sub    $0xc,%esp
+  801e1a:	50                   	push   %eax
+  801e1b:	e8 21 ed ff ff       	call   800b41 <strlen>
+  801e20:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+  for (argc = 0; argv[argc] != 0; argc++)
+  801e24:	83 c3 01             	add    $0x1,%ebx
+  801e27:	83 c4 10             	add    $0x10,%esp
+  801e2a:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  801e2d:	85 c0                	test   %eax,%eax
+  801e2f:	75 e6                	jne    801e17 <spawn+0xda>
+  // Determine where to place the strings and the argv array.
+  // Set up pointers into the temporary page 'UTEMP'; we'll map a page
+  // there later, then remap that page into the child environment
+  // at (USTACKTOP - PGSIZE).
+  // strings is the topmost thing on the stack.
+  string_store = (char *) UTEMP + PGSIZE - string_size;
+  801e31:	89 9d 84 fd ff ff    	mov    %ebx,-0x27c(%ebp)
+  801e37:	bf 00 10 40 00       	mov    $0x401000,%edi
+  801e3c:	29 f7                	sub    %esi,%edi
+  // argv is below that.  There's one argument pointer per argument, plus
+  // a null pointer.
+  argv_store = (uintptr_t *) (ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  801e3e:	89 fa                	mov    %edi,%edx
+  801e40:	83 e2 fc             	and    $0xfffffffc,%edx
+  801e43:	8d 04 9d 04 00 00 00 	lea    0x4(,%ebx,4),%eax
+  801e4a:	29 c2                	sub    %eax,%edx
+  801e4c:	89 95 94 fd ff ff    	mov    %edx,-0x26c(%ebp)
+
+  // Make sure that argv, strings, and the 2 words that hold 'argc'
+  // and 'argv' themselves will all fit in a single stack page.
+  if ((void *) (argv_store - 2) < (void *) UTEMP)
+  801e52:	8d 42 f8             	lea    -0x8(%edx),%eax
+  801e55:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  801e5a:	0f 86 1f 04 00 00    	jbe    80227f <spawn+0x542>
+    return -E_NO_MEM;
+
+  // Allocate the single stack page at UTEMP.
+  if ((r = sys_page_alloc(0, (void *) UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  801e60:	83 ec 04             	sub    $0x4,%esp
+  801e63:	6a 07                	push   $0x7
+  801e65:	68 00 00 40 00       	push   $0x400000
+  801e6a:	6a 00                	push   $0x0
+  801e6c:	e8 f7 f0 ff ff       	call   800f68 <sys_page_alloc>
+  801e71:	83 c4 10             	add    $0x10,%esp
+  801e74:	85 c0                	test   %eax,%eax
+  801e76:	0f 88 08 04 00 00    	js     802284 <spawn+0x547>
+  //	  (Again, argv should use an address valid in the child's
+  //	  environment.)
+  //
+  //	* Set *init_esp to the initial stack pointer for the child,
+  //	  (Again, use an address valid in the child's environment.)
+  for (i = 0; i < argc; i++) {
+  801e7c:	be 00 00 00 00       	mov    $0x0,%esi
+  801e81:	89 9d 90 fd ff ff    	mov    %ebx,-0x270(%ebp)
+  801e87:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801e8a:	39 b5 90 fd ff ff    	cmp    %esi,-0x270(%ebp)
+  801e90:	7e 32                	jle    801ec4 <spawn+0x187>
+    argv_store[i] = UTEMP2USTACK(string_store);
+  801e92:	8d 87 00 d0 7f ee    	lea    -0x11803000(%edi),%eax
+  801e98:	8b 8d 94 fd ff ff    	mov    -0x26c(%ebp),%ecx
+  801e9e:	89 04 b1             	mov    %eax,(%ecx,%esi,4)
+    strcpy(string_store, argv[i]);
+  801ea1:	83 ec 08             	sub    $0x8,%esp
+  801ea4:	ff 34 b3             	push   (%ebx,%esi,4)
+  801ea7:	57                   	push   %edi
+  801ea8:	e8 cf ec ff ff       	call   800b7c <strcpy>
+    string_store += strlen(argv[i]) + 1;
+  801ead:	83 c4 04             	add    $0x4,%esp
+  801eb0:	ff 34 b3             	push   (%ebx,%esi,4)
+  801eb3:	e8 89 ec ff ff       	call   800b41 <strlen>
+  801eb8:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+  for (i = 0; i < argc; i++) {
+  801ebc:	83 c6 01             	add    $0x1,%esi
+  801ebf:	83 c4 10             	add    $0x10,%esp
+  801ec2:	eb c6                	jmp    801e8a <spawn+0x14d>
+  }
+  argv_store[argc] = 0;
+  801ec4:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  801eca:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  801ed0:	c7 04 88 00 00 00 00 	movl   $0x0,(%eax,%ecx,4)
+  assert(string_store == (char *) UTEMP + PGSIZE);
+  801ed7:	81 ff 00 10 40 00    	cmp    $0x401000,%edi
+  801edd:	0f 85 87 00 00 00    	jne    801f6a <spawn+0x22d>
+
+  argv_store[-1] = UTEMP2USTACK(argv_store);
+  801ee3:	8b 8d 94 fd ff ff    	mov    -0x26c(%ebp),%ecx
+  801ee9:	8d 81 00 d0 7f ee    	lea    -0x11803000(%ecx),%eax
+  801eef:	89 41 fc             	mov    %eax,-0x4(%ecx)
+  argv_store[-2] = argc;
+  801ef2:	89 c8                	mov    %ecx,%eax
+  801ef4:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  801efa:	89 48 f8             	mov    %ecx,-0x8(%eax)
+
+  *init_esp = UTEMP2USTACK(&argv_store[-2]);
+  801efd:	2d 08 30 80 11       	sub    $0x11803008,%eax
+  801f02:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+
+  // After completing the stack, map it into the child's address space
+  // and unmap it from ours!
+  if ((r = sys_page_map(0, UTEMP, child, (void *) (USTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  801f08:	83 ec 0c             	sub    $0xc,%esp
+  801f0b:	6a 07                	push   $0x7
+  801f0d:	68 00 d0 bf ee       	push   $0xeebfd000
+  801f12:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  801f18:	68 00 00 40 00       	push   $0x400000
+  801f1d:	6a 00                	push   $0x0
+  801f1f:	e8 87 f0 ff ff       	call   800fab <sys_page_map>
+  801f24:	89 c3                	mov    %eax,%ebx
+  801f26:	83 c4 20             	add    $0x20,%esp
+  801f29:	85 c0                	test   %eax,%eax
+  801f2b:	0f 88 5b 03 00 00    	js     80228c <spawn+0x54f>
+    goto error;
+  if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  801f31:	83 ec 08             	sub    $0x8,%esp
+  801f34:	68 00 00 40 00       	push   $0x400000
+  801f39:	6a 00                	push   $0x0
+  801f3b:	e8 ad f0 ff ff       	call   800fed <sys_page_unmap>
+  801f40:	89 c3                	mov    %eax,%ebx
+  801f42:	83 c4 10             	add    $0x10,%esp
+  801f45:	85 c0                	test   %eax,%eax
+  801f47:	0f 88 3f 03 00 00    	js     80228c <spawn+0x54f>
+  ph = (struct Proghdr *) (elf_buf + elf->e_phoff);
+  801f4d:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  801f53:	8d 8c 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%ecx
+  for (i = 0; i < elf->e_phnum; i++, ph++) {
+  801f5a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f5f:	89 c8                	mov    %ecx,%eax
+  801f61:	89 d1                	mov    %edx,%ecx
+  801f63:	89 c2                	mov    %eax,%edx
+  801f65:	e9 5a 01 00 00       	jmp    8020c4 <spawn+0x387>
+  assert(string_store == (char *) UTEMP + PGSIZE);
+  801f6a:	68 94 38 80 00       	push   $0x803894
+  801f6f:	68 f3 37 80 00       	push   $0x8037f3
+  801f74:	68 52 01 00 00       	push   $0x152
+  801f79:	68 39 38 80 00       	push   $0x803839
+  801f7e:	e8 65 e5 ff ff       	call   8004e8 <_panic>
+      // allocate a blank page
+      if ((r = sys_page_alloc(child, (void *) (va + i), perm)) < 0)
+        return r;
+    } else {
+      // from file
+      if ((r = sys_page_alloc(0, UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  801f83:	83 ec 04             	sub    $0x4,%esp
+  801f86:	6a 07                	push   $0x7
+  801f88:	68 00 00 40 00       	push   $0x400000
+  801f8d:	6a 00                	push   $0x0
+  801f8f:	e8 d4 ef ff ff       	call   800f68 <sys_page_alloc>
+  801f94:	83 c4 10             	add    $0x10,%esp
+  801f97:	85 c0                	test   %eax,%eax
+  801f99:	0f 88 cb 02 00 00    	js     80226a <spawn+0x52d>
+        return r;
+      if ((r = seek(fd, fileoffset + i)) < 0)
+  801f9f:	83 ec 08             	sub    $0x8,%esp
+  801fa2:	8b 95 80 fd ff ff    	mov    -0x280(%ebp),%edx
+  801fa8:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  801fae:	01 d0                	add    %edx,%eax
+  801fb0:	50                   	push   %eax
+  801fb1:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  801fb7:	e8 c9 f9 ff ff       	call   801985 <seek>
+  801fbc:	83 c4 10             	add    $0x10,%esp
+  801fbf:	85 c0                	test   %eax,%eax
+  801fc1:	0f 88 aa 02 00 00    	js     802271 <spawn+0x534>
+        return r;
+      if ((r = readn(fd, UTEMP, MIN(PGSIZE, filesz - i))) < 0)
+  801fc7:	83 ec 04             	sub    $0x4,%esp
+  801fca:	89 fa                	mov    %edi,%edx
+  801fcc:	8b 8d 94 fd ff ff    	mov    -0x26c(%ebp),%ecx
+  801fd2:	29 ca                	sub    %ecx,%edx
+  801fd4:	89 d0                	mov    %edx,%eax
+  801fd6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801fdb:	39 d0                	cmp    %edx,%eax
+  801fdd:	0f 47 c2             	cmova  %edx,%eax
+  801fe0:	50                   	push   %eax
+  801fe1:	68 00 00 40 00       	push   $0x400000
+  801fe6:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  801fec:	e8 cb f8 ff ff       	call   8018bc <readn>
+  801ff1:	83 c4 10             	add    $0x10,%esp
+  801ff4:	85 c0                	test   %eax,%eax
+  801ff6:	0f 88 7c 02 00 00    	js     802278 <spawn+0x53b>
+        return r;
+      if ((r = sys_page_map(0, UTEMP, child, (void *) (va + i), perm)) < 0)
+  801ffc:	83 ec 0c             	sub    $0xc,%esp
+  801fff:	ff b5 84 fd ff ff    	push   -0x27c(%ebp)
+  802005:	56                   	push   %esi
+  802006:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  80200c:	68 00 00 40 00       	push   $0x400000
+  802011:	6a 00                	push   $0x0
+  802013:	e8 93 ef ff ff       	call   800fab <sys_page_map>
+  802018:	83 c4 20             	add    $0x20,%esp
+  80201b:	85 c0                	test   %eax,%eax
+  80201d:	78 7e                	js     80209d <spawn+0x360>
+        panic("spawn: sys_page_map data: %e", r);
+      sys_page_unmap(0, UTEMP);
+  80201f:	83 ec 08             	sub    $0x8,%esp
+  802022:	68 00 00 40 00       	push   $0x400000
+  802027:	6a 00                	push   $0x0
+  802029:	e8 bf ef ff ff       	call   800fed <sys_page_unmap>
+  80202e:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < memsz; i += PGSIZE) {
+  802031:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802037:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80203d:	89 9d 94 fd ff ff    	mov    %ebx,-0x26c(%ebp)
+  802043:	8b 85 90 fd ff ff    	mov    -0x270(%ebp),%eax
+  802049:	39 c3                	cmp    %eax,%ebx
+  80204b:	73 65                	jae    8020b2 <spawn+0x375>
+    if (i >= filesz) {
+  80204d:	39 fb                	cmp    %edi,%ebx
+  80204f:	0f 82 2e ff ff ff    	jb     801f83 <spawn+0x246>
+      if ((r = sys_page_alloc(child, (void *) (va + i), perm)) < 0)
+  802055:	83 ec 04             	sub    $0x4,%esp
+  802058:	ff b5 84 fd ff ff    	push   -0x27c(%ebp)
+  80205e:	56                   	push   %esi
+  80205f:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  802065:	e8 fe ee ff ff       	call   800f68 <sys_page_alloc>
+  80206a:	83 c4 10             	add    $0x10,%esp
+  80206d:	85 c0                	test   %eax,%eax
+  80206f:	79 c0                	jns    802031 <spawn+0x2f4>
+  802071:	89 c7                	mov    %eax,%edi
+  sys_env_destroy(child);
+  802073:	83 ec 0c             	sub    $0xc,%esp
+  802076:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  80207c:	e8 68 ee ff ff       	call   800ee9 <sys_env_destroy>
+  close(fd);
+  802081:	83 c4 04             	add    $0x4,%esp
+  802084:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  80208a:	e8 6a f6 ff ff       	call   8016f9 <close>
+  return r;
+  80208f:	83 c4 10             	add    $0x10,%esp
+  802092:	89 bd 8c fd ff ff    	mov    %edi,-0x274(%ebp)
+  802098:	e9 bf 01 00 00       	jmp    80225c <spawn+0x51f>
+        panic("spawn: sys_page_map data: %e", r);
+  80209d:	50                   	push   %eax
+  80209e:	68 45 38 80 00       	push   $0x803845
+  8020a3:	68 84 01 00 00       	push   $0x184
+  8020a8:	68 39 38 80 00       	push   $0x803839
+  8020ad:	e8 36 e4 ff ff       	call   8004e8 <_panic>
+  8020b2:	8b 8d 7c fd ff ff    	mov    -0x284(%ebp),%ecx
+  8020b8:	8b 95 78 fd ff ff    	mov    -0x288(%ebp),%edx
+  for (i = 0; i < elf->e_phnum; i++, ph++) {
+  8020be:	83 c1 01             	add    $0x1,%ecx
+  8020c1:	83 c2 20             	add    $0x20,%edx
+  8020c4:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  8020cb:	39 c8                	cmp    %ecx,%eax
+  8020cd:	0f 8e 88 00 00 00    	jle    80215b <spawn+0x41e>
+    if (ph->p_type != ELF_PROG_LOAD)
+  8020d3:	83 3a 01             	cmpl   $0x1,(%edx)
+  8020d6:	75 e6                	jne    8020be <spawn+0x381>
+    if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  8020d8:	8b 42 18             	mov    0x18(%edx),%eax
+  8020db:	83 e0 02             	and    $0x2,%eax
+    perm = PTE_P | PTE_U;
+  8020de:	83 f8 01             	cmp    $0x1,%eax
+  8020e1:	19 c0                	sbb    %eax,%eax
+  8020e3:	83 e0 fe             	and    $0xfffffffe,%eax
+  8020e6:	83 c0 07             	add    $0x7,%eax
+    if ((r = map_segment(child, ph->p_va, ph->p_memsz, fd, ph->p_filesz, ph->p_offset, perm)) < 0)
+  8020e9:	8b 72 04             	mov    0x4(%edx),%esi
+  8020ec:	89 b5 80 fd ff ff    	mov    %esi,-0x280(%ebp)
+  8020f2:	8b 7a 10             	mov    0x10(%edx),%edi
+  8020f5:	89 bd 94 fd ff ff    	mov    %edi,-0x26c(%ebp)
+  8020fb:	8b 5a 14             	mov    0x14(%edx),%ebx
+  8020fe:	89 9d 90 fd ff ff    	mov    %ebx,-0x270(%ebp)
+  802104:	8b 7a 08             	mov    0x8(%edx),%edi
+  802107:	89 bd 84 fd ff ff    	mov    %edi,-0x27c(%ebp)
+  if ((i = PGOFF(va))) {
+  80210d:	89 fb                	mov    %edi,%ebx
+  80210f:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  802115:	74 1c                	je     802133 <spawn+0x3f6>
+    va -= i;
+  802117:	29 df                	sub    %ebx,%edi
+  802119:	89 bd 84 fd ff ff    	mov    %edi,-0x27c(%ebp)
+    memsz += i;
+  80211f:	01 9d 90 fd ff ff    	add    %ebx,-0x270(%ebp)
+    filesz += i;
+  802125:	01 9d 94 fd ff ff    	add    %ebx,-0x26c(%ebp)
+    fileoffset -= i;
+  80212b:	29 de                	sub    %ebx,%esi
+  80212d:	89 b5 80 fd ff ff    	mov    %esi,-0x280(%ebp)
+  for (i = 0; i < memsz; i += PGSIZE) {
+  802133:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802138:	8b bd 94 fd ff ff    	mov    -0x26c(%ebp),%edi
+  80213e:	8b b5 84 fd ff ff    	mov    -0x27c(%ebp),%esi
+  802144:	89 8d 7c fd ff ff    	mov    %ecx,-0x284(%ebp)
+  80214a:	89 95 78 fd ff ff    	mov    %edx,-0x288(%ebp)
+  802150:	89 85 84 fd ff ff    	mov    %eax,-0x27c(%ebp)
+  802156:	e9 e2 fe ff ff       	jmp    80203d <spawn+0x300>
+  close(fd);
+  80215b:	83 ec 0c             	sub    $0xc,%esp
+  80215e:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  802164:	e8 90 f5 ff ff       	call   8016f9 <close>
+  802169:	83 c4 10             	add    $0x10,%esp
+  // LAB 5: Your code here.
+  int r;
+  unsigned perm = PTE_P | PTE_U | PTE_SHARE;
+
+  uintptr_t addr;
+  for (addr = 0; addr < UTOP; addr += PGSIZE)
+  80216c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802171:	8b b5 88 fd ff ff    	mov    -0x278(%ebp),%esi
+  802177:	eb 0e                	jmp    802187 <spawn+0x44a>
+  802179:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80217f:	81 fb 00 00 c0 ee    	cmp    $0xeec00000,%ebx
+  802185:	74 5e                	je     8021e5 <spawn+0x4a8>
+    if ((uvpd[PDX(addr)] & PTE_P) && (uvpt[PGNUM(addr)] & perm) == perm) {
+  802187:	89 d8                	mov    %ebx,%eax
+  802189:	c1 e8 16             	shr    $0x16,%eax
+  80218c:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802193:	a8 01                	test   $0x1,%al
+  802195:	74 e2                	je     802179 <spawn+0x43c>
+  802197:	89 da                	mov    %ebx,%edx
+  802199:	c1 ea 0c             	shr    $0xc,%edx
+  80219c:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  8021a3:	25 05 04 00 00       	and    $0x405,%eax
+  8021a8:	3d 05 04 00 00       	cmp    $0x405,%eax
+  8021ad:	75 ca                	jne    802179 <spawn+0x43c>
+      if ((r = sys_page_map(0, (void *) addr, child, (void *) addr, uvpt[PGNUM(addr)] & PTE_SYSCALL)) < 0) {
+  8021af:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  8021b6:	83 ec 0c             	sub    $0xc,%esp
+  8021b9:	25 07 0e 00 00       	and    $0xe07,%eax
+  8021be:	50                   	push   %eax
+  8021bf:	53                   	push   %ebx
+  8021c0:	56                   	push   %esi
+  8021c1:	53                   	push   %ebx
+  8021c2:	6a 00                	push   $0x0
+  8021c4:	e8 e2 ed ff ff       	call   800fab <sys_page_map>
+  8021c9:	83 c4 20             	add    $0x20,%esp
+  8021cc:	85 c0                	test   %eax,%eax
+  8021ce:	79 a9                	jns    802179 <spawn+0x43c>
+        panic("copy_shared_pages : sys_page_map: %e\n", r);
+  8021d0:	50                   	push   %eax
+  8021d1:	68 bc 38 80 00       	push   $0x8038bc
+  8021d6:	68 96 01 00 00       	push   $0x196
+  8021db:	68 39 38 80 00       	push   $0x803839
+  8021e0:	e8 03 e3 ff ff       	call   8004e8 <_panic>
+  if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  8021e5:	83 ec 08             	sub    $0x8,%esp
+  8021e8:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  8021ee:	50                   	push   %eax
+  8021ef:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  8021f5:	e8 77 ee ff ff       	call   801071 <sys_env_set_trapframe>
+  8021fa:	83 c4 10             	add    $0x10,%esp
+  8021fd:	85 c0                	test   %eax,%eax
+  8021ff:	78 25                	js     802226 <spawn+0x4e9>
+  if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  802201:	83 ec 08             	sub    $0x8,%esp
+  802204:	6a 02                	push   $0x2
+  802206:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  80220c:	e8 1e ee ff ff       	call   80102f <sys_env_set_status>
+  802211:	83 c4 10             	add    $0x10,%esp
+  802214:	85 c0                	test   %eax,%eax
+  802216:	78 23                	js     80223b <spawn+0x4fe>
+  return child;
+  802218:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  80221e:	89 85 8c fd ff ff    	mov    %eax,-0x274(%ebp)
+  802224:	eb 36                	jmp    80225c <spawn+0x51f>
+    panic("sys_env_set_trapframe: %e", r);
+  802226:	50                   	push   %eax
+  802227:	68 62 38 80 00       	push   $0x803862
+  80222c:	68 86 00 00 00       	push   $0x86
+  802231:	68 39 38 80 00       	push   $0x803839
+  802236:	e8 ad e2 ff ff       	call   8004e8 <_panic>
+    panic("sys_env_set_status: %e", r);
+  80223b:	50                   	push   %eax
+  80223c:	68 7c 38 80 00       	push   $0x80387c
+  802241:	68 89 00 00 00       	push   $0x89
+  802246:	68 39 38 80 00       	push   $0x803839
+  80224b:	e8 98 e2 ff ff       	call   8004e8 <_panic>
+    return r;
+  802250:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  802256:	89 85 8c fd ff ff    	mov    %eax,-0x274(%ebp)
+}
+  80225c:	8b 85 8c fd ff ff    	mov    -0x274(%ebp),%eax
+  802262:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802265:	5b                   	pop    %ebx
+  802266:	5e                   	pop    %esi
+  802267:	5f                   	pop    %edi
+  802268:	5d                   	pop    %ebp
+  802269:	c3                   	ret
+  80226a:	89 c7                	mov    %eax,%edi
+  80226c:	e9 02 fe ff ff       	jmp    802073 <spawn+0x336>
+  802271:	89 c7                	mov    %eax,%edi
+  802273:	e9 fb fd ff ff       	jmp    802073 <spawn+0x336>
+  802278:	89 c7                	mov    %eax,%edi
+  80227a:	e9 f4 fd ff ff       	jmp    802073 <spawn+0x336>
+    return -E_NO_MEM;
+  80227f:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  return r;
+  802284:	89 85 8c fd ff ff    	mov    %eax,-0x274(%ebp)
+  80228a:	eb d0                	jmp    80225c <spawn+0x51f>
+  sys_page_unmap(0, UTEMP);
+  80228c:	83 ec 08             	sub    $0x8,%esp
+  80228f:	68 00 00 40 00       	push   $0x400000
+  802294:	6a 00                	push   $0x0
+  802296:	e8 52 ed ff ff       	call   800fed <sys_page_unmap>
+  80229b:	83 c4 10             	add    $0x10,%esp
+  80229e:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+  8022a4:	eb b6                	jmp    80225c <spawn+0x51f>
+
+008022a6 <spawnl>:
+spawnl(const char *prog, const char *arg0, ...) {
+  8022a6:	55                   	push   %ebp
+  8022a7:	89 e5                	mov    %esp,%ebp
+  8022a9:	56                   	push   %esi
+  8022aa:	53                   	push   %ebx
+  va_start(vl, arg0);
+  8022ab:	8d 55 10             	lea    0x10(%ebp),%edx
+  int argc = 0;
+  8022ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  while (va_arg(vl, void *) != NULL)
+  8022b3:	eb 05                	jmp    8022ba <spawnl+0x14>
+    argc++;
+  8022b5:	83 c0 01             	add    $0x1,%eax
+  while (va_arg(vl, void *) != NULL)
+  8022b8:	89 ca                	mov    %ecx,%edx
+  8022ba:	8d 4a 04             	lea    0x4(%edx),%ecx
+  8022bd:	83 3a 00             	cmpl   $0x0,(%edx)
+  8022c0:	75 f3                	jne    8022b5 <spawnl+0xf>
+  const char *argv[argc + 2];
+  8022c2:	8d 14 85 17 00 00 00 	lea    0x17(,%eax,4),%edx
+  8022c9:	83 e2 f0             	and    $0xfffffff0,%edx
+  8022cc:	29 d4                	sub    %edx,%esp
+  8022ce:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  8022d2:	89 da                	mov    %ebx,%edx
+  8022d4:	c1 ea 02             	shr    $0x2,%edx
+  8022d7:	83 e3 fc             	and    $0xfffffffc,%ebx
+  argv[0] = arg0;
+  8022da:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8022dd:	89 0c 95 00 00 00 00 	mov    %ecx,0x0(,%edx,4)
+  argv[argc + 1] = NULL;
+  8022e4:	c7 44 83 04 00 00 00 	movl   $0x0,0x4(%ebx,%eax,4)
+  8022eb:	00 
+  va_start(vl, arg0);
+  8022ec:	8d 4d 10             	lea    0x10(%ebp),%ecx
+  for (i = 0; i < argc; i++)
+  8022ef:	89 c2                	mov    %eax,%edx
+  8022f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022f6:	eb 0b                	jmp    802303 <spawnl+0x5d>
+    argv[i + 1] = va_arg(vl, const char *);
+  8022f8:	83 c0 01             	add    $0x1,%eax
+  8022fb:	8b 31                	mov    (%ecx),%esi
+  8022fd:	89 34 83             	mov    %esi,(%ebx,%eax,4)
+  802300:	8d 49 04             	lea    0x4(%ecx),%ecx
+  for (i = 0; i < argc; i++)
+  802303:	39 d0                	cmp    %edx,%eax
+  802305:	75 f1                	jne    8022f8 <spawnl+0x52>
+  return spawn(prog, argv);
+  802307:	83 ec 08             	sub    $0x8,%esp
+  80230a:	53                   	push   %ebx
+  80230b:	ff 75 08             	push   0x8(%ebp)
+  80230e:	e8 2a fa ff ff       	call   801d3d <spawn>
+}
+  802313:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802316:	5b                   	pop    %ebx
+  802317:	5e                   	pop    %esi
+  802318:	5d                   	pop    %ebp
+  802319:	c3                   	ret
+
+0080231a <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80231a:	55                   	push   %ebp
+  80231b:	89 e5                	mov    %esp,%ebp
+  80231d:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802320:	68 e2 38 80 00       	push   $0x8038e2
+  802325:	ff 75 0c             	push   0xc(%ebp)
+  802328:	e8 4f e8 ff ff       	call   800b7c <strcpy>
+	return 0;
+}
+  80232d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802332:	c9                   	leave
+  802333:	c3                   	ret
+
+00802334 <devsock_close>:
+{
+  802334:	55                   	push   %ebp
+  802335:	89 e5                	mov    %esp,%ebp
+  802337:	53                   	push   %ebx
+  802338:	83 ec 10             	sub    $0x10,%esp
+  80233b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  80233e:	53                   	push   %ebx
+  80233f:	e8 6f 09 00 00       	call   802cb3 <pageref>
+  802344:	89 c2                	mov    %eax,%edx
+  802346:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802349:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  80234e:	83 fa 01             	cmp    $0x1,%edx
+  802351:	74 05                	je     802358 <devsock_close+0x24>
+}
+  802353:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802356:	c9                   	leave
+  802357:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802358:	83 ec 0c             	sub    $0xc,%esp
+  80235b:	ff 73 0c             	push   0xc(%ebx)
+  80235e:	e8 b7 02 00 00       	call   80261a <nsipc_close>
+  802363:	83 c4 10             	add    $0x10,%esp
+  802366:	eb eb                	jmp    802353 <devsock_close+0x1f>
+
+00802368 <devsock_write>:
+{
+  802368:	55                   	push   %ebp
+  802369:	89 e5                	mov    %esp,%ebp
+  80236b:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  80236e:	6a 00                	push   $0x0
+  802370:	ff 75 10             	push   0x10(%ebp)
+  802373:	ff 75 0c             	push   0xc(%ebp)
+  802376:	8b 45 08             	mov    0x8(%ebp),%eax
+  802379:	ff 70 0c             	push   0xc(%eax)
+  80237c:	e8 79 03 00 00       	call   8026fa <nsipc_send>
+}
+  802381:	c9                   	leave
+  802382:	c3                   	ret
+
+00802383 <devsock_read>:
+{
+  802383:	55                   	push   %ebp
+  802384:	89 e5                	mov    %esp,%ebp
+  802386:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802389:	6a 00                	push   $0x0
+  80238b:	ff 75 10             	push   0x10(%ebp)
+  80238e:	ff 75 0c             	push   0xc(%ebp)
+  802391:	8b 45 08             	mov    0x8(%ebp),%eax
+  802394:	ff 70 0c             	push   0xc(%eax)
+  802397:	e8 ef 02 00 00       	call   80268b <nsipc_recv>
+}
+  80239c:	c9                   	leave
+  80239d:	c3                   	ret
+
+0080239e <fd2sockid>:
+{
+  80239e:	55                   	push   %ebp
+  80239f:	89 e5                	mov    %esp,%ebp
+  8023a1:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8023a4:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8023a7:	52                   	push   %edx
+  8023a8:	50                   	push   %eax
+  8023a9:	e8 21 f2 ff ff       	call   8015cf <fd_lookup>
+  8023ae:	83 c4 10             	add    $0x10,%esp
+  8023b1:	85 c0                	test   %eax,%eax
+  8023b3:	78 10                	js     8023c5 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8023b5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023b8:	8b 0d 3c 40 80 00    	mov    0x80403c,%ecx
+  8023be:	39 08                	cmp    %ecx,(%eax)
+  8023c0:	75 05                	jne    8023c7 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8023c2:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8023c5:	c9                   	leave
+  8023c6:	c3                   	ret
+		return -E_NOT_SUPP;
+  8023c7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8023cc:	eb f7                	jmp    8023c5 <fd2sockid+0x27>
+
+008023ce <alloc_sockfd>:
+{
+  8023ce:	55                   	push   %ebp
+  8023cf:	89 e5                	mov    %esp,%ebp
+  8023d1:	56                   	push   %esi
+  8023d2:	53                   	push   %ebx
+  8023d3:	83 ec 1c             	sub    $0x1c,%esp
+  8023d6:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8023d8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023db:	50                   	push   %eax
+  8023dc:	e8 98 f1 ff ff       	call   801579 <fd_alloc>
+  8023e1:	89 c3                	mov    %eax,%ebx
+  8023e3:	83 c4 10             	add    $0x10,%esp
+  8023e6:	85 c0                	test   %eax,%eax
+  8023e8:	78 43                	js     80242d <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8023ea:	83 ec 04             	sub    $0x4,%esp
+  8023ed:	68 07 04 00 00       	push   $0x407
+  8023f2:	ff 75 f4             	push   -0xc(%ebp)
+  8023f5:	6a 00                	push   $0x0
+  8023f7:	e8 6c eb ff ff       	call   800f68 <sys_page_alloc>
+  8023fc:	89 c3                	mov    %eax,%ebx
+  8023fe:	83 c4 10             	add    $0x10,%esp
+  802401:	85 c0                	test   %eax,%eax
+  802403:	78 28                	js     80242d <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802405:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802408:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  80240e:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802410:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802413:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  80241a:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  80241d:	83 ec 0c             	sub    $0xc,%esp
+  802420:	50                   	push   %eax
+  802421:	e8 2c f1 ff ff       	call   801552 <fd2num>
+  802426:	89 c3                	mov    %eax,%ebx
+  802428:	83 c4 10             	add    $0x10,%esp
+  80242b:	eb 0c                	jmp    802439 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  80242d:	83 ec 0c             	sub    $0xc,%esp
+  802430:	56                   	push   %esi
+  802431:	e8 e4 01 00 00       	call   80261a <nsipc_close>
+		return r;
+  802436:	83 c4 10             	add    $0x10,%esp
+}
+  802439:	89 d8                	mov    %ebx,%eax
+  80243b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80243e:	5b                   	pop    %ebx
+  80243f:	5e                   	pop    %esi
+  802440:	5d                   	pop    %ebp
+  802441:	c3                   	ret
+
+00802442 <accept>:
+{
+  802442:	55                   	push   %ebp
+  802443:	89 e5                	mov    %esp,%ebp
+  802445:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802448:	8b 45 08             	mov    0x8(%ebp),%eax
+  80244b:	e8 4e ff ff ff       	call   80239e <fd2sockid>
+  802450:	85 c0                	test   %eax,%eax
+  802452:	78 1b                	js     80246f <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802454:	83 ec 04             	sub    $0x4,%esp
+  802457:	ff 75 10             	push   0x10(%ebp)
+  80245a:	ff 75 0c             	push   0xc(%ebp)
+  80245d:	50                   	push   %eax
+  80245e:	e8 0e 01 00 00       	call   802571 <nsipc_accept>
+  802463:	83 c4 10             	add    $0x10,%esp
+  802466:	85 c0                	test   %eax,%eax
+  802468:	78 05                	js     80246f <accept+0x2d>
+	return alloc_sockfd(r);
+  80246a:	e8 5f ff ff ff       	call   8023ce <alloc_sockfd>
+}
+  80246f:	c9                   	leave
+  802470:	c3                   	ret
+
+00802471 <bind>:
+{
+  802471:	55                   	push   %ebp
+  802472:	89 e5                	mov    %esp,%ebp
+  802474:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802477:	8b 45 08             	mov    0x8(%ebp),%eax
+  80247a:	e8 1f ff ff ff       	call   80239e <fd2sockid>
+  80247f:	85 c0                	test   %eax,%eax
+  802481:	78 12                	js     802495 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802483:	83 ec 04             	sub    $0x4,%esp
+  802486:	ff 75 10             	push   0x10(%ebp)
+  802489:	ff 75 0c             	push   0xc(%ebp)
+  80248c:	50                   	push   %eax
+  80248d:	e8 31 01 00 00       	call   8025c3 <nsipc_bind>
+  802492:	83 c4 10             	add    $0x10,%esp
+}
+  802495:	c9                   	leave
+  802496:	c3                   	ret
+
+00802497 <shutdown>:
+{
+  802497:	55                   	push   %ebp
+  802498:	89 e5                	mov    %esp,%ebp
+  80249a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80249d:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024a0:	e8 f9 fe ff ff       	call   80239e <fd2sockid>
+  8024a5:	85 c0                	test   %eax,%eax
+  8024a7:	78 0f                	js     8024b8 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8024a9:	83 ec 08             	sub    $0x8,%esp
+  8024ac:	ff 75 0c             	push   0xc(%ebp)
+  8024af:	50                   	push   %eax
+  8024b0:	e8 43 01 00 00       	call   8025f8 <nsipc_shutdown>
+  8024b5:	83 c4 10             	add    $0x10,%esp
+}
+  8024b8:	c9                   	leave
+  8024b9:	c3                   	ret
+
+008024ba <connect>:
+{
+  8024ba:	55                   	push   %ebp
+  8024bb:	89 e5                	mov    %esp,%ebp
+  8024bd:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8024c0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024c3:	e8 d6 fe ff ff       	call   80239e <fd2sockid>
+  8024c8:	85 c0                	test   %eax,%eax
+  8024ca:	78 12                	js     8024de <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8024cc:	83 ec 04             	sub    $0x4,%esp
+  8024cf:	ff 75 10             	push   0x10(%ebp)
+  8024d2:	ff 75 0c             	push   0xc(%ebp)
+  8024d5:	50                   	push   %eax
+  8024d6:	e8 59 01 00 00       	call   802634 <nsipc_connect>
+  8024db:	83 c4 10             	add    $0x10,%esp
+}
+  8024de:	c9                   	leave
+  8024df:	c3                   	ret
+
+008024e0 <listen>:
+{
+  8024e0:	55                   	push   %ebp
+  8024e1:	89 e5                	mov    %esp,%ebp
+  8024e3:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8024e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024e9:	e8 b0 fe ff ff       	call   80239e <fd2sockid>
+  8024ee:	85 c0                	test   %eax,%eax
+  8024f0:	78 0f                	js     802501 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8024f2:	83 ec 08             	sub    $0x8,%esp
+  8024f5:	ff 75 0c             	push   0xc(%ebp)
+  8024f8:	50                   	push   %eax
+  8024f9:	e8 6b 01 00 00       	call   802669 <nsipc_listen>
+  8024fe:	83 c4 10             	add    $0x10,%esp
+}
+  802501:	c9                   	leave
+  802502:	c3                   	ret
+
+00802503 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802503:	55                   	push   %ebp
+  802504:	89 e5                	mov    %esp,%ebp
+  802506:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802509:	ff 75 10             	push   0x10(%ebp)
+  80250c:	ff 75 0c             	push   0xc(%ebp)
+  80250f:	ff 75 08             	push   0x8(%ebp)
+  802512:	e8 41 02 00 00       	call   802758 <nsipc_socket>
+  802517:	83 c4 10             	add    $0x10,%esp
+  80251a:	85 c0                	test   %eax,%eax
+  80251c:	78 05                	js     802523 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  80251e:	e8 ab fe ff ff       	call   8023ce <alloc_sockfd>
+}
+  802523:	c9                   	leave
+  802524:	c3                   	ret
+
+00802525 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802525:	55                   	push   %ebp
+  802526:	89 e5                	mov    %esp,%ebp
+  802528:	53                   	push   %ebx
+  802529:	83 ec 04             	sub    $0x4,%esp
+  80252c:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  80252e:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  802535:	74 26                	je     80255d <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802537:	6a 07                	push   $0x7
+  802539:	68 00 70 80 00       	push   $0x807000
+  80253e:	53                   	push   %ebx
+  80253f:	ff 35 04 50 80 00    	push   0x805004
+  802545:	e8 d6 06 00 00       	call   802c20 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  80254a:	83 c4 0c             	add    $0xc,%esp
+  80254d:	6a 00                	push   $0x0
+  80254f:	6a 00                	push   $0x0
+  802551:	6a 00                	push   $0x0
+  802553:	e8 54 06 00 00       	call   802bac <ipc_recv>
+}
+  802558:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80255b:	c9                   	leave
+  80255c:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80255d:	83 ec 0c             	sub    $0xc,%esp
+  802560:	6a 02                	push   $0x2
+  802562:	e8 0d 07 00 00       	call   802c74 <ipc_find_env>
+  802567:	a3 04 50 80 00       	mov    %eax,0x805004
+  80256c:	83 c4 10             	add    $0x10,%esp
+  80256f:	eb c6                	jmp    802537 <nsipc+0x12>
+
+00802571 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802571:	55                   	push   %ebp
+  802572:	89 e5                	mov    %esp,%ebp
+  802574:	56                   	push   %esi
+  802575:	53                   	push   %ebx
+  802576:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802579:	8b 45 08             	mov    0x8(%ebp),%eax
+  80257c:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802581:	8b 06                	mov    (%esi),%eax
+  802583:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802588:	b8 01 00 00 00       	mov    $0x1,%eax
+  80258d:	e8 93 ff ff ff       	call   802525 <nsipc>
+  802592:	89 c3                	mov    %eax,%ebx
+  802594:	85 c0                	test   %eax,%eax
+  802596:	79 09                	jns    8025a1 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802598:	89 d8                	mov    %ebx,%eax
+  80259a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80259d:	5b                   	pop    %ebx
+  80259e:	5e                   	pop    %esi
+  80259f:	5d                   	pop    %ebp
+  8025a0:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8025a1:	83 ec 04             	sub    $0x4,%esp
+  8025a4:	ff 35 10 70 80 00    	push   0x807010
+  8025aa:	68 00 70 80 00       	push   $0x807000
+  8025af:	ff 75 0c             	push   0xc(%ebp)
+  8025b2:	e8 4b e7 ff ff       	call   800d02 <memmove>
+		*addrlen = ret->ret_addrlen;
+  8025b7:	a1 10 70 80 00       	mov    0x807010,%eax
+  8025bc:	89 06                	mov    %eax,(%esi)
+  8025be:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8025c1:	eb d5                	jmp    802598 <nsipc_accept+0x27>
+
+008025c3 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8025c3:	55                   	push   %ebp
+  8025c4:	89 e5                	mov    %esp,%ebp
+  8025c6:	53                   	push   %ebx
+  8025c7:	83 ec 08             	sub    $0x8,%esp
+  8025ca:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8025cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025d0:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8025d5:	53                   	push   %ebx
+  8025d6:	ff 75 0c             	push   0xc(%ebp)
+  8025d9:	68 04 70 80 00       	push   $0x807004
+  8025de:	e8 1f e7 ff ff       	call   800d02 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8025e3:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  8025e9:	b8 02 00 00 00       	mov    $0x2,%eax
+  8025ee:	e8 32 ff ff ff       	call   802525 <nsipc>
+}
+  8025f3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025f6:	c9                   	leave
+  8025f7:	c3                   	ret
+
+008025f8 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8025f8:	55                   	push   %ebp
+  8025f9:	89 e5                	mov    %esp,%ebp
+  8025fb:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8025fe:	8b 45 08             	mov    0x8(%ebp),%eax
+  802601:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  802606:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802609:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  80260e:	b8 03 00 00 00       	mov    $0x3,%eax
+  802613:	e8 0d ff ff ff       	call   802525 <nsipc>
+}
+  802618:	c9                   	leave
+  802619:	c3                   	ret
+
+0080261a <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  80261a:	55                   	push   %ebp
+  80261b:	89 e5                	mov    %esp,%ebp
+  80261d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802620:	8b 45 08             	mov    0x8(%ebp),%eax
+  802623:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  802628:	b8 04 00 00 00       	mov    $0x4,%eax
+  80262d:	e8 f3 fe ff ff       	call   802525 <nsipc>
+}
+  802632:	c9                   	leave
+  802633:	c3                   	ret
+
+00802634 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802634:	55                   	push   %ebp
+  802635:	89 e5                	mov    %esp,%ebp
+  802637:	53                   	push   %ebx
+  802638:	83 ec 08             	sub    $0x8,%esp
+  80263b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  80263e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802641:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802646:	53                   	push   %ebx
+  802647:	ff 75 0c             	push   0xc(%ebp)
+  80264a:	68 04 70 80 00       	push   $0x807004
+  80264f:	e8 ae e6 ff ff       	call   800d02 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802654:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  80265a:	b8 05 00 00 00       	mov    $0x5,%eax
+  80265f:	e8 c1 fe ff ff       	call   802525 <nsipc>
+}
+  802664:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802667:	c9                   	leave
+  802668:	c3                   	ret
+
+00802669 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802669:	55                   	push   %ebp
+  80266a:	89 e5                	mov    %esp,%ebp
+  80266c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  80266f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802672:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  802677:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80267a:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  80267f:	b8 06 00 00 00       	mov    $0x6,%eax
+  802684:	e8 9c fe ff ff       	call   802525 <nsipc>
+}
+  802689:	c9                   	leave
+  80268a:	c3                   	ret
+
+0080268b <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  80268b:	55                   	push   %ebp
+  80268c:	89 e5                	mov    %esp,%ebp
+  80268e:	56                   	push   %esi
+  80268f:	53                   	push   %ebx
+  802690:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802693:	8b 45 08             	mov    0x8(%ebp),%eax
+  802696:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  80269b:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  8026a1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8026a4:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8026a9:	b8 07 00 00 00       	mov    $0x7,%eax
+  8026ae:	e8 72 fe ff ff       	call   802525 <nsipc>
+  8026b3:	89 c3                	mov    %eax,%ebx
+  8026b5:	85 c0                	test   %eax,%eax
+  8026b7:	78 22                	js     8026db <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8026b9:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8026be:	39 c6                	cmp    %eax,%esi
+  8026c0:	0f 4e c6             	cmovle %esi,%eax
+  8026c3:	39 c3                	cmp    %eax,%ebx
+  8026c5:	7f 1d                	jg     8026e4 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8026c7:	83 ec 04             	sub    $0x4,%esp
+  8026ca:	53                   	push   %ebx
+  8026cb:	68 00 70 80 00       	push   $0x807000
+  8026d0:	ff 75 0c             	push   0xc(%ebp)
+  8026d3:	e8 2a e6 ff ff       	call   800d02 <memmove>
+  8026d8:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8026db:	89 d8                	mov    %ebx,%eax
+  8026dd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026e0:	5b                   	pop    %ebx
+  8026e1:	5e                   	pop    %esi
+  8026e2:	5d                   	pop    %ebp
+  8026e3:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8026e4:	68 ee 38 80 00       	push   $0x8038ee
+  8026e9:	68 f3 37 80 00       	push   $0x8037f3
+  8026ee:	6a 62                	push   $0x62
+  8026f0:	68 03 39 80 00       	push   $0x803903
+  8026f5:	e8 ee dd ff ff       	call   8004e8 <_panic>
+
+008026fa <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8026fa:	55                   	push   %ebp
+  8026fb:	89 e5                	mov    %esp,%ebp
+  8026fd:	53                   	push   %ebx
+  8026fe:	83 ec 04             	sub    $0x4,%esp
+  802701:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802704:	8b 45 08             	mov    0x8(%ebp),%eax
+  802707:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  80270c:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802712:	7f 2e                	jg     802742 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802714:	83 ec 04             	sub    $0x4,%esp
+  802717:	53                   	push   %ebx
+  802718:	ff 75 0c             	push   0xc(%ebp)
+  80271b:	68 0c 70 80 00       	push   $0x80700c
+  802720:	e8 dd e5 ff ff       	call   800d02 <memmove>
+	nsipcbuf.send.req_size = size;
+  802725:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  80272b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80272e:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  802733:	b8 08 00 00 00       	mov    $0x8,%eax
+  802738:	e8 e8 fd ff ff       	call   802525 <nsipc>
+}
+  80273d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802740:	c9                   	leave
+  802741:	c3                   	ret
+	assert(size < 1600);
+  802742:	68 0f 39 80 00       	push   $0x80390f
+  802747:	68 f3 37 80 00       	push   $0x8037f3
+  80274c:	6a 6d                	push   $0x6d
+  80274e:	68 03 39 80 00       	push   $0x803903
+  802753:	e8 90 dd ff ff       	call   8004e8 <_panic>
+
+00802758 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802758:	55                   	push   %ebp
+  802759:	89 e5                	mov    %esp,%ebp
+  80275b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  80275e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802761:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  802766:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802769:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  80276e:	8b 45 10             	mov    0x10(%ebp),%eax
+  802771:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  802776:	b8 09 00 00 00       	mov    $0x9,%eax
+  80277b:	e8 a5 fd ff ff       	call   802525 <nsipc>
+}
+  802780:	c9                   	leave
+  802781:	c3                   	ret
+
+00802782 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802782:	55                   	push   %ebp
+  802783:	89 e5                	mov    %esp,%ebp
+  802785:	56                   	push   %esi
+  802786:	53                   	push   %ebx
+  802787:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80278a:	83 ec 0c             	sub    $0xc,%esp
+  80278d:	ff 75 08             	push   0x8(%ebp)
+  802790:	e8 cd ed ff ff       	call   801562 <fd2data>
+  802795:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802797:	83 c4 08             	add    $0x8,%esp
+  80279a:	68 1b 39 80 00       	push   $0x80391b
+  80279f:	53                   	push   %ebx
+  8027a0:	e8 d7 e3 ff ff       	call   800b7c <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8027a5:	8b 46 04             	mov    0x4(%esi),%eax
+  8027a8:	2b 06                	sub    (%esi),%eax
+  8027aa:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8027b0:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8027b7:	00 00 00 
+	stat->st_dev = &devpipe;
+  8027ba:	c7 83 88 00 00 00 58 	movl   $0x804058,0x88(%ebx)
+  8027c1:	40 80 00 
+	return 0;
+}
+  8027c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027c9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027cc:	5b                   	pop    %ebx
+  8027cd:	5e                   	pop    %esi
+  8027ce:	5d                   	pop    %ebp
+  8027cf:	c3                   	ret
+
+008027d0 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8027d0:	55                   	push   %ebp
+  8027d1:	89 e5                	mov    %esp,%ebp
+  8027d3:	53                   	push   %ebx
+  8027d4:	83 ec 0c             	sub    $0xc,%esp
+  8027d7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8027da:	53                   	push   %ebx
+  8027db:	6a 00                	push   $0x0
+  8027dd:	e8 0b e8 ff ff       	call   800fed <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8027e2:	89 1c 24             	mov    %ebx,(%esp)
+  8027e5:	e8 78 ed ff ff       	call   801562 <fd2data>
+  8027ea:	83 c4 08             	add    $0x8,%esp
+  8027ed:	50                   	push   %eax
+  8027ee:	6a 00                	push   $0x0
+  8027f0:	e8 f8 e7 ff ff       	call   800fed <sys_page_unmap>
+}
+  8027f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027f8:	c9                   	leave
+  8027f9:	c3                   	ret
+
+008027fa <_pipeisclosed>:
+{
+  8027fa:	55                   	push   %ebp
+  8027fb:	89 e5                	mov    %esp,%ebp
+  8027fd:	57                   	push   %edi
+  8027fe:	56                   	push   %esi
+  8027ff:	53                   	push   %ebx
+  802800:	83 ec 1c             	sub    $0x1c,%esp
+  802803:	89 c7                	mov    %eax,%edi
+  802805:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  802807:	a1 08 50 80 00       	mov    0x805008,%eax
+  80280c:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  80280f:	83 ec 0c             	sub    $0xc,%esp
+  802812:	57                   	push   %edi
+  802813:	e8 9b 04 00 00       	call   802cb3 <pageref>
+  802818:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80281b:	89 34 24             	mov    %esi,(%esp)
+  80281e:	e8 90 04 00 00       	call   802cb3 <pageref>
+		nn = thisenv->env_runs;
+  802823:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  802829:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  80282c:	83 c4 10             	add    $0x10,%esp
+  80282f:	39 cb                	cmp    %ecx,%ebx
+  802831:	74 1b                	je     80284e <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802833:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802836:	75 cf                	jne    802807 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802838:	8b 42 58             	mov    0x58(%edx),%eax
+  80283b:	6a 01                	push   $0x1
+  80283d:	50                   	push   %eax
+  80283e:	53                   	push   %ebx
+  80283f:	68 22 39 80 00       	push   $0x803922
+  802844:	e8 7a dd ff ff       	call   8005c3 <cprintf>
+  802849:	83 c4 10             	add    $0x10,%esp
+  80284c:	eb b9                	jmp    802807 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  80284e:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802851:	0f 94 c0             	sete   %al
+  802854:	0f b6 c0             	movzbl %al,%eax
+}
+  802857:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80285a:	5b                   	pop    %ebx
+  80285b:	5e                   	pop    %esi
+  80285c:	5f                   	pop    %edi
+  80285d:	5d                   	pop    %ebp
+  80285e:	c3                   	ret
+
+0080285f <devpipe_write>:
+{
+  80285f:	55                   	push   %ebp
+  802860:	89 e5                	mov    %esp,%ebp
+  802862:	57                   	push   %edi
+  802863:	56                   	push   %esi
+  802864:	53                   	push   %ebx
+  802865:	83 ec 28             	sub    $0x28,%esp
+  802868:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  80286b:	56                   	push   %esi
+  80286c:	e8 f1 ec ff ff       	call   801562 <fd2data>
+  802871:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802873:	83 c4 10             	add    $0x10,%esp
+  802876:	bf 00 00 00 00       	mov    $0x0,%edi
+  80287b:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  80287e:	75 09                	jne    802889 <devpipe_write+0x2a>
+	return i;
+  802880:	89 f8                	mov    %edi,%eax
+  802882:	eb 23                	jmp    8028a7 <devpipe_write+0x48>
+			sys_yield();
+  802884:	e8 c0 e6 ff ff       	call   800f49 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802889:	8b 43 04             	mov    0x4(%ebx),%eax
+  80288c:	8b 0b                	mov    (%ebx),%ecx
+  80288e:	8d 51 20             	lea    0x20(%ecx),%edx
+  802891:	39 d0                	cmp    %edx,%eax
+  802893:	72 1a                	jb     8028af <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802895:	89 da                	mov    %ebx,%edx
+  802897:	89 f0                	mov    %esi,%eax
+  802899:	e8 5c ff ff ff       	call   8027fa <_pipeisclosed>
+  80289e:	85 c0                	test   %eax,%eax
+  8028a0:	74 e2                	je     802884 <devpipe_write+0x25>
+				return 0;
+  8028a2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028aa:	5b                   	pop    %ebx
+  8028ab:	5e                   	pop    %esi
+  8028ac:	5f                   	pop    %edi
+  8028ad:	5d                   	pop    %ebp
+  8028ae:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8028af:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8028b2:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8028b6:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8028b9:	89 c2                	mov    %eax,%edx
+  8028bb:	c1 fa 1f             	sar    $0x1f,%edx
+  8028be:	89 d1                	mov    %edx,%ecx
+  8028c0:	c1 e9 1b             	shr    $0x1b,%ecx
+  8028c3:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8028c6:	83 e2 1f             	and    $0x1f,%edx
+  8028c9:	29 ca                	sub    %ecx,%edx
+  8028cb:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8028cf:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8028d3:	83 c0 01             	add    $0x1,%eax
+  8028d6:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8028d9:	83 c7 01             	add    $0x1,%edi
+  8028dc:	eb 9d                	jmp    80287b <devpipe_write+0x1c>
+
+008028de <devpipe_read>:
+{
+  8028de:	55                   	push   %ebp
+  8028df:	89 e5                	mov    %esp,%ebp
+  8028e1:	57                   	push   %edi
+  8028e2:	56                   	push   %esi
+  8028e3:	53                   	push   %ebx
+  8028e4:	83 ec 18             	sub    $0x18,%esp
+  8028e7:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8028ea:	57                   	push   %edi
+  8028eb:	e8 72 ec ff ff       	call   801562 <fd2data>
+  8028f0:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8028f2:	83 c4 10             	add    $0x10,%esp
+  8028f5:	be 00 00 00 00       	mov    $0x0,%esi
+  8028fa:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8028fd:	75 13                	jne    802912 <devpipe_read+0x34>
+	return i;
+  8028ff:	89 f0                	mov    %esi,%eax
+  802901:	eb 02                	jmp    802905 <devpipe_read+0x27>
+				return i;
+  802903:	89 f0                	mov    %esi,%eax
+}
+  802905:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802908:	5b                   	pop    %ebx
+  802909:	5e                   	pop    %esi
+  80290a:	5f                   	pop    %edi
+  80290b:	5d                   	pop    %ebp
+  80290c:	c3                   	ret
+			sys_yield();
+  80290d:	e8 37 e6 ff ff       	call   800f49 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802912:	8b 03                	mov    (%ebx),%eax
+  802914:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802917:	75 18                	jne    802931 <devpipe_read+0x53>
+			if (i > 0)
+  802919:	85 f6                	test   %esi,%esi
+  80291b:	75 e6                	jne    802903 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  80291d:	89 da                	mov    %ebx,%edx
+  80291f:	89 f8                	mov    %edi,%eax
+  802921:	e8 d4 fe ff ff       	call   8027fa <_pipeisclosed>
+  802926:	85 c0                	test   %eax,%eax
+  802928:	74 e3                	je     80290d <devpipe_read+0x2f>
+				return 0;
+  80292a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80292f:	eb d4                	jmp    802905 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802931:	99                   	cltd
+  802932:	c1 ea 1b             	shr    $0x1b,%edx
+  802935:	01 d0                	add    %edx,%eax
+  802937:	83 e0 1f             	and    $0x1f,%eax
+  80293a:	29 d0                	sub    %edx,%eax
+  80293c:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802941:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802944:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802947:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80294a:	83 c6 01             	add    $0x1,%esi
+  80294d:	eb ab                	jmp    8028fa <devpipe_read+0x1c>
+
+0080294f <pipe>:
+{
+  80294f:	55                   	push   %ebp
+  802950:	89 e5                	mov    %esp,%ebp
+  802952:	56                   	push   %esi
+  802953:	53                   	push   %ebx
+  802954:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802957:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80295a:	50                   	push   %eax
+  80295b:	e8 19 ec ff ff       	call   801579 <fd_alloc>
+  802960:	89 c3                	mov    %eax,%ebx
+  802962:	83 c4 10             	add    $0x10,%esp
+  802965:	85 c0                	test   %eax,%eax
+  802967:	0f 88 23 01 00 00    	js     802a90 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80296d:	83 ec 04             	sub    $0x4,%esp
+  802970:	68 07 04 00 00       	push   $0x407
+  802975:	ff 75 f4             	push   -0xc(%ebp)
+  802978:	6a 00                	push   $0x0
+  80297a:	e8 e9 e5 ff ff       	call   800f68 <sys_page_alloc>
+  80297f:	89 c3                	mov    %eax,%ebx
+  802981:	83 c4 10             	add    $0x10,%esp
+  802984:	85 c0                	test   %eax,%eax
+  802986:	0f 88 04 01 00 00    	js     802a90 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80298c:	83 ec 0c             	sub    $0xc,%esp
+  80298f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802992:	50                   	push   %eax
+  802993:	e8 e1 eb ff ff       	call   801579 <fd_alloc>
+  802998:	89 c3                	mov    %eax,%ebx
+  80299a:	83 c4 10             	add    $0x10,%esp
+  80299d:	85 c0                	test   %eax,%eax
+  80299f:	0f 88 db 00 00 00    	js     802a80 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8029a5:	83 ec 04             	sub    $0x4,%esp
+  8029a8:	68 07 04 00 00       	push   $0x407
+  8029ad:	ff 75 f0             	push   -0x10(%ebp)
+  8029b0:	6a 00                	push   $0x0
+  8029b2:	e8 b1 e5 ff ff       	call   800f68 <sys_page_alloc>
+  8029b7:	89 c3                	mov    %eax,%ebx
+  8029b9:	83 c4 10             	add    $0x10,%esp
+  8029bc:	85 c0                	test   %eax,%eax
+  8029be:	0f 88 bc 00 00 00    	js     802a80 <pipe+0x131>
+	va = fd2data(fd0);
+  8029c4:	83 ec 0c             	sub    $0xc,%esp
+  8029c7:	ff 75 f4             	push   -0xc(%ebp)
+  8029ca:	e8 93 eb ff ff       	call   801562 <fd2data>
+  8029cf:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8029d1:	83 c4 0c             	add    $0xc,%esp
+  8029d4:	68 07 04 00 00       	push   $0x407
+  8029d9:	50                   	push   %eax
+  8029da:	6a 00                	push   $0x0
+  8029dc:	e8 87 e5 ff ff       	call   800f68 <sys_page_alloc>
+  8029e1:	89 c3                	mov    %eax,%ebx
+  8029e3:	83 c4 10             	add    $0x10,%esp
+  8029e6:	85 c0                	test   %eax,%eax
+  8029e8:	0f 88 82 00 00 00    	js     802a70 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8029ee:	83 ec 0c             	sub    $0xc,%esp
+  8029f1:	ff 75 f0             	push   -0x10(%ebp)
+  8029f4:	e8 69 eb ff ff       	call   801562 <fd2data>
+  8029f9:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802a00:	50                   	push   %eax
+  802a01:	6a 00                	push   $0x0
+  802a03:	56                   	push   %esi
+  802a04:	6a 00                	push   $0x0
+  802a06:	e8 a0 e5 ff ff       	call   800fab <sys_page_map>
+  802a0b:	89 c3                	mov    %eax,%ebx
+  802a0d:	83 c4 20             	add    $0x20,%esp
+  802a10:	85 c0                	test   %eax,%eax
+  802a12:	78 4e                	js     802a62 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802a14:	a1 58 40 80 00       	mov    0x804058,%eax
+  802a19:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802a1c:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802a1e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802a21:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802a28:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802a2b:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802a2d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802a30:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802a37:	83 ec 0c             	sub    $0xc,%esp
+  802a3a:	ff 75 f4             	push   -0xc(%ebp)
+  802a3d:	e8 10 eb ff ff       	call   801552 <fd2num>
+  802a42:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802a45:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802a47:	83 c4 04             	add    $0x4,%esp
+  802a4a:	ff 75 f0             	push   -0x10(%ebp)
+  802a4d:	e8 00 eb ff ff       	call   801552 <fd2num>
+  802a52:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802a55:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802a58:	83 c4 10             	add    $0x10,%esp
+  802a5b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a60:	eb 2e                	jmp    802a90 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802a62:	83 ec 08             	sub    $0x8,%esp
+  802a65:	56                   	push   %esi
+  802a66:	6a 00                	push   $0x0
+  802a68:	e8 80 e5 ff ff       	call   800fed <sys_page_unmap>
+  802a6d:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802a70:	83 ec 08             	sub    $0x8,%esp
+  802a73:	ff 75 f0             	push   -0x10(%ebp)
+  802a76:	6a 00                	push   $0x0
+  802a78:	e8 70 e5 ff ff       	call   800fed <sys_page_unmap>
+  802a7d:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802a80:	83 ec 08             	sub    $0x8,%esp
+  802a83:	ff 75 f4             	push   -0xc(%ebp)
+  802a86:	6a 00                	push   $0x0
+  802a88:	e8 60 e5 ff ff       	call   800fed <sys_page_unmap>
+  802a8d:	83 c4 10             	add    $0x10,%esp
+}
+  802a90:	89 d8                	mov    %ebx,%eax
+  802a92:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a95:	5b                   	pop    %ebx
+  802a96:	5e                   	pop    %esi
+  802a97:	5d                   	pop    %ebp
+  802a98:	c3                   	ret
+
+00802a99 <pipeisclosed>:
+{
+  802a99:	55                   	push   %ebp
+  802a9a:	89 e5                	mov    %esp,%ebp
+  802a9c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802a9f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802aa2:	50                   	push   %eax
+  802aa3:	ff 75 08             	push   0x8(%ebp)
+  802aa6:	e8 24 eb ff ff       	call   8015cf <fd_lookup>
+  802aab:	83 c4 10             	add    $0x10,%esp
+  802aae:	85 c0                	test   %eax,%eax
+  802ab0:	78 18                	js     802aca <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802ab2:	83 ec 0c             	sub    $0xc,%esp
+  802ab5:	ff 75 f4             	push   -0xc(%ebp)
+  802ab8:	e8 a5 ea ff ff       	call   801562 <fd2data>
+  802abd:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802abf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ac2:	e8 33 fd ff ff       	call   8027fa <_pipeisclosed>
+  802ac7:	83 c4 10             	add    $0x10,%esp
+}
+  802aca:	c9                   	leave
+  802acb:	c3                   	ret
+
+00802acc <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  802acc:	55                   	push   %ebp
+  802acd:	89 e5                	mov    %esp,%ebp
+  802acf:	56                   	push   %esi
+  802ad0:	53                   	push   %ebx
+  802ad1:	8b 75 08             	mov    0x8(%ebp),%esi
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  802ad4:	85 f6                	test   %esi,%esi
+  802ad6:	74 15                	je     802aed <wait+0x21>
+	e = &envs[ENVX(envid)];
+  802ad8:	89 f0                	mov    %esi,%eax
+  802ada:	25 ff 03 00 00       	and    $0x3ff,%eax
+
+    while (e->env_id == envid && e->env_status != ENV_FREE) {
+  802adf:	8d 1c c0             	lea    (%eax,%eax,8),%ebx
+  802ae2:	c1 e3 04             	shl    $0x4,%ebx
+  802ae5:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  802aeb:	eb 1b                	jmp    802b08 <wait+0x3c>
+	assert(envid != 0);
+  802aed:	68 3a 39 80 00       	push   $0x80393a
+  802af2:	68 f3 37 80 00       	push   $0x8037f3
+  802af7:	6a 09                	push   $0x9
+  802af9:	68 45 39 80 00       	push   $0x803945
+  802afe:	e8 e5 d9 ff ff       	call   8004e8 <_panic>
+        sys_yield();
+  802b03:	e8 41 e4 ff ff       	call   800f49 <sys_yield>
+    while (e->env_id == envid && e->env_status != ENV_FREE) {
+  802b08:	8b 43 48             	mov    0x48(%ebx),%eax
+  802b0b:	39 f0                	cmp    %esi,%eax
+  802b0d:	75 07                	jne    802b16 <wait+0x4a>
+  802b0f:	8b 43 54             	mov    0x54(%ebx),%eax
+  802b12:	85 c0                	test   %eax,%eax
+  802b14:	75 ed                	jne    802b03 <wait+0x37>
+    }
+}
+  802b16:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b19:	5b                   	pop    %ebx
+  802b1a:	5e                   	pop    %esi
+  802b1b:	5d                   	pop    %ebp
+  802b1c:	c3                   	ret
+
+00802b1d <set_pgfault_handler>:
+// allocate an exception stack (one page of memory with its top
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf)) {
+  802b1d:	55                   	push   %ebp
+  802b1e:	89 e5                	mov    %esp,%ebp
+  802b20:	83 ec 08             	sub    $0x8,%esp
+  int r;
+
+  if (_pgfault_handler == 0) {
+  802b23:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  802b2a:	74 0a                	je     802b36 <set_pgfault_handler+0x19>
+    if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)))
+      panic(" set_pgfault_handler sys_env_set_pgfault_upcall panic: %e\n", r);
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  802b2c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b2f:	a3 00 80 80 00       	mov    %eax,0x808000
+
+
+}
+  802b34:	c9                   	leave
+  802b35:	c3                   	ret
+    if ((r = sys_page_alloc(0, (void *) (UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)))
+  802b36:	83 ec 04             	sub    $0x4,%esp
+  802b39:	6a 07                	push   $0x7
+  802b3b:	68 00 f0 bf ee       	push   $0xeebff000
+  802b40:	6a 00                	push   $0x0
+  802b42:	e8 21 e4 ff ff       	call   800f68 <sys_page_alloc>
+  802b47:	83 c4 10             	add    $0x10,%esp
+  802b4a:	85 c0                	test   %eax,%eax
+  802b4c:	75 28                	jne    802b76 <set_pgfault_handler+0x59>
+    if ((r = sys_env_set_pgfault_upcall(0, _pgfault_upcall)))
+  802b4e:	83 ec 08             	sub    $0x8,%esp
+  802b51:	68 88 2b 80 00       	push   $0x802b88
+  802b56:	6a 00                	push   $0x0
+  802b58:	e8 56 e5 ff ff       	call   8010b3 <sys_env_set_pgfault_upcall>
+  802b5d:	83 c4 10             	add    $0x10,%esp
+  802b60:	85 c0                	test   %eax,%eax
+  802b62:	74 c8                	je     802b2c <set_pgfault_handler+0xf>
+      panic(" set_pgfault_handler sys_env_set_pgfault_upcall panic: %e\n", r);
+  802b64:	50                   	push   %eax
+  802b65:	68 80 39 80 00       	push   $0x803980
+  802b6a:	6a 22                	push   $0x22
+  802b6c:	68 bb 39 80 00       	push   $0x8039bb
+  802b71:	e8 72 d9 ff ff       	call   8004e8 <_panic>
+      panic("set_pgfault_handler sys_page_alloc panic: %e\n", r);
+  802b76:	50                   	push   %eax
+  802b77:	68 50 39 80 00       	push   $0x803950
+  802b7c:	6a 20                	push   $0x20
+  802b7e:	68 bb 39 80 00       	push   $0x8039bb
+  802b83:	e8 60 d9 ff ff       	call   8004e8 <_panic>
+
+00802b88 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  802b88:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  802b89:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  802b8e:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  802b90:	83 c4 04             	add    $0x4,%esp
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	// push the trap-time %eip onto the trap-time stack
+    subl $0x4, 0x30(%esp) # for push eip
+  802b93:	83 6c 24 30 04       	subl   $0x4,0x30(%esp)
+    movl 0x30(%esp), %ebx #regular esp
+  802b98:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+    movl 0x28(%esp), %eax #eip
+  802b9c:	8b 44 24 28          	mov    0x28(%esp),%eax
+    movl %eax, (%ebx)
+  802ba0:	89 03                	mov    %eax,(%ebx)
+
+    // Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+    addl $8, %esp
+  802ba2:	83 c4 08             	add    $0x8,%esp
+    popal
+  802ba5:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  802ba6:	83 c4 04             	add    $0x4,%esp
+	popfl
+  802ba9:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp
+  802baa:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  802bab:	c3                   	ret
+
+00802bac <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  802bac:	55                   	push   %ebp
+  802bad:	89 e5                	mov    %esp,%ebp
+  802baf:	56                   	push   %esi
+  802bb0:	53                   	push   %ebx
+  802bb1:	8b 75 08             	mov    0x8(%ebp),%esi
+  802bb4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802bb7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  802bba:	85 c0                	test   %eax,%eax
+  802bbc:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802bc1:	0f 44 c2             	cmove  %edx,%eax
+  802bc4:	83 ec 0c             	sub    $0xc,%esp
+  802bc7:	50                   	push   %eax
+  802bc8:	e8 4b e5 ff ff       	call   801118 <sys_ipc_recv>
+
+  if (from_env_store)
+  802bcd:	83 c4 10             	add    $0x10,%esp
+  802bd0:	85 f6                	test   %esi,%esi
+  802bd2:	74 17                	je     802beb <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  802bd4:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bd9:	85 c0                	test   %eax,%eax
+  802bdb:	75 0c                	jne    802be9 <ipc_recv+0x3d>
+  802bdd:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  802be3:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  802be9:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  802beb:	85 db                	test   %ebx,%ebx
+  802bed:	74 2b                	je     802c1a <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  802bef:	85 c0                	test   %eax,%eax
+  802bf1:	74 0d                	je     802c00 <ipc_recv+0x54>
+  802bf3:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  802bf9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802bfc:	5b                   	pop    %ebx
+  802bfd:	5e                   	pop    %esi
+  802bfe:	5d                   	pop    %ebp
+  802bff:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  802c00:	a1 08 50 80 00       	mov    0x805008,%eax
+  802c05:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  802c0b:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  802c0d:	a1 08 50 80 00       	mov    0x805008,%eax
+  802c12:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  802c18:	eb df                	jmp    802bf9 <ipc_recv+0x4d>
+  802c1a:	85 c0                	test   %eax,%eax
+  802c1c:	75 db                	jne    802bf9 <ipc_recv+0x4d>
+  802c1e:	eb ed                	jmp    802c0d <ipc_recv+0x61>
+
+00802c20 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  802c20:	55                   	push   %ebp
+  802c21:	89 e5                	mov    %esp,%ebp
+  802c23:	57                   	push   %edi
+  802c24:	56                   	push   %esi
+  802c25:	53                   	push   %ebx
+  802c26:	83 ec 0c             	sub    $0xc,%esp
+  802c29:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802c2c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802c2f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  802c32:	85 db                	test   %ebx,%ebx
+  802c34:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802c39:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  802c3c:	ff 75 14             	push   0x14(%ebp)
+  802c3f:	53                   	push   %ebx
+  802c40:	56                   	push   %esi
+  802c41:	57                   	push   %edi
+  802c42:	e8 ae e4 ff ff       	call   8010f5 <sys_ipc_try_send>
+  802c47:	83 c4 10             	add    $0x10,%esp
+  802c4a:	85 c0                	test   %eax,%eax
+  802c4c:	74 1e                	je     802c6c <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  802c4e:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802c51:	75 07                	jne    802c5a <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  802c53:	e8 f1 e2 ff ff       	call   800f49 <sys_yield>
+  802c58:	eb e2                	jmp    802c3c <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  802c5a:	50                   	push   %eax
+  802c5b:	68 c9 39 80 00       	push   $0x8039c9
+  802c60:	6a 3c                	push   $0x3c
+  802c62:	68 d6 39 80 00       	push   $0x8039d6
+  802c67:	e8 7c d8 ff ff       	call   8004e8 <_panic>
+  }
+
+#endif
+}
+  802c6c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c6f:	5b                   	pop    %ebx
+  802c70:	5e                   	pop    %esi
+  802c71:	5f                   	pop    %edi
+  802c72:	5d                   	pop    %ebp
+  802c73:	c3                   	ret
+
+00802c74 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  802c74:	55                   	push   %ebp
+  802c75:	89 e5                	mov    %esp,%ebp
+  802c77:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  802c7a:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  802c7f:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802c82:	c1 e0 04             	shl    $0x4,%eax
+  802c85:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802c8a:	8b 40 50             	mov    0x50(%eax),%eax
+  802c8d:	39 c8                	cmp    %ecx,%eax
+  802c8f:	74 12                	je     802ca3 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  802c91:	83 c2 01             	add    $0x1,%edx
+  802c94:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802c9a:	75 e3                	jne    802c7f <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802c9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ca1:	eb 0e                	jmp    802cb1 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  802ca3:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802ca6:	c1 e0 04             	shl    $0x4,%eax
+  802ca9:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802cae:	8b 40 48             	mov    0x48(%eax),%eax
+  802cb1:	5d                   	pop    %ebp
+  802cb2:	c3                   	ret
+
+00802cb3 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802cb3:	55                   	push   %ebp
+  802cb4:	89 e5                	mov    %esp,%ebp
+  802cb6:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802cb9:	89 c2                	mov    %eax,%edx
+  802cbb:	c1 ea 16             	shr    $0x16,%edx
+  802cbe:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802cc5:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802cca:	f6 c1 01             	test   $0x1,%cl
+  802ccd:	74 1c                	je     802ceb <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  802ccf:	c1 e8 0c             	shr    $0xc,%eax
+  802cd2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802cd9:	a8 01                	test   $0x1,%al
+  802cdb:	74 0e                	je     802ceb <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802cdd:	c1 e8 0c             	shr    $0xc,%eax
+  802ce0:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802ce7:	ef 
+  802ce8:	0f b7 d2             	movzwl %dx,%edx
+}
+  802ceb:	89 d0                	mov    %edx,%eax
+  802ced:	5d                   	pop    %ebp
+  802cee:	c3                   	ret
+  802cef:	90                   	nop
+
+00802cf0 <__udivmoddi4>:
+  802cf0:	55                   	push   %ebp
+  802cf1:	57                   	push   %edi
+  802cf2:	56                   	push   %esi
+  802cf3:	53                   	push   %ebx
+  802cf4:	83 ec 24             	sub    $0x24,%esp
+  802cf7:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802cfb:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802cff:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  802d03:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802d07:	8b 54 24 44          	mov    0x44(%esp),%edx
+  802d0b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802d0f:	8b 44 24 40          	mov    0x40(%esp),%eax
+  802d13:	89 d3                	mov    %edx,%ebx
+  802d15:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802d19:	09 c3                	or     %eax,%ebx
+  802d1b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802d1f:	0f 84 9c 00 00 00    	je     802dc1 <__udivmoddi4+0xd1>
+  802d25:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802d2c:	00 
+  802d2d:	31 c0                	xor    %eax,%eax
+  802d2f:	31 d2                	xor    %edx,%edx
+  802d31:	89 fb                	mov    %edi,%ebx
+  802d33:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802d3a:	00 
+  802d3b:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802d40:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802d44:	01 c0                	add    %eax,%eax
+  802d46:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802d4d:	00 
+  802d4e:	89 c6                	mov    %eax,%esi
+  802d50:	89 d7                	mov    %edx,%edi
+  802d52:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802d56:	8b 54 24 14          	mov    0x14(%esp),%edx
+  802d5a:	0f ad d0             	shrd   %cl,%edx,%eax
+  802d5d:	d3 ea                	shr    %cl,%edx
+  802d5f:	f6 c1 20             	test   $0x20,%cl
+  802d62:	0f 45 c2             	cmovne %edx,%eax
+  802d65:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802d69:	83 e0 01             	and    $0x1,%eax
+  802d6c:	09 fa                	or     %edi,%edx
+  802d6e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802d72:	89 04 24             	mov    %eax,(%esp)
+  802d75:	8b 04 24             	mov    (%esp),%eax
+  802d78:	89 d5                	mov    %edx,%ebp
+  802d7a:	09 f0                	or     %esi,%eax
+  802d7c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802d80:	39 f0                	cmp    %esi,%eax
+  802d82:	19 fd                	sbb    %edi,%ebp
+  802d84:	72 1d                	jb     802da3 <__udivmoddi4+0xb3>
+  802d86:	29 f0                	sub    %esi,%eax
+  802d88:	19 fa                	sbb    %edi,%edx
+  802d8a:	89 cf                	mov    %ecx,%edi
+  802d8c:	c1 ef 05             	shr    $0x5,%edi
+  802d8f:	83 e7 01             	and    $0x1,%edi
+  802d92:	89 fe                	mov    %edi,%esi
+  802d94:	d3 e7                	shl    %cl,%edi
+  802d96:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802d9a:	83 f6 01             	xor    $0x1,%esi
+  802d9d:	d3 e6                	shl    %cl,%esi
+  802d9f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802da3:	83 e9 01             	sub    $0x1,%ecx
+  802da6:	73 98                	jae    802d40 <__udivmoddi4+0x50>
+  802da8:	85 db                	test   %ebx,%ebx
+  802daa:	74 05                	je     802db1 <__udivmoddi4+0xc1>
+  802dac:	89 03                	mov    %eax,(%ebx)
+  802dae:	89 53 04             	mov    %edx,0x4(%ebx)
+  802db1:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802db5:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802db9:	83 c4 24             	add    $0x24,%esp
+  802dbc:	5b                   	pop    %ebx
+  802dbd:	5e                   	pop    %esi
+  802dbe:	5f                   	pop    %edi
+  802dbf:	5d                   	pop    %ebp
+  802dc0:	c3                   	ret
+  802dc1:	85 ff                	test   %edi,%edi
+  802dc3:	74 0d                	je     802dd2 <__udivmoddi4+0xe2>
+  802dc5:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  802dcb:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  802dd2:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802dd6:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802dda:	89 44 24 18          	mov    %eax,0x18(%esp)
+  802dde:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802de2:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802de6:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802dea:	83 c4 24             	add    $0x24,%esp
+  802ded:	5b                   	pop    %ebx
+  802dee:	5e                   	pop    %esi
+  802def:	5f                   	pop    %edi
+  802df0:	5d                   	pop    %ebp
+  802df1:	c3                   	ret
+  802df2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802df9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00802e00 <__udivdi3>:
+  802e00:	57                   	push   %edi
+  802e01:	56                   	push   %esi
+  802e02:	53                   	push   %ebx
+  802e03:	83 ec 20             	sub    $0x20,%esp
+  802e06:	8b 54 24 34          	mov    0x34(%esp),%edx
+  802e0a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  802e0e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802e12:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802e16:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802e1a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802e1e:	89 d1                	mov    %edx,%ecx
+  802e20:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802e24:	09 c1                	or     %eax,%ecx
+  802e26:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802e2a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  802e2e:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802e32:	0f 84 88 00 00 00    	je     802ec0 <__udivdi3+0xc0>
+  802e38:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802e3f:	00 
+  802e40:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802e45:	31 c0                	xor    %eax,%eax
+  802e47:	31 d2                	xor    %edx,%edx
+  802e49:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802e50:	00 
+  802e51:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802e58:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802e5c:	01 c0                	add    %eax,%eax
+  802e5e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802e65:	00 
+  802e66:	89 c6                	mov    %eax,%esi
+  802e68:	89 d7                	mov    %edx,%edi
+  802e6a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802e6e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802e72:	0f ad d0             	shrd   %cl,%edx,%eax
+  802e75:	d3 ea                	shr    %cl,%edx
+  802e77:	f6 c1 20             	test   $0x20,%cl
+  802e7a:	0f 45 c2             	cmovne %edx,%eax
+  802e7d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802e81:	83 e0 01             	and    $0x1,%eax
+  802e84:	09 fa                	or     %edi,%edx
+  802e86:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802e8a:	89 04 24             	mov    %eax,(%esp)
+  802e8d:	8b 04 24             	mov    (%esp),%eax
+  802e90:	89 d3                	mov    %edx,%ebx
+  802e92:	09 f0                	or     %esi,%eax
+  802e94:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802e98:	39 f0                	cmp    %esi,%eax
+  802e9a:	19 fb                	sbb    %edi,%ebx
+  802e9c:	72 1d                	jb     802ebb <__udivdi3+0xbb>
+  802e9e:	29 f0                	sub    %esi,%eax
+  802ea0:	19 fa                	sbb    %edi,%edx
+  802ea2:	89 cf                	mov    %ecx,%edi
+  802ea4:	c1 ef 05             	shr    $0x5,%edi
+  802ea7:	83 e7 01             	and    $0x1,%edi
+  802eaa:	89 fe                	mov    %edi,%esi
+  802eac:	d3 e7                	shl    %cl,%edi
+  802eae:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802eb2:	83 f6 01             	xor    $0x1,%esi
+  802eb5:	d3 e6                	shl    %cl,%esi
+  802eb7:	09 74 24 18          	or     %esi,0x18(%esp)
+  802ebb:	83 e9 01             	sub    $0x1,%ecx
+  802ebe:	73 98                	jae    802e58 <__udivdi3+0x58>
+  802ec0:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802ec4:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802ec8:	83 c4 20             	add    $0x20,%esp
+  802ecb:	5b                   	pop    %ebx
+  802ecc:	5e                   	pop    %esi
+  802ecd:	5f                   	pop    %edi
+  802ece:	c3                   	ret
+  802ecf:	90                   	nop
+
+00802ed0 <__umoddi3>:
+  802ed0:	57                   	push   %edi
+  802ed1:	56                   	push   %esi
+  802ed2:	53                   	push   %ebx
+  802ed3:	83 ec 18             	sub    $0x18,%esp
+  802ed6:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802eda:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802ede:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802ee2:	8b 54 24 34          	mov    0x34(%esp),%edx
+  802ee6:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802eea:	8b 44 24 30          	mov    0x30(%esp),%eax
+  802eee:	89 d1                	mov    %edx,%ecx
+  802ef0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802ef4:	09 c1                	or     %eax,%ecx
+  802ef6:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802efa:	74 5b                	je     802f57 <__umoddi3+0x87>
+  802efc:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802f01:	31 c0                	xor    %eax,%eax
+  802f03:	31 d2                	xor    %edx,%edx
+  802f05:	8d 76 00             	lea    0x0(%esi),%esi
+  802f08:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802f0c:	01 c0                	add    %eax,%eax
+  802f0e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802f15:	00 
+  802f16:	89 c6                	mov    %eax,%esi
+  802f18:	89 d7                	mov    %edx,%edi
+  802f1a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802f1e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802f22:	0f ad d0             	shrd   %cl,%edx,%eax
+  802f25:	d3 ea                	shr    %cl,%edx
+  802f27:	f6 c1 20             	test   $0x20,%cl
+  802f2a:	0f 45 c2             	cmovne %edx,%eax
+  802f2d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802f31:	83 e0 01             	and    $0x1,%eax
+  802f34:	09 fa                	or     %edi,%edx
+  802f36:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802f3a:	89 04 24             	mov    %eax,(%esp)
+  802f3d:	8b 04 24             	mov    (%esp),%eax
+  802f40:	89 d3                	mov    %edx,%ebx
+  802f42:	09 f0                	or     %esi,%eax
+  802f44:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802f48:	39 f0                	cmp    %esi,%eax
+  802f4a:	19 fb                	sbb    %edi,%ebx
+  802f4c:	72 04                	jb     802f52 <__umoddi3+0x82>
+  802f4e:	29 f0                	sub    %esi,%eax
+  802f50:	19 fa                	sbb    %edi,%edx
+  802f52:	83 e9 01             	sub    $0x1,%ecx
+  802f55:	73 b1                	jae    802f08 <__umoddi3+0x38>
+  802f57:	83 c4 18             	add    $0x18,%esp
+  802f5a:	5b                   	pop    %ebx
+  802f5b:	5e                   	pop    %esi
+  802f5c:	5f                   	pop    %edi
+  802f5d:	c3                   	ret
+  802f5e:	66 90                	xchg   %ax,%ax
+
+00802f60 <__divdi3>:
+  802f60:	55                   	push   %ebp
+  802f61:	57                   	push   %edi
+  802f62:	56                   	push   %esi
+  802f63:	53                   	push   %ebx
+  802f64:	83 ec 24             	sub    $0x24,%esp
+  802f67:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  802f6b:	8b 74 24 44          	mov    0x44(%esp),%esi
+  802f6f:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802f73:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802f77:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  802f7b:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802f7f:	85 d2                	test   %edx,%edx
+  802f81:	0f 88 e0 00 00 00    	js     803067 <__divdi3+0x107>
+  802f87:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  802f8b:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  802f8f:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802f93:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802f97:	85 f6                	test   %esi,%esi
+  802f99:	78 16                	js     802fb1 <__divdi3+0x51>
+  802f9b:	89 f1                	mov    %esi,%ecx
+  802f9d:	31 c0                	xor    %eax,%eax
+  802f9f:	31 d2                	xor    %edx,%edx
+  802fa1:	09 d9                	or     %ebx,%ecx
+  802fa3:	0f 85 f3 00 00 00    	jne    80309c <__divdi3+0x13c>
+  802fa9:	83 c4 24             	add    $0x24,%esp
+  802fac:	5b                   	pop    %ebx
+  802fad:	5e                   	pop    %esi
+  802fae:	5f                   	pop    %edi
+  802faf:	5d                   	pop    %ebp
+  802fb0:	c3                   	ret
+  802fb1:	bf 01 00 00 00       	mov    $0x1,%edi
+  802fb6:	f7 5c 24 08          	negl   0x8(%esp)
+  802fba:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  802fbf:	f7 5c 24 0c          	negl   0xc(%esp)
+  802fc3:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802fca:	00 
+  802fcb:	31 c0                	xor    %eax,%eax
+  802fcd:	31 d2                	xor    %edx,%edx
+  802fcf:	89 fb                	mov    %edi,%ebx
+  802fd1:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802fd8:	00 
+  802fd9:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802fde:	66 90                	xchg   %ax,%ax
+  802fe0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802fe4:	01 c0                	add    %eax,%eax
+  802fe6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802fed:	00 
+  802fee:	89 c6                	mov    %eax,%esi
+  802ff0:	89 d7                	mov    %edx,%edi
+  802ff2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802ff6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  802ffa:	0f ad d0             	shrd   %cl,%edx,%eax
+  802ffd:	d3 ea                	shr    %cl,%edx
+  802fff:	f6 c1 20             	test   $0x20,%cl
+  803002:	0f 45 c2             	cmovne %edx,%eax
+  803005:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803009:	83 e0 01             	and    $0x1,%eax
+  80300c:	09 fa                	or     %edi,%edx
+  80300e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  803012:	89 04 24             	mov    %eax,(%esp)
+  803015:	8b 04 24             	mov    (%esp),%eax
+  803018:	89 d5                	mov    %edx,%ebp
+  80301a:	09 f0                	or     %esi,%eax
+  80301c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  803020:	39 f0                	cmp    %esi,%eax
+  803022:	19 fd                	sbb    %edi,%ebp
+  803024:	72 1d                	jb     803043 <__divdi3+0xe3>
+  803026:	29 f0                	sub    %esi,%eax
+  803028:	19 fa                	sbb    %edi,%edx
+  80302a:	89 cf                	mov    %ecx,%edi
+  80302c:	c1 ef 05             	shr    $0x5,%edi
+  80302f:	83 e7 01             	and    $0x1,%edi
+  803032:	89 fe                	mov    %edi,%esi
+  803034:	d3 e7                	shl    %cl,%edi
+  803036:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80303a:	83 f6 01             	xor    $0x1,%esi
+  80303d:	d3 e6                	shl    %cl,%esi
+  80303f:	09 74 24 18          	or     %esi,0x18(%esp)
+  803043:	83 e9 01             	sub    $0x1,%ecx
+  803046:	73 98                	jae    802fe0 <__divdi3+0x80>
+  803048:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80304c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803050:	85 db                	test   %ebx,%ebx
+  803052:	0f 84 51 ff ff ff    	je     802fa9 <__divdi3+0x49>
+  803058:	f7 d8                	neg    %eax
+  80305a:	83 d2 00             	adc    $0x0,%edx
+  80305d:	83 c4 24             	add    $0x24,%esp
+  803060:	5b                   	pop    %ebx
+  803061:	f7 da                	neg    %edx
+  803063:	5e                   	pop    %esi
+  803064:	5f                   	pop    %edi
+  803065:	5d                   	pop    %ebp
+  803066:	c3                   	ret
+  803067:	f7 d8                	neg    %eax
+  803069:	83 d2 00             	adc    $0x0,%edx
+  80306c:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803070:	f7 da                	neg    %edx
+  803072:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803076:	85 f6                	test   %esi,%esi
+  803078:	78 1b                	js     803095 <__divdi3+0x135>
+  80307a:	89 f1                	mov    %esi,%ecx
+  80307c:	31 c0                	xor    %eax,%eax
+  80307e:	31 d2                	xor    %edx,%edx
+  803080:	bf 01 00 00 00       	mov    $0x1,%edi
+  803085:	09 d9                	or     %ebx,%ecx
+  803087:	0f 85 36 ff ff ff    	jne    802fc3 <__divdi3+0x63>
+  80308d:	83 c4 24             	add    $0x24,%esp
+  803090:	5b                   	pop    %ebx
+  803091:	5e                   	pop    %esi
+  803092:	5f                   	pop    %edi
+  803093:	5d                   	pop    %ebp
+  803094:	c3                   	ret
+  803095:	31 ff                	xor    %edi,%edi
+  803097:	e9 1a ff ff ff       	jmp    802fb6 <__divdi3+0x56>
+  80309c:	31 ff                	xor    %edi,%edi
+  80309e:	e9 20 ff ff ff       	jmp    802fc3 <__divdi3+0x63>
+  8030a3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8030aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+008030b0 <__moddi3>:
+  8030b0:	55                   	push   %ebp
+  8030b1:	57                   	push   %edi
+  8030b2:	56                   	push   %esi
+  8030b3:	53                   	push   %ebx
+  8030b4:	83 ec 1c             	sub    $0x1c,%esp
+  8030b7:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  8030bb:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  8030bf:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  8030c3:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  8030c7:	89 c8                	mov    %ecx,%eax
+  8030c9:	89 f2                	mov    %esi,%edx
+  8030cb:	89 f3                	mov    %esi,%ebx
+  8030cd:	85 ed                	test   %ebp,%ebp
+  8030cf:	0f 88 9d 00 00 00    	js     803172 <__moddi3+0xc2>
+  8030d5:	09 cb                	or     %ecx,%ebx
+  8030d7:	0f 84 8d 00 00 00    	je     80316a <__moddi3+0xba>
+  8030dd:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  8030e1:	31 db                	xor    %ebx,%ebx
+  8030e3:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  8030e7:	89 ca                	mov    %ecx,%edx
+  8030e9:	89 f0                	mov    %esi,%eax
+  8030eb:	89 dd                	mov    %ebx,%ebp
+  8030ed:	f7 da                	neg    %edx
+  8030ef:	83 d0 00             	adc    $0x0,%eax
+  8030f2:	f7 d8                	neg    %eax
+  8030f4:	0f 49 f0             	cmovns %eax,%esi
+  8030f7:	0f 49 ca             	cmovns %edx,%ecx
+  8030fa:	31 c0                	xor    %eax,%eax
+  8030fc:	31 d2                	xor    %edx,%edx
+  8030fe:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  803102:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803106:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80310b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80310f:	90                   	nop
+  803110:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803114:	01 c0                	add    %eax,%eax
+  803116:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80311d:	00 
+  80311e:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  803122:	89 c6                	mov    %eax,%esi
+  803124:	89 d7                	mov    %edx,%edi
+  803126:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80312a:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80312e:	0f ad d0             	shrd   %cl,%edx,%eax
+  803131:	d3 ea                	shr    %cl,%edx
+  803133:	f6 c1 20             	test   $0x20,%cl
+  803136:	0f 45 c2             	cmovne %edx,%eax
+  803139:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80313d:	83 e0 01             	and    $0x1,%eax
+  803140:	09 fa                	or     %edi,%edx
+  803142:	89 04 24             	mov    %eax,(%esp)
+  803145:	8b 04 24             	mov    (%esp),%eax
+  803148:	89 d7                	mov    %edx,%edi
+  80314a:	09 f0                	or     %esi,%eax
+  80314c:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  803150:	39 d8                	cmp    %ebx,%eax
+  803152:	19 f7                	sbb    %esi,%edi
+  803154:	72 04                	jb     80315a <__moddi3+0xaa>
+  803156:	29 d8                	sub    %ebx,%eax
+  803158:	19 f2                	sbb    %esi,%edx
+  80315a:	83 e9 01             	sub    $0x1,%ecx
+  80315d:	73 b1                	jae    803110 <__moddi3+0x60>
+  80315f:	85 ed                	test   %ebp,%ebp
+  803161:	74 07                	je     80316a <__moddi3+0xba>
+  803163:	f7 d8                	neg    %eax
+  803165:	83 d2 00             	adc    $0x0,%edx
+  803168:	f7 da                	neg    %edx
+  80316a:	83 c4 1c             	add    $0x1c,%esp
+  80316d:	5b                   	pop    %ebx
+  80316e:	5e                   	pop    %esi
+  80316f:	5f                   	pop    %edi
+  803170:	5d                   	pop    %ebp
+  803171:	c3                   	ret
+  803172:	09 cb                	or     %ecx,%ebx
+  803174:	74 f4                	je     80316a <__moddi3+0xba>
+  803176:	f7 df                	neg    %edi
+  803178:	bb 01 00 00 00       	mov    $0x1,%ebx
+  80317d:	83 d5 00             	adc    $0x0,%ebp
+  803180:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  803184:	f7 dd                	neg    %ebp
+  803186:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  80318a:	e9 58 ff ff ff       	jmp    8030e7 <__moddi3+0x37>
@@ -0,0 +1,5346 @@
+
+obj/user/testtime.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 c5 00 00 00       	call   8000f6 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <sleep>:
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+void
+sleep(int sec)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 04             	sub    $0x4,%esp
+	unsigned now = sys_time_msec();
+  80003a:	e8 cc 0d 00 00       	call   800e0b <sys_time_msec>
+	unsigned end = now + sec * 1000;
+  80003f:	69 5d 08 e8 03 00 00 	imul   $0x3e8,0x8(%ebp),%ebx
+  800046:	01 c3                	add    %eax,%ebx
+
+	if ((int)now < 0 && (int)now > -MAXERROR)
+  800048:	85 c0                	test   %eax,%eax
+  80004a:	79 05                	jns    800051 <sleep+0x1e>
+  80004c:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  80004f:	7d 18                	jge    800069 <sleep+0x36>
+		panic("sys_time_msec: %e", (int)now);
+	if (end < now)
+  800051:	39 c3                	cmp    %eax,%ebx
+  800053:	73 2b                	jae    800080 <sleep+0x4d>
+		panic("sleep: wrap");
+  800055:	83 ec 04             	sub    $0x4,%esp
+  800058:	68 c2 25 80 00       	push   $0x8025c2
+  80005d:	6a 0d                	push   $0xd
+  80005f:	68 b2 25 80 00       	push   $0x8025b2
+  800064:	e8 f0 00 00 00       	call   800159 <_panic>
+		panic("sys_time_msec: %e", (int)now);
+  800069:	50                   	push   %eax
+  80006a:	68 a0 25 80 00       	push   $0x8025a0
+  80006f:	6a 0b                	push   $0xb
+  800071:	68 b2 25 80 00       	push   $0x8025b2
+  800076:	e8 de 00 00 00       	call   800159 <_panic>
+
+	while (sys_time_msec() < end)
+		sys_yield();
+  80007b:	e8 3a 0b 00 00       	call   800bba <sys_yield>
+	while (sys_time_msec() < end)
+  800080:	e8 86 0d 00 00       	call   800e0b <sys_time_msec>
+  800085:	39 d8                	cmp    %ebx,%eax
+  800087:	72 f2                	jb     80007b <sleep+0x48>
+}
+  800089:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80008c:	c9                   	leave
+  80008d:	c3                   	ret
+
+0080008e <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  80008e:	55                   	push   %ebp
+  80008f:	89 e5                	mov    %esp,%ebp
+  800091:	53                   	push   %ebx
+  800092:	83 ec 04             	sub    $0x4,%esp
+	int i;
+
+	// Wait for the console to calm down
+	for (i = 0; i < 50; i++)
+  800095:	bb 33 00 00 00       	mov    $0x33,%ebx
+  80009a:	eb 05                	jmp    8000a1 <umain+0x13>
+		sys_yield();
+  80009c:	e8 19 0b 00 00       	call   800bba <sys_yield>
+	for (i = 0; i < 50; i++)
+  8000a1:	83 eb 01             	sub    $0x1,%ebx
+  8000a4:	75 f6                	jne    80009c <umain+0xe>
+
+	cprintf("starting count down: ");
+  8000a6:	83 ec 0c             	sub    $0xc,%esp
+  8000a9:	68 ce 25 80 00       	push   $0x8025ce
+  8000ae:	e8 81 01 00 00       	call   800234 <cprintf>
+  8000b3:	83 c4 10             	add    $0x10,%esp
+	for (i = 5; i >= 0; i--) {
+  8000b6:	bb 05 00 00 00       	mov    $0x5,%ebx
+		cprintf("%d ", i);
+  8000bb:	83 ec 08             	sub    $0x8,%esp
+  8000be:	53                   	push   %ebx
+  8000bf:	68 e4 25 80 00       	push   $0x8025e4
+  8000c4:	e8 6b 01 00 00       	call   800234 <cprintf>
+		sleep(1);
+  8000c9:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  8000d0:	e8 5e ff ff ff       	call   800033 <sleep>
+	for (i = 5; i >= 0; i--) {
+  8000d5:	83 eb 01             	sub    $0x1,%ebx
+  8000d8:	83 c4 10             	add    $0x10,%esp
+  8000db:	83 fb ff             	cmp    $0xffffffff,%ebx
+  8000de:	75 db                	jne    8000bb <umain+0x2d>
+	}
+	cprintf("\n");
+  8000e0:	83 ec 0c             	sub    $0xc,%esp
+  8000e3:	68 64 2a 80 00       	push   $0x802a64
+  8000e8:	e8 47 01 00 00       	call   800234 <cprintf>
+#include <inc/types.h>
+
+static inline void
+breakpoint(void)
+{
+	asm volatile("int3");
+  8000ed:	cc                   	int3
+	breakpoint();
+}
+  8000ee:	83 c4 10             	add    $0x10,%esp
+  8000f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000f4:	c9                   	leave
+  8000f5:	c3                   	ret
+
+008000f6 <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  8000f6:	55                   	push   %ebp
+  8000f7:	89 e5                	mov    %esp,%ebp
+  8000f9:	56                   	push   %esi
+  8000fa:	53                   	push   %ebx
+  8000fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000fe:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  800101:	e8 95 0a 00 00       	call   800b9b <sys_getenvid>
+  800106:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80010b:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80010e:	c1 e0 04             	shl    $0x4,%eax
+  800111:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800116:	a3 08 40 80 00       	mov    %eax,0x804008
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  80011b:	85 db                	test   %ebx,%ebx
+  80011d:	7e 07                	jle    800126 <libmain+0x30>
+    binaryname = argv[0];
+  80011f:	8b 06                	mov    (%esi),%eax
+  800121:	a3 00 30 80 00       	mov    %eax,0x803000
+
+  // call user main routine
+  umain(argc, argv);
+  800126:	83 ec 08             	sub    $0x8,%esp
+  800129:	56                   	push   %esi
+  80012a:	53                   	push   %ebx
+  80012b:	e8 5e ff ff ff       	call   80008e <umain>
+
+  // exit gracefully
+  exit();
+  800130:	e8 0a 00 00 00       	call   80013f <exit>
+}
+  800135:	83 c4 10             	add    $0x10,%esp
+  800138:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80013b:	5b                   	pop    %ebx
+  80013c:	5e                   	pop    %esi
+  80013d:	5d                   	pop    %ebp
+  80013e:	c3                   	ret
+
+0080013f <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80013f:	55                   	push   %ebp
+  800140:	89 e5                	mov    %esp,%ebp
+  800142:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800145:	e8 36 0f 00 00       	call   801080 <close_all>
+	sys_env_destroy(0);
+  80014a:	83 ec 0c             	sub    $0xc,%esp
+  80014d:	6a 00                	push   $0x0
+  80014f:	e8 06 0a 00 00       	call   800b5a <sys_env_destroy>
+}
+  800154:	83 c4 10             	add    $0x10,%esp
+  800157:	c9                   	leave
+  800158:	c3                   	ret
+
+00800159 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800159:	55                   	push   %ebp
+  80015a:	89 e5                	mov    %esp,%ebp
+  80015c:	56                   	push   %esi
+  80015d:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80015e:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800161:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  800167:	e8 2f 0a 00 00       	call   800b9b <sys_getenvid>
+  80016c:	83 ec 0c             	sub    $0xc,%esp
+  80016f:	ff 75 0c             	push   0xc(%ebp)
+  800172:	ff 75 08             	push   0x8(%ebp)
+  800175:	56                   	push   %esi
+  800176:	50                   	push   %eax
+  800177:	68 f4 25 80 00       	push   $0x8025f4
+  80017c:	e8 b3 00 00 00       	call   800234 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800181:	83 c4 18             	add    $0x18,%esp
+  800184:	53                   	push   %ebx
+  800185:	ff 75 10             	push   0x10(%ebp)
+  800188:	e8 56 00 00 00       	call   8001e3 <vcprintf>
+	cprintf("\n");
+  80018d:	c7 04 24 64 2a 80 00 	movl   $0x802a64,(%esp)
+  800194:	e8 9b 00 00 00       	call   800234 <cprintf>
+  800199:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80019c:	cc                   	int3
+	while (1)
+  80019d:	eb fd                	jmp    80019c <_panic+0x43>
+
+0080019f <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80019f:	55                   	push   %ebp
+  8001a0:	89 e5                	mov    %esp,%ebp
+  8001a2:	53                   	push   %ebx
+  8001a3:	83 ec 04             	sub    $0x4,%esp
+  8001a6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8001a9:	8b 13                	mov    (%ebx),%edx
+  8001ab:	8d 42 01             	lea    0x1(%edx),%eax
+  8001ae:	89 03                	mov    %eax,(%ebx)
+  8001b0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001b3:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8001b7:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001bc:	74 09                	je     8001c7 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001be:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001c2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001c5:	c9                   	leave
+  8001c6:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8001c7:	83 ec 08             	sub    $0x8,%esp
+  8001ca:	68 ff 00 00 00       	push   $0xff
+  8001cf:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001d2:	50                   	push   %eax
+  8001d3:	e8 45 09 00 00       	call   800b1d <sys_cputs>
+		b->idx = 0;
+  8001d8:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001de:	83 c4 10             	add    $0x10,%esp
+  8001e1:	eb db                	jmp    8001be <putch+0x1f>
+
+008001e3 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001e3:	55                   	push   %ebp
+  8001e4:	89 e5                	mov    %esp,%ebp
+  8001e6:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001ec:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001f3:	00 00 00 
+	b.cnt = 0;
+  8001f6:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001fd:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800200:	ff 75 0c             	push   0xc(%ebp)
+  800203:	ff 75 08             	push   0x8(%ebp)
+  800206:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80020c:	50                   	push   %eax
+  80020d:	68 9f 01 80 00       	push   $0x80019f
+  800212:	e8 14 01 00 00       	call   80032b <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800217:	83 c4 08             	add    $0x8,%esp
+  80021a:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800220:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800226:	50                   	push   %eax
+  800227:	e8 f1 08 00 00       	call   800b1d <sys_cputs>
+
+	return b.cnt;
+}
+  80022c:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800232:	c9                   	leave
+  800233:	c3                   	ret
+
+00800234 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800234:	55                   	push   %ebp
+  800235:	89 e5                	mov    %esp,%ebp
+  800237:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80023a:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80023d:	50                   	push   %eax
+  80023e:	ff 75 08             	push   0x8(%ebp)
+  800241:	e8 9d ff ff ff       	call   8001e3 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800246:	c9                   	leave
+  800247:	c3                   	ret
+
+00800248 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800248:	55                   	push   %ebp
+  800249:	89 e5                	mov    %esp,%ebp
+  80024b:	57                   	push   %edi
+  80024c:	56                   	push   %esi
+  80024d:	53                   	push   %ebx
+  80024e:	83 ec 1c             	sub    $0x1c,%esp
+  800251:	89 c7                	mov    %eax,%edi
+  800253:	89 d6                	mov    %edx,%esi
+  800255:	8b 45 08             	mov    0x8(%ebp),%eax
+  800258:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80025b:	89 d1                	mov    %edx,%ecx
+  80025d:	89 c2                	mov    %eax,%edx
+  80025f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800262:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800265:	8b 45 10             	mov    0x10(%ebp),%eax
+  800268:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80026b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80026e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800275:	39 c2                	cmp    %eax,%edx
+  800277:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80027a:	72 3e                	jb     8002ba <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80027c:	83 ec 0c             	sub    $0xc,%esp
+  80027f:	ff 75 18             	push   0x18(%ebp)
+  800282:	83 eb 01             	sub    $0x1,%ebx
+  800285:	53                   	push   %ebx
+  800286:	50                   	push   %eax
+  800287:	83 ec 08             	sub    $0x8,%esp
+  80028a:	ff 75 e4             	push   -0x1c(%ebp)
+  80028d:	ff 75 e0             	push   -0x20(%ebp)
+  800290:	ff 75 dc             	push   -0x24(%ebp)
+  800293:	ff 75 d8             	push   -0x28(%ebp)
+  800296:	e8 75 1f 00 00       	call   802210 <__udivdi3>
+  80029b:	83 c4 18             	add    $0x18,%esp
+  80029e:	52                   	push   %edx
+  80029f:	50                   	push   %eax
+  8002a0:	89 f2                	mov    %esi,%edx
+  8002a2:	89 f8                	mov    %edi,%eax
+  8002a4:	e8 9f ff ff ff       	call   800248 <printnum>
+  8002a9:	83 c4 20             	add    $0x20,%esp
+  8002ac:	eb 13                	jmp    8002c1 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8002ae:	83 ec 08             	sub    $0x8,%esp
+  8002b1:	56                   	push   %esi
+  8002b2:	ff 75 18             	push   0x18(%ebp)
+  8002b5:	ff d7                	call   *%edi
+  8002b7:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8002ba:	83 eb 01             	sub    $0x1,%ebx
+  8002bd:	85 db                	test   %ebx,%ebx
+  8002bf:	7f ed                	jg     8002ae <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8002c1:	83 ec 08             	sub    $0x8,%esp
+  8002c4:	56                   	push   %esi
+  8002c5:	83 ec 04             	sub    $0x4,%esp
+  8002c8:	ff 75 e4             	push   -0x1c(%ebp)
+  8002cb:	ff 75 e0             	push   -0x20(%ebp)
+  8002ce:	ff 75 dc             	push   -0x24(%ebp)
+  8002d1:	ff 75 d8             	push   -0x28(%ebp)
+  8002d4:	e8 07 20 00 00       	call   8022e0 <__umoddi3>
+  8002d9:	83 c4 14             	add    $0x14,%esp
+  8002dc:	0f be 80 17 26 80 00 	movsbl 0x802617(%eax),%eax
+  8002e3:	50                   	push   %eax
+  8002e4:	ff d7                	call   *%edi
+}
+  8002e6:	83 c4 10             	add    $0x10,%esp
+  8002e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002ec:	5b                   	pop    %ebx
+  8002ed:	5e                   	pop    %esi
+  8002ee:	5f                   	pop    %edi
+  8002ef:	5d                   	pop    %ebp
+  8002f0:	c3                   	ret
+
+008002f1 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002f1:	55                   	push   %ebp
+  8002f2:	89 e5                	mov    %esp,%ebp
+  8002f4:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8002f7:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002fb:	8b 10                	mov    (%eax),%edx
+  8002fd:	3b 50 04             	cmp    0x4(%eax),%edx
+  800300:	73 0a                	jae    80030c <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800302:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800305:	89 08                	mov    %ecx,(%eax)
+  800307:	8b 45 08             	mov    0x8(%ebp),%eax
+  80030a:	88 02                	mov    %al,(%edx)
+}
+  80030c:	5d                   	pop    %ebp
+  80030d:	c3                   	ret
+
+0080030e <printfmt>:
+{
+  80030e:	55                   	push   %ebp
+  80030f:	89 e5                	mov    %esp,%ebp
+  800311:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800314:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800317:	50                   	push   %eax
+  800318:	ff 75 10             	push   0x10(%ebp)
+  80031b:	ff 75 0c             	push   0xc(%ebp)
+  80031e:	ff 75 08             	push   0x8(%ebp)
+  800321:	e8 05 00 00 00       	call   80032b <vprintfmt>
+}
+  800326:	83 c4 10             	add    $0x10,%esp
+  800329:	c9                   	leave
+  80032a:	c3                   	ret
+
+0080032b <vprintfmt>:
+{
+  80032b:	55                   	push   %ebp
+  80032c:	89 e5                	mov    %esp,%ebp
+  80032e:	57                   	push   %edi
+  80032f:	56                   	push   %esi
+  800330:	53                   	push   %ebx
+  800331:	83 ec 2c             	sub    $0x2c,%esp
+  800334:	8b 75 08             	mov    0x8(%ebp),%esi
+  800337:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80033a:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80033d:	eb 0a                	jmp    800349 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80033f:	83 ec 08             	sub    $0x8,%esp
+  800342:	53                   	push   %ebx
+  800343:	50                   	push   %eax
+  800344:	ff d6                	call   *%esi
+  800346:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800349:	83 c7 01             	add    $0x1,%edi
+  80034c:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800350:	83 f8 25             	cmp    $0x25,%eax
+  800353:	74 0c                	je     800361 <vprintfmt+0x36>
+			if (ch == '\0')
+  800355:	85 c0                	test   %eax,%eax
+  800357:	75 e6                	jne    80033f <vprintfmt+0x14>
+}
+  800359:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80035c:	5b                   	pop    %ebx
+  80035d:	5e                   	pop    %esi
+  80035e:	5f                   	pop    %edi
+  80035f:	5d                   	pop    %ebp
+  800360:	c3                   	ret
+		padc = ' ';
+  800361:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800365:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80036c:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800373:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80037a:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80037f:	8d 47 01             	lea    0x1(%edi),%eax
+  800382:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800385:	0f b6 17             	movzbl (%edi),%edx
+  800388:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80038b:	3c 55                	cmp    $0x55,%al
+  80038d:	0f 87 9a 03 00 00    	ja     80072d <vprintfmt+0x402>
+  800393:	0f b6 c0             	movzbl %al,%eax
+  800396:	ff 24 85 60 27 80 00 	jmp    *0x802760(,%eax,4)
+  80039d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8003a0:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8003a4:	eb d9                	jmp    80037f <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003a6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003a9:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8003ad:	eb d0                	jmp    80037f <vprintfmt+0x54>
+  8003af:	0f b6 d2             	movzbl %dl,%edx
+  8003b2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8003b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ba:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8003bd:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003c0:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8003c4:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8003c7:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8003ca:	83 f9 09             	cmp    $0x9,%ecx
+  8003cd:	77 55                	ja     800424 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8003cf:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8003d2:	eb e9                	jmp    8003bd <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8003d4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003d7:	8b 00                	mov    (%eax),%eax
+  8003d9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003dc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003df:	8d 40 04             	lea    0x4(%eax),%eax
+  8003e2:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003e5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8003e8:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003ec:	79 91                	jns    80037f <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8003ee:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003f1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003f4:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003fb:	eb 82                	jmp    80037f <vprintfmt+0x54>
+			if (width < 0)
+  8003fd:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800400:	85 d2                	test   %edx,%edx
+  800402:	b8 00 00 00 00       	mov    $0x0,%eax
+  800407:	0f 49 c2             	cmovns %edx,%eax
+  80040a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80040d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800410:	e9 6a ff ff ff       	jmp    80037f <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800415:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800418:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80041f:	e9 5b ff ff ff       	jmp    80037f <vprintfmt+0x54>
+  800424:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800427:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80042a:	eb bc                	jmp    8003e8 <vprintfmt+0xbd>
+			lflag++;
+  80042c:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80042f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800432:	e9 48 ff ff ff       	jmp    80037f <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800437:	8b 45 14             	mov    0x14(%ebp),%eax
+  80043a:	8d 78 04             	lea    0x4(%eax),%edi
+  80043d:	83 ec 08             	sub    $0x8,%esp
+  800440:	53                   	push   %ebx
+  800441:	ff 30                	push   (%eax)
+  800443:	ff d6                	call   *%esi
+			break;
+  800445:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800448:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80044b:	e9 7c 02 00 00       	jmp    8006cc <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  800450:	8b 45 14             	mov    0x14(%ebp),%eax
+  800453:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800456:	8b 10                	mov    (%eax),%edx
+  800458:	89 d0                	mov    %edx,%eax
+  80045a:	f7 d8                	neg    %eax
+  80045c:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80045f:	83 f8 10             	cmp    $0x10,%eax
+  800462:	7f 23                	jg     800487 <vprintfmt+0x15c>
+  800464:	8b 14 85 c0 28 80 00 	mov    0x8028c0(,%eax,4),%edx
+  80046b:	85 d2                	test   %edx,%edx
+  80046d:	74 18                	je     800487 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  80046f:	52                   	push   %edx
+  800470:	68 f9 29 80 00       	push   $0x8029f9
+  800475:	53                   	push   %ebx
+  800476:	56                   	push   %esi
+  800477:	e8 92 fe ff ff       	call   80030e <printfmt>
+  80047c:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80047f:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800482:	e9 45 02 00 00       	jmp    8006cc <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  800487:	50                   	push   %eax
+  800488:	68 2f 26 80 00       	push   $0x80262f
+  80048d:	53                   	push   %ebx
+  80048e:	56                   	push   %esi
+  80048f:	e8 7a fe ff ff       	call   80030e <printfmt>
+  800494:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800497:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80049a:	e9 2d 02 00 00       	jmp    8006cc <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80049f:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004a2:	83 c0 04             	add    $0x4,%eax
+  8004a5:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8004a8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004ab:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8004ad:	85 c9                	test   %ecx,%ecx
+  8004af:	b8 28 26 80 00       	mov    $0x802628,%eax
+  8004b4:	0f 45 c1             	cmovne %ecx,%eax
+  8004b7:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8004ba:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004be:	7e 06                	jle    8004c6 <vprintfmt+0x19b>
+  8004c0:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8004c4:	75 0b                	jne    8004d1 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004c6:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8004c9:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8004cc:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004cf:	eb 5c                	jmp    80052d <vprintfmt+0x202>
+  8004d1:	83 ec 08             	sub    $0x8,%esp
+  8004d4:	ff 75 d0             	push   -0x30(%ebp)
+  8004d7:	ff 75 cc             	push   -0x34(%ebp)
+  8004da:	e8 eb 02 00 00       	call   8007ca <strnlen>
+  8004df:	89 c2                	mov    %eax,%edx
+  8004e1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004e4:	29 d0                	sub    %edx,%eax
+  8004e6:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8004e9:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004ed:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004f0:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004f3:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004f5:	eb 0e                	jmp    800505 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8004f7:	83 ec 08             	sub    $0x8,%esp
+  8004fa:	53                   	push   %ebx
+  8004fb:	57                   	push   %edi
+  8004fc:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004ff:	83 ee 01             	sub    $0x1,%esi
+  800502:	83 c4 10             	add    $0x10,%esp
+  800505:	85 f6                	test   %esi,%esi
+  800507:	7f ee                	jg     8004f7 <vprintfmt+0x1cc>
+  800509:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80050c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80050f:	85 c0                	test   %eax,%eax
+  800511:	ba 00 00 00 00       	mov    $0x0,%edx
+  800516:	0f 49 d0             	cmovns %eax,%edx
+  800519:	29 d0                	sub    %edx,%eax
+  80051b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80051e:	eb a6                	jmp    8004c6 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800520:	83 ec 08             	sub    $0x8,%esp
+  800523:	53                   	push   %ebx
+  800524:	52                   	push   %edx
+  800525:	ff 55 08             	call   *0x8(%ebp)
+  800528:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80052b:	89 f1                	mov    %esi,%ecx
+  80052d:	8d 71 01             	lea    0x1(%ecx),%esi
+  800530:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800534:	0f be d0             	movsbl %al,%edx
+  800537:	85 d2                	test   %edx,%edx
+  800539:	74 28                	je     800563 <vprintfmt+0x238>
+  80053b:	85 ff                	test   %edi,%edi
+  80053d:	78 05                	js     800544 <vprintfmt+0x219>
+  80053f:	83 ef 01             	sub    $0x1,%edi
+  800542:	78 30                	js     800574 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800544:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800548:	74 d6                	je     800520 <vprintfmt+0x1f5>
+  80054a:	0f be c0             	movsbl %al,%eax
+  80054d:	83 e8 20             	sub    $0x20,%eax
+  800550:	83 f8 5e             	cmp    $0x5e,%eax
+  800553:	76 cb                	jbe    800520 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800555:	83 ec 08             	sub    $0x8,%esp
+  800558:	53                   	push   %ebx
+  800559:	6a 3f                	push   $0x3f
+  80055b:	ff 55 08             	call   *0x8(%ebp)
+  80055e:	83 c4 10             	add    $0x10,%esp
+  800561:	eb c8                	jmp    80052b <vprintfmt+0x200>
+  800563:	8b 75 08             	mov    0x8(%ebp),%esi
+  800566:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800569:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80056c:	01 d0                	add    %edx,%eax
+  80056e:	29 c8                	sub    %ecx,%eax
+  800570:	89 c7                	mov    %eax,%edi
+  800572:	eb 13                	jmp    800587 <vprintfmt+0x25c>
+  800574:	8b 75 08             	mov    0x8(%ebp),%esi
+  800577:	eb ed                	jmp    800566 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800579:	83 ec 08             	sub    $0x8,%esp
+  80057c:	53                   	push   %ebx
+  80057d:	6a 20                	push   $0x20
+  80057f:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800581:	83 ef 01             	sub    $0x1,%edi
+  800584:	83 c4 10             	add    $0x10,%esp
+  800587:	85 ff                	test   %edi,%edi
+  800589:	7f ee                	jg     800579 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80058b:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80058e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800591:	e9 36 01 00 00       	jmp    8006cc <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  800596:	83 f9 01             	cmp    $0x1,%ecx
+  800599:	7f 1f                	jg     8005ba <vprintfmt+0x28f>
+	else if (lflag)
+  80059b:	85 c9                	test   %ecx,%ecx
+  80059d:	74 67                	je     800606 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  80059f:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a2:	8b 00                	mov    (%eax),%eax
+  8005a4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005a7:	89 c1                	mov    %eax,%ecx
+  8005a9:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005ac:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005af:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b2:	8d 40 04             	lea    0x4(%eax),%eax
+  8005b5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005b8:	eb 17                	jmp    8005d1 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8005ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005bd:	8b 50 04             	mov    0x4(%eax),%edx
+  8005c0:	8b 00                	mov    (%eax),%eax
+  8005c2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005c5:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005c8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005cb:	8d 40 08             	lea    0x8(%eax),%eax
+  8005ce:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8005d1:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005d4:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8005d7:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8005dc:	85 c9                	test   %ecx,%ecx
+  8005de:	0f 89 ce 00 00 00    	jns    8006b2 <vprintfmt+0x387>
+				putch('-', putdat);
+  8005e4:	83 ec 08             	sub    $0x8,%esp
+  8005e7:	53                   	push   %ebx
+  8005e8:	6a 2d                	push   $0x2d
+  8005ea:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8005ec:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005ef:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005f2:	f7 da                	neg    %edx
+  8005f4:	83 d1 00             	adc    $0x0,%ecx
+  8005f7:	f7 d9                	neg    %ecx
+  8005f9:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8005fc:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800601:	e9 ac 00 00 00       	jmp    8006b2 <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  800606:	8b 45 14             	mov    0x14(%ebp),%eax
+  800609:	8b 00                	mov    (%eax),%eax
+  80060b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80060e:	89 c1                	mov    %eax,%ecx
+  800610:	c1 f9 1f             	sar    $0x1f,%ecx
+  800613:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800616:	8b 45 14             	mov    0x14(%ebp),%eax
+  800619:	8d 40 04             	lea    0x4(%eax),%eax
+  80061c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80061f:	eb b0                	jmp    8005d1 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800621:	83 f9 01             	cmp    $0x1,%ecx
+  800624:	7f 1b                	jg     800641 <vprintfmt+0x316>
+	else if (lflag)
+  800626:	85 c9                	test   %ecx,%ecx
+  800628:	74 2c                	je     800656 <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  80062a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062d:	8b 10                	mov    (%eax),%edx
+  80062f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800634:	8d 40 04             	lea    0x4(%eax),%eax
+  800637:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80063a:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80063f:	eb 71                	jmp    8006b2 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  800641:	8b 45 14             	mov    0x14(%ebp),%eax
+  800644:	8b 10                	mov    (%eax),%edx
+  800646:	8b 48 04             	mov    0x4(%eax),%ecx
+  800649:	8d 40 08             	lea    0x8(%eax),%eax
+  80064c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80064f:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800654:	eb 5c                	jmp    8006b2 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  800656:	8b 45 14             	mov    0x14(%ebp),%eax
+  800659:	8b 10                	mov    (%eax),%edx
+  80065b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800660:	8d 40 04             	lea    0x4(%eax),%eax
+  800663:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800666:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80066b:	eb 45                	jmp    8006b2 <vprintfmt+0x387>
+			putch('X', putdat);
+  80066d:	83 ec 08             	sub    $0x8,%esp
+  800670:	53                   	push   %ebx
+  800671:	6a 58                	push   $0x58
+  800673:	ff d6                	call   *%esi
+			putch('X', putdat);
+  800675:	83 c4 08             	add    $0x8,%esp
+  800678:	53                   	push   %ebx
+  800679:	6a 58                	push   $0x58
+  80067b:	ff d6                	call   *%esi
+			putch('X', putdat);
+  80067d:	83 c4 08             	add    $0x8,%esp
+  800680:	53                   	push   %ebx
+  800681:	6a 58                	push   $0x58
+  800683:	ff d6                	call   *%esi
+			break;
+  800685:	83 c4 10             	add    $0x10,%esp
+  800688:	eb 42                	jmp    8006cc <vprintfmt+0x3a1>
+			putch('0', putdat);
+  80068a:	83 ec 08             	sub    $0x8,%esp
+  80068d:	53                   	push   %ebx
+  80068e:	6a 30                	push   $0x30
+  800690:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800692:	83 c4 08             	add    $0x8,%esp
+  800695:	53                   	push   %ebx
+  800696:	6a 78                	push   $0x78
+  800698:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  80069a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069d:	8b 10                	mov    (%eax),%edx
+  80069f:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8006a4:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8006a7:	8d 40 04             	lea    0x4(%eax),%eax
+  8006aa:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006ad:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8006b2:	83 ec 0c             	sub    $0xc,%esp
+  8006b5:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8006b9:	50                   	push   %eax
+  8006ba:	ff 75 e0             	push   -0x20(%ebp)
+  8006bd:	57                   	push   %edi
+  8006be:	51                   	push   %ecx
+  8006bf:	52                   	push   %edx
+  8006c0:	89 da                	mov    %ebx,%edx
+  8006c2:	89 f0                	mov    %esi,%eax
+  8006c4:	e8 7f fb ff ff       	call   800248 <printnum>
+			break;
+  8006c9:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8006cc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8006cf:	e9 75 fc ff ff       	jmp    800349 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8006d4:	83 f9 01             	cmp    $0x1,%ecx
+  8006d7:	7f 1b                	jg     8006f4 <vprintfmt+0x3c9>
+	else if (lflag)
+  8006d9:	85 c9                	test   %ecx,%ecx
+  8006db:	74 2c                	je     800709 <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  8006dd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e0:	8b 10                	mov    (%eax),%edx
+  8006e2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006e7:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ea:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006ed:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8006f2:	eb be                	jmp    8006b2 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  8006f4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f7:	8b 10                	mov    (%eax),%edx
+  8006f9:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006fc:	8d 40 08             	lea    0x8(%eax),%eax
+  8006ff:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800702:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800707:	eb a9                	jmp    8006b2 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  800709:	8b 45 14             	mov    0x14(%ebp),%eax
+  80070c:	8b 10                	mov    (%eax),%edx
+  80070e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800713:	8d 40 04             	lea    0x4(%eax),%eax
+  800716:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800719:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80071e:	eb 92                	jmp    8006b2 <vprintfmt+0x387>
+			putch(ch, putdat);
+  800720:	83 ec 08             	sub    $0x8,%esp
+  800723:	53                   	push   %ebx
+  800724:	6a 25                	push   $0x25
+  800726:	ff d6                	call   *%esi
+			break;
+  800728:	83 c4 10             	add    $0x10,%esp
+  80072b:	eb 9f                	jmp    8006cc <vprintfmt+0x3a1>
+			putch('%', putdat);
+  80072d:	83 ec 08             	sub    $0x8,%esp
+  800730:	53                   	push   %ebx
+  800731:	6a 25                	push   $0x25
+  800733:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800735:	83 c4 10             	add    $0x10,%esp
+  800738:	89 f8                	mov    %edi,%eax
+  80073a:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80073e:	74 05                	je     800745 <vprintfmt+0x41a>
+  800740:	83 e8 01             	sub    $0x1,%eax
+  800743:	eb f5                	jmp    80073a <vprintfmt+0x40f>
+  800745:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800748:	eb 82                	jmp    8006cc <vprintfmt+0x3a1>
+
+0080074a <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80074a:	55                   	push   %ebp
+  80074b:	89 e5                	mov    %esp,%ebp
+  80074d:	83 ec 18             	sub    $0x18,%esp
+  800750:	8b 45 08             	mov    0x8(%ebp),%eax
+  800753:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800756:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800759:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80075d:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800760:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800767:	85 c0                	test   %eax,%eax
+  800769:	74 26                	je     800791 <vsnprintf+0x47>
+  80076b:	85 d2                	test   %edx,%edx
+  80076d:	7e 22                	jle    800791 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80076f:	ff 75 14             	push   0x14(%ebp)
+  800772:	ff 75 10             	push   0x10(%ebp)
+  800775:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800778:	50                   	push   %eax
+  800779:	68 f1 02 80 00       	push   $0x8002f1
+  80077e:	e8 a8 fb ff ff       	call   80032b <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800783:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800786:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800789:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80078c:	83 c4 10             	add    $0x10,%esp
+}
+  80078f:	c9                   	leave
+  800790:	c3                   	ret
+		return -E_INVAL;
+  800791:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800796:	eb f7                	jmp    80078f <vsnprintf+0x45>
+
+00800798 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800798:	55                   	push   %ebp
+  800799:	89 e5                	mov    %esp,%ebp
+  80079b:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80079e:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8007a1:	50                   	push   %eax
+  8007a2:	ff 75 10             	push   0x10(%ebp)
+  8007a5:	ff 75 0c             	push   0xc(%ebp)
+  8007a8:	ff 75 08             	push   0x8(%ebp)
+  8007ab:	e8 9a ff ff ff       	call   80074a <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8007b0:	c9                   	leave
+  8007b1:	c3                   	ret
+
+008007b2 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007b2:	55                   	push   %ebp
+  8007b3:	89 e5                	mov    %esp,%ebp
+  8007b5:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8007b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007bd:	eb 03                	jmp    8007c2 <strlen+0x10>
+		n++;
+  8007bf:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8007c2:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007c6:	75 f7                	jne    8007bf <strlen+0xd>
+	return n;
+}
+  8007c8:	5d                   	pop    %ebp
+  8007c9:	c3                   	ret
+
+008007ca <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8007ca:	55                   	push   %ebp
+  8007cb:	89 e5                	mov    %esp,%ebp
+  8007cd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007d0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007d8:	eb 03                	jmp    8007dd <strnlen+0x13>
+		n++;
+  8007da:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007dd:	39 d0                	cmp    %edx,%eax
+  8007df:	74 08                	je     8007e9 <strnlen+0x1f>
+  8007e1:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8007e5:	75 f3                	jne    8007da <strnlen+0x10>
+  8007e7:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8007e9:	89 d0                	mov    %edx,%eax
+  8007eb:	5d                   	pop    %ebp
+  8007ec:	c3                   	ret
+
+008007ed <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8007ed:	55                   	push   %ebp
+  8007ee:	89 e5                	mov    %esp,%ebp
+  8007f0:	53                   	push   %ebx
+  8007f1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007f4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800800:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800803:	83 c0 01             	add    $0x1,%eax
+  800806:	84 d2                	test   %dl,%dl
+  800808:	75 f2                	jne    8007fc <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80080a:	89 c8                	mov    %ecx,%eax
+  80080c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80080f:	c9                   	leave
+  800810:	c3                   	ret
+
+00800811 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800811:	55                   	push   %ebp
+  800812:	89 e5                	mov    %esp,%ebp
+  800814:	53                   	push   %ebx
+  800815:	83 ec 10             	sub    $0x10,%esp
+  800818:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80081b:	53                   	push   %ebx
+  80081c:	e8 91 ff ff ff       	call   8007b2 <strlen>
+  800821:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800824:	ff 75 0c             	push   0xc(%ebp)
+  800827:	01 d8                	add    %ebx,%eax
+  800829:	50                   	push   %eax
+  80082a:	e8 be ff ff ff       	call   8007ed <strcpy>
+	return dst;
+}
+  80082f:	89 d8                	mov    %ebx,%eax
+  800831:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800834:	c9                   	leave
+  800835:	c3                   	ret
+
+00800836 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800836:	55                   	push   %ebp
+  800837:	89 e5                	mov    %esp,%ebp
+  800839:	56                   	push   %esi
+  80083a:	53                   	push   %ebx
+  80083b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80083e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800841:	89 f3                	mov    %esi,%ebx
+  800843:	03 5d 10             	add    0x10(%ebp),%ebx
+  800846:	89 f0                	mov    %esi,%eax
+  800848:	eb 0f                	jmp    800859 <strncpy+0x23>
+		*dst++ = *src;
+  80084a:	83 c0 01             	add    $0x1,%eax
+  80084d:	0f b6 0a             	movzbl (%edx),%ecx
+  800850:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800853:	80 f9 01             	cmp    $0x1,%cl
+  800856:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800859:	39 d8                	cmp    %ebx,%eax
+  80085b:	75 ed                	jne    80084a <strncpy+0x14>
+	}
+	return ret;
+}
+  80085d:	89 f0                	mov    %esi,%eax
+  80085f:	5b                   	pop    %ebx
+  800860:	5e                   	pop    %esi
+  800861:	5d                   	pop    %ebp
+  800862:	c3                   	ret
+
+00800863 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800863:	55                   	push   %ebp
+  800864:	89 e5                	mov    %esp,%ebp
+  800866:	56                   	push   %esi
+  800867:	53                   	push   %ebx
+  800868:	8b 75 08             	mov    0x8(%ebp),%esi
+  80086b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80086e:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800871:	89 f0                	mov    %esi,%eax
+  800873:	85 d2                	test   %edx,%edx
+  800875:	74 21                	je     800898 <strlcpy+0x35>
+  800877:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80087b:	89 f2                	mov    %esi,%edx
+  80087d:	eb 09                	jmp    800888 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  80087f:	83 c1 01             	add    $0x1,%ecx
+  800882:	83 c2 01             	add    $0x1,%edx
+  800885:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800888:	39 c2                	cmp    %eax,%edx
+  80088a:	74 09                	je     800895 <strlcpy+0x32>
+  80088c:	0f b6 19             	movzbl (%ecx),%ebx
+  80088f:	84 db                	test   %bl,%bl
+  800891:	75 ec                	jne    80087f <strlcpy+0x1c>
+  800893:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800895:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800898:	29 f0                	sub    %esi,%eax
+}
+  80089a:	5b                   	pop    %ebx
+  80089b:	5e                   	pop    %esi
+  80089c:	5d                   	pop    %ebp
+  80089d:	c3                   	ret
+
+0080089e <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80089e:	55                   	push   %ebp
+  80089f:	89 e5                	mov    %esp,%ebp
+  8008a1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008a4:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8008a7:	eb 06                	jmp    8008af <strcmp+0x11>
+		p++, q++;
+  8008a9:	83 c1 01             	add    $0x1,%ecx
+  8008ac:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8008af:	0f b6 01             	movzbl (%ecx),%eax
+  8008b2:	84 c0                	test   %al,%al
+  8008b4:	74 04                	je     8008ba <strcmp+0x1c>
+  8008b6:	3a 02                	cmp    (%edx),%al
+  8008b8:	74 ef                	je     8008a9 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008ba:	0f b6 c0             	movzbl %al,%eax
+  8008bd:	0f b6 12             	movzbl (%edx),%edx
+  8008c0:	29 d0                	sub    %edx,%eax
+}
+  8008c2:	5d                   	pop    %ebp
+  8008c3:	c3                   	ret
+
+008008c4 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8008c4:	55                   	push   %ebp
+  8008c5:	89 e5                	mov    %esp,%ebp
+  8008c7:	53                   	push   %ebx
+  8008c8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008cb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008ce:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8008d1:	eb 09                	jmp    8008dc <strncmp+0x18>
+		n--, p++, q++;
+  8008d3:	83 ea 01             	sub    $0x1,%edx
+  8008d6:	83 c0 01             	add    $0x1,%eax
+  8008d9:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8008dc:	85 d2                	test   %edx,%edx
+  8008de:	74 18                	je     8008f8 <strncmp+0x34>
+  8008e0:	0f b6 18             	movzbl (%eax),%ebx
+  8008e3:	84 db                	test   %bl,%bl
+  8008e5:	74 04                	je     8008eb <strncmp+0x27>
+  8008e7:	3a 19                	cmp    (%ecx),%bl
+  8008e9:	74 e8                	je     8008d3 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008eb:	0f b6 00             	movzbl (%eax),%eax
+  8008ee:	0f b6 11             	movzbl (%ecx),%edx
+  8008f1:	29 d0                	sub    %edx,%eax
+}
+  8008f3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008f6:	c9                   	leave
+  8008f7:	c3                   	ret
+		return 0;
+  8008f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008fd:	eb f4                	jmp    8008f3 <strncmp+0x2f>
+
+008008ff <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8008ff:	55                   	push   %ebp
+  800900:	89 e5                	mov    %esp,%ebp
+  800902:	8b 45 08             	mov    0x8(%ebp),%eax
+  800905:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800909:	eb 03                	jmp    80090e <strchr+0xf>
+  80090b:	83 c0 01             	add    $0x1,%eax
+  80090e:	0f b6 10             	movzbl (%eax),%edx
+  800911:	84 d2                	test   %dl,%dl
+  800913:	74 06                	je     80091b <strchr+0x1c>
+		if (*s == c)
+  800915:	38 ca                	cmp    %cl,%dl
+  800917:	75 f2                	jne    80090b <strchr+0xc>
+  800919:	eb 05                	jmp    800920 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  80091b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800920:	5d                   	pop    %ebp
+  800921:	c3                   	ret
+
+00800922 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800922:	55                   	push   %ebp
+  800923:	89 e5                	mov    %esp,%ebp
+  800925:	8b 45 08             	mov    0x8(%ebp),%eax
+  800928:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80092c:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  80092f:	38 ca                	cmp    %cl,%dl
+  800931:	74 09                	je     80093c <strfind+0x1a>
+  800933:	84 d2                	test   %dl,%dl
+  800935:	74 05                	je     80093c <strfind+0x1a>
+	for (; *s; s++)
+  800937:	83 c0 01             	add    $0x1,%eax
+  80093a:	eb f0                	jmp    80092c <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  80093c:	5d                   	pop    %ebp
+  80093d:	c3                   	ret
+
+0080093e <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  80093e:	55                   	push   %ebp
+  80093f:	89 e5                	mov    %esp,%ebp
+  800941:	57                   	push   %edi
+  800942:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800945:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800948:	85 c9                	test   %ecx,%ecx
+  80094a:	74 20                	je     80096c <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  80094c:	89 f8                	mov    %edi,%eax
+  80094e:	09 c8                	or     %ecx,%eax
+  800950:	a8 03                	test   $0x3,%al
+  800952:	75 12                	jne    800966 <memset+0x28>
+		c &= 0xFF;
+  800954:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800958:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  80095e:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800961:	fc                   	cld
+  800962:	f3 ab                	rep stos %eax,%es:(%edi)
+  800964:	eb 06                	jmp    80096c <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800966:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800969:	fc                   	cld
+  80096a:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  80096c:	89 f8                	mov    %edi,%eax
+  80096e:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800971:	c9                   	leave
+  800972:	c3                   	ret
+
+00800973 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800973:	55                   	push   %ebp
+  800974:	89 e5                	mov    %esp,%ebp
+  800976:	57                   	push   %edi
+  800977:	56                   	push   %esi
+  800978:	8b 45 08             	mov    0x8(%ebp),%eax
+  80097b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80097e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800981:	39 c6                	cmp    %eax,%esi
+  800983:	73 32                	jae    8009b7 <memmove+0x44>
+  800985:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800988:	39 d0                	cmp    %edx,%eax
+  80098a:	73 2b                	jae    8009b7 <memmove+0x44>
+		s += n;
+		d += n;
+  80098c:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80098f:	89 d6                	mov    %edx,%esi
+  800991:	09 fe                	or     %edi,%esi
+  800993:	09 ce                	or     %ecx,%esi
+  800995:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  80099b:	75 0e                	jne    8009ab <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  80099d:	83 ef 04             	sub    $0x4,%edi
+  8009a0:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8009a3:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8009a6:	fd                   	std
+  8009a7:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009a9:	eb 09                	jmp    8009b4 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8009ab:	83 ef 01             	sub    $0x1,%edi
+  8009ae:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8009b1:	fd                   	std
+  8009b2:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8009b4:	fc                   	cld
+  8009b5:	eb 1a                	jmp    8009d1 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009b7:	89 f2                	mov    %esi,%edx
+  8009b9:	09 c2                	or     %eax,%edx
+  8009bb:	09 ca                	or     %ecx,%edx
+  8009bd:	f6 c2 03             	test   $0x3,%dl
+  8009c0:	75 0a                	jne    8009cc <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8009c2:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8009c5:	89 c7                	mov    %eax,%edi
+  8009c7:	fc                   	cld
+  8009c8:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009ca:	eb 05                	jmp    8009d1 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8009cc:	89 c7                	mov    %eax,%edi
+  8009ce:	fc                   	cld
+  8009cf:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8009d1:	5e                   	pop    %esi
+  8009d2:	5f                   	pop    %edi
+  8009d3:	5d                   	pop    %ebp
+  8009d4:	c3                   	ret
+
+008009d5 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8009d5:	55                   	push   %ebp
+  8009d6:	89 e5                	mov    %esp,%ebp
+  8009d8:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8009db:	ff 75 10             	push   0x10(%ebp)
+  8009de:	ff 75 0c             	push   0xc(%ebp)
+  8009e1:	ff 75 08             	push   0x8(%ebp)
+  8009e4:	e8 8a ff ff ff       	call   800973 <memmove>
+}
+  8009e9:	c9                   	leave
+  8009ea:	c3                   	ret
+
+008009eb <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8009eb:	55                   	push   %ebp
+  8009ec:	89 e5                	mov    %esp,%ebp
+  8009ee:	56                   	push   %esi
+  8009ef:	53                   	push   %ebx
+  8009f0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009f3:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8009f6:	89 c6                	mov    %eax,%esi
+  8009f8:	03 75 10             	add    0x10(%ebp),%esi
+  8009fb:	eb 06                	jmp    800a03 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8009fd:	83 c0 01             	add    $0x1,%eax
+  800a00:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a03:	39 f0                	cmp    %esi,%eax
+  800a05:	74 14                	je     800a1b <memcmp+0x30>
+		if (*s1 != *s2)
+  800a07:	0f b6 08             	movzbl (%eax),%ecx
+  800a0a:	0f b6 1a             	movzbl (%edx),%ebx
+  800a0d:	38 d9                	cmp    %bl,%cl
+  800a0f:	74 ec                	je     8009fd <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a11:	0f b6 c1             	movzbl %cl,%eax
+  800a14:	0f b6 db             	movzbl %bl,%ebx
+  800a17:	29 d8                	sub    %ebx,%eax
+  800a19:	eb 05                	jmp    800a20 <memcmp+0x35>
+	}
+
+	return 0;
+  800a1b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a20:	5b                   	pop    %ebx
+  800a21:	5e                   	pop    %esi
+  800a22:	5d                   	pop    %ebp
+  800a23:	c3                   	ret
+
+00800a24 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a24:	55                   	push   %ebp
+  800a25:	89 e5                	mov    %esp,%ebp
+  800a27:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a2a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a2d:	89 c2                	mov    %eax,%edx
+  800a2f:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a32:	eb 03                	jmp    800a37 <memfind+0x13>
+  800a34:	83 c0 01             	add    $0x1,%eax
+  800a37:	39 d0                	cmp    %edx,%eax
+  800a39:	73 04                	jae    800a3f <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a3b:	38 08                	cmp    %cl,(%eax)
+  800a3d:	75 f5                	jne    800a34 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a3f:	5d                   	pop    %ebp
+  800a40:	c3                   	ret
+
+00800a41 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a41:	55                   	push   %ebp
+  800a42:	89 e5                	mov    %esp,%ebp
+  800a44:	57                   	push   %edi
+  800a45:	56                   	push   %esi
+  800a46:	53                   	push   %ebx
+  800a47:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a4a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a4d:	eb 03                	jmp    800a52 <strtol+0x11>
+		s++;
+  800a4f:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a52:	0f b6 02             	movzbl (%edx),%eax
+  800a55:	3c 20                	cmp    $0x20,%al
+  800a57:	74 f6                	je     800a4f <strtol+0xe>
+  800a59:	3c 09                	cmp    $0x9,%al
+  800a5b:	74 f2                	je     800a4f <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a5d:	3c 2b                	cmp    $0x2b,%al
+  800a5f:	74 2a                	je     800a8b <strtol+0x4a>
+	int neg = 0;
+  800a61:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a66:	3c 2d                	cmp    $0x2d,%al
+  800a68:	74 2b                	je     800a95 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a6a:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a70:	75 0f                	jne    800a81 <strtol+0x40>
+  800a72:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a75:	74 28                	je     800a9f <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a77:	85 db                	test   %ebx,%ebx
+  800a79:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a7e:	0f 44 d8             	cmove  %eax,%ebx
+  800a81:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a86:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a89:	eb 46                	jmp    800ad1 <strtol+0x90>
+		s++;
+  800a8b:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a8e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a93:	eb d5                	jmp    800a6a <strtol+0x29>
+		s++, neg = 1;
+  800a95:	83 c2 01             	add    $0x1,%edx
+  800a98:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a9d:	eb cb                	jmp    800a6a <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a9f:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800aa3:	74 0e                	je     800ab3 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800aa5:	85 db                	test   %ebx,%ebx
+  800aa7:	75 d8                	jne    800a81 <strtol+0x40>
+		s++, base = 8;
+  800aa9:	83 c2 01             	add    $0x1,%edx
+  800aac:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800ab1:	eb ce                	jmp    800a81 <strtol+0x40>
+		s += 2, base = 16;
+  800ab3:	83 c2 02             	add    $0x2,%edx
+  800ab6:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800abb:	eb c4                	jmp    800a81 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800abd:	0f be c0             	movsbl %al,%eax
+  800ac0:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800ac3:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800ac6:	7d 3a                	jge    800b02 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800ac8:	83 c2 01             	add    $0x1,%edx
+  800acb:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800acf:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800ad1:	0f b6 02             	movzbl (%edx),%eax
+  800ad4:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800ad7:	89 f3                	mov    %esi,%ebx
+  800ad9:	80 fb 09             	cmp    $0x9,%bl
+  800adc:	76 df                	jbe    800abd <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800ade:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800ae1:	89 f3                	mov    %esi,%ebx
+  800ae3:	80 fb 19             	cmp    $0x19,%bl
+  800ae6:	77 08                	ja     800af0 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800ae8:	0f be c0             	movsbl %al,%eax
+  800aeb:	83 e8 57             	sub    $0x57,%eax
+  800aee:	eb d3                	jmp    800ac3 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800af0:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800af3:	89 f3                	mov    %esi,%ebx
+  800af5:	80 fb 19             	cmp    $0x19,%bl
+  800af8:	77 08                	ja     800b02 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800afa:	0f be c0             	movsbl %al,%eax
+  800afd:	83 e8 37             	sub    $0x37,%eax
+  800b00:	eb c1                	jmp    800ac3 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b02:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b06:	74 05                	je     800b0d <strtol+0xcc>
+		*endptr = (char *) s;
+  800b08:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b0b:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800b0d:	89 c8                	mov    %ecx,%eax
+  800b0f:	f7 d8                	neg    %eax
+  800b11:	85 ff                	test   %edi,%edi
+  800b13:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b16:	89 c8                	mov    %ecx,%eax
+  800b18:	5b                   	pop    %ebx
+  800b19:	5e                   	pop    %esi
+  800b1a:	5f                   	pop    %edi
+  800b1b:	5d                   	pop    %ebp
+  800b1c:	c3                   	ret
+
+00800b1d <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800b1d:	55                   	push   %ebp
+  800b1e:	89 e5                	mov    %esp,%ebp
+  800b20:	57                   	push   %edi
+  800b21:	56                   	push   %esi
+  800b22:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800b23:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b28:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b2b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b2e:	89 c3                	mov    %eax,%ebx
+  800b30:	89 c7                	mov    %eax,%edi
+  800b32:	89 c6                	mov    %eax,%esi
+  800b34:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  800b36:	5b                   	pop    %ebx
+  800b37:	5e                   	pop    %esi
+  800b38:	5f                   	pop    %edi
+  800b39:	5d                   	pop    %ebp
+  800b3a:	c3                   	ret
+
+00800b3b <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800b3b:	55                   	push   %ebp
+  800b3c:	89 e5                	mov    %esp,%ebp
+  800b3e:	57                   	push   %edi
+  800b3f:	56                   	push   %esi
+  800b40:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800b41:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b46:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b4b:	89 d1                	mov    %edx,%ecx
+  800b4d:	89 d3                	mov    %edx,%ebx
+  800b4f:	89 d7                	mov    %edx,%edi
+  800b51:	89 d6                	mov    %edx,%esi
+  800b53:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800b55:	5b                   	pop    %ebx
+  800b56:	5e                   	pop    %esi
+  800b57:	5f                   	pop    %edi
+  800b58:	5d                   	pop    %ebp
+  800b59:	c3                   	ret
+
+00800b5a <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800b5a:	55                   	push   %ebp
+  800b5b:	89 e5                	mov    %esp,%ebp
+  800b5d:	57                   	push   %edi
+  800b5e:	56                   	push   %esi
+  800b5f:	53                   	push   %ebx
+  800b60:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800b63:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b68:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b6b:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b70:	89 cb                	mov    %ecx,%ebx
+  800b72:	89 cf                	mov    %ecx,%edi
+  800b74:	89 ce                	mov    %ecx,%esi
+  800b76:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800b78:	85 c0                	test   %eax,%eax
+  800b7a:	7f 08                	jg     800b84 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800b7c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b7f:	5b                   	pop    %ebx
+  800b80:	5e                   	pop    %esi
+  800b81:	5f                   	pop    %edi
+  800b82:	5d                   	pop    %ebp
+  800b83:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800b84:	83 ec 0c             	sub    $0xc,%esp
+  800b87:	50                   	push   %eax
+  800b88:	6a 03                	push   $0x3
+  800b8a:	68 23 29 80 00       	push   $0x802923
+  800b8f:	6a 3e                	push   $0x3e
+  800b91:	68 40 29 80 00       	push   $0x802940
+  800b96:	e8 be f5 ff ff       	call   800159 <_panic>
+
+00800b9b <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800b9b:	55                   	push   %ebp
+  800b9c:	89 e5                	mov    %esp,%ebp
+  800b9e:	57                   	push   %edi
+  800b9f:	56                   	push   %esi
+  800ba0:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800ba1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ba6:	b8 02 00 00 00       	mov    $0x2,%eax
+  800bab:	89 d1                	mov    %edx,%ecx
+  800bad:	89 d3                	mov    %edx,%ebx
+  800baf:	89 d7                	mov    %edx,%edi
+  800bb1:	89 d6                	mov    %edx,%esi
+  800bb3:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800bb5:	5b                   	pop    %ebx
+  800bb6:	5e                   	pop    %esi
+  800bb7:	5f                   	pop    %edi
+  800bb8:	5d                   	pop    %ebp
+  800bb9:	c3                   	ret
+
+00800bba <sys_yield>:
+
+void
+sys_yield(void) {
+  800bba:	55                   	push   %ebp
+  800bbb:	89 e5                	mov    %esp,%ebp
+  800bbd:	57                   	push   %edi
+  800bbe:	56                   	push   %esi
+  800bbf:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800bc0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bc5:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800bca:	89 d1                	mov    %edx,%ecx
+  800bcc:	89 d3                	mov    %edx,%ebx
+  800bce:	89 d7                	mov    %edx,%edi
+  800bd0:	89 d6                	mov    %edx,%esi
+  800bd2:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800bd4:	5b                   	pop    %ebx
+  800bd5:	5e                   	pop    %esi
+  800bd6:	5f                   	pop    %edi
+  800bd7:	5d                   	pop    %ebp
+  800bd8:	c3                   	ret
+
+00800bd9 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  800bd9:	55                   	push   %ebp
+  800bda:	89 e5                	mov    %esp,%ebp
+  800bdc:	57                   	push   %edi
+  800bdd:	56                   	push   %esi
+  800bde:	53                   	push   %ebx
+  800bdf:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800be2:	be 00 00 00 00       	mov    $0x0,%esi
+  800be7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bed:	b8 04 00 00 00       	mov    $0x4,%eax
+  800bf2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bf5:	89 f7                	mov    %esi,%edi
+  800bf7:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800bf9:	85 c0                	test   %eax,%eax
+  800bfb:	7f 08                	jg     800c05 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800bfd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c00:	5b                   	pop    %ebx
+  800c01:	5e                   	pop    %esi
+  800c02:	5f                   	pop    %edi
+  800c03:	5d                   	pop    %ebp
+  800c04:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c05:	83 ec 0c             	sub    $0xc,%esp
+  800c08:	50                   	push   %eax
+  800c09:	6a 04                	push   $0x4
+  800c0b:	68 23 29 80 00       	push   $0x802923
+  800c10:	6a 3e                	push   $0x3e
+  800c12:	68 40 29 80 00       	push   $0x802940
+  800c17:	e8 3d f5 ff ff       	call   800159 <_panic>
+
+00800c1c <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  800c1c:	55                   	push   %ebp
+  800c1d:	89 e5                	mov    %esp,%ebp
+  800c1f:	57                   	push   %edi
+  800c20:	56                   	push   %esi
+  800c21:	53                   	push   %ebx
+  800c22:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c25:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c28:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c2b:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c30:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c33:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c36:	8b 75 18             	mov    0x18(%ebp),%esi
+  800c39:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c3b:	85 c0                	test   %eax,%eax
+  800c3d:	7f 08                	jg     800c47 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800c3f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c42:	5b                   	pop    %ebx
+  800c43:	5e                   	pop    %esi
+  800c44:	5f                   	pop    %edi
+  800c45:	5d                   	pop    %ebp
+  800c46:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c47:	83 ec 0c             	sub    $0xc,%esp
+  800c4a:	50                   	push   %eax
+  800c4b:	6a 05                	push   $0x5
+  800c4d:	68 23 29 80 00       	push   $0x802923
+  800c52:	6a 3e                	push   $0x3e
+  800c54:	68 40 29 80 00       	push   $0x802940
+  800c59:	e8 fb f4 ff ff       	call   800159 <_panic>
+
+00800c5e <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  800c5e:	55                   	push   %ebp
+  800c5f:	89 e5                	mov    %esp,%ebp
+  800c61:	57                   	push   %edi
+  800c62:	56                   	push   %esi
+  800c63:	53                   	push   %ebx
+  800c64:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c67:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c6f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c72:	b8 06 00 00 00       	mov    $0x6,%eax
+  800c77:	89 df                	mov    %ebx,%edi
+  800c79:	89 de                	mov    %ebx,%esi
+  800c7b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c7d:	85 c0                	test   %eax,%eax
+  800c7f:	7f 08                	jg     800c89 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800c81:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c84:	5b                   	pop    %ebx
+  800c85:	5e                   	pop    %esi
+  800c86:	5f                   	pop    %edi
+  800c87:	5d                   	pop    %ebp
+  800c88:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c89:	83 ec 0c             	sub    $0xc,%esp
+  800c8c:	50                   	push   %eax
+  800c8d:	6a 06                	push   $0x6
+  800c8f:	68 23 29 80 00       	push   $0x802923
+  800c94:	6a 3e                	push   $0x3e
+  800c96:	68 40 29 80 00       	push   $0x802940
+  800c9b:	e8 b9 f4 ff ff       	call   800159 <_panic>
+
+00800ca0 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800ca0:	55                   	push   %ebp
+  800ca1:	89 e5                	mov    %esp,%ebp
+  800ca3:	57                   	push   %edi
+  800ca4:	56                   	push   %esi
+  800ca5:	53                   	push   %ebx
+  800ca6:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800ca9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cae:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cb1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cb4:	b8 08 00 00 00       	mov    $0x8,%eax
+  800cb9:	89 df                	mov    %ebx,%edi
+  800cbb:	89 de                	mov    %ebx,%esi
+  800cbd:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800cbf:	85 c0                	test   %eax,%eax
+  800cc1:	7f 08                	jg     800ccb <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800cc3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cc6:	5b                   	pop    %ebx
+  800cc7:	5e                   	pop    %esi
+  800cc8:	5f                   	pop    %edi
+  800cc9:	5d                   	pop    %ebp
+  800cca:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ccb:	83 ec 0c             	sub    $0xc,%esp
+  800cce:	50                   	push   %eax
+  800ccf:	6a 08                	push   $0x8
+  800cd1:	68 23 29 80 00       	push   $0x802923
+  800cd6:	6a 3e                	push   $0x3e
+  800cd8:	68 40 29 80 00       	push   $0x802940
+  800cdd:	e8 77 f4 ff ff       	call   800159 <_panic>
+
+00800ce2 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800ce2:	55                   	push   %ebp
+  800ce3:	89 e5                	mov    %esp,%ebp
+  800ce5:	57                   	push   %edi
+  800ce6:	56                   	push   %esi
+  800ce7:	53                   	push   %ebx
+  800ce8:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800ceb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cf0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cf3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cf6:	b8 09 00 00 00       	mov    $0x9,%eax
+  800cfb:	89 df                	mov    %ebx,%edi
+  800cfd:	89 de                	mov    %ebx,%esi
+  800cff:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d01:	85 c0                	test   %eax,%eax
+  800d03:	7f 08                	jg     800d0d <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800d05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d08:	5b                   	pop    %ebx
+  800d09:	5e                   	pop    %esi
+  800d0a:	5f                   	pop    %edi
+  800d0b:	5d                   	pop    %ebp
+  800d0c:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d0d:	83 ec 0c             	sub    $0xc,%esp
+  800d10:	50                   	push   %eax
+  800d11:	6a 09                	push   $0x9
+  800d13:	68 23 29 80 00       	push   $0x802923
+  800d18:	6a 3e                	push   $0x3e
+  800d1a:	68 40 29 80 00       	push   $0x802940
+  800d1f:	e8 35 f4 ff ff       	call   800159 <_panic>
+
+00800d24 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800d24:	55                   	push   %ebp
+  800d25:	89 e5                	mov    %esp,%ebp
+  800d27:	57                   	push   %edi
+  800d28:	56                   	push   %esi
+  800d29:	53                   	push   %ebx
+  800d2a:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800d2d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d32:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d35:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d38:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d3d:	89 df                	mov    %ebx,%edi
+  800d3f:	89 de                	mov    %ebx,%esi
+  800d41:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d43:	85 c0                	test   %eax,%eax
+  800d45:	7f 08                	jg     800d4f <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800d47:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d4a:	5b                   	pop    %ebx
+  800d4b:	5e                   	pop    %esi
+  800d4c:	5f                   	pop    %edi
+  800d4d:	5d                   	pop    %ebp
+  800d4e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d4f:	83 ec 0c             	sub    $0xc,%esp
+  800d52:	50                   	push   %eax
+  800d53:	6a 0a                	push   $0xa
+  800d55:	68 23 29 80 00       	push   $0x802923
+  800d5a:	6a 3e                	push   $0x3e
+  800d5c:	68 40 29 80 00       	push   $0x802940
+  800d61:	e8 f3 f3 ff ff       	call   800159 <_panic>
+
+00800d66 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  800d66:	55                   	push   %ebp
+  800d67:	89 e5                	mov    %esp,%ebp
+  800d69:	57                   	push   %edi
+  800d6a:	56                   	push   %esi
+  800d6b:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d6f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d72:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800d77:	be 00 00 00 00       	mov    $0x0,%esi
+  800d7c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d7f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d82:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800d84:	5b                   	pop    %ebx
+  800d85:	5e                   	pop    %esi
+  800d86:	5f                   	pop    %edi
+  800d87:	5d                   	pop    %ebp
+  800d88:	c3                   	ret
+
+00800d89 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  800d89:	55                   	push   %ebp
+  800d8a:	89 e5                	mov    %esp,%ebp
+  800d8c:	57                   	push   %edi
+  800d8d:	56                   	push   %esi
+  800d8e:	53                   	push   %ebx
+  800d8f:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800d92:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d97:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d9a:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800d9f:	89 cb                	mov    %ecx,%ebx
+  800da1:	89 cf                	mov    %ecx,%edi
+  800da3:	89 ce                	mov    %ecx,%esi
+  800da5:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800da7:	85 c0                	test   %eax,%eax
+  800da9:	7f 08                	jg     800db3 <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  800dab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dae:	5b                   	pop    %ebx
+  800daf:	5e                   	pop    %esi
+  800db0:	5f                   	pop    %edi
+  800db1:	5d                   	pop    %ebp
+  800db2:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800db3:	83 ec 0c             	sub    $0xc,%esp
+  800db6:	50                   	push   %eax
+  800db7:	6a 0d                	push   $0xd
+  800db9:	68 23 29 80 00       	push   $0x802923
+  800dbe:	6a 3e                	push   $0x3e
+  800dc0:	68 40 29 80 00       	push   $0x802940
+  800dc5:	e8 8f f3 ff ff       	call   800159 <_panic>
+
+00800dca <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  800dca:	55                   	push   %ebp
+  800dcb:	89 e5                	mov    %esp,%ebp
+  800dcd:	57                   	push   %edi
+  800dce:	56                   	push   %esi
+  800dcf:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800dd0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dd5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ddb:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800de0:	89 df                	mov    %ebx,%edi
+  800de2:	89 de                	mov    %ebx,%esi
+  800de4:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  800de6:	5b                   	pop    %ebx
+  800de7:	5e                   	pop    %esi
+  800de8:	5f                   	pop    %edi
+  800de9:	5d                   	pop    %ebp
+  800dea:	c3                   	ret
+
+00800deb <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  800deb:	55                   	push   %ebp
+  800dec:	89 e5                	mov    %esp,%ebp
+  800dee:	57                   	push   %edi
+  800def:	56                   	push   %esi
+  800df0:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800df1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800df6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df9:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800dfe:	89 cb                	mov    %ecx,%ebx
+  800e00:	89 cf                	mov    %ecx,%edi
+  800e02:	89 ce                	mov    %ecx,%esi
+  800e04:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  800e06:	5b                   	pop    %ebx
+  800e07:	5e                   	pop    %esi
+  800e08:	5f                   	pop    %edi
+  800e09:	5d                   	pop    %ebp
+  800e0a:	c3                   	ret
+
+00800e0b <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  800e0b:	55                   	push   %ebp
+  800e0c:	89 e5                	mov    %esp,%ebp
+  800e0e:	57                   	push   %edi
+  800e0f:	56                   	push   %esi
+  800e10:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e11:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e16:	b8 10 00 00 00       	mov    $0x10,%eax
+  800e1b:	89 d1                	mov    %edx,%ecx
+  800e1d:	89 d3                	mov    %edx,%ebx
+  800e1f:	89 d7                	mov    %edx,%edi
+  800e21:	89 d6                	mov    %edx,%esi
+  800e23:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800e25:	5b                   	pop    %ebx
+  800e26:	5e                   	pop    %esi
+  800e27:	5f                   	pop    %edi
+  800e28:	5d                   	pop    %ebp
+  800e29:	c3                   	ret
+
+00800e2a <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  800e2a:	55                   	push   %ebp
+  800e2b:	89 e5                	mov    %esp,%ebp
+  800e2d:	57                   	push   %edi
+  800e2e:	56                   	push   %esi
+  800e2f:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e30:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e35:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e38:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e3b:	b8 11 00 00 00       	mov    $0x11,%eax
+  800e40:	89 df                	mov    %ebx,%edi
+  800e42:	89 de                	mov    %ebx,%esi
+  800e44:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800e46:	5b                   	pop    %ebx
+  800e47:	5e                   	pop    %esi
+  800e48:	5f                   	pop    %edi
+  800e49:	5d                   	pop    %ebp
+  800e4a:	c3                   	ret
+
+00800e4b <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  800e4b:	55                   	push   %ebp
+  800e4c:	89 e5                	mov    %esp,%ebp
+  800e4e:	57                   	push   %edi
+  800e4f:	56                   	push   %esi
+  800e50:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e51:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e56:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e59:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e5c:	b8 12 00 00 00       	mov    $0x12,%eax
+  800e61:	89 df                	mov    %ebx,%edi
+  800e63:	89 de                	mov    %ebx,%esi
+  800e65:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800e67:	5b                   	pop    %ebx
+  800e68:	5e                   	pop    %esi
+  800e69:	5f                   	pop    %edi
+  800e6a:	5d                   	pop    %ebp
+  800e6b:	c3                   	ret
+
+00800e6c <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  800e6c:	55                   	push   %ebp
+  800e6d:	89 e5                	mov    %esp,%ebp
+  800e6f:	57                   	push   %edi
+  800e70:	56                   	push   %esi
+  800e71:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e72:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e77:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e7a:	b8 13 00 00 00       	mov    $0x13,%eax
+  800e7f:	89 cb                	mov    %ecx,%ebx
+  800e81:	89 cf                	mov    %ecx,%edi
+  800e83:	89 ce                	mov    %ecx,%esi
+  800e85:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  800e87:	5b                   	pop    %ebx
+  800e88:	5e                   	pop    %esi
+  800e89:	5f                   	pop    %edi
+  800e8a:	5d                   	pop    %ebp
+  800e8b:	c3                   	ret
+
+00800e8c <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  800e8c:	55                   	push   %ebp
+  800e8d:	89 e5                	mov    %esp,%ebp
+  800e8f:	57                   	push   %edi
+  800e90:	56                   	push   %esi
+  800e91:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800e92:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e97:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e9a:	b8 14 00 00 00       	mov    $0x14,%eax
+  800e9f:	89 cb                	mov    %ecx,%ebx
+  800ea1:	89 cf                	mov    %ecx,%edi
+  800ea3:	89 ce                	mov    %ecx,%esi
+  800ea5:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  800ea7:	5b                   	pop    %ebx
+  800ea8:	5e                   	pop    %esi
+  800ea9:	5f                   	pop    %edi
+  800eaa:	5d                   	pop    %ebp
+  800eab:	c3                   	ret
+
+00800eac <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800eac:	55                   	push   %ebp
+  800ead:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800eaf:	8b 45 08             	mov    0x8(%ebp),%eax
+  800eb2:	05 00 00 00 30       	add    $0x30000000,%eax
+  800eb7:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800eba:	5d                   	pop    %ebp
+  800ebb:	c3                   	ret
+
+00800ebc <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800ebc:	55                   	push   %ebp
+  800ebd:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800ebf:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ec2:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800ec7:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800ecc:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800ed1:	5d                   	pop    %ebp
+  800ed2:	c3                   	ret
+
+00800ed3 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800ed3:	55                   	push   %ebp
+  800ed4:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  800ed6:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800edb:	eb 02                	jmp    800edf <fd_alloc+0xc>
+  800edd:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800edf:	89 c2                	mov    %eax,%edx
+  800ee1:	c1 ea 16             	shr    $0x16,%edx
+  800ee4:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800eeb:	f6 c2 01             	test   $0x1,%dl
+  800eee:	74 2b                	je     800f1b <fd_alloc+0x48>
+  800ef0:	89 c2                	mov    %eax,%edx
+  800ef2:	c1 ea 0c             	shr    $0xc,%edx
+  800ef5:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  800efc:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  800f02:	f6 c1 01             	test   $0x1,%cl
+  800f05:	74 14                	je     800f1b <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  800f07:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  800f0d:	75 ce                	jne    800edd <fd_alloc+0xa>
+  800f0f:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  800f14:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800f19:	eb 05                	jmp    800f20 <fd_alloc+0x4d>
+			return 0;
+  800f1b:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  800f20:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f23:	89 02                	mov    %eax,(%edx)
+}
+  800f25:	89 c8                	mov    %ecx,%eax
+  800f27:	5d                   	pop    %ebp
+  800f28:	c3                   	ret
+
+00800f29 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  800f29:	55                   	push   %ebp
+  800f2a:	89 e5                	mov    %esp,%ebp
+  800f2c:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  800f2f:	83 f8 1f             	cmp    $0x1f,%eax
+  800f32:	77 30                	ja     800f64 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  800f34:	c1 e0 0c             	shl    $0xc,%eax
+  800f37:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800f3c:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  800f42:	f6 c2 01             	test   $0x1,%dl
+  800f45:	74 24                	je     800f6b <fd_lookup+0x42>
+  800f47:	89 c2                	mov    %eax,%edx
+  800f49:	c1 ea 0c             	shr    $0xc,%edx
+  800f4c:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800f53:	f6 c2 01             	test   $0x1,%dl
+  800f56:	74 1a                	je     800f72 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  800f58:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800f5b:	89 02                	mov    %eax,(%edx)
+	return 0;
+  800f5d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f62:	5d                   	pop    %ebp
+  800f63:	c3                   	ret
+		return -E_INVAL;
+  800f64:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f69:	eb f7                	jmp    800f62 <fd_lookup+0x39>
+		return -E_INVAL;
+  800f6b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f70:	eb f0                	jmp    800f62 <fd_lookup+0x39>
+  800f72:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f77:	eb e9                	jmp    800f62 <fd_lookup+0x39>
+
+00800f79 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  800f79:	55                   	push   %ebp
+  800f7a:	89 e5                	mov    %esp,%ebp
+  800f7c:	53                   	push   %ebx
+  800f7d:	83 ec 04             	sub    $0x4,%esp
+  800f80:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  800f83:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f88:	eb 03                	jmp    800f8d <dev_lookup+0x14>
+  800f8a:	83 c0 01             	add    $0x1,%eax
+  800f8d:	8b 1c 85 cc 29 80 00 	mov    0x8029cc(,%eax,4),%ebx
+  800f94:	85 db                	test   %ebx,%ebx
+  800f96:	74 0b                	je     800fa3 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  800f98:	39 13                	cmp    %edx,(%ebx)
+  800f9a:	75 ee                	jne    800f8a <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  800f9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fa1:	eb 1f                	jmp    800fc2 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800fa3:	a1 08 40 80 00       	mov    0x804008,%eax
+  800fa8:	8b 40 48             	mov    0x48(%eax),%eax
+  800fab:	83 ec 04             	sub    $0x4,%esp
+  800fae:	52                   	push   %edx
+  800faf:	50                   	push   %eax
+  800fb0:	68 50 29 80 00       	push   $0x802950
+  800fb5:	e8 7a f2 ff ff       	call   800234 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  800fba:	83 c4 10             	add    $0x10,%esp
+  800fbd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  800fc2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800fc5:	89 1a                	mov    %ebx,(%edx)
+}
+  800fc7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800fca:	c9                   	leave
+  800fcb:	c3                   	ret
+
+00800fcc <fd_close>:
+{
+  800fcc:	55                   	push   %ebp
+  800fcd:	89 e5                	mov    %esp,%ebp
+  800fcf:	57                   	push   %edi
+  800fd0:	56                   	push   %esi
+  800fd1:	53                   	push   %ebx
+  800fd2:	83 ec 24             	sub    $0x24,%esp
+  800fd5:	8b 75 08             	mov    0x8(%ebp),%esi
+  800fd8:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800fdb:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800fde:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800fdf:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800fe5:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800fe8:	50                   	push   %eax
+  800fe9:	e8 3b ff ff ff       	call   800f29 <fd_lookup>
+  800fee:	89 c3                	mov    %eax,%ebx
+  800ff0:	83 c4 10             	add    $0x10,%esp
+  800ff3:	85 c0                	test   %eax,%eax
+  800ff5:	78 05                	js     800ffc <fd_close+0x30>
+	    || fd != fd2)
+  800ff7:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  800ffa:	74 16                	je     801012 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  800ffc:	89 f8                	mov    %edi,%eax
+  800ffe:	84 c0                	test   %al,%al
+  801000:	b8 00 00 00 00       	mov    $0x0,%eax
+  801005:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801008:	89 d8                	mov    %ebx,%eax
+  80100a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80100d:	5b                   	pop    %ebx
+  80100e:	5e                   	pop    %esi
+  80100f:	5f                   	pop    %edi
+  801010:	5d                   	pop    %ebp
+  801011:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801012:	83 ec 08             	sub    $0x8,%esp
+  801015:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801018:	50                   	push   %eax
+  801019:	ff 36                	push   (%esi)
+  80101b:	e8 59 ff ff ff       	call   800f79 <dev_lookup>
+  801020:	89 c3                	mov    %eax,%ebx
+  801022:	83 c4 10             	add    $0x10,%esp
+  801025:	85 c0                	test   %eax,%eax
+  801027:	78 1a                	js     801043 <fd_close+0x77>
+		if (dev->dev_close)
+  801029:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80102c:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80102f:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801034:	85 c0                	test   %eax,%eax
+  801036:	74 0b                	je     801043 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801038:	83 ec 0c             	sub    $0xc,%esp
+  80103b:	56                   	push   %esi
+  80103c:	ff d0                	call   *%eax
+  80103e:	89 c3                	mov    %eax,%ebx
+  801040:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801043:	83 ec 08             	sub    $0x8,%esp
+  801046:	56                   	push   %esi
+  801047:	6a 00                	push   $0x0
+  801049:	e8 10 fc ff ff       	call   800c5e <sys_page_unmap>
+	return r;
+  80104e:	83 c4 10             	add    $0x10,%esp
+  801051:	eb b5                	jmp    801008 <fd_close+0x3c>
+
+00801053 <close>:
+
+int
+close(int fdnum)
+{
+  801053:	55                   	push   %ebp
+  801054:	89 e5                	mov    %esp,%ebp
+  801056:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801059:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80105c:	50                   	push   %eax
+  80105d:	ff 75 08             	push   0x8(%ebp)
+  801060:	e8 c4 fe ff ff       	call   800f29 <fd_lookup>
+  801065:	83 c4 10             	add    $0x10,%esp
+  801068:	85 c0                	test   %eax,%eax
+  80106a:	79 02                	jns    80106e <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80106c:	c9                   	leave
+  80106d:	c3                   	ret
+		return fd_close(fd, 1);
+  80106e:	83 ec 08             	sub    $0x8,%esp
+  801071:	6a 01                	push   $0x1
+  801073:	ff 75 f4             	push   -0xc(%ebp)
+  801076:	e8 51 ff ff ff       	call   800fcc <fd_close>
+  80107b:	83 c4 10             	add    $0x10,%esp
+  80107e:	eb ec                	jmp    80106c <close+0x19>
+
+00801080 <close_all>:
+
+void
+close_all(void)
+{
+  801080:	55                   	push   %ebp
+  801081:	89 e5                	mov    %esp,%ebp
+  801083:	53                   	push   %ebx
+  801084:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801087:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80108c:	83 ec 0c             	sub    $0xc,%esp
+  80108f:	53                   	push   %ebx
+  801090:	e8 be ff ff ff       	call   801053 <close>
+	for (i = 0; i < MAXFD; i++)
+  801095:	83 c3 01             	add    $0x1,%ebx
+  801098:	83 c4 10             	add    $0x10,%esp
+  80109b:	83 fb 20             	cmp    $0x20,%ebx
+  80109e:	75 ec                	jne    80108c <close_all+0xc>
+}
+  8010a0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010a3:	c9                   	leave
+  8010a4:	c3                   	ret
+
+008010a5 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8010a5:	55                   	push   %ebp
+  8010a6:	89 e5                	mov    %esp,%ebp
+  8010a8:	57                   	push   %edi
+  8010a9:	56                   	push   %esi
+  8010aa:	53                   	push   %ebx
+  8010ab:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8010ae:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8010b1:	50                   	push   %eax
+  8010b2:	ff 75 08             	push   0x8(%ebp)
+  8010b5:	e8 6f fe ff ff       	call   800f29 <fd_lookup>
+  8010ba:	89 c3                	mov    %eax,%ebx
+  8010bc:	83 c4 10             	add    $0x10,%esp
+  8010bf:	85 c0                	test   %eax,%eax
+  8010c1:	78 7f                	js     801142 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8010c3:	83 ec 0c             	sub    $0xc,%esp
+  8010c6:	ff 75 0c             	push   0xc(%ebp)
+  8010c9:	e8 85 ff ff ff       	call   801053 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8010ce:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8010d1:	c1 e6 0c             	shl    $0xc,%esi
+  8010d4:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8010da:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8010dd:	89 3c 24             	mov    %edi,(%esp)
+  8010e0:	e8 d7 fd ff ff       	call   800ebc <fd2data>
+  8010e5:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8010e7:	89 34 24             	mov    %esi,(%esp)
+  8010ea:	e8 cd fd ff ff       	call   800ebc <fd2data>
+  8010ef:	83 c4 10             	add    $0x10,%esp
+  8010f2:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8010f5:	89 d8                	mov    %ebx,%eax
+  8010f7:	c1 e8 16             	shr    $0x16,%eax
+  8010fa:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801101:	a8 01                	test   $0x1,%al
+  801103:	74 11                	je     801116 <dup+0x71>
+  801105:	89 d8                	mov    %ebx,%eax
+  801107:	c1 e8 0c             	shr    $0xc,%eax
+  80110a:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801111:	f6 c2 01             	test   $0x1,%dl
+  801114:	75 36                	jne    80114c <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801116:	89 f8                	mov    %edi,%eax
+  801118:	c1 e8 0c             	shr    $0xc,%eax
+  80111b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801122:	83 ec 0c             	sub    $0xc,%esp
+  801125:	25 07 0e 00 00       	and    $0xe07,%eax
+  80112a:	50                   	push   %eax
+  80112b:	56                   	push   %esi
+  80112c:	6a 00                	push   $0x0
+  80112e:	57                   	push   %edi
+  80112f:	6a 00                	push   $0x0
+  801131:	e8 e6 fa ff ff       	call   800c1c <sys_page_map>
+  801136:	89 c3                	mov    %eax,%ebx
+  801138:	83 c4 20             	add    $0x20,%esp
+  80113b:	85 c0                	test   %eax,%eax
+  80113d:	78 33                	js     801172 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80113f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801142:	89 d8                	mov    %ebx,%eax
+  801144:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801147:	5b                   	pop    %ebx
+  801148:	5e                   	pop    %esi
+  801149:	5f                   	pop    %edi
+  80114a:	5d                   	pop    %ebp
+  80114b:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80114c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801153:	83 ec 0c             	sub    $0xc,%esp
+  801156:	25 07 0e 00 00       	and    $0xe07,%eax
+  80115b:	50                   	push   %eax
+  80115c:	ff 75 d4             	push   -0x2c(%ebp)
+  80115f:	6a 00                	push   $0x0
+  801161:	53                   	push   %ebx
+  801162:	6a 00                	push   $0x0
+  801164:	e8 b3 fa ff ff       	call   800c1c <sys_page_map>
+  801169:	89 c3                	mov    %eax,%ebx
+  80116b:	83 c4 20             	add    $0x20,%esp
+  80116e:	85 c0                	test   %eax,%eax
+  801170:	79 a4                	jns    801116 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801172:	83 ec 08             	sub    $0x8,%esp
+  801175:	56                   	push   %esi
+  801176:	6a 00                	push   $0x0
+  801178:	e8 e1 fa ff ff       	call   800c5e <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  80117d:	83 c4 08             	add    $0x8,%esp
+  801180:	ff 75 d4             	push   -0x2c(%ebp)
+  801183:	6a 00                	push   $0x0
+  801185:	e8 d4 fa ff ff       	call   800c5e <sys_page_unmap>
+	return r;
+  80118a:	83 c4 10             	add    $0x10,%esp
+  80118d:	eb b3                	jmp    801142 <dup+0x9d>
+
+0080118f <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80118f:	55                   	push   %ebp
+  801190:	89 e5                	mov    %esp,%ebp
+  801192:	56                   	push   %esi
+  801193:	53                   	push   %ebx
+  801194:	83 ec 18             	sub    $0x18,%esp
+  801197:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80119a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80119d:	50                   	push   %eax
+  80119e:	56                   	push   %esi
+  80119f:	e8 85 fd ff ff       	call   800f29 <fd_lookup>
+  8011a4:	83 c4 10             	add    $0x10,%esp
+  8011a7:	85 c0                	test   %eax,%eax
+  8011a9:	78 3c                	js     8011e7 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8011ab:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8011ae:	83 ec 08             	sub    $0x8,%esp
+  8011b1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8011b4:	50                   	push   %eax
+  8011b5:	ff 33                	push   (%ebx)
+  8011b7:	e8 bd fd ff ff       	call   800f79 <dev_lookup>
+  8011bc:	83 c4 10             	add    $0x10,%esp
+  8011bf:	85 c0                	test   %eax,%eax
+  8011c1:	78 24                	js     8011e7 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8011c3:	8b 43 08             	mov    0x8(%ebx),%eax
+  8011c6:	83 e0 03             	and    $0x3,%eax
+  8011c9:	83 f8 01             	cmp    $0x1,%eax
+  8011cc:	74 20                	je     8011ee <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8011ce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8011d1:	8b 40 08             	mov    0x8(%eax),%eax
+  8011d4:	85 c0                	test   %eax,%eax
+  8011d6:	74 37                	je     80120f <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8011d8:	83 ec 04             	sub    $0x4,%esp
+  8011db:	ff 75 10             	push   0x10(%ebp)
+  8011de:	ff 75 0c             	push   0xc(%ebp)
+  8011e1:	53                   	push   %ebx
+  8011e2:	ff d0                	call   *%eax
+  8011e4:	83 c4 10             	add    $0x10,%esp
+}
+  8011e7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8011ea:	5b                   	pop    %ebx
+  8011eb:	5e                   	pop    %esi
+  8011ec:	5d                   	pop    %ebp
+  8011ed:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8011ee:	a1 08 40 80 00       	mov    0x804008,%eax
+  8011f3:	8b 40 48             	mov    0x48(%eax),%eax
+  8011f6:	83 ec 04             	sub    $0x4,%esp
+  8011f9:	56                   	push   %esi
+  8011fa:	50                   	push   %eax
+  8011fb:	68 91 29 80 00       	push   $0x802991
+  801200:	e8 2f f0 ff ff       	call   800234 <cprintf>
+		return -E_INVAL;
+  801205:	83 c4 10             	add    $0x10,%esp
+  801208:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80120d:	eb d8                	jmp    8011e7 <read+0x58>
+		return -E_NOT_SUPP;
+  80120f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801214:	eb d1                	jmp    8011e7 <read+0x58>
+
+00801216 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801216:	55                   	push   %ebp
+  801217:	89 e5                	mov    %esp,%ebp
+  801219:	57                   	push   %edi
+  80121a:	56                   	push   %esi
+  80121b:	53                   	push   %ebx
+  80121c:	83 ec 0c             	sub    $0xc,%esp
+  80121f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801222:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801225:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80122a:	eb 02                	jmp    80122e <readn+0x18>
+  80122c:	01 c3                	add    %eax,%ebx
+  80122e:	39 f3                	cmp    %esi,%ebx
+  801230:	73 21                	jae    801253 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801232:	83 ec 04             	sub    $0x4,%esp
+  801235:	89 f0                	mov    %esi,%eax
+  801237:	29 d8                	sub    %ebx,%eax
+  801239:	50                   	push   %eax
+  80123a:	89 d8                	mov    %ebx,%eax
+  80123c:	03 45 0c             	add    0xc(%ebp),%eax
+  80123f:	50                   	push   %eax
+  801240:	57                   	push   %edi
+  801241:	e8 49 ff ff ff       	call   80118f <read>
+		if (m < 0)
+  801246:	83 c4 10             	add    $0x10,%esp
+  801249:	85 c0                	test   %eax,%eax
+  80124b:	78 04                	js     801251 <readn+0x3b>
+			return m;
+		if (m == 0)
+  80124d:	75 dd                	jne    80122c <readn+0x16>
+  80124f:	eb 02                	jmp    801253 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801251:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801253:	89 d8                	mov    %ebx,%eax
+  801255:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801258:	5b                   	pop    %ebx
+  801259:	5e                   	pop    %esi
+  80125a:	5f                   	pop    %edi
+  80125b:	5d                   	pop    %ebp
+  80125c:	c3                   	ret
+
+0080125d <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80125d:	55                   	push   %ebp
+  80125e:	89 e5                	mov    %esp,%ebp
+  801260:	56                   	push   %esi
+  801261:	53                   	push   %ebx
+  801262:	83 ec 18             	sub    $0x18,%esp
+  801265:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801268:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80126b:	50                   	push   %eax
+  80126c:	53                   	push   %ebx
+  80126d:	e8 b7 fc ff ff       	call   800f29 <fd_lookup>
+  801272:	83 c4 10             	add    $0x10,%esp
+  801275:	85 c0                	test   %eax,%eax
+  801277:	78 37                	js     8012b0 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801279:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80127c:	83 ec 08             	sub    $0x8,%esp
+  80127f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801282:	50                   	push   %eax
+  801283:	ff 36                	push   (%esi)
+  801285:	e8 ef fc ff ff       	call   800f79 <dev_lookup>
+  80128a:	83 c4 10             	add    $0x10,%esp
+  80128d:	85 c0                	test   %eax,%eax
+  80128f:	78 1f                	js     8012b0 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801291:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801295:	74 20                	je     8012b7 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801297:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80129a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80129d:	85 c0                	test   %eax,%eax
+  80129f:	74 37                	je     8012d8 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8012a1:	83 ec 04             	sub    $0x4,%esp
+  8012a4:	ff 75 10             	push   0x10(%ebp)
+  8012a7:	ff 75 0c             	push   0xc(%ebp)
+  8012aa:	56                   	push   %esi
+  8012ab:	ff d0                	call   *%eax
+  8012ad:	83 c4 10             	add    $0x10,%esp
+}
+  8012b0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8012b3:	5b                   	pop    %ebx
+  8012b4:	5e                   	pop    %esi
+  8012b5:	5d                   	pop    %ebp
+  8012b6:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8012b7:	a1 08 40 80 00       	mov    0x804008,%eax
+  8012bc:	8b 40 48             	mov    0x48(%eax),%eax
+  8012bf:	83 ec 04             	sub    $0x4,%esp
+  8012c2:	53                   	push   %ebx
+  8012c3:	50                   	push   %eax
+  8012c4:	68 ad 29 80 00       	push   $0x8029ad
+  8012c9:	e8 66 ef ff ff       	call   800234 <cprintf>
+		return -E_INVAL;
+  8012ce:	83 c4 10             	add    $0x10,%esp
+  8012d1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012d6:	eb d8                	jmp    8012b0 <write+0x53>
+		return -E_NOT_SUPP;
+  8012d8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8012dd:	eb d1                	jmp    8012b0 <write+0x53>
+
+008012df <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8012df:	55                   	push   %ebp
+  8012e0:	89 e5                	mov    %esp,%ebp
+  8012e2:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8012e5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8012e8:	50                   	push   %eax
+  8012e9:	ff 75 08             	push   0x8(%ebp)
+  8012ec:	e8 38 fc ff ff       	call   800f29 <fd_lookup>
+  8012f1:	83 c4 10             	add    $0x10,%esp
+  8012f4:	85 c0                	test   %eax,%eax
+  8012f6:	78 0e                	js     801306 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8012f8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012fb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8012fe:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801301:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801306:	c9                   	leave
+  801307:	c3                   	ret
+
+00801308 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801308:	55                   	push   %ebp
+  801309:	89 e5                	mov    %esp,%ebp
+  80130b:	56                   	push   %esi
+  80130c:	53                   	push   %ebx
+  80130d:	83 ec 18             	sub    $0x18,%esp
+  801310:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801313:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801316:	50                   	push   %eax
+  801317:	53                   	push   %ebx
+  801318:	e8 0c fc ff ff       	call   800f29 <fd_lookup>
+  80131d:	83 c4 10             	add    $0x10,%esp
+  801320:	85 c0                	test   %eax,%eax
+  801322:	78 34                	js     801358 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801324:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801327:	83 ec 08             	sub    $0x8,%esp
+  80132a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80132d:	50                   	push   %eax
+  80132e:	ff 36                	push   (%esi)
+  801330:	e8 44 fc ff ff       	call   800f79 <dev_lookup>
+  801335:	83 c4 10             	add    $0x10,%esp
+  801338:	85 c0                	test   %eax,%eax
+  80133a:	78 1c                	js     801358 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80133c:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801340:	74 1d                	je     80135f <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801342:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801345:	8b 40 18             	mov    0x18(%eax),%eax
+  801348:	85 c0                	test   %eax,%eax
+  80134a:	74 34                	je     801380 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80134c:	83 ec 08             	sub    $0x8,%esp
+  80134f:	ff 75 0c             	push   0xc(%ebp)
+  801352:	56                   	push   %esi
+  801353:	ff d0                	call   *%eax
+  801355:	83 c4 10             	add    $0x10,%esp
+}
+  801358:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80135b:	5b                   	pop    %ebx
+  80135c:	5e                   	pop    %esi
+  80135d:	5d                   	pop    %ebp
+  80135e:	c3                   	ret
+			thisenv->env_id, fdnum);
+  80135f:	a1 08 40 80 00       	mov    0x804008,%eax
+  801364:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801367:	83 ec 04             	sub    $0x4,%esp
+  80136a:	53                   	push   %ebx
+  80136b:	50                   	push   %eax
+  80136c:	68 70 29 80 00       	push   $0x802970
+  801371:	e8 be ee ff ff       	call   800234 <cprintf>
+		return -E_INVAL;
+  801376:	83 c4 10             	add    $0x10,%esp
+  801379:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80137e:	eb d8                	jmp    801358 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801380:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801385:	eb d1                	jmp    801358 <ftruncate+0x50>
+
+00801387 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801387:	55                   	push   %ebp
+  801388:	89 e5                	mov    %esp,%ebp
+  80138a:	56                   	push   %esi
+  80138b:	53                   	push   %ebx
+  80138c:	83 ec 18             	sub    $0x18,%esp
+  80138f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801392:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801395:	50                   	push   %eax
+  801396:	ff 75 08             	push   0x8(%ebp)
+  801399:	e8 8b fb ff ff       	call   800f29 <fd_lookup>
+  80139e:	83 c4 10             	add    $0x10,%esp
+  8013a1:	85 c0                	test   %eax,%eax
+  8013a3:	78 49                	js     8013ee <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8013a5:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8013a8:	83 ec 08             	sub    $0x8,%esp
+  8013ab:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013ae:	50                   	push   %eax
+  8013af:	ff 36                	push   (%esi)
+  8013b1:	e8 c3 fb ff ff       	call   800f79 <dev_lookup>
+  8013b6:	83 c4 10             	add    $0x10,%esp
+  8013b9:	85 c0                	test   %eax,%eax
+  8013bb:	78 31                	js     8013ee <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8013bd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013c0:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8013c4:	74 2f                	je     8013f5 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8013c6:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8013c9:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8013d0:	00 00 00 
+	stat->st_isdir = 0;
+  8013d3:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8013da:	00 00 00 
+	stat->st_dev = dev;
+  8013dd:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8013e3:	83 ec 08             	sub    $0x8,%esp
+  8013e6:	53                   	push   %ebx
+  8013e7:	56                   	push   %esi
+  8013e8:	ff 50 14             	call   *0x14(%eax)
+  8013eb:	83 c4 10             	add    $0x10,%esp
+}
+  8013ee:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013f1:	5b                   	pop    %ebx
+  8013f2:	5e                   	pop    %esi
+  8013f3:	5d                   	pop    %ebp
+  8013f4:	c3                   	ret
+		return -E_NOT_SUPP;
+  8013f5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8013fa:	eb f2                	jmp    8013ee <fstat+0x67>
+
+008013fc <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8013fc:	55                   	push   %ebp
+  8013fd:	89 e5                	mov    %esp,%ebp
+  8013ff:	56                   	push   %esi
+  801400:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801401:	83 ec 08             	sub    $0x8,%esp
+  801404:	6a 00                	push   $0x0
+  801406:	ff 75 08             	push   0x8(%ebp)
+  801409:	e8 e4 01 00 00       	call   8015f2 <open>
+  80140e:	89 c3                	mov    %eax,%ebx
+  801410:	83 c4 10             	add    $0x10,%esp
+  801413:	85 c0                	test   %eax,%eax
+  801415:	78 1b                	js     801432 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801417:	83 ec 08             	sub    $0x8,%esp
+  80141a:	ff 75 0c             	push   0xc(%ebp)
+  80141d:	50                   	push   %eax
+  80141e:	e8 64 ff ff ff       	call   801387 <fstat>
+  801423:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801425:	89 1c 24             	mov    %ebx,(%esp)
+  801428:	e8 26 fc ff ff       	call   801053 <close>
+	return r;
+  80142d:	83 c4 10             	add    $0x10,%esp
+  801430:	89 f3                	mov    %esi,%ebx
+}
+  801432:	89 d8                	mov    %ebx,%eax
+  801434:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801437:	5b                   	pop    %ebx
+  801438:	5e                   	pop    %esi
+  801439:	5d                   	pop    %ebp
+  80143a:	c3                   	ret
+
+0080143b <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  80143b:	55                   	push   %ebp
+  80143c:	89 e5                	mov    %esp,%ebp
+  80143e:	56                   	push   %esi
+  80143f:	53                   	push   %ebx
+  801440:	89 c6                	mov    %eax,%esi
+  801442:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  801444:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  80144b:	74 27                	je     801474 <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80144d:	6a 07                	push   $0x7
+  80144f:	68 00 50 80 00       	push   $0x805000
+  801454:	56                   	push   %esi
+  801455:	ff 35 00 40 80 00    	push   0x804000
+  80145b:	e8 d1 0b 00 00       	call   802031 <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  801460:	83 c4 0c             	add    $0xc,%esp
+  801463:	6a 00                	push   $0x0
+  801465:	53                   	push   %ebx
+  801466:	6a 00                	push   $0x0
+  801468:	e8 50 0b 00 00       	call   801fbd <ipc_recv>
+}
+  80146d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801470:	5b                   	pop    %ebx
+  801471:	5e                   	pop    %esi
+  801472:	5d                   	pop    %ebp
+  801473:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  801474:	83 ec 0c             	sub    $0xc,%esp
+  801477:	6a 01                	push   $0x1
+  801479:	e8 07 0c 00 00       	call   802085 <ipc_find_env>
+  80147e:	a3 00 40 80 00       	mov    %eax,0x804000
+  801483:	83 c4 10             	add    $0x10,%esp
+  801486:	eb c5                	jmp    80144d <fsipc+0x12>
+
+00801488 <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801488:	55                   	push   %ebp
+  801489:	89 e5                	mov    %esp,%ebp
+  80148b:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80148e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801491:	8b 40 0c             	mov    0xc(%eax),%eax
+  801494:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.set_size.req_size = newsize;
+  801499:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80149c:	a3 04 50 80 00       	mov    %eax,0x805004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  8014a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014a6:	b8 02 00 00 00       	mov    $0x2,%eax
+  8014ab:	e8 8b ff ff ff       	call   80143b <fsipc>
+}
+  8014b0:	c9                   	leave
+  8014b1:	c3                   	ret
+
+008014b2 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8014b2:	55                   	push   %ebp
+  8014b3:	89 e5                	mov    %esp,%ebp
+  8014b5:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8014b8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014bb:	8b 40 0c             	mov    0xc(%eax),%eax
+  8014be:	a3 00 50 80 00       	mov    %eax,0x805000
+  return fsipc(FSREQ_FLUSH, NULL);
+  8014c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014c8:	b8 06 00 00 00       	mov    $0x6,%eax
+  8014cd:	e8 69 ff ff ff       	call   80143b <fsipc>
+}
+  8014d2:	c9                   	leave
+  8014d3:	c3                   	ret
+
+008014d4 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8014d4:	55                   	push   %ebp
+  8014d5:	89 e5                	mov    %esp,%ebp
+  8014d7:	53                   	push   %ebx
+  8014d8:	83 ec 04             	sub    $0x4,%esp
+  8014db:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8014de:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014e1:	8b 40 0c             	mov    0xc(%eax),%eax
+  8014e4:	a3 00 50 80 00       	mov    %eax,0x805000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8014e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014ee:	b8 05 00 00 00       	mov    $0x5,%eax
+  8014f3:	e8 43 ff ff ff       	call   80143b <fsipc>
+  8014f8:	85 c0                	test   %eax,%eax
+  8014fa:	78 2c                	js     801528 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8014fc:	83 ec 08             	sub    $0x8,%esp
+  8014ff:	68 00 50 80 00       	push   $0x805000
+  801504:	53                   	push   %ebx
+  801505:	e8 e3 f2 ff ff       	call   8007ed <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  80150a:	a1 80 50 80 00       	mov    0x805080,%eax
+  80150f:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801515:	a1 84 50 80 00       	mov    0x805084,%eax
+  80151a:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801520:	83 c4 10             	add    $0x10,%esp
+  801523:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801528:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80152b:	c9                   	leave
+  80152c:	c3                   	ret
+
+0080152d <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80152d:	55                   	push   %ebp
+  80152e:	89 e5                	mov    %esp,%ebp
+  801530:	83 ec 0c             	sub    $0xc,%esp
+  801533:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801536:	8b 55 08             	mov    0x8(%ebp),%edx
+  801539:	8b 52 0c             	mov    0xc(%edx),%edx
+  80153c:	89 15 00 50 80 00    	mov    %edx,0x805000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801542:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801547:	39 d0                	cmp    %edx,%eax
+  801549:	0f 47 c2             	cmova  %edx,%eax
+  80154c:	a3 04 50 80 00       	mov    %eax,0x805004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  801551:	50                   	push   %eax
+  801552:	ff 75 0c             	push   0xc(%ebp)
+  801555:	68 08 50 80 00       	push   $0x805008
+  80155a:	e8 14 f4 ff ff       	call   800973 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  80155f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801564:	b8 04 00 00 00       	mov    $0x4,%eax
+  801569:	e8 cd fe ff ff       	call   80143b <fsipc>
+}
+  80156e:	c9                   	leave
+  80156f:	c3                   	ret
+
+00801570 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801570:	55                   	push   %ebp
+  801571:	89 e5                	mov    %esp,%ebp
+  801573:	56                   	push   %esi
+  801574:	53                   	push   %ebx
+  801575:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801578:	8b 45 08             	mov    0x8(%ebp),%eax
+  80157b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80157e:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.read.req_n = n;
+  801583:	89 35 04 50 80 00    	mov    %esi,0x805004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801589:	ba 00 00 00 00       	mov    $0x0,%edx
+  80158e:	b8 03 00 00 00       	mov    $0x3,%eax
+  801593:	e8 a3 fe ff ff       	call   80143b <fsipc>
+  801598:	89 c3                	mov    %eax,%ebx
+  80159a:	85 c0                	test   %eax,%eax
+  80159c:	78 1f                	js     8015bd <devfile_read+0x4d>
+  assert(r <= n);
+  80159e:	39 c6                	cmp    %eax,%esi
+  8015a0:	72 24                	jb     8015c6 <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  8015a2:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8015a7:	7f 33                	jg     8015dc <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8015a9:	83 ec 04             	sub    $0x4,%esp
+  8015ac:	50                   	push   %eax
+  8015ad:	68 00 50 80 00       	push   $0x805000
+  8015b2:	ff 75 0c             	push   0xc(%ebp)
+  8015b5:	e8 b9 f3 ff ff       	call   800973 <memmove>
+  return r;
+  8015ba:	83 c4 10             	add    $0x10,%esp
+}
+  8015bd:	89 d8                	mov    %ebx,%eax
+  8015bf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015c2:	5b                   	pop    %ebx
+  8015c3:	5e                   	pop    %esi
+  8015c4:	5d                   	pop    %ebp
+  8015c5:	c3                   	ret
+  assert(r <= n);
+  8015c6:	68 e0 29 80 00       	push   $0x8029e0
+  8015cb:	68 e7 29 80 00       	push   $0x8029e7
+  8015d0:	6a 78                	push   $0x78
+  8015d2:	68 fc 29 80 00       	push   $0x8029fc
+  8015d7:	e8 7d eb ff ff       	call   800159 <_panic>
+  assert(r <= PGSIZE);
+  8015dc:	68 07 2a 80 00       	push   $0x802a07
+  8015e1:	68 e7 29 80 00       	push   $0x8029e7
+  8015e6:	6a 79                	push   $0x79
+  8015e8:	68 fc 29 80 00       	push   $0x8029fc
+  8015ed:	e8 67 eb ff ff       	call   800159 <_panic>
+
+008015f2 <open>:
+open(const char *path, int mode) {
+  8015f2:	55                   	push   %ebp
+  8015f3:	89 e5                	mov    %esp,%ebp
+  8015f5:	56                   	push   %esi
+  8015f6:	53                   	push   %ebx
+  8015f7:	83 ec 1c             	sub    $0x1c,%esp
+  8015fa:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  8015fd:	56                   	push   %esi
+  8015fe:	e8 af f1 ff ff       	call   8007b2 <strlen>
+  801603:	83 c4 10             	add    $0x10,%esp
+  801606:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80160b:	7f 6c                	jg     801679 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  80160d:	83 ec 0c             	sub    $0xc,%esp
+  801610:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801613:	50                   	push   %eax
+  801614:	e8 ba f8 ff ff       	call   800ed3 <fd_alloc>
+  801619:	89 c3                	mov    %eax,%ebx
+  80161b:	83 c4 10             	add    $0x10,%esp
+  80161e:	85 c0                	test   %eax,%eax
+  801620:	78 3c                	js     80165e <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801622:	83 ec 08             	sub    $0x8,%esp
+  801625:	56                   	push   %esi
+  801626:	68 00 50 80 00       	push   $0x805000
+  80162b:	e8 bd f1 ff ff       	call   8007ed <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801630:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801633:	a3 00 54 80 00       	mov    %eax,0x805400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801638:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80163b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801640:	e8 f6 fd ff ff       	call   80143b <fsipc>
+  801645:	89 c3                	mov    %eax,%ebx
+  801647:	83 c4 10             	add    $0x10,%esp
+  80164a:	85 c0                	test   %eax,%eax
+  80164c:	78 19                	js     801667 <open+0x75>
+  return fd2num(fd);
+  80164e:	83 ec 0c             	sub    $0xc,%esp
+  801651:	ff 75 f4             	push   -0xc(%ebp)
+  801654:	e8 53 f8 ff ff       	call   800eac <fd2num>
+  801659:	89 c3                	mov    %eax,%ebx
+  80165b:	83 c4 10             	add    $0x10,%esp
+}
+  80165e:	89 d8                	mov    %ebx,%eax
+  801660:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801663:	5b                   	pop    %ebx
+  801664:	5e                   	pop    %esi
+  801665:	5d                   	pop    %ebp
+  801666:	c3                   	ret
+    fd_close(fd, 0);
+  801667:	83 ec 08             	sub    $0x8,%esp
+  80166a:	6a 00                	push   $0x0
+  80166c:	ff 75 f4             	push   -0xc(%ebp)
+  80166f:	e8 58 f9 ff ff       	call   800fcc <fd_close>
+    return r;
+  801674:	83 c4 10             	add    $0x10,%esp
+  801677:	eb e5                	jmp    80165e <open+0x6c>
+    return -E_BAD_PATH;
+  801679:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80167e:	eb de                	jmp    80165e <open+0x6c>
+
+00801680 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  801680:	55                   	push   %ebp
+  801681:	89 e5                	mov    %esp,%ebp
+  801683:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801686:	ba 00 00 00 00       	mov    $0x0,%edx
+  80168b:	b8 08 00 00 00       	mov    $0x8,%eax
+  801690:	e8 a6 fd ff ff       	call   80143b <fsipc>
+}
+  801695:	c9                   	leave
+  801696:	c3                   	ret
+
+00801697 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801697:	55                   	push   %ebp
+  801698:	89 e5                	mov    %esp,%ebp
+  80169a:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  80169d:	68 13 2a 80 00       	push   $0x802a13
+  8016a2:	ff 75 0c             	push   0xc(%ebp)
+  8016a5:	e8 43 f1 ff ff       	call   8007ed <strcpy>
+	return 0;
+}
+  8016aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016af:	c9                   	leave
+  8016b0:	c3                   	ret
+
+008016b1 <devsock_close>:
+{
+  8016b1:	55                   	push   %ebp
+  8016b2:	89 e5                	mov    %esp,%ebp
+  8016b4:	53                   	push   %ebx
+  8016b5:	83 ec 10             	sub    $0x10,%esp
+  8016b8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8016bb:	53                   	push   %ebx
+  8016bc:	e8 03 0a 00 00       	call   8020c4 <pageref>
+  8016c1:	89 c2                	mov    %eax,%edx
+  8016c3:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8016c6:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8016cb:	83 fa 01             	cmp    $0x1,%edx
+  8016ce:	74 05                	je     8016d5 <devsock_close+0x24>
+}
+  8016d0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016d3:	c9                   	leave
+  8016d4:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8016d5:	83 ec 0c             	sub    $0xc,%esp
+  8016d8:	ff 73 0c             	push   0xc(%ebx)
+  8016db:	e8 b7 02 00 00       	call   801997 <nsipc_close>
+  8016e0:	83 c4 10             	add    $0x10,%esp
+  8016e3:	eb eb                	jmp    8016d0 <devsock_close+0x1f>
+
+008016e5 <devsock_write>:
+{
+  8016e5:	55                   	push   %ebp
+  8016e6:	89 e5                	mov    %esp,%ebp
+  8016e8:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8016eb:	6a 00                	push   $0x0
+  8016ed:	ff 75 10             	push   0x10(%ebp)
+  8016f0:	ff 75 0c             	push   0xc(%ebp)
+  8016f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016f6:	ff 70 0c             	push   0xc(%eax)
+  8016f9:	e8 79 03 00 00       	call   801a77 <nsipc_send>
+}
+  8016fe:	c9                   	leave
+  8016ff:	c3                   	ret
+
+00801700 <devsock_read>:
+{
+  801700:	55                   	push   %ebp
+  801701:	89 e5                	mov    %esp,%ebp
+  801703:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801706:	6a 00                	push   $0x0
+  801708:	ff 75 10             	push   0x10(%ebp)
+  80170b:	ff 75 0c             	push   0xc(%ebp)
+  80170e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801711:	ff 70 0c             	push   0xc(%eax)
+  801714:	e8 ef 02 00 00       	call   801a08 <nsipc_recv>
+}
+  801719:	c9                   	leave
+  80171a:	c3                   	ret
+
+0080171b <fd2sockid>:
+{
+  80171b:	55                   	push   %ebp
+  80171c:	89 e5                	mov    %esp,%ebp
+  80171e:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801721:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801724:	52                   	push   %edx
+  801725:	50                   	push   %eax
+  801726:	e8 fe f7 ff ff       	call   800f29 <fd_lookup>
+  80172b:	83 c4 10             	add    $0x10,%esp
+  80172e:	85 c0                	test   %eax,%eax
+  801730:	78 10                	js     801742 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801732:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801735:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  80173b:	39 08                	cmp    %ecx,(%eax)
+  80173d:	75 05                	jne    801744 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  80173f:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801742:	c9                   	leave
+  801743:	c3                   	ret
+		return -E_NOT_SUPP;
+  801744:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801749:	eb f7                	jmp    801742 <fd2sockid+0x27>
+
+0080174b <alloc_sockfd>:
+{
+  80174b:	55                   	push   %ebp
+  80174c:	89 e5                	mov    %esp,%ebp
+  80174e:	56                   	push   %esi
+  80174f:	53                   	push   %ebx
+  801750:	83 ec 1c             	sub    $0x1c,%esp
+  801753:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801755:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801758:	50                   	push   %eax
+  801759:	e8 75 f7 ff ff       	call   800ed3 <fd_alloc>
+  80175e:	89 c3                	mov    %eax,%ebx
+  801760:	83 c4 10             	add    $0x10,%esp
+  801763:	85 c0                	test   %eax,%eax
+  801765:	78 43                	js     8017aa <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801767:	83 ec 04             	sub    $0x4,%esp
+  80176a:	68 07 04 00 00       	push   $0x407
+  80176f:	ff 75 f4             	push   -0xc(%ebp)
+  801772:	6a 00                	push   $0x0
+  801774:	e8 60 f4 ff ff       	call   800bd9 <sys_page_alloc>
+  801779:	89 c3                	mov    %eax,%ebx
+  80177b:	83 c4 10             	add    $0x10,%esp
+  80177e:	85 c0                	test   %eax,%eax
+  801780:	78 28                	js     8017aa <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801782:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801785:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  80178b:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  80178d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801790:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801797:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  80179a:	83 ec 0c             	sub    $0xc,%esp
+  80179d:	50                   	push   %eax
+  80179e:	e8 09 f7 ff ff       	call   800eac <fd2num>
+  8017a3:	89 c3                	mov    %eax,%ebx
+  8017a5:	83 c4 10             	add    $0x10,%esp
+  8017a8:	eb 0c                	jmp    8017b6 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8017aa:	83 ec 0c             	sub    $0xc,%esp
+  8017ad:	56                   	push   %esi
+  8017ae:	e8 e4 01 00 00       	call   801997 <nsipc_close>
+		return r;
+  8017b3:	83 c4 10             	add    $0x10,%esp
+}
+  8017b6:	89 d8                	mov    %ebx,%eax
+  8017b8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017bb:	5b                   	pop    %ebx
+  8017bc:	5e                   	pop    %esi
+  8017bd:	5d                   	pop    %ebp
+  8017be:	c3                   	ret
+
+008017bf <accept>:
+{
+  8017bf:	55                   	push   %ebp
+  8017c0:	89 e5                	mov    %esp,%ebp
+  8017c2:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8017c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017c8:	e8 4e ff ff ff       	call   80171b <fd2sockid>
+  8017cd:	85 c0                	test   %eax,%eax
+  8017cf:	78 1b                	js     8017ec <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8017d1:	83 ec 04             	sub    $0x4,%esp
+  8017d4:	ff 75 10             	push   0x10(%ebp)
+  8017d7:	ff 75 0c             	push   0xc(%ebp)
+  8017da:	50                   	push   %eax
+  8017db:	e8 0e 01 00 00       	call   8018ee <nsipc_accept>
+  8017e0:	83 c4 10             	add    $0x10,%esp
+  8017e3:	85 c0                	test   %eax,%eax
+  8017e5:	78 05                	js     8017ec <accept+0x2d>
+	return alloc_sockfd(r);
+  8017e7:	e8 5f ff ff ff       	call   80174b <alloc_sockfd>
+}
+  8017ec:	c9                   	leave
+  8017ed:	c3                   	ret
+
+008017ee <bind>:
+{
+  8017ee:	55                   	push   %ebp
+  8017ef:	89 e5                	mov    %esp,%ebp
+  8017f1:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8017f4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017f7:	e8 1f ff ff ff       	call   80171b <fd2sockid>
+  8017fc:	85 c0                	test   %eax,%eax
+  8017fe:	78 12                	js     801812 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801800:	83 ec 04             	sub    $0x4,%esp
+  801803:	ff 75 10             	push   0x10(%ebp)
+  801806:	ff 75 0c             	push   0xc(%ebp)
+  801809:	50                   	push   %eax
+  80180a:	e8 31 01 00 00       	call   801940 <nsipc_bind>
+  80180f:	83 c4 10             	add    $0x10,%esp
+}
+  801812:	c9                   	leave
+  801813:	c3                   	ret
+
+00801814 <shutdown>:
+{
+  801814:	55                   	push   %ebp
+  801815:	89 e5                	mov    %esp,%ebp
+  801817:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80181a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80181d:	e8 f9 fe ff ff       	call   80171b <fd2sockid>
+  801822:	85 c0                	test   %eax,%eax
+  801824:	78 0f                	js     801835 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801826:	83 ec 08             	sub    $0x8,%esp
+  801829:	ff 75 0c             	push   0xc(%ebp)
+  80182c:	50                   	push   %eax
+  80182d:	e8 43 01 00 00       	call   801975 <nsipc_shutdown>
+  801832:	83 c4 10             	add    $0x10,%esp
+}
+  801835:	c9                   	leave
+  801836:	c3                   	ret
+
+00801837 <connect>:
+{
+  801837:	55                   	push   %ebp
+  801838:	89 e5                	mov    %esp,%ebp
+  80183a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80183d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801840:	e8 d6 fe ff ff       	call   80171b <fd2sockid>
+  801845:	85 c0                	test   %eax,%eax
+  801847:	78 12                	js     80185b <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801849:	83 ec 04             	sub    $0x4,%esp
+  80184c:	ff 75 10             	push   0x10(%ebp)
+  80184f:	ff 75 0c             	push   0xc(%ebp)
+  801852:	50                   	push   %eax
+  801853:	e8 59 01 00 00       	call   8019b1 <nsipc_connect>
+  801858:	83 c4 10             	add    $0x10,%esp
+}
+  80185b:	c9                   	leave
+  80185c:	c3                   	ret
+
+0080185d <listen>:
+{
+  80185d:	55                   	push   %ebp
+  80185e:	89 e5                	mov    %esp,%ebp
+  801860:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801863:	8b 45 08             	mov    0x8(%ebp),%eax
+  801866:	e8 b0 fe ff ff       	call   80171b <fd2sockid>
+  80186b:	85 c0                	test   %eax,%eax
+  80186d:	78 0f                	js     80187e <listen+0x21>
+	return nsipc_listen(r, backlog);
+  80186f:	83 ec 08             	sub    $0x8,%esp
+  801872:	ff 75 0c             	push   0xc(%ebp)
+  801875:	50                   	push   %eax
+  801876:	e8 6b 01 00 00       	call   8019e6 <nsipc_listen>
+  80187b:	83 c4 10             	add    $0x10,%esp
+}
+  80187e:	c9                   	leave
+  80187f:	c3                   	ret
+
+00801880 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801880:	55                   	push   %ebp
+  801881:	89 e5                	mov    %esp,%ebp
+  801883:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801886:	ff 75 10             	push   0x10(%ebp)
+  801889:	ff 75 0c             	push   0xc(%ebp)
+  80188c:	ff 75 08             	push   0x8(%ebp)
+  80188f:	e8 41 02 00 00       	call   801ad5 <nsipc_socket>
+  801894:	83 c4 10             	add    $0x10,%esp
+  801897:	85 c0                	test   %eax,%eax
+  801899:	78 05                	js     8018a0 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  80189b:	e8 ab fe ff ff       	call   80174b <alloc_sockfd>
+}
+  8018a0:	c9                   	leave
+  8018a1:	c3                   	ret
+
+008018a2 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8018a2:	55                   	push   %ebp
+  8018a3:	89 e5                	mov    %esp,%ebp
+  8018a5:	53                   	push   %ebx
+  8018a6:	83 ec 04             	sub    $0x4,%esp
+  8018a9:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  8018ab:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8018b2:	74 26                	je     8018da <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8018b4:	6a 07                	push   $0x7
+  8018b6:	68 00 60 80 00       	push   $0x806000
+  8018bb:	53                   	push   %ebx
+  8018bc:	ff 35 04 40 80 00    	push   0x804004
+  8018c2:	e8 6a 07 00 00       	call   802031 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8018c7:	83 c4 0c             	add    $0xc,%esp
+  8018ca:	6a 00                	push   $0x0
+  8018cc:	6a 00                	push   $0x0
+  8018ce:	6a 00                	push   $0x0
+  8018d0:	e8 e8 06 00 00       	call   801fbd <ipc_recv>
+}
+  8018d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018d8:	c9                   	leave
+  8018d9:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8018da:	83 ec 0c             	sub    $0xc,%esp
+  8018dd:	6a 02                	push   $0x2
+  8018df:	e8 a1 07 00 00       	call   802085 <ipc_find_env>
+  8018e4:	a3 04 40 80 00       	mov    %eax,0x804004
+  8018e9:	83 c4 10             	add    $0x10,%esp
+  8018ec:	eb c6                	jmp    8018b4 <nsipc+0x12>
+
+008018ee <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8018ee:	55                   	push   %ebp
+  8018ef:	89 e5                	mov    %esp,%ebp
+  8018f1:	56                   	push   %esi
+  8018f2:	53                   	push   %ebx
+  8018f3:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8018f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018f9:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  8018fe:	8b 06                	mov    (%esi),%eax
+  801900:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801905:	b8 01 00 00 00       	mov    $0x1,%eax
+  80190a:	e8 93 ff ff ff       	call   8018a2 <nsipc>
+  80190f:	89 c3                	mov    %eax,%ebx
+  801911:	85 c0                	test   %eax,%eax
+  801913:	79 09                	jns    80191e <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801915:	89 d8                	mov    %ebx,%eax
+  801917:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80191a:	5b                   	pop    %ebx
+  80191b:	5e                   	pop    %esi
+  80191c:	5d                   	pop    %ebp
+  80191d:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  80191e:	83 ec 04             	sub    $0x4,%esp
+  801921:	ff 35 10 60 80 00    	push   0x806010
+  801927:	68 00 60 80 00       	push   $0x806000
+  80192c:	ff 75 0c             	push   0xc(%ebp)
+  80192f:	e8 3f f0 ff ff       	call   800973 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801934:	a1 10 60 80 00       	mov    0x806010,%eax
+  801939:	89 06                	mov    %eax,(%esi)
+  80193b:	83 c4 10             	add    $0x10,%esp
+	return r;
+  80193e:	eb d5                	jmp    801915 <nsipc_accept+0x27>
+
+00801940 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801940:	55                   	push   %ebp
+  801941:	89 e5                	mov    %esp,%ebp
+  801943:	53                   	push   %ebx
+  801944:	83 ec 08             	sub    $0x8,%esp
+  801947:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  80194a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80194d:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801952:	53                   	push   %ebx
+  801953:	ff 75 0c             	push   0xc(%ebp)
+  801956:	68 04 60 80 00       	push   $0x806004
+  80195b:	e8 13 f0 ff ff       	call   800973 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801960:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  801966:	b8 02 00 00 00       	mov    $0x2,%eax
+  80196b:	e8 32 ff ff ff       	call   8018a2 <nsipc>
+}
+  801970:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801973:	c9                   	leave
+  801974:	c3                   	ret
+
+00801975 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801975:	55                   	push   %ebp
+  801976:	89 e5                	mov    %esp,%ebp
+  801978:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  80197b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80197e:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  801983:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801986:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  80198b:	b8 03 00 00 00       	mov    $0x3,%eax
+  801990:	e8 0d ff ff ff       	call   8018a2 <nsipc>
+}
+  801995:	c9                   	leave
+  801996:	c3                   	ret
+
+00801997 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801997:	55                   	push   %ebp
+  801998:	89 e5                	mov    %esp,%ebp
+  80199a:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  80199d:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019a0:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  8019a5:	b8 04 00 00 00       	mov    $0x4,%eax
+  8019aa:	e8 f3 fe ff ff       	call   8018a2 <nsipc>
+}
+  8019af:	c9                   	leave
+  8019b0:	c3                   	ret
+
+008019b1 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8019b1:	55                   	push   %ebp
+  8019b2:	89 e5                	mov    %esp,%ebp
+  8019b4:	53                   	push   %ebx
+  8019b5:	83 ec 08             	sub    $0x8,%esp
+  8019b8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8019bb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019be:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8019c3:	53                   	push   %ebx
+  8019c4:	ff 75 0c             	push   0xc(%ebp)
+  8019c7:	68 04 60 80 00       	push   $0x806004
+  8019cc:	e8 a2 ef ff ff       	call   800973 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8019d1:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  8019d7:	b8 05 00 00 00       	mov    $0x5,%eax
+  8019dc:	e8 c1 fe ff ff       	call   8018a2 <nsipc>
+}
+  8019e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019e4:	c9                   	leave
+  8019e5:	c3                   	ret
+
+008019e6 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8019e6:	55                   	push   %ebp
+  8019e7:	89 e5                	mov    %esp,%ebp
+  8019e9:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8019ec:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019ef:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  8019f4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019f7:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  8019fc:	b8 06 00 00 00       	mov    $0x6,%eax
+  801a01:	e8 9c fe ff ff       	call   8018a2 <nsipc>
+}
+  801a06:	c9                   	leave
+  801a07:	c3                   	ret
+
+00801a08 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801a08:	55                   	push   %ebp
+  801a09:	89 e5                	mov    %esp,%ebp
+  801a0b:	56                   	push   %esi
+  801a0c:	53                   	push   %ebx
+  801a0d:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801a10:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a13:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  801a18:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  801a1e:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a21:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801a26:	b8 07 00 00 00       	mov    $0x7,%eax
+  801a2b:	e8 72 fe ff ff       	call   8018a2 <nsipc>
+  801a30:	89 c3                	mov    %eax,%ebx
+  801a32:	85 c0                	test   %eax,%eax
+  801a34:	78 22                	js     801a58 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801a36:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801a3b:	39 c6                	cmp    %eax,%esi
+  801a3d:	0f 4e c6             	cmovle %esi,%eax
+  801a40:	39 c3                	cmp    %eax,%ebx
+  801a42:	7f 1d                	jg     801a61 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801a44:	83 ec 04             	sub    $0x4,%esp
+  801a47:	53                   	push   %ebx
+  801a48:	68 00 60 80 00       	push   $0x806000
+  801a4d:	ff 75 0c             	push   0xc(%ebp)
+  801a50:	e8 1e ef ff ff       	call   800973 <memmove>
+  801a55:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801a58:	89 d8                	mov    %ebx,%eax
+  801a5a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a5d:	5b                   	pop    %ebx
+  801a5e:	5e                   	pop    %esi
+  801a5f:	5d                   	pop    %ebp
+  801a60:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801a61:	68 1f 2a 80 00       	push   $0x802a1f
+  801a66:	68 e7 29 80 00       	push   $0x8029e7
+  801a6b:	6a 62                	push   $0x62
+  801a6d:	68 34 2a 80 00       	push   $0x802a34
+  801a72:	e8 e2 e6 ff ff       	call   800159 <_panic>
+
+00801a77 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801a77:	55                   	push   %ebp
+  801a78:	89 e5                	mov    %esp,%ebp
+  801a7a:	53                   	push   %ebx
+  801a7b:	83 ec 04             	sub    $0x4,%esp
+  801a7e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801a81:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a84:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  801a89:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801a8f:	7f 2e                	jg     801abf <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801a91:	83 ec 04             	sub    $0x4,%esp
+  801a94:	53                   	push   %ebx
+  801a95:	ff 75 0c             	push   0xc(%ebp)
+  801a98:	68 0c 60 80 00       	push   $0x80600c
+  801a9d:	e8 d1 ee ff ff       	call   800973 <memmove>
+	nsipcbuf.send.req_size = size;
+  801aa2:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  801aa8:	8b 45 14             	mov    0x14(%ebp),%eax
+  801aab:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  801ab0:	b8 08 00 00 00       	mov    $0x8,%eax
+  801ab5:	e8 e8 fd ff ff       	call   8018a2 <nsipc>
+}
+  801aba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801abd:	c9                   	leave
+  801abe:	c3                   	ret
+	assert(size < 1600);
+  801abf:	68 40 2a 80 00       	push   $0x802a40
+  801ac4:	68 e7 29 80 00       	push   $0x8029e7
+  801ac9:	6a 6d                	push   $0x6d
+  801acb:	68 34 2a 80 00       	push   $0x802a34
+  801ad0:	e8 84 e6 ff ff       	call   800159 <_panic>
+
+00801ad5 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801ad5:	55                   	push   %ebp
+  801ad6:	89 e5                	mov    %esp,%ebp
+  801ad8:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801adb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ade:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  801ae3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ae6:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  801aeb:	8b 45 10             	mov    0x10(%ebp),%eax
+  801aee:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  801af3:	b8 09 00 00 00       	mov    $0x9,%eax
+  801af8:	e8 a5 fd ff ff       	call   8018a2 <nsipc>
+}
+  801afd:	c9                   	leave
+  801afe:	c3                   	ret
+
+00801aff <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801aff:	55                   	push   %ebp
+  801b00:	89 e5                	mov    %esp,%ebp
+  801b02:	56                   	push   %esi
+  801b03:	53                   	push   %ebx
+  801b04:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801b07:	83 ec 0c             	sub    $0xc,%esp
+  801b0a:	ff 75 08             	push   0x8(%ebp)
+  801b0d:	e8 aa f3 ff ff       	call   800ebc <fd2data>
+  801b12:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801b14:	83 c4 08             	add    $0x8,%esp
+  801b17:	68 4c 2a 80 00       	push   $0x802a4c
+  801b1c:	53                   	push   %ebx
+  801b1d:	e8 cb ec ff ff       	call   8007ed <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801b22:	8b 46 04             	mov    0x4(%esi),%eax
+  801b25:	2b 06                	sub    (%esi),%eax
+  801b27:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  801b2d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801b34:	00 00 00 
+	stat->st_dev = &devpipe;
+  801b37:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  801b3e:	30 80 00 
+	return 0;
+}
+  801b41:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b46:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b49:	5b                   	pop    %ebx
+  801b4a:	5e                   	pop    %esi
+  801b4b:	5d                   	pop    %ebp
+  801b4c:	c3                   	ret
+
+00801b4d <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801b4d:	55                   	push   %ebp
+  801b4e:	89 e5                	mov    %esp,%ebp
+  801b50:	53                   	push   %ebx
+  801b51:	83 ec 0c             	sub    $0xc,%esp
+  801b54:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801b57:	53                   	push   %ebx
+  801b58:	6a 00                	push   $0x0
+  801b5a:	e8 ff f0 ff ff       	call   800c5e <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801b5f:	89 1c 24             	mov    %ebx,(%esp)
+  801b62:	e8 55 f3 ff ff       	call   800ebc <fd2data>
+  801b67:	83 c4 08             	add    $0x8,%esp
+  801b6a:	50                   	push   %eax
+  801b6b:	6a 00                	push   $0x0
+  801b6d:	e8 ec f0 ff ff       	call   800c5e <sys_page_unmap>
+}
+  801b72:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b75:	c9                   	leave
+  801b76:	c3                   	ret
+
+00801b77 <_pipeisclosed>:
+{
+  801b77:	55                   	push   %ebp
+  801b78:	89 e5                	mov    %esp,%ebp
+  801b7a:	57                   	push   %edi
+  801b7b:	56                   	push   %esi
+  801b7c:	53                   	push   %ebx
+  801b7d:	83 ec 1c             	sub    $0x1c,%esp
+  801b80:	89 c7                	mov    %eax,%edi
+  801b82:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801b84:	a1 08 40 80 00       	mov    0x804008,%eax
+  801b89:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801b8c:	83 ec 0c             	sub    $0xc,%esp
+  801b8f:	57                   	push   %edi
+  801b90:	e8 2f 05 00 00       	call   8020c4 <pageref>
+  801b95:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801b98:	89 34 24             	mov    %esi,(%esp)
+  801b9b:	e8 24 05 00 00       	call   8020c4 <pageref>
+		nn = thisenv->env_runs;
+  801ba0:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801ba6:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801ba9:	83 c4 10             	add    $0x10,%esp
+  801bac:	39 cb                	cmp    %ecx,%ebx
+  801bae:	74 1b                	je     801bcb <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801bb0:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801bb3:	75 cf                	jne    801b84 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801bb5:	8b 42 58             	mov    0x58(%edx),%eax
+  801bb8:	6a 01                	push   $0x1
+  801bba:	50                   	push   %eax
+  801bbb:	53                   	push   %ebx
+  801bbc:	68 53 2a 80 00       	push   $0x802a53
+  801bc1:	e8 6e e6 ff ff       	call   800234 <cprintf>
+  801bc6:	83 c4 10             	add    $0x10,%esp
+  801bc9:	eb b9                	jmp    801b84 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801bcb:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801bce:	0f 94 c0             	sete   %al
+  801bd1:	0f b6 c0             	movzbl %al,%eax
+}
+  801bd4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bd7:	5b                   	pop    %ebx
+  801bd8:	5e                   	pop    %esi
+  801bd9:	5f                   	pop    %edi
+  801bda:	5d                   	pop    %ebp
+  801bdb:	c3                   	ret
+
+00801bdc <devpipe_write>:
+{
+  801bdc:	55                   	push   %ebp
+  801bdd:	89 e5                	mov    %esp,%ebp
+  801bdf:	57                   	push   %edi
+  801be0:	56                   	push   %esi
+  801be1:	53                   	push   %ebx
+  801be2:	83 ec 28             	sub    $0x28,%esp
+  801be5:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801be8:	56                   	push   %esi
+  801be9:	e8 ce f2 ff ff       	call   800ebc <fd2data>
+  801bee:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801bf0:	83 c4 10             	add    $0x10,%esp
+  801bf3:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bf8:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801bfb:	75 09                	jne    801c06 <devpipe_write+0x2a>
+	return i;
+  801bfd:	89 f8                	mov    %edi,%eax
+  801bff:	eb 23                	jmp    801c24 <devpipe_write+0x48>
+			sys_yield();
+  801c01:	e8 b4 ef ff ff       	call   800bba <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801c06:	8b 43 04             	mov    0x4(%ebx),%eax
+  801c09:	8b 0b                	mov    (%ebx),%ecx
+  801c0b:	8d 51 20             	lea    0x20(%ecx),%edx
+  801c0e:	39 d0                	cmp    %edx,%eax
+  801c10:	72 1a                	jb     801c2c <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  801c12:	89 da                	mov    %ebx,%edx
+  801c14:	89 f0                	mov    %esi,%eax
+  801c16:	e8 5c ff ff ff       	call   801b77 <_pipeisclosed>
+  801c1b:	85 c0                	test   %eax,%eax
+  801c1d:	74 e2                	je     801c01 <devpipe_write+0x25>
+				return 0;
+  801c1f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c24:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c27:	5b                   	pop    %ebx
+  801c28:	5e                   	pop    %esi
+  801c29:	5f                   	pop    %edi
+  801c2a:	5d                   	pop    %ebp
+  801c2b:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801c2c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c2f:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801c33:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801c36:	89 c2                	mov    %eax,%edx
+  801c38:	c1 fa 1f             	sar    $0x1f,%edx
+  801c3b:	89 d1                	mov    %edx,%ecx
+  801c3d:	c1 e9 1b             	shr    $0x1b,%ecx
+  801c40:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801c43:	83 e2 1f             	and    $0x1f,%edx
+  801c46:	29 ca                	sub    %ecx,%edx
+  801c48:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801c4c:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  801c50:	83 c0 01             	add    $0x1,%eax
+  801c53:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  801c56:	83 c7 01             	add    $0x1,%edi
+  801c59:	eb 9d                	jmp    801bf8 <devpipe_write+0x1c>
+
+00801c5b <devpipe_read>:
+{
+  801c5b:	55                   	push   %ebp
+  801c5c:	89 e5                	mov    %esp,%ebp
+  801c5e:	57                   	push   %edi
+  801c5f:	56                   	push   %esi
+  801c60:	53                   	push   %ebx
+  801c61:	83 ec 18             	sub    $0x18,%esp
+  801c64:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  801c67:	57                   	push   %edi
+  801c68:	e8 4f f2 ff ff       	call   800ebc <fd2data>
+  801c6d:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801c6f:	83 c4 10             	add    $0x10,%esp
+  801c72:	be 00 00 00 00       	mov    $0x0,%esi
+  801c77:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801c7a:	75 13                	jne    801c8f <devpipe_read+0x34>
+	return i;
+  801c7c:	89 f0                	mov    %esi,%eax
+  801c7e:	eb 02                	jmp    801c82 <devpipe_read+0x27>
+				return i;
+  801c80:	89 f0                	mov    %esi,%eax
+}
+  801c82:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c85:	5b                   	pop    %ebx
+  801c86:	5e                   	pop    %esi
+  801c87:	5f                   	pop    %edi
+  801c88:	5d                   	pop    %ebp
+  801c89:	c3                   	ret
+			sys_yield();
+  801c8a:	e8 2b ef ff ff       	call   800bba <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  801c8f:	8b 03                	mov    (%ebx),%eax
+  801c91:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801c94:	75 18                	jne    801cae <devpipe_read+0x53>
+			if (i > 0)
+  801c96:	85 f6                	test   %esi,%esi
+  801c98:	75 e6                	jne    801c80 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  801c9a:	89 da                	mov    %ebx,%edx
+  801c9c:	89 f8                	mov    %edi,%eax
+  801c9e:	e8 d4 fe ff ff       	call   801b77 <_pipeisclosed>
+  801ca3:	85 c0                	test   %eax,%eax
+  801ca5:	74 e3                	je     801c8a <devpipe_read+0x2f>
+				return 0;
+  801ca7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cac:	eb d4                	jmp    801c82 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801cae:	99                   	cltd
+  801caf:	c1 ea 1b             	shr    $0x1b,%edx
+  801cb2:	01 d0                	add    %edx,%eax
+  801cb4:	83 e0 1f             	and    $0x1f,%eax
+  801cb7:	29 d0                	sub    %edx,%eax
+  801cb9:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801cbe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801cc1:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  801cc4:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  801cc7:	83 c6 01             	add    $0x1,%esi
+  801cca:	eb ab                	jmp    801c77 <devpipe_read+0x1c>
+
+00801ccc <pipe>:
+{
+  801ccc:	55                   	push   %ebp
+  801ccd:	89 e5                	mov    %esp,%ebp
+  801ccf:	56                   	push   %esi
+  801cd0:	53                   	push   %ebx
+  801cd1:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801cd4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cd7:	50                   	push   %eax
+  801cd8:	e8 f6 f1 ff ff       	call   800ed3 <fd_alloc>
+  801cdd:	89 c3                	mov    %eax,%ebx
+  801cdf:	83 c4 10             	add    $0x10,%esp
+  801ce2:	85 c0                	test   %eax,%eax
+  801ce4:	0f 88 23 01 00 00    	js     801e0d <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801cea:	83 ec 04             	sub    $0x4,%esp
+  801ced:	68 07 04 00 00       	push   $0x407
+  801cf2:	ff 75 f4             	push   -0xc(%ebp)
+  801cf5:	6a 00                	push   $0x0
+  801cf7:	e8 dd ee ff ff       	call   800bd9 <sys_page_alloc>
+  801cfc:	89 c3                	mov    %eax,%ebx
+  801cfe:	83 c4 10             	add    $0x10,%esp
+  801d01:	85 c0                	test   %eax,%eax
+  801d03:	0f 88 04 01 00 00    	js     801e0d <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801d09:	83 ec 0c             	sub    $0xc,%esp
+  801d0c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d0f:	50                   	push   %eax
+  801d10:	e8 be f1 ff ff       	call   800ed3 <fd_alloc>
+  801d15:	89 c3                	mov    %eax,%ebx
+  801d17:	83 c4 10             	add    $0x10,%esp
+  801d1a:	85 c0                	test   %eax,%eax
+  801d1c:	0f 88 db 00 00 00    	js     801dfd <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801d22:	83 ec 04             	sub    $0x4,%esp
+  801d25:	68 07 04 00 00       	push   $0x407
+  801d2a:	ff 75 f0             	push   -0x10(%ebp)
+  801d2d:	6a 00                	push   $0x0
+  801d2f:	e8 a5 ee ff ff       	call   800bd9 <sys_page_alloc>
+  801d34:	89 c3                	mov    %eax,%ebx
+  801d36:	83 c4 10             	add    $0x10,%esp
+  801d39:	85 c0                	test   %eax,%eax
+  801d3b:	0f 88 bc 00 00 00    	js     801dfd <pipe+0x131>
+	va = fd2data(fd0);
+  801d41:	83 ec 0c             	sub    $0xc,%esp
+  801d44:	ff 75 f4             	push   -0xc(%ebp)
+  801d47:	e8 70 f1 ff ff       	call   800ebc <fd2data>
+  801d4c:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801d4e:	83 c4 0c             	add    $0xc,%esp
+  801d51:	68 07 04 00 00       	push   $0x407
+  801d56:	50                   	push   %eax
+  801d57:	6a 00                	push   $0x0
+  801d59:	e8 7b ee ff ff       	call   800bd9 <sys_page_alloc>
+  801d5e:	89 c3                	mov    %eax,%ebx
+  801d60:	83 c4 10             	add    $0x10,%esp
+  801d63:	85 c0                	test   %eax,%eax
+  801d65:	0f 88 82 00 00 00    	js     801ded <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801d6b:	83 ec 0c             	sub    $0xc,%esp
+  801d6e:	ff 75 f0             	push   -0x10(%ebp)
+  801d71:	e8 46 f1 ff ff       	call   800ebc <fd2data>
+  801d76:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801d7d:	50                   	push   %eax
+  801d7e:	6a 00                	push   $0x0
+  801d80:	56                   	push   %esi
+  801d81:	6a 00                	push   $0x0
+  801d83:	e8 94 ee ff ff       	call   800c1c <sys_page_map>
+  801d88:	89 c3                	mov    %eax,%ebx
+  801d8a:	83 c4 20             	add    $0x20,%esp
+  801d8d:	85 c0                	test   %eax,%eax
+  801d8f:	78 4e                	js     801ddf <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  801d91:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  801d96:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801d99:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  801d9b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801d9e:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  801da5:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801da8:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  801daa:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801dad:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  801db4:	83 ec 0c             	sub    $0xc,%esp
+  801db7:	ff 75 f4             	push   -0xc(%ebp)
+  801dba:	e8 ed f0 ff ff       	call   800eac <fd2num>
+  801dbf:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801dc2:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  801dc4:	83 c4 04             	add    $0x4,%esp
+  801dc7:	ff 75 f0             	push   -0x10(%ebp)
+  801dca:	e8 dd f0 ff ff       	call   800eac <fd2num>
+  801dcf:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801dd2:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  801dd5:	83 c4 10             	add    $0x10,%esp
+  801dd8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ddd:	eb 2e                	jmp    801e0d <pipe+0x141>
+	sys_page_unmap(0, va);
+  801ddf:	83 ec 08             	sub    $0x8,%esp
+  801de2:	56                   	push   %esi
+  801de3:	6a 00                	push   $0x0
+  801de5:	e8 74 ee ff ff       	call   800c5e <sys_page_unmap>
+  801dea:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  801ded:	83 ec 08             	sub    $0x8,%esp
+  801df0:	ff 75 f0             	push   -0x10(%ebp)
+  801df3:	6a 00                	push   $0x0
+  801df5:	e8 64 ee ff ff       	call   800c5e <sys_page_unmap>
+  801dfa:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  801dfd:	83 ec 08             	sub    $0x8,%esp
+  801e00:	ff 75 f4             	push   -0xc(%ebp)
+  801e03:	6a 00                	push   $0x0
+  801e05:	e8 54 ee ff ff       	call   800c5e <sys_page_unmap>
+  801e0a:	83 c4 10             	add    $0x10,%esp
+}
+  801e0d:	89 d8                	mov    %ebx,%eax
+  801e0f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e12:	5b                   	pop    %ebx
+  801e13:	5e                   	pop    %esi
+  801e14:	5d                   	pop    %ebp
+  801e15:	c3                   	ret
+
+00801e16 <pipeisclosed>:
+{
+  801e16:	55                   	push   %ebp
+  801e17:	89 e5                	mov    %esp,%ebp
+  801e19:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801e1c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e1f:	50                   	push   %eax
+  801e20:	ff 75 08             	push   0x8(%ebp)
+  801e23:	e8 01 f1 ff ff       	call   800f29 <fd_lookup>
+  801e28:	83 c4 10             	add    $0x10,%esp
+  801e2b:	85 c0                	test   %eax,%eax
+  801e2d:	78 18                	js     801e47 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  801e2f:	83 ec 0c             	sub    $0xc,%esp
+  801e32:	ff 75 f4             	push   -0xc(%ebp)
+  801e35:	e8 82 f0 ff ff       	call   800ebc <fd2data>
+  801e3a:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  801e3c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e3f:	e8 33 fd ff ff       	call   801b77 <_pipeisclosed>
+  801e44:	83 c4 10             	add    $0x10,%esp
+}
+  801e47:	c9                   	leave
+  801e48:	c3                   	ret
+
+00801e49 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  801e49:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e4e:	c3                   	ret
+
+00801e4f <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  801e4f:	55                   	push   %ebp
+  801e50:	89 e5                	mov    %esp,%ebp
+  801e52:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  801e55:	68 6b 2a 80 00       	push   $0x802a6b
+  801e5a:	ff 75 0c             	push   0xc(%ebp)
+  801e5d:	e8 8b e9 ff ff       	call   8007ed <strcpy>
+	return 0;
+}
+  801e62:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e67:	c9                   	leave
+  801e68:	c3                   	ret
+
+00801e69 <devcons_write>:
+{
+  801e69:	55                   	push   %ebp
+  801e6a:	89 e5                	mov    %esp,%ebp
+  801e6c:	57                   	push   %edi
+  801e6d:	56                   	push   %esi
+  801e6e:	53                   	push   %ebx
+  801e6f:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  801e75:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  801e7a:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  801e80:	eb 2e                	jmp    801eb0 <devcons_write+0x47>
+		m = n - tot;
+  801e82:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801e85:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  801e87:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801e8c:	39 c3                	cmp    %eax,%ebx
+  801e8e:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  801e91:	83 ec 04             	sub    $0x4,%esp
+  801e94:	53                   	push   %ebx
+  801e95:	89 f0                	mov    %esi,%eax
+  801e97:	03 45 0c             	add    0xc(%ebp),%eax
+  801e9a:	50                   	push   %eax
+  801e9b:	57                   	push   %edi
+  801e9c:	e8 d2 ea ff ff       	call   800973 <memmove>
+		sys_cputs(buf, m);
+  801ea1:	83 c4 08             	add    $0x8,%esp
+  801ea4:	53                   	push   %ebx
+  801ea5:	57                   	push   %edi
+  801ea6:	e8 72 ec ff ff       	call   800b1d <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  801eab:	01 de                	add    %ebx,%esi
+  801ead:	83 c4 10             	add    $0x10,%esp
+  801eb0:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801eb3:	72 cd                	jb     801e82 <devcons_write+0x19>
+}
+  801eb5:	89 f0                	mov    %esi,%eax
+  801eb7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801eba:	5b                   	pop    %ebx
+  801ebb:	5e                   	pop    %esi
+  801ebc:	5f                   	pop    %edi
+  801ebd:	5d                   	pop    %ebp
+  801ebe:	c3                   	ret
+
+00801ebf <devcons_read>:
+{
+  801ebf:	55                   	push   %ebp
+  801ec0:	89 e5                	mov    %esp,%ebp
+  801ec2:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  801ec5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eca:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801ece:	75 07                	jne    801ed7 <devcons_read+0x18>
+  801ed0:	eb 1f                	jmp    801ef1 <devcons_read+0x32>
+		sys_yield();
+  801ed2:	e8 e3 ec ff ff       	call   800bba <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  801ed7:	e8 5f ec ff ff       	call   800b3b <sys_cgetc>
+  801edc:	85 c0                	test   %eax,%eax
+  801ede:	74 f2                	je     801ed2 <devcons_read+0x13>
+	if (c < 0)
+  801ee0:	78 0f                	js     801ef1 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  801ee2:	83 f8 04             	cmp    $0x4,%eax
+  801ee5:	74 0c                	je     801ef3 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  801ee7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801eea:	88 02                	mov    %al,(%edx)
+	return 1;
+  801eec:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  801ef1:	c9                   	leave
+  801ef2:	c3                   	ret
+		return 0;
+  801ef3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ef8:	eb f7                	jmp    801ef1 <devcons_read+0x32>
+
+00801efa <cputchar>:
+{
+  801efa:	55                   	push   %ebp
+  801efb:	89 e5                	mov    %esp,%ebp
+  801efd:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  801f00:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f03:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  801f06:	6a 01                	push   $0x1
+  801f08:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801f0b:	50                   	push   %eax
+  801f0c:	e8 0c ec ff ff       	call   800b1d <sys_cputs>
+}
+  801f11:	83 c4 10             	add    $0x10,%esp
+  801f14:	c9                   	leave
+  801f15:	c3                   	ret
+
+00801f16 <getchar>:
+{
+  801f16:	55                   	push   %ebp
+  801f17:	89 e5                	mov    %esp,%ebp
+  801f19:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  801f1c:	6a 01                	push   $0x1
+  801f1e:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801f21:	50                   	push   %eax
+  801f22:	6a 00                	push   $0x0
+  801f24:	e8 66 f2 ff ff       	call   80118f <read>
+	if (r < 0)
+  801f29:	83 c4 10             	add    $0x10,%esp
+  801f2c:	85 c0                	test   %eax,%eax
+  801f2e:	78 06                	js     801f36 <getchar+0x20>
+	if (r < 1)
+  801f30:	74 06                	je     801f38 <getchar+0x22>
+	return c;
+  801f32:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  801f36:	c9                   	leave
+  801f37:	c3                   	ret
+		return -E_EOF;
+  801f38:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  801f3d:	eb f7                	jmp    801f36 <getchar+0x20>
+
+00801f3f <iscons>:
+{
+  801f3f:	55                   	push   %ebp
+  801f40:	89 e5                	mov    %esp,%ebp
+  801f42:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801f45:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f48:	50                   	push   %eax
+  801f49:	ff 75 08             	push   0x8(%ebp)
+  801f4c:	e8 d8 ef ff ff       	call   800f29 <fd_lookup>
+  801f51:	83 c4 10             	add    $0x10,%esp
+  801f54:	85 c0                	test   %eax,%eax
+  801f56:	78 11                	js     801f69 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  801f58:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f5b:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  801f61:	39 10                	cmp    %edx,(%eax)
+  801f63:	0f 94 c0             	sete   %al
+  801f66:	0f b6 c0             	movzbl %al,%eax
+}
+  801f69:	c9                   	leave
+  801f6a:	c3                   	ret
+
+00801f6b <opencons>:
+{
+  801f6b:	55                   	push   %ebp
+  801f6c:	89 e5                	mov    %esp,%ebp
+  801f6e:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  801f71:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f74:	50                   	push   %eax
+  801f75:	e8 59 ef ff ff       	call   800ed3 <fd_alloc>
+  801f7a:	83 c4 10             	add    $0x10,%esp
+  801f7d:	85 c0                	test   %eax,%eax
+  801f7f:	78 3a                	js     801fbb <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  801f81:	83 ec 04             	sub    $0x4,%esp
+  801f84:	68 07 04 00 00       	push   $0x407
+  801f89:	ff 75 f4             	push   -0xc(%ebp)
+  801f8c:	6a 00                	push   $0x0
+  801f8e:	e8 46 ec ff ff       	call   800bd9 <sys_page_alloc>
+  801f93:	83 c4 10             	add    $0x10,%esp
+  801f96:	85 c0                	test   %eax,%eax
+  801f98:	78 21                	js     801fbb <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  801f9a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f9d:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  801fa3:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  801fa5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801fa8:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  801faf:	83 ec 0c             	sub    $0xc,%esp
+  801fb2:	50                   	push   %eax
+  801fb3:	e8 f4 ee ff ff       	call   800eac <fd2num>
+  801fb8:	83 c4 10             	add    $0x10,%esp
+}
+  801fbb:	c9                   	leave
+  801fbc:	c3                   	ret
+
+00801fbd <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  801fbd:	55                   	push   %ebp
+  801fbe:	89 e5                	mov    %esp,%ebp
+  801fc0:	56                   	push   %esi
+  801fc1:	53                   	push   %ebx
+  801fc2:	8b 75 08             	mov    0x8(%ebp),%esi
+  801fc5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fc8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  801fcb:	85 c0                	test   %eax,%eax
+  801fcd:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801fd2:	0f 44 c2             	cmove  %edx,%eax
+  801fd5:	83 ec 0c             	sub    $0xc,%esp
+  801fd8:	50                   	push   %eax
+  801fd9:	e8 ab ed ff ff       	call   800d89 <sys_ipc_recv>
+
+  if (from_env_store)
+  801fde:	83 c4 10             	add    $0x10,%esp
+  801fe1:	85 f6                	test   %esi,%esi
+  801fe3:	74 17                	je     801ffc <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  801fe5:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fea:	85 c0                	test   %eax,%eax
+  801fec:	75 0c                	jne    801ffa <ipc_recv+0x3d>
+  801fee:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801ff4:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  801ffa:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  801ffc:	85 db                	test   %ebx,%ebx
+  801ffe:	74 2b                	je     80202b <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  802000:	85 c0                	test   %eax,%eax
+  802002:	74 0d                	je     802011 <ipc_recv+0x54>
+  802004:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  80200a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80200d:	5b                   	pop    %ebx
+  80200e:	5e                   	pop    %esi
+  80200f:	5d                   	pop    %ebp
+  802010:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  802011:	a1 08 40 80 00       	mov    0x804008,%eax
+  802016:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80201c:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  80201e:	a1 08 40 80 00       	mov    0x804008,%eax
+  802023:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  802029:	eb df                	jmp    80200a <ipc_recv+0x4d>
+  80202b:	85 c0                	test   %eax,%eax
+  80202d:	75 db                	jne    80200a <ipc_recv+0x4d>
+  80202f:	eb ed                	jmp    80201e <ipc_recv+0x61>
+
+00802031 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  802031:	55                   	push   %ebp
+  802032:	89 e5                	mov    %esp,%ebp
+  802034:	57                   	push   %edi
+  802035:	56                   	push   %esi
+  802036:	53                   	push   %ebx
+  802037:	83 ec 0c             	sub    $0xc,%esp
+  80203a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80203d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802040:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  802043:	85 db                	test   %ebx,%ebx
+  802045:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80204a:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  80204d:	ff 75 14             	push   0x14(%ebp)
+  802050:	53                   	push   %ebx
+  802051:	56                   	push   %esi
+  802052:	57                   	push   %edi
+  802053:	e8 0e ed ff ff       	call   800d66 <sys_ipc_try_send>
+  802058:	83 c4 10             	add    $0x10,%esp
+  80205b:	85 c0                	test   %eax,%eax
+  80205d:	74 1e                	je     80207d <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  80205f:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802062:	75 07                	jne    80206b <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  802064:	e8 51 eb ff ff       	call   800bba <sys_yield>
+  802069:	eb e2                	jmp    80204d <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  80206b:	50                   	push   %eax
+  80206c:	68 77 2a 80 00       	push   $0x802a77
+  802071:	6a 3c                	push   $0x3c
+  802073:	68 84 2a 80 00       	push   $0x802a84
+  802078:	e8 dc e0 ff ff       	call   800159 <_panic>
+  }
+
+#endif
+}
+  80207d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802080:	5b                   	pop    %ebx
+  802081:	5e                   	pop    %esi
+  802082:	5f                   	pop    %edi
+  802083:	5d                   	pop    %ebp
+  802084:	c3                   	ret
+
+00802085 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  802085:	55                   	push   %ebp
+  802086:	89 e5                	mov    %esp,%ebp
+  802088:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  80208b:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  802090:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802093:	c1 e0 04             	shl    $0x4,%eax
+  802096:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80209b:	8b 40 50             	mov    0x50(%eax),%eax
+  80209e:	39 c8                	cmp    %ecx,%eax
+  8020a0:	74 12                	je     8020b4 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  8020a2:	83 c2 01             	add    $0x1,%edx
+  8020a5:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8020ab:	75 e3                	jne    802090 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  8020ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020b2:	eb 0e                	jmp    8020c2 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  8020b4:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8020b7:	c1 e0 04             	shl    $0x4,%eax
+  8020ba:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8020bf:	8b 40 48             	mov    0x48(%eax),%eax
+  8020c2:	5d                   	pop    %ebp
+  8020c3:	c3                   	ret
+
+008020c4 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8020c4:	55                   	push   %ebp
+  8020c5:	89 e5                	mov    %esp,%ebp
+  8020c7:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8020ca:	89 c2                	mov    %eax,%edx
+  8020cc:	c1 ea 16             	shr    $0x16,%edx
+  8020cf:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8020d6:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8020db:	f6 c1 01             	test   $0x1,%cl
+  8020de:	74 1c                	je     8020fc <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  8020e0:	c1 e8 0c             	shr    $0xc,%eax
+  8020e3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8020ea:	a8 01                	test   $0x1,%al
+  8020ec:	74 0e                	je     8020fc <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8020ee:	c1 e8 0c             	shr    $0xc,%eax
+  8020f1:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  8020f8:	ef 
+  8020f9:	0f b7 d2             	movzwl %dx,%edx
+}
+  8020fc:	89 d0                	mov    %edx,%eax
+  8020fe:	5d                   	pop    %ebp
+  8020ff:	c3                   	ret
+
+00802100 <__udivmoddi4>:
+  802100:	55                   	push   %ebp
+  802101:	57                   	push   %edi
+  802102:	56                   	push   %esi
+  802103:	53                   	push   %ebx
+  802104:	83 ec 24             	sub    $0x24,%esp
+  802107:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80210b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80210f:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  802113:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802117:	8b 54 24 44          	mov    0x44(%esp),%edx
+  80211b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80211f:	8b 44 24 40          	mov    0x40(%esp),%eax
+  802123:	89 d3                	mov    %edx,%ebx
+  802125:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802129:	09 c3                	or     %eax,%ebx
+  80212b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80212f:	0f 84 9c 00 00 00    	je     8021d1 <__udivmoddi4+0xd1>
+  802135:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80213c:	00 
+  80213d:	31 c0                	xor    %eax,%eax
+  80213f:	31 d2                	xor    %edx,%edx
+  802141:	89 fb                	mov    %edi,%ebx
+  802143:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80214a:	00 
+  80214b:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802150:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802154:	01 c0                	add    %eax,%eax
+  802156:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80215d:	00 
+  80215e:	89 c6                	mov    %eax,%esi
+  802160:	89 d7                	mov    %edx,%edi
+  802162:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802166:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80216a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80216d:	d3 ea                	shr    %cl,%edx
+  80216f:	f6 c1 20             	test   $0x20,%cl
+  802172:	0f 45 c2             	cmovne %edx,%eax
+  802175:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802179:	83 e0 01             	and    $0x1,%eax
+  80217c:	09 fa                	or     %edi,%edx
+  80217e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802182:	89 04 24             	mov    %eax,(%esp)
+  802185:	8b 04 24             	mov    (%esp),%eax
+  802188:	89 d5                	mov    %edx,%ebp
+  80218a:	09 f0                	or     %esi,%eax
+  80218c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802190:	39 f0                	cmp    %esi,%eax
+  802192:	19 fd                	sbb    %edi,%ebp
+  802194:	72 1d                	jb     8021b3 <__udivmoddi4+0xb3>
+  802196:	29 f0                	sub    %esi,%eax
+  802198:	19 fa                	sbb    %edi,%edx
+  80219a:	89 cf                	mov    %ecx,%edi
+  80219c:	c1 ef 05             	shr    $0x5,%edi
+  80219f:	83 e7 01             	and    $0x1,%edi
+  8021a2:	89 fe                	mov    %edi,%esi
+  8021a4:	d3 e7                	shl    %cl,%edi
+  8021a6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8021aa:	83 f6 01             	xor    $0x1,%esi
+  8021ad:	d3 e6                	shl    %cl,%esi
+  8021af:	09 74 24 18          	or     %esi,0x18(%esp)
+  8021b3:	83 e9 01             	sub    $0x1,%ecx
+  8021b6:	73 98                	jae    802150 <__udivmoddi4+0x50>
+  8021b8:	85 db                	test   %ebx,%ebx
+  8021ba:	74 05                	je     8021c1 <__udivmoddi4+0xc1>
+  8021bc:	89 03                	mov    %eax,(%ebx)
+  8021be:	89 53 04             	mov    %edx,0x4(%ebx)
+  8021c1:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8021c5:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8021c9:	83 c4 24             	add    $0x24,%esp
+  8021cc:	5b                   	pop    %ebx
+  8021cd:	5e                   	pop    %esi
+  8021ce:	5f                   	pop    %edi
+  8021cf:	5d                   	pop    %ebp
+  8021d0:	c3                   	ret
+  8021d1:	85 ff                	test   %edi,%edi
+  8021d3:	74 0d                	je     8021e2 <__udivmoddi4+0xe2>
+  8021d5:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  8021db:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  8021e2:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8021e6:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8021ea:	89 44 24 18          	mov    %eax,0x18(%esp)
+  8021ee:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8021f2:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  8021f6:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8021fa:	83 c4 24             	add    $0x24,%esp
+  8021fd:	5b                   	pop    %ebx
+  8021fe:	5e                   	pop    %esi
+  8021ff:	5f                   	pop    %edi
+  802200:	5d                   	pop    %ebp
+  802201:	c3                   	ret
+  802202:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802209:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00802210 <__udivdi3>:
+  802210:	57                   	push   %edi
+  802211:	56                   	push   %esi
+  802212:	53                   	push   %ebx
+  802213:	83 ec 20             	sub    $0x20,%esp
+  802216:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80221a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80221e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802222:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802226:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80222a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80222e:	89 d1                	mov    %edx,%ecx
+  802230:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802234:	09 c1                	or     %eax,%ecx
+  802236:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80223a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80223e:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  802242:	0f 84 88 00 00 00    	je     8022d0 <__udivdi3+0xc0>
+  802248:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80224f:	00 
+  802250:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802255:	31 c0                	xor    %eax,%eax
+  802257:	31 d2                	xor    %edx,%edx
+  802259:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802260:	00 
+  802261:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802268:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80226c:	01 c0                	add    %eax,%eax
+  80226e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802275:	00 
+  802276:	89 c6                	mov    %eax,%esi
+  802278:	89 d7                	mov    %edx,%edi
+  80227a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80227e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802282:	0f ad d0             	shrd   %cl,%edx,%eax
+  802285:	d3 ea                	shr    %cl,%edx
+  802287:	f6 c1 20             	test   $0x20,%cl
+  80228a:	0f 45 c2             	cmovne %edx,%eax
+  80228d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802291:	83 e0 01             	and    $0x1,%eax
+  802294:	09 fa                	or     %edi,%edx
+  802296:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80229a:	89 04 24             	mov    %eax,(%esp)
+  80229d:	8b 04 24             	mov    (%esp),%eax
+  8022a0:	89 d3                	mov    %edx,%ebx
+  8022a2:	09 f0                	or     %esi,%eax
+  8022a4:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8022a8:	39 f0                	cmp    %esi,%eax
+  8022aa:	19 fb                	sbb    %edi,%ebx
+  8022ac:	72 1d                	jb     8022cb <__udivdi3+0xbb>
+  8022ae:	29 f0                	sub    %esi,%eax
+  8022b0:	19 fa                	sbb    %edi,%edx
+  8022b2:	89 cf                	mov    %ecx,%edi
+  8022b4:	c1 ef 05             	shr    $0x5,%edi
+  8022b7:	83 e7 01             	and    $0x1,%edi
+  8022ba:	89 fe                	mov    %edi,%esi
+  8022bc:	d3 e7                	shl    %cl,%edi
+  8022be:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8022c2:	83 f6 01             	xor    $0x1,%esi
+  8022c5:	d3 e6                	shl    %cl,%esi
+  8022c7:	09 74 24 18          	or     %esi,0x18(%esp)
+  8022cb:	83 e9 01             	sub    $0x1,%ecx
+  8022ce:	73 98                	jae    802268 <__udivdi3+0x58>
+  8022d0:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8022d4:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8022d8:	83 c4 20             	add    $0x20,%esp
+  8022db:	5b                   	pop    %ebx
+  8022dc:	5e                   	pop    %esi
+  8022dd:	5f                   	pop    %edi
+  8022de:	c3                   	ret
+  8022df:	90                   	nop
+
+008022e0 <__umoddi3>:
+  8022e0:	57                   	push   %edi
+  8022e1:	56                   	push   %esi
+  8022e2:	53                   	push   %ebx
+  8022e3:	83 ec 18             	sub    $0x18,%esp
+  8022e6:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8022ea:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8022ee:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8022f2:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8022f6:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8022fa:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8022fe:	89 d1                	mov    %edx,%ecx
+  802300:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802304:	09 c1                	or     %eax,%ecx
+  802306:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80230a:	74 5b                	je     802367 <__umoddi3+0x87>
+  80230c:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802311:	31 c0                	xor    %eax,%eax
+  802313:	31 d2                	xor    %edx,%edx
+  802315:	8d 76 00             	lea    0x0(%esi),%esi
+  802318:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80231c:	01 c0                	add    %eax,%eax
+  80231e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802325:	00 
+  802326:	89 c6                	mov    %eax,%esi
+  802328:	89 d7                	mov    %edx,%edi
+  80232a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80232e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802332:	0f ad d0             	shrd   %cl,%edx,%eax
+  802335:	d3 ea                	shr    %cl,%edx
+  802337:	f6 c1 20             	test   $0x20,%cl
+  80233a:	0f 45 c2             	cmovne %edx,%eax
+  80233d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802341:	83 e0 01             	and    $0x1,%eax
+  802344:	09 fa                	or     %edi,%edx
+  802346:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80234a:	89 04 24             	mov    %eax,(%esp)
+  80234d:	8b 04 24             	mov    (%esp),%eax
+  802350:	89 d3                	mov    %edx,%ebx
+  802352:	09 f0                	or     %esi,%eax
+  802354:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802358:	39 f0                	cmp    %esi,%eax
+  80235a:	19 fb                	sbb    %edi,%ebx
+  80235c:	72 04                	jb     802362 <__umoddi3+0x82>
+  80235e:	29 f0                	sub    %esi,%eax
+  802360:	19 fa                	sbb    %edi,%edx
+  802362:	83 e9 01             	sub    $0x1,%ecx
+  802365:	73 b1                	jae    802318 <__umoddi3+0x38>
+  802367:	83 c4 18             	add    $0x18,%esp
+  80236a:	5b                   	pop    %ebx
+  80236b:	5e                   	pop    %esi
+  80236c:	5f                   	pop    %edi
+  80236d:	c3                   	ret
+  80236e:	66 90                	xchg   %ax,%ax
+
+00802370 <__divdi3>:
+  802370:	55                   	push   %ebp
+  802371:	57                   	push   %edi
+  802372:	56                   	push   %esi
+  802373:	53                   	push   %ebx
+  802374:	83 ec 24             	sub    $0x24,%esp
+  802377:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  80237b:	8b 74 24 44          	mov    0x44(%esp),%esi
+  80237f:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802383:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802387:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  80238b:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  80238f:	85 d2                	test   %edx,%edx
+  802391:	0f 88 e0 00 00 00    	js     802477 <__divdi3+0x107>
+  802397:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  80239b:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  80239f:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8023a3:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8023a7:	85 f6                	test   %esi,%esi
+  8023a9:	78 16                	js     8023c1 <__divdi3+0x51>
+  8023ab:	89 f1                	mov    %esi,%ecx
+  8023ad:	31 c0                	xor    %eax,%eax
+  8023af:	31 d2                	xor    %edx,%edx
+  8023b1:	09 d9                	or     %ebx,%ecx
+  8023b3:	0f 85 f3 00 00 00    	jne    8024ac <__divdi3+0x13c>
+  8023b9:	83 c4 24             	add    $0x24,%esp
+  8023bc:	5b                   	pop    %ebx
+  8023bd:	5e                   	pop    %esi
+  8023be:	5f                   	pop    %edi
+  8023bf:	5d                   	pop    %ebp
+  8023c0:	c3                   	ret
+  8023c1:	bf 01 00 00 00       	mov    $0x1,%edi
+  8023c6:	f7 5c 24 08          	negl   0x8(%esp)
+  8023ca:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  8023cf:	f7 5c 24 0c          	negl   0xc(%esp)
+  8023d3:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8023da:	00 
+  8023db:	31 c0                	xor    %eax,%eax
+  8023dd:	31 d2                	xor    %edx,%edx
+  8023df:	89 fb                	mov    %edi,%ebx
+  8023e1:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8023e8:	00 
+  8023e9:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8023ee:	66 90                	xchg   %ax,%ax
+  8023f0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8023f4:	01 c0                	add    %eax,%eax
+  8023f6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8023fd:	00 
+  8023fe:	89 c6                	mov    %eax,%esi
+  802400:	89 d7                	mov    %edx,%edi
+  802402:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802406:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80240a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80240d:	d3 ea                	shr    %cl,%edx
+  80240f:	f6 c1 20             	test   $0x20,%cl
+  802412:	0f 45 c2             	cmovne %edx,%eax
+  802415:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802419:	83 e0 01             	and    $0x1,%eax
+  80241c:	09 fa                	or     %edi,%edx
+  80241e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802422:	89 04 24             	mov    %eax,(%esp)
+  802425:	8b 04 24             	mov    (%esp),%eax
+  802428:	89 d5                	mov    %edx,%ebp
+  80242a:	09 f0                	or     %esi,%eax
+  80242c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802430:	39 f0                	cmp    %esi,%eax
+  802432:	19 fd                	sbb    %edi,%ebp
+  802434:	72 1d                	jb     802453 <__divdi3+0xe3>
+  802436:	29 f0                	sub    %esi,%eax
+  802438:	19 fa                	sbb    %edi,%edx
+  80243a:	89 cf                	mov    %ecx,%edi
+  80243c:	c1 ef 05             	shr    $0x5,%edi
+  80243f:	83 e7 01             	and    $0x1,%edi
+  802442:	89 fe                	mov    %edi,%esi
+  802444:	d3 e7                	shl    %cl,%edi
+  802446:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80244a:	83 f6 01             	xor    $0x1,%esi
+  80244d:	d3 e6                	shl    %cl,%esi
+  80244f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802453:	83 e9 01             	sub    $0x1,%ecx
+  802456:	73 98                	jae    8023f0 <__divdi3+0x80>
+  802458:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80245c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802460:	85 db                	test   %ebx,%ebx
+  802462:	0f 84 51 ff ff ff    	je     8023b9 <__divdi3+0x49>
+  802468:	f7 d8                	neg    %eax
+  80246a:	83 d2 00             	adc    $0x0,%edx
+  80246d:	83 c4 24             	add    $0x24,%esp
+  802470:	5b                   	pop    %ebx
+  802471:	f7 da                	neg    %edx
+  802473:	5e                   	pop    %esi
+  802474:	5f                   	pop    %edi
+  802475:	5d                   	pop    %ebp
+  802476:	c3                   	ret
+  802477:	f7 d8                	neg    %eax
+  802479:	83 d2 00             	adc    $0x0,%edx
+  80247c:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802480:	f7 da                	neg    %edx
+  802482:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802486:	85 f6                	test   %esi,%esi
+  802488:	78 1b                	js     8024a5 <__divdi3+0x135>
+  80248a:	89 f1                	mov    %esi,%ecx
+  80248c:	31 c0                	xor    %eax,%eax
+  80248e:	31 d2                	xor    %edx,%edx
+  802490:	bf 01 00 00 00       	mov    $0x1,%edi
+  802495:	09 d9                	or     %ebx,%ecx
+  802497:	0f 85 36 ff ff ff    	jne    8023d3 <__divdi3+0x63>
+  80249d:	83 c4 24             	add    $0x24,%esp
+  8024a0:	5b                   	pop    %ebx
+  8024a1:	5e                   	pop    %esi
+  8024a2:	5f                   	pop    %edi
+  8024a3:	5d                   	pop    %ebp
+  8024a4:	c3                   	ret
+  8024a5:	31 ff                	xor    %edi,%edi
+  8024a7:	e9 1a ff ff ff       	jmp    8023c6 <__divdi3+0x56>
+  8024ac:	31 ff                	xor    %edi,%edi
+  8024ae:	e9 20 ff ff ff       	jmp    8023d3 <__divdi3+0x63>
+  8024b3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8024ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+008024c0 <__moddi3>:
+  8024c0:	55                   	push   %ebp
+  8024c1:	57                   	push   %edi
+  8024c2:	56                   	push   %esi
+  8024c3:	53                   	push   %ebx
+  8024c4:	83 ec 1c             	sub    $0x1c,%esp
+  8024c7:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  8024cb:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  8024cf:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  8024d3:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  8024d7:	89 c8                	mov    %ecx,%eax
+  8024d9:	89 f2                	mov    %esi,%edx
+  8024db:	89 f3                	mov    %esi,%ebx
+  8024dd:	85 ed                	test   %ebp,%ebp
+  8024df:	0f 88 9d 00 00 00    	js     802582 <__moddi3+0xc2>
+  8024e5:	09 cb                	or     %ecx,%ebx
+  8024e7:	0f 84 8d 00 00 00    	je     80257a <__moddi3+0xba>
+  8024ed:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  8024f1:	31 db                	xor    %ebx,%ebx
+  8024f3:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  8024f7:	89 ca                	mov    %ecx,%edx
+  8024f9:	89 f0                	mov    %esi,%eax
+  8024fb:	89 dd                	mov    %ebx,%ebp
+  8024fd:	f7 da                	neg    %edx
+  8024ff:	83 d0 00             	adc    $0x0,%eax
+  802502:	f7 d8                	neg    %eax
+  802504:	0f 49 f0             	cmovns %eax,%esi
+  802507:	0f 49 ca             	cmovns %edx,%ecx
+  80250a:	31 c0                	xor    %eax,%eax
+  80250c:	31 d2                	xor    %edx,%edx
+  80250e:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  802512:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802516:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80251b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80251f:	90                   	nop
+  802520:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802524:	01 c0                	add    %eax,%eax
+  802526:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80252d:	00 
+  80252e:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  802532:	89 c6                	mov    %eax,%esi
+  802534:	89 d7                	mov    %edx,%edi
+  802536:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80253a:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80253e:	0f ad d0             	shrd   %cl,%edx,%eax
+  802541:	d3 ea                	shr    %cl,%edx
+  802543:	f6 c1 20             	test   $0x20,%cl
+  802546:	0f 45 c2             	cmovne %edx,%eax
+  802549:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80254d:	83 e0 01             	and    $0x1,%eax
+  802550:	09 fa                	or     %edi,%edx
+  802552:	89 04 24             	mov    %eax,(%esp)
+  802555:	8b 04 24             	mov    (%esp),%eax
+  802558:	89 d7                	mov    %edx,%edi
+  80255a:	09 f0                	or     %esi,%eax
+  80255c:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  802560:	39 d8                	cmp    %ebx,%eax
+  802562:	19 f7                	sbb    %esi,%edi
+  802564:	72 04                	jb     80256a <__moddi3+0xaa>
+  802566:	29 d8                	sub    %ebx,%eax
+  802568:	19 f2                	sbb    %esi,%edx
+  80256a:	83 e9 01             	sub    $0x1,%ecx
+  80256d:	73 b1                	jae    802520 <__moddi3+0x60>
+  80256f:	85 ed                	test   %ebp,%ebp
+  802571:	74 07                	je     80257a <__moddi3+0xba>
+  802573:	f7 d8                	neg    %eax
+  802575:	83 d2 00             	adc    $0x0,%edx
+  802578:	f7 da                	neg    %edx
+  80257a:	83 c4 1c             	add    $0x1c,%esp
+  80257d:	5b                   	pop    %ebx
+  80257e:	5e                   	pop    %esi
+  80257f:	5f                   	pop    %edi
+  802580:	5d                   	pop    %ebp
+  802581:	c3                   	ret
+  802582:	09 cb                	or     %ecx,%ebx
+  802584:	74 f4                	je     80257a <__moddi3+0xba>
+  802586:	f7 df                	neg    %edi
+  802588:	bb 01 00 00 00       	mov    $0x1,%ebx
+  80258d:	83 d5 00             	adc    $0x0,%ebp
+  802590:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802594:	f7 dd                	neg    %ebp
+  802596:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  80259a:	e9 58 ff ff ff       	jmp    8024f7 <__moddi3+0x37>
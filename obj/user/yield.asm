@@ -0,0 +1,5294 @@
+
+obj/user/yield.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 69 00 00 00       	call   80009a <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 0c             	sub    $0xc,%esp
+	int i;
+
+	cprintf("Hello, I am environment %08x.\n", thisenv->env_id);
+  80003a:	a1 08 40 80 00       	mov    0x804008,%eax
+  80003f:	8b 40 48             	mov    0x48(%eax),%eax
+  800042:	50                   	push   %eax
+  800043:	68 60 25 80 00       	push   $0x802560
+  800048:	e8 45 01 00 00       	call   800192 <cprintf>
+  80004d:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < 5; i++) {
+  800050:	bb 00 00 00 00       	mov    $0x0,%ebx
+		sys_yield();
+  800055:	e8 be 0a 00 00       	call   800b18 <sys_yield>
+		cprintf("Back in environment %08x, iteration %d.\n",
+			thisenv->env_id, i);
+  80005a:	a1 08 40 80 00       	mov    0x804008,%eax
+  80005f:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("Back in environment %08x, iteration %d.\n",
+  800062:	83 ec 04             	sub    $0x4,%esp
+  800065:	53                   	push   %ebx
+  800066:	50                   	push   %eax
+  800067:	68 80 25 80 00       	push   $0x802580
+  80006c:	e8 21 01 00 00       	call   800192 <cprintf>
+	for (i = 0; i < 5; i++) {
+  800071:	83 c3 01             	add    $0x1,%ebx
+  800074:	83 c4 10             	add    $0x10,%esp
+  800077:	83 fb 05             	cmp    $0x5,%ebx
+  80007a:	75 d9                	jne    800055 <umain+0x22>
+	}
+	cprintf("All done in environment %08x.\n", thisenv->env_id);
+  80007c:	a1 08 40 80 00       	mov    0x804008,%eax
+  800081:	8b 40 48             	mov    0x48(%eax),%eax
+  800084:	83 ec 08             	sub    $0x8,%esp
+  800087:	50                   	push   %eax
+  800088:	68 ac 25 80 00       	push   $0x8025ac
+  80008d:	e8 00 01 00 00       	call   800192 <cprintf>
+}
+  800092:	83 c4 10             	add    $0x10,%esp
+  800095:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800098:	c9                   	leave
+  800099:	c3                   	ret
+
+0080009a <libmain>:
+
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv) {
+  80009a:	55                   	push   %ebp
+  80009b:	89 e5                	mov    %esp,%ebp
+  80009d:	56                   	push   %esi
+  80009e:	53                   	push   %ebx
+  80009f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000a2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+  8000a5:	e8 4f 0a 00 00       	call   800af9 <sys_getenvid>
+  8000aa:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000af:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8000b2:	c1 e0 04             	shl    $0x4,%eax
+  8000b5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000ba:	a3 08 40 80 00       	mov    %eax,0x804008
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8000bf:	85 db                	test   %ebx,%ebx
+  8000c1:	7e 07                	jle    8000ca <libmain+0x30>
+    binaryname = argv[0];
+  8000c3:	8b 06                	mov    (%esi),%eax
+  8000c5:	a3 00 30 80 00       	mov    %eax,0x803000
+
+  // call user main routine
+  umain(argc, argv);
+  8000ca:	83 ec 08             	sub    $0x8,%esp
+  8000cd:	56                   	push   %esi
+  8000ce:	53                   	push   %ebx
+  8000cf:	e8 5f ff ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  8000d4:	e8 0a 00 00 00       	call   8000e3 <exit>
+}
+  8000d9:	83 c4 10             	add    $0x10,%esp
+  8000dc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000df:	5b                   	pop    %ebx
+  8000e0:	5e                   	pop    %esi
+  8000e1:	5d                   	pop    %ebp
+  8000e2:	c3                   	ret
+
+008000e3 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000e3:	55                   	push   %ebp
+  8000e4:	89 e5                	mov    %esp,%ebp
+  8000e6:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8000e9:	e8 f0 0e 00 00       	call   800fde <close_all>
+	sys_env_destroy(0);
+  8000ee:	83 ec 0c             	sub    $0xc,%esp
+  8000f1:	6a 00                	push   $0x0
+  8000f3:	e8 c0 09 00 00       	call   800ab8 <sys_env_destroy>
+}
+  8000f8:	83 c4 10             	add    $0x10,%esp
+  8000fb:	c9                   	leave
+  8000fc:	c3                   	ret
+
+008000fd <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8000fd:	55                   	push   %ebp
+  8000fe:	89 e5                	mov    %esp,%ebp
+  800100:	53                   	push   %ebx
+  800101:	83 ec 04             	sub    $0x4,%esp
+  800104:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800107:	8b 13                	mov    (%ebx),%edx
+  800109:	8d 42 01             	lea    0x1(%edx),%eax
+  80010c:	89 03                	mov    %eax,(%ebx)
+  80010e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800111:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800115:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80011a:	74 09                	je     800125 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80011c:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800120:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800123:	c9                   	leave
+  800124:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800125:	83 ec 08             	sub    $0x8,%esp
+  800128:	68 ff 00 00 00       	push   $0xff
+  80012d:	8d 43 08             	lea    0x8(%ebx),%eax
+  800130:	50                   	push   %eax
+  800131:	e8 45 09 00 00       	call   800a7b <sys_cputs>
+		b->idx = 0;
+  800136:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80013c:	83 c4 10             	add    $0x10,%esp
+  80013f:	eb db                	jmp    80011c <putch+0x1f>
+
+00800141 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800141:	55                   	push   %ebp
+  800142:	89 e5                	mov    %esp,%ebp
+  800144:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80014a:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800151:	00 00 00 
+	b.cnt = 0;
+  800154:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80015b:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80015e:	ff 75 0c             	push   0xc(%ebp)
+  800161:	ff 75 08             	push   0x8(%ebp)
+  800164:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80016a:	50                   	push   %eax
+  80016b:	68 fd 00 80 00       	push   $0x8000fd
+  800170:	e8 14 01 00 00       	call   800289 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800175:	83 c4 08             	add    $0x8,%esp
+  800178:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80017e:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800184:	50                   	push   %eax
+  800185:	e8 f1 08 00 00       	call   800a7b <sys_cputs>
+
+	return b.cnt;
+}
+  80018a:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800190:	c9                   	leave
+  800191:	c3                   	ret
+
+00800192 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800192:	55                   	push   %ebp
+  800193:	89 e5                	mov    %esp,%ebp
+  800195:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800198:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80019b:	50                   	push   %eax
+  80019c:	ff 75 08             	push   0x8(%ebp)
+  80019f:	e8 9d ff ff ff       	call   800141 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8001a4:	c9                   	leave
+  8001a5:	c3                   	ret
+
+008001a6 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8001a6:	55                   	push   %ebp
+  8001a7:	89 e5                	mov    %esp,%ebp
+  8001a9:	57                   	push   %edi
+  8001aa:	56                   	push   %esi
+  8001ab:	53                   	push   %ebx
+  8001ac:	83 ec 1c             	sub    $0x1c,%esp
+  8001af:	89 c7                	mov    %eax,%edi
+  8001b1:	89 d6                	mov    %edx,%esi
+  8001b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001b6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001b9:	89 d1                	mov    %edx,%ecx
+  8001bb:	89 c2                	mov    %eax,%edx
+  8001bd:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001c0:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001c3:	8b 45 10             	mov    0x10(%ebp),%eax
+  8001c6:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8001c9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001cc:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8001d3:	39 c2                	cmp    %eax,%edx
+  8001d5:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8001d8:	72 3e                	jb     800218 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8001da:	83 ec 0c             	sub    $0xc,%esp
+  8001dd:	ff 75 18             	push   0x18(%ebp)
+  8001e0:	83 eb 01             	sub    $0x1,%ebx
+  8001e3:	53                   	push   %ebx
+  8001e4:	50                   	push   %eax
+  8001e5:	83 ec 08             	sub    $0x8,%esp
+  8001e8:	ff 75 e4             	push   -0x1c(%ebp)
+  8001eb:	ff 75 e0             	push   -0x20(%ebp)
+  8001ee:	ff 75 dc             	push   -0x24(%ebp)
+  8001f1:	ff 75 d8             	push   -0x28(%ebp)
+  8001f4:	e8 c7 1f 00 00       	call   8021c0 <__udivdi3>
+  8001f9:	83 c4 18             	add    $0x18,%esp
+  8001fc:	52                   	push   %edx
+  8001fd:	50                   	push   %eax
+  8001fe:	89 f2                	mov    %esi,%edx
+  800200:	89 f8                	mov    %edi,%eax
+  800202:	e8 9f ff ff ff       	call   8001a6 <printnum>
+  800207:	83 c4 20             	add    $0x20,%esp
+  80020a:	eb 13                	jmp    80021f <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80020c:	83 ec 08             	sub    $0x8,%esp
+  80020f:	56                   	push   %esi
+  800210:	ff 75 18             	push   0x18(%ebp)
+  800213:	ff d7                	call   *%edi
+  800215:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800218:	83 eb 01             	sub    $0x1,%ebx
+  80021b:	85 db                	test   %ebx,%ebx
+  80021d:	7f ed                	jg     80020c <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80021f:	83 ec 08             	sub    $0x8,%esp
+  800222:	56                   	push   %esi
+  800223:	83 ec 04             	sub    $0x4,%esp
+  800226:	ff 75 e4             	push   -0x1c(%ebp)
+  800229:	ff 75 e0             	push   -0x20(%ebp)
+  80022c:	ff 75 dc             	push   -0x24(%ebp)
+  80022f:	ff 75 d8             	push   -0x28(%ebp)
+  800232:	e8 59 20 00 00       	call   802290 <__umoddi3>
+  800237:	83 c4 14             	add    $0x14,%esp
+  80023a:	0f be 80 d5 25 80 00 	movsbl 0x8025d5(%eax),%eax
+  800241:	50                   	push   %eax
+  800242:	ff d7                	call   *%edi
+}
+  800244:	83 c4 10             	add    $0x10,%esp
+  800247:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80024a:	5b                   	pop    %ebx
+  80024b:	5e                   	pop    %esi
+  80024c:	5f                   	pop    %edi
+  80024d:	5d                   	pop    %ebp
+  80024e:	c3                   	ret
+
+0080024f <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80024f:	55                   	push   %ebp
+  800250:	89 e5                	mov    %esp,%ebp
+  800252:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800255:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800259:	8b 10                	mov    (%eax),%edx
+  80025b:	3b 50 04             	cmp    0x4(%eax),%edx
+  80025e:	73 0a                	jae    80026a <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800260:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800263:	89 08                	mov    %ecx,(%eax)
+  800265:	8b 45 08             	mov    0x8(%ebp),%eax
+  800268:	88 02                	mov    %al,(%edx)
+}
+  80026a:	5d                   	pop    %ebp
+  80026b:	c3                   	ret
+
+0080026c <printfmt>:
+{
+  80026c:	55                   	push   %ebp
+  80026d:	89 e5                	mov    %esp,%ebp
+  80026f:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800272:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800275:	50                   	push   %eax
+  800276:	ff 75 10             	push   0x10(%ebp)
+  800279:	ff 75 0c             	push   0xc(%ebp)
+  80027c:	ff 75 08             	push   0x8(%ebp)
+  80027f:	e8 05 00 00 00       	call   800289 <vprintfmt>
+}
+  800284:	83 c4 10             	add    $0x10,%esp
+  800287:	c9                   	leave
+  800288:	c3                   	ret
+
+00800289 <vprintfmt>:
+{
+  800289:	55                   	push   %ebp
+  80028a:	89 e5                	mov    %esp,%ebp
+  80028c:	57                   	push   %edi
+  80028d:	56                   	push   %esi
+  80028e:	53                   	push   %ebx
+  80028f:	83 ec 2c             	sub    $0x2c,%esp
+  800292:	8b 75 08             	mov    0x8(%ebp),%esi
+  800295:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800298:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80029b:	eb 0a                	jmp    8002a7 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80029d:	83 ec 08             	sub    $0x8,%esp
+  8002a0:	53                   	push   %ebx
+  8002a1:	50                   	push   %eax
+  8002a2:	ff d6                	call   *%esi
+  8002a4:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8002a7:	83 c7 01             	add    $0x1,%edi
+  8002aa:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8002ae:	83 f8 25             	cmp    $0x25,%eax
+  8002b1:	74 0c                	je     8002bf <vprintfmt+0x36>
+			if (ch == '\0')
+  8002b3:	85 c0                	test   %eax,%eax
+  8002b5:	75 e6                	jne    80029d <vprintfmt+0x14>
+}
+  8002b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002ba:	5b                   	pop    %ebx
+  8002bb:	5e                   	pop    %esi
+  8002bc:	5f                   	pop    %edi
+  8002bd:	5d                   	pop    %ebp
+  8002be:	c3                   	ret
+		padc = ' ';
+  8002bf:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8002c3:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8002ca:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8002d1:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8002d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8002dd:	8d 47 01             	lea    0x1(%edi),%eax
+  8002e0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8002e3:	0f b6 17             	movzbl (%edi),%edx
+  8002e6:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8002e9:	3c 55                	cmp    $0x55,%al
+  8002eb:	0f 87 9a 03 00 00    	ja     80068b <vprintfmt+0x402>
+  8002f1:	0f b6 c0             	movzbl %al,%eax
+  8002f4:	ff 24 85 20 27 80 00 	jmp    *0x802720(,%eax,4)
+  8002fb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8002fe:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800302:	eb d9                	jmp    8002dd <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800304:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800307:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80030b:	eb d0                	jmp    8002dd <vprintfmt+0x54>
+  80030d:	0f b6 d2             	movzbl %dl,%edx
+  800310:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800313:	b8 00 00 00 00       	mov    $0x0,%eax
+  800318:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80031b:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80031e:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800322:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800325:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800328:	83 f9 09             	cmp    $0x9,%ecx
+  80032b:	77 55                	ja     800382 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  80032d:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800330:	eb e9                	jmp    80031b <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800332:	8b 45 14             	mov    0x14(%ebp),%eax
+  800335:	8b 00                	mov    (%eax),%eax
+  800337:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80033a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80033d:	8d 40 04             	lea    0x4(%eax),%eax
+  800340:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800343:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800346:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80034a:	79 91                	jns    8002dd <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80034c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80034f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800352:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800359:	eb 82                	jmp    8002dd <vprintfmt+0x54>
+			if (width < 0)
+  80035b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80035e:	85 d2                	test   %edx,%edx
+  800360:	b8 00 00 00 00       	mov    $0x0,%eax
+  800365:	0f 49 c2             	cmovns %edx,%eax
+  800368:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80036b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80036e:	e9 6a ff ff ff       	jmp    8002dd <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800373:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800376:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80037d:	e9 5b ff ff ff       	jmp    8002dd <vprintfmt+0x54>
+  800382:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800385:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800388:	eb bc                	jmp    800346 <vprintfmt+0xbd>
+			lflag++;
+  80038a:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80038d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800390:	e9 48 ff ff ff       	jmp    8002dd <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800395:	8b 45 14             	mov    0x14(%ebp),%eax
+  800398:	8d 78 04             	lea    0x4(%eax),%edi
+  80039b:	83 ec 08             	sub    $0x8,%esp
+  80039e:	53                   	push   %ebx
+  80039f:	ff 30                	push   (%eax)
+  8003a1:	ff d6                	call   *%esi
+			break;
+  8003a3:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8003a6:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8003a9:	e9 7c 02 00 00       	jmp    80062a <vprintfmt+0x3a1>
+			err = va_arg(ap, int);
+  8003ae:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003b1:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8003b4:	8b 10                	mov    (%eax),%edx
+  8003b6:	89 d0                	mov    %edx,%eax
+  8003b8:	f7 d8                	neg    %eax
+  8003ba:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8003bd:	83 f8 10             	cmp    $0x10,%eax
+  8003c0:	7f 23                	jg     8003e5 <vprintfmt+0x15c>
+  8003c2:	8b 14 85 80 28 80 00 	mov    0x802880(,%eax,4),%edx
+  8003c9:	85 d2                	test   %edx,%edx
+  8003cb:	74 18                	je     8003e5 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8003cd:	52                   	push   %edx
+  8003ce:	68 b9 29 80 00       	push   $0x8029b9
+  8003d3:	53                   	push   %ebx
+  8003d4:	56                   	push   %esi
+  8003d5:	e8 92 fe ff ff       	call   80026c <printfmt>
+  8003da:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003dd:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8003e0:	e9 45 02 00 00       	jmp    80062a <vprintfmt+0x3a1>
+				printfmt(putch, putdat, "error %d", err);
+  8003e5:	50                   	push   %eax
+  8003e6:	68 ed 25 80 00       	push   $0x8025ed
+  8003eb:	53                   	push   %ebx
+  8003ec:	56                   	push   %esi
+  8003ed:	e8 7a fe ff ff       	call   80026c <printfmt>
+  8003f2:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003f5:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8003f8:	e9 2d 02 00 00       	jmp    80062a <vprintfmt+0x3a1>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8003fd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800400:	83 c0 04             	add    $0x4,%eax
+  800403:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800406:	8b 45 14             	mov    0x14(%ebp),%eax
+  800409:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80040b:	85 c9                	test   %ecx,%ecx
+  80040d:	b8 e6 25 80 00       	mov    $0x8025e6,%eax
+  800412:	0f 45 c1             	cmovne %ecx,%eax
+  800415:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800418:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80041c:	7e 06                	jle    800424 <vprintfmt+0x19b>
+  80041e:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800422:	75 0b                	jne    80042f <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800424:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800427:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80042a:	89 75 08             	mov    %esi,0x8(%ebp)
+  80042d:	eb 5c                	jmp    80048b <vprintfmt+0x202>
+  80042f:	83 ec 08             	sub    $0x8,%esp
+  800432:	ff 75 d0             	push   -0x30(%ebp)
+  800435:	ff 75 cc             	push   -0x34(%ebp)
+  800438:	e8 eb 02 00 00       	call   800728 <strnlen>
+  80043d:	89 c2                	mov    %eax,%edx
+  80043f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800442:	29 d0                	sub    %edx,%eax
+  800444:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800447:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80044b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80044e:	89 75 08             	mov    %esi,0x8(%ebp)
+  800451:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800453:	eb 0e                	jmp    800463 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800455:	83 ec 08             	sub    $0x8,%esp
+  800458:	53                   	push   %ebx
+  800459:	57                   	push   %edi
+  80045a:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80045d:	83 ee 01             	sub    $0x1,%esi
+  800460:	83 c4 10             	add    $0x10,%esp
+  800463:	85 f6                	test   %esi,%esi
+  800465:	7f ee                	jg     800455 <vprintfmt+0x1cc>
+  800467:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80046a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80046d:	85 c0                	test   %eax,%eax
+  80046f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800474:	0f 49 d0             	cmovns %eax,%edx
+  800477:	29 d0                	sub    %edx,%eax
+  800479:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80047c:	eb a6                	jmp    800424 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  80047e:	83 ec 08             	sub    $0x8,%esp
+  800481:	53                   	push   %ebx
+  800482:	52                   	push   %edx
+  800483:	ff 55 08             	call   *0x8(%ebp)
+  800486:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800489:	89 f1                	mov    %esi,%ecx
+  80048b:	8d 71 01             	lea    0x1(%ecx),%esi
+  80048e:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800492:	0f be d0             	movsbl %al,%edx
+  800495:	85 d2                	test   %edx,%edx
+  800497:	74 28                	je     8004c1 <vprintfmt+0x238>
+  800499:	85 ff                	test   %edi,%edi
+  80049b:	78 05                	js     8004a2 <vprintfmt+0x219>
+  80049d:	83 ef 01             	sub    $0x1,%edi
+  8004a0:	78 30                	js     8004d2 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8004a2:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8004a6:	74 d6                	je     80047e <vprintfmt+0x1f5>
+  8004a8:	0f be c0             	movsbl %al,%eax
+  8004ab:	83 e8 20             	sub    $0x20,%eax
+  8004ae:	83 f8 5e             	cmp    $0x5e,%eax
+  8004b1:	76 cb                	jbe    80047e <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8004b3:	83 ec 08             	sub    $0x8,%esp
+  8004b6:	53                   	push   %ebx
+  8004b7:	6a 3f                	push   $0x3f
+  8004b9:	ff 55 08             	call   *0x8(%ebp)
+  8004bc:	83 c4 10             	add    $0x10,%esp
+  8004bf:	eb c8                	jmp    800489 <vprintfmt+0x200>
+  8004c1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004c4:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8004c7:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004ca:	01 d0                	add    %edx,%eax
+  8004cc:	29 c8                	sub    %ecx,%eax
+  8004ce:	89 c7                	mov    %eax,%edi
+  8004d0:	eb 13                	jmp    8004e5 <vprintfmt+0x25c>
+  8004d2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004d5:	eb ed                	jmp    8004c4 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8004d7:	83 ec 08             	sub    $0x8,%esp
+  8004da:	53                   	push   %ebx
+  8004db:	6a 20                	push   $0x20
+  8004dd:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8004df:	83 ef 01             	sub    $0x1,%edi
+  8004e2:	83 c4 10             	add    $0x10,%esp
+  8004e5:	85 ff                	test   %edi,%edi
+  8004e7:	7f ee                	jg     8004d7 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004e9:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8004ec:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004ef:	e9 36 01 00 00       	jmp    80062a <vprintfmt+0x3a1>
+	if (lflag >= 2)
+  8004f4:	83 f9 01             	cmp    $0x1,%ecx
+  8004f7:	7f 1f                	jg     800518 <vprintfmt+0x28f>
+	else if (lflag)
+  8004f9:	85 c9                	test   %ecx,%ecx
+  8004fb:	74 67                	je     800564 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8004fd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800500:	8b 00                	mov    (%eax),%eax
+  800502:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800505:	89 c1                	mov    %eax,%ecx
+  800507:	c1 f9 1f             	sar    $0x1f,%ecx
+  80050a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80050d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800510:	8d 40 04             	lea    0x4(%eax),%eax
+  800513:	89 45 14             	mov    %eax,0x14(%ebp)
+  800516:	eb 17                	jmp    80052f <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800518:	8b 45 14             	mov    0x14(%ebp),%eax
+  80051b:	8b 50 04             	mov    0x4(%eax),%edx
+  80051e:	8b 00                	mov    (%eax),%eax
+  800520:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800523:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800526:	8b 45 14             	mov    0x14(%ebp),%eax
+  800529:	8d 40 08             	lea    0x8(%eax),%eax
+  80052c:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80052f:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800532:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800535:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80053a:	85 c9                	test   %ecx,%ecx
+  80053c:	0f 89 ce 00 00 00    	jns    800610 <vprintfmt+0x387>
+				putch('-', putdat);
+  800542:	83 ec 08             	sub    $0x8,%esp
+  800545:	53                   	push   %ebx
+  800546:	6a 2d                	push   $0x2d
+  800548:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80054a:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80054d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800550:	f7 da                	neg    %edx
+  800552:	83 d1 00             	adc    $0x0,%ecx
+  800555:	f7 d9                	neg    %ecx
+  800557:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80055a:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80055f:	e9 ac 00 00 00       	jmp    800610 <vprintfmt+0x387>
+		return va_arg(*ap, int);
+  800564:	8b 45 14             	mov    0x14(%ebp),%eax
+  800567:	8b 00                	mov    (%eax),%eax
+  800569:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80056c:	89 c1                	mov    %eax,%ecx
+  80056e:	c1 f9 1f             	sar    $0x1f,%ecx
+  800571:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800574:	8b 45 14             	mov    0x14(%ebp),%eax
+  800577:	8d 40 04             	lea    0x4(%eax),%eax
+  80057a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80057d:	eb b0                	jmp    80052f <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  80057f:	83 f9 01             	cmp    $0x1,%ecx
+  800582:	7f 1b                	jg     80059f <vprintfmt+0x316>
+	else if (lflag)
+  800584:	85 c9                	test   %ecx,%ecx
+  800586:	74 2c                	je     8005b4 <vprintfmt+0x32b>
+		return va_arg(*ap, unsigned long);
+  800588:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058b:	8b 10                	mov    (%eax),%edx
+  80058d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800592:	8d 40 04             	lea    0x4(%eax),%eax
+  800595:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800598:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80059d:	eb 71                	jmp    800610 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  80059f:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a2:	8b 10                	mov    (%eax),%edx
+  8005a4:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005a7:	8d 40 08             	lea    0x8(%eax),%eax
+  8005aa:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005ad:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8005b2:	eb 5c                	jmp    800610 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  8005b4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b7:	8b 10                	mov    (%eax),%edx
+  8005b9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005be:	8d 40 04             	lea    0x4(%eax),%eax
+  8005c1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005c4:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8005c9:	eb 45                	jmp    800610 <vprintfmt+0x387>
+			putch('X', putdat);
+  8005cb:	83 ec 08             	sub    $0x8,%esp
+  8005ce:	53                   	push   %ebx
+  8005cf:	6a 58                	push   $0x58
+  8005d1:	ff d6                	call   *%esi
+			putch('X', putdat);
+  8005d3:	83 c4 08             	add    $0x8,%esp
+  8005d6:	53                   	push   %ebx
+  8005d7:	6a 58                	push   $0x58
+  8005d9:	ff d6                	call   *%esi
+			putch('X', putdat);
+  8005db:	83 c4 08             	add    $0x8,%esp
+  8005de:	53                   	push   %ebx
+  8005df:	6a 58                	push   $0x58
+  8005e1:	ff d6                	call   *%esi
+			break;
+  8005e3:	83 c4 10             	add    $0x10,%esp
+  8005e6:	eb 42                	jmp    80062a <vprintfmt+0x3a1>
+			putch('0', putdat);
+  8005e8:	83 ec 08             	sub    $0x8,%esp
+  8005eb:	53                   	push   %ebx
+  8005ec:	6a 30                	push   $0x30
+  8005ee:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8005f0:	83 c4 08             	add    $0x8,%esp
+  8005f3:	53                   	push   %ebx
+  8005f4:	6a 78                	push   $0x78
+  8005f6:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8005f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005fb:	8b 10                	mov    (%eax),%edx
+  8005fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800602:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800605:	8d 40 04             	lea    0x4(%eax),%eax
+  800608:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80060b:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800610:	83 ec 0c             	sub    $0xc,%esp
+  800613:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800617:	50                   	push   %eax
+  800618:	ff 75 e0             	push   -0x20(%ebp)
+  80061b:	57                   	push   %edi
+  80061c:	51                   	push   %ecx
+  80061d:	52                   	push   %edx
+  80061e:	89 da                	mov    %ebx,%edx
+  800620:	89 f0                	mov    %esi,%eax
+  800622:	e8 7f fb ff ff       	call   8001a6 <printnum>
+			break;
+  800627:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80062a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80062d:	e9 75 fc ff ff       	jmp    8002a7 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800632:	83 f9 01             	cmp    $0x1,%ecx
+  800635:	7f 1b                	jg     800652 <vprintfmt+0x3c9>
+	else if (lflag)
+  800637:	85 c9                	test   %ecx,%ecx
+  800639:	74 2c                	je     800667 <vprintfmt+0x3de>
+		return va_arg(*ap, unsigned long);
+  80063b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063e:	8b 10                	mov    (%eax),%edx
+  800640:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800645:	8d 40 04             	lea    0x4(%eax),%eax
+  800648:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80064b:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800650:	eb be                	jmp    800610 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned long long);
+  800652:	8b 45 14             	mov    0x14(%ebp),%eax
+  800655:	8b 10                	mov    (%eax),%edx
+  800657:	8b 48 04             	mov    0x4(%eax),%ecx
+  80065a:	8d 40 08             	lea    0x8(%eax),%eax
+  80065d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800660:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800665:	eb a9                	jmp    800610 <vprintfmt+0x387>
+		return va_arg(*ap, unsigned int);
+  800667:	8b 45 14             	mov    0x14(%ebp),%eax
+  80066a:	8b 10                	mov    (%eax),%edx
+  80066c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800671:	8d 40 04             	lea    0x4(%eax),%eax
+  800674:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800677:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80067c:	eb 92                	jmp    800610 <vprintfmt+0x387>
+			putch(ch, putdat);
+  80067e:	83 ec 08             	sub    $0x8,%esp
+  800681:	53                   	push   %ebx
+  800682:	6a 25                	push   $0x25
+  800684:	ff d6                	call   *%esi
+			break;
+  800686:	83 c4 10             	add    $0x10,%esp
+  800689:	eb 9f                	jmp    80062a <vprintfmt+0x3a1>
+			putch('%', putdat);
+  80068b:	83 ec 08             	sub    $0x8,%esp
+  80068e:	53                   	push   %ebx
+  80068f:	6a 25                	push   $0x25
+  800691:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800693:	83 c4 10             	add    $0x10,%esp
+  800696:	89 f8                	mov    %edi,%eax
+  800698:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80069c:	74 05                	je     8006a3 <vprintfmt+0x41a>
+  80069e:	83 e8 01             	sub    $0x1,%eax
+  8006a1:	eb f5                	jmp    800698 <vprintfmt+0x40f>
+  8006a3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8006a6:	eb 82                	jmp    80062a <vprintfmt+0x3a1>
+
+008006a8 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8006a8:	55                   	push   %ebp
+  8006a9:	89 e5                	mov    %esp,%ebp
+  8006ab:	83 ec 18             	sub    $0x18,%esp
+  8006ae:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006b1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8006b4:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8006b7:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8006bb:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8006be:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8006c5:	85 c0                	test   %eax,%eax
+  8006c7:	74 26                	je     8006ef <vsnprintf+0x47>
+  8006c9:	85 d2                	test   %edx,%edx
+  8006cb:	7e 22                	jle    8006ef <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8006cd:	ff 75 14             	push   0x14(%ebp)
+  8006d0:	ff 75 10             	push   0x10(%ebp)
+  8006d3:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8006d6:	50                   	push   %eax
+  8006d7:	68 4f 02 80 00       	push   $0x80024f
+  8006dc:	e8 a8 fb ff ff       	call   800289 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8006e1:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8006e4:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8006e7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8006ea:	83 c4 10             	add    $0x10,%esp
+}
+  8006ed:	c9                   	leave
+  8006ee:	c3                   	ret
+		return -E_INVAL;
+  8006ef:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006f4:	eb f7                	jmp    8006ed <vsnprintf+0x45>
+
+008006f6 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8006f6:	55                   	push   %ebp
+  8006f7:	89 e5                	mov    %esp,%ebp
+  8006f9:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8006fc:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8006ff:	50                   	push   %eax
+  800700:	ff 75 10             	push   0x10(%ebp)
+  800703:	ff 75 0c             	push   0xc(%ebp)
+  800706:	ff 75 08             	push   0x8(%ebp)
+  800709:	e8 9a ff ff ff       	call   8006a8 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80070e:	c9                   	leave
+  80070f:	c3                   	ret
+
+00800710 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800710:	55                   	push   %ebp
+  800711:	89 e5                	mov    %esp,%ebp
+  800713:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800716:	b8 00 00 00 00       	mov    $0x0,%eax
+  80071b:	eb 03                	jmp    800720 <strlen+0x10>
+		n++;
+  80071d:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800720:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800724:	75 f7                	jne    80071d <strlen+0xd>
+	return n;
+}
+  800726:	5d                   	pop    %ebp
+  800727:	c3                   	ret
+
+00800728 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800728:	55                   	push   %ebp
+  800729:	89 e5                	mov    %esp,%ebp
+  80072b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80072e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800731:	b8 00 00 00 00       	mov    $0x0,%eax
+  800736:	eb 03                	jmp    80073b <strnlen+0x13>
+		n++;
+  800738:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80073b:	39 d0                	cmp    %edx,%eax
+  80073d:	74 08                	je     800747 <strnlen+0x1f>
+  80073f:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800743:	75 f3                	jne    800738 <strnlen+0x10>
+  800745:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800747:	89 d0                	mov    %edx,%eax
+  800749:	5d                   	pop    %ebp
+  80074a:	c3                   	ret
+
+0080074b <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80074b:	55                   	push   %ebp
+  80074c:	89 e5                	mov    %esp,%ebp
+  80074e:	53                   	push   %ebx
+  80074f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800752:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800755:	b8 00 00 00 00       	mov    $0x0,%eax
+  80075a:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80075e:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800761:	83 c0 01             	add    $0x1,%eax
+  800764:	84 d2                	test   %dl,%dl
+  800766:	75 f2                	jne    80075a <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800768:	89 c8                	mov    %ecx,%eax
+  80076a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80076d:	c9                   	leave
+  80076e:	c3                   	ret
+
+0080076f <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80076f:	55                   	push   %ebp
+  800770:	89 e5                	mov    %esp,%ebp
+  800772:	53                   	push   %ebx
+  800773:	83 ec 10             	sub    $0x10,%esp
+  800776:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800779:	53                   	push   %ebx
+  80077a:	e8 91 ff ff ff       	call   800710 <strlen>
+  80077f:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800782:	ff 75 0c             	push   0xc(%ebp)
+  800785:	01 d8                	add    %ebx,%eax
+  800787:	50                   	push   %eax
+  800788:	e8 be ff ff ff       	call   80074b <strcpy>
+	return dst;
+}
+  80078d:	89 d8                	mov    %ebx,%eax
+  80078f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800792:	c9                   	leave
+  800793:	c3                   	ret
+
+00800794 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800794:	55                   	push   %ebp
+  800795:	89 e5                	mov    %esp,%ebp
+  800797:	56                   	push   %esi
+  800798:	53                   	push   %ebx
+  800799:	8b 75 08             	mov    0x8(%ebp),%esi
+  80079c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80079f:	89 f3                	mov    %esi,%ebx
+  8007a1:	03 5d 10             	add    0x10(%ebp),%ebx
+  8007a4:	89 f0                	mov    %esi,%eax
+  8007a6:	eb 0f                	jmp    8007b7 <strncpy+0x23>
+		*dst++ = *src;
+  8007a8:	83 c0 01             	add    $0x1,%eax
+  8007ab:	0f b6 0a             	movzbl (%edx),%ecx
+  8007ae:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8007b1:	80 f9 01             	cmp    $0x1,%cl
+  8007b4:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8007b7:	39 d8                	cmp    %ebx,%eax
+  8007b9:	75 ed                	jne    8007a8 <strncpy+0x14>
+	}
+	return ret;
+}
+  8007bb:	89 f0                	mov    %esi,%eax
+  8007bd:	5b                   	pop    %ebx
+  8007be:	5e                   	pop    %esi
+  8007bf:	5d                   	pop    %ebp
+  8007c0:	c3                   	ret
+
+008007c1 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8007c1:	55                   	push   %ebp
+  8007c2:	89 e5                	mov    %esp,%ebp
+  8007c4:	56                   	push   %esi
+  8007c5:	53                   	push   %ebx
+  8007c6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007c9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007cc:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8007cf:	89 f0                	mov    %esi,%eax
+  8007d1:	85 d2                	test   %edx,%edx
+  8007d3:	74 21                	je     8007f6 <strlcpy+0x35>
+  8007d5:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8007d9:	89 f2                	mov    %esi,%edx
+  8007db:	eb 09                	jmp    8007e6 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8007dd:	83 c1 01             	add    $0x1,%ecx
+  8007e0:	83 c2 01             	add    $0x1,%edx
+  8007e3:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8007e6:	39 c2                	cmp    %eax,%edx
+  8007e8:	74 09                	je     8007f3 <strlcpy+0x32>
+  8007ea:	0f b6 19             	movzbl (%ecx),%ebx
+  8007ed:	84 db                	test   %bl,%bl
+  8007ef:	75 ec                	jne    8007dd <strlcpy+0x1c>
+  8007f1:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8007f3:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8007f6:	29 f0                	sub    %esi,%eax
+}
+  8007f8:	5b                   	pop    %ebx
+  8007f9:	5e                   	pop    %esi
+  8007fa:	5d                   	pop    %ebp
+  8007fb:	c3                   	ret
+
+008007fc <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8007fc:	55                   	push   %ebp
+  8007fd:	89 e5                	mov    %esp,%ebp
+  8007ff:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800802:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800805:	eb 06                	jmp    80080d <strcmp+0x11>
+		p++, q++;
+  800807:	83 c1 01             	add    $0x1,%ecx
+  80080a:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  80080d:	0f b6 01             	movzbl (%ecx),%eax
+  800810:	84 c0                	test   %al,%al
+  800812:	74 04                	je     800818 <strcmp+0x1c>
+  800814:	3a 02                	cmp    (%edx),%al
+  800816:	74 ef                	je     800807 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800818:	0f b6 c0             	movzbl %al,%eax
+  80081b:	0f b6 12             	movzbl (%edx),%edx
+  80081e:	29 d0                	sub    %edx,%eax
+}
+  800820:	5d                   	pop    %ebp
+  800821:	c3                   	ret
+
+00800822 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800822:	55                   	push   %ebp
+  800823:	89 e5                	mov    %esp,%ebp
+  800825:	53                   	push   %ebx
+  800826:	8b 45 08             	mov    0x8(%ebp),%eax
+  800829:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80082c:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80082f:	eb 09                	jmp    80083a <strncmp+0x18>
+		n--, p++, q++;
+  800831:	83 ea 01             	sub    $0x1,%edx
+  800834:	83 c0 01             	add    $0x1,%eax
+  800837:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80083a:	85 d2                	test   %edx,%edx
+  80083c:	74 18                	je     800856 <strncmp+0x34>
+  80083e:	0f b6 18             	movzbl (%eax),%ebx
+  800841:	84 db                	test   %bl,%bl
+  800843:	74 04                	je     800849 <strncmp+0x27>
+  800845:	3a 19                	cmp    (%ecx),%bl
+  800847:	74 e8                	je     800831 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800849:	0f b6 00             	movzbl (%eax),%eax
+  80084c:	0f b6 11             	movzbl (%ecx),%edx
+  80084f:	29 d0                	sub    %edx,%eax
+}
+  800851:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800854:	c9                   	leave
+  800855:	c3                   	ret
+		return 0;
+  800856:	b8 00 00 00 00       	mov    $0x0,%eax
+  80085b:	eb f4                	jmp    800851 <strncmp+0x2f>
+
+0080085d <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80085d:	55                   	push   %ebp
+  80085e:	89 e5                	mov    %esp,%ebp
+  800860:	8b 45 08             	mov    0x8(%ebp),%eax
+  800863:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800867:	eb 03                	jmp    80086c <strchr+0xf>
+  800869:	83 c0 01             	add    $0x1,%eax
+  80086c:	0f b6 10             	movzbl (%eax),%edx
+  80086f:	84 d2                	test   %dl,%dl
+  800871:	74 06                	je     800879 <strchr+0x1c>
+		if (*s == c)
+  800873:	38 ca                	cmp    %cl,%dl
+  800875:	75 f2                	jne    800869 <strchr+0xc>
+  800877:	eb 05                	jmp    80087e <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800879:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80087e:	5d                   	pop    %ebp
+  80087f:	c3                   	ret
+
+00800880 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800880:	55                   	push   %ebp
+  800881:	89 e5                	mov    %esp,%ebp
+  800883:	8b 45 08             	mov    0x8(%ebp),%eax
+  800886:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80088a:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  80088d:	38 ca                	cmp    %cl,%dl
+  80088f:	74 09                	je     80089a <strfind+0x1a>
+  800891:	84 d2                	test   %dl,%dl
+  800893:	74 05                	je     80089a <strfind+0x1a>
+	for (; *s; s++)
+  800895:	83 c0 01             	add    $0x1,%eax
+  800898:	eb f0                	jmp    80088a <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  80089a:	5d                   	pop    %ebp
+  80089b:	c3                   	ret
+
+0080089c <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  80089c:	55                   	push   %ebp
+  80089d:	89 e5                	mov    %esp,%ebp
+  80089f:	57                   	push   %edi
+  8008a0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8008a3:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8008a6:	85 c9                	test   %ecx,%ecx
+  8008a8:	74 20                	je     8008ca <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8008aa:	89 f8                	mov    %edi,%eax
+  8008ac:	09 c8                	or     %ecx,%eax
+  8008ae:	a8 03                	test   $0x3,%al
+  8008b0:	75 12                	jne    8008c4 <memset+0x28>
+		c &= 0xFF;
+  8008b2:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8008b6:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8008bc:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8008bf:	fc                   	cld
+  8008c0:	f3 ab                	rep stos %eax,%es:(%edi)
+  8008c2:	eb 06                	jmp    8008ca <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8008c4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8008c7:	fc                   	cld
+  8008c8:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8008ca:	89 f8                	mov    %edi,%eax
+  8008cc:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8008cf:	c9                   	leave
+  8008d0:	c3                   	ret
+
+008008d1 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8008d1:	55                   	push   %ebp
+  8008d2:	89 e5                	mov    %esp,%ebp
+  8008d4:	57                   	push   %edi
+  8008d5:	56                   	push   %esi
+  8008d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008d9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8008dc:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8008df:	39 c6                	cmp    %eax,%esi
+  8008e1:	73 32                	jae    800915 <memmove+0x44>
+  8008e3:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8008e6:	39 d0                	cmp    %edx,%eax
+  8008e8:	73 2b                	jae    800915 <memmove+0x44>
+		s += n;
+		d += n;
+  8008ea:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8008ed:	89 d6                	mov    %edx,%esi
+  8008ef:	09 fe                	or     %edi,%esi
+  8008f1:	09 ce                	or     %ecx,%esi
+  8008f3:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8008f9:	75 0e                	jne    800909 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8008fb:	83 ef 04             	sub    $0x4,%edi
+  8008fe:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800901:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800904:	fd                   	std
+  800905:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800907:	eb 09                	jmp    800912 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800909:	83 ef 01             	sub    $0x1,%edi
+  80090c:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  80090f:	fd                   	std
+  800910:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800912:	fc                   	cld
+  800913:	eb 1a                	jmp    80092f <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800915:	89 f2                	mov    %esi,%edx
+  800917:	09 c2                	or     %eax,%edx
+  800919:	09 ca                	or     %ecx,%edx
+  80091b:	f6 c2 03             	test   $0x3,%dl
+  80091e:	75 0a                	jne    80092a <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800920:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800923:	89 c7                	mov    %eax,%edi
+  800925:	fc                   	cld
+  800926:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800928:	eb 05                	jmp    80092f <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  80092a:	89 c7                	mov    %eax,%edi
+  80092c:	fc                   	cld
+  80092d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  80092f:	5e                   	pop    %esi
+  800930:	5f                   	pop    %edi
+  800931:	5d                   	pop    %ebp
+  800932:	c3                   	ret
+
+00800933 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800933:	55                   	push   %ebp
+  800934:	89 e5                	mov    %esp,%ebp
+  800936:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800939:	ff 75 10             	push   0x10(%ebp)
+  80093c:	ff 75 0c             	push   0xc(%ebp)
+  80093f:	ff 75 08             	push   0x8(%ebp)
+  800942:	e8 8a ff ff ff       	call   8008d1 <memmove>
+}
+  800947:	c9                   	leave
+  800948:	c3                   	ret
+
+00800949 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800949:	55                   	push   %ebp
+  80094a:	89 e5                	mov    %esp,%ebp
+  80094c:	56                   	push   %esi
+  80094d:	53                   	push   %ebx
+  80094e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800951:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800954:	89 c6                	mov    %eax,%esi
+  800956:	03 75 10             	add    0x10(%ebp),%esi
+  800959:	eb 06                	jmp    800961 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  80095b:	83 c0 01             	add    $0x1,%eax
+  80095e:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800961:	39 f0                	cmp    %esi,%eax
+  800963:	74 14                	je     800979 <memcmp+0x30>
+		if (*s1 != *s2)
+  800965:	0f b6 08             	movzbl (%eax),%ecx
+  800968:	0f b6 1a             	movzbl (%edx),%ebx
+  80096b:	38 d9                	cmp    %bl,%cl
+  80096d:	74 ec                	je     80095b <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  80096f:	0f b6 c1             	movzbl %cl,%eax
+  800972:	0f b6 db             	movzbl %bl,%ebx
+  800975:	29 d8                	sub    %ebx,%eax
+  800977:	eb 05                	jmp    80097e <memcmp+0x35>
+	}
+
+	return 0;
+  800979:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80097e:	5b                   	pop    %ebx
+  80097f:	5e                   	pop    %esi
+  800980:	5d                   	pop    %ebp
+  800981:	c3                   	ret
+
+00800982 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800982:	55                   	push   %ebp
+  800983:	89 e5                	mov    %esp,%ebp
+  800985:	8b 45 08             	mov    0x8(%ebp),%eax
+  800988:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  80098b:	89 c2                	mov    %eax,%edx
+  80098d:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800990:	eb 03                	jmp    800995 <memfind+0x13>
+  800992:	83 c0 01             	add    $0x1,%eax
+  800995:	39 d0                	cmp    %edx,%eax
+  800997:	73 04                	jae    80099d <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800999:	38 08                	cmp    %cl,(%eax)
+  80099b:	75 f5                	jne    800992 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  80099d:	5d                   	pop    %ebp
+  80099e:	c3                   	ret
+
+0080099f <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  80099f:	55                   	push   %ebp
+  8009a0:	89 e5                	mov    %esp,%ebp
+  8009a2:	57                   	push   %edi
+  8009a3:	56                   	push   %esi
+  8009a4:	53                   	push   %ebx
+  8009a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009a8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8009ab:	eb 03                	jmp    8009b0 <strtol+0x11>
+		s++;
+  8009ad:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  8009b0:	0f b6 02             	movzbl (%edx),%eax
+  8009b3:	3c 20                	cmp    $0x20,%al
+  8009b5:	74 f6                	je     8009ad <strtol+0xe>
+  8009b7:	3c 09                	cmp    $0x9,%al
+  8009b9:	74 f2                	je     8009ad <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8009bb:	3c 2b                	cmp    $0x2b,%al
+  8009bd:	74 2a                	je     8009e9 <strtol+0x4a>
+	int neg = 0;
+  8009bf:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8009c4:	3c 2d                	cmp    $0x2d,%al
+  8009c6:	74 2b                	je     8009f3 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009c8:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8009ce:	75 0f                	jne    8009df <strtol+0x40>
+  8009d0:	80 3a 30             	cmpb   $0x30,(%edx)
+  8009d3:	74 28                	je     8009fd <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8009d5:	85 db                	test   %ebx,%ebx
+  8009d7:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8009dc:	0f 44 d8             	cmove  %eax,%ebx
+  8009df:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009e4:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8009e7:	eb 46                	jmp    800a2f <strtol+0x90>
+		s++;
+  8009e9:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  8009ec:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009f1:	eb d5                	jmp    8009c8 <strtol+0x29>
+		s++, neg = 1;
+  8009f3:	83 c2 01             	add    $0x1,%edx
+  8009f6:	bf 01 00 00 00       	mov    $0x1,%edi
+  8009fb:	eb cb                	jmp    8009c8 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009fd:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a01:	74 0e                	je     800a11 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a03:	85 db                	test   %ebx,%ebx
+  800a05:	75 d8                	jne    8009df <strtol+0x40>
+		s++, base = 8;
+  800a07:	83 c2 01             	add    $0x1,%edx
+  800a0a:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a0f:	eb ce                	jmp    8009df <strtol+0x40>
+		s += 2, base = 16;
+  800a11:	83 c2 02             	add    $0x2,%edx
+  800a14:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a19:	eb c4                	jmp    8009df <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a1b:	0f be c0             	movsbl %al,%eax
+  800a1e:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a21:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a24:	7d 3a                	jge    800a60 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a26:	83 c2 01             	add    $0x1,%edx
+  800a29:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a2d:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a2f:	0f b6 02             	movzbl (%edx),%eax
+  800a32:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a35:	89 f3                	mov    %esi,%ebx
+  800a37:	80 fb 09             	cmp    $0x9,%bl
+  800a3a:	76 df                	jbe    800a1b <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a3c:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a3f:	89 f3                	mov    %esi,%ebx
+  800a41:	80 fb 19             	cmp    $0x19,%bl
+  800a44:	77 08                	ja     800a4e <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800a46:	0f be c0             	movsbl %al,%eax
+  800a49:	83 e8 57             	sub    $0x57,%eax
+  800a4c:	eb d3                	jmp    800a21 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800a4e:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800a51:	89 f3                	mov    %esi,%ebx
+  800a53:	80 fb 19             	cmp    $0x19,%bl
+  800a56:	77 08                	ja     800a60 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800a58:	0f be c0             	movsbl %al,%eax
+  800a5b:	83 e8 37             	sub    $0x37,%eax
+  800a5e:	eb c1                	jmp    800a21 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800a60:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800a64:	74 05                	je     800a6b <strtol+0xcc>
+		*endptr = (char *) s;
+  800a66:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a69:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800a6b:	89 c8                	mov    %ecx,%eax
+  800a6d:	f7 d8                	neg    %eax
+  800a6f:	85 ff                	test   %edi,%edi
+  800a71:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800a74:	89 c8                	mov    %ecx,%eax
+  800a76:	5b                   	pop    %ebx
+  800a77:	5e                   	pop    %esi
+  800a78:	5f                   	pop    %edi
+  800a79:	5d                   	pop    %ebp
+  800a7a:	c3                   	ret
+
+00800a7b <sys_cputs>:
+
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800a7b:	55                   	push   %ebp
+  800a7c:	89 e5                	mov    %esp,%ebp
+  800a7e:	57                   	push   %edi
+  800a7f:	56                   	push   %esi
+  800a80:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800a81:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a86:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a89:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a8c:	89 c3                	mov    %eax,%ebx
+  800a8e:	89 c7                	mov    %eax,%edi
+  800a90:	89 c6                	mov    %eax,%esi
+  800a92:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t) s, len, 0, 0, 0);
+}
+  800a94:	5b                   	pop    %ebx
+  800a95:	5e                   	pop    %esi
+  800a96:	5f                   	pop    %edi
+  800a97:	5d                   	pop    %ebp
+  800a98:	c3                   	ret
+
+00800a99 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800a99:	55                   	push   %ebp
+  800a9a:	89 e5                	mov    %esp,%ebp
+  800a9c:	57                   	push   %edi
+  800a9d:	56                   	push   %esi
+  800a9e:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800a9f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800aa4:	b8 01 00 00 00       	mov    $0x1,%eax
+  800aa9:	89 d1                	mov    %edx,%ecx
+  800aab:	89 d3                	mov    %edx,%ebx
+  800aad:	89 d7                	mov    %edx,%edi
+  800aaf:	89 d6                	mov    %edx,%esi
+  800ab1:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800ab3:	5b                   	pop    %ebx
+  800ab4:	5e                   	pop    %esi
+  800ab5:	5f                   	pop    %edi
+  800ab6:	5d                   	pop    %ebp
+  800ab7:	c3                   	ret
+
+00800ab8 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800ab8:	55                   	push   %ebp
+  800ab9:	89 e5                	mov    %esp,%ebp
+  800abb:	57                   	push   %edi
+  800abc:	56                   	push   %esi
+  800abd:	53                   	push   %ebx
+  800abe:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800ac1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ac6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ac9:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ace:	89 cb                	mov    %ecx,%ebx
+  800ad0:	89 cf                	mov    %ecx,%edi
+  800ad2:	89 ce                	mov    %ecx,%esi
+  800ad4:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ad6:	85 c0                	test   %eax,%eax
+  800ad8:	7f 08                	jg     800ae2 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800ada:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800add:	5b                   	pop    %ebx
+  800ade:	5e                   	pop    %esi
+  800adf:	5f                   	pop    %edi
+  800ae0:	5d                   	pop    %ebp
+  800ae1:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ae2:	83 ec 0c             	sub    $0xc,%esp
+  800ae5:	50                   	push   %eax
+  800ae6:	6a 03                	push   $0x3
+  800ae8:	68 e3 28 80 00       	push   $0x8028e3
+  800aed:	6a 3e                	push   $0x3e
+  800aef:	68 00 29 80 00       	push   $0x802900
+  800af4:	e8 22 14 00 00       	call   801f1b <_panic>
+
+00800af9 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800af9:	55                   	push   %ebp
+  800afa:	89 e5                	mov    %esp,%ebp
+  800afc:	57                   	push   %edi
+  800afd:	56                   	push   %esi
+  800afe:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800aff:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b04:	b8 02 00 00 00       	mov    $0x2,%eax
+  800b09:	89 d1                	mov    %edx,%ecx
+  800b0b:	89 d3                	mov    %edx,%ebx
+  800b0d:	89 d7                	mov    %edx,%edi
+  800b0f:	89 d6                	mov    %edx,%esi
+  800b11:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800b13:	5b                   	pop    %ebx
+  800b14:	5e                   	pop    %esi
+  800b15:	5f                   	pop    %edi
+  800b16:	5d                   	pop    %ebp
+  800b17:	c3                   	ret
+
+00800b18 <sys_yield>:
+
+void
+sys_yield(void) {
+  800b18:	55                   	push   %ebp
+  800b19:	89 e5                	mov    %esp,%ebp
+  800b1b:	57                   	push   %edi
+  800b1c:	56                   	push   %esi
+  800b1d:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800b1e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b23:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800b28:	89 d1                	mov    %edx,%ecx
+  800b2a:	89 d3                	mov    %edx,%ebx
+  800b2c:	89 d7                	mov    %edx,%edi
+  800b2e:	89 d6                	mov    %edx,%esi
+  800b30:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800b32:	5b                   	pop    %ebx
+  800b33:	5e                   	pop    %esi
+  800b34:	5f                   	pop    %edi
+  800b35:	5d                   	pop    %ebp
+  800b36:	c3                   	ret
+
+00800b37 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  800b37:	55                   	push   %ebp
+  800b38:	89 e5                	mov    %esp,%ebp
+  800b3a:	57                   	push   %edi
+  800b3b:	56                   	push   %esi
+  800b3c:	53                   	push   %ebx
+  800b3d:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800b40:	be 00 00 00 00       	mov    $0x0,%esi
+  800b45:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b48:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b4b:	b8 04 00 00 00       	mov    $0x4,%eax
+  800b50:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b53:	89 f7                	mov    %esi,%edi
+  800b55:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800b57:	85 c0                	test   %eax,%eax
+  800b59:	7f 08                	jg     800b63 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800b5b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b5e:	5b                   	pop    %ebx
+  800b5f:	5e                   	pop    %esi
+  800b60:	5f                   	pop    %edi
+  800b61:	5d                   	pop    %ebp
+  800b62:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800b63:	83 ec 0c             	sub    $0xc,%esp
+  800b66:	50                   	push   %eax
+  800b67:	6a 04                	push   $0x4
+  800b69:	68 e3 28 80 00       	push   $0x8028e3
+  800b6e:	6a 3e                	push   $0x3e
+  800b70:	68 00 29 80 00       	push   $0x802900
+  800b75:	e8 a1 13 00 00       	call   801f1b <_panic>
+
+00800b7a <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  800b7a:	55                   	push   %ebp
+  800b7b:	89 e5                	mov    %esp,%ebp
+  800b7d:	57                   	push   %edi
+  800b7e:	56                   	push   %esi
+  800b7f:	53                   	push   %ebx
+  800b80:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800b83:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b86:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b89:	b8 05 00 00 00       	mov    $0x5,%eax
+  800b8e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b91:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800b94:	8b 75 18             	mov    0x18(%ebp),%esi
+  800b97:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800b99:	85 c0                	test   %eax,%eax
+  800b9b:	7f 08                	jg     800ba5 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800b9d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ba0:	5b                   	pop    %ebx
+  800ba1:	5e                   	pop    %esi
+  800ba2:	5f                   	pop    %edi
+  800ba3:	5d                   	pop    %ebp
+  800ba4:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ba5:	83 ec 0c             	sub    $0xc,%esp
+  800ba8:	50                   	push   %eax
+  800ba9:	6a 05                	push   $0x5
+  800bab:	68 e3 28 80 00       	push   $0x8028e3
+  800bb0:	6a 3e                	push   $0x3e
+  800bb2:	68 00 29 80 00       	push   $0x802900
+  800bb7:	e8 5f 13 00 00       	call   801f1b <_panic>
+
+00800bbc <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  800bbc:	55                   	push   %ebp
+  800bbd:	89 e5                	mov    %esp,%ebp
+  800bbf:	57                   	push   %edi
+  800bc0:	56                   	push   %esi
+  800bc1:	53                   	push   %ebx
+  800bc2:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800bc5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800bca:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bcd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bd0:	b8 06 00 00 00       	mov    $0x6,%eax
+  800bd5:	89 df                	mov    %ebx,%edi
+  800bd7:	89 de                	mov    %ebx,%esi
+  800bd9:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800bdb:	85 c0                	test   %eax,%eax
+  800bdd:	7f 08                	jg     800be7 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800bdf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800be2:	5b                   	pop    %ebx
+  800be3:	5e                   	pop    %esi
+  800be4:	5f                   	pop    %edi
+  800be5:	5d                   	pop    %ebp
+  800be6:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800be7:	83 ec 0c             	sub    $0xc,%esp
+  800bea:	50                   	push   %eax
+  800beb:	6a 06                	push   $0x6
+  800bed:	68 e3 28 80 00       	push   $0x8028e3
+  800bf2:	6a 3e                	push   $0x3e
+  800bf4:	68 00 29 80 00       	push   $0x802900
+  800bf9:	e8 1d 13 00 00       	call   801f1b <_panic>
+
+00800bfe <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800bfe:	55                   	push   %ebp
+  800bff:	89 e5                	mov    %esp,%ebp
+  800c01:	57                   	push   %edi
+  800c02:	56                   	push   %esi
+  800c03:	53                   	push   %ebx
+  800c04:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c07:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c0c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c0f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c12:	b8 08 00 00 00       	mov    $0x8,%eax
+  800c17:	89 df                	mov    %ebx,%edi
+  800c19:	89 de                	mov    %ebx,%esi
+  800c1b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c1d:	85 c0                	test   %eax,%eax
+  800c1f:	7f 08                	jg     800c29 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800c21:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c24:	5b                   	pop    %ebx
+  800c25:	5e                   	pop    %esi
+  800c26:	5f                   	pop    %edi
+  800c27:	5d                   	pop    %ebp
+  800c28:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c29:	83 ec 0c             	sub    $0xc,%esp
+  800c2c:	50                   	push   %eax
+  800c2d:	6a 08                	push   $0x8
+  800c2f:	68 e3 28 80 00       	push   $0x8028e3
+  800c34:	6a 3e                	push   $0x3e
+  800c36:	68 00 29 80 00       	push   $0x802900
+  800c3b:	e8 db 12 00 00       	call   801f1b <_panic>
+
+00800c40 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800c40:	55                   	push   %ebp
+  800c41:	89 e5                	mov    %esp,%ebp
+  800c43:	57                   	push   %edi
+  800c44:	56                   	push   %esi
+  800c45:	53                   	push   %ebx
+  800c46:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c49:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c4e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c51:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c54:	b8 09 00 00 00       	mov    $0x9,%eax
+  800c59:	89 df                	mov    %ebx,%edi
+  800c5b:	89 de                	mov    %ebx,%esi
+  800c5d:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c5f:	85 c0                	test   %eax,%eax
+  800c61:	7f 08                	jg     800c6b <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800c63:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c66:	5b                   	pop    %ebx
+  800c67:	5e                   	pop    %esi
+  800c68:	5f                   	pop    %edi
+  800c69:	5d                   	pop    %ebp
+  800c6a:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c6b:	83 ec 0c             	sub    $0xc,%esp
+  800c6e:	50                   	push   %eax
+  800c6f:	6a 09                	push   $0x9
+  800c71:	68 e3 28 80 00       	push   $0x8028e3
+  800c76:	6a 3e                	push   $0x3e
+  800c78:	68 00 29 80 00       	push   $0x802900
+  800c7d:	e8 99 12 00 00       	call   801f1b <_panic>
+
+00800c82 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800c82:	55                   	push   %ebp
+  800c83:	89 e5                	mov    %esp,%ebp
+  800c85:	57                   	push   %edi
+  800c86:	56                   	push   %esi
+  800c87:	53                   	push   %ebx
+  800c88:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800c8b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c90:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c93:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c96:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c9b:	89 df                	mov    %ebx,%edi
+  800c9d:	89 de                	mov    %ebx,%esi
+  800c9f:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ca1:	85 c0                	test   %eax,%eax
+  800ca3:	7f 08                	jg     800cad <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800ca5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ca8:	5b                   	pop    %ebx
+  800ca9:	5e                   	pop    %esi
+  800caa:	5f                   	pop    %edi
+  800cab:	5d                   	pop    %ebp
+  800cac:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800cad:	83 ec 0c             	sub    $0xc,%esp
+  800cb0:	50                   	push   %eax
+  800cb1:	6a 0a                	push   $0xa
+  800cb3:	68 e3 28 80 00       	push   $0x8028e3
+  800cb8:	6a 3e                	push   $0x3e
+  800cba:	68 00 29 80 00       	push   $0x802900
+  800cbf:	e8 57 12 00 00       	call   801f1b <_panic>
+
+00800cc4 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm) {
+  800cc4:	55                   	push   %ebp
+  800cc5:	89 e5                	mov    %esp,%ebp
+  800cc7:	57                   	push   %edi
+  800cc8:	56                   	push   %esi
+  800cc9:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800cca:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ccd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cd0:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800cd5:	be 00 00 00 00       	mov    $0x0,%esi
+  800cda:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cdd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ce0:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800ce2:	5b                   	pop    %ebx
+  800ce3:	5e                   	pop    %esi
+  800ce4:	5f                   	pop    %edi
+  800ce5:	5d                   	pop    %ebp
+  800ce6:	c3                   	ret
+
+00800ce7 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  800ce7:	55                   	push   %ebp
+  800ce8:	89 e5                	mov    %esp,%ebp
+  800cea:	57                   	push   %edi
+  800ceb:	56                   	push   %esi
+  800cec:	53                   	push   %ebx
+  800ced:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("int %1\n"
+  800cf0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cf5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cf8:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800cfd:	89 cb                	mov    %ecx,%ebx
+  800cff:	89 cf                	mov    %ecx,%edi
+  800d01:	89 ce                	mov    %ecx,%esi
+  800d03:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d05:	85 c0                	test   %eax,%eax
+  800d07:	7f 08                	jg     800d11 <sys_ipc_recv+0x2a>
+  return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, 0, 0, 0, 0);
+}
+  800d09:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d0c:	5b                   	pop    %ebx
+  800d0d:	5e                   	pop    %esi
+  800d0e:	5f                   	pop    %edi
+  800d0f:	5d                   	pop    %ebp
+  800d10:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d11:	83 ec 0c             	sub    $0xc,%esp
+  800d14:	50                   	push   %eax
+  800d15:	6a 0d                	push   $0xd
+  800d17:	68 e3 28 80 00       	push   $0x8028e3
+  800d1c:	6a 3e                	push   $0x3e
+  800d1e:	68 00 29 80 00       	push   $0x802900
+  800d23:	e8 f3 11 00 00       	call   801f1b <_panic>
+
+00800d28 <sys_map_kernel_page>:
+
+int
+sys_map_kernel_page(void *kpage, void *va) {
+  800d28:	55                   	push   %ebp
+  800d29:	89 e5                	mov    %esp,%ebp
+  800d2b:	57                   	push   %edi
+  800d2c:	56                   	push   %esi
+  800d2d:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d2e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d33:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d36:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d39:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800d3e:	89 df                	mov    %ebx,%edi
+  800d40:	89 de                	mov    %ebx,%esi
+  800d42:	cd 30                	int    $0x30
+  return syscall(SYS_map_kernel_page, 0, (uint32_t) kpage, (uint32_t) va, 0, 0, 0);
+}
+  800d44:	5b                   	pop    %ebx
+  800d45:	5e                   	pop    %esi
+  800d46:	5f                   	pop    %edi
+  800d47:	5d                   	pop    %ebp
+  800d48:	c3                   	ret
+
+00800d49 <sys_sbrk>:
+
+int
+sys_sbrk(uint32_t inc) {
+  800d49:	55                   	push   %ebp
+  800d4a:	89 e5                	mov    %esp,%ebp
+  800d4c:	57                   	push   %edi
+  800d4d:	56                   	push   %esi
+  800d4e:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d4f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d54:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d57:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800d5c:	89 cb                	mov    %ecx,%ebx
+  800d5e:	89 cf                	mov    %ecx,%edi
+  800d60:	89 ce                	mov    %ecx,%esi
+  800d62:	cd 30                	int    $0x30
+  return syscall(SYS_sbrk, 0, (uint32_t) inc, (uint32_t) 0, 0, 0, 0);
+}
+  800d64:	5b                   	pop    %ebx
+  800d65:	5e                   	pop    %esi
+  800d66:	5f                   	pop    %edi
+  800d67:	5d                   	pop    %ebp
+  800d68:	c3                   	ret
+
+00800d69 <sys_time_msec>:
+  return syscall(SYS_exec, 1, child, 0, 0, 0, 0);
+}
+#endif
+
+unsigned int
+sys_time_msec(void) {
+  800d69:	55                   	push   %ebp
+  800d6a:	89 e5                	mov    %esp,%ebp
+  800d6c:	57                   	push   %edi
+  800d6d:	56                   	push   %esi
+  800d6e:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d6f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d74:	b8 10 00 00 00       	mov    $0x10,%eax
+  800d79:	89 d1                	mov    %edx,%ecx
+  800d7b:	89 d3                	mov    %edx,%ebx
+  800d7d:	89 d7                	mov    %edx,%edi
+  800d7f:	89 d6                	mov    %edx,%esi
+  800d81:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800d83:	5b                   	pop    %ebx
+  800d84:	5e                   	pop    %esi
+  800d85:	5f                   	pop    %edi
+  800d86:	5d                   	pop    %ebp
+  800d87:	c3                   	ret
+
+00800d88 <sys_net_send>:
+
+int
+sys_net_send(const void *buf, uint32_t len) {
+  800d88:	55                   	push   %ebp
+  800d89:	89 e5                	mov    %esp,%ebp
+  800d8b:	57                   	push   %edi
+  800d8c:	56                   	push   %esi
+  800d8d:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800d8e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d93:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d96:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d99:	b8 11 00 00 00       	mov    $0x11,%eax
+  800d9e:	89 df                	mov    %ebx,%edi
+  800da0:	89 de                	mov    %ebx,%esi
+  800da2:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_send, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800da4:	5b                   	pop    %ebx
+  800da5:	5e                   	pop    %esi
+  800da6:	5f                   	pop    %edi
+  800da7:	5d                   	pop    %ebp
+  800da8:	c3                   	ret
+
+00800da9 <sys_net_recv>:
+
+int
+sys_net_recv(void *buf, uint32_t len) {
+  800da9:	55                   	push   %ebp
+  800daa:	89 e5                	mov    %esp,%ebp
+  800dac:	57                   	push   %edi
+  800dad:	56                   	push   %esi
+  800dae:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800daf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800db4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800db7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dba:	b8 12 00 00 00       	mov    $0x12,%eax
+  800dbf:	89 df                	mov    %ebx,%edi
+  800dc1:	89 de                	mov    %ebx,%esi
+  800dc3:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_net_recv, 0, (uint32_t) buf, len, 0, 0, 0);
+}
+  800dc5:	5b                   	pop    %ebx
+  800dc6:	5e                   	pop    %esi
+  800dc7:	5f                   	pop    %edi
+  800dc8:	5d                   	pop    %ebp
+  800dc9:	c3                   	ret
+
+00800dca <sys_sleep>:
+
+
+int sys_sleep(unsigned msec) {
+  800dca:	55                   	push   %ebp
+  800dcb:	89 e5                	mov    %esp,%ebp
+  800dcd:	57                   	push   %edi
+  800dce:	56                   	push   %esi
+  800dcf:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800dd0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dd5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd8:	b8 13 00 00 00       	mov    $0x13,%eax
+  800ddd:	89 cb                	mov    %ecx,%ebx
+  800ddf:	89 cf                	mov    %ecx,%edi
+  800de1:	89 ce                	mov    %ecx,%esi
+  800de3:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_sleep, 0, msec, 0, 0, 0, 0);
+}
+  800de5:	5b                   	pop    %ebx
+  800de6:	5e                   	pop    %esi
+  800de7:	5f                   	pop    %edi
+  800de8:	5d                   	pop    %ebp
+  800de9:	c3                   	ret
+
+00800dea <sys_net_get_macaddr>:
+
+int sys_net_get_macaddr(char *macaddr) {
+  800dea:	55                   	push   %ebp
+  800deb:	89 e5                	mov    %esp,%ebp
+  800ded:	57                   	push   %edi
+  800dee:	56                   	push   %esi
+  800def:	53                   	push   %ebx
+  asm volatile("int %1\n"
+  800df0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800df5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df8:	b8 14 00 00 00       	mov    $0x14,%eax
+  800dfd:	89 cb                	mov    %ecx,%ebx
+  800dff:	89 cf                	mov    %ecx,%edi
+  800e01:	89 ce                	mov    %ecx,%esi
+  800e03:	cd 30                	int    $0x30
+  return (unsigned) syscall(SYS_net_get_macaddr, 0, (uint32_t) macaddr, 0, 0, 0, 0);
+  800e05:	5b                   	pop    %ebx
+  800e06:	5e                   	pop    %esi
+  800e07:	5f                   	pop    %edi
+  800e08:	5d                   	pop    %ebp
+  800e09:	c3                   	ret
+
+00800e0a <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800e0a:	55                   	push   %ebp
+  800e0b:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800e0d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e10:	05 00 00 00 30       	add    $0x30000000,%eax
+  800e15:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800e18:	5d                   	pop    %ebp
+  800e19:	c3                   	ret
+
+00800e1a <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800e1a:	55                   	push   %ebp
+  800e1b:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800e1d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e20:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800e25:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800e2a:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800e2f:	5d                   	pop    %ebp
+  800e30:	c3                   	ret
+
+00800e31 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800e31:	55                   	push   %ebp
+  800e32:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  800e34:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800e39:	eb 02                	jmp    800e3d <fd_alloc+0xc>
+  800e3b:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800e3d:	89 c2                	mov    %eax,%edx
+  800e3f:	c1 ea 16             	shr    $0x16,%edx
+  800e42:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800e49:	f6 c2 01             	test   $0x1,%dl
+  800e4c:	74 2b                	je     800e79 <fd_alloc+0x48>
+  800e4e:	89 c2                	mov    %eax,%edx
+  800e50:	c1 ea 0c             	shr    $0xc,%edx
+  800e53:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  800e5a:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  800e60:	f6 c1 01             	test   $0x1,%cl
+  800e63:	74 14                	je     800e79 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  800e65:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  800e6b:	75 ce                	jne    800e3b <fd_alloc+0xa>
+  800e6d:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  800e72:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800e77:	eb 05                	jmp    800e7e <fd_alloc+0x4d>
+			return 0;
+  800e79:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  800e7e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e81:	89 02                	mov    %eax,(%edx)
+}
+  800e83:	89 c8                	mov    %ecx,%eax
+  800e85:	5d                   	pop    %ebp
+  800e86:	c3                   	ret
+
+00800e87 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  800e87:	55                   	push   %ebp
+  800e88:	89 e5                	mov    %esp,%ebp
+  800e8a:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  800e8d:	83 f8 1f             	cmp    $0x1f,%eax
+  800e90:	77 30                	ja     800ec2 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  800e92:	c1 e0 0c             	shl    $0xc,%eax
+  800e95:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800e9a:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  800ea0:	f6 c2 01             	test   $0x1,%dl
+  800ea3:	74 24                	je     800ec9 <fd_lookup+0x42>
+  800ea5:	89 c2                	mov    %eax,%edx
+  800ea7:	c1 ea 0c             	shr    $0xc,%edx
+  800eaa:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800eb1:	f6 c2 01             	test   $0x1,%dl
+  800eb4:	74 1a                	je     800ed0 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  800eb6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800eb9:	89 02                	mov    %eax,(%edx)
+	return 0;
+  800ebb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ec0:	5d                   	pop    %ebp
+  800ec1:	c3                   	ret
+		return -E_INVAL;
+  800ec2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ec7:	eb f7                	jmp    800ec0 <fd_lookup+0x39>
+		return -E_INVAL;
+  800ec9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ece:	eb f0                	jmp    800ec0 <fd_lookup+0x39>
+  800ed0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ed5:	eb e9                	jmp    800ec0 <fd_lookup+0x39>
+
+00800ed7 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  800ed7:	55                   	push   %ebp
+  800ed8:	89 e5                	mov    %esp,%ebp
+  800eda:	53                   	push   %ebx
+  800edb:	83 ec 04             	sub    $0x4,%esp
+  800ede:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  800ee1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ee6:	eb 03                	jmp    800eeb <dev_lookup+0x14>
+  800ee8:	83 c0 01             	add    $0x1,%eax
+  800eeb:	8b 1c 85 8c 29 80 00 	mov    0x80298c(,%eax,4),%ebx
+  800ef2:	85 db                	test   %ebx,%ebx
+  800ef4:	74 0b                	je     800f01 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  800ef6:	39 13                	cmp    %edx,(%ebx)
+  800ef8:	75 ee                	jne    800ee8 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  800efa:	b8 00 00 00 00       	mov    $0x0,%eax
+  800eff:	eb 1f                	jmp    800f20 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800f01:	a1 08 40 80 00       	mov    0x804008,%eax
+  800f06:	8b 40 48             	mov    0x48(%eax),%eax
+  800f09:	83 ec 04             	sub    $0x4,%esp
+  800f0c:	52                   	push   %edx
+  800f0d:	50                   	push   %eax
+  800f0e:	68 10 29 80 00       	push   $0x802910
+  800f13:	e8 7a f2 ff ff       	call   800192 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  800f18:	83 c4 10             	add    $0x10,%esp
+  800f1b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  800f20:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800f23:	89 1a                	mov    %ebx,(%edx)
+}
+  800f25:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f28:	c9                   	leave
+  800f29:	c3                   	ret
+
+00800f2a <fd_close>:
+{
+  800f2a:	55                   	push   %ebp
+  800f2b:	89 e5                	mov    %esp,%ebp
+  800f2d:	57                   	push   %edi
+  800f2e:	56                   	push   %esi
+  800f2f:	53                   	push   %ebx
+  800f30:	83 ec 24             	sub    $0x24,%esp
+  800f33:	8b 75 08             	mov    0x8(%ebp),%esi
+  800f36:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800f39:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800f3c:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800f3d:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800f43:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800f46:	50                   	push   %eax
+  800f47:	e8 3b ff ff ff       	call   800e87 <fd_lookup>
+  800f4c:	89 c3                	mov    %eax,%ebx
+  800f4e:	83 c4 10             	add    $0x10,%esp
+  800f51:	85 c0                	test   %eax,%eax
+  800f53:	78 05                	js     800f5a <fd_close+0x30>
+	    || fd != fd2)
+  800f55:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  800f58:	74 16                	je     800f70 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  800f5a:	89 f8                	mov    %edi,%eax
+  800f5c:	84 c0                	test   %al,%al
+  800f5e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f63:	0f 44 d8             	cmove  %eax,%ebx
+}
+  800f66:	89 d8                	mov    %ebx,%eax
+  800f68:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f6b:	5b                   	pop    %ebx
+  800f6c:	5e                   	pop    %esi
+  800f6d:	5f                   	pop    %edi
+  800f6e:	5d                   	pop    %ebp
+  800f6f:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800f70:	83 ec 08             	sub    $0x8,%esp
+  800f73:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800f76:	50                   	push   %eax
+  800f77:	ff 36                	push   (%esi)
+  800f79:	e8 59 ff ff ff       	call   800ed7 <dev_lookup>
+  800f7e:	89 c3                	mov    %eax,%ebx
+  800f80:	83 c4 10             	add    $0x10,%esp
+  800f83:	85 c0                	test   %eax,%eax
+  800f85:	78 1a                	js     800fa1 <fd_close+0x77>
+		if (dev->dev_close)
+  800f87:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800f8a:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  800f8d:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  800f92:	85 c0                	test   %eax,%eax
+  800f94:	74 0b                	je     800fa1 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  800f96:	83 ec 0c             	sub    $0xc,%esp
+  800f99:	56                   	push   %esi
+  800f9a:	ff d0                	call   *%eax
+  800f9c:	89 c3                	mov    %eax,%ebx
+  800f9e:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  800fa1:	83 ec 08             	sub    $0x8,%esp
+  800fa4:	56                   	push   %esi
+  800fa5:	6a 00                	push   $0x0
+  800fa7:	e8 10 fc ff ff       	call   800bbc <sys_page_unmap>
+	return r;
+  800fac:	83 c4 10             	add    $0x10,%esp
+  800faf:	eb b5                	jmp    800f66 <fd_close+0x3c>
+
+00800fb1 <close>:
+
+int
+close(int fdnum)
+{
+  800fb1:	55                   	push   %ebp
+  800fb2:	89 e5                	mov    %esp,%ebp
+  800fb4:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800fb7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800fba:	50                   	push   %eax
+  800fbb:	ff 75 08             	push   0x8(%ebp)
+  800fbe:	e8 c4 fe ff ff       	call   800e87 <fd_lookup>
+  800fc3:	83 c4 10             	add    $0x10,%esp
+  800fc6:	85 c0                	test   %eax,%eax
+  800fc8:	79 02                	jns    800fcc <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  800fca:	c9                   	leave
+  800fcb:	c3                   	ret
+		return fd_close(fd, 1);
+  800fcc:	83 ec 08             	sub    $0x8,%esp
+  800fcf:	6a 01                	push   $0x1
+  800fd1:	ff 75 f4             	push   -0xc(%ebp)
+  800fd4:	e8 51 ff ff ff       	call   800f2a <fd_close>
+  800fd9:	83 c4 10             	add    $0x10,%esp
+  800fdc:	eb ec                	jmp    800fca <close+0x19>
+
+00800fde <close_all>:
+
+void
+close_all(void)
+{
+  800fde:	55                   	push   %ebp
+  800fdf:	89 e5                	mov    %esp,%ebp
+  800fe1:	53                   	push   %ebx
+  800fe2:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  800fe5:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  800fea:	83 ec 0c             	sub    $0xc,%esp
+  800fed:	53                   	push   %ebx
+  800fee:	e8 be ff ff ff       	call   800fb1 <close>
+	for (i = 0; i < MAXFD; i++)
+  800ff3:	83 c3 01             	add    $0x1,%ebx
+  800ff6:	83 c4 10             	add    $0x10,%esp
+  800ff9:	83 fb 20             	cmp    $0x20,%ebx
+  800ffc:	75 ec                	jne    800fea <close_all+0xc>
+}
+  800ffe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801001:	c9                   	leave
+  801002:	c3                   	ret
+
+00801003 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801003:	55                   	push   %ebp
+  801004:	89 e5                	mov    %esp,%ebp
+  801006:	57                   	push   %edi
+  801007:	56                   	push   %esi
+  801008:	53                   	push   %ebx
+  801009:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80100c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80100f:	50                   	push   %eax
+  801010:	ff 75 08             	push   0x8(%ebp)
+  801013:	e8 6f fe ff ff       	call   800e87 <fd_lookup>
+  801018:	89 c3                	mov    %eax,%ebx
+  80101a:	83 c4 10             	add    $0x10,%esp
+  80101d:	85 c0                	test   %eax,%eax
+  80101f:	78 7f                	js     8010a0 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801021:	83 ec 0c             	sub    $0xc,%esp
+  801024:	ff 75 0c             	push   0xc(%ebp)
+  801027:	e8 85 ff ff ff       	call   800fb1 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80102c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80102f:	c1 e6 0c             	shl    $0xc,%esi
+  801032:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801038:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80103b:	89 3c 24             	mov    %edi,(%esp)
+  80103e:	e8 d7 fd ff ff       	call   800e1a <fd2data>
+  801043:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801045:	89 34 24             	mov    %esi,(%esp)
+  801048:	e8 cd fd ff ff       	call   800e1a <fd2data>
+  80104d:	83 c4 10             	add    $0x10,%esp
+  801050:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801053:	89 d8                	mov    %ebx,%eax
+  801055:	c1 e8 16             	shr    $0x16,%eax
+  801058:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80105f:	a8 01                	test   $0x1,%al
+  801061:	74 11                	je     801074 <dup+0x71>
+  801063:	89 d8                	mov    %ebx,%eax
+  801065:	c1 e8 0c             	shr    $0xc,%eax
+  801068:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80106f:	f6 c2 01             	test   $0x1,%dl
+  801072:	75 36                	jne    8010aa <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801074:	89 f8                	mov    %edi,%eax
+  801076:	c1 e8 0c             	shr    $0xc,%eax
+  801079:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801080:	83 ec 0c             	sub    $0xc,%esp
+  801083:	25 07 0e 00 00       	and    $0xe07,%eax
+  801088:	50                   	push   %eax
+  801089:	56                   	push   %esi
+  80108a:	6a 00                	push   $0x0
+  80108c:	57                   	push   %edi
+  80108d:	6a 00                	push   $0x0
+  80108f:	e8 e6 fa ff ff       	call   800b7a <sys_page_map>
+  801094:	89 c3                	mov    %eax,%ebx
+  801096:	83 c4 20             	add    $0x20,%esp
+  801099:	85 c0                	test   %eax,%eax
+  80109b:	78 33                	js     8010d0 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80109d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8010a0:	89 d8                	mov    %ebx,%eax
+  8010a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010a5:	5b                   	pop    %ebx
+  8010a6:	5e                   	pop    %esi
+  8010a7:	5f                   	pop    %edi
+  8010a8:	5d                   	pop    %ebp
+  8010a9:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8010aa:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8010b1:	83 ec 0c             	sub    $0xc,%esp
+  8010b4:	25 07 0e 00 00       	and    $0xe07,%eax
+  8010b9:	50                   	push   %eax
+  8010ba:	ff 75 d4             	push   -0x2c(%ebp)
+  8010bd:	6a 00                	push   $0x0
+  8010bf:	53                   	push   %ebx
+  8010c0:	6a 00                	push   $0x0
+  8010c2:	e8 b3 fa ff ff       	call   800b7a <sys_page_map>
+  8010c7:	89 c3                	mov    %eax,%ebx
+  8010c9:	83 c4 20             	add    $0x20,%esp
+  8010cc:	85 c0                	test   %eax,%eax
+  8010ce:	79 a4                	jns    801074 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8010d0:	83 ec 08             	sub    $0x8,%esp
+  8010d3:	56                   	push   %esi
+  8010d4:	6a 00                	push   $0x0
+  8010d6:	e8 e1 fa ff ff       	call   800bbc <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8010db:	83 c4 08             	add    $0x8,%esp
+  8010de:	ff 75 d4             	push   -0x2c(%ebp)
+  8010e1:	6a 00                	push   $0x0
+  8010e3:	e8 d4 fa ff ff       	call   800bbc <sys_page_unmap>
+	return r;
+  8010e8:	83 c4 10             	add    $0x10,%esp
+  8010eb:	eb b3                	jmp    8010a0 <dup+0x9d>
+
+008010ed <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8010ed:	55                   	push   %ebp
+  8010ee:	89 e5                	mov    %esp,%ebp
+  8010f0:	56                   	push   %esi
+  8010f1:	53                   	push   %ebx
+  8010f2:	83 ec 18             	sub    $0x18,%esp
+  8010f5:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8010f8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8010fb:	50                   	push   %eax
+  8010fc:	56                   	push   %esi
+  8010fd:	e8 85 fd ff ff       	call   800e87 <fd_lookup>
+  801102:	83 c4 10             	add    $0x10,%esp
+  801105:	85 c0                	test   %eax,%eax
+  801107:	78 3c                	js     801145 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801109:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80110c:	83 ec 08             	sub    $0x8,%esp
+  80110f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801112:	50                   	push   %eax
+  801113:	ff 33                	push   (%ebx)
+  801115:	e8 bd fd ff ff       	call   800ed7 <dev_lookup>
+  80111a:	83 c4 10             	add    $0x10,%esp
+  80111d:	85 c0                	test   %eax,%eax
+  80111f:	78 24                	js     801145 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801121:	8b 43 08             	mov    0x8(%ebx),%eax
+  801124:	83 e0 03             	and    $0x3,%eax
+  801127:	83 f8 01             	cmp    $0x1,%eax
+  80112a:	74 20                	je     80114c <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80112c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80112f:	8b 40 08             	mov    0x8(%eax),%eax
+  801132:	85 c0                	test   %eax,%eax
+  801134:	74 37                	je     80116d <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801136:	83 ec 04             	sub    $0x4,%esp
+  801139:	ff 75 10             	push   0x10(%ebp)
+  80113c:	ff 75 0c             	push   0xc(%ebp)
+  80113f:	53                   	push   %ebx
+  801140:	ff d0                	call   *%eax
+  801142:	83 c4 10             	add    $0x10,%esp
+}
+  801145:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801148:	5b                   	pop    %ebx
+  801149:	5e                   	pop    %esi
+  80114a:	5d                   	pop    %ebp
+  80114b:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80114c:	a1 08 40 80 00       	mov    0x804008,%eax
+  801151:	8b 40 48             	mov    0x48(%eax),%eax
+  801154:	83 ec 04             	sub    $0x4,%esp
+  801157:	56                   	push   %esi
+  801158:	50                   	push   %eax
+  801159:	68 51 29 80 00       	push   $0x802951
+  80115e:	e8 2f f0 ff ff       	call   800192 <cprintf>
+		return -E_INVAL;
+  801163:	83 c4 10             	add    $0x10,%esp
+  801166:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80116b:	eb d8                	jmp    801145 <read+0x58>
+		return -E_NOT_SUPP;
+  80116d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801172:	eb d1                	jmp    801145 <read+0x58>
+
+00801174 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801174:	55                   	push   %ebp
+  801175:	89 e5                	mov    %esp,%ebp
+  801177:	57                   	push   %edi
+  801178:	56                   	push   %esi
+  801179:	53                   	push   %ebx
+  80117a:	83 ec 0c             	sub    $0xc,%esp
+  80117d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801180:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801183:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801188:	eb 02                	jmp    80118c <readn+0x18>
+  80118a:	01 c3                	add    %eax,%ebx
+  80118c:	39 f3                	cmp    %esi,%ebx
+  80118e:	73 21                	jae    8011b1 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801190:	83 ec 04             	sub    $0x4,%esp
+  801193:	89 f0                	mov    %esi,%eax
+  801195:	29 d8                	sub    %ebx,%eax
+  801197:	50                   	push   %eax
+  801198:	89 d8                	mov    %ebx,%eax
+  80119a:	03 45 0c             	add    0xc(%ebp),%eax
+  80119d:	50                   	push   %eax
+  80119e:	57                   	push   %edi
+  80119f:	e8 49 ff ff ff       	call   8010ed <read>
+		if (m < 0)
+  8011a4:	83 c4 10             	add    $0x10,%esp
+  8011a7:	85 c0                	test   %eax,%eax
+  8011a9:	78 04                	js     8011af <readn+0x3b>
+			return m;
+		if (m == 0)
+  8011ab:	75 dd                	jne    80118a <readn+0x16>
+  8011ad:	eb 02                	jmp    8011b1 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8011af:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8011b1:	89 d8                	mov    %ebx,%eax
+  8011b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011b6:	5b                   	pop    %ebx
+  8011b7:	5e                   	pop    %esi
+  8011b8:	5f                   	pop    %edi
+  8011b9:	5d                   	pop    %ebp
+  8011ba:	c3                   	ret
+
+008011bb <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8011bb:	55                   	push   %ebp
+  8011bc:	89 e5                	mov    %esp,%ebp
+  8011be:	56                   	push   %esi
+  8011bf:	53                   	push   %ebx
+  8011c0:	83 ec 18             	sub    $0x18,%esp
+  8011c3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8011c6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8011c9:	50                   	push   %eax
+  8011ca:	53                   	push   %ebx
+  8011cb:	e8 b7 fc ff ff       	call   800e87 <fd_lookup>
+  8011d0:	83 c4 10             	add    $0x10,%esp
+  8011d3:	85 c0                	test   %eax,%eax
+  8011d5:	78 37                	js     80120e <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8011d7:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8011da:	83 ec 08             	sub    $0x8,%esp
+  8011dd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8011e0:	50                   	push   %eax
+  8011e1:	ff 36                	push   (%esi)
+  8011e3:	e8 ef fc ff ff       	call   800ed7 <dev_lookup>
+  8011e8:	83 c4 10             	add    $0x10,%esp
+  8011eb:	85 c0                	test   %eax,%eax
+  8011ed:	78 1f                	js     80120e <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8011ef:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8011f3:	74 20                	je     801215 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8011f5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8011f8:	8b 40 0c             	mov    0xc(%eax),%eax
+  8011fb:	85 c0                	test   %eax,%eax
+  8011fd:	74 37                	je     801236 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8011ff:	83 ec 04             	sub    $0x4,%esp
+  801202:	ff 75 10             	push   0x10(%ebp)
+  801205:	ff 75 0c             	push   0xc(%ebp)
+  801208:	56                   	push   %esi
+  801209:	ff d0                	call   *%eax
+  80120b:	83 c4 10             	add    $0x10,%esp
+}
+  80120e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801211:	5b                   	pop    %ebx
+  801212:	5e                   	pop    %esi
+  801213:	5d                   	pop    %ebp
+  801214:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801215:	a1 08 40 80 00       	mov    0x804008,%eax
+  80121a:	8b 40 48             	mov    0x48(%eax),%eax
+  80121d:	83 ec 04             	sub    $0x4,%esp
+  801220:	53                   	push   %ebx
+  801221:	50                   	push   %eax
+  801222:	68 6d 29 80 00       	push   $0x80296d
+  801227:	e8 66 ef ff ff       	call   800192 <cprintf>
+		return -E_INVAL;
+  80122c:	83 c4 10             	add    $0x10,%esp
+  80122f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801234:	eb d8                	jmp    80120e <write+0x53>
+		return -E_NOT_SUPP;
+  801236:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80123b:	eb d1                	jmp    80120e <write+0x53>
+
+0080123d <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80123d:	55                   	push   %ebp
+  80123e:	89 e5                	mov    %esp,%ebp
+  801240:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801243:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801246:	50                   	push   %eax
+  801247:	ff 75 08             	push   0x8(%ebp)
+  80124a:	e8 38 fc ff ff       	call   800e87 <fd_lookup>
+  80124f:	83 c4 10             	add    $0x10,%esp
+  801252:	85 c0                	test   %eax,%eax
+  801254:	78 0e                	js     801264 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801256:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801259:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80125c:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80125f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801264:	c9                   	leave
+  801265:	c3                   	ret
+
+00801266 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801266:	55                   	push   %ebp
+  801267:	89 e5                	mov    %esp,%ebp
+  801269:	56                   	push   %esi
+  80126a:	53                   	push   %ebx
+  80126b:	83 ec 18             	sub    $0x18,%esp
+  80126e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801271:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801274:	50                   	push   %eax
+  801275:	53                   	push   %ebx
+  801276:	e8 0c fc ff ff       	call   800e87 <fd_lookup>
+  80127b:	83 c4 10             	add    $0x10,%esp
+  80127e:	85 c0                	test   %eax,%eax
+  801280:	78 34                	js     8012b6 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801282:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801285:	83 ec 08             	sub    $0x8,%esp
+  801288:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80128b:	50                   	push   %eax
+  80128c:	ff 36                	push   (%esi)
+  80128e:	e8 44 fc ff ff       	call   800ed7 <dev_lookup>
+  801293:	83 c4 10             	add    $0x10,%esp
+  801296:	85 c0                	test   %eax,%eax
+  801298:	78 1c                	js     8012b6 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80129a:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80129e:	74 1d                	je     8012bd <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8012a0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8012a3:	8b 40 18             	mov    0x18(%eax),%eax
+  8012a6:	85 c0                	test   %eax,%eax
+  8012a8:	74 34                	je     8012de <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8012aa:	83 ec 08             	sub    $0x8,%esp
+  8012ad:	ff 75 0c             	push   0xc(%ebp)
+  8012b0:	56                   	push   %esi
+  8012b1:	ff d0                	call   *%eax
+  8012b3:	83 c4 10             	add    $0x10,%esp
+}
+  8012b6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8012b9:	5b                   	pop    %ebx
+  8012ba:	5e                   	pop    %esi
+  8012bb:	5d                   	pop    %ebp
+  8012bc:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8012bd:	a1 08 40 80 00       	mov    0x804008,%eax
+  8012c2:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8012c5:	83 ec 04             	sub    $0x4,%esp
+  8012c8:	53                   	push   %ebx
+  8012c9:	50                   	push   %eax
+  8012ca:	68 30 29 80 00       	push   $0x802930
+  8012cf:	e8 be ee ff ff       	call   800192 <cprintf>
+		return -E_INVAL;
+  8012d4:	83 c4 10             	add    $0x10,%esp
+  8012d7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012dc:	eb d8                	jmp    8012b6 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8012de:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8012e3:	eb d1                	jmp    8012b6 <ftruncate+0x50>
+
+008012e5 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8012e5:	55                   	push   %ebp
+  8012e6:	89 e5                	mov    %esp,%ebp
+  8012e8:	56                   	push   %esi
+  8012e9:	53                   	push   %ebx
+  8012ea:	83 ec 18             	sub    $0x18,%esp
+  8012ed:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8012f0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8012f3:	50                   	push   %eax
+  8012f4:	ff 75 08             	push   0x8(%ebp)
+  8012f7:	e8 8b fb ff ff       	call   800e87 <fd_lookup>
+  8012fc:	83 c4 10             	add    $0x10,%esp
+  8012ff:	85 c0                	test   %eax,%eax
+  801301:	78 49                	js     80134c <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801303:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801306:	83 ec 08             	sub    $0x8,%esp
+  801309:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80130c:	50                   	push   %eax
+  80130d:	ff 36                	push   (%esi)
+  80130f:	e8 c3 fb ff ff       	call   800ed7 <dev_lookup>
+  801314:	83 c4 10             	add    $0x10,%esp
+  801317:	85 c0                	test   %eax,%eax
+  801319:	78 31                	js     80134c <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  80131b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80131e:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801322:	74 2f                	je     801353 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801324:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801327:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80132e:	00 00 00 
+	stat->st_isdir = 0;
+  801331:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801338:	00 00 00 
+	stat->st_dev = dev;
+  80133b:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801341:	83 ec 08             	sub    $0x8,%esp
+  801344:	53                   	push   %ebx
+  801345:	56                   	push   %esi
+  801346:	ff 50 14             	call   *0x14(%eax)
+  801349:	83 c4 10             	add    $0x10,%esp
+}
+  80134c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80134f:	5b                   	pop    %ebx
+  801350:	5e                   	pop    %esi
+  801351:	5d                   	pop    %ebp
+  801352:	c3                   	ret
+		return -E_NOT_SUPP;
+  801353:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801358:	eb f2                	jmp    80134c <fstat+0x67>
+
+0080135a <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80135a:	55                   	push   %ebp
+  80135b:	89 e5                	mov    %esp,%ebp
+  80135d:	56                   	push   %esi
+  80135e:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80135f:	83 ec 08             	sub    $0x8,%esp
+  801362:	6a 00                	push   $0x0
+  801364:	ff 75 08             	push   0x8(%ebp)
+  801367:	e8 e4 01 00 00       	call   801550 <open>
+  80136c:	89 c3                	mov    %eax,%ebx
+  80136e:	83 c4 10             	add    $0x10,%esp
+  801371:	85 c0                	test   %eax,%eax
+  801373:	78 1b                	js     801390 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801375:	83 ec 08             	sub    $0x8,%esp
+  801378:	ff 75 0c             	push   0xc(%ebp)
+  80137b:	50                   	push   %eax
+  80137c:	e8 64 ff ff ff       	call   8012e5 <fstat>
+  801381:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801383:	89 1c 24             	mov    %ebx,(%esp)
+  801386:	e8 26 fc ff ff       	call   800fb1 <close>
+	return r;
+  80138b:	83 c4 10             	add    $0x10,%esp
+  80138e:	89 f3                	mov    %esi,%ebx
+}
+  801390:	89 d8                	mov    %ebx,%eax
+  801392:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801395:	5b                   	pop    %ebx
+  801396:	5e                   	pop    %esi
+  801397:	5d                   	pop    %ebp
+  801398:	c3                   	ret
+
+00801399 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  801399:	55                   	push   %ebp
+  80139a:	89 e5                	mov    %esp,%ebp
+  80139c:	56                   	push   %esi
+  80139d:	53                   	push   %ebx
+  80139e:	89 c6                	mov    %eax,%esi
+  8013a0:	89 d3                	mov    %edx,%ebx
+  static envid_t fsenv;
+  if (fsenv == 0)
+  8013a2:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  8013a9:	74 27                	je     8013d2 <fsipc+0x39>
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *) &fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8013ab:	6a 07                	push   $0x7
+  8013ad:	68 00 50 80 00       	push   $0x805000
+  8013b2:	56                   	push   %esi
+  8013b3:	ff 35 00 40 80 00    	push   0x804000
+  8013b9:	e8 17 0c 00 00       	call   801fd5 <ipc_send>
+  return ipc_recv(NULL, dstva, NULL);
+  8013be:	83 c4 0c             	add    $0xc,%esp
+  8013c1:	6a 00                	push   $0x0
+  8013c3:	53                   	push   %ebx
+  8013c4:	6a 00                	push   $0x0
+  8013c6:	e8 96 0b 00 00       	call   801f61 <ipc_recv>
+}
+  8013cb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013ce:	5b                   	pop    %ebx
+  8013cf:	5e                   	pop    %esi
+  8013d0:	5d                   	pop    %ebp
+  8013d1:	c3                   	ret
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  8013d2:	83 ec 0c             	sub    $0xc,%esp
+  8013d5:	6a 01                	push   $0x1
+  8013d7:	e8 4d 0c 00 00       	call   802029 <ipc_find_env>
+  8013dc:	a3 00 40 80 00       	mov    %eax,0x804000
+  8013e1:	83 c4 10             	add    $0x10,%esp
+  8013e4:	eb c5                	jmp    8013ab <fsipc+0x12>
+
+008013e6 <devfile_trunc>:
+  return 0;
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8013e6:	55                   	push   %ebp
+  8013e7:	89 e5                	mov    %esp,%ebp
+  8013e9:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8013ec:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013ef:	8b 40 0c             	mov    0xc(%eax),%eax
+  8013f2:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.set_size.req_size = newsize;
+  8013f7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8013fa:	a3 04 50 80 00       	mov    %eax,0x805004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  8013ff:	ba 00 00 00 00       	mov    $0x0,%edx
+  801404:	b8 02 00 00 00       	mov    $0x2,%eax
+  801409:	e8 8b ff ff ff       	call   801399 <fsipc>
+}
+  80140e:	c9                   	leave
+  80140f:	c3                   	ret
+
+00801410 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801410:	55                   	push   %ebp
+  801411:	89 e5                	mov    %esp,%ebp
+  801413:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801416:	8b 45 08             	mov    0x8(%ebp),%eax
+  801419:	8b 40 0c             	mov    0xc(%eax),%eax
+  80141c:	a3 00 50 80 00       	mov    %eax,0x805000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801421:	ba 00 00 00 00       	mov    $0x0,%edx
+  801426:	b8 06 00 00 00       	mov    $0x6,%eax
+  80142b:	e8 69 ff ff ff       	call   801399 <fsipc>
+}
+  801430:	c9                   	leave
+  801431:	c3                   	ret
+
+00801432 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801432:	55                   	push   %ebp
+  801433:	89 e5                	mov    %esp,%ebp
+  801435:	53                   	push   %ebx
+  801436:	83 ec 04             	sub    $0x4,%esp
+  801439:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80143c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80143f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801442:	a3 00 50 80 00       	mov    %eax,0x805000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801447:	ba 00 00 00 00       	mov    $0x0,%edx
+  80144c:	b8 05 00 00 00       	mov    $0x5,%eax
+  801451:	e8 43 ff ff ff       	call   801399 <fsipc>
+  801456:	85 c0                	test   %eax,%eax
+  801458:	78 2c                	js     801486 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80145a:	83 ec 08             	sub    $0x8,%esp
+  80145d:	68 00 50 80 00       	push   $0x805000
+  801462:	53                   	push   %ebx
+  801463:	e8 e3 f2 ff ff       	call   80074b <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801468:	a1 80 50 80 00       	mov    0x805080,%eax
+  80146d:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801473:	a1 84 50 80 00       	mov    0x805084,%eax
+  801478:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  80147e:	83 c4 10             	add    $0x10,%esp
+  801481:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801486:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801489:	c9                   	leave
+  80148a:	c3                   	ret
+
+0080148b <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80148b:	55                   	push   %ebp
+  80148c:	89 e5                	mov    %esp,%ebp
+  80148e:	83 ec 0c             	sub    $0xc,%esp
+  801491:	8b 45 10             	mov    0x10(%ebp),%eax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801494:	8b 55 08             	mov    0x8(%ebp),%edx
+  801497:	8b 52 0c             	mov    0xc(%edx),%edx
+  80149a:	89 15 00 50 80 00    	mov    %edx,0x805000
+  fsipcbuf.write.req_n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8014a0:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8014a5:	39 d0                	cmp    %edx,%eax
+  8014a7:	0f 47 c2             	cmova  %edx,%eax
+  8014aa:	a3 04 50 80 00       	mov    %eax,0x805004
+  memmove(fsipcbuf.write.req_buf, buf, fsipcbuf.write.req_n);
+  8014af:	50                   	push   %eax
+  8014b0:	ff 75 0c             	push   0xc(%ebp)
+  8014b3:	68 08 50 80 00       	push   $0x805008
+  8014b8:	e8 14 f4 ff ff       	call   8008d1 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  8014bd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014c2:	b8 04 00 00 00       	mov    $0x4,%eax
+  8014c7:	e8 cd fe ff ff       	call   801399 <fsipc>
+}
+  8014cc:	c9                   	leave
+  8014cd:	c3                   	ret
+
+008014ce <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8014ce:	55                   	push   %ebp
+  8014cf:	89 e5                	mov    %esp,%ebp
+  8014d1:	56                   	push   %esi
+  8014d2:	53                   	push   %ebx
+  8014d3:	8b 75 10             	mov    0x10(%ebp),%esi
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8014d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014d9:	8b 40 0c             	mov    0xc(%eax),%eax
+  8014dc:	a3 00 50 80 00       	mov    %eax,0x805000
+  fsipcbuf.read.req_n = n;
+  8014e1:	89 35 04 50 80 00    	mov    %esi,0x805004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8014e7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014ec:	b8 03 00 00 00       	mov    $0x3,%eax
+  8014f1:	e8 a3 fe ff ff       	call   801399 <fsipc>
+  8014f6:	89 c3                	mov    %eax,%ebx
+  8014f8:	85 c0                	test   %eax,%eax
+  8014fa:	78 1f                	js     80151b <devfile_read+0x4d>
+  assert(r <= n);
+  8014fc:	39 c6                	cmp    %eax,%esi
+  8014fe:	72 24                	jb     801524 <devfile_read+0x56>
+  assert(r <= PGSIZE);
+  801500:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801505:	7f 33                	jg     80153a <devfile_read+0x6c>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801507:	83 ec 04             	sub    $0x4,%esp
+  80150a:	50                   	push   %eax
+  80150b:	68 00 50 80 00       	push   $0x805000
+  801510:	ff 75 0c             	push   0xc(%ebp)
+  801513:	e8 b9 f3 ff ff       	call   8008d1 <memmove>
+  return r;
+  801518:	83 c4 10             	add    $0x10,%esp
+}
+  80151b:	89 d8                	mov    %ebx,%eax
+  80151d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801520:	5b                   	pop    %ebx
+  801521:	5e                   	pop    %esi
+  801522:	5d                   	pop    %ebp
+  801523:	c3                   	ret
+  assert(r <= n);
+  801524:	68 a0 29 80 00       	push   $0x8029a0
+  801529:	68 a7 29 80 00       	push   $0x8029a7
+  80152e:	6a 78                	push   $0x78
+  801530:	68 bc 29 80 00       	push   $0x8029bc
+  801535:	e8 e1 09 00 00       	call   801f1b <_panic>
+  assert(r <= PGSIZE);
+  80153a:	68 c7 29 80 00       	push   $0x8029c7
+  80153f:	68 a7 29 80 00       	push   $0x8029a7
+  801544:	6a 79                	push   $0x79
+  801546:	68 bc 29 80 00       	push   $0x8029bc
+  80154b:	e8 cb 09 00 00       	call   801f1b <_panic>
+
+00801550 <open>:
+open(const char *path, int mode) {
+  801550:	55                   	push   %ebp
+  801551:	89 e5                	mov    %esp,%ebp
+  801553:	56                   	push   %esi
+  801554:	53                   	push   %ebx
+  801555:	83 ec 1c             	sub    $0x1c,%esp
+  801558:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  80155b:	56                   	push   %esi
+  80155c:	e8 af f1 ff ff       	call   800710 <strlen>
+  801561:	83 c4 10             	add    $0x10,%esp
+  801564:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801569:	7f 6c                	jg     8015d7 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  80156b:	83 ec 0c             	sub    $0xc,%esp
+  80156e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801571:	50                   	push   %eax
+  801572:	e8 ba f8 ff ff       	call   800e31 <fd_alloc>
+  801577:	89 c3                	mov    %eax,%ebx
+  801579:	83 c4 10             	add    $0x10,%esp
+  80157c:	85 c0                	test   %eax,%eax
+  80157e:	78 3c                	js     8015bc <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801580:	83 ec 08             	sub    $0x8,%esp
+  801583:	56                   	push   %esi
+  801584:	68 00 50 80 00       	push   $0x805000
+  801589:	e8 bd f1 ff ff       	call   80074b <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  80158e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801591:	a3 00 54 80 00       	mov    %eax,0x805400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801596:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801599:	b8 01 00 00 00       	mov    $0x1,%eax
+  80159e:	e8 f6 fd ff ff       	call   801399 <fsipc>
+  8015a3:	89 c3                	mov    %eax,%ebx
+  8015a5:	83 c4 10             	add    $0x10,%esp
+  8015a8:	85 c0                	test   %eax,%eax
+  8015aa:	78 19                	js     8015c5 <open+0x75>
+  return fd2num(fd);
+  8015ac:	83 ec 0c             	sub    $0xc,%esp
+  8015af:	ff 75 f4             	push   -0xc(%ebp)
+  8015b2:	e8 53 f8 ff ff       	call   800e0a <fd2num>
+  8015b7:	89 c3                	mov    %eax,%ebx
+  8015b9:	83 c4 10             	add    $0x10,%esp
+}
+  8015bc:	89 d8                	mov    %ebx,%eax
+  8015be:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015c1:	5b                   	pop    %ebx
+  8015c2:	5e                   	pop    %esi
+  8015c3:	5d                   	pop    %ebp
+  8015c4:	c3                   	ret
+    fd_close(fd, 0);
+  8015c5:	83 ec 08             	sub    $0x8,%esp
+  8015c8:	6a 00                	push   $0x0
+  8015ca:	ff 75 f4             	push   -0xc(%ebp)
+  8015cd:	e8 58 f9 ff ff       	call   800f2a <fd_close>
+    return r;
+  8015d2:	83 c4 10             	add    $0x10,%esp
+  8015d5:	eb e5                	jmp    8015bc <open+0x6c>
+    return -E_BAD_PATH;
+  8015d7:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8015dc:	eb de                	jmp    8015bc <open+0x6c>
+
+008015de <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  8015de:	55                   	push   %ebp
+  8015df:	89 e5                	mov    %esp,%ebp
+  8015e1:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  8015e4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015e9:	b8 08 00 00 00       	mov    $0x8,%eax
+  8015ee:	e8 a6 fd ff ff       	call   801399 <fsipc>
+}
+  8015f3:	c9                   	leave
+  8015f4:	c3                   	ret
+
+008015f5 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8015f5:	55                   	push   %ebp
+  8015f6:	89 e5                	mov    %esp,%ebp
+  8015f8:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8015fb:	68 d3 29 80 00       	push   $0x8029d3
+  801600:	ff 75 0c             	push   0xc(%ebp)
+  801603:	e8 43 f1 ff ff       	call   80074b <strcpy>
+	return 0;
+}
+  801608:	b8 00 00 00 00       	mov    $0x0,%eax
+  80160d:	c9                   	leave
+  80160e:	c3                   	ret
+
+0080160f <devsock_close>:
+{
+  80160f:	55                   	push   %ebp
+  801610:	89 e5                	mov    %esp,%ebp
+  801612:	53                   	push   %ebx
+  801613:	83 ec 10             	sub    $0x10,%esp
+  801616:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801619:	53                   	push   %ebx
+  80161a:	e8 49 0a 00 00       	call   802068 <pageref>
+  80161f:	89 c2                	mov    %eax,%edx
+  801621:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801624:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801629:	83 fa 01             	cmp    $0x1,%edx
+  80162c:	74 05                	je     801633 <devsock_close+0x24>
+}
+  80162e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801631:	c9                   	leave
+  801632:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801633:	83 ec 0c             	sub    $0xc,%esp
+  801636:	ff 73 0c             	push   0xc(%ebx)
+  801639:	e8 b7 02 00 00       	call   8018f5 <nsipc_close>
+  80163e:	83 c4 10             	add    $0x10,%esp
+  801641:	eb eb                	jmp    80162e <devsock_close+0x1f>
+
+00801643 <devsock_write>:
+{
+  801643:	55                   	push   %ebp
+  801644:	89 e5                	mov    %esp,%ebp
+  801646:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801649:	6a 00                	push   $0x0
+  80164b:	ff 75 10             	push   0x10(%ebp)
+  80164e:	ff 75 0c             	push   0xc(%ebp)
+  801651:	8b 45 08             	mov    0x8(%ebp),%eax
+  801654:	ff 70 0c             	push   0xc(%eax)
+  801657:	e8 79 03 00 00       	call   8019d5 <nsipc_send>
+}
+  80165c:	c9                   	leave
+  80165d:	c3                   	ret
+
+0080165e <devsock_read>:
+{
+  80165e:	55                   	push   %ebp
+  80165f:	89 e5                	mov    %esp,%ebp
+  801661:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801664:	6a 00                	push   $0x0
+  801666:	ff 75 10             	push   0x10(%ebp)
+  801669:	ff 75 0c             	push   0xc(%ebp)
+  80166c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80166f:	ff 70 0c             	push   0xc(%eax)
+  801672:	e8 ef 02 00 00       	call   801966 <nsipc_recv>
+}
+  801677:	c9                   	leave
+  801678:	c3                   	ret
+
+00801679 <fd2sockid>:
+{
+  801679:	55                   	push   %ebp
+  80167a:	89 e5                	mov    %esp,%ebp
+  80167c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  80167f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801682:	52                   	push   %edx
+  801683:	50                   	push   %eax
+  801684:	e8 fe f7 ff ff       	call   800e87 <fd_lookup>
+  801689:	83 c4 10             	add    $0x10,%esp
+  80168c:	85 c0                	test   %eax,%eax
+  80168e:	78 10                	js     8016a0 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801690:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801693:	8b 0d 20 30 80 00    	mov    0x803020,%ecx
+  801699:	39 08                	cmp    %ecx,(%eax)
+  80169b:	75 05                	jne    8016a2 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  80169d:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8016a0:	c9                   	leave
+  8016a1:	c3                   	ret
+		return -E_NOT_SUPP;
+  8016a2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016a7:	eb f7                	jmp    8016a0 <fd2sockid+0x27>
+
+008016a9 <alloc_sockfd>:
+{
+  8016a9:	55                   	push   %ebp
+  8016aa:	89 e5                	mov    %esp,%ebp
+  8016ac:	56                   	push   %esi
+  8016ad:	53                   	push   %ebx
+  8016ae:	83 ec 1c             	sub    $0x1c,%esp
+  8016b1:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8016b3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016b6:	50                   	push   %eax
+  8016b7:	e8 75 f7 ff ff       	call   800e31 <fd_alloc>
+  8016bc:	89 c3                	mov    %eax,%ebx
+  8016be:	83 c4 10             	add    $0x10,%esp
+  8016c1:	85 c0                	test   %eax,%eax
+  8016c3:	78 43                	js     801708 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8016c5:	83 ec 04             	sub    $0x4,%esp
+  8016c8:	68 07 04 00 00       	push   $0x407
+  8016cd:	ff 75 f4             	push   -0xc(%ebp)
+  8016d0:	6a 00                	push   $0x0
+  8016d2:	e8 60 f4 ff ff       	call   800b37 <sys_page_alloc>
+  8016d7:	89 c3                	mov    %eax,%ebx
+  8016d9:	83 c4 10             	add    $0x10,%esp
+  8016dc:	85 c0                	test   %eax,%eax
+  8016de:	78 28                	js     801708 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8016e0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016e3:	8b 15 20 30 80 00    	mov    0x803020,%edx
+  8016e9:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8016eb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016ee:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8016f5:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8016f8:	83 ec 0c             	sub    $0xc,%esp
+  8016fb:	50                   	push   %eax
+  8016fc:	e8 09 f7 ff ff       	call   800e0a <fd2num>
+  801701:	89 c3                	mov    %eax,%ebx
+  801703:	83 c4 10             	add    $0x10,%esp
+  801706:	eb 0c                	jmp    801714 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801708:	83 ec 0c             	sub    $0xc,%esp
+  80170b:	56                   	push   %esi
+  80170c:	e8 e4 01 00 00       	call   8018f5 <nsipc_close>
+		return r;
+  801711:	83 c4 10             	add    $0x10,%esp
+}
+  801714:	89 d8                	mov    %ebx,%eax
+  801716:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801719:	5b                   	pop    %ebx
+  80171a:	5e                   	pop    %esi
+  80171b:	5d                   	pop    %ebp
+  80171c:	c3                   	ret
+
+0080171d <accept>:
+{
+  80171d:	55                   	push   %ebp
+  80171e:	89 e5                	mov    %esp,%ebp
+  801720:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801723:	8b 45 08             	mov    0x8(%ebp),%eax
+  801726:	e8 4e ff ff ff       	call   801679 <fd2sockid>
+  80172b:	85 c0                	test   %eax,%eax
+  80172d:	78 1b                	js     80174a <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  80172f:	83 ec 04             	sub    $0x4,%esp
+  801732:	ff 75 10             	push   0x10(%ebp)
+  801735:	ff 75 0c             	push   0xc(%ebp)
+  801738:	50                   	push   %eax
+  801739:	e8 0e 01 00 00       	call   80184c <nsipc_accept>
+  80173e:	83 c4 10             	add    $0x10,%esp
+  801741:	85 c0                	test   %eax,%eax
+  801743:	78 05                	js     80174a <accept+0x2d>
+	return alloc_sockfd(r);
+  801745:	e8 5f ff ff ff       	call   8016a9 <alloc_sockfd>
+}
+  80174a:	c9                   	leave
+  80174b:	c3                   	ret
+
+0080174c <bind>:
+{
+  80174c:	55                   	push   %ebp
+  80174d:	89 e5                	mov    %esp,%ebp
+  80174f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801752:	8b 45 08             	mov    0x8(%ebp),%eax
+  801755:	e8 1f ff ff ff       	call   801679 <fd2sockid>
+  80175a:	85 c0                	test   %eax,%eax
+  80175c:	78 12                	js     801770 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  80175e:	83 ec 04             	sub    $0x4,%esp
+  801761:	ff 75 10             	push   0x10(%ebp)
+  801764:	ff 75 0c             	push   0xc(%ebp)
+  801767:	50                   	push   %eax
+  801768:	e8 31 01 00 00       	call   80189e <nsipc_bind>
+  80176d:	83 c4 10             	add    $0x10,%esp
+}
+  801770:	c9                   	leave
+  801771:	c3                   	ret
+
+00801772 <shutdown>:
+{
+  801772:	55                   	push   %ebp
+  801773:	89 e5                	mov    %esp,%ebp
+  801775:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801778:	8b 45 08             	mov    0x8(%ebp),%eax
+  80177b:	e8 f9 fe ff ff       	call   801679 <fd2sockid>
+  801780:	85 c0                	test   %eax,%eax
+  801782:	78 0f                	js     801793 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801784:	83 ec 08             	sub    $0x8,%esp
+  801787:	ff 75 0c             	push   0xc(%ebp)
+  80178a:	50                   	push   %eax
+  80178b:	e8 43 01 00 00       	call   8018d3 <nsipc_shutdown>
+  801790:	83 c4 10             	add    $0x10,%esp
+}
+  801793:	c9                   	leave
+  801794:	c3                   	ret
+
+00801795 <connect>:
+{
+  801795:	55                   	push   %ebp
+  801796:	89 e5                	mov    %esp,%ebp
+  801798:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80179b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80179e:	e8 d6 fe ff ff       	call   801679 <fd2sockid>
+  8017a3:	85 c0                	test   %eax,%eax
+  8017a5:	78 12                	js     8017b9 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8017a7:	83 ec 04             	sub    $0x4,%esp
+  8017aa:	ff 75 10             	push   0x10(%ebp)
+  8017ad:	ff 75 0c             	push   0xc(%ebp)
+  8017b0:	50                   	push   %eax
+  8017b1:	e8 59 01 00 00       	call   80190f <nsipc_connect>
+  8017b6:	83 c4 10             	add    $0x10,%esp
+}
+  8017b9:	c9                   	leave
+  8017ba:	c3                   	ret
+
+008017bb <listen>:
+{
+  8017bb:	55                   	push   %ebp
+  8017bc:	89 e5                	mov    %esp,%ebp
+  8017be:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8017c1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017c4:	e8 b0 fe ff ff       	call   801679 <fd2sockid>
+  8017c9:	85 c0                	test   %eax,%eax
+  8017cb:	78 0f                	js     8017dc <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8017cd:	83 ec 08             	sub    $0x8,%esp
+  8017d0:	ff 75 0c             	push   0xc(%ebp)
+  8017d3:	50                   	push   %eax
+  8017d4:	e8 6b 01 00 00       	call   801944 <nsipc_listen>
+  8017d9:	83 c4 10             	add    $0x10,%esp
+}
+  8017dc:	c9                   	leave
+  8017dd:	c3                   	ret
+
+008017de <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8017de:	55                   	push   %ebp
+  8017df:	89 e5                	mov    %esp,%ebp
+  8017e1:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8017e4:	ff 75 10             	push   0x10(%ebp)
+  8017e7:	ff 75 0c             	push   0xc(%ebp)
+  8017ea:	ff 75 08             	push   0x8(%ebp)
+  8017ed:	e8 41 02 00 00       	call   801a33 <nsipc_socket>
+  8017f2:	83 c4 10             	add    $0x10,%esp
+  8017f5:	85 c0                	test   %eax,%eax
+  8017f7:	78 05                	js     8017fe <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8017f9:	e8 ab fe ff ff       	call   8016a9 <alloc_sockfd>
+}
+  8017fe:	c9                   	leave
+  8017ff:	c3                   	ret
+
+00801800 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801800:	55                   	push   %ebp
+  801801:	89 e5                	mov    %esp,%ebp
+  801803:	53                   	push   %ebx
+  801804:	83 ec 04             	sub    $0x4,%esp
+  801807:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801809:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  801810:	74 26                	je     801838 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801812:	6a 07                	push   $0x7
+  801814:	68 00 60 80 00       	push   $0x806000
+  801819:	53                   	push   %ebx
+  80181a:	ff 35 04 40 80 00    	push   0x804004
+  801820:	e8 b0 07 00 00       	call   801fd5 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801825:	83 c4 0c             	add    $0xc,%esp
+  801828:	6a 00                	push   $0x0
+  80182a:	6a 00                	push   $0x0
+  80182c:	6a 00                	push   $0x0
+  80182e:	e8 2e 07 00 00       	call   801f61 <ipc_recv>
+}
+  801833:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801836:	c9                   	leave
+  801837:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801838:	83 ec 0c             	sub    $0xc,%esp
+  80183b:	6a 02                	push   $0x2
+  80183d:	e8 e7 07 00 00       	call   802029 <ipc_find_env>
+  801842:	a3 04 40 80 00       	mov    %eax,0x804004
+  801847:	83 c4 10             	add    $0x10,%esp
+  80184a:	eb c6                	jmp    801812 <nsipc+0x12>
+
+0080184c <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  80184c:	55                   	push   %ebp
+  80184d:	89 e5                	mov    %esp,%ebp
+  80184f:	56                   	push   %esi
+  801850:	53                   	push   %ebx
+  801851:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801854:	8b 45 08             	mov    0x8(%ebp),%eax
+  801857:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  80185c:	8b 06                	mov    (%esi),%eax
+  80185e:	a3 04 60 80 00       	mov    %eax,0x806004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801863:	b8 01 00 00 00       	mov    $0x1,%eax
+  801868:	e8 93 ff ff ff       	call   801800 <nsipc>
+  80186d:	89 c3                	mov    %eax,%ebx
+  80186f:	85 c0                	test   %eax,%eax
+  801871:	79 09                	jns    80187c <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801873:	89 d8                	mov    %ebx,%eax
+  801875:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801878:	5b                   	pop    %ebx
+  801879:	5e                   	pop    %esi
+  80187a:	5d                   	pop    %ebp
+  80187b:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  80187c:	83 ec 04             	sub    $0x4,%esp
+  80187f:	ff 35 10 60 80 00    	push   0x806010
+  801885:	68 00 60 80 00       	push   $0x806000
+  80188a:	ff 75 0c             	push   0xc(%ebp)
+  80188d:	e8 3f f0 ff ff       	call   8008d1 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801892:	a1 10 60 80 00       	mov    0x806010,%eax
+  801897:	89 06                	mov    %eax,(%esi)
+  801899:	83 c4 10             	add    $0x10,%esp
+	return r;
+  80189c:	eb d5                	jmp    801873 <nsipc_accept+0x27>
+
+0080189e <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80189e:	55                   	push   %ebp
+  80189f:	89 e5                	mov    %esp,%ebp
+  8018a1:	53                   	push   %ebx
+  8018a2:	83 ec 08             	sub    $0x8,%esp
+  8018a5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8018a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018ab:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8018b0:	53                   	push   %ebx
+  8018b1:	ff 75 0c             	push   0xc(%ebp)
+  8018b4:	68 04 60 80 00       	push   $0x806004
+  8018b9:	e8 13 f0 ff ff       	call   8008d1 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8018be:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_BIND);
+  8018c4:	b8 02 00 00 00       	mov    $0x2,%eax
+  8018c9:	e8 32 ff ff ff       	call   801800 <nsipc>
+}
+  8018ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018d1:	c9                   	leave
+  8018d2:	c3                   	ret
+
+008018d3 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8018d3:	55                   	push   %ebp
+  8018d4:	89 e5                	mov    %esp,%ebp
+  8018d6:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8018d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018dc:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.shutdown.req_how = how;
+  8018e1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8018e4:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_SHUTDOWN);
+  8018e9:	b8 03 00 00 00       	mov    $0x3,%eax
+  8018ee:	e8 0d ff ff ff       	call   801800 <nsipc>
+}
+  8018f3:	c9                   	leave
+  8018f4:	c3                   	ret
+
+008018f5 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8018f5:	55                   	push   %ebp
+  8018f6:	89 e5                	mov    %esp,%ebp
+  8018f8:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8018fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018fe:	a3 00 60 80 00       	mov    %eax,0x806000
+	return nsipc(NSREQ_CLOSE);
+  801903:	b8 04 00 00 00       	mov    $0x4,%eax
+  801908:	e8 f3 fe ff ff       	call   801800 <nsipc>
+}
+  80190d:	c9                   	leave
+  80190e:	c3                   	ret
+
+0080190f <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80190f:	55                   	push   %ebp
+  801910:	89 e5                	mov    %esp,%ebp
+  801912:	53                   	push   %ebx
+  801913:	83 ec 08             	sub    $0x8,%esp
+  801916:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801919:	8b 45 08             	mov    0x8(%ebp),%eax
+  80191c:	a3 00 60 80 00       	mov    %eax,0x806000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801921:	53                   	push   %ebx
+  801922:	ff 75 0c             	push   0xc(%ebp)
+  801925:	68 04 60 80 00       	push   $0x806004
+  80192a:	e8 a2 ef ff ff       	call   8008d1 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  80192f:	89 1d 14 60 80 00    	mov    %ebx,0x806014
+	return nsipc(NSREQ_CONNECT);
+  801935:	b8 05 00 00 00       	mov    $0x5,%eax
+  80193a:	e8 c1 fe ff ff       	call   801800 <nsipc>
+}
+  80193f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801942:	c9                   	leave
+  801943:	c3                   	ret
+
+00801944 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801944:	55                   	push   %ebp
+  801945:	89 e5                	mov    %esp,%ebp
+  801947:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  80194a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80194d:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.listen.req_backlog = backlog;
+  801952:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801955:	a3 04 60 80 00       	mov    %eax,0x806004
+	return nsipc(NSREQ_LISTEN);
+  80195a:	b8 06 00 00 00       	mov    $0x6,%eax
+  80195f:	e8 9c fe ff ff       	call   801800 <nsipc>
+}
+  801964:	c9                   	leave
+  801965:	c3                   	ret
+
+00801966 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801966:	55                   	push   %ebp
+  801967:	89 e5                	mov    %esp,%ebp
+  801969:	56                   	push   %esi
+  80196a:	53                   	push   %ebx
+  80196b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80196e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801971:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.recv.req_len = len;
+  801976:	89 35 04 60 80 00    	mov    %esi,0x806004
+	nsipcbuf.recv.req_flags = flags;
+  80197c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80197f:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801984:	b8 07 00 00 00       	mov    $0x7,%eax
+  801989:	e8 72 fe ff ff       	call   801800 <nsipc>
+  80198e:	89 c3                	mov    %eax,%ebx
+  801990:	85 c0                	test   %eax,%eax
+  801992:	78 22                	js     8019b6 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801994:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801999:	39 c6                	cmp    %eax,%esi
+  80199b:	0f 4e c6             	cmovle %esi,%eax
+  80199e:	39 c3                	cmp    %eax,%ebx
+  8019a0:	7f 1d                	jg     8019bf <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8019a2:	83 ec 04             	sub    $0x4,%esp
+  8019a5:	53                   	push   %ebx
+  8019a6:	68 00 60 80 00       	push   $0x806000
+  8019ab:	ff 75 0c             	push   0xc(%ebp)
+  8019ae:	e8 1e ef ff ff       	call   8008d1 <memmove>
+  8019b3:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8019b6:	89 d8                	mov    %ebx,%eax
+  8019b8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019bb:	5b                   	pop    %ebx
+  8019bc:	5e                   	pop    %esi
+  8019bd:	5d                   	pop    %ebp
+  8019be:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8019bf:	68 df 29 80 00       	push   $0x8029df
+  8019c4:	68 a7 29 80 00       	push   $0x8029a7
+  8019c9:	6a 62                	push   $0x62
+  8019cb:	68 f4 29 80 00       	push   $0x8029f4
+  8019d0:	e8 46 05 00 00       	call   801f1b <_panic>
+
+008019d5 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8019d5:	55                   	push   %ebp
+  8019d6:	89 e5                	mov    %esp,%ebp
+  8019d8:	53                   	push   %ebx
+  8019d9:	83 ec 04             	sub    $0x4,%esp
+  8019dc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8019df:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019e2:	a3 00 60 80 00       	mov    %eax,0x806000
+	assert(size < 1600);
+  8019e7:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8019ed:	7f 2e                	jg     801a1d <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8019ef:	83 ec 04             	sub    $0x4,%esp
+  8019f2:	53                   	push   %ebx
+  8019f3:	ff 75 0c             	push   0xc(%ebp)
+  8019f6:	68 0c 60 80 00       	push   $0x80600c
+  8019fb:	e8 d1 ee ff ff       	call   8008d1 <memmove>
+	nsipcbuf.send.req_size = size;
+  801a00:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	nsipcbuf.send.req_flags = flags;
+  801a06:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a09:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SEND);
+  801a0e:	b8 08 00 00 00       	mov    $0x8,%eax
+  801a13:	e8 e8 fd ff ff       	call   801800 <nsipc>
+}
+  801a18:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a1b:	c9                   	leave
+  801a1c:	c3                   	ret
+	assert(size < 1600);
+  801a1d:	68 00 2a 80 00       	push   $0x802a00
+  801a22:	68 a7 29 80 00       	push   $0x8029a7
+  801a27:	6a 6d                	push   $0x6d
+  801a29:	68 f4 29 80 00       	push   $0x8029f4
+  801a2e:	e8 e8 04 00 00       	call   801f1b <_panic>
+
+00801a33 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801a33:	55                   	push   %ebp
+  801a34:	89 e5                	mov    %esp,%ebp
+  801a36:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801a39:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a3c:	a3 00 60 80 00       	mov    %eax,0x806000
+	nsipcbuf.socket.req_type = type;
+  801a41:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a44:	a3 04 60 80 00       	mov    %eax,0x806004
+	nsipcbuf.socket.req_protocol = protocol;
+  801a49:	8b 45 10             	mov    0x10(%ebp),%eax
+  801a4c:	a3 08 60 80 00       	mov    %eax,0x806008
+	return nsipc(NSREQ_SOCKET);
+  801a51:	b8 09 00 00 00       	mov    $0x9,%eax
+  801a56:	e8 a5 fd ff ff       	call   801800 <nsipc>
+}
+  801a5b:	c9                   	leave
+  801a5c:	c3                   	ret
+
+00801a5d <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801a5d:	55                   	push   %ebp
+  801a5e:	89 e5                	mov    %esp,%ebp
+  801a60:	56                   	push   %esi
+  801a61:	53                   	push   %ebx
+  801a62:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801a65:	83 ec 0c             	sub    $0xc,%esp
+  801a68:	ff 75 08             	push   0x8(%ebp)
+  801a6b:	e8 aa f3 ff ff       	call   800e1a <fd2data>
+  801a70:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801a72:	83 c4 08             	add    $0x8,%esp
+  801a75:	68 0c 2a 80 00       	push   $0x802a0c
+  801a7a:	53                   	push   %ebx
+  801a7b:	e8 cb ec ff ff       	call   80074b <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  801a80:	8b 46 04             	mov    0x4(%esi),%eax
+  801a83:	2b 06                	sub    (%esi),%eax
+  801a85:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  801a8b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801a92:	00 00 00 
+	stat->st_dev = &devpipe;
+  801a95:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  801a9c:	30 80 00 
+	return 0;
+}
+  801a9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aa4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801aa7:	5b                   	pop    %ebx
+  801aa8:	5e                   	pop    %esi
+  801aa9:	5d                   	pop    %ebp
+  801aaa:	c3                   	ret
+
+00801aab <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801aab:	55                   	push   %ebp
+  801aac:	89 e5                	mov    %esp,%ebp
+  801aae:	53                   	push   %ebx
+  801aaf:	83 ec 0c             	sub    $0xc,%esp
+  801ab2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801ab5:	53                   	push   %ebx
+  801ab6:	6a 00                	push   $0x0
+  801ab8:	e8 ff f0 ff ff       	call   800bbc <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801abd:	89 1c 24             	mov    %ebx,(%esp)
+  801ac0:	e8 55 f3 ff ff       	call   800e1a <fd2data>
+  801ac5:	83 c4 08             	add    $0x8,%esp
+  801ac8:	50                   	push   %eax
+  801ac9:	6a 00                	push   $0x0
+  801acb:	e8 ec f0 ff ff       	call   800bbc <sys_page_unmap>
+}
+  801ad0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ad3:	c9                   	leave
+  801ad4:	c3                   	ret
+
+00801ad5 <_pipeisclosed>:
+{
+  801ad5:	55                   	push   %ebp
+  801ad6:	89 e5                	mov    %esp,%ebp
+  801ad8:	57                   	push   %edi
+  801ad9:	56                   	push   %esi
+  801ada:	53                   	push   %ebx
+  801adb:	83 ec 1c             	sub    $0x1c,%esp
+  801ade:	89 c7                	mov    %eax,%edi
+  801ae0:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801ae2:	a1 08 40 80 00       	mov    0x804008,%eax
+  801ae7:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801aea:	83 ec 0c             	sub    $0xc,%esp
+  801aed:	57                   	push   %edi
+  801aee:	e8 75 05 00 00       	call   802068 <pageref>
+  801af3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801af6:	89 34 24             	mov    %esi,(%esp)
+  801af9:	e8 6a 05 00 00       	call   802068 <pageref>
+		nn = thisenv->env_runs;
+  801afe:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801b04:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801b07:	83 c4 10             	add    $0x10,%esp
+  801b0a:	39 cb                	cmp    %ecx,%ebx
+  801b0c:	74 1b                	je     801b29 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801b0e:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801b11:	75 cf                	jne    801ae2 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801b13:	8b 42 58             	mov    0x58(%edx),%eax
+  801b16:	6a 01                	push   $0x1
+  801b18:	50                   	push   %eax
+  801b19:	53                   	push   %ebx
+  801b1a:	68 13 2a 80 00       	push   $0x802a13
+  801b1f:	e8 6e e6 ff ff       	call   800192 <cprintf>
+  801b24:	83 c4 10             	add    $0x10,%esp
+  801b27:	eb b9                	jmp    801ae2 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801b29:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801b2c:	0f 94 c0             	sete   %al
+  801b2f:	0f b6 c0             	movzbl %al,%eax
+}
+  801b32:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b35:	5b                   	pop    %ebx
+  801b36:	5e                   	pop    %esi
+  801b37:	5f                   	pop    %edi
+  801b38:	5d                   	pop    %ebp
+  801b39:	c3                   	ret
+
+00801b3a <devpipe_write>:
+{
+  801b3a:	55                   	push   %ebp
+  801b3b:	89 e5                	mov    %esp,%ebp
+  801b3d:	57                   	push   %edi
+  801b3e:	56                   	push   %esi
+  801b3f:	53                   	push   %ebx
+  801b40:	83 ec 28             	sub    $0x28,%esp
+  801b43:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  801b46:	56                   	push   %esi
+  801b47:	e8 ce f2 ff ff       	call   800e1a <fd2data>
+  801b4c:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801b4e:	83 c4 10             	add    $0x10,%esp
+  801b51:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b56:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801b59:	75 09                	jne    801b64 <devpipe_write+0x2a>
+	return i;
+  801b5b:	89 f8                	mov    %edi,%eax
+  801b5d:	eb 23                	jmp    801b82 <devpipe_write+0x48>
+			sys_yield();
+  801b5f:	e8 b4 ef ff ff       	call   800b18 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801b64:	8b 43 04             	mov    0x4(%ebx),%eax
+  801b67:	8b 0b                	mov    (%ebx),%ecx
+  801b69:	8d 51 20             	lea    0x20(%ecx),%edx
+  801b6c:	39 d0                	cmp    %edx,%eax
+  801b6e:	72 1a                	jb     801b8a <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  801b70:	89 da                	mov    %ebx,%edx
+  801b72:	89 f0                	mov    %esi,%eax
+  801b74:	e8 5c ff ff ff       	call   801ad5 <_pipeisclosed>
+  801b79:	85 c0                	test   %eax,%eax
+  801b7b:	74 e2                	je     801b5f <devpipe_write+0x25>
+				return 0;
+  801b7d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b82:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b85:	5b                   	pop    %ebx
+  801b86:	5e                   	pop    %esi
+  801b87:	5f                   	pop    %edi
+  801b88:	5d                   	pop    %ebp
+  801b89:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801b8a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b8d:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801b91:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801b94:	89 c2                	mov    %eax,%edx
+  801b96:	c1 fa 1f             	sar    $0x1f,%edx
+  801b99:	89 d1                	mov    %edx,%ecx
+  801b9b:	c1 e9 1b             	shr    $0x1b,%ecx
+  801b9e:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801ba1:	83 e2 1f             	and    $0x1f,%edx
+  801ba4:	29 ca                	sub    %ecx,%edx
+  801ba6:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801baa:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  801bae:	83 c0 01             	add    $0x1,%eax
+  801bb1:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  801bb4:	83 c7 01             	add    $0x1,%edi
+  801bb7:	eb 9d                	jmp    801b56 <devpipe_write+0x1c>
+
+00801bb9 <devpipe_read>:
+{
+  801bb9:	55                   	push   %ebp
+  801bba:	89 e5                	mov    %esp,%ebp
+  801bbc:	57                   	push   %edi
+  801bbd:	56                   	push   %esi
+  801bbe:	53                   	push   %ebx
+  801bbf:	83 ec 18             	sub    $0x18,%esp
+  801bc2:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  801bc5:	57                   	push   %edi
+  801bc6:	e8 4f f2 ff ff       	call   800e1a <fd2data>
+  801bcb:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  801bcd:	83 c4 10             	add    $0x10,%esp
+  801bd0:	be 00 00 00 00       	mov    $0x0,%esi
+  801bd5:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801bd8:	75 13                	jne    801bed <devpipe_read+0x34>
+	return i;
+  801bda:	89 f0                	mov    %esi,%eax
+  801bdc:	eb 02                	jmp    801be0 <devpipe_read+0x27>
+				return i;
+  801bde:	89 f0                	mov    %esi,%eax
+}
+  801be0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801be3:	5b                   	pop    %ebx
+  801be4:	5e                   	pop    %esi
+  801be5:	5f                   	pop    %edi
+  801be6:	5d                   	pop    %ebp
+  801be7:	c3                   	ret
+			sys_yield();
+  801be8:	e8 2b ef ff ff       	call   800b18 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  801bed:	8b 03                	mov    (%ebx),%eax
+  801bef:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801bf2:	75 18                	jne    801c0c <devpipe_read+0x53>
+			if (i > 0)
+  801bf4:	85 f6                	test   %esi,%esi
+  801bf6:	75 e6                	jne    801bde <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  801bf8:	89 da                	mov    %ebx,%edx
+  801bfa:	89 f8                	mov    %edi,%eax
+  801bfc:	e8 d4 fe ff ff       	call   801ad5 <_pipeisclosed>
+  801c01:	85 c0                	test   %eax,%eax
+  801c03:	74 e3                	je     801be8 <devpipe_read+0x2f>
+				return 0;
+  801c05:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c0a:	eb d4                	jmp    801be0 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801c0c:	99                   	cltd
+  801c0d:	c1 ea 1b             	shr    $0x1b,%edx
+  801c10:	01 d0                	add    %edx,%eax
+  801c12:	83 e0 1f             	and    $0x1f,%eax
+  801c15:	29 d0                	sub    %edx,%eax
+  801c17:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801c1c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c1f:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  801c22:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  801c25:	83 c6 01             	add    $0x1,%esi
+  801c28:	eb ab                	jmp    801bd5 <devpipe_read+0x1c>
+
+00801c2a <pipe>:
+{
+  801c2a:	55                   	push   %ebp
+  801c2b:	89 e5                	mov    %esp,%ebp
+  801c2d:	56                   	push   %esi
+  801c2e:	53                   	push   %ebx
+  801c2f:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801c32:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c35:	50                   	push   %eax
+  801c36:	e8 f6 f1 ff ff       	call   800e31 <fd_alloc>
+  801c3b:	89 c3                	mov    %eax,%ebx
+  801c3d:	83 c4 10             	add    $0x10,%esp
+  801c40:	85 c0                	test   %eax,%eax
+  801c42:	0f 88 23 01 00 00    	js     801d6b <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801c48:	83 ec 04             	sub    $0x4,%esp
+  801c4b:	68 07 04 00 00       	push   $0x407
+  801c50:	ff 75 f4             	push   -0xc(%ebp)
+  801c53:	6a 00                	push   $0x0
+  801c55:	e8 dd ee ff ff       	call   800b37 <sys_page_alloc>
+  801c5a:	89 c3                	mov    %eax,%ebx
+  801c5c:	83 c4 10             	add    $0x10,%esp
+  801c5f:	85 c0                	test   %eax,%eax
+  801c61:	0f 88 04 01 00 00    	js     801d6b <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801c67:	83 ec 0c             	sub    $0xc,%esp
+  801c6a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c6d:	50                   	push   %eax
+  801c6e:	e8 be f1 ff ff       	call   800e31 <fd_alloc>
+  801c73:	89 c3                	mov    %eax,%ebx
+  801c75:	83 c4 10             	add    $0x10,%esp
+  801c78:	85 c0                	test   %eax,%eax
+  801c7a:	0f 88 db 00 00 00    	js     801d5b <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801c80:	83 ec 04             	sub    $0x4,%esp
+  801c83:	68 07 04 00 00       	push   $0x407
+  801c88:	ff 75 f0             	push   -0x10(%ebp)
+  801c8b:	6a 00                	push   $0x0
+  801c8d:	e8 a5 ee ff ff       	call   800b37 <sys_page_alloc>
+  801c92:	89 c3                	mov    %eax,%ebx
+  801c94:	83 c4 10             	add    $0x10,%esp
+  801c97:	85 c0                	test   %eax,%eax
+  801c99:	0f 88 bc 00 00 00    	js     801d5b <pipe+0x131>
+	va = fd2data(fd0);
+  801c9f:	83 ec 0c             	sub    $0xc,%esp
+  801ca2:	ff 75 f4             	push   -0xc(%ebp)
+  801ca5:	e8 70 f1 ff ff       	call   800e1a <fd2data>
+  801caa:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801cac:	83 c4 0c             	add    $0xc,%esp
+  801caf:	68 07 04 00 00       	push   $0x407
+  801cb4:	50                   	push   %eax
+  801cb5:	6a 00                	push   $0x0
+  801cb7:	e8 7b ee ff ff       	call   800b37 <sys_page_alloc>
+  801cbc:	89 c3                	mov    %eax,%ebx
+  801cbe:	83 c4 10             	add    $0x10,%esp
+  801cc1:	85 c0                	test   %eax,%eax
+  801cc3:	0f 88 82 00 00 00    	js     801d4b <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801cc9:	83 ec 0c             	sub    $0xc,%esp
+  801ccc:	ff 75 f0             	push   -0x10(%ebp)
+  801ccf:	e8 46 f1 ff ff       	call   800e1a <fd2data>
+  801cd4:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801cdb:	50                   	push   %eax
+  801cdc:	6a 00                	push   $0x0
+  801cde:	56                   	push   %esi
+  801cdf:	6a 00                	push   $0x0
+  801ce1:	e8 94 ee ff ff       	call   800b7a <sys_page_map>
+  801ce6:	89 c3                	mov    %eax,%ebx
+  801ce8:	83 c4 20             	add    $0x20,%esp
+  801ceb:	85 c0                	test   %eax,%eax
+  801ced:	78 4e                	js     801d3d <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  801cef:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  801cf4:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801cf7:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  801cf9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801cfc:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  801d03:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801d06:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  801d08:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801d0b:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  801d12:	83 ec 0c             	sub    $0xc,%esp
+  801d15:	ff 75 f4             	push   -0xc(%ebp)
+  801d18:	e8 ed f0 ff ff       	call   800e0a <fd2num>
+  801d1d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801d20:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  801d22:	83 c4 04             	add    $0x4,%esp
+  801d25:	ff 75 f0             	push   -0x10(%ebp)
+  801d28:	e8 dd f0 ff ff       	call   800e0a <fd2num>
+  801d2d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801d30:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  801d33:	83 c4 10             	add    $0x10,%esp
+  801d36:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d3b:	eb 2e                	jmp    801d6b <pipe+0x141>
+	sys_page_unmap(0, va);
+  801d3d:	83 ec 08             	sub    $0x8,%esp
+  801d40:	56                   	push   %esi
+  801d41:	6a 00                	push   $0x0
+  801d43:	e8 74 ee ff ff       	call   800bbc <sys_page_unmap>
+  801d48:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  801d4b:	83 ec 08             	sub    $0x8,%esp
+  801d4e:	ff 75 f0             	push   -0x10(%ebp)
+  801d51:	6a 00                	push   $0x0
+  801d53:	e8 64 ee ff ff       	call   800bbc <sys_page_unmap>
+  801d58:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  801d5b:	83 ec 08             	sub    $0x8,%esp
+  801d5e:	ff 75 f4             	push   -0xc(%ebp)
+  801d61:	6a 00                	push   $0x0
+  801d63:	e8 54 ee ff ff       	call   800bbc <sys_page_unmap>
+  801d68:	83 c4 10             	add    $0x10,%esp
+}
+  801d6b:	89 d8                	mov    %ebx,%eax
+  801d6d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d70:	5b                   	pop    %ebx
+  801d71:	5e                   	pop    %esi
+  801d72:	5d                   	pop    %ebp
+  801d73:	c3                   	ret
+
+00801d74 <pipeisclosed>:
+{
+  801d74:	55                   	push   %ebp
+  801d75:	89 e5                	mov    %esp,%ebp
+  801d77:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d7a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d7d:	50                   	push   %eax
+  801d7e:	ff 75 08             	push   0x8(%ebp)
+  801d81:	e8 01 f1 ff ff       	call   800e87 <fd_lookup>
+  801d86:	83 c4 10             	add    $0x10,%esp
+  801d89:	85 c0                	test   %eax,%eax
+  801d8b:	78 18                	js     801da5 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  801d8d:	83 ec 0c             	sub    $0xc,%esp
+  801d90:	ff 75 f4             	push   -0xc(%ebp)
+  801d93:	e8 82 f0 ff ff       	call   800e1a <fd2data>
+  801d98:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  801d9a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d9d:	e8 33 fd ff ff       	call   801ad5 <_pipeisclosed>
+  801da2:	83 c4 10             	add    $0x10,%esp
+}
+  801da5:	c9                   	leave
+  801da6:	c3                   	ret
+
+00801da7 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  801da7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dac:	c3                   	ret
+
+00801dad <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  801dad:	55                   	push   %ebp
+  801dae:	89 e5                	mov    %esp,%ebp
+  801db0:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  801db3:	68 2b 2a 80 00       	push   $0x802a2b
+  801db8:	ff 75 0c             	push   0xc(%ebp)
+  801dbb:	e8 8b e9 ff ff       	call   80074b <strcpy>
+	return 0;
+}
+  801dc0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dc5:	c9                   	leave
+  801dc6:	c3                   	ret
+
+00801dc7 <devcons_write>:
+{
+  801dc7:	55                   	push   %ebp
+  801dc8:	89 e5                	mov    %esp,%ebp
+  801dca:	57                   	push   %edi
+  801dcb:	56                   	push   %esi
+  801dcc:	53                   	push   %ebx
+  801dcd:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  801dd3:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  801dd8:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  801dde:	eb 2e                	jmp    801e0e <devcons_write+0x47>
+		m = n - tot;
+  801de0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801de3:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  801de5:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801dea:	39 c3                	cmp    %eax,%ebx
+  801dec:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  801def:	83 ec 04             	sub    $0x4,%esp
+  801df2:	53                   	push   %ebx
+  801df3:	89 f0                	mov    %esi,%eax
+  801df5:	03 45 0c             	add    0xc(%ebp),%eax
+  801df8:	50                   	push   %eax
+  801df9:	57                   	push   %edi
+  801dfa:	e8 d2 ea ff ff       	call   8008d1 <memmove>
+		sys_cputs(buf, m);
+  801dff:	83 c4 08             	add    $0x8,%esp
+  801e02:	53                   	push   %ebx
+  801e03:	57                   	push   %edi
+  801e04:	e8 72 ec ff ff       	call   800a7b <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  801e09:	01 de                	add    %ebx,%esi
+  801e0b:	83 c4 10             	add    $0x10,%esp
+  801e0e:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801e11:	72 cd                	jb     801de0 <devcons_write+0x19>
+}
+  801e13:	89 f0                	mov    %esi,%eax
+  801e15:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e18:	5b                   	pop    %ebx
+  801e19:	5e                   	pop    %esi
+  801e1a:	5f                   	pop    %edi
+  801e1b:	5d                   	pop    %ebp
+  801e1c:	c3                   	ret
+
+00801e1d <devcons_read>:
+{
+  801e1d:	55                   	push   %ebp
+  801e1e:	89 e5                	mov    %esp,%ebp
+  801e20:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  801e23:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e28:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801e2c:	75 07                	jne    801e35 <devcons_read+0x18>
+  801e2e:	eb 1f                	jmp    801e4f <devcons_read+0x32>
+		sys_yield();
+  801e30:	e8 e3 ec ff ff       	call   800b18 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  801e35:	e8 5f ec ff ff       	call   800a99 <sys_cgetc>
+  801e3a:	85 c0                	test   %eax,%eax
+  801e3c:	74 f2                	je     801e30 <devcons_read+0x13>
+	if (c < 0)
+  801e3e:	78 0f                	js     801e4f <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  801e40:	83 f8 04             	cmp    $0x4,%eax
+  801e43:	74 0c                	je     801e51 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  801e45:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e48:	88 02                	mov    %al,(%edx)
+	return 1;
+  801e4a:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  801e4f:	c9                   	leave
+  801e50:	c3                   	ret
+		return 0;
+  801e51:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e56:	eb f7                	jmp    801e4f <devcons_read+0x32>
+
+00801e58 <cputchar>:
+{
+  801e58:	55                   	push   %ebp
+  801e59:	89 e5                	mov    %esp,%ebp
+  801e5b:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  801e5e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e61:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  801e64:	6a 01                	push   $0x1
+  801e66:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801e69:	50                   	push   %eax
+  801e6a:	e8 0c ec ff ff       	call   800a7b <sys_cputs>
+}
+  801e6f:	83 c4 10             	add    $0x10,%esp
+  801e72:	c9                   	leave
+  801e73:	c3                   	ret
+
+00801e74 <getchar>:
+{
+  801e74:	55                   	push   %ebp
+  801e75:	89 e5                	mov    %esp,%ebp
+  801e77:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  801e7a:	6a 01                	push   $0x1
+  801e7c:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801e7f:	50                   	push   %eax
+  801e80:	6a 00                	push   $0x0
+  801e82:	e8 66 f2 ff ff       	call   8010ed <read>
+	if (r < 0)
+  801e87:	83 c4 10             	add    $0x10,%esp
+  801e8a:	85 c0                	test   %eax,%eax
+  801e8c:	78 06                	js     801e94 <getchar+0x20>
+	if (r < 1)
+  801e8e:	74 06                	je     801e96 <getchar+0x22>
+	return c;
+  801e90:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  801e94:	c9                   	leave
+  801e95:	c3                   	ret
+		return -E_EOF;
+  801e96:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  801e9b:	eb f7                	jmp    801e94 <getchar+0x20>
+
+00801e9d <iscons>:
+{
+  801e9d:	55                   	push   %ebp
+  801e9e:	89 e5                	mov    %esp,%ebp
+  801ea0:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801ea3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ea6:	50                   	push   %eax
+  801ea7:	ff 75 08             	push   0x8(%ebp)
+  801eaa:	e8 d8 ef ff ff       	call   800e87 <fd_lookup>
+  801eaf:	83 c4 10             	add    $0x10,%esp
+  801eb2:	85 c0                	test   %eax,%eax
+  801eb4:	78 11                	js     801ec7 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  801eb6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801eb9:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  801ebf:	39 10                	cmp    %edx,(%eax)
+  801ec1:	0f 94 c0             	sete   %al
+  801ec4:	0f b6 c0             	movzbl %al,%eax
+}
+  801ec7:	c9                   	leave
+  801ec8:	c3                   	ret
+
+00801ec9 <opencons>:
+{
+  801ec9:	55                   	push   %ebp
+  801eca:	89 e5                	mov    %esp,%ebp
+  801ecc:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  801ecf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ed2:	50                   	push   %eax
+  801ed3:	e8 59 ef ff ff       	call   800e31 <fd_alloc>
+  801ed8:	83 c4 10             	add    $0x10,%esp
+  801edb:	85 c0                	test   %eax,%eax
+  801edd:	78 3a                	js     801f19 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  801edf:	83 ec 04             	sub    $0x4,%esp
+  801ee2:	68 07 04 00 00       	push   $0x407
+  801ee7:	ff 75 f4             	push   -0xc(%ebp)
+  801eea:	6a 00                	push   $0x0
+  801eec:	e8 46 ec ff ff       	call   800b37 <sys_page_alloc>
+  801ef1:	83 c4 10             	add    $0x10,%esp
+  801ef4:	85 c0                	test   %eax,%eax
+  801ef6:	78 21                	js     801f19 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  801ef8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801efb:	8b 15 58 30 80 00    	mov    0x803058,%edx
+  801f01:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  801f03:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f06:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  801f0d:	83 ec 0c             	sub    $0xc,%esp
+  801f10:	50                   	push   %eax
+  801f11:	e8 f4 ee ff ff       	call   800e0a <fd2num>
+  801f16:	83 c4 10             	add    $0x10,%esp
+}
+  801f19:	c9                   	leave
+  801f1a:	c3                   	ret
+
+00801f1b <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  801f1b:	55                   	push   %ebp
+  801f1c:	89 e5                	mov    %esp,%ebp
+  801f1e:	56                   	push   %esi
+  801f1f:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  801f20:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  801f23:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  801f29:	e8 cb eb ff ff       	call   800af9 <sys_getenvid>
+  801f2e:	83 ec 0c             	sub    $0xc,%esp
+  801f31:	ff 75 0c             	push   0xc(%ebp)
+  801f34:	ff 75 08             	push   0x8(%ebp)
+  801f37:	56                   	push   %esi
+  801f38:	50                   	push   %eax
+  801f39:	68 38 2a 80 00       	push   $0x802a38
+  801f3e:	e8 4f e2 ff ff       	call   800192 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  801f43:	83 c4 18             	add    $0x18,%esp
+  801f46:	53                   	push   %ebx
+  801f47:	ff 75 10             	push   0x10(%ebp)
+  801f4a:	e8 f2 e1 ff ff       	call   800141 <vcprintf>
+	cprintf("\n");
+  801f4f:	c7 04 24 24 2a 80 00 	movl   $0x802a24,(%esp)
+  801f56:	e8 37 e2 ff ff       	call   800192 <cprintf>
+  801f5b:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  801f5e:	cc                   	int3
+	while (1)
+  801f5f:	eb fd                	jmp    801f5e <_panic+0x43>
+
+00801f61 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  801f61:	55                   	push   %ebp
+  801f62:	89 e5                	mov    %esp,%ebp
+  801f64:	56                   	push   %esi
+  801f65:	53                   	push   %ebx
+  801f66:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f69:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f6c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  // LAB 4: Your code here.
+  int r = sys_ipc_recv(pg ? pg : (void *) UTOP);
+  801f6f:	85 c0                	test   %eax,%eax
+  801f71:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801f76:	0f 44 c2             	cmove  %edx,%eax
+  801f79:	83 ec 0c             	sub    $0xc,%esp
+  801f7c:	50                   	push   %eax
+  801f7d:	e8 65 ed ff ff       	call   800ce7 <sys_ipc_recv>
+
+  if (from_env_store)
+  801f82:	83 c4 10             	add    $0x10,%esp
+  801f85:	85 f6                	test   %esi,%esi
+  801f87:	74 17                	je     801fa0 <ipc_recv+0x3f>
+    *from_env_store = r ? 0 : thisenv->env_ipc_from;
+  801f89:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f8e:	85 c0                	test   %eax,%eax
+  801f90:	75 0c                	jne    801f9e <ipc_recv+0x3d>
+  801f92:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801f98:	8b 92 88 00 00 00    	mov    0x88(%edx),%edx
+  801f9e:	89 16                	mov    %edx,(%esi)
+  if (perm_store)
+  801fa0:	85 db                	test   %ebx,%ebx
+  801fa2:	74 2b                	je     801fcf <ipc_recv+0x6e>
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  801fa4:	85 c0                	test   %eax,%eax
+  801fa6:	74 0d                	je     801fb5 <ipc_recv+0x54>
+  801fa8:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+
+  return r ? r : thisenv->env_ipc_value;
+}
+  801fae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fb1:	5b                   	pop    %ebx
+  801fb2:	5e                   	pop    %esi
+  801fb3:	5d                   	pop    %ebp
+  801fb4:	c3                   	ret
+    *perm_store = r ? 0 : thisenv->env_ipc_perm;
+  801fb5:	a1 08 40 80 00       	mov    0x804008,%eax
+  801fba:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  801fc0:	89 03                	mov    %eax,(%ebx)
+  return r ? r : thisenv->env_ipc_value;
+  801fc2:	a1 08 40 80 00       	mov    0x804008,%eax
+  801fc7:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+  801fcd:	eb df                	jmp    801fae <ipc_recv+0x4d>
+  801fcf:	85 c0                	test   %eax,%eax
+  801fd1:	75 db                	jne    801fae <ipc_recv+0x4d>
+  801fd3:	eb ed                	jmp    801fc2 <ipc_recv+0x61>
+
+00801fd5 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  801fd5:	55                   	push   %ebp
+  801fd6:	89 e5                	mov    %esp,%ebp
+  801fd8:	57                   	push   %edi
+  801fd9:	56                   	push   %esi
+  801fda:	53                   	push   %ebx
+  801fdb:	83 ec 0c             	sub    $0xc,%esp
+  801fde:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801fe1:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801fe4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int r;
+  void *va = pg ? pg : (void *) UTOP;
+  801fe7:	85 db                	test   %ebx,%ebx
+  801fe9:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801fee:	0f 44 d8             	cmove  %eax,%ebx
+    r = sys_ipc_try_send(to_env, val, va, perm);
+    if (r) panic("sys_ipc_try_send failed");
+  }
+
+#else
+  while ((r = sys_ipc_try_send(to_env, val, va, perm))) {
+  801ff1:	ff 75 14             	push   0x14(%ebp)
+  801ff4:	53                   	push   %ebx
+  801ff5:	56                   	push   %esi
+  801ff6:	57                   	push   %edi
+  801ff7:	e8 c8 ec ff ff       	call   800cc4 <sys_ipc_try_send>
+  801ffc:	83 c4 10             	add    $0x10,%esp
+  801fff:	85 c0                	test   %eax,%eax
+  802001:	74 1e                	je     802021 <ipc_send+0x4c>
+    if (r != -E_IPC_NOT_RECV)
+  802003:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802006:	75 07                	jne    80200f <ipc_send+0x3a>
+      panic("ipc_send: %e", r);
+    sys_yield();
+  802008:	e8 0b eb ff ff       	call   800b18 <sys_yield>
+  80200d:	eb e2                	jmp    801ff1 <ipc_send+0x1c>
+      panic("ipc_send: %e", r);
+  80200f:	50                   	push   %eax
+  802010:	68 5b 2a 80 00       	push   $0x802a5b
+  802015:	6a 3c                	push   $0x3c
+  802017:	68 68 2a 80 00       	push   $0x802a68
+  80201c:	e8 fa fe ff ff       	call   801f1b <_panic>
+  }
+
+#endif
+}
+  802021:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802024:	5b                   	pop    %ebx
+  802025:	5e                   	pop    %esi
+  802026:	5f                   	pop    %edi
+  802027:	5d                   	pop    %ebp
+  802028:	c3                   	ret
+
+00802029 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  802029:	55                   	push   %ebp
+  80202a:	89 e5                	mov    %esp,%ebp
+  80202c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+  for (i = 0; i < NENV; i++)
+  80202f:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  802034:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802037:	c1 e0 04             	shl    $0x4,%eax
+  80203a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80203f:	8b 40 50             	mov    0x50(%eax),%eax
+  802042:	39 c8                	cmp    %ecx,%eax
+  802044:	74 12                	je     802058 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  802046:	83 c2 01             	add    $0x1,%edx
+  802049:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  80204f:	75 e3                	jne    802034 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802051:	b8 00 00 00 00       	mov    $0x0,%eax
+  802056:	eb 0e                	jmp    802066 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  802058:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80205b:	c1 e0 04             	shl    $0x4,%eax
+  80205e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802063:	8b 40 48             	mov    0x48(%eax),%eax
+  802066:	5d                   	pop    %ebp
+  802067:	c3                   	ret
+
+00802068 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802068:	55                   	push   %ebp
+  802069:	89 e5                	mov    %esp,%ebp
+  80206b:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80206e:	89 c2                	mov    %eax,%edx
+  802070:	c1 ea 16             	shr    $0x16,%edx
+  802073:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80207a:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80207f:	f6 c1 01             	test   $0x1,%cl
+  802082:	74 1c                	je     8020a0 <pageref+0x38>
+	pte = uvpt[PGNUM(v)];
+  802084:	c1 e8 0c             	shr    $0xc,%eax
+  802087:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80208e:	a8 01                	test   $0x1,%al
+  802090:	74 0e                	je     8020a0 <pageref+0x38>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802092:	c1 e8 0c             	shr    $0xc,%eax
+  802095:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  80209c:	ef 
+  80209d:	0f b7 d2             	movzwl %dx,%edx
+}
+  8020a0:	89 d0                	mov    %edx,%eax
+  8020a2:	5d                   	pop    %ebp
+  8020a3:	c3                   	ret
+  8020a4:	66 90                	xchg   %ax,%ax
+  8020a6:	66 90                	xchg   %ax,%ax
+  8020a8:	66 90                	xchg   %ax,%ax
+  8020aa:	66 90                	xchg   %ax,%ax
+  8020ac:	66 90                	xchg   %ax,%ax
+  8020ae:	66 90                	xchg   %ax,%ax
+
+008020b0 <__udivmoddi4>:
+  8020b0:	55                   	push   %ebp
+  8020b1:	57                   	push   %edi
+  8020b2:	56                   	push   %esi
+  8020b3:	53                   	push   %ebx
+  8020b4:	83 ec 24             	sub    $0x24,%esp
+  8020b7:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8020bb:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8020bf:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  8020c3:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8020c7:	8b 54 24 44          	mov    0x44(%esp),%edx
+  8020cb:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8020cf:	8b 44 24 40          	mov    0x40(%esp),%eax
+  8020d3:	89 d3                	mov    %edx,%ebx
+  8020d5:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8020d9:	09 c3                	or     %eax,%ebx
+  8020db:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8020df:	0f 84 9c 00 00 00    	je     802181 <__udivmoddi4+0xd1>
+  8020e5:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8020ec:	00 
+  8020ed:	31 c0                	xor    %eax,%eax
+  8020ef:	31 d2                	xor    %edx,%edx
+  8020f1:	89 fb                	mov    %edi,%ebx
+  8020f3:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8020fa:	00 
+  8020fb:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802100:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802104:	01 c0                	add    %eax,%eax
+  802106:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80210d:	00 
+  80210e:	89 c6                	mov    %eax,%esi
+  802110:	89 d7                	mov    %edx,%edi
+  802112:	8b 44 24 10          	mov    0x10(%esp),%eax
+  802116:	8b 54 24 14          	mov    0x14(%esp),%edx
+  80211a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80211d:	d3 ea                	shr    %cl,%edx
+  80211f:	f6 c1 20             	test   $0x20,%cl
+  802122:	0f 45 c2             	cmovne %edx,%eax
+  802125:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802129:	83 e0 01             	and    $0x1,%eax
+  80212c:	09 fa                	or     %edi,%edx
+  80212e:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  802132:	89 04 24             	mov    %eax,(%esp)
+  802135:	8b 04 24             	mov    (%esp),%eax
+  802138:	89 d5                	mov    %edx,%ebp
+  80213a:	09 f0                	or     %esi,%eax
+  80213c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802140:	39 f0                	cmp    %esi,%eax
+  802142:	19 fd                	sbb    %edi,%ebp
+  802144:	72 1d                	jb     802163 <__udivmoddi4+0xb3>
+  802146:	29 f0                	sub    %esi,%eax
+  802148:	19 fa                	sbb    %edi,%edx
+  80214a:	89 cf                	mov    %ecx,%edi
+  80214c:	c1 ef 05             	shr    $0x5,%edi
+  80214f:	83 e7 01             	and    $0x1,%edi
+  802152:	89 fe                	mov    %edi,%esi
+  802154:	d3 e7                	shl    %cl,%edi
+  802156:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80215a:	83 f6 01             	xor    $0x1,%esi
+  80215d:	d3 e6                	shl    %cl,%esi
+  80215f:	09 74 24 18          	or     %esi,0x18(%esp)
+  802163:	83 e9 01             	sub    $0x1,%ecx
+  802166:	73 98                	jae    802100 <__udivmoddi4+0x50>
+  802168:	85 db                	test   %ebx,%ebx
+  80216a:	74 05                	je     802171 <__udivmoddi4+0xc1>
+  80216c:	89 03                	mov    %eax,(%ebx)
+  80216e:	89 53 04             	mov    %edx,0x4(%ebx)
+  802171:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802175:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802179:	83 c4 24             	add    $0x24,%esp
+  80217c:	5b                   	pop    %ebx
+  80217d:	5e                   	pop    %esi
+  80217e:	5f                   	pop    %edi
+  80217f:	5d                   	pop    %ebp
+  802180:	c3                   	ret
+  802181:	85 ff                	test   %edi,%edi
+  802183:	74 0d                	je     802192 <__udivmoddi4+0xe2>
+  802185:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  80218b:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  802192:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802196:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80219a:	89 44 24 18          	mov    %eax,0x18(%esp)
+  80219e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8021a2:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  8021a6:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8021aa:	83 c4 24             	add    $0x24,%esp
+  8021ad:	5b                   	pop    %ebx
+  8021ae:	5e                   	pop    %esi
+  8021af:	5f                   	pop    %edi
+  8021b0:	5d                   	pop    %ebp
+  8021b1:	c3                   	ret
+  8021b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8021b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+008021c0 <__udivdi3>:
+  8021c0:	57                   	push   %edi
+  8021c1:	56                   	push   %esi
+  8021c2:	53                   	push   %ebx
+  8021c3:	83 ec 20             	sub    $0x20,%esp
+  8021c6:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8021ca:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8021ce:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8021d2:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8021d6:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8021da:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8021de:	89 d1                	mov    %edx,%ecx
+  8021e0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8021e4:	09 c1                	or     %eax,%ecx
+  8021e6:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8021ea:	89 44 24 18          	mov    %eax,0x18(%esp)
+  8021ee:	89 54 24 1c          	mov    %edx,0x1c(%esp)
+  8021f2:	0f 84 88 00 00 00    	je     802280 <__udivdi3+0xc0>
+  8021f8:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8021ff:	00 
+  802200:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802205:	31 c0                	xor    %eax,%eax
+  802207:	31 d2                	xor    %edx,%edx
+  802209:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802210:	00 
+  802211:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  802218:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80221c:	01 c0                	add    %eax,%eax
+  80221e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802225:	00 
+  802226:	89 c6                	mov    %eax,%esi
+  802228:	89 d7                	mov    %edx,%edi
+  80222a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80222e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802232:	0f ad d0             	shrd   %cl,%edx,%eax
+  802235:	d3 ea                	shr    %cl,%edx
+  802237:	f6 c1 20             	test   $0x20,%cl
+  80223a:	0f 45 c2             	cmovne %edx,%eax
+  80223d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802241:	83 e0 01             	and    $0x1,%eax
+  802244:	09 fa                	or     %edi,%edx
+  802246:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80224a:	89 04 24             	mov    %eax,(%esp)
+  80224d:	8b 04 24             	mov    (%esp),%eax
+  802250:	89 d3                	mov    %edx,%ebx
+  802252:	09 f0                	or     %esi,%eax
+  802254:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802258:	39 f0                	cmp    %esi,%eax
+  80225a:	19 fb                	sbb    %edi,%ebx
+  80225c:	72 1d                	jb     80227b <__udivdi3+0xbb>
+  80225e:	29 f0                	sub    %esi,%eax
+  802260:	19 fa                	sbb    %edi,%edx
+  802262:	89 cf                	mov    %ecx,%edi
+  802264:	c1 ef 05             	shr    $0x5,%edi
+  802267:	83 e7 01             	and    $0x1,%edi
+  80226a:	89 fe                	mov    %edi,%esi
+  80226c:	d3 e7                	shl    %cl,%edi
+  80226e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802272:	83 f6 01             	xor    $0x1,%esi
+  802275:	d3 e6                	shl    %cl,%esi
+  802277:	09 74 24 18          	or     %esi,0x18(%esp)
+  80227b:	83 e9 01             	sub    $0x1,%ecx
+  80227e:	73 98                	jae    802218 <__udivdi3+0x58>
+  802280:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802284:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802288:	83 c4 20             	add    $0x20,%esp
+  80228b:	5b                   	pop    %ebx
+  80228c:	5e                   	pop    %esi
+  80228d:	5f                   	pop    %edi
+  80228e:	c3                   	ret
+  80228f:	90                   	nop
+
+00802290 <__umoddi3>:
+  802290:	57                   	push   %edi
+  802291:	56                   	push   %esi
+  802292:	53                   	push   %ebx
+  802293:	83 ec 18             	sub    $0x18,%esp
+  802296:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80229a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80229e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8022a2:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8022a6:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8022aa:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8022ae:	89 d1                	mov    %edx,%ecx
+  8022b0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8022b4:	09 c1                	or     %eax,%ecx
+  8022b6:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8022ba:	74 5b                	je     802317 <__umoddi3+0x87>
+  8022bc:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8022c1:	31 c0                	xor    %eax,%eax
+  8022c3:	31 d2                	xor    %edx,%edx
+  8022c5:	8d 76 00             	lea    0x0(%esi),%esi
+  8022c8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8022cc:	01 c0                	add    %eax,%eax
+  8022ce:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8022d5:	00 
+  8022d6:	89 c6                	mov    %eax,%esi
+  8022d8:	89 d7                	mov    %edx,%edi
+  8022da:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8022de:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8022e2:	0f ad d0             	shrd   %cl,%edx,%eax
+  8022e5:	d3 ea                	shr    %cl,%edx
+  8022e7:	f6 c1 20             	test   $0x20,%cl
+  8022ea:	0f 45 c2             	cmovne %edx,%eax
+  8022ed:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8022f1:	83 e0 01             	and    $0x1,%eax
+  8022f4:	09 fa                	or     %edi,%edx
+  8022f6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8022fa:	89 04 24             	mov    %eax,(%esp)
+  8022fd:	8b 04 24             	mov    (%esp),%eax
+  802300:	89 d3                	mov    %edx,%ebx
+  802302:	09 f0                	or     %esi,%eax
+  802304:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802308:	39 f0                	cmp    %esi,%eax
+  80230a:	19 fb                	sbb    %edi,%ebx
+  80230c:	72 04                	jb     802312 <__umoddi3+0x82>
+  80230e:	29 f0                	sub    %esi,%eax
+  802310:	19 fa                	sbb    %edi,%edx
+  802312:	83 e9 01             	sub    $0x1,%ecx
+  802315:	73 b1                	jae    8022c8 <__umoddi3+0x38>
+  802317:	83 c4 18             	add    $0x18,%esp
+  80231a:	5b                   	pop    %ebx
+  80231b:	5e                   	pop    %esi
+  80231c:	5f                   	pop    %edi
+  80231d:	c3                   	ret
+  80231e:	66 90                	xchg   %ax,%ax
+
+00802320 <__divdi3>:
+  802320:	55                   	push   %ebp
+  802321:	57                   	push   %edi
+  802322:	56                   	push   %esi
+  802323:	53                   	push   %ebx
+  802324:	83 ec 24             	sub    $0x24,%esp
+  802327:	8b 5c 24 40          	mov    0x40(%esp),%ebx
+  80232b:	8b 74 24 44          	mov    0x44(%esp),%esi
+  80232f:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802333:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802337:	89 5c 24 08          	mov    %ebx,0x8(%esp)
+  80233b:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  80233f:	85 d2                	test   %edx,%edx
+  802341:	0f 88 e0 00 00 00    	js     802427 <__divdi3+0x107>
+  802347:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  80234b:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  80234f:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802353:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802357:	85 f6                	test   %esi,%esi
+  802359:	78 16                	js     802371 <__divdi3+0x51>
+  80235b:	89 f1                	mov    %esi,%ecx
+  80235d:	31 c0                	xor    %eax,%eax
+  80235f:	31 d2                	xor    %edx,%edx
+  802361:	09 d9                	or     %ebx,%ecx
+  802363:	0f 85 f3 00 00 00    	jne    80245c <__divdi3+0x13c>
+  802369:	83 c4 24             	add    $0x24,%esp
+  80236c:	5b                   	pop    %ebx
+  80236d:	5e                   	pop    %esi
+  80236e:	5f                   	pop    %edi
+  80236f:	5d                   	pop    %ebp
+  802370:	c3                   	ret
+  802371:	bf 01 00 00 00       	mov    $0x1,%edi
+  802376:	f7 5c 24 08          	negl   0x8(%esp)
+  80237a:	83 54 24 0c 00       	adcl   $0x0,0xc(%esp)
+  80237f:	f7 5c 24 0c          	negl   0xc(%esp)
+  802383:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80238a:	00 
+  80238b:	31 c0                	xor    %eax,%eax
+  80238d:	31 d2                	xor    %edx,%edx
+  80238f:	89 fb                	mov    %edi,%ebx
+  802391:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802398:	00 
+  802399:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80239e:	66 90                	xchg   %ax,%ax
+  8023a0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8023a4:	01 c0                	add    %eax,%eax
+  8023a6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8023ad:	00 
+  8023ae:	89 c6                	mov    %eax,%esi
+  8023b0:	89 d7                	mov    %edx,%edi
+  8023b2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8023b6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8023ba:	0f ad d0             	shrd   %cl,%edx,%eax
+  8023bd:	d3 ea                	shr    %cl,%edx
+  8023bf:	f6 c1 20             	test   $0x20,%cl
+  8023c2:	0f 45 c2             	cmovne %edx,%eax
+  8023c5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8023c9:	83 e0 01             	and    $0x1,%eax
+  8023cc:	09 fa                	or     %edi,%edx
+  8023ce:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+  8023d2:	89 04 24             	mov    %eax,(%esp)
+  8023d5:	8b 04 24             	mov    (%esp),%eax
+  8023d8:	89 d5                	mov    %edx,%ebp
+  8023da:	09 f0                	or     %esi,%eax
+  8023dc:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8023e0:	39 f0                	cmp    %esi,%eax
+  8023e2:	19 fd                	sbb    %edi,%ebp
+  8023e4:	72 1d                	jb     802403 <__divdi3+0xe3>
+  8023e6:	29 f0                	sub    %esi,%eax
+  8023e8:	19 fa                	sbb    %edi,%edx
+  8023ea:	89 cf                	mov    %ecx,%edi
+  8023ec:	c1 ef 05             	shr    $0x5,%edi
+  8023ef:	83 e7 01             	and    $0x1,%edi
+  8023f2:	89 fe                	mov    %edi,%esi
+  8023f4:	d3 e7                	shl    %cl,%edi
+  8023f6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8023fa:	83 f6 01             	xor    $0x1,%esi
+  8023fd:	d3 e6                	shl    %cl,%esi
+  8023ff:	09 74 24 18          	or     %esi,0x18(%esp)
+  802403:	83 e9 01             	sub    $0x1,%ecx
+  802406:	73 98                	jae    8023a0 <__divdi3+0x80>
+  802408:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80240c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802410:	85 db                	test   %ebx,%ebx
+  802412:	0f 84 51 ff ff ff    	je     802369 <__divdi3+0x49>
+  802418:	f7 d8                	neg    %eax
+  80241a:	83 d2 00             	adc    $0x0,%edx
+  80241d:	83 c4 24             	add    $0x24,%esp
+  802420:	5b                   	pop    %ebx
+  802421:	f7 da                	neg    %edx
+  802423:	5e                   	pop    %esi
+  802424:	5f                   	pop    %edi
+  802425:	5d                   	pop    %ebp
+  802426:	c3                   	ret
+  802427:	f7 d8                	neg    %eax
+  802429:	83 d2 00             	adc    $0x0,%edx
+  80242c:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802430:	f7 da                	neg    %edx
+  802432:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802436:	85 f6                	test   %esi,%esi
+  802438:	78 1b                	js     802455 <__divdi3+0x135>
+  80243a:	89 f1                	mov    %esi,%ecx
+  80243c:	31 c0                	xor    %eax,%eax
+  80243e:	31 d2                	xor    %edx,%edx
+  802440:	bf 01 00 00 00       	mov    $0x1,%edi
+  802445:	09 d9                	or     %ebx,%ecx
+  802447:	0f 85 36 ff ff ff    	jne    802383 <__divdi3+0x63>
+  80244d:	83 c4 24             	add    $0x24,%esp
+  802450:	5b                   	pop    %ebx
+  802451:	5e                   	pop    %esi
+  802452:	5f                   	pop    %edi
+  802453:	5d                   	pop    %ebp
+  802454:	c3                   	ret
+  802455:	31 ff                	xor    %edi,%edi
+  802457:	e9 1a ff ff ff       	jmp    802376 <__divdi3+0x56>
+  80245c:	31 ff                	xor    %edi,%edi
+  80245e:	e9 20 ff ff ff       	jmp    802383 <__divdi3+0x63>
+  802463:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80246a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00802470 <__moddi3>:
+  802470:	55                   	push   %ebp
+  802471:	57                   	push   %edi
+  802472:	56                   	push   %esi
+  802473:	53                   	push   %ebx
+  802474:	83 ec 1c             	sub    $0x1c,%esp
+  802477:	8b 74 24 3c          	mov    0x3c(%esp),%esi
+  80247b:	8b 4c 24 38          	mov    0x38(%esp),%ecx
+  80247f:	8b 6c 24 34          	mov    0x34(%esp),%ebp
+  802483:	8b 7c 24 30          	mov    0x30(%esp),%edi
+  802487:	89 c8                	mov    %ecx,%eax
+  802489:	89 f2                	mov    %esi,%edx
+  80248b:	89 f3                	mov    %esi,%ebx
+  80248d:	85 ed                	test   %ebp,%ebp
+  80248f:	0f 88 9d 00 00 00    	js     802532 <__moddi3+0xc2>
+  802495:	09 cb                	or     %ecx,%ebx
+  802497:	0f 84 8d 00 00 00    	je     80252a <__moddi3+0xba>
+  80249d:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  8024a1:	31 db                	xor    %ebx,%ebx
+  8024a3:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  8024a7:	89 ca                	mov    %ecx,%edx
+  8024a9:	89 f0                	mov    %esi,%eax
+  8024ab:	89 dd                	mov    %ebx,%ebp
+  8024ad:	f7 da                	neg    %edx
+  8024af:	83 d0 00             	adc    $0x0,%eax
+  8024b2:	f7 d8                	neg    %eax
+  8024b4:	0f 49 f0             	cmovns %eax,%esi
+  8024b7:	0f 49 ca             	cmovns %edx,%ecx
+  8024ba:	31 c0                	xor    %eax,%eax
+  8024bc:	31 d2                	xor    %edx,%edx
+  8024be:	89 74 24 0c          	mov    %esi,0xc(%esp)
+  8024c2:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  8024c6:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8024cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  8024cf:	90                   	nop
+  8024d0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8024d4:	01 c0                	add    %eax,%eax
+  8024d6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8024dd:	00 
+  8024de:	8b 5c 24 08          	mov    0x8(%esp),%ebx
+  8024e2:	89 c6                	mov    %eax,%esi
+  8024e4:	89 d7                	mov    %edx,%edi
+  8024e6:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8024ea:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8024ee:	0f ad d0             	shrd   %cl,%edx,%eax
+  8024f1:	d3 ea                	shr    %cl,%edx
+  8024f3:	f6 c1 20             	test   $0x20,%cl
+  8024f6:	0f 45 c2             	cmovne %edx,%eax
+  8024f9:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8024fd:	83 e0 01             	and    $0x1,%eax
+  802500:	09 fa                	or     %edi,%edx
+  802502:	89 04 24             	mov    %eax,(%esp)
+  802505:	8b 04 24             	mov    (%esp),%eax
+  802508:	89 d7                	mov    %edx,%edi
+  80250a:	09 f0                	or     %esi,%eax
+  80250c:	8b 74 24 0c          	mov    0xc(%esp),%esi
+  802510:	39 d8                	cmp    %ebx,%eax
+  802512:	19 f7                	sbb    %esi,%edi
+  802514:	72 04                	jb     80251a <__moddi3+0xaa>
+  802516:	29 d8                	sub    %ebx,%eax
+  802518:	19 f2                	sbb    %esi,%edx
+  80251a:	83 e9 01             	sub    $0x1,%ecx
+  80251d:	73 b1                	jae    8024d0 <__moddi3+0x60>
+  80251f:	85 ed                	test   %ebp,%ebp
+  802521:	74 07                	je     80252a <__moddi3+0xba>
+  802523:	f7 d8                	neg    %eax
+  802525:	83 d2 00             	adc    $0x0,%edx
+  802528:	f7 da                	neg    %edx
+  80252a:	83 c4 1c             	add    $0x1c,%esp
+  80252d:	5b                   	pop    %ebx
+  80252e:	5e                   	pop    %esi
+  80252f:	5f                   	pop    %edi
+  802530:	5d                   	pop    %ebp
+  802531:	c3                   	ret
+  802532:	09 cb                	or     %ecx,%ebx
+  802534:	74 f4                	je     80252a <__moddi3+0xba>
+  802536:	f7 df                	neg    %edi
+  802538:	bb 01 00 00 00       	mov    $0x1,%ebx
+  80253d:	83 d5 00             	adc    $0x0,%ebp
+  802540:	89 7c 24 10          	mov    %edi,0x10(%esp)
+  802544:	f7 dd                	neg    %ebp
+  802546:	89 6c 24 14          	mov    %ebp,0x14(%esp)
+  80254a:	e9 58 ff ff ff       	jmp    8024a7 <__moddi3+0x37>
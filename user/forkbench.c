@@ -0,0 +1,48 @@
+// Time fork() of an environment with MEMSZ bytes of dirty memory, and
+// check that parent and child see their own copies afterwards.
+
+#include <inc/lib.h>
+
+#define MEMSZ	(4 * 1024 * 1024)
+#define NFORK	50
+
+static char mem[MEMSZ];
+
+void
+umain(int argc, char **argv)
+{
+	unsigned start, ms;
+	envid_t child;
+	int i;
+
+	// Touch every page so that it is mapped and writable.
+	for (i = 0; i < MEMSZ; i += PGSIZE)
+		mem[i] = 1;
+
+	start = time_msec();
+	for (i = 0; i < NFORK; i++) {
+		if ((child = fork()) < 0)
+			panic("fork: %e", child);
+		if (child == 0)
+			exit();
+		wait(child);
+	}
+	ms = time_msec() - start;
+	cprintf("forkbench: %d forks of %d KB in %u ms, %u us per fork\n",
+		NFORK, MEMSZ / 1024, ms, ms * 1000 / NFORK);
+
+	// The child's writes must not show through, nor ours in it.
+	if ((child = fork()) < 0)
+		panic("fork: %e", child);
+	if (child == 0) {
+		if (mem[0] != 1)
+			panic("child sees %d", mem[0]);
+		mem[0] = 2;
+		exit();
+	}
+	mem[0] = 3;
+	wait(child);
+	if (mem[0] != 3)
+		panic("parent sees %d", mem[0]);
+	cprintf("forkbench: copy-on-write ok\n");
+}
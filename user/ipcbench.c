@@ -0,0 +1,52 @@
+// Ping-pong a counter with a forked child and measure the round trip,
+// first as ipc_send then ipc_recv, then as a single ipc_call, which
+// switches directly to the child and back.
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define NROUND	10000
+
+// Echo every value back to its sender, plus one.
+static void __attribute__((noreturn))
+echo(void)
+{
+	envid_t who;
+	uint32_t i;
+
+	while (1) {
+		i = ipc_recv(&who, 0, 0);
+		ipc_send(who, i + 1, 0, 0);
+	}
+}
+
+void
+umain(int argc, char **argv)
+{
+	envid_t child;
+	uint64_t start, send_recv, call;
+	uint32_t i, v;
+
+	if ((child = fork()) < 0)
+		panic("fork: %e", child);
+	if (child == 0)
+		echo();
+
+	start = read_tsc();
+	for (i = 0; i < NROUND; i++) {
+		ipc_send(child, i, 0, 0);
+		if ((v = ipc_recv(0, 0, 0)) != i + 1)
+			panic("send/recv: sent %d, got %d", i, v);
+	}
+	send_recv = read_tsc() - start;
+
+	start = read_tsc();
+	for (i = 0; i < NROUND; i++)
+		if ((v = ipc_call(child, i, 0, 0, 0, 0)) != i + 1)
+			panic("call: sent %d, got %d", i, v);
+	call = read_tsc() - start;
+
+	cprintf("ipcbench: %llu cycles per round trip with send/recv, "
+		"%llu with call\n", send_recv / NROUND, call / NROUND);
+	sys_env_destroy(child);
+}
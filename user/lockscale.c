@@ -0,0 +1,75 @@
+// Measure syscall throughput when many environments hammer the kernel
+// at once.  Run with different CPUS= values: syscalls that no longer
+// take the big kernel lock should scale with the number of CPUs.
+
+#include <inc/lib.h>
+
+#define NWORKER		8
+#define RUNMSEC		1000
+
+struct shared {
+	volatile int start;		// time_msec() at which to start
+	volatile int done;		// workers finished
+	volatile uint32_t ops[NWORKER];
+	volatile int cpu[NWORKER];
+};
+
+static struct shared *sh = (struct shared *) (UTEMP + PGSIZE);
+
+static void
+worker(int id)
+{
+	void *scratch = (void *) (UTEMP + 2 * PGSIZE + id * PGSIZE);
+	uint32_t ops = 0;
+	int end;
+
+	while (!sh->start)
+		sys_yield();
+	while (sys_time_msec() < sh->start)
+		asm volatile("pause");
+	end = sh->start + RUNMSEC;
+
+	while (sys_time_msec() < end) {
+		if (sys_page_alloc(0, scratch, PTE_P|PTE_U|PTE_W) < 0)
+			panic("sys_page_alloc failed");
+		if (sys_page_unmap(0, scratch) < 0)
+			panic("sys_page_unmap failed");
+		sys_getenvid();
+		ops += 4;	// counting the sys_time_msec above
+	}
+
+	sh->ops[id] = ops;
+	sh->cpu[id] = thisenv->env_cpunum;
+	__sync_fetch_and_add(&sh->done, 1);
+}
+
+void
+umain(int argc, char **argv)
+{
+	uint64_t total = 0;
+	int i, r;
+
+	if ((r = sys_page_alloc(0, sh, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+		panic("sys_page_alloc: %e", r);
+
+	for (i = 0; i < NWORKER; i++) {
+		if ((r = fork()) < 0)
+			panic("fork: %e", r);
+		if (r == 0) {
+			worker(i);
+			return;
+		}
+	}
+
+	// Give every worker a moment to reach the start line.
+	sh->start = sys_time_msec() + 100;
+	while (sh->done < NWORKER)
+		sys_yield();
+
+	for (i = 0; i < NWORKER; i++) {
+		cprintf("worker %d on CPU %d: %u ops\n", i, sh->cpu[i], sh->ops[i]);
+		total += sh->ops[i];
+	}
+	cprintf("lockscale: %llu syscalls in %d ms, %llu per second\n",
+		total, RUNMSEC, total * 1000 / RUNMSEC);
+}
@@ -0,0 +1,87 @@
+// Measure physical page allocation under load: NWORKER environments,
+// spread across the CPUs, fork and reap children and map and unmap
+// batches of pages for RUNMSEC.  Every fork and exit allocates and
+// frees page tables and stacks in the kernel.  Set PAGE_CACHE_SIZE in
+// kern/pmap.h to 0 to compare against the global free lists alone;
+// the monitor's "pages" command shows the per-CPU cache hit rates.
+
+#include <inc/lib.h>
+
+#define NWORKER		4
+#define NSCRATCH	16
+#define RUNMSEC		1000
+
+struct shared {
+	volatile int start;		// time_msec() at which to start
+	volatile int done;		// workers finished
+	volatile uint32_t forks[NWORKER];
+	volatile uint32_t pages[NWORKER];
+};
+
+static struct shared *sh = (struct shared *) (UTEMP + PGSIZE);
+
+static void
+worker(int id)
+{
+	void *scratch = (void *) (UTEMP + 2 * PGSIZE + id * NSCRATCH * PGSIZE);
+	uint32_t forks = 0, npages = 0;
+	envid_t child;
+	int end, r;
+
+	while (!sh->start)
+		sys_yield();
+	while (sys_time_msec() < sh->start)
+		asm volatile("pause");
+	end = sh->start + RUNMSEC;
+
+	while (sys_time_msec() < end) {
+		if ((child = fork()) < 0)
+			panic("fork: %e", child);
+		if (child == 0)
+			exit();
+		wait(child);
+		forks++;
+
+		if ((r = sys_page_alloc_range(0, scratch, NSCRATCH, PTE_P|PTE_U|PTE_W)) < 0)
+			panic("sys_page_alloc_range: %e", r);
+		if ((r = sys_page_unmap_range(0, scratch, NSCRATCH)) < 0)
+			panic("sys_page_unmap_range: %e", r);
+		npages += NSCRATCH;
+	}
+
+	sh->forks[id] = forks;
+	sh->pages[id] = npages;
+	__sync_fetch_and_add(&sh->done, 1);
+}
+
+void
+umain(int argc, char **argv)
+{
+	uint32_t forks = 0, npages = 0;
+	int i, r;
+
+	if ((r = sys_page_alloc(0, sh, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+		panic("sys_page_alloc: %e", r);
+
+	for (i = 0; i < NWORKER; i++) {
+		if ((r = fork()) < 0)
+			panic("fork: %e", r);
+		if (r == 0) {
+			worker(i);
+			return;
+		}
+	}
+
+	// Give every worker a moment to reach the start line.
+	sh->start = sys_time_msec() + 100;
+	while (sh->done < NWORKER)
+		sys_yield();
+
+	for (i = 0; i < NWORKER; i++) {
+		cprintf("worker %d: %u forks, %u pages\n", i, sh->forks[i], sh->pages[i]);
+		forks += sh->forks[i];
+		npages += sh->pages[i];
+	}
+	cprintf("pagebench: %u fork/exit/wait and %u page alloc/unmap in %d ms\n",
+		forks, npages, RUNMSEC);
+}
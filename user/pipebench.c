@@ -0,0 +1,72 @@
+// Measure pipe throughput: a child writes TOTAL bytes through a pipe
+// in chunks of a given size while the parent reads them back with a
+// large buffer.
+
+#include <inc/lib.h>
+
+#define TOTAL	(4 * 1024 * 1024)
+#define RBUFSZ	(32 * 1024)
+
+static char wbuf[RBUFSZ];
+static char rbuf[RBUFSZ];
+
+static void
+writer(int fd, int chunk)
+{
+	int n, r;
+
+	for (n = 0; n < TOTAL; n += r) {
+		r = MIN(chunk, TOTAL - n);
+		if ((r = write(fd, wbuf, r)) <= 0)
+			panic("write: %e", r);
+	}
+}
+
+// Move TOTAL bytes through a pipe, chunk bytes per write, and return
+// the elapsed milliseconds.
+static unsigned
+bench(int chunk)
+{
+	int p[2], r, n;
+	envid_t child;
+	unsigned start;
+
+	if ((r = pipe(p)) < 0)
+		panic("pipe: %e", r);
+	if ((child = fork()) < 0)
+		panic("fork: %e", child);
+	if (child == 0) {
+		close(p[0]);
+		writer(p[1], chunk);
+		exit();
+	}
+	close(p[1]);
+
+	start = time_msec();
+	for (n = 0; (r = read(p[0], rbuf, sizeof rbuf)) > 0; n += r)
+		;
+	if (r < 0)
+		panic("read: %e", r);
+	r = time_msec() - start;
+	close(p[0]);
+	wait(child);
+
+	if (n != TOTAL)
+		panic("read %d bytes, expected %d", n, TOTAL);
+	return r;
+}
+
+void
+umain(int argc, char **argv)
+{
+	static const int chunks[] = { 64, 512, 4096, 32768 };
+	unsigned i, ms;
+
+	memset(wbuf, 'x', sizeof wbuf);
+	for (i = 0; i < ARRAY_SIZE(chunks); i++) {
+		ms = bench(chunks[i]);
+		cprintf("pipebench: %d-byte writes: %d KB in %u ms, %u KB/s\n",
+			chunks[i], TOTAL / 1024, ms,
+			ms ? (TOTAL / 1024) * 1000 / ms : 0);
+	}
+}
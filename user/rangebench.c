@@ -0,0 +1,88 @@
+// Allocate, remap, write-protect and unmap a run of pages, first one
+// syscall per page and then with the range syscalls, and compare the
+// cost.
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define NPAGE	256
+#define NROUND	20
+
+static char *base = (char *) 0x10000000;
+static char *alias = (char *) 0x20000000;
+
+// Cycles for the work one page at a time.
+static uint64_t
+paged(void)
+{
+	uint64_t start = read_tsc();
+	int i, r;
+
+	for (i = 0; i < NPAGE; i++)
+		if ((r = sys_page_alloc(0, base + i * PGSIZE, PTE_P | PTE_U | PTE_W)) < 0)
+			panic("sys_page_alloc: %e", r);
+	for (i = 0; i < NPAGE; i++)
+		if ((r = sys_page_map(0, base + i * PGSIZE, 0, alias + i * PGSIZE,
+				      PTE_P | PTE_U)) < 0)
+			panic("sys_page_map: %e", r);
+	for (i = 0; i < NPAGE; i++)
+		if ((r = sys_page_map(0, base + i * PGSIZE, 0, base + i * PGSIZE,
+				      PTE_P | PTE_U)) < 0)
+			panic("sys_page_map: %e", r);
+	for (i = 0; i < NPAGE; i++)
+		if ((r = sys_page_unmap(0, base + i * PGSIZE)) < 0
+		    || (r = sys_page_unmap(0, alias + i * PGSIZE)) < 0)
+			panic("sys_page_unmap: %e", r);
+	return read_tsc() - start;
+}
+
+// The same work with one range syscall per step.
+static uint64_t
+ranged(void)
+{
+	uint64_t start = read_tsc();
+	int r;
+
+	if ((r = sys_page_alloc_range(0, base, NPAGE, PTE_P | PTE_U | PTE_W)) < 0)
+		panic("sys_page_alloc_range: %e", r);
+	if ((r = sys_page_map_range(0, base, 0, alias, NPAGE, PTE_P | PTE_U)) < 0)
+		panic("sys_page_map_range: %e", r);
+	if ((r = sys_page_protect(0, base, NPAGE, PTE_P | PTE_U)) < 0)
+		panic("sys_page_protect: %e", r);
+	if ((r = sys_page_unmap_range(0, base, NPAGE)) < 0
+	    || (r = sys_page_unmap_range(0, alias, NPAGE)) < 0)
+		panic("sys_page_unmap_range: %e", r);
+	return read_tsc() - start;
+}
+
+void
+umain(int argc, char **argv)
+{
+	uint64_t p = 0, q = 0;
+	int i, r;
+
+	// Both views of a range share pages, and write protection sticks.
+	if ((r = sys_page_alloc_range(0, base, NPAGE, PTE_P | PTE_U | PTE_W)) < 0
+	    || (r = sys_page_map_range(0, base, 0, alias, NPAGE, PTE_P | PTE_U | PTE_W)) < 0)
+		panic("range setup: %e", r);
+	base[(NPAGE - 1) * PGSIZE] = 7;
+	if (alias[(NPAGE - 1) * PGSIZE] != 7)
+		panic("alias does not share the page");
+	if ((r = sys_page_protect(0, base, NPAGE, PTE_P | PTE_U)) < 0)
+		panic("sys_page_protect: %e", r);
+	if (uvpt[PGNUM(base)] & PTE_W)
+		panic("page still writable");
+	if (sys_page_protect(0, base, NPAGE, PTE_P | PTE_U | PTE_W) != -E_INVAL)
+		panic("sys_page_protect made a read-only page writable");
+	sys_page_unmap_range(0, base, NPAGE);
+	sys_page_unmap_range(0, alias, NPAGE);
+	if (uvpt[PGNUM(alias)] & PTE_P)
+		panic("page still mapped");
+
+	for (i = 0; i < NROUND; i++) {
+		p += paged();
+		q += ranged();
+	}
+	cprintf("rangebench: %llu cycles per page one at a time, %llu by range\n",
+		p / (NROUND * NPAGE), q / (NROUND * NPAGE));
+}
@@ -0,0 +1,96 @@
+// Map and unmap a run of pages, first with one syscall per page and
+// then in batches through a syscall ring, and compare the cost.
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define NPAGE	RING_NSQE
+#define NROUND	100
+
+static struct SyscallRing *ring = (struct SyscallRing *) UTEMP;
+static char *base = (char *) 0x10000000;
+
+// Cycles to allocate and then unmap NPAGE pages with direct syscalls.
+static uint64_t
+direct(void)
+{
+	uint64_t start = read_tsc();
+	int i, r;
+
+	for (i = 0; i < NPAGE; i++)
+		if ((r = sys_page_alloc(0, base + i * PGSIZE, PTE_P | PTE_U | PTE_W)) < 0)
+			panic("sys_page_alloc: %e", r);
+	for (i = 0; i < NPAGE; i++)
+		if ((r = sys_page_unmap(0, base + i * PGSIZE)) < 0)
+			panic("sys_page_unmap: %e", r);
+	return read_tsc() - start;
+}
+
+// Submit n entries through the ring in one sys_ring_enter() and
+// check that each completes in order with success.
+static void
+run_batch(int n)
+{
+	struct RingCqe cqe;
+	int i, r;
+
+	if ((r = sys_ring_enter()) != n)
+		panic("sys_ring_enter ran %d of %d", r, n);
+	for (i = 0; i < n; i++) {
+		if (!ring_complete(ring, &cqe))
+			panic("missing completion %d", i);
+		if (cqe.cqe_data != i || cqe.cqe_res < 0)
+			panic("completion %d: data %d res %e", i,
+			      cqe.cqe_data, cqe.cqe_res);
+	}
+}
+
+// The same work as direct(), in two ring batches.
+static uint64_t
+batched(void)
+{
+	uint64_t start = read_tsc();
+	int i;
+
+	for (i = 0; i < NPAGE; i++)
+		ring_submit(ring, i, SYS_page_alloc, 0,
+			    (uint32_t) (base + i * PGSIZE),
+			    PTE_P | PTE_U | PTE_W, 0, 0);
+	run_batch(NPAGE);
+	for (i = 0; i < NPAGE; i++)
+		ring_submit(ring, i, SYS_page_unmap, 0,
+			    (uint32_t) (base + i * PGSIZE), 0, 0, 0);
+	run_batch(NPAGE);
+	return read_tsc() - start;
+}
+
+void
+umain(int argc, char **argv)
+{
+	uint64_t d = 0, b = 0;
+	struct RingCqe cqe;
+	int i, r;
+
+	if ((r = sys_page_alloc(0, ring, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+		panic("sys_page_alloc: %e", r);
+	if ((r = sys_ring_setup(ring, 0)) < 0)
+		panic("sys_ring_setup: %e", r);
+
+	// Syscalls outside the ring's set are refused.
+	ring_submit(ring, 0, SYS_yield, 0, 0, 0, 0, 0);
+	if (sys_ring_enter() != 1 || !ring_complete(ring, &cqe)
+	    || cqe.cqe_res != -E_INVAL)
+		panic("ring ran SYS_yield");
+
+	for (i = 0; i < NROUND; i++) {
+		d += direct();
+		b += batched();
+	}
+	cprintf("ringbench: %llu cycles per page direct, %llu batched\n",
+		d / (NROUND * NPAGE), b / (NROUND * NPAGE));
+
+	if ((r = sys_ring_setup(0, 0)) < 0)
+		panic("sys_ring_setup: %e", r);
+	if (sys_ring_enter() != -E_INVAL)
+		panic("ring still registered");
+}
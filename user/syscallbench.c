@@ -0,0 +1,60 @@
+// Measure null-syscall latency: the round trip into the kernel and
+// back for sys_getenvid(), which does no work of its own.  Compare
+// the sysenter path the library uses with a plain int $T_SYSCALL.
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define NCALL	100000
+#define NROUND	5
+
+// sys_getenvid() the old way, through the full trap path.
+static envid_t
+int_getenvid(void)
+{
+	envid_t ret;
+
+	asm volatile("int %1"
+		     : "=a" (ret)
+		     : "i" (T_SYSCALL), "a" (SYS_getenvid)
+		     : "cc", "memory");
+	return ret;
+}
+
+// Best cycles per call over NROUND rounds of NCALL calls.
+static uint64_t
+bench(const char *name, envid_t (*getenvid)(void))
+{
+	uint64_t start, cycles, best = ~0ULL;
+	int i, round;
+
+	// Warm up the TLB and caches.
+	for (i = 0; i < 1000; i++)
+		getenvid();
+
+	for (round = 0; round < NROUND; round++) {
+		start = read_tsc();
+		for (i = 0; i < NCALL; i++)
+			getenvid();
+		cycles = read_tsc() - start;
+		cprintf("%s round %d: %llu cycles per syscall\n",
+			name, round, cycles / NCALL);
+		if (cycles < best)
+			best = cycles;
+	}
+	return best / NCALL;
+}
+
+void
+umain(int argc, char **argv)
+{
+	uint64_t fast, slow;
+
+	if (int_getenvid() != sys_getenvid())
+		panic("sysenter and int disagree on getenvid");
+
+	slow = bench("int", int_getenvid);
+	fast = bench("sysenter", sys_getenvid);
+	cprintf("syscallbench: best %llu cycles per null syscall "
+		"(int %llu, sysenter %llu)\n", fast, slow, fast);
+}
@@ -4,15 +4,13 @@
 void
 sleep(int sec)
 {
-	unsigned now = sys_time_msec();
+	unsigned now = time_msec();
 	unsigned end = now + sec * 1000;
 
-	if ((int)now < 0 && (int)now > -MAXERROR)
-		panic("sys_time_msec: %e", (int)now);
 	if (end < now)
 		panic("sleep: wrap");
 
-	while (sys_time_msec() < end)
+	while (time_msec() < end)
 		sys_yield();
 }
 